@@ -1,1208 +0,0 @@
-#include "../rng.h"
-
-constexpr static std::array<std::array<float,2>,4096> sample_2d_0
-#include "pmj02_0.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_1
-#include "pmj02_1.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_2
-#include "pmj02_2.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_3
-#include "pmj02_3.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_4
-#include "pmj02_4.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_5
-#include "pmj02_5.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_6
-#include "pmj02_6.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_7
-#include "pmj02_7.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_8
-#include "pmj02_8.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_9
-#include "pmj02_9.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_10
-#include "pmj02_10.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_11
-#include "pmj02_11.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_12
-#include "pmj02_12.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_13
-#include "pmj02_13.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_14
-#include "pmj02_14.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_15
-#include "pmj02_15.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_16
-#include "pmj02_16.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_17
-#include "pmj02_17.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_18
-#include "pmj02_18.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_19
-#include "pmj02_19.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_20
-#include "pmj02_20.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_21
-#include "pmj02_21.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_22
-#include "pmj02_22.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_23
-#include "pmj02_23.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_24
-#include "pmj02_24.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_25
-#include "pmj02_25.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_26
-#include "pmj02_26.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_27
-#include "pmj02_27.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_28
-#include "pmj02_28.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_29
-#include "pmj02_29.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_30
-#include "pmj02_30.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_31
-#include "pmj02_31.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_32
-#include "pmj02_32.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_33
-#include "pmj02_33.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_34
-#include "pmj02_34.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_35
-#include "pmj02_35.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_36
-#include "pmj02_36.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_37
-#include "pmj02_37.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_38
-#include "pmj02_38.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_39
-#include "pmj02_39.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_40
-#include "pmj02_40.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_41
-#include "pmj02_41.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_42
-#include "pmj02_42.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_43
-#include "pmj02_43.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_44
-#include "pmj02_44.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_45
-#include "pmj02_45.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_46
-#include "pmj02_46.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_47
-#include "pmj02_47.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_48
-#include "pmj02_48.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_49
-#include "pmj02_49.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_50
-#include "pmj02_50.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_51
-#include "pmj02_51.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_52
-#include "pmj02_52.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_53
-#include "pmj02_53.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_54
-#include "pmj02_54.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_55
-#include "pmj02_55.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_56
-#include "pmj02_56.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_57
-#include "pmj02_57.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_58
-#include "pmj02_58.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_59
-#include "pmj02_59.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_60
-#include "pmj02_60.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_61
-#include "pmj02_61.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_62
-#include "pmj02_62.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_63
-#include "pmj02_63.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_64
-#include "pmj02_64.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_65
-#include "pmj02_65.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_66
-#include "pmj02_66.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_67
-#include "pmj02_67.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_68
-#include "pmj02_68.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_69
-#include "pmj02_69.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_70
-#include "pmj02_70.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_71
-#include "pmj02_71.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_72
-#include "pmj02_72.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_73
-#include "pmj02_73.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_74
-#include "pmj02_74.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_75
-#include "pmj02_75.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_76
-#include "pmj02_76.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_77
-#include "pmj02_77.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_78
-#include "pmj02_78.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_79
-#include "pmj02_79.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_80
-#include "pmj02_80.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_81
-#include "pmj02_81.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_82
-#include "pmj02_82.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_83
-#include "pmj02_83.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_84
-#include "pmj02_84.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_85
-#include "pmj02_85.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_86
-#include "pmj02_86.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_87
-#include "pmj02_87.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_88
-#include "pmj02_88.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_89
-#include "pmj02_89.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_90
-#include "pmj02_90.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_91
-#include "pmj02_91.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_92
-#include "pmj02_92.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_93
-#include "pmj02_93.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_94
-#include "pmj02_94.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_95
-#include "pmj02_95.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_96
-#include "pmj02_96.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_97
-#include "pmj02_97.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_98
-#include "pmj02_98.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_99
-#include "pmj02_99.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_100
-#include "pmj02_100.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_101
-#include "pmj02_101.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_102
-#include "pmj02_102.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_103
-#include "pmj02_103.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_104
-#include "pmj02_104.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_105
-#include "pmj02_105.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_106
-#include "pmj02_106.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_107
-#include "pmj02_107.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_108
-#include "pmj02_108.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_109
-#include "pmj02_109.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_110
-#include "pmj02_110.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_111
-#include "pmj02_111.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_112
-#include "pmj02_112.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_113
-#include "pmj02_113.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_114
-#include "pmj02_114.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_115
-#include "pmj02_115.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_116
-#include "pmj02_116.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_117
-#include "pmj02_117.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_118
-#include "pmj02_118.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_119
-#include "pmj02_119.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_120
-#include "pmj02_120.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_121
-#include "pmj02_121.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_122
-#include "pmj02_122.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_123
-#include "pmj02_123.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_124
-#include "pmj02_124.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_125
-#include "pmj02_125.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_126
-#include "pmj02_126.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_127
-#include "pmj02_127.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_128
-#include "pmj02_128.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_129
-#include "pmj02_129.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_130
-#include "pmj02_130.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_131
-#include "pmj02_131.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_132
-#include "pmj02_132.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_133
-#include "pmj02_133.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_134
-#include "pmj02_134.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_135
-#include "pmj02_135.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_136
-#include "pmj02_136.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_137
-#include "pmj02_137.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_138
-#include "pmj02_138.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_139
-#include "pmj02_139.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_140
-#include "pmj02_140.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_141
-#include "pmj02_141.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_142
-#include "pmj02_142.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_143
-#include "pmj02_143.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_144
-#include "pmj02_144.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_145
-#include "pmj02_145.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_146
-#include "pmj02_146.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_147
-#include "pmj02_147.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_148
-#include "pmj02_148.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_149
-#include "pmj02_149.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_150
-#include "pmj02_150.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_151
-#include "pmj02_151.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_152
-#include "pmj02_152.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_153
-#include "pmj02_153.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_154
-#include "pmj02_154.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_155
-#include "pmj02_155.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_156
-#include "pmj02_156.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_157
-#include "pmj02_157.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_158
-#include "pmj02_158.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_159
-#include "pmj02_159.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_160
-#include "pmj02_160.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_161
-#include "pmj02_161.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_162
-#include "pmj02_162.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_163
-#include "pmj02_163.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_164
-#include "pmj02_164.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_165
-#include "pmj02_165.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_166
-#include "pmj02_166.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_167
-#include "pmj02_167.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_168
-#include "pmj02_168.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_169
-#include "pmj02_169.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_170
-#include "pmj02_170.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_171
-#include "pmj02_171.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_172
-#include "pmj02_172.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_173
-#include "pmj02_173.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_174
-#include "pmj02_174.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_175
-#include "pmj02_175.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_176
-#include "pmj02_176.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_177
-#include "pmj02_177.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_178
-#include "pmj02_178.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_179
-#include "pmj02_179.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_180
-#include "pmj02_180.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_181
-#include "pmj02_181.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_182
-#include "pmj02_182.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_183
-#include "pmj02_183.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_184
-#include "pmj02_184.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_185
-#include "pmj02_185.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_186
-#include "pmj02_186.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_187
-#include "pmj02_187.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_188
-#include "pmj02_188.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_189
-#include "pmj02_189.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_190
-#include "pmj02_190.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_191
-#include "pmj02_191.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_192
-#include "pmj02_192.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_193
-#include "pmj02_193.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_194
-#include "pmj02_194.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_195
-#include "pmj02_195.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_196
-#include "pmj02_196.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_197
-#include "pmj02_197.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_198
-#include "pmj02_198.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_199
-#include "pmj02_199.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_200
-#include "pmj02_200.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_201
-#include "pmj02_201.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_202
-#include "pmj02_202.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_203
-#include "pmj02_203.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_204
-#include "pmj02_204.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_205
-#include "pmj02_205.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_206
-#include "pmj02_206.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_207
-#include "pmj02_207.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_208
-#include "pmj02_208.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_209
-#include "pmj02_209.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_210
-#include "pmj02_210.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_211
-#include "pmj02_211.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_212
-#include "pmj02_212.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_213
-#include "pmj02_213.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_214
-#include "pmj02_214.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_215
-#include "pmj02_215.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_216
-#include "pmj02_216.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_217
-#include "pmj02_217.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_218
-#include "pmj02_218.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_219
-#include "pmj02_219.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_220
-#include "pmj02_220.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_221
-#include "pmj02_221.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_222
-#include "pmj02_222.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_223
-#include "pmj02_223.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_224
-#include "pmj02_224.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_225
-#include "pmj02_225.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_226
-#include "pmj02_226.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_227
-#include "pmj02_227.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_228
-#include "pmj02_228.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_229
-#include "pmj02_229.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_230
-#include "pmj02_230.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_231
-#include "pmj02_231.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_232
-#include "pmj02_232.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_233
-#include "pmj02_233.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_234
-#include "pmj02_234.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_235
-#include "pmj02_235.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_236
-#include "pmj02_236.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_237
-#include "pmj02_237.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_238
-#include "pmj02_238.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_239
-#include "pmj02_239.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_240
-#include "pmj02_240.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_241
-#include "pmj02_241.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_242
-#include "pmj02_242.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_243
-#include "pmj02_243.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_244
-#include "pmj02_244.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_245
-#include "pmj02_245.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_246
-#include "pmj02_246.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_247
-#include "pmj02_247.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_248
-#include "pmj02_248.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_249
-#include "pmj02_249.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_250
-#include "pmj02_250.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_251
-#include "pmj02_251.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_252
-#include "pmj02_252.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_253
-#include "pmj02_253.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_254
-#include "pmj02_254.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_255
-#include "pmj02_255.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_256
-#include "pmj02_256.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_257
-#include "pmj02_257.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_258
-#include "pmj02_258.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_259
-#include "pmj02_259.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_260
-#include "pmj02_260.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_261
-#include "pmj02_261.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_262
-#include "pmj02_262.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_263
-#include "pmj02_263.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_264
-#include "pmj02_264.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_265
-#include "pmj02_265.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_266
-#include "pmj02_266.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_267
-#include "pmj02_267.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_268
-#include "pmj02_268.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_269
-#include "pmj02_269.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_270
-#include "pmj02_270.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_271
-#include "pmj02_271.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_272
-#include "pmj02_272.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_273
-#include "pmj02_273.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_274
-#include "pmj02_274.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_275
-#include "pmj02_275.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_276
-#include "pmj02_276.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_277
-#include "pmj02_277.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_278
-#include "pmj02_278.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_279
-#include "pmj02_279.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_280
-#include "pmj02_280.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_281
-#include "pmj02_281.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_282
-#include "pmj02_282.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_283
-#include "pmj02_283.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_284
-#include "pmj02_284.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_285
-#include "pmj02_285.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_286
-#include "pmj02_286.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_287
-#include "pmj02_287.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_288
-#include "pmj02_288.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_289
-#include "pmj02_289.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_290
-#include "pmj02_290.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_291
-#include "pmj02_291.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_292
-#include "pmj02_292.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_293
-#include "pmj02_293.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_294
-#include "pmj02_294.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_295
-#include "pmj02_295.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_296
-#include "pmj02_296.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_297
-#include "pmj02_297.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_298
-#include "pmj02_298.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_299
-#include "pmj02_299.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_300
-#include "pmj02_300.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_301
-#include "pmj02_301.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_302
-#include "pmj02_302.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_303
-#include "pmj02_303.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_304
-#include "pmj02_304.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_305
-#include "pmj02_305.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_306
-#include "pmj02_306.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_307
-#include "pmj02_307.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_308
-#include "pmj02_308.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_309
-#include "pmj02_309.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_310
-#include "pmj02_310.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_311
-#include "pmj02_311.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_312
-#include "pmj02_312.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_313
-#include "pmj02_313.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_314
-#include "pmj02_314.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_315
-#include "pmj02_315.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_316
-#include "pmj02_316.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_317
-#include "pmj02_317.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_318
-#include "pmj02_318.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_319
-#include "pmj02_319.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_320
-#include "pmj02_320.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_321
-#include "pmj02_321.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_322
-#include "pmj02_322.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_323
-#include "pmj02_323.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_324
-#include "pmj02_324.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_325
-#include "pmj02_325.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_326
-#include "pmj02_326.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_327
-#include "pmj02_327.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_328
-#include "pmj02_328.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_329
-#include "pmj02_329.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_330
-#include "pmj02_330.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_331
-#include "pmj02_331.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_332
-#include "pmj02_332.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_333
-#include "pmj02_333.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_334
-#include "pmj02_334.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_335
-#include "pmj02_335.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_336
-#include "pmj02_336.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_337
-#include "pmj02_337.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_338
-#include "pmj02_338.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_339
-#include "pmj02_339.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_340
-#include "pmj02_340.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_341
-#include "pmj02_341.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_342
-#include "pmj02_342.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_343
-#include "pmj02_343.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_344
-#include "pmj02_344.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_345
-#include "pmj02_345.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_346
-#include "pmj02_346.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_347
-#include "pmj02_347.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_348
-#include "pmj02_348.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_349
-#include "pmj02_349.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_350
-#include "pmj02_350.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_351
-#include "pmj02_351.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_352
-#include "pmj02_352.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_353
-#include "pmj02_353.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_354
-#include "pmj02_354.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_355
-#include "pmj02_355.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_356
-#include "pmj02_356.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_357
-#include "pmj02_357.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_358
-#include "pmj02_358.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_359
-#include "pmj02_359.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_360
-#include "pmj02_360.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_361
-#include "pmj02_361.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_362
-#include "pmj02_362.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_363
-#include "pmj02_363.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_364
-#include "pmj02_364.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_365
-#include "pmj02_365.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_366
-#include "pmj02_366.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_367
-#include "pmj02_367.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_368
-#include "pmj02_368.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_369
-#include "pmj02_369.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_370
-#include "pmj02_370.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_371
-#include "pmj02_371.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_372
-#include "pmj02_372.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_373
-#include "pmj02_373.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_374
-#include "pmj02_374.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_375
-#include "pmj02_375.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_376
-#include "pmj02_376.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_377
-#include "pmj02_377.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_378
-#include "pmj02_378.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_379
-#include "pmj02_379.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_380
-#include "pmj02_380.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_381
-#include "pmj02_381.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_382
-#include "pmj02_382.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_383
-#include "pmj02_383.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_384
-#include "pmj02_384.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_385
-#include "pmj02_385.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_386
-#include "pmj02_386.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_387
-#include "pmj02_387.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_388
-#include "pmj02_388.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_389
-#include "pmj02_389.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_390
-#include "pmj02_390.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_391
-#include "pmj02_391.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_392
-#include "pmj02_392.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_393
-#include "pmj02_393.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_394
-#include "pmj02_394.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_395
-#include "pmj02_395.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_396
-#include "pmj02_396.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_397
-#include "pmj02_397.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_398
-#include "pmj02_398.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_399
-#include "pmj02_399.inl"
-;
-constexpr static std::array<std::array<float,2>,4096> sample_2d_400
-#include "pmj02_400.inl"
-;
-std::array<const std::array<std::array<float,2>,4096>*,401> samples_2d
-#include "pmj02_indices.inl"
-;
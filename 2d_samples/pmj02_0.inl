@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.969748259f, 0.257224351f},
-std::array<float,2>{0.136597604f, 0.937768161f},
-std::array<float,2>{0.689370811f, 0.518513203f},
-std::array<float,2>{0.303449452f, 0.19647792f},
-std::array<float,2>{0.56319803f, 0.0610209294f},
-std::array<float,2>{0.413590223f, 0.736212313f},
-std::array<float,2>{0.823478043f, 0.818940639f},
-std::array<float,2>{0.0546202324f, 0.491176963f},
-std::array<float,2>{0.666243851f, 0.419274002f},
-std::array<float,2>{0.336786836f, 0.784869671f},
-std::array<float,2>{0.879972458f, 0.627844691f},
-std::array<float,2>{0.217982024f, 0.117804758f},
-std::array<float,2>{0.794282079f, 0.164734244f},
-std::array<float,2>{0.12159165f, 0.572196305f},
-std::array<float,2>{0.555337727f, 0.907491803f},
-std::array<float,2>{0.46766308f, 0.349259853f},
-std::array<float,2>{0.866754234f, 0.44911173f},
-std::array<float,2>{0.00564867212f, 0.87462163f},
-std::array<float,2>{0.622956157f, 0.705773532f},
-std::array<float,2>{0.392617077f, 0.0237334222f},
-std::array<float,2>{0.726517975f, 0.243936822f},
-std::array<float,2>{0.260319829f, 0.550421238f},
-std::array<float,2>{0.952442348f, 0.992270172f},
-std::array<float,2>{0.160768867f, 0.312077612f},
-std::array<float,2>{0.505271137f, 0.327855378f},
-std::array<float,2>{0.474348485f, 0.89843142f},
-std::array<float,2>{0.774091065f, 0.621193409f},
-std::array<float,2>{0.0810169652f, 0.14910835f},
-std::array<float,2>{0.918095112f, 0.0695544332f},
-std::array<float,2>{0.219585344f, 0.667412698f},
-std::array<float,2>{0.644610941f, 0.752573192f},
-std::array<float,2>{0.350405604f, 0.381094038f},
-std::array<float,2>{0.755377352f, 0.359879524f},
-std::array<float,2>{0.0710491315f, 0.92711252f},
-std::array<float,2>{0.527010441f, 0.581440985f},
-std::array<float,2>{0.492544264f, 0.172717914f},
-std::array<float,2>{0.625536859f, 0.100963384f},
-std::array<float,2>{0.369963527f, 0.644215524f},
-std::array<float,2>{0.928612888f, 0.808945954f},
-std::array<float,2>{0.245018199f, 0.424711525f},
-std::array<float,2>{0.606885076f, 0.475067943f},
-std::array<float,2>{0.384993583f, 0.835216582f},
-std::array<float,2>{0.854362905f, 0.727373898f},
-std::array<float,2>{0.0183706824f, 0.0329641812f},
-std::array<float,2>{0.956120551f, 0.21517773f},
-std::array<float,2>{0.173002407f, 0.513843596f},
-std::array<float,2>{0.744725227f, 0.966529012f},
-std::array<float,2>{0.275071412f, 0.278965831f},
-std::array<float,2>{0.897932291f, 0.403171092f},
-std::array<float,2>{0.191934884f, 0.771714449f},
-std::array<float,2>{0.676240742f, 0.674141288f},
-std::array<float,2>{0.327963233f, 0.0907960758f},
-std::array<float,2>{0.534635544f, 0.128641918f},
-std::array<float,2>{0.450379401f, 0.594972432f},
-std::array<float,2>{0.810124874f, 0.883882642f},
-std::array<float,2>{0.107259125f, 0.330744922f},
-std::array<float,2>{0.703134298f, 0.289847255f},
-std::array<float,2>{0.292133182f, 0.972943187f},
-std::array<float,2>{0.993907809f, 0.544845462f},
-std::array<float,2>{0.14137198f, 0.220320582f},
-std::array<float,2>{0.828300178f, 0.00950583909f},
-std::array<float,2>{0.0385096855f, 0.6901806f},
-std::array<float,2>{0.59282732f, 0.848545969f},
-std::array<float,2>{0.435337335f, 0.456860781f},
-std::array<float,2>{0.936133444f, 0.33941716f},
-std::array<float,2>{0.23480548f, 0.87891978f},
-std::array<float,2>{0.639995396f, 0.608575106f},
-std::array<float,2>{0.363620102f, 0.135333255f},
-std::array<float,2>{0.518663585f, 0.0799830556f},
-std::array<float,2>{0.491892815f, 0.681916952f},
-std::array<float,2>{0.758865774f, 0.777889729f},
-std::array<float,2>{0.0651581883f, 0.394994617f},
-std::array<float,2>{0.741672695f, 0.461979151f},
-std::array<float,2>{0.269659191f, 0.856784761f},
-std::array<float,2>{0.963507891f, 0.695352316f},
-std::array<float,2>{0.185933858f, 0.00727637485f},
-std::array<float,2>{0.848286867f, 0.232026428f},
-std::array<float,2>{0.0250457823f, 0.53898412f},
-std::array<float,2>{0.597195983f, 0.983804405f},
-std::array<float,2>{0.382587433f, 0.287769735f},
-std::array<float,2>{0.801247716f, 0.437317014f},
-std::array<float,2>{0.0988455936f, 0.79980725f},
-std::array<float,2>{0.540201485f, 0.648655951f},
-std::array<float,2>{0.441105992f, 0.103176624f},
-std::array<float,2>{0.681433141f, 0.182634115f},
-std::array<float,2>{0.317406386f, 0.586473107f},
-std::array<float,2>{0.903301418f, 0.933320045f},
-std::array<float,2>{0.202119395f, 0.369772762f},
-std::array<float,2>{0.578459084f, 0.273073912f},
-std::array<float,2>{0.428398311f, 0.957207501f},
-std::array<float,2>{0.8411901f, 0.503507137f},
-std::array<float,2>{0.0402720682f, 0.209799215f},
-std::array<float,2>{0.985615015f, 0.0399245098f},
-std::array<float,2>{0.148726255f, 0.726355433f},
-std::array<float,2>{0.715573251f, 0.836657584f},
-std::array<float,2>{0.281986922f, 0.481803656f},
-std::array<float,2>{0.815250278f, 0.297113657f},
-std::array<float,2>{0.0561053082f, 0.989367902f},
-std::array<float,2>{0.57268703f, 0.558652222f},
-std::array<float,2>{0.414502084f, 0.235185817f},
-std::array<float,2>{0.697194338f, 0.0233100634f},
-std::array<float,2>{0.308511198f, 0.711111665f},
-std::array<float,2>{0.980019331f, 0.86191982f},
-std::array<float,2>{0.125103608f, 0.439373851f},
-std::array<float,2>{0.548622549f, 0.383825302f},
-std::array<float,2>{0.455356956f, 0.763666272f},
-std::array<float,2>{0.788400412f, 0.663588464f},
-std::array<float,2>{0.11009673f, 0.070942238f},
-std::array<float,2>{0.886579812f, 0.147110417f},
-std::array<float,2>{0.203600511f, 0.614174724f},
-std::array<float,2>{0.656677425f, 0.904198825f},
-std::array<float,2>{0.332233876f, 0.315061212f},
-std::array<float,2>{0.940379798f, 0.494743556f},
-std::array<float,2>{0.165237531f, 0.821413577f},
-std::array<float,2>{0.728074193f, 0.749580085f},
-std::array<float,2>{0.254825115f, 0.0528042503f},
-std::array<float,2>{0.610118032f, 0.194269329f},
-std::array<float,2>{0.401728153f, 0.528513432f},
-std::array<float,2>{0.874549747f, 0.952210724f},
-std::array<float,2>{0.0106826536f, 0.261504173f},
-std::array<float,2>{0.654441595f, 0.3574377f},
-std::array<float,2>{0.353606611f, 0.914727569f},
-std::array<float,2>{0.912276924f, 0.569302976f},
-std::array<float,2>{0.233878553f, 0.162948772f},
-std::array<float,2>{0.768446207f, 0.109677337f},
-std::array<float,2>{0.093215555f, 0.635254622f},
-std::array<float,2>{0.510856032f, 0.790067494f},
-std::array<float,2>{0.478378356f, 0.407048553f},
-std::array<float,2>{0.967019856f, 0.346582681f},
-std::array<float,2>{0.182580993f, 0.912298977f},
-std::array<float,2>{0.73765707f, 0.57667011f},
-std::array<float,2>{0.268116355f, 0.170119956f},
-std::array<float,2>{0.597883105f, 0.123047605f},
-std::array<float,2>{0.377685636f, 0.629757106f},
-std::array<float,2>{0.843875051f, 0.787367165f},
-std::array<float,2>{0.0288369209f, 0.415987253f},
-std::array<float,2>{0.633739412f, 0.485078961f},
-std::array<float,2>{0.362138331f, 0.816365421f},
-std::array<float,2>{0.931260347f, 0.740388513f},
-std::array<float,2>{0.238825783f, 0.0567182153f},
-std::array<float,2>{0.764652252f, 0.199405044f},
-std::array<float,2>{0.068998687f, 0.523297369f},
-std::array<float,2>{0.519745529f, 0.94198072f},
-std::array<float,2>{0.484599531f, 0.253620595f},
-std::array<float,2>{0.839261174f, 0.376560718f},
-std::array<float,2>{0.046874024f, 0.754900396f},
-std::array<float,2>{0.583112895f, 0.67184639f},
-std::array<float,2>{0.421946406f, 0.066164799f},
-std::array<float,2>{0.71101886f, 0.155344203f},
-std::array<float,2>{0.287824333f, 0.619293571f},
-std::array<float,2>{0.991186738f, 0.892571509f},
-std::array<float,2>{0.156131402f, 0.321034193f},
-std::array<float,2>{0.545635998f, 0.305424273f},
-std::array<float,2>{0.442677706f, 0.998641372f},
-std::array<float,2>{0.800563633f, 0.552369595f},
-std::array<float,2>{0.0940569565f, 0.248582333f},
-std::array<float,2>{0.902168036f, 0.029131351f},
-std::array<float,2>{0.198893145f, 0.70891428f},
-std::array<float,2>{0.684063196f, 0.868708014f},
-std::array<float,2>{0.31440118f, 0.450763017f},
-std::array<float,2>{0.7823084f, 0.276431024f},
-std::array<float,2>{0.116749994f, 0.962557614f},
-std::array<float,2>{0.553717256f, 0.510175705f},
-std::array<float,2>{0.457563818f, 0.210995331f},
-std::array<float,2>{0.662504733f, 0.0355797224f},
-std::array<float,2>{0.328234136f, 0.732925773f},
-std::array<float,2>{0.887664437f, 0.828324199f},
-std::array<float,2>{0.209816739f, 0.47249034f},
-std::array<float,2>{0.576442003f, 0.426872879f},
-std::array<float,2>{0.419072837f, 0.806842804f},
-std::array<float,2>{0.81779182f, 0.646823049f},
-std::array<float,2>{0.0597020946f, 0.0969672427f},
-std::array<float,2>{0.982842863f, 0.178094715f},
-std::array<float,2>{0.131483048f, 0.583457232f},
-std::array<float,2>{0.69931215f, 0.923646986f},
-std::array<float,2>{0.310294479f, 0.367109179f},
-std::array<float,2>{0.908987939f, 0.458728641f},
-std::array<float,2>{0.227204278f, 0.843969107f},
-std::array<float,2>{0.64872092f, 0.692277133f},
-std::array<float,2>{0.356934547f, 0.0140881585f},
-std::array<float,2>{0.513488412f, 0.225333467f},
-std::array<float,2>{0.483240753f, 0.539624095f},
-std::array<float,2>{0.770685077f, 0.9710778f},
-std::array<float,2>{0.0878772289f, 0.293169856f},
-std::array<float,2>{0.731331468f, 0.332856059f},
-std::array<float,2>{0.252800822f, 0.889307022f},
-std::array<float,2>{0.941796243f, 0.600859523f},
-std::array<float,2>{0.168855354f, 0.130393371f},
-std::array<float,2>{0.870991528f, 0.0895062163f},
-std::array<float,2>{0.0122442031f, 0.676465154f},
-std::array<float,2>{0.61651516f, 0.768401921f},
-std::array<float,2>{0.40266791f, 0.398603648f},
-std::array<float,2>{0.87608546f, 0.283351034f},
-std::array<float,2>{0.214837521f, 0.979554534f},
-std::array<float,2>{0.668459475f, 0.532251596f},
-std::array<float,2>{0.342864186f, 0.229216829f},
-std::array<float,2>{0.559884071f, 0.00226725428f},
-std::array<float,2>{0.464639515f, 0.699506938f},
-std::array<float,2>{0.791485131f, 0.851728141f},
-std::array<float,2>{0.118835352f, 0.465530336f},
-std::array<float,2>{0.692973316f, 0.394342393f},
-std::array<float,2>{0.297388822f, 0.777138352f},
-std::array<float,2>{0.974149048f, 0.68511647f},
-std::array<float,2>{0.137954861f, 0.0843222737f},
-std::array<float,2>{0.826947987f, 0.138052836f},
-std::array<float,2>{0.0495722108f, 0.604704142f},
-std::array<float,2>{0.570134163f, 0.878590643f},
-std::array<float,2>{0.40808925f, 0.341625094f},
-std::array<float,2>{0.77754873f, 0.478952378f},
-std::array<float,2>{0.0847578198f, 0.842547655f},
-std::array<float,2>{0.502963722f, 0.719045877f},
-std::array<float,2>{0.470169306f, 0.0445453413f},
-std::array<float,2>{0.643909872f, 0.20662193f},
-std::array<float,2>{0.34513244f, 0.505235612f},
-std::array<float,2>{0.916270673f, 0.956624389f},
-std::array<float,2>{0.224579588f, 0.267653584f},
-std::array<float,2>{0.618943572f, 0.371834666f},
-std::array<float,2>{0.398358375f, 0.934307098f},
-std::array<float,2>{0.862698436f, 0.591094494f},
-std::array<float,2>{0.00123576901f, 0.183605865f},
-std::array<float,2>{0.948759198f, 0.106068432f},
-std::array<float,2>{0.157032058f, 0.655066371f},
-std::array<float,2>{0.722221136f, 0.801214993f},
-std::array<float,2>{0.265587837f, 0.429841071f},
-std::array<float,2>{0.855697989f, 0.318069518f},
-std::array<float,2>{0.0201700609f, 0.899168909f},
-std::array<float,2>{0.602606952f, 0.610701919f},
-std::array<float,2>{0.387961775f, 0.14376834f},
-std::array<float,2>{0.749459088f, 0.0744425729f},
-std::array<float,2>{0.281151295f, 0.659616828f},
-std::array<float,2>{0.960309327f, 0.759035826f},
-std::array<float,2>{0.17699191f, 0.388410419f},
-std::array<float,2>{0.528767705f, 0.443831593f},
-std::array<float,2>{0.499180675f, 0.866493642f},
-std::array<float,2>{0.752921939f, 0.716342866f},
-std::array<float,2>{0.0780474693f, 0.0168543495f},
-std::array<float,2>{0.922342181f, 0.240383938f},
-std::array<float,2>{0.247190967f, 0.555364668f},
-std::array<float,2>{0.629837692f, 0.985822499f},
-std::array<float,2>{0.372876823f, 0.302104294f},
-std::array<float,2>{0.999771953f, 0.413033336f},
-std::array<float,2>{0.145216554f, 0.795464814f},
-std::array<float,2>{0.708144546f, 0.639754534f},
-std::array<float,2>{0.294293553f, 0.113426551f},
-std::array<float,2>{0.586975038f, 0.158898413f},
-std::array<float,2>{0.431599259f, 0.562985241f},
-std::array<float,2>{0.834461808f, 0.920827627f},
-std::array<float,2>{0.0347024687f, 0.352282315f},
-std::array<float,2>{0.673756301f, 0.265373528f},
-std::array<float,2>{0.320895731f, 0.949059248f},
-std::array<float,2>{0.893779874f, 0.524463713f},
-std::array<float,2>{0.189305082f, 0.189318702f},
-std::array<float,2>{0.806214571f, 0.0506865121f},
-std::array<float,2>{0.103236459f, 0.745114982f},
-std::array<float,2>{0.536074281f, 0.825094581f},
-std::array<float,2>{0.44532305f, 0.497628719f},
-std::array<float,2>{0.950632453f, 0.309973896f},
-std::array<float,2>{0.163431138f, 0.995776236f},
-std::array<float,2>{0.723410368f, 0.548430681f},
-std::array<float,2>{0.258966208f, 0.245283931f},
-std::array<float,2>{0.624460816f, 0.026000604f},
-std::array<float,2>{0.391077816f, 0.70327121f},
-std::array<float,2>{0.864074945f, 0.87291038f},
-std::array<float,2>{0.0072371061f, 0.446189195f},
-std::array<float,2>{0.648240447f, 0.379829019f},
-std::array<float,2>{0.348879457f, 0.751092374f},
-std::array<float,2>{0.920725107f, 0.664279222f},
-std::array<float,2>{0.222601295f, 0.0675881878f},
-std::array<float,2>{0.776333392f, 0.152100667f},
-std::array<float,2>{0.0790763125f, 0.624195218f},
-std::array<float,2>{0.506147563f, 0.895118773f},
-std::array<float,2>{0.476448536f, 0.325816274f},
-std::array<float,2>{0.821218312f, 0.488628268f},
-std::array<float,2>{0.0523140132f, 0.816609085f},
-std::array<float,2>{0.564670563f, 0.737730086f},
-std::array<float,2>{0.411411434f, 0.0597052723f},
-std::array<float,2>{0.690561891f, 0.198070258f},
-std::array<float,2>{0.300817668f, 0.517018855f},
-std::array<float,2>{0.971269965f, 0.941070914f},
-std::array<float,2>{0.134303242f, 0.255153298f},
-std::array<float,2>{0.557636976f, 0.350387782f},
-std::array<float,2>{0.466691583f, 0.909296691f},
-std::array<float,2>{0.796617866f, 0.573549092f},
-std::array<float,2>{0.123743273f, 0.166017696f},
-std::array<float,2>{0.881803989f, 0.121083856f},
-std::array<float,2>{0.215633392f, 0.626867175f},
-std::array<float,2>{0.664219737f, 0.782632351f},
-std::array<float,2>{0.338781059f, 0.42035985f},
-std::array<float,2>{0.811239958f, 0.329152495f},
-std::array<float,2>{0.109052353f, 0.885320425f},
-std::array<float,2>{0.53239578f, 0.597156525f},
-std::array<float,2>{0.452904105f, 0.126119256f},
-std::array<float,2>{0.678036749f, 0.0932231545f},
-std::array<float,2>{0.324954838f, 0.672402024f},
-std::array<float,2>{0.894790828f, 0.770295918f},
-std::array<float,2>{0.195052326f, 0.405582279f},
-std::array<float,2>{0.590663373f, 0.453517854f},
-std::array<float,2>{0.437422991f, 0.849818587f},
-std::array<float,2>{0.830846131f, 0.689056456f},
-std::array<float,2>{0.0369202271f, 0.0105601996f},
-std::array<float,2>{0.994179666f, 0.221926078f},
-std::array<float,2>{0.144446701f, 0.546804011f},
-std::array<float,2>{0.7051512f, 0.974975228f},
-std::array<float,2>{0.28927961f, 0.291067004f},
-std::array<float,2>{0.926277697f, 0.422161222f},
-std::array<float,2>{0.243626043f, 0.811709762f},
-std::array<float,2>{0.628468931f, 0.642574668f},
-std::array<float,2>{0.3689439f, 0.0991491154f},
-std::array<float,2>{0.524869442f, 0.173931658f},
-std::array<float,2>{0.495326668f, 0.578493714f},
-std::array<float,2>{0.755867004f, 0.92909801f},
-std::array<float,2>{0.0733954906f, 0.361954272f},
-std::array<float,2>{0.742592037f, 0.27993688f},
-std::array<float,2>{0.27611798f, 0.968682051f},
-std::array<float,2>{0.954195976f, 0.512990475f},
-std::array<float,2>{0.174870864f, 0.217250884f},
-std::array<float,2>{0.851788402f, 0.0348569117f},
-std::array<float,2>{0.0162144676f, 0.7294029f},
-std::array<float,2>{0.607893705f, 0.832176268f},
-std::array<float,2>{0.384528339f, 0.473825812f},
-std::array<float,2>{0.904622436f, 0.369055808f},
-std::array<float,2>{0.200830743f, 0.931170225f},
-std::array<float,2>{0.682504654f, 0.588232636f},
-std::array<float,2>{0.318403274f, 0.180618569f},
-std::array<float,2>{0.54270947f, 0.105371252f},
-std::array<float,2>{0.438374847f, 0.650542796f},
-std::array<float,2>{0.802752256f, 0.798085034f},
-std::array<float,2>{0.10090173f, 0.435357422f},
-std::array<float,2>{0.718356729f, 0.483774126f},
-std::array<float,2>{0.283976614f, 0.839178205f},
-std::array<float,2>{0.988228083f, 0.7228266f},
-std::array<float,2>{0.151454121f, 0.0427004993f},
-std::array<float,2>{0.842468023f, 0.207843691f},
-std::array<float,2>{0.0410606377f, 0.500729322f},
-std::array<float,2>{0.581705391f, 0.960078776f},
-std::array<float,2>{0.426941603f, 0.26997605f},
-std::array<float,2>{0.760765195f, 0.397530913f},
-std::array<float,2>{0.0636212304f, 0.779517353f},
-std::array<float,2>{0.515911877f, 0.680904627f},
-std::array<float,2>{0.488527238f, 0.0812086239f},
-std::array<float,2>{0.637311459f, 0.133370295f},
-std::array<float,2>{0.365887523f, 0.605738759f},
-std::array<float,2>{0.93554163f, 0.88198328f},
-std::array<float,2>{0.238079041f, 0.337424725f},
-std::array<float,2>{0.595181882f, 0.285204709f},
-std::array<float,2>{0.380465209f, 0.981350422f},
-std::array<float,2>{0.851217449f, 0.535364747f},
-std::array<float,2>{0.0254912041f, 0.234189659f},
-std::array<float,2>{0.961120784f, 0.00461507123f},
-std::array<float,2>{0.18491742f, 0.698850513f},
-std::array<float,2>{0.738392174f, 0.857905924f},
-std::array<float,2>{0.271499276f, 0.464475274f},
-std::array<float,2>{0.871928453f, 0.259179622f},
-std::array<float,2>{0.0082130488f, 0.950570226f},
-std::array<float,2>{0.611513376f, 0.529510319f},
-std::array<float,2>{0.398726016f, 0.191950679f},
-std::array<float,2>{0.72930038f, 0.0509982482f},
-std::array<float,2>{0.256311178f, 0.746498585f},
-std::array<float,2>{0.939193368f, 0.823361695f},
-std::array<float,2>{0.167309448f, 0.49294275f},
-std::array<float,2>{0.509382784f, 0.408251882f},
-std::array<float,2>{0.480440289f, 0.79208976f},
-std::array<float,2>{0.76597631f, 0.634610534f},
-std::array<float,2>{0.0898916498f, 0.112253383f},
-std::array<float,2>{0.910392702f, 0.161585033f},
-std::array<float,2>{0.231272727f, 0.568313122f},
-std::array<float,2>{0.65345031f, 0.917968214f},
-std::array<float,2>{0.35190326f, 0.355784476f},
-std::array<float,2>{0.976918757f, 0.439474702f},
-std::array<float,2>{0.128388897f, 0.860499144f},
-std::array<float,2>{0.697696984f, 0.71426475f},
-std::array<float,2>{0.306184769f, 0.0204100516f},
-std::array<float,2>{0.571986079f, 0.237606123f},
-std::array<float,2>{0.417592257f, 0.561275005f},
-std::array<float,2>{0.813686013f, 0.991898775f},
-std::array<float,2>{0.0567381643f, 0.300218761f},
-std::array<float,2>{0.659679592f, 0.313981444f},
-std::array<float,2>{0.334273696f, 0.905153632f},
-std::array<float,2>{0.884256423f, 0.616449416f},
-std::array<float,2>{0.205397114f, 0.146318778f},
-std::array<float,2>{0.785351515f, 0.0739857256f},
-std::array<float,2>{0.112099044f, 0.660384834f},
-std::array<float,2>{0.550373733f, 0.764375091f},
-std::array<float,2>{0.454184324f, 0.385683298f},
-std::array<float,2>{0.988969862f, 0.323455125f},
-std::array<float,2>{0.153926283f, 0.89344275f},
-std::array<float,2>{0.714095294f, 0.617407918f},
-std::array<float,2>{0.286993623f, 0.154000446f},
-std::array<float,2>{0.585445166f, 0.0632042065f},
-std::array<float,2>{0.425657511f, 0.669558704f},
-std::array<float,2>{0.837821066f, 0.757450223f},
-std::array<float,2>{0.043468304f, 0.37744543f},
-std::array<float,2>{0.685920954f, 0.452211261f},
-std::array<float,2>{0.316352934f, 0.870130181f},
-std::array<float,2>{0.898805559f, 0.710440218f},
-std::array<float,2>{0.196855336f, 0.0298948791f},
-std::array<float,2>{0.797661841f, 0.246593744f},
-std::array<float,2>{0.096210748f, 0.554390967f},
-std::array<float,2>{0.544586957f, 0.997288764f},
-std::array<float,2>{0.44513914f, 0.308529556f},
-std::array<float,2>{0.84605056f, 0.417480648f},
-std::array<float,2>{0.030779833f, 0.785807431f},
-std::array<float,2>{0.599887252f, 0.631983876f},
-std::array<float,2>{0.376559496f, 0.122570395f},
-std::array<float,2>{0.735203683f, 0.168628871f},
-std::array<float,2>{0.265626371f, 0.574673533f},
-std::array<float,2>{0.965504527f, 0.911970258f},
-std::array<float,2>{0.181296155f, 0.343833953f},
-std::array<float,2>{0.522450805f, 0.250109226f},
-std::array<float,2>{0.487170547f, 0.944142342f},
-std::array<float,2>{0.762444496f, 0.52050066f},
-std::array<float,2>{0.0681758076f, 0.202120394f},
-std::array<float,2>{0.932174921f, 0.0555774793f},
-std::array<float,2>{0.241600052f, 0.738723457f},
-std::array<float,2>{0.634886384f, 0.81397593f},
-std::array<float,2>{0.361055046f, 0.487976551f},
-std::array<float,2>{0.77252841f, 0.296376705f},
-std::array<float,2>{0.0898020789f, 0.970309973f},
-std::array<float,2>{0.514525414f, 0.542737424f},
-std::array<float,2>{0.481507748f, 0.223693267f},
-std::array<float,2>{0.65128088f, 0.0121791316f},
-std::array<float,2>{0.359292388f, 0.694616795f},
-std::array<float,2>{0.908162296f, 0.846087396f},
-std::array<float,2>{0.229480267f, 0.460276723f},
-std::array<float,2>{0.613731802f, 0.401963562f},
-std::array<float,2>{0.406190991f, 0.766797125f},
-std::array<float,2>{0.867812276f, 0.678845346f},
-std::array<float,2>{0.0142789604f, 0.0868497416f},
-std::array<float,2>{0.943908691f, 0.13196893f},
-std::array<float,2>{0.171758503f, 0.598581731f},
-std::array<float,2>{0.732583582f, 0.886883616f},
-std::array<float,2>{0.251513332f, 0.335597694f},
-std::array<float,2>{0.890487492f, 0.469170392f},
-std::array<float,2>{0.207050949f, 0.830153763f},
-std::array<float,2>{0.660284162f, 0.73114866f},
-std::array<float,2>{0.330310434f, 0.0380003899f},
-std::array<float,2>{0.551192999f, 0.21477975f},
-std::array<float,2>{0.459406614f, 0.508063436f},
-std::array<float,2>{0.784559011f, 0.963776767f},
-std::array<float,2>{0.114966065f, 0.273881406f},
-std::array<float,2>{0.701446414f, 0.36480695f},
-std::array<float,2>{0.310858428f, 0.925359309f},
-std::array<float,2>{0.981965601f, 0.584612608f},
-std::array<float,2>{0.130388141f, 0.176204145f},
-std::array<float,2>{0.818769932f, 0.0949873924f},
-std::array<float,2>{0.0608193763f, 0.646210611f},
-std::array<float,2>{0.574456513f, 0.805766642f},
-std::array<float,2>{0.421223342f, 0.429020673f},
-std::array<float,2>{0.914221585f, 0.267087787f},
-std::array<float,2>{0.226328582f, 0.953508258f},
-std::array<float,2>{0.642236948f, 0.507783175f},
-std::array<float,2>{0.346620888f, 0.205064446f},
-std::array<float,2>{0.500696957f, 0.045802068f},
-std::array<float,2>{0.472407758f, 0.721236587f},
-std::array<float,2>{0.77977854f, 0.841679037f},
-std::array<float,2>{0.082770817f, 0.478069097f},
-std::array<float,2>{0.720289171f, 0.433278739f},
-std::array<float,2>{0.261876225f, 0.803967357f},
-std::array<float,2>{0.945552886f, 0.652466536f},
-std::array<float,2>{0.158884674f, 0.108955912f},
-std::array<float,2>{0.860201657f, 0.18692185f},
-std::array<float,2>{0.00289083808f, 0.593101025f},
-std::array<float,2>{0.62060225f, 0.936345279f},
-std::array<float,2>{0.395071596f, 0.373546124f},
-std::array<float,2>{0.789530575f, 0.467591256f},
-std::array<float,2>{0.119796678f, 0.854868352f},
-std::array<float,2>{0.561645389f, 0.701789677f},
-std::array<float,2>{0.461286753f, 0.00167058373f},
-std::array<float,2>{0.670104504f, 0.2278492f},
-std::array<float,2>{0.340811491f, 0.534238458f},
-std::array<float,2>{0.877843738f, 0.977663875f},
-std::array<float,2>{0.212216541f, 0.283177942f},
-std::array<float,2>{0.568165481f, 0.341869712f},
-std::array<float,2>{0.408308506f, 0.875003457f},
-std::array<float,2>{0.824387312f, 0.602619052f},
-std::array<float,2>{0.0474869609f, 0.139692128f},
-std::array<float,2>{0.976100683f, 0.0830042958f},
-std::array<float,2>{0.140434086f, 0.685697198f},
-std::array<float,2>{0.693700314f, 0.774067104f},
-std::array<float,2>{0.300350785f, 0.392395675f},
-std::array<float,2>{0.832469285f, 0.354177654f},
-std::array<float,2>{0.0324607044f, 0.917968869f},
-std::array<float,2>{0.589625239f, 0.56499964f},
-std::array<float,2>{0.432237983f, 0.15732044f},
-std::array<float,2>{0.710752547f, 0.116340369f},
-std::array<float,2>{0.295868427f, 0.638544977f},
-std::array<float,2>{0.996312618f, 0.794656575f},
-std::array<float,2>{0.147813082f, 0.410626948f},
-std::array<float,2>{0.53736037f, 0.499823004f},
-std::array<float,2>{0.447961003f, 0.827129781f},
-std::array<float,2>{0.808071077f, 0.742681623f},
-std::array<float,2>{0.104672268f, 0.0476118773f},
-std::array<float,2>{0.891096652f, 0.189705536f},
-std::array<float,2>{0.191040143f, 0.525889099f},
-std::array<float,2>{0.674063265f, 0.946378529f},
-std::array<float,2>{0.322604805f, 0.263354719f},
-std::array<float,2>{0.958136916f, 0.389007866f},
-std::array<float,2>{0.178274587f, 0.760680497f},
-std::array<float,2>{0.747009873f, 0.657771528f},
-std::array<float,2>{0.27776733f, 0.0768926293f},
-std::array<float,2>{0.603874028f, 0.142415464f},
-std::array<float,2>{0.389178604f, 0.612012327f},
-std::array<float,2>{0.857986987f, 0.900454521f},
-std::array<float,2>{0.0219963882f, 0.318573564f},
-std::array<float,2>{0.632145166f, 0.304399043f},
-std::array<float,2>{0.373555422f, 0.987545192f},
-std::array<float,2>{0.925662577f, 0.5584445f},
-std::array<float,2>{0.248798832f, 0.238591433f},
-std::array<float,2>{0.750165701f, 0.0190730318f},
-std::array<float,2>{0.0743939504f, 0.717133522f},
-std::array<float,2>{0.530580163f, 0.864016831f},
-std::array<float,2>{0.497203022f, 0.442443669f},
-std::array<float,2>{0.992907643f, 0.292183042f},
-std::array<float,2>{0.142340034f, 0.97563833f},
-std::array<float,2>{0.704606891f, 0.545204461f},
-std::array<float,2>{0.291203797f, 0.221049637f},
-std::array<float,2>{0.592361212f, 0.011181606f},
-std::array<float,2>{0.433907926f, 0.687972546f},
-std::array<float,2>{0.829185605f, 0.851281106f},
-std::array<float,2>{0.037153244f, 0.454917014f},
-std::array<float,2>{0.677076876f, 0.404881179f},
-std::array<float,2>{0.326280057f, 0.771093905f},
-std::array<float,2>{0.896876693f, 0.673287332f},
-std::array<float,2>{0.193194851f, 0.0927485079f},
-std::array<float,2>{0.808599412f, 0.125407383f},
-std::array<float,2>{0.106372021f, 0.596244574f},
-std::array<float,2>{0.53351599f, 0.886582851f},
-std::array<float,2>{0.449502736f, 0.328436732f},
-std::array<float,2>{0.854683936f, 0.473361045f},
-std::array<float,2>{0.0187427662f, 0.833340645f},
-std::array<float,2>{0.606345534f, 0.729953408f},
-std::array<float,2>{0.386505604f, 0.0334474556f},
-std::array<float,2>{0.746028244f, 0.218738005f},
-std::array<float,2>{0.273870021f, 0.512684822f},
-std::array<float,2>{0.955821216f, 0.96756798f},
-std::array<float,2>{0.172328681f, 0.280410826f},
-std::array<float,2>{0.525508821f, 0.362467408f},
-std::array<float,2>{0.493689805f, 0.928552449f},
-std::array<float,2>{0.754235566f, 0.580033004f},
-std::array<float,2>{0.0719966739f, 0.175250813f},
-std::array<float,2>{0.928942502f, 0.0985597f},
-std::array<float,2>{0.245291054f, 0.640890002f},
-std::array<float,2>{0.626838923f, 0.811161458f},
-std::array<float,2>{0.370282084f, 0.422940701f},
-std::array<float,2>{0.774998069f, 0.324929714f},
-std::array<float,2>{0.0816219151f, 0.8964836f},
-std::array<float,2>{0.504109561f, 0.623234212f},
-std::array<float,2>{0.4735111f, 0.151350021f},
-std::array<float,2>{0.645548344f, 0.0664856136f},
-std::array<float,2>{0.351213753f, 0.665846884f},
-std::array<float,2>{0.919683397f, 0.750642359f},
-std::array<float,2>{0.219803751f, 0.380482137f},
-std::array<float,2>{0.621653795f, 0.447082877f},
-std::array<float,2>{0.393836558f, 0.871800542f},
-std::array<float,2>{0.865923345f, 0.70456326f},
-std::array<float,2>{0.00464234175f, 0.0268177241f},
-std::array<float,2>{0.952081382f, 0.244412124f},
-std::array<float,2>{0.161763445f, 0.547548354f},
-std::array<float,2>{0.724882245f, 0.994747162f},
-std::array<float,2>{0.261272162f, 0.309516668f},
-std::array<float,2>{0.879339159f, 0.421066731f},
-std::array<float,2>{0.217210457f, 0.781728685f},
-std::array<float,2>{0.667430341f, 0.625036657f},
-std::array<float,2>{0.33692193f, 0.119679756f},
-std::array<float,2>{0.556096256f, 0.167561471f},
-std::array<float,2>{0.468571514f, 0.572896481f},
-std::array<float,2>{0.793090641f, 0.90882796f},
-std::array<float,2>{0.122364402f, 0.351158261f},
-std::array<float,2>{0.687819302f, 0.253972322f},
-std::array<float,2>{0.304204434f, 0.939926088f},
-std::array<float,2>{0.968824446f, 0.515886366f},
-std::array<float,2>{0.134875566f, 0.19874692f},
-std::array<float,2>{0.82252121f, 0.0588542521f},
-std::array<float,2>{0.0536814108f, 0.736914277f},
-std::array<float,2>{0.563771784f, 0.817404509f},
-std::array<float,2>{0.412973225f, 0.489627302f},
-std::array<float,2>{0.913355887f, 0.357152551f},
-std::array<float,2>{0.233164459f, 0.916200519f},
-std::array<float,2>{0.655631125f, 0.567176104f},
-std::array<float,2>{0.355292141f, 0.160613835f},
-std::array<float,2>{0.509796262f, 0.112546295f},
-std::array<float,2>{0.476781279f, 0.633003891f},
-std::array<float,2>{0.76911819f, 0.791698337f},
-std::array<float,2>{0.0921439454f, 0.40945363f},
-std::array<float,2>{0.726813197f, 0.494057238f},
-std::array<float,2>{0.255611151f, 0.822416365f},
-std::array<float,2>{0.941317797f, 0.748020768f},
-std::array<float,2>{0.16420193f, 0.0526525192f},
-std::array<float,2>{0.873110116f, 0.193006292f},
-std::array<float,2>{0.011669307f, 0.530947924f},
-std::array<float,2>{0.611123621f, 0.949915826f},
-std::array<float,2>{0.400803953f, 0.258344561f},
-std::array<float,2>{0.78762871f, 0.386227846f},
-std::array<float,2>{0.111146621f, 0.764708519f},
-std::array<float,2>{0.547435284f, 0.661156118f},
-std::array<float,2>{0.45689556f, 0.0731840283f},
-std::array<float,2>{0.657801867f, 0.14504151f},
-std::array<float,2>{0.3339203f, 0.615610957f},
-std::array<float,2>{0.885535657f, 0.905652285f},
-std::array<float,2>{0.204747587f, 0.313298374f},
-std::array<float,2>{0.573427618f, 0.299635679f},
-std::array<float,2>{0.415772766f, 0.990558028f},
-std::array<float,2>{0.816137969f, 0.561721921f},
-std::array<float,2>{0.0549171306f, 0.236989394f},
-std::array<float,2>{0.978969097f, 0.0213745516f},
-std::array<float,2>{0.126323268f, 0.713502705f},
-std::array<float,2>{0.69579947f, 0.86009419f},
-std::array<float,2>{0.307265669f, 0.441289842f},
-std::array<float,2>{0.840389609f, 0.271234334f},
-std::array<float,2>{0.0393174253f, 0.959772229f},
-std::array<float,2>{0.579143941f, 0.501678526f},
-std::array<float,2>{0.429640979f, 0.208612338f},
-std::array<float,2>{0.716066658f, 0.0411355272f},
-std::array<float,2>{0.282330871f, 0.724300742f},
-std::array<float,2>{0.985204697f, 0.83877635f},
-std::array<float,2>{0.150295913f, 0.48337087f},
-std::array<float,2>{0.540024757f, 0.433787942f},
-std::array<float,2>{0.439753652f, 0.797675669f},
-std::array<float,2>{0.802267134f, 0.651443243f},
-std::array<float,2>{0.0983963832f, 0.104444906f},
-std::array<float,2>{0.904071212f, 0.181044191f},
-std::array<float,2>{0.202388316f, 0.589502513f},
-std::array<float,2>{0.680568218f, 0.930300713f},
-std::array<float,2>{0.316807747f, 0.367194355f},
-std::array<float,2>{0.964613199f, 0.462994933f},
-std::array<float,2>{0.186791971f, 0.859002709f},
-std::array<float,2>{0.74101913f, 0.698076844f},
-std::array<float,2>{0.271279603f, 0.00575167825f},
-std::array<float,2>{0.595991135f, 0.233387426f},
-std::array<float,2>{0.381372541f, 0.536980033f},
-std::array<float,2>{0.849331796f, 0.982133031f},
-std::array<float,2>{0.0236864723f, 0.287101984f},
-std::array<float,2>{0.639107168f, 0.33615616f},
-std::array<float,2>{0.364348114f, 0.881712615f},
-std::array<float,2>{0.937221944f, 0.607018471f},
-std::array<float,2>{0.235997945f, 0.134759948f},
-std::array<float,2>{0.757917702f, 0.0810218453f},
-std::array<float,2>{0.0658510178f, 0.679743171f},
-std::array<float,2>{0.518071473f, 0.781248569f},
-std::array<float,2>{0.490570337f, 0.39697957f},
-std::array<float,2>{0.943335593f, 0.334165275f},
-std::array<float,2>{0.169514596f, 0.888386607f},
-std::array<float,2>{0.73164469f, 0.59863776f},
-std::array<float,2>{0.253793091f, 0.130954742f},
-std::array<float,2>{0.615506232f, 0.087401852f},
-std::array<float,2>{0.403847665f, 0.677986562f},
-std::array<float,2>{0.86934638f, 0.766363978f},
-std::array<float,2>{0.0128857745f, 0.401354641f},
-std::array<float,2>{0.650333762f, 0.459830403f},
-std::array<float,2>{0.355470151f, 0.846977115f},
-std::array<float,2>{0.909450889f, 0.693907738f},
-std::array<float,2>{0.228057176f, 0.0134068895f},
-std::array<float,2>{0.770427406f, 0.223351389f},
-std::array<float,2>{0.0862332657f, 0.541864753f},
-std::array<float,2>{0.511942148f, 0.968778372f},
-std::array<float,2>{0.483867407f, 0.295612752f},
-std::array<float,2>{0.817126751f, 0.427959383f},
-std::array<float,2>{0.0593321957f, 0.804747999f},
-std::array<float,2>{0.577861845f, 0.645041764f},
-std::array<float,2>{0.418071687f, 0.0943602771f},
-std::array<float,2>{0.700252712f, 0.176808864f},
-std::array<float,2>{0.309060723f, 0.585107088f},
-std::array<float,2>{0.983924806f, 0.924019516f},
-std::array<float,2>{0.132692039f, 0.363894105f},
-std::array<float,2>{0.552736819f, 0.274581969f},
-std::array<float,2>{0.458019525f, 0.964425743f},
-std::array<float,2>{0.782109916f, 0.509257913f},
-std::array<float,2>{0.115364991f, 0.213579699f},
-std::array<float,2>{0.8880741f, 0.0389397666f},
-std::array<float,2>{0.210592851f, 0.731948912f},
-std::array<float,2>{0.663986981f, 0.831503034f},
-std::array<float,2>{0.330077112f, 0.470282882f},
-std::array<float,2>{0.799591482f, 0.306660682f},
-std::array<float,2>{0.0949108154f, 0.996750474f},
-std::array<float,2>{0.546562731f, 0.553397596f},
-std::array<float,2>{0.441747934f, 0.247215793f},
-std::array<float,2>{0.685046017f, 0.0306416284f},
-std::array<float,2>{0.313290298f, 0.709492147f},
-std::array<float,2>{0.900593817f, 0.869142175f},
-std::array<float,2>{0.197679639f, 0.451615065f},
-std::array<float,2>{0.582552195f, 0.37888211f},
-std::array<float,2>{0.422940046f, 0.756773651f},
-std::array<float,2>{0.838409781f, 0.668839872f},
-std::array<float,2>{0.045011647f, 0.064051196f},
-std::array<float,2>{0.991778851f, 0.153142363f},
-std::array<float,2>{0.154975325f, 0.618381977f},
-std::array<float,2>{0.712434888f, 0.893973708f},
-std::array<float,2>{0.288999617f, 0.322752923f},
-std::array<float,2>{0.93060106f, 0.486401439f},
-std::array<float,2>{0.239896089f, 0.812832355f},
-std::array<float,2>{0.63416785f, 0.739410639f},
-std::array<float,2>{0.362392694f, 0.0562714748f},
-std::array<float,2>{0.521056592f, 0.202909738f},
-std::array<float,2>{0.485798031f, 0.52071619f},
-std::array<float,2>{0.764319122f, 0.944478571f},
-std::array<float,2>{0.0702737644f, 0.251492649f},
-std::array<float,2>{0.737079501f, 0.345209211f},
-std::array<float,2>{0.26897347f, 0.910910428f},
-std::array<float,2>{0.968161881f, 0.57599771f},
-std::array<float,2>{0.183290675f, 0.169818267f},
-std::array<float,2>{0.844773829f, 0.121962912f},
-std::array<float,2>{0.0276411008f, 0.630920649f},
-std::array<float,2>{0.599397242f, 0.786754847f},
-std::array<float,2>{0.377968997f, 0.416173249f},
-std::array<float,2>{0.893483698f, 0.262270719f},
-std::array<float,2>{0.187739983f, 0.945609093f},
-std::array<float,2>{0.672518313f, 0.526540339f},
-std::array<float,2>{0.322166532f, 0.190983608f},
-std::array<float,2>{0.536177933f, 0.0479223728f},
-std::array<float,2>{0.446964771f, 0.744006157f},
-std::array<float,2>{0.805195153f, 0.827842832f},
-std::array<float,2>{0.102348059f, 0.498313606f},
-std::array<float,2>{0.707826555f, 0.411162674f},
-std::array<float,2>{0.293494642f, 0.79360503f},
-std::array<float,2>{0.998919845f, 0.637290001f},
-std::array<float,2>{0.146247417f, 0.115836605f},
-std::array<float,2>{0.83546859f, 0.156931251f},
-std::array<float,2>{0.0340435989f, 0.565439939f},
-std::array<float,2>{0.58597219f, 0.918951929f},
-std::array<float,2>{0.429981738f, 0.355073601f},
-std::array<float,2>{0.753174245f, 0.441416591f},
-std::array<float,2>{0.0770009458f, 0.864441335f},
-std::array<float,2>{0.528320312f, 0.718167841f},
-std::array<float,2>{0.498720706f, 0.0185158569f},
-std::array<float,2>{0.630322099f, 0.239947557f},
-std::array<float,2>{0.372056514f, 0.556998491f},
-std::array<float,2>{0.923095822f, 0.986472726f},
-std::array<float,2>{0.247036994f, 0.303672582f},
-std::array<float,2>{0.601687253f, 0.319701016f},
-std::array<float,2>{0.387032986f, 0.901977301f},
-std::array<float,2>{0.857201636f, 0.612354219f},
-std::array<float,2>{0.0214539226f, 0.141092122f},
-std::array<float,2>{0.959741473f, 0.078021802f},
-std::array<float,2>{0.176239625f, 0.657216966f},
-std::array<float,2>{0.748310387f, 0.761344969f},
-std::array<float,2>{0.279552251f, 0.390124589f},
-std::array<float,2>{0.861523628f, 0.374933481f},
-std::array<float,2>{0.000505340344f, 0.93723768f},
-std::array<float,2>{0.618016362f, 0.592301786f},
-std::array<float,2>{0.397018641f, 0.185687497f},
-std::array<float,2>{0.721592903f, 0.107691735f},
-std::array<float,2>{0.264624089f, 0.654013991f},
-std::array<float,2>{0.947737455f, 0.803627193f},
-std::array<float,2>{0.157519892f, 0.431780189f},
-std::array<float,2>{0.502007663f, 0.477136672f},
-std::array<float,2>{0.469035417f, 0.840706885f},
-std::array<float,2>{0.778598011f, 0.722145617f},
-std::array<float,2>{0.085568063f, 0.0463694111f},
-std::array<float,2>{0.917767227f, 0.203910679f},
-std::array<float,2>{0.222904459f, 0.506222963f},
-std::array<float,2>{0.643341482f, 0.955038965f},
-std::array<float,2>{0.344274133f, 0.265684485f},
-std::array<float,2>{0.973544538f, 0.391534448f},
-std::array<float,2>{0.137413844f, 0.774608672f},
-std::array<float,2>{0.692083299f, 0.687145233f},
-std::array<float,2>{0.297935486f, 0.083975926f},
-std::array<float,2>{0.56910032f, 0.138893887f},
-std::array<float,2>{0.406953365f, 0.602123082f},
-std::array<float,2>{0.827379942f, 0.876281619f},
-std::array<float,2>{0.0499908552f, 0.3434259f},
-std::array<float,2>{0.669555187f, 0.281774253f},
-std::array<float,2>{0.342100918f, 0.977398634f},
-std::array<float,2>{0.875517666f, 0.533818364f},
-std::array<float,2>{0.213483378f, 0.227113605f},
-std::array<float,2>{0.792752385f, 0.000877253071f},
-std::array<float,2>{0.117544144f, 0.702395797f},
-std::array<float,2>{0.559407294f, 0.854100764f},
-std::array<float,2>{0.463618577f, 0.468678504f},
-std::array<float,2>{0.953996956f, 0.278181106f},
-std::array<float,2>{0.174134985f, 0.965013683f},
-std::array<float,2>{0.743802249f, 0.514666259f},
-std::array<float,2>{0.277166724f, 0.216419458f},
-std::array<float,2>{0.608862162f, 0.0313538983f},
-std::array<float,2>{0.382844359f, 0.728117704f},
-std::array<float,2>{0.853440225f, 0.834640563f},
-std::array<float,2>{0.0170832016f, 0.476421654f},
-std::array<float,2>{0.627460837f, 0.425000429f},
-std::array<float,2>{0.368126899f, 0.810418546f},
-std::array<float,2>{0.927018702f, 0.643328667f},
-std::array<float,2>{0.242376313f, 0.09978728f},
-std::array<float,2>{0.756943643f, 0.173319355f},
-std::array<float,2>{0.0731645003f, 0.580203295f},
-std::array<float,2>{0.523837388f, 0.926638782f},
-std::array<float,2>{0.494739622f, 0.361147791f},
-std::array<float,2>{0.831126034f, 0.455432415f},
-std::array<float,2>{0.0355500691f, 0.849417448f},
-std::array<float,2>{0.591652989f, 0.690925777f},
-std::array<float,2>{0.436316103f, 0.0085299965f},
-std::array<float,2>{0.706480384f, 0.219248891f},
-std::array<float,2>{0.290731609f, 0.54368794f},
-std::array<float,2>{0.996018887f, 0.973942816f},
-std::array<float,2>{0.142886817f, 0.290669769f},
-std::array<float,2>{0.532081187f, 0.331922591f},
-std::array<float,2>{0.45213899f, 0.883440077f},
-std::array<float,2>{0.811737597f, 0.593882203f},
-std::array<float,2>{0.107759193f, 0.127239972f},
-std::array<float,2>{0.895735919f, 0.0917155594f},
-std::array<float,2>{0.194306269f, 0.675053298f},
-std::array<float,2>{0.6790874f, 0.772725046f},
-std::array<float,2>{0.325599551f, 0.40340957f},
-std::array<float,2>{0.795458972f, 0.348013759f},
-std::array<float,2>{0.124522641f, 0.906473815f},
-std::array<float,2>{0.556891799f, 0.571246564f},
-std::array<float,2>{0.46529752f, 0.165740579f},
-std::array<float,2>{0.665133059f, 0.118751526f},
-std::array<float,2>{0.339540511f, 0.628557086f},
-std::array<float,2>{0.882620573f, 0.783849835f},
-std::array<float,2>{0.215969041f, 0.418287516f},
-std::array<float,2>{0.565892398f, 0.49131617f},
-std::array<float,2>{0.410913646f, 0.819387197f},
-std::array<float,2>{0.821860313f, 0.734789729f},
-std::array<float,2>{0.0514038019f, 0.0620254911f},
-std::array<float,2>{0.972402394f, 0.195558429f},
-std::array<float,2>{0.133141115f, 0.519061744f},
-std::array<float,2>{0.690035582f, 0.939365089f},
-std::array<float,2>{0.30266124f, 0.256155699f},
-std::array<float,2>{0.921007693f, 0.382182747f},
-std::array<float,2>{0.221298292f, 0.753392279f},
-std::array<float,2>{0.647426903f, 0.666156173f},
-std::array<float,2>{0.348391175f, 0.0690105408f},
-std::array<float,2>{0.507122695f, 0.150354654f},
-std::array<float,2>{0.474675536f, 0.622913778f},
-std::array<float,2>{0.777177274f, 0.897018671f},
-std::array<float,2>{0.0798402205f, 0.326858938f},
-std::array<float,2>{0.724406362f, 0.311166555f},
-std::array<float,2>{0.258431196f, 0.99355334f},
-std::array<float,2>{0.949351192f, 0.549089074f},
-std::array<float,2>{0.162177041f, 0.24313505f},
-std::array<float,2>{0.865043879f, 0.0244656578f},
-std::array<float,2>{0.00675332267f, 0.706960022f},
-std::array<float,2>{0.623696625f, 0.873577356f},
-std::array<float,2>{0.392487407f, 0.447989345f},
-std::array<float,2>{0.883728087f, 0.315906405f},
-std::array<float,2>{0.20676735f, 0.903319359f},
-std::array<float,2>{0.658397138f, 0.614456773f},
-std::array<float,2>{0.335079223f, 0.148241013f},
-std::array<float,2>{0.549613535f, 0.0716988444f},
-std::array<float,2>{0.453309745f, 0.662182689f},
-std::array<float,2>{0.786314011f, 0.761773884f},
-std::array<float,2>{0.112395309f, 0.382873088f},
-std::array<float,2>{0.698558927f, 0.437924296f},
-std::array<float,2>{0.305516928f, 0.862951577f},
-std::array<float,2>{0.977889657f, 0.712761104f},
-std::array<float,2>{0.127624407f, 0.0221730359f},
-std::array<float,2>{0.812855422f, 0.235601112f},
-std::array<float,2>{0.0581583008f, 0.560307324f},
-std::array<float,2>{0.57037878f, 0.988544762f},
-std::array<float,2>{0.416576445f, 0.298191547f},
-std::array<float,2>{0.76738143f, 0.407371521f},
-std::array<float,2>{0.0912898257f, 0.78974849f},
-std::array<float,2>{0.50839746f, 0.636480808f},
-std::array<float,2>{0.478911638f, 0.111310944f},
-std::array<float,2>{0.653153777f, 0.163423464f},
-std::array<float,2>{0.353508919f, 0.570150316f},
-std::array<float,2>{0.911678672f, 0.91550988f},
-std::array<float,2>{0.231776789f, 0.358680189f},
-std::array<float,2>{0.612807631f, 0.260274351f},
-std::array<float,2>{0.400182486f, 0.951921761f},
-std::array<float,2>{0.872977912f, 0.527884364f},
-std::array<float,2>{0.00938274805f, 0.194579184f},
-std::array<float,2>{0.938090265f, 0.0540581308f},
-std::array<float,2>{0.166613057f, 0.74850589f},
-std::array<float,2>{0.729830921f, 0.820670724f},
-std::array<float,2>{0.257661372f, 0.495208561f},
-std::array<float,2>{0.850471556f, 0.28861624f},
-std::array<float,2>{0.0266597047f, 0.982490063f},
-std::array<float,2>{0.593759358f, 0.537322044f},
-std::array<float,2>{0.379530549f, 0.231292307f},
-std::array<float,2>{0.740183949f, 0.00605889363f},
-std::array<float,2>{0.272635907f, 0.69674325f},
-std::array<float,2>{0.962021768f, 0.855911314f},
-std::array<float,2>{0.183889076f, 0.461875886f},
-std::array<float,2>{0.517211437f, 0.395850122f},
-std::array<float,2>{0.489360809f, 0.779180825f},
-std::array<float,2>{0.760525644f, 0.683339894f},
-std::array<float,2>{0.0627309978f, 0.0789915845f},
-std::array<float,2>{0.933773816f, 0.136250913f},
-std::array<float,2>{0.236582324f, 0.608018696f},
-std::array<float,2>{0.637730539f, 0.880802214f},
-std::array<float,2>{0.366503149f, 0.338846534f},
-std::array<float,2>{0.986792684f, 0.481050462f},
-std::array<float,2>{0.151343897f, 0.83751291f},
-std::array<float,2>{0.717589438f, 0.725240529f},
-std::array<float,2>{0.284761935f, 0.0409321636f},
-std::array<float,2>{0.581048846f, 0.21045424f},
-std::array<float,2>{0.42667222f, 0.502559066f},
-std::array<float,2>{0.843241453f, 0.958595216f},
-std::array<float,2>{0.0420071147f, 0.271812439f},
-std::array<float,2>{0.683390379f, 0.370970637f},
-std::array<float,2>{0.319405288f, 0.932541072f},
-std::array<float,2>{0.905353904f, 0.58731854f},
-std::array<float,2>{0.199485809f, 0.182141721f},
-std::array<float,2>{0.804253638f, 0.102241576f},
-std::array<float,2>{0.100385927f, 0.649536073f},
-std::array<float,2>{0.541606724f, 0.799619615f},
-std::array<float,2>{0.438547075f, 0.435777336f},
-std::array<float,2>{0.981140494f, 0.365741909f},
-std::array<float,2>{0.129759237f, 0.9223544f},
-std::array<float,2>{0.702218473f, 0.582294047f},
-std::array<float,2>{0.311916471f, 0.17877616f},
-std::array<float,2>{0.575821519f, 0.0957573578f},
-std::array<float,2>{0.420788109f, 0.648394763f},
-std::array<float,2>{0.819905639f, 0.808148146f},
-std::array<float,2>{0.0617148466f, 0.426624298f},
-std::array<float,2>{0.661562443f, 0.470995873f},
-std::array<float,2>{0.33174026f, 0.829809546f},
-std::array<float,2>{0.88870126f, 0.733898163f},
-std::array<float,2>{0.208970442f, 0.0370490141f},
-std::array<float,2>{0.783689499f, 0.212441474f},
-std::array<float,2>{0.114040799f, 0.510943115f},
-std::array<float,2>{0.552507579f, 0.961579442f},
-std::array<float,2>{0.460211933f, 0.276050508f},
-std::array<float,2>{0.868194461f, 0.399930447f},
-std::array<float,2>{0.0153803769f, 0.769327462f},
-std::array<float,2>{0.61482805f, 0.677580535f},
-std::array<float,2>{0.405050069f, 0.0884643644f},
-std::array<float,2>{0.733509123f, 0.129532143f},
-std::array<float,2>{0.250014246f, 0.59977752f},
-std::array<float,2>{0.94525367f, 0.889810681f},
-std::array<float,2>{0.169993728f, 0.333643347f},
-std::array<float,2>{0.515411317f, 0.294570237f},
-std::array<float,2>{0.481177658f, 0.971870482f},
-std::array<float,2>{0.772398174f, 0.540286779f},
-std::array<float,2>{0.0880796611f, 0.226003796f},
-std::array<float,2>{0.90713501f, 0.0150340525f},
-std::array<float,2>{0.230043858f, 0.692434669f},
-std::array<float,2>{0.651674807f, 0.845485151f},
-std::array<float,2>{0.357805759f, 0.457402289f},
-std::array<float,2>{0.76337564f, 0.252626896f},
-std::array<float,2>{0.0664196312f, 0.942468286f},
-std::array<float,2>{0.522671223f, 0.52150315f},
-std::array<float,2>{0.487494409f, 0.201024383f},
-std::array<float,2>{0.636699677f, 0.0584109128f},
-std::array<float,2>{0.36021179f, 0.741883337f},
-std::array<float,2>{0.933438361f, 0.815390408f},
-std::array<float,2>{0.240587026f, 0.485826284f},
-std::array<float,2>{0.601211011f, 0.414803505f},
-std::array<float,2>{0.375343114f, 0.788781941f},
-std::array<float,2>{0.847416937f, 0.630314648f},
-std::array<float,2>{0.0295503158f, 0.124344669f},
-std::array<float,2>{0.966427743f, 0.171650603f},
-std::array<float,2>{0.180267572f, 0.577807069f},
-std::array<float,2>{0.736301541f, 0.913825572f},
-std::array<float,2>{0.267454207f, 0.34735921f},
-std::array<float,2>{0.900372982f, 0.449455708f},
-std::array<float,2>{0.195429653f, 0.868044257f},
-std::array<float,2>{0.687000513f, 0.707366109f},
-std::array<float,2>{0.315381765f, 0.0280538835f},
-std::array<float,2>{0.543310046f, 0.24945493f},
-std::array<float,2>{0.443882793f, 0.551466465f},
-std::array<float,2>{0.79826802f, 0.999886334f},
-std::array<float,2>{0.0969136059f, 0.306586206f},
-std::array<float,2>{0.713733256f, 0.321826577f},
-std::array<float,2>{0.286052614f, 0.891334116f},
-std::array<float,2>{0.989387751f, 0.620390058f},
-std::array<float,2>{0.152577609f, 0.155172274f},
-std::array<float,2>{0.836410463f, 0.0645094588f},
-std::array<float,2>{0.044653032f, 0.670155883f},
-std::array<float,2>{0.584801972f, 0.754688442f},
-std::array<float,2>{0.424210042f, 0.375626057f},
-std::array<float,2>{0.923923373f, 0.301252812f},
-std::array<float,2>{0.249645725f, 0.984669805f},
-std::array<float,2>{0.631022096f, 0.556088567f},
-std::array<float,2>{0.37431258f, 0.241438776f},
-std::array<float,2>{0.529366851f, 0.0160162766f},
-std::array<float,2>{0.49656269f, 0.715347111f},
-std::array<float,2>{0.751483321f, 0.866009772f},
-std::array<float,2>{0.0755041242f, 0.444632113f},
-std::array<float,2>{0.747237027f, 0.387335092f},
-std::array<float,2>{0.278530389f, 0.758445144f},
-std::array<float,2>{0.957873166f, 0.658316612f},
-std::array<float,2>{0.179473683f, 0.076010257f},
-std::array<float,2>{0.858617008f, 0.143463388f},
-std::array<float,2>{0.0228915568f, 0.609416604f},
-std::array<float,2>{0.604563057f, 0.89974761f},
-std::array<float,2>{0.390271127f, 0.317332745f},
-std::array<float,2>{0.80678165f, 0.496192485f},
-std::array<float,2>{0.103528902f, 0.825753689f},
-std::array<float,2>{0.53883332f, 0.745491505f},
-std::array<float,2>{0.448538214f, 0.0497823693f},
-std::array<float,2>{0.674988925f, 0.187615186f},
-std::array<float,2>{0.324188232f, 0.523904085f},
-std::array<float,2>{0.892418385f, 0.948235393f},
-std::array<float,2>{0.190089911f, 0.26459375f},
-std::array<float,2>{0.58862555f, 0.352967769f},
-std::array<float,2>{0.432772368f, 0.921435952f},
-std::array<float,2>{0.833550334f, 0.564402878f},
-std::array<float,2>{0.0316121057f, 0.159803122f},
-std::array<float,2>{0.997542143f, 0.114384606f},
-std::array<float,2>{0.147115827f, 0.638725758f},
-std::array<float,2>{0.709832788f, 0.796086907f},
-std::array<float,2>{0.296331137f, 0.41366449f},
-std::array<float,2>{0.82574749f, 0.340744823f},
-std::array<float,2>{0.047904402f, 0.877012134f},
-std::array<float,2>{0.566825092f, 0.603766739f},
-std::array<float,2>{0.409710139f, 0.137261987f},
-std::array<float,2>{0.694932818f, 0.0859369189f},
-std::array<float,2>{0.299666047f, 0.684366047f},
-std::array<float,2>{0.975402653f, 0.775424957f},
-std::array<float,2>{0.139093056f, 0.392859012f},
-std::array<float,2>{0.560949743f, 0.466454148f},
-std::array<float,2>{0.462301672f, 0.852690399f},
-std::array<float,2>{0.790547132f, 0.70051229f},
-std::array<float,2>{0.12088751f, 0.00368726696f},
-std::array<float,2>{0.878163397f, 0.230461493f},
-std::array<float,2>{0.211650431f, 0.531743348f},
-std::array<float,2>{0.671628773f, 0.979437709f},
-std::array<float,2>{0.341731846f, 0.284205645f},
-std::array<float,2>{0.947206378f, 0.431408197f},
-std::array<float,2>{0.160077959f, 0.80218178f},
-std::array<float,2>{0.718922496f, 0.655638874f},
-std::array<float,2>{0.263141274f, 0.10714902f},
-std::array<float,2>{0.620052099f, 0.184666857f},
-std::array<float,2>{0.395525485f, 0.589896083f},
-std::array<float,2>{0.860384583f, 0.935238957f},
-std::array<float,2>{0.00331830699f, 0.372540414f},
-std::array<float,2>{0.641281128f, 0.268589795f},
-std::array<float,2>{0.346713036f, 0.955217421f},
-std::array<float,2>{0.915482521f, 0.504175663f},
-std::array<float,2>{0.224966839f, 0.205453694f},
-std::array<float,2>{0.780562639f, 0.0436676405f},
-std::array<float,2>{0.0830976218f, 0.719859779f},
-std::array<float,2>{0.501529157f, 0.842777967f},
-std::array<float,2>{0.471025854f, 0.479781777f},
-std::array<float,2>{0.984504879f, 0.272029221f},
-std::array<float,2>{0.149598092f, 0.958471239f},
-std::array<float,2>{0.716666222f, 0.502162039f},
-std::array<float,2>{0.282863945f, 0.210010305f},
-std::array<float,2>{0.579633892f, 0.0400727391f},
-std::array<float,2>{0.428993553f, 0.724947095f},
-std::array<float,2>{0.839859664f, 0.836995125f},
-std::array<float,2>{0.0399489552f, 0.480497867f},
-std::array<float,2>{0.679886758f, 0.436363816f},
-std::array<float,2>{0.316953987f, 0.799269319f},
-std::array<float,2>{0.903789699f, 0.650233626f},
-std::array<float,2>{0.20269683f, 0.102004915f},
-std::array<float,2>{0.801977932f, 0.182051077f},
-std::array<float,2>{0.0981133655f, 0.587494135f},
-std::array<float,2>{0.53929776f, 0.932053208f},
-std::array<float,2>{0.44024691f, 0.370213032f},
-std::array<float,2>{0.84865886f, 0.461211264f},
-std::array<float,2>{0.0241161492f, 0.856326282f},
-std::array<float,2>{0.596284926f, 0.696876407f},
-std::array<float,2>{0.380946457f, 0.00654264074f},
-std::array<float,2>{0.740496278f, 0.230475843f},
-std::array<float,2>{0.270565063f, 0.537866414f},
-std::array<float,2>{0.964150012f, 0.983104646f},
-std::array<float,2>{0.187147751f, 0.28832525f},
-std::array<float,2>{0.517987132f, 0.33829084f},
-std::array<float,2>{0.491082072f, 0.879934132f},
-std::array<float,2>{0.758498788f, 0.607665956f},
-std::array<float,2>{0.0660398602f, 0.135779127f},
-std::array<float,2>{0.936949432f, 0.0782200843f},
-std::array<float,2>{0.23582013f, 0.68295306f},
-std::array<float,2>{0.639178574f, 0.778504133f},
-std::array<float,2>{0.365095854f, 0.395996958f},
-std::array<float,2>{0.76866281f, 0.359158844f},
-std::array<float,2>{0.0926727206f, 0.915927768f},
-std::array<float,2>{0.510379314f, 0.569436133f},
-std::array<float,2>{0.477346152f, 0.163850635f},
-std::array<float,2>{0.655864716f, 0.110577948f},
-std::array<float,2>{0.35495472f, 0.635898411f},
-std::array<float,2>{0.913587451f, 0.789280593f},
-std::array<float,2>{0.232831433f, 0.408129513f},
-std::array<float,2>{0.610641062f, 0.495631158f},
-std::array<float,2>{0.401164114f, 0.820909917f},
-std::array<float,2>{0.874017119f, 0.748806059f},
-std::array<float,2>{0.0110638058f, 0.0543154329f},
-std::array<float,2>{0.940704882f, 0.194878042f},
-std::array<float,2>{0.164598554f, 0.527344644f},
-std::array<float,2>{0.727215171f, 0.951349318f},
-std::array<float,2>{0.254899532f, 0.260146499f},
-std::array<float,2>{0.884992063f, 0.38370043f},
-std::array<float,2>{0.204279855f, 0.762422383f},
-std::array<float,2>{0.657480478f, 0.662754178f},
-std::array<float,2>{0.3330836f, 0.0720266327f},
-std::array<float,2>{0.546925604f, 0.147524014f},
-std::array<float,2>{0.456096828f, 0.614974141f},
-std::array<float,2>{0.787221074f, 0.902420759f},
-std::array<float,2>{0.11040806f, 0.316170752f},
-std::array<float,2>{0.696190655f, 0.298400193f},
-std::array<float,2>{0.306644857f, 0.988871872f},
-std::array<float,2>{0.979185164f, 0.559834659f},
-std::array<float,2>{0.126606673f, 0.236010998f},
-std::array<float,2>{0.81560725f, 0.0215302166f},
-std::array<float,2>{0.0554252602f, 0.712000847f},
-std::array<float,2>{0.573882699f, 0.862555146f},
-std::array<float,2>{0.415342093f, 0.438215762f},
-std::array<float,2>{0.919424713f, 0.326554775f},
-std::array<float,2>{0.22034502f, 0.896629632f},
-std::array<float,2>{0.646148443f, 0.622220576f},
-std::array<float,2>{0.350592881f, 0.149581596f},
-std::array<float,2>{0.504752338f, 0.0685717091f},
-std::array<float,2>{0.472681254f, 0.666646063f},
-std::array<float,2>{0.774420202f, 0.7538836f},
-std::array<float,2>{0.0814228803f, 0.382590562f},
-std::array<float,2>{0.725240588f, 0.447728127f},
-std::array<float,2>{0.260785758f, 0.873287797f},
-std::array<float,2>{0.95144695f, 0.706280887f},
-std::array<float,2>{0.161376551f, 0.0253149662f},
-std::array<float,2>{0.865317166f, 0.242350951f},
-std::array<float,2>{0.00416502124f, 0.54966563f},
-std::array<float,2>{0.621332049f, 0.993667483f},
-std::array<float,2>{0.394432485f, 0.310688585f},
-std::array<float,2>{0.793801308f, 0.418812573f},
-std::array<float,2>{0.122775927f, 0.783635736f},
-std::array<float,2>{0.556212306f, 0.628326476f},
-std::array<float,2>{0.468106329f, 0.118336536f},
-std::array<float,2>{0.667576134f, 0.165224165f},
-std::array<float,2>{0.337423772f, 0.570415795f},
-std::array<float,2>{0.879796207f, 0.906743526f},
-std::array<float,2>{0.217354968f, 0.348549932f},
-std::array<float,2>{0.564041436f, 0.256623924f},
-std::array<float,2>{0.41232568f, 0.938616276f},
-std::array<float,2>{0.823063135f, 0.518808603f},
-std::array<float,2>{0.0530693009f, 0.195842832f},
-std::array<float,2>{0.96955806f, 0.0618915185f},
-std::array<float,2>{0.135595948f, 0.735063076f},
-std::array<float,2>{0.688119233f, 0.819831669f},
-std::array<float,2>{0.30404681f, 0.491959631f},
-std::array<float,2>{0.830070615f, 0.290452451f},
-std::array<float,2>{0.0376241729f, 0.974585831f},
-std::array<float,2>{0.591909885f, 0.543430448f},
-std::array<float,2>{0.434115708f, 0.219104767f},
-std::array<float,2>{0.704272211f, 0.00800594501f},
-std::array<float,2>{0.291607529f, 0.690453947f},
-std::array<float,2>{0.992590666f, 0.848699093f},
-std::array<float,2>{0.141917244f, 0.455648094f},
-std::array<float,2>{0.534047782f, 0.404055059f},
-std::array<float,2>{0.450114816f, 0.773391485f},
-std::array<float,2>{0.809413135f, 0.675460517f},
-std::array<float,2>{0.1056813f, 0.0911555216f},
-std::array<float,2>{0.89709878f, 0.127516687f},
-std::array<float,2>{0.192580104f, 0.594445527f},
-std::array<float,2>{0.677496493f, 0.883251965f},
-std::array<float,2>{0.326720357f, 0.331196308f},
-std::array<float,2>{0.955101311f, 0.47582531f},
-std::array<float,2>{0.172794953f, 0.834028423f},
-std::array<float,2>{0.745207369f, 0.727632761f},
-std::array<float,2>{0.274379551f, 0.0321652852f},
-std::array<float,2>{0.605881512f, 0.216165289f},
-std::array<float,2>{0.386057585f, 0.515470684f},
-std::array<float,2>{0.855284989f, 0.965524137f},
-std::array<float,2>{0.0193001945f, 0.277565241f},
-std::array<float,2>{0.626320481f, 0.360540271f},
-std::array<float,2>{0.370661914f, 0.926111102f},
-std::array<float,2>{0.929511666f, 0.580838144f},
-std::array<float,2>{0.24609217f, 0.17343846f},
-std::array<float,2>{0.754473209f, 0.10017395f},
-std::array<float,2>{0.0713369623f, 0.642709076f},
-std::array<float,2>{0.526017725f, 0.80978775f},
-std::array<float,2>{0.493535846f, 0.425741613f},
-std::array<float,2>{0.947758377f, 0.372629732f},
-std::array<float,2>{0.158046067f, 0.935040474f},
-std::array<float,2>{0.721105814f, 0.590362906f},
-std::array<float,2>{0.264033824f, 0.185546353f},
-std::array<float,2>{0.617313027f, 0.106583588f},
-std::array<float,2>{0.396657079f, 0.656090796f},
-std::array<float,2>{0.862159014f, 0.802528143f},
-std::array<float,2>{0.000344801054f, 0.431009114f},
-std::array<float,2>{0.642877221f, 0.480448753f},
-std::array<float,2>{0.344100296f, 0.843279362f},
-std::array<float,2>{0.917346001f, 0.720543504f},
-std::array<float,2>{0.223597407f, 0.0430230796f},
-std::array<float,2>{0.779258132f, 0.205856994f},
-std::array<float,2>{0.0853289962f, 0.504656553f},
-std::array<float,2>{0.502851963f, 0.955959678f},
-std::array<float,2>{0.469555408f, 0.269285262f},
-std::array<float,2>{0.827833652f, 0.393261373f},
-std::array<float,2>{0.0504755564f, 0.775917292f},
-std::array<float,2>{0.568843424f, 0.683894455f},
-std::array<float,2>{0.406632662f, 0.0852501392f},
-std::array<float,2>{0.691768229f, 0.137116551f},
-std::array<float,2>{0.298744172f, 0.604152143f},
-std::array<float,2>{0.972683609f, 0.877850473f},
-std::array<float,2>{0.1371461f, 0.340065956f},
-std::array<float,2>{0.558887005f, 0.284968704f},
-std::array<float,2>{0.463001966f, 0.978708684f},
-std::array<float,2>{0.792282641f, 0.531358063f},
-std::array<float,2>{0.118143685f, 0.229869381f},
-std::array<float,2>{0.875399649f, 0.00334497984f},
-std::array<float,2>{0.213227838f, 0.70096761f},
-std::array<float,2>{0.669373333f, 0.85322541f},
-std::array<float,2>{0.342332274f, 0.465985447f},
-std::array<float,2>{0.804943919f, 0.263937086f},
-std::array<float,2>{0.101669498f, 0.947679579f},
-std::array<float,2>{0.536631584f, 0.52428025f},
-std::array<float,2>{0.446414769f, 0.18809028f},
-std::array<float,2>{0.672316492f, 0.0490873568f},
-std::array<float,2>{0.321597874f, 0.745641053f},
-std::array<float,2>{0.89290601f, 0.825371325f},
-std::array<float,2>{0.188358545f, 0.496772945f},
-std::array<float,2>{0.58653605f, 0.413354933f},
-std::array<float,2>{0.430359781f, 0.796421051f},
-std::array<float,2>{0.8353163f, 0.639320135f},
-std::array<float,2>{0.0332036875f, 0.115059547f},
-std::array<float,2>{0.998142719f, 0.159387738f},
-std::array<float,2>{0.145526901f, 0.563787162f},
-std::array<float,2>{0.707149982f, 0.921012878f},
-std::array<float,2>{0.293310076f, 0.353249907f},
-std::array<float,2>{0.923560977f, 0.445100904f},
-std::array<float,2>{0.246290356f, 0.865537405f},
-std::array<float,2>{0.630483031f, 0.715137541f},
-std::array<float,2>{0.371409446f, 0.0162997842f},
-std::array<float,2>{0.527621448f, 0.242079854f},
-std::array<float,2>{0.498518825f, 0.556629419f},
-std::array<float,2>{0.753540754f, 0.985193133f},
-std::array<float,2>{0.0762793869f, 0.301450878f},
-std::array<float,2>{0.748838127f, 0.316696942f},
-std::array<float,2>{0.280144632f, 0.900212169f},
-std::array<float,2>{0.959441364f, 0.609869897f},
-std::array<float,2>{0.176472709f, 0.142753914f},
-std::array<float,2>{0.856680512f, 0.0753774494f},
-std::array<float,2>{0.0206909105f, 0.659158468f},
-std::array<float,2>{0.602466881f, 0.758042157f},
-std::array<float,2>{0.387693882f, 0.386746258f},
-std::array<float,2>{0.901153624f, 0.305855721f},
-std::array<float,2>{0.197969586f, 0.999386907f},
-std::array<float,2>{0.685326755f, 0.551066995f},
-std::array<float,2>{0.312927634f, 0.249541402f},
-std::array<float,2>{0.546142757f, 0.0273639318f},
-std::array<float,2>{0.442057014f, 0.707904458f},
-std::array<float,2>{0.799031973f, 0.867485225f},
-std::array<float,2>{0.0953036472f, 0.450068504f},
-std::array<float,2>{0.712029994f, 0.375169069f},
-std::array<float,2>{0.288253874f, 0.7540223f},
-std::array<float,2>{0.991505563f, 0.670415759f},
-std::array<float,2>{0.154523894f, 0.0653381497f},
-std::array<float,2>{0.838128388f, 0.154454261f},
-std::array<float,2>{0.0458028987f, 0.620991886f},
-std::array<float,2>{0.582449257f, 0.891110361f},
-std::array<float,2>{0.423726737f, 0.321461141f},
-std::array<float,2>{0.76411587f, 0.48607865f},
-std::array<float,2>{0.0694788694f, 0.81471926f},
-std::array<float,2>{0.520628035f, 0.741615891f},
-std::array<float,2>{0.486122757f, 0.0576670133f},
-std::array<float,2>{0.634674072f, 0.200566962f},
-std::array<float,2>{0.362962425f, 0.522099674f},
-std::array<float,2>{0.929918468f, 0.943262756f},
-std::array<float,2>{0.239744306f, 0.252014577f},
-std::array<float,2>{0.598924875f, 0.346806705f},
-std::array<float,2>{0.378873348f, 0.913408637f},
-std::array<float,2>{0.84557724f, 0.577456653f},
-std::array<float,2>{0.0282474831f, 0.171034142f},
-std::array<float,2>{0.968384027f, 0.12455713f},
-std::array<float,2>{0.182809442f, 0.630445898f},
-std::array<float,2>{0.736812294f, 0.788119733f},
-std::array<float,2>{0.269249082f, 0.414193213f},
-std::array<float,2>{0.869677007f, 0.333395869f},
-std::array<float,2>{0.0135635585f, 0.890419364f},
-std::array<float,2>{0.616170228f, 0.600143552f},
-std::array<float,2>{0.40376386f, 0.129293218f},
-std::array<float,2>{0.732039034f, 0.0883034691f},
-std::array<float,2>{0.253152937f, 0.677011728f},
-std::array<float,2>{0.942776561f, 0.769012213f},
-std::array<float,2>{0.169049665f, 0.399744421f},
-std::array<float,2>{0.5124107f, 0.45772174f},
-std::array<float,2>{0.484110057f, 0.844877481f},
-std::array<float,2>{0.769805253f, 0.693047702f},
-std::array<float,2>{0.0869083926f, 0.0155261289f},
-std::array<float,2>{0.910126746f, 0.22615768f},
-std::array<float,2>{0.227767929f, 0.540880084f},
-std::array<float,2>{0.649830759f, 0.972631335f},
-std::array<float,2>{0.356333345f, 0.294291645f},
-std::array<float,2>{0.983541548f, 0.425911307f},
-std::array<float,2>{0.131926522f, 0.808066368f},
-std::array<float,2>{0.701003075f, 0.647882581f},
-std::array<float,2>{0.309492379f, 0.0964049846f},
-std::array<float,2>{0.577566862f, 0.17929408f},
-std::array<float,2>{0.418561012f, 0.582828939f},
-std::array<float,2>{0.816774487f, 0.922651649f},
-std::array<float,2>{0.0587807372f, 0.365272194f},
-std::array<float,2>{0.663425207f, 0.275658488f},
-std::array<float,2>{0.329103261f, 0.961116195f},
-std::array<float,2>{0.888517618f, 0.511449397f},
-std::array<float,2>{0.210284546f, 0.212221637f},
-std::array<float,2>{0.781565785f, 0.0364503004f},
-std::array<float,2>{0.115792476f, 0.733605862f},
-std::array<float,2>{0.553553343f, 0.829363286f},
-std::array<float,2>{0.458735257f, 0.471646011f},
-std::array<float,2>{0.962713361f, 0.286140889f},
-std::array<float,2>{0.184145674f, 0.981682777f},
-std::array<float,2>{0.739737511f, 0.536282659f},
-std::array<float,2>{0.272977382f, 0.232732683f},
-std::array<float,2>{0.594583213f, 0.00510504795f},
-std::array<float,2>{0.378927082f, 0.697518885f},
-std::array<float,2>{0.849791706f, 0.858616531f},
-std::array<float,2>{0.0268714596f, 0.463720739f},
-std::array<float,2>{0.638524055f, 0.396599293f},
-std::array<float,2>{0.367020756f, 0.780671418f},
-std::array<float,2>{0.934452116f, 0.680492759f},
-std::array<float,2>{0.236871615f, 0.0800869763f},
-std::array<float,2>{0.759932101f, 0.133868366f},
-std::array<float,2>{0.0631451085f, 0.606803656f},
-std::array<float,2>{0.516649961f, 0.881279945f},
-std::array<float,2>{0.490212739f, 0.33682549f},
-std::array<float,2>{0.843435943f, 0.482759953f},
-std::array<float,2>{0.0426267199f, 0.838355362f},
-std::array<float,2>{0.580527008f, 0.723848224f},
-std::array<float,2>{0.426039398f, 0.0417871661f},
-std::array<float,2>{0.717175007f, 0.208427757f},
-std::array<float,2>{0.284597874f, 0.501412928f},
-std::array<float,2>{0.987103581f, 0.959192872f},
-std::array<float,2>{0.150663406f, 0.270541012f},
-std::array<float,2>{0.541098595f, 0.368084699f},
-std::array<float,2>{0.439069033f, 0.929763198f},
-std::array<float,2>{0.803720474f, 0.58886838f},
-std::array<float,2>{0.0999729335f, 0.181617469f},
-std::array<float,2>{0.905926228f, 0.103949107f},
-std::array<float,2>{0.199845597f, 0.65225482f},
-std::array<float,2>{0.682739913f, 0.797168076f},
-std::array<float,2>{0.320296347f, 0.434290737f},
-std::array<float,2>{0.787069678f, 0.312820464f},
-std::array<float,2>{0.113004141f, 0.906067491f},
-std::array<float,2>{0.549129605f, 0.616100967f},
-std::array<float,2>{0.453710347f, 0.144695044f},
-std::array<float,2>{0.658786714f, 0.0724627599f},
-std::array<float,2>{0.335900009f, 0.66180557f},
-std::array<float,2>{0.88288486f, 0.765344024f},
-std::array<float,2>{0.20648177f, 0.386665285f},
-std::array<float,2>{0.571136057f, 0.440916717f},
-std::array<float,2>{0.416315585f, 0.859442174f},
-std::array<float,2>{0.813285708f, 0.713008463f},
-std::array<float,2>{0.0579260215f, 0.0207320191f},
-std::array<float,2>{0.978365481f, 0.236447528f},
-std::array<float,2>{0.127375588f, 0.562237978f},
-std::array<float,2>{0.699004173f, 0.990861654f},
-std::array<float,2>{0.30495289f, 0.299008489f},
-std::array<float,2>{0.911468506f, 0.409974307f},
-std::array<float,2>{0.232010692f, 0.791458368f},
-std::array<float,2>{0.652372479f, 0.633705616f},
-std::array<float,2>{0.352841765f, 0.113098532f},
-std::array<float,2>{0.508165061f, 0.160817027f},
-std::array<float,2>{0.479077756f, 0.566551208f},
-std::array<float,2>{0.766681373f, 0.916876495f},
-std::array<float,2>{0.0914800093f, 0.356590569f},
-std::array<float,2>{0.730287433f, 0.258147389f},
-std::array<float,2>{0.257071555f, 0.949336767f},
-std::array<float,2>{0.937887013f, 0.530280173f},
-std::array<float,2>{0.166124552f, 0.192718908f},
-std::array<float,2>{0.872261107f, 0.0520057194f},
-std::array<float,2>{0.00888147205f, 0.74737668f},
-std::array<float,2>{0.612617195f, 0.822810829f},
-std::array<float,2>{0.399731904f, 0.493509084f},
-std::array<float,2>{0.881894171f, 0.350733995f},
-std::array<float,2>{0.21671252f, 0.908310175f},
-std::array<float,2>{0.66591531f, 0.572351456f},
-std::array<float,2>{0.339240283f, 0.16703403f},
-std::array<float,2>{0.557399988f, 0.11943467f},
-std::array<float,2>{0.46560058f, 0.625582397f},
-std::array<float,2>{0.795094907f, 0.782182932f},
-std::array<float,2>{0.124095909f, 0.421659738f},
-std::array<float,2>{0.689500093f, 0.489996791f},
-std::array<float,2>{0.301975012f, 0.817946434f},
-std::array<float,2>{0.971735597f, 0.736811757f},
-std::array<float,2>{0.133495718f, 0.0593940653f},
-std::array<float,2>{0.821345448f, 0.198687345f},
-std::array<float,2>{0.0512247011f, 0.516510904f},
-std::array<float,2>{0.566351414f, 0.940280676f},
-std::array<float,2>{0.41055131f, 0.254582733f},
-std::array<float,2>{0.776741326f, 0.380198121f},
-std::array<float,2>{0.0791910961f, 0.750181615f},
-std::array<float,2>{0.507532716f, 0.665414214f},
-std::array<float,2>{0.475574434f, 0.0671817586f},
-std::array<float,2>{0.646652758f, 0.150654361f},
-std::array<float,2>{0.348095864f, 0.623893499f},
-std::array<float,2>{0.921584606f, 0.89573276f},
-std::array<float,2>{0.220931232f, 0.324231982f},
-std::array<float,2>{0.623111725f, 0.308913499f},
-std::array<float,2>{0.391769707f, 0.994480431f},
-std::array<float,2>{0.864743531f, 0.547303677f},
-std::array<float,2>{0.00598624209f, 0.24489373f},
-std::array<float,2>{0.949802935f, 0.0269471966f},
-std::array<float,2>{0.162984014f, 0.704685807f},
-std::array<float,2>{0.724043846f, 0.871509492f},
-std::array<float,2>{0.258254766f, 0.446368098f},
-std::array<float,2>{0.85261333f, 0.280877352f},
-std::array<float,2>{0.0174784958f, 0.966802835f},
-std::array<float,2>{0.609310985f, 0.512198329f},
-std::array<float,2>{0.383663952f, 0.21813193f},
-std::array<float,2>{0.743359864f, 0.0341546722f},
-std::array<float,2>{0.276412934f, 0.730424881f},
-std::array<float,2>{0.953267038f, 0.833540082f},
-std::array<float,2>{0.174714014f, 0.472711295f},
-std::array<float,2>{0.524159729f, 0.423780113f},
-std::array<float,2>{0.494372845f, 0.810801625f},
-std::array<float,2>{0.757400215f, 0.641304135f},
-std::array<float,2>{0.0725753978f, 0.0976768956f},
-std::array<float,2>{0.927303016f, 0.17542088f},
-std::array<float,2>{0.243053332f, 0.579240382f},
-std::array<float,2>{0.627341986f, 0.927970886f},
-std::array<float,2>{0.367519468f, 0.36305058f},
-std::array<float,2>{0.99529624f, 0.454151183f},
-std::array<float,2>{0.143119901f, 0.850700796f},
-std::array<float,2>{0.70685339f, 0.688243449f},
-std::array<float,2>{0.290515333f, 0.011414269f},
-std::array<float,2>{0.591099381f, 0.221474871f},
-std::array<float,2>{0.435895652f, 0.545794845f},
-std::array<float,2>{0.831785738f, 0.976301372f},
-std::array<float,2>{0.0358096138f, 0.292937756f},
-std::array<float,2>{0.679636121f, 0.32876125f},
-std::array<float,2>{0.326094091f, 0.885927796f},
-std::array<float,2>{0.896254718f, 0.596028924f},
-std::array<float,2>{0.193603888f, 0.125589803f},
-std::array<float,2>{0.812035859f, 0.0918788761f},
-std::array<float,2>{0.107947893f, 0.673546851f},
-std::array<float,2>{0.531544507f, 0.770962417f},
-std::array<float,2>{0.451376528f, 0.404783964f},
-std::array<float,2>{0.975005567f, 0.342786074f},
-std::array<float,2>{0.13938351f, 0.876900077f},
-std::array<float,2>{0.694564939f, 0.601693869f},
-std::array<float,2>{0.298894942f, 0.13942498f},
-std::array<float,2>{0.567362964f, 0.0831188411f},
-std::array<float,2>{0.409591526f, 0.686841607f},
-std::array<float,2>{0.825637341f, 0.775320053f},
-std::array<float,2>{0.0488060303f, 0.390641898f},
-std::array<float,2>{0.671326756f, 0.468003422f},
-std::array<float,2>{0.341151714f, 0.853630722f},
-std::array<float,2>{0.87871784f, 0.702949882f},
-std::array<float,2>{0.211295277f, 4.40227122e-05f},
-std::array<float,2>{0.790139616f, 0.226721808f},
-std::array<float,2>{0.120314322f, 0.53332895f},
-std::array<float,2>{0.56122607f, 0.976634681f},
-std::array<float,2>{0.462573767f, 0.281642169f},
-std::array<float,2>{0.861046672f, 0.432265133f},
-std::array<float,2>{0.0036202122f, 0.802786827f},
-std::array<float,2>{0.619503379f, 0.653416455f},
-std::array<float,2>{0.396013021f, 0.10797859f},
-std::array<float,2>{0.719399512f, 0.18649134f},
-std::array<float,2>{0.263481468f, 0.592265069f},
-std::array<float,2>{0.946333051f, 0.936650276f},
-std::array<float,2>{0.159607291f, 0.374038219f},
-std::array<float,2>{0.501052976f, 0.266268253f},
-std::array<float,2>{0.471220046f, 0.95410192f},
-std::array<float,2>{0.781099379f, 0.506583452f},
-std::array<float,2>{0.0838686153f, 0.203285307f},
-std::array<float,2>{0.915696084f, 0.0465692319f},
-std::array<float,2>{0.225147784f, 0.722436965f},
-std::array<float,2>{0.641073823f, 0.840083599f},
-std::array<float,2>{0.347463012f, 0.476950288f},
-std::array<float,2>{0.751071513f, 0.303048998f},
-std::array<float,2>{0.0757522434f, 0.987303376f},
-std::array<float,2>{0.529972076f, 0.557497919f},
-std::array<float,2>{0.496723086f, 0.239438087f},
-std::array<float,2>{0.631416023f, 0.0179030169f},
-std::array<float,2>{0.374517709f, 0.718475997f},
-std::array<float,2>{0.924430549f, 0.865029514f},
-std::array<float,2>{0.249476761f, 0.442044377f},
-std::array<float,2>{0.605380058f, 0.39032802f},
-std::array<float,2>{0.390067875f, 0.760877848f},
-std::array<float,2>{0.859169126f, 0.656397939f},
-std::array<float,2>{0.0233880598f, 0.0773647875f},
-std::array<float,2>{0.957405806f, 0.141320959f},
-std::array<float,2>{0.178981349f, 0.613182366f},
-std::array<float,2>{0.747830272f, 0.901401699f},
-std::array<float,2>{0.27887696f, 0.32013309f},
-std::array<float,2>{0.891841233f, 0.499004841f},
-std::array<float,2>{0.189716026f, 0.827624023f},
-std::array<float,2>{0.675514638f, 0.743602335f},
-std::array<float,2>{0.323282272f, 0.0484949201f},
-std::array<float,2>{0.538111687f, 0.190575987f},
-std::array<float,2>{0.448962986f, 0.527168036f},
-std::array<float,2>{0.80744338f, 0.94616133f},
-std::array<float,2>{0.104020178f, 0.261953562f},
-std::array<float,2>{0.709383249f, 0.354628414f},
-std::array<float,2>{0.296566606f, 0.919449031f},
-std::array<float,2>{0.997617245f, 0.56603229f},
-std::array<float,2>{0.146514148f, 0.156666115f},
-std::array<float,2>{0.833420217f, 0.11532861f},
-std::array<float,2>{0.0322254039f, 0.636840403f},
-std::array<float,2>{0.588217199f, 0.793333769f},
-std::array<float,2>{0.433349669f, 0.41185236f},
-std::array<float,2>{0.932814479f, 0.251008719f},
-std::array<float,2>{0.241050124f, 0.944909811f},
-std::array<float,2>{0.635852098f, 0.521346569f},
-std::array<float,2>{0.359810889f, 0.202410132f},
-std::array<float,2>{0.523366928f, 0.0558373258f},
-std::array<float,2>{0.488042593f, 0.739771247f},
-std::array<float,2>{0.762760043f, 0.813023567f},
-std::array<float,2>{0.0671416521f, 0.486915767f},
-std::array<float,2>{0.735431969f, 0.416680127f},
-std::array<float,2>{0.266958594f, 0.786409438f},
-std::array<float,2>{0.966298938f, 0.631686628f},
-std::array<float,2>{0.179809675f, 0.12111529f},
-std::array<float,2>{0.847049952f, 0.169115305f},
-std::array<float,2>{0.0300846212f, 0.575283527f},
-std::array<float,2>{0.601026535f, 0.910407662f},
-std::array<float,2>{0.3755849f, 0.345698655f},
-std::array<float,2>{0.798828006f, 0.452082157f},
-std::array<float,2>{0.0975088105f, 0.869818449f},
-std::array<float,2>{0.543726087f, 0.709430933f},
-std::array<float,2>{0.443781197f, 0.0308986306f},
-std::array<float,2>{0.687431931f, 0.247588947f},
-std::array<float,2>{0.314570546f, 0.553211689f},
-std::array<float,2>{0.899643898f, 0.996248484f},
-std::array<float,2>{0.196284547f, 0.307537258f},
-std::array<float,2>{0.584354281f, 0.322982907f},
-std::array<float,2>{0.424317986f, 0.894388735f},
-std::array<float,2>{0.836478651f, 0.618719161f},
-std::array<float,2>{0.0440322086f, 0.152769744f},
-std::array<float,2>{0.990031302f, 0.0634820536f},
-std::array<float,2>{0.152997673f, 0.668383837f},
-std::array<float,2>{0.713341236f, 0.755971909f},
-std::array<float,2>{0.28516081f, 0.378056228f},
-std::array<float,2>{0.819400072f, 0.363602996f},
-std::array<float,2>{0.0622570962f, 0.924394488f},
-std::array<float,2>{0.575451851f, 0.585930705f},
-std::array<float,2>{0.419941187f, 0.177247301f},
-std::array<float,2>{0.70281285f, 0.0942130685f},
-std::array<float,2>{0.312388927f, 0.644747257f},
-std::array<float,2>{0.980646193f, 0.805609047f},
-std::array<float,2>{0.129310057f, 0.428290159f},
-std::array<float,2>{0.552121043f, 0.470160306f},
-std::array<float,2>{0.460796624f, 0.831687272f},
-std::array<float,2>{0.784018576f, 0.731660604f},
-std::array<float,2>{0.113671817f, 0.0382561609f},
-std::array<float,2>{0.88963306f, 0.212994263f},
-std::array<float,2>{0.208048537f, 0.509519458f},
-std::array<float,2>{0.661771894f, 0.964130938f},
-std::array<float,2>{0.331484526f, 0.27504915f},
-std::array<float,2>{0.944597542f, 0.400707185f},
-std::array<float,2>{0.170889661f, 0.765766501f},
-std::array<float,2>{0.733925521f, 0.678380311f},
-std::array<float,2>{0.250665665f, 0.0875613242f},
-std::array<float,2>{0.614371777f, 0.131356224f},
-std::array<float,2>{0.4045434f, 0.599376202f},
-std::array<float,2>{0.868840277f, 0.887807071f},
-std::array<float,2>{0.0147705302f, 0.33469063f},
-std::array<float,2>{0.651979029f, 0.29540062f},
-std::array<float,2>{0.358278334f, 0.969483435f},
-std::array<float,2>{0.906450689f, 0.541052878f},
-std::array<float,2>{0.229528204f, 0.222658396f},
-std::array<float,2>{0.771780729f, 0.0131430477f},
-std::array<float,2>{0.0885786638f, 0.693703532f},
-std::array<float,2>{0.515122592f, 0.847638845f},
-std::array<float,2>{0.480923504f, 0.459215581f},
-std::array<float,2>{0.979498267f, 0.300293595f},
-std::array<float,2>{0.1257765f, 0.991291404f},
-std::array<float,2>{0.696378767f, 0.560697675f},
-std::array<float,2>{0.307782263f, 0.23822099f},
-std::array<float,2>{0.572978079f, 0.0198009238f},
-std::array<float,2>{0.414713055f, 0.714501798f},
-std::array<float,2>{0.814601362f, 0.861032903f},
-std::array<float,2>{0.0562772267f, 0.440418273f},
-std::array<float,2>{0.657166362f, 0.384806424f},
-std::array<float,2>{0.332945108f, 0.76371944f},
-std::array<float,2>{0.885889173f, 0.660753608f},
-std::array<float,2>{0.203678533f, 0.0735049844f},
-std::array<float,2>{0.788942873f, 0.145820767f},
-std::array<float,2>{0.109587282f, 0.617048204f},
-std::array<float,2>{0.547974169f, 0.904723644f},
-std::array<float,2>{0.45563218f, 0.313756257f},
-std::array<float,2>{0.874435663f, 0.492206782f},
-std::array<float,2>{0.0101850005f, 0.824014783f},
-std::array<float,2>{0.609853506f, 0.746731341f},
-std::array<float,2>{0.402274013f, 0.0515875965f},
-std::array<float,2>{0.727840006f, 0.191812053f},
-std::array<float,2>{0.25423494f, 0.529914796f},
-std::array<float,2>{0.939821661f, 0.951127648f},
-std::array<float,2>{0.165925071f, 0.259572387f},
-std::array<float,2>{0.511400402f, 0.356351137f},
-std::array<float,2>{0.477791071f, 0.917446077f},
-std::array<float,2>{0.76786989f, 0.567402542f},
-std::array<float,2>{0.0936813876f, 0.161812544f},
-std::array<float,2>{0.912886739f, 0.111407228f},
-std::array<float,2>{0.233999014f, 0.633985877f},
-std::array<float,2>{0.654983938f, 0.792953074f},
-std::array<float,2>{0.354078621f, 0.408926874f},
-std::array<float,2>{0.75950247f, 0.337199926f},
-std::array<float,2>{0.0645712763f, 0.882625103f},
-std::array<float,2>{0.519462526f, 0.606172085f},
-std::array<float,2>{0.49125886f, 0.132831737f},
-std::array<float,2>{0.640443921f, 0.0817693621f},
-std::array<float,2>{0.363909572f, 0.681293249f},
-std::array<float,2>{0.936018705f, 0.779936194f},
-std::array<float,2>{0.234955236f, 0.398095667f},
-std::array<float,2>{0.597008228f, 0.464028358f},
-std::array<float,2>{0.382115245f, 0.858356774f},
-std::array<float,2>{0.847861707f, 0.698607802f},
-std::array<float,2>{0.0245841146f, 0.0040987134f},
-std::array<float,2>{0.963192105f, 0.233639494f},
-std::array<float,2>{0.186107635f, 0.535832524f},
-std::array<float,2>{0.742114663f, 0.98083353f},
-std::array<float,2>{0.27038148f, 0.285713226f},
-std::array<float,2>{0.902657211f, 0.434877276f},
-std::array<float,2>{0.201191872f, 0.798555851f},
-std::array<float,2>{0.680692554f, 0.651152968f},
-std::array<float,2>{0.317970663f, 0.104903914f},
-std::array<float,2>{0.540978789f, 0.179999277f},
-std::array<float,2>{0.440677851f, 0.588515043f},
-std::array<float,2>{0.801568449f, 0.930811942f},
-std::array<float,2>{0.0995284468f, 0.36858353f},
-std::array<float,2>{0.715226114f, 0.270401955f},
-std::array<float,2>{0.281532675f, 0.960685372f},
-std::array<float,2>{0.986074626f, 0.500159085f},
-std::array<float,2>{0.149067447f, 0.207170114f},
-std::array<float,2>{0.841791391f, 0.0420049764f},
-std::array<float,2>{0.0405687578f, 0.723291159f},
-std::array<float,2>{0.578672647f, 0.839722633f},
-std::array<float,2>{0.428182006f, 0.484216332f},
-std::array<float,2>{0.927896023f, 0.361437559f},
-std::array<float,2>{0.244264886f, 0.929224968f},
-std::array<float,2>{0.625440657f, 0.578777671f},
-std::array<float,2>{0.369298965f, 0.174485341f},
-std::array<float,2>{0.526705265f, 0.0986433551f},
-std::array<float,2>{0.492728502f, 0.641882598f},
-std::array<float,2>{0.755221844f, 0.812299728f},
-std::array<float,2>{0.0703734308f, 0.422427118f},
-std::array<float,2>{0.744429588f, 0.474502861f},
-std::array<float,2>{0.27455461f, 0.832775056f},
-std::array<float,2>{0.956585169f, 0.728874326f},
-std::array<float,2>{0.173488617f, 0.0343591236f},
-std::array<float,2>{0.85399121f, 0.217715055f},
-std::array<float,2>{0.0179354567f, 0.513627589f},
-std::array<float,2>{0.607407689f, 0.968172848f},
-std::array<float,2>{0.38556838f, 0.279417902f},
-std::array<float,2>{0.809737265f, 0.406005532f},
-std::array<float,2>{0.106654026f, 0.769814968f},
-std::array<float,2>{0.535087347f, 0.672057867f},
-std::array<float,2>{0.450774312f, 0.0935404897f},
-std::array<float,2>{0.676405191f, 0.126931205f},
-std::array<float,2>{0.327435553f, 0.597506642f},
-std::array<float,2>{0.89827776f, 0.884995878f},
-std::array<float,2>{0.191755012f, 0.329837918f},
-std::array<float,2>{0.593663275f, 0.291508704f},
-std::array<float,2>{0.434841692f, 0.975546181f},
-std::array<float,2>{0.828734457f, 0.546033323f},
-std::array<float,2>{0.0387255214f, 0.222646773f},
-std::array<float,2>{0.993454576f, 0.0100322841f},
-std::array<float,2>{0.140741527f, 0.688768148f},
-std::array<float,2>{0.703886688f, 0.850370467f},
-std::array<float,2>{0.292618662f, 0.453715295f},
-std::array<float,2>{0.823995411f, 0.255476058f},
-std::array<float,2>{0.0541262701f, 0.940630317f},
-std::array<float,2>{0.56295532f, 0.517131746f},
-std::array<float,2>{0.413306445f, 0.197621763f},
-std::array<float,2>{0.688755214f, 0.0601755492f},
-std::array<float,2>{0.303012729f, 0.737829328f},
-std::array<float,2>{0.970642567f, 0.817159712f},
-std::array<float,2>{0.136127785f, 0.48897478f},
-std::array<float,2>{0.555042803f, 0.420715243f},
-std::array<float,2>{0.466853231f, 0.782887161f},
-std::array<float,2>{0.794588268f, 0.626343727f},
-std::array<float,2>{0.121188551f, 0.120306522f},
-std::array<float,2>{0.880718291f, 0.16672723f},
-std::array<float,2>{0.218469396f, 0.573813856f},
-std::array<float,2>{0.666865587f, 0.909901857f},
-std::array<float,2>{0.336054176f, 0.349642366f},
-std::array<float,2>{0.952731133f, 0.445470124f},
-std::array<float,2>{0.16016753f, 0.872207105f},
-std::array<float,2>{0.725966215f, 0.703877091f},
-std::array<float,2>{0.259862453f, 0.0254752599f},
-std::array<float,2>{0.622546315f, 0.245976657f},
-std::array<float,2>{0.393431544f, 0.548094451f},
-std::array<float,2>{0.866602719f, 0.995370388f},
-std::array<float,2>{0.0052103051f, 0.310060084f},
-std::array<float,2>{0.645375967f, 0.3252922f},
-std::array<float,2>{0.349798858f, 0.894604385f},
-std::array<float,2>{0.918774188f, 0.624901056f},
-std::array<float,2>{0.218954936f, 0.151432142f},
-std::array<float,2>{0.773557603f, 0.0681404844f},
-std::array<float,2>{0.0802794993f, 0.665038526f},
-std::array<float,2>{0.505456626f, 0.751684368f},
-std::array<float,2>{0.473807693f, 0.379173309f},
-std::array<float,2>{0.960569084f, 0.319086999f},
-std::array<float,2>{0.177261516f, 0.901054561f},
-std::array<float,2>{0.749590218f, 0.611353755f},
-std::array<float,2>{0.280636877f, 0.142052993f},
-std::array<float,2>{0.603168726f, 0.0766529217f},
-std::array<float,2>{0.38842833f, 0.657299459f},
-std::array<float,2>{0.85637176f, 0.759931266f},
-std::array<float,2>{0.0198090933f, 0.389588237f},
-std::array<float,2>{0.628967822f, 0.442915976f},
-std::array<float,2>{0.372142732f, 0.863660574f},
-std::array<float,2>{0.922797143f, 0.717742264f},
-std::array<float,2>{0.247702613f, 0.0189756416f},
-std::array<float,2>{0.752263725f, 0.23905018f},
-std::array<float,2>{0.0773447752f, 0.557907522f},
-std::array<float,2>{0.529069841f, 0.987794936f},
-std::array<float,2>{0.499703586f, 0.304140031f},
-std::array<float,2>{0.834948838f, 0.411090672f},
-std::array<float,2>{0.034193255f, 0.794137955f},
-std::array<float,2>{0.587467253f, 0.637820542f},
-std::array<float,2>{0.431099683f, 0.116965346f},
-std::array<float,2>{0.708916366f, 0.158140957f},
-std::array<float,2>{0.294466615f, 0.564471364f},
-std::array<float,2>{0.999036133f, 0.918723464f},
-std::array<float,2>{0.14472726f, 0.3538616f},
-std::array<float,2>{0.535373211f, 0.262764186f},
-std::array<float,2>{0.445911705f, 0.946866691f},
-std::array<float,2>{0.805759907f, 0.525480747f},
-std::array<float,2>{0.102851026f, 0.190286145f},
-std::array<float,2>{0.894446135f, 0.0469526835f},
-std::array<float,2>{0.188880026f, 0.742381454f},
-std::array<float,2>{0.673187613f, 0.826442301f},
-std::array<float,2>{0.320398688f, 0.499319762f},
-std::array<float,2>{0.791908264f, 0.282379836f},
-std::array<float,2>{0.118233882f, 0.978028178f},
-std::array<float,2>{0.560157418f, 0.534941435f},
-std::array<float,2>{0.464317381f, 0.228466004f},
-std::array<float,2>{0.668366432f, 0.00121787912f},
-std::array<float,2>{0.343351573f, 0.701277733f},
-std::array<float,2>{0.876636207f, 0.855426788f},
-std::array<float,2>{0.21409823f, 0.466916561f},
-std::array<float,2>{0.569543242f, 0.392011434f},
-std::array<float,2>{0.407278329f, 0.773921549f},
-std::array<float,2>{0.82629478f, 0.686242819f},
-std::array<float,2>{0.0491375402f, 0.0825121254f},
-std::array<float,2>{0.97363621f, 0.140211612f},
-std::array<float,2>{0.138370961f, 0.60322386f},
-std::array<float,2>{0.692438245f, 0.875747681f},
-std::array<float,2>{0.296882153f, 0.342635214f},
-std::array<float,2>{0.916949689f, 0.477584302f},
-std::array<float,2>{0.223796338f, 0.840980411f},
-std::array<float,2>{0.644049287f, 0.720840693f},
-std::array<float,2>{0.345237523f, 0.0451181419f},
-std::array<float,2>{0.503806293f, 0.204188824f},
-std::array<float,2>{0.470561862f, 0.507060707f},
-std::array<float,2>{0.77827704f, 0.953720033f},
-std::array<float,2>{0.0842509493f, 0.267468631f},
-std::array<float,2>{0.721891463f, 0.373151183f},
-std::array<float,2>{0.265019983f, 0.935709655f},
-std::array<float,2>{0.948459864f, 0.593588233f},
-std::array<float,2>{0.156276613f, 0.187473148f},
-std::array<float,2>{0.863133967f, 0.108789541f},
-std::array<float,2>{0.00151940866f, 0.652932763f},
-std::array<float,2>{0.618574262f, 0.80463928f},
-std::array<float,2>{0.397695214f, 0.432964802f},
-std::array<float,2>{0.886916578f, 0.274366826f},
-std::array<float,2>{0.209083468f, 0.963103116f},
-std::array<float,2>{0.663021386f, 0.508607268f},
-std::array<float,2>{0.328987062f, 0.214227974f},
-std::array<float,2>{0.554467201f, 0.0375497006f},
-std::array<float,2>{0.457200736f, 0.73064816f},
-std::array<float,2>{0.782891452f, 0.831035852f},
-std::array<float,2>{0.116628334f, 0.469673544f},
-std::array<float,2>{0.700133502f, 0.429214388f},
-std::array<float,2>{0.309777617f, 0.80658704f},
-std::array<float,2>{0.9830423f, 0.645770967f},
-std::array<float,2>{0.131328046f, 0.0956490934f},
-std::array<float,2>{0.818010747f, 0.17670545f},
-std::array<float,2>{0.0601997823f, 0.584268928f},
-std::array<float,2>{0.576793849f, 0.925106049f},
-std::array<float,2>{0.419553071f, 0.364311993f},
-std::array<float,2>{0.771430969f, 0.460921049f},
-std::array<float,2>{0.0870668665f, 0.846617401f},
-std::array<float,2>{0.512979031f, 0.695110917f},
-std::array<float,2>{0.482706577f, 0.0126188621f},
-std::array<float,2>{0.649243653f, 0.224458426f},
-std::array<float,2>{0.356803477f, 0.542118907f},
-std::array<float,2>{0.908429265f, 0.970183849f},
-std::array<float,2>{0.227012053f, 0.29682079f},
-std::array<float,2>{0.616737068f, 0.335256815f},
-std::array<float,2>{0.403204381f, 0.887560308f},
-std::array<float,2>{0.870202065f, 0.597756147f},
-std::array<float,2>{0.0121362722f, 0.132656336f},
-std::array<float,2>{0.942160249f, 0.0861721486f},
-std::array<float,2>{0.168448001f, 0.679633081f},
-std::array<float,2>{0.730579674f, 0.767285228f},
-std::array<float,2>{0.252259403f, 0.401695579f},
-std::array<float,2>{0.844641805f, 0.344565362f},
-std::array<float,2>{0.0287532061f, 0.911302865f},
-std::array<float,2>{0.598163605f, 0.574780762f},
-std::array<float,2>{0.377172738f, 0.168151915f},
-std::array<float,2>{0.73797822f, 0.122153491f},
-std::array<float,2>{0.267720371f, 0.632415056f},
-std::array<float,2>{0.967646301f, 0.785626352f},
-std::array<float,2>{0.181863159f, 0.417314678f},
-std::array<float,2>{0.520110846f, 0.487595767f},
-std::array<float,2>{0.484959871f, 0.813818693f},
-std::array<float,2>{0.765291691f, 0.73907876f},
-std::array<float,2>{0.0684192255f, 0.0551551059f},
-std::array<float,2>{0.931091189f, 0.201604992f},
-std::array<float,2>{0.238529384f, 0.519845724f},
-std::array<float,2>{0.632830143f, 0.943399608f},
-std::array<float,2>{0.361580312f, 0.25067085f},
-std::array<float,2>{0.990589559f, 0.37701118f},
-std::array<float,2>{0.155371606f, 0.757229328f},
-std::array<float,2>{0.711729288f, 0.66920054f},
-std::array<float,2>{0.287306786f, 0.0629755035f},
-std::array<float,2>{0.58369875f, 0.153542578f},
-std::array<float,2>{0.422667563f, 0.61773771f},
-std::array<float,2>{0.839532554f, 0.892813683f},
-std::array<float,2>{0.0460221656f, 0.323780775f},
-std::array<float,2>{0.684294105f, 0.308101445f},
-std::array<float,2>{0.313916385f, 0.99772352f},
-std::array<float,2>{0.901569068f, 0.553910613f},
-std::array<float,2>{0.198599249f, 0.246336192f},
-std::array<float,2>{0.799858451f, 0.0295504238f},
-std::array<float,2>{0.0947060883f, 0.710911155f},
-std::array<float,2>{0.545195758f, 0.870881915f},
-std::array<float,2>{0.44306469f, 0.452876866f},
-std::array<float,2>{0.938499033f, 0.260744601f},
-std::array<float,2>{0.167744562f, 0.952901483f},
-std::array<float,2>{0.728791296f, 0.529018462f},
-std::array<float,2>{0.256774604f, 0.193639636f},
-std::array<float,2>{0.611965895f, 0.0534510426f},
-std::array<float,2>{0.399313867f, 0.749432266f},
-std::array<float,2>{0.871254504f, 0.821963668f},
-std::array<float,2>{0.00856260769f, 0.494542688f},
-std::array<float,2>{0.65399152f, 0.406439304f},
-std::array<float,2>{0.35225597f, 0.790937364f},
-std::array<float,2>{0.910654724f, 0.635220706f},
-std::array<float,2>{0.23084107f, 0.110175222f},
-std::array<float,2>{0.766249776f, 0.162489295f},
-std::array<float,2>{0.0903775692f, 0.568666816f},
-std::array<float,2>{0.509020388f, 0.914441228f},
-std::array<float,2>{0.479869097f, 0.35795182f},
-std::array<float,2>{0.814055622f, 0.438911825f},
-std::array<float,2>{0.0571957082f, 0.861726999f},
-std::array<float,2>{0.571403265f, 0.711549282f},
-std::array<float,2>{0.417228162f, 0.0228531957f},
-std::array<float,2>{0.698098004f, 0.234599471f},
-std::array<float,2>{0.306144834f, 0.559546292f},
-std::array<float,2>{0.977251947f, 0.990232706f},
-std::array<float,2>{0.128523722f, 0.2977404f},
-std::array<float,2>{0.549970388f, 0.314678937f},
-std::array<float,2>{0.454741716f, 0.903622806f},
-std::array<float,2>{0.785984635f, 0.613571286f},
-std::array<float,2>{0.111776039f, 0.146631226f},
-std::array<float,2>{0.884412289f, 0.0707135201f},
-std::array<float,2>{0.205771968f, 0.663551986f},
-std::array<float,2>{0.659304619f, 0.762769938f},
-std::array<float,2>{0.334567666f, 0.384393185f},
-std::array<float,2>{0.803512573f, 0.369598836f},
-std::array<float,2>{0.101309225f, 0.932680964f},
-std::array<float,2>{0.542181253f, 0.586049318f},
-std::array<float,2>{0.437906593f, 0.183125913f},
-std::array<float,2>{0.68199569f, 0.102560937f},
-std::array<float,2>{0.319325686f, 0.648952365f},
-std::array<float,2>{0.904829443f, 0.800305903f},
-std::array<float,2>{0.200289115f, 0.436669111f},
-std::array<float,2>{0.581447363f, 0.482009947f},
-std::array<float,2>{0.427713871f, 0.83624661f},
-std::array<float,2>{0.842116654f, 0.725911856f},
-std::array<float,2>{0.0417055078f, 0.039103359f},
-std::array<float,2>{0.98744452f, 0.209302247f},
-std::array<float,2>{0.152117684f, 0.503323019f},
-std::array<float,2>{0.718123019f, 0.957616746f},
-std::array<float,2>{0.283421725f, 0.272563964f},
-std::array<float,2>{0.93464756f, 0.395423204f},
-std::array<float,2>{0.237763509f, 0.777712584f},
-std::array<float,2>{0.637142241f, 0.682285726f},
-std::array<float,2>{0.365436435f, 0.079284668f},
-std::array<float,2>{0.51645869f, 0.13519679f},
-std::array<float,2>{0.489048749f, 0.609057546f},
-std::array<float,2>{0.761312723f, 0.879443586f},
-std::array<float,2>{0.06424243f, 0.338885933f},
-std::array<float,2>{0.739247084f, 0.287534714f},
-std::array<float,2>{0.272146523f, 0.984191835f},
-std::array<float,2>{0.961519241f, 0.538217604f},
-std::array<float,2>{0.185334831f, 0.231681809f},
-std::array<float,2>{0.85062921f, 0.00758431852f},
-std::array<float,2>{0.0260381009f, 0.696062744f},
-std::array<float,2>{0.595383823f, 0.857411444f},
-std::array<float,2>{0.380107373f, 0.462522268f},
-std::array<float,2>{0.895258784f, 0.330162585f},
-std::array<float,2>{0.194745973f, 0.884335279f},
-std::array<float,2>{0.678497076f, 0.595352769f},
-std::array<float,2>{0.324246198f, 0.128302678f},
-std::array<float,2>{0.533116102f, 0.0900655389f},
-std::array<float,2>{0.452320933f, 0.674789548f},
-std::array<float,2>{0.810742021f, 0.772209346f},
-std::array<float,2>{0.108452186f, 0.402379334f},
-std::array<float,2>{0.705996156f, 0.456511348f},
-std::array<float,2>{0.289942771f, 0.847978354f},
-std::array<float,2>{0.995000541f, 0.689822495f},
-std::array<float,2>{0.143896893f, 0.00917845871f},
-std::array<float,2>{0.830484927f, 0.219783291f},
-std::array<float,2>{0.0362201147f, 0.544246376f},
-std::array<float,2>{0.590095043f, 0.973572671f},
-std::array<float,2>{0.436740935f, 0.289360285f},
-std::array<float,2>{0.756811202f, 0.424132138f},
-std::array<float,2>{0.0740643963f, 0.809432268f},
-std::array<float,2>{0.525200665f, 0.6436795f},
-std::array<float,2>{0.49590221f, 0.101108849f},
-std::array<float,2>{0.628215134f, 0.172353283f},
-std::array<float,2>{0.368566453f, 0.581718922f},
-std::array<float,2>{0.926228523f, 0.927682877f},
-std::array<float,2>{0.243850291f, 0.359385848f},
-std::array<float,2>{0.607911885f, 0.278770119f},
-std::array<float,2>{0.383988917f, 0.965978682f},
-std::array<float,2>{0.852237463f, 0.514461458f},
-std::array<float,2>{0.0157678165f, 0.215454489f},
-std::array<float,2>{0.954884946f, 0.0323969945f},
-std::array<float,2>{0.1754345f, 0.726966798f},
-std::array<float,2>{0.742959738f, 0.8359164f},
-std::array<float,2>{0.275852323f, 0.475277245f},
-std::array<float,2>{0.86355257f, 0.311642408f},
-std::array<float,2>{0.00733484328f, 0.992762744f},
-std::array<float,2>{0.624918699f, 0.549964726f},
-std::array<float,2>{0.391450256f, 0.243522733f},
-std::array<float,2>{0.722761512f, 0.024400726f},
-std::array<float,2>{0.25934732f, 0.705425978f},
-std::array<float,2>{0.951127529f, 0.874350429f},
-std::array<float,2>{0.163742334f, 0.448646784f},
-std::array<float,2>{0.506673932f, 0.381618381f},
-std::array<float,2>{0.475674778f, 0.75236547f},
-std::array<float,2>{0.775765181f, 0.667528927f},
-std::array<float,2>{0.0784561038f, 0.0701321661f},
-std::array<float,2>{0.920148313f, 0.148858607f},
-std::array<float,2>{0.222006857f, 0.621625245f},
-std::array<float,2>{0.647610307f, 0.897537649f},
-std::array<float,2>{0.349540591f, 0.327583015f},
-std::array<float,2>{0.970979214f, 0.490258187f},
-std::array<float,2>{0.134240985f, 0.818822861f},
-std::array<float,2>{0.690959275f, 0.735689282f},
-std::array<float,2>{0.301620215f, 0.0613926351f},
-std::array<float,2>{0.565224826f, 0.19721514f},
-std::array<float,2>{0.411771953f, 0.517991126f},
-std::array<float,2>{0.820450842f, 0.938373923f},
-std::array<float,2>{0.0519259498f, 0.257400542f},
-std::array<float,2>{0.664765418f, 0.349085897f},
-std::array<float,2>{0.338167608f, 0.908115327f},
-std::array<float,2>{0.88125807f, 0.571685791f},
-std::array<float,2>{0.214917809f, 0.164432496f},
-std::array<float,2>{0.795946598f, 0.117586955f},
-std::array<float,2>{0.123080313f, 0.627227068f},
-std::array<float,2>{0.558500707f, 0.78426224f},
-std::array<float,2>{0.466219187f, 0.419833094f},
-std::array<float,2>{0.996976912f, 0.351876259f},
-std::array<float,2>{0.148044139f, 0.920166075f},
-std::array<float,2>{0.710253656f, 0.563129485f},
-std::array<float,2>{0.295146078f, 0.158221394f},
-std::array<float,2>{0.589188814f, 0.11423073f},
-std::array<float,2>{0.43183741f, 0.640334249f},
-std::array<float,2>{0.832972527f, 0.795360744f},
-std::array<float,2>{0.0330419652f, 0.412515879f},
-std::array<float,2>{0.674652278f, 0.497554302f},
-std::array<float,2>{0.323117554f, 0.824396253f},
-std::array<float,2>{0.891352892f, 0.744366884f},
-std::array<float,2>{0.190461785f, 0.0502344631f},
-std::array<float,2>{0.808359087f, 0.188490376f},
-std::array<float,2>{0.105259538f, 0.525307119f},
-std::array<float,2>{0.537828088f, 0.948393822f},
-std::array<float,2>{0.44763881f, 0.264997214f},
-std::array<float,2>{0.857744277f, 0.38787955f},
-std::array<float,2>{0.0216064602f, 0.759447098f},
-std::array<float,2>{0.60435909f, 0.659905612f},
-std::array<float,2>{0.388808101f, 0.0750196576f},
-std::array<float,2>{0.746322036f, 0.144303605f},
-std::array<float,2>{0.277892172f, 0.611134887f},
-std::array<float,2>{0.958518863f, 0.898644269f},
-std::array<float,2>{0.177805752f, 0.317648828f},
-std::array<float,2>{0.530919313f, 0.302400649f},
-std::array<float,2>{0.497667164f, 0.985902607f},
-std::array<float,2>{0.75060004f, 0.5548383f},
-std::array<float,2>{0.0750130117f, 0.241207227f},
-std::array<float,2>{0.92523706f, 0.0173007436f},
-std::array<float,2>{0.248481646f, 0.716230392f},
-std::array<float,2>{0.632612586f, 0.867083549f},
-std::array<float,2>{0.373426616f, 0.44388324f},
-std::array<float,2>{0.779878378f, 0.268081069f},
-std::array<float,2>{0.0823251233f, 0.956099212f},
-std::array<float,2>{0.500240624f, 0.505417764f},
-std::array<float,2>{0.471691191f, 0.206129134f},
-std::array<float,2>{0.641943455f, 0.0439694449f},
-std::array<float,2>{0.34571898f, 0.719415605f},
-std::array<float,2>{0.914603591f, 0.841880023f},
-std::array<float,2>{0.225598395f, 0.479097098f},
-std::array<float,2>{0.620649219f, 0.430265754f},
-std::array<float,2>{0.394660503f, 0.80174166f},
-std::array<float,2>{0.859418571f, 0.654754698f},
-std::array<float,2>{0.00197286508f, 0.10591612f},
-std::array<float,2>{0.946095765f, 0.184134662f},
-std::array<float,2>{0.15848878f, 0.591443181f},
-std::array<float,2>{0.719877481f, 0.93373692f},
-std::array<float,2>{0.262652725f, 0.371451825f},
-std::array<float,2>{0.877180398f, 0.464898169f},
-std::array<float,2>{0.212858617f, 0.852360129f},
-std::array<float,2>{0.670805812f, 0.699746728f},
-std::array<float,2>{0.340264052f, 0.00289074425f},
-std::array<float,2>{0.562431693f, 0.228636339f},
-std::array<float,2>{0.461879253f, 0.532937407f},
-std::array<float,2>{0.789859474f, 0.980051339f},
-std::array<float,2>{0.119491786f, 0.283832192f},
-std::array<float,2>{0.694078028f, 0.340970695f},
-std::array<float,2>{0.299888551f, 0.878230155f},
-std::array<float,2>{0.976030707f, 0.605186164f},
-std::array<float,2>{0.139891803f, 0.138595447f},
-std::array<float,2>{0.82496047f, 0.0845052078f},
-std::array<float,2>{0.04697356f, 0.684592247f},
-std::array<float,2>{0.567742109f, 0.776551008f},
-std::array<float,2>{0.409146667f, 0.393809438f},
-std::array<float,2>{0.907369316f, 0.293527335f},
-std::array<float,2>{0.228774875f, 0.971390307f},
-std::array<float,2>{0.650406837f, 0.539502561f},
-std::array<float,2>{0.358520448f, 0.224847749f},
-std::array<float,2>{0.513863802f, 0.0146097159f},
-std::array<float,2>{0.482278466f, 0.691717625f},
-std::array<float,2>{0.773002446f, 0.844275951f},
-std::array<float,2>{0.08894445f, 0.458124608f},
-std::array<float,2>{0.733296037f, 0.39902097f},
-std::array<float,2>{0.251291215f, 0.767624438f},
-std::array<float,2>{0.943422973f, 0.676005661f},
-std::array<float,2>{0.171071663f, 0.0889621824f},
-std::array<float,2>{0.86744076f, 0.129942164f},
-std::array<float,2>{0.0137314312f, 0.601561725f},
-std::array<float,2>{0.61378026f, 0.888992786f},
-std::array<float,2>{0.405637711f, 0.332399368f},
-std::array<float,2>{0.784733593f, 0.471733302f},
-std::array<float,2>{0.114498906f, 0.829078138f},
-std::array<float,2>{0.551665723f, 0.732659221f},
-std::array<float,2>{0.459687382f, 0.0358115956f},
-std::array<float,2>{0.660987079f, 0.21151273f},
-std::array<float,2>{0.330696136f, 0.510254383f},
-std::array<float,2>{0.890092492f, 0.962321997f},
-std::array<float,2>{0.2079705f, 0.277270526f},
-std::array<float,2>{0.575149655f, 0.366372138f},
-std::array<float,2>{0.42149356f, 0.923335791f},
-std::array<float,2>{0.819033623f, 0.583863437f},
-std::array<float,2>{0.0613361858f, 0.178660393f},
-std::array<float,2>{0.981515586f, 0.0974801481f},
-std::array<float,2>{0.130138084f, 0.647389948f},
-std::array<float,2>{0.701773942f, 0.80723989f},
-std::array<float,2>{0.311293274f, 0.427675098f},
-std::array<float,2>{0.837049603f, 0.320743769f},
-std::array<float,2>{0.0432193428f, 0.891651928f},
-std::array<float,2>{0.58571744f, 0.619915843f},
-std::array<float,2>{0.425050378f, 0.155941039f},
-std::array<float,2>{0.714555144f, 0.065484032f},
-std::array<float,2>{0.286538064f, 0.671060979f},
-std::array<float,2>{0.988381445f, 0.755491972f},
-std::array<float,2>{0.153327361f, 0.376324534f},
-std::array<float,2>{0.543954849f, 0.45039773f},
-std::array<float,2>{0.444424093f, 0.868619084f},
-std::array<float,2>{0.797109008f, 0.708294868f},
-std::array<float,2>{0.095830597f, 0.0284805391f},
-std::array<float,2>{0.899310589f, 0.248293474f},
-std::array<float,2>{0.19649829f, 0.552160561f},
-std::array<float,2>{0.686456263f, 0.998133302f},
-std::array<float,2>{0.315632939f, 0.305015117f},
-std::array<float,2>{0.965309918f, 0.415377289f},
-std::array<float,2>{0.180958167f, 0.78781414f},
-std::array<float,2>{0.734495938f, 0.629150331f},
-std::array<float,2>{0.266601413f, 0.123833753f},
-std::array<float,2>{0.60027349f, 0.170471579f},
-std::array<float,2>{0.376035303f, 0.576236188f},
-std::array<float,2>{0.846277595f, 0.91307646f},
-std::array<float,2>{0.0304232035f, 0.345915914f},
-std::array<float,2>{0.63543129f, 0.2531569f},
-std::array<float,2>{0.360502183f, 0.941690385f},
-std::array<float,2>{0.932108462f, 0.522711575f},
-std::array<float,2>{0.242034703f, 0.199763983f},
-std::array<float,2>{0.761781812f, 0.0572291389f},
-std::array<float,2>{0.0677743182f, 0.741029799f},
-std::array<float,2>{0.521917045f, 0.815697074f},
-std::array<float,2>{0.486636907f, 0.484771699f},
-std::array<float,2>{0.998744071f, 0.264865547f},
-std::array<float,2>{0.146230951f, 0.948693633f},
-std::array<float,2>{0.707749128f, 0.525089204f},
-std::array<float,2>{0.293815047f, 0.188914672f},
-std::array<float,2>{0.586301446f, 0.0500183888f},
-std::array<float,2>{0.429700255f, 0.744431555f},
-std::array<float,2>{0.835905254f, 0.824594975f},
-std::array<float,2>{0.0337070599f, 0.497247219f},
-std::array<float,2>{0.672685266f, 0.412253648f},
-std::array<float,2>{0.322017878f, 0.795009851f},
-std::array<float,2>{0.893199146f, 0.640529692f},
-std::array<float,2>{0.187773019f, 0.113819957f},
-std::array<float,2>{0.805545032f, 0.158482149f},
-std::array<float,2>{0.102081753f, 0.563474834f},
-std::array<float,2>{0.536440074f, 0.919989288f},
-std::array<float,2>{0.447113961f, 0.351727813f},
-std::array<float,2>{0.857165217f, 0.444145918f},
-std::array<float,2>{0.0211324375f, 0.866802216f},
-std::array<float,2>{0.601834416f, 0.715920746f},
-std::array<float,2>{0.3868604f, 0.0175384469f},
-std::array<float,2>{0.748071849f, 0.240723029f},
-std::array<float,2>{0.279449433f, 0.555052459f},
-std::array<float,2>{0.959539294f, 0.986197829f},
-std::array<float,2>{0.175948068f, 0.302534908f},
-std::array<float,2>{0.527881742f, 0.317622483f},
-std::array<float,2>{0.498802453f, 0.89886862f},
-std::array<float,2>{0.753022015f, 0.61100775f},
-std::array<float,2>{0.0767428055f, 0.144149542f},
-std::array<float,2>{0.922975063f, 0.0748007447f},
-std::array<float,2>{0.246781051f, 0.659912407f},
-std::array<float,2>{0.630003095f, 0.759634495f},
-std::array<float,2>{0.371609926f, 0.387954384f},
-std::array<float,2>{0.778465688f, 0.371253788f},
-std::array<float,2>{0.0857465416f, 0.933978558f},
-std::array<float,2>{0.502333164f, 0.591626883f},
-std::array<float,2>{0.468880564f, 0.184330195f},
-std::array<float,2>{0.643283784f, 0.105608948f},
-std::array<float,2>{0.344676226f, 0.654511809f},
-std::array<float,2>{0.917589426f, 0.801322639f},
-std::array<float,2>{0.222729653f, 0.430650651f},
-std::array<float,2>{0.617763102f, 0.479308426f},
-std::array<float,2>{0.397297531f, 0.842067182f},
-std::array<float,2>{0.861712337f, 0.719533026f},
-std::array<float,2>{0.000763314136f, 0.0443601049f},
-std::array<float,2>{0.947486162f, 0.206532553f},
-std::array<float,2>{0.157315224f, 0.505703568f},
-std::array<float,2>{0.721407473f, 0.956499815f},
-std::array<float,2>{0.264317632f, 0.26851204f},
-std::array<float,2>{0.875960886f, 0.393619746f},
-std::array<float,2>{0.213821009f, 0.776846468f},
-std::array<float,2>{0.66972208f, 0.685006976f},
-std::array<float,2>{0.341818124f, 0.0849009827f},
-std::array<float,2>{0.5592646f, 0.138273194f},
-std::array<float,2>{0.463720441f, 0.605447948f},
-std::array<float,2>{0.792720914f, 0.87802577f},
-std::array<float,2>{0.117237769f, 0.341162771f},
-std::array<float,2>{0.692212045f, 0.284074336f},
-std::array<float,2>{0.298236638f, 0.980455518f},
-std::array<float,2>{0.973278463f, 0.533195198f},
-std::array<float,2>{0.137534514f, 0.228860065f},
-std::array<float,2>{0.827618599f, 0.00262504537f},
-std::array<float,2>{0.0501765981f, 0.700152218f},
-std::array<float,2>{0.568966031f, 0.852277994f},
-std::array<float,2>{0.407224178f, 0.465093404f},
-std::array<float,2>{0.909326434f, 0.332204461f},
-std::array<float,2>{0.228331134f, 0.88873291f},
-std::array<float,2>{0.650089383f, 0.601182818f},
-std::array<float,2>{0.3558456f, 0.130165428f},
-std::array<float,2>{0.512194335f, 0.0891958028f},
-std::array<float,2>{0.483528346f, 0.676190257f},
-std::array<float,2>{0.770022094f, 0.768008053f},
-std::array<float,2>{0.0861463919f, 0.399318099f},
-std::array<float,2>{0.731904268f, 0.458452195f},
-std::array<float,2>{0.253596663f, 0.844629467f},
-std::array<float,2>{0.943097889f, 0.691547215f},
-std::array<float,2>{0.169798866f, 0.0143525964f},
-std::array<float,2>{0.869626164f, 0.22509709f},
-std::array<float,2>{0.0131347086f, 0.539098263f},
-std::array<float,2>{0.615452111f, 0.971569061f},
-std::array<float,2>{0.404206008f, 0.293919623f},
-std::array<float,2>{0.781813025f, 0.427399039f},
-std::array<float,2>{0.115666367f, 0.807592511f},
-std::array<float,2>{0.553048551f, 0.647111475f},
-std::array<float,2>{0.458490312f, 0.0973722339f},
-std::array<float,2>{0.663591623f, 0.178393319f},
-std::array<float,2>{0.329777092f, 0.583654642f},
-std::array<float,2>{0.887805641f, 0.923061192f},
-std::array<float,2>{0.21072787f, 0.366481304f},
-std::array<float,2>{0.578049183f, 0.276912481f},
-std::array<float,2>{0.418255746f, 0.962126791f},
-std::array<float,2>{0.817293644f, 0.510528028f},
-std::array<float,2>{0.0591142848f, 0.211788252f},
-std::array<float,2>{0.984237015f, 0.0359800346f},
-std::array<float,2>{0.132420868f, 0.732821405f},
-std::array<float,2>{0.70067066f, 0.828855097f},
-std::array<float,2>{0.308605313f, 0.47212255f},
-std::array<float,2>{0.838833869f, 0.304762512f},
-std::array<float,2>{0.0451805741f, 0.998530984f},
-std::array<float,2>{0.582767487f, 0.551912427f},
-std::array<float,2>{0.42310974f, 0.248211518f},
-std::array<float,2>{0.712827682f, 0.0285820477f},
-std::array<float,2>{0.288789183f, 0.708187044f},
-std::array<float,2>{0.992057621f, 0.868396819f},
-std::array<float,2>{0.155231982f, 0.450680166f},
-std::array<float,2>{0.546796978f, 0.376002908f},
-std::array<float,2>{0.44155395f, 0.755812407f},
-std::array<float,2>{0.799480677f, 0.671200097f},
-std::array<float,2>{0.095086053f, 0.0659177005f},
-std::array<float,2>{0.900680363f, 0.156236142f},
-std::array<float,2>{0.19731079f, 0.619736195f},
-std::array<float,2>{0.684766054f, 0.892067194f},
-std::array<float,2>{0.313222766f, 0.32038638f},
-std::array<float,2>{0.968015909f, 0.484563708f},
-std::array<float,2>{0.183588251f, 0.815443575f},
-std::array<float,2>{0.736883223f, 0.740941286f},
-std::array<float,2>{0.268773466f, 0.0576041862f},
-std::array<float,2>{0.599295139f, 0.199991599f},
-std::array<float,2>{0.378191441f, 0.522512019f},
-std::array<float,2>{0.845210254f, 0.941627145f},
-std::array<float,2>{0.0274642836f, 0.253258556f},
-std::array<float,2>{0.633901298f, 0.345990747f},
-std::array<float,2>{0.362646669f, 0.912767231f},
-std::array<float,2>{0.930418015f, 0.576523662f},
-std::array<float,2>{0.240214556f, 0.170659482f},
-std::array<float,2>{0.764435947f, 0.123725228f},
-std::array<float,2>{0.0698390827f, 0.629267752f},
-std::array<float,2>{0.521426678f, 0.787977755f},
-std::array<float,2>{0.485517859f, 0.415168315f},
-std::array<float,2>{0.941141903f, 0.35824278f},
-std::array<float,2>{0.164332345f, 0.914177477f},
-std::array<float,2>{0.726598978f, 0.56844449f},
-std::array<float,2>{0.255752504f, 0.162218645f},
-std::array<float,2>{0.610961556f, 0.10993968f},
-std::array<float,2>{0.400471628f, 0.634827852f},
-std::array<float,2>{0.873356879f, 0.790703177f},
-std::array<float,2>{0.0112856701f, 0.406613946f},
-std::array<float,2>{0.655321538f, 0.494148284f},
-std::array<float,2>{0.355040938f, 0.822122395f},
-std::array<float,2>{0.913245797f, 0.749037921f},
-std::array<float,2>{0.233011678f, 0.0534827262f},
-std::array<float,2>{0.769453347f, 0.193422481f},
-std::array<float,2>{0.0919886976f, 0.529226422f},
-std::array<float,2>{0.510131299f, 0.952669322f},
-std::array<float,2>{0.476847887f, 0.26105386f},
-std::array<float,2>{0.816234589f, 0.384753734f},
-std::array<float,2>{0.055015754f, 0.763041735f},
-std::array<float,2>{0.573551059f, 0.663120091f},
-std::array<float,2>{0.415711373f, 0.0705445185f},
-std::array<float,2>{0.6954965f, 0.146924213f},
-std::array<float,2>{0.307616681f, 0.613292575f},
-std::array<float,2>{0.978634477f, 0.903530061f},
-std::array<float,2>{0.126076669f, 0.314769179f},
-std::array<float,2>{0.547807753f, 0.297472239f},
-std::array<float,2>{0.45660013f, 0.989854038f},
-std::array<float,2>{0.787874162f, 0.559100091f},
-std::array<float,2>{0.110926136f, 0.234713241f},
-std::array<float,2>{0.885333002f, 0.0226488113f},
-std::array<float,2>{0.204905853f, 0.711791158f},
-std::array<float,2>{0.658004999f, 0.861357152f},
-std::array<float,2>{0.333700389f, 0.438551486f},
-std::array<float,2>{0.802552581f, 0.272856653f},
-std::array<float,2>{0.0983608663f, 0.957787931f},
-std::array<float,2>{0.539637387f, 0.503146231f},
-std::array<float,2>{0.439516544f, 0.209017143f},
-std::array<float,2>{0.680180311f, 0.0395038575f},
-std::array<float,2>{0.316648632f, 0.725788653f},
-std::array<float,2>{0.904001236f, 0.836049616f},
-std::array<float,2>{0.202621847f, 0.482329756f},
-std::array<float,2>{0.579548597f, 0.436773509f},
-std::array<float,2>{0.429269433f, 0.800698519f},
-std::array<float,2>{0.840615213f, 0.649403155f},
-std::array<float,2>{0.0392275415f, 0.102898523f},
-std::array<float,2>{0.984894454f, 0.183488056f},
-std::array<float,2>{0.14998512f, 0.586297691f},
-std::array<float,2>{0.715897262f, 0.932912409f},
-std::array<float,2>{0.282536983f, 0.369249165f},
-std::array<float,2>{0.937282503f, 0.462862253f},
-std::array<float,2>{0.23614651f, 0.85711813f},
-std::array<float,2>{0.638752282f, 0.696037531f},
-std::array<float,2>{0.364723384f, 0.00750625972f},
-std::array<float,2>{0.518481016f, 0.231751055f},
-std::array<float,2>{0.490326673f, 0.538421154f},
-std::array<float,2>{0.758096278f, 0.983993351f},
-std::array<float,2>{0.0656309798f, 0.2873061f},
-std::array<float,2>{0.740792215f, 0.339319587f},
-std::array<float,2>{0.271194458f, 0.879806101f},
-std::array<float,2>{0.964596748f, 0.609146714f},
-std::array<float,2>{0.186688319f, 0.134962857f},
-std::array<float,2>{0.849459887f, 0.0795246735f},
-std::array<float,2>{0.0234563053f, 0.682495654f},
-std::array<float,2>{0.595738292f, 0.777457476f},
-std::array<float,2>{0.381670356f, 0.395078331f},
-std::array<float,2>{0.896592438f, 0.28913939f},
-std::array<float,2>{0.193085492f, 0.973163962f},
-std::array<float,2>{0.676812649f, 0.543980241f},
-std::array<float,2>{0.326580077f, 0.220191985f},
-std::array<float,2>{0.533233762f, 0.00882095937f},
-std::array<float,2>{0.449429214f, 0.689473212f},
-std::array<float,2>{0.809003174f, 0.847671151f},
-std::array<float,2>{0.10614378f, 0.456278741f},
-std::array<float,2>{0.705036998f, 0.402739346f},
-std::array<float,2>{0.291444659f, 0.772277653f},
-std::array<float,2>{0.992960095f, 0.674502134f},
-std::array<float,2>{0.142285526f, 0.0903233513f},
-std::array<float,2>{0.829580545f, 0.128136098f},
-std::array<float,2>{0.0373845287f, 0.59551239f},
-std::array<float,2>{0.592717588f, 0.884702325f},
-std::array<float,2>{0.433606625f, 0.330341667f},
-std::array<float,2>{0.754080236f, 0.475462526f},
-std::array<float,2>{0.0720672607f, 0.835651457f},
-std::array<float,2>{0.525838554f, 0.726592302f},
-std::array<float,2>{0.494028091f, 0.0326123834f},
-std::array<float,2>{0.62657398f, 0.215670392f},
-std::array<float,2>{0.370587617f, 0.514217317f},
-std::array<float,2>{0.929193795f, 0.966098011f},
-std::array<float,2>{0.245572776f, 0.278396785f},
-std::array<float,2>{0.606036603f, 0.359670848f},
-std::array<float,2>{0.386435747f, 0.927442849f},
-std::array<float,2>{0.854758441f, 0.581959248f},
-std::array<float,2>{0.0188704263f, 0.172094509f},
-std::array<float,2>{0.955661714f, 0.101416789f},
-std::array<float,2>{0.171954006f, 0.643806398f},
-std::array<float,2>{0.745805323f, 0.809134603f},
-std::array<float,2>{0.27363649f, 0.423893631f},
-std::array<float,2>{0.865967751f, 0.327338904f},
-std::array<float,2>{0.0046062246f, 0.897880018f},
-std::array<float,2>{0.622055352f, 0.621884942f},
-std::array<float,2>{0.393721849f, 0.14858754f},
-std::array<float,2>{0.724811733f, 0.0699964985f},
-std::array<float,2>{0.261611819f, 0.66775614f},
-std::array<float,2>{0.951848865f, 0.752175033f},
-std::array<float,2>{0.161969185f, 0.381591678f},
-std::array<float,2>{0.504376411f, 0.448260963f},
-std::array<float,2>{0.473181456f, 0.874245167f},
-std::array<float,2>{0.775313199f, 0.705212772f},
-std::array<float,2>{0.0818439126f, 0.0241400152f},
-std::array<float,2>{0.919592917f, 0.243378296f},
-std::array<float,2>{0.219993398f, 0.550232589f},
-std::array<float,2>{0.645808578f, 0.993156254f},
-std::array<float,2>{0.351380438f, 0.311858296f},
-std::array<float,2>{0.969067693f, 0.419667155f},
-std::array<float,2>{0.135206014f, 0.784427941f},
-std::array<float,2>{0.687713265f, 0.627185702f},
-std::array<float,2>{0.304496557f, 0.1173824f},
-std::array<float,2>{0.563684165f, 0.16429773f},
-std::array<float,2>{0.41277048f, 0.571442664f},
-std::array<float,2>{0.822448611f, 0.907808423f},
-std::array<float,2>{0.0532261692f, 0.348854244f},
-std::array<float,2>{0.667195976f, 0.257762104f},
-std::array<float,2>{0.337189585f, 0.93809253f},
-std::array<float,2>{0.878969908f, 0.517817736f},
-std::array<float,2>{0.216859862f, 0.197016299f},
-std::array<float,2>{0.793331802f, 0.0612513274f},
-std::array<float,2>{0.122311905f, 0.735451818f},
-std::array<float,2>{0.555831909f, 0.818378806f},
-std::array<float,2>{0.468390226f, 0.490561128f},
-std::array<float,2>{0.957751453f, 0.303766012f},
-std::array<float,2>{0.179282114f, 0.988055527f},
-std::array<float,2>{0.747512102f, 0.557795942f},
-std::array<float,2>{0.278773606f, 0.238886163f},
-std::array<float,2>{0.604869723f, 0.0186983291f},
-std::array<float,2>{0.390531182f, 0.71731478f},
-std::array<float,2>{0.858793497f, 0.86352092f},
-std::array<float,2>{0.0226369724f, 0.443243623f},
-std::array<float,2>{0.631182313f, 0.389401913f},
-std::array<float,2>{0.37409839f, 0.760078549f},
-std::array<float,2>{0.924218774f, 0.657591045f},
-std::array<float,2>{0.249968946f, 0.0762076974f},
-std::array<float,2>{0.751894116f, 0.141672373f},
-std::array<float,2>{0.0753724128f, 0.611692011f},
-std::array<float,2>{0.529672027f, 0.901178181f},
-std::array<float,2>{0.496249318f, 0.319094956f},
-std::array<float,2>{0.833954453f, 0.49908334f},
-std::array<float,2>{0.0314230546f, 0.826301336f},
-std::array<float,2>{0.588607311f, 0.742535949f},
-std::array<float,2>{0.432929665f, 0.0472558625f},
-std::array<float,2>{0.709548354f, 0.190048173f},
-std::array<float,2>{0.296121627f, 0.525850236f},
-std::array<float,2>{0.997130513f, 0.947042465f},
-std::array<float,2>{0.147241667f, 0.263146371f},
-std::array<float,2>{0.538642168f, 0.353584796f},
-std::array<float,2>{0.448353887f, 0.91861105f},
-std::array<float,2>{0.807040215f, 0.564927161f},
-std::array<float,2>{0.10379108f, 0.157863915f},
-std::array<float,2>{0.892261267f, 0.116735667f},
-std::array<float,2>{0.190408096f, 0.638024032f},
-std::array<float,2>{0.675174832f, 0.794419706f},
-std::array<float,2>{0.323762566f, 0.410721511f},
-std::array<float,2>{0.790864408f, 0.342489272f},
-std::array<float,2>{0.120758891f, 0.875709236f},
-std::array<float,2>{0.560577631f, 0.603439987f},
-std::array<float,2>{0.462050915f, 0.14060317f},
-std::array<float,2>{0.671820819f, 0.0820801333f},
-std::array<float,2>{0.341430694f, 0.686313808f},
-std::array<float,2>{0.878325343f, 0.773640513f},
-std::array<float,2>{0.211854026f, 0.391739994f},
-std::array<float,2>{0.566486955f, 0.467132509f},
-std::array<float,2>{0.410085589f, 0.85509944f},
-std::array<float,2>{0.826100111f, 0.701547444f},
-std::array<float,2>{0.048241064f, 0.00143702247f},
-std::array<float,2>{0.975182056f, 0.228233725f},
-std::array<float,2>{0.138863593f, 0.534897506f},
-std::array<float,2>{0.695300162f, 0.978309929f},
-std::array<float,2>{0.299365431f, 0.282701075f},
-std::array<float,2>{0.915090442f, 0.432857037f},
-std::array<float,2>{0.224640921f, 0.804373443f},
-std::array<float,2>{0.641375601f, 0.653281093f},
-std::array<float,2>{0.346967936f, 0.108520396f},
-std::array<float,2>{0.501717031f, 0.18714115f},
-std::array<float,2>{0.470925152f, 0.593334138f},
-std::array<float,2>{0.780344129f, 0.935853183f},
-std::array<float,2>{0.0833996385f, 0.37342906f},
-std::array<float,2>{0.719079971f, 0.267321944f},
-std::array<float,2>{0.262857407f, 0.954093277f},
-std::array<float,2>{0.946973026f, 0.507214427f},
-std::array<float,2>{0.159789488f, 0.20453468f},
-std::array<float,2>{0.860753775f, 0.0452163517f},
-std::array<float,2>{0.00301961065f, 0.721015453f},
-std::array<float,2>{0.61963439f, 0.841302097f},
-std::array<float,2>{0.395873219f, 0.477927566f},
-std::array<float,2>{0.889080882f, 0.364595324f},
-std::array<float,2>{0.208664715f, 0.925005674f},
-std::array<float,2>{0.661306918f, 0.584001958f},
-std::array<float,2>{0.331793666f, 0.176371977f},
-std::array<float,2>{0.552459955f, 0.0953771845f},
-std::array<float,2>{0.460193634f, 0.645546019f},
-std::array<float,2>{0.783337951f, 0.806268156f},
-std::array<float,2>{0.113920227f, 0.429479688f},
-std::array<float,2>{0.702452481f, 0.469313413f},
-std::array<float,2>{0.311666548f, 0.830637574f},
-std::array<float,2>{0.981402695f, 0.730944872f},
-std::array<float,2>{0.129589215f, 0.037234325f},
-std::array<float,2>{0.820189297f, 0.213977396f},
-std::array<float,2>{0.0619939417f, 0.508381724f},
-std::array<float,2>{0.576029003f, 0.963186443f},
-std::array<float,2>{0.42046091f, 0.273934573f},
-std::array<float,2>{0.772189677f, 0.40143463f},
-std::array<float,2>{0.0883695483f, 0.767491341f},
-std::array<float,2>{0.515355587f, 0.679225147f},
-std::array<float,2>{0.481410235f, 0.0863854811f},
-std::array<float,2>{0.651500285f, 0.132527381f},
-std::array<float,2>{0.357506156f, 0.598059416f},
-std::array<float,2>{0.906791985f, 0.887444377f},
-std::array<float,2>{0.230308399f, 0.335022777f},
-std::array<float,2>{0.615181863f, 0.296466291f},
-std::array<float,2>{0.405029237f, 0.969727755f},
-std::array<float,2>{0.868579924f, 0.542360663f},
-std::array<float,2>{0.0154356239f, 0.224170029f},
-std::array<float,2>{0.945056379f, 0.0123068355f},
-std::array<float,2>{0.17033793f, 0.694872499f},
-std::array<float,2>{0.733776987f, 0.846256316f},
-std::array<float,2>{0.25046438f, 0.460648656f},
-std::array<float,2>{0.847286999f, 0.250958562f},
-std::array<float,2>{0.0293953232f, 0.943759203f},
-std::array<float,2>{0.601454079f, 0.519762456f},
-std::array<float,2>{0.375203341f, 0.201306447f},
-std::array<float,2>{0.735975564f, 0.0548835881f},
-std::array<float,2>{0.267280668f, 0.739004493f},
-std::array<float,2>{0.966637969f, 0.813478291f},
-std::array<float,2>{0.180529311f, 0.487487495f},
-std::array<float,2>{0.522901714f, 0.417092323f},
-std::array<float,2>{0.487657517f, 0.785316348f},
-std::array<float,2>{0.763473928f, 0.632634521f},
-std::array<float,2>{0.0667981878f, 0.122525737f},
-std::array<float,2>{0.933328629f, 0.168324769f},
-std::array<float,2>{0.240361303f, 0.575024068f},
-std::array<float,2>{0.636276245f, 0.911470592f},
-std::array<float,2>{0.359983891f, 0.34434244f},
-std::array<float,2>{0.989672601f, 0.452910155f},
-std::array<float,2>{0.152605414f, 0.870826066f},
-std::array<float,2>{0.713410139f, 0.710687578f},
-std::array<float,2>{0.285767764f, 0.0294249207f},
-std::array<float,2>{0.584714234f, 0.246491805f},
-std::array<float,2>{0.423989743f, 0.554167569f},
-std::array<float,2>{0.836167753f, 0.997991323f},
-std::array<float,2>{0.0447310247f, 0.307711154f},
-std::array<float,2>{0.686552525f, 0.324133068f},
-std::array<float,2>{0.31516701f, 0.892849028f},
-std::array<float,2>{0.899916172f, 0.617978394f},
-std::array<float,2>{0.19575803f, 0.153606012f},
-std::array<float,2>{0.797980607f, 0.0626553819f},
-std::array<float,2>{0.0970389545f, 0.669149756f},
-std::array<float,2>{0.542982996f, 0.757008135f},
-std::array<float,2>{0.444255322f, 0.377415121f},
-std::array<float,2>{0.977726102f, 0.313600659f},
-std::array<float,2>{0.127827376f, 0.904313147f},
-std::array<float,2>{0.698307216f, 0.616774023f},
-std::array<float,2>{0.305254489f, 0.145587519f},
-std::array<float,2>{0.570656538f, 0.0733153746f},
-std::array<float,2>{0.416964948f, 0.661095738f},
-std::array<float,2>{0.812545538f, 0.763941228f},
-std::array<float,2>{0.0585328154f, 0.385065496f},
-std::array<float,2>{0.658682942f, 0.440109164f},
-std::array<float,2>{0.335273415f, 0.861313522f},
-std::array<float,2>{0.883483768f, 0.714629829f},
-std::array<float,2>{0.206901565f, 0.0196773876f},
-std::array<float,2>{0.786457956f, 0.237892359f},
-std::array<float,2>{0.112690099f, 0.560967624f},
-std::array<float,2>{0.5494923f, 0.991488159f},
-std::array<float,2>{0.453505307f, 0.300558776f},
-std::array<float,2>{0.872590303f, 0.409013659f},
-std::array<float,2>{0.00953478646f, 0.792577267f},
-std::array<float,2>{0.613218844f, 0.634090543f},
-std::array<float,2>{0.400134623f, 0.111771636f},
-std::array<float,2>{0.72963351f, 0.162021741f},
-std::array<float,2>{0.257332861f, 0.567800641f},
-std::array<float,2>{0.938308358f, 0.917054296f},
-std::array<float,2>{0.166832864f, 0.3561005f},
-std::array<float,2>{0.508697212f, 0.259416729f},
-std::array<float,2>{0.478668302f, 0.950799525f},
-std::array<float,2>{0.76711452f, 0.530160785f},
-std::array<float,2>{0.090828605f, 0.191604838f},
-std::array<float,2>{0.91190356f, 0.0515076295f},
-std::array<float,2>{0.231676757f, 0.746859491f},
-std::array<float,2>{0.653042078f, 0.82377106f},
-std::array<float,2>{0.353090346f, 0.492541373f},
-std::array<float,2>{0.76038003f, 0.28608197f},
-std::array<float,2>{0.0628787801f, 0.98055172f},
-std::array<float,2>{0.517365694f, 0.536093891f},
-std::array<float,2>{0.489561409f, 0.23376964f},
-std::array<float,2>{0.638038516f, 0.00428417465f},
-std::array<float,2>{0.36644724f, 0.698304534f},
-std::array<float,2>{0.933913946f, 0.858146906f},
-std::array<float,2>{0.236499295f, 0.464294761f},
-std::array<float,2>{0.594163716f, 0.398225665f},
-std::array<float,2>{0.379802138f, 0.780052125f},
-std::array<float,2>{0.850156784f, 0.681505084f},
-std::array<float,2>{0.0264046844f, 0.0818196535f},
-std::array<float,2>{0.962369442f, 0.133231357f},
-std::array<float,2>{0.183811933f, 0.606219351f},
-std::array<float,2>{0.739891887f, 0.882484972f},
-std::array<float,2>{0.272909343f, 0.337076664f},
-std::array<float,2>{0.905602753f, 0.483987749f},
-std::array<float,2>{0.199268982f, 0.839466035f},
-std::array<float,2>{0.683268368f, 0.723525226f},
-std::array<float,2>{0.319681764f, 0.0423819162f},
-std::array<float,2>{0.541991711f, 0.20746325f},
-std::array<float,2>{0.438741088f, 0.500486135f},
-std::array<float,2>{0.804486215f, 0.960875511f},
-std::array<float,2>{0.100232624f, 0.270128459f},
-std::array<float,2>{0.717467785f, 0.36819154f},
-std::array<float,2>{0.285090417f, 0.930997729f},
-std::array<float,2>{0.986530364f, 0.588629842f},
-std::array<float,2>{0.150940686f, 0.179885954f},
-std::array<float,2>{0.842976213f, 0.104584418f},
-std::array<float,2>{0.0423517413f, 0.650994301f},
-std::array<float,2>{0.580688655f, 0.798673928f},
-std::array<float,2>{0.426410109f, 0.434575111f},
-std::array<float,2>{0.926911533f, 0.279601127f},
-std::array<float,2>{0.242539763f, 0.967989087f},
-std::array<float,2>{0.627909482f, 0.513311982f},
-std::array<float,2>{0.367784292f, 0.217315987f},
-std::array<float,2>{0.523552716f, 0.0345641337f},
-std::array<float,2>{0.494881779f, 0.728657067f},
-std::array<float,2>{0.757239282f, 0.832525373f},
-std::array<float,2>{0.0727582797f, 0.474180609f},
-std::array<float,2>{0.74399215f, 0.422637194f},
-std::array<float,2>{0.277027458f, 0.812154949f},
-std::array<float,2>{0.953710377f, 0.641796589f},
-std::array<float,2>{0.173880622f, 0.098880671f},
-std::array<float,2>{0.853137374f, 0.174735665f},
-std::array<float,2>{0.0167489257f, 0.579098344f},
-std::array<float,2>{0.608620644f, 0.929681003f},
-std::array<float,2>{0.383217722f, 0.361742705f},
-std::array<float,2>{0.811814368f, 0.453986198f},
-std::array<float,2>{0.10754668f, 0.850336432f},
-std::array<float,2>{0.531949043f, 0.688702464f},
-std::array<float,2>{0.451772481f, 0.00978070404f},
-std::array<float,2>{0.67871201f, 0.222341284f},
-std::array<float,2>{0.325318515f, 0.546200216f},
-std::array<float,2>{0.895813227f, 0.975251615f},
-std::array<float,2>{0.193972811f, 0.29188627f},
-std::array<float,2>{0.591519177f, 0.329627246f},
-std::array<float,2>{0.436091721f, 0.885246217f},
-std::array<float,2>{0.831450045f, 0.597204566f},
-std::array<float,2>{0.0353326797f, 0.126582265f},
-std::array<float,2>{0.995784819f, 0.0933617577f},
-std::array<float,2>{0.142715275f, 0.67221874f},
-std::array<float,2>{0.70612818f, 0.769755483f},
-std::array<float,2>{0.290836006f, 0.406146944f},
-std::array<float,2>{0.82218051f, 0.349977195f},
-std::array<float,2>{0.051584933f, 0.90996933f},
-std::array<float,2>{0.565570772f, 0.574214458f},
-std::array<float,2>{0.410730392f, 0.16695863f},
-std::array<float,2>{0.690193355f, 0.120492637f},
-std::array<float,2>{0.3022753f, 0.626064003f},
-std::array<float,2>{0.972610056f, 0.783095062f},
-std::array<float,2>{0.133047253f, 0.420486897f},
-std::array<float,2>{0.556865394f, 0.489098042f},
-std::array<float,2>{0.464868456f, 0.81702894f},
-std::array<float,2>{0.795704603f, 0.738144219f},
-std::array<float,2>{0.12489064f, 0.0604254194f},
-std::array<float,2>{0.88243252f, 0.197399169f},
-std::array<float,2>{0.216103271f, 0.517559648f},
-std::array<float,2>{0.6654917f, 0.940894365f},
-std::array<float,2>{0.339682162f, 0.255822301f},
-std::array<float,2>{0.949592531f, 0.379088491f},
-std::array<float,2>{0.162373424f, 0.751808643f},
-std::array<float,2>{0.724170148f, 0.664647579f},
-std::array<float,2>{0.258652031f, 0.0680695176f},
-std::array<float,2>{0.624022722f, 0.151740119f},
-std::array<float,2>{0.392159134f, 0.62471509f},
-std::array<float,2>{0.864841282f, 0.894849837f},
-std::array<float,2>{0.006435927f, 0.325628072f},
-std::array<float,2>{0.647062778f, 0.310515165f},
-std::array<float,2>{0.348308027f, 0.995357394f},
-std::array<float,2>{0.921193123f, 0.548314571f},
-std::array<float,2>{0.221502513f, 0.245820895f},
-std::array<float,2>{0.776884019f, 0.0258068778f},
-std::array<float,2>{0.079776749f, 0.703649223f},
-std::array<float,2>{0.506954253f, 0.872381091f},
-std::array<float,2>{0.475045145f, 0.445770532f},
-std::array<float,2>{0.974382222f, 0.281374663f},
-std::array<float,2>{0.137851253f, 0.976951003f},
-std::array<float,2>{0.693279088f, 0.533687472f},
-std::array<float,2>{0.297609389f, 0.226973087f},
-std::array<float,2>{0.569935977f, 0.000394937961f},
-std::array<float,2>{0.40793258f, 0.702642024f},
-std::array<float,2>{0.826818109f, 0.853916705f},
-std::array<float,2>{0.0494619571f, 0.468165457f},
-std::array<float,2>{0.66882664f, 0.390914172f},
-std::array<float,2>{0.343059003f, 0.774967909f},
-std::array<float,2>{0.876342714f, 0.686727405f},
-std::array<float,2>{0.214391202f, 0.0833527669f},
-std::array<float,2>{0.791092634f, 0.139173403f},
-std::array<float,2>{0.118908614f, 0.601988494f},
-std::array<float,2>{0.559770226f, 0.876547158f},
-std::array<float,2>{0.464540809f, 0.343028069f},
-std::array<float,2>{0.862483561f, 0.476765573f},
-std::array<float,2>{0.00104757911f, 0.840198517f},
-std::array<float,2>{0.618677855f, 0.72230196f},
-std::array<float,2>{0.398127019f, 0.0466428287f},
-std::array<float,2>{0.722580433f, 0.203496486f},
-std::array<float,2>{0.265156627f, 0.50683409f},
-std::array<float,2>{0.949084342f, 0.954483151f},
-std::array<float,2>{0.156867281f, 0.266505182f},
-std::array<float,2>{0.503194034f, 0.374285936f},
-std::array<float,2>{0.469769925f, 0.936951399f},
-std::array<float,2>{0.777797282f, 0.591932416f},
-std::array<float,2>{0.0845364705f, 0.186105624f},
-std::array<float,2>{0.916209817f, 0.108331405f},
-std::array<float,2>{0.224336818f, 0.653638065f},
-std::array<float,2>{0.643595099f, 0.803152025f},
-std::array<float,2>{0.344855756f, 0.432577252f},
-std::array<float,2>{0.752614915f, 0.319903016f},
-std::array<float,2>{0.0776444897f, 0.901816308f},
-std::array<float,2>{0.528474987f, 0.612977505f},
-std::array<float,2>{0.499303907f, 0.141381755f},
-std::array<float,2>{0.629433513f, 0.0776055753f},
-std::array<float,2>{0.372608751f, 0.656625271f},
-std::array<float,2>{0.922021449f, 0.760995328f},
-std::array<float,2>{0.247337952f, 0.390512943f},
-std::array<float,2>{0.602852643f, 0.442263752f},
-std::array<float,2>{0.387883455f, 0.864810944f},
-std::array<float,2>{0.855809927f, 0.718623281f},
-std::array<float,2>{0.020318782f, 0.0176577494f},
-std::array<float,2>{0.960035563f, 0.239666f},
-std::array<float,2>{0.177044794f, 0.557131708f},
-std::array<float,2>{0.749217212f, 0.986978114f},
-std::array<float,2>{0.280957788f, 0.302880406f},
-std::array<float,2>{0.893872797f, 0.411903709f},
-std::array<float,2>{0.189115942f, 0.792974949f},
-std::array<float,2>{0.673400342f, 0.637072563f},
-std::array<float,2>{0.321133882f, 0.115479939f},
-std::array<float,2>{0.535808861f, 0.15639773f},
-std::array<float,2>{0.445680737f, 0.566349506f},
-std::array<float,2>{0.8064273f, 0.919772685f},
-std::array<float,2>{0.103279836f, 0.354815543f},
-std::array<float,2>{0.708272517f, 0.261993766f},
-std::array<float,2>{0.293969601f, 0.945959032f},
-std::array<float,2>{0.999584854f, 0.527057171f},
-std::array<float,2>{0.145494819f, 0.190890625f},
-std::array<float,2>{0.834096849f, 0.048711095f},
-std::array<float,2>{0.035050977f, 0.743387043f},
-std::array<float,2>{0.587223351f, 0.82720834f},
-std::array<float,2>{0.431303352f, 0.498748749f},
-std::array<float,2>{0.931447268f, 0.345432103f},
-std::array<float,2>{0.239132777f, 0.910239398f},
-std::array<float,2>{0.63337189f, 0.575537026f},
-std::array<float,2>{0.362050921f, 0.16939643f},
-std::array<float,2>{0.520012498f, 0.121379904f},
-std::array<float,2>{0.484769493f, 0.631403267f},
-std::array<float,2>{0.764903307f, 0.786327779f},
-std::array<float,2>{0.0692332983f, 0.416814625f},
-std::array<float,2>{0.737378597f, 0.487299562f},
-std::array<float,2>{0.268482506f, 0.813243032f},
-std::array<float,2>{0.96712023f, 0.740187585f},
-std::array<float,2>{0.182299405f, 0.0561399907f},
-std::array<float,2>{0.844124138f, 0.202365622f},
-std::array<float,2>{0.0291139055f, 0.521168768f},
-std::array<float,2>{0.597926974f, 0.945308626f},
-std::array<float,2>{0.377599061f, 0.251271188f},
-std::array<float,2>{0.800293803f, 0.378223121f},
-std::array<float,2>{0.0939673707f, 0.756290793f},
-std::array<float,2>{0.545770466f, 0.668129683f},
-std::array<float,2>{0.442599177f, 0.0639636219f},
-std::array<float,2>{0.683631837f, 0.152494863f},
-std::array<float,2>{0.314048499f, 0.619065464f},
-std::array<float,2>{0.901936412f, 0.89419812f},
-std::array<float,2>{0.199109957f, 0.323078871f},
-std::array<float,2>{0.583423615f, 0.307174981f},
-std::array<float,2>{0.422292292f, 0.996522248f},
-std::array<float,2>{0.838867962f, 0.552974105f},
-std::array<float,2>{0.0464046635f, 0.247826144f},
-std::array<float,2>{0.99073422f, 0.0311082415f},
-std::array<float,2>{0.155861616f, 0.709095955f},
-std::array<float,2>{0.711317778f, 0.870047748f},
-std::array<float,2>{0.287986815f, 0.451890409f},
-std::array<float,2>{0.817482948f, 0.275331855f},
-std::array<float,2>{0.0599672273f, 0.963962138f},
-std::array<float,2>{0.576395512f, 0.509617269f},
-std::array<float,2>{0.419378906f, 0.213342547f},
-std::array<float,2>{0.699553013f, 0.0385569632f},
-std::array<float,2>{0.310435802f, 0.731801093f},
-std::array<float,2>{0.982606232f, 0.831830323f},
-std::array<float,2>{0.131813601f, 0.469786704f},
-std::array<float,2>{0.554034591f, 0.428545445f},
-std::array<float,2>{0.457939029f, 0.805226207f},
-std::array<float,2>{0.782597721f, 0.64484489f},
-std::array<float,2>{0.117071874f, 0.0938988701f},
-std::array<float,2>{0.887319386f, 0.177605525f},
-std::array<float,2>{0.209556296f, 0.585493684f},
-std::array<float,2>{0.662351429f, 0.924657226f},
-std::array<float,2>{0.328445196f, 0.363307863f},
-std::array<float,2>{0.941503227f, 0.459432214f},
-std::array<float,2>{0.168471396f, 0.847238898f},
-std::array<float,2>{0.731080592f, 0.693540514f},
-std::array<float,2>{0.252478302f, 0.0128704458f},
-std::array<float,2>{0.616290987f, 0.222952813f},
-std::array<float,2>{0.40252924f, 0.541480184f},
-std::array<float,2>{0.870750129f, 0.969359398f},
-std::array<float,2>{0.0124819465f, 0.295072973f},
-std::array<float,2>{0.648445666f, 0.334851474f},
-std::array<float,2>{0.357184321f, 0.888183177f},
-std::array<float,2>{0.908725142f, 0.599122226f},
-std::array<float,2>{0.227368951f, 0.131730929f},
-std::array<float,2>{0.77099359f, 0.0876965225f},
-std::array<float,2>{0.0874553546f, 0.678669155f},
-std::array<float,2>{0.513390779f, 0.766046882f},
-std::array<float,2>{0.483034879f, 0.400398016f},
-std::array<float,2>{0.963681519f, 0.336594284f},
-std::array<float,2>{0.185747966f, 0.881056845f},
-std::array<float,2>{0.741295576f, 0.606524527f},
-std::array<float,2>{0.270019352f, 0.134040669f},
-std::array<float,2>{0.597456872f, 0.0804209411f},
-std::array<float,2>{0.382429928f, 0.68021208f},
-std::array<float,2>{0.848409772f, 0.780511081f},
-std::array<float,2>{0.0253353138f, 0.396797627f},
-std::array<float,2>{0.63983953f, 0.463583529f},
-std::array<float,2>{0.363509625f, 0.858684957f},
-std::array<float,2>{0.936347604f, 0.697415233f},
-std::array<float,2>{0.234517053f, 0.00526851229f},
-std::array<float,2>{0.759228528f, 0.232492149f},
-std::array<float,2>{0.0652715415f, 0.536518455f},
-std::array<float,2>{0.519008458f, 0.981930852f},
-std::array<float,2>{0.49217391f, 0.286602944f},
-std::array<float,2>{0.840875745f, 0.434443504f},
-std::array<float,2>{0.0405085906f, 0.797101319f},
-std::array<float,2>{0.578199446f, 0.651863873f},
-std::array<float,2>{0.428545654f, 0.103687197f},
-std::array<float,2>{0.715598047f, 0.181332201f},
-std::array<float,2>{0.281764239f, 0.589347482f},
-std::array<float,2>{0.985507905f, 0.929956675f},
-std::array<float,2>{0.148625284f, 0.367752492f},
-std::array<float,2>{0.54050529f, 0.2708399f},
-std::array<float,2>{0.441308796f, 0.959296763f},
-std::array<float,2>{0.800930083f, 0.501066089f},
-std::array<float,2>{0.0990152135f, 0.208033174f},
-std::array<float,2>{0.902981162f, 0.0417049266f},
-std::array<float,2>{0.201737061f, 0.72397542f},
-std::array<float,2>{0.681340098f, 0.837963462f},
-std::array<float,2>{0.317720383f, 0.482442975f},
-std::array<float,2>{0.788231194f, 0.299243361f},
-std::array<float,2>{0.110145822f, 0.991054714f},
-std::array<float,2>{0.548470855f, 0.56230092f},
-std::array<float,2>{0.455111325f, 0.236808345f},
-std::array<float,2>{0.656257987f, 0.0208679419f},
-std::array<float,2>{0.332364827f, 0.713238299f},
-std::array<float,2>{0.886251807f, 0.859855056f},
-std::array<float,2>{0.20328626f, 0.440433085f},
-std::array<float,2>{0.57237637f, 0.386450917f},
-std::array<float,2>{0.414163888f, 0.765507579f},
-std::array<float,2>{0.815077066f, 0.6619941f},
-std::array<float,2>{0.055788625f, 0.0725189149f},
-std::array<float,2>{0.98035717f, 0.145016059f},
-std::array<float,2>{0.125320956f, 0.615851104f},
-std::array<float,2>{0.697018981f, 0.905818522f},
-std::array<float,2>{0.308278382f, 0.312537879f},
-std::array<float,2>{0.912515044f, 0.493399262f},
-std::array<float,2>{0.233479276f, 0.82308346f},
-std::array<float,2>{0.654639423f, 0.747080982f},
-std::array<float,2>{0.353948087f, 0.0519546159f},
-std::array<float,2>{0.511194825f, 0.192395672f},
-std::array<float,2>{0.478077233f, 0.530597448f},
-std::array<float,2>{0.768192172f, 0.949580669f},
-std::array<float,2>{0.0927737802f, 0.257963568f},
-std::array<float,2>{0.728358448f, 0.356905073f},
-std::array<float,2>{0.254474282f, 0.916717708f},
-std::array<float,2>{0.940026224f, 0.566679239f},
-std::array<float,2>{0.165370479f, 0.161129296f},
-std::array<float,2>{0.874831915f, 0.11298053f},
-std::array<float,2>{0.010349567f, 0.633340955f},
-std::array<float,2>{0.609961092f, 0.791033864f},
-std::array<float,2>{0.401576728f, 0.409885347f},
-std::array<float,2>{0.880315125f, 0.25470677f},
-std::array<float,2>{0.218235433f, 0.940176189f},
-std::array<float,2>{0.666480482f, 0.516168416f},
-std::array<float,2>{0.336504459f, 0.19842796f},
-std::array<float,2>{0.555642009f, 0.0591583513f},
-std::array<float,2>{0.467319131f, 0.736463606f},
-std::array<float,2>{0.793975532f, 0.818214774f},
-std::array<float,2>{0.121950366f, 0.489830554f},
-std::array<float,2>{0.688989937f, 0.421497226f},
-std::array<float,2>{0.303663015f, 0.781943977f},
-std::array<float,2>{0.970121741f, 0.625756502f},
-std::array<float,2>{0.136472657f, 0.119234286f},
-std::array<float,2>{0.823691726f, 0.167248026f},
-std::array<float,2>{0.0543279313f, 0.572596967f},
-std::array<float,2>{0.563276768f, 0.908658504f},
-std::array<float,2>{0.413901567f, 0.350930929f},
-std::array<float,2>{0.774392784f, 0.446650088f},
-std::array<float,2>{0.080757536f, 0.871303856f},
-std::array<float,2>{0.504909813f, 0.705068171f},
-std::array<float,2>{0.474444032f, 0.0272571351f},
-std::array<float,2>{0.644801974f, 0.24479942f},
-std::array<float,2>{0.350210994f, 0.54695487f},
-std::array<float,2>{0.918226898f, 0.994290233f},
-std::array<float,2>{0.219308525f, 0.308671117f},
-std::array<float,2>{0.622694671f, 0.324644178f},
-std::array<float,2>{0.392908424f, 0.895821273f},
-std::array<float,2>{0.86716646f, 0.623688638f},
-std::array<float,2>{0.00543561578f, 0.15055795f},
-std::array<float,2>{0.952343762f, 0.0669137686f},
-std::array<float,2>{0.160929948f, 0.66516906f},
-std::array<float,2>{0.726255596f, 0.750343978f},
-std::array<float,2>{0.260524899f, 0.379975379f},
-std::array<float,2>{0.854187012f, 0.36294198f},
-std::array<float,2>{0.0181567222f, 0.92821455f},
-std::array<float,2>{0.606685579f, 0.579388261f},
-std::array<float,2>{0.385054022f, 0.175540999f},
-std::array<float,2>{0.744998991f, 0.0979112387f},
-std::array<float,2>{0.275271654f, 0.64142549f},
-std::array<float,2>{0.956467092f, 0.810767412f},
-std::array<float,2>{0.173198119f, 0.423573673f},
-std::array<float,2>{0.527262926f, 0.473071247f},
-std::array<float,2>{0.492220461f, 0.833935082f},
-std::array<float,2>{0.755660415f, 0.730181694f},
-std::array<float,2>{0.070958361f, 0.0339100733f},
-std::array<float,2>{0.928436995f, 0.217808202f},
-std::array<float,2>{0.244658113f, 0.511765897f},
-std::array<float,2>{0.625910759f, 0.967250288f},
-std::array<float,2>{0.369694591f, 0.281200767f},
-std::array<float,2>{0.99376291f, 0.404373974f},
-std::array<float,2>{0.141289681f, 0.77057749f},
-std::array<float,2>{0.703413725f, 0.673723757f},
-std::array<float,2>{0.292462796f, 0.0920539945f},
-std::array<float,2>{0.593212724f, 0.125791192f},
-std::array<float,2>{0.435211122f, 0.595737576f},
-std::array<float,2>{0.8285321f, 0.886211455f},
-std::array<float,2>{0.0382037498f, 0.329003543f},
-std::array<float,2>{0.675970316f, 0.292633086f},
-std::array<float,2>{0.327803016f, 0.976482034f},
-std::array<float,2>{0.897699177f, 0.545649588f},
-std::array<float,2>{0.192209259f, 0.221340209f},
-std::array<float,2>{0.810495853f, 0.0117132375f},
-std::array<float,2>{0.107140921f, 0.68813473f},
-std::array<float,2>{0.534401357f, 0.850854099f},
-std::array<float,2>{0.45065701f, 0.454567254f},
-std::array<float,2>{0.945600271f, 0.269437253f},
-std::array<float,2>{0.159089953f, 0.955685377f},
-std::array<float,2>{0.720490038f, 0.50441587f},
-std::array<float,2>{0.262119293f, 0.20572567f},
-std::array<float,2>{0.620336056f, 0.0432311632f},
-std::array<float,2>{0.395329356f, 0.720365167f},
-std::array<float,2>{0.859878004f, 0.843722463f},
-std::array<float,2>{0.00260399887f, 0.480090141f},
-std::array<float,2>{0.64239502f, 0.430832893f},
-std::array<float,2>{0.346355766f, 0.80233717f},
-std::array<float,2>{0.914398193f, 0.655837715f},
-std::array<float,2>{0.226088166f, 0.106710464f},
-std::array<float,2>{0.779297113f, 0.185299024f},
-std::array<float,2>{0.0826668888f, 0.590652108f},
-std::array<float,2>{0.500745416f, 0.93467766f},
-std::array<float,2>{0.472651303f, 0.372892499f},
-std::array<float,2>{0.824560463f, 0.466091633f},
-std::array<float,2>{0.0477561764f, 0.853464186f},
-std::array<float,2>{0.567892671f, 0.700799704f},
-std::array<float,2>{0.408616632f, 0.00305212033f},
-std::array<float,2>{0.693380296f, 0.229712188f},
-std::array<float,2>{0.300617963f, 0.53164053f},
-std::array<float,2>{0.976337433f, 0.978771687f},
-std::array<float,2>{0.140187815f, 0.284852326f},
-std::array<float,2>{0.561888278f, 0.340124875f},
-std::array<float,2>{0.461110115f, 0.877583802f},
-std::array<float,2>{0.789105713f, 0.604448497f},
-std::array<float,2>{0.119924188f, 0.136838466f},
-std::array<float,2>{0.877450705f, 0.0851257369f},
-std::array<float,2>{0.212047517f, 0.683756411f},
-std::array<float,2>{0.670296967f, 0.776351869f},
-std::array<float,2>{0.34044385f, 0.393472105f},
-std::array<float,2>{0.807634234f, 0.35327822f},
-std::array<float,2>{0.104773425f, 0.921278119f},
-std::array<float,2>{0.537236392f, 0.563661873f},
-std::array<float,2>{0.448167741f, 0.159435272f},
-std::array<float,2>{0.674144447f, 0.114852361f},
-std::array<float,2>{0.322298318f, 0.639520884f},
-std::array<float,2>{0.890765369f, 0.796812654f},
-std::array<float,2>{0.191338584f, 0.413138181f},
-std::array<float,2>{0.589444518f, 0.496904969f},
-std::array<float,2>{0.432483077f, 0.825451314f},
-std::array<float,2>{0.832162201f, 0.745862544f},
-std::array<float,2>{0.0325050279f, 0.0490671322f},
-std::array<float,2>{0.996352792f, 0.188252524f},
-std::array<float,2>{0.147502631f, 0.523940802f},
-std::array<float,2>{0.710595369f, 0.947336853f},
-std::array<float,2>{0.295510411f, 0.263863534f},
-std::array<float,2>{0.925383866f, 0.387143701f},
-std::array<float,2>{0.248719499f, 0.758080602f},
-std::array<float,2>{0.631865203f, 0.658838153f},
-std::array<float,2>{0.373795658f, 0.0754429027f},
-std::array<float,2>{0.530306518f, 0.142956406f},
-std::array<float,2>{0.497336209f, 0.610173762f},
-std::array<float,2>{0.750295997f, 0.900036275f},
-std::array<float,2>{0.0746831372f, 0.316420645f},
-std::array<float,2>{0.746654689f, 0.301684946f},
-std::array<float,2>{0.277419478f, 0.985077918f},
-std::array<float,2>{0.958293319f, 0.556222498f},
-std::array<float,2>{0.178527519f, 0.24170284f},
-std::array<float,2>{0.858273149f, 0.016580075f},
-std::array<float,2>{0.0222994275f, 0.715065002f},
-std::array<float,2>{0.603686988f, 0.865425467f},
-std::array<float,2>{0.3895078f, 0.444910437f},
-std::array<float,2>{0.898482084f, 0.321645856f},
-std::array<float,2>{0.197028294f, 0.890786588f},
-std::array<float,2>{0.68555373f, 0.620741189f},
-std::array<float,2>{0.316057712f, 0.154541999f},
-std::array<float,2>{0.544905186f, 0.0650969148f},
-std::array<float,2>{0.445006013f, 0.670866489f},
-std::array<float,2>{0.797395229f, 0.754152596f},
-std::array<float,2>{0.0965286568f, 0.375294149f},
-std::array<float,2>{0.714262843f, 0.449778527f},
-std::array<float,2>{0.286752641f, 0.867226899f},
-std::array<float,2>{0.989041924f, 0.707648337f},
-std::array<float,2>{0.154130012f, 0.0277503971f},
-std::array<float,2>{0.837592363f, 0.249942258f},
-std::array<float,2>{0.043791119f, 0.551020145f},
-std::array<float,2>{0.58513248f, 0.999090493f},
-std::array<float,2>{0.425500363f, 0.306084126f},
-std::array<float,2>{0.762667537f, 0.414395958f},
-std::array<float,2>{0.067948103f, 0.7885499f},
-std::array<float,2>{0.522038102f, 0.630726159f},
-std::array<float,2>{0.486955673f, 0.12492343f},
-std::array<float,2>{0.635016263f, 0.171308815f},
-std::array<float,2>{0.361091256f, 0.577201843f},
-std::array<float,2>{0.932525992f, 0.913268387f},
-std::array<float,2>{0.241274968f, 0.347160012f},
-std::array<float,2>{0.599736333f, 0.252229244f},
-std::array<float,2>{0.376728296f, 0.94302237f},
-std::array<float,2>{0.845929146f, 0.522235215f},
-std::array<float,2>{0.031135112f, 0.200394914f},
-std::array<float,2>{0.965594828f, 0.0580139235f},
-std::array<float,2>{0.181415498f, 0.741262317f},
-std::array<float,2>{0.735085905f, 0.81466639f},
-std::array<float,2>{0.26602003f, 0.486204326f},
-std::array<float,2>{0.868087649f, 0.294088304f},
-std::array<float,2>{0.0145566482f, 0.972407818f},
-std::array<float,2>{0.613403797f, 0.540758848f},
-std::array<float,2>{0.405925244f, 0.226456523f},
-std::array<float,2>{0.732897341f, 0.0153102269f},
-std::array<float,2>{0.25176245f, 0.693351626f},
-std::array<float,2>{0.944224834f, 0.845199943f},
-std::array<float,2>{0.171473637f, 0.458002895f},
-std::array<float,2>{0.514400005f, 0.39945516f},
-std::array<float,2>{0.48189941f, 0.768796146f},
-std::array<float,2>{0.772752583f, 0.676878214f},
-std::array<float,2>{0.0894802287f, 0.0879736096f},
-std::array<float,2>{0.907939136f, 0.128957734f},
-std::array<float,2>{0.229027256f, 0.600537837f},
-std::array<float,2>{0.651122451f, 0.890276313f},
-std::array<float,2>{0.35889101f, 0.333137035f},
-std::array<float,2>{0.982219577f, 0.471334726f},
-std::array<float,2>{0.130762517f, 0.829155266f},
-std::array<float,2>{0.701172829f, 0.733783841f},
-std::array<float,2>{0.310781986f, 0.0362555049f},
-std::array<float,2>{0.574647725f, 0.212122962f},
-std::array<float,2>{0.420917004f, 0.51158011f},
-std::array<float,2>{0.818517089f, 0.96139431f},
-std::array<float,2>{0.0606140383f, 0.275430709f},
-std::array<float,2>{0.66060847f, 0.365545303f},
-std::array<float,2>{0.330411494f, 0.922363698f},
-std::array<float,2>{0.890289128f, 0.582577169f},
-std::array<float,2>{0.207478598f, 0.179564178f},
-std::array<float,2>{0.784209371f, 0.0965114534f},
-std::array<float,2>{0.115227208f, 0.647543132f},
-std::array<float,2>{0.550805569f, 0.80783695f},
-std::array<float,2>{0.459190398f, 0.426061213f},
-std::array<float,2>{0.98795259f, 0.37054798f},
-std::array<float,2>{0.1518417f, 0.931642354f},
-std::array<float,2>{0.718516111f, 0.587804377f},
-std::array<float,2>{0.283760846f, 0.181839868f},
-std::array<float,2>{0.581917346f, 0.101653859f},
-std::array<float,2>{0.427062601f, 0.649981439f},
-std::array<float,2>{0.842704952f, 0.799032509f},
-std::array<float,2>{0.0413058214f, 0.436124563f},
-std::array<float,2>{0.682326615f, 0.480741769f},
-std::array<float,2>{0.318625361f, 0.837348223f},
-std::array<float,2>{0.904296875f, 0.72468549f},
-std::array<float,2>{0.201061562f, 0.0405152068f},
-std::array<float,2>{0.803185523f, 0.210414588f},
-std::array<float,2>{0.100641839f, 0.502438366f},
-std::array<float,2>{0.542775452f, 0.958160341f},
-std::array<float,2>{0.438150913f, 0.272265583f},
-std::array<float,2>{0.851322293f, 0.396458745f},
-std::array<float,2>{0.0256653503f, 0.778789997f},
-std::array<float,2>{0.594909847f, 0.682748258f},
-std::array<float,2>{0.380831718f, 0.0784289762f},
-std::array<float,2>{0.738616705f, 0.136052027f},
-std::array<float,2>{0.271843076f, 0.607884049f},
-std::array<float,2>{0.961315215f, 0.880157351f},
-std::array<float,2>{0.184709683f, 0.338001907f},
-std::array<float,2>{0.515691876f, 0.288349062f},
-std::array<float,2>{0.488426f, 0.983181596f},
-std::array<float,2>{0.76121366f, 0.537726223f},
-std::array<float,2>{0.0639405921f, 0.230717495f},
-std::array<float,2>{0.93524915f, 0.0066779824f},
-std::array<float,2>{0.237817794f, 0.697166085f},
-std::array<float,2>{0.637643635f, 0.856051683f},
-std::array<float,2>{0.366025984f, 0.461118668f},
-std::array<float,2>{0.765725076f, 0.259972155f},
-std::array<float,2>{0.090091303f, 0.951529443f},
-std::array<float,2>{0.509559393f, 0.527793169f},
-std::array<float,2>{0.480217159f, 0.195074081f},
-std::array<float,2>{0.653711021f, 0.0546359792f},
-std::array<float,2>{0.351627171f, 0.748748541f},
-std::array<float,2>{0.910460651f, 0.821091712f},
-std::array<float,2>{0.23101151f, 0.495873809f},
-std::array<float,2>{0.611622274f, 0.407811582f},
-std::array<float,2>{0.398614556f, 0.789404571f},
-std::array<float,2>{0.871694982f, 0.636220634f},
-std::array<float,2>{0.0079216687f, 0.110744044f},
-std::array<float,2>{0.939234853f, 0.163681805f},
-std::array<float,2>{0.167047322f, 0.569667339f},
-std::array<float,2>{0.729040027f, 0.915730298f},
-std::array<float,2>{0.255933106f, 0.359129697f},
-std::array<float,2>{0.883990407f, 0.438295662f},
-std::array<float,2>{0.205243275f, 0.862316132f},
-std::array<float,2>{0.66001761f, 0.712234974f},
-std::array<float,2>{0.333997786f, 0.0217860844f},
-std::array<float,2>{0.550778806f, 0.236109704f},
-std::array<float,2>{0.454386592f, 0.559795499f},
-std::array<float,2>{0.785559714f, 0.989104152f},
-std::array<float,2>{0.111941703f, 0.298721343f},
-std::array<float,2>{0.697308123f, 0.316149265f},
-std::array<float,2>{0.306599557f, 0.902664244f},
-std::array<float,2>{0.976696074f, 0.615032315f},
-std::array<float,2>{0.128146484f, 0.147947386f},
-std::array<float,2>{0.813733578f, 0.0717832223f},
-std::array<float,2>{0.0570961609f, 0.663037002f},
-std::array<float,2>{0.57226038f, 0.762586832f},
-std::array<float,2>{0.417964429f, 0.383537114f},
-std::array<float,2>{0.920594215f, 0.310865104f},
-std::array<float,2>{0.222270578f, 0.994004965f},
-std::array<float,2>{0.648042321f, 0.549459159f},
-std::array<float,2>{0.348730147f, 0.24244079f},
-std::array<float,2>{0.506035447f, 0.0250128657f},
-std::array<float,2>{0.476215422f, 0.706340313f},
-std::array<float,2>{0.775912344f, 0.873333991f},
-std::array<float,2>{0.0787309483f, 0.447288394f},
-std::array<float,2>{0.723246813f, 0.382494628f},
-std::array<float,2>{0.25924468f, 0.753430367f},
-std::array<float,2>{0.950435936f, 0.666877985f},
-std::array<float,2>{0.163253739f, 0.0686444789f},
-std::array<float,2>{0.863812447f, 0.149734691f},
-std::array<float,2>{0.00685010944f, 0.622438073f},
-std::array<float,2>{0.624031067f, 0.896761656f},
-std::array<float,2>{0.390789926f, 0.326393694f},
-std::array<float,2>{0.796635985f, 0.491871923f},
-std::array<float,2>{0.123882622f, 0.820158362f},
-std::array<float,2>{0.558057785f, 0.735166371f},
-std::array<float,2>{0.466437399f, 0.0616953671f},
-std::array<float,2>{0.664418101f, 0.196155056f},
-std::array<float,2>{0.338535279f, 0.51863122f},
-std::array<float,2>{0.881453633f, 0.938928366f},
-std::array<float,2>{0.215480521f, 0.256416947f},
-std::array<float,2>{0.564716697f, 0.348153591f},
-std::array<float,2>{0.411364466f, 0.907145321f},
-std::array<float,2>{0.820853829f, 0.570650756f},
-std::array<float,2>{0.0526253805f, 0.165481955f},
-std::array<float,2>{0.9714849f, 0.118502118f},
-std::array<float,2>{0.134705707f, 0.627938032f},
-std::array<float,2>{0.690867841f, 0.783416331f},
-std::array<float,2>{0.301121771f, 0.418677837f},
-std::array<float,2>{0.830660641f, 0.331433117f},
-std::array<float,2>{0.0368311666f, 0.882906079f},
-std::array<float,2>{0.590431511f, 0.594543099f},
-std::array<float,2>{0.437208802f, 0.127756462f},
-std::array<float,2>{0.705562353f, 0.0909141153f},
-std::array<float,2>{0.289359778f, 0.675639093f},
-std::array<float,2>{0.994627953f, 0.773148596f},
-std::array<float,2>{0.144169554f, 0.404013544f},
-std::array<float,2>{0.532696605f, 0.455929667f},
-std::array<float,2>{0.452740967f, 0.849029422f},
-std::array<float,2>{0.811500788f, 0.69081229f},
-std::array<float,2>{0.109135352f, 0.00820110738f},
-std::array<float,2>{0.894603968f, 0.218757078f},
-std::array<float,2>{0.195288345f, 0.543024421f},
-std::array<float,2>{0.677751482f, 0.974224329f},
-std::array<float,2>{0.324877888f, 0.290125519f},
-std::array<float,2>{0.954456925f, 0.425442815f},
-std::array<float,2>{0.175166801f, 0.810018063f},
-std::array<float,2>{0.742404759f, 0.642921567f},
-std::array<float,2>{0.276169598f, 0.100428127f},
-std::array<float,2>{0.607557297f, 0.173720643f},
-std::array<float,2>{0.384304792f, 0.580678821f},
-std::array<float,2>{0.852009952f, 0.925820589f},
-std::array<float,2>{0.0165260173f, 0.360597849f},
-std::array<float,2>{0.628803432f, 0.277710617f},
-std::array<float,2>{0.368725836f, 0.965682328f},
-std::array<float,2>{0.92657733f, 0.515329123f},
-std::array<float,2>{0.24336794f, 0.216032669f},
-std::array<float,2>{0.756137908f, 0.0319801643f},
-std::array<float,2>{0.0735400841f, 0.727972746f},
-std::array<float,2>{0.524483621f, 0.834327996f},
-std::array<float,2>{0.495382726f, 0.475866884f},
-std::array<float,2>{0.983395696f, 0.276175469f},
-std::array<float,2>{0.130867258f, 0.961713314f},
-std::array<float,2>{0.699823022f, 0.511112869f},
-std::array<float,2>{0.310015023f, 0.21269986f},
-std::array<float,2>{0.57691741f, 0.0366990082f},
-std::array<float,2>{0.419835627f, 0.734175086f},
-std::array<float,2>{0.818228185f, 0.829863846f},
-std::array<float,2>{0.0604623631f, 0.470802158f},
-std::array<float,2>{0.662804127f, 0.426415771f},
-std::array<float,2>{0.328754187f, 0.808443785f},
-std::array<float,2>{0.887200654f, 0.648157001f},
-std::array<float,2>{0.20945245f, 0.0961807221f},
-std::array<float,2>{0.783078194f, 0.178975359f},
-std::array<float,2>{0.116400056f, 0.582264423f},
-std::array<float,2>{0.554243505f, 0.922094882f},
-std::array<float,2>{0.457366943f, 0.366141319f},
-std::array<float,2>{0.870393157f, 0.457100928f},
-std::array<float,2>{0.0118293902f, 0.845421076f},
-std::array<float,2>{0.617068589f, 0.692685604f},
-std::array<float,2>{0.403034478f, 0.0148600396f},
-std::array<float,2>{0.730749726f, 0.225724086f},
-std::array<float,2>{0.252040565f, 0.540279448f},
-std::array<float,2>{0.941981554f, 0.971925259f},
-std::array<float,2>{0.168137118f, 0.294847995f},
-std::array<float,2>{0.512791634f, 0.333904684f},
-std::array<float,2>{0.482615888f, 0.890114784f},
-std::array<float,2>{0.771037698f, 0.599914789f},
-std::array<float,2>{0.087395817f, 0.12979655f},
-std::array<float,2>{0.908575475f, 0.0886878893f},
-std::array<float,2>{0.226571038f, 0.677266538f},
-std::array<float,2>{0.649084747f, 0.769137979f},
-std::array<float,2>{0.356574148f, 0.40021956f},
-std::array<float,2>{0.76544857f, 0.347481847f},
-std::array<float,2>{0.0687570348f, 0.913629353f},
-std::array<float,2>{0.520297766f, 0.578027189f},
-std::array<float,2>{0.4853082f, 0.171389356f},
-std::array<float,2>{0.633163512f, 0.124133453f},
-std::array<float,2>{0.361409873f, 0.629934669f},
-std::array<float,2>{0.930683255f, 0.789058149f},
-std::array<float,2>{0.238398179f, 0.414556921f},
-std::array<float,2>{0.59854269f, 0.485504866f},
-std::array<float,2>{0.377403945f, 0.815103054f},
-std::array<float,2>{0.844356477f, 0.742147923f},
-std::array<float,2>{0.0284946784f, 0.0582480766f},
-std::array<float,2>{0.967329443f, 0.200698838f},
-std::array<float,2>{0.182027623f, 0.521850348f},
-std::array<float,2>{0.738134027f, 0.94278264f},
-std::array<float,2>{0.268001586f, 0.252905756f},
-std::array<float,2>{0.901692748f, 0.375817895f},
-std::array<float,2>{0.198466763f, 0.754411101f},
-std::array<float,2>{0.684493601f, 0.670269251f},
-std::array<float,2>{0.313490689f, 0.0648247153f},
-std::array<float,2>{0.545074165f, 0.154808402f},
-std::array<float,2>{0.443248987f, 0.620329916f},
-std::array<float,2>{0.800105035f, 0.89139396f},
-std::array<float,2>{0.094465971f, 0.322050482f},
-std::array<float,2>{0.711593568f, 0.306344688f},
-std::array<float,2>{0.28757745f, 0.999642849f},
-std::array<float,2>{0.990400732f, 0.551683128f},
-std::array<float,2>{0.155714929f, 0.249227569f},
-std::array<float,2>{0.839717805f, 0.0282737538f},
-std::array<float,2>{0.0463248119f, 0.707055271f},
-std::array<float,2>{0.583836555f, 0.867813289f},
-std::array<float,2>{0.422411829f, 0.449511409f},
-std::array<float,2>{0.922518969f, 0.31692791f},
-std::array<float,2>{0.247892842f, 0.899433732f},
-std::array<float,2>{0.629292071f, 0.609710217f},
-std::array<float,2>{0.372320503f, 0.14317818f},
-std::array<float,2>{0.528947353f, 0.0758009106f},
-std::array<float,2>{0.49988699f, 0.658471286f},
-std::array<float,2>{0.752042234f, 0.758676231f},
-std::array<float,2>{0.0775108263f, 0.387679785f},
-std::array<float,2>{0.749881148f, 0.444418043f},
-std::array<float,2>{0.280300528f, 0.865766346f},
-std::array<float,2>{0.96079421f, 0.715716541f},
-std::array<float,2>{0.177732423f, 0.0156720802f},
-std::array<float,2>{0.856158674f, 0.241552323f},
-std::array<float,2>{0.01960456f, 0.555827916f},
-std::array<float,2>{0.603410006f, 0.984391809f},
-std::array<float,2>{0.388228118f, 0.300971627f},
-std::array<float,2>{0.805976748f, 0.413959771f},
-std::array<float,2>{0.102658391f, 0.79624933f},
-std::array<float,2>{0.53555584f, 0.639148951f},
-std::array<float,2>{0.446126819f, 0.114575408f},
-std::array<float,2>{0.672970772f, 0.160004109f},
-std::array<float,2>{0.320725769f, 0.564151824f},
-std::array<float,2>{0.894115627f, 0.921651006f},
-std::array<float,2>{0.188582182f, 0.35272342f},
-std::array<float,2>{0.587771773f, 0.264375895f},
-std::array<float,2>{0.430901229f, 0.947955251f},
-std::array<float,2>{0.834619522f, 0.523646116f},
-std::array<float,2>{0.0345729776f, 0.187752679f},
-std::array<float,2>{0.999316514f, 0.0494458228f},
-std::array<float,2>{0.144819796f, 0.74529618f},
-std::array<float,2>{0.708498001f, 0.825968444f},
-std::array<float,2>{0.294717252f, 0.496365964f},
-std::array<float,2>{0.826528788f, 0.284460485f},
-std::array<float,2>{0.0490029939f, 0.979135811f},
-std::array<float,2>{0.569798529f, 0.532220542f},
-std::array<float,2>{0.407568276f, 0.230128407f},
-std::array<float,2>{0.692838848f, 0.00355932256f},
-std::array<float,2>{0.297207177f, 0.700323701f},
-std::array<float,2>{0.974014163f, 0.852897048f},
-std::array<float,2>{0.138549313f, 0.466752321f},
-std::array<float,2>{0.560343921f, 0.392794311f},
-std::array<float,2>{0.464024961f, 0.775799334f},
-std::array<float,2>{0.791582584f, 0.684262872f},
-std::array<float,2>{0.118525594f, 0.0854600444f},
-std::array<float,2>{0.876914859f, 0.137525871f},
-std::array<float,2>{0.214142904f, 0.603625059f},
-std::array<float,2>{0.668074369f, 0.877436578f},
-std::array<float,2>{0.343619436f, 0.340377241f},
-std::array<float,2>{0.948728502f, 0.479580998f},
-std::array<float,2>{0.15661855f, 0.843157232f},
-std::array<float,2>{0.722027183f, 0.720086873f},
-std::array<float,2>{0.264654219f, 0.0437012315f},
-std::array<float,2>{0.618190825f, 0.205165356f},
-std::array<float,2>{0.3978616f, 0.50396806f},
-std::array<float,2>{0.862821937f, 0.955558658f},
-std::array<float,2>{0.00171342061f, 0.268825084f},
-std::array<float,2>{0.644453406f, 0.372148991f},
-std::array<float,2>{0.345665514f, 0.935431004f},
-std::array<float,2>{0.916580319f, 0.590268493f},
-std::array<float,2>{0.224064037f, 0.184980556f},
-std::array<float,2>{0.77783674f, 0.1072376f},
-std::array<float,2>{0.0841068774f, 0.655287981f},
-std::array<float,2>{0.503540933f, 0.801852047f},
-std::array<float,2>{0.470253706f, 0.431383759f},
-std::array<float,2>{0.956848204f, 0.360845327f},
-std::array<float,2>{0.173588932f, 0.926279724f},
-std::array<float,2>{0.744142652f, 0.580518603f},
-std::array<float,2>{0.274818718f, 0.17287007f},
-std::array<float,2>{0.606979311f, 0.100039572f},
-std::array<float,2>{0.385309219f, 0.643161595f},
-std::array<float,2>{0.853600979f, 0.810204208f},
-std::array<float,2>{0.0177353881f, 0.425224483f},
-std::array<float,2>{0.625043571f, 0.476114392f},
-std::array<float,2>{0.369552553f, 0.834878266f},
-std::array<float,2>{0.928168118f, 0.728307545f},
-std::array<float,2>{0.244503111f, 0.0315737091f},
-std::array<float,2>{0.754933357f, 0.216662794f},
-std::array<float,2>{0.0706607029f, 0.515026748f},
-std::array<float,2>{0.526512504f, 0.965261459f},
-std::array<float,2>{0.493118376f, 0.277902514f},
-std::array<float,2>{0.828903675f, 0.403626531f},
-std::array<float,2>{0.0388773344f, 0.772491753f},
-std::array<float,2>{0.593478978f, 0.67494756f},
-std::array<float,2>{0.434596896f, 0.0913523957f},
-std::array<float,2>{0.703671098f, 0.127192602f},
-std::array<float,2>{0.292785317f, 0.594119728f},
-std::array<float,2>{0.993376851f, 0.883576691f},
-std::array<float,2>{0.140960336f, 0.331767172f},
-std::array<float,2>{0.534845829f, 0.290776551f},
-std::array<float,2>{0.45092985f, 0.973653078f},
-std::array<float,2>{0.809878349f, 0.543827116f},
-std::array<float,2>{0.106810145f, 0.219559565f},
-std::array<float,2>{0.897958398f, 0.00872834027f},
-std::array<float,2>{0.191438988f, 0.691377521f},
-std::array<float,2>{0.676633477f, 0.849280596f},
-std::array<float,2>{0.327382118f, 0.455319524f},
-std::array<float,2>{0.79475075f, 0.256084174f},
-std::array<float,2>{0.121355474f, 0.939155459f},
-std::array<float,2>{0.554825127f, 0.519439816f},
-std::array<float,2>{0.467158496f, 0.195391446f},
-std::array<float,2>{0.666685283f, 0.0622895099f},
-std::array<float,2>{0.336181849f, 0.734564364f},
-std::array<float,2>{0.880470514f, 0.81966126f},
-std::array<float,2>{0.218666151f, 0.491620749f},
-std::array<float,2>{0.562533855f, 0.418034643f},
-std::array<float,2>{0.413379401f, 0.784158289f},
-std::array<float,2>{0.823759794f, 0.628860414f},
-std::array<float,2>{0.0538735464f, 0.119135596f},
-std::array<float,2>{0.970281839f, 0.165777698f},
-std::array<float,2>{0.135875717f, 0.571031749f},
-std::array<float,2>{0.688547671f, 0.906656981f},
-std::array<float,2>{0.302848518f, 0.347762585f},
-std::array<float,2>{0.918523431f, 0.448238224f},
-std::array<float,2>{0.219049051f, 0.873820305f},
-std::array<float,2>{0.645222604f, 0.706599653f},
-std::array<float,2>{0.350036383f, 0.024807211f},
-std::array<float,2>{0.505697429f, 0.242718339f},
-std::array<float,2>{0.473905563f, 0.548955858f},
-std::array<float,2>{0.773824632f, 0.993343771f},
-std::array<float,2>{0.0805497095f, 0.311358362f},
-std::array<float,2>{0.725779891f, 0.327069163f},
-std::array<float,2>{0.260123491f, 0.897237778f},
-std::array<float,2>{0.952963769f, 0.622621298f},
-std::array<float,2>{0.160452917f, 0.149966598f},
-std::array<float,2>{0.866314471f, 0.0691860542f},
-std::array<float,2>{0.0050462354f, 0.666438162f},
-std::array<float,2>{0.622208059f, 0.752967417f},
-std::array<float,2>{0.393251181f, 0.38206175f},
-std::array<float,2>{0.886164427f, 0.298061639f},
-std::array<float,2>{0.204097286f, 0.988339424f},
-std::array<float,2>{0.656932712f, 0.560210168f},
-std::array<float,2>{0.332700133f, 0.235376492f},
-std::array<float,2>{0.548338234f, 0.0224248953f},
-std::array<float,2>{0.455853671f, 0.712508082f},
-std::array<float,2>{0.78874886f, 0.863142848f},
-std::array<float,2>{0.109737292f, 0.437630147f},
-std::array<float,2>{0.69667381f, 0.383296013f},
-std::array<float,2>{0.308048993f, 0.76210469f},
-std::array<float,2>{0.979872048f, 0.662543476f},
-std::array<float,2>{0.125619739f, 0.0714226142f},
-std::array<float,2>{0.81474632f, 0.14806354f},
-std::array<float,2>{0.0565604195f, 0.614601731f},
-std::array<float,2>{0.573193848f, 0.902995408f},
-std::array<float,2>{0.414929211f, 0.315488905f},
-std::array<float,2>{0.767764986f, 0.495416254f},
-std::array<float,2>{0.0932936296f, 0.820361733f},
-std::array<float,2>{0.511609316f, 0.748190522f},
-std::array<float,2>{0.477652729f, 0.0537635535f},
-std::array<float,2>{0.655116856f, 0.194613114f},
-std::array<float,2>{0.354259878f, 0.528178513f},
-std::array<float,2>{0.912699282f, 0.95175457f},
-std::array<float,2>{0.234341457f, 0.260499001f},
-std::array<float,2>{0.609418035f, 0.358427823f},
-std::array<float,2>{0.401990563f, 0.915239871f},
-std::array<float,2>{0.874138713f, 0.570058346f},
-std::array<float,2>{0.00999426376f, 0.163314745f},
-std::array<float,2>{0.939526439f, 0.111077532f},
-std::array<float,2>{0.165745318f, 0.636435688f},
-std::array<float,2>{0.727627814f, 0.789887786f},
-std::array<float,2>{0.254138708f, 0.407578617f},
-std::array<float,2>{0.848099291f, 0.338417351f},
-std::array<float,2>{0.024753252f, 0.880589128f},
-std::array<float,2>{0.596750438f, 0.608349681f},
-std::array<float,2>{0.381899774f, 0.136613086f},
-std::array<float,2>{0.741722465f, 0.0787528232f},
-std::array<float,2>{0.27021417f, 0.683531344f},
-std::array<float,2>{0.96302259f, 0.778851271f},
-std::array<float,2>{0.186490521f, 0.395554394f},
-std::array<float,2>{0.519146502f, 0.461506844f},
-std::array<float,2>{0.491647631f, 0.855573475f},
-std::array<float,2>{0.759607613f, 0.696290076f},
-std::array<float,2>{0.0648200884f, 0.0061805686f},
-std::array<float,2>{0.935779452f, 0.230967745f},
-std::array<float,2>{0.235297263f, 0.537439644f},
-std::array<float,2>{0.640279114f, 0.982672095f},
-std::array<float,2>{0.364038259f, 0.288944572f},
-std::array<float,2>{0.986323833f, 0.43595773f},
-std::array<float,2>{0.149381876f, 0.799480736f},
-std::array<float,2>{0.714909852f, 0.649710715f},
-std::array<float,2>{0.281367749f, 0.102317885f},
-std::array<float,2>{0.579050422f, 0.182493135f},
-std::array<float,2>{0.427841246f, 0.58699286f},
-std::array<float,2>{0.841433346f, 0.932318389f},
-std::array<float,2>{0.0409817025f, 0.37064144f},
-std::array<float,2>{0.68107909f, 0.27152887f},
-std::array<float,2>{0.318122864f, 0.958773971f},
-std::array<float,2>{0.902567208f, 0.502780557f},
-std::array<float,2>{0.201475397f, 0.210740611f},
-std::array<float,2>{0.801445961f, 0.0407071747f},
-std::array<float,2>{0.0992392749f, 0.725545049f},
-std::array<float,2>{0.540552318f, 0.837833464f},
-std::array<float,2>{0.440467238f, 0.481206626f},
-std::array<float,2>{0.943814516f, 0.295815408f},
-std::array<float,2>{0.171315923f, 0.969180822f},
-std::array<float,2>{0.733035743f, 0.541687191f},
-std::array<float,2>{0.251093924f, 0.223542422f},
-std::array<float,2>{0.614036143f, 0.0134734605f},
-std::array<float,2>{0.405440092f, 0.694192708f},
-std::array<float,2>{0.867333591f, 0.846793294f},
-std::array<float,2>{0.0139565943f, 0.459578156f},
-std::array<float,2>{0.650722444f, 0.401082039f},
-std::array<float,2>{0.35886991f, 0.766174018f},
-std::array<float,2>{0.907540202f, 0.677767038f},
-std::array<float,2>{0.228526026f, 0.0871380568f},
-std::array<float,2>{0.773411155f, 0.131326139f},
-std::array<float,2>{0.0892703906f, 0.599072933f},
-std::array<float,2>{0.514090478f, 0.888535082f},
-std::array<float,2>{0.482122421f, 0.334266126f},
-std::array<float,2>{0.819301963f, 0.470670491f},
-std::array<float,2>{0.0611818358f, 0.831133127f},
-std::array<float,2>{0.574917018f, 0.732192218f},
-std::array<float,2>{0.421741486f, 0.0386390127f},
-std::array<float,2>{0.702118158f, 0.213659376f},
-std::array<float,2>{0.311240762f, 0.508902431f},
-std::array<float,2>{0.981929183f, 0.964658499f},
-std::array<float,2>{0.129996821f, 0.274761409f},
-std::array<float,2>{0.551387131f, 0.364033908f},
-std::array<float,2>{0.459843904f, 0.924076498f},
-std::array<float,2>{0.785138607f, 0.585320711f},
-std::array<float,2>{0.114680402f, 0.177225053f},
-std::array<float,2>{0.889883637f, 0.0946541876f},
-std::array<float,2>{0.207588524f, 0.645379424f},
-std::array<float,2>{0.660854995f, 0.804943383f},
-std::array<float,2>{0.330823481f, 0.428091288f},
-std::array<float,2>{0.797184765f, 0.322476476f},
-std::array<float,2>{0.0960552543f, 0.893771112f},
-std::array<float,2>{0.54441148f, 0.61855042f},
-std::array<float,2>{0.444656432f, 0.152891442f},
-std::array<float,2>{0.686078131f, 0.0644124374f},
-std::array<float,2>{0.31582883f, 0.668575406f},
-std::array<float,2>{0.899130881f, 0.75647217f},
-std::array<float,2>{0.196683049f, 0.37846747f},
-std::array<float,2>{0.585629642f, 0.451238006f},
-std::array<float,2>{0.424822927f, 0.869610667f},
-std::array<float,2>{0.837371409f, 0.709799826f},
-std::array<float,2>{0.0431873873f, 0.0305128321f},
-std::array<float,2>{0.98870188f, 0.24733305f},
-std::array<float,2>{0.153794661f, 0.553483963f},
-std::array<float,2>{0.714657247f, 0.997046888f},
-std::array<float,2>{0.286182702f, 0.307090729f},
-std::array<float,2>{0.931783855f, 0.416345656f},
-std::array<float,2>{0.241764441f, 0.787068009f},
-std::array<float,2>{0.635684252f, 0.631170988f},
-std::array<float,2>{0.360608339f, 0.12180832f},
-std::array<float,2>{0.521698475f, 0.169613257f},
-std::array<float,2>{0.486413747f, 0.57588619f},
-std::array<float,2>{0.76199019f, 0.910785139f},
-std::array<float,2>{0.0676223412f, 0.344735235f},
-std::array<float,2>{0.734819829f, 0.251745403f},
-std::array<float,2>{0.266185373f, 0.944708347f},
-std::array<float,2>{0.9650653f, 0.520952761f},
-std::array<float,2>{0.180883929f, 0.20286338f},
-std::array<float,2>{0.846519649f, 0.0564963557f},
-std::array<float,2>{0.030596653f, 0.739695549f},
-std::array<float,2>{0.600525439f, 0.812639594f},
-std::array<float,2>{0.376290292f, 0.486780435f},
-std::array<float,2>{0.891439676f, 0.355262458f},
-std::array<float,2>{0.190828204f, 0.9193151f},
-std::array<float,2>{0.674359739f, 0.565695941f},
-std::array<float,2>{0.322816581f, 0.157092631f},
-std::array<float,2>{0.538077235f, 0.1161419f},
-std::array<float,2>{0.447480708f, 0.637672186f},
-std::array<float,2>{0.808264375f, 0.79381752f},
-std::array<float,2>{0.105214946f, 0.411505789f},
-std::array<float,2>{0.710065901f, 0.498250872f},
-std::array<float,2>{0.295323342f, 0.828115463f},
-std::array<float,2>{0.996747077f, 0.743875802f},
-std::array<float,2>{0.148378477f, 0.048237592f},
-std::array<float,2>{0.832570732f, 0.191401213f},
-std::array<float,2>{0.0329520144f, 0.526815534f},
-std::array<float,2>{0.588995755f, 0.945340037f},
-std::array<float,2>{0.432025135f, 0.262487173f},
-std::array<float,2>{0.750866354f, 0.389694512f},
-std::array<float,2>{0.074744679f, 0.761518955f},
-std::array<float,2>{0.53117007f, 0.656801105f},
-std::array<float,2>{0.497822851f, 0.0776382834f},
-std::array<float,2>{0.632429421f, 0.140675038f},
-std::array<float,2>{0.373256356f, 0.612722218f},
-std::array<float,2>{0.924851f, 0.902105749f},
-std::array<float,2>{0.248288006f, 0.319535136f},
-std::array<float,2>{0.604135036f, 0.303286344f},
-std::array<float,2>{0.388979137f, 0.986669242f},
-std::array<float,2>{0.857478857f, 0.556697369f},
-std::array<float,2>{0.0218984745f, 0.240119606f},
-std::array<float,2>{0.958825707f, 0.0182389189f},
-std::array<float,2>{0.177981362f, 0.717838764f},
-std::array<float,2>{0.746529877f, 0.864536941f},
-std::array<float,2>{0.278305888f, 0.441714287f},
-std::array<float,2>{0.859842956f, 0.26588586f},
-std::array<float,2>{0.00227373838f, 0.954719305f},
-std::array<float,2>{0.621076047f, 0.506094694f},
-std::array<float,2>{0.394960076f, 0.203695893f},
-std::array<float,2>{0.720174611f, 0.0459153727f},
-std::array<float,2>{0.262248904f, 0.721718788f},
-std::array<float,2>{0.945966959f, 0.840427279f},
-std::array<float,2>{0.158280507f, 0.477430969f},
-std::array<float,2>{0.500395834f, 0.432105303f},
-std::array<float,2>{0.472123295f, 0.803438306f},
-std::array<float,2>{0.780091047f, 0.654118121f},
-std::array<float,2>{0.0822038949f, 0.107426524f},
-std::array<float,2>{0.914975762f, 0.185830563f},
-std::array<float,2>{0.225932151f, 0.592553794f},
-std::array<float,2>{0.641814053f, 0.937414467f},
-std::array<float,2>{0.346009493f, 0.374607146f},
-std::array<float,2>{0.975808442f, 0.468308568f},
-std::array<float,2>{0.139941588f, 0.854278266f},
-std::array<float,2>{0.694135308f, 0.702219427f},
-std::array<float,2>{0.300130248f, 0.000565487542f},
-std::array<float,2>{0.567409992f, 0.227462471f},
-std::array<float,2>{0.408884615f, 0.533986211f},
-std::array<float,2>{0.82485646f, 0.977072895f},
-std::array<float,2>{0.0472937636f, 0.282033831f},
-std::array<float,2>{0.670501709f, 0.343665928f},
-std::array<float,2>{0.340039313f, 0.876105726f},
-std::array<float,2>{0.877433062f, 0.602409482f},
-std::array<float,2>{0.212499008f, 0.139152631f},
-std::array<float,2>{0.789665759f, 0.0836594924f},
-std::array<float,2>{0.119183838f, 0.687372029f},
-std::array<float,2>{0.562111378f, 0.774893403f},
-std::array<float,2>{0.461640388f, 0.391334891f},
-std::array<float,2>{0.994854867f, 0.328343272f},
-std::array<float,2>{0.143577352f, 0.886455774f},
-std::array<float,2>{0.70559293f, 0.596529067f},
-std::array<float,2>{0.289716661f, 0.125006169f},
-std::array<float,2>{0.589912713f, 0.0924990252f},
-std::array<float,2>{0.436804026f, 0.672856808f},
-std::array<float,2>{0.830263793f, 0.77135092f},
-std::array<float,2>{0.0365326591f, 0.405188829f},
-std::array<float,2>{0.678420663f, 0.454617947f},
-std::array<float,2>{0.324658006f, 0.851353407f},
-std::array<float,2>{0.895480573f, 0.687702954f},
-std::array<float,2>{0.194336548f, 0.0108997654f},
-std::array<float,2>{0.810860753f, 0.220836326f},
-std::array<float,2>{0.108727679f, 0.545001388f},
-std::array<float,2>{0.532751441f, 0.975939512f},
-std::array<float,2>{0.452482134f, 0.292337745f},
-std::array<float,2>{0.852473199f, 0.423235595f},
-std::array<float,2>{0.0159917511f, 0.81133008f},
-std::array<float,2>{0.60837698f, 0.640847027f},
-std::array<float,2>{0.38419804f, 0.0983152986f},
-std::array<float,2>{0.742773652f, 0.174814016f},
-std::array<float,2>{0.275415391f, 0.579765439f},
-std::array<float,2>{0.954645514f, 0.928462982f},
-std::array<float,2>{0.175610512f, 0.362594485f},
-std::array<float,2>{0.525127232f, 0.280649692f},
-std::array<float,2>{0.495727509f, 0.967528701f},
-std::array<float,2>{0.756421864f, 0.512315214f},
-std::array<float,2>{0.0739737824f, 0.218311504f},
-std::array<float,2>{0.92592299f, 0.033427272f},
-std::array<float,2>{0.244111344f, 0.729722857f},
-std::array<float,2>{0.628021955f, 0.833147228f},
-std::array<float,2>{0.368227899f, 0.473491311f},
-std::array<float,2>{0.775499642f, 0.309182435f},
-std::array<float,2>{0.0782382712f, 0.99499476f},
-std::array<float,2>{0.506571531f, 0.547655225f},
-std::array<float,2>{0.476013213f, 0.244153947f},
-std::array<float,2>{0.647854924f, 0.0265516192f},
-std::array<float,2>{0.349200577f, 0.704182327f},
-std::array<float,2>{0.920406282f, 0.871838689f},
-std::array<float,2>{0.221740782f, 0.446861237f},
-std::array<float,2>{0.624584436f, 0.380631119f},
-std::array<float,2>{0.391181499f, 0.75092864f},
-std::array<float,2>{0.863334298f, 0.665758848f},
-std::array<float,2>{0.00759033905f, 0.0667815432f},
-std::array<float,2>{0.95074439f, 0.150918797f},
-std::array<float,2>{0.163966969f, 0.623350978f},
-std::array<float,2>{0.722929478f, 0.896050215f},
-std::array<float,2>{0.259756178f, 0.325125486f},
-std::array<float,2>{0.880893588f, 0.489391327f},
-std::array<float,2>{0.215316236f, 0.817778826f},
-std::array<float,2>{0.66500628f, 0.737298787f},
-std::array<float,2>{0.33800903f, 0.0586407967f},
-std::array<float,2>{0.558128238f, 0.199056849f},
-std::array<float,2>{0.465820491f, 0.515838504f},
-std::array<float,2>{0.79627347f, 0.939641058f},
-std::array<float,2>{0.123328842f, 0.254185051f},
-std::array<float,2>{0.691378891f, 0.351330727f},
-std::array<float,2>{0.301300168f, 0.909021914f},
-std::array<float,2>{0.97091347f, 0.573202252f},
-std::array<float,2>{0.133822173f, 0.167773411f},
-std::array<float,2>{0.820573449f, 0.120109409f},
-std::array<float,2>{0.0520053059f, 0.625358582f},
-std::array<float,2>{0.564965904f, 0.781372428f},
-std::array<float,2>{0.411944002f, 0.421263456f},
-std::array<float,2>{0.910975635f, 0.258562535f},
-std::array<float,2>{0.230529353f, 0.950133681f},
-std::array<float,2>{0.654143274f, 0.531032264f},
-std::array<float,2>{0.352487594f, 0.193211719f},
-std::array<float,2>{0.509154439f, 0.0523362868f},
-std::array<float,2>{0.479702592f, 0.747770667f},
-std::array<float,2>{0.766362011f, 0.822672904f},
-std::array<float,2>{0.0906616077f, 0.493718982f},
-std::array<float,2>{0.728612483f, 0.409333646f},
-std::array<float,2>{0.256440639f, 0.791785419f},
-std::array<float,2>{0.938779891f, 0.633290172f},
-std::array<float,2>{0.167710111f, 0.112715624f},
-std::array<float,2>{0.871580422f, 0.160313606f},
-std::array<float,2>{0.00850158278f, 0.566962481f},
-std::array<float,2>{0.612160027f, 0.916387558f},
-std::array<float,2>{0.399024367f, 0.357289165f},
-std::array<float,2>{0.785752714f, 0.441097587f},
-std::array<float,2>{0.111439936f, 0.860293746f},
-std::array<float,2>{0.550208628f, 0.71385473f},
-std::array<float,2>{0.455054462f, 0.0211391095f},
-std::array<float,2>{0.659531415f, 0.237211168f},
-std::array<float,2>{0.334947079f, 0.56187129f},
-std::array<float,2>{0.8845734f, 0.990321398f},
-std::array<float,2>{0.205879733f, 0.299471825f},
-std::array<float,2>{0.571600854f, 0.313062668f},
-std::array<float,2>{0.417254388f, 0.9054088f},
-std::array<float,2>{0.814211845f, 0.615389943f},
-std::array<float,2>{0.0574251525f, 0.145405695f},
-std::array<float,2>{0.977374375f, 0.0727713704f},
-std::array<float,2>{0.128768042f, 0.661408126f},
-std::array<float,2>{0.697900891f, 0.764904737f},
-std::array<float,2>{0.305847108f, 0.385759056f},
-std::array<float,2>{0.841865182f, 0.367432088f},
-std::array<float,2>{0.0419278555f, 0.93061012f},
-std::array<float,2>{0.581269205f, 0.589660764f},
-std::array<float,2>{0.427415401f, 0.180901006f},
-std::array<float,2>{0.71797961f, 0.104204252f},
-std::array<float,2>{0.283569813f, 0.65168345f},
-std::array<float,2>{0.987667441f, 0.797453105f},
-std::array<float,2>{0.151970074f, 0.433971047f},
-std::array<float,2>{0.542479277f, 0.483030558f},
-std::array<float,2>{0.437739521f, 0.838494837f},
-std::array<float,2>{0.803429186f, 0.724495232f},
-std::array<float,2>{0.101557352f, 0.0414198339f},
-std::array<float,2>{0.90514195f, 0.208937764f},
-std::array<float,2>{0.200595424f, 0.50175041f},
-std::array<float,2>{0.681694269f, 0.9596259f},
-std::array<float,2>{0.318945408f, 0.271354437f},
-std::array<float,2>{0.961797476f, 0.397408545f},
-std::array<float,2>{0.18507719f, 0.780965388f},
-std::array<float,2>{0.738779187f, 0.680143416f},
-std::array<float,2>{0.272330344f, 0.0806489065f},
-std::array<float,2>{0.595472217f, 0.134458706f},
-std::array<float,2>{0.380248547f, 0.607288063f},
-std::array<float,2>{0.850937665f, 0.881444752f},
-std::array<float,2>{0.0261874571f, 0.33620891f},
-std::array<float,2>{0.636768997f, 0.286658973f},
-std::array<float,2>{0.365525097f, 0.982212424f},
-std::array<float,2>{0.934874713f, 0.536718607f},
-std::array<float,2>{0.237513259f, 0.232990175f},
-std::array<float,2>{0.761539102f, 0.00558199128f},
-std::array<float,2>{0.06407132f, 0.697834432f},
-std::array<float,2>{0.516176999f, 0.859234631f},
-std::array<float,2>{0.489010304f, 0.463298589f},
-std::array<float,2>{0.991270304f, 0.30830577f},
-std::array<float,2>{0.154723272f, 0.99750483f},
-std::array<float,2>{0.712296963f, 0.554543197f},
-std::array<float,2>{0.288338721f, 0.247035921f},
-std::array<float,2>{0.582092524f, 0.0300412048f},
-std::array<float,2>{0.423420817f, 0.710030794f},
-std::array<float,2>{0.838367403f, 0.870414376f},
-std::array<float,2>{0.0455545299f, 0.452398986f},
-std::array<float,2>{0.685151517f, 0.377787352f},
-std::array<float,2>{0.312699556f, 0.757760406f},
-std::array<float,2>{0.9010517f, 0.669855356f},
-std::array<float,2>{0.198029563f, 0.0632749572f},
-std::array<float,2>{0.799187183f, 0.154291764f},
-std::array<float,2>{0.095620431f, 0.617518306f},
-std::array<float,2>{0.545989513f, 0.893131912f},
-std::array<float,2>{0.44223848f, 0.323634982f},
-std::array<float,2>{0.845336854f, 0.488134086f},
-std::array<float,2>{0.0280502625f, 0.814406633f},
-std::array<float,2>{0.598824203f, 0.738484859f},
-std::array<float,2>{0.378588229f, 0.0552820638f},
-std::array<float,2>{0.73645556f, 0.201842919f},
-std::array<float,2>{0.26934728f, 0.520066023f},
-std::array<float,2>{0.968528688f, 0.943924367f},
-std::array<float,2>{0.183104008f, 0.250483841f},
-std::array<float,2>{0.52088505f, 0.34399423f},
-std::array<float,2>{0.48595497f, 0.911821187f},
-std::array<float,2>{0.763780832f, 0.574462533f},
-std::array<float,2>{0.0695941299f, 0.168791115f},
-std::array<float,2>{0.930142462f, 0.122815512f},
-std::array<float,2>{0.239432648f, 0.632245123f},
-std::array<float,2>{0.634402514f, 0.786034644f},
-std::array<float,2>{0.363088757f, 0.417775154f},
-std::array<float,2>{0.769559205f, 0.335897475f},
-std::array<float,2>{0.0865292028f, 0.88708663f},
-std::array<float,2>{0.512550831f, 0.598187447f},
-std::array<float,2>{0.484205723f, 0.132294804f},
-std::array<float,2>{0.649457753f, 0.0866641924f},
-std::array<float,2>{0.355967015f, 0.679057539f},
-std::array<float,2>{0.909851372f, 0.767035067f},
-std::array<float,2>{0.227980912f, 0.402180016f},
-std::array<float,2>{0.615921736f, 0.460054964f},
-std::array<float,2>{0.403422803f, 0.845876932f},
-std::array<float,2>{0.870064914f, 0.69454366f},
-std::array<float,2>{0.0132342475f, 0.0117269736f},
-std::array<float,2>{0.942506731f, 0.224042907f},
-std::array<float,2>{0.169288158f, 0.542675495f},
-std::array<float,2>{0.732361972f, 0.970549583f},
-std::array<float,2>{0.253186792f, 0.296009094f},
-std::array<float,2>{0.888332725f, 0.428851962f},
-std::array<float,2>{0.210176021f, 0.805990338f},
-std::array<float,2>{0.663315952f, 0.646400869f},
-std::array<float,2>{0.329571724f, 0.0949485078f},
-std::array<float,2>{0.55328685f, 0.175995409f},
-std::array<float,2>{0.458886027f, 0.584747374f},
-std::array<float,2>{0.781413436f, 0.925763965f},
-std::array<float,2>{0.116206378f, 0.365124315f},
-std::array<float,2>{0.700865865f, 0.273653865f},
-std::array<float,2>{0.309232205f, 0.963525891f},
-std::array<float,2>{0.983651578f, 0.507900298f},
-std::array<float,2>{0.132154629f, 0.214542761f},
-std::array<float,2>{0.816568017f, 0.0377746038f},
-std::array<float,2>{0.0588995405f, 0.731341481f},
-std::array<float,2>{0.577255905f, 0.830334663f},
-std::array<float,2>{0.418786585f, 0.468897253f},
-std::array<float,2>{0.917074442f, 0.373879969f},
-std::array<float,2>{0.223288625f, 0.936083198f},
-std::array<float,2>{0.642653346f, 0.592777014f},
-std::array<float,2>{0.343894839f, 0.186746061f},
-std::array<float,2>{0.502602339f, 0.109194927f},
-std::array<float,2>{0.469295502f, 0.652609468f},
-std::array<float,2>{0.77890414f, 0.803878486f},
-std::array<float,2>{0.0849713907f, 0.433481246f},
-std::array<float,2>{0.720908761f, 0.47834f},
-std::array<float,2>{0.263808161f, 0.84145999f},
-std::array<float,2>{0.948056579f, 0.721470654f},
-std::array<float,2>{0.157826543f, 0.0456223339f},
-std::array<float,2>{0.861952782f, 0.204686806f},
-std::array<float,2>{0.000232218968f, 0.507327497f},
-std::array<float,2>{0.617574334f, 0.953297019f},
-std::array<float,2>{0.396895915f, 0.266652048f},
-std::array<float,2>{0.792199135f, 0.392207444f},
-std::array<float,2>{0.117769085f, 0.774225831f},
-std::array<float,2>{0.55863601f, 0.686028779f},
-std::array<float,2>{0.463171065f, 0.0826838389f},
-std::array<float,2>{0.669134378f, 0.139993861f},
-std::array<float,2>{0.342769057f, 0.602946699f},
-std::array<float,2>{0.87501049f, 0.87538892f},
-std::array<float,2>{0.213102728f, 0.342145473f},
-std::array<float,2>{0.568495274f, 0.282952577f},
-std::array<float,2>{0.406267107f, 0.977970064f},
-std::array<float,2>{0.82788986f, 0.534443617f},
-std::array<float,2>{0.0505923405f, 0.227670819f},
-std::array<float,2>{0.973126113f, 0.00177502586f},
-std::array<float,2>{0.136901259f, 0.701931655f},
-std::array<float,2>{0.691457272f, 0.854735851f},
-std::array<float,2>{0.298344225f, 0.467458129f},
-std::array<float,2>{0.835062742f, 0.263650298f},
-std::array<float,2>{0.0334901139f, 0.946630418f},
-std::array<float,2>{0.586763501f, 0.526192009f},
-std::array<float,2>{0.430608898f, 0.189491719f},
-std::array<float,2>{0.707445741f, 0.0473851003f},
-std::array<float,2>{0.2930125f, 0.742956102f},
-std::array<float,2>{0.99844563f, 0.826880515f},
-std::array<float,2>{0.145917356f, 0.499614269f},
-std::array<float,2>{0.536874056f, 0.410325021f},
-std::array<float,2>{0.446710289f, 0.794833481f},
-std::array<float,2>{0.804797351f, 0.638249874f},
-std::array<float,2>{0.101896055f, 0.116524696f},
-std::array<float,2>{0.89280498f, 0.157505214f},
-std::array<float,2>{0.188098907f, 0.565203369f},
-std::array<float,2>{0.672037542f, 0.918226838f},
-std::array<float,2>{0.321533054f, 0.354359597f},
-std::array<float,2>{0.959022105f, 0.442697078f},
-std::array<float,2>{0.176688209f, 0.863771021f},
-std::array<float,2>{0.748576224f, 0.716916621f},
-std::array<float,2>{0.27994895f, 0.0193703156f},
-std::array<float,2>{0.602222383f, 0.238334343f},
-std::array<float,2>{0.387325943f, 0.558129966f},
-std::array<float,2>{0.856767952f, 0.987735033f},
-std::array<float,2>{0.0208987109f, 0.30463621f},
-std::array<float,2>{0.630762339f, 0.31866014f},
-std::array<float,2>{0.371104926f, 0.900751114f},
-std::array<float,2>{0.923713565f, 0.612206459f},
-std::array<float,2>{0.246425912f, 0.14229992f},
-std::array<float,2>{0.753869414f, 0.0769832283f},
-std::array<float,2>{0.0764422789f, 0.658029377f},
-std::array<float,2>{0.527584672f, 0.760472953f},
-std::array<float,2>{0.498157442f, 0.388722122f},
-std::array<float,2>{0.951254547f, 0.326134741f},
-std::array<float,2>{0.161432669f, 0.895433486f},
-std::array<float,2>{0.72545439f, 0.624402165f},
-std::array<float,2>{0.261186808f, 0.15187721f},
-std::array<float,2>{0.621365368f, 0.0676968172f},
-std::array<float,2>{0.394183159f, 0.66441977f},
-std::array<float,2>{0.865650892f, 0.751419365f},
-std::array<float,2>{0.00393060129f, 0.379538476f},
-std::array<float,2>{0.646294475f, 0.446022809f},
-std::array<float,2>{0.350895375f, 0.872661412f},
-std::array<float,2>{0.918952465f, 0.703433216f},
-std::array<float,2>{0.220678702f, 0.0261585116f},
-std::array<float,2>{0.774891198f, 0.245460674f},
-std::array<float,2>{0.0812217817f, 0.548784256f},
-std::array<float,2>{0.504413843f, 0.995904207f},
-std::array<float,2>{0.473085254f, 0.309769183f},
-std::array<float,2>{0.822901845f, 0.420104951f},
-std::array<float,2>{0.0527836196f, 0.782332659f},
-std::array<float,2>{0.564259768f, 0.62648946f},
-std::array<float,2>{0.412520826f, 0.120795131f},
-std::array<float,2>{0.688251019f, 0.166499883f},
-std::array<float,2>{0.303878397f, 0.573364079f},
-std::array<float,2>{0.969399452f, 0.909475684f},
-std::array<float,2>{0.135408223f, 0.350157887f},
-std::array<float,2>{0.556423306f, 0.254965723f},
-std::array<float,2>{0.467847288f, 0.941351652f},
-std::array<float,2>{0.793578923f, 0.516655684f},
-std::array<float,2>{0.122870177f, 0.197877482f},
-std::array<float,2>{0.879537046f, 0.0600338429f},
-std::array<float,2>{0.217747897f, 0.737356842f},
-std::array<float,2>{0.667799294f, 0.816664457f},
-std::array<float,2>{0.337655723f, 0.488317132f},
-std::array<float,2>{0.809153855f, 0.291461676f},
-std::array<float,2>{0.10578087f, 0.974718511f},
-std::array<float,2>{0.533892453f, 0.546611428f},
-std::array<float,2>{0.449928671f, 0.221840233f},
-std::array<float,2>{0.677281022f, 0.0102881277f},
-std::array<float,2>{0.327113807f, 0.689262688f},
-std::array<float,2>{0.897418201f, 0.850048602f},
-std::array<float,2>{0.192764431f, 0.453179955f},
-std::array<float,2>{0.59215492f, 0.405429065f},
-std::array<float,2>{0.434426785f, 0.770240724f},
-std::array<float,2>{0.829609513f, 0.672811389f},
-std::array<float,2>{0.0379080325f, 0.0928574875f},
-std::array<float,2>{0.992294133f, 0.126241893f},
-std::array<float,2>{0.141749367f, 0.596891642f},
-std::array<float,2>{0.704571545f, 0.885708332f},
-std::array<float,2>{0.291909814f, 0.329372227f},
-std::array<float,2>{0.929235458f, 0.473989189f},
-std::array<float,2>{0.245779112f, 0.83239913f},
-std::array<float,2>{0.626144171f, 0.729233086f},
-std::array<float,2>{0.371080458f, 0.03504676f},
-std::array<float,2>{0.526149333f, 0.21683684f},
-std::array<float,2>{0.493312955f, 0.512834907f},
-std::array<float,2>{0.754743516f, 0.968435049f},
-std::array<float,2>{0.0716002584f, 0.280142963f},
-std::array<float,2>{0.745590389f, 0.362156719f},
-std::array<float,2>{0.273948818f, 0.928765953f},
-std::array<float,2>{0.95552063f, 0.578130126f},
-std::array<float,2>{0.172486648f, 0.174218744f},
-std::array<float,2>{0.855107784f, 0.0994118899f},
-std::array<float,2>{0.0192598738f, 0.642241538f},
-std::array<float,2>{0.605696678f, 0.811821938f},
-std::array<float,2>{0.385821491f, 0.421935856f},
-std::array<float,2>{0.903387547f, 0.269721657f},
-std::array<float,2>{0.203098312f, 0.960411489f},
-std::array<float,2>{0.680174828f, 0.50087285f},
-std::array<float,2>{0.317380518f, 0.207640693f},
-std::array<float,2>{0.5395118f, 0.0428128392f},
-std::array<float,2>{0.440001577f, 0.722911358f},
-std::array<float,2>{0.802075326f, 0.839061201f},
-std::array<float,2>{0.0978329778f, 0.4836016f},
-std::array<float,2>{0.71654129f, 0.435117543f},
-std::array<float,2>{0.283184171f, 0.79817313f},
-std::array<float,2>{0.984723687f, 0.650833249f},
-std::array<float,2>{0.149677217f, 0.10507264f},
-std::array<float,2>{0.840260565f, 0.180353403f},
-std::array<float,2>{0.0397111997f, 0.588002682f},
-std::array<float,2>{0.579934537f, 0.931575179f},
-std::array<float,2>{0.428932995f, 0.368885905f},
-std::array<float,2>{0.758609176f, 0.464612335f},
-std::array<float,2>{0.0664046556f, 0.857438207f},
-std::array<float,2>{0.51776582f, 0.699029863f},
-std::array<float,2>{0.49074927f, 0.00467608916f},
-std::array<float,2>{0.639446735f, 0.234072506f},
-std::array<float,2>{0.364945084f, 0.535572886f},
-std::array<float,2>{0.936737597f, 0.981170356f},
-std::array<float,2>{0.235558659f, 0.285553485f},
-std::array<float,2>{0.596460342f, 0.33780092f},
-std::array<float,2>{0.381136358f, 0.882209241f},
-std::array<float,2>{0.848935366f, 0.605562747f},
-std::array<float,2>{0.0242586061f, 0.133560732f},
-std::array<float,2>{0.963895082f, 0.081455797f},
-std::array<float,2>{0.187385038f, 0.681046963f},
-std::array<float,2>{0.740404427f, 0.779564798f},
-std::array<float,2>{0.270764053f, 0.397825748f},
-std::array<float,2>{0.873644292f, 0.355576068f},
-std::array<float,2>{0.0109532522f, 0.917701483f},
-std::array<float,2>{0.610576153f, 0.56796819f},
-std::array<float,2>{0.40109092f, 0.161157057f},
-std::array<float,2>{0.727373362f, 0.111935198f},
-std::array<float,2>{0.25519979f, 0.634434521f},
-std::array<float,2>{0.940469682f, 0.792307317f},
-std::array<float,2>{0.16481857f, 0.408506453f},
-std::array<float,2>{0.510529876f, 0.492747158f},
-std::array<float,2>{0.477134675f, 0.823540747f},
-std::array<float,2>{0.768833637f, 0.746127427f},
-std::array<float,2>{0.0924777985f, 0.0512183756f},
-std::array<float,2>{0.914031208f, 0.192306817f},
-std::array<float,2>{0.23243691f, 0.529548347f},
-std::array<float,2>{0.656174064f, 0.950206399f},
-std::array<float,2>{0.354526162f, 0.25890854f},
-std::array<float,2>{0.979434431f, 0.385445774f},
-std::array<float,2>{0.126873836f, 0.764508486f},
-std::array<float,2>{0.695862114f, 0.660438061f},
-std::array<float,2>{0.306900799f, 0.0738763288f},
-std::array<float,2>{0.574191093f, 0.146193787f},
-std::array<float,2>{0.415264964f, 0.616520345f},
-std::array<float,2>{0.815888405f, 0.904965639f},
-std::array<float,2>{0.0553115308f, 0.314230531f},
-std::array<float,2>{0.657443285f, 0.2998842f},
-std::array<float,2>{0.333491474f, 0.991982758f},
-std::array<float,2>{0.885242462f, 0.561424196f},
-std::array<float,2>{0.204525828f, 0.237525895f},
-std::array<float,2>{0.787459075f, 0.0201868229f},
-std::array<float,2>{0.110652484f, 0.71409899f},
-std::array<float,2>{0.547127724f, 0.860600531f},
-std::array<float,2>{0.456463695f, 0.439810693f},
-std::array<float,2>{0.965841115f, 0.253749102f},
-std::array<float,2>{0.179988742f, 0.942164004f},
-std::array<float,2>{0.735817373f, 0.522973895f},
-std::array<float,2>{0.266635686f, 0.199606925f},
-std::array<float,2>{0.600642145f, 0.056991864f},
-std::array<float,2>{0.375782281f, 0.740664423f},
-std::array<float,2>{0.846886814f, 0.816016138f},
-std::array<float,2>{0.029796984f, 0.485270172f},
-std::array<float,2>{0.636157632f, 0.415616453f},
-std::array<float,2>{0.359448433f, 0.787328303f},
-std::array<float,2>{0.933088541f, 0.629607558f},
-std::array<float,2>{0.240911201f, 0.123455957f},
-std::array<float,2>{0.763115644f, 0.170293167f},
-std::array<float,2>{0.0669663474f, 0.576997697f},
-std::array<float,2>{0.522997439f, 0.912393689f},
-std::array<float,2>{0.487793475f, 0.346433789f},
-std::array<float,2>{0.836773098f, 0.451130569f},
-std::array<float,2>{0.0443384796f, 0.86893791f},
-std::array<float,2>{0.584124684f, 0.708684504f},
-std::array<float,2>{0.424582422f, 0.0288363192f},
-std::array<float,2>{0.712899685f, 0.248950422f},
-std::array<float,2>{0.285618454f, 0.552704096f},
-std::array<float,2>{0.989954233f, 0.998959124f},
-std::array<float,2>{0.153197095f, 0.305290639f},
-std::array<float,2>{0.543578088f, 0.321128845f},
-std::array<float,2>{0.443482012f, 0.892201424f},
-std::array<float,2>{0.798381984f, 0.619502604f},
-std::array<float,2>{0.0973974392f, 0.155530304f},
-std::array<float,2>{0.89966464f, 0.0659769177f},
-std::array<float,2>{0.195891261f, 0.671571434f},
-std::array<float,2>{0.687044084f, 0.755262434f},
-std::array<float,2>{0.314721435f, 0.376807839f},
-std::array<float,2>{0.783829689f, 0.366743535f},
-std::array<float,2>{0.113363557f, 0.923562527f},
-std::array<float,2>{0.551758409f, 0.583236039f},
-std::array<float,2>{0.460689694f, 0.177875981f},
-std::array<float,2>{0.661969066f, 0.0967272744f},
-std::array<float,2>{0.331061214f, 0.646656096f},
-std::array<float,2>{0.889213443f, 0.807085335f},
-std::array<float,2>{0.208409116f, 0.427007973f},
-std::array<float,2>{0.575209975f, 0.472237498f},
-std::array<float,2>{0.420333296f, 0.828576684f},
-std::array<float,2>{0.819677234f, 0.733370245f},
-std::array<float,2>{0.0620892085f, 0.0353622101f},
-std::array<float,2>{0.980852246f, 0.211364165f},
-std::array<float,2>{0.12905708f, 0.509785056f},
-std::array<float,2>{0.702956796f, 0.962665081f},
-std::array<float,2>{0.312022954f, 0.276738942f},
-std::array<float,2>{0.90672344f, 0.398924857f},
-std::array<float,2>{0.229874417f, 0.768275857f},
-std::array<float,2>{0.652230501f, 0.676584661f},
-std::array<float,2>{0.35794574f, 0.0897623301f},
-std::array<float,2>{0.514691591f, 0.130849078f},
-std::array<float,2>{0.48066771f, 0.600804746f},
-std::array<float,2>{0.771492302f, 0.889469564f},
-std::array<float,2>{0.0888346657f, 0.33259511f},
-std::array<float,2>{0.734298348f, 0.293436646f},
-std::array<float,2>{0.250797778f, 0.970842898f},
-std::array<float,2>{0.944408894f, 0.539944828f},
-std::array<float,2>{0.170488194f, 0.225502819f},
-std::array<float,2>{0.869080842f, 0.0138773257f},
-std::array<float,2>{0.0150150182f, 0.692035556f},
-std::array<float,2>{0.614677966f, 0.844214201f},
-std::array<float,2>{0.404423982f, 0.458983213f},
-std::array<float,2>{0.878497481f, 0.34131816f},
-std::array<float,2>{0.211107776f, 0.878729522f},
-std::array<float,2>{0.671019197f, 0.604754746f},
-std::array<float,2>{0.340935439f, 0.13774763f},
-std::array<float,2>{0.561367929f, 0.0840937421f},
-std::array<float,2>{0.462801397f, 0.685303867f},
-std::array<float,2>{0.790472806f, 0.777077258f},
-std::array<float,2>{0.120550223f, 0.394175798f},
-std::array<float,2>{0.694776773f, 0.465588182f},
-std::array<float,2>{0.299154669f, 0.851922214f},
-std::array<float,2>{0.974658191f, 0.699441731f},
-std::array<float,2>{0.139502466f, 0.00197461015f},
-std::array<float,2>{0.825328529f, 0.229449719f},
-std::array<float,2>{0.0483587123f, 0.532538593f},
-std::array<float,2>{0.566980422f, 0.979868591f},
-std::array<float,2>{0.409308136f, 0.283526093f},
-std::array<float,2>{0.78087455f, 0.430113763f},
-std::array<float,2>{0.0835392103f, 0.800791204f},
-std::array<float,2>{0.501312792f, 0.654877841f},
-std::array<float,2>{0.471676946f, 0.106334068f},
-std::array<float,2>{0.640839756f, 0.184028864f},
-std::array<float,2>{0.347323656f, 0.590845108f},
-std::array<float,2>{0.915783405f, 0.934442103f},
-std::array<float,2>{0.225420088f, 0.371629357f},
-std::array<float,2>{0.619318187f, 0.267831147f},
-std::array<float,2>{0.396382183f, 0.956803501f},
-std::array<float,2>{0.861142874f, 0.504900455f},
-std::array<float,2>{0.00375456992f, 0.206952408f},
-std::array<float,2>{0.946646512f, 0.0447902046f},
-std::array<float,2>{0.159402356f, 0.718763888f},
-std::array<float,2>{0.719633698f, 0.8423118f},
-std::array<float,2>{0.263313115f, 0.478672862f},
-std::array<float,2>{0.858991385f, 0.301918447f},
-std::array<float,2>{0.0231087469f, 0.985471606f},
-std::array<float,2>{0.605068564f, 0.555504084f},
-std::array<float,2>{0.389784873f, 0.240536049f},
-std::array<float,2>{0.747722387f, 0.0168282073f},
-std::array<float,2>{0.279127508f, 0.716567576f},
-std::array<float,2>{0.957189739f, 0.866313815f},
-std::array<float,2>{0.17873244f, 0.443502247f},
-std::array<float,2>{0.53005445f, 0.388442069f},
-std::array<float,2>{0.496991396f, 0.758908927f},
-std::array<float,2>{0.751222312f, 0.659323275f},
-std::array<float,2>{0.0761263147f, 0.0745466724f},
-std::array<float,2>{0.924796402f, 0.143998891f},
-std::array<float,2>{0.24918668f, 0.610595286f},
-std::array<float,2>{0.63163352f, 0.899345994f},
-std::array<float,2>{0.374982536f, 0.318284631f},
-std::array<float,2>{0.998010993f, 0.498034745f},
-std::array<float,2>{0.146770492f, 0.824751318f},
-std::array<float,2>{0.709161103f, 0.744678795f},
-std::array<float,2>{0.296745628f, 0.0504359044f},
-std::array<float,2>{0.587961495f, 0.189103007f},
-std::array<float,2>{0.433333457f, 0.524800479f},
-std::array<float,2>{0.833145738f, 0.948849618f},
-std::array<float,2>{0.0318698213f, 0.265520811f},
-std::array<float,2>{0.675567389f, 0.352323025f},
-std::array<float,2>{0.323618948f, 0.920437217f},
-std::array<float,2>{0.891848147f, 0.56253618f},
-std::array<float,2>{0.189471215f, 0.158971682f},
-std::array<float,2>{0.807310283f, 0.113593958f},
-std::array<float,2>{0.104414515f, 0.639948189f},
-std::array<float,2>{0.53836f, 0.795665801f},
-std::array<float,2>{0.449037373f, 0.41274187f},
-std::array<float,2>{0.972131431f, 0.349594921f},
-std::array<float,2>{0.133719176f, 0.907417476f},
-std::array<float,2>{0.689781785f, 0.571955979f},
-std::array<float,2>{0.302019924f, 0.164914191f},
-std::array<float,2>{0.565999269f, 0.11809539f},
-std::array<float,2>{0.410234094f, 0.627500713f},
-std::array<float,2>{0.821656108f, 0.784919322f},
-std::array<float,2>{0.0510169975f, 0.419169903f},
-std::array<float,2>{0.665636122f, 0.490817696f},
-std::array<float,2>{0.339071691f, 0.81920743f},
-std::array<float,2>{0.882286549f, 0.735899568f},
-std::array<float,2>{0.216542557f, 0.0605597831f},
-std::array<float,2>{0.795229554f, 0.19665502f},
-std::array<float,2>{0.124497384f, 0.518085837f},
-std::array<float,2>{0.557238877f, 0.937620997f},
-std::array<float,2>{0.465450764f, 0.25698787f},
-std::array<float,2>{0.864445746f, 0.381190687f},
-std::array<float,2>{0.00626579998f, 0.752836406f},
-std::array<float,2>{0.623485565f, 0.667070687f},
-std::array<float,2>{0.391970247f, 0.0696693733f},
-std::array<float,2>{0.723694503f, 0.149261415f},
-std::array<float,2>{0.258013666f, 0.621456146f},
-std::array<float,2>{0.950022519f, 0.898065627f},
-std::array<float,2>{0.16272065f, 0.328092813f},
-std::array<float,2>{0.507632673f, 0.312423646f},
-std::array<float,2>{0.475101352f, 0.99245882f},
-std::array<float,2>{0.776396871f, 0.550566077f},
-std::array<float,2>{0.079389438f, 0.24375844f},
-std::array<float,2>{0.921714723f, 0.0236352645f},
-std::array<float,2>{0.221066818f, 0.70591116f},
-std::array<float,2>{0.646897256f, 0.874843597f},
-std::array<float,2>{0.347709566f, 0.448938757f},
-std::array<float,2>{0.757616043f, 0.279117405f},
-std::array<float,2>{0.0725095347f, 0.966794133f},
-std::array<float,2>{0.524192095f, 0.514091074f},
-std::array<float,2>{0.494440317f, 0.214903563f},
-std::array<float,2>{0.627167165f, 0.0329386517f},
-std::array<float,2>{0.367238343f, 0.727110207f},
-std::array<float,2>{0.927639961f, 0.835141301f},
-std::array<float,2>{0.242917672f, 0.474737942f},
-std::array<float,2>{0.609104931f, 0.424363852f},
-std::array<float,2>{0.383494765f, 0.808601022f},
-std::array<float,2>{0.852813721f, 0.6444996f},
-std::array<float,2>{0.0173281282f, 0.100669853f},
-std::array<float,2>{0.953369856f, 0.172543019f},
-std::array<float,2>{0.174552068f, 0.581057847f},
-std::array<float,2>{0.74360323f, 0.926943123f},
-std::array<float,2>{0.27682209f, 0.360111922f},
-std::array<float,2>{0.896179795f, 0.456631184f},
-std::array<float,2>{0.193434805f, 0.848334491f},
-std::array<float,2>{0.679358542f, 0.690236747f},
-std::array<float,2>{0.325825512f, 0.00963889062f},
-std::array<float,2>{0.531317711f, 0.220670491f},
-std::array<float,2>{0.451476872f, 0.544524193f},
-std::array<float,2>{0.812465131f, 0.972692668f},
-std::array<float,2>{0.108235046f, 0.289569438f},
-std::array<float,2>{0.706722796f, 0.330909669f},
-std::array<float,2>{0.290056229f, 0.884099722f},
-std::array<float,2>{0.995526016f, 0.594792306f},
-std::array<float,2>{0.143465161f, 0.128755793f},
-std::array<float,2>{0.831827104f, 0.0905199572f},
-std::array<float,2>{0.0359338485f, 0.673881948f},
-std::array<float,2>{0.590986848f, 0.771731973f},
-std::array<float,2>{0.435713321f, 0.402908921f},
-std::array<float,2>{0.934314549f, 0.287894905f},
-std::array<float,2>{0.237079963f, 0.983545542f},
-std::array<float,2>{0.638262749f, 0.538595021f},
-std::array<float,2>{0.366713345f, 0.232277349f},
-std::array<float,2>{0.517035782f, 0.00707677286f},
-std::array<float,2>{0.489868194f, 0.695742369f},
-std::array<float,2>{0.760247588f, 0.85653615f},
-std::array<float,2>{0.0633445978f, 0.462300897f},
-std::array<float,2>{0.739348114f, 0.394758224f},
-std::array<float,2>{0.273317218f, 0.778119504f},
-std::array<float,2>{0.962457001f, 0.681740642f},
-std::array<float,2>{0.184380084f, 0.0797127336f},
-std::array<float,2>{0.849953532f, 0.135633156f},
-std::array<float,2>{0.0273176096f, 0.608742833f},
-std::array<float,2>{0.594252944f, 0.879362345f},
-std::array<float,2>{0.379361004f, 0.339627773f},
-std::array<float,2>{0.804032981f, 0.481481791f},
-std::array<float,2>{0.0996835306f, 0.836689055f},
-std::array<float,2>{0.541488707f, 0.72612375f},
-std::array<float,2>{0.439287066f, 0.0397772305f},
-std::array<float,2>{0.683072865f, 0.209473118f},
-std::array<float,2>{0.31993261f, 0.503834069f},
-std::array<float,2>{0.906055629f, 0.957359254f},
-std::array<float,2>{0.200133398f, 0.273275405f},
-std::array<float,2>{0.580317676f, 0.370104223f},
-std::array<float,2>{0.426006109f, 0.933403373f},
-std::array<float,2>{0.843523562f, 0.586767435f},
-std::array<float,2>{0.0429184772f, 0.182958096f},
-std::array<float,2>{0.986847162f, 0.10343606f},
-std::array<float,2>{0.150438607f, 0.648716569f},
-std::array<float,2>{0.716868222f, 0.800256371f},
-std::array<float,2>{0.284268856f, 0.437095582f},
-std::array<float,2>{0.813181818f, 0.315244377f},
-std::array<float,2>{0.0578078181f, 0.903820455f},
-std::array<float,2>{0.571021259f, 0.613931f},
-std::array<float,2>{0.416157067f, 0.147236153f},
-std::array<float,2>{0.69879359f, 0.0711655319f},
-std::array<float,2>{0.304740041f, 0.6639148f},
-std::array<float,2>{0.978144646f, 0.763292074f},
-std::array<float,2>{0.127041534f, 0.384179741f},
-std::array<float,2>{0.548954666f, 0.439125985f},
-std::array<float,2>{0.453922361f, 0.862176418f},
-std::array<float,2>{0.786769211f, 0.711303651f},
-std::array<float,2>{0.113114461f, 0.0230917521f},
-std::array<float,2>{0.883217275f, 0.234919921f},
-std::array<float,2>{0.20611015f, 0.559045732f},
-std::array<float,2>{0.659060121f, 0.98968327f},
-std::array<float,2>{0.335672438f, 0.297232717f},
-std::array<float,2>{0.937687397f, 0.406960577f},
-std::array<float,2>{0.166379198f, 0.790443957f},
-std::array<float,2>{0.730201244f, 0.635688305f},
-std::array<float,2>{0.257179707f, 0.10938181f},
-std::array<float,2>{0.612318873f, 0.162783653f},
-std::array<float,2>{0.399499327f, 0.568926573f},
-std::array<float,2>{0.872446716f, 0.914851367f},
-std::array<float,2>{0.00919378828f, 0.357834011f},
-std::array<float,2>{0.652659655f, 0.2613433f},
-std::array<float,2>{0.352543175f, 0.952455938f},
-std::array<float,2>{0.911256492f, 0.528587341f},
-std::array<float,2>{0.232249245f, 0.19389756f},
-std::array<float,2>{0.766861618f, 0.0531268977f},
-std::array<float,2>{0.0917513222f, 0.749887586f},
-std::array<float,2>{0.507838011f, 0.821727753f},
-std::array<float,2>{0.479449451f, 0.494998932f}}
\ No newline at end of file
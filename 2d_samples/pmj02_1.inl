@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.51227957f, 0.744403303f},
-std::array<float,2>{0.330383986f, 0.069534488f},
-std::array<float,2>{0.240638316f, 0.78375572f},
-std::array<float,2>{0.831437409f, 0.372116774f},
-std::array<float,2>{0.943545818f, 0.926311076f},
-std::array<float,2>{0.060844481f, 0.472274542f},
-std::array<float,2>{0.432109505f, 0.603464425f},
-std::array<float,2>{0.677674353f, 0.187600777f},
-std::array<float,2>{0.753373325f, 0.526838958f},
-std::array<float,2>{0.170474216f, 0.158711359f},
-std::array<float,2>{0.270946592f, 0.979064107f},
-std::array<float,2>{0.563522398f, 0.432590961f},
-std::array<float,2>{0.72630024f, 0.814763546f},
-std::array<float,2>{0.496165305f, 0.285655022f},
-std::array<float,2>{0.118065387f, 0.660437882f},
-std::array<float,2>{0.935657561f, 0.0376720242f},
-std::array<float,2>{0.655485511f, 0.567712426f},
-std::array<float,2>{0.382741988f, 0.225541174f},
-std::array<float,2>{0.0034942429f, 0.889144003f},
-std::array<float,2>{0.971007168f, 0.453910172f},
-std::array<float,2>{0.849238276f, 0.755183578f},
-std::array<float,2>{0.189528272f, 0.318326592f},
-std::array<float,2>{0.34609136f, 0.69086659f},
-std::array<float,2>{0.533378184f, 0.0963526741f},
-std::array<float,2>{0.897951722f, 0.654729426f},
-std::array<float,2>{0.0723816827f, 0.0120918453f},
-std::array<float,2>{0.446661472f, 0.855998993f},
-std::array<float,2>{0.69161129f, 0.272643447f},
-std::array<float,2>{0.608341873f, 0.953022301f},
-std::array<float,2>{0.305273503f, 0.39480716f},
-std::array<float,2>{0.132022858f, 0.55731684f},
-std::array<float,2>{0.801027298f, 0.154288262f},
-std::array<float,2>{0.713941813f, 0.67563045f},
-std::array<float,2>{0.463626295f, 0.0572490469f},
-std::array<float,2>{0.0842160508f, 0.832363427f},
-std::array<float,2>{0.876750708f, 0.297492564f},
-std::array<float,2>{0.794008911f, 0.995958745f},
-std::array<float,2>{0.152307376f, 0.409323841f},
-std::array<float,2>{0.294840693f, 0.511875927f},
-std::array<float,2>{0.609630644f, 0.18207182f},
-std::array<float,2>{0.998042643f, 0.620485127f},
-std::array<float,2>{0.0209457632f, 0.217539743f},
-std::array<float,2>{0.402885944f, 0.919923961f},
-std::array<float,2>{0.627924681f, 0.485825449f},
-std::array<float,2>{0.560294211f, 0.806117594f},
-std::array<float,2>{0.369352013f, 0.348983377f},
-std::array<float,2>{0.208492979f, 0.732055128f},
-std::array<float,2>{0.865435719f, 0.083932668f},
-std::array<float,2>{0.589754283f, 0.533037961f},
-std::array<float,2>{0.25461325f, 0.135776475f},
-std::array<float,2>{0.18709518f, 0.966376007f},
-std::array<float,2>{0.771672785f, 0.38458091f},
-std::array<float,2>{0.906273961f, 0.863615274f},
-std::array<float,2>{0.0984037369f, 0.253357053f},
-std::array<float,2>{0.472066164f, 0.634329081f},
-std::array<float,2>{0.745096266f, 0.0278375298f},
-std::array<float,2>{0.825547159f, 0.710108519f},
-std::array<float,2>{0.224198878f, 0.114795424f},
-std::array<float,2>{0.315776378f, 0.76621139f},
-std::array<float,2>{0.524370372f, 0.334458023f},
-std::array<float,2>{0.669933617f, 0.902882755f},
-std::array<float,2>{0.409965247f, 0.445146829f},
-std::array<float,2>{0.0403952859f, 0.593678415f},
-std::array<float,2>{0.964693069f, 0.234425083f},
-std::array<float,2>{0.620166004f, 0.627431214f},
-std::array<float,2>{0.28212291f, 0.0218384638f},
-std::array<float,2>{0.142686471f, 0.869471192f},
-std::array<float,2>{0.787909985f, 0.265249103f},
-std::array<float,2>{0.884325325f, 0.955141723f},
-std::array<float,2>{0.0930526853f, 0.381006837f},
-std::array<float,2>{0.455479026f, 0.544419706f},
-std::array<float,2>{0.705456972f, 0.126897231f},
-std::array<float,2>{0.869119942f, 0.580778956f},
-std::array<float,2>{0.21542421f, 0.245280236f},
-std::array<float,2>{0.365300208f, 0.894151807f},
-std::array<float,2>{0.551463068f, 0.44743371f},
-std::array<float,2>{0.636105776f, 0.773558319f},
-std::array<float,2>{0.394254118f, 0.337706387f},
-std::array<float,2>{0.0283451919f, 0.714701951f},
-std::array<float,2>{0.98498106f, 0.120914526f},
-std::array<float,2>{0.73664093f, 0.503277481f},
-std::array<float,2>{0.481508464f, 0.176093414f},
-std::array<float,2>{0.108750604f, 0.990165949f},
-std::array<float,2>{0.914885283f, 0.420238703f},
-std::array<float,2>{0.775765061f, 0.839850962f},
-std::array<float,2>{0.177947f, 0.309166282f},
-std::array<float,2>{0.264579445f, 0.68055284f},
-std::array<float,2>{0.585166752f, 0.0502250716f},
-std::array<float,2>{0.958569169f, 0.724264085f},
-std::array<float,2>{0.038265679f, 0.0905863568f},
-std::array<float,2>{0.421042174f, 0.8044945f},
-std::array<float,2>{0.657008529f, 0.353785127f},
-std::array<float,2>{0.523425877f, 0.910289347f},
-std::array<float,2>{0.325113654f, 0.494983047f},
-std::array<float,2>{0.226656824f, 0.610900819f},
-std::array<float,2>{0.815245807f, 0.205275238f},
-std::array<float,2>{0.681520343f, 0.701753199f},
-std::array<float,2>{0.422164738f, 0.105271973f},
-std::array<float,2>{0.0504020564f, 0.761589527f},
-std::array<float,2>{0.949818134f, 0.326191992f},
-std::array<float,2>{0.836052299f, 0.876723528f},
-std::array<float,2>{0.245057061f, 0.464270443f},
-std::array<float,2>{0.338478744f, 0.571452498f},
-std::array<float,2>{0.507010698f, 0.234169498f},
-std::array<float,2>{0.924522698f, 0.553616881f},
-std::array<float,2>{0.111867182f, 0.142667964f},
-std::array<float,2>{0.487622678f, 0.942195117f},
-std::array<float,2>{0.730619729f, 0.403993577f},
-std::array<float,2>{0.570702672f, 0.844510853f},
-std::array<float,2>{0.277126491f, 0.274931937f},
-std::array<float,2>{0.161170259f, 0.646981001f},
-std::array<float,2>{0.758577108f, 0.00382747944f},
-std::array<float,2>{0.546702206f, 0.594682395f},
-std::array<float,2>{0.359191924f, 0.200365484f},
-std::array<float,2>{0.197411716f, 0.930207431f},
-std::array<float,2>{0.851902664f, 0.483206421f},
-std::array<float,2>{0.982652962f, 0.794863284f},
-std::array<float,2>{0.0127623435f, 0.365075648f},
-std::array<float,2>{0.384238422f, 0.741633475f},
-std::array<float,2>{0.648382604f, 0.0764242187f},
-std::array<float,2>{0.806589484f, 0.669993401f},
-std::array<float,2>{0.134652257f, 0.0432884656f},
-std::array<float,2>{0.298496813f, 0.823208869f},
-std::array<float,2>{0.597153544f, 0.294222355f},
-std::array<float,2>{0.702317476f, 0.973316371f},
-std::array<float,2>{0.440160841f, 0.422861189f},
-std::array<float,2>{0.0636621639f, 0.51798898f},
-std::array<float,2>{0.899012327f, 0.171007961f},
-std::array<float,2>{0.568343759f, 0.715411425f},
-std::array<float,2>{0.268400759f, 0.121748753f},
-std::array<float,2>{0.167100087f, 0.777808547f},
-std::array<float,2>{0.757277012f, 0.342520684f},
-std::array<float,2>{0.931969881f, 0.896100223f},
-std::array<float,2>{0.12320254f, 0.452017277f},
-std::array<float,2>{0.493071109f, 0.582310081f},
-std::array<float,2>{0.720722198f, 0.246578068f},
-std::array<float,2>{0.834640145f, 0.539703906f},
-std::array<float,2>{0.235385999f, 0.132569253f},
-std::array<float,2>{0.335580617f, 0.960467815f},
-std::array<float,2>{0.508114517f, 0.376036972f},
-std::array<float,2>{0.673334002f, 0.87472254f},
-std::array<float,2>{0.43679601f, 0.260826141f},
-std::array<float,2>{0.0547638535f, 0.631321132f},
-std::array<float,2>{0.940849006f, 0.0172344875f},
-std::array<float,2>{0.690090239f, 0.613995671f},
-std::array<float,2>{0.451873004f, 0.208671749f},
-std::array<float,2>{0.0772690251f, 0.906334043f},
-std::array<float,2>{0.891925275f, 0.49923411f},
-std::array<float,2>{0.798688769f, 0.799756944f},
-std::array<float,2>{0.127682075f, 0.358833969f},
-std::array<float,2>{0.309350491f, 0.720089972f},
-std::array<float,2>{0.604622006f, 0.0895284414f},
-std::array<float,2>{0.973378599f, 0.686732948f},
-std::array<float,2>{0.00636721496f, 0.0525736026f},
-std::array<float,2>{0.377336919f, 0.836928785f},
-std::array<float,2>{0.651547372f, 0.306813806f},
-std::array<float,2>{0.536328375f, 0.984501064f},
-std::array<float,2>{0.350827038f, 0.417445451f},
-std::array<float,2>{0.194016024f, 0.505961359f},
-std::array<float,2>{0.844001055f, 0.174936891f},
-std::array<float,2>{0.631801188f, 0.642784953f},
-std::array<float,2>{0.402269065f, 0.00653479062f},
-std::array<float,2>{0.0164965261f, 0.849068224f},
-std::array<float,2>{0.995074868f, 0.281038404f},
-std::array<float,2>{0.862497032f, 0.939849913f},
-std::array<float,2>{0.206915125f, 0.40079248f},
-std::array<float,2>{0.373302102f, 0.54802072f},
-std::array<float,2>{0.55584687f, 0.146773115f},
-std::array<float,2>{0.881433368f, 0.576141059f},
-std::array<float,2>{0.0802500248f, 0.230025575f},
-std::array<float,2>{0.467746347f, 0.880721509f},
-std::array<float,2>{0.716051102f, 0.467995167f},
-std::array<float,2>{0.616377771f, 0.762849331f},
-std::array<float,2>{0.290666252f, 0.322693944f},
-std::array<float,2>{0.15436615f, 0.698942244f},
-std::array<float,2>{0.78919071f, 0.10654632f},
-std::array<float,2>{0.528261602f, 0.521391094f},
-std::array<float,2>{0.31995362f, 0.167152449f},
-std::array<float,2>{0.222116441f, 0.971643686f},
-std::array<float,2>{0.820625544f, 0.428712428f},
-std::array<float,2>{0.967757583f, 0.826438725f},
-std::array<float,2>{0.0442046262f, 0.292258173f},
-std::array<float,2>{0.412733734f, 0.66497004f},
-std::array<float,2>{0.664761543f, 0.0427912027f},
-std::array<float,2>{0.76897496f, 0.735059142f},
-std::array<float,2>{0.182829186f, 0.0705293715f},
-std::array<float,2>{0.253181458f, 0.792658806f},
-std::array<float,2>{0.592943907f, 0.359908789f},
-std::array<float,2>{0.748081148f, 0.93574363f},
-std::array<float,2>{0.474103004f, 0.479250848f},
-std::array<float,2>{0.0963082761f, 0.599638581f},
-std::array<float,2>{0.912657559f, 0.197240472f},
-std::array<float,2>{0.550473869f, 0.656747818f},
-std::array<float,2>{0.361789316f, 0.0326764584f},
-std::array<float,2>{0.21232897f, 0.817291498f},
-std::array<float,2>{0.871830583f, 0.284322768f},
-std::array<float,2>{0.989162624f, 0.983072758f},
-std::array<float,2>{0.0249262881f, 0.436102539f},
-std::array<float,2>{0.397833914f, 0.52936995f},
-std::array<float,2>{0.63748771f, 0.161101729f},
-std::array<float,2>{0.781728864f, 0.608685195f},
-std::array<float,2>{0.148152277f, 0.192890227f},
-std::array<float,2>{0.286860466f, 0.923157036f},
-std::array<float,2>{0.624845982f, 0.475513875f},
-std::array<float,2>{0.708103299f, 0.786306798f},
-std::array<float,2>{0.45986411f, 0.368274301f},
-std::array<float,2>{0.0896492526f, 0.747957706f},
-std::array<float,2>{0.887952507f, 0.0646313578f},
-std::array<float,2>{0.661507607f, 0.559315681f},
-std::array<float,2>{0.416185081f, 0.150053114f},
-std::array<float,2>{0.0328383222f, 0.948630512f},
-std::array<float,2>{0.956582844f, 0.393568069f},
-std::array<float,2>{0.817335248f, 0.852091253f},
-std::array<float,2>{0.232077152f, 0.267971903f},
-std::array<float,2>{0.321753055f, 0.652323008f},
-std::array<float,2>{0.516233683f, 0.00939117838f},
-std::array<float,2>{0.918300807f, 0.692295671f},
-std::array<float,2>{0.102005161f, 0.100182787f},
-std::array<float,2>{0.478545815f, 0.753044188f},
-std::array<float,2>{0.738785148f, 0.3144238f},
-std::array<float,2>{0.581090033f, 0.886231899f},
-std::array<float,2>{0.260421246f, 0.458895326f},
-std::array<float,2>{0.17465198f, 0.564662099f},
-std::array<float,2>{0.781066716f, 0.219503969f},
-std::array<float,2>{0.727945507f, 0.729344785f},
-std::array<float,2>{0.48917222f, 0.0784581751f},
-std::array<float,2>{0.115809537f, 0.81238842f},
-std::array<float,2>{0.927858949f, 0.347545594f},
-std::array<float,2>{0.762770891f, 0.9167521f},
-std::array<float,2>{0.156815499f, 0.489933282f},
-std::array<float,2>{0.279467076f, 0.622345686f},
-std::array<float,2>{0.57631886f, 0.212323457f},
-std::array<float,2>{0.948486924f, 0.509805024f},
-std::array<float,2>{0.0529741347f, 0.186224908f},
-std::array<float,2>{0.427071333f, 0.998897731f},
-std::array<float,2>{0.687392831f, 0.411767542f},
-std::array<float,2>{0.502446294f, 0.828914464f},
-std::array<float,2>{0.339919537f, 0.303338051f},
-std::array<float,2>{0.246188983f, 0.677565217f},
-std::array<float,2>{0.840456247f, 0.0590657182f},
-std::array<float,2>{0.600531399f, 0.58654356f},
-std::array<float,2>{0.301921576f, 0.239628553f},
-std::array<float,2>{0.139014721f, 0.899486482f},
-std::array<float,2>{0.811819732f, 0.441355079f},
-std::array<float,2>{0.902778745f, 0.769651234f},
-std::array<float,2>{0.0679469407f, 0.329320967f},
-std::array<float,2>{0.443861604f, 0.704463422f},
-std::array<float,2>{0.696067035f, 0.112486094f},
-std::array<float,2>{0.856368721f, 0.639831483f},
-std::array<float,2>{0.203100666f, 0.0268544909f},
-std::array<float,2>{0.355192572f, 0.860099256f},
-std::array<float,2>{0.54262805f, 0.256905824f},
-std::array<float,2>{0.640888989f, 0.962635219f},
-std::array<float,2>{0.388876766f, 0.389667988f},
-std::array<float,2>{0.00961171277f, 0.53643012f},
-std::array<float,2>{0.979882181f, 0.139445052f},
-std::array<float,2>{0.532993376f, 0.688289881f},
-std::array<float,2>{0.344932318f, 0.0943597853f},
-std::array<float,2>{0.188654825f, 0.757193983f},
-std::array<float,2>{0.851268291f, 0.320239753f},
-std::array<float,2>{0.970497191f, 0.888109684f},
-std::array<float,2>{0.000260341592f, 0.455216318f},
-std::array<float,2>{0.379853159f, 0.568383813f},
-std::array<float,2>{0.653654337f, 0.224335611f},
-std::array<float,2>{0.80305481f, 0.554909587f},
-std::array<float,2>{0.130376175f, 0.155016541f},
-std::array<float,2>{0.307840556f, 0.950199783f},
-std::array<float,2>{0.606660187f, 0.39696154f},
-std::array<float,2>{0.694422483f, 0.85864526f},
-std::array<float,2>{0.449002832f, 0.270990342f},
-std::array<float,2>{0.0705382749f, 0.652355433f},
-std::array<float,2>{0.894649625f, 0.0143942395f},
-std::array<float,2>{0.678516746f, 0.605012834f},
-std::array<float,2>{0.431614757f, 0.191155627f},
-std::array<float,2>{0.0588315278f, 0.927901864f},
-std::array<float,2>{0.942423701f, 0.469419211f},
-std::array<float,2>{0.828421056f, 0.782841325f},
-std::array<float,2>{0.23913087f, 0.37417084f},
-std::array<float,2>{0.328264028f, 0.743752956f},
-std::array<float,2>{0.51466912f, 0.0667511821f},
-std::array<float,2>{0.933674514f, 0.662858188f},
-std::array<float,2>{0.120041609f, 0.0367555916f},
-std::array<float,2>{0.498998493f, 0.81310755f},
-std::array<float,2>{0.724049151f, 0.287244141f},
-std::array<float,2>{0.565052211f, 0.978390574f},
-std::array<float,2>{0.273282617f, 0.429950893f},
-std::array<float,2>{0.169174939f, 0.525019467f},
-std::array<float,2>{0.750739813f, 0.157192439f},
-std::array<float,2>{0.742577255f, 0.635573924f},
-std::array<float,2>{0.469082505f, 0.030027926f},
-std::array<float,2>{0.100299463f, 0.865431547f},
-std::array<float,2>{0.909850895f, 0.250720739f},
-std::array<float,2>{0.770486236f, 0.967824459f},
-std::array<float,2>{0.183656722f, 0.385971695f},
-std::array<float,2>{0.256680161f, 0.533703446f},
-std::array<float,2>{0.587688088f, 0.133411065f},
-std::array<float,2>{0.961172044f, 0.591094077f},
-std::array<float,2>{0.0416164249f, 0.236474738f},
-std::array<float,2>{0.406769842f, 0.904351652f},
-std::array<float,2>{0.669768333f, 0.44299975f},
-std::array<float,2>{0.525553465f, 0.768031359f},
-std::array<float,2>{0.313442647f, 0.333229154f},
-std::array<float,2>{0.225059152f, 0.708980203f},
-std::array<float,2>{0.827184498f, 0.116644047f},
-std::array<float,2>{0.611970127f, 0.514988899f},
-std::array<float,2>{0.296468437f, 0.179812104f},
-std::array<float,2>{0.149414018f, 0.99303025f},
-std::array<float,2>{0.796459317f, 0.408081561f},
-std::array<float,2>{0.877505183f, 0.834568322f},
-std::array<float,2>{0.0824941993f, 0.298939914f},
-std::array<float,2>{0.461592704f, 0.673761308f},
-std::array<float,2>{0.711965799f, 0.055950284f},
-std::array<float,2>{0.864120722f, 0.73376739f},
-std::array<float,2>{0.210645378f, 0.0856267661f},
-std::array<float,2>{0.367673934f, 0.807674944f},
-std::array<float,2>{0.562152505f, 0.350072801f},
-std::array<float,2>{0.625142336f, 0.919529319f},
-std::array<float,2>{0.405031681f, 0.486753881f},
-std::array<float,2>{0.0218049139f, 0.617494702f},
-std::array<float,2>{0.999673605f, 0.21620357f},
-std::array<float,2>{0.582488418f, 0.683561921f},
-std::array<float,2>{0.262565553f, 0.0481558628f},
-std::array<float,2>{0.175975978f, 0.843413472f},
-std::array<float,2>{0.775336444f, 0.311829329f},
-std::array<float,2>{0.917463541f, 0.990737498f},
-std::array<float,2>{0.106097296f, 0.419341236f},
-std::array<float,2>{0.48326245f, 0.501861393f},
-std::array<float,2>{0.736232996f, 0.179013699f},
-std::array<float,2>{0.814398289f, 0.612891436f},
-std::array<float,2>{0.230062798f, 0.205001324f},
-std::array<float,2>{0.327803642f, 0.912959695f},
-std::array<float,2>{0.520507693f, 0.493201524f},
-std::array<float,2>{0.659598172f, 0.802540243f},
-std::array<float,2>{0.418549091f, 0.352887332f},
-std::array<float,2>{0.0362254381f, 0.72518748f},
-std::array<float,2>{0.960009038f, 0.0935580656f},
-std::array<float,2>{0.703758776f, 0.546764255f},
-std::array<float,2>{0.453132302f, 0.128022626f},
-std::array<float,2>{0.0908364952f, 0.95345515f},
-std::array<float,2>{0.885384142f, 0.379796326f},
-std::array<float,2>{0.785630822f, 0.867210984f},
-std::array<float,2>{0.142345175f, 0.26263544f},
-std::array<float,2>{0.283991963f, 0.626792908f},
-std::array<float,2>{0.618166387f, 0.0206255149f},
-std::array<float,2>{0.986789227f, 0.712291658f},
-std::array<float,2>{0.0301193409f, 0.119105168f},
-std::array<float,2>{0.392076194f, 0.776910365f},
-std::array<float,2>{0.632845521f, 0.338097662f},
-std::array<float,2>{0.553523123f, 0.891194284f},
-std::array<float,2>{0.364927948f, 0.445443571f},
-std::array<float,2>{0.218671545f, 0.579625428f},
-std::array<float,2>{0.870989978f, 0.243313268f},
-std::array<float,2>{0.64628011f, 0.740057588f},
-std::array<float,2>{0.386695325f, 0.0742774829f},
-std::array<float,2>{0.014252211f, 0.795041621f},
-std::array<float,2>{0.98048991f, 0.36585331f},
-std::array<float,2>{0.854497969f, 0.932830334f},
-std::array<float,2>{0.196049094f, 0.482210726f},
-std::array<float,2>{0.356285691f, 0.597328484f},
-std::array<float,2>{0.544676065f, 0.202845037f},
-std::array<float,2>{0.901156545f, 0.516011238f},
-std::array<float,2>{0.0663938597f, 0.168685243f},
-std::array<float,2>{0.439212948f, 0.975713253f},
-std::array<float,2>{0.699868202f, 0.424467534f},
-std::array<float,2>{0.595338106f, 0.820390165f},
-std::array<float,2>{0.300549626f, 0.295757353f},
-std::array<float,2>{0.135214627f, 0.669026852f},
-std::array<float,2>{0.808156788f, 0.0457769819f},
-std::array<float,2>{0.504532337f, 0.574115276f},
-std::array<float,2>{0.336559683f, 0.230921403f},
-std::array<float,2>{0.242499098f, 0.878033817f},
-std::array<float,2>{0.838776231f, 0.461743861f},
-std::array<float,2>{0.952929974f, 0.759438574f},
-std::array<float,2>{0.0472634621f, 0.325832397f},
-std::array<float,2>{0.425517261f, 0.699432135f},
-std::array<float,2>{0.682489276f, 0.101842195f},
-std::array<float,2>{0.761560202f, 0.645688772f},
-std::array<float,2>{0.16396533f, 0.00129800185f},
-std::array<float,2>{0.274707794f, 0.846746564f},
-std::array<float,2>{0.574066579f, 0.276098013f},
-std::array<float,2>{0.733527124f, 0.94374299f},
-std::array<float,2>{0.485215485f, 0.405594736f},
-std::array<float,2>{0.110616669f, 0.551903307f},
-std::array<float,2>{0.922580481f, 0.141127765f},
-std::array<float,2>{0.603357375f, 0.721105158f},
-std::array<float,2>{0.311166048f, 0.087177515f},
-std::array<float,2>{0.126349926f, 0.797896266f},
-std::array<float,2>{0.799822509f, 0.356413633f},
-std::array<float,2>{0.893329144f, 0.908461094f},
-std::array<float,2>{0.0751100332f, 0.49781552f},
-std::array<float,2>{0.449539214f, 0.616270244f},
-std::array<float,2>{0.688563526f, 0.210205197f},
-std::array<float,2>{0.847628832f, 0.505795598f},
-std::array<float,2>{0.192602128f, 0.173074991f},
-std::array<float,2>{0.348197013f, 0.987418115f},
-std::array<float,2>{0.538154125f, 0.415207475f},
-std::array<float,2>{0.649419963f, 0.838059962f},
-std::array<float,2>{0.375950307f, 0.305529863f},
-std::array<float,2>{0.00465792604f, 0.684206665f},
-std::array<float,2>{0.976310909f, 0.0537112616f},
-std::array<float,2>{0.719245434f, 0.585624576f},
-std::array<float,2>{0.494539052f, 0.248674318f},
-std::array<float,2>{0.122571692f, 0.896632373f},
-std::array<float,2>{0.93019855f, 0.450635642f},
-std::array<float,2>{0.754403353f, 0.780108452f},
-std::array<float,2>{0.164361537f, 0.340024799f},
-std::array<float,2>{0.265697539f, 0.718526781f},
-std::array<float,2>{0.569575191f, 0.124452889f},
-std::array<float,2>{0.937678933f, 0.630546987f},
-std::array<float,2>{0.0566867627f, 0.0192288421f},
-std::array<float,2>{0.4343189f, 0.872580886f},
-std::array<float,2>{0.675619781f, 0.259533465f},
-std::array<float,2>{0.51039803f, 0.958232939f},
-std::array<float,2>{0.332283676f, 0.377166718f},
-std::array<float,2>{0.237706721f, 0.542437434f},
-std::array<float,2>{0.833282173f, 0.129713297f},
-std::array<float,2>{0.66625613f, 0.66711998f},
-std::array<float,2>{0.410286665f, 0.0401308276f},
-std::array<float,2>{0.0457436405f, 0.825636387f},
-std::array<float,2>{0.966618121f, 0.290474504f},
-std::array<float,2>{0.822614849f, 0.969599426f},
-std::array<float,2>{0.219127223f, 0.426463813f},
-std::array<float,2>{0.317494959f, 0.522072732f},
-std::array<float,2>{0.529523909f, 0.164168939f},
-std::array<float,2>{0.912024319f, 0.598636568f},
-std::array<float,2>{0.0956099108f, 0.198688418f},
-std::array<float,2>{0.475360364f, 0.934777915f},
-std::array<float,2>{0.74794209f, 0.477960944f},
-std::array<float,2>{0.591590524f, 0.789147198f},
-std::array<float,2>{0.25189963f, 0.361416817f},
-std::array<float,2>{0.180690929f, 0.7363621f},
-std::array<float,2>{0.766105473f, 0.0724920258f},
-std::array<float,2>{0.556835949f, 0.550302148f},
-std::array<float,2>{0.372752935f, 0.144722983f},
-std::array<float,2>{0.203920677f, 0.939392924f},
-std::array<float,2>{0.860434413f, 0.399765998f},
-std::array<float,2>{0.993536234f, 0.850649476f},
-std::array<float,2>{0.0181876551f, 0.278657615f},
-std::array<float,2>{0.39866513f, 0.642320275f},
-std::array<float,2>{0.629469812f, 0.00549488887f},
-std::array<float,2>{0.792614937f, 0.696353793f},
-std::array<float,2>{0.153880477f, 0.108224235f},
-std::array<float,2>{0.292426854f, 0.765111029f},
-std::array<float,2>{0.613848448f, 0.321969122f},
-std::array<float,2>{0.718505979f, 0.881381273f},
-std::array<float,2>{0.466454864f, 0.465660959f},
-std::array<float,2>{0.0796131194f, 0.577574492f},
-std::array<float,2>{0.879992187f, 0.226785064f},
-std::array<float,2>{0.518754423f, 0.649496615f},
-std::array<float,2>{0.322330177f, 0.0105595225f},
-std::array<float,2>{0.233385637f, 0.853527308f},
-std::array<float,2>{0.818737328f, 0.266257852f},
-std::array<float,2>{0.953783631f, 0.946912408f},
-std::array<float,2>{0.0350123011f, 0.391872644f},
-std::array<float,2>{0.41545102f, 0.561705172f},
-std::array<float,2>{0.662400961f, 0.152207762f},
-std::array<float,2>{0.778011203f, 0.562888145f},
-std::array<float,2>{0.171981275f, 0.221399769f},
-std::array<float,2>{0.258280545f, 0.883152604f},
-std::array<float,2>{0.578356087f, 0.459717214f},
-std::array<float,2>{0.741371453f, 0.751616001f},
-std::array<float,2>{0.477178961f, 0.316352695f},
-std::array<float,2>{0.104469523f, 0.695042908f},
-std::array<float,2>{0.919959903f, 0.0982354656f},
-std::array<float,2>{0.638848364f, 0.527647078f},
-std::array<float,2>{0.395251334f, 0.162743598f},
-std::array<float,2>{0.0255607497f, 0.982390404f},
-std::array<float,2>{0.991143286f, 0.435417265f},
-std::array<float,2>{0.874817133f, 0.819919169f},
-std::array<float,2>{0.213122368f, 0.2818048f},
-std::array<float,2>{0.361253232f, 0.65851146f},
-std::array<float,2>{0.546997368f, 0.0350909308f},
-std::array<float,2>{0.890319645f, 0.749425054f},
-std::array<float,2>{0.087413393f, 0.0636035725f},
-std::array<float,2>{0.457328528f, 0.78902024f},
-std::array<float,2>{0.709733665f, 0.369790077f},
-std::array<float,2>{0.621749163f, 0.925371885f},
-std::array<float,2>{0.288758188f, 0.473494411f},
-std::array<float,2>{0.145995662f, 0.606438279f},
-std::array<float,2>{0.784803808f, 0.194293752f},
-std::array<float,2>{0.697488904f, 0.706465423f},
-std::array<float,2>{0.442501366f, 0.111199729f},
-std::array<float,2>{0.0700940937f, 0.771514118f},
-std::array<float,2>{0.904570401f, 0.331958115f},
-std::array<float,2>{0.80951333f, 0.901273549f},
-std::array<float,2>{0.138174906f, 0.437699676f},
-std::array<float,2>{0.303764313f, 0.589718699f},
-std::array<float,2>{0.598738372f, 0.240373462f},
-std::array<float,2>{0.978383183f, 0.538650513f},
-std::array<float,2>{0.0110421898f, 0.138450027f},
-std::array<float,2>{0.38680619f, 0.962921143f},
-std::array<float,2>{0.642706215f, 0.388338178f},
-std::array<float,2>{0.539522171f, 0.862356424f},
-std::array<float,2>{0.351757586f, 0.253908873f},
-std::array<float,2>{0.201132819f, 0.637054265f},
-std::array<float,2>{0.859370589f, 0.0248723961f},
-std::array<float,2>{0.575991094f, 0.624111652f},
-std::array<float,2>{0.277659535f, 0.213091284f},
-std::array<float,2>{0.158820406f, 0.914875031f},
-std::array<float,2>{0.764345229f, 0.491900414f},
-std::array<float,2>{0.926047504f, 0.809270024f},
-std::array<float,2>{0.114100002f, 0.345103055f},
-std::array<float,2>{0.491937399f, 0.728056312f},
-std::array<float,2>{0.729183853f, 0.0809874833f},
-std::array<float,2>{0.842911959f, 0.67785269f},
-std::array<float,2>{0.249070868f, 0.0622343533f},
-std::array<float,2>{0.343726307f, 0.831148148f},
-std::array<float,2>{0.500136018f, 0.301804841f},
-std::array<float,2>{0.685007274f, 0.996257961f},
-std::array<float,2>{0.427913785f, 0.412702739f},
-std::array<float,2>{0.0523903035f, 0.50870651f},
-std::array<float,2>{0.946180403f, 0.184827104f},
-std::array<float,2>{0.560965002f, 0.730714083f},
-std::array<float,2>{0.369019955f, 0.082712844f},
-std::array<float,2>{0.209277168f, 0.805520356f},
-std::array<float,2>{0.864772022f, 0.34849751f},
-std::array<float,2>{0.99859339f, 0.921621442f},
-std::array<float,2>{0.0228526276f, 0.485135198f},
-std::array<float,2>{0.406238109f, 0.619687796f},
-std::array<float,2>{0.626517951f, 0.217943206f},
-std::array<float,2>{0.795854092f, 0.513606429f},
-std::array<float,2>{0.150163889f, 0.182834864f},
-std::array<float,2>{0.294972241f, 0.99430567f},
-std::array<float,2>{0.612940967f, 0.408722848f},
-std::array<float,2>{0.711632669f, 0.833818853f},
-std::array<float,2>{0.462355286f, 0.298419029f},
-std::array<float,2>{0.0832582563f, 0.674393475f},
-std::array<float,2>{0.878556848f, 0.0580573492f},
-std::array<float,2>{0.668046534f, 0.59272486f},
-std::array<float,2>{0.407532245f, 0.235682175f},
-std::array<float,2>{0.0428260528f, 0.903768301f},
-std::array<float,2>{0.962840497f, 0.443596184f},
-std::array<float,2>{0.827015698f, 0.767445147f},
-std::array<float,2>{0.226002008f, 0.334999263f},
-std::array<float,2>{0.314004928f, 0.709853232f},
-std::array<float,2>{0.527264595f, 0.113648161f},
-std::array<float,2>{0.908443928f, 0.633485973f},
-std::array<float,2>{0.100971714f, 0.0287526827f},
-std::array<float,2>{0.470219404f, 0.865170658f},
-std::array<float,2>{0.743427634f, 0.252920091f},
-std::array<float,2>{0.586418986f, 0.965108037f},
-std::array<float,2>{0.257276326f, 0.383259654f},
-std::array<float,2>{0.184765711f, 0.531914175f},
-std::array<float,2>{0.770933151f, 0.134775296f},
-std::array<float,2>{0.722867668f, 0.661141932f},
-std::array<float,2>{0.499565989f, 0.0388901643f},
-std::array<float,2>{0.120945595f, 0.815914094f},
-std::array<float,2>{0.934701383f, 0.287019283f},
-std::array<float,2>{0.751689255f, 0.979823589f},
-std::array<float,2>{0.168606684f, 0.433284909f},
-std::array<float,2>{0.271817893f, 0.525992036f},
-std::array<float,2>{0.565817177f, 0.160075322f},
-std::array<float,2>{0.941753745f, 0.602514148f},
-std::array<float,2>{0.0604608878f, 0.18891795f},
-std::array<float,2>{0.430417836f, 0.927682459f},
-std::array<float,2>{0.679680288f, 0.471146673f},
-std::array<float,2>{0.513882339f, 0.785088658f},
-std::array<float,2>{0.329977453f, 0.371825576f},
-std::array<float,2>{0.239721015f, 0.745460927f},
-std::array<float,2>{0.829895854f, 0.0685041472f},
-std::array<float,2>{0.60626936f, 0.557712853f},
-std::array<float,2>{0.306710929f, 0.153286964f},
-std::array<float,2>{0.129566416f, 0.951836169f},
-std::array<float,2>{0.803966105f, 0.395608693f},
-std::array<float,2>{0.895967782f, 0.856832683f},
-std::array<float,2>{0.0718018338f, 0.271762043f},
-std::array<float,2>{0.447558314f, 0.655652225f},
-std::array<float,2>{0.693396986f, 0.0132684102f},
-std::array<float,2>{0.849922299f, 0.68993783f},
-std::array<float,2>{0.188144848f, 0.0971496999f},
-std::array<float,2>{0.34398219f, 0.754016757f},
-std::array<float,2>{0.531692147f, 0.317205578f},
-std::array<float,2>{0.652691782f, 0.889690816f},
-std::array<float,2>{0.380371809f, 0.45507291f},
-std::array<float,2>{0.00104115484f, 0.566927731f},
-std::array<float,2>{0.968758702f, 0.226024374f},
-std::array<float,2>{0.572325587f, 0.648260474f},
-std::array<float,2>{0.273632884f, 0.00287754601f},
-std::array<float,2>{0.162345245f, 0.845679581f},
-std::array<float,2>{0.760360062f, 0.274207592f},
-std::array<float,2>{0.923103869f, 0.943147957f},
-std::array<float,2>{0.109411865f, 0.402565718f},
-std::array<float,2>{0.485428989f, 0.554157853f},
-std::array<float,2>{0.73295778f, 0.143636584f},
-std::array<float,2>{0.839601994f, 0.571162045f},
-std::array<float,2>{0.243620589f, 0.232805312f},
-std::array<float,2>{0.337161988f, 0.875346839f},
-std::array<float,2>{0.505805373f, 0.463746578f},
-std::array<float,2>{0.683432877f, 0.759987772f},
-std::array<float,2>{0.424491018f, 0.327294856f},
-std::array<float,2>{0.0480336361f, 0.702846229f},
-std::array<float,2>{0.951882303f, 0.103655495f},
-std::array<float,2>{0.700727284f, 0.518693686f},
-std::array<float,2>{0.437750757f, 0.169957638f},
-std::array<float,2>{0.0648509338f, 0.974090397f},
-std::array<float,2>{0.90171355f, 0.422297537f},
-std::array<float,2>{0.807040572f, 0.823450387f},
-std::array<float,2>{0.136273786f, 0.293034762f},
-std::array<float,2>{0.299442202f, 0.671064198f},
-std::array<float,2>{0.594569325f, 0.0445799828f},
-std::array<float,2>{0.981577873f, 0.740351975f},
-std::array<float,2>{0.0154553987f, 0.0772150904f},
-std::array<float,2>{0.385036469f, 0.793498993f},
-std::array<float,2>{0.645272017f, 0.36388284f},
-std::array<float,2>{0.54357338f, 0.930751622f},
-std::array<float,2>{0.357176602f, 0.483971f},
-std::array<float,2>{0.196656302f, 0.594773829f},
-std::array<float,2>{0.853537917f, 0.199888557f},
-std::array<float,2>{0.634553015f, 0.713013053f},
-std::array<float,2>{0.391250849f, 0.119567841f},
-std::array<float,2>{0.0307473745f, 0.774629116f},
-std::array<float,2>{0.987807393f, 0.336207598f},
-std::array<float,2>{0.870074868f, 0.892929018f},
-std::array<float,2>{0.217372343f, 0.448913455f},
-std::array<float,2>{0.36331737f, 0.581296444f},
-std::array<float,2>{0.553762257f, 0.24501951f},
-std::array<float,2>{0.88587141f, 0.543929458f},
-std::array<float,2>{0.0900467634f, 0.125324622f},
-std::array<float,2>{0.454367131f, 0.9568097f},
-std::array<float,2>{0.704257429f, 0.38255015f},
-std::array<float,2>{0.617576122f, 0.870244026f},
-std::array<float,2>{0.284771293f, 0.263763279f},
-std::array<float,2>{0.140695512f, 0.628575861f},
-std::array<float,2>{0.786349535f, 0.0233625602f},
-std::array<float,2>{0.521208405f, 0.610051095f},
-std::array<float,2>{0.327022791f, 0.206158891f},
-std::array<float,2>{0.229146957f, 0.911439538f},
-std::array<float,2>{0.813114583f, 0.495972723f},
-std::array<float,2>{0.959334016f, 0.803072989f},
-std::array<float,2>{0.0360538252f, 0.354562134f},
-std::array<float,2>{0.419702023f, 0.723033249f},
-std::array<float,2>{0.658618093f, 0.0917412862f},
-std::array<float,2>{0.774316609f, 0.681446195f},
-std::array<float,2>{0.176964179f, 0.0495463014f},
-std::array<float,2>{0.262798965f, 0.841272175f},
-std::array<float,2>{0.583803594f, 0.31041047f},
-std::array<float,2>{0.735254407f, 0.988562107f},
-std::array<float,2>{0.484144598f, 0.420968682f},
-std::array<float,2>{0.107339092f, 0.502138972f},
-std::array<float,2>{0.916249514f, 0.177373275f},
-std::array<float,2>{0.61498934f, 0.697397947f},
-std::array<float,2>{0.291278571f, 0.105860993f},
-std::array<float,2>{0.153021246f, 0.76189959f},
-std::array<float,2>{0.791821301f, 0.323448539f},
-std::array<float,2>{0.879851997f, 0.879615545f},
-std::array<float,2>{0.0790056437f, 0.466862828f},
-std::array<float,2>{0.465212911f, 0.574239254f},
-std::array<float,2>{0.717496932f, 0.228639841f},
-std::array<float,2>{0.85945344f, 0.547293723f},
-std::array<float,2>{0.204417214f, 0.148060381f},
-std::array<float,2>{0.371497244f, 0.940581858f},
-std::array<float,2>{0.558116496f, 0.402025133f},
-std::array<float,2>{0.630011022f, 0.847971797f},
-std::array<float,2>{0.400173843f, 0.280240208f},
-std::array<float,2>{0.0187949426f, 0.643821239f},
-std::array<float,2>{0.992577374f, 0.00717055937f},
-std::array<float,2>{0.747067392f, 0.601018429f},
-std::array<float,2>{0.476439625f, 0.19547604f},
-std::array<float,2>{0.0940180942f, 0.937128365f},
-std::array<float,2>{0.910923243f, 0.479853511f},
-std::array<float,2>{0.766805947f, 0.791269839f},
-std::array<float,2>{0.179982573f, 0.361151069f},
-std::array<float,2>{0.250671774f, 0.735394478f},
-std::array<float,2>{0.590423584f, 0.0718621761f},
-std::array<float,2>{0.965662181f, 0.665143907f},
-std::array<float,2>{0.0468397029f, 0.0415130444f},
-std::array<float,2>{0.411921889f, 0.827689111f},
-std::array<float,2>{0.667526066f, 0.291961432f},
-std::array<float,2>{0.530512869f, 0.972605765f},
-std::array<float,2>{0.317032635f, 0.42814067f},
-std::array<float,2>{0.220375925f, 0.519973874f},
-std::array<float,2>{0.823245883f, 0.166557044f},
-std::array<float,2>{0.674295008f, 0.632749617f},
-std::array<float,2>{0.435039192f, 0.015669629f},
-std::array<float,2>{0.0581001155f, 0.873259366f},
-std::array<float,2>{0.938831151f, 0.260209173f},
-std::array<float,2>{0.832818985f, 0.959082246f},
-std::array<float,2>{0.237074733f, 0.375730932f},
-std::array<float,2>{0.333092272f, 0.540323377f},
-std::array<float,2>{0.511258423f, 0.131383136f},
-std::array<float,2>{0.931423485f, 0.583642721f},
-std::array<float,2>{0.121311218f, 0.247996598f},
-std::array<float,2>{0.495889068f, 0.895451546f},
-std::array<float,2>{0.720159769f, 0.452473968f},
-std::array<float,2>{0.569227815f, 0.778446257f},
-std::array<float,2>{0.267101258f, 0.343720108f},
-std::array<float,2>{0.165653393f, 0.716142595f},
-std::array<float,2>{0.755687475f, 0.122460723f},
-std::array<float,2>{0.537863851f, 0.507758617f},
-std::array<float,2>{0.348776489f, 0.174043104f},
-std::array<float,2>{0.191781431f, 0.985944927f},
-std::array<float,2>{0.845891893f, 0.416041493f},
-std::array<float,2>{0.975002229f, 0.836429477f},
-std::array<float,2>{0.00553919002f, 0.308046669f},
-std::array<float,2>{0.376060575f, 0.68647629f},
-std::array<float,2>{0.649141967f, 0.0510418043f},
-std::array<float,2>{0.7996099f, 0.71921134f},
-std::array<float,2>{0.125970751f, 0.0884811133f},
-std::array<float,2>{0.311641902f, 0.799989641f},
-std::array<float,2>{0.601988912f, 0.357819408f},
-std::array<float,2>{0.688340068f, 0.907240987f},
-std::array<float,2>{0.45035252f, 0.498722643f},
-std::array<float,2>{0.0753312409f, 0.615143776f},
-std::array<float,2>{0.89414525f, 0.20768325f},
-std::array<float,2>{0.501305759f, 0.676256657f},
-std::array<float,2>{0.342396498f, 0.0599104986f},
-std::array<float,2>{0.248502403f, 0.829203963f},
-std::array<float,2>{0.842264056f, 0.304385662f},
-std::array<float,2>{0.946980655f, 0.999671459f},
-std::array<float,2>{0.0517236106f, 0.410792887f},
-std::array<float,2>{0.429035962f, 0.511300504f},
-std::array<float,2>{0.684389889f, 0.186676353f},
-std::array<float,2>{0.765205562f, 0.621933699f},
-std::array<float,2>{0.159561276f, 0.211580351f},
-std::array<float,2>{0.278878689f, 0.917916f},
-std::array<float,2>{0.574350178f, 0.488988042f},
-std::array<float,2>{0.729903042f, 0.810741901f},
-std::array<float,2>{0.491027743f, 0.345971286f},
-std::array<float,2>{0.114861995f, 0.72985512f},
-std::array<float,2>{0.92730099f, 0.0798124522f},
-std::array<float,2>{0.644054294f, 0.535393834f},
-std::array<float,2>{0.388288796f, 0.139752209f},
-std::array<float,2>{0.0104175443f, 0.961124599f},
-std::array<float,2>{0.977410436f, 0.389247447f},
-std::array<float,2>{0.858268201f, 0.861099005f},
-std::array<float,2>{0.199872077f, 0.256398529f},
-std::array<float,2>{0.353082687f, 0.639615953f},
-std::array<float,2>{0.540356517f, 0.0257293601f},
-std::array<float,2>{0.905762732f, 0.703440785f},
-std::array<float,2>{0.0689248145f, 0.112285905f},
-std::array<float,2>{0.441626638f, 0.77069509f},
-std::array<float,2>{0.699051797f, 0.328231066f},
-std::array<float,2>{0.598413765f, 0.899234056f},
-std::array<float,2>{0.303654134f, 0.439858407f},
-std::array<float,2>{0.136825815f, 0.586945713f},
-std::array<float,2>{0.809922576f, 0.238699809f},
-std::array<float,2>{0.710329175f, 0.746347666f},
-std::array<float,2>{0.458423585f, 0.0658988059f},
-std::array<float,2>{0.0859522894f, 0.785657048f},
-std::array<float,2>{0.88876152f, 0.367629558f},
-std::array<float,2>{0.78408736f, 0.922067523f},
-std::array<float,2>{0.145052612f, 0.476365954f},
-std::array<float,2>{0.287568361f, 0.608136356f},
-std::array<float,2>{0.622254968f, 0.191595763f},
-std::array<float,2>{0.991730213f, 0.530638516f},
-std::array<float,2>{0.0263690203f, 0.161719114f},
-std::array<float,2>{0.395697445f, 0.984138787f},
-std::array<float,2>{0.640296042f, 0.43660146f},
-std::array<float,2>{0.54874754f, 0.817971766f},
-std::array<float,2>{0.360195428f, 0.283943653f},
-std::array<float,2>{0.214066431f, 0.657844126f},
-std::array<float,2>{0.873830438f, 0.032090921f},
-std::array<float,2>{0.579887807f, 0.565960526f},
-std::array<float,2>{0.259222955f, 0.220007926f},
-std::array<float,2>{0.17307438f, 0.884839892f},
-std::array<float,2>{0.77867502f, 0.457848489f},
-std::array<float,2>{0.921338499f, 0.752123058f},
-std::array<float,2>{0.105165087f, 0.313255101f},
-std::array<float,2>{0.477989644f, 0.692668259f},
-std::array<float,2>{0.74055171f, 0.101009853f},
-std::array<float,2>{0.819689035f, 0.65133971f},
-std::array<float,2>{0.233504608f, 0.00806905888f},
-std::array<float,2>{0.323936462f, 0.853253305f},
-std::array<float,2>{0.517650068f, 0.268894285f},
-std::array<float,2>{0.663926423f, 0.947639942f},
-std::array<float,2>{0.414478004f, 0.393243045f},
-std::array<float,2>{0.0341081582f, 0.560002625f},
-std::array<float,2>{0.954347968f, 0.149292514f},
-std::array<float,2>{0.524588108f, 0.707083523f},
-std::array<float,2>{0.314834356f, 0.115554586f},
-std::array<float,2>{0.222983554f, 0.768555522f},
-std::array<float,2>{0.8251701f, 0.33279267f},
-std::array<float,2>{0.963538647f, 0.906109154f},
-std::array<float,2>{0.0392497182f, 0.4415389f},
-std::array<float,2>{0.408493549f, 0.590186834f},
-std::array<float,2>{0.671395123f, 0.23807998f},
-std::array<float,2>{0.772599399f, 0.534526944f},
-std::array<float,2>{0.186250895f, 0.134668395f},
-std::array<float,2>{0.255459398f, 0.967225134f},
-std::array<float,2>{0.587993741f, 0.385492444f},
-std::array<float,2>{0.746008337f, 0.866245687f},
-std::array<float,2>{0.47122094f, 0.251659036f},
-std::array<float,2>{0.0993264169f, 0.636303246f},
-std::array<float,2>{0.90728879f, 0.0312436726f},
-std::array<float,2>{0.628280461f, 0.618799627f},
-std::array<float,2>{0.403386682f, 0.21542111f},
-std::array<float,2>{0.0195503961f, 0.918310702f},
-std::array<float,2>{0.997037709f, 0.48815462f},
-std::array<float,2>{0.867086291f, 0.806684434f},
-std::array<float,2>{0.207096294f, 0.351542413f},
-std::array<float,2>{0.370761514f, 0.733380973f},
-std::array<float,2>{0.55865103f, 0.0839949995f},
-std::array<float,2>{0.875075877f, 0.672736704f},
-std::array<float,2>{0.0853644609f, 0.0556515083f},
-std::array<float,2>{0.4641608f, 0.835590601f},
-std::array<float,2>{0.713861406f, 0.29991287f},
-std::array<float,2>{0.610579789f, 0.993464708f},
-std::array<float,2>{0.293010503f, 0.406801969f},
-std::array<float,2>{0.150637925f, 0.514303207f},
-std::array<float,2>{0.793107152f, 0.181058571f},
-std::array<float,2>{0.692527354f, 0.65358901f},
-std::array<float,2>{0.445457846f, 0.0154982358f},
-std::array<float,2>{0.0741774663f, 0.857842386f},
-std::array<float,2>{0.89721179f, 0.26987493f},
-std::array<float,2>{0.801988184f, 0.949698806f},
-std::array<float,2>{0.130929038f, 0.398382485f},
-std::array<float,2>{0.306177914f, 0.556626797f},
-std::array<float,2>{0.608783007f, 0.155572802f},
-std::array<float,2>{0.972098708f, 0.569419861f},
-std::array<float,2>{0.00267660245f, 0.222851396f},
-std::array<float,2>{0.380968004f, 0.887654364f},
-std::array<float,2>{0.654384971f, 0.456956416f},
-std::array<float,2>{0.535118997f, 0.756454945f},
-std::array<float,2>{0.347229898f, 0.318775803f},
-std::array<float,2>{0.190964416f, 0.688535869f},
-std::array<float,2>{0.848419189f, 0.095535256f},
-std::array<float,2>{0.563028574f, 0.523508668f},
-std::array<float,2>{0.270447284f, 0.157752454f},
-std::array<float,2>{0.171402633f, 0.97737962f},
-std::array<float,2>{0.752152801f, 0.43160367f},
-std::array<float,2>{0.937339902f, 0.814221203f},
-std::array<float,2>{0.118825726f, 0.288149446f},
-std::array<float,2>{0.497128963f, 0.663235366f},
-std::array<float,2>{0.725391805f, 0.0355328918f},
-std::array<float,2>{0.830808103f, 0.742817223f},
-std::array<float,2>{0.241422936f, 0.0674809739f},
-std::array<float,2>{0.331138402f, 0.781837821f},
-std::array<float,2>{0.513430417f, 0.373970538f},
-std::array<float,2>{0.676563323f, 0.929168105f},
-std::array<float,2>{0.433022082f, 0.47034812f},
-std::array<float,2>{0.0618596226f, 0.604279995f},
-std::array<float,2>{0.944921315f, 0.190276265f},
-std::array<float,2>{0.595920742f, 0.668101072f},
-std::array<float,2>{0.297388464f, 0.0465984158f},
-std::array<float,2>{0.133250356f, 0.822024465f},
-std::array<float,2>{0.805507958f, 0.296209514f},
-std::array<float,2>{0.89964968f, 0.974949062f},
-std::array<float,2>{0.0627942905f, 0.425473213f},
-std::array<float,2>{0.441146374f, 0.516971409f},
-std::array<float,2>{0.701761186f, 0.169052377f},
-std::array<float,2>{0.853230655f, 0.596556842f},
-std::array<float,2>{0.198378906f, 0.201239407f},
-std::array<float,2>{0.357729167f, 0.932200253f},
-std::array<float,2>{0.545895994f, 0.481155246f},
-std::array<float,2>{0.647184014f, 0.79638344f},
-std::array<float,2>{0.38375017f, 0.366692275f},
-std::array<float,2>{0.0122724595f, 0.738601565f},
-std::array<float,2>{0.984005034f, 0.0753708705f},
-std::array<float,2>{0.732038736f, 0.551484406f},
-std::array<float,2>{0.487247735f, 0.142396182f},
-std::array<float,2>{0.112922415f, 0.944557726f},
-std::array<float,2>{0.925226033f, 0.404663146f},
-std::array<float,2>{0.75891459f, 0.845809877f},
-std::array<float,2>{0.160370603f, 0.276781261f},
-std::array<float,2>{0.275606364f, 0.645306885f},
-std::array<float,2>{0.571848333f, 0.000657473924f},
-std::array<float,2>{0.951068938f, 0.701121688f},
-std::array<float,2>{0.0488637388f, 0.103048533f},
-std::array<float,2>{0.4233329f, 0.758304656f},
-std::array<float,2>{0.680336177f, 0.324235827f},
-std::array<float,2>{0.506119967f, 0.877781332f},
-std::array<float,2>{0.339688122f, 0.462469608f},
-std::array<float,2>{0.245376766f, 0.572279036f},
-std::array<float,2>{0.837110221f, 0.231822953f},
-std::array<float,2>{0.657832623f, 0.725843489f},
-std::array<float,2>{0.420427293f, 0.0920827389f},
-std::array<float,2>{0.0372312665f, 0.800891101f},
-std::array<float,2>{0.957140267f, 0.351774782f},
-std::array<float,2>{0.816206098f, 0.913959384f},
-std::array<float,2>{0.227759719f, 0.49262175f},
-std::array<float,2>{0.32613343f, 0.611661136f},
-std::array<float,2>{0.521866739f, 0.20408389f},
-std::array<float,2>{0.915583789f, 0.500202119f},
-std::array<float,2>{0.108028576f, 0.178456709f},
-std::array<float,2>{0.481274903f, 0.991687834f},
-std::array<float,2>{0.737682521f, 0.418900907f},
-std::array<float,2>{0.584847271f, 0.841908991f},
-std::array<float,2>{0.265598059f, 0.31133762f},
-std::array<float,2>{0.179518104f, 0.682169497f},
-std::array<float,2>{0.777155161f, 0.0470981188f},
-std::array<float,2>{0.552006662f, 0.578737736f},
-std::array<float,2>{0.366713792f, 0.242696851f},
-std::array<float,2>{0.216008171f, 0.892576039f},
-std::array<float,2>{0.867454648f, 0.44708249f},
-std::array<float,2>{0.985693991f, 0.775623381f},
-std::array<float,2>{0.0281213094f, 0.339697659f},
-std::array<float,2>{0.393101513f, 0.711216509f},
-std::array<float,2>{0.635398746f, 0.117482007f},
-std::array<float,2>{0.788158178f, 0.625303209f},
-std::array<float,2>{0.144210294f, 0.0198709611f},
-std::array<float,2>{0.282802731f, 0.868786812f},
-std::array<float,2>{0.619190514f, 0.262969822f},
-std::array<float,2>{0.706128299f, 0.954429805f},
-std::array<float,2>{0.456254274f, 0.379893214f},
-std::array<float,2>{0.0923420861f, 0.545550168f},
-std::array<float,2>{0.882917106f, 0.127154991f},
-std::array<float,2>{0.592589617f, 0.737483263f},
-std::array<float,2>{0.252206802f, 0.0737874806f},
-std::array<float,2>{0.181714535f, 0.790229023f},
-std::array<float,2>{0.768194139f, 0.36248222f},
-std::array<float,2>{0.913557053f, 0.933932662f},
-std::array<float,2>{0.0973474309f, 0.477108419f},
-std::array<float,2>{0.473097324f, 0.598058283f},
-std::array<float,2>{0.749269426f, 0.197971284f},
-std::array<float,2>{0.821375072f, 0.522723258f},
-std::array<float,2>{0.220768318f, 0.165850863f},
-std::array<float,2>{0.318602055f, 0.970104039f},
-std::array<float,2>{0.528486848f, 0.427349597f},
-std::array<float,2>{0.666000962f, 0.824378788f},
-std::array<float,2>{0.414057672f, 0.289803535f},
-std::array<float,2>{0.0429795757f, 0.666060269f},
-std::array<float,2>{0.968692183f, 0.0395450592f},
-std::array<float,2>{0.715314329f, 0.57680285f},
-std::array<float,2>{0.468505949f, 0.228449002f},
-std::array<float,2>{0.0814850703f, 0.881908476f},
-std::array<float,2>{0.882565379f, 0.466302574f},
-std::array<float,2>{0.790435195f, 0.764387727f},
-std::array<float,2>{0.155855119f, 0.320848823f},
-std::array<float,2>{0.289497197f, 0.695688188f},
-std::array<float,2>{0.61614722f, 0.109089613f},
-std::array<float,2>{0.995282233f, 0.641062081f},
-std::array<float,2>{0.0174688995f, 0.00469262805f},
-std::array<float,2>{0.401027888f, 0.849951148f},
-std::array<float,2>{0.632249296f, 0.277576447f},
-std::array<float,2>{0.554881811f, 0.937829316f},
-std::array<float,2>{0.374491036f, 0.398752004f},
-std::array<float,2>{0.205659494f, 0.549602091f},
-std::array<float,2>{0.861513257f, 0.145915762f},
-std::array<float,2>{0.650441647f, 0.685166955f},
-std::array<float,2>{0.378493965f, 0.0537059642f},
-std::array<float,2>{0.0069044265f, 0.838928044f},
-std::array<float,2>{0.974335611f, 0.306207597f},
-std::array<float,2>{0.845383167f, 0.987138867f},
-std::array<float,2>{0.195179507f, 0.414940238f},
-std::array<float,2>{0.350084126f, 0.504244566f},
-std::array<float,2>{0.535242856f, 0.172336683f},
-std::array<float,2>{0.890685916f, 0.615716755f},
-std::array<float,2>{0.0763541386f, 0.209437966f},
-std::array<float,2>{0.452952862f, 0.909266353f},
-std::array<float,2>{0.690906882f, 0.49706471f},
-std::array<float,2>{0.603517294f, 0.797192156f},
-std::array<float,2>{0.309882253f, 0.357313991f},
-std::array<float,2>{0.128743753f, 0.722126126f},
-std::array<float,2>{0.797830403f, 0.0860761628f},
-std::array<float,2>{0.50883919f, 0.54154253f},
-std::array<float,2>{0.334263623f, 0.130469799f},
-std::array<float,2>{0.234441444f, 0.957512796f},
-std::array<float,2>{0.835336566f, 0.378645569f},
-std::array<float,2>{0.939624429f, 0.871773243f},
-std::array<float,2>{0.056107413f, 0.25824362f},
-std::array<float,2>{0.43568179f, 0.629510581f},
-std::array<float,2>{0.672241211f, 0.0184209738f},
-std::array<float,2>{0.756767273f, 0.717375755f},
-std::array<float,2>{0.166719466f, 0.12392281f},
-std::array<float,2>{0.268620759f, 0.781037986f},
-std::array<float,2>{0.566539288f, 0.341301978f},
-std::array<float,2>{0.722046852f, 0.897744775f},
-std::array<float,2>{0.493513048f, 0.450099736f},
-std::array<float,2>{0.124874838f, 0.584315896f},
-std::array<float,2>{0.932649136f, 0.249396235f},
-std::array<float,2>{0.54188782f, 0.637904644f},
-std::array<float,2>{0.354106486f, 0.0244085453f},
-std::array<float,2>{0.201806903f, 0.861346543f},
-std::array<float,2>{0.857263625f, 0.255152524f},
-std::array<float,2>{0.978986979f, 0.964820206f},
-std::array<float,2>{0.00790760852f, 0.387360752f},
-std::array<float,2>{0.390622228f, 0.537618637f},
-std::array<float,2>{0.642378092f, 0.137540027f},
-std::array<float,2>{0.810884774f, 0.588755846f},
-std::array<float,2>{0.14030692f, 0.242031723f},
-std::array<float,2>{0.301701069f, 0.902332723f},
-std::array<float,2>{0.601040244f, 0.43936041f},
-std::array<float,2>{0.696331799f, 0.773123384f},
-std::array<float,2>{0.445053011f, 0.330836564f},
-std::array<float,2>{0.067007944f, 0.705658734f},
-std::array<float,2>{0.904028714f, 0.109993756f},
-std::array<float,2>{0.685910106f, 0.509608865f},
-std::array<float,2>{0.426050037f, 0.183794051f},
-std::array<float,2>{0.0537724495f, 0.997488856f},
-std::array<float,2>{0.947738469f, 0.414032489f},
-std::array<float,2>{0.840884209f, 0.830362499f},
-std::array<float,2>{0.247571886f, 0.30083549f},
-std::array<float,2>{0.34169817f, 0.6790815f},
-std::array<float,2>{0.503543675f, 0.0614063926f},
-std::array<float,2>{0.928988874f, 0.727235734f},
-std::array<float,2>{0.116659664f, 0.0813745409f},
-std::array<float,2>{0.490232438f, 0.810088336f},
-std::array<float,2>{0.727214038f, 0.344560266f},
-std::array<float,2>{0.578078389f, 0.916006923f},
-std::array<float,2>{0.280370742f, 0.490298986f},
-std::array<float,2>{0.157420263f, 0.623847783f},
-std::array<float,2>{0.761976957f, 0.214558497f},
-std::array<float,2>{0.739625156f, 0.693855166f},
-std::array<float,2>{0.480344087f, 0.0990172923f},
-std::array<float,2>{0.103260309f, 0.75088197f},
-std::array<float,2>{0.919319808f, 0.314594924f},
-std::array<float,2>{0.779616058f, 0.884556592f},
-std::array<float,2>{0.1756313f, 0.460187405f},
-std::array<float,2>{0.261365503f, 0.563918293f},
-std::array<float,2>{0.580393076f, 0.221809343f},
-std::array<float,2>{0.955702066f, 0.561483443f},
-std::array<float,2>{0.0317841992f, 0.15089646f},
-std::array<float,2>{0.417471856f, 0.94621098f},
-std::array<float,2>{0.660975873f, 0.391001225f},
-std::array<float,2>{0.516757727f, 0.855151892f},
-std::array<float,2>{0.321152687f, 0.267258257f},
-std::array<float,2>{0.230856463f, 0.64874661f},
-std::array<float,2>{0.817751944f, 0.0111095402f},
-std::array<float,2>{0.623263419f, 0.607150018f},
-std::array<float,2>{0.285480887f, 0.194883764f},
-std::array<float,2>{0.147267625f, 0.923961937f},
-std::array<float,2>{0.782239974f, 0.474440306f},
-std::array<float,2>{0.887006521f, 0.787208498f},
-std::array<float,2>{0.0886940658f, 0.37098369f},
-std::array<float,2>{0.460116416f, 0.748580635f},
-std::array<float,2>{0.707150102f, 0.0632787198f},
-std::array<float,2>{0.872968018f, 0.660115182f},
-std::array<float,2>{0.211424515f, 0.0340812914f},
-std::array<float,2>{0.363217473f, 0.818733871f},
-std::array<float,2>{0.549773753f, 0.283074886f},
-std::array<float,2>{0.638586342f, 0.980835795f},
-std::array<float,2>{0.397355348f, 0.434544265f},
-std::array<float,2>{0.023850007f, 0.52876395f},
-std::array<float,2>{0.989349544f, 0.163096085f},
-std::array<float,2>{0.522101164f, 0.723148644f},
-std::array<float,2>{0.325430363f, 0.091122061f},
-std::array<float,2>{0.228408843f, 0.803538144f},
-std::array<float,2>{0.815823019f, 0.355454594f},
-std::array<float,2>{0.957572579f, 0.911728442f},
-std::array<float,2>{0.0376992561f, 0.495284081f},
-std::array<float,2>{0.419993669f, 0.609712601f},
-std::array<float,2>{0.657407105f, 0.206580147f},
-std::array<float,2>{0.776516318f, 0.502454638f},
-std::array<float,2>{0.178761125f, 0.177069992f},
-std::array<float,2>{0.265083581f, 0.989009917f},
-std::array<float,2>{0.584094405f, 0.421551943f},
-std::array<float,2>{0.738081574f, 0.841354191f},
-std::array<float,2>{0.480671674f, 0.309932083f},
-std::array<float,2>{0.107458249f, 0.680869758f},
-std::array<float,2>{0.915041149f, 0.0490946919f},
-std::array<float,2>{0.634897709f, 0.581586361f},
-std::array<float,2>{0.392626584f, 0.244536117f},
-std::array<float,2>{0.0276073534f, 0.89316535f},
-std::array<float,2>{0.985950828f, 0.44846037f},
-std::array<float,2>{0.867914796f, 0.775061429f},
-std::array<float,2>{0.216557175f, 0.336564988f},
-std::array<float,2>{0.366373271f, 0.713644564f},
-std::array<float,2>{0.552416682f, 0.120078921f},
-std::array<float,2>{0.883756399f, 0.628349841f},
-std::array<float,2>{0.0918240249f, 0.0225325655f},
-std::array<float,2>{0.456683636f, 0.870872736f},
-std::array<float,2>{0.70688659f, 0.264321178f},
-std::array<float,2>{0.619821489f, 0.956121087f},
-std::array<float,2>{0.282647252f, 0.382279485f},
-std::array<float,2>{0.143708959f, 0.542989135f},
-std::array<float,2>{0.788715005f, 0.125931248f},
-std::array<float,2>{0.7014305f, 0.671872079f},
-std::array<float,2>{0.440779507f, 0.0443941392f},
-std::array<float,2>{0.0632909164f, 0.823853076f},
-std::array<float,2>{0.900162578f, 0.293711841f},
-std::array<float,2>{0.8049317f, 0.974316299f},
-std::array<float,2>{0.133600876f, 0.42246452f},
-std::array<float,2>{0.297311515f, 0.519484818f},
-std::array<float,2>{0.596201599f, 0.170462877f},
-std::array<float,2>{0.983570814f, 0.595351338f},
-std::array<float,2>{0.0117527517f, 0.199583322f},
-std::array<float,2>{0.38312012f, 0.931530833f},
-std::array<float,2>{0.64688015f, 0.483847141f},
-std::array<float,2>{0.544934273f, 0.792997479f},
-std::array<float,2>{0.358134866f, 0.363659441f},
-std::array<float,2>{0.199005157f, 0.741065681f},
-std::array<float,2>{0.852576494f, 0.078096427f},
-std::array<float,2>{0.571620226f, 0.554485977f},
-std::array<float,2>{0.27613309f, 0.144060269f},
-std::array<float,2>{0.160761774f, 0.94241178f},
-std::array<float,2>{0.759436846f, 0.403232604f},
-std::array<float,2>{0.925765634f, 0.844982207f},
-std::array<float,2>{0.112334892f, 0.273463249f},
-std::array<float,2>{0.486431986f, 0.647812605f},
-std::array<float,2>{0.73157078f, 0.00202536304f},
-std::array<float,2>{0.837406576f, 0.702341676f},
-std::array<float,2>{0.245698005f, 0.104341075f},
-std::array<float,2>{0.339041084f, 0.76057452f},
-std::array<float,2>{0.506609499f, 0.327926844f},
-std::array<float,2>{0.680174172f, 0.875736415f},
-std::array<float,2>{0.42341736f, 0.463009983f},
-std::array<float,2>{0.0494788624f, 0.570618451f},
-std::array<float,2>{0.950593352f, 0.233097777f},
-std::array<float,2>{0.608927667f, 0.656199634f},
-std::array<float,2>{0.306035191f, 0.0130955819f},
-std::array<float,2>{0.131814405f, 0.856994629f},
-std::array<float,2>{0.802477717f, 0.272275597f},
-std::array<float,2>{0.896968246f, 0.951531827f},
-std::array<float,2>{0.0735126138f, 0.396122247f},
-std::array<float,2>{0.445857495f, 0.55832994f},
-std::array<float,2>{0.692903161f, 0.152522773f},
-std::array<float,2>{0.848121226f, 0.56666255f},
-std::array<float,2>{0.190880775f, 0.226137474f},
-std::array<float,2>{0.347066909f, 0.890235424f},
-std::array<float,2>{0.534349561f, 0.454424143f},
-std::array<float,2>{0.655090392f, 0.754821539f},
-std::array<float,2>{0.381450325f, 0.316832751f},
-std::array<float,2>{0.00225920347f, 0.690391839f},
-std::array<float,2>{0.972418785f, 0.0975757614f},
-std::array<float,2>{0.724716246f, 0.525562346f},
-std::array<float,2>{0.497635782f, 0.159426883f},
-std::array<float,2>{0.118218668f, 0.980106115f},
-std::array<float,2>{0.936827123f, 0.432663828f},
-std::array<float,2>{0.7528705f, 0.81595993f},
-std::array<float,2>{0.171092793f, 0.286570191f},
-std::array<float,2>{0.269892484f, 0.6620785f},
-std::array<float,2>{0.562612474f, 0.0384863727f},
-std::array<float,2>{0.944788456f, 0.74590975f},
-std::array<float,2>{0.062084958f, 0.0692788959f},
-std::array<float,2>{0.433286518f, 0.784357727f},
-std::array<float,2>{0.676109314f, 0.371311843f},
-std::array<float,2>{0.512698591f, 0.927208126f},
-std::array<float,2>{0.331721067f, 0.471372545f},
-std::array<float,2>{0.241947174f, 0.601632774f},
-std::array<float,2>{0.830485702f, 0.189447939f},
-std::array<float,2>{0.671288908f, 0.709146738f},
-std::array<float,2>{0.40916267f, 0.114080213f},
-std::array<float,2>{0.0397144146f, 0.766718626f},
-std::array<float,2>{0.963296175f, 0.335703731f},
-std::array<float,2>{0.824296176f, 0.904002607f},
-std::array<float,2>{0.223434135f, 0.444129258f},
-std::array<float,2>{0.315290332f, 0.59189111f},
-std::array<float,2>{0.525246263f, 0.235857636f},
-std::array<float,2>{0.908049285f, 0.531563044f},
-std::array<float,2>{0.09875907f, 0.135374472f},
-std::array<float,2>{0.470795929f, 0.965681255f},
-std::array<float,2>{0.745485485f, 0.383372903f},
-std::array<float,2>{0.588750899f, 0.864331543f},
-std::array<float,2>{0.255051911f, 0.252170712f},
-std::array<float,2>{0.185978323f, 0.632955372f},
-std::array<float,2>{0.773072004f, 0.0292263329f},
-std::array<float,2>{0.559427679f, 0.619401336f},
-std::array<float,2>{0.37027517f, 0.218623176f},
-std::array<float,2>{0.207654685f, 0.921128631f},
-std::array<float,2>{0.86667788f, 0.484611362f},
-std::array<float,2>{0.99614352f, 0.805105627f},
-std::array<float,2>{0.0201026965f, 0.347658753f},
-std::array<float,2>{0.403891027f, 0.731159449f},
-std::array<float,2>{0.628781676f, 0.0820637718f},
-std::array<float,2>{0.793516099f, 0.674280405f},
-std::array<float,2>{0.1511769f, 0.0583261214f},
-std::array<float,2>{0.293822587f, 0.833122432f},
-std::array<float,2>{0.611044765f, 0.297893912f},
-std::array<float,2>{0.713187933f, 0.99467963f},
-std::array<float,2>{0.464643151f, 0.408594906f},
-std::array<float,2>{0.0858758092f, 0.513119698f},
-std::array<float,2>{0.875847042f, 0.183518469f},
-std::array<float,2>{0.580662251f, 0.693258107f},
-std::array<float,2>{0.260960162f, 0.101303518f},
-std::array<float,2>{0.175124958f, 0.752879262f},
-std::array<float,2>{0.780265093f, 0.312760025f},
-std::array<float,2>{0.91966933f, 0.885391712f},
-std::array<float,2>{0.102736346f, 0.457497388f},
-std::array<float,2>{0.479868412f, 0.565868258f},
-std::array<float,2>{0.740117371f, 0.220688283f},
-std::array<float,2>{0.818152547f, 0.56042552f},
-std::array<float,2>{0.231122613f, 0.148788348f},
-std::array<float,2>{0.32035917f, 0.94780618f},
-std::array<float,2>{0.51739651f, 0.392896622f},
-std::array<float,2>{0.66018343f, 0.852741122f},
-std::array<float,2>{0.417655826f, 0.269181907f},
-std::array<float,2>{0.0313402861f, 0.650487661f},
-std::array<float,2>{0.955463588f, 0.00862324238f},
-std::array<float,2>{0.707744598f, 0.607615948f},
-std::array<float,2>{0.460868359f, 0.192314386f},
-std::array<float,2>{0.0880003124f, 0.922487497f},
-std::array<float,2>{0.887331724f, 0.475781888f},
-std::array<float,2>{0.783125401f, 0.785271645f},
-std::array<float,2>{0.146747932f, 0.36769262f},
-std::array<float,2>{0.285990357f, 0.747046828f},
-std::array<float,2>{0.623895824f, 0.0662816614f},
-std::array<float,2>{0.98990953f, 0.657252669f},
-std::array<float,2>{0.024367895f, 0.0314763822f},
-std::array<float,2>{0.396932125f, 0.817795694f},
-std::array<float,2>{0.637853324f, 0.283569127f},
-std::array<float,2>{0.549162328f, 0.983539879f},
-std::array<float,2>{0.362428248f, 0.437250555f},
-std::array<float,2>{0.211550772f, 0.531077862f},
-std::array<float,2>{0.872078538f, 0.161274746f},
-std::array<float,2>{0.641773939f, 0.639151633f},
-std::array<float,2>{0.390073925f, 0.0258945581f},
-std::array<float,2>{0.00870617107f, 0.860766411f},
-std::array<float,2>{0.979182422f, 0.256148934f},
-std::array<float,2>{0.856609643f, 0.961434543f},
-std::array<float,2>{0.201295972f, 0.388985991f},
-std::array<float,2>{0.353754699f, 0.536093891f},
-std::array<float,2>{0.541122556f, 0.140385807f},
-std::array<float,2>{0.903395772f, 0.58781445f},
-std::array<float,2>{0.066869013f, 0.238953635f},
-std::array<float,2>{0.444727063f, 0.898729324f},
-std::array<float,2>{0.696989417f, 0.440081239f},
-std::array<float,2>{0.601349652f, 0.771028221f},
-std::array<float,2>{0.300839722f, 0.328680813f},
-std::array<float,2>{0.140125602f, 0.703667521f},
-std::array<float,2>{0.811276019f, 0.111383252f},
-std::array<float,2>{0.503401816f, 0.51086849f},
-std::array<float,2>{0.341252029f, 0.187043473f},
-std::array<float,2>{0.247117281f, 0.999425769f},
-std::array<float,2>{0.841502547f, 0.410584331f},
-std::array<float,2>{0.948202133f, 0.829728961f},
-std::array<float,2>{0.0544368401f, 0.303741336f},
-std::array<float,2>{0.426281422f, 0.676362216f},
-std::array<float,2>{0.68650949f, 0.06044323f},
-std::array<float,2>{0.762481272f, 0.730214775f},
-std::array<float,2>{0.15813458f, 0.0793449134f},
-std::array<float,2>{0.281077951f, 0.81137681f},
-std::array<float,2>{0.577553034f, 0.346511155f},
-std::array<float,2>{0.726657152f, 0.917296767f},
-std::array<float,2>{0.489561528f, 0.488516331f},
-std::array<float,2>{0.117013693f, 0.621233582f},
-std::array<float,2>{0.92965734f, 0.21107389f},
-std::array<float,2>{0.536093116f, 0.685869098f},
-std::array<float,2>{0.350492895f, 0.0514826775f},
-std::array<float,2>{0.194726497f, 0.836339056f},
-std::array<float,2>{0.844803989f, 0.308138698f},
-std::array<float,2>{0.973908901f, 0.985744655f},
-std::array<float,2>{0.00747025432f, 0.416677624f},
-std::array<float,2>{0.378134251f, 0.507019103f},
-std::array<float,2>{0.651277661f, 0.174562752f},
-std::array<float,2>{0.797186255f, 0.614732742f},
-std::array<float,2>{0.127989158f, 0.207032293f},
-std::array<float,2>{0.310130656f, 0.907895923f},
-std::array<float,2>{0.604026079f, 0.498311967f},
-std::array<float,2>{0.6910218f, 0.800510526f},
-std::array<float,2>{0.452567846f, 0.358124435f},
-std::array<float,2>{0.0767350346f, 0.719256222f},
-std::array<float,2>{0.891511917f, 0.0879933685f},
-std::array<float,2>{0.672442913f, 0.540813208f},
-std::array<float,2>{0.43605271f, 0.131048322f},
-std::array<float,2>{0.0564005449f, 0.959662616f},
-std::array<float,2>{0.940150499f, 0.3753649f},
-std::array<float,2>{0.835864007f, 0.873973787f},
-std::array<float,2>{0.235348314f, 0.260597348f},
-std::array<float,2>{0.334886611f, 0.63199538f},
-std::array<float,2>{0.509372413f, 0.0165288895f},
-std::array<float,2>{0.933275819f, 0.716541886f},
-std::array<float,2>{0.124088511f, 0.122730903f},
-std::array<float,2>{0.494129002f, 0.778878629f},
-std::array<float,2>{0.722384632f, 0.343036681f},
-std::array<float,2>{0.567206264f, 0.895017862f},
-std::array<float,2>{0.269391686f, 0.45282796f},
-std::array<float,2>{0.166384339f, 0.58348006f},
-std::array<float,2>{0.756207049f, 0.247270733f},
-std::array<float,2>{0.7498523f, 0.736315668f},
-std::array<float,2>{0.473309159f, 0.0713573694f},
-std::array<float,2>{0.0968843922f, 0.791954279f},
-std::array<float,2>{0.913616896f, 0.360363215f},
-std::array<float,2>{0.767957509f, 0.936960816f},
-std::array<float,2>{0.182229295f, 0.480373412f},
-std::array<float,2>{0.252465993f, 0.601143181f},
-std::array<float,2>{0.59197247f, 0.195950314f},
-std::array<float,2>{0.967973113f, 0.520470321f},
-std::array<float,2>{0.0435159132f, 0.166304857f},
-std::array<float,2>{0.413570374f, 0.971719444f},
-std::array<float,2>{0.665166318f, 0.428386599f},
-std::array<float,2>{0.529152572f, 0.827498853f},
-std::array<float,2>{0.318924993f, 0.291312456f},
-std::array<float,2>{0.221245885f, 0.665783584f},
-std::array<float,2>{0.822119713f, 0.0411441512f},
-std::array<float,2>{0.615626156f, 0.574787796f},
-std::array<float,2>{0.289813221f, 0.229019314f},
-std::array<float,2>{0.155673653f, 0.879124701f},
-std::array<float,2>{0.790649712f, 0.467363536f},
-std::array<float,2>{0.88195765f, 0.762246788f},
-std::array<float,2>{0.081729643f, 0.32401219f},
-std::array<float,2>{0.467865497f, 0.698230445f},
-std::array<float,2>{0.715429664f, 0.10603027f},
-std::array<float,2>{0.861924648f, 0.644248605f},
-std::array<float,2>{0.205355301f, 0.0077056908f},
-std::array<float,2>{0.374533534f, 0.848393023f},
-std::array<float,2>{0.555182755f, 0.279692113f},
-std::array<float,2>{0.632720649f, 0.941075265f},
-std::array<float,2>{0.400483221f, 0.401460648f},
-std::array<float,2>{0.0170394033f, 0.547618449f},
-std::array<float,2>{0.995773554f, 0.147648141f},
-std::array<float,2>{0.554305017f, 0.711547673f},
-std::array<float,2>{0.363855213f, 0.118052632f},
-std::array<float,2>{0.216935888f, 0.776036918f},
-std::array<float,2>{0.869400859f, 0.339054197f},
-std::array<float,2>{0.987310231f, 0.892077923f},
-std::array<float,2>{0.031095475f, 0.446474135f},
-std::array<float,2>{0.390721142f, 0.57813853f},
-std::array<float,2>{0.634091258f, 0.2424905f},
-std::array<float,2>{0.787058711f, 0.545258641f},
-std::array<float,2>{0.141264841f, 0.127582192f},
-std::array<float,2>{0.284435928f, 0.954878569f},
-std::array<float,2>{0.61801672f, 0.38041544f},
-std::array<float,2>{0.704820335f, 0.868308961f},
-std::array<float,2>{0.454880804f, 0.263248026f},
-std::array<float,2>{0.09068124f, 0.625975728f},
-std::array<float,2>{0.88629514f, 0.0201775115f},
-std::array<float,2>{0.658778071f, 0.611911178f},
-std::array<float,2>{0.419245213f, 0.203436941f},
-std::array<float,2>{0.0355067067f, 0.913553596f},
-std::array<float,2>{0.959771156f, 0.493004143f},
-std::array<float,2>{0.812846065f, 0.801531494f},
-std::array<float,2>{0.228757307f, 0.352276862f},
-std::array<float,2>{0.326299131f, 0.726523578f},
-std::array<float,2>{0.52077961f, 0.0926336274f},
-std::array<float,2>{0.916974962f, 0.681672513f},
-std::array<float,2>{0.10657572f, 0.0478311218f},
-std::array<float,2>{0.483568609f, 0.842566311f},
-std::array<float,2>{0.734437943f, 0.310625762f},
-std::array<float,2>{0.583254397f, 0.991900384f},
-std::array<float,2>{0.263448566f, 0.418418735f},
-std::array<float,2>{0.177574649f, 0.500509977f},
-std::array<float,2>{0.773451924f, 0.178201929f},
-std::array<float,2>{0.732443392f, 0.644532263f},
-std::array<float,2>{0.486242682f, 0.000252649421f},
-std::array<float,2>{0.110259846f, 0.846454382f},
-std::array<float,2>{0.923782706f, 0.27686128f},
-std::array<float,2>{0.760052681f, 0.94498837f},
-std::array<float,2>{0.162966922f, 0.405121267f},
-std::array<float,2>{0.274360776f, 0.550939202f},
-std::array<float,2>{0.572975695f, 0.14160338f},
-std::array<float,2>{0.951187551f, 0.57304883f},
-std::array<float,2>{0.0486110747f, 0.232175872f},
-std::array<float,2>{0.424295962f, 0.877398252f},
-std::array<float,2>{0.683061779f, 0.462020665f},
-std::array<float,2>{0.505197763f, 0.757818103f},
-std::array<float,2>{0.337587625f, 0.324961424f},
-std::array<float,2>{0.243882507f, 0.700618625f},
-std::array<float,2>{0.83894676f, 0.102863103f},
-std::array<float,2>{0.593840361f, 0.517268836f},
-std::array<float,2>{0.298961371f, 0.169533536f},
-std::array<float,2>{0.135804459f, 0.975202441f},
-std::array<float,2>{0.807364821f, 0.425017118f},
-std::array<float,2>{0.902045012f, 0.821583271f},
-std::array<float,2>{0.0650902838f, 0.296521574f},
-std::array<float,2>{0.43812409f, 0.668726504f},
-std::array<float,2>{0.700389087f, 0.0459251292f},
-std::array<float,2>{0.854379237f, 0.738781691f},
-std::array<float,2>{0.196922585f, 0.0758100599f},
-std::array<float,2>{0.356839508f, 0.79650867f},
-std::array<float,2>{0.543215156f, 0.366873741f},
-std::array<float,2>{0.644617319f, 0.931752861f},
-std::array<float,2>{0.385349959f, 0.480867058f},
-std::array<float,2>{0.0147525845f, 0.596085072f},
-std::array<float,2>{0.982301176f, 0.201721758f},
-std::array<float,2>{0.566231132f, 0.663695872f},
-std::array<float,2>{0.272287428f, 0.0357672274f},
-std::array<float,2>{0.168133333f, 0.813845694f},
-std::array<float,2>{0.751049221f, 0.288643867f},
-std::array<float,2>{0.935259342f, 0.976643264f},
-std::array<float,2>{0.120238796f, 0.431120574f},
-std::array<float,2>{0.4991256f, 0.524388313f},
-std::array<float,2>{0.723247588f, 0.15736343f},
-std::array<float,2>{0.829137862f, 0.603949368f},
-std::array<float,2>{0.239862114f, 0.18972975f},
-std::array<float,2>{0.329526395f, 0.929682374f},
-std::array<float,2>{0.514572561f, 0.470200896f},
-std::array<float,2>{0.678865552f, 0.781553149f},
-std::array<float,2>{0.429707706f, 0.37311402f},
-std::array<float,2>{0.0600503422f, 0.742410481f},
-std::array<float,2>{0.942372441f, 0.0679471269f},
-std::array<float,2>{0.694323361f, 0.555809379f},
-std::array<float,2>{0.44803378f, 0.156161785f},
-std::array<float,2>{0.0713351369f, 0.949880481f},
-std::array<float,2>{0.896352828f, 0.397519886f},
-std::array<float,2>{0.804501772f, 0.858005166f},
-std::array<float,2>{0.12927103f, 0.27005288f},
-std::array<float,2>{0.307247072f, 0.654050112f},
-std::array<float,2>{0.605812907f, 0.0150910094f},
-std::array<float,2>{0.969288409f, 0.689222336f},
-std::array<float,2>{0.00166000973f, 0.0950069129f},
-std::array<float,2>{0.380078077f, 0.756082356f},
-std::array<float,2>{0.653030992f, 0.319022596f},
-std::array<float,2>{0.531827211f, 0.886975586f},
-std::array<float,2>{0.344291359f, 0.456505686f},
-std::array<float,2>{0.187701002f, 0.569830775f},
-std::array<float,2>{0.850553095f, 0.22326386f},
-std::array<float,2>{0.626072943f, 0.732784092f},
-std::array<float,2>{0.40571788f, 0.084583804f},
-std::array<float,2>{0.0231424123f, 0.807360709f},
-std::array<float,2>{0.998529077f, 0.350845426f},
-std::array<float,2>{0.864393115f, 0.91874671f},
-std::array<float,2>{0.209929481f, 0.487476528f},
-std::array<float,2>{0.36849764f, 0.618205726f},
-std::array<float,2>{0.561329961f, 0.215053424f},
-std::array<float,2>{0.878268838f, 0.51381433f},
-std::array<float,2>{0.0836042762f, 0.181197882f},
-std::array<float,2>{0.462838352f, 0.993875563f},
-std::array<float,2>{0.71138984f, 0.406372458f},
-std::array<float,2>{0.612791657f, 0.835241437f},
-std::array<float,2>{0.295653909f, 0.300776541f},
-std::array<float,2>{0.149557084f, 0.672096491f},
-std::array<float,2>{0.795177639f, 0.0550548173f},
-std::array<float,2>{0.526850164f, 0.590732992f},
-std::array<float,2>{0.313639164f, 0.237411052f},
-std::array<float,2>{0.226454481f, 0.905401766f},
-std::array<float,2>{0.826361656f, 0.442042887f},
-std::array<float,2>{0.961918771f, 0.769446254f},
-std::array<float,2>{0.0420944206f, 0.33213532f},
-std::array<float,2>{0.40798986f, 0.708003759f},
-std::array<float,2>{0.668939888f, 0.11574696f},
-std::array<float,2>{0.771084666f, 0.635887742f},
-std::array<float,2>{0.185443014f, 0.03043372f},
-std::array<float,2>{0.257566571f, 0.866746426f},
-std::array<float,2>{0.586826861f, 0.251015365f},
-std::array<float,2>{0.744061351f, 0.967471659f},
-std::array<float,2>{0.470109135f, 0.385000199f},
-std::array<float,2>{0.101133846f, 0.534904063f},
-std::array<float,2>{0.908855081f, 0.133970067f},
-std::array<float,2>{0.622834265f, 0.748330951f},
-std::array<float,2>{0.287988186f, 0.0627346709f},
-std::array<float,2>{0.14480783f, 0.78777951f},
-std::array<float,2>{0.783540905f, 0.370294452f},
-std::array<float,2>{0.889541984f, 0.924729526f},
-std::array<float,2>{0.0868070573f, 0.473786145f},
-std::array<float,2>{0.458794683f, 0.606922626f},
-std::array<float,2>{0.710716665f, 0.194777653f},
-std::array<float,2>{0.873332322f, 0.528999448f},
-std::array<float,2>{0.214675829f, 0.163892999f},
-std::array<float,2>{0.359428734f, 0.981124699f},
-std::array<float,2>{0.54822892f, 0.433924794f},
-std::array<float,2>{0.640079677f, 0.818979561f},
-std::array<float,2>{0.396026552f, 0.282405704f},
-std::array<float,2>{0.0273424741f, 0.659273922f},
-std::array<float,2>{0.991338789f, 0.0335817486f},
-std::array<float,2>{0.740884244f, 0.564160705f},
-std::array<float,2>{0.478495985f, 0.222169921f},
-std::array<float,2>{0.104906917f, 0.883927822f},
-std::array<float,2>{0.92186445f, 0.460815966f},
-std::array<float,2>{0.77889508f, 0.750279069f},
-std::array<float,2>{0.173689336f, 0.315078616f},
-std::array<float,2>{0.259507537f, 0.69369787f},
-std::array<float,2>{0.579117417f, 0.0992364883f},
-std::array<float,2>{0.954638541f, 0.649320841f},
-std::array<float,2>{0.0335164107f, 0.0116119301f},
-std::array<float,2>{0.414938599f, 0.854791224f},
-std::array<float,2>{0.663334012f, 0.266807944f},
-std::array<float,2>{0.518450677f, 0.945593417f},
-std::array<float,2>{0.323367536f, 0.391534477f},
-std::array<float,2>{0.234223798f, 0.560972989f},
-std::array<float,2>{0.819963694f, 0.150505587f},
-std::array<float,2>{0.683813095f, 0.679248214f},
-std::array<float,2>{0.429617614f, 0.0605498739f},
-std::array<float,2>{0.0511884429f, 0.830806911f},
-std::array<float,2>{0.946418345f, 0.301421791f},
-std::array<float,2>{0.842548013f, 0.997915924f},
-std::array<float,2>{0.248713806f, 0.41322124f},
-std::array<float,2>{0.341814935f, 0.508980095f},
-std::array<float,2>{0.501601696f, 0.184478641f},
-std::array<float,2>{0.927164793f, 0.623170614f},
-std::array<float,2>{0.114321098f, 0.214332789f},
-std::array<float,2>{0.490487576f, 0.915223837f},
-std::array<float,2>{0.73011601f, 0.490915149f},
-std::array<float,2>{0.575113118f, 0.81002152f},
-std::array<float,2>{0.278391421f, 0.343976259f},
-std::array<float,2>{0.159965962f, 0.726660848f},
-std::array<float,2>{0.76469928f, 0.0819580629f},
-std::array<float,2>{0.540750563f, 0.537510455f},
-std::array<float,2>{0.352753729f, 0.136929512f},
-std::array<float,2>{0.199259475f, 0.964353502f},
-std::array<float,2>{0.857868493f, 0.386833131f},
-std::array<float,2>{0.976720154f, 0.862249792f},
-std::array<float,2>{0.010240579f, 0.25578934f},
-std::array<float,2>{0.38797605f, 0.638420224f},
-std::array<float,2>{0.643793821f, 0.0234867483f},
-std::array<float,2>{0.81051147f, 0.705150723f},
-std::array<float,2>{0.137336478f, 0.109650254f},
-std::array<float,2>{0.303173125f, 0.772550941f},
-std::array<float,2>{0.598061323f, 0.330338418f},
-std::array<float,2>{0.698462546f, 0.901614368f},
-std::array<float,2>{0.442065716f, 0.438899815f},
-std::array<float,2>{0.0688162297f, 0.588353157f},
-std::array<float,2>{0.905616164f, 0.241450682f},
-std::array<float,2>{0.510987759f, 0.629038334f},
-std::array<float,2>{0.333497673f, 0.0177041609f},
-std::array<float,2>{0.23638694f, 0.871352613f},
-std::array<float,2>{0.832254708f, 0.258395821f},
-std::array<float,2>{0.939198375f, 0.957520425f},
-std::array<float,2>{0.0583464615f, 0.378003061f},
-std::array<float,2>{0.435447484f, 0.541442335f},
-std::array<float,2>{0.674496412f, 0.129951745f},
-std::array<float,2>{0.755294621f, 0.584717453f},
-std::array<float,2>{0.165053442f, 0.249722332f},
-std::array<float,2>{0.266707301f, 0.898101211f},
-std::array<float,2>{0.568789482f, 0.44957909f},
-std::array<float,2>{0.7206043f, 0.780522645f},
-std::array<float,2>{0.495246887f, 0.341700107f},
-std::array<float,2>{0.121656343f, 0.717234492f},
-std::array<float,2>{0.930886745f, 0.123053633f},
-std::array<float,2>{0.648454547f, 0.504411578f},
-std::array<float,2>{0.376685798f, 0.172463998f},
-std::array<float,2>{0.00505651208f, 0.986562669f},
-std::array<float,2>{0.975341618f, 0.414181471f},
-std::array<float,2>{0.846424818f, 0.839389086f},
-std::array<float,2>{0.192062214f, 0.30607152f},
-std::array<float,2>{0.349327952f, 0.684941888f},
-std::array<float,2>{0.537142932f, 0.0528775752f},
-std::array<float,2>{0.893564761f, 0.722185016f},
-std::array<float,2>{0.0758727491f, 0.0868920684f},
-std::array<float,2>{0.450698495f, 0.797650874f},
-std::array<float,2>{0.687684476f, 0.35680005f},
-std::array<float,2>{0.602280974f, 0.910067141f},
-std::array<float,2>{0.312047958f, 0.496332884f},
-std::array<float,2>{0.125010967f, 0.616173685f},
-std::array<float,2>{0.798954189f, 0.20989795f},
-std::array<float,2>{0.717155874f, 0.695981205f},
-std::array<float,2>{0.465375513f, 0.108647913f},
-std::array<float,2>{0.0784748718f, 0.763874352f},
-std::array<float,2>{0.879294515f, 0.320693582f},
-std::array<float,2>{0.79104048f, 0.882628083f},
-std::array<float,2>{0.152774692f, 0.466506988f},
-std::array<float,2>{0.291743279f, 0.576572478f},
-std::array<float,2>{0.614687085f, 0.227831319f},
-std::array<float,2>{0.993127763f, 0.549193084f},
-std::array<float,2>{0.0191956908f, 0.146243051f},
-std::array<float,2>{0.399584621f, 0.938137531f},
-std::array<float,2>{0.630506814f, 0.399183422f},
-std::array<float,2>{0.557825804f, 0.850452542f},
-std::array<float,2>{0.371994823f, 0.278247088f},
-std::array<float,2>{0.204698041f, 0.641475618f},
-std::array<float,2>{0.860095084f, 0.00421843352f},
-std::array<float,2>{0.590020776f, 0.598608315f},
-std::array<float,2>{0.250057131f, 0.197608218f},
-std::array<float,2>{0.180178612f, 0.934562325f},
-std::array<float,2>{0.767574787f, 0.476628512f},
-std::array<float,2>{0.910237074f, 0.790638745f},
-std::array<float,2>{0.0947040319f, 0.36288166f},
-std::array<float,2>{0.475944966f, 0.738081515f},
-std::array<float,2>{0.746304035f, 0.0734071732f},
-std::array<float,2>{0.824116826f, 0.666894436f},
-std::array<float,2>{0.219790325f, 0.0399706326f},
-std::array<float,2>{0.316625178f, 0.824894071f},
-std::array<float,2>{0.531098723f, 0.289542139f},
-std::array<float,2>{0.667026341f, 0.970494628f},
-std::array<float,2>{0.411200643f, 0.426834106f},
-std::array<float,2>{0.0463806838f, 0.523079813f},
-std::array<float,2>{0.965203881f, 0.165457189f},
-std::array<float,2>{0.543955564f, 0.741936088f},
-std::array<float,2>{0.355740726f, 0.0767789856f},
-std::array<float,2>{0.195466518f, 0.794090629f},
-std::array<float,2>{0.855407178f, 0.364283293f},
-std::array<float,2>{0.981036961f, 0.930173993f},
-std::array<float,2>{0.0140252113f, 0.482675612f},
-std::array<float,2>{0.385965198f, 0.593897521f},
-std::array<float,2>{0.645866692f, 0.200689375f},
-std::array<float,2>{0.807688236f, 0.518112004f},
-std::array<float,2>{0.135715142f, 0.171748251f},
-std::array<float,2>{0.300237238f, 0.97284019f},
-std::array<float,2>{0.594982922f, 0.423802733f},
-std::array<float,2>{0.699688733f, 0.822345018f},
-std::array<float,2>{0.438580841f, 0.294858932f},
-std::array<float,2>{0.0655946583f, 0.670431852f},
-std::array<float,2>{0.900635421f, 0.0438766219f},
-std::array<float,2>{0.681956768f, 0.571845591f},
-std::array<float,2>{0.424896479f, 0.233870775f},
-std::array<float,2>{0.0474658273f, 0.876328945f},
-std::array<float,2>{0.952228308f, 0.464711577f},
-std::array<float,2>{0.838200629f, 0.760857344f},
-std::array<float,2>{0.242943972f, 0.326828301f},
-std::array<float,2>{0.336101115f, 0.701486111f},
-std::array<float,2>{0.504085064f, 0.104648352f},
-std::array<float,2>{0.922209799f, 0.646790147f},
-std::array<float,2>{0.11132513f, 0.00325782341f},
-std::array<float,2>{0.484815001f, 0.844029784f},
-std::array<float,2>{0.73391217f, 0.274415404f},
-std::array<float,2>{0.57363534f, 0.941620529f},
-std::array<float,2>{0.275097191f, 0.403534502f},
-std::array<float,2>{0.163236633f, 0.5529598f},
-std::array<float,2>{0.760965347f, 0.143222451f},
-std::array<float,2>{0.735542834f, 0.680140674f},
-std::array<float,2>{0.482711911f, 0.0506215952f},
-std::array<float,2>{0.10552597f, 0.840388954f},
-std::array<float,2>{0.917875946f, 0.308886498f},
-std::array<float,2>{0.774878144f, 0.989268839f},
-std::array<float,2>{0.176540107f, 0.420528978f},
-std::array<float,2>{0.262058735f, 0.503882647f},
-std::array<float,2>{0.582747757f, 0.176572204f},
-std::array<float,2>{0.960516095f, 0.610748947f},
-std::array<float,2>{0.0367881842f, 0.20602867f},
-std::array<float,2>{0.418394715f, 0.911020815f},
-std::array<float,2>{0.659689128f, 0.494455874f},
-std::array<float,2>{0.519701242f, 0.803836703f},
-std::array<float,2>{0.327313155f, 0.354094833f},
-std::array<float,2>{0.229511335f, 0.723979115f},
-std::array<float,2>{0.813563287f, 0.0899390504f},
-std::array<float,2>{0.61881721f, 0.544570208f},
-std::array<float,2>{0.283412904f, 0.126256168f},
-std::array<float,2>{0.141631201f, 0.955936432f},
-std::array<float,2>{0.786059678f, 0.381661534f},
-std::array<float,2>{0.884846747f, 0.869841397f},
-std::array<float,2>{0.091575399f, 0.264907271f},
-std::array<float,2>{0.453665286f, 0.627468288f},
-std::array<float,2>{0.703178585f, 0.0224309955f},
-std::array<float,2>{0.87015909f, 0.714266777f},
-std::array<float,2>{0.217903823f, 0.120456189f},
-std::array<float,2>{0.364620388f, 0.774112225f},
-std::array<float,2>{0.553203762f, 0.337296754f},
-std::array<float,2>{0.633346558f, 0.893964648f},
-std::array<float,2>{0.392194062f, 0.447879076f},
-std::array<float,2>{0.0293402988f, 0.580412447f},
-std::array<float,2>{0.986885786f, 0.245775461f},
-std::array<float,2>{0.587281108f, 0.633812487f},
-std::array<float,2>{0.256143451f, 0.0275338087f},
-std::array<float,2>{0.184493184f, 0.86419183f},
-std::array<float,2>{0.769574106f, 0.253705949f},
-std::array<float,2>{0.909439921f, 0.965985298f},
-std::array<float,2>{0.100052796f, 0.384235322f},
-std::array<float,2>{0.46962744f, 0.532296121f},
-std::array<float,2>{0.743042052f, 0.136510566f},
-std::array<float,2>{0.827985048f, 0.593109667f},
-std::array<float,2>{0.225325689f, 0.235047773f},
-std::array<float,2>{0.312545002f, 0.902693868f},
-std::array<float,2>{0.526167989f, 0.444535315f},
-std::array<float,2>{0.669362247f, 0.765909374f},
-std::array<float,2>{0.406367689f, 0.334887445f},
-std::array<float,2>{0.0413792431f, 0.710735917f},
-std::array<float,2>{0.961484432f, 0.114701986f},
-std::array<float,2>{0.712794423f, 0.5122298f},
-std::array<float,2>{0.461380064f, 0.182161748f},
-std::array<float,2>{0.082982555f, 0.995472193f},
-std::array<float,2>{0.877219617f, 0.409834981f},
-std::array<float,2>{0.795992613f, 0.832805336f},
-std::array<float,2>{0.148470372f, 0.297208101f},
-std::array<float,2>{0.296227813f, 0.674971402f},
-std::array<float,2>{0.611662805f, 0.0570931472f},
-std::array<float,2>{0.999034464f, 0.731735408f},
-std::array<float,2>{0.0220356937f, 0.0832897946f},
-std::array<float,2>{0.404626817f, 0.806309044f},
-std::array<float,2>{0.625602007f, 0.349174857f},
-std::array<float,2>{0.561681867f, 0.920587659f},
-std::array<float,2>{0.368020326f, 0.486035198f},
-std::array<float,2>{0.210372135f, 0.620803416f},
-std::array<float,2>{0.863666654f, 0.216845661f},
-std::array<float,2>{0.654041052f, 0.691130936f},
-std::array<float,2>{0.37936759f, 0.0958198383f},
-std::array<float,2>{0.000510852668f, 0.755519271f},
-std::array<float,2>{0.970144272f, 0.317422867f},
-std::array<float,2>{0.85099256f, 0.889214516f},
-std::array<float,2>{0.189340279f, 0.453159451f},
-std::array<float,2>{0.345404446f, 0.567935705f},
-std::array<float,2>{0.532391548f, 0.225075573f},
-std::array<float,2>{0.895385265f, 0.557068527f},
-std::array<float,2>{0.0708229244f, 0.153490201f},
-std::array<float,2>{0.44839713f, 0.952605009f},
-std::array<float,2>{0.695044875f, 0.395313233f},
-std::array<float,2>{0.60706836f, 0.855832636f},
-std::array<float,2>{0.308287978f, 0.273038656f},
-std::array<float,2>{0.129949868f, 0.654904306f},
-std::array<float,2>{0.803428769f, 0.0125821242f},
-std::array<float,2>{0.515338898f, 0.602761388f},
-std::array<float,2>{0.328968078f, 0.188451871f},
-std::array<float,2>{0.238765702f, 0.925888717f},
-std::array<float,2>{0.82872957f, 0.471801937f},
-std::array<float,2>{0.943229437f, 0.783571661f},
-std::array<float,2>{0.0591230243f, 0.372769773f},
-std::array<float,2>{0.430782259f, 0.745024502f},
-std::array<float,2>{0.678190649f, 0.0699515641f},
-std::array<float,2>{0.750256956f, 0.660910249f},
-std::array<float,2>{0.169445589f, 0.0372029208f},
-std::array<float,2>{0.272669494f, 0.815143704f},
-std::array<float,2>{0.564737618f, 0.285381228f},
-std::array<float,2>{0.724360764f, 0.9788118f},
-std::array<float,2>{0.498080462f, 0.431871444f},
-std::array<float,2>{0.119167209f, 0.527315795f},
-std::array<float,2>{0.934381306f, 0.158438548f},
-std::array<float,2>{0.599517643f, 0.704686344f},
-std::array<float,2>{0.304260701f, 0.11318583f},
-std::array<float,2>{0.138605446f, 0.770453691f},
-std::array<float,2>{0.808812797f, 0.329998016f},
-std::array<float,2>{0.905035794f, 0.900117159f},
-std::array<float,2>{0.0697389394f, 0.440778464f},
-std::array<float,2>{0.442942113f, 0.586000562f},
-std::array<float,2>{0.698197603f, 0.240108117f},
-std::array<float,2>{0.858443141f, 0.537056625f},
-std::array<float,2>{0.200410217f, 0.138771579f},
-std::array<float,2>{0.352258742f, 0.962234795f},
-std::array<float,2>{0.5398103f, 0.390196979f},
-std::array<float,2>{0.643270612f, 0.859514654f},
-std::array<float,2>{0.387672305f, 0.257797599f},
-std::array<float,2>{0.0113538699f, 0.640405595f},
-std::array<float,2>{0.977750063f, 0.0271834452f},
-std::array<float,2>{0.728763998f, 0.622819364f},
-std::array<float,2>{0.491233081f, 0.212821051f},
-std::array<float,2>{0.113662206f, 0.916071832f},
-std::array<float,2>{0.9267506f, 0.489443839f},
-std::array<float,2>{0.763843536f, 0.811698854f},
-std::array<float,2>{0.158448786f, 0.346820325f},
-std::array<float,2>{0.278306782f, 0.728682339f},
-std::array<float,2>{0.575279832f, 0.0790258646f},
-std::array<float,2>{0.945444584f, 0.676811874f},
-std::array<float,2>{0.0519667938f, 0.0590889901f},
-std::array<float,2>{0.428506047f, 0.828155637f},
-std::array<float,2>{0.68531996f, 0.302841961f},
-std::array<float,2>{0.500748634f, 0.998348832f},
-std::array<float,2>{0.342873544f, 0.41137132f},
-std::array<float,2>{0.249827757f, 0.51052928f},
-std::array<float,2>{0.843396187f, 0.186008945f},
-std::array<float,2>{0.663018525f, 0.651503801f},
-std::array<float,2>{0.415822446f, 0.00896727573f},
-std::array<float,2>{0.0344235972f, 0.851774395f},
-std::array<float,2>{0.953195691f, 0.26847142f},
-std::array<float,2>{0.819089532f, 0.949167311f},
-std::array<float,2>{0.232578024f, 0.394075274f},
-std::array<float,2>{0.322937936f, 0.558936536f},
-std::array<float,2>{0.519166648f, 0.149641171f},
-std::array<float,2>{0.920722663f, 0.565287888f},
-std::array<float,2>{0.10351909f, 0.219097987f},
-std::array<float,2>{0.476688206f, 0.886180162f},
-std::array<float,2>{0.742006361f, 0.458473295f},
-std::array<float,2>{0.578879774f, 0.753616154f},
-std::array<float,2>{0.258331597f, 0.313602895f},
-std::array<float,2>{0.172565356f, 0.691684604f},
-std::array<float,2>{0.777545452f, 0.0996771306f},
-std::array<float,2>{0.547462702f, 0.530045033f},
-std::array<float,2>{0.360571802f, 0.160367727f},
-std::array<float,2>{0.213665813f, 0.982777596f},
-std::array<float,2>{0.874488592f, 0.435852468f},
-std::array<float,2>{0.99025929f, 0.816871405f},
-std::array<float,2>{0.0260292366f, 0.285075575f},
-std::array<float,2>{0.394550443f, 0.656392753f},
-std::array<float,2>{0.639503419f, 0.0330109857f},
-std::array<float,2>{0.784379303f, 0.747324646f},
-std::array<float,2>{0.146157205f, 0.0652746111f},
-std::array<float,2>{0.288375795f, 0.787071705f},
-std::array<float,2>{0.62125212f, 0.368718773f},
-std::array<float,2>{0.709297478f, 0.923410833f},
-std::array<float,2>{0.457799494f, 0.474789053f},
-std::array<float,2>{0.0872196481f, 0.609320343f},
-std::array<float,2>{0.88967073f, 0.192779601f},
-std::array<float,2>{0.53024298f, 0.66417861f},
-std::array<float,2>{0.318117142f, 0.0423847996f},
-std::array<float,2>{0.219395921f, 0.827078044f},
-std::array<float,2>{0.822961509f, 0.292649329f},
-std::array<float,2>{0.965863228f, 0.971008062f},
-std::array<float,2>{0.0453214124f, 0.429628342f},
-std::array<float,2>{0.411023796f, 0.52069962f},
-std::array<float,2>{0.666898787f, 0.167751372f},
-std::array<float,2>{0.766237438f, 0.600393474f},
-std::array<float,2>{0.181300789f, 0.196644783f},
-std::array<float,2>{0.251046002f, 0.936155915f},
-std::array<float,2>{0.591185987f, 0.478847653f},
-std::array<float,2>{0.747397006f, 0.792036653f},
-std::array<float,2>{0.474732608f, 0.359572202f},
-std::array<float,2>{0.0950851217f, 0.734724224f},
-std::array<float,2>{0.91145277f, 0.0711925328f},
-std::array<float,2>{0.629334748f, 0.548508048f},
-std::array<float,2>{0.398937255f, 0.147157609f},
-std::array<float,2>{0.0177980978f, 0.940315008f},
-std::array<float,2>{0.993727386f, 0.401026428f},
-std::array<float,2>{0.861210406f, 0.849591017f},
-std::array<float,2>{0.203262463f, 0.280587971f},
-std::array<float,2>{0.372315884f, 0.643302858f},
-std::array<float,2>{0.557399869f, 0.0061661345f},
-std::array<float,2>{0.880396903f, 0.698726892f},
-std::array<float,2>{0.079130657f, 0.107180119f},
-std::array<float,2>{0.465864748f, 0.763611436f},
-std::array<float,2>{0.718012214f, 0.32292673f},
-std::array<float,2>{0.613672614f, 0.879944444f},
-std::array<float,2>{0.292519331f, 0.468413085f},
-std::array<float,2>{0.153602839f, 0.575535715f},
-std::array<float,2>{0.792360485f, 0.229963332f},
-std::array<float,2>{0.689155817f, 0.720702469f},
-std::array<float,2>{0.449789047f, 0.0891318172f},
-std::array<float,2>{0.0745556876f, 0.799267769f},
-std::array<float,2>{0.892996013f, 0.35891819f},
-std::array<float,2>{0.800343156f, 0.907209337f},
-std::array<float,2>{0.126808986f, 0.49998045f},
-std::array<float,2>{0.311024636f, 0.613455415f},
-std::array<float,2>{0.602653325f, 0.20812051f},
-std::array<float,2>{0.975642264f, 0.50674063f},
-std::array<float,2>{0.00430723699f, 0.175320074f},
-std::array<float,2>{0.375320673f, 0.985118747f},
-std::array<float,2>{0.650003314f, 0.417831063f},
-std::array<float,2>{0.538922131f, 0.837655663f},
-std::array<float,2>{0.348007977f, 0.307389677f},
-std::array<float,2>{0.193140537f, 0.687122703f},
-std::array<float,2>{0.847105861f, 0.0519465432f},
-std::array<float,2>{0.569838703f, 0.58269006f},
-std::array<float,2>{0.26615566f, 0.24691993f},
-std::array<float,2>{0.164656878f, 0.895610213f},
-std::array<float,2>{0.753939748f, 0.45137924f},
-std::array<float,2>{0.929935575f, 0.778062165f},
-std::array<float,2>{0.122325554f, 0.34193033f},
-std::array<float,2>{0.494951427f, 0.714965403f},
-std::array<float,2>{0.719097972f, 0.121143214f},
-std::array<float,2>{0.833615899f, 0.631390631f},
-std::array<float,2>{0.237983942f, 0.0170322042f},
-std::array<float,2>{0.332633317f, 0.874281049f},
-std::array<float,2>{0.51008743f, 0.261401802f},
-std::array<float,2>{0.675103128f, 0.960242331f},
-std::array<float,2>{0.433804423f, 0.376874775f},
-std::array<float,2>{0.057313472f, 0.53923893f},
-std::array<float,2>{0.938293457f, 0.131838113f},
-std::array<float,2>{0.507591128f, 0.699842334f},
-std::array<float,2>{0.337956339f, 0.102231942f},
-std::array<float,2>{0.244603753f, 0.758927882f},
-std::array<float,2>{0.836709559f, 0.325627387f},
-std::array<float,2>{0.94962877f, 0.87861985f},
-std::array<float,2>{0.0498201363f, 0.460950285f},
-std::array<float,2>{0.422624618f, 0.573727787f},
-std::array<float,2>{0.681024849f, 0.231184006f},
-std::array<float,2>{0.758122087f, 0.552549243f},
-std::array<float,2>{0.16174534f, 0.140696511f},
-std::array<float,2>{0.276621729f, 0.944025099f},
-std::array<float,2>{0.570865333f, 0.405783266f},
-std::array<float,2>{0.731228232f, 0.847338915f},
-std::array<float,2>{0.488109916f, 0.275590777f},
-std::array<float,2>{0.111504711f, 0.646378815f},
-std::array<float,2>{0.924190998f, 0.00192318996f},
-std::array<float,2>{0.647556543f, 0.597020268f},
-std::array<float,2>{0.384521306f, 0.202246562f},
-std::array<float,2>{0.0131996442f, 0.933492064f},
-std::array<float,2>{0.982945621f, 0.481903315f},
-std::array<float,2>{0.852287829f, 0.795530617f},
-std::array<float,2>{0.198169664f, 0.365533352f},
-std::array<float,2>{0.35843581f, 0.739261746f},
-std::array<float,2>{0.545902491f, 0.0749246404f},
-std::array<float,2>{0.898491383f, 0.669852197f},
-std::array<float,2>{0.0640430748f, 0.0453613065f},
-std::array<float,2>{0.439927399f, 0.821181238f},
-std::array<float,2>{0.703099132f, 0.295272231f},
-std::array<float,2>{0.597457647f, 0.97623831f},
-std::array<float,2>{0.298063576f, 0.423864454f},
-std::array<float,2>{0.133926839f, 0.516558111f},
-std::array<float,2>{0.805757701f, 0.168350637f},
-std::array<float,2>{0.70599699f, 0.626439333f},
-std::array<float,2>{0.455945522f, 0.0214491338f},
-std::array<float,2>{0.0935406536f, 0.86797142f},
-std::array<float,2>{0.884038746f, 0.261959672f},
-std::array<float,2>{0.787557006f, 0.953873694f},
-std::array<float,2>{0.143474638f, 0.37891221f},
-std::array<float,2>{0.281409174f, 0.546055555f},
-std::array<float,2>{0.620724022f, 0.12874797f},
-std::array<float,2>{0.984455287f, 0.579460144f},
-std::array<float,2>{0.0288225077f, 0.244088098f},
-std::array<float,2>{0.393715411f, 0.890718043f},
-std::array<float,2>{0.636342704f, 0.445994705f},
-std::array<float,2>{0.551136971f, 0.776775062f},
-std::array<float,2>{0.366035402f, 0.338547289f},
-std::array<float,2>{0.215290517f, 0.712425292f},
-std::array<float,2>{0.868462205f, 0.118186757f},
-std::array<float,2>{0.58590138f, 0.501249969f},
-std::array<float,2>{0.263747603f, 0.179553866f},
-std::array<float,2>{0.178691745f, 0.99055922f},
-std::array<float,2>{0.775931418f, 0.419824123f},
-std::array<float,2>{0.914495647f, 0.842905939f},
-std::array<float,2>{0.109320149f, 0.312409163f},
-std::array<float,2>{0.482312828f, 0.682655692f},
-std::array<float,2>{0.737215936f, 0.0487977415f},
-std::array<float,2>{0.814515531f, 0.724817038f},
-std::array<float,2>{0.227135912f, 0.0931947082f},
-std::array<float,2>{0.324272603f, 0.801936448f},
-std::array<float,2>{0.522715271f, 0.353425354f},
-std::array<float,2>{0.65670681f, 0.912449956f},
-std::array<float,2>{0.421703041f, 0.494128883f},
-std::array<float,2>{0.0388254672f, 0.61231041f},
-std::array<float,2>{0.958092391f, 0.204219475f},
-std::array<float,2>{0.610239565f, 0.67314446f},
-std::array<float,2>{0.294283897f, 0.0564857125f},
-std::array<float,2>{0.151578397f, 0.834252059f},
-std::array<float,2>{0.794851601f, 0.299619704f},
-std::array<float,2>{0.876035333f, 0.992238104f},
-std::array<float,2>{0.0848113522f, 0.407281786f},
-std::array<float,2>{0.463084877f, 0.515570343f},
-std::array<float,2>{0.714360952f, 0.180388689f},
-std::array<float,2>{0.865967989f, 0.617889524f},
-std::array<float,2>{0.208601654f, 0.216623321f},
-std::array<float,2>{0.369710088f, 0.91905421f},
-std::array<float,2>{0.559992075f, 0.487118155f},
-std::array<float,2>{0.62705636f, 0.808561325f},
-std::array<float,2>{0.402739227f, 0.350120753f},
-std::array<float,2>{0.0212598089f, 0.734012544f},
-std::array<float,2>{0.997401118f, 0.0850164667f},
-std::array<float,2>{0.744230151f, 0.533533692f},
-std::array<float,2>{0.472603112f, 0.132986367f},
-std::array<float,2>{0.0981287509f, 0.968286157f},
-std::array<float,2>{0.906877458f, 0.386230469f},
-std::array<float,2>{0.772112072f, 0.865866244f},
-std::array<float,2>{0.18662785f, 0.250470847f},
-std::array<float,2>{0.254022866f, 0.635094881f},
-std::array<float,2>{0.589043438f, 0.0295719132f},
-std::array<float,2>{0.963929415f, 0.708466411f},
-std::array<float,2>{0.0407772288f, 0.116951741f},
-std::array<float,2>{0.409322143f, 0.768194377f},
-std::array<float,2>{0.670572877f, 0.333660573f},
-std::array<float,2>{0.523597896f, 0.905047834f},
-std::array<float,2>{0.31627956f, 0.442776114f},
-std::array<float,2>{0.223637164f, 0.591774762f},
-std::array<float,2>{0.826039314f, 0.237304121f},
-std::array<float,2>{0.676984489f, 0.743535697f},
-std::array<float,2>{0.432560533f, 0.0672060773f},
-std::array<float,2>{0.0613175631f, 0.782461345f},
-std::array<float,2>{0.943910837f, 0.374738425f},
-std::array<float,2>{0.831794381f, 0.928251386f},
-std::array<float,2>{0.240749136f, 0.468784273f},
-std::array<float,2>{0.330809534f, 0.604500532f},
-std::array<float,2>{0.511822402f, 0.190911219f},
-std::array<float,2>{0.936224461f, 0.524643183f},
-std::array<float,2>{0.117363736f, 0.156465709f},
-std::array<float,2>{0.496941f, 0.977600396f},
-std::array<float,2>{0.72588259f, 0.43065986f},
-std::array<float,2>{0.564185262f, 0.812585235f},
-std::array<float,2>{0.271456242f, 0.287729591f},
-std::array<float,2>{0.170092419f, 0.662300408f},
-std::array<float,2>{0.753809929f, 0.0363229774f},
-std::array<float,2>{0.533883154f, 0.569069743f},
-std::array<float,2>{0.346583515f, 0.22371076f},
-std::array<float,2>{0.190092787f, 0.888237178f},
-std::array<float,2>{0.849059701f, 0.455933362f},
-std::array<float,2>{0.971311271f, 0.757727802f},
-std::array<float,2>{0.0031397182f, 0.319600135f},
-std::array<float,2>{0.382031351f, 0.687650561f},
-std::array<float,2>{0.65612781f, 0.0938314945f},
-std::array<float,2>{0.801391423f, 0.653238952f},
-std::array<float,2>{0.132517889f, 0.0140372375f},
-std::array<float,2>{0.30479899f, 0.858973444f},
-std::array<float,2>{0.607454777f, 0.271343946f},
-std::array<float,2>{0.692365885f, 0.950960994f},
-std::array<float,2>{0.446996599f, 0.397393495f},
-std::array<float,2>{0.0728486553f, 0.555283487f},
-std::array<float,2>{0.897512019f, 0.15477176f},
-std::array<float,2>{0.5768888f, 0.727927804f},
-std::array<float,2>{0.279954284f, 0.0803926364f},
-std::array<float,2>{0.156541184f, 0.808632433f},
-std::array<float,2>{0.763576984f, 0.345503122f},
-std::array<float,2>{0.928592384f, 0.914192557f},
-std::array<float,2>{0.115617499f, 0.491244793f},
-std::array<float,2>{0.488323182f, 0.624799669f},
-std::array<float,2>{0.728414416f, 0.213683009f},
-std::array<float,2>{0.840061486f, 0.508132458f},
-std::array<float,2>{0.246963292f, 0.185531631f},
-std::array<float,2>{0.340766162f, 0.997047484f},
-std::array<float,2>{0.502065122f, 0.412483543f},
-std::array<float,2>{0.687007368f, 0.83166641f},
-std::array<float,2>{0.427340537f, 0.302318901f},
-std::array<float,2>{0.0536047332f, 0.678704321f},
-std::array<float,2>{0.948951304f, 0.0615333803f},
-std::array<float,2>{0.695441365f, 0.588902712f},
-std::array<float,2>{0.443837643f, 0.2410561f},
-std::array<float,2>{0.0675883368f, 0.90040791f},
-std::array<float,2>{0.902936101f, 0.438158721f},
-std::array<float,2>{0.812034011f, 0.77198565f},
-std::array<float,2>{0.139478832f, 0.331529081f},
-std::array<float,2>{0.302337945f, 0.706582844f},
-std::array<float,2>{0.599991441f, 0.110519297f},
-std::array<float,2>{0.980050445f, 0.637554884f},
-std::array<float,2>{0.00905009545f, 0.0252808277f},
-std::array<float,2>{0.389618725f, 0.863001049f},
-std::array<float,2>{0.641346157f, 0.254848242f},
-std::array<float,2>{0.542379975f, 0.963440537f},
-std::array<float,2>{0.354709595f, 0.387795627f},
-std::array<float,2>{0.202487603f, 0.538461864f},
-std::array<float,2>{0.855531573f, 0.137843624f},
-std::array<float,2>{0.636735857f, 0.659027755f},
-std::array<float,2>{0.398370177f, 0.0343519449f},
-std::array<float,2>{0.0247159619f, 0.819684684f},
-std::array<float,2>{0.988609433f, 0.281714082f},
-std::array<float,2>{0.871295512f, 0.981502533f},
-std::array<float,2>{0.212849095f, 0.435006708f},
-std::array<float,2>{0.362128913f, 0.527951241f},
-std::array<float,2>{0.550208688f, 0.162550792f},
-std::array<float,2>{0.888492167f, 0.60547924f},
-std::array<float,2>{0.0891203433f, 0.193471551f},
-std::array<float,2>{0.458993912f, 0.924966514f},
-std::array<float,2>{0.708617151f, 0.472794533f},
-std::array<float,2>{0.624301672f, 0.788453341f},
-std::array<float,2>{0.286519051f, 0.36956802f},
-std::array<float,2>{0.147523209f, 0.749612391f},
-std::array<float,2>{0.781947553f, 0.0640101135f},
-std::array<float,2>{0.516040146f, 0.562330902f},
-std::array<float,2>{0.32184729f, 0.151655316f},
-std::array<float,2>{0.231867239f, 0.946415484f},
-std::array<float,2>{0.816730917f, 0.392397076f},
-std::array<float,2>{0.95651257f, 0.854358315f},
-std::array<float,2>{0.0323597938f, 0.266100138f},
-std::array<float,2>{0.416959316f, 0.650280178f},
-std::array<float,2>{0.661883771f, 0.00982171856f},
-std::array<float,2>{0.780570388f, 0.694723427f},
-std::array<float,2>{0.173899546f, 0.0976790115f},
-std::array<float,2>{0.259862661f, 0.75103116f},
-std::array<float,2>{0.581720114f, 0.315862f},
-std::array<float,2>{0.738494337f, 0.883452892f},
-std::array<float,2>{0.479441404f, 0.459095627f},
-std::array<float,2>{0.10233067f, 0.563464582f},
-std::array<float,2>{0.918919921f, 0.220775157f},
-std::array<float,2>{0.556300998f, 0.641862988f},
-std::array<float,2>{0.373923749f, 0.00510476716f},
-std::array<float,2>{0.206330344f, 0.851476729f},
-std::array<float,2>{0.862914681f, 0.278826118f},
-std::array<float,2>{0.994274497f, 0.938497424f},
-std::array<float,2>{0.0160766281f, 0.400022298f},
-std::array<float,2>{0.401472092f, 0.55001694f},
-std::array<float,2>{0.631324828f, 0.145200104f},
-std::array<float,2>{0.789750099f, 0.577920437f},
-std::array<float,2>{0.155132532f, 0.22711724f},
-std::array<float,2>{0.290402055f, 0.881126225f},
-std::array<float,2>{0.617062449f, 0.465299785f},
-std::array<float,2>{0.716310799f, 0.765365958f},
-std::array<float,2>{0.46707204f, 0.321737647f},
-std::array<float,2>{0.0807526782f, 0.697133958f},
-std::array<float,2>{0.880957544f, 0.107736699f},
-std::array<float,2>{0.664313257f, 0.521485984f},
-std::array<float,2>{0.412454486f, 0.164786488f},
-std::array<float,2>{0.0446818806f, 0.969117939f},
-std::array<float,2>{0.96680218f, 0.425999194f},
-std::array<float,2>{0.82098043f, 0.825786948f},
-std::array<float,2>{0.222646981f, 0.2908369f},
-std::array<float,2>{0.319379598f, 0.667582512f},
-std::array<float,2>{0.52772671f, 0.0408754461f},
-std::array<float,2>{0.912140548f, 0.737004042f},
-std::array<float,2>{0.0960173979f, 0.0729942992f},
-std::array<float,2>{0.474408746f, 0.789821625f},
-std::array<float,2>{0.748574734f, 0.361870408f},
-std::array<float,2>{0.593675256f, 0.935061336f},
-std::array<float,2>{0.253615528f, 0.478336334f},
-std::array<float,2>{0.183415428f, 0.599130571f},
-std::array<float,2>{0.769182563f, 0.199124426f},
-std::array<float,2>{0.721476138f, 0.718225062f},
-std::array<float,2>{0.492400944f, 0.12496189f},
-std::array<float,2>{0.123613603f, 0.779361606f},
-std::array<float,2>{0.932488382f, 0.340561926f},
-std::array<float,2>{0.757357419f, 0.897120178f},
-std::array<float,2>{0.167854294f, 0.450807631f},
-std::array<float,2>{0.267691344f, 0.585129201f},
-std::array<float,2>{0.567758739f, 0.248417601f},
-std::array<float,2>{0.941028416f, 0.542770028f},
-std::array<float,2>{0.0556074083f, 0.12901251f},
-std::array<float,2>{0.437289f, 0.958645046f},
-std::array<float,2>{0.673803806f, 0.377574682f},
-std::array<float,2>{0.508726597f, 0.872496307f},
-std::array<float,2>{0.3352997f, 0.258842707f},
-std::array<float,2>{0.235936329f, 0.630009055f},
-std::array<float,2>{0.834255338f, 0.0187736023f},
-std::array<float,2>{0.605307996f, 0.616738975f},
-std::array<float,2>{0.308814675f, 0.210651919f},
-std::array<float,2>{0.127370775f, 0.908898354f},
-std::array<float,2>{0.798179328f, 0.497266889f},
-std::array<float,2>{0.892425299f, 0.798730612f},
-std::array<float,2>{0.0778929293f, 0.35551706f},
-std::array<float,2>{0.451533765f, 0.721495748f},
-std::array<float,2>{0.689711928f, 0.0875665098f},
-std::array<float,2>{0.844391525f, 0.684068859f},
-std::array<float,2>{0.193634689f, 0.0543214642f},
-std::array<float,2>{0.351490408f, 0.838837981f},
-std::array<float,2>{0.536758661f, 0.305142283f},
-std::array<float,2>{0.651966631f, 0.988202035f},
-std::array<float,2>{0.377910048f, 0.41580978f},
-std::array<float,2>{0.00588220358f, 0.504942954f},
-std::array<float,2>{0.972909451f, 0.173469648f},
-std::array<float,2>{0.502231598f, 0.729650199f},
-std::array<float,2>{0.34037742f, 0.0799002349f},
-std::array<float,2>{0.246670976f, 0.810847044f},
-std::array<float,2>{0.840139151f, 0.34588173f},
-std::array<float,2>{0.949079752f, 0.917495191f},
-std::array<float,2>{0.0532751456f, 0.489158839f},
-std::array<float,2>{0.427717f, 0.621589839f},
-std::array<float,2>{0.686651051f, 0.21167098f},
-std::array<float,2>{0.763304651f, 0.511653841f},
-std::array<float,2>{0.15625681f, 0.186898425f},
-std::array<float,2>{0.280192345f, 0.999799013f},
-std::array<float,2>{0.577104092f, 0.410976738f},
-std::array<float,2>{0.728156328f, 0.829471111f},
-std::array<float,2>{0.488536805f, 0.304485798f},
-std::array<float,2>{0.115454927f, 0.675914645f},
-std::array<float,2>{0.928453565f, 0.0596996471f},
-std::array<float,2>{0.641436934f, 0.587267578f},
-std::array<float,2>{0.389164239f, 0.238462865f},
-std::array<float,2>{0.00882973801f, 0.899004936f},
-std::array<float,2>{0.980381608f, 0.439525187f},
-std::array<float,2>{0.855853617f, 0.770896018f},
-std::array<float,2>{0.202291831f, 0.328565419f},
-std::array<float,2>{0.354846656f, 0.703193307f},
-std::array<float,2>{0.542017519f, 0.111844704f},
-std::array<float,2>{0.903312266f, 0.63931942f},
-std::array<float,2>{0.0677105188f, 0.025582863f},
-std::array<float,2>{0.4435592f, 0.860925019f},
-std::array<float,2>{0.695559859f, 0.256651193f},
-std::array<float,2>{0.599692464f, 0.961338222f},
-std::array<float,2>{0.30267483f, 0.389453322f},
-std::array<float,2>{0.139336199f, 0.535490394f},
-std::array<float,2>{0.812357366f, 0.140098482f},
-std::array<float,2>{0.70898217f, 0.658063531f},
-std::array<float,2>{0.459308892f, 0.0319247432f},
-std::array<float,2>{0.0890401304f, 0.818166554f},
-std::array<float,2>{0.888354957f, 0.283848286f},
-std::array<float,2>{0.782169759f, 0.983916283f},
-std::array<float,2>{0.147847757f, 0.43696326f},
-std::array<float,2>{0.286293685f, 0.530279458f},
-std::array<float,2>{0.624031901f, 0.16202271f},
-std::array<float,2>{0.988442838f, 0.608199477f},
-std::array<float,2>{0.0245463289f, 0.191847101f},
-std::array<float,2>{0.398131102f, 0.922280431f},
-std::array<float,2>{0.637107611f, 0.476077735f},
-std::array<float,2>{0.549875915f, 0.785925686f},
-std::array<float,2>{0.361864269f, 0.367315292f},
-std::array<float,2>{0.212617218f, 0.746197701f},
-std::array<float,2>{0.871488631f, 0.0655368939f},
-std::array<float,2>{0.58195138f, 0.559716403f},
-std::array<float,2>{0.260136724f, 0.149092525f},
-std::array<float,2>{0.174108908f, 0.94740802f},
-std::array<float,2>{0.780334413f, 0.39354983f},
-std::array<float,2>{0.918667138f, 0.853309274f},
-std::array<float,2>{0.102203354f, 0.26873523f},
-std::array<float,2>{0.479091406f, 0.651043117f},
-std::array<float,2>{0.738744318f, 0.00797714759f},
-std::array<float,2>{0.816568911f, 0.692467391f},
-std::array<float,2>{0.231556058f, 0.10072092f},
-std::array<float,2>{0.322086573f, 0.75221175f},
-std::array<float,2>{0.515811682f, 0.313170612f},
-std::array<float,2>{0.661766708f, 0.885093451f},
-std::array<float,2>{0.416514069f, 0.457642823f},
-std::array<float,2>{0.0326330364f, 0.566198528f},
-std::array<float,2>{0.956055403f, 0.219801977f},
-std::array<float,2>{0.61681807f, 0.64367491f},
-std::array<float,2>{0.290243f, 0.00692577567f},
-std::array<float,2>{0.154834956f, 0.847686827f},
-std::array<float,2>{0.789882481f, 0.279917687f},
-std::array<float,2>{0.8811813f, 0.940737724f},
-std::array<float,2>{0.0810053498f, 0.402109444f},
-std::array<float,2>{0.466961324f, 0.546938658f},
-std::array<float,2>{0.716728866f, 0.148360997f},
-std::array<float,2>{0.863173783f, 0.574604452f},
-std::array<float,2>{0.206238255f, 0.228763327f},
-std::array<float,2>{0.373683214f, 0.879799247f},
-std::array<float,2>{0.556559801f, 0.467197418f},
-std::array<float,2>{0.631067991f, 0.762195349f},
-std::array<float,2>{0.401739389f, 0.323699027f},
-std::array<float,2>{0.015822418f, 0.697634518f},
-std::array<float,2>{0.994477689f, 0.105516069f},
-std::array<float,2>{0.748826265f, 0.519757628f},
-std::array<float,2>{0.474280804f, 0.166990012f},
-std::array<float,2>{0.0957071334f, 0.972350836f},
-std::array<float,2>{0.91251862f, 0.42794168f},
-std::array<float,2>{0.769443393f, 0.828124225f},
-std::array<float,2>{0.183153927f, 0.291600317f},
-std::array<float,2>{0.253708303f, 0.665297806f},
-std::array<float,2>{0.593468845f, 0.0419665053f},
-std::array<float,2>{0.967063963f, 0.73577255f},
-std::array<float,2>{0.0444352478f, 0.0721082687f},
-std::array<float,2>{0.412145227f, 0.79107511f},
-std::array<float,2>{0.664278626f, 0.360890269f},
-std::array<float,2>{0.527486503f, 0.937292099f},
-std::array<float,2>{0.319740355f, 0.479651153f},
-std::array<float,2>{0.222385123f, 0.600811541f},
-std::array<float,2>{0.821115315f, 0.195570663f},
-std::array<float,2>{0.673564672f, 0.715980768f},
-std::array<float,2>{0.43720904f, 0.12213809f},
-std::array<float,2>{0.05520555f, 0.778730929f},
-std::array<float,2>{0.94125104f, 0.343274832f},
-std::array<float,2>{0.834027052f, 0.895238221f},
-std::array<float,2>{0.236138597f, 0.452245593f},
-std::array<float,2>{0.335139602f, 0.583763599f},
-std::array<float,2>{0.508365512f, 0.247652218f},
-std::array<float,2>{0.932314157f, 0.540080011f},
-std::array<float,2>{0.123846777f, 0.131680757f},
-std::array<float,2>{0.492632985f, 0.959361434f},
-std::array<float,2>{0.721312582f, 0.37575832f},
-std::array<float,2>{0.567388177f, 0.8733145f},
-std::array<float,2>{0.268050015f, 0.259922713f},
-std::array<float,2>{0.167562991f, 0.63243866f},
-std::array<float,2>{0.757657528f, 0.01590514f},
-std::array<float,2>{0.537048757f, 0.614759743f},
-std::array<float,2>{0.351273566f, 0.207983077f},
-std::array<float,2>{0.193513915f, 0.907487154f},
-std::array<float,2>{0.844557524f, 0.498945564f},
-std::array<float,2>{0.972790062f, 0.800266802f},
-std::array<float,2>{0.00614756858f, 0.357607007f},
-std::array<float,2>{0.377582401f, 0.7188012f},
-std::array<float,2>{0.652293444f, 0.0888597965f},
-std::array<float,2>{0.798039913f, 0.686204731f},
-std::array<float,2>{0.127119243f, 0.0509144366f},
-std::array<float,2>{0.309020191f, 0.836865604f},
-std::array<float,2>{0.604989767f, 0.307823092f},
-std::array<float,2>{0.689628303f, 0.986087739f},
-std::array<float,2>{0.451205432f, 0.416392118f},
-std::array<float,2>{0.0778121054f, 0.507328689f},
-std::array<float,2>{0.892170608f, 0.174169496f},
-std::array<float,2>{0.571243227f, 0.703121603f},
-std::array<float,2>{0.276418507f, 0.103780642f},
-std::array<float,2>{0.161971986f, 0.760070205f},
-std::array<float,2>{0.757831097f, 0.327394485f},
-std::array<float,2>{0.924029946f, 0.875186503f},
-std::array<float,2>{0.111705519f, 0.463580698f},
-std::array<float,2>{0.487980902f, 0.570943296f},
-std::array<float,2>{0.730987489f, 0.232495159f},
-std::array<float,2>{0.836529315f, 0.553721726f},
-std::array<float,2>{0.24433586f, 0.143817306f},
-std::array<float,2>{0.338194698f, 0.942893326f},
-std::array<float,2>{0.50740844f, 0.402811438f},
-std::array<float,2>{0.680821538f, 0.845270395f},
-std::array<float,2>{0.42257601f, 0.273986906f},
-std::array<float,2>{0.0501976945f, 0.647997618f},
-std::array<float,2>{0.9492594f, 0.00261371699f},
-std::array<float,2>{0.702732325f, 0.594975471f},
-std::array<float,2>{0.439560562f, 0.20005706f},
-std::array<float,2>{0.0644343048f, 0.931055844f},
-std::array<float,2>{0.898892343f, 0.484135419f},
-std::array<float,2>{0.806074679f, 0.793743849f},
-std::array<float,2>{0.13418065f, 0.364116997f},
-std::array<float,2>{0.298250347f, 0.740682185f},
-std::array<float,2>{0.597378314f, 0.0774762854f},
-std::array<float,2>{0.983254731f, 0.671309054f},
-std::array<float,2>{0.0135319019f, 0.0449075364f},
-std::array<float,2>{0.384586006f, 0.823554158f},
-std::array<float,2>{0.647750616f, 0.293385118f},
-std::array<float,2>{0.546333671f, 0.973830581f},
-std::array<float,2>{0.358646542f, 0.422014087f},
-std::array<float,2>{0.197963402f, 0.518813193f},
-std::array<float,2>{0.852478445f, 0.170284972f},
-std::array<float,2>{0.636480689f, 0.628869116f},
-std::array<float,2>{0.393873453f, 0.0231875367f},
-std::array<float,2>{0.0291452762f, 0.87046957f},
-std::array<float,2>{0.984824538f, 0.264145911f},
-std::array<float,2>{0.868176043f, 0.956734896f},
-std::array<float,2>{0.215023831f, 0.382791936f},
-std::array<float,2>{0.365871727f, 0.543588936f},
-std::array<float,2>{0.550965905f, 0.125052467f},
-std::array<float,2>{0.883932233f, 0.581511676f},
-std::array<float,2>{0.0933298394f, 0.244845748f},
-std::array<float,2>{0.455567539f, 0.89269197f},
-std::array<float,2>{0.705731452f, 0.449058115f},
-std::array<float,2>{0.620903909f, 0.774790406f},
-std::array<float,2>{0.281560987f, 0.33605364f},
-std::array<float,2>{0.143202141f, 0.713358104f},
-std::array<float,2>{0.787288785f, 0.119320467f},
-std::array<float,2>{0.522540092f, 0.502345622f},
-std::array<float,2>{0.324540734f, 0.17749846f},
-std::array<float,2>{0.227481738f, 0.988296747f},
-std::array<float,2>{0.814931691f, 0.42116636f},
-std::array<float,2>{0.958452523f, 0.841026247f},
-std::array<float,2>{0.0386885032f, 0.310170829f},
-std::array<float,2>{0.421503991f, 0.681240857f},
-std::array<float,2>{0.656358302f, 0.0496785939f},
-std::array<float,2>{0.776134431f, 0.722715378f},
-std::array<float,2>{0.178258494f, 0.0913471505f},
-std::array<float,2>{0.263978124f, 0.802785099f},
-std::array<float,2>{0.585651875f, 0.35480997f},
-std::array<float,2>{0.736848116f, 0.911208391f},
-std::array<float,2>{0.48213324f, 0.495772958f},
-std::array<float,2>{0.109042935f, 0.610244095f},
-std::array<float,2>{0.91407305f, 0.206434458f},
-std::array<float,2>{0.559665024f, 0.674738765f},
-std::array<float,2>{0.370021641f, 0.0576174036f},
-std::array<float,2>{0.208926991f, 0.833559096f},
-std::array<float,2>{0.865754843f, 0.298813164f},
-std::array<float,2>{0.997083724f, 0.994528532f},
-std::array<float,2>{0.0210381001f, 0.409176558f},
-std::array<float,2>{0.402564585f, 0.513206959f},
-std::array<float,2>{0.627214432f, 0.182921529f},
-std::array<float,2>{0.794622719f, 0.620001793f},
-std::array<float,2>{0.151674345f, 0.218097523f},
-std::array<float,2>{0.294131607f, 0.921641469f},
-std::array<float,2>{0.610103667f, 0.484880388f},
-std::array<float,2>{0.714802027f, 0.805263102f},
-std::array<float,2>{0.463149995f, 0.348206043f},
-std::array<float,2>{0.0846602917f, 0.730500579f},
-std::array<float,2>{0.876403391f, 0.0828462914f},
-std::array<float,2>{0.670671642f, 0.532012463f},
-std::array<float,2>{0.409461319f, 0.135220706f},
-std::array<float,2>{0.0406315923f, 0.965080738f},
-std::array<float,2>{0.964164078f, 0.382991105f},
-std::array<float,2>{0.825893283f, 0.864964068f},
-std::array<float,2>{0.223998159f, 0.252484769f},
-std::array<float,2>{0.316123277f, 0.633545697f},
-std::array<float,2>{0.523801208f, 0.0285250284f},
-std::array<float,2>{0.907078445f, 0.709618926f},
-std::array<float,2>{0.0977029055f, 0.113369949f},
-std::array<float,2>{0.472263396f, 0.767221928f},
-std::array<float,2>{0.744558454f, 0.335411966f},
-std::array<float,2>{0.589174926f, 0.903411329f},
-std::array<float,2>{0.254377306f, 0.44378224f},
-std::array<float,2>{0.186899334f, 0.592502952f},
-std::array<float,2>{0.772280514f, 0.235356823f},
-std::array<float,2>{0.725590467f, 0.745293677f},
-std::array<float,2>{0.496798575f, 0.0686073303f},
-std::array<float,2>{0.117466286f, 0.784725308f},
-std::array<float,2>{0.936522186f, 0.37194854f},
-std::array<float,2>{0.753524303f, 0.927449048f},
-std::array<float,2>{0.170270026f, 0.470848769f},
-std::array<float,2>{0.271128148f, 0.602161527f},
-std::array<float,2>{0.564213872f, 0.188711658f},
-std::array<float,2>{0.944320619f, 0.526293576f},
-std::array<float,2>{0.0610632896f, 0.159710854f},
-std::array<float,2>{0.432238132f, 0.97965467f},
-std::array<float,2>{0.677028537f, 0.433471233f},
-std::array<float,2>{0.512126744f, 0.815571249f},
-std::array<float,2>{0.330877423f, 0.286725193f},
-std::array<float,2>{0.241046473f, 0.661473751f},
-std::array<float,2>{0.831695318f, 0.0385891646f},
-std::array<float,2>{0.607908964f, 0.567187905f},
-std::array<float,2>{0.305020511f, 0.225610435f},
-std::array<float,2>{0.132657871f, 0.889984548f},
-std::array<float,2>{0.801573098f, 0.454778731f},
-std::array<float,2>{0.897841513f, 0.754157245f},
-std::array<float,2>{0.0729981512f, 0.317108661f},
-std::array<float,2>{0.447251588f, 0.689592779f},
-std::array<float,2>{0.691941977f, 0.0967187211f},
-std::array<float,2>{0.848694086f, 0.655504465f},
-std::array<float,2>{0.190192387f, 0.013510501f},
-std::array<float,2>{0.346346438f, 0.856562257f},
-std::array<float,2>{0.533989191f, 0.271576077f},
-std::array<float,2>{0.655871689f, 0.952121258f},
-std::array<float,2>{0.382082433f, 0.395794123f},
-std::array<float,2>{0.00320475246f, 0.558027267f},
-std::array<float,2>{0.971557021f, 0.152942225f},
-std::array<float,2>{0.539745033f, 0.705894887f},
-std::array<float,2>{0.352352977f, 0.110250272f},
-std::array<float,2>{0.200633764f, 0.773285687f},
-std::array<float,2>{0.858733535f, 0.330568224f},
-std::array<float,2>{0.977829993f, 0.901984334f},
-std::array<float,2>{0.0115178581f, 0.439095467f},
-std::array<float,2>{0.387300044f, 0.588441789f},
-std::array<float,2>{0.643330276f, 0.24170725f},
-std::array<float,2>{0.808867216f, 0.537849426f},
-std::array<float,2>{0.13818942f, 0.13721624f},
-std::array<float,2>{0.304481179f, 0.964377522f},
-std::array<float,2>{0.599234045f, 0.3875359f},
-std::array<float,2>{0.697869539f, 0.86174494f},
-std::array<float,2>{0.44324097f, 0.255043119f},
-std::array<float,2>{0.0695563927f, 0.638175905f},
-std::array<float,2>{0.90487349f, 0.0241124202f},
-std::array<float,2>{0.685209811f, 0.623536944f},
-std::array<float,2>{0.428275973f, 0.214650795f},
-std::array<float,2>{0.0521839261f, 0.915711641f},
-std::array<float,2>{0.945578456f, 0.490691453f},
-std::array<float,2>{0.843553722f, 0.810405076f},
-std::array<float,2>{0.249711305f, 0.344454885f},
-std::array<float,2>{0.343140483f, 0.7273736f},
-std::array<float,2>{0.500562012f, 0.081104964f},
-std::array<float,2>{0.926314652f, 0.678788066f},
-std::array<float,2>{0.113351636f, 0.0612294525f},
-std::array<float,2>{0.491506547f, 0.830206871f},
-std::array<float,2>{0.728555918f, 0.30108729f},
-std::array<float,2>{0.575642169f, 0.997130692f},
-std::array<float,2>{0.277887523f, 0.413787663f},
-std::array<float,2>{0.158324316f, 0.509281397f},
-std::array<float,2>{0.763942182f, 0.183958173f},
-std::array<float,2>{0.741822302f, 0.648605049f},
-std::array<float,2>{0.4769077f, 0.0109558711f},
-std::array<float,2>{0.10380514f, 0.855236769f},
-std::array<float,2>{0.920419991f, 0.267565697f},
-std::array<float,2>{0.777724981f, 0.945907056f},
-std::array<float,2>{0.172631845f, 0.390826374f},
-std::array<float,2>{0.258788466f, 0.561064065f},
-std::array<float,2>{0.578817785f, 0.151306659f},
-std::array<float,2>{0.953588545f, 0.563625276f},
-std::array<float,2>{0.0344565995f, 0.221959084f},
-std::array<float,2>{0.415710956f, 0.884486973f},
-std::array<float,2>{0.662776232f, 0.460321099f},
-std::array<float,2>{0.519509315f, 0.750575423f},
-std::array<float,2>{0.323047698f, 0.314904928f},
-std::array<float,2>{0.232819557f, 0.694232702f},
-std::array<float,2>{0.819252849f, 0.0988341421f},
-std::array<float,2>{0.621514559f, 0.528463542f},
-std::array<float,2>{0.28812322f, 0.163503513f},
-std::array<float,2>{0.146272629f, 0.980587125f},
-std::array<float,2>{0.784551859f, 0.434233844f},
-std::array<float,2>{0.89009738f, 0.818568587f},
-std::array<float,2>{0.0869881213f, 0.282744408f},
-std::array<float,2>{0.4575665f, 0.659778714f},
-std::array<float,2>{0.709089041f, 0.0337016881f},
-std::array<float,2>{0.874189913f, 0.748843372f},
-std::array<float,2>{0.213544056f, 0.063072674f},
-std::array<float,2>{0.360776752f, 0.787439764f},
-std::array<float,2>{0.547725737f, 0.370836526f},
-std::array<float,2>{0.639312088f, 0.924233913f},
-std::array<float,2>{0.394777745f, 0.47418943f},
-std::array<float,2>{0.0263030995f, 0.607420325f},
-std::array<float,2>{0.990531683f, 0.195198268f},
-std::array<float,2>{0.591042995f, 0.666496396f},
-std::array<float,2>{0.251343489f, 0.0392801203f},
-std::array<float,2>{0.18157734f, 0.824611783f},
-std::array<float,2>{0.766485214f, 0.289663166f},
-std::array<float,2>{0.911142766f, 0.969779909f},
-std::array<float,2>{0.0948514938f, 0.427602857f},
-std::array<float,2>{0.474869639f, 0.522481918f},
-std::array<float,2>{0.747078955f, 0.165583879f},
-std::array<float,2>{0.82300061f, 0.597691596f},
-std::array<float,2>{0.219722956f, 0.198008358f},
-std::array<float,2>{0.31801945f, 0.933702707f},
-std::array<float,2>{0.530015945f, 0.477414757f},
-std::array<float,2>{0.666592479f, 0.790367782f},
-std::array<float,2>{0.410725325f, 0.362765282f},
-std::array<float,2>{0.0449777991f, 0.737617075f},
-std::array<float,2>{0.96611774f, 0.0740193948f},
-std::array<float,2>{0.718237758f, 0.549437642f},
-std::array<float,2>{0.466247976f, 0.145718351f},
-std::array<float,2>{0.0794139653f, 0.93755424f},
-std::array<float,2>{0.880628645f, 0.398643464f},
-std::array<float,2>{0.792047143f, 0.849707842f},
-std::array<float,2>{0.153486729f, 0.277668118f},
-std::array<float,2>{0.292728215f, 0.640786827f},
-std::array<float,2>{0.613338709f, 0.0046051899f},
-std::array<float,2>{0.994109631f, 0.695331335f},
-std::array<float,2>{0.0179747492f, 0.109333538f},
-std::array<float,2>{0.399217367f, 0.764551342f},
-std::array<float,2>{0.628968537f, 0.321072191f},
-std::array<float,2>{0.557221413f, 0.882225513f},
-std::array<float,2>{0.372235954f, 0.465848476f},
-std::array<float,2>{0.203412652f, 0.576964676f},
-std::array<float,2>{0.860988915f, 0.228081584f},
-std::array<float,2>{0.650186479f, 0.721821785f},
-std::array<float,2>{0.375102133f, 0.0862365738f},
-std::array<float,2>{0.00391727313f, 0.797039628f},
-std::array<float,2>{0.976053536f, 0.356961429f},
-std::array<float,2>{0.846835494f, 0.909597516f},
-std::array<float,2>{0.192902163f, 0.496609151f},
-std::array<float,2>{0.347713709f, 0.615290105f},
-std::array<float,2>{0.538618863f, 0.209048092f},
-std::array<float,2>{0.892727911f, 0.504037738f},
-std::array<float,2>{0.074243553f, 0.172025368f},
-std::array<float,2>{0.450082153f, 0.986902833f},
-std::array<float,2>{0.689224839f, 0.41461882f},
-std::array<float,2>{0.602981329f, 0.839293242f},
-std::array<float,2>{0.310683012f, 0.306459695f},
-std::array<float,2>{0.126535326f, 0.685378313f},
-std::array<float,2>{0.800554156f, 0.053363964f},
-std::array<float,2>{0.509916663f, 0.584215403f},
-std::array<float,2>{0.332813144f, 0.249108613f},
-std::array<float,2>{0.238074303f, 0.897676289f},
-std::array<float,2>{0.833839476f, 0.449863911f},
-std::array<float,2>{0.938214898f, 0.78085196f},
-std::array<float,2>{0.0574634634f, 0.341014832f},
-std::array<float,2>{0.433985829f, 0.717583835f},
-std::array<float,2>{0.674821794f, 0.123543829f},
-std::array<float,2>{0.754288018f, 0.629705489f},
-std::array<float,2>{0.164916679f, 0.0181881897f},
-std::array<float,2>{0.2665447f, 0.871873319f},
-std::array<float,2>{0.570262372f, 0.257897913f},
-std::array<float,2>{0.718798578f, 0.957057357f},
-std::array<float,2>{0.494637191f, 0.378728211f},
-std::array<float,2>{0.122221023f, 0.541873395f},
-std::array<float,2>{0.929720759f, 0.130723715f},
-std::array<float,2>{0.594789267f, 0.738402367f},
-std::array<float,2>{0.299980313f, 0.0756288022f},
-std::array<float,2>{0.135348096f, 0.796039879f},
-std::array<float,2>{0.808018446f, 0.366232157f},
-std::array<float,2>{0.900585055f, 0.932516217f},
-std::array<float,2>{0.065707311f, 0.481419235f},
-std::array<float,2>{0.438887239f, 0.596354306f},
-std::array<float,2>{0.699282765f, 0.201548055f},
-std::array<float,2>{0.855211318f, 0.51667583f},
-std::array<float,2>{0.195745558f, 0.169228688f},
-std::array<float,2>{0.355478078f, 0.974687517f},
-std::array<float,2>{0.544350326f, 0.425712526f},
-std::array<float,2>{0.645745933f, 0.821951926f},
-std::array<float,2>{0.386064351f, 0.295952916f},
-std::array<float,2>{0.0138486326f, 0.668317616f},
-std::array<float,2>{0.98140651f, 0.0466565229f},
-std::array<float,2>{0.734340608f, 0.572631717f},
-std::array<float,2>{0.484384537f, 0.231493741f},
-std::array<float,2>{0.11085052f, 0.877472699f},
-std::array<float,2>{0.922040522f, 0.462668002f},
-std::array<float,2>{0.761146247f, 0.758729815f},
-std::array<float,2>{0.163464129f, 0.324474841f},
-std::array<float,2>{0.275345683f, 0.700743735f},
-std::array<float,2>{0.573275208f, 0.103275627f},
-std::array<float,2>{0.95255959f, 0.645047069f},
-std::array<float,2>{0.0476483963f, 0.000795072992f},
-std::array<float,2>{0.425139695f, 0.84601146f},
-std::array<float,2>{0.68179816f, 0.276531458f},
-std::array<float,2>{0.504262686f, 0.944593728f},
-std::array<float,2>{0.336378425f, 0.404473424f},
-std::array<float,2>{0.242796227f, 0.551649451f},
-std::array<float,2>{0.837939739f, 0.142114788f},
-std::array<float,2>{0.660027266f, 0.682430208f},
-std::array<float,2>{0.418169528f, 0.0472013839f},
-std::array<float,2>{0.0369643196f, 0.842269838f},
-std::array<float,2>{0.960752547f, 0.311107039f},
-std::array<float,2>{0.813927412f, 0.991298676f},
-std::array<float,2>{0.229771957f, 0.418462038f},
-std::array<float,2>{0.327623397f, 0.500455439f},
-std::array<float,2>{0.519962728f, 0.178538993f},
-std::array<float,2>{0.917558432f, 0.611523747f},
-std::array<float,2>{0.105807103f, 0.203832284f},
-std::array<float,2>{0.482553691f, 0.913713455f},
-std::array<float,2>{0.735701382f, 0.492357045f},
-std::array<float,2>{0.582764387f, 0.801120102f},
-std::array<float,2>{0.261849552f, 0.351913214f},
-std::array<float,2>{0.176466316f, 0.725652337f},
-std::array<float,2>{0.774643779f, 0.0918177143f},
-std::array<float,2>{0.55293864f, 0.545701742f},
-std::array<float,2>{0.364379823f, 0.127368882f},
-std::array<float,2>{0.218105048f, 0.95416373f},
-std::array<float,2>{0.870362997f, 0.380342364f},
-std::array<float,2>{0.987103939f, 0.869107425f},
-std::array<float,2>{0.029738931f, 0.262810588f},
-std::array<float,2>{0.392335176f, 0.625073969f},
-std::array<float,2>{0.633575678f, 0.019541407f},
-std::array<float,2>{0.78587395f, 0.711130738f},
-std::array<float,2>{0.1420241f, 0.11732018f},
-std::array<float,2>{0.283667147f, 0.775715053f},
-std::array<float,2>{0.619105458f, 0.339359343f},
-std::array<float,2>{0.703416884f, 0.892198265f},
-std::array<float,2>{0.454014957f, 0.446794599f},
-std::array<float,2>{0.0914624482f, 0.579018652f},
-std::array<float,2>{0.885207832f, 0.243085176f},
-std::array<float,2>{0.52600497f, 0.636705995f},
-std::array<float,2>{0.312827855f, 0.0308604632f},
-std::array<float,2>{0.2255622f, 0.866598606f},
-std::array<float,2>{0.827848852f, 0.251878679f},
-std::array<float,2>{0.961880147f, 0.966888487f},
-std::array<float,2>{0.0410924628f, 0.385678917f},
-std::array<float,2>{0.406505018f, 0.53430444f},
-std::array<float,2>{0.669157743f, 0.134352446f},
-std::array<float,2>{0.769801497f, 0.589844942f},
-std::array<float,2>{0.184267879f, 0.237885803f},
-std::array<float,2>{0.255948752f, 0.90583986f},
-std::array<float,2>{0.586935103f, 0.44174403f},
-std::array<float,2>{0.742910385f, 0.76890558f},
-std::array<float,2>{0.46926406f, 0.332593024f},
-std::array<float,2>{0.0998244509f, 0.707367778f},
-std::array<float,2>{0.90942359f, 0.115323767f},
-std::array<float,2>{0.625875354f, 0.514543891f},
-std::array<float,2>{0.404345512f, 0.180810213f},
-std::array<float,2>{0.022222152f, 0.993223786f},
-std::array<float,2>{0.999445319f, 0.407036453f},
-std::array<float,2>{0.863318741f, 0.835858703f},
-std::array<float,2>{0.210006252f, 0.300059825f},
-std::array<float,2>{0.367768526f, 0.672382295f},
-std::array<float,2>{0.561996758f, 0.0553123243f},
-std::array<float,2>{0.87710911f, 0.732926726f},
-std::array<float,2>{0.0826057568f, 0.0842675641f},
-std::array<float,2>{0.461064577f, 0.806978881f},
-std::array<float,2>{0.712508023f, 0.351273f},
-std::array<float,2>{0.611523271f, 0.917997122f},
-std::array<float,2>{0.295938432f, 0.487991273f},
-std::array<float,2>{0.148917168f, 0.619098246f},
-std::array<float,2>{0.79617399f, 0.215732887f},
-std::array<float,2>{0.695132673f, 0.688844144f},
-std::array<float,2>{0.448690057f, 0.09544155f},
-std::array<float,2>{0.0710893795f, 0.756602228f},
-std::array<float,2>{0.895180762f, 0.318588585f},
-std::array<float,2>{0.803510368f, 0.887373745f},
-std::array<float,2>{0.130330905f, 0.45670104f},
-std::array<float,2>{0.308474839f, 0.569587588f},
-std::array<float,2>{0.607259035f, 0.223122448f},
-std::array<float,2>{0.969850123f, 0.556299031f},
-std::array<float,2>{0.000751764746f, 0.155342281f},
-std::array<float,2>{0.378947705f, 0.949421763f},
-std::array<float,2>{0.654259682f, 0.397967577f},
-std::array<float,2>{0.5326671f, 0.85758394f},
-std::array<float,2>{0.345484108f, 0.269678116f},
-std::array<float,2>{0.18908976f, 0.653432369f},
-std::array<float,2>{0.850754261f, 0.0153785227f},
-std::array<float,2>{0.564530373f, 0.604090989f},
-std::array<float,2>{0.272737056f, 0.19002679f},
-std::array<float,2>{0.169780776f, 0.92894721f},
-std::array<float,2>{0.750032067f, 0.470626503f},
-std::array<float,2>{0.934129953f, 0.782153547f},
-std::array<float,2>{0.119593725f, 0.37366578f},
-std::array<float,2>{0.498336226f, 0.743044674f},
-std::array<float,2>{0.724498391f, 0.0676648617f},
-std::array<float,2>{0.828963697f, 0.663488567f},
-std::array<float,2>{0.23840113f, 0.0352212936f},
-std::array<float,2>{0.328789234f, 0.813968599f},
-std::array<float,2>{0.515458167f, 0.28840524f},
-std::array<float,2>{0.677942693f, 0.977212906f},
-std::array<float,2>{0.43100813f, 0.431279272f},
-std::array<float,2>{0.0594057962f, 0.523684025f},
-std::array<float,2>{0.942886889f, 0.157967106f},
-std::array<float,2>{0.547860861f, 0.74776572f},
-std::array<float,2>{0.35979408f, 0.0649209768f},
-std::array<float,2>{0.214581594f, 0.786502957f},
-std::array<float,2>{0.873250246f, 0.368510246f},
-std::array<float,2>{0.991562963f, 0.923047721f},
-std::array<float,2>{0.0270173084f, 0.475152314f},
-std::array<float,2>{0.396246582f, 0.6085006f},
-std::array<float,2>{0.639650762f, 0.193176463f},
-std::array<float,2>{0.783404887f, 0.52978307f},
-std::array<float,2>{0.144645542f, 0.160663947f},
-std::array<float,2>{0.28760016f, 0.983202636f},
-std::array<float,2>{0.62260294f, 0.436400712f},
-std::array<float,2>{0.7106812f, 0.81702292f},
-std::array<float,2>{0.458683968f, 0.284587145f},
-std::array<float,2>{0.0864647478f, 0.656992853f},
-std::array<float,2>{0.889324427f, 0.0324341096f},
-std::array<float,2>{0.663198411f, 0.564739823f},
-std::array<float,2>{0.414585114f, 0.219432309f},
-std::array<float,2>{0.0333649442f, 0.886616409f},
-std::array<float,2>{0.954975665f, 0.458617061f},
-std::array<float,2>{0.82025969f, 0.753311634f},
-std::array<float,2>{0.233936921f, 0.314039886f},
-std::array<float,2>{0.323642671f, 0.692014098f},
-std::array<float,2>{0.518234789f, 0.100409389f},
-std::array<float,2>{0.921515942f, 0.651967168f},
-std::array<float,2>{0.104665294f, 0.00973116513f},
-std::array<float,2>{0.478232473f, 0.852399766f},
-std::array<float,2>{0.741121769f, 0.267756462f},
-std::array<float,2>{0.579348087f, 0.948376179f},
-std::array<float,2>{0.259589076f, 0.393897265f},
-std::array<float,2>{0.173414961f, 0.559448242f},
-std::array<float,2>{0.779218972f, 0.15026997f},
-std::array<float,2>{0.730337739f, 0.677278042f},
-std::array<float,2>{0.490421712f, 0.0587200969f},
-std::array<float,2>{0.114531077f, 0.828734875f},
-std::array<float,2>{0.926778197f, 0.30366385f},
-std::array<float,2>{0.765046954f, 0.99857682f},
-std::array<float,2>{0.159805179f, 0.412061453f},
-std::array<float,2>{0.278780371f, 0.510172844f},
-std::array<float,2>{0.574776351f, 0.186327204f},
-std::array<float,2>{0.946774721f, 0.622302294f},
-std::array<float,2>{0.0508177243f, 0.212143153f},
-std::array<float,2>{0.42920348f, 0.916518509f},
-std::array<float,2>{0.683960795f, 0.490105659f},
-std::array<float,2>{0.501937449f, 0.812163353f},
-std::array<float,2>{0.342178285f, 0.347212344f},
-std::array<float,2>{0.2490087f, 0.729171336f},
-std::array<float,2>{0.842507124f, 0.0782258809f},
-std::array<float,2>{0.597898066f, 0.536336243f},
-std::array<float,2>{0.302853018f, 0.139375404f},
-std::array<float,2>{0.137562335f, 0.962704718f},
-std::array<float,2>{0.810236692f, 0.38991943f},
-std::array<float,2>{0.905305982f, 0.860303342f},
-std::array<float,2>{0.0683720112f, 0.257225931f},
-std::array<float,2>{0.442285657f, 0.640038311f},
-std::array<float,2>{0.698609412f, 0.0265082847f},
-std::array<float,2>{0.857587636f, 0.704141319f},
-std::array<float,2>{0.199654907f, 0.112692639f},
-std::array<float,2>{0.352849096f, 0.769900322f},
-std::array<float,2>{0.540851116f, 0.329503715f},
-std::array<float,2>{0.643869638f, 0.89982754f},
-std::array<float,2>{0.387786686f, 0.441143185f},
-std::array<float,2>{0.00989948399f, 0.586812198f},
-std::array<float,2>{0.977015197f, 0.23947376f},
-std::array<float,2>{0.568431139f, 0.630899072f},
-std::array<float,2>{0.266923666f, 0.0174651816f},
-std::array<float,2>{0.165322021f, 0.874807835f},
-std::array<float,2>{0.755108058f, 0.261108965f},
-std::array<float,2>{0.930959761f, 0.960703075f},
-std::array<float,2>{0.121953323f, 0.37631762f},
-std::array<float,2>{0.49537456f, 0.539855957f},
-std::array<float,2>{0.720399499f, 0.132383972f},
-std::array<float,2>{0.832422853f, 0.582243323f},
-std::array<float,2>{0.236584395f, 0.246104926f},
-std::array<float,2>{0.333744019f, 0.896298349f},
-std::array<float,2>{0.510958016f, 0.451848119f},
-std::array<float,2>{0.674612284f, 0.777495086f},
-std::array<float,2>{0.435127825f, 0.34266904f},
-std::array<float,2>{0.0584135093f, 0.715747058f},
-std::array<float,2>{0.93923223f, 0.121827088f},
-std::array<float,2>{0.687911212f, 0.506141007f},
-std::array<float,2>{0.451062113f, 0.175078094f},
-std::array<float,2>{0.0761327818f, 0.98481369f},
-std::array<float,2>{0.893963933f, 0.417198002f},
-std::array<float,2>{0.799166203f, 0.837321579f},
-std::array<float,2>{0.125468254f, 0.306904852f},
-std::array<float,2>{0.312283844f, 0.686775684f},
-std::array<float,2>{0.602408648f, 0.052317448f},
-std::array<float,2>{0.97547102f, 0.719863713f},
-std::array<float,2>{0.00535180513f, 0.0896138325f},
-std::array<float,2>{0.376718342f, 0.799329281f},
-std::array<float,2>{0.648761809f, 0.358509302f},
-std::array<float,2>{0.537394702f, 0.90658617f},
-std::array<float,2>{0.349438131f, 0.49943614f},
-std::array<float,2>{0.192294672f, 0.614014566f},
-std::array<float,2>{0.846627593f, 0.208822578f},
-std::array<float,2>{0.630772054f, 0.699208736f},
-std::array<float,2>{0.399737865f, 0.106762178f},
-std::array<float,2>{0.0192982238f, 0.763165951f},
-std::array<float,2>{0.99273473f, 0.322283626f},
-std::array<float,2>{0.860206604f, 0.880377471f},
-std::array<float,2>{0.205047905f, 0.468047649f},
-std::array<float,2>{0.371712297f, 0.575779319f},
-std::array<float,2>{0.557966053f, 0.230418846f},
-std::array<float,2>{0.879066765f, 0.548175216f},
-std::array<float,2>{0.078338705f, 0.146654993f},
-std::array<float,2>{0.465806991f, 0.939580202f},
-std::array<float,2>{0.717040181f, 0.400450855f},
-std::array<float,2>{0.614469588f, 0.84870708f},
-std::array<float,2>{0.29193756f, 0.280888647f},
-std::array<float,2>{0.152587101f, 0.642863512f},
-std::array<float,2>{0.791439533f, 0.00676968833f},
-std::array<float,2>{0.530925214f, 0.599946141f},
-std::array<float,2>{0.316856027f, 0.196902916f},
-std::array<float,2>{0.220016137f, 0.935947239f},
-std::array<float,2>{0.823960245f, 0.479097962f},
-std::array<float,2>{0.964990675f, 0.792725205f},
-std::array<float,2>{0.0460738689f, 0.360304743f},
-std::array<float,2>{0.411396891f, 0.735339582f},
-std::array<float,2>{0.667325854f, 0.0707640201f},
-std::array<float,2>{0.767221332f, 0.664591312f},
-std::array<float,2>{0.180584311f, 0.0425341092f},
-std::array<float,2>{0.250296712f, 0.826206028f},
-std::array<float,2>{0.590301931f, 0.292196959f},
-std::array<float,2>{0.746373773f, 0.971427858f},
-std::array<float,2>{0.475712508f, 0.429172248f},
-std::array<float,2>{0.0943826884f, 0.521142542f},
-std::array<float,2>{0.910469413f, 0.167454213f},
-std::array<float,2>{0.617737949f, 0.71435672f},
-std::array<float,2>{0.284386247f, 0.120845787f},
-std::array<float,2>{0.141589552f, 0.773696125f},
-std::array<float,2>{0.786825538f, 0.337471753f},
-std::array<float,2>{0.886691451f, 0.894418061f},
-std::array<float,2>{0.0903704613f, 0.447567314f},
-std::array<float,2>{0.45459348f, 0.581002295f},
-std::array<float,2>{0.705007851f, 0.245457709f},
-std::array<float,2>{0.869365215f, 0.544036984f},
-std::array<float,2>{0.217244849f, 0.126569703f},
-std::array<float,2>{0.364163429f, 0.955520928f},
-std::array<float,2>{0.554593205f, 0.38132143f},
-std::array<float,2>{0.633941293f, 0.869150937f},
-std::array<float,2>{0.391052574f, 0.265479058f},
-std::array<float,2>{0.0308760591f, 0.627126038f},
-std::array<float,2>{0.987740457f, 0.0215756427f},
-std::array<float,2>{0.734657705f, 0.611270666f},
-std::array<float,2>{0.483743668f, 0.205339506f},
-std::array<float,2>{0.106912605f, 0.910479665f},
-std::array<float,2>{0.916619956f, 0.49480319f},
-std::array<float,2>{0.773776174f, 0.804412365f},
-std::array<float,2>{0.177407727f, 0.353739947f},
-std::array<float,2>{0.263285875f, 0.724379301f},
-std::array<float,2>{0.583155155f, 0.0903903395f},
-std::array<float,2>{0.959534049f, 0.680229962f},
-std::array<float,2>{0.0353069939f, 0.049969472f},
-std::array<float,2>{0.419142812f, 0.840296924f},
-std::array<float,2>{0.65895015f, 0.309495717f},
-std::array<float,2>{0.520560503f, 0.989911497f},
-std::array<float,2>{0.326536536f, 0.420124501f},
-std::array<float,2>{0.228915691f, 0.503091395f},
-std::array<float,2>{0.81252265f, 0.175803602f},
-std::array<float,2>{0.682779074f, 0.647419095f},
-std::array<float,2>{0.423953772f, 0.00350829307f},
-std::array<float,2>{0.0483414382f, 0.844424844f},
-std::array<float,2>{0.951621056f, 0.275350213f},
-std::array<float,2>{0.839251876f, 0.942072928f},
-std::array<float,2>{0.243998885f, 0.404189348f},
-std::array<float,2>{0.337816507f, 0.553420186f},
-std::array<float,2>{0.505080283f, 0.142867908f},
-std::array<float,2>{0.923394799f, 0.571699619f},
-std::array<float,2>{0.10993281f, 0.233920842f},
-std::array<float,2>{0.486011595f, 0.876587749f},
-std::array<float,2>{0.732904851f, 0.464101702f},
-std::array<float,2>{0.573045135f, 0.761351883f},
-std::array<float,2>{0.273966342f, 0.326592982f},
-std::array<float,2>{0.162839413f, 0.702084601f},
-std::array<float,2>{0.759972692f, 0.105181158f},
-std::array<float,2>{0.543059349f, 0.517615199f},
-std::array<float,2>{0.356507182f, 0.171314761f},
-std::array<float,2>{0.197032183f, 0.973548412f},
-std::array<float,2>{0.854104757f, 0.42320779f},
-std::array<float,2>{0.982125044f, 0.822915792f},
-std::array<float,2>{0.014957373f, 0.294004887f},
-std::array<float,2>{0.385736138f, 0.670230925f},
-std::array<float,2>{0.645003855f, 0.0430427752f},
-std::array<float,2>{0.807605445f, 0.741211534f},
-std::array<float,2>{0.136070594f, 0.0764038563f},
-std::array<float,2>{0.29923594f, 0.794520438f},
-std::array<float,2>{0.594170213f, 0.364794105f},
-std::array<float,2>{0.700618029f, 0.930653036f},
-std::array<float,2>{0.438331157f, 0.483020186f},
-std::array<float,2>{0.0653790832f, 0.594456732f},
-std::array<float,2>{0.902337372f, 0.200514153f},
-std::array<float,2>{0.514268041f, 0.660339475f},
-std::array<float,2>{0.329251915f, 0.0379466526f},
-std::array<float,2>{0.240177661f, 0.814659536f},
-std::array<float,2>{0.8294698f, 0.285987258f},
-std::array<float,2>{0.94210279f, 0.979432702f},
-std::array<float,2>{0.0596402064f, 0.432279289f},
-std::array<float,2>{0.429948956f, 0.526453674f},
-std::array<float,2>{0.679118514f, 0.15913488f},
-std::array<float,2>{0.751360714f, 0.603217125f},
-std::array<float,2>{0.168302894f, 0.187748522f},
-std::array<float,2>{0.272016913f, 0.926629007f},
-std::array<float,2>{0.565947413f, 0.472607225f},
-std::array<float,2>{0.723600984f, 0.783954263f},
-std::array<float,2>{0.499412626f, 0.372554183f},
-std::array<float,2>{0.120414689f, 0.744339168f},
-std::array<float,2>{0.935472548f, 0.0697522238f},
-std::array<float,2>{0.653077245f, 0.557499588f},
-std::array<float,2>{0.380214006f, 0.154014498f},
-std::array<float,2>{0.00189155585f, 0.952835262f},
-std::array<float,2>{0.969607472f, 0.39453584f},
-std::array<float,2>{0.850243032f, 0.856317759f},
-std::array<float,2>{0.187951878f, 0.272906661f},
-std::array<float,2>{0.344483793f, 0.654381096f},
-std::array<float,2>{0.532157719f, 0.0119541101f},
-std::array<float,2>{0.896202564f, 0.690550685f},
-std::array<float,2>{0.0716546923f, 0.0964462012f},
-std::array<float,2>{0.447841465f, 0.754954934f},
-std::array<float,2>{0.693932056f, 0.31795314f},
-std::array<float,2>{0.605629206f, 0.888902903f},
-std::array<float,2>{0.307574153f, 0.453783125f},
-std::array<float,2>{0.12898162f, 0.567620754f},
-std::array<float,2>{0.804357767f, 0.225115001f},
-std::array<float,2>{0.711035788f, 0.73233366f},
-std::array<float,2>{0.462534577f, 0.0835418329f},
-std::array<float,2>{0.083799392f, 0.805734515f},
-std::array<float,2>{0.878069699f, 0.348779172f},
-std::array<float,2>{0.795103967f, 0.920301676f},
-std::array<float,2>{0.149805188f, 0.48543644f},
-std::array<float,2>{0.29575786f, 0.620131195f},
-std::array<float,2>{0.612392664f, 0.2173163f},
-std::array<float,2>{0.998164892f, 0.512069941f},
-std::array<float,2>{0.0232867599f, 0.181662038f},
-std::array<float,2>{0.405429602f, 0.995778978f},
-std::array<float,2>{0.626294494f, 0.409435511f},
-std::array<float,2>{0.561254621f, 0.83220613f},
-std::array<float,2>{0.368248254f, 0.297750682f},
-std::array<float,2>{0.209521115f, 0.675351024f},
-std::array<float,2>{0.864723504f, 0.0573775657f},
-std::array<float,2>{0.586456835f, 0.593417704f},
-std::array<float,2>{0.257722646f, 0.234709486f},
-std::array<float,2>{0.185169578f, 0.903247237f},
-std::array<float,2>{0.77142787f, 0.444995701f},
-std::array<float,2>{0.909165919f, 0.766595781f},
-std::array<float,2>{0.101390973f, 0.334024757f},
-std::array<float,2>{0.469737113f, 0.710269332f},
-std::array<float,2>{0.743799567f, 0.115117028f},
-std::array<float,2>{0.826416135f, 0.634652495f},
-std::array<float,2>{0.226228923f, 0.0283050016f},
-std::array<float,2>{0.313906491f, 0.863414645f},
-std::array<float,2>{0.526424587f, 0.253042221f},
-std::array<float,2>{0.668619096f, 0.966756582f},
-std::array<float,2>{0.407805473f, 0.384360492f},
-std::array<float,2>{0.0423156433f, 0.532751977f},
-std::array<float,2>{0.962232947f, 0.136155143f},
-std::array<float,2>{0.517127812f, 0.695196807f},
-std::array<float,2>{0.320666641f, 0.0984532014f},
-std::array<float,2>{0.231274605f, 0.751774669f},
-std::array<float,2>{0.817955792f, 0.316024899f},
-std::array<float,2>{0.955180943f, 0.882901073f},
-std::array<float,2>{0.0316066071f, 0.459513485f},
-std::array<float,2>{0.417954475f, 0.562522769f},
-std::array<float,2>{0.660446286f, 0.221613362f},
-std::array<float,2>{0.779895067f, 0.56177479f},
-std::array<float,2>{0.175033092f, 0.152076513f},
-std::array<float,2>{0.261051267f, 0.947088182f},
-std::array<float,2>{0.580882072f, 0.39167431f},
-std::array<float,2>{0.739960313f, 0.853910863f},
-std::array<float,2>{0.479699343f, 0.266537219f},
-std::array<float,2>{0.102855578f, 0.649836302f},
-std::array<float,2>{0.919792056f, 0.0103251282f},
-std::array<float,2>{0.637963593f, 0.60601908f},
-std::array<float,2>{0.396624923f, 0.193949804f},
-std::array<float,2>{0.0241652057f, 0.925715983f},
-std::array<float,2>{0.990030468f, 0.473208874f},
-std::array<float,2>{0.872333705f, 0.788637757f},
-std::array<float,2>{0.211912736f, 0.369877279f},
-std::array<float,2>{0.362632602f, 0.749161541f},
-std::array<float,2>{0.548963249f, 0.06393224f},
-std::array<float,2>{0.887588322f, 0.658294559f},
-std::array<float,2>{0.088153936f, 0.0348680802f},
-std::array<float,2>{0.46061042f, 0.820297539f},
-std::array<float,2>{0.707829714f, 0.282011002f},
-std::array<float,2>{0.623768806f, 0.982045352f},
-std::array<float,2>{0.285778135f, 0.435111433f},
-std::array<float,2>{0.146492794f, 0.527526557f},
-std::array<float,2>{0.782828093f, 0.162973478f},
-std::array<float,2>{0.697082639f, 0.636782944f},
-std::array<float,2>{0.444506317f, 0.0244390797f},
-std::array<float,2>{0.0664307997f, 0.862644434f},
-std::array<float,2>{0.903713107f, 0.254234344f},
-std::array<float,2>{0.811370015f, 0.963225365f},
-std::array<float,2>{0.139681816f, 0.388638139f},
-std::array<float,2>{0.301071018f, 0.539033771f},
-std::array<float,2>{0.601293743f, 0.138282776f},
-std::array<float,2>{0.97932142f, 0.589425683f},
-std::array<float,2>{0.0084241163f, 0.240654141f},
-std::array<float,2>{0.38972804f, 0.900971234f},
-std::array<float,2>{0.641948342f, 0.437911332f},
-std::array<float,2>{0.541396677f, 0.771744907f},
-std::array<float,2>{0.353972226f, 0.331546664f},
-std::array<float,2>{0.201637596f, 0.706108332f},
-std::array<float,2>{0.85674119f, 0.111060984f},
-std::array<float,2>{0.577333927f, 0.508318484f},
-std::array<float,2>{0.280855834f, 0.184798762f},
-std::array<float,2>{0.157796249f, 0.996374547f},
-std::array<float,2>{0.762316525f, 0.412982255f},
-std::array<float,2>{0.929206192f, 0.831389844f},
-std::array<float,2>{0.116765969f, 0.302171677f},
-std::array<float,2>{0.489389211f, 0.678046584f},
-std::array<float,2>{0.726895094f, 0.0624499209f},
-std::array<float,2>{0.841747284f, 0.728371501f},
-std::array<float,2>{0.247479349f, 0.0806800425f},
-std::array<float,2>{0.340919822f, 0.809412658f},
-std::array<float,2>{0.502999365f, 0.344943821f},
-std::array<float,2>{0.686252177f, 0.914748728f},
-std::array<float,2>{0.426677704f, 0.49218002f},
-std::array<float,2>{0.054450646f, 0.624333084f},
-std::array<float,2>{0.947861969f, 0.213240787f},
-std::array<float,2>{0.604335189f, 0.684395194f},
-std::array<float,2>{0.310346246f, 0.0540103242f},
-std::array<float,2>{0.12826857f, 0.838137746f},
-std::array<float,2>{0.796910226f, 0.30528003f},
-std::array<float,2>{0.891166806f, 0.987659216f},
-std::array<float,2>{0.0771211758f, 0.41538468f},
-std::array<float,2>{0.45225054f, 0.505592048f},
-std::array<float,2>{0.691303492f, 0.173339069f},
-std::array<float,2>{0.844977081f, 0.616624951f},
-std::array<float,2>{0.194538042f, 0.21007444f},
-std::array<float,2>{0.350192547f, 0.908368409f},
-std::array<float,2>{0.535824955f, 0.497632176f},
-std::array<float,2>{0.650973499f, 0.798165381f},
-std::array<float,2>{0.378356159f, 0.356150925f},
-std::array<float,2>{0.00765283778f, 0.72071892f},
-std::array<float,2>{0.973745286f, 0.0870419443f},
-std::array<float,2>{0.722535312f, 0.542117894f},
-std::array<float,2>{0.493788898f, 0.129588157f},
-std::array<float,2>{0.124404773f, 0.958321035f},
-std::array<float,2>{0.933409691f, 0.377411157f},
-std::array<float,2>{0.756061733f, 0.872972548f},
-std::array<float,2>{0.16613479f, 0.259496272f},
-std::array<float,2>{0.269220412f, 0.630855799f},
-std::array<float,2>{0.566921651f, 0.0193526484f},
-std::array<float,2>{0.94020015f, 0.718336582f},
-std::array<float,2>{0.0562739708f, 0.124250382f},
-std::array<float,2>{0.436374903f, 0.779796422f},
-std::array<float,2>{0.672816336f, 0.34015432f},
-std::array<float,2>{0.509737194f, 0.896943986f},
-std::array<float,2>{0.334548295f, 0.450295746f},
-std::array<float,2>{0.235043004f, 0.585765481f},
-std::array<float,2>{0.835628271f, 0.248863503f},
-std::array<float,2>{0.665415585f, 0.736810148f},
-std::array<float,2>{0.413293689f, 0.0725609884f},
-std::array<float,2>{0.0437062047f, 0.789379537f},
-std::array<float,2>{0.968032062f, 0.36174807f},
-std::array<float,2>{0.821962357f, 0.934915602f},
-std::array<float,2>{0.2216333f, 0.477632314f},
-std::array<float,2>{0.319106698f, 0.599039257f},
-std::array<float,2>{0.528990209f, 0.198426381f},
-std::array<float,2>{0.914032757f, 0.522275805f},
-std::array<float,2>{0.0970515311f, 0.164433047f},
-std::array<float,2>{0.473462313f, 0.969308734f},
-std::array<float,2>{0.749748766f, 0.426605493f},
-std::array<float,2>{0.592159569f, 0.825385273f},
-std::array<float,2>{0.252758801f, 0.290124923f},
-std::array<float,2>{0.182455793f, 0.667393148f},
-std::array<float,2>{0.767758846f, 0.0405024774f},
-std::array<float,2>{0.555507183f, 0.577356458f},
-std::array<float,2>{0.374847919f, 0.22681883f},
-std::array<float,2>{0.205281422f, 0.881742299f},
-std::array<float,2>{0.862273335f, 0.465391576f},
-std::array<float,2>{0.99590832f, 0.764722407f},
-std::array<float,2>{0.0167613123f, 0.322037101f},
-std::array<float,2>{0.400635689f, 0.696618557f},
-std::array<float,2>{0.632469118f, 0.108139463f},
-std::array<float,2>{0.790925622f, 0.642464459f},
-std::array<float,2>{0.155370221f, 0.00570935244f},
-std::array<float,2>{0.289785087f, 0.851071596f},
-std::array<float,2>{0.615291774f, 0.278325289f},
-std::array<float,2>{0.715763271f, 0.939057291f},
-std::array<float,2>{0.468140841f, 0.399648845f},
-std::array<float,2>{0.0819019899f, 0.550647914f},
-std::array<float,2>{0.882090211f, 0.144819453f},
-std::array<float,2>{0.584251404f, 0.725440681f},
-std::array<float,2>{0.264666468f, 0.0933400616f},
-std::array<float,2>{0.179020762f, 0.802279234f},
-std::array<float,2>{0.776641965f, 0.352653891f},
-std::array<float,2>{0.915498018f, 0.912834167f},
-std::array<float,2>{0.107703276f, 0.493477941f},
-std::array<float,2>{0.480795711f, 0.613130689f},
-std::array<float,2>{0.737823606f, 0.204604611f},
-std::array<float,2>{0.815485656f, 0.501538396f},
-std::array<float,2>{0.228173867f, 0.178933904f},
-std::array<float,2>{0.325662702f, 0.991134346f},
-std::array<float,2>{0.522299349f, 0.419144273f},
-std::array<float,2>{0.657627821f, 0.843681574f},
-std::array<float,2>{0.420307189f, 0.311560154f},
-std::array<float,2>{0.0379071757f, 0.683178604f},
-std::array<float,2>{0.957874238f, 0.0479933545f},
-std::array<float,2>{0.70672667f, 0.580077887f},
-std::array<float,2>{0.456798226f, 0.243639618f},
-std::array<float,2>{0.0922584236f, 0.891375721f},
-std::array<float,2>{0.883345842f, 0.445605457f},
-std::array<float,2>{0.788934767f, 0.777206242f},
-std::array<float,2>{0.144026786f, 0.338307589f},
-std::array<float,2>{0.282414585f, 0.712149024f},
-std::array<float,2>{0.619981706f, 0.118674122f},
-std::array<float,2>{0.986117721f, 0.626550555f},
-std::array<float,2>{0.0274641607f, 0.020879725f},
-std::array<float,2>{0.393064439f, 0.867625058f},
-std::array<float,2>{0.63510263f, 0.262295604f},
-std::array<float,2>{0.552731514f, 0.953239143f},
-std::array<float,2>{0.366624802f, 0.379553884f},
-std::array<float,2>{0.216332436f, 0.546424329f},
-std::array<float,2>{0.868137658f, 0.128408775f},
-std::array<float,2>{0.646624267f, 0.669363379f},
-std::array<float,2>{0.382920831f, 0.0454914048f},
-std::array<float,2>{0.0119659696f, 0.820789874f},
-std::array<float,2>{0.983763516f, 0.29555431f},
-std::array<float,2>{0.85294497f, 0.975887954f},
-std::array<float,2>{0.198750868f, 0.424656093f},
-std::array<float,2>{0.35834676f, 0.515629232f},
-std::array<float,2>{0.545370281f, 0.168877527f},
-std::array<float,2>{0.900066376f, 0.59750545f},
-std::array<float,2>{0.0631581321f, 0.20310685f},
-std::array<float,2>{0.440630257f, 0.932872772f},
-std::array<float,2>{0.701175988f, 0.482097059f},
-std::array<float,2>{0.596622288f, 0.795244157f},
-std::array<float,2>{0.296878427f, 0.365987718f},
-std::array<float,2>{0.133372545f, 0.739950061f},
-std::array<float,2>{0.804695547f, 0.0746538863f},
-std::array<float,2>{0.506506801f, 0.552047968f},
-std::array<float,2>{0.339332938f, 0.141372129f},
-std::array<float,2>{0.246018276f, 0.943425238f},
-std::array<float,2>{0.837770879f, 0.40536961f},
-std::array<float,2>{0.950412154f, 0.847133994f},
-std::array<float,2>{0.0497759767f, 0.276185453f},
-std::array<float,2>{0.423626274f, 0.645797729f},
-std::array<float,2>{0.679748774f, 0.00106819975f},
-std::array<float,2>{0.759744346f, 0.699631333f},
-std::array<float,2>{0.160912946f, 0.101651683f},
-std::array<float,2>{0.276114702f, 0.759727299f},
-std::array<float,2>{0.571441293f, 0.326142609f},
-std::array<float,2>{0.731811881f, 0.87840277f},
-std::array<float,2>{0.486734748f, 0.461608469f},
-std::array<float,2>{0.112602457f, 0.573734105f},
-std::array<float,2>{0.925389469f, 0.23054637f},
-std::array<float,2>{0.534628332f, 0.652735412f},
-std::array<float,2>{0.346731901f, 0.0145886652f},
-std::array<float,2>{0.190622956f, 0.858516812f},
-std::array<float,2>{0.847845376f, 0.27065599f},
-std::array<float,2>{0.972331285f, 0.950461864f},
-std::array<float,2>{0.00197502202f, 0.396668702f},
-std::array<float,2>{0.381700724f, 0.554949462f},
-std::array<float,2>{0.654999495f, 0.155166581f},
-std::array<float,2>{0.802631676f, 0.568647265f},
-std::array<float,2>{0.131462842f, 0.224523872f},
-std::array<float,2>{0.305873156f, 0.887849331f},
-std::array<float,2>{0.609277248f, 0.455502212f},
-std::array<float,2>{0.693191826f, 0.756881416f},
-std::array<float,2>{0.446200967f, 0.319901943f},
-std::array<float,2>{0.0732525289f, 0.688165426f},
-std::array<float,2>{0.896693826f, 0.0945384279f},
-std::array<float,2>{0.67581743f, 0.525324225f},
-std::array<float,2>{0.43346858f, 0.156876683f},
-std::array<float,2>{0.0622721538f, 0.978077829f},
-std::array<float,2>{0.944398701f, 0.429692984f},
-std::array<float,2>{0.830104291f, 0.813420951f},
-std::array<float,2>{0.241882741f, 0.287508726f},
-std::array<float,2>{0.332024872f, 0.66276896f},
-std::array<float,2>{0.513025045f, 0.0370113514f},
-std::array<float,2>{0.936650515f, 0.744131982f},
-std::array<float,2>{0.118591927f, 0.0664991215f},
-std::array<float,2>{0.497830063f, 0.783014178f},
-std::array<float,2>{0.725070834f, 0.374435604f},
-std::array<float,2>{0.562911808f, 0.928009808f},
-std::array<float,2>{0.269759327f, 0.469634652f},
-std::array<float,2>{0.171218023f, 0.60530138f},
-std::array<float,2>{0.752473295f, 0.191242203f},
-std::array<float,2>{0.745200098f, 0.708583772f},
-std::array<float,2>{0.470980287f, 0.116238713f},
-std::array<float,2>{0.099000901f, 0.767671943f},
-std::array<float,2>{0.907855809f, 0.333459437f},
-std::array<float,2>{0.773209214f, 0.904599726f},
-std::array<float,2>{0.185646862f, 0.443284303f},
-std::array<float,2>{0.255180329f, 0.59090054f},
-std::array<float,2>{0.588493943f, 0.236686483f},
-std::array<float,2>{0.962949753f, 0.534126937f},
-std::array<float,2>{0.0399216898f, 0.133620158f},
-std::array<float,2>{0.408754647f, 0.968098164f},
-std::array<float,2>{0.671104014f, 0.386095315f},
-std::array<float,2>{0.524939775f, 0.865635991f},
-std::array<float,2>{0.314973384f, 0.250916541f},
-std::array<float,2>{0.223252699f, 0.635319948f},
-std::array<float,2>{0.824519038f, 0.0302562919f},
-std::array<float,2>{0.611302614f, 0.617361963f},
-std::array<float,2>{0.293646544f, 0.215972424f},
-std::array<float,2>{0.151082531f, 0.91983521f},
-std::array<float,2>{0.793886483f, 0.486533314f},
-std::array<float,2>{0.875575185f, 0.807907164f},
-std::array<float,2>{0.0855925381f, 0.349767655f},
-std::array<float,2>{0.464517593f, 0.733405888f},
-std::array<float,2>{0.713043988f, 0.0858573243f},
-std::array<float,2>{0.866232395f, 0.673534334f},
-std::array<float,2>{0.207985386f, 0.0556703247f},
-std::array<float,2>{0.370402575f, 0.834742785f},
-std::array<float,2>{0.559280276f, 0.299094677f},
-std::array<float,2>{0.628432035f, 0.992722869f},
-std::array<float,2>{0.404105484f, 0.407725185f},
-std::array<float,2>{0.02031135f, 0.51479429f},
-std::array<float,2>{0.996393383f, 0.179998934f},
-std::array<float,2>{0.528724611f, 0.73452282f},
-std::array<float,2>{0.31875211f, 0.0710229799f},
-std::array<float,2>{0.221017867f, 0.792391121f},
-std::array<float,2>{0.821732879f, 0.359749019f},
-std::array<float,2>{0.968441188f, 0.936394334f},
-std::array<float,2>{0.0432794206f, 0.478701353f},
-std::array<float,2>{0.413658649f, 0.600131691f},
-std::array<float,2>{0.665655077f, 0.196431652f},
-std::array<float,2>{0.768508971f, 0.520772874f},
-std::array<float,2>{0.181933641f, 0.167621776f},
-std::array<float,2>{0.252195328f, 0.970780969f},
-std::array<float,2>{0.592311323f, 0.429266334f},
-std::array<float,2>{0.749075592f, 0.826827526f},
-std::array<float,2>{0.472886503f, 0.292860746f},
-std::array<float,2>{0.0976316631f, 0.664542079f},
-std::array<float,2>{0.91320473f, 0.0420215204f},
-std::array<float,2>{0.632044554f, 0.57538271f},
-std::array<float,2>{0.401289403f, 0.229569599f},
-std::array<float,2>{0.0172288995f, 0.880289257f},
-std::array<float,2>{0.99538064f, 0.468541116f},
-std::array<float,2>{0.86175704f, 0.763374269f},
-std::array<float,2>{0.205923349f, 0.323063523f},
-std::array<float,2>{0.374205351f, 0.698330283f},
-std::array<float,2>{0.555075884f, 0.10710407f},
-std::array<float,2>{0.882702827f, 0.643349528f},
-std::array<float,2>{0.0811498389f, 0.00608498976f},
-std::array<float,2>{0.468402714f, 0.849347293f},
-std::array<float,2>{0.71489048f, 0.280364215f},
-std::array<float,2>{0.615869284f, 0.940140784f},
-std::array<float,2>{0.289198905f, 0.401220858f},
-std::array<float,2>{0.156136557f, 0.548736572f},
-std::array<float,2>{0.790275455f, 0.147337809f},
-std::array<float,2>{0.690489471f, 0.687437057f},
-std::array<float,2>{0.452837288f, 0.0521251597f},
-std::array<float,2>{0.0765443668f, 0.837424278f},
-std::array<float,2>{0.890946865f, 0.307268798f},
-std::array<float,2>{0.797599316f, 0.985015512f},
-std::array<float,2>{0.128598452f, 0.417534828f},
-std::array<float,2>{0.309624255f, 0.506539941f},
-std::array<float,2>{0.603764057f, 0.175626695f},
-std::array<float,2>{0.974454522f, 0.613630891f},
-std::array<float,2>{0.00720802229f, 0.208469346f},
-std::array<float,2>{0.378691673f, 0.906964302f},
-std::array<float,2>{0.650817037f, 0.499562889f},
-std::array<float,2>{0.535403669f, 0.798837185f},
-std::array<float,2>{0.34972167f, 0.359263986f},
-std::array<float,2>{0.194968015f, 0.720318377f},
-std::array<float,2>{0.845591068f, 0.0890848935f},
-std::array<float,2>{0.566812694f, 0.539308488f},
-std::array<float,2>{0.268872112f, 0.132180125f},
-std::array<float,2>{0.166910067f, 0.960193992f},
-std::array<float,2>{0.756423831f, 0.376527578f},
-std::array<float,2>{0.933022499f, 0.874155402f},
-std::array<float,2>{0.124572605f, 0.261551738f},
-std::array<float,2>{0.4933604f, 0.63169539f},
-std::array<float,2>{0.721754611f, 0.0166472625f},
-std::array<float,2>{0.835159361f, 0.715269566f},
-std::array<float,2>{0.234678417f, 0.121356539f},
-std::array<float,2>{0.334041864f, 0.778289855f},
-std::array<float,2>{0.509261549f, 0.342210352f},
-std::array<float,2>{0.671877444f, 0.895991504f},
-std::array<float,2>{0.436017305f, 0.451490343f},
-std::array<float,2>{0.0558582507f, 0.582899988f},
-std::array<float,2>{0.939837098f, 0.246632978f},
-std::array<float,2>{0.600774646f, 0.640163481f},
-std::array<float,2>{0.301342398f, 0.0270977747f},
-std::array<float,2>{0.140496835f, 0.859751463f},
-std::array<float,2>{0.810777426f, 0.25734359f},
-std::array<float,2>{0.904121399f, 0.961977065f},
-std::array<float,2>{0.067197144f, 0.390553087f},
-std::array<float,2>{0.445164591f, 0.536776066f},
-std::array<float,2>{0.696559846f, 0.139103606f},
-std::array<float,2>{0.857160509f, 0.586185336f},
-std::array<float,2>{0.20213148f, 0.239770919f},
-std::array<float,2>{0.354381472f, 0.900323689f},
-std::array<float,2>{0.541568935f, 0.440539837f},
-std::array<float,2>{0.642312586f, 0.770215392f},
-std::array<float,2>{0.390232265f, 0.32959637f},
-std::array<float,2>{0.00813939143f, 0.704865277f},
-std::array<float,2>{0.978683591f, 0.112982519f},
-std::array<float,2>{0.727497935f, 0.51030308f},
-std::array<float,2>{0.489908159f, 0.185710564f},
-std::array<float,2>{0.116323963f, 0.998097181f},
-std::array<float,2>{0.928762972f, 0.411569476f},
-std::array<float,2>{0.761955142f, 0.828551114f},
-std::array<float,2>{0.157696322f, 0.303094953f},
-std::array<float,2>{0.280691266f, 0.677074611f},
-std::array<float,2>{0.577856541f, 0.0595297031f},
-std::array<float,2>{0.947387695f, 0.728865623f},
-std::array<float,2>{0.0541336425f, 0.0786197186f},
-std::array<float,2>{0.426010877f, 0.81177038f},
-std::array<float,2>{0.685637891f, 0.347029835f},
-std::array<float,2>{0.503810585f, 0.916345f},
-std::array<float,2>{0.341504157f, 0.489681691f},
-std::array<float,2>{0.247854799f, 0.622740269f},
-std::array<float,2>{0.841305971f, 0.212429315f},
-std::array<float,2>{0.660688043f, 0.691430092f},
-std::array<float,2>{0.417149037f, 0.0999354348f},
-std::array<float,2>{0.0321880691f, 0.753801584f},
-std::array<float,2>{0.955972552f, 0.313873887f},
-std::array<float,2>{0.817525744f, 0.885967255f},
-std::array<float,2>{0.230683908f, 0.458185971f},
-std::array<float,2>{0.320870638f, 0.56513989f},
-std::array<float,2>{0.516947329f, 0.2187756f},
-std::array<float,2>{0.919083416f, 0.558740318f},
-std::array<float,2>{0.103407182f, 0.149802148f},
-std::array<float,2>{0.480032206f, 0.94876951f},
-std::array<float,2>{0.739330351f, 0.394382864f},
-std::array<float,2>{0.58021903f, 0.852037907f},
-std::array<float,2>{0.261531293f, 0.268286139f},
-std::array<float,2>{0.175306529f, 0.651841044f},
-std::array<float,2>{0.77938658f, 0.00924249087f},
-std::array<float,2>{0.549522817f, 0.608985543f},
-std::array<float,2>{0.363023043f, 0.192390442f},
-std::array<float,2>{0.211062148f, 0.923631907f},
-std::array<float,2>{0.872737825f, 0.475082189f},
-std::array<float,2>{0.98974514f, 0.786830544f},
-std::array<float,2>{0.023575617f, 0.369043589f},
-std::array<float,2>{0.397175491f, 0.747110188f},
-std::array<float,2>{0.63825357f, 0.0651424527f},
-std::array<float,2>{0.782618642f, 0.656603456f},
-std::array<float,2>{0.147123188f, 0.032740999f},
-std::array<float,2>{0.285214841f, 0.816541493f},
-std::array<float,2>{0.62345314f, 0.284723401f},
-std::array<float,2>{0.707370043f, 0.98245585f},
-std::array<float,2>{0.460374415f, 0.435547948f},
-std::array<float,2>{0.0885804221f, 0.529979527f},
-std::array<float,2>{0.88682586f, 0.160434663f},
-std::array<float,2>{0.588326573f, 0.710586369f},
-std::array<float,2>{0.255713373f, 0.114461392f},
-std::array<float,2>{0.18632327f, 0.765677392f},
-std::array<float,2>{0.772762299f, 0.334675997f},
-std::array<float,2>{0.907481194f, 0.902565122f},
-std::array<float,2>{0.0994049609f, 0.444582492f},
-std::array<float,2>{0.471547395f, 0.592908204f},
-std::array<float,2>{0.74574405f, 0.235172048f},
-std::array<float,2>{0.824719846f, 0.532477558f},
-std::array<float,2>{0.222725213f, 0.136301264f},
-std::array<float,2>{0.314623326f, 0.966115952f},
-std::array<float,2>{0.524713397f, 0.383789599f},
-std::array<float,2>{0.671647072f, 0.863779783f},
-std::array<float,2>{0.408271939f, 0.253585875f},
-std::array<float,2>{0.0395061933f, 0.634093702f},
-std::array<float,2>{0.963702321f, 0.0276716426f},
-std::array<float,2>{0.713383138f, 0.62099725f},
-std::array<float,2>{0.4639211f, 0.217208862f},
-std::array<float,2>{0.085002169f, 0.920686603f},
-std::array<float,2>{0.87546736f, 0.486116767f},
-std::array<float,2>{0.793407142f, 0.806401849f},
-std::array<float,2>{0.15062359f, 0.349519402f},
-std::array<float,2>{0.293398261f, 0.731460512f},
-std::array<float,2>{0.610690951f, 0.0830859765f},
-std::array<float,2>{0.996688187f, 0.675242126f},
-std::array<float,2>{0.0199944749f, 0.0568435565f},
-std::array<float,2>{0.403653085f, 0.832705617f},
-std::array<float,2>{0.628165126f, 0.296978295f},
-std::array<float,2>{0.558949172f, 0.995193899f},
-std::array<float,2>{0.370870352f, 0.409996897f},
-std::array<float,2>{0.207486689f, 0.512470663f},
-std::array<float,2>{0.866810143f, 0.182529315f},
-std::array<float,2>{0.654542387f, 0.655139863f},
-std::array<float,2>{0.381236643f, 0.0122409519f},
-std::array<float,2>{0.00288774213f, 0.855528235f},
-std::array<float,2>{0.971686065f, 0.27327767f},
-std::array<float,2>{0.848186672f, 0.952175498f},
-std::array<float,2>{0.191367477f, 0.395022482f},
-std::array<float,2>{0.347424775f, 0.556847334f},
-std::array<float,2>{0.534686089f, 0.153700858f},
-std::array<float,2>{0.897376478f, 0.568140686f},
-std::array<float,2>{0.0737739503f, 0.224800438f},
-std::array<float,2>{0.445615619f, 0.889408231f},
-std::array<float,2>{0.692869782f, 0.453524947f},
-std::array<float,2>{0.608460188f, 0.755740047f},
-std::array<float,2>{0.306640357f, 0.317731023f},
-std::array<float,2>{0.131347373f, 0.691201389f},
-std::array<float,2>{0.802035213f, 0.0961140096f},
-std::array<float,2>{0.513243437f, 0.526948273f},
-std::array<float,2>{0.331380308f, 0.158499077f},
-std::array<float,2>{0.241657525f, 0.978561103f},
-std::array<float,2>{0.830952525f, 0.431956261f},
-std::array<float,2>{0.945108235f, 0.815341532f},
-std::array<float,2>{0.0616740994f, 0.285545856f},
-std::array<float,2>{0.432657421f, 0.660741985f},
-std::array<float,2>{0.676393569f, 0.0374510251f},
-std::array<float,2>{0.752299249f, 0.74465102f},
-std::array<float,2>{0.171758562f, 0.0701070949f},
-std::array<float,2>{0.27020368f, 0.783255041f},
-std::array<float,2>{0.563406289f, 0.373029202f},
-std::array<float,2>{0.725266218f, 0.926073849f},
-std::array<float,2>{0.497557133f, 0.471999317f},
-std::array<float,2>{0.118979052f, 0.602941871f},
-std::array<float,2>{0.937191188f, 0.188165963f},
-std::array<float,2>{0.545467436f, 0.670703292f},
-std::array<float,2>{0.357517064f, 0.0435509346f},
-std::array<float,2>{0.198563933f, 0.822599709f},
-std::array<float,2>{0.853286982f, 0.294536918f},
-std::array<float,2>{0.984224677f, 0.973005891f},
-std::array<float,2>{0.0125307553f, 0.423381209f},
-std::array<float,2>{0.383323312f, 0.518448174f},
-std::array<float,2>{0.647227705f, 0.171487033f},
-std::array<float,2>{0.805416763f, 0.594177544f},
-std::array<float,2>{0.132858723f, 0.201088026f},
-std::array<float,2>{0.297742009f, 0.929716527f},
-std::array<float,2>{0.596045077f, 0.482460737f},
-std::array<float,2>{0.701909423f, 0.794207633f},
-std::array<float,2>{0.441198379f, 0.36465165f},
-std::array<float,2>{0.0626428574f, 0.742006779f},
-std::array<float,2>{0.899784684f, 0.0771184117f},
-std::array<float,2>{0.680526435f, 0.553168476f},
-std::array<float,2>{0.422946513f, 0.14350684f},
-std::array<float,2>{0.0493065715f, 0.941851139f},
-std::array<float,2>{0.950694144f, 0.40380761f},
-std::array<float,2>{0.837266624f, 0.843768895f},
-std::array<float,2>{0.245324627f, 0.274829358f},
-std::array<float,2>{0.339584619f, 0.646697342f},
-std::array<float,2>{0.50589329f, 0.00313048111f},
-std::array<float,2>{0.925009251f, 0.70135951f},
-std::array<float,2>{0.113171257f, 0.104839861f},
-std::array<float,2>{0.486959815f, 0.761112511f},
-std::array<float,2>{0.732255399f, 0.327077657f},
-std::array<float,2>{0.572223604f, 0.876150608f},
-std::array<float,2>{0.275708079f, 0.464478493f},
-std::array<float,2>{0.160570547f, 0.572129309f},
-std::array<float,2>{0.759217441f, 0.233405441f},
-std::array<float,2>{0.737368703f, 0.723741114f},
-std::array<float,2>{0.481177032f, 0.0902238339f},
-std::array<float,2>{0.108387865f, 0.804197431f},
-std::array<float,2>{0.91599977f, 0.354338974f},
-std::array<float,2>{0.777071893f, 0.910701632f},
-std::array<float,2>{0.179415375f, 0.494316131f},
-std::array<float,2>{0.265272617f, 0.610427141f},
-std::array<float,2>{0.584705353f, 0.205774024f},
-std::array<float,2>{0.957444072f, 0.503446162f},
-std::array<float,2>{0.0373988859f, 0.176297784f},
-std::array<float,2>{0.420661807f, 0.989538252f},
-std::array<float,2>{0.65804857f, 0.420763105f},
-std::array<float,2>{0.521557212f, 0.840761542f},
-std::array<float,2>{0.325857103f, 0.308780372f},
-std::array<float,2>{0.228022024f, 0.679696143f},
-std::array<float,2>{0.815941632f, 0.0504556522f},
-std::array<float,2>{0.619409084f, 0.580316007f},
-std::array<float,2>{0.283035129f, 0.245998025f},
-std::array<float,2>{0.144417942f, 0.893673122f},
-std::array<float,2>{0.788454831f, 0.44811818f},
-std::array<float,2>{0.883212268f, 0.774219215f},
-std::array<float,2>{0.0927362591f, 0.336920828f},
-std::array<float,2>{0.456435293f, 0.714097261f},
-std::array<float,2>{0.7064569f, 0.120293811f},
-std::array<float,2>{0.867267072f, 0.627785683f},
-std::array<float,2>{0.216266289f, 0.0222083237f},
-std::array<float,2>{0.367042512f, 0.870027125f},
-std::array<float,2>{0.551992953f, 0.26477474f},
-std::array<float,2>{0.635672688f, 0.955697238f},
-std::array<float,2>{0.39355129f, 0.381576419f},
-std::array<float,2>{0.0279535986f, 0.544851363f},
-std::array<float,2>{0.98535341f, 0.126000121f},
-std::array<float,2>{0.558581948f, 0.696866989f},
-std::array<float,2>{0.371150017f, 0.107592806f},
-std::array<float,2>{0.204299122f, 0.765509248f},
-std::array<float,2>{0.859640837f, 0.321395189f},
-std::array<float,2>{0.992260575f, 0.880948246f},
-std::array<float,2>{0.0189005695f, 0.46493569f},
-std::array<float,2>{0.399923235f, 0.57783705f},
-std::array<float,2>{0.630316019f, 0.227334186f},
-std::array<float,2>{0.791551352f, 0.550054908f},
-std::array<float,2>{0.153162807f, 0.145373538f},
-std::array<float,2>{0.291166127f, 0.93886131f},
-std::array<float,2>{0.615113676f, 0.400243193f},
-std::array<float,2>{0.717542171f, 0.851143539f},
-std::array<float,2>{0.464915186f, 0.279271752f},
-std::array<float,2>{0.0787702277f, 0.641657352f},
-std::array<float,2>{0.879515827f, 0.00514082657f},
-std::array<float,2>{0.66784519f, 0.59939301f},
-std::array<float,2>{0.41183725f, 0.198862582f},
-std::array<float,2>{0.0466072112f, 0.935392857f},
-std::array<float,2>{0.965494752f, 0.478138566f},
-std::array<float,2>{0.823726296f, 0.789789677f},
-std::array<float,2>{0.220648468f, 0.362195641f},
-std::array<float,2>{0.317203999f, 0.737131953f},
-std::array<float,2>{0.530633271f, 0.0731754005f},
-std::array<float,2>{0.910660803f, 0.667726576f},
-std::array<float,2>{0.0938128829f, 0.0405733846f},
-std::array<float,2>{0.47621724f, 0.82593137f},
-std::array<float,2>{0.746648192f, 0.290734857f},
-std::array<float,2>{0.590635777f, 0.968927145f},
-std::array<float,2>{0.25076288f, 0.426233321f},
-std::array<float,2>{0.179838359f, 0.52196002f},
-std::array<float,2>{0.766946793f, 0.164926231f},
-std::array<float,2>{0.719811082f, 0.630294919f},
-std::array<float,2>{0.495696396f, 0.0189625137f},
-std::array<float,2>{0.121402264f, 0.872203887f},
-std::array<float,2>{0.931319535f, 0.25921616f},
-std::array<float,2>{0.755565226f, 0.958862901f},
-std::array<float,2>{0.166012004f, 0.37773037f},
-std::array<float,2>{0.2674945f, 0.542656183f},
-std::array<float,2>{0.568977535f, 0.129364759f},
-std::array<float,2>{0.938542962f, 0.585214317f},
-std::array<float,2>{0.0577342957f, 0.2481637f},
-std::array<float,2>{0.43475467f, 0.897392988f},
-std::array<float,2>{0.674055159f, 0.450975955f},
-std::array<float,2>{0.511650562f, 0.779628396f},
-std::array<float,2>{0.333487868f, 0.34059754f},
-std::array<float,2>{0.237041324f, 0.717868388f},
-std::array<float,2>{0.832703888f, 0.124546811f},
-std::array<float,2>{0.601804197f, 0.505335867f},
-std::array<float,2>{0.311870605f, 0.173762366f},
-std::array<float,2>{0.125612706f, 0.987809241f},
-std::array<float,2>{0.799524784f, 0.415548891f},
-std::array<float,2>{0.894519389f, 0.83851397f},
-std::array<float,2>{0.0755136237f, 0.304880261f},
-std::array<float,2>{0.450565547f, 0.683806419f},
-std::array<float,2>{0.688137949f, 0.0545237772f},
-std::array<float,2>{0.846115351f, 0.721401989f},
-std::array<float,2>{0.191582754f, 0.0877403691f},
-std::array<float,2>{0.349078089f, 0.798382998f},
-std::array<float,2>{0.537697136f, 0.355834514f},
-std::array<float,2>{0.64919734f, 0.90893954f},
-std::array<float,2>{0.376260132f, 0.497519076f},
-std::array<float,2>{0.00577763421f, 0.616988242f},
-std::array<float,2>{0.974748671f, 0.210769117f},
-std::array<float,2>{0.574618876f, 0.678360283f},
-std::array<float,2>{0.279053748f, 0.0618212633f},
-std::array<float,2>{0.159275964f, 0.83179599f},
-std::array<float,2>{0.765457332f, 0.302621603f},
-std::array<float,2>{0.927686989f, 0.996584713f},
-std::array<float,2>{0.115054131f, 0.412180364f},
-std::array<float,2>{0.490755022f, 0.507818997f},
-std::array<float,2>{0.729677618f, 0.185212985f},
-std::array<float,2>{0.841803074f, 0.624719679f},
-std::array<float,2>{0.248274103f, 0.213604763f},
-std::array<float,2>{0.342621833f, 0.914314628f},
-std::array<float,2>{0.501092911f, 0.491631091f},
-std::array<float,2>{0.684157014f, 0.808886707f},
-std::array<float,2>{0.42880854f, 0.345382631f},
-std::array<float,2>{0.0513926484f, 0.727603436f},
-std::array<float,2>{0.947023988f, 0.0802804828f},
-std::array<float,2>{0.698791027f, 0.538091302f},
-std::array<float,2>{0.441660404f, 0.138041615f},
-std::array<float,2>{0.0690964609f, 0.963822842f},
-std::array<float,2>{0.906240761f, 0.38804698f},
-std::array<float,2>{0.809657574f, 0.863047123f},
-std::array<float,2>{0.136967063f, 0.254451394f},
-std::array<float,2>{0.303456813f, 0.637241483f},
-std::array<float,2>{0.598309219f, 0.0250265785f},
-std::array<float,2>{0.977124095f, 0.706964791f},
-std::array<float,2>{0.0105262231f, 0.110654972f},
-std::array<float,2>{0.388557583f, 0.77238065f},
-std::array<float,2>{0.644428551f, 0.331221193f},
-std::array<float,2>{0.540228546f, 0.900776327f},
-std::array<float,2>{0.353475958f, 0.438303798f},
-std::array<float,2>{0.200038344f, 0.589228928f},
-std::array<float,2>{0.857934177f, 0.240886658f},
-std::array<float,2>{0.640472531f, 0.749774694f},
-std::array<float,2>{0.395833313f, 0.0644362792f},
-std::array<float,2>{0.0266570766f, 0.78822422f},
-std::array<float,2>{0.992044687f, 0.369146883f},
-std::array<float,2>{0.873630404f, 0.925237477f},
-std::array<float,2>{0.214237452f, 0.472908586f},
-std::array<float,2>{0.359876245f, 0.605906188f},
-std::array<float,2>{0.548386574f, 0.193634555f},
-std::array<float,2>{0.889083743f, 0.528153956f},
-std::array<float,2>{0.086351119f, 0.16222544f},
-std::array<float,2>{0.45816955f, 0.981781125f},
-std::array<float,2>{0.710169256f, 0.43475619f},
-std::array<float,2>{0.622483194f, 0.819497347f},
-std::array<float,2>{0.287196934f, 0.281281233f},
-std::array<float,2>{0.145389333f, 0.658821166f},
-std::array<float,2>{0.783821762f, 0.0344766639f},
-std::array<float,2>{0.517956316f, 0.563206255f},
-std::array<float,2>{0.324160099f, 0.221012652f},
-std::array<float,2>{0.23376596f, 0.883731961f},
-std::array<float,2>{0.819557309f, 0.459312141f},
-std::array<float,2>{0.954151928f, 0.751424491f},
-std::array<float,2>{0.0337836146f, 0.315458596f},
-std::array<float,2>{0.41407606f, 0.694484711f},
-std::array<float,2>{0.6636675f, 0.0979442894f},
-std::array<float,2>{0.7785151f, 0.650051296f},
-std::array<float,2>{0.173156902f, 0.0102036502f},
-std::array<float,2>{0.259001106f, 0.854247212f},
-std::array<float,2>{0.57964474f, 0.265708238f},
-std::array<float,2>{0.74027878f, 0.946691751f},
-std::array<float,2>{0.477634698f, 0.392197967f},
-std::array<float,2>{0.105412595f, 0.562093675f},
-std::array<float,2>{0.920920491f, 0.151504159f},
-std::array<float,2>{0.613192618f, 0.734331965f},
-std::array<float,2>{0.295260459f, 0.0853885487f},
-std::array<float,2>{0.149933621f, 0.808346987f},
-std::array<float,2>{0.795454025f, 0.350383848f},
-std::array<float,2>{0.878886878f, 0.919380903f},
-std::array<float,2>{0.0831876919f, 0.486905426f},
-std::array<float,2>{0.461982071f, 0.618001819f},
-std::array<float,2>{0.711695313f, 0.216478601f},
-std::array<float,2>{0.865085304f, 0.515192091f},
-std::array<float,2>{0.209020749f, 0.180519596f},
-std::array<float,2>{0.368829012f, 0.992479682f},
-std::array<float,2>{0.560700059f, 0.407590032f},
-std::array<float,2>{0.626921177f, 0.834076464f},
-std::array<float,2>{0.405807137f, 0.29938525f},
-std::array<float,2>{0.0225196239f, 0.673034251f},
-std::array<float,2>{0.998920143f, 0.0562286712f},
-std::array<float,2>{0.743330657f, 0.591441035f},
-std::array<float,2>{0.470532149f, 0.237016231f},
-std::array<float,2>{0.100665294f, 0.904857337f},
-std::array<float,2>{0.908669114f, 0.442476571f},
-std::array<float,2>{0.770741045f, 0.768374443f},
-std::array<float,2>{0.185016498f, 0.333778858f},
-std::array<float,2>{0.257010669f, 0.708238304f},
-std::array<float,2>{0.586050868f, 0.116750449f},
-std::array<float,2>{0.962573111f, 0.634966254f},
-std::array<float,2>{0.0425991789f, 0.0293993391f},
-std::array<float,2>{0.407364517f, 0.866069615f},
-std::array<float,2>{0.668288529f, 0.250092596f},
-std::array<float,2>{0.527086496f, 0.968730032f},
-std::array<float,2>{0.314368576f, 0.386484593f},
-std::array<float,2>{0.225826561f, 0.533432722f},
-std::array<float,2>{0.826810002f, 0.13316679f},
-std::array<float,2>{0.679221511f, 0.662456274f},
-std::array<float,2>{0.43047592f, 0.0364994779f},
-std::array<float,2>{0.0603009574f, 0.812929809f},
-std::array<float,2>{0.941641271f, 0.288011163f},
-std::array<float,2>{0.829744935f, 0.978021502f},
-std::array<float,2>{0.239416927f, 0.430221885f},
-std::array<float,2>{0.329758763f, 0.524881363f},
-std::array<float,2>{0.514133811f, 0.156683326f},
-std::array<float,2>{0.934857786f, 0.60489589f},
-std::array<float,2>{0.120641217f, 0.190595403f},
-std::array<float,2>{0.499812335f, 0.928473949f},
-std::array<float,2>{0.7230106f, 0.469213963f},
-std::array<float,2>{0.565499187f, 0.782472074f},
-std::array<float,2>{0.27165699f, 0.37477684f},
-std::array<float,2>{0.168720633f, 0.743218362f},
-std::array<float,2>{0.751913309f, 0.0669579431f},
-std::array<float,2>{0.531265378f, 0.555516779f},
-std::array<float,2>{0.344223946f, 0.154314876f},
-std::array<float,2>{0.188409075f, 0.950766206f},
-std::array<float,2>{0.849814534f, 0.397003412f},
-std::array<float,2>{0.969044805f, 0.859272361f},
-std::array<float,2>{0.00145333866f, 0.27103287f},
-std::array<float,2>{0.380735964f, 0.653035164f},
-std::array<float,2>{0.652479112f, 0.0138431545f},
-std::array<float,2>{0.803835452f, 0.687952042f},
-std::array<float,2>{0.129664958f, 0.0940057263f},
-std::array<float,2>{0.307077587f, 0.757543087f},
-std::array<float,2>{0.605961084f, 0.319486469f},
-std::array<float,2>{0.693816245f, 0.888651311f},
-std::array<float,2>{0.447336882f, 0.455777138f},
-std::array<float,2>{0.0722289383f, 0.569327354f},
-std::array<float,2>{0.895645082f, 0.224026546f},
-std::array<float,2>{0.505550027f, 0.646066666f},
-std::array<float,2>{0.336976022f, 0.00150995387f},
-std::array<float,2>{0.243178383f, 0.847503364f},
-std::array<float,2>{0.839572251f, 0.275676936f},
-std::array<float,2>{0.951943636f, 0.944257081f},
-std::array<float,2>{0.0481002368f, 0.406160831f},
-std::array<float,2>{0.424641013f, 0.552362025f},
-std::array<float,2>{0.683143437f, 0.141055748f},
-std::array<float,2>{0.76058042f, 0.573395133f},
-std::array<float,2>{0.162419721f, 0.231321886f},
-std::array<float,2>{0.273735255f, 0.878736675f},
-std::array<float,2>{0.572713733f, 0.461341351f},
-std::array<float,2>{0.733241975f, 0.759060919f},
-std::array<float,2>{0.485664308f, 0.325266629f},
-std::array<float,2>{0.109664053f, 0.700178385f},
-std::array<float,2>{0.922948837f, 0.102322228f},
-std::array<float,2>{0.645167708f, 0.516194344f},
-std::array<float,2>{0.384804785f, 0.168134987f},
-std::array<float,2>{0.0152953155f, 0.976461291f},
-std::array<float,2>{0.981764019f, 0.424305946f},
-std::array<float,2>{0.853812277f, 0.821024835f},
-std::array<float,2>{0.196331248f, 0.29499647f},
-std::array<float,2>{0.357183367f, 0.66960752f},
-std::array<float,2>{0.543748617f, 0.0449511819f},
-std::array<float,2>{0.901572943f, 0.739730179f},
-std::array<float,2>{0.0645658821f, 0.0751013756f},
-std::array<float,2>{0.437663794f, 0.795689344f},
-std::array<float,2>{0.701089025f, 0.365339845f},
-std::array<float,2>{0.594327629f, 0.933279812f},
-std::array<float,2>{0.299733222f, 0.481587857f},
-std::array<float,2>{0.136655688f, 0.596853912f},
-std::array<float,2>{0.806717515f, 0.202440813f},
-std::array<float,2>{0.704499066f, 0.712860227f},
-std::array<float,2>{0.454111844f, 0.11846593f},
-std::array<float,2>{0.0902189687f, 0.776426256f},
-std::array<float,2>{0.886104047f, 0.338793427f},
-std::array<float,2>{0.786438227f, 0.890913129f},
-std::array<float,2>{0.141081035f, 0.446199447f},
-std::array<float,2>{0.285135478f, 0.579335392f},
-std::array<float,2>{0.617309988f, 0.243792221f},
-std::array<float,2>{0.988177896f, 0.546152532f},
-std::array<float,2>{0.0304292366f, 0.128633142f},
-std::array<float,2>{0.391576767f, 0.953680336f},
-std::array<float,2>{0.63441515f, 0.379352272f},
-std::array<float,2>{0.554164767f, 0.867870033f},
-std::array<float,2>{0.363710076f, 0.261968762f},
-std::array<float,2>{0.217631176f, 0.62620759f},
-std::array<float,2>{0.869829774f, 0.0211884771f},
-std::array<float,2>{0.583513021f, 0.612560093f},
-std::array<float,2>{0.262996703f, 0.20441696f},
-std::array<float,2>{0.177160591f, 0.912319958f},
-std::array<float,2>{0.774129212f, 0.49372077f},
-std::array<float,2>{0.916272342f, 0.802197397f},
-std::array<float,2>{0.107065968f, 0.353143662f},
-std::array<float,2>{0.48394376f, 0.725073099f},
-std::array<float,2>{0.735087276f, 0.0930027366f},
-std::array<float,2>{0.813242257f, 0.682979226f},
-std::array<float,2>{0.229452938f, 0.048558563f},
-std::array<float,2>{0.326889783f, 0.843075752f},
-std::array<float,2>{0.521313429f, 0.312092453f},
-std::array<float,2>{0.658314288f, 0.990319312f},
-std::array<float,2>{0.419575214f, 0.419654429f},
-std::array<float,2>{0.0356630497f, 0.501066744f},
-std::array<float,2>{0.959098518f, 0.17934306f},
-std::array<float,2>{0.538463533f, 0.719603062f},
-std::array<float,2>{0.348394454f, 0.0883475021f},
-std::array<float,2>{0.19275564f, 0.800582707f},
-std::array<float,2>{0.847377717f, 0.358307183f},
-std::array<float,2>{0.976533294f, 0.908044994f},
-std::array<float,2>{0.0046184673f, 0.498276979f},
-std::array<float,2>{0.375645906f, 0.614376187f},
-std::array<float,2>{0.649757802f, 0.20741117f},
-std::array<float,2>{0.800286829f, 0.507230282f},
-std::array<float,2>{0.126062438f, 0.174534082f},
-std::array<float,2>{0.311460108f, 0.98543793f},
-std::array<float,2>{0.603225827f, 0.416985959f},
-std::array<float,2>{0.688747883f, 0.836137295f},
-std::array<float,2>{0.449252635f, 0.30836001f},
-std::array<float,2>{0.0748838186f, 0.685748637f},
-std::array<float,2>{0.893270254f, 0.051614888f},
-std::array<float,2>{0.675495982f, 0.583119333f},
-std::array<float,2>{0.434374511f, 0.247524709f},
-std::array<float,2>{0.0569725521f, 0.894680142f},
-std::array<float,2>{0.937920392f, 0.452997655f},
-std::array<float,2>{0.833126009f, 0.779097736f},
-std::array<float,2>{0.237484679f, 0.342854083f},
-std::array<float,2>{0.33219558f, 0.716566026f},
-std::array<float,2>{0.510600746f, 0.123012207f},
-std::array<float,2>{0.930550039f, 0.632234335f},
-std::array<float,2>{0.122813076f, 0.016291108f},
-std::array<float,2>{0.494370997f, 0.87363416f},
-std::array<float,2>{0.719648361f, 0.260332763f},
-std::array<float,2>{0.569761157f, 0.959871173f},
-std::array<float,2>{0.266012222f, 0.375047147f},
-std::array<float,2>{0.16410242f, 0.540697932f},
-std::array<float,2>{0.754652739f, 0.131310433f},
-std::array<float,2>{0.747683525f, 0.665637314f},
-std::array<float,2>{0.475340933f, 0.0414089896f},
-std::array<float,2>{0.0954352245f, 0.827301979f},
-std::array<float,2>{0.911658645f, 0.291195691f},
-std::array<float,2>{0.765789866f, 0.971939564f},
-std::array<float,2>{0.181099936f, 0.428500444f},
-std::array<float,2>{0.251525253f, 0.520172477f},
-std::array<float,2>{0.591525555f, 0.166020155f},
-std::array<float,2>{0.966547966f, 0.601360321f},
-std::array<float,2>{0.0455508195f, 0.196160331f},
-std::array<float,2>{0.410509944f, 0.93676132f},
-std::array<float,2>{0.666441977f, 0.480024576f},
-std::array<float,2>{0.529587328f, 0.791712344f},
-std::array<float,2>{0.317794621f, 0.360838771f},
-std::array<float,2>{0.218926564f, 0.735973179f},
-std::array<float,2>{0.822378337f, 0.0716262758f},
-std::array<float,2>{0.614026189f, 0.547505498f},
-std::array<float,2>{0.29220295f, 0.147919461f},
-std::array<float,2>{0.154221207f, 0.941374779f},
-std::array<float,2>{0.792945564f, 0.401704609f},
-std::array<float,2>{0.88032639f, 0.848365366f},
-std::array<float,2>{0.0799607262f, 0.279513478f},
-std::array<float,2>{0.466727257f, 0.644439816f},
-std::array<float,2>{0.718495548f, 0.00753940642f},
-std::array<float,2>{0.860643566f, 0.697827399f},
-std::array<float,2>{0.203846723f, 0.106247097f},
-std::array<float,2>{0.372918099f, 0.762630701f},
-std::array<float,2>{0.55699867f, 0.32376793f},
-std::array<float,2>{0.629717827f, 0.879212737f},
-std::array<float,2>{0.398767889f, 0.467532396f},
-std::array<float,2>{0.0183814429f, 0.575087309f},
-std::array<float,2>{0.993397117f, 0.22946763f},
-std::array<float,2>{0.578395724f, 0.650729477f},
-std::array<float,2>{0.258040696f, 0.00842868071f},
-std::array<float,2>{0.172312677f, 0.852802575f},
-std::array<float,2>{0.778175712f, 0.269472182f},
-std::array<float,2>{0.920194507f, 0.948017657f},
-std::array<float,2>{0.104243301f, 0.392776668f},
-std::array<float,2>{0.477352589f, 0.560072184f},
-std::array<float,2>{0.741607189f, 0.148646459f},
-std::array<float,2>{0.818381488f, 0.565520644f},
-std::array<float,2>{0.233005553f, 0.220360458f},
-std::array<float,2>{0.322608262f, 0.885618865f},
-std::array<float,2>{0.519007206f, 0.457056791f},
-std::array<float,2>{0.662337065f, 0.752677619f},
-std::array<float,2>{0.415156394f, 0.3125121f},
-std::array<float,2>{0.0349101163f, 0.693055034f},
-std::array<float,2>{0.954027236f, 0.10156063f},
-std::array<float,2>{0.709505379f, 0.530849278f},
-std::array<float,2>{0.457075298f, 0.161475241f},
-std::array<float,2>{0.0878125653f, 0.983719945f},
-std::array<float,2>{0.890497744f, 0.437441409f},
-std::array<float,2>{0.785047948f, 0.817561865f},
-std::array<float,2>{0.145656407f, 0.283376038f},
-std::array<float,2>{0.28905642f, 0.657611012f},
-std::array<float,2>{0.621861994f, 0.0317335539f},
-std::array<float,2>{0.990816772f, 0.74658376f},
-std::array<float,2>{0.0257417541f, 0.0660340562f},
-std::array<float,2>{0.395350158f, 0.785419822f},
-std::array<float,2>{0.639025152f, 0.367991388f},
-std::array<float,2>{0.547339618f, 0.922776401f},
-std::array<float,2>{0.360910445f, 0.475916296f},
-std::array<float,2>{0.213217899f, 0.607893765f},
-std::array<float,2>{0.874609411f, 0.191945687f},
-std::array<float,2>{0.642858624f, 0.703860879f},
-std::array<float,2>{0.387131959f, 0.111602291f},
-std::array<float,2>{0.0109608714f, 0.771379173f},
-std::array<float,2>{0.978074968f, 0.32898441f},
-std::array<float,2>{0.859109044f, 0.898473203f},
-std::array<float,2>{0.200870305f, 0.440228701f},
-std::array<float,2>{0.352018952f, 0.587466538f},
-std::array<float,2>{0.53909111f, 0.239166245f},
-std::array<float,2>{0.904397726f, 0.535744488f},
-std::array<float,2>{0.0700606778f, 0.140347138f},
-std::array<float,2>{0.442837894f, 0.961912215f},
-std::array<float,2>{0.697651625f, 0.38887158f},
-std::array<float,2>{0.598976374f, 0.860415459f},
-std::array<float,2>{0.304055482f, 0.256070822f},
-std::array<float,2>{0.137821376f, 0.638701022f},
-std::array<float,2>{0.809084296f, 0.0263400823f},
-std::array<float,2>{0.500447094f, 0.621555269f},
-std::array<float,2>{0.343471795f, 0.211365089f},
-std::array<float,2>{0.249392569f, 0.917195261f},
-std::array<float,2>{0.843239367f, 0.488703072f},
-std::array<float,2>{0.946039915f, 0.811221898f},
-std::array<float,2>{0.0525075644f, 0.346287727f},
-std::array<float,2>{0.427995324f, 0.730342567f},
-std::array<float,2>{0.684702754f, 0.0795287788f},
-std::array<float,2>{0.764550865f, 0.676615179f},
-std::array<float,2>{0.159082517f, 0.0602674633f},
-std::array<float,2>{0.277422309f, 0.829987824f},
-std::array<float,2>{0.575762868f, 0.303961694f},
-std::array<float,2>{0.729465008f, 0.999246716f},
-std::array<float,2>{0.49199447f, 0.410228431f},
-std::array<float,2>{0.113909826f, 0.511056066f},
-std::array<float,2>{0.925905108f, 0.187482387f},
-std::array<float,2>{0.606723368f, 0.690043092f},
-std::array<float,2>{0.307989568f, 0.0974058583f},
-std::array<float,2>{0.130753949f, 0.754429102f},
-std::array<float,2>{0.802891254f, 0.316617966f},
-std::array<float,2>{0.894932449f, 0.890391469f},
-std::array<float,2>{0.0707421228f, 0.454264671f},
-std::array<float,2>{0.44885391f, 0.566617012f},
-std::array<float,2>{0.694794118f, 0.226367787f},
-std::array<float,2>{0.851398408f, 0.558418274f},
-std::array<float,2>{0.188830897f, 0.152764723f},
-std::array<float,2>{0.345045537f, 0.951303422f},
-std::array<float,2>{0.53277117f, 0.3963705f},
-std::array<float,2>{0.653404593f, 0.857397497f},
-std::array<float,2>{0.379490197f, 0.271989614f},
-std::array<float,2>{0.000134686605f, 0.655886829f},
-std::array<float,2>{0.970356941f, 0.0128646363f},
-std::array<float,2>{0.723800063f, 0.601832271f},
-std::array<float,2>{0.498632252f, 0.189154074f},
-std::array<float,2>{0.11965882f, 0.926940143f},
-std::array<float,2>{0.933895707f, 0.471675992f},
-std::array<float,2>{0.750673354f, 0.784475148f},
-std::array<float,2>{0.169213519f, 0.37151432f},
-std::array<float,2>{0.272993058f, 0.745711207f},
-std::array<float,2>{0.565259695f, 0.0689211488f},
-std::array<float,2>{0.942671657f, 0.661790848f},
-std::array<float,2>{0.0589822121f, 0.0382733643f},
-std::array<float,2>{0.431213289f, 0.816294074f},
-std::array<float,2>{0.678341746f, 0.286376119f},
-std::array<float,2>{0.514934838f, 0.98044914f},
-std::array<float,2>{0.328569919f, 0.432994902f},
-std::array<float,2>{0.238898382f, 0.525844097f},
-std::array<float,2>{0.828299284f, 0.159287915f},
-std::array<float,2>{0.669549465f, 0.633155644f},
-std::array<float,2>{0.407189548f, 0.028964866f},
-std::array<float,2>{0.0418494828f, 0.864551485f},
-std::array<float,2>{0.961336613f, 0.252325445f},
-std::array<float,2>{0.827488661f, 0.965442538f},
-std::array<float,2>{0.22480765f, 0.383688807f},
-std::array<float,2>{0.313059539f, 0.531321406f},
-std::array<float,2>{0.525824785f, 0.135675117f},
-std::array<float,2>{0.909915686f, 0.592273057f},
-std::array<float,2>{0.100463152f, 0.236255631f},
-std::array<float,2>{0.468761742f, 0.904081523f},
-std::array<float,2>{0.742221475f, 0.443962038f},
-std::array<float,2>{0.587545216f, 0.767058432f},
-std::array<float,2>{0.25642997f, 0.335641265f},
-std::array<float,2>{0.183919519f, 0.709466696f},
-std::array<float,2>{0.770095348f, 0.113923743f},
-std::array<float,2>{0.562415957f, 0.512730837f},
-std::array<float,2>{0.367403746f, 0.183346316f},
-std::array<float,2>{0.210786641f, 0.994920433f},
-std::array<float,2>{0.863846421f, 0.408223033f},
-std::array<float,2>{0.999821961f, 0.833447099f},
-std::array<float,2>{0.0216562953f, 0.298220694f},
-std::array<float,2>{0.404937714f, 0.674037635f},
-std::array<float,2>{0.625304282f, 0.0583789386f},
-std::array<float,2>{0.796675563f, 0.731369078f},
-std::array<float,2>{0.14911598f, 0.0823117867f},
-std::array<float,2>{0.296761662f, 0.804839373f},
-std::array<float,2>{0.61224395f, 0.347922623f},
-std::array<float,2>{0.71234107f, 0.921336114f},
-std::array<float,2>{0.461795181f, 0.48476547f},
-std::array<float,2>{0.082066223f, 0.619208574f},
-std::array<float,2>{0.87784332f, 0.218483388f},
-std::array<float,2>{0.520151556f, 0.681068957f},
-std::array<float,2>{0.328031719f, 0.0490159877f},
-std::array<float,2>{0.230236962f, 0.841741621f},
-std::array<float,2>{0.814043522f, 0.309795678f},
-std::array<float,2>{0.960323691f, 0.989171624f},
-std::array<float,2>{0.0364291072f, 0.421767175f},
-std::array<float,2>{0.418912113f, 0.5027228f},
-std::array<float,2>{0.659320951f, 0.176907599f},
-std::array<float,2>{0.775056601f, 0.609424829f},
-std::array<float,2>{0.176141262f, 0.207012177f},
-std::array<float,2>{0.262344509f, 0.911904633f},
-std::array<float,2>{0.582202733f, 0.495386004f},
-std::array<float,2>{0.736048579f, 0.803256035f},
-std::array<float,2>{0.483132541f, 0.354997575f},
-std::array<float,2>{0.106380962f, 0.723537385f},
-std::array<float,2>{0.917055011f, 0.0909749269f},
-std::array<float,2>{0.633091271f, 0.543442905f},
-std::array<float,2>{0.39178592f, 0.125552863f},
-std::array<float,2>{0.030020345f, 0.95645076f},
-std::array<float,2>{0.986330032f, 0.382019699f},
-std::array<float,2>{0.870687664f, 0.870841384f},
-std::array<float,2>{0.218396351f, 0.26464358f},
-std::array<float,2>{0.365086138f, 0.628088951f},
-std::array<float,2>{0.553461373f, 0.0229078885f},
-std::array<float,2>{0.885614157f, 0.71338886f},
-std::array<float,2>{0.0911461785f, 0.119802855f},
-std::array<float,2>{0.453444779f, 0.775337338f},
-std::array<float,2>{0.703983486f, 0.336721092f},
-std::array<float,2>{0.618622184f, 0.893362045f},
-std::array<float,2>{0.283704042f, 0.448520154f},
-std::array<float,2>{0.142229587f, 0.58196342f},
-std::array<float,2>{0.785228252f, 0.244274005f},
-std::array<float,2>{0.70016557f, 0.740734816f},
-std::array<float,2>{0.439048797f, 0.0778226033f},
-std::array<float,2>{0.0660151094f, 0.793246448f},
-std::array<float,2>{0.901048601f, 0.363473147f},
-std::array<float,2>{0.808480859f, 0.93118602f},
-std::array<float,2>{0.134909436f, 0.483564675f},
-std::array<float,2>{0.300490022f, 0.5954687f},
-std::array<float,2>{0.595558822f, 0.199292049f},
-std::array<float,2>{0.980778039f, 0.51915133f},
-std::array<float,2>{0.0145464288f, 0.170867294f},
-std::array<float,2>{0.386462867f, 0.974565387f},
-std::array<float,2>{0.646033883f, 0.42280817f},
-std::array<float,2>{0.544916213f, 0.824045956f},
-std::array<float,2>{0.355987787f, 0.293500572f},
-std::array<float,2>{0.19600603f, 0.671530545f},
-std::array<float,2>{0.854807019f, 0.0441673361f},
-std::array<float,2>{0.573824286f, 0.570547581f},
-std::array<float,2>{0.274514735f, 0.233203754f},
-std::array<float,2>{0.163648799f, 0.875568092f},
-std::array<float,2>{0.761422813f, 0.463177055f},
-std::array<float,2>{0.922822952f, 0.760459363f},
-std::array<float,2>{0.110447511f, 0.327662408f},
-std::array<float,2>{0.484963059f, 0.702599406f},
-std::array<float,2>{0.733740151f, 0.104172587f},
-std::array<float,2>{0.838414371f, 0.647513747f},
-std::array<float,2>{0.242349431f, 0.00225900626f},
-std::array<float,2>{0.336873055f, 0.844740093f},
-std::array<float,2>{0.504725695f, 0.273855418f},
-std::array<float,2>{0.682296693f, 0.942633152f},
-std::array<float,2>{0.425626814f, 0.402906626f},
-std::array<float,2>{0.0470964573f, 0.554279029f},
-std::array<float,2>{0.952798545f, 0.144451067f},
-std::array<float,2>{0.507818699f, 0.716953456f},
-std::array<float,2>{0.335788697f, 0.123462178f},
-std::array<float,2>{0.23572126f, 0.780280709f},
-std::array<float,2>{0.834872901f, 0.341333747f},
-std::array<float,2>{0.940575123f, 0.898418069f},
-std::array<float,2>{0.0549363531f, 0.449249595f},
-std::array<float,2>{0.436644256f, 0.584605396f},
-std::array<float,2>{0.672887504f, 0.249773607f},
-std::array<float,2>{0.756950915f, 0.541152775f},
-std::array<float,2>{0.167349681f, 0.130311102f},
-std::array<float,2>{0.268151969f, 0.957912028f},
-std::array<float,2>{0.568097591f, 0.378392816f},
-std::array<float,2>{0.721034169f, 0.871172369f},
-std::array<float,2>{0.492676228f, 0.258635223f},
-std::array<float,2>{0.123524435f, 0.629302382f},
-std::array<float,2>{0.931687832f, 0.0179396924f},
-std::array<float,2>{0.651660085f, 0.615914345f},
-std::array<float,2>{0.37716493f, 0.209695756f},
-std::array<float,2>{0.00669814926f, 0.909687638f},
-std::array<float,2>{0.973420799f, 0.49639222f},
-std::array<float,2>{0.843860924f, 0.797384381f},
-std::array<float,2>{0.194123983f, 0.356564522f},
-std::array<float,2>{0.350936741f, 0.722510815f},
-std::array<float,2>{0.536494076f, 0.0864790455f},
-std::array<float,2>{0.891711831f, 0.684680283f},
-std::array<float,2>{0.0774534494f, 0.0530140959f},
-std::array<float,2>{0.451962829f, 0.839642644f},
-std::array<float,2>{0.69030416f, 0.305729657f},
-std::array<float,2>{0.604851544f, 0.986661315f},
-std::array<float,2>{0.309307337f, 0.414516956f},
-std::array<float,2>{0.127687946f, 0.504690528f},
-std::array<float,2>{0.798501611f, 0.172632828f},
-std::array<float,2>{0.716242969f, 0.641168535f},
-std::array<float,2>{0.467301637f, 0.00395550393f},
-std::array<float,2>{0.0804781914f, 0.850168049f},
-std::array<float,2>{0.881823421f, 0.277904898f},
-std::array<float,2>{0.789457679f, 0.938255906f},
-std::array<float,2>{0.154553682f, 0.398931742f},
-std::array<float,2>{0.290926576f, 0.548871875f},
-std::array<float,2>{0.616485775f, 0.146148786f},
-std::array<float,2>{0.994772375f, 0.576192975f},
-std::array<float,2>{0.0161545854f, 0.227633715f},
-std::array<float,2>{0.40188542f, 0.882407427f},
-std::array<float,2>{0.631375432f, 0.466661513f},
-std::array<float,2>{0.556042969f, 0.764058232f},
-std::array<float,2>{0.373229623f, 0.320320278f},
-std::array<float,2>{0.206769571f, 0.696070194f},
-std::array<float,2>{0.862618804f, 0.108604223f},
-std::array<float,2>{0.59309262f, 0.52327776f},
-std::array<float,2>{0.253112465f, 0.16525811f},
-std::array<float,2>{0.182873741f, 0.970405996f},
-std::array<float,2>{0.768779278f, 0.427217275f},
-std::array<float,2>{0.91290307f, 0.825041592f},
-std::array<float,2>{0.0964908153f, 0.289295882f},
-std::array<float,2>{0.473856151f, 0.666534781f},
-std::array<float,2>{0.748411059f, 0.0397908315f},
-std::array<float,2>{0.820443869f, 0.737857521f},
-std::array<float,2>{0.221755937f, 0.0736176372f},
-std::array<float,2>{0.320311755f, 0.790937722f},
-std::array<float,2>{0.527912378f, 0.363136828f},
-std::array<float,2>{0.665009081f, 0.934264123f},
-std::array<float,2>{0.412885308f, 0.476920575f},
-std::array<float,2>{0.0439730249f, 0.598196208f},
-std::array<float,2>{0.967450321f, 0.197341248f},
-std::array<float,2>{0.624737024f, 0.659500003f},
-std::array<float,2>{0.286956191f, 0.0333425514f},
-std::array<float,2>{0.148198217f, 0.819279969f},
-std::array<float,2>{0.7813887f, 0.282673299f},
-std::array<float,2>{0.887745261f, 0.981392443f},
-std::array<float,2>{0.0893644169f, 0.433629841f},
-std::array<float,2>{0.459676236f, 0.529140055f},
-std::array<float,2>{0.70848614f, 0.163748443f},
-std::array<float,2>{0.87171936f, 0.60655576f},
-std::array<float,2>{0.211987242f, 0.194464982f},
-std::array<float,2>{0.361548573f, 0.924405098f},
-std::array<float,2>{0.550548136f, 0.474011153f},
-std::array<float,2>{0.63731271f, 0.787972987f},
-std::array<float,2>{0.397587597f, 0.370400488f},
-std::array<float,2>{0.025331635f, 0.748130918f},
-std::array<float,2>{0.988950849f, 0.0628435984f},
-std::array<float,2>{0.739073396f, 0.560733616f},
-std::array<float,2>{0.478874832f, 0.150646865f},
-std::array<float,2>{0.101693816f, 0.945445657f},
-std::array<float,2>{0.91816783f, 0.391141117f},
-std::array<float,2>{0.780810714f, 0.854551256f},
-std::array<float,2>{0.174365714f, 0.266994715f},
-std::array<float,2>{0.260544688f, 0.648942471f},
-std::array<float,2>{0.581298888f, 0.011303734f},
-std::array<float,2>{0.956804931f, 0.693419337f},
-std::array<float,2>{0.0330495648f, 0.0996085629f},
-std::array<float,2>{0.416413486f, 0.750144303f},
-std::array<float,2>{0.661305308f, 0.315222681f},
-std::array<float,2>{0.516581893f, 0.884051681f},
-std::array<float,2>{0.321293145f, 0.460472614f},
-std::array<float,2>{0.23228088f, 0.564301491f},
-std::array<float,2>{0.8170439f, 0.222416341f},
-std::array<float,2>{0.687242031f, 0.727019131f},
-std::array<float,2>{0.426895291f, 0.0817863122f},
-std::array<float,2>{0.0531927869f, 0.809590936f},
-std::array<float,2>{0.948420167f, 0.344069719f},
-std::array<float,2>{0.840722382f, 0.915295601f},
-std::array<float,2>{0.246568665f, 0.490973324f},
-std::array<float,2>{0.340166062f, 0.623502851f},
-std::array<float,2>{0.502848029f, 0.21400699f},
-std::array<float,2>{0.928168654f, 0.509257972f},
-std::array<float,2>{0.116060235f, 0.184306517f},
-std::array<float,2>{0.488986284f, 0.997665346f},
-std::array<float,2>{0.727656543f, 0.413433611f},
-std::array<float,2>{0.576507747f, 0.83086586f},
-std::array<float,2>{0.279700637f, 0.301654965f},
-std::array<float,2>{0.1571787f, 0.679555833f},
-std::array<float,2>{0.762959421f, 0.0609840602f},
-std::array<float,2>{0.5428406f, 0.587937236f},
-std::array<float,2>{0.355249822f, 0.241538674f},
-std::array<float,2>{0.202680394f, 0.90141499f},
-std::array<float,2>{0.855994105f, 0.438712955f},
-std::array<float,2>{0.979597807f, 0.772708058f},
-std::array<float,2>{0.00930623151f, 0.330309361f},
-std::array<float,2>{0.389056414f, 0.705390394f},
-std::array<float,2>{0.640743613f, 0.109418616f},
-std::array<float,2>{0.81171304f, 0.638611078f},
-std::array<float,2>{0.138684422f, 0.0237254687f},
-std::array<float,2>{0.302218705f, 0.861903548f},
-std::array<float,2>{0.600127697f, 0.255479008f},
-std::array<float,2>{0.695824265f, 0.963914752f},
-std::array<float,2>{0.444254518f, 0.386996776f},
-std::array<float,2>{0.0682107657f, 0.537340403f},
-std::array<float,2>{0.902530432f, 0.13699773f},
-std::array<float,2>{0.563812971f, 0.742593646f},
-std::array<float,2>{0.270745158f, 0.0681279972f},
-std::array<float,2>{0.170802221f, 0.781447828f},
-std::array<float,2>{0.753062785f, 0.373467475f},
-std::array<float,2>{0.9358235f, 0.929417431f},
-std::array<float,2>{0.117713191f, 0.469771534f},
-std::array<float,2>{0.496519238f, 0.603561461f},
-std::array<float,2>{0.726360619f, 0.189462647f},
-std::array<float,2>{0.831077695f, 0.52412951f},
-std::array<float,2>{0.240471959f, 0.157534301f},
-std::array<float,2>{0.330101162f, 0.976902783f},
-std::array<float,2>{0.512614846f, 0.430769414f},
-std::array<float,2>{0.677274287f, 0.813560128f},
-std::array<float,2>{0.431790382f, 0.288992405f},
-std::array<float,2>{0.0606842525f, 0.66394043f},
-std::array<float,2>{0.943744421f, 0.0359827168f},
-std::array<float,2>{0.691685915f, 0.570239782f},
-std::array<float,2>{0.446297467f, 0.223617196f},
-std::array<float,2>{0.0726411343f, 0.886774719f},
-std::array<float,2>{0.898221374f, 0.456260771f},
-std::array<float,2>{0.800919533f, 0.756245613f},
-std::array<float,2>{0.132098973f, 0.319230497f},
-std::array<float,2>{0.305540115f, 0.689156532f},
-std::array<float,2>{0.608030438f, 0.0948955193f},
-std::array<float,2>{0.970789909f, 0.654132247f},
-std::array<float,2>{0.00375009258f, 0.0148588922f},
-std::array<float,2>{0.382403731f, 0.858265221f},
-std::array<float,2>{0.655669034f, 0.270281941f},
-std::array<float,2>{0.533649623f, 0.949999869f},
-std::array<float,2>{0.345745027f, 0.39774549f},
-std::array<float,2>{0.189704254f, 0.555924296f},
-std::array<float,2>{0.849578619f, 0.155815631f},
-std::array<float,2>{0.627616704f, 0.672227025f},
-std::array<float,2>{0.403212607f, 0.0548985191f},
-std::array<float,2>{0.0205519553f, 0.83500737f},
-std::array<float,2>{0.997662485f, 0.300494343f},
-std::array<float,2>{0.86571306f, 0.993986964f},
-std::array<float,2>{0.208185121f, 0.406651974f},
-std::array<float,2>{0.369573027f, 0.513933241f},
-std::array<float,2>{0.560433269f, 0.181638539f},
-std::array<float,2>{0.876537859f, 0.618411362f},
-std::array<float,2>{0.0843495801f, 0.215177119f},
-std::array<float,2>{0.463563412f, 0.918457568f},
-std::array<float,2>{0.714143336f, 0.487669498f},
-std::array<float,2>{0.609543562f, 0.807419181f},
-std::array<float,2>{0.294674605f, 0.350653529f},
-std::array<float,2>{0.151970252f, 0.732638478f},
-std::array<float,2>{0.794313848f, 0.0848006159f},
-std::array<float,2>{0.523948729f, 0.535028934f},
-std::array<float,2>{0.315460801f, 0.134118676f},
-std::array<float,2>{0.224603981f, 0.967592716f},
-std::array<float,2>{0.825360775f, 0.385024339f},
-std::array<float,2>{0.964414477f, 0.867017806f},
-std::array<float,2>{0.0402730964f, 0.251398683f},
-std::array<float,2>{0.409901172f, 0.636058986f},
-std::array<float,2>{0.670285165f, 0.0305928811f},
-std::array<float,2>{0.771839142f, 0.707763195f},
-std::array<float,2>{0.187438369f, 0.116011955f},
-std::array<float,2>{0.254735947f, 0.769262493f},
-std::array<float,2>{0.589428306f, 0.332414895f},
-std::array<float,2>{0.744810879f, 0.905593753f},
-std::array<float,2>{0.471859604f, 0.442310363f},
-std::array<float,2>{0.0982576534f, 0.590478539f},
-std::array<float,2>{0.906572223f, 0.237648204f},
-std::array<float,2>{0.551629722f, 0.625629246f},
-std::array<float,2>{0.365581036f, 0.0204146206f},
-std::array<float,2>{0.215783745f, 0.868418396f},
-std::array<float,2>{0.868811071f, 0.263596922f},
-std::array<float,2>{0.985108912f, 0.954716504f},
-std::array<float,2>{0.0286567938f, 0.3806687f},
-std::array<float,2>{0.394444674f, 0.544936478f},
-std::array<float,2>{0.635847986f, 0.127846301f},
-std::array<float,2>{0.787769675f, 0.5783903f},
-std::array<float,2>{0.142972648f, 0.24235034f},
-std::array<float,2>{0.281975478f, 0.891606033f},
-std::array<float,2>{0.620529711f, 0.44671604f},
-std::array<float,2>{0.705099702f, 0.776155949f},
-std::array<float,2>{0.455093354f, 0.339316577f},
-std::array<float,2>{0.0928074121f, 0.711675823f},
-std::array<float,2>{0.884670496f, 0.117852993f},
-std::array<float,2>{0.656812727f, 0.500971079f},
-std::array<float,2>{0.421244621f, 0.177778512f},
-std::array<float,2>{0.0385159031f, 0.992073119f},
-std::array<float,2>{0.958891869f, 0.417988986f},
-std::array<float,2>{0.814976871f, 0.842413545f},
-std::array<float,2>{0.227041751f, 0.310883313f},
-std::array<float,2>{0.324917078f, 0.68204987f},
-std::array<float,2>{0.523084402f, 0.0474594496f},
-std::array<float,2>{0.914569795f, 0.726195991f},
-std::array<float,2>{0.108538918f, 0.0923095942f},
-std::array<float,2>{0.4817819f, 0.801272452f},
-std::array<float,2>{0.736443877f, 0.352347553f},
-std::array<float,2>{0.585280418f, 0.91320622f},
-std::array<float,2>{0.264180392f, 0.492819786f},
-std::array<float,2>{0.178172484f, 0.612247884f},
-std::array<float,2>{0.775510013f, 0.203347951f},
-std::array<float,2>{0.730850756f, 0.700407326f},
-std::array<float,2>{0.487465948f, 0.102711447f},
-std::array<float,2>{0.112193033f, 0.758071661f},
-std::array<float,2>{0.924673259f, 0.324781388f},
-std::array<float,2>{0.758408308f, 0.877093732f},
-std::array<float,2>{0.161552519f, 0.46226871f},
-std::array<float,2>{0.276884705f, 0.572789013f},
-std::array<float,2>{0.570452034f, 0.232271165f},
-std::array<float,2>{0.949974298f, 0.551041067f},
-std::array<float,2>{0.0507038571f, 0.141907707f},
-std::array<float,2>{0.421970487f, 0.945227921f},
-std::array<float,2>{0.681298792f, 0.404951006f},
-std::array<float,2>{0.507151961f, 0.846249878f},
-std::array<float,2>{0.338829935f, 0.277147859f},
-std::array<float,2>{0.244800717f, 0.6448313f},
-std::array<float,2>{0.836424649f, 0.000145867074f},
-std::array<float,2>{0.59684211f, 0.595770299f},
-std::array<float,2>{0.298778355f, 0.202018186f},
-std::array<float,2>{0.134445399f, 0.931988537f},
-std::array<float,2>{0.806277037f, 0.480518639f},
-std::array<float,2>{0.899353862f, 0.796683133f},
-std::array<float,2>{0.0637556538f, 0.366969317f},
-std::array<float,2>{0.440293372f, 0.739081919f},
-std::array<float,2>{0.702578604f, 0.0759460628f},
-std::array<float,2>{0.851639032f, 0.668521225f},
-std::array<float,2>{0.197540507f, 0.046327062f},
-std::array<float,2>{0.358954519f, 0.821503937f},
-std::array<float,2>{0.546530902f, 0.296736598f},
-std::array<float,2>{0.648080528f, 0.975395799f},
-std::array<float,2>{0.383927315f, 0.425173461f},
-std::array<float,2>{0.0129617658f, 0.51744473f},
-std::array<float,2>{0.982769787f, 0.169920549f}}
\ No newline at end of file
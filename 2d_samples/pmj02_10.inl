@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.389828295f, 0.586450219f},
-std::array<float,2>{0.637535334f, 0.0397882164f},
-std::array<float,2>{0.165207356f, 0.335251302f},
-std::array<float,2>{0.778740346f, 0.859568298f},
-std::array<float,2>{0.00260964502f, 0.876178265f},
-std::array<float,2>{0.878244281f, 0.405331939f},
-std::array<float,2>{0.274852067f, 0.23465468f},
-std::array<float,2>{0.569218934f, 0.63723439f},
-std::array<float,2>{0.223742545f, 0.702973187f},
-std::array<float,2>{0.819032073f, 0.164392516f},
-std::array<float,2>{0.476527184f, 0.446660221f},
-std::array<float,2>{0.709870934f, 0.959822178f},
-std::array<float,2>{0.35360384f, 0.762743115f},
-std::array<float,2>{0.516176224f, 0.278206766f},
-std::array<float,2>{0.0980189443f, 0.106436305f},
-std::array<float,2>{0.971250117f, 0.552416563f},
-std::array<float,2>{0.292208254f, 0.683454096f},
-std::array<float,2>{0.616196096f, 0.187993407f},
-std::array<float,2>{0.052812241f, 0.414832532f},
-std::array<float,2>{0.935294807f, 0.927223504f},
-std::array<float,2>{0.138824642f, 0.823192298f},
-std::array<float,2>{0.785885453f, 0.372811228f},
-std::array<float,2>{0.425934643f, 0.0251128972f},
-std::array<float,2>{0.658815622f, 0.601734519f},
-std::array<float,2>{0.0712746009f, 0.500597656f},
-std::array<float,2>{0.952453613f, 0.0736257061f},
-std::array<float,2>{0.315195143f, 0.300636679f},
-std::array<float,2>{0.560874462f, 0.808231056f},
-std::array<float,2>{0.447854429f, 0.997344792f},
-std::array<float,2>{0.732502639f, 0.482236862f},
-std::array<float,2>{0.201428473f, 0.147830471f},
-std::array<float,2>{0.857043803f, 0.736949384f},
-std::array<float,2>{0.332131445f, 0.532399416f},
-std::array<float,2>{0.54607451f, 0.115303345f},
-std::array<float,2>{0.0905000344f, 0.254623502f},
-std::array<float,2>{0.967709363f, 0.779608786f},
-std::array<float,2>{0.21197027f, 0.951898217f},
-std::array<float,2>{0.866838932f, 0.467532605f},
-std::array<float,2>{0.462247431f, 0.172440916f},
-std::array<float,2>{0.741602361f, 0.709774673f},
-std::array<float,2>{0.0408442616f, 0.645972431f},
-std::array<float,2>{0.916911364f, 0.23001653f},
-std::array<float,2>{0.310467988f, 0.382786691f},
-std::array<float,2>{0.607145548f, 0.902197123f},
-std::array<float,2>{0.408295989f, 0.852546215f},
-std::array<float,2>{0.68481487f, 0.320637733f},
-std::array<float,2>{0.152162805f, 0.0534754544f},
-std::array<float,2>{0.811650753f, 0.573086739f},
-std::array<float,2>{0.492860973f, 0.721904576f},
-std::array<float,2>{0.694467008f, 0.125994802f},
-std::array<float,2>{0.240475073f, 0.49171862f},
-std::array<float,2>{0.828988075f, 0.975285172f},
-std::array<float,2>{0.12128336f, 0.795770288f},
-std::array<float,2>{0.991683185f, 0.283311665f},
-std::array<float,2>{0.359977007f, 0.090891175f},
-std::array<float,2>{0.506176472f, 0.519816697f},
-std::array<float,2>{0.177788317f, 0.613518834f},
-std::array<float,2>{0.751532137f, 0.011777034f},
-std::array<float,2>{0.395622879f, 0.346420527f},
-std::array<float,2>{0.651148617f, 0.838252664f},
-std::array<float,2>{0.250871778f, 0.911533713f},
-std::array<float,2>{0.584808052f, 0.431620091f},
-std::array<float,2>{0.0167371705f, 0.216768309f},
-std::array<float,2>{0.896663249f, 0.662883639f},
-std::array<float,2>{0.459901303f, 0.525088608f},
-std::array<float,2>{0.746415555f, 0.0816173926f},
-std::array<float,2>{0.208240226f, 0.295291126f},
-std::array<float,2>{0.874038994f, 0.7882846f},
-std::array<float,2>{0.0817310438f, 0.977740169f},
-std::array<float,2>{0.955310702f, 0.498247415f},
-std::array<float,2>{0.343127072f, 0.136655867f},
-std::array<float,2>{0.532794416f, 0.733312666f},
-std::array<float,2>{0.14079389f, 0.664807498f},
-std::array<float,2>{0.799438059f, 0.204571262f},
-std::array<float,2>{0.414086163f, 0.422581971f},
-std::array<float,2>{0.673650086f, 0.92185992f},
-std::array<float,2>{0.301041305f, 0.834356248f},
-std::array<float,2>{0.598849714f, 0.352449983f},
-std::array<float,2>{0.0357996821f, 0.00402253261f},
-std::array<float,2>{0.913999736f, 0.621195197f},
-std::array<float,2>{0.367472529f, 0.712888956f},
-std::array<float,2>{0.514490068f, 0.187397569f},
-std::array<float,2>{0.1153275f, 0.45525983f},
-std::array<float,2>{0.994039476f, 0.942927361f},
-std::array<float,2>{0.24718973f, 0.76573813f},
-std::array<float,2>{0.83903718f, 0.261039048f},
-std::array<float,2>{0.488697201f, 0.122165971f},
-std::array<float,2>{0.699530363f, 0.539619863f},
-std::array<float,2>{0.0266358592f, 0.565711677f},
-std::array<float,2>{0.903363466f, 0.0556242168f},
-std::array<float,2>{0.265389562f, 0.317138612f},
-std::array<float,2>{0.586027145f, 0.849562407f},
-std::array<float,2>{0.402498215f, 0.892983794f},
-std::array<float,2>{0.645720482f, 0.383134156f},
-std::array<float,2>{0.180580586f, 0.225424632f},
-std::array<float,2>{0.761083484f, 0.6517542f},
-std::array<float,2>{0.270009488f, 0.596688688f},
-std::array<float,2>{0.573506474f, 0.0173408855f},
-std::array<float,2>{0.0132239265f, 0.362955958f},
-std::array<float,2>{0.884937525f, 0.818434179f},
-std::array<float,2>{0.156973749f, 0.934928358f},
-std::array<float,2>{0.76638186f, 0.413767397f},
-std::array<float,2>{0.375460237f, 0.201632351f},
-std::array<float,2>{0.625360072f, 0.674090743f},
-std::array<float,2>{0.101762928f, 0.742406428f},
-std::array<float,2>{0.977407575f, 0.153281957f},
-std::array<float,2>{0.350359708f, 0.474253535f},
-std::array<float,2>{0.5281744f, 0.985962868f},
-std::array<float,2>{0.482646227f, 0.79807651f},
-std::array<float,2>{0.712115169f, 0.30891186f},
-std::array<float,2>{0.231348813f, 0.064543739f},
-std::array<float,2>{0.821373641f, 0.507917762f},
-std::array<float,2>{0.432921737f, 0.626648605f},
-std::array<float,2>{0.665322542f, 0.245739862f},
-std::array<float,2>{0.12897867f, 0.397323012f},
-std::array<float,2>{0.7954638f, 0.889410138f},
-std::array<float,2>{0.0600652806f, 0.874169528f},
-std::array<float,2>{0.923844934f, 0.34066847f},
-std::array<float,2>{0.288747102f, 0.0335804671f},
-std::array<float,2>{0.619297147f, 0.580157518f},
-std::array<float,2>{0.190616578f, 0.562289715f},
-std::array<float,2>{0.845889747f, 0.0994285569f},
-std::array<float,2>{0.43931216f, 0.269692063f},
-std::array<float,2>{0.721325994f, 0.757202327f},
-std::array<float,2>{0.322726965f, 0.963214874f},
-std::array<float,2>{0.55007273f, 0.445061475f},
-std::array<float,2>{0.0625327677f, 0.162775159f},
-std::array<float,2>{0.941805065f, 0.694793642f},
-std::array<float,2>{0.42094484f, 0.55062592f},
-std::array<float,2>{0.676712871f, 0.103422463f},
-std::array<float,2>{0.147819176f, 0.276299149f},
-std::array<float,2>{0.80210501f, 0.758694828f},
-std::array<float,2>{0.0315129273f, 0.955898404f},
-std::array<float,2>{0.906468511f, 0.451902449f},
-std::array<float,2>{0.300587386f, 0.168996915f},
-std::array<float,2>{0.596890152f, 0.698765218f},
-std::array<float,2>{0.204731435f, 0.63596487f},
-std::array<float,2>{0.870895207f, 0.238607869f},
-std::array<float,2>{0.455520302f, 0.400390178f},
-std::array<float,2>{0.742591023f, 0.880551934f},
-std::array<float,2>{0.339836955f, 0.864528298f},
-std::array<float,2>{0.535616219f, 0.330258965f},
-std::array<float,2>{0.0821358562f, 0.0432203822f},
-std::array<float,2>{0.958789408f, 0.592082798f},
-std::array<float,2>{0.259928644f, 0.740832448f},
-std::array<float,2>{0.590238273f, 0.142912447f},
-std::array<float,2>{0.0312407538f, 0.480423689f},
-std::array<float,2>{0.900327146f, 0.995319426f},
-std::array<float,2>{0.187361807f, 0.808874905f},
-std::array<float,2>{0.764431894f, 0.304106981f},
-std::array<float,2>{0.399257034f, 0.0743787661f},
-std::array<float,2>{0.641927361f, 0.504968345f},
-std::array<float,2>{0.109510936f, 0.606369555f},
-std::array<float,2>{0.997624338f, 0.0311862845f},
-std::array<float,2>{0.374932438f, 0.368576109f},
-std::array<float,2>{0.511465192f, 0.825978577f},
-std::array<float,2>{0.486114502f, 0.922661364f},
-std::array<float,2>{0.698857725f, 0.418415874f},
-std::array<float,2>{0.243971989f, 0.19175747f},
-std::array<float,2>{0.841149747f, 0.686228156f},
-std::array<float,2>{0.347033679f, 0.576174498f},
-std::array<float,2>{0.525538087f, 0.0493795201f},
-std::array<float,2>{0.106428787f, 0.325561762f},
-std::array<float,2>{0.982898235f, 0.85588944f},
-std::array<float,2>{0.227947503f, 0.904428363f},
-std::array<float,2>{0.827343404f, 0.376590282f},
-std::array<float,2>{0.477122277f, 0.234178156f},
-std::array<float,2>{0.716469884f, 0.64377892f},
-std::array<float,2>{0.00898726564f, 0.705357015f},
-std::array<float,2>{0.887778461f, 0.177994579f},
-std::array<float,2>{0.269304037f, 0.461464018f},
-std::array<float,2>{0.576811314f, 0.947869241f},
-std::array<float,2>{0.381476849f, 0.77377671f},
-std::array<float,2>{0.629175723f, 0.2520504f},
-std::array<float,2>{0.161551282f, 0.111686252f},
-std::array<float,2>{0.772139072f, 0.537635624f},
-std::array<float,2>{0.44395718f, 0.659238875f},
-std::array<float,2>{0.725234926f, 0.213854775f},
-std::array<float,2>{0.194962829f, 0.43535322f},
-std::array<float,2>{0.851075709f, 0.90782392f},
-std::array<float,2>{0.0680034533f, 0.842206895f},
-std::array<float,2>{0.940629184f, 0.34895429f},
-std::array<float,2>{0.326504201f, 0.0102564804f},
-std::array<float,2>{0.553309619f, 0.609405577f},
-std::array<float,2>{0.126871511f, 0.516285896f},
-std::array<float,2>{0.792866766f, 0.0889257118f},
-std::array<float,2>{0.436950088f, 0.286919534f},
-std::array<float,2>{0.669965506f, 0.789237857f},
-std::array<float,2>{0.284243792f, 0.969277799f},
-std::array<float,2>{0.621325314f, 0.485462755f},
-std::array<float,2>{0.0585272014f, 0.129066855f},
-std::array<float,2>{0.925790429f, 0.726461709f},
-std::array<float,2>{0.470453918f, 0.618194282f},
-std::array<float,2>{0.703338146f, 0.0028137425f},
-std::array<float,2>{0.21954982f, 0.356910914f},
-std::array<float,2>{0.815289438f, 0.828876078f},
-std::array<float,2>{0.0964426696f, 0.916815162f},
-std::array<float,2>{0.974214911f, 0.428200513f},
-std::array<float,2>{0.35803026f, 0.207566485f},
-std::array<float,2>{0.521263778f, 0.671164989f},
-std::array<float,2>{0.168585524f, 0.729146421f},
-std::array<float,2>{0.777169585f, 0.137573287f},
-std::array<float,2>{0.385735959f, 0.49398151f},
-std::array<float,2>{0.635603011f, 0.981156051f},
-std::array<float,2>{0.28011319f, 0.781492054f},
-std::array<float,2>{0.564878166f, 0.290962219f},
-std::array<float,2>{0.00667375419f, 0.0841772929f},
-std::array<float,2>{0.882508874f, 0.530694425f},
-std::array<float,2>{0.316669941f, 0.654670417f},
-std::array<float,2>{0.555546761f, 0.221908629f},
-std::array<float,2>{0.074973546f, 0.390496969f},
-std::array<float,2>{0.947437942f, 0.89723146f},
-std::array<float,2>{0.198659688f, 0.84447062f},
-std::array<float,2>{0.852314889f, 0.315563023f},
-std::array<float,2>{0.452780396f, 0.0608708896f},
-std::array<float,2>{0.730026186f, 0.568336666f},
-std::array<float,2>{0.0470818691f, 0.543540955f},
-std::array<float,2>{0.930185318f, 0.117576562f},
-std::array<float,2>{0.294459492f, 0.265233099f},
-std::array<float,2>{0.612690508f, 0.770129561f},
-std::array<float,2>{0.422221869f, 0.940905094f},
-std::array<float,2>{0.662239313f, 0.460235506f},
-std::array<float,2>{0.134239197f, 0.180749178f},
-std::array<float,2>{0.781597018f, 0.717583239f},
-std::array<float,2>{0.305874139f, 0.514792442f},
-std::array<float,2>{0.603176355f, 0.0669850335f},
-std::array<float,2>{0.0455291308f, 0.307209581f},
-std::array<float,2>{0.919645607f, 0.804504335f},
-std::array<float,2>{0.152436018f, 0.988725841f},
-std::array<float,2>{0.805472255f, 0.469548583f},
-std::array<float,2>{0.412114918f, 0.148692653f},
-std::array<float,2>{0.681460738f, 0.747007906f},
-std::array<float,2>{0.0873160735f, 0.676116943f},
-std::array<float,2>{0.963377833f, 0.197282538f},
-std::array<float,2>{0.328803658f, 0.407662511f},
-std::array<float,2>{0.542039573f, 0.932917893f},
-std::array<float,2>{0.468204319f, 0.813804984f},
-std::array<float,2>{0.735360503f, 0.365693927f},
-std::array<float,2>{0.216373593f, 0.0208461471f},
-std::array<float,2>{0.862045765f, 0.598906457f},
-std::array<float,2>{0.393689156f, 0.687653303f},
-std::array<float,2>{0.655620456f, 0.159267321f},
-std::array<float,2>{0.171942815f, 0.438043714f},
-std::array<float,2>{0.755048752f, 0.968654275f},
-std::array<float,2>{0.021196533f, 0.752013445f},
-std::array<float,2>{0.893301487f, 0.268779576f},
-std::array<float,2>{0.254978359f, 0.097117506f},
-std::array<float,2>{0.578800857f, 0.555013418f},
-std::array<float,2>{0.237536415f, 0.583308399f},
-std::array<float,2>{0.833001912f, 0.0361849293f},
-std::array<float,2>{0.498199761f, 0.336152583f},
-std::array<float,2>{0.690560222f, 0.870319784f},
-std::array<float,2>{0.365857393f, 0.886404693f},
-std::array<float,2>{0.50244081f, 0.394151747f},
-std::array<float,2>{0.117243588f, 0.246523052f},
-std::array<float,2>{0.988159597f, 0.63102752f},
-std::array<float,2>{0.429254651f, 0.60412246f},
-std::array<float,2>{0.656430066f, 0.0254087113f},
-std::array<float,2>{0.137489542f, 0.3733702f},
-std::array<float,2>{0.788843989f, 0.820577025f},
-std::array<float,2>{0.051517792f, 0.927761734f},
-std::array<float,2>{0.936124027f, 0.416531473f},
-std::array<float,2>{0.290344834f, 0.190104902f},
-std::array<float,2>{0.613802433f, 0.680774212f},
-std::array<float,2>{0.199878737f, 0.735918581f},
-std::array<float,2>{0.8583588f, 0.145828888f},
-std::array<float,2>{0.446294248f, 0.484036893f},
-std::array<float,2>{0.730583847f, 0.999145329f},
-std::array<float,2>{0.313152134f, 0.805691361f},
-std::array<float,2>{0.560212255f, 0.297102481f},
-std::array<float,2>{0.074125737f, 0.0709512085f},
-std::array<float,2>{0.949968159f, 0.503504455f},
-std::array<float,2>{0.276392162f, 0.640006542f},
-std::array<float,2>{0.567758799f, 0.237616062f},
-std::array<float,2>{0.000179322087f, 0.40256387f},
-std::array<float,2>{0.875709414f, 0.878651917f},
-std::array<float,2>{0.167725623f, 0.862503111f},
-std::array<float,2>{0.779526353f, 0.333324522f},
-std::array<float,2>{0.388483107f, 0.041451849f},
-std::array<float,2>{0.640430272f, 0.589283228f},
-std::array<float,2>{0.100448377f, 0.554164529f},
-std::array<float,2>{0.969112039f, 0.10785798f},
-std::array<float,2>{0.353158444f, 0.281223446f},
-std::array<float,2>{0.519010305f, 0.764444888f},
-std::array<float,2>{0.474123061f, 0.958627105f},
-std::array<float,2>{0.707501113f, 0.447634548f},
-std::array<float,2>{0.226474702f, 0.167579278f},
-std::array<float,2>{0.817857623f, 0.700082898f},
-std::array<float,2>{0.363113582f, 0.521823943f},
-std::array<float,2>{0.505782545f, 0.0925692916f},
-std::array<float,2>{0.124104321f, 0.282781988f},
-std::array<float,2>{0.988887012f, 0.79353708f},
-std::array<float,2>{0.23887004f, 0.973747075f},
-std::array<float,2>{0.831427634f, 0.489584804f},
-std::array<float,2>{0.494711101f, 0.127289951f},
-std::array<float,2>{0.691811144f, 0.71920073f},
-std::array<float,2>{0.018960366f, 0.661075354f},
-std::array<float,2>{0.894935071f, 0.217661649f},
-std::array<float,2>{0.252781898f, 0.433239669f},
-std::array<float,2>{0.583739161f, 0.913185775f},
-std::array<float,2>{0.398323566f, 0.836827099f},
-std::array<float,2>{0.649293423f, 0.344974667f},
-std::array<float,2>{0.177600354f, 0.0155914528f},
-std::array<float,2>{0.752589047f, 0.61647445f},
-std::array<float,2>{0.463566482f, 0.707762122f},
-std::array<float,2>{0.739594579f, 0.175672561f},
-std::array<float,2>{0.214576527f, 0.465174288f},
-std::array<float,2>{0.864172876f, 0.951044083f},
-std::array<float,2>{0.0936131626f, 0.778362453f},
-std::array<float,2>{0.966014028f, 0.257414788f},
-std::array<float,2>{0.33422327f, 0.113900527f},
-std::array<float,2>{0.543439686f, 0.53325069f},
-std::array<float,2>{0.148686498f, 0.57170248f},
-std::array<float,2>{0.809072554f, 0.0526599735f},
-std::array<float,2>{0.407539219f, 0.32314828f},
-std::array<float,2>{0.687172949f, 0.854027569f},
-std::array<float,2>{0.311590731f, 0.899609208f},
-std::array<float,2>{0.608249545f, 0.3797189f},
-std::array<float,2>{0.0416158736f, 0.227210969f},
-std::array<float,2>{0.914240301f, 0.648317873f},
-std::array<float,2>{0.490847975f, 0.5412727f},
-std::array<float,2>{0.701776803f, 0.123560295f},
-std::array<float,2>{0.248421654f, 0.259625673f},
-std::array<float,2>{0.836147189f, 0.768225789f},
-std::array<float,2>{0.11394386f, 0.944972873f},
-std::array<float,2>{0.995014131f, 0.454592407f},
-std::array<float,2>{0.369638085f, 0.185254395f},
-std::array<float,2>{0.511887312f, 0.714840174f},
-std::array<float,2>{0.181722894f, 0.650035441f},
-std::array<float,2>{0.758921266f, 0.222831666f},
-std::array<float,2>{0.406095803f, 0.384766042f},
-std::array<float,2>{0.646563172f, 0.89159435f},
-std::array<float,2>{0.263128132f, 0.850004792f},
-std::array<float,2>{0.588486314f, 0.319769353f},
-std::array<float,2>{0.0244417954f, 0.0578055419f},
-std::array<float,2>{0.904878676f, 0.563859522f},
-std::array<float,2>{0.340201765f, 0.731850982f},
-std::array<float,2>{0.534143567f, 0.134132385f},
-std::array<float,2>{0.0786839351f, 0.496338725f},
-std::array<float,2>{0.954356134f, 0.979655743f},
-std::array<float,2>{0.209901512f, 0.785768628f},
-std::array<float,2>{0.872424901f, 0.294667274f},
-std::array<float,2>{0.458318174f, 0.0799181238f},
-std::array<float,2>{0.749520481f, 0.526928961f},
-std::array<float,2>{0.0388615169f, 0.624176204f},
-std::array<float,2>{0.9118644f, 0.00621447526f},
-std::array<float,2>{0.303456217f, 0.355357736f},
-std::array<float,2>{0.600885391f, 0.833478093f},
-std::array<float,2>{0.416729659f, 0.918371558f},
-std::array<float,2>{0.675381541f, 0.424653053f},
-std::array<float,2>{0.143391773f, 0.205941811f},
-std::array<float,2>{0.797091603f, 0.666460156f},
-std::array<float,2>{0.286599755f, 0.578681946f},
-std::array<float,2>{0.61745739f, 0.0332021676f},
-std::array<float,2>{0.0618112758f, 0.342409909f},
-std::array<float,2>{0.922875762f, 0.871555328f},
-std::array<float,2>{0.132332578f, 0.887430191f},
-std::array<float,2>{0.794265151f, 0.395948201f},
-std::array<float,2>{0.43159011f, 0.244029671f},
-std::array<float,2>{0.667242408f, 0.628157198f},
-std::array<float,2>{0.0646663606f, 0.693280101f},
-std::array<float,2>{0.944491565f, 0.16183196f},
-std::array<float,2>{0.320848793f, 0.442942321f},
-std::array<float,2>{0.547863245f, 0.961817682f},
-std::array<float,2>{0.44113192f, 0.754768193f},
-std::array<float,2>{0.720182955f, 0.273390085f},
-std::array<float,2>{0.188811138f, 0.0998283252f},
-std::array<float,2>{0.844601929f, 0.560221076f},
-std::array<float,2>{0.377119362f, 0.672228336f},
-std::array<float,2>{0.626962304f, 0.199995756f},
-std::array<float,2>{0.159727752f, 0.411867887f},
-std::array<float,2>{0.767702639f, 0.937186897f},
-std::array<float,2>{0.0150068533f, 0.817377388f},
-std::array<float,2>{0.884001493f, 0.359490216f},
-std::array<float,2>{0.273156077f, 0.0176173281f},
-std::array<float,2>{0.57079494f, 0.593999326f},
-std::array<float,2>{0.233361363f, 0.511180699f},
-std::array<float,2>{0.822693586f, 0.0637169629f},
-std::array<float,2>{0.481559664f, 0.312055081f},
-std::array<float,2>{0.71399802f, 0.799736381f},
-std::array<float,2>{0.349149942f, 0.987753034f},
-std::array<float,2>{0.530180037f, 0.475768298f},
-std::array<float,2>{0.10463798f, 0.156068578f},
-std::array<float,2>{0.97862494f, 0.745640218f},
-std::array<float,2>{0.40174216f, 0.506526828f},
-std::array<float,2>{0.643198729f, 0.0774523467f},
-std::array<float,2>{0.1852777f, 0.302301854f},
-std::array<float,2>{0.763264298f, 0.810625732f},
-std::array<float,2>{0.0275101792f, 0.994129419f},
-std::array<float,2>{0.90096128f, 0.477594435f},
-std::array<float,2>{0.258344501f, 0.140825301f},
-std::array<float,2>{0.593593657f, 0.739067733f},
-std::array<float,2>{0.244682506f, 0.685300469f},
-std::array<float,2>{0.841915905f, 0.193562463f},
-std::array<float,2>{0.488042504f, 0.419929922f},
-std::array<float,2>{0.696881056f, 0.924481511f},
-std::array<float,2>{0.371836126f, 0.826526344f},
-std::array<float,2>{0.509183407f, 0.36915043f},
-std::array<float,2>{0.111715049f, 0.0274303928f},
-std::array<float,2>{0.999121428f, 0.608584225f},
-std::array<float,2>{0.298139274f, 0.69556284f},
-std::array<float,2>{0.594960034f, 0.17025654f},
-std::array<float,2>{0.0342414677f, 0.450897336f},
-std::array<float,2>{0.909644127f, 0.953524649f},
-std::array<float,2>{0.144706696f, 0.761465013f},
-std::array<float,2>{0.804320455f, 0.274680436f},
-std::array<float,2>{0.419104099f, 0.104397662f},
-std::array<float,2>{0.67906934f, 0.547913909f},
-std::array<float,2>{0.0858249292f, 0.591063738f},
-std::array<float,2>{0.96066016f, 0.0465972275f},
-std::array<float,2>{0.336474627f, 0.329646796f},
-std::array<float,2>{0.537237465f, 0.866512418f},
-std::array<float,2>{0.453474194f, 0.881390452f},
-std::array<float,2>{0.744622052f, 0.402329594f},
-std::array<float,2>{0.205660105f, 0.240532681f},
-std::array<float,2>{0.867927492f, 0.63351655f},
-std::array<float,2>{0.32475394f, 0.613197803f},
-std::array<float,2>{0.551278055f, 0.00886413921f},
-std::array<float,2>{0.0692624971f, 0.350592107f},
-std::array<float,2>{0.938318312f, 0.839937329f},
-std::array<float,2>{0.192416385f, 0.909800768f},
-std::array<float,2>{0.849315166f, 0.43704471f},
-std::array<float,2>{0.441601932f, 0.210954443f},
-std::array<float,2>{0.724427223f, 0.656781375f},
-std::array<float,2>{0.0548789687f, 0.723677814f},
-std::array<float,2>{0.929580271f, 0.13168028f},
-std::array<float,2>{0.282631218f, 0.487618178f},
-std::array<float,2>{0.62452662f, 0.970884442f},
-std::array<float,2>{0.434709847f, 0.791593015f},
-std::array<float,2>{0.668752372f, 0.288326293f},
-std::array<float,2>{0.128249422f, 0.0870456249f},
-std::array<float,2>{0.789518535f, 0.518142521f},
-std::array<float,2>{0.479216605f, 0.640987456f},
-std::array<float,2>{0.716964662f, 0.231382638f},
-std::array<float,2>{0.22971037f, 0.377617478f},
-std::array<float,2>{0.824599743f, 0.903744221f},
-std::array<float,2>{0.107957356f, 0.858064592f},
-std::array<float,2>{0.981993139f, 0.326392263f},
-std::array<float,2>{0.343985915f, 0.0479815081f},
-std::array<float,2>{0.525236309f, 0.575005174f},
-std::array<float,2>{0.163912237f, 0.536797523f},
-std::array<float,2>{0.770003438f, 0.109709531f},
-std::array<float,2>{0.379444361f, 0.250209719f},
-std::array<float,2>{0.631404221f, 0.775406539f},
-std::array<float,2>{0.26726684f, 0.947020531f},
-std::array<float,2>{0.575859964f, 0.46352607f},
-std::array<float,2>{0.0110645639f, 0.176557437f},
-std::array<float,2>{0.889460862f, 0.703846514f},
-std::array<float,2>{0.450133383f, 0.569319129f},
-std::array<float,2>{0.727021635f, 0.0599117167f},
-std::array<float,2>{0.195570484f, 0.31267038f},
-std::array<float,2>{0.854136109f, 0.846224368f},
-std::array<float,2>{0.0779317841f, 0.895576894f},
-std::array<float,2>{0.946247041f, 0.386912644f},
-std::array<float,2>{0.319040835f, 0.219782427f},
-std::array<float,2>{0.557678938f, 0.653223753f},
-std::array<float,2>{0.135041058f, 0.716362178f},
-std::array<float,2>{0.785103381f, 0.1816407f},
-std::array<float,2>{0.425284803f, 0.457140595f},
-std::array<float,2>{0.66195637f, 0.938940823f},
-std::array<float,2>{0.296532482f, 0.772015214f},
-std::array<float,2>{0.609707296f, 0.263473988f},
-std::array<float,2>{0.0497889258f, 0.120118938f},
-std::array<float,2>{0.931647241f, 0.545041382f},
-std::array<float,2>{0.355975777f, 0.669024646f},
-std::array<float,2>{0.521890163f, 0.210499391f},
-std::array<float,2>{0.0956842825f, 0.426741958f},
-std::array<float,2>{0.975976765f, 0.914456606f},
-std::array<float,2>{0.221395269f, 0.830659688f},
-std::array<float,2>{0.814225614f, 0.359367937f},
-std::array<float,2>{0.471470207f, 0.00156179094f},
-std::array<float,2>{0.706430674f, 0.619960308f},
-std::array<float,2>{0.0050788261f, 0.527969897f},
-std::array<float,2>{0.879920602f, 0.0834830031f},
-std::array<float,2>{0.278493732f, 0.291530281f},
-std::array<float,2>{0.56320715f, 0.783789456f},
-std::array<float,2>{0.38392362f, 0.982613325f},
-std::array<float,2>{0.633028269f, 0.495478898f},
-std::array<float,2>{0.170997739f, 0.140204474f},
-std::array<float,2>{0.774948239f, 0.727708399f},
-std::array<float,2>{0.257234395f, 0.558277071f},
-std::array<float,2>{0.580392361f, 0.0944098383f},
-std::array<float,2>{0.0216659345f, 0.265702963f},
-std::array<float,2>{0.891029954f, 0.75126332f},
-std::array<float,2>{0.17413187f, 0.965729117f},
-std::array<float,2>{0.757126272f, 0.439822465f},
-std::array<float,2>{0.392005235f, 0.158183634f},
-std::array<float,2>{0.652766049f, 0.68987149f},
-std::array<float,2>{0.121031374f, 0.629110634f},
-std::array<float,2>{0.985621929f, 0.249531731f},
-std::array<float,2>{0.364219993f, 0.391291738f},
-std::array<float,2>{0.500045717f, 0.883961439f},
-std::array<float,2>{0.497674942f, 0.867620289f},
-std::array<float,2>{0.688688695f, 0.339482099f},
-std::array<float,2>{0.234752968f, 0.0382623374f},
-std::array<float,2>{0.835554481f, 0.58590591f},
-std::array<float,2>{0.411651999f, 0.748423755f},
-std::array<float,2>{0.682093918f, 0.151592761f},
-std::array<float,2>{0.154904112f, 0.471703708f},
-std::array<float,2>{0.807417989f, 0.991107285f},
-std::array<float,2>{0.0445335284f, 0.802646995f},
-std::array<float,2>{0.921484828f, 0.306127548f},
-std::array<float,2>{0.306994945f, 0.0692145452f},
-std::array<float,2>{0.605415046f, 0.513201237f},
-std::array<float,2>{0.217169449f, 0.599707246f},
-std::array<float,2>{0.860208333f, 0.0227427799f},
-std::array<float,2>{0.465583563f, 0.364484251f},
-std::array<float,2>{0.737664402f, 0.815583348f},
-std::array<float,2>{0.330551207f, 0.930998802f},
-std::array<float,2>{0.539323211f, 0.40951106f},
-std::array<float,2>{0.0898263678f, 0.197227865f},
-std::array<float,2>{0.962279558f, 0.679247141f},
-std::array<float,2>{0.406384051f, 0.574117899f},
-std::array<float,2>{0.685579121f, 0.0543112867f},
-std::array<float,2>{0.150276035f, 0.32150948f},
-std::array<float,2>{0.810441613f, 0.852474749f},
-std::array<float,2>{0.0426787362f, 0.901274204f},
-std::array<float,2>{0.915568352f, 0.38111788f},
-std::array<float,2>{0.311256677f, 0.22890301f},
-std::array<float,2>{0.608751714f, 0.645264328f},
-std::array<float,2>{0.213223159f, 0.710618019f},
-std::array<float,2>{0.864588737f, 0.17363739f},
-std::array<float,2>{0.463926435f, 0.468170196f},
-std::array<float,2>{0.738375843f, 0.952883959f},
-std::array<float,2>{0.335450798f, 0.78100884f},
-std::array<float,2>{0.544158876f, 0.255239099f},
-std::array<float,2>{0.0920546949f, 0.116702817f},
-std::array<float,2>{0.964867234f, 0.53162384f},
-std::array<float,2>{0.253563076f, 0.663149953f},
-std::array<float,2>{0.582190394f, 0.215123415f},
-std::array<float,2>{0.0180201381f, 0.429914296f},
-std::array<float,2>{0.89589113f, 0.910973966f},
-std::array<float,2>{0.17614384f, 0.839539707f},
-std::array<float,2>{0.753378153f, 0.346896917f},
-std::array<float,2>{0.396901965f, 0.0131528508f},
-std::array<float,2>{0.649588287f, 0.614370763f},
-std::array<float,2>{0.123769484f, 0.521069288f},
-std::array<float,2>{0.989733875f, 0.090417251f},
-std::array<float,2>{0.361902922f, 0.284844458f},
-std::array<float,2>{0.503966153f, 0.796102107f},
-std::array<float,2>{0.495765626f, 0.975793123f},
-std::array<float,2>{0.692471206f, 0.490765005f},
-std::array<float,2>{0.24016045f, 0.125330046f},
-std::array<float,2>{0.830132604f, 0.72135359f},
-std::array<float,2>{0.352010697f, 0.551181674f},
-std::array<float,2>{0.518042147f, 0.106817894f},
-std::array<float,2>{0.100904122f, 0.279095203f},
-std::array<float,2>{0.970319569f, 0.762329817f},
-std::array<float,2>{0.224966377f, 0.960515141f},
-std::array<float,2>{0.81659615f, 0.4455733f},
-std::array<float,2>{0.473162413f, 0.165751457f},
-std::array<float,2>{0.708734035f, 0.701514542f},
-std::array<float,2>{0.0017926608f, 0.638203442f},
-std::array<float,2>{0.876736403f, 0.236257717f},
-std::array<float,2>{0.275784731f, 0.405033737f},
-std::array<float,2>{0.566499352f, 0.875549138f},
-std::array<float,2>{0.387663215f, 0.8612234f},
-std::array<float,2>{0.639061034f, 0.334445328f},
-std::array<float,2>{0.166765377f, 0.0402173623f},
-std::array<float,2>{0.781142533f, 0.587677479f},
-std::array<float,2>{0.44588992f, 0.737864554f},
-std::array<float,2>{0.731534183f, 0.147100255f},
-std::array<float,2>{0.200717896f, 0.480891347f},
-std::array<float,2>{0.858862936f, 0.997015119f},
-std::array<float,2>{0.0723816082f, 0.806779802f},
-std::array<float,2>{0.951012731f, 0.298936546f},
-std::array<float,2>{0.313561887f, 0.0730412677f},
-std::array<float,2>{0.559219718f, 0.50100106f},
-std::array<float,2>{0.137992963f, 0.602604508f},
-std::array<float,2>{0.787800133f, 0.0241004489f},
-std::array<float,2>{0.42831555f, 0.371963859f},
-std::array<float,2>{0.657945693f, 0.823536873f},
-std::array<float,2>{0.289757997f, 0.926115096f},
-std::array<float,2>{0.61523062f, 0.415409118f},
-std::array<float,2>{0.0518543534f, 0.18847695f},
-std::array<float,2>{0.936935365f, 0.681831241f},
-std::array<float,2>{0.480491281f, 0.509239376f},
-std::array<float,2>{0.713603139f, 0.0654737577f},
-std::array<float,2>{0.234278679f, 0.30989939f},
-std::array<float,2>{0.824033976f, 0.797245443f},
-std::array<float,2>{0.104358152f, 0.984800458f},
-std::array<float,2>{0.979777694f, 0.473249137f},
-std::array<float,2>{0.348283976f, 0.153753757f},
-std::array<float,2>{0.53104037f, 0.744000673f},
-std::array<float,2>{0.158838913f, 0.675741136f},
-std::array<float,2>{0.769026816f, 0.202594534f},
-std::array<float,2>{0.378204525f, 0.412931561f},
-std::array<float,2>{0.628143668f, 0.933844864f},
-std::array<float,2>{0.272105604f, 0.819880009f},
-std::array<float,2>{0.571320653f, 0.362064451f},
-std::array<float,2>{0.0141751012f, 0.0165272653f},
-std::array<float,2>{0.883179307f, 0.595932305f},
-std::array<float,2>{0.321481198f, 0.69387275f},
-std::array<float,2>{0.547604501f, 0.163627654f},
-std::array<float,2>{0.0656325966f, 0.444117993f},
-std::array<float,2>{0.944176793f, 0.964776099f},
-std::array<float,2>{0.188412309f, 0.756797373f},
-std::array<float,2>{0.844837368f, 0.271105021f},
-std::array<float,2>{0.439851165f, 0.098541379f},
-std::array<float,2>{0.719093621f, 0.560779572f},
-std::array<float,2>{0.0606130175f, 0.581843853f},
-std::array<float,2>{0.921879768f, 0.0341933966f},
-std::array<float,2>{0.28527233f, 0.341237277f},
-std::array<float,2>{0.619084656f, 0.873649418f},
-std::array<float,2>{0.430163711f, 0.890002072f},
-std::array<float,2>{0.66660738f, 0.39834094f},
-std::array<float,2>{0.131185114f, 0.244530722f},
-std::array<float,2>{0.793695927f, 0.625097036f},
-std::array<float,2>{0.304079741f, 0.622548103f},
-std::array<float,2>{0.60004735f, 0.00542477006f},
-std::array<float,2>{0.0371785685f, 0.352586329f},
-std::array<float,2>{0.910790622f, 0.835514128f},
-std::array<float,2>{0.144304127f, 0.920334876f},
-std::array<float,2>{0.798666775f, 0.423772186f},
-std::array<float,2>{0.417206526f, 0.203373045f},
-std::array<float,2>{0.674680293f, 0.665575922f},
-std::array<float,2>{0.0798654035f, 0.734214783f},
-std::array<float,2>{0.953540802f, 0.135037377f},
-std::array<float,2>{0.341173589f, 0.499660432f},
-std::array<float,2>{0.535027444f, 0.977222979f},
-std::array<float,2>{0.457396805f, 0.787886083f},
-std::array<float,2>{0.748702884f, 0.296254039f},
-std::array<float,2>{0.210536793f, 0.080439426f},
-std::array<float,2>{0.871133506f, 0.524176598f},
-std::array<float,2>{0.404378474f, 0.65073967f},
-std::array<float,2>{0.647488296f, 0.226231024f},
-std::array<float,2>{0.182691202f, 0.384634644f},
-std::array<float,2>{0.75804919f, 0.893740356f},
-std::array<float,2>{0.0242849011f, 0.84857291f},
-std::array<float,2>{0.905290902f, 0.317812443f},
-std::array<float,2>{0.262305111f, 0.0560547262f},
-std::array<float,2>{0.589719117f, 0.564839244f},
-std::array<float,2>{0.249277025f, 0.540249169f},
-std::array<float,2>{0.837178648f, 0.121591948f},
-std::array<float,2>{0.491909206f, 0.260087639f},
-std::array<float,2>{0.702878296f, 0.767417848f},
-std::array<float,2>{0.370382875f, 0.941826344f},
-std::array<float,2>{0.513524294f, 0.456929415f},
-std::array<float,2>{0.114893422f, 0.185589701f},
-std::array<float,2>{0.995997608f, 0.711365759f},
-std::array<float,2>{0.380402923f, 0.538868606f},
-std::array<float,2>{0.632620811f, 0.11320173f},
-std::array<float,2>{0.162165195f, 0.253456652f},
-std::array<float,2>{0.771050155f, 0.775055289f},
-std::array<float,2>{0.0100405738f, 0.94891727f},
-std::array<float,2>{0.890345097f, 0.462051481f},
-std::array<float,2>{0.266229838f, 0.179498062f},
-std::array<float,2>{0.575149298f, 0.706086397f},
-std::array<float,2>{0.228944898f, 0.642723441f},
-std::array<float,2>{0.825484633f, 0.233023226f},
-std::array<float,2>{0.479829729f, 0.375190496f},
-std::array<float,2>{0.717914879f, 0.905317485f},
-std::array<float,2>{0.345410913f, 0.856896877f},
-std::array<float,2>{0.523617387f, 0.324647099f},
-std::array<float,2>{0.108606696f, 0.0501350611f},
-std::array<float,2>{0.981417835f, 0.57795161f},
-std::array<float,2>{0.2813164f, 0.725122213f},
-std::array<float,2>{0.623630166f, 0.129911423f},
-std::array<float,2>{0.056439057f, 0.48511824f},
-std::array<float,2>{0.927947342f, 0.970058322f},
-std::array<float,2>{0.127776816f, 0.791009188f},
-std::array<float,2>{0.791010976f, 0.285394013f},
-std::array<float,2>{0.434331894f, 0.0879130289f},
-std::array<float,2>{0.669819534f, 0.517416418f},
-std::array<float,2>{0.0694209933f, 0.611151278f},
-std::array<float,2>{0.938895643f, 0.011258455f},
-std::array<float,2>{0.326069653f, 0.348435134f},
-std::array<float,2>{0.55266881f, 0.843601823f},
-std::array<float,2>{0.443344355f, 0.906431377f},
-std::array<float,2>{0.722954392f, 0.434223652f},
-std::array<float,2>{0.191639453f, 0.214541078f},
-std::array<float,2>{0.848355472f, 0.65832901f},
-std::array<float,2>{0.337680012f, 0.593702912f},
-std::array<float,2>{0.538451374f, 0.0443445332f},
-std::array<float,2>{0.0840602964f, 0.331180423f},
-std::array<float,2>{0.959446669f, 0.864162803f},
-std::array<float,2>{0.206687063f, 0.879426301f},
-std::array<float,2>{0.868226409f, 0.398709923f},
-std::array<float,2>{0.454943448f, 0.240163922f},
-std::array<float,2>{0.746004343f, 0.635478854f},
-std::array<float,2>{0.0334560499f, 0.698169231f},
-std::array<float,2>{0.909013271f, 0.168445602f},
-std::array<float,2>{0.297511816f, 0.452297479f},
-std::array<float,2>{0.593910336f, 0.956716657f},
-std::array<float,2>{0.418614119f, 0.75951457f},
-std::array<float,2>{0.678187907f, 0.276503235f},
-std::array<float,2>{0.146024823f, 0.102214985f},
-std::array<float,2>{0.803658068f, 0.548943281f},
-std::array<float,2>{0.487236142f, 0.686557114f},
-std::array<float,2>{0.695413947f, 0.193080902f},
-std::array<float,2>{0.245837122f, 0.419690371f},
-std::array<float,2>{0.843583047f, 0.922928333f},
-std::array<float,2>{0.112576306f, 0.824876189f},
-std::array<float,2>{0.998701274f, 0.367968559f},
-std::array<float,2>{0.372658908f, 0.0295416471f},
-std::array<float,2>{0.508361578f, 0.607190609f},
-std::array<float,2>{0.184076607f, 0.504020751f},
-std::array<float,2>{0.762010574f, 0.0752947256f},
-std::array<float,2>{0.400408089f, 0.303500712f},
-std::array<float,2>{0.643972754f, 0.810369432f},
-std::array<float,2>{0.258842766f, 0.994143069f},
-std::array<float,2>{0.592400372f, 0.479266554f},
-std::array<float,2>{0.028352268f, 0.143915713f},
-std::array<float,2>{0.902015805f, 0.741453171f},
-std::array<float,2>{0.466739118f, 0.598470926f},
-std::array<float,2>{0.736455202f, 0.0196391009f},
-std::array<float,2>{0.217966497f, 0.366452694f},
-std::array<float,2>{0.860705197f, 0.812671602f},
-std::array<float,2>{0.0879062116f, 0.931967795f},
-std::array<float,2>{0.961216867f, 0.407011092f},
-std::array<float,2>{0.331213623f, 0.198869497f},
-std::array<float,2>{0.540586948f, 0.677370846f},
-std::array<float,2>{0.15615201f, 0.747224033f},
-std::array<float,2>{0.807808578f, 0.149823174f},
-std::array<float,2>{0.411070585f, 0.469822466f},
-std::array<float,2>{0.682951033f, 0.98929292f},
-std::array<float,2>{0.307946622f, 0.8035357f},
-std::array<float,2>{0.604477465f, 0.3079606f},
-std::array<float,2>{0.0434800163f, 0.0679581165f},
-std::array<float,2>{0.919966996f, 0.513972819f},
-std::array<float,2>{0.365070581f, 0.632665694f},
-std::array<float,2>{0.501476109f, 0.247623414f},
-std::array<float,2>{0.119730905f, 0.392590463f},
-std::array<float,2>{0.985094726f, 0.885239244f},
-std::array<float,2>{0.235761151f, 0.869358778f},
-std::array<float,2>{0.834331095f, 0.337748319f},
-std::array<float,2>{0.496613264f, 0.0357689112f},
-std::array<float,2>{0.687996387f, 0.582602203f},
-std::array<float,2>{0.0228974205f, 0.556555808f},
-std::array<float,2>{0.891611755f, 0.0961580947f},
-std::array<float,2>{0.256562918f, 0.267765701f},
-std::array<float,2>{0.581617713f, 0.753243029f},
-std::array<float,2>{0.391072482f, 0.967058599f},
-std::array<float,2>{0.653625906f, 0.439409584f},
-std::array<float,2>{0.175585762f, 0.158730328f},
-std::array<float,2>{0.756381571f, 0.688526809f},
-std::array<float,2>{0.278074443f, 0.529864132f},
-std::array<float,2>{0.564432144f, 0.0856354758f},
-std::array<float,2>{0.00415280089f, 0.289524406f},
-std::array<float,2>{0.879762948f, 0.782622516f},
-std::array<float,2>{0.170387536f, 0.981938601f},
-std::array<float,2>{0.773589253f, 0.492229968f},
-std::array<float,2>{0.38300845f, 0.138386622f},
-std::array<float,2>{0.63399452f, 0.729935467f},
-std::array<float,2>{0.0941334888f, 0.669948757f},
-std::array<float,2>{0.97492671f, 0.208520368f},
-std::array<float,2>{0.356484294f, 0.429474711f},
-std::array<float,2>{0.522928715f, 0.917486072f},
-std::array<float,2>{0.472297192f, 0.829452455f},
-std::array<float,2>{0.705192685f, 0.355703056f},
-std::array<float,2>{0.222076714f, 0.00385058182f},
-std::array<float,2>{0.81346947f, 0.617451787f},
-std::array<float,2>{0.423968881f, 0.717814744f},
-std::array<float,2>{0.66064769f, 0.180543751f},
-std::array<float,2>{0.136365667f, 0.459596753f},
-std::array<float,2>{0.7837888f, 0.939458966f},
-std::array<float,2>{0.0504570901f, 0.771441519f},
-std::array<float,2>{0.932714045f, 0.264197886f},
-std::array<float,2>{0.295131564f, 0.118745804f},
-std::array<float,2>{0.61118567f, 0.544030964f},
-std::array<float,2>{0.197172076f, 0.566727042f},
-std::array<float,2>{0.854510188f, 0.0615575761f},
-std::array<float,2>{0.45092997f, 0.315044373f},
-std::array<float,2>{0.728487253f, 0.845041096f},
-std::array<float,2>{0.319728941f, 0.897744119f},
-std::array<float,2>{0.556672275f, 0.389028311f},
-std::array<float,2>{0.0766443983f, 0.221213549f},
-std::array<float,2>{0.947089136f, 0.655679584f},
-std::array<float,2>{0.39469257f, 0.615589082f},
-std::array<float,2>{0.651507556f, 0.0141862584f},
-std::array<float,2>{0.179627076f, 0.344603032f},
-std::array<float,2>{0.750651896f, 0.837716699f},
-std::array<float,2>{0.0158619601f, 0.912787259f},
-std::array<float,2>{0.898318291f, 0.432581156f},
-std::array<float,2>{0.251254588f, 0.218386427f},
-std::array<float,2>{0.58574456f, 0.661509752f},
-std::array<float,2>{0.241815016f, 0.720412612f},
-std::array<float,2>{0.830029964f, 0.128564462f},
-std::array<float,2>{0.494035095f, 0.48922658f},
-std::array<float,2>{0.694039285f, 0.972695529f},
-std::array<float,2>{0.360715896f, 0.79410553f},
-std::array<float,2>{0.507329166f, 0.282077163f},
-std::array<float,2>{0.122513399f, 0.0934231207f},
-std::array<float,2>{0.990338206f, 0.523418725f},
-std::array<float,2>{0.309542656f, 0.646670997f},
-std::array<float,2>{0.605697453f, 0.228439257f},
-std::array<float,2>{0.0393991359f, 0.38046205f},
-std::array<float,2>{0.917336524f, 0.899317324f},
-std::array<float,2>{0.151148334f, 0.855181813f},
-std::array<float,2>{0.810713947f, 0.324115813f},
-std::array<float,2>{0.409564734f, 0.0509975366f},
-std::array<float,2>{0.684082627f, 0.570670068f},
-std::array<float,2>{0.0917720869f, 0.534742296f},
-std::array<float,2>{0.968049943f, 0.114784129f},
-std::array<float,2>{0.333944261f, 0.256290466f},
-std::array<float,2>{0.545479178f, 0.777876318f},
-std::array<float,2>{0.461410046f, 0.949401796f},
-std::array<float,2>{0.741106331f, 0.466580838f},
-std::array<float,2>{0.211674526f, 0.174280867f},
-std::array<float,2>{0.865924001f, 0.708957851f},
-std::array<float,2>{0.315541446f, 0.50216502f},
-std::array<float,2>{0.561923265f, 0.0720387772f},
-std::array<float,2>{0.0715384781f, 0.29822585f},
-std::array<float,2>{0.951610327f, 0.804943562f},
-std::array<float,2>{0.202548832f, 0.998472154f},
-std::array<float,2>{0.855870962f, 0.483252108f},
-std::array<float,2>{0.448435396f, 0.144828409f},
-std::array<float,2>{0.733676493f, 0.734613597f},
-std::array<float,2>{0.054463435f, 0.680301666f},
-std::array<float,2>{0.934351683f, 0.190925345f},
-std::array<float,2>{0.291833818f, 0.417483807f},
-std::array<float,2>{0.616292715f, 0.929550707f},
-std::array<float,2>{0.427641273f, 0.821483374f},
-std::array<float,2>{0.659317613f, 0.374289542f},
-std::array<float,2>{0.139896512f, 0.0271572135f},
-std::array<float,2>{0.786934793f, 0.605164766f},
-std::array<float,2>{0.474934518f, 0.700983942f},
-std::array<float,2>{0.710722566f, 0.166593716f},
-std::array<float,2>{0.223100126f, 0.448602438f},
-std::array<float,2>{0.819463611f, 0.957309723f},
-std::array<float,2>{0.0989771336f, 0.764740586f},
-std::array<float,2>{0.971929312f, 0.279449195f},
-std::array<float,2>{0.355260283f, 0.108810656f},
-std::array<float,2>{0.516785443f, 0.553079844f},
-std::array<float,2>{0.164301693f, 0.588192046f},
-std::array<float,2>{0.778259754f, 0.0420996584f},
-std::array<float,2>{0.389164388f, 0.332827985f},
-std::array<float,2>{0.63866961f, 0.861986876f},
-std::array<float,2>{0.274009854f, 0.877334297f},
-std::array<float,2>{0.569674313f, 0.404129565f},
-std::array<float,2>{0.00305391196f, 0.23678349f},
-std::array<float,2>{0.877383351f, 0.639356852f},
-std::array<float,2>{0.43790856f, 0.559351325f},
-std::array<float,2>{0.721869767f, 0.101001836f},
-std::array<float,2>{0.190055236f, 0.27194801f},
-std::array<float,2>{0.847575068f, 0.755610704f},
-std::array<float,2>{0.0643061474f, 0.96231389f},
-std::array<float,2>{0.94300586f, 0.441791207f},
-std::array<float,2>{0.323941201f, 0.160396367f},
-std::array<float,2>{0.549293816f, 0.691476107f},
-std::array<float,2>{0.130225882f, 0.626989543f},
-std::array<float,2>{0.796594977f, 0.242310926f},
-std::array<float,2>{0.431817681f, 0.395348907f},
-std::array<float,2>{0.664817929f, 0.888336241f},
-std::array<float,2>{0.287726074f, 0.872331798f},
-std::array<float,2>{0.620973647f, 0.34336853f},
-std::array<float,2>{0.0588896088f, 0.0318809189f},
-std::array<float,2>{0.925218165f, 0.579243243f},
-std::array<float,2>{0.351505816f, 0.744268477f},
-std::array<float,2>{0.528346539f, 0.154718116f},
-std::array<float,2>{0.102985367f, 0.475104123f},
-std::array<float,2>{0.977753103f, 0.98646152f},
-std::array<float,2>{0.232148916f, 0.800686538f},
-std::array<float,2>{0.820412397f, 0.311027229f},
-std::array<float,2>{0.483633816f, 0.0632982105f},
-std::array<float,2>{0.711504281f, 0.510073841f},
-std::array<float,2>{0.0123392036f, 0.594925046f},
-std::array<float,2>{0.88579607f, 0.0189331472f},
-std::array<float,2>{0.270782709f, 0.360928029f},
-std::array<float,2>{0.572946429f, 0.818316042f},
-std::array<float,2>{0.376691699f, 0.935803652f},
-std::array<float,2>{0.626067042f, 0.410520196f},
-std::array<float,2>{0.157797813f, 0.200775802f},
-std::array<float,2>{0.767387569f, 0.673680007f},
-std::array<float,2>{0.264016211f, 0.562681079f},
-std::array<float,2>{0.587834895f, 0.056804914f},
-std::array<float,2>{0.026353322f, 0.318361998f},
-std::array<float,2>{0.902716875f, 0.851453125f},
-std::array<float,2>{0.180986673f, 0.892504692f},
-std::array<float,2>{0.760075271f, 0.386349857f},
-std::array<float,2>{0.403495967f, 0.223754406f},
-std::array<float,2>{0.644553721f, 0.648641229f},
-std::array<float,2>{0.116632141f, 0.713342547f},
-std::array<float,2>{0.992194235f, 0.183751747f},
-std::array<float,2>{0.368561745f, 0.453497112f},
-std::array<float,2>{0.514893651f, 0.943502367f},
-std::array<float,2>{0.490137547f, 0.768906593f},
-std::array<float,2>{0.700826049f, 0.258223921f},
-std::array<float,2>{0.246813104f, 0.12424349f},
-std::array<float,2>{0.838794768f, 0.542757094f},
-std::array<float,2>{0.415766001f, 0.667584896f},
-std::array<float,2>{0.672332466f, 0.206211582f},
-std::array<float,2>{0.142525986f, 0.425673574f},
-std::array<float,2>{0.800333023f, 0.919415236f},
-std::array<float,2>{0.0369122215f, 0.832387626f},
-std::array<float,2>{0.912283957f, 0.353938848f},
-std::array<float,2>{0.301846415f, 0.00705776783f},
-std::array<float,2>{0.598395109f, 0.623880565f},
-std::array<float,2>{0.207227871f, 0.526103556f},
-std::array<float,2>{0.873871922f, 0.0790129527f},
-std::array<float,2>{0.460846245f, 0.293153524f},
-std::array<float,2>{0.747911334f, 0.786267519f},
-std::array<float,2>{0.342650324f, 0.978574276f},
-std::array<float,2>{0.53158319f, 0.497342944f},
-std::array<float,2>{0.0806172639f, 0.132837832f},
-std::array<float,2>{0.956433535f, 0.730710864f},
-std::array<float,2>{0.436160117f, 0.519477665f},
-std::array<float,2>{0.671108961f, 0.0863050446f},
-std::array<float,2>{0.125589997f, 0.287829816f},
-std::array<float,2>{0.791061997f, 0.792102993f},
-std::array<float,2>{0.0570816286f, 0.972592354f},
-std::array<float,2>{0.927297354f, 0.486355782f},
-std::array<float,2>{0.283799738f, 0.132766843f},
-std::array<float,2>{0.622861981f, 0.723114789f},
-std::array<float,2>{0.193396628f, 0.657417238f},
-std::array<float,2>{0.850258708f, 0.212643176f},
-std::array<float,2>{0.444590747f, 0.435848981f},
-std::array<float,2>{0.72647959f, 0.908941686f},
-std::array<float,2>{0.327323496f, 0.840873837f},
-std::array<float,2>{0.553712606f, 0.350392252f},
-std::array<float,2>{0.0672073513f, 0.00793647952f},
-std::array<float,2>{0.940143108f, 0.612089932f},
-std::array<float,2>{0.267936796f, 0.704725087f},
-std::array<float,2>{0.577926159f, 0.177411884f},
-std::array<float,2>{0.00869847089f, 0.46476692f},
-std::array<float,2>{0.887465775f, 0.945642292f},
-std::array<float,2>{0.160819203f, 0.776789486f},
-std::array<float,2>{0.77264148f, 0.25158754f},
-std::array<float,2>{0.382763594f, 0.111103415f},
-std::array<float,2>{0.629938006f, 0.535578787f},
-std::array<float,2>{0.107237302f, 0.575836957f},
-std::array<float,2>{0.984051406f, 0.0473256558f},
-std::array<float,2>{0.346190214f, 0.327891648f},
-std::array<float,2>{0.527061582f, 0.859111845f},
-std::array<float,2>{0.477662355f, 0.902470887f},
-std::array<float,2>{0.715730071f, 0.377991349f},
-std::array<float,2>{0.227441192f, 0.231683373f},
-std::array<float,2>{0.826721728f, 0.641731262f},
-std::array<float,2>{0.373488396f, 0.607573092f},
-std::array<float,2>{0.510531604f, 0.0283648167f},
-std::array<float,2>{0.11071045f, 0.370439589f},
-std::array<float,2>{0.996377766f, 0.827372372f},
-std::array<float,2>{0.242702782f, 0.925641179f},
-std::array<float,2>{0.840406656f, 0.420981616f},
-std::array<float,2>{0.484426796f, 0.194694206f},
-std::array<float,2>{0.69771874f, 0.684176385f},
-std::array<float,2>{0.0301245973f, 0.739457726f},
-std::array<float,2>{0.898540795f, 0.141604096f},
-std::array<float,2>{0.260956734f, 0.476904064f},
-std::array<float,2>{0.591465652f, 0.993065357f},
-std::array<float,2>{0.399969727f, 0.811662614f},
-std::array<float,2>{0.640911043f, 0.30105263f},
-std::array<float,2>{0.186269149f, 0.0762961805f},
-std::array<float,2>{0.765597522f, 0.507181525f},
-std::array<float,2>{0.45651114f, 0.634246469f},
-std::array<float,2>{0.743495703f, 0.241384447f},
-std::array<float,2>{0.204083174f, 0.401054233f},
-std::array<float,2>{0.869944692f, 0.88255316f},
-std::array<float,2>{0.0833359361f, 0.86533612f},
-std::array<float,2>{0.957150161f, 0.328243941f},
-std::array<float,2>{0.33818841f, 0.0450942628f},
-std::array<float,2>{0.536234736f, 0.589918137f},
-std::array<float,2>{0.146769434f, 0.547291517f},
-std::array<float,2>{0.801692724f, 0.104525246f},
-std::array<float,2>{0.420203239f, 0.273447216f},
-std::array<float,2>{0.676925957f, 0.760602295f},
-std::array<float,2>{0.299700826f, 0.954901218f},
-std::array<float,2>{0.596590936f, 0.449406087f},
-std::array<float,2>{0.0329204984f, 0.171726763f},
-std::array<float,2>{0.907733381f, 0.696386993f},
-std::array<float,2>{0.499420673f, 0.584567428f},
-std::array<float,2>{0.690345287f, 0.0380143858f},
-std::array<float,2>{0.236629218f, 0.337956369f},
-std::array<float,2>{0.833444595f, 0.868785262f},
-std::array<float,2>{0.118989266f, 0.883669257f},
-std::array<float,2>{0.986713588f, 0.392243594f},
-std::array<float,2>{0.367109209f, 0.248553529f},
-std::array<float,2>{0.503394663f, 0.63005197f},
-std::array<float,2>{0.173174694f, 0.690862894f},
-std::array<float,2>{0.754107893f, 0.157055035f},
-std::array<float,2>{0.393081993f, 0.440613538f},
-std::array<float,2>{0.654345155f, 0.966211081f},
-std::array<float,2>{0.254813462f, 0.75018698f},
-std::array<float,2>{0.579858899f, 0.267352194f},
-std::array<float,2>{0.0203353744f, 0.0949146152f},
-std::array<float,2>{0.893717706f, 0.557289958f},
-std::array<float,2>{0.329584926f, 0.678295493f},
-std::array<float,2>{0.5416978f, 0.195757285f},
-std::array<float,2>{0.0861115381f, 0.408866554f},
-std::array<float,2>{0.964189291f, 0.930324852f},
-std::array<float,2>{0.215113804f, 0.815239072f},
-std::array<float,2>{0.862829328f, 0.363633841f},
-std::array<float,2>{0.467512339f, 0.0222045407f},
-std::array<float,2>{0.734648168f, 0.600710809f},
-std::array<float,2>{0.0461263619f, 0.512473822f},
-std::array<float,2>{0.918094814f, 0.0696118772f},
-std::array<float,2>{0.305348843f, 0.305196375f},
-std::array<float,2>{0.60197854f, 0.801757336f},
-std::array<float,2>{0.41370216f, 0.991656721f},
-std::array<float,2>{0.680638075f, 0.470958769f},
-std::array<float,2>{0.153366566f, 0.151225984f},
-std::array<float,2>{0.806042075f, 0.749387145f},
-std::array<float,2>{0.293659776f, 0.546226203f},
-std::array<float,2>{0.612208366f, 0.119965412f},
-std::array<float,2>{0.0482895039f, 0.262245357f},
-std::array<float,2>{0.931453407f, 0.773244739f},
-std::array<float,2>{0.133601263f, 0.93791765f},
-std::array<float,2>{0.782425046f, 0.458363712f},
-std::array<float,2>{0.423369944f, 0.18287766f},
-std::array<float,2>{0.663783908f, 0.715665758f},
-std::array<float,2>{0.0757674351f, 0.65365237f},
-std::array<float,2>{0.948376477f, 0.219685063f},
-std::array<float,2>{0.317652404f, 0.387705147f},
-std::array<float,2>{0.556427956f, 0.895039797f},
-std::array<float,2>{0.45200932f, 0.84752506f},
-std::array<float,2>{0.728818774f, 0.313535422f},
-std::array<float,2>{0.198111057f, 0.0593140125f},
-std::array<float,2>{0.8525424f, 0.569534242f},
-std::array<float,2>{0.385971814f, 0.727328241f},
-std::array<float,2>{0.636065125f, 0.13869895f},
-std::array<float,2>{0.169345945f, 0.494931608f},
-std::array<float,2>{0.77561605f, 0.983791232f},
-std::array<float,2>{0.00741121778f, 0.784869432f},
-std::array<float,2>{0.881484926f, 0.292448521f},
-std::array<float,2>{0.280565739f, 0.0822842866f},
-std::array<float,2>{0.566252589f, 0.528780162f},
-std::array<float,2>{0.220545024f, 0.620435655f},
-std::array<float,2>{0.815519571f, 0.000729564985f},
-std::array<float,2>{0.46941787f, 0.3577075f},
-std::array<float,2>{0.70441395f, 0.831505358f},
-std::array<float,2>{0.358673126f, 0.915979743f},
-std::array<float,2>{0.519994438f, 0.427314401f},
-std::array<float,2>{0.0970220864f, 0.209600195f},
-std::array<float,2>{0.972683907f, 0.668717623f},
-std::array<float,2>{0.4039267f, 0.565017462f},
-std::array<float,2>{0.6453982f, 0.0563807823f},
-std::array<float,2>{0.181260571f, 0.318319887f},
-std::array<float,2>{0.760707796f, 0.84778589f},
-std::array<float,2>{0.0257875826f, 0.894416928f},
-std::array<float,2>{0.903035939f, 0.383791387f},
-std::array<float,2>{0.264182925f, 0.225742906f},
-std::array<float,2>{0.587364376f, 0.651290715f},
-std::array<float,2>{0.246470064f, 0.711844265f},
-std::array<float,2>{0.838223815f, 0.186390892f},
-std::array<float,2>{0.489728332f, 0.456448197f},
-std::array<float,2>{0.700423837f, 0.941955209f},
-std::array<float,2>{0.368894666f, 0.766900957f},
-std::array<float,2>{0.515320957f, 0.260656267f},
-std::array<float,2>{0.116726808f, 0.121530905f},
-std::array<float,2>{0.992881f, 0.540785432f},
-std::array<float,2>{0.302302927f, 0.665223122f},
-std::array<float,2>{0.598076582f, 0.203670323f},
-std::array<float,2>{0.0364590995f, 0.423156857f},
-std::array<float,2>{0.912774086f, 0.920452058f},
-std::array<float,2>{0.142006725f, 0.8353526f},
-std::array<float,2>{0.800219655f, 0.353306234f},
-std::array<float,2>{0.415279329f, 0.00517679285f},
-std::array<float,2>{0.672553718f, 0.622759461f},
-std::array<float,2>{0.0801268816f, 0.52375114f},
-std::array<float,2>{0.956799388f, 0.0807693899f},
-std::array<float,2>{0.342067331f, 0.296464831f},
-std::array<float,2>{0.531938672f, 0.787499428f},
-std::array<float,2>{0.460125864f, 0.976685047f},
-std::array<float,2>{0.747534513f, 0.499305278f},
-std::array<float,2>{0.207701191f, 0.135482177f},
-std::array<float,2>{0.873384893f, 0.733539939f},
-std::array<float,2>{0.323308289f, 0.561392784f},
-std::array<float,2>{0.549783945f, 0.0977131575f},
-std::array<float,2>{0.0636318326f, 0.270995378f},
-std::array<float,2>{0.9426741f, 0.756008208f},
-std::array<float,2>{0.189679503f, 0.96387434f},
-std::array<float,2>{0.846935987f, 0.443754226f},
-std::array<float,2>{0.438408762f, 0.163431153f},
-std::array<float,2>{0.722527742f, 0.693379045f},
-std::array<float,2>{0.0592277944f, 0.625671506f},
-std::array<float,2>{0.925441444f, 0.244753629f},
-std::array<float,2>{0.287352949f, 0.397876769f},
-std::array<float,2>{0.620240629f, 0.89058876f},
-std::array<float,2>{0.432128906f, 0.873527586f},
-std::array<float,2>{0.664183915f, 0.341437399f},
-std::array<float,2>{0.130400255f, 0.0349865109f},
-std::array<float,2>{0.795999706f, 0.581540108f},
-std::array<float,2>{0.484359145f, 0.743420839f},
-std::array<float,2>{0.711288393f, 0.153896466f},
-std::array<float,2>{0.231810823f, 0.473080933f},
-std::array<float,2>{0.821276128f, 0.98493427f},
-std::array<float,2>{0.103200734f, 0.797652841f},
-std::array<float,2>{0.978340685f, 0.310219854f},
-std::array<float,2>{0.350884855f, 0.0660677329f},
-std::array<float,2>{0.528855979f, 0.509313226f},
-std::array<float,2>{0.157359481f, 0.596203327f},
-std::array<float,2>{0.766846418f, 0.0160615873f},
-std::array<float,2>{0.37622577f, 0.361644208f},
-std::array<float,2>{0.62656796f, 0.819701433f},
-std::array<float,2>{0.271132022f, 0.934529841f},
-std::array<float,2>{0.572744191f, 0.412351966f},
-std::array<float,2>{0.0118223615f, 0.203119174f},
-std::array<float,2>{0.88627404f, 0.675198138f},
-std::array<float,2>{0.449088424f, 0.501780748f},
-std::array<float,2>{0.734239101f, 0.0722867548f},
-std::array<float,2>{0.202643186f, 0.299326509f},
-std::array<float,2>{0.856237948f, 0.807216942f},
-std::array<float,2>{0.0721089616f, 0.996524274f},
-std::array<float,2>{0.951708019f, 0.481195062f},
-std::array<float,2>{0.316280812f, 0.146552637f},
-std::array<float,2>{0.562301159f, 0.737368882f},
-std::array<float,2>{0.140249789f, 0.682440758f},
-std::array<float,2>{0.786427796f, 0.189241529f},
-std::array<float,2>{0.427081555f, 0.415612936f},
-std::array<float,2>{0.659986198f, 0.926603317f},
-std::array<float,2>{0.291372001f, 0.823772132f},
-std::array<float,2>{0.617181897f, 0.37150231f},
-std::array<float,2>{0.0537966751f, 0.0237386096f},
-std::array<float,2>{0.933815479f, 0.603170753f},
-std::array<float,2>{0.354827881f, 0.701758087f},
-std::array<float,2>{0.517178893f, 0.165252402f},
-std::array<float,2>{0.0991665646f, 0.446065158f},
-std::array<float,2>{0.972296834f, 0.960202634f},
-std::array<float,2>{0.223262757f, 0.761976302f},
-std::array<float,2>{0.819911361f, 0.278439641f},
-std::array<float,2>{0.475272387f, 0.107343078f},
-std::array<float,2>{0.710020483f, 0.551460803f},
-std::array<float,2>{0.00382630387f, 0.587394774f},
-std::array<float,2>{0.877696395f, 0.0409876481f},
-std::array<float,2>{0.273502201f, 0.334785968f},
-std::array<float,2>{0.570038974f, 0.860462666f},
-std::array<float,2>{0.388700575f, 0.87519443f},
-std::array<float,2>{0.637716055f, 0.404365361f},
-std::array<float,2>{0.164899632f, 0.235644221f},
-std::array<float,2>{0.777681112f, 0.638094723f},
-std::array<float,2>{0.251770645f, 0.614973783f},
-std::array<float,2>{0.585238457f, 0.0134175792f},
-std::array<float,2>{0.0163385086f, 0.347521752f},
-std::array<float,2>{0.897861063f, 0.839119375f},
-std::array<float,2>{0.179124355f, 0.910333097f},
-std::array<float,2>{0.750304401f, 0.430543035f},
-std::array<float,2>{0.395319819f, 0.215765759f},
-std::array<float,2>{0.65232116f, 0.663663507f},
-std::array<float,2>{0.12286412f, 0.720917583f},
-std::array<float,2>{0.991041541f, 0.125755906f},
-std::array<float,2>{0.361117393f, 0.49026376f},
-std::array<float,2>{0.506970525f, 0.976421654f},
-std::array<float,2>{0.493650436f, 0.796460629f},
-std::array<float,2>{0.69346875f, 0.284179956f},
-std::array<float,2>{0.241664186f, 0.090240553f},
-std::array<float,2>{0.829323411f, 0.520609438f},
-std::array<float,2>{0.410020828f, 0.644901693f},
-std::array<float,2>{0.684055328f, 0.229454294f},
-std::array<float,2>{0.150482073f, 0.381431133f},
-std::array<float,2>{0.811185539f, 0.900672913f},
-std::array<float,2>{0.0396058708f, 0.851968527f},
-std::array<float,2>{0.917580426f, 0.322071433f},
-std::array<float,2>{0.309027225f, 0.0537460148f},
-std::array<float,2>{0.606064379f, 0.573371589f},
-std::array<float,2>{0.21119152f, 0.532166362f},
-std::array<float,2>{0.865606844f, 0.116603658f},
-std::array<float,2>{0.461720258f, 0.255427748f},
-std::array<float,2>{0.740607798f, 0.780623317f},
-std::array<float,2>{0.333181053f, 0.952593863f},
-std::array<float,2>{0.54531157f, 0.468288928f},
-std::array<float,2>{0.0908387527f, 0.172879219f},
-std::array<float,2>{0.968588352f, 0.710211873f},
-std::array<float,2>{0.423056006f, 0.544461191f},
-std::array<float,2>{0.663308918f, 0.118551247f},
-std::array<float,2>{0.132962704f, 0.264053881f},
-std::array<float,2>{0.783054948f, 0.770545781f},
-std::array<float,2>{0.0485442989f, 0.940323651f},
-std::array<float,2>{0.930673778f, 0.458986491f},
-std::array<float,2>{0.293004334f, 0.179712802f},
-std::array<float,2>{0.611515522f, 0.718691885f},
-std::array<float,2>{0.197690994f, 0.655787408f},
-std::array<float,2>{0.853325725f, 0.22117424f},
-std::array<float,2>{0.451563448f, 0.389250368f},
-std::array<float,2>{0.72912848f, 0.898349047f},
-std::array<float,2>{0.318016648f, 0.845281124f},
-std::array<float,2>{0.555797935f, 0.314595222f},
-std::array<float,2>{0.0753629133f, 0.0624839067f},
-std::array<float,2>{0.949184239f, 0.567118526f},
-std::array<float,2>{0.280807525f, 0.730406761f},
-std::array<float,2>{0.565788865f, 0.137927905f},
-std::array<float,2>{0.00718232384f, 0.493135303f},
-std::array<float,2>{0.881064773f, 0.981627762f},
-std::array<float,2>{0.169517606f, 0.783025801f},
-std::array<float,2>{0.775886416f, 0.289644331f},
-std::array<float,2>{0.386262715f, 0.0851620436f},
-std::array<float,2>{0.636333346f, 0.529550612f},
-std::array<float,2>{0.0972264037f, 0.618149698f},
-std::array<float,2>{0.973316908f, 0.00303824991f},
-std::array<float,2>{0.359315544f, 0.355987877f},
-std::array<float,2>{0.520033062f, 0.829888225f},
-std::array<float,2>{0.468827188f, 0.917299211f},
-std::array<float,2>{0.704610467f, 0.428801984f},
-std::array<float,2>{0.220173284f, 0.208215356f},
-std::array<float,2>{0.816068351f, 0.670871556f},
-std::array<float,2>{0.366301596f, 0.582195401f},
-std::array<float,2>{0.503633738f, 0.0354166403f},
-std::array<float,2>{0.118422002f, 0.337144673f},
-std::array<float,2>{0.987101972f, 0.870093048f},
-std::array<float,2>{0.23699373f, 0.885643244f},
-std::array<float,2>{0.83366549f, 0.393435776f},
-std::array<float,2>{0.499763846f, 0.247148708f},
-std::array<float,2>{0.689908862f, 0.632252991f},
-std::array<float,2>{0.0196360499f, 0.689170897f},
-std::array<float,2>{0.89424336f, 0.158555642f},
-std::array<float,2>{0.254310638f, 0.438920289f},
-std::array<float,2>{0.579208374f, 0.967664421f},
-std::array<float,2>{0.392984509f, 0.753667593f},
-std::array<float,2>{0.655263245f, 0.268086672f},
-std::array<float,2>{0.173794881f, 0.0963814631f},
-std::array<float,2>{0.754395068f, 0.556106806f},
-std::array<float,2>{0.467169493f, 0.677077532f},
-std::array<float,2>{0.734928727f, 0.198524937f},
-std::array<float,2>{0.215552092f, 0.406466156f},
-std::array<float,2>{0.862740815f, 0.932183027f},
-std::array<float,2>{0.0866458192f, 0.813417435f},
-std::array<float,2>{0.964671075f, 0.367030352f},
-std::array<float,2>{0.330064923f, 0.0203450844f},
-std::array<float,2>{0.541186273f, 0.598111808f},
-std::array<float,2>{0.153919771f, 0.514424086f},
-std::array<float,2>{0.806175649f, 0.0674648285f},
-std::array<float,2>{0.413227141f, 0.308383822f},
-std::array<float,2>{0.68002969f, 0.802918494f},
-std::array<float,2>{0.305005252f, 0.989859462f},
-std::array<float,2>{0.602368414f, 0.470634311f},
-std::array<float,2>{0.0465243682f, 0.150183231f},
-std::array<float,2>{0.918867886f, 0.74785006f},
-std::array<float,2>{0.485016793f, 0.606725335f},
-std::array<float,2>{0.697784781f, 0.0299052037f},
-std::array<float,2>{0.242585272f, 0.367415518f},
-std::array<float,2>{0.839969337f, 0.824656844f},
-std::array<float,2>{0.111303873f, 0.9234972f},
-std::array<float,2>{0.997060001f, 0.419179022f},
-std::array<float,2>{0.374011666f, 0.192727014f},
-std::array<float,2>{0.510000587f, 0.687052548f},
-std::array<float,2>{0.185990095f, 0.742152929f},
-std::array<float,2>{0.764872611f, 0.144295305f},
-std::array<float,2>{0.399873435f, 0.47888881f},
-std::array<float,2>{0.641315401f, 0.994732141f},
-std::array<float,2>{0.261296391f, 0.809845448f},
-std::array<float,2>{0.591057539f, 0.302742898f},
-std::array<float,2>{0.029337015f, 0.0757143795f},
-std::array<float,2>{0.899106562f, 0.504418314f},
-std::array<float,2>{0.338697374f, 0.635237277f},
-std::array<float,2>{0.536697567f, 0.239405409f},
-std::array<float,2>{0.0836335346f, 0.399052262f},
-std::array<float,2>{0.957725108f, 0.879081488f},
-std::array<float,2>{0.203367755f, 0.86337322f},
-std::array<float,2>{0.869519293f, 0.331741154f},
-std::array<float,2>{0.456981957f, 0.044583194f},
-std::array<float,2>{0.744006693f, 0.592855871f},
-std::array<float,2>{0.0325878076f, 0.549444556f},
-std::array<float,2>{0.907237411f, 0.101568215f},
-std::array<float,2>{0.299219549f, 0.277201623f},
-std::array<float,2>{0.59572953f, 0.7590487f},
-std::array<float,2>{0.42051357f, 0.95631808f},
-std::array<float,2>{0.677538693f, 0.452988535f},
-std::array<float,2>{0.147319496f, 0.168762043f},
-std::array<float,2>{0.801236808f, 0.69735235f},
-std::array<float,2>{0.283674002f, 0.517001212f},
-std::array<float,2>{0.622207344f, 0.0884701908f},
-std::array<float,2>{0.0575058647f, 0.286015481f},
-std::array<float,2>{0.926896691f, 0.790390193f},
-std::array<float,2>{0.125348613f, 0.970621228f},
-std::array<float,2>{0.791645885f, 0.484655648f},
-std::array<float,2>{0.435918361f, 0.130617559f},
-std::array<float,2>{0.671437085f, 0.725073814f},
-std::array<float,2>{0.0664814636f, 0.659135699f},
-std::array<float,2>{0.939657032f, 0.214331567f},
-std::array<float,2>{0.327988744f, 0.43405208f},
-std::array<float,2>{0.554492533f, 0.90719521f},
-std::array<float,2>{0.444973886f, 0.842894018f},
-std::array<float,2>{0.725975633f, 0.34768343f},
-std::array<float,2>{0.194126338f, 0.0111534437f},
-std::array<float,2>{0.849828541f, 0.610467613f},
-std::array<float,2>{0.382289648f, 0.706834972f},
-std::array<float,2>{0.630657673f, 0.179142594f},
-std::array<float,2>{0.16032736f, 0.462761164f},
-std::array<float,2>{0.773281634f, 0.948453128f},
-std::array<float,2>{0.00801023748f, 0.774721265f},
-std::array<float,2>{0.887051523f, 0.253369033f},
-std::array<float,2>{0.268080443f, 0.11262086f},
-std::array<float,2>{0.577323616f, 0.538257599f},
-std::array<float,2>{0.226609439f, 0.5775581f},
-std::array<float,2>{0.826577663f, 0.0503357537f},
-std::array<float,2>{0.478117079f, 0.32487309f},
-std::array<float,2>{0.71525228f, 0.857236087f},
-std::array<float,2>{0.346624851f, 0.905958831f},
-std::array<float,2>{0.526456773f, 0.375813663f},
-std::array<float,2>{0.106782094f, 0.232782647f},
-std::array<float,2>{0.98374784f, 0.643336177f},
-std::array<float,2>{0.417669147f, 0.623255193f},
-std::array<float,2>{0.674050152f, 0.00778907025f},
-std::array<float,2>{0.143662184f, 0.354416937f},
-std::array<float,2>{0.798146486f, 0.832711339f},
-std::array<float,2>{0.038057562f, 0.919848621f},
-std::array<float,2>{0.910220087f, 0.425118446f},
-std::array<float,2>{0.304216504f, 0.206702873f},
-std::array<float,2>{0.600401521f, 0.667075515f},
-std::array<float,2>{0.210096598f, 0.731384397f},
-std::array<float,2>{0.872014999f, 0.133319467f},
-std::array<float,2>{0.457822382f, 0.498026043f},
-std::array<float,2>{0.748218417f, 0.979225695f},
-std::array<float,2>{0.341604799f, 0.787062883f},
-std::array<float,2>{0.53427583f, 0.293707848f},
-std::array<float,2>{0.0792707801f, 0.0784989819f},
-std::array<float,2>{0.954046845f, 0.525446296f},
-std::array<float,2>{0.262202621f, 0.649196625f},
-std::array<float,2>{0.589272916f, 0.224233657f},
-std::array<float,2>{0.0236015208f, 0.386101574f},
-std::array<float,2>{0.905871093f, 0.891823411f},
-std::array<float,2>{0.183453053f, 0.850790679f},
-std::array<float,2>{0.758517444f, 0.31926316f},
-std::array<float,2>{0.404912859f, 0.0574805178f},
-std::array<float,2>{0.64841342f, 0.563005328f},
-std::array<float,2>{0.114393346f, 0.54245317f},
-std::array<float,2>{0.995225787f, 0.124971345f},
-std::array<float,2>{0.370743364f, 0.258316338f},
-std::array<float,2>{0.51290524f, 0.769268751f},
-std::array<float,2>{0.491369575f, 0.944078743f},
-std::array<float,2>{0.70251739f, 0.453819782f},
-std::array<float,2>{0.249890417f, 0.184126839f},
-std::array<float,2>{0.837695479f, 0.713501871f},
-std::array<float,2>{0.347874612f, 0.510301173f},
-std::array<float,2>{0.530617177f, 0.0627450645f},
-std::array<float,2>{0.103829846f, 0.311496764f},
-std::array<float,2>{0.97998786f, 0.79983902f},
-std::array<float,2>{0.233479738f, 0.987202048f},
-std::array<float,2>{0.823435187f, 0.474887431f},
-std::array<float,2>{0.481209964f, 0.15517424f},
-std::array<float,2>{0.713131011f, 0.744809866f},
-std::array<float,2>{0.0136966016f, 0.673233569f},
-std::array<float,2>{0.883519292f, 0.200346306f},
-std::array<float,2>{0.271953374f, 0.410906672f},
-std::array<float,2>{0.572233677f, 0.936322629f},
-std::array<float,2>{0.378858089f, 0.817747593f},
-std::array<float,2>{0.628479719f, 0.360757947f},
-std::array<float,2>{0.158469871f, 0.0190494452f},
-std::array<float,2>{0.769438386f, 0.595693529f},
-std::array<float,2>{0.440422118f, 0.692044973f},
-std::array<float,2>{0.719499469f, 0.161039904f},
-std::array<float,2>{0.187917411f, 0.442174554f},
-std::array<float,2>{0.845595181f, 0.962879121f},
-std::array<float,2>{0.0663461834f, 0.755299389f},
-std::array<float,2>{0.943750799f, 0.27237618f},
-std::array<float,2>{0.321983159f, 0.101274595f},
-std::array<float,2>{0.547136486f, 0.559002697f},
-std::array<float,2>{0.131410077f, 0.579880714f},
-std::array<float,2>{0.793249905f, 0.0315451361f},
-std::array<float,2>{0.430376619f, 0.342800647f},
-std::array<float,2>{0.666281343f, 0.873039961f},
-std::array<float,2>{0.285670698f, 0.887980402f},
-std::array<float,2>{0.618345678f, 0.394678146f},
-std::array<float,2>{0.061490383f, 0.242864504f},
-std::array<float,2>{0.922451496f, 0.627700269f},
-std::array<float,2>{0.473038226f, 0.553528666f},
-std::array<float,2>{0.708152294f, 0.109256215f},
-std::array<float,2>{0.225204214f, 0.279981494f},
-std::array<float,2>{0.81704694f, 0.765287578f},
-std::array<float,2>{0.101180561f, 0.957582951f},
-std::array<float,2>{0.970188379f, 0.448978186f},
-std::array<float,2>{0.352537483f, 0.166204244f},
-std::array<float,2>{0.518429875f, 0.700340569f},
-std::array<float,2>{0.166171134f, 0.63895601f},
-std::array<float,2>{0.780613184f, 0.237226084f},
-std::array<float,2>{0.387173176f, 0.403700024f},
-std::array<float,2>{0.639165878f, 0.877785087f},
-std::array<float,2>{0.276273608f, 0.861500919f},
-std::array<float,2>{0.567271709f, 0.332224995f},
-std::array<float,2>{0.00122374331f, 0.0427558832f},
-std::array<float,2>{0.876344264f, 0.588673413f},
-std::array<float,2>{0.314148605f, 0.735313654f},
-std::array<float,2>{0.558919728f, 0.145413876f},
-std::array<float,2>{0.0731771588f, 0.482643038f},
-std::array<float,2>{0.950439274f, 0.998659253f},
-std::array<float,2>{0.200208738f, 0.805582047f},
-std::array<float,2>{0.859250665f, 0.298490405f},
-std::array<float,2>{0.445427895f, 0.0713913217f},
-std::array<float,2>{0.731965542f, 0.502609968f},
-std::array<float,2>{0.052630078f, 0.604882061f},
-std::array<float,2>{0.937471569f, 0.0263774265f},
-std::array<float,2>{0.289100826f, 0.374979824f},
-std::array<float,2>{0.614564955f, 0.822025776f},
-std::array<float,2>{0.428077549f, 0.928907692f},
-std::array<float,2>{0.657299936f, 0.417160481f},
-std::array<float,2>{0.138447031f, 0.190889329f},
-std::array<float,2>{0.78729713f, 0.679884255f},
-std::array<float,2>{0.310713053f, 0.570937335f},
-std::array<float,2>{0.609202743f, 0.0514597781f},
-std::array<float,2>{0.0420475975f, 0.323387623f},
-std::array<float,2>{0.915109515f, 0.854883969f},
-std::array<float,2>{0.149490997f, 0.898891628f},
-std::array<float,2>{0.809854269f, 0.380226582f},
-std::array<float,2>{0.40717271f, 0.227871165f},
-std::array<float,2>{0.68638438f, 0.647455812f},
-std::array<float,2>{0.092396155f, 0.708335102f},
-std::array<float,2>{0.965422451f, 0.174428269f},
-std::array<float,2>{0.33520478f, 0.466290355f},
-std::array<float,2>{0.54443574f, 0.949860156f},
-std::array<float,2>{0.464730054f, 0.777516186f},
-std::array<float,2>{0.739145577f, 0.256353527f},
-std::array<float,2>{0.213532016f, 0.114516698f},
-std::array<float,2>{0.865145683f, 0.534603953f},
-std::array<float,2>{0.397412986f, 0.661866665f},
-std::array<float,2>{0.649931729f, 0.218108982f},
-std::array<float,2>{0.176304027f, 0.43182978f},
-std::array<float,2>{0.753751993f, 0.912290335f},
-std::array<float,2>{0.0180913378f, 0.836925209f},
-std::array<float,2>{0.896164894f, 0.344232678f},
-std::array<float,2>{0.253041208f, 0.0137269478f},
-std::array<float,2>{0.582888722f, 0.616141796f},
-std::array<float,2>{0.239350781f, 0.522782028f},
-std::array<float,2>{0.830770552f, 0.0929778889f},
-std::array<float,2>{0.495224923f, 0.281439304f},
-std::array<float,2>{0.693051338f, 0.794490576f},
-std::array<float,2>{0.361589938f, 0.973591387f},
-std::array<float,2>{0.504554033f, 0.488420606f},
-std::array<float,2>{0.123054296f, 0.128147751f},
-std::array<float,2>{0.990060031f, 0.719913661f},
-std::array<float,2>{0.383533776f, 0.529131651f},
-std::array<float,2>{0.634559751f, 0.082687214f},
-std::array<float,2>{0.17042245f, 0.292840391f},
-std::array<float,2>{0.774401784f, 0.784280658f},
-std::array<float,2>{0.00447511394f, 0.984037876f},
-std::array<float,2>{0.878961504f, 0.49445805f},
-std::array<float,2>{0.2775819f, 0.139490172f},
-std::array<float,2>{0.563526809f, 0.726833582f},
-std::array<float,2>{0.22264871f, 0.668397248f},
-std::array<float,2>{0.812552512f, 0.209353715f},
-std::array<float,2>{0.471834987f, 0.426979125f},
-std::array<float,2>{0.705649197f, 0.915099502f},
-std::array<float,2>{0.357287437f, 0.831894517f},
-std::array<float,2>{0.523210108f, 0.358368337f},
-std::array<float,2>{0.0943693519f, 5.26928416e-05f},
-std::array<float,2>{0.975382805f, 0.620942712f},
-std::array<float,2>{0.295638293f, 0.714871526f},
-std::array<float,2>{0.610837877f, 0.183344662f},
-std::array<float,2>{0.0498985574f, 0.458679706f},
-std::array<float,2>{0.933310747f, 0.938173175f},
-std::array<float,2>{0.135939568f, 0.772559643f},
-std::array<float,2>{0.783480287f, 0.261851549f},
-std::array<float,2>{0.424703807f, 0.11949078f},
-std::array<float,2>{0.660335064f, 0.546486199f},
-std::array<float,2>{0.0769580752f, 0.569885075f},
-std::array<float,2>{0.946409225f, 0.0588262975f},
-std::array<float,2>{0.320254922f, 0.314443916f},
-std::array<float,2>{0.557481349f, 0.847144902f},
-std::array<float,2>{0.45040217f, 0.894866526f},
-std::array<float,2>{0.727666676f, 0.388198614f},
-std::array<float,2>{0.19657515f, 0.218793631f},
-std::array<float,2>{0.855292141f, 0.654068589f},
-std::array<float,2>{0.33174184f, 0.601506174f},
-std::array<float,2>{0.540491045f, 0.0215885043f},
-std::array<float,2>{0.0885613561f, 0.363820016f},
-std::array<float,2>{0.96149236f, 0.814681351f},
-std::array<float,2>{0.218434155f, 0.929998338f},
-std::array<float,2>{0.860914707f, 0.408576906f},
-std::array<float,2>{0.466028005f, 0.195816502f},
-std::array<float,2>{0.736928821f, 0.678114653f},
-std::array<float,2>{0.0431785397f, 0.749661446f},
-std::array<float,2>{0.920779943f, 0.150857791f},
-std::array<float,2>{0.30847773f, 0.47163263f},
-std::array<float,2>{0.603761017f, 0.991987407f},
-std::array<float,2>{0.410395622f, 0.800996244f},
-std::array<float,2>{0.683350325f, 0.305055588f},
-std::array<float,2>{0.155507222f, 0.0701343343f},
-std::array<float,2>{0.808356643f, 0.512022793f},
-std::array<float,2>{0.496315509f, 0.63037461f},
-std::array<float,2>{0.687899649f, 0.248298958f},
-std::array<float,2>{0.23598741f, 0.391630948f},
-std::array<float,2>{0.834890008f, 0.882963777f},
-std::array<float,2>{0.11926163f, 0.868435442f},
-std::array<float,2>{0.984422922f, 0.338506073f},
-std::array<float,2>{0.364591748f, 0.0372282118f},
-std::array<float,2>{0.501169145f, 0.584302366f},
-std::array<float,2>{0.175229713f, 0.556804419f},
-std::array<float,2>{0.756014228f, 0.0954168364f},
-std::array<float,2>{0.391144425f, 0.266737074f},
-std::array<float,2>{0.653850317f, 0.750873864f},
-std::array<float,2>{0.256194353f, 0.966436982f},
-std::array<float,2>{0.581179261f, 0.441083789f},
-std::array<float,2>{0.0230686907f, 0.156428263f},
-std::array<float,2>{0.892520249f, 0.691251576f},
-std::array<float,2>{0.454468042f, 0.590778947f},
-std::array<float,2>{0.745458305f, 0.0457015522f},
-std::array<float,2>{0.206327498f, 0.328827173f},
-std::array<float,2>{0.868815124f, 0.866206467f},
-std::array<float,2>{0.0846479386f, 0.881921232f},
-std::array<float,2>{0.95969367f, 0.400746852f},
-std::array<float,2>{0.33739841f, 0.24206236f},
-std::array<float,2>{0.538972914f, 0.634459436f},
-std::array<float,2>{0.145963594f, 0.697093308f},
-std::array<float,2>{0.802862644f, 0.171161681f},
-std::array<float,2>{0.418155044f, 0.449879974f},
-std::array<float,2>{0.678361654f, 0.954331696f},
-std::array<float,2>{0.296953171f, 0.759826481f},
-std::array<float,2>{0.59457922f, 0.274353176f},
-std::array<float,2>{0.0337442197f, 0.10538958f},
-std::array<float,2>{0.90837729f, 0.547577262f},
-std::array<float,2>{0.37234354f, 0.683811486f},
-std::array<float,2>{0.508140326f, 0.195114002f},
-std::array<float,2>{0.112806924f, 0.421542913f},
-std::array<float,2>{0.998058259f, 0.925209403f},
-std::array<float,2>{0.245376199f, 0.828030229f},
-std::array<float,2>{0.843259633f, 0.370991319f},
-std::array<float,2>{0.486767054f, 0.0288855545f},
-std::array<float,2>{0.696205437f, 0.607999742f},
-std::array<float,2>{0.0290952008f, 0.507704735f},
-std::array<float,2>{0.901546359f, 0.077015236f},
-std::array<float,2>{0.259701639f, 0.301475227f},
-std::array<float,2>{0.59218049f, 0.812280178f},
-std::array<float,2>{0.400978595f, 0.992300451f},
-std::array<float,2>{0.64449048f, 0.477240294f},
-std::array<float,2>{0.184565321f, 0.142562076f},
-std::array<float,2>{0.76224798f, 0.740157485f},
-std::array<float,2>{0.265806824f, 0.536004782f},
-std::array<float,2>{0.574362695f, 0.110364892f},
-std::array<float,2>{0.0103433691f, 0.251271278f},
-std::array<float,2>{0.889951885f, 0.777013361f},
-std::array<float,2>{0.162709162f, 0.946213305f},
-std::array<float,2>{0.770928144f, 0.464209735f},
-std::array<float,2>{0.380018741f, 0.177056774f},
-std::array<float,2>{0.632229984f, 0.704436362f},
-std::array<float,2>{0.109199308f, 0.642281473f},
-std::array<float,2>{0.980622292f, 0.231955245f},
-std::array<float,2>{0.344870776f, 0.378583252f},
-std::array<float,2>{0.52413708f, 0.902945518f},
-std::array<float,2>{0.480127454f, 0.858480632f},
-std::array<float,2>{0.71865797f, 0.327231497f},
-std::array<float,2>{0.22920987f, 0.0475607328f},
-std::array<float,2>{0.825988531f, 0.575591862f},
-std::array<float,2>{0.433710217f, 0.72337836f},
-std::array<float,2>{0.669406772f, 0.132058293f},
-std::array<float,2>{0.12709792f, 0.48726055f},
-std::array<float,2>{0.790198445f, 0.971982121f},
-std::array<float,2>{0.0560328402f, 0.792948127f},
-std::array<float,2>{0.92850256f, 0.287224382f},
-std::array<float,2>{0.282084942f, 0.0865804628f},
-std::array<float,2>{0.62308085f, 0.518842518f},
-std::array<float,2>{0.192264542f, 0.611736238f},
-std::array<float,2>{0.847975433f, 0.00838835537f},
-std::array<float,2>{0.442627013f, 0.349790066f},
-std::array<float,2>{0.723571777f, 0.841335893f},
-std::array<float,2>{0.325323045f, 0.908414125f},
-std::array<float,2>{0.551840246f, 0.436271042f},
-std::array<float,2>{0.0700057521f, 0.212292343f},
-std::array<float,2>{0.939289033f, 0.657882869f},
-std::array<float,2>{0.43094644f, 0.580975175f},
-std::array<float,2>{0.667622745f, 0.0338099077f},
-std::array<float,2>{0.131946236f, 0.339987755f},
-std::array<float,2>{0.794774115f, 0.874974728f},
-std::array<float,2>{0.0621088743f, 0.888799369f},
-std::array<float,2>{0.923781037f, 0.396614254f},
-std::array<float,2>{0.28688255f, 0.245181054f},
-std::array<float,2>{0.617758214f, 0.626146078f},
-std::array<float,2>{0.189444482f, 0.694992185f},
-std::array<float,2>{0.843866467f, 0.162283078f},
-std::array<float,2>{0.440628022f, 0.444445461f},
-std::array<float,2>{0.720659137f, 0.963584661f},
-std::array<float,2>{0.320453674f, 0.757623672f},
-std::array<float,2>{0.548755407f, 0.270022213f},
-std::array<float,2>{0.0650791898f, 0.0986352339f},
-std::array<float,2>{0.944936156f, 0.562011063f},
-std::array<float,2>{0.272840083f, 0.674591482f},
-std::array<float,2>{0.570855796f, 0.20189245f},
-std::array<float,2>{0.0155770257f, 0.413306147f},
-std::array<float,2>{0.88465178f, 0.935120106f},
-std::array<float,2>{0.159442484f, 0.819158137f},
-std::array<float,2>{0.768251777f, 0.362478882f},
-std::array<float,2>{0.377607018f, 0.0166776143f},
-std::array<float,2>{0.627836943f, 0.597458422f},
-std::array<float,2>{0.105356909f, 0.508334279f},
-std::array<float,2>{0.979403913f, 0.0654062405f},
-std::array<float,2>{0.348759472f, 0.309325874f},
-std::array<float,2>{0.529772818f, 0.798633575f},
-std::array<float,2>{0.481966943f, 0.985811472f},
-std::array<float,2>{0.71470499f, 0.473653078f},
-std::array<float,2>{0.232485443f, 0.1525065f},
-std::array<float,2>{0.823075891f, 0.743038774f},
-std::array<float,2>{0.369464815f, 0.539109886f},
-std::array<float,2>{0.512339413f, 0.122843124f},
-std::array<float,2>{0.11375735f, 0.261434257f},
-std::array<float,2>{0.994498372f, 0.766139507f},
-std::array<float,2>{0.248837769f, 0.942483425f},
-std::array<float,2>{0.83648932f, 0.455731869f},
-std::array<float,2>{0.490525931f, 0.186789945f},
-std::array<float,2>{0.70130372f, 0.711971283f},
-std::array<float,2>{0.0253432337f, 0.651933908f},
-std::array<float,2>{0.904388964f, 0.224980339f},
-std::array<float,2>{0.263294905f, 0.383435011f},
-std::array<float,2>{0.58817488f, 0.893375099f},
-std::array<float,2>{0.405306637f, 0.848988891f},
-std::array<float,2>{0.647093654f, 0.316708148f},
-std::array<float,2>{0.182594687f, 0.0549395233f},
-std::array<float,2>{0.759716451f, 0.566235423f},
-std::array<float,2>{0.458749056f, 0.732746542f},
-std::array<float,2>{0.749169767f, 0.136026859f},
-std::array<float,2>{0.209255233f, 0.498822123f},
-std::array<float,2>{0.87264502f, 0.978038967f},
-std::array<float,2>{0.0782950297f, 0.78899169f},
-std::array<float,2>{0.954996705f, 0.295637786f},
-std::array<float,2>{0.340515703f, 0.0815364718f},
-std::array<float,2>{0.533267796f, 0.524453163f},
-std::array<float,2>{0.142890349f, 0.621675313f},
-std::array<float,2>{0.797515452f, 0.00456653209f},
-std::array<float,2>{0.416201353f, 0.352010876f},
-std::array<float,2>{0.67503494f, 0.834635973f},
-std::array<float,2>{0.30276075f, 0.921280444f},
-std::array<float,2>{0.601268709f, 0.422320157f},
-std::array<float,2>{0.0381692126f, 0.204612881f},
-std::array<float,2>{0.911456287f, 0.664426148f},
-std::array<float,2>{0.494438827f, 0.520409703f},
-std::array<float,2>{0.692284822f, 0.0914835781f},
-std::array<float,2>{0.238664538f, 0.283798009f},
-std::array<float,2>{0.831928551f, 0.795154572f},
-std::array<float,2>{0.124712743f, 0.974936903f},
-std::array<float,2>{0.988298953f, 0.491691083f},
-std::array<float,2>{0.362495989f, 0.126790002f},
-std::array<float,2>{0.505215347f, 0.722411811f},
-std::array<float,2>{0.17684865f, 0.662436485f},
-std::array<float,2>{0.752137125f, 0.216155261f},
-std::array<float,2>{0.397834808f, 0.430670857f},
-std::array<float,2>{0.6488958f, 0.911695302f},
-std::array<float,2>{0.252098888f, 0.838397861f},
-std::array<float,2>{0.583137929f, 0.345777065f},
-std::array<float,2>{0.0193800274f, 0.0125748646f},
-std::array<float,2>{0.895101547f, 0.613823175f},
-std::array<float,2>{0.334925085f, 0.709069669f},
-std::array<float,2>{0.543487072f, 0.172034562f},
-std::array<float,2>{0.0931160897f, 0.466911435f},
-std::array<float,2>{0.96660924f, 0.951466799f},
-std::array<float,2>{0.214037046f, 0.780174792f},
-std::array<float,2>{0.863583624f, 0.254265219f},
-std::array<float,2>{0.463139206f, 0.116095245f},
-std::array<float,2>{0.739850104f, 0.532717764f},
-std::array<float,2>{0.0411310196f, 0.57262063f},
-std::array<float,2>{0.914839625f, 0.0528379865f},
-std::array<float,2>{0.312233835f, 0.320936501f},
-std::array<float,2>{0.607866824f, 0.853153706f},
-std::array<float,2>{0.408085942f, 0.901814997f},
-std::array<float,2>{0.686562181f, 0.382019103f},
-std::array<float,2>{0.148990303f, 0.229695991f},
-std::array<float,2>{0.809141457f, 0.64615202f},
-std::array<float,2>{0.290677369f, 0.60217464f},
-std::array<float,2>{0.613392413f, 0.024598429f},
-std::array<float,2>{0.0512199551f, 0.372375458f},
-std::array<float,2>{0.936022222f, 0.82255137f},
-std::array<float,2>{0.136895522f, 0.927330494f},
-std::array<float,2>{0.788488388f, 0.414073139f},
-std::array<float,2>{0.429182351f, 0.187532067f},
-std::array<float,2>{0.656904042f, 0.682883263f},
-std::array<float,2>{0.0732707158f, 0.736704588f},
-std::array<float,2>{0.94958216f, 0.147995919f},
-std::array<float,2>{0.312622428f, 0.481503159f},
-std::array<float,2>{0.559604108f, 0.99783957f},
-std::array<float,2>{0.446875244f, 0.807993293f},
-std::array<float,2>{0.731417298f, 0.299817383f},
-std::array<float,2>{0.199410453f, 0.0738412514f},
-std::array<float,2>{0.857849121f, 0.500323534f},
-std::array<float,2>{0.387844712f, 0.637145817f},
-std::array<float,2>{0.640015125f, 0.235350683f},
-std::array<float,2>{0.167380422f, 0.406017154f},
-std::array<float,2>{0.779968143f, 0.876772106f},
-std::array<float,2>{0.000805123942f, 0.860325813f},
-std::array<float,2>{0.875382125f, 0.335695624f},
-std::array<float,2>{0.277006537f, 0.0391747244f},
-std::array<float,2>{0.568154871f, 0.58598125f},
-std::array<float,2>{0.225909367f, 0.552035213f},
-std::array<float,2>{0.818248391f, 0.105924696f},
-std::array<float,2>{0.473802f, 0.277533531f},
-std::array<float,2>{0.707793355f, 0.763355613f},
-std::array<float,2>{0.35264793f, 0.95940423f},
-std::array<float,2>{0.519178391f, 0.447131395f},
-std::array<float,2>{0.0999024585f, 0.164968207f},
-std::array<float,2>{0.969354391f, 0.70240581f},
-std::array<float,2>{0.392395496f, 0.555231094f},
-std::array<float,2>{0.653035522f, 0.0972605646f},
-std::array<float,2>{0.174676836f, 0.269412994f},
-std::array<float,2>{0.757397056f, 0.752631068f},
-std::array<float,2>{0.0223169941f, 0.968095362f},
-std::array<float,2>{0.891364336f, 0.437729359f},
-std::array<float,2>{0.257753789f, 0.159837469f},
-std::array<float,2>{0.580830932f, 0.688338995f},
-std::array<float,2>{0.23534438f, 0.631733835f},
-std::array<float,2>{0.835342765f, 0.246725529f},
-std::array<float,2>{0.497350156f, 0.393913776f},
-std::array<float,2>{0.689351082f, 0.886076272f},
-std::array<float,2>{0.363591909f, 0.870673954f},
-std::array<float,2>{0.500562727f, 0.336812884f},
-std::array<float,2>{0.120348625f, 0.0368615389f},
-std::array<float,2>{0.985875607f, 0.583654225f},
-std::array<float,2>{0.307344466f, 0.746269166f},
-std::array<float,2>{0.604612648f, 0.149336562f},
-std::array<float,2>{0.0442589112f, 0.469058812f},
-std::array<float,2>{0.921070755f, 0.988990664f},
-std::array<float,2>{0.154329866f, 0.803851724f},
-std::array<float,2>{0.806968153f, 0.307025254f},
-std::array<float,2>{0.411423683f, 0.0666797906f},
-std::array<float,2>{0.682203948f, 0.515518606f},
-std::array<float,2>{0.0891780034f, 0.599195659f},
-std::array<float,2>{0.962453663f, 0.0212052632f},
-std::array<float,2>{0.330718547f, 0.366086215f},
-std::array<float,2>{0.539925158f, 0.814451337f},
-std::array<float,2>{0.464892715f, 0.93343848f},
-std::array<float,2>{0.738167167f, 0.407822132f},
-std::array<float,2>{0.217582837f, 0.197894737f},
-std::array<float,2>{0.859397888f, 0.676737905f},
-std::array<float,2>{0.318795413f, 0.567602098f},
-std::array<float,2>{0.558182895f, 0.0615018308f},
-std::array<float,2>{0.0773566961f, 0.31623441f},
-std::array<float,2>{0.94568789f, 0.843924642f},
-std::array<float,2>{0.195872813f, 0.896878719f},
-std::array<float,2>{0.853617489f, 0.390114933f},
-std::array<float,2>{0.449328303f, 0.222363099f},
-std::array<float,2>{0.72719872f, 0.655261457f},
-std::array<float,2>{0.0488570705f, 0.716973305f},
-std::array<float,2>{0.932236016f, 0.181416243f},
-std::array<float,2>{0.296084076f, 0.460581511f},
-std::array<float,2>{0.610126078f, 0.941402137f},
-std::array<float,2>{0.425527096f, 0.769744158f},
-std::array<float,2>{0.661479831f, 0.264746964f},
-std::array<float,2>{0.135559723f, 0.117708132f},
-std::array<float,2>{0.784661531f, 0.543247879f},
-std::array<float,2>{0.470985293f, 0.671768546f},
-std::array<float,2>{0.706626534f, 0.207172558f},
-std::array<float,2>{0.220977724f, 0.42859748f},
-std::array<float,2>{0.813945532f, 0.916143119f},
-std::array<float,2>{0.0951021761f, 0.828529894f},
-std::array<float,2>{0.976243138f, 0.357090652f},
-std::array<float,2>{0.355608344f, 0.00210949336f},
-std::array<float,2>{0.522261083f, 0.619088888f},
-std::array<float,2>{0.171410993f, 0.530991852f},
-std::array<float,2>{0.774439335f, 0.0849361643f},
-std::array<float,2>{0.38466832f, 0.290246576f},
-std::array<float,2>{0.633550107f, 0.782033086f},
-std::array<float,2>{0.279178351f, 0.980614066f},
-std::array<float,2>{0.562812567f, 0.493242294f},
-std::array<float,2>{0.00561201153f, 0.137087345f},
-std::array<float,2>{0.880776525f, 0.728892088f},
-std::array<float,2>{0.441913992f, 0.61007452f},
-std::array<float,2>{0.724045873f, 0.00983515847f},
-std::array<float,2>{0.193079397f, 0.349511564f},
-std::array<float,2>{0.848754585f, 0.842388511f},
-std::array<float,2>{0.0687300563f, 0.907437563f},
-std::array<float,2>{0.937802315f, 0.434648007f},
-std::array<float,2>{0.324436873f, 0.212986127f},
-std::array<float,2>{0.550823927f, 0.66015327f},
-std::array<float,2>{0.128462031f, 0.725773513f},
-std::array<float,2>{0.789966762f, 0.129686609f},
-std::array<float,2>{0.435162485f, 0.485863268f},
-std::array<float,2>{0.668417096f, 0.969069779f},
-std::array<float,2>{0.282789439f, 0.789750516f},
-std::array<float,2>{0.624480426f, 0.286487639f},
-std::array<float,2>{0.0552576743f, 0.0895061418f},
-std::array<float,2>{0.929111004f, 0.515673876f},
-std::array<float,2>{0.344437063f, 0.644452333f},
-std::array<float,2>{0.524455786f, 0.233737037f},
-std::array<float,2>{0.107812956f, 0.37598002f},
-std::array<float,2>{0.981918693f, 0.905141175f},
-std::array<float,2>{0.230373561f, 0.856405497f},
-std::array<float,2>{0.824921489f, 0.325805426f},
-std::array<float,2>{0.478983819f, 0.0490287803f},
-std::array<float,2>{0.717441022f, 0.576729119f},
-std::array<float,2>{0.0112425648f, 0.537243009f},
-std::array<float,2>{0.888899028f, 0.112053297f},
-std::array<float,2>{0.267000914f, 0.252559662f},
-std::array<float,2>{0.575414836f, 0.774001002f},
-std::array<float,2>{0.379348367f, 0.947419524f},
-std::array<float,2>{0.631056547f, 0.461348832f},
-std::array<float,2>{0.163133875f, 0.178256765f},
-std::array<float,2>{0.77038914f, 0.70565635f},
-std::array<float,2>{0.258071512f, 0.505856931f},
-std::array<float,2>{0.593173981f, 0.0750620589f},
-std::array<float,2>{0.0283017624f, 0.304378092f},
-std::array<float,2>{0.900861323f, 0.809310198f},
-std::array<float,2>{0.184975848f, 0.995719671f},
-std::array<float,2>{0.762900889f, 0.479979545f},
-std::array<float,2>{0.402148724f, 0.143314794f},
-std::array<float,2>{0.643055797f, 0.740311861f},
-std::array<float,2>{0.111965567f, 0.68569243f},
-std::array<float,2>{0.999884009f, 0.192175329f},
-std::array<float,2>{0.371308565f, 0.418741554f},
-std::array<float,2>{0.509499013f, 0.921880841f},
-std::array<float,2>{0.48766923f, 0.825377703f},
-std::array<float,2>{0.696364403f, 0.368697733f},
-std::array<float,2>{0.244340867f, 0.0304517765f},
-std::array<float,2>{0.842644274f, 0.605790794f},
-std::array<float,2>{0.419498473f, 0.698586404f},
-std::array<float,2>{0.679402411f, 0.169465959f},
-std::array<float,2>{0.145339891f, 0.451602489f},
-std::array<float,2>{0.803746998f, 0.955394685f},
-std::array<float,2>{0.034713313f, 0.757941008f},
-std::array<float,2>{0.909714937f, 0.275707394f},
-std::array<float,2>{0.298671752f, 0.102815472f},
-std::array<float,2>{0.595403075f, 0.550251484f},
-std::array<float,2>{0.20529598f, 0.592290998f},
-std::array<float,2>{0.867446184f, 0.0438483804f},
-std::array<float,2>{0.453748554f, 0.331002206f},
-std::array<float,2>{0.744856298f, 0.865225136f},
-std::array<float,2>{0.336341292f, 0.880032837f},
-std::array<float,2>{0.537784278f, 0.399564922f},
-std::array<float,2>{0.0853341669f, 0.239142016f},
-std::array<float,2>{0.960429728f, 0.636340201f},
-std::array<float,2>{0.375895649f, 0.594624817f},
-std::array<float,2>{0.625749886f, 0.0182126742f},
-std::array<float,2>{0.156274423f, 0.360130966f},
-std::array<float,2>{0.766007066f, 0.816794813f},
-std::array<float,2>{0.0128914351f, 0.936658978f},
-std::array<float,2>{0.885344028f, 0.411234945f},
-std::array<float,2>{0.270193189f, 0.199315757f},
-std::array<float,2>{0.574171185f, 0.672770023f},
-std::array<float,2>{0.230540931f, 0.745535791f},
-std::array<float,2>{0.822187603f, 0.15570721f},
-std::array<float,2>{0.483096868f, 0.476089239f},
-std::array<float,2>{0.712709308f, 0.987818301f},
-std::array<float,2>{0.349699557f, 0.79918164f},
-std::array<float,2>{0.527756214f, 0.311913997f},
-std::array<float,2>{0.10247384f, 0.064033106f},
-std::array<float,2>{0.976632476f, 0.511677802f},
-std::array<float,2>{0.288507521f, 0.628471375f},
-std::array<float,2>{0.620104015f, 0.243185982f},
-std::array<float,2>{0.0600494966f, 0.396067321f},
-std::array<float,2>{0.924619615f, 0.887174249f},
-std::array<float,2>{0.129676506f, 0.871845365f},
-std::array<float,2>{0.795105934f, 0.342063546f},
-std::array<float,2>{0.433481485f, 0.032635726f},
-std::array<float,2>{0.665536821f, 0.578541756f},
-std::array<float,2>{0.0631288961f, 0.55978173f},
-std::array<float,2>{0.941967249f, 0.100221947f},
-std::array<float,2>{0.323164463f, 0.272578955f},
-std::array<float,2>{0.550764978f, 0.75401026f},
-std::array<float,2>{0.438528329f, 0.961056828f},
-std::array<float,2>{0.72112453f, 0.44283089f},
-std::array<float,2>{0.190945968f, 0.161398992f},
-std::array<float,2>{0.846608877f, 0.692533076f},
-std::array<float,2>{0.343606025f, 0.526853561f},
-std::array<float,2>{0.532614231f, 0.0793164298f},
-std::array<float,2>{0.0811917409f, 0.294379562f},
-std::array<float,2>{0.955816269f, 0.78532517f},
-std::array<float,2>{0.208566949f, 0.980275095f},
-std::array<float,2>{0.874727607f, 0.496630669f},
-std::array<float,2>{0.459041387f, 0.134664536f},
-std::array<float,2>{0.746885836f, 0.732384622f},
-std::array<float,2>{0.035544008f, 0.666649103f},
-std::array<float,2>{0.913123131f, 0.20543915f},
-std::array<float,2>{0.301532656f, 0.423978776f},
-std::array<float,2>{0.599399686f, 0.918800592f},
-std::array<float,2>{0.414757133f, 0.833697617f},
-std::array<float,2>{0.672887206f, 0.354559869f},
-std::array<float,2>{0.141299367f, 0.00643207179f},
-std::array<float,2>{0.799003363f, 0.62460959f},
-std::array<float,2>{0.488965154f, 0.714165211f},
-std::array<float,2>{0.700101197f, 0.184616834f},
-std::array<float,2>{0.248032004f, 0.454438925f},
-std::array<float,2>{0.839567244f, 0.944503844f},
-std::array<float,2>{0.116116904f, 0.767865837f},
-std::array<float,2>{0.993238628f, 0.259259939f},
-std::array<float,2>{0.367867261f, 0.123515308f},
-std::array<float,2>{0.513954103f, 0.541967034f},
-std::array<float,2>{0.179970086f, 0.564189434f},
-std::array<float,2>{0.761564195f, 0.0583806187f},
-std::array<float,2>{0.403294712f, 0.31995216f},
-std::array<float,2>{0.646017075f, 0.850387216f},
-std::array<float,2>{0.265087634f, 0.891067326f},
-std::array<float,2>{0.586554587f, 0.385372996f},
-std::array<float,2>{0.0268952679f, 0.223222971f},
-std::array<float,2>{0.904266238f, 0.649752975f},
-std::array<float,2>{0.462831438f, 0.534107685f},
-std::array<float,2>{0.742178559f, 0.113410234f},
-std::array<float,2>{0.212853298f, 0.257260323f},
-std::array<float,2>{0.866679609f, 0.778859079f},
-std::array<float,2>{0.0903089568f, 0.950489223f},
-std::array<float,2>{0.967206955f, 0.465576917f},
-std::array<float,2>{0.332869709f, 0.175227448f},
-std::array<float,2>{0.546817541f, 0.707314372f},
-std::array<float,2>{0.151839972f, 0.647708952f},
-std::array<float,2>{0.812217295f, 0.226596043f},
-std::array<float,2>{0.408792466f, 0.379100889f},
-std::array<float,2>{0.685073972f, 0.900130153f},
-std::array<float,2>{0.309774816f, 0.853880882f},
-std::array<float,2>{0.606903195f, 0.322527021f},
-std::array<float,2>{0.0405047573f, 0.051988624f},
-std::array<float,2>{0.916131496f, 0.572083175f},
-std::array<float,2>{0.359517455f, 0.71925652f},
-std::array<float,2>{0.506682336f, 0.127804399f},
-std::array<float,2>{0.121585973f, 0.489768803f},
-std::array<float,2>{0.991701484f, 0.97428602f},
-std::array<float,2>{0.241144761f, 0.793014705f},
-std::array<float,2>{0.828301251f, 0.282342851f},
-std::array<float,2>{0.492527992f, 0.0920742378f},
-std::array<float,2>{0.695308983f, 0.522089303f},
-std::array<float,2>{0.0171447117f, 0.617019653f},
-std::array<float,2>{0.897003412f, 0.0149976863f},
-std::array<float,2>{0.250359744f, 0.345581114f},
-std::array<float,2>{0.584072173f, 0.836136699f},
-std::array<float,2>{0.396101385f, 0.913974047f},
-std::array<float,2>{0.650558829f, 0.432988733f},
-std::array<float,2>{0.178675652f, 0.217282027f},
-std::array<float,2>{0.751401842f, 0.660288155f},
-std::array<float,2>{0.275178701f, 0.589359403f},
-std::array<float,2>{0.568593144f, 0.041532062f},
-std::array<float,2>{0.00235850853f, 0.333967f},
-std::array<float,2>{0.87877059f, 0.862826526f},
-std::array<float,2>{0.165780082f, 0.878176868f},
-std::array<float,2>{0.779209912f, 0.403047979f},
-std::array<float,2>{0.390204012f, 0.238193318f},
-std::array<float,2>{0.637065291f, 0.640414774f},
-std::array<float,2>{0.0985647291f, 0.699396133f},
-std::array<float,2>{0.971064985f, 0.167278573f},
-std::array<float,2>{0.354148388f, 0.44779855f},
-std::array<float,2>{0.51593852f, 0.958434701f},
-std::array<float,2>{0.475790113f, 0.763754189f},
-std::array<float,2>{0.7092852f, 0.280551165f},
-std::array<float,2>{0.224431738f, 0.108165301f},
-std::array<float,2>{0.818806052f, 0.554292917f},
-std::array<float,2>{0.42653501f, 0.681234062f},
-std::array<float,2>{0.658310354f, 0.189595833f},
-std::array<float,2>{0.139285862f, 0.416475326f},
-std::array<float,2>{0.785345793f, 0.928584516f},
-std::array<float,2>{0.0534680746f, 0.82125181f},
-std::array<float,2>{0.934956014f, 0.373786151f},
-std::array<float,2>{0.292933851f, 0.0259928592f},
-std::array<float,2>{0.615343392f, 0.603642881f},
-std::array<float,2>{0.201774687f, 0.503005862f},
-std::array<float,2>{0.85669291f, 0.0707584098f},
-std::array<float,2>{0.447336704f, 0.297677279f},
-std::array<float,2>{0.733282626f, 0.806294978f},
-std::array<float,2>{0.314798087f, 0.999811411f},
-std::array<float,2>{0.561303854f, 0.483577102f},
-std::array<float,2>{0.0703666657f, 0.146170661f},
-std::array<float,2>{0.953116894f, 0.735475957f},
-std::array<float,2>{0.412853628f, 0.513006747f},
-std::array<float,2>{0.680687487f, 0.0686412379f},
-std::array<float,2>{0.15291661f, 0.306606561f},
-std::array<float,2>{0.804920971f, 0.801920414f},
-std::array<float,2>{0.0451231934f, 0.990485013f},
-std::array<float,2>{0.919120789f, 0.472446889f},
-std::array<float,2>{0.306267202f, 0.152187049f},
-std::array<float,2>{0.602803171f, 0.748537302f},
-std::array<float,2>{0.216223463f, 0.678856432f},
-std::array<float,2>{0.861787319f, 0.196741626f},
-std::array<float,2>{0.468366265f, 0.410146326f},
-std::array<float,2>{0.736173034f, 0.931571603f},
-std::array<float,2>{0.328536302f, 0.8159585f},
-std::array<float,2>{0.542616189f, 0.365086734f},
-std::array<float,2>{0.0878799409f, 0.0230261423f},
-std::array<float,2>{0.963716865f, 0.600353301f},
-std::array<float,2>{0.255513519f, 0.690391958f},
-std::array<float,2>{0.578268349f, 0.157311752f},
-std::array<float,2>{0.0209836382f, 0.440127343f},
-std::array<float,2>{0.892786741f, 0.965259314f},
-std::array<float,2>{0.172781453f, 0.751770198f},
-std::array<float,2>{0.755584538f, 0.266399741f},
-std::array<float,2>{0.39408198f, 0.0939130187f},
-std::array<float,2>{0.655958474f, 0.557662964f},
-std::array<float,2>{0.117697939f, 0.585193872f},
-std::array<float,2>{0.987733483f, 0.0389791988f},
-std::array<float,2>{0.365408033f, 0.339011729f},
-std::array<float,2>{0.502819896f, 0.868101656f},
-std::array<float,2>{0.498835921f, 0.884501517f},
-std::array<float,2>{0.691090524f, 0.390977085f},
-std::array<float,2>{0.238237932f, 0.249249339f},
-std::array<float,2>{0.832218707f, 0.629764378f},
-std::array<float,2>{0.357902557f, 0.619484365f},
-std::array<float,2>{0.520769596f, 0.00145388686f},
-std::array<float,2>{0.0959836841f, 0.358878076f},
-std::array<float,2>{0.973663092f, 0.830246329f},
-std::array<float,2>{0.219220057f, 0.914973617f},
-std::array<float,2>{0.814684629f, 0.426226586f},
-std::array<float,2>{0.470143706f, 0.210306346f},
-std::array<float,2>{0.70365113f, 0.669776261f},
-std::array<float,2>{0.00608930876f, 0.728417277f},
-std::array<float,2>{0.882193983f, 0.140017167f},
-std::array<float,2>{0.279378176f, 0.495971918f},
-std::array<float,2>{0.565126896f, 0.983272612f},
-std::array<float,2>{0.385111481f, 0.783307672f},
-std::array<float,2>{0.635023594f, 0.291074514f},
-std::array<float,2>{0.168331847f, 0.0836700499f},
-std::array<float,2>{0.776381314f, 0.527416408f},
-std::array<float,2>{0.452499568f, 0.652368426f},
-std::array<float,2>{0.729810119f, 0.220397666f},
-std::array<float,2>{0.199215233f, 0.387414038f},
-std::array<float,2>{0.851855159f, 0.896291792f},
-std::array<float,2>{0.0743399486f, 0.846141458f},
-std::array<float,2>{0.948074162f, 0.313297987f},
-std::array<float,2>{0.316939324f, 0.0603686385f},
-std::array<float,2>{0.554897368f, 0.568734407f},
-std::array<float,2>{0.13462396f, 0.54566896f},
-std::array<float,2>{0.781955361f, 0.120985709f},
-std::array<float,2>{0.422834098f, 0.26281181f},
-std::array<float,2>{0.662659883f, 0.771539688f},
-std::array<float,2>{0.294192523f, 0.939000249f},
-std::array<float,2>{0.613186359f, 0.45755893f},
-std::array<float,2>{0.0474552624f, 0.182592392f},
-std::array<float,2>{0.929913163f, 0.715903878f},
-std::array<float,2>{0.47677803f, 0.574679494f},
-std::array<float,2>{0.71615243f, 0.0486560054f},
-std::array<float,2>{0.228204057f, 0.326744378f},
-std::array<float,2>{0.827653885f, 0.857747555f},
-std::array<float,2>{0.105920695f, 0.904096484f},
-std::array<float,2>{0.983109951f, 0.377121717f},
-std::array<float,2>{0.347441465f, 0.230784208f},
-std::array<float,2>{0.526336551f, 0.641517282f},
-std::array<float,2>{0.161746785f, 0.703554869f},
-std::array<float,2>{0.771613479f, 0.175997362f},
-std::array<float,2>{0.380925208f, 0.463088781f},
-std::array<float,2>{0.62945509f, 0.946701467f},
-std::array<float,2>{0.268995076f, 0.776105881f},
-std::array<float,2>{0.576568604f, 0.250877082f},
-std::array<float,2>{0.00959685259f, 0.110319585f},
-std::array<float,2>{0.888404071f, 0.536523402f},
-std::array<float,2>{0.326800376f, 0.656736255f},
-std::array<float,2>{0.553156555f, 0.211594209f},
-std::array<float,2>{0.0675255805f, 0.436850637f},
-std::array<float,2>{0.941224158f, 0.909597516f},
-std::array<float,2>{0.194625616f, 0.840802968f},
-std::array<float,2>{0.851018906f, 0.351127803f},
-std::array<float,2>{0.443573654f, 0.00975519698f},
-std::array<float,2>{0.724714279f, 0.61259073f},
-std::array<float,2>{0.0578114577f, 0.51776737f},
-std::array<float,2>{0.926387787f, 0.0875870511f},
-std::array<float,2>{0.284818411f, 0.288591743f},
-std::array<float,2>{0.622032106f, 0.791141987f},
-std::array<float,2>{0.437240183f, 0.97145319f},
-std::array<float,2>{0.670411289f, 0.488229036f},
-std::array<float,2>{0.126236007f, 0.131257609f},
-std::array<float,2>{0.792377412f, 0.724186361f},
-std::array<float,2>{0.300242305f, 0.548447371f},
-std::array<float,2>{0.597542226f, 0.10387864f},
-std::array<float,2>{0.0321123265f, 0.275030911f},
-std::array<float,2>{0.906784356f, 0.760848284f},
-std::array<float,2>{0.148140818f, 0.954094827f},
-std::array<float,2>{0.802437067f, 0.450481564f},
-std::array<float,2>{0.42160207f, 0.170793951f},
-std::array<float,2>{0.675843954f, 0.69596386f},
-std::array<float,2>{0.0828677192f, 0.633230388f},
-std::array<float,2>{0.958309829f, 0.241117284f},
-std::array<float,2>{0.339220464f, 0.40179193f},
-std::array<float,2>{0.536120772f, 0.880879462f},
-std::array<float,2>{0.455950171f, 0.866839826f},
-std::array<float,2>{0.742798984f, 0.329160571f},
-std::array<float,2>{0.204284251f, 0.046378728f},
-std::array<float,2>{0.870154738f, 0.591488361f},
-std::array<float,2>{0.398750514f, 0.738286793f},
-std::array<float,2>{0.642528594f, 0.141213477f},
-std::array<float,2>{0.186940238f, 0.478167087f},
-std::array<float,2>{0.764095008f, 0.993490636f},
-std::array<float,2>{0.0306066759f, 0.811413288f},
-std::array<float,2>{0.899720252f, 0.301828593f},
-std::array<float,2>{0.260407597f, 0.0777152106f},
-std::array<float,2>{0.590593219f, 0.506335497f},
-std::array<float,2>{0.24331972f, 0.6090675f},
-std::array<float,2>{0.841653168f, 0.0279455334f},
-std::array<float,2>{0.485746324f, 0.369831383f},
-std::array<float,2>{0.698539972f, 0.826920807f},
-std::array<float,2>{0.374316454f, 0.923888206f},
-std::array<float,2>{0.510865092f, 0.420833319f},
-std::array<float,2>{0.110310033f, 0.194040596f},
-std::array<float,2>{0.997235954f, 0.684989572f},
-std::array<float,2>{0.393457264f, 0.583935261f},
-std::array<float,2>{0.654699206f, 0.036949195f},
-std::array<float,2>{0.172923163f, 0.336574882f},
-std::array<float,2>{0.754320323f, 0.871020198f},
-std::array<float,2>{0.020228453f, 0.885801196f},
-std::array<float,2>{0.893803716f, 0.39360109f},
-std::array<float,2>{0.254450709f, 0.246861547f},
-std::array<float,2>{0.579777896f, 0.631549239f},
-std::array<float,2>{0.236495435f, 0.688115656f},
-std::array<float,2>{0.833061814f, 0.159980759f},
-std::array<float,2>{0.499166965f, 0.437892824f},
-std::array<float,2>{0.690131485f, 0.967784464f},
-std::array<float,2>{0.366931736f, 0.752797246f},
-std::array<float,2>{0.50311327f, 0.269117415f},
-std::array<float,2>{0.118736848f, 0.0974402726f},
-std::array<float,2>{0.98637867f, 0.555607259f},
-std::array<float,2>{0.305619955f, 0.676300049f},
-std::array<float,2>{0.601563096f, 0.198029563f},
-std::array<float,2>{0.0463465229f, 0.40797174f},
-std::array<float,2>{0.918267965f, 0.933317244f},
-std::array<float,2>{0.153764129f, 0.814156413f},
-std::array<float,2>{0.805804491f, 0.3657327f},
-std::array<float,2>{0.414007783f, 0.0214837063f},
-std::array<float,2>{0.680305719f, 0.599508226f},
-std::array<float,2>{0.0862565562f, 0.515304804f},
-std::array<float,2>{0.963886797f, 0.0664642155f},
-std::array<float,2>{0.329172254f, 0.306805283f},
-std::array<float,2>{0.541951895f, 0.804133534f},
-std::array<float,2>{0.467550814f, 0.989115536f},
-std::array<float,2>{0.734401524f, 0.468967438f},
-std::array<float,2>{0.215039492f, 0.149156779f},
-std::array<float,2>{0.863250554f, 0.746486306f},
-std::array<float,2>{0.317421615f, 0.543004036f},
-std::array<float,2>{0.556242824f, 0.118058465f},
-std::array<float,2>{0.0759416446f, 0.264991939f},
-std::array<float,2>{0.948692918f, 0.769775629f},
-std::array<float,2>{0.197952554f, 0.940954149f},
-std::array<float,2>{0.852995336f, 0.460911632f},
-std::array<float,2>{0.451804698f, 0.181262612f},
-std::array<float,2>{0.728569388f, 0.717093349f},
-std::array<float,2>{0.0480720028f, 0.654956877f},
-std::array<float,2>{0.931200027f, 0.222518519f},
-std::array<float,2>{0.293764621f, 0.389707834f},
-std::array<float,2>{0.611981273f, 0.896670103f},
-std::array<float,2>{0.423700303f, 0.844070315f},
-std::array<float,2>{0.663900316f, 0.316132396f},
-std::array<float,2>{0.13351506f, 0.0611364059f},
-std::array<float,2>{0.782530963f, 0.567641079f},
-std::array<float,2>{0.469717503f, 0.728612483f},
-std::array<float,2>{0.704118013f, 0.136930645f},
-std::array<float,2>{0.220284507f, 0.493611246f},
-std::array<float,2>{0.815751433f, 0.980933309f},
-std::array<float,2>{0.0966932625f, 0.781817079f},
-std::array<float,2>{0.972926676f, 0.290313214f},
-std::array<float,2>{0.358595043f, 0.084609583f},
-std::array<float,2>{0.519728899f, 0.531138182f},
-std::array<float,2>{0.169083059f, 0.618829548f},
-std::array<float,2>{0.775660694f, 0.00240897923f},
-std::array<float,2>{0.386144221f, 0.357371569f},
-std::array<float,2>{0.635966122f, 0.828354478f},
-std::array<float,2>{0.280305803f, 0.916448832f},
-std::array<float,2>{0.565964997f, 0.428294063f},
-std::array<float,2>{0.0076940679f, 0.20737128f},
-std::array<float,2>{0.881812692f, 0.671468139f},
-std::array<float,2>{0.44442451f, 0.51608777f},
-std::array<float,2>{0.726077199f, 0.0898354128f},
-std::array<float,2>{0.193682f, 0.286265045f},
-std::array<float,2>{0.850371838f, 0.789845049f},
-std::array<float,2>{0.0669587329f, 0.968760848f},
-std::array<float,2>{0.940349162f, 0.486313164f},
-std::array<float,2>{0.32742998f, 0.129520655f},
-std::array<float,2>{0.554101825f, 0.725877702f},
-std::array<float,2>{0.125849217f, 0.659773529f},
-std::array<float,2>{0.791328728f, 0.213175461f},
-std::array<float,2>{0.436390966f, 0.434867024f},
-std::array<float,2>{0.671182275f, 0.907487273f},
-std::array<float,2>{0.284097373f, 0.842535257f},
-std::array<float,2>{0.622725248f, 0.349169075f},
-std::array<float,2>{0.0567020662f, 0.0102144368f},
-std::array<float,2>{0.927707434f, 0.610267162f},
-std::array<float,2>{0.345734447f, 0.705855966f},
-std::array<float,2>{0.527305365f, 0.178583086f},
-std::array<float,2>{0.107166201f, 0.461019933f},
-std::array<float,2>{0.984347105f, 0.947584033f},
-std::array<float,2>{0.227091774f, 0.774395823f},
-std::array<float,2>{0.826908469f, 0.252725482f},
-std::array<float,2>{0.477922231f, 0.112297229f},
-std::array<float,2>{0.715360165f, 0.537464559f},
-std::array<float,2>{0.00833475962f, 0.57712996f},
-std::array<float,2>{0.887302876f, 0.0493054017f},
-std::array<float,2>{0.267704695f, 0.326131463f},
-std::array<float,2>{0.577710092f, 0.856102467f},
-std::array<float,2>{0.382409692f, 0.905026734f},
-std::array<float,2>{0.630302668f, 0.376256138f},
-std::array<float,2>{0.161014304f, 0.233533591f},
-std::array<float,2>{0.77272737f, 0.644157648f},
-std::array<float,2>{0.261037052f, 0.605701149f},
-std::array<float,2>{0.591719329f, 0.0306773428f},
-std::array<float,2>{0.0298179165f, 0.368989676f},
-std::array<float,2>{0.898794413f, 0.825484097f},
-std::array<float,2>{0.186460972f, 0.922132373f},
-std::array<float,2>{0.765164733f, 0.418671697f},
-std::array<float,2>{0.400172681f, 0.19209145f},
-std::array<float,2>{0.64075017f, 0.685970664f},
-std::array<float,2>{0.110512666f, 0.740529299f},
-std::array<float,2>{0.996236384f, 0.143165752f},
-std::array<float,2>{0.373054862f, 0.479606003f},
-std::array<float,2>{0.510298729f, 0.996047676f},
-std::array<float,2>{0.484777898f, 0.809418917f},
-std::array<float,2>{0.697424531f, 0.304647952f},
-std::array<float,2>{0.242991701f, 0.0748747289f},
-std::array<float,2>{0.840738535f, 0.505551457f},
-std::array<float,2>{0.420048863f, 0.636632979f},
-std::array<float,2>{0.677073479f, 0.238847569f},
-std::array<float,2>{0.146726117f, 0.399858326f},
-std::array<float,2>{0.801479161f, 0.880252779f},
-std::array<float,2>{0.0331378281f, 0.864939868f},
-std::array<float,2>{0.908170581f, 0.3306247f},
-std::array<float,2>{0.299363762f, 0.0436089858f},
-std::array<float,2>{0.596413016f, 0.592546582f},
-std::array<float,2>{0.203667641f, 0.54992342f},
-std::array<float,2>{0.869747341f, 0.102729253f},
-std::array<float,2>{0.45622462f, 0.275504261f},
-std::array<float,2>{0.74333477f, 0.758062243f},
-std::array<float,2>{0.337944955f, 0.955238044f},
-std::array<float,2>{0.536584377f, 0.451192349f},
-std::array<float,2>{0.083023116f, 0.169700146f},
-std::array<float,2>{0.957413256f, 0.698316634f},
-std::array<float,2>{0.432057828f, 0.561713755f},
-std::array<float,2>{0.664779365f, 0.0990135223f},
-std::array<float,2>{0.129898548f, 0.27048409f},
-std::array<float,2>{0.796709359f, 0.757398963f},
-std::array<float,2>{0.0586035065f, 0.963731587f},
-std::array<float,2>{0.924861789f, 0.444796264f},
-std::array<float,2>{0.28788057f, 0.162437648f},
-std::array<float,2>{0.620691597f, 0.695235312f},
-std::array<float,2>{0.190410763f, 0.626265824f},
-std::array<float,2>{0.847201705f, 0.245418206f},
-std::array<float,2>{0.437595189f, 0.396927595f},
-std::array<float,2>{0.722070396f, 0.889000893f},
-std::array<float,2>{0.324023366f, 0.874625742f},
-std::array<float,2>{0.549058855f, 0.340226442f},
-std::array<float,2>{0.064022705f, 0.0340844244f},
-std::array<float,2>{0.943176866f, 0.580718994f},
-std::array<float,2>{0.270546764f, 0.742836952f},
-std::array<float,2>{0.573172867f, 0.152764559f},
-std::array<float,2>{0.0125094606f, 0.473962575f},
-std::array<float,2>{0.886196613f, 0.985499561f},
-std::array<float,2>{0.157973722f, 0.798472226f},
-std::array<float,2>{0.767250359f, 0.309355646f},
-std::array<float,2>{0.376926124f, 0.0649854988f},
-std::array<float,2>{0.62633121f, 0.50873971f},
-std::array<float,2>{0.102619104f, 0.597332776f},
-std::array<float,2>{0.978012741f, 0.0170714557f},
-std::array<float,2>{0.351253927f, 0.362630367f},
-std::array<float,2>{0.528773963f, 0.818919778f},
-std::array<float,2>{0.483805686f, 0.935515046f},
-std::array<float,2>{0.711746573f, 0.413457215f},
-std::array<float,2>{0.232252315f, 0.202071577f},
-std::array<float,2>{0.820606053f, 0.674439967f},
-std::array<float,2>{0.368375331f, 0.565956771f},
-std::array<float,2>{0.514844239f, 0.0549154878f},
-std::array<float,2>{0.116358928f, 0.316613108f},
-std::array<float,2>{0.992590785f, 0.84874028f},
-std::array<float,2>{0.247028992f, 0.893067598f},
-std::array<float,2>{0.838441193f, 0.383640766f},
-std::array<float,2>{0.489970118f, 0.224646166f},
-std::array<float,2>{0.701032221f, 0.652323544f},
-std::array<float,2>{0.0259581618f, 0.712349713f},
-std::array<float,2>{0.902359545f, 0.18663694f},
-std::array<float,2>{0.263695389f, 0.455864966f},
-std::array<float,2>{0.587439001f, 0.942816854f},
-std::array<float,2>{0.403732121f, 0.766508996f},
-std::array<float,2>{0.644932806f, 0.261588603f},
-std::array<float,2>{0.180845976f, 0.12268313f},
-std::array<float,2>{0.759782553f, 0.539392412f},
-std::array<float,2>{0.460656464f, 0.664138615f},
-std::array<float,2>{0.747585893f, 0.205067873f},
-std::array<float,2>{0.207427844f, 0.421964407f},
-std::array<float,2>{0.873735726f, 0.921026409f},
-std::array<float,2>{0.0810219795f, 0.834939003f},
-std::array<float,2>{0.956059456f, 0.351612687f},
-std::array<float,2>{0.342494398f, 0.00474267593f},
-std::array<float,2>{0.531276524f, 0.622031033f},
-std::array<float,2>{0.14218168f, 0.524745286f},
-std::array<float,2>{0.800666332f, 0.0812738761f},
-std::array<float,2>{0.415905386f, 0.295731723f},
-std::array<float,2>{0.671962261f, 0.788814664f},
-std::array<float,2>{0.302166104f, 0.978512764f},
-std::array<float,2>{0.598288834f, 0.498714805f},
-std::array<float,2>{0.0368117839f, 0.13587217f},
-std::array<float,2>{0.912558913f, 0.732608736f},
-std::array<float,2>{0.493781537f, 0.614094734f},
-std::array<float,2>{0.69425112f, 0.0122807696f},
-std::array<float,2>{0.241966084f, 0.346135288f},
-std::array<float,2>{0.829623878f, 0.838674188f},
-std::array<float,2>{0.12211895f, 0.91188544f},
-std::array<float,2>{0.990680516f, 0.431014359f},
-std::array<float,2>{0.360393524f, 0.215930626f},
-std::array<float,2>{0.507807016f, 0.662115335f},
-std::array<float,2>{0.179438829f, 0.722498417f},
-std::array<float,2>{0.750857472f, 0.126611993f},
-std::array<float,2>{0.394803971f, 0.49121502f},
-std::array<float,2>{0.651782632f, 0.974806964f},
-std::array<float,2>{0.25115037f, 0.795356035f},
-std::array<float,2>{0.585565388f, 0.284103483f},
-std::array<float,2>{0.0159098413f, 0.0916829929f},
-std::array<float,2>{0.89800787f, 0.520243347f},
-std::array<float,2>{0.333650708f, 0.646284163f},
-std::array<float,2>{0.545873284f, 0.229804039f},
-std::array<float,2>{0.091371797f, 0.382130235f},
-std::array<float,2>{0.967886865f, 0.901424646f},
-std::array<float,2>{0.211532399f, 0.853292406f},
-std::array<float,2>{0.866162837f, 0.321221799f},
-std::array<float,2>{0.461028427f, 0.0531292632f},
-std::array<float,2>{0.740767956f, 0.572360575f},
-std::array<float,2>{0.0390688442f, 0.53316474f},
-std::array<float,2>{0.916996658f, 0.115872279f},
-std::array<float,2>{0.309162796f, 0.254146516f},
-std::array<float,2>{0.605748355f, 0.779962957f},
-std::array<float,2>{0.409344345f, 0.951229692f},
-std::array<float,2>{0.684431911f, 0.467108369f},
-std::array<float,2>{0.151099026f, 0.172176763f},
-std::array<float,2>{0.810943246f, 0.709291339f},
-std::array<float,2>{0.291507155f, 0.500110686f},
-std::array<float,2>{0.616545439f, 0.0740056634f},
-std::array<float,2>{0.0542250387f, 0.300180495f},
-std::array<float,2>{0.934158862f, 0.807673097f},
-std::array<float,2>{0.139750212f, 0.997710824f},
-std::array<float,2>{0.786743999f, 0.481891364f},
-std::array<float,2>{0.427252293f, 0.148196325f},
-std::array<float,2>{0.659485996f, 0.736472309f},
-std::array<float,2>{0.0715027377f, 0.682621717f},
-std::array<float,2>{0.951346397f, 0.187783927f},
-std::array<float,2>{0.315835238f, 0.414321929f},
-std::array<float,2>{0.561534584f, 0.927535236f},
-std::array<float,2>{0.448608041f, 0.822270453f},
-std::array<float,2>{0.733476937f, 0.372309893f},
-std::array<float,2>{0.202287704f, 0.0247194469f},
-std::array<float,2>{0.855568945f, 0.602437973f},
-std::array<float,2>{0.389461845f, 0.70224756f},
-std::array<float,2>{0.638194323f, 0.164767697f},
-std::array<float,2>{0.164500684f, 0.446958154f},
-std::array<float,2>{0.777996361f, 0.959033966f},
-std::array<float,2>{0.00325447787f, 0.763644814f},
-std::array<float,2>{0.877019882f, 0.277644724f},
-std::array<float,2>{0.274277389f, 0.10569258f},
-std::array<float,2>{0.569535196f, 0.551921546f},
-std::array<float,2>{0.222706646f, 0.586207628f},
-std::array<float,2>{0.819821715f, 0.0394952707f},
-std::array<float,2>{0.474706054f, 0.335691094f},
-std::array<float,2>{0.710546553f, 0.859919548f},
-std::array<float,2>{0.355116487f, 0.876588702f},
-std::array<float,2>{0.516906142f, 0.405849934f},
-std::array<float,2>{0.0987092853f, 0.234978914f},
-std::array<float,2>{0.971862793f, 0.636951864f},
-std::array<float,2>{0.410732478f, 0.600099027f},
-std::array<float,2>{0.682859719f, 0.0234244913f},
-std::array<float,2>{0.155906498f, 0.364778072f},
-std::array<float,2>{0.808031917f, 0.816377282f},
-std::array<float,2>{0.0437709317f, 0.931230485f},
-std::array<float,2>{0.920379996f, 0.409744263f},
-std::array<float,2>{0.307714492f, 0.196479589f},
-std::array<float,2>{0.604105234f, 0.679135501f},
-std::array<float,2>{0.218165174f, 0.748829603f},
-std::array<float,2>{0.860503495f, 0.151902616f},
-std::array<float,2>{0.466513813f, 0.47228685f},
-std::array<float,2>{0.736722589f, 0.990394175f},
-std::array<float,2>{0.331383079f, 0.802063644f},
-std::array<float,2>{0.540801704f, 0.306284279f},
-std::array<float,2>{0.088273868f, 0.0685665235f},
-std::array<float,2>{0.961111069f, 0.512777984f},
-std::array<float,2>{0.25673151f, 0.629621744f},
-std::array<float,2>{0.581936955f, 0.249409094f},
-std::array<float,2>{0.0226737745f, 0.390699506f},
-std::array<float,2>{0.892014265f, 0.884636581f},
-std::array<float,2>{0.175364703f, 0.867828488f},
-std::array<float,2>{0.756798029f, 0.339210272f},
-std::array<float,2>{0.390851438f, 0.0387032479f},
-std::array<float,2>{0.653563201f, 0.585274339f},
-std::array<float,2>{0.120104335f, 0.557889819f},
-std::array<float,2>{0.985174835f, 0.0942227542f},
-std::array<float,2>{0.364792794f, 0.266142339f},
-std::array<float,2>{0.501876235f, 0.751608312f},
-std::array<float,2>{0.497063816f, 0.964920819f},
-std::array<float,2>{0.688425601f, 0.440317929f},
-std::array<float,2>{0.235376462f, 0.157503426f},
-std::array<float,2>{0.834077418f, 0.690067828f},
-std::array<float,2>{0.356883407f, 0.527631223f},
-std::array<float,2>{0.52264446f, 0.0839175731f},
-std::array<float,2>{0.0939867049f, 0.291303694f},
-std::array<float,2>{0.97464931f, 0.783580959f},
-std::array<float,2>{0.221763805f, 0.982927799f},
-std::array<float,2>{0.813003361f, 0.495695621f},
-std::array<float,2>{0.472601891f, 0.139677286f},
-std::array<float,2>{0.705400348f, 0.728044152f},
-std::array<float,2>{0.00399342692f, 0.669586658f},
-std::array<float,2>{0.879562676f, 0.209962159f},
-std::array<float,2>{0.278220087f, 0.425876558f},
-std::array<float,2>{0.56404388f, 0.91459465f},
-std::array<float,2>{0.383201301f, 0.830420613f},
-std::array<float,2>{0.634142041f, 0.358546793f},
-std::array<float,2>{0.170007184f, 0.00118072028f},
-std::array<float,2>{0.773783505f, 0.61918962f},
-std::array<float,2>{0.450908005f, 0.716249049f},
-std::array<float,2>{0.728174567f, 0.182164073f},
-std::array<float,2>{0.196937755f, 0.457931161f},
-std::array<float,2>{0.854938507f, 0.939447343f},
-std::array<float,2>{0.0761930943f, 0.7719118f},
-std::array<float,2>{0.946975291f, 0.262972862f},
-std::array<float,2>{0.319455117f, 0.12076506f},
-std::array<float,2>{0.557122409f, 0.545586407f},
-std::array<float,2>{0.136646256f, 0.568493783f},
-std::array<float,2>{0.784095347f, 0.0601011328f},
-std::array<float,2>{0.424169302f, 0.313174009f},
-std::array<float,2>{0.661075056f, 0.84577167f},
-std::array<float,2>{0.295385301f, 0.896054089f},
-std::array<float,2>{0.61107856f, 0.387686431f},
-std::array<float,2>{0.0506983101f, 0.220514402f},
-std::array<float,2>{0.932900012f, 0.652784646f},
-std::array<float,2>{0.479651392f, 0.536314905f},
-std::array<float,2>{0.718182266f, 0.110069722f},
-std::array<float,2>{0.228691846f, 0.250687033f},
-std::array<float,2>{0.825403154f, 0.776158333f},
-std::array<float,2>{0.108726643f, 0.946451724f},
-std::array<float,2>{0.981167734f, 0.463204414f},
-std::array<float,2>{0.345653325f, 0.176166609f},
-std::array<float,2>{0.52371788f, 0.703147888f},
-std::array<float,2>{0.162412688f, 0.641281486f},
-std::array<float,2>{0.77133733f, 0.230531991f},
-std::array<float,2>{0.380838603f, 0.377198637f},
-std::array<float,2>{0.632421792f, 0.903816938f},
-std::array<float,2>{0.26649791f, 0.857423365f},
-std::array<float,2>{0.57474947f, 0.327075809f},
-std::array<float,2>{0.00985737704f, 0.0485696346f},
-std::array<float,2>{0.890473723f, 0.574248612f},
-std::array<float,2>{0.325919956f, 0.724523306f},
-std::array<float,2>{0.552486539f, 0.130889505f},
-std::array<float,2>{0.0697652623f, 0.48793906f},
-std::array<float,2>{0.938613772f, 0.971265078f},
-std::array<float,2>{0.191656858f, 0.791334212f},
-std::array<float,2>{0.848452866f, 0.288962811f},
-std::array<float,2>{0.442883432f, 0.0877536014f},
-std::array<float,2>{0.722861469f, 0.517904937f},
-std::array<float,2>{0.056329079f, 0.612311363f},
-std::array<float,2>{0.92804265f, 0.00935707055f},
-std::array<float,2>{0.281560242f, 0.351358563f},
-std::array<float,2>{0.623969853f, 0.84033972f},
-std::array<float,2>{0.434289664f, 0.909292042f},
-std::array<float,2>{0.669565618f, 0.436579138f},
-std::array<float,2>{0.127543882f, 0.211828873f},
-std::array<float,2>{0.790728807f, 0.656473637f},
-std::array<float,2>{0.297751814f, 0.591633499f},
-std::array<float,2>{0.594164848f, 0.0459442846f},
-std::array<float,2>{0.0333210714f, 0.329473227f},
-std::array<float,2>{0.908885539f, 0.867151797f},
-std::array<float,2>{0.146383971f, 0.881232142f},
-std::array<float,2>{0.803355575f, 0.401570261f},
-std::array<float,2>{0.41876778f, 0.240738451f},
-std::array<float,2>{0.677858949f, 0.633002162f},
-std::array<float,2>{0.0844061971f, 0.696122885f},
-std::array<float,2>{0.958993912f, 0.170561403f},
-std::array<float,2>{0.337517887f, 0.450281024f},
-std::array<float,2>{0.538128853f, 0.953804493f},
-std::array<float,2>{0.45466581f, 0.761018574f},
-std::array<float,2>{0.745752573f, 0.275191396f},
-std::array<float,2>{0.20694682f, 0.10352844f},
-std::array<float,2>{0.868422031f, 0.548810959f},
-std::array<float,2>{0.400648952f, 0.684773088f},
-std::array<float,2>{0.643623114f, 0.19427231f},
-std::array<float,2>{0.183785349f, 0.420580268f},
-std::array<float,2>{0.761913538f, 0.924151182f},
-std::array<float,2>{0.0286876336f, 0.826672435f},
-std::array<float,2>{0.902167678f, 0.36991635f},
-std::array<float,2>{0.259217769f, 0.028166255f},
-std::array<float,2>{0.592686713f, 0.609216452f},
-std::array<float,2>{0.245992631f, 0.505867541f},
-std::array<float,2>{0.84328711f, 0.0778889135f},
-std::array<float,2>{0.486880839f, 0.302203238f},
-std::array<float,2>{0.695663452f, 0.811102986f},
-std::array<float,2>{0.372922599f, 0.993360341f},
-std::array<float,2>{0.508666754f, 0.478508294f},
-std::array<float,2>{0.112440176f, 0.141595781f},
-std::array<float,2>{0.998947561f, 0.738643825f},
-std::array<float,2>{0.37806651f, 0.51139456f},
-std::array<float,2>{0.628259003f, 0.0644445047f},
-std::array<float,2>{0.158991084f, 0.311716616f},
-std::array<float,2>{0.768725812f, 0.799040258f},
-std::array<float,2>{0.014498869f, 0.988063812f},
-std::array<float,2>{0.883026958f, 0.47639361f},
-std::array<float,2>{0.27231878f, 0.155373842f},
-std::array<float,2>{0.571720004f, 0.745173633f},
-std::array<float,2>{0.23411645f, 0.672472775f},
-std::array<float,2>{0.823906779f, 0.199497938f},
-std::array<float,2>{0.480793387f, 0.411435843f},
-std::array<float,2>{0.713777721f, 0.93698281f},
-std::array<float,2>{0.348492473f, 0.816529214f},
-std::array<float,2>{0.530931592f, 0.359959275f},
-std::array<float,2>{0.104014397f, 0.0184972733f},
-std::array<float,2>{0.979725063f, 0.594263196f},
-std::array<float,2>{0.285539985f, 0.69267422f},
-std::array<float,2>{0.618782938f, 0.161142856f},
-std::array<float,2>{0.0609075017f, 0.442516774f},
-std::array<float,2>{0.92221874f, 0.961417317f},
-std::array<float,2>{0.131069973f, 0.754350364f},
-std::array<float,2>{0.793917954f, 0.272858351f},
-std::array<float,2>{0.429924875f, 0.100496255f},
-std::array<float,2>{0.666850626f, 0.560043931f},
-std::array<float,2>{0.0657934323f, 0.578313291f},
-std::array<float,2>{0.944084585f, 0.0323641151f},
-std::array<float,2>{0.321668595f, 0.341816753f},
-std::array<float,2>{0.547761798f, 0.871801376f},
-std::array<float,2>{0.439619422f, 0.886849284f},
-std::array<float,2>{0.718919992f, 0.39634186f},
-std::array<float,2>{0.188013896f, 0.243550673f},
-std::array<float,2>{0.84519577f, 0.628672302f},
-std::array<float,2>{0.340851992f, 0.624817789f},
-std::array<float,2>{0.534746826f, 0.00680334959f},
-std::array<float,2>{0.0795978308f, 0.354762465f},
-std::array<float,2>{0.953329802f, 0.833965242f},
-std::array<float,2>{0.210802644f, 0.918644428f},
-std::array<float,2>{0.871449471f, 0.424259961f},
-std::array<float,2>{0.457063496f, 0.205153853f},
-std::array<float,2>{0.748938382f, 0.666833401f},
-std::array<float,2>{0.0374842361f, 0.732032597f},
-std::array<float,2>{0.910992622f, 0.134479016f},
-std::array<float,2>{0.30375877f, 0.496925533f},
-std::array<float,2>{0.599617481f, 0.980008781f},
-std::array<float,2>{0.417298853f, 0.785609365f},
-std::array<float,2>{0.674494207f, 0.294104218f},
-std::array<float,2>{0.144255713f, 0.0795391798f},
-std::array<float,2>{0.798505366f, 0.526576877f},
-std::array<float,2>{0.491961539f, 0.649582922f},
-std::array<float,2>{0.702937365f, 0.223539397f},
-std::array<float,2>{0.24915199f, 0.385603189f},
-std::array<float,2>{0.836924791f, 0.890648603f},
-std::array<float,2>{0.115112625f, 0.850251019f},
-std::array<float,2>{0.99580431f, 0.320195168f},
-std::array<float,2>{0.370263368f, 0.05821646f},
-std::array<float,2>{0.513221383f, 0.564442277f},
-std::array<float,2>{0.183001861f, 0.54151684f},
-std::array<float,2>{0.758274198f, 0.123115666f},
-std::array<float,2>{0.40470168f, 0.258906245f},
-std::array<float,2>{0.647894979f, 0.767724812f},
-std::array<float,2>{0.262460262f, 0.944757164f},
-std::array<float,2>{0.589443564f, 0.454292476f},
-std::array<float,2>{0.0240225699f, 0.184941739f},
-std::array<float,2>{0.905599654f, 0.713986456f},
-std::array<float,2>{0.464203954f, 0.571979344f},
-std::array<float,2>{0.738752902f, 0.0521093793f},
-std::array<float,2>{0.212931097f, 0.322376549f},
-std::array<float,2>{0.864372849f, 0.853544652f},
-std::array<float,2>{0.0919888616f, 0.900265396f},
-std::array<float,2>{0.965266824f, 0.379363269f},
-std::array<float,2>{0.335884601f, 0.226886109f},
-std::array<float,2>{0.544331491f, 0.647572935f},
-std::array<float,2>{0.150029868f, 0.707257688f},
-std::array<float,2>{0.81014967f, 0.174913719f},
-std::array<float,2>{0.406639546f, 0.46537897f},
-std::array<float,2>{0.685985804f, 0.950220287f},
-std::array<float,2>{0.31143856f, 0.779164255f},
-std::array<float,2>{0.608453929f, 0.256994843f},
-std::array<float,2>{0.0428352468f, 0.113733694f},
-std::array<float,2>{0.915932655f, 0.533911705f},
-std::array<float,2>{0.362105012f, 0.660568655f},
-std::array<float,2>{0.504299521f, 0.216817662f},
-std::array<float,2>{0.123841368f, 0.432731479f},
-std::array<float,2>{0.98943454f, 0.913717031f},
-std::array<float,2>{0.239881098f, 0.836372435f},
-std::array<float,2>{0.830346167f, 0.345350236f},
-std::array<float,2>{0.495940596f, 0.0146706821f},
-std::array<float,2>{0.692807019f, 0.616722047f},
-std::array<float,2>{0.0176575985f, 0.52232337f},
-std::array<float,2>{0.895619452f, 0.0918334648f},
-std::array<float,2>{0.253739566f, 0.282665879f},
-std::array<float,2>{0.582394958f, 0.793378115f},
-std::array<float,2>{0.396502197f, 0.974596739f},
-std::array<float,2>{0.649825037f, 0.490002096f},
-std::array<float,2>{0.175978124f, 0.12763837f},
-std::array<float,2>{0.752985597f, 0.719546497f},
-std::array<float,2>{0.27559033f, 0.55461967f},
-std::array<float,2>{0.566749692f, 0.108089045f},
-std::array<float,2>{0.0015290539f, 0.280466735f},
-std::array<float,2>{0.876587927f, 0.764009893f},
-std::array<float,2>{0.166521356f, 0.958081067f},
-std::array<float,2>{0.780884683f, 0.44800058f},
-std::array<float,2>{0.387248069f, 0.167201802f},
-std::array<float,2>{0.638852477f, 0.69969362f},
-std::array<float,2>{0.100649007f, 0.640237749f},
-std::array<float,2>{0.970510125f, 0.237828553f},
-std::array<float,2>{0.351570904f, 0.403276145f},
-std::array<float,2>{0.517715573f, 0.878088176f},
-std::array<float,2>{0.473597199f, 0.86318934f},
-std::array<float,2>{0.708929121f, 0.333531469f},
-std::array<float,2>{0.224776164f, 0.0419322662f},
-std::array<float,2>{0.816650927f, 0.589771926f},
-std::array<float,2>{0.428494334f, 0.73579675f},
-std::array<float,2>{0.658089221f, 0.146327272f},
-std::array<float,2>{0.137837872f, 0.483853281f},
-std::array<float,2>{0.787969232f, 0.99953872f},
-std::array<float,2>{0.0521327406f, 0.806402862f},
-std::array<float,2>{0.936568797f, 0.297418267f},
-std::array<float,2>{0.290005803f, 0.0704093501f},
-std::array<float,2>{0.614961743f, 0.503399372f},
-std::array<float,2>{0.201100931f, 0.603981256f},
-std::array<float,2>{0.858514488f, 0.02621511f},
-std::array<float,2>{0.446235657f, 0.373543143f},
-std::array<float,2>{0.731931031f, 0.820882082f},
-std::array<float,2>{0.31378758f, 0.928233325f},
-std::array<float,2>{0.559359431f, 0.416163474f},
-std::array<float,2>{0.0726656616f, 0.189729318f},
-std::array<float,2>{0.950708747f, 0.68142277f},
-std::array<float,2>{0.424979717f, 0.567329824f},
-std::array<float,2>{0.661817372f, 0.0620326772f},
-std::array<float,2>{0.13483198f, 0.314811766f},
-std::array<float,2>{0.784759343f, 0.845606327f},
-std::array<float,2>{0.0494980104f, 0.898121178f},
-std::array<float,2>{0.932023644f, 0.389520884f},
-std::array<float,2>{0.296788663f, 0.220840722f},
-std::array<float,2>{0.609409332f, 0.656160176f},
-std::array<float,2>{0.195398197f, 0.718363583f},
-std::array<float,2>{0.854354978f, 0.180015996f},
-std::array<float,2>{0.449802637f, 0.459423542f},
-std::array<float,2>{0.726796329f, 0.939970613f},
-std::array<float,2>{0.319123894f, 0.770891964f},
-std::array<float,2>{0.558045268f, 0.263875902f},
-std::array<float,2>{0.0777894184f, 0.11828351f},
-std::array<float,2>{0.94598186f, 0.544847071f},
-std::array<float,2>{0.278630227f, 0.670416474f},
-std::array<float,2>{0.563370705f, 0.208341449f},
-std::array<float,2>{0.00525178853f, 0.429152519f},
-std::array<float,2>{0.880344272f, 0.917069972f},
-std::array<float,2>{0.171386659f, 0.829657435f},
-std::array<float,2>{0.775276124f, 0.356269807f},
-std::array<float,2>{0.384253383f, 0.00332020503f},
-std::array<float,2>{0.633197129f, 0.617802978f},
-std::array<float,2>{0.0952949375f, 0.529318631f},
-std::array<float,2>{0.975700855f, 0.0853157043f},
-std::array<float,2>{0.356315583f, 0.290004253f},
-std::array<float,2>{0.521617651f, 0.782833815f},
-std::array<float,2>{0.471371949f, 0.981813729f},
-std::array<float,2>{0.706126213f, 0.49280861f},
-std::array<float,2>{0.221593544f, 0.138096556f},
-std::array<float,2>{0.814079463f, 0.730181038f},
-std::array<float,2>{0.363883018f, 0.555870771f},
-std::array<float,2>{0.500471175f, 0.0964383036f},
-std::array<float,2>{0.120635398f, 0.268540472f},
-std::array<float,2>{0.985445082f, 0.753590405f},
-std::array<float,2>{0.23446162f, 0.967344403f},
-std::array<float,2>{0.835838258f, 0.438662976f},
-std::array<float,2>{0.498009443f, 0.158208907f},
-std::array<float,2>{0.688888133f, 0.68941766f},
-std::array<float,2>{0.0219311658f, 0.631980538f},
-std::array<float,2>{0.890628695f, 0.247457057f},
-std::array<float,2>{0.257002264f, 0.393198013f},
-std::array<float,2>{0.580189824f, 0.885270059f},
-std::array<float,2>{0.391710579f, 0.869634032f},
-std::array<float,2>{0.652380228f, 0.3373833f},
-std::array<float,2>{0.173977971f, 0.0353056788f},
-std::array<float,2>{0.756953478f, 0.582401156f},
-std::array<float,2>{0.465458274f, 0.747685969f},
-std::array<float,2>{0.737498105f, 0.149964392f},
-std::array<float,2>{0.216914222f, 0.470435053f},
-std::array<float,2>{0.859940529f, 0.990231216f},
-std::array<float,2>{0.0895691589f, 0.803157687f},
-std::array<float,2>{0.96208328f, 0.308266759f},
-std::array<float,2>{0.330307662f, 0.0676500276f},
-std::array<float,2>{0.53915298f, 0.514375627f},
-std::array<float,2>{0.155197933f, 0.597779572f},
-std::array<float,2>{0.807315409f, 0.0202580839f},
-std::array<float,2>{0.412005126f, 0.366826802f},
-std::array<float,2>{0.681816339f, 0.813065708f},
-std::array<float,2>{0.306747228f, 0.932549238f},
-std::array<float,2>{0.605123699f, 0.406606704f},
-std::array<float,2>{0.0447644554f, 0.198246822f},
-std::array<float,2>{0.921855628f, 0.676951528f},
-std::array<float,2>{0.48799181f, 0.504753232f},
-std::array<float,2>{0.697154522f, 0.0760538504f},
-std::array<float,2>{0.245022669f, 0.303003848f},
-std::array<float,2>{0.842048466f, 0.809677303f},
-std::array<float,2>{0.111561328f, 0.995078683f},
-std::array<float,2>{0.999450028f, 0.478647232f},
-std::array<float,2>{0.371766746f, 0.144054607f},
-std::array<float,2>{0.50893712f, 0.741763651f},
-std::array<float,2>{0.185376793f, 0.687313974f},
-std::array<float,2>{0.763659f, 0.192456275f},
-std::array<float,2>{0.401417702f, 0.419271916f},
-std::array<float,2>{0.643522501f, 0.923668325f},
-std::array<float,2>{0.258727193f, 0.824269772f},
-std::array<float,2>{0.593390644f, 0.367561787f},
-std::array<float,2>{0.0278047994f, 0.0301588047f},
-std::array<float,2>{0.901193976f, 0.606568754f},
-std::array<float,2>{0.336866945f, 0.697554588f},
-std::array<float,2>{0.537442267f, 0.168662056f},
-std::array<float,2>{0.0854997262f, 0.452764243f},
-std::array<float,2>{0.960909009f, 0.956203043f},
-std::array<float,2>{0.205892235f, 0.758940756f},
-std::array<float,2>{0.867778182f, 0.277025759f},
-std::array<float,2>{0.453263581f, 0.101984672f},
-std::array<float,2>{0.744340181f, 0.549687266f},
-std::array<float,2>{0.0344339795f, 0.59314096f},
-std::array<float,2>{0.909308732f, 0.0447732881f},
-std::array<float,2>{0.298031777f, 0.331910759f},
-std::array<float,2>{0.59507972f, 0.863533676f},
-std::array<float,2>{0.419398248f, 0.879162073f},
-std::array<float,2>{0.678772509f, 0.399178654f},
-std::array<float,2>{0.144913957f, 0.239600703f},
-std::array<float,2>{0.80462718f, 0.634935975f},
-std::array<float,2>{0.282307267f, 0.610810161f},
-std::array<float,2>{0.624953151f, 0.010857732f},
-std::array<float,2>{0.0551067851f, 0.347910821f},
-std::array<float,2>{0.929270864f, 0.843212068f},
-std::array<float,2>{0.1280348f, 0.906951308f},
-std::array<float,2>{0.789234281f, 0.433697551f},
-std::array<float,2>{0.434967458f, 0.214061216f},
-std::array<float,2>{0.668547869f, 0.658897758f},
-std::array<float,2>{0.0690589473f, 0.724791825f},
-std::array<float,2>{0.938040137f, 0.130501971f},
-std::array<float,2>{0.325064987f, 0.484453022f},
-std::array<float,2>{0.551731825f, 0.970281959f},
-std::array<float,2>{0.44187364f, 0.790245771f},
-std::array<float,2>{0.724317074f, 0.285845935f},
-std::array<float,2>{0.192648515f, 0.0888520926f},
-std::array<float,2>{0.849397242f, 0.516763866f},
-std::array<float,2>{0.379683673f, 0.643127561f},
-std::array<float,2>{0.63161701f, 0.232627049f},
-std::array<float,2>{0.163767502f, 0.375705838f},
-std::array<float,2>{0.769558012f, 0.906108439f},
-std::array<float,2>{0.0108528873f, 0.857167184f},
-std::array<float,2>{0.889301181f, 0.325075626f},
-std::array<float,2>{0.267496079f, 0.050572101f},
-std::array<float,2>{0.576023638f, 0.577341676f},
-std::array<float,2>{0.229844883f, 0.538569033f},
-std::array<float,2>{0.824347794f, 0.112533346f},
-std::array<float,2>{0.479319543f, 0.252954274f},
-std::array<float,2>{0.717249274f, 0.774506807f},
-std::array<float,2>{0.344031662f, 0.948593497f},
-std::array<float,2>{0.525070012f, 0.462498665f},
-std::array<float,2>{0.108346894f, 0.178832993f},
-std::array<float,2>{0.982306659f, 0.706668913f},
-std::array<float,2>{0.405789495f, 0.540569961f},
-std::array<float,2>{0.646823764f, 0.121176586f},
-std::array<float,2>{0.181915805f, 0.260372967f},
-std::array<float,2>{0.759082139f, 0.766670823f},
-std::array<float,2>{0.024878297f, 0.942159355f},
-std::array<float,2>{0.905072868f, 0.456141114f},
-std::array<float,2>{0.262813956f, 0.186179861f},
-std::array<float,2>{0.588747442f, 0.711567402f},
-std::array<float,2>{0.248082727f, 0.650995076f},
-std::array<float,2>{0.836404562f, 0.225930586f},
-std::array<float,2>{0.491103053f, 0.384129882f},
-std::array<float,2>{0.701998234f, 0.894190967f},
-std::array<float,2>{0.369913936f, 0.847954214f},
-std::array<float,2>{0.512149274f, 0.317894369f},
-std::array<float,2>{0.114039749f, 0.0565660298f},
-std::array<float,2>{0.9947263f, 0.565349162f},
-std::array<float,2>{0.303541273f, 0.733751357f},
-std::array<float,2>{0.600780785f, 0.135656074f},
-std::array<float,2>{0.0386485755f, 0.499236286f},
-std::array<float,2>{0.911935389f, 0.977012098f},
-std::array<float,2>{0.143142641f, 0.787113667f},
-std::array<float,2>{0.797318578f, 0.29681614f},
-std::array<float,2>{0.416869372f, 0.0809162185f},
-std::array<float,2>{0.675569654f, 0.523489594f},
-std::array<float,2>{0.0789763704f, 0.623013198f},
-std::array<float,2>{0.954170167f, 0.00491320156f},
-std::array<float,2>{0.33994171f, 0.35306415f},
-std::array<float,2>{0.533791184f, 0.835141778f},
-std::array<float,2>{0.458092898f, 0.920841873f},
-std::array<float,2>{0.749924779f, 0.423064411f},
-std::array<float,2>{0.20968619f, 0.204074576f},
-std::array<float,2>{0.872271121f, 0.665286124f},
-std::array<float,2>{0.321277827f, 0.581125498f},
-std::array<float,2>{0.548302054f, 0.0346883871f},
-std::array<float,2>{0.0649239421f, 0.341617346f},
-std::array<float,2>{0.944584191f, 0.873171329f},
-std::array<float,2>{0.188607007f, 0.890311897f},
-std::array<float,2>{0.844301224f, 0.397613138f},
-std::array<float,2>{0.441200674f, 0.245078847f},
-std::array<float,2>{0.719932914f, 0.62588501f},
-std::array<float,2>{0.0615890585f, 0.693766892f},
-std::array<float,2>{0.923112214f, 0.163323566f},
-std::array<float,2>{0.286359012f, 0.443588227f},
-std::array<float,2>{0.617368996f, 0.964247584f},
-std::array<float,2>{0.431354314f, 0.756123841f},
-std::array<float,2>{0.667075992f, 0.27072832f},
-std::array<float,2>{0.132624745f, 0.0980208963f},
-std::array<float,2>{0.793968797f, 0.561169803f},
-std::array<float,2>{0.481832743f, 0.674998522f},
-std::array<float,2>{0.714217484f, 0.20273149f},
-std::array<float,2>{0.232989952f, 0.412554979f},
-std::array<float,2>{0.822430849f, 0.934184432f},
-std::array<float,2>{0.104936041f, 0.819406152f},
-std::array<float,2>{0.978928208f, 0.361503035f},
-std::array<float,2>{0.349604934f, 0.0156259667f},
-std::array<float,2>{0.529954851f, 0.596526146f},
-std::array<float,2>{0.160075188f, 0.509725749f},
-std::array<float,2>{0.768009126f, 0.0662620962f},
-std::array<float,2>{0.377358764f, 0.310446501f},
-std::array<float,2>{0.627242863f, 0.797533989f},
-std::array<float,2>{0.273224294f, 0.985284388f},
-std::array<float,2>{0.570500135f, 0.472776324f},
-std::array<float,2>{0.0147898225f, 0.154127017f},
-std::array<float,2>{0.884165108f, 0.743288398f},
-std::array<float,2>{0.446598202f, 0.603456557f},
-std::array<float,2>{0.730721056f, 0.0235707369f},
-std::array<float,2>{0.200043947f, 0.371121913f},
-std::array<float,2>{0.858085871f, 0.824039102f},
-std::array<float,2>{0.0738029033f, 0.926445723f},
-std::array<float,2>{0.949907243f, 0.416003615f},
-std::array<float,2>{0.31330362f, 0.189133629f},
-std::array<float,2>{0.560469925f, 0.6821329f},
-std::array<float,2>{0.137285084f, 0.737704337f},
-std::array<float,2>{0.788748085f, 0.14674902f},
-std::array<float,2>{0.42950961f, 0.481324166f},
-std::array<float,2>{0.656616211f, 0.996239305f},
-std::array<float,2>{0.290077597f, 0.807537019f},
-std::array<float,2>{0.614128232f, 0.299568206f},
-std::array<float,2>{0.0512856841f, 0.0725511014f},
-std::array<float,2>{0.936517894f, 0.501701176f},
-std::array<float,2>{0.353379488f, 0.637788415f},
-std::array<float,2>{0.518796802f, 0.235363483f},
-std::array<float,2>{0.100119784f, 0.404741257f},
-std::array<float,2>{0.968861341f, 0.875339508f},
-std::array<float,2>{0.226158246f, 0.860691547f},
-std::array<float,2>{0.817520142f, 0.33452782f},
-std::array<float,2>{0.474454224f, 0.0405696183f},
-std::array<float,2>{0.707068324f, 0.587079287f},
-std::array<float,2>{0.000438946008f, 0.551535904f},
-std::array<float,2>{0.875784397f, 0.107105181f},
-std::array<float,2>{0.276815146f, 0.278699517f},
-std::array<float,2>{0.567481339f, 0.761746347f},
-std::array<float,2>{0.388286561f, 0.960244656f},
-std::array<float,2>{0.640336514f, 0.44598788f},
-std::array<float,2>{0.16767177f, 0.165303022f},
-std::array<float,2>{0.77955699f, 0.702089846f},
-std::array<float,2>{0.25257799f, 0.520764291f},
-std::array<float,2>{0.583861947f, 0.0899840668f},
-std::array<float,2>{0.0186014771f, 0.28465119f},
-std::array<float,2>{0.894699812f, 0.79670763f},
-std::array<float,2>{0.177271664f, 0.976294935f},
-std::array<float,2>{0.752914667f, 0.490484148f},
-std::array<float,2>{0.398135692f, 0.125490069f},
-std::array<float,2>{0.649151564f, 0.721147358f},
-std::array<float,2>{0.124317482f, 0.663996339f},
-std::array<float,2>{0.989103258f, 0.215451926f},
-std::array<float,2>{0.362935185f, 0.430354297f},
-std::array<float,2>{0.505560338f, 0.910621285f},
-std::array<float,2>{0.494943202f, 0.83899188f},
-std::array<float,2>{0.691476524f, 0.347259492f},
-std::array<float,2>{0.239183724f, 0.0135569591f},
-std::array<float,2>{0.831201553f, 0.615193248f},
-std::array<float,2>{0.407313496f, 0.709961772f},
-std::array<float,2>{0.687351525f, 0.173149139f},
-std::array<float,2>{0.148638457f, 0.46859476f},
-std::array<float,2>{0.808759391f, 0.952173352f},
-std::array<float,2>{0.0419451855f, 0.780355513f},
-std::array<float,2>{0.914511979f, 0.255760074f},
-std::array<float,2>{0.312008023f, 0.116214953f},
-std::array<float,2>{0.6080634f, 0.531843305f},
-std::array<float,2>{0.214683339f, 0.573652029f},
-std::array<float,2>{0.863868713f, 0.0541237779f},
-std::array<float,2>{0.463766694f, 0.321905017f},
-std::array<float,2>{0.739501655f, 0.851628721f},
-std::array<float,2>{0.334425509f, 0.900431573f},
-std::array<float,2>{0.5430094f, 0.381660044f},
-std::array<float,2>{0.0933182091f, 0.229191288f},
-std::array<float,2>{0.96608305f, 0.644771695f},
-std::array<float,2>{0.38537851f, 0.620795012f},
-std::array<float,2>{0.635332704f, 0.000482201285f},
-std::array<float,2>{0.168795943f, 0.35801369f},
-std::array<float,2>{0.777098298f, 0.831545234f},
-std::array<float,2>{0.0065343082f, 0.915439367f},
-std::array<float,2>{0.882584155f, 0.427131712f},
-std::array<float,2>{0.279824734f, 0.208997354f},
-std::array<float,2>{0.564593792f, 0.668007731f},
-std::array<float,2>{0.219413742f, 0.726687849f},
-std::array<float,2>{0.815079033f, 0.139204726f},
-std::array<float,2>{0.470643103f, 0.494204104f},
-std::array<float,2>{0.703516901f, 0.984354556f},
-std::array<float,2>{0.358230501f, 0.784587443f},
-std::array<float,2>{0.521238148f, 0.292692661f},
-std::array<float,2>{0.0963019207f, 0.0828117877f},
-std::array<float,2>{0.974565625f, 0.528841496f},
-std::array<float,2>{0.294733584f, 0.653869867f},
-std::array<float,2>{0.612373114f, 0.219092816f},
-std::array<float,2>{0.0472254604f, 0.388462037f},
-std::array<float,2>{0.930627108f, 0.894692957f},
-std::array<float,2>{0.133998916f, 0.846834004f},
-std::array<float,2>{0.781490922f, 0.314185739f},
-std::array<float,2>{0.422071993f, 0.0590361319f},
-std::array<float,2>{0.662514985f, 0.570270419f},
-std::array<float,2>{0.0748895407f, 0.54664284f},
-std::array<float,2>{0.947523773f, 0.119260974f},
-std::array<float,2>{0.3164078f, 0.262192845f},
-std::array<float,2>{0.555319726f, 0.772934139f},
-std::array<float,2>{0.452987283f, 0.93842274f},
-std::array<float,2>{0.730443299f, 0.45886901f},
-std::array<float,2>{0.19836092f, 0.183548674f},
-std::array<float,2>{0.852205276f, 0.715099096f},
-std::array<float,2>{0.328926414f, 0.511791766f},
-std::array<float,2>{0.542361915f, 0.0698283091f},
-std::array<float,2>{0.0871045887f, 0.304830849f},
-std::array<float,2>{0.962993503f, 0.801061094f},
-std::array<float,2>{0.216766611f, 0.991762877f},
-std::array<float,2>{0.862245202f, 0.471265078f},
-std::array<float,2>{0.467857897f, 0.150606498f},
-std::array<float,2>{0.735805213f, 0.749761283f},
-std::array<float,2>{0.0456990376f, 0.677957475f},
-std::array<float,2>{0.919721067f, 0.196049273f},
-std::array<float,2>{0.306034327f, 0.408256352f},
-std::array<float,2>{0.60338819f, 0.929697692f},
-std::array<float,2>{0.412362576f, 0.814726412f},
-std::array<float,2>{0.681342602f, 0.364207983f},
-std::array<float,2>{0.152617425f, 0.0219632611f},
-std::array<float,2>{0.805406272f, 0.601287842f},
-std::array<float,2>{0.498530895f, 0.691078842f},
-std::array<float,2>{0.690914989f, 0.156666741f},
-std::array<float,2>{0.237572506f, 0.44121024f},
-std::array<float,2>{0.832641244f, 0.966567457f},
-std::array<float,2>{0.117632434f, 0.750529766f},
-std::array<float,2>{0.987837732f, 0.266951859f},
-std::array<float,2>{0.366018742f, 0.095635578f},
-std::array<float,2>{0.501997113f, 0.557056546f},
-std::array<float,2>{0.17229332f, 0.584185958f},
-std::array<float,2>{0.755222261f, 0.0374010541f},
-std::array<float,2>{0.393909723f, 0.338785529f},
-std::array<float,2>{0.655424535f, 0.868200064f},
-std::array<float,2>{0.255359679f, 0.883098841f},
-std::array<float,2>{0.57905221f, 0.392069519f},
-std::array<float,2>{0.0214741193f, 0.248254091f},
-std::array<float,2>{0.893459201f, 0.63064903f},
-std::array<float,2>{0.455174416f, 0.547655642f},
-std::array<float,2>{0.742246389f, 0.105197847f},
-std::array<float,2>{0.204895139f, 0.273986399f},
-std::array<float,2>{0.87063235f, 0.760153115f},
-std::array<float,2>{0.0823104978f, 0.954454422f},
-std::array<float,2>{0.958548307f, 0.450069398f},
-std::array<float,2>{0.339440465f, 0.171033338f},
-std::array<float,2>{0.535218835f, 0.696923256f},
-std::array<float,2>{0.147537142f, 0.634552598f},
-std::array<float,2>{0.801899254f, 0.24189952f},
-std::array<float,2>{0.421217859f, 0.400526404f},
-std::array<float,2>{0.676397741f, 0.882320762f},
-std::array<float,2>{0.300422877f, 0.865804851f},
-std::array<float,2>{0.596976995f, 0.329086304f},
-std::array<float,2>{0.0313650221f, 0.0455047563f},
-std::array<float,2>{0.906735837f, 0.590561211f},
-std::array<float,2>{0.374518752f, 0.739842534f},
-std::array<float,2>{0.511679828f, 0.14231497f},
-std::array<float,2>{0.10971985f, 0.477490813f},
-std::array<float,2>{0.997823596f, 0.992525041f},
-std::array<float,2>{0.243659347f, 0.812122047f},
-std::array<float,2>{0.840922594f, 0.301681757f},
-std::array<float,2>{0.486029267f, 0.0768799856f},
-std::array<float,2>{0.699006736f, 0.507381201f},
-std::array<float,2>{0.0308681447f, 0.60836339f},
-std::array<float,2>{0.900047541f, 0.0290831197f},
-std::array<float,2>{0.260252327f, 0.3706716f},
-std::array<float,2>{0.590031028f, 0.827871382f},
-std::array<float,2>{0.399028152f, 0.925020635f},
-std::array<float,2>{0.641789377f, 0.421861947f},
-std::array<float,2>{0.187171787f, 0.194845691f},
-std::array<float,2>{0.764393032f, 0.68404752f},
-std::array<float,2>{0.269181311f, 0.575433671f},
-std::array<float,2>{0.576907277f, 0.0477241948f},
-std::array<float,2>{0.00919195823f, 0.327404976f},
-std::array<float,2>{0.888036728f, 0.858817935f},
-std::array<float,2>{0.161194041f, 0.903080404f},
-std::array<float,2>{0.772406101f, 0.378767282f},
-std::array<float,2>{0.38180384f, 0.232325658f},
-std::array<float,2>{0.628952026f, 0.642545581f},
-std::array<float,2>{0.105979435f, 0.70412612f},
-std::array<float,2>{0.982538521f, 0.176863834f},
-std::array<float,2>{0.346732408f, 0.463991791f},
-std::array<float,2>{0.525760055f, 0.945882916f},
-std::array<float,2>{0.477531672f, 0.777331233f},
-std::array<float,2>{0.716741085f, 0.251044631f},
-std::array<float,2>{0.227640018f, 0.110711195f},
-std::array<float,2>{0.827510417f, 0.535878599f},
-std::array<float,2>{0.436674356f, 0.658128262f},
-std::array<float,2>{0.670327425f, 0.211945504f},
-std::array<float,2>{0.126532927f, 0.436312497f},
-std::array<float,2>{0.792624414f, 0.908578515f},
-std::array<float,2>{0.058268819f, 0.841644287f},
-std::array<float,2>{0.926062167f, 0.349914789f},
-std::array<float,2>{0.284595072f, 0.008777624f},
-std::array<float,2>{0.621455252f, 0.611549497f},
-std::array<float,2>{0.195165828f, 0.518772423f},
-std::array<float,2>{0.851402164f, 0.0867450163f},
-std::array<float,2>{0.444115639f, 0.287508458f},
-std::array<float,2>{0.725408196f, 0.792558014f},
-std::array<float,2>{0.32634303f, 0.971810699f},
-std::array<float,2>{0.553537965f, 0.48698929f},
-std::array<float,2>{0.0682025552f, 0.132315606f},
-std::array<float,2>{0.940889359f, 0.723517656f},
-std::array<float,2>{0.414442718f, 0.525730729f},
-std::array<float,2>{0.673371613f, 0.0783188492f},
-std::array<float,2>{0.141030073f, 0.293630987f},
-std::array<float,2>{0.799770772f, 0.786771894f},
-std::array<float,2>{0.0360548794f, 0.979298472f},
-std::array<float,2>{0.913629889f, 0.497588426f},
-std::array<float,2>{0.300976932f, 0.133774921f},
-std::array<float,2>{0.599115312f, 0.731033862f},
-std::array<float,2>{0.208461761f, 0.667441666f},
-std::array<float,2>{0.87447238f, 0.206928983f},
-std::array<float,2>{0.459670961f, 0.424896806f},
-std::array<float,2>{0.746108055f, 0.919445336f},
-std::array<float,2>{0.342938781f, 0.832956851f},
-std::array<float,2>{0.533007741f, 0.354168385f},
-std::array<float,2>{0.081943661f, 0.00751144765f},
-std::array<float,2>{0.955492973f, 0.623361528f},
-std::array<float,2>{0.265293002f, 0.713635743f},
-std::array<float,2>{0.586335599f, 0.184479833f},
-std::array<float,2>{0.0265535861f, 0.453920633f},
-std::array<float,2>{0.903799236f, 0.944207609f},
-std::array<float,2>{0.180363417f, 0.769432306f},
-std::array<float,2>{0.76087606f, 0.258770168f},
-std::array<float,2>{0.402754515f, 0.124637693f},
-std::array<float,2>{0.645994782f, 0.542171001f},
-std::array<float,2>{0.115551516f, 0.563243151f},
-std::array<float,2>{0.993659496f, 0.0572060309f},
-std::array<float,2>{0.367271364f, 0.319083899f},
-std::array<float,2>{0.514337838f, 0.851050138f},
-std::array<float,2>{0.488441378f, 0.892028868f},
-std::array<float,2>{0.699268162f, 0.385798275f},
-std::array<float,2>{0.247321799f, 0.224399731f},
-std::array<float,2>{0.839291632f, 0.64912343f},
-std::array<float,2>{0.350130558f, 0.59531194f},
-std::array<float,2>{0.52802217f, 0.0194294304f},
-std::array<float,2>{0.10184972f, 0.36040923f},
-std::array<float,2>{0.97705698f, 0.817475677f},
-std::array<float,2>{0.231005013f, 0.93617022f},
-std::array<float,2>{0.821569741f, 0.410715491f},
-std::array<float,2>{0.482826561f, 0.200679272f},
-std::array<float,2>{0.712180972f, 0.672866702f},
-std::array<float,2>{0.0134996297f, 0.745050788f},
-std::array<float,2>{0.885138869f, 0.15491195f},
-std::array<float,2>{0.269745022f, 0.474796623f},
-std::array<float,2>{0.573327184f, 0.98701036f},
-std::array<float,2>{0.375016272f, 0.800139904f},
-std::array<float,2>{0.625053465f, 0.311125249f},
-std::array<float,2>{0.157029569f, 0.0625392497f},
-std::array<float,2>{0.766290069f, 0.510502875f},
-std::array<float,2>{0.439076155f, 0.627464473f},
-std::array<float,2>{0.721457243f, 0.242988393f},
-std::array<float,2>{0.190813109f, 0.394949526f},
-std::array<float,2>{0.846056402f, 0.887937427f},
-std::array<float,2>{0.0628338233f, 0.872800291f},
-std::array<float,2>{0.94155556f, 0.343115538f},
-std::array<float,2>{0.322431535f, 0.031300582f},
-std::array<float,2>{0.549897373f, 0.57981956f},
-std::array<float,2>{0.129175514f, 0.558730781f},
-std::array<float,2>{0.795716166f, 0.101323813f},
-std::array<float,2>{0.432705641f, 0.272049308f},
-std::array<float,2>{0.665201008f, 0.755048513f},
-std::array<float,2>{0.288831383f, 0.962501466f},
-std::array<float,2>{0.619605243f, 0.441922456f},
-std::array<float,2>{0.0604449473f, 0.160809502f},
-std::array<float,2>{0.924268842f, 0.692239225f},
-std::array<float,2>{0.476209998f, 0.588401914f},
-std::array<float,2>{0.709503353f, 0.0427227765f},
-std::array<float,2>{0.224006027f, 0.332384944f},
-std::array<float,2>{0.819161832f, 0.86167568f},
-std::array<float,2>{0.0978322998f, 0.877581894f},
-std::array<float,2>{0.971669436f, 0.403507531f},
-std::array<float,2>{0.353814393f, 0.236985639f},
-std::array<float,2>{0.516454101f, 0.638810277f},
-std::array<float,2>{0.165502071f, 0.700625658f},
-std::array<float,2>{0.778517842f, 0.16635707f},
-std::array<float,2>{0.389976501f, 0.448845863f},
-std::array<float,2>{0.637319565f, 0.957929909f},
-std::array<float,2>{0.274643898f, 0.765500307f},
-std::array<float,2>{0.568991661f, 0.280188859f},
-std::array<float,2>{0.00271902815f, 0.108936392f},
-std::array<float,2>{0.878032982f, 0.553223014f},
-std::array<float,2>{0.314985454f, 0.680093169f},
-std::array<float,2>{0.560585737f, 0.190505594f},
-std::array<float,2>{0.0709220544f, 0.417248309f},
-std::array<float,2>{0.952217102f, 0.929135203f},
-std::array<float,2>{0.201221779f, 0.821986675f},
-std::array<float,2>{0.857412696f, 0.374691308f},
-std::array<float,2>{0.448099047f, 0.0268440563f},
-std::array<float,2>{0.732783139f, 0.6045174f},
-std::array<float,2>{0.0530286282f, 0.502890885f},
-std::array<float,2>{0.935378313f, 0.0716845691f},
-std::array<float,2>{0.292474389f, 0.298597276f},
-std::array<float,2>{0.615844667f, 0.805381894f},
-std::array<float,2>{0.426106721f, 0.998963654f},
-std::array<float,2>{0.658985555f, 0.482784301f},
-std::array<float,2>{0.139109731f, 0.14515768f},
-std::array<float,2>{0.786049128f, 0.734901845f},
-std::array<float,2>{0.310208023f, 0.53439635f},
-std::array<float,2>{0.607363582f, 0.114411198f},
-std::array<float,2>{0.0407661311f, 0.256598055f},
-std::array<float,2>{0.916510701f, 0.777809203f},
-std::array<float,2>{0.151960537f, 0.95008409f},
-std::array<float,2>{0.811898291f, 0.465854019f},
-std::array<float,2>{0.408455312f, 0.174764186f},
-std::array<float,2>{0.68471396f, 0.708105862f},
-std::array<float,2>{0.0906887725f, 0.64709425f},
-std::array<float,2>{0.967482626f, 0.227661639f},
-std::array<float,2>{0.332278699f, 0.380084753f},
-std::array<float,2>{0.546342432f, 0.898597836f},
-std::array<float,2>{0.461990237f, 0.854686618f},
-std::array<float,2>{0.741375327f, 0.323609143f},
-std::array<float,2>{0.212239534f, 0.051752124f},
-std::array<float,2>{0.86704129f, 0.571130812f},
-std::array<float,2>{0.395941049f, 0.72016871f},
-std::array<float,2>{0.651044905f, 0.12838684f},
-std::array<float,2>{0.178219631f, 0.488672882f},
-std::array<float,2>{0.751900375f, 0.973184168f},
-std::array<float,2>{0.0170064718f, 0.794902563f},
-std::array<float,2>{0.896951735f, 0.281729877f},
-std::array<float,2>{0.250593424f, 0.0932205319f},
-std::array<float,2>{0.584690988f, 0.522690833f},
-std::array<float,2>{0.240632296f, 0.615755141f},
-std::array<float,2>{0.828643382f, 0.0141221499f},
-std::array<float,2>{0.493083656f, 0.343774706f},
-std::array<float,2>{0.694588482f, 0.837210953f},
-std::array<float,2>{0.360218674f, 0.912460148f},
-std::array<float,2>{0.505903959f, 0.431974977f},
-std::array<float,2>{0.121426284f, 0.217790112f},
-std::array<float,2>{0.991326928f, 0.661699593f},
-std::array<float,2>{0.38124451f, 0.577878416f},
-std::array<float,2>{0.629834354f, 0.0499869548f},
-std::array<float,2>{0.161922634f, 0.324245185f},
-std::array<float,2>{0.771763504f, 0.856663764f},
-std::array<float,2>{0.0092789419f, 0.905662119f},
-std::array<float,2>{0.888557076f, 0.375477225f},
-std::array<float,2>{0.268725842f, 0.233176783f},
-std::array<float,2>{0.576369643f, 0.642985463f},
-std::array<float,2>{0.228410408f, 0.706365168f},
-std::array<float,2>{0.827928007f, 0.179436922f},
-std::array<float,2>{0.476854473f, 0.462169647f},
-std::array<float,2>{0.715979636f, 0.949076772f},
-std::array<float,2>{0.347348005f, 0.775364637f},
-std::array<float,2>{0.525987387f, 0.253895611f},
-std::array<float,2>{0.105601184f, 0.112919904f},
-std::array<float,2>{0.983235359f, 0.538735271f},
-std::array<float,2>{0.285072416f, 0.658587098f},
-std::array<float,2>{0.621614397f, 0.21469377f},
-std::array<float,2>{0.057948038f, 0.434505105f},
-std::array<float,2>{0.926615596f, 0.906655014f},
-std::array<float,2>{0.126157776f, 0.843443274f},
-std::array<float,2>{0.792179048f, 0.348381996f},
-std::array<float,2>{0.437462479f, 0.0115533033f},
-std::array<float,2>{0.670733631f, 0.611015975f},
-std::array<float,2>{0.0677726343f, 0.517105341f},
-std::array<float,2>{0.940924942f, 0.0883489028f},
-std::array<float,2>{0.327135801f, 0.285551637f},
-std::array<float,2>{0.552793682f, 0.790675819f},
-std::array<float,2>{0.443699449f, 0.969924212f},
-std::array<float,2>{0.724930882f, 0.485103607f},
-std::array<float,2>{0.194544092f, 0.130140781f},
-std::array<float,2>{0.850671232f, 0.725551724f},
-std::array<float,2>{0.339053899f, 0.549172223f},
-std::array<float,2>{0.535833597f, 0.102423713f},
-std::array<float,2>{0.0827148557f, 0.276688248f},
-std::array<float,2>{0.95809859f, 0.759547055f},
-std::array<float,2>{0.204533085f, 0.956913531f},
-std::array<float,2>{0.870361567f, 0.452434748f},
-std::array<float,2>{0.455795497f, 0.168007076f},
-std::array<float,2>{0.743130147f, 0.697803617f},
-std::array<float,2>{0.0318706967f, 0.635527134f},
-std::array<float,2>{0.907062232f, 0.239768013f},
-std::array<float,2>{0.299880266f, 0.398491025f},
-std::array<float,2>{0.597283363f, 0.879804194f},
-std::array<float,2>{0.421855122f, 0.863771439f},
-std::array<float,2>{0.676131904f, 0.331504166f},
-std::array<float,2>{0.148383394f, 0.0440889858f},
-std::array<float,2>{0.802705109f, 0.593408883f},
-std::array<float,2>{0.485469133f, 0.741495907f},
-std::array<float,2>{0.698410034f, 0.14378193f},
-std::array<float,2>{0.243593127f, 0.479163021f},
-std::array<float,2>{0.841347158f, 0.994594038f},
-std::array<float,2>{0.109925829f, 0.81029278f},
-std::array<float,2>{0.997436404f, 0.303358287f},
-std::array<float,2>{0.374105096f, 0.0755509585f},
-std::array<float,2>{0.511070192f, 0.504292965f},
-std::array<float,2>{0.186659858f, 0.607090652f},
-std::array<float,2>{0.763824165f, 0.0293220095f},
-std::array<float,2>{0.398497373f, 0.367677838f},
-std::array<float,2>{0.642225981f, 0.824999571f},
-std::array<float,2>{0.260587841f, 0.923109055f},
-std::array<float,2>{0.590573728f, 0.419551671f},
-std::array<float,2>{0.0302964021f, 0.193299741f},
-std::array<float,2>{0.89946866f, 0.686867535f},
-std::array<float,2>{0.468671501f, 0.513825655f},
-std::array<float,2>{0.73586607f, 0.0682198703f},
-std::array<float,2>{0.216026843f, 0.307694167f},
-std::array<float,2>{0.861354351f, 0.80339402f},
-std::array<float,2>{0.0874777809f, 0.989744902f},
-std::array<float,2>{0.963468194f, 0.470037192f},
-std::array<float,2>{0.328212619f, 0.149651721f},
-std::array<float,2>{0.542781115f, 0.7475214f},
-std::array<float,2>{0.153165936f, 0.677649558f},
-std::array<float,2>{0.805006206f, 0.199148104f},
-std::array<float,2>{0.412716031f, 0.406913042f},
-std::array<float,2>{0.681117237f, 0.931699634f},
-std::array<float,2>{0.306542605f, 0.812970757f},
-std::array<float,2>{0.602727413f, 0.366595238f},
-std::array<float,2>{0.0452526882f, 0.0199960191f},
-std::array<float,2>{0.919325888f, 0.598378778f},
-std::array<float,2>{0.365615994f, 0.688824177f},
-std::array<float,2>{0.502484083f, 0.159133032f},
-std::array<float,2>{0.118120395f, 0.439143926f},
-std::array<float,2>{0.987336874f, 0.966864109f},
-std::array<float,2>{0.237859622f, 0.753104866f},
-std::array<float,2>{0.832388997f, 0.268048286f},
-std::array<float,2>{0.498678625f, 0.0957728475f},
-std::array<float,2>{0.691320419f, 0.556269944f},
-std::array<float,2>{0.0206181463f, 0.582883835f},
-std::array<float,2>{0.893024027f, 0.0360336378f},
-std::array<float,2>{0.255637586f, 0.337511003f},
-std::array<float,2>{0.578415513f, 0.869538009f},
-std::array<float,2>{0.394308358f, 0.884911597f},
-std::array<float,2>{0.656192899f, 0.392896563f},
-std::array<float,2>{0.172589332f, 0.248013318f},
-std::array<float,2>{0.755849779f, 0.632481456f},
-std::array<float,2>{0.279697955f, 0.617364168f},
-std::array<float,2>{0.565252721f, 0.00358213927f},
-std::array<float,2>{0.00629966427f, 0.355768889f},
-std::array<float,2>{0.881966174f, 0.829301059f},
-std::array<float,2>{0.168175817f, 0.917934597f},
-std::array<float,2>{0.776826918f, 0.429216564f},
-std::array<float,2>{0.384969145f, 0.208886251f},
-std::array<float,2>{0.634805799f, 0.670208335f},
-std::array<float,2>{0.0959234908f, 0.729670227f},
-std::array<float,2>{0.973934412f, 0.138611034f},
-std::array<float,2>{0.357469946f, 0.492530555f},
-std::array<float,2>{0.520718396f, 0.982242286f},
-std::array<float,2>{0.469892144f, 0.782433689f},
-std::array<float,2>{0.704062045f, 0.289274126f},
-std::array<float,2>{0.218950227f, 0.0856947824f},
-std::array<float,2>{0.814912677f, 0.530228734f},
-std::array<float,2>{0.422518045f, 0.655404508f},
-std::array<float,2>{0.663025439f, 0.221467957f},
-std::array<float,2>{0.134308919f, 0.388751715f},
-std::array<float,2>{0.782112777f, 0.897492588f},
-std::array<float,2>{0.047616303f, 0.844814956f},
-std::array<float,2>{0.930155873f, 0.315303952f},
-std::array<float,2>{0.293996602f, 0.0618708134f},
-std::array<float,2>{0.613025129f, 0.566558957f},
-std::array<float,2>{0.198770896f, 0.544264197f},
-std::array<float,2>{0.851614594f, 0.11911948f},
-std::array<float,2>{0.452254474f, 0.264509916f},
-std::array<float,2>{0.729662359f, 0.771027744f},
-std::array<float,2>{0.317350477f, 0.939737022f},
-std::array<float,2>{0.555067122f, 0.459820271f},
-std::array<float,2>{0.0746470988f, 0.180243924f},
-std::array<float,2>{0.947876275f, 0.718156695f},
-std::array<float,2>{0.408949673f, 0.53127104f},
-std::array<float,2>{0.685463667f, 0.117186762f},
-std::array<float,2>{0.151458025f, 0.255003929f},
-std::array<float,2>{0.812303066f, 0.780870855f},
-std::array<float,2>{0.0401356407f, 0.952641308f},
-std::array<float,2>{0.916288674f, 0.467921376f},
-std::array<float,2>{0.310055673f, 0.173569769f},
-std::array<float,2>{0.606611907f, 0.710765123f},
-std::array<float,2>{0.212417483f, 0.645056129f},
-std::array<float,2>{0.866346896f, 0.228659421f},
-std::array<float,2>{0.462424457f, 0.381087244f},
-std::array<float,2>{0.741701543f, 0.90111804f},
-std::array<float,2>{0.332531154f, 0.852291822f},
-std::array<float,2>{0.546594024f, 0.321701437f},
-std::array<float,2>{0.0898940489f, 0.0546731241f},
-std::array<float,2>{0.966875553f, 0.573734879f},
-std::array<float,2>{0.250006467f, 0.721623898f},
-std::array<float,2>{0.584310949f, 0.125210896f},
-std::array<float,2>{0.0173446368f, 0.491072208f},
-std::array<float,2>{0.89739418f, 0.975980282f},
-std::array<float,2>{0.178431317f, 0.796364605f},
-std::array<float,2>{0.751075685f, 0.284997463f},
-std::array<float,2>{0.39636299f, 0.0907523856f},
-std::array<float,2>{0.650849998f, 0.52141434f},
-std::array<float,2>{0.121841587f, 0.614604056f},
-std::array<float,2>{0.992026448f, 0.0128086973f},
-std::array<float,2>{0.359733671f, 0.347058952f},
-std::array<float,2>{0.506388605f, 0.839666784f},
-std::array<float,2>{0.492424548f, 0.910647035f},
-std::array<float,2>{0.694949925f, 0.430063069f},
-std::array<float,2>{0.240876928f, 0.214912549f},
-std::array<float,2>{0.828387022f, 0.66347599f},
-std::array<float,2>{0.354390413f, 0.587559044f},
-std::array<float,2>{0.515774012f, 0.0404935852f},
-std::array<float,2>{0.098158069f, 0.334102958f},
-std::array<float,2>{0.970770061f, 0.860919595f},
-std::array<float,2>{0.224329561f, 0.875871778f},
-std::array<float,2>{0.818576455f, 0.40501529f},
-std::array<float,2>{0.476022959f, 0.236052141f},
-std::array<float,2>{0.70918709f, 0.638608754f},
-std::array<float,2>{0.0021200655f, 0.701264083f},
-std::array<float,2>{0.878527284f, 0.165871501f},
-std::array<float,2>{0.274911702f, 0.445484966f},
-std::array<float,2>{0.568773806f, 0.960729778f},
-std::array<float,2>{0.390504986f, 0.762665033f},
-std::array<float,2>{0.636879683f, 0.279004097f},
-std::array<float,2>{0.165544584f, 0.106448367f},
-std::array<float,2>{0.778934896f, 0.550952375f},
-std::array<float,2>{0.447746933f, 0.681914508f},
-std::array<float,2>{0.733105421f, 0.188859656f},
-std::array<float,2>{0.202004567f, 0.415273577f},
-std::array<float,2>{0.856602848f, 0.925990224f},
-std::array<float,2>{0.070769228f, 0.823431194f},
-std::array<float,2>{0.952688932f, 0.371654779f},
-std::array<float,2>{0.314510435f, 0.024388995f},
-std::array<float,2>{0.561113179f, 0.602925181f},
-std::array<float,2>{0.139462888f, 0.501289964f},
-std::array<float,2>{0.785514534f, 0.0729086027f},
-std::array<float,2>{0.426474303f, 0.299088776f},
-std::array<float,2>{0.658632934f, 0.806912363f},
-std::array<float,2>{0.292667121f, 0.996822178f},
-std::array<float,2>{0.615601599f, 0.480561674f},
-std::array<float,2>{0.0534017198f, 0.147320956f},
-std::array<float,2>{0.934797943f, 0.738261819f},
-std::array<float,2>{0.483322263f, 0.596145332f},
-std::array<float,2>{0.712555528f, 0.0162026715f},
-std::array<float,2>{0.230893746f, 0.362030536f},
-std::array<float,2>{0.822017133f, 0.820074081f},
-std::array<float,2>{0.102101572f, 0.933757663f},
-std::array<float,2>{0.976832211f, 0.412637293f},
-std::array<float,2>{0.350042373f, 0.202300295f},
-std::array<float,2>{0.527547777f, 0.675527394f},
-std::array<float,2>{0.156501919f, 0.743893802f},
-std::array<float,2>{0.765704036f, 0.153514966f},
-std::array<float,2>{0.375569314f, 0.473492593f},
-std::array<float,2>{0.625672698f, 0.984453857f},
-std::array<float,2>{0.270370662f, 0.796964526f},
-std::array<float,2>{0.573742747f, 0.309752226f},
-std::array<float,2>{0.0130591458f, 0.0657424033f},
-std::array<float,2>{0.885695457f, 0.508889019f},
-std::array<float,2>{0.322968632f, 0.625339448f},
-std::array<float,2>{0.550397277f, 0.244246289f},
-std::array<float,2>{0.063417837f, 0.397963911f},
-std::array<float,2>{0.942189574f, 0.889853001f},
-std::array<float,2>{0.19129917f, 0.873810828f},
-std::array<float,2>{0.846292675f, 0.341040939f},
-std::array<float,2>{0.438810319f, 0.0345447473f},
-std::array<float,2>{0.720934391f, 0.581629157f},
-std::array<float,2>{0.0597172081f, 0.560893774f},
-std::array<float,2>{0.924327314f, 0.0982197896f},
-std::array<float,2>{0.288237721f, 0.271475166f},
-std::array<float,2>{0.61981535f, 0.756424487f},
-std::array<float,2>{0.433323413f, 0.96436286f},
-std::array<float,2>{0.665988445f, 0.44386071f},
-std::array<float,2>{0.129450828f, 0.163969636f},
-std::array<float,2>{0.795310616f, 0.694280803f},
-std::array<float,2>{0.301379591f, 0.524096429f},
-std::array<float,2>{0.599338531f, 0.0802353099f},
-std::array<float,2>{0.0352410153f, 0.295972049f},
-std::array<float,2>{0.913440108f, 0.787634313f},
-std::array<float,2>{0.141499862f, 0.977434933f},
-std::array<float,2>{0.79930824f, 0.499848276f},
-std::array<float,2>{0.414910376f, 0.134791538f},
-std::array<float,2>{0.67329824f, 0.733982563f},
-std::array<float,2>{0.0814678743f, 0.666010976f},
-std::array<float,2>{0.955742598f, 0.203337073f},
-std::array<float,2>{0.343375951f, 0.423407167f},
-std::array<float,2>{0.532378793f, 0.920156956f},
-std::array<float,2>{0.459416181f, 0.835916817f},
-std::array<float,2>{0.746765316f, 0.352860153f},
-std::array<float,2>{0.20882155f, 0.00565041509f},
-std::array<float,2>{0.874931812f, 0.622228205f},
-std::array<float,2>{0.403075218f, 0.711120486f},
-std::array<float,2>{0.646284938f, 0.185943067f},
-std::array<float,2>{0.179752246f, 0.456569552f},
-std::array<float,2>{0.761402488f, 0.941619933f},
-std::array<float,2>{0.0271286629f, 0.767123461f},
-std::array<float,2>{0.903962731f, 0.259837478f},
-std::array<float,2>{0.264841408f, 0.121860385f},
-std::array<float,2>{0.586716533f, 0.540397942f},
-std::array<float,2>{0.247649163f, 0.564548671f},
-std::array<float,2>{0.839786768f, 0.0558528788f},
-std::array<float,2>{0.489200652f, 0.317556977f},
-std::array<float,2>{0.699814141f, 0.848214388f},
-std::array<float,2>{0.368017197f, 0.894022048f},
-std::array<float,2>{0.513774216f, 0.384455472f},
-std::array<float,2>{0.11589694f, 0.226457149f},
-std::array<float,2>{0.993452728f, 0.650408506f},
-std::array<float,2>{0.435429841f, 0.611980796f},
-std::array<float,2>{0.668015838f, 0.00811342523f},
-std::array<float,2>{0.128807396f, 0.350284845f},
-std::array<float,2>{0.789659023f, 0.841296792f},
-std::array<float,2>{0.0556412339f, 0.908927917f},
-std::array<float,2>{0.928832531f, 0.43576473f},
-std::array<float,2>{0.282996267f, 0.212726742f},
-std::array<float,2>{0.624220431f, 0.657636583f},
-std::array<float,2>{0.193163931f, 0.722787917f},
-std::array<float,2>{0.849050462f, 0.132548973f},
-std::array<float,2>{0.442226619f, 0.486815929f},
-std::array<float,2>{0.723707378f, 0.972387075f},
-std::array<float,2>{0.324655265f, 0.792354345f},
-std::array<float,2>{0.551220715f, 0.287963659f},
-std::array<float,2>{0.0685560182f, 0.0861082748f},
-std::array<float,2>{0.937551379f, 0.519106805f},
-std::array<float,2>{0.266803116f, 0.641989231f},
-std::array<float,2>{0.575562358f, 0.231739163f},
-std::array<float,2>{0.0114809703f, 0.378185213f},
-std::array<float,2>{0.889042735f, 0.902747869f},
-std::array<float,2>{0.163504317f, 0.859172106f},
-std::array<float,2>{0.770078063f, 0.327651352f},
-std::array<float,2>{0.379088104f, 0.0468984358f},
-std::array<float,2>{0.631323218f, 0.576147556f},
-std::array<float,2>{0.107555464f, 0.535387158f},
-std::array<float,2>{0.981529415f, 0.110886835f},
-std::array<float,2>{0.34458974f, 0.251895815f},
-std::array<float,2>{0.524792612f, 0.776406944f},
-std::array<float,2>{0.478648782f, 0.945403457f},
-std::array<float,2>{0.717690229f, 0.464437425f},
-std::array<float,2>{0.230096936f, 0.177609041f},
-std::array<float,2>{0.824995637f, 0.704932094f},
-std::array<float,2>{0.371563911f, 0.506943345f},
-std::array<float,2>{0.509728312f, 0.0765631646f},
-std::array<float,2>{0.11224065f, 0.300887406f},
-std::array<float,2>{0.9997347f, 0.811900735f},
-std::array<float,2>{0.244542778f, 0.99271524f},
-std::array<float,2>{0.842421889f, 0.476732254f},
-std::array<float,2>{0.487437874f, 0.142082453f},
-std::array<float,2>{0.696588278f, 0.739697754f},
-std::array<float,2>{0.0279587377f, 0.684355199f},
-std::array<float,2>{0.900428772f, 0.1944976f},
-std::array<float,2>{0.258043796f, 0.421262026f},
-std::array<float,2>{0.592918754f, 0.925431311f},
-std::array<float,2>{0.402070314f, 0.827398717f},
-std::array<float,2>{0.642609298f, 0.370143622f},
-std::array<float,2>{0.184736162f, 0.0287792422f},
-std::array<float,2>{0.763028741f, 0.607830286f},
-std::array<float,2>{0.454019457f, 0.696695447f},
-std::array<float,2>{0.745018244f, 0.171586573f},
-std::array<float,2>{0.205548182f, 0.449706107f},
-std::array<float,2>{0.86738956f, 0.954650402f},
-std::array<float,2>{0.08517313f, 0.760393083f},
-std::array<float,2>{0.96013844f, 0.273884386f},
-std::array<float,2>{0.335946918f, 0.104792371f},
-std::array<float,2>{0.538050234f, 0.546940088f},
-std::array<float,2>{0.145098656f, 0.590221643f},
-std::array<float,2>{0.804106057f, 0.0452561304f},
-std::array<float,2>{0.419775277f, 0.328486234f},
-std::array<float,2>{0.679585457f, 0.865534663f},
-std::array<float,2>{0.29835698f, 0.882572711f},
-std::array<float,2>{0.595617115f, 0.401297867f},
-std::array<float,2>{0.0350141898f, 0.241580471f},
-std::array<float,2>{0.909968853f, 0.633900404f},
-std::array<float,2>{0.497110695f, 0.557505429f},
-std::array<float,2>{0.689194202f, 0.0950434059f},
-std::array<float,2>{0.234868929f, 0.267285317f},
-std::array<float,2>{0.835033715f, 0.750308514f},
-std::array<float,2>{0.120503716f, 0.965911627f},
-std::array<float,2>{0.986303806f, 0.440730035f},
-std::array<float,2>{0.363395184f, 0.156799674f},
-std::array<float,2>{0.500860274f, 0.690651238f},
-std::array<float,2>{0.174320832f, 0.630202174f},
-std::array<float,2>{0.757759452f, 0.248875171f},
-std::array<float,2>{0.392205805f, 0.392496735f},
-std::array<float,2>{0.653184652f, 0.883350253f},
-std::array<float,2>{0.257526129f, 0.86911571f},
-std::array<float,2>{0.580716133f, 0.338211954f},
-std::array<float,2>{0.0219889488f, 0.0377783887f},
-std::array<float,2>{0.891299725f, 0.584853649f},
-std::array<float,2>{0.330817252f, 0.749233842f},
-std::array<float,2>{0.539646626f, 0.15091306f},
-std::array<float,2>{0.088880308f, 0.470900476f},
-std::array<float,2>{0.962797642f, 0.991244376f},
-std::array<float,2>{0.217354879f, 0.801297069f},
-std::array<float,2>{0.859793007f, 0.305485785f},
-std::array<float,2>{0.465111792f, 0.0693632364f},
-std::array<float,2>{0.737907588f, 0.512351096f},
-std::array<float,2>{0.0441403352f, 0.60094285f},
-std::array<float,2>{0.921218932f, 0.0223562159f},
-std::array<float,2>{0.307402074f, 0.363288403f},
-std::array<float,2>{0.604901314f, 0.815176547f},
-std::array<float,2>{0.411185384f, 0.930588603f},
-std::array<float,2>{0.682507396f, 0.408943176f},
-std::array<float,2>{0.154548556f, 0.195386201f},
-std::array<float,2>{0.806781054f, 0.678595603f},
-std::array<float,2>{0.296217233f, 0.569684803f},
-std::array<float,2>{0.610069513f, 0.0594890788f},
-std::array<float,2>{0.0492979549f, 0.31389299f},
-std::array<float,2>{0.932520807f, 0.847248614f},
-std::array<float,2>{0.135417551f, 0.895411313f},
-std::array<float,2>{0.784346104f, 0.388125718f},
-std::array<float,2>{0.425607085f, 0.219391257f},
-std::array<float,2>{0.661344707f, 0.653410733f},
-std::array<float,2>{0.0774403512f, 0.715519667f},
-std::array<float,2>{0.945507228f, 0.18276976f},
-std::array<float,2>{0.31847471f, 0.458186299f},
-std::array<float,2>{0.558485329f, 0.937698841f},
-std::array<float,2>{0.449569553f, 0.773152888f},
-std::array<float,2>{0.727314174f, 0.262481034f},
-std::array<float,2>{0.196070731f, 0.119763315f},
-std::array<float,2>{0.853981555f, 0.545933783f},
-std::array<float,2>{0.384456098f, 0.668505549f},
-std::array<float,2>{0.633334517f, 0.209921464f},
-std::array<float,2>{0.171710789f, 0.427617311f},
-std::array<float,2>{0.7747159f, 0.915651321f},
-std::array<float,2>{0.00578856422f, 0.831200838f},
-std::array<float,2>{0.880391836f, 0.357496083f},
-std::array<float,2>{0.278926104f, 0.00095248362f},
-std::array<float,2>{0.562589407f, 0.620287478f},
-std::array<float,2>{0.220837444f, 0.528505921f},
-std::array<float,2>{0.813531637f, 0.0821583867f},
-std::array<float,2>{0.470761597f, 0.292049229f},
-std::array<float,2>{0.706909239f, 0.785093486f},
-std::array<float,2>{0.355929375f, 0.983640552f},
-std::array<float,2>{0.522149205f, 0.49465251f},
-std::array<float,2>{0.0948509201f, 0.139093041f},
-std::array<float,2>{0.976419687f, 0.727214038f},
-std::array<float,2>{0.39753595f, 0.523077428f},
-std::array<float,2>{0.648463845f, 0.0937264636f},
-std::array<float,2>{0.177041367f, 0.281793624f},
-std::array<float,2>{0.752282321f, 0.794331491f},
-std::array<float,2>{0.0192249008f, 0.973038733f},
-std::array<float,2>{0.895316482f, 0.488984913f},
-std::array<float,2>{0.252328575f, 0.128753573f},
-std::array<float,2>{0.583481967f, 0.720626295f},
-std::array<float,2>{0.23835507f, 0.661323786f},
-std::array<float,2>{0.831579804f, 0.218681619f},
-std::array<float,2>{0.494345754f, 0.432166457f},
-std::array<float,2>{0.692038178f, 0.912851393f},
-std::array<float,2>{0.362676859f, 0.837505758f},
-std::array<float,2>{0.504885674f, 0.344354123f},
-std::array<float,2>{0.124769501f, 0.0145458542f},
-std::array<float,2>{0.988551199f, 0.615331829f},
-std::array<float,2>{0.312408894f, 0.708650708f},
-std::array<float,2>{0.607523918f, 0.173981965f},
-std::array<float,2>{0.041469451f, 0.466344535f},
-std::array<float,2>{0.914636493f, 0.949496269f},
-std::array<float,2>{0.149173304f, 0.778135657f},
-std::array<float,2>{0.809464633f, 0.255954504f},
-std::array<float,2>{0.407809764f, 0.115203485f},
-std::array<float,2>{0.686992586f, 0.53505224f},
-std::array<float,2>{0.0928284302f, 0.570390105f},
-std::array<float,2>{0.966341674f, 0.0510440692f},
-std::array<float,2>{0.334683686f, 0.323746532f},
-std::array<float,2>{0.543897152f, 0.855398357f},
-std::array<float,2>{0.463063091f, 0.898967683f},
-std::array<float,2>{0.74001056f, 0.380755067f},
-std::array<float,2>{0.214165926f, 0.228089571f},
-std::array<float,2>{0.863458157f, 0.646917403f},
-std::array<float,2>{0.31281206f, 0.605377257f},
-std::array<float,2>{0.560054541f, 0.0270677544f},
-std::array<float,2>{0.0735491738f, 0.374236524f},
-std::array<float,2>{0.949306726f, 0.821628392f},
-std::array<float,2>{0.199535966f, 0.929364502f},
-std::array<float,2>{0.857508183f, 0.41790852f},
-std::array<float,2>{0.447211027f, 0.191283852f},
-std::array<float,2>{0.731090248f, 0.680642068f},
-std::array<float,2>{0.0508053154f, 0.734710574f},
-std::array<float,2>{0.935755849f, 0.144773811f},
-std::array<float,2>{0.290795982f, 0.483137846f},
-std::array<float,2>{0.613727927f, 0.998240769f},
-std::array<float,2>{0.428871781f, 0.804802537f},
-std::array<float,2>{0.657150745f, 0.298059285f},
-std::array<float,2>{0.137008831f, 0.0718424767f},
-std::array<float,2>{0.788258255f, 0.502204359f},
-std::array<float,2>{0.474082381f, 0.639624238f},
-std::array<float,2>{0.707747042f, 0.236504525f},
-std::array<float,2>{0.225786224f, 0.404040277f},
-std::array<float,2>{0.818114221f, 0.877102792f},
-std::array<float,2>{0.0996382609f, 0.86219418f},
-std::array<float,2>{0.969677687f, 0.332614064f},
-std::array<float,2>{0.352874845f, 0.0424163565f},
-std::array<float,2>{0.519482315f, 0.588115215f},
-std::array<float,2>{0.167154476f, 0.552891433f},
-std::array<float,2>{0.780046582f, 0.108450927f},
-std::array<float,2>{0.388028651f, 0.279583633f},
-std::array<float,2>{0.639658391f, 0.76491946f},
-std::array<float,2>{0.27727735f, 0.957235992f},
-std::array<float,2>{0.568076134f, 0.448291689f},
-std::array<float,2>{0.000728704326f, 0.166969657f},
-std::array<float,2>{0.87522316f, 0.700709939f},
-std::array<float,2>{0.44070521f, 0.579366922f},
-std::array<float,2>{0.720241904f, 0.0320056751f},
-std::array<float,2>{0.189070076f, 0.343572468f},
-std::array<float,2>{0.844074905f, 0.872139931f},
-std::array<float,2>{0.0652518198f, 0.888535798f},
-std::array<float,2>{0.945091426f, 0.395168155f},
-std::array<float,2>{0.320774704f, 0.242599741f},
-std::array<float,2>{0.548382461f, 0.627250314f},
-std::array<float,2>{0.132303357f, 0.691705167f},
-std::array<float,2>{0.794569731f, 0.160639256f},
-std::array<float,2>{0.430852532f, 0.441623032f},
-std::array<float,2>{0.667829692f, 0.961986303f},
-std::array<float,2>{0.286804497f, 0.755826831f},
-std::array<float,2>{0.618044615f, 0.271523148f},
-std::array<float,2>{0.0624972843f, 0.100637361f},
-std::array<float,2>{0.923555732f, 0.559190631f},
-std::array<float,2>{0.34896788f, 0.673375666f},
-std::array<float,2>{0.529345751f, 0.20111762f},
-std::array<float,2>{0.105016008f, 0.410260886f},
-std::array<float,2>{0.979213357f, 0.935655773f},
-std::array<float,2>{0.232669756f, 0.81789428f},
-std::array<float,2>{0.822987258f, 0.361316055f},
-std::array<float,2>{0.482193768f, 0.018674437f},
-std::array<float,2>{0.714486241f, 0.595192552f},
-std::array<float,2>{0.0151913241f, 0.50994122f},
-std::array<float,2>{0.884436607f, 0.0631765202f},
-std::array<float,2>{0.272596985f, 0.310563803f},
-std::array<float,2>{0.571077228f, 0.80035615f},
-std::array<float,2>{0.377922714f, 0.986744583f},
-std::array<float,2>{0.627500474f, 0.475517571f},
-std::array<float,2>{0.159357309f, 0.154358327f},
-std::array<float,2>{0.76832515f, 0.744386613f},
-std::array<float,2>{0.26363939f, 0.542635739f},
-std::array<float,2>{0.588094652f, 0.124316186f},
-std::array<float,2>{0.0249137245f, 0.257964283f},
-std::array<float,2>{0.904588223f, 0.768715858f},
-std::array<float,2>{0.182141751f, 0.943794608f},
-std::array<float,2>{0.759500742f, 0.45325619f},
-std::array<float,2>{0.405604213f, 0.184000939f},
-std::array<float,2>{0.647361875f, 0.713018596f},
-std::array<float,2>{0.113447033f, 0.648905039f},
-std::array<float,2>{0.994246781f, 0.223921403f},
-std::array<float,2>{0.36915046f, 0.386617452f},
-std::array<float,2>{0.512453794f, 0.892295659f},
-std::array<float,2>{0.490455866f, 0.851195097f},
-std::array<float,2>{0.701437831f, 0.318810195f},
-std::array<float,2>{0.248769864f, 0.0569698624f},
-std::array<float,2>{0.83673501f, 0.562768459f},
-std::array<float,2>{0.416371882f, 0.730937421f},
-std::array<float,2>{0.675155401f, 0.133062869f},
-std::array<float,2>{0.142620355f, 0.497130454f},
-std::array<float,2>{0.797781229f, 0.978854597f},
-std::array<float,2>{0.0385318473f, 0.786595941f},
-std::array<float,2>{0.911375582f, 0.29325074f},
-std::array<float,2>{0.302994192f, 0.0786263496f},
-std::array<float,2>{0.601340592f, 0.526260972f},
-std::array<float,2>{0.209113136f, 0.62367487f},
-std::array<float,2>{0.873031557f, 0.00730171613f},
-std::array<float,2>{0.458539933f, 0.353518486f},
-std::array<float,2>{0.749444485f, 0.832161069f},
-std::array<float,2>{0.340797871f, 0.919050276f},
-std::array<float,2>{0.533532262f, 0.425394148f},
-std::array<float,2>{0.0785136521f, 0.206443667f},
-std::array<float,2>{0.954788089f, 0.66784066f},
-std::array<float,2>{0.418236911f, 0.591833949f},
-std::array<float,2>{0.67868346f, 0.0431091003f},
-std::array<float,2>{0.145649552f, 0.330481023f},
-std::array<float,2>{0.80299741f, 0.864284098f},
-std::array<float,2>{0.0340040922f, 0.880712748f},
-std::array<float,2>{0.908678889f, 0.400029421f},
-std::array<float,2>{0.297204137f, 0.238429323f},
-std::array<float,2>{0.594249189f, 0.63612783f},
-std::array<float,2>{0.206227675f, 0.699073255f},
-std::array<float,2>{0.869027078f, 0.169335097f},
-std::array<float,2>{0.454248786f, 0.451948732f},
-std::array<float,2>{0.745140314f, 0.955741584f},
-std::array<float,2>{0.337088108f, 0.758336842f},
-std::array<float,2>{0.53861773f, 0.276105374f},
-std::array<float,2>{0.0849069357f, 0.103235364f},
-std::array<float,2>{0.959887266f, 0.550317109f},
-std::array<float,2>{0.259445608f, 0.686342657f},
-std::array<float,2>{0.592031419f, 0.191466287f},
-std::array<float,2>{0.0290357061f, 0.418028742f},
-std::array<float,2>{0.901847601f, 0.922508299f},
-std::array<float,2>{0.184261054f, 0.825864851f},
-std::array<float,2>{0.762558401f, 0.368249178f},
-std::array<float,2>{0.401333809f, 0.030855963f},
-std::array<float,2>{0.644258559f, 0.606161058f},
-std::array<float,2>{0.113142982f, 0.505140424f},
-std::array<float,2>{0.998385251f, 0.0745536387f},
-std::array<float,2>{0.372254074f, 0.303784847f},
-std::array<float,2>{0.508044422f, 0.80863589f},
-std::array<float,2>{0.486346751f, 0.995429099f},
-std::array<float,2>{0.695927978f, 0.479999542f},
-std::array<float,2>{0.245235234f, 0.142803133f},
-std::array<float,2>{0.842999995f, 0.740968645f},
-std::array<float,2>{0.345174074f, 0.538042605f},
-std::array<float,2>{0.524339855f, 0.11151623f},
-std::array<float,2>{0.109014861f, 0.252337396f},
-std::array<float,2>{0.980795383f, 0.773519993f},
-std::array<float,2>{0.229485974f, 0.948148847f},
-std::array<float,2>{0.825711668f, 0.461680084f},
-std::array<float,2>{0.48040992f, 0.177901745f},
-std::array<float,2>{0.718350232f, 0.70523715f},
-std::array<float,2>{0.0105521539f, 0.643856764f},
-std::array<float,2>{0.889774799f, 0.23395583f},
-std::array<float,2>{0.266073227f, 0.376832366f},
-std::array<float,2>{0.574622393f, 0.904767096f},
-std::array<float,2>{0.380292118f, 0.855643988f},
-std::array<float,2>{0.631879807f, 0.325242847f},
-std::array<float,2>{0.162844658f, 0.0496987887f},
-std::array<float,2>{0.77053231f, 0.576610684f},
-std::array<float,2>{0.442508727f, 0.726288974f},
-std::array<float,2>{0.723278105f, 0.12937443f},
-std::array<float,2>{0.192044631f, 0.485801637f},
-std::array<float,2>{0.847849846f, 0.969693899f},
-std::array<float,2>{0.070145309f, 0.789313734f},
-std::array<float,2>{0.93901211f, 0.286686987f},
-std::array<float,2>{0.325601488f, 0.0891891569f},
-std::array<float,2>{0.552225649f, 0.516414046f},
-std::array<float,2>{0.127211109f, 0.609811127f},
-std::array<float,2>{0.790521502f, 0.0106775938f},
-std::array<float,2>{0.434058726f, 0.348680645f},
-std::array<float,2>{0.669120073f, 0.841896772f},
-std::array<float,2>{0.281854659f, 0.908184946f},
-std::array<float,2>{0.623320639f, 0.435067952f},
-std::array<float,2>{0.0556653179f, 0.213457227f},
-std::array<float,2>{0.928297639f, 0.659521222f},
-std::array<float,2>{0.472063214f, 0.530357301f},
-std::array<float,2>{0.705976903f, 0.0843563378f},
-std::array<float,2>{0.222367376f, 0.290547401f},
-std::array<float,2>{0.812851727f, 0.781664908f},
-std::array<float,2>{0.0947080031f, 0.981259942f},
-std::array<float,2>{0.975103498f, 0.493887782f},
-std::array<float,2>{0.356989622f, 0.137294888f},
-std::array<float,2>{0.522977233f, 0.72933048f},
-std::array<float,2>{0.170774728f, 0.670968354f},
-std::array<float,2>{0.774115145f, 0.207868949f},
-std::array<float,2>{0.383750737f, 0.427853078f},
-std::array<float,2>{0.634411752f, 0.916541457f},
-std::array<float,2>{0.277803391f, 0.828763187f},
-std::array<float,2>{0.563896656f, 0.35651654f},
-std::array<float,2>{0.0048758164f, 0.00251488877f},
-std::array<float,2>{0.879255891f, 0.618639708f},
-std::array<float,2>{0.319893181f, 0.717430532f},
-std::array<float,2>{0.557298422f, 0.181016028f},
-std::array<float,2>{0.0767160282f, 0.460149944f},
-std::array<float,2>{0.94654721f, 0.940432608f},
-std::array<float,2>{0.196460143f, 0.770386338f},
-std::array<float,2>{0.855131507f, 0.265457243f},
-std::array<float,2>{0.45052281f, 0.11729122f},
-std::array<float,2>{0.728014946f, 0.54376477f},
-std::array<float,2>{0.0500654243f, 0.56790185f},
-std::array<float,2>{0.933484793f, 0.0606048182f},
-std::array<float,2>{0.295727283f, 0.31582579f},
-std::array<float,2>{0.610390306f, 0.84469825f},
-std::array<float,2>{0.424549788f, 0.897161305f},
-std::array<float,2>{0.660413861f, 0.390186101f},
-std::array<float,2>{0.13605231f, 0.221972659f},
-std::array<float,2>{0.783283532f, 0.654492319f},
-std::array<float,2>{0.308113992f, 0.598821998f},
-std::array<float,2>{0.603561699f, 0.0206579939f},
-std::array<float,2>{0.0432644784f, 0.365243196f},
-std::array<float,2>{0.920484066f, 0.813565314f},
-std::array<float,2>{0.155747026f, 0.932760537f},
-std::array<float,2>{0.808198214f, 0.40724507f},
-std::array<float,2>{0.410585135f, 0.197556436f},
-std::array<float,2>{0.683123171f, 0.675864637f},
-std::array<float,2>{0.0887711197f, 0.746724844f},
-std::array<float,2>{0.961851537f, 0.148624882f},
-std::array<float,2>{0.331967324f, 0.469367445f},
-std::array<float,2>{0.540059626f, 0.988383532f},
-std::array<float,2>{0.466301978f, 0.804308891f},
-std::array<float,2>{0.737126589f, 0.307451248f},
-std::array<float,2>{0.21866262f, 0.0672355369f},
-std::array<float,2>{0.861239016f, 0.51501441f},
-std::array<float,2>{0.39158234f, 0.631135464f},
-std::array<float,2>{0.654251516f, 0.246158496f},
-std::array<float,2>{0.174892724f, 0.394377559f},
-std::array<float,2>{0.756173372f, 0.886596143f},
-std::array<float,2>{0.0232691895f, 0.870432496f},
-std::array<float,2>{0.89223367f, 0.33627373f},
-std::array<float,2>{0.255870312f, 0.0365763679f},
-std::array<float,2>{0.581360221f, 0.583134949f},
-std::array<float,2>{0.236093044f, 0.55482918f},
-std::array<float,2>{0.834589779f, 0.0968089402f},
-std::array<float,2>{0.496580839f, 0.269025445f},
-std::array<float,2>{0.687675834f, 0.752321839f},
-std::array<float,2>{0.364484966f, 0.968482077f},
-std::array<float,2>{0.501301587f, 0.438421428f},
-std::array<float,2>{0.119484328f, 0.159588918f},
-std::array<float,2>{0.984820306f, 0.687977254f},
-std::array<float,2>{0.386913329f, 0.552504003f},
-std::array<float,2>{0.63945061f, 0.106142871f},
-std::array<float,2>{0.166421801f, 0.277880073f},
-std::array<float,2>{0.780507743f, 0.763039947f},
-std::array<float,2>{0.00115729985f, 0.959623277f},
-std::array<float,2>{0.876174212f, 0.446312249f},
-std::array<float,2>{0.276073903f, 0.164284781f},
-std::array<float,2>{0.566995561f, 0.702678978f},
-std::array<float,2>{0.225433514f, 0.637518823f},
-std::array<float,2>{0.817254543f, 0.234548301f},
-std::array<float,2>{0.472855002f, 0.405711025f},
-std::array<float,2>{0.708387256f, 0.876335084f},
-std::array<float,2>{0.352116704f, 0.859744847f},
-std::array<float,2>{0.518145561f, 0.335199237f},
-std::array<float,2>{0.101412006f, 0.0400167257f},
-std::array<float,2>{0.969938636f, 0.586771488f},
-std::array<float,2>{0.289538205f, 0.737182081f},
-std::array<float,2>{0.614466667f, 0.147533074f},
-std::array<float,2>{0.0523259826f, 0.481995791f},
-std::array<float,2>{0.937192082f, 0.997274637f},
-std::array<float,2>{0.138354897f, 0.808422148f},
-std::array<float,2>{0.787555754f, 0.300343663f},
-std::array<float,2>{0.427866757f, 0.0733687729f},
-std::array<float,2>{0.657697618f, 0.500861883f},
-std::array<float,2>{0.0727895796f, 0.601915121f},
-std::array<float,2>{0.950453103f, 0.0253363848f},
-std::array<float,2>{0.314301133f, 0.372797072f},
-std::array<float,2>{0.558664858f, 0.82296592f},
-std::array<float,2>{0.44566676f, 0.926767111f},
-std::array<float,2>{0.732418895f, 0.414565712f},
-std::array<float,2>{0.200470015f, 0.188386753f},
-std::array<float,2>{0.859076321f, 0.683332205f},
-std::array<float,2>{0.335384578f, 0.572927773f},
-std::array<float,2>{0.54472369f, 0.0534566119f},
-std::array<float,2>{0.0926705152f, 0.320392311f},
-std::array<float,2>{0.965728939f, 0.852787852f},
-std::array<float,2>{0.213721842f, 0.901878119f},
-std::array<float,2>{0.864863396f, 0.382532984f},
-std::array<float,2>{0.464360833f, 0.230304465f},
-std::array<float,2>{0.738801658f, 0.645741284f},
-std::array<float,2>{0.0423592255f, 0.709483981f},
-std::array<float,2>{0.915366054f, 0.172761887f},
-std::array<float,2>{0.310958356f, 0.467462599f},
-std::array<float,2>{0.608898699f, 0.952098131f},
-std::array<float,2>{0.406835765f, 0.779314876f},
-std::array<float,2>{0.686130881f, 0.254723608f},
-std::array<float,2>{0.149882272f, 0.11567764f},
-std::array<float,2>{0.80975312f, 0.532628775f},
-std::array<float,2>{0.495445609f, 0.662670791f},
-std::array<float,2>{0.69330436f, 0.216470405f},
-std::array<float,2>{0.239648208f, 0.431366265f},
-std::array<float,2>{0.831011534f, 0.911153972f},
-std::array<float,2>{0.123437598f, 0.838006616f},
-std::array<float,2>{0.989801347f, 0.346464366f},
-std::array<float,2>{0.361494213f, 0.0121376151f},
-std::array<float,2>{0.504721999f, 0.613682032f},
-std::array<float,2>{0.176726848f, 0.519767702f},
-std::array<float,2>{0.753614664f, 0.0910992473f},
-std::array<float,2>{0.397113591f, 0.283451885f},
-std::array<float,2>{0.650370836f, 0.795600295f},
-std::array<float,2>{0.253369033f, 0.975385129f},
-std::array<float,2>{0.582548022f, 0.491985828f},
-std::array<float,2>{0.0184009094f, 0.126441687f},
-std::array<float,2>{0.896419108f, 0.722043753f},
-std::array<float,2>{0.457667857f, 0.621563494f},
-std::array<float,2>{0.748355925f, 0.00428045867f},
-std::array<float,2>{0.210332319f, 0.352279902f},
-std::array<float,2>{0.871810973f, 0.83405745f},
-std::array<float,2>{0.0794667602f, 0.921621144f},
-std::array<float,2>{0.953752756f, 0.422724277f},
-std::array<float,2>{0.341320574f, 0.204308912f},
-std::array<float,2>{0.534568787f, 0.664557815f},
-std::array<float,2>{0.14381294f, 0.733040333f},
-std::array<float,2>{0.797954142f, 0.136278629f},
-std::array<float,2>{0.417949051f, 0.498360068f},
-std::array<float,2>{0.67418611f, 0.977947056f},
-std::array<float,2>{0.304535836f, 0.788401604f},
-std::array<float,2>{0.600257874f, 0.294997185f},
-std::array<float,2>{0.0377862006f, 0.08179795f},
-std::array<float,2>{0.910475314f, 0.525388896f},
-std::array<float,2>{0.371050179f, 0.651593626f},
-std::array<float,2>{0.513060033f, 0.225139484f},
-std::array<float,2>{0.114533663f, 0.382988721f},
-std::array<float,2>{0.995365202f, 0.8926723f},
-std::array<float,2>{0.249724984f, 0.849181175f},
-std::array<float,2>{0.837502301f, 0.317350507f},
-std::array<float,2>{0.491557837f, 0.0552734658f},
-std::array<float,2>{0.702307105f, 0.565479159f},
-std::array<float,2>{0.0238713436f, 0.539828241f},
-std::array<float,2>{0.906021416f, 0.12253172f},
-std::array<float,2>{0.261871874f, 0.260881066f},
-std::array<float,2>{0.589089215f, 0.766100645f},
-std::array<float,2>{0.405053228f, 0.943349063f},
-std::array<float,2>{0.648076415f, 0.455344766f},
-std::array<float,2>{0.183115229f, 0.187064379f},
-std::array<float,2>{0.758606553f, 0.712410629f},
-std::array<float,2>{0.271585077f, 0.508220375f},
-std::array<float,2>{0.571810305f, 0.0648098812f},
-std::array<float,2>{0.0139465732f, 0.308764905f},
-std::array<float,2>{0.883553147f, 0.798148155f},
-std::array<float,2>{0.158264145f, 0.986138046f},
-std::array<float,2>{0.769165814f, 0.474604368f},
-std::array<float,2>{0.378441513f, 0.15301168f},
-std::array<float,2>{0.628867269f, 0.742485762f},
-std::array<float,2>{0.103668183f, 0.674042463f},
-std::array<float,2>{0.980247378f, 0.201375738f},
-std::array<float,2>{0.348056763f, 0.413868189f},
-std::array<float,2>{0.530381501f, 0.93474406f},
-std::array<float,2>{0.48113212f, 0.818721771f},
-std::array<float,2>{0.71322006f, 0.363274664f},
-std::array<float,2>{0.233750433f, 0.017256327f},
-std::array<float,2>{0.823655605f, 0.597004294f},
-std::array<float,2>{0.430581152f, 0.694495618f},
-std::array<float,2>{0.666107595f, 0.162848562f},
-std::array<float,2>{0.131812379f, 0.445200384f},
-std::array<float,2>{0.793012679f, 0.96299696f},
-std::array<float,2>{0.0610519126f, 0.757078588f},
-std::array<float,2>{0.922845423f, 0.269843966f},
-std::array<float,2>{0.285936683f, 0.0991294906f},
-std::array<float,2>{0.618525922f, 0.562100708f},
-std::array<float,2>{0.187640905f, 0.580346107f},
-std::array<float,2>{0.845392823f, 0.0334019624f},
-std::array<float,2>{0.440000802f, 0.340418577f},
-std::array<float,2>{0.719280839f, 0.874431729f},
-std::array<float,2>{0.32223621f, 0.889271498f},
-std::array<float,2>{0.546921074f, 0.397142977f},
-std::array<float,2>{0.0659798309f, 0.246046901f},
-std::array<float,2>{0.943488359f, 0.626833916f},
-std::array<float,2>{0.399635941f, 0.608667254f},
-std::array<float,2>{0.641361892f, 0.0276696868f},
-std::array<float,2>{0.185664341f, 0.369518757f},
-std::array<float,2>{0.765124679f, 0.826201856f},
-std::array<float,2>{0.0296846107f, 0.924561381f},
-std::array<float,2>{0.899284959f, 0.420180827f},
-std::array<float,2>{0.261488408f, 0.193799376f},
-std::array<float,2>{0.591076314f, 0.685507953f},
-std::array<float,2>{0.24225536f, 0.738920033f},
-std::array<float,2>{0.840190709f, 0.141079426f},
-std::array<float,2>{0.485248148f, 0.478006124f},
-std::array<float,2>{0.698217094f, 0.993810773f},
-std::array<float,2>{0.373660177f, 0.81089735f},
-std::array<float,2>{0.510210752f, 0.302632987f},
-std::array<float,2>{0.110850126f, 0.077205427f},
-std::array<float,2>{0.996636212f, 0.506623745f},
-std::array<float,2>{0.2989842f, 0.633750081f},
-std::array<float,2>{0.595976114f, 0.240442917f},
-std::array<float,2>{0.0324664824f, 0.402092904f},
-std::array<float,2>{0.907585859f, 0.881696701f},
-std::array<float,2>{0.147086665f, 0.866331518f},
-std::array<float,2>{0.800989985f, 0.329874486f},
-std::array<float,2>{0.420664608f, 0.0468274653f},
-std::array<float,2>{0.677482545f, 0.591305375f},
-std::array<float,2>{0.0839270428f, 0.548280895f},
-std::array<float,2>{0.957955837f, 0.104073815f},
-std::array<float,2>{0.338439822f, 0.274474591f},
-std::array<float,2>{0.537034512f, 0.761645079f},
-std::array<float,2>{0.45655337f, 0.953138232f},
-std::array<float,2>{0.743690073f, 0.451091975f},
-std::array<float,2>{0.203450814f, 0.170017019f},
-std::array<float,2>{0.869234145f, 0.695348561f},
-std::array<float,2>{0.327880144f, 0.518488884f},
-std::array<float,2>{0.554286301f, 0.0873111188f},
-std::array<float,2>{0.0668030754f, 0.288488418f},
-std::array<float,2>{0.93973881f, 0.791750431f},
-std::array<float,2>{0.194019735f, 0.971150041f},
-std::array<float,2>{0.850040436f, 0.487453163f},
-std::array<float,2>{0.445185632f, 0.131472781f},
-std::array<float,2>{0.725715399f, 0.724011898f},
-std::array<float,2>{0.0573108047f, 0.657101929f},
-std::array<float,2>{0.927053928f, 0.211350426f},
-std::array<float,2>{0.283358693f, 0.437453151f},
-std::array<float,2>{0.622405171f, 0.910125256f},
-std::array<float,2>{0.435721964f, 0.840152621f},
-std::array<float,2>{0.671817124f, 0.351041406f},
-std::array<float,2>{0.125230223f, 0.00913525932f},
-std::array<float,2>{0.791787863f, 0.612870038f},
-std::array<float,2>{0.478489429f, 0.703928411f},
-std::array<float,2>{0.714958489f, 0.176311001f},
-std::array<float,2>{0.226818711f, 0.46371004f},
-std::array<float,2>{0.826228499f, 0.947046578f},
-std::array<float,2>{0.106483929f, 0.775742412f},
-std::array<float,2>{0.983623922f, 0.250328124f},
-std::array<float,2>{0.346224964f, 0.109556273f},
-std::array<float,2>{0.526762068f, 0.537085533f},
-std::array<float,2>{0.160621017f, 0.574878752f},
-std::array<float,2>{0.773032844f, 0.0483248197f},
-std::array<float,2>{0.381866902f, 0.326571614f},
-std::array<float,2>{0.630381823f, 0.858328938f},
-std::array<float,2>{0.268462121f, 0.90350616f},
-std::array<float,2>{0.577595532f, 0.377876133f},
-std::array<float,2>{0.00811062939f, 0.231076121f},
-std::array<float,2>{0.886773109f, 0.64083308f},
-std::array<float,2>{0.451373607f, 0.545210898f},
-std::array<float,2>{0.729325533f, 0.120384261f},
-std::array<float,2>{0.197368667f, 0.263195306f},
-std::array<float,2>{0.853048921f, 0.772222877f},
-std::array<float,2>{0.0756385922f, 0.938697219f},
-std::array<float,2>{0.948821962f, 0.45742175f},
-std::array<float,2>{0.318356544f, 0.181957662f},
-std::array<float,2>{0.556150138f, 0.716714084f},
-std::array<float,2>{0.13317506f, 0.652890444f},
-std::array<float,2>{0.782856643f, 0.219994023f},
-std::array<float,2>{0.423163652f, 0.386984229f},
-std::array<float,2>{0.663523138f, 0.895835102f},
-std::array<float,2>{0.293231845f, 0.846482992f},
-std::array<float,2>{0.611584306f, 0.312900901f},
-std::array<float,2>{0.0487837456f, 0.0596849099f},
-std::array<float,2>{0.931035936f, 0.569003701f},
-std::array<float,2>{0.359000176f, 0.727824032f},
-std::array<float,2>{0.520401299f, 0.140536934f},
-std::array<float,2>{0.0975213498f, 0.495264918f},
-std::array<float,2>{0.973468065f, 0.982847691f},
-std::array<float,2>{0.219917282f, 0.78416431f},
-std::array<float,2>{0.816307068f, 0.291823894f},
-std::array<float,2>{0.468997031f, 0.0830790475f},
-std::array<float,2>{0.705012023f, 0.528252602f},
-std::array<float,2>{0.0069846143f, 0.619631469f},
-std::array<float,2>{0.881278157f, 0.00191289384f},
-std::array<float,2>{0.281109393f, 0.358918965f},
-std::array<float,2>{0.565556645f, 0.830840528f},
-std::array<float,2>{0.386658162f, 0.91425544f},
-std::array<float,2>{0.636552691f, 0.426513463f},
-std::array<float,2>{0.169680491f, 0.210911393f},
-std::array<float,2>{0.776264489f, 0.669404209f},
-std::array<float,2>{0.253947824f, 0.585501075f},
-std::array<float,2>{0.579369903f, 0.0383353084f},
-std::array<float,2>{0.0199940428f, 0.339722127f},
-std::array<float,2>{0.894513071f, 0.867401063f},
-std::array<float,2>{0.173537642f, 0.884085655f},
-std::array<float,2>{0.754654109f, 0.391482025f},
-std::array<float,2>{0.392661601f, 0.249759674f},
-std::array<float,2>{0.654984355f, 0.629207134f},
-std::array<float,2>{0.118377455f, 0.689509034f},
-std::array<float,2>{0.986872733f, 0.157909304f},
-std::array<float,2>{0.366574198f, 0.439636678f},
-std::array<float,2>{0.503798723f, 0.965436637f},
-std::array<float,2>{0.499674678f, 0.751050472f},
-std::array<float,2>{0.689652503f, 0.266086698f},
-std::array<float,2>{0.237174034f, 0.0946954116f},
-std::array<float,2>{0.833740592f, 0.558490157f},
-std::array<float,2>{0.41336754f, 0.679565609f},
-std::array<float,2>{0.679714322f, 0.196997121f},
-std::array<float,2>{0.154057205f, 0.409202754f},
-std::array<float,2>{0.806421816f, 0.930785f},
-std::array<float,2>{0.0467696004f, 0.815726638f},
-std::array<float,2>{0.918651998f, 0.364506543f},
-std::array<float,2>{0.304724842f, 0.0226110891f},
-std::array<float,2>{0.602106214f, 0.599995553f},
-std::array<float,2>{0.215815201f, 0.513621151f},
-std::array<float,2>{0.862482488f, 0.068892844f},
-std::array<float,2>{0.466910899f, 0.305826187f},
-std::array<float,2>{0.735323787f, 0.802399457f},
-std::array<float,2>{0.329610229f, 0.990966797f},
-std::array<float,2>{0.541454792f, 0.472125173f},
-std::array<float,2>{0.0869030654f, 0.151826799f},
-std::array<float,2>{0.964592278f, 0.748290181f},
-std::array<float,2>{0.426889151f, 0.503780067f},
-std::array<float,2>{0.659908712f, 0.0711930841f},
-std::array<float,2>{0.140439555f, 0.297182977f},
-std::array<float,2>{0.786219597f, 0.805992901f},
-std::array<float,2>{0.0541951954f, 0.999470055f},
-std::array<float,2>{0.933914125f, 0.484222323f},
-std::array<float,2>{0.291021436f, 0.145648345f},
-std::array<float,2>{0.61689806f, 0.736287534f},
-std::array<float,2>{0.203091472f, 0.680981874f},
-std::array<float,2>{0.856023967f, 0.190408587f},
-std::array<float,2>{0.448941857f, 0.416936785f},
-std::array<float,2>{0.734055281f, 0.928010345f},
-std::array<float,2>{0.316086233f, 0.820493519f},
-std::array<float,2>{0.562161863f, 0.373152286f},
-std::array<float,2>{0.0718281195f, 0.0256551802f},
-std::array<float,2>{0.951982498f, 0.604347825f},
-std::array<float,2>{0.273787498f, 0.699804008f},
-std::array<float,2>{0.570118845f, 0.167753026f},
-std::array<float,2>{0.0034776805f, 0.447496027f},
-std::array<float,2>{0.877461314f, 0.958812296f},
-std::array<float,2>{0.164623946f, 0.764321685f},
-std::array<float,2>{0.777486682f, 0.280820787f},
-std::array<float,2>{0.389110446f, 0.107468098f},
-std::array<float,2>{0.638006866f, 0.553797662f},
-std::array<float,2>{0.0994744524f, 0.588944912f},
-std::array<float,2>{0.972464204f, 0.041090738f},
-std::array<float,2>{0.354642391f, 0.333020717f},
-std::array<float,2>{0.51738435f, 0.862700105f},
-std::array<float,2>{0.475373238f, 0.878905892f},
-std::array<float,2>{0.710311234f, 0.402678639f},
-std::array<float,2>{0.223405212f, 0.237442791f},
-std::array<float,2>{0.820156693f, 0.639764309f},
-std::array<float,2>{0.360884726f, 0.61627394f},
-std::array<float,2>{0.507173002f, 0.0151685616f},
-std::array<float,2>{0.122791134f, 0.344929636f},
-std::array<float,2>{0.990790904f, 0.836473286f},
-std::array<float,2>{0.241363496f, 0.913473547f},
-std::array<float,2>{0.829378247f, 0.433506966f},
-std::array<float,2>{0.493315458f, 0.217322335f},
-std::array<float,2>{0.693816304f, 0.660689592f},
-std::array<float,2>{0.0165808499f, 0.718817413f},
-std::array<float,2>{0.897612035f, 0.127083108f},
-std::array<float,2>{0.251616418f, 0.489434481f},
-std::array<float,2>{0.585184157f, 0.973961532f},
-std::array<float,2>{0.39520514f, 0.793825388f},
-std::array<float,2>{0.651962757f, 0.283027738f},
-std::array<float,2>{0.178943381f, 0.0924672186f},
-std::array<float,2>{0.750205457f, 0.521584094f},
-std::array<float,2>{0.46159932f, 0.647976696f},
-std::array<float,2>{0.740333915f, 0.227444336f},
-std::array<float,2>{0.210959375f, 0.379431993f},
-std::array<float,2>{0.865239739f, 0.899879754f},
-std::array<float,2>{0.0911199749f, 0.854437232f},
-std::array<float,2>{0.968346f, 0.322890669f},
-std::array<float,2>{0.333448589f, 0.0523552075f},
-std::array<float,2>{0.544973612f, 0.571484447f},
-std::array<float,2>{0.150866091f, 0.533454597f},
-std::array<float,2>{0.811522841f, 0.114219069f},
-std::array<float,2>{0.409790039f, 0.257707417f},
-std::array<float,2>{0.68372333f, 0.778673053f},
-std::array<float,2>{0.30874598f, 0.950825155f},
-std::array<float,2>{0.606383204f, 0.464931667f},
-std::array<float,2>{0.0399749018f, 0.175404727f},
-std::array<float,2>{0.917844892f, 0.707984328f},
-std::array<float,2>{0.489490807f, 0.563540637f},
-std::array<float,2>{0.700448632f, 0.0580715016f},
-std::array<float,2>{0.246108294f, 0.319445848f},
-std::array<float,2>{0.838091314f, 0.849610686f},
-std::array<float,2>{0.117106065f, 0.891350091f},
-std::array<float,2>{0.993053198f, 0.385186523f},
-std::array<float,2>{0.369021088f, 0.223127887f},
-std::array<float,2>{0.515500069f, 0.65016526f},
-std::array<float,2>{0.181478113f, 0.71459657f},
-std::array<float,2>{0.760320067f, 0.185507908f},
-std::array<float,2>{0.404224604f, 0.454839319f},
-std::array<float,2>{0.645210803f, 0.945142031f},
-std::array<float,2>{0.264555126f, 0.76840204f},
-std::array<float,2>{0.587002575f, 0.259368479f},
-std::array<float,2>{0.0254793521f, 0.123897903f},
-std::array<float,2>{0.903121889f, 0.541114151f},
-std::array<float,2>{0.341977835f, 0.666018844f},
-std::array<float,2>{0.532087445f, 0.205648944f},
-std::array<float,2>{0.0804872513f, 0.424449861f},
-std::array<float,2>{0.95663023f, 0.918179452f},
-std::array<float,2>{0.207914814f, 0.83303678f},
-std::array<float,2>{0.873048723f, 0.355187684f},
-std::array<float,2>{0.460347235f, 0.0059603746f},
-std::array<float,2>{0.747210622f, 0.624434769f},
-std::array<float,2>{0.0362521969f, 0.527313948f},
-std::array<float,2>{0.912970185f, 0.0798221678f},
-std::array<float,2>{0.302562952f, 0.294919938f},
-std::array<float,2>{0.597869694f, 0.786080241f},
-std::array<float,2>{0.415429652f, 0.979752839f},
-std::array<float,2>{0.672644913f, 0.496112078f},
-std::array<float,2>{0.141802475f, 0.133999974f},
-std::array<float,2>{0.799952447f, 0.731520474f},
-std::array<float,2>{0.287463725f, 0.560402691f},
-std::array<float,2>{0.620520175f, 0.0999216363f},
-std::array<float,2>{0.0595072135f, 0.27308628f},
-std::array<float,2>{0.925679386f, 0.754489601f},
-std::array<float,2>{0.130835414f, 0.961524904f},
-std::array<float,2>{0.796193838f, 0.443278104f},
-std::array<float,2>{0.43247211f, 0.161955073f},
-std::array<float,2>{0.664480925f, 0.693028092f},
-std::array<float,2>{0.0637365952f, 0.628416657f},
-std::array<float,2>{0.942391932f, 0.243766442f},
-std::array<float,2>{0.323608249f, 0.39557907f},
-std::array<float,2>{0.549389899f, 0.887629032f},
-std::array<float,2>{0.438108385f, 0.871224999f},
-std::array<float,2>{0.722397923f, 0.342752457f},
-std::array<float,2>{0.189786837f, 0.0329262391f},
-std::array<float,2>{0.84672606f, 0.579069018f},
-std::array<float,2>{0.376176715f, 0.746009707f},
-std::array<float,2>{0.626720071f, 0.155917615f},
-std::array<float,2>{0.157654688f, 0.475934476f},
-std::array<float,2>{0.766654015f, 0.987385392f},
-std::array<float,2>{0.0121760378f, 0.799385846f},
-std::array<float,2>{0.886686504f, 0.312347531f},
-std::array<float,2>{0.271322221f, 0.0639403835f},
-std::array<float,2>{0.572321355f, 0.510960698f},
-std::array<float,2>{0.231485739f, 0.593957663f},
-std::array<float,2>{0.820803225f, 0.0179831795f},
-std::array<float,2>{0.484123468f, 0.3596313f},
-std::array<float,2>{0.711133003f, 0.816991031f},
-std::array<float,2>{0.350727916f, 0.93730408f},
-std::array<float,2>{0.529138088f, 0.411662608f},
-std::array<float,2>{0.103318691f, 0.199847758f},
-std::array<float,2>{0.97804898f, 0.672097921f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.839520693f, 0.67150861f},
-std::array<float,2>{0.188675463f, 0.195777506f},
-std::array<float,2>{0.272228599f, 0.907237291f},
-std::array<float,2>{0.517683983f, 0.33340174f},
-std::array<float,2>{0.672056615f, 0.802514732f},
-std::array<float,2>{0.481130719f, 0.408416897f},
-std::array<float,2>{0.0188007262f, 0.608708143f},
-std::array<float,2>{0.913086474f, 0.00945308525f},
-std::array<float,2>{0.962874711f, 0.960306168f},
-std::array<float,2>{0.120777443f, 0.262703568f},
-std::array<float,2>{0.418461412f, 0.745276988f},
-std::array<float,2>{0.72993499f, 0.145646811f},
-std::array<float,2>{0.595314682f, 0.504606724f},
-std::array<float,2>{0.348638743f, 0.0854914039f},
-std::array<float,2>{0.143907115f, 0.851053059f},
-std::array<float,2>{0.772314191f, 0.450601757f},
-std::array<float,2>{0.90259558f, 0.564807951f},
-std::array<float,2>{0.0316199027f, 0.0341921858f},
-std::array<float,2>{0.453463942f, 0.770064116f},
-std::array<float,2>{0.639224708f, 0.394620478f},
-std::array<float,2>{0.538651526f, 0.903989315f},
-std::array<float,2>{0.304332703f, 0.351095974f},
-std::array<float,2>{0.245164052f, 0.628897965f},
-std::array<float,2>{0.847405255f, 0.226809517f},
-std::array<float,2>{0.798880517f, 0.827539682f},
-std::array<float,2>{0.18664065f, 0.488632292f},
-std::array<float,2>{0.321867615f, 0.560738802f},
-std::array<float,2>{0.576193869f, 0.104250602f},
-std::array<float,2>{0.709166884f, 0.690303981f},
-std::array<float,2>{0.404224694f, 0.165996909f},
-std::array<float,2>{0.0648777783f, 0.991604269f},
-std::array<float,2>{0.991875887f, 0.301553011f},
-std::array<float,2>{0.975681543f, 0.729781032f},
-std::array<float,2>{0.0896456242f, 0.137741938f},
-std::array<float,2>{0.383254379f, 0.949303508f},
-std::array<float,2>{0.700750351f, 0.277298898f},
-std::array<float,2>{0.593457639f, 0.866411567f},
-std::array<float,2>{0.332609206f, 0.468184352f},
-std::array<float,2>{0.167184874f, 0.518556535f},
-std::array<float,2>{0.783037305f, 0.0765646994f},
-std::array<float,2>{0.868986487f, 0.930455565f},
-std::array<float,2>{0.221684262f, 0.31463033f},
-std::array<float,2>{0.296218872f, 0.673798561f},
-std::array<float,2>{0.558818161f, 0.204618767f},
-std::array<float,2>{0.655687213f, 0.610144436f},
-std::array<float,2>{0.444766462f, 0.0298628286f},
-std::array<float,2>{0.0558835045f, 0.796335399f},
-std::array<float,2>{0.882183731f, 0.432978243f},
-std::array<float,2>{0.759147763f, 0.533135891f},
-std::array<float,2>{0.133660421f, 0.121999659f},
-std::array<float,2>{0.372541517f, 0.835359454f},
-std::array<float,2>{0.616530776f, 0.482140362f},
-std::array<float,2>{0.737615585f, 0.975070179f},
-std::array<float,2>{0.424239904f, 0.294318527f},
-std::array<float,2>{0.0981682837f, 0.716601253f},
-std::array<float,2>{0.941000342f, 0.173077613f},
-std::array<float,2>{0.934288561f, 0.760084093f},
-std::array<float,2>{0.0145845162f, 0.386500448f},
-std::array<float,2>{0.498574197f, 0.586370885f},
-std::array<float,2>{0.671291828f, 0.0537668467f},
-std::array<float,2>{0.500723481f, 0.648482263f},
-std::array<float,2>{0.250489712f, 0.237671584f},
-std::array<float,2>{0.209170625f, 0.88851434f},
-std::array<float,2>{0.814276516f, 0.368518353f},
-std::array<float,2>{0.796437621f, 0.710383773f},
-std::array<float,2>{0.163680613f, 0.184885427f},
-std::array<float,2>{0.342725694f, 0.982998192f},
-std::array<float,2>{0.583209217f, 0.283962697f},
-std::array<float,2>{0.689828873f, 0.836808383f},
-std::array<float,2>{0.381892115f, 0.476013333f},
-std::array<float,2>{0.0826139748f, 0.539799631f},
-std::array<float,2>{0.983671904f, 0.115037955f},
-std::array<float,2>{0.88338834f, 0.882796645f},
-std::array<float,2>{0.0514072478f, 0.365477383f},
-std::array<float,2>{0.449335486f, 0.640662909f},
-std::array<float,2>{0.648210824f, 0.246734798f},
-std::array<float,2>{0.548674405f, 0.578363061f},
-std::array<float,2>{0.284040958f, 0.061457362f},
-std::array<float,2>{0.230209306f, 0.757710695f},
-std::array<float,2>{0.860693753f, 0.382444978f},
-std::array<float,2>{0.94923234f, 0.528143823f},
-std::array<float,2>{0.107132494f, 0.0644406751f},
-std::array<float,2>{0.431619078f, 0.873067141f},
-std::array<float,2>{0.749567389f, 0.458291084f},
-std::array<float,2>{0.621662974f, 0.93976891f},
-std::array<float,2>{0.360028356f, 0.270839751f},
-std::array<float,2>{0.129699424f, 0.725793779f},
-std::array<float,2>{0.756174088f, 0.127560288f},
-std::array<float,2>{0.827064812f, 0.784173906f},
-std::array<float,2>{0.217237994f, 0.427580714f},
-std::array<float,2>{0.26333335f, 0.623799264f},
-std::array<float,2>{0.508100271f, 0.0181762949f},
-std::array<float,2>{0.659377933f, 0.68120122f},
-std::array<float,2>{0.49010089f, 0.213892564f},
-std::array<float,2>{0.00245672371f, 0.926825702f},
-std::array<float,2>{0.924019516f, 0.324486583f},
-std::array<float,2>{0.917098343f, 0.638895094f},
-std::array<float,2>{0.0245549884f, 0.220076934f},
-std::array<float,2>{0.470253825f, 0.898427784f},
-std::array<float,2>{0.682382822f, 0.35624516f},
-std::array<float,2>{0.525097549f, 0.779917598f},
-std::array<float,2>{0.274684668f, 0.404772133f},
-std::array<float,2>{0.201902196f, 0.571107805f},
-std::array<float,2>{0.82884115f, 0.0462423675f},
-std::array<float,2>{0.775619924f, 0.997694075f},
-std::array<float,2>{0.15507932f, 0.307387501f},
-std::array<float,2>{0.359294385f, 0.703098893f},
-std::array<float,2>{0.606444359f, 0.160445869f},
-std::array<float,2>{0.721879244f, 0.548578858f},
-std::array<float,2>{0.408434808f, 0.0998981893f},
-std::array<float,2>{0.114836991f, 0.812869966f},
-std::array<float,2>{0.954241574f, 0.493646443f},
-std::array<float,2>{0.853538692f, 0.599789083f},
-std::array<float,2>{0.23901771f, 0.000583178829f},
-std::array<float,2>{0.306683749f, 0.807149172f},
-std::array<float,2>{0.540051579f, 0.415218353f},
-std::array<float,2>{0.627035975f, 0.915067613f},
-std::array<float,2>{0.467811644f, 0.338766664f},
-std::array<float,2>{0.0398723632f, 0.658030629f},
-std::array<float,2>{0.895405233f, 0.195005998f},
-std::array<float,2>{0.997686327f, 0.851715446f},
-std::array<float,2>{0.0707743317f, 0.437970489f},
-std::array<float,2>{0.396477014f, 0.511904418f},
-std::array<float,2>{0.715382636f, 0.0914301574f},
-std::array<float,2>{0.567454636f, 0.73985517f},
-std::array<float,2>{0.319834381f, 0.156237021f},
-std::array<float,2>{0.17244266f, 0.964365423f},
-std::array<float,2>{0.806988299f, 0.256798536f},
-std::array<float,2>{0.865958273f, 0.749661505f},
-std::array<float,2>{0.231807992f, 0.142475784f},
-std::array<float,2>{0.288362861f, 0.95675844f},
-std::array<float,2>{0.551025987f, 0.260021657f},
-std::array<float,2>{0.642712891f, 0.845420778f},
-std::array<float,2>{0.448079765f, 0.445952326f},
-std::array<float,2>{0.0481259972f, 0.500081539f},
-std::array<float,2>{0.88780874f, 0.0782306716f},
-std::array<float,2>{0.980072677f, 0.911183298f},
-std::array<float,2>{0.0809355006f, 0.331417412f},
-std::array<float,2>{0.375477582f, 0.665777683f},
-std::array<float,2>{0.695172012f, 0.200369641f},
-std::array<float,2>{0.581981122f, 0.604340792f},
-std::array<float,2>{0.338026434f, 0.0119117703f},
-std::array<float,2>{0.159924462f, 0.79729414f},
-std::array<float,2>{0.792254329f, 0.411589444f},
-std::array<float,2>{0.928504109f, 0.556731641f},
-std::array<float,2>{0.00581362052f, 0.107444204f},
-std::array<float,2>{0.484780818f, 0.820757329f},
-std::array<float,2>{0.661811709f, 0.485183477f},
-std::array<float,2>{0.513065696f, 0.987904489f},
-std::array<float,2>{0.258403122f, 0.298232049f},
-std::array<float,2>{0.21230419f, 0.693698168f},
-std::array<float,2>{0.823974252f, 0.170680195f},
-std::array<float,2>{0.750078201f, 0.765948117f},
-std::array<float,2>{0.127435297f, 0.392813474f},
-std::array<float,2>{0.365242392f, 0.568706572f},
-std::array<float,2>{0.618371129f, 0.0372768268f},
-std::array<float,2>{0.744667292f, 0.631170213f},
-std::array<float,2>{0.436507732f, 0.232193202f},
-std::array<float,2>{0.103987232f, 0.900428236f},
-std::array<float,2>{0.947552085f, 0.346177667f},
-std::array<float,2>{0.960109234f, 0.67800808f},
-std::array<float,2>{0.112918556f, 0.210045949f},
-std::array<float,2>{0.413441688f, 0.936509073f},
-std::array<float,2>{0.72280848f, 0.320064902f},
-std::array<float,2>{0.604345083f, 0.791493058f},
-std::array<float,2>{0.35504666f, 0.434805989f},
-std::array<float,2>{0.149565205f, 0.615598381f},
-std::array<float,2>{0.77921319f, 0.0241890755f},
-std::array<float,2>{0.834227204f, 0.946583807f},
-std::array<float,2>{0.199200779f, 0.280819505f},
-std::array<float,2>{0.278364509f, 0.730924666f},
-std::array<float,2>{0.52860254f, 0.134138539f},
-std::array<float,2>{0.685503781f, 0.521227956f},
-std::array<float,2>{0.473588526f, 0.0726987645f},
-std::array<float,2>{0.0281248465f, 0.863166332f},
-std::array<float,2>{0.920287073f, 0.463951081f},
-std::array<float,2>{0.809171319f, 0.593711436f},
-std::array<float,2>{0.178631857f, 0.0490952209f},
-std::array<float,2>{0.313808501f, 0.763336122f},
-std::array<float,2>{0.56277895f, 0.389345199f},
-std::array<float,2>{0.713737547f, 0.884779811f},
-std::array<float,2>{0.39088881f, 0.373617232f},
-std::array<float,2>{0.0766152292f, 0.654038012f},
-std::array<float,2>{0.996019661f, 0.23870115f},
-std::array<float,2>{0.892714739f, 0.831605136f},
-std::array<float,2>{0.0453175195f, 0.477049142f},
-std::array<float,2>{0.463554054f, 0.536101043f},
-std::array<float,2>{0.632289886f, 0.117523395f},
-std::array<float,2>{0.542995274f, 0.714462936f},
-std::array<float,2>{0.311030418f, 0.178879261f},
-std::array<float,2>{0.237654448f, 0.971664786f},
-std::array<float,2>{0.858359575f, 0.290854812f},
-std::array<float,2>{0.767974854f, 0.645861745f},
-std::array<float,2>{0.146937832f, 0.242733777f},
-std::array<float,2>{0.346238434f, 0.877248824f},
-std::array<float,2>{0.600614369f, 0.361325115f},
-std::array<float,2>{0.733438432f, 0.751475692f},
-std::array<float,2>{0.416818261f, 0.375863701f},
-std::array<float,2>{0.122307889f, 0.584619045f},
-std::array<float,2>{0.968235195f, 0.0570810884f},
-std::array<float,2>{0.909115911f, 0.980244458f},
-std::array<float,2>{0.0208202358f, 0.288290441f},
-std::array<float,2>{0.480444103f, 0.70500201f},
-std::array<float,2>{0.678394437f, 0.18037799f},
-std::array<float,2>{0.522928476f, 0.545256019f},
-std::array<float,2>{0.267635822f, 0.110613525f},
-std::array<float,2>{0.194965497f, 0.843535662f},
-std::array<float,2>{0.841593981f, 0.472276032f},
-std::array<float,2>{0.984602809f, 0.619705498f},
-std::array<float,2>{0.0678349584f, 0.0211981032f},
-std::array<float,2>{0.399005532f, 0.788033485f},
-std::array<float,2>{0.70647192f, 0.425750434f},
-std::array<float,2>{0.572806835f, 0.922952592f},
-std::array<float,2>{0.325668484f, 0.3220433f},
-std::array<float,2>{0.183122814f, 0.684804857f},
-std::array<float,2>{0.803959489f, 0.217284068f},
-std::array<float,2>{0.848222017f, 0.870804965f},
-std::array<float,2>{0.248458982f, 0.454515338f},
-std::array<float,2>{0.298690706f, 0.523809969f},
-std::array<float,2>{0.535003603f, 0.069390893f},
-std::array<float,2>{0.634307086f, 0.72253257f},
-std::array<float,2>{0.460413277f, 0.128912836f},
-std::array<float,2>{0.0370217301f, 0.942400396f},
-std::array<float,2>{0.899544179f, 0.266667515f},
-std::array<float,2>{0.877733886f, 0.697008133f},
-std::array<float,2>{0.0594482236f, 0.156683266f},
-std::array<float,2>{0.440013766f, 0.995905817f},
-std::array<float,2>{0.650545418f, 0.312103868f},
-std::array<float,2>{0.55854696f, 0.816547275f},
-std::array<float,2>{0.292563558f, 0.499240011f},
-std::array<float,2>{0.226520777f, 0.553757429f},
-std::array<float,2>{0.874052048f, 0.0971317291f},
-std::array<float,2>{0.78612113f, 0.892967343f},
-std::array<float,2>{0.17051667f, 0.35381186f},
-std::array<float,2>{0.331587195f, 0.632894695f},
-std::array<float,2>{0.588514328f, 0.223399669f},
-std::array<float,2>{0.697009265f, 0.575833678f},
-std::array<float,2>{0.389852017f, 0.0400296822f},
-std::array<float,2>{0.0918296203f, 0.776851416f},
-std::array<float,2>{0.970371962f, 0.400745511f},
-std::array<float,2>{0.817954302f, 0.510478675f},
-std::array<float,2>{0.205014572f, 0.0886249542f},
-std::array<float,2>{0.256301343f, 0.859086633f},
-std::array<float,2>{0.504383922f, 0.443137527f},
-std::array<float,2>{0.666876495f, 0.966687441f},
-std::array<float,2>{0.49590525f, 0.252558559f},
-std::array<float,2>{0.00868792366f, 0.736986578f},
-std::array<float,2>{0.929928482f, 0.149790183f},
-std::array<float,2>{0.94236362f, 0.809090257f},
-std::array<float,2>{0.0940090641f, 0.418501019f},
-std::array<float,2>{0.426185548f, 0.596711934f},
-std::array<float,2>{0.741848767f, 0.00534570869f},
-std::array<float,2>{0.610660672f, 0.660744607f},
-std::array<float,2>{0.369554818f, 0.188547119f},
-std::array<float,2>{0.139941961f, 0.918335438f},
-std::array<float,2>{0.761986196f, 0.343545973f},
-std::array<float,2>{0.844709873f, 0.625213027f},
-std::array<float,2>{0.24336502f, 0.229007483f},
-std::array<float,2>{0.301761419f, 0.905092955f},
-std::array<float,2>{0.535618782f, 0.349244744f},
-std::array<float,2>{0.637930095f, 0.773234785f},
-std::array<float,2>{0.456649661f, 0.3969464f},
-std::array<float,2>{0.034570694f, 0.563722074f},
-std::array<float,2>{0.904928803f, 0.0331636481f},
-std::array<float,2>{0.989944935f, 0.989026129f},
-std::array<float,2>{0.0640354306f, 0.303021133f},
-std::array<float,2>{0.405106515f, 0.687736809f},
-std::array<float,2>{0.707746267f, 0.167643979f},
-std::array<float,2>{0.574815392f, 0.56004107f},
-std::array<float,2>{0.323161691f, 0.101875871f},
-std::array<float,2>{0.185293883f, 0.825262189f},
-std::array<float,2>{0.797131538f, 0.4916448f},
-std::array<float,2>{0.910667956f, 0.605905712f},
-std::array<float,2>{0.0170031246f, 0.0102766044f},
-std::array<float,2>{0.483732343f, 0.803723812f},
-std::array<float,2>{0.674868524f, 0.407351732f},
-std::array<float,2>{0.516057968f, 0.908217967f},
-std::array<float,2>{0.270921856f, 0.334007353f},
-std::array<float,2>{0.19073987f, 0.669248283f},
-std::array<float,2>{0.836366236f, 0.198232204f},
-std::array<float,2>{0.771285236f, 0.849078f},
-std::array<float,2>{0.14172408f, 0.452973485f},
-std::array<float,2>{0.350717247f, 0.507310152f},
-std::array<float,2>{0.597334206f, 0.0835613534f},
-std::array<float,2>{0.728169143f, 0.742553234f},
-std::array<float,2>{0.420959204f, 0.14676173f},
-std::array<float,2>{0.117426939f, 0.957586825f},
-std::array<float,2>{0.964684606f, 0.265410274f},
-std::array<float,2>{0.938924968f, 0.717111468f},
-std::array<float,2>{0.101371035f, 0.17395559f},
-std::array<float,2>{0.42220661f, 0.974199295f},
-std::array<float,2>{0.735524058f, 0.294996411f},
-std::array<float,2>{0.613907158f, 0.83349812f},
-std::array<float,2>{0.373252839f, 0.48308304f},
-std::array<float,2>{0.136418611f, 0.534838259f},
-std::array<float,2>{0.760924518f, 0.124421917f},
-std::array<float,2>{0.81520474f, 0.88941741f},
-std::array<float,2>{0.207331926f, 0.37096563f},
-std::array<float,2>{0.253646165f, 0.651443362f},
-std::array<float,2>{0.502836108f, 0.235366628f},
-std::array<float,2>{0.669743419f, 0.589482546f},
-std::array<float,2>{0.496970236f, 0.0522336662f},
-std::array<float,2>{0.0120231649f, 0.758422494f},
-std::array<float,2>{0.937277734f, 0.384469718f},
-std::array<float,2>{0.784727812f, 0.516970038f},
-std::array<float,2>{0.164066955f, 0.0746558085f},
-std::array<float,2>{0.335680753f, 0.86427933f},
-std::array<float,2>{0.590247631f, 0.465160102f},
-std::array<float,2>{0.702531397f, 0.951188922f},
-std::array<float,2>{0.385448903f, 0.273621708f},
-std::array<float,2>{0.0863291919f, 0.72843653f},
-std::array<float,2>{0.97375083f, 0.138764039f},
-std::array<float,2>{0.880756915f, 0.794444323f},
-std::array<float,2>{0.0579585694f, 0.431232721f},
-std::array<float,2>{0.442825496f, 0.611443341f},
-std::array<float,2>{0.653740287f, 0.0285186581f},
-std::array<float,2>{0.561549366f, 0.675324202f},
-std::array<float,2>{0.294613004f, 0.205518723f},
-std::array<float,2>{0.219114363f, 0.93275398f},
-std::array<float,2>{0.870494545f, 0.313198984f},
-std::array<float,2>{0.75554496f, 0.72418952f},
-std::array<float,2>{0.131101251f, 0.125099063f},
-std::array<float,2>{0.362030327f, 0.938753128f},
-std::array<float,2>{0.623908043f, 0.273069561f},
-std::array<float,2>{0.747318387f, 0.872162342f},
-std::array<float,2>{0.433075279f, 0.459023148f},
-std::array<float,2>{0.1079823f, 0.530296028f},
-std::array<float,2>{0.952214777f, 0.0662934929f},
-std::array<float,2>{0.922420681f, 0.928398192f},
-std::array<float,2>{0.000970510417f, 0.327362955f},
-std::array<float,2>{0.490711361f, 0.682466924f},
-std::array<float,2>{0.656718194f, 0.212003171f},
-std::array<float,2>{0.51055032f, 0.62147963f},
-std::array<float,2>{0.265536845f, 0.0163737163f},
-std::array<float,2>{0.21614933f, 0.782945395f},
-std::array<float,2>{0.824272096f, 0.428770036f},
-std::array<float,2>{0.980979145f, 0.542220891f},
-std::array<float,2>{0.0844121426f, 0.116816975f},
-std::array<float,2>{0.379591346f, 0.839623988f},
-std::array<float,2>{0.689142525f, 0.473667145f},
-std::array<float,2>{0.585430264f, 0.981283426f},
-std::array<float,2>{0.34086591f, 0.281723022f},
-std::array<float,2>{0.16166319f, 0.708218753f},
-std::array<float,2>{0.793409884f, 0.18557176f},
-std::array<float,2>{0.861824989f, 0.755550623f},
-std::array<float,2>{0.227655664f, 0.380743295f},
-std::array<float,2>{0.28211996f, 0.581293523f},
-std::array<float,2>{0.550106108f, 0.058604002f},
-std::array<float,2>{0.645307064f, 0.643537402f},
-std::array<float,2>{0.452916205f, 0.249079823f},
-std::array<float,2>{0.0530459844f, 0.880336761f},
-std::array<float,2>{0.885733426f, 0.364804029f},
-std::array<float,2>{0.896542132f, 0.658295751f},
-std::array<float,2>{0.0418922491f, 0.19282198f},
-std::array<float,2>{0.466739386f, 0.916790247f},
-std::array<float,2>{0.625064135f, 0.336607963f},
-std::array<float,2>{0.541561723f, 0.80619818f},
-std::array<float,2>{0.305431306f, 0.417754263f},
-std::array<float,2>{0.242107227f, 0.599141598f},
-std::array<float,2>{0.853172839f, 0.00213185069f},
-std::array<float,2>{0.805787146f, 0.962464809f},
-std::array<float,2>{0.173877507f, 0.255844653f},
-std::array<float,2>{0.317623585f, 0.742174625f},
-std::array<float,2>{0.569833696f, 0.153358877f},
-std::array<float,2>{0.718084455f, 0.514964938f},
-std::array<float,2>{0.397157192f, 0.0921769738f},
-std::array<float,2>{0.0729897842f, 0.855317235f},
-std::array<float,2>{0.99985826f, 0.440808654f},
-std::array<float,2>{0.831395507f, 0.572652757f},
-std::array<float,2>{0.199631348f, 0.0437312275f},
-std::array<float,2>{0.27698344f, 0.778436542f},
-std::array<float,2>{0.527078331f, 0.403946817f},
-std::array<float,2>{0.681224465f, 0.896328866f},
-std::array<float,2>{0.472287655f, 0.35919556f},
-std::array<float,2>{0.0256088972f, 0.63728261f},
-std::array<float,2>{0.914108276f, 0.222467691f},
-std::array<float,2>{0.955756128f, 0.814758182f},
-std::array<float,2>{0.117095105f, 0.494407743f},
-std::array<float,2>{0.40661031f, 0.549089551f},
-std::array<float,2>{0.719285667f, 0.0995370671f},
-std::array<float,2>{0.608495831f, 0.700117588f},
-std::array<float,2>{0.356316388f, 0.16399236f},
-std::array<float,2>{0.153838545f, 0.999418318f},
-std::array<float,2>{0.774413526f, 0.305266976f},
-std::array<float,2>{0.820908785f, 0.691437781f},
-std::array<float,2>{0.214477599f, 0.169035137f},
-std::array<float,2>{0.260903865f, 0.986135185f},
-std::array<float,2>{0.514645457f, 0.300643474f},
-std::array<float,2>{0.66245383f, 0.823855698f},
-std::array<float,2>{0.486741841f, 0.486949116f},
-std::array<float,2>{0.00691321399f, 0.555602074f},
-std::array<float,2>{0.926222205f, 0.106969275f},
-std::array<float,2>{0.946270645f, 0.900176406f},
-std::array<float,2>{0.102485523f, 0.344893396f},
-std::array<float,2>{0.433905303f, 0.62959224f},
-std::array<float,2>{0.742467701f, 0.232584149f},
-std::array<float,2>{0.620470881f, 0.56665051f},
-std::array<float,2>{0.36442101f, 0.0351699293f},
-std::array<float,2>{0.126385465f, 0.768415272f},
-std::array<float,2>{0.753019214f, 0.39091298f},
-std::array<float,2>{0.890304208f, 0.502380192f},
-std::array<float,2>{0.0498252399f, 0.0803239271f},
-std::array<float,2>{0.445527434f, 0.846679866f},
-std::array<float,2>{0.641633987f, 0.448166281f},
-std::array<float,2>{0.553608537f, 0.953727782f},
-std::array<float,2>{0.286085159f, 0.259606481f},
-std::array<float,2>{0.232532054f, 0.747338712f},
-std::array<float,2>{0.864974558f, 0.143507749f},
-std::array<float,2>{0.789400697f, 0.799756706f},
-std::array<float,2>{0.158052325f, 0.412227929f},
-std::array<float,2>{0.337065428f, 0.603314161f},
-std::array<float,2>{0.578818142f, 0.0142292753f},
-std::array<float,2>{0.691421688f, 0.667114615f},
-std::array<float,2>{0.377754509f, 0.202441588f},
-std::array<float,2>{0.0793215036f, 0.91401124f},
-std::array<float,2>{0.976849139f, 0.329414487f},
-std::array<float,2>{0.992786586f, 0.654878974f},
-std::array<float,2>{0.0742250308f, 0.240341321f},
-std::array<float,2>{0.392972022f, 0.882892549f},
-std::array<float,2>{0.712720871f, 0.372543186f},
-std::array<float,2>{0.565849245f, 0.763802588f},
-std::array<float,2>{0.315074205f, 0.388270289f},
-std::array<float,2>{0.176501825f, 0.591084063f},
-std::array<float,2>{0.812191248f, 0.0469158217f},
-std::array<float,2>{0.855568647f, 0.969458461f},
-std::array<float,2>{0.235653713f, 0.292288125f},
-std::array<float,2>{0.308834672f, 0.711335063f},
-std::array<float,2>{0.545890391f, 0.175825015f},
-std::array<float,2>{0.629749179f, 0.537792027f},
-std::array<float,2>{0.461737752f, 0.119459689f},
-std::array<float,2>{0.0443664044f, 0.828779221f},
-std::array<float,2>{0.892473519f, 0.479954511f},
-std::array<float,2>{0.780152738f, 0.614552021f},
-std::array<float,2>{0.152122632f, 0.0268563256f},
-std::array<float,2>{0.352245241f, 0.790849805f},
-std::array<float,2>{0.602240503f, 0.435695469f},
-std::array<float,2>{0.726210177f, 0.934297264f},
-std::array<float,2>{0.411648959f, 0.317423493f},
-std::array<float,2>{0.110217616f, 0.676051617f},
-std::array<float,2>{0.958641112f, 0.207061067f},
-std::array<float,2>{0.919044971f, 0.859577835f},
-std::array<float,2>{0.0307797138f, 0.461447448f},
-std::array<float,2>{0.476290017f, 0.521898627f},
-std::array<float,2>{0.687373042f, 0.0714954659f},
-std::array<float,2>{0.529956341f, 0.732564628f},
-std::array<float,2>{0.280978084f, 0.136524498f},
-std::array<float,2>{0.196430981f, 0.947395563f},
-std::array<float,2>{0.833020151f, 0.277518541f},
-std::array<float,2>{0.802258551f, 0.687254369f},
-std::array<float,2>{0.181425214f, 0.215870127f},
-std::array<float,2>{0.327082366f, 0.92505312f},
-std::array<float,2>{0.571341753f, 0.322571993f},
-std::array<float,2>{0.70395124f, 0.786015153f},
-std::array<float,2>{0.400435925f, 0.422416359f},
-std::array<float,2>{0.0692053735f, 0.619045317f},
-std::array<float,2>{0.987594187f, 0.0215736181f},
-std::array<float,2>{0.902012706f, 0.943435609f},
-std::array<float,2>{0.0389885418f, 0.268015414f},
-std::array<float,2>{0.458411157f, 0.720073283f},
-std::array<float,2>{0.635896444f, 0.132676527f},
-std::array<float,2>{0.532875299f, 0.526497364f},
-std::array<float,2>{0.298908651f, 0.0682975277f},
-std::array<float,2>{0.247626647f, 0.868390679f},
-std::array<float,2>{0.849994957f, 0.456005663f},
-std::array<float,2>{0.966078937f, 0.583153725f},
-std::array<float,2>{0.123840407f, 0.0564952306f},
-std::array<float,2>{0.414564401f, 0.753616631f},
-std::array<float,2>{0.732138515f, 0.378581583f},
-std::array<float,2>{0.598248124f, 0.876691878f},
-std::array<float,2>{0.345182389f, 0.36307323f},
-std::array<float,2>{0.144829437f, 0.64650327f},
-std::array<float,2>{0.765637875f, 0.245176941f},
-std::array<float,2>{0.842512131f, 0.841750443f},
-std::array<float,2>{0.192963019f, 0.470637947f},
-std::array<float,2>{0.267305374f, 0.544330835f},
-std::array<float,2>{0.520703495f, 0.11165259f},
-std::array<float,2>{0.676360369f, 0.705554307f},
-std::array<float,2>{0.477442175f, 0.181860909f},
-std::array<float,2>{0.0226818603f, 0.977760971f},
-std::array<float,2>{0.907292545f, 0.285292536f},
-std::array<float,2>{0.932443857f, 0.735070944f},
-std::array<float,2>{0.0110054519f, 0.151854798f},
-std::array<float,2>{0.492947966f, 0.967172027f},
-std::array<float,2>{0.664614141f, 0.250111312f},
-std::array<float,2>{0.507698655f, 0.85670948f},
-std::array<float,2>{0.254079819f, 0.443937123f},
-std::array<float,2>{0.205379814f, 0.508508563f},
-std::array<float,2>{0.818717957f, 0.0872667879f},
-std::array<float,2>{0.764781773f, 0.920260489f},
-std::array<float,2>{0.138398007f, 0.341364443f},
-std::array<float,2>{0.367981881f, 0.662140727f},
-std::array<float,2>{0.612347662f, 0.191130623f},
-std::array<float,2>{0.739590526f, 0.59412837f},
-std::array<float,2>{0.428276122f, 0.0075433841f},
-std::array<float,2>{0.0957193151f, 0.811392069f},
-std::array<float,2>{0.943840384f, 0.421563268f},
-std::array<float,2>{0.871381104f, 0.551083803f},
-std::array<float,2>{0.223761395f, 0.0956514776f},
-std::array<float,2>{0.290954381f, 0.818688691f},
-std::array<float,2>{0.555339634f, 0.497369468f},
-std::array<float,2>{0.648644745f, 0.992206454f},
-std::array<float,2>{0.43794924f, 0.309702873f},
-std::array<float,2>{0.0620060675f, 0.697702289f},
-std::array<float,2>{0.876235247f, 0.160047874f},
-std::array<float,2>{0.971247494f, 0.774027944f},
-std::array<float,2>{0.0917643979f, 0.398447663f},
-std::array<float,2>{0.386958212f, 0.577856481f},
-std::array<float,2>{0.698443413f, 0.0418079831f},
-std::array<float,2>{0.587291598f, 0.636105299f},
-std::array<float,2>{0.329576015f, 0.224695459f},
-std::array<float,2>{0.169050083f, 0.891740918f},
-std::array<float,2>{0.787607551f, 0.351830095f},
-std::array<float,2>{0.813298464f, 0.650616169f},
-std::array<float,2>{0.210094646f, 0.234415516f},
-std::array<float,2>{0.251751751f, 0.88978678f},
-std::array<float,2>{0.501107335f, 0.369461268f},
-std::array<float,2>{0.670059144f, 0.759166777f},
-std::array<float,2>{0.499127299f, 0.383375764f},
-std::array<float,2>{0.0155515326f, 0.588752866f},
-std::array<float,2>{0.935356855f, 0.0516618676f},
-std::array<float,2>{0.939621508f, 0.973091066f},
-std::array<float,2>{0.0995065421f, 0.296210021f},
-std::array<float,2>{0.425004601f, 0.717917681f},
-std::array<float,2>{0.736343265f, 0.17482166f},
-std::array<float,2>{0.615855098f, 0.533208847f},
-std::array<float,2>{0.371950388f, 0.123787604f},
-std::array<float,2>{0.133838415f, 0.832951546f},
-std::array<float,2>{0.757842302f, 0.484027833f},
-std::array<float,2>{0.88139683f, 0.612700701f},
-std::array<float,2>{0.0549402535f, 0.0274123438f},
-std::array<float,2>{0.44417733f, 0.793342233f},
-std::array<float,2>{0.654623389f, 0.43034184f},
-std::array<float,2>{0.560117185f, 0.93250227f},
-std::array<float,2>{0.295303285f, 0.314184397f},
-std::array<float,2>{0.221463159f, 0.673946023f},
-std::array<float,2>{0.867684484f, 0.206384942f},
-std::array<float,2>{0.781999171f, 0.863441885f},
-std::array<float,2>{0.166302577f, 0.465896934f},
-std::array<float,2>{0.333625168f, 0.516488314f},
-std::array<float,2>{0.591930807f, 0.0756140798f},
-std::array<float,2>{0.699929476f, 0.727462411f},
-std::array<float,2>{0.384499967f, 0.140303209f},
-std::array<float,2>{0.0883978903f, 0.95230937f},
-std::array<float,2>{0.975427806f, 0.274725825f},
-std::array<float,2>{0.990827024f, 0.68920064f},
-std::array<float,2>{0.0655926168f, 0.166081503f},
-std::array<float,2>{0.402893215f, 0.989803016f},
-std::array<float,2>{0.71078968f, 0.303878754f},
-std::array<float,2>{0.57787621f, 0.824932873f},
-std::array<float,2>{0.320369869f, 0.490669489f},
-std::array<float,2>{0.185634688f, 0.558877468f},
-std::array<float,2>{0.80005753f, 0.1030747f},
-std::array<float,2>{0.845970213f, 0.905907333f},
-std::array<float,2>{0.244926184f, 0.348419607f},
-std::array<float,2>{0.303000122f, 0.626836658f},
-std::array<float,2>{0.537561476f, 0.229834944f},
-std::array<float,2>{0.640518665f, 0.563446343f},
-std::array<float,2>{0.454707205f, 0.0316785201f},
-std::array<float,2>{0.0328854732f, 0.771775067f},
-std::array<float,2>{0.903550446f, 0.397661507f},
-std::array<float,2>{0.77327764f, 0.506524444f},
-std::array<float,2>{0.142945856f, 0.0825006515f},
-std::array<float,2>{0.34860605f, 0.848348141f},
-std::array<float,2>{0.594029725f, 0.451954246f},
-std::array<float,2>{0.728936017f, 0.958765924f},
-std::array<float,2>{0.41980508f, 0.263682753f},
-std::array<float,2>{0.119579017f, 0.743933499f},
-std::array<float,2>{0.9611516f, 0.148277923f},
-std::array<float,2>{0.912113965f, 0.803604543f},
-std::array<float,2>{0.017972162f, 0.407102019f},
-std::array<float,2>{0.481505781f, 0.607085168f},
-std::array<float,2>{0.673693597f, 0.0116685433f},
-std::array<float,2>{0.519530058f, 0.668887079f},
-std::array<float,2>{0.273366511f, 0.198827133f},
-std::array<float,2>{0.187936053f, 0.909303069f},
-std::array<float,2>{0.838266194f, 0.335823953f},
-std::array<float,2>{0.808144808f, 0.740691185f},
-std::array<float,2>{0.173361629f, 0.153281227f},
-std::array<float,2>{0.319241315f, 0.961199284f},
-std::array<float,2>{0.567273617f, 0.254443288f},
-std::array<float,2>{0.715824783f, 0.853954196f},
-std::array<float,2>{0.395045668f, 0.439542592f},
-std::array<float,2>{0.0721845403f, 0.514621794f},
-std::array<float,2>{0.996487021f, 0.0929243565f},
-std::array<float,2>{0.895512819f, 0.917617619f},
-std::array<float,2>{0.0401442572f, 0.337309778f},
-std::array<float,2>{0.467417896f, 0.659661233f},
-std::array<float,2>{0.628061593f, 0.191842079f},
-std::array<float,2>{0.539277554f, 0.598189771f},
-std::array<float,2>{0.307710677f, 0.00296843098f},
-std::array<float,2>{0.239918277f, 0.805234849f},
-std::array<float,2>{0.854581296f, 0.416261673f},
-std::array<float,2>{0.95393002f, 0.550532699f},
-std::array<float,2>{0.113968f, 0.0980463773f},
-std::array<float,2>{0.409458339f, 0.816226065f},
-std::array<float,2>{0.721333385f, 0.495910138f},
-std::array<float,2>{0.607152581f, 0.99806422f},
-std::array<float,2>{0.358205706f, 0.306428373f},
-std::array<float,2>{0.156103641f, 0.700619221f},
-std::array<float,2>{0.77695334f, 0.16214326f},
-std::array<float,2>{0.829220474f, 0.778183758f},
-std::array<float,2>{0.20274657f, 0.402923018f},
-std::array<float,2>{0.274304152f, 0.573379755f},
-std::array<float,2>{0.523442388f, 0.044761546f},
-std::array<float,2>{0.683570564f, 0.637830913f},
-std::array<float,2>{0.469068468f, 0.221120149f},
-std::array<float,2>{0.0234484561f, 0.894832909f},
-std::array<float,2>{0.916566551f, 0.357790321f},
-std::array<float,2>{0.925628841f, 0.683131158f},
-std::array<float,2>{0.00354105211f, 0.211307913f},
-std::array<float,2>{0.48832652f, 0.929551363f},
-std::array<float,2>{0.658298492f, 0.326699823f},
-std::array<float,2>{0.509753704f, 0.781855047f},
-std::array<float,2>{0.261785835f, 0.428290933f},
-std::array<float,2>{0.217843682f, 0.62212491f},
-std::array<float,2>{0.827618599f, 0.016758224f},
-std::array<float,2>{0.757201135f, 0.938230157f},
-std::array<float,2>{0.130757913f, 0.272391975f},
-std::array<float,2>{0.361061066f, 0.72306782f},
-std::array<float,2>{0.622350216f, 0.126825437f},
-std::array<float,2>{0.748464346f, 0.530070484f},
-std::array<float,2>{0.429828823f, 0.0648450702f},
-std::array<float,2>{0.10579484f, 0.871274054f},
-std::array<float,2>{0.950749338f, 0.460737079f},
-std::array<float,2>{0.859453261f, 0.580390573f},
-std::array<float,2>{0.228731975f, 0.0601367019f},
-std::array<float,2>{0.28497985f, 0.754801452f},
-std::array<float,2>{0.547611356f, 0.379154176f},
-std::array<float,2>{0.646567523f, 0.879565239f},
-std::array<float,2>{0.450365543f, 0.364115328f},
-std::array<float,2>{0.0525045767f, 0.643795788f},
-std::array<float,2>{0.884339571f, 0.248046964f},
-std::array<float,2>{0.983016074f, 0.838196278f},
-std::array<float,2>{0.0832875296f, 0.473077416f},
-std::array<float,2>{0.381116152f, 0.541888118f},
-std::array<float,2>{0.690705895f, 0.115378514f},
-std::array<float,2>{0.582306266f, 0.707437158f},
-std::array<float,2>{0.343059599f, 0.186953932f},
-std::array<float,2>{0.16252175f, 0.981778979f},
-std::array<float,2>{0.795664668f, 0.282349557f},
-std::array<float,2>{0.858965516f, 0.712755501f},
-std::array<float,2>{0.236403272f, 0.177568689f},
-std::array<float,2>{0.311901122f, 0.970352113f},
-std::array<float,2>{0.544542015f, 0.291917026f},
-std::array<float,2>{0.631109178f, 0.829199672f},
-std::array<float,2>{0.46465227f, 0.479378611f},
-std::array<float,2>{0.0467473976f, 0.53888613f},
-std::array<float,2>{0.893887043f, 0.12013898f},
-std::array<float,2>{0.994951427f, 0.883839905f},
-std::array<float,2>{0.0780579597f, 0.371685803f},
-std::array<float,2>{0.39172098f, 0.655677915f},
-std::array<float,2>{0.713891864f, 0.241672978f},
-std::array<float,2>{0.563703716f, 0.590120673f},
-std::array<float,2>{0.312689692f, 0.0484438315f},
-std::array<float,2>{0.179087564f, 0.764939308f},
-std::array<float,2>{0.809624374f, 0.387576461f},
-std::array<float,2>{0.921186566f, 0.523156583f},
-std::array<float,2>{0.0292054415f, 0.071145907f},
-std::array<float,2>{0.47429952f, 0.86099714f},
-std::array<float,2>{0.684233844f, 0.46216011f},
-std::array<float,2>{0.527556598f, 0.948937714f},
-std::array<float,2>{0.277381897f, 0.279238403f},
-std::array<float,2>{0.197723076f, 0.734318554f},
-std::array<float,2>{0.835571051f, 0.1354177f},
-std::array<float,2>{0.777771413f, 0.789300382f},
-std::array<float,2>{0.149117216f, 0.436785132f},
-std::array<float,2>{0.353555024f, 0.613746762f},
-std::array<float,2>{0.604593575f, 0.0258031692f},
-std::array<float,2>{0.723788023f, 0.677214861f},
-std::array<float,2>{0.412821442f, 0.208295241f},
-std::array<float,2>{0.111799173f, 0.935066283f},
-std::array<float,2>{0.959103644f, 0.3170681f},
-std::array<float,2>{0.949094594f, 0.630654514f},
-std::array<float,2>{0.104558185f, 0.233843207f},
-std::array<float,2>{0.4371939f, 0.898803234f},
-std::array<float,2>{0.745231569f, 0.344190657f},
-std::array<float,2>{0.61766094f, 0.768830657f},
-std::array<float,2>{0.366451293f, 0.391676992f},
-std::array<float,2>{0.12848635f, 0.567804396f},
-std::array<float,2>{0.751573503f, 0.0366506204f},
-std::array<float,2>{0.82299006f, 0.984997749f},
-std::array<float,2>{0.211884081f, 0.299767733f},
-std::array<float,2>{0.259348691f, 0.692909896f},
-std::array<float,2>{0.511878908f, 0.168040782f},
-std::array<float,2>{0.660755277f, 0.55566442f},
-std::array<float,2>{0.485700577f, 0.105591603f},
-std::array<float,2>{0.00442604395f, 0.822411716f},
-std::array<float,2>{0.928877473f, 0.488165885f},
-std::array<float,2>{0.791558087f, 0.601851583f},
-std::array<float,2>{0.158850476f, 0.0154851684f},
-std::array<float,2>{0.338920206f, 0.800369442f},
-std::array<float,2>{0.580258369f, 0.414008558f},
-std::array<float,2>{0.693570733f, 0.912462652f},
-std::array<float,2>{0.376682967f, 0.32826671f},
-std::array<float,2>{0.0817246065f, 0.666772127f},
-std::array<float,2>{0.978981614f, 0.202117816f},
-std::array<float,2>{0.88750571f, 0.845810115f},
-std::array<float,2>{0.0473596528f, 0.448249847f},
-std::array<float,2>{0.448426217f, 0.502951443f},
-std::array<float,2>{0.644079566f, 0.0815199912f},
-std::array<float,2>{0.551785648f, 0.746093988f},
-std::array<float,2>{0.288058013f, 0.144263476f},
-std::array<float,2>{0.231037572f, 0.954490066f},
-std::array<float,2>{0.866855919f, 0.258272082f},
-std::array<float,2>{0.763174117f, 0.663846552f},
-std::array<float,2>{0.138808399f, 0.189859107f},
-std::array<float,2>{0.371035695f, 0.921266735f},
-std::array<float,2>{0.610175014f, 0.340071201f},
-std::array<float,2>{0.740325809f, 0.811959326f},
-std::array<float,2>{0.427039593f, 0.420094699f},
-std::array<float,2>{0.095096007f, 0.595185459f},
-std::array<float,2>{0.942946196f, 0.00633966597f},
-std::array<float,2>{0.931018531f, 0.968697429f},
-std::array<float,2>{0.00908687338f, 0.251769781f},
-std::array<float,2>{0.494521856f, 0.735469162f},
-std::array<float,2>{0.667331338f, 0.1506657f},
-std::array<float,2>{0.505046606f, 0.509360015f},
-std::array<float,2>{0.257135063f, 0.0860491917f},
-std::array<float,2>{0.203211904f, 0.855859518f},
-std::array<float,2>{0.816506684f, 0.44462809f},
-std::array<float,2>{0.969340265f, 0.577139735f},
-std::array<float,2>{0.0936541632f, 0.0422301516f},
-std::array<float,2>{0.389506131f, 0.774478316f},
-std::array<float,2>{0.696107209f, 0.399696708f},
-std::array<float,2>{0.589433432f, 0.890871167f},
-std::array<float,2>{0.330389857f, 0.353200585f},
-std::array<float,2>{0.171105385f, 0.635366559f},
-std::array<float,2>{0.786918402f, 0.226071507f},
-std::array<float,2>{0.873545229f, 0.820108652f},
-std::array<float,2>{0.225352153f, 0.49698776f},
-std::array<float,2>{0.291119128f, 0.5520733f},
-std::array<float,2>{0.556717455f, 0.093956627f},
-std::array<float,2>{0.651666701f, 0.69868964f},
-std::array<float,2>{0.440800279f, 0.158666298f},
-std::array<float,2>{0.0598470084f, 0.993388236f},
-std::array<float,2>{0.878810406f, 0.308660448f},
-std::array<float,2>{0.899246216f, 0.719171762f},
-std::array<float,2>{0.0355818458f, 0.131801337f},
-std::array<float,2>{0.459344894f, 0.944980025f},
-std::array<float,2>{0.633493423f, 0.269289941f},
-std::array<float,2>{0.533477783f, 0.867901683f},
-std::array<float,2>{0.297552079f, 0.456881106f},
-std::array<float,2>{0.249135792f, 0.526107609f},
-std::array<float,2>{0.848811865f, 0.0673008412f},
-std::array<float,2>{0.803232133f, 0.924627066f},
-std::array<float,2>{0.182181582f, 0.323806584f},
-std::array<float,2>{0.324292541f, 0.685784042f},
-std::array<float,2>{0.57343626f, 0.215723619f},
-std::array<float,2>{0.706044197f, 0.617198527f},
-std::array<float,2>{0.400244504f, 0.0227711704f},
-std::array<float,2>{0.0672329664f, 0.786929965f},
-std::array<float,2>{0.986290991f, 0.423122883f},
-std::array<float,2>{0.840326428f, 0.543724358f},
-std::array<float,2>{0.193634883f, 0.112444773f},
-std::array<float,2>{0.269066036f, 0.840522826f},
-std::array<float,2>{0.522026658f, 0.468987346f},
-std::array<float,2>{0.679371893f, 0.97669214f},
-std::array<float,2>{0.479020685f, 0.28660351f},
-std::array<float,2>{0.0199630186f, 0.706289947f},
-std::array<float,2>{0.90943706f, 0.182618737f},
-std::array<float,2>{0.96696192f, 0.752043068f},
-std::array<float,2>{0.122070134f, 0.377064735f},
-std::array<float,2>{0.41715461f, 0.582497835f},
-std::array<float,2>{0.73289144f, 0.0548666753f},
-std::array<float,2>{0.599774361f, 0.647679567f},
-std::array<float,2>{0.347207457f, 0.24418737f},
-std::array<float,2>{0.148254067f, 0.875633419f},
-std::array<float,2>{0.769204438f, 0.361664027f},
-std::array<float,2>{0.870065689f, 0.672476172f},
-std::array<float,2>{0.220130742f, 0.203921556f},
-std::array<float,2>{0.293219656f, 0.930853009f},
-std::array<float,2>{0.560828388f, 0.316164583f},
-std::array<float,2>{0.652449965f, 0.795823693f},
-std::array<float,2>{0.442057729f, 0.432460487f},
-std::array<float,2>{0.0569020659f, 0.610690236f},
-std::array<float,2>{0.879700363f, 0.0310388524f},
-std::array<float,2>{0.973236501f, 0.950924695f},
-std::array<float,2>{0.0874340609f, 0.276334286f},
-std::array<float,2>{0.386596471f, 0.729034185f},
-std::array<float,2>{0.701393962f, 0.13735798f},
-std::array<float,2>{0.59129566f, 0.517707705f},
-std::array<float,2>{0.334802598f, 0.0780089498f},
-std::array<float,2>{0.165259957f, 0.866053998f},
-std::array<float,2>{0.783471167f, 0.46751225f},
-std::array<float,2>{0.93617034f, 0.586992443f},
-std::array<float,2>{0.0136026535f, 0.0531956404f},
-std::array<float,2>{0.497545451f, 0.761638403f},
-std::array<float,2>{0.668569386f, 0.385375142f},
-std::array<float,2>{0.503093064f, 0.887660623f},
-std::array<float,2>{0.252903759f, 0.367403477f},
-std::array<float,2>{0.208636194f, 0.650001824f},
-std::array<float,2>{0.816146851f, 0.237275019f},
-std::array<float,2>{0.759962499f, 0.834300756f},
-std::array<float,2>{0.135642901f, 0.481145918f},
-std::array<float,2>{0.374213606f, 0.531284213f},
-std::array<float,2>{0.61435473f, 0.122904949f},
-std::array<float,2>{0.734692931f, 0.715565503f},
-std::array<float,2>{0.423280597f, 0.172256738f},
-std::array<float,2>{0.100091457f, 0.975909412f},
-std::array<float,2>{0.93773967f, 0.293903232f},
-std::array<float,2>{0.96356672f, 0.74503386f},
-std::array<float,2>{0.118597932f, 0.145138398f},
-std::array<float,2>{0.420600861f, 0.959221601f},
-std::array<float,2>{0.727533102f, 0.262671113f},
-std::array<float,2>{0.596471548f, 0.850216866f},
-std::array<float,2>{0.349798232f, 0.449612588f},
-std::array<float,2>{0.140691891f, 0.505087376f},
-std::array<float,2>{0.77027446f, 0.0847394988f},
-std::array<float,2>{0.837188661f, 0.906665921f},
-std::array<float,2>{0.190020829f, 0.332161963f},
-std::array<float,2>{0.270239979f, 0.670012057f},
-std::array<float,2>{0.51747191f, 0.197242528f},
-std::array<float,2>{0.674774766f, 0.607980967f},
-std::array<float,2>{0.483027697f, 0.00857791863f},
-std::array<float,2>{0.0158366002f, 0.801071763f},
-std::array<float,2>{0.911200523f, 0.409671426f},
-std::array<float,2>{0.798663557f, 0.561958134f},
-std::array<float,2>{0.183920398f, 0.105038159f},
-std::array<float,2>{0.324033231f, 0.826208472f},
-std::array<float,2>{0.575582623f, 0.48985374f},
-std::array<float,2>{0.708313406f, 0.991174102f},
-std::array<float,2>{0.405642062f, 0.302602857f},
-std::array<float,2>{0.0633464381f, 0.690576434f},
-std::array<float,2>{0.989066124f, 0.164372325f},
-std::array<float,2>{0.906145751f, 0.771164775f},
-std::array<float,2>{0.0338055156f, 0.395962209f},
-std::array<float,2>{0.45527482f, 0.565796256f},
-std::array<float,2>{0.636810422f, 0.0337660648f},
-std::array<float,2>{0.536954939f, 0.627300382f},
-std::array<float,2>{0.301077247f, 0.227662683f},
-std::array<float,2>{0.242589638f, 0.903266549f},
-std::array<float,2>{0.845636487f, 0.350124478f},
-std::array<float,2>{0.775334656f, 0.702133775f},
-std::array<float,2>{0.152358413f, 0.161977082f},
-std::array<float,2>{0.35668537f, 0.996191084f},
-std::array<float,2>{0.607946396f, 0.308246583f},
-std::array<float,2>{0.719791114f, 0.81415242f},
-std::array<float,2>{0.407364547f, 0.492830634f},
-std::array<float,2>{0.115692094f, 0.547536433f},
-std::array<float,2>{0.956206381f, 0.100839689f},
-std::array<float,2>{0.916012287f, 0.896626294f},
-std::array<float,2>{0.0264150035f, 0.357258618f},
-std::array<float,2>{0.471258104f, 0.639960408f},
-std::array<float,2>{0.679882348f, 0.219490498f},
-std::array<float,2>{0.526037872f, 0.571992815f},
-std::array<float,2>{0.275815636f, 0.0452411324f},
-std::array<float,2>{0.2009321f, 0.780888975f},
-std::array<float,2>{0.830958664f, 0.40609473f},
-std::array<float,2>{0.998237789f, 0.51298666f},
-std::array<float,2>{0.0737643763f, 0.0898690596f},
-std::array<float,2>{0.398130447f, 0.852752328f},
-std::array<float,2>{0.717555344f, 0.438934892f},
-std::array<float,2>{0.569138825f, 0.963071704f},
-std::array<float,2>{0.316655755f, 0.257107079f},
-std::array<float,2>{0.175585702f, 0.738990188f},
-std::array<float,2>{0.805216908f, 0.154853225f},
-std::array<float,2>{0.852437317f, 0.808084369f},
-std::array<float,2>{0.240704879f, 0.414553165f},
-std::array<float,2>{0.306036294f, 0.601356745f},
-std::array<float,2>{0.542087674f, 0.00147312786f},
-std::array<float,2>{0.626217484f, 0.65639931f},
-std::array<float,2>{0.465640515f, 0.194031477f},
-std::array<float,2>{0.0427690931f, 0.914949834f},
-std::array<float,2>{0.897563815f, 0.339502603f},
-std::array<float,2>{0.886222064f, 0.642279446f},
-std::array<float,2>{0.0546288341f, 0.247916177f},
-std::array<float,2>{0.451353818f, 0.881656528f},
-std::array<float,2>{0.645924509f, 0.366716623f},
-std::array<float,2>{0.549043834f, 0.756411791f},
-std::array<float,2>{0.282963455f, 0.381040305f},
-std::array<float,2>{0.227441415f, 0.579189122f},
-std::array<float,2>{0.862965047f, 0.0619889386f},
-std::array<float,2>{0.794727564f, 0.983898759f},
-std::array<float,2>{0.160166919f, 0.285103887f},
-std::array<float,2>{0.340080708f, 0.709520578f},
-std::array<float,2>{0.584699988f, 0.184148639f},
-std::array<float,2>{0.687902987f, 0.54068166f},
-std::array<float,2>{0.38043195f, 0.113385603f},
-std::array<float,2>{0.0851802304f, 0.837779045f},
-std::array<float,2>{0.981501579f, 0.475346804f},
-std::array<float,2>{0.826171398f, 0.624292314f},
-std::array<float,2>{0.215274677f, 0.0187543649f},
-std::array<float,2>{0.264344484f, 0.784443259f},
-std::array<float,2>{0.511135876f, 0.425879449f},
-std::array<float,2>{0.657379329f, 0.92624402f},
-std::array<float,2>{0.491878331f, 0.325894028f},
-std::array<float,2>{0.00115787948f, 0.679903686f},
-std::array<float,2>{0.923438132f, 0.213180244f},
-std::array<float,2>{0.951856256f, 0.874628007f},
-std::array<float,2>{0.108908989f, 0.457860559f},
-std::array<float,2>{0.432290256f, 0.52900809f},
-std::array<float,2>{0.746271908f, 0.0628452674f},
-std::array<float,2>{0.624842584f, 0.725232482f},
-std::array<float,2>{0.362527341f, 0.128440574f},
-std::array<float,2>{0.132417262f, 0.941387653f},
-std::array<float,2>{0.75456053f, 0.269610137f},
-std::array<float,2>{0.832212508f, 0.731543899f},
-std::array<float,2>{0.196282402f, 0.132890657f},
-std::array<float,2>{0.280198157f, 0.945555091f},
-std::array<float,2>{0.530424535f, 0.279919446f},
-std::array<float,2>{0.685758531f, 0.862275541f},
-std::array<float,2>{0.474784791f, 0.463676542f},
-std::array<float,2>{0.0295908097f, 0.520331264f},
-std::array<float,2>{0.918470442f, 0.0741002485f},
-std::array<float,2>{0.957340658f, 0.936744153f},
-std::array<float,2>{0.110550851f, 0.318434f},
-std::array<float,2>{0.41107437f, 0.679211676f},
-std::array<float,2>{0.724958301f, 0.209552065f},
-std::array<float,2>{0.60320133f, 0.616495609f},
-std::array<float,2>{0.353495538f, 0.0249070544f},
-std::array<float,2>{0.151268795f, 0.792224109f},
-std::array<float,2>{0.780318499f, 0.434423149f},
-std::array<float,2>{0.89099586f, 0.536187053f},
-std::array<float,2>{0.0437145531f, 0.118919462f},
-std::array<float,2>{0.462496221f, 0.830112636f},
-std::array<float,2>{0.630689561f, 0.477579474f},
-std::array<float,2>{0.54673481f, 0.972017944f},
-std::array<float,2>{0.310280949f, 0.28982532f},
-std::array<float,2>{0.234736487f, 0.713660479f},
-std::array<float,2>{0.856983364f, 0.178706363f},
-std::array<float,2>{0.811366022f, 0.761741459f},
-std::array<float,2>{0.176892519f, 0.390566617f},
-std::array<float,2>{0.315726668f, 0.592631459f},
-std::array<float,2>{0.564802229f, 0.0503442921f},
-std::array<float,2>{0.711037636f, 0.652584791f},
-std::array<float,2>{0.393577933f, 0.239743099f},
-std::array<float,2>{0.0758876204f, 0.886138916f},
-std::array<float,2>{0.993998587f, 0.374366403f},
-std::array<float,2>{0.977590501f, 0.664476693f},
-std::array<float,2>{0.0790524408f, 0.199233159f},
-std::array<float,2>{0.378842264f, 0.911085725f},
-std::array<float,2>{0.692509532f, 0.330411494f},
-std::array<float,2>{0.579363108f, 0.798218727f},
-std::array<float,2>{0.336399853f, 0.410717934f},
-std::array<float,2>{0.156400502f, 0.604496479f},
-std::array<float,2>{0.790836692f, 0.0136602232f},
-std::array<float,2>{0.864229977f, 0.955431342f},
-std::array<float,2>{0.234044641f, 0.261256188f},
-std::array<float,2>{0.286335677f, 0.748677433f},
-std::array<float,2>{0.554090977f, 0.140795276f},
-std::array<float,2>{0.640952229f, 0.501220465f},
-std::array<float,2>{0.447038382f, 0.0793486014f},
-std::array<float,2>{0.0488426797f, 0.844598293f},
-std::array<float,2>{0.888733923f, 0.446516722f},
-std::array<float,2>{0.752847791f, 0.569461346f},
-std::array<float,2>{0.125760004f, 0.0381852798f},
-std::array<float,2>{0.36334309f, 0.766722441f},
-std::array<float,2>{0.619337678f, 0.393616378f},
-std::array<float,2>{0.743787885f, 0.902207136f},
-std::array<float,2>{0.435511529f, 0.347570181f},
-std::array<float,2>{0.102890976f, 0.632127285f},
-std::array<float,2>{0.946624219f, 0.230517447f},
-std::array<float,2>{0.927057147f, 0.821584523f},
-std::array<float,2>{0.0062696375f, 0.485744536f},
-std::array<float,2>{0.487453192f, 0.557893097f},
-std::array<float,2>{0.663766503f, 0.109125987f},
-std::array<float,2>{0.515557587f, 0.695281982f},
-std::array<float,2>{0.259891927f, 0.171530038f},
-std::array<float,2>{0.212954938f, 0.986697674f},
-std::array<float,2>{0.821763158f, 0.297097355f},
-std::array<float,2>{0.788818061f, 0.634584367f},
-std::array<float,2>{0.16817297f, 0.223671034f},
-std::array<float,2>{0.328645587f, 0.894001305f},
-std::array<float,2>{0.586844981f, 0.355459273f},
-std::array<float,2>{0.697317123f, 0.775732934f},
-std::array<float,2>{0.388196379f, 0.402123749f},
-std::array<float,2>{0.0905124396f, 0.57436645f},
-std::array<float,2>{0.9720487f, 0.0408865958f},
-std::array<float,2>{0.875251114f, 0.99506706f},
-std::array<float,2>{0.0607325211f, 0.311035663f},
-std::array<float,2>{0.43877691f, 0.695619285f},
-std::array<float,2>{0.649865031f, 0.157784089f},
-std::array<float,2>{0.556610346f, 0.553303182f},
-std::array<float,2>{0.289713293f, 0.096299313f},
-std::array<float,2>{0.223562211f, 0.817972958f},
-std::array<float,2>{0.872377694f, 0.498576254f},
-std::array<float,2>{0.944466591f, 0.595852733f},
-std::array<float,2>{0.0970751718f, 0.00453496585f},
-std::array<float,2>{0.429154605f, 0.809623659f},
-std::array<float,2>{0.738882303f, 0.419278651f},
-std::array<float,2>{0.611670196f, 0.919802427f},
-std::array<float,2>{0.3682459f, 0.341834843f},
-std::array<float,2>{0.137677744f, 0.661776364f},
-std::array<float,2>{0.763792157f, 0.188149214f},
-std::array<float,2>{0.819837451f, 0.857808053f},
-std::array<float,2>{0.206334814f, 0.441938579f},
-std::array<float,2>{0.255238622f, 0.511327922f},
-std::array<float,2>{0.505910158f, 0.0893434733f},
-std::array<float,2>{0.665704668f, 0.737822413f},
-std::array<float,2>{0.493175149f, 0.14862974f},
-std::array<float,2>{0.00999212079f, 0.964962602f},
-std::array<float,2>{0.933378756f, 0.253020436f},
-std::array<float,2>{0.906532943f, 0.70396024f},
-std::array<float,2>{0.0215982031f, 0.181368098f},
-std::array<float,2>{0.477742314f, 0.97903502f},
-std::array<float,2>{0.676872969f, 0.287293404f},
-std::array<float,2>{0.520198643f, 0.842442393f},
-std::array<float,2>{0.265720308f, 0.470957726f},
-std::array<float,2>{0.192339838f, 0.54669553f},
-std::array<float,2>{0.843073666f, 0.109607637f},
-std::array<float,2>{0.766834915f, 0.878171504f},
-std::array<float,2>{0.146233186f, 0.359694481f},
-std::array<float,2>{0.344564438f, 0.644559383f},
-std::array<float,2>{0.599224746f, 0.243960172f},
-std::array<float,2>{0.731250226f, 0.585177124f},
-std::array<float,2>{0.415667444f, 0.0577121675f},
-std::array<float,2>{0.124425419f, 0.750899196f},
-std::array<float,2>{0.96494031f, 0.376772076f},
-std::array<float,2>{0.851089716f, 0.524608195f},
-std::array<float,2>{0.24660103f, 0.0691161156f},
-std::array<float,2>{0.300583035f, 0.870090723f},
-std::array<float,2>{0.531539559f, 0.454038322f},
-std::array<float,2>{0.634822965f, 0.941779792f},
-std::array<float,2>{0.457259208f, 0.265909851f},
-std::array<float,2>{0.037225008f, 0.721183479f},
-std::array<float,2>{0.900728166f, 0.129901648f},
-std::array<float,2>{0.987002909f, 0.788104951f},
-std::array<float,2>{0.0697335452f, 0.424690008f},
-std::array<float,2>{0.401589662f, 0.620820701f},
-std::array<float,2>{0.704843938f, 0.0201939009f},
-std::array<float,2>{0.570917964f, 0.684128225f},
-std::array<float,2>{0.32797423f, 0.218613967f},
-std::array<float,2>{0.18013142f, 0.922469556f},
-std::array<float,2>{0.801582694f, 0.32083407f},
-std::array<float,2>{0.828027666f, 0.680279911f},
-std::array<float,2>{0.218461677f, 0.213554338f},
-std::array<float,2>{0.262210578f, 0.926682174f},
-std::array<float,2>{0.508987844f, 0.325204223f},
-std::array<float,2>{0.658721626f, 0.784837127f},
-std::array<float,2>{0.48906368f, 0.426445693f},
-std::array<float,2>{0.003290297f, 0.624762475f},
-std::array<float,2>{0.925075173f, 0.0191343389f},
-std::array<float,2>{0.950635552f, 0.94050467f},
-std::array<float,2>{0.106255896f, 0.270489991f},
-std::array<float,2>{0.430417418f, 0.724890351f},
-std::array<float,2>{0.74873662f, 0.127933934f},
-std::array<float,2>{0.622738183f, 0.52875644f},
-std::array<float,2>{0.360470086f, 0.0630782247f},
-std::array<float,2>{0.130173668f, 0.87443161f},
-std::array<float,2>{0.757664859f, 0.457112104f},
-std::array<float,2>{0.883813083f, 0.579992414f},
-std::array<float,2>{0.0521831214f, 0.0621146448f},
-std::array<float,2>{0.450846523f, 0.75595057f},
-std::array<float,2>{0.647437274f, 0.381573915f},
-std::array<float,2>{0.546879709f, 0.881259263f},
-std::array<float,2>{0.284328848f, 0.36621964f},
-std::array<float,2>{0.229472429f, 0.642016232f},
-std::array<float,2>{0.860233605f, 0.247523054f},
-std::array<float,2>{0.795390368f, 0.837155938f},
-std::array<float,2>{0.162827238f, 0.47463426f},
-std::array<float,2>{0.343360066f, 0.540340364f},
-std::array<float,2>{0.582980216f, 0.113854662f},
-std::array<float,2>{0.690943956f, 0.709286332f},
-std::array<float,2>{0.381670207f, 0.183984265f},
-std::array<float,2>{0.083919093f, 0.983682752f},
-std::array<float,2>{0.982616484f, 0.28432259f},
-std::array<float,2>{0.996779263f, 0.738555193f},
-std::array<float,2>{0.0715986639f, 0.15450713f},
-std::array<float,2>{0.394611567f, 0.963662565f},
-std::array<float,2>{0.716375709f, 0.257557869f},
-std::array<float,2>{0.566779554f, 0.853138208f},
-std::array<float,2>{0.318846852f, 0.439440519f},
-std::array<float,2>{0.172874913f, 0.513311386f},
-std::array<float,2>{0.807740092f, 0.0903385505f},
-std::array<float,2>{0.855081379f, 0.914163828f},
-std::array<float,2>{0.239596486f, 0.339253306f},
-std::array<float,2>{0.30843696f, 0.657128215f},
-std::array<float,2>{0.539852798f, 0.19353044f},
-std::array<float,2>{0.628606558f, 0.600718796f},
-std::array<float,2>{0.466834754f, 0.00111859618f},
-std::array<float,2>{0.0406050086f, 0.808211744f},
-std::array<float,2>{0.896127939f, 0.414274931f},
-std::array<float,2>{0.776778877f, 0.546901166f},
-std::array<float,2>{0.155670628f, 0.101230115f},
-std::array<float,2>{0.357476473f, 0.813826323f},
-std::array<float,2>{0.606473088f, 0.492354989f},
-std::array<float,2>{0.720800936f, 0.996967793f},
-std::array<float,2>{0.409864038f, 0.307631433f},
-std::array<float,2>{0.113511086f, 0.701218724f},
-std::array<float,2>{0.953162491f, 0.161328629f},
-std::array<float,2>{0.916307867f, 0.7804389f},
-std::array<float,2>{0.0241277199f, 0.405641794f},
-std::array<float,2>{0.469502956f, 0.571343362f},
-std::array<float,2>{0.683003664f, 0.0457458831f},
-std::array<float,2>{0.523982227f, 0.640269637f},
-std::array<float,2>{0.273841262f, 0.219070226f},
-std::array<float,2>{0.202273697f, 0.897430718f},
-std::array<float,2>{0.82978791f, 0.356704146f},
-std::array<float,2>{0.800473094f, 0.691152275f},
-std::array<float,2>{0.186513811f, 0.164857015f},
-std::array<float,2>{0.321193933f, 0.990647793f},
-std::array<float,2>{0.577417135f, 0.301792055f},
-std::array<float,2>{0.710376859f, 0.826856256f},
-std::array<float,2>{0.402457356f, 0.489727378f},
-std::array<float,2>{0.0659847185f, 0.562235773f},
-std::array<float,2>{0.990412772f, 0.104803212f},
-std::array<float,2>{0.904082775f, 0.902534783f},
-std::array<float,2>{0.0326234177f, 0.34996289f},
-std::array<float,2>{0.454412997f, 0.627622306f},
-std::array<float,2>{0.639716148f, 0.228133053f},
-std::array<float,2>{0.537898779f, 0.566393614f},
-std::array<float,2>{0.303228289f, 0.0336710475f},
-std::array<float,2>{0.244556636f, 0.770840943f},
-std::array<float,2>{0.846204758f, 0.396107733f},
-std::array<float,2>{0.96187222f, 0.505579412f},
-std::array<float,2>{0.119820066f, 0.0844059587f},
-std::array<float,2>{0.419179887f, 0.849855721f},
-std::array<float,2>{0.729277253f, 0.44974193f},
-std::array<float,2>{0.594295919f, 0.959827483f},
-std::array<float,2>{0.348086506f, 0.261986494f},
-std::array<float,2>{0.14323619f, 0.744382977f},
-std::array<float,2>{0.772494733f, 0.144762054f},
-std::array<float,2>{0.838834047f, 0.801716983f},
-std::array<float,2>{0.188221321f, 0.409406871f},
-std::array<float,2>{0.272475839f, 0.6075508f},
-std::array<float,2>{0.518703401f, 0.00815592054f},
-std::array<float,2>{0.673306346f, 0.670826614f},
-std::array<float,2>{0.48197329f, 0.196613923f},
-std::array<float,2>{0.0185351409f, 0.907097638f},
-std::array<float,2>{0.912730336f, 0.332852036f},
-std::array<float,2>{0.934669137f, 0.649646163f},
-std::array<float,2>{0.0150061697f, 0.236799717f},
-std::array<float,2>{0.499600291f, 0.887076974f},
-std::array<float,2>{0.670514643f, 0.367757976f},
-std::array<float,2>{0.501716375f, 0.760866463f},
-std::array<float,2>{0.251371771f, 0.385243833f},
-std::array<float,2>{0.210879654f, 0.587535024f},
-std::array<float,2>{0.812782824f, 0.0536237918f},
-std::array<float,2>{0.758765638f, 0.976524889f},
-std::array<float,2>{0.134282082f, 0.293381214f},
-std::array<float,2>{0.371301651f, 0.715084314f},
-std::array<float,2>{0.615633368f, 0.172768801f},
-std::array<float,2>{0.737190127f, 0.531742036f},
-std::array<float,2>{0.425529301f, 0.122361362f},
-std::array<float,2>{0.0986460745f, 0.834768891f},
-std::array<float,2>{0.940330446f, 0.480939806f},
-std::array<float,2>{0.867324769f, 0.61102891f},
-std::array<float,2>{0.220880687f, 0.0307508856f},
-std::array<float,2>{0.29545489f, 0.795048654f},
-std::array<float,2>{0.559993207f, 0.431730837f},
-std::array<float,2>{0.65499109f, 0.931466818f},
-std::array<float,2>{0.443439603f, 0.315736771f},
-std::array<float,2>{0.0552811772f, 0.672345817f},
-std::array<float,2>{0.880980492f, 0.203140929f},
-std::array<float,2>{0.974674046f, 0.865316987f},
-std::array<float,2>{0.0879052728f, 0.46696952f},
-std::array<float,2>{0.384061456f, 0.518230796f},
-std::array<float,2>{0.699475706f, 0.0775917694f},
-std::array<float,2>{0.592606902f, 0.728955865f},
-std::array<float,2>{0.33330366f, 0.136855647f},
-std::array<float,2>{0.166756153f, 0.950517297f},
-std::array<float,2>{0.781644285f, 0.275623411f},
-std::array<float,2>{0.849366665f, 0.721280992f},
-std::array<float,2>{0.249830827f, 0.130485103f},
-std::array<float,2>{0.297265172f, 0.942371011f},
-std::array<float,2>{0.533925712f, 0.266142666f},
-std::array<float,2>{0.633166313f, 0.869440138f},
-std::array<float,2>{0.459938675f, 0.453593612f},
-std::array<float,2>{0.0358823948f, 0.525333822f},
-std::array<float,2>{0.898446798f, 0.0685697123f},
-std::array<float,2>{0.985354602f, 0.922132432f},
-std::array<float,2>{0.066725336f, 0.320400387f},
-std::array<float,2>{0.399589449f, 0.68408066f},
-std::array<float,2>{0.705305219f, 0.217942461f},
-std::array<float,2>{0.573839426f, 0.620449722f},
-std::array<float,2>{0.325063139f, 0.0196323395f},
-std::array<float,2>{0.181952879f, 0.788772464f},
-std::array<float,2>{0.802743495f, 0.424064696f},
-std::array<float,2>{0.909859538f, 0.545944631f},
-std::array<float,2>{0.0200209524f, 0.110107817f},
-std::array<float,2>{0.478670955f, 0.841847122f},
-std::array<float,2>{0.67899859f, 0.471456468f},
-std::array<float,2>{0.521760702f, 0.978925824f},
-std::array<float,2>{0.268623352f, 0.287828624f},
-std::array<float,2>{0.193973288f, 0.70326525f},
-std::array<float,2>{0.840532303f, 0.181083202f},
-std::array<float,2>{0.76873827f, 0.750098765f},
-std::array<float,2>{0.147733063f, 0.376274049f},
-std::array<float,2>{0.346972525f, 0.585625768f},
-std::array<float,2>{0.600208044f, 0.0581287891f},
-std::array<float,2>{0.733330965f, 0.645275056f},
-std::array<float,2>{0.417601585f, 0.243466452f},
-std::array<float,2>{0.121532254f, 0.878796756f},
-std::array<float,2>{0.967669427f, 0.35998705f},
-std::array<float,2>{0.94279182f, 0.661499918f},
-std::array<float,2>{0.0954813585f, 0.187983751f},
-std::array<float,2>{0.427542627f, 0.919274628f},
-std::array<float,2>{0.740869045f, 0.342637867f},
-std::array<float,2>{0.609473884f, 0.810374081f},
-std::array<float,2>{0.370316327f, 0.419835597f},
-std::array<float,2>{0.13924253f, 0.59632057f},
-std::array<float,2>{0.76350677f, 0.0043168948f},
-std::array<float,2>{0.816983104f, 0.965556264f},
-std::array<float,2>{0.203620285f, 0.253865272f},
-std::array<float,2>{0.257453173f, 0.737738192f},
-std::array<float,2>{0.505519271f, 0.149103761f},
-std::array<float,2>{0.667555571f, 0.51086992f},
-std::array<float,2>{0.495099276f, 0.0894304141f},
-std::array<float,2>{0.00951695815f, 0.858307481f},
-std::array<float,2>{0.931184053f, 0.441724032f},
-std::array<float,2>{0.786506295f, 0.575110078f},
-std::array<float,2>{0.171600804f, 0.04028989f},
-std::array<float,2>{0.330699414f, 0.775948524f},
-std::array<float,2>{0.589124143f, 0.401848227f},
-std::array<float,2>{0.695680916f, 0.894300103f},
-std::array<float,2>{0.388978601f, 0.354813069f},
-std::array<float,2>{0.092832692f, 0.634110153f},
-std::array<float,2>{0.968796015f, 0.224527881f},
-std::array<float,2>{0.878344059f, 0.81785959f},
-std::array<float,2>{0.0604111217f, 0.498510867f},
-std::array<float,2>{0.441285402f, 0.553208351f},
-std::array<float,2>{0.652033508f, 0.0959518254f},
-std::array<float,2>{0.557163417f, 0.696092844f},
-std::array<float,2>{0.291615963f, 0.157691836f},
-std::array<float,2>{0.225090876f, 0.994425178f},
-std::array<float,2>{0.873527884f, 0.310798407f},
-std::array<float,2>{0.751017213f, 0.632745624f},
-std::array<float,2>{0.128195584f, 0.231212258f},
-std::array<float,2>{0.366785109f, 0.901847243f},
-std::array<float,2>{0.618051708f, 0.346962273f},
-std::array<float,2>{0.745933533f, 0.767146587f},
-std::array<float,2>{0.436863303f, 0.39451921f},
-std::array<float,2>{0.105079196f, 0.570199609f},
-std::array<float,2>{0.948723257f, 0.0386257693f},
-std::array<float,2>{0.929430246f, 0.987132311f},
-std::array<float,2>{0.00435297051f, 0.297795385f},
-std::array<float,2>{0.48611474f, 0.694766939f},
-std::array<float,2>{0.660393596f, 0.17108047f},
-std::array<float,2>{0.512659788f, 0.558217943f},
-std::array<float,2>{0.259063244f, 0.108658649f},
-std::array<float,2>{0.211348027f, 0.822129667f},
-std::array<float,2>{0.822434664f, 0.486242741f},
-std::array<float,2>{0.979154766f, 0.605184972f},
-std::array<float,2>{0.0814974308f, 0.0130258081f},
-std::array<float,2>{0.376327276f, 0.798359334f},
-std::array<float,2>{0.694147944f, 0.410362095f},
-std::array<float,2>{0.580799758f, 0.910286903f},
-std::array<float,2>{0.33983016f, 0.330867946f},
-std::array<float,2>{0.158348933f, 0.664988339f},
-std::array<float,2>{0.791420043f, 0.199927419f},
-std::array<float,2>{0.866338253f, 0.844016612f},
-std::array<float,2>{0.230818704f, 0.447098166f},
-std::array<float,2>{0.28714934f, 0.501883686f},
-std::array<float,2>{0.552588046f, 0.0798540562f},
-std::array<float,2>{0.643809676f, 0.748417437f},
-std::array<float,2>{0.449022561f, 0.141244248f},
-std::array<float,2>{0.047499001f, 0.956016839f},
-std::array<float,2>{0.886947095f, 0.261162043f},
-std::array<float,2>{0.894354403f, 0.713229358f},
-std::array<float,2>{0.0462443158f, 0.177965939f},
-std::array<float,2>{0.464206815f, 0.972491443f},
-std::array<float,2>{0.631650925f, 0.289102942f},
-std::array<float,2>{0.544039786f, 0.830835223f},
-std::array<float,2>{0.312058806f, 0.478387147f},
-std::array<float,2>{0.237244383f, 0.537068009f},
-std::array<float,2>{0.858708084f, 0.118306413f},
-std::array<float,2>{0.810276866f, 0.88628304f},
-std::array<float,2>{0.179486409f, 0.374732018f},
-std::array<float,2>{0.313209444f, 0.653191864f},
-std::array<float,2>{0.563970327f, 0.239826068f},
-std::array<float,2>{0.714712799f, 0.591814041f},
-std::array<float,2>{0.392221361f, 0.0499782339f},
-std::array<float,2>{0.0772901848f, 0.7623474f},
-std::array<float,2>{0.9943645f, 0.38973859f},
-std::array<float,2>{0.835226417f, 0.519872487f},
-std::array<float,2>{0.197804496f, 0.0737287551f},
-std::array<float,2>{0.278147548f, 0.861550212f},
-std::array<float,2>{0.527866244f, 0.463360339f},
-std::array<float,2>{0.683670759f, 0.946050704f},
-std::array<float,2>{0.474099725f, 0.279769719f},
-std::array<float,2>{0.0283332523f, 0.731989682f},
-std::array<float,2>{0.921720862f, 0.133562386f},
-std::array<float,2>{0.959750116f, 0.792648971f},
-std::array<float,2>{0.111935802f, 0.4338741f},
-std::array<float,2>{0.412323415f, 0.617115915f},
-std::array<float,2>{0.724553108f, 0.0247903317f},
-std::array<float,2>{0.605076313f, 0.678942204f},
-std::array<float,2>{0.354424924f, 0.209142625f},
-std::array<float,2>{0.148854077f, 0.937214196f},
-std::array<float,2>{0.778291643f, 0.318988115f},
-std::array<float,2>{0.862611413f, 0.644202709f},
-std::array<float,2>{0.226708874f, 0.248563737f},
-std::array<float,2>{0.282354385f, 0.878919005f},
-std::array<float,2>{0.5493626f, 0.363698334f},
-std::array<float,2>{0.64648068f, 0.754184246f},
-std::array<float,2>{0.451950222f, 0.379658163f},
-std::array<float,2>{0.0538027249f, 0.580935836f},
-std::array<float,2>{0.886387289f, 0.0598674864f},
-std::array<float,2>{0.982042909f, 0.981982648f},
-std::array<float,2>{0.0854881853f, 0.282776654f},
-std::array<float,2>{0.380365103f, 0.70792979f},
-std::array<float,2>{0.688259304f, 0.187311232f},
-std::array<float,2>{0.584138334f, 0.54147023f},
-std::array<float,2>{0.340490907f, 0.116205312f},
-std::array<float,2>{0.160697803f, 0.838397443f},
-std::array<float,2>{0.794365883f, 0.473497629f},
-std::array<float,2>{0.922892392f, 0.622630417f},
-std::array<float,2>{0.00148997491f, 0.0174317341f},
-std::array<float,2>{0.491551816f, 0.781668425f},
-std::array<float,2>{0.658167601f, 0.427982897f},
-std::array<float,2>{0.511321843f, 0.928888261f},
-std::array<float,2>{0.263834357f, 0.326242417f},
-std::array<float,2>{0.215640768f, 0.682630837f},
-std::array<float,2>{0.825279117f, 0.211544201f},
-std::array<float,2>{0.754343271f, 0.871951163f},
-std::array<float,2>{0.132121503f, 0.460124552f},
-std::array<float,2>{0.36300993f, 0.529384553f},
-std::array<float,2>{0.624257684f, 0.0652082339f},
-std::array<float,2>{0.747065246f, 0.723208606f},
-std::array<float,2>{0.431840658f, 0.126239225f},
-std::array<float,2>{0.108863518f, 0.937649071f},
-std::array<float,2>{0.951190293f, 0.271938056f},
-std::array<float,2>{0.956903934f, 0.701073289f},
-std::array<float,2>{0.116036966f, 0.162934303f},
-std::array<float,2>{0.408031672f, 0.998968124f},
-std::array<float,2>{0.720521688f, 0.305949926f},
-std::array<float,2>{0.607649505f, 0.815443516f},
-std::array<float,2>{0.357150376f, 0.495602369f},
-std::array<float,2>{0.153143972f, 0.549975514f},
-std::array<float,2>{0.774735868f, 0.0985183045f},
-std::array<float,2>{0.830551803f, 0.895143449f},
-std::array<float,2>{0.200218171f, 0.358097285f},
-std::array<float,2>{0.275886744f, 0.638382316f},
-std::array<float,2>{0.525564611f, 0.221559927f},
-std::array<float,2>{0.680244625f, 0.574032664f},
-std::array<float,2>{0.471081018f, 0.0441777594f},
-std::array<float,2>{0.0272723194f, 0.777392566f},
-std::array<float,2>{0.915108025f, 0.402697891f},
-std::array<float,2>{0.804748535f, 0.513869941f},
-std::array<float,2>{0.174812913f, 0.0933229029f},
-std::array<float,2>{0.316939294f, 0.854185641f},
-std::array<float,2>{0.568359792f, 0.440240413f},
-std::array<float,2>{0.717041016f, 0.961815596f},
-std::array<float,2>{0.397803515f, 0.254175454f},
-std::array<float,2>{0.0733130425f, 0.741166353f},
-std::array<float,2>{0.998807728f, 0.152608141f},
-std::array<float,2>{0.898416996f, 0.804823518f},
-std::array<float,2>{0.0423088074f, 0.416752189f},
-std::array<float,2>{0.464850217f, 0.597728372f},
-std::array<float,2>{0.626519799f, 0.00370982802f},
-std::array<float,2>{0.542671382f, 0.659751594f},
-std::array<float,2>{0.306235254f, 0.192361206f},
-std::array<float,2>{0.241187036f, 0.917075396f},
-std::array<float,2>{0.851970196f, 0.337588906f},
-std::array<float,2>{0.769534349f, 0.743227184f},
-std::array<float,2>{0.141129985f, 0.147848338f},
-std::array<float,2>{0.350221306f, 0.958456755f},
-std::array<float,2>{0.595811188f, 0.264642239f},
-std::array<float,2>{0.726646543f, 0.847707808f},
-std::array<float,2>{0.420280814f, 0.451326549f},
-std::array<float,2>{0.118844695f, 0.50613451f},
-std::array<float,2>{0.963182926f, 0.0826096758f},
-std::array<float,2>{0.911727607f, 0.910046399f},
-std::array<float,2>{0.0161354858f, 0.335211813f},
-std::array<float,2>{0.482835889f, 0.667991221f},
-std::array<float,2>{0.674249709f, 0.198708445f},
-std::array<float,2>{0.516617537f, 0.606448174f},
-std::array<float,2>{0.269593f, 0.011028978f},
-std::array<float,2>{0.189467281f, 0.803069234f},
-std::array<float,2>{0.837513983f, 0.406440467f},
-std::array<float,2>{0.988301694f, 0.559166312f},
-std::array<float,2>{0.0628252998f, 0.102872476f},
-std::array<float,2>{0.405977726f, 0.824583232f},
-std::array<float,2>{0.708617389f, 0.491081685f},
-std::array<float,2>{0.575961471f, 0.989587963f},
-std::array<float,2>{0.323637158f, 0.304640502f},
-std::array<float,2>{0.184170946f, 0.688778281f},
-std::array<float,2>{0.79792434f, 0.166704968f},
-std::array<float,2>{0.844907045f, 0.77229017f},
-std::array<float,2>{0.242733866f, 0.398380727f},
-std::array<float,2>{0.301618874f, 0.562671185f},
-std::array<float,2>{0.536494911f, 0.0321691334f},
-std::array<float,2>{0.637386084f, 0.626196146f},
-std::array<float,2>{0.455906957f, 0.230323702f},
-std::array<float,2>{0.03320463f, 0.905435026f},
-std::array<float,2>{0.905379415f, 0.347766459f},
-std::array<float,2>{0.879018366f, 0.674375117f},
-std::array<float,2>{0.0572483018f, 0.206992984f},
-std::array<float,2>{0.441793084f, 0.932086706f},
-std::array<float,2>{0.653107226f, 0.313878298f},
-std::array<float,2>{0.561045468f, 0.793848276f},
-std::array<float,2>{0.293843478f, 0.429721832f},
-std::array<float,2>{0.220271558f, 0.613187551f},
-std::array<float,2>{0.869158745f, 0.0282865372f},
-std::array<float,2>{0.783961833f, 0.952672482f},
-std::array<float,2>{0.165834576f, 0.275151581f},
-std::array<float,2>{0.334414303f, 0.726652443f},
-std::array<float,2>{0.591324747f, 0.139961317f},
-std::array<float,2>{0.701665998f, 0.516065717f},
-std::array<float,2>{0.386024803f, 0.0758070871f},
-std::array<float,2>{0.087393783f, 0.864204884f},
-std::array<float,2>{0.972709119f, 0.466352224f},
-std::array<float,2>{0.815486789f, 0.588332534f},
-std::array<float,2>{0.208039731f, 0.0511802956f},
-std::array<float,2>{0.252190471f, 0.759677887f},
-std::array<float,2>{0.50353688f, 0.382927418f},
-std::array<float,2>{0.668306589f, 0.890442252f},
-std::array<float,2>{0.497640252f, 0.369918138f},
-std::array<float,2>{0.0126965148f, 0.651169002f},
-std::array<float,2>{0.935711145f, 0.234989405f},
-std::array<float,2>{0.938352466f, 0.832174182f},
-std::array<float,2>{0.100373656f, 0.483707577f},
-std::array<float,2>{0.423362195f, 0.53409034f},
-std::array<float,2>{0.735260487f, 0.123227224f},
-std::array<float,2>{0.614859343f, 0.718316078f},
-std::array<float,2>{0.37492761f, 0.175637588f},
-std::array<float,2>{0.134780571f, 0.973210514f},
-std::array<float,2>{0.76043874f, 0.296387762f},
-std::array<float,2>{0.84333241f, 0.70661962f},
-std::array<float,2>{0.191859096f, 0.183333367f},
-std::array<float,2>{0.266187698f, 0.977449656f},
-std::array<float,2>{0.519650698f, 0.286854357f},
-std::array<float,2>{0.67758745f, 0.840059996f},
-std::array<float,2>{0.478215903f, 0.469415784f},
-std::array<float,2>{0.0221354216f, 0.542987943f},
-std::array<float,2>{0.906846881f, 0.112932511f},
-std::array<float,2>{0.965587914f, 0.875081718f},
-std::array<float,2>{0.12466903f, 0.362057269f},
-std::array<float,2>{0.4153409f, 0.648430228f},
-std::array<float,2>{0.730929554f, 0.244714096f},
-std::array<float,2>{0.598917246f, 0.582793117f},
-std::array<float,2>{0.344082892f, 0.055538673f},
-std::array<float,2>{0.145950526f, 0.752502978f},
-std::array<float,2>{0.767397761f, 0.377505034f},
-std::array<float,2>{0.900889456f, 0.525715053f},
-std::array<float,2>{0.0378350206f, 0.0667341352f},
-std::array<float,2>{0.457925558f, 0.867625296f},
-std::array<float,2>{0.635683f, 0.456333518f},
-std::array<float,2>{0.531870306f, 0.944461763f},
-std::array<float,2>{0.300244212f, 0.268970311f},
-std::array<float,2>{0.246298552f, 0.719646037f},
-std::array<float,2>{0.850864589f, 0.131246045f},
-std::array<float,2>{0.801242769f, 0.786497116f},
-std::array<float,2>{0.180615321f, 0.42358166f},
-std::array<float,2>{0.327291489f, 0.617679358f},
-std::array<float,2>{0.570773423f, 0.0231052823f},
-std::array<float,2>{0.704517424f, 0.686291277f},
-std::array<float,2>{0.402081341f, 0.215324089f},
-std::array<float,2>{0.0703049451f, 0.924281538f},
-std::array<float,2>{0.986800969f, 0.323463529f},
-std::array<float,2>{0.972440302f, 0.634988308f},
-std::array<float,2>{0.0899365321f, 0.226440728f},
-std::array<float,2>{0.387813687f, 0.891470909f},
-std::array<float,2>{0.698202372f, 0.352564752f},
-std::array<float,2>{0.586181402f, 0.775066912f},
-std::array<float,2>{0.32833761f, 0.399977505f},
-std::array<float,2>{0.168837383f, 0.576224506f},
-std::array<float,2>{0.788410246f, 0.042681098f},
-std::array<float,2>{0.873024166f, 0.994024515f},
-std::array<float,2>{0.223119766f, 0.309426993f},
-std::array<float,2>{0.289529353f, 0.698742449f},
-std::array<float,2>{0.555812955f, 0.159132093f},
-std::array<float,2>{0.650292754f, 0.552456081f},
-std::array<float,2>{0.439051062f, 0.0945268795f},
-std::array<float,2>{0.0613587014f, 0.819337487f},
-std::array<float,2>{0.875615895f, 0.496408224f},
-std::array<float,2>{0.764616489f, 0.595521152f},
-std::array<float,2>{0.136991948f, 0.00652777823f},
-std::array<float,2>{0.369006604f, 0.812263131f},
-std::array<float,2>{0.612199068f, 0.420660734f},
-std::array<float,2>{0.738283932f, 0.921781838f},
-std::array<float,2>{0.429613292f, 0.340459883f},
-std::array<float,2>{0.0974060595f, 0.66343379f},
-std::array<float,2>{0.945304573f, 0.190085813f},
-std::array<float,2>{0.932830095f, 0.856173337f},
-std::array<float,2>{0.0105160885f, 0.444850802f},
-std::array<float,2>{0.493771821f, 0.509103656f},
-std::array<float,2>{0.665349185f, 0.0868085399f},
-std::array<float,2>{0.506416917f, 0.736316323f},
-std::array<float,2>{0.255777687f, 0.151020154f},
-std::array<float,2>{0.206624478f, 0.967863679f},
-std::array<float,2>{0.819501877f, 0.251183957f},
-std::array<float,2>{0.79024905f, 0.666040003f},
-std::array<float,2>{0.156970099f, 0.201620802f},
-std::array<float,2>{0.336753786f, 0.912945628f},
-std::array<float,2>{0.579747677f, 0.328932941f},
-std::array<float,2>{0.693229258f, 0.799947023f},
-std::array<float,2>{0.378016621f, 0.413349748f},
-std::array<float,2>{0.0784235895f, 0.60224992f},
-std::array<float,2>{0.9781937f, 0.0149660585f},
-std::array<float,2>{0.889500737f, 0.954871118f},
-std::array<float,2>{0.0494063683f, 0.258410454f},
-std::array<float,2>{0.446586132f, 0.746811986f},
-std::array<float,2>{0.641371548f, 0.143802419f},
-std::array<float,2>{0.554644287f, 0.503766835f},
-std::array<float,2>{0.286885321f, 0.0816103071f},
-std::array<float,2>{0.2337396f, 0.846220791f},
-std::array<float,2>{0.863322854f, 0.449186921f},
-std::array<float,2>{0.947129011f, 0.567880809f},
-std::array<float,2>{0.103271142f, 0.0362401195f},
-std::array<float,2>{0.434889495f, 0.769371212f},
-std::array<float,2>{0.743189573f, 0.39224723f},
-std::array<float,2>{0.620086193f, 0.899379969f},
-std::array<float,2>{0.364199728f, 0.344501555f},
-std::array<float,2>{0.125456795f, 0.629913568f},
-std::array<float,2>{0.752259374f, 0.234160304f},
-std::array<float,2>{0.822158158f, 0.82316047f},
-std::array<float,2>{0.213462546f, 0.487413973f},
-std::array<float,2>{0.260286063f, 0.556355774f},
-std::array<float,2>{0.514806569f, 0.105965145f},
-std::array<float,2>{0.663379729f, 0.692749441f},
-std::array<float,2>{0.488039464f, 0.168918058f},
-std::array<float,2>{0.00650877832f, 0.984642684f},
-std::array<float,2>{0.927408755f, 0.299005359f},
-std::array<float,2>{0.918435037f, 0.733408928f},
-std::array<float,2>{0.0301080253f, 0.135062069f},
-std::array<float,2>{0.475354105f, 0.948314369f},
-std::array<float,2>{0.686174095f, 0.278805792f},
-std::array<float,2>{0.531145751f, 0.86055398f},
-std::array<float,2>{0.279687226f, 0.462666035f},
-std::array<float,2>{0.195685089f, 0.522565842f},
-std::array<float,2>{0.832848191f, 0.0706622973f},
-std::array<float,2>{0.780922353f, 0.934890747f},
-std::array<float,2>{0.15041849f, 0.31662339f},
-std::array<float,2>{0.352567792f, 0.677649975f},
-std::array<float,2>{0.602948725f, 0.208935946f},
-std::array<float,2>{0.725495994f, 0.613992035f},
-std::array<float,2>{0.410582572f, 0.0259264484f},
-std::array<float,2>{0.111326292f, 0.789976478f},
-std::array<float,2>{0.957777262f, 0.437087327f},
-std::array<float,2>{0.85691458f, 0.53853792f},
-std::array<float,2>{0.235025808f, 0.120771363f},
-std::array<float,2>{0.309625834f, 0.829990864f},
-std::array<float,2>{0.546322703f, 0.478836f},
-std::array<float,2>{0.6302917f, 0.969770193f},
-std::array<float,2>{0.462207556f, 0.291245282f},
-std::array<float,2>{0.0432677306f, 0.712388039f},
-std::array<float,2>{0.891213655f, 0.177086025f},
-std::array<float,2>{0.99339962f, 0.7654863f},
-std::array<float,2>{0.0754558071f, 0.386747688f},
-std::array<float,2>{0.394112796f, 0.590525568f},
-std::array<float,2>{0.711638868f, 0.0481823608f},
-std::array<float,2>{0.565401196f, 0.655879319f},
-std::array<float,2>{0.316225618f, 0.24210465f},
-std::array<float,2>{0.177493721f, 0.884366035f},
-std::array<float,2>{0.810919762f, 0.37143448f},
-std::array<float,2>{0.828350425f, 0.636866391f},
-std::array<float,2>{0.201642036f, 0.22207813f},
-std::array<float,2>{0.275189489f, 0.895973027f},
-std::array<float,2>{0.524516344f, 0.358680665f},
-std::array<float,2>{0.681830108f, 0.77908057f},
-std::array<float,2>{0.469775289f, 0.403714329f},
-std::array<float,2>{0.0249288529f, 0.572773695f},
-std::array<float,2>{0.917536736f, 0.0430730544f},
-std::array<float,2>{0.954862714f, 0.9999156f},
-std::array<float,2>{0.114610404f, 0.304993063f},
-std::array<float,2>{0.408978254f, 0.699399769f},
-std::array<float,2>{0.722624362f, 0.163242623f},
-std::array<float,2>{0.60575372f, 0.549588263f},
-std::array<float,2>{0.358578652f, 0.0986763611f},
-std::array<float,2>{0.154781148f, 0.814972281f},
-std::array<float,2>{0.776143432f, 0.494980633f},
-std::array<float,2>{0.894978762f, 0.599095762f},
-std::array<float,2>{0.0391400829f, 0.0028442808f},
-std::array<float,2>{0.468604624f, 0.805938005f},
-std::array<float,2>{0.627608955f, 0.417352974f},
-std::array<float,2>{0.541003287f, 0.916119695f},
-std::array<float,2>{0.307536364f, 0.336040884f},
-std::array<float,2>{0.23844488f, 0.659166396f},
-std::array<float,2>{0.854022145f, 0.193178356f},
-std::array<float,2>{0.807527125f, 0.854596257f},
-std::array<float,2>{0.172049239f, 0.441015333f},
-std::array<float,2>{0.319503009f, 0.515442848f},
-std::array<float,2>{0.568235099f, 0.0927218422f},
-std::array<float,2>{0.715188742f, 0.741431892f},
-std::array<float,2>{0.395859152f, 0.154271811f},
-std::array<float,2>{0.0711067244f, 0.962354183f},
-std::array<float,2>{0.997281015f, 0.25492382f},
-std::array<float,2>{0.984108686f, 0.70867461f},
-std::array<float,2>{0.0820358843f, 0.186112478f},
-std::array<float,2>{0.382684052f, 0.980827928f},
-std::array<float,2>{0.690161943f, 0.281950206f},
-std::array<float,2>{0.583497882f, 0.839210689f},
-std::array<float,2>{0.342235863f, 0.474353671f},
-std::array<float,2>{0.163145676f, 0.54269433f},
-std::array<float,2>{0.796222568f, 0.11643485f},
-std::array<float,2>{0.861087501f, 0.88082087f},
-std::array<float,2>{0.229764074f, 0.364490211f},
-std::array<float,2>{0.28322652f, 0.643050909f},
-std::array<float,2>{0.548102796f, 0.249566704f},
-std::array<float,2>{0.647592068f, 0.581996739f},
-std::array<float,2>{0.449950367f, 0.0594588742f},
-std::array<float,2>{0.0510651059f, 0.755359828f},
-std::array<float,2>{0.882943392f, 0.380182296f},
-std::array<float,2>{0.756527841f, 0.530913234f},
-std::array<float,2>{0.128995746f, 0.0656533241f},
-std::array<float,2>{0.359446198f, 0.872788966f},
-std::array<float,2>{0.621289492f, 0.459668636f},
-std::array<float,2>{0.749107122f, 0.939171135f},
-std::array<float,2>{0.431149751f, 0.272561908f},
-std::array<float,2>{0.106888928f, 0.724039376f},
-std::array<float,2>{0.949962378f, 0.125582233f},
-std::array<float,2>{0.924614847f, 0.782528698f},
-std::array<float,2>{0.00231443485f, 0.429444194f},
-std::array<float,2>{0.489332199f, 0.622006357f},
-std::array<float,2>{0.660147905f, 0.0156696718f},
-std::array<float,2>{0.508730531f, 0.681872368f},
-std::array<float,2>{0.262781799f, 0.212743878f},
-std::array<float,2>{0.217419773f, 0.928015113f},
-std::array<float,2>{0.826278448f, 0.327710688f},
-std::array<float,2>{0.782318056f, 0.727919161f},
-std::array<float,2>{0.167848721f, 0.139358863f},
-std::array<float,2>{0.332168192f, 0.952063084f},
-std::array<float,2>{0.593213201f, 0.274092942f},
-std::array<float,2>{0.700630963f, 0.865038276f},
-std::array<float,2>{0.383686215f, 0.465498924f},
-std::array<float,2>{0.0889554471f, 0.517558634f},
-std::array<float,2>{0.976443291f, 0.0749147534f},
-std::array<float,2>{0.882497609f, 0.933232069f},
-std::array<float,2>{0.0561858527f, 0.312512904f},
-std::array<float,2>{0.444918066f, 0.674828947f},
-std::array<float,2>{0.655855417f, 0.20585613f},
-std::array<float,2>{0.55946517f, 0.612072229f},
-std::array<float,2>{0.296701849f, 0.029097395f},
-std::array<float,2>{0.222206786f, 0.793985903f},
-std::array<float,2>{0.868254185f, 0.430950314f},
-std::array<float,2>{0.940765083f, 0.534516513f},
-std::array<float,2>{0.0977160931f, 0.124693207f},
-std::array<float,2>{0.424529105f, 0.833011627f},
-std::array<float,2>{0.737917304f, 0.482604563f},
-std::array<float,2>{0.616929412f, 0.973643661f},
-std::array<float,2>{0.372904181f, 0.295544535f},
-std::array<float,2>{0.133145317f, 0.717402279f},
-std::array<float,2>{0.759638071f, 0.174782068f},
-std::array<float,2>{0.813922882f, 0.757944882f},
-std::array<float,2>{0.20962128f, 0.383973867f},
-std::array<float,2>{0.250332832f, 0.589114428f},
-std::array<float,2>{0.500022948f, 0.0523570552f},
-std::array<float,2>{0.671571732f, 0.652101576f},
-std::array<float,2>{0.498294085f, 0.236076519f},
-std::array<float,2>{0.0137210926f, 0.889021218f},
-std::array<float,2>{0.933780432f, 0.370320708f},
-std::array<float,2>{0.913635254f, 0.669731021f},
-std::array<float,2>{0.0192459524f, 0.197636828f},
-std::array<float,2>{0.480535805f, 0.908829212f},
-std::array<float,2>{0.672490478f, 0.334744692f},
-std::array<float,2>{0.518196285f, 0.80439055f},
-std::array<float,2>{0.271495283f, 0.408132076f},
-std::array<float,2>{0.189350113f, 0.606108785f},
-std::array<float,2>{0.839180648f, 0.0100698285f},
-std::array<float,2>{0.771795034f, 0.957239091f},
-std::array<float,2>{0.144156307f, 0.26477778f},
-std::array<float,2>{0.349161416f, 0.743069708f},
-std::array<float,2>{0.595137298f, 0.147161722f},
-std::array<float,2>{0.730007648f, 0.507329166f},
-std::array<float,2>{0.418278277f, 0.0831206515f},
-std::array<float,2>{0.120548144f, 0.849274933f},
-std::array<float,2>{0.962301731f, 0.452444434f},
-std::array<float,2>{0.847095132f, 0.56429708f},
-std::array<float,2>{0.245829806f, 0.0323764384f},
-std::array<float,2>{0.303801566f, 0.772541821f},
-std::array<float,2>{0.538152874f, 0.397383243f},
-std::array<float,2>{0.638913155f, 0.904541075f},
-std::array<float,2>{0.453903317f, 0.348758847f},
-std::array<float,2>{0.0319364779f, 0.625833154f},
-std::array<float,2>{0.903008282f, 0.228832737f},
-std::array<float,2>{0.991271555f, 0.825921834f},
-std::array<float,2>{0.0649777427f, 0.49170661f},
-std::array<float,2>{0.403455615f, 0.56020093f},
-std::array<float,2>{0.709792256f, 0.102408558f},
-std::array<float,2>{0.576862991f, 0.688274384f},
-std::array<float,2>{0.321657389f, 0.167055383f},
-std::array<float,2>{0.187340751f, 0.98829478f},
-std::array<float,2>{0.799650848f, 0.303372979f},
-std::array<float,2>{0.874618709f, 0.697984278f},
-std::array<float,2>{0.225817874f, 0.159585863f},
-std::array<float,2>{0.292072177f, 0.993078768f},
-std::array<float,2>{0.55766046f, 0.310183704f},
-std::array<float,2>{0.650957227f, 0.819296658f},
-std::array<float,2>{0.439725995f, 0.498030722f},
-std::array<float,2>{0.0586324297f, 0.551642954f},
-std::array<float,2>{0.877261162f, 0.0951613188f},
-std::array<float,2>{0.969789982f, 0.892090201f},
-std::array<float,2>{0.0924650505f, 0.35246256f},
-std::array<float,2>{0.390431821f, 0.636463821f},
-std::array<float,2>{0.696325719f, 0.225187868f},
-std::array<float,2>{0.588095546f, 0.577353597f},
-std::array<float,2>{0.331437975f, 0.0412568785f},
-std::array<float,2>{0.170312852f, 0.773473859f},
-std::array<float,2>{0.785177946f, 0.399227917f},
-std::array<float,2>{0.930318236f, 0.507921994f},
-std::array<float,2>{0.00795101188f, 0.0874106511f},
-std::array<float,2>{0.495519072f, 0.856940389f},
-std::array<float,2>{0.666069925f, 0.443580359f},
-std::array<float,2>{0.50484848f, 0.967596531f},
-std::array<float,2>{0.256569356f, 0.250819951f},
-std::array<float,2>{0.204440579f, 0.734631002f},
-std::array<float,2>{0.817573249f, 0.152155533f},
-std::array<float,2>{0.762379467f, 0.810771585f},
-std::array<float,2>{0.140256464f, 0.421191186f},
-std::array<float,2>{0.370098025f, 0.594614804f},
-std::array<float,2>{0.610962331f, 0.00692614261f},
-std::array<float,2>{0.741661966f, 0.663038671f},
-std::array<float,2>{0.426481664f, 0.190450132f},
-std::array<float,2>{0.0944164023f, 0.920483053f},
-std::array<float,2>{0.941848755f, 0.341261744f},
-std::array<float,2>{0.968623698f, 0.647007644f},
-std::array<float,2>{0.122839019f, 0.245897174f},
-std::array<float,2>{0.416162819f, 0.876263738f},
-std::array<float,2>{0.734051764f, 0.362548351f},
-std::array<float,2>{0.601127684f, 0.753306389f},
-std::array<float,2>{0.34607473f, 0.377940655f},
-std::array<float,2>{0.147073656f, 0.583879292f},
-std::array<float,2>{0.768543541f, 0.0560017712f},
-std::array<float,2>{0.841036975f, 0.978501856f},
-std::array<float,2>{0.194685027f, 0.285953313f},
-std::array<float,2>{0.268084794f, 0.70581758f},
-std::array<float,2>{0.523242474f, 0.182545602f},
-std::array<float,2>{0.677983761f, 0.544468164f},
-std::array<float,2>{0.4797934f, 0.111911722f},
-std::array<float,2>{0.0211040489f, 0.841203809f},
-std::array<float,2>{0.908484161f, 0.470012665f},
-std::array<float,2>{0.804580331f, 0.618248701f},
-std::array<float,2>{0.183050498f, 0.0222947951f},
-std::array<float,2>{0.325721741f, 0.785166204f},
-std::array<float,2>{0.572686732f, 0.42224592f},
-std::array<float,2>{0.70661962f, 0.925460279f},
-std::array<float,2>{0.398501575f, 0.322932154f},
-std::array<float,2>{0.0681496486f, 0.686838865f},
-std::array<float,2>{0.985225439f, 0.216550663f},
-std::array<float,2>{0.900120735f, 0.868708909f},
-std::array<float,2>{0.0364726819f, 0.455233902f},
-std::array<float,2>{0.46091944f, 0.526862979f},
-std::array<float,2>{0.634009421f, 0.0673969686f},
-std::array<float,2>{0.534407318f, 0.720475018f},
-std::array<float,2>{0.298256129f, 0.132267714f},
-std::array<float,2>{0.248949856f, 0.944073677f},
-std::array<float,2>{0.847816586f, 0.268407255f},
-std::array<float,2>{0.778431118f, 0.676314175f},
-std::array<float,2>{0.150064349f, 0.207571179f},
-std::array<float,2>{0.354502112f, 0.933594763f},
-std::array<float,2>{0.603632629f, 0.318164617f},
-std::array<float,2>{0.723317206f, 0.790165007f},
-std::array<float,2>{0.413850874f, 0.436351389f},
-std::array<float,2>{0.112578943f, 0.615116775f},
-std::array<float,2>{0.960563719f, 0.0268433169f},
-std::array<float,2>{0.920498908f, 0.948004842f},
-std::array<float,2>{0.0273619797f, 0.277869612f},
-std::array<float,2>{0.473015428f, 0.732933402f},
-std::array<float,2>{0.684669852f, 0.136209592f},
-std::array<float,2>{0.529169202f, 0.522159934f},
-std::array<float,2>{0.278884441f, 0.0718046278f},
-std::array<float,2>{0.198531672f, 0.859881759f},
-std::array<float,2>{0.834778488f, 0.461146981f},
-std::array<float,2>{0.995493352f, 0.591363966f},
-std::array<float,2>{0.076694645f, 0.0473855101f},
-std::array<float,2>{0.39141199f, 0.764418542f},
-std::array<float,2>{0.713220835f, 0.387755454f},
-std::array<float,2>{0.563150704f, 0.883529782f},
-std::array<float,2>{0.314453095f, 0.372956127f},
-std::array<float,2>{0.17805554f, 0.65442735f},
-std::array<float,2>{0.809073925f, 0.24087289f},
-std::array<float,2>{0.857709646f, 0.82854712f},
-std::array<float,2>{0.2380009f, 0.480128139f},
-std::array<float,2>{0.311495751f, 0.537240446f},
-std::array<float,2>{0.543658197f, 0.119728476f},
-std::array<float,2>{0.632806778f, 0.71166414f},
-std::array<float,2>{0.462946981f, 0.176550955f},
-std::array<float,2>{0.0457989909f, 0.969068289f},
-std::array<float,2>{0.893141627f, 0.292961001f},
-std::array<float,2>{0.888433099f, 0.747811377f},
-std::array<float,2>{0.0484364256f, 0.142703474f},
-std::array<float,2>{0.447742641f, 0.953513384f},
-std::array<float,2>{0.643317461f, 0.258829921f},
-std::array<float,2>{0.551288843f, 0.84735024f},
-std::array<float,2>{0.288873434f, 0.447533965f},
-std::array<float,2>{0.232184038f, 0.502479732f},
-std::array<float,2>{0.865674138f, 0.080943048f},
-std::array<float,2>{0.792861938f, 0.913417339f},
-std::array<float,2>{0.159524292f, 0.329624951f},
-std::array<float,2>{0.338701725f, 0.667515934f},
-std::array<float,2>{0.581351519f, 0.202647194f},
-std::array<float,2>{0.694799721f, 0.602582335f},
-std::array<float,2>{0.375781596f, 0.0136779528f},
-std::array<float,2>{0.0802657455f, 0.79905659f},
-std::array<float,2>{0.979571462f, 0.412967473f},
-std::array<float,2>{0.823550105f, 0.55470109f},
-std::array<float,2>{0.212720707f, 0.106516652f},
-std::array<float,2>{0.258109659f, 0.823479414f},
-std::array<float,2>{0.513397872f, 0.486407727f},
-std::array<float,2>{0.661468744f, 0.985771775f},
-std::array<float,2>{0.48504737f, 0.300165385f},
-std::array<float,2>{0.00505405152f, 0.691940844f},
-std::array<float,2>{0.928132474f, 0.169638485f},
-std::array<float,2>{0.948033452f, 0.767757416f},
-std::array<float,2>{0.104301736f, 0.39149648f},
-std::array<float,2>{0.435729057f, 0.567218661f},
-std::array<float,2>{0.744534552f, 0.0360512882f},
-std::array<float,2>{0.618748128f, 0.629006147f},
-std::array<float,2>{0.365903914f, 0.233368799f},
-std::array<float,2>{0.127879232f, 0.899807453f},
-std::array<float,2>{0.75058037f, 0.345698357f},
-std::array<float,2>{0.852904379f, 0.657707632f},
-std::array<float,2>{0.241524532f, 0.194706902f},
-std::array<float,2>{0.305018932f, 0.915693045f},
-std::array<float,2>{0.541077137f, 0.338374227f},
-std::array<float,2>{0.625687897f, 0.807035208f},
-std::array<float,2>{0.466074884f, 0.415705353f},
-std::array<float,2>{0.0412721373f, 0.600139499f},
-std::array<float,2>{0.897238076f, 3.786054e-05f},
-std::array<float,2>{0.999115884f, 0.964093745f},
-std::array<float,2>{0.0725180954f, 0.25608629f},
-std::array<float,2>{0.396659583f, 0.739532113f},
-std::array<float,2>{0.718514502f, 0.155703321f},
-std::array<float,2>{0.569491625f, 0.512623966f},
-std::array<float,2>{0.318217456f, 0.0908311084f},
-std::array<float,2>{0.174621448f, 0.852075875f},
-std::array<float,2>{0.80652386f, 0.438367873f},
-std::array<float,2>{0.91501838f, 0.570473194f},
-std::array<float,2>{0.0260344781f, 0.0465437844f},
-std::array<float,2>{0.472099304f, 0.779678822f},
-std::array<float,2>{0.6808936f, 0.40478617f},
-std::array<float,2>{0.526377141f, 0.897939801f},
-std::array<float,2>{0.276463747f, 0.355685592f},
-std::array<float,2>{0.199843928f, 0.639365375f},
-std::array<float,2>{0.831879795f, 0.22066769f},
-std::array<float,2>{0.773821592f, 0.813043714f},
-std::array<float,2>{0.153786823f, 0.493847787f},
-std::array<float,2>{0.355924428f, 0.548032999f},
-std::array<float,2>{0.608938456f, 0.100144446f},
-std::array<float,2>{0.719219625f, 0.702247441f},
-std::array<float,2>{0.406959236f, 0.16075103f},
-std::array<float,2>{0.116438307f, 0.997254968f},
-std::array<float,2>{0.955123842f, 0.306691289f},
-std::array<float,2>{0.95284313f, 0.726266563f},
-std::array<float,2>{0.107558526f, 0.127277359f},
-std::array<float,2>{0.433280826f, 0.940018952f},
-std::array<float,2>{0.747584879f, 0.27136448f},
-std::array<float,2>{0.623216212f, 0.87367171f},
-std::array<float,2>{0.361785173f, 0.458757192f},
-std::array<float,2>{0.131604686f, 0.527753294f},
-std::array<float,2>{0.755143583f, 0.0637908503f},
-std::array<float,2>{0.825148404f, 0.92760241f},
-std::array<float,2>{0.216556445f, 0.324927568f},
-std::array<float,2>{0.264936984f, 0.681046546f},
-std::array<float,2>{0.509832621f, 0.214358389f},
-std::array<float,2>{0.656851172f, 0.623373806f},
-std::array<float,2>{0.490860313f, 0.0179224946f},
-std::array<float,2>{0.000467745325f, 0.783278108f},
-std::array<float,2>{0.921891093f, 0.426836222f},
-std::array<float,2>{0.793533206f, 0.539545059f},
-std::array<float,2>{0.161442131f, 0.114453748f},
-std::array<float,2>{0.341754258f, 0.835996151f},
-std::array<float,2>{0.585817993f, 0.476372242f},
-std::array<float,2>{0.688910663f, 0.982703149f},
-std::array<float,2>{0.379056364f, 0.283387274f},
-std::array<float,2>{0.0846364796f, 0.710561812f},
-std::array<float,2>{0.980880082f, 0.185382947f},
-std::array<float,2>{0.88492924f, 0.757049203f},
-std::array<float,2>{0.0534377247f, 0.381982327f},
-std::array<float,2>{0.452255189f, 0.578916609f},
-std::array<float,2>{0.644757569f, 0.0607115664f},
-std::array<float,2>{0.55043143f, 0.641395569f},
-std::array<float,2>{0.281635791f, 0.246289238f},
-std::array<float,2>{0.228094235f, 0.882083774f},
-std::array<float,2>{0.861513376f, 0.365754873f},
-std::array<float,2>{0.761619627f, 0.716077209f},
-std::array<float,2>{0.135868147f, 0.173704639f},
-std::array<float,2>{0.373830587f, 0.975340486f},
-std::array<float,2>{0.613448143f, 0.294867784f},
-std::array<float,2>{0.736236274f, 0.835672915f},
-std::array<float,2>{0.422448188f, 0.481567204f},
-std::array<float,2>{0.100688331f, 0.532635987f},
-std::array<float,2>{0.939118028f, 0.121570162f},
-std::array<float,2>{0.936674774f, 0.888056397f},
-std::array<float,2>{0.0122743119f, 0.368772835f},
-std::array<float,2>{0.496137917f, 0.649126887f},
-std::array<float,2>{0.669403613f, 0.237950891f},
-std::array<float,2>{0.502099514f, 0.586786091f},
-std::array<float,2>{0.25296092f, 0.0543206595f},
-std::array<float,2>{0.207807288f, 0.760319054f},
-std::array<float,2>{0.814582229f, 0.386204809f},
-std::array<float,2>{0.974295139f, 0.51942879f},
-std::array<float,2>{0.086823523f, 0.0770161077f},
-std::array<float,2>{0.384889513f, 0.866791308f},
-std::array<float,2>{0.703060269f, 0.46841076f},
-std::array<float,2>{0.590545833f, 0.949862838f},
-std::array<float,2>{0.335254341f, 0.276455194f},
-std::array<float,2>{0.164989665f, 0.730164051f},
-std::array<float,2>{0.784291744f, 0.138627008f},
-std::array<float,2>{0.87086463f, 0.796702027f},
-std::array<float,2>{0.219480798f, 0.433329374f},
-std::array<float,2>{0.294427902f, 0.609808922f},
-std::array<float,2>{0.562399566f, 0.0294317622f},
-std::array<float,2>{0.654234231f, 0.673321187f},
-std::array<float,2>{0.443183064f, 0.204250827f},
-std::array<float,2>{0.0584181435f, 0.929893613f},
-std::array<float,2>{0.87999332f, 0.315327018f},
-std::array<float,2>{0.904770494f, 0.628144979f},
-std::array<float,2>{0.0347356871f, 0.227353409f},
-std::array<float,2>{0.456204325f, 0.903357923f},
-std::array<float,2>{0.63829571f, 0.350624144f},
-std::array<float,2>{0.535789907f, 0.769570291f},
-std::array<float,2>{0.302428663f, 0.395123661f},
-std::array<float,2>{0.24410665f, 0.565321505f},
-std::array<float,2>{0.843876183f, 0.0347446054f},
-std::array<float,2>{0.797404587f, 0.99181056f},
-std::array<float,2>{0.185025334f, 0.301182836f},
-std::array<float,2>{0.322351038f, 0.68961668f},
-std::array<float,2>{0.574354827f, 0.165109873f},
-std::array<float,2>{0.707429707f, 0.561308444f},
-std::array<float,2>{0.404343039f, 0.103717223f},
-std::array<float,2>{0.0635635927f, 0.827819049f},
-std::array<float,2>{0.989493132f, 0.488823682f},
-std::array<float,2>{0.836825848f, 0.608894825f},
-std::array<float,2>{0.191207647f, 0.00898478087f},
-std::array<float,2>{0.271003157f, 0.802036941f},
-std::array<float,2>{0.516292155f, 0.408773869f},
-std::array<float,2>{0.675346255f, 0.907942355f},
-std::array<float,2>{0.483906418f, 0.333974451f},
-std::array<float,2>{0.0172179509f, 0.671146095f},
-std::array<float,2>{0.910328627f, 0.196253031f},
-std::array<float,2>{0.964311421f, 0.851087213f},
-std::array<float,2>{0.117902569f, 0.450975537f},
-std::array<float,2>{0.421580017f, 0.503993869f},
-std::array<float,2>{0.727735996f, 0.0851242542f},
-std::array<float,2>{0.59710604f, 0.746079028f},
-std::array<float,2>{0.35128963f, 0.146020725f},
-std::array<float,2>{0.142166987f, 0.960542083f},
-std::array<float,2>{0.770675957f, 0.263498425f},
-std::array<float,2>{0.818867862f, 0.736748636f},
-std::array<float,2>{0.205666572f, 0.150227398f},
-std::array<float,2>{0.254823089f, 0.966175675f},
-std::array<float,2>{0.507222354f, 0.252438247f},
-std::array<float,2>{0.664463997f, 0.858683407f},
-std::array<float,2>{0.49250114f, 0.442455053f},
-std::array<float,2>{0.0115341917f, 0.509852827f},
-std::array<float,2>{0.932021856f, 0.0880158544f},
-std::array<float,2>{0.944140732f, 0.918682218f},
-std::array<float,2>{0.0962882861f, 0.343259007f},
-std::array<float,2>{0.428217947f, 0.660403192f},
-std::array<float,2>{0.739879966f, 0.188985556f},
-std::array<float,2>{0.612844288f, 0.597369552f},
-std::array<float,2>{0.367415905f, 0.00570728537f},
-std::array<float,2>{0.13770093f, 0.80897212f},
-std::array<float,2>{0.765141308f, 0.41838032f},
-std::array<float,2>{0.876587808f, 0.554470241f},
-std::array<float,2>{0.0623500906f, 0.0973216519f},
-std::array<float,2>{0.4383609f, 0.816916049f},
-std::array<float,2>{0.649017513f, 0.499999732f},
-std::array<float,2>{0.555083156f, 0.995529234f},
-std::array<float,2>{0.290267497f, 0.311708212f},
-std::array<float,2>{0.224412531f, 0.696440816f},
-std::array<float,2>{0.871759176f, 0.157112241f},
-std::array<float,2>{0.787213445f, 0.777311802f},
-std::array<float,2>{0.169569016f, 0.400999516f},
-std::array<float,2>{0.329820752f, 0.57564038f},
-std::array<float,2>{0.587701738f, 0.0392433368f},
-std::array<float,2>{0.698771536f, 0.633621633f},
-std::array<float,2>{0.387437344f, 0.222704917f},
-std::array<float,2>{0.0912409723f, 0.893505037f},
-std::array<float,2>{0.970728993f, 0.354218781f},
-std::array<float,2>{0.98787123f, 0.685250103f},
-std::array<float,2>{0.0687911287f, 0.21774976f},
-std::array<float,2>{0.400980294f, 0.923419476f},
-std::array<float,2>{0.703414619f, 0.321728975f},
-std::array<float,2>{0.571867108f, 0.78736788f},
-std::array<float,2>{0.326316416f, 0.42517072f},
-std::array<float,2>{0.180697247f, 0.619438946f},
-std::array<float,2>{0.802082002f, 0.020936884f},
-std::array<float,2>{0.850277305f, 0.943139851f},
-std::array<float,2>{0.247538388f, 0.267137289f},
-std::array<float,2>{0.2993671f, 0.721765697f},
-std::array<float,2>{0.532358706f, 0.129521832f},
-std::array<float,2>{0.636587501f, 0.524400771f},
-std::array<float,2>{0.458497316f, 0.0700462535f},
-std::array<float,2>{0.0384459719f, 0.87017107f},
-std::array<float,2>{0.901534081f, 0.455036938f},
-std::array<float,2>{0.7661255f, 0.584038198f},
-std::array<float,2>{0.145057723f, 0.057466317f},
-std::array<float,2>{0.345241725f, 0.751328528f},
-std::array<float,2>{0.597765565f, 0.375210166f},
-std::array<float,2>{0.731666028f, 0.877469659f},
-std::array<float,2>{0.414075345f, 0.360576004f},
-std::array<float,2>{0.123449385f, 0.646055162f},
-std::array<float,2>{0.966481924f, 0.242523193f},
-std::array<float,2>{0.907833576f, 0.843099535f},
-std::array<float,2>{0.0230593998f, 0.47192505f},
-std::array<float,2>{0.476804346f, 0.54566741f},
-std::array<float,2>{0.676043451f, 0.111200035f},
-std::array<float,2>{0.521192431f, 0.704297423f},
-std::array<float,2>{0.266813487f, 0.179774493f},
-std::array<float,2>{0.192692697f, 0.979783952f},
-std::array<float,2>{0.841848969f, 0.288599491f},
-std::array<float,2>{0.811694324f, 0.653698742f},
-std::array<float,2>{0.17607145f, 0.239101842f},
-std::array<float,2>{0.314769357f, 0.885276496f},
-std::array<float,2>{0.566224039f, 0.373072714f},
-std::array<float,2>{0.711942315f, 0.763077855f},
-std::array<float,2>{0.393483013f, 0.388766438f},
-std::array<float,2>{0.0751936585f, 0.592956245f},
-std::array<float,2>{0.992559493f, 0.0497689918f},
-std::array<float,2>{0.891942739f, 0.971049607f},
-std::array<float,2>{0.0448217764f, 0.290228248f},
-std::array<float,2>{0.46096465f, 0.714041293f},
-std::array<float,2>{0.629134238f, 0.179607734f},
-std::array<float,2>{0.545364141f, 0.535443664f},
-std::array<float,2>{0.309458345f, 0.117850937f},
-std::array<float,2>{0.236222029f, 0.831536233f},
-std::array<float,2>{0.855975807f, 0.477212667f},
-std::array<float,2>{0.958015561f, 0.615784287f},
-std::array<float,2>{0.109750219f, 0.0236345157f},
-std::array<float,2>{0.41155836f, 0.791665614f},
-std::array<float,2>{0.725626588f, 0.435256332f},
-std::array<float,2>{0.601932526f, 0.935672462f},
-std::array<float,2>{0.351798952f, 0.319358081f},
-std::array<float,2>{0.15168862f, 0.678659141f},
-std::array<float,2>{0.779785037f, 0.210842758f},
-std::array<float,2>{0.83394748f, 0.862448215f},
-std::array<float,2>{0.197206333f, 0.464566261f},
-std::array<float,2>{0.280439705f, 0.520812809f},
-std::array<float,2>{0.529335499f, 0.0730092898f},
-std::array<float,2>{0.686868131f, 0.731266379f},
-std::array<float,2>{0.475994349f, 0.134711593f},
-std::array<float,2>{0.0304948557f, 0.947037756f},
-std::array<float,2>{0.919466376f, 0.280558258f},
-std::array<float,2>{0.926275313f, 0.694017053f},
-std::array<float,2>{0.00733431475f, 0.170221031f},
-std::array<float,2>{0.486931086f, 0.987781644f},
-std::array<float,2>{0.662848711f, 0.298507094f},
-std::array<float,2>{0.513933659f, 0.821247101f},
-std::array<float,2>{0.261258364f, 0.484827846f},
-std::array<float,2>{0.213985562f, 0.557581365f},
-std::array<float,2>{0.820642769f, 0.108010262f},
-std::array<float,2>{0.753654778f, 0.900945187f},
-std::array<float,2>{0.126918122f, 0.346387684f},
-std::array<float,2>{0.365065277f, 0.631414473f},
-std::array<float,2>{0.620684087f, 0.231557548f},
-std::array<float,2>{0.742867887f, 0.568983436f},
-std::array<float,2>{0.434517711f, 0.0380614325f},
-std::array<float,2>{0.102018982f, 0.766441703f},
-std::array<float,2>{0.945642948f, 0.393131584f},
-std::array<float,2>{0.864394307f, 0.500517547f},
-std::array<float,2>{0.233283803f, 0.079010509f},
-std::array<float,2>{0.285250336f, 0.845103681f},
-std::array<float,2>{0.553012013f, 0.445322633f},
-std::array<float,2>{0.642348289f, 0.956312358f},
-std::array<float,2>{0.446042776f, 0.26070112f},
-std::array<float,2>{0.0503644459f, 0.749507427f},
-std::array<float,2>{0.890042126f, 0.141887516f},
-std::array<float,2>{0.977434635f, 0.797739804f},
-std::array<float,2>{0.0797514617f, 0.411968797f},
-std::array<float,2>{0.376972973f, 0.603946567f},
-std::array<float,2>{0.692014277f, 0.0123436507f},
-std::array<float,2>{0.578211844f, 0.665191114f},
-std::array<float,2>{0.337701201f, 0.200744107f},
-std::array<float,2>{0.157458439f, 0.912023604f},
-std::array<float,2>{0.789653778f, 0.331963986f},
-std::array<float,2>{0.81667608f, 0.660172045f},
-std::array<float,2>{0.203599051f, 0.189224288f},
-std::array<float,2>{0.25701952f, 0.918840408f},
-std::array<float,2>{0.505140245f, 0.342878819f},
-std::array<float,2>{0.667034984f, 0.80873847f},
-std::array<float,2>{0.494176149f, 0.417974085f},
-std::array<float,2>{0.00889728498f, 0.597506583f},
-std::array<float,2>{0.930777609f, 0.00560332555f},
-std::array<float,2>{0.943270564f, 0.966051042f},
-std::array<float,2>{0.0947711766f, 0.252049476f},
-std::array<float,2>{0.426848531f, 0.736556053f},
-std::array<float,2>{0.740519166f, 0.150070921f},
-std::array<float,2>{0.609979808f, 0.510199487f},
-std::array<float,2>{0.370844662f, 0.0883441046f},
-std::array<float,2>{0.139114454f, 0.858493686f},
-std::array<float,2>{0.762848854f, 0.442679673f},
-std::array<float,2>{0.878637433f, 0.575199425f},
-std::array<float,2>{0.0596917979f, 0.0393257402f},
-std::array<float,2>{0.440511554f, 0.776980758f},
-std::array<float,2>{0.65145725f, 0.401333034f},
-std::array<float,2>{0.557006538f, 0.893265724f},
-std::array<float,2>{0.291308731f, 0.354294837f},
-std::array<float,2>{0.225259542f, 0.63330704f},
-std::array<float,2>{0.873854876f, 0.223092824f},
-std::array<float,2>{0.786791146f, 0.817318261f},
-std::array<float,2>{0.171217471f, 0.499575526f},
-std::array<float,2>{0.330104709f, 0.554320574f},
-std::array<float,2>{0.589789033f, 0.0974684358f},
-std::array<float,2>{0.695852816f, 0.696593106f},
-std::array<float,2>{0.389230222f, 0.156786144f},
-std::array<float,2>{0.093320027f, 0.995337486f},
-std::array<float,2>{0.96972394f, 0.311996818f},
-std::array<float,2>{0.985867918f, 0.722059786f},
-std::array<float,2>{0.0670745224f, 0.129793584f},
-std::array<float,2>{0.400062621f, 0.943054974f},
-std::array<float,2>{0.70580703f, 0.26738584f},
-std::array<float,2>{0.573528528f, 0.870474994f},
-std::array<float,2>{0.324500233f, 0.454720765f},
-std::array<float,2>{0.182429567f, 0.523930848f},
-std::array<float,2>{0.803518593f, 0.0702646673f},
-std::array<float,2>{0.849074721f, 0.923675001f},
-std::array<float,2>{0.249319553f, 0.321382046f},
-std::array<float,2>{0.297725141f, 0.685522318f},
-std::array<float,2>{0.533328116f, 0.217466354f},
-std::array<float,2>{0.633551836f, 0.619221628f},
-std::array<float,2>{0.459157705f, 0.0207328461f},
-std::array<float,2>{0.035374146f, 0.787314773f},
-std::array<float,2>{0.899040222f, 0.424952f},
-std::array<float,2>{0.769430339f, 0.545415044f},
-std::array<float,2>{0.148045808f, 0.111050628f},
-std::array<float,2>{0.347586662f, 0.842828274f},
-std::array<float,2>{0.59988606f, 0.471768677f},
-std::array<float,2>{0.732616007f, 0.979556799f},
-std::array<float,2>{0.417387336f, 0.288948476f},
-std::array<float,2>{0.121684f, 0.704497874f},
-std::array<float,2>{0.967212677f, 0.180168331f},
-std::array<float,2>{0.909221411f, 0.751140714f},
-std::array<float,2>{0.0196869522f, 0.375262886f},
-std::array<float,2>{0.479384601f, 0.584306896f},
-std::array<float,2>{0.679531276f, 0.0573617332f},
-std::array<float,2>{0.522429585f, 0.646291018f},
-std::array<float,2>{0.269461989f, 0.242402866f},
-std::array<float,2>{0.193535209f, 0.877767384f},
-std::array<float,2>{0.83985275f, 0.360633373f},
-std::array<float,2>{0.810058057f, 0.714354038f},
-std::array<float,2>{0.178721502f, 0.179410622f},
-std::array<float,2>{0.312843472f, 0.970925152f},
-std::array<float,2>{0.563883066f, 0.290480077f},
-std::array<float,2>{0.714144886f, 0.831155181f},
-std::array<float,2>{0.391865641f, 0.477478057f},
-std::array<float,2>{0.0778519586f, 0.535322845f},
-std::array<float,2>{0.994793832f, 0.117989428f},
-std::array<float,2>{0.893573761f, 0.885553062f},
-std::array<float,2>{0.0465637632f, 0.373408198f},
-std::array<float,2>{0.464386612f, 0.65354526f},
-std::array<float,2>{0.630979121f, 0.238942429f},
-std::array<float,2>{0.544705868f, 0.593071699f},
-std::array<float,2>{0.311644018f, 0.0493689664f},
-std::array<float,2>{0.236693501f, 0.762746811f},
-std::array<float,2>{0.859352946f, 0.389117688f},
-std::array<float,2>{0.959439516f, 0.52052331f},
-std::array<float,2>{0.111438699f, 0.0728429705f},
-std::array<float,2>{0.412901074f, 0.862725377f},
-std::array<float,2>{0.723994374f, 0.464728475f},
-std::array<float,2>{0.60495168f, 0.946823478f},
-std::array<float,2>{0.353954613f, 0.280337483f},
-std::array<float,2>{0.149314731f, 0.731179595f},
-std::array<float,2>{0.777388334f, 0.134511799f},
-std::array<float,2>{0.835813463f, 0.791848421f},
-std::array<float,2>{0.197354823f, 0.435467303f},
-std::array<float,2>{0.277673483f, 0.616102338f},
-std::array<float,2>{0.527679265f, 0.0236976314f},
-std::array<float,2>{0.684466064f, 0.678332865f},
-std::array<float,2>{0.474430501f, 0.210627824f},
-std::array<float,2>{0.0288267452f, 0.935865402f},
-std::array<float,2>{0.921024978f, 0.31965664f},
-std::array<float,2>{0.929038107f, 0.631753743f},
-std::array<float,2>{0.00465705385f, 0.231759995f},
-std::array<float,2>{0.485541463f, 0.901208639f},
-std::array<float,2>{0.661001801f, 0.346529424f},
-std::array<float,2>{0.512044728f, 0.76622504f},
-std::array<float,2>{0.259713501f, 0.393357754f},
-std::array<float,2>{0.211536542f, 0.569331944f},
-std::array<float,2>{0.823055744f, 0.0378383696f},
-std::array<float,2>{0.751856327f, 0.987546861f},
-std::array<float,2>{0.12872383f, 0.298655003f},
-std::array<float,2>{0.366490841f, 0.694288194f},
-std::array<float,2>{0.617306173f, 0.169960275f},
-std::array<float,2>{0.745388031f, 0.557248175f},
-std::array<float,2>{0.437349439f, 0.108336002f},
-std::array<float,2>{0.104785703f, 0.820864737f},
-std::array<float,2>{0.948910117f, 0.484500676f},
-std::array<float,2>{0.866977274f, 0.603641033f},
-std::array<float,2>{0.231299192f, 0.0126604671f},
-std::array<float,2>{0.287791729f, 0.797491133f},
-std::array<float,2>{0.552154779f, 0.411791384f},
-std::array<float,2>{0.644304276f, 0.911799014f},
-std::array<float,2>{0.448715895f, 0.331597358f},
-std::array<float,2>{0.0469818152f, 0.665516734f},
-std::array<float,2>{0.887423635f, 0.201150104f},
-std::array<float,2>{0.978749096f, 0.844952822f},
-std::array<float,2>{0.0819873363f, 0.445731848f},
-std::array<float,2>{0.376825929f, 0.500949502f},
-std::array<float,2>{0.693746388f, 0.0787631124f},
-std::array<float,2>{0.580351353f, 0.749220192f},
-std::array<float,2>{0.339231402f, 0.141712695f},
-std::array<float,2>{0.159135744f, 0.956266582f},
-std::array<float,2>{0.791971207f, 0.260488719f},
-std::array<float,2>{0.854898751f, 0.739361227f},
-std::array<float,2>{0.240146294f, 0.155318186f},
-std::array<float,2>{0.308091819f, 0.964338124f},
-std::array<float,2>{0.539327025f, 0.256272852f},
-std::array<float,2>{0.628340244f, 0.852485895f},
-std::array<float,2>{0.467762887f, 0.438027501f},
-std::array<float,2>{0.0404295549f, 0.512408912f},
-std::array<float,2>{0.895930469f, 0.0912975743f},
-std::array<float,2>{0.996184647f, 0.915848494f},
-std::array<float,2>{0.0717787147f, 0.337996632f},
-std::array<float,2>{0.395305276f, 0.657462955f},
-std::array<float,2>{0.71611321f, 0.194356352f},
-std::array<float,2>{0.567121685f, 0.600456834f},
-std::array<float,2>{0.3188788f, 0.000351576949f},
-std::array<float,2>{0.173798919f, 0.806805372f},
-std::array<float,2>{0.808532894f, 0.415889949f},
-std::array<float,2>{0.916983247f, 0.548330903f},
-std::array<float,2>{0.0237064343f, 0.100344896f},
-std::array<float,2>{0.46883738f, 0.813284159f},
-std::array<float,2>{0.683291852f, 0.493901342f},
-std::array<float,2>{0.523822367f, 0.997479677f},
-std::array<float,2>{0.27415666f, 0.306927055f},
-std::array<float,2>{0.202971324f, 0.70253545f},
-std::array<float,2>{0.829544425f, 0.160934553f},
-std::array<float,2>{0.777309299f, 0.779443741f},
-std::array<float,2>{0.155948445f, 0.405107796f},
-std::array<float,2>{0.358148217f, 0.570795357f},
-std::array<float,2>{0.607288361f, 0.0468718186f},
-std::array<float,2>{0.721525729f, 0.63949877f},
-std::array<float,2>{0.409282297f, 0.220298231f},
-std::array<float,2>{0.114079915f, 0.897612751f},
-std::array<float,2>{0.953688502f, 0.355907738f},
-std::array<float,2>{0.951093316f, 0.680763185f},
-std::array<float,2>{0.10565193f, 0.214742064f},
-std::array<float,2>{0.430049628f, 0.927298069f},
-std::array<float,2>{0.748245358f, 0.325013131f},
-std::array<float,2>{0.622127652f, 0.783495724f},
-std::array<float,2>{0.361276835f, 0.427148014f},
-std::array<float,2>{0.130383596f, 0.623254776f},
-std::array<float,2>{0.756926656f, 0.0178036634f},
-std::array<float,2>{0.827241063f, 0.940308869f},
-std::array<float,2>{0.218114838f, 0.271209955f},
-std::array<float,2>{0.261986405f, 0.726362228f},
-std::array<float,2>{0.509329975f, 0.127018303f},
-std::array<float,2>{0.65854311f, 0.527555108f},
-std::array<float,2>{0.488689929f, 0.0635715351f},
-std::array<float,2>{0.00369023322f, 0.873905361f},
-std::array<float,2>{0.9254691f, 0.458518714f},
-std::array<float,2>{0.795503736f, 0.578856885f},
-std::array<float,2>{0.16233924f, 0.0607970804f},
-std::array<float,2>{0.342787772f, 0.757254064f},
-std::array<float,2>{0.582235038f, 0.382118613f},
-std::array<float,2>{0.690544069f, 0.881927192f},
-std::array<float,2>{0.380979866f, 0.366159022f},
-std::array<float,2>{0.0830313638f, 0.641223192f},
-std::array<float,2>{0.983364701f, 0.24643895f},
-std::array<float,2>{0.884626091f, 0.836227655f},
-std::array<float,2>{0.0523329936f, 0.47620666f},
-std::array<float,2>{0.450597316f, 0.539136827f},
-std::array<float,2>{0.646868706f, 0.114701904f},
-std::array<float,2>{0.547450304f, 0.710748374f},
-std::array<float,2>{0.284833312f, 0.185167983f},
-std::array<float,2>{0.228894964f, 0.982608914f},
-std::array<float,2>{0.859812856f, 0.28352043f},
-std::array<float,2>{0.758190334f, 0.649253249f},
-std::array<float,2>{0.134216681f, 0.238195077f},
-std::array<float,2>{0.371686161f, 0.887789845f},
-std::array<float,2>{0.615972698f, 0.369110733f},
-std::array<float,2>{0.736713111f, 0.760560513f},
-std::array<float,2>{0.425222516f, 0.38585186f},
-std::array<float,2>{0.0992215872f, 0.586466253f},
-std::array<float,2>{0.93989718f, 0.0545235276f},
-std::array<float,2>{0.935096025f, 0.975494444f},
-std::array<float,2>{0.0151521964f, 0.294536293f},
-std::array<float,2>{0.499465287f, 0.716007233f},
-std::array<float,2>{0.670336008f, 0.173429102f},
-std::array<float,2>{0.501369536f, 0.532361031f},
-std::array<float,2>{0.251659364f, 0.121246718f},
-std::array<float,2>{0.210279346f, 0.835856259f},
-std::array<float,2>{0.813055217f, 0.481850743f},
-std::array<float,2>{0.975197613f, 0.609455109f},
-std::array<float,2>{0.0888385922f, 0.0295681078f},
-std::array<float,2>{0.384690017f, 0.79651022f},
-std::array<float,2>{0.699984848f, 0.433583379f},
-std::array<float,2>{0.592242062f, 0.930025458f},
-std::array<float,2>{0.33396557f, 0.315091878f},
-std::array<float,2>{0.166056335f, 0.673071504f},
-std::array<float,2>{0.781861067f, 0.204475999f},
-std::array<float,2>{0.868134141f, 0.867029369f},
-std::array<float,2>{0.221355513f, 0.468653649f},
-std::array<float,2>{0.295154065f, 0.519138575f},
-std::array<float,2>{0.560378075f, 0.076745972f},
-std::array<float,2>{0.65434581f, 0.730324566f},
-std::array<float,2>{0.44394815f, 0.138193071f},
-std::array<float,2>{0.0547293574f, 0.94996202f},
-std::array<float,2>{0.881640673f, 0.276702464f},
-std::array<float,2>{0.903732598f, 0.6897645f},
-std::array<float,2>{0.0331884287f, 0.165346622f},
-std::array<float,2>{0.454858929f, 0.992105782f},
-std::array<float,2>{0.640343487f, 0.301005363f},
-std::array<float,2>{0.537302196f, 0.828085184f},
-std::array<float,2>{0.302789181f, 0.489105284f},
-std::array<float,2>{0.244779259f, 0.561061502f},
-std::array<float,2>{0.845805526f, 0.103949845f},
-std::array<float,2>{0.799878061f, 0.903677523f},
-std::array<float,2>{0.185970202f, 0.350961804f},
-std::array<float,2>{0.32074222f, 0.628305495f},
-std::array<float,2>{0.577937603f, 0.227243066f},
-std::array<float,2>{0.71052897f, 0.565101922f},
-std::array<float,2>{0.403268576f, 0.0350347869f},
-std::array<float,2>{0.0656833425f, 0.769970179f},
-std::array<float,2>{0.99117738f, 0.395293146f},
-std::array<float,2>{0.838020027f, 0.504229605f},
-std::array<float,2>{0.187663823f, 0.0852757767f},
-std::array<float,2>{0.272995621f, 0.85148108f},
-std::array<float,2>{0.519139946f, 0.450701594f},
-std::array<float,2>{0.673392355f, 0.960695982f},
-std::array<float,2>{0.481750339f, 0.263302565f},
-std::array<float,2>{0.0178199206f, 0.745791733f},
-std::array<float,2>{0.912532806f, 0.146248057f},
-std::array<float,2>{0.961256921f, 0.801950812f},
-std::array<float,2>{0.119214699f, 0.409007639f},
-std::array<float,2>{0.419662118f, 0.609325707f},
-std::array<float,2>{0.728699446f, 0.00919569936f},
-std::array<float,2>{0.593974471f, 0.670929015f},
-std::array<float,2>{0.348287493f, 0.195902243f},
-std::array<float,2>{0.142599165f, 0.908027172f},
-std::array<float,2>{0.7729792f, 0.333584189f},
-std::array<float,2>{0.872296393f, 0.636707306f},
-std::array<float,2>{0.223352149f, 0.225582302f},
-std::array<float,2>{0.289957643f, 0.892469227f},
-std::array<float,2>{0.556281805f, 0.35223344f},
-std::array<float,2>{0.649445653f, 0.773766518f},
-std::array<float,2>{0.438708484f, 0.399004847f},
-std::array<float,2>{0.0608601272f, 0.577396452f},
-std::array<float,2>{0.875108957f, 0.0414701439f},
-std::array<float,2>{0.971794248f, 0.992827952f},
-std::array<float,2>{0.0907231942f, 0.310421169f},
-std::array<float,2>{0.388461113f, 0.698054016f},
-std::array<float,2>{0.697695911f, 0.159314454f},
-std::array<float,2>{0.586533368f, 0.55136162f},
-std::array<float,2>{0.329096735f, 0.0949226469f},
-std::array<float,2>{0.16821374f, 0.818858981f},
-std::array<float,2>{0.788942635f, 0.497692257f},
-std::array<float,2>{0.933152497f, 0.594257295f},
-std::array<float,2>{0.0100102127f, 0.00710502546f},
-std::array<float,2>{0.493494093f, 0.810850203f},
-std::array<float,2>{0.66594249f, 0.420972139f},
-std::array<float,2>{0.506287575f, 0.920837522f},
-std::array<float,2>{0.254940063f, 0.340861887f},
-std::array<float,2>{0.206274554f, 0.662768781f},
-std::array<float,2>{0.820300341f, 0.190781429f},
-std::array<float,2>{0.763922036f, 0.857405186f},
-std::array<float,2>{0.137437373f, 0.443841785f},
-std::array<float,2>{0.368566662f, 0.50809449f},
-std::array<float,2>{0.611560464f, 0.0876513198f},
-std::array<float,2>{0.739254653f, 0.734470725f},
-std::array<float,2>{0.428726763f, 0.151977479f},
-std::array<float,2>{0.0968825892f, 0.967390537f},
-std::array<float,2>{0.944778502f, 0.250596702f},
-std::array<float,2>{0.965132594f, 0.705724597f},
-std::array<float,2>{0.124228209f, 0.182159066f},
-std::array<float,2>{0.415912181f, 0.978100955f},
-std::array<float,2>{0.731153488f, 0.285768807f},
-std::array<float,2>{0.599516869f, 0.840932786f},
-std::array<float,2>{0.344419211f, 0.469946921f},
-std::array<float,2>{0.146381512f, 0.544907987f},
-std::array<float,2>{0.76698643f, 0.112242088f},
-std::array<float,2>{0.84291929f, 0.876046479f},
-std::array<float,2>{0.191915706f, 0.362681478f},
-std::array<float,2>{0.266091526f, 0.647246659f},
-std::array<float,2>{0.520349443f, 0.245709255f},
-std::array<float,2>{0.67722559f, 0.58362335f},
-std::array<float,2>{0.477935314f, 0.055676166f},
-std::array<float,2>{0.0218053926f, 0.753172934f},
-std::array<float,2>{0.906413913f, 0.378179073f},
-std::array<float,2>{0.801411569f, 0.527242482f},
-std::array<float,2>{0.17991063f, 0.0677558258f},
-std::array<float,2>{0.327822089f, 0.868898869f},
-std::array<float,2>{0.571243763f, 0.455402076f},
-std::array<float,2>{0.704609454f, 0.944317698f},
-std::array<float,2>{0.401650369f, 0.268080205f},
-std::array<float,2>{0.0695415065f, 0.720264614f},
-std::array<float,2>{0.987253964f, 0.132002011f},
-std::array<float,2>{0.900582552f, 0.785428166f},
-std::array<float,2>{0.0375424735f, 0.422015607f},
-std::array<float,2>{0.457421988f, 0.618634582f},
-std::array<float,2>{0.635072172f, 0.0221553557f},
-std::array<float,2>{0.53125459f, 0.686740041f},
-std::array<float,2>{0.300507635f, 0.21659027f},
-std::array<float,2>{0.247053951f, 0.925585508f},
-std::array<float,2>{0.851470351f, 0.323003322f},
-std::array<float,2>{0.78073436f, 0.733324766f},
-std::array<float,2>{0.151036382f, 0.135981336f},
-std::array<float,2>{0.353204668f, 0.947939217f},
-std::array<float,2>{0.603488326f, 0.278308511f},
-std::array<float,2>{0.724654973f, 0.860121369f},
-std::array<float,2>{0.410847574f, 0.461203963f},
-std::array<float,2>{0.110655561f, 0.522222996f},
-std::array<float,2>{0.957116544f, 0.0720739886f},
-std::array<float,2>{0.91870141f, 0.933898032f},
-std::array<float,2>{0.0293971393f, 0.317962885f},
-std::array<float,2>{0.475013793f, 0.676573515f},
-std::array<float,2>{0.685929656f, 0.207990229f},
-std::array<float,2>{0.530634284f, 0.614852846f},
-std::array<float,2>{0.279956937f, 0.026391888f},
-std::array<float,2>{0.195823133f, 0.790499747f},
-std::array<float,2>{0.832329273f, 0.436202288f},
-std::array<float,2>{0.993764997f, 0.537523031f},
-std::array<float,2>{0.0760612041f, 0.120049335f},
-std::array<float,2>{0.3938483f, 0.828266442f},
-std::array<float,2>{0.711357594f, 0.48037523f},
-std::array<float,2>{0.564599574f, 0.968781471f},
-std::array<float,2>{0.315565258f, 0.292533904f},
-std::array<float,2>{0.17708227f, 0.711686194f},
-std::array<float,2>{0.81114012f, 0.17629987f},
-std::array<float,2>{0.857349813f, 0.764184833f},
-std::array<float,2>{0.23453249f, 0.388041854f},
-std::array<float,2>{0.310371041f, 0.591782629f},
-std::array<float,2>{0.546588123f, 0.0477567911f},
-std::array<float,2>{0.630449474f, 0.654676855f},
-std::array<float,2>{0.462818712f, 0.241048306f},
-std::array<float,2>{0.0436249748f, 0.883778393f},
-std::array<float,2>{0.890756547f, 0.372610092f},
-std::array<float,2>{0.888954103f, 0.667889833f},
-std::array<float,2>{0.0491566397f, 0.203063875f},
-std::array<float,2>{0.446967006f, 0.913295448f},
-std::array<float,2>{0.640791059f, 0.330060035f},
-std::array<float,2>{0.553888559f, 0.79921627f},
-std::array<float,2>{0.28650108f, 0.412733704f},
-std::array<float,2>{0.234209403f, 0.602816582f},
-std::array<float,2>{0.863770902f, 0.0141312815f},
-std::array<float,2>{0.790614963f, 0.953261793f},
-std::array<float,2>{0.156655893f, 0.25906378f},
-std::array<float,2>{0.336169183f, 0.747759044f},
-std::array<float,2>{0.579331517f, 0.142931998f},
-std::array<float,2>{0.692831933f, 0.502873182f},
-std::array<float,2>{0.378575742f, 0.0807132125f},
-std::array<float,2>{0.0786951259f, 0.847418427f},
-std::array<float,2>{0.977845907f, 0.447269946f},
-std::array<float,2>{0.821317375f, 0.566996038f},
-std::array<float,2>{0.213308603f, 0.035841994f},
-std::array<float,2>{0.260092676f, 0.767887175f},
-std::array<float,2>{0.515366137f, 0.391324103f},
-std::array<float,2>{0.663933158f, 0.899422288f},
-std::array<float,2>{0.4876616f, 0.34530136f},
-std::array<float,2>{0.00607802719f, 0.62919569f},
-std::array<float,2>{0.926851273f, 0.233059138f},
-std::array<float,2>{0.946498394f, 0.823684752f},
-std::array<float,2>{0.102781735f, 0.486752152f},
-std::array<float,2>{0.435206294f, 0.55511564f},
-std::array<float,2>{0.743982375f, 0.1068037f},
-std::array<float,2>{0.619457066f, 0.692382455f},
-std::array<float,2>{0.363701344f, 0.169830456f},
-std::array<float,2>{0.12567386f, 0.985527992f},
-std::array<float,2>{0.7524876f, 0.299859107f},
-std::array<float,2>{0.830760598f, 0.699496388f},
-std::array<float,2>{0.200694978f, 0.163558722f},
-std::array<float,2>{0.275392622f, 0.99968189f},
-std::array<float,2>{0.526271939f, 0.304721594f},
-std::array<float,2>{0.679995298f, 0.815334916f},
-std::array<float,2>{0.471525371f, 0.494642437f},
-std::array<float,2>{0.0266929977f, 0.549473464f},
-std::array<float,2>{0.915702403f, 0.0990082994f},
-std::array<float,2>{0.956349492f, 0.895570219f},
-std::array<float,2>{0.115441874f, 0.358459443f},
-std::array<float,2>{0.407569349f, 0.63716644f},
-std::array<float,2>{0.720189035f, 0.221696004f},
-std::array<float,2>{0.608187199f, 0.573175967f},
-std::array<float,2>{0.356700659f, 0.0434515849f},
-std::array<float,2>{0.152730122f, 0.779046178f},
-std::array<float,2>{0.77491945f, 0.403427958f},
-std::array<float,2>{0.897910297f, 0.515165389f},
-std::array<float,2>{0.0425770879f, 0.0922894552f},
-std::array<float,2>{0.465371609f, 0.854781806f},
-std::array<float,2>{0.626271009f, 0.441231459f},
-std::array<float,2>{0.542452216f, 0.962146103f},
-std::array<float,2>{0.305824339f, 0.255155295f},
-std::array<float,2>{0.240459844f, 0.741678655f},
-std::array<float,2>{0.852194428f, 0.153859019f},
-std::array<float,2>{0.805463552f, 0.805675566f},
-std::array<float,2>{0.175392836f, 0.417027444f},
-std::array<float,2>{0.316455662f, 0.598634362f},
-std::array<float,2>{0.568859458f, 0.00266939122f},
-std::array<float,2>{0.717457533f, 0.658876836f},
-std::array<float,2>{0.398397356f, 0.192917764f},
-std::array<float,2>{0.0741642118f, 0.916264415f},
-std::array<float,2>{0.998425305f, 0.336250007f},
-std::array<float,2>{0.98189044f, 0.642579019f},
-std::array<float,2>{0.0853369161f, 0.249856785f},
-std::array<float,2>{0.380773813f, 0.880427539f},
-std::array<float,2>{0.687720299f, 0.364683062f},
-std::array<float,2>{0.584921598f, 0.755025208f},
-std::array<float,2>{0.340284377f, 0.380002588f},
-std::array<float,2>{0.160607889f, 0.581572115f},
-std::array<float,2>{0.794636011f, 0.0591815002f},
-std::array<float,2>{0.863172054f, 0.980701804f},
-std::array<float,2>{0.227120325f, 0.282096058f},
-std::array<float,2>{0.282835811f, 0.708909929f},
-std::array<float,2>{0.549280584f, 0.186290592f},
-std::array<float,2>{0.645531476f, 0.542760193f},
-std::array<float,2>{0.451417744f, 0.116674699f},
-std::array<float,2>{0.0544232316f, 0.838870227f},
-std::array<float,2>{0.885876894f, 0.474493295f},
-std::array<float,2>{0.754867971f, 0.621816099f},
-std::array<float,2>{0.132741675f, 0.0159618706f},
-std::array<float,2>{0.362668395f, 0.782434523f},
-std::array<float,2>{0.624605775f, 0.429415613f},
-std::array<float,2>{0.746363163f, 0.927916467f},
-std::array<float,2>{0.432530344f, 0.328085065f},
-std::array<float,2>{0.109237164f, 0.681962729f},
-std::array<float,2>{0.952035666f, 0.212502599f},
-std::array<float,2>{0.923696816f, 0.872894764f},
-std::array<float,2>{0.00141224125f, 0.459879667f},
-std::array<float,2>{0.492037028f, 0.531071842f},
-std::array<float,2>{0.657655597f, 0.0657944828f},
-std::array<float,2>{0.510760188f, 0.72378999f},
-std::array<float,2>{0.264531463f, 0.125972256f},
-std::array<float,2>{0.215047985f, 0.939404964f},
-std::array<float,2>{0.825874686f, 0.272948533f},
-std::array<float,2>{0.783336043f, 0.675181329f},
-std::array<float,2>{0.165444687f, 0.205745831f},
-std::array<float,2>{0.334497839f, 0.933562994f},
-std::array<float,2>{0.590857148f, 0.312891811f},
-std::array<float,2>{0.701467335f, 0.794298828f},
-std::array<float,2>{0.386331648f, 0.43085295f},
-std::array<float,2>{0.0878408402f, 0.612004399f},
-std::array<float,2>{0.973534226f, 0.0289569572f},
-std::array<float,2>{0.879580557f, 0.951690376f},
-std::array<float,2>{0.0567128807f, 0.274277925f},
-std::array<float,2>{0.442203969f, 0.727659523f},
-std::array<float,2>{0.652632654f, 0.139456332f},
-std::array<float,2>{0.5605703f, 0.517149508f},
-std::array<float,2>{0.293147743f, 0.0749880075f},
-std::array<float,2>{0.219966397f, 0.864841998f},
-std::array<float,2>{0.869818449f, 0.465659201f},
-std::array<float,2>{0.937776089f, 0.588932693f},
-std::array<float,2>{0.0998215973f, 0.0525881238f},
-std::array<float,2>{0.422965765f, 0.758281112f},
-std::array<float,2>{0.734505892f, 0.384050786f},
-std::array<float,2>{0.614685833f, 0.888769686f},
-std::array<float,2>{0.374300987f, 0.370551527f},
-std::array<float,2>{0.135291383f, 0.651966572f},
-std::array<float,2>{0.760075867f, 0.236086249f},
-std::array<float,2>{0.816177726f, 0.833425701f},
-std::array<float,2>{0.208741441f, 0.482671052f},
-std::array<float,2>{0.252559811f, 0.534268618f},
-std::array<float,2>{0.503268957f, 0.124888182f},
-std::array<float,2>{0.668864608f, 0.717695773f},
-std::array<float,2>{0.49715206f, 0.174436882f},
-std::array<float,2>{0.0133978445f, 0.974081039f},
-std::array<float,2>{0.936508834f, 0.295757592f},
-std::array<float,2>{0.911604285f, 0.742790103f},
-std::array<float,2>{0.0159540214f, 0.147349432f},
-std::array<float,2>{0.483223587f, 0.95748502f},
-std::array<float,2>{0.6744259f, 0.265121579f},
-std::array<float,2>{0.517117023f, 0.849401891f},
-std::array<float,2>{0.270285457f, 0.452273577f},
-std::array<float,2>{0.19033511f, 0.507692158f},
-std::array<float,2>{0.837104797f, 0.0834012106f},
-std::array<float,2>{0.770237863f, 0.909042656f},
-std::array<float,2>{0.141101524f, 0.334492147f},
-std::array<float,2>{0.349883676f, 0.669655085f},
-std::array<float,2>{0.596252441f, 0.197272047f},
-std::array<float,2>{0.727154136f, 0.606375694f},
-std::array<float,2>{0.420838058f, 0.00981798768f},
-std::array<float,2>{0.118317991f, 0.804665804f},
-std::array<float,2>{0.963866889f, 0.407915205f},
-std::array<float,2>{0.845330656f, 0.560400724f},
-std::array<float,2>{0.242388457f, 0.102250844f},
-std::array<float,2>{0.30081585f, 0.826150358f},
-std::array<float,2>{0.536635518f, 0.492105752f},
-std::array<float,2>{0.636984229f, 0.988528967f},
-std::array<float,2>{0.455476969f, 0.303492576f},
-std::array<float,2>{0.033953324f, 0.688046813f},
-std::array<float,2>{0.905953228f, 0.167309135f},
-std::array<float,2>{0.988827825f, 0.772769511f},
-std::array<float,2>{0.0630358234f, 0.397167832f},
-std::array<float,2>{0.405515045f, 0.564049184f},
-std::array<float,2>{0.708017826f, 0.0325082652f},
-std::array<float,2>{0.575354159f, 0.625499666f},
-std::array<float,2>{0.323845595f, 0.228635237f},
-std::array<float,2>{0.183597922f, 0.904467285f},
-std::array<float,2>{0.798410237f, 0.349032938f},
-std::array<float,2>{0.841515064f, 0.648039103f},
-std::array<float,2>{0.195180133f, 0.24498567f},
-std::array<float,2>{0.267905861f, 0.875479996f},
-std::array<float,2>{0.522518277f, 0.362244338f},
-std::array<float,2>{0.678543925f, 0.752752483f},
-std::array<float,2>{0.480039418f, 0.377733529f},
-std::array<float,2>{0.0205922779f, 0.582530022f},
-std::array<float,2>{0.908860207f, 0.0553842112f},
-std::array<float,2>{0.967895329f, 0.977247238f},
-std::array<float,2>{0.122323982f, 0.28694123f},
-std::array<float,2>{0.416716367f, 0.706809044f},
-std::array<float,2>{0.733677387f, 0.183562949f},
-std::array<float,2>{0.600967348f, 0.543238819f},
-std::array<float,2>{0.346497685f, 0.113188639f},
-std::array<float,2>{0.1466894f, 0.840179503f},
-std::array<float,2>{0.76762861f, 0.469495714f},
-std::array<float,2>{0.899818718f, 0.617993891f},
-std::array<float,2>{0.0367953815f, 0.0233785696f},
-std::array<float,2>{0.46004355f, 0.786184072f},
-std::array<float,2>{0.634634793f, 0.423585355f},
-std::array<float,2>{0.534809947f, 0.92386049f},
-std::array<float,2>{0.298440546f, 0.323565632f},
-std::array<float,2>{0.248078689f, 0.686036348f},
-std::array<float,2>{0.848629117f, 0.21495305f},
-std::array<float,2>{0.803712666f, 0.867264688f},
-std::array<float,2>{0.183588386f, 0.456061155f},
-std::array<float,2>{0.325327009f, 0.525457382f},
-std::array<float,2>{0.573135674f, 0.0666313469f},
-std::array<float,2>{0.706261456f, 0.719277203f},
-std::array<float,2>{0.399220705f, 0.130908072f},
-std::array<float,2>{0.0675687194f, 0.944727242f},
-std::array<float,2>{0.984804034f, 0.268715292f},
-std::array<float,2>{0.97049427f, 0.699078918f},
-std::array<float,2>{0.0922658294f, 0.158932641f},
-std::array<float,2>{0.390124947f, 0.993893743f},
-std::array<float,2>{0.697097778f, 0.309133649f},
-std::array<float,2>{0.588826954f, 0.819638252f},
-std::array<float,2>{0.331947237f, 0.496168166f},
-std::array<float,2>{0.17077738f, 0.552598476f},
-std::array<float,2>{0.785714328f, 0.0944134146f},
-std::array<float,2>{0.874358594f, 0.891340196f},
-std::array<float,2>{0.22618258f, 0.352829933f},
-std::array<float,2>{0.292742431f, 0.635143578f},
-std::array<float,2>{0.558142126f, 0.226114675f},
-std::array<float,2>{0.650648534f, 0.576470494f},
-std::array<float,2>{0.44033128f, 0.0427916385f},
-std::array<float,2>{0.0592319593f, 0.775152624f},
-std::array<float,2>{0.877468944f, 0.400354147f},
-std::array<float,2>{0.761823714f, 0.508809507f},
-std::array<float,2>{0.139885411f, 0.0864863694f},
-std::array<float,2>{0.36920625f, 0.856232703f},
-std::array<float,2>{0.610562623f, 0.445287764f},
-std::array<float,2>{0.742147386f, 0.968026221f},
-std::array<float,2>{0.425784111f, 0.251392335f},
-std::array<float,2>{0.0937579274f, 0.736073971f},
-std::array<float,2>{0.942010522f, 0.151264474f},
-std::array<float,2>{0.930006444f, 0.812156856f},
-std::array<float,2>{0.00850887597f, 0.420652956f},
-std::array<float,2>{0.495662391f, 0.595282495f},
-std::array<float,2>{0.666595697f, 0.00681867916f},
-std::array<float,2>{0.504094958f, 0.663215816f},
-std::array<float,2>{0.255968481f, 0.190244421f},
-std::array<float,2>{0.204721525f, 0.921617329f},
-std::array<float,2>{0.818127871f, 0.340636402f},
-std::array<float,2>{0.7919963f, 0.746958852f},
-std::array<float,2>{0.159904391f, 0.143604606f},
-std::array<float,2>{0.338317156f, 0.954696357f},
-std::array<float,2>{0.581643641f, 0.258703381f},
-std::array<float,2>{0.694913507f, 0.846628726f},
-std::array<float,2>{0.375029236f, 0.448972404f},
-std::array<float,2>{0.0806917399f, 0.503596961f},
-std::array<float,2>{0.980360866f, 0.0817939937f},
-std::array<float,2>{0.888037086f, 0.912836254f},
-std::array<float,2>{0.0480541363f, 0.328649074f},
-std::array<float,2>{0.447902054f, 0.666490614f},
-std::array<float,2>{0.643002391f, 0.201237306f},
-std::array<float,2>{0.550827384f, 0.602446496f},
-std::array<float,2>{0.288144112f, 0.0146973617f},
-std::array<float,2>{0.231606051f, 0.800180852f},
-std::array<float,2>{0.866128862f, 0.413244188f},
-std::array<float,2>{0.947499514f, 0.55656898f},
-std::array<float,2>{0.103549756f, 0.106428735f},
-std::array<float,2>{0.436229527f, 0.822813213f},
-std::array<float,2>{0.744886339f, 0.487637609f},
-std::array<float,2>{0.618561566f, 0.984406829f},
-std::array<float,2>{0.365568459f, 0.299287736f},
-std::array<float,2>{0.127028078f, 0.692444384f},
-std::array<float,2>{0.750387549f, 0.168693542f},
-std::array<float,2>{0.824091613f, 0.769160867f},
-std::array<float,2>{0.21198386f, 0.392524272f},
-std::array<float,2>{0.258759826f, 0.56815964f},
-std::array<float,2>{0.512763083f, 0.0363856331f},
-std::array<float,2>{0.662046552f, 0.630302191f},
-std::array<float,2>{0.484499454f, 0.234018549f},
-std::array<float,2>{0.00551077537f, 0.89896065f},
-std::array<float,2>{0.928351998f, 0.344276398f},
-std::array<float,2>{0.920051336f, 0.677376211f},
-std::array<float,2>{0.0279792435f, 0.208561614f},
-std::array<float,2>{0.473360389f, 0.9346838f},
-std::array<float,2>{0.685076654f, 0.3168706f},
-std::array<float,2>{0.528457999f, 0.789588451f},
-std::array<float,2>{0.278685689f, 0.437408775f},
-std::array<float,2>{0.198734716f, 0.614078224f},
-std::array<float,2>{0.834430754f, 0.0263513196f},
-std::array<float,2>{0.77899158f, 0.948726177f},
-std::array<float,2>{0.149871245f, 0.278496623f},
-std::array<float,2>{0.355466574f, 0.733655095f},
-std::array<float,2>{0.604220748f, 0.134836897f},
-std::array<float,2>{0.723129988f, 0.522893727f},
-std::array<float,2>{0.41317752f, 0.0704253986f},
-std::array<float,2>{0.113152206f, 0.860720575f},
-std::array<float,2>{0.960405529f, 0.462542832f},
-std::array<float,2>{0.858020723f, 0.590689182f},
-std::array<float,2>{0.237331912f, 0.0480688997f},
-std::array<float,2>{0.310724825f, 0.765349686f},
-std::array<float,2>{0.543262005f, 0.387047172f},
-std::array<float,2>{0.631970644f, 0.884583235f},
-std::array<float,2>{0.463670731f, 0.371133268f},
-std::array<float,2>{0.04498294f, 0.656031072f},
-std::array<float,2>{0.892927527f, 0.24185431f},
-std::array<float,2>{0.995631158f, 0.829742372f},
-std::array<float,2>{0.0764001906f, 0.478605628f},
-std::array<float,2>{0.390689135f, 0.538315952f},
-std::array<float,2>{0.713614583f, 0.120927751f},
-std::array<float,2>{0.562674165f, 0.712029457f},
-std::array<float,2>{0.313485593f, 0.176877528f},
-std::array<float,2>{0.178237692f, 0.970212281f},
-std::array<float,2>{0.809539855f, 0.291456074f},
-std::array<float,2>{0.860407412f, 0.70764327f},
-std::array<float,2>{0.230238438f, 0.187124327f},
-std::array<float,2>{0.283917129f, 0.982419014f},
-std::array<float,2>{0.548399091f, 0.282999009f},
-std::array<float,2>{0.648061991f, 0.838641047f},
-std::array<float,2>{0.449529529f, 0.473297566f},
-std::array<float,2>{0.0517466478f, 0.541066527f},
-std::array<float,2>{0.88364774f, 0.115893893f},
-std::array<float,2>{0.983476281f, 0.879315495f},
-std::array<float,2>{0.0828106627f, 0.363451362f},
-std::array<float,2>{0.382283866f, 0.644298136f},
-std::array<float,2>{0.689607739f, 0.248795792f},
-std::array<float,2>{0.583357334f, 0.580627561f},
-std::array<float,2>{0.342396706f, 0.0596102625f},
-std::array<float,2>{0.1638228f, 0.753975034f},
-std::array<float,2>{0.796758115f, 0.379569322f},
-std::array<float,2>{0.924178958f, 0.529752553f},
-std::array<float,2>{0.00282784458f, 0.0649611875f},
-std::array<float,2>{0.489950299f, 0.871715188f},
-std::array<float,2>{0.659448743f, 0.460300028f},
-std::array<float,2>{0.507852912f, 0.937787175f},
-std::array<float,2>{0.263661057f, 0.27151528f},
-std::array<float,2>{0.21681495f, 0.723522842f},
-std::array<float,2>{0.826666474f, 0.126139536f},
-std::array<float,2>{0.756031632f, 0.781442642f},
-std::array<float,2>{0.129447609f, 0.427788854f},
-std::array<float,2>{0.360118032f, 0.622815192f},
-std::array<float,2>{0.621994019f, 0.0172921531f},
-std::array<float,2>{0.749764502f, 0.682952225f},
-std::array<float,2>{0.431392878f, 0.211862266f},
-std::array<float,2>{0.107409984f, 0.928969264f},
-std::array<float,2>{0.949629724f, 0.326459795f},
-std::array<float,2>{0.954562604f, 0.638430953f},
-std::array<float,2>{0.114995167f, 0.221270025f},
-std::array<float,2>{0.408619463f, 0.895359635f},
-std::array<float,2>{0.722058058f, 0.358303875f},
-std::array<float,2>{0.605984569f, 0.777648091f},
-std::array<float,2>{0.359013587f, 0.402549326f},
-std::array<float,2>{0.15479818f, 0.573898196f},
-std::array<float,2>{0.775663078f, 0.0443567783f},
-std::array<float,2>{0.829041362f, 0.998656631f},
-std::array<float,2>{0.201914236f, 0.305715412f},
-std::array<float,2>{0.274532139f, 0.700895429f},
-std::array<float,2>{0.525337696f, 0.162735209f},
-std::array<float,2>{0.682165742f, 0.550121009f},
-std::array<float,2>{0.470658749f, 0.098354578f},
-std::array<float,2>{0.0248542484f, 0.815885127f},
-std::array<float,2>{0.917441547f, 0.495171726f},
-std::array<float,2>{0.80679369f, 0.597926557f},
-std::array<float,2>{0.172819436f, 0.00360951899f},
-std::array<float,2>{0.320081264f, 0.804944515f},
-std::array<float,2>{0.567747831f, 0.416566312f},
-std::array<float,2>{0.715722501f, 0.917469919f},
-std::array<float,2>{0.396170676f, 0.337799281f},
-std::array<float,2>{0.0703238621f, 0.65999943f},
-std::array<float,2>{0.997864306f, 0.191990808f},
-std::array<float,2>{0.895211041f, 0.854253829f},
-std::array<float,2>{0.0395645499f, 0.440105587f},
-std::array<float,2>{0.468182743f, 0.514027834f},
-std::array<float,2>{0.627252042f, 0.0937321559f},
-std::array<float,2>{0.540457189f, 0.740741432f},
-std::array<float,2>{0.306902736f, 0.152455956f},
-std::array<float,2>{0.238795146f, 0.961653888f},
-std::array<float,2>{0.853959918f, 0.253942341f},
-std::array<float,2>{0.772207737f, 0.668316901f},
-std::array<float,2>{0.143593609f, 0.198432729f},
-std::array<float,2>{0.348928928f, 0.909713864f},
-std::array<float,2>{0.595479012f, 0.335130721f},
-std::array<float,2>{0.729653895f, 0.802854836f},
-std::array<float,2>{0.418717325f, 0.406603992f},
-std::array<float,2>{0.121003598f, 0.606690586f},
-std::array<float,2>{0.962543488f, 0.0107551692f},
-std::array<float,2>{0.913437366f, 0.958143413f},
-std::array<float,2>{0.0187173653f, 0.264280736f},
-std::array<float,2>{0.481328428f, 0.743593812f},
-std::array<float,2>{0.672343314f, 0.147658437f},
-std::array<float,2>{0.517920256f, 0.506082535f},
-std::array<float,2>{0.272071391f, 0.0829232857f},
-std::array<float,2>{0.188815877f, 0.847931921f},
-std::array<float,2>{0.839695334f, 0.451567918f},
-std::array<float,2>{0.991950333f, 0.562888622f},
-std::array<float,2>{0.0646834746f, 0.031963028f},
-std::array<float,2>{0.403814197f, 0.771991909f},
-std::array<float,2>{0.709452748f, 0.398128837f},
-std::array<float,2>{0.576417208f, 0.90557611f},
-std::array<float,2>{0.322115302f, 0.348028421f},
-std::array<float,2>{0.186812922f, 0.626368344f},
-std::array<float,2>{0.799097657f, 0.230196103f},
-std::array<float,2>{0.847633958f, 0.824462295f},
-std::array<float,2>{0.245391443f, 0.490904987f},
-std::array<float,2>{0.30463931f, 0.559491515f},
-std::array<float,2>{0.538992107f, 0.102666423f},
-std::array<float,2>{0.639633954f, 0.68869549f},
-std::array<float,2>{0.453152657f, 0.166966185f},
-std::array<float,2>{0.0313445553f, 0.989414573f},
-std::array<float,2>{0.902473092f, 0.304214567f},
-std::array<float,2>{0.881959617f, 0.727048576f},
-std::array<float,2>{0.0561314486f, 0.139766619f},
-std::array<float,2>{0.444423467f, 0.952901483f},
-std::array<float,2>{0.655309618f, 0.275121987f},
-std::array<float,2>{0.559050798f, 0.863858044f},
-std::array<float,2>{0.295922458f, 0.466563523f},
-std::array<float,2>{0.222075164f, 0.515853047f},
-std::array<float,2>{0.868806899f, 0.0759404376f},
-std::array<float,2>{0.782796979f, 0.931664467f},
-std::array<float,2>{0.167436212f, 0.313643456f},
-std::array<float,2>{0.332774818f, 0.674571693f},
-std::array<float,2>{0.593506277f, 0.206576332f},
-std::array<float,2>{0.701046526f, 0.612906575f},
-std::array<float,2>{0.382911384f, 0.0278524421f},
-std::array<float,2>{0.0895143524f, 0.793674111f},
-std::array<float,2>{0.97597003f, 0.430099547f},
-std::array<float,2>{0.814037681f, 0.533836782f},
-std::array<float,2>{0.209411591f, 0.123497911f},
-std::array<float,2>{0.250932485f, 0.832517624f},
-std::array<float,2>{0.50080198f, 0.483436853f},
-std::array<float,2>{0.670955002f, 0.973446071f},
-std::array<float,2>{0.498870313f, 0.296719223f},
-std::array<float,2>{0.0142894052f, 0.718519926f},
-std::array<float,2>{0.934493899f, 0.175411507f},
-std::array<float,2>{0.941404283f, 0.759432852f},
-std::array<float,2>{0.0985776708f, 0.383250743f},
-std::array<float,2>{0.42384699f, 0.587903798f},
-std::array<float,2>{0.737355113f, 0.0508088954f},
-std::array<float,2>{0.616335452f, 0.651091635f},
-std::array<float,2>{0.372257203f, 0.235203415f},
-std::array<float,2>{0.133341178f, 0.890337229f},
-std::array<float,2>{0.758874416f, 0.369840741f},
-std::array<float,2>{0.849709392f, 0.683787167f},
-std::array<float,2>{0.247928813f, 0.218108788f},
-std::array<float,2>{0.299190611f, 0.921964586f},
-std::array<float,2>{0.533182442f, 0.320629448f},
-std::array<float,2>{0.636101663f, 0.788833857f},
-std::array<float,2>{0.458139002f, 0.424223572f},
-std::array<float,2>{0.0386387818f, 0.620207846f},
-std::array<float,2>{0.902240336f, 0.0199421756f},
-std::array<float,2>{0.987542093f, 0.941969991f},
-std::array<float,2>{0.0689122751f, 0.26642707f},
-std::array<float,2>{0.400833488f, 0.721574724f},
-std::array<float,2>{0.703749955f, 0.130626097f},
-std::array<float,2>{0.571635783f, 0.525013745f},
-std::array<float,2>{0.326684237f, 0.0686415136f},
-std::array<float,2>{0.181266606f, 0.86922437f},
-std::array<float,2>{0.802540481f, 0.453286409f},
-std::array<float,2>{0.907511353f, 0.585850954f},
-std::array<float,2>{0.0227920972f, 0.0583908483f},
-std::array<float,2>{0.477213621f, 0.750374079f},
-std::array<float,2>{0.676601887f, 0.375999093f},
-std::array<float,2>{0.520884633f, 0.87866199f},
-std::array<float,2>{0.267517895f, 0.36020723f},
-std::array<float,2>{0.19319427f, 0.645056069f},
-std::array<float,2>{0.84265244f, 0.243252531f},
-std::array<float,2>{0.766049385f, 0.842165232f},
-std::array<float,2>{0.144721508f, 0.47136721f},
-std::array<float,2>{0.344869584f, 0.546257615f},
-std::array<float,2>{0.598416448f, 0.110079177f},
-std::array<float,2>{0.732302189f, 0.70350033f},
-std::array<float,2>{0.414951354f, 0.180695385f},
-std::array<float,2>{0.123760007f, 0.978525043f},
-std::array<float,2>{0.966030538f, 0.288022131f},
-std::array<float,2>{0.943395317f, 0.737316966f},
-std::array<float,2>{0.0960927457f, 0.149361104f},
-std::array<float,2>{0.428498805f, 0.96567452f},
-std::array<float,2>{0.739498377f, 0.253606588f},
-std::array<float,2>{0.612580538f, 0.857915342f},
-std::array<float,2>{0.367854357f, 0.441538155f},
-std::array<float,2>{0.138510883f, 0.511054516f},
-std::array<float,2>{0.764904439f, 0.0896145329f},
-std::array<float,2>{0.818416834f, 0.919092715f},
-std::array<float,2>{0.20516035f, 0.342494279f},
-std::array<float,2>{0.254307628f, 0.661339045f},
-std::array<float,2>{0.507368386f, 0.187610507f},
-std::array<float,2>{0.664926112f, 0.596518815f},
-std::array<float,2>{0.492722034f, 0.00411946001f},
-std::array<float,2>{0.0108131329f, 0.810076356f},
-std::array<float,2>{0.93217814f, 0.419553638f},
-std::array<float,2>{0.788015664f, 0.552938759f},
-std::array<float,2>{0.169332281f, 0.0958837122f},
-std::array<float,2>{0.329256147f, 0.817495406f},
-std::array<float,2>{0.587030113f, 0.498171985f},
-std::array<float,2>{0.698619246f, 0.994290769f},
-std::array<float,2>{0.387181371f, 0.310564935f},
-std::array<float,2>{0.0915120095f, 0.695963264f},
-std::array<float,2>{0.971489608f, 0.157380506f},
-std::array<float,2>{0.876042426f, 0.776338577f},
-std::array<float,2>{0.0617214441f, 0.401373774f},
-std::array<float,2>{0.437524557f, 0.574797928f},
-std::array<float,2>{0.648745179f, 0.0400548242f},
-std::array<float,2>{0.55560708f, 0.63380152f},
-std::array<float,2>{0.290717304f, 0.224308878f},
-std::array<float,2>{0.223989263f, 0.894056797f},
-std::array<float,2>{0.871225119f, 0.35466522f},
-std::array<float,2>{0.753369749f, 0.694561064f},
-std::array<float,2>{0.126070037f, 0.171173111f},
-std::array<float,2>{0.364685357f, 0.987036347f},
-std::array<float,2>{0.620209217f, 0.297522604f},
-std::array<float,2>{0.742319107f, 0.821822703f},
-std::array<float,2>{0.433809221f, 0.48600322f},
-std::array<float,2>{0.102095611f, 0.558350682f},
-std::array<float,2>{0.945862532f, 0.108586453f},
-std::array<float,2>{0.925917208f, 0.901592553f},
-std::array<float,2>{0.00728945108f, 0.34669894f},
-std::array<float,2>{0.486545056f, 0.632402718f},
-std::array<float,2>{0.662310004f, 0.230966806f},
-std::array<float,2>{0.514243782f, 0.569896162f},
-std::array<float,2>{0.261026859f, 0.0389413051f},
-std::array<float,2>{0.214825705f, 0.767546654f},
-std::array<float,2>{0.821098208f, 0.394057184f},
-std::array<float,2>{0.976789653f, 0.501604497f},
-std::array<float,2>{0.0794194788f, 0.0797158852f},
-std::array<float,2>{0.377476096f, 0.843881667f},
-std::array<float,2>{0.691877484f, 0.446792275f},
-std::array<float,2>{0.578994274f, 0.955783784f},
-std::array<float,2>{0.337234825f, 0.260946959f},
-std::array<float,2>{0.157800704f, 0.748221457f},
-std::array<float,2>{0.789213002f, 0.141402453f},
-std::array<float,2>{0.865067899f, 0.79873836f},
-std::array<float,2>{0.232729495f, 0.410526156f},
-std::array<float,2>{0.285885632f, 0.605296314f},
-std::array<float,2>{0.55341804f, 0.0127139119f},
-std::array<float,2>{0.641956687f, 0.664622307f},
-std::array<float,2>{0.445691258f, 0.200073153f},
-std::array<float,2>{0.0502540879f, 0.910544157f},
-std::array<float,2>{0.890503109f, 0.330673903f},
-std::array<float,2>{0.892099082f, 0.65296644f},
-std::array<float,2>{0.0441274568f, 0.240149021f},
-std::array<float,2>{0.461569279f, 0.886609674f},
-std::array<float,2>{0.629555285f, 0.374785185f},
-std::array<float,2>{0.545593381f, 0.762550652f},
-std::array<float,2>{0.309018284f, 0.389964938f},
-std::array<float,2>{0.235545278f, 0.592253745f},
-std::array<float,2>{0.85580498f, 0.0501536205f},
-std::array<float,2>{0.812297344f, 0.972177267f},
-std::array<float,2>{0.176722974f, 0.289330751f},
-std::array<float,2>{0.315417647f, 0.71295619f},
-std::array<float,2>{0.565655053f, 0.178103164f},
-std::array<float,2>{0.712487817f, 0.536687374f},
-std::array<float,2>{0.392683446f, 0.118410416f},
-std::array<float,2>{0.0746508166f, 0.83060497f},
-std::array<float,2>{0.992961884f, 0.478199929f},
-std::array<float,2>{0.833372414f, 0.61692512f},
-std::array<float,2>{0.196661815f, 0.024418639f},
-std::array<float,2>{0.281057626f, 0.792927861f},
-std::array<float,2>{0.530216992f, 0.433754057f},
-std::array<float,2>{0.687053442f, 0.937388301f},
-std::array<float,2>{0.476463884f, 0.319163471f},
-std::array<float,2>{0.0310618915f, 0.679081798f},
-std::array<float,2>{0.919326365f, 0.209277481f},
-std::array<float,2>{0.95882684f, 0.861616194f},
-std::array<float,2>{0.110102437f, 0.463016778f},
-std::array<float,2>{0.412107408f, 0.519647121f},
-std::array<float,2>{0.72653985f, 0.0734092221f},
-std::array<float,2>{0.602437377f, 0.732222676f},
-std::array<float,2>{0.352368355f, 0.133464307f},
-std::array<float,2>{0.151975781f, 0.945886791f},
-std::array<float,2>{0.779960155f, 0.279528588f},
-std::array<float,2>{0.824569106f, 0.724840641f},
-std::array<float,2>{0.216049984f, 0.128395185f},
-std::array<float,2>{0.265179098f, 0.940749228f},
-std::array<float,2>{0.510366023f, 0.270097822f},
-std::array<float,2>{0.656390071f, 0.874168754f},
-std::array<float,2>{0.490447074f, 0.457295239f},
-std::array<float,2>{0.000721152406f, 0.528376698f},
-std::array<float,2>{0.922775269f, 0.0632689819f},
-std::array<float,2>{0.952416182f, 0.926365256f},
-std::array<float,2>{0.108209401f, 0.32561186f},
-std::array<float,2>{0.432773232f, 0.680473983f},
-std::array<float,2>{0.747300029f, 0.213771701f},
-std::array<float,2>{0.623610854f, 0.624743998f},
-std::array<float,2>{0.362132967f, 0.0194344707f},
-std::array<float,2>{0.131224662f, 0.785064518f},
-std::array<float,2>{0.755792081f, 0.426576734f},
-std::array<float,2>{0.8854087f, 0.54006815f},
-std::array<float,2>{0.0527763031f, 0.114119984f},
-std::array<float,2>{0.452849776f, 0.837384403f},
-std::array<float,2>{0.645163357f, 0.475069851f},
-std::array<float,2>{0.549917758f, 0.98360455f},
-std::array<float,2>{0.28195101f, 0.284472376f},
-std::array<float,2>{0.227854148f, 0.709138572f},
-std::array<float,2>{0.862134755f, 0.183637172f},
-std::array<float,2>{0.793118656f, 0.756316364f},
-std::array<float,2>{0.161911771f, 0.381609589f},
-std::array<float,2>{0.34117797f, 0.57978189f},
-std::array<float,2>{0.585074127f, 0.0624468997f},
-std::array<float,2>{0.689430416f, 0.641745925f},
-std::array<float,2>{0.379674196f, 0.247079894f},
-std::array<float,2>{0.0840354785f, 0.88095659f},
-std::array<float,2>{0.981388688f, 0.366544515f},
-std::array<float,2>{0.999654293f, 0.656910062f},
-std::array<float,2>{0.0730487481f, 0.193698764f},
-std::array<float,2>{0.397410542f, 0.914313376f},
-std::array<float,2>{0.717779279f, 0.338941842f},
-std::array<float,2>{0.570125878f, 0.808538258f},
-std::array<float,2>{0.317797363f, 0.414356321f},
-std::array<float,2>{0.174303055f, 0.601014197f},
-std::array<float,2>{0.806113362f, 0.00131452864f},
-std::array<float,2>{0.853492677f, 0.963516474f},
-std::array<float,2>{0.241828203f, 0.257742882f},
-std::array<float,2>{0.305180967f, 0.7384215f},
-std::array<float,2>{0.541940928f, 0.154610902f},
-std::array<float,2>{0.625384152f, 0.513449132f},
-std::array<float,2>{0.466364413f, 0.0906788334f},
-std::array<float,2>{0.0415453427f, 0.853489518f},
-std::array<float,2>{0.896950662f, 0.439059883f},
-std::array<float,2>{0.773998141f, 0.571573317f},
-std::array<float,2>{0.154058114f, 0.0456058942f},
-std::array<float,2>{0.356167048f, 0.780716181f},
-std::array<float,2>{0.608659029f, 0.405327886f},
-std::array<float,2>{0.719526947f, 0.897184372f},
-std::array<float,2>{0.40634799f, 0.35657379f},
-std::array<float,2>{0.116877556f, 0.640457809f},
-std::array<float,2>{0.9558779f, 0.218944535f},
-std::array<float,2>{0.914459705f, 0.813520133f},
-std::array<float,2>{0.0257422421f, 0.492510855f},
-std::array<float,2>{0.47245574f, 0.547322512f},
-std::array<float,2>{0.681494892f, 0.101473145f},
-std::array<float,2>{0.527123749f, 0.701626599f},
-std::array<float,2>{0.277202934f, 0.161559507f},
-std::array<float,2>{0.199228644f, 0.996616542f},
-std::array<float,2>{0.83126688f, 0.307946235f},
-std::array<float,2>{0.797020555f, 0.627850831f},
-std::array<float,2>{0.185396835f, 0.228477925f},
-std::array<float,2>{0.322830051f, 0.902750611f},
-std::array<float,2>{0.575025737f, 0.349816859f},
-std::array<float,2>{0.707942247f, 0.77053982f},
-std::array<float,2>{0.404889315f, 0.39629212f},
-std::array<float,2>{0.0644410327f, 0.566152871f},
-std::array<float,2>{0.99023205f, 0.0332573652f},
-std::array<float,2>{0.90509975f, 0.990291417f},
-std::array<float,2>{0.0342757367f, 0.302211493f},
-std::array<float,2>{0.456822872f, 0.691323102f},
-std::array<float,2>{0.637976408f, 0.164674684f},
-std::array<float,2>{0.535269082f, 0.5624668f},
-std::array<float,2>{0.302135855f, 0.104615778f},
-std::array<float,2>{0.24350211f, 0.826930702f},
-std::array<float,2>{0.844431579f, 0.489265919f},
-std::array<float,2>{0.964435458f, 0.607795417f},
-std::array<float,2>{0.117472842f, 0.00797188468f},
-std::array<float,2>{0.421358049f, 0.801425695f},
-std::array<float,2>{0.728340089f, 0.409508437f},
-std::array<float,2>{0.597436666f, 0.90675503f},
-std::array<float,2>{0.350924641f, 0.332541376f},
-std::array<float,2>{0.142010376f, 0.670470059f},
-std::array<float,2>{0.771235645f, 0.196430936f},
-std::array<float,2>{0.836160898f, 0.849825978f},
-std::array<float,2>{0.190564409f, 0.449988335f},
-std::array<float,2>{0.270634472f, 0.505777299f},
-std::array<float,2>{0.515773714f, 0.0841915905f},
-std::array<float,2>{0.675052822f, 0.744521618f},
-std::array<float,2>{0.483412862f, 0.144914791f},
-std::array<float,2>{0.0166040659f, 0.959501505f},
-std::array<float,2>{0.910938203f, 0.261934191f},
-std::array<float,2>{0.937122226f, 0.715183139f},
-std::array<float,2>{0.0118436981f, 0.172391489f},
-std::array<float,2>{0.496703535f, 0.976163566f},
-std::array<float,2>{0.669533193f, 0.293209046f},
-std::array<float,2>{0.502554238f, 0.834548175f},
-std::array<float,2>{0.253828764f, 0.480503708f},
-std::array<float,2>{0.207262799f, 0.532098293f},
-std::array<float,2>{0.815032125f, 0.122150652f},
-std::array<float,2>{0.761036873f, 0.886884987f},
-std::array<float,2>{0.136597052f, 0.367970526f},
-std::array<float,2>{0.373292655f, 0.649794519f},
-std::array<float,2>{0.614242494f, 0.236468926f},
-std::array<float,2>{0.735800087f, 0.587880373f},
-std::array<float,2>{0.421932697f, 0.0534536391f},
-std::array<float,2>{0.101148896f, 0.761165202f},
-std::array<float,2>{0.938628197f, 0.384910405f},
-std::array<float,2>{0.870300174f, 0.518504322f},
-std::array<float,2>{0.218840271f, 0.0771582052f},
-std::array<float,2>{0.294691026f, 0.865717471f},
-std::array<float,2>{0.561994612f, 0.467065841f},
-std::array<float,2>{0.65345329f, 0.950239956f},
-std::array<float,2>{0.442503244f, 0.275682896f},
-std::array<float,2>{0.0578262545f, 0.728567481f},
-std::array<float,2>{0.880436778f, 0.137114704f},
-std::array<float,2>{0.974030375f, 0.795231342f},
-std::array<float,2>{0.0859970599f, 0.432021618f},
-std::array<float,2>{0.385553926f, 0.611304998f},
-std::array<float,2>{0.702358902f, 0.0303018335f},
-std::array<float,2>{0.589911819f, 0.672003627f},
-std::array<float,2>{0.335730255f, 0.203479692f},
-std::array<float,2>{0.16453658f, 0.931371152f},
-std::array<float,2>{0.785117865f, 0.315640509f},
-std::array<float,2>{0.834533036f, 0.679518819f},
-std::array<float,2>{0.198295236f, 0.209897578f},
-std::array<float,2>{0.279102385f, 0.936885357f},
-std::array<float,2>{0.52901727f, 0.318748355f},
-std::array<float,2>{0.684883296f, 0.792303443f},
-std::array<float,2>{0.472811669f, 0.434139937f},
-std::array<float,2>{0.0276575871f, 0.61624974f},
-std::array<float,2>{0.92068249f, 0.0251873899f},
-std::array<float,2>{0.960806727f, 0.945590436f},
-std::array<float,2>{0.112523027f, 0.280180067f},
-std::array<float,2>{0.413719952f, 0.73181957f},
-std::array<float,2>{0.72339952f, 0.133090153f},
-std::array<float,2>{0.603946686f, 0.520067036f},
-std::array<float,2>{0.354882449f, 0.0739453509f},
-std::array<float,2>{0.150288671f, 0.861898482f},
-std::array<float,2>{0.778793216f, 0.463396519f},
-std::array<float,2>{0.893519998f, 0.592392564f},
-std::array<float,2>{0.0454439148f, 0.0506605431f},
-std::array<float,2>{0.463339657f, 0.762163281f},
-std::array<float,2>{0.632483542f, 0.390157938f},
-std::array<float,2>{0.543808341f, 0.885810018f},
-std::array<float,2>{0.311134279f, 0.374096543f},
-std::array<float,2>{0.238203689f, 0.652697265f},
-std::array<float,2>{0.857447028f, 0.23949407f},
-std::array<float,2>{0.808625638f, 0.830495358f},
-std::array<float,2>{0.177844018f, 0.477857351f},
-std::array<float,2>{0.314013213f, 0.536506057f},
-std::array<float,2>{0.563287079f, 0.118809275f},
-std::array<float,2>{0.713127851f, 0.713492095f},
-std::array<float,2>{0.391211271f, 0.178308696f},
-std::array<float,2>{0.0771012455f, 0.971875906f},
-std::array<float,2>{0.995287776f, 0.289775252f},
-std::array<float,2>{0.979817212f, 0.749001563f},
-std::array<float,2>{0.0805492774f, 0.141111478f},
-std::array<float,2>{0.375560015f, 0.955197334f},
-std::array<float,2>{0.694534957f, 0.261584818f},
-std::array<float,2>{0.581244171f, 0.844350934f},
-std::array<float,2>{0.33847636f, 0.446658313f},
-std::array<float,2>{0.159390807f, 0.501380801f},
-std::array<float,2>{0.792595267f, 0.0792196393f},
-std::array<float,2>{0.865474403f, 0.910798967f},
-std::array<float,2>{0.231955349f, 0.330236971f},
-std::array<float,2>{0.288638473f, 0.664259911f},
-std::array<float,2>{0.551663518f, 0.199696034f},
-std::array<float,2>{0.643271685f, 0.604800045f},
-std::array<float,2>{0.447287828f, 0.0131909158f},
-std::array<float,2>{0.0487736091f, 0.798045874f},
-std::array<float,2>{0.888398767f, 0.410891384f},
-std::array<float,2>{0.750923216f, 0.557816386f},
-std::array<float,2>{0.127541333f, 0.109141022f},
-std::array<float,2>{0.366023958f, 0.821327984f},
-std::array<float,2>{0.61896795f, 0.485364735f},
-std::array<float,2>{0.744264066f, 0.986347675f},
-std::array<float,2>{0.435823083f, 0.29721567f},
-std::array<float,2>{0.104121737f, 0.694884956f},
-std::array<float,2>{0.947912157f, 0.17167592f},
-std::array<float,2>{0.927903652f, 0.766960919f},
-std::array<float,2>{0.00527467625f, 0.393894315f},
-std::array<float,2>{0.485188186f, 0.569710076f},
-std::array<float,2>{0.6612764f, 0.0385216996f},
-std::array<float,2>{0.513655543f, 0.632039845f},
-std::array<float,2>{0.258037835f, 0.230830938f},
-std::array<float,2>{0.212420553f, 0.901863933f},
-std::array<float,2>{0.823362827f, 0.34724465f},
-std::array<float,2>{0.785603881f, 0.695366561f},
-std::array<float,2>{0.170165032f, 0.157998055f},
-std::array<float,2>{0.331235617f, 0.994858921f},
-std::array<float,2>{0.588266909f, 0.311311126f},
-std::array<float,2>{0.69655937f, 0.818129957f},
-std::array<float,2>{0.390270293f, 0.498780459f},
-std::array<float,2>{0.092737779f, 0.553495109f},
-std::array<float,2>{0.970014632f, 0.0965318531f},
-std::array<float,2>{0.87713033f, 0.893759549f},
-std::array<float,2>{0.0589611232f, 0.355183601f},
-std::array<float,2>{0.439495474f, 0.634483516f},
-std::array<float,2>{0.651215017f, 0.223944351f},
-std::array<float,2>{0.558027029f, 0.574611843f},
-std::array<float,2>{0.292449534f, 0.0407161824f},
-std::array<float,2>{0.225926653f, 0.775458634f},
-std::array<float,2>{0.874880373f, 0.402004421f},
-std::array<float,2>{0.941601574f, 0.511581361f},
-std::array<float,2>{0.0945281535f, 0.0890368372f},
-std::array<float,2>{0.426621616f, 0.857517421f},
-std::array<float,2>{0.741354704f, 0.4421615f},
-std::array<float,2>{0.611255169f, 0.965088606f},
-std::array<float,2>{0.369746327f, 0.2532866f},
-std::array<float,2>{0.140560865f, 0.738239169f},
-std::array<float,2>{0.762468278f, 0.148870721f},
-std::array<float,2>{0.817824602f, 0.80998683f},
-std::array<float,2>{0.20420064f, 0.419078648f},
-std::array<float,2>{0.256770849f, 0.59597981f},
-std::array<float,2>{0.504433453f, 0.00464863516f},
-std::array<float,2>{0.666309595f, 0.661936581f},
-std::array<float,2>{0.495155931f, 0.188235343f},
-std::array<float,2>{0.00817938056f, 0.919466615f},
-std::array<float,2>{0.930547118f, 0.34215799f},
-std::array<float,2>{0.908305287f, 0.644821942f},
-std::array<float,2>{0.0213045049f, 0.243669406f},
-std::array<float,2>{0.479672313f, 0.878369629f},
-std::array<float,2>{0.677781641f, 0.359548062f},
-std::array<float,2>{0.523026764f, 0.750591457f},
-std::array<float,2>{0.268393576f, 0.376676589f},
-std::array<float,2>{0.194437891f, 0.585312605f},
-std::array<float,2>{0.84125632f, 0.0579136461f},
-std::array<float,2>{0.76812464f, 0.979443371f},
-std::array<float,2>{0.147378668f, 0.287584066f},
-std::array<float,2>{0.345833123f, 0.703798592f},
-std::array<float,2>{0.60134238f, 0.18144533f},
-std::array<float,2>{0.734205604f, 0.546541333f},
-std::array<float,2>{0.41626057f, 0.109816372f},
-std::array<float,2>{0.122783445f, 0.84265995f},
-std::array<float,2>{0.968469739f, 0.47078687f},
-std::array<float,2>{0.848022163f, 0.620990217f},
-std::array<float,2>{0.248647943f, 0.0202784985f},
-std::array<float,2>{0.298059016f, 0.788564801f},
-std::array<float,2>{0.534570158f, 0.424408466f},
-std::array<float,2>{0.634153306f, 0.922668815f},
-std::array<float,2>{0.460636973f, 0.321137458f},
-std::array<float,2>{0.0361372828f, 0.684332967f},
-std::array<float,2>{0.900224507f, 0.218348116f},
-std::array<float,2>{0.984872878f, 0.869702041f},
-std::array<float,2>{0.0679676682f, 0.453679442f},
-std::array<float,2>{0.398769289f, 0.52467674f},
-std::array<float,2>{0.706842482f, 0.0689348429f},
-std::array<float,2>{0.572395861f, 0.720825016f},
-std::array<float,2>{0.326115936f, 0.130240828f},
-std::array<float,2>{0.182633892f, 0.941420674f},
-std::array<float,2>{0.804224968f, 0.265645027f},
-std::array<float,2>{0.868414402f, 0.729401231f},
-std::array<float,2>{0.22245875f, 0.137635484f},
-std::array<float,2>{0.296427906f, 0.951005161f},
-std::array<float,2>{0.559142172f, 0.275887758f},
-std::array<float,2>{0.656094909f, 0.865884602f},
-std::array<float,2>{0.44507429f, 0.46767506f},
-std::array<float,2>{0.056598369f, 0.51786375f},
-std::array<float,2>{0.8826437f, 0.0776513368f},
-std::array<float,2>{0.97630167f, 0.93095237f},
-std::array<float,2>{0.0891314074f, 0.316127777f},
-std::array<float,2>{0.383386225f, 0.672616601f},
-std::array<float,2>{0.700308561f, 0.203687042f},
-std::array<float,2>{0.592974186f, 0.610504866f},
-std::array<float,2>{0.332417488f, 0.0310030729f},
-std::array<float,2>{0.167608663f, 0.795413554f},
-std::array<float,2>{0.782673299f, 0.432266682f},
-std::array<float,2>{0.933959186f, 0.531674266f},
-std::array<float,2>{0.0139713325f, 0.122741796f},
-std::array<float,2>{0.498249978f, 0.834155679f},
-std::array<float,2>{0.67175293f, 0.481434733f},
-std::array<float,2>{0.50031662f, 0.975645959f},
-std::array<float,2>{0.250078261f, 0.293505758f},
-std::array<float,2>{0.209782436f, 0.71573931f},
-std::array<float,2>{0.813697278f, 0.172058672f},
-std::array<float,2>{0.759507596f, 0.761361361f},
-std::array<float,2>{0.132896915f, 0.38559863f},
-std::array<float,2>{0.372758359f, 0.58726263f},
-std::array<float,2>{0.617173374f, 0.0528191701f},
-std::array<float,2>{0.738245666f, 0.650175333f},
-std::array<float,2>{0.424655616f, 0.236885414f},
-std::array<float,2>{0.0981284827f, 0.887235999f},
-std::array<float,2>{0.940443516f, 0.367541999f},
-std::array<float,2>{0.962092996f, 0.670208395f},
-std::array<float,2>{0.120355576f, 0.196835965f},
-std::array<float,2>{0.418012649f, 0.906492114f},
-std::array<float,2>{0.730242074f, 0.332443058f},
-std::array<float,2>{0.594817162f, 0.800897419f},
-std::array<float,2>{0.349432945f, 0.409937322f},
-std::array<float,2>{0.144358769f, 0.608160138f},
-std::array<float,2>{0.771495461f, 0.00841295719f},
-std::array<float,2>{0.838910758f, 0.95929569f},
-std::array<float,2>{0.189039424f, 0.262302727f},
-std::array<float,2>{0.271755993f, 0.744835019f},
-std::array<float,2>{0.518464863f, 0.145507097f},
-std::array<float,2>{0.672776997f, 0.505309403f},
-std::array<float,2>{0.48092851f, 0.0845605284f},
-std::array<float,2>{0.0194699075f, 0.850531876f},
-std::array<float,2>{0.913828075f, 0.44934994f},
-std::array<float,2>{0.799343586f, 0.565606654f},
-std::array<float,2>{0.187214017f, 0.0340183489f},
-std::array<float,2>{0.321474999f, 0.7712605f},
-std::array<float,2>{0.576938987f, 0.395661205f},
-std::array<float,2>{0.709574699f, 0.902870774f},
-std::array<float,2>{0.403751671f, 0.350501955f},
-std::array<float,2>{0.0653701723f, 0.62718606f},
-std::array<float,2>{0.99157238f, 0.227887869f},
-std::array<float,2>{0.903218806f, 0.826444209f},
-std::array<float,2>{0.0320612416f, 0.490206569f},
-std::array<float,2>{0.453661174f, 0.561698854f},
-std::array<float,2>{0.639002085f, 0.105228819f},
-std::array<float,2>{0.538448691f, 0.690799594f},
-std::array<float,2>{0.304038733f, 0.164068714f},
-std::array<float,2>{0.245970339f, 0.990745664f},
-std::array<float,2>{0.846798062f, 0.302349061f},
-std::array<float,2>{0.776090682f, 0.639742911f},
-std::array<float,2>{0.154430076f, 0.219434783f},
-std::array<float,2>{0.358680308f, 0.896774769f},
-std::array<float,2>{0.605553865f, 0.356934577f},
-std::array<float,2>{0.722222865f, 0.781051278f},
-std::array<float,2>{0.408786863f, 0.405834824f},
-std::array<float,2>{0.114277951f, 0.572233438f},
-std::array<float,2>{0.95464474f, 0.0449459516f},
-std::array<float,2>{0.917832553f, 0.996352673f},
-std::array<float,2>{0.0251928195f, 0.308485419f},
-std::array<float,2>{0.470013559f, 0.701750696f},
-std::array<float,2>{0.681981027f, 0.161678582f},
-std::array<float,2>{0.524797916f, 0.547826946f},
-std::array<float,2>{0.275061697f, 0.10064391f},
-std::array<float,2>{0.201261804f, 0.814229667f},
-std::array<float,2>{0.828454077f, 0.493149132f},
-std::array<float,2>{0.997435868f, 0.601154506f},
-std::array<float,2>{0.0708516166f, 0.00172394339f},
-std::array<float,2>{0.395570368f, 0.807680905f},
-std::array<float,2>{0.71484828f, 0.414905816f},
-std::array<float,2>{0.567995846f, 0.914787531f},
-std::array<float,2>{0.319776297f, 0.339619666f},
-std::array<float,2>{0.172139525f, 0.656528831f},
-std::array<float,2>{0.807270646f, 0.194112271f},
-std::array<float,2>{0.854455709f, 0.852938414f},
-std::array<float,2>{0.238540262f, 0.438650101f},
-std::array<float,2>{0.307364821f, 0.512876451f},
-std::array<float,2>{0.540543616f, 0.0901769027f},
-std::array<float,2>{0.627706409f, 0.739141583f},
-std::array<float,2>{0.46846056f, 0.155171648f},
-std::array<float,2>{0.0394372381f, 0.963305473f},
-std::array<float,2>{0.894546151f, 0.256906956f},
-std::array<float,2>{0.883138478f, 0.709944665f},
-std::array<float,2>{0.0509447418f, 0.184343114f},
-std::array<float,2>{0.449993193f, 0.984185576f},
-std::array<float,2>{0.647755027f, 0.284780383f},
-std::array<float,2>{0.547921538f, 0.837578833f},
-std::array<float,2>{0.283569843f, 0.475199074f},
-std::array<float,2>{0.22956337f, 0.540816426f},
-std::array<float,2>{0.86099112f, 0.113604046f},
-std::array<float,2>{0.79606694f, 0.881494462f},
-std::array<float,2>{0.163572073f, 0.366969377f},
-std::array<float,2>{0.341988117f, 0.642336786f},
-std::array<float,2>{0.583809316f, 0.247657254f},
-std::array<float,2>{0.690245032f, 0.579554558f},
-std::array<float,2>{0.382406533f, 0.0616909154f},
-std::array<float,2>{0.0823283494f, 0.756622553f},
-std::array<float,2>{0.984133601f, 0.381216705f},
-std::array<float,2>{0.826602757f, 0.529227316f},
-std::array<float,2>{0.217629597f, 0.0626662523f},
-std::array<float,2>{0.263030261f, 0.874982774f},
-std::array<float,2>{0.508408725f, 0.457677841f},
-std::array<float,2>{0.659741163f, 0.940989733f},
-std::array<float,2>{0.489524901f, 0.269915998f},
-std::array<float,2>{0.0021811747f, 0.725541532f},
-std::array<float,2>{0.924532771f, 0.128763184f},
-std::array<float,2>{0.949748516f, 0.784377277f},
-std::array<float,2>{0.106569901f, 0.426160812f},
-std::array<float,2>{0.430817455f, 0.62415272f},
-std::array<float,2>{0.749459565f, 0.0189377721f},
-std::array<float,2>{0.621388376f, 0.680125356f},
-std::array<float,2>{0.359823763f, 0.21290274f},
-std::array<float,2>{0.129334599f, 0.925884247f},
-std::array<float,2>{0.75672549f, 0.326102167f},
-std::array<float,2>{0.856286466f, 0.655484796f},
-std::array<float,2>{0.23588343f, 0.24136427f},
-std::array<float,2>{0.309186965f, 0.884072602f},
-std::array<float,2>{0.544969201f, 0.371889114f},
-std::array<float,2>{0.629271746f, 0.764667988f},
-std::array<float,2>{0.461194634f, 0.387387484f},
-std::array<float,2>{0.0444549397f, 0.59007895f},
-std::array<float,2>{0.891771972f, 0.0487391427f},
-std::array<float,2>{0.99229598f, 0.970569253f},
-std::array<float,2>{0.0748219341f, 0.291670412f},
-std::array<float,2>{0.393168658f, 0.712486625f},
-std::array<float,2>{0.712375939f, 0.177448153f},
-std::array<float,2>{0.566084445f, 0.538742423f},
-std::array<float,2>{0.314553052f, 0.12037681f},
-std::array<float,2>{0.175884172f, 0.829378307f},
-std::array<float,2>{0.811936378f, 0.479154795f},
-std::array<float,2>{0.919735193f, 0.613313913f},
-std::array<float,2>{0.0307206642f, 0.0254513118f},
-std::array<float,2>{0.475707144f, 0.789422452f},
-std::array<float,2>{0.686537325f, 0.436587989f},
-std::array<float,2>{0.529715776f, 0.935510933f},
-std::array<float,2>{0.280723393f, 0.317326367f},
-std::array<float,2>{0.196791962f, 0.676925957f},
-std::array<float,2>{0.833572626f, 0.208244249f},
-std::array<float,2>{0.779477537f, 0.861324966f},
-std::array<float,2>{0.151371196f, 0.462102562f},
-std::array<float,2>{0.351865053f, 0.523271024f},
-std::array<float,2>{0.601709187f, 0.0708494782f},
-std::array<float,2>{0.725943208f, 0.734047592f},
-std::array<float,2>{0.411344022f, 0.135573596f},
-std::array<float,2>{0.109560862f, 0.949083865f},
-std::array<float,2>{0.958464086f, 0.278962344f},
-std::array<float,2>{0.945544481f, 0.693218112f},
-std::array<float,2>{0.101629667f, 0.168215111f},
-std::array<float,2>{0.434247553f, 0.985309362f},
-std::array<float,2>{0.743120611f, 0.299484104f},
-std::array<float,2>{0.620999873f, 0.822623849f},
-std::array<float,2>{0.364930332f, 0.487927765f},
-std::array<float,2>{0.126591638f, 0.555956304f},
-std::array<float,2>{0.753825068f, 0.105804764f},
-std::array<float,2>{0.820366859f, 0.898596942f},
-std::array<float,2>{0.214113116f, 0.343848348f},
-std::array<float,2>{0.261655778f, 0.630530775f},
-std::array<float,2>{0.513736248f, 0.233475298f},
-std::array<float,2>{0.662778437f, 0.56754446f},
-std::array<float,2>{0.487257749f, 0.0370583683f},
-std::array<float,2>{0.00763735315f, 0.768592596f},
-std::array<float,2>{0.926713824f, 0.392063022f},
-std::array<float,2>{0.790004671f, 0.503183901f},
-std::array<float,2>{0.157473162f, 0.0810709223f},
-std::array<float,2>{0.337587804f, 0.846129537f},
-std::array<float,2>{0.578535438f, 0.44863072f},
-std::array<float,2>{0.69235754f, 0.954210043f},
-std::array<float,2>{0.377271593f, 0.257934272f},
-std::array<float,2>{0.0799088702f, 0.746403694f},
-std::array<float,2>{0.977112114f, 0.144454747f},
-std::array<float,2>{0.88983196f, 0.800673723f},
-std::array<float,2>{0.0505699888f, 0.413697094f},
-std::array<float,2>{0.446245164f, 0.601699293f},
-std::array<float,2>{0.642303646f, 0.0152815217f},
-std::array<float,2>{0.552914441f, 0.666557968f},
-std::array<float,2>{0.285517633f, 0.201747537f},
-std::array<float,2>{0.232932538f, 0.91233778f},
-std::array<float,2>{0.864567757f, 0.328447521f},
-std::array<float,2>{0.765589833f, 0.735825956f},
-std::array<float,2>{0.138119489f, 0.150582403f},
-std::array<float,2>{0.367614537f, 0.968487322f},
-std::array<float,2>{0.613202989f, 0.251627624f},
-std::array<float,2>{0.740196645f, 0.855596662f},
-std::array<float,2>{0.427823126f, 0.44436571f},
-std::array<float,2>{0.0966328979f, 0.509648383f},
-std::array<float,2>{0.944066763f, 0.0862425715f},
-std::array<float,2>{0.931667984f, 0.920942724f},
-std::array<float,2>{0.0112409769f, 0.340135694f},
-std::array<float,2>{0.492202193f, 0.663731396f},
-std::array<float,2>{0.664283991f, 0.189655155f},
-std::array<float,2>{0.507024348f, 0.594828248f},
-std::array<float,2>{0.254508227f, 0.00594039401f},
-std::array<float,2>{0.205842435f, 0.811687469f},
-std::array<float,2>{0.819096923f, 0.420219064f},
-std::array<float,2>{0.970963717f, 0.551841974f},
-std::array<float,2>{0.0908713564f, 0.0942354202f},
-std::array<float,2>{0.387629271f, 0.8200652f},
-std::array<float,2>{0.699133813f, 0.496748954f},
-std::array<float,2>{0.587480724f, 0.993620396f},
-std::array<float,2>{0.329862684f, 0.308931619f},
-std::array<float,2>{0.16980049f, 0.698388278f},
-std::array<float,2>{0.787418902f, 0.158376172f},
-std::array<float,2>{0.871896446f, 0.774693549f},
-std::array<float,2>{0.224123463f, 0.399528593f},
-std::array<float,2>{0.290347368f, 0.576829851f},
-std::array<float,2>{0.554921329f, 0.0422819667f},
-std::array<float,2>{0.649270892f, 0.635562658f},
-std::array<float,2>{0.438096076f, 0.225802019f},
-std::array<float,2>{0.0620286725f, 0.890639544f},
-std::array<float,2>{0.876760125f, 0.353495657f},
-std::array<float,2>{0.901813745f, 0.685844719f},
-std::array<float,2>{0.0381703898f, 0.215424597f},
-std::array<float,2>{0.458832085f, 0.924399257f},
-std::array<float,2>{0.636421084f, 0.324080378f},
-std::array<float,2>{0.532634676f, 0.786862969f},
-std::array<float,2>{0.299661785f, 0.422868758f},
-std::array<float,2>{0.247272298f, 0.617499352f},
-std::array<float,2>{0.850557983f, 0.0226899348f},
-std::array<float,2>{0.801972449f, 0.945135415f},
-std::array<float,2>{0.181147754f, 0.269223094f},
-std::array<float,2>{0.326561779f, 0.718952298f},
-std::array<float,2>{0.572023571f, 0.131490976f},
-std::array<float,2>{0.703282535f, 0.526312888f},
-std::array<float,2>{0.401144147f, 0.0670692548f},
-std::array<float,2>{0.0685153455f, 0.868022501f},
-std::array<float,2>{0.988263249f, 0.456751496f},
-std::array<float,2>{0.842155933f, 0.582113445f},
-std::array<float,2>{0.192621708f, 0.055150304f},
-std::array<float,2>{0.266885638f, 0.752250493f},
-std::array<float,2>{0.521479785f, 0.37728101f},
-std::array<float,2>{0.67598933f, 0.87575376f},
-std::array<float,2>{0.476997197f, 0.361454338f},
-std::array<float,2>{0.0232719742f, 0.647713959f},
-std::array<float,2>{0.908025503f, 0.244604528f},
-std::array<float,2>{0.966718853f, 0.840639472f},
-std::array<float,2>{0.123233244f, 0.469121397f},
-std::array<float,2>{0.414420128f, 0.543618262f},
-std::array<float,2>{0.731797397f, 0.112661503f},
-std::array<float,2>{0.598090947f, 0.706426561f},
-std::array<float,2>{0.345488191f, 0.182919264f},
-std::array<float,2>{0.145472452f, 0.976889074f},
-std::array<float,2>{0.766553223f, 0.286225855f},
-std::array<float,2>{0.814721346f, 0.718088388f},
-std::array<float,2>{0.207661897f, 0.175279081f},
-std::array<float,2>{0.253291339f, 0.97281146f},
-std::array<float,2>{0.502400815f, 0.296098351f},
-std::array<float,2>{0.669038713f, 0.832603753f},
-std::array<float,2>{0.496392429f, 0.484224617f},
-std::array<float,2>{0.0126272039f, 0.53360182f},
-std::array<float,2>{0.936842859f, 0.123583697f},
-std::array<float,2>{0.939314544f, 0.890079319f},
-std::array<float,2>{0.101051688f, 0.369321793f},
-std::array<float,2>{0.422735751f, 0.650676608f},
-std::array<float,2>{0.735845983f, 0.234720618f},
-std::array<float,2>{0.613735318f, 0.588575244f},
-std::array<float,2>{0.373711109f, 0.0513855442f},
-std::array<float,2>{0.136134475f, 0.758871794f},
-std::array<float,2>{0.761231959f, 0.38375932f},
-std::array<float,2>{0.880347729f, 0.516334116f},
-std::array<float,2>{0.0582810827f, 0.0753514022f},
-std::array<float,2>{0.443055093f, 0.863622189f},
-std::array<float,2>{0.654036224f, 0.466208756f},
-std::array<float,2>{0.56212765f, 0.952518106f},
-std::array<float,2>{0.294162303f, 0.27458933f},
-std::array<float,2>{0.219627649f, 0.727270961f},
-std::array<float,2>{0.870695591f, 0.140418559f},
-std::array<float,2>{0.784579754f, 0.793182313f},
-std::array<float,2>{0.164577812f, 0.43043837f},
-std::array<float,2>{0.33512181f, 0.612385511f},
-std::array<float,2>{0.590640128f, 0.0277230963f},
-std::array<float,2>{0.702856779f, 0.674284518f},
-std::array<float,2>{0.385062337f, 0.206213996f},
-std::array<float,2>{0.0864780024f, 0.932291031f},
-std::array<float,2>{0.97450155f, 0.314393461f},
-std::array<float,2>{0.9896276f, 0.626494467f},
-std::array<float,2>{0.0639545768f, 0.22960566f},
-std::array<float,2>{0.404578507f, 0.906181455f},
-std::array<float,2>{0.707052767f, 0.348288924f},
-std::array<float,2>{0.574491382f, 0.771548629f},
-std::array<float,2>{0.322580546f, 0.397707433f},
-std::array<float,2>{0.184570342f, 0.563090622f},
-std::array<float,2>{0.797801256f, 0.0313617103f},
-std::array<float,2>{0.844161451f, 0.990219116f},
-std::array<float,2>{0.243820965f, 0.304086894f},
-std::array<float,2>{0.302711934f, 0.689279258f},
-std::array<float,2>{0.536083937f, 0.166431963f},
-std::array<float,2>{0.638465047f, 0.558596134f},
-std::array<float,2>{0.45644474f, 0.103348225f},
-std::array<float,2>{0.035032995f, 0.825078964f},
-std::array<float,2>{0.904327214f, 0.490465939f},
-std::array<float,2>{0.770916522f, 0.607205212f},
-std::array<float,2>{0.14238295f, 0.01125741f},
-std::array<float,2>{0.351348579f, 0.803290009f},
-std::array<float,2>{0.596831083f, 0.40680334f},
-std::array<float,2>{0.727858126f, 0.909498453f},
-std::array<float,2>{0.421803027f, 0.335646212f},
-std::array<float,2>{0.118084535f, 0.668700457f},
-std::array<float,2>{0.963951766f, 0.199211568f},
-std::array<float,2>{0.910516798f, 0.848564088f},
-std::array<float,2>{0.0174012072f, 0.451731563f},
-std::array<float,2>{0.48431775f, 0.506609321f},
-std::array<float,2>{0.675618291f, 0.0822737813f},
-std::array<float,2>{0.51647836f, 0.743789554f},
-std::array<float,2>{0.271434665f, 0.148015916f},
-std::array<float,2>{0.191147596f, 0.958521366f},
-std::array<float,2>{0.836663246f, 0.264027476f},
-std::array<float,2>{0.80629915f, 0.659212887f},
-std::array<float,2>{0.174505606f, 0.191569135f},
-std::array<float,2>{0.317891389f, 0.917835057f},
-std::array<float,2>{0.569680929f, 0.337149978f},
-std::array<float,2>{0.718309879f, 0.805542827f},
-std::array<float,2>{0.396739453f, 0.416078061f},
-std::array<float,2>{0.0724145919f, 0.59841758f},
-std::array<float,2>{0.999411583f, 0.00329724047f},
-std::array<float,2>{0.897202432f, 0.96114254f},
-std::array<float,2>{0.0410592854f, 0.25477311f},
-std::array<float,2>{0.465925694f, 0.740321577f},
-std::array<float,2>{0.625933886f, 0.153009191f},
-std::array<float,2>{0.541370273f, 0.514368892f},
-std::array<float,2>{0.304806769f, 0.0932325572f},
-std::array<float,2>{0.241414845f, 0.853715479f},
-std::array<float,2>{0.852631152f, 0.439753145f},
-std::array<float,2>{0.955551922f, 0.57362175f},
-std::array<float,2>{0.116591997f, 0.0446548574f},
-std::array<float,2>{0.407107264f, 0.77790153f},
-std::array<float,2>{0.718755007f, 0.403206408f},
-std::array<float,2>{0.609298766f, 0.894642293f},
-std::array<float,2>{0.355694056f, 0.357624173f},
-std::array<float,2>{0.153328702f, 0.63804996f},
-std::array<float,2>{0.773444355f, 0.220801428f},
-std::array<float,2>{0.831731915f, 0.816140115f},
-std::array<float,2>{0.199995622f, 0.495739073f},
-std::array<float,2>{0.276809394f, 0.550605297f},
-std::array<float,2>{0.526838958f, 0.0978091136f},
-std::array<float,2>{0.681061506f, 0.700201929f},
-std::array<float,2>{0.471910298f, 0.162411675f},
-std::array<float,2>{0.0261964332f, 0.998413265f},
-std::array<float,2>{0.914690435f, 0.306267351f},
-std::array<float,2>{0.922212005f, 0.722873449f},
-std::array<float,2>{0.000241223417f, 0.126641586f},
-std::array<float,2>{0.49102053f, 0.938375175f},
-std::array<float,2>{0.65704155f, 0.272037625f},
-std::array<float,2>{0.510175884f, 0.871432722f},
-std::array<float,2>{0.264719993f, 0.460461885f},
-std::array<float,2>{0.216544911f, 0.529790342f},
-std::array<float,2>{0.824869573f, 0.0645863935f},
-std::array<float,2>{0.754966199f, 0.929403007f},
-std::array<float,2>{0.131348997f, 0.326949805f},
-std::array<float,2>{0.361432165f, 0.68340683f},
-std::array<float,2>{0.623399734f, 0.211084545f},
-std::array<float,2>{0.747840583f, 0.622448862f},
-std::array<float,2>{0.433446378f, 0.017062366f},
-std::array<float,2>{0.107880719f, 0.782029748f},
-std::array<float,2>{0.952969611f, 0.428522617f},
-std::array<float,2>{0.861814439f, 0.541583955f},
-std::array<float,2>{0.228367984f, 0.115512416f},
-std::array<float,2>{0.281432331f, 0.837970436f},
-std::array<float,2>{0.550599992f, 0.472685069f},
-std::array<float,2>{0.644839227f, 0.981616139f},
-std::array<float,2>{0.45258984f, 0.282487988f},
-std::array<float,2>{0.0534726083f, 0.70704782f},
-std::array<float,2>{0.885218561f, 0.186625749f},
-std::array<float,2>{0.980661809f, 0.754589498f},
-std::array<float,2>{0.0848588645f, 0.379150242f},
-std::array<float,2>{0.37926209f, 0.580319285f},
-std::array<float,2>{0.688665211f, 0.0604772232f},
-std::array<float,2>{0.585573494f, 0.643815994f},
-std::array<float,2>{0.341521561f, 0.248509124f},
-std::array<float,2>{0.161151141f, 0.879662275f},
-std::array<float,2>{0.79377079f, 0.363964468f},
-std::array<float,2>{0.82259208f, 0.629830241f},
-std::array<float,2>{0.211023122f, 0.232681692f},
-std::array<float,2>{0.258874059f, 0.90012151f},
-std::array<float,2>{0.512396514f, 0.345077097f},
-std::array<float,2>{0.66054064f, 0.768171251f},
-std::array<float,2>{0.485979408f, 0.390734404f},
-std::array<float,2>{0.00405931147f, 0.566502452f},
-std::array<float,2>{0.929654658f, 0.0355808958f},
-std::array<float,2>{0.94844538f, 0.985856175f},
-std::array<float,2>{0.105366573f, 0.300531477f},
-std::array<float,2>{0.436611563f, 0.691850305f},
-std::array<float,2>{0.745819688f, 0.169249907f},
-std::array<float,2>{0.617857814f, 0.555404961f},
-std::array<float,2>{0.367043078f, 0.107181057f},
-std::array<float,2>{0.128103971f, 0.824162662f},
-std::array<float,2>{0.751236498f, 0.487063289f},
-std::array<float,2>{0.887164056f, 0.60305804f},
-std::array<float,2>{0.0476226658f, 0.0146303941f},
-std::array<float,2>{0.44895494f, 0.799490273f},
-std::array<float,2>{0.643777072f, 0.412489355f},
-std::array<float,2>{0.552460492f, 0.913654566f},
-std::array<float,2>{0.287399977f, 0.329118073f},
-std::array<float,2>{0.230541363f, 0.667269349f},
-std::array<float,2>{0.866550624f, 0.202382609f},
-std::array<float,2>{0.791115344f, 0.847028017f},
-std::array<float,2>{0.158669084f, 0.447871983f},
-std::array<float,2>{0.339543849f, 0.502076089f},
-std::array<float,2>{0.580874085f, 0.080178f},
-std::array<float,2>{0.693872213f, 0.747193873f},
-std::array<float,2>{0.376095057f, 0.143230915f},
-std::array<float,2>{0.081067279f, 0.953955531f},
-std::array<float,2>{0.979298949f, 0.25943625f},
-std::array<float,2>{0.994444549f, 0.711070418f},
-std::array<float,2>{0.0775138214f, 0.176123381f},
-std::array<float,2>{0.392551124f, 0.969610631f},
-std::array<float,2>{0.714357197f, 0.292232901f},
-std::array<float,2>{0.564335346f, 0.828980684f},
-std::array<float,2>{0.313266069f, 0.479644507f},
-std::array<float,2>{0.179377526f, 0.53789705f},
-std::array<float,2>{0.810303748f, 0.119340084f},
-std::array<float,2>{0.85858345f, 0.883161783f},
-std::array<float,2>{0.2369643f, 0.372136414f},
-std::array<float,2>{0.312479138f, 0.655057073f},
-std::array<float,2>{0.544277012f, 0.240557402f},
-std::array<float,2>{0.631400347f, 0.590862334f},
-std::array<float,2>{0.463872164f, 0.0472391322f},
-std::array<float,2>{0.0461019203f, 0.764143765f},
-std::array<float,2>{0.894120932f, 0.388428241f},
-std::array<float,2>{0.778002799f, 0.521543324f},
-std::array<float,2>{0.148619965f, 0.0717648938f},
-std::array<float,2>{0.354175359f, 0.859673142f},
-std::array<float,2>{0.605231941f, 0.461754501f},
-std::array<float,2>{0.724274397f, 0.947577775f},
-std::array<float,2>{0.412441552f, 0.277686208f},
-std::array<float,2>{0.112161905f, 0.73283112f},
-std::array<float,2>{0.959702849f, 0.13643077f},
-std::array<float,2>{0.921466649f, 0.790612459f},
-std::array<float,2>{0.0286400709f, 0.435967952f},
-std::array<float,2>{0.47364977f, 0.614428699f},
-std::array<float,2>{0.68406719f, 0.0273301955f},
-std::array<float,2>{0.528267443f, 0.675978124f},
-std::array<float,2>{0.278053045f, 0.20735608f},
-std::array<float,2>{0.198147669f, 0.93449837f},
-std::array<float,2>{0.835140705f, 0.317698419f},
-std::array<float,2>{0.803101242f, 0.719749689f},
-std::array<float,2>{0.181789637f, 0.132398143f},
-std::array<float,2>{0.324840814f, 0.943707764f},
-std::array<float,2>{0.574038088f, 0.267729372f},
-std::array<float,2>{0.705333412f, 0.868461192f},
-std::array<float,2>{0.399845988f, 0.455636144f},
-std::array<float,2>{0.0666082054f, 0.526707232f},
-std::array<float,2>{0.985700011f, 0.0680934414f},
-std::array<float,2>{0.898906767f, 0.924828291f},
-std::array<float,2>{0.0360560492f, 0.322307587f},
-std::array<float,2>{0.459500223f, 0.687322497f},
-std::array<float,2>{0.632988214f, 0.216201812f},
-std::array<float,2>{0.534100771f, 0.61888355f},
-std::array<float,2>{0.297108084f, 0.0217325129f},
-std::array<float,2>{0.249741971f, 0.785796762f},
-std::array<float,2>{0.849181354f, 0.422732413f},
-std::array<float,2>{0.967351258f, 0.544053793f},
-std::array<float,2>{0.121152192f, 0.111446127f},
-std::array<float,2>{0.417871684f, 0.841405511f},
-std::array<float,2>{0.732987165f, 0.47034812f},
-std::array<float,2>{0.600416362f, 0.977955282f},
-std::array<float,2>{0.34671852f, 0.285449654f},
-std::array<float,2>{0.147673517f, 0.705218315f},
-std::array<float,2>{0.768922031f, 0.182013199f},
-std::array<float,2>{0.840739489f, 0.7538656f},
-std::array<float,2>{0.194317415f, 0.378798038f},
-std::array<float,2>{0.268957645f, 0.583308697f},
-std::array<float,2>{0.52169472f, 0.0562406257f},
-std::array<float,2>{0.67882663f, 0.646895885f},
-std::array<float,2>{0.478869915f, 0.245450705f},
-std::array<float,2>{0.0204393733f, 0.876858413f},
-std::array<float,2>{0.909962416f, 0.362936169f},
-std::array<float,2>{0.931416512f, 0.662428975f},
-std::array<float,2>{0.00956301298f, 0.191324607f},
-std::array<float,2>{0.494699001f, 0.919984758f},
-std::array<float,2>{0.667742252f, 0.341593564f},
-std::array<float,2>{0.505825937f, 0.811093867f},
-std::array<float,2>{0.25767082f, 0.421666026f},
-std::array<float,2>{0.203979641f, 0.593912601f},
-std::array<float,2>{0.817181408f, 0.00765357539f},
-std::array<float,2>{0.763337016f, 0.966924667f},
-std::array<float,2>{0.139558673f, 0.250465333f},
-std::array<float,2>{0.37044397f, 0.735133231f},
-std::array<float,2>{0.609813035f, 0.151561007f},
-std::array<float,2>{0.74120903f, 0.508684218f},
-std::array<float,2>{0.427368581f, 0.086926043f},
-std::array<float,2>{0.0952498168f, 0.856687486f},
-std::array<float,2>{0.942587674f, 0.444107771f},
-std::array<float,2>{0.873234451f, 0.578097045f},
-std::array<float,2>{0.224772066f, 0.0417421386f},
-std::array<float,2>{0.291898459f, 0.774270475f},
-std::array<float,2>{0.557412326f, 0.398802936f},
-std::array<float,2>{0.652335525f, 0.891952395f},
-std::array<float,2>{0.44110176f, 0.351613522f},
-std::array<float,2>{0.0601965375f, 0.635912061f},
-std::array<float,2>{0.878106713f, 0.225036442f},
-std::array<float,2>{0.969124675f, 0.818433225f},
-std::array<float,2>{0.0932049826f, 0.497245461f},
-std::array<float,2>{0.388812989f, 0.55101192f},
-std::array<float,2>{0.695349872f, 0.0953953415f},
-std::array<float,2>{0.589031816f, 0.697288454f},
-std::array<float,2>{0.330983281f, 0.159824908f},
-std::array<float,2>{0.171829f, 0.992661834f},
-std::array<float,2>{0.78624922f, 0.309839815f},
-std::array<float,2>{0.846464694f, 0.687777877f},
-std::array<float,2>{0.244363919f, 0.167846143f},
-std::array<float,2>{0.303710699f, 0.988862813f},
-std::array<float,2>{0.53763479f, 0.302862734f},
-std::array<float,2>{0.640073597f, 0.825631142f},
-std::array<float,2>{0.454286665f, 0.491345912f},
-std::array<float,2>{0.0323974565f, 0.559686899f},
-std::array<float,2>{0.903836429f, 0.101757564f},
-std::array<float,2>{0.99063313f, 0.904952586f},
-std::array<float,2>{0.0663492754f, 0.349522382f},
-std::array<float,2>{0.402729303f, 0.625453174f},
-std::array<float,2>{0.71013391f, 0.229347587f},
-std::array<float,2>{0.577282846f, 0.563584864f},
-std::array<float,2>{0.32096222f, 0.0327169374f},
-std::array<float,2>{0.186247528f, 0.77304107f},
-std::array<float,2>{0.800638676f, 0.396523267f},
-std::array<float,2>{0.912882864f, 0.506842911f},
-std::array<float,2>{0.0181072988f, 0.0838813409f},
-std::array<float,2>{0.48232004f, 0.848863184f},
-std::array<float,2>{0.673088372f, 0.45266062f},
-std::array<float,2>{0.518913746f, 0.95789808f},
-std::array<float,2>{0.272921681f, 0.265286535f},
-std::array<float,2>{0.188250706f, 0.74243027f},
-std::array<float,2>{0.83856684f, 0.146590501f},
-std::array<float,2>{0.772869289f, 0.804051697f},
-std::array<float,2>{0.143403634f, 0.407548428f},
-std::array<float,2>{0.347742885f, 0.605662107f},
-std::array<float,2>{0.594585001f, 0.0106591284f},
-std::array<float,2>{0.729068518f, 0.668948233f},
-std::array<float,2>{0.419297725f, 0.197805211f},
-std::array<float,2>{0.119901523f, 0.908532202f},
-std::array<float,2>{0.961588979f, 0.334304512f},
-std::array<float,2>{0.940115988f, 0.65179956f},
-std::array<float,2>{0.0989000425f, 0.235795274f},
-std::array<float,2>{0.425577164f, 0.889302492f},
-std::array<float,2>{0.736994147f, 0.370648712f},
-std::array<float,2>{0.615358651f, 0.758628607f},
-std::array<float,2>{0.371375442f, 0.384746075f},
-std::array<float,2>{0.134577706f, 0.589627326f},
-std::array<float,2>{0.758463979f, 0.0517917797f},
-std::array<float,2>{0.812556982f, 0.974382043f},
-std::array<float,2>{0.210586965f, 0.295331091f},
-std::array<float,2>{0.251032442f, 0.716851592f},
-std::array<float,2>{0.501498461f, 0.174301401f},
-std::array<float,2>{0.670711935f, 0.534925282f},
-std::array<float,2>{0.499761373f, 0.124061391f},
-std::array<float,2>{0.0148118064f, 0.833817184f},
-std::array<float,2>{0.934988022f, 0.483342469f},
-std::array<float,2>{0.7814309f, 0.611579299f},
-std::array<float,2>{0.166630968f, 0.0288061202f},
-std::array<float,2>{0.333123893f, 0.794691384f},
-std::array<float,2>{0.592301726f, 0.431435287f},
-std::array<float,2>{0.699438155f, 0.932956755f},
-std::array<float,2>{0.383911163f, 0.313416839f},
-std::array<float,2>{0.088145718f, 0.675753415f},
-std::array<float,2>{0.975094974f, 0.205282807f},
-std::array<float,2>{0.881285727f, 0.864651024f},
-std::array<float,2>{0.0555554181f, 0.464894503f},
-std::array<float,2>{0.443819344f, 0.516827583f},
-std::array<float,2>{0.655152738f, 0.0744609907f},
-std::array<float,2>{0.559601784f, 0.728216231f},
-std::array<float,2>{0.295748562f, 0.138921112f},
-std::array<float,2>{0.221137747f, 0.951491475f},
-std::array<float,2>{0.867534518f, 0.273749679f},
-std::array<float,2>{0.757375658f, 0.682134211f},
-std::array<float,2>{0.130082801f, 0.212266222f},
-std::array<float,2>{0.360839635f, 0.928590238f},
-std::array<float,2>{0.622924209f, 0.327553302f},
-std::array<float,2>{0.748924315f, 0.783163607f},
-std::array<float,2>{0.430598289f, 0.429102153f},
-std::array<float,2>{0.106025979f, 0.621298671f},
-std::array<float,2>{0.950422049f, 0.0162582807f},
-std::array<float,2>{0.924820065f, 0.938622952f},
-std::array<float,2>{0.00311589264f, 0.273381442f},
-std::array<float,2>{0.488788098f, 0.724468648f},
-std::array<float,2>{0.659122884f, 0.125480101f},
-std::array<float,2>{0.509164572f, 0.530670285f},
-std::array<float,2>{0.262454778f, 0.066002816f},
-std::array<float,2>{0.218719199f, 0.8724038f},
-std::array<float,2>{0.827717245f, 0.459268898f},
-std::array<float,2>{0.982899845f, 0.581310213f},
-std::array<float,2>{0.0836539045f, 0.0589063652f},
-std::array<float,2>{0.381569505f, 0.755663872f},
-std::array<float,2>{0.691194654f, 0.380394995f},
-std::array<float,2>{0.582708359f, 0.87992698f},
-std::array<float,2>{0.343722939f, 0.365169942f},
-std::array<float,2>{0.162867919f, 0.643213272f},
-std::array<float,2>{0.795080364f, 0.249327138f},
-std::array<float,2>{0.859937191f, 0.839478076f},
-std::array<float,2>{0.229174092f, 0.474064678f},
-std::array<float,2>{0.284650117f, 0.542282224f},
-std::array<float,2>{0.547137737f, 0.117104881f},
-std::array<float,2>{0.647187233f, 0.708417177f},
-std::array<float,2>{0.450960964f, 0.185957789f},
-std::array<float,2>{0.0518778823f, 0.981167376f},
-std::array<float,2>{0.884050667f, 0.281387568f},
-std::array<float,2>{0.89641422f, 0.741770148f},
-std::array<float,2>{0.0408025496f, 0.153625861f},
-std::array<float,2>{0.467142761f, 0.96283865f},
-std::array<float,2>{0.628822505f, 0.255604714f},
-std::array<float,2>{0.539556801f, 0.855084777f},
-std::array<float,2>{0.308317274f, 0.440529466f},
-std::array<float,2>{0.239327177f, 0.514891803f},
-std::array<float,2>{0.855335116f, 0.091950573f},
-std::array<float,2>{0.808070719f, 0.91652602f},
-std::array<float,2>{0.173099622f, 0.336856961f},
-std::array<float,2>{0.318564922f, 0.658688664f},
-std::array<float,2>{0.566477537f, 0.192496032f},
-std::array<float,2>{0.716621697f, 0.599516034f},
-std::array<float,2>{0.394916534f, 0.00233519613f},
-std::array<float,2>{0.0713279396f, 0.806610584f},
-std::array<float,2>{0.996863961f, 0.417672038f},
-std::array<float,2>{0.829989493f, 0.549057305f},
-std::array<float,2>{0.202423468f, 0.0992280319f},
-std::array<float,2>{0.273645043f, 0.814490736f},
-std::array<float,2>{0.524401128f, 0.49434945f},
-std::array<float,2>{0.682670295f, 0.999212563f},
-std::array<float,2>{0.46941039f, 0.305433422f},
-std::array<float,2>{0.0242224969f, 0.69986099f},
-std::array<float,2>{0.916232824f, 0.163592532f},
-std::array<float,2>{0.953531027f, 0.778760433f},
-std::array<float,2>{0.113575384f, 0.404209048f},
-std::array<float,2>{0.410003334f, 0.572296858f},
-std::array<float,2>{0.72100538f, 0.0436511487f},
-std::array<float,2>{0.606842697f, 0.637522697f},
-std::array<float,2>{0.357864082f, 0.222269818f},
-std::array<float,2>{0.155317917f, 0.896037638f},
-std::array<float,2>{0.776487648f, 0.359034508f},
-std::array<float,2>{0.863692999f, 0.665608466f},
-std::array<float,2>{0.233547568f, 0.200457856f},
-std::array<float,2>{0.286628723f, 0.911482513f},
-std::array<float,2>{0.554400682f, 0.331235647f},
-std::array<float,2>{0.641224444f, 0.797042906f},
-std::array<float,2>{0.446365178f, 0.411251664f},
-std::array<float,2>{0.0496849194f, 0.604057968f},
-std::array<float,2>{0.889261425f, 0.0121136662f},
-std::array<float,2>{0.97833401f, 0.956982911f},
-std::array<float,2>{0.0782974437f, 0.259794623f},
-std::array<float,2>{0.378178269f, 0.749840319f},
-std::array<float,2>{0.693077624f, 0.142219156f},
-std::array<float,2>{0.580067039f, 0.500350475f},
-std::array<float,2>{0.336509854f, 0.0785532817f},
-std::array<float,2>{0.157081872f, 0.845677435f},
-std::array<float,2>{0.790405631f, 0.446256757f},
-std::array<float,2>{0.92768532f, 0.568461239f},
-std::array<float,2>{0.0067593297f, 0.0375237428f},
-std::array<float,2>{0.487956077f, 0.765755236f},
-std::array<float,2>{0.663212657f, 0.392863482f},
-std::array<float,2>{0.515083671f, 0.900657773f},
-std::array<float,2>{0.260563195f, 0.345739633f},
-std::array<float,2>{0.21378389f, 0.631031036f},
-std::array<float,2>{0.821964204f, 0.231953293f},
-std::array<float,2>{0.752025127f, 0.820525706f},
-std::array<float,2>{0.125109926f, 0.484917819f},
-std::array<float,2>{0.363818318f, 0.556907892f},
-std::array<float,2>{0.619818389f, 0.107756197f},
-std::array<float,2>{0.743412852f, 0.693441749f},
-std::array<float,2>{0.434731632f, 0.170588493f},
-std::array<float,2>{0.103476197f, 0.98810041f},
-std::array<float,2>{0.94693768f, 0.297979295f},
-std::array<float,2>{0.957688332f, 0.730585694f},
-std::array<float,2>{0.110927477f, 0.134004816f},
-std::array<float,2>{0.410208642f, 0.946493268f},
-std::array<float,2>{0.725244522f, 0.281108558f},
-std::array<float,2>{0.602672517f, 0.862971246f},
-std::array<float,2>{0.352783471f, 0.464197367f},
-std::array<float,2>{0.150878623f, 0.521438837f},
-std::array<float,2>{0.781089306f, 0.0723039508f},
-std::array<float,2>{0.832666337f, 0.936151862f},
-std::array<float,2>{0.19538492f, 0.320111394f},
-std::array<float,2>{0.279358357f, 0.677866101f},
-std::array<float,2>{0.530984104f, 0.21022962f},
-std::array<float,2>{0.686307549f, 0.615338445f},
-std::array<float,2>{0.475191355f, 0.0240718629f},
-std::array<float,2>{0.0299993325f, 0.79120034f},
-std::array<float,2>{0.918099105f, 0.434874386f},
-std::array<float,2>{0.810617268f, 0.535690129f},
-std::array<float,2>{0.177285239f, 0.117225155f},
-std::array<float,2>{0.316117495f, 0.831890166f},
-std::array<float,2>{0.565181732f, 0.476729482f},
-std::array<float,2>{0.71183157f, 0.971344829f},
-std::array<float,2>{0.394328266f, 0.290765673f},
-std::array<float,2>{0.075404577f, 0.714693427f},
-std::array<float,2>{0.993598402f, 0.179112285f},
-std::array<float,2>{0.891515791f, 0.763566017f},
-std::array<float,2>{0.0430264845f, 0.389633298f},
-std::array<float,2>{0.461923927f, 0.593443692f},
-std::array<float,2>{0.629912853f, 0.0488574989f},
-std::array<float,2>{0.546024978f, 0.654127717f},
-std::array<float,2>{0.309925288f, 0.238494143f},
-std::array<float,2>{0.235139057f, 0.885210335f},
-std::array<float,2>{0.856467843f, 0.373789251f},
-std::array<float,2>{0.767169178f, 0.704597116f},
-std::array<float,2>{0.145674899f, 0.180440828f},
-std::array<float,2>{0.343922883f, 0.980017424f},
-std::array<float,2>{0.598679602f, 0.288561404f},
-std::array<float,2>{0.730625093f, 0.843350828f},
-std::array<float,2>{0.415254146f, 0.472614825f},
-std::array<float,2>{0.124789625f, 0.545132518f},
-std::array<float,2>{0.965372324f, 0.110523894f},
-std::array<float,2>{0.906992257f, 0.877145469f},
-std::array<float,2>{0.0223983899f, 0.361071646f},
-std::array<float,2>{0.478490412f, 0.645642102f},
-std::array<float,2>{0.677356541f, 0.243041739f},
-std::array<float,2>{0.51989466f, 0.584914207f},
-std::array<float,2>{0.266551793f, 0.0566911809f},
-std::array<float,2>{0.191601411f, 0.751852036f},
-std::array<float,2>{0.843506634f, 0.375671118f},
-std::array<float,2>{0.986398399f, 0.523664057f},
-std::array<float,2>{0.0700430274f, 0.0697037056f},
-std::array<float,2>{0.402282655f, 0.870855391f},
-std::array<float,2>{0.704184413f, 0.45421055f},
-std::array<float,2>{0.570402801f, 0.942815185f},
-std::array<float,2>{0.327575505f, 0.266846955f},
-std::array<float,2>{0.180417448f, 0.722257614f},
-std::array<float,2>{0.801005065f, 0.1293571f},
-std::array<float,2>{0.850619793f, 0.787826896f},
-std::array<float,2>{0.24653925f, 0.425451964f},
-std::array<float,2>{0.299920082f, 0.619900584f},
-std::array<float,2>{0.532060146f, 0.0212992821f},
-std::array<float,2>{0.635490298f, 0.685055256f},
-std::array<float,2>{0.457751244f, 0.216984734f},
-std::array<float,2>{0.038036786f, 0.923173964f},
-std::array<float,2>{0.901312947f, 0.32193622f},
-std::array<float,2>{0.87577945f, 0.633108795f},
-std::array<float,2>{0.0610371716f, 0.22322318f},
-std::array<float,2>{0.439266682f, 0.892713428f},
-std::array<float,2>{0.650066614f, 0.353523076f},
-std::array<float,2>{0.556026995f, 0.776484549f},
-std::array<float,2>{0.289231896f, 0.400444478f},
-std::array<float,2>{0.222782269f, 0.576139629f},
-std::array<float,2>{0.872772098f, 0.0396796018f},
-std::array<float,2>{0.788310647f, 0.99563396f},
-std::array<float,2>{0.168665662f, 0.312475413f},
-std::array<float,2>{0.328591138f, 0.697069824f},
-std::array<float,2>{0.586405754f, 0.156259015f},
-std::array<float,2>{0.697841644f, 0.553983808f},
-std::array<float,2>{0.388117462f, 0.0966874808f},
-std::array<float,2>{0.0903311521f, 0.816890359f},
-std::array<float,2>{0.972212315f, 0.499471724f},
-std::array<float,2>{0.819673181f, 0.597018123f},
-std::array<float,2>{0.206794396f, 0.00504574785f},
-std::array<float,2>{0.255582243f, 0.809533715f},
-std::array<float,2>{0.506764829f, 0.418864161f},
-std::array<float,2>{0.665078878f, 0.918201268f},
-std::array<float,2>{0.49398002f, 0.343397468f},
-std::array<float,2>{0.0103781512f, 0.660992742f},
-std::array<float,2>{0.933027685f, 0.188733712f},
-std::array<float,2>{0.944887459f, 0.859341502f},
-std::array<float,2>{0.097528331f, 0.443002969f},
-std::array<float,2>{0.429323554f, 0.510546744f},
-std::array<float,2>{0.738657117f, 0.0885767788f},
-std::array<float,2>{0.611929059f, 0.737298191f},
-std::array<float,2>{0.368803024f, 0.149561763f},
-std::array<float,2>{0.136802554f, 0.966377556f},
-std::array<float,2>{0.764280617f, 0.252720207f},
-std::array<float,2>{0.837815702f, 0.745513022f},
-std::array<float,2>{0.189698204f, 0.145939961f},
-std::array<float,2>{0.26987341f, 0.960187674f},
-std::array<float,2>{0.517029881f, 0.263156623f},
-std::array<float,2>{0.673935056f, 0.850601017f},
-std::array<float,2>{0.48246485f, 0.450264603f},
-std::array<float,2>{0.0164912362f, 0.504681528f},
-std::array<float,2>{0.911963761f, 0.0859348476f},
-std::array<float,2>{0.963126481f, 0.907517493f},
-std::array<float,2>{0.118941911f, 0.333063483f},
-std::array<float,2>{0.419978529f, 0.671638966f},
-std::array<float,2>{0.72697711f, 0.19533962f},
-std::array<float,2>{0.59597677f, 0.60849905f},
-std::array<float,2>{0.350508034f, 0.0095806364f},
-std::array<float,2>{0.141370043f, 0.802408278f},
-std::array<float,2>{0.769958973f, 0.408517659f},
-std::array<float,2>{0.905722916f, 0.560826659f},
-std::array<float,2>{0.0335793048f, 0.104149982f},
-std::array<float,2>{0.455769032f, 0.827218235f},
-std::array<float,2>{0.637624145f, 0.488351285f},
-std::array<float,2>{0.536354482f, 0.991250575f},
-std::array<float,2>{0.301389754f, 0.301498443f},
-std::array<float,2>{0.242972687f, 0.689979374f},
-std::array<float,2>{0.845089018f, 0.165538087f},
-std::array<float,2>{0.798208058f, 0.770384192f},
-std::array<float,2>{0.184403941f, 0.394962847f},
-std::array<float,2>{0.32336551f, 0.564645052f},
-std::array<float,2>{0.575724423f, 0.0346060134f},
-std::array<float,2>{0.708962858f, 0.628490686f},
-std::array<float,2>{0.406067461f, 0.22679697f},
-std::array<float,2>{0.0626919717f, 0.90409565f},
-std::array<float,2>{0.988552272f, 0.35131979f},
-std::array<float,2>{0.97309047f, 0.673405409f},
-std::array<float,2>{0.0870603919f, 0.204943985f},
-std::array<float,2>{0.385965675f, 0.930312514f},
-std::array<float,2>{0.702084422f, 0.314940959f},
-std::array<float,2>{0.591739178f, 0.796130359f},
-std::array<float,2>{0.334133238f, 0.432727665f},
-std::array<float,2>{0.165621743f, 0.609950602f},
-std::array<float,2>{0.783725739f, 0.0301086418f},
-std::array<float,2>{0.869491279f, 0.949634731f},
-std::array<float,2>{0.220523521f, 0.277068764f},
-std::array<float,2>{0.293477148f, 0.729533851f},
-std::array<float,2>{0.561374903f, 0.137962297f},
-std::array<float,2>{0.652967572f, 0.518866301f},
-std::array<float,2>{0.44147411f, 0.0763807073f},
-std::array<float,2>{0.057611905f, 0.866544724f},
-std::array<float,2>{0.879333079f, 0.467993349f},
-std::array<float,2>{0.76066035f, 0.585962176f},
-std::array<float,2>{0.135162175f, 0.0541543439f},
-std::array<float,2>{0.374583423f, 0.759767115f},
-std::array<float,2>{0.615121961f, 0.386447638f},
-std::array<float,2>{0.734950066f, 0.888395965f},
-std::array<float,2>{0.423821241f, 0.368400395f},
-std::array<float,2>{0.10015405f, 0.648760736f},
-std::array<float,2>{0.938019335f, 0.237469241f},
-std::array<float,2>{0.935932279f, 0.835169137f},
-std::array<float,2>{0.013109277f, 0.482325315f},
-std::array<float,2>{0.497901082f, 0.532908559f},
-std::array<float,2>{0.667994201f, 0.121673316f},
-std::array<float,2>{0.503815114f, 0.716486275f},
-std::array<float,2>{0.252384782f, 0.173308358f},
-std::array<float,2>{0.208395854f, 0.974629998f},
-std::array<float,2>{0.815885663f, 0.293992519f},
-std::array<float,2>{0.79401207f, 0.640879452f},
-std::array<float,2>{0.160994574f, 0.246940717f},
-std::array<float,2>{0.340678304f, 0.882402837f},
-std::array<float,2>{0.584439576f, 0.365531355f},
-std::array<float,2>{0.688201427f, 0.757534981f},
-std::array<float,2>{0.380028516f, 0.382579029f},
-std::array<float,2>{0.0857453048f, 0.578497529f},
-std::array<float,2>{0.982395351f, 0.0611417629f},
-std::array<float,2>{0.886683285f, 0.983175874f},
-std::array<float,2>{0.0541730151f, 0.28391397f},
-std::array<float,2>{0.451672137f, 0.710114837f},
-std::array<float,2>{0.646015108f, 0.184805945f},
-std::array<float,2>{0.549681604f, 0.53960222f},
-std::array<float,2>{0.282580346f, 0.114874899f},
-std::array<float,2>{0.226995841f, 0.836479723f},
-std::array<float,2>{0.862396419f, 0.475734055f},
-std::array<float,2>{0.951564491f, 0.623686135f},
-std::array<float,2>{0.108403057f, 0.0184932239f},
-std::array<float,2>{0.431984514f, 0.783730924f},
-std::array<float,2>{0.746611655f, 0.427373558f},
-std::array<float,2>{0.624315023f, 0.927157164f},
-std::array<float,2>{0.363146156f, 0.324425459f},
-std::array<float,2>{0.131978124f, 0.681616485f},
-std::array<float,2>{0.754097581f, 0.214224145f},
-std::array<float,2>{0.825642586f, 0.873305559f},
-std::array<float,2>{0.215407938f, 0.458120167f},
-std::array<float,2>{0.264053404f, 0.528051317f},
-std::array<float,2>{0.511635721f, 0.0639996231f},
-std::array<float,2>{0.657888889f, 0.725897372f},
-std::array<float,2>{0.491283596f, 0.127870068f},
-std::array<float,2>{0.00184589613f, 0.939565539f},
-std::array<float,2>{0.923252165f, 0.270735562f},
-std::array<float,2>{0.915453017f, 0.702870369f},
-std::array<float,2>{0.0269023273f, 0.160276115f},
-std::array<float,2>{0.470723808f, 0.997901917f},
-std::array<float,2>{0.68043071f, 0.307255447f},
-std::array<float,2>{0.525824606f, 0.812577724f},
-std::array<float,2>{0.276124924f, 0.493274033f},
-std::array<float,2>{0.200619623f, 0.548784614f},
-std::array<float,2>{0.830226839f, 0.0996553525f},
-std::array<float,2>{0.774438679f, 0.898169875f},
-std::array<float,2>{0.15302439f, 0.356031895f},
-std::array<float,2>{0.357390046f, 0.638992667f},
-std::array<float,2>{0.607797265f, 0.219935551f},
-std::array<float,2>{0.72038281f, 0.570938051f},
-std::array<float,2>{0.407904476f, 0.0460889898f},
-std::array<float,2>{0.115901776f, 0.780054748f},
-std::array<float,2>{0.956679106f, 0.404329419f},
-std::array<float,2>{0.851730108f, 0.512187839f},
-std::array<float,2>{0.240955845f, 0.0915717632f},
-std::array<float,2>{0.306608886f, 0.852045834f},
-std::array<float,2>{0.542803228f, 0.437698781f},
-std::array<float,2>{0.626807034f, 0.964638591f},
-std::array<float,2>{0.465099126f, 0.256447256f},
-std::array<float,2>{0.0420194194f, 0.740131021f},
-std::array<float,2>{0.898123145f, 0.155822679f},
-std::array<float,2>{0.99871695f, 0.807467818f},
-std::array<float,2>{0.0737180039f, 0.415345043f},
-std::array<float,2>{0.397613734f, 0.600045621f},
-std::array<float,2>{0.716821253f, 0.000931130024f},
-std::array<float,2>{0.568787992f, 0.657726943f},
-std::array<float,2>{0.317300498f, 0.195195258f},
-std::array<float,2>{0.175094724f, 0.915390491f},
-std::array<float,2>{0.805126965f, 0.338565141f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.438586503f, 0.459215313f},
-std::array<float,2>{0.905116737f, 0.586559474f},
-std::array<float,2>{0.0414720923f, 0.760637045f},
-std::array<float,2>{0.541957974f, 0.00629217736f},
-std::array<float,2>{0.211060315f, 0.166470796f},
-std::array<float,2>{0.700213373f, 0.892993927f},
-std::array<float,2>{0.306431055f, 0.662451446f},
-std::array<float,2>{0.864852667f, 0.336940378f},
-std::array<float,2>{0.106764421f, 0.259561718f},
-std::array<float,2>{0.563274264f, 0.711307466f},
-std::array<float,2>{0.409024984f, 0.959202826f},
-std::array<float,2>{0.947936296f, 0.188133106f},
-std::array<float,2>{0.320303351f, 0.0799433365f},
-std::array<float,2>{0.762622774f, 0.857502699f},
-std::array<float,2>{0.154590845f, 0.561508477f},
-std::array<float,2>{0.644401848f, 0.435360283f},
-std::array<float,2>{0.28027457f, 0.344003648f},
-std::array<float,2>{0.838297129f, 0.632305086f},
-std::array<float,2>{0.239788219f, 0.916867673f},
-std::array<float,2>{0.739347696f, 0.128341913f},
-std::array<float,2>{0.00654606055f, 0.0415909439f},
-std::array<float,2>{0.512299657f, 0.792354226f},
-std::array<float,2>{0.471275985f, 0.618136764f},
-std::array<float,2>{0.920794845f, 0.499582797f},
-std::array<float,2>{0.18261674f, 0.394134969f},
-std::array<float,2>{0.682156026f, 0.529939055f},
-std::array<float,2>{0.356996238f, 0.842974246f},
-std::array<float,2>{0.786077976f, 0.0961833298f},
-std::array<float,2>{0.385977328f, 0.247956008f},
-std::array<float,2>{0.986501873f, 0.970948458f},
-std::array<float,2>{0.0699428618f, 0.731888771f},
-std::array<float,2>{0.616285801f, 0.310059845f},
-std::array<float,2>{0.423628509f, 0.288762838f},
-std::array<float,2>{0.953969777f, 0.745972097f},
-std::array<float,2>{0.110808358f, 0.991413772f},
-std::array<float,2>{0.589216828f, 0.218935162f},
-std::array<float,2>{0.140516073f, 0.122305863f},
-std::array<float,2>{0.632073522f, 0.827466011f},
-std::array<float,2>{0.342363745f, 0.514002025f},
-std::array<float,2>{0.769113839f, 0.388388157f},
-std::array<float,2>{0.0519427322f, 0.475982726f},
-std::array<float,2>{0.555857062f, 0.598155141f},
-std::array<float,2>{0.461774677f, 0.811289191f},
-std::array<float,2>{0.877946556f, 0.0499028228f},
-std::array<float,2>{0.281826317f, 0.152400866f},
-std::array<float,2>{0.850728333f, 0.932927549f},
-std::array<float,2>{0.197427422f, 0.65011096f},
-std::array<float,2>{0.706715941f, 0.361074418f},
-std::array<float,2>{0.365276605f, 0.416586906f},
-std::array<float,2>{0.799645543f, 0.541006327f},
-std::array<float,2>{0.156753093f, 0.868819296f},
-std::array<float,2>{0.667690992f, 0.0730779842f},
-std::array<float,2>{0.0888147652f, 0.2183038f},
-std::array<float,2>{0.594354272f, 0.946790755f},
-std::array<float,2>{0.394556016f, 0.690365613f},
-std::array<float,2>{0.975693285f, 0.276560396f},
-std::array<float,2>{0.227338254f, 0.321907252f},
-std::array<float,2>{0.727822125f, 0.674130321f},
-std::array<float,2>{0.263290882f, 0.88114655f},
-std::array<float,2>{0.827835381f, 0.178670242f},
-std::array<float,2>{0.492476076f, 0.0244800784f},
-std::array<float,2>{0.922290623f, 0.778355956f},
-std::array<float,2>{0.0247027539f, 0.573403537f},
-std::array<float,2>{0.518489242f, 0.439715683f},
-std::array<float,2>{0.405215263f, 0.376838684f},
-std::array<float,2>{0.981343448f, 0.503432631f},
-std::array<float,2>{0.085861519f, 0.817165256f},
-std::array<float,2>{0.609245896f, 0.110844456f},
-std::array<float,2>{0.167299777f, 0.230564654f},
-std::array<float,2>{0.663598895f, 0.9975034f},
-std::array<float,2>{0.373900324f, 0.737841308f},
-std::array<float,2>{0.805918813f, 0.2915968f},
-std::array<float,2>{0.0166955013f, 0.368896723f},
-std::array<float,2>{0.529718578f, 0.64509815f},
-std::array<float,2>{0.485683918f, 0.925395012f},
-std::array<float,2>{0.9335531f, 0.14325422f},
-std::array<float,2>{0.256408423f, 0.0578868166f},
-std::array<float,2>{0.815183759f, 0.80256331f},
-std::array<float,2>{0.222386762f, 0.601906836f},
-std::array<float,2>{0.719715118f, 0.483485878f},
-std::array<float,2>{0.334330291f, 0.26681295f},
-std::array<float,2>{0.778441012f, 0.698855579f},
-std::array<float,2>{0.132351145f, 0.941688836f},
-std::array<float,2>{0.636164725f, 0.206043035f},
-std::array<float,2>{0.123920023f, 0.0679342523f},
-std::array<float,2>{0.580765009f, 0.865360081f},
-std::array<float,2>{0.431955427f, 0.535072982f},
-std::array<float,2>{0.967110813f, 0.412425637f},
-std::array<float,2>{0.192507505f, 0.447959572f},
-std::array<float,2>{0.714514971f, 0.564879775f},
-std::array<float,2>{0.294221878f, 0.765817046f},
-std::array<float,2>{0.857642233f, 0.0181093924f},
-std::array<float,2>{0.454606146f, 0.180941775f},
-std::array<float,2>{0.888781548f, 0.885387361f},
-std::array<float,2>{0.0603404865f, 0.681119144f},
-std::array<float,2>{0.553315759f, 0.316958129f},
-std::array<float,2>{0.476865768f, 0.332703561f},
-std::array<float,2>{0.908307374f, 0.666391194f},
-std::array<float,2>{0.00905753952f, 0.900485218f},
-std::array<float,2>{0.505258203f, 0.161300078f},
-std::array<float,2>{0.243809372f, 0.0108181434f},
-std::array<float,2>{0.749077857f, 0.750688016f},
-std::array<float,2>{0.273280442f, 0.583190024f},
-std::array<float,2>{0.832945287f, 0.463261068f},
-std::array<float,2>{0.0775434226f, 0.425924182f},
-std::array<float,2>{0.619703233f, 0.551300347f},
-std::array<float,2>{0.375630349f, 0.845551968f},
-std::array<float,2>{0.996278524f, 0.0918077379f},
-std::array<float,2>{0.350059211f, 0.196623757f},
-std::array<float,2>{0.790859342f, 0.966127098f},
-std::array<float,2>{0.172752351f, 0.70800972f},
-std::array<float,2>{0.67514956f, 0.250098675f},
-std::array<float,2>{0.298550278f, 0.49030295f},
-std::array<float,2>{0.867312729f, 0.614659548f},
-std::array<float,2>{0.209433928f, 0.784618258f},
-std::array<float,2>{0.688278973f, 0.0323684514f},
-std::array<float,2>{0.0353029817f, 0.139009297f},
-std::array<float,2>{0.538393974f, 0.913414478f},
-std::array<float,2>{0.449884593f, 0.634004354f},
-std::array<float,2>{0.897988379f, 0.356688619f},
-std::array<float,2>{0.14506641f, 0.303709149f},
-std::array<float,2>{0.650641263f, 0.725530446f},
-std::array<float,2>{0.320738345f, 0.977227211f},
-std::array<float,2>{0.754151881f, 0.237159178f},
-std::array<float,2>{0.415658563f, 0.104215831f},
-std::array<float,2>{0.943728328f, 0.835515201f},
-std::array<float,2>{0.0951257944f, 0.520557761f},
-std::array<float,2>{0.573678493f, 0.400718927f},
-std::array<float,2>{0.491879791f, 0.430353224f},
-std::array<float,2>{0.935217261f, 0.556152821f},
-std::array<float,2>{0.0213308018f, 0.8536309f},
-std::array<float,2>{0.524668276f, 0.0851165876f},
-std::array<float,2>{0.22340323f, 0.19463107f},
-std::array<float,2>{0.723242223f, 0.956982255f},
-std::array<float,2>{0.251555353f, 0.718008339f},
-std::array<float,2>{0.820052266f, 0.263226688f},
-std::array<float,2>{0.0795622468f, 0.342292428f},
-std::array<float,2>{0.602891326f, 0.656909883f},
-std::array<float,2>{0.402095795f, 0.895855725f},
-std::array<float,2>{0.980322123f, 0.170809984f},
-std::array<float,2>{0.369917214f, 0.00116410514f},
-std::array<float,2>{0.809327245f, 0.76344949f},
-std::array<float,2>{0.169880018f, 0.592734456f},
-std::array<float,2>{0.658999622f, 0.456357598f},
-std::array<float,2>{0.292224675f, 0.305257022f},
-std::array<float,2>{0.853913605f, 0.728496075f},
-std::array<float,2>{0.191397548f, 0.974281847f},
-std::array<float,2>{0.718138337f, 0.242621988f},
-std::array<float,2>{0.0550372787f, 0.100583807f},
-std::array<float,2>{0.54811883f, 0.836445272f},
-std::array<float,2>{0.460169196f, 0.526655257f},
-std::array<float,2>{0.883158684f, 0.398417622f},
-std::array<float,2>{0.125211388f, 0.494605601f},
-std::array<float,2>{0.639188528f, 0.623467982f},
-std::array<float,2>{0.331473827f, 0.793812573f},
-std::array<float,2>{0.77440387f, 0.0433725417f},
-std::array<float,2>{0.434805006f, 0.132295147f},
-std::array<float,2>{0.962185442f, 0.92110312f},
-std::array<float,2>{0.119818181f, 0.62768507f},
-std::array<float,2>{0.583719432f, 0.348604053f},
-std::array<float,2>{0.381516844f, 0.364703178f},
-std::array<float,2>{0.995920897f, 0.654491067f},
-std::array<float,2>{0.0725783259f, 0.937067032f},
-std::array<float,2>{0.624977231f, 0.148569584f},
-std::array<float,2>{0.178920314f, 0.0521643981f},
-std::array<float,2>{0.67908144f, 0.806472957f},
-std::array<float,2>{0.343770057f, 0.597546697f},
-std::array<float,2>{0.793711483f, 0.468818992f},
-std::array<float,2>{0.0142338434f, 0.383081734f},
-std::array<float,2>{0.500481665f, 0.510973036f},
-std::array<float,2>{0.483608484f, 0.823799193f},
-std::array<float,2>{0.91023761f, 0.117454506f},
-std::array<float,2>{0.267097801f, 0.223730758f},
-std::array<float,2>{0.830329716f, 0.985098362f},
-std::array<float,2>{0.247694507f, 0.749445081f},
-std::array<float,2>{0.744305491f, 0.283853441f},
-std::array<float,2>{0.324775994f, 0.443573147f},
-std::array<float,2>{0.750481665f, 0.577814102f},
-std::array<float,2>{0.142755806f, 0.774525642f},
-std::array<float,2>{0.652776778f, 0.0292784739f},
-std::array<float,2>{0.0991174653f, 0.172435164f},
-std::array<float,2>{0.575540006f, 0.876752853f},
-std::array<float,2>{0.418376744f, 0.6786865f},
-std::array<float,2>{0.937679589f, 0.326535344f},
-std::array<float,2>{0.20680432f, 0.277565241f},
-std::array<float,2>{0.694930673f, 0.69336307f},
-std::array<float,2>{0.303045481f, 0.952558577f},
-std::array<float,2>{0.873310566f, 0.211852521f},
-std::array<float,2>{0.44856146f, 0.0746169388f},
-std::array<float,2>{0.892697692f, 0.873618066f},
-std::array<float,2>{0.0323470049f, 0.544189274f},
-std::array<float,2>{0.531990767f, 0.419507474f},
-std::array<float,2>{0.411962539f, 0.478655845f},
-std::array<float,2>{0.949726582f, 0.608514249f},
-std::array<float,2>{0.105421141f, 0.797185302f},
-std::array<float,2>{0.569993973f, 0.059121456f},
-std::array<float,2>{0.149453014f, 0.146171749f},
-std::array<float,2>{0.647516191f, 0.929050326f},
-std::array<float,2>{0.312964857f, 0.642487764f},
-std::array<float,2>{0.75850606f, 0.373022139f},
-std::array<float,2>{0.0455820076f, 0.29529205f},
-std::array<float,2>{0.545849383f, 0.739124417f},
-std::array<float,2>{0.443093479f, 0.995325744f},
-std::array<float,2>{0.900590241f, 0.230036944f},
-std::array<float,2>{0.308869213f, 0.114916228f},
-std::array<float,2>{0.860155404f, 0.815524995f},
-std::array<float,2>{0.215674222f, 0.507419646f},
-std::array<float,2>{0.698975205f, 0.381061077f},
-std::array<float,2>{0.351616949f, 0.314021796f},
-std::array<float,2>{0.782245457f, 0.685606539f},
-std::array<float,2>{0.186698034f, 0.888883889f},
-std::array<float,2>{0.686518729f, 0.187176213f},
-std::array<float,2>{0.0643570423f, 0.0213451236f},
-std::array<float,2>{0.611453056f, 0.772267759f},
-std::array<float,2>{0.390512437f, 0.569202781f},
-std::array<float,2>{0.99109441f, 0.451381177f},
-std::array<float,2>{0.236326292f, 0.409065813f},
-std::array<float,2>{0.734567463f, 0.536970198f},
-std::array<float,2>{0.275233626f, 0.859512329f},
-std::array<float,2>{0.840264976f, 0.0662276968f},
-std::array<float,2>{0.475220442f, 0.208490953f},
-std::array<float,2>{0.917110085f, 0.941145718f},
-std::array<float,2>{0.00119826675f, 0.701194346f},
-std::array<float,2>{0.509705722f, 0.272409886f},
-std::array<float,2>{0.466732591f, 0.257572263f},
-std::array<float,2>{0.879051089f, 0.705828965f},
-std::array<float,2>{0.050425943f, 0.963750124f},
-std::array<float,2>{0.558669686f, 0.199776113f},
-std::array<float,2>{0.200597152f, 0.0865621492f},
-std::array<float,2>{0.710163057f, 0.848393798f},
-std::array<float,2>{0.287642807f, 0.547718287f},
-std::array<float,2>{0.844391346f, 0.424271524f},
-std::array<float,2>{0.115266763f, 0.467333764f},
-std::array<float,2>{0.590999782f, 0.578658044f},
-std::array<float,2>{0.4271788f, 0.754335701f},
-std::array<float,2>{0.959447443f, 0.0149267484f},
-std::array<float,2>{0.339316756f, 0.159555629f},
-std::array<float,2>{0.771224082f, 0.90393579f},
-std::array<float,2>{0.133149177f, 0.670285761f},
-std::array<float,2>{0.62764442f, 0.329068691f},
-std::array<float,2>{0.259919703f, 0.402841538f},
-std::array<float,2>{0.822273314f, 0.518701494f},
-std::array<float,2>{0.233317032f, 0.828670382f},
-std::array<float,2>{0.732240677f, 0.108900137f},
-std::array<float,2>{0.0308757797f, 0.238629952f},
-std::array<float,2>{0.522331178f, 0.98185581f},
-std::array<float,2>{0.499669641f, 0.721563339f},
-std::array<float,2>{0.92898047f, 0.30043593f},
-std::array<float,2>{0.163961455f, 0.353236407f},
-std::array<float,2>{0.670699f, 0.638418913f},
-std::array<float,2>{0.362788051f, 0.909633577f},
-std::array<float,2>{0.803265512f, 0.135696083f},
-std::array<float,2>{0.392124414f, 0.0352196395f},
-std::array<float,2>{0.969474614f, 0.788487434f},
-std::array<float,2>{0.0914687738f, 0.611647844f},
-std::array<float,2>{0.59820509f, 0.487654388f},
-std::array<float,2>{0.469591618f, 0.497208208f},
-std::array<float,2>{0.918684006f, 0.61982584f},
-std::array<float,2>{0.0054356046f, 0.790480494f},
-std::array<float,2>{0.515160203f, 0.0404193923f},
-std::array<float,2>{0.240788549f, 0.126101896f},
-std::array<float,2>{0.741853297f, 0.915272415f},
-std::array<float,2>{0.278112084f, 0.630609691f},
-std::array<float,2>{0.837619781f, 0.347352833f},
-std::array<float,2>{0.0680673793f, 0.312217087f},
-std::array<float,2>{0.613986075f, 0.733649194f},
-std::array<float,2>{0.384237707f, 0.969862819f},
-std::array<float,2>{0.985753775f, 0.248620898f},
-std::array<float,2>{0.358375281f, 0.0945384651f},
-std::array<float,2>{0.787605584f, 0.840666652f},
-std::array<float,2>{0.180827349f, 0.527512729f},
-std::array<float,2>{0.681117296f, 0.391565144f},
-std::array<float,2>{0.307603627f, 0.338303953f},
-std::array<float,2>{0.866866112f, 0.660932362f},
-std::array<float,2>{0.214200333f, 0.892445803f},
-std::array<float,2>{0.702522159f, 0.164651588f},
-std::array<float,2>{0.039597448f, 0.00523351599f},
-std::array<float,2>{0.540609956f, 0.759627283f},
-std::array<float,2>{0.441316158f, 0.588831246f},
-std::array<float,2>{0.903379858f, 0.458967358f},
-std::array<float,2>{0.153639674f, 0.436815888f},
-std::array<float,2>{0.641136885f, 0.559069812f},
-std::array<float,2>{0.317598134f, 0.855642319f},
-std::array<float,2>{0.765203655f, 0.0816070884f},
-std::array<float,2>{0.407712847f, 0.191249102f},
-std::array<float,2>{0.945909798f, 0.958677351f},
-std::array<float,2>{0.107792921f, 0.714199781f},
-std::array<float,2>{0.565104902f, 0.260582358f},
-std::array<float,2>{0.39732936f, 0.27384454f},
-std::array<float,2>{0.974603415f, 0.688499331f},
-std::array<float,2>{0.0873293504f, 0.947780967f},
-std::array<float,2>{0.597075403f, 0.215256244f},
-std::array<float,2>{0.15942803f, 0.0706480816f},
-std::array<float,2>{0.66589427f, 0.870425642f},
-std::array<float,2>{0.365095139f, 0.542153835f},
-std::array<float,2>{0.798642695f, 0.415106237f},
-std::array<float,2>{0.0259121712f, 0.437769353f},
-std::array<float,2>{0.516904891f, 0.571929812f},
-std::array<float,2>{0.495417982f, 0.780083537f},
-std::array<float,2>{0.924185872f, 0.0258352868f},
-std::array<float,2>{0.264214218f, 0.17698352f},
-std::array<float,2>{0.824591696f, 0.879487514f},
-std::array<float,2>{0.229778588f, 0.673705459f},
-std::array<float,2>{0.730372012f, 0.322509229f},
-std::array<float,2>{0.341174722f, 0.390420735f},
-std::array<float,2>{0.767541766f, 0.513073206f},
-std::array<float,2>{0.138623029f, 0.825276673f},
-std::array<float,2>{0.629377723f, 0.124065407f},
-std::array<float,2>{0.112817623f, 0.221869066f},
-std::array<float,2>{0.586398721f, 0.990013957f},
-std::array<float,2>{0.42462486f, 0.742601156f},
-std::array<float,2>{0.956656516f, 0.285650343f},
-std::array<float,2>{0.196969301f, 0.362589419f},
-std::array<float,2>{0.704571962f, 0.652014136f},
-std::array<float,2>{0.285013705f, 0.929939568f},
-std::array<float,2>{0.848092198f, 0.154701799f},
-std::array<float,2>{0.46315226f, 0.0487864763f},
-std::array<float,2>{0.875087976f, 0.809422314f},
-std::array<float,2>{0.054347232f, 0.600875616f},
-std::array<float,2>{0.557745159f, 0.474001348f},
-std::array<float,2>{0.431147695f, 0.411011517f},
-std::array<float,2>{0.966058791f, 0.532354653f},
-std::array<float,2>{0.121163547f, 0.864351392f},
-std::array<float,2>{0.578897774f, 0.0689253435f},
-std::array<float,2>{0.130761713f, 0.203613102f},
-std::array<float,2>{0.634542644f, 0.944528043f},
-std::array<float,2>{0.333009869f, 0.695473492f},
-std::array<float,2>{0.780197561f, 0.268520921f},
-std::array<float,2>{0.0617776401f, 0.318811595f},
-std::array<float,2>{0.551541626f, 0.68322438f},
-std::array<float,2>{0.456680208f, 0.883777261f},
-std::array<float,2>{0.88740623f, 0.183106318f},
-std::array<float,2>{0.29671979f, 0.0173845198f},
-std::array<float,2>{0.855920374f, 0.769361854f},
-std::array<float,2>{0.194032669f, 0.562568426f},
-std::array<float,2>{0.711203933f, 0.446242601f},
-std::array<float,2>{0.371899545f, 0.289944202f},
-std::array<float,2>{0.806774139f, 0.734781265f},
-std::array<float,2>{0.164307132f, 0.999960065f},
-std::array<float,2>{0.660170317f, 0.232795179f},
-std::array<float,2>{0.0837731883f, 0.112539969f},
-std::array<float,2>{0.606842518f, 0.818471491f},
-std::array<float,2>{0.402588069f, 0.500526249f},
-std::array<float,2>{0.983595312f, 0.37880066f},
-std::array<float,2>{0.219552845f, 0.482338876f},
-std::array<float,2>{0.721780241f, 0.604002535f},
-std::array<float,2>{0.255658031f, 0.804626167f},
-std::array<float,2>{0.812920213f, 0.0559005812f},
-std::array<float,2>{0.486786842f, 0.142362505f},
-std::array<float,2>{0.931514263f, 0.922623098f},
-std::array<float,2>{0.0193425212f, 0.646674335f},
-std::array<float,2>{0.527735949f, 0.370180637f},
-std::array<float,2>{0.451411843f, 0.359109223f},
-std::array<float,2>{0.895703673f, 0.63508296f},
-std::array<float,2>{0.0372879989f, 0.910433233f},
-std::array<float,2>{0.536361337f, 0.13795191f},
-std::array<float,2>{0.207506239f, 0.0351485051f},
-std::array<float,2>{0.690248132f, 0.782658279f},
-std::array<float,2>{0.299550861f, 0.61654067f},
-std::array<float,2>{0.869779825f, 0.489712268f},
-std::array<float,2>{0.0967321843f, 0.400349408f},
-std::array<float,2>{0.571823478f, 0.52193135f},
-std::array<float,2>{0.41638419f, 0.833449602f},
-std::array<float,2>{0.942303538f, 0.102459304f},
-std::array<float,2>{0.324057251f, 0.2345469f},
-std::array<float,2>{0.756191671f, 0.978997767f},
-std::array<float,2>{0.146605879f, 0.723480344f},
-std::array<float,2>{0.650282204f, 0.302306384f},
-std::array<float,2>{0.270500958f, 0.462003917f},
-std::array<float,2>{0.83532393f, 0.584044755f},
-std::array<float,2>{0.245710999f, 0.752596796f},
-std::array<float,2>{0.746170878f, 0.00838409271f},
-std::array<float,2>{0.0110969758f, 0.162531629f},
-std::array<float,2>{0.506296515f, 0.899710596f},
-std::array<float,2>{0.480185598f, 0.665704906f},
-std::array<float,2>{0.907256901f, 0.334736139f},
-std::array<float,2>{0.17418468f, 0.253888458f},
-std::array<float,2>{0.672955871f, 0.710301816f},
-std::array<float,2>{0.348351449f, 0.968495071f},
-std::array<float,2>{0.792811632f, 0.19773896f},
-std::array<float,2>{0.377162248f, 0.0910127759f},
-std::array<float,2>{0.998243928f, 0.846618235f},
-std::array<float,2>{0.075578928f, 0.55378592f},
-std::array<float,2>{0.619045854f, 0.428784102f},
-std::array<float,2>{0.458978653f, 0.395016819f},
-std::array<float,2>{0.886705279f, 0.523861647f},
-std::array<float,2>{0.0581384301f, 0.839212656f},
-std::array<float,2>{0.550747693f, 0.099401325f},
-std::array<float,2>{0.189359277f, 0.24497579f},
-std::array<float,2>{0.715854406f, 0.975650907f},
-std::array<float,2>{0.289371967f, 0.729979634f},
-std::array<float,2>{0.853117406f, 0.30857718f},
-std::array<float,2>{0.117978178f, 0.350877047f},
-std::array<float,2>{0.584095478f, 0.626533389f},
-std::array<float,2>{0.435782909f, 0.91988349f},
-std::array<float,2>{0.963934958f, 0.129224971f},
-std::array<float,2>{0.329977125f, 0.0465558581f},
-std::array<float,2>{0.776741147f, 0.796177208f},
-std::array<float,2>{0.126966089f, 0.62277782f},
-std::array<float,2>{0.637466192f, 0.492221534f},
-std::array<float,2>{0.252432227f, 0.263857216f},
-std::array<float,2>{0.818022549f, 0.71675235f},
-std::array<float,2>{0.226412788f, 0.953770041f},
-std::array<float,2>{0.724874973f, 0.192123994f},
-std::array<float,2>{0.0218412615f, 0.0822632909f},
-std::array<float,2>{0.525612831f, 0.853230834f},
-std::array<float,2>{0.489836097f, 0.557404876f},
-std::array<float,2>{0.93620795f, 0.432484239f},
-std::array<float,2>{0.170980722f, 0.454194635f},
-std::array<float,2>{0.657065153f, 0.591264844f},
-std::array<float,2>{0.36848399f, 0.763813019f},
-std::array<float,2>{0.811496496f, 0.00202563009f},
-std::array<float,2>{0.399316221f, 0.168757051f},
-std::array<float,2>{0.977955461f, 0.896942317f},
-std::array<float,2>{0.0807574466f, 0.659792006f},
-std::array<float,2>{0.604118705f, 0.341073394f},
-std::array<float,2>{0.420589119f, 0.325208992f},
-std::array<float,2>{0.940856993f, 0.676902235f},
-std::array<float,2>{0.100951612f, 0.878171265f},
-std::array<float,2>{0.577910542f, 0.174202025f},
-std::array<float,2>{0.142052904f, 0.030501835f},
-std::array<float,2>{0.655146718f, 0.775928438f},
-std::array<float,2>{0.327055603f, 0.575633943f},
-std::array<float,2>{0.753460944f, 0.442066997f},
-std::array<float,2>{0.0335130692f, 0.42059952f},
-std::array<float,2>{0.534540355f, 0.546090484f},
-std::array<float,2>{0.445832998f, 0.872033596f},
-std::array<float,2>{0.891546547f, 0.0777082071f},
-std::array<float,2>{0.302286893f, 0.213370427f},
-std::array<float,2>{0.871352971f, 0.949898243f},
-std::array<float,2>{0.203258038f, 0.69144398f},
-std::array<float,2>{0.692767203f, 0.27965796f},
-std::array<float,2>{0.347199172f, 0.472344279f},
-std::array<float,2>{0.796802461f, 0.595257998f},
-std::array<float,2>{0.177400798f, 0.806684315f},
-std::array<float,2>{0.676727295f, 0.0539971367f},
-std::array<float,2>{0.0707056671f, 0.150918871f},
-std::array<float,2>{0.622048199f, 0.934193432f},
-std::array<float,2>{0.379285008f, 0.653374255f},
-std::array<float,2>{0.992861748f, 0.366543293f},
-std::array<float,2>{0.248477265f, 0.281734884f},
-std::array<float,2>{0.743294179f, 0.746115208f},
-std::array<float,2>{0.268924505f, 0.9874506f},
-std::array<float,2>{0.829408169f, 0.226479143f},
-std::array<float,2>{0.481137335f, 0.121000849f},
-std::array<float,2>{0.913167894f, 0.821681857f},
-std::array<float,2>{0.0131382048f, 0.508682668f},
-std::array<float,2>{0.50316751f, 0.386503309f},
-std::array<float,2>{0.388529271f, 0.449281275f},
-std::array<float,2>{0.988553464f, 0.567650855f},
-std::array<float,2>{0.0644773617f, 0.771072984f},
-std::array<float,2>{0.609762073f, 0.0217649806f},
-std::array<float,2>{0.183622271f, 0.185527638f},
-std::array<float,2>{0.685429037f, 0.886789441f},
-std::array<float,2>{0.353672296f, 0.685336173f},
-std::array<float,2>{0.784345329f, 0.314837396f},
-std::array<float,2>{0.00379452761f, 0.270862073f},
-std::array<float,2>{0.510741055f, 0.699459255f},
-std::array<float,2>{0.474269509f, 0.938811362f},
-std::array<float,2>{0.914435029f, 0.210713536f},
-std::array<float,2>{0.276385665f, 0.063101083f},
-std::array<float,2>{0.842652261f, 0.863115132f},
-std::array<float,2>{0.236472458f, 0.538527846f},
-std::array<float,2>{0.738220632f, 0.408004612f},
-std::array<float,2>{0.315549135f, 0.374512494f},
-std::array<float,2>{0.760707974f, 0.64419204f},
-std::array<float,2>{0.150453657f, 0.927413642f},
-std::array<float,2>{0.6459288f, 0.147909328f},
-std::array<float,2>{0.10301587f, 0.0607769266f},
-std::array<float,2>{0.568251789f, 0.800755739f},
-std::array<float,2>{0.412547559f, 0.605514228f},
-std::array<float,2>{0.952545702f, 0.477703393f},
-std::array<float,2>{0.217685848f, 0.379150838f},
-std::array<float,2>{0.696971476f, 0.505401254f},
-std::array<float,2>{0.311454713f, 0.812696755f},
-std::array<float,2>{0.861965001f, 0.115431175f},
-std::array<float,2>{0.444673061f, 0.227845937f},
-std::array<float,2>{0.899811149f, 0.993626118f},
-std::array<float,2>{0.0441770665f, 0.740563929f},
-std::array<float,2>{0.54345727f, 0.293496549f},
-std::array<float,2>{0.497095257f, 0.298424453f},
-std::array<float,2>{0.926145434f, 0.720631659f},
-std::array<float,2>{0.0279048942f, 0.9842816f},
-std::array<float,2>{0.519790351f, 0.240329802f},
-std::array<float,2>{0.231476322f, 0.105914801f},
-std::array<float,2>{0.73433888f, 0.8319664f},
-std::array<float,2>{0.259735346f, 0.517234981f},
-std::array<float,2>{0.820808053f, 0.404415131f},
-std::array<float,2>{0.0929564312f, 0.484991163f},
-std::array<float,2>{0.601041377f, 0.609830678f},
-std::array<float,2>{0.392720997f, 0.785303235f},
-std::array<float,2>{0.972321868f, 0.0388877317f},
-std::array<float,2>{0.360117346f, 0.134118363f},
-std::array<float,2>{0.801501453f, 0.908025563f},
-std::array<float,2>{0.160622805f, 0.638869464f},
-std::array<float,2>{0.668531477f, 0.353532135f},
-std::array<float,2>{0.287030607f, 0.423570305f},
-std::array<float,2>{0.847366452f, 0.549626648f},
-std::array<float,2>{0.202521756f, 0.849981129f},
-std::array<float,2>{0.708861291f, 0.0894148946f},
-std::array<float,2>{0.0471120663f, 0.201389208f},
-std::array<float,2>{0.562295794f, 0.962864041f},
-std::array<float,2>{0.467312992f, 0.704507649f},
-std::array<float,2>{0.881378174f, 0.255381823f},
-std::array<float,2>{0.136597365f, 0.330796301f},
-std::array<float,2>{0.625334918f, 0.669098794f},
-std::array<float,2>{0.337775081f, 0.904919624f},
-std::array<float,2>{0.772065043f, 0.156486526f},
-std::array<float,2>{0.429682493f, 0.0122765927f},
-std::array<float,2>{0.958810031f, 0.756963909f},
-std::array<float,2>{0.114028402f, 0.580462098f},
-std::array<float,2>{0.593269527f, 0.466387391f},
-std::array<float,2>{0.462309361f, 0.473285258f},
-std::array<float,2>{0.876992166f, 0.600050509f},
-std::array<float,2>{0.0509888008f, 0.81040442f},
-std::array<float,2>{0.5548352f, 0.0471407659f},
-std::array<float,2>{0.199098423f, 0.156050429f},
-std::array<float,2>{0.705514252f, 0.931536734f},
-std::array<float,2>{0.282591969f, 0.650749803f},
-std::array<float,2>{0.850353062f, 0.362033665f},
-std::array<float,2>{0.109627582f, 0.286992192f},
-std::array<float,2>{0.588770986f, 0.743254721f},
-std::array<float,2>{0.422050714f, 0.98847568f},
-std::array<float,2>{0.954602957f, 0.221375942f},
-std::array<float,2>{0.342887312f, 0.12379463f},
-std::array<float,2>{0.767692804f, 0.82495296f},
-std::array<float,2>{0.139204606f, 0.512050688f},
-std::array<float,2>{0.631114483f, 0.389201552f},
-std::array<float,2>{0.262692511f, 0.323327631f},
-std::array<float,2>{0.826446652f, 0.672722995f},
-std::array<float,2>{0.227883548f, 0.880391419f},
-std::array<float,2>{0.726568818f, 0.176080167f},
-std::array<float,2>{0.0240097977f, 0.0267134346f},
-std::array<float,2>{0.519203067f, 0.780777931f},
-std::array<float,2>{0.493963271f, 0.570718884f},
-std::array<float,2>{0.923002303f, 0.439052671f},
-std::array<float,2>{0.157304719f, 0.414509773f},
-std::array<float,2>{0.666880488f, 0.541697979f},
-std::array<float,2>{0.366822571f, 0.869633973f},
-std::array<float,2>{0.800752997f, 0.0715575293f},
-std::array<float,2>{0.396216154f, 0.216117948f},
-std::array<float,2>{0.975040197f, 0.949193835f},
-std::array<float,2>{0.0892172009f, 0.688156128f},
-std::array<float,2>{0.595068455f, 0.274623275f},
-std::array<float,2>{0.40984416f, 0.261514992f},
-std::array<float,2>{0.94837147f, 0.713714659f},
-std::array<float,2>{0.106183313f, 0.957153261f},
-std::array<float,2>{0.563631177f, 0.190384239f},
-std::array<float,2>{0.155653253f, 0.0805352703f},
-std::array<float,2>{0.643466175f, 0.85707444f},
-std::array<float,2>{0.318540514f, 0.559865832f},
-std::array<float,2>{0.76356709f, 0.436209917f},
-std::array<float,2>{0.042928949f, 0.457740366f},
-std::array<float,2>{0.542739391f, 0.589382291f},
-std::array<float,2>{0.438418418f, 0.758641422f},
-std::array<float,2>{0.905943334f, 0.00438513979f},
-std::array<float,2>{0.30504626f, 0.165755108f},
-std::array<float,2>{0.864212513f, 0.89130652f},
-std::array<float,2>{0.212692514f, 0.66160816f},
-std::array<float,2>{0.699688375f, 0.338950425f},
-std::array<float,2>{0.355856746f, 0.392570078f},
-std::array<float,2>{0.786379635f, 0.528793573f},
-std::array<float,2>{0.183388188f, 0.84142381f},
-std::array<float,2>{0.683450341f, 0.0952146426f},
-std::array<float,2>{0.0691024736f, 0.249802947f},
-std::array<float,2>{0.615461886f, 0.968924642f},
-std::array<float,2>{0.385368049f, 0.733147383f},
-std::array<float,2>{0.987375855f, 0.310631514f},
-std::array<float,2>{0.238444135f, 0.345814854f},
-std::array<float,2>{0.738932788f, 0.628982246f},
-std::array<float,2>{0.279417783f, 0.914288044f},
-std::array<float,2>{0.838941753f, 0.125721663f},
-std::array<float,2>{0.472124487f, 0.0392764136f},
-std::array<float,2>{0.920943499f, 0.789691925f},
-std::array<float,2>{0.00695381919f, 0.620277941f},
-std::array<float,2>{0.513193071f, 0.496933371f},
-std::array<float,2>{0.376276165f, 0.428298771f},
-std::array<float,2>{0.997104466f, 0.553572357f},
-std::array<float,2>{0.0771122351f, 0.847043633f},
-std::array<float,2>{0.620845795f, 0.0903812423f},
-std::array<float,2>{0.17329438f, 0.199121296f},
-std::array<float,2>{0.674665987f, 0.96729815f},
-std::array<float,2>{0.35122937f, 0.709716022f},
-std::array<float,2>{0.789812684f, 0.252168953f},
-std::array<float,2>{0.00849050935f, 0.335092485f},
-std::array<float,2>{0.504561126f, 0.664573133f},
-std::array<float,2>{0.477704287f, 0.899209261f},
-std::array<float,2>{0.909486294f, 0.163093984f},
-std::array<float,2>{0.271952569f, 0.00914976187f},
-std::array<float,2>{0.833684385f, 0.753428102f},
-std::array<float,2>{0.24281311f, 0.585917711f},
-std::array<float,2>{0.748737395f, 0.461202085f},
-std::array<float,2>{0.322225392f, 0.301379681f},
-std::array<float,2>{0.755716324f, 0.724544287f},
-std::array<float,2>{0.145681888f, 0.98022455f},
-std::array<float,2>{0.651778162f, 0.235647991f},
-std::array<float,2>{0.0947033018f, 0.103005588f},
-std::array<float,2>{0.572407126f, 0.832141995f},
-std::array<float,2>{0.414997727f, 0.523331225f},
-std::array<float,2>{0.944792211f, 0.398790479f},
-std::array<float,2>{0.210926011f, 0.488662869f},
-std::array<float,2>{0.689049125f, 0.615300715f},
-std::array<float,2>{0.297200054f, 0.78136605f},
-std::array<float,2>{0.868707597f, 0.0339199491f},
-std::array<float,2>{0.450867921f, 0.137538806f},
-std::array<float,2>{0.896908343f, 0.912028313f},
-std::array<float,2>{0.0363696814f, 0.636600256f},
-std::array<float,2>{0.537921071f, 0.35779655f},
-std::array<float,2>{0.485122025f, 0.369566888f},
-std::array<float,2>{0.932038069f, 0.647570729f},
-std::array<float,2>{0.0163243487f, 0.923167765f},
-std::array<float,2>{0.530756474f, 0.141428411f},
-std::array<float,2>{0.220850825f, 0.0551743731f},
-std::array<float,2>{0.72007668f, 0.803470552f},
-std::array<float,2>{0.257765502f, 0.605028093f},
-std::array<float,2>{0.815822899f, 0.481022149f},
-std::array<float,2>{0.0845830366f, 0.377273411f},
-std::array<float,2>{0.608006895f, 0.501632392f},
-std::array<float,2>{0.405471772f, 0.819451571f},
-std::array<float,2>{0.982339382f, 0.111722402f},
-std::array<float,2>{0.374039531f, 0.233627126f},
-std::array<float,2>{0.804690003f, 0.998529196f},
-std::array<float,2>{0.166737914f, 0.735357463f},
-std::array<float,2>{0.662959516f, 0.290348649f},
-std::array<float,2>{0.293928087f, 0.447078973f},
-std::array<float,2>{0.859047592f, 0.564246595f},
-std::array<float,2>{0.191931292f, 0.768422484f},
-std::array<float,2>{0.713245988f, 0.015898997f},
-std::array<float,2>{0.0590406321f, 0.182112291f},
-std::array<float,2>{0.554658115f, 0.884296954f},
-std::array<float,2>{0.454008996f, 0.681741476f},
-std::array<float,2>{0.890618861f, 0.319715708f},
-std::array<float,2>{0.131649867f, 0.269139558f},
-std::array<float,2>{0.634853184f, 0.697121501f},
-std::array<float,2>{0.335147411f, 0.944042027f},
-std::array<float,2>{0.778006434f, 0.204211876f},
-std::array<float,2>{0.433383375f, 0.0698153973f},
-std::array<float,2>{0.967928469f, 0.863595784f},
-std::array<float,2>{0.124554001f, 0.531826735f},
-std::array<float,2>{0.581499755f, 0.411344945f},
-std::array<float,2>{0.482939452f, 0.385579497f},
-std::array<float,2>{0.911202908f, 0.509541512f},
-std::array<float,2>{0.0150231877f, 0.820562422f},
-std::array<float,2>{0.501607239f, 0.119415142f},
-std::array<float,2>{0.246932954f, 0.224975333f},
-std::array<float,2>{0.745265424f, 0.986459911f},
-std::array<float,2>{0.266118407f, 0.748015821f},
-std::array<float,2>{0.831416488f, 0.28315255f},
-std::array<float,2>{0.073881574f, 0.366168231f},
-std::array<float,2>{0.623353601f, 0.652891874f},
-std::array<float,2>{0.382318497f, 0.935260534f},
-std::array<float,2>{0.994346857f, 0.152299672f},
-std::array<float,2>{0.344753325f, 0.053472966f},
-std::array<float,2>{0.794649482f, 0.808048725f},
-std::array<float,2>{0.178334281f, 0.594674349f},
-std::array<float,2>{0.677832246f, 0.471317083f},
-std::array<float,2>{0.304619312f, 0.280342281f},
-std::array<float,2>{0.87432766f, 0.692616582f},
-std::array<float,2>{0.205678955f, 0.951086581f},
-std::array<float,2>{0.693770945f, 0.213954031f},
-std::array<float,2>{0.0314157158f, 0.0763906017f},
-std::array<float,2>{0.532708824f, 0.872623205f},
-std::array<float,2>{0.447706878f, 0.545452952f},
-std::array<float,2>{0.894243419f, 0.421576798f},
-std::array<float,2>{0.144520774f, 0.442502886f},
-std::array<float,2>{0.65405792f, 0.574284434f},
-std::array<float,2>{0.325867504f, 0.77642405f},
-std::array<float,2>{0.751773953f, 0.02961291f},
-std::array<float,2>{0.419310063f, 0.175321668f},
-std::array<float,2>{0.93889457f, 0.877906442f},
-std::array<float,2>{0.0977960676f, 0.676676691f},
-std::array<float,2>{0.574554503f, 0.324328661f},
-std::array<float,2>{0.401080012f, 0.339930534f},
-std::array<float,2>{0.978532791f, 0.658324718f},
-std::array<float,2>{0.0782371759f, 0.897786915f},
-std::array<float,2>{0.601973116f, 0.169152901f},
-std::array<float,2>{0.168706104f, 0.00381677574f},
-std::array<float,2>{0.6599406f, 0.765314519f},
-std::array<float,2>{0.370825469f, 0.590352058f},
-std::array<float,2>{0.810244501f, 0.454054445f},
-std::array<float,2>{0.0197373722f, 0.433101356f},
-std::array<float,2>{0.523637176f, 0.558395624f},
-std::array<float,2>{0.490253955f, 0.851650834f},
-std::array<float,2>{0.933739185f, 0.0839736313f},
-std::array<float,2>{0.250469148f, 0.192452535f},
-std::array<float,2>{0.818504095f, 0.954456806f},
-std::array<float,2>{0.224310413f, 0.715061247f},
-std::array<float,2>{0.724207222f, 0.265009403f},
-std::array<float,2>{0.3302733f, 0.493448675f},
-std::array<float,2>{0.774769425f, 0.621107936f},
-std::array<float,2>{0.12692304f, 0.794963181f},
-std::array<float,2>{0.639894724f, 0.0449544266f},
-std::array<float,2>{0.120747164f, 0.130460858f},
-std::array<float,2>{0.582981765f, 0.918865025f},
-std::array<float,2>{0.434505641f, 0.625967205f},
-std::array<float,2>{0.961322367f, 0.350565523f},
-std::array<float,2>{0.189709261f, 0.306946695f},
-std::array<float,2>{0.717244864f, 0.728531361f},
-std::array<float,2>{0.291659862f, 0.975024879f},
-std::array<float,2>{0.855401695f, 0.245987609f},
-std::array<float,2>{0.459512651f, 0.0984670743f},
-std::array<float,2>{0.884721458f, 0.838306785f},
-std::array<float,2>{0.0562910773f, 0.524722338f},
-std::array<float,2>{0.547785878f, 0.395745277f},
-std::array<float,2>{0.426476389f, 0.465215236f},
-std::array<float,2>{0.960065424f, 0.58166647f},
-std::array<float,2>{0.116755038f, 0.75643301f},
-std::array<float,2>{0.590185583f, 0.0133397458f},
-std::array<float,2>{0.133814663f, 0.158023998f},
-std::array<float,2>{0.628497422f, 0.905648649f},
-std::array<float,2>{0.338071615f, 0.668786466f},
-std::array<float,2>{0.76974982f, 0.331537217f},
-std::array<float,2>{0.0493574739f, 0.254471093f},
-std::array<float,2>{0.559728503f, 0.703329086f},
-std::array<float,2>{0.465727568f, 0.961547911f},
-std::array<float,2>{0.880289614f, 0.203019515f},
-std::array<float,2>{0.288767248f, 0.0880773067f},
-std::array<float,2>{0.845506847f, 0.850717068f},
-std::array<float,2>{0.199976027f, 0.550423265f},
-std::array<float,2>{0.709847271f, 0.422155201f},
-std::array<float,2>{0.362077355f, 0.35493204f},
-std::array<float,2>{0.804050386f, 0.640180767f},
-std::array<float,2>{0.162998557f, 0.906662107f},
-std::array<float,2>{0.6713202f, 0.13316223f},
-std::array<float,2>{0.0906293765f, 0.0371860154f},
-std::array<float,2>{0.598821163f, 0.786753714f},
-std::array<float,2>{0.391423613f, 0.610991478f},
-std::array<float,2>{0.970157504f, 0.48612833f},
-std::array<float,2>{0.234240994f, 0.406159997f},
-std::array<float,2>{0.731420696f, 0.51657033f},
-std::array<float,2>{0.260948867f, 0.830696285f},
-std::array<float,2>{0.823884726f, 0.106765024f},
-std::array<float,2>{0.498818249f, 0.241317645f},
-std::array<float,2>{0.928461134f, 0.982975662f},
-std::array<float,2>{0.029661132f, 0.718947291f},
-std::array<float,2>{0.523122907f, 0.297817111f},
-std::array<float,2>{0.441876262f, 0.294270605f},
-std::array<float,2>{0.901411474f, 0.741759896f},
-std::array<float,2>{0.0463217199f, 0.99249208f},
-std::array<float,2>{0.546676338f, 0.227253735f},
-std::array<float,2>{0.216019601f, 0.116805062f},
-std::array<float,2>{0.697950482f, 0.813746572f},
-std::array<float,2>{0.310015261f, 0.504430771f},
-std::array<float,2>{0.860928178f, 0.380129546f},
-std::array<float,2>{0.103667468f, 0.477004528f},
-std::array<float,2>{0.569069684f, 0.607260168f},
-std::array<float,2>{0.410464466f, 0.798859954f},
-std::array<float,2>{0.950882554f, 0.0623826496f},
-std::array<float,2>{0.313520908f, 0.146925747f},
-std::array<float,2>{0.759482741f, 0.925852537f},
-std::array<float,2>{0.148720339f, 0.643169761f},
-std::array<float,2>{0.647027373f, 0.373211771f},
-std::array<float,2>{0.274116367f, 0.407202631f},
-std::array<float,2>{0.840873718f, 0.53748095f},
-std::array<float,2>{0.234790117f, 0.861961067f},
-std::array<float,2>{0.736172199f, 0.0635204464f},
-std::array<float,2>{0.000966731634f, 0.209067017f},
-std::array<float,2>{0.508193195f, 0.938247204f},
-std::array<float,2>{0.475860983f, 0.700679481f},
-std::array<float,2>{0.916797519f, 0.269640535f},
-std::array<float,2>{0.185788721f, 0.315778464f},
-std::array<float,2>{0.68729955f, 0.68415606f},
-std::array<float,2>{0.353216827f, 0.887719631f},
-std::array<float,2>{0.781525135f, 0.184164494f},
-std::array<float,2>{0.389039397f, 0.0233813208f},
-std::array<float,2>{0.991782546f, 0.770084262f},
-std::array<float,2>{0.0627549738f, 0.567295492f},
-std::array<float,2>{0.613010287f, 0.45035252f},
-std::array<float,2>{0.494953305f, 0.441402197f},
-std::array<float,2>{0.924960375f, 0.573226154f},
-std::array<float,2>{0.0263795406f, 0.777938128f},
-std::array<float,2>{0.516168356f, 0.0242655035f},
-std::array<float,2>{0.229345962f, 0.179536074f},
-std::array<float,2>{0.72904098f, 0.882428527f},
-std::array<float,2>{0.265501201f, 0.675626278f},
-std::array<float,2>{0.825203776f, 0.320617408f},
-std::array<float,2>{0.0867644846f, 0.27558282f},
-std::array<float,2>{0.596637964f, 0.691069186f},
-std::array<float,2>{0.39777863f, 0.946151853f},
-std::array<float,2>{0.973325133f, 0.217537686f},
-std::array<float,2>{0.363724679f, 0.0736497566f},
-std::array<float,2>{0.797035992f, 0.867624283f},
-std::array<float,2>{0.158879891f, 0.539949059f},
-std::array<float,2>{0.664437175f, 0.417068601f},
-std::array<float,2>{0.283681661f, 0.359407395f},
-std::array<float,2>{0.849121332f, 0.648951411f},
-std::array<float,2>{0.196235165f, 0.932472229f},
-std::array<float,2>{0.703970551f, 0.154226482f},
-std::array<float,2>{0.0529462844f, 0.0492696986f},
-std::array<float,2>{0.557455599f, 0.812379241f},
-std::array<float,2>{0.464132816f, 0.599336565f},
-std::array<float,2>{0.876103938f, 0.474942297f},
-std::array<float,2>{0.137497738f, 0.386945307f},
-std::array<float,2>{0.630517006f, 0.514706314f},
-std::array<float,2>{0.340021938f, 0.827025831f},
-std::array<float,2>{0.766314864f, 0.121449985f},
-std::array<float,2>{0.425775975f, 0.220006242f},
-std::array<float,2>{0.95603025f, 0.990522325f},
-std::array<float,2>{0.111775808f, 0.744832098f},
-std::array<float,2>{0.587528229f, 0.287836105f},
-std::array<float,2>{0.383321345f, 0.308837712f},
-std::array<float,2>{0.984689653f, 0.730468929f},
-std::array<float,2>{0.0672838688f, 0.97259742f},
-std::array<float,2>{0.614920497f, 0.246720016f},
-std::array<float,2>{0.180050135f, 0.0972956195f},
-std::array<float,2>{0.679815292f, 0.841861844f},
-std::array<float,2>{0.358493239f, 0.530595064f},
-std::array<float,2>{0.78848201f, 0.392997503f},
-std::array<float,2>{0.00485302508f, 0.498101175f},
-std::array<float,2>{0.513760567f, 0.619072676f},
-std::array<float,2>{0.469747365f, 0.791625082f},
-std::array<float,2>{0.919111073f, 0.042223502f},
-std::array<float,2>{0.278471977f, 0.127340585f},
-std::array<float,2>{0.836336672f, 0.917434216f},
-std::array<float,2>{0.241708398f, 0.631826162f},
-std::array<float,2>{0.74103868f, 0.344732553f},
-std::array<float,2>{0.316433042f, 0.433737159f},
-std::array<float,2>{0.764644682f, 0.56171453f},
-std::array<float,2>{0.152942523f, 0.858895481f},
-std::array<float,2>{0.642212093f, 0.0789407864f},
-std::array<float,2>{0.109363459f, 0.188604131f},
-std::array<float,2>{0.565731406f, 0.960605085f},
-std::array<float,2>{0.406459153f, 0.712333739f},
-std::array<float,2>{0.946375966f, 0.258452266f},
-std::array<float,2>{0.213524804f, 0.336599827f},
-std::array<float,2>{0.702008724f, 0.663990676f},
-std::array<float,2>{0.308216006f, 0.89440304f},
-std::array<float,2>{0.865631402f, 0.167303443f},
-std::array<float,2>{0.440366685f, 0.00716341054f},
-std::array<float,2>{0.902852654f, 0.761485219f},
-std::array<float,2>{0.0402821749f, 0.587173522f},
-std::array<float,2>{0.539411068f, 0.460339695f},
-std::array<float,2>{0.417825907f, 0.402005613f},
-std::array<float,2>{0.942655742f, 0.520232379f},
-std::array<float,2>{0.096091181f, 0.834551036f},
-std::array<float,2>{0.570559978f, 0.104588963f},
-std::array<float,2>{0.14784357f, 0.237803012f},
-std::array<float,2>{0.649310589f, 0.977560103f},
-std::array<float,2>{0.322360367f, 0.725930274f},
-std::array<float,2>{0.75686115f, 0.303833187f},
-std::array<float,2>{0.0389577895f, 0.356400996f},
-std::array<float,2>{0.535785615f, 0.633144379f},
-std::array<float,2>{0.45294866f, 0.912593067f},
-std::array<float,2>{0.894809484f, 0.139991194f},
-std::array<float,2>{0.299854666f, 0.0316133052f},
-std::array<float,2>{0.87034595f, 0.783376932f},
-std::array<float,2>{0.208758846f, 0.614037871f},
-std::array<float,2>{0.690663874f, 0.492117792f},
-std::array<float,2>{0.349142343f, 0.251648128f},
-std::array<float,2>{0.79192239f, 0.707052588f},
-std::array<float,2>{0.175591111f, 0.965072274f},
-std::array<float,2>{0.672592998f, 0.195371971f},
-std::array<float,2>{0.0748393983f, 0.0936902612f},
-std::array<float,2>{0.617411256f, 0.844227612f},
-std::array<float,2>{0.378020495f, 0.552504539f},
-std::array<float,2>{0.999417722f, 0.427448988f},
-std::array<float,2>{0.245074242f, 0.464682907f},
-std::array<float,2>{0.747590601f, 0.582734108f},
-std::array<float,2>{0.270822108f, 0.751390576f},
-std::array<float,2>{0.834757507f, 0.00995246973f},
-std::array<float,2>{0.47868973f, 0.160205781f},
-std::array<float,2>{0.90691328f, 0.901412368f},
-std::array<float,2>{0.00996965356f, 0.667781532f},
-std::array<float,2>{0.507725656f, 0.333339393f},
-std::array<float,2>{0.455597579f, 0.317956895f},
-std::array<float,2>{0.88828826f, 0.68003267f},
-std::array<float,2>{0.060869582f, 0.885875702f},
-std::array<float,2>{0.55183953f, 0.180212855f},
-std::array<float,2>{0.195072472f, 0.0193805657f},
-std::array<float,2>{0.712512374f, 0.767260075f},
-std::array<float,2>{0.295115203f, 0.566251278f},
-std::array<float,2>{0.856519818f, 0.44839707f},
-std::array<float,2>{0.12280415f, 0.414019376f},
-std::array<float,2>{0.579436064f, 0.533748567f},
-std::array<float,2>{0.430260301f, 0.866378963f},
-std::array<float,2>{0.965596139f, 0.0668337718f},
-std::array<float,2>{0.332782298f, 0.206364065f},
-std::array<float,2>{0.780776262f, 0.942875922f},
-std::array<float,2>{0.129822075f, 0.697610915f},
-std::array<float,2>{0.632913888f, 0.2663818f},
-std::array<float,2>{0.25460422f, 0.482911438f},
-std::array<float,2>{0.814400673f, 0.602754176f},
-std::array<float,2>{0.220006987f, 0.801164925f},
-std::array<float,2>{0.720788121f, 0.0574669503f},
-std::array<float,2>{0.0182142556f, 0.143789142f},
-std::array<float,2>{0.529160619f, 0.92398715f},
-std::array<float,2>{0.487881601f, 0.646099269f},
-std::array<float,2>{0.930507958f, 0.367702961f},
-std::array<float,2>{0.16526401f, 0.292504817f},
-std::array<float,2>{0.661617637f, 0.737013817f},
-std::array<float,2>{0.373022854f, 0.996751726f},
-std::array<float,2>{0.807810009f, 0.232116073f},
-std::array<float,2>{0.403739989f, 0.110320747f},
-std::array<float,2>{0.983093619f, 0.818278134f},
-std::array<float,2>{0.082869187f, 0.502649069f},
-std::array<float,2>{0.605978549f, 0.375806063f},
-std::array<float,2>{0.446313441f, 0.418140501f},
-std::array<float,2>{0.89173311f, 0.543419898f},
-std::array<float,2>{0.0345899612f, 0.874198079f},
-std::array<float,2>{0.533636034f, 0.0756326243f},
-std::array<float,2>{0.204517171f, 0.212779388f},
-std::array<float,2>{0.691652715f, 0.951804698f},
-std::array<float,2>{0.30174908f, 0.695201814f},
-std::array<float,2>{0.872356176f, 0.278525472f},
-std::array<float,2>{0.0997324884f, 0.32735154f},
-std::array<float,2>{0.577091515f, 0.679398119f},
-std::array<float,2>{0.420943469f, 0.875589132f},
-std::array<float,2>{0.939864278f, 0.173497841f},
-std::array<float,2>{0.327207804f, 0.0274385512f},
-std::array<float,2>{0.752047896f, 0.774029911f},
-std::array<float,2>{0.141329661f, 0.576499939f},
-std::array<float,2>{0.655721903f, 0.444616586f},
-std::array<float,2>{0.268420398f, 0.284185588f},
-std::array<float,2>{0.828289926f, 0.748274922f},
-std::array<float,2>{0.24936001f, 0.986224592f},
-std::array<float,2>{0.742796957f, 0.223217815f},
-std::array<float,2>{0.0120015824f, 0.118377104f},
-std::array<float,2>{0.502874851f, 0.822921991f},
-std::array<float,2>{0.482118219f, 0.510006666f},
-std::array<float,2>{0.91267246f, 0.384155124f},
-std::array<float,2>{0.176189721f, 0.470662355f},
-std::array<float,2>{0.676814795f, 0.596482575f},
-std::array<float,2>{0.346040249f, 0.805108428f},
-std::array<float,2>{0.794993162f, 0.05149417f},
-std::array<float,2>{0.380519956f, 0.15000315f},
-std::array<float,2>{0.993283689f, 0.935972035f},
-std::array<float,2>{0.0715745762f, 0.656117141f},
-std::array<float,2>{0.622682512f, 0.363297969f},
-std::array<float,2>{0.437440813f, 0.349239051f},
-std::array<float,2>{0.963598371f, 0.628125846f},
-std::array<float,2>{0.118648805f, 0.920749068f},
-std::array<float,2>{0.585190177f, 0.13150835f},
-std::array<float,2>{0.128674492f, 0.0443973094f},
-std::array<float,2>{0.638385832f, 0.794501722f},
-std::array<float,2>{0.328537792f, 0.624817729f},
-std::array<float,2>{0.775591612f, 0.495235801f},
-std::array<float,2>{0.0570269823f, 0.397048563f},
-std::array<float,2>{0.549147129f, 0.525809705f},
-std::array<float,2>{0.45769456f, 0.837007046f},
-std::array<float,2>{0.885602534f, 0.101229541f},
-std::array<float,2>{0.290895522f, 0.243501961f},
-std::array<float,2>{0.852338195f, 0.972895026f},
-std::array<float,2>{0.187937289f, 0.726694047f},
-std::array<float,2>{0.715202391f, 0.306301743f},
-std::array<float,2>{0.367717385f, 0.455152392f},
-std::array<float,2>{0.811756551f, 0.592957914f},
-std::array<float,2>{0.170389876f, 0.761829734f},
-std::array<float,2>{0.657660961f, 0.000609163195f},
-std::array<float,2>{0.0818224177f, 0.171824589f},
-std::array<float,2>{0.605298221f, 0.894549072f},
-std::array<float,2>{0.399440765f, 0.657525599f},
-std::array<float,2>{0.977372825f, 0.343637198f},
-std::array<float,2>{0.224766478f, 0.262681991f},
-std::array<float,2>{0.725612223f, 0.716892123f},
-std::array<float,2>{0.253169298f, 0.95524013f},
-std::array<float,2>{0.817308009f, 0.193457678f},
-std::array<float,2>{0.48828128f, 0.0844695866f},
-std::array<float,2>{0.936798751f, 0.854864299f},
-std::array<float,2>{0.0232136119f, 0.555070162f},
-std::array<float,2>{0.526398003f, 0.43161726f},
-std::array<float,2>{0.394205064f, 0.487119585f},
-std::array<float,2>{0.970833719f, 0.612594903f},
-std::array<float,2>{0.0922083855f, 0.787133932f},
-std::array<float,2>{0.600099623f, 0.0368524157f},
-std::array<float,2>{0.161331534f, 0.136244759f},
-std::array<float,2>{0.669252515f, 0.908453882f},
-std::array<float,2>{0.360675037f, 0.637455881f},
-std::array<float,2>{0.802293003f, 0.352429003f},
-std::array<float,2>{0.0286300257f, 0.299651831f},
-std::array<float,2>{0.521159053f, 0.722569466f},
-std::array<float,2>{0.49628073f, 0.981185198f},
-std::array<float,2>{0.926835299f, 0.240143597f},
-std::array<float,2>{0.258228749f, 0.108365938f},
-std::array<float,2>{0.822265446f, 0.830077052f},
-std::array<float,2>{0.231181711f, 0.518316627f},
-std::array<float,2>{0.732943296f, 0.403727025f},
-std::array<float,2>{0.336688906f, 0.329271823f},
-std::array<float,2>{0.772682786f, 0.671018362f},
-std::array<float,2>{0.13542217f, 0.903167427f},
-std::array<float,2>{0.626726091f, 0.158784851f},
-std::array<float,2>{0.11429245f, 0.0143545736f},
-std::array<float,2>{0.592556655f, 0.755449176f},
-std::array<float,2>{0.428694367f, 0.579472661f},
-std::array<float,2>{0.957941055f, 0.468176514f},
-std::array<float,2>{0.201481611f, 0.425650388f},
-std::array<float,2>{0.707543671f, 0.547879875f},
-std::array<float,2>{0.285929352f, 0.848691404f},
-std::array<float,2>{0.846390486f, 0.0874470249f},
-std::array<float,2>{0.468578935f, 0.201083243f},
-std::array<float,2>{0.882407725f, 0.964550376f},
-std::array<float,2>{0.0481413193f, 0.706341147f},
-std::array<float,2>{0.56122452f, 0.256185621f},
-std::array<float,2>{0.473038763f, 0.273044348f},
-std::array<float,2>{0.915427387f, 0.702462971f},
-std::array<float,2>{0.00258574681f, 0.939766407f},
-std::array<float,2>{0.511059225f, 0.207893863f},
-std::array<float,2>{0.238212511f, 0.0651952475f},
-std::array<float,2>{0.736449301f, 0.860654056f},
-std::array<float,2>{0.275659442f, 0.53540796f},
-std::array<float,2>{0.843423009f, 0.409346104f},
-std::array<float,2>{0.0655213445f, 0.45240438f},
-std::array<float,2>{0.610429883f, 0.570132852f},
-std::array<float,2>{0.386969119f, 0.773068547f},
-std::array<float,2>{0.989863873f, 0.0198934712f},
-std::array<float,2>{0.354845822f, 0.185700059f},
-std::array<float,2>{0.78349787f, 0.890003026f},
-std::array<float,2>{0.184672698f, 0.686908424f},
-std::array<float,2>{0.684458375f, 0.313311279f},
-std::array<float,2>{0.312000185f, 0.382624745f},
-std::array<float,2>{0.862353563f, 0.506365836f},
-std::array<float,2>{0.218576819f, 0.815343261f},
-std::array<float,2>{0.695592582f, 0.114140421f},
-std::array<float,2>{0.0436781608f, 0.228740364f},
-std::array<float,2>{0.543994486f, 0.994866848f},
-std::array<float,2>{0.444133878f, 0.739776492f},
-std::array<float,2>{0.898554862f, 0.296518117f},
-std::array<float,2>{0.151530519f, 0.37117818f},
-std::array<float,2>{0.645120978f, 0.640792549f},
-std::array<float,2>{0.315125167f, 0.928444982f},
-std::array<float,2>{0.761450887f, 0.144749939f},
-std::array<float,2>{0.413086027f, 0.0603405908f},
-std::array<float,2>{0.951413631f, 0.798481047f},
-std::array<float,2>{0.101879887f, 0.607591391f},
-std::array<float,2>{0.566879988f, 0.479833305f},
-std::array<float,2>{0.453329444f, 0.449128926f},
-std::array<float,2>{0.889732301f, 0.565458596f},
-std::array<float,2>{0.0594434291f, 0.766967595f},
-std::array<float,2>{0.553811133f, 0.0190069582f},
-std::array<float,2>{0.191690728f, 0.179945216f},
-std::array<float,2>{0.713782132f, 0.886688232f},
-std::array<float,2>{0.292986155f, 0.680560648f},
-std::array<float,2>{0.858648837f, 0.317404658f},
-std::array<float,2>{0.1243264f, 0.265898585f},
-std::array<float,2>{0.5817976f, 0.69789058f},
-std::array<float,2>{0.432994306f, 0.942817152f},
-std::array<float,2>{0.968468547f, 0.206700772f},
-std::array<float,2>{0.33578974f, 0.0671283379f},
-std::array<float,2>{0.777661383f, 0.866748512f},
-std::array<float,2>{0.131347477f, 0.533218086f},
-std::array<float,2>{0.635709643f, 0.413556993f},
-std::array<float,2>{0.257143468f, 0.367226899f},
-std::array<float,2>{0.816404819f, 0.645761192f},
-std::array<float,2>{0.22124517f, 0.924522579f},
-std::array<float,2>{0.720596552f, 0.144070387f},
-std::array<float,2>{0.0159298871f, 0.0568862595f},
-std::array<float,2>{0.530884445f, 0.801454127f},
-std::array<float,2>{0.484742522f, 0.603103578f},
-std::array<float,2>{0.93226546f, 0.482781291f},
-std::array<float,2>{0.166437924f, 0.375048369f},
-std::array<float,2>{0.662186742f, 0.502251029f},
-std::array<float,2>{0.374760628f, 0.81782043f},
-std::array<float,2>{0.805321395f, 0.109409504f},
-std::array<float,2>{0.405967295f, 0.231664807f},
-std::array<float,2>{0.981913805f, 0.996579707f},
-std::array<float,2>{0.0840406865f, 0.736605346f},
-std::array<float,2>{0.607885003f, 0.292102158f},
-std::array<float,2>{0.414123118f, 0.304548562f},
-std::array<float,2>{0.945158601f, 0.726556122f},
-std::array<float,2>{0.0940462351f, 0.978141665f},
-std::array<float,2>{0.572917521f, 0.237323001f},
-std::array<float,2>{0.146336243f, 0.105287664f},
-std::array<float,2>{0.652216971f, 0.834033132f},
-std::array<float,2>{0.321436435f, 0.519784033f},
-std::array<float,2>{0.755117953f, 0.401450008f},
-std::array<float,2>{0.0367447138f, 0.491404027f},
-std::array<float,2>{0.537381947f, 0.613338888f},
-std::array<float,2>{0.45037511f, 0.784161925f},
-std::array<float,2>{0.897198439f, 0.0317478776f},
-std::array<float,2>{0.29753387f, 0.140472174f},
-std::array<float,2>{0.868233025f, 0.91295594f},
-std::array<float,2>{0.210291684f, 0.633515775f},
-std::array<float,2>{0.688712001f, 0.355771691f},
-std::array<float,2>{0.350954235f, 0.427203119f},
-std::array<float,2>{0.78915292f, 0.551966488f},
-std::array<float,2>{0.173750848f, 0.844523489f},
-std::array<float,2>{0.674123764f, 0.0930126011f},
-std::array<float,2>{0.0763473958f, 0.19585219f},
-std::array<float,2>{0.620372236f, 0.965443075f},
-std::array<float,2>{0.376906097f, 0.707919359f},
-std::array<float,2>{0.997883022f, 0.251007855f},
-std::array<float,2>{0.242373258f, 0.333788067f},
-std::array<float,2>{0.748245299f, 0.667208374f},
-std::array<float,2>{0.272262335f, 0.902151585f},
-std::array<float,2>{0.83325994f, 0.160679668f},
-std::array<float,2>{0.478094637f, 0.0103400368f},
-std::array<float,2>{0.909710824f, 0.751636386f},
-std::array<float,2>{0.00810644496f, 0.582363486f},
-std::array<float,2>{0.50403136f, 0.463951975f},
-std::array<float,2>{0.385079205f, 0.393398911f},
-std::array<float,2>{0.988249183f, 0.531244755f},
-std::array<float,2>{0.0686272979f, 0.842381597f},
-std::array<float,2>{0.615775406f, 0.0970435441f},
-std::array<float,2>{0.18285729f, 0.246408537f},
-std::array<float,2>{0.682850301f, 0.971957624f},
-std::array<float,2>{0.355959564f, 0.731004894f},
-std::array<float,2>{0.786986709f, 0.309498876f},
-std::array<float,2>{0.00732525066f, 0.345558912f},
-std::array<float,2>{0.512887657f, 0.631248832f},
-std::array<float,2>{0.472640097f, 0.917797327f},
-std::array<float,2>{0.921451509f, 0.127475694f},
-std::array<float,2>{0.280195206f, 0.0429492742f},
-std::array<float,2>{0.83967042f, 0.791178286f},
-std::array<float,2>{0.239137828f, 0.618328452f},
-std::array<float,2>{0.738737524f, 0.498649359f},
-std::array<float,2>{0.319120765f, 0.258120388f},
-std::array<float,2>{0.763150811f, 0.712622821f},
-std::array<float,2>{0.156084478f, 0.959970713f},
-std::array<float,2>{0.642838895f, 0.189184606f},
-std::array<float,2>{0.105944701f, 0.0784239173f},
-std::array<float,2>{0.564012825f, 0.858758092f},
-std::array<float,2>{0.409332156f, 0.562029541f},
-std::array<float,2>{0.949073732f, 0.434296399f},
-std::array<float,2>{0.211927325f, 0.460636795f},
-std::array<float,2>{0.699707329f, 0.58747077f},
-std::array<float,2>{0.305568188f, 0.761100888f},
-std::array<float,2>{0.863508403f, 0.00735049276f},
-std::array<float,2>{0.43786025f, 0.167769402f},
-std::array<float,2>{0.905340672f, 0.893730521f},
-std::array<float,2>{0.0421904251f, 0.663438141f},
-std::array<float,2>{0.542350292f, 0.336379051f},
-std::array<float,2>{0.493640363f, 0.320802212f},
-std::array<float,2>{0.923535943f, 0.675186515f},
-std::array<float,2>{0.0236032791f, 0.881972253f},
-std::array<float,2>{0.518828809f, 0.179192245f},
-std::array<float,2>{0.228236958f, 0.0238563064f},
-std::array<float,2>{0.727176905f, 0.777670622f},
-std::array<float,2>{0.262163401f, 0.572531164f},
-std::array<float,2>{0.826875687f, 0.440829247f},
-std::array<float,2>{0.089550592f, 0.417731494f},
-std::array<float,2>{0.595397294f, 0.539456964f},
-std::array<float,2>{0.395734072f, 0.868063569f},
-std::array<float,2>{0.975533605f, 0.0741795674f},
-std::array<float,2>{0.366616577f, 0.21710372f},
-std::array<float,2>{0.799959123f, 0.945410132f},
-std::array<float,2>{0.158086345f, 0.690766394f},
-std::array<float,2>{0.666443467f, 0.275978833f},
-std::array<float,2>{0.282901078f, 0.475324631f},
-std::array<float,2>{0.850080013f, 0.59876579f},
-std::array<float,2>{0.198348284f, 0.811668992f},
-std::array<float,2>{0.705861449f, 0.0496530719f},
-std::array<float,2>{0.0515704341f, 0.153324842f},
-std::array<float,2>{0.555391192f, 0.93196243f},
-std::array<float,2>{0.462874115f, 0.648777783f},
-std::array<float,2>{0.877490103f, 0.359879017f},
-std::array<float,2>{0.138672903f, 0.287408531f},
-std::array<float,2>{0.631681561f, 0.744584382f},
-std::array<float,2>{0.343619436f, 0.991161942f},
-std::array<float,2>{0.768484235f, 0.220440492f},
-std::array<float,2>{0.422513604f, 0.121961288f},
-std::array<float,2>{0.954526067f, 0.826185346f},
-std::array<float,2>{0.110228099f, 0.515521765f},
-std::array<float,2>{0.588357031f, 0.387573659f},
-std::array<float,2>{0.476221651f, 0.409929574f},
-std::array<float,2>{0.916463852f, 0.53580302f},
-std::array<float,2>{0.00036998422f, 0.861119568f},
-std::array<float,2>{0.508496463f, 0.064678371f},
-std::array<float,2>{0.234907851f, 0.207054898f},
-std::array<float,2>{0.735574305f, 0.94022882f},
-std::array<float,2>{0.273615658f, 0.703007579f},
-std::array<float,2>{0.841326714f, 0.272590786f},
-std::array<float,2>{0.0633691102f, 0.312906086f},
-std::array<float,2>{0.612332106f, 0.68702513f},
-std::array<float,2>{0.389265537f, 0.890319407f},
-std::array<float,2>{0.991671085f, 0.186088651f},
-std::array<float,2>{0.352867723f, 0.0205044243f},
-std::array<float,2>{0.78196919f, 0.772947848f},
-std::array<float,2>{0.186506867f, 0.569591761f},
-std::array<float,2>{0.686865509f, 0.453036636f},
-std::array<float,2>{0.310468435f, 0.296042114f},
-std::array<float,2>{0.860696435f, 0.739362001f},
-std::array<float,2>{0.216366112f, 0.994268417f},
-std::array<float,2>{0.697304666f, 0.22916761f},
-std::array<float,2>{0.0464442372f, 0.113471732f},
-std::array<float,2>{0.545976579f, 0.814619482f},
-std::array<float,2>{0.442185193f, 0.50633651f},
-std::array<float,2>{0.902030706f, 0.382246941f},
-std::array<float,2>{0.149200663f, 0.480225056f},
-std::array<float,2>{0.646510899f, 0.608120322f},
-std::array<float,2>{0.314361781f, 0.797865808f},
-std::array<float,2>{0.759211183f, 0.0598459467f},
-std::array<float,2>{0.41109103f, 0.145375073f},
-std::array<float,2>{0.950297892f, 0.928165734f},
-std::array<float,2>{0.104332671f, 0.641423285f},
-std::array<float,2>{0.568807602f, 0.371682376f},
-std::array<float,2>{0.390980661f, 0.351580888f},
-std::array<float,2>{0.970332563f, 0.636994898f},
-std::array<float,2>{0.0902636498f, 0.908963501f},
-std::array<float,2>{0.599183261f, 0.136189759f},
-std::array<float,2>{0.162230611f, 0.0362016596f},
-std::array<float,2>{0.67181927f, 0.787695169f},
-std::array<float,2>{0.361446351f, 0.612807691f},
-std::array<float,2>{0.80461967f, 0.486773789f},
-std::array<float,2>{0.0300306752f, 0.404142082f},
-std::array<float,2>{0.522724926f, 0.517948806f},
-std::array<float,2>{0.498489648f, 0.829317153f},
-std::array<float,2>{0.927737117f, 0.107638858f},
-std::array<float,2>{0.261493623f, 0.239658818f},
-std::array<float,2>{0.823449075f, 0.980787992f},
-std::array<float,2>{0.233828455f, 0.722118318f},
-std::array<float,2>{0.730878413f, 0.299177438f},
-std::array<float,2>{0.338612497f, 0.468357176f},
-std::array<float,2>{0.770133555f, 0.580028653f},
-std::array<float,2>{0.134337828f, 0.755369902f},
-std::array<float,2>{0.628084302f, 0.0139534241f},
-std::array<float,2>{0.116520807f, 0.158243403f},
-std::array<float,2>{0.590751886f, 0.902512312f},
-std::array<float,2>{0.425996125f, 0.671576798f},
-std::array<float,2>{0.960550785f, 0.32964465f},
-std::array<float,2>{0.199505776f, 0.256355405f},
-std::array<float,2>{0.709100127f, 0.706793785f},
-std::array<float,2>{0.288325667f, 0.963892996f},
-std::array<float,2>{0.844770253f, 0.20032075f},
-std::array<float,2>{0.465258837f, 0.0869887248f},
-std::array<float,2>{0.880839646f, 0.84915626f},
-std::array<float,2>{0.0488452539f, 0.548722386f},
-std::array<float,2>{0.560366869f, 0.42513144f},
-std::array<float,2>{0.433656633f, 0.495914221f},
-std::array<float,2>{0.961878002f, 0.624450088f},
-std::array<float,2>{0.120235711f, 0.794081271f},
-std::array<float,2>{0.582054377f, 0.0447397381f},
-std::array<float,2>{0.126237154f, 0.131245717f},
-std::array<float,2>{0.640556872f, 0.920068026f},
-std::array<float,2>{0.330825925f, 0.628472567f},
-std::array<float,2>{0.775096059f, 0.349110633f},
-std::array<float,2>{0.0560165569f, 0.305732101f},
-std::array<float,2>{0.547300875f, 0.727252781f},
-std::array<float,2>{0.459130347f, 0.973353565f},
-std::array<float,2>{0.883840621f, 0.243762493f},
-std::array<float,2>{0.291064084f, 0.100714803f},
-std::array<float,2>{0.854815781f, 0.837700546f},
-std::array<float,2>{0.190317065f, 0.526032567f},
-std::array<float,2>{0.717387676f, 0.396594077f},
-std::array<float,2>{0.370381981f, 0.343040496f},
-std::array<float,2>{0.809722424f, 0.658017099f},
-std::array<float,2>{0.168132842f, 0.895229876f},
-std::array<float,2>{0.659492791f, 0.171232328f},
-std::array<float,2>{0.078781113f, 0.000352031173f},
-std::array<float,2>{0.602144539f, 0.762429237f},
-std::array<float,2>{0.400856048f, 0.593414128f},
-std::array<float,2>{0.97931385f, 0.455734462f},
-std::array<float,2>{0.223765016f, 0.430781066f},
-std::array<float,2>{0.724003971f, 0.555595458f},
-std::array<float,2>{0.250911087f, 0.855253041f},
-std::array<float,2>{0.819052637f, 0.0848312527f},
-std::array<float,2>{0.49081549f, 0.19412668f},
-std::array<float,2>{0.934356332f, 0.955726922f},
-std::array<float,2>{0.0204654243f, 0.717313886f},
-std::array<float,2>{0.524137795f, 0.261968881f},
-std::array<float,2>{0.448240668f, 0.278933704f},
-std::array<float,2>{0.893831313f, 0.694719136f},
-std::array<float,2>{0.031828817f, 0.951393902f},
-std::array<float,2>{0.532998145f, 0.212063521f},
-std::array<float,2>{0.205229893f, 0.0759849325f},
-std::array<float,2>{0.693872631f, 0.874929309f},
-std::array<float,2>{0.304145157f, 0.543495357f},
-std::array<float,2>{0.874760926f, 0.418840528f},
-std::array<float,2>{0.0984729901f, 0.445156693f},
-std::array<float,2>{0.574721277f, 0.576986969f},
-std::array<float,2>{0.419724524f, 0.773441195f},
-std::array<float,2>{0.93931067f, 0.0282970518f},
-std::array<float,2>{0.325375438f, 0.173009202f},
-std::array<float,2>{0.75112623f, 0.875070632f},
-std::array<float,2>{0.14367798f, 0.678759575f},
-std::array<float,2>{0.653755963f, 0.32775712f},
-std::array<float,2>{0.265982419f, 0.384640634f},
-std::array<float,2>{0.831941426f, 0.51036638f},
-std::array<float,2>{0.246218771f, 0.822270691f},
-std::array<float,2>{0.746017873f, 0.118714653f},
-std::array<float,2>{0.0153941596f, 0.223027855f},
-std::array<float,2>{0.501266658f, 0.985774398f},
-std::array<float,2>{0.482590675f, 0.748778343f},
-std::array<float,2>{0.911623061f, 0.284836739f},
-std::array<float,2>{0.17802088f, 0.363982767f},
-std::array<float,2>{0.678305864f, 0.655497611f},
-std::array<float,2>{0.345387489f, 0.936359584f},
-std::array<float,2>{0.794138074f, 0.14967683f},
-std::array<float,2>{0.382386893f, 0.0509097092f},
-std::array<float,2>{0.994738817f, 0.805317938f},
-std::array<float,2>{0.0735891089f, 0.595776558f},
-std::array<float,2>{0.62372148f, 0.469915569f},
-std::array<float,2>{0.487704903f, 0.480842441f},
-std::array<float,2>{0.930092633f, 0.604968786f},
-std::array<float,2>{0.0177945476f, 0.802970409f},
-std::array<float,2>{0.528489053f, 0.0554648004f},
-std::array<float,2>{0.220594063f, 0.14094156f},
-std::array<float,2>{0.721496165f, 0.923607826f},
-std::array<float,2>{0.254079342f, 0.648150086f},
-std::array<float,2>{0.813563347f, 0.370075941f},
-std::array<float,2>{0.0820324868f, 0.290777087f},
-std::array<float,2>{0.605904937f, 0.736251593f},
-std::array<float,2>{0.404228419f, 0.998689413f},
-std::array<float,2>{0.982484281f, 0.234249949f},
-std::array<float,2>{0.372459918f, 0.112222135f},
-std::array<float,2>{0.808211684f, 0.820248663f},
-std::array<float,2>{0.165676907f, 0.50116837f},
-std::array<float,2>{0.662025809f, 0.37784487f},
-std::array<float,2>{0.295550793f, 0.320082247f},
-std::array<float,2>{0.857386589f, 0.682380855f},
-std::array<float,2>{0.194387376f, 0.883860946f},
-std::array<float,2>{0.712059259f, 0.182450593f},
-std::array<float,2>{0.0613581613f, 0.0164278354f},
-std::array<float,2>{0.552468717f, 0.76778692f},
-std::array<float,2>{0.455166578f, 0.563816071f},
-std::array<float,2>{0.887970865f, 0.446710348f},
-std::array<float,2>{0.128931582f, 0.412034094f},
-std::array<float,2>{0.633584142f, 0.531610489f},
-std::array<float,2>{0.332493633f, 0.86416775f},
-std::array<float,2>{0.780698836f, 0.0701197237f},
-std::array<float,2>{0.429807842f, 0.205046475f},
-std::array<float,2>{0.965106487f, 0.943717301f},
-std::array<float,2>{0.12251585f, 0.696635187f},
-std::array<float,2>{0.579863966f, 0.268783718f},
-std::array<float,2>{0.378846467f, 0.252852827f},
-std::array<float,2>{0.999751627f, 0.708984375f},
-std::array<float,2>{0.074222669f, 0.966865599f},
-std::array<float,2>{0.617737293f, 0.198500738f},
-std::array<float,2>{0.175281659f, 0.0902500972f},
-std::array<float,2>{0.672003508f, 0.847500861f},
-std::array<float,2>{0.348814309f, 0.552755713f},
-std::array<float,2>{0.791015744f, 0.428067178f},
-std::array<float,2>{0.0107025215f, 0.461867779f},
-std::array<float,2>{0.506931126f, 0.585264385f},
-std::array<float,2>{0.479131639f, 0.753182411f},
-std::array<float,2>{0.906278908f, 0.00929564051f},
-std::array<float,2>{0.271442086f, 0.16385141f},
-std::array<float,2>{0.834248185f, 0.898619533f},
-std::array<float,2>{0.244146824f, 0.664159715f},
-std::array<float,2>{0.747157991f, 0.335593849f},
-std::array<float,2>{0.323234379f, 0.399078876f},
-std::array<float,2>{0.757586777f, 0.522662044f},
-std::array<float,2>{0.148258835f, 0.83296591f},
-std::array<float,2>{0.648878813f, 0.103194594f},
-std::array<float,2>{0.0965769961f, 0.236169547f},
-std::array<float,2>{0.570814133f, 0.979747295f},
-std::array<float,2>{0.417299926f, 0.724090397f},
-std::array<float,2>{0.942941725f, 0.300914377f},
-std::array<float,2>{0.208105803f, 0.358243138f},
-std::array<float,2>{0.691200852f, 0.635915637f},
-std::array<float,2>{0.300452501f, 0.911288381f},
-std::array<float,2>{0.871001184f, 0.136737943f},
-std::array<float,2>{0.452160418f, 0.0336087719f},
-std::array<float,2>{0.895203233f, 0.782018006f},
-std::array<float,2>{0.0385071486f, 0.616082013f},
-std::array<float,2>{0.535308659f, 0.488929302f},
-std::array<float,2>{0.406758666f, 0.435600996f},
-std::array<float,2>{0.946843982f, 0.560189784f},
-std::array<float,2>{0.108416565f, 0.856887817f},
-std::array<float,2>{0.566199064f, 0.0807759538f},
-std::array<float,2>{0.152622148f, 0.189483136f},
-std::array<float,2>{0.641990364f, 0.957718968f},
-std::array<float,2>{0.317109108f, 0.713211775f},
-std::array<float,2>{0.764020622f, 0.261112094f},
-std::array<float,2>{0.0406603105f, 0.339750826f},
-std::array<float,2>{0.539616346f, 0.66184032f},
-std::array<float,2>{0.439816564f, 0.89099592f},
-std::array<float,2>{0.902405083f, 0.165120676f},
-std::array<float,2>{0.308018893f, 0.00444190949f},
-std::array<float,2>{0.865896344f, 0.757999241f},
-std::array<float,2>{0.213256851f, 0.588937998f},
-std::array<float,2>{0.701318562f, 0.457043231f},
-std::array<float,2>{0.359179586f, 0.311162829f},
-std::array<float,2>{0.788756728f, 0.732895195f},
-std::array<float,2>{0.180493906f, 0.969455659f},
-std::array<float,2>{0.680199921f, 0.249391168f},
-std::array<float,2>{0.066813007f, 0.0953262001f},
-std::array<float,2>{0.61444056f, 0.84094584f},
-std::array<float,2>{0.382852674f, 0.52925849f},
-std::array<float,2>{0.984961629f, 0.391946584f},
-std::array<float,2>{0.241696998f, 0.496229798f},
-std::array<float,2>{0.740562439f, 0.620618999f},
-std::array<float,2>{0.279018044f, 0.789291024f},
-std::array<float,2>{0.836772442f, 0.0398020707f},
-std::array<float,2>{0.470551312f, 0.125152871f},
-std::array<float,2>{0.919712901f, 0.914573789f},
-std::array<float,2>{0.00419954956f, 0.629620314f},
-std::array<float,2>{0.514548361f, 0.346676677f},
-std::array<float,2>{0.464561224f, 0.361424059f},
-std::array<float,2>{0.876925647f, 0.651319206f},
-std::array<float,2>{0.0536942594f, 0.930889606f},
-std::array<float,2>{0.556848586f, 0.155441985f},
-std::array<float,2>{0.1953495f, 0.0476039797f},
-std::array<float,2>{0.703313172f, 0.809717596f},
-std::array<float,2>{0.283702224f, 0.600495636f},
-std::array<float,2>{0.848889887f, 0.472713143f},
-std::array<float,2>{0.112012371f, 0.388977289f},
-std::array<float,2>{0.587170303f, 0.512413979f},
-std::array<float,2>{0.425097018f, 0.824476957f},
-std::array<float,2>{0.955435932f, 0.123185106f},
-std::array<float,2>{0.340673268f, 0.221062422f},
-std::array<float,2>{0.765996933f, 0.988986254f},
-std::array<float,2>{0.137165785f, 0.743901432f},
-std::array<float,2>{0.630221188f, 0.286260813f},
-std::array<float,2>{0.264673233f, 0.438689381f},
-std::array<float,2>{0.825848162f, 0.571164131f},
-std::array<float,2>{0.22875607f, 0.780586898f},
-std::array<float,2>{0.728546441f, 0.0270198379f},
-std::array<float,2>{0.0271109696f, 0.176694125f},
-std::array<float,2>{0.515938222f, 0.880052149f},
-std::array<float,2>{0.49444291f, 0.672215819f},
-std::array<float,2>{0.925362527f, 0.3240394f},
-std::array<float,2>{0.158445671f, 0.27507925f},
-std::array<float,2>{0.664670169f, 0.687921405f},
-std::array<float,2>{0.363842994f, 0.948711812f},
-std::array<float,2>{0.797368467f, 0.216423318f},
-std::array<float,2>{0.398212761f, 0.0719294399f},
-std::array<float,2>{0.972915411f, 0.869577885f},
-std::array<float,2>{0.0863051638f, 0.541149497f},
-std::array<float,2>{0.595868945f, 0.41500017f},
-std::array<float,2>{0.443828881f, 0.380447119f},
-std::array<float,2>{0.899211466f, 0.504007101f},
-std::array<float,2>{0.043316707f, 0.814065337f},
-std::array<float,2>{0.544846356f, 0.116698794f},
-std::array<float,2>{0.21824646f, 0.226637065f},
-std::array<float,2>{0.695990562f, 0.992712557f},
-std::array<float,2>{0.312356859f, 0.741492689f},
-std::array<float,2>{0.863070488f, 0.29491663f},
-std::array<float,2>{0.102396823f, 0.37384975f},
-std::array<float,2>{0.56701529f, 0.643000305f},
-std::array<float,2>{0.413991421f, 0.92670089f},
-std::array<float,2>{0.952046692f, 0.146985382f},
-std::array<float,2>{0.314685792f, 0.0619992726f},
-std::array<float,2>{0.761154175f, 0.799695551f},
-std::array<float,2>{0.15218091f, 0.606469154f},
-std::array<float,2>{0.64482373f, 0.477244824f},
-std::array<float,2>{0.276334494f, 0.27035141f},
-std::array<float,2>{0.84324193f, 0.701016724f},
-std::array<float,2>{0.237544581f, 0.93761903f},
-std::array<float,2>{0.737087429f, 0.209641486f},
-std::array<float,2>{0.00207885727f, 0.0640398562f},
-std::array<float,2>{0.511516929f, 0.861707985f},
-std::array<float,2>{0.473361611f, 0.537960768f},
-std::array<float,2>{0.91594702f, 0.40661642f},
-std::array<float,2>{0.18515873f, 0.451148331f},
-std::array<float,2>{0.683992565f, 0.566754282f},
-std::array<float,2>{0.355314106f, 0.769854307f},
-std::array<float,2>{0.784089744f, 0.0227262583f},
-std::array<float,2>{0.387498826f, 0.18402046f},
-std::array<float,2>{0.989723921f, 0.88838619f},
-std::array<float,2>{0.0660336316f, 0.684025049f},
-std::array<float,2>{0.610842824f, 0.316013604f},
-std::array<float,2>{0.42780453f, 0.331559151f},
-std::array<float,2>{0.957357109f, 0.668336332f},
-std::array<float,2>{0.114878535f, 0.906165242f},
-std::array<float,2>{0.592144549f, 0.157599092f},
-std::array<float,2>{0.134928092f, 0.0128887808f},
-std::array<float,2>{0.626019657f, 0.756229639f},
-std::array<float,2>{0.3361893f, 0.581098199f},
-std::array<float,2>{0.773346603f, 0.465358526f},
-std::array<float,2>{0.0484642573f, 0.422598869f},
-std::array<float,2>{0.561000645f, 0.550127387f},
-std::array<float,2>{0.467947006f, 0.851161242f},
-std::array<float,2>{0.882236898f, 0.0887817442f},
-std::array<float,2>{0.285306901f, 0.202402905f},
-std::array<float,2>{0.845945179f, 0.961013973f},
-std::array<float,2>{0.201997876f, 0.703624845f},
-std::array<float,2>{0.707073152f, 0.254010975f},
-std::array<float,2>{0.361050546f, 0.485461801f},
-std::array<float,2>{0.801862299f, 0.610647321f},
-std::array<float,2>{0.161670849f, 0.786293566f},
-std::array<float,2>{0.669572711f, 0.0377658941f},
-std::array<float,2>{0.0924497619f, 0.133441851f},
-std::array<float,2>{0.59992069f, 0.906873405f},
-std::array<float,2>{0.393883467f, 0.63993156f},
-std::array<float,2>{0.971359849f, 0.35528636f},
-std::array<float,2>{0.230569139f, 0.297170907f},
-std::array<float,2>{0.732819021f, 0.719684362f},
-std::array<float,2>{0.258604884f, 0.982714236f},
-std::array<float,2>{0.821572959f, 0.241985798f},
-std::array<float,2>{0.496907949f, 0.107291386f},
-std::array<float,2>{0.927257597f, 0.830251038f},
-std::array<float,2>{0.0289489236f, 0.515860021f},
-std::array<float,2>{0.520734668f, 0.405324996f},
-std::array<float,2>{0.399940491f, 0.453379065f},
-std::array<float,2>{0.976915836f, 0.589980423f},
-std::array<float,2>{0.0815110132f, 0.764664054f},
-std::array<float,2>{0.604581952f, 0.00323010585f},
-std::array<float,2>{0.170823902f, 0.169609413f},
-std::array<float,2>{0.657855809f, 0.89832294f},
-std::array<float,2>{0.367626369f, 0.659149706f},
-std::array<float,2>{0.812342823f, 0.34078446f},
-std::array<float,2>{0.0229041986f, 0.265360355f},
-std::array<float,2>{0.526880205f, 0.715395033f},
-std::array<float,2>{0.488911122f, 0.954591095f},
-std::array<float,2>{0.93725878f, 0.192974359f},
-std::array<float,2>{0.253636599f, 0.0834448263f},
-std::array<float,2>{0.816726387f, 0.852113247f},
-std::array<float,2>{0.225203276f, 0.557629168f},
-std::array<float,2>{0.726243079f, 0.43334797f},
-std::array<float,2>{0.328808457f, 0.350000709f},
-std::array<float,2>{0.776077449f, 0.62529248f},
-std::array<float,2>{0.127939641f, 0.918279231f},
-std::array<float,2>{0.638082445f, 0.130344257f},
-std::array<float,2>{0.118963093f, 0.0456905961f},
-std::array<float,2>{0.585712373f, 0.795526385f},
-std::array<float,2>{0.436764181f, 0.622006774f},
-std::array<float,2>{0.963231087f, 0.494133174f},
-std::array<float,2>{0.188347653f, 0.396281779f},
-std::array<float,2>{0.715652943f, 0.5252437f},
-std::array<float,2>{0.29042238f, 0.838475943f},
-std::array<float,2>{0.85185951f, 0.0978676528f},
-std::array<float,2>{0.457411379f, 0.245323762f},
-std::array<float,2>{0.885121703f, 0.975461185f},
-std::array<float,2>{0.0573952831f, 0.729381621f},
-std::array<float,2>{0.549767852f, 0.307228565f},
-std::array<float,2>{0.481707066f, 0.282439649f},
-std::array<float,2>{0.912595689f, 0.747271776f},
-std::array<float,2>{0.0124068996f, 0.987208843f},
-std::array<float,2>{0.502292752f, 0.225488588f},
-std::array<float,2>{0.249855414f, 0.119819961f},
-std::array<float,2>{0.742229998f, 0.820828378f},
-std::array<float,2>{0.267962307f, 0.509266257f},
-std::array<float,2>{0.82876271f, 0.385037392f},
-std::array<float,2>{0.072016187f, 0.47111842f},
-std::array<float,2>{0.622091711f, 0.594153941f},
-std::array<float,2>{0.380036175f, 0.808151424f},
-std::array<float,2>{0.993811667f, 0.0529158451f},
-std::array<float,2>{0.346424818f, 0.151581183f},
-std::array<float,2>{0.79542923f, 0.934585154f},
-std::array<float,2>{0.176476568f, 0.652761042f},
-std::array<float,2>{0.67734772f, 0.365696162f},
-std::array<float,2>{0.301129878f, 0.421094924f},
-std::array<float,2>{0.872696459f, 0.545199513f},
-std::array<float,2>{0.204854727f, 0.872504056f},
-std::array<float,2>{0.692142189f, 0.0768000931f},
-std::array<float,2>{0.0350071527f, 0.214820012f},
-std::array<float,2>{0.534027338f, 0.950249314f},
-std::array<float,2>{0.44718349f, 0.692876518f},
-std::array<float,2>{0.892239332f, 0.280819774f},
-std::array<float,2>{0.141039908f, 0.324787259f},
-std::array<float,2>{0.656128466f, 0.67610991f},
-std::array<float,2>{0.327914059f, 0.8770625f},
-std::array<float,2>{0.752736926f, 0.174927115f},
-std::array<float,2>{0.421550244f, 0.0300289076f},
-std::array<float,2>{0.94015485f, 0.777294934f},
-std::array<float,2>{0.100284435f, 0.574834228f},
-std::array<float,2>{0.576612175f, 0.443077743f},
-std::array<float,2>{0.449353158f, 0.490192354f},
-std::array<float,2>{0.897476614f, 0.616863728f},
-std::array<float,2>{0.0357887149f, 0.782905221f},
-std::array<float,2>{0.538767099f, 0.0343999714f},
-std::array<float,2>{0.209562853f, 0.138370365f},
-std::array<float,2>{0.687696636f, 0.910906494f},
-std::array<float,2>{0.298077852f, 0.635415733f},
-std::array<float,2>{0.867908776f, 0.358414352f},
-std::array<float,2>{0.095512785f, 0.301861197f},
-std::array<float,2>{0.573868692f, 0.722875059f},
-std::array<float,2>{0.415481448f, 0.97936362f},
-std::array<float,2>{0.944235921f, 0.235302657f},
-std::array<float,2>{0.320982069f, 0.102018662f},
-std::array<float,2>{0.754619837f, 0.833578229f},
-std::array<float,2>{0.144964337f, 0.521977603f},
-std::array<float,2>{0.650954783f, 0.399669051f},
-std::array<float,2>{0.272735327f, 0.334013045f},
-std::array<float,2>{0.832286835f, 0.665218174f},
-std::array<float,2>{0.243335679f, 0.899904966f},
-std::array<float,2>{0.749999404f, 0.162797034f},
-std::array<float,2>{0.00936707947f, 0.00799896009f},
-std::array<float,2>{0.505749226f, 0.752079725f},
-std::array<float,2>{0.477283746f, 0.584846914f},
-std::array<float,2>{0.908957124f, 0.462795138f},
-std::array<float,2>{0.17207554f, 0.429521084f},
-std::array<float,2>{0.67558074f, 0.554415166f},
-std::array<float,2>{0.350323439f, 0.846041739f},
-std::array<float,2>{0.790287554f, 0.0916080996f},
-std::array<float,2>{0.375439972f, 0.198097125f},
-std::array<float,2>{0.996688008f, 0.968058586f},
-std::array<float,2>{0.0779576153f, 0.710637033f},
-std::array<float,2>{0.6193887f, 0.253134876f},
-std::array<float,2>{0.432230443f, 0.267721444f},
-std::array<float,2>{0.967520356f, 0.695874751f},
-std::array<float,2>{0.123149104f, 0.945101202f},
-std::array<float,2>{0.580360532f, 0.203855097f},
-std::array<float,2>{0.132317275f, 0.068719238f},
-std::array<float,2>{0.636273265f, 0.864887178f},
-std::array<float,2>{0.334507614f, 0.532970309f},
-std::array<float,2>{0.779260695f, 0.410490036f},
-std::array<float,2>{0.0596510954f, 0.445682913f},
-std::array<float,2>{0.552856982f, 0.563408196f},
-std::array<float,2>{0.45454523f, 0.768983424f},
-std::array<float,2>{0.889279008f, 0.0170413461f},
-std::array<float,2>{0.294525683f, 0.182990834f},
-std::array<float,2>{0.858167589f, 0.882832229f},
-std::array<float,2>{0.193023667f, 0.683043659f},
-std::array<float,2>{0.714299083f, 0.319033742f},
-std::array<float,2>{0.373109609f, 0.378100753f},
-std::array<float,2>{0.806560099f, 0.50030005f},
-std::array<float,2>{0.167843655f, 0.818994522f},
-std::array<float,2>{0.663336575f, 0.113195665f},
-std::array<float,2>{0.0852638334f, 0.23329705f},
-std::array<float,2>{0.608513713f, 0.999290347f},
-std::array<float,2>{0.40466547f, 0.734997511f},
-std::array<float,2>{0.980948985f, 0.289279044f},
-std::array<float,2>{0.221869439f, 0.370743692f},
-std::array<float,2>{0.718803167f, 0.647397816f},
-std::array<float,2>{0.256013811f, 0.921969891f},
-std::array<float,2>{0.814717293f, 0.141754195f},
-std::array<float,2>{0.486171871f, 0.0564725548f},
-std::array<float,2>{0.933035433f, 0.80375725f},
-std::array<float,2>{0.0175022986f, 0.604200304f},
-std::array<float,2>{0.529802442f, 0.481609672f},
-std::array<float,2>{0.395356774f, 0.415618896f},
-std::array<float,2>{0.976084888f, 0.542800426f},
-std::array<float,2>{0.0883100927f, 0.871041f},
-std::array<float,2>{0.593964338f, 0.0708464831f},
-std::array<float,2>{0.156565756f, 0.215683863f},
-std::array<float,2>{0.667314947f, 0.947619319f},
-std::array<float,2>{0.365902096f, 0.689362288f},
-std::array<float,2>{0.798847198f, 0.274019957f},
-std::array<float,2>{0.0249067117f, 0.322944731f},
-std::array<float,2>{0.517632663f, 0.672991633f},
-std::array<float,2>{0.493030608f, 0.878932476f},
-std::array<float,2>{0.922555685f, 0.17751956f},
-std::array<float,2>{0.263137102f, 0.0261680596f},
-std::array<float,2>{0.82728827f, 0.779338241f},
-std::array<float,2>{0.226780817f, 0.57175231f},
-std::array<float,2>{0.728512049f, 0.438427359f},
-std::array<float,2>{0.341819167f, 0.285575986f},
-std::array<float,2>{0.768926024f, 0.74270916f},
-std::array<float,2>{0.14007917f, 0.989452183f},
-std::array<float,2>{0.632336438f, 0.222518995f},
-std::array<float,2>{0.111180127f, 0.124972098f},
-std::array<float,2>{0.589372635f, 0.825904965f},
-std::array<float,2>{0.423139632f, 0.513292491f},
-std::array<float,2>{0.953372657f, 0.390119076f},
-std::array<float,2>{0.198159218f, 0.474143028f},
-std::array<float,2>{0.706528187f, 0.601220012f},
-std::array<float,2>{0.281671286f, 0.808843672f},
-std::array<float,2>{0.851192415f, 0.0481238738f},
-std::array<float,2>{0.460990161f, 0.155033216f},
-std::array<float,2>{0.878904879f, 0.930445611f},
-std::array<float,2>{0.0522991717f, 0.651828289f},
-std::array<float,2>{0.556222975f, 0.363276273f},
-std::array<float,2>{0.471156687f, 0.346943736f},
-std::array<float,2>{0.920099556f, 0.630347192f},
-std::array<float,2>{0.00617887266f, 0.915612161f},
-std::array<float,2>{0.511957407f, 0.126685396f},
-std::array<float,2>{0.239726618f, 0.0407427624f},
-std::array<float,2>{0.739808738f, 0.79092145f},
-std::array<float,2>{0.281247556f, 0.619281411f},
-std::array<float,2>{0.838862598f, 0.497725278f},
-std::array<float,2>{0.0694374442f, 0.391065687f},
-std::array<float,2>{0.616851509f, 0.528218508f},
-std::array<float,2>{0.386266947f, 0.840075016f},
-std::array<float,2>{0.987215877f, 0.0940939412f},
-std::array<float,2>{0.356556088f, 0.248062819f},
-std::array<float,2>{0.785503805f, 0.970424831f},
-std::array<float,2>{0.181809351f, 0.734056056f},
-std::array<float,2>{0.681883395f, 0.311816573f},
-std::array<float,2>{0.30612874f, 0.458482534f},
-std::array<float,2>{0.864268959f, 0.58812201f},
-std::array<float,2>{0.211822778f, 0.758800507f},
-std::array<float,2>{0.70068866f, 0.0058007841f},
-std::array<float,2>{0.0416476168f, 0.164181754f},
-std::array<float,2>{0.541310549f, 0.89171505f},
-std::array<float,2>{0.439404339f, 0.660526931f},
-std::array<float,2>{0.904406607f, 0.338469416f},
-std::array<float,2>{0.155122072f, 0.26009649f},
-std::array<float,2>{0.643639565f, 0.714763522f},
-std::array<float,2>{0.319491476f, 0.958065629f},
-std::array<float,2>{0.762130678f, 0.190604538f},
-std::array<float,2>{0.408674508f, 0.0814299136f},
-std::array<float,2>{0.947734594f, 0.856406271f},
-std::array<float,2>{0.106973f, 0.559541881f},
-std::array<float,2>{0.562713385f, 0.437377125f},
-std::array<float,2>{0.499158472f, 0.404932141f},
-std::array<float,2>{0.929538727f, 0.516699791f},
-std::array<float,2>{0.0303008277f, 0.831218541f},
-std::array<float,2>{0.521580815f, 0.106083646f},
-std::array<float,2>{0.232828438f, 0.240852162f},
-std::array<float,2>{0.731615007f, 0.983539641f},
-std::array<float,2>{0.260687143f, 0.720157921f},
-std::array<float,2>{0.822854102f, 0.297929257f},
-std::array<float,2>{0.0910776928f, 0.354234606f},
-std::array<float,2>{0.597678125f, 0.639275074f},
-std::array<float,2>{0.391737431f, 0.90760994f},
-std::array<float,2>{0.968874037f, 0.134295791f},
-std::array<float,2>{0.362911671f, 0.0380889364f},
-std::array<float,2>{0.802755952f, 0.785806358f},
-std::array<float,2>{0.163188472f, 0.610118508f},
-std::array<float,2>{0.67036128f, 0.484742701f},
-std::array<float,2>{0.287423253f, 0.254932672f},
-std::array<float,2>{0.843967021f, 0.704715729f},
-std::array<float,2>{0.201005995f, 0.962292731f},
-std::array<float,2>{0.710863292f, 0.201828092f},
-std::array<float,2>{0.050121326f, 0.0892067403f},
-std::array<float,2>{0.559105396f, 0.850174606f},
-std::array<float,2>{0.466035396f, 0.549107075f},
-std::array<float,2>{0.879870892f, 0.423022121f},
-std::array<float,2>{0.133400559f, 0.466208577f},
-std::array<float,2>{0.627123415f, 0.580735445f},
-std::array<float,2>{0.339741558f, 0.757807791f},
-std::array<float,2>{0.770625591f, 0.0121589517f},
-std::array<float,2>{0.427667171f, 0.157029495f},
-std::array<float,2>{0.959738672f, 0.904450536f},
-std::array<float,2>{0.11574582f, 0.669896424f},
-std::array<float,2>{0.591541231f, 0.33038491f},
-std::array<float,2>{0.390002012f, 0.315420479f},
-std::array<float,2>{0.990677655f, 0.684735954f},
-std::array<float,2>{0.0638335124f, 0.887480617f},
-std::array<float,2>{0.612127006f, 0.185005084f},
-std::array<float,2>{0.187457696f, 0.0222841948f},
-std::array<float,2>{0.685964704f, 0.770745099f},
-std::array<float,2>{0.352366596f, 0.568184018f},
-std::array<float,2>{0.782777071f, 0.449730366f},
-std::array<float,2>{0.00156832393f, 0.407237381f},
-std::array<float,2>{0.50904876f, 0.538871586f},
-std::array<float,2>{0.474784195f, 0.862662971f},
-std::array<float,2>{0.91796124f, 0.0625528395f},
-std::array<float,2>{0.274802268f, 0.210234255f},
-std::array<float,2>{0.840616107f, 0.939081848f},
-std::array<float,2>{0.235533267f, 0.699978709f},
-std::array<float,2>{0.735052288f, 0.271088302f},
-std::array<float,2>{0.313253582f, 0.478145301f},
-std::array<float,2>{0.758300483f, 0.605973959f},
-std::array<float,2>{0.149926901f, 0.799967647f},
-std::array<float,2>{0.648111343f, 0.0610930212f},
-std::array<float,2>{0.104659632f, 0.148396999f},
-std::array<float,2>{0.569500566f, 0.926927924f},
-std::array<float,2>{0.411250114f, 0.643683195f},
-std::array<float,2>{0.949293792f, 0.374381214f},
-std::array<float,2>{0.215147778f, 0.293336004f},
-std::array<float,2>{0.698403895f, 0.74109894f},
-std::array<float,2>{0.309370279f, 0.993847728f},
-std::array<float,2>{0.859705389f, 0.228055328f},
-std::array<float,2>{0.442687958f, 0.116023161f},
-std::array<float,2>{0.900962591f, 0.813212574f},
-std::array<float,2>{0.0453517474f, 0.505087793f},
-std::array<float,2>{0.545281768f, 0.379829973f},
-std::array<float,2>{0.418696612f, 0.441773295f},
-std::array<float,2>{0.938428104f, 0.576137304f},
-std::array<float,2>{0.0995780081f, 0.775415123f},
-std::array<float,2>{0.576017857f, 0.031214118f},
-std::array<float,2>{0.143368855f, 0.17457141f},
-std::array<float,2>{0.652833104f, 0.878628552f},
-std::array<float,2>{0.324651897f, 0.67759192f},
-std::array<float,2>{0.750840068f, 0.325989783f},
-std::array<float,2>{0.0327464528f, 0.279856145f},
-std::array<float,2>{0.531422377f, 0.692110896f},
-std::array<float,2>{0.448753744f, 0.949377179f},
-std::array<float,2>{0.893321157f, 0.213790849f},
-std::array<float,2>{0.303400129f, 0.0774533153f},
-std::array<float,2>{0.873677969f, 0.871450782f},
-std::array<float,2>{0.206268609f, 0.54643631f},
-std::array<float,2>{0.694660008f, 0.420255661f},
-std::array<float,2>{0.344554812f, 0.366988182f},
-std::array<float,2>{0.793290675f, 0.65410465f},
-std::array<float,2>{0.179339141f, 0.93408066f},
-std::array<float,2>{0.679672778f, 0.150654033f},
-std::array<float,2>{0.0729811117f, 0.0545756519f},
-std::array<float,2>{0.62425977f, 0.807560027f},
-std::array<float,2>{0.38087979f, 0.594779372f},
-std::array<float,2>{0.99511838f, 0.471712798f},
-std::array<float,2>{0.247252077f, 0.386207253f},
-std::array<float,2>{0.744777918f, 0.507873297f},
-std::array<float,2>{0.26707536f, 0.821864069f},
-std::array<float,2>{0.83082068f, 0.120177388f},
-std::array<float,2>{0.484119266f, 0.225698799f},
-std::array<float,2>{0.911074162f, 0.987899482f},
-std::array<float,2>{0.0140198804f, 0.747046888f},
-std::array<float,2>{0.500565886f, 0.282166064f},
-std::array<float,2>{0.460900664f, 0.307725102f},
-std::array<float,2>{0.883646011f, 0.73045063f},
-std::array<float,2>{0.055263564f, 0.976520479f},
-std::array<float,2>{0.548349321f, 0.244440392f},
-std::array<float,2>{0.190481022f, 0.09910357f},
-std::array<float,2>{0.718335211f, 0.839396f},
-std::array<float,2>{0.292834133f, 0.524143517f},
-std::array<float,2>{0.85416925f, 0.395208597f},
-std::array<float,2>{0.119144417f, 0.492728472f},
-std::array<float,2>{0.583050907f, 0.622090876f},
-std::array<float,2>{0.435322881f, 0.796613097f},
-std::array<float,2>{0.962770998f, 0.0460351072f},
-std::array<float,2>{0.331603527f, 0.129619375f},
-std::array<float,2>{0.77368772f, 0.919246435f},
-std::array<float,2>{0.125520512f, 0.626287937f},
-std::array<float,2>{0.638940871f, 0.351264805f},
-std::array<float,2>{0.251343489f, 0.432003558f},
-std::array<float,2>{0.819464326f, 0.556998372f},
-std::array<float,2>{0.222892106f, 0.852571189f},
-std::array<float,2>{0.723015785f, 0.0829179734f},
-std::array<float,2>{0.0206507333f, 0.191715837f},
-std::array<float,2>{0.524978817f, 0.95353812f},
-std::array<float,2>{0.491369367f, 0.716127396f},
-std::array<float,2>{0.934796035f, 0.264521927f},
-std::array<float,2>{0.16940625f, 0.341596484f},
-std::array<float,2>{0.658267379f, 0.659294844f},
-std::array<float,2>{0.369627625f, 0.89726156f},
-std::array<float,2>{0.809054494f, 0.168333441f},
-std::array<float,2>{0.401596516f, 0.00279900222f},
-std::array<float,2>{0.979636014f, 0.764363766f},
-std::array<float,2>{0.079670988f, 0.591773391f},
-std::array<float,2>{0.603311896f, 0.454739362f},
-std::array<float,2>{0.479745984f, 0.463422626f},
-std::array<float,2>{0.907962263f, 0.583810627f},
-std::array<float,2>{0.0114507219f, 0.750146747f},
-std::array<float,2>{0.506525159f, 0.0115819098f},
-std::array<float,2>{0.245519757f, 0.161870733f},
-std::array<float,2>{0.747053206f, 0.901199102f},
-std::array<float,2>{0.269585401f, 0.666516185f},
-std::array<float,2>{0.835770488f, 0.332047313f},
-std::array<float,2>{0.0761712939f, 0.250961035f},
-std::array<float,2>{0.618344963f, 0.708880067f},
-std::array<float,2>{0.377841383f, 0.966341019f},
-std::array<float,2>{0.99875623f, 0.197075918f},
-std::array<float,2>{0.347853541f, 0.0924193114f},
-std::array<float,2>{0.792372346f, 0.845001698f},
-std::array<float,2>{0.174442679f, 0.551000535f},
-std::array<float,2>{0.673422694f, 0.426487148f},
-std::array<float,2>{0.298950016f, 0.35740611f},
-std::array<float,2>{0.869369149f, 0.634735823f},
-std::array<float,2>{0.207771346f, 0.913916469f},
-std::array<float,2>{0.689803064f, 0.139618725f},
-std::array<float,2>{0.0377785973f, 0.033106681f},
-std::array<float,2>{0.536824644f, 0.784855545f},
-std::array<float,2>{0.451853186f, 0.614810288f},
-std::array<float,2>{0.896199048f, 0.49102816f},
-std::array<float,2>{0.147183359f, 0.401261747f},
-std::array<float,2>{0.649682224f, 0.521044374f},
-std::array<float,2>{0.323503643f, 0.835392594f},
-std::array<float,2>{0.756817937f, 0.10381569f},
-std::array<float,2>{0.416655242f, 0.236684516f},
-std::array<float,2>{0.941560507f, 0.976979494f},
-std::array<float,2>{0.0975841358f, 0.72480309f},
-std::array<float,2>{0.57144022f, 0.303029954f},
-std::array<float,2>{0.402892202f, 0.2912094f},
-std::array<float,2>{0.983922005f, 0.737559319f},
-std::array<float,2>{0.0831611231f, 0.997848928f},
-std::array<float,2>{0.607048929f, 0.23133491f},
-std::array<float,2>{0.164853901f, 0.110387087f},
-std::array<float,2>{0.660960913f, 0.816644788f},
-std::array<float,2>{0.371428162f, 0.503237188f},
-std::array<float,2>{0.807165086f, 0.376188099f},
-std::array<float,2>{0.0187691115f, 0.484207243f},
-std::array<float,2>{0.527859509f, 0.602442443f},
-std::array<float,2>{0.487024814f, 0.802040458f},
-std::array<float,2>{0.930879772f, 0.0584956929f},
-std::array<float,2>{0.254923135f, 0.142814577f},
-std::array<float,2>{0.813409328f, 0.925236702f},
-std::array<float,2>{0.219064593f, 0.644722521f},
-std::array<float,2>{0.722474456f, 0.368364125f},
-std::array<float,2>{0.333729327f, 0.412926763f},
-std::array<float,2>{0.779588521f, 0.534392595f},
-std::array<float,2>{0.129939348f, 0.865966976f},
-std::array<float,2>{0.634254575f, 0.0676805228f},
-std::array<float,2>{0.122004293f, 0.205159009f},
-std::array<float,2>{0.578318417f, 0.94196713f},
-std::array<float,2>{0.431291312f, 0.698654473f},
-std::array<float,2>{0.966757834f, 0.267127991f},
-std::array<float,2>{0.193644315f, 0.316512555f},
-std::array<float,2>{0.71157378f, 0.681169748f},
-std::array<float,2>{0.296198428f, 0.88479799f},
-std::array<float,2>{0.85619694f, 0.181633011f},
-std::array<float,2>{0.456272364f, 0.0179558937f},
-std::array<float,2>{0.886849403f, 0.766490877f},
-std::array<float,2>{0.0622631237f, 0.5650087f},
-std::array<float,2>{0.55120784f, 0.447360098f},
-std::array<float,2>{0.424054623f, 0.387985915f},
-std::array<float,2>{0.956448495f, 0.514178932f},
-std::array<float,2>{0.112655975f, 0.82768321f},
-std::array<float,2>{0.58658576f, 0.122956954f},
-std::array<float,2>{0.137866333f, 0.219498307f},
-std::array<float,2>{0.629799068f, 0.991810977f},
-std::array<float,2>{0.341740102f, 0.745506287f},
-std::array<float,2>{0.76661092f, 0.288567066f},
-std::array<float,2>{0.0541604906f, 0.36074248f},
-std::array<float,2>{0.55855298f, 0.649529159f},
-std::array<float,2>{0.463407993f, 0.933392525f},
-std::array<float,2>{0.875706315f, 0.153048858f},
-std::array<float,2>{0.284637272f, 0.0507571846f},
-std::array<float,2>{0.84837842f, 0.810763419f},
-std::array<float,2>{0.196390763f, 0.597765982f},
-std::array<float,2>{0.704721451f, 0.4765293f},
-std::array<float,2>{0.364630222f, 0.277197301f},
-std::array<float,2>{0.797887444f, 0.689630389f},
-std::array<float,2>{0.159878269f, 0.946447074f},
-std::array<float,2>{0.665280521f, 0.217803359f},
-std::array<float,2>{0.0876918957f, 0.0726463869f},
-std::array<float,2>{0.59727478f, 0.868272364f},
-std::array<float,2>{0.396784246f, 0.540241897f},
-std::array<float,2>{0.973979175f, 0.416016459f},
-std::array<float,2>{0.230138451f, 0.440037191f},
-std::array<float,2>{0.729556799f, 0.574013591f},
-std::array<float,2>{0.263804257f, 0.779243529f},
-std::array<float,2>{0.824748278f, 0.0252517369f},
-std::array<float,2>{0.495747238f, 0.177861616f},
-std::array<float,2>{0.924610376f, 0.881358981f},
-std::array<float,2>{0.0255793333f, 0.674797237f},
-std::array<float,2>{0.517531574f, 0.321741611f},
-std::array<float,2>{0.440449327f, 0.337534428f},
-std::array<float,2>{0.904093504f, 0.662906408f},
-std::array<float,2>{0.0390801392f, 0.893418908f},
-std::array<float,2>{0.540498793f, 0.166967228f},
-std::array<float,2>{0.214383096f, 0.00635154126f},
-std::array<float,2>{0.703019679f, 0.760200679f},
-std::array<float,2>{0.306887746f, 0.586325109f},
-std::array<float,2>{0.866346002f, 0.459618986f},
-std::array<float,2>{0.108380519f, 0.434689403f},
-std::array<float,2>{0.56455493f, 0.560764968f},
-std::array<float,2>{0.408075988f, 0.858357012f},
-std::array<float,2>{0.945522487f, 0.0794854686f},
-std::array<float,2>{0.318125397f, 0.187782988f},
-std::array<float,2>{0.76482141f, 0.959647775f},
-std::array<float,2>{0.154295892f, 0.71152693f},
-std::array<float,2>{0.640741348f, 0.259236544f},
-std::array<float,2>{0.277745068f, 0.499284834f},
-std::array<float,2>{0.837306917f, 0.617194295f},
-std::array<float,2>{0.240439147f, 0.792500019f},
-std::array<float,2>{0.741308451f, 0.0414854437f},
-std::array<float,2>{0.00510695716f, 0.128493652f},
-std::array<float,2>{0.514835238f, 0.916154981f},
-std::array<float,2>{0.46875608f, 0.632789552f},
-std::array<float,2>{0.918153703f, 0.344681561f},
-std::array<float,2>{0.181622326f, 0.310007274f},
-std::array<float,2>{0.68119818f, 0.732056618f},
-std::array<float,2>{0.357661813f, 0.971303821f},
-std::array<float,2>{0.787377894f, 0.247132361f},
-std::array<float,2>{0.384308696f, 0.096479319f},
-std::array<float,2>{0.985999346f, 0.843716443f},
-std::array<float,2>{0.0673828498f, 0.52975738f},
-std::array<float,2>{0.613596678f, 0.393894523f},
-std::array<float,2>{0.467075706f, 0.424643934f},
-std::array<float,2>{0.881002963f, 0.546947539f},
-std::array<float,2>{0.047654096f, 0.847729623f},
-std::array<float,2>{0.561831474f, 0.0861951411f},
-std::array<float,2>{0.203003675f, 0.199624792f},
-std::array<float,2>{0.708490252f, 0.963013887f},
-std::array<float,2>{0.286311716f, 0.705204427f},
-std::array<float,2>{0.846801519f, 0.256914407f},
-std::array<float,2>{0.113291956f, 0.328329563f},
-std::array<float,2>{0.593063891f, 0.670587718f},
-std::array<float,2>{0.428710938f, 0.903537393f},
-std::array<float,2>{0.958365679f, 0.159734592f},
-std::array<float,2>{0.337242007f, 0.0156013276f},
-std::array<float,2>{0.771763325f, 0.754859149f},
-std::array<float,2>{0.135921195f, 0.578252316f},
-std::array<float,2>{0.625738025f, 0.467188925f},
-std::array<float,2>{0.2591874f, 0.300244689f},
-std::array<float,2>{0.820750594f, 0.721126914f},
-std::array<float,2>{0.232089266f, 0.9820683f},
-std::array<float,2>{0.733791292f, 0.239147261f},
-std::array<float,2>{0.0274309497f, 0.108692139f},
-std::array<float,2>{0.520172715f, 0.828342021f},
-std::array<float,2>{0.497680545f, 0.519334733f},
-std::array<float,2>{0.926732481f, 0.402501643f},
-std::array<float,2>{0.160685793f, 0.488003403f},
-std::array<float,2>{0.66814512f, 0.611854494f},
-std::array<float,2>{0.359714836f, 0.78902775f},
-std::array<float,2>{0.800785959f, 0.0358966328f},
-std::array<float,2>{0.393349051f, 0.135059997f},
-std::array<float,2>{0.971737325f, 0.909872949f},
-std::array<float,2>{0.0935636759f, 0.638031721f},
-std::array<float,2>{0.601085961f, 0.352562606f},
-std::array<float,2>{0.413010746f, 0.372543663f},
-std::array<float,2>{0.952734292f, 0.641689718f},
-std::array<float,2>{0.103090271f, 0.929454565f},
-std::array<float,2>{0.567693114f, 0.145751566f},
-std::array<float,2>{0.150892824f, 0.0590454377f},
-std::array<float,2>{0.646329761f, 0.797643721f},
-std::array<float,2>{0.316270322f, 0.609055102f},
-std::array<float,2>{0.760064065f, 0.479210019f},
-std::array<float,2>{0.044722911f, 0.381505042f},
-std::array<float,2>{0.543050349f, 0.506842852f},
-std::array<float,2>{0.445118994f, 0.816160619f},
-std::array<float,2>{0.900254667f, 0.11427854f},
-std::array<float,2>{0.310677737f, 0.229542822f},
-std::array<float,2>{0.861809194f, 0.995914519f},
-std::array<float,2>{0.217036501f, 0.738431334f},
-std::array<float,2>{0.696336806f, 0.295650423f},
-std::array<float,2>{0.354127169f, 0.452054352f},
-std::array<float,2>{0.784842849f, 0.568479896f},
-std::array<float,2>{0.184235156f, 0.771716177f},
-std::array<float,2>{0.684717894f, 0.0208296422f},
-std::array<float,2>{0.0649949759f, 0.18661195f},
-std::array<float,2>{0.610049307f, 0.88926363f},
-std::array<float,2>{0.387720764f, 0.686468303f},
-std::array<float,2>{0.988960266f, 0.313961595f},
-std::array<float,2>{0.236977741f, 0.271779418f},
-std::array<float,2>{0.737621129f, 0.702100098f},
-std::array<float,2>{0.276856691f, 0.940568209f},
-std::array<float,2>{0.841831684f, 0.208732024f},
-std::array<float,2>{0.473947763f, 0.0655271038f},
-std::array<float,2>{0.914830804f, 0.859874308f},
-std::array<float,2>{0.00309122913f, 0.536327183f},
-std::array<float,2>{0.509966373f, 0.408370554f},
-std::array<float,2>{0.379662991f, 0.46936366f},
-std::array<float,2>{0.992660522f, 0.597105563f},
-std::array<float,2>{0.0710286722f, 0.805801272f},
-std::array<float,2>{0.621560097f, 0.0525495373f},
-std::array<float,2>{0.177001178f, 0.149360031f},
-std::array<float,2>{0.676136971f, 0.93658334f},
-std::array<float,2>{0.346733123f, 0.655266881f},
-std::array<float,2>{0.796040833f, 0.365152001f},
-std::array<float,2>{0.0135374246f, 0.283441186f},
-std::array<float,2>{0.503867388f, 0.74973166f},
-std::array<float,2>{0.480471104f, 0.98451364f},
-std::array<float,2>{0.913960278f, 0.224459797f},
-std::array<float,2>{0.269343585f, 0.117994428f},
-std::array<float,2>{0.829774737f, 0.82324326f},
-std::array<float,2>{0.24897182f, 0.511636615f},
-std::array<float,2>{0.743862808f, 0.383464426f},
-std::array<float,2>{0.326561958f, 0.327009231f},
-std::array<float,2>{0.753320694f, 0.677864075f},
-std::array<float,2>{0.142099798f, 0.876194179f},
-std::array<float,2>{0.654401422f, 0.172309145f},
-std::array<float,2>{0.101149499f, 0.0285550058f},
-std::array<float,2>{0.577608824f, 0.77513361f},
-std::array<float,2>{0.420023203f, 0.577488184f},
-std::array<float,2>{0.941073895f, 0.444057018f},
-std::array<float,2>{0.203936264f, 0.419381917f},
-std::array<float,2>{0.693231821f, 0.544917822f},
-std::array<float,2>{0.302142411f, 0.873121679f},
-std::array<float,2>{0.871586323f, 0.0749474764f},
-std::array<float,2>{0.445794404f, 0.210985899f},
-std::array<float,2>{0.89072448f, 0.953069866f},
-std::array<float,2>{0.0337968394f, 0.694076598f},
-std::array<float,2>{0.534824133f, 0.278257102f},
-std::array<float,2>{0.489279985f, 0.262931406f},
-std::array<float,2>{0.93593502f, 0.718309939f},
-std::array<float,2>{0.0219768416f, 0.956071019f},
-std::array<float,2>{0.526109457f, 0.195106179f},
-std::array<float,2>{0.225905716f, 0.0856577232f},
-std::array<float,2>{0.725418329f, 0.854202211f},
-std::array<float,2>{0.252464235f, 0.555907309f},
-std::array<float,2>{0.81778419f, 0.429956317f},
-std::array<float,2>{0.0802398846f, 0.456753165f},
-std::array<float,2>{0.603610098f, 0.59181273f},
-std::array<float,2>{0.398492187f, 0.762695372f},
-std::array<float,2>{0.978313029f, 0.00190956728f},
-std::array<float,2>{0.369095474f, 0.170182049f},
-std::array<float,2>{0.810563385f, 0.89638716f},
-std::array<float,2>{0.171417996f, 0.656680107f},
-std::array<float,2>{0.65666759f, 0.342146158f},
-std::array<float,2>{0.289607614f, 0.397494525f},
-std::array<float,2>{0.852938175f, 0.527045786f},
-std::array<float,2>{0.188803822f, 0.836360276f},
-std::array<float,2>{0.716503918f, 0.0997811407f},
-std::array<float,2>{0.0580242872f, 0.242841005f},
-std::array<float,2>{0.550111294f, 0.973679304f},
-std::array<float,2>{0.458344877f, 0.727615893f},
-std::array<float,2>{0.886075139f, 0.304996282f},
-std::array<float,2>{0.127722383f, 0.347886235f},
-std::array<float,2>{0.637071908f, 0.627408743f},
-std::array<float,2>{0.329115957f, 0.92174089f},
-std::array<float,2>{0.776925802f, 0.132426739f},
-std::array<float,2>{0.436288685f, 0.0436137542f},
-std::array<float,2>{0.96454668f, 0.793019772f},
-std::array<float,2>{0.117417455f, 0.623767197f},
-std::array<float,2>{0.584561169f, 0.494650394f},
-std::array<float,2>{0.449011445f, 0.444375664f},
-std::array<float,2>{0.893179119f, 0.576407731f},
-std::array<float,2>{0.0331128612f, 0.774220169f},
-std::array<float,2>{0.53171593f, 0.0276231449f},
-std::array<float,2>{0.206353769f, 0.173686191f},
-std::array<float,2>{0.694504023f, 0.875949919f},
-std::array<float,2>{0.303537607f, 0.679470956f},
-std::array<float,2>{0.873936474f, 0.327614903f},
-std::array<float,2>{0.0992649943f, 0.278581679f},
-std::array<float,2>{0.575694025f, 0.694858849f},
-std::array<float,2>{0.418782473f, 0.952083051f},
-std::array<float,2>{0.938044906f, 0.212409094f},
-std::array<float,2>{0.324359119f, 0.0753865466f},
-std::array<float,2>{0.750535011f, 0.874409378f},
-std::array<float,2>{0.143112436f, 0.543054342f},
-std::array<float,2>{0.653099f, 0.418356836f},
-std::array<float,2>{0.266676843f, 0.363658369f},
-std::array<float,2>{0.830799043f, 0.655846238f},
-std::array<float,2>{0.247337639f, 0.935716331f},
-std::array<float,2>{0.744951665f, 0.150247842f},
-std::array<float,2>{0.013678669f, 0.0517012514f},
-std::array<float,2>{0.500934482f, 0.804780722f},
-std::array<float,2>{0.484165728f, 0.596213341f},
-std::array<float,2>{0.910849333f, 0.470362186f},
-std::array<float,2>{0.179626226f, 0.384032667f},
-std::array<float,2>{0.67932117f, 0.5100106f},
-std::array<float,2>{0.344318688f, 0.823013783f},
-std::array<float,2>{0.793110132f, 0.118439212f},
-std::array<float,2>{0.381164193f, 0.223483711f},
-std::array<float,2>{0.995443285f, 0.985881507f},
-std::array<float,2>{0.0730103403f, 0.748401225f},
-std::array<float,2>{0.624399662f, 0.284449726f},
-std::array<float,2>{0.435129881f, 0.306614727f},
-std::array<float,2>{0.962535739f, 0.726881683f},
-std::array<float,2>{0.119473435f, 0.973112881f},
-std::array<float,2>{0.583474398f, 0.243298873f},
-std::array<float,2>{0.125781685f, 0.101422347f},
-std::array<float,2>{0.638782501f, 0.837373018f},
-std::array<float,2>{0.331827104f, 0.525499403f},
-std::array<float,2>{0.773635864f, 0.397444665f},
-std::array<float,2>{0.0555072054f, 0.495365858f},
-std::array<float,2>{0.548664868f, 0.624712706f},
-std::array<float,2>{0.460622042f, 0.794770777f},
-std::array<float,2>{0.883457005f, 0.0441858359f},
-std::array<float,2>{0.292515963f, 0.13179636f},
-std::array<float,2>{0.854459107f, 0.920613408f},
-std::array<float,2>{0.19090049f, 0.628190339f},
-std::array<float,2>{0.718627691f, 0.349405587f},
-std::array<float,2>{0.36928609f, 0.431226552f},
-std::array<float,2>{0.808696687f, 0.554699361f},
-std::array<float,2>{0.169016242f, 0.854564726f},
-std::array<float,2>{0.658622324f, 0.0840330794f},
-std::array<float,2>{0.0800751969f, 0.193794817f},
-std::array<float,2>{0.603143275f, 0.955426097f},
-std::array<float,2>{0.401751131f, 0.717149138f},
-std::array<float,2>{0.979747117f, 0.262363046f},
-std::array<float,2>{0.222962096f, 0.343385398f},
-std::array<float,2>{0.722893775f, 0.657437146f},
-std::array<float,2>{0.251171857f, 0.894829094f},
-std::array<float,2>{0.819764733f, 0.171437234f},
-std::array<float,2>{0.491517276f, 0.000836766732f},
-std::array<float,2>{0.934943318f, 0.762183666f},
-std::array<float,2>{0.0208711755f, 0.593078434f},
-std::array<float,2>{0.52532208f, 0.455478668f},
-std::array<float,2>{0.391976178f, 0.403384775f},
-std::array<float,2>{0.969142258f, 0.518286705f},
-std::array<float,2>{0.0908723176f, 0.829771757f},
-std::array<float,2>{0.597937584f, 0.108018972f},
-std::array<float,2>{0.163444415f, 0.239852428f},
-std::array<float,2>{0.670111358f, 0.981404841f},
-std::array<float,2>{0.363054365f, 0.722381711f},
-std::array<float,2>{0.803073049f, 0.299552798f},
-std::array<float,2>{0.0305422768f, 0.352171212f},
-std::array<float,2>{0.521835327f, 0.637371719f},
-std::array<float,2>{0.499386817f, 0.908227444f},
-std::array<float,2>{0.929443002f, 0.136504203f},
-std::array<float,2>{0.260411114f, 0.0370283239f},
-std::array<float,2>{0.823242068f, 0.787367344f},
-std::array<float,2>{0.232441351f, 0.612378538f},
-std::array<float,2>{0.731701493f, 0.486920089f},
-std::array<float,2>{0.339359671f, 0.256030768f},
-std::array<float,2>{0.770770431f, 0.706098676f},
-std::array<float,2>{0.133596376f, 0.964757204f},
-std::array<float,2>{0.627300441f, 0.200713664f},
-std::array<float,2>{0.116002083f, 0.0876878127f},
-std::array<float,2>{0.591795146f, 0.848886967f},
-std::array<float,2>{0.427393407f, 0.548262894f},
-std::array<float,2>{0.959517419f, 0.42542237f},
-std::array<float,2>{0.200770706f, 0.467966706f},
-std::array<float,2>{0.710529208f, 0.579250634f},
-std::array<float,2>{0.287279993f, 0.755698979f},
-std::array<float,2>{0.844118953f, 0.0144623108f},
-std::array<float,2>{0.466273993f, 0.159155652f},
-std::array<float,2>{0.879579306f, 0.902987242f},
-std::array<float,2>{0.0498142131f, 0.671149433f},
-std::array<float,2>{0.559505582f, 0.329518139f},
-std::array<float,2>{0.474900365f, 0.313054711f},
-std::array<float,2>{0.917707503f, 0.686625957f},
-std::array<float,2>{0.00193189445f, 0.889734685f},
-std::array<float,2>{0.508966565f, 0.185809359f},
-std::array<float,2>{0.235778794f, 0.0196355097f},
-std::array<float,2>{0.735194206f, 0.773295701f},
-std::array<float,2>{0.27462393f, 0.570052385f},
-std::array<float,2>{0.840422392f, 0.45234105f},
-std::array<float,2>{0.063633725f, 0.409465939f},
-std::array<float,2>{0.612032592f, 0.535274267f},
-std::array<float,2>{0.389886796f, 0.860532761f},
-std::array<float,2>{0.990402758f, 0.0649923384f},
-std::array<float,2>{0.352280915f, 0.207596481f},
-std::array<float,2>{0.783055604f, 0.939480484f},
-std::array<float,2>{0.187114283f, 0.702390909f},
-std::array<float,2>{0.685745835f, 0.273293674f},
-std::array<float,2>{0.309171587f, 0.479692698f},
-std::array<float,2>{0.859427392f, 0.607684433f},
-std::array<float,2>{0.215046987f, 0.798597813f},
-std::array<float,2>{0.698595405f, 0.0602231734f},
-std::array<float,2>{0.0450668223f, 0.144877598f},
-std::array<float,2>{0.545118093f, 0.928557992f},
-std::array<float,2>{0.442592621f, 0.640940785f},
-std::array<float,2>{0.90115428f, 0.37149033f},
-std::array<float,2>{0.15018785f, 0.296650738f},
-std::array<float,2>{0.648312151f, 0.740042925f},
-std::array<float,2>{0.312989116f, 0.994948328f},
-std::array<float,2>{0.757862747f, 0.228934973f},
-std::array<float,2>{0.411399722f, 0.113877796f},
-std::array<float,2>{0.949600339f, 0.81501627f},
-std::array<float,2>{0.104953907f, 0.506812871f},
-std::array<float,2>{0.56975466f, 0.382460445f},
-std::array<float,2>{0.492717028f, 0.417308569f},
-std::array<float,2>{0.922790885f, 0.539640546f},
-std::array<float,2>{0.0253268741f, 0.867396891f},
-std::array<float,2>{0.517869294f, 0.0733067915f},
-std::array<float,2>{0.226919889f, 0.217442989f},
-std::array<float,2>{0.728116095f, 0.946016729f},
-std::array<float,2>{0.262815118f, 0.691317618f},
-std::array<float,2>{0.827567399f, 0.275674254f},
-std::array<float,2>{0.0879159272f, 0.320343792f},
-std::array<float,2>{0.594166696f, 0.675352216f},
-std::array<float,2>{0.395071983f, 0.882733226f},
-std::array<float,2>{0.976524949f, 0.179360941f},
-std::array<float,2>{0.366001993f, 0.0239557046f},
-std::array<float,2>{0.799073935f, 0.778275967f},
-std::array<float,2>{0.156252891f, 0.572948933f},
-std::array<float,2>{0.667211831f, 0.441115916f},
-std::array<float,2>{0.281275064f, 0.287967473f},
-std::array<float,2>{0.851367474f, 0.744928837f},
-std::array<float,2>{0.197805449f, 0.990473688f},
-std::array<float,2>{0.706142247f, 0.219940513f},
-std::array<float,2>{0.0526217781f, 0.121324979f},
-std::array<float,2>{0.556565166f, 0.826862156f},
-std::array<float,2>{0.461212516f, 0.515040159f},
-std::array<float,2>{0.878584027f, 0.387050301f},
-std::array<float,2>{0.139871463f, 0.47469458f},
-std::array<float,2>{0.632604539f, 0.599607587f},
-std::array<float,2>{0.342203647f, 0.812032163f},
-std::array<float,2>{0.768745661f, 0.0489507951f},
-std::array<float,2>{0.422852248f, 0.153907865f},
-std::array<float,2>{0.953225732f, 0.93213594f},
-std::array<float,2>{0.111038566f, 0.64937067f},
-std::array<float,2>{0.589665949f, 0.359731019f},
-std::array<float,2>{0.386555403f, 0.345212817f},
-std::array<float,2>{0.986858666f, 0.631461084f},
-std::array<float,2>{0.0697571933f, 0.917034388f},
-std::array<float,2>{0.617133141f, 0.127012461f},
-std::array<float,2>{0.181931242f, 0.0423235148f},
-std::array<float,2>{0.68209374f, 0.791949511f},
-std::array<float,2>{0.356816292f, 0.618797839f},
-std::array<float,2>{0.785393298f, 0.498439819f},
-std::array<float,2>{0.0059076054f, 0.392773807f},
-std::array<float,2>{0.512129068f, 0.530320525f},
-std::array<float,2>{0.470891833f, 0.842126429f},
-std::array<float,2>{0.92019552f, 0.0974431261f},
-std::array<float,2>{0.280997962f, 0.246876419f},
-std::array<float,2>{0.838609457f, 0.972183824f},
-std::array<float,2>{0.239430428f, 0.730849624f},
-std::array<float,2>{0.740052998f, 0.308838904f},
-std::array<float,2>{0.319645941f, 0.46019873f},
-std::array<float,2>{0.76186198f, 0.587067783f},
-std::array<float,2>{0.154946998f, 0.761470437f},
-std::array<float,2>{0.643803298f, 0.00702805957f},
-std::array<float,2>{0.107337706f, 0.167053968f},
-std::array<float,2>{0.562912524f, 0.894133508f},
-std::array<float,2>{0.408245772f, 0.663631082f},
-std::array<float,2>{0.947454154f, 0.33690998f},
-std::array<float,2>{0.211665154f, 0.258668989f},
-std::array<float,2>{0.701024771f, 0.712054014f},
-std::array<float,2>{0.305719405f, 0.960935473f},
-std::array<float,2>{0.86473614f, 0.188790888f},
-std::array<float,2>{0.439115703f, 0.0786909088f},
-std::array<float,2>{0.904607654f, 0.859154642f},
-std::array<float,2>{0.041772075f, 0.561913252f},
-std::array<float,2>{0.541105807f, 0.43396005f},
-std::array<float,2>{0.415054321f, 0.49179852f},
-std::array<float,2>{0.943855226f, 0.61384517f},
-std::array<float,2>{0.0953180715f, 0.783470869f},
-std::array<float,2>{0.573999941f, 0.0312771536f},
-std::array<float,2>{0.144563213f, 0.139704421f},
-std::array<float,2>{0.651272476f, 0.9122473f},
-std::array<float,2>{0.32111752f, 0.632929504f},
-std::array<float,2>{0.754694104f, 0.356196016f},
-std::array<float,2>{0.0359529592f, 0.303988069f},
-std::array<float,2>{0.538865983f, 0.725673556f},
-std::array<float,2>{0.449703932f, 0.977883101f},
-std::array<float,2>{0.897818685f, 0.238243863f},
-std::array<float,2>{0.298100471f, 0.104799539f},
-std::array<float,2>{0.868057966f, 0.834756374f},
-std::array<float,2>{0.20989728f, 0.520467997f},
-std::array<float,2>{0.687866211f, 0.402315021f},
-std::array<float,2>{0.35038057f, 0.333129466f},
-std::array<float,2>{0.790153563f, 0.667554498f},
-std::array<float,2>{0.172203749f, 0.90174973f},
-std::array<float,2>{0.675418496f, 0.160466641f},
-std::array<float,2>{0.0778216869f, 0.0101217022f},
-std::array<float,2>{0.61924392f, 0.751090586f},
-std::array<float,2>{0.375243932f, 0.582859576f},
-std::array<float,2>{0.996912539f, 0.464362472f},
-std::array<float,2>{0.243575871f, 0.427574754f},
-std::array<float,2>{0.749736547f, 0.552434981f},
-std::array<float,2>{0.272536963f, 0.843791723f},
-std::array<float,2>{0.832222998f, 0.0932940766f},
-std::array<float,2>{0.477326423f, 0.195744932f},
-std::array<float,2>{0.908773541f, 0.965254128f},
-std::array<float,2>{0.00952792633f, 0.707407534f},
-std::array<float,2>{0.505610526f, 0.251835257f},
-std::array<float,2>{0.454281092f, 0.266142368f},
-std::array<float,2>{0.889641941f, 0.69731015f},
-std::array<float,2>{0.0598344579f, 0.943122387f},
-std::array<float,2>{0.553076744f, 0.206055805f},
-std::array<float,2>{0.193358541f, 0.0664800629f},
-std::array<float,2>{0.714078009f, 0.866616189f},
-std::array<float,2>{0.294694692f, 0.534008563f},
-std::array<float,2>{0.857952178f, 0.413733929f},
-std::array<float,2>{0.123375282f, 0.448600203f},
-std::array<float,2>{0.580287158f, 0.56611836f},
-std::array<float,2>{0.432539105f, 0.767386436f},
-std::array<float,2>{0.967572093f, 0.0192065984f},
-std::array<float,2>{0.334831625f, 0.18056193f},
-std::array<float,2>{0.778998315f, 0.885992765f},
-std::array<float,2>{0.132067457f, 0.67973876f},
-std::array<float,2>{0.636545122f, 0.318353444f},
-std::array<float,2>{0.25611946f, 0.375497937f},
-std::array<float,2>{0.814581096f, 0.502845168f},
-std::array<float,2>{0.221943766f, 0.818053126f},
-std::array<float,2>{0.719222546f, 0.1099592f},
-std::array<float,2>{0.0172616877f, 0.232202083f},
-std::array<float,2>{0.530091286f, 0.996991813f},
-std::array<float,2>{0.485907465f, 0.737241328f},
-std::array<float,2>{0.932787776f, 0.292960346f},
-std::array<float,2>{0.167710304f, 0.36809665f},
-std::array<float,2>{0.663282335f, 0.646411002f},
-std::array<float,2>{0.373304188f, 0.924236119f},
-std::array<float,2>{0.806258857f, 0.143992379f},
-std::array<float,2>{0.404442877f, 0.0572986417f},
-std::array<float,2>{0.980483234f, 0.800908744f},
-std::array<float,2>{0.0850861371f, 0.602926075f},
-std::array<float,2>{0.608740449f, 0.483294219f},
-std::array<float,2>{0.480787426f, 0.471437275f},
-std::array<float,2>{0.913778484f, 0.594445527f},
-std::array<float,2>{0.0133431889f, 0.807860076f},
-std::array<float,2>{0.503619254f, 0.0534445792f},
-std::array<float,2>{0.248740166f, 0.152067497f},
-std::array<float,2>{0.744031191f, 0.935352862f},
-std::array<float,2>{0.269169331f, 0.65318203f},
-std::array<float,2>{0.830013156f, 0.365738034f},
-std::array<float,2>{0.0711673647f, 0.282755941f},
-std::array<float,2>{0.621326149f, 0.747780383f},
-std::array<float,2>{0.379595459f, 0.986809731f},
-std::array<float,2>{0.99221909f, 0.224700943f},
-std::array<float,2>{0.347141266f, 0.119225174f},
-std::array<float,2>{0.796228349f, 0.820536077f},
-std::array<float,2>{0.177117988f, 0.509393156f},
-std::array<float,2>{0.675830007f, 0.385446548f},
-std::array<float,2>{0.301884353f, 0.32466796f},
-std::array<float,2>{0.871900439f, 0.676506162f},
-std::array<float,2>{0.203739241f, 0.877553046f},
-std::array<float,2>{0.69296211f, 0.175733924f},
-std::array<float,2>{0.0341768749f, 0.0293159503f},
-std::array<float,2>{0.535076261f, 0.776756883f},
-std::array<float,2>{0.445346326f, 0.574483991f},
-std::array<float,2>{0.891013861f, 0.442806989f},
-std::array<float,2>{0.14236033f, 0.421690673f},
-std::array<float,2>{0.654555023f, 0.545843005f},
-std::array<float,2>{0.326340467f, 0.872921109f},
-std::array<float,2>{0.753148019f, 0.0765032545f},
-std::array<float,2>{0.420317113f, 0.214199275f},
-std::array<float,2>{0.941222906f, 0.95068413f},
-std::array<float,2>{0.101545848f, 0.692652404f},
-std::array<float,2>{0.577359378f, 0.280561417f},
-std::array<float,2>{0.398860008f, 0.264689177f},
-std::array<float,2>{0.978113651f, 0.715256751f},
-std::array<float,2>{0.0805266723f, 0.954341412f},
-std::array<float,2>{0.603900373f, 0.192762047f},
-std::array<float,2>{0.171750277f, 0.0835944265f},
-std::array<float,2>{0.656467319f, 0.851914704f},
-std::array<float,2>{0.368654877f, 0.558146119f},
-std::array<float,2>{0.810804009f, 0.432632357f},
-std::array<float,2>{0.0222761203f, 0.453771144f},
-std::array<float,2>{0.526327014f, 0.590652764f},
-std::array<float,2>{0.489643276f, 0.765539408f},
-std::array<float,2>{0.935664594f, 0.00353880017f},
-std::array<float,2>{0.252851665f, 0.169358969f},
-std::array<float,2>{0.817554951f, 0.897642314f},
-std::array<float,2>{0.225733772f, 0.658658862f},
-std::array<float,2>{0.725194275f, 0.340109944f},
-std::array<float,2>{0.329558372f, 0.395765632f},
-std::array<float,2>{0.777170897f, 0.524566829f},
-std::array<float,2>{0.127551928f, 0.838059962f},
-std::array<float,2>{0.636925519f, 0.0983477682f},
-std::array<float,2>{0.117537305f, 0.245838359f},
-std::array<float,2>{0.584754884f, 0.974699616f},
-std::array<float,2>{0.436160624f, 0.728825271f},
-std::array<float,2>{0.964818299f, 0.306850314f},
-std::array<float,2>{0.188508987f, 0.350238591f},
-std::array<float,2>{0.716753185f, 0.625654101f},
-std::array<float,2>{0.28980878f, 0.918517113f},
-std::array<float,2>{0.85276109f, 0.130717397f},
-std::array<float,2>{0.458026975f, 0.0451895185f},
-std::array<float,2>{0.885748148f, 0.795169115f},
-std::array<float,2>{0.0577788241f, 0.621367514f},
-std::array<float,2>{0.549854696f, 0.493360281f},
-std::array<float,2>{0.429167897f, 0.422011733f},
-std::array<float,2>{0.958161294f, 0.550636232f},
-std::array<float,2>{0.113692507f, 0.851071417f},
-std::array<float,2>{0.592892587f, 0.0883427858f},
-std::array<float,2>{0.136051476f, 0.202742442f},
-std::array<float,2>{0.625604808f, 0.961744249f},
-std::array<float,2>{0.337150067f, 0.703378856f},
-std::array<float,2>{0.771554828f, 0.254816204f},
-std::array<float,2>{0.0474382006f, 0.33123666f},
-std::array<float,2>{0.561735988f, 0.668524861f},
-std::array<float,2>{0.46685338f, 0.905275822f},
-std::array<float,2>{0.881108165f, 0.157872498f},
-std::array<float,2>{0.286489695f, 0.0135651287f},
-std::array<float,2>{0.847114861f, 0.756615639f},
-std::array<float,2>{0.202638909f, 0.581974268f},
-std::array<float,2>{0.7081846f, 0.465027392f},
-std::array<float,2>{0.359467775f, 0.297579318f},
-std::array<float,2>{0.801081717f, 0.719218194f},
-std::array<float,2>{0.161044225f, 0.983380735f},
-std::array<float,2>{0.668331206f, 0.241548672f},
-std::array<float,2>{0.0932848081f, 0.106514536f},
-std::array<float,2>{0.601455092f, 0.830872178f},
-std::array<float,2>{0.393216729f, 0.516289055f},
-std::array<float,2>{0.971931577f, 0.405943394f},
-std::array<float,2>{0.232233614f, 0.485962719f},
-std::array<float,2>{0.733543992f, 0.611214161f},
-std::array<float,2>{0.258973688f, 0.786963999f},
-std::array<float,2>{0.820375264f, 0.0374766812f},
-std::array<float,2>{0.4979617f, 0.132862732f},
-std::array<float,2>{0.926292717f, 0.906359315f},
-std::array<float,2>{0.0277733132f, 0.640427709f},
-std::array<float,2>{0.520412207f, 0.354596406f},
-std::array<float,2>{0.4448874f, 0.373307467f},
-std::array<float,2>{0.899971902f, 0.643552721f},
-std::array<float,2>{0.0445758849f, 0.926220417f},
-std::array<float,2>{0.543412149f, 0.14657186f},
-std::array<float,2>{0.217041358f, 0.062214274f},
-std::array<float,2>{0.696756542f, 0.799169183f},
-std::array<float,2>{0.310923517f, 0.607084215f},
-std::array<float,2>{0.861570656f, 0.476610422f},
-std::array<float,2>{0.103499234f, 0.379898548f},
-std::array<float,2>{0.567391634f, 0.504748344f},
-std::array<float,2>{0.412714541f, 0.813507438f},
-std::array<float,2>{0.952888191f, 0.116949193f},
-std::array<float,2>{0.315984964f, 0.227510154f},
-std::array<float,2>{0.759898424f, 0.992280722f},
-std::array<float,2>{0.151176199f, 0.741999388f},
-std::array<float,2>{0.646032751f, 0.294057876f},
-std::array<float,2>{0.277297109f, 0.450508922f},
-std::array<float,2>{0.842185318f, 0.567061484f},
-std::array<float,2>{0.237116292f, 0.770372093f},
-std::array<float,2>{0.737544775f, 0.0230822321f},
-std::array<float,2>{0.00332001457f, 0.184401825f},
-std::array<float,2>{0.510120809f, 0.888061285f},
-std::array<float,2>{0.473643929f, 0.68443042f},
-std::array<float,2>{0.914648831f, 0.315667033f},
-std::array<float,2>{0.184393346f, 0.269942135f},
-std::array<float,2>{0.684819937f, 0.700291276f},
-std::array<float,2>{0.354299754f, 0.938086808f},
-std::array<float,2>{0.785095632f, 0.209296241f},
-std::array<float,2>{0.388157666f, 0.0638910085f},
-std::array<float,2>{0.989146411f, 0.862063646f},
-std::array<float,2>{0.0653698444f, 0.53730768f},
-std::array<float,2>{0.610161126f, 0.406838477f},
-std::array<float,2>{0.463627487f, 0.389621615f},
-std::array<float,2>{0.87577194f, 0.511778295f},
-std::array<float,2>{0.0537830703f, 0.824836791f},
-std::array<float,2>{0.558273375f, 0.123623662f},
-std::array<float,2>{0.196716383f, 0.22151871f},
-std::array<float,2>{0.70501101f, 0.988607049f},
-std::array<float,2>{0.284243107f, 0.743561685f},
-std::array<float,2>{0.848591685f, 0.286809951f},
-std::array<float,2>{0.112360775f, 0.36217615f},
-std::array<float,2>{0.586826801f, 0.650587618f},
-std::array<float,2>{0.424208939f, 0.931193352f},
-std::array<float,2>{0.956263006f, 0.155861259f},
-std::array<float,2>{0.341535091f, 0.0469022393f},
-std::array<float,2>{0.766962051f, 0.810128331f},
-std::array<float,2>{0.137946829f, 0.599830627f},
-std::array<float,2>{0.629433215f, 0.473412961f},
-std::array<float,2>{0.263941199f, 0.274741769f},
-std::array<float,2>{0.825090468f, 0.688415825f},
-std::array<float,2>{0.23029539f, 0.948827147f},
-std::array<float,2>{0.729825318f, 0.216023892f},
-std::array<float,2>{0.0258558076f, 0.0714352503f},
-std::array<float,2>{0.517318308f, 0.869935036f},
-std::array<float,2>{0.495987296f, 0.541892827f},
-std::array<float,2>{0.924526215f, 0.414295286f},
-std::array<float,2>{0.159917474f, 0.43921712f},
-std::array<float,2>{0.665289044f, 0.570529878f},
-std::array<float,2>{0.364407241f, 0.78105706f},
-std::array<float,2>{0.798263431f, 0.0265218392f},
-std::array<float,2>{0.396698952f, 0.175974488f},
-std::array<float,2>{0.973749936f, 0.880670726f},
-std::array<float,2>{0.0874980241f, 0.672404408f},
-std::array<float,2>{0.597566545f, 0.323684335f},
-std::array<float,2>{0.407871157f, 0.339321673f},
-std::array<float,2>{0.945723116f, 0.661204636f},
-std::array<float,2>{0.107915372f, 0.891521037f},
-std::array<float,2>{0.564739406f, 0.165863574f},
-std::array<float,2>{0.153944016f, 0.00406694459f},
-std::array<float,2>{0.641022742f, 0.758484423f},
-std::array<float,2>{0.317987978f, 0.589766979f},
-std::array<float,2>{0.764980853f, 0.457921147f},
-std::array<float,2>{0.0394257344f, 0.436322957f},
-std::array<float,2>{0.540045917f, 0.559808493f},
-std::array<float,2>{0.440775216f, 0.857233703f},
-std::array<float,2>{0.90397352f, 0.0802204907f},
-std::array<float,2>{0.306703031f, 0.190005958f},
-std::array<float,2>{0.866651237f, 0.957448542f},
-std::array<float,2>{0.214643016f, 0.71346271f},
-std::array<float,2>{0.702858448f, 0.261361808f},
-std::array<float,2>{0.357685298f, 0.496685982f},
-std::array<float,2>{0.787109554f, 0.620529175f},
-std::array<float,2>{0.181291997f, 0.790025949f},
-std::array<float,2>{0.681526363f, 0.0394343697f},
-std::array<float,2>{0.0677056834f, 0.125792995f},
-std::array<float,2>{0.613479197f, 0.914465904f},
-std::array<float,2>{0.38460204f, 0.629356682f},
-std::array<float,2>{0.98608458f, 0.345952481f},
-std::array<float,2>{0.240582734f, 0.310807407f},
-std::array<float,2>{0.741535604f, 0.733163238f},
-std::array<float,2>{0.277529955f, 0.969165564f},
-std::array<float,2>{0.837048471f, 0.24956964f},
-std::array<float,2>{0.469206154f, 0.094912082f},
-std::array<float,2>{0.918247223f, 0.841791928f},
-std::array<float,2>{0.00537008699f, 0.528382361f},
-std::array<float,2>{0.51502347f, 0.392154276f},
-std::array<float,2>{0.377534628f, 0.461138874f},
-std::array<float,2>{0.998983026f, 0.585477948f},
-std::array<float,2>{0.0759067833f, 0.753823161f},
-std::array<float,2>{0.618630052f, 0.00885589235f},
-std::array<float,2>{0.174564347f, 0.163362712f},
-std::array<float,2>{0.673729718f, 0.899148345f},
-std::array<float,2>{0.348127872f, 0.664831042f},
-std::array<float,2>{0.792000055f, 0.335256845f},
-std::array<float,2>{0.0114794942f, 0.25234735f},
-std::array<float,2>{0.506708264f, 0.709873974f},
-std::array<float,2>{0.479593575f, 0.967631459f},
-std::array<float,2>{0.907840252f, 0.198812798f},
-std::array<float,2>{0.269846916f, 0.0907514691f},
-std::array<float,2>{0.83550036f, 0.846726537f},
-std::array<float,2>{0.245342404f, 0.553339303f},
-std::array<float,2>{0.746722639f, 0.428476751f},
-std::array<float,2>{0.323430955f, 0.357654631f},
-std::array<float,2>{0.756499469f, 0.636330426f},
-std::array<float,2>{0.147238463f, 0.911783278f},
-std::array<float,2>{0.649565518f, 0.13742049f},
-std::array<float,2>{0.0973992869f, 0.034145955f},
-std::array<float,2>{0.571539342f, 0.781725883f},
-std::array<float,2>{0.416870892f, 0.615712225f},
-std::array<float,2>{0.941683948f, 0.488514036f},
-std::array<float,2>{0.207721651f, 0.398503482f},
-std::array<float,2>{0.689689875f, 0.5230636f},
-std::array<float,2>{0.299090415f, 0.832309902f},
-std::array<float,2>{0.869515657f, 0.10254059f},
-std::array<float,2>{0.452147543f, 0.235534921f},
-std::array<float,2>{0.896432698f, 0.98045373f},
-std::array<float,2>{0.0380448997f, 0.724139035f},
-std::array<float,2>{0.536958635f, 0.301756173f},
-std::array<float,2>{0.487119347f, 0.290175676f},
-std::array<float,2>{0.931090117f, 0.735763729f},
-std::array<float,2>{0.0188237075f, 0.998235583f},
-std::array<float,2>{0.528130889f, 0.233774245f},
-std::array<float,2>{0.218819603f, 0.111409709f},
-std::array<float,2>{0.722168982f, 0.819681406f},
-std::array<float,2>{0.25536114f, 0.50194031f},
-std::array<float,2>{0.813231587f, 0.377072245f},
-std::array<float,2>{0.0834409148f, 0.481267422f},
-std::array<float,2>{0.607353091f, 0.605442584f},
-std::array<float,2>{0.403101265f, 0.803227246f},
-std::array<float,2>{0.984230816f, 0.0548886955f},
-std::array<float,2>{0.3711887f, 0.141136959f},
-std::array<float,2>{0.807413042f, 0.922871113f},
-std::array<float,2>{0.164787531f, 0.647940457f},
-std::array<float,2>{0.660788238f, 0.369283766f},
-std::array<float,2>{0.296121448f, 0.411442429f},
-std::array<float,2>{0.856273532f, 0.531994104f},
-std::array<float,2>{0.193581805f, 0.863366604f},
-std::array<float,2>{0.711676836f, 0.0695443898f},
-std::array<float,2>{0.0621334687f, 0.20458369f},
-std::array<float,2>{0.550924957f, 0.94411248f},
-std::array<float,2>{0.456454366f, 0.696917236f},
-std::array<float,2>{0.887065589f, 0.269314468f},
-std::array<float,2>{0.13013652f, 0.319479406f},
-std::array<float,2>{0.633992612f, 0.681983948f},
-std::array<float,2>{0.333878636f, 0.884549022f},
-std::array<float,2>{0.779444695f, 0.181817442f},
-std::array<float,2>{0.431579649f, 0.0157687496f},
-std::array<float,2>{0.966367245f, 0.768092036f},
-std::array<float,2>{0.121640891f, 0.564055264f},
-std::array<float,2>{0.578370214f, 0.446961671f},
-std::array<float,2>{0.459403813f, 0.492471695f},
-std::array<float,2>{0.88412565f, 0.623005331f},
-std::array<float,2>{0.0557281449f, 0.796068668f},
-std::array<float,2>{0.546979964f, 0.0467676371f},
-std::array<float,2>{0.189944521f, 0.129084498f},
-std::array<float,2>{0.71773082f, 0.919644415f},
-std::array<float,2>{0.291316479f, 0.626764357f},
-std::array<float,2>{0.854508936f, 0.350699693f},
-std::array<float,2>{0.12057656f, 0.30813089f},
-std::array<float,2>{0.582446277f, 0.72973448f},
-std::array<float,2>{0.434007615f, 0.976033747f},
-std::array<float,2>{0.961601257f, 0.244824901f},
-std::array<float,2>{0.330760837f, 0.0993379727f},
-std::array<float,2>{0.775220692f, 0.839090943f},
-std::array<float,2>{0.126039252f, 0.523525476f},
-std::array<float,2>{0.640154898f, 0.39465788f},
-std::array<float,2>{0.250640988f, 0.340939552f},
-std::array<float,2>{0.819300711f, 0.66001761f},
-std::array<float,2>{0.224055395f, 0.896544397f},
-std::array<float,2>{0.72364831f, 0.168632805f},
-std::array<float,2>{0.0202511176f, 0.00237427256f},
-std::array<float,2>{0.524266422f, 0.763970554f},
-std::array<float,2>{0.491142601f, 0.590882838f},
-std::array<float,2>{0.934292018f, 0.454540372f},
-std::array<float,2>{0.168300673f, 0.432138413f},
-std::array<float,2>{0.65942347f, 0.557222843f},
-std::array<float,2>{0.370138347f, 0.853393137f},
-std::array<float,2>{0.8099159f, 0.0824266225f},
-std::array<float,2>{0.400545269f, 0.192308933f},
-std::array<float,2>{0.979070604f, 0.954003394f},
-std::array<float,2>{0.0788940191f, 0.716336608f},
-std::array<float,2>{0.60250181f, 0.264036745f},
-std::array<float,2>{0.419559062f, 0.279353499f},
-std::array<float,2>{0.939066291f, 0.691864192f},
-std::array<float,2>{0.0983028412f, 0.950140893f},
-std::array<float,2>{0.575096726f, 0.212917283f},
-std::array<float,2>{0.14403294f, 0.077986002f},
-std::array<float,2>{0.653476f, 0.871749401f},
-std::array<float,2>{0.3256464f, 0.546380281f},
-std::array<float,2>{0.751371205f, 0.420849293f},
-std::array<float,2>{0.0320626013f, 0.442375332f},
-std::array<float,2>{0.532906592f, 0.575283885f},
-std::array<float,2>{0.447868258f, 0.776262522f},
-std::array<float,2>{0.893608034f, 0.0307384953f},
-std::array<float,2>{0.303900123f, 0.173859894f},
-std::array<float,2>{0.87465179f, 0.878201365f},
-std::array<float,2>{0.205327749f, 0.677042961f},
-std::array<float,2>{0.694219708f, 0.325499117f},
-std::array<float,2>{0.345508218f, 0.386258513f},
-std::array<float,2>{0.794338405f, 0.508369327f},
-std::array<float,2>{0.177899539f, 0.821402252f},
-std::array<float,2>{0.678521454f, 0.120744891f},
-std::array<float,2>{0.0733463317f, 0.226245329f},
-std::array<float,2>{0.62402159f, 0.987664938f},
-std::array<float,2>{0.382788092f, 0.746546447f},
-std::array<float,2>{0.994945824f, 0.28130123f},
-std::array<float,2>{0.246557772f, 0.366367996f},
-std::array<float,2>{0.745751917f, 0.653566599f},
-std::array<float,2>{0.265824229f, 0.934536099f},
-std::array<float,2>{0.83164835f, 0.151318565f},
-std::array<float,2>{0.482670873f, 0.0538932011f},
-std::array<float,2>{0.912044823f, 0.806885421f},
-std::array<float,2>{0.0152517073f, 0.595473826f},
-std::array<float,2>{0.501173139f, 0.472584367f},
-std::array<float,2>{0.389444739f, 0.407856941f},
-std::array<float,2>{0.991307735f, 0.538139522f},
-std::array<float,2>{0.0630898625f, 0.863024116f},
-std::array<float,2>{0.61268127f, 0.0633509979f},
-std::array<float,2>{0.186035916f, 0.210587531f},
-std::array<float,2>{0.686531126f, 0.938532412f},
-std::array<float,2>{0.352696002f, 0.699705899f},
-std::array<float,2>{0.782015026f, 0.270732999f},
-std::array<float,2>{4.59471048e-05f, 0.3146725f},
-std::array<float,2>{0.508586287f, 0.685137868f},
-std::array<float,2>{0.476409316f, 0.88705194f},
-std::array<float,2>{0.916126907f, 0.185198039f},
-std::array<float,2>{0.27379325f, 0.021638738f},
-std::array<float,2>{0.841650128f, 0.771360159f},
-std::array<float,2>{0.235349074f, 0.567555189f},
-std::array<float,2>{0.735817254f, 0.44952181f},
-std::array<float,2>{0.314070821f, 0.293722481f},
-std::array<float,2>{0.758866608f, 0.7404176f},
-std::array<float,2>{0.149135873f, 0.993171334f},
-std::array<float,2>{0.646878242f, 0.22759302f},
-std::array<float,2>{0.104057088f, 0.115521997f},
-std::array<float,2>{0.568478405f, 0.812832952f},
-std::array<float,2>{0.410874426f, 0.505783141f},
-std::array<float,2>{0.950658619f, 0.379139006f},
-std::array<float,2>{0.216619208f, 0.47786361f},
-std::array<float,2>{0.697640121f, 0.605800986f},
-std::array<float,2>{0.310091287f, 0.800295532f},
-std::array<float,2>{0.860515535f, 0.060897857f},
-std::array<float,2>{0.441932023f, 0.147494465f},
-std::array<float,2>{0.902164221f, 0.927623332f},
-std::array<float,2>{0.0468455441f, 0.644459069f},
-std::array<float,2>{0.546167016f, 0.374877006f},
-std::array<float,2>{0.498229951f, 0.353874803f},
-std::array<float,2>{0.928020418f, 0.639056683f},
-std::array<float,2>{0.0299187489f, 0.907852173f},
-std::array<float,2>{0.522667348f, 0.13384302f},
-std::array<float,2>{0.233490482f, 0.0386460088f},
-std::array<float,2>{0.730700254f, 0.785536587f},
-std::array<float,2>{0.261442244f, 0.609461784f},
-std::array<float,2>{0.823708594f, 0.485216528f},
-std::array<float,2>{0.0898997635f, 0.404772788f},
-std::array<float,2>{0.599589169f, 0.517385244f},
-std::array<float,2>{0.390858114f, 0.831630588f},
-std::array<float,2>{0.970466197f, 0.105474904f},
-std::array<float,2>{0.361699462f, 0.240553305f},
-std::array<float,2>{0.804286778f, 0.984076858f},
-std::array<float,2>{0.162512988f, 0.720453262f},
-std::array<float,2>{0.671616673f, 0.298594773f},
-std::array<float,2>{0.288478196f, 0.466606528f},
-std::array<float,2>{0.845075846f, 0.580223978f},
-std::array<float,2>{0.199273005f, 0.757233083f},
-std::array<float,2>{0.709288776f, 0.0125430962f},
-std::array<float,2>{0.0492424294f, 0.156522706f},
-std::array<float,2>{0.560085237f, 0.905126274f},
-std::array<float,2>{0.464999467f, 0.669368625f},
-std::array<float,2>{0.880530715f, 0.331020027f},
-std::array<float,2>{0.13469857f, 0.25574711f},
-std::array<float,2>{0.628264129f, 0.704241574f},
-std::array<float,2>{0.338736534f, 0.962488592f},
-std::array<float,2>{0.770331144f, 0.201547161f},
-std::array<float,2>{0.426127255f, 0.0898086205f},
-std::array<float,2>{0.960740447f, 0.849819303f},
-std::array<float,2>{0.116226636f, 0.549499094f},
-std::array<float,2>{0.590544283f, 0.423796833f},
-std::array<float,2>{0.472312033f, 0.39112094f},
-std::array<float,2>{0.921778858f, 0.527817011f},
-std::array<float,2>{0.00775338663f, 0.840488791f},
-std::array<float,2>{0.512967944f, 0.0943610668f},
-std::array<float,2>{0.238994673f, 0.248814985f},
-std::array<float,2>{0.738474727f, 0.970160663f},
-std::array<float,2>{0.279881597f, 0.733610332f},
-std::array<float,2>{0.839356244f, 0.312350512f},
-std::array<float,2>{0.0683665946f, 0.347516567f},
-std::array<float,2>{0.616148174f, 0.630725503f},
-std::array<float,2>{0.384870976f, 0.915520668f},
-std::array<float,2>{0.987989604f, 0.126293823f},
-std::array<float,2>{0.356380492f, 0.0401868187f},
-std::array<float,2>{0.786630392f, 0.790210068f},
-std::array<float,2>{0.182900354f, 0.619961202f},
-std::array<float,2>{0.683091879f, 0.49755159f},
-std::array<float,2>{0.305280179f, 0.260335624f},
-std::array<float,2>{0.863525808f, 0.713996828f},
-std::array<float,2>{0.21230185f, 0.95888257f},
-std::array<float,2>{0.699969113f, 0.191148594f},
-std::array<float,2>{0.0424522273f, 0.0818092227f},
-std::array<float,2>{0.542107403f, 0.855743408f},
-std::array<float,2>{0.437644005f, 0.558828235f},
-std::array<float,2>{0.905649602f, 0.436622888f},
-std::array<float,2>{0.155931428f, 0.458662629f},
-std::array<float,2>{0.642753422f, 0.588436782f},
-std::array<float,2>{0.318958521f, 0.759310305f},
-std::array<float,2>{0.762902737f, 0.00506689074f},
-std::array<float,2>{0.4095999f, 0.164950818f},
-std::array<float,2>{0.948787451f, 0.892323136f},
-std::array<float,2>{0.105578825f, 0.660807431f},
-std::array<float,2>{0.564403594f, 0.337992191f},
-std::array<float,2>{0.395947069f, 0.322640717f},
-std::array<float,2>{0.975161612f, 0.673543751f},
-std::array<float,2>{0.0897416845f, 0.879735827f},
-std::array<float,2>{0.595588744f, 0.17709969f},
-std::array<float,2>{0.157896221f, 0.0255217645f},
-std::array<float,2>{0.666025341f, 0.780017674f},
-std::array<float,2>{0.366395682f, 0.572159111f},
-std::array<float,2>{0.800224066f, 0.437705487f},
-std::array<float,2>{0.0238200463f, 0.415413737f},
-std::array<float,2>{0.518642962f, 0.542400956f},
-std::array<float,2>{0.493347496f, 0.870340288f},
-std::array<float,2>{0.923733234f, 0.0705162585f},
-std::array<float,2>{0.261842132f, 0.214963242f},
-std::array<float,2>{0.82708621f, 0.94810915f},
-std::array<float,2>{0.228484124f, 0.688883543f},
-std::array<float,2>{0.727473438f, 0.273506522f},
-std::array<float,2>{0.343475401f, 0.473860174f},
-std::array<float,2>{0.768255591f, 0.600616693f},
-std::array<float,2>{0.139061883f, 0.809103608f},
-std::array<float,2>{0.631413281f, 0.0484284312f},
-std::array<float,2>{0.109983504f, 0.154521137f},
-std::array<float,2>{0.588021815f, 0.929755092f},
-std::array<float,2>{0.422645479f, 0.652303755f},
-std::array<float,2>{0.954148531f, 0.362394989f},
-std::array<float,2>{0.198634177f, 0.286014855f},
-std::array<float,2>{0.705588043f, 0.742368042f},
-std::array<float,2>{0.283131182f, 0.989978909f},
-std::array<float,2>{0.84962374f, 0.221927494f},
-std::array<float,2>{0.462453365f, 0.124472663f},
-std::array<float,2>{0.877801836f, 0.82553637f},
-std::array<float,2>{0.0513782427f, 0.512826324f},
-std::array<float,2>{0.555489123f, 0.39023909f},
-std::array<float,2>{0.432778597f, 0.445843995f},
-std::array<float,2>{0.968568504f, 0.562949955f},
-std::array<float,2>{0.124109909f, 0.769233823f},
-std::array<float,2>{0.581551909f, 0.0171989165f},
-std::array<float,2>{0.130930945f, 0.183579817f},
-std::array<float,2>{0.635294497f, 0.883543551f},
-std::array<float,2>{0.335640043f, 0.68359077f},
-std::array<float,2>{0.777525902f, 0.318529844f},
-std::array<float,2>{0.0592835769f, 0.26823768f},
-std::array<float,2>{0.554175556f, 0.695647955f},
-std::array<float,2>{0.453547806f, 0.944778681f},
-std::array<float,2>{0.889898598f, 0.203238159f},
-std::array<float,2>{0.293255806f, 0.069258675f},
-std::array<float,2>{0.858500838f, 0.864558339f},
-std::array<float,2>{0.191427663f, 0.532491326f},
-std::array<float,2>{0.713552654f, 0.410852909f},
-std::array<float,2>{0.374744385f, 0.370412201f},
-std::array<float,2>{0.805446684f, 0.646771967f},
-std::array<float,2>{0.16616708f, 0.922430873f},
-std::array<float,2>{0.662396014f, 0.142241791f},
-std::array<float,2>{0.0842878819f, 0.0559205115f},
-std::array<float,2>{0.607581437f, 0.804339051f},
-std::array<float,2>{0.406100929f, 0.603630483f},
-std::array<float,2>{0.981455028f, 0.481940866f},
-std::array<float,2>{0.221570596f, 0.378650695f},
-std::array<float,2>{0.720316648f, 0.500894666f},
-std::array<float,2>{0.256967276f, 0.818736434f},
-std::array<float,2>{0.816001773f, 0.112687916f},
-std::array<float,2>{0.484465748f, 0.232638091f},
-std::array<float,2>{0.93252784f, 0.999736786f},
-std::array<float,2>{0.0156383589f, 0.73458904f},
-std::array<float,2>{0.531094432f, 0.289735168f},
-std::array<float,2>{0.45060581f, 0.302665532f},
-std::array<float,2>{0.897290409f, 0.723354936f},
-std::array<float,2>{0.0370276012f, 0.978590548f},
-std::array<float,2>{0.537303805f, 0.234766349f},
-std::array<float,2>{0.209969431f, 0.102097064f},
-std::array<float,2>{0.688933849f, 0.833103299f},
-std::array<float,2>{0.297781199f, 0.521605611f},
-std::array<float,2>{0.868551672f, 0.400024563f},
-std::array<float,2>{0.0938518718f, 0.489369065f},
-std::array<float,2>{0.573137641f, 0.616277397f},
-std::array<float,2>{0.414464027f, 0.782274902f},
-std::array<float,2>{0.945053041f, 0.0347517356f},
-std::array<float,2>{0.321621954f, 0.137719661f},
-std::array<float,2>{0.755238652f, 0.910200715f},
-std::array<float,2>{0.146178424f, 0.634978175f},
-std::array<float,2>{0.651983619f, 0.359362841f},
-std::array<float,2>{0.272030532f, 0.429162711f},
-std::array<float,2>{0.833153129f, 0.554070115f},
-std::array<float,2>{0.242525086f, 0.846301913f},
-std::array<float,2>{0.748476565f, 0.0912275389f},
-std::array<float,2>{0.00805118214f, 0.197406873f},
-std::array<float,2>{0.504378736f, 0.968615592f},
-std::array<float,2>{0.478290915f, 0.710126877f},
-std::array<float,2>{0.91004914f, 0.253647536f},
-std::array<float,2>{0.173516095f, 0.334492415f},
-std::array<float,2>{0.674062967f, 0.665943444f},
-std::array<float,2>{0.350617677f, 0.899549901f},
-std::array<float,2>{0.789307117f, 0.162144169f},
-std::array<float,2>{0.376570791f, 0.00860380754f},
-std::array<float,2>{0.997613966f, 0.752824306f},
-std::array<float,2>{0.0764363259f, 0.584391713f},
-std::array<float,2>{0.620212317f, 0.462269664f},
-std::array<float,2>{0.489253432f, 0.456103414f},
-std::array<float,2>{0.93714422f, 0.592431724f},
-std::array<float,2>{0.0226724893f, 0.763419211f},
-std::array<float,2>{0.527204752f, 0.0012397744f},
-std::array<float,2>{0.225514635f, 0.170467079f},
-std::array<float,2>{0.726433337f, 0.895570278f},
-std::array<float,2>{0.253869563f, 0.657196522f},
-std::array<float,2>{0.816566586f, 0.342755347f},
-std::array<float,2>{0.0812003314f, 0.26363337f},
-std::array<float,2>{0.604902923f, 0.718123794f},
-std::array<float,2>{0.400324285f, 0.956622839f},
-std::array<float,2>{0.976784468f, 0.194393605f},
-std::array<float,2>{0.367318392f, 0.0852277726f},
-std::array<float,2>{0.812189639f, 0.853791296f},
-std::array<float,2>{0.170512378f, 0.556538761f},
-std::array<float,2>{0.658073545f, 0.430450052f},
-std::array<float,2>{0.290254325f, 0.34822005f},
-std::array<float,2>{0.851637602f, 0.627874136f},
-std::array<float,2>{0.187994182f, 0.921233892f},
-std::array<float,2>{0.715509355f, 0.132019401f},
-std::array<float,2>{0.0572357625f, 0.0430410504f},
-std::array<float,2>{0.54946214f, 0.793544829f},
-std::array<float,2>{0.457099587f, 0.623110294f},
-std::array<float,2>{0.884884834f, 0.494211018f},
-std::array<float,2>{0.128277853f, 0.397984475f},
-std::array<float,2>{0.637817025f, 0.526584923f},
-std::array<float,2>{0.328955203f, 0.836818874f},
-std::array<float,2>{0.776218951f, 0.10025268f},
-std::array<float,2>{0.436849326f, 0.242338225f},
-std::array<float,2>{0.9630602f, 0.974553108f},
-std::array<float,2>{0.11882247f, 0.728071928f},
-std::array<float,2>{0.585612178f, 0.305563956f},
-std::array<float,2>{0.380220264f, 0.284077644f},
-std::array<float,2>{0.993922949f, 0.749114811f},
-std::array<float,2>{0.0720576271f, 0.9852283f},
-std::array<float,2>{0.622389793f, 0.223922461f},
-std::array<float,2>{0.176684007f, 0.117352471f},
-std::array<float,2>{0.677703559f, 0.824176073f},
-std::array<float,2>{0.346621156f, 0.511181056f},
-std::array<float,2>{0.79568702f, 0.383018434f},
-std::array<float,2>{0.012610279f, 0.469023764f},
-std::array<float,2>{0.501997113f, 0.597266197f},
-std::array<float,2>{0.48149398f, 0.806249857f},
-std::array<float,2>{0.912253678f, 0.0518006235f},
-std::array<float,2>{0.267708063f, 0.148786306f},
-std::array<float,2>{0.828969002f, 0.937443376f},
-std::array<float,2>{0.249689117f, 0.654560626f},
-std::array<float,2>{0.742506683f, 0.364279985f},
-std::array<float,2>{0.327830255f, 0.41977933f},
-std::array<float,2>{0.752498507f, 0.544270277f},
-std::array<float,2>{0.140691325f, 0.873923659f},
-std::array<float,2>{0.655940354f, 0.0742630139f},
-std::array<float,2>{0.10034848f, 0.211581811f},
-std::array<float,2>{0.576401293f, 0.952354968f},
-std::array<float,2>{0.421772689f, 0.693658352f},
-std::array<float,2>{0.940340936f, 0.277782083f},
-std::array<float,2>{0.204745695f, 0.326220393f},
-std::array<float,2>{0.692132652f, 0.678420663f},
-std::array<float,2>{0.300817251f, 0.876526475f},
-std::array<float,2>{0.872814238f, 0.172691181f},
-std::array<float,2>{0.447019517f, 0.0289077852f},
-std::array<float,2>{0.892377734f, 0.774734259f},
-std::array<float,2>{0.0348214172f, 0.57791537f},
-std::array<float,2>{0.533765197f, 0.443728954f},
-std::array<float,2>{0.413654715f, 0.381248325f},
-std::array<float,2>{0.951755822f, 0.507627845f},
-std::array<float,2>{0.10216473f, 0.815839708f},
-std::array<float,2>{0.567275882f, 0.115190357f},
-std::array<float,2>{0.151916116f, 0.230330944f},
-std::array<float,2>{0.644719183f, 0.995494723f},
-std::array<float,2>{0.314727575f, 0.73895216f},
-std::array<float,2>{0.760980785f, 0.295051008f},
-std::array<float,2>{0.043210607f, 0.372699738f},
-std::array<float,2>{0.544660866f, 0.642135322f},
-std::array<float,2>{0.443375736f, 0.92871803f},
-std::array<float,2>{0.898928165f, 0.146295443f},
-std::array<float,2>{0.312089801f, 0.059369348f},
-std::array<float,2>{0.862982035f, 0.797073781f},
-std::array<float,2>{0.217874423f, 0.608684897f},
-std::array<float,2>{0.696268857f, 0.478852302f},
-std::array<float,2>{0.355075717f, 0.27214542f},
-std::array<float,2>{0.783772707f, 0.701560736f},
-std::array<float,2>{0.185533598f, 0.94138974f},
-std::array<float,2>{0.683708072f, 0.208057836f},
-std::array<float,2>{0.0662977472f, 0.065977864f},
-std::array<float,2>{0.6110906f, 0.859708369f},
-std::array<float,2>{0.3873716f, 0.536863804f},
-std::array<float,2>{0.989333153f, 0.408919245f},
-std::array<float,2>{0.237642974f, 0.451518267f},
-std::array<float,2>{0.737005174f, 0.569047511f},
-std::array<float,2>{0.276012182f, 0.772126913f},
-std::array<float,2>{0.842802167f, 0.0211696625f},
-std::array<float,2>{0.473558784f, 0.1872641f},
-std::array<float,2>{0.915761709f, 0.889125824f},
-std::array<float,2>{0.00219839043f, 0.685975015f},
-std::array<float,2>{0.511242151f, 0.314220876f},
-std::array<float,2>{0.468173563f, 0.328746229f},
-std::array<float,2>{0.881858289f, 0.670114994f},
-std::array<float,2>{0.0487326384f, 0.904213548f},
-std::array<float,2>{0.560588062f, 0.159389958f},
-std::array<float,2>{0.201725513f, 0.014680176f},
-std::array<float,2>{0.707404256f, 0.753933787f},
-std::array<float,2>{0.285579145f, 0.578981757f},
-std::array<float,2>{0.846026421f, 0.467556328f},
-std::array<float,2>{0.115133673f, 0.42406857f},
-std::array<float,2>{0.59184581f, 0.547481477f},
-std::array<float,2>{0.428086907f, 0.84826827f},
-std::array<float,2>{0.957144916f, 0.086769715f},
-std::array<float,2>{0.335960388f, 0.200051561f},
-std::array<float,2>{0.773193061f, 0.963390887f},
-std::array<float,2>{0.135211408f, 0.705703318f},
-std::array<float,2>{0.626291692f, 0.257437915f},
-std::array<float,2>{0.258368284f, 0.487340301f},
-std::array<float,2>{0.821450591f, 0.611352324f},
-std::array<float,2>{0.230825469f, 0.788147807f},
-std::array<float,2>{0.73254472f, 0.0355378166f},
-std::array<float,2>{0.0291302558f, 0.135354176f},
-std::array<float,2>{0.520934999f, 0.909408689f},
-std::array<float,2>{0.496735662f, 0.638442159f},
-std::array<float,2>{0.927510083f, 0.353328109f},
-std::array<float,2>{0.162092552f, 0.300630301f},
-std::array<float,2>{0.669716001f, 0.721256614f},
-std::array<float,2>{0.361222893f, 0.981497109f},
-std::array<float,2>{0.802082539f, 0.238449335f},
-std::array<float,2>{0.393555582f, 0.10920357f},
-std::array<float,2>{0.971489489f, 0.829099059f},
-std::array<float,2>{0.0926672071f, 0.518820941f},
-std::array<float,2>{0.599804759f, 0.403098106f},
-std::array<float,2>{0.439571857f, 0.435122132f},
-std::array<float,2>{0.902832031f, 0.561154783f},
-std::array<float,2>{0.0408637784f, 0.857711375f},
-std::array<float,2>{0.539835691f, 0.0796507224f},
-std::array<float,2>{0.213086188f, 0.1884408f},
-std::array<float,2>{0.701524436f, 0.959230423f},
-std::array<float,2>{0.307816565f, 0.710942328f},
-std::array<float,2>{0.865997672f, 0.25941053f},
-std::array<float,2>{0.10879495f, 0.337361276f},
-std::array<float,2>{0.56602031f, 0.662292719f},
-std::array<float,2>{0.407029212f, 0.892718792f},
-std::array<float,2>{0.947039902f, 0.166224018f},
-std::array<float,2>{0.317287952f, 0.00605694018f},
-std::array<float,2>{0.763710082f, 0.760454774f},
-std::array<float,2>{0.152466103f, 0.586880147f},
-std::array<float,2>{0.641794324f, 0.45945853f},
-std::array<float,2>{0.279180914f, 0.310308218f},
-std::array<float,2>{0.836525559f, 0.73153019f},
-std::array<float,2>{0.241264001f, 0.970863998f},
-std::array<float,2>{0.740274966f, 0.247568473f},
-std::array<float,2>{0.00396433938f, 0.0958313495f},
-std::array<float,2>{0.514255702f, 0.843259513f},
-std::array<float,2>{0.470279455f, 0.530092955f},
-std::array<float,2>{0.919492483f, 0.394360006f},
-std::array<float,2>{0.180325493f, 0.499821305f},
-std::array<float,2>{0.68055135f, 0.617846966f},
-std::array<float,2>{0.359080374f, 0.792115211f},
-std::array<float,2>{0.788853705f, 0.0418468267f},
-std::array<float,2>{0.383286089f, 0.12794736f},
-std::array<float,2>{0.985309899f, 0.916630507f},
-std::array<float,2>{0.0664986372f, 0.63191998f},
-std::array<float,2>{0.614515185f, 0.343870133f},
-std::array<float,2>{0.424995691f, 0.361117601f},
-std::array<float,2>{0.955285192f, 0.650177658f},
-std::array<float,2>{0.112126775f, 0.932726502f},
-std::array<float,2>{0.586986303f, 0.152757838f},
-std::array<float,2>{0.136898965f, 0.0501706004f},
-std::array<float,2>{0.630100191f, 0.81106621f},
-std::array<float,2>{0.340373427f, 0.598460734f},
-std::array<float,2>{0.76572156f, 0.47578603f},
-std::array<float,2>{0.0533711053f, 0.388463914f},
-std::array<float,2>{0.556947827f, 0.513783395f},
-std::array<float,2>{0.464769125f, 0.827173591f},
-std::array<float,2>{0.876670301f, 0.122393362f},
-std::array<float,2>{0.284127235f, 0.219107673f},
-std::array<float,2>{0.84863615f, 0.991611719f},
-std::array<float,2>{0.195606351f, 0.745712161f},
-std::array<float,2>{0.703424692f, 0.289056748f},
-std::array<float,2>{0.364234895f, 0.439484686f},
-std::array<float,2>{0.797772408f, 0.573688149f},
-std::array<float,2>{0.158488438f, 0.778576076f},
-std::array<float,2>{0.664844871f, 0.024770949f},
-std::array<float,2>{0.086174421f, 0.17838268f},
-std::array<float,2>{0.596000075f, 0.881090224f},
-std::array<float,2>{0.398128211f, 0.673898697f},
-std::array<float,2>{0.972886205f, 0.322242081f},
-std::array<float,2>{0.228795856f, 0.276782721f},
-std::array<float,2>{0.728884637f, 0.690009832f},
-std::array<float,2>{0.265116274f, 0.947079718f},
-std::array<float,2>{0.825936198f, 0.21850878f},
-std::array<float,2>{0.494151235f, 0.0727571025f},
-std::array<float,2>{0.925689518f, 0.869065344f},
-std::array<float,2>{0.0269911513f, 0.540674627f},
-std::array<float,2>{0.515645802f, 0.416805685f},
-std::array<float,2>{0.403899163f, 0.483657509f},
-std::array<float,2>{0.982860148f, 0.601715803f},
-std::array<float,2>{0.0823134705f, 0.802328229f},
-std::array<float,2>{0.605492592f, 0.0576624312f},
-std::array<float,2>{0.165787265f, 0.143486604f},
-std::array<float,2>{0.661724448f, 0.925679624f},
-std::array<float,2>{0.372164041f, 0.645498216f},
-std::array<float,2>{0.808562517f, 0.368854821f},
-std::array<float,2>{0.0179883111f, 0.291771591f},
-std::array<float,2>{0.528579772f, 0.738250613f},
-std::array<float,2>{0.487440556f, 0.997250021f},
-std::array<float,2>{0.929702163f, 0.230853751f},
-std::array<float,2>{0.254170567f, 0.111141287f},
-std::array<float,2>{0.813798785f, 0.817081332f},
-std::array<float,2>{0.220276088f, 0.50390321f},
-std::array<float,2>{0.721394837f, 0.376487583f},
-std::array<float,2>{0.332075179f, 0.317211151f},
-std::array<float,2>{0.780452669f, 0.680842638f},
-std::array<float,2>{0.129386336f, 0.885725141f},
-std::array<float,2>{0.633321464f, 0.180768654f},
-std::array<float,2>{0.122105464f, 0.0184680372f},
-std::array<float,2>{0.579770148f, 0.765991747f},
-std::array<float,2>{0.430170238f, 0.564680755f},
-std::array<float,2>{0.964921713f, 0.448145419f},
-std::array<float,2>{0.194755375f, 0.412145674f},
-std::array<float,2>{0.712302804f, 0.534668028f},
-std::array<float,2>{0.295768976f, 0.865520597f},
-std::array<float,2>{0.857086837f, 0.0683268085f},
-std::array<float,2>{0.455473721f, 0.205734134f},
-std::array<float,2>{0.887722433f, 0.941516459f},
-std::array<float,2>{0.0610521436f, 0.699067771f},
-std::array<float,2>{0.552550197f, 0.267010659f},
-std::array<float,2>{0.479410291f, 0.250247002f},
-std::array<float,2>{0.90658319f, 0.708257973f},
-std::array<float,2>{0.0104444176f, 0.966013074f},
-std::array<float,2>{0.507301629f, 0.196477294f},
-std::array<float,2>{0.244415969f, 0.0922765061f},
-std::array<float,2>{0.747372031f, 0.845422328f},
-std::array<float,2>{0.271076053f, 0.551607788f},
-std::array<float,2>{0.834017098f, 0.426265091f},
-std::array<float,2>{0.0745809451f, 0.462944061f},
-std::array<float,2>{0.61813575f, 0.583426058f},
-std::array<float,2>{0.378484398f, 0.75094986f},
-std::array<float,2>{0.999950171f, 0.0110481707f},
-std::array<float,2>{0.348884493f, 0.161566257f},
-std::array<float,2>{0.791264832f, 0.900685906f},
-std::array<float,2>{0.174834654f, 0.666220844f},
-std::array<float,2>{0.672229171f, 0.332891792f},
-std::array<float,2>{0.300572991f, 0.4004637f},
-std::array<float,2>{0.870611072f, 0.520917475f},
-std::array<float,2>{0.208303958f, 0.835763454f},
-std::array<float,2>{0.691082597f, 0.104370967f},
-std::array<float,2>{0.0382378139f, 0.236926913f},
-std::array<float,2>{0.535604179f, 0.977463782f},
-std::array<float,2>{0.452520967f, 0.725122452f},
-std::array<float,2>{0.895471573f, 0.30328998f},
-std::array<float,2>{0.148142725f, 0.356764734f},
-std::array<float,2>{0.648475409f, 0.634047747f},
-std::array<float,2>{0.322853088f, 0.913228631f},
-std::array<float,2>{0.757402718f, 0.138789728f},
-std::array<float,2>{0.41704303f, 0.0326926894f},
-std::array<float,2>{0.94321543f, 0.784361005f},
-std::array<float,2>{0.0962627456f, 0.614316881f},
-std::array<float,2>{0.571265996f, 0.49065572f},
-std::array<float,2>{0.465359479f, 0.466913968f},
-std::array<float,2>{0.880014181f, 0.578561604f},
-std::array<float,2>{0.0496275835f, 0.75455147f},
-std::array<float,2>{0.559844732f, 0.0152286999f},
-std::array<float,2>{0.199764565f, 0.16008158f},
-std::array<float,2>{0.709528029f, 0.903584838f},
-std::array<float,2>{0.288906485f, 0.670834661f},
-std::array<float,2>{0.84538573f, 0.328412086f},
-std::array<float,2>{0.117100552f, 0.257277995f},
-std::array<float,2>{0.589913011f, 0.705467522f},
-std::array<float,2>{0.426656872f, 0.963142633f},
-std::array<float,2>{0.960428596f, 0.199366778f},
-std::array<float,2>{0.338329673f, 0.0859987512f},
-std::array<float,2>{0.769975305f, 0.848137558f},
-std::array<float,2>{0.134126648f, 0.547252178f},
-std::array<float,2>{0.62872529f, 0.424322724f},
-std::array<float,2>{0.261122674f, 0.352963984f},
-std::array<float,2>{0.824189126f, 0.637844205f},
-std::array<float,2>{0.233967096f, 0.910067618f},
-std::array<float,2>{0.731070876f, 0.134838626f},
-std::array<float,2>{0.029507162f, 0.0356599279f},
-std::array<float,2>{0.523338675f, 0.788817465f},
-std::array<float,2>{0.498535782f, 0.612213671f},
-std::array<float,2>{0.928476393f, 0.488166779f},
-std::array<float,2>{0.162673965f, 0.402799457f},
-std::array<float,2>{0.670938969f, 0.519216597f},
-std::array<float,2>{0.362023443f, 0.82837379f},
-std::array<float,2>{0.803824484f, 0.108595155f},
-std::array<float,2>{0.39117837f, 0.238825813f},
-std::array<float,2>{0.969761848f, 0.982194781f},
-std::array<float,2>{0.0903933272f, 0.720870733f},
-std::array<float,2>{0.599088371f, 0.299842626f},
-std::array<float,2>{0.410358369f, 0.295729905f},
-std::array<float,2>{0.951137066f, 0.738740861f},
-std::array<float,2>{0.10381265f, 0.995769739f},
-std::array<float,2>{0.569138765f, 0.229915857f},
-std::array<float,2>{0.148550138f, 0.114603899f},
-std::array<float,2>{0.647250593f, 0.816248298f},
-std::array<float,2>{0.313752353f, 0.507094741f},
-std::array<float,2>{0.759568095f, 0.381757051f},
-std::array<float,2>{0.0461117849f, 0.47936824f},
-std::array<float,2>{0.546556354f, 0.609135032f},
-std::array<float,2>{0.441427916f, 0.797408164f},
-std::array<float,2>{0.901754916f, 0.0587560982f},
-std::array<float,2>{0.309807003f, 0.145755321f},
-std::array<float,2>{0.861106217f, 0.929308832f},
-std::array<float,2>{0.216143593f, 0.642006278f},
-std::array<float,2>{0.698125541f, 0.372231662f},
-std::array<float,2>{0.353479683f, 0.40866673f},
-std::array<float,2>{0.781384826f, 0.536553204f},
-std::array<float,2>{0.185902864f, 0.860334933f},
-std::array<float,2>{0.687076867f, 0.0657975525f},
-std::array<float,2>{0.0625962093f, 0.208908781f},
-std::array<float,2>{0.613212287f, 0.940746605f},
-std::array<float,2>{0.388802886f, 0.701711595f},
-std::array<float,2>{0.992165029f, 0.271584511f},
-std::array<float,2>{0.234386504f, 0.313578278f},
-std::array<float,2>{0.735887527f, 0.686274886f},
-std::array<float,2>{0.274332374f, 0.889405727f},
-std::array<float,2>{0.84125191f, 0.18694073f},
-std::array<float,2>{0.475651443f, 0.0206694789f},
-std::array<float,2>{0.91674155f, 0.771912038f},
-std::array<float,2>{0.000527583237f, 0.568606675f},
-std::array<float,2>{0.507907748f, 0.451704532f},
-std::array<float,2>{0.381987423f, 0.383603752f},
-std::array<float,2>{0.994536042f, 0.511379182f},
-std::array<float,2>{0.0740466565f, 0.823514402f},
-std::array<float,2>{0.623276174f, 0.117829509f},
-std::array<float,2>{0.178631261f, 0.224185437f},
-std::array<float,2>{0.678094923f, 0.984683454f},
-std::array<float,2>{0.345060438f, 0.749826014f},
-std::array<float,2>{0.794701397f, 0.283459187f},
-std::array<float,2>{0.0146825658f, 0.36479947f},
-std::array<float,2>{0.501835883f, 0.655021429f},
-std::array<float,2>{0.483359605f, 0.936914146f},
-std::array<float,2>{0.911512196f, 0.149169251f},
-std::array<float,2>{0.266445935f, 0.0524359569f},
-std::array<float,2>{0.831217289f, 0.80602479f},
-std::array<float,2>{0.24662663f, 0.596707165f},
-std::array<float,2>{0.745378256f, 0.469524354f},
-std::array<float,2>{0.326043874f, 0.277979165f},
-std::array<float,2>{0.751546264f, 0.694142044f},
-std::array<float,2>{0.144204393f, 0.952836931f},
-std::array<float,2>{0.65381974f, 0.21125409f},
-std::array<float,2>{0.0980431363f, 0.0750822574f},
-std::array<float,2>{0.574358642f, 0.87346518f},
-std::array<float,2>{0.419147342f, 0.54450357f},
-std::array<float,2>{0.938593388f, 0.419014066f},
-std::array<float,2>{0.205932423f, 0.44411397f},
-std::array<float,2>{0.693602502f, 0.577354193f},
-std::array<float,2>{0.304245204f, 0.775353193f},
-std::array<float,2>{0.874057829f, 0.0287298486f},
-std::array<float,2>{0.447435886f, 0.171903506f},
-std::array<float,2>{0.894361258f, 0.876258075f},
-std::array<float,2>{0.0315555632f, 0.678066313f},
-std::array<float,2>{0.532351255f, 0.32684496f},
-std::array<float,2>{0.490573466f, 0.341841906f},
-std::array<float,2>{0.934052587f, 0.6564098f},
-std::array<float,2>{0.0197995584f, 0.896037519f},
-std::array<float,2>{0.52368784f, 0.170021594f},
-std::array<float,2>{0.224589065f, 0.00166368857f},
-std::array<float,2>{0.724432111f, 0.763131976f},
-std::array<float,2>{0.250087023f, 0.592178285f},
-std::array<float,2>{0.818755507f, 0.456808984f},
-std::array<float,2>{0.078559339f, 0.429828405f},
-std::array<float,2>{0.601591825f, 0.555969536f},
-std::array<float,2>{0.401133418f, 0.854278266f},
-std::array<float,2>{0.978821576f, 0.0857029706f},
-std::array<float,2>{0.370852798f, 0.194848731f},
-std::array<float,2>{0.810462594f, 0.956438959f},
-std::array<float,2>{0.168675676f, 0.718647122f},
-std::array<float,2>{0.659697831f, 0.262979537f},
-std::array<float,2>{0.291807801f, 0.494925916f},
-std::array<float,2>{0.855151057f, 0.623847485f},
-std::array<float,2>{0.189513877f, 0.793242931f},
-std::array<float,2>{0.716962993f, 0.0438287482f},
-std::array<float,2>{0.0565972179f, 0.132658511f},
-std::array<float,2>{0.547595978f, 0.921489179f},
-std::array<float,2>{0.459782243f, 0.627118528f},
-std::array<float,2>{0.884471238f, 0.348120779f},
-std::array<float,2>{0.126567304f, 0.304831177f},
-std::array<float,2>{0.639812946f, 0.727848709f},
-std::array<float,2>{0.330520391f, 0.973913729f},
-std::array<float,2>{0.774514616f, 0.242964655f},
-std::array<float,2>{0.434240013f, 0.0998699069f},
-std::array<float,2>{0.961000323f, 0.836110234f},
-std::array<float,2>{0.120986782f, 0.527164161f},
-std::array<float,2>{0.582567632f, 0.397873461f},
-std::array<float,2>{0.477973282f, 0.426639527f},
-std::array<float,2>{0.909253716f, 0.551211238f},
-std::array<float,2>{0.00859581213f, 0.844917953f},
-std::array<float,2>{0.504742503f, 0.0925295725f},
-std::array<float,2>{0.243131936f, 0.19693625f},
-std::array<float,2>{0.748900771f, 0.966758788f},
-std::array<float,2>{0.271603137f, 0.708500326f},
-std::array<float,2>{0.833803713f, 0.25049895f},
-std::array<float,2>{0.076890707f, 0.332449377f},
-std::array<float,2>{0.620857537f, 0.666825175f},
-std::array<float,2>{0.376025736f, 0.900967896f},
-std::array<float,2>{0.997419298f, 0.161736891f},
-std::array<float,2>{0.351518929f, 0.0113343662f},
-std::array<float,2>{0.78970927f, 0.750424743f},
-std::array<float,2>{0.172946766f, 0.58356899f},
-std::array<float,2>{0.674336851f, 0.463726997f},
-std::array<float,2>{0.296944648f, 0.302972436f},
-std::array<float,2>{0.86890918f, 0.725061595f},
-std::array<float,2>{0.210517913f, 0.976779819f},
-std::array<float,2>{0.689273119f, 0.236458823f},
-std::array<float,2>{0.0366114154f, 0.103576355f},
-std::array<float,2>{0.537700415f, 0.835182786f},
-std::array<float,2>{0.451151907f, 0.521435082f},
-std::array<float,2>{0.896710515f, 0.400923103f},
-std::array<float,2>{0.145865753f, 0.490799606f},
-std::array<float,2>{0.6513834f, 0.615003407f},
-std::array<float,2>{0.321780533f, 0.785146892f},
-std::array<float,2>{0.755506396f, 0.0329251774f},
-std::array<float,2>{0.414634764f, 0.139257267f},
-std::array<float,2>{0.944552541f, 0.913601339f},
-std::array<float,2>{0.0944169015f, 0.634308398f},
-std::array<float,2>{0.572553098f, 0.357132643f},
-std::array<float,2>{0.405623913f, 0.368643969f},
-std::array<float,2>{0.982016265f, 0.644777954f},
-std::array<float,2>{0.0849024132f, 0.924949229f},
-std::array<float,2>{0.608175278f, 0.142975122f},
-std::array<float,2>{0.166948095f, 0.0581564344f},
-std::array<float,2>{0.662764728f, 0.801861346f},
-std::array<float,2>{0.374459684f, 0.602118909f},
-std::array<float,2>{0.80508256f, 0.484018445f},
-std::array<float,2>{0.0163958669f, 0.376387566f},
-std::array<float,2>{0.530314624f, 0.502971172f},
-std::array<float,2>{0.484867156f, 0.816729128f},
-std::array<float,2>{0.931687772f, 0.110762939f},
-std::array<float,2>{0.257341295f, 0.231011018f},
-std::array<float,2>{0.815629184f, 0.997688055f},
-std::array<float,2>{0.221059322f, 0.737328529f},
-std::array<float,2>{0.719811916f, 0.291380137f},
-std::array<float,2>{0.335396677f, 0.447536677f},
-std::array<float,2>{0.778087318f, 0.565315902f},
-std::array<float,2>{0.131523892f, 0.766209781f},
-std::array<float,2>{0.635075569f, 0.017812755f},
-std::array<float,2>{0.124813862f, 0.181388199f},
-std::array<float,2>{0.581130385f, 0.885207355f},
-std::array<float,2>{0.433314055f, 0.681404173f},
-std::array<float,2>{0.968224227f, 0.316689312f},
-std::array<float,2>{0.192157954f, 0.267365515f},
-std::array<float,2>{0.712894082f, 0.698330343f},
-std::array<float,2>{0.293617547f, 0.942186177f},
-std::array<float,2>{0.859365463f, 0.205472127f},
-std::array<float,2>{0.453813344f, 0.0675285459f},
-std::array<float,2>{0.89024049f, 0.865741491f},
-std::array<float,2>{0.0586878732f, 0.53459686f},
-std::array<float,2>{0.554250062f, 0.412764251f},
-std::array<float,2>{0.422287703f, 0.47623232f},
-std::array<float,2>{0.954991817f, 0.598141253f},
-std::array<float,2>{0.109552272f, 0.810878932f},
-std::array<float,2>{0.588587224f, 0.050409168f},
-std::array<float,2>{0.139606372f, 0.15312314f},
-std::array<float,2>{0.631049931f, 0.93332392f},
-std::array<float,2>{0.343168646f, 0.649701536f},
-std::array<float,2>{0.767960191f, 0.360574037f},
-std::array<float,2>{0.0512116104f, 0.28816852f},
-std::array<float,2>{0.555054247f, 0.745349765f},
-std::array<float,2>{0.462096721f, 0.992159128f},
-std::array<float,2>{0.877375901f, 0.219446838f},
-std::array<float,2>{0.282311827f, 0.122638829f},
-std::array<float,2>{0.850169539f, 0.827977061f},
-std::array<float,2>{0.198885232f, 0.514638841f},
-std::array<float,2>{0.705158532f, 0.387786537f},
-std::array<float,2>{0.367008358f, 0.321342975f},
-std::array<float,2>{0.800471485f, 0.674318254f},
-std::array<float,2>{0.157517269f, 0.881606638f},
-std::array<float,2>{0.666661561f, 0.178175807f},
-std::array<float,2>{0.088881135f, 0.0249517299f},
-std::array<float,2>{0.594870031f, 0.779051721f},
-std::array<float,2>{0.396301985f, 0.573803186f},
-std::array<float,2>{0.974815369f, 0.440206081f},
-std::array<float,2>{0.227681041f, 0.416411042f},
-std::array<float,2>{0.726807714f, 0.540394485f},
-std::array<float,2>{0.262398034f, 0.868475735f},
-std::array<float,2>{0.82627666f, 0.0724784434f},
-std::array<float,2>{0.493656576f, 0.21805416f},
-std::array<float,2>{0.923166811f, 0.946632445f},
-std::array<float,2>{0.0243218318f, 0.689740419f},
-std::array<float,2>{0.519527018f, 0.277068019f},
-std::array<float,2>{0.438222945f, 0.258920521f},
-std::array<float,2>{0.906049669f, 0.711816013f},
-std::array<float,2>{0.042583935f, 0.959883094f},
-std::array<float,2>{0.542581081f, 0.187699914f},
-std::array<float,2>{0.212486044f, 0.079125762f},
-std::array<float,2>{0.699358046f, 0.857944965f},
-std::array<float,2>{0.304930925f, 0.560822308f},
-std::array<float,2>{0.864004612f, 0.434834331f},
-std::array<float,2>{0.10631112f, 0.459849834f},
-std::array<float,2>{0.563820124f, 0.586137056f},
-std::array<float,2>{0.409920722f, 0.759784579f},
-std::array<float,2>{0.948687434f, 0.0067094015f},
-std::array<float,2>{0.318755955f, 0.166679397f},
-std::array<float,2>{0.763347745f, 0.893081903f},
-std::array<float,2>{0.155506432f, 0.662731051f},
-std::array<float,2>{0.643243134f, 0.337752432f},
-std::array<float,2>{0.27965042f, 0.393664747f},
-std::array<float,2>{0.839235783f, 0.529308081f},
-std::array<float,2>{0.238579512f, 0.843451262f},
-std::array<float,2>{0.739103436f, 0.0964066908f},
-std::array<float,2>{0.00712107867f, 0.247400194f},
-std::array<float,2>{0.513523579f, 0.971600592f},
-std::array<float,2>{0.471689135f, 0.732385159f},
-std::array<float,2>{0.921287954f, 0.309662163f},
-std::array<float,2>{0.183261901f, 0.344433337f},
-std::array<float,2>{0.683266521f, 0.632499218f},
-std::array<float,2>{0.355710149f, 0.916438341f},
-std::array<float,2>{0.786373317f, 0.128866196f},
-std::array<float,2>{0.385718375f, 0.0410196334f},
-std::array<float,2>{0.987595856f, 0.792968035f},
-std::array<float,2>{0.069086574f, 0.617513359f},
-std::array<float,2>{0.615708232f, 0.499024779f},
-std::array<float,2>{0.496489406f, 0.484420329f},
-std::array<float,2>{0.927194059f, 0.610013962f},
-std::array<float,2>{0.0285043027f, 0.785925448f},
-std::array<float,2>{0.521391988f, 0.0384086855f},
-std::array<float,2>{0.231242716f, 0.134525821f},
-std::array<float,2>{0.733335316f, 0.907414317f},
-std::array<float,2>{0.257970095f, 0.639619589f},
-std::array<float,2>{0.821801007f, 0.354342282f},
-std::array<float,2>{0.0920070112f, 0.298192859f},
-std::array<float,2>{0.600539684f, 0.719728947f},
-std::array<float,2>{0.39448911f, 0.983777523f},
-std::array<float,2>{0.970958471f, 0.241021723f},
-std::array<float,2>{0.360365629f, 0.10625156f},
-std::array<float,2>{0.802559435f, 0.831540167f},
-std::array<float,2>{0.161423251f, 0.517048001f},
-std::array<float,2>{0.66895467f, 0.405079991f},
-std::array<float,2>{0.285757512f, 0.330159873f},
-std::array<float,2>{0.846553326f, 0.669438601f},
-std::array<float,2>{0.201357305f, 0.904665589f},
-std::array<float,2>{0.708006263f, 0.156801313f},
-std::array<float,2>{0.0479066409f, 0.011955712f},
-std::array<float,2>{0.561503708f, 0.757422566f},
-std::array<float,2>{0.468278468f, 0.58093977f},
-std::array<float,2>{0.882589459f, 0.46584627f},
-std::array<float,2>{0.135552272f, 0.423245013f},
-std::array<float,2>{0.626483679f, 0.548903286f},
-std::array<float,2>{0.336645961f, 0.850448787f},
-std::array<float,2>{0.772798657f, 0.0889015421f},
-std::array<float,2>{0.428398311f, 0.20200488f},
-std::array<float,2>{0.957698822f, 0.961964965f},
-std::array<float,2>{0.114680596f, 0.704881728f},
-std::array<float,2>{0.592314839f, 0.255173653f},
-std::array<float,2>{0.386821568f, 0.271262169f},
-std::array<float,2>{0.990041316f, 0.699920833f},
-std::array<float,2>{0.0658126324f, 0.939379096f},
-std::array<float,2>{0.610598564f, 0.210001633f},
-std::array<float,2>{0.18500255f, 0.0629501715f},
-std::array<float,2>{0.684264421f, 0.862495661f},
-std::array<float,2>{0.354570448f, 0.538587928f},
-std::array<float,2>{0.783261538f, 0.407550544f},
-std::array<float,2>{0.00271334848f, 0.450051636f},
-std::array<float,2>{0.510894656f, 0.567903459f},
-std::array<float,2>{0.472847641f, 0.770878077f},
-std::array<float,2>{0.915260494f, 0.0219943486f},
-std::array<float,2>{0.275555313f, 0.184755653f},
-std::array<float,2>{0.843737662f, 0.887384653f},
-std::array<float,2>{0.237847447f, 0.6849159f},
-std::array<float,2>{0.736742973f, 0.315096706f},
-std::array<float,2>{0.315318525f, 0.379503012f},
-std::array<float,2>{0.761600494f, 0.505247593f},
-std::array<float,2>{0.15163663f, 0.813469708f},
-std::array<float,2>{0.645312726f, 0.115868233f},
-std::array<float,2>{0.101755604f, 0.228329286f},
-std::array<float,2>{0.566548824f, 0.993964255f},
-std::array<float,2>{0.41345039f, 0.740741313f},
-std::array<float,2>{0.951604426f, 0.293193936f},
-std::array<float,2>{0.218350112f, 0.374132514f},
-std::array<float,2>{0.695484936f, 0.643981636f},
-std::array<float,2>{0.31165579f, 0.927036107f},
-std::array<float,2>{0.862647176f, 0.148122847f},
-std::array<float,2>{0.443998307f, 0.0614064969f},
-std::array<float,2>{0.89875263f, 0.800249577f},
-std::array<float,2>{0.0438448861f, 0.606288195f},
-std::array<float,2>{0.544395387f, 0.478508025f},
-std::array<float,2>{0.421375811f, 0.420106828f},
-std::array<float,2>{0.939596951f, 0.546867728f},
-std::array<float,2>{0.099981457f, 0.871245325f},
-std::array<float,2>{0.57688278f, 0.0772114992f},
-std::array<float,2>{0.141393706f, 0.213511437f},
-std::array<float,2>{0.655423224f, 0.949600399f},
-std::array<float,2>{0.327534676f, 0.692277253f},
-std::array<float,2>{0.752360404f, 0.280091941f},
-std::array<float,2>{0.0343379565f, 0.325732589f},
-std::array<float,2>{0.533358097f, 0.6772964f},
-std::array<float,2>{0.446593165f, 0.878672719f},
-std::array<float,2>{0.891973197f, 0.174344108f},
-std::array<float,2>{0.301447332f, 0.0307887532f},
-std::array<float,2>{0.872288346f, 0.775650859f},
-std::array<float,2>{0.204154074f, 0.575876236f},
-std::array<float,2>{0.691637456f, 0.441524178f},
-std::array<float,2>{0.345756859f, 0.281835735f},
-std::array<float,2>{0.795200825f, 0.746651709f},
-std::array<float,2>{0.176013082f, 0.98808682f},
-std::array<float,2>{0.677009702f, 0.225921795f},
-std::array<float,2>{0.0713527277f, 0.120526791f},
-std::array<float,2>{0.622988164f, 0.82224077f},
-std::array<float,2>{0.380810618f, 0.508174419f},
-std::array<float,2>{0.993501961f, 0.385949194f},
-std::array<float,2>{0.249152899f, 0.47207728f},
-std::array<float,2>{0.743130326f, 0.595135689f},
-std::array<float,2>{0.268225044f, 0.807331085f},
-std::array<float,2>{0.828589022f, 0.0542865619f},
-std::array<float,2>{0.482351035f, 0.150583878f},
-std::array<float,2>{0.913081706f, 0.933642685f},
-std::array<float,2>{0.0117818462f, 0.653978646f},
-std::array<float,2>{0.502643883f, 0.366804898f},
-std::array<float,2>{0.457861245f, 0.351367056f},
-std::array<float,2>{0.885290384f, 0.626139939f},
-std::array<float,2>{0.0567240752f, 0.919170141f},
-std::array<float,2>{0.548977137f, 0.129682556f},
-std::array<float,2>{0.187707677f, 0.0462169908f},
-std::array<float,2>{0.714965522f, 0.796828568f},
-std::array<float,2>{0.290695578f, 0.622386456f},
-std::array<float,2>{0.852080703f, 0.493154466f},
-std::array<float,2>{0.118363075f, 0.395288944f},
-std::array<float,2>{0.585435987f, 0.524194121f},
-std::array<float,2>{0.437250435f, 0.839790761f},
-std::array<float,2>{0.963626444f, 0.0987099633f},
-std::array<float,2>{0.328332245f, 0.244324535f},
-std::array<float,2>{0.775696337f, 0.97608006f},
-std::array<float,2>{0.12841998f, 0.73018527f},
-std::array<float,2>{0.638516903f, 0.308020085f},
-std::array<float,2>{0.253393859f, 0.455063164f},
-std::array<float,2>{0.816938877f, 0.591313303f},
-std::array<float,2>{0.224985644f, 0.76462245f},
-std::array<float,2>{0.725890636f, 0.00245290063f},
-std::array<float,2>{0.023190612f, 0.168076649f},
-std::array<float,2>{0.526758492f, 0.897115171f},
-std::array<float,2>{0.488665819f, 0.659616649f},
-std::array<float,2>{0.936756432f, 0.341448843f},
-std::array<float,2>{0.170071304f, 0.264324725f},
-std::array<float,2>{0.657341182f, 0.715984166f},
-std::array<float,2>{0.367935628f, 0.953148365f},
-std::array<float,2>{0.811844707f, 0.191467732f},
-std::array<float,2>{0.399678707f, 0.082753256f},
-std::array<float,2>{0.97722882f, 0.852807462f},
-std::array<float,2>{0.0815842748f, 0.556782007f},
-std::array<float,2>{0.604984164f, 0.431652844f},
-std::array<float,2>{0.452648997f, 0.399554253f},
-std::array<float,2>{0.894628108f, 0.522245944f},
-std::array<float,2>{0.0386786982f, 0.833746314f},
-std::array<float,2>{0.535942972f, 0.101598084f},
-std::array<float,2>{0.208679751f, 0.235001951f},
-std::array<float,2>{0.690831065f, 0.979223669f},
-std::array<float,2>{0.300215811f, 0.723078847f},
-std::array<float,2>{0.87037313f, 0.302119434f},
-std::array<float,2>{0.0959135741f, 0.358837217f},
-std::array<float,2>{0.570456207f, 0.635557711f},
-std::array<float,2>{0.417616963f, 0.910852551f},
-std::array<float,2>{0.942463696f, 0.138578966f},
-std::array<float,2>{0.322510988f, 0.0344331004f},
-std::array<float,2>{0.75729835f, 0.78296572f},
-std::array<float,2>{0.147635192f, 0.617100418f},
-std::array<float,2>{0.649030864f, 0.489906967f},
-std::array<float,2>{0.270544916f, 0.253187269f},
-std::array<float,2>{0.834642172f, 0.710774422f},
-std::array<float,2>{0.244816884f, 0.967904031f},
-std::array<float,2>{0.747864425f, 0.197966993f},
-std::array<float,2>{0.0100627355f, 0.0913897455f},
-std::array<float,2>{0.507436752f, 0.845719576f},
-std::array<float,2>{0.47880435f, 0.554469287f},
-std::array<float,2>{0.907026172f, 0.429358125f},
-std::array<float,2>{0.175312012f, 0.462473482f},
-std::array<float,2>{0.672830522f, 0.58453387f},
-std::array<float,2>{0.349571258f, 0.752407372f},
-std::array<float,2>{0.791575193f, 0.00826668832f},
-std::array<float,2>{0.378299087f, 0.162982836f},
-std::array<float,2>{0.999228776f, 0.900347352f},
-std::array<float,2>{0.0751613751f, 0.665398955f},
-std::array<float,2>{0.617556155f, 0.334383577f},
-std::array<float,2>{0.430614263f, 0.319210261f},
-std::array<float,2>{0.965552807f, 0.682817101f},
-std::array<float,2>{0.122576013f, 0.883295834f},
-std::array<float,2>{0.579166472f, 0.182745248f},
-std::array<float,2>{0.129556909f, 0.0166145079f},
-std::array<float,2>{0.633057594f, 0.768638432f},
-std::array<float,2>{0.332568705f, 0.563022256f},
-std::array<float,2>{0.781157851f, 0.44537273f},
-std::array<float,2>{0.06059606f, 0.410391361f},
-std::array<float,2>{0.552194774f, 0.532895446f},
-std::array<float,2>{0.456010491f, 0.865124643f},
-std::array<float,2>{0.888517559f, 0.0685503781f},
-std::array<float,2>{0.295262635f, 0.203956142f},
-std::array<float,2>{0.856846035f, 0.945053756f},
-std::array<float,2>{0.195052698f, 0.696260095f},
-std::array<float,2>{0.712884843f, 0.267872363f},
-std::array<float,2>{0.372694045f, 0.481875867f},
-std::array<float,2>{0.808094978f, 0.604472518f},
-std::array<float,2>{0.165506229f, 0.804071903f},
-std::array<float,2>{0.66136837f, 0.0562916435f},
-std::array<float,2>{0.0825528726f, 0.141959757f},
-std::array<float,2>{0.606307864f, 0.922275424f},
-std::array<float,2>{0.403523564f, 0.647061825f},
-std::array<float,2>{0.983328879f, 0.370997697f},
-std::array<float,2>{0.219836712f, 0.289452314f},
-std::array<float,2>{0.721169293f, 0.735283911f},
-std::array<float,2>{0.254771084f, 0.999225259f},
-std::array<float,2>{0.814156175f, 0.233126983f},
-std::array<float,2>{0.488052309f, 0.112942487f},
-std::array<float,2>{0.93034339f, 0.819140732f},
-std::array<float,2>{0.0184888821f, 0.500110984f},
-std::array<float,2>{0.528842628f, 0.378411353f},
-std::array<float,2>{0.397508562f, 0.438231379f},
-std::array<float,2>{0.973600745f, 0.571483314f},
-std::array<float,2>{0.0866386667f, 0.779590368f},
-std::array<float,2>{0.596223474f, 0.0260563102f},
-std::array<float,2>{0.158960596f, 0.177310064f},
-std::array<float,2>{0.664204419f, 0.879245937f},
-std::array<float,2>{0.363327682f, 0.67325896f},
-std::array<float,2>{0.79730916f, 0.323189557f},
-std::array<float,2>{0.0266306736f, 0.274363518f},
-std::array<float,2>{0.516388476f, 0.689105213f},
-std::array<float,2>{0.494632065f, 0.94745934f},
-std::array<float,2>{0.925290763f, 0.215349481f},
-std::array<float,2>{0.265359253f, 0.0711186156f},
-std::array<float,2>{0.825544596f, 0.870675147f},
-std::array<float,2>{0.229224354f, 0.542664528f},
-std::array<float,2>{0.729364932f, 0.415818989f},
-std::array<float,2>{0.340284795f, 0.362895787f},
-std::array<float,2>{0.766446054f, 0.651436329f},
-std::array<float,2>{0.137343466f, 0.930365503f},
-std::array<float,2>{0.630727828f, 0.155001536f},
-std::array<float,2>{0.111534223f, 0.0480408706f},
-std::array<float,2>{0.587839365f, 0.808814287f},
-std::array<float,2>{0.425303757f, 0.601439357f},
-std::array<float,2>{0.955735028f, 0.474430084f},
-std::array<float,2>{0.195824236f, 0.389858782f},
-std::array<float,2>{0.703670621f, 0.51365298f},
-std::array<float,2>{0.283409387f, 0.826067269f},
-std::array<float,2>{0.84960407f, 0.124597445f},
-std::array<float,2>{0.463900656f, 0.222354963f},
-std::array<float,2>{0.876403332f, 0.989584029f},
-std::array<float,2>{0.0530620143f, 0.742984951f},
-std::array<float,2>{0.557163f, 0.285182029f},
-std::array<float,2>{0.470125765f, 0.311525375f},
-std::array<float,2>{0.919196129f, 0.734372914f},
-std::array<float,2>{0.00459717121f, 0.970509768f},
-std::array<float,2>{0.514153719f, 0.248506323f},
-std::array<float,2>{0.241964042f, 0.0938370973f},
-std::array<float,2>{0.740788102f, 0.840184867f},
-std::array<float,2>{0.278787225f, 0.527996659f},
-std::array<float,2>{0.836156607f, 0.390699238f},
-std::array<float,2>{0.0669315979f, 0.497831404f},
-std::array<float,2>{0.615125537f, 0.619462252f},
-std::array<float,2>{0.383651704f, 0.790719151f},
-std::array<float,2>{0.984402001f, 0.0409012474f},
-std::array<float,2>{0.358721912f, 0.12675406f},
-std::array<float,2>{0.78828162f, 0.91584605f},
-std::array<float,2>{0.179758057f, 0.630070746f},
-std::array<float,2>{0.680154264f, 0.346819043f},
-std::array<float,2>{0.308495104f, 0.437179208f},
-std::array<float,2>{0.86530298f, 0.559175491f},
-std::array<float,2>{0.213701278f, 0.856140912f},
-std::array<float,2>{0.701699197f, 0.0811263621f},
-std::array<float,2>{0.0404651947f, 0.190798894f},
-std::array<float,2>{0.539070368f, 0.958437026f},
-std::array<float,2>{0.440019429f, 0.71441412f},
-std::array<float,2>{0.903266668f, 0.259881288f},
-std::array<float,2>{0.153231993f, 0.338802874f},
-std::array<float,2>{0.642374992f, 0.660239279f},
-std::array<float,2>{0.316730291f, 0.892072976f},
-std::array<float,2>{0.764247537f, 0.164328814f},
-std::array<float,2>{0.406609625f, 0.00552097522f},
-std::array<float,2>{0.946535528f, 0.759137154f},
-std::array<float,2>{0.109116241f, 0.58825016f},
-std::array<float,2>{0.565499008f, 0.458199322f},
-std::array<float,2>{0.443354696f, 0.477383435f},
-std::array<float,2>{0.900860012f, 0.606809855f},
-std::array<float,2>{0.0458461531f, 0.799481213f},
-std::array<float,2>{0.545604944f, 0.0615974702f},
-std::array<float,2>{0.215550646f, 0.147366926f},
-std::array<float,2>{0.698908687f, 0.926434219f},
-std::array<float,2>{0.308765441f, 0.642579198f},
-std::array<float,2>{0.860099494f, 0.373711646f},
-std::array<float,2>{0.105080083f, 0.294518292f},
-std::array<float,2>{0.570152044f, 0.741402864f},
-std::array<float,2>{0.411654204f, 0.992965758f},
-std::array<float,2>{0.950118542f, 0.22701177f},
-std::array<float,2>{0.312604189f, 0.116413839f},
-std::array<float,2>{0.75878787f, 0.814287543f},
-std::array<float,2>{0.149809256f, 0.50432086f},
-std::array<float,2>{0.647855878f, 0.380683005f},
-std::array<float,2>{0.274941236f, 0.316369385f},
-std::array<float,2>{0.839960515f, 0.683821499f},
-std::array<float,2>{0.235962108f, 0.888645589f},
-std::array<float,2>{0.734727919f, 0.183790222f},
-std::array<float,2>{0.00145061372f, 0.0224775858f},
-std::array<float,2>{0.509289801f, 0.769613206f},
-std::array<float,2>{0.475533396f, 0.56657052f},
-std::array<float,2>{0.917478502f, 0.450743318f},
-std::array<float,2>{0.186773986f, 0.406434059f},
-std::array<float,2>{0.686114371f, 0.53771615f},
-std::array<float,2>{0.35188219f, 0.86147505f},
-std::array<float,2>{0.7826249f, 0.0642346218f},
-std::array<float,2>{0.390259624f, 0.209864274f},
-std::array<float,2>{0.99073559f, 0.937961996f},
-std::array<float,2>{0.0641465783f, 0.700913489f},
-std::array<float,2>{0.611599743f, 0.270108819f},
-std::array<float,2>{0.426888466f, 0.254315019f},
-std::array<float,2>{0.959117532f, 0.703924358f},
-std::array<float,2>{0.115676902f, 0.961262286f},
-std::array<float,2>{0.591259897f, 0.202182218f},
-std::array<float,2>{0.133023918f, 0.088472113f},
-std::array<float,2>{0.627883673f, 0.851486742f},
-std::array<float,2>{0.339048356f, 0.550031185f},
-std::array<float,2>{0.771357477f, 0.422697902f},
-std::array<float,2>{0.05065744f, 0.465690315f},
-std::array<float,2>{0.558963478f, 0.581453562f},
-std::array<float,2>{0.466432154f, 0.75608772f},
-std::array<float,2>{0.879278541f, 0.0129468096f},
-std::array<float,2>{0.287879407f, 0.157378808f},
-std::array<float,2>{0.844722867f, 0.905762494f},
-std::array<float,2>{0.20028165f, 0.66810745f},
-std::array<float,2>{0.710410237f, 0.331974447f},
-std::array<float,2>{0.362368107f, 0.405664921f},
-std::array<float,2>{0.803700864f, 0.515996873f},
-std::array<float,2>{0.163582727f, 0.830442727f},
-std::array<float,2>{0.670489013f, 0.10704273f},
-std::array<float,2>{0.0916174725f, 0.241831243f},
-std::array<float,2>{0.598431945f, 0.9826231f},
-std::array<float,2>{0.392454624f, 0.719240487f},
-std::array<float,2>{0.969694078f, 0.296954602f},
-std::array<float,2>{0.233137727f, 0.355040163f},
-std::array<float,2>{0.732007265f, 0.639730453f},
-std::array<float,2>{0.260235906f, 0.907004952f},
-std::array<float,2>{0.822731555f, 0.133768782f},
-std::array<float,2>{0.499962986f, 0.0380851887f},
-std::array<float,2>{0.928910077f, 0.786405802f},
-std::array<float,2>{0.0311245639f, 0.610439718f},
-std::array<float,2>{0.522018492f, 0.485717177f},
-std::array<float,2>{0.402324408f, 0.433406115f},
-std::array<float,2>{0.980066717f, 0.557953298f},
-std::array<float,2>{0.0791305304f, 0.852321625f},
-std::array<float,2>{0.602683663f, 0.0832154676f},
-std::array<float,2>{0.169656217f, 0.193154097f},
-std::array<float,2>{0.65875423f, 0.954955876f},
-std::array<float,2>{0.369709641f, 0.715588391f},
-std::array<float,2>{0.8091259f, 0.265463233f},
-std::array<float,2>{0.0211103652f, 0.34050259f},
-std::array<float,2>{0.524572611f, 0.658729732f},
-std::array<float,2>{0.492000937f, 0.898150325f},
-std::array<float,2>{0.935388803f, 0.169890225f},
-std::array<float,2>{0.251799345f, 0.00296397228f},
-std::array<float,2>{0.820261061f, 0.765015483f},
-std::array<float,2>{0.223237678f, 0.590248227f},
-std::array<float,2>{0.723510742f, 0.45321694f},
-std::array<float,2>{0.331079096f, 0.307559282f},
-std::array<float,2>{0.773942053f, 0.729018807f},
-std::array<float,2>{0.12543264f, 0.975117922f},
-std::array<float,2>{0.63958925f, 0.245587781f},
-std::array<float,2>{0.12000142f, 0.0980964154f},
-std::array<float,2>{0.583952129f, 0.838676989f},
-std::array<float,2>{0.435044289f, 0.525043428f},
-std::array<float,2>{0.96202004f, 0.396055102f},
-std::array<float,2>{0.190940112f, 0.493822366f},
-std::array<float,2>{0.717898369f, 0.621808946f},
-std::array<float,2>{0.292386115f, 0.795811892f},
-std::array<float,2>{0.853706658f, 0.0454664752f},
-std::array<float,2>{0.460270643f, 0.130060062f},
-std::array<float,2>{0.883041143f, 0.918122709f},
-std::array<float,2>{0.054691352f, 0.625204623f},
-std::array<float,2>{0.548020244f, 0.34972164f},
-std::array<float,2>{0.483740538f, 0.365329176f},
-std::array<float,2>{0.910488546f, 0.652543187f},
-std::array<float,2>{0.0145622361f, 0.935023189f},
-std::array<float,2>{0.500011086f, 0.151819721f},
-std::array<float,2>{0.247960359f, 0.0530272238f},
-std::array<float,2>{0.744593918f, 0.808411717f},
-std::array<float,2>{0.267334193f, 0.59377861f},
-std::array<float,2>{0.830101609f, 0.47072199f},
-std::array<float,2>{0.0724602714f, 0.384970278f},
-std::array<float,2>{0.624679744f, 0.508852005f},
-std::array<float,2>{0.381592035f, 0.821232617f},
-std::array<float,2>{0.995620966f, 0.12000905f},
-std::array<float,2>{0.344184875f, 0.225280687f},
-std::array<float,2>{0.793691397f, 0.986837506f},
-std::array<float,2>{0.178982541f, 0.747451305f},
-std::array<float,2>{0.678728759f, 0.282702953f},
-std::array<float,2>{0.302802801f, 0.443294525f},
-std::array<float,2>{0.873105347f, 0.57499826f},
-std::array<float,2>{0.206605196f, 0.776948392f},
-std::array<float,2>{0.695217013f, 0.0302515328f},
-std::array<float,2>{0.0326016657f, 0.175049126f},
-std::array<float,2>{0.531799018f, 0.877428412f},
-std::array<float,2>{0.448457628f, 0.675835729f},
-std::array<float,2>{0.892968476f, 0.324968427f},
-std::array<float,2>{0.142889857f, 0.281128585f},
-std::array<float,2>{0.652447283f, 0.693298101f},
-std::array<float,2>{0.325152189f, 0.950546265f},
-std::array<float,2>{0.750002444f, 0.214593887f},
-std::array<float,2>{0.41812855f, 0.0769396946f},
-std::array<float,2>{0.937878966f, 0.872150779f},
-std::array<float,2>{0.0987728462f, 0.544989169f},
-std::array<float,2>{0.575199544f, 0.421276718f},
-std::array<float,2>{0.485575378f, 0.377624929f},
-std::array<float,2>{0.933338702f, 0.501232386f},
-std::array<float,2>{0.016936738f, 0.820000768f},
-std::array<float,2>{0.529478371f, 0.111880504f},
-std::array<float,2>{0.222450882f, 0.233892888f},
-std::array<float,2>{0.719245195f, 0.998802185f},
-std::array<float,2>{0.256813139f, 0.735998273f},
-std::array<float,2>{0.815294564f, 0.290692151f},
-std::array<float,2>{0.0856684595f, 0.369869173f},
-std::array<float,2>{0.609066308f, 0.648195148f},
-std::array<float,2>{0.404924661f, 0.923464835f},
-std::array<float,2>{0.981127799f, 0.140714854f},
-std::array<float,2>{0.373675525f, 0.0552734248f},
-std::array<float,2>{0.805885792f, 0.803156018f},
-std::array<float,2>{0.167105258f, 0.604711175f},
-std::array<float,2>{0.663842559f, 0.480480015f},
-std::array<float,2>{0.294066161f, 0.268926263f},
-std::array<float,2>{0.857697129f, 0.696307957f},
-std::array<float,2>{0.192863554f, 0.943535209f},
-std::array<float,2>{0.714743793f, 0.204631463f},
-std::array<float,2>{0.0601110496f, 0.0698736683f},
-std::array<float,2>{0.553502381f, 0.863988638f},
-std::array<float,2>{0.455057949f, 0.531313062f},
-std::array<float,2>{0.889059842f, 0.411751747f},
-std::array<float,2>{0.132761106f, 0.446337998f},
-std::array<float,2>{0.635979652f, 0.563670754f},
-std::array<float,2>{0.334178358f, 0.767997265f},
-std::array<float,2>{0.778595328f, 0.0162724331f},
-std::array<float,2>{0.431683958f, 0.182144001f},
-std::array<float,2>{0.967027605f, 0.884167254f},
-std::array<float,2>{0.12365219f, 0.682149827f},
-std::array<float,2>{0.580887377f, 0.319915742f},
-std::array<float,2>{0.375831097f, 0.33590588f},
-std::array<float,2>{0.996563911f, 0.664337218f},
-std::array<float,2>{0.0773316249f, 0.898923635f},
-std::array<float,2>{0.620017171f, 0.163708314f},
-std::array<float,2>{0.172527999f, 0.00968721975f},
-std::array<float,2>{0.674982548f, 0.752989829f},
-std::array<float,2>{0.349641889f, 0.585165024f},
-std::array<float,2>{0.790663183f, 0.461491913f},
-std::array<float,2>{0.00898347702f, 0.427921057f},
-std::array<float,2>{0.505072713f, 0.553163946f},
-std::array<float,2>{0.476786971f, 0.847281992f},
-std::array<float,2>{0.90857023f, 0.0898670182f},
-std::array<float,2>{0.273080647f, 0.198413417f},
-std::array<float,2>{0.832653999f, 0.967189789f},
-std::array<float,2>{0.243918642f, 0.709346592f},
-std::array<float,2>{0.749348342f, 0.252583474f},
-std::array<float,2>{0.320523918f, 0.489093721f},
-std::array<float,2>{0.753949642f, 0.615934908f},
-std::array<float,2>{0.145329177f, 0.781769693f},
-std::array<float,2>{0.650417447f, 0.0334144458f},
-std::array<float,2>{0.0947904885f, 0.137111738f},
-std::array<float,2>{0.573379636f, 0.911595762f},
-std::array<float,2>{0.415852755f, 0.636157334f},
-std::array<float,2>{0.943541467f, 0.35802564f},
-std::array<float,2>{0.209107012f, 0.30113852f},
-std::array<float,2>{0.688120782f, 0.723669291f},
-std::array<float,2>{0.298788756f, 0.979692638f},
-std::array<float,2>{0.867661655f, 0.235890225f},
-std::array<float,2>{0.450141162f, 0.103504263f},
-std::array<float,2>{0.898383617f, 0.832533062f},
-std::array<float,2>{0.035470672f, 0.522862792f},
-std::array<float,2>{0.538229942f, 0.399173617f},
-std::array<float,2>{0.408839613f, 0.457297832f},
-std::array<float,2>{0.9481107f, 0.589167476f},
-std::array<float,2>{0.106536262f, 0.758088171f},
-std::array<float,2>{0.563202918f, 0.00484557776f},
-std::array<float,2>{0.154529437f, 0.16547139f},
-std::array<float,2>{0.644072473f, 0.890793085f},
-std::array<float,2>{0.31984812f, 0.662098587f},
-std::array<float,2>{0.762383282f, 0.339583695f},
-std::array<float,2>{0.0410191044f, 0.260782689f},
-std::array<float,2>{0.541676104f, 0.71297437f},
-std::array<float,2>{0.438790202f, 0.957798779f},
-std::array<float,2>{0.905009151f, 0.189894393f},
-std::array<float,2>{0.306308776f, 0.0810008496f},
-std::array<float,2>{0.865194142f, 0.856450438f},
-std::array<float,2>{0.211263314f, 0.560497463f},
-std::array<float,2>{0.700650513f, 0.435883433f},
-std::array<float,2>{0.357242197f, 0.346327603f},
-std::array<float,2>{0.785654664f, 0.629711807f},
-std::array<float,2>{0.182215929f, 0.914942563f},
-std::array<float,2>{0.682616472f, 0.125322998f},
-std::array<float,2>{0.0700959787f, 0.0396807604f},
-std::array<float,2>{0.61657691f, 0.789409459f},
-std::array<float,2>{0.386141688f, 0.620972514f},
-std::array<float,2>{0.986665368f, 0.496404499f},
-std::array<float,2>{0.24006559f, 0.391625881f},
-std::array<float,2>{0.739566505f, 0.52893877f},
-std::array<float,2>{0.280655861f, 0.841243804f},
-std::array<float,2>{0.83807534f, 0.0956387594f},
-std::array<float,2>{0.471665025f, 0.249264747f},
-std::array<float,2>{0.920485914f, 0.96966058f},
-std::array<float,2>{0.00682295393f, 0.732506394f},
-std::array<float,2>{0.512690187f, 0.3112863f},
-std::array<float,2>{0.461583138f, 0.286515504f},
-std::array<float,2>{0.878358424f, 0.743734598f},
-std::array<float,2>{0.0522183068f, 0.989095986f},
-std::array<float,2>{0.556129575f, 0.220718503f},
-std::array<float,2>{0.197710648f, 0.12330123f},
-std::array<float,2>{0.706959903f, 0.824226141f},
-std::array<float,2>{0.282187134f, 0.512677789f},
-std::array<float,2>{0.85097146f, 0.388765454f},
-std::array<float,2>{0.110366337f, 0.472997308f},
-std::array<float,2>{0.589089096f, 0.60028863f},
-std::array<float,2>{0.423582524f, 0.809963226f},
-std::array<float,2>{0.953712583f, 0.0476758629f},
-std::array<float,2>{0.342763901f, 0.15571706f},
-std::array<float,2>{0.769498527f, 0.931030035f},
-std::array<float,2>{0.140292227f, 0.651020706f},
-std::array<float,2>{0.632191598f, 0.361612469f},
-std::array<float,2>{0.263482869f, 0.414745569f},
-std::array<float,2>{0.827926338f, 0.541414142f},
-std::array<float,2>{0.227079287f, 0.869288743f},
-std::array<float,2>{0.727781594f, 0.0720286816f},
-std::array<float,2>{0.024537025f, 0.216710493f},
-std::array<float,2>{0.518188059f, 0.948290527f},
-std::array<float,2>{0.492303878f, 0.68757695f},
-std::array<float,2>{0.922064126f, 0.27528289f},
-std::array<float,2>{0.157136068f, 0.323863059f},
-std::array<float,2>{0.667777717f, 0.672096491f},
-std::array<float,2>{0.365671843f, 0.880264461f},
-std::array<float,2>{0.799353957f, 0.176341042f},
-std::array<float,2>{0.394807488f, 0.0271721482f},
-std::array<float,2>{0.975877821f, 0.780463278f},
-std::array<float,2>{0.0883805752f, 0.571041584f},
-std::array<float,2>{0.594522715f, 0.438902259f},
-std::array<float,2>{0.47457096f, 0.45281747f},
-std::array<float,2>{0.914262235f, 0.569350243f},
-std::array<float,2>{0.00351041066f, 0.772497833f},
-std::array<float,2>{0.510303974f, 0.0201430805f},
-std::array<float,2>{0.236775398f, 0.186466053f},
-std::array<float,2>{0.737955391f, 0.890448928f},
-std::array<float,2>{0.27668038f, 0.687318742f},
-std::array<float,2>{0.842387378f, 0.312590748f},
-std::array<float,2>{0.0648216829f, 0.272941053f},
-std::array<float,2>{0.609376311f, 0.702817202f},
-std::array<float,2>{0.388230771f, 0.94001925f},
-std::array<float,2>{0.988486171f, 0.20741418f},
-std::array<float,2>{0.353791565f, 0.0649238154f},
-std::array<float,2>{0.784497857f, 0.860936821f},
-std::array<float,2>{0.184064016f, 0.536120474f},
-std::array<float,2>{0.68526572f, 0.409901142f},
-std::array<float,2>{0.311177403f, 0.372063577f},
-std::array<float,2>{0.862066805f, 0.641183674f},
-std::array<float,2>{0.217511564f, 0.927738309f},
-std::array<float,2>{0.697161555f, 0.145130575f},
-std::array<float,2>{0.0443986543f, 0.0597485267f},
-std::array<float,2>{0.543942869f, 0.798127532f},
-std::array<float,2>{0.44448337f, 0.60826081f},
-std::array<float,2>{0.899495721f, 0.480064631f},
-std::array<float,2>{0.150721341f, 0.382045716f},
-std::array<float,2>{0.645629704f, 0.505927444f},
-std::array<float,2>{0.315723449f, 0.814736724f},
-std::array<float,2>{0.76025933f, 0.11367742f},
-std::array<float,2>{0.412270427f, 0.229383662f},
-std::array<float,2>{0.952285945f, 0.994552433f},
-std::array<float,2>{0.10268876f, 0.739514768f},
-std::array<float,2>{0.568006158f, 0.296354055f},
-std::array<float,2>{0.39292264f, 0.298841923f},
-std::array<float,2>{0.972635388f, 0.721709609f},
-std::array<float,2>{0.0931507051f, 0.980631173f},
-std::array<float,2>{0.600611627f, 0.239404872f},
-std::array<float,2>{0.160342827f, 0.107742272f},
-std::array<float,2>{0.668865204f, 0.829529703f},
-std::array<float,2>{0.359905362f, 0.517784774f},
-std::array<float,2>{0.801691413f, 0.403817862f},
-std::array<float,2>{0.0281822663f, 0.486455441f},
-std::array<float,2>{0.519684017f, 0.613178432f},
-std::array<float,2>{0.497493207f, 0.788047314f},
-std::array<float,2>{0.925896883f, 0.0365954451f},
-std::array<float,2>{0.259353518f, 0.135801852f},
-std::array<float,2>{0.821180165f, 0.908817112f},
-std::array<float,2>{0.231903225f, 0.636892915f},
-std::array<float,2>{0.733899772f, 0.351995975f},
-std::array<float,2>{0.337437898f, 0.424999714f},
-std::array<float,2>{0.772224188f, 0.548535526f},
-std::array<float,2>{0.136472151f, 0.849475622f},
-std::array<float,2>{0.625161469f, 0.0873007849f},
-std::array<float,2>{0.113856159f, 0.200440809f},
-std::array<float,2>{0.593712986f, 0.964195848f},
-std::array<float,2>{0.429438859f, 0.706608176f},
-std::array<float,2>{0.95861125f, 0.256749153f},
-std::array<float,2>{0.202286661f, 0.329850405f},
-std::array<float,2>{0.708666623f, 0.67183429f},
-std::array<float,2>{0.286808997f, 0.902695477f},
-std::array<float,2>{0.847607493f, 0.158523008f},
-std::array<float,2>{0.467772067f, 0.0138134174f},
-std::array<float,2>{0.88162148f, 0.754955471f},
-std::array<float,2>{0.0473537408f, 0.57971257f},
-std::array<float,2>{0.562197506f, 0.468610555f},
-std::array<float,2>{0.435933977f, 0.396730363f},
-std::array<float,2>{0.964294434f, 0.526125014f},
-std::array<float,2>{0.117907614f, 0.837566733f},
-std::array<float,2>{0.584363699f, 0.100987427f},
-std::array<float,2>{0.127231747f, 0.243914351f},
-std::array<float,2>{0.6373595f, 0.973457754f},
-std::array<float,2>{0.329595029f, 0.727515578f},
-std::array<float,2>{0.776555002f, 0.305916339f},
-std::array<float,2>{0.0585584976f, 0.348771036f},
-std::array<float,2>{0.550414503f, 0.628867865f},
-std::array<float,2>{0.458729863f, 0.920198262f},
-std::array<float,2>{0.886269987f, 0.130872697f},
-std::array<float,2>{0.28914839f, 0.0445620678f},
-std::array<float,2>{0.853406847f, 0.794397891f},
-std::array<float,2>{0.1889745f, 0.624139011f},
-std::array<float,2>{0.716254354f, 0.495771646f},
-std::array<float,2>{0.368169099f, 0.261952013f},
-std::array<float,2>{0.81103605f, 0.717730701f},
-std::array<float,2>{0.171301857f, 0.955900192f},
-std::array<float,2>{0.65684998f, 0.193877265f},
-std::array<float,2>{0.0809142515f, 0.0847101063f},
-std::array<float,2>{0.604439616f, 0.854986846f},
-std::array<float,2>{0.398985386f, 0.55524528f},
-std::array<float,2>{0.977540731f, 0.43110472f},
-std::array<float,2>{0.226083353f, 0.455824703f},
-std::array<float,2>{0.724710345f, 0.593632042f},
-std::array<float,2>{0.252161622f, 0.762466609f},
-std::array<float,2>{0.81827569f, 1.00257039e-05f},
-std::array<float,2>{0.490148962f, 0.170956716f},
-std::array<float,2>{0.936470151f, 0.895407438f},
-std::array<float,2>{0.0215312876f, 0.657748997f},
-std::array<float,2>{0.525721252f, 0.342876345f},
-std::array<float,2>{0.446258843f, 0.327998549f},
-std::array<float,2>{0.891175985f, 0.679176152f},
-std::array<float,2>{0.0333224498f, 0.875403821f},
-std::array<float,2>{0.534369349f, 0.173258141f},
-std::array<float,2>{0.203394473f, 0.0279293228f},
-std::array<float,2>{0.692476511f, 0.773893416f},
-std::array<float,2>{0.302724153f, 0.576725602f},
-std::array<float,2>{0.871225476f, 0.444875777f},
-std::array<float,2>{0.10072659f, 0.418584913f},
-std::array<float,2>{0.577761769f, 0.543910563f},
-std::array<float,2>{0.420664608f, 0.874516547f},
-std::array<float,2>{0.940627813f, 0.075925529f},
-std::array<float,2>{0.326745272f, 0.212322712f},
-std::array<float,2>{0.753685176f, 0.951480389f},
-std::array<float,2>{0.141775668f, 0.694467187f},
-std::array<float,2>{0.65482378f, 0.279102445f},
-std::array<float,2>{0.268644542f, 0.470015019f},
-std::array<float,2>{0.829113185f, 0.596103728f},
-std::array<float,2>{0.248290539f, 0.805578887f},
-std::array<float,2>{0.743423641f, 0.0511512049f},
-std::array<float,2>{0.012714047f, 0.149603099f},
-std::array<float,2>{0.503206551f, 0.936237812f},
-std::array<float,2>{0.481290162f, 0.655597627f},
-std::array<float,2>{0.913426936f, 0.36408931f},
-std::array<float,2>{0.177501544f, 0.285097837f},
-std::array<float,2>{0.676328301f, 0.748986125f},
-std::array<float,2>{0.347566456f, 0.985506356f},
-std::array<float,2>{0.796599567f, 0.222756654f},
-std::array<float,2>{0.379039913f, 0.119031332f},
-std::array<float,2>{0.992990315f, 0.822725773f},
-std::array<float,2>{0.0704991072f, 0.510545909f},
-std::array<float,2>{0.621809363f, 0.384391278f},
-std::array<float,2>{0.456858784f, 0.413194746f},
-std::array<float,2>{0.887601674f, 0.533635259f},
-std::array<float,2>{0.0616576597f, 0.867151558f},
-std::array<float,2>{0.551289141f, 0.0672497824f},
-std::array<float,2>{0.194192544f, 0.206929266f},
-std::array<float,2>{0.710962415f, 0.942478001f},
-std::array<float,2>{0.296577871f, 0.698164105f},
-std::array<float,2>{0.855683208f, 0.265777051f},
-std::array<float,2>{0.121570945f, 0.317774117f},
-std::array<float,2>{0.578658223f, 0.680396318f},
-std::array<float,2>{0.430695266f, 0.8863222f},
-std::array<float,2>{0.96618855f, 0.179835945f},
-std::array<float,2>{0.333370686f, 0.0187217649f},
-std::array<float,2>{0.779959381f, 0.766685963f},
-std::array<float,2>{0.130373865f, 0.56578815f},
-std::array<float,2>{0.634507954f, 0.448865891f},
-std::array<float,2>{0.255575955f, 0.29224509f},
-std::array<float,2>{0.812517822f, 0.736335278f},
-std::array<float,2>{0.219412968f, 0.996098161f},
-std::array<float,2>{0.721935093f, 0.231782511f},
-std::array<float,2>{0.0191849004f, 0.109688729f},
-std::array<float,2>{0.527545631f, 0.817524254f},
-std::array<float,2>{0.486504078f, 0.502125204f},
-std::array<float,2>{0.931311131f, 0.37546134f},
-std::array<float,2>{0.164084971f, 0.482603043f},
-std::array<float,2>{0.660632074f, 0.60340178f},
-std::array<float,2>{0.371582448f, 0.801724613f},
-std::array<float,2>{0.807077825f, 0.0568516366f},
-std::array<float,2>{0.40241906f, 0.144300953f},
-std::array<float,2>{0.983835995f, 0.92471236f},
-std::array<float,2>{0.0835808218f, 0.645592868f},
-std::array<float,2>{0.606512964f, 0.367632926f},
-std::array<float,2>{0.416191489f, 0.355700105f},
-std::array<float,2>{0.941928446f, 0.633603334f},
-std::array<float,2>{0.0970807597f, 0.912831187f},
-std::array<float,2>{0.572070837f, 0.14015393f},
-std::array<float,2>{0.146874085f, 0.0320894495f},
-std::array<float,2>{0.650090635f, 0.783928335f},
-std::array<float,2>{0.323830426f, 0.613664269f},
-std::array<float,2>{0.756052077f, 0.491508961f},
-std::array<float,2>{0.037451338f, 0.401682675f},
-std::array<float,2>{0.536548793f, 0.519735992f},
-std::array<float,2>{0.451560766f, 0.834305763f},
-std::array<float,2>{0.895920992f, 0.105157487f},
-std::array<float,2>{0.299616039f, 0.237643138f},
-std::array<float,2>{0.870011985f, 0.978505015f},
-std::array<float,2>{0.207061172f, 0.726136088f},
-std::array<float,2>{0.68995899f, 0.304199487f},
-std::array<float,2>{0.348425567f, 0.464192748f},
-std::array<float,2>{0.792513907f, 0.582232296f},
-std::array<float,2>{0.173978895f, 0.751888812f},
-std::array<float,2>{0.673182726f, 0.0106975241f},
-std::array<float,2>{0.0754128993f, 0.161040872f},
-std::array<float,2>{0.618870437f, 0.902057528f},
-std::array<float,2>{0.377361476f, 0.667414308f},
-std::array<float,2>{0.99838084f, 0.333606839f},
-std::array<float,2>{0.246042788f, 0.25132063f},
-std::array<float,2>{0.746581137f, 0.707629502f},
-std::array<float,2>{0.270116687f, 0.965589166f},
-std::array<float,2>{0.835078061f, 0.196251944f},
-std::array<float,2>{0.480364859f, 0.0931643397f},
-std::array<float,2>{0.907506347f, 0.844359994f},
-std::array<float,2>{0.0108480938f, 0.552218318f},
-std::array<float,2>{0.506060302f, 0.426906735f},
-std::array<float,2>{0.383979946f, 0.498946279f},
-std::array<float,2>{0.98540467f, 0.618414402f},
-std::array<float,2>{0.0681456849f, 0.791282177f},
-std::array<float,2>{0.614147961f, 0.0424959771f},
-std::array<float,2>{0.181019202f, 0.127710119f},
-std::array<float,2>{0.680758119f, 0.91765213f},
-std::array<float,2>{0.358076066f, 0.630882859f},
-std::array<float,2>{0.78807503f, 0.345234454f},
-std::array<float,2>{0.00578304799f, 0.30918625f},
-std::array<float,2>{0.515551507f, 0.731348276f},
-std::array<float,2>{0.469423234f, 0.971755505f},
-std::array<float,2>{0.91871047f, 0.246272996f},
-std::array<float,2>{0.277996331f, 0.0967653096f},
-std::array<float,2>{0.83771348f, 0.842630148f},
-std::array<float,2>{0.241140068f, 0.530950963f},
-std::array<float,2>{0.742066264f, 0.393117219f},
-std::array<float,2>{0.317739487f, 0.336139321f},
-std::array<float,2>{0.765524685f, 0.663097918f},
-std::array<float,2>{0.153507397f, 0.893960774f},
-std::array<float,2>{0.641459107f, 0.167626366f},
-std::array<float,2>{0.107653894f, 0.00768056139f},
-std::array<float,2>{0.565286517f, 0.760938764f},
-std::array<float,2>{0.407285064f, 0.587755024f},
-std::array<float,2>{0.946113169f, 0.460907072f},
-std::array<float,2>{0.213935196f, 0.434502333f},
-std::array<float,2>{0.70220685f, 0.562298894f},
-std::array<float,2>{0.307175159f, 0.858424187f},
-std::array<float,2>{0.867070556f, 0.0782383233f},
-std::array<float,2>{0.440974414f, 0.189349517f},
-std::array<float,2>{0.903574646f, 0.960278928f},
-std::array<float,2>{0.0397966616f, 0.712817788f},
-std::array<float,2>{0.54079479f, 0.257837504f},
-std::array<float,2>{0.495283544f, 0.276239485f},
-std::array<float,2>{0.923923552f, 0.69047004f},
-std::array<float,2>{0.0261892043f, 0.945578694f},
-std::array<float,2>{0.516834974f, 0.21682325f},
-std::array<float,2>{0.229658902f, 0.0738499686f},
-std::array<float,2>{0.729992867f, 0.867824495f},
-std::array<float,2>{0.264501274f, 0.539065778f},
-std::array<float,2>{0.824300349f, 0.417558998f},
-std::array<float,2>{0.0870114937f, 0.440445125f},
-std::array<float,2>{0.596683085f, 0.572392941f},
-std::array<float,2>{0.397089392f, 0.777534425f},
-std::array<float,2>{0.974364698f, 0.0234421492f},
-std::array<float,2>{0.364753604f, 0.178856879f},
-std::array<float,2>{0.798581123f, 0.882265449f},
-std::array<float,2>{0.15924947f, 0.674837887f},
-std::array<float,2>{0.665662467f, 0.321159661f},
-std::array<float,2>{0.284885287f, 0.387222379f},
-std::array<float,2>{0.847694695f, 0.515295029f},
-std::array<float,2>{0.197139218f, 0.826656699f},
-std::array<float,2>{0.704220414f, 0.121585667f},
-std::array<float,2>{0.0546173938f, 0.220678017f},
-std::array<float,2>{0.5580948f, 0.990835488f},
-std::array<float,2>{0.46297729f, 0.744225562f},
-std::array<float,2>{0.875423908f, 0.287180454f},
-std::array<float,2>{0.138342664f, 0.36012429f},
-std::array<float,2>{0.629075348f, 0.648465276f},
-std::array<float,2>{0.340945959f, 0.931762576f},
-std::array<float,2>{0.767127335f, 0.153794289f},
-std::array<float,2>{0.424324661f, 0.0493420996f},
-std::array<float,2>{0.956821263f, 0.811987221f},
-std::array<float,2>{0.113094538f, 0.599107325f},
-std::array<float,2>{0.585950851f, 0.475521445f}}
\ No newline at end of file
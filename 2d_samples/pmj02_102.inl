@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.194558203f, 0.399106503f},
-std::array<float,2>{0.690523505f, 0.901767433f},
-std::array<float,2>{0.43039304f, 0.572667956f},
-std::array<float,2>{0.855478525f, 0.199241728f},
-std::array<float,2>{0.316959739f, 0.0271284394f},
-std::array<float,2>{0.967886925f, 0.732808232f},
-std::array<float,2>{0.0874491781f, 0.768021882f},
-std::array<float,2>{0.535059512f, 0.27101624f},
-std::array<float,2>{0.459716707f, 0.362210512f},
-std::array<float,2>{0.761358619f, 0.835401535f},
-std::array<float,2>{0.158079207f, 0.650233328f},
-std::array<float,2>{0.632436156f, 0.0904981419f},
-std::array<float,2>{0.0221696831f, 0.130110547f},
-std::array<float,2>{0.580149233f, 0.510757685f},
-std::array<float,2>{0.274982601f, 0.977051258f},
-std::array<float,2>{0.932121217f, 0.499709427f},
-std::array<float,2>{0.10290499f, 0.309213847f},
-std::array<float,2>{0.511113167f, 0.796712816f},
-std::array<float,2>{0.360234916f, 0.698090494f},
-std::array<float,2>{0.990825951f, 0.0563012213f},
-std::array<float,2>{0.396456838f, 0.242345318f},
-std::array<float,2>{0.822331667f, 0.597775161f},
-std::array<float,2>{0.239962593f, 0.910659432f},
-std::array<float,2>{0.749569356f, 0.423600167f},
-std::array<float,2>{0.308249712f, 0.452129662f},
-std::array<float,2>{0.891573727f, 0.941333115f},
-std::array<float,2>{0.0599152073f, 0.548002124f},
-std::array<float,2>{0.623146772f, 0.168507531f},
-std::array<float,2>{0.136359811f, 0.0998758972f},
-std::array<float,2>{0.665436804f, 0.672735393f},
-std::array<float,2>{0.475175172f, 0.845586956f},
-std::array<float,2>{0.802635252f, 0.328443259f},
-std::array<float,2>{0.17242676f, 0.32397902f},
-std::array<float,2>{0.642992377f, 0.870046496f},
-std::array<float,2>{0.449267745f, 0.662682354f},
-std::array<float,2>{0.777868807f, 0.114602178f},
-std::array<float,2>{0.261680573f, 0.176505193f},
-std::array<float,2>{0.920623481f, 0.539877713f},
-std::array<float,2>{0.0141531136f, 0.954271555f},
-std::array<float,2>{0.564630806f, 0.466034919f},
-std::array<float,2>{0.409167051f, 0.406509906f},
-std::array<float,2>{0.8664729f, 0.931039274f},
-std::array<float,2>{0.216371223f, 0.610138834f},
-std::array<float,2>{0.705010951f, 0.233650014f},
-std::array<float,2>{0.0659336597f, 0.0328679979f},
-std::array<float,2>{0.557916641f, 0.705006003f},
-std::array<float,2>{0.328302741f, 0.802709222f},
-std::array<float,2>{0.949875116f, 0.283464432f},
-std::array<float,2>{0.0327260643f, 0.474652261f},
-std::array<float,2>{0.59929955f, 0.993347883f},
-std::array<float,2>{0.288381875f, 0.522102594f},
-std::array<float,2>{0.886856437f, 0.153148636f},
-std::array<float,2>{0.493687004f, 0.0649726093f},
-std::array<float,2>{0.791418076f, 0.635794759f},
-std::array<float,2>{0.149872869f, 0.814743817f},
-std::array<float,2>{0.673876405f, 0.352763891f},
-std::array<float,2>{0.344971061f, 0.258151978f},
-std::array<float,2>{0.983653605f, 0.762738109f},
-std::array<float,2>{0.11566937f, 0.742667019f},
-std::array<float,2>{0.521978617f, 0.00719744246f},
-std::array<float,2>{0.231264219f, 0.214255661f},
-std::array<float,2>{0.725043654f, 0.578912377f},
-std::array<float,2>{0.380715281f, 0.889166951f},
-std::array<float,2>{0.831650674f, 0.376768351f},
-std::array<float,2>{0.146379307f, 0.457910717f},
-std::array<float,2>{0.680066824f, 0.96130079f},
-std::array<float,2>{0.490054965f, 0.534976006f},
-std::array<float,2>{0.788390517f, 0.184395939f},
-std::array<float,2>{0.293286592f, 0.119272128f},
-std::array<float,2>{0.882179916f, 0.667937815f},
-std::array<float,2>{0.0418460742f, 0.861045003f},
-std::array<float,2>{0.603480875f, 0.314586759f},
-std::array<float,2>{0.385717481f, 0.291349143f},
-std::array<float,2>{0.843343973f, 0.8062675f},
-std::array<float,2>{0.225672811f, 0.714523792f},
-std::array<float,2>{0.733717859f, 0.0440420471f},
-std::array<float,2>{0.122848742f, 0.221983954f},
-std::array<float,2>{0.528317034f, 0.621522367f},
-std::array<float,2>{0.357058793f, 0.927468956f},
-std::array<float,2>{0.971508801f, 0.416347563f},
-std::array<float,2>{0.00130811136f, 0.346199721f},
-std::array<float,2>{0.571092248f, 0.825703919f},
-std::array<float,2>{0.250724912f, 0.627168357f},
-std::array<float,2>{0.912726462f, 0.0721705258f},
-std::array<float,2>{0.437788516f, 0.14522481f},
-std::array<float,2>{0.772102177f, 0.527282178f},
-std::array<float,2>{0.185241908f, 0.988464892f},
-std::array<float,2>{0.652479112f, 0.483533859f},
-std::array<float,2>{0.337422282f, 0.388287127f},
-std::array<float,2>{0.937562704f, 0.880792618f},
-std::array<float,2>{0.0736749172f, 0.592839718f},
-std::array<float,2>{0.551812887f, 0.208357096f},
-std::array<float,2>{0.204044148f, 0.00860316306f},
-std::array<float,2>{0.716016769f, 0.73853749f},
-std::array<float,2>{0.420565158f, 0.752230883f},
-std::array<float,2>{0.86994344f, 0.256771505f},
-std::array<float,2>{0.244203061f, 0.275343746f},
-std::array<float,2>{0.738000751f, 0.780931234f},
-std::array<float,2>{0.402920961f, 0.722810686f},
-std::array<float,2>{0.81746906f, 0.0200760998f},
-std::array<float,2>{0.370091438f, 0.190969646f},
-std::array<float,2>{0.997285068f, 0.567444324f},
-std::array<float,2>{0.0995224863f, 0.896788478f},
-std::array<float,2>{0.503145099f, 0.392131776f},
-std::array<float,2>{0.47788474f, 0.48760581f},
-std::array<float,2>{0.808890998f, 0.97126466f},
-std::array<float,2>{0.131582722f, 0.501069605f},
-std::array<float,2>{0.659833252f, 0.132863551f},
-std::array<float,2>{0.0539003834f, 0.0858500078f},
-std::array<float,2>{0.61021626f, 0.643877804f},
-std::array<float,2>{0.304177165f, 0.842990041f},
-std::array<float,2>{0.902962565f, 0.369620323f},
-std::array<float,2>{0.0855895579f, 0.431360185f},
-std::array<float,2>{0.545090318f, 0.919466019f},
-std::array<float,2>{0.320590556f, 0.607194185f},
-std::array<float,2>{0.959948599f, 0.235311925f},
-std::array<float,2>{0.423907459f, 0.0479195043f},
-std::array<float,2>{0.84864825f, 0.689693451f},
-std::array<float,2>{0.197782725f, 0.788123608f},
-std::array<float,2>{0.699850678f, 0.299345225f},
-std::array<float,2>{0.265851885f, 0.337179333f},
-std::array<float,2>{0.923423588f, 0.856684327f},
-std::array<float,2>{0.0297634359f, 0.687269986f},
-std::array<float,2>{0.589923561f, 0.102934182f},
-std::array<float,2>{0.169948325f, 0.161775634f},
-std::array<float,2>{0.6396541f, 0.555336833f},
-std::array<float,2>{0.468654811f, 0.953078747f},
-std::array<float,2>{0.757654428f, 0.441844285f},
-std::array<float,2>{0.161203817f, 0.421770245f},
-std::array<float,2>{0.627223253f, 0.925716519f},
-std::array<float,2>{0.453973591f, 0.619453669f},
-std::array<float,2>{0.764965653f, 0.2257514f},
-std::array<float,2>{0.278222889f, 0.0400336608f},
-std::array<float,2>{0.933700979f, 0.717163026f},
-std::array<float,2>{0.0164143126f, 0.810456693f},
-std::array<float,2>{0.58308804f, 0.293175757f},
-std::array<float,2>{0.434017807f, 0.316642016f},
-std::array<float,2>{0.851870596f, 0.864301264f},
-std::array<float,2>{0.187636197f, 0.669689298f},
-std::array<float,2>{0.694548607f, 0.124308765f},
-std::array<float,2>{0.0923495442f, 0.182750776f},
-std::array<float,2>{0.535891354f, 0.536039829f},
-std::array<float,2>{0.313248724f, 0.968395054f},
-std::array<float,2>{0.96463871f, 0.455217242f},
-std::array<float,2>{0.0551671721f, 0.250131935f},
-std::array<float,2>{0.617794096f, 0.755166769f},
-std::array<float,2>{0.310117841f, 0.736950099f},
-std::array<float,2>{0.896176875f, 0.0135039883f},
-std::array<float,2>{0.471643806f, 0.203655526f},
-std::array<float,2>{0.797351182f, 0.586782098f},
-std::array<float,2>{0.139349371f, 0.877873123f},
-std::array<float,2>{0.670498967f, 0.383707404f},
-std::array<float,2>{0.364615262f, 0.478991538f},
-std::array<float,2>{0.988023877f, 0.987576008f},
-std::array<float,2>{0.106353782f, 0.530530632f},
-std::array<float,2>{0.515154183f, 0.141682133f},
-std::array<float,2>{0.234516189f, 0.0745199323f},
-std::array<float,2>{0.743139923f, 0.630300879f},
-std::array<float,2>{0.391611159f, 0.821499586f},
-std::array<float,2>{0.826803863f, 0.351187319f},
-std::array<float,2>{0.214697555f, 0.374215275f},
-std::array<float,2>{0.707315683f, 0.836422324f},
-std::array<float,2>{0.412634522f, 0.647972107f},
-std::array<float,2>{0.860680103f, 0.0815210044f},
-std::array<float,2>{0.333680987f, 0.137449414f},
-std::array<float,2>{0.946331024f, 0.50606519f},
-std::array<float,2>{0.0691040605f, 0.973254204f},
-std::array<float,2>{0.561317384f, 0.489420414f},
-std::array<float,2>{0.447992176f, 0.39606148f},
-std::array<float,2>{0.776107073f, 0.891986012f},
-std::array<float,2>{0.176186964f, 0.564510524f},
-std::array<float,2>{0.646618962f, 0.191515774f},
-std::array<float,2>{0.0108899837f, 0.0168450717f},
-std::array<float,2>{0.566859365f, 0.720467508f},
-std::array<float,2>{0.265582561f, 0.776684165f},
-std::array<float,2>{0.915976703f, 0.280009657f},
-std::array<float,2>{0.10983441f, 0.440074503f},
-std::array<float,2>{0.517442346f, 0.946540594f},
-std::array<float,2>{0.349747032f, 0.561373413f},
-std::array<float,2>{0.980418026f, 0.156944796f},
-std::array<float,2>{0.378584355f, 0.108434066f},
-std::array<float,2>{0.832366943f, 0.683561325f},
-std::array<float,2>{0.228942335f, 0.853664994f},
-std::array<float,2>{0.719431877f, 0.342149496f},
-std::array<float,2>{0.281993121f, 0.301962882f},
-std::array<float,2>{0.884726286f, 0.781325579f},
-std::array<float,2>{0.0380338728f, 0.69308877f},
-std::array<float,2>{0.595386207f, 0.0511001833f},
-std::array<float,2>{0.155026779f, 0.239362806f},
-std::array<float,2>{0.676463485f, 0.602108359f},
-std::array<float,2>{0.497916043f, 0.917447388f},
-std::array<float,2>{0.795709848f, 0.434356093f},
-std::array<float,2>{0.222574264f, 0.493753165f},
-std::array<float,2>{0.728106737f, 0.982271791f},
-std::array<float,2>{0.388987094f, 0.514669836f},
-std::array<float,2>{0.836986661f, 0.127577752f},
-std::array<float,2>{0.352418244f, 0.0890765935f},
-std::array<float,2>{0.976451516f, 0.652417421f},
-std::array<float,2>{0.117629521f, 0.829731286f},
-std::array<float,2>{0.525593579f, 0.365413785f},
-std::array<float,2>{0.484663963f, 0.266879886f},
-std::array<float,2>{0.782388687f, 0.770135999f},
-std::array<float,2>{0.144253045f, 0.726768553f},
-std::array<float,2>{0.685246289f, 0.0276319999f},
-std::array<float,2>{0.0456857085f, 0.198005885f},
-std::array<float,2>{0.608539522f, 0.576436043f},
-std::array<float,2>{0.289828569f, 0.903201222f},
-std::array<float,2>{0.876819074f, 0.40370658f},
-std::array<float,2>{0.0766008645f, 0.334514797f},
-std::array<float,2>{0.54826951f, 0.850038946f},
-std::array<float,2>{0.342123717f, 0.67597574f},
-std::array<float,2>{0.945177436f, 0.0950652212f},
-std::array<float,2>{0.416932493f, 0.165830255f},
-std::array<float,2>{0.872825265f, 0.552427709f},
-std::array<float,2>{0.207362384f, 0.944613218f},
-std::array<float,2>{0.713596046f, 0.445919454f},
-std::array<float,2>{0.257179141f, 0.427669287f},
-std::array<float,2>{0.908361614f, 0.91013968f},
-std::array<float,2>{0.00748265209f, 0.594311714f},
-std::array<float,2>{0.574646831f, 0.249964744f},
-std::array<float,2>{0.182957277f, 0.0600136034f},
-std::array<float,2>{0.65128547f, 0.702763081f},
-std::array<float,2>{0.443515986f, 0.790113926f},
-std::array<float,2>{0.768063068f, 0.307218492f},
-std::array<float,2>{0.125100121f, 0.28797698f},
-std::array<float,2>{0.663977563f, 0.79884249f},
-std::array<float,2>{0.483588666f, 0.708545208f},
-std::array<float,2>{0.807692766f, 0.036917638f},
-std::array<float,2>{0.297480017f, 0.228360295f},
-std::array<float,2>{0.900589228f, 0.616568327f},
-std::array<float,2>{0.0489736237f, 0.937025189f},
-std::array<float,2>{0.614807069f, 0.413074046f},
-std::array<float,2>{0.398701668f, 0.462899894f},
-std::array<float,2>{0.813457012f, 0.957722604f},
-std::array<float,2>{0.247388363f, 0.545332909f},
-std::array<float,2>{0.739448369f, 0.172646314f},
-std::array<float,2>{0.0968443379f, 0.111058705f},
-std::array<float,2>{0.506044507f, 0.659439206f},
-std::array<float,2>{0.372607112f, 0.871702611f},
-std::array<float,2>{0.994976759f, 0.325050235f},
-std::array<float,2>{0.0267389119f, 0.381250918f},
-std::array<float,2>{0.589584947f, 0.885457098f},
-std::array<float,2>{0.269647151f, 0.582853973f},
-std::array<float,2>{0.928342879f, 0.216329023f},
-std::array<float,2>{0.464617103f, 0.000551751116f},
-std::array<float,2>{0.753610253f, 0.747423589f},
-std::array<float,2>{0.164097428f, 0.761549532f},
-std::array<float,2>{0.636507213f, 0.263516188f},
-std::array<float,2>{0.327669263f, 0.358065546f},
-std::array<float,2>{0.955626011f, 0.819924951f},
-std::array<float,2>{0.080917716f, 0.639327586f},
-std::array<float,2>{0.540067554f, 0.0677405074f},
-std::array<float,2>{0.199770659f, 0.150277838f},
-std::array<float,2>{0.695475221f, 0.517065823f},
-std::array<float,2>{0.428766489f, 0.996908963f},
-std::array<float,2>{0.84638989f, 0.470817566f},
-std::array<float,2>{0.241295233f, 0.42544359f},
-std::array<float,2>{0.746450067f, 0.912782729f},
-std::array<float,2>{0.396569937f, 0.601272106f},
-std::array<float,2>{0.821243942f, 0.24515745f},
-std::array<float,2>{0.362858444f, 0.0585582294f},
-std::array<float,2>{0.989489734f, 0.69709307f},
-std::array<float,2>{0.104869865f, 0.793420553f},
-std::array<float,2>{0.507895708f, 0.311909884f},
-std::array<float,2>{0.473278165f, 0.331793785f},
-std::array<float,2>{0.803128779f, 0.845964432f},
-std::array<float,2>{0.134083599f, 0.673844397f},
-std::array<float,2>{0.667622566f, 0.0995231941f},
-std::array<float,2>{0.0623835661f, 0.170734972f},
-std::array<float,2>{0.622240841f, 0.55018127f},
-std::array<float,2>{0.305610061f, 0.938699961f},
-std::array<float,2>{0.892783403f, 0.450537592f},
-std::array<float,2>{0.0885917544f, 0.272629082f},
-std::array<float,2>{0.531375885f, 0.766189694f},
-std::array<float,2>{0.319733411f, 0.730991304f},
-std::array<float,2>{0.965972185f, 0.0247550122f},
-std::array<float,2>{0.432595909f, 0.201261297f},
-std::array<float,2>{0.857836008f, 0.571644902f},
-std::array<float,2>{0.191446707f, 0.899698198f},
-std::array<float,2>{0.687695742f, 0.402090311f},
-std::array<float,2>{0.277163118f, 0.496252805f},
-std::array<float,2>{0.930059373f, 0.979596496f},
-std::array<float,2>{0.0200792402f, 0.508021116f},
-std::array<float,2>{0.579527199f, 0.131808296f},
-std::array<float,2>{0.159579813f, 0.0932323709f},
-std::array<float,2>{0.630661607f, 0.651644647f},
-std::array<float,2>{0.458097726f, 0.833282351f},
-std::array<float,2>{0.759569407f, 0.360481024f},
-std::array<float,2>{0.150716558f, 0.35518533f},
-std::array<float,2>{0.673369288f, 0.81309998f},
-std::array<float,2>{0.494795561f, 0.633973062f},
-std::array<float,2>{0.790242374f, 0.0642608628f},
-std::array<float,2>{0.286109418f, 0.154864296f},
-std::array<float,2>{0.889488697f, 0.520257652f},
-std::array<float,2>{0.0343685783f, 0.995897949f},
-std::array<float,2>{0.600172698f, 0.473786563f},
-std::array<float,2>{0.382744551f, 0.378056049f},
-std::array<float,2>{0.828712583f, 0.886915505f},
-std::array<float,2>{0.233652011f, 0.580804646f},
-std::array<float,2>{0.724139333f, 0.212603465f},
-std::array<float,2>{0.11461547f, 0.00530817267f},
-std::array<float,2>{0.52115202f, 0.74473232f},
-std::array<float,2>{0.346774995f, 0.764312983f},
-std::array<float,2>{0.981786549f, 0.261157453f},
-std::array<float,2>{0.0135337636f, 0.46693182f},
-std::array<float,2>{0.564177811f, 0.956137538f},
-std::array<float,2>{0.258199364f, 0.541350365f},
-std::array<float,2>{0.918500781f, 0.179008141f},
-std::array<float,2>{0.453103632f, 0.115557149f},
-std::array<float,2>{0.779858947f, 0.660753965f},
-std::array<float,2>{0.175202683f, 0.867717326f},
-std::array<float,2>{0.641114652f, 0.321801633f},
-std::array<float,2>{0.331893027f, 0.283067256f},
-std::array<float,2>{0.952342808f, 0.802838206f},
-std::array<float,2>{0.0636297911f, 0.706260979f},
-std::array<float,2>{0.55557394f, 0.0332724713f},
-std::array<float,2>{0.218658015f, 0.231156319f},
-std::array<float,2>{0.705796659f, 0.612437904f},
-std::array<float,2>{0.406306118f, 0.933235407f},
-std::array<float,2>{0.863490582f, 0.40945071f},
-std::array<float,2>{0.186309129f, 0.480993837f},
-std::array<float,2>{0.65512526f, 0.991305649f},
-std::array<float,2>{0.441172242f, 0.523941875f},
-std::array<float,2>{0.771007299f, 0.146790192f},
-std::array<float,2>{0.253598213f, 0.0734344721f},
-std::array<float,2>{0.910613179f, 0.625946999f},
-std::array<float,2>{0.00332144974f, 0.826686263f},
-std::array<float,2>{0.573150754f, 0.344457567f},
-std::array<float,2>{0.418569744f, 0.255595386f},
-std::array<float,2>{0.867409348f, 0.751230419f},
-std::array<float,2>{0.206528902f, 0.741009653f},
-std::array<float,2>{0.717664421f, 0.0113101322f},
-std::array<float,2>{0.0720305219f, 0.209727809f},
-std::array<float,2>{0.55294466f, 0.590522766f},
-std::array<float,2>{0.33905071f, 0.881833494f},
-std::array<float,2>{0.939606428f, 0.389191389f},
-std::array<float,2>{0.0402628593f, 0.313019574f},
-std::array<float,2>{0.605104029f, 0.862922072f},
-std::array<float,2>{0.294958562f, 0.664681852f},
-std::array<float,2>{0.880330384f, 0.117712639f},
-std::array<float,2>{0.491751254f, 0.186510414f},
-std::array<float,2>{0.786912501f, 0.532754064f},
-std::array<float,2>{0.147665948f, 0.963445544f},
-std::array<float,2>{0.682917237f, 0.460471541f},
-std::array<float,2>{0.358622581f, 0.414439678f},
-std::array<float,2>{0.969788373f, 0.928673506f},
-std::array<float,2>{0.124251634f, 0.624304473f},
-std::array<float,2>{0.530012608f, 0.220083386f},
-std::array<float,2>{0.223659709f, 0.0456031859f},
-std::array<float,2>{0.732151151f, 0.711941361f},
-std::array<float,2>{0.384546548f, 0.806746602f},
-std::array<float,2>{0.840523839f, 0.289067358f},
-std::array<float,2>{0.195549056f, 0.297668993f},
-std::array<float,2>{0.702168643f, 0.786448002f},
-std::array<float,2>{0.422608376f, 0.688674569f},
-std::array<float,2>{0.851116121f, 0.0497114137f},
-std::array<float,2>{0.322975665f, 0.238038838f},
-std::array<float,2>{0.95719403f, 0.608742297f},
-std::array<float,2>{0.0833030343f, 0.921373069f},
-std::array<float,2>{0.543925285f, 0.432237625f},
-std::array<float,2>{0.466335386f, 0.443594545f},
-std::array<float,2>{0.755821228f, 0.950617552f},
-std::array<float,2>{0.169883698f, 0.558158755f},
-std::array<float,2>{0.637016773f, 0.162305534f},
-std::array<float,2>{0.0286208186f, 0.105423979f},
-std::array<float,2>{0.592453063f, 0.685323536f},
-std::array<float,2>{0.268443346f, 0.858499706f},
-std::array<float,2>{0.924263537f, 0.339111745f},
-std::array<float,2>{0.101202898f, 0.392964512f},
-std::array<float,2>{0.501847029f, 0.894601524f},
-std::array<float,2>{0.367853761f, 0.569592535f},
-std::array<float,2>{0.999341011f, 0.187736094f},
-std::array<float,2>{0.404810846f, 0.0231058076f},
-std::array<float,2>{0.819691837f, 0.726290226f},
-std::array<float,2>{0.242518321f, 0.778369129f},
-std::array<float,2>{0.734853387f, 0.276367903f},
-std::array<float,2>{0.302291811f, 0.368066251f},
-std::array<float,2>{0.905683815f, 0.841473699f},
-std::array<float,2>{0.0509644784f, 0.640692532f},
-std::array<float,2>{0.611419737f, 0.083838135f},
-std::array<float,2>{0.129664391f, 0.136559248f},
-std::array<float,2>{0.657680869f, 0.502347112f},
-std::array<float,2>{0.479712367f, 0.969722092f},
-std::array<float,2>{0.81176722f, 0.486112982f},
-std::array<float,2>{0.137657493f, 0.386117935f},
-std::array<float,2>{0.669295728f, 0.87633884f},
-std::array<float,2>{0.469300956f, 0.588938057f},
-std::array<float,2>{0.799023092f, 0.206807986f},
-std::array<float,2>{0.310919851f, 0.0152964713f},
-std::array<float,2>{0.897507727f, 0.735347211f},
-std::array<float,2>{0.056749329f, 0.7565611f},
-std::array<float,2>{0.619764447f, 0.25263381f},
-std::array<float,2>{0.393894047f, 0.347807109f},
-std::array<float,2>{0.825024009f, 0.823278666f},
-std::array<float,2>{0.236831054f, 0.63221395f},
-std::array<float,2>{0.744736493f, 0.0763508379f},
-std::array<float,2>{0.109158024f, 0.143126503f},
-std::array<float,2>{0.511908054f, 0.527935982f},
-std::array<float,2>{0.367090017f, 0.986099005f},
-std::array<float,2>{0.984396875f, 0.47791633f},
-std::array<float,2>{0.0188209917f, 0.296010792f},
-std::array<float,2>{0.584272861f, 0.812458456f},
-std::array<float,2>{0.280911803f, 0.715710223f},
-std::array<float,2>{0.936486244f, 0.0426180512f},
-std::array<float,2>{0.455082715f, 0.223576918f},
-std::array<float,2>{0.762708664f, 0.617398262f},
-std::array<float,2>{0.162445053f, 0.922899783f},
-std::array<float,2>{0.626762927f, 0.419721514f},
-std::array<float,2>{0.314644128f, 0.454641521f},
-std::array<float,2>{0.962797821f, 0.964951098f},
-std::array<float,2>{0.0917045176f, 0.537263036f},
-std::array<float,2>{0.538695157f, 0.18102102f},
-std::array<float,2>{0.189965323f, 0.121696949f},
-std::array<float,2>{0.692372978f, 0.670273244f},
-std::array<float,2>{0.436058372f, 0.865530789f},
-std::array<float,2>{0.853715658f, 0.319337189f},
-std::array<float,2>{0.228345394f, 0.341418475f},
-std::array<float,2>{0.722283781f, 0.851902902f},
-std::array<float,2>{0.3752684f, 0.681589663f},
-std::array<float,2>{0.835398197f, 0.106939279f},
-std::array<float,2>{0.348605186f, 0.160143495f},
-std::array<float,2>{0.977652967f, 0.559686005f},
-std::array<float,2>{0.112269767f, 0.947814286f},
-std::array<float,2>{0.518732309f, 0.437628984f},
-std::array<float,2>{0.499249458f, 0.43566975f},
-std::array<float,2>{0.794833422f, 0.915534735f},
-std::array<float,2>{0.152909786f, 0.603526354f},
-std::array<float,2>{0.677934587f, 0.240256876f},
-std::array<float,2>{0.0355225243f, 0.0531596169f},
-std::array<float,2>{0.596518397f, 0.694528461f},
-std::array<float,2>{0.28364557f, 0.784885705f},
-std::array<float,2>{0.886324227f, 0.30380857f},
-std::array<float,2>{0.067430675f, 0.49053213f},
-std::array<float,2>{0.559832394f, 0.974830985f},
-std::array<float,2>{0.334174424f, 0.503941536f},
-std::array<float,2>{0.948769748f, 0.139682814f},
-std::array<float,2>{0.410892576f, 0.0798454508f},
-std::array<float,2>{0.862042725f, 0.644567072f},
-std::array<float,2>{0.211864159f, 0.838436127f},
-std::array<float,2>{0.709523916f, 0.373021245f},
-std::array<float,2>{0.261880785f, 0.277973294f},
-std::array<float,2>{0.916198313f, 0.774097145f},
-std::array<float,2>{0.00923668873f, 0.720735312f},
-std::array<float,2>{0.568528593f, 0.0182726514f},
-std::array<float,2>{0.179426953f, 0.193685964f},
-std::array<float,2>{0.64505744f, 0.563406408f},
-std::array<float,2>{0.445810318f, 0.894180775f},
-std::array<float,2>{0.775122106f, 0.398381859f},
-std::array<float,2>{0.209876195f, 0.447351456f},
-std::array<float,2>{0.711885631f, 0.942988276f},
-std::array<float,2>{0.415372401f, 0.554010153f},
-std::array<float,2>{0.874293983f, 0.167901069f},
-std::array<float,2>{0.340936512f, 0.0958304405f},
-std::array<float,2>{0.941454053f, 0.67821902f},
-std::array<float,2>{0.074298203f, 0.848191082f},
-std::array<float,2>{0.5503878f, 0.333469152f},
-std::array<float,2>{0.442473918f, 0.304970831f},
-std::array<float,2>{0.76725769f, 0.791887462f},
-std::array<float,2>{0.180983022f, 0.701115131f},
-std::array<float,2>{0.64988631f, 0.0616552383f},
-std::array<float,2>{0.00438311463f, 0.247775704f},
-std::array<float,2>{0.577502668f, 0.596715093f},
-std::array<float,2>{0.253936052f, 0.906267881f},
-std::array<float,2>{0.907495856f, 0.427743077f},
-std::array<float,2>{0.120328851f, 0.364145607f},
-std::array<float,2>{0.525221705f, 0.831551313f},
-std::array<float,2>{0.355386972f, 0.655511439f},
-std::array<float,2>{0.973326266f, 0.086574994f},
-std::array<float,2>{0.38806209f, 0.125072643f},
-std::array<float,2>{0.838954151f, 0.512562215f},
-std::array<float,2>{0.219024688f, 0.984033167f},
-std::array<float,2>{0.729337275f, 0.49418354f},
-std::array<float,2>{0.292117387f, 0.405677348f},
-std::array<float,2>{0.877821505f, 0.905565143f},
-std::array<float,2>{0.0430683084f, 0.575412929f},
-std::array<float,2>{0.606230736f, 0.195336774f},
-std::array<float,2>{0.142224461f, 0.0301886536f},
-std::array<float,2>{0.687138736f, 0.729153931f},
-std::array<float,2>{0.486616254f, 0.771784663f},
-std::array<float,2>{0.784764528f, 0.268934786f},
-std::array<float,2>{0.167295143f, 0.264119685f},
-std::array<float,2>{0.633583069f, 0.759601772f},
-std::array<float,2>{0.462704659f, 0.74934411f},
-std::array<float,2>{0.750635743f, 0.00331318588f},
-std::array<float,2>{0.271532893f, 0.217952639f},
-std::array<float,2>{0.927597821f, 0.585361063f},
-std::array<float,2>{0.0240598321f, 0.884448946f},
-std::array<float,2>{0.586671114f, 0.38056013f},
-std::array<float,2>{0.426079631f, 0.47052303f},
-std::array<float,2>{0.844479144f, 0.999467254f},
-std::array<float,2>{0.201659739f, 0.517578959f},
-std::array<float,2>{0.697891176f, 0.152150318f},
-std::array<float,2>{0.0793517306f, 0.0688641146f},
-std::array<float,2>{0.541727126f, 0.636771739f},
-std::array<float,2>{0.325924754f, 0.817682147f},
-std::array<float,2>{0.954992831f, 0.357278645f},
-std::array<float,2>{0.0475046895f, 0.410205603f},
-std::array<float,2>{0.616311908f, 0.934263408f},
-std::array<float,2>{0.298992753f, 0.614765584f},
-std::array<float,2>{0.899118662f, 0.229070172f},
-std::array<float,2>{0.482191443f, 0.0372946635f},
-std::array<float,2>{0.806146681f, 0.709430933f},
-std::array<float,2>{0.128367662f, 0.796974838f},
-std::array<float,2>{0.661280811f, 0.285573423f},
-std::array<float,2>{0.374336481f, 0.327901483f},
-std::array<float,2>{0.993156731f, 0.874628067f},
-std::array<float,2>{0.09524744f, 0.65627414f},
-std::array<float,2>{0.504692256f, 0.112515226f},
-std::array<float,2>{0.248329133f, 0.175715253f},
-std::array<float,2>{0.741128325f, 0.54423517f},
-std::array<float,2>{0.400962979f, 0.960883379f},
-std::array<float,2>{0.816178679f, 0.461184978f},
-std::array<float,2>{0.233279318f, 0.375726402f},
-std::array<float,2>{0.722869158f, 0.890014052f},
-std::array<float,2>{0.381643087f, 0.579750478f},
-std::array<float,2>{0.829679847f, 0.213553444f},
-std::array<float,2>{0.346281856f, 0.00590736093f},
-std::array<float,2>{0.980558634f, 0.743208945f},
-std::array<float,2>{0.113989182f, 0.762279153f},
-std::array<float,2>{0.519661665f, 0.259656608f},
-std::array<float,2>{0.495401561f, 0.352467418f},
-std::array<float,2>{0.789953113f, 0.815507412f},
-std::array<float,2>{0.151721403f, 0.635493457f},
-std::array<float,2>{0.672601759f, 0.0655278862f},
-std::array<float,2>{0.0339373946f, 0.153639719f},
-std::array<float,2>{0.60149473f, 0.522463977f},
-std::array<float,2>{0.286927938f, 0.992496371f},
-std::array<float,2>{0.889925063f, 0.476473808f},
-std::array<float,2>{0.0631187186f, 0.284281701f},
-std::array<float,2>{0.5562675f, 0.801129162f},
-std::array<float,2>{0.330750525f, 0.704069495f},
-std::array<float,2>{0.951573908f, 0.0320037231f},
-std::array<float,2>{0.407673568f, 0.232950211f},
-std::array<float,2>{0.864639878f, 0.611212432f},
-std::array<float,2>{0.217523441f, 0.929863036f},
-std::array<float,2>{0.706375837f, 0.407769263f},
-std::array<float,2>{0.259611905f, 0.465488374f},
-std::array<float,2>{0.919725895f, 0.953982472f},
-std::array<float,2>{0.0123550948f, 0.540375531f},
-std::array<float,2>{0.562890112f, 0.176761374f},
-std::array<float,2>{0.174264833f, 0.11367166f},
-std::array<float,2>{0.641832948f, 0.663996577f},
-std::array<float,2>{0.451423645f, 0.870972693f},
-std::array<float,2>{0.781080246f, 0.322953731f},
-std::array<float,2>{0.133788586f, 0.32938984f},
-std::array<float,2>{0.6668607f, 0.843750179f},
-std::array<float,2>{0.474226207f, 0.672876f},
-std::array<float,2>{0.804550111f, 0.101365931f},
-std::array<float,2>{0.306513309f, 0.169648722f},
-std::array<float,2>{0.894131422f, 0.546967387f},
-std::array<float,2>{0.0614085048f, 0.940330625f},
-std::array<float,2>{0.621456623f, 0.452874273f},
-std::array<float,2>{0.39750573f, 0.422506839f},
-std::array<float,2>{0.821666241f, 0.911740422f},
-std::array<float,2>{0.240821034f, 0.599262834f},
-std::array<float,2>{0.747417271f, 0.243555769f},
-std::array<float,2>{0.103881791f, 0.055424802f},
-std::array<float,2>{0.509503961f, 0.69848901f},
-std::array<float,2>{0.36209476f, 0.795498133f},
-std::array<float,2>{0.988361418f, 0.310059547f},
-std::array<float,2>{0.0211068019f, 0.49859795f},
-std::array<float,2>{0.578770995f, 0.978305757f},
-std::array<float,2>{0.276340276f, 0.509822428f},
-std::array<float,2>{0.931402445f, 0.129660636f},
-std::array<float,2>{0.45744428f, 0.0908630341f},
-std::array<float,2>{0.757975459f, 0.648616433f},
-std::array<float,2>{0.158314303f, 0.834588706f},
-std::array<float,2>{0.62931031f, 0.362690479f},
-std::array<float,2>{0.319322407f, 0.270233482f},
-std::array<float,2>{0.965231478f, 0.769497097f},
-std::array<float,2>{0.0891718268f, 0.733822048f},
-std::array<float,2>{0.53248024f, 0.0256256741f},
-std::array<float,2>{0.192480743f, 0.200398743f},
-std::array<float,2>{0.688626409f, 0.573676527f},
-std::array<float,2>{0.433192343f, 0.900603414f},
-std::array<float,2>{0.859227717f, 0.399686664f},
-std::array<float,2>{0.16883418f, 0.443123758f},
-std::array<float,2>{0.637877703f, 0.95175463f},
-std::array<float,2>{0.465600401f, 0.556399584f},
-std::array<float,2>{0.754216015f, 0.160541892f},
-std::array<float,2>{0.268741399f, 0.101967305f},
-std::array<float,2>{0.925321817f, 0.685628176f},
-std::array<float,2>{0.0274310317f, 0.855991304f},
-std::array<float,2>{0.593202889f, 0.336080909f},
-std::array<float,2>{0.423509866f, 0.300456673f},
-std::array<float,2>{0.850104928f, 0.787775695f},
-std::array<float,2>{0.196728468f, 0.690829337f},
-std::array<float,2>{0.701227129f, 0.0471631885f},
-std::array<float,2>{0.0827730373f, 0.235907957f},
-std::array<float,2>{0.544343114f, 0.606323779f},
-std::array<float,2>{0.323851556f, 0.918488383f},
-std::array<float,2>{0.958853662f, 0.429899424f},
-std::array<float,2>{0.0522961728f, 0.37080875f},
-std::array<float,2>{0.612783015f, 0.842013121f},
-std::array<float,2>{0.300994277f, 0.643147469f},
-std::array<float,2>{0.904583573f, 0.0842693299f},
-std::array<float,2>{0.479128987f, 0.134339482f},
-std::array<float,2>{0.811321437f, 0.500509501f},
-std::array<float,2>{0.129894719f, 0.972595394f},
-std::array<float,2>{0.657116175f, 0.487010539f},
-std::array<float,2>{0.368503571f, 0.390641004f},
-std::array<float,2>{0.998952329f, 0.89770925f},
-std::array<float,2>{0.100531854f, 0.567082286f},
-std::array<float,2>{0.500762105f, 0.189703822f},
-std::array<float,2>{0.2432549f, 0.0211452059f},
-std::array<float,2>{0.735632062f, 0.724189341f},
-std::array<float,2>{0.405497134f, 0.779706597f},
-std::array<float,2>{0.819144964f, 0.273688823f},
-std::array<float,2>{0.205328822f, 0.257108063f},
-std::array<float,2>{0.718579531f, 0.753713548f},
-std::array<float,2>{0.419365406f, 0.739436567f},
-std::array<float,2>{0.868971884f, 0.00887144543f},
-std::array<float,2>{0.338273942f, 0.207547247f},
-std::array<float,2>{0.940938711f, 0.591883421f},
-std::array<float,2>{0.0707584471f, 0.879272938f},
-std::array<float,2>{0.553960085f, 0.387079805f},
-std::array<float,2>{0.439825386f, 0.482841998f},
-std::array<float,2>{0.770236671f, 0.98939532f},
-std::array<float,2>{0.18685244f, 0.525654912f},
-std::array<float,2>{0.655869663f, 0.145726308f},
-std::array<float,2>{0.00266909366f, 0.0712097809f},
-std::array<float,2>{0.573671103f, 0.628856242f},
-std::array<float,2>{0.252392143f, 0.824665368f},
-std::array<float,2>{0.912008584f, 0.3472808f},
-std::array<float,2>{0.123672895f, 0.417283297f},
-std::array<float,2>{0.530924201f, 0.926001072f},
-std::array<float,2>{0.357735902f, 0.622107387f},
-std::array<float,2>{0.968822598f, 0.22082977f},
-std::array<float,2>{0.382888943f, 0.0439086407f},
-std::array<float,2>{0.841066837f, 0.713783979f},
-std::array<float,2>{0.223564044f, 0.805408478f},
-std::array<float,2>{0.731181085f, 0.292513847f},
-std::array<float,2>{0.296557605f, 0.316357583f},
-std::array<float,2>{0.879234493f, 0.859681487f},
-std::array<float,2>{0.0398338437f, 0.666784406f},
-std::array<float,2>{0.603807271f, 0.120808274f},
-std::array<float,2>{0.147434801f, 0.185443163f},
-std::array<float,2>{0.682345927f, 0.533841372f},
-std::array<float,2>{0.490341902f, 0.962838471f},
-std::array<float,2>{0.78597784f, 0.458938897f},
-std::array<float,2>{0.154241621f, 0.435123384f},
-std::array<float,2>{0.679682016f, 0.916756034f},
-std::array<float,2>{0.498971999f, 0.603323817f},
-std::array<float,2>{0.793777466f, 0.238330156f},
-std::array<float,2>{0.284764469f, 0.0523922183f},
-std::array<float,2>{0.884904802f, 0.692173719f},
-std::array<float,2>{0.0369117185f, 0.782972634f},
-std::array<float,2>{0.596744835f, 0.301178187f},
-std::array<float,2>{0.376545727f, 0.343454957f},
-std::array<float,2>{0.834412992f, 0.854585826f},
-std::array<float,2>{0.227229893f, 0.681766629f},
-std::array<float,2>{0.720833838f, 0.107725285f},
-std::array<float,2>{0.113087393f, 0.157250151f},
-std::array<float,2>{0.518353343f, 0.56227231f},
-std::array<float,2>{0.349530071f, 0.945931733f},
-std::array<float,2>{0.977468193f, 0.440553606f},
-std::array<float,2>{0.00834397972f, 0.281170189f},
-std::array<float,2>{0.569361925f, 0.776204169f},
-std::array<float,2>{0.263013214f, 0.719033599f},
-std::array<float,2>{0.917812526f, 0.0158307385f},
-std::array<float,2>{0.446890861f, 0.19284521f},
-std::array<float,2>{0.774103284f, 0.566122174f},
-std::array<float,2>{0.17826432f, 0.891542792f},
-std::array<float,2>{0.645657241f, 0.395125836f},
-std::array<float,2>{0.335470945f, 0.488853961f},
-std::array<float,2>{0.948149025f, 0.973917961f},
-std::array<float,2>{0.0665713847f, 0.507367134f},
-std::array<float,2>{0.558979094f, 0.138122216f},
-std::array<float,2>{0.211993158f, 0.0807755664f},
-std::array<float,2>{0.710876465f, 0.64688921f},
-std::array<float,2>{0.411694109f, 0.837351501f},
-std::array<float,2>{0.863130689f, 0.37389487f},
-std::array<float,2>{0.238279402f, 0.350068301f},
-std::array<float,2>{0.746014237f, 0.820477366f},
-std::array<float,2>{0.39347139f, 0.629419506f},
-std::array<float,2>{0.825614393f, 0.0758185536f},
-std::array<float,2>{0.365472317f, 0.140902877f},
-std::array<float,2>{0.986135602f, 0.530235767f},
-std::array<float,2>{0.108302079f, 0.986358643f},
-std::array<float,2>{0.512714982f, 0.479554921f},
-std::array<float,2>{0.470086008f, 0.384124845f},
-std::array<float,2>{0.800426781f, 0.878703415f},
-std::array<float,2>{0.137741014f, 0.587792575f},
-std::array<float,2>{0.668041229f, 0.204549983f},
-std::array<float,2>{0.05824982f, 0.0124235498f},
-std::array<float,2>{0.620387554f, 0.738098919f},
-std::array<float,2>{0.312497973f, 0.754733801f},
-std::array<float,2>{0.89723593f, 0.251450986f},
-std::array<float,2>{0.090011768f, 0.456181079f},
-std::array<float,2>{0.537594557f, 0.966894627f},
-std::array<float,2>{0.315615952f, 0.536469698f},
-std::array<float,2>{0.961202025f, 0.18191655f},
-std::array<float,2>{0.436780274f, 0.123290107f},
-std::array<float,2>{0.855266154f, 0.66817832f},
-std::array<float,2>{0.191319093f, 0.863321841f},
-std::array<float,2>{0.692685664f, 0.317602813f},
-std::array<float,2>{0.279673606f, 0.294074267f},
-std::array<float,2>{0.936791301f, 0.809025407f},
-std::array<float,2>{0.0179562122f, 0.717995465f},
-std::array<float,2>{0.58573848f, 0.0405183509f},
-std::array<float,2>{0.163560599f, 0.224653125f},
-std::array<float,2>{0.625083089f, 0.620911181f},
-std::array<float,2>{0.456288576f, 0.924429655f},
-std::array<float,2>{0.761945367f, 0.420570403f},
-std::array<float,2>{0.202391833f, 0.472066998f},
-std::array<float,2>{0.69908011f, 0.997724354f},
-std::array<float,2>{0.427172691f, 0.516302884f},
-std::array<float,2>{0.845609426f, 0.148687094f},
-std::array<float,2>{0.324326664f, 0.0672097132f},
-std::array<float,2>{0.95348531f, 0.639851272f},
-std::array<float,2>{0.0783900246f, 0.818424106f},
-std::array<float,2>{0.54293561f, 0.358555943f},
-std::array<float,2>{0.461876154f, 0.262277842f},
-std::array<float,2>{0.75100404f, 0.76029861f},
-std::array<float,2>{0.166550517f, 0.746648073f},
-std::array<float,2>{0.634185135f, 0.00117110973f},
-std::array<float,2>{0.0253653042f, 0.215500087f},
-std::array<float,2>{0.587799489f, 0.583827078f},
-std::array<float,2>{0.272902966f, 0.886001289f},
-std::array<float,2>{0.925843894f, 0.382564873f},
-std::array<float,2>{0.0942748562f, 0.326102376f},
-std::array<float,2>{0.505648971f, 0.872322083f},
-std::array<float,2>{0.373582751f, 0.658892751f},
-std::array<float,2>{0.993652225f, 0.109398536f},
-std::array<float,2>{0.40220356f, 0.17372711f},
-std::array<float,2>{0.814896107f, 0.54674834f},
-std::array<float,2>{0.249616817f, 0.958728552f},
-std::array<float,2>{0.742009878f, 0.464403063f},
-std::array<float,2>{0.3002038f, 0.41327247f},
-std::array<float,2>{0.899631083f, 0.936307847f},
-std::array<float,2>{0.0485537648f, 0.6159603f},
-std::array<float,2>{0.616155446f, 0.227125689f},
-std::array<float,2>{0.127272725f, 0.0357735455f},
-std::array<float,2>{0.660767138f, 0.70716089f},
-std::array<float,2>{0.48096174f, 0.799943328f},
-std::array<float,2>{0.80485332f, 0.288090557f},
-std::array<float,2>{0.180302531f, 0.308104694f},
-std::array<float,2>{0.648933709f, 0.789705694f},
-std::array<float,2>{0.441679806f, 0.701348782f},
-std::array<float,2>{0.766382158f, 0.0587771386f},
-std::array<float,2>{0.255803376f, 0.248777881f},
-std::array<float,2>{0.906970024f, 0.59523344f},
-std::array<float,2>{0.00569589389f, 0.908404112f},
-std::array<float,2>{0.576516271f, 0.426622599f},
-std::array<float,2>{0.414624572f, 0.446522862f},
-std::array<float,2>{0.873761177f, 0.94391042f},
-std::array<float,2>{0.210775182f, 0.551079094f},
-std::array<float,2>{0.712138116f, 0.164608181f},
-std::array<float,2>{0.0754739419f, 0.0938558131f},
-std::array<float,2>{0.549782336f, 0.677229285f},
-std::array<float,2>{0.340154529f, 0.850622177f},
-std::array<float,2>{0.94263196f, 0.335754275f},
-std::array<float,2>{0.0446835086f, 0.403086782f},
-std::array<float,2>{0.606471121f, 0.9042539f},
-std::array<float,2>{0.29183346f, 0.578014791f},
-std::array<float,2>{0.878201187f, 0.198446438f},
-std::array<float,2>{0.48741433f, 0.0284002889f},
-std::array<float,2>{0.783773065f, 0.727833629f},
-std::array<float,2>{0.141217217f, 0.771197915f},
-std::array<float,2>{0.686239064f, 0.265670627f},
-std::array<float,2>{0.354451656f, 0.366588086f},
-std::array<float,2>{0.974334836f, 0.828466356f},
-std::array<float,2>{0.119566694f, 0.654242158f},
-std::array<float,2>{0.524197519f, 0.0885594413f},
-std::array<float,2>{0.220438942f, 0.12878868f},
-std::array<float,2>{0.729708314f, 0.514196098f},
-std::array<float,2>{0.387552321f, 0.980509937f},
-std::array<float,2>{0.837948501f, 0.49234876f},
-std::array<float,2>{0.215663016f, 0.408744276f},
-std::array<float,2>{0.703968048f, 0.932515621f},
-std::array<float,2>{0.409264058f, 0.611777604f},
-std::array<float,2>{0.865410149f, 0.232312948f},
-std::array<float,2>{0.32921052f, 0.0344715081f},
-std::array<float,2>{0.950702429f, 0.705355167f},
-std::array<float,2>{0.0649856851f, 0.804408193f},
-std::array<float,2>{0.557565272f, 0.281677127f},
-std::array<float,2>{0.451130182f, 0.321110904f},
-std::array<float,2>{0.778577209f, 0.86817795f},
-std::array<float,2>{0.172964215f, 0.661689043f},
-std::array<float,2>{0.644452155f, 0.116411179f},
-std::array<float,2>{0.0154350819f, 0.177996024f},
-std::array<float,2>{0.565974355f, 0.542134106f},
-std::array<float,2>{0.259958506f, 0.955529749f},
-std::array<float,2>{0.921103001f, 0.468522221f},
-std::array<float,2>{0.116487436f, 0.260430038f},
-std::array<float,2>{0.523308456f, 0.765010297f},
-std::array<float,2>{0.343953878f, 0.745800793f},
-std::array<float,2>{0.982498705f, 0.00469367905f},
-std::array<float,2>{0.379374087f, 0.211213306f},
-std::array<float,2>{0.830348015f, 0.581194341f},
-std::array<float,2>{0.231809527f, 0.888526261f},
-std::array<float,2>{0.72576195f, 0.377693921f},
-std::array<float,2>{0.287483841f, 0.472988009f},
-std::array<float,2>{0.888548255f, 0.994538546f},
-std::array<float,2>{0.0314242803f, 0.520940602f},
-std::array<float,2>{0.598435044f, 0.155520052f},
-std::array<float,2>{0.149331018f, 0.0634135827f},
-std::array<float,2>{0.67506361f, 0.633624136f},
-std::array<float,2>{0.492304087f, 0.813933611f},
-std::array<float,2>{0.792078376f, 0.354465097f},
-std::array<float,2>{0.156673133f, 0.35938397f},
-std::array<float,2>{0.631400585f, 0.832195461f},
-std::array<float,2>{0.460269213f, 0.650859833f},
-std::array<float,2>{0.760538638f, 0.0924737453f},
-std::array<float,2>{0.274208397f, 0.132746249f},
-std::array<float,2>{0.933556974f, 0.509081602f},
-std::array<float,2>{0.0227190126f, 0.97872591f},
-std::array<float,2>{0.581713021f, 0.498027861f},
-std::array<float,2>{0.431222618f, 0.400851667f},
-std::array<float,2>{0.857234597f, 0.898572922f},
-std::array<float,2>{0.193491697f, 0.570864499f},
-std::array<float,2>{0.689947188f, 0.202811658f},
-std::array<float,2>{0.0868915319f, 0.0235984903f},
-std::array<float,2>{0.533253312f, 0.731824756f},
-std::array<float,2>{0.318032533f, 0.766743839f},
-std::array<float,2>{0.96721977f, 0.271763504f},
-std::array<float,2>{0.0590467341f, 0.449290246f},
-std::array<float,2>{0.624096394f, 0.937818646f},
-std::array<float,2>{0.30692625f, 0.549301326f},
-std::array<float,2>{0.891781271f, 0.171234652f},
-std::array<float,2>{0.476423651f, 0.0983503312f},
-std::array<float,2>{0.801474154f, 0.675635695f},
-std::array<float,2>{0.134790048f, 0.8475402f},
-std::array<float,2>{0.664372146f, 0.330637008f},
-std::array<float,2>{0.361124188f, 0.311496049f},
-std::array<float,2>{0.991808832f, 0.794494212f},
-std::array<float,2>{0.102518298f, 0.695824564f},
-std::array<float,2>{0.510376394f, 0.0569736362f},
-std::array<float,2>{0.238926068f, 0.244933233f},
-std::array<float,2>{0.748448968f, 0.600043893f},
-std::array<float,2>{0.3946473f, 0.913117051f},
-std::array<float,2>{0.823533833f, 0.424467236f},
-std::array<float,2>{0.132791623f, 0.485208452f},
-std::array<float,2>{0.658251345f, 0.970003188f},
-std::array<float,2>{0.476913303f, 0.503890514f},
-std::array<float,2>{0.810182929f, 0.134980977f},
-std::array<float,2>{0.302962452f, 0.0827889889f},
-std::array<float,2>{0.903379858f, 0.641780138f},
-std::array<float,2>{0.0536906086f, 0.840529442f},
-std::array<float,2>{0.610702395f, 0.368594974f},
-std::array<float,2>{0.404167295f, 0.275415897f},
-std::array<float,2>{0.817323565f, 0.777498782f},
-std::array<float,2>{0.245948538f, 0.724764347f},
-std::array<float,2>{0.736441851f, 0.021560533f},
-std::array<float,2>{0.098168619f, 0.188798159f},
-std::array<float,2>{0.502913475f, 0.568836272f},
-std::array<float,2>{0.370558411f, 0.896268487f},
-std::array<float,2>{0.996841669f, 0.393980622f},
-std::array<float,2>{0.0304835849f, 0.338573724f},
-std::array<float,2>{0.591526985f, 0.857965052f},
-std::array<float,2>{0.267525226f, 0.684069574f},
-std::array<float,2>{0.921922207f, 0.103661701f},
-std::array<float,2>{0.467424721f, 0.163642317f},
-std::array<float,2>{0.75594157f, 0.556913912f},
-std::array<float,2>{0.171865836f, 0.949279368f},
-std::array<float,2>{0.639515698f, 0.445106983f},
-std::array<float,2>{0.321463168f, 0.432920843f},
-std::array<float,2>{0.960099101f, 0.920013905f},
-std::array<float,2>{0.0849195048f, 0.607661068f},
-std::array<float,2>{0.546850801f, 0.236410961f},
-std::array<float,2>{0.198765084f, 0.049932234f},
-std::array<float,2>{0.700639725f, 0.688135982f},
-std::array<float,2>{0.424828589f, 0.785855889f},
-std::array<float,2>{0.848501623f, 0.298625886f},
-std::array<float,2>{0.225576773f, 0.290387362f},
-std::array<float,2>{0.733104825f, 0.807837725f},
-std::array<float,2>{0.385970205f, 0.711529851f},
-std::array<float,2>{0.842751324f, 0.0467029586f},
-std::array<float,2>{0.356039405f, 0.219620273f},
-std::array<float,2>{0.971990943f, 0.623718619f},
-std::array<float,2>{0.121896356f, 0.92926085f},
-std::array<float,2>{0.528549135f, 0.415414304f},
-std::array<float,2>{0.489079833f, 0.459702462f},
-std::array<float,2>{0.788083196f, 0.964346826f},
-std::array<float,2>{0.145333618f, 0.531525552f},
-std::array<float,2>{0.68068856f, 0.187165022f},
-std::array<float,2>{0.0423881188f, 0.118841693f},
-std::array<float,2>{0.601788938f, 0.66571331f},
-std::array<float,2>{0.294718981f, 0.862072527f},
-std::array<float,2>{0.88163358f, 0.314389795f},
-std::array<float,2>{0.0731595084f, 0.390586257f},
-std::array<float,2>{0.550800502f, 0.882601917f},
-std::array<float,2>{0.336553276f, 0.59108901f},
-std::array<float,2>{0.938828468f, 0.210003585f},
-std::array<float,2>{0.421470046f, 0.00990225095f},
-std::array<float,2>{0.870508313f, 0.741972387f},
-std::array<float,2>{0.204467893f, 0.750321805f},
-std::array<float,2>{0.715153754f, 0.254690796f},
-std::array<float,2>{0.251664639f, 0.34546113f},
-std::array<float,2>{0.913205087f, 0.828021705f},
-std::array<float,2>{0.000833735161f, 0.626823545f},
-std::array<float,2>{0.57181257f, 0.0728339106f},
-std::array<float,2>{0.184041664f, 0.147785962f},
-std::array<float,2>{0.654253721f, 0.524478376f},
-std::array<float,2>{0.438846022f, 0.990750372f},
-std::array<float,2>{0.772721708f, 0.48190254f},
-std::array<float,2>{0.176806137f, 0.397356212f},
-std::array<float,2>{0.648244679f, 0.89310658f},
-std::array<float,2>{0.448956609f, 0.563664973f},
-std::array<float,2>{0.776444912f, 0.194750577f},
-std::array<float,2>{0.264529228f, 0.0194787569f},
-std::array<float,2>{0.915012598f, 0.722418725f},
-std::array<float,2>{0.0104201324f, 0.775050938f},
-std::array<float,2>{0.568060517f, 0.279121101f},
-std::array<float,2>{0.414041549f, 0.37148273f},
-std::array<float,2>{0.859805524f, 0.83936888f},
-std::array<float,2>{0.212904215f, 0.646010578f},
-std::array<float,2>{0.70807451f, 0.0785491243f},
-std::array<float,2>{0.0698855668f, 0.139299393f},
-std::array<float,2>{0.562334955f, 0.505206347f},
-std::array<float,2>{0.332654625f, 0.975805938f},
-std::array<float,2>{0.945462108f, 0.491572171f},
-std::array<float,2>{0.0382805504f, 0.303238571f},
-std::array<float,2>{0.594612122f, 0.783728242f},
-std::array<float,2>{0.28275609f, 0.693644524f},
-std::array<float,2>{0.883679807f, 0.053747844f},
-std::array<float,2>{0.496685296f, 0.241835222f},
-std::array<float,2>{0.796132445f, 0.604772687f},
-std::array<float,2>{0.155443355f, 0.914327919f},
-std::array<float,2>{0.677107632f, 0.437378556f},
-std::array<float,2>{0.350684911f, 0.439044833f},
-std::array<float,2>{0.9790622f, 0.948347509f},
-std::array<float,2>{0.110918172f, 0.558864772f},
-std::array<float,2>{0.515865266f, 0.158394843f},
-std::array<float,2>{0.229788914f, 0.106030315f},
-std::array<float,2>{0.719928205f, 0.680324614f},
-std::array<float,2>{0.377743691f, 0.852673829f},
-std::array<float,2>{0.833878338f, 0.340260327f},
-std::array<float,2>{0.1888569f, 0.31854111f},
-std::array<float,2>{0.693751633f, 0.866820216f},
-std::array<float,2>{0.434635103f, 0.671606541f},
-std::array<float,2>{0.852739811f, 0.122943901f},
-std::array<float,2>{0.313632369f, 0.180148587f},
-std::array<float,2>{0.963809311f, 0.53848815f},
-std::array<float,2>{0.0932284743f, 0.966540039f},
-std::array<float,2>{0.536217213f, 0.453267932f},
-std::array<float,2>{0.454575151f, 0.418616474f},
-std::array<float,2>{0.764208615f, 0.922745883f},
-std::array<float,2>{0.160696566f, 0.618563354f},
-std::array<float,2>{0.628828347f, 0.223672092f},
-std::array<float,2>{0.0166201461f, 0.0415474772f},
-std::array<float,2>{0.58216542f, 0.716738343f},
-std::array<float,2>{0.279046208f, 0.811194479f},
-std::array<float,2>{0.934807122f, 0.295128912f},
-std::array<float,2>{0.106955744f, 0.476575017f},
-std::array<float,2>{0.513994217f, 0.984710634f},
-std::array<float,2>{0.363362789f, 0.528866947f},
-std::array<float,2>{0.986546218f, 0.144051492f},
-std::array<float,2>{0.391512066f, 0.0778354406f},
-std::array<float,2>{0.827691853f, 0.630898178f},
-std::array<float,2>{0.236232221f, 0.822449446f},
-std::array<float,2>{0.743920088f, 0.349322885f},
-std::array<float,2>{0.30941534f, 0.25381878f},
-std::array<float,2>{0.894643307f, 0.75702405f},
-std::array<float,2>{0.05614198f, 0.735470355f},
-std::array<float,2>{0.61869669f, 0.014411781f},
-std::array<float,2>{0.139825627f, 0.205983192f},
-std::array<float,2>{0.67138648f, 0.588648915f},
-std::array<float,2>{0.472335637f, 0.875680566f},
-std::array<float,2>{0.798568785f, 0.385291964f},
-std::array<float,2>{0.246699154f, 0.462020546f},
-std::array<float,2>{0.738709748f, 0.959077835f},
-std::array<float,2>{0.399414331f, 0.543858588f},
-std::array<float,2>{0.814339101f, 0.17475909f},
-std::array<float,2>{0.37152347f, 0.112164617f},
-std::array<float,2>{0.995389402f, 0.657726884f},
-std::array<float,2>{0.0960554183f, 0.873780608f},
-std::array<float,2>{0.507743061f, 0.326283008f},
-std::array<float,2>{0.483248562f, 0.286614865f},
-std::array<float,2>{0.806718528f, 0.798657f},
-std::array<float,2>{0.126318142f, 0.710813522f},
-std::array<float,2>{0.662410438f, 0.038867496f},
-std::array<float,2>{0.0500776879f, 0.230321914f},
-std::array<float,2>{0.613375843f, 0.613565147f},
-std::array<float,2>{0.298796117f, 0.935209751f},
-std::array<float,2>{0.901523113f, 0.411361754f},
-std::array<float,2>{0.0812455565f, 0.355602771f},
-std::array<float,2>{0.539422929f, 0.816791177f},
-std::array<float,2>{0.326496392f, 0.638640106f},
-std::array<float,2>{0.956364751f, 0.0702878982f},
-std::array<float,2>{0.428010732f, 0.150910214f},
-std::array<float,2>{0.84705162f, 0.518779516f},
-std::array<float,2>{0.20072785f, 0.998420894f},
-std::array<float,2>{0.696449578f, 0.469534785f},
-std::array<float,2>{0.270700723f, 0.379341334f},
-std::array<float,2>{0.929406941f, 0.883062661f},
-std::array<float,2>{0.0258993767f, 0.584178686f},
-std::array<float,2>{0.588229239f, 0.217599288f},
-std::array<float,2>{0.165305153f, 0.00201860745f},
-std::array<float,2>{0.635114193f, 0.748090625f},
-std::array<float,2>{0.463605613f, 0.757995367f},
-std::array<float,2>{0.752553046f, 0.264866501f},
-std::array<float,2>{0.142601371f, 0.267809242f},
-std::array<float,2>{0.683942139f, 0.772680402f},
-std::array<float,2>{0.485690534f, 0.730348706f},
-std::array<float,2>{0.781534791f, 0.0306209885f},
-std::array<float,2>{0.290632993f, 0.197214007f},
-std::array<float,2>{0.8754282f, 0.574320018f},
-std::array<float,2>{0.0463122502f, 0.905179679f},
-std::array<float,2>{0.607483208f, 0.404964685f},
-std::array<float,2>{0.390357971f, 0.495714694f},
-std::array<float,2>{0.836090147f, 0.983107269f},
-std::array<float,2>{0.221024364f, 0.513429761f},
-std::array<float,2>{0.72744751f, 0.126820549f},
-std::array<float,2>{0.118717641f, 0.0875101462f},
-std::array<float,2>{0.526821136f, 0.654339314f},
-std::array<float,2>{0.352748126f, 0.830864966f},
-std::array<float,2>{0.975199521f, 0.364438921f},
-std::array<float,2>{0.00619384367f, 0.429422051f},
-std::array<float,2>{0.575583041f, 0.907381237f},
-std::array<float,2>{0.256253988f, 0.595759392f},
-std::array<float,2>{0.909364343f, 0.246273801f},
-std::array<float,2>{0.445016056f, 0.0607069694f},
-std::array<float,2>{0.769325674f, 0.699551165f},
-std::array<float,2>{0.181928188f, 0.792813718f},
-std::array<float,2>{0.652329564f, 0.30572173f},
-std::array<float,2>{0.343078226f, 0.332660139f},
-std::array<float,2>{0.943947554f, 0.849393904f},
-std::array<float,2>{0.0778782889f, 0.679048538f},
-std::array<float,2>{0.547511101f, 0.0971605405f},
-std::array<float,2>{0.208394691f, 0.166151315f},
-std::array<float,2>{0.714551389f, 0.553448319f},
-std::array<float,2>{0.417568922f, 0.941481173f},
-std::array<float,2>{0.871645927f, 0.448923528f},
-std::array<float,2>{0.204897746f, 0.387660801f},
-std::array<float,2>{0.715352952f, 0.87965554f},
-std::array<float,2>{0.4209705f, 0.592328012f},
-std::array<float,2>{0.870834768f, 0.207369924f},
-std::array<float,2>{0.336082548f, 0.00976261217f},
-std::array<float,2>{0.938971937f, 0.739767671f},
-std::array<float,2>{0.0723455697f, 0.753353894f},
-std::array<float,2>{0.551414192f, 0.257378578f},
-std::array<float,2>{0.439333171f, 0.346869469f},
-std::array<float,2>{0.773157299f, 0.824830055f},
-std::array<float,2>{0.184421867f, 0.628112555f},
-std::array<float,2>{0.653371334f, 0.0704739243f},
-std::array<float,2>{0.000409274799f, 0.146459073f},
-std::array<float,2>{0.571754932f, 0.526065826f},
-std::array<float,2>{0.251200855f, 0.990071416f},
-std::array<float,2>{0.91397506f, 0.483372182f},
-std::array<float,2>{0.121125773f, 0.292117089f},
-std::array<float,2>{0.529096425f, 0.804990351f},
-std::array<float,2>{0.355919302f, 0.713151991f},
-std::array<float,2>{0.972295642f, 0.043248523f},
-std::array<float,2>{0.386496156f, 0.221622795f},
-std::array<float,2>{0.841945767f, 0.622829974f},
-std::array<float,2>{0.225070328f, 0.926662743f},
-std::array<float,2>{0.732592821f, 0.417839378f},
-std::array<float,2>{0.29401505f, 0.458078861f},
-std::array<float,2>{0.881243408f, 0.962370396f},
-std::array<float,2>{0.0429242067f, 0.53340739f},
-std::array<float,2>{0.602372348f, 0.184692055f},
-std::array<float,2>{0.144950092f, 0.12055891f},
-std::array<float,2>{0.681346059f, 0.666484177f},
-std::array<float,2>{0.488317221f, 0.860223949f},
-std::array<float,2>{0.787231743f, 0.315662175f},
-std::array<float,2>{0.170919225f, 0.336767346f},
-std::array<float,2>{0.638814986f, 0.855755687f},
-std::array<float,2>{0.466960609f, 0.686294019f},
-std::array<float,2>{0.756473541f, 0.102447174f},
-std::array<float,2>{0.266646653f, 0.161029741f},
-std::array<float,2>{0.922811389f, 0.555766463f},
-std::array<float,2>{0.0308432691f, 0.951494813f},
-std::array<float,2>{0.590854347f, 0.442743987f},
-std::array<float,2>{0.425479829f, 0.430199742f},
-std::array<float,2>{0.847754955f, 0.918314278f},
-std::array<float,2>{0.198671401f, 0.605641425f},
-std::array<float,2>{0.700943172f, 0.235457957f},
-std::array<float,2>{0.0841083005f, 0.0473922826f},
-std::array<float,2>{0.546248198f, 0.691112578f},
-std::array<float,2>{0.322163969f, 0.787209213f},
-std::array<float,2>{0.960596979f, 0.299983501f},
-std::array<float,2>{0.0529317632f, 0.48651728f},
-std::array<float,2>{0.611215055f, 0.972127497f},
-std::array<float,2>{0.303679913f, 0.500257313f},
-std::array<float,2>{0.904130042f, 0.1341068f},
-std::array<float,2>{0.477508605f, 0.0845797434f},
-std::array<float,2>{0.809897959f, 0.642881393f},
-std::array<float,2>{0.131983951f, 0.842654765f},
-std::array<float,2>{0.658746302f, 0.370566189f},
-std::array<float,2>{0.370710343f, 0.274301201f},
-std::array<float,2>{0.996451855f, 0.780003309f},
-std::array<float,2>{0.0979336277f, 0.723683834f},
-std::array<float,2>{0.502193391f, 0.0208692774f},
-std::array<float,2>{0.245584697f, 0.190176204f},
-std::array<float,2>{0.737128854f, 0.566656828f},
-std::array<float,2>{0.403666884f, 0.898417234f},
-std::array<float,2>{0.816422462f, 0.39159897f},
-std::array<float,2>{0.135712445f, 0.452490926f},
-std::array<float,2>{0.664993167f, 0.939928532f},
-std::array<float,2>{0.475873321f, 0.547530115f},
-std::array<float,2>{0.800961852f, 0.168969497f},
-std::array<float,2>{0.307466656f, 0.100887492f},
-std::array<float,2>{0.892202795f, 0.673551142f},
-std::array<float,2>{0.0594928637f, 0.844668865f},
-std::array<float,2>{0.624749184f, 0.329837948f},
-std::array<float,2>{0.395144045f, 0.309984207f},
-std::array<float,2>{0.823896825f, 0.795114636f},
-std::array<float,2>{0.238500968f, 0.699011326f},
-std::array<float,2>{0.748546422f, 0.0548128821f},
-std::array<float,2>{0.102046251f, 0.244075075f},
-std::array<float,2>{0.509950221f, 0.598902345f},
-std::array<float,2>{0.360627651f, 0.91156292f},
-std::array<float,2>{0.991398811f, 0.421962053f},
-std::array<float,2>{0.0231715888f, 0.362879962f},
-std::array<float,2>{0.581447661f, 0.833989978f},
-std::array<float,2>{0.273581386f, 0.649378419f},
-std::array<float,2>{0.932645082f, 0.0915085003f},
-std::array<float,2>{0.460803211f, 0.129103601f},
-std::array<float,2>{0.760061085f, 0.510486722f},
-std::array<float,2>{0.156859249f, 0.977946997f},
-std::array<float,2>{0.631047308f, 0.498048872f},
-std::array<float,2>{0.317425191f, 0.400202125f},
-std::array<float,2>{0.967567861f, 0.9012959f},
-std::array<float,2>{0.0861876979f, 0.573894858f},
-std::array<float,2>{0.533845842f, 0.200883329f},
-std::array<float,2>{0.194033161f, 0.0261656847f},
-std::array<float,2>{0.689849317f, 0.734241784f},
-std::array<float,2>{0.43087396f, 0.768763244f},
-std::array<float,2>{0.856752753f, 0.269573778f},
-std::array<float,2>{0.232127696f, 0.259168833f},
-std::array<float,2>{0.726085365f, 0.761912882f},
-std::array<float,2>{0.37961182f, 0.744027734f},
-std::array<float,2>{0.830640614f, 0.00681733992f},
-std::array<float,2>{0.344664633f, 0.213367388f},
-std::array<float,2>{0.982977331f, 0.579388142f},
-std::array<float,2>{0.116859607f, 0.89013803f},
-std::array<float,2>{0.522673488f, 0.375486225f},
-std::array<float,2>{0.493045062f, 0.476015061f},
-std::array<float,2>{0.792873442f, 0.99289614f},
-std::array<float,2>{0.148455679f, 0.523182929f},
-std::array<float,2>{0.675329924f, 0.154131323f},
-std::array<float,2>{0.0318310969f, 0.0660229102f},
-std::array<float,2>{0.597715795f, 0.635109842f},
-std::array<float,2>{0.287628919f, 0.815985322f},
-std::array<float,2>{0.888004005f, 0.351800352f},
-std::array<float,2>{0.0644868016f, 0.407270133f},
-std::array<float,2>{0.556782961f, 0.930580556f},
-std::array<float,2>{0.329628736f, 0.610661387f},
-std::array<float,2>{0.950481296f, 0.232564315f},
-std::array<float,2>{0.40991348f, 0.0316872858f},
-std::array<float,2>{0.866124451f, 0.703501642f},
-std::array<float,2>{0.214876235f, 0.801457107f},
-std::array<float,2>{0.703437984f, 0.284949422f},
-std::array<float,2>{0.26033175f, 0.322348505f},
-std::array<float,2>{0.921762228f, 0.870564461f},
-std::array<float,2>{0.0148995705f, 0.663354635f},
-std::array<float,2>{0.565789044f, 0.114212535f},
-std::array<float,2>{0.173555702f, 0.177421749f},
-std::array<float,2>{0.643914759f, 0.540884793f},
-std::array<float,2>{0.450559348f, 0.953457832f},
-std::array<float,2>{0.778895259f, 0.465311944f},
-std::array<float,2>{0.182530329f, 0.426100999f},
-std::array<float,2>{0.651419818f, 0.909016132f},
-std::array<float,2>{0.444465488f, 0.595105886f},
-std::array<float,2>{0.768972516f, 0.248513371f},
-std::array<float,2>{0.256511718f, 0.0591530316f},
-std::array<float,2>{0.910146415f, 0.701911986f},
-std::array<float,2>{0.00641041482f, 0.789189696f},
-std::array<float,2>{0.575992882f, 0.308576018f},
-std::array<float,2>{0.417162001f, 0.335117877f},
-std::array<float,2>{0.871170878f, 0.851161003f},
-std::array<float,2>{0.20858027f, 0.677269399f},
-std::array<float,2>{0.713919878f, 0.0946343094f},
-std::array<float,2>{0.0773601308f, 0.164518535f},
-std::array<float,2>{0.547097683f, 0.551346362f},
-std::array<float,2>{0.343712568f, 0.943430603f},
-std::array<float,2>{0.943652809f, 0.446899861f},
-std::array<float,2>{0.0464335084f, 0.26619333f},
-std::array<float,2>{0.60826093f, 0.770849466f},
-std::array<float,2>{0.290384412f, 0.728237331f},
-std::array<float,2>{0.875832498f, 0.0290442854f},
-std::array<float,2>{0.486047268f, 0.198978409f},
-std::array<float,2>{0.78200388f, 0.577206492f},
-std::array<float,2>{0.143279269f, 0.903542638f},
-std::array<float,2>{0.684283912f, 0.402470499f},
-std::array<float,2>{0.353327006f, 0.493125409f},
-std::array<float,2>{0.974728048f, 0.981213212f},
-std::array<float,2>{0.11824055f, 0.513837218f},
-std::array<float,2>{0.527051091f, 0.128010169f},
-std::array<float,2>{0.221423134f, 0.0878913477f},
-std::array<float,2>{0.726953864f, 0.653482378f},
-std::array<float,2>{0.390130252f, 0.828702569f},
-std::array<float,2>{0.836651623f, 0.366883397f},
-std::array<float,2>{0.200652137f, 0.359311938f},
-std::array<float,2>{0.696895003f, 0.818862736f},
-std::array<float,2>{0.428289175f, 0.640339434f},
-std::array<float,2>{0.847177625f, 0.0666551068f},
-std::array<float,2>{0.326851249f, 0.149093196f},
-std::array<float,2>{0.956822753f, 0.515658855f},
-std::array<float,2>{0.0819314048f, 0.997179449f},
-std::array<float,2>{0.539907515f, 0.472379178f},
-std::array<float,2>{0.463024139f, 0.382029355f},
-std::array<float,2>{0.752290487f, 0.886709809f},
-std::array<float,2>{0.165906161f, 0.583431005f},
-std::array<float,2>{0.635310471f, 0.214868337f},
-std::array<float,2>{0.0255566705f, 0.00190311018f},
-std::array<float,2>{0.588647246f, 0.746528447f},
-std::array<float,2>{0.271231234f, 0.760138929f},
-std::array<float,2>{0.92911458f, 0.262140036f},
-std::array<float,2>{0.0962478146f, 0.464167684f},
-std::array<float,2>{0.507288277f, 0.958476841f},
-std::array<float,2>{0.371753007f, 0.546111703f},
-std::array<float,2>{0.995984495f, 0.173211589f},
-std::array<float,2>{0.400208145f, 0.109918877f},
-std::array<float,2>{0.813734353f, 0.658537567f},
-std::array<float,2>{0.246385619f, 0.872770309f},
-std::array<float,2>{0.739023626f, 0.325356007f},
-std::array<float,2>{0.298257828f, 0.288574398f},
-std::array<float,2>{0.901939034f, 0.800761104f},
-std::array<float,2>{0.05070832f, 0.707606316f},
-std::array<float,2>{0.613836646f, 0.0355616324f},
-std::array<float,2>{0.126844823f, 0.226765305f},
-std::array<float,2>{0.662780702f, 0.615357637f},
-std::array<float,2>{0.48268047f, 0.93590343f},
-std::array<float,2>{0.807197809f, 0.41367349f},
-std::array<float,2>{0.235429406f, 0.480050474f},
-std::array<float,2>{0.743229091f, 0.98698473f},
-std::array<float,2>{0.390659839f, 0.529466629f},
-std::array<float,2>{0.827482045f, 0.141191632f},
-std::array<float,2>{0.363800645f, 0.0753364712f},
-std::array<float,2>{0.987258017f, 0.62935102f},
-std::array<float,2>{0.106865622f, 0.820926189f},
-std::array<float,2>{0.514176905f, 0.350569457f},
-std::array<float,2>{0.471793801f, 0.25192526f},
-std::array<float,2>{0.797996759f, 0.754095852f},
-std::array<float,2>{0.140466973f, 0.737588704f},
-std::array<float,2>{0.671660423f, 0.0121793719f},
-std::array<float,2>{0.0564363189f, 0.204712793f},
-std::array<float,2>{0.618547678f, 0.587049127f},
-std::array<float,2>{0.30907613f, 0.877945781f},
-std::array<float,2>{0.895212889f, 0.384359837f},
-std::array<float,2>{0.093663685f, 0.317916632f},
-std::array<float,2>{0.5369941f, 0.863879859f},
-std::array<float,2>{0.314266145f, 0.668558002f},
-std::array<float,2>{0.963017881f, 0.123791605f},
-std::array<float,2>{0.435510755f, 0.182406396f},
-std::array<float,2>{0.853237271f, 0.537012458f},
-std::array<float,2>{0.189443916f, 0.96754837f},
-std::array<float,2>{0.694275081f, 0.456953138f},
-std::array<float,2>{0.278625578f, 0.420173168f},
-std::array<float,2>{0.935216486f, 0.923895895f},
-std::array<float,2>{0.0173748024f, 0.620440722f},
-std::array<float,2>{0.583006144f, 0.225268245f},
-std::array<float,2>{0.160635501f, 0.0410139076f},
-std::array<float,2>{0.628085375f, 0.718556225f},
-std::array<float,2>{0.454967648f, 0.809502304f},
-std::array<float,2>{0.763790548f, 0.294882715f},
-std::array<float,2>{0.155969813f, 0.301468104f},
-std::array<float,2>{0.67749244f, 0.782358885f},
-std::array<float,2>{0.49650386f, 0.691891611f},
-std::array<float,2>{0.796576262f, 0.0517720655f},
-std::array<float,2>{0.282608509f, 0.238851503f},
-std::array<float,2>{0.883116782f, 0.602651238f},
-std::array<float,2>{0.0390566215f, 0.916349769f},
-std::array<float,2>{0.594090641f, 0.435047597f},
-std::array<float,2>{0.377433032f, 0.441277355f},
-std::array<float,2>{0.833339393f, 0.945669353f},
-std::array<float,2>{0.230172575f, 0.561537325f},
-std::array<float,2>{0.720424235f, 0.157877326f},
-std::array<float,2>{0.110538155f, 0.108348295f},
-std::array<float,2>{0.516557574f, 0.682349205f},
-std::array<float,2>{0.351544321f, 0.855074942f},
-std::array<float,2>{0.978966713f, 0.342788458f},
-std::array<float,2>{0.00982088223f, 0.394798249f},
-std::array<float,2>{0.567846715f, 0.890781879f},
-std::array<float,2>{0.263719052f, 0.565459371f},
-std::array<float,2>{0.914158225f, 0.193215445f},
-std::array<float,2>{0.448461145f, 0.0163254961f},
-std::array<float,2>{0.776974201f, 0.719286621f},
-std::array<float,2>{0.177436173f, 0.775522828f},
-std::array<float,2>{0.647848248f, 0.280691892f},
-std::array<float,2>{0.332061648f, 0.373173028f},
-std::array<float,2>{0.94605124f, 0.837795794f},
-std::array<float,2>{0.0695111752f, 0.647190511f},
-std::array<float,2>{0.561969757f, 0.0801102594f},
-std::array<float,2>{0.213461071f, 0.138392597f},
-std::array<float,2>{0.708846748f, 0.506909192f},
-std::array<float,2>{0.41334337f, 0.974135518f},
-std::array<float,2>{0.859895885f, 0.488750488f},
-std::array<float,2>{0.223120555f, 0.41570729f},
-std::array<float,2>{0.73093152f, 0.928800285f},
-std::array<float,2>{0.383595049f, 0.623525143f},
-std::array<float,2>{0.841544867f, 0.219061375f},
-std::array<float,2>{0.358329594f, 0.0459518656f},
-std::array<float,2>{0.969529748f, 0.711039484f},
-std::array<float,2>{0.123082504f, 0.808346331f},
-std::array<float,2>{0.530322909f, 0.290540844f},
-std::array<float,2>{0.491072446f, 0.313849598f},
-std::array<float,2>{0.785618782f, 0.861438751f},
-std::array<float,2>{0.14666453f, 0.665330708f},
-std::array<float,2>{0.681995273f, 0.118227452f},
-std::array<float,2>{0.0395439714f, 0.18671447f},
-std::array<float,2>{0.604005992f, 0.531843543f},
-std::array<float,2>{0.296281159f, 0.964699388f},
-std::array<float,2>{0.879460812f, 0.459373951f},
-std::array<float,2>{0.0711392611f, 0.254103631f},
-std::array<float,2>{0.554659784f, 0.750706613f},
-std::array<float,2>{0.338460565f, 0.741466522f},
-std::array<float,2>{0.94050318f, 0.0105862329f},
-std::array<float,2>{0.419889688f, 0.210655108f},
-std::array<float,2>{0.868473351f, 0.591451228f},
-std::array<float,2>{0.20573023f, 0.882107258f},
-std::array<float,2>{0.718166769f, 0.390049309f},
-std::array<float,2>{0.252750903f, 0.482147843f},
-std::array<float,2>{0.91119647f, 0.990452707f},
-std::array<float,2>{0.00225542858f, 0.525065362f},
-std::array<float,2>{0.573778391f, 0.147987098f},
-std::array<float,2>{0.187416255f, 0.0724267438f},
-std::array<float,2>{0.655551553f, 0.626163423f},
-std::array<float,2>{0.440030575f, 0.827461362f},
-std::array<float,2>{0.769956946f, 0.344936132f},
-std::array<float,2>{0.130754396f, 0.368830442f},
-std::array<float,2>{0.656491876f, 0.83984679f},
-std::array<float,2>{0.478747874f, 0.642102897f},
-std::array<float,2>{0.810746253f, 0.082099162f},
-std::array<float,2>{0.301623732f, 0.135380998f},
-std::array<float,2>{0.905148387f, 0.502943635f},
-std::array<float,2>{0.0520065054f, 0.97058481f},
-std::array<float,2>{0.613237321f, 0.484568775f},
-std::array<float,2>{0.406126648f, 0.394387454f},
-std::array<float,2>{0.818508267f, 0.89578259f},
-std::array<float,2>{0.243982419f, 0.568990469f},
-std::array<float,2>{0.736135185f, 0.189116865f},
-std::array<float,2>{0.0999918953f, 0.0220473725f},
-std::array<float,2>{0.500373483f, 0.725431919f},
-std::array<float,2>{0.369087517f, 0.778029799f},
-std::array<float,2>{0.998530388f, 0.27626726f},
-std::array<float,2>{0.028152423f, 0.444535613f},
-std::array<float,2>{0.593622625f, 0.949988306f},
-std::array<float,2>{0.269258857f, 0.557355404f},
-std::array<float,2>{0.925096452f, 0.163127154f},
-std::array<float,2>{0.465236008f, 0.104473725f},
-std::array<float,2>{0.754856944f, 0.684492707f},
-std::array<float,2>{0.167975247f, 0.857595742f},
-std::array<float,2>{0.638663232f, 0.338305175f},
-std::array<float,2>{0.323380888f, 0.297999233f},
-std::array<float,2>{0.958152235f, 0.785497427f},
-std::array<float,2>{0.0824891254f, 0.687688053f},
-std::array<float,2>{0.544639528f, 0.0505200513f},
-std::array<float,2>{0.196873575f, 0.236833677f},
-std::array<float,2>{0.701892138f, 0.608171105f},
-std::array<float,2>{0.422993898f, 0.920470357f},
-std::array<float,2>{0.84976995f, 0.433490217f},
-std::array<float,2>{0.158862531f, 0.497075707f},
-std::array<float,2>{0.629528165f, 0.979288697f},
-std::array<float,2>{0.457947314f, 0.509428501f},
-std::array<float,2>{0.758431554f, 0.132098392f},
-std::array<float,2>{0.275788784f, 0.0920419767f},
-std::array<float,2>{0.930927813f, 0.651001811f},
-std::array<float,2>{0.0205762386f, 0.832622766f},
-std::array<float,2>{0.578277647f, 0.360271335f},
-std::array<float,2>{0.433068186f, 0.272235066f},
-std::array<float,2>{0.858730197f, 0.767538965f},
-std::array<float,2>{0.192887634f, 0.731981039f},
-std::array<float,2>{0.689086199f, 0.0243754573f},
-std::array<float,2>{0.0895746797f, 0.20254381f},
-std::array<float,2>{0.533081353f, 0.570423424f},
-std::array<float,2>{0.318408906f, 0.899212599f},
-std::array<float,2>{0.965484798f, 0.4009552f},
-std::array<float,2>{0.0606687702f, 0.330377758f},
-std::array<float,2>{0.621848345f, 0.847048521f},
-std::array<float,2>{0.305827051f, 0.675238013f},
-std::array<float,2>{0.893607795f, 0.0980378464f},
-std::array<float,2>{0.473910332f, 0.171776459f},
-std::array<float,2>{0.804014981f, 0.549780726f},
-std::array<float,2>{0.132853329f, 0.938104153f},
-std::array<float,2>{0.66634804f, 0.450069666f},
-std::array<float,2>{0.361332953f, 0.423872709f},
-std::array<float,2>{0.98878336f, 0.913711727f},
-std::array<float,2>{0.104231536f, 0.600509346f},
-std::array<float,2>{0.509219825f, 0.244273007f},
-std::array<float,2>{0.240266085f, 0.0573156029f},
-std::array<float,2>{0.747776568f, 0.695748091f},
-std::array<float,2>{0.39831835f, 0.794004261f},
-std::array<float,2>{0.822223544f, 0.310828328f},
-std::array<float,2>{0.217077151f, 0.281841069f},
-std::array<float,2>{0.706571817f, 0.803878129f},
-std::array<float,2>{0.407778472f, 0.705951333f},
-std::array<float,2>{0.864795148f, 0.0348729827f},
-std::array<float,2>{0.330471456f, 0.231888294f},
-std::array<float,2>{0.951776505f, 0.612083197f},
-std::array<float,2>{0.0629206747f, 0.931862295f},
-std::array<float,2>{0.5558635f, 0.408639669f},
-std::array<float,2>{0.452075988f, 0.468003243f},
-std::array<float,2>{0.780701697f, 0.955658197f},
-std::array<float,2>{0.174631f, 0.542718887f},
-std::array<float,2>{0.642389774f, 0.178314164f},
-std::array<float,2>{0.0119175836f, 0.11694134f},
-std::array<float,2>{0.563284993f, 0.661436617f},
-std::array<float,2>{0.258829057f, 0.869066656f},
-std::array<float,2>{0.919049621f, 0.320420057f},
-std::array<float,2>{0.113469146f, 0.37701416f},
-std::array<float,2>{0.520222962f, 0.888106763f},
-std::array<float,2>{0.345923066f, 0.5816046f},
-std::array<float,2>{0.981084824f, 0.211606503f},
-std::array<float,2>{0.381074935f, 0.00409351569f},
-std::array<float,2>{0.829467237f, 0.745150924f},
-std::array<float,2>{0.232740298f, 0.765365064f},
-std::array<float,2>{0.723474205f, 0.260187447f},
-std::array<float,2>{0.286498874f, 0.353827417f},
-std::array<float,2>{0.890223682f, 0.814420223f},
-std::array<float,2>{0.0335830599f, 0.633124411f},
-std::array<float,2>{0.600673974f, 0.0625666454f},
-std::array<float,2>{0.151888579f, 0.15591149f},
-std::array<float,2>{0.6722911f, 0.520997226f},
-std::array<float,2>{0.495829374f, 0.994970083f},
-std::array<float,2>{0.789377213f, 0.473501414f},
-std::array<float,2>{0.140847772f, 0.40433082f},
-std::array<float,2>{0.685859263f, 0.90464884f},
-std::array<float,2>{0.487939894f, 0.575010419f},
-std::array<float,2>{0.78362453f, 0.19667539f},
-std::array<float,2>{0.291065484f, 0.0310943089f},
-std::array<float,2>{0.87889725f, 0.729858756f},
-std::array<float,2>{0.0444161259f, 0.773400664f},
-std::array<float,2>{0.607168317f, 0.2685121f},
-std::array<float,2>{0.386756748f, 0.364757985f},
-std::array<float,2>{0.838796794f, 0.830295384f},
-std::array<float,2>{0.220040873f, 0.654869676f},
-std::array<float,2>{0.730421603f, 0.0873473361f},
-std::array<float,2>{0.119938619f, 0.126180291f},
-std::array<float,2>{0.52355206f, 0.512705684f},
-std::array<float,2>{0.35352838f, 0.982794464f},
-std::array<float,2>{0.973663092f, 0.495125562f},
-std::array<float,2>{0.00519364979f, 0.306362748f},
-std::array<float,2>{0.576870501f, 0.792128921f},
-std::array<float,2>{0.255154014f, 0.70017761f},
-std::array<float,2>{0.906550288f, 0.0613254234f},
-std::array<float,2>{0.442369998f, 0.246840864f},
-std::array<float,2>{0.765821218f, 0.59651053f},
-std::array<float,2>{0.179838181f, 0.907748938f},
-std::array<float,2>{0.648732364f, 0.429142803f},
-std::array<float,2>{0.340710282f, 0.448677123f},
-std::array<float,2>{0.943326294f, 0.942258716f},
-std::array<float,2>{0.0761423782f, 0.553219855f},
-std::array<float,2>{0.549280405f, 0.16662547f},
-std::array<float,2>{0.210432112f, 0.097535558f},
-std::array<float,2>{0.712749064f, 0.679606557f},
-std::array<float,2>{0.414127529f, 0.849051356f},
-std::array<float,2>{0.873218417f, 0.332493365f},
-std::array<float,2>{0.249087855f, 0.326782793f},
-std::array<float,2>{0.74158752f, 0.873230159f},
-std::array<float,2>{0.401439786f, 0.657301784f},
-std::array<float,2>{0.815199852f, 0.111583047f},
-std::array<float,2>{0.373411596f, 0.174063817f},
-std::array<float,2>{0.993956149f, 0.543243408f},
-std::array<float,2>{0.0939966515f, 0.959628463f},
-std::array<float,2>{0.504988074f, 0.462604761f},
-std::array<float,2>{0.480570883f, 0.412042171f},
-std::array<float,2>{0.805242181f, 0.935031056f},
-std::array<float,2>{0.127507105f, 0.614225626f},
-std::array<float,2>{0.660305083f, 0.229902476f},
-std::array<float,2>{0.0480346978f, 0.0382860042f},
-std::array<float,2>{0.615544677f, 0.710068166f},
-std::array<float,2>{0.300661504f, 0.797906637f},
-std::array<float,2>{0.900176466f, 0.286809146f},
-std::array<float,2>{0.0788786858f, 0.469088614f},
-std::array<float,2>{0.542328954f, 0.998901069f},
-std::array<float,2>{0.324965537f, 0.519210815f},
-std::array<float,2>{0.954078317f, 0.150556877f},
-std::array<float,2>{0.42732203f, 0.0695061907f},
-std::array<float,2>{0.84518683f, 0.637764156f},
-std::array<float,2>{0.202802643f, 0.817187786f},
-std::array<float,2>{0.698482275f, 0.356266826f},
-std::array<float,2>{0.273406714f, 0.265140653f},
-std::array<float,2>{0.926480532f, 0.758770347f},
-std::array<float,2>{0.0245159194f, 0.748687267f},
-std::array<float,2>{0.58693701f, 0.00262534991f},
-std::array<float,2>{0.166240856f, 0.217278555f},
-std::array<float,2>{0.634531677f, 0.584620059f},
-std::array<float,2>{0.461373359f, 0.883610904f},
-std::array<float,2>{0.751554072f, 0.379516155f},
-std::array<float,2>{0.190729395f, 0.453860968f},
-std::array<float,2>{0.693236768f, 0.966171086f},
-std::array<float,2>{0.43744871f, 0.538918912f},
-std::array<float,2>{0.854878187f, 0.180627063f},
-std::array<float,2>{0.316029221f, 0.122459449f},
-std::array<float,2>{0.961699426f, 0.671357453f},
-std::array<float,2>{0.0905953795f, 0.866517425f},
-std::array<float,2>{0.537602901f, 0.319114596f},
-std::array<float,2>{0.456646264f, 0.295871764f},
-std::array<float,2>{0.762497067f, 0.811016142f},
-std::array<float,2>{0.163845539f, 0.715887487f},
-std::array<float,2>{0.625835538f, 0.0413574465f},
-std::array<float,2>{0.0183560383f, 0.224139214f},
-std::array<float,2>{0.585230291f, 0.618986368f},
-std::array<float,2>{0.280196875f, 0.922268331f},
-std::array<float,2>{0.937256396f, 0.4183276f},
-std::array<float,2>{0.107513018f, 0.349028766f},
-std::array<float,2>{0.513420522f, 0.823179603f},
-std::array<float,2>{0.366140693f, 0.631721258f},
-std::array<float,2>{0.985670209f, 0.0774461478f},
-std::array<float,2>{0.392963022f, 0.143795833f},
-std::array<float,2>{0.826052547f, 0.528518736f},
-std::array<float,2>{0.23764962f, 0.98533833f},
-std::array<float,2>{0.745485246f, 0.477063149f},
-std::array<float,2>{0.311851472f, 0.385094553f},
-std::array<float,2>{0.896776795f, 0.875295043f},
-std::array<float,2>{0.057784684f, 0.588171363f},
-std::array<float,2>{0.62079078f, 0.205560863f},
-std::array<float,2>{0.138306573f, 0.0137858493f},
-std::array<float,2>{0.66867274f, 0.735929072f},
-std::array<float,2>{0.470466584f, 0.757756114f},
-std::array<float,2>{0.799983025f, 0.253373265f},
-std::array<float,2>{0.177844524f, 0.278766513f},
-std::array<float,2>{0.646018207f, 0.77453351f},
-std::array<float,2>{0.446357787f, 0.722000897f},
-std::array<float,2>{0.773865461f, 0.0186839439f},
-std::array<float,2>{0.263382852f, 0.195312187f},
-std::array<float,2>{0.91728574f, 0.564404249f},
-std::array<float,2>{0.00818876363f, 0.892847538f},
-std::array<float,2>{0.570147872f, 0.396648407f},
-std::array<float,2>{0.411322892f, 0.491717726f},
-std::array<float,2>{0.862536252f, 0.976082921f},
-std::array<float,2>{0.21261622f, 0.505643606f},
-std::array<float,2>{0.709999502f, 0.138761491f},
-std::array<float,2>{0.067006804f, 0.078972064f},
-std::array<float,2>{0.559555471f, 0.645862341f},
-std::array<float,2>{0.335284203f, 0.839118958f},
-std::array<float,2>{0.947727203f, 0.372049868f},
-std::array<float,2>{0.0363358706f, 0.4366211f},
-std::array<float,2>{0.597498834f, 0.914811194f},
-std::array<float,2>{0.28462702f, 0.604997993f},
-std::array<float,2>{0.885446191f, 0.241376817f},
-std::array<float,2>{0.498132616f, 0.054574348f},
-std::array<float,2>{0.793113172f, 0.693957567f},
-std::array<float,2>{0.153676763f, 0.783683002f},
-std::array<float,2>{0.678961635f, 0.302767158f},
-std::array<float,2>{0.348731488f, 0.340515554f},
-std::array<float,2>{0.97693193f, 0.853112996f},
-std::array<float,2>{0.112448305f, 0.680161595f},
-std::array<float,2>{0.517928541f, 0.105833776f},
-std::array<float,2>{0.226762667f, 0.158869147f},
-std::array<float,2>{0.721534848f, 0.559421539f},
-std::array<float,2>{0.376257569f, 0.948796451f},
-std::array<float,2>{0.834861577f, 0.438690752f},
-std::array<float,2>{0.242864862f, 0.391718477f},
-std::array<float,2>{0.734944522f, 0.89730823f},
-std::array<float,2>{0.40468359f, 0.568115711f},
-std::array<float,2>{0.819913924f, 0.190645158f},
-std::array<float,2>{0.367296308f, 0.0195722897f},
-std::array<float,2>{0.999528646f, 0.7233603f},
-std::array<float,2>{0.100701548f, 0.780595183f},
-std::array<float,2>{0.501207352f, 0.274441272f},
-std::array<float,2>{0.480345815f, 0.37008515f},
-std::array<float,2>{0.812260091f, 0.843542933f},
-std::array<float,2>{0.129087493f, 0.644144952f},
-std::array<float,2>{0.658080578f, 0.0850220695f},
-std::array<float,2>{0.0516639575f, 0.133468345f},
-std::array<float,2>{0.612285852f, 0.501795769f},
-std::array<float,2>{0.301910341f, 0.970851362f},
-std::array<float,2>{0.906247199f, 0.488236904f},
-std::array<float,2>{0.0839798823f, 0.298915118f},
-std::array<float,2>{0.542969644f, 0.788583338f},
-std::array<float,2>{0.32262063f, 0.690026343f},
-std::array<float,2>{0.957866907f, 0.0487164967f},
-std::array<float,2>{0.422192395f, 0.234484211f},
-std::array<float,2>{0.850594282f, 0.60688132f},
-std::array<float,2>{0.196049497f, 0.91901058f},
-std::array<float,2>{0.703042507f, 0.430754632f},
-std::array<float,2>{0.267698318f, 0.442134529f},
-std::array<float,2>{0.924468637f, 0.952374339f},
-std::array<float,2>{0.0290701687f, 0.554767609f},
-std::array<float,2>{0.591816127f, 0.161425203f},
-std::array<float,2>{0.169163063f, 0.103339873f},
-std::array<float,2>{0.63754642f, 0.68696475f},
-std::array<float,2>{0.466197848f, 0.857360482f},
-std::array<float,2>{0.755270183f, 0.337443411f},
-std::array<float,2>{0.148092657f, 0.315307021f},
-std::array<float,2>{0.683473408f, 0.860798717f},
-std::array<float,2>{0.491491199f, 0.66724211f},
-std::array<float,2>{0.786242783f, 0.119932912f},
-std::array<float,2>{0.295790941f, 0.183999732f},
-std::array<float,2>{0.880424082f, 0.534561276f},
-std::array<float,2>{0.0409185849f, 0.961707413f},
-std::array<float,2>{0.604830444f, 0.457516491f},
-std::array<float,2>{0.384000152f, 0.416745782f},
-std::array<float,2>{0.84030509f, 0.927085102f},
-std::array<float,2>{0.224595696f, 0.621968925f},
-std::array<float,2>{0.73156476f, 0.222362548f},
-std::array<float,2>{0.124876522f, 0.0446454808f},
-std::array<float,2>{0.529480338f, 0.713984668f},
-std::array<float,2>{0.359322727f, 0.805764079f},
-std::array<float,2>{0.970549703f, 0.291885167f},
-std::array<float,2>{0.00378838158f, 0.483964413f},
-std::array<float,2>{0.572582185f, 0.989152789f},
-std::array<float,2>{0.253214866f, 0.526434124f},
-std::array<float,2>{0.910650492f, 0.144668981f},
-std::array<float,2>{0.440905392f, 0.0716174692f},
-std::array<float,2>{0.770662665f, 0.627719641f},
-std::array<float,2>{0.185857117f, 0.825437069f},
-std::array<float,2>{0.654330611f, 0.346033037f},
-std::array<float,2>{0.33982873f, 0.256216228f},
-std::array<float,2>{0.940022886f, 0.752718747f},
-std::array<float,2>{0.0715651438f, 0.738850653f},
-std::array<float,2>{0.553466678f, 0.00817559939f},
-std::array<float,2>{0.206990466f, 0.208823219f},
-std::array<float,2>{0.717081189f, 0.593634069f},
-std::array<float,2>{0.418099999f, 0.879954457f},
-std::array<float,2>{0.868104219f, 0.387886435f},
-std::array<float,2>{0.17572102f, 0.466700017f},
-std::array<float,2>{0.641036451f, 0.954866052f},
-std::array<float,2>{0.452442944f, 0.539508343f},
-std::array<float,2>{0.779370368f, 0.1761823f},
-std::array<float,2>{0.258400291f, 0.115024798f},
-std::array<float,2>{0.918198586f, 0.662118196f},
-std::array<float,2>{0.0128470547f, 0.869449377f},
-std::array<float,2>{0.563659549f, 0.323339701f},
-std::array<float,2>{0.407184511f, 0.283775002f},
-std::array<float,2>{0.864041626f, 0.802082837f},
-std::array<float,2>{0.218200207f, 0.704306483f},
-std::array<float,2>{0.705512345f, 0.0322745182f},
-std::array<float,2>{0.0643241927f, 0.233947396f},
-std::array<float,2>{0.555169582f, 0.609591603f},
-std::array<float,2>{0.331356525f, 0.931397557f},
-std::array<float,2>{0.953048706f, 0.406832486f},
-std::array<float,2>{0.0350249484f, 0.353414237f},
-std::array<float,2>{0.59962815f, 0.81542486f},
-std::array<float,2>{0.285298735f, 0.636371195f},
-std::array<float,2>{0.889050424f, 0.0644855574f},
-std::array<float,2>{0.494293213f, 0.152663812f},
-std::array<float,2>{0.79097867f, 0.521962702f},
-std::array<float,2>{0.151065111f, 0.994101644f},
-std::array<float,2>{0.67307508f, 0.475371182f},
-std::array<float,2>{0.347253978f, 0.376414657f},
-std::array<float,2>{0.982354522f, 0.888918996f},
-std::array<float,2>{0.114826925f, 0.578472495f},
-std::array<float,2>{0.520770907f, 0.214737087f},
-std::array<float,2>{0.234113708f, 0.00747567089f},
-std::array<float,2>{0.723685741f, 0.742852569f},
-std::array<float,2>{0.382011473f, 0.763669252f},
-std::array<float,2>{0.828422546f, 0.258728653f},
-std::array<float,2>{0.192084849f, 0.270740032f},
-std::array<float,2>{0.688418746f, 0.768406689f},
-std::array<float,2>{0.431663632f, 0.733299077f},
-std::array<float,2>{0.857912302f, 0.0264113676f},
-std::array<float,2>{0.319945425f, 0.200014934f},
-std::array<float,2>{0.966555595f, 0.572946489f},
-std::array<float,2>{0.0882665142f, 0.901922405f},
-std::array<float,2>{0.531741798f, 0.398735017f},
-std::array<float,2>{0.458559394f, 0.4992823f},
-std::array<float,2>{0.759218931f, 0.976581454f},
-std::array<float,2>{0.160135776f, 0.511497319f},
-std::array<float,2>{0.629956841f, 0.130480587f},
-std::array<float,2>{0.0195770804f, 0.0901864395f},
-std::array<float,2>{0.579847455f, 0.649834752f},
-std::array<float,2>{0.27656433f, 0.835529149f},
-std::array<float,2>{0.930266678f, 0.3617374f},
-std::array<float,2>{0.105103873f, 0.42310977f},
-std::array<float,2>{0.508542717f, 0.910599887f},
-std::array<float,2>{0.362450927f, 0.598225176f},
-std::array<float,2>{0.990201831f, 0.24294588f},
-std::array<float,2>{0.397121221f, 0.056067016f},
-std::array<float,2>{0.820472479f, 0.697445095f},
-std::array<float,2>{0.242175773f, 0.796170771f},
-std::array<float,2>{0.746977806f, 0.308979422f},
-std::array<float,2>{0.304914296f, 0.328693569f},
-std::array<float,2>{0.893338144f, 0.844765663f},
-std::array<float,2>{0.0615544207f, 0.672156036f},
-std::array<float,2>{0.622966051f, 0.100422621f},
-std::array<float,2>{0.134503007f, 0.168022573f},
-std::array<float,2>{0.667007565f, 0.54850632f},
-std::array<float,2>{0.472788185f, 0.940799415f},
-std::array<float,2>{0.803256273f, 0.451204032f},
-std::array<float,2>{0.128625035f, 0.412483394f},
-std::array<float,2>{0.661975265f, 0.936680079f},
-std::array<float,2>{0.481877238f, 0.616762936f},
-std::array<float,2>{0.806337059f, 0.227887899f},
-std::array<float,2>{0.299695641f, 0.0362763703f},
-std::array<float,2>{0.898569226f, 0.708126903f},
-std::array<float,2>{0.0472680256f, 0.79956013f},
-std::array<float,2>{0.616743147f, 0.287591398f},
-std::array<float,2>{0.400727749f, 0.324300438f},
-std::array<float,2>{0.815710425f, 0.871559918f},
-std::array<float,2>{0.24875176f, 0.659907639f},
-std::array<float,2>{0.740320146f, 0.11066547f},
-std::array<float,2>{0.0950243995f, 0.172226116f},
-std::array<float,2>{0.504213572f, 0.545871913f},
-std::array<float,2>{0.374872595f, 0.957116127f},
-std::array<float,2>{0.992617726f, 0.463561773f},
-std::array<float,2>{0.0235369802f, 0.262818307f},
-std::array<float,2>{0.585942209f, 0.761069536f},
-std::array<float,2>{0.271987408f, 0.747702181f},
-std::array<float,2>{0.927071691f, 8.94771219e-05f},
-std::array<float,2>{0.462129802f, 0.215829983f},
-std::array<float,2>{0.750361741f, 0.582146466f},
-std::array<float,2>{0.167702511f, 0.884924889f},
-std::array<float,2>{0.632850647f, 0.381511152f},
-std::array<float,2>{0.325491428f, 0.471558869f},
-std::array<float,2>{0.954481184f, 0.996464014f},
-std::array<float,2>{0.0800378919f, 0.517136335f},
-std::array<float,2>{0.541484475f, 0.149771526f},
-std::array<float,2>{0.201985359f, 0.0682722554f},
-std::array<float,2>{0.697461843f, 0.638783574f},
-std::array<float,2>{0.426346809f, 0.819638789f},
-std::array<float,2>{0.843860269f, 0.357426465f},
-std::array<float,2>{0.219716236f, 0.365992904f},
-std::array<float,2>{0.728526056f, 0.829152465f},
-std::array<float,2>{0.388211071f, 0.653139234f},
-std::array<float,2>{0.839749932f, 0.089608632f},
-std::array<float,2>{0.354731381f, 0.127255514f},
-std::array<float,2>{0.973028779f, 0.515176773f},
-std::array<float,2>{0.120949268f, 0.981761694f},
-std::array<float,2>{0.524825394f, 0.493447542f},
-std::array<float,2>{0.486973971f, 0.404073417f},
-std::array<float,2>{0.784553349f, 0.902434349f},
-std::array<float,2>{0.142049253f, 0.577108324f},
-std::array<float,2>{0.686590791f, 0.197272003f},
-std::array<float,2>{0.0437668338f, 0.027880976f},
-std::array<float,2>{0.605754972f, 0.727367222f},
-std::array<float,2>{0.292844474f, 0.769882619f},
-std::array<float,2>{0.877025247f, 0.26752457f},
-std::array<float,2>{0.0750944689f, 0.445549995f},
-std::array<float,2>{0.550022185f, 0.945183635f},
-std::array<float,2>{0.341593236f, 0.551871002f},
-std::array<float,2>{0.942104936f, 0.165106475f},
-std::array<float,2>{0.415612817f, 0.0953288227f},
-std::array<float,2>{0.874547362f, 0.676627636f},
-std::array<float,2>{0.209284797f, 0.850507259f},
-std::array<float,2>{0.711115003f, 0.334215283f},
-std::array<float,2>{0.254773974f, 0.306967646f},
-std::array<float,2>{0.908040643f, 0.790704608f},
-std::array<float,2>{0.00464240694f, 0.702363074f},
-std::array<float,2>{0.578050137f, 0.060340859f},
-std::array<float,2>{0.181210637f, 0.24912639f},
-std::array<float,2>{0.650002599f, 0.593780994f},
-std::array<float,2>{0.443208724f, 0.909604549f},
-std::array<float,2>{0.766851127f, 0.427098125f},
-std::array<float,2>{0.211388201f, 0.490156919f},
-std::array<float,2>{0.709158659f, 0.972835779f},
-std::array<float,2>{0.410217553f, 0.506420851f},
-std::array<float,2>{0.861650586f, 0.137165636f},
-std::array<float,2>{0.334848225f, 0.0818517432f},
-std::array<float,2>{0.948668063f, 0.647593915f},
-std::array<float,2>{0.067885235f, 0.836631656f},
-std::array<float,2>{0.560076416f, 0.374957681f},
-std::array<float,2>{0.445597619f, 0.279403597f},
-std::array<float,2>{0.774506807f, 0.776888967f},
-std::array<float,2>{0.178974375f, 0.72020179f},
-std::array<float,2>{0.644786239f, 0.0175419375f},
-std::array<float,2>{0.00955555867f, 0.192167878f},
-std::array<float,2>{0.568905234f, 0.565087199f},
-std::array<float,2>{0.262459308f, 0.892464042f},
-std::array<float,2>{0.916916847f, 0.395666599f},
-std::array<float,2>{0.11177104f, 0.342740655f},
-std::array<float,2>{0.519519329f, 0.85401088f},
-std::array<float,2>{0.348140508f, 0.683034182f},
-std::array<float,2>{0.978464901f, 0.108922869f},
-std::array<float,2>{0.37584278f, 0.156737953f},
-std::array<float,2>{0.83585602f, 0.56060189f},
-std::array<float,2>{0.227936953f, 0.947137594f},
-std::array<float,2>{0.721979141f, 0.439458281f},
-std::array<float,2>{0.283931762f, 0.433803052f},
-std::array<float,2>{0.885888457f, 0.917748988f},
-std::array<float,2>{0.0357637107f, 0.601931632f},
-std::array<float,2>{0.595918834f, 0.24020569f},
-std::array<float,2>{0.152804434f, 0.0513896942f},
-std::array<float,2>{0.678515017f, 0.692513168f},
-std::array<float,2>{0.499884248f, 0.782099724f},
-std::array<float,2>{0.793963373f, 0.302333564f},
-std::array<float,2>{0.162880853f, 0.293629646f},
-std::array<float,2>{0.626226664f, 0.809591472f},
-std::array<float,2>{0.455969214f, 0.717391729f},
-std::array<float,2>{0.763570726f, 0.0393228941f},
-std::array<float,2>{0.280747801f, 0.226326942f},
-std::array<float,2>{0.935701609f, 0.620049655f},
-std::array<float,2>{0.0191295464f, 0.924837828f},
-std::array<float,2>{0.584813535f, 0.421176344f},
-std::array<float,2>{0.435882449f, 0.456027716f},
-std::array<float,2>{0.854438603f, 0.967898011f},
-std::array<float,2>{0.189725175f, 0.535642147f},
-std::array<float,2>{0.691455185f, 0.183421984f},
-std::array<float,2>{0.0912641659f, 0.124964781f},
-std::array<float,2>{0.5385198f, 0.669263124f},
-std::array<float,2>{0.315098077f, 0.865059197f},
-std::array<float,2>{0.961974382f, 0.317048639f},
-std::array<float,2>{0.0575874299f, 0.383259714f},
-std::array<float,2>{0.619200945f, 0.877379119f},
-std::array<float,2>{0.311316967f, 0.586259425f},
-std::array<float,2>{0.898373365f, 0.203443468f},
-std::array<float,2>{0.469015181f, 0.0130007053f},
-std::array<float,2>{0.799325228f, 0.73673439f},
-std::array<float,2>{0.136792108f, 0.755795956f},
-std::array<float,2>{0.6697824f, 0.250505388f},
-std::array<float,2>{0.366481215f, 0.35083434f},
-std::array<float,2>{0.985090196f, 0.822054088f},
-std::array<float,2>{0.108774632f, 0.630759239f},
-std::array<float,2>{0.512545824f, 0.0749799088f},
-std::array<float,2>{0.236446396f, 0.142273992f},
-std::array<float,2>{0.744518638f, 0.531078994f},
-std::array<float,2>{0.394523948f, 0.987938881f},
-std::array<float,2>{0.824518144f, 0.479203969f},
-std::array<float,2>{0.197404489f, 0.431701154f},
-std::array<float,2>{0.699663758f, 0.921596646f},
-std::array<float,2>{0.42452246f, 0.60928458f},
-std::array<float,2>{0.849279404f, 0.237425491f},
-std::array<float,2>{0.3212156f, 0.0492480248f},
-std::array<float,2>{0.959077299f, 0.688968599f},
-std::array<float,2>{0.08537516f, 0.786898136f},
-std::array<float,2>{0.545853853f, 0.297184497f},
-std::array<float,2>{0.468218684f, 0.339822263f},
-std::array<float,2>{0.756915271f, 0.859166205f},
-std::array<float,2>{0.170891225f, 0.684661865f},
-std::array<float,2>{0.64018172f, 0.104805857f},
-std::array<float,2>{0.0299658664f, 0.162932381f},
-std::array<float,2>{0.590715051f, 0.557892203f},
-std::array<float,2>{0.266480863f, 0.951099932f},
-std::array<float,2>{0.922856867f, 0.444080174f},
-std::array<float,2>{0.0987220407f, 0.276866227f},
-std::array<float,2>{0.503757536f, 0.77927506f},
-std::array<float,2>{0.369384229f, 0.725815773f},
-std::array<float,2>{0.997972786f, 0.0226929095f},
-std::array<float,2>{0.402376026f, 0.188407958f},
-std::array<float,2>{0.818180203f, 0.570147336f},
-std::array<float,2>{0.244648099f, 0.895108461f},
-std::array<float,2>{0.737425983f, 0.393127531f},
-std::array<float,2>{0.304452002f, 0.485694677f},
-std::array<float,2>{0.902492344f, 0.969158292f},
-std::array<float,2>{0.0546835884f, 0.502670765f},
-std::array<float,2>{0.609861434f, 0.135980368f},
-std::array<float,2>{0.1310862f, 0.0830940381f},
-std::array<float,2>{0.659417152f, 0.641509175f},
-std::array<float,2>{0.478224844f, 0.840909064f},
-std::array<float,2>{0.809433997f, 0.367473364f},
-std::array<float,2>{0.184959665f, 0.344080985f},
-std::array<float,2>{0.653040349f, 0.826328099f},
-std::array<float,2>{0.438137621f, 0.625219762f},
-std::array<float,2>{0.771667898f, 0.0738283545f},
-std::array<float,2>{0.250385433f, 0.147370949f},
-std::array<float,2>{0.912585258f, 0.52375257f},
-std::array<float,2>{0.00193089875f, 0.991894364f},
-std::array<float,2>{0.570515156f, 0.480937839f},
-std::array<float,2>{0.420098037f, 0.388912797f},
-std::array<float,2>{0.86930263f, 0.881177604f},
-std::array<float,2>{0.203571811f, 0.589912415f},
-std::array<float,2>{0.716369033f, 0.209385753f},
-std::array<float,2>{0.0740419924f, 0.0108412597f},
-std::array<float,2>{0.552594364f, 0.740561664f},
-std::array<float,2>{0.337060153f, 0.751943529f},
-std::array<float,2>{0.938087702f, 0.255284876f},
-std::array<float,2>{0.0411971733f, 0.460282356f},
-std::array<float,2>{0.602800429f, 0.963059306f},
-std::array<float,2>{0.293613315f, 0.532611728f},
-std::array<float,2>{0.882674754f, 0.185620382f},
-std::array<float,2>{0.489478618f, 0.117298819f},
-std::array<float,2>{0.788679957f, 0.664403677f},
-std::array<float,2>{0.145963609f, 0.862646699f},
-std::array<float,2>{0.680551052f, 0.312543482f},
-std::array<float,2>{0.356912106f, 0.289802611f},
-std::array<float,2>{0.971097231f, 0.80736649f},
-std::array<float,2>{0.122385524f, 0.712431371f},
-std::array<float,2>{0.527652085f, 0.0450478084f},
-std::array<float,2>{0.226111785f, 0.220455408f},
-std::array<float,2>{0.734347165f, 0.624786854f},
-std::array<float,2>{0.385026008f, 0.928181589f},
-std::array<float,2>{0.843078196f, 0.414882362f},
-std::array<float,2>{0.150319576f, 0.474152535f},
-std::array<float,2>{0.674380124f, 0.995235622f},
-std::array<float,2>{0.493437022f, 0.519914806f},
-std::array<float,2>{0.791573048f, 0.154404193f},
-std::array<float,2>{0.288901508f, 0.0636646748f},
-std::array<float,2>{0.887218952f, 0.634576023f},
-std::array<float,2>{0.0326421224f, 0.812705815f},
-std::array<float,2>{0.599012852f, 0.354498208f},
-std::array<float,2>{0.380275697f, 0.261281133f},
-std::array<float,2>{0.831091344f, 0.764147341f},
-std::array<float,2>{0.230729938f, 0.744158447f},
-std::array<float,2>{0.725242794f, 0.00571732456f},
-std::array<float,2>{0.116201051f, 0.212212086f},
-std::array<float,2>{0.521563351f, 0.580429316f},
-std::array<float,2>{0.345514894f, 0.887333155f},
-std::array<float,2>{0.983997047f, 0.378684342f},
-std::array<float,2>{0.0146155646f, 0.321401805f},
-std::array<float,2>{0.565232933f, 0.867192388f},
-std::array<float,2>{0.260808587f, 0.660289407f},
-std::array<float,2>{0.919958115f, 0.115723193f},
-std::array<float,2>{0.449731737f, 0.179546416f},
-std::array<float,2>{0.777519703f, 0.541762888f},
-std::array<float,2>{0.172109902f, 0.956602275f},
-std::array<float,2>{0.643320799f, 0.467535496f},
-std::array<float,2>{0.328833759f, 0.409684867f},
-std::array<float,2>{0.949263692f, 0.932643533f},
-std::array<float,2>{0.0656854361f, 0.612906575f},
-std::array<float,2>{0.558156669f, 0.230541199f},
-std::array<float,2>{0.215965346f, 0.0339853987f},
-std::array<float,2>{0.704462171f, 0.706879854f},
-std::array<float,2>{0.408207059f, 0.803256929f},
-std::array<float,2>{0.866907775f, 0.282382667f},
-std::array<float,2>{0.239310846f, 0.312329322f},
-std::array<float,2>{0.74943924f, 0.79365164f},
-std::array<float,2>{0.395856589f, 0.696725011f},
-std::array<float,2>{0.82316947f, 0.0579286963f},
-std::array<float,2>{0.359425336f, 0.245852485f},
-std::array<float,2>{0.99070853f, 0.600763023f},
-std::array<float,2>{0.103040524f, 0.91218853f},
-std::array<float,2>{0.511650801f, 0.425173968f},
-std::array<float,2>{0.47502932f, 0.450945288f},
-std::array<float,2>{0.80221045f, 0.939388931f},
-std::array<float,2>{0.136132941f, 0.550772429f},
-std::array<float,2>{0.66586417f, 0.170196936f},
-std::array<float,2>{0.060412433f, 0.0986385494f},
-std::array<float,2>{0.623955548f, 0.674452782f},
-std::array<float,2>{0.307741016f, 0.846214473f},
-std::array<float,2>{0.891092837f, 0.331294149f},
-std::array<float,2>{0.0869660452f, 0.401416481f},
-std::array<float,2>{0.534542024f, 0.900348604f},
-std::array<float,2>{0.316666007f, 0.572031796f},
-std::array<float,2>{0.968276501f, 0.201666772f},
-std::array<float,2>{0.429688931f, 0.0253728908f},
-std::array<float,2>{0.856093824f, 0.73075825f},
-std::array<float,2>{0.195099533f, 0.766078234f},
-std::array<float,2>{0.691103637f, 0.273111463f},
-std::array<float,2>{0.274720103f, 0.360935986f},
-std::array<float,2>{0.932614684f, 0.833875179f},
-std::array<float,2>{0.0216635391f, 0.651945055f},
-std::array<float,2>{0.580709457f, 0.0933915079f},
-std::array<float,2>{0.157697558f, 0.131076142f},
-std::array<float,2>{0.631956458f, 0.508441746f},
-std::array<float,2>{0.459194422f, 0.980208516f},
-std::array<float,2>{0.761156559f, 0.496938169f},
-std::array<float,2>{0.164981335f, 0.380327225f},
-std::array<float,2>{0.636062622f, 0.883994877f},
-std::array<float,2>{0.464043409f, 0.585803986f},
-std::array<float,2>{0.753350973f, 0.218635246f},
-std::array<float,2>{0.27007705f, 0.00345616206f},
-std::array<float,2>{0.928073943f, 0.749759912f},
-std::array<float,2>{0.0272135846f, 0.75910902f},
-std::array<float,2>{0.588943243f, 0.264541537f},
-std::array<float,2>{0.429587394f, 0.356612712f},
-std::array<float,2>{0.845796108f, 0.818081915f},
-std::array<float,2>{0.199570745f, 0.637304783f},
-std::array<float,2>{0.696098626f, 0.0685064793f},
-std::array<float,2>{0.0802113339f, 0.151769981f},
-std::array<float,2>{0.54088068f, 0.518300176f},
-std::array<float,2>{0.327154666f, 0.999747455f},
-std::array<float,2>{0.955494523f, 0.470184535f},
-std::array<float,2>{0.0493611321f, 0.285709351f},
-std::array<float,2>{0.614364624f, 0.797803164f},
-std::array<float,2>{0.297103882f, 0.709664106f},
-std::array<float,2>{0.901264429f, 0.0378337801f},
-std::array<float,2>{0.484055579f, 0.22873947f},
-std::array<float,2>{0.808424771f, 0.614420116f},
-std::array<float,2>{0.125668779f, 0.933855593f},
-std::array<float,2>{0.663097143f, 0.410919935f},
-std::array<float,2>{0.372303754f, 0.461447686f},
-std::array<float,2>{0.994564354f, 0.960134447f},
-std::array<float,2>{0.0974946246f, 0.544605494f},
-std::array<float,2>{0.50635916f, 0.175113529f},
-std::array<float,2>{0.247832119f, 0.113131411f},
-std::array<float,2>{0.739955902f, 0.656766891f},
-std::array<float,2>{0.399371088f, 0.874309957f},
-std::array<float,2>{0.812528014f, 0.327282459f},
-std::array<float,2>{0.207724825f, 0.333778054f},
-std::array<float,2>{0.712898374f, 0.84781462f},
-std::array<float,2>{0.416362137f, 0.6784091f},
-std::array<float,2>{0.872466862f, 0.0965228304f},
-std::array<float,2>{0.342386276f, 0.167373866f},
-std::array<float,2>{0.944775641f, 0.554563344f},
-std::array<float,2>{0.0767591968f, 0.942476332f},
-std::array<float,2>{0.548563004f, 0.447828084f},
-std::array<float,2>{0.444061071f, 0.428437501f},
-std::array<float,2>{0.76819104f, 0.907097578f},
-std::array<float,2>{0.183236718f, 0.597381771f},
-std::array<float,2>{0.650438368f, 0.247430608f},
-std::array<float,2>{0.00724647986f, 0.0620292649f},
-std::array<float,2>{0.574759662f, 0.700373352f},
-std::array<float,2>{0.257497847f, 0.791466415f},
-std::array<float,2>{0.909032166f, 0.305298269f},
-std::array<float,2>{0.117816359f, 0.494829386f},
-std::array<float,2>{0.526003838f, 0.983419657f},
-std::array<float,2>{0.351752013f, 0.51207906f},
-std::array<float,2>{0.97574836f, 0.125921145f},
-std::array<float,2>{0.389329851f, 0.0862953588f},
-std::array<float,2>{0.837814569f, 0.656066835f},
-std::array<float,2>{0.221962601f, 0.831197798f},
-std::array<float,2>{0.727977812f, 0.363503188f},
-std::array<float,2>{0.289311886f, 0.269476324f},
-std::array<float,2>{0.876292229f, 0.772432983f},
-std::array<float,2>{0.0453018136f, 0.728545249f},
-std::array<float,2>{0.608909369f, 0.0297622513f},
-std::array<float,2>{0.143706158f, 0.196090996f},
-std::array<float,2>{0.684827387f, 0.575883269f},
-std::array<float,2>{0.485051185f, 0.90590477f},
-std::array<float,2>{0.783074737f, 0.406191736f},
-std::array<float,2>{0.229295477f, 0.438337237f},
-std::array<float,2>{0.719027817f, 0.947625279f},
-std::array<float,2>{0.378126562f, 0.560255349f},
-std::array<float,2>{0.832664549f, 0.15947558f},
-std::array<float,2>{0.350212187f, 0.106722943f},
-std::array<float,2>{0.979619443f, 0.68086803f},
-std::array<float,2>{0.110333204f, 0.852361202f},
-std::array<float,2>{0.516690791f, 0.34094283f},
-std::array<float,2>{0.497271687f, 0.304579496f},
-std::array<float,2>{0.794961572f, 0.784523726f},
-std::array<float,2>{0.154383749f, 0.695190132f},
-std::array<float,2>{0.675848484f, 0.0532714836f},
-std::array<float,2>{0.0374841988f, 0.240837738f},
-std::array<float,2>{0.594816267f, 0.60403204f},
-std::array<float,2>{0.281536728f, 0.915282011f},
-std::array<float,2>{0.884021282f, 0.436319321f},
-std::array<float,2>{0.0683858097f, 0.372376293f},
-std::array<float,2>{0.560991704f, 0.838161647f},
-std::array<float,2>{0.333055645f, 0.645189106f},
-std::array<float,2>{0.946879506f, 0.0795019343f},
-std::array<float,2>{0.412511408f, 0.140406251f},
-std::array<float,2>{0.861283302f, 0.504678965f},
-std::array<float,2>{0.213971049f, 0.975150466f},
-std::array<float,2>{0.707696676f, 0.491019368f},
-std::array<float,2>{0.26488778f, 0.397864729f},
-std::array<float,2>{0.915251136f, 0.893996537f},
-std::array<float,2>{0.0114523778f, 0.562628865f},
-std::array<float,2>{0.567297459f, 0.193914577f},
-std::array<float,2>{0.176621631f, 0.0180096682f},
-std::array<float,2>{0.647068083f, 0.721355259f},
-std::array<float,2>{0.44759801f, 0.773700058f},
-std::array<float,2>{0.775501013f, 0.277770311f},
-std::array<float,2>{0.13911055f, 0.252115101f},
-std::array<float,2>{0.669987619f, 0.75592494f},
-std::array<float,2>{0.470858604f, 0.734475613f},
-std::array<float,2>{0.797526538f, 0.0149338804f},
-std::array<float,2>{0.30979833f, 0.206123859f},
-std::array<float,2>{0.895894885f, 0.589402139f},
-std::array<float,2>{0.0553225316f, 0.876748919f},
-std::array<float,2>{0.617641807f, 0.386382073f},
-std::array<float,2>{0.392525285f, 0.47827521f},
-std::array<float,2>{0.826423526f, 0.985416293f},
-std::array<float,2>{0.235125154f, 0.52747196f},
-std::array<float,2>{0.742436051f, 0.142833561f},
-std::array<float,2>{0.105487496f, 0.0771465227f},
-std::array<float,2>{0.514717698f, 0.632442951f},
-std::array<float,2>{0.365206748f, 0.82407546f},
-std::array<float,2>{0.987394691f, 0.348467529f},
-std::array<float,2>{0.0156341717f, 0.419067711f},
-std::array<float,2>{0.583970547f, 0.923767626f},
-std::array<float,2>{0.277589321f, 0.617677212f},
-std::array<float,2>{0.934459686f, 0.223033428f},
-std::array<float,2>{0.453141004f, 0.0423600748f},
-std::array<float,2>{0.765235901f, 0.715227187f},
-std::array<float,2>{0.161734849f, 0.812000275f},
-std::array<float,2>{0.627578318f, 0.296711206f},
-std::array<float,2>{0.312792271f, 0.320289522f},
-std::array<float,2>{0.96400106f, 0.865988791f},
-std::array<float,2>{0.0919384584f, 0.670599997f},
-std::array<float,2>{0.53549093f, 0.121575482f},
-std::array<float,2>{0.188442081f, 0.181293294f},
-std::array<float,2>{0.694975376f, 0.537977517f},
-std::array<float,2>{0.434143275f, 0.965672076f},
-std::array<float,2>{0.852063715f, 0.454519033f},
-std::array<float,2>{0.199355394f, 0.382588863f},
-std::array<float,2>{0.695871472f, 0.885849118f},
-std::array<float,2>{0.429228842f, 0.583626688f},
-std::array<float,2>{0.846156061f, 0.215717942f},
-std::array<float,2>{0.327565968f, 0.0013896228f},
-std::array<float,2>{0.955108047f, 0.746960163f},
-std::array<float,2>{0.0805267319f, 0.760740757f},
-std::array<float,2>{0.540631413f, 0.262676775f},
-std::array<float,2>{0.464296311f, 0.358836353f},
-std::array<float,2>{0.752980649f, 0.818788946f},
-std::array<float,2>{0.16466336f, 0.639907181f},
-std::array<float,2>{0.635858655f, 0.0670191199f},
-std::array<float,2>{0.0270868968f, 0.148660779f},
-std::array<float,2>{0.589153945f, 0.516373336f},
-std::array<float,2>{0.270325571f, 0.997887135f},
-std::array<float,2>{0.927847028f, 0.471805066f},
-std::array<float,2>{0.0973543078f, 0.288405836f},
-std::array<float,2>{0.506763518f, 0.800067008f},
-std::array<float,2>{0.372430801f, 0.707475662f},
-std::array<float,2>{0.994206369f, 0.0359588414f},
-std::array<float,2>{0.399077028f, 0.227329478f},
-std::array<float,2>{0.812857866f, 0.61617142f},
-std::array<float,2>{0.247762129f, 0.936203182f},
-std::array<float,2>{0.740005553f, 0.413539797f},
-std::array<float,2>{0.297246963f, 0.464675516f},
-std::array<float,2>{0.900933325f, 0.958926797f},
-std::array<float,2>{0.0497219451f, 0.546407282f},
-std::array<float,2>{0.61454159f, 0.173367798f},
-std::array<float,2>{0.125966951f, 0.10977599f},
-std::array<float,2>{0.663450122f, 0.659104228f},
-std::array<float,2>{0.484288961f, 0.872266233f},
-std::array<float,2>{0.808253944f, 0.325688064f},
-std::array<float,2>{0.183486536f, 0.335687429f},
-std::array<float,2>{0.650819242f, 0.850951374f},
-std::array<float,2>{0.44421044f, 0.676867068f},
-std::array<float,2>{0.768441498f, 0.094212234f},
-std::array<float,2>{0.257720649f, 0.16481258f},
-std::array<float,2>{0.908755541f, 0.550841689f},
-std::array<float,2>{0.00693546096f, 0.944246054f},
-std::array<float,2>{0.575152934f, 0.44653365f},
-std::array<float,2>{0.416073769f, 0.426382154f},
-std::array<float,2>{0.87221384f, 0.908608496f},
-std::array<float,2>{0.207974717f, 0.59569031f},
-std::array<float,2>{0.713147342f, 0.248993933f},
-std::array<float,2>{0.0771281049f, 0.0589714795f},
-std::array<float,2>{0.548718512f, 0.701464176f},
-std::array<float,2>{0.342535436f, 0.789958358f},
-std::array<float,2>{0.944370508f, 0.307724684f},
-std::array<float,2>{0.0450062901f, 0.492626429f},
-std::array<float,2>{0.609216273f, 0.980731964f},
-std::array<float,2>{0.289068758f, 0.514541268f},
-std::array<float,2>{0.876014769f, 0.128488392f},
-std::array<float,2>{0.48514241f, 0.0886887163f},
-std::array<float,2>{0.78283447f, 0.653854132f},
-std::array<float,2>{0.143829823f, 0.828347683f},
-std::array<float,2>{0.684654653f, 0.36630252f},
-std::array<float,2>{0.351857722f, 0.265967458f},
-std::array<float,2>{0.97587204f, 0.771431267f},
-std::array<float,2>{0.117981769f, 0.727725506f},
-std::array<float,2>{0.526363492f, 0.0287699364f},
-std::array<float,2>{0.221750289f, 0.198633f},
-std::array<float,2>{0.727758646f, 0.57767123f},
-std::array<float,2>{0.389607221f, 0.904023409f},
-std::array<float,2>{0.837417901f, 0.402983665f},
-std::array<float,2>{0.154706776f, 0.440904081f},
-std::array<float,2>{0.676256895f, 0.946173728f},
-std::array<float,2>{0.4974747f, 0.562110126f},
-std::array<float,2>{0.79525733f, 0.15753606f},
-std::array<float,2>{0.281399816f, 0.107483454f},
-std::array<float,2>{0.88415134f, 0.68189168f},
-std::array<float,2>{0.0372410379f, 0.854793906f},
-std::array<float,2>{0.595143557f, 0.343614221f},
-std::array<float,2>{0.378369272f, 0.300957143f},
-std::array<float,2>{0.832872927f, 0.782817185f},
-std::array<float,2>{0.229171932f, 0.691989958f},
-std::array<float,2>{0.71889323f, 0.0526362509f},
-std::array<float,2>{0.109996967f, 0.238642365f},
-std::array<float,2>{0.516990244f, 0.603049099f},
-std::array<float,2>{0.350519449f, 0.916613579f},
-std::array<float,2>{0.979938805f, 0.435377479f},
-std::array<float,2>{0.01169925f, 0.373753518f},
-std::array<float,2>{0.56691736f, 0.836948097f},
-std::array<float,2>{0.265093446f, 0.646544337f},
-std::array<float,2>{0.915357709f, 0.0808403268f},
-std::array<float,2>{0.447384834f, 0.137898147f},
-std::array<float,2>{0.775807142f, 0.507615566f},
-std::array<float,2>{0.176340759f, 0.973645389f},
-std::array<float,2>{0.647244632f, 0.489166111f},
-std::array<float,2>{0.333414316f, 0.395268947f},
-std::array<float,2>{0.947088897f, 0.891275644f},
-std::array<float,2>{0.0687161461f, 0.566168249f},
-std::array<float,2>{0.560764849f, 0.192534059f},
-std::array<float,2>{0.21422106f, 0.016099913f},
-std::array<float,2>{0.707957268f, 0.718826115f},
-std::array<float,2>{0.41216433f, 0.775928676f},
-std::array<float,2>{0.861040771f, 0.280973554f},
-std::array<float,2>{0.235083818f, 0.251126796f},
-std::array<float,2>{0.742381155f, 0.75459671f},
-std::array<float,2>{0.39223215f, 0.737885058f},
-std::array<float,2>{0.826203823f, 0.0125615261f},
-std::array<float,2>{0.364974856f, 0.204210386f},
-std::array<float,2>{0.987573922f, 0.587405205f},
-std::array<float,2>{0.105933055f, 0.878613114f},
-std::array<float,2>{0.514909327f, 0.383859754f},
-std::array<float,2>{0.471158057f, 0.479753852f},
-std::array<float,2>{0.797850132f, 0.986759961f},
-std::array<float,2>{0.138772652f, 0.529922664f},
-std::array<float,2>{0.670300484f, 0.140850633f},
-std::array<float,2>{0.0554496236f, 0.0760556012f},
-std::array<float,2>{0.617411733f, 0.629643559f},
-std::array<float,2>{0.309834868f, 0.82058382f},
-std::array<float,2>{0.895711899f, 0.349756479f},
-std::array<float,2>{0.0921898112f, 0.420674562f},
-std::array<float,2>{0.535188138f, 0.924769521f},
-std::array<float,2>{0.312675446f, 0.620838463f},
-std::array<float,2>{0.96435082f, 0.224966988f},
-std::array<float,2>{0.434486777f, 0.0402109511f},
-std::array<float,2>{0.852353394f, 0.718243599f},
-std::array<float,2>{0.188014984f, 0.808778286f},
-std::array<float,2>{0.69517386f, 0.294267505f},
-std::array<float,2>{0.277371079f, 0.317659885f},
-std::array<float,2>{0.934113264f, 0.863745809f},
-std::array<float,2>{0.0158932582f, 0.668399036f},
-std::array<float,2>{0.58360523f, 0.123315424f},
-std::array<float,2>{0.162090197f, 0.181834042f},
-std::array<float,2>{0.627888858f, 0.536366761f},
-std::array<float,2>{0.453512579f, 0.967193127f},
-std::array<float,2>{0.765461326f, 0.456531376f},
-std::array<float,2>{0.170592055f, 0.430041403f},
-std::array<float,2>{0.640577435f, 0.918839276f},
-std::array<float,2>{0.46796003f, 0.605993092f},
-std::array<float,2>{0.757243991f, 0.236129135f},
-std::array<float,2>{0.266342491f, 0.047039263f},
-std::array<float,2>{0.923182666f, 0.69065094f},
-std::array<float,2>{0.0301517583f, 0.787996352f},
-std::array<float,2>{0.590558767f, 0.300701559f},
-std::array<float,2>{0.424599737f, 0.336285502f},
-std::array<float,2>{0.849389315f, 0.856352448f},
-std::array<float,2>{0.197599903f, 0.685935438f},
-std::array<float,2>{0.699274778f, 0.101728268f},
-std::array<float,2>{0.0849702507f, 0.160225719f},
-std::array<float,2>{0.545617342f, 0.556394875f},
-std::array<float,2>{0.321044683f, 0.952054143f},
-std::array<float,2>{0.959405661f, 0.443015277f},
-std::array<float,2>{0.0543319546f, 0.273523331f},
-std::array<float,2>{0.609488189f, 0.779451191f},
-std::array<float,2>{0.304425091f, 0.724372566f},
-std::array<float,2>{0.90273881f, 0.0212883838f},
-std::array<float,2>{0.478428721f, 0.18960771f},
-std::array<float,2>{0.809302688f, 0.567326784f},
-std::array<float,2>{0.131344333f, 0.897577763f},
-std::array<float,2>{0.659578204f, 0.391106248f},
-std::array<float,2>{0.369613439f, 0.487062246f},
-std::array<float,2>{0.997689545f, 0.972345412f},
-std::array<float,2>{0.0989878997f, 0.500748754f},
-std::array<float,2>{0.503599524f, 0.134650618f},
-std::array<float,2>{0.244945198f, 0.0841006786f},
-std::array<float,2>{0.737753272f, 0.643511713f},
-std::array<float,2>{0.402778953f, 0.84211123f},
-std::array<float,2>{0.817969382f, 0.370894253f},
-std::array<float,2>{0.203265712f, 0.3474361f},
-std::array<float,2>{0.71664542f, 0.824458718f},
-std::array<float,2>{0.420300782f, 0.628591478f},
-std::array<float,2>{0.8695665f, 0.0708438233f},
-std::array<float,2>{0.337278962f, 0.145875141f},
-std::array<float,2>{0.93839252f, 0.525586128f},
-std::array<float,2>{0.0737672225f, 0.989718795f},
-std::array<float,2>{0.55224961f, 0.482534349f},
-std::array<float,2>{0.438294649f, 0.386806875f},
-std::array<float,2>{0.771970451f, 0.878938079f},
-std::array<float,2>{0.18466562f, 0.592223465f},
-std::array<float,2>{0.653189421f, 0.207921043f},
-std::array<float,2>{0.00148116588f, 0.00904171169f},
-std::array<float,2>{0.57068789f, 0.739511907f},
-std::array<float,2>{0.250163138f, 0.753568649f},
-std::array<float,2>{0.912159562f, 0.25685522f},
-std::array<float,2>{0.122285046f, 0.458551854f},
-std::array<float,2>{0.527504265f, 0.962430239f},
-std::array<float,2>{0.356557071f, 0.534071743f},
-std::array<float,2>{0.970737159f, 0.185177922f},
-std::array<float,2>{0.384860635f, 0.121074162f},
-std::array<float,2>{0.842952013f, 0.666626334f},
-std::array<float,2>{0.22650978f, 0.859425664f},
-std::array<float,2>{0.7340222f, 0.3159343f},
-std::array<float,2>{0.293772608f, 0.292852044f},
-std::array<float,2>{0.882456541f, 0.805451691f},
-std::array<float,2>{0.0414982513f, 0.713526189f},
-std::array<float,2>{0.602775633f, 0.0436468199f},
-std::array<float,2>{0.145587876f, 0.221086681f},
-std::array<float,2>{0.68039012f, 0.622380793f},
-std::array<float,2>{0.489578933f, 0.926093876f},
-std::array<float,2>{0.789001763f, 0.417126566f},
-std::array<float,2>{0.230496421f, 0.476282686f},
-std::array<float,2>{0.725373447f, 0.992419064f},
-std::array<float,2>{0.379913956f, 0.5227139f},
-std::array<float,2>{0.831459343f, 0.153547138f},
-std::array<float,2>{0.34534204f, 0.0656872839f},
-std::array<float,2>{0.984244883f, 0.635511577f},
-std::array<float,2>{0.115898736f, 0.815862715f},
-std::array<float,2>{0.52181375f, 0.352123737f},
-std::array<float,2>{0.493323117f, 0.259348571f},
-std::array<float,2>{0.791813612f, 0.762501359f},
-std::array<float,2>{0.150026768f, 0.743463635f},
-std::array<float,2>{0.674669385f, 0.00622832961f},
-std::array<float,2>{0.0322421007f, 0.213823974f},
-std::array<float,2>{0.598672986f, 0.580035388f},
-std::array<float,2>{0.288641363f, 0.889790416f},
-std::array<float,2>{0.887532175f, 0.37581417f},
-std::array<float,2>{0.0655936003f, 0.323060155f},
-std::array<float,2>{0.558413625f, 0.870700061f},
-std::array<float,2>{0.329019129f, 0.663683891f},
-std::array<float,2>{0.949555099f, 0.113453612f},
-std::array<float,2>{0.408596367f, 0.177106455f},
-std::array<float,2>{0.867043614f, 0.540073752f},
-std::array<float,2>{0.216198266f, 0.953660548f},
-std::array<float,2>{0.704265654f, 0.465616524f},
-std::array<float,2>{0.261126399f, 0.408116877f},
-std::array<float,2>{0.920208216f, 0.929956377f},
-std::array<float,2>{0.014255424f, 0.611003458f},
-std::array<float,2>{0.565053761f, 0.233265057f},
-std::array<float,2>{0.172159731f, 0.0318526141f},
-std::array<float,2>{0.6433025f, 0.703669012f},
-std::array<float,2>{0.449971437f, 0.800805688f},
-std::array<float,2>{0.777787507f, 0.284478664f},
-std::array<float,2>{0.135982022f, 0.310422987f},
-std::array<float,2>{0.665584028f, 0.795749605f},
-std::array<float,2>{0.474811018f, 0.698345959f},
-std::array<float,2>{0.801903725f, 0.0552207381f},
-std::array<float,2>{0.307954758f, 0.24333404f},
-std::array<float,2>{0.890834391f, 0.599415362f},
-std::array<float,2>{0.0601355769f, 0.91186893f},
-std::array<float,2>{0.623549938f, 0.422798038f},
-std::array<float,2>{0.395647258f, 0.45290947f},
-std::array<float,2>{0.822951257f, 0.940160096f},
-std::array<float,2>{0.239713535f, 0.547134459f},
-std::array<float,2>{0.749205172f, 0.169757366f},
-std::array<float,2>{0.1032876f, 0.101155967f},
-std::array<float,2>{0.511230588f, 0.673196554f},
-std::array<float,2>{0.359792709f, 0.844170868f},
-std::array<float,2>{0.990343511f, 0.3291637f},
-std::array<float,2>{0.0218432806f, 0.399481416f},
-std::array<float,2>{0.580944717f, 0.900656521f},
-std::array<float,2>{0.274474472f, 0.573253989f},
-std::array<float,2>{0.932346523f, 0.200549364f},
-std::array<float,2>{0.459404141f, 0.0258418545f},
-std::array<float,2>{0.760945022f, 0.733473301f},
-std::array<float,2>{0.157289714f, 0.769055724f},
-std::array<float,2>{0.632260859f, 0.270270675f},
-std::array<float,2>{0.316499621f, 0.362479895f},
-std::array<float,2>{0.968725383f, 0.834833145f},
-std::array<float,2>{0.0873279646f, 0.648874342f},
-std::array<float,2>{0.534344077f, 0.0912728235f},
-std::array<float,2>{0.194962308f, 0.129495025f},
-std::array<float,2>{0.691262186f, 0.510072112f},
-std::array<float,2>{0.429993689f, 0.978125274f},
-std::array<float,2>{0.856329381f, 0.499019384f},
-std::array<float,2>{0.248874351f, 0.411570102f},
-std::array<float,2>{0.740711808f, 0.935359478f},
-std::array<float,2>{0.400504947f, 0.613316715f},
-std::array<float,2>{0.815491259f, 0.230101183f},
-std::array<float,2>{0.37472412f, 0.0387613252f},
-std::array<float,2>{0.992194831f, 0.710658431f},
-std::array<float,2>{0.0948456824f, 0.798395932f},
-std::array<float,2>{0.503987789f, 0.286316752f},
-std::array<float,2>{0.481632113f, 0.326657593f},
-std::array<float,2>{0.806617796f, 0.873586655f},
-std::array<float,2>{0.128877163f, 0.657991529f},
-std::array<float,2>{0.661712825f, 0.112036541f},
-std::array<float,2>{0.0469274819f, 0.174527094f},
-std::array<float,2>{0.617111266f, 0.543562293f},
-std::array<float,2>{0.299357921f, 0.959288895f},
-std::array<float,2>{0.898697913f, 0.462160349f},
-std::array<float,2>{0.0797432214f, 0.264944106f},
-std::array<float,2>{0.541203797f, 0.758095682f},
-std::array<float,2>{0.325260788f, 0.748486102f},
-std::array<float,2>{0.954310715f, 0.00219793455f},
-std::array<float,2>{0.426585346f, 0.217356026f},
-std::array<float,2>{0.844206333f, 0.584465861f},
-std::array<float,2>{0.201903567f, 0.882847428f},
-std::array<float,2>{0.697512984f, 0.378954053f},
-std::array<float,2>{0.272334486f, 0.469448268f},
-std::array<float,2>{0.926829517f, 0.99825269f},
-std::array<float,2>{0.0237961989f, 0.519006133f},
-std::array<float,2>{0.586396635f, 0.15124853f},
-std::array<float,2>{0.167885929f, 0.0699214265f},
-std::array<float,2>{0.633150756f, 0.638336062f},
-std::array<float,2>{0.462271452f, 0.81660217f},
-std::array<float,2>{0.750172377f, 0.35575372f},
-std::array<float,2>{0.141641334f, 0.364565521f},
-std::array<float,2>{0.686797082f, 0.830656528f},
-std::array<float,2>{0.487219155f, 0.654707611f},
-std::array<float,2>{0.784299433f, 0.087693274f},
-std::array<float,2>{0.292663276f, 0.126643568f},
-std::array<float,2>{0.877209544f, 0.513270736f},
-std::array<float,2>{0.0435680039f, 0.98318404f},
-std::array<float,2>{0.605551481f, 0.495915473f},
-std::array<float,2>{0.388522923f, 0.405250013f},
-std::array<float,2>{0.839420915f, 0.904934645f},
-std::array<float,2>{0.219399184f, 0.574581683f},
-std::array<float,2>{0.728868544f, 0.196798831f},
-std::array<float,2>{0.120841548f, 0.0304163247f},
-std::array<float,2>{0.524599731f, 0.73021853f},
-std::array<float,2>{0.354764134f, 0.772871614f},
-std::array<float,2>{0.972820163f, 0.267831296f},
-std::array<float,2>{0.00458668033f, 0.449122161f},
-std::array<float,2>{0.577830434f, 0.941887319f},
-std::array<float,2>{0.254403025f, 0.553692102f},
-std::array<float,2>{0.90795809f, 0.166352868f},
-std::array<float,2>{0.442964554f, 0.0968691558f},
-std::array<float,2>{0.766681075f, 0.67875886f},
-std::array<float,2>{0.181544065f, 0.849224389f},
-std::array<float,2>{0.650344431f, 0.332990497f},
-std::array<float,2>{0.341489822f, 0.306138515f},
-std::array<float,2>{0.942267418f, 0.792574286f},
-std::array<float,2>{0.0748757049f, 0.699378014f},
-std::array<float,2>{0.550228179f, 0.0608588681f},
-std::array<float,2>{0.209161624f, 0.246574283f},
-std::array<float,2>{0.711373031f, 0.595956385f},
-std::array<float,2>{0.415815473f, 0.907488763f},
-std::array<float,2>{0.87481612f, 0.429506451f},
-std::array<float,2>{0.178905249f, 0.491384178f},
-std::array<float,2>{0.64455086f, 0.976007164f},
-std::array<float,2>{0.445506483f, 0.505053997f},
-std::array<float,2>{0.774896026f, 0.139470831f},
-std::array<float,2>{0.262347847f, 0.0783411786f},
-std::array<float,2>{0.916670918f, 0.646281183f},
-std::array<float,2>{0.00948179886f, 0.839815676f},
-std::array<float,2>{0.569131315f, 0.371194422f},
-std::array<float,2>{0.41042614f, 0.279004663f},
-std::array<float,2>{0.861537576f, 0.775344133f},
-std::array<float,2>{0.210959509f, 0.72223407f},
-std::array<float,2>{0.709252834f, 0.0192057174f},
-std::array<float,2>{0.0681669489f, 0.194432974f},
-std::array<float,2>{0.560424924f, 0.563886523f},
-std::array<float,2>{0.3344886f, 0.893366396f},
-std::array<float,2>{0.948291838f, 0.397126734f},
-std::array<float,2>{0.035901133f, 0.340042561f},
-std::array<float,2>{0.596132338f, 0.852859378f},
-std::array<float,2>{0.284161508f, 0.680544496f},
-std::array<float,2>{0.886114061f, 0.106422752f},
-std::array<float,2>{0.499538422f, 0.158684239f},
-std::array<float,2>{0.794315875f, 0.558612287f},
-std::array<float,2>{0.152583271f, 0.948622465f},
-std::array<float,2>{0.678365409f, 0.439291835f},
-std::array<float,2>{0.347761095f, 0.437110871f},
-std::array<float,2>{0.978042603f, 0.914230764f},
-std::array<float,2>{0.111399777f, 0.604580879f},
-std::array<float,2>{0.519071281f, 0.241967738f},
-std::array<float,2>{0.227597594f, 0.0541265495f},
-std::array<float,2>{0.721833527f, 0.693540454f},
-std::array<float,2>{0.375528723f, 0.784127653f},
-std::array<float,2>{0.835589826f, 0.303643078f},
-std::array<float,2>{0.189486355f, 0.295207053f},
-std::array<float,2>{0.691782296f, 0.811440706f},
-std::array<float,2>{0.435554862f, 0.716525316f},
-std::array<float,2>{0.854059041f, 0.0417640768f},
-std::array<float,2>{0.315354884f, 0.223895863f},
-std::array<float,2>{0.962316751f, 0.618165195f},
-std::array<float,2>{0.0908551514f, 0.922592402f},
-std::array<float,2>{0.538133621f, 0.418760568f},
-std::array<float,2>{0.455717146f, 0.453404456f},
-std::array<float,2>{0.763371944f, 0.966696978f},
-std::array<float,2>{0.162818626f, 0.538315415f},
-std::array<float,2>{0.626048148f, 0.179875612f},
-std::array<float,2>{0.0193756465f, 0.122595645f},
-std::array<float,2>{0.584578037f, 0.671788692f},
-std::array<float,2>{0.280363798f, 0.86708945f},
-std::array<float,2>{0.935939133f, 0.318663776f},
-std::array<float,2>{0.108588971f, 0.385709137f},
-std::array<float,2>{0.512359142f, 0.875843942f},
-std::array<float,2>{0.366375148f, 0.588546455f},
-std::array<float,2>{0.985227287f, 0.205579892f},
-std::array<float,2>{0.394080281f, 0.0142612187f},
-std::array<float,2>{0.824359894f, 0.735636115f},
-std::array<float,2>{0.236736059f, 0.757088006f},
-std::array<float,2>{0.744143426f, 0.253507286f},
-std::array<float,2>{0.311057359f, 0.349404544f},
-std::array<float,2>{0.897951305f, 0.822643757f},
-std::array<float,2>{0.0572387502f, 0.631259918f},
-std::array<float,2>{0.619447172f, 0.0779944807f},
-std::array<float,2>{0.137001157f, 0.144466251f},
-std::array<float,2>{0.669658542f, 0.529133201f},
-std::array<float,2>{0.468862653f, 0.984464407f},
-std::array<float,2>{0.799572349f, 0.476982743f},
-std::array<float,2>{0.129291624f, 0.39374873f},
-std::array<float,2>{0.657786131f, 0.896188855f},
-std::array<float,2>{0.480222225f, 0.56855607f},
-std::array<float,2>{0.812200606f, 0.18848899f},
-std::array<float,2>{0.302190781f, 0.0219607111f},
-std::array<float,2>{0.905950904f, 0.724888086f},
-std::array<float,2>{0.0512901321f, 0.777782321f},
-std::array<float,2>{0.611827433f, 0.275700808f},
-std::array<float,2>{0.404393762f, 0.368402392f},
-std::array<float,2>{0.820274413f, 0.84070015f},
-std::array<float,2>{0.243034005f, 0.6418975f},
-std::array<float,2>{0.735216856f, 0.0827103555f},
-std::array<float,2>{0.101043426f, 0.135101467f},
-std::array<float,2>{0.501364291f, 0.503489852f},
-std::array<float,2>{0.367604673f, 0.969743192f},
-std::array<float,2>{0.999939859f, 0.484878361f},
-std::array<float,2>{0.0288219023f, 0.29854396f},
-std::array<float,2>{0.59214592f, 0.786025345f},
-std::array<float,2>{0.267824084f, 0.6883232f},
-std::array<float,2>{0.924744904f, 0.0501236245f},
-std::array<float,2>{0.465925306f, 0.23664993f},
-std::array<float,2>{0.755108654f, 0.607909024f},
-std::array<float,2>{0.169305086f, 0.920166194f},
-std::array<float,2>{0.637383759f, 0.432711631f},
-std::array<float,2>{0.322316051f, 0.444929302f},
-std::array<float,2>{0.957530439f, 0.949593365f},
-std::array<float,2>{0.0835073739f, 0.556810021f},
-std::array<float,2>{0.543287754f, 0.163885131f},
-std::array<float,2>{0.195955202f, 0.10378021f},
-std::array<float,2>{0.702787578f, 0.68360287f},
-std::array<float,2>{0.421965033f, 0.858361781f},
-std::array<float,2>{0.851018786f, 0.338801205f},
-std::array<float,2>{0.224195376f, 0.314024478f},
-std::array<float,2>{0.731753469f, 0.861857831f},
-std::array<float,2>{0.384182066f, 0.665949166f},
-std::array<float,2>{0.840042889f, 0.118994653f},
-std::array<float,2>{0.359115005f, 0.187387824f},
-std::array<float,2>{0.970302939f, 0.531383753f},
-std::array<float,2>{0.124575555f, 0.964043319f},
-std::array<float,2>{0.529586196f, 0.459789962f},
-std::array<float,2>{0.491259247f, 0.415109038f},
-std::array<float,2>{0.786420763f, 0.92954874f},
-std::array<float,2>{0.148416683f, 0.624020696f},
-std::array<float,2>{0.683263421f, 0.219436437f},
-std::array<float,2>{0.0407190062f, 0.0464742854f},
-std::array<float,2>{0.604680896f, 0.71178323f},
-std::array<float,2>{0.295648187f, 0.807968199f},
-std::array<float,2>{0.880821347f, 0.290198743f},
-std::array<float,2>{0.071404539f, 0.48162812f},
-std::array<float,2>{0.553520977f, 0.991166592f},
-std::array<float,2>{0.339455009f, 0.524857104f},
-std::array<float,2>{0.940377891f, 0.147473708f},
-std::array<float,2>{0.418420941f, 0.0732052177f},
-std::array<float,2>{0.867882013f, 0.626559317f},
-std::array<float,2>{0.206614509f, 0.827832639f},
-std::array<float,2>{0.716938317f, 0.345258147f},
-std::array<float,2>{0.253052175f, 0.254530191f},
-std::array<float,2>{0.911100686f, 0.75003463f},
-std::array<float,2>{0.0036598572f, 0.741754413f},
-std::array<float,2>{0.57238853f, 0.0100852586f},
-std::array<float,2>{0.185654894f, 0.210401431f},
-std::array<float,2>{0.654618382f, 0.590937078f},
-std::array<float,2>{0.440644771f, 0.882393241f},
-std::array<float,2>{0.770920873f, 0.390364796f},
-std::array<float,2>{0.217940986f, 0.468469232f},
-std::array<float,2>{0.705165148f, 0.955298781f},
-std::array<float,2>{0.406932533f, 0.542409599f},
-std::array<float,2>{0.863982618f, 0.177743703f},
-std::array<float,2>{0.33127436f, 0.116673343f},
-std::array<float,2>{0.95266372f, 0.662065983f},
-std::array<float,2>{0.0640118718f, 0.868631005f},
-std::array<float,2>{0.554745793f, 0.320817858f},
-std::array<float,2>{0.452173322f, 0.28135559f},
-std::array<float,2>{0.779574037f, 0.804626942f},
-std::array<float,2>{0.175449431f, 0.705220222f},
-std::array<float,2>{0.640705705f, 0.0343350619f},
-std::array<float,2>{0.0129732927f, 0.231943965f},
-std::array<float,2>{0.563906014f, 0.61133635f},
-std::array<float,2>{0.258787632f, 0.93225795f},
-std::array<float,2>{0.918353796f, 0.409056932f},
-std::array<float,2>{0.115180008f, 0.354023188f},
-std::array<float,2>{0.520535886f, 0.813717484f},
-std::array<float,2>{0.347600639f, 0.633395851f},
-std::array<float,2>{0.981965363f, 0.0631826222f},
-std::array<float,2>{0.382289767f, 0.155426562f},
-std::array<float,2>{0.828333497f, 0.520613432f},
-std::array<float,2>{0.234236389f, 0.994293332f},
-std::array<float,2>{0.723922014f, 0.4726623f},
-std::array<float,2>{0.285452336f, 0.377569169f},
-std::array<float,2>{0.888829887f, 0.888273776f},
-std::array<float,2>{0.0348995477f, 0.58134079f},
-std::array<float,2>{0.599931419f, 0.211164549f},
-std::array<float,2>{0.151315242f, 0.00446080929f},
-std::array<float,2>{0.673205674f, 0.745905817f},
-std::array<float,2>{0.494517714f, 0.764805079f},
-std::array<float,2>{0.790536582f, 0.260601878f},
-std::array<float,2>{0.159845173f, 0.271683514f},
-std::array<float,2>{0.630203009f, 0.767037332f},
-std::array<float,2>{0.458799005f, 0.731579721f},
-std::array<float,2>{0.758975744f, 0.0237734728f},
-std::array<float,2>{0.276618063f, 0.203115106f},
-std::array<float,2>{0.930554688f, 0.571100175f},
-std::array<float,2>{0.0198947936f, 0.89878726f},
-std::array<float,2>{0.579727471f, 0.400396228f},
-std::array<float,2>{0.431905031f, 0.497605383f},
-std::array<float,2>{0.858370185f, 0.978907228f},
-std::array<float,2>{0.192373991f, 0.509025693f},
-std::array<float,2>{0.688026249f, 0.13252227f},
-std::array<float,2>{0.0880522653f, 0.0927438736f},
-std::array<float,2>{0.531989455f, 0.65050745f},
-std::array<float,2>{0.320106655f, 0.83243829f},
-std::array<float,2>{0.966444373f, 0.359711409f},
-std::array<float,2>{0.0617722459f, 0.424650162f},
-std::array<float,2>{0.622587562f, 0.913377166f},
-std::array<float,2>{0.305071771f, 0.599674523f},
-std::array<float,2>{0.893281221f, 0.244629741f},
-std::array<float,2>{0.473034084f, 0.0568377376f},
-std::array<float,2>{0.803651333f, 0.69623071f},
-std::array<float,2>{0.134564504f, 0.794800401f},
-std::array<float,2>{0.667386472f, 0.311146796f},
-std::array<float,2>{0.362760007f, 0.330856383f},
-std::array<float,2>{0.989921033f, 0.847386241f},
-std::array<float,2>{0.105327435f, 0.675297081f},
-std::array<float,2>{0.508730412f, 0.09852577f},
-std::array<float,2>{0.241765037f, 0.170971945f},
-std::array<float,2>{0.746775687f, 0.548855126f},
-std::array<float,2>{0.39744696f, 0.937561393f},
-std::array<float,2>{0.820673227f, 0.449536085f},
-std::array<float,2>{0.219881192f, 0.403518081f},
-std::array<float,2>{0.730059624f, 0.902837396f},
-std::array<float,2>{0.387096912f, 0.576335311f},
-std::array<float,2>{0.838402033f, 0.197959602f},
-std::array<float,2>{0.353814036f, 0.0274312925f},
-std::array<float,2>{0.973937035f, 0.727043033f},
-std::array<float,2>{0.119797118f, 0.770267665f},
-std::array<float,2>{0.523728788f, 0.26666984f},
-std::array<float,2>{0.488245785f, 0.36553207f},
-std::array<float,2>{0.78320992f, 0.829984188f},
-std::array<float,2>{0.140954778f, 0.652720332f},
-std::array<float,2>{0.685673773f, 0.0891446248f},
-std::array<float,2>{0.0439654067f, 0.127711788f},
-std::array<float,2>{0.607275009f, 0.515009701f},
-std::array<float,2>{0.291483968f, 0.982136488f},
-std::array<float,2>{0.878605902f, 0.494091392f},
-std::array<float,2>{0.0759231523f, 0.3074027f},
-std::array<float,2>{0.549067795f, 0.790333092f},
-std::array<float,2>{0.340424269f, 0.702942371f},
-std::array<float,2>{0.942922413f, 0.0595850833f},
-std::array<float,2>{0.414410055f, 0.249671131f},
-std::array<float,2>{0.873518765f, 0.594676554f},
-std::array<float,2>{0.210007966f, 0.909748971f},
-std::array<float,2>{0.712570488f, 0.427273184f},
-std::array<float,2>{0.254904598f, 0.446102917f},
-std::array<float,2>{0.906407714f, 0.944351017f},
-std::array<float,2>{0.00489786919f, 0.552676916f},
-std::array<float,2>{0.57701689f, 0.165713072f},
-std::array<float,2>{0.180020794f, 0.0947717652f},
-std::array<float,2>{0.64848572f, 0.676158786f},
-std::array<float,2>{0.442042321f, 0.849794328f},
-std::array<float,2>{0.765916169f, 0.334847331f},
-std::array<float,2>{0.127840161f, 0.324854881f},
-std::array<float,2>{0.66063571f, 0.871940076f},
-std::array<float,2>{0.480928391f, 0.659211576f},
-std::array<float,2>{0.805609047f, 0.111233987f},
-std::array<float,2>{0.300490946f, 0.172466829f},
-std::array<float,2>{0.900105953f, 0.545043349f},
-std::array<float,2>{0.0482977703f, 0.957852125f},
-std::array<float,2>{0.615358293f, 0.46332109f},
-std::array<float,2>{0.401676387f, 0.412661374f},
-std::array<float,2>{0.815175593f, 0.93746382f},
-std::array<float,2>{0.249390617f, 0.616340458f},
-std::array<float,2>{0.741345584f, 0.228207618f},
-std::array<float,2>{0.0937536135f, 0.0368369184f},
-std::array<float,2>{0.50515914f, 0.708923697f},
-std::array<float,2>{0.373194784f, 0.799101233f},
-std::array<float,2>{0.993703485f, 0.287827164f},
-std::array<float,2>{0.0247999839f, 0.4710311f},
-std::array<float,2>{0.587384045f, 0.99658215f},
-std::array<float,2>{0.273166895f, 0.51684016f},
-std::array<float,2>{0.926585078f, 0.14998579f},
-std::array<float,2>{0.460951775f, 0.0675529689f},
-std::array<float,2>{0.751886129f, 0.639478087f},
-std::array<float,2>{0.166299477f, 0.820211291f},
-std::array<float,2>{0.634518147f, 0.358326435f},
-std::array<float,2>{0.324779034f, 0.263388604f},
-std::array<float,2>{0.953764617f, 0.761368632f},
-std::array<float,2>{0.0787175819f, 0.747301519f},
-std::array<float,2>{0.54213655f, 0.00084205548f},
-std::array<float,2>{0.202942356f, 0.216690317f},
-std::array<float,2>{0.698649585f, 0.582557201f},
-std::array<float,2>{0.427602649f, 0.885586917f},
-std::array<float,2>{0.844805121f, 0.380871892f},
-std::array<float,2>{0.16363363f, 0.455475122f},
-std::array<float,2>{0.625531793f, 0.968721211f},
-std::array<float,2>{0.45687452f, 0.535709262f},
-std::array<float,2>{0.762240529f, 0.183000475f},
-std::array<float,2>{0.279980391f, 0.124110565f},
-std::array<float,2>{0.937228024f, 0.669446707f},
-std::array<float,2>{0.0181717947f, 0.864744246f},
-std::array<float,2>{0.585113823f, 0.316687375f},
-std::array<float,2>{0.437165529f, 0.293398172f},
-std::array<float,2>{0.854660273f, 0.810097694f},
-std::array<float,2>{0.190649435f, 0.716935098f},
-std::array<float,2>{0.693034768f, 0.0397509038f},
-std::array<float,2>{0.0905560479f, 0.226062357f},
-std::array<float,2>{0.537994742f, 0.619307339f},
-std::array<float,2>{0.316204995f, 0.925398767f},
-std::array<float,2>{0.961648226f, 0.421527237f},
-std::array<float,2>{0.0580879934f, 0.351353616f},
-std::array<float,2>{0.621059299f, 0.821767807f},
-std::array<float,2>{0.311657786f, 0.630013287f},
-std::array<float,2>{0.896575809f, 0.0742251724f},
-std::array<float,2>{0.470312327f, 0.142024726f},
-std::array<float,2>{0.800069094f, 0.530475497f},
-std::array<float,2>{0.138620883f, 0.987338483f},
-std::array<float,2>{0.668815613f, 0.478641272f},
-std::array<float,2>{0.365771592f, 0.383409232f},
-std::array<float,2>{0.985554993f, 0.877516866f},
-std::array<float,2>{0.10787189f, 0.586632967f},
-std::array<float,2>{0.513556719f, 0.203995481f},
-std::array<float,2>{0.237376928f, 0.0132909724f},
-std::array<float,2>{0.745301366f, 0.737251699f},
-std::array<float,2>{0.392814487f, 0.755114615f},
-std::array<float,2>{0.825838864f, 0.250249505f},
-std::array<float,2>{0.212716356f, 0.280174017f},
-std::array<float,2>{0.710352659f, 0.776595354f},
-std::array<float,2>{0.411615133f, 0.720295727f},
-std::array<float,2>{0.862632096f, 0.0170877818f},
-std::array<float,2>{0.335169345f, 0.191787988f},
-std::array<float,2>{0.947267234f, 0.564730883f},
-std::array<float,2>{0.0672293156f, 0.891747117f},
-std::array<float,2>{0.55910027f, 0.396352649f},
-std::array<float,2>{0.446665019f, 0.48952952f},
-std::array<float,2>{0.773504019f, 0.973456442f},
-std::array<float,2>{0.17818144f, 0.506273806f},
-std::array<float,2>{0.646249294f, 0.137632445f},
-std::array<float,2>{0.00791755598f, 0.0812397972f},
-std::array<float,2>{0.56994009f, 0.648274958f},
-std::array<float,2>{0.263586819f, 0.836152494f},
-std::array<float,2>{0.917086959f, 0.374484509f},
-std::array<float,2>{0.112593308f, 0.434184432f},
-std::array<float,2>{0.517593324f, 0.917142689f},
-std::array<float,2>{0.348902225f, 0.602435648f},
-std::array<float,2>{0.97659725f, 0.239544287f},
-std::array<float,2>{0.376134574f, 0.0509410314f},
-std::array<float,2>{0.83454299f, 0.693136096f},
-std::array<float,2>{0.22690621f, 0.781556189f},
-std::array<float,2>{0.721232712f, 0.302165329f},
-std::array<float,2>{0.284230471f, 0.341883838f},
-std::array<float,2>{0.885705352f, 0.853955686f},
-std::array<float,2>{0.0363817699f, 0.683307827f},
-std::array<float,2>{0.597348094f, 0.10869357f},
-std::array<float,2>{0.153434351f, 0.157113701f},
-std::array<float,2>{0.678766191f, 0.561101139f},
-std::array<float,2>{0.498310834f, 0.946326375f},
-std::array<float,2>{0.79344666f, 0.44020915f},
-std::array<float,2>{0.146793947f, 0.416067302f},
-std::array<float,2>{0.681735754f, 0.927707195f},
-std::array<float,2>{0.490950853f, 0.621165633f},
-std::array<float,2>{0.785258532f, 0.221906573f},
-std::array<float,2>{0.296044499f, 0.0441910625f},
-std::array<float,2>{0.879678369f, 0.714702129f},
-std::array<float,2>{0.0392363332f, 0.80643636f},
-std::array<float,2>{0.604283094f, 0.291073889f},
-std::array<float,2>{0.383369893f, 0.314932436f},
-std::array<float,2>{0.841563165f, 0.861224771f},
-std::array<float,2>{0.222769499f, 0.667559326f},
-std::array<float,2>{0.730579734f, 0.119586304f},
-std::array<float,2>{0.123500794f, 0.184258685f},
-std::array<float,2>{0.53074342f, 0.534692287f},
-std::array<float,2>{0.358089447f, 0.960964501f},
-std::array<float,2>{0.969421089f, 0.457625151f},
-std::array<float,2>{0.00199718704f, 0.25635758f},
-std::array<float,2>{0.573990405f, 0.752102375f},
-std::array<float,2>{0.25246942f, 0.738477826f},
-std::array<float,2>{0.911501884f, 0.00852840953f},
-std::array<float,2>{0.440420717f, 0.208243176f},
-std::array<float,2>{0.76972276f, 0.593066931f},
-std::array<float,2>{0.187047601f, 0.880393624f},
-std::array<float,2>{0.655371308f, 0.38855195f},
-std::array<float,2>{0.33867541f, 0.483824074f},
-std::array<float,2>{0.940863252f, 0.988635182f},
-std::array<float,2>{0.0709885061f, 0.527069032f},
-std::array<float,2>{0.554218411f, 0.145310014f},
-std::array<float,2>{0.205995545f, 0.0719045475f},
-std::array<float,2>{0.717982531f, 0.62736553f},
-std::array<float,2>{0.419523716f, 0.82595259f},
-std::array<float,2>{0.868294477f, 0.34663707f},
-std::array<float,2>{0.24375695f, 0.369220972f},
-std::array<float,2>{0.735875249f, 0.843178749f},
-std::array<float,2>{0.40583238f, 0.643679023f},
-std::array<float,2>{0.818796217f, 0.0855074003f},
-std::array<float,2>{0.368787795f, 0.133060336f},
-std::array<float,2>{0.998141229f, 0.501440704f},
-std::array<float,2>{0.0996099561f, 0.971655011f},
-std::array<float,2>{0.500147998f, 0.487333655f},
-std::array<float,2>{0.478902549f, 0.392481953f},
-std::array<float,2>{0.810881972f, 0.896697462f},
-std::array<float,2>{0.13052842f, 0.567851722f},
-std::array<float,2>{0.656699359f, 0.19125928f},
-std::array<float,2>{0.0519945547f, 0.0204262547f},
-std::array<float,2>{0.612979472f, 0.722940862f},
-std::array<float,2>{0.301357925f, 0.781130075f},
-std::array<float,2>{0.904955685f, 0.275088429f},
-std::array<float,2>{0.082036674f, 0.441491455f},
-std::array<float,2>{0.544816077f, 0.952681482f},
-std::array<float,2>{0.323492795f, 0.555441558f},
-std::array<float,2>{0.958369195f, 0.161886156f},
-std::array<float,2>{0.423216045f, 0.102597952f},
-std::array<float,2>{0.850017488f, 0.68715775f},
-std::array<float,2>{0.197160631f, 0.856719375f},
-std::array<float,2>{0.702044845f, 0.337012887f},
-std::array<float,2>{0.269388676f, 0.299799711f},
-std::array<float,2>{0.925033271f, 0.788464248f},
-std::array<float,2>{0.0278396178f, 0.689727008f},
-std::array<float,2>{0.593310118f, 0.0481243171f},
-std::array<float,2>{0.168344021f, 0.234938964f},
-std::array<float,2>{0.638396323f, 0.606971383f},
-std::array<float,2>{0.464928389f, 0.919692755f},
-std::array<float,2>{0.754626215f, 0.431518257f},
-std::array<float,2>{0.193318054f, 0.499980181f},
-std::array<float,2>{0.689359248f, 0.977341712f},
-std::array<float,2>{0.432698697f, 0.511222303f},
-std::array<float,2>{0.858551979f, 0.130290344f},
-std::array<float,2>{0.318655074f, 0.0907769427f},
-std::array<float,2>{0.965718567f, 0.64990592f},
-std::array<float,2>{0.0896265581f, 0.835059166f},
-std::array<float,2>{0.53293997f, 0.361888558f},
-std::array<float,2>{0.457660943f, 0.271452338f},
-std::array<float,2>{0.758751273f, 0.767800689f},
-std::array<float,2>{0.159089699f, 0.732499123f},
-std::array<float,2>{0.629741967f, 0.0268682986f},
-std::array<float,2>{0.0209793933f, 0.199555114f},
-std::array<float,2>{0.578576922f, 0.572366893f},
-std::array<float,2>{0.275507361f, 0.901525021f},
-std::array<float,2>{0.930888057f, 0.399322838f},
-std::array<float,2>{0.104471274f, 0.328304917f},
-std::array<float,2>{0.508805275f, 0.84536773f},
-std::array<float,2>{0.361777067f, 0.672406673f},
-std::array<float,2>{0.989197373f, 0.0998523235f},
-std::array<float,2>{0.398090988f, 0.168806881f},
-std::array<float,2>{0.821786702f, 0.548110545f},
-std::array<float,2>{0.240704268f, 0.941144228f},
-std::array<float,2>{0.747823179f, 0.45185563f},
-std::array<float,2>{0.306079865f, 0.423548728f},
-std::array<float,2>{0.893877268f, 0.911120176f},
-std::array<float,2>{0.0608996153f, 0.597914755f},
-std::array<float,2>{0.621656477f, 0.242492899f},
-std::array<float,2>{0.133161008f, 0.0565096326f},
-std::array<float,2>{0.666204453f, 0.697771132f},
-std::array<float,2>{0.4737432f, 0.796582401f},
-std::array<float,2>{0.803867698f, 0.30953908f},
-std::array<float,2>{0.174469784f, 0.283262104f},
-std::array<float,2>{0.642304897f, 0.802327573f},
-std::array<float,2>{0.451681048f, 0.704691589f},
-std::array<float,2>{0.780445755f, 0.0330997556f},
-std::array<float,2>{0.259249836f, 0.233416066f},
-std::array<float,2>{0.919297755f, 0.610061824f},
-std::array<float,2>{0.0120360935f, 0.930689692f},
-std::array<float,2>{0.563016355f, 0.406366527f},
-std::array<float,2>{0.408190489f, 0.46609664f},
-std::array<float,2>{0.865030766f, 0.954555392f},
-std::array<float,2>{0.217007503f, 0.539694011f},
-std::array<float,2>{0.706991732f, 0.176584303f},
-std::array<float,2>{0.0627170578f, 0.11446926f},
-std::array<float,2>{0.556008935f, 0.662970543f},
-std::array<float,2>{0.330187887f, 0.869732022f},
-std::array<float,2>{0.952081561f, 0.323866248f},
-std::array<float,2>{0.0332419239f, 0.376633078f},
-std::array<float,2>{0.60106343f, 0.88959527f},
-std::array<float,2>{0.286362022f, 0.578719914f},
-std::array<float,2>{0.890531301f, 0.214067101f},
-std::array<float,2>{0.495909482f, 0.00706948619f},
-std::array<float,2>{0.789256096f, 0.742356777f},
-std::array<float,2>{0.152139455f, 0.762984157f},
-std::array<float,2>{0.671987772f, 0.257901907f},
-std::array<float,2>{0.346150786f, 0.352874786f},
-std::array<float,2>{0.981354475f, 0.814673841f},
-std::array<float,2>{0.113577165f, 0.635991871f},
-std::array<float,2>{0.52043134f, 0.0653109848f},
-std::array<float,2>{0.232472122f, 0.153042257f},
-std::array<float,2>{0.723235786f, 0.522459865f},
-std::array<float,2>{0.381236047f, 0.993613899f},
-std::array<float,2>{0.829303563f, 0.474867731f},
-std::array<float,2>{0.208862677f, 0.427982599f},
-std::array<float,2>{0.714217901f, 0.906700909f},
-std::array<float,2>{0.417249054f, 0.596980989f},
-std::array<float,2>{0.871575534f, 0.247834727f},
-std::array<float,2>{0.343283445f, 0.0618487708f},
-std::array<float,2>{0.943557441f, 0.700810611f},
-std::array<float,2>{0.0774887726f, 0.791635931f},
-std::array<float,2>{0.547344089f, 0.304716706f},
-std::array<float,2>{0.444717824f, 0.333194822f},
-std::array<float,2>{0.768736124f, 0.84861517f},
-std::array<float,2>{0.182331815f, 0.677909374f},
-std::array<float,2>{0.651732385f, 0.0961641371f},
-std::array<float,2>{0.0066593322f, 0.167490453f},
-std::array<float,2>{0.575716913f, 0.553736329f},
-std::array<float,2>{0.256601691f, 0.943159521f},
-std::array<float,2>{0.909692585f, 0.447518498f},
-std::array<float,2>{0.118571348f, 0.268781066f},
-std::array<float,2>{0.527285516f, 0.771673203f},
-std::array<float,2>{0.353068292f, 0.729394913f},
-std::array<float,2>{0.974920571f, 0.0298961233f},
-std::array<float,2>{0.389701307f, 0.19557254f},
-std::array<float,2>{0.836697161f, 0.575585723f},
-std::array<float,2>{0.221647918f, 0.905392766f},
-std::array<float,2>{0.726650715f, 0.4053545f},
-std::array<float,2>{0.290154099f, 0.494513661f},
-std::array<float,2>{0.875515163f, 0.984263062f},
-std::array<float,2>{0.046652481f, 0.512341499f},
-std::array<float,2>{0.607966065f, 0.125249058f},
-std::array<float,2>{0.143402696f, 0.086759977f},
-std::array<float,2>{0.684455037f, 0.655615211f},
-std::array<float,2>{0.486157775f, 0.831986189f},
-std::array<float,2>{0.781765878f, 0.363896489f},
-std::array<float,2>{0.165706113f, 0.356981605f},
-std::array<float,2>{0.635697067f, 0.817413509f},
-std::array<float,2>{0.4633331f, 0.637099981f},
-std::array<float,2>{0.751995921f, 0.0693019032f},
-std::array<float,2>{0.271330744f, 0.152073309f},
-std::array<float,2>{0.928805113f, 0.517884851f},
-std::array<float,2>{0.0258108508f, 0.999040067f},
-std::array<float,2>{0.588482022f, 0.47021839f},
-std::array<float,2>{0.42861706f, 0.380761981f},
-std::array<float,2>{0.847586751f, 0.884554029f},
-std::array<float,2>{0.20035167f, 0.584987283f},
-std::array<float,2>{0.697072685f, 0.218093216f},
-std::array<float,2>{0.0816117376f, 0.00314883096f},
-std::array<float,2>{0.539793909f, 0.749182463f},
-std::array<float,2>{0.327107787f, 0.759408772f},
-std::array<float,2>{0.956574619f, 0.263715804f},
-std::array<float,2>{0.0503811911f, 0.461038589f},
-std::array<float,2>{0.614065886f, 0.960499763f},
-std::array<float,2>{0.298042178f, 0.544079423f},
-std::array<float,2>{0.902315378f, 0.17531918f},
-std::array<float,2>{0.482582748f, 0.112708732f},
-std::array<float,2>{0.807477236f, 0.656566501f},
-std::array<float,2>{0.126489133f, 0.874871016f},
-std::array<float,2>{0.662881434f, 0.327813774f},
-std::array<float,2>{0.371867865f, 0.28524521f},
-std::array<float,2>{0.995752633f, 0.797281742f},
-std::array<float,2>{0.096605733f, 0.709188402f},
-std::array<float,2>{0.506935358f, 0.0374703333f},
-std::array<float,2>{0.246127129f, 0.229276612f},
-std::array<float,2>{0.738928199f, 0.615025282f},
-std::array<float,2>{0.399942786f, 0.934522808f},
-std::array<float,2>{0.813717306f, 0.410641074f},
-std::array<float,2>{0.140287384f, 0.477662504f},
-std::array<float,2>{0.671544313f, 0.985894322f},
-std::array<float,2>{0.472030669f, 0.528107285f},
-std::array<float,2>{0.79824698f, 0.143553466f},
-std::array<float,2>{0.308814943f, 0.0764535889f},
-std::array<float,2>{0.89539957f, 0.63196677f},
-std::array<float,2>{0.0562176332f, 0.823661029f},
-std::array<float,2>{0.618406355f, 0.34792769f},
-std::array<float,2>{0.391021132f, 0.25280568f},
-std::array<float,2>{0.827172399f, 0.756752312f},
-std::array<float,2>{0.23563309f, 0.734918475f},
-std::array<float,2>{0.743528068f, 0.0155206267f},
-std::array<float,2>{0.106686339f, 0.206725314f},
-std::array<float,2>{0.514614344f, 0.589114606f},
-std::array<float,2>{0.364079744f, 0.876182556f},
-std::array<float,2>{0.987040222f, 0.385912359f},
-std::array<float,2>{0.017291896f, 0.319679499f},
-std::array<float,2>{0.582566381f, 0.865389407f},
-std::array<float,2>{0.278336495f, 0.670063496f},
-std::array<float,2>{0.935530424f, 0.121847317f},
-std::array<float,2>{0.45474124f, 0.180774242f},
-std::array<float,2>{0.764011919f, 0.537502885f},
-std::array<float,2>{0.160212398f, 0.96512711f},
-std::array<float,2>{0.628204346f, 0.454957426f},
-std::array<float,2>{0.314123273f, 0.419548541f},
-std::array<float,2>{0.963334858f, 0.923223972f},
-std::array<float,2>{0.0934065804f, 0.617461979f},
-std::array<float,2>{0.536679924f, 0.223241165f},
-std::array<float,2>{0.189065069f, 0.0428828783f},
-std::array<float,2>{0.694073379f, 0.715442955f},
-std::array<float,2>{0.435241431f, 0.812182605f},
-std::array<float,2>{0.853415728f, 0.29628399f},
-std::array<float,2>{0.23024869f, 0.304127276f},
-std::array<float,2>{0.720627785f, 0.784977317f},
-std::array<float,2>{0.37698701f, 0.694719434f},
-std::array<float,2>{0.833104134f, 0.0527548566f},
-std::array<float,2>{0.351267844f, 0.24064827f},
-std::array<float,2>{0.978615999f, 0.603789687f},
-std::array<float,2>{0.110739298f, 0.91590333f},
-std::array<float,2>{0.516260087f, 0.435799092f},
-std::array<float,2>{0.496256083f, 0.4379161f},
-std::array<float,2>{0.796873152f, 0.948050022f},
-std::array<float,2>{0.156096265f, 0.560038984f},
-std::array<float,2>{0.677336276f, 0.159891799f},
-std::array<float,2>{0.0386697017f, 0.107249171f},
-std::array<float,2>{0.593979776f, 0.681220472f},
-std::array<float,2>{0.282325625f, 0.851563931f},
-std::array<float,2>{0.88302362f, 0.341647327f},
-std::array<float,2>{0.0696397498f, 0.39816162f},
-std::array<float,2>{0.56155169f, 0.894314766f},
-std::array<float,2>{0.332282424f, 0.563212276f},
-std::array<float,2>{0.945994377f, 0.193414196f},
-std::array<float,2>{0.413221121f, 0.0185362361f},
-std::array<float,2>{0.860199034f, 0.720990479f},
-std::array<float,2>{0.213805839f, 0.774264455f},
-std::array<float,2>{0.708542824f, 0.278216511f},
-std::array<float,2>{0.264128774f, 0.372602791f},
-std::array<float,2>{0.914478779f, 0.838787436f},
-std::array<float,2>{0.0102409637f, 0.644794941f},
-std::array<float,2>{0.567624211f, 0.0796303898f},
-std::array<float,2>{0.177623898f, 0.14006117f},
-std::array<float,2>{0.647524655f, 0.504230142f},
-std::array<float,2>{0.448588073f, 0.975034058f},
-std::array<float,2>{0.777177393f, 0.490241677f},
-std::array<float,2>{0.184096962f, 0.389553666f},
-std::array<float,2>{0.653593659f, 0.881562293f},
-std::array<float,2>{0.439003557f, 0.590681136f},
-std::array<float,2>{0.773249328f, 0.209603325f},
-std::array<float,2>{0.251415163f, 0.0116380323f},
-std::array<float,2>{0.913691401f, 0.740824044f},
-std::array<float,2>{0.000132465124f, 0.751012266f},
-std::array<float,2>{0.571337223f, 0.255848199f},
-std::array<float,2>{0.42117539f, 0.344541401f},
-std::array<float,2>{0.870899975f, 0.827049315f},
-std::array<float,2>{0.204786688f, 0.62554276f},
-std::array<float,2>{0.715628445f, 0.0736371279f},
-std::array<float,2>{0.0726863891f, 0.146636337f},
-std::array<float,2>{0.551629305f, 0.524184406f},
-std::array<float,2>{0.336259127f, 0.99153173f},
-std::array<float,2>{0.939361811f, 0.481362164f},
-std::array<float,2>{0.0426049605f, 0.289498299f},
-std::array<float,2>{0.602106094f, 0.807121873f},
-std::array<float,2>{0.294262856f, 0.712206662f},
-std::array<float,2>{0.880936801f, 0.0458357185f},
-std::array<float,2>{0.48855859f, 0.21978274f},
-std::array<float,2>{0.787567317f, 0.624073565f},
-std::array<float,2>{0.144657597f, 0.928263128f},
-std::array<float,2>{0.681471109f, 0.414091885f},
-std::array<float,2>{0.355666399f, 0.460790813f},
-std::array<float,2>{0.972614825f, 0.96377784f},
-std::array<float,2>{0.121365316f, 0.533175349f},
-std::array<float,2>{0.528816402f, 0.186120644f},
-std::array<float,2>{0.224771872f, 0.118021332f},
-std::array<float,2>{0.732781053f, 0.664798975f},
-std::array<float,2>{0.386254758f, 0.863110542f},
-std::array<float,2>{0.842141747f, 0.313471735f},
-std::array<float,2>{0.198361337f, 0.338894546f},
-std::array<float,2>{0.700714231f, 0.858801663f},
-std::array<float,2>{0.425661474f, 0.68507719f},
-std::array<float,2>{0.848134995f, 0.105200045f},
-std::array<float,2>{0.321908832f, 0.162567735f},
-std::array<float,2>{0.9607656f, 0.558422208f},
-std::array<float,2>{0.084349826f, 0.950437784f},
-std::array<float,2>{0.546073377f, 0.44376123f},
-std::array<float,2>{0.46705249f, 0.432517231f},
-std::array<float,2>{0.75676924f, 0.920911252f},
-std::array<float,2>{0.171242952f, 0.608494103f},
-std::array<float,2>{0.639127791f, 0.237917036f},
-std::array<float,2>{0.0310573746f, 0.0495583937f},
-std::array<float,2>{0.591264606f, 0.688942015f},
-std::array<float,2>{0.267043352f, 0.78637141f},
-std::array<float,2>{0.922480404f, 0.29737705f},
-std::array<float,2>{0.0977108255f, 0.485896915f},
-std::array<float,2>{0.502408028f, 0.969394863f},
-std::array<float,2>{0.371017963f, 0.502106369f},
-std::array<float,2>{0.996265829f, 0.136358202f},
-std::array<float,2>{0.403561324f, 0.0836553797f},
-std::array<float,2>{0.816789865f, 0.641074955f},
-std::array<float,2>{0.245180964f, 0.841646314f},
-std::array<float,2>{0.736855209f, 0.367867053f},
-std::array<float,2>{0.303366303f, 0.276729405f},
-std::array<float,2>{0.904041231f, 0.778800309f},
-std::array<float,2>{0.0530492924f, 0.726395249f},
-std::array<float,2>{0.610886514f, 0.0233481899f},
-std::array<float,2>{0.132085904f, 0.187921941f},
-std::array<float,2>{0.658936739f, 0.569460809f},
-std::array<float,2>{0.477102518f, 0.894847751f},
-std::array<float,2>{0.809781075f, 0.392579049f},
-std::array<float,2>{0.238703281f, 0.45043835f},
-std::array<float,2>{0.748909295f, 0.938937783f},
-std::array<float,2>{0.395274311f, 0.550032735f},
-std::array<float,2>{0.824064732f, 0.170585379f},
-std::array<float,2>{0.360539585f, 0.0991412848f},
-std::array<float,2>{0.99152267f, 0.674259782f},
-std::array<float,2>{0.10177014f, 0.845822871f},
-std::array<float,2>{0.510058999f, 0.33172223f},
-std::array<float,2>{0.47569415f, 0.311543286f},
-std::array<float,2>{0.801071703f, 0.793182433f},
-std::array<float,2>{0.135374829f, 0.696896553f},
-std::array<float,2>{0.664558887f, 0.0581732206f},
-std::array<float,2>{0.0592592321f, 0.245409146f},
-std::array<float,2>{0.624946713f, 0.601550162f},
-std::array<float,2>{0.307251632f, 0.912972867f},
-std::array<float,2>{0.89254421f, 0.42555967f},
-std::array<float,2>{0.086036332f, 0.360705197f},
-std::array<float,2>{0.53409344f, 0.833103359f},
-std::array<float,2>{0.317784756f, 0.651583016f},
-std::array<float,2>{0.967342019f, 0.0928120539f},
-std::array<float,2>{0.431093812f, 0.131367892f},
-std::array<float,2>{0.856655598f, 0.508198917f},
-std::array<float,2>{0.194195956f, 0.979743481f},
-std::array<float,2>{0.689638615f, 0.496576369f},
-std::array<float,2>{0.273697555f, 0.402239352f},
-std::array<float,2>{0.93289876f, 0.899474323f},
-std::array<float,2>{0.0233396012f, 0.57136941f},
-std::array<float,2>{0.581074655f, 0.201540351f},
-std::array<float,2>{0.157100126f, 0.0245350208f},
-std::array<float,2>{0.631148219f, 0.73141098f},
-std::array<float,2>{0.460451543f, 0.766548574f},
-std::array<float,2>{0.759923041f, 0.272944778f},
-std::array<float,2>{0.148810774f, 0.260920823f},
-std::array<float,2>{0.675588667f, 0.764478683f},
-std::array<float,2>{0.492792934f, 0.744889379f},
-std::array<float,2>{0.792719841f, 0.00504983077f},
-std::array<float,2>{0.287880868f, 0.212871626f},
-std::array<float,2>{0.8877846f, 0.580939054f},
-std::array<float,2>{0.0320033766f, 0.887096703f},
-std::array<float,2>{0.59794879f, 0.378299296f},
-std::array<float,2>{0.379848927f, 0.473965198f},
-std::array<float,2>{0.830892563f, 0.995706379f},
-std::array<float,2>{0.232391298f, 0.520455778f},
-std::array<float,2>{0.726403117f, 0.155088469f},
-std::array<float,2>{0.117182724f, 0.0639768764f},
-std::array<float,2>{0.522741139f, 0.63426888f},
-std::array<float,2>{0.344368935f, 0.813241005f},
-std::array<float,2>{0.983289123f, 0.355424911f},
-std::array<float,2>{0.0148562351f, 0.409311533f},
-std::array<float,2>{0.565599918f, 0.933550715f},
-std::array<float,2>{0.260618001f, 0.612658858f},
-std::array<float,2>{0.921499789f, 0.231401175f},
-std::array<float,2>{0.45026812f, 0.0334643312f},
-std::array<float,2>{0.779080093f, 0.706364453f},
-std::array<float,2>{0.173799366f, 0.803089321f},
-std::array<float,2>{0.643653572f, 0.282728702f},
-std::array<float,2>{0.330058008f, 0.322149813f},
-std::array<float,2>{0.950424373f, 0.867948651f},
-std::array<float,2>{0.0647971034f, 0.66107285f},
-std::array<float,2>{0.557013273f, 0.115348354f},
-std::array<float,2>{0.215239435f, 0.178742439f},
-std::array<float,2>{0.703186691f, 0.541051269f},
-std::array<float,2>{0.409685493f, 0.956437409f},
-std::array<float,2>{0.865931988f, 0.46705696f},
-std::array<float,2>{0.213174939f, 0.395973176f},
-std::array<float,2>{0.708455086f, 0.892304122f},
-std::array<float,2>{0.413683474f, 0.565416336f},
-std::array<float,2>{0.859391093f, 0.192023501f},
-std::array<float,2>{0.332774371f, 0.0171207357f},
-std::array<float,2>{0.945755243f, 0.719786465f},
-std::array<float,2>{0.070254609f, 0.777178586f},
-std::array<float,2>{0.562071562f, 0.279766262f},
-std::array<float,2>{0.449025482f, 0.37472862f},
-std::array<float,2>{0.776735842f, 0.836834311f},
-std::array<float,2>{0.177024513f, 0.647775054f},
-std::array<float,2>{0.64798522f, 0.0817124322f},
-std::array<float,2>{0.0106406445f, 0.136825413f},
-std::array<float,2>{0.568332732f, 0.506787181f},
-std::array<float,2>{0.264207274f, 0.973027527f},
-std::array<float,2>{0.914749444f, 0.48997575f},
-std::array<float,2>{0.11121957f, 0.302536786f},
-std::array<float,2>{0.515919745f, 0.781805813f},
-std::array<float,2>{0.351062506f, 0.692806184f},
-std::array<float,2>{0.979314804f, 0.0516353138f},
-std::array<float,2>{0.377618581f, 0.239822716f},
-std::array<float,2>{0.833556175f, 0.60174185f},
-std::array<float,2>{0.229571566f, 0.917514384f},
-std::array<float,2>{0.720205665f, 0.433939099f},
-std::array<float,2>{0.283040702f, 0.439791739f},
-std::array<float,2>{0.883499265f, 0.946800828f},
-std::array<float,2>{0.0384552293f, 0.560994625f},
-std::array<float,2>{0.594451189f, 0.156471178f},
-std::array<float,2>{0.155721903f, 0.109331094f},
-std::array<float,2>{0.676823139f, 0.682667255f},
-std::array<float,2>{0.496983379f, 0.854383767f},
-std::array<float,2>{0.796202183f, 0.342528343f},
-std::array<float,2>{0.161080003f, 0.31714949f},
-std::array<float,2>{0.628476977f, 0.864841044f},
-std::array<float,2>{0.454306304f, 0.669090629f},
-std::array<float,2>{0.764603913f, 0.124622419f},
-std::array<float,2>{0.279170811f, 0.183153898f},
-std::array<float,2>{0.93493098f, 0.535304368f},
-std::array<float,2>{0.0169794187f, 0.968173265f},
-std::array<float,2>{0.582471788f, 0.455671459f},
-std::array<float,2>{0.434959501f, 0.421057135f},
-std::array<float,2>{0.852998137f, 0.92517513f},
-std::array<float,2>{0.188506067f, 0.619736433f},
-std::array<float,2>{0.693569422f, 0.226109564f},
-std::array<float,2>{0.0928187221f, 0.0392613374f},
-std::array<float,2>{0.536556661f, 0.717696309f},
-std::array<float,2>{0.313882649f, 0.80986923f},
-std::array<float,2>{0.96348989f, 0.29384321f},
-std::array<float,2>{0.0557401851f, 0.479402542f},
-std::array<float,2>{0.618920922f, 0.988137722f},
-std::array<float,2>{0.309292108f, 0.530888021f},
-std::array<float,2>{0.894967437f, 0.142338738f},
-std::array<float,2>{0.472415775f, 0.0747360289f},
-std::array<float,2>{0.798827827f, 0.630502224f},
-std::array<float,2>{0.139908716f, 0.821941793f},
-std::array<float,2>{0.67103827f, 0.350708902f},
-std::array<float,2>{0.363675028f, 0.250736922f},
-std::array<float,2>{0.986750662f, 0.755561948f},
-std::array<float,2>{0.107385062f, 0.736458242f},
-std::array<float,2>{0.513899922f, 0.0129015809f},
-std::array<float,2>{0.235926539f, 0.203308001f},
-std::array<float,2>{0.743808866f, 0.586166859f},
-std::array<float,2>{0.391238153f, 0.87706244f},
-std::array<float,2>{0.827911615f, 0.38297534f},
-std::array<float,2>{0.125980273f, 0.463864267f},
-std::array<float,2>{0.662168801f, 0.957296431f},
-std::array<float,2>{0.482968718f, 0.545586228f},
-std::array<float,2>{0.806915164f, 0.172086537f},
-std::array<float,2>{0.298476011f, 0.110427357f},
-std::array<float,2>{0.90173614f, 0.66011399f},
-std::array<float,2>{0.0499671586f, 0.87118876f},
-std::array<float,2>{0.613614202f, 0.324613214f},
-std::array<float,2>{0.399729282f, 0.287332654f},
-std::array<float,2>{0.814177752f, 0.799678326f},
-std::array<float,2>{0.247016713f, 0.708295047f},
-std::array<float,2>{0.738416672f, 0.0364998952f},
-std::array<float,2>{0.0958873555f, 0.227608472f},
-std::array<float,2>{0.507369041f, 0.617083609f},
-std::array<float,2>{0.37128675f, 0.936884999f},
-std::array<float,2>{0.995214701f, 0.412161052f},
-std::array<float,2>{0.0263131652f, 0.357789814f},
-std::array<float,2>{0.587958932f, 0.81952703f},
-std::array<float,2>{0.270769268f, 0.638957202f},
-std::array<float,2>{0.929574966f, 0.0679584295f},
-std::array<float,2>{0.463656127f, 0.149492741f},
-std::array<float,2>{0.752708912f, 0.517565072f},
-std::array<float,2>{0.165179104f, 0.996219695f},
-std::array<float,2>{0.634902835f, 0.471396178f},
-std::array<float,2>{0.326238066f, 0.381770194f},
-std::array<float,2>{0.956249177f, 0.88522619f},
-std::array<float,2>{0.0814384073f, 0.582300305f},
-std::array<float,2>{0.539105833f, 0.21628055f},
-std::array<float,2>{0.200946406f, 0.000294380763f},
-std::array<float,2>{0.696611166f, 0.748009264f},
-std::array<float,2>{0.427753687f, 0.760769904f},
-std::array<float,2>{0.84690845f, 0.263095886f},
-std::array<float,2>{0.22073701f, 0.26730147f},
-std::array<float,2>{0.727113605f, 0.769743443f},
-std::array<float,2>{0.390444428f, 0.727210283f},
-std::array<float,2>{0.836393714f, 0.0281218868f},
-std::array<float,2>{0.352789164f, 0.197722852f},
-std::array<float,2>{0.975359261f, 0.576737761f},
-std::array<float,2>{0.11899367f, 0.902631283f},
-std::array<float,2>{0.526382744f, 0.404046565f},
-std::array<float,2>{0.485546708f, 0.493369281f},
-std::array<float,2>{0.781447589f, 0.981612206f},
-std::array<float,2>{0.142902181f, 0.515578508f},
-std::array<float,2>{0.683827519f, 0.127152935f},
-std::array<float,2>{0.0460607521f, 0.0894532427f},
-std::array<float,2>{0.607837141f, 0.652843773f},
-std::array<float,2>{0.290818274f, 0.829393744f},
-std::array<float,2>{0.875024199f, 0.365847021f},
-std::array<float,2>{0.07789471f, 0.426785141f},
-std::array<float,2>{0.547696948f, 0.909249008f},
-std::array<float,2>{0.342802495f, 0.594104707f},
-std::array<float,2>{0.944128752f, 0.249434143f},
-std::array<float,2>{0.417897522f, 0.0601497442f},
-std::array<float,2>{0.871869385f, 0.702434003f},
-std::array<float,2>{0.208169281f, 0.790792525f},
-std::array<float,2>{0.714803219f, 0.306822389f},
-std::array<float,2>{0.255862325f, 0.334400535f},
-std::array<float,2>{0.909666717f, 0.850221753f},
-std::array<float,2>{0.00603370089f, 0.67649442f},
-std::array<float,2>{0.575301468f, 0.0954935327f},
-std::array<float,2>{0.181875646f, 0.165332392f},
-std::array<float,2>{0.652009189f, 0.55212009f},
-std::array<float,2>{0.445209026f, 0.94503653f},
-std::array<float,2>{0.769139051f, 0.445682645f},
-std::array<float,2>{0.173256934f, 0.407013983f},
-std::array<float,2>{0.644171953f, 0.931313813f},
-std::array<float,2>{0.450741678f, 0.609634995f},
-std::array<float,2>{0.778508425f, 0.234253764f},
-std::array<float,2>{0.260047942f, 0.0326105505f},
-std::array<float,2>{0.921215057f, 0.704568803f},
-std::array<float,2>{0.015217388f, 0.801769912f},
-std::array<float,2>{0.566368163f, 0.284028262f},
-std::array<float,2>{0.409588397f, 0.323548317f},
-std::array<float,2>{0.865707517f, 0.869193614f},
-std::array<float,2>{0.215357959f, 0.662580073f},
-std::array<float,2>{0.703830302f, 0.114848077f},
-std::array<float,2>{0.0652905554f, 0.17580758f},
-std::array<float,2>{0.557268023f, 0.539162815f},
-std::array<float,2>{0.329404026f, 0.954771876f},
-std::array<float,2>{0.951045752f, 0.466414869f},
-std::array<float,2>{0.0316062942f, 0.25843066f},
-std::array<float,2>{0.598372817f, 0.763252199f},
-std::array<float,2>{0.287134141f, 0.743052661f},
-std::array<float,2>{0.888379097f, 0.00774105266f},
-std::array<float,2>{0.492495686f, 0.21436362f},
-std::array<float,2>{0.792295396f, 0.578264892f},
-std::array<float,2>{0.148991331f, 0.888756394f},
-std::array<float,2>{0.674927235f, 0.376078278f},
-std::array<float,2>{0.344198763f, 0.475247979f},
-std::array<float,2>{0.982701182f, 0.993749976f},
-std::array<float,2>{0.116281129f, 0.521638632f},
-std::array<float,2>{0.523107708f, 0.152552009f},
-std::array<float,2>{0.231606871f, 0.064745754f},
-std::array<float,2>{0.726047456f, 0.63661015f},
-std::array<float,2>{0.379136473f, 0.815013051f},
-std::array<float,2>{0.83026576f, 0.353135675f},
-std::array<float,2>{0.193711668f, 0.361500531f},
-std::array<float,2>{0.690283477f, 0.835923791f},
-std::array<float,2>{0.431537956f, 0.649602056f},
-std::array<float,2>{0.856969833f, 0.0899611935f},
-std::array<float,2>{0.31816259f, 0.130618989f},
-std::array<float,2>{0.966898918f, 0.511398911f},
-std::array<float,2>{0.0864986777f, 0.976959825f},
-std::array<float,2>{0.533523262f, 0.499038339f},
-std::array<float,2>{0.46019876f, 0.39847672f},
-std::array<float,2>{0.760373771f, 0.902154684f},
-std::array<float,2>{0.156412184f, 0.573003411f},
-std::array<float,2>{0.631621242f, 0.199906692f},
-std::array<float,2>{0.022704402f, 0.0268261991f},
-std::array<float,2>{0.581980407f, 0.733087718f},
-std::array<float,2>{0.273966521f, 0.768294811f},
-std::array<float,2>{0.933206558f, 0.270768046f},
-std::array<float,2>{0.102059133f, 0.451536179f},
-std::array<float,2>{0.510682821f, 0.940439403f},
-std::array<float,2>{0.36104688f, 0.548597813f},
-std::array<float,2>{0.992005587f, 0.168386891f},
-std::array<float,2>{0.394959301f, 0.100151829f},
-std::array<float,2>{0.823457956f, 0.672062278f},
-std::array<float,2>{0.239029288f, 0.845145583f},
-std::array<float,2>{0.748279095f, 0.32893315f},
-std::array<float,2>{0.306752086f, 0.308727831f},
-std::array<float,2>{0.891897857f, 0.795920134f},
-std::array<float,2>{0.0586224459f, 0.697612643f},
-std::array<float,2>{0.624454021f, 0.0557737425f},
-std::array<float,2>{0.13511391f, 0.242876023f},
-std::array<float,2>{0.664123774f, 0.598619521f},
-std::array<float,2>{0.476164848f, 0.91015929f},
-std::array<float,2>{0.801613271f, 0.423086315f},
-std::array<float,2>{0.245750815f, 0.488034546f},
-std::array<float,2>{0.736634135f, 0.97106427f},
-std::array<float,2>{0.40382117f, 0.501691818f},
-std::array<float,2>{0.817121863f, 0.133706689f},
-std::array<float,2>{0.370309651f, 0.0852118731f},
-std::array<float,2>{0.996783853f, 0.644519329f},
-std::array<float,2>{0.0983981416f, 0.843434155f},
-std::array<float,2>{0.502617359f, 0.369649023f},
-std::array<float,2>{0.476676404f, 0.274902135f},
-std::array<float,2>{0.810349166f, 0.780330062f},
-std::array<float,2>{0.132390425f, 0.723621905f},
-std::array<float,2>{0.658537507f, 0.0199479051f},
-std::array<float,2>{0.0533455461f, 0.190871179f},
-std::array<float,2>{0.610502899f, 0.567959845f},
-std::array<float,2>{0.303202808f, 0.897011817f},
-std::array<float,2>{0.903751969f, 0.3920286f},
-std::array<float,2>{0.0846605003f, 0.337861121f},
-std::array<float,2>{0.546398401f, 0.857034326f},
-std::array<float,2>{0.32170102f, 0.686725855f},
-std::array<float,2>{0.960256755f, 0.103190258f},
-std::array<float,2>{0.425053179f, 0.161324278f},
-std::array<float,2>{0.848343611f, 0.555123746f},
-std::array<float,2>{0.19909896f, 0.952636719f},
-std::array<float,2>{0.700262606f, 0.44237718f},
-std::array<float,2>{0.267147809f, 0.430970013f},
-std::array<float,2>{0.922356486f, 0.919323683f},
-std::array<float,2>{0.0307043269f, 0.606506586f},
-std::array<float,2>{0.591558933f, 0.234755144f},
-std::array<float,2>{0.171483189f, 0.0484888107f},
-std::array<float,2>{0.639243245f, 0.690272093f},
-std::array<float,2>{0.467660755f, 0.788971543f},
-std::array<float,2>{0.756290495f, 0.299161613f},
-std::array<float,2>{0.145131677f, 0.291533321f},
-std::array<float,2>{0.680938661f, 0.805972755f},
-std::array<float,2>{0.488961339f, 0.714118004f},
-std::array<float,2>{0.787639737f, 0.0448097028f},
-std::array<float,2>{0.294492513f, 0.222552165f},
-std::array<float,2>{0.881447315f, 0.621799529f},
-std::array<float,2>{0.0421392135f, 0.926768839f},
-std::array<float,2>{0.602026522f, 0.41692248f},
-std::array<float,2>{0.386051863f, 0.457177222f},
-std::array<float,2>{0.842336118f, 0.961513162f},
-std::array<float,2>{0.225188464f, 0.534340203f},
-std::array<float,2>{0.733320415f, 0.183703065f},
-std::array<float,2>{0.121626467f, 0.119712509f},
-std::array<float,2>{0.528684199f, 0.667125642f},
-std::array<float,2>{0.356340468f, 0.860378087f},
-std::array<float,2>{0.971692324f, 0.314973563f},
-std::array<float,2>{0.000627905945f, 0.38805601f},
-std::array<float,2>{0.572125077f, 0.880294502f},
-std::array<float,2>{0.251859158f, 0.593371391f},
-std::array<float,2>{0.913564682f, 0.208535999f},
-std::array<float,2>{0.438560188f, 0.00796934683f},
-std::array<float,2>{0.772552371f, 0.739161193f},
-std::array<float,2>{0.183718562f, 0.752632618f},
-std::array<float,2>{0.653986931f, 0.255864501f},
-std::array<float,2>{0.336874425f, 0.345770091f},
-std::array<float,2>{0.938667059f, 0.825651348f},
-std::array<float,2>{0.0728365853f, 0.6275208f},
-std::array<float,2>{0.551143229f, 0.0713644847f},
-std::array<float,2>{0.204303771f, 0.144802064f},
-std::array<float,2>{0.715055346f, 0.526721179f},
-std::array<float,2>{0.42168346f, 0.988921165f},
-std::array<float,2>{0.870334923f, 0.484190583f},
-std::array<float,2>{0.227447256f, 0.436127365f},
-std::array<float,2>{0.721008718f, 0.915322781f},
-std::array<float,2>{0.376776069f, 0.604279757f},
-std::array<float,2>{0.834181845f, 0.241140902f},
-std::array<float,2>{0.349217772f, 0.0536873043f},
-std::array<float,2>{0.977107823f, 0.695065439f},
-std::array<float,2>{0.112947732f, 0.784207582f},
-std::array<float,2>{0.518146098f, 0.304424942f},
-std::array<float,2>{0.498686522f, 0.341138422f},
-std::array<float,2>{0.79358685f, 0.852163732f},
-std::array<float,2>{0.154017255f, 0.681031406f},
-std::array<float,2>{0.67926842f, 0.106573515f},
-std::array<float,2>{0.0368067063f, 0.15924482f},
-std::array<float,2>{0.597073138f, 0.56053704f},
-std::array<float,2>{0.285063207f, 0.947367072f},
-std::array<float,2>{0.885064244f, 0.438043028f},
-std::array<float,2>{0.0666784644f, 0.27743274f},
-std::array<float,2>{0.558779359f, 0.773488045f},
-std::array<float,2>{0.335834265f, 0.721643567f},
-std::array<float,2>{0.947942138f, 0.0176181197f},
-std::array<float,2>{0.411978871f, 0.194171846f},
-std::array<float,2>{0.862910032f, 0.562954068f},
-std::array<float,2>{0.212270305f, 0.893619418f},
-std::array<float,2>{0.7105515f, 0.397573918f},
-std::array<float,2>{0.262819856f, 0.490946591f},
-std::array<float,2>{0.917528152f, 0.975386262f},
-std::array<float,2>{0.00868052803f, 0.504562497f},
-std::array<float,2>{0.56970495f, 0.140301928f},
-std::array<float,2>{0.17859523f, 0.0792744979f},
-std::array<float,2>{0.64595902f, 0.645405114f},
-std::array<float,2>{0.447249651f, 0.83801955f},
-std::array<float,2>{0.774371743f, 0.372123122f},
-std::array<float,2>{0.138138965f, 0.348223418f},
-std::array<float,2>{0.668383956f, 0.823779106f},
-std::array<float,2>{0.469860315f, 0.632720709f},
-std::array<float,2>{0.800676346f, 0.0767277181f},
-std::array<float,2>{0.312033534f, 0.142779186f},
-std::array<float,2>{0.897153735f, 0.527688026f},
-std::array<float,2>{0.0584254265f, 0.985831499f},
-std::array<float,2>{0.620144069f, 0.478085518f},
-std::array<float,2>{0.39318049f, 0.386603981f},
-std::array<float,2>{0.825256765f, 0.876479387f},
-std::array<float,2>{0.23779352f, 0.589733005f},
-std::array<float,2>{0.745823145f, 0.206374168f},
-std::array<float,2>{0.107983321f, 0.0147205275f},
-std::array<float,2>{0.513179779f, 0.734722733f},
-std::array<float,2>{0.365516692f, 0.75611043f},
-std::array<float,2>{0.98600179f, 0.252361923f},
-std::array<float,2>{0.0176550467f, 0.454262972f},
-std::array<float,2>{0.585463405f, 0.965410888f},
-std::array<float,2>{0.279336423f, 0.537731409f},
-std::array<float,2>{0.936680853f, 0.18159394f},
-std::array<float,2>{0.456426352f, 0.121300131f},
-std::array<float,2>{0.762102842f, 0.670786381f},
-std::array<float,2>{0.163320899f, 0.865841806f},
-std::array<float,2>{0.625418484f, 0.319921941f},
-std::array<float,2>{0.315698326f, 0.296435654f},
-std::array<float,2>{0.96117574f, 0.811562955f},
-std::array<float,2>{0.0902735665f, 0.715017498f},
-std::array<float,2>{0.537333488f, 0.0420735665f},
-std::array<float,2>{0.19116044f, 0.222857773f},
-std::array<float,2>{0.692411304f, 0.617996514f},
-std::array<float,2>{0.436551571f, 0.92352438f},
-std::array<float,2>{0.855018437f, 0.419350147f},
-std::array<float,2>{0.166812643f, 0.469831049f},
-std::array<float,2>{0.634018481f, 0.999808967f},
-std::array<float,2>{0.461594731f, 0.518421113f},
-std::array<float,2>{0.751456797f, 0.151543394f},
-std::array<float,2>{0.272494435f, 0.068684496f},
-std::array<float,2>{0.926145017f, 0.63746959f},
-std::array<float,2>{0.0249943789f, 0.818131626f},
-std::array<float,2>{0.587488174f, 0.356753051f},
-std::array<float,2>{0.426939428f, 0.264219791f},
-std::array<float,2>{0.845224738f, 0.758864641f},
-std::array<float,2>{0.202478737f, 0.749694705f},
-std::array<float,2>{0.698851228f, 0.00368175516f},
-std::array<float,2>{0.078259334f, 0.218356803f},
-std::array<float,2>{0.542573035f, 0.585492671f},
-std::array<float,2>{0.324537307f, 0.884114683f},
-std::array<float,2>{0.953229904f, 0.380011469f},
-std::array<float,2>{0.0485843159f, 0.327425271f},
-std::array<float,2>{0.615823567f, 0.874105215f},
-std::array<float,2>{0.29991731f, 0.65713048f},
-std::array<float,2>{0.899692178f, 0.112970635f},
-std::array<float,2>{0.481443793f, 0.174970433f},
-std::array<float,2>{0.805090368f, 0.544853747f},
-std::array<float,2>{0.126962855f, 0.9603526f},
-std::array<float,2>{0.66093421f, 0.461826861f},
-std::array<float,2>{0.373968929f, 0.410674334f},
-std::array<float,2>{0.993244648f, 0.933722973f},
-std::array<float,2>{0.0946981013f, 0.614604294f},
-std::array<float,2>{0.505600035f, 0.228778377f},
-std::array<float,2>{0.249822274f, 0.0380233638f},
-std::array<float,2>{0.741742671f, 0.709856212f},
-std::array<float,2>{0.401954323f, 0.797558486f},
-std::array<float,2>{0.814552903f, 0.286041409f},
-std::array<float,2>{0.210670948f, 0.305497438f},
-std::array<float,2>{0.712229729f, 0.791079342f},
-std::array<float,2>{0.414975822f, 0.700487018f},
-std::array<float,2>{0.873982012f, 0.0623736121f},
-std::array<float,2>{0.340017378f, 0.247173026f},
-std::array<float,2>{0.942615807f, 0.597514153f},
-std::array<float,2>{0.075328812f, 0.906858742f},
-std::array<float,2>{0.54931891f, 0.428486943f},
-std::array<float,2>{0.441409737f, 0.448100358f},
-std::array<float,2>{0.766189575f, 0.942652881f},
-std::array<float,2>{0.180482507f, 0.554409206f},
-std::array<float,2>{0.649177611f, 0.167069525f},
-std::array<float,2>{0.00544027938f, 0.096378997f},
-std::array<float,2>{0.576272607f, 0.678678155f},
-std::array<float,2>{0.25551939f, 0.847913265f},
-std::array<float,2>{0.907224953f, 0.333685815f},
-std::array<float,2>{0.119312383f, 0.405918449f},
-std::array<float,2>{0.523980558f, 0.906160295f},
-std::array<float,2>{0.354208529f, 0.57612747f},
-std::array<float,2>{0.974539518f, 0.19583562f},
-std::array<float,2>{0.387335271f, 0.0295097213f},
-std::array<float,2>{0.838172495f, 0.728839815f},
-std::array<float,2>{0.220479384f, 0.772013307f},
-std::array<float,2>{0.72997278f, 0.2692177f},
-std::array<float,2>{0.291544765f, 0.363687664f},
-std::array<float,2>{0.878014147f, 0.831494033f},
-std::array<float,2>{0.0445087068f, 0.655764759f},
-std::array<float,2>{0.6067186f, 0.0861805752f},
-std::array<float,2>{0.141427428f, 0.125620827f},
-std::array<float,2>{0.686473191f, 0.511845708f},
-std::array<float,2>{0.487574697f, 0.983670413f},
-std::array<float,2>{0.784051061f, 0.494905055f},
-std::array<float,2>{0.151451617f, 0.378462046f},
-std::array<float,2>{0.672754288f, 0.887624741f},
-std::array<float,2>{0.495146185f, 0.580101192f},
-std::array<float,2>{0.789632618f, 0.212114364f},
-std::array<float,2>{0.286711931f, 0.00541111222f},
-std::array<float,2>{0.88965708f, 0.74446243f},
-std::array<float,2>{0.0337094329f, 0.763673842f},
-std::array<float,2>{0.601082206f, 0.261630267f},
-std::array<float,2>{0.381449759f, 0.354778975f},
-std::array<float,2>{0.829885542f, 0.812886596f},
-std::array<float,2>{0.232949883f, 0.634307563f},
-std::array<float,2>{0.723006606f, 0.0639168397f},
-std::array<float,2>{0.11419306f, 0.154607043f},
-std::array<float,2>{0.519860983f, 0.519768476f},
-std::array<float,2>{0.346503019f, 0.995407343f},
-std::array<float,2>{0.980758309f, 0.474579841f},
-std::array<float,2>{0.012590983f, 0.282660842f},
-std::array<float,2>{0.562614501f, 0.803640544f},
-std::array<float,2>{0.259403229f, 0.706690073f},
-std::array<float,2>{0.919608235f, 0.0339078195f},
-std::array<float,2>{0.451190948f, 0.230935842f},
-std::array<float,2>{0.780823171f, 0.613145888f},
-std::array<float,2>{0.173934743f, 0.932925284f},
-std::array<float,2>{0.641849339f, 0.410093069f},
-std::array<float,2>{0.330885112f, 0.467368096f},
-std::array<float,2>{0.951366425f, 0.956851542f},
-std::array<float,2>{0.0633047596f, 0.541665792f},
-std::array<float,2>{0.556603312f, 0.179352611f},
-std::array<float,2>{0.217682719f, 0.115988545f},
-std::array<float,2>{0.706241727f, 0.660449386f},
-std::array<float,2>{0.407351464f, 0.867513239f},
-std::array<float,2>{0.864486873f, 0.321721345f},
-std::array<float,2>{0.241183579f, 0.331410736f},
-std::array<float,2>{0.747284114f, 0.846519113f},
-std::array<float,2>{0.397886783f, 0.674791932f},
-std::array<float,2>{0.821397185f, 0.0989908502f},
-std::array<float,2>{0.361866295f, 0.17011036f},
-std::array<float,2>{0.988748431f, 0.550363779f},
-std::array<float,2>{0.103637055f, 0.939169645f},
-std::array<float,2>{0.509590864f, 0.450722307f},
-std::array<float,2>{0.474372178f, 0.424830675f},
-std::array<float,2>{0.804370224f, 0.912477493f},
-std::array<float,2>{0.133353561f, 0.60096252f},
-std::array<float,2>{0.666505933f, 0.245628163f},
-std::array<float,2>{0.0612479039f, 0.0577651672f},
-std::array<float,2>{0.621262789f, 0.696439624f},
-std::array<float,2>{0.30634889f, 0.793878555f},
-std::array<float,2>{0.894401133f, 0.312083632f},
-std::array<float,2>{0.088929832f, 0.496582896f},
-std::array<float,2>{0.532383502f, 0.980311036f},
-std::array<float,2>{0.319013745f, 0.508607209f},
-std::array<float,2>{0.964971185f, 0.131273717f},
-std::array<float,2>{0.433388799f, 0.0935762003f},
-std::array<float,2>{0.859129488f, 0.652317524f},
-std::array<float,2>{0.192829385f, 0.833676636f},
-std::array<float,2>{0.688803792f, 0.361308217f},
-std::array<float,2>{0.276038438f, 0.273417354f},
-std::array<float,2>{0.931182683f, 0.765791774f},
-std::array<float,2>{0.021414604f, 0.730639577f},
-std::array<float,2>{0.578942657f, 0.0249087866f},
-std::array<float,2>{0.158670917f, 0.202144116f},
-std::array<float,2>{0.628948748f, 0.571800292f},
-std::array<float,2>{0.457188308f, 0.900141418f},
-std::array<float,2>{0.758154392f, 0.401769251f},
-std::array<float,2>{0.19649145f, 0.444135815f},
-std::array<float,2>{0.701506257f, 0.950802982f},
-std::array<float,2>{0.423627347f, 0.557791591f},
-std::array<float,2>{0.850414217f, 0.162809685f},
-std::array<float,2>{0.324126601f, 0.104586691f},
-std::array<float,2>{0.95870465f, 0.684900224f},
-std::array<float,2>{0.082673192f, 0.859037876f},
-std::array<float,2>{0.54412055f, 0.339401841f},
-std::array<float,2>{0.465445071f, 0.296982408f},
-std::array<float,2>{0.754121363f, 0.786712468f},
-std::array<float,2>{0.16867657f, 0.689369619f},
-std::array<float,2>{0.638089895f, 0.0489646681f},
-std::array<float,2>{0.0277329423f, 0.23764573f},
-std::array<float,2>{0.592820883f, 0.608948171f},
-std::array<float,2>{0.268874139f, 0.921654105f},
-std::array<float,2>{0.925712645f, 0.431885034f},
-std::array<float,2>{0.100234851f, 0.36726436f},
-std::array<float,2>{0.500521719f, 0.841288507f},
-std::array<float,2>{0.368242323f, 0.64126575f},
-std::array<float,2>{0.998553574f, 0.0834231675f},
-std::array<float,2>{0.405660212f, 0.136107177f},
-std::array<float,2>{0.818984151f, 0.502842605f},
-std::array<float,2>{0.243596077f, 0.968981504f},
-std::array<float,2>{0.73535943f, 0.48540327f},
-std::array<float,2>{0.301058173f, 0.393361956f},
-std::array<float,2>{0.904338419f, 0.895373583f},
-std::array<float,2>{0.0526007228f, 0.570005059f},
-std::array<float,2>{0.612513304f, 0.188090071f},
-std::array<float,2>{0.130309492f, 0.0227617025f},
-std::array<float,2>{0.656784832f, 0.725891531f},
-std::array<float,2>{0.479484677f, 0.779027164f},
-std::array<float,2>{0.81114167f, 0.277290016f},
-std::array<float,2>{0.186549827f, 0.25505057f},
-std::array<float,2>{0.656190932f, 0.751493216f},
-std::array<float,2>{0.439461559f, 0.740419328f},
-std::array<float,2>{0.770270884f, 0.0110818567f},
-std::array<float,2>{0.252121627f, 0.20898509f},
-std::array<float,2>{0.911775172f, 0.590293229f},
-std::array<float,2>{0.00287744589f, 0.881075799f},
-std::array<float,2>{0.573379934f, 0.38900429f},
-std::array<float,2>{0.419003427f, 0.480651796f},
-std::array<float,2>{0.868842661f, 0.991985261f},
-std::array<float,2>{0.205216408f, 0.523491085f},
-std::array<float,2>{0.718282998f, 0.146999672f},
-std::array<float,2>{0.0704324618f, 0.0741800368f},
-std::array<float,2>{0.553885877f, 0.62531662f},
-std::array<float,2>{0.337992877f, 0.826586843f},
-std::array<float,2>{0.941381395f, 0.343990862f},
-std::array<float,2>{0.0395706743f, 0.414703339f},
-std::array<float,2>{0.603657961f, 0.927762866f},
-std::array<float,2>{0.29676944f, 0.624699175f},
-std::array<float,2>{0.878964245f, 0.22066927f},
-std::array<float,2>{0.49065721f, 0.0452085845f},
-std::array<float,2>{0.78568238f, 0.712815762f},
-std::array<float,2>{0.14707759f, 0.807397604f},
-std::array<float,2>{0.682590306f, 0.289744198f},
-std::array<float,2>{0.357635796f, 0.312819421f},
-std::array<float,2>{0.969074488f, 0.862466931f},
-std::array<float,2>{0.12389151f, 0.664290249f},
-std::array<float,2>{0.53118819f, 0.117615275f},
-std::array<float,2>{0.223367825f, 0.185903817f},
-std::array<float,2>{0.731297791f, 0.5323385f},
-std::array<float,2>{0.38314873f, 0.963175774f},
-std::array<float,2>{0.841002643f, 0.46019417f},
-std::array<float,2>{0.237104818f, 0.384545177f},
-std::array<float,2>{0.744895101f, 0.878390431f},
-std::array<float,2>{0.393568039f, 0.587396979f},
-std::array<float,2>{0.824728608f, 0.20483914f},
-std::array<float,2>{0.366792232f, 0.0119583113f},
-std::array<float,2>{0.984750152f, 0.737498045f},
-std::array<float,2>{0.109002888f, 0.754339159f},
-std::array<float,2>{0.512138128f, 0.25153482f},
-std::array<float,2>{0.469538391f, 0.350216001f},
-std::array<float,2>{0.799152374f, 0.821111083f},
-std::array<float,2>{0.13728112f, 0.629025877f},
-std::array<float,2>{0.669008374f, 0.0756731704f},
-std::array<float,2>{0.056921538f, 0.141383797f},
-std::array<float,2>{0.620053291f, 0.529767156f},
-std::array<float,2>{0.310589641f, 0.987222493f},
-std::array<float,2>{0.897926211f, 0.480270416f},
-std::array<float,2>{0.0914858356f, 0.294460177f},
-std::array<float,2>{0.539037943f, 0.809088111f},
-std::array<float,2>{0.314720392f, 0.718340397f},
-std::array<float,2>{0.962557852f, 0.0405429564f},
-std::array<float,2>{0.436352909f, 0.225419953f},
-std::array<float,2>{0.853941023f, 0.620230317f},
-std::array<float,2>{0.190237775f, 0.924156129f},
-std::array<float,2>{0.691906214f, 0.420147806f},
-std::array<float,2>{0.281179667f, 0.456689894f},
-std::array<float,2>{0.936114609f, 0.967445195f},
-std::array<float,2>{0.0185814742f, 0.536823392f},
-std::array<float,2>{0.584076107f, 0.182253629f},
-std::array<float,2>{0.162119403f, 0.123724036f},
-std::array<float,2>{0.62648952f, 0.668821692f},
-std::array<float,2>{0.455487221f, 0.864211738f},
-std::array<float,2>{0.763092995f, 0.318286091f},
-std::array<float,2>{0.15311268f, 0.343087882f},
-std::array<float,2>{0.677991092f, 0.855240762f},
-std::array<float,2>{0.49935782f, 0.682583272f},
-std::array<float,2>{0.794500053f, 0.107916236f},
-std::array<float,2>{0.283403099f, 0.158061385f},
-std::array<float,2>{0.88651973f, 0.561997056f},
-std::array<float,2>{0.0353158899f, 0.945360601f},
-std::array<float,2>{0.596300662f, 0.440961242f},
-std::array<float,2>{0.37501207f, 0.434677303f},
-std::array<float,2>{0.835042834f, 0.916225374f},
-std::array<float,2>{0.228090763f, 0.602931261f},
-std::array<float,2>{0.722568154f, 0.239093482f},
-std::array<float,2>{0.111927219f, 0.0521034673f},
-std::array<float,2>{0.518890321f, 0.691526353f},
-std::array<float,2>{0.348265707f, 0.782518446f},
-std::array<float,2>{0.977809846f, 0.301585376f},
-std::array<float,2>{0.00888769142f, 0.488337427f},
-std::array<float,2>{0.568631828f, 0.974566638f},
-std::array<float,2>{0.26210174f, 0.507238507f},
-std::array<float,2>{0.916375756f, 0.138590977f},
-std::array<float,2>{0.446263641f, 0.0803465918f},
-std::array<float,2>{0.775243163f, 0.64722532f},
-std::array<float,2>{0.179567933f, 0.837592602f},
-std::array<float,2>{0.645461202f, 0.373512864f},
-std::array<float,2>{0.334445f, 0.280464917f},
-std::array<float,2>{0.949085295f, 0.775830746f},
-std::array<float,2>{0.0676544756f, 0.71948278f},
-std::array<float,2>{0.559610605f, 0.0163903963f},
-std::array<float,2>{0.211498737f, 0.192935005f},
-std::array<float,2>{0.70977217f, 0.565700948f},
-std::array<float,2>{0.410719246f, 0.890954077f},
-std::array<float,2>{0.862170935f, 0.39465484f},
-std::array<float,2>{0.180895269f, 0.447030574f},
-std::array<float,2>{0.649559677f, 0.943732619f},
-std::array<float,2>{0.442762554f, 0.551528394f},
-std::array<float,2>{0.767416298f, 0.164146498f},
-std::array<float,2>{0.254330903f, 0.0944609269f},
-std::array<float,2>{0.907354474f, 0.677707851f},
-std::array<float,2>{0.00404028781f, 0.851361036f},
-std::array<float,2>{0.57736671f, 0.335217506f},
-std::array<float,2>{0.415112108f, 0.308137596f},
-std::array<float,2>{0.874070942f, 0.789415002f},
-std::array<float,2>{0.209707037f, 0.70176369f},
-std::array<float,2>{0.711648703f, 0.0595667809f},
-std::array<float,2>{0.074494563f, 0.248113304f},
-std::array<float,2>{0.55056113f, 0.594955325f},
-std::array<float,2>{0.341161281f, 0.908800304f},
-std::array<float,2>{0.94179666f, 0.425916791f},
-std::array<float,2>{0.0433149226f, 0.367102176f},
-std::array<float,2>{0.606118619f, 0.828961015f},
-std::array<float,2>{0.292323917f, 0.65374136f},
-std::array<float,2>{0.877669811f, 0.0881789401f},
-std::array<float,2>{0.48638925f, 0.128203735f},
-std::array<float,2>{0.785075784f, 0.514116108f},
-std::array<float,2>{0.142542914f, 0.980983794f},
-std::array<float,2>{0.687382519f, 0.492695093f},
-std::array<float,2>{0.355197459f, 0.402830869f},
-std::array<float,2>{0.973469138f, 0.903808117f},
-std::array<float,2>{0.120592199f, 0.577466726f},
-std::array<float,2>{0.525118053f, 0.198771909f},
-std::array<float,2>{0.218761638f, 0.0292227361f},
-std::array<float,2>{0.729106903f, 0.728375673f},
-std::array<float,2>{0.387874454f, 0.770514309f},
-std::array<float,2>{0.839287519f, 0.266373008f},
-std::array<float,2>{0.201282009f, 0.261838615f},
-std::array<float,2>{0.698168993f, 0.759952784f},
-std::array<float,2>{0.426012218f, 0.7462762f},
-std::array<float,2>{0.844535172f, 0.00160575449f},
-std::array<float,2>{0.325979888f, 0.215175733f},
-std::array<float,2>{0.954715014f, 0.58308816f},
-std::array<float,2>{0.0791378319f, 0.886254787f},
-std::array<float,2>{0.541935325f, 0.382213265f},
-std::array<float,2>{0.462568551f, 0.472651988f},
-std::array<float,2>{0.750766575f, 0.997539163f},
-std::array<float,2>{0.167174801f, 0.515914798f},
-std::array<float,2>{0.633439541f, 0.149196103f},
-std::array<float,2>{0.0244068354f, 0.0664656609f},
-std::array<float,2>{0.586429119f, 0.640534818f},
-std::array<float,2>{0.271815002f, 0.819261551f},
-std::array<float,2>{0.927387059f, 0.358959675f},
-std::array<float,2>{0.0956190526f, 0.413836926f},
-std::array<float,2>{0.504562914f, 0.935741961f},
-std::array<float,2>{0.374035656f, 0.615634441f},
-std::array<float,2>{0.99279362f, 0.227021992f},
-std::array<float,2>{0.401281774f, 0.0352668762f},
-std::array<float,2>{0.81612426f, 0.707843244f},
-std::array<float,2>{0.248109877f, 0.800532222f},
-std::array<float,2>{0.740788043f, 0.28900221f},
-std::array<float,2>{0.29923436f, 0.325615674f},
-std::array<float,2>{0.899273813f, 0.872878492f},
-std::array<float,2>{0.0478003062f, 0.658219278f},
-std::array<float,2>{0.616656125f, 0.110292785f},
-std::array<float,2>{0.128111899f, 0.173035949f},
-std::array<float,2>{0.661435962f, 0.546321571f},
-std::array<float,2>{0.481966108f, 0.958098233f},
-std::array<float,2>{0.805905402f, 0.464050412f},
-std::array<float,2>{0.133982256f, 0.422178209f},
-std::array<float,2>{0.667774737f, 0.911184549f},
-std::array<float,2>{0.473511785f, 0.598875642f},
-std::array<float,2>{0.802918196f, 0.243895039f},
-std::array<float,2>{0.305358469f, 0.0550739244f},
-std::array<float,2>{0.892862618f, 0.698895037f},
-std::array<float,2>{0.0622471459f, 0.795192063f},
-std::array<float,2>{0.622466326f, 0.30963695f},
-std::array<float,2>{0.396902561f, 0.329609156f},
-std::array<float,2>{0.82095474f, 0.844386697f},
-std::array<float,2>{0.241643056f, 0.67361486f},
-std::array<float,2>{0.746099055f, 0.100828998f},
-std::array<float,2>{0.104713865f, 0.169217199f},
-std::array<float,2>{0.508265078f, 0.547650039f},
-std::array<float,2>{0.363225728f, 0.939587414f},
-std::array<float,2>{0.989687204f, 0.452378184f},
-std::array<float,2>{0.0203715488f, 0.269967705f},
-std::array<float,2>{0.579295039f, 0.768901169f},
-std::array<float,2>{0.276859254f, 0.73407495f},
-std::array<float,2>{0.929844081f, 0.0260404162f},
-std::array<float,2>{0.458273947f, 0.201005444f},
-std::array<float,2>{0.759277761f, 0.574183881f},
-std::array<float,2>{0.15934144f, 0.900929332f},
-std::array<float,2>{0.630559146f, 0.399937838f},
-std::array<float,2>{0.319389999f, 0.498413056f},
-std::array<float,2>{0.966094315f, 0.977780938f},
-std::array<float,2>{0.0886605084f, 0.510640502f},
-std::array<float,2>{0.531605542f, 0.129215345f},
-std::array<float,2>{0.191806003f, 0.0916391015f},
-std::array<float,2>{0.687868357f, 0.649147034f},
-std::array<float,2>{0.432288885f, 0.834327936f},
-std::array<float,2>{0.857582092f, 0.363110602f},
-std::array<float,2>{0.233411402f, 0.351960778f},
-std::array<float,2>{0.72438997f, 0.81616497f},
-std::array<float,2>{0.38248229f, 0.634888291f},
-std::array<float,2>{0.828938603f, 0.0663052797f},
-std::array<float,2>{0.346956462f, 0.153843448f},
-std::array<float,2>{0.981573403f, 0.523289919f},
-std::array<float,2>{0.114412926f, 0.993073702f},
-std::array<float,2>{0.521393955f, 0.475638241f},
-std::array<float,2>{0.495016307f, 0.37501201f},
-std::array<float,2>{0.790425956f, 0.890554428f},
-std::array<float,2>{0.150537774f, 0.579189956f},
-std::array<float,2>{0.67363131f, 0.212959647f},
-std::array<float,2>{0.0345076285f, 0.00648967549f},
-std::array<float,2>{0.600584149f, 0.743723869f},
-std::array<float,2>{0.285676181f, 0.762102842f},
-std::array<float,2>{0.889348388f, 0.258851171f},
-std::array<float,2>{0.0638600588f, 0.465035826f},
-std::array<float,2>{0.55538094f, 0.953297853f},
-std::array<float,2>{0.331621617f, 0.540625632f},
-std::array<float,2>{0.952541351f, 0.177630752f},
-std::array<float,2>{0.406701624f, 0.11378026f},
-std::array<float,2>{0.863708973f, 0.663305938f},
-std::array<float,2>{0.218420893f, 0.870221138f},
-std::array<float,2>{0.705885053f, 0.322562814f},
-std::array<float,2>{0.257836759f, 0.284695685f},
-std::array<float,2>{0.918719113f, 0.801605582f},
-std::array<float,2>{0.0133707542f, 0.703131676f},
-std::array<float,2>{0.564234555f, 0.0313906856f},
-std::array<float,2>{0.174811095f, 0.232740521f},
-std::array<float,2>{0.641462386f, 0.610546649f},
-std::array<float,2>{0.45277366f, 0.930184126f},
-std::array<float,2>{0.780070364f, 0.407596111f},
-std::array<float,2>{0.206232309f, 0.483098835f},
-std::array<float,2>{0.717319131f, 0.989776015f},
-std::array<float,2>{0.418827802f, 0.526262939f},
-std::array<float,2>{0.867453396f, 0.146223038f},
-std::array<float,2>{0.339116424f, 0.0707125813f},
-std::array<float,2>{0.939808846f, 0.628383636f},
-std::array<float,2>{0.0719504505f, 0.825097322f},
-std::array<float,2>{0.553070784f, 0.34701696f},
-std::array<float,2>{0.441134304f, 0.257640123f},
-std::array<float,2>{0.771471083f, 0.753125906f},
-std::array<float,2>{0.186101884f, 0.740200281f},
-std::array<float,2>{0.654897392f, 0.00932667963f},
-std::array<float,2>{0.00317062624f, 0.20725733f},
-std::array<float,2>{0.572920263f, 0.592743158f},
-std::array<float,2>{0.253791749f, 0.879396141f},
-std::array<float,2>{0.910164237f, 0.387438148f},
-std::array<float,2>{0.124279313f, 0.31568405f},
-std::array<float,2>{0.530207813f, 0.859986663f},
-std::array<float,2>{0.358820587f, 0.666227639f},
-std::array<float,2>{0.970192432f, 0.120248675f},
-std::array<float,2>{0.384289205f, 0.185011029f},
-std::array<float,2>{0.840704441f, 0.53344816f},
-std::array<float,2>{0.22390154f, 0.962040961f},
-std::array<float,2>{0.732308388f, 0.458269894f},
-std::array<float,2>{0.295317322f, 0.417613357f},
-std::array<float,2>{0.879886329f, 0.926449955f},
-std::array<float,2>{0.0404959768f, 0.622800112f},
-std::array<float,2>{0.60538429f, 0.221244052f},
-std::array<float,2>{0.147803724f, 0.042979449f},
-std::array<float,2>{0.682686687f, 0.71307236f},
-std::array<float,2>{0.49199757f, 0.804726899f},
-std::array<float,2>{0.786693335f, 0.292386949f},
-std::array<float,2>{0.169601962f, 0.300156385f},
-std::array<float,2>{0.636868417f, 0.787423491f},
-std::array<float,2>{0.466722846f, 0.691401958f},
-std::array<float,2>{0.755541503f, 0.0477342345f},
-std::array<float,2>{0.268091917f, 0.235820845f},
-std::array<float,2>{0.92396456f, 0.605724216f},
-std::array<float,2>{0.0284452345f, 0.918165326f},
-std::array<float,2>{0.592733324f, 0.430550396f},
-std::array<float,2>{0.422443956f, 0.442503065f},
-std::array<float,2>{0.851385772f, 0.951400638f},
-std::array<float,2>{0.195786282f, 0.556095064f},
-std::array<float,2>{0.70257014f, 0.160883531f},
-std::array<float,2>{0.0832265466f, 0.102181382f},
-std::array<float,2>{0.543571889f, 0.686069906f},
-std::array<float,2>{0.323167831f, 0.85559833f},
-std::array<float,2>{0.957424045f, 0.336503834f},
-std::array<float,2>{0.051069878f, 0.391161174f},
-std::array<float,2>{0.611675858f, 0.898150742f},
-std::array<float,2>{0.302677959f, 0.566567063f},
-std::array<float,2>{0.9052791f, 0.190233618f},
-std::array<float,2>{0.479768634f, 0.0205556229f},
-std::array<float,2>{0.811848402f, 0.724050343f},
-std::array<float,2>{0.129426733f, 0.780211091f},
-std::array<float,2>{0.657390535f, 0.274006605f},
-std::array<float,2>{0.368064404f, 0.370261461f},
-std::array<float,2>{0.999170601f, 0.84240061f},
-std::array<float,2>{0.101460747f, 0.64280659f},
-std::array<float,2>{0.501611233f, 0.0848638341f},
-std::array<float,2>{0.242383197f, 0.133953243f},
-std::array<float,2>{0.734412909f, 0.500087619f},
-std::array<float,2>{0.405185729f, 0.971880317f},
-std::array<float,2>{0.819555879f, 0.486799598f},
-std::array<float,2>{0.187945113f, 0.418163538f},
-std::array<float,2>{0.69459796f, 0.92187655f},
-std::array<float,2>{0.433772087f, 0.618750274f},
-std::array<float,2>{0.851790369f, 0.224498108f},
-std::array<float,2>{0.31314379f, 0.0411258601f},
-std::array<float,2>{0.964415014f, 0.716166079f},
-std::array<float,2>{0.0926445574f, 0.810566306f},
-std::array<float,2>{0.535791337f, 0.29550302f},
-std::array<float,2>{0.453623205f, 0.31885758f},
-std::array<float,2>{0.764782608f, 0.866259217f},
-std::array<float,2>{0.161605f, 0.671078146f},
-std::array<float,2>{0.62699151f, 0.122205123f},
-std::array<float,2>{0.01622889f, 0.180187091f},
-std::array<float,2>{0.583492637f, 0.53862232f},
-std::array<float,2>{0.278002828f, 0.965960622f},
-std::array<float,2>{0.933923542f, 0.453826547f},
-std::array<float,2>{0.106102951f, 0.252969235f},
-std::array<float,2>{0.515480101f, 0.757386029f},
-std::array<float,2>{0.364285231f, 0.736139834f},
-std::array<float,2>{0.98826158f, 0.0140159326f},
-std::array<float,2>{0.392002523f, 0.205115676f},
-std::array<float,2>{0.827008784f, 0.588095307f},
-std::array<float,2>{0.234684423f, 0.875093162f},
-std::array<float,2>{0.742722213f, 0.384978801f},
-std::array<float,2>{0.310520321f, 0.477532357f},
-std::array<float,2>{0.896317005f, 0.985087156f},
-std::array<float,2>{0.0547606871f, 0.52857697f},
-std::array<float,2>{0.617943883f, 0.143900841f},
-std::array<float,2>{0.139519572f, 0.0771921724f},
-std::array<float,2>{0.670867205f, 0.631540775f},
-std::array<float,2>{0.471217245f, 0.822863758f},
-std::array<float,2>{0.797041357f, 0.348709583f},
-std::array<float,2>{0.175997302f, 0.371614188f},
-std::array<float,2>{0.646779358f, 0.838959515f},
-std::array<float,2>{0.448235124f, 0.645530045f},
-std::array<float,2>{0.776257813f, 0.0786154047f},
-std::array<float,2>{0.265310109f, 0.139117941f},
-std::array<float,2>{0.91569525f, 0.505507827f},
-std::array<float,2>{0.0111894701f, 0.976515174f},
-std::array<float,2>{0.56649965f, 0.492023498f},
-std::array<float,2>{0.412880361f, 0.396755099f},
-std::array<float,2>{0.860506177f, 0.892623782f},
-std::array<float,2>{0.214356199f, 0.564153612f},
-std::array<float,2>{0.707086325f, 0.194853678f},
-std::array<float,2>{0.0688555762f, 0.0188527107f},
-std::array<float,2>{0.56104058f, 0.721729219f},
-std::array<float,2>{0.333845139f, 0.774753392f},
-std::array<float,2>{0.946735024f, 0.278374135f},
-std::array<float,2>{0.0376387537f, 0.438751936f},
-std::array<float,2>{0.595593989f, 0.949089408f},
-std::array<float,2>{0.281746715f, 0.559136391f},
-std::array<float,2>{0.884375751f, 0.158980533f},
-std::array<float,2>{0.497691125f, 0.105560809f},
-std::array<float,2>{0.795427382f, 0.679728687f},
-std::array<float,2>{0.155130535f, 0.853491843f},
-std::array<float,2>{0.676643908f, 0.340817362f},
-std::array<float,2>{0.350096196f, 0.303167909f},
-std::array<float,2>{0.980187774f, 0.783363879f},
-std::array<float,2>{0.109433882f, 0.69426924f},
-std::array<float,2>{0.517235994f, 0.0543311425f},
-std::array<float,2>{0.228635252f, 0.241592392f},
-std::array<float,2>{0.719669402f, 0.605255365f},
-std::array<float,2>{0.378724128f, 0.914705217f},
-std::array<float,2>{0.832110107f, 0.436892211f},
-std::array<float,2>{0.14431788f, 0.495392203f},
-std::array<float,2>{0.685303092f, 0.982497811f},
-std::array<float,2>{0.484544992f, 0.513001144f},
-std::array<float,2>{0.782608092f, 0.126429766f},
-std::array<float,2>{0.289758235f, 0.0871376544f},
-std::array<float,2>{0.876657963f, 0.655264676f},
-std::array<float,2>{0.0454699062f, 0.830356121f},
-std::array<float,2>{0.608809054f, 0.365063399f},
-std::array<float,2>{0.388875842f, 0.268258989f},
-std::array<float,2>{0.837295711f, 0.772995591f},
-std::array<float,2>{0.222317591f, 0.729580164f},
-std::array<float,2>{0.728437364f, 0.0309911016f},
-std::array<float,2>{0.117189594f, 0.196344018f},
-std::array<float,2>{0.525725961f, 0.5748263f},
-std::array<float,2>{0.35215342f, 0.904514968f},
-std::array<float,2>{0.976263165f, 0.404748321f},
-std::array<float,2>{0.00775585044f, 0.332083791f},
-std::array<float,2>{0.574450552f, 0.84876591f},
-std::array<float,2>{0.257056922f, 0.679412723f},
-std::array<float,2>{0.908529818f, 0.0972952694f},
-std::array<float,2>{0.443760157f, 0.166969016f},
-std::array<float,2>{0.767769277f, 0.552824378f},
-std::array<float,2>{0.182841882f, 0.942061722f},
-std::array<float,2>{0.651086211f, 0.448282391f},
-std::array<float,2>{0.341981024f, 0.428858072f},
-std::array<float,2>{0.94486618f, 0.908072174f},
-std::array<float,2>{0.0761932135f, 0.596416533f},
-std::array<float,2>{0.547992051f, 0.24663417f},
-std::array<float,2>{0.20714277f, 0.0612616688f},
-std::array<float,2>{0.7136361f, 0.699913621f},
-std::array<float,2>{0.416659504f, 0.792286932f},
-std::array<float,2>{0.872728765f, 0.306454986f},
-std::array<float,2>{0.247266129f, 0.287092924f},
-std::array<float,2>{0.739676595f, 0.79812336f},
-std::array<float,2>{0.398617238f, 0.710245728f},
-std::array<float,2>{0.813181043f, 0.0383537821f},
-std::array<float,2>{0.372883141f, 0.229538471f},
-std::array<float,2>{0.994797945f, 0.61381036f},
-std::array<float,2>{0.096931912f, 0.934593499f},
-std::array<float,2>{0.506180584f, 0.411675006f},
-std::array<float,2>{0.483715534f, 0.462652475f},
-std::array<float,2>{0.807999313f, 0.959914982f},
-std::array<float,2>{0.125348359f, 0.542999923f},
-std::array<float,2>{0.663638651f, 0.174126685f},
-std::array<float,2>{0.0491024107f, 0.111567095f},
-std::array<float,2>{0.615010202f, 0.657709718f},
-std::array<float,2>{0.297746062f, 0.873297811f},
-std::array<float,2>{0.900769174f, 0.326964974f},
-std::array<float,2>{0.0806631818f, 0.379664153f},
-std::array<float,2>{0.540502012f, 0.883327007f},
-std::array<float,2>{0.328029692f, 0.584761322f},
-std::array<float,2>{0.955951631f, 0.216940939f},
-std::array<float,2>{0.429022938f, 0.00288993237f},
-std::array<float,2>{0.846606672f, 0.749020755f},
-std::array<float,2>{0.200027272f, 0.758327186f},
-std::array<float,2>{0.695655704f, 0.265459359f},
-std::array<float,2>{0.269878983f, 0.356068224f},
-std::array<float,2>{0.928637326f, 0.8170681f},
-std::array<float,2>{0.0264613666f, 0.637967408f},
-std::array<float,2>{0.589663446f, 0.0698118433f},
-std::array<float,2>{0.16439119f, 0.150747329f},
-std::array<float,2>{0.636466146f, 0.519440472f},
-std::array<float,2>{0.464578956f, 0.99855727f},
-std::array<float,2>{0.753762126f, 0.468889415f},
-std::array<float,2>{0.157798365f, 0.401279211f},
-std::array<float,2>{0.632718205f, 0.899082184f},
-std::array<float,2>{0.459758699f, 0.570566714f},
-std::array<float,2>{0.761684358f, 0.202245936f},
-std::array<float,2>{0.275215775f, 0.0239392053f},
-std::array<float,2>{0.9318344f, 0.732380629f},
-std::array<float,2>{0.0224062111f, 0.767174721f},
-std::array<float,2>{0.580452025f, 0.272059619f},
-std::array<float,2>{0.430554748f, 0.359981835f},
-std::array<float,2>{0.855944097f, 0.832988799f},
-std::array<float,2>{0.194602072f, 0.651246727f},
-std::array<float,2>{0.690819561f, 0.0917973295f},
-std::array<float,2>{0.0876910239f, 0.131974235f},
-std::array<float,2>{0.53478682f, 0.50957036f},
-std::array<float,2>{0.317186445f, 0.979032457f},
-std::array<float,2>{0.968185961f, 0.497509956f},
-std::array<float,2>{0.0597021505f, 0.310690194f},
-std::array<float,2>{0.623527706f, 0.794412494f},
-std::array<float,2>{0.308535874f, 0.695545435f},
-std::array<float,2>{0.891129076f, 0.0576087981f},
-std::array<float,2>{0.475478917f, 0.244489715f},
-std::array<float,2>{0.802460015f, 0.600273013f},
-std::array<float,2>{0.136559874f, 0.913995504f},
-std::array<float,2>{0.665180326f, 0.424252182f},
-std::array<float,2>{0.359887868f, 0.449739873f},
-std::array<float,2>{0.991174221f, 0.93826139f},
-std::array<float,2>{0.102745429f, 0.549423695f},
-std::array<float,2>{0.510905087f, 0.171451792f},
-std::array<float,2>{0.240223989f, 0.0977534726f},
-std::array<float,2>{0.749860823f, 0.674990833f},
-std::array<float,2>{0.396139443f, 0.846701145f},
-std::array<float,2>{0.822560668f, 0.330080807f},
-std::array<float,2>{0.216732383f, 0.320799381f},
-std::array<float,2>{0.704821706f, 0.868747473f},
-std::array<float,2>{0.408872128f, 0.661265671f},
-std::array<float,2>{0.866401017f, 0.116964079f},
-std::array<float,2>{0.328587204f, 0.178556845f},
-std::array<float,2>{0.950049937f, 0.542892814f},
-std::array<float,2>{0.0662980303f, 0.955894709f},
-std::array<float,2>{0.55764538f, 0.468127668f},
-std::array<float,2>{0.449528575f, 0.408212125f},
-std::array<float,2>{0.778180659f, 0.931950271f},
-std::array<float,2>{0.172621086f, 0.611948371f},
-std::array<float,2>{0.642729342f, 0.23159866f},
-std::array<float,2>{0.0137072923f, 0.0351392739f},
-std::array<float,2>{0.564753532f, 0.705633938f},
-std::array<float,2>{0.261231273f, 0.804005742f},
-std::array<float,2>{0.920867264f, 0.282193512f},
-std::array<float,2>{0.115420774f, 0.473191977f},
-std::array<float,2>{0.522412121f, 0.994669676f},
-std::array<float,2>{0.344914824f, 0.521302342f},
-std::array<float,2>{0.983423889f, 0.156117707f},
-std::array<float,2>{0.380447626f, 0.0628650859f},
-std::array<float,2>{0.831810713f, 0.632956922f},
-std::array<float,2>{0.231084049f, 0.813969195f},
-std::array<float,2>{0.724748611f, 0.353567272f},
-std::array<float,2>{0.28823173f, 0.259780139f},
-std::array<float,2>{0.887155473f, 0.765526354f},
-std::array<float,2>{0.0330608338f, 0.745483696f},
-std::array<float,2>{0.599573076f, 0.00430394476f},
-std::array<float,2>{0.149551749f, 0.211775139f},
-std::array<float,2>{0.674132884f, 0.581915557f},
-std::array<float,2>{0.493919671f, 0.887903392f},
-std::array<float,2>{0.791082561f, 0.377308995f},
-std::array<float,2>{0.225874573f, 0.459075451f},
-std::array<float,2>{0.733575344f, 0.964426219f},
-std::array<float,2>{0.385326356f, 0.532225907f},
-std::array<float,2>{0.843686163f, 0.186823457f},
-std::array<float,2>{0.357204437f, 0.118595108f},
-std::array<float,2>{0.971348166f, 0.665142596f},
-std::array<float,2>{0.122736692f, 0.861766934f},
-std::array<float,2>{0.527885497f, 0.313585192f},
-std::array<float,2>{0.489786178f, 0.290893972f},
-std::array<float,2>{0.788177311f, 0.808582246f},
-std::array<float,2>{0.146030948f, 0.711335957f},
-std::array<float,2>{0.679839969f, 0.0463387929f},
-std::array<float,2>{0.0415950827f, 0.218845561f},
-std::array<float,2>{0.603071868f, 0.623086333f},
-std::array<float,2>{0.293146878f, 0.928999603f},
-std::array<float,2>{0.881917953f, 0.41593346f},
-std::array<float,2>{0.0732603744f, 0.344999731f},
-std::array<float,2>{0.552163363f, 0.827203989f},
-std::array<float,2>{0.3378084f, 0.626318216f},
-std::array<float,2>{0.937847376f, 0.0725349858f},
-std::array<float,2>{0.420662582f, 0.148241654f},
-std::array<float,2>{0.869813979f, 0.525198162f},
-std::array<float,2>{0.203754798f, 0.990593016f},
-std::array<float,2>{0.716268897f, 0.482208729f},
-std::array<float,2>{0.250767589f, 0.389867127f},
-std::array<float,2>{0.912930012f, 0.881985068f},
-std::array<float,2>{0.00099159067f, 0.591617465f},
-std::array<float,2>{0.570983768f, 0.210885495f},
-std::array<float,2>{0.185391873f, 0.0102700051f},
-std::array<float,2>{0.652766585f, 0.741278052f},
-std::array<float,2>{0.43772772f, 0.750941336f},
-std::array<float,2>{0.772334754f, 0.254389703f},
-std::array<float,2>{0.131673604f, 0.276034623f},
-std::array<float,2>{0.660044611f, 0.778103828f},
-std::array<float,2>{0.477727711f, 0.725198328f},
-std::array<float,2>{0.808691204f, 0.0223184116f},
-std::array<float,2>{0.303717881f, 0.189284742f},
-std::array<float,2>{0.903078973f, 0.569163918f},
-std::array<float,2>{0.0541562065f, 0.895525515f},
-std::array<float,2>{0.609987259f, 0.394156694f},
-std::array<float,2>{0.403202683f, 0.484650463f},
-std::array<float,2>{0.817653358f, 0.970374644f},
-std::array<float,2>{0.244514585f, 0.503209352f},
-std::array<float,2>{0.738088429f, 0.135708258f},
-std::array<float,2>{0.0992321447f, 0.0823548511f},
-std::array<float,2>{0.503315449f, 0.642525673f},
-std::array<float,2>{0.369738132f, 0.840239227f},
-std::array<float,2>{0.99749428f, 0.369124949f},
-std::array<float,2>{0.0293563828f, 0.433205485f},
-std::array<float,2>{0.590185702f, 0.920840502f},
-std::array<float,2>{0.265950263f, 0.607935011f},
-std::array<float,2>{0.923704684f, 0.237162307f},
-std::array<float,2>{0.46842441f, 0.050564073f},
-std::array<float,2>{0.757405996f, 0.687949598f},
-std::array<float,2>{0.170203403f, 0.785189569f},
-std::array<float,2>{0.640064359f, 0.29821685f},
-std::array<float,2>{0.320442528f, 0.338080466f},
-std::array<float,2>{0.959711969f, 0.85773766f},
-std::array<float,2>{0.0857306197f, 0.684119761f},
-std::array<float,2>{0.54531157f, 0.104033381f},
-std::array<float,2>{0.198157981f, 0.163486257f},
-std::array<float,2>{0.700191319f, 0.557519317f},
-std::array<float,2>{0.424214184f, 0.94971174f},
-std::array<float,2>{0.848877847f, 0.444805682f}}
\ No newline at end of file
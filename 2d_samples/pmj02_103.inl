@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.230950683f, 0.659425199f},
-std::array<float,2>{0.852888525f, 0.0825801045f},
-std::array<float,2>{0.444068134f, 0.484513581f},
-std::array<float,2>{0.570809424f, 0.997271895f},
-std::array<float,2>{0.342509687f, 0.766550422f},
-std::array<float,2>{0.722857118f, 0.317877889f},
-std::array<float,2>{0.0317677557f, 0.13018997f},
-std::array<float,2>{0.989454806f, 0.526033163f},
-std::array<float,2>{0.384538531f, 0.593952119f},
-std::array<float,2>{0.515392184f, 0.205471843f},
-std::array<float,2>{0.147624776f, 0.289882898f},
-std::array<float,2>{0.75326401f, 0.865944266f},
-std::array<float,2>{0.107778281f, 0.89374429f},
-std::array<float,2>{0.904147208f, 0.40672639f},
-std::array<float,2>{0.291571707f, 0.0464421436f},
-std::array<float,2>{0.683034778f, 0.73000145f},
-std::array<float,2>{0.00336037972f, 0.540224254f},
-std::array<float,2>{0.961422622f, 0.173866749f},
-std::array<float,2>{0.369176239f, 0.345142394f},
-std::array<float,2>{0.69963634f, 0.809649408f},
-std::array<float,2>{0.47863844f, 0.939602673f},
-std::array<float,2>{0.599383771f, 0.444332331f},
-std::array<float,2>{0.201950341f, 0.119993471f},
-std::array<float,2>{0.824154019f, 0.626064837f},
-std::array<float,2>{0.260617048f, 0.699377835f},
-std::array<float,2>{0.653386116f, 0.0204972215f},
-std::array<float,2>{0.0854161233f, 0.385993123f},
-std::array<float,2>{0.91536814f, 0.906498849f},
-std::array<float,2>{0.172873214f, 0.83983767f},
-std::array<float,2>{0.802063286f, 0.254687339f},
-std::array<float,2>{0.41305083f, 0.242335543f},
-std::array<float,2>{0.545526326f, 0.584288955f},
-std::array<float,2>{0.129459709f, 0.576241016f},
-std::array<float,2>{0.767764926f, 0.232209414f},
-std::array<float,2>{0.393963277f, 0.275926501f},
-std::array<float,2>{0.525247455f, 0.817338645f},
-std::array<float,2>{0.301589787f, 0.93307209f},
-std::array<float,2>{0.66568625f, 0.404931724f},
-std::array<float,2>{0.118805602f, 0.00364134531f},
-std::array<float,2>{0.876320541f, 0.710699439f},
-std::array<float,2>{0.464060962f, 0.646753907f},
-std::array<float,2>{0.58278966f, 0.0940287933f},
-std::array<float,2>{0.241881147f, 0.463716239f},
-std::array<float,2>{0.862245142f, 0.96256876f},
-std::array<float,2>{0.0538593493f, 0.787504494f},
-std::array<float,2>{0.980297863f, 0.362683475f},
-std::array<float,2>{0.326077193f, 0.169571191f},
-std::array<float,2>{0.743771076f, 0.549565256f},
-std::array<float,2>{0.0680026039f, 0.743520796f},
-std::array<float,2>{0.930121541f, 0.0474015139f},
-std::array<float,2>{0.280227423f, 0.432218999f},
-std::array<float,2>{0.628696024f, 0.882269979f},
-std::array<float,2>{0.433316052f, 0.850336254f},
-std::array<float,2>{0.558242738f, 0.308551043f},
-std::array<float,2>{0.16088587f, 0.195203245f},
-std::array<float,2>{0.793739796f, 0.613696575f},
-std::array<float,2>{0.347513884f, 0.515565336f},
-std::array<float,2>{0.714425445f, 0.147830248f},
-std::array<float,2>{0.0231828466f, 0.343430281f},
-std::array<float,2>{0.93862021f, 0.756399035f},
-std::array<float,2>{0.206670046f, 0.973086953f},
-std::array<float,2>{0.830258548f, 0.475589514f},
-std::array<float,2>{0.486121237f, 0.063489072f},
-std::array<float,2>{0.611586571f, 0.685978055f},
-std::array<float,2>{0.166705176f, 0.71803534f},
-std::array<float,2>{0.787499368f, 0.00896323659f},
-std::array<float,2>{0.424306899f, 0.394372255f},
-std::array<float,2>{0.551871181f, 0.925484598f},
-std::array<float,2>{0.270184785f, 0.823922157f},
-std::array<float,2>{0.634710848f, 0.268944293f},
-std::array<float,2>{0.0742375776f, 0.225245342f},
-std::array<float,2>{0.922666252f, 0.562621415f},
-std::array<float,2>{0.499055535f, 0.557446003f},
-std::array<float,2>{0.620478272f, 0.160109922f},
-std::array<float,2>{0.217037499f, 0.371176153f},
-std::array<float,2>{0.842759311f, 0.79494369f},
-std::array<float,2>{0.0252049807f, 0.957546294f},
-std::array<float,2>{0.945320249f, 0.455527574f},
-std::array<float,2>{0.352776706f, 0.102849618f},
-std::array<float,2>{0.706827402f, 0.651976883f},
-std::array<float,2>{0.109722033f, 0.622496963f},
-std::array<float,2>{0.887949288f, 0.199466154f},
-std::array<float,2>{0.304782301f, 0.299940556f},
-std::array<float,2>{0.662766159f, 0.855675697f},
-std::array<float,2>{0.400941938f, 0.883285582f},
-std::array<float,2>{0.522372663f, 0.424701959f},
-std::array<float,2>{0.140304744f, 0.0582831129f},
-std::array<float,2>{0.775560319f, 0.738951623f},
-std::array<float,2>{0.315501183f, 0.674931288f},
-std::array<float,2>{0.735653341f, 0.0706175119f},
-std::array<float,2>{0.0555235632f, 0.484023541f},
-std::array<float,2>{0.973591924f, 0.981210053f},
-std::array<float,2>{0.245205462f, 0.75850153f},
-std::array<float,2>{0.873289943f, 0.329663634f},
-std::array<float,2>{0.460202426f, 0.155674845f},
-std::array<float,2>{0.588200808f, 0.500740469f},
-std::array<float,2>{0.194863215f, 0.522201657f},
-std::array<float,2>{0.814278364f, 0.135856912f},
-std::array<float,2>{0.469125122f, 0.321897209f},
-std::array<float,2>{0.602372706f, 0.773851275f},
-std::array<float,2>{0.363988578f, 0.990620375f},
-std::array<float,2>{0.692991614f, 0.493659526f},
-std::array<float,2>{0.0108335307f, 0.0916321874f},
-std::array<float,2>{0.956953645f, 0.669676542f},
-std::array<float,2>{0.416942328f, 0.724276066f},
-std::array<float,2>{0.536235869f, 0.0379068032f},
-std::array<float,2>{0.186575264f, 0.414227515f},
-std::array<float,2>{0.810304642f, 0.900930762f},
-std::array<float,2>{0.0910336003f, 0.872187197f},
-std::array<float,2>{0.908066928f, 0.282115579f},
-std::array<float,2>{0.250432402f, 0.216343135f},
-std::array<float,2>{0.647928894f, 0.606059313f},
-std::array<float,2>{0.0408735275f, 0.636609375f},
-std::array<float,2>{0.997868419f, 0.11494536f},
-std::array<float,2>{0.335919976f, 0.446144462f},
-std::array<float,2>{0.730429292f, 0.94590348f},
-std::array<float,2>{0.447144717f, 0.8023929f},
-std::array<float,2>{0.569069505f, 0.355947345f},
-std::array<float,2>{0.223059461f, 0.180481181f},
-std::array<float,2>{0.850264549f, 0.53418988f},
-std::array<float,2>{0.286786854f, 0.592021585f},
-std::array<float,2>{0.676532567f, 0.234491765f},
-std::array<float,2>{0.0983337983f, 0.25803107f},
-std::array<float,2>{0.893247783f, 0.834003329f},
-std::array<float,2>{0.15099965f, 0.920161426f},
-std::array<float,2>{0.763418496f, 0.380935252f},
-std::array<float,2>{0.382536918f, 0.0258941576f},
-std::array<float,2>{0.507390261f, 0.694027603f},
-std::array<float,2>{0.21399349f, 0.732855856f},
-std::array<float,2>{0.839596629f, 0.040865887f},
-std::array<float,2>{0.492614657f, 0.412287772f},
-std::array<float,2>{0.623888612f, 0.897547781f},
-std::array<float,2>{0.358410031f, 0.861947775f},
-std::array<float,2>{0.70977658f, 0.29639557f},
-std::array<float,2>{0.0300174821f, 0.208884194f},
-std::array<float,2>{0.952934623f, 0.601442635f},
-std::array<float,2>{0.426150829f, 0.528973937f},
-std::array<float,2>{0.547928751f, 0.127432287f},
-std::array<float,2>{0.170106322f, 0.314202577f},
-std::array<float,2>{0.784985125f, 0.773157239f},
-std::array<float,2>{0.0705598965f, 0.992908061f},
-std::array<float,2>{0.926673114f, 0.490505069f},
-std::array<float,2>{0.268806964f, 0.078165859f},
-std::array<float,2>{0.639816999f, 0.662058115f},
-std::array<float,2>{0.0607105941f, 0.581082046f},
-std::array<float,2>{0.970267177f, 0.247938797f},
-std::array<float,2>{0.319294304f, 0.253662586f},
-std::array<float,2>{0.74007386f, 0.843128383f},
-std::array<float,2>{0.45345071f, 0.911504209f},
-std::array<float,2>{0.590002298f, 0.389912039f},
-std::array<float,2>{0.246402204f, 0.0175773297f},
-std::array<float,2>{0.870325327f, 0.697177112f},
-std::array<float,2>{0.311053485f, 0.630461574f},
-std::array<float,2>{0.659151614f, 0.123767272f},
-std::array<float,2>{0.115557551f, 0.440754473f},
-std::array<float,2>{0.884892821f, 0.942489862f},
-std::array<float,2>{0.134033486f, 0.807646513f},
-std::array<float,2>{0.779696345f, 0.351421446f},
-std::array<float,2>{0.405752212f, 0.177634671f},
-std::array<float,2>{0.517502308f, 0.546356916f},
-std::array<float,2>{0.181994691f, 0.554610968f},
-std::array<float,2>{0.804850757f, 0.165644333f},
-std::array<float,2>{0.419801533f, 0.365390271f},
-std::array<float,2>{0.534327805f, 0.781882226f},
-std::array<float,2>{0.25536108f, 0.965014756f},
-std::array<float,2>{0.64087373f, 0.465102881f},
-std::array<float,2>{0.0890612081f, 0.100636348f},
-std::array<float,2>{0.912257373f, 0.643161058f},
-std::array<float,2>{0.476428211f, 0.705078065f},
-std::array<float,2>{0.608408391f, 0.00679219281f},
-std::array<float,2>{0.188799858f, 0.400682598f},
-std::array<float,2>{0.818927646f, 0.935572982f},
-std::array<float,2>{0.0147147058f, 0.813877821f},
-std::array<float,2>{0.95714587f, 0.280007154f},
-std::array<float,2>{0.36096561f, 0.22817561f},
-std::array<float,2>{0.691031873f, 0.573860943f},
-std::array<float,2>{0.0956402943f, 0.6807639f},
-std::array<float,2>{0.896961629f, 0.0665151477f},
-std::array<float,2>{0.281601727f, 0.470704556f},
-std::array<float,2>{0.675599813f, 0.972509921f},
-std::array<float,2>{0.377040833f, 0.752369106f},
-std::array<float,2>{0.503712893f, 0.337302536f},
-std::array<float,2>{0.155953646f, 0.141079202f},
-std::array<float,2>{0.758552313f, 0.509813964f},
-std::array<float,2>{0.330110431f, 0.613237798f},
-std::array<float,2>{0.730849981f, 0.187698185f},
-std::array<float,2>{0.043577265f, 0.30918327f},
-std::array<float,2>{0.995947301f, 0.844631553f},
-std::array<float,2>{0.221828178f, 0.876153409f},
-std::array<float,2>{0.847219348f, 0.43582955f},
-std::array<float,2>{0.451313138f, 0.0535040423f},
-std::array<float,2>{0.56584096f, 0.747555912f},
-std::array<float,2>{0.142056346f, 0.653223634f},
-std::array<float,2>{0.755835891f, 0.106548302f},
-std::array<float,2>{0.389211088f, 0.457250625f},
-std::array<float,2>{0.510561049f, 0.954814851f},
-std::array<float,2>{0.295058638f, 0.791315913f},
-std::array<float,2>{0.686169744f, 0.368819952f},
-std::array<float,2>{0.103008606f, 0.16204533f},
-std::array<float,2>{0.898503125f, 0.559011042f},
-std::array<float,2>{0.440765291f, 0.567461014f},
-std::array<float,2>{0.575947404f, 0.221688524f},
-std::array<float,2>{0.230389878f, 0.271514356f},
-std::array<float,2>{0.856876433f, 0.824530184f},
-std::array<float,2>{0.0365988724f, 0.929585099f},
-std::array<float,2>{0.985755265f, 0.394692153f},
-std::array<float,2>{0.336843818f, 0.0124241021f},
-std::array<float,2>{0.719451725f, 0.711076975f},
-std::array<float,2>{0.0800082013f, 0.506193519f},
-std::array<float,2>{0.918956399f, 0.149873346f},
-std::array<float,2>{0.262836337f, 0.335419267f},
-std::array<float,2>{0.652179599f, 0.763526201f},
-std::array<float,2>{0.408031613f, 0.977000117f},
-std::array<float,2>{0.539718866f, 0.477461517f},
-std::array<float,2>{0.179157734f, 0.0780882463f},
-std::array<float,2>{0.799074292f, 0.678066254f},
-std::array<float,2>{0.374918044f, 0.736240387f},
-std::array<float,2>{0.695508718f, 0.0615757927f},
-std::array<float,2>{0.00549346302f, 0.428499818f},
-std::array<float,2>{0.965316415f, 0.89055109f},
-std::array<float,2>{0.199039459f, 0.851937652f},
-std::array<float,2>{0.827968836f, 0.302358925f},
-std::array<float,2>{0.484253347f, 0.197180718f},
-std::array<float,2>{0.595625699f, 0.618703902f},
-std::array<float,2>{0.236711755f, 0.602656662f},
-std::array<float,2>{0.864727497f, 0.212006912f},
-std::array<float,2>{0.467325419f, 0.287622035f},
-std::array<float,2>{0.580381453f, 0.867870688f},
-std::array<float,2>{0.322128385f, 0.902419031f},
-std::array<float,2>{0.749666214f, 0.420953929f},
-std::array<float,2>{0.0494165421f, 0.0319786966f},
-std::array<float,2>{0.982896388f, 0.721982479f},
-std::array<float,2>{0.397886842f, 0.665913701f},
-std::array<float,2>{0.530796587f, 0.0879532024f},
-std::array<float,2>{0.125105217f, 0.496222675f},
-std::array<float,2>{0.773146212f, 0.988153756f},
-std::array<float,2>{0.123246834f, 0.779058397f},
-std::array<float,2>{0.879830718f, 0.324672431f},
-std::array<float,2>{0.297540456f, 0.140577003f},
-std::array<float,2>{0.668562055f, 0.516376674f},
-std::array<float,2>{0.0166096594f, 0.689283013f},
-std::array<float,2>{0.943577766f, 0.0289783608f},
-std::array<float,2>{0.349065602f, 0.37848863f},
-std::array<float,2>{0.718634248f, 0.917689562f},
-std::array<float,2>{0.49034819f, 0.828879595f},
-std::array<float,2>{0.615315139f, 0.262600869f},
-std::array<float,2>{0.207581744f, 0.239279822f},
-std::array<float,2>{0.834486902f, 0.58638227f},
-std::array<float,2>{0.27345714f, 0.535269976f},
-std::array<float,2>{0.632718384f, 0.185323536f},
-std::array<float,2>{0.0642205626f, 0.353503644f},
-std::array<float,2>{0.934801161f, 0.798559844f},
-std::array<float,2>{0.159055099f, 0.949540079f},
-std::array<float,2>{0.792633295f, 0.453109443f},
-std::array<float,2>{0.436445296f, 0.110837109f},
-std::array<float,2>{0.561693728f, 0.637307882f},
-std::array<float,2>{0.20080024f, 0.626988888f},
-std::array<float,2>{0.821015477f, 0.118383035f},
-std::array<float,2>{0.477770805f, 0.442019194f},
-std::array<float,2>{0.600381255f, 0.938799083f},
-std::array<float,2>{0.367939055f, 0.812037051f},
-std::array<float,2>{0.702005029f, 0.346176893f},
-std::array<float,2>{0.00133072666f, 0.173376828f},
-std::array<float,2>{0.962940872f, 0.542858839f},
-std::array<float,2>{0.410953701f, 0.583830178f},
-std::array<float,2>{0.543430567f, 0.245708168f},
-std::array<float,2>{0.17513445f, 0.257262617f},
-std::array<float,2>{0.803428948f, 0.837513626f},
-std::array<float,2>{0.08377143f, 0.909193158f},
-std::array<float,2>{0.916320503f, 0.383786321f},
-std::array<float,2>{0.259490579f, 0.0215722416f},
-std::array<float,2>{0.655199885f, 0.702218235f},
-std::array<float,2>{0.0332500264f, 0.524692655f},
-std::array<float,2>{0.990622222f, 0.132735908f},
-std::array<float,2>{0.340526491f, 0.31856069f},
-std::array<float,2>{0.72514987f, 0.768651366f},
-std::array<float,2>{0.442412376f, 0.998928487f},
-std::array<float,2>{0.572508216f, 0.486819983f},
-std::array<float,2>{0.232559547f, 0.0855185464f},
-std::array<float,2>{0.854590118f, 0.656716049f},
-std::array<float,2>{0.290809929f, 0.727444828f},
-std::array<float,2>{0.680611193f, 0.0438509285f},
-std::array<float,2>{0.107080542f, 0.409466743f},
-std::array<float,2>{0.904304206f, 0.892376482f},
-std::array<float,2>{0.145460561f, 0.864963174f},
-std::array<float,2>{0.751363337f, 0.292473853f},
-std::array<float,2>{0.386238843f, 0.204524547f},
-std::array<float,2>{0.51209569f, 0.595722973f},
-std::array<float,2>{0.163937539f, 0.616099358f},
-std::array<float,2>{0.795225918f, 0.192873642f},
-std::array<float,2>{0.431352317f, 0.304920614f},
-std::array<float,2>{0.556266665f, 0.847771823f},
-std::array<float,2>{0.277350664f, 0.879721761f},
-std::array<float,2>{0.626375079f, 0.431209922f},
-std::array<float,2>{0.0687543377f, 0.050007686f},
-std::array<float,2>{0.933184683f, 0.745721698f},
-std::array<float,2>{0.486498833f, 0.684227884f},
-std::array<float,2>{0.610175431f, 0.0654940605f},
-std::array<float,2>{0.204772472f, 0.473706692f},
-std::array<float,2>{0.828140199f, 0.976548135f},
-std::array<float,2>{0.0201594289f, 0.755315006f},
-std::array<float,2>{0.941153765f, 0.341424078f},
-std::array<float,2>{0.344621658f, 0.1449202f},
-std::array<float,2>{0.712548137f, 0.511933744f},
-std::array<float,2>{0.119759642f, 0.707934141f},
-std::array<float,2>{0.877352118f, 0.000903065666f},
-std::array<float,2>{0.304508716f, 0.403877556f},
-std::array<float,2>{0.667279303f, 0.931376278f},
-std::array<float,2>{0.392035961f, 0.818696082f},
-std::array<float,2>{0.526334584f, 0.273707449f},
-std::array<float,2>{0.131713301f, 0.232920155f},
-std::array<float,2>{0.767453372f, 0.575713575f},
-std::array<float,2>{0.328087091f, 0.548784733f},
-std::array<float,2>{0.74420774f, 0.170554176f},
-std::array<float,2>{0.0517455153f, 0.359876722f},
-std::array<float,2>{0.976807415f, 0.786409557f},
-std::array<float,2>{0.24015668f, 0.963223398f},
-std::array<float,2>{0.860919535f, 0.460960716f},
-std::array<float,2>{0.461456895f, 0.0964799002f},
-std::array<float,2>{0.584380329f, 0.645329833f},
-std::array<float,2>{0.138048545f, 0.741871953f},
-std::array<float,2>{0.774263859f, 0.0559770316f},
-std::array<float,2>{0.399837255f, 0.422113568f},
-std::array<float,2>{0.521246135f, 0.885878801f},
-std::array<float,2>{0.306819677f, 0.85874325f},
-std::array<float,2>{0.660486698f, 0.298732251f},
-std::array<float,2>{0.112685598f, 0.202930316f},
-std::array<float,2>{0.890504122f, 0.623147666f},
-std::array<float,2>{0.457460701f, 0.502144158f},
-std::array<float,2>{0.586165786f, 0.153249979f},
-std::array<float,2>{0.243271858f, 0.330721527f},
-std::array<float,2>{0.87123853f, 0.760622799f},
-std::array<float,2>{0.0567323454f, 0.983877361f},
-std::array<float,2>{0.975843728f, 0.482418537f},
-std::array<float,2>{0.313307732f, 0.0737754181f},
-std::array<float,2>{0.737206697f, 0.672006786f},
-std::array<float,2>{0.0765624568f, 0.565569222f},
-std::array<float,2>{0.925238132f, 0.223999545f},
-std::array<float,2>{0.271488547f, 0.26644063f},
-std::array<float,2>{0.635273814f, 0.820757389f},
-std::array<float,2>{0.423224658f, 0.922355235f},
-std::array<float,2>{0.553644657f, 0.39242503f},
-std::array<float,2>{0.164442271f, 0.0109654181f},
-std::array<float,2>{0.78629148f, 0.714869201f},
-std::array<float,2>{0.353522152f, 0.649486005f},
-std::array<float,2>{0.704092026f, 0.103807554f},
-std::array<float,2>{0.0268748738f, 0.453950107f},
-std::array<float,2>{0.947552562f, 0.959873557f},
-std::array<float,2>{0.215100944f, 0.79377085f},
-std::array<float,2>{0.840680659f, 0.374493688f},
-std::array<float,2>{0.496488601f, 0.156558499f},
-std::array<float,2>{0.617857218f, 0.55542326f},
-std::array<float,2>{0.225197509f, 0.53224504f},
-std::array<float,2>{0.847893476f, 0.182487518f},
-std::array<float,2>{0.4481906f, 0.35885033f},
-std::array<float,2>{0.567790091f, 0.803830206f},
-std::array<float,2>{0.332162917f, 0.948923528f},
-std::array<float,2>{0.727566302f, 0.448502213f},
-std::array<float,2>{0.0413558818f, 0.116838716f},
-std::array<float,2>{0.999003053f, 0.633526921f},
-std::array<float,2>{0.380688906f, 0.692736924f},
-std::array<float,2>{0.50537771f, 0.0241417252f},
-std::array<float,2>{0.149053425f, 0.380790144f},
-std::array<float,2>{0.763735414f, 0.919625282f},
-std::array<float,2>{0.100311585f, 0.832113087f},
-std::array<float,2>{0.892063081f, 0.260576159f},
-std::array<float,2>{0.288023859f, 0.236556858f},
-std::array<float,2>{0.679210484f, 0.591425359f},
-std::array<float,2>{0.00973983761f, 0.67182374f},
-std::array<float,2>{0.953920901f, 0.0930251852f},
-std::array<float,2>{0.365587443f, 0.494933039f},
-std::array<float,2>{0.6952703f, 0.989556134f},
-std::array<float,2>{0.471253604f, 0.776671529f},
-std::array<float,2>{0.603930831f, 0.323262483f},
-std::array<float,2>{0.193115428f, 0.134348869f},
-std::array<float,2>{0.814564705f, 0.519994497f},
-std::array<float,2>{0.253804356f, 0.608027518f},
-std::array<float,2>{0.645527899f, 0.217894375f},
-std::array<float,2>{0.0920877382f, 0.284152031f},
-std::array<float,2>{0.908960521f, 0.874136567f},
-std::array<float,2>{0.184597239f, 0.899127245f},
-std::array<float,2>{0.811590195f, 0.417135715f},
-std::array<float,2>{0.415754765f, 0.0360581242f},
-std::array<float,2>{0.537132323f, 0.725966275f},
-std::array<float,2>{0.249612927f, 0.697614968f},
-std::array<float,2>{0.867453396f, 0.0180087499f},
-std::array<float,2>{0.456681073f, 0.387008458f},
-std::array<float,2>{0.592804551f, 0.912195921f},
-std::array<float,2>{0.316530734f, 0.840814114f},
-std::array<float,2>{0.741383791f, 0.251522124f},
-std::array<float,2>{0.058982145f, 0.249981642f},
-std::array<float,2>{0.972186744f, 0.578958273f},
-std::array<float,2>{0.403461069f, 0.543480039f},
-std::array<float,2>{0.519503951f, 0.178398296f},
-std::array<float,2>{0.136094883f, 0.347722232f},
-std::array<float,2>{0.778859198f, 0.805213094f},
-std::array<float,2>{0.113984354f, 0.944057643f},
-std::array<float,2>{0.884735167f, 0.437670887f},
-std::array<float,2>{0.30997017f, 0.12177676f},
-std::array<float,2>{0.658034205f, 0.631964862f},
-std::array<float,2>{0.0288187005f, 0.599449933f},
-std::array<float,2>{0.95049721f, 0.20987837f},
-std::array<float,2>{0.355795354f, 0.293850899f},
-std::array<float,2>{0.707300782f, 0.860971928f},
-std::array<float,2>{0.495335191f, 0.894931555f},
-std::array<float,2>{0.622994602f, 0.410618573f},
-std::array<float,2>{0.211492673f, 0.0421598889f},
-std::array<float,2>{0.837383091f, 0.731037617f},
-std::array<float,2>{0.266459256f, 0.662119806f},
-std::array<float,2>{0.637672246f, 0.0807444453f},
-std::array<float,2>{0.0731378198f, 0.488652825f},
-std::array<float,2>{0.928714156f, 0.994216025f},
-std::array<float,2>{0.169188529f, 0.770911813f},
-std::array<float,2>{0.781531751f, 0.316136122f},
-std::array<float,2>{0.429623038f, 0.126625523f},
-std::array<float,2>{0.54994154f, 0.530345738f},
-std::array<float,2>{0.15332596f, 0.509689748f},
-std::array<float,2>{0.761061907f, 0.143407285f},
-std::array<float,2>{0.375184447f, 0.339500934f},
-std::array<float,2>{0.500493169f, 0.751039445f},
-std::array<float,2>{0.283727318f, 0.968757153f},
-std::array<float,2>{0.672015548f, 0.469695717f},
-std::array<float,2>{0.0967955366f, 0.0698292032f},
-std::array<float,2>{0.894805551f, 0.68258369f},
-std::array<float,2>{0.449545056f, 0.748798072f},
-std::array<float,2>{0.56312108f, 0.0524217933f},
-std::array<float,2>{0.219345883f, 0.434494138f},
-std::array<float,2>{0.845227599f, 0.877314389f},
-std::array<float,2>{0.0457935594f, 0.847584069f},
-std::array<float,2>{0.993514657f, 0.311816782f},
-std::array<float,2>{0.329977006f, 0.189674392f},
-std::array<float,2>{0.734113216f, 0.61027658f},
-std::array<float,2>{0.0871540457f, 0.641038179f},
-std::array<float,2>{0.910226166f, 0.098446317f},
-std::array<float,2>{0.256144911f, 0.46699506f},
-std::array<float,2>{0.643301964f, 0.966889977f},
-std::array<float,2>{0.420361608f, 0.784156859f},
-std::array<float,2>{0.532022893f, 0.364429623f},
-std::array<float,2>{0.18071039f, 0.166913152f},
-std::array<float,2>{0.807124197f, 0.551098943f},
-std::array<float,2>{0.362268388f, 0.571520686f},
-std::array<float,2>{0.687744975f, 0.230312482f},
-std::array<float,2>{0.0131548652f, 0.278690904f},
-std::array<float,2>{0.960602582f, 0.815270662f},
-std::array<float,2>{0.190622807f, 0.934785962f},
-std::array<float,2>{0.817902565f, 0.400159031f},
-std::array<float,2>{0.473744154f, 0.00395239377f},
-std::array<float,2>{0.60582453f, 0.706503749f},
-std::array<float,2>{0.176541463f, 0.676236868f},
-std::array<float,2>{0.797484517f, 0.0747527182f},
-std::array<float,2>{0.409025401f, 0.47894913f},
-std::array<float,2>{0.542858899f, 0.979786873f},
-std::array<float,2>{0.264987022f, 0.765532494f},
-std::array<float,2>{0.648564935f, 0.333788872f},
-std::array<float,2>{0.0811615363f, 0.151056275f},
-std::array<float,2>{0.92133671f, 0.5054878f},
-std::array<float,2>{0.482301086f, 0.620878339f},
-std::array<float,2>{0.59575659f, 0.198945478f},
-std::array<float,2>{0.195852682f, 0.303125858f},
-std::array<float,2>{0.824763f, 0.853742182f},
-std::array<float,2>{0.00670638867f, 0.887917221f},
-std::array<float,2>{0.968110979f, 0.427422285f},
-std::array<float,2>{0.371196806f, 0.0595677681f},
-std::array<float,2>{0.698461056f, 0.736725271f},
-std::array<float,2>{0.105407678f, 0.56215018f},
-std::array<float,2>{0.902012229f, 0.162200138f},
-std::array<float,2>{0.294237822f, 0.369897306f},
-std::array<float,2>{0.68519187f, 0.78957355f},
-std::array<float,2>{0.387135923f, 0.956377208f},
-std::array<float,2>{0.50885123f, 0.460617125f},
-std::array<float,2>{0.142635971f, 0.108992636f},
-std::array<float,2>{0.756829739f, 0.654305935f},
-std::array<float,2>{0.339762419f, 0.714231014f},
-std::array<float,2>{0.722188413f, 0.0143470429f},
-std::array<float,2>{0.0385029502f, 0.397545964f},
-std::array<float,2>{0.988024116f, 0.926925242f},
-std::array<float,2>{0.228465408f, 0.827570498f},
-std::array<float,2>{0.857681692f, 0.271229416f},
-std::array<float,2>{0.437678009f, 0.219797894f},
-std::array<float,2>{0.576180637f, 0.568630755f},
-std::array<float,2>{0.210544825f, 0.5892362f},
-std::array<float,2>{0.832577646f, 0.240299568f},
-std::array<float,2>{0.488663375f, 0.265037626f},
-std::array<float,2>{0.613286555f, 0.83023566f},
-std::array<float,2>{0.35117346f, 0.914071143f},
-std::array<float,2>{0.715218663f, 0.376934499f},
-std::array<float,2>{0.0184097923f, 0.0297165811f},
-std::array<float,2>{0.94158411f, 0.689607203f},
-std::array<float,2>{0.435129315f, 0.639862597f},
-std::array<float,2>{0.560490966f, 0.111794285f},
-std::array<float,2>{0.156696066f, 0.45028615f},
-std::array<float,2>{0.790853739f, 0.951587081f},
-std::array<float,2>{0.0657357723f, 0.799907982f},
-std::array<float,2>{0.936784327f, 0.355110824f},
-std::array<float,2>{0.275483519f, 0.185923308f},
-std::array<float,2>{0.630210817f, 0.539007008f},
-std::array<float,2>{0.0482947491f, 0.719904721f},
-std::array<float,2>{0.982303739f, 0.0346405357f},
-std::array<float,2>{0.322408289f, 0.41839397f},
-std::array<float,2>{0.747604489f, 0.905561686f},
-std::array<float,2>{0.46549654f, 0.869479299f},
-std::array<float,2>{0.57822907f, 0.285455436f},
-std::array<float,2>{0.236312717f, 0.213868499f},
-std::array<float,2>{0.86551249f, 0.604488313f},
-std::array<float,2>{0.298944265f, 0.518792212f},
-std::array<float,2>{0.670213163f, 0.138063595f},
-std::array<float,2>{0.121176362f, 0.326264322f},
-std::array<float,2>{0.881554365f, 0.780943096f},
-std::array<float,2>{0.127213791f, 0.984841585f},
-std::array<float,2>{0.769908845f, 0.49953565f},
-std::array<float,2>{0.394916296f, 0.0861243159f},
-std::array<float,2>{0.529166341f, 0.666609943f},
-std::array<float,2>{0.241002023f, 0.645754039f},
-std::array<float,2>{0.862465799f, 0.0969940946f},
-std::array<float,2>{0.463521689f, 0.462230921f},
-std::array<float,2>{0.583839953f, 0.964730024f},
-std::array<float,2>{0.32499522f, 0.785852969f},
-std::array<float,2>{0.742473364f, 0.360826612f},
-std::array<float,2>{0.0534021519f, 0.171158239f},
-std::array<float,2>{0.979062855f, 0.547076821f},
-std::array<float,2>{0.393186331f, 0.574759007f},
-std::array<float,2>{0.524265468f, 0.234323472f},
-std::array<float,2>{0.130672932f, 0.274809539f},
-std::array<float,2>{0.768779039f, 0.819593847f},
-std::array<float,2>{0.117584683f, 0.929832399f},
-std::array<float,2>{0.875612319f, 0.403124243f},
-std::array<float,2>{0.302469075f, 0.00098469737f},
-std::array<float,2>{0.664831996f, 0.708569944f},
-std::array<float,2>{0.0219740961f, 0.512737632f},
-std::array<float,2>{0.937932134f, 0.146189094f},
-std::array<float,2>{0.346440494f, 0.340753883f},
-std::array<float,2>{0.713104725f, 0.754111946f},
-std::array<float,2>{0.484761387f, 0.974771142f},
-std::array<float,2>{0.612486124f, 0.473589838f},
-std::array<float,2>{0.205476582f, 0.0645557493f},
-std::array<float,2>{0.83181572f, 0.685051024f},
-std::array<float,2>{0.281217188f, 0.744431138f},
-std::array<float,2>{0.627885938f, 0.0494181514f},
-std::array<float,2>{0.0669499338f, 0.430006027f},
-std::array<float,2>{0.930974364f, 0.880235493f},
-std::array<float,2>{0.161232218f, 0.848745644f},
-std::array<float,2>{0.794067204f, 0.30618149f},
-std::array<float,2>{0.432170689f, 0.191654265f},
-std::array<float,2>{0.557585478f, 0.616980672f},
-std::array<float,2>{0.147312209f, 0.597028375f},
-std::array<float,2>{0.752646685f, 0.203513309f},
-std::array<float,2>{0.383084565f, 0.29176569f},
-std::array<float,2>{0.513852596f, 0.864206314f},
-std::array<float,2>{0.292830199f, 0.890875816f},
-std::array<float,2>{0.682610035f, 0.408776343f},
-std::array<float,2>{0.109357312f, 0.0447391681f},
-std::array<float,2>{0.90266335f, 0.728504717f},
-std::array<float,2>{0.444929063f, 0.657953203f},
-std::array<float,2>{0.572229385f, 0.0841056481f},
-std::array<float,2>{0.232182354f, 0.487771124f},
-std::array<float,2>{0.852275074f, 0.99949342f},
-std::array<float,2>{0.0328701735f, 0.76808548f},
-std::array<float,2>{0.988748372f, 0.319408655f},
-std::array<float,2>{0.343324274f, 0.131819353f},
-std::array<float,2>{0.723639131f, 0.52386409f},
-std::array<float,2>{0.0841031075f, 0.702107608f},
-std::array<float,2>{0.914747059f, 0.0230541546f},
-std::array<float,2>{0.261645049f, 0.384127617f},
-std::array<float,2>{0.652994335f, 0.908885658f},
-std::array<float,2>{0.413352907f, 0.836648941f},
-std::array<float,2>{0.546830475f, 0.256212592f},
-std::array<float,2>{0.172063991f, 0.245051369f},
-std::array<float,2>{0.801275849f, 0.582425058f},
-std::array<float,2>{0.370227098f, 0.541195154f},
-std::array<float,2>{0.700773716f, 0.172627941f},
-std::array<float,2>{0.00245567481f, 0.346886665f},
-std::array<float,2>{0.962797701f, 0.810578704f},
-std::array<float,2>{0.202284873f, 0.937740207f},
-std::array<float,2>{0.822882771f, 0.443176448f},
-std::array<float,2>{0.480043828f, 0.117190666f},
-std::array<float,2>{0.598543644f, 0.628005505f},
-std::array<float,2>{0.186089903f, 0.725238919f},
-std::array<float,2>{0.8088274f, 0.0370191708f},
-std::array<float,2>{0.417433918f, 0.416974813f},
-std::array<float,2>{0.53589052f, 0.899564207f},
-std::array<float,2>{0.251366466f, 0.873818398f},
-std::array<float,2>{0.64677757f, 0.284684062f},
-std::array<float,2>{0.090550378f, 0.216873989f},
-std::array<float,2>{0.90683049f, 0.609315336f},
-std::array<float,2>{0.470430762f, 0.521299243f},
-std::array<float,2>{0.602832794f, 0.132893682f},
-std::array<float,2>{0.193398282f, 0.323045343f},
-std::array<float,2>{0.812751114f, 0.776218653f},
-std::array<float,2>{0.00982384756f, 0.988983929f},
-std::array<float,2>{0.955788374f, 0.496059299f},
-std::array<float,2>{0.364808887f, 0.0923720449f},
-std::array<float,2>{0.692161679f, 0.670847952f},
-std::array<float,2>{0.0993362516f, 0.590165198f},
-std::array<float,2>{0.894485831f, 0.237827137f},
-std::array<float,2>{0.285220861f, 0.260984123f},
-std::array<float,2>{0.677303374f, 0.833939791f},
-std::array<float,2>{0.38112095f, 0.918319762f},
-std::array<float,2>{0.506284177f, 0.379818678f},
-std::array<float,2>{0.151381671f, 0.0244609546f},
-std::array<float,2>{0.761770308f, 0.692343831f},
-std::array<float,2>{0.334733248f, 0.633864403f},
-std::array<float,2>{0.728529096f, 0.115692146f},
-std::array<float,2>{0.0396769531f, 0.447810203f},
-std::array<float,2>{0.996729016f, 0.947631836f},
-std::array<float,2>{0.223762318f, 0.803680241f},
-std::array<float,2>{0.851269186f, 0.357650399f},
-std::array<float,2>{0.445615888f, 0.183590233f},
-std::array<float,2>{0.570097864f, 0.532062709f},
-std::array<float,2>{0.217786163f, 0.556016684f},
-std::array<float,2>{0.842922509f, 0.157785669f},
-std::array<float,2>{0.498758286f, 0.373807728f},
-std::array<float,2>{0.619859576f, 0.794498026f},
-std::array<float,2>{0.352062196f, 0.960441113f},
-std::array<float,2>{0.705985785f, 0.454861671f},
-std::array<float,2>{0.0235498305f, 0.104978554f},
-std::array<float,2>{0.947242558f, 0.64903748f},
-std::array<float,2>{0.424837112f, 0.716665447f},
-std::array<float,2>{0.551688254f, 0.00990160927f},
-std::array<float,2>{0.167195693f, 0.390714496f},
-std::array<float,2>{0.7886765f, 0.923437536f},
-std::array<float,2>{0.075622879f, 0.821434736f},
-std::array<float,2>{0.9230811f, 0.266981572f},
-std::array<float,2>{0.271173865f, 0.2230957f},
-std::array<float,2>{0.633550704f, 0.564837813f},
-std::array<float,2>{0.0563243069f, 0.673331857f},
-std::array<float,2>{0.973784506f, 0.0725925937f},
-std::array<float,2>{0.315178484f, 0.480770618f},
-std::array<float,2>{0.734668911f, 0.983227074f},
-std::array<float,2>{0.459799469f, 0.761640787f},
-std::array<float,2>{0.589770794f, 0.331445128f},
-std::array<float,2>{0.24488236f, 0.153532445f},
-std::array<float,2>{0.874687135f, 0.50306052f},
-std::array<float,2>{0.305720598f, 0.624062479f},
-std::array<float,2>{0.663546324f, 0.20138377f},
-std::array<float,2>{0.11068628f, 0.297350734f},
-std::array<float,2>{0.88708657f, 0.857891679f},
-std::array<float,2>{0.139123112f, 0.885685563f},
-std::array<float,2>{0.7766698f, 0.423495889f},
-std::array<float,2>{0.401819408f, 0.055019483f},
-std::array<float,2>{0.522747219f, 0.740550697f},
-std::array<float,2>{0.18833293f, 0.705097437f},
-std::array<float,2>{0.819634497f, 0.00550912041f},
-std::array<float,2>{0.474858224f, 0.398527771f},
-std::array<float,2>{0.608155847f, 0.934276879f},
-std::array<float,2>{0.359910756f, 0.816389918f},
-std::array<float,2>{0.689582765f, 0.278039813f},
-std::array<float,2>{0.0137652038f, 0.229268506f},
-std::array<float,2>{0.958851457f, 0.571072578f},
-std::array<float,2>{0.418203264f, 0.55184865f},
-std::array<float,2>{0.533627927f, 0.167307779f},
-std::array<float,2>{0.183475494f, 0.363629103f},
-std::array<float,2>{0.806059897f, 0.78429693f},
-std::array<float,2>{0.0880924836f, 0.968180776f},
-std::array<float,2>{0.913899302f, 0.468164116f},
-std::array<float,2>{0.254242897f, 0.0990720466f},
-std::array<float,2>{0.642295897f, 0.641866684f},
-std::array<float,2>{0.0443018563f, 0.61036402f},
-std::array<float,2>{0.994447589f, 0.19073765f},
-std::array<float,2>{0.331759036f, 0.311254084f},
-std::array<float,2>{0.731957793f, 0.845852554f},
-std::array<float,2>{0.452786058f, 0.878211856f},
-std::array<float,2>{0.564591706f, 0.43537125f},
-std::array<float,2>{0.221526444f, 0.0513917059f},
-std::array<float,2>{0.845724344f, 0.749054015f},
-std::array<float,2>{0.282604963f, 0.682962596f},
-std::array<float,2>{0.67423147f, 0.0686767027f},
-std::array<float,2>{0.0939388275f, 0.470218658f},
-std::array<float,2>{0.897629321f, 0.969962776f},
-std::array<float,2>{0.154380903f, 0.750680089f},
-std::array<float,2>{0.759669363f, 0.338532895f},
-std::array<float,2>{0.378471732f, 0.144296423f},
-std::array<float,2>{0.502072394f, 0.50793469f},
-std::array<float,2>{0.171681195f, 0.530243456f},
-std::array<float,2>{0.78370291f, 0.125941873f},
-std::array<float,2>{0.427553922f, 0.31452018f},
-std::array<float,2>{0.547524512f, 0.769700527f},
-std::array<float,2>{0.267826647f, 0.995323718f},
-std::array<float,2>{0.638672233f, 0.489449352f},
-std::array<float,2>{0.0720743835f, 0.0817157924f},
-std::array<float,2>{0.927189589f, 0.663343012f},
-std::array<float,2>{0.493346959f, 0.732119799f},
-std::array<float,2>{0.624344647f, 0.0418613032f},
-std::array<float,2>{0.21352081f, 0.411949217f},
-std::array<float,2>{0.838696599f, 0.89609611f},
-std::array<float,2>{0.030421989f, 0.860145628f},
-std::array<float,2>{0.951859355f, 0.294403851f},
-std::array<float,2>{0.358078986f, 0.210603625f},
-std::array<float,2>{0.71070075f, 0.598498642f},
-std::array<float,2>{0.116940938f, 0.631576777f},
-std::array<float,2>{0.886594474f, 0.122103751f},
-std::array<float,2>{0.311934531f, 0.439136893f},
-std::array<float,2>{0.65975678f, 0.9448241f},
-std::array<float,2>{0.404685616f, 0.806438506f},
-std::array<float,2>{0.516175687f, 0.349026114f},
-std::array<float,2>{0.133378848f, 0.178840965f},
-std::array<float,2>{0.781116128f, 0.544427276f},
-std::array<float,2>{0.319396108f, 0.579213381f},
-std::array<float,2>{0.73889792f, 0.248531744f},
-std::array<float,2>{0.0615570992f, 0.250877619f},
-std::array<float,2>{0.969580293f, 0.841533184f},
-std::array<float,2>{0.24801296f, 0.913210571f},
-std::array<float,2>{0.869786799f, 0.387960821f},
-std::array<float,2>{0.454657167f, 0.0193399973f},
-std::array<float,2>{0.591360748f, 0.699171484f},
-std::array<float,2>{0.126821905f, 0.667734623f},
-std::array<float,2>{0.772105932f, 0.0878641233f},
-std::array<float,2>{0.39668715f, 0.498318464f},
-std::array<float,2>{0.529639482f, 0.985370874f},
-std::array<float,2>{0.297876358f, 0.780123413f},
-std::array<float,2>{0.6692698f, 0.328050882f},
-std::array<float,2>{0.124341376f, 0.136950642f},
-std::array<float,2>{0.879908442f, 0.517656803f},
-std::array<float,2>{0.467891991f, 0.604498923f},
-std::array<float,2>{0.581829309f, 0.213640302f},
-std::array<float,2>{0.23790431f, 0.287093252f},
-std::array<float,2>{0.863877892f, 0.870177269f},
-std::array<float,2>{0.0504495054f, 0.904944956f},
-std::array<float,2>{0.9842031f, 0.419458896f},
-std::array<float,2>{0.321031719f, 0.0333529711f},
-std::array<float,2>{0.748650193f, 0.719266057f},
-std::array<float,2>{0.063337341f, 0.537711561f},
-std::array<float,2>{0.934223294f, 0.186635077f},
-std::array<float,2>{0.274891168f, 0.354211301f},
-std::array<float,2>{0.631030679f, 0.799784482f},
-std::array<float,2>{0.437185317f, 0.952554107f},
-std::array<float,2>{0.560988128f, 0.449463427f},
-std::array<float,2>{0.159737572f, 0.113024965f},
-std::array<float,2>{0.791088343f, 0.639107585f},
-std::array<float,2>{0.34801355f, 0.690709591f},
-std::array<float,2>{0.717347324f, 0.030544769f},
-std::array<float,2>{0.0162570626f, 0.37511456f},
-std::array<float,2>{0.944885731f, 0.915652394f},
-std::array<float,2>{0.208671823f, 0.831482649f},
-std::array<float,2>{0.835827887f, 0.264012367f},
-std::array<float,2>{0.491699547f, 0.241426662f},
-std::array<float,2>{0.617114961f, 0.588227272f},
-std::array<float,2>{0.229477316f, 0.56955409f},
-std::array<float,2>{0.855944514f, 0.219719827f},
-std::array<float,2>{0.439996958f, 0.269699782f},
-std::array<float,2>{0.57485491f, 0.826460242f},
-std::array<float,2>{0.337075084f, 0.926742554f},
-std::array<float,2>{0.720212519f, 0.397220224f},
-std::array<float,2>{0.0357866585f, 0.0152212214f},
-std::array<float,2>{0.984436512f, 0.713511229f},
-std::array<float,2>{0.390595227f, 0.655784667f},
-std::array<float,2>{0.511296391f, 0.107857637f},
-std::array<float,2>{0.141437173f, 0.459650367f},
-std::array<float,2>{0.754754245f, 0.955540776f},
-std::array<float,2>{0.102034412f, 0.790706694f},
-std::array<float,2>{0.899414957f, 0.370167255f},
-std::array<float,2>{0.296065956f, 0.163524285f},
-std::array<float,2>{0.687062144f, 0.560815752f},
-std::array<float,2>{0.00440509384f, 0.737701595f},
-std::array<float,2>{0.966355622f, 0.0598680153f},
-std::array<float,2>{0.373055279f, 0.425955802f},
-std::array<float,2>{0.696827471f, 0.887110472f},
-std::array<float,2>{0.48336643f, 0.855419099f},
-std::array<float,2>{0.594605327f, 0.304299086f},
-std::array<float,2>{0.197441816f, 0.197395325f},
-std::array<float,2>{0.826786578f, 0.619668365f},
-std::array<float,2>{0.261968076f, 0.504311144f},
-std::array<float,2>{0.650855422f, 0.1515387f},
-std::array<float,2>{0.0785870925f, 0.332132161f},
-std::array<float,2>{0.918725848f, 0.764126837f},
-std::array<float,2>{0.177983209f, 0.979280233f},
-std::array<float,2>{0.799811363f, 0.479973972f},
-std::array<float,2>{0.406650603f, 0.0757862031f},
-std::array<float,2>{0.540747106f, 0.6767869f},
-std::array<float,2>{0.203708395f, 0.686954379f},
-std::array<float,2>{0.829558432f, 0.0633843541f},
-std::array<float,2>{0.488244563f, 0.474723756f},
-std::array<float,2>{0.611030936f, 0.973973811f},
-std::array<float,2>{0.345524043f, 0.757553041f},
-std::array<float,2>{0.711245477f, 0.342608333f},
-std::array<float,2>{0.0211244971f, 0.14726679f},
-std::array<float,2>{0.939720273f, 0.513946354f},
-std::array<float,2>{0.43064642f, 0.615012884f},
-std::array<float,2>{0.55543077f, 0.194308698f},
-std::array<float,2>{0.162460729f, 0.307385236f},
-std::array<float,2>{0.796819806f, 0.851093769f},
-std::array<float,2>{0.0695644543f, 0.881359875f},
-std::array<float,2>{0.932228386f, 0.433069527f},
-std::array<float,2>{0.278532177f, 0.0480870195f},
-std::array<float,2>{0.625579f, 0.742328882f},
-std::array<float,2>{0.0525442995f, 0.550411999f},
-std::array<float,2>{0.977659225f, 0.168061852f},
-std::array<float,2>{0.326862514f, 0.362205744f},
-std::array<float,2>{0.745475531f, 0.788569868f},
-std::array<float,2>{0.462008715f, 0.961816013f},
-std::array<float,2>{0.585331202f, 0.464834869f},
-std::array<float,2>{0.238898054f, 0.0950067341f},
-std::array<float,2>{0.859595716f, 0.648217261f},
-std::array<float,2>{0.30332163f, 0.709013462f},
-std::array<float,2>{0.666060567f, 0.00281752204f},
-std::array<float,2>{0.120556109f, 0.405574054f},
-std::array<float,2>{0.877993524f, 0.931976557f},
-std::array<float,2>{0.132632941f, 0.818043053f},
-std::array<float,2>{0.766105592f, 0.276420742f},
-std::array<float,2>{0.39135322f, 0.231219739f},
-std::array<float,2>{0.527286947f, 0.577581823f},
-std::array<float,2>{0.174588054f, 0.585236967f},
-std::array<float,2>{0.804516196f, 0.243529081f},
-std::array<float,2>{0.411259443f, 0.255441338f},
-std::array<float,2>{0.544804752f, 0.838398755f},
-std::array<float,2>{0.258452326f, 0.90772754f},
-std::array<float,2>{0.656053841f, 0.385547131f},
-std::array<float,2>{0.0824183822f, 0.0207027588f},
-std::array<float,2>{0.917367339f, 0.700773597f},
-std::array<float,2>{0.477006853f, 0.625216544f},
-std::array<float,2>{0.601311505f, 0.120446831f},
-std::array<float,2>{0.200084075f, 0.445298105f},
-std::array<float,2>{0.822045028f, 0.941217005f},
-std::array<float,2>{0.000367244706f, 0.809046388f},
-std::array<float,2>{0.964502513f, 0.344705433f},
-std::array<float,2>{0.368403643f, 0.17533128f},
-std::array<float,2>{0.702579439f, 0.539106607f},
-std::array<float,2>{0.105981171f, 0.729474366f},
-std::array<float,2>{0.905402124f, 0.0456403308f},
-std::array<float,2>{0.289888233f, 0.407402784f},
-std::array<float,2>{0.681093872f, 0.892827034f},
-std::array<float,2>{0.385269195f, 0.866632044f},
-std::array<float,2>{0.513526201f, 0.290822685f},
-std::array<float,2>{0.146266758f, 0.206254542f},
-std::array<float,2>{0.750910997f, 0.595207691f},
-std::array<float,2>{0.341039091f, 0.527253747f},
-std::array<float,2>{0.726061046f, 0.129710972f},
-std::array<float,2>{0.0347696953f, 0.316558808f},
-std::array<float,2>{0.991726458f, 0.767358541f},
-std::array<float,2>{0.23429139f, 0.996507227f},
-std::array<float,2>{0.854037762f, 0.486098349f},
-std::array<float,2>{0.441434234f, 0.0835797116f},
-std::array<float,2>{0.573871136f, 0.658493876f},
-std::array<float,2>{0.149473578f, 0.69458127f},
-std::array<float,2>{0.765197158f, 0.026479546f},
-std::array<float,2>{0.379121721f, 0.382172078f},
-std::array<float,2>{0.504446566f, 0.921696365f},
-std::array<float,2>{0.288164467f, 0.835814118f},
-std::array<float,2>{0.678116441f, 0.259591937f},
-std::array<float,2>{0.100767076f, 0.235828608f},
-std::array<float,2>{0.891142607f, 0.593669772f},
-std::array<float,2>{0.449069291f, 0.533328652f},
-std::array<float,2>{0.566479802f, 0.180670291f},
-std::array<float,2>{0.225723445f, 0.356838524f},
-std::array<float,2>{0.848989427f, 0.801737189f},
-std::array<float,2>{0.0420000032f, 0.946524858f},
-std::array<float,2>{0.999901831f, 0.447229087f},
-std::array<float,2>{0.333572447f, 0.114128776f},
-std::array<float,2>{0.727513909f, 0.635627151f},
-std::array<float,2>{0.0931243673f, 0.606683671f},
-std::array<float,2>{0.909512639f, 0.21520035f},
-std::array<float,2>{0.252797991f, 0.282686651f},
-std::array<float,2>{0.644537747f, 0.871411145f},
-std::array<float,2>{0.415027201f, 0.901522934f},
-std::array<float,2>{0.538321376f, 0.415201664f},
-std::array<float,2>{0.184038475f, 0.0387577079f},
-std::array<float,2>{0.810743868f, 0.723262072f},
-std::array<float,2>{0.36647287f, 0.668221593f},
-std::array<float,2>{0.693468451f, 0.0907622054f},
-std::array<float,2>{0.00839254726f, 0.492506742f},
-std::array<float,2>{0.954447687f, 0.991864383f},
-std::array<float,2>{0.191435814f, 0.774612963f},
-std::array<float,2>{0.815692306f, 0.321256697f},
-std::array<float,2>{0.472133815f, 0.135632679f},
-std::array<float,2>{0.604741752f, 0.522954404f},
-std::array<float,2>{0.243026972f, 0.501333475f},
-std::array<float,2>{0.872720301f, 0.154980287f},
-std::array<float,2>{0.458067477f, 0.328513443f},
-std::array<float,2>{0.587356329f, 0.758955181f},
-std::array<float,2>{0.314070165f, 0.981944501f},
-std::array<float,2>{0.738072217f, 0.482701808f},
-std::array<float,2>{0.0577722974f, 0.0714848787f},
-std::array<float,2>{0.975002289f, 0.674681306f},
-std::array<float,2>{0.398861766f, 0.740185618f},
-std::array<float,2>{0.52008909f, 0.0567799881f},
-std::array<float,2>{0.137388676f, 0.425408661f},
-std::array<float,2>{0.774842322f, 0.884313226f},
-std::array<float,2>{0.11191611f, 0.857370496f},
-std::array<float,2>{0.889378488f, 0.298907667f},
-std::array<float,2>{0.308014452f, 0.20105958f},
-std::array<float,2>{0.661386311f, 0.621706963f},
-std::array<float,2>{0.0257758703f, 0.6506778f},
-std::array<float,2>{0.949015379f, 0.102360822f},
-std::array<float,2>{0.354844123f, 0.456179202f},
-std::array<float,2>{0.704986632f, 0.958357036f},
-std::array<float,2>{0.497969925f, 0.796727479f},
-std::array<float,2>{0.618991315f, 0.372632056f},
-std::array<float,2>{0.216572732f, 0.15885134f},
-std::array<float,2>{0.841396332f, 0.557831049f},
-std::array<float,2>{0.272793978f, 0.564256608f},
-std::array<float,2>{0.63633579f, 0.226094976f},
-std::array<float,2>{0.0772261769f, 0.267935872f},
-std::array<float,2>{0.924798965f, 0.823228121f},
-std::array<float,2>{0.165096879f, 0.924132288f},
-std::array<float,2>{0.785980225f, 0.392889977f},
-std::array<float,2>{0.422119558f, 0.0085993791f},
-std::array<float,2>{0.553801f, 0.717387259f},
-std::array<float,2>{0.220525995f, 0.747015417f},
-std::array<float,2>{0.844628632f, 0.0543448403f},
-std::array<float,2>{0.451062888f, 0.436524391f},
-std::array<float,2>{0.563947856f, 0.87503165f},
-std::array<float,2>{0.328316033f, 0.844998002f},
-std::array<float,2>{0.733261168f, 0.309728444f},
-std::array<float,2>{0.0462356098f, 0.189142406f},
-std::array<float,2>{0.992346585f, 0.611379921f},
-std::array<float,2>{0.376910985f, 0.510949433f},
-std::array<float,2>{0.501017809f, 0.141676992f},
-std::array<float,2>{0.153134003f, 0.33661148f},
-std::array<float,2>{0.760472357f, 0.753260851f},
-std::array<float,2>{0.0961115211f, 0.971630812f},
-std::array<float,2>{0.896087825f, 0.472136825f},
-std::array<float,2>{0.284716368f, 0.068264015f},
-std::array<float,2>{0.67354548f, 0.680401206f},
-std::array<float,2>{0.0121980757f, 0.572287977f},
-std::array<float,2>{0.959605157f, 0.227074102f},
-std::array<float,2>{0.362857968f, 0.28123942f},
-std::array<float,2>{0.688936293f, 0.812731326f},
-std::array<float,2>{0.473493814f, 0.93658179f},
-std::array<float,2>{0.606774747f, 0.402203113f},
-std::array<float,2>{0.189609736f, 0.0076987911f},
-std::array<float,2>{0.816779971f, 0.703800678f},
-std::array<float,2>{0.257124007f, 0.643566608f},
-std::array<float,2>{0.644119084f, 0.100166179f},
-std::array<float,2>{0.0866210982f, 0.466567934f},
-std::array<float,2>{0.911672354f, 0.966621101f},
-std::array<float,2>{0.180209413f, 0.78299439f},
-std::array<float,2>{0.808017015f, 0.366853774f},
-std::array<float,2>{0.421461642f, 0.164352506f},
-std::array<float,2>{0.533061862f, 0.552989781f},
-std::array<float,2>{0.135336056f, 0.545467556f},
-std::array<float,2>{0.778037965f, 0.175786704f},
-std::array<float,2>{0.402356386f, 0.349903673f},
-std::array<float,2>{0.517968535f, 0.806790888f},
-std::array<float,2>{0.309352934f, 0.9423756f},
-std::array<float,2>{0.656843364f, 0.440248281f},
-std::array<float,2>{0.114258952f, 0.124183245f},
-std::array<float,2>{0.883434713f, 0.629259288f},
-std::array<float,2>{0.455123872f, 0.695684254f},
-std::array<float,2>{0.592013001f, 0.0156323407f},
-std::array<float,2>{0.248285264f, 0.388697177f},
-std::array<float,2>{0.868214905f, 0.910402238f},
-std::array<float,2>{0.0597675368f, 0.842521012f},
-std::array<float,2>{0.97115916f, 0.25206694f},
-std::array<float,2>{0.317627221f, 0.246527985f},
-std::array<float,2>{0.741044283f, 0.580555856f},
-std::array<float,2>{0.0737500787f, 0.661114991f},
-std::array<float,2>{0.928303957f, 0.07940007f},
-std::array<float,2>{0.267475486f, 0.49208805f},
-std::array<float,2>{0.637760401f, 0.993737519f},
-std::array<float,2>{0.428349882f, 0.771730423f},
-std::array<float,2>{0.549227417f, 0.313454241f},
-std::array<float,2>{0.168507636f, 0.128150776f},
-std::array<float,2>{0.782626629f, 0.527386904f},
-std::array<float,2>{0.35647428f, 0.599932134f},
-std::array<float,2>{0.708780646f, 0.207919762f},
-std::array<float,2>{0.0274635609f, 0.295646489f},
-std::array<float,2>{0.949477077f, 0.863117576f},
-std::array<float,2>{0.212133422f, 0.897131383f},
-std::array<float,2>{0.836192608f, 0.413157314f},
-std::array<float,2>{0.494424105f, 0.0390979946f},
-std::array<float,2>{0.621096432f, 0.733702838f},
-std::array<float,2>{0.157647789f, 0.638123572f},
-std::array<float,2>{0.789770484f, 0.110026278f},
-std::array<float,2>{0.434452921f, 0.451631695f},
-std::array<float,2>{0.559116066f, 0.950282812f},
-std::array<float,2>{0.276897252f, 0.797812819f},
-std::array<float,2>{0.629728734f, 0.351734161f},
-std::array<float,2>{0.064970836f, 0.184015065f},
-std::array<float,2>{0.935598731f, 0.536674321f},
-std::array<float,2>{0.48954311f, 0.587449431f},
-std::array<float,2>{0.615135849f, 0.238363817f},
-std::array<float,2>{0.209858432f, 0.263666093f},
-std::array<float,2>{0.833334923f, 0.82918191f},
-std::array<float,2>{0.0194514133f, 0.916031361f},
-std::array<float,2>{0.943136811f, 0.377916604f},
-std::array<float,2>{0.350117207f, 0.0282606855f},
-std::array<float,2>{0.716217399f, 0.688267589f},
-std::array<float,2>{0.122304685f, 0.516880333f},
-std::array<float,2>{0.882569134f, 0.139322475f},
-std::array<float,2>{0.300603092f, 0.32560432f},
-std::array<float,2>{0.671423495f, 0.777791739f},
-std::array<float,2>{0.395665467f, 0.986672759f},
-std::array<float,2>{0.528044462f, 0.497229397f},
-std::array<float,2>{0.128250226f, 0.0894017741f},
-std::array<float,2>{0.771379232f, 0.664952934f},
-std::array<float,2>{0.323513091f, 0.721478403f},
-std::array<float,2>{0.746096432f, 0.0323248692f},
-std::array<float,2>{0.047701437f, 0.420093894f},
-std::array<float,2>{0.980716527f, 0.903807938f},
-std::array<float,2>{0.235309169f, 0.868791699f},
-std::array<float,2>{0.866931379f, 0.288088232f},
-std::array<float,2>{0.466082662f, 0.210967496f},
-std::array<float,2>{0.579776704f, 0.601696968f},
-std::array<float,2>{0.196478918f, 0.617753744f},
-std::array<float,2>{0.82544589f, 0.195946664f},
-std::array<float,2>{0.481279552f, 0.300817043f},
-std::array<float,2>{0.597401917f, 0.852933884f},
-std::array<float,2>{0.372282356f, 0.888883412f},
-std::array<float,2>{0.697285533f, 0.429452091f},
-std::array<float,2>{0.00737501308f, 0.0614345856f},
-std::array<float,2>{0.967290461f, 0.735339403f},
-std::array<float,2>{0.409357756f, 0.679295182f},
-std::array<float,2>{0.541719973f, 0.076926142f},
-std::array<float,2>{0.177433655f, 0.477651179f},
-std::array<float,2>{0.798039675f, 0.977722585f},
-std::array<float,2>{0.080179736f, 0.762549579f},
-std::array<float,2>{0.920321465f, 0.334623188f},
-std::array<float,2>{0.264197171f, 0.14908123f},
-std::array<float,2>{0.650007129f, 0.507544518f},
-std::array<float,2>{0.0378298536f, 0.712402403f},
-std::array<float,2>{0.987210572f, 0.0135621615f},
-std::array<float,2>{0.338106275f, 0.396079868f},
-std::array<float,2>{0.720916331f, 0.928379893f},
-std::array<float,2>{0.438823372f, 0.825637102f},
-std::array<float,2>{0.577554882f, 0.272926152f},
-std::array<float,2>{0.227008253f, 0.220796689f},
-std::array<float,2>{0.858792782f, 0.566983283f},
-std::array<float,2>{0.293070942f, 0.560487032f},
-std::array<float,2>{0.684070051f, 0.160846114f},
-std::array<float,2>{0.103616238f, 0.368029952f},
-std::array<float,2>{0.900938213f, 0.792512476f},
-std::array<float,2>{0.144193009f, 0.953762889f},
-std::array<float,2>{0.75707984f, 0.458750039f},
-std::array<float,2>{0.388078332f, 0.105971821f},
-std::array<float,2>{0.507851124f, 0.653847098f},
-std::array<float,2>{0.244169623f, 0.674148977f},
-std::array<float,2>{0.874143124f, 0.0721836239f},
-std::array<float,2>{0.459163815f, 0.483133644f},
-std::array<float,2>{0.589020014f, 0.981574714f},
-std::array<float,2>{0.314510554f, 0.759324908f},
-std::array<float,2>{0.735196531f, 0.329015881f},
-std::array<float,2>{0.0557687171f, 0.154665217f},
-std::array<float,2>{0.974282086f, 0.501855373f},
-std::array<float,2>{0.402272791f, 0.621474028f},
-std::array<float,2>{0.523030043f, 0.200318396f},
-std::array<float,2>{0.139324665f, 0.299482912f},
-std::array<float,2>{0.777185023f, 0.856506884f},
-std::array<float,2>{0.110926531f, 0.883869827f},
-std::array<float,2>{0.887582839f, 0.425269008f},
-std::array<float,2>{0.306373477f, 0.0574231222f},
-std::array<float,2>{0.663835227f, 0.739551008f},
-std::array<float,2>{0.0240878779f, 0.55851531f},
-std::array<float,2>{0.946492851f, 0.158255905f},
-std::array<float,2>{0.351853937f, 0.372422725f},
-std::array<float,2>{0.705330193f, 0.796120942f},
-std::array<float,2>{0.498194247f, 0.958951831f},
-std::array<float,2>{0.619278073f, 0.456556499f},
-std::array<float,2>{0.218406722f, 0.102032125f},
-std::array<float,2>{0.843500376f, 0.651274145f},
-std::array<float,2>{0.270778716f, 0.717256486f},
-std::array<float,2>{0.632990122f, 0.00799719337f},
-std::array<float,2>{0.075909324f, 0.393321306f},
-std::array<float,2>{0.923725247f, 0.924610972f},
-std::array<float,2>{0.167480722f, 0.822300196f},
-std::array<float,2>{0.788548291f, 0.268236548f},
-std::array<float,2>{0.425627828f, 0.225939199f},
-std::array<float,2>{0.550823748f, 0.563637614f},
-std::array<float,2>{0.152121559f, 0.592853189f},
-std::array<float,2>{0.762419641f, 0.236248568f},
-std::array<float,2>{0.381561846f, 0.258873135f},
-std::array<float,2>{0.506609201f, 0.835087299f},
-std::array<float,2>{0.286106139f, 0.92115736f},
-std::array<float,2>{0.676978946f, 0.382786572f},
-std::array<float,2>{0.0988913029f, 0.0269796979f},
-std::array<float,2>{0.893792212f, 0.695077658f},
-std::array<float,2>{0.446204752f, 0.635017395f},
-std::array<float,2>{0.569452763f, 0.113532491f},
-std::array<float,2>{0.224155158f, 0.446668059f},
-std::array<float,2>{0.850753605f, 0.946808457f},
-std::array<float,2>{0.0394926742f, 0.800795376f},
-std::array<float,2>{0.996515691f, 0.357217252f},
-std::array<float,2>{0.333984554f, 0.181456119f},
-std::array<float,2>{0.729050875f, 0.533726335f},
-std::array<float,2>{0.0902956277f, 0.722952724f},
-std::array<float,2>{0.906563401f, 0.0384204909f},
-std::array<float,2>{0.25165534f, 0.415661067f},
-std::array<float,2>{0.647026479f, 0.902049243f},
-std::array<float,2>{0.417661875f, 0.871793687f},
-std::array<float,2>{0.535627902f, 0.282894999f},
-std::array<float,2>{0.185618699f, 0.215753332f},
-std::array<float,2>{0.809446096f, 0.607260585f},
-std::array<float,2>{0.364505917f, 0.522718191f},
-std::array<float,2>{0.691500485f, 0.135080442f},
-std::array<float,2>{0.0104371766f, 0.320336074f},
-std::array<float,2>{0.955555141f, 0.775316298f},
-std::array<float,2>{0.194007635f, 0.991384983f},
-std::array<float,2>{0.813136101f, 0.49279961f},
-std::array<float,2>{0.470195919f, 0.0900987536f},
-std::array<float,2>{0.603290021f, 0.668882489f},
-std::array<float,2>{0.172603995f, 0.700541854f},
-std::array<float,2>{0.800967932f, 0.0212506298f},
-std::array<float,2>{0.413607806f, 0.385223001f},
-std::array<float,2>{0.546235979f, 0.907306314f},
-std::array<float,2>{0.260973006f, 0.83791995f},
-std::array<float,2>{0.652732193f, 0.255316615f},
-std::array<float,2>{0.0849084482f, 0.243840754f},
-std::array<float,2>{0.914172828f, 0.585706294f},
-std::array<float,2>{0.47989133f, 0.539851487f},
-std::array<float,2>{0.598025143f, 0.175193429f},
-std::array<float,2>{0.20282723f, 0.343791783f},
-std::array<float,2>{0.822457016f, 0.80930382f},
-std::array<float,2>{0.00211399817f, 0.940883636f},
-std::array<float,2>{0.962372899f, 0.44437784f},
-std::array<float,2>{0.370991379f, 0.120821305f},
-std::array<float,2>{0.700630009f, 0.625680327f},
-std::array<float,2>{0.108414114f, 0.595578492f},
-std::array<float,2>{0.903234959f, 0.206858054f},
-std::array<float,2>{0.292380542f, 0.290350318f},
-std::array<float,2>{0.682073116f, 0.866843224f},
-std::array<float,2>{0.383405387f, 0.893256903f},
-std::array<float,2>{0.514482141f, 0.407838583f},
-std::array<float,2>{0.146922991f, 0.0449635684f},
-std::array<float,2>{0.752157152f, 0.728881598f},
-std::array<float,2>{0.343250096f, 0.658880472f},
-std::array<float,2>{0.724209189f, 0.0834956095f},
-std::array<float,2>{0.0324927978f, 0.48548612f},
-std::array<float,2>{0.989218116f, 0.996726751f},
-std::array<float,2>{0.231621161f, 0.766780376f},
-std::array<float,2>{0.851685047f, 0.317238182f},
-std::array<float,2>{0.444736928f, 0.12916787f},
-std::array<float,2>{0.571393013f, 0.526521564f},
-std::array<float,2>{0.205632642f, 0.514625132f},
-std::array<float,2>{0.831486583f, 0.146803811f},
-std::array<float,2>{0.485345602f, 0.341894925f},
-std::array<float,2>{0.612976909f, 0.757089794f},
-std::array<float,2>{0.34605661f, 0.97431308f},
-std::array<float,2>{0.71368432f, 0.475101292f},
-std::array<float,2>{0.0218605101f, 0.0628543049f},
-std::array<float,2>{0.938106596f, 0.687277973f},
-std::array<float,2>{0.431921482f, 0.743027031f},
-std::array<float,2>{0.556799889f, 0.0485392734f},
-std::array<float,2>{0.161953405f, 0.433317155f},
-std::array<float,2>{0.794734895f, 0.881216884f},
-std::array<float,2>{0.0664210245f, 0.85070622f},
-std::array<float,2>{0.931632161f, 0.3066414f},
-std::array<float,2>{0.280445188f, 0.193392649f},
-std::array<float,2>{0.627351582f, 0.614557087f},
-std::array<float,2>{0.0529693924f, 0.647897661f},
-std::array<float,2>{0.978848875f, 0.0953295603f},
-std::array<float,2>{0.324428171f, 0.464132249f},
-std::array<float,2>{0.742969275f, 0.961304843f},
-std::array<float,2>{0.463057399f, 0.788760364f},
-std::array<float,2>{0.5834409f, 0.361506432f},
-std::array<float,2>{0.240511611f, 0.168846101f},
-std::array<float,2>{0.863280773f, 0.54995954f},
-std::array<float,2>{0.302101582f, 0.577664495f},
-std::array<float,2>{0.664291978f, 0.230705962f},
-std::array<float,2>{0.117747471f, 0.277188718f},
-std::array<float,2>{0.87541157f, 0.817461491f},
-std::array<float,2>{0.130115718f, 0.932248414f},
-std::array<float,2>{0.769360006f, 0.406047881f},
-std::array<float,2>{0.392804593f, 0.00235343073f},
-std::array<float,2>{0.523500144f, 0.709844708f},
-std::array<float,2>{0.198128968f, 0.734640181f},
-std::array<float,2>{0.826605737f, 0.0609850734f},
-std::array<float,2>{0.482513368f, 0.428990483f},
-std::array<float,2>{0.593868792f, 0.889504194f},
-std::array<float,2>{0.373867184f, 0.853261769f},
-std::array<float,2>{0.696606219f, 0.301538408f},
-std::array<float,2>{0.00404725503f, 0.195397288f},
-std::array<float,2>{0.966290236f, 0.617540419f},
-std::array<float,2>{0.407120764f, 0.507073462f},
-std::array<float,2>{0.540489972f, 0.148695394f},
-std::array<float,2>{0.178553f, 0.334271729f},
-std::array<float,2>{0.800369263f, 0.762061119f},
-std::array<float,2>{0.0786294639f, 0.978272855f},
-std::array<float,2>{0.918022454f, 0.4782736f},
-std::array<float,2>{0.262628496f, 0.0764896199f},
-std::array<float,2>{0.650954366f, 0.679039299f},
-std::array<float,2>{0.0356270038f, 0.566515923f},
-std::array<float,2>{0.985073149f, 0.221479043f},
-std::array<float,2>{0.337666035f, 0.273315489f},
-std::array<float,2>{0.720531046f, 0.825933933f},
-std::array<float,2>{0.439651579f, 0.928134263f},
-std::array<float,2>{0.574306548f, 0.395540208f},
-std::array<float,2>{0.228925556f, 0.0127571635f},
-std::array<float,2>{0.856201768f, 0.712109387f},
-std::array<float,2>{0.296524733f, 0.653414547f},
-std::array<float,2>{0.686952174f, 0.105739534f},
-std::array<float,2>{0.102520354f, 0.458162278f},
-std::array<float,2>{0.900083899f, 0.953299284f},
-std::array<float,2>{0.141102046f, 0.792296886f},
-std::array<float,2>{0.754315972f, 0.367311776f},
-std::array<float,2>{0.389899343f, 0.160312355f},
-std::array<float,2>{0.511176169f, 0.559841633f},
-std::array<float,2>{0.159533083f, 0.536162853f},
-std::array<float,2>{0.791710734f, 0.184297279f},
-std::array<float,2>{0.437011153f, 0.352434725f},
-std::array<float,2>{0.561237574f, 0.797339678f},
-std::array<float,2>{0.275150031f, 0.951085329f},
-std::array<float,2>{0.631610513f, 0.452032417f},
-std::array<float,2>{0.0625110194f, 0.109401248f},
-std::array<float,2>{0.933890879f, 0.638660908f},
-std::array<float,2>{0.491655558f, 0.68756175f},
-std::array<float,2>{0.616239548f, 0.027737461f},
-std::array<float,2>{0.208183885f, 0.377431184f},
-std::array<float,2>{0.83533597f, 0.91656965f},
-std::array<float,2>{0.0160128269f, 0.829900026f},
-std::array<float,2>{0.944518983f, 0.263057888f},
-std::array<float,2>{0.348250091f, 0.238886327f},
-std::array<float,2>{0.716871858f, 0.587113082f},
-std::array<float,2>{0.124575533f, 0.664325774f},
-std::array<float,2>{0.880715072f, 0.0893010944f},
-std::array<float,2>{0.298400462f, 0.49773261f},
-std::array<float,2>{0.669836283f, 0.987235487f},
-std::array<float,2>{0.396997303f, 0.778313875f},
-std::array<float,2>{0.530095398f, 0.325815737f},
-std::array<float,2>{0.12626195f, 0.138889596f},
-std::array<float,2>{0.771679997f, 0.517116427f},
-std::array<float,2>{0.320453405f, 0.602186382f},
-std::array<float,2>{0.74830389f, 0.211815193f},
-std::array<float,2>{0.0500895493f, 0.289028287f},
-std::array<float,2>{0.983527958f, 0.868541002f},
-std::array<float,2>{0.237636879f, 0.904165506f},
-std::array<float,2>{0.863307118f, 0.420750916f},
-std::array<float,2>{0.468397051f, 0.033060763f},
-std::array<float,2>{0.581208289f, 0.721116602f},
-std::array<float,2>{0.133138448f, 0.629470706f},
-std::array<float,2>{0.780622363f, 0.124674566f},
-std::array<float,2>{0.405217618f, 0.439743727f},
-std::array<float,2>{0.515702724f, 0.941570818f},
-std::array<float,2>{0.31233874f, 0.807195008f},
-std::array<float,2>{0.659646451f, 0.350345701f},
-std::array<float,2>{0.116455972f, 0.176655635f},
-std::array<float,2>{0.885815263f, 0.545166969f},
-std::array<float,2>{0.454293162f, 0.580952704f},
-std::array<float,2>{0.590987265f, 0.246972546f},
-std::array<float,2>{0.247463182f, 0.252702504f},
-std::array<float,2>{0.869594753f, 0.842001379f},
-std::array<float,2>{0.0624938384f, 0.910845578f},
-std::array<float,2>{0.969068527f, 0.38949585f},
-std::array<float,2>{0.320294529f, 0.0163471177f},
-std::array<float,2>{0.738696456f, 0.696288288f},
-std::array<float,2>{0.071718201f, 0.528112411f},
-std::array<float,2>{0.927697778f, 0.128445223f},
-std::array<float,2>{0.268549293f, 0.31298694f},
-std::array<float,2>{0.639647484f, 0.7723369f},
-std::array<float,2>{0.426886886f, 0.993629336f},
-std::array<float,2>{0.547341228f, 0.491597265f},
-std::array<float,2>{0.171322271f, 0.0798457712f},
-std::array<float,2>{0.783546865f, 0.660561085f},
-std::array<float,2>{0.357447833f, 0.734130025f},
-std::array<float,2>{0.709982634f, 0.0396672934f},
-std::array<float,2>{0.0310015567f, 0.413798988f},
-std::array<float,2>{0.95131743f, 0.896554351f},
-std::array<float,2>{0.213289708f, 0.862434745f},
-std::array<float,2>{0.838255763f, 0.295184702f},
-std::array<float,2>{0.49403286f, 0.20709157f},
-std::array<float,2>{0.624674201f, 0.600488663f},
-std::array<float,2>{0.220846847f, 0.612158477f},
-std::array<float,2>{0.846310616f, 0.188515812f},
-std::array<float,2>{0.452201903f, 0.310417235f},
-std::array<float,2>{0.565009475f, 0.845679581f},
-std::array<float,2>{0.331469208f, 0.87553817f},
-std::array<float,2>{0.73175472f, 0.437223196f},
-std::array<float,2>{0.0444820449f, 0.0539811924f},
-std::array<float,2>{0.995025158f, 0.746246517f},
-std::array<float,2>{0.378242135f, 0.679868937f},
-std::array<float,2>{0.502720535f, 0.0674289465f},
-std::array<float,2>{0.154826015f, 0.472449958f},
-std::array<float,2>{0.759016454f, 0.971104503f},
-std::array<float,2>{0.0947040766f, 0.753806591f},
-std::array<float,2>{0.898208022f, 0.336333156f},
-std::array<float,2>{0.283017039f, 0.1421718f},
-std::array<float,2>{0.674640715f, 0.511238158f},
-std::array<float,2>{0.0144940987f, 0.703463972f},
-std::array<float,2>{0.958420634f, 0.00712902565f},
-std::array<float,2>{0.359663457f, 0.401382804f},
-std::array<float,2>{0.69029212f, 0.937111914f},
-std::array<float,2>{0.475099623f, 0.8132056f},
-std::array<float,2>{0.607429683f, 0.280634046f},
-std::array<float,2>{0.187797964f, 0.226655111f},
-std::array<float,2>{0.820217073f, 0.573094428f},
-std::array<float,2>{0.254437506f, 0.553372264f},
-std::array<float,2>{0.642041147f, 0.164622888f},
-std::array<float,2>{0.0887321234f, 0.366615891f},
-std::array<float,2>{0.913539052f, 0.782348514f},
-std::array<float,2>{0.182821721f, 0.965886414f},
-std::array<float,2>{0.806478858f, 0.465939045f},
-std::array<float,2>{0.418846816f, 0.100056179f},
-std::array<float,2>{0.534058034f, 0.64416343f},
-std::array<float,2>{0.215868533f, 0.648809969f},
-std::array<float,2>{0.841163397f, 0.105363019f},
-std::array<float,2>{0.497308671f, 0.454336435f},
-std::array<float,2>{0.618646801f, 0.96092236f},
-std::array<float,2>{0.355065912f, 0.794094622f},
-std::array<float,2>{0.704304755f, 0.373072803f},
-std::array<float,2>{0.0263150334f, 0.157485098f},
-std::array<float,2>{0.948473155f, 0.556410313f},
-std::array<float,2>{0.422713876f, 0.565052867f},
-std::array<float,2>{0.554559588f, 0.223560035f},
-std::array<float,2>{0.165985912f, 0.267275572f},
-std::array<float,2>{0.785613775f, 0.821911037f},
-std::array<float,2>{0.0777163059f, 0.92299664f},
-std::array<float,2>{0.92430681f, 0.391464531f},
-std::array<float,2>{0.273396611f, 0.0104387915f},
-std::array<float,2>{0.635959506f, 0.716136813f},
-std::array<float,2>{0.0583971292f, 0.503606021f},
-std::array<float,2>{0.975280285f, 0.154234305f},
-std::array<float,2>{0.313859344f, 0.331985772f},
-std::array<float,2>{0.737509668f, 0.760801792f},
-std::array<float,2>{0.458780318f, 0.982585609f},
-std::array<float,2>{0.587444067f, 0.481021672f},
-std::array<float,2>{0.242570892f, 0.0731007308f},
-std::array<float,2>{0.872127414f, 0.673462808f},
-std::array<float,2>{0.308142155f, 0.741017401f},
-std::array<float,2>{0.661735952f, 0.0552508421f},
-std::array<float,2>{0.111498266f, 0.423029363f},
-std::array<float,2>{0.888784349f, 0.88481611f},
-std::array<float,2>{0.137114853f, 0.858298719f},
-std::array<float,2>{0.775347173f, 0.297504812f},
-std::array<float,2>{0.399113983f, 0.201807424f},
-std::array<float,2>{0.519916415f, 0.62458533f},
-std::array<float,2>{0.18445462f, 0.608403385f},
-std::array<float,2>{0.811420202f, 0.217636704f},
-std::array<float,2>{0.414296985f, 0.284250498f},
-std::array<float,2>{0.539042473f, 0.873346031f},
-std::array<float,2>{0.252273172f, 0.900079191f},
-std::array<float,2>{0.645150065f, 0.416416496f},
-std::array<float,2>{0.0936609879f, 0.0361746997f},
-std::array<float,2>{0.909810305f, 0.724984348f},
-std::array<float,2>{0.47262606f, 0.670307338f},
-std::array<float,2>{0.605367005f, 0.0921314359f},
-std::array<float,2>{0.192300841f, 0.495303839f},
-std::array<float,2>{0.816218913f, 0.988631964f},
-std::array<float,2>{0.00827107951f, 0.775695145f},
-std::array<float,2>{0.954641223f, 0.322752655f},
-std::array<float,2>{0.366799653f, 0.133344039f},
-std::array<float,2>{0.693908513f, 0.520715833f},
-std::array<float,2>{0.101136543f, 0.69187218f},
-std::array<float,2>{0.890897632f, 0.0252870396f},
-std::array<float,2>{0.28884995f, 0.379295409f},
-std::array<float,2>{0.678588629f, 0.91863519f},
-std::array<float,2>{0.379816502f, 0.833035231f},
-std::array<float,2>{0.504088044f, 0.261713207f},
-std::array<float,2>{0.150348201f, 0.237558961f},
-std::array<float,2>{0.764708102f, 0.590346217f},
-std::array<float,2>{0.333033979f, 0.531354606f},
-std::array<float,2>{0.726765633f, 0.183010861f},
-std::array<float,2>{0.0425878577f, 0.35825038f},
-std::array<float,2>{0.999456644f, 0.803014874f},
-std::array<float,2>{0.226094693f, 0.948056936f},
-std::array<float,2>{0.849381745f, 0.447638273f},
-std::array<float,2>{0.448585898f, 0.115869984f},
-std::array<float,2>{0.567331195f, 0.634574056f},
-std::array<float,2>{0.145615116f, 0.727702856f},
-std::array<float,2>{0.750109017f, 0.0443437323f},
-std::array<float,2>{0.384806156f, 0.408608317f},
-std::array<float,2>{0.513060927f, 0.891134918f},
-std::array<float,2>{0.289111823f, 0.863511801f},
-std::array<float,2>{0.681448638f, 0.2910254f},
-std::array<float,2>{0.105765142f, 0.203795075f},
-std::array<float,2>{0.90611887f, 0.597251058f},
-std::array<float,2>{0.442028433f, 0.523955464f},
-std::array<float,2>{0.573663652f, 0.131261006f},
-std::array<float,2>{0.233446658f, 0.319825321f},
-std::array<float,2>{0.853530705f, 0.767681599f},
-std::array<float,2>{0.0344630256f, 0.999898672f},
-std::array<float,2>{0.991414964f, 0.487856239f},
-std::array<float,2>{0.341711432f, 0.0845584273f},
-std::array<float,2>{0.726220429f, 0.657339573f},
-std::array<float,2>{0.0827964991f, 0.582647622f},
-std::array<float,2>{0.917657435f, 0.244193509f},
-std::array<float,2>{0.258242041f, 0.256586552f},
-std::array<float,2>{0.655461431f, 0.836393297f},
-std::array<float,2>{0.411765367f, 0.908244312f},
-std::array<float,2>{0.544382691f, 0.384667218f},
-std::array<float,2>{0.174219996f, 0.0225685369f},
-std::array<float,2>{0.803797305f, 0.701204896f},
-std::array<float,2>{0.368943095f, 0.628608465f},
-std::array<float,2>{0.703107119f, 0.117940888f},
-std::array<float,2>{0.000745805213f, 0.442662716f},
-std::array<float,2>{0.964204848f, 0.938001394f},
-std::array<float,2>{0.199511111f, 0.811472952f},
-std::array<float,2>{0.821379542f, 0.347173959f},
-std::array<float,2>{0.477514654f, 0.171947926f},
-std::array<float,2>{0.600913942f, 0.541845441f},
-std::array<float,2>{0.238737717f, 0.547459364f},
-std::array<float,2>{0.860125899f, 0.171666935f},
-std::array<float,2>{0.462887883f, 0.36090368f},
-std::array<float,2>{0.585762262f, 0.785316586f},
-std::array<float,2>{0.326622069f, 0.964042306f},
-std::array<float,2>{0.745719075f, 0.462790817f},
-std::array<float,2>{0.0518731289f, 0.0972013548f},
-std::array<float,2>{0.978366196f, 0.64638108f},
-std::array<float,2>{0.390923768f, 0.708397388f},
-std::array<float,2>{0.526431501f, 0.00173700752f},
-std::array<float,2>{0.131935954f, 0.402497143f},
-std::array<float,2>{0.766212344f, 0.930397987f},
-std::array<float,2>{0.120739393f, 0.820252299f},
-std::array<float,2>{0.878544033f, 0.275100231f},
-std::array<float,2>{0.302734464f, 0.233767599f},
-std::array<float,2>{0.666933775f, 0.574379563f},
-std::array<float,2>{0.0207775012f, 0.68508029f},
-std::array<float,2>{0.940232337f, 0.0650445074f},
-std::array<float,2>{0.345090866f, 0.472905248f},
-std::array<float,2>{0.711906075f, 0.975134492f},
-std::array<float,2>{0.487619907f, 0.754718244f},
-std::array<float,2>{0.610415936f, 0.34016335f},
-std::array<float,2>{0.20337148f, 0.145941257f},
-std::array<float,2>{0.829763174f, 0.513537824f},
-std::array<float,2>{0.279293507f, 0.616633952f},
-std::array<float,2>{0.625348926f, 0.192094266f},
-std::array<float,2>{0.0699350163f, 0.305783093f},
-std::array<float,2>{0.931899667f, 0.849239528f},
-std::array<float,2>{0.16273123f, 0.880705237f},
-std::array<float,2>{0.796043515f, 0.430655032f},
-std::array<float,2>{0.429967761f, 0.0491648465f},
-std::array<float,2>{0.55498749f, 0.744890094f},
-std::array<float,2>{0.227491379f, 0.713274539f},
-std::array<float,2>{0.859339952f, 0.0151222628f},
-std::array<float,2>{0.439201802f, 0.396921813f},
-std::array<float,2>{0.577874005f, 0.925979495f},
-std::array<float,2>{0.338539988f, 0.82690239f},
-std::array<float,2>{0.721395731f, 0.270227432f},
-std::array<float,2>{0.0372459516f, 0.219002053f},
-std::array<float,2>{0.986465931f, 0.570245922f},
-std::array<float,2>{0.388613224f, 0.561329961f},
-std::array<float,2>{0.508385479f, 0.163847029f},
-std::array<float,2>{0.143703952f, 0.370678008f},
-std::array<float,2>{0.757650137f, 0.790061951f},
-std::array<float,2>{0.104412936f, 0.955882668f},
-std::array<float,2>{0.900839627f, 0.459076375f},
-std::array<float,2>{0.293460071f, 0.108185463f},
-std::array<float,2>{0.684280753f, 0.655465424f},
-std::array<float,2>{0.0072444058f, 0.619421363f},
-std::array<float,2>{0.96721226f, 0.198130205f},
-std::array<float,2>{0.372601748f, 0.303937346f},
-std::array<float,2>{0.698146522f, 0.854656518f},
-std::array<float,2>{0.480944365f, 0.887678742f},
-std::array<float,2>{0.597164333f, 0.426576525f},
-std::array<float,2>{0.197004765f, 0.0601414256f},
-std::array<float,2>{0.826160908f, 0.737918317f},
-std::array<float,2>{0.263908803f, 0.677722156f},
-std::array<float,2>{0.649675071f, 0.0754219666f},
-std::array<float,2>{0.0808629543f, 0.480144858f},
-std::array<float,2>{0.920845389f, 0.978876233f},
-std::array<float,2>{0.177235007f, 0.764558792f},
-std::array<float,2>{0.798723519f, 0.332563341f},
-std::array<float,2>{0.409950763f, 0.151862428f},
-std::array<float,2>{0.541189492f, 0.504812658f},
-std::array<float,2>{0.128570005f, 0.51852411f},
-std::array<float,2>{0.770567477f, 0.137216523f},
-std::array<float,2>{0.396276921f, 0.327320427f},
-std::array<float,2>{0.527432859f, 0.77971679f},
-std::array<float,2>{0.300052077f, 0.986113906f},
-std::array<float,2>{0.671102166f, 0.499017298f},
-std::array<float,2>{0.122579031f, 0.0870406553f},
-std::array<float,2>{0.881994069f, 0.667132616f},
-std::array<float,2>{0.466642648f, 0.719045818f},
-std::array<float,2>{0.579390764f, 0.0340800211f},
-std::array<float,2>{0.234749064f, 0.418987393f},
-std::array<float,2>{0.866678119f, 0.904423356f},
-std::array<float,2>{0.0470627956f, 0.871033311f},
-std::array<float,2>{0.981441915f, 0.286505342f},
-std::array<float,2>{0.324055523f, 0.2131567f},
-std::array<float,2>{0.746737778f, 0.605448306f},
-std::array<float,2>{0.064926967f, 0.639168739f},
-std::array<float,2>{0.936202645f, 0.112383112f},
-std::array<float,2>{0.276854903f, 0.449724138f},
-std::array<float,2>{0.629276514f, 0.953006446f},
-std::array<float,2>{0.43362537f, 0.799144566f},
-std::array<float,2>{0.559045672f, 0.353635281f},
-std::array<float,2>{0.158179417f, 0.18711251f},
-std::array<float,2>{0.789373755f, 0.537370145f},
-std::array<float,2>{0.349986315f, 0.588675022f},
-std::array<float,2>{0.716515601f, 0.242081642f},
-std::array<float,2>{0.0189729445f, 0.264227927f},
-std::array<float,2>{0.942417324f, 0.831810057f},
-std::array<float,2>{0.209463209f, 0.91530484f},
-std::array<float,2>{0.833675265f, 0.375943631f},
-std::array<float,2>{0.489991605f, 0.0307930224f},
-std::array<float,2>{0.614588201f, 0.691138864f},
-std::array<float,2>{0.168078542f, 0.663712263f},
-std::array<float,2>{0.783202589f, 0.0812759474f},
-std::array<float,2>{0.427810013f, 0.489962727f},
-std::array<float,2>{0.549467683f, 0.995612502f},
-std::array<float,2>{0.266768456f, 0.770061433f},
-std::array<float,2>{0.638195932f, 0.31504333f},
-std::array<float,2>{0.0735931918f, 0.125269592f},
-std::array<float,2>{0.92803216f, 0.529548883f},
-std::array<float,2>{0.494986624f, 0.597944319f},
-std::array<float,2>{0.621730745f, 0.210078254f},
-std::array<float,2>{0.212596029f, 0.294871718f},
-std::array<float,2>{0.836811781f, 0.859838188f},
-std::array<float,2>{0.0280035771f, 0.895703495f},
-std::array<float,2>{0.950055242f, 0.411391079f},
-std::array<float,2>{0.357390761f, 0.0413907617f},
-std::array<float,2>{0.708313644f, 0.731725574f},
-std::array<float,2>{0.114889726f, 0.544498205f},
-std::array<float,2>{0.88320303f, 0.179326892f},
-std::array<float,2>{0.308973283f, 0.349159509f},
-std::array<float,2>{0.656316757f, 0.805792451f},
-std::array<float,2>{0.403149605f, 0.944981396f},
-std::array<float,2>{0.518490732f, 0.43861571f},
-std::array<float,2>{0.135116026f, 0.122810721f},
-std::array<float,2>{0.777672589f, 0.631246567f},
-std::array<float,2>{0.318057179f, 0.698681712f},
-std::array<float,2>{0.740504205f, 0.0189683605f},
-std::array<float,2>{0.0602390282f, 0.388455808f},
-std::array<float,2>{0.97137779f, 0.913819909f},
-std::array<float,2>{0.248682022f, 0.841076732f},
-std::array<float,2>{0.868839443f, 0.25044331f},
-std::array<float,2>{0.456019998f, 0.248898044f},
-std::array<float,2>{0.592648745f, 0.579748333f},
-std::array<float,2>{0.190336987f, 0.570714056f},
-std::array<float,2>{0.817218482f, 0.228815973f},
-std::array<float,2>{0.473017067f, 0.277550429f},
-std::array<float,2>{0.607340276f, 0.815720856f},
-std::array<float,2>{0.362383574f, 0.933677971f},
-std::array<float,2>{0.689326584f, 0.399244428f},
-std::array<float,2>{0.0123510612f, 0.00517938053f},
-std::array<float,2>{0.959269166f, 0.705643892f},
-std::array<float,2>{0.421203583f, 0.642266512f},
-std::array<float,2>{0.53251487f, 0.0994080231f},
-std::array<float,2>{0.180142656f, 0.468526989f},
-std::array<float,2>{0.808281422f, 0.968341768f},
-std::array<float,2>{0.0860186666f, 0.78496474f},
-std::array<float,2>{0.911583602f, 0.364123136f},
-std::array<float,2>{0.25755173f, 0.167866737f},
-std::array<float,2>{0.643820405f, 0.55250442f},
-std::array<float,2>{0.0464637242f, 0.749537289f},
-std::array<float,2>{0.992966771f, 0.0510921516f},
-std::array<float,2>{0.32903412f, 0.434867889f},
-std::array<float,2>{0.732633889f, 0.878624439f},
-std::array<float,2>{0.450310498f, 0.846644819f},
-std::array<float,2>{0.564144075f, 0.310664922f},
-std::array<float,2>{0.220010951f, 0.191154689f},
-std::array<float,2>{0.844083965f, 0.611145198f},
-std::array<float,2>{0.284443319f, 0.508442104f},
-std::array<float,2>{0.67331177f, 0.143634766f},
-std::array<float,2>{0.0963803902f, 0.338352025f},
-std::array<float,2>{0.895705879f, 0.750067651f},
-std::array<float,2>{0.152554795f, 0.970667481f},
-std::array<float,2>{0.759949863f, 0.469752699f},
-std::array<float,2>{0.376033992f, 0.0693323612f},
-std::array<float,2>{0.501920104f, 0.68334043f},
-std::array<float,2>{0.223225579f, 0.633227527f},
-std::array<float,2>{0.849767208f, 0.116516575f},
-std::array<float,2>{0.446495086f, 0.448920518f},
-std::array<float,2>{0.568697751f, 0.948685944f},
-std::array<float,2>{0.334983081f, 0.804627657f},
-std::array<float,2>{0.729538202f, 0.358908385f},
-std::array<float,2>{0.0403627157f, 0.181725398f},
-std::array<float,2>{0.997316778f, 0.532900572f},
-std::array<float,2>{0.382106572f, 0.59084928f},
-std::array<float,2>{0.507093549f, 0.236948639f},
-std::array<float,2>{0.150821164f, 0.259951085f},
-std::array<float,2>{0.762922168f, 0.83300513f},
-std::array<float,2>{0.0977947041f, 0.919186771f},
-std::array<float,2>{0.892751455f, 0.380169332f},
-std::array<float,2>{0.286583543f, 0.0237460863f},
-std::array<float,2>{0.676206112f, 0.69311434f},
-std::array<float,2>{0.0112319812f, 0.520305693f},
-std::array<float,2>{0.956502914f, 0.134163275f},
-std::array<float,2>{0.363478929f, 0.323990762f},
-std::array<float,2>{0.692646921f, 0.77725476f},
-std::array<float,2>{0.469437599f, 0.990202427f},
-std::array<float,2>{0.601710677f, 0.49456206f},
-std::array<float,2>{0.194809526f, 0.0936943963f},
-std::array<float,2>{0.81391722f, 0.670943201f},
-std::array<float,2>{0.250936061f, 0.726506352f},
-std::array<float,2>{0.648121297f, 0.0353485532f},
-std::array<float,2>{0.0915373117f, 0.417537719f},
-std::array<float,2>{0.907464683f, 0.898895502f},
-std::array<float,2>{0.187043056f, 0.874879599f},
-std::array<float,2>{0.809594333f, 0.283536643f},
-std::array<float,2>{0.416287541f, 0.218705609f},
-std::array<float,2>{0.536905885f, 0.607597411f},
-std::array<float,2>{0.139723733f, 0.623937488f},
-std::array<float,2>{0.775944889f, 0.202628851f},
-std::array<float,2>{0.400785863f, 0.297915846f},
-std::array<float,2>{0.521607518f, 0.858943701f},
-std::array<float,2>{0.305264384f, 0.886264622f},
-std::array<float,2>{0.662402093f, 0.422567517f},
-std::array<float,2>{0.11009454f, 0.0563129932f},
-std::array<float,2>{0.888578236f, 0.741538286f},
-std::array<float,2>{0.460508317f, 0.672749639f},
-std::array<float,2>{0.588641882f, 0.0734393448f},
-std::array<float,2>{0.24571754f, 0.481506437f},
-std::array<float,2>{0.87364763f, 0.984321892f},
-std::array<float,2>{0.0548340119f, 0.760110438f},
-std::array<float,2>{0.972984195f, 0.330405802f},
-std::array<float,2>{0.316118896f, 0.152772382f},
-std::array<float,2>{0.736184657f, 0.502583742f},
-std::array<float,2>{0.075112544f, 0.715578616f},
-std::array<float,2>{0.922036946f, 0.0113011673f},
-std::array<float,2>{0.269696802f, 0.39198935f},
-std::array<float,2>{0.634191632f, 0.922647297f},
-std::array<float,2>{0.424651146f, 0.820869923f},
-std::array<float,2>{0.552664757f, 0.265693069f},
-std::array<float,2>{0.166410446f, 0.224514157f},
-std::array<float,2>{0.787849069f, 0.565922022f},
-std::array<float,2>{0.353192896f, 0.554780424f},
-std::array<float,2>{0.706339717f, 0.157099873f},
-std::array<float,2>{0.0244358517f, 0.374850005f},
-std::array<float,2>{0.946189165f, 0.793293118f},
-std::array<float,2>{0.217632562f, 0.959462106f},
-std::array<float,2>{0.842121184f, 0.453532279f},
-std::array<float,2>{0.499925315f, 0.104456976f},
-std::array<float,2>{0.620900273f, 0.650222957f},
-std::array<float,2>{0.160279259f, 0.745491326f},
-std::array<float,2>{0.792988598f, 0.0503824949f},
-std::array<float,2>{0.432626456f, 0.430791736f},
-std::array<float,2>{0.557990313f, 0.879041553f},
-std::array<float,2>{0.279728502f, 0.848167837f},
-std::array<float,2>{0.628417671f, 0.30533576f},
-std::array<float,2>{0.0677134618f, 0.192632139f},
-std::array<float,2>{0.930565f, 0.615648389f},
-std::array<float,2>{0.485690922f, 0.512348771f},
-std::array<float,2>{0.612240732f, 0.14527905f},
-std::array<float,2>{0.206195801f, 0.341280043f},
-std::array<float,2>{0.8310166f, 0.755601525f},
-std::array<float,2>{0.0225695297f, 0.975645006f},
-std::array<float,2>{0.939185798f, 0.474447817f},
-std::array<float,2>{0.346903622f, 0.0660716891f},
-std::array<float,2>{0.714073658f, 0.68401444f},
-std::array<float,2>{0.118460357f, 0.575504541f},
-std::array<float,2>{0.876656294f, 0.232737616f},
-std::array<float,2>{0.300862104f, 0.27393198f},
-std::array<float,2>{0.665073514f, 0.819216013f},
-std::array<float,2>{0.394380152f, 0.930868268f},
-std::array<float,2>{0.524431229f, 0.403536499f},
-std::array<float,2>{0.129248649f, 0.000321529078f},
-std::array<float,2>{0.768336177f, 0.707160652f},
-std::array<float,2>{0.325603396f, 0.644852996f},
-std::array<float,2>{0.743625522f, 0.0957506448f},
-std::array<float,2>{0.0543008819f, 0.461643815f},
-std::array<float,2>{0.979792774f, 0.963547766f},
-std::array<float,2>{0.241465434f, 0.786872745f},
-std::array<float,2>{0.861661673f, 0.359402448f},
-std::array<float,2>{0.464555889f, 0.170338094f},
-std::array<float,2>{0.582204461f, 0.548003137f},
-std::array<float,2>{0.201380253f, 0.542250991f},
-std::array<float,2>{0.82356739f, 0.173112988f},
-std::array<float,2>{0.479223251f, 0.346399695f},
-std::array<float,2>{0.598775446f, 0.811868727f},
-std::array<float,2>{0.370098472f, 0.939380288f},
-std::array<float,2>{0.699962139f, 0.441478342f},
-std::array<float,2>{0.0034546454f, 0.118962966f},
-std::array<float,2>{0.961737156f, 0.627715886f},
-std::array<float,2>{0.412584782f, 0.702964187f},
-std::array<float,2>{0.544984996f, 0.0224264171f},
-std::array<float,2>{0.173751786f, 0.383140087f},
-std::array<float,2>{0.80250597f, 0.910090744f},
-std::array<float,2>{0.0856403038f, 0.836964428f},
-std::array<float,2>{0.91584897f, 0.257499069f},
-std::array<float,2>{0.259967297f, 0.2452811f},
-std::array<float,2>{0.653923988f, 0.583120108f},
-std::array<float,2>{0.0312743299f, 0.656942487f},
-std::array<float,2>{0.990070999f, 0.0851335526f},
-std::array<float,2>{0.342280149f, 0.486634284f},
-std::array<float,2>{0.72354871f, 0.998446941f},
-std::array<float,2>{0.443728596f, 0.769488871f},
-std::array<float,2>{0.570590556f, 0.319040537f},
-std::array<float,2>{0.231192335f, 0.132209599f},
-std::array<float,2>{0.853407919f, 0.525130391f},
-std::array<float,2>{0.29130879f, 0.596665025f},
-std::array<float,2>{0.68358314f, 0.205070823f},
-std::array<float,2>{0.108268812f, 0.292678237f},
-std::array<float,2>{0.903668046f, 0.86433965f},
-std::array<float,2>{0.148240447f, 0.891821742f},
-std::array<float,2>{0.753648698f, 0.409916639f},
-std::array<float,2>{0.383966833f, 0.0432433002f},
-std::array<float,2>{0.51494199f, 0.726804852f},
-std::array<float,2>{0.207057759f, 0.690283358f},
-std::array<float,2>{0.834076941f, 0.0301707797f},
-std::array<float,2>{0.491047978f, 0.37641114f},
-std::array<float,2>{0.616164982f, 0.914562821f},
-std::array<float,2>{0.349546999f, 0.831034064f},
-std::array<float,2>{0.717845798f, 0.265534014f},
-std::array<float,2>{0.0175388679f, 0.240775838f},
-std::array<float,2>{0.943953753f, 0.589385331f},
-std::array<float,2>{0.435994387f, 0.538329542f},
-std::array<float,2>{0.562360168f, 0.186498597f},
-std::array<float,2>{0.158454984f, 0.354782403f},
-std::array<float,2>{0.792394757f, 0.800680399f},
-std::array<float,2>{0.0639575943f, 0.952071726f},
-std::array<float,2>{0.935161889f, 0.450968921f},
-std::array<float,2>{0.274369508f, 0.112212986f},
-std::array<float,2>{0.632036984f, 0.640370011f},
-std::array<float,2>{0.0490484461f, 0.603583813f},
-std::array<float,2>{0.983355522f, 0.21468243f},
-std::array<float,2>{0.321348786f, 0.28610903f},
-std::array<float,2>{0.749093115f, 0.869810343f},
-std::array<float,2>{0.46718356f, 0.906050086f},
-std::array<float,2>{0.580894351f, 0.418650478f},
-std::array<float,2>{0.237139195f, 0.034880843f},
-std::array<float,2>{0.864754438f, 0.72047168f},
-std::array<float,2>{0.297006428f, 0.666277289f},
-std::array<float,2>{0.668159246f, 0.086716637f},
-std::array<float,2>{0.123541959f, 0.499154568f},
-std::array<float,2>{0.878985584f, 0.985195518f},
-std::array<float,2>{0.125555977f, 0.780386865f},
-std::array<float,2>{0.772630036f, 0.3268722f},
-std::array<float,2>{0.39798516f, 0.138365909f},
-std::array<float,2>{0.530715644f, 0.519140244f},
-std::array<float,2>{0.179297388f, 0.505280077f},
-std::array<float,2>{0.799500108f, 0.150823429f},
-std::array<float,2>{0.407565475f, 0.333358824f},
-std::array<float,2>{0.53913027f, 0.76491046f},
-std::array<float,2>{0.263207048f, 0.98019737f},
-std::array<float,2>{0.651729345f, 0.479132116f},
-std::array<float,2>{0.0795491785f, 0.0746525377f},
-std::array<float,2>{0.919524729f, 0.67648685f},
-std::array<float,2>{0.483718425f, 0.737293243f},
-std::array<float,2>{0.5947932f, 0.059046831f},
-std::array<float,2>{0.198584646f, 0.427068979f},
-std::array<float,2>{0.82724303f, 0.888342679f},
-std::array<float,2>{0.00488919066f, 0.854091108f},
-std::array<float,2>{0.965541899f, 0.303488642f},
-std::array<float,2>{0.374486446f, 0.198269248f},
-std::array<float,2>{0.696237564f, 0.62043637f},
-std::array<float,2>{0.103159793f, 0.654973686f},
-std::array<float,2>{0.899145186f, 0.108642444f},
-std::array<float,2>{0.295695096f, 0.459968716f},
-std::array<float,2>{0.685829699f, 0.957025707f},
-std::array<float,2>{0.389006674f, 0.789519072f},
-std::array<float,2>{0.510225058f, 0.369241744f},
-std::array<float,2>{0.142511681f, 0.162695825f},
-std::array<float,2>{0.755137265f, 0.561634421f},
-std::array<float,2>{0.336203039f, 0.568979859f},
-std::array<float,2>{0.719156504f, 0.220364168f},
-std::array<float,2>{0.0367899314f, 0.270646691f},
-std::array<float,2>{0.986198366f, 0.827905357f},
-std::array<float,2>{0.229611576f, 0.927491605f},
-std::array<float,2>{0.85715884f, 0.398408651f},
-std::array<float,2>{0.441233635f, 0.0138269924f},
-std::array<float,2>{0.575237155f, 0.714391947f},
-std::array<float,2>{0.155309781f, 0.681683004f},
-std::array<float,2>{0.757895827f, 0.0693779588f},
-std::array<float,2>{0.37788415f, 0.469067097f},
-std::array<float,2>{0.503173888f, 0.969266593f},
-std::array<float,2>{0.281787992f, 0.751904368f},
-std::array<float,2>{0.675075293f, 0.338943005f},
-std::array<float,2>{0.0951149687f, 0.14300786f},
-std::array<float,2>{0.897205293f, 0.508828342f},
-std::array<float,2>{0.45193544f, 0.609549105f},
-std::array<float,2>{0.566148043f, 0.190359294f},
-std::array<float,2>{0.222497195f, 0.312067121f},
-std::array<float,2>{0.846812725f, 0.847061992f},
-std::array<float,2>{0.0433002487f, 0.877895772f},
-std::array<float,2>{0.995238066f, 0.434020668f},
-std::array<float,2>{0.330759287f, 0.0519887395f},
-std::array<float,2>{0.731360435f, 0.748359144f},
-std::array<float,2>{0.0897171274f, 0.551364899f},
-std::array<float,2>{0.912927687f, 0.166158348f},
-std::array<float,2>{0.255530745f, 0.364973664f},
-std::array<float,2>{0.641428292f, 0.783431709f},
-std::array<float,2>{0.419241279f, 0.967547655f},
-std::array<float,2>{0.534992397f, 0.467520505f},
-std::array<float,2>{0.182327449f, 0.0977145284f},
-std::array<float,2>{0.80551666f, 0.64123553f},
-std::array<float,2>{0.360621333f, 0.706771016f},
-std::array<float,2>{0.690860033f, 0.00486357557f},
-std::array<float,2>{0.015136838f, 0.399592191f},
-std::array<float,2>{0.957976282f, 0.935213625f},
-std::array<float,2>{0.188987002f, 0.814835548f},
-std::array<float,2>{0.81857419f, 0.278841287f},
-std::array<float,2>{0.475962222f, 0.229839697f},
-std::array<float,2>{0.608931661f, 0.571970344f},
-std::array<float,2>{0.246948093f, 0.578365505f},
-std::array<float,2>{0.870838583f, 0.249450982f},
-std::array<float,2>{0.453657806f, 0.251355767f},
-std::array<float,2>{0.590501189f, 0.839961886f},
-std::array<float,2>{0.31840679f, 0.913003743f},
-std::array<float,2>{0.739511549f, 0.38738358f},
-std::array<float,2>{0.0611574091f, 0.0182677992f},
-std::array<float,2>{0.969945967f, 0.697802663f},
-std::array<float,2>{0.406102628f, 0.632450044f},
-std::array<float,2>{0.516712606f, 0.121379338f},
-std::array<float,2>{0.134475276f, 0.438196719f},
-std::array<float,2>{0.780220866f, 0.943454921f},
-std::array<float,2>{0.116062075f, 0.804985106f},
-std::array<float,2>{0.885632515f, 0.348543674f},
-std::array<float,2>{0.310991943f, 0.178038746f},
-std::array<float,2>{0.658400595f, 0.543192327f},
-std::array<float,2>{0.0296413787f, 0.730611384f},
-std::array<float,2>{0.952346981f, 0.0428642295f},
-std::array<float,2>{0.359348089f, 0.411025077f},
-std::array<float,2>{0.709413886f, 0.895486414f},
-std::array<float,2>{0.493124008f, 0.860388339f},
-std::array<float,2>{0.623491943f, 0.293262899f},
-std::array<float,2>{0.214618593f, 0.20927535f},
-std::array<float,2>{0.839191854f, 0.598852932f},
-std::array<float,2>{0.269235373f, 0.531149685f},
-std::array<float,2>{0.640622973f, 0.126442567f},
-std::array<float,2>{0.0712830871f, 0.31559816f},
-std::array<float,2>{0.926214218f, 0.771418095f},
-std::array<float,2>{0.170530796f, 0.995008767f},
-std::array<float,2>{0.784658313f, 0.48895967f},
-std::array<float,2>{0.426672935f, 0.0800888985f},
-std::array<float,2>{0.548826516f, 0.662869811f},
-std::array<float,2>{0.192490697f, 0.669272304f},
-std::array<float,2>{0.815058589f, 0.091134347f},
-std::array<float,2>{0.470972985f, 0.493636608f},
-std::array<float,2>{0.604128182f, 0.991080821f},
-std::array<float,2>{0.366017818f, 0.774167597f},
-std::array<float,2>{0.694611132f, 0.321404517f},
-std::array<float,2>{0.00892474502f, 0.136334881f},
-std::array<float,2>{0.953534067f, 0.521851957f},
-std::array<float,2>{0.415224314f, 0.605711997f},
-std::array<float,2>{0.537871301f, 0.215943292f},
-std::array<float,2>{0.185084119f, 0.28148672f},
-std::array<float,2>{0.812014699f, 0.872669637f},
-std::array<float,2>{0.0924955606f, 0.900510371f},
-std::array<float,2>{0.908419192f, 0.414558947f},
-std::array<float,2>{0.253314793f, 0.0374732688f},
-std::array<float,2>{0.646394491f, 0.724062622f},
-std::array<float,2>{0.0419540815f, 0.534680247f},
-std::array<float,2>{0.99840349f, 0.179949f},
-std::array<float,2>{0.332887173f, 0.356324494f},
-std::array<float,2>{0.728197336f, 0.802076519f},
-std::array<float,2>{0.447630703f, 0.945604861f},
-std::array<float,2>{0.567915797f, 0.445335954f},
-std::array<float,2>{0.225028038f, 0.114384815f},
-std::array<float,2>{0.848382235f, 0.635774076f},
-std::array<float,2>{0.287221462f, 0.693515718f},
-std::array<float,2>{0.678840995f, 0.0257550254f},
-std::array<float,2>{0.0999294445f, 0.381726593f},
-std::array<float,2>{0.892511427f, 0.920427203f},
-std::array<float,2>{0.14864096f, 0.834957659f},
-std::array<float,2>{0.764519691f, 0.25849387f},
-std::array<float,2>{0.380121768f, 0.234990105f},
-std::array<float,2>{0.504970133f, 0.592479646f},
-std::array<float,2>{0.164688066f, 0.563107967f},
-std::array<float,2>{0.786965489f, 0.224805787f},
-std::array<float,2>{0.423540711f, 0.269391477f},
-std::array<float,2>{0.552904665f, 0.823411405f},
-std::array<float,2>{0.272049099f, 0.925068498f},
-std::array<float,2>{0.634789646f, 0.393824607f},
-std::array<float,2>{0.0768170208f, 0.00941607449f},
-std::array<float,2>{0.925680876f, 0.718492389f},
-std::array<float,2>{0.496819288f, 0.651610434f},
-std::array<float,2>{0.617486596f, 0.103442647f},
-std::array<float,2>{0.215805128f, 0.455813706f},
-std::array<float,2>{0.840015173f, 0.957503617f},
-std::array<float,2>{0.0268000588f, 0.795642197f},
-std::array<float,2>{0.94784379f, 0.371644139f},
-std::array<float,2>{0.354165137f, 0.159264401f},
-std::array<float,2>{0.703249574f, 0.556723356f},
-std::array<float,2>{0.113247871f, 0.738385677f},
-std::array<float,2>{0.890109122f, 0.057628572f},
-std::array<float,2>{0.307271183f, 0.424283564f},
-std::array<float,2>{0.660831928f, 0.883445501f},
-std::array<float,2>{0.400081545f, 0.856055975f},
-std::array<float,2>{0.52097398f, 0.300529122f},
-std::array<float,2>{0.138457224f, 0.200012907f},
-std::array<float,2>{0.773815334f, 0.622664094f},
-std::array<float,2>{0.312863171f, 0.500383198f},
-std::array<float,2>{0.736438632f, 0.156101108f},
-std::array<float,2>{0.0572505593f, 0.329174399f},
-std::array<float,2>{0.976446152f, 0.757842064f},
-std::array<float,2>{0.243685856f, 0.980660498f},
-std::array<float,2>{0.871816635f, 0.483796239f},
-std::array<float,2>{0.45778051f, 0.0712674037f},
-std::array<float,2>{0.586666524f, 0.675301433f},
-std::array<float,2>{0.131333768f, 0.710013628f},
-std::array<float,2>{0.767039001f, 0.00293695135f},
-std::array<float,2>{0.392397255f, 0.404307395f},
-std::array<float,2>{0.525593698f, 0.933486402f},
-std::array<float,2>{0.303733647f, 0.816760123f},
-std::array<float,2>{0.667733908f, 0.275752306f},
-std::array<float,2>{0.119375221f, 0.231464744f},
-std::array<float,2>{0.877717733f, 0.576975405f},
-std::array<float,2>{0.460960716f, 0.54894954f},
-std::array<float,2>{0.584556222f, 0.168997705f},
-std::array<float,2>{0.239487201f, 0.362948179f},
-std::array<float,2>{0.86042583f, 0.787904561f},
-std::array<float,2>{0.0509153306f, 0.962184012f},
-std::array<float,2>{0.97709018f, 0.463191926f},
-std::array<float,2>{0.327253073f, 0.0942558944f},
-std::array<float,2>{0.744722068f, 0.647144854f},
-std::array<float,2>{0.0691677481f, 0.613948643f},
-std::array<float,2>{0.932760179f, 0.194579586f},
-std::array<float,2>{0.277989864f, 0.308087498f},
-std::array<float,2>{0.626663685f, 0.849900663f},
-std::array<float,2>{0.430736274f, 0.882515073f},
-std::array<float,2>{0.556113183f, 0.432020426f},
-std::array<float,2>{0.163238272f, 0.0471265875f},
-std::array<float,2>{0.795570254f, 0.743675053f},
-std::array<float,2>{0.343807429f, 0.686333001f},
-std::array<float,2>{0.712070048f, 0.0643414259f},
-std::array<float,2>{0.0198447108f, 0.476151764f},
-std::array<float,2>{0.940538943f, 0.973470449f},
-std::array<float,2>{0.204251304f, 0.756081939f},
-std::array<float,2>{0.828827798f, 0.342829645f},
-std::array<float,2>{0.486854196f, 0.14812538f},
-std::array<float,2>{0.60961926f, 0.514812708f},
-std::array<float,2>{0.233024523f, 0.525709569f},
-std::array<float,2>{0.855109453f, 0.130829677f},
-std::array<float,2>{0.443153739f, 0.317637533f},
-std::array<float,2>{0.572767675f, 0.765790045f},
-std::array<float,2>{0.340196699f, 0.997731805f},
-std::array<float,2>{0.724667549f, 0.484976977f},
-std::array<float,2>{0.0341476053f, 0.0820993111f},
-std::array<float,2>{0.990725517f, 0.65987885f},
-std::array<float,2>{0.386113077f, 0.729761302f},
-std::array<float,2>{0.512214303f, 0.0459757522f},
-std::array<float,2>{0.144809172f, 0.406876594f},
-std::array<float,2>{0.751838684f, 0.894286633f},
-std::array<float,2>{0.106604651f, 0.865602016f},
-std::array<float,2>{0.905181885f, 0.289349735f},
-std::array<float,2>{0.290508479f, 0.205988303f},
-std::array<float,2>{0.679826438f, 0.594594002f},
-std::array<float,2>{0.00160616124f, 0.626772106f},
-std::array<float,2>{0.963615477f, 0.119288154f},
-std::array<float,2>{0.367563754f, 0.443733364f},
-std::array<float,2>{0.701423109f, 0.940275788f},
-std::array<float,2>{0.478305638f, 0.810402453f},
-std::array<float,2>{0.59986037f, 0.345670313f},
-std::array<float,2>{0.200214788f, 0.174515724f},
-std::array<float,2>{0.820521176f, 0.540543199f},
-std::array<float,2>{0.258985698f, 0.584717155f},
-std::array<float,2>{0.654762149f, 0.243031055f},
-std::array<float,2>{0.0832604319f, 0.254174143f},
-std::array<float,2>{0.916950166f, 0.83897227f},
-std::array<float,2>{0.175384954f, 0.906827629f},
-std::array<float,2>{0.803189278f, 0.386376947f},
-std::array<float,2>{0.410531342f, 0.0199530423f},
-std::array<float,2>{0.543703616f, 0.700129211f},
-std::array<float,2>{0.235732079f, 0.722270846f},
-std::array<float,2>{0.865939736f, 0.0315165371f},
-std::array<float,2>{0.46518898f, 0.421504468f},
-std::array<float,2>{0.578911602f, 0.902840257f},
-std::array<float,2>{0.322929323f, 0.867621183f},
-std::array<float,2>{0.747196436f, 0.287571669f},
-std::array<float,2>{0.0484505147f, 0.212622225f},
-std::array<float,2>{0.981899977f, 0.603051782f},
-std::array<float,2>{0.395103186f, 0.51591295f},
-std::array<float,2>{0.528574824f, 0.139852241f},
-std::array<float,2>{0.127753079f, 0.324927449f},
-std::array<float,2>{0.77019608f, 0.778368175f},
-std::array<float,2>{0.121929497f, 0.987497032f},
-std::array<float,2>{0.881225944f, 0.497012734f},
-std::array<float,2>{0.299622208f, 0.0888331532f},
-std::array<float,2>{0.670617878f, 0.665250301f},
-std::array<float,2>{0.0179704838f, 0.586536825f},
-std::array<float,2>{0.942094266f, 0.240020275f},
-std::array<float,2>{0.351043612f, 0.262155145f},
-std::array<float,2>{0.715668499f, 0.828266084f},
-std::array<float,2>{0.489238143f, 0.917457461f},
-std::array<float,2>{0.613940239f, 0.378254265f},
-std::array<float,2>{0.210043743f, 0.0287625939f},
-std::array<float,2>{0.83206898f, 0.688657761f},
-std::array<float,2>{0.275920182f, 0.636868656f},
-std::array<float,2>{0.630759478f, 0.110957503f},
-std::array<float,2>{0.0663195327f, 0.452357382f},
-std::array<float,2>{0.937087417f, 0.950093448f},
-std::array<float,2>{0.157006562f, 0.798085332f},
-std::array<float,2>{0.790198982f, 0.352701008f},
-std::array<float,2>{0.43496725f, 0.184674874f},
-std::array<float,2>{0.559720337f, 0.535751283f},
-std::array<float,2>{0.143270582f, 0.55927521f},
-std::array<float,2>{0.756273091f, 0.161217526f},
-std::array<float,2>{0.387296677f, 0.36844188f},
-std::array<float,2>{0.509700179f, 0.79180181f},
-std::array<float,2>{0.294469833f, 0.954283655f},
-std::array<float,2>{0.684645236f, 0.457754165f},
-std::array<float,2>{0.104876392f, 0.107309073f},
-std::array<float,2>{0.901616991f, 0.652814627f},
-std::array<float,2>{0.438319385f, 0.711703062f},
-std::array<float,2>{0.576892257f, 0.0120708393f},
-std::array<float,2>{0.227739319f, 0.395086318f},
-std::array<float,2>{0.858074248f, 0.928887367f},
-std::array<float,2>{0.0386840627f, 0.825079858f},
-std::array<float,2>{0.987563074f, 0.272090137f},
-std::array<float,2>{0.339235157f, 0.222608164f},
-std::array<float,2>{0.72168386f, 0.567878842f},
-std::array<float,2>{0.0815779865f, 0.678349018f},
-std::array<float,2>{0.921839833f, 0.0771859735f},
-std::array<float,2>{0.265443325f, 0.476741582f},
-std::array<float,2>{0.64910537f, 0.977293491f},
-std::array<float,2>{0.408637077f, 0.762889564f},
-std::array<float,2>{0.542162597f, 0.335916609f},
-std::array<float,2>{0.176251128f, 0.150225192f},
-std::array<float,2>{0.797087133f, 0.506827414f},
-std::array<float,2>{0.371921957f, 0.618452966f},
-std::array<float,2>{0.699153423f, 0.196437329f},
-std::array<float,2>{0.00607549632f, 0.302179217f},
-std::array<float,2>{0.968353629f, 0.85217315f},
-std::array<float,2>{0.195526734f, 0.889744401f},
-std::array<float,2>{0.824372947f, 0.42789641f},
-std::array<float,2>{0.48149094f, 0.062036261f},
-std::array<float,2>{0.596647501f, 0.735598087f},
-std::array<float,2>{0.181366384f, 0.642835796f},
-std::array<float,2>{0.807410896f, 0.101240218f},
-std::array<float,2>{0.420882672f, 0.465699673f},
-std::array<float,2>{0.531470895f, 0.965809524f},
-std::array<float,2>{0.256377876f, 0.781461596f},
-std::array<float,2>{0.642913938f, 0.365897119f},
-std::array<float,2>{0.0878398195f, 0.165345609f},
-std::array<float,2>{0.910958767f, 0.553893268f},
-std::array<float,2>{0.474575073f, 0.5733881f},
-std::array<float,2>{0.606045544f, 0.227885723f},
-std::array<float,2>{0.191312835f, 0.279710561f},
-std::array<float,2>{0.817384779f, 0.814318001f},
-std::array<float,2>{0.0132126817f, 0.936042666f},
-std::array<float,2>{0.960089743f, 0.401308686f},
-std::array<float,2>{0.361699164f, 0.00610517198f},
-std::array<float,2>{0.68801558f, 0.704407632f},
-std::array<float,2>{0.0975826457f, 0.510664642f},
-std::array<float,2>{0.895249605f, 0.141374424f},
-std::array<float,2>{0.283607692f, 0.337505579f},
-std::array<float,2>{0.672543466f, 0.752872229f},
-std::array<float,2>{0.375780761f, 0.972084403f},
-std::array<float,2>{0.500417292f, 0.471405804f},
-std::array<float,2>{0.15424642f, 0.0669701323f},
-std::array<float,2>{0.761558354f, 0.68160224f},
-std::array<float,2>{0.329337448f, 0.748003483f},
-std::array<float,2>{0.733720303f, 0.0528134368f},
-std::array<float,2>{0.0453815013f, 0.436370492f},
-std::array<float,2>{0.994132996f, 0.876548707f},
-std::array<float,2>{0.218794852f, 0.844236314f},
-std::array<float,2>{0.844836771f, 0.308920443f},
-std::array<float,2>{0.450091928f, 0.188093647f},
-std::array<float,2>{0.562632561f, 0.612628758f},
-std::array<float,2>{0.21098043f, 0.600797057f},
-std::array<float,2>{0.837688625f, 0.208257332f},
-std::array<float,2>{0.495632708f, 0.296119511f},
-std::array<float,2>{0.622188628f, 0.861382723f},
-std::array<float,2>{0.356271178f, 0.898095727f},
-std::array<float,2>{0.707603157f, 0.412976414f},
-std::array<float,2>{0.0284880884f, 0.0401835702f},
-std::array<float,2>{0.950759768f, 0.733203769f},
-std::array<float,2>{0.428841978f, 0.661251664f},
-std::array<float,2>{0.550720751f, 0.078773953f},
-std::array<float,2>{0.16977568f, 0.491053611f},
-std::array<float,2>{0.781900167f, 0.992191553f},
-std::array<float,2>{0.0726214051f, 0.772894263f},
-std::array<float,2>{0.929683328f, 0.313485533f},
-std::array<float,2>{0.265675396f, 0.127714068f},
-std::array<float,2>{0.636947095f, 0.528736889f},
-std::array<float,2>{0.0593460351f, 0.696484268f},
-std::array<float,2>{0.971958339f, 0.0170393381f},
-std::array<float,2>{0.317089945f, 0.390421569f},
-std::array<float,2>{0.741737008f, 0.9119578f},
-std::array<float,2>{0.456249982f, 0.843670726f},
-std::array<float,2>{0.593628168f, 0.253346115f},
-std::array<float,2>{0.249366015f, 0.247124434f},
-std::array<float,2>{0.868018329f, 0.581901968f},
-std::array<float,2>{0.31036675f, 0.546512425f},
-std::array<float,2>{0.657513022f, 0.176995933f},
-std::array<float,2>{0.113541529f, 0.350868076f},
-std::array<float,2>{0.884263992f, 0.808133483f},
-std::array<float,2>{0.136547968f, 0.943195224f},
-std::array<float,2>{0.778366804f, 0.441114366f},
-std::array<float,2>{0.403965771f, 0.12345212f},
-std::array<float,2>{0.518558443f, 0.630339921f},
-std::array<float,2>{0.238187417f, 0.665447593f},
-std::array<float,2>{0.864066839f, 0.0884071216f},
-std::array<float,2>{0.468183517f, 0.496642292f},
-std::array<float,2>{0.581583619f, 0.987689555f},
-std::array<float,2>{0.3211734f, 0.778694212f},
-std::array<float,2>{0.748814166f, 0.325104535f},
-std::array<float,2>{0.0507782586f, 0.140034303f},
-std::array<float,2>{0.9839288f, 0.515823066f},
-std::array<float,2>{0.396809697f, 0.603460252f},
-std::array<float,2>{0.529319584f, 0.21276702f},
-std::array<float,2>{0.126653001f, 0.287236482f},
-std::array<float,2>{0.772378564f, 0.867229283f},
-std::array<float,2>{0.124165379f, 0.903270602f},
-std::array<float,2>{0.880221665f, 0.421668053f},
-std::array<float,2>{0.298242867f, 0.0312714614f},
-std::array<float,2>{0.669166625f, 0.722456813f},
-std::array<float,2>{0.0165171362f, 0.53609252f},
-std::array<float,2>{0.945245802f, 0.184840381f},
-std::array<float,2>{0.347725302f, 0.352903247f},
-std::array<float,2>{0.717590332f, 0.798174083f},
-std::array<float,2>{0.491990298f, 0.949876547f},
-std::array<float,2>{0.6168347f, 0.45263648f},
-std::array<float,2>{0.208784506f, 0.111306228f},
-std::array<float,2>{0.835591912f, 0.637190819f},
-std::array<float,2>{0.274427384f, 0.688936651f},
-std::array<float,2>{0.631171882f, 0.0285008438f},
-std::array<float,2>{0.0631830692f, 0.37808305f},
-std::array<float,2>{0.934345424f, 0.91711539f},
-std::array<float,2>{0.160036907f, 0.828516006f},
-std::array<float,2>{0.791503727f, 0.261842281f},
-std::array<float,2>{0.437424809f, 0.239840269f},
-std::array<float,2>{0.560729086f, 0.586910784f},
-std::array<float,2>{0.141324118f, 0.568316042f},
-std::array<float,2>{0.75441134f, 0.222240165f},
-std::array<float,2>{0.390310109f, 0.272233605f},
-std::array<float,2>{0.511498272f, 0.82487601f},
-std::array<float,2>{0.296161771f, 0.929008543f},
-std::array<float,2>{0.687384725f, 0.395335227f},
-std::array<float,2>{0.101797938f, 0.0119252224f},
-std::array<float,2>{0.899827242f, 0.711463213f},
-std::array<float,2>{0.440310627f, 0.652534127f},
-std::array<float,2>{0.575082242f, 0.107039899f},
-std::array<float,2>{0.229246348f, 0.457888544f},
-std::array<float,2>{0.855533957f, 0.954355776f},
-std::array<float,2>{0.036117509f, 0.791701138f},
-std::array<float,2>{0.984702229f, 0.368375182f},
-std::array<float,2>{0.337352335f, 0.16153194f},
-std::array<float,2>{0.719901383f, 0.559354305f},
-std::array<float,2>{0.0781258717f, 0.735399246f},
-std::array<float,2>{0.918485165f, 0.0624056756f},
-std::array<float,2>{0.261757314f, 0.42804718f},
-std::array<float,2>{0.650398374f, 0.890052974f},
-std::array<float,2>{0.40630874f, 0.852402747f},
-std::array<float,2>{0.540868878f, 0.301806629f},
-std::array<float,2>{0.1779695f, 0.196617171f},
-std::array<float,2>{0.800090432f, 0.618287504f},
-std::array<float,2>{0.373412549f, 0.506565511f},
-std::array<float,2>{0.697184503f, 0.150068849f},
-std::array<float,2>{0.00475274306f, 0.335510522f},
-std::array<float,2>{0.96666044f, 0.763083398f},
-std::array<float,2>{0.19772467f, 0.977386713f},
-std::array<float,2>{0.826906443f, 0.476913899f},
-std::array<float,2>{0.48302561f, 0.0774146244f},
-std::array<float,2>{0.594415367f, 0.678476036f},
-std::array<float,2>{0.183160439f, 0.704141438f},
-std::array<float,2>{0.80578047f, 0.00603672303f},
-std::array<float,2>{0.418434173f, 0.401116312f},
-std::array<float,2>{0.533408165f, 0.93642807f},
-std::array<float,2>{0.254024059f, 0.814013422f},
-std::array<float,2>{0.642518818f, 0.279473722f},
-std::array<float,2>{0.0881860182f, 0.227629811f},
-std::array<float,2>{0.913733721f, 0.573561132f},
-std::array<float,2>{0.474785089f, 0.55401212f},
-std::array<float,2>{0.608020246f, 0.16517964f},
-std::array<float,2>{0.188028976f, 0.366155535f},
-std::array<float,2>{0.819416642f, 0.781510174f},
-std::array<float,2>{0.0141154248f, 0.965448678f},
-std::array<float,2>{0.958670676f, 0.465390623f},
-std::array<float,2>{0.360206276f, 0.101523586f},
-std::array<float,2>{0.689923704f, 0.642631412f},
-std::array<float,2>{0.0940378681f, 0.612347782f},
-std::array<float,2>{0.897861421f, 0.188283935f},
-std::array<float,2>{0.282414317f, 0.308823347f},
-std::array<float,2>{0.673868716f, 0.843829215f},
-std::array<float,2>{0.378789872f, 0.876785278f},
-std::array<float,2>{0.502283037f, 0.436218113f},
-std::array<float,2>{0.154546842f, 0.0531968847f},
-std::array<float,2>{0.759299457f, 0.747690856f},
-std::array<float,2>{0.331912428f, 0.681370199f},
-std::array<float,2>{0.732277691f, 0.06720303f},
-std::array<float,2>{0.0440365747f, 0.471568197f},
-std::array<float,2>{0.994198322f, 0.971741378f},
-std::array<float,2>{0.22120212f, 0.752506196f},
-std::array<float,2>{0.845964074f, 0.337647736f},
-std::array<float,2>{0.453108042f, 0.141124398f},
-std::array<float,2>{0.564777672f, 0.510472178f},
-std::array<float,2>{0.213761166f, 0.528343976f},
-std::array<float,2>{0.838458717f, 0.127526075f},
-std::array<float,2>{0.493597239f, 0.313921899f},
-std::array<float,2>{0.624223888f, 0.772696078f},
-std::array<float,2>{0.358337969f, 0.992653072f},
-std::array<float,2>{0.71064949f, 0.490922868f},
-std::array<float,2>{0.0305914506f, 0.0790259987f},
-std::array<float,2>{0.952002406f, 0.661595285f},
-std::array<float,2>{0.427488923f, 0.733019233f},
-std::array<float,2>{0.547810495f, 0.0404653139f},
-std::array<float,2>{0.171566039f, 0.41269964f},
-std::array<float,2>{0.784027755f, 0.898371041f},
-std::array<float,2>{0.0717786402f, 0.861621976f},
-std::array<float,2>{0.926760495f, 0.29625237f},
-std::array<float,2>{0.267792284f, 0.208020046f},
-std::array<float,2>{0.639154315f, 0.600986362f},
-std::array<float,2>{0.0618543178f, 0.63006717f},
-std::array<float,2>{0.969349623f, 0.123249456f},
-std::array<float,2>{0.319650561f, 0.441256702f},
-std::array<float,2>{0.739187539f, 0.943033218f},
-std::array<float,2>{0.454986989f, 0.808563948f},
-std::array<float,2>{0.591584146f, 0.350599647f},
-std::array<float,2>{0.247796372f, 0.177044123f},
-std::array<float,2>{0.869960546f, 0.546686709f},
-std::array<float,2>{0.311573327f, 0.581777632f},
-std::array<float,2>{0.660023451f, 0.247473717f},
-std::array<float,2>{0.117180243f, 0.253056407f},
-std::array<float,2>{0.886358976f, 0.843420506f},
-std::array<float,2>{0.133634359f, 0.91162926f},
-std::array<float,2>{0.780778289f, 0.390146106f},
-std::array<float,2>{0.404540181f, 0.0167367831f},
-std::array<float,2>{0.516490281f, 0.696713448f},
-std::array<float,2>{0.193613574f, 0.723871648f},
-std::array<float,2>{0.812669694f, 0.037255656f},
-std::array<float,2>{0.470653951f, 0.41492188f},
-std::array<float,2>{0.602740645f, 0.900752187f},
-std::array<float,2>{0.365084499f, 0.873010874f},
-std::array<float,2>{0.692085266f, 0.281657308f},
-std::array<float,2>{0.0100511201f, 0.216123089f},
-std::array<float,2>{0.955942392f, 0.605903387f},
-std::array<float,2>{0.417187929f, 0.521514714f},
-std::array<float,2>{0.53580898f, 0.136563793f},
-std::array<float,2>{0.186467513f, 0.321598023f},
-std::array<float,2>{0.809065282f, 0.77417922f},
-std::array<float,2>{0.0906719193f, 0.99076587f},
-std::array<float,2>{0.907066464f, 0.493288159f},
-std::array<float,2>{0.251188219f, 0.0910168514f},
-std::array<float,2>{0.646531224f, 0.668956339f},
-std::array<float,2>{0.0399192721f, 0.59266609f},
-std::array<float,2>{0.996970296f, 0.235266566f},
-std::array<float,2>{0.334516943f, 0.258715332f},
-std::array<float,2>{0.728954077f, 0.834688544f},
-std::array<float,2>{0.44540292f, 0.920811594f},
-std::array<float,2>{0.569924653f, 0.381546885f},
-std::array<float,2>{0.223942593f, 0.0254387539f},
-std::array<float,2>{0.85137701f, 0.693735003f},
-std::array<float,2>{0.2856341f, 0.63615036f},
-std::array<float,2>{0.677690923f, 0.114592314f},
-std::array<float,2>{0.0994743854f, 0.445615232f},
-std::array<float,2>{0.89428103f, 0.945548415f},
-std::array<float,2>{0.151636019f, 0.801777363f},
-std::array<float,2>{0.762064159f, 0.356120437f},
-std::array<float,2>{0.380891263f, 0.179729834f},
-std::array<float,2>{0.505896509f, 0.535144746f},
-std::array<float,2>{0.167443708f, 0.556919038f},
-std::array<float,2>{0.789005935f, 0.159517929f},
-std::array<float,2>{0.425269097f, 0.371921539f},
-std::array<float,2>{0.551464558f, 0.795777261f},
-std::array<float,2>{0.271339059f, 0.957122147f},
-std::array<float,2>{0.633454859f, 0.455778688f},
-std::array<float,2>{0.0753470808f, 0.103118263f},
-std::array<float,2>{0.923095703f, 0.651703894f},
-std::array<float,2>{0.498789608f, 0.718729377f},
-std::array<float,2>{0.619901001f, 0.00955684483f},
-std::array<float,2>{0.218215525f, 0.39370653f},
-std::array<float,2>{0.843174458f, 0.924948812f},
-std::array<float,2>{0.0238583498f, 0.823526561f},
-std::array<float,2>{0.946969032f, 0.26913029f},
-std::array<float,2>{0.352344781f, 0.225066081f},
-std::array<float,2>{0.705781043f, 0.563321292f},
-std::array<float,2>{0.110411137f, 0.67565608f},
-std::array<float,2>{0.886761665f, 0.0709867924f},
-std::array<float,2>{0.306114852f, 0.483412057f},
-std::array<float,2>{0.663327754f, 0.980855703f},
-std::array<float,2>{0.401506335f, 0.758170843f},
-std::array<float,2>{0.52265954f, 0.329508811f},
-std::array<float,2>{0.138693362f, 0.155945569f},
-std::array<float,2>{0.77637583f, 0.500093997f},
-std::array<float,2>{0.315293938f, 0.622908235f},
-std::array<float,2>{0.73458302f, 0.199738905f},
-std::array<float,2>{0.0566128492f, 0.300772548f},
-std::array<float,2>{0.974018216f, 0.856257498f},
-std::array<float,2>{0.244703382f, 0.883739769f},
-std::array<float,2>{0.874998212f, 0.423975378f},
-std::array<float,2>{0.459494829f, 0.058017619f},
-std::array<float,2>{0.589397371f, 0.738598645f},
-std::array<float,2>{0.130466446f, 0.647252798f},
-std::array<float,2>{0.769015431f, 0.0946159065f},
-std::array<float,2>{0.393376172f, 0.46306631f},
-std::array<float,2>{0.523957729f, 0.962157965f},
-std::array<float,2>{0.30273208f, 0.787644088f},
-std::array<float,2>{0.664752245f, 0.363214493f},
-std::array<float,2>{0.117330462f, 0.16933544f},
-std::array<float,2>{0.875919163f, 0.549075127f},
-std::array<float,2>{0.463677108f, 0.576799214f},
-std::array<float,2>{0.583614647f, 0.231755674f},
-std::array<float,2>{0.24089092f, 0.275585383f},
-std::array<float,2>{0.862763762f, 0.816476583f},
-std::array<float,2>{0.0534770899f, 0.933299959f},
-std::array<float,2>{0.979473174f, 0.404566258f},
-std::array<float,2>{0.324739039f, 0.00329529331f},
-std::array<float,2>{0.742210388f, 0.710422456f},
-std::array<float,2>{0.0671858042f, 0.514932692f},
-std::array<float,2>{0.930704832f, 0.14829132f},
-std::array<float,2>{0.280810058f, 0.343161553f},
-std::array<float,2>{0.627458394f, 0.75612694f},
-std::array<float,2>{0.432422191f, 0.973216951f},
-std::array<float,2>{0.557350695f, 0.476531953f},
-std::array<float,2>{0.161525011f, 0.064123325f},
-std::array<float,2>{0.794317901f, 0.68620795f},
-std::array<float,2>{0.346424192f, 0.744134128f},
-std::array<float,2>{0.713329792f, 0.0471183918f},
-std::array<float,2>{0.0223611649f, 0.431794971f},
-std::array<float,2>{0.937528372f, 0.88273412f},
-std::array<float,2>{0.205156818f, 0.849795043f},
-std::array<float,2>{0.831645668f, 0.307852745f},
-std::array<float,2>{0.4845725f, 0.194765553f},
-std::array<float,2>{0.612635553f, 0.614133656f},
-std::array<float,2>{0.232147604f, 0.594332159f},
-std::array<float,2>{0.852386773f, 0.20567283f},
-std::array<float,2>{0.445209533f, 0.289268017f},
-std::array<float,2>{0.571904123f, 0.865288377f},
-std::array<float,2>{0.343528897f, 0.894517839f},
-std::array<float,2>{0.723913729f, 0.407138586f},
-std::array<float,2>{0.0331475027f, 0.0461858027f},
-std::array<float,2>{0.988364577f, 0.729674518f},
-std::array<float,2>{0.382855117f, 0.660006642f},
-std::array<float,2>{0.51415658f, 0.0823997185f},
-std::array<float,2>{0.147193179f, 0.485154867f},
-std::array<float,2>{0.752770007f, 0.997817039f},
-std::array<float,2>{0.109047577f, 0.76601404f},
-std::array<float,2>{0.902458489f, 0.317439824f},
-std::array<float,2>{0.292652249f, 0.130377501f},
-std::array<float,2>{0.682262719f, 0.525612652f},
-std::array<float,2>{0.00269160094f, 0.699836195f},
-std::array<float,2>{0.962596774f, 0.0196786784f},
-std::array<float,2>{0.370596915f, 0.386656791f},
-std::array<float,2>{0.700950444f, 0.907149911f},
-std::array<float,2>{0.480345875f, 0.839291275f},
-std::array<float,2>{0.598279297f, 0.254120409f},
-std::array<float,2>{0.202436164f, 0.242699087f},
-std::array<float,2>{0.823210657f, 0.58465004f},
-std::array<float,2>{0.261455089f, 0.54090625f},
-std::array<float,2>{0.653233886f, 0.174721792f},
-std::array<float,2>{0.0842572525f, 0.345286518f},
-std::array<float,2>{0.914867342f, 0.810146689f},
-std::array<float,2>{0.172165036f, 0.940014482f},
-std::array<float,2>{0.801674366f, 0.443575203f},
-std::array<float,2>{0.413325042f, 0.119618259f},
-std::array<float,2>{0.546406746f, 0.62653476f},
-std::array<float,2>{0.209565997f, 0.640587986f},
-std::array<float,2>{0.833178401f, 0.111870743f},
-std::array<float,2>{0.489307374f, 0.450746268f},
-std::array<float,2>{0.61484462f, 0.951680839f},
-std::array<float,2>{0.350347281f, 0.800393701f},
-std::array<float,2>{0.716038942f, 0.354676485f},
-std::array<float,2>{0.0191546418f, 0.186274111f},
-std::array<float,2>{0.94304198f, 0.538350284f},
-std::array<float,2>{0.434233338f, 0.589693069f},
-std::array<float,2>{0.559546292f, 0.241149217f},
-std::array<float,2>{0.157421142f, 0.265137792f},
-std::array<float,2>{0.789846003f, 0.830628097f},
-std::array<float,2>{0.0652902052f, 0.914854467f},
-std::array<float,2>{0.935927629f, 0.376119435f},
-std::array<float,2>{0.277303368f, 0.0300026424f},
-std::array<float,2>{0.629544199f, 0.690125585f},
-std::array<float,2>{0.0474486127f, 0.519515634f},
-std::array<float,2>{0.980544269f, 0.13866879f},
-std::array<float,2>{0.323273242f, 0.327128708f},
-std::array<float,2>{0.74653548f, 0.780759394f},
-std::array<float,2>{0.465952486f, 0.985048473f},
-std::array<float,2>{0.579944909f, 0.499473691f},
-std::array<float,2>{0.235011667f, 0.0864299759f},
-std::array<float,2>{0.867083013f, 0.666146278f},
-std::array<float,2>{0.3004134f, 0.720291734f},
-std::array<float,2>{0.671782315f, 0.0349412039f},
-std::array<float,2>{0.122340791f, 0.418906569f},
-std::array<float,2>{0.882477403f, 0.905816853f},
-std::array<float,2>{0.127993017f, 0.869949043f},
-std::array<float,2>{0.771191001f, 0.285802394f},
-std::array<float,2>{0.395907015f, 0.21447742f},
-std::array<float,2>{0.528191507f, 0.603810072f},
-std::array<float,2>{0.177721038f, 0.620294809f},
-std::array<float,2>{0.798261702f, 0.198577166f},
-std::array<float,2>{0.409492284f, 0.303317428f},
-std::array<float,2>{0.541918278f, 0.854336917f},
-std::array<float,2>{0.264563203f, 0.888665318f},
-std::array<float,2>{0.650341153f, 0.426966846f},
-std::array<float,2>{0.0804570243f, 0.0588249937f},
-std::array<float,2>{0.919968128f, 0.736966491f},
-std::array<float,2>{0.480984271f, 0.676527679f},
-std::array<float,2>{0.59751755f, 0.0743179396f},
-std::array<float,2>{0.196637034f, 0.479354858f},
-std::array<float,2>{0.825434208f, 0.980362833f},
-std::array<float,2>{0.00781220198f, 0.764879286f},
-std::array<float,2>{0.967621088f, 0.333020896f},
-std::array<float,2>{0.372490853f, 0.150476411f},
-std::array<float,2>{0.697570264f, 0.505015969f},
-std::array<float,2>{0.103789486f, 0.714806795f},
-std::array<float,2>{0.901194155f, 0.0139561584f},
-std::array<float,2>{0.293369144f, 0.398118496f},
-std::array<float,2>{0.683771133f, 0.927261472f},
-std::array<float,2>{0.387880266f, 0.827656984f},
-std::array<float,2>{0.508183599f, 0.27077204f},
-std::array<float,2>{0.144325763f, 0.220527813f},
-std::array<float,2>{0.757297873f, 0.569321632f},
-std::array<float,2>{0.338357061f, 0.561992824f},
-std::array<float,2>{0.720984519f, 0.162937313f},
-std::array<float,2>{0.0380530618f, 0.369414449f},
-std::array<float,2>{0.986931443f, 0.789253533f},
-std::array<float,2>{0.226668864f, 0.956651509f},
-std::array<float,2>{0.858626366f, 0.460427582f},
-std::array<float,2>{0.438605994f, 0.108807333f},
-std::array<float,2>{0.577373445f, 0.655067623f},
-std::array<float,2>{0.152909771f, 0.748223245f},
-std::array<float,2>{0.760533631f, 0.052039858f},
-std::array<float,2>{0.37646991f, 0.433778673f},
-std::array<float,2>{0.50123173f, 0.877486706f},
-std::array<float,2>{0.285151064f, 0.846922517f},
-std::array<float,2>{0.673728704f, 0.312389702f},
-std::array<float,2>{0.0959186256f, 0.190075859f},
-std::array<float,2>{0.89624691f, 0.609814227f},
-std::array<float,2>{0.450769246f, 0.509148717f},
-std::array<float,2>{0.563677192f, 0.142706811f},
-std::array<float,2>{0.220305398f, 0.339150876f},
-std::array<float,2>{0.844319105f, 0.751655638f},
-std::array<float,2>{0.046105627f, 0.969569862f},
-std::array<float,2>{0.99247998f, 0.468795836f},
-std::array<float,2>{0.328502983f, 0.069747746f},
-std::array<float,2>{0.73299408f, 0.681902289f},
-std::array<float,2>{0.0867672488f, 0.572237432f},
-std::array<float,2>{0.912019491f, 0.229599446f},
-std::array<float,2>{0.256992489f, 0.279248148f},
-std::array<float,2>{0.644428313f, 0.814662278f},
-std::array<float,2>{0.421689332f, 0.935454607f},
-std::array<float,2>{0.532738209f, 0.399764717f},
-std::array<float,2>{0.180515543f, 0.00446327636f},
-std::array<float,2>{0.807617307f, 0.707000613f},
-std::array<float,2>{0.363042086f, 0.641514897f},
-std::array<float,2>{0.688502967f, 0.0980086401f},
-std::array<float,2>{0.0117476005f, 0.467701554f},
-std::array<float,2>{0.959813178f, 0.967333019f},
-std::array<float,2>{0.189906627f, 0.783682823f},
-std::array<float,2>{0.816466331f, 0.365087688f},
-std::array<float,2>{0.473347217f, 0.166446686f},
-std::array<float,2>{0.606613219f, 0.551520348f},
-std::array<float,2>{0.24849534f, 0.543367922f},
-std::array<float,2>{0.868553638f, 0.177884817f},
-std::array<float,2>{0.455524623f, 0.348297387f},
-std::array<float,2>{0.592218816f, 0.804796278f},
-std::array<float,2>{0.317604393f, 0.94370997f},
-std::array<float,2>{0.740907431f, 0.438264728f},
-std::array<float,2>{0.0599142127f, 0.121156335f},
-std::array<float,2>{0.970933497f, 0.632685125f},
-std::array<float,2>{0.402827978f, 0.698198259f},
-std::array<float,2>{0.517752707f, 0.0183841903f},
-std::array<float,2>{0.13573043f, 0.387674719f},
-std::array<float,2>{0.778092206f, 0.912618101f},
-std::array<float,2>{0.114646614f, 0.840253651f},
-std::array<float,2>{0.883554399f, 0.251161844f},
-std::array<float,2>{0.309282362f, 0.249149576f},
-std::array<float,2>{0.656983256f, 0.578573823f},
-std::array<float,2>{0.027760217f, 0.662746727f},
-std::array<float,2>{0.9494102f, 0.0803330317f},
-std::array<float,2>{0.356860608f, 0.489027947f},
-std::array<float,2>{0.708571672f, 0.994805753f},
-std::array<float,2>{0.494342476f, 0.771227539f},
-std::array<float,2>{0.621497452f, 0.31578052f},
-std::array<float,2>{0.212313056f, 0.126061305f},
-std::array<float,2>{0.835946858f, 0.531000078f},
-std::array<float,2>{0.267202705f, 0.599028647f},
-std::array<float,2>{0.638107836f, 0.209191635f},
-std::array<float,2>{0.0740020722f, 0.293193698f},
-std::array<float,2>{0.92861855f, 0.860714138f},
-std::array<float,2>{0.168927655f, 0.895020843f},
-std::array<float,2>{0.782450914f, 0.410724163f},
-std::array<float,2>{0.428479552f, 0.0425450392f},
-std::array<float,2>{0.548861444f, 0.730943561f},
-std::array<float,2>{0.225875258f, 0.693168104f},
-std::array<float,2>{0.848797619f, 0.0235902853f},
-std::array<float,2>{0.448859274f, 0.379925817f},
-std::array<float,2>{0.566807985f, 0.919396758f},
-std::array<float,2>{0.333919436f, 0.832714915f},
-std::array<float,2>{0.727182627f, 0.260037273f},
-std::array<float,2>{0.0423963778f, 0.237186685f},
-std::array<float,2>{0.999715209f, 0.591272295f},
-std::array<float,2>{0.379384935f, 0.53303355f},
-std::array<float,2>{0.504872143f, 0.181893811f},
-std::array<float,2>{0.149824202f, 0.359270394f},
-std::array<float,2>{0.765498638f, 0.804291964f},
-std::array<float,2>{0.101028696f, 0.948359489f},
-std::array<float,2>{0.891359627f, 0.449118793f},
-std::array<float,2>{0.288523972f, 0.116286658f},
-std::array<float,2>{0.677743495f, 0.632981241f},
-std::array<float,2>{0.00866997615f, 0.607869804f},
-std::array<float,2>{0.954168081f, 0.218416736f},
-std::array<float,2>{0.366294563f, 0.28322953f},
-std::array<float,2>{0.693786144f, 0.874573827f},
-std::array<float,2>{0.471825123f, 0.898619056f},
-std::array<float,2>{0.604665577f, 0.417802066f},
-std::array<float,2>{0.191740692f, 0.0355111919f},
-std::array<float,2>{0.815600395f, 0.726099372f},
-std::array<float,2>{0.25252822f, 0.6712479f},
-std::array<float,2>{0.644841313f, 0.0934318677f},
-std::array<float,2>{0.0929945111f, 0.494364351f},
-std::array<float,2>{0.909250557f, 0.98992914f},
-std::array<float,2>{0.183738232f, 0.777011693f},
-std::array<float,2>{0.81102109f, 0.323730588f},
-std::array<float,2>{0.414722592f, 0.134030133f},
-std::array<float,2>{0.538498938f, 0.520194471f},
-std::array<float,2>{0.137576863f, 0.502909541f},
-std::array<float,2>{0.774647415f, 0.1525601f},
-std::array<float,2>{0.398458153f, 0.330128789f},
-std::array<float,2>{0.520269275f, 0.759865344f},
-std::array<float,2>{0.307709455f, 0.984040141f},
-std::array<float,2>{0.661325216f, 0.481732368f},
-std::array<float,2>{0.112097055f, 0.0737198368f},
-std::array<float,2>{0.889541984f, 0.67238307f},
-std::array<float,2>{0.458312809f, 0.741360545f},
-std::array<float,2>{0.586933911f, 0.0565531068f},
-std::array<float,2>{0.242907062f, 0.422788501f},
-std::array<float,2>{0.872872412f, 0.886646569f},
-std::array<float,2>{0.0580841266f, 0.859284163f},
-std::array<float,2>{0.974722445f, 0.29832235f},
-std::array<float,2>{0.314228028f, 0.202348799f},
-std::array<float,2>{0.737821817f, 0.623753548f},
-std::array<float,2>{0.0775729269f, 0.64992708f},
-std::array<float,2>{0.92449373f, 0.1041632f},
-std::array<float,2>{0.272612602f, 0.453131288f},
-std::array<float,2>{0.636646211f, 0.959138572f},
-std::array<float,2>{0.421916753f, 0.792973399f},
-std::array<float,2>{0.554099202f, 0.374667138f},
-std::array<float,2>{0.165367693f, 0.156972215f},
-std::array<float,2>{0.785687566f, 0.555160403f},
-std::array<float,2>{0.354562461f, 0.566177785f},
-std::array<float,2>{0.704628408f, 0.22424905f},
-std::array<float,2>{0.0255145822f, 0.266103715f},
-std::array<float,2>{0.948780179f, 0.82117635f},
-std::array<float,2>{0.216530606f, 0.922566593f},
-std::array<float,2>{0.841703534f, 0.391831279f},
-std::array<float,2>{0.497776508f, 0.0116723981f},
-std::array<float,2>{0.618739843f, 0.715471685f},
-std::array<float,2>{0.16224058f, 0.683792949f},
-std::array<float,2>{0.796388268f, 0.0662404224f},
-std::array<float,2>{0.430228919f, 0.474189252f},
-std::array<float,2>{0.555324435f, 0.976053298f},
-std::array<float,2>{0.278620958f, 0.755669534f},
-std::array<float,2>{0.625927448f, 0.340905815f},
-std::array<float,2>{0.0697140917f, 0.145032153f},
-std::array<float,2>{0.932597399f, 0.512471557f},
-std::array<float,2>{0.487890542f, 0.615389943f},
-std::array<float,2>{0.611249804f, 0.192474291f},
-std::array<float,2>{0.203878552f, 0.305462927f},
-std::array<float,2>{0.829179049f, 0.848393619f},
-std::array<float,2>{0.0214087646f, 0.879224062f},
-std::array<float,2>{0.939689338f, 0.43103379f},
-std::array<float,2>{0.345254928f, 0.0505583249f},
-std::array<float,2>{0.711117625f, 0.745194316f},
-std::array<float,2>{0.120137319f, 0.548209727f},
-std::array<float,2>{0.878196239f, 0.169984967f},
-std::array<float,2>{0.3035146f, 0.359636068f},
-std::array<float,2>{0.666426241f, 0.786708713f},
-std::array<float,2>{0.391599923f, 0.963799477f},
-std::array<float,2>{0.526951849f, 0.46168524f},
-std::array<float,2>{0.132422864f, 0.0959872603f},
-std::array<float,2>{0.765765309f, 0.644637585f},
-std::array<float,2>{0.32698375f, 0.707333922f},
-std::array<float,2>{0.745171249f, 9.27999426e-05f},
-std::array<float,2>{0.0524826571f, 0.403787732f},
-std::array<float,2>{0.977916598f, 0.931126475f},
-std::array<float,2>{0.239040822f, 0.81907475f},
-std::array<float,2>{0.859678149f, 0.274258643f},
-std::array<float,2>{0.462274611f, 0.23266533f},
-std::array<float,2>{0.585032403f, 0.575360894f},
-std::array<float,2>{0.199803621f, 0.583477139f},
-std::array<float,2>{0.821911752f, 0.245365709f},
-std::array<float,2>{0.476597965f, 0.257577479f},
-std::array<float,2>{0.601353884f, 0.837238073f},
-std::array<float,2>{0.36862433f, 0.909866452f},
-std::array<float,2>{0.702364445f, 0.382914305f},
-std::array<float,2>{0.000140031261f, 0.0220382456f},
-std::array<float,2>{0.964826286f, 0.702811122f},
-std::array<float,2>{0.411543727f, 0.627651811f},
-std::array<float,2>{0.544464886f, 0.118715577f},
-std::array<float,2>{0.174361989f, 0.441782027f},
-std::array<float,2>{0.804237247f, 0.939130366f},
-std::array<float,2>{0.0822263807f, 0.811761677f},
-std::array<float,2>{0.917185783f, 0.34667936f},
-std::array<float,2>{0.258719563f, 0.172967687f},
-std::array<float,2>{0.6557917f, 0.542186141f},
-std::array<float,2>{0.0349301472f, 0.726898372f},
-std::array<float,2>{0.991952062f, 0.0431393981f},
-std::array<float,2>{0.341278195f, 0.40976581f},
-std::array<float,2>{0.725741327f, 0.891900539f},
-std::array<float,2>{0.441770554f, 0.864547312f},
-std::array<float,2>{0.573984206f, 0.29281342f},
-std::array<float,2>{0.234037653f, 0.204755157f},
-std::array<float,2>{0.854379714f, 0.596281767f},
-std::array<float,2>{0.289588273f, 0.525303543f},
-std::array<float,2>{0.680859327f, 0.131978199f},
-std::array<float,2>{0.10620705f, 0.319244117f},
-std::array<float,2>{0.905688584f, 0.769285262f},
-std::array<float,2>{0.146044627f, 0.998241961f},
-std::array<float,2>{0.75070101f, 0.486437261f},
-std::array<float,2>{0.385519415f, 0.0854435861f},
-std::array<float,2>{0.513397336f, 0.657091856f},
-std::array<float,2>{0.230146468f, 0.655675173f},
-std::array<float,2>{0.856588066f, 0.10798125f},
-std::array<float,2>{0.44064638f, 0.459362715f},
-std::array<float,2>{0.575712264f, 0.955661058f},
-std::array<float,2>{0.336459994f, 0.790455937f},
-std::array<float,2>{0.719521999f, 0.370935678f},
-std::array<float,2>{0.0362308808f, 0.163618311f},
-std::array<float,2>{0.985455811f, 0.561159432f},
-std::array<float,2>{0.389527768f, 0.569837153f},
-std::array<float,2>{0.510310233f, 0.218979165f},
-std::array<float,2>{0.14175877f, 0.2702685f},
-std::array<float,2>{0.755411863f, 0.827031434f},
-std::array<float,2>{0.10270647f, 0.92626822f},
-std::array<float,2>{0.89888972f, 0.396610558f},
-std::array<float,2>{0.295212328f, 0.0147238448f},
-std::array<float,2>{0.686515868f, 0.713109195f},
-std::array<float,2>{0.00580977136f, 0.504631698f},
-std::array<float,2>{0.96505022f, 0.152290344f},
-std::array<float,2>{0.374612957f, 0.332982242f},
-std::array<float,2>{0.695590913f, 0.764268756f},
-std::array<float,2>{0.483901411f, 0.978720248f},
-std::array<float,2>{0.595422387f, 0.480375886f},
-std::array<float,2>{0.198824972f, 0.0756744817f},
-std::array<float,2>{0.82777226f, 0.677306235f},
-std::array<float,2>{0.263176173f, 0.738057137f},
-std::array<float,2>{0.652047992f, 0.0603865944f},
-std::array<float,2>{0.0797294974f, 0.426374614f},
-std::array<float,2>{0.919313788f, 0.887309968f},
-std::array<float,2>{0.178739071f, 0.854747295f},
-std::array<float,2>{0.798882961f, 0.303983063f},
-std::array<float,2>{0.407805026f, 0.197804213f},
-std::array<float,2>{0.539909542f, 0.61934489f},
-std::array<float,2>{0.125382885f, 0.605092347f},
-std::array<float,2>{0.773308635f, 0.212934315f},
-std::array<float,2>{0.397598475f, 0.286247015f},
-std::array<float,2>{0.531069398f, 0.870726287f},
-std::array<float,2>{0.297732204f, 0.904729545f},
-std::array<float,2>{0.668886125f, 0.419334859f},
-std::array<float,2>{0.123528317f, 0.0337864459f},
-std::array<float,2>{0.879627943f, 0.71897918f},
-std::array<float,2>{0.46757555f, 0.667271197f},
-std::array<float,2>{0.5801754f, 0.0872115195f},
-std::array<float,2>{0.236366153f, 0.498766363f},
-std::array<float,2>{0.864389956f, 0.985979378f},
-std::array<float,2>{0.0497898273f, 0.779492855f},
-std::array<float,2>{0.982442737f, 0.327520132f},
-std::array<float,2>{0.321832836f, 0.137622014f},
-std::array<float,2>{0.749777257f, 0.51828289f},
-std::array<float,2>{0.0641239658f, 0.691324234f},
-std::array<float,2>{0.934856892f, 0.0310417823f},
-std::array<float,2>{0.273913622f, 0.375533819f},
-std::array<float,2>{0.632489622f, 0.915222764f},
-std::array<float,2>{0.43608892f, 0.831709683f},
-std::array<float,2>{0.561916292f, 0.264407098f},
-std::array<float,2>{0.158825427f, 0.241782874f},
-std::array<float,2>{0.792816699f, 0.588552117f},
-std::array<float,2>{0.348699361f, 0.537325501f},
-std::array<float,2>{0.718397319f, 0.187346607f},
-std::array<float,2>{0.0169294402f, 0.353862554f},
-std::array<float,2>{0.943673134f, 0.79898566f},
-std::array<float,2>{0.207936034f, 0.95282805f},
-std::array<float,2>{0.834913254f, 0.450105786f},
-std::array<float,2>{0.490480125f, 0.112580694f},
-std::array<float,2>{0.61556685f, 0.639440775f},
-std::array<float,2>{0.170257583f, 0.731509507f},
-std::array<float,2>{0.784669101f, 0.0411635377f},
-std::array<float,2>{0.425988227f, 0.411366105f},
-std::array<float,2>{0.548325837f, 0.895812988f},
-std::array<float,2>{0.268703252f, 0.859580517f},
-std::array<float,2>{0.640038073f, 0.294548064f},
-std::array<float,2>{0.070317857f, 0.210352287f},
-std::array<float,2>{0.926387191f, 0.597743034f},
-std::array<float,2>{0.492355675f, 0.52935046f},
-std::array<float,2>{0.623724699f, 0.125198022f},
-std::array<float,2>{0.214259088f, 0.315241039f},
-std::array<float,2>{0.8396191f, 0.770412683f},
-std::array<float,2>{0.0301261377f, 0.995850205f},
-std::array<float,2>{0.952754796f, 0.49021548f},
-std::array<float,2>{0.358805895f, 0.0813464746f},
-std::array<float,2>{0.709709764f, 0.663946807f},
-std::array<float,2>{0.115271091f, 0.580004811f},
-std::array<float,2>{0.885216355f, 0.248770669f},
-std::array<float,2>{0.311456442f, 0.250147998f},
-std::array<float,2>{0.658744156f, 0.840963125f},
-std::array<float,2>{0.405410916f, 0.913659871f},
-std::array<float,2>{0.517258346f, 0.388281643f},
-std::array<float,2>{0.133952558f, 0.018593885f},
-std::array<float,2>{0.779517472f, 0.698371947f},
-std::array<float,2>{0.318868518f, 0.630995095f},
-std::array<float,2>{0.739932299f, 0.122766405f},
-std::array<float,2>{0.0610325113f, 0.438799948f},
-std::array<float,2>{0.970687687f, 0.945127189f},
-std::array<float,2>{0.24617061f, 0.805923998f},
-std::array<float,2>{0.87043941f, 0.349366605f},
-std::array<float,2>{0.453125685f, 0.179671809f},
-std::array<float,2>{0.590239465f, 0.544775903f},
-std::array<float,2>{0.188515797f, 0.552467525f},
-std::array<float,2>{0.819199264f, 0.167699084f},
-std::array<float,2>{0.476102978f, 0.363780349f},
-std::array<float,2>{0.608676195f, 0.784750402f},
-std::array<float,2>{0.361090988f, 0.968660891f},
-std::array<float,2>{0.691242099f, 0.468285918f},
-std::array<float,2>{0.0149197057f, 0.0991263464f},
-std::array<float,2>{0.957366705f, 0.642438531f},
-std::array<float,2>{0.419512868f, 0.706019998f},
-std::array<float,2>{0.534661353f, 0.00501329591f},
-std::array<float,2>{0.181814328f, 0.398976326f},
-std::array<float,2>{0.805026829f, 0.933838427f},
-std::array<float,2>{0.0891178399f, 0.815652609f},
-std::array<float,2>{0.912516057f, 0.277799904f},
-std::array<float,2>{0.254995525f, 0.228654131f},
-std::array<float,2>{0.640639305f, 0.570337117f},
-std::array<float,2>{0.043703828f, 0.683538973f},
-std::array<float,2>{0.995652676f, 0.0690143406f},
-std::array<float,2>{0.330330491f, 0.470141232f},
-std::array<float,2>{0.730477929f, 0.970216691f},
-std::array<float,2>{0.451486588f, 0.750374734f},
-std::array<float,2>{0.565521359f, 0.337956607f},
-std::array<float,2>{0.222058743f, 0.143818885f},
-std::array<float,2>{0.847434282f, 0.508666456f},
-std::array<float,2>{0.281263411f, 0.61104852f},
-std::array<float,2>{0.675314307f, 0.191180795f},
-std::array<float,2>{0.0953644663f, 0.310836822f},
-std::array<float,2>{0.896550775f, 0.846256673f},
-std::array<float,2>{0.156235814f, 0.878715575f},
-std::array<float,2>{0.758527279f, 0.434693098f},
-std::array<float,2>{0.37730664f, 0.0507924967f},
-std::array<float,2>{0.503611445f, 0.749900877f},
-std::array<float,2>{0.217185423f, 0.716062963f},
-std::array<float,2>{0.84235847f, 0.010534429f},
-std::array<float,2>{0.499270499f, 0.39127931f},
-std::array<float,2>{0.620178163f, 0.923252583f},
-std::array<float,2>{0.352960229f, 0.82214725f},
-std::array<float,2>{0.706713736f, 0.267486304f},
-std::array<float,2>{0.0250568725f, 0.22318016f},
-std::array<float,2>{0.945628464f, 0.565195322f},
-std::array<float,2>{0.423946798f, 0.556284964f},
-std::array<float,2>{0.552203715f, 0.157388762f},
-std::array<float,2>{0.166940913f, 0.37347877f},
-std::array<float,2>{0.787198484f, 0.794371605f},
-std::array<float,2>{0.0745201632f, 0.96050626f},
-std::array<float,2>{0.92252022f, 0.454371095f},
-std::array<float,2>{0.270360678f, 0.10514918f},
-std::array<float,2>{0.634500861f, 0.648495913f},
-std::array<float,2>{0.0553506017f, 0.624916613f},
-std::array<float,2>{0.973159015f, 0.202060372f},
-std::array<float,2>{0.315724075f, 0.297751635f},
-std::array<float,2>{0.735368967f, 0.857974887f},
-std::array<float,2>{0.460255086f, 0.88516897f},
-std::array<float,2>{0.587970018f, 0.423128605f},
-std::array<float,2>{0.245472997f, 0.055501435f},
-std::array<float,2>{0.873352766f, 0.74089396f},
-std::array<float,2>{0.304932922f, 0.673797369f},
-std::array<float,2>{0.662938654f, 0.0728783011f},
-std::array<float,2>{0.109491691f, 0.481341094f},
-std::array<float,2>{0.887783587f, 0.982736707f},
-std::array<float,2>{0.140413299f, 0.76102519f},
-std::array<float,2>{0.775638461f, 0.331760406f},
-std::array<float,2>{0.401183426f, 0.15389733f},
-std::array<float,2>{0.522108436f, 0.503884792f},
-std::array<float,2>{0.186776772f, 0.520790517f},
-std::array<float,2>{0.810269952f, 0.133721575f},
-std::array<float,2>{0.416696876f, 0.322373003f},
-std::array<float,2>{0.536600411f, 0.775592446f},
-std::array<float,2>{0.25016284f, 0.988467276f},
-std::array<float,2>{0.64762646f, 0.495574474f},
-std::array<float,2>{0.0912163556f, 0.091953367f},
-std::array<float,2>{0.907948911f, 0.67013979f},
-std::array<float,2>{0.468841225f, 0.724692702f},
-std::array<float,2>{0.602134883f, 0.0364323482f},
-std::array<float,2>{0.195121631f, 0.416116178f},
-std::array<float,2>{0.81412667f, 0.900331497f},
-std::array<float,2>{0.011177687f, 0.873052955f},
-std::array<float,2>{0.95662874f, 0.284453571f},
-std::array<float,2>{0.3641662f, 0.217337325f},
-std::array<float,2>{0.69328028f, 0.608865499f},
-std::array<float,2>{0.0985314548f, 0.634413481f},
-std::array<float,2>{0.893369257f, 0.115967833f},
-std::array<float,2>{0.287098914f, 0.447314233f},
-std::array<float,2>{0.676486313f, 0.947767377f},
-std::array<float,2>{0.382754773f, 0.802784622f},
-std::array<float,2>{0.507734597f, 0.357941896f},
-std::array<float,2>{0.15113613f, 0.182825163f},
-std::array<float,2>{0.763469279f, 0.531621754f},
-std::array<float,2>{0.335665077f, 0.590735018f},
-std::array<float,2>{0.730101407f, 0.237338245f},
-std::array<float,2>{0.0406301916f, 0.261346549f},
-std::array<float,2>{0.99778682f, 0.833348691f},
-std::array<float,2>{0.222796023f, 0.918816566f},
-std::array<float,2>{0.850563169f, 0.379049867f},
-std::array<float,2>{0.446876794f, 0.0249324311f},
-std::array<float,2>{0.569124639f, 0.691581011f},
-std::array<float,2>{0.147745073f, 0.657599747f},
-std::array<float,2>{0.753039539f, 0.084735319f},
-std::array<float,2>{0.384373963f, 0.488072246f},
-std::array<float,2>{0.515356839f, 0.999739408f},
-std::array<float,2>{0.291929275f, 0.768023312f},
-std::array<float,2>{0.682621419f, 0.320302784f},
-std::array<float,2>{0.107447512f, 0.131017834f},
-std::array<float,2>{0.903858185f, 0.524209142f},
-std::array<float,2>{0.444121718f, 0.597544909f},
-std::array<float,2>{0.571080744f, 0.203986958f},
-std::array<float,2>{0.230661556f, 0.291465193f},
-std::array<float,2>{0.852673173f, 0.863595903f},
-std::array<float,2>{0.0320909508f, 0.891489089f},
-std::array<float,2>{0.9895432f, 0.40834856f},
-std::array<float,2>{0.342728317f, 0.0440736338f},
-std::array<float,2>{0.723043859f, 0.727893889f},
-std::array<float,2>{0.0850307122f, 0.541577578f},
-std::array<float,2>{0.915123999f, 0.172295734f},
-std::array<float,2>{0.260442466f, 0.347605616f},
-std::array<float,2>{0.653695822f, 0.811086416f},
-std::array<float,2>{0.412641615f, 0.938301265f},
-std::array<float,2>{0.54581809f, 0.442550212f},
-std::array<float,2>{0.173255324f, 0.117781632f},
-std::array<float,2>{0.801804662f, 0.628869951f},
-std::array<float,2>{0.369626343f, 0.701549053f},
-std::array<float,2>{0.699400723f, 0.0228157304f},
-std::array<float,2>{0.00313464226f, 0.384427905f},
-std::array<float,2>{0.961017728f, 0.908509135f},
-std::array<float,2>{0.201719627f, 0.83609128f},
-std::array<float,2>{0.823770463f, 0.25659734f},
-std::array<float,2>{0.478783101f, 0.244616345f},
-std::array<float,2>{0.599225819f, 0.582794964f},
-std::array<float,2>{0.241983294f, 0.574574649f},
-std::array<float,2>{0.861957729f, 0.233464867f},
-std::array<float,2>{0.464229822f, 0.275227666f},
-std::array<float,2>{0.582674861f, 0.820040762f},
-std::array<float,2>{0.325698406f, 0.930485547f},
-std::array<float,2>{0.744105458f, 0.402688235f},
-std::array<float,2>{0.054068625f, 0.00158989127f},
-std::array<float,2>{0.980163395f, 0.708051026f},
-std::array<float,2>{0.393797725f, 0.646155536f},
-std::array<float,2>{0.524999499f, 0.0975034609f},
-std::array<float,2>{0.129714832f, 0.462630063f},
-std::array<float,2>{0.76794517f, 0.964174092f},
-std::array<float,2>{0.11912968f, 0.785498381f},
-std::array<float,2>{0.876056015f, 0.361240655f},
-std::array<float,2>{0.301442295f, 0.171556696f},
-std::array<float,2>{0.666009247f, 0.547842264f},
-std::array<float,2>{0.0232047644f, 0.744676888f},
-std::array<float,2>{0.938897967f, 0.0489675254f},
-std::array<float,2>{0.347337276f, 0.430341482f},
-std::array<float,2>{0.714829266f, 0.880468488f},
-std::array<float,2>{0.485853374f, 0.849393904f},
-std::array<float,2>{0.611406028f, 0.306013823f},
-std::array<float,2>{0.206859946f, 0.192167312f},
-std::array<float,2>{0.830551744f, 0.616350591f},
-std::array<float,2>{0.279940784f, 0.513315797f},
-std::array<float,2>{0.628575563f, 0.145552024f},
-std::array<float,2>{0.0682500601f, 0.339902818f},
-std::array<float,2>{0.929837823f, 0.754598379f},
-std::array<float,2>{0.160960868f, 0.9755615f},
-std::array<float,2>{0.793602288f, 0.472684979f},
-std::array<float,2>{0.433560938f, 0.0653073415f},
-std::array<float,2>{0.558574796f, 0.685330451f},
-std::array<float,2>{0.196072385f, 0.678811073f},
-std::array<float,2>{0.825030506f, 0.076401405f},
-std::array<float,2>{0.481984764f, 0.478042513f},
-std::array<float,2>{0.596081734f, 0.978266835f},
-std::array<float,2>{0.371390581f, 0.761820018f},
-std::array<float,2>{0.698566556f, 0.334183723f},
-std::array<float,2>{0.00656726537f, 0.148512483f},
-std::array<float,2>{0.96801126f, 0.507120371f},
-std::array<float,2>{0.408884078f, 0.617282867f},
-std::array<float,2>{0.542538524f, 0.195563257f},
-std::array<float,2>{0.176414251f, 0.301485538f},
-std::array<float,2>{0.797678292f, 0.853499532f},
-std::array<float,2>{0.0813221782f, 0.889256001f},
-std::array<float,2>{0.921051919f, 0.428862721f},
-std::array<float,2>{0.264849514f, 0.0605711117f},
-std::array<float,2>{0.6487059f, 0.734549165f},
-std::array<float,2>{0.0382856876f, 0.559653044f},
-std::array<float,2>{0.988074958f, 0.160431758f},
-std::array<float,2>{0.339509606f, 0.36761117f},
-std::array<float,2>{0.72242415f, 0.792121887f},
-std::array<float,2>{0.437919885f, 0.953513861f},
-std::array<float,2>{0.576583505f, 0.458370298f},
-std::array<float,2>{0.228227869f, 0.105587475f},
-std::array<float,2>{0.857540429f, 0.653590202f},
-std::array<float,2>{0.293969065f, 0.71233654f},
-std::array<float,2>{0.685316026f, 0.0130357472f},
-std::array<float,2>{0.105044603f, 0.395933926f},
-std::array<float,2>{0.902189553f, 0.927849829f},
-std::array<float,2>{0.143050373f, 0.825788617f},
-std::array<float,2>{0.756389916f, 0.273017853f},
-std::array<float,2>{0.386770785f, 0.22141917f},
-std::array<float,2>{0.509210348f, 0.566761971f},
-std::array<float,2>{0.156464413f, 0.587225676f},
-std::array<float,2>{0.790579498f, 0.239118978f},
-std::array<float,2>{0.435371727f, 0.26280275f},
-std::array<float,2>{0.560103834f, 0.829787374f},
-std::array<float,2>{0.275702655f, 0.916782618f},
-std::array<float,2>{0.630093992f, 0.377099186f},
-std::array<float,2>{0.0654430389f, 0.0274331588f},
-std::array<float,2>{0.936745107f, 0.687787294f},
-std::array<float,2>{0.488481522f, 0.638193309f},
-std::array<float,2>{0.613563061f, 0.109758101f},
-std::array<float,2>{0.210934982f, 0.451720685f},
-std::array<float,2>{0.83281672f, 0.950689733f},
-std::array<float,2>{0.0180686917f, 0.797086716f},
-std::array<float,2>{0.941708624f, 0.352183551f},
-std::array<float,2>{0.351403624f, 0.184451878f},
-std::array<float,2>{0.714985311f, 0.536561847f},
-std::array<float,2>{0.121562436f, 0.720835745f},
-std::array<float,2>{0.881833792f, 0.0327960029f},
-std::array<float,2>{0.299224049f, 0.420522511f},
-std::array<float,2>{0.670052588f, 0.90400064f},
-std::array<float,2>{0.394755512f, 0.868375778f},
-std::array<float,2>{0.528928936f, 0.288711399f},
-std::array<float,2>{0.1270051f, 0.211647034f},
-std::array<float,2>{0.769550741f, 0.602517664f},
-std::array<float,2>{0.32256338f, 0.517482698f},
-std::array<float,2>{0.747890711f, 0.139034018f},
-std::array<float,2>{0.0479251184f, 0.326157957f},
-std::array<float,2>{0.981973588f, 0.777979732f},
-std::array<float,2>{0.235977292f, 0.986911654f},
-std::array<float,2>{0.865383923f, 0.497808397f},
-std::array<float,2>{0.465813249f, 0.0890639648f},
-std::array<float,2>{0.578443706f, 0.664135933f},
-std::array<float,2>{0.135773867f, 0.695908248f},
-std::array<float,2>{0.779264688f, 0.0165143851f},
-std::array<float,2>{0.403646797f, 0.389214367f},
-std::array<float,2>{0.519138396f, 0.911019564f},
-std::array<float,2>{0.30958727f, 0.842112839f},
-std::array<float,2>{0.657824874f, 0.252615392f},
-std::array<float,2>{0.114013985f, 0.246609822f},
-std::array<float,2>{0.884432733f, 0.580791175f},
-std::array<float,2>{0.456790894f, 0.545014977f},
-std::array<float,2>{0.593073905f, 0.176487595f},
-std::array<float,2>{0.249939337f, 0.350244939f},
-std::array<float,2>{0.86724627f, 0.807570338f},
-std::array<float,2>{0.0586690828f, 0.941733658f},
-std::array<float,2>{0.972521603f, 0.43956542f},
-std::array<float,2>{0.316883147f, 0.124933764f},
-std::array<float,2>{0.741640031f, 0.629659653f},
-std::array<float,2>{0.0727683827f, 0.600257754f},
-std::array<float,2>{0.929183483f, 0.207497135f},
-std::array<float,2>{0.26620245f, 0.294986933f},
-std::array<float,2>{0.637401998f, 0.862582505f},
-std::array<float,2>{0.429297477f, 0.896944106f},
-std::array<float,2>{0.550261021f, 0.413916647f},
-std::array<float,2>{0.169388801f, 0.0399505645f},
-std::array<float,2>{0.781343102f, 0.734327972f},
-std::array<float,2>{0.355538905f, 0.660200715f},
-std::array<float,2>{0.707034588f, 0.0798288882f},
-std::array<float,2>{0.029241953f, 0.491437316f},
-std::array<float,2>{0.950432837f, 0.993172526f},
-std::array<float,2>{0.211876392f, 0.77199012f},
-std::array<float,2>{0.837028086f, 0.312599003f},
-std::array<float,2>{0.495599568f, 0.128752515f},
-std::array<float,2>{0.622785509f, 0.52788049f},
-std::array<float,2>{0.21951519f, 0.51147908f},
-std::array<float,2>{0.845642805f, 0.142469943f},
-std::array<float,2>{0.449318469f, 0.336179078f},
-std::array<float,2>{0.56333679f, 0.75357914f},
-std::array<float,2>{0.329685569f, 0.970750451f},
-std::array<float,2>{0.734157622f, 0.472357541f},
-std::array<float,2>{0.0454699695f, 0.0677661672f},
-std::array<float,2>{0.9932459f, 0.679977357f},
-std::array<float,2>{0.375451684f, 0.746347964f},
-std::array<float,2>{0.500826418f, 0.0539359748f},
-std::array<float,2>{0.153788328f, 0.437360585f},
-std::array<float,2>{0.760909677f, 0.875892222f},
-std::array<float,2>{0.0969813392f, 0.845288575f},
-std::array<float,2>{0.894735336f, 0.310153842f},
-std::array<float,2>{0.284078866f, 0.18883884f},
-std::array<float,2>{0.672360718f, 0.611925304f},
-std::array<float,2>{0.0129328892f, 0.644403815f},
-std::array<float,2>{0.960846364f, 0.0997079164f},
-std::array<float,2>{0.361938924f, 0.466212571f},
-std::array<float,2>{0.68768245f, 0.966130614f},
-std::array<float,2>{0.473962396f, 0.782563746f},
-std::array<float,2>{0.605662286f, 0.366315305f},
-std::array<float,2>{0.190898612f, 0.164905384f},
-std::array<float,2>{0.81813848f, 0.553492129f},
-std::array<float,2>{0.256086141f, 0.572918236f},
-std::array<float,2>{0.643455088f, 0.226974919f},
-std::array<float,2>{0.0872154608f, 0.280305684f},
-std::array<float,2>{0.91047585f, 0.813328505f},
-std::array<float,2>{0.181112275f, 0.937464714f},
-std::array<float,2>{0.806790173f, 0.401643276f},
-std::array<float,2>{0.420090914f, 0.00704197073f},
-std::array<float,2>{0.531859994f, 0.703352153f},
-std::array<float,2>{0.243430018f, 0.739431143f},
-std::array<float,2>{0.871508539f, 0.0572723933f},
-std::array<float,2>{0.457173765f, 0.424929798f},
-std::array<float,2>{0.5863747f, 0.88408488f},
-std::array<float,2>{0.313040257f, 0.856799126f},
-std::array<float,2>{0.73698175f, 0.299679279f},
-std::array<float,2>{0.0570525341f, 0.200454414f},
-std::array<float,2>{0.975712061f, 0.621324778f},
-std::array<float,2>{0.39959541f, 0.501608849f},
-std::array<float,2>{0.521038711f, 0.154441923f},
-std::array<float,2>{0.137805909f, 0.328739464f},
-std::array<float,2>{0.774164796f, 0.759585083f},
-std::array<float,2>{0.112465642f, 0.981894851f},
-std::array<float,2>{0.890246212f, 0.483252734f},
-std::array<float,2>{0.307033181f, 0.0719582438f},
-std::array<float,2>{0.660269558f, 0.673835635f},
-std::array<float,2>{0.0271879397f, 0.563736081f},
-std::array<float,2>{0.947459042f, 0.225691229f},
-std::array<float,2>{0.35379675f, 0.268440336f},
-std::array<float,2>{0.70380795f, 0.822725654f},
-std::array<float,2>{0.496105433f, 0.924498558f},
-std::array<float,2>{0.618012547f, 0.393150389f},
-std::array<float,2>{0.214958534f, 0.00821239874f},
-std::array<float,2>{0.840566039f, 0.717011452f},
-std::array<float,2>{0.271753728f, 0.650957763f},
-std::array<float,2>{0.635644734f, 0.101585925f},
-std::array<float,2>{0.0763041899f, 0.456865728f},
-std::array<float,2>{0.925032079f, 0.958498895f},
-std::array<float,2>{0.164122328f, 0.796166062f},
-std::array<float,2>{0.786620975f, 0.372195899f},
-std::array<float,2>{0.422861964f, 0.158448651f},
-std::array<float,2>{0.553354979f, 0.558294058f},
-std::array<float,2>{0.149280488f, 0.533971429f},
-std::array<float,2>{0.76407969f, 0.18118836f},
-std::array<float,2>{0.380473614f, 0.35709998f},
-std::array<float,2>{0.505786777f, 0.801101387f},
-std::array<float,2>{0.287680328f, 0.947242618f},
-std::array<float,2>{0.679492116f, 0.446411997f},
-std::array<float,2>{0.100540243f, 0.11337319f},
-std::array<float,2>{0.891701043f, 0.635008276f},
-std::array<float,2>{0.447918773f, 0.694914997f},
-std::array<float,2>{0.5674721f, 0.0272271615f},
-std::array<float,2>{0.225401729f, 0.382413834f},
-std::array<float,2>{0.848035753f, 0.921135366f},
-std::array<float,2>{0.0412309505f, 0.835246086f},
-std::array<float,2>{0.998777807f, 0.259120226f},
-std::array<float,2>{0.332511485f, 0.23598887f},
-std::array<float,2>{0.727830291f, 0.593203008f},
-std::array<float,2>{0.0918808281f, 0.668655336f},
-std::array<float,2>{0.908881485f, 0.0900118724f},
-std::array<float,2>{0.253523827f, 0.493000805f},
-std::array<float,2>{0.645767093f, 0.991639435f},
-std::array<float,2>{0.415897578f, 0.775013626f},
-std::array<float,2>{0.537426293f, 0.320578516f},
-std::array<float,2>{0.184942082f, 0.134826019f},
-std::array<float,2>{0.811969459f, 0.522696316f},
-std::array<float,2>{0.365378559f, 0.607069373f},
-std::array<float,2>{0.694855869f, 0.215354532f},
-std::array<float,2>{0.00933389366f, 0.283023655f},
-std::array<float,2>{0.95364821f, 0.872068226f},
-std::array<float,2>{0.193083256f, 0.902294993f},
-std::array<float,2>{0.814831674f, 0.415894955f},
-std::array<float,2>{0.471648842f, 0.0382702313f},
-std::array<float,2>{0.603718877f, 0.722780883f},
-std::array<float,2>{0.174850121f, 0.625973046f},
-std::array<float,2>{0.803686917f, 0.120983034f},
-std::array<float,2>{0.410659313f, 0.444760948f},
-std::array<float,2>{0.54308182f, 0.940457284f},
-std::array<float,2>{0.259753883f, 0.809534371f},
-std::array<float,2>{0.654800832f, 0.343996793f},
-std::array<float,2>{0.0835087001f, 0.174937993f},
-std::array<float,2>{0.916030824f, 0.539651334f},
-std::array<float,2>{0.477896929f, 0.585464239f},
-std::array<float,2>{0.600105286f, 0.243899748f},
-std::array<float,2>{0.201033309f, 0.255109072f},
-std::array<float,2>{0.821150064f, 0.838276148f},
-std::array<float,2>{0.000998443342f, 0.907549381f},
-std::array<float,2>{0.963186204f, 0.384926826f},
-std::array<float,2>{0.367794544f, 0.0210094508f},
-std::array<float,2>{0.701696873f, 0.700373352f},
-std::array<float,2>{0.107214339f, 0.526676178f},
-std::array<float,2>{0.904672444f, 0.128939524f},
-std::array<float,2>{0.290735841f, 0.317088425f},
-std::array<float,2>{0.680262625f, 0.767068148f},
-std::array<float,2>{0.38658908f, 0.996895671f},
-std::array<float,2>{0.51187104f, 0.485656857f},
-std::array<float,2>{0.14519915f, 0.0830407813f},
-std::array<float,2>{0.751159132f, 0.659108698f},
-std::array<float,2>{0.340627939f, 0.728536725f},
-std::array<float,2>{0.725406766f, 0.0452662334f},
-std::array<float,2>{0.0334797762f, 0.408174485f},
-std::array<float,2>{0.990465581f, 0.893333614f},
-std::array<float,2>{0.232693762f, 0.866991282f},
-std::array<float,2>{0.854916036f, 0.290088981f},
-std::array<float,2>{0.442846835f, 0.20663403f},
-std::array<float,2>{0.572570622f, 0.595276773f},
-std::array<float,2>{0.204918087f, 0.614333689f},
-std::array<float,2>{0.828592122f, 0.193759352f},
-std::array<float,2>{0.486790836f, 0.306925297f},
-std::array<float,2>{0.609907985f, 0.850890756f},
-std::array<float,2>{0.344338715f, 0.880944669f},
-std::array<float,2>{0.712684155f, 0.433437318f},
-std::array<float,2>{0.0202679597f, 0.0487974584f},
-std::array<float,2>{0.941289902f, 0.742784739f},
-std::array<float,2>{0.431632936f, 0.687206984f},
-std::array<float,2>{0.556430757f, 0.0626797974f},
-std::array<float,2>{0.163749218f, 0.475559711f},
-std::array<float,2>{0.795133233f, 0.974458754f},
-std::array<float,2>{0.0684585869f, 0.756871641f},
-std::array<float,2>{0.933447242f, 0.342130005f},
-std::array<float,2>{0.277610749f, 0.146640643f},
-std::array<float,2>{0.626033008f, 0.514187455f},
-std::array<float,2>{0.0514555499f, 0.70957756f},
-std::array<float,2>{0.976593316f, 0.00205994537f},
-std::array<float,2>{0.327709556f, 0.405808836f},
-std::array<float,2>{0.744414687f, 0.932453513f},
-std::array<float,2>{0.461824745f, 0.81765765f},
-std::array<float,2>{0.584211409f, 0.277054161f},
-std::array<float,2>{0.239782944f, 0.230796561f},
-std::array<float,2>{0.861320078f, 0.578045666f},
-std::array<float,2>{0.304384679f, 0.550156116f},
-std::array<float,2>{0.667102993f, 0.16865851f},
-std::array<float,2>{0.119976893f, 0.361614674f},
-std::array<float,2>{0.876975298f, 0.788985193f},
-std::array<float,2>{0.131575748f, 0.960962534f},
-std::array<float,2>{0.76717186f, 0.463949353f},
-std::array<float,2>{0.391667038f, 0.0955834091f},
-std::array<float,2>{0.526038826f, 0.647622228f},
-std::array<float,2>{0.22220318f, 0.680656075f},
-std::array<float,2>{0.84704423f, 0.0680104122f},
-std::array<float,2>{0.451883733f, 0.471742898f},
-std::array<float,2>{0.566335261f, 0.971216917f},
-std::array<float,2>{0.331054002f, 0.753032863f},
-std::array<float,2>{0.731130421f, 0.336868405f},
-std::array<float,2>{0.043172814f, 0.142059103f},
-std::array<float,2>{0.995591581f, 0.510987878f},
-std::array<float,2>{0.377597511f, 0.611691654f},
-std::array<float,2>{0.503005922f, 0.189260378f},
-std::array<float,2>{0.155696467f, 0.309835851f},
-std::array<float,2>{0.758152723f, 0.844819367f},
-std::array<float,2>{0.0949378088f, 0.875351608f},
-std::array<float,2>{0.897289395f, 0.436996311f},
-std::array<float,2>{0.282128692f, 0.0546347909f},
-std::array<float,2>{0.674882889f, 0.746826053f},
-std::array<float,2>{0.0155194169f, 0.552848935f},
-std::array<float,2>{0.957653582f, 0.164138839f},
-std::array<float,2>{0.360535115f, 0.36698094f},
-std::array<float,2>{0.690511048f, 0.78276825f},
-std::array<float,2>{0.475766718f, 0.966325402f},
-std::array<float,2>{0.609302402f, 0.466551751f},
-std::array<float,2>{0.189290538f, 0.100526549f},
-std::array<float,2>{0.818758667f, 0.644019842f},
-std::array<float,2>{0.255696386f, 0.703948855f},
-std::array<float,2>{0.641129732f, 0.00735004013f},
-std::array<float,2>{0.0895835012f, 0.401869386f},
-std::array<float,2>{0.912633777f, 0.936896503f},
-std::array<float,2>{0.182562813f, 0.812749863f},
-std::array<float,2>{0.805203676f, 0.280765653f},
-std::array<float,2>{0.419026792f, 0.227466494f},
-std::array<float,2>{0.5349015f, 0.572514236f},
-std::array<float,2>{0.134714499f, 0.580305994f},
-std::array<float,2>{0.7800017f, 0.246267527f},
-std::array<float,2>{0.40594241f, 0.252247006f},
-std::array<float,2>{0.516986072f, 0.842728436f},
-std::array<float,2>{0.310757428f, 0.910338581f},
-std::array<float,2>{0.65855217f, 0.389145702f},
-std::array<float,2>{0.115872711f, 0.0158712789f},
-std::array<float,2>{0.885435879f, 0.695377827f},
-std::array<float,2>{0.454015374f, 0.629011333f},
-std::array<float,2>{0.590598047f, 0.124299638f},
-std::array<float,2>{0.246684536f, 0.44005689f},
-std::array<float,2>{0.870896935f, 0.941928089f},
-std::array<float,2>{0.0614932775f, 0.807112336f},
-std::array<float,2>{0.970213473f, 0.349655062f},
-std::array<float,2>{0.318777531f, 0.176074311f},
-std::array<float,2>{0.739386976f, 0.545794129f},
-std::array<float,2>{0.0709241927f, 0.733614802f},
-std::array<float,2>{0.925984204f, 0.0393620543f},
-std::array<float,2>{0.269391298f, 0.413552642f},
-std::array<float,2>{0.640295029f, 0.897414565f},
-std::array<float,2>{0.426457435f, 0.862900436f},
-std::array<float,2>{0.548462987f, 0.295669198f},
-std::array<float,2>{0.170702666f, 0.207573205f},
-std::array<float,2>{0.784281731f, 0.599691868f},
-std::array<float,2>{0.359045535f, 0.527620077f},
-std::array<float,2>{0.709109128f, 0.12838079f},
-std::array<float,2>{0.0293972455f, 0.313088655f},
-std::array<float,2>{0.952623904f, 0.771491706f},
-std::array<float,2>{0.214404345f, 0.99390322f},
-std::array<float,2>{0.839002967f, 0.491798282f},
-std::array<float,2>{0.492707998f, 0.0793347582f},
-std::array<float,2>{0.623234272f, 0.660704494f},
-std::array<float,2>{0.158382058f, 0.688223481f},
-std::array<float,2>{0.792177141f, 0.0279260315f},
-std::array<float,2>{0.435729533f, 0.377456456f},
-std::array<float,2>{0.56204772f, 0.916385531f},
-std::array<float,2>{0.274103254f, 0.829518974f},
-std::array<float,2>{0.632175624f, 0.263264894f},
-std::array<float,2>{0.0636083037f, 0.238595799f},
-std::array<float,2>{0.935466826f, 0.587654889f},
-std::array<float,2>{0.490778238f, 0.536937952f},
-std::array<float,2>{0.615945101f, 0.183756217f},
-std::array<float,2>{0.207489938f, 0.35197717f},
-std::array<float,2>{0.834319293f, 0.797529757f},
-std::array<float,2>{0.0170957223f, 0.950630963f},
-std::array<float,2>{0.944291294f, 0.451380938f},
-std::array<float,2>{0.349241585f, 0.110117525f},
-std::array<float,2>{0.718142152f, 0.637716353f},
-std::array<float,2>{0.123983912f, 0.601859868f},
-std::array<float,2>{0.87933439f, 0.211196914f},
-std::array<float,2>{0.297314376f, 0.288513929f},
-std::array<float,2>{0.668217719f, 0.868922651f},
-std::array<float,2>{0.398241192f, 0.90355128f},
-std::array<float,2>{0.530457854f, 0.420239687f},
-std::array<float,2>{0.125957176f, 0.0326295458f},
-std::array<float,2>{0.77274406f, 0.721406221f},
-std::array<float,2>{0.321628809f, 0.664590955f},
-std::array<float,2>{0.749273837f, 0.0896714851f},
-std::array<float,2>{0.0492577702f, 0.497418076f},
-std::array<float,2>{0.982987165f, 0.986329615f},
-std::array<float,2>{0.236993164f, 0.777561545f},
-std::array<float,2>{0.86521107f, 0.325223863f},
-std::array<float,2>{0.466913491f, 0.139427781f},
-std::array<float,2>{0.58066994f, 0.516706526f},
-std::array<float,2>{0.198255301f, 0.507755518f},
-std::array<float,2>{0.827608407f, 0.149336785f},
-std::array<float,2>{0.483582109f, 0.334859908f},
-std::array<float,2>{0.59520328f, 0.762363791f},
-std::array<float,2>{0.374150634f, 0.977992475f},
-std::array<float,2>{0.695943117f, 0.477857322f},
-std::array<float,2>{0.00530836638f, 0.0766900331f},
-std::array<float,2>{0.96570164f, 0.67945987f},
-std::array<float,2>{0.407380611f, 0.734966993f},
-std::array<float,2>{0.539490283f, 0.0611867532f},
-std::array<float,2>{0.179646477f, 0.429208726f},
-std::array<float,2>{0.799777985f, 0.889047027f},
-std::array<float,2>{0.0793125257f, 0.852636874f},
-std::array<float,2>{0.91977483f, 0.301054835f},
-std::array<float,2>{0.26361692f, 0.19615978f},
-std::array<float,2>{0.651499867f, 0.618122995f},
-std::array<float,2>{0.037010856f, 0.65420413f},
-std::array<float,2>{0.985991716f, 0.10630849f},
-std::array<float,2>{0.336015284f, 0.458696485f},
-std::array<float,2>{0.718911767f, 0.953938663f},
-std::array<float,2>{0.441005886f, 0.79280889f},
-std::array<float,2>{0.575678766f, 0.367790341f},
-std::array<float,2>{0.229899466f, 0.160894021f},
-std::array<float,2>{0.857421279f, 0.560132861f},
-std::array<float,2>{0.295629501f, 0.567332983f},
-std::array<float,2>{0.685551345f, 0.221151456f},
-std::array<float,2>{0.103495106f, 0.272493958f},
-std::array<float,2>{0.899219036f, 0.825288057f},
-std::array<float,2>{0.142280117f, 0.928633213f},
-std::array<float,2>{0.754982471f, 0.396455318f},
-std::array<float,2>{0.388845026f, 0.0133600533f},
-std::array<float,2>{0.509773552f, 0.71281606f},
-std::array<float,2>{0.206498042f, 0.742648482f},
-std::array<float,2>{0.830719829f, 0.0481846146f},
-std::array<float,2>{0.485568017f, 0.432842225f},
-std::array<float,2>{0.611928821f, 0.881736994f},
-std::array<float,2>{0.347092897f, 0.851336002f},
-std::array<float,2>{0.714296281f, 0.307316869f},
-std::array<float,2>{0.0228862595f, 0.19396542f},
-std::array<float,2>{0.939339697f, 0.614987433f},
-std::array<float,2>{0.433033288f, 0.513856411f},
-std::array<float,2>{0.55774641f, 0.147045106f},
-std::array<float,2>{0.16041261f, 0.34231481f},
-std::array<float,2>{0.793272316f, 0.757583559f},
-std::array<float,2>{0.0676144734f, 0.973875999f},
-std::array<float,2>{0.930250645f, 0.474888086f},
-std::array<float,2>{0.279503196f, 0.0631515235f},
-std::array<float,2>{0.627986908f, 0.686649203f},
-std::array<float,2>{0.0545168109f, 0.57729125f},
-std::array<float,2>{0.979601741f, 0.231049642f},
-std::array<float,2>{0.325238615f, 0.276691526f},
-std::array<float,2>{0.743353903f, 0.818179607f},
-std::array<float,2>{0.464630574f, 0.931711733f},
-std::array<float,2>{0.582347333f, 0.40529418f},
-std::array<float,2>{0.241410002f, 0.00259038899f},
-std::array<float,2>{0.861430764f, 0.70945406f},
-std::array<float,2>{0.301179975f, 0.648147523f},
-std::array<float,2>{0.665379822f, 0.0948822722f},
-std::array<float,2>{0.118208244f, 0.46444571f},
-std::array<float,2>{0.87677592f, 0.961448491f},
-std::array<float,2>{0.129042074f, 0.788122654f},
-std::array<float,2>{0.76828891f, 0.361960113f},
-std::array<float,2>{0.39417848f, 0.168400273f},
-std::array<float,2>{0.52481848f, 0.550721645f},
-std::array<float,2>{0.173488498f, 0.539499342f},
-std::array<float,2>{0.802399755f, 0.175705984f},
-std::array<float,2>{0.412333012f, 0.344344676f},
-std::array<float,2>{0.545249164f, 0.808606923f},
-std::array<float,2>{0.26023972f, 0.941091835f},
-std::array<float,2>{0.654198945f, 0.444952071f},
-std::array<float,2>{0.0858348832f, 0.120171003f},
-std::array<float,2>{0.915768385f, 0.62531358f},
-std::array<float,2>{0.479263186f, 0.701116443f},
-std::array<float,2>{0.599057853f, 0.0208341926f},
-std::array<float,2>{0.201470748f, 0.385261178f},
-std::array<float,2>{0.823297739f, 0.908087552f},
-std::array<float,2>{0.0038045377f, 0.838698268f},
-std::array<float,2>{0.961446881f, 0.255701661f},
-std::array<float,2>{0.369666874f, 0.24333851f},
-std::array<float,2>{0.699930012f, 0.585053861f},
-std::array<float,2>{0.107912093f, 0.658366799f},
-std::array<float,2>{0.903505206f, 0.0839060545f},
-std::array<float,2>{0.291038573f, 0.485904396f},
-std::array<float,2>{0.683149219f, 0.996326208f},
-std::array<float,2>{0.384162664f, 0.767303646f},
-std::array<float,2>{0.514796257f, 0.316813111f},
-std::array<float,2>{0.148066178f, 0.129555553f},
-std::array<float,2>{0.753875017f, 0.527017176f},
-std::array<float,2>{0.341981649f, 0.594929099f},
-std::array<float,2>{0.723231494f, 0.206508115f},
-std::array<float,2>{0.0316219814f, 0.290544122f},
-std::array<float,2>{0.989973724f, 0.866416752f},
-std::array<float,2>{0.231262952f, 0.892672122f},
-std::array<float,2>{0.853040159f, 0.407657295f},
-std::array<float,2>{0.443592399f, 0.0458841026f},
-std::array<float,2>{0.570475519f, 0.729130328f},
-std::array<float,2>{0.150628313f, 0.635394752f},
-std::array<float,2>{0.763174832f, 0.113842703f},
-std::array<float,2>{0.381904691f, 0.446778357f},
-std::array<float,2>{0.50705272f, 0.946727753f},
-std::array<float,2>{0.286186248f, 0.801391125f},
-std::array<float,2>{0.675863028f, 0.356684506f},
-std::array<float,2>{0.098107405f, 0.181087241f},
-std::array<float,2>{0.892875433f, 0.533533871f},
-std::array<float,2>{0.446718991f, 0.593309045f},
-std::array<float,2>{0.568486512f, 0.235482559f},
-std::array<float,2>{0.22340627f, 0.259420842f},
-std::array<float,2>{0.849913836f, 0.835580885f},
-std::array<float,2>{0.0401898213f, 0.92153585f},
-std::array<float,2>{0.997267246f, 0.381880611f},
-std::array<float,2>{0.335293442f, 0.0266907196f},
-std::array<float,2>{0.729954898f, 0.69451791f},
-std::array<float,2>{0.0916872993f, 0.523363471f},
-std::array<float,2>{0.907492459f, 0.135352612f},
-std::array<float,2>{0.250594914f, 0.320908964f},
-std::array<float,2>{0.648370028f, 0.774716079f},
-std::array<float,2>{0.416173786f, 0.992101014f},
-std::array<float,2>{0.536691368f, 0.492197275f},
-std::array<float,2>{0.187311634f, 0.0905180648f},
-std::array<float,2>{0.810013175f, 0.66808033f},
-std::array<float,2>{0.363690346f, 0.7236256f},
-std::array<float,2>{0.692456007f, 0.0390406959f},
-std::array<float,2>{0.0116305649f, 0.415286601f},
-std::array<float,2>{0.956264555f, 0.901806235f},
-std::array<float,2>{0.194409668f, 0.871278226f},
-std::array<float,2>{0.813504159f, 0.282405794f},
-std::array<float,2>{0.469567925f, 0.215086773f},
-std::array<float,2>{0.601938248f, 0.606841385f},
-std::array<float,2>{0.24608776f, 0.622051656f},
-std::array<float,2>{0.874011695f, 0.200703278f},
-std::array<float,2>{0.460791439f, 0.299221158f},
-std::array<float,2>{0.588530302f, 0.857006192f},
-std::array<float,2>{0.316191971f, 0.884724319f},
-std::array<float,2>{0.736055434f, 0.425610602f},
-std::array<float,2>{0.0549716614f, 0.0569326542f},
-std::array<float,2>{0.972709358f, 0.739760637f},
-std::array<float,2>{0.400483072f, 0.6744169f},
-std::array<float,2>{0.521920502f, 0.0716851726f},
-std::array<float,2>{0.140051484f, 0.482544333f},
-std::array<float,2>{0.776197493f, 0.982326031f},
-std::array<float,2>{0.110349149f, 0.759277165f},
-std::array<float,2>{0.888293862f, 0.328142524f},
-std::array<float,2>{0.305493116f, 0.155128792f},
-std::array<float,2>{0.662151396f, 0.501096606f},
-std::array<float,2>{0.0247835498f, 0.71763885f},
-std::array<float,2>{0.945853293f, 0.00833214726f},
-std::array<float,2>{0.353462934f, 0.392690212f},
-std::array<float,2>{0.706181109f, 0.924003899f},
-std::array<float,2>{0.499720365f, 0.822932065f},
-std::array<float,2>{0.620839357f, 0.267789841f},
-std::array<float,2>{0.217367157f, 0.226363406f},
-std::array<float,2>{0.841949403f, 0.564008236f},
-std::array<float,2>{0.270015866f, 0.557930827f},
-std::array<float,2>{0.633823335f, 0.158992559f},
-std::array<float,2>{0.0749379545f, 0.372957498f},
-std::array<float,2>{0.922206461f, 0.796510875f},
-std::array<float,2>{0.166119024f, 0.958151996f},
-std::array<float,2>{0.787726104f, 0.456377298f},
-std::array<float,2>{0.42433539f, 0.102062732f},
-std::array<float,2>{0.552437901f, 0.650406361f},
-std::array<float,2>{0.191056952f, 0.641665816f},
-std::array<float,2>{0.81786412f, 0.098736316f},
-std::array<float,2>{0.474157125f, 0.467896163f},
-std::array<float,2>{0.606241047f, 0.967909515f},
-std::array<float,2>{0.361406207f, 0.784632623f},
-std::array<float,2>{0.688436508f, 0.36346066f},
-std::array<float,2>{0.0135408966f, 0.167190552f},
-std::array<float,2>{0.960448921f, 0.552118003f},
-std::array<float,2>{0.420559466f, 0.571025014f},
-std::array<float,2>{0.531555057f, 0.229128912f},
-std::array<float,2>{0.181518018f, 0.278161377f},
-std::array<float,2>{0.807327747f, 0.816021621f},
-std::array<float,2>{0.0875080526f, 0.934353113f},
-std::array<float,2>{0.910676062f, 0.398709953f},
-std::array<float,2>{0.256799638f, 0.00562658999f},
-std::array<float,2>{0.642800689f, 0.705407619f},
-std::array<float,2>{0.0450280048f, 0.50827235f},
-std::array<float,2>{0.993821025f, 0.144247517f},
-std::array<float,2>{0.329488128f, 0.3386347f},
-std::array<float,2>{0.733463645f, 0.750966311f},
-std::array<float,2>{0.449811518f, 0.970206082f},
-std::array<float,2>{0.562905967f, 0.470667481f},
-std::array<float,2>{0.219188631f, 0.0685287789f},
-std::array<float,2>{0.845044971f, 0.682808518f},
-std::array<float,2>{0.283293992f, 0.749311864f},
-std::array<float,2>{0.672841907f, 0.0515396148f},
-std::array<float,2>{0.0972766057f, 0.435255826f},
-std::array<float,2>{0.895401239f, 0.878163993f},
-std::array<float,2>{0.154044494f, 0.846165538f},
-std::array<float,2>{0.761238217f, 0.311511546f},
-std::array<float,2>{0.375703603f, 0.190438554f},
-std::array<float,2>{0.500242949f, 0.610695899f},
-std::array<float,2>{0.169660643f, 0.59826678f},
-std::array<float,2>{0.782175601f, 0.210704774f},
-std::array<float,2>{0.429135114f, 0.294002831f},
-std::array<float,2>{0.550483704f, 0.860064924f},
-std::array<float,2>{0.265888989f, 0.896450102f},
-std::array<float,2>{0.637019813f, 0.411652178f},
-std::array<float,2>{0.0724147558f, 0.0415319167f},
-std::array<float,2>{0.929248273f, 0.732280552f},
-std::array<float,2>{0.495985746f, 0.66328156f},
-std::array<float,2>{0.622315526f, 0.0818381533f},
-std::array<float,2>{0.21134828f, 0.48966822f},
-std::array<float,2>{0.837535679f, 0.995453179f},
-std::array<float,2>{0.0287264865f, 0.769941449f},
-std::array<float,2>{0.951103687f, 0.314806968f},
-std::array<float,2>{0.356023163f, 0.125670493f},
-std::array<float,2>{0.707961798f, 0.529999793f},
-std::array<float,2>{0.113351889f, 0.698916614f},
-std::array<float,2>{0.883869648f, 0.019175861f},
-std::array<float,2>{0.310125351f, 0.387749165f},
-std::array<float,2>{0.657279134f, 0.913496077f},
-std::array<float,2>{0.404200196f, 0.841639221f},
-std::array<float,2>{0.518901467f, 0.250694126f},
-std::array<float,2>{0.136237368f, 0.248132005f},
-std::array<float,2>{0.778656781f, 0.57940793f},
-std::array<float,2>{0.317214429f, 0.544146836f},
-std::array<float,2>{0.742020488f, 0.179106414f},
-std::array<float,2>{0.0593227223f, 0.348719299f},
-std::array<float,2>{0.971868753f, 0.80632329f},
-std::array<float,2>{0.249161124f, 0.94444567f},
-std::array<float,2>{0.867852569f, 0.43929714f},
-std::array<float,2>{0.456331968f, 0.122470081f},
-std::array<float,2>{0.59335947f, 0.631616831f},
-std::array<float,2>{0.127648324f, 0.719676495f},
-std::array<float,2>{0.770313561f, 0.0334775858f},
-std::array<float,2>{0.395380259f, 0.419868708f},
-std::array<float,2>{0.528471291f, 0.905139804f},
-std::array<float,2>{0.299452454f, 0.870442808f},
-std::array<float,2>{0.670739949f, 0.28673929f},
-std::array<float,2>{0.121749178f, 0.213399917f},
-std::array<float,2>{0.881102383f, 0.604756951f},
-std::array<float,2>{0.4650518f, 0.517830431f},
-std::array<float,2>{0.578695238f, 0.136978924f},
-std::array<float,2>{0.235578671f, 0.327839017f},
-std::array<float,2>{0.8660236f, 0.779957652f},
-std::array<float,2>{0.0486065447f, 0.985690296f},
-std::array<float,2>{0.981490552f, 0.498084784f},
-std::array<float,2>{0.323083341f, 0.0876251161f},
-std::array<float,2>{0.747434139f, 0.667712152f},
-std::array<float,2>{0.066139251f, 0.588126004f},
-std::array<float,2>{0.937286258f, 0.241471767f},
-std::array<float,2>{0.276244432f, 0.263787866f},
-std::array<float,2>{0.630560815f, 0.831292927f},
-std::array<float,2>{0.434771419f, 0.915827155f},
-std::array<float,2>{0.560012281f, 0.375288755f},
-std::array<float,2>{0.156972855f, 0.0302931145f},
-std::array<float,2>{0.790518761f, 0.690652549f},
-std::array<float,2>{0.350672573f, 0.638674617f},
-std::array<float,2>{0.715534866f, 0.113117576f},
-std::array<float,2>{0.0178131051f, 0.449430138f},
-std::array<float,2>{0.94229728f, 0.952261686f},
-std::array<float,2>{0.21043992f, 0.799329579f},
-std::array<float,2>{0.832309008f, 0.354446888f},
-std::array<float,2>{0.488919109f, 0.186793104f},
-std::array<float,2>{0.614134073f, 0.538060248f},
-std::array<float,2>{0.227847129f, 0.560741544f},
-std::array<float,2>{0.858344436f, 0.163250446f},
-std::array<float,2>{0.438005507f, 0.370401382f},
-std::array<float,2>{0.57708323f, 0.790928006f},
-std::array<float,2>{0.339044392f, 0.955137432f},
-std::array<float,2>{0.721938014f, 0.45976004f},
-std::array<float,2>{0.0388493016f, 0.107461445f},
-std::array<float,2>{0.987495661f, 0.656058431f},
-std::array<float,2>{0.387462199f, 0.713690042f},
-std::array<float,2>{0.509506226f, 0.0153896157f},
-std::array<float,2>{0.143425643f, 0.397078574f},
-std::array<float,2>{0.755993366f, 0.926457465f},
-std::array<float,2>{0.104664214f, 0.826178312f},
-std::array<float,2>{0.901459634f, 0.269901305f},
-std::array<float,2>{0.294881731f, 0.219322264f},
-std::array<float,2>{0.685007453f, 0.569671273f},
-std::array<float,2>{0.00620239647f, 0.677197516f},
-std::array<float,2>{0.968707085f, 0.0760953128f},
-std::array<float,2>{0.371752858f, 0.479645342f},
-std::array<float,2>{0.698822379f, 0.979106486f},
-std::array<float,2>{0.481796682f, 0.763740122f},
-std::array<float,2>{0.59640938f, 0.332346141f},
-std::array<float,2>{0.195582002f, 0.151797503f},
-std::array<float,2>{0.824465275f, 0.503935218f},
-std::array<float,2>{0.265193582f, 0.619982004f},
-std::array<float,2>{0.649171174f, 0.197538972f},
-std::array<float,2>{0.0819177777f, 0.30448845f},
-std::array<float,2>{0.9215675f, 0.855087876f},
-std::array<float,2>{0.175941154f, 0.886834919f},
-std::array<float,2>{0.797133327f, 0.426214695f},
-std::array<float,2>{0.40827027f, 0.0596077703f},
-std::array<float,2>{0.542285383f, 0.737329781f},
-std::array<float,2>{0.239654824f, 0.708801985f},
-std::array<float,2>{0.860834181f, 0.00131852878f},
-std::array<float,2>{0.461311281f, 0.402875274f},
-std::array<float,2>{0.584767997f, 0.929986835f},
-std::array<float,2>{0.327493817f, 0.819571018f},
-std::array<float,2>{0.744974196f, 0.274579346f},
-std::array<float,2>{0.0512315333f, 0.233935505f},
-std::array<float,2>{0.977496505f, 0.575170875f},
-std::array<float,2>{0.392211229f, 0.547357917f},
-std::array<float,2>{0.525856733f, 0.170974597f},
-std::array<float,2>{0.131045565f, 0.360415041f},
-std::array<float,2>{0.766775787f, 0.785928905f},
-std::array<float,2>{0.119560853f, 0.964395046f},
-std::array<float,2>{0.877609611f, 0.461954594f},
-std::array<float,2>{0.304155648f, 0.0967966765f},
-std::array<float,2>{0.667707562f, 0.645737708f},
-std::array<float,2>{0.0196134616f, 0.616852462f},
-std::array<float,2>{0.940674305f, 0.191600204f},
-std::array<float,2>{0.344235182f, 0.306397408f},
-std::array<float,2>{0.712280512f, 0.848890603f},
-std::array<float,2>{0.487163097f, 0.88001436f},
-std::array<float,2>{0.609393239f, 0.429774493f},
-std::array<float,2>{0.204378396f, 0.0495711751f},
-std::array<float,2>{0.828894973f, 0.744163036f},
-std::array<float,2>{0.27820912f, 0.684746742f},
-std::array<float,2>{0.626951933f, 0.0648490116f},
-std::array<float,2>{0.0689884946f, 0.473292232f},
-std::array<float,2>{0.932951748f, 0.975053251f},
-std::array<float,2>{0.163561404f, 0.754272878f},
-std::array<float,2>{0.795693338f, 0.340451807f},
-std::array<float,2>{0.430990756f, 0.146394029f},
-std::array<float,2>{0.555751801f, 0.513173044f},
-std::array<float,2>{0.144640923f, 0.523633838f},
-std::array<float,2>{0.751696765f, 0.131573632f},
-std::array<float,2>{0.385909468f, 0.319584846f},
-std::array<float,2>{0.512579441f, 0.768469989f},
-std::array<float,2>{0.290210068f, 0.999049306f},
-std::array<float,2>{0.680085242f, 0.487413973f},
-std::array<float,2>{0.106758863f, 0.0843466893f},
-std::array<float,2>{0.904932737f, 0.658003032f},
-std::array<float,2>{0.442929208f, 0.728167951f},
-std::array<float,2>{0.573123097f, 0.044465147f},
-std::array<float,2>{0.233394682f, 0.409002274f},
-std::array<float,2>{0.855438352f, 0.890688479f},
-std::array<float,2>{0.0337583907f, 0.863954008f},
-std::array<float,2>{0.991171837f, 0.291647047f},
-std::array<float,2>{0.3400307f, 0.20323582f},
-std::array<float,2>{0.724991918f, 0.596706033f},
-std::array<float,2>{0.0831601247f, 0.628292024f},
-std::array<float,2>{0.916673422f, 0.117587894f},
-std::array<float,2>{0.25924471f, 0.443091273f},
-std::array<float,2>{0.654426157f, 0.937963486f},
-std::array<float,2>{0.410203278f, 0.810937047f},
-std::array<float,2>{0.543700397f, 0.347017705f},
-std::array<float,2>{0.175672382f, 0.172478139f},
-std::array<float,2>{0.802941382f, 0.541300774f},
-std::array<float,2>{0.367304891f, 0.582269013f},
-std::array<float,2>{0.701366305f, 0.244860902f},
-std::array<float,2>{0.00173613208f, 0.255930245f},
-std::array<float,2>{0.963649154f, 0.836870611f},
-std::array<float,2>{0.200596154f, 0.909014761f},
-std::array<float,2>{0.820573926f, 0.38395384f},
-std::array<float,2>{0.47821638f, 0.023288155f},
-std::array<float,2>{0.599748671f, 0.701797068f},
-std::array<float,2>{0.185433209f, 0.670449018f},
-std::array<float,2>{0.812294006f, 0.0926953852f},
-std::array<float,2>{0.41532743f, 0.495717287f},
-std::array<float,2>{0.537608325f, 0.989235342f},
-std::array<float,2>{0.252959281f, 0.776088417f},
-std::array<float,2>{0.64616859f, 0.322882652f},
-std::array<float,2>{0.0926967636f, 0.133263037f},
-std::array<float,2>{0.908535421f, 0.521195829f},
-std::array<float,2>{0.470777363f, 0.608896196f},
-std::array<float,2>{0.60437119f, 0.217274755f},
-std::array<float,2>{0.192824706f, 0.285047442f},
-std::array<float,2>{0.815419257f, 0.873737156f},
-std::array<float,2>{0.00925508421f, 0.899894834f},
-std::array<float,2>{0.953259885f, 0.416546553f},
-std::array<float,2>{0.365777344f, 0.0366608948f},
-std::array<float,2>{0.694350481f, 0.725574136f},
-std::array<float,2>{0.0996367112f, 0.531864703f},
-std::array<float,2>{0.892215908f, 0.183142185f},
-std::array<float,2>{0.287521571f, 0.357833207f},
-std::array<float,2>{0.679005384f, 0.80323714f},
-std::array<float,2>{0.380135208f, 0.947307289f},
-std::array<float,2>{0.50519532f, 0.44819054f},
-std::array<float,2>{0.148824766f, 0.115463302f},
-std::array<float,2>{0.764233351f, 0.634199262f},
-std::array<float,2>{0.332720697f, 0.692061305f},
-std::array<float,2>{0.728423297f, 0.0246641133f},
-std::array<float,2>{0.0415174887f, 0.379504234f},
-std::array<float,2>{0.998141885f, 0.918177903f},
-std::array<float,2>{0.224841401f, 0.833535552f},
-std::array<float,2>{0.848565817f, 0.261230379f},
-std::array<float,2>{0.447310716f, 0.238055155f},
-std::array<float,2>{0.56817919f, 0.589847922f},
-std::array<float,2>{0.215398788f, 0.564503074f},
-std::array<float,2>{0.84025377f, 0.222706079f},
-std::array<float,2>{0.497013956f, 0.266708493f},
-std::array<float,2>{0.617357314f, 0.821760297f},
-std::array<float,2>{0.354481667f, 0.923756242f},
-std::array<float,2>{0.703386307f, 0.390978009f},
-std::array<float,2>{0.0265917461f, 0.0100532826f},
-std::array<float,2>{0.948023677f, 0.7165066f},
-std::array<float,2>{0.423607528f, 0.649209678f},
-std::array<float,2>{0.55313468f, 0.104554132f},
-std::array<float,2>{0.164987698f, 0.45477429f},
-std::array<float,2>{0.786651671f, 0.960011184f},
-std::array<float,2>{0.0769526362f, 0.794768691f},
-std::array<float,2>{0.925531745f, 0.373635113f},
-std::array<float,2>{0.27235508f, 0.158095181f},
-std::array<float,2>{0.635016918f, 0.555816233f},
-std::array<float,2>{0.0574759655f, 0.740245283f},
-std::array<float,2>{0.976233721f, 0.0547334552f},
-std::array<float,2>{0.312700868f, 0.423719674f},
-std::array<float,2>{0.73678571f, 0.885436475f},
-std::array<float,2>{0.457533598f, 0.857515931f},
-std::array<float,2>{0.586750388f, 0.296895713f},
-std::array<float,2>{0.244084731f, 0.201632634f},
-std::array<float,2>{0.871831656f, 0.624451041f},
-std::array<float,2>{0.307433426f, 0.503229201f},
-std::array<float,2>{0.660933554f, 0.153633982f},
-std::array<float,2>{0.11282067f, 0.331203192f},
-std::array<float,2>{0.889866769f, 0.761313081f},
-std::array<float,2>{0.138404489f, 0.983004987f},
-std::array<float,2>{0.77345401f, 0.480619371f},
-std::array<float,2>{0.400306255f, 0.0723370463f},
-std::array<float,2>{0.520700991f, 0.67293936f},
-std::array<float,2>{0.247285396f, 0.632209003f},
-std::array<float,2>{0.869379938f, 0.121871144f},
-std::array<float,2>{0.454391539f, 0.437930673f},
-std::array<float,2>{0.591298938f, 0.944274306f},
-std::array<float,2>{0.319873571f, 0.805499494f},
-std::array<float,2>{0.738451719f, 0.348052293f},
-std::array<float,2>{0.0621599145f, 0.178518519f},
-std::array<float,2>{0.968792558f, 0.543906331f},
-std::array<float,2>{0.404788733f, 0.578849733f},
-std::array<float,2>{0.515872061f, 0.249627694f},
-std::array<float,2>{0.132983416f, 0.251919121f},
-std::array<float,2>{0.78045541f, 0.840526998f},
-std::array<float,2>{0.116335109f, 0.912381709f},
-std::array<float,2>{0.886151135f, 0.386733949f},
-std::array<float,2>{0.312148094f, 0.0177218597f},
-std::array<float,2>{0.659254432f, 0.697344184f},
-std::array<float,2>{0.0311513394f, 0.530566931f},
-std::array<float,2>{0.951421261f, 0.126931041f},
-std::array<float,2>{0.357894897f, 0.316266537f},
-std::array<float,2>{0.710413337f, 0.770517409f},
-std::array<float,2>{0.493847728f, 0.994536996f},
-std::array<float,2>{0.624970376f, 0.488330662f},
-std::array<float,2>{0.212946042f, 0.0809993073f},
-std::array<float,2>{0.838130295f, 0.66244328f},
-std::array<float,2>{0.268287599f, 0.731268644f},
-std::array<float,2>{0.639310241f, 0.0424506702f},
-std::array<float,2>{0.0713446811f, 0.410179764f},
-std::array<float,2>{0.927424192f, 0.894651353f},
-std::array<float,2>{0.170960024f, 0.861252964f},
-std::array<float,2>{0.783415198f, 0.293701112f},
-std::array<float,2>{0.427098334f, 0.209564954f},
-std::array<float,2>{0.547027409f, 0.599226177f},
-std::array<float,2>{0.155145496f, 0.609875858f},
-std::array<float,2>{0.759134233f, 0.189771309f},
-std::array<float,2>{0.378033757f, 0.311587542f},
-std::array<float,2>{0.50259608f, 0.847375333f},
-std::array<float,2>{0.282931119f, 0.877063394f},
-std::array<float,2>{0.674343944f, 0.434135914f},
-std::array<float,2>{0.0944433212f, 0.0526935905f},
-std::array<float,2>{0.897988439f, 0.748670816f},
-std::array<float,2>{0.452470988f, 0.682205379f},
-std::array<float,2>{0.565399647f, 0.0701409355f},
-std::array<float,2>{0.221164837f, 0.469348997f},
-std::array<float,2>{0.846640706f, 0.969015956f},
-std::array<float,2>{0.0448616222f, 0.751367629f},
-std::array<float,2>{0.994823873f, 0.339630574f},
-std::array<float,2>{0.331236005f, 0.14316313f},
-std::array<float,2>{0.731688023f, 0.509370089f},
-std::array<float,2>{0.0884181336f, 0.706187308f},
-std::array<float,2>{0.913285851f, 0.00417892076f},
-std::array<float,2>{0.254692376f, 0.399990141f},
-std::array<float,2>{0.641652942f, 0.934983015f},
-std::array<float,2>{0.418562621f, 0.814964235f},
-std::array<float,2>{0.533893943f, 0.278419197f},
-std::array<float,2>{0.1830111f, 0.230070069f},
-std::array<float,2>{0.80626601f, 0.571709871f},
-std::array<float,2>{0.359526843f, 0.550844252f},
-std::array<float,2>{0.690141737f, 0.16674073f},
-std::array<float,2>{0.0142286243f, 0.364636362f},
-std::array<float,2>{0.958237052f, 0.783781648f},
-std::array<float,2>{0.187634215f, 0.967100918f},
-std::array<float,2>{0.820042551f, 0.467266828f},
-std::array<float,2>{0.475575447f, 0.0981896296f},
-std::array<float,2>{0.607802749f, 0.640857637f},
-std::array<float,2>{0.17842418f, 0.736521542f},
-std::array<float,2>{0.800580025f, 0.0593081042f},
-std::array<float,2>{0.406810641f, 0.427568495f},
-std::array<float,2>{0.540156126f, 0.888042808f},
-std::array<float,2>{0.262243807f, 0.853977799f},
-std::array<float,2>{0.651199579f, 0.302824408f},
-std::array<float,2>{0.0790413544f, 0.198978484f},
-std::array<float,2>{0.918278158f, 0.620804071f},
-std::array<float,2>{0.48275575f, 0.505692363f},
-std::array<float,2>{0.594090581f, 0.151155755f},
-std::array<float,2>{0.197912723f, 0.333643854f},
-std::array<float,2>{0.826370895f, 0.765209794f},
-std::array<float,2>{0.00429354748f, 0.979620814f},
-std::array<float,2>{0.966058314f, 0.478556603f},
-std::array<float,2>{0.373554587f, 0.0749955475f},
-std::array<float,2>{0.69636029f, 0.675970674f},
-std::array<float,2>{0.102238424f, 0.568529725f},
-std::array<float,2>{0.900355637f, 0.220054269f},
-std::array<float,2>{0.296723008f, 0.271422803f},
-std::array<float,2>{0.686744273f, 0.827305675f},
-std::array<float,2>{0.389793038f, 0.927170813f},
-std::array<float,2>{0.510880649f, 0.397904843f},
-std::array<float,2>{0.140634686f, 0.0146037554f},
-std::array<float,2>{0.75407654f, 0.714039087f},
-std::array<float,2>{0.337537766f, 0.654605389f},
-std::array<float,2>{0.720356464f, 0.109197848f},
-std::array<float,2>{0.035178002f, 0.460715473f},
-std::array<float,2>{0.985142171f, 0.956292808f},
-std::array<float,2>{0.228547081f, 0.789940238f},
-std::array<float,2>{0.856173396f, 0.369750738f},
-std::array<float,2>{0.43981725f, 0.162534624f},
-std::array<float,2>{0.57458365f, 0.562450349f},
-std::array<float,2>{0.208296001f, 0.538748264f},
-std::array<float,2>{0.834972322f, 0.18573153f},
-std::array<float,2>{0.491453052f, 0.355341375f},
-std::array<float,2>{0.616596401f, 0.800076842f},
-std::array<float,2>{0.348619103f, 0.951386333f},
-std::array<float,2>{0.717259824f, 0.450463474f},
-std::array<float,2>{0.0157980192f, 0.111391276f},
-std::array<float,2>{0.944589198f, 0.640007079f},
-std::array<float,2>{0.436742514f, 0.689894021f},
-std::array<float,2>{0.561441958f, 0.0295286998f},
-std::array<float,2>{0.159318954f, 0.376673102f},
-std::array<float,2>{0.791860402f, 0.914481044f},
-std::array<float,2>{0.0629181638f, 0.830414355f},
-std::array<float,2>{0.933746815f, 0.264856189f},
-std::array<float,2>{0.275140882f, 0.240573376f},
-std::array<float,2>{0.631578505f, 0.589049995f},
-std::array<float,2>{0.0498681255f, 0.666947186f},
-std::array<float,2>{0.983879924f, 0.086406365f},
-std::array<float,2>{0.320641339f, 0.499893993f},
-std::array<float,2>{0.748241246f, 0.984379172f},
-std::array<float,2>{0.468646854f, 0.781220198f},
-std::array<float,2>{0.581420898f, 0.326652586f},
-std::array<float,2>{0.2375191f, 0.137926012f},
-std::array<float,2>{0.863725185f, 0.518985868f},
-std::array<float,2>{0.298822582f, 0.60401988f},
-std::array<float,2>{0.66950506f, 0.214174524f},
-std::array<float,2>{0.124972746f, 0.28531605f},
-std::array<float,2>{0.880517781f, 0.869266748f},
-std::array<float,2>{0.126060963f, 0.905415535f},
-std::array<float,2>{0.77187562f, 0.418096393f},
-std::array<float,2>{0.397351652f, 0.0342107564f},
-std::array<float,2>{0.529916286f, 0.720020592f},
-std::array<float,2>{0.20294258f, 0.702416182f},
-std::array<float,2>{0.822555184f, 0.0218422394f},
-std::array<float,2>{0.479600668f, 0.383428305f},
-std::array<float,2>{0.597659945f, 0.909602106f},
-std::array<float,2>{0.370694429f, 0.837658584f},
-std::array<float,2>{0.700370669f, 0.257040948f},
-std::array<float,2>{0.00226453668f, 0.245867103f},
-std::array<float,2>{0.9621436f, 0.583523571f},
-std::array<float,2>{0.413874447f, 0.542714059f},
-std::array<float,2>{0.546077609f, 0.173692346f},
-std::array<float,2>{0.172806144f, 0.345748246f},
-std::array<float,2>{0.801211953f, 0.812310398f},
-std::array<float,2>{0.0845713913f, 0.938571513f},
-std::array<float,2>{0.914416134f, 0.442140132f},
-std::array<float,2>{0.261204064f, 0.118475772f},
-std::array<float,2>{0.65249753f, 0.627382338f},
-std::array<float,2>{0.0323148519f, 0.596080899f},
-std::array<float,2>{0.988941252f, 0.204314619f},
-std::array<float,2>{0.342942208f, 0.292191744f},
-std::array<float,2>{0.724591315f, 0.865140617f},
-std::array<float,2>{0.444347262f, 0.892229915f},
-std::array<float,2>{0.571553469f, 0.409189254f},
-std::array<float,2>{0.231880397f, 0.0435831398f},
-std::array<float,2>{0.852045298f, 0.727051914f},
-std::array<float,2>{0.292024016f, 0.656471968f},
-std::array<float,2>{0.681787789f, 0.0857525617f},
-std::array<float,2>{0.108818173f, 0.487258077f},
-std::array<float,2>{0.903037488f, 0.998618722f},
-std::array<float,2>{0.146487042f, 0.76900202f},
-std::array<float,2>{0.752390087f, 0.318818718f},
-std::array<float,2>{0.383671045f, 0.132555842f},
-std::array<float,2>{0.514246225f, 0.524499416f},
-std::array<float,2>{0.16178146f, 0.512103379f},
-std::array<float,2>{0.794664383f, 0.144584358f},
-std::array<float,2>{0.431783915f, 0.34170264f},
-std::array<float,2>{0.55707407f, 0.755009115f},
-std::array<float,2>{0.280584663f, 0.976102054f},
-std::array<float,2>{0.62708652f, 0.473991066f},
-std::array<float,2>{0.0667856559f, 0.0658604428f},
-std::array<float,2>{0.93131578f, 0.684553146f},
-std::array<float,2>{0.484943837f, 0.7459566f},
-std::array<float,2>{0.613237679f, 0.0501739122f},
-std::array<float,2>{0.205891907f, 0.431419253f},
-std::array<float,2>{0.831271231f, 0.879537165f},
-std::array<float,2>{0.021656476f, 0.847958148f},
-std::array<float,2>{0.938404262f, 0.305027723f},
-std::array<float,2>{0.345886171f, 0.193226591f},
-std::array<float,2>{0.713512659f, 0.615777493f},
-std::array<float,2>{0.118118376f, 0.645212114f},
-std::array<float,2>{0.875155449f, 0.0962054133f},
-std::array<float,2>{0.301833361f, 0.461277276f},
-std::array<float,2>{0.664308429f, 0.963104844f},
-std::array<float,2>{0.393056482f, 0.78613317f},
-std::array<float,2>{0.523907721f, 0.360278368f},
-std::array<float,2>{0.130325228f, 0.170860365f},
-std::array<float,2>{0.76910454f, 0.548434734f},
-std::array<float,2>{0.324643701f, 0.575948298f},
-std::array<float,2>{0.742837191f, 0.233284578f},
-std::array<float,2>{0.0530946739f, 0.273644537f},
-std::array<float,2>{0.97852236f, 0.818533719f},
-std::array<float,2>{0.240470797f, 0.931511283f},
-std::array<float,2>{0.8628214f, 0.404250115f},
-std::array<float,2>{0.463149399f, 0.000692315341f},
-std::array<float,2>{0.583020091f, 0.707695127f},
-std::array<float,2>{0.139510825f, 0.672183335f},
-std::array<float,2>{0.776905298f, 0.0742039308f},
-std::array<float,2>{0.401893944f, 0.481943429f},
-std::array<float,2>{0.523423731f, 0.983609736f},
-std::array<float,2>{0.30663228f, 0.760406375f},
-std::array<float,2>{0.663682282f, 0.330811173f},
-std::array<float,2>{0.111168683f, 0.153059766f},
-std::array<float,2>{0.88742137f, 0.502373934f},
-std::array<float,2>{0.459385693f, 0.623326778f},
-std::array<float,2>{0.58921212f, 0.202704042f},
-std::array<float,2>{0.244454354f, 0.29842639f},
-std::array<float,2>{0.874388337f, 0.858554482f},
-std::array<float,2>{0.0560716949f, 0.886166155f},
-std::array<float,2>{0.974368632f, 0.422177196f},
-std::array<float,2>{0.314856231f, 0.0558748432f},
-std::array<float,2>{0.735024631f, 0.742135227f},
-std::array<float,2>{0.0759347379f, 0.555294156f},
-std::array<float,2>{0.923552334f, 0.156461105f},
-std::array<float,2>{0.270620018f, 0.374076068f},
-std::array<float,2>{0.633264363f, 0.79368031f},
-std::array<float,2>{0.425349861f, 0.959507763f},
-std::array<float,2>{0.551077247f, 0.453645855f},
-std::array<float,2>{0.167757332f, 0.103590757f},
-std::array<float,2>{0.788227439f, 0.649687171f},
-std::array<float,2>{0.351674616f, 0.71529454f},
-std::array<float,2>{0.705163121f, 0.0111789042f},
-std::array<float,2>{0.0242443737f, 0.39209187f},
-std::array<float,2>{0.946634233f, 0.922060251f},
-std::array<float,2>{0.218722001f, 0.820396245f},
-std::array<float,2>{0.843611598f, 0.266194969f},
-std::array<float,2>{0.498388201f, 0.223688498f},
-std::array<float,2>{0.619404972f, 0.565846026f},
-std::array<float,2>{0.22440967f, 0.591693938f},
-std::array<float,2>{0.850978792f, 0.236635238f},
-std::array<float,2>{0.445967764f, 0.260261595f},
-std::array<float,2>{0.569607615f, 0.832368731f},
-std::array<float,2>{0.334383726f, 0.919688165f},
-std::array<float,2>{0.72936666f, 0.38059029f},
-std::array<float,2>{0.0390936173f, 0.024278244f},
-std::array<float,2>{0.996183455f, 0.692468643f},
-std::array<float,2>{0.381634355f, 0.63366586f},
-std::array<float,2>{0.50640291f, 0.117034413f},
-std::array<float,2>{0.151888162f, 0.448459268f},
-std::array<float,2>{0.762472093f, 0.949130774f},
-std::array<float,2>{0.0986382216f, 0.803982615f},
-std::array<float,2>{0.893822134f, 0.358606815f},
-std::array<float,2>{0.285738796f, 0.182298854f},
-std::array<float,2>{0.677237988f, 0.532641292f},
-std::array<float,2>{0.0107177859f, 0.725792646f},
-std::array<float,2>{0.955104411f, 0.0358527787f},
-std::array<float,2>{0.364263415f, 0.41736865f},
-std::array<float,2>{0.691699743f, 0.899287224f},
-std::array<float,2>{0.469752461f, 0.874453485f},
-std::array<float,2>{0.603118956f, 0.283718288f},
-std::array<float,2>{0.194218695f, 0.218064785f},
-std::array<float,2>{0.813235819f, 0.608246565f},
-std::array<float,2>{0.251948714f, 0.51955837f},
-std::array<float,2>{0.647382975f, 0.13463515f},
-std::array<float,2>{0.0899625719f, 0.323579907f},
-std::array<float,2>{0.906332314f, 0.776441932f},
-std::array<float,2>{0.185814202f, 0.98949331f},
-std::array<float,2>{0.809114039f, 0.494638681f},
-std::array<float,2>{0.417754471f, 0.0929791331f},
-std::array<float,2>{0.535181463f, 0.671402633f},
-std::array<float,2>{0.212890401f, 0.661625683f},
-std::array<float,2>{0.836539388f, 0.0783842131f},
-std::array<float,2>{0.494867444f, 0.490409255f},
-std::array<float,2>{0.621844232f, 0.993034661f},
-std::array<float,2>{0.357085943f, 0.773219049f},
-std::array<float,2>{0.708058596f, 0.314310312f},
-std::array<float,2>{0.0280830748f, 0.126984045f},
-std::array<float,2>{0.949715912f, 0.52919203f},
-std::array<float,2>{0.427979439f, 0.601282716f},
-std::array<float,2>{0.549668074f, 0.208635673f},
-std::array<float,2>{0.168380097f, 0.296735853f},
-std::array<float,2>{0.782718956f, 0.862186372f},
-std::array<float,2>{0.0734188035f, 0.89785558f},
-std::array<float,2>{0.927916706f, 0.412573755f},
-std::array<float,2>{0.267009616f, 0.0407269895f},
-std::array<float,2>{0.638443291f, 0.732637167f},
-std::array<float,2>{0.0604975782f, 0.545975983f},
-std::array<float,2>{0.97166115f, 0.177363679f},
-std::array<float,2>{0.318199426f, 0.351204693f},
-std::array<float,2>{0.740374625f, 0.807915032f},
-std::array<float,2>{0.455668867f, 0.942820609f},
-std::array<float,2>{0.592376351f, 0.440582275f},
-std::array<float,2>{0.248786718f, 0.124002509f},
-std::array<float,2>{0.869119525f, 0.630700409f},
-std::array<float,2>{0.30861482f, 0.696814179f},
-std::array<float,2>{0.656630456f, 0.0172070693f},
-std::array<float,2>{0.115111172f, 0.389664173f},
-std::array<float,2>{0.882915318f, 0.91133523f},
-std::array<float,2>{0.134870544f, 0.842819393f},
-std::array<float,2>{0.777548492f, 0.253425568f},
-std::array<float,2>{0.403019786f, 0.247710019f},
-std::array<float,2>{0.518158793f, 0.581394613f},
-std::array<float,2>{0.179811418f, 0.574159682f},
-std::array<float,2>{0.80843854f, 0.228371397f},
-std::array<float,2>{0.421005219f, 0.280174673f},
-std::array<float,2>{0.532329559f, 0.813625276f},
-std::array<float,2>{0.257715225f, 0.935822368f},
-std::array<float,2>{0.643774986f, 0.400601536f},
-std::array<float,2>{0.0862650052f, 0.00637711491f},
-std::array<float,2>{0.911177278f, 0.704727829f},
-std::array<float,2>{0.472786486f, 0.643518746f},
-std::array<float,2>{0.607125401f, 0.100857563f},
-std::array<float,2>{0.190144911f, 0.464882821f},
-std::array<float,2>{0.817009628f, 0.965113282f},
-std::array<float,2>{0.0125503279f, 0.782143295f},
-std::array<float,2>{0.959148169f, 0.365657449f},
-std::array<float,2>{0.36261031f, 0.165995136f},
-std::array<float,2>{0.689194918f, 0.554348886f},
-std::array<float,2>{0.0964568779f, 0.74725616f},
-std::array<float,2>{0.895808995f, 0.0532578416f},
-std::array<float,2>{0.284253567f, 0.435612023f},
-std::array<float,2>{0.672917545f, 0.876365185f},
-std::array<float,2>{0.37626946f, 0.84445715f},
-std::array<float,2>{0.50155884f, 0.309530646f},
-std::array<float,2>{0.152732238f, 0.187924504f},
-std::array<float,2>{0.760202229f, 0.61281538f},
-std::array<float,2>{0.328668296f, 0.510203898f},
-std::array<float,2>{0.732670903f, 0.14072521f},
-std::array<float,2>{0.0468680486f, 0.336945504f},
-std::array<float,2>{0.99283582f, 0.752133727f},
-std::array<float,2>{0.219941631f, 0.972349644f},
-std::array<float,2>{0.843959868f, 0.471127808f},
-std::array<float,2>{0.450442463f, 0.0668162107f},
-std::array<float,2>{0.564248502f, 0.681144118f},
-std::array<float,2>{0.143925041f, 0.711187959f},
-std::array<float,2>{0.757354319f, 0.0126371738f},
-std::array<float,2>{0.388302565f, 0.39479959f},
-std::array<float,2>{0.508585751f, 0.929387689f},
-std::array<float,2>{0.293922901f, 0.824268401f},
-std::array<float,2>{0.684375286f, 0.271892279f},
-std::array<float,2>{0.104237199f, 0.222102761f},
-std::array<float,2>{0.900559306f, 0.567773521f},
-std::array<float,2>{0.439377993f, 0.558820248f},
-std::array<float,2>{0.577974439f, 0.161721632f},
-std::array<float,2>{0.227074489f, 0.369085193f},
-std::array<float,2>{0.859055877f, 0.791203678f},
-std::array<float,2>{0.037369974f, 0.954852819f},
-std::array<float,2>{0.986662984f, 0.457505792f},
-std::array<float,2>{0.33873859f, 0.106860742f},
-std::array<float,2>{0.721580446f, 0.653013587f},
-std::array<float,2>{0.0807234496f, 0.619103193f},
-std::array<float,2>{0.92064029f, 0.196798846f},
-std::array<float,2>{0.26397559f, 0.302708924f},
-std::array<float,2>{0.649513364f, 0.851718545f},
-std::array<float,2>{0.409705937f, 0.890203714f},
-std::array<float,2>{0.541405737f, 0.428339273f},
-std::array<float,2>{0.17699708f, 0.0617734306f},
-std::array<float,2>{0.798396945f, 0.735932112f},
-std::array<float,2>{0.372979522f, 0.677797079f},
-std::array<float,2>{0.697792172f, 0.077689603f},
-std::array<float,2>{0.00690245582f, 0.477178216f},
-std::array<float,2>{0.966919541f, 0.976642907f},
-std::array<float,2>{0.197096989f, 0.763238251f},
-std::array<float,2>{0.825785637f, 0.3350088f},
-std::array<float,2>{0.480591685f, 0.149430111f},
-std::array<float,2>{0.596858501f, 0.505882084f},
-std::array<float,2>{0.234537438f, 0.516265988f},
-std::array<float,2>{0.866443753f, 0.140168026f},
-std::array<float,2>{0.466383904f, 0.32435149f},
-std::array<float,2>{0.579271734f, 0.77900517f},
-std::array<float,2>{0.323802859f, 0.98789525f},
-std::array<float,2>{0.746978998f, 0.496444285f},
-std::array<float,2>{0.0472501852f, 0.0883599222f},
-std::array<float,2>{0.98115021f, 0.665691435f},
-std::array<float,2>{0.396175265f, 0.721906662f},
-std::array<float,2>{0.527698576f, 0.0321630388f},
-std::array<float,2>{0.128758028f, 0.421293348f},
-std::array<float,2>{0.770879149f, 0.902701974f},
-std::array<float,2>{0.123034991f, 0.867934406f},
-std::array<float,2>{0.882323503f, 0.288045049f},
-std::array<float,2>{0.299888343f, 0.21216996f},
-std::array<float,2>{0.671208203f, 0.602806211f},
-std::array<float,2>{0.0185788926f, 0.637502909f},
-std::array<float,2>{0.942740738f, 0.110375687f},
-std::array<float,2>{0.349732399f, 0.452705264f},
-std::array<float,2>{0.716781735f, 0.949387014f},
-std::array<float,2>{0.489988118f, 0.798699975f},
-std::array<float,2>{0.61438328f, 0.353135526f},
-std::array<float,2>{0.209205106f, 0.185080275f},
-std::array<float,2>{0.833948433f, 0.535455823f},
-std::array<float,2>{0.276486039f, 0.586049557f},
-std::array<float,2>{0.629051566f, 0.239678383f},
-std::array<float,2>{0.0644955263f, 0.262304068f},
-std::array<float,2>{0.936516881f, 0.82868886f},
-std::array<float,2>{0.157911062f, 0.917773604f},
-std::array<float,2>{0.789074898f, 0.378900915f},
-std::array<float,2>{0.433935732f, 0.0292454977f},
-std::array<float,2>{0.558656037f, 0.689140737f},
-std::array<float,2>{0.233863443f, 0.73038131f},
-std::array<float,2>{0.853796482f, 0.0468531735f},
-std::array<float,2>{0.442378402f, 0.406386554f},
-std::array<float,2>{0.573340595f, 0.893941939f},
-std::array<float,2>{0.341468394f, 0.866161764f},
-std::array<float,2>{0.726482034f, 0.289749444f},
-std::array<float,2>{0.0343563631f, 0.205219686f},
-std::array<float,2>{0.991640747f, 0.594216406f},
-std::array<float,2>{0.385040015f, 0.526171207f},
-std::array<float,2>{0.512775779f, 0.129931465f},
-std::array<float,2>{0.14591524f, 0.318263531f},
-std::array<float,2>{0.750460744f, 0.766272247f},
-std::array<float,2>{0.105662577f, 0.997523785f},
-std::array<float,2>{0.905839741f, 0.484737515f},
-std::array<float,2>{0.28951484f, 0.0829464346f},
-std::array<float,2>{0.681291699f, 0.659191072f},
-std::array<float,2>{0.000640627986f, 0.584021807f},
-std::array<float,2>{0.964102864f, 0.24252665f},
-std::array<float,2>{0.368728101f, 0.254503369f},
-std::array<float,2>{0.702831447f, 0.839425802f},
-std::array<float,2>{0.47725153f, 0.906395435f},
-std::array<float,2>{0.600635171f, 0.385916382f},
-std::array<float,2>{0.199221164f, 0.020074755f},
-std::array<float,2>{0.821584463f, 0.699510753f},
-std::array<float,2>{0.257867813f, 0.626444101f},
-std::array<float,2>{0.655609012f, 0.119663991f},
-std::array<float,2>{0.0825282559f, 0.443909973f},
-std::array<float,2>{0.91789937f, 0.939812779f},
-std::array<float,2>{0.173878446f, 0.809876561f},
-std::array<float,2>{0.804081857f, 0.344895899f},
-std::array<float,2>{0.411970019f, 0.174083456f},
-std::array<float,2>{0.544009447f, 0.540506899f},
-std::array<float,2>{0.132322967f, 0.549418986f},
-std::array<float,2>{0.766380548f, 0.169809222f},
-std::array<float,2>{0.390708208f, 0.362321109f},
-std::array<float,2>{0.526615798f, 0.787326396f},
-std::array<float,2>{0.303194284f, 0.962785542f},
-std::array<float,2>{0.66659838f, 0.463558972f},
-std::array<float,2>{0.121023655f, 0.0939759463f},
-std::array<float,2>{0.878783405f, 0.646592259f},
-std::array<float,2>{0.462626845f, 0.710609257f},
-std::array<float,2>{0.585605741f, 0.00368977198f},
-std::array<float,2>{0.238369226f, 0.405074716f},
-std::array<float,2>{0.859940052f, 0.932802558f},
-std::array<float,2>{0.052006226f, 0.816959679f},
-std::array<float,2>{0.978137612f, 0.276248038f},
-std::array<float,2>{0.326222181f, 0.231984511f},
-std::array<float,2>{0.74600482f, 0.576567769f},
-std::array<float,2>{0.0700927973f, 0.685567498f},
-std::array<float,2>{0.931791484f, 0.0637695342f},
-std::array<float,2>{0.278986663f, 0.476055592f},
-std::array<float,2>{0.625181139f, 0.972729981f},
-std::array<float,2>{0.429925948f, 0.756810665f},
-std::array<float,2>{0.554778099f, 0.343653858f},
-std::array<float,2>{0.162882179f, 0.147575215f},
-std::array<float,2>{0.796295345f, 0.515380442f},
-std::array<float,2>{0.344742149f, 0.613417387f},
-std::array<float,2>{0.71150285f, 0.194836393f},
-std::array<float,2>{0.0205203854f, 0.308248788f},
-std::array<float,2>{0.940174639f, 0.850345016f},
-std::array<float,2>{0.203234524f, 0.881899297f},
-std::array<float,2>{0.829908669f, 0.432602823f},
-std::array<float,2>{0.487321198f, 0.0476170406f},
-std::array<float,2>{0.610695958f, 0.7431885f},
-std::array<float,2>{0.165533245f, 0.652165771f},
-std::array<float,2>{0.785349727f, 0.102594309f},
-std::array<float,2>{0.422399402f, 0.455192089f},
-std::array<float,2>{0.554413617f, 0.957781494f},
-std::array<float,2>{0.273040593f, 0.79524672f},
-std::array<float,2>{0.636052787f, 0.37150389f},
-std::array<float,2>{0.0780550465f, 0.159706026f},
-std::array<float,2>{0.924039066f, 0.557287037f},
-std::array<float,2>{0.497347862f, 0.562865317f},
-std::array<float,2>{0.618276119f, 0.225438148f},
-std::array<float,2>{0.216190591f, 0.268760711f},
-std::array<float,2>{0.840865254f, 0.824146032f},
-std::array<float,2>{0.0259314217f, 0.925736606f},
-std::array<float,2>{0.948664427f, 0.394158155f},
-std::array<float,2>{0.355260104f, 0.00917097926f},
-std::array<float,2>{0.704441488f, 0.718005538f},
-std::array<float,2>{0.111777626f, 0.500527322f},
-std::array<float,2>{0.888959169f, 0.155341998f},
-std::array<float,2>{0.308517694f, 0.329835147f},
-std::array<float,2>{0.662006736f, 0.758646727f},
-std::array<float,2>{0.399196357f, 0.981131613f},
-std::array<float,2>{0.519724607f, 0.484180093f},
-std::array<float,2>{0.136924505f, 0.070356749f},
-std::array<float,2>{0.774941623f, 0.675159514f},
-std::array<float,2>{0.313619852f, 0.739226997f},
-std::array<float,2>{0.737746596f, 0.0583920106f},
-std::array<float,2>{0.058131773f, 0.424388617f},
-std::array<float,2>{0.975552917f, 0.882833719f},
-std::array<float,2>{0.242364854f, 0.855852485f},
-std::array<float,2>{0.872337937f, 0.300253034f},
-std::array<float,2>{0.458718926f, 0.199219853f},
-std::array<float,2>{0.587855518f, 0.622168958f},
-std::array<float,2>{0.191937014f, 0.606293142f},
-std::array<float,2>{0.815955222f, 0.216678262f},
-std::array<float,2>{0.472370893f, 0.281738609f},
-std::array<float,2>{0.605187595f, 0.872528255f},
-std::array<float,2>{0.367044568f, 0.901357412f},
-std::array<float,2>{0.694332182f, 0.414327204f},
-std::array<float,2>{0.00796265062f, 0.037712995f},
-std::array<float,2>{0.95492959f, 0.724512756f},
-std::array<float,2>{0.414426416f, 0.669894159f},
-std::array<float,2>{0.538655639f, 0.0913219377f},
-std::array<float,2>{0.184298292f, 0.49397397f},
-std::array<float,2>{0.81122911f, 0.990368307f},
-std::array<float,2>{0.0934606344f, 0.773671508f},
-std::array<float,2>{0.910065413f, 0.322076291f},
-std::array<float,2>{0.252043515f, 0.136015669f},
-std::array<float,2>{0.64542377f, 0.522369862f},
-std::array<float,2>{0.0428833142f, 0.694136083f},
-std::array<float,2>{0.999186814f, 0.0262226965f},
-std::array<float,2>{0.333357066f, 0.381251156f},
-std::array<float,2>{0.726984739f, 0.920352936f},
-std::array<float,2>{0.448455572f, 0.834257901f},
-std::array<float,2>{0.567073524f, 0.258173317f},
-std::array<float,2>{0.226392582f, 0.23467803f},
-std::array<float,2>{0.849154294f, 0.592173338f},
-std::array<float,2>{0.288612187f, 0.534521043f},
-std::array<float,2>{0.678405643f, 0.180356488f},
-std::array<float,2>{0.101541065f, 0.355594426f},
-std::array<float,2>{0.890774786f, 0.802533209f},
-std::array<float,2>{0.150005758f, 0.946124375f},
-std::array<float,2>{0.764926672f, 0.445836335f},
-std::array<float,2>{0.379621357f, 0.115093604f},
-std::array<float,2>{0.504370213f, 0.636452317f}}
\ No newline at end of file
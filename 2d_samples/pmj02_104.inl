@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.226868093f, 0.935588717f},
-std::array<float,2>{0.853659749f, 0.124209732f},
-std::array<float,2>{0.462483406f, 0.387956947f},
-std::array<float,2>{0.650402546f, 0.583775043f},
-std::array<float,2>{0.272007674f, 0.628739536f},
-std::array<float,2>{0.619789362f, 0.262731522f},
-std::array<float,2>{0.0782877579f, 0.221877709f},
-std::array<float,2>{0.914625883f, 0.819679141f},
-std::array<float,2>{0.0225136392f, 0.553866863f},
-std::array<float,2>{0.992237628f, 0.493806183f},
-std::array<float,2>{0.320817322f, 0.0514864251f},
-std::array<float,2>{0.505006909f, 0.996082902f},
-std::array<float,2>{0.418821365f, 0.761864901f},
-std::array<float,2>{0.694395185f, 0.131206498f},
-std::array<float,2>{0.184551328f, 0.320537299f},
-std::array<float,2>{0.778249025f, 0.745749772f},
-std::array<float,2>{0.111124262f, 0.850437522f},
-std::array<float,2>{0.900909305f, 0.203599602f},
-std::array<float,2>{0.301515162f, 0.308973134f},
-std::array<float,2>{0.590102673f, 0.671795309f},
-std::array<float,2>{0.488945931f, 0.612188399f},
-std::array<float,2>{0.658491075f, 0.428418279f},
-std::array<float,2>{0.208285958f, 0.0728127286f},
-std::array<float,2>{0.824700952f, 0.888619423f},
-std::array<float,2>{0.137378141f, 0.710182488f},
-std::array<float,2>{0.794169366f, 0.36555618f},
-std::array<float,2>{0.377150863f, 0.178452075f},
-std::array<float,2>{0.744713664f, 0.799411654f},
-std::array<float,2>{0.347196966f, 0.942456186f},
-std::array<float,2>{0.557552755f, 0.0130996918f},
-std::array<float,2>{0.0617019758f, 0.451793581f},
-std::array<float,2>{0.951900244f, 0.524275601f},
-std::array<float,2>{0.0439401381f, 0.980912805f},
-std::array<float,2>{0.955909073f, 0.0323609933f},
-std::array<float,2>{0.374207288f, 0.477151096f},
-std::array<float,2>{0.538075924f, 0.54175514f},
-std::array<float,2>{0.395660013f, 0.730238378f},
-std::array<float,2>{0.720078111f, 0.331712902f},
-std::array<float,2>{0.15384376f, 0.146048814f},
-std::array<float,2>{0.801256478f, 0.770594954f},
-std::array<float,2>{0.193608686f, 0.569576025f},
-std::array<float,2>{0.841341674f, 0.404203326f},
-std::array<float,2>{0.470656127f, 0.0939206928f},
-std::array<float,2>{0.677591145f, 0.92129004f},
-std::array<float,2>{0.281695366f, 0.833909273f},
-std::array<float,2>{0.570247769f, 0.249321774f},
-std::array<float,2>{0.0962340012f, 0.274611294f},
-std::array<float,2>{0.87522161f, 0.650378883f},
-std::array<float,2>{0.166003749f, 0.790757358f},
-std::array<float,2>{0.75511837f, 0.165045351f},
-std::array<float,2>{0.431425691f, 0.353547633f},
-std::array<float,2>{0.714645386f, 0.697146416f},
-std::array<float,2>{0.339497745f, 0.501898646f},
-std::array<float,2>{0.528997481f, 0.463002503f},
-std::array<float,2>{0.00268627889f, 0.0179057848f},
-std::array<float,2>{0.979793429f, 0.961928844f},
-std::array<float,2>{0.0779012442f, 0.684437692f},
-std::array<float,2>{0.927511394f, 0.293407559f},
-std::array<float,2>{0.264541626f, 0.191171348f},
-std::array<float,2>{0.595272541f, 0.8648054f},
-std::array<float,2>{0.446741223f, 0.894676089f},
-std::array<float,2>{0.640276074f, 0.0797106624f},
-std::array<float,2>{0.243434668f, 0.408934236f},
-std::array<float,2>{0.864068508f, 0.601511419f},
-std::array<float,2>{0.144413173f, 0.959442794f},
-std::array<float,2>{0.812490523f, 0.0312095284f},
-std::array<float,2>{0.399417907f, 0.456453919f},
-std::array<float,2>{0.729159117f, 0.512259066f},
-std::array<float,2>{0.360007823f, 0.694856763f},
-std::array<float,2>{0.542860687f, 0.348003775f},
-std::array<float,2>{0.0374734402f, 0.162397176f},
-std::array<float,2>{0.962809145f, 0.786993504f},
-std::array<float,2>{0.107013643f, 0.608872294f},
-std::array<float,2>{0.89001441f, 0.416394502f},
-std::array<float,2>{0.293495804f, 0.0876893401f},
-std::array<float,2>{0.575961292f, 0.903608978f},
-std::array<float,2>{0.479103565f, 0.871943057f},
-std::array<float,2>{0.681410074f, 0.199539453f},
-std::array<float,2>{0.20112884f, 0.284420967f},
-std::array<float,2>{0.828545928f, 0.673282027f},
-std::array<float,2>{0.0139720133f, 0.776276052f},
-std::array<float,2>{0.976289272f, 0.155174643f},
-std::array<float,2>{0.328341722f, 0.342524588f},
-std::array<float,2>{0.517937183f, 0.724221408f},
-std::array<float,2>{0.42388019f, 0.534348726f},
-std::array<float,2>{0.710518122f, 0.469197303f},
-std::array<float,2>{0.158187509f, 0.044658795f},
-std::array<float,2>{0.757910907f, 0.975186408f},
-std::array<float,2>{0.239185557f, 0.646194398f},
-std::array<float,2>{0.872624576f, 0.268965721f},
-std::array<float,2>{0.439511746f, 0.236422047f},
-std::array<float,2>{0.631919682f, 0.840936124f},
-std::array<float,2>{0.250189781f, 0.908295453f},
-std::array<float,2>{0.604811072f, 0.107592881f},
-std::array<float,2>{0.0644669384f, 0.396838337f},
-std::array<float,2>{0.937497795f, 0.572848022f},
-std::array<float,2>{0.0875687152f, 0.875073314f},
-std::array<float,2>{0.909516931f, 0.0674993917f},
-std::array<float,2>{0.277383417f, 0.437406719f},
-std::array<float,2>{0.613136232f, 0.623480082f},
-std::array<float,2>{0.457678974f, 0.662883639f},
-std::array<float,2>{0.645327032f, 0.300192416f},
-std::array<float,2>{0.223598391f, 0.214539886f},
-std::array<float,2>{0.844543815f, 0.85207665f},
-std::array<float,2>{0.178552836f, 0.519999623f},
-std::array<float,2>{0.769601107f, 0.444093168f},
-std::array<float,2>{0.412706554f, 0.00613860879f},
-std::array<float,2>{0.698355019f, 0.948313117f},
-std::array<float,2>{0.316177011f, 0.804807425f},
-std::array<float,2>{0.51308161f, 0.180655107f},
-std::array<float,2>{0.0284161083f, 0.373376608f},
-std::array<float,2>{0.985502064f, 0.716565311f},
-std::array<float,2>{0.216622859f, 0.822686076f},
-std::array<float,2>{0.814127386f, 0.230428651f},
-std::array<float,2>{0.499991775f, 0.252429992f},
-std::array<float,2>{0.664776683f, 0.636683822f},
-std::array<float,2>{0.30872795f, 0.592155516f},
-std::array<float,2>{0.582982957f, 0.376773864f},
-std::array<float,2>{0.120873898f, 0.115418382f},
-std::array<float,2>{0.895541549f, 0.923978806f},
-std::array<float,2>{0.0521459654f, 0.742043138f},
-std::array<float,2>{0.943498909f, 0.318078935f},
-std::array<float,2>{0.353688568f, 0.133313566f},
-std::array<float,2>{0.551567793f, 0.755441129f},
-std::array<float,2>{0.38701418f, 0.987130463f},
-std::array<float,2>{0.740164816f, 0.0616731383f},
-std::array<float,2>{0.132260218f, 0.491978884f},
-std::array<float,2>{0.782427311f, 0.558338761f},
-std::array<float,2>{0.182112396f, 0.899289668f},
-std::array<float,2>{0.775710285f, 0.0912207142f},
-std::array<float,2>{0.41759178f, 0.418015391f},
-std::array<float,2>{0.691330016f, 0.602595747f},
-std::array<float,2>{0.326370597f, 0.676745892f},
-std::array<float,2>{0.5003075f, 0.288086236f},
-std::array<float,2>{0.0173889622f, 0.19806917f},
-std::array<float,2>{0.997464299f, 0.868921161f},
-std::array<float,2>{0.0835240781f, 0.509196639f},
-std::array<float,2>{0.921823084f, 0.460519314f},
-std::array<float,2>{0.269206285f, 0.0264113359f},
-std::array<float,2>{0.624439716f, 0.956363678f},
-std::array<float,2>{0.465410173f, 0.782932043f},
-std::array<float,2>{0.654938519f, 0.157275066f},
-std::array<float,2>{0.23084718f, 0.344641685f},
-std::array<float,2>{0.858278334f, 0.69124186f},
-std::array<float,2>{0.0551281422f, 0.83725208f},
-std::array<float,2>{0.948733151f, 0.240837634f},
-std::array<float,2>{0.349109918f, 0.270092875f},
-std::array<float,2>{0.55881393f, 0.642982244f},
-std::array<float,2>{0.379941821f, 0.574258566f},
-std::array<float,2>{0.749167681f, 0.394297957f},
-std::array<float,2>{0.135986537f, 0.104627557f},
-std::array<float,2>{0.790984392f, 0.911260068f},
-std::array<float,2>{0.204188138f, 0.72162956f},
-std::array<float,2>{0.822625577f, 0.339010358f},
-std::array<float,2>{0.485034734f, 0.148488745f},
-std::array<float,2>{0.663612843f, 0.779683948f},
-std::array<float,2>{0.299358964f, 0.969242811f},
-std::array<float,2>{0.588761449f, 0.0396104641f},
-std::array<float,2>{0.114962474f, 0.474180877f},
-std::array<float,2>{0.903412461f, 0.537897229f},
-std::array<float,2>{0.0987633467f, 0.952053189f},
-std::array<float,2>{0.880310833f, 0.000115891715f},
-std::array<float,2>{0.285812616f, 0.440028816f},
-std::array<float,2>{0.563481808f, 0.518484294f},
-std::array<float,2>{0.472867191f, 0.714702427f},
-std::array<float,2>{0.673120022f, 0.37029621f},
-std::array<float,2>{0.189055279f, 0.185652658f},
-std::array<float,2>{0.836043596f, 0.812255442f},
-std::array<float,2>{0.151284054f, 0.618310988f},
-std::array<float,2>{0.799166262f, 0.432589978f},
-std::array<float,2>{0.394378185f, 0.0654133186f},
-std::array<float,2>{0.724166811f, 0.879996479f},
-std::array<float,2>{0.36846146f, 0.858102441f},
-std::array<float,2>{0.534559727f, 0.217263713f},
-std::array<float,2>{0.0398764759f, 0.301103801f},
-std::array<float,2>{0.957474768f, 0.658843815f},
-std::array<float,2>{0.246699736f, 0.752374411f},
-std::array<float,2>{0.85959065f, 0.139340013f},
-std::array<float,2>{0.450762331f, 0.315225691f},
-std::array<float,2>{0.635818779f, 0.736815691f},
-std::array<float,2>{0.260255933f, 0.560392022f},
-std::array<float,2>{0.599903941f, 0.487308502f},
-std::array<float,2>{0.0737430304f, 0.056774769f},
-std::array<float,2>{0.923097432f, 0.989066184f},
-std::array<float,2>{0.00502618495f, 0.637682319f},
-std::array<float,2>{0.982970476f, 0.257648379f},
-std::array<float,2>{0.340701252f, 0.231600806f},
-std::array<float,2>{0.526758969f, 0.825655937f},
-std::array<float,2>{0.43735224f, 0.928109884f},
-std::array<float,2>{0.717232645f, 0.112239338f},
-std::array<float,2>{0.169243276f, 0.382134348f},
-std::array<float,2>{0.753123701f, 0.586564422f},
-std::array<float,2>{0.196942121f, 0.997957289f},
-std::array<float,2>{0.834186554f, 0.0491697825f},
-std::array<float,2>{0.482852638f, 0.497781456f},
-std::array<float,2>{0.685653031f, 0.549317777f},
-std::array<float,2>{0.291238278f, 0.74674958f},
-std::array<float,2>{0.573257744f, 0.327797145f},
-std::array<float,2>{0.101641037f, 0.125865921f},
-std::array<float,2>{0.886537969f, 0.758176982f},
-std::array<float,2>{0.0314782225f, 0.578499556f},
-std::array<float,2>{0.96750319f, 0.384780407f},
-std::array<float,2>{0.364430934f, 0.119899385f},
-std::array<float,2>{0.544850767f, 0.93348676f},
-std::array<float,2>{0.403825223f, 0.814353526f},
-std::array<float,2>{0.730575919f, 0.224678472f},
-std::array<float,2>{0.147943929f, 0.26133731f},
-std::array<float,2>{0.808392048f, 0.631806731f},
-std::array<float,2>{0.0702002272f, 0.801148772f},
-std::array<float,2>{0.931854308f, 0.175596878f},
-std::array<float,2>{0.257613182f, 0.363083452f},
-std::array<float,2>{0.606173217f, 0.704476655f},
-std::array<float,2>{0.444108278f, 0.529988229f},
-std::array<float,2>{0.625642002f, 0.44538492f},
-std::array<float,2>{0.23455222f, 0.011415083f},
-std::array<float,2>{0.869817019f, 0.94009769f},
-std::array<float,2>{0.161588907f, 0.665771842f},
-std::array<float,2>{0.762395918f, 0.305588007f},
-std::array<float,2>{0.427608281f, 0.208831131f},
-std::array<float,2>{0.706239641f, 0.847553849f},
-std::array<float,2>{0.335793585f, 0.883731782f},
-std::array<float,2>{0.521489918f, 0.0756426752f},
-std::array<float,2>{0.0103837037f, 0.425308704f},
-std::array<float,2>{0.972337186f, 0.614561737f},
-std::array<float,2>{0.0253602061f, 0.916582644f},
-std::array<float,2>{0.991081417f, 0.0990753695f},
-std::array<float,2>{0.317287117f, 0.401908696f},
-std::array<float,2>{0.510515392f, 0.566260993f},
-std::array<float,2>{0.409185529f, 0.652955234f},
-std::array<float,2>{0.702331603f, 0.278310508f},
-std::array<float,2>{0.174775347f, 0.245247141f},
-std::array<float,2>{0.767008722f, 0.828269064f},
-std::array<float,2>{0.22015126f, 0.544388592f},
-std::array<float,2>{0.850044072f, 0.480896384f},
-std::array<float,2>{0.455224246f, 0.0375790931f},
-std::array<float,2>{0.641918242f, 0.979241073f},
-std::array<float,2>{0.273676902f, 0.768673956f},
-std::array<float,2>{0.616397142f, 0.140657321f},
-std::array<float,2>{0.0906610638f, 0.335867316f},
-std::array<float,2>{0.912215173f, 0.731637895f},
-std::array<float,2>{0.127539799f, 0.861864388f},
-std::array<float,2>{0.786175013f, 0.192867801f},
-std::array<float,2>{0.383885533f, 0.291542351f},
-std::array<float,2>{0.734717607f, 0.680953741f},
-std::array<float,2>{0.355659932f, 0.595640421f},
-std::array<float,2>{0.550289571f, 0.413505465f},
-std::array<float,2>{0.0500434637f, 0.0829877779f},
-std::array<float,2>{0.938719094f, 0.894025862f},
-std::array<float,2>{0.124571875f, 0.702161252f},
-std::array<float,2>{0.890724421f, 0.357430071f},
-std::array<float,2>{0.306058496f, 0.168309867f},
-std::array<float,2>{0.578692615f, 0.796104252f},
-std::array<float,2>{0.495652348f, 0.968249261f},
-std::array<float,2>{0.671797454f, 0.0230231006f},
-std::array<float,2>{0.214270979f, 0.467496276f},
-std::array<float,2>{0.81849575f, 0.505051672f},
-std::array<float,2>{0.209843382f, 0.889010608f},
-std::array<float,2>{0.827165067f, 0.0716713443f},
-std::array<float,2>{0.491317749f, 0.427494913f},
-std::array<float,2>{0.656972468f, 0.609416485f},
-std::array<float,2>{0.304492712f, 0.668802381f},
-std::array<float,2>{0.592728496f, 0.312363386f},
-std::array<float,2>{0.111951552f, 0.205684155f},
-std::array<float,2>{0.899517477f, 0.849273205f},
-std::array<float,2>{0.0591345355f, 0.52732414f},
-std::array<float,2>{0.950790644f, 0.44990027f},
-std::array<float,2>{0.345355392f, 0.0139099192f},
-std::array<float,2>{0.554923534f, 0.945220172f},
-std::array<float,2>{0.375746995f, 0.798344612f},
-std::array<float,2>{0.744130552f, 0.177270859f},
-std::array<float,2>{0.140212402f, 0.364479244f},
-std::array<float,2>{0.795098245f, 0.707630754f},
-std::array<float,2>{0.0813401639f, 0.816614747f},
-std::array<float,2>{0.917869627f, 0.220134124f},
-std::array<float,2>{0.269551665f, 0.265585214f},
-std::array<float,2>{0.617586017f, 0.626128137f},
-std::array<float,2>{0.463356048f, 0.584929824f},
-std::array<float,2>{0.648654878f, 0.389549792f},
-std::array<float,2>{0.229080096f, 0.122153223f},
-std::array<float,2>{0.851626456f, 0.935237408f},
-std::array<float,2>{0.186817244f, 0.743085325f},
-std::array<float,2>{0.781207263f, 0.323212206f},
-std::array<float,2>{0.421161562f, 0.130590141f},
-std::array<float,2>{0.691603363f, 0.7652632f},
-std::array<float,2>{0.322517157f, 0.992942452f},
-std::array<float,2>{0.505874097f, 0.0528238527f},
-std::array<float,2>{0.0210339036f, 0.494673997f},
-std::array<float,2>{0.99432838f, 0.551068962f},
-std::array<float,2>{0.0002968669f, 0.964402616f},
-std::array<float,2>{0.977786541f, 0.0170328394f},
-std::array<float,2>{0.337290406f, 0.462603867f},
-std::array<float,2>{0.52994138f, 0.502811134f},
-std::array<float,2>{0.432248652f, 0.69844389f},
-std::array<float,2>{0.712086797f, 0.352613747f},
-std::array<float,2>{0.166913375f, 0.16624321f},
-std::array<float,2>{0.7559008f, 0.792407632f},
-std::array<float,2>{0.244253427f, 0.598114133f},
-std::array<float,2>{0.865423977f, 0.40691635f},
-std::array<float,2>{0.448272407f, 0.0807173774f},
-std::array<float,2>{0.637819231f, 0.898272812f},
-std::array<float,2>{0.261787981f, 0.865733385f},
-std::array<float,2>{0.597573698f, 0.188385949f},
-std::array<float,2>{0.0744243488f, 0.296161592f},
-std::array<float,2>{0.928008795f, 0.68722254f},
-std::array<float,2>{0.155732438f, 0.77284646f},
-std::array<float,2>{0.802847743f, 0.147597119f},
-std::array<float,2>{0.397108376f, 0.328624725f},
-std::array<float,2>{0.721061885f, 0.726687491f},
-std::array<float,2>{0.371930927f, 0.539273381f},
-std::array<float,2>{0.535247147f, 0.479435265f},
-std::array<float,2>{0.0453001559f, 0.0345606357f},
-std::array<float,2>{0.954818726f, 0.982940674f},
-std::array<float,2>{0.0953220502f, 0.652264953f},
-std::array<float,2>{0.877748132f, 0.27660957f},
-std::array<float,2>{0.283848405f, 0.246863157f},
-std::array<float,2>{0.568139076f, 0.834098339f},
-std::array<float,2>{0.472582161f, 0.918539822f},
-std::array<float,2>{0.678445458f, 0.0973899662f},
-std::array<float,2>{0.193025544f, 0.405504704f},
-std::array<float,2>{0.843382001f, 0.567084312f},
-std::array<float,2>{0.159149304f, 0.973807335f},
-std::array<float,2>{0.760241389f, 0.0451895483f},
-std::array<float,2>{0.422545165f, 0.471314162f},
-std::array<float,2>{0.707848072f, 0.53279376f},
-std::array<float,2>{0.330443859f, 0.725445151f},
-std::array<float,2>{0.517563343f, 0.33990249f},
-std::array<float,2>{0.0122079207f, 0.154254258f},
-std::array<float,2>{0.973399639f, 0.773844182f},
-std::array<float,2>{0.0640919581f, 0.571581721f},
-std::array<float,2>{0.935097873f, 0.394631475f},
-std::array<float,2>{0.252259761f, 0.106736444f},
-std::array<float,2>{0.602107525f, 0.907979369f},
-std::array<float,2>{0.438038766f, 0.84304285f},
-std::array<float,2>{0.62914753f, 0.234493598f},
-std::array<float,2>{0.240536407f, 0.266127676f},
-std::array<float,2>{0.874926329f, 0.648287773f},
-std::array<float,2>{0.0356541201f, 0.788742721f},
-std::array<float,2>{0.964477241f, 0.160477653f},
-std::array<float,2>{0.361330301f, 0.35035941f},
-std::array<float,2>{0.539346159f, 0.692736506f},
-std::array<float,2>{0.400719672f, 0.514039755f},
-std::array<float,2>{0.728133202f, 0.453758836f},
-std::array<float,2>{0.142261758f, 0.027744798f},
-std::array<float,2>{0.810227871f, 0.957824051f},
-std::array<float,2>{0.20216386f, 0.675277054f},
-std::array<float,2>{0.831249893f, 0.282753825f},
-std::array<float,2>{0.477885991f, 0.202233672f},
-std::array<float,2>{0.682317376f, 0.87447387f},
-std::array<float,2>{0.296338946f, 0.905299902f},
-std::array<float,2>{0.576978147f, 0.0891275853f},
-std::array<float,2>{0.108571798f, 0.414214641f},
-std::array<float,2>{0.887325764f, 0.606140912f},
-std::array<float,2>{0.119085044f, 0.922406018f},
-std::array<float,2>{0.898174286f, 0.113765873f},
-std::array<float,2>{0.312351704f, 0.377614886f},
-std::array<float,2>{0.584446251f, 0.590914011f},
-std::array<float,2>{0.496436328f, 0.634446502f},
-std::array<float,2>{0.667214036f, 0.251414329f},
-std::array<float,2>{0.218230769f, 0.227309048f},
-std::array<float,2>{0.814545333f, 0.820825458f},
-std::array<float,2>{0.130540714f, 0.55565691f},
-std::array<float,2>{0.784470499f, 0.488632143f},
-std::array<float,2>{0.389661342f, 0.0602715649f},
-std::array<float,2>{0.741824687f, 0.984406769f},
-std::array<float,2>{0.352885962f, 0.757350922f},
-std::array<float,2>{0.553078055f, 0.135639682f},
-std::array<float,2>{0.0541832671f, 0.320060939f},
-std::array<float,2>{0.942641497f, 0.738428235f},
-std::array<float,2>{0.22485742f, 0.855388045f},
-std::array<float,2>{0.846323907f, 0.212685153f},
-std::array<float,2>{0.4592444f, 0.298789829f},
-std::array<float,2>{0.648283124f, 0.661436558f},
-std::array<float,2>{0.279737771f, 0.621112287f},
-std::array<float,2>{0.610976517f, 0.435110658f},
-std::array<float,2>{0.0897525847f, 0.0697645992f},
-std::array<float,2>{0.907173812f, 0.877081096f},
-std::array<float,2>{0.0298530571f, 0.718348622f},
-std::array<float,2>{0.986506402f, 0.371768594f},
-std::array<float,2>{0.314260155f, 0.183173209f},
-std::array<float,2>{0.515434206f, 0.806711555f},
-std::array<float,2>{0.410869956f, 0.94667232f},
-std::array<float,2>{0.695340872f, 0.00552978832f},
-std::array<float,2>{0.176788315f, 0.442005396f},
-std::array<float,2>{0.772126198f, 0.522495031f},
-std::array<float,2>{0.13410157f, 0.913220525f},
-std::array<float,2>{0.79210192f, 0.103018813f},
-std::array<float,2>{0.382640779f, 0.391722649f},
-std::array<float,2>{0.746747553f, 0.577063322f},
-std::array<float,2>{0.350969434f, 0.641076088f},
-std::array<float,2>{0.561615705f, 0.272637635f},
-std::array<float,2>{0.0582030192f, 0.240074262f},
-std::array<float,2>{0.946584582f, 0.837940216f},
-std::array<float,2>{0.116773143f, 0.53581655f},
-std::array<float,2>{0.904301882f, 0.475321263f},
-std::array<float,2>{0.297636777f, 0.0422705673f},
-std::array<float,2>{0.587148964f, 0.971113205f},
-std::array<float,2>{0.487923712f, 0.77759701f},
-std::array<float,2>{0.661532819f, 0.151833683f},
-std::array<float,2>{0.205453455f, 0.336590767f},
-std::array<float,2>{0.821762562f, 0.719046712f},
-std::array<float,2>{0.0192061383f, 0.869867206f},
-std::array<float,2>{0.99823612f, 0.196854681f},
-std::array<float,2>{0.324880332f, 0.28532055f},
-std::array<float,2>{0.50328511f, 0.678669453f},
-std::array<float,2>{0.41538164f, 0.605185747f},
-std::array<float,2>{0.688143849f, 0.421156406f},
-std::array<float,2>{0.180713877f, 0.0925705209f},
-std::array<float,2>{0.774260998f, 0.902172685f},
-std::array<float,2>{0.233002558f, 0.687572181f},
-std::array<float,2>{0.85659188f, 0.34676972f},
-std::array<float,2>{0.46825406f, 0.158759713f},
-std::array<float,2>{0.653007507f, 0.783616006f},
-std::array<float,2>{0.267142862f, 0.953154981f},
-std::array<float,2>{0.621347785f, 0.0250622015f},
-std::array<float,2>{0.0840608329f, 0.458264977f},
-std::array<float,2>{0.918145001f, 0.509822369f},
-std::array<float,2>{0.070740886f, 0.991388083f},
-std::array<float,2>{0.924400806f, 0.0563760586f},
-std::array<float,2>{0.258069485f, 0.485567898f},
-std::array<float,2>{0.599043429f, 0.562457681f},
-std::array<float,2>{0.451336086f, 0.735455275f},
-std::array<float,2>{0.633852899f, 0.312977761f},
-std::array<float,2>{0.249927729f, 0.138650149f},
-std::array<float,2>{0.861827791f, 0.751803756f},
-std::array<float,2>{0.171851754f, 0.58824259f},
-std::array<float,2>{0.751929641f, 0.380558163f},
-std::array<float,2>{0.433826298f, 0.109946668f},
-std::array<float,2>{0.716607153f, 0.927101135f},
-std::array<float,2>{0.342371225f, 0.826632857f},
-std::array<float,2>{0.524406493f, 0.233133778f},
-std::array<float,2>{0.00662120571f, 0.254845202f},
-std::array<float,2>{0.982001305f, 0.639297187f},
-std::array<float,2>{0.191319421f, 0.808945f},
-std::array<float,2>{0.839091182f, 0.18419303f},
-std::array<float,2>{0.476092786f, 0.369029343f},
-std::array<float,2>{0.675729752f, 0.712587297f},
-std::array<float,2>{0.28766048f, 0.516358972f},
-std::array<float,2>{0.565883279f, 0.439083517f},
-std::array<float,2>{0.100989327f, 0.00272350642f},
-std::array<float,2>{0.881381869f, 0.949431956f},
-std::array<float,2>{0.0411729328f, 0.657333732f},
-std::array<float,2>{0.959150314f, 0.303753704f},
-std::array<float,2>{0.370158046f, 0.216193974f},
-std::array<float,2>{0.532514155f, 0.857070208f},
-std::array<float,2>{0.391053051f, 0.881047726f},
-std::array<float,2>{0.725692809f, 0.0640357882f},
-std::array<float,2>{0.149590015f, 0.431033522f},
-std::array<float,2>{0.798605502f, 0.621039987f},
-std::array<float,2>{0.238251761f, 0.938598871f},
-std::array<float,2>{0.868655622f, 0.00879596639f},
-std::array<float,2>{0.442458123f, 0.447582096f},
-std::array<float,2>{0.628064513f, 0.529094577f},
-std::array<float,2>{0.254103214f, 0.705507457f},
-std::array<float,2>{0.607955635f, 0.360047817f},
-std::array<float,2>{0.0680860132f, 0.17191346f},
-std::array<float,2>{0.930309117f, 0.803679883f},
-std::array<float,2>{0.0084036421f, 0.615629911f},
-std::array<float,2>{0.9688254f, 0.423796028f},
-std::array<float,2>{0.332403362f, 0.076689072f},
-std::array<float,2>{0.519893885f, 0.88602519f},
-std::array<float,2>{0.428287029f, 0.845569015f},
-std::array<float,2>{0.704495788f, 0.210901797f},
-std::array<float,2>{0.163056538f, 0.306920022f},
-std::array<float,2>{0.763903558f, 0.667497694f},
-std::array<float,2>{0.104553461f, 0.76023066f},
-std::array<float,2>{0.883903682f, 0.128434181f},
-std::array<float,2>{0.289264619f, 0.324954212f},
-std::array<float,2>{0.572165132f, 0.749297857f},
-std::array<float,2>{0.481318384f, 0.547315955f},
-std::array<float,2>{0.684372067f, 0.499527633f},
-std::array<float,2>{0.198766887f, 0.0468933731f},
-std::array<float,2>{0.833768666f, 0.998151481f},
-std::array<float,2>{0.146233708f, 0.630802691f},
-std::array<float,2>{0.805913746f, 0.259636968f},
-std::array<float,2>{0.405957878f, 0.223651931f},
-std::array<float,2>{0.734193444f, 0.815159321f},
-std::array<float,2>{0.365287542f, 0.931084394f},
-std::array<float,2>{0.546356976f, 0.118650816f},
-std::array<float,2>{0.0340428501f, 0.384273082f},
-std::array<float,2>{0.966795564f, 0.581196845f},
-std::array<float,2>{0.0473666564f, 0.890751421f},
-std::array<float,2>{0.94011879f, 0.0842471048f},
-std::array<float,2>{0.359231025f, 0.411271721f},
-std::array<float,2>{0.548554599f, 0.596249938f},
-std::array<float,2>{0.386530787f, 0.68228507f},
-std::array<float,2>{0.737448275f, 0.290591806f},
-std::array<float,2>{0.125805482f, 0.195229143f},
-std::array<float,2>{0.788235605f, 0.860568881f},
-std::array<float,2>{0.211565331f, 0.506658614f},
-std::array<float,2>{0.81653589f, 0.465409398f},
-std::array<float,2>{0.492848545f, 0.0206810273f},
-std::array<float,2>{0.668312132f, 0.965750754f},
-std::array<float,2>{0.308086902f, 0.794538379f},
-std::array<float,2>{0.581589758f, 0.171771154f},
-std::array<float,2>{0.122818731f, 0.355481237f},
-std::array<float,2>{0.893951535f, 0.700496972f},
-std::array<float,2>{0.172983378f, 0.830403209f},
-std::array<float,2>{0.769011617f, 0.242787853f},
-std::array<float,2>{0.407319129f, 0.280653447f},
-std::array<float,2>{0.700447738f, 0.65584451f},
-std::array<float,2>{0.318363041f, 0.562569976f},
-std::array<float,2>{0.508878827f, 0.400048763f},
-std::array<float,2>{0.0259634349f, 0.100493386f},
-std::array<float,2>{0.989476621f, 0.915065765f},
-std::array<float,2>{0.0929333717f, 0.733870983f},
-std::array<float,2>{0.910314441f, 0.332257718f},
-std::array<float,2>{0.276475668f, 0.144283414f},
-std::array<float,2>{0.614646912f, 0.766387582f},
-std::array<float,2>{0.453883022f, 0.977220416f},
-std::array<float,2>{0.642839074f, 0.0360840298f},
-std::array<float,2>{0.221760795f, 0.482996404f},
-std::array<float,2>{0.848272145f, 0.545594573f},
-std::array<float,2>{0.191858172f, 0.920550704f},
-std::array<float,2>{0.842164814f, 0.0956208706f},
-std::array<float,2>{0.471136302f, 0.403195441f},
-std::array<float,2>{0.679148734f, 0.569288135f},
-std::array<float,2>{0.284594208f, 0.649364293f},
-std::array<float,2>{0.566604495f, 0.273810238f},
-std::array<float,2>{0.0939831659f, 0.248320162f},
-std::array<float,2>{0.878582835f, 0.832454562f},
-std::array<float,2>{0.0465983525f, 0.542634785f},
-std::array<float,2>{0.953592837f, 0.478153199f},
-std::array<float,2>{0.372207552f, 0.0313597061f},
-std::array<float,2>{0.536910772f, 0.981892645f},
-std::array<float,2>{0.397883236f, 0.770072043f},
-std::array<float,2>{0.722652733f, 0.145126745f},
-std::array<float,2>{0.1550612f, 0.331015676f},
-std::array<float,2>{0.804616094f, 0.728712201f},
-std::array<float,2>{0.0759330988f, 0.864156365f},
-std::array<float,2>{0.929193199f, 0.189707637f},
-std::array<float,2>{0.26316914f, 0.294717848f},
-std::array<float,2>{0.596103191f, 0.684758544f},
-std::array<float,2>{0.447275251f, 0.600144565f},
-std::array<float,2>{0.636950135f, 0.410025179f},
-std::array<float,2>{0.245644212f, 0.0784237757f},
-std::array<float,2>{0.867047787f, 0.895737767f},
-std::array<float,2>{0.167595237f, 0.695928156f},
-std::array<float,2>{0.757160008f, 0.355120271f},
-std::array<float,2>{0.433294028f, 0.164751247f},
-std::array<float,2>{0.711310565f, 0.789271832f},
-std::array<float,2>{0.33680141f, 0.961615503f},
-std::array<float,2>{0.530776441f, 0.0188287273f},
-std::array<float,2>{0.000989361666f, 0.464398175f},
-std::array<float,2>{0.976819873f, 0.500304759f},
-std::array<float,2>{0.0203985721f, 0.994287252f},
-std::array<float,2>{0.99515605f, 0.0520531498f},
-std::array<float,2>{0.323868185f, 0.493159622f},
-std::array<float,2>{0.507172883f, 0.552912831f},
-std::array<float,2>{0.420500457f, 0.744415164f},
-std::array<float,2>{0.692516625f, 0.322179645f},
-std::array<float,2>{0.185967907f, 0.132662818f},
-std::array<float,2>{0.779885471f, 0.762734294f},
-std::array<float,2>{0.230438009f, 0.582183778f},
-std::array<float,2>{0.852954984f, 0.386912584f},
-std::array<float,2>{0.464495391f, 0.123375051f},
-std::array<float,2>{0.649494708f, 0.936657131f},
-std::array<float,2>{0.27077207f, 0.818891704f},
-std::array<float,2>{0.618219435f, 0.221021369f},
-std::array<float,2>{0.0802655369f, 0.262582123f},
-std::array<float,2>{0.916059017f, 0.627629936f},
-std::array<float,2>{0.139564469f, 0.800631881f},
-std::array<float,2>{0.795984805f, 0.178920865f},
-std::array<float,2>{0.376929373f, 0.36696291f},
-std::array<float,2>{0.742939711f, 0.70974195f},
-std::array<float,2>{0.34385857f, 0.525237978f},
-std::array<float,2>{0.556139767f, 0.452952683f},
-std::array<float,2>{0.0598386861f, 0.0120671112f},
-std::array<float,2>{0.949855804f, 0.941886544f},
-std::array<float,2>{0.112555854f, 0.670279086f},
-std::array<float,2>{0.899401248f, 0.309794605f},
-std::array<float,2>{0.302789241f, 0.204368055f},
-std::array<float,2>{0.592775762f, 0.850783467f},
-std::array<float,2>{0.490297407f, 0.887337387f},
-std::array<float,2>{0.657267749f, 0.0735722482f},
-std::array<float,2>{0.210381076f, 0.429186106f},
-std::array<float,2>{0.826248825f, 0.612972081f},
-std::array<float,2>{0.176114932f, 0.947832227f},
-std::array<float,2>{0.77269876f, 0.00737012317f},
-std::array<float,2>{0.411199391f, 0.445183426f},
-std::array<float,2>{0.696939588f, 0.521371424f},
-std::array<float,2>{0.313126504f, 0.715299547f},
-std::array<float,2>{0.513965964f, 0.374834418f},
-std::array<float,2>{0.030348938f, 0.180861413f},
-std::array<float,2>{0.987908363f, 0.806244731f},
-std::array<float,2>{0.0879799873f, 0.624355316f},
-std::array<float,2>{0.90734601f, 0.436288238f},
-std::array<float,2>{0.280629098f, 0.0667978078f},
-std::array<float,2>{0.609684408f, 0.876642525f},
-std::array<float,2>{0.460277408f, 0.852746904f},
-std::array<float,2>{0.646893442f, 0.213241518f},
-std::array<float,2>{0.225808531f, 0.299207836f},
-std::array<float,2>{0.847191274f, 0.663857639f},
-std::array<float,2>{0.0531080104f, 0.754450738f},
-std::array<float,2>{0.941929996f, 0.13464275f},
-std::array<float,2>{0.352136701f, 0.317232132f},
-std::array<float,2>{0.554643631f, 0.740943491f},
-std::array<float,2>{0.389602959f, 0.557350159f},
-std::array<float,2>{0.741118848f, 0.490543991f},
-std::array<float,2>{0.129117548f, 0.0613446049f},
-std::array<float,2>{0.783298969f, 0.987660646f},
-std::array<float,2>{0.217358008f, 0.634837687f},
-std::array<float,2>{0.815585315f, 0.25312683f},
-std::array<float,2>{0.497706413f, 0.2291141f},
-std::array<float,2>{0.666414917f, 0.823953211f},
-std::array<float,2>{0.311123937f, 0.925560832f},
-std::array<float,2>{0.585118473f, 0.116512679f},
-std::array<float,2>{0.117482513f, 0.375745386f},
-std::array<float,2>{0.897077918f, 0.593442202f},
-std::array<float,2>{0.108028613f, 0.902546763f},
-std::array<float,2>{0.888059556f, 0.0859842747f},
-std::array<float,2>{0.295052767f, 0.41792348f},
-std::array<float,2>{0.577286661f, 0.608101487f},
-std::array<float,2>{0.477464557f, 0.672263741f},
-std::array<float,2>{0.682846308f, 0.284114778f},
-std::array<float,2>{0.201711446f, 0.200388163f},
-std::array<float,2>{0.830364645f, 0.872723758f},
-std::array<float,2>{0.141157284f, 0.513136566f},
-std::array<float,2>{0.809189677f, 0.455637813f},
-std::array<float,2>{0.401465744f, 0.0297681522f},
-std::array<float,2>{0.726654708f, 0.96088022f},
-std::array<float,2>{0.363184839f, 0.785393059f},
-std::array<float,2>{0.540290296f, 0.163262367f},
-std::array<float,2>{0.0368061066f, 0.349155515f},
-std::array<float,2>{0.963521659f, 0.694087267f},
-std::array<float,2>{0.241872922f, 0.840114295f},
-std::array<float,2>{0.873609543f, 0.238030836f},
-std::array<float,2>{0.439335078f, 0.268530548f},
-std::array<float,2>{0.630843401f, 0.644539595f},
-std::array<float,2>{0.253456831f, 0.573502839f},
-std::array<float,2>{0.603004336f, 0.398048401f},
-std::array<float,2>{0.063403286f, 0.108443595f},
-std::array<float,2>{0.934290171f, 0.909493685f},
-std::array<float,2>{0.0134967742f, 0.72327739f},
-std::array<float,2>{0.973781586f, 0.343093455f},
-std::array<float,2>{0.331669003f, 0.156122953f},
-std::array<float,2>{0.516460061f, 0.777115405f},
-std::array<float,2>{0.423353791f, 0.975860059f},
-std::array<float,2>{0.708289921f, 0.0439065285f},
-std::array<float,2>{0.160093099f, 0.470389992f},
-std::array<float,2>{0.76145196f, 0.533261657f},
-std::array<float,2>{0.148792595f, 0.87936455f},
-std::array<float,2>{0.797691882f, 0.0660115406f},
-std::array<float,2>{0.392576009f, 0.432931244f},
-std::array<float,2>{0.724634647f, 0.617939651f},
-std::array<float,2>{0.369575769f, 0.659641147f},
-std::array<float,2>{0.531297028f, 0.302702636f},
-std::array<float,2>{0.0428645611f, 0.218520463f},
-std::array<float,2>{0.960534334f, 0.859035909f},
-std::array<float,2>{0.0997536331f, 0.519258618f},
-std::array<float,2>{0.882348537f, 0.440905958f},
-std::array<float,2>{0.288496733f, 0.00114995439f},
-std::array<float,2>{0.565376878f, 0.952941537f},
-std::array<float,2>{0.475020736f, 0.81083405f},
-std::array<float,2>{0.674022853f, 0.18667154f},
-std::array<float,2>{0.19040513f, 0.36986354f},
-std::array<float,2>{0.838026047f, 0.712951243f},
-std::array<float,2>{0.00708352309f, 0.824234307f},
-std::array<float,2>{0.981072307f, 0.231092289f},
-std::array<float,2>{0.342824787f, 0.256416798f},
-std::array<float,2>{0.524619401f, 0.638147831f},
-std::array<float,2>{0.435437799f, 0.587451518f},
-std::array<float,2>{0.715128362f, 0.38134408f},
-std::array<float,2>{0.170404285f, 0.112416007f},
-std::array<float,2>{0.750340044f, 0.928736389f},
-std::array<float,2>{0.248702437f, 0.738087475f},
-std::array<float,2>{0.862716734f, 0.315692395f},
-std::array<float,2>{0.452318311f, 0.139924541f},
-std::array<float,2>{0.633428156f, 0.753453791f},
-std::array<float,2>{0.259072483f, 0.989278078f},
-std::array<float,2>{0.597673535f, 0.0576420575f},
-std::array<float,2>{0.071322605f, 0.487227559f},
-std::array<float,2>{0.924858987f, 0.55869925f},
-std::array<float,2>{0.0849825069f, 0.95543623f},
-std::array<float,2>{0.919859469f, 0.02552565f},
-std::array<float,2>{0.265969664f, 0.459087193f},
-std::array<float,2>{0.622298419f, 0.507892907f},
-std::array<float,2>{0.467276186f, 0.689724565f},
-std::array<float,2>{0.653588593f, 0.344944119f},
-std::array<float,2>{0.23401767f, 0.157029584f},
-std::array<float,2>{0.855937779f, 0.781928778f},
-std::array<float,2>{0.180558652f, 0.602054f},
-std::array<float,2>{0.774506211f, 0.418999523f},
-std::array<float,2>{0.414193302f, 0.0900168046f},
-std::array<float,2>{0.689444423f, 0.900268734f},
-std::array<float,2>{0.325335413f, 0.867665589f},
-std::array<float,2>{0.50217545f, 0.198561162f},
-std::array<float,2>{0.0178255066f, 0.287154108f},
-std::array<float,2>{0.999092758f, 0.677343786f},
-std::array<float,2>{0.206981972f, 0.780866742f},
-std::array<float,2>{0.820479572f, 0.149417654f},
-std::array<float,2>{0.486820787f, 0.338448793f},
-std::array<float,2>{0.660381019f, 0.722538352f},
-std::array<float,2>{0.298574507f, 0.538334787f},
-std::array<float,2>{0.586514115f, 0.473203123f},
-std::array<float,2>{0.115935691f, 0.0403229631f},
-std::array<float,2>{0.905565619f, 0.970201433f},
-std::array<float,2>{0.0575944185f, 0.643691957f},
-std::array<float,2>{0.945727766f, 0.271085352f},
-std::array<float,2>{0.350338519f, 0.241249606f},
-std::array<float,2>{0.560813427f, 0.836280823f},
-std::array<float,2>{0.381677687f, 0.910367966f},
-std::array<float,2>{0.747972786f, 0.103793569f},
-std::array<float,2>{0.133104071f, 0.392597169f},
-std::array<float,2>{0.791017115f, 0.576161981f},
-std::array<float,2>{0.220772624f, 0.980438828f},
-std::array<float,2>{0.849448442f, 0.0390078872f},
-std::array<float,2>{0.454726577f, 0.482241899f},
-std::array<float,2>{0.644045651f, 0.543779671f},
-std::array<float,2>{0.275515348f, 0.731381953f},
-std::array<float,2>{0.613636851f, 0.334638804f},
-std::array<float,2>{0.0926585123f, 0.142533436f},
-std::array<float,2>{0.912085891f, 0.768108785f},
-std::array<float,2>{0.0265634377f, 0.565428317f},
-std::array<float,2>{0.988895953f, 0.400669545f},
-std::array<float,2>{0.31974861f, 0.0983705074f},
-std::array<float,2>{0.507989466f, 0.917839587f},
-std::array<float,2>{0.406381577f, 0.829141736f},
-std::array<float,2>{0.699842334f, 0.244219303f},
-std::array<float,2>{0.172210664f, 0.279231101f},
-std::array<float,2>{0.7676965f, 0.654288411f},
-std::array<float,2>{0.121439643f, 0.795115709f},
-std::array<float,2>{0.892849445f, 0.169307739f},
-std::array<float,2>{0.307088524f, 0.35898f},
-std::array<float,2>{0.580716133f, 0.702128053f},
-std::array<float,2>{0.493363321f, 0.504437327f},
-std::array<float,2>{0.669562757f, 0.468055516f},
-std::array<float,2>{0.212180763f, 0.021553224f},
-std::array<float,2>{0.817816973f, 0.96740365f},
-std::array<float,2>{0.126238734f, 0.680295527f},
-std::array<float,2>{0.787563324f, 0.292819589f},
-std::array<float,2>{0.385321468f, 0.192178994f},
-std::array<float,2>{0.737229943f, 0.862666547f},
-std::array<float,2>{0.357424349f, 0.892820895f},
-std::array<float,2>{0.547238111f, 0.0833668411f},
-std::array<float,2>{0.0486670136f, 0.412803233f},
-std::array<float,2>{0.940514207f, 0.594417274f},
-std::array<float,2>{0.0346647725f, 0.931943774f},
-std::array<float,2>{0.964856386f, 0.120257534f},
-std::array<float,2>{0.366919696f, 0.386537105f},
-std::array<float,2>{0.545891583f, 0.579745233f},
-std::array<float,2>{0.404696733f, 0.631857336f},
-std::array<float,2>{0.733376682f, 0.260100216f},
-std::array<float,2>{0.144795626f, 0.225606665f},
-std::array<float,2>{0.805571556f, 0.813331902f},
-std::array<float,2>{0.198225573f, 0.550387621f},
-std::array<float,2>{0.832819581f, 0.496187449f},
-std::array<float,2>{0.482345223f, 0.0503160879f},
-std::array<float,2>{0.685089886f, 0.996651828f},
-std::array<float,2>{0.290362597f, 0.759100437f},
-std::array<float,2>{0.571265399f, 0.126201332f},
-std::array<float,2>{0.104465626f, 0.3271088f},
-std::array<float,2>{0.883619308f, 0.747732103f},
-std::array<float,2>{0.163302824f, 0.846324563f},
-std::array<float,2>{0.765184462f, 0.207924873f},
-std::array<float,2>{0.429136962f, 0.306239963f},
-std::array<float,2>{0.703353822f, 0.664184749f},
-std::array<float,2>{0.333403051f, 0.613586366f},
-std::array<float,2>{0.521034002f, 0.424462438f},
-std::array<float,2>{0.00890421309f, 0.0745711774f},
-std::array<float,2>{0.970400155f, 0.884462833f},
-std::array<float,2>{0.0668983087f, 0.703552783f},
-std::array<float,2>{0.931575596f, 0.361744463f},
-std::array<float,2>{0.25553751f, 0.174178317f},
-std::array<float,2>{0.608739138f, 0.802109778f},
-std::array<float,2>{0.442257643f, 0.941026568f},
-std::array<float,2>{0.627384424f, 0.0107069751f},
-std::array<float,2>{0.236800805f, 0.446968794f},
-std::array<float,2>{0.867926061f, 0.53113991f},
-std::array<float,2>{0.242660955f, 0.897362411f},
-std::array<float,2>{0.864423871f, 0.081079036f},
-std::array<float,2>{0.445357502f, 0.407931417f},
-std::array<float,2>{0.638883173f, 0.599403918f},
-std::array<float,2>{0.265167981f, 0.685777903f},
-std::array<float,2>{0.594640136f, 0.295484513f},
-std::array<float,2>{0.0764860287f, 0.188685954f},
-std::array<float,2>{0.926082611f, 0.866372585f},
-std::array<float,2>{0.00372511428f, 0.503190577f},
-std::array<float,2>{0.97891295f, 0.461811543f},
-std::array<float,2>{0.338616014f, 0.0165648963f},
-std::array<float,2>{0.527348638f, 0.96360743f},
-std::array<float,2>{0.429729819f, 0.791224778f},
-std::array<float,2>{0.713079333f, 0.167806506f},
-std::array<float,2>{0.164684236f, 0.352155507f},
-std::array<float,2>{0.754146755f, 0.697388768f},
-std::array<float,2>{0.0968798846f, 0.835303724f},
-std::array<float,2>{0.876265824f, 0.247417331f},
-std::array<float,2>{0.283200771f, 0.276116192f},
-std::array<float,2>{0.568446636f, 0.650795698f},
-std::array<float,2>{0.469408065f, 0.567421138f},
-std::array<float,2>{0.676290572f, 0.405249655f},
-std::array<float,2>{0.195136845f, 0.096244514f},
-std::array<float,2>{0.840096712f, 0.919240594f},
-std::array<float,2>{0.152668744f, 0.728210628f},
-std::array<float,2>{0.801973701f, 0.329352975f},
-std::array<float,2>{0.394572169f, 0.147405639f},
-std::array<float,2>{0.719061494f, 0.771759093f},
-std::array<float,2>{0.373914182f, 0.983809888f},
-std::array<float,2>{0.538644195f, 0.0340089016f},
-std::array<float,2>{0.0444553941f, 0.479526043f},
-std::array<float,2>{0.956314266f, 0.54036653f},
-std::array<float,2>{0.0614316761f, 0.944142222f},
-std::array<float,2>{0.952936769f, 0.0151544865f},
-std::array<float,2>{0.346506923f, 0.450479358f},
-std::array<float,2>{0.558455765f, 0.52599889f},
-std::array<float,2>{0.37847203f, 0.708380759f},
-std::array<float,2>{0.745278835f, 0.363825053f},
-std::array<float,2>{0.138133064f, 0.176084295f},
-std::array<float,2>{0.793104708f, 0.796990216f},
-std::array<float,2>{0.207681149f, 0.610829115f},
-std::array<float,2>{0.825806439f, 0.426447153f},
-std::array<float,2>{0.489999086f, 0.0708716735f},
-std::array<float,2>{0.659444869f, 0.890294552f},
-std::array<float,2>{0.302336991f, 0.847667575f},
-std::array<float,2>{0.591525674f, 0.207017556f},
-std::array<float,2>{0.109770291f, 0.311221153f},
-std::array<float,2>{0.902011275f, 0.669289947f},
-std::array<float,2>{0.185165554f, 0.764611244f},
-std::array<float,2>{0.778757751f, 0.128914833f},
-std::array<float,2>{0.419258028f, 0.323449463f},
-std::array<float,2>{0.694120407f, 0.743452191f},
-std::array<float,2>{0.321292669f, 0.55263716f},
-std::array<float,2>{0.504265785f, 0.49600628f},
-std::array<float,2>{0.0217129085f, 0.0541301295f},
-std::array<float,2>{0.993378758f, 0.993307412f},
-std::array<float,2>{0.0796031132f, 0.625212967f},
-std::array<float,2>{0.915662229f, 0.263747394f},
-std::array<float,2>{0.272905201f, 0.219432324f},
-std::array<float,2>{0.620978951f, 0.817980349f},
-std::array<float,2>{0.461557478f, 0.933678865f},
-std::array<float,2>{0.65232265f, 0.121317193f},
-std::array<float,2>{0.227982327f, 0.389847666f},
-std::array<float,2>{0.855357468f, 0.585372567f},
-std::array<float,2>{0.13091816f, 0.985507071f},
-std::array<float,2>{0.781912327f, 0.059545964f},
-std::array<float,2>{0.388539255f, 0.490014315f},
-std::array<float,2>{0.738896728f, 0.556156397f},
-std::array<float,2>{0.354670376f, 0.739485085f},
-std::array<float,2>{0.552314818f, 0.318716317f},
-std::array<float,2>{0.0515342057f, 0.136514768f},
-std::array<float,2>{0.94518429f, 0.756580114f},
-std::array<float,2>{0.11947833f, 0.590168476f},
-std::array<float,2>{0.894650161f, 0.378168851f},
-std::array<float,2>{0.309830725f, 0.114576943f},
-std::array<float,2>{0.583036721f, 0.923169613f},
-std::array<float,2>{0.498570919f, 0.821579039f},
-std::array<float,2>{0.665337563f, 0.228127018f},
-std::array<float,2>{0.21510759f, 0.250725925f},
-std::array<float,2>{0.813133895f, 0.633190274f},
-std::array<float,2>{0.0279258359f, 0.807742596f},
-std::array<float,2>{0.985084176f, 0.182519302f},
-std::array<float,2>{0.314774901f, 0.372971952f},
-std::array<float,2>{0.512382388f, 0.717075825f},
-std::array<float,2>{0.413215578f, 0.522105157f},
-std::array<float,2>{0.697536528f, 0.442485809f},
-std::array<float,2>{0.178990737f, 0.00392858218f},
-std::array<float,2>{0.771025538f, 0.94589293f},
-std::array<float,2>{0.224213392f, 0.660682321f},
-std::array<float,2>{0.845155478f, 0.296898633f},
-std::array<float,2>{0.458431512f, 0.211677745f},
-std::array<float,2>{0.645790279f, 0.853718042f},
-std::array<float,2>{0.278377384f, 0.877993762f},
-std::array<float,2>{0.612109184f, 0.0686179399f},
-std::array<float,2>{0.0867074206f, 0.433924854f},
-std::array<float,2>{0.908702374f, 0.622714102f},
-std::array<float,2>{0.0655774698f, 0.906608164f},
-std::array<float,2>{0.936513484f, 0.105984889f},
-std::array<float,2>{0.25161621f, 0.396429747f},
-std::array<float,2>{0.604304731f, 0.570821524f},
-std::array<float,2>{0.44050616f, 0.64745003f},
-std::array<float,2>{0.630918264f, 0.266791284f},
-std::array<float,2>{0.239962444f, 0.235846788f},
-std::array<float,2>{0.87145716f, 0.84218359f},
-std::array<float,2>{0.156540006f, 0.531321704f},
-std::array<float,2>{0.759281039f, 0.472095251f},
-std::array<float,2>{0.425427526f, 0.0460407101f},
-std::array<float,2>{0.709493577f, 0.972755015f},
-std::array<float,2>{0.329105079f, 0.775149167f},
-std::array<float,2>{0.518835008f, 0.153208792f},
-std::array<float,2>{0.0152422283f, 0.341244817f},
-std::array<float,2>{0.974914372f, 0.72634846f},
-std::array<float,2>{0.199418426f, 0.873268843f},
-std::array<float,2>{0.829762042f, 0.201387942f},
-std::array<float,2>{0.48023966f, 0.282017052f},
-std::array<float,2>{0.680105686f, 0.674038947f},
-std::array<float,2>{0.294690222f, 0.606453001f},
-std::array<float,2>{0.574754298f, 0.415384531f},
-std::array<float,2>{0.106020086f, 0.0884720385f},
-std::array<float,2>{0.889058173f, 0.904880166f},
-std::array<float,2>{0.0382767357f, 0.691816449f},
-std::array<float,2>{0.960952103f, 0.351117343f},
-std::array<float,2>{0.360605031f, 0.161826715f},
-std::array<float,2>{0.541911244f, 0.787204623f},
-std::array<float,2>{0.398644328f, 0.95848316f},
-std::array<float,2>{0.729579568f, 0.0286118761f},
-std::array<float,2>{0.143472344f, 0.454302371f},
-std::array<float,2>{0.810758293f, 0.515123069f},
-std::array<float,2>{0.168655932f, 0.926213324f},
-std::array<float,2>{0.752142847f, 0.110692479f},
-std::array<float,2>{0.435616136f, 0.379167855f},
-std::array<float,2>{0.718697131f, 0.589492559f},
-std::array<float,2>{0.341574311f, 0.64010781f},
-std::array<float,2>{0.52539432f, 0.255736709f},
-std::array<float,2>{0.00461325329f, 0.234258115f},
-std::array<float,2>{0.984264731f, 0.827674747f},
-std::array<float,2>{0.0729479566f, 0.560654163f},
-std::array<float,2>{0.922634423f, 0.485291123f},
-std::array<float,2>{0.261327505f, 0.0548122413f},
-std::array<float,2>{0.601156056f, 0.99066329f},
-std::array<float,2>{0.449999511f, 0.750888646f},
-std::array<float,2>{0.635063589f, 0.137687773f},
-std::array<float,2>{0.2477303f, 0.314435929f},
-std::array<float,2>{0.861023009f, 0.735013485f},
-std::array<float,2>{0.0404013395f, 0.856014431f},
-std::array<float,2>{0.958948433f, 0.215107858f},
-std::array<float,2>{0.367641896f, 0.303230643f},
-std::array<float,2>{0.53382051f, 0.657039046f},
-std::array<float,2>{0.392864615f, 0.61974144f},
-std::array<float,2>{0.722707033f, 0.430640608f},
-std::array<float,2>{0.151450157f, 0.0625064373f},
-std::array<float,2>{0.799848676f, 0.881884694f},
-std::array<float,2>{0.187915936f, 0.711105227f},
-std::array<float,2>{0.837845922f, 0.367448837f},
-std::array<float,2>{0.473758847f, 0.184650138f},
-std::array<float,2>{0.672522783f, 0.809861243f},
-std::array<float,2>{0.286362261f, 0.950428009f},
-std::array<float,2>{0.562753379f, 0.00348212686f},
-std::array<float,2>{0.0976873562f, 0.437612861f},
-std::array<float,2>{0.879256308f, 0.51665014f},
-std::array<float,2>{0.114003278f, 0.972338974f},
-std::array<float,2>{0.903113246f, 0.04167597f},
-std::array<float,2>{0.300305575f, 0.476324141f},
-std::array<float,2>{0.589797437f, 0.536862314f},
-std::array<float,2>{0.485426813f, 0.720049322f},
-std::array<float,2>{0.66280365f, 0.33754468f},
-std::array<float,2>{0.203278035f, 0.150434345f},
-std::array<float,2>{0.823304474f, 0.778480589f},
-std::array<float,2>{0.135031074f, 0.578029394f},
-std::array<float,2>{0.789326787f, 0.390695542f},
-std::array<float,2>{0.379701614f, 0.102122448f},
-std::array<float,2>{0.748394728f, 0.913045466f},
-std::array<float,2>{0.348480403f, 0.839806616f},
-std::array<float,2>{0.560077846f, 0.238704845f},
-std::array<float,2>{0.0559427254f, 0.271772057f},
-std::array<float,2>{0.94782728f, 0.642479479f},
-std::array<float,2>{0.232325658f, 0.784588099f},
-std::array<float,2>{0.859200776f, 0.160115719f},
-std::array<float,2>{0.466716409f, 0.345840871f},
-std::array<float,2>{0.655439198f, 0.689246237f},
-std::array<float,2>{0.26813826f, 0.511487424f},
-std::array<float,2>{0.623982012f, 0.457698792f},
-std::array<float,2>{0.082959488f, 0.0240098126f},
-std::array<float,2>{0.920755744f, 0.954409957f},
-std::array<float,2>{0.0160670839f, 0.679130912f},
-std::array<float,2>{0.996854246f, 0.287008494f},
-std::array<float,2>{0.327560633f, 0.196087465f},
-std::array<float,2>{0.501751482f, 0.870703101f},
-std::array<float,2>{0.416677594f, 0.901185036f},
-std::array<float,2>{0.689536154f, 0.093105495f},
-std::array<float,2>{0.182953879f, 0.420042634f},
-std::array<float,2>{0.777200162f, 0.604151607f},
-std::array<float,2>{0.213572949f, 0.966692567f},
-std::array<float,2>{0.820165217f, 0.0201319344f},
-std::array<float,2>{0.494840115f, 0.466019422f},
-std::array<float,2>{0.670470774f, 0.507192492f},
-std::array<float,2>{0.305390656f, 0.699997663f},
-std::array<float,2>{0.579964459f, 0.356855094f},
-std::array<float,2>{0.123692282f, 0.17076157f},
-std::array<float,2>{0.892336071f, 0.793722868f},
-std::array<float,2>{0.0489134863f, 0.597351134f},
-std::array<float,2>{0.938127756f, 0.410881281f},
-std::array<float,2>{0.35657239f, 0.0859265924f},
-std::array<float,2>{0.549739361f, 0.892428756f},
-std::array<float,2>{0.382934898f, 0.860059798f},
-std::array<float,2>{0.73582375f, 0.194109783f},
-std::array<float,2>{0.128649533f, 0.28952378f},
-std::array<float,2>{0.785402298f, 0.682853043f},
-std::array<float,2>{0.0913738757f, 0.767296374f},
-std::array<float,2>{0.913826764f, 0.142761856f},
-std::array<float,2>{0.274947315f, 0.333955169f},
-std::array<float,2>{0.615585327f, 0.732758641f},
-std::array<float,2>{0.45668298f, 0.546732843f},
-std::array<float,2>{0.641400754f, 0.483776093f},
-std::array<float,2>{0.2192325f, 0.0365448818f},
-std::array<float,2>{0.851002872f, 0.978365481f},
-std::array<float,2>{0.175314263f, 0.655017972f},
-std::array<float,2>{0.766008615f, 0.27997148f},
-std::array<float,2>{0.408720583f, 0.243472174f},
-std::array<float,2>{0.701450527f, 0.83164531f},
-std::array<float,2>{0.317386031f, 0.914238632f},
-std::array<float,2>{0.511252224f, 0.101308756f},
-std::array<float,2>{0.0235653222f, 0.399197072f},
-std::array<float,2>{0.992025793f, 0.564344347f},
-std::array<float,2>{0.0108140456f, 0.884914637f},
-std::array<float,2>{0.970811248f, 0.0779613331f},
-std::array<float,2>{0.334093928f, 0.422835439f},
-std::array<float,2>{0.522814572f, 0.616714895f},
-std::array<float,2>{0.426593333f, 0.666887105f},
-std::array<float,2>{0.705993533f, 0.308353513f},
-std::array<float,2>{0.160816252f, 0.209537476f},
-std::array<float,2>{0.763295174f, 0.844302356f},
-std::array<float,2>{0.235677972f, 0.527553618f},
-std::array<float,2>{0.870968819f, 0.448949635f},
-std::array<float,2>{0.444835216f, 0.00836270396f},
-std::array<float,2>{0.626882434f, 0.937551439f},
-std::array<float,2>{0.255934238f, 0.804045737f},
-std::array<float,2>{0.607263565f, 0.173023537f},
-std::array<float,2>{0.0683809593f, 0.360793859f},
-std::array<float,2>{0.932641804f, 0.706061423f},
-std::array<float,2>{0.147197813f, 0.815895557f},
-std::array<float,2>{0.807145715f, 0.223579004f},
-std::array<float,2>{0.402630955f, 0.258656651f},
-std::array<float,2>{0.732418954f, 0.629320741f},
-std::array<float,2>{0.363945514f, 0.580963969f},
-std::array<float,2>{0.543773353f, 0.383167058f},
-std::array<float,2>{0.0327656046f, 0.117692605f},
-std::array<float,2>{0.968212545f, 0.930045128f},
-std::array<float,2>{0.103036255f, 0.748754501f},
-std::array<float,2>{0.885213077f, 0.325522393f},
-std::array<float,2>{0.292353868f, 0.127272293f},
-std::array<float,2>{0.572579801f, 0.760970712f},
-std::array<float,2>{0.483494461f, 0.999661922f},
-std::array<float,2>{0.686825752f, 0.0479367077f},
-std::array<float,2>{0.196076006f, 0.498351723f},
-std::array<float,2>{0.835744083f, 0.548050046f},
-std::array<float,2>{0.239453539f, 0.909694552f},
-std::array<float,2>{0.871882439f, 0.108902983f},
-std::array<float,2>{0.441157907f, 0.397902668f},
-std::array<float,2>{0.631358624f, 0.574200928f},
-std::array<float,2>{0.251149029f, 0.645480394f},
-std::array<float,2>{0.603667319f, 0.267690927f},
-std::array<float,2>{0.0663499758f, 0.237310335f},
-std::array<float,2>{0.935883164f, 0.840754986f},
-std::array<float,2>{0.0150697846f, 0.534026742f},
-std::array<float,2>{0.975334048f, 0.469891459f},
-std::array<float,2>{0.329728752f, 0.0431287475f},
-std::array<float,2>{0.51930654f, 0.976506591f},
-std::array<float,2>{0.425035328f, 0.776392043f},
-std::array<float,2>{0.709339023f, 0.155322328f},
-std::array<float,2>{0.157110289f, 0.343495518f},
-std::array<float,2>{0.759143293f, 0.722840786f},
-std::array<float,2>{0.105682373f, 0.872449756f},
-std::array<float,2>{0.889211297f, 0.200732216f},
-std::array<float,2>{0.294245005f, 0.283524483f},
-std::array<float,2>{0.57466799f, 0.672610343f},
-std::array<float,2>{0.479851604f, 0.607776225f},
-std::array<float,2>{0.680286407f, 0.417465568f},
-std::array<float,2>{0.200018898f, 0.0866904557f},
-std::array<float,2>{0.829336584f, 0.90290308f},
-std::array<float,2>{0.142789721f, 0.693659186f},
-std::array<float,2>{0.811236501f, 0.34888339f},
-std::array<float,2>{0.399355114f, 0.163781941f},
-std::array<float,2>{0.730338931f, 0.785752654f},
-std::array<float,2>{0.360861719f, 0.960446537f},
-std::array<float,2>{0.541130543f, 0.0298146419f},
-std::array<float,2>{0.0385972895f, 0.455499321f},
-std::array<float,2>{0.961473107f, 0.513524294f},
-std::array<float,2>{0.0509720966f, 0.988240182f},
-std::array<float,2>{0.944599092f, 0.0608963519f},
-std::array<float,2>{0.355364978f, 0.490746558f},
-std::array<float,2>{0.551901221f, 0.556745112f},
-std::array<float,2>{0.387856215f, 0.740671396f},
-std::array<float,2>{0.738517046f, 0.316758931f},
-std::array<float,2>{0.131477565f, 0.134013891f},
-std::array<float,2>{0.78151983f, 0.754156888f},
-std::array<float,2>{0.215363756f, 0.592778862f},
-std::array<float,2>{0.812782049f, 0.375258803f},
-std::array<float,2>{0.498055667f, 0.117010914f},
-std::array<float,2>{0.665673852f, 0.924929321f},
-std::array<float,2>{0.310129732f, 0.823705494f},
-std::array<float,2>{0.583643794f, 0.228709087f},
-std::array<float,2>{0.119634524f, 0.253667295f},
-std::array<float,2>{0.895306706f, 0.635464489f},
-std::array<float,2>{0.179434747f, 0.805829287f},
-std::array<float,2>{0.770672917f, 0.181367204f},
-std::array<float,2>{0.413815647f, 0.374314785f},
-std::array<float,2>{0.698205471f, 0.715497136f},
-std::array<float,2>{0.315296233f, 0.520861328f},
-std::array<float,2>{0.51211679f, 0.444684118f},
-std::array<float,2>{0.0275185872f, 0.00697882287f},
-std::array<float,2>{0.984707773f, 0.947471619f},
-std::array<float,2>{0.0862229317f, 0.663536131f},
-std::array<float,2>{0.908683956f, 0.299586087f},
-std::array<float,2>{0.279255688f, 0.213647708f},
-std::array<float,2>{0.611523986f, 0.853150487f},
-std::array<float,2>{0.458918542f, 0.876154006f},
-std::array<float,2>{0.64635694f, 0.0672286674f},
-std::array<float,2>{0.223652571f, 0.435820937f},
-std::array<float,2>{0.845459163f, 0.624588132f},
-std::array<float,2>{0.138668641f, 0.942369223f},
-std::array<float,2>{0.793602884f, 0.0122780884f},
-std::array<float,2>{0.378379732f, 0.452533722f},
-std::array<float,2>{0.745875776f, 0.524817467f},
-std::array<float,2>{0.345844924f, 0.708987534f},
-std::array<float,2>{0.557846844f, 0.366680562f},
-std::array<float,2>{0.060547065f, 0.179545596f},
-std::array<float,2>{0.952379167f, 0.800217211f},
-std::array<float,2>{0.110108428f, 0.612591624f},
-std::array<float,2>{0.901805103f, 0.429477453f},
-std::array<float,2>{0.301936328f, 0.0740580112f},
-std::array<float,2>{0.590917528f, 0.887126923f},
-std::array<float,2>{0.48962146f, 0.851318419f},
-std::array<float,2>{0.659678578f, 0.205069184f},
-std::array<float,2>{0.207209289f, 0.310425311f},
-std::array<float,2>{0.825590909f, 0.670571089f},
-std::array<float,2>{0.022070149f, 0.763307214f},
-std::array<float,2>{0.993672132f, 0.132118598f},
-std::array<float,2>{0.322157025f, 0.321619779f},
-std::array<float,2>{0.50449127f, 0.744716048f},
-std::array<float,2>{0.419442296f, 0.553689659f},
-std::array<float,2>{0.693465889f, 0.492669135f},
-std::array<float,2>{0.184667498f, 0.0524962768f},
-std::array<float,2>{0.77889812f, 0.994971275f},
-std::array<float,2>{0.228440851f, 0.627432168f},
-std::array<float,2>{0.854601264f, 0.262166321f},
-std::array<float,2>{0.461340964f, 0.221518859f},
-std::array<float,2>{0.651531398f, 0.818785846f},
-std::array<float,2>{0.272980809f, 0.937463284f},
-std::array<float,2>{0.62034893f, 0.124003164f},
-std::array<float,2>{0.0795765892f, 0.387674898f},
-std::array<float,2>{0.915274322f, 0.582786322f},
-std::array<float,2>{0.07668975f, 0.896157861f},
-std::array<float,2>{0.926410556f, 0.0789783001f},
-std::array<float,2>{0.264717728f, 0.409256667f},
-std::array<float,2>{0.594074905f, 0.599768639f},
-std::array<float,2>{0.446267873f, 0.685197592f},
-std::array<float,2>{0.639621377f, 0.293967485f},
-std::array<float,2>{0.242885232f, 0.190169528f},
-std::array<float,2>{0.864920378f, 0.863300204f},
-std::array<float,2>{0.164516792f, 0.500613689f},
-std::array<float,2>{0.754677534f, 0.464327157f},
-std::array<float,2>{0.430257857f, 0.0192723647f},
-std::array<float,2>{0.713546276f, 0.961353183f},
-std::array<float,2>{0.337952107f, 0.789809585f},
-std::array<float,2>{0.527958572f, 0.164191544f},
-std::array<float,2>{0.00297124637f, 0.354881227f},
-std::array<float,2>{0.97939688f, 0.695705354f},
-std::array<float,2>{0.194731146f, 0.832701504f},
-std::array<float,2>{0.840603054f, 0.248659372f},
-std::array<float,2>{0.468948692f, 0.274305552f},
-std::array<float,2>{0.676091611f, 0.648624241f},
-std::array<float,2>{0.282418579f, 0.568374991f},
-std::array<float,2>{0.56917417f, 0.40265733f},
-std::array<float,2>{0.0973509476f, 0.0949671045f},
-std::array<float,2>{0.876477242f, 0.919975162f},
-std::array<float,2>{0.0442718528f, 0.729375005f},
-std::array<float,2>{0.956894755f, 0.330124646f},
-std::array<float,2>{0.37327683f, 0.144763067f},
-std::array<float,2>{0.538309813f, 0.769602597f},
-std::array<float,2>{0.395374566f, 0.982024372f},
-std::array<float,2>{0.719301701f, 0.0322229154f},
-std::array<float,2>{0.152875707f, 0.477557957f},
-std::array<float,2>{0.802310526f, 0.542363405f},
-std::array<float,2>{0.160436124f, 0.884032905f},
-std::array<float,2>{0.762696683f, 0.0749864429f},
-std::array<float,2>{0.425901562f, 0.423879385f},
-std::array<float,2>{0.705078423f, 0.614049554f},
-std::array<float,2>{0.334666103f, 0.664722919f},
-std::array<float,2>{0.522982121f, 0.305889398f},
-std::array<float,2>{0.0116665531f, 0.207417846f},
-std::array<float,2>{0.971470177f, 0.845869899f},
-std::array<float,2>{0.0689839348f, 0.530479789f},
-std::array<float,2>{0.933480322f, 0.446499467f},
-std::array<float,2>{0.256390631f, 0.0101417191f},
-std::array<float,2>{0.606847286f, 0.94075799f},
-std::array<float,2>{0.444641292f, 0.802626848f},
-std::array<float,2>{0.626239538f, 0.174500898f},
-std::array<float,2>{0.23621577f, 0.362230957f},
-std::array<float,2>{0.870517612f, 0.703947723f},
-std::array<float,2>{0.0322809741f, 0.812836051f},
-std::array<float,2>{0.968319952f, 0.226279855f},
-std::array<float,2>{0.363752812f, 0.26026386f},
-std::array<float,2>{0.542987585f, 0.632713795f},
-std::array<float,2>{0.403297961f, 0.579428256f},
-std::array<float,2>{0.731913269f, 0.385776967f},
-std::array<float,2>{0.146699801f, 0.121009715f},
-std::array<float,2>{0.806694806f, 0.932204425f},
-std::array<float,2>{0.195643187f, 0.747459471f},
-std::array<float,2>{0.835217476f, 0.326263577f},
-std::array<float,2>{0.484192759f, 0.126676947f},
-std::array<float,2>{0.687398911f, 0.759614646f},
-std::array<float,2>{0.292843044f, 0.996480703f},
-std::array<float,2>{0.572783947f, 0.0502814278f},
-std::array<float,2>{0.102867134f, 0.497063428f},
-std::array<float,2>{0.885577679f, 0.55006671f},
-std::array<float,2>{0.123276152f, 0.96714747f},
-std::array<float,2>{0.892049909f, 0.0221142787f},
-std::array<float,2>{0.304733694f, 0.468349308f},
-std::array<float,2>{0.579131603f, 0.504327714f},
-std::array<float,2>{0.494473696f, 0.701494455f},
-std::array<float,2>{0.670140028f, 0.358855426f},
-std::array<float,2>{0.213234797f, 0.169527218f},
-std::array<float,2>{0.81938839f, 0.795520663f},
-std::array<float,2>{0.128232196f, 0.593800485f},
-std::array<float,2>{0.786071479f, 0.412368476f},
-std::array<float,2>{0.383652091f, 0.0835463628f},
-std::array<float,2>{0.736157477f, 0.893094897f},
-std::array<float,2>{0.357066602f, 0.86288029f},
-std::array<float,2>{0.548863411f, 0.191669703f},
-std::array<float,2>{0.0497063845f, 0.29237026f},
-std::array<float,2>{0.937926829f, 0.679838955f},
-std::array<float,2>{0.219472423f, 0.767898023f},
-std::array<float,2>{0.851294696f, 0.141831502f},
-std::array<float,2>{0.456078023f, 0.334378719f},
-std::array<float,2>{0.640674949f, 0.730887115f},
-std::array<float,2>{0.274613917f, 0.543414772f},
-std::array<float,2>{0.616062462f, 0.481514484f},
-std::array<float,2>{0.0910273343f, 0.0383438803f},
-std::array<float,2>{0.913129807f, 0.979505301f},
-std::array<float,2>{0.0240896642f, 0.653655589f},
-std::array<float,2>{0.99153477f, 0.278596252f},
-std::array<float,2>{0.318110645f, 0.244985074f},
-std::array<float,2>{0.511072934f, 0.829647839f},
-std::array<float,2>{0.408573925f, 0.917313933f},
-std::array<float,2>{0.701729178f, 0.0979339927f},
-std::array<float,2>{0.175231859f, 0.40116474f},
-std::array<float,2>{0.766566336f, 0.564838529f},
-std::array<float,2>{0.203830674f, 0.970229089f},
-std::array<float,2>{0.823746741f, 0.040569026f},
-std::array<float,2>{0.486036032f, 0.472848624f},
-std::array<float,2>{0.662567914f, 0.538671434f},
-std::array<float,2>{0.300245106f, 0.722123027f},
-std::array<float,2>{0.58913523f, 0.338353217f},
-std::array<float,2>{0.113434762f, 0.150174394f},
-std::array<float,2>{0.902674258f, 0.780497611f},
-std::array<float,2>{0.0564089082f, 0.575456262f},
-std::array<float,2>{0.947548509f, 0.393551826f},
-std::array<float,2>{0.347939283f, 0.104164019f},
-std::array<float,2>{0.559843183f, 0.911023319f},
-std::array<float,2>{0.379139543f, 0.836832225f},
-std::array<float,2>{0.748590589f, 0.24200581f},
-std::array<float,2>{0.135473922f, 0.270587087f},
-std::array<float,2>{0.7898615f, 0.644092798f},
-std::array<float,2>{0.0824364796f, 0.781312764f},
-std::array<float,2>{0.920248508f, 0.156374246f},
-std::array<float,2>{0.267845362f, 0.34558785f},
-std::array<float,2>{0.623230219f, 0.690149546f},
-std::array<float,2>{0.46623376f, 0.508466899f},
-std::array<float,2>{0.6560691f, 0.459844887f},
-std::array<float,2>{0.231661797f, 0.0262807738f},
-std::array<float,2>{0.858668506f, 0.955924332f},
-std::array<float,2>{0.183118939f, 0.677015543f},
-std::array<float,2>{0.776754498f, 0.288072854f},
-std::array<float,2>{0.416050673f, 0.198822573f},
-std::array<float,2>{0.690283656f, 0.867946327f},
-std::array<float,2>{0.327810973f, 0.89988035f},
-std::array<float,2>{0.501457036f, 0.0907879323f},
-std::array<float,2>{0.0163399f, 0.419568002f},
-std::array<float,2>{0.996527016f, 0.601977229f},
-std::array<float,2>{0.00404173275f, 0.929545522f},
-std::array<float,2>{0.983673096f, 0.113260336f},
-std::array<float,2>{0.340831846f, 0.381455362f},
-std::array<float,2>{0.526204169f, 0.58725661f},
-std::array<float,2>{0.436472774f, 0.638388574f},
-std::array<float,2>{0.718123853f, 0.256115407f},
-std::array<float,2>{0.168306902f, 0.230558902f},
-std::array<float,2>{0.752849042f, 0.824748635f},
-std::array<float,2>{0.247150689f, 0.559510171f},
-std::array<float,2>{0.860605478f, 0.486385763f},
-std::array<float,2>{0.449575573f, 0.0584606975f},
-std::array<float,2>{0.635722458f, 0.98976028f},
-std::array<float,2>{0.261178553f, 0.753103971f},
-std::array<float,2>{0.600990713f, 0.140250936f},
-std::array<float,2>{0.0726672336f, 0.316112816f},
-std::array<float,2>{0.922106147f, 0.737602353f},
-std::array<float,2>{0.152248323f, 0.858570397f},
-std::array<float,2>{0.800570428f, 0.218002141f},
-std::array<float,2>{0.39337796f, 0.302170694f},
-std::array<float,2>{0.723501563f, 0.659766436f},
-std::array<float,2>{0.367973328f, 0.617388546f},
-std::array<float,2>{0.533241451f, 0.433291882f},
-std::array<float,2>{0.0407072194f, 0.0656800866f},
-std::array<float,2>{0.958220005f, 0.879822075f},
-std::array<float,2>{0.0985649303f, 0.713776946f},
-std::array<float,2>{0.879497826f, 0.369362354f},
-std::array<float,2>{0.287102491f, 0.187128872f},
-std::array<float,2>{0.5634377f, 0.811225355f},
-std::array<float,2>{0.474456698f, 0.952149034f},
-std::array<float,2>{0.671970487f, 0.00179545628f},
-std::array<float,2>{0.188291445f, 0.441103101f},
-std::array<float,2>{0.837036014f, 0.518697202f},
-std::array<float,2>{0.201332718f, 0.904646754f},
-std::array<float,2>{0.831024826f, 0.088332653f},
-std::array<float,2>{0.476706892f, 0.415712029f},
-std::array<float,2>{0.683273256f, 0.607147038f},
-std::array<float,2>{0.295719296f, 0.674516261f},
-std::array<float,2>{0.577899814f, 0.281396121f},
-std::array<float,2>{0.10790576f, 0.201746672f},
-std::array<float,2>{0.888562918f, 0.873946071f},
-std::array<float,2>{0.0362935029f, 0.515250206f},
-std::array<float,2>{0.963032663f, 0.45499742f},
-std::array<float,2>{0.362714887f, 0.0289755575f},
-std::array<float,2>{0.540679157f, 0.95884341f},
-std::array<float,2>{0.401864529f, 0.787974179f},
-std::array<float,2>{0.72742784f, 0.161329463f},
-std::array<float,2>{0.140669659f, 0.350881487f},
-std::array<float,2>{0.808624983f, 0.692255735f},
-std::array<float,2>{0.0625469014f, 0.842447579f},
-std::array<float,2>{0.933718622f, 0.235588014f},
-std::array<float,2>{0.253324956f, 0.267455846f},
-std::array<float,2>{0.603363454f, 0.64656955f},
-std::array<float,2>{0.438826174f, 0.570501685f},
-std::array<float,2>{0.630039215f, 0.395661682f},
-std::array<float,2>{0.241270989f, 0.105863243f},
-std::array<float,2>{0.87331593f, 0.906889498f},
-std::array<float,2>{0.159320191f, 0.725834966f},
-std::array<float,2>{0.761175394f, 0.341623962f},
-std::array<float,2>{0.422944784f, 0.152461544f},
-std::array<float,2>{0.708555162f, 0.774796069f},
-std::array<float,2>{0.331252128f, 0.973542809f},
-std::array<float,2>{0.516077042f, 0.0468250252f},
-std::array<float,2>{0.0128110014f, 0.472634077f},
-std::array<float,2>{0.974228978f, 0.531927645f},
-std::array<float,2>{0.0309036039f, 0.945556521f},
-std::array<float,2>{0.987494528f, 0.00456530601f},
-std::array<float,2>{0.312774926f, 0.443016827f},
-std::array<float,2>{0.514558017f, 0.521624565f},
-std::array<float,2>{0.411767036f, 0.717615545f},
-std::array<float,2>{0.696420133f, 0.372129321f},
-std::array<float,2>{0.176503286f, 0.181731224f},
-std::array<float,2>{0.773040771f, 0.808140635f},
-std::array<float,2>{0.226275802f, 0.622407615f},
-std::array<float,2>{0.846714437f, 0.434344739f},
-std::array<float,2>{0.460611463f, 0.0690304786f},
-std::array<float,2>{0.647358119f, 0.878545165f},
-std::array<float,2>{0.281150281f, 0.854185641f},
-std::array<float,2>{0.610346258f, 0.211123586f},
-std::array<float,2>{0.0886476859f, 0.297412306f},
-std::array<float,2>{0.907974005f, 0.660322309f},
-std::array<float,2>{0.129577979f, 0.756125033f},
-std::array<float,2>{0.784067392f, 0.136186212f},
-std::array<float,2>{0.388784051f, 0.319057733f},
-std::array<float,2>{0.740375817f, 0.74023056f},
-std::array<float,2>{0.351988375f, 0.555936992f},
-std::array<float,2>{0.554039657f, 0.489627868f},
-std::array<float,2>{0.0533637851f, 0.0588172637f},
-std::array<float,2>{0.941512644f, 0.986232221f},
-std::array<float,2>{0.117882125f, 0.633350432f},
-std::array<float,2>{0.896581709f, 0.250030041f},
-std::array<float,2>{0.310638011f, 0.227988735f},
-std::array<float,2>{0.58581984f, 0.821993589f},
-std::array<float,2>{0.497348249f, 0.923671722f},
-std::array<float,2>{0.666902304f, 0.114958316f},
-std::array<float,2>{0.216847941f, 0.378501177f},
-std::array<float,2>{0.816365182f, 0.590728343f},
-std::array<float,2>{0.186431468f, 0.993793547f},
-std::array<float,2>{0.779762447f, 0.0543199182f},
-std::array<float,2>{0.42034027f, 0.495196104f},
-std::array<float,2>{0.693344176f, 0.551814616f},
-std::array<float,2>{0.323488116f, 0.743947923f},
-std::array<float,2>{0.507716477f, 0.323812366f},
-std::array<float,2>{0.0197289232f, 0.129417092f},
-std::array<float,2>{0.995655894f, 0.764086246f},
-std::array<float,2>{0.0808979049f, 0.585517704f},
-std::array<float,2>{0.916720748f, 0.390483499f},
-std::array<float,2>{0.271007508f, 0.121982664f},
-std::array<float,2>{0.618753552f, 0.934426785f},
-std::array<float,2>{0.464278221f, 0.817655087f},
-std::array<float,2>{0.649958491f, 0.219178826f},
-std::array<float,2>{0.229497164f, 0.264180928f},
-std::array<float,2>{0.85340929f, 0.625901103f},
-std::array<float,2>{0.06032582f, 0.797750175f},
-std::array<float,2>{0.949519694f, 0.176408604f},
-std::array<float,2>{0.344431132f, 0.363296092f},
-std::array<float,2>{0.556463122f, 0.708959281f},
-std::array<float,2>{0.376009047f, 0.525452971f},
-std::array<float,2>{0.74256438f, 0.450850666f},
-std::array<float,2>{0.13897638f, 0.0150692789f},
-std::array<float,2>{0.7966488f, 0.943658352f},
-std::array<float,2>{0.210706249f, 0.66980201f},
-std::array<float,2>{0.827082455f, 0.310753256f},
-std::array<float,2>{0.490723401f, 0.20610252f},
-std::array<float,2>{0.6579988f, 0.848321319f},
-std::array<float,2>{0.303256005f, 0.889672697f},
-std::array<float,2>{0.593520522f, 0.0704516619f},
-std::array<float,2>{0.113199078f, 0.426220775f},
-std::array<float,2>{0.898526013f, 0.611080945f},
-std::array<float,2>{0.094608061f, 0.919718623f},
-std::array<float,2>{0.878335238f, 0.0958212465f},
-std::array<float,2>{0.28479895f, 0.404629678f},
-std::array<float,2>{0.567238927f, 0.567933381f},
-std::array<float,2>{0.471191525f, 0.650914669f},
-std::array<float,2>{0.679302931f, 0.275784224f},
-std::array<float,2>{0.19227384f, 0.247807056f},
-std::array<float,2>{0.842351377f, 0.835523903f},
-std::array<float,2>{0.154728964f, 0.540556729f},
-std::array<float,2>{0.803810835f, 0.480330646f},
-std::array<float,2>{0.398182422f, 0.0333065838f},
-std::array<float,2>{0.721759915f, 0.984306455f},
-std::array<float,2>{0.372900754f, 0.772256494f},
-std::array<float,2>{0.536355257f, 0.146964252f},
-std::array<float,2>{0.0462566465f, 0.329634577f},
-std::array<float,2>{0.953881025f, 0.727615595f},
-std::array<float,2>{0.245400235f, 0.866717041f},
-std::array<float,2>{0.86632663f, 0.18940796f},
-std::array<float,2>{0.44817856f, 0.295110732f},
-std::array<float,2>{0.637342632f, 0.686078846f},
-std::array<float,2>{0.263268709f, 0.598748863f},
-std::array<float,2>{0.596494377f, 0.407503068f},
-std::array<float,2>{0.0754908323f, 0.0819262788f},
-std::array<float,2>{0.929393172f, 0.89682591f},
-std::array<float,2>{0.00154892507f, 0.698184609f},
-std::array<float,2>{0.977352023f, 0.351748049f},
-std::array<float,2>{0.336210102f, 0.167084098f},
-std::array<float,2>{0.530753553f, 0.791600704f},
-std::array<float,2>{0.432672292f, 0.96292907f},
-std::array<float,2>{0.711521029f, 0.0156613979f},
-std::array<float,2>{0.167214215f, 0.461061805f},
-std::array<float,2>{0.757360637f, 0.503746986f},
-std::array<float,2>{0.14507471f, 0.930602252f},
-std::array<float,2>{0.804877818f, 0.11748495f},
-std::array<float,2>{0.405228585f, 0.38371551f},
-std::array<float,2>{0.732777357f, 0.580153763f},
-std::array<float,2>{0.366488069f, 0.629446805f},
-std::array<float,2>{0.545199037f, 0.257840455f},
-std::array<float,2>{0.034951169f, 0.222923741f},
-std::array<float,2>{0.965737104f, 0.816274405f},
-std::array<float,2>{0.103928491f, 0.548421383f},
-std::array<float,2>{0.882848382f, 0.49857083f},
-std::array<float,2>{0.290624082f, 0.0486553349f},
-std::array<float,2>{0.570510805f, 0.999454021f},
-std::array<float,2>{0.481770247f, 0.761237502f},
-std::array<float,2>{0.684733152f, 0.127715409f},
-std::array<float,2>{0.197611302f, 0.325879961f},
-std::array<float,2>{0.832473874f, 0.748286247f},
-std::array<float,2>{0.00969064422f, 0.843998015f},
-std::array<float,2>{0.969895244f, 0.209081769f},
-std::array<float,2>{0.333733797f, 0.307919681f},
-std::array<float,2>{0.520635962f, 0.666464329f},
-std::array<float,2>{0.429528594f, 0.616431713f},
-std::array<float,2>{0.703675449f, 0.422038108f},
-std::array<float,2>{0.163996309f, 0.077547498f},
-std::array<float,2>{0.764984488f, 0.885664582f},
-std::array<float,2>{0.23704122f, 0.706840277f},
-std::array<float,2>{0.867468178f, 0.361011028f},
-std::array<float,2>{0.441728801f, 0.173718959f},
-std::array<float,2>{0.627554953f, 0.804233074f},
-std::array<float,2>{0.25512743f, 0.938060939f},
-std::array<float,2>{0.609169781f, 0.00827774499f},
-std::array<float,2>{0.0665697083f, 0.448671639f},
-std::array<float,2>{0.930876791f, 0.52794677f},
-std::array<float,2>{0.0919331163f, 0.977569878f},
-std::array<float,2>{0.911382139f, 0.0368108191f},
-std::array<float,2>{0.276036769f, 0.484149456f},
-std::array<float,2>{0.61395961f, 0.545983911f},
-std::array<float,2>{0.454386026f, 0.73314178f},
-std::array<float,2>{0.643764675f, 0.33313188f},
-std::array<float,2>{0.221534371f, 0.143354103f},
-std::array<float,2>{0.848776102f, 0.766946495f},
-std::array<float,2>{0.172752455f, 0.563525677f},
-std::array<float,2>{0.768525362f, 0.398606926f},
-std::array<float,2>{0.407124758f, 0.100770034f},
-std::array<float,2>{0.699420989f, 0.914922237f},
-std::array<float,2>{0.319928318f, 0.831326365f},
-std::array<float,2>{0.508684874f, 0.243781403f},
-std::array<float,2>{0.0272077248f, 0.279695004f},
-std::array<float,2>{0.988604486f, 0.654647827f},
-std::array<float,2>{0.21256806f, 0.79302758f},
-std::array<float,2>{0.81791234f, 0.170222878f},
-std::array<float,2>{0.493847162f, 0.357039511f},
-std::array<float,2>{0.669101119f, 0.699467778f},
-std::array<float,2>{0.307609469f, 0.507692635f},
-std::array<float,2>{0.580422103f, 0.466488719f},
-std::array<float,2>{0.121602245f, 0.0196419563f},
-std::array<float,2>{0.893156528f, 0.965942442f},
-std::array<float,2>{0.0479213931f, 0.683373451f},
-std::array<float,2>{0.941303432f, 0.290027261f},
-std::array<float,2>{0.357967556f, 0.193554953f},
-std::array<float,2>{0.547496438f, 0.85961026f},
-std::array<float,2>{0.385151923f, 0.891787767f},
-std::array<float,2>{0.736537814f, 0.0852438956f},
-std::array<float,2>{0.126860291f, 0.410598516f},
-std::array<float,2>{0.788006783f, 0.596798956f},
-std::array<float,2>{0.233665794f, 0.954901934f},
-std::array<float,2>{0.856408238f, 0.0235417448f},
-std::array<float,2>{0.467347592f, 0.457091212f},
-std::array<float,2>{0.654070377f, 0.510760844f},
-std::array<float,2>{0.266421765f, 0.688948452f},
-std::array<float,2>{0.623020053f, 0.346564919f},
-std::array<float,2>{0.0858415142f, 0.159588024f},
-std::array<float,2>{0.919216871f, 0.785148323f},
-std::array<float,2>{0.0183359645f, 0.603731811f},
-std::array<float,2>{0.999788821f, 0.420571506f},
-std::array<float,2>{0.326018423f, 0.0937470868f},
-std::array<float,2>{0.50264436f, 0.900841355f},
-std::array<float,2>{0.41476807f, 0.870466948f},
-std::array<float,2>{0.688940823f, 0.195733994f},
-std::array<float,2>{0.180138648f, 0.286382973f},
-std::array<float,2>{0.775191069f, 0.679412901f},
-std::array<float,2>{0.115329653f, 0.778888106f},
-std::array<float,2>{0.906047404f, 0.150950596f},
-std::array<float,2>{0.297885865f, 0.337177396f},
-std::array<float,2>{0.586342216f, 0.720331371f},
-std::array<float,2>{0.486526936f, 0.536487043f},
-std::array<float,2>{0.660801172f, 0.47586602f},
-std::array<float,2>{0.206271529f, 0.0414184704f},
-std::array<float,2>{0.82097131f, 0.972079217f},
-std::array<float,2>{0.13363339f, 0.642052889f},
-std::array<float,2>{0.791698337f, 0.272442043f},
-std::array<float,2>{0.381280571f, 0.238849968f},
-std::array<float,2>{0.747484565f, 0.839252472f},
-std::array<float,2>{0.349819928f, 0.912290573f},
-std::array<float,2>{0.561115503f, 0.101682022f},
-std::array<float,2>{0.0568164885f, 0.391441971f},
-std::array<float,2>{0.946126938f, 0.57750237f},
-std::array<float,2>{0.0420251824f, 0.882549524f},
-std::array<float,2>{0.959971309f, 0.063032493f},
-std::array<float,2>{0.370083809f, 0.429910302f},
-std::array<float,2>{0.532153785f, 0.619429171f},
-std::array<float,2>{0.391792148f, 0.656514525f},
-std::array<float,2>{0.725504935f, 0.303091407f},
-std::array<float,2>{0.149232373f, 0.21580866f},
-std::array<float,2>{0.796997666f, 0.855778515f},
-std::array<float,2>{0.189582318f, 0.517166376f},
-std::array<float,2>{0.838448882f, 0.438313842f},
-std::array<float,2>{0.475413442f, 0.00340518169f},
-std::array<float,2>{0.674393535f, 0.950986743f},
-std::array<float,2>{0.288622051f, 0.810335934f},
-std::array<float,2>{0.564868093f, 0.185070857f},
-std::array<float,2>{0.100580812f, 0.368117481f},
-std::array<float,2>{0.882000625f, 0.711758673f},
-std::array<float,2>{0.170415804f, 0.827229738f},
-std::array<float,2>{0.750950217f, 0.23359172f},
-std::array<float,2>{0.434987694f, 0.254945636f},
-std::array<float,2>{0.715517819f, 0.640219152f},
-std::array<float,2>{0.343447775f, 0.589176297f},
-std::array<float,2>{0.525328994f, 0.379663646f},
-std::array<float,2>{0.00767565472f, 0.110927552f},
-std::array<float,2>{0.980557919f, 0.92648828f},
-std::array<float,2>{0.0719087571f, 0.734394014f},
-std::array<float,2>{0.925722241f, 0.313613147f},
-std::array<float,2>{0.259732306f, 0.137018666f},
-std::array<float,2>{0.598267734f, 0.750216722f},
-std::array<float,2>{0.452688903f, 0.991087735f},
-std::array<float,2>{0.633142412f, 0.055315014f},
-std::array<float,2>{0.24832423f, 0.484543294f},
-std::array<float,2>{0.863008738f, 0.561231494f},
-std::array<float,2>{0.21846886f, 0.924381077f},
-std::array<float,2>{0.815275252f, 0.115904383f},
-std::array<float,2>{0.496678114f, 0.376303136f},
-std::array<float,2>{0.667696059f, 0.592687488f},
-std::array<float,2>{0.311961591f, 0.636101723f},
-std::array<float,2>{0.584818423f, 0.252461731f},
-std::array<float,2>{0.118235871f, 0.229644209f},
-std::array<float,2>{0.897577584f, 0.823101997f},
-std::array<float,2>{0.0544903539f, 0.557747006f},
-std::array<float,2>{0.942962825f, 0.49163112f},
-std::array<float,2>{0.353291869f, 0.0620862506f},
-std::array<float,2>{0.553232074f, 0.986560106f},
-std::array<float,2>{0.39038372f, 0.755267501f},
-std::array<float,2>{0.741350055f, 0.132924154f},
-std::array<float,2>{0.130107477f, 0.317502081f},
-std::array<float,2>{0.784909189f, 0.74124676f},
-std::array<float,2>{0.0891218111f, 0.851979136f},
-std::array<float,2>{0.906484365f, 0.214178473f},
-std::array<float,2>{0.280131072f, 0.300484836f},
-std::array<float,2>{0.610694706f, 0.662361145f},
-std::array<float,2>{0.459807515f, 0.623793781f},
-std::array<float,2>{0.647746563f, 0.436943799f},
-std::array<float,2>{0.225159287f, 0.0678971559f},
-std::array<float,2>{0.845751166f, 0.875781059f},
-std::array<float,2>{0.177320033f, 0.716223538f},
-std::array<float,2>{0.771545649f, 0.373799056f},
-std::array<float,2>{0.410475314f, 0.179733545f},
-std::array<float,2>{0.695887625f, 0.805501044f},
-std::array<float,2>{0.313722789f, 0.949065924f},
-std::array<float,2>{0.51473695f, 0.00681349775f},
-std::array<float,2>{0.0294665433f, 0.443649113f},
-std::array<float,2>{0.986929536f, 0.520341635f},
-std::array<float,2>{0.0118169282f, 0.974937081f},
-std::array<float,2>{0.972699106f, 0.0443031192f},
-std::array<float,2>{0.33058691f, 0.469278187f},
-std::array<float,2>{0.516735554f, 0.534698486f},
-std::array<float,2>{0.422269315f, 0.72409153f},
-std::array<float,2>{0.707137764f, 0.341890633f},
-std::array<float,2>{0.158637956f, 0.154427528f},
-std::array<float,2>{0.760610342f, 0.775568187f},
-std::array<float,2>{0.240927845f, 0.572668612f},
-std::array<float,2>{0.874125302f, 0.397438735f},
-std::array<float,2>{0.437925458f, 0.108361207f},
-std::array<float,2>{0.629660249f, 0.909140229f},
-std::array<float,2>{0.25247407f, 0.841433704f},
-std::array<float,2>{0.601946712f, 0.237083927f},
-std::array<float,2>{0.0639296845f, 0.269105673f},
-std::array<float,2>{0.934688807f, 0.645666599f},
-std::array<float,2>{0.141989693f, 0.786522746f},
-std::array<float,2>{0.809975564f, 0.162859678f},
-std::array<float,2>{0.400881439f, 0.348401189f},
-std::array<float,2>{0.727890849f, 0.694556355f},
-std::array<float,2>{0.362181455f, 0.51207751f},
-std::array<float,2>{0.539822221f, 0.456666052f},
-std::array<float,2>{0.0354841575f, 0.0302898251f},
-std::array<float,2>{0.964332223f, 0.959798574f},
-std::array<float,2>{0.109332584f, 0.67336309f},
-std::array<float,2>{0.886778295f, 0.284807354f},
-std::array<float,2>{0.296669185f, 0.199778453f},
-std::array<float,2>{0.57644558f, 0.871542096f},
-std::array<float,2>{0.478031456f, 0.903868556f},
-std::array<float,2>{0.681937158f, 0.0873602778f},
-std::array<float,2>{0.20291318f, 0.416654795f},
-std::array<float,2>{0.831634223f, 0.609059513f},
-std::array<float,2>{0.166284248f, 0.962668955f},
-std::array<float,2>{0.756463408f, 0.0183383431f},
-std::array<float,2>{0.431915194f, 0.463466108f},
-std::array<float,2>{0.712832093f, 0.501172245f},
-std::array<float,2>{0.337598234f, 0.696610391f},
-std::array<float,2>{0.529527962f, 0.354272157f},
-std::array<float,2>{0.000627311354f, 0.165888891f},
-std::array<float,2>{0.978100002f, 0.790137649f},
-std::array<float,2>{0.0749912411f, 0.600600898f},
-std::array<float,2>{0.928399265f, 0.408686042f},
-std::array<float,2>{0.262210488f, 0.0792491138f},
-std::array<float,2>{0.59708339f, 0.895070791f},
-std::array<float,2>{0.448890269f, 0.864706814f},
-std::array<float,2>{0.638274908f, 0.190475732f},
-std::array<float,2>{0.244968936f, 0.29384765f},
-std::array<float,2>{0.866006911f, 0.683730006f},
-std::array<float,2>{0.0454620421f, 0.771279454f},
-std::array<float,2>{0.954586506f, 0.145688429f},
-std::array<float,2>{0.371163249f, 0.331540227f},
-std::array<float,2>{0.536114275f, 0.729802549f},
-std::array<float,2>{0.396551609f, 0.541105568f},
-std::array<float,2>{0.721359551f, 0.476629317f},
-std::array<float,2>{0.155894116f, 0.0331131183f},
-std::array<float,2>{0.80332768f, 0.98132515f},
-std::array<float,2>{0.192634836f, 0.649475098f},
-std::array<float,2>{0.842786133f, 0.274997056f},
-std::array<float,2>{0.471815467f, 0.249775156f},
-std::array<float,2>{0.677988231f, 0.833478391f},
-std::array<float,2>{0.283548057f, 0.921721101f},
-std::array<float,2>{0.567590535f, 0.0946634486f},
-std::array<float,2>{0.0947323591f, 0.403581858f},
-std::array<float,2>{0.877079666f, 0.569954455f},
-std::array<float,2>{0.111331835f, 0.887992799f},
-std::array<float,2>{0.900187731f, 0.0725510567f},
-std::array<float,2>{0.30381161f, 0.427861691f},
-std::array<float,2>{0.592270017f, 0.611693621f},
-std::array<float,2>{0.492120147f, 0.671146035f},
-std::array<float,2>{0.656479657f, 0.309161544f},
-std::array<float,2>{0.209064469f, 0.20384717f},
-std::array<float,2>{0.82785207f, 0.849695385f},
-std::array<float,2>{0.139873296f, 0.52366066f},
-std::array<float,2>{0.795626283f, 0.451429784f},
-std::array<float,2>{0.375435621f, 0.0132771367f},
-std::array<float,2>{0.743164122f, 0.943060637f},
-std::array<float,2>{0.344836563f, 0.799030244f},
-std::array<float,2>{0.555295408f, 0.178122416f},
-std::array<float,2>{0.0586349554f, 0.365940005f},
-std::array<float,2>{0.950479805f, 0.710526168f},
-std::array<float,2>{0.228589624f, 0.81990248f},
-std::array<float,2>{0.852383614f, 0.222187907f},
-std::array<float,2>{0.463658303f, 0.263629138f},
-std::array<float,2>{0.649356544f, 0.628378153f},
-std::array<float,2>{0.270261735f, 0.58321172f},
-std::array<float,2>{0.61813885f, 0.388566762f},
-std::array<float,2>{0.0820041969f, 0.124845877f},
-std::array<float,2>{0.917103708f, 0.936073899f},
-std::array<float,2>{0.0209274422f, 0.745480418f},
-std::array<float,2>{0.994709373f, 0.321288466f},
-std::array<float,2>{0.323216945f, 0.131722629f},
-std::array<float,2>{0.50654912f, 0.76224637f},
-std::array<float,2>{0.421686351f, 0.995322526f},
-std::array<float,2>{0.692055047f, 0.0510289446f},
-std::array<float,2>{0.187435836f, 0.493553132f},
-std::array<float,2>{0.780660868f, 0.554401457f},
-std::array<float,2>{0.125368312f, 0.894175053f},
-std::array<float,2>{0.788649976f, 0.0823071897f},
-std::array<float,2>{0.385941118f, 0.413675576f},
-std::array<float,2>{0.737826228f, 0.595197737f},
-std::array<float,2>{0.358510792f, 0.68144542f},
-std::array<float,2>{0.547980547f, 0.291071117f},
-std::array<float,2>{0.0471895114f, 0.192930102f},
-std::array<float,2>{0.939686954f, 0.861375868f},
-std::array<float,2>{0.122137323f, 0.505523086f},
-std::array<float,2>{0.894470751f, 0.466878682f},
-std::array<float,2>{0.308325738f, 0.0224955287f},
-std::array<float,2>{0.581426024f, 0.968571663f},
-std::array<float,2>{0.492531031f, 0.796629548f},
-std::array<float,2>{0.668521702f, 0.168815881f},
-std::array<float,2>{0.211170197f, 0.358252406f},
-std::array<float,2>{0.81690836f, 0.7028144f},
-std::array<float,2>{0.025671199f, 0.828648448f},
-std::array<float,2>{0.989922225f, 0.246059716f},
-std::array<float,2>{0.319003403f, 0.277649671f},
-std::array<float,2>{0.509338796f, 0.652678072f},
-std::array<float,2>{0.407833844f, 0.565721929f},
-std::array<float,2>{0.700987101f, 0.401792109f},
-std::array<float,2>{0.173671275f, 0.0994363502f},
-std::array<float,2>{0.769316375f, 0.916413546f},
-std::array<float,2>{0.222244322f, 0.732017875f},
-std::array<float,2>{0.847915232f, 0.33513999f},
-std::array<float,2>{0.453523993f, 0.141288862f},
-std::array<float,2>{0.643359005f, 0.769280434f},
-std::array<float,2>{0.27706328f, 0.978651464f},
-std::array<float,2>{0.61474824f, 0.0378020629f},
-std::array<float,2>{0.0933573693f, 0.481103063f},
-std::array<float,2>{0.911095619f, 0.544612527f},
-std::array<float,2>{0.0677164942f, 0.939735889f},
-std::array<float,2>{0.929837286f, 0.0110141886f},
-std::array<float,2>{0.25446865f, 0.446020275f},
-std::array<float,2>{0.607664108f, 0.529513001f},
-std::array<float,2>{0.443226874f, 0.704939008f},
-std::array<float,2>{0.628576398f, 0.362690777f},
-std::array<float,2>{0.237426549f, 0.175100625f},
-std::array<float,2>{0.868492126f, 0.801357746f},
-std::array<float,2>{0.162209749f, 0.614955425f},
-std::array<float,2>{0.764330864f, 0.424846411f},
-std::array<float,2>{0.427902013f, 0.0759009719f},
-std::array<float,2>{0.704593897f, 0.882996798f},
-std::array<float,2>{0.332805127f, 0.847007334f},
-std::array<float,2>{0.520147145f, 0.208346352f},
-std::array<float,2>{0.00809277408f, 0.304752648f},
-std::array<float,2>{0.969691515f, 0.665343821f},
-std::array<float,2>{0.198366955f, 0.758415043f},
-std::array<float,2>{0.833245218f, 0.125358343f},
-std::array<float,2>{0.480546355f, 0.327627897f},
-std::array<float,2>{0.683818161f, 0.746172547f},
-std::array<float,2>{0.289981335f, 0.548839033f},
-std::array<float,2>{0.57161063f, 0.497540802f},
-std::array<float,2>{0.105173185f, 0.0494804643f},
-std::array<float,2>{0.88454783f, 0.997512341f},
-std::array<float,2>{0.0336143076f, 0.630929589f},
-std::array<float,2>{0.965921402f, 0.260929197f},
-std::array<float,2>{0.365966976f, 0.225323856f},
-std::array<float,2>{0.546855927f, 0.813635468f},
-std::array<float,2>{0.405640215f, 0.933048666f},
-std::array<float,2>{0.733518243f, 0.119603932f},
-std::array<float,2>{0.145829946f, 0.385598511f},
-std::array<float,2>{0.806160271f, 0.57870698f},
-std::array<float,2>{0.24942027f, 0.988288343f},
-std::array<float,2>{0.861495197f, 0.0574876964f},
-std::array<float,2>{0.452062547f, 0.487873971f},
-std::array<float,2>{0.634556651f, 0.559794605f},
-std::array<float,2>{0.258364052f, 0.73713243f},
-std::array<float,2>{0.59933871f, 0.31476137f},
-std::array<float,2>{0.0712700039f, 0.138763353f},
-std::array<float,2>{0.924191058f, 0.752611518f},
-std::array<float,2>{0.00622091023f, 0.586048841f},
-std::array<float,2>{0.981573641f, 0.382546246f},
-std::array<float,2>{0.342230886f, 0.111551091f},
-std::array<float,2>{0.523865521f, 0.928375483f},
-std::array<float,2>{0.434483439f, 0.82589972f},
-std::array<float,2>{0.716249347f, 0.232006893f},
-std::array<float,2>{0.171199277f, 0.257171243f},
-std::array<float,2>{0.751354814f, 0.636876822f},
-std::array<float,2>{0.101151824f, 0.811920822f},
-std::array<float,2>{0.881217718f, 0.186401725f},
-std::array<float,2>{0.287413448f, 0.370977193f},
-std::array<float,2>{0.565990567f, 0.7141487f},
-std::array<float,2>{0.475656599f, 0.518059134f},
-std::array<float,2>{0.674820065f, 0.439532012f},
-std::array<float,2>{0.190536693f, 0.000580249238f},
-std::array<float,2>{0.839409411f, 0.951422572f},
-std::array<float,2>{0.150342613f, 0.658672392f},
-std::array<float,2>{0.798133731f, 0.301420629f},
-std::array<float,2>{0.391334534f, 0.217762649f},
-std::array<float,2>{0.726518214f, 0.857819676f},
-std::array<float,2>{0.370868236f, 0.88043648f},
-std::array<float,2>{0.532894015f, 0.0649152547f},
-std::array<float,2>{0.0418468267f, 0.431645632f},
-std::array<float,2>{0.959483504f, 0.61873287f},
-std::array<float,2>{0.0579188876f, 0.911791801f},
-std::array<float,2>{0.946889639f, 0.105327219f},
-std::array<float,2>{0.351147413f, 0.394029796f},
-std::array<float,2>{0.562489152f, 0.574896514f},
-std::array<float,2>{0.381923974f, 0.643114567f},
-std::array<float,2>{0.746369481f, 0.26981917f},
-std::array<float,2>{0.134326622f, 0.240452647f},
-std::array<float,2>{0.792778492f, 0.837444425f},
-std::array<float,2>{0.205662429f, 0.537199616f},
-std::array<float,2>{0.822186649f, 0.474089026f},
-std::array<float,2>{0.487703323f, 0.0391985066f},
-std::array<float,2>{0.661729276f, 0.969022155f},
-std::array<float,2>{0.297223985f, 0.779940128f},
-std::array<float,2>{0.587605536f, 0.14920716f},
-std::array<float,2>{0.116492823f, 0.339810401f},
-std::array<float,2>{0.904897451f, 0.721168399f},
-std::array<float,2>{0.181604281f, 0.868358493f},
-std::array<float,2>{0.77390492f, 0.19731541f},
-std::array<float,2>{0.415814698f, 0.288753599f},
-std::array<float,2>{0.687648833f, 0.676268995f},
-std::array<float,2>{0.324329138f, 0.603411973f},
-std::array<float,2>{0.503602386f, 0.418554366f},
-std::array<float,2>{0.0188579857f, 0.0914307162f},
-std::array<float,2>{0.998581529f, 0.898701906f},
-std::array<float,2>{0.0849241689f, 0.690830886f},
-std::array<float,2>{0.918540239f, 0.343795747f},
-std::array<float,2>{0.267042458f, 0.157781363f},
-std::array<float,2>{0.62180531f, 0.782518089f},
-std::array<float,2>{0.468704432f, 0.956629515f},
-std::array<float,2>{0.652529895f, 0.0273245797f},
-std::array<float,2>{0.232431665f, 0.460305095f},
-std::array<float,2>{0.857032955f, 0.509580731f},
-std::array<float,2>{0.222991839f, 0.877653301f},
-std::array<float,2>{0.844194829f, 0.0699392185f},
-std::array<float,2>{0.457281977f, 0.434738487f},
-std::array<float,2>{0.644616544f, 0.621949017f},
-std::array<float,2>{0.277950019f, 0.661786318f},
-std::array<float,2>{0.612377942f, 0.29807812f},
-std::array<float,2>{0.0869915336f, 0.212208539f},
-std::array<float,2>{0.909957647f, 0.854812145f},
-std::array<float,2>{0.0288607273f, 0.523344874f},
-std::array<float,2>{0.986058593f, 0.44161281f},
-std::array<float,2>{0.315819085f, 0.00498785963f},
-std::array<float,2>{0.513447165f, 0.94701606f},
-std::array<float,2>{0.412311107f, 0.807574868f},
-std::array<float,2>{0.698788643f, 0.182785705f},
-std::array<float,2>{0.177922845f, 0.371264249f},
-std::array<float,2>{0.770426512f, 0.717885137f},
-std::array<float,2>{0.120573916f, 0.820461869f},
-std::array<float,2>{0.896205604f, 0.226976708f},
-std::array<float,2>{0.30923894f, 0.251908869f},
-std::array<float,2>{0.58232069f, 0.634079754f},
-std::array<float,2>{0.499144077f, 0.591544509f},
-std::array<float,2>{0.66421926f, 0.377143979f},
-std::array<float,2>{0.21609956f, 0.113836177f},
-std::array<float,2>{0.813713312f, 0.922162056f},
-std::array<float,2>{0.132576451f, 0.739101946f},
-std::array<float,2>{0.782877982f, 0.319528699f},
-std::array<float,2>{0.38731572f, 0.134954184f},
-std::array<float,2>{0.739269853f, 0.756960988f},
-std::array<float,2>{0.354308516f, 0.985261202f},
-std::array<float,2>{0.550992548f, 0.0600481331f},
-std::array<float,2>{0.0527072921f, 0.489140064f},
-std::array<float,2>{0.944237173f, 0.554717958f},
-std::array<float,2>{0.037785843f, 0.957361221f},
-std::array<float,2>{0.962062001f, 0.0279410277f},
-std::array<float,2>{0.359407991f, 0.453240991f},
-std::array<float,2>{0.542209148f, 0.514354646f},
-std::array<float,2>{0.400283098f, 0.693111539f},
-std::array<float,2>{0.72862035f, 0.349822372f},
-std::array<float,2>{0.14393203f, 0.160715804f},
-std::array<float,2>{0.811636806f, 0.78826797f},
-std::array<float,2>{0.200295553f, 0.60565114f},
-std::array<float,2>{0.828802824f, 0.414994627f},
-std::array<float,2>{0.478880763f, 0.0895032808f},
-std::array<float,2>{0.681081355f, 0.905885696f},
-std::array<float,2>{0.293299943f, 0.874981999f},
-std::array<float,2>{0.575245261f, 0.202647835f},
-std::array<float,2>{0.106536239f, 0.282529444f},
-std::array<float,2>{0.890210867f, 0.675675154f},
-std::array<float,2>{0.157617167f, 0.774045825f},
-std::array<float,2>{0.758597493f, 0.153339118f},
-std::array<float,2>{0.424708545f, 0.340361983f},
-std::array<float,2>{0.710277557f, 0.724972725f},
-std::array<float,2>{0.32901746f, 0.532300174f},
-std::array<float,2>{0.518323183f, 0.470934033f},
-std::array<float,2>{0.0142968716f, 0.0454941466f},
-std::array<float,2>{0.975862145f, 0.974580407f},
-std::array<float,2>{0.0652133077f, 0.647789299f},
-std::array<float,2>{0.936614454f, 0.266086727f},
-std::array<float,2>{0.250815809f, 0.235170916f},
-std::array<float,2>{0.605163693f, 0.843563259f},
-std::array<float,2>{0.440241754f, 0.907460928f},
-std::array<float,2>{0.63264513f, 0.107236393f},
-std::array<float,2>{0.238501132f, 0.395427942f},
-std::array<float,2>{0.872211277f, 0.571884692f},
-std::array<float,2>{0.15365164f, 0.982750595f},
-std::array<float,2>{0.801487923f, 0.0348202549f},
-std::array<float,2>{0.396119416f, 0.478878438f},
-std::array<float,2>{0.720351994f, 0.539941609f},
-std::array<float,2>{0.374622643f, 0.727207243f},
-std::array<float,2>{0.537445366f, 0.328485191f},
-std::array<float,2>{0.0433911681f, 0.148018539f},
-std::array<float,2>{0.955523789f, 0.772996247f},
-std::array<float,2>{0.0958590358f, 0.566802382f},
-std::array<float,2>{0.875815749f, 0.40614f},
-std::array<float,2>{0.282004982f, 0.0966884419f},
-std::array<float,2>{0.56973505f, 0.918079078f},
-std::array<float,2>{0.469907492f, 0.834488928f},
-std::array<float,2>{0.676944256f, 0.246165529f},
-std::array<float,2>{0.193898439f, 0.277118772f},
-std::array<float,2>{0.841070771f, 0.651639581f},
-std::array<float,2>{0.00221687392f, 0.792883217f},
-std::array<float,2>{0.980207205f, 0.166925237f},
-std::array<float,2>{0.339044631f, 0.353108138f},
-std::array<float,2>{0.528547525f, 0.698751271f},
-std::array<float,2>{0.430803299f, 0.50239563f},
-std::array<float,2>{0.714093804f, 0.46195361f},
-std::array<float,2>{0.1652098f, 0.0172997415f},
-std::array<float,2>{0.755749226f, 0.964275122f},
-std::array<float,2>{0.243982285f, 0.686554313f},
-std::array<float,2>{0.863512158f, 0.29645595f},
-std::array<float,2>{0.447203636f, 0.187881812f},
-std::array<float,2>{0.639859438f, 0.865326464f},
-std::array<float,2>{0.264125228f, 0.897659481f},
-std::array<float,2>{0.595064819f, 0.0803866908f},
-std::array<float,2>{0.0774613172f, 0.40642193f},
-std::array<float,2>{0.927138627f, 0.598293722f},
-std::array<float,2>{0.0789077654f, 0.934683204f},
-std::array<float,2>{0.914392948f, 0.123045467f},
-std::array<float,2>{0.27154249f, 0.389016896f},
-std::array<float,2>{0.619345486f, 0.584229171f},
-std::array<float,2>{0.46208939f, 0.626685143f},
-std::array<float,2>{0.651196003f, 0.264995217f},
-std::array<float,2>{0.227138519f, 0.22025834f},
-std::array<float,2>{0.854234636f, 0.817332268f},
-std::array<float,2>{0.183825046f, 0.551706076f},
-std::array<float,2>{0.777491629f, 0.494230956f},
-std::array<float,2>{0.418209583f, 0.0535112135f},
-std::array<float,2>{0.694855034f, 0.992596805f},
-std::array<float,2>{0.320365369f, 0.765082121f},
-std::array<float,2>{0.505548179f, 0.129998714f},
-std::array<float,2>{0.0232720785f, 0.322266757f},
-std::array<float,2>{0.992902517f, 0.742488503f},
-std::array<float,2>{0.208820656f, 0.848736823f},
-std::array<float,2>{0.824825525f, 0.205261678f},
-std::array<float,2>{0.488476545f, 0.311919898f},
-std::array<float,2>{0.658936977f, 0.668384135f},
-std::array<float,2>{0.301205963f, 0.609932542f},
-std::array<float,2>{0.590649784f, 0.427139282f},
-std::array<float,2>{0.110373624f, 0.0721427798f},
-std::array<float,2>{0.900702596f, 0.889356077f},
-std::array<float,2>{0.062429253f, 0.70729214f},
-std::array<float,2>{0.95132345f, 0.365057558f},
-std::array<float,2>{0.34693101f, 0.176905558f},
-std::array<float,2>{0.557071745f, 0.79832232f},
-std::array<float,2>{0.377698451f, 0.944387913f},
-std::array<float,2>{0.744360864f, 0.01419756f},
-std::array<float,2>{0.137057692f, 0.449564278f},
-std::array<float,2>{0.794852376f, 0.526696086f},
-std::array<float,2>{0.173842847f, 0.915853441f},
-std::array<float,2>{0.767095387f, 0.0998235792f},
-std::array<float,2>{0.409873456f, 0.399668425f},
-std::array<float,2>{0.702902257f, 0.563271821f},
-std::array<float,2>{0.316810966f, 0.655501008f},
-std::array<float,2>{0.510058045f, 0.281009525f},
-std::array<float,2>{0.0246892907f, 0.242479861f},
-std::array<float,2>{0.990552425f, 0.831010938f},
-std::array<float,2>{0.090254426f, 0.545336962f},
-std::array<float,2>{0.91263628f, 0.482644588f},
-std::array<float,2>{0.273937047f, 0.0352327265f},
-std::array<float,2>{0.617050648f, 0.976854324f},
-std::array<float,2>{0.455606014f, 0.765896678f},
-std::array<float,2>{0.64252615f, 0.143943027f},
-std::array<float,2>{0.220473841f, 0.332821935f},
-std::array<float,2>{0.850319684f, 0.734249651f},
-std::array<float,2>{0.0503156111f, 0.861272693f},
-std::array<float,2>{0.938970089f, 0.194440424f},
-std::array<float,2>{0.356271446f, 0.290457636f},
-std::array<float,2>{0.550525486f, 0.68205446f},
-std::array<float,2>{0.384762198f, 0.595964313f},
-std::array<float,2>{0.734995484f, 0.412028074f},
-std::array<float,2>{0.126999393f, 0.0846908614f},
-std::array<float,2>{0.786795735f, 0.891506732f},
-std::array<float,2>{0.214366615f, 0.701146662f},
-std::array<float,2>{0.819329202f, 0.355993986f},
-std::array<float,2>{0.495601177f, 0.171264842f},
-std::array<float,2>{0.670939386f, 0.794351637f},
-std::array<float,2>{0.306468219f, 0.965105951f},
-std::array<float,2>{0.578169882f, 0.0210661292f},
-std::array<float,2>{0.124046125f, 0.46503666f},
-std::array<float,2>{0.891456187f, 0.506159306f},
-std::array<float,2>{0.102063015f, 0.998889923f},
-std::array<float,2>{0.885913134f, 0.0477464162f},
-std::array<float,2>{0.291836441f, 0.49950546f},
-std::array<float,2>{0.574093282f, 0.547639072f},
-std::array<float,2>{0.483109474f, 0.749690711f},
-std::array<float,2>{0.686396837f, 0.324569762f},
-std::array<float,2>{0.196529552f, 0.128212959f},
-std::array<float,2>{0.83453542f, 0.760466576f},
-std::array<float,2>{0.148290485f, 0.581748188f},
-std::array<float,2>{0.80763191f, 0.384603292f},
-std::array<float,2>{0.403375238f, 0.11870271f},
-std::array<float,2>{0.731363773f, 0.931223571f},
-std::array<float,2>{0.365026623f, 0.814624786f},
-std::array<float,2>{0.544164598f, 0.22422713f},
-std::array<float,2>{0.0317957141f, 0.258791357f},
-std::array<float,2>{0.967013359f, 0.629893661f},
-std::array<float,2>{0.23506853f, 0.80299741f},
-std::array<float,2>{0.86950016f, 0.172522694f},
-std::array<float,2>{0.443831921f, 0.359836668f},
-std::array<float,2>{0.6252442f, 0.705785751f},
-std::array<float,2>{0.256873995f, 0.528454959f},
-std::array<float,2>{0.605694175f, 0.448120177f},
-std::array<float,2>{0.0694466755f, 0.00931004435f},
-std::array<float,2>{0.932193875f, 0.939376473f},
-std::array<float,2>{0.010149207f, 0.667267859f},
-std::array<float,2>{0.971818924f, 0.307531148f},
-std::array<float,2>{0.335280925f, 0.21043621f},
-std::array<float,2>{0.522405982f, 0.844916046f},
-std::array<float,2>{0.426962018f, 0.886341453f},
-std::array<float,2>{0.706582963f, 0.0762123317f},
-std::array<float,2>{0.161810681f, 0.423193514f},
-std::array<float,2>{0.761753976f, 0.616172612f},
-std::array<float,2>{0.188907251f, 0.950041473f},
-std::array<float,2>{0.836496711f, 0.00218336983f},
-std::array<float,2>{0.473632097f, 0.438525885f},
-std::array<float,2>{0.673550367f, 0.515821874f},
-std::array<float,2>{0.285514712f, 0.712348104f},
-std::array<float,2>{0.564432263f, 0.368189514f},
-std::array<float,2>{0.0994231105f, 0.18379128f},
-std::array<float,2>{0.880849957f, 0.809213758f},
-std::array<float,2>{0.039183002f, 0.620150745f},
-std::array<float,2>{0.957903147f, 0.431342691f},
-std::array<float,2>{0.368878067f, 0.0635348037f},
-std::array<float,2>{0.534794271f, 0.8814134f},
-std::array<float,2>{0.393594831f, 0.856895506f},
-std::array<float,2>{0.72393775f, 0.216544524f},
-std::array<float,2>{0.150764585f, 0.30450502f},
-std::array<float,2>{0.799521148f, 0.658135176f},
-std::array<float,2>{0.0736331493f, 0.751097381f},
-std::array<float,2>{0.923511088f, 0.138001174f},
-std::array<float,2>{0.260227621f, 0.313283861f},
-std::array<float,2>{0.600438952f, 0.735953033f},
-std::array<float,2>{0.450280875f, 0.561577141f},
-std::array<float,2>{0.63651073f, 0.485942721f},
-std::array<float,2>{0.246204332f, 0.0558766909f},
-std::array<float,2>{0.86002636f, 0.991917551f},
-std::array<float,2>{0.169771597f, 0.63879025f},
-std::array<float,2>{0.753705919f, 0.253908187f},
-std::array<float,2>{0.436910391f, 0.232694134f},
-std::array<float,2>{0.717759073f, 0.826985478f},
-std::array<float,2>{0.34026736f, 0.927302837f},
-std::array<float,2>{0.527086198f, 0.10939341f},
-std::array<float,2>{0.00565886823f, 0.380243599f},
-std::array<float,2>{0.98264116f, 0.588388562f},
-std::array<float,2>{0.0168083292f, 0.901545525f},
-std::array<float,2>{0.997789145f, 0.0920958295f},
-std::array<float,2>{0.327011704f, 0.421501517f},
-std::array<float,2>{0.500509262f, 0.604960918f},
-std::array<float,2>{0.417213112f, 0.678006053f},
-std::array<float,2>{0.690430701f, 0.285953373f},
-std::array<float,2>{0.182235405f, 0.196567848f},
-std::array<float,2>{0.776314795f, 0.869442046f},
-std::array<float,2>{0.23125729f, 0.510662794f},
-std::array<float,2>{0.857755423f, 0.4587394f},
-std::array<float,2>{0.464906424f, 0.0248322543f},
-std::array<float,2>{0.654507697f, 0.953910232f},
-std::array<float,2>{0.268702656f, 0.784062684f},
-std::array<float,2>{0.624578416f, 0.158257484f},
-std::array<float,2>{0.0834327117f, 0.347337186f},
-std::array<float,2>{0.921016097f, 0.688009262f},
-std::array<float,2>{0.136430383f, 0.838709295f},
-std::array<float,2>{0.790217519f, 0.239348009f},
-std::array<float,2>{0.380465597f, 0.273361981f},
-std::array<float,2>{0.749811947f, 0.641304195f},
-std::array<float,2>{0.349210113f, 0.576449335f},
-std::array<float,2>{0.559488058f, 0.392181993f},
-std::array<float,2>{0.055463329f, 0.103031456f},
-std::array<float,2>{0.948481321f, 0.914031744f},
-std::array<float,2>{0.11461813f, 0.71932739f},
-std::array<float,2>{0.904046953f, 0.336094439f},
-std::array<float,2>{0.299058527f, 0.151885897f},
-std::array<float,2>{0.588074565f, 0.778061986f},
-std::array<float,2>{0.484693855f, 0.971495748f},
-std::array<float,2>{0.663145006f, 0.0425975062f},
-std::array<float,2>{0.204736575f, 0.474709243f},
-std::array<float,2>{0.823209763f, 0.53522855f},
-std::array<float,2>{0.24797371f, 0.928560317f},
-std::array<float,2>{0.861244738f, 0.111647174f},
-std::array<float,2>{0.449903995f, 0.382737666f},
-std::array<float,2>{0.634996355f, 0.586231112f},
-std::array<float,2>{0.26150319f, 0.637094319f},
-std::array<float,2>{0.601384401f, 0.256874472f},
-std::array<float,2>{0.0730925575f, 0.232317895f},
-std::array<float,2>{0.922549248f, 0.826167464f},
-std::array<float,2>{0.004773858f, 0.560025215f},
-std::array<float,2>{0.984108388f, 0.488122016f},
-std::array<float,2>{0.341400474f, 0.0573243611f},
-std::array<float,2>{0.525783658f, 0.988604188f},
-std::array<float,2>{0.435824752f, 0.752846301f},
-std::array<float,2>{0.718335629f, 0.139121801f},
-std::array<float,2>{0.168774754f, 0.314647317f},
-std::array<float,2>{0.752423048f, 0.736956775f},
-std::array<float,2>{0.0979627892f, 0.857455492f},
-std::array<float,2>{0.879064918f, 0.217379987f},
-std::array<float,2>{0.286547899f, 0.301707447f},
-std::array<float,2>{0.562573314f, 0.658349931f},
-std::array<float,2>{0.473950326f, 0.619100928f},
-std::array<float,2>{0.672830462f, 0.431953907f},
-std::array<float,2>{0.18771705f, 0.06446179f},
-std::array<float,2>{0.837462127f, 0.880807996f},
-std::array<float,2>{0.151846066f, 0.714105189f},
-std::array<float,2>{0.800264955f, 0.370828301f},
-std::array<float,2>{0.392626762f, 0.186093077f},
-std::array<float,2>{0.723053455f, 0.811555028f},
-std::array<float,2>{0.367206633f, 0.951361775f},
-std::array<float,2>{0.533997774f, 0.000781014096f},
-std::array<float,2>{0.0402265154f, 0.439798474f},
-std::array<float,2>{0.958701849f, 0.517630279f},
-std::array<float,2>{0.0557069816f, 0.968758762f},
-std::array<float,2>{0.948126435f, 0.0394522622f},
-std::array<float,2>{0.348269284f, 0.47383371f},
-std::array<float,2>{0.560310543f, 0.537383735f},
-std::array<float,2>{0.379450202f, 0.720886827f},
-std::array<float,2>{0.748204947f, 0.33956942f},
-std::array<float,2>{0.134851828f, 0.149095684f},
-std::array<float,2>{0.789297521f, 0.780192316f},
-std::array<float,2>{0.20347017f, 0.575162411f},
-std::array<float,2>{0.823692262f, 0.393569291f},
-std::array<float,2>{0.485688031f, 0.10516154f},
-std::array<float,2>{0.662994266f, 0.911892295f},
-std::array<float,2>{0.300739676f, 0.83769697f},
-std::array<float,2>{0.589421749f, 0.240632623f},
-std::array<float,2>{0.114149839f, 0.269680411f},
-std::array<float,2>{0.902903736f, 0.643347979f},
-std::array<float,2>{0.182824478f, 0.782252431f},
-std::array<float,2>{0.776945293f, 0.158075452f},
-std::array<float,2>{0.416980922f, 0.344232976f},
-std::array<float,2>{0.689751387f, 0.690545499f},
-std::array<float,2>{0.32739225f, 0.50941354f},
-std::array<float,2>{0.501521111f, 0.460177094f},
-std::array<float,2>{0.0156843867f, 0.0270594284f},
-std::array<float,2>{0.996825039f, 0.956872761f},
-std::array<float,2>{0.0825693682f, 0.67595619f},
-std::array<float,2>{0.920602739f, 0.289001465f},
-std::array<float,2>{0.268347204f, 0.197724968f},
-std::array<float,2>{0.623601794f, 0.868617535f},
-std::array<float,2>{0.466312587f, 0.898658812f},
-std::array<float,2>{0.655539572f, 0.0917700902f},
-std::array<float,2>{0.232107565f, 0.418880433f},
-std::array<float,2>{0.858945966f, 0.603243172f},
-std::array<float,2>{0.128702551f, 0.968320906f},
-std::array<float,2>{0.785241127f, 0.022913862f},
-std::array<float,2>{0.383113563f, 0.467151403f},
-std::array<float,2>{0.735585153f, 0.505767822f},
-std::array<float,2>{0.356886923f, 0.703006148f},
-std::array<float,2>{0.549537838f, 0.358121127f},
-std::array<float,2>{0.0491089523f, 0.168664396f},
-std::array<float,2>{0.938438654f, 0.796739161f},
-std::array<float,2>{0.123794176f, 0.594927609f},
-std::array<float,2>{0.892265141f, 0.414045483f},
-std::array<float,2>{0.305454731f, 0.0821204334f},
-std::array<float,2>{0.579760551f, 0.894502819f},
-std::array<float,2>{0.494926214f, 0.861633003f},
-std::array<float,2>{0.670810521f, 0.193352222f},
-std::array<float,2>{0.213636667f, 0.291479707f},
-std::array<float,2>{0.819953203f, 0.68127346f},
-std::array<float,2>{0.0237544719f, 0.769460261f},
-std::array<float,2>{0.991705656f, 0.141411126f},
-std::array<float,2>{0.317627668f, 0.335355282f},
-std::array<float,2>{0.511591971f, 0.732357681f},
-std::array<float,2>{0.409011543f, 0.544908702f},
-std::array<float,2>{0.701236486f, 0.481217384f},
-std::array<float,2>{0.175728247f, 0.0379071012f},
-std::array<float,2>{0.765782297f, 0.978780925f},
-std::array<float,2>{0.218980297f, 0.652365506f},
-std::array<float,2>{0.850586891f, 0.277413875f},
-std::array<float,2>{0.456799537f, 0.245757312f},
-std::array<float,2>{0.641212523f, 0.829099119f},
-std::array<float,2>{0.27525416f, 0.91606611f},
-std::array<float,2>{0.615262985f, 0.0991781652f},
-std::array<float,2>{0.0915561914f, 0.401395172f},
-std::array<float,2>{0.913701773f, 0.565553188f},
-std::array<float,2>{0.0686585084f, 0.883286357f},
-std::array<float,2>{0.932972729f, 0.0760350153f},
-std::array<float,2>{0.256224245f, 0.425183356f},
-std::array<float,2>{0.60708034f, 0.615157723f},
-std::array<float,2>{0.445099115f, 0.665277362f},
-std::array<float,2>{0.626519084f, 0.305160165f},
-std::array<float,2>{0.235406488f, 0.208068117f},
-std::array<float,2>{0.870751679f, 0.846826553f},
-std::array<float,2>{0.160920307f, 0.529781699f},
-std::array<float,2>{0.763471842f, 0.446128517f},
-std::array<float,2>{0.426437914f, 0.0109001473f},
-std::array<float,2>{0.705586016f, 0.939559817f},
-std::array<float,2>{0.33436054f, 0.801626563f},
-std::array<float,2>{0.522575974f, 0.174886048f},
-std::array<float,2>{0.0112281274f, 0.362443507f},
-std::array<float,2>{0.971129656f, 0.704820514f},
-std::array<float,2>{0.195803568f, 0.813898802f},
-std::array<float,2>{0.83567673f, 0.225533873f},
-std::array<float,2>{0.483812362f, 0.261009485f},
-std::array<float,2>{0.686699033f, 0.631346345f},
-std::array<float,2>{0.292088658f, 0.579005361f},
-std::array<float,2>{0.572431862f, 0.385281265f},
-std::array<float,2>{0.10340187f, 0.119254082f},
-std::array<float,2>{0.884856701f, 0.932830215f},
-std::array<float,2>{0.033027295f, 0.746344745f},
-std::array<float,2>{0.967800915f, 0.32737726f},
-std::array<float,2>{0.364087611f, 0.125224739f},
-std::array<float,2>{0.543666065f, 0.758559942f},
-std::array<float,2>{0.402577281f, 0.997217774f},
-std::array<float,2>{0.731969118f, 0.0497929156f},
-std::array<float,2>{0.147272795f, 0.497264534f},
-std::array<float,2>{0.807488978f, 0.549248219f},
-std::array<float,2>{0.164858177f, 0.895491481f},
-std::array<float,2>{0.754267275f, 0.0794923529f},
-std::array<float,2>{0.430138171f, 0.408408821f},
-std::array<float,2>{0.713277102f, 0.600921571f},
-std::array<float,2>{0.338838637f, 0.683969975f},
-std::array<float,2>{0.52765435f, 0.293639928f},
-std::array<float,2>{0.00343236933f, 0.190681756f},
-std::array<float,2>{0.978696704f, 0.86430347f},
-std::array<float,2>{0.0761757717f, 0.501392961f},
-std::array<float,2>{0.925971687f, 0.463718146f},
-std::array<float,2>{0.265445262f, 0.0180995911f},
-std::array<float,2>{0.594346523f, 0.962489009f},
-std::array<float,2>{0.445565611f, 0.790414393f},
-std::array<float,2>{0.639082253f, 0.165737852f},
-std::array<float,2>{0.242385432f, 0.354110062f},
-std::array<float,2>{0.864697635f, 0.696426928f},
-std::array<float,2>{0.0448298492f, 0.833176255f},
-std::array<float,2>{0.95618391f, 0.24970302f},
-std::array<float,2>{0.373601556f, 0.275384009f},
-std::array<float,2>{0.53897351f, 0.649863005f},
-std::array<float,2>{0.394824296f, 0.570089698f},
-std::array<float,2>{0.718844831f, 0.403372288f},
-std::array<float,2>{0.152494386f, 0.0943442583f},
-std::array<float,2>{0.802047849f, 0.921454847f},
-std::array<float,2>{0.194825441f, 0.729529679f},
-std::array<float,2>{0.840026617f, 0.331283867f},
-std::array<float,2>{0.469664872f, 0.145831972f},
-std::array<float,2>{0.676587701f, 0.771222591f},
-std::array<float,2>{0.282777011f, 0.981199086f},
-std::array<float,2>{0.568706572f, 0.0328554437f},
-std::array<float,2>{0.0970876068f, 0.476947725f},
-std::array<float,2>{0.876001954f, 0.541313052f},
-std::array<float,2>{0.109534718f, 0.943292081f},
-std::array<float,2>{0.902186453f, 0.0136090601f},
-std::array<float,2>{0.302582473f, 0.451223105f},
-std::array<float,2>{0.59161377f, 0.52377969f},
-std::array<float,2>{0.489753664f, 0.710866153f},
-std::array<float,2>{0.65918678f, 0.366101533f},
-std::array<float,2>{0.207990423f, 0.177736223f},
-std::array<float,2>{0.826017618f, 0.799081266f},
-std::array<float,2>{0.137925401f, 0.61152631f},
-std::array<float,2>{0.793299675f, 0.428064615f},
-std::array<float,2>{0.378752708f, 0.0723108351f},
-std::array<float,2>{0.745460331f, 0.887853026f},
-std::array<float,2>{0.346290141f, 0.849954963f},
-std::array<float,2>{0.558227181f, 0.203894481f},
-std::array<float,2>{0.0611026101f, 0.309445679f},
-std::array<float,2>{0.952675223f, 0.671003878f},
-std::array<float,2>{0.227556139f, 0.762615561f},
-std::array<float,2>{0.855064452f, 0.13155593f},
-std::array<float,2>{0.461846888f, 0.320999891f},
-std::array<float,2>{0.6519503f, 0.745326877f},
-std::array<float,2>{0.272611082f, 0.554653823f},
-std::array<float,2>{0.620720744f, 0.49335286f},
-std::array<float,2>{0.0798597336f, 0.0509555712f},
-std::array<float,2>{0.915816724f, 0.995379031f},
-std::array<float,2>{0.0217904635f, 0.628114641f},
-std::array<float,2>{0.993423045f, 0.263399631f},
-std::array<float,2>{0.321562231f, 0.222486004f},
-std::array<float,2>{0.503970206f, 0.820176005f},
-std::array<float,2>{0.41918844f, 0.936378181f},
-std::array<float,2>{0.694069803f, 0.124569789f},
-std::array<float,2>{0.185370877f, 0.388349831f},
-std::array<float,2>{0.778533161f, 0.583416283f},
-std::array<float,2>{0.21495828f, 0.986589491f},
-std::array<float,2>{0.813431799f, 0.0622760281f},
-std::array<float,2>{0.499006301f, 0.491222441f},
-std::array<float,2>{0.665101111f, 0.55787009f},
-std::array<float,2>{0.309763789f, 0.741670072f},
-std::array<float,2>{0.583462298f, 0.317705423f},
-std::array<float,2>{0.119345948f, 0.133143187f},
-std::array<float,2>{0.894950867f, 0.754952908f},
-std::array<float,2>{0.0514831953f, 0.592360497f},
-std::array<float,2>{0.945005059f, 0.376202315f},
-std::array<float,2>{0.354795247f, 0.116104007f},
-std::array<float,2>{0.552645922f, 0.9247545f},
-std::array<float,2>{0.388320535f, 0.822853982f},
-std::array<float,2>{0.739047289f, 0.229816154f},
-std::array<float,2>{0.131191358f, 0.252909601f},
-std::array<float,2>{0.782021999f, 0.635806084f},
-std::array<float,2>{0.0865378156f, 0.805259347f},
-std::array<float,2>{0.909153521f, 0.180133298f},
-std::array<float,2>{0.278734416f, 0.373651594f},
-std::array<float,2>{0.611929059f, 0.716016412f},
-std::array<float,2>{0.458039075f, 0.520023465f},
-std::array<float,2>{0.645655334f, 0.443411261f},
-std::array<float,2>{0.224538609f, 0.00644513685f},
-std::array<float,2>{0.844837844f, 0.948892474f},
-std::array<float,2>{0.178802401f, 0.662153304f},
-std::array<float,2>{0.771256447f, 0.300676405f},
-std::array<float,2>{0.41342929f, 0.213888124f},
-std::array<float,2>{0.697496653f, 0.8516137f},
-std::array<float,2>{0.314679503f, 0.875704229f},
-std::array<float,2>{0.512563527f, 0.0681218803f},
-std::array<float,2>{0.0281819906f, 0.436706662f},
-std::array<float,2>{0.985177517f, 0.623644531f},
-std::array<float,2>{0.0155947553f, 0.908796072f},
-std::array<float,2>{0.974659324f, 0.108093962f},
-std::array<float,2>{0.329384804f, 0.397100568f},
-std::array<float,2>{0.518670201f, 0.572487712f},
-std::array<float,2>{0.425778061f, 0.645921111f},
-std::array<float,2>{0.709910631f, 0.269360483f},
-std::array<float,2>{0.156260416f, 0.237016305f},
-std::array<float,2>{0.759652972f, 0.84158361f},
-std::array<float,2>{0.240118518f, 0.535035908f},
-std::array<float,2>{0.871181905f, 0.469485372f},
-std::array<float,2>{0.44069007f, 0.0441422053f},
-std::array<float,2>{0.631258547f, 0.974771321f},
-std::array<float,2>{0.251782477f, 0.775657952f},
-std::array<float,2>{0.604075074f, 0.15473932f},
-std::array<float,2>{0.0657192692f, 0.342057526f},
-std::array<float,2>{0.936241865f, 0.723733366f},
-std::array<float,2>{0.143258661f, 0.871236563f},
-std::array<float,2>{0.811000884f, 0.199995041f},
-std::array<float,2>{0.398810029f, 0.284949541f},
-std::array<float,2>{0.729760945f, 0.673716247f},
-std::array<float,2>{0.36050868f, 0.609263897f},
-std::array<float,2>{0.541547298f, 0.416865081f},
-std::array<float,2>{0.038504988f, 0.0869527608f},
-std::array<float,2>{0.961325943f, 0.904133737f},
-std::array<float,2>{0.106358938f, 0.694706917f},
-std::array<float,2>{0.888853252f, 0.3483347f},
-std::array<float,2>{0.294447452f, 0.162754729f},
-std::array<float,2>{0.574993134f, 0.786251307f},
-std::array<float,2>{0.480143309f, 0.95955503f},
-std::array<float,2>{0.679884195f, 0.0305831823f},
-std::array<float,2>{0.199556246f, 0.45689714f},
-std::array<float,2>{0.829912484f, 0.511890233f},
-std::array<float,2>{0.19010976f, 0.881743848f},
-std::array<float,2>{0.838145733f, 0.0638519973f},
-std::array<float,2>{0.474623471f, 0.431601554f},
-std::array<float,2>{0.67416364f, 0.62054038f},
-std::array<float,2>{0.288182974f, 0.657904327f},
-std::array<float,2>{0.565068185f, 0.304353565f},
-std::array<float,2>{0.100093693f, 0.216672987f},
-std::array<float,2>{0.882755995f, 0.856509268f},
-std::array<float,2>{0.0425176173f, 0.516029537f},
-std::array<float,2>{0.960747182f, 0.438941717f},
-std::array<float,2>{0.369325638f, 0.00234307162f},
-std::array<float,2>{0.53157264f, 0.949921608f},
-std::array<float,2>{0.39213571f, 0.809521735f},
-std::array<float,2>{0.724914968f, 0.183891341f},
-std::array<float,2>{0.148641691f, 0.368437737f},
-std::array<float,2>{0.797395647f, 0.712121427f},
-std::array<float,2>{0.0717689022f, 0.826710165f},
-std::array<float,2>{0.925054252f, 0.232619807f},
-std::array<float,2>{0.258898556f, 0.254317492f},
-std::array<float,2>{0.597976148f, 0.639049172f},
-std::array<float,2>{0.452553391f, 0.588796616f},
-std::array<float,2>{0.633698702f, 0.379986584f},
-std::array<float,2>{0.248811677f, 0.109745435f},
-std::array<float,2>{0.862356722f, 0.927571893f},
-std::array<float,2>{0.170045435f, 0.736214876f},
-std::array<float,2>{0.750202477f, 0.313082069f},
-std::array<float,2>{0.435256183f, 0.137807891f},
-std::array<float,2>{0.715048671f, 0.751323879f},
-std::array<float,2>{0.343171895f, 0.991957307f},
-std::array<float,2>{0.524822414f, 0.0559988618f},
-std::array<float,2>{0.00700530736f, 0.486221969f},
-std::array<float,2>{0.981206477f, 0.561803162f},
-std::array<float,2>{0.0176360775f, 0.953841567f},
-std::array<float,2>{0.999472082f, 0.0246409457f},
-std::array<float,2>{0.325680614f, 0.458872765f},
-std::array<float,2>{0.502199352f, 0.510472536f},
-std::array<float,2>{0.414339334f, 0.688340545f},
-std::array<float,2>{0.689068913f, 0.347611994f},
-std::array<float,2>{0.180261403f, 0.158477485f},
-std::array<float,2>{0.774886072f, 0.783773839f},
-std::array<float,2>{0.23433356f, 0.604614258f},
-std::array<float,2>{0.855675578f, 0.421804518f},
-std::array<float,2>{0.466923177f, 0.091877006f},
-std::array<float,2>{0.653488159f, 0.901754081f},
-std::array<float,2>{0.26586026f, 0.869345844f},
-std::array<float,2>{0.62255317f, 0.196320221f},
-std::array<float,2>{0.085278146f, 0.285854697f},
-std::array<float,2>{0.919611633f, 0.677791893f},
-std::array<float,2>{0.132950068f, 0.778193951f},
-std::array<float,2>{0.791459322f, 0.152229518f},
-std::array<float,2>{0.381533384f, 0.336291105f},
-std::array<float,2>{0.747593045f, 0.719497085f},
-std::array<float,2>{0.350364983f, 0.535545588f},
-std::array<float,2>{0.560591757f, 0.475070804f},
-std::array<float,2>{0.0571306534f, 0.042945303f},
-std::array<float,2>{0.945444822f, 0.97120291f},
-std::array<float,2>{0.116063714f, 0.641497374f},
-std::array<float,2>{0.905416608f, 0.273049742f},
-std::array<float,2>{0.298659712f, 0.239564091f},
-std::array<float,2>{0.586852133f, 0.838574708f},
-std::array<float,2>{0.487260193f, 0.913594246f},
-std::array<float,2>{0.660589278f, 0.103421181f},
-std::array<float,2>{0.206740081f, 0.39245829f},
-std::array<float,2>{0.820682943f, 0.57638675f},
-std::array<float,2>{0.172094554f, 0.976780415f},
-std::array<float,2>{0.767879903f, 0.0356390774f},
-std::array<float,2>{0.406646341f, 0.482797146f},
-std::array<float,2>{0.700051308f, 0.544937432f},
-std::array<float,2>{0.319339424f, 0.733999074f},
-std::array<float,2>{0.50820154f, 0.332621872f},
-std::array<float,2>{0.026762357f, 0.143726915f},
-std::array<float,2>{0.989201128f, 0.765641749f},
-std::array<float,2>{0.0924822837f, 0.563056469f},
-std::array<float,2>{0.911701202f, 0.399539173f},
-std::array<float,2>{0.275753886f, 0.0999273509f},
-std::array<float,2>{0.613363922f, 0.91553098f},
-std::array<float,2>{0.454935402f, 0.830592036f},
-std::array<float,2>{0.644442976f, 0.242418185f},
-std::array<float,2>{0.221063986f, 0.280775666f},
-std::array<float,2>{0.849166334f, 0.655740261f},
-std::array<float,2>{0.0485098101f, 0.794077635f},
-std::array<float,2>{0.940700173f, 0.171076432f},
-std::array<float,2>{0.35766691f, 0.356276304f},
-std::array<float,2>{0.546895206f, 0.700915098f},
-std::array<float,2>{0.385506004f, 0.506049037f},
-std::array<float,2>{0.737055004f, 0.465272695f},
-std::array<float,2>{0.126070723f, 0.0213109199f},
-std::array<float,2>{0.787147224f, 0.9650141f},
-std::array<float,2>{0.212080017f, 0.681699455f},
-std::array<float,2>{0.817463338f, 0.290146112f},
-std::array<float,2>{0.493489355f, 0.194613323f},
-std::array<float,2>{0.669809937f, 0.861040294f},
-std::array<float,2>{0.306736946f, 0.891354799f},
-std::array<float,2>{0.58085835f, 0.0847380832f},
-std::array<float,2>{0.121154718f, 0.411809236f},
-std::array<float,2>{0.892803729f, 0.59588176f},
-std::array<float,2>{0.104007646f, 0.931622207f},
-std::array<float,2>{0.883512497f, 0.118960358f},
-std::array<float,2>{0.290054202f, 0.384423703f},
-std::array<float,2>{0.570902526f, 0.582013011f},
-std::array<float,2>{0.482156157f, 0.630364656f},
-std::array<float,2>{0.685368001f, 0.259155095f},
-std::array<float,2>{0.197789982f, 0.224551782f},
-std::array<float,2>{0.832753241f, 0.814865947f},
-std::array<float,2>{0.144688055f, 0.547480226f},
-std::array<float,2>{0.805277705f, 0.499205023f},
-std::array<float,2>{0.404497415f, 0.0475610085f},
-std::array<float,2>{0.732948542f, 0.998723328f},
-std::array<float,2>{0.367068678f, 0.760667384f},
-std::array<float,2>{0.545531929f, 0.128150851f},
-std::array<float,2>{0.0344015211f, 0.324433476f},
-std::array<float,2>{0.965230405f, 0.74982971f},
-std::array<float,2>{0.236547396f, 0.845026016f},
-std::array<float,2>{0.867688715f, 0.210098341f},
-std::array<float,2>{0.442121089f, 0.307300001f},
-std::array<float,2>{0.627038717f, 0.6670205f},
-std::array<float,2>{0.25575766f, 0.61583519f},
-std::array<float,2>{0.608632684f, 0.422940403f},
-std::array<float,2>{0.0671538338f, 0.0764167458f},
-std::array<float,2>{0.931298852f, 0.886716545f},
-std::array<float,2>{0.00918093696f, 0.706004918f},
-std::array<float,2>{0.970576108f, 0.359400779f},
-std::array<float,2>{0.333150834f, 0.172770038f},
-std::array<float,2>{0.521357477f, 0.802817047f},
-std::array<float,2>{0.428854704f, 0.939085603f},
-std::array<float,2>{0.70355022f, 0.00964925624f},
-std::array<float,2>{0.163552791f, 0.447895348f},
-std::array<float,2>{0.765612066f, 0.528611243f},
-std::array<float,2>{0.154973164f, 0.918269575f},
-std::array<float,2>{0.804241657f, 0.0971008614f},
-std::array<float,2>{0.39759323f, 0.405882955f},
-std::array<float,2>{0.722200394f, 0.566489279f},
-std::array<float,2>{0.372436255f, 0.651411414f},
-std::array<float,2>{0.536799371f, 0.276916713f},
-std::array<float,2>{0.0468512587f, 0.246355638f},
-std::array<float,2>{0.953194022f, 0.834762514f},
-std::array<float,2>{0.0940914154f, 0.539737463f},
-std::array<float,2>{0.87884444f, 0.478572965f},
-std::array<float,2>{0.284413308f, 0.0349929743f},
-std::array<float,2>{0.566794813f, 0.982535779f},
-std::array<float,2>{0.470817327f, 0.773224652f},
-std::array<float,2>{0.678822994f, 0.148393676f},
-std::array<float,2>{0.191444516f, 0.328218848f},
-std::array<float,2>{0.841996431f, 0.727300346f},
-std::array<float,2>{0.00136318558f, 0.865646183f},
-std::array<float,2>{0.976796091f, 0.18764393f},
-std::array<float,2>{0.336519182f, 0.296818942f},
-std::array<float,2>{0.53121537f, 0.686905861f},
-std::array<float,2>{0.43341893f, 0.598485351f},
-std::array<float,2>{0.711151004f, 0.406533152f},
-std::array<float,2>{0.167850628f, 0.0801787376f},
-std::array<float,2>{0.757015824f, 0.89791131f},
-std::array<float,2>{0.245853364f, 0.699018896f},
-std::array<float,2>{0.866938233f, 0.353332013f},
-std::array<float,2>{0.447725475f, 0.16660516f},
-std::array<float,2>{0.637157798f, 0.792648494f},
-std::array<float,2>{0.262882471f, 0.963897347f},
-std::array<float,2>{0.595773697f, 0.0173505079f},
-std::array<float,2>{0.075838618f, 0.462272853f},
-std::array<float,2>{0.928833842f, 0.502010286f},
-std::array<float,2>{0.080397509f, 0.992414236f},
-std::array<float,2>{0.916427135f, 0.0534275547f},
-std::array<float,2>{0.270545095f, 0.494594216f},
-std::array<float,2>{0.618427038f, 0.551487923f},
-std::array<float,2>{0.46475926f, 0.742243052f},
-std::array<float,2>{0.649698734f, 0.322704047f},
-std::array<float,2>{0.230158374f, 0.130280331f},
-std::array<float,2>{0.852600753f, 0.764797688f},
-std::array<float,2>{0.185563102f, 0.584164202f},
-std::array<float,2>{0.780237556f, 0.388719052f},
-std::array<float,2>{0.420819968f, 0.122793786f},
-std::array<float,2>{0.692723155f, 0.934953809f},
-std::array<float,2>{0.324216783f, 0.817044318f},
-std::array<float,2>{0.507042289f, 0.220648453f},
-std::array<float,2>{0.0200948659f, 0.264697254f},
-std::array<float,2>{0.995479167f, 0.626748443f},
-std::array<float,2>{0.210103661f, 0.797964871f},
-std::array<float,2>{0.826517105f, 0.177072808f},
-std::array<float,2>{0.490540653f, 0.36491549f},
-std::array<float,2>{0.657510102f, 0.707098722f},
-std::array<float,2>{0.303183168f, 0.526464522f},
-std::array<float,2>{0.593156278f, 0.449423373f},
-std::array<float,2>{0.112475492f, 0.0145486929f},
-std::array<float,2>{0.899057508f, 0.944811165f},
-std::array<float,2>{0.0596210249f, 0.668152332f},
-std::array<float,2>{0.949956417f, 0.311744899f},
-std::array<float,2>{0.344165504f, 0.205487475f},
-std::array<float,2>{0.555684209f, 0.84897387f},
-std::array<float,2>{0.376522243f, 0.889624178f},
-std::array<float,2>{0.74289012f, 0.0718301162f},
-std::array<float,2>{0.139344513f, 0.426947176f},
-std::array<float,2>{0.796210349f, 0.610281646f},
-std::array<float,2>{0.225867227f, 0.947213054f},
-std::array<float,2>{0.84758532f, 0.00516487379f},
-std::array<float,2>{0.460099578f, 0.441678286f},
-std::array<float,2>{0.64670831f, 0.522967935f},
-std::array<float,2>{0.280326873f, 0.71804136f},
-std::array<float,2>{0.609393239f, 0.37145251f},
-std::array<float,2>{0.0883445367f, 0.182944521f},
-std::array<float,2>{0.907521009f, 0.807190597f},
-std::array<float,2>{0.0306203794f, 0.621655464f},
-std::array<float,2>{0.988056719f, 0.434922397f},
-std::array<float,2>{0.313252449f, 0.0701261684f},
-std::array<float,2>{0.513809085f, 0.877791047f},
-std::array<float,2>{0.411414057f, 0.854507685f},
-std::array<float,2>{0.697219431f, 0.212040097f},
-std::array<float,2>{0.175882742f, 0.298117071f},
-std::array<float,2>{0.772876263f, 0.6621086f},
-std::array<float,2>{0.117239393f, 0.75712961f},
-std::array<float,2>{0.897259712f, 0.135091186f},
-std::array<float,2>{0.311520725f, 0.31962806f},
-std::array<float,2>{0.585377574f, 0.738958716f},
-std::array<float,2>{0.498023689f, 0.555021167f},
-std::array<float,2>{0.666148961f, 0.488818318f},
-std::array<float,2>{0.21771808f, 0.0595851392f},
-std::array<float,2>{0.815840423f, 0.984930933f},
-std::array<float,2>{0.129222706f, 0.634032249f},
-std::array<float,2>{0.78356576f, 0.251650453f},
-std::array<float,2>{0.38932693f, 0.226597592f},
-std::array<float,2>{0.740939498f, 0.820592642f},
-std::array<float,2>{0.35243541f, 0.921997607f},
-std::array<float,2>{0.55426085f, 0.114051305f},
-std::array<float,2>{0.0527747311f, 0.377404034f},
-std::array<float,2>{0.942140281f, 0.59179002f},
-std::array<float,2>{0.0370619893f, 0.90607363f},
-std::array<float,2>{0.96374613f, 0.0898420736f},
-std::array<float,2>{0.362802178f, 0.414749026f},
-std::array<float,2>{0.54026866f, 0.605872929f},
-std::array<float,2>{0.40165627f, 0.675507545f},
-std::array<float,2>{0.726850688f, 0.282277763f},
-std::array<float,2>{0.141395658f, 0.202985644f},
-std::array<float,2>{0.809427142f, 0.874585927f},
-std::array<float,2>{0.201909304f, 0.514642537f},
-std::array<float,2>{0.830167532f, 0.453524441f},
-std::array<float,2>{0.477220535f, 0.0281018261f},
-std::array<float,2>{0.682902098f, 0.957116783f},
-std::array<float,2>{0.295278311f, 0.788526595f},
-std::array<float,2>{0.577553451f, 0.160931051f},
-std::array<float,2>{0.10820958f, 0.349914759f},
-std::array<float,2>{0.887937665f, 0.693192124f},
-std::array<float,2>{0.159871221f, 0.843453705f},
-std::array<float,2>{0.761602342f, 0.234973967f},
-std::array<float,2>{0.423780769f, 0.265756369f},
-std::array<float,2>{0.708127677f, 0.647550762f},
-std::array<float,2>{0.331948787f, 0.572090983f},
-std::array<float,2>{0.516124666f, 0.395178765f},
-std::array<float,2>{0.0134180188f, 0.107007645f},
-std::array<float,2>{0.974088252f, 0.907551646f},
-std::array<float,2>{0.0631954297f, 0.724738419f},
-std::array<float,2>{0.93438524f, 0.340746045f},
-std::array<float,2>{0.253705353f, 0.15380843f},
-std::array<float,2>{0.602762818f, 0.774368584f},
-std::array<float,2>{0.439093858f, 0.974361777f},
-std::array<float,2>{0.630388916f, 0.0458865389f},
-std::array<float,2>{0.241984904f, 0.47115916f},
-std::array<float,2>{0.87402302f, 0.53252697f},
-std::array<float,2>{0.205310509f, 0.910816252f},
-std::array<float,2>{0.821520209f, 0.104354285f},
-std::array<float,2>{0.48808217f, 0.393201053f},
-std::array<float,2>{0.66119647f, 0.57539171f},
-std::array<float,2>{0.297437876f, 0.64444828f},
-std::array<float,2>{0.587184906f, 0.270879656f},
-std::array<float,2>{0.116989262f, 0.241761163f},
-std::array<float,2>{0.904754996f, 0.836479425f},
-std::array<float,2>{0.0585907027f, 0.538884223f},
-std::array<float,2>{0.946355462f, 0.473134071f},
-std::array<float,2>{0.350688785f, 0.0409223177f},
-std::array<float,2>{0.561887681f, 0.970534027f},
-std::array<float,2>{0.382529408f, 0.780613661f},
-std::array<float,2>{0.746922255f, 0.150062427f},
-std::array<float,2>{0.133801833f, 0.338006794f},
-std::array<float,2>{0.792414784f, 0.72175169f},
-std::array<float,2>{0.0842721388f, 0.86786747f},
-std::array<float,2>{0.918245733f, 0.198976502f},
-std::array<float,2>{0.267369896f, 0.287680328f},
-std::array<float,2>{0.621198833f, 0.67698884f},
-std::array<float,2>{0.467981964f, 0.601650655f},
-std::array<float,2>{0.653279841f, 0.419732124f},
-std::array<float,2>{0.233275577f, 0.0905472636f},
-std::array<float,2>{0.856760681f, 0.899424374f},
-std::array<float,2>{0.181080669f, 0.690382361f},
-std::array<float,2>{0.774015725f, 0.345218867f},
-std::array<float,2>{0.415068895f, 0.156707481f},
-std::array<float,2>{0.688382506f, 0.781674743f},
-std::array<float,2>{0.325124174f, 0.955578983f},
-std::array<float,2>{0.503008544f, 0.0261181146f},
-std::array<float,2>{0.0193075761f, 0.459567517f},
-std::array<float,2>{0.998405695f, 0.50856024f},
-std::array<float,2>{0.00640507136f, 0.990010858f},
-std::array<float,2>{0.982194543f, 0.0581198335f},
-std::array<float,2>{0.342752039f, 0.486575156f},
-std::array<float,2>{0.524158478f, 0.559245467f},
-std::array<float,2>{0.434045434f, 0.737421155f},
-std::array<float,2>{0.716485322f, 0.316385388f},
-std::array<float,2>{0.171508282f, 0.140431315f},
-std::array<float,2>{0.751688004f, 0.753413737f},
-std::array<float,2>{0.249550864f, 0.586943448f},
-std::array<float,2>{0.86223793f, 0.381705552f},
-std::array<float,2>{0.451538026f, 0.113022454f},
-std::array<float,2>{0.634112179f, 0.929298043f},
-std::array<float,2>{0.257899046f, 0.825088799f},
-std::array<float,2>{0.598876417f, 0.230817452f},
-std::array<float,2>{0.0704098195f, 0.256090671f},
-std::array<float,2>{0.924566746f, 0.638660431f},
-std::array<float,2>{0.149661526f, 0.811382949f},
-std::array<float,2>{0.798523128f, 0.187420174f},
-std::array<float,2>{0.390664548f, 0.369404286f},
-std::array<float,2>{0.725856006f, 0.713489056f},
-std::array<float,2>{0.37050885f, 0.51884371f},
-std::array<float,2>{0.532370031f, 0.441373557f},
-std::array<float,2>{0.0412726663f, 0.001617081f},
-std::array<float,2>{0.95926249f, 0.952627182f},
-std::array<float,2>{0.100698955f, 0.66014415f},
-std::array<float,2>{0.88177371f, 0.301771194f},
-std::array<float,2>{0.287921071f, 0.218225732f},
-std::array<float,2>{0.565600693f, 0.85876894f},
-std::array<float,2>{0.476376086f, 0.879490256f},
-std::array<float,2>{0.675500631f, 0.0654542297f},
-std::array<float,2>{0.191007733f, 0.433395863f},
-std::array<float,2>{0.839192927f, 0.61743623f},
-std::array<float,2>{0.162763938f, 0.9406721f},
-std::array<float,2>{0.764103889f, 0.00997151807f},
-std::array<float,2>{0.428484023f, 0.446650445f},
-std::array<float,2>{0.704150558f, 0.530549884f},
-std::array<float,2>{0.332102031f, 0.703823209f},
-std::array<float,2>{0.519734859f, 0.362051129f},
-std::array<float,2>{0.00868201256f, 0.174686968f},
-std::array<float,2>{0.96907413f, 0.802275956f},
-std::array<float,2>{0.0682486221f, 0.613788486f},
-std::array<float,2>{0.930582821f, 0.424213797f},
-std::array<float,2>{0.254219204f, 0.0748537406f},
-std::array<float,2>{0.60835129f, 0.884039164f},
-std::array<float,2>{0.442762703f, 0.845950663f},
-std::array<float,2>{0.62822783f, 0.20713079f},
-std::array<float,2>{0.237913787f, 0.306017667f},
-std::array<float,2>{0.869023085f, 0.664854348f},
-std::array<float,2>{0.033856716f, 0.759348154f},
-std::array<float,2>{0.966548979f, 0.126937136f},
-std::array<float,2>{0.365522444f, 0.326506704f},
-std::array<float,2>{0.546105981f, 0.747147799f},
-std::array<float,2>{0.40606606f, 0.550007463f},
-std::array<float,2>{0.733887732f, 0.496678025f},
-std::array<float,2>{0.146458641f, 0.0500209033f},
-std::array<float,2>{0.805768251f, 0.996094823f},
-std::array<float,2>{0.198996603f, 0.632519186f},
-std::array<float,2>{0.83364743f, 0.26061818f},
-std::array<float,2>{0.481127739f, 0.226329237f},
-std::array<float,2>{0.68413794f, 0.812675476f},
-std::array<float,2>{0.289323866f, 0.932554722f},
-std::array<float,2>{0.572004378f, 0.120635793f},
-std::array<float,2>{0.104975529f, 0.38607946f},
-std::array<float,2>{0.884168684f, 0.579287648f},
-std::array<float,2>{0.122625336f, 0.893551469f},
-std::array<float,2>{0.893603384f, 0.0839717686f},
-std::array<float,2>{0.30774489f, 0.412223011f},
-std::array<float,2>{0.58198595f, 0.594210386f},
-std::array<float,2>{0.493159056f, 0.680063367f},
-std::array<float,2>{0.668044984f, 0.292038947f},
-std::array<float,2>{0.211812064f, 0.191498876f},
-std::array<float,2>{0.816821158f, 0.863278508f},
-std::array<float,2>{0.125515088f, 0.504044294f},
-std::array<float,2>{0.788392365f, 0.46870631f},
-std::array<float,2>{0.386339098f, 0.0223170463f},
-std::array<float,2>{0.737790108f, 0.967001915f},
-std::array<float,2>{0.358906329f, 0.795862854f},
-std::array<float,2>{0.548668504f, 0.169801712f},
-std::array<float,2>{0.0476942174f, 0.358536631f},
-std::array<float,2>{0.940317214f, 0.701283872f},
-std::array<float,2>{0.22194919f, 0.829923928f},
-std::array<float,2>{0.848521173f, 0.244676337f},
-std::array<float,2>{0.453779697f, 0.278462887f},
-std::array<float,2>{0.642606616f, 0.653527021f},
-std::array<float,2>{0.276628673f, 0.564478636f},
-std::array<float,2>{0.614413559f, 0.400964081f},
-std::array<float,2>{0.0932250917f, 0.0977973565f},
-std::array<float,2>{0.910597086f, 0.917183876f},
-std::array<float,2>{0.0261844248f, 0.730501413f},
-std::array<float,2>{0.989631653f, 0.334003389f},
-std::array<float,2>{0.318724304f, 0.141969174f},
-std::array<float,2>{0.509186029f, 0.76780355f},
-std::array<float,2>{0.407617211f, 0.979944885f},
-std::array<float,2>{0.70028007f, 0.0382447243f},
-std::array<float,2>{0.173325717f, 0.481793433f},
-std::array<float,2>{0.768778265f, 0.543029904f},
-std::array<float,2>{0.140555665f, 0.886894107f},
-std::array<float,2>{0.795379281f, 0.073733896f},
-std::array<float,2>{0.375627756f, 0.429423213f},
-std::array<float,2>{0.743706763f, 0.6125018f},
-std::array<float,2>{0.345585048f, 0.670704722f},
-std::array<float,2>{0.555156887f, 0.310101867f},
-std::array<float,2>{0.0594823621f, 0.204696909f},
-std::array<float,2>{0.951015651f, 0.851275027f},
-std::array<float,2>{0.112132907f, 0.524639726f},
-std::array<float,2>{0.899693131f, 0.45219329f},
-std::array<float,2>{0.304279834f, 0.0124763334f},
-std::array<float,2>{0.592427433f, 0.942067444f},
-std::array<float,2>{0.491532892f, 0.799916565f},
-std::array<float,2>{0.657179952f, 0.179318935f},
-std::array<float,2>{0.209681571f, 0.366403908f},
-std::array<float,2>{0.827584088f, 0.709350944f},
-std::array<float,2>{0.0213904381f, 0.818574131f},
-std::array<float,2>{0.994491458f, 0.221222445f},
-std::array<float,2>{0.322438031f, 0.26176393f},
-std::array<float,2>{0.506168008f, 0.627036989f},
-std::array<float,2>{0.421026528f, 0.582559884f},
-std::array<float,2>{0.691661298f, 0.387386024f},
-std::array<float,2>{0.186734498f, 0.123713806f},
-std::array<float,2>{0.780995309f, 0.937027216f},
-std::array<float,2>{0.229488954f, 0.744922042f},
-std::array<float,2>{0.851875424f, 0.321505278f},
-std::array<float,2>{0.463073552f, 0.131869733f},
-std::array<float,2>{0.648863018f, 0.763498425f},
-std::array<float,2>{0.269923002f, 0.994733274f},
-std::array<float,2>{0.617319643f, 0.0522707254f},
-std::array<float,2>{0.08114665f, 0.492214531f},
-std::array<float,2>{0.917662024f, 0.553434968f},
-std::array<float,2>{0.0745298862f, 0.961034536f},
-std::array<float,2>{0.927793086f, 0.0194369182f},
-std::array<float,2>{0.262000293f, 0.463962197f},
-std::array<float,2>{0.597305f, 0.50088203f},
-std::array<float,2>{0.44859916f, 0.695337594f},
-std::array<float,2>{0.637981296f, 0.354634643f},
-std::array<float,2>{0.244413123f, 0.164439291f},
-std::array<float,2>{0.865620196f, 0.7896896f},
-std::array<float,2>{0.166674837f, 0.599876165f},
-std::array<float,2>{0.756280422f, 0.409662902f},
-std::array<float,2>{0.432458103f, 0.0786143467f},
-std::array<float,2>{0.712252736f, 0.896430254f},
-std::array<float,2>{0.337098688f, 0.863766432f},
-std::array<float,2>{0.53012991f, 0.190368831f},
-std::array<float,2>{0.000187761645f, 0.294406295f},
-std::array<float,2>{0.977670431f, 0.68544364f},
-std::array<float,2>{0.193257689f, 0.769834816f},
-std::array<float,2>{0.843716681f, 0.144797489f},
-std::array<float,2>{0.472349495f, 0.330525875f},
-std::array<float,2>{0.678575814f, 0.729034603f},
-std::array<float,2>{0.28414011f, 0.542095602f},
-std::array<float,2>{0.568006456f, 0.478006035f},
-std::array<float,2>{0.0955080763f, 0.0317995399f},
-std::array<float,2>{0.87753129f, 0.982259214f},
-std::array<float,2>{0.0449907072f, 0.648866355f},
-std::array<float,2>{0.955028594f, 0.274066001f},
-std::array<float,2>{0.371678352f, 0.248835668f},
-std::array<float,2>{0.535507202f, 0.832794487f},
-std::array<float,2>{0.397288203f, 0.920294106f},
-std::array<float,2>{0.720819712f, 0.0951840878f},
-std::array<float,2>{0.155282587f, 0.402481616f},
-std::array<float,2>{0.803069413f, 0.568656445f},
-std::array<float,2>{0.240347281f, 0.976170361f},
-std::array<float,2>{0.874577403f, 0.0432172343f},
-std::array<float,2>{0.438293815f, 0.470140934f},
-std::array<float,2>{0.629345655f, 0.533883452f},
-std::array<float,2>{0.252160788f, 0.723059237f},
-std::array<float,2>{0.60245651f, 0.343544304f},
-std::array<float,2>{0.0642588213f, 0.155729875f},
-std::array<float,2>{0.935417056f, 0.776800692f},
-std::array<float,2>{0.0126536898f, 0.573894322f},
-std::array<float,2>{0.97329849f, 0.397671849f},
-std::array<float,2>{0.330202907f, 0.109152913f},
-std::array<float,2>{0.517250597f, 0.910074651f},
-std::array<float,2>{0.422678798f, 0.840558469f},
-std::array<float,2>{0.707543015f, 0.237560391f},
-std::array<float,2>{0.158844113f, 0.267988265f},
-std::array<float,2>{0.760008514f, 0.645171583f},
-std::array<float,2>{0.108741477f, 0.786065876f},
-std::array<float,2>{0.88764447f, 0.163906515f},
-std::array<float,2>{0.295940846f, 0.348798037f},
-std::array<float,2>{0.576890349f, 0.693460345f},
-std::array<float,2>{0.477594107f, 0.513267159f},
-std::array<float,2>{0.682386935f, 0.45517084f},
-std::array<float,2>{0.202552304f, 0.0302446131f},
-std::array<float,2>{0.831509411f, 0.960202515f},
-std::array<float,2>{0.142567992f, 0.672579229f},
-std::array<float,2>{0.810511827f, 0.283293813f},
-std::array<float,2>{0.400456578f, 0.20103322f},
-std::array<float,2>{0.728476882f, 0.872285426f},
-std::array<float,2>{0.361806959f, 0.903155267f},
-std::array<float,2>{0.539098501f, 0.0864807591f},
-std::array<float,2>{0.0360738374f, 0.417034835f},
-std::array<float,2>{0.964788496f, 0.607551277f},
-std::array<float,2>{0.053768605f, 0.925249934f},
-std::array<float,2>{0.942561507f, 0.116764113f},
-std::array<float,2>{0.352688938f, 0.375125438f},
-std::array<float,2>{0.552793622f, 0.593034327f},
-std::array<float,2>{0.389894843f, 0.635664582f},
-std::array<float,2>{0.742011726f, 0.25360474f},
-std::array<float,2>{0.130810216f, 0.228796124f},
-std::array<float,2>{0.784221888f, 0.823272049f},
-std::array<float,2>{0.217939109f, 0.556994975f},
-std::array<float,2>{0.814706862f, 0.490980536f},
-std::array<float,2>{0.496188074f, 0.0606260039f},
-std::array<float,2>{0.667330146f, 0.987956345f},
-std::array<float,2>{0.312174261f, 0.753958523f},
-std::array<float,2>{0.584190667f, 0.134191334f},
-std::array<float,2>{0.118666045f, 0.316552848f},
-std::array<float,2>{0.89842844f, 0.740465045f},
-std::array<float,2>{0.177131787f, 0.853320479f},
-std::array<float,2>{0.772319853f, 0.213467449f},
-std::array<float,2>{0.411022156f, 0.299462765f},
-std::array<float,2>{0.695577919f, 0.6630885f},
-std::array<float,2>{0.314159662f, 0.624887645f},
-std::array<float,2>{0.515276909f, 0.435694218f},
-std::array<float,2>{0.0302254707f, 0.0669915229f},
-std::array<float,2>{0.986659229f, 0.876260459f},
-std::array<float,2>{0.0893719345f, 0.715796471f},
-std::array<float,2>{0.906906605f, 0.374165952f},
-std::array<float,2>{0.279302984f, 0.18141979f},
-std::array<float,2>{0.611109078f, 0.805993617f},
-std::array<float,2>{0.459084988f, 0.947556317f},
-std::array<float,2>{0.648103297f, 0.00717627676f},
-std::array<float,2>{0.224687546f, 0.444382906f},
-std::array<float,2>{0.846652389f, 0.520577371f},
-std::array<float,2>{0.230679855f, 0.900602818f},
-std::array<float,2>{0.858013272f, 0.0934457481f},
-std::array<float,2>{0.465735108f, 0.420721173f},
-std::array<float,2>{0.655116081f, 0.603935599f},
-std::array<float,2>{0.269482702f, 0.67966193f},
-std::array<float,2>{0.624231815f, 0.28624925f},
-std::array<float,2>{0.0839285627f, 0.195450738f},
-std::array<float,2>{0.92162472f, 0.870223284f},
-std::array<float,2>{0.0172544699f, 0.511136949f},
-std::array<float,2>{0.997077763f, 0.457511634f},
-std::array<float,2>{0.326449633f, 0.0237328801f},
-std::array<float,2>{0.500186503f, 0.954796672f},
-std::array<float,2>{0.417834938f, 0.784753621f},
-std::array<float,2>{0.691126883f, 0.159380585f},
-std::array<float,2>{0.181725025f, 0.346359044f},
-std::array<float,2>{0.775465906f, 0.688615978f},
-std::array<float,2>{0.115214653f, 0.838993311f},
-std::array<float,2>{0.903628349f, 0.239205107f},
-std::array<float,2>{0.299629867f, 0.272019833f},
-std::array<float,2>{0.588474691f, 0.641666114f},
-std::array<float,2>{0.485282302f, 0.577283204f},
-std::array<float,2>{0.664060414f, 0.391343176f},
-std::array<float,2>{0.204519704f, 0.10187614f},
-std::array<float,2>{0.82246238f, 0.912439644f},
-std::array<float,2>{0.135882914f, 0.720465541f},
-std::array<float,2>{0.790664434f, 0.33712092f},
-std::array<float,2>{0.380220145f, 0.151279896f},
-std::array<float,2>{0.749320567f, 0.779136002f},
-std::array<float,2>{0.34868893f, 0.971921682f},
-std::array<float,2>{0.558928668f, 0.0411977507f},
-std::array<float,2>{0.0549262054f, 0.475719541f},
-std::array<float,2>{0.949142635f, 0.536328912f},
-std::array<float,2>{0.0396811478f, 0.950704813f},
-std::array<float,2>{0.957175672f, 0.00316662318f},
-std::array<float,2>{0.368247271f, 0.438147455f},
-std::array<float,2>{0.53431052f, 0.517469704f},
-std::array<float,2>{0.394168556f, 0.711497962f},
-std::array<float,2>{0.724584758f, 0.36779654f},
-std::array<float,2>{0.151048675f, 0.185353532f},
-std::array<float,2>{0.798990428f, 0.810064614f},
-std::array<float,2>{0.189436033f, 0.619309485f},
-std::array<float,2>{0.836221576f, 0.429942459f},
-std::array<float,2>{0.473130703f, 0.0632899255f},
-std::array<float,2>{0.6729936f, 0.882666945f},
-std::array<float,2>{0.285997927f, 0.855695009f},
-std::array<float,2>{0.563835621f, 0.21548456f},
-std::array<float,2>{0.0991046801f, 0.302744478f},
-std::array<float,2>{0.879910052f, 0.656254172f},
-std::array<float,2>{0.169041455f, 0.750415683f},
-std::array<float,2>{0.753315568f, 0.136886224f},
-std::array<float,2>{0.437239081f, 0.313779861f},
-std::array<float,2>{0.716856778f, 0.734851599f},
-std::array<float,2>{0.340468943f, 0.561303616f},
-std::array<float,2>{0.526403666f, 0.484771878f},
-std::array<float,2>{0.00512953894f, 0.0555132478f},
-std::array<float,2>{0.98334986f, 0.990845501f},
-std::array<float,2>{0.0740746111f, 0.640415967f},
-std::array<float,2>{0.923027039f, 0.25513801f},
-std::array<float,2>{0.260559052f, 0.233684823f},
-std::array<float,2>{0.599722564f, 0.827497721f},
-std::array<float,2>{0.450982451f, 0.926730454f},
-std::array<float,2>{0.636031747f, 0.111257799f},
-std::array<float,2>{0.247046083f, 0.379543066f},
-std::array<float,2>{0.859776735f, 0.589099824f},
-std::array<float,2>{0.147549897f, 0.9991045f},
-std::array<float,2>{0.808250248f, 0.0483562425f},
-std::array<float,2>{0.404121697f, 0.498899162f},
-std::array<float,2>{0.730927348f, 0.548712671f},
-std::array<float,2>{0.364653498f, 0.748394072f},
-std::array<float,2>{0.544440866f, 0.326112092f},
-std::array<float,2>{0.031496007f, 0.127668634f},
-std::array<float,2>{0.967544079f, 0.761490405f},
-std::array<float,2>{0.101826511f, 0.580383956f},
-std::array<float,2>{0.886327147f, 0.383419484f},
-std::array<float,2>{0.291315943f, 0.117271304f},
-std::array<float,2>{0.573578417f, 0.930291831f},
-std::array<float,2>{0.482531816f, 0.815951645f},
-std::array<float,2>{0.685962319f, 0.22289589f},
-std::array<float,2>{0.197037548f, 0.258073151f},
-std::array<float,2>{0.834311187f, 0.629828572f},
-std::array<float,2>{0.0106919091f, 0.804534018f},
-std::array<float,2>{0.972653508f, 0.173436463f},
-std::array<float,2>{0.335653752f, 0.361260474f},
-std::array<float,2>{0.521749139f, 0.706675291f},
-std::array<float,2>{0.427330285f, 0.528191626f},
-std::array<float,2>{0.706334651f, 0.448294252f},
-std::array<float,2>{0.161218688f, 0.00786809716f},
-std::array<float,2>{0.762581885f, 0.938404739f},
-std::array<float,2>{0.234701142f, 0.666153669f},
-std::array<float,2>{0.869884491f, 0.307659894f},
-std::array<float,2>{0.443931937f, 0.209350184f},
-std::array<float,2>{0.62591815f, 0.84391588f},
-std::array<float,2>{0.257359922f, 0.885348797f},
-std::array<float,2>{0.606209278f, 0.0773129016f},
-std::array<float,2>{0.0700265989f, 0.422307432f},
-std::array<float,2>{0.932089508f, 0.616609633f},
-std::array<float,2>{0.090483509f, 0.914622009f},
-std::array<float,2>{0.912414849f, 0.100920677f},
-std::array<float,2>{0.273736179f, 0.398890465f},
-std::array<float,2>{0.616474867f, 0.56396389f},
-std::array<float,2>{0.455523819f, 0.6544438f},
-std::array<float,2>{0.641680717f, 0.279425234f},
-std::array<float,2>{0.219852164f, 0.244021699f},
-std::array<float,2>{0.849850297f, 0.831165016f},
-std::array<float,2>{0.174530819f, 0.546167731f},
-std::array<float,2>{0.766799331f, 0.484040827f},
-std::array<float,2>{0.409530312f, 0.0370340534f},
-std::array<float,2>{0.702620506f, 0.977905214f},
-std::array<float,2>{0.31691429f, 0.766781211f},
-std::array<float,2>{0.510262847f, 0.143261284f},
-std::array<float,2>{0.0250514075f, 0.333491683f},
-std::array<float,2>{0.990725398f, 0.733333468f},
-std::array<float,2>{0.214085773f, 0.859799087f},
-std::array<float,2>{0.818701148f, 0.193678007f},
-std::array<float,2>{0.495918989f, 0.289730936f},
-std::array<float,2>{0.671445966f, 0.683173537f},
-std::array<float,2>{0.305700392f, 0.596960187f},
-std::array<float,2>{0.578900814f, 0.410156876f},
-std::array<float,2>{0.124861144f, 0.0849704072f},
-std::array<float,2>{0.890882671f, 0.89185214f},
-std::array<float,2>{0.0502600558f, 0.699239433f},
-std::array<float,2>{0.938931286f, 0.357334733f},
-std::array<float,2>{0.35580048f, 0.170152158f},
-std::array<float,2>{0.549950361f, 0.79326278f},
-std::array<float,2>{0.384254426f, 0.966207266f},
-std::array<float,2>{0.734607935f, 0.0199839268f},
-std::array<float,2>{0.127690926f, 0.466605365f},
-std::array<float,2>{0.786473274f, 0.507369518f},
-std::array<float,2>{0.184218422f, 0.934210658f},
-std::array<float,2>{0.77791512f, 0.121595912f},
-std::array<float,2>{0.418547601f, 0.39023906f},
-std::array<float,2>{0.694613039f, 0.585739136f},
-std::array<float,2>{0.321227968f, 0.625700295f},
-std::array<float,2>{0.505179048f, 0.264410287f},
-std::array<float,2>{0.022939451f, 0.21894899f},
-std::array<float,2>{0.992616355f, 0.817498922f},
-std::array<float,2>{0.0786114931f, 0.552080572f},
-std::array<float,2>{0.914961815f, 0.495444775f},
-std::array<float,2>{0.272423893f, 0.0545238517f},
-std::array<float,2>{0.619878471f, 0.993928015f},
-std::array<float,2>{0.462688774f, 0.763749301f},
-std::array<float,2>{0.650837362f, 0.129803151f},
-std::array<float,2>{0.226678371f, 0.323989153f},
-std::array<float,2>{0.853794754f, 0.74372679f},
-std::array<float,2>{0.061838761f, 0.848527074f},
-std::array<float,2>{0.952027857f, 0.206362844f},
-std::array<float,2>{0.347462684f, 0.310808122f},
-std::array<float,2>{0.557190239f, 0.669658065f},
-std::array<float,2>{0.377359867f, 0.611306608f},
-std::array<float,2>{0.744956017f, 0.425926387f},
-std::array<float,2>{0.137528181f, 0.0707542673f},
-std::array<float,2>{0.794310808f, 0.889971733f},
-std::array<float,2>{0.208101869f, 0.708635151f},
-std::array<float,2>{0.824415743f, 0.363579035f},
-std::array<float,2>{0.489136726f, 0.176546842f},
-std::array<float,2>{0.658311844f, 0.797371566f},
-std::array<float,2>{0.301431328f, 0.943504095f},
-std::array<float,2>{0.589996099f, 0.0148770381f},
-std::array<float,2>{0.110870279f, 0.451150745f},
-std::array<float,2>{0.901334286f, 0.525855005f},
-std::array<float,2>{0.0965663791f, 0.984078586f},
-std::array<float,2>{0.875454545f, 0.0335826576f},
-std::array<float,2>{0.28141728f, 0.480079621f},
-std::array<float,2>{0.570046902f, 0.540792704f},
-std::array<float,2>{0.470365047f, 0.72798574f},
-std::array<float,2>{0.677349329f, 0.330046177f},
-std::array<float,2>{0.193530396f, 0.146714091f},
-std::array<float,2>{0.84155339f, 0.771980047f},
-std::array<float,2>{0.154182345f, 0.568130612f},
-std::array<float,2>{0.800932527f, 0.404310942f},
-std::array<float,2>{0.395754069f, 0.0961648226f},
-std::array<float,2>{0.719851017f, 0.919505298f},
-std::array<float,2>{0.374334604f, 0.83589685f},
-std::array<float,2>{0.53783381f, 0.247636259f},
-std::array<float,2>{0.043484766f, 0.275589406f},
-std::array<float,2>{0.955627739f, 0.651309788f},
-std::array<float,2>{0.243231401f, 0.79182601f},
-std::array<float,2>{0.864013135f, 0.167427972f},
-std::array<float,2>{0.446527034f, 0.351879984f},
-std::array<float,2>{0.640546322f, 0.697802603f},
-std::array<float,2>{0.264192343f, 0.503473997f},
-std::array<float,2>{0.595649898f, 0.461419046f},
-std::array<float,2>{0.0777980462f, 0.0159958582f},
-std::array<float,2>{0.927344441f, 0.963302255f},
-std::array<float,2>{0.00261991611f, 0.686362147f},
-std::array<float,2>{0.979691148f, 0.295327336f},
-std::array<float,2>{0.339663714f, 0.189073533f},
-std::array<float,2>{0.529254973f, 0.866946518f},
-std::array<float,2>{0.431236118f, 0.89652276f},
-std::array<float,2>{0.714368641f, 0.0815995336f},
-std::array<float,2>{0.165682822f, 0.40743944f},
-std::array<float,2>{0.755334198f, 0.598958433f},
-std::array<float,2>{0.200890064f, 0.958626688f},
-std::array<float,2>{0.828314781f, 0.0292721801f},
-std::array<float,2>{0.479329169f, 0.454667538f},
-std::array<float,2>{0.681200624f, 0.515511334f},
-std::array<float,2>{0.293869615f, 0.692044795f},
-std::array<float,2>{0.57573545f, 0.350659251f},
-std::array<float,2>{0.107310943f, 0.161420748f},
-std::array<float,2>{0.889817119f, 0.787666321f},
-std::array<float,2>{0.0372208282f, 0.607376456f},
-std::array<float,2>{0.962505758f, 0.416008174f},
-std::array<float,2>{0.360164434f, 0.087902993f},
-std::array<float,2>{0.542672098f, 0.904510796f},
-std::array<float,2>{0.399759024f, 0.873545289f},
-std::array<float,2>{0.729405105f, 0.202065453f},
-std::array<float,2>{0.144186288f, 0.281632453f},
-std::array<float,2>{0.812186241f, 0.674666941f},
-std::array<float,2>{0.064806968f, 0.77465421f},
-std::array<float,2>{0.937245429f, 0.152608633f},
-std::array<float,2>{0.250404149f, 0.341338009f},
-std::array<float,2>{0.604499459f, 0.725710809f},
-std::array<float,2>{0.439752668f, 0.532025278f},
-std::array<float,2>{0.632195354f, 0.47223404f},
-std::array<float,2>{0.238914743f, 0.0465707816f},
-std::array<float,2>{0.872897804f, 0.973338425f},
-std::array<float,2>{0.157818571f, 0.646851838f},
-std::array<float,2>{0.758113742f, 0.267207116f},
-std::array<float,2>{0.424309105f, 0.23561804f},
-std::array<float,2>{0.710893273f, 0.842576861f},
-std::array<float,2>{0.328391463f, 0.907075107f},
-std::array<float,2>{0.517707527f, 0.105684765f},
-std::array<float,2>{0.0137297586f, 0.395766914f},
-std::array<float,2>{0.976322472f, 0.570646942f},
-std::array<float,2>{0.0285894368f, 0.878858685f},
-std::array<float,2>{0.985797286f, 0.0691696107f},
-std::array<float,2>{0.316081375f, 0.43412447f},
-std::array<float,2>{0.512880445f, 0.622175813f},
-std::array<float,2>{0.412869811f, 0.660503626f},
-std::array<float,2>{0.698707938f, 0.297711015f},
-std::array<float,2>{0.178288132f, 0.211330667f},
-std::array<float,2>{0.77000916f, 0.854284644f},
-std::array<float,2>{0.223162472f, 0.521944046f},
-std::array<float,2>{0.844477654f, 0.443278223f},
-std::array<float,2>{0.457850307f, 0.00486955559f},
-std::array<float,2>{0.645261228f, 0.945721745f},
-std::array<float,2>{0.277816057f, 0.8084535f},
-std::array<float,2>{0.612802327f, 0.182008848f},
-std::array<float,2>{0.0878547356f, 0.372368157f},
-std::array<float,2>{0.909383476f, 0.717345238f},
-std::array<float,2>{0.131974533f, 0.822241783f},
-std::array<float,2>{0.782492399f, 0.227616981f},
-std::array<float,2>{0.386849821f, 0.25043276f},
-std::array<float,2>{0.739794493f, 0.633683085f},
-std::array<float,2>{0.353884518f, 0.590425968f},
-std::array<float,2>{0.551307082f, 0.378763437f},
-std::array<float,2>{0.0517826229f, 0.115218416f},
-std::array<float,2>{0.943722248f, 0.923386693f},
-std::array<float,2>{0.12071383f, 0.739947677f},
-std::array<float,2>{0.895940423f, 0.319264889f},
-std::array<float,2>{0.309023023f, 0.13579306f},
-std::array<float,2>{0.582734764f, 0.755895257f},
-std::array<float,2>{0.499622494f, 0.985984564f},
-std::array<float,2>{0.664993048f, 0.0590053014f},
-std::array<float,2>{0.216510549f, 0.489467621f},
-std::array<float,2>{0.814243376f, 0.555689812f},
-std::array<float,2>{0.22033307f, 0.917708039f},
-std::array<float,2>{0.850500703f, 0.0983940288f},
-std::array<float,2>{0.455897748f, 0.400419056f},
-std::array<float,2>{0.642127633f, 0.56516695f},
-std::array<float,2>{0.274386644f, 0.653828979f},
-std::array<float,2>{0.616735578f, 0.278870255f},
-std::array<float,2>{0.0900723189f, 0.244588166f},
-std::array<float,2>{0.913048089f, 0.829372048f},
-std::array<float,2>{0.0244761091f, 0.543498278f},
-std::array<float,2>{0.990364373f, 0.482146353f},
-std::array<float,2>{0.316471815f, 0.0387502201f},
-std::array<float,2>{0.509823442f, 0.980216086f},
-std::array<float,2>{0.410046428f, 0.76841259f},
-std::array<float,2>{0.702688038f, 0.14210172f},
-std::array<float,2>{0.174217612f, 0.334825218f},
-std::array<float,2>{0.767391562f, 0.731054723f},
-std::array<float,2>{0.124481671f, 0.862341642f},
-std::array<float,2>{0.891327441f, 0.19200632f},
-std::array<float,2>{0.30619204f, 0.292569548f},
-std::array<float,2>{0.578552485f, 0.680632949f},
-std::array<float,2>{0.495176077f, 0.594521403f},
-std::array<float,2>{0.671238661f, 0.412960738f},
-std::array<float,2>{0.21482338f, 0.0830615461f},
-std::array<float,2>{0.819087505f, 0.893034101f},
-std::array<float,2>{0.127423793f, 0.701688528f},
-std::array<float,2>{0.786922216f, 0.359181166f},
-std::array<float,2>{0.384501904f, 0.169067368f},
-std::array<float,2>{0.735266566f, 0.795247793f},
-std::array<float,2>{0.35617882f, 0.967552722f},
-std::array<float,2>{0.550689936f, 0.021810459f},
-std::array<float,2>{0.0507278033f, 0.467991501f},
-std::array<float,2>{0.939415991f, 0.504714727f},
-std::array<float,2>{0.032121025f, 0.996958435f},
-std::array<float,2>{0.967175066f, 0.0507781692f},
-std::array<float,2>{0.36492151f, 0.496542752f},
-std::array<float,2>{0.544382572f, 0.5506199f},
-std::array<float,2>{0.40374887f, 0.74785763f},
-std::array<float,2>{0.731069207f, 0.326741487f},
-std::array<float,2>{0.148086235f, 0.126327693f},
-std::array<float,2>{0.808073282f, 0.758898318f},
-std::array<float,2>{0.196629137f, 0.580064416f},
-std::array<float,2>{0.834942758f, 0.386398971f},
-std::array<float,2>{0.483245075f, 0.120397337f},
-std::array<float,2>{0.686094582f, 0.931707323f},
-std::array<float,2>{0.291742921f, 0.813071132f},
-std::array<float,2>{0.573947251f, 0.22584632f},
-std::array<float,2>{0.102533869f, 0.259887129f},
-std::array<float,2>{0.886020243f, 0.632192075f},
-std::array<float,2>{0.162051514f, 0.801902533f},
-std::array<float,2>{0.762061954f, 0.174000978f},
-std::array<float,2>{0.427109659f, 0.361477047f},
-std::array<float,2>{0.706873417f, 0.703354359f},
-std::array<float,2>{0.33520174f, 0.53081131f},
-std::array<float,2>{0.522155583f, 0.447178662f},
-std::array<float,2>{0.00981522538f, 0.0104239639f},
-std::array<float,2>{0.971955299f, 0.94140029f},
-std::array<float,2>{0.0696552917f, 0.664462626f},
-std::array<float,2>{0.932524383f, 0.306486607f},
-std::array<float,2>{0.257220417f, 0.207586363f},
-std::array<float,2>{0.605829418f, 0.846509814f},
-std::array<float,2>{0.443547934f, 0.884597778f},
-std::array<float,2>{0.625033259f, 0.074360013f},
-std::array<float,2>{0.235149875f, 0.424688786f},
-std::array<float,2>{0.869161129f, 0.61348176f},
-std::array<float,2>{0.150500476f, 0.952767313f},
-std::array<float,2>{0.799801052f, 0.00135574583f},
-std::array<float,2>{0.393834472f, 0.440457582f},
-std::array<float,2>{0.723713577f, 0.51934278f},
-std::array<float,2>{0.3690947f, 0.713351429f},
-std::array<float,2>{0.535051167f, 0.369927824f},
-std::array<float,2>{0.0395220742f, 0.18687804f},
-std::array<float,2>{0.957658052f, 0.810753942f},
-std::array<float,2>{0.099358879f, 0.61781776f},
-std::array<float,2>{0.880413949f, 0.432712138f},
-std::array<float,2>{0.285352468f, 0.0663467124f},
-std::array<float,2>{0.563996196f, 0.87904954f},
-std::array<float,2>{0.473377436f, 0.859175563f},
-std::array<float,2>{0.67360574f, 0.218459442f},
-std::array<float,2>{0.188504517f, 0.302256852f},
-std::array<float,2>{0.83681345f, 0.659306884f},
-std::array<float,2>{0.00543147279f, 0.753751755f},
-std::array<float,2>{0.98279494f, 0.139733836f},
-std::array<float,2>{0.339870036f, 0.315559804f},
-std::array<float,2>{0.527251661f, 0.737899303f},
-std::array<float,2>{0.436736465f, 0.558962345f},
-std::array<float,2>{0.717362463f, 0.486962378f},
-std::array<float,2>{0.169652626f, 0.0580708385f},
-std::array<float,2>{0.753444552f, 0.989543796f},
-std::array<float,2>{0.246383548f, 0.637722433f},
-std::array<float,2>{0.86012882f, 0.256606281f},
-std::array<float,2>{0.450500071f, 0.231373355f},
-std::array<float,2>{0.636309206f, 0.824644685f},
-std::array<float,2>{0.259943068f, 0.929073155f},
-std::array<float,2>{0.600169122f, 0.112691782f},
-std::array<float,2>{0.073382616f, 0.380934983f},
-std::array<float,2>{0.923789859f, 0.587822199f},
-std::array<float,2>{0.0830139369f, 0.900093615f},
-std::array<float,2>{0.921154261f, 0.0902112201f},
-std::array<float,2>{0.26899606f, 0.419299006f},
-std::array<float,2>{0.624909341f, 0.602452755f},
-std::array<float,2>{0.465161085f, 0.677568734f},
-std::array<float,2>{0.654731214f, 0.287542045f},
-std::array<float,2>{0.231119975f, 0.19839251f},
-std::array<float,2>{0.85749501f, 0.867427945f},
-std::array<float,2>{0.182425901f, 0.508167922f},
-std::array<float,2>{0.775949597f, 0.459330529f},
-std::array<float,2>{0.417458117f, 0.0257007163f},
-std::array<float,2>{0.690817833f, 0.955178976f},
-std::array<float,2>{0.326803654f, 0.782090247f},
-std::array<float,2>{0.500901282f, 0.15686737f},
-std::array<float,2>{0.0170412473f, 0.345107883f},
-std::array<float,2>{0.997948587f, 0.689651549f},
-std::array<float,2>{0.204915181f, 0.836068869f},
-std::array<float,2>{0.822814584f, 0.241639569f},
-std::array<float,2>{0.484515429f, 0.271246403f},
-std::array<float,2>{0.663468301f, 0.643894374f},
-std::array<float,2>{0.299308866f, 0.575857639f},
-std::array<float,2>{0.5883196f, 0.392861724f},
-std::array<float,2>{0.114334986f, 0.103616931f},
-std::array<float,2>{0.904280841f, 0.910437107f},
-std::array<float,2>{0.0552771315f, 0.722312927f},
-std::array<float,2>{0.948520064f, 0.338731021f},
-std::array<float,2>{0.349442661f, 0.149694979f},
-std::array<float,2>{0.559249938f, 0.781191766f},
-std::array<float,2>{0.380652934f, 0.969805717f},
-std::array<float,2>{0.749745488f, 0.0401775427f},
-std::array<float,2>{0.136712834f, 0.473599434f},
-std::array<float,2>{0.790484607f, 0.538252294f},
-std::array<float,2>{0.178027406f, 0.876943767f},
-std::array<float,2>{0.770089865f, 0.0664664581f},
-std::array<float,2>{0.412568778f, 0.436114103f},
-std::array<float,2>{0.699139297f, 0.624221563f},
-std::array<float,2>{0.315569699f, 0.663756251f},
-std::array<float,2>{0.513357162f, 0.298984557f},
-std::array<float,2>{0.0291633178f, 0.213049278f},
-std::array<float,2>{0.986119688f, 0.853002965f},
-std::array<float,2>{0.0871720687f, 0.521202624f},
-std::array<float,2>{0.909859836f, 0.444951981f},
-std::array<float,2>{0.278219312f, 0.00759093324f},
-std::array<float,2>{0.612693608f, 0.94808048f},
-std::array<float,2>{0.457081497f, 0.806570232f},
-std::array<float,2>{0.644937992f, 0.181007713f},
-std::array<float,2>{0.222884148f, 0.374616176f},
-std::array<float,2>{0.843805373f, 0.715030253f},
-std::array<float,2>{0.0522677861f, 0.824195027f},
-std::array<float,2>{0.94391346f, 0.229453802f},
-std::array<float,2>{0.354175419f, 0.253207266f},
-std::array<float,2>{0.551159859f, 0.635074735f},
-std::array<float,2>{0.387498528f, 0.593595028f},
-std::array<float,2>{0.739573538f, 0.375712782f},
-std::array<float,2>{0.132347837f, 0.116364978f},
-std::array<float,2>{0.78297472f, 0.925512969f},
-std::array<float,2>{0.215993121f, 0.741131425f},
-std::array<float,2>{0.813803077f, 0.316944808f},
-std::array<float,2>{0.499401212f, 0.1344015f},
-std::array<float,2>{0.664496064f, 0.754772961f},
-std::array<float,2>{0.309346616f, 0.987439513f},
-std::array<float,2>{0.582120061f, 0.0611906573f},
-std::array<float,2>{0.12022648f, 0.490369409f},
-std::array<float,2>{0.896321297f, 0.557419419f},
-std::array<float,2>{0.106923461f, 0.960660756f},
-std::array<float,2>{0.890491009f, 0.029438531f},
-std::array<float,2>{0.293009311f, 0.455954164f},
-std::array<float,2>{0.575506389f, 0.512836993f},
-std::array<float,2>{0.478740066f, 0.694141507f},
-std::array<float,2>{0.680782139f, 0.349410206f},
-std::array<float,2>{0.200600848f, 0.163549751f},
-std::array<float,2>{0.828907371f, 0.785419643f},
-std::array<float,2>{0.143636495f, 0.608380437f},
-std::array<float,2>{0.811984599f, 0.417644501f},
-std::array<float,2>{0.399924487f, 0.0862366781f},
-std::array<float,2>{0.728829026f, 0.902726173f},
-std::array<float,2>{0.359728336f, 0.872979462f},
-std::array<float,2>{0.542351782f, 0.200587064f},
-std::array<float,2>{0.0378628075f, 0.283809304f},
-std::array<float,2>{0.962303817f, 0.672062755f},
-std::array<float,2>{0.238613352f, 0.777013719f},
-std::array<float,2>{0.87241298f, 0.15598613f},
-std::array<float,2>{0.440120757f, 0.342786521f},
-std::array<float,2>{0.632512152f, 0.72361058f},
-std::array<float,2>{0.250695795f, 0.533490598f},
-std::array<float,2>{0.605423391f, 0.470466942f},
-std::array<float,2>{0.0651559159f, 0.043463137f},
-std::array<float,2>{0.936802208f, 0.975724876f},
-std::array<float,2>{0.0145408334f, 0.644887805f},
-std::array<float,2>{0.975648999f, 0.26814872f},
-std::array<float,2>{0.328759462f, 0.238071069f},
-std::array<float,2>{0.518283725f, 0.839939833f},
-std::array<float,2>{0.424558789f, 0.909404814f},
-std::array<float,2>{0.710088074f, 0.108794928f},
-std::array<float,2>{0.157239154f, 0.398267716f},
-std::array<float,2>{0.758507609f, 0.573271811f},
-std::array<float,2>{0.194257393f, 0.981624484f},
-std::array<float,2>{0.84100461f, 0.0316458084f},
-std::array<float,2>{0.47012499f, 0.478343517f},
-std::array<float,2>{0.677117944f, 0.542937636f},
-std::array<float,2>{0.281922162f, 0.728907287f},
-std::array<float,2>{0.569351733f, 0.330681175f},
-std::array<float,2>{0.0960759372f, 0.1453235f},
-std::array<float,2>{0.875563145f, 0.770471334f},
-std::array<float,2>{0.0430374108f, 0.569040895f},
-std::array<float,2>{0.955142975f, 0.402883798f},
-std::array<float,2>{0.374785125f, 0.0952644795f},
-std::array<float,2>{0.537351012f, 0.920804501f},
-std::array<float,2>{0.396396101f, 0.832161367f},
-std::array<float,2>{0.720612347f, 0.248134926f},
-std::array<float,2>{0.153401658f, 0.273629904f},
-std::array<float,2>{0.801705062f, 0.648943782f},
-std::array<float,2>{0.0771837384f, 0.789534211f},
-std::array<float,2>{0.926924884f, 0.164882839f},
-std::array<float,2>{0.263733178f, 0.355452746f},
-std::array<float,2>{0.594835758f, 0.696138442f},
-std::array<float,2>{0.446792543f, 0.500137329f},
-std::array<float,2>{0.639969587f, 0.464744747f},
-std::array<float,2>{0.243834451f, 0.0187736452f},
-std::array<float,2>{0.863694251f, 0.961884379f},
-std::array<float,2>{0.165525764f, 0.684926629f},
-std::array<float,2>{0.755575716f, 0.294561088f},
-std::array<float,2>{0.431149483f, 0.189662635f},
-std::array<float,2>{0.714171827f, 0.863858879f},
-std::array<float,2>{0.339243501f, 0.895834446f},
-std::array<float,2>{0.528640568f, 0.0782882273f},
-std::array<float,2>{0.00197199918f, 0.409752071f},
-std::array<float,2>{0.980309367f, 0.600394011f},
-std::array<float,2>{0.0231221858f, 0.936969459f},
-std::array<float,2>{0.9929685f, 0.123276763f},
-std::array<float,2>{0.320618361f, 0.387159705f},
-std::array<float,2>{0.505675733f, 0.582409978f},
-std::array<float,2>{0.418286651f, 0.627783954f},
-std::array<float,2>{0.695113063f, 0.262375981f},
-std::array<float,2>{0.183940709f, 0.220881477f},
-std::array<float,2>{0.777784944f, 0.819277167f},
-std::array<float,2>{0.227393419f, 0.553073287f},
-std::array<float,2>{0.85437721f, 0.49290821f},
-std::array<float,2>{0.462276936f, 0.0519642606f},
-std::array<float,2>{0.651008606f, 0.994587779f},
-std::array<float,2>{0.271780938f, 0.76312083f},
-std::array<float,2>{0.619504392f, 0.132366702f},
-std::array<float,2>{0.0786592439f, 0.322016448f},
-std::array<float,2>{0.914105356f, 0.744245946f},
-std::array<float,2>{0.136731043f, 0.850970805f},
-std::array<float,2>{0.794627666f, 0.204221413f},
-std::array<float,2>{0.377447516f, 0.310017645f},
-std::array<float,2>{0.744590044f, 0.670026839f},
-std::array<float,2>{0.346722215f, 0.613166928f},
-std::array<float,2>{0.556870043f, 0.428715914f},
-std::array<float,2>{0.0621049181f, 0.0734364539f},
-std::array<float,2>{0.95164144f, 0.887479305f},
-std::array<float,2>{0.110635877f, 0.709523201f},
-std::array<float,2>{0.900392294f, 0.366821915f},
-std::array<float,2>{0.300950736f, 0.17913565f},
-std::array<float,2>{0.590528846f, 0.800494969f},
-std::array<float,2>{0.488568783f, 0.941493332f},
-std::array<float,2>{0.658728302f, 0.0117275855f},
-std::array<float,2>{0.208540291f, 0.452637583f},
-std::array<float,2>{0.82516402f, 0.525081098f},
-std::array<float,2>{0.211308733f, 0.892329514f},
-std::array<float,2>{0.817179143f, 0.0856379792f},
-std::array<float,2>{0.492404312f, 0.410930485f},
-std::array<float,2>{0.668795288f, 0.597487867f},
-std::array<float,2>{0.308394223f, 0.682933211f},
-std::array<float,2>{0.581263125f, 0.289107412f},
-std::array<float,2>{0.122346647f, 0.19393155f},
-std::array<float,2>{0.894268095f, 0.860250831f},
-std::array<float,2>{0.0470165163f, 0.506918907f},
-std::array<float,2>{0.939833641f, 0.466261536f},
-std::array<float,2>{0.358845353f, 0.020441886f},
-std::array<float,2>{0.54828006f, 0.966375947f},
-std::array<float,2>{0.386163324f, 0.793583214f},
-std::array<float,2>{0.738090813f, 0.170422405f},
-std::array<float,2>{0.125201941f, 0.356554538f},
-std::array<float,2>{0.788920462f, 0.699935615f},
-std::array<float,2>{0.0936539099f, 0.831981421f},
-std::array<float,2>{0.910835564f, 0.243268326f},
-std::array<float,2>{0.277210772f, 0.280207038f},
-std::array<float,2>{0.615045488f, 0.655153036f},
-std::array<float,2>{0.453158855f, 0.564151764f},
-std::array<float,2>{0.643283248f, 0.398941785f},
-std::array<float,2>{0.222618729f, 0.10147471f},
-std::array<float,2>{0.847792029f, 0.914402127f},
-std::array<float,2>{0.173496291f, 0.732541323f},
-std::array<float,2>{0.769061983f, 0.333500236f},
-std::array<float,2>{0.408049405f, 0.142964363f},
-std::array<float,2>{0.700902045f, 0.767422259f},
-std::array<float,2>{0.319239765f, 0.978031099f},
-std::array<float,2>{0.509594262f, 0.0362457037f},
-std::array<float,2>{0.0255263261f, 0.483538479f},
-std::array<float,2>{0.990105808f, 0.546508253f},
-std::array<float,2>{0.00791162439f, 0.937900305f},
-std::array<float,2>{0.969299555f, 0.00867284182f},
-std::array<float,2>{0.332523614f, 0.449118912f},
-std::array<float,2>{0.52044934f, 0.527716935f},
-std::array<float,2>{0.428212047f, 0.70636791f},
-std::array<float,2>{0.70492655f, 0.360458523f},
-std::array<float,2>{0.162563473f, 0.173239082f},
-std::array<float,2>{0.764571965f, 0.803930879f},
-std::array<float,2>{0.237702101f, 0.617031217f},
-std::array<float,2>{0.868330002f, 0.422465682f},
-std::array<float,2>{0.443022996f, 0.0777033865f},
-std::array<float,2>{0.628839433f, 0.885228574f},
-std::array<float,2>{0.254786372f, 0.844690621f},
-std::array<float,2>{0.60767591f, 0.20979622f},
-std::array<float,2>{0.0675104931f, 0.308270365f},
-std::array<float,2>{0.930059016f, 0.666588247f},
-std::array<float,2>{0.145707071f, 0.761136413f},
-std::array<float,2>{0.806445539f, 0.127115056f},
-std::array<float,2>{0.405315965f, 0.325339913f},
-std::array<float,2>{0.73380965f, 0.749011695f},
-std::array<float,2>{0.36595884f, 0.548197627f},
-std::array<float,2>{0.546596587f, 0.49826616f},
-std::array<float,2>{0.033310663f, 0.0481294133f},
-std::array<float,2>{0.966153681f, 0.99980098f},
-std::array<float,2>{0.105267555f, 0.628979206f},
-std::array<float,2>{0.884323418f, 0.258374572f},
-std::array<float,2>{0.289594114f, 0.223321393f},
-std::array<float,2>{0.571448147f, 0.815650463f},
-std::array<float,2>{0.480925858f, 0.929861426f},
-std::array<float,2>{0.683968246f, 0.118061408f},
-std::array<float,2>{0.198691338f, 0.382864922f},
-std::array<float,2>{0.833423376f, 0.580683291f},
-std::array<float,2>{0.171138525f, 0.990335286f},
-std::array<float,2>{0.75112623f, 0.0550037362f},
-std::array<float,2>{0.43425265f, 0.485002607f},
-std::array<float,2>{0.715979159f, 0.560855865f},
-std::array<float,2>{0.34192279f, 0.735284209f},
-std::array<float,2>{0.523489654f, 0.314169198f},
-std::array<float,2>{0.00604776479f, 0.137343168f},
-std::array<float,2>{0.981850803f, 0.750626266f},
-std::array<float,2>{0.0709987581f, 0.589648187f},
-std::array<float,2>{0.923887432f, 0.378972977f},
-std::array<float,2>{0.258603036f, 0.110591017f},
-std::array<float,2>{0.599492192f, 0.925896525f},
-std::array<float,2>{0.451743305f, 0.828090429f},
-std::array<float,2>{0.634483397f, 0.233897388f},
-std::array<float,2>{0.24916923f, 0.255450994f},
-std::array<float,2>{0.86177367f, 0.63967222f},
-std::array<float,2>{0.0415716954f, 0.809760571f},
-std::array<float,2>{0.959906459f, 0.18492049f},
-std::array<float,2>{0.370778054f, 0.367313117f},
-std::array<float,2>{0.533034027f, 0.711269796f},
-std::array<float,2>{0.391450405f, 0.516983628f},
-std::array<float,2>{0.726299047f, 0.437946886f},
-std::array<float,2>{0.149935782f, 0.00373642636f},
-std::array<float,2>{0.797993064f, 0.950596988f},
-std::array<float,2>{0.190752611f, 0.656829536f},
-std::array<float,2>{0.839616716f, 0.303563356f},
-std::array<float,2>{0.475862622f, 0.214926884f},
-std::array<float,2>{0.675073087f, 0.856213987f},
-std::array<float,2>{0.287202507f, 0.882128656f},
-std::array<float,2>{0.566349208f, 0.062892653f},
-std::array<float,2>{0.101542667f, 0.430341184f},
-std::array<float,2>{0.88098377f, 0.620087028f},
-std::array<float,2>{0.11634358f, 0.912790477f},
-std::array<float,2>{0.905050099f, 0.102476411f},
-std::array<float,2>{0.296955585f, 0.391020119f},
-std::array<float,2>{0.587801635f, 0.577769697f},
-std::array<float,2>{0.487379909f, 0.642158628f},
-std::array<float,2>{0.662012339f, 0.271681458f},
-std::array<float,2>{0.205818504f, 0.2384101f},
-std::array<float,2>{0.821860969f, 0.839398146f},
-std::array<float,2>{0.134621352f, 0.537011206f},
-std::array<float,2>{0.792627573f, 0.476200342f},
-std::array<float,2>{0.382276237f, 0.0419523083f},
-std::array<float,2>{0.746284485f, 0.972458303f},
-std::array<float,2>{0.351418823f, 0.778774738f},
-std::array<float,2>{0.562185526f, 0.150865689f},
-std::array<float,2>{0.0577081852f, 0.337662011f},
-std::array<float,2>{0.947228909f, 0.719900131f},
-std::array<float,2>{0.232796878f, 0.871045589f},
-std::array<float,2>{0.857285798f, 0.19581756f},
-std::array<float,2>{0.468292624f, 0.286740065f},
-std::array<float,2>{0.65276444f, 0.678762257f},
-std::array<float,2>{0.266790152f, 0.604316533f},
-std::array<float,2>{0.621978641f, 0.42017746f},
-std::array<float,2>{0.0845294297f, 0.0929946452f},
-std::array<float,2>{0.918868721f, 0.901107073f},
-std::array<float,2>{0.0186620317f, 0.689135611f},
-std::array<float,2>{0.998935401f, 0.346033096f},
-std::array<float,2>{0.324529797f, 0.159681305f},
-std::array<float,2>{0.503845811f, 0.784346461f},
-std::array<float,2>{0.415655613f, 0.954273105f},
-std::array<float,2>{0.687925041f, 0.0242322553f},
-std::array<float,2>{0.181313068f, 0.457893461f},
-std::array<float,2>{0.773506522f, 0.511371732f},
-std::array<float,2>{0.130350694f, 0.922882795f},
-std::array<float,2>{0.784976304f, 0.114475362f},
-std::array<float,2>{0.390178531f, 0.378409654f},
-std::array<float,2>{0.741557658f, 0.589854538f},
-std::array<float,2>{0.353165418f, 0.632871449f},
-std::array<float,2>{0.553556025f, 0.250942767f},
-std::array<float,2>{0.0544267558f, 0.228277624f},
-std::array<float,2>{0.94328326f, 0.821434081f},
-std::array<float,2>{0.11852514f, 0.556479156f},
-std::array<float,2>{0.897909403f, 0.489869475f},
-std::array<float,2>{0.311542571f, 0.0591488965f},
-std::array<float,2>{0.584639072f, 0.985790193f},
-std::array<float,2>{0.496998817f, 0.756664157f},
-std::array<float,2>{0.667818069f, 0.136459574f},
-std::array<float,2>{0.218549699f, 0.318451136f},
-std::array<float,2>{0.815140903f, 0.739529133f},
-std::array<float,2>{0.0297142938f, 0.853960216f},
-std::array<float,2>{0.987070084f, 0.211458504f},
-std::array<float,2>{0.313632876f, 0.297317326f},
-std::array<float,2>{0.51497066f, 0.66110599f},
-std::array<float,2>{0.410367638f, 0.622912526f},
-std::array<float,2>{0.696288347f, 0.433639884f},
-std::array<float,2>{0.17758666f, 0.0685658902f},
-std::array<float,2>{0.771833956f, 0.87827915f},
-std::array<float,2>{0.225513503f, 0.716811597f},
-std::array<float,2>{0.846017003f, 0.372612029f},
-std::array<float,2>{0.459599823f, 0.182208493f},
-std::array<float,2>{0.647695005f, 0.807864308f},
-std::array<float,2>{0.279876232f, 0.946079493f},
-std::array<float,2>{0.610527873f, 0.00427304767f},
-std::array<float,2>{0.0889263302f, 0.442657232f},
-std::array<float,2>{0.906683445f, 0.52229768f},
-std::array<float,2>{0.0636902452f, 0.97293818f},
-std::array<float,2>{0.934952974f, 0.0461617894f},
-std::array<float,2>{0.252894223f, 0.471797705f},
-std::array<float,2>{0.601800084f, 0.531643212f},
-std::array<float,2>{0.437517345f, 0.726109684f},
-std::array<float,2>{0.629422009f, 0.340978086f},
-std::array<float,2>{0.24107407f, 0.153057128f},
-std::array<float,2>{0.874480247f, 0.774936795f},
-std::array<float,2>{0.158417434f, 0.571188092f},
-std::array<float,2>{0.760400593f, 0.396087766f},
-std::array<float,2>{0.421945125f, 0.106436484f},
-std::array<float,2>{0.707377613f, 0.906343877f},
-std::array<float,2>{0.331032902f, 0.841918588f},
-std::array<float,2>{0.516906798f, 0.236096665f},
-std::array<float,2>{0.0121687893f, 0.266921669f},
-std::array<float,2>{0.973053396f, 0.647171199f},
-std::array<float,2>{0.202767402f, 0.787506759f},
-std::array<float,2>{0.831935763f, 0.162044317f},
-std::array<float,2>{0.478377551f, 0.35156092f},
-std::array<float,2>{0.681720018f, 0.691552877f},
-std::array<float,2>{0.296395034f, 0.514662147f},
-std::array<float,2>{0.576193094f, 0.454482913f},
-std::array<float,2>{0.109094292f, 0.0284003839f},
-std::array<float,2>{0.887171328f, 0.958180189f},
-std::array<float,2>{0.0351713412f, 0.67422533f},
-std::array<float,2>{0.963930666f, 0.281769276f},
-std::array<float,2>{0.361896098f, 0.201423123f},
-std::array<float,2>{0.53973043f, 0.873373747f},
-std::array<float,2>{0.401161164f, 0.905134737f},
-std::array<float,2>{0.727729499f, 0.0887200981f},
-std::array<float,2>{0.141616747f, 0.415261f},
-std::array<float,2>{0.809746444f, 0.60682404f},
-std::array<float,2>{0.244818971f, 0.963761091f},
-std::array<float,2>{0.865900099f, 0.0161429048f},
-std::array<float,2>{0.449164659f, 0.4615587f},
-std::array<float,2>{0.638579965f, 0.503168941f},
-std::array<float,2>{0.262653589f, 0.697678089f},
-std::array<float,2>{0.596923828f, 0.352487892f},
-std::array<float,2>{0.0747988522f, 0.167634219f},
-std::array<float,2>{0.928634703f, 0.791499972f},
-std::array<float,2>{0.00083330489f, 0.599310637f},
-std::array<float,2>{0.978508651f, 0.407975078f},
-std::array<float,2>{0.337668329f, 0.0814531147f},
-std::array<float,2>{0.52965486f, 0.897092342f},
-std::array<float,2>{0.431844026f, 0.866494298f},
-std::array<float,2>{0.712418377f, 0.188920274f},
-std::array<float,2>{0.16604954f, 0.295763135f},
-std::array<float,2>{0.756709039f, 0.68588531f},
-std::array<float,2>{0.0950454101f, 0.771495521f},
-std::array<float,2>{0.877334595f, 0.147115469f},
-std::array<float,2>{0.283346087f, 0.329194129f},
-std::array<float,2>{0.567660868f, 0.728291452f},
-std::array<float,2>{0.472025931f, 0.540108502f},
-std::array<float,2>{0.677785993f, 0.479962051f},
-std::array<float,2>{0.192598343f, 0.0337550491f},
-std::array<float,2>{0.843124449f, 0.983587325f},
-std::array<float,2>{0.156075105f, 0.650629818f},
-std::array<float,2>{0.803639591f, 0.27636236f},
-std::array<float,2>{0.396796346f, 0.247086778f},
-std::array<float,2>{0.72163558f, 0.835002542f},
-std::array<float,2>{0.371342301f, 0.919029176f},
-std::array<float,2>{0.535713851f, 0.0966574103f},
-std::array<float,2>{0.0458770692f, 0.404968143f},
-std::array<float,2>{0.954249084f, 0.567784488f},
-std::array<float,2>{0.058862146f, 0.890402317f},
-std::array<float,2>{0.950214088f, 0.0711877868f},
-std::array<float,2>{0.345001101f, 0.426575541f},
-std::array<float,2>{0.555583835f, 0.610442281f},
-std::array<float,2>{0.375162333f, 0.669033051f},
-std::array<float,2>{0.743612945f, 0.311505079f},
-std::array<float,2>{0.140116215f, 0.206608608f},
-std::array<float,2>{0.795858383f, 0.848138869f},
-std::array<float,2>{0.209307149f, 0.526272535f},
-std::array<float,2>{0.827890456f, 0.45021382f},
-std::array<float,2>{0.491758198f, 0.0155024091f},
-std::array<float,2>{0.656676233f, 0.944060862f},
-std::array<float,2>{0.304149836f, 0.797135413f},
-std::array<float,2>{0.591890633f, 0.175956875f},
-std::array<float,2>{0.111782216f, 0.364162803f},
-std::array<float,2>{0.900059104f, 0.70817101f},
-std::array<float,2>{0.187170833f, 0.818271518f},
-std::array<float,2>{0.780439615f, 0.219512045f},
-std::array<float,2>{0.421574563f, 0.26408422f},
-std::array<float,2>{0.692291856f, 0.625304639f},
-std::array<float,2>{0.322895467f, 0.584974766f},
-std::array<float,2>{0.506820023f, 0.390092522f},
-std::array<float,2>{0.0206237286f, 0.121577859f},
-std::array<float,2>{0.99491173f, 0.933908582f},
-std::array<float,2>{0.0816493034f, 0.743359983f},
-std::array<float,2>{0.917238414f, 0.323622376f},
-std::array<float,2>{0.27032879f, 0.129322141f},
-std::array<float,2>{0.617891848f, 0.764257908f},
-std::array<float,2>{0.463551641f, 0.993462384f},
-std::array<float,2>{0.649128795f, 0.0538056009f},
-std::array<float,2>{0.228948504f, 0.495751023f},
-std::array<float,2>{0.852282166f, 0.552338421f},
-std::array<float,2>{0.197400168f, 0.93334651f},
-std::array<float,2>{0.83212924f, 0.119708866f},
-std::array<float,2>{0.481516302f, 0.385229796f},
-std::array<float,2>{0.684932351f, 0.57818681f},
-std::array<float,2>{0.290819854f, 0.631428719f},
-std::array<float,2>{0.570762455f, 0.261669695f},
-std::array<float,2>{0.103570059f, 0.224976167f},
-std::array<float,2>{0.883156598f, 0.814172924f},
-std::array<float,2>{0.0348153338f, 0.549583197f},
-std::array<float,2>{0.965368629f, 0.497902244f},
-std::array<float,2>{0.366446137f, 0.0488397367f},
-std::array<float,2>{0.545110047f, 0.997615635f},
-std::array<float,2>{0.404848695f, 0.758018494f},
-std::array<float,2>{0.732590199f, 0.125514999f},
-std::array<float,2>{0.145287856f, 0.327981055f},
-std::array<float,2>{0.805066645f, 0.747044504f},
-std::array<float,2>{0.0668383762f, 0.847254515f},
-std::array<float,2>{0.931131482f, 0.208593607f},
-std::array<float,2>{0.254897356f, 0.305217594f},
-std::array<float,2>{0.609122872f, 0.665585995f},
-std::array<float,2>{0.441616923f, 0.614327252f},
-std::array<float,2>{0.62777859f, 0.425600767f},
-std::array<float,2>{0.23712936f, 0.0753012374f},
-std::array<float,2>{0.86742264f, 0.883336425f},
-std::array<float,2>{0.163667858f, 0.704269767f},
-std::array<float,2>{0.76476562f, 0.362798393f},
-std::array<float,2>{0.42923069f, 0.17543371f},
-std::array<float,2>{0.703952193f, 0.800910771f},
-std::array<float,2>{0.333823413f, 0.940292418f},
-std::array<float,2>{0.520773709f, 0.0116440495f},
-std::array<float,2>{0.00946114212f, 0.445614845f},
-std::array<float,2>{0.970165491f, 0.530261934f},
-std::array<float,2>{0.0270022359f, 0.979330599f},
-std::array<float,2>{0.988430977f, 0.0371502414f},
-std::array<float,2>{0.320297062f, 0.480707079f},
-std::array<float,2>{0.508432806f, 0.543953717f},
-std::array<float,2>{0.406744033f, 0.731767356f},
-std::array<float,2>{0.699510694f, 0.335674971f},
-std::array<float,2>{0.172564268f, 0.140899763f},
-std::array<float,2>{0.768162906f, 0.768972635f},
-std::array<float,2>{0.221269995f, 0.565964222f},
-std::array<float,2>{0.848998547f, 0.402256548f},
-std::array<float,2>{0.454204261f, 0.0988657624f},
-std::array<float,2>{0.643954635f, 0.916899562f},
-std::array<float,2>{0.276320904f, 0.828433573f},
-std::array<float,2>{0.61425519f, 0.245411709f},
-std::array<float,2>{0.0921498984f, 0.278004616f},
-std::array<float,2>{0.911190689f, 0.653084993f},
-std::array<float,2>{0.126694709f, 0.796370447f},
-std::array<float,2>{0.787805498f, 0.168210149f},
-std::array<float,2>{0.38498655f, 0.357775509f},
-std::array<float,2>{0.736628592f, 0.702607632f},
-std::array<float,2>{0.358177453f, 0.505186856f},
-std::array<float,2>{0.547768772f, 0.46762529f},
-std::array<float,2>{0.0481061228f, 0.0232682824f},
-std::array<float,2>{0.941156507f, 0.96794337f},
-std::array<float,2>{0.121926665f, 0.680795312f},
-std::array<float,2>{0.893448412f, 0.291931123f},
-std::array<float,2>{0.307275593f, 0.192517132f},
-std::array<float,2>{0.580299675f, 0.862178266f},
-std::array<float,2>{0.494081825f, 0.893649161f},
-std::array<float,2>{0.669217467f, 0.0826304406f},
-std::array<float,2>{0.212866157f, 0.413117766f},
-std::array<float,2>{0.818157256f, 0.595254958f},
-std::array<float,2>{0.179827973f, 0.956231773f},
-std::array<float,2>{0.775036931f, 0.0266464278f},
-std::array<float,2>{0.415026158f, 0.460825086f},
-std::array<float,2>{0.688707113f, 0.508791745f},
-std::array<float,2>{0.325755119f, 0.691061258f},
-std::array<float,2>{0.50282532f, 0.344254524f},
-std::array<float,2>{0.0181253608f, 0.157513589f},
-std::array<float,2>{0.999731243f, 0.783049524f},
-std::array<float,2>{0.0856292769f, 0.603010237f},
-std::array<float,2>{0.919179678f, 0.418220878f},
-std::array<float,2>{0.266327977f, 0.0909417942f},
-std::array<float,2>{0.622696877f, 0.899149716f},
-std::array<float,2>{0.467557222f, 0.868886054f},
-std::array<float,2>{0.654012978f, 0.197927415f},
-std::array<float,2>{0.233519852f, 0.288469374f},
-std::array<float,2>{0.856108844f, 0.676466942f},
-std::array<float,2>{0.0570429713f, 0.779438734f},
-std::array<float,2>{0.945840299f, 0.148855358f},
-std::array<float,2>{0.350043148f, 0.339273065f},
-std::array<float,2>{0.561436415f, 0.721271455f},
-std::array<float,2>{0.380968541f, 0.537810087f},
-std::array<float,2>{0.747195423f, 0.47450617f},
-std::array<float,2>{0.133455172f, 0.0399185978f},
-std::array<float,2>{0.791832983f, 0.969715238f},
-std::array<float,2>{0.206440002f, 0.642803073f},
-std::array<float,2>{0.821276128f, 0.270421505f},
-std::array<float,2>{0.486609846f, 0.241133258f},
-std::array<float,2>{0.660974801f, 0.837118864f},
-std::array<float,2>{0.298149526f, 0.911453843f},
-std::array<float,2>{0.586156547f, 0.104920685f},
-std::array<float,2>{0.115715928f, 0.394155264f},
-std::array<float,2>{0.905967057f, 0.574571669f},
-std::array<float,2>{0.100285046f, 0.880191028f},
-std::array<float,2>{0.882128596f, 0.0649683252f},
-std::array<float,2>{0.288847446f, 0.432258993f},
-std::array<float,2>{0.564695776f, 0.618546844f},
-std::array<float,2>{0.475195944f, 0.65898037f},
-std::array<float,2>{0.674589455f, 0.301011533f},
-std::array<float,2>{0.189751029f, 0.216950819f},
-std::array<float,2>{0.83883667f, 0.858185351f},
-std::array<float,2>{0.149125949f, 0.518104196f},
-std::array<float,2>{0.797197342f, 0.440190077f},
-std::array<float,2>{0.391847908f, 0.000477120397f},
-std::array<float,2>{0.725259364f, 0.951799393f},
-std::array<float,2>{0.369793147f, 0.812433422f},
-std::array<float,2>{0.531817138f, 0.185934156f},
-std::array<float,2>{0.0423375033f, 0.370394349f},
-std::array<float,2>{0.960228026f, 0.71458745f},
-std::array<float,2>{0.248116612f, 0.825261235f},
-std::array<float,2>{0.86312604f, 0.231805727f},
-std::array<float,2>{0.453069419f, 0.257550389f},
-std::array<float,2>{0.632907391f, 0.637432754f},
-std::array<float,2>{0.259291977f, 0.586726189f},
-std::array<float,2>{0.598610818f, 0.382065952f},
-std::array<float,2>{0.0720338747f, 0.111865968f},
-std::array<float,2>{0.925495207f, 0.927893102f},
-std::array<float,2>{0.00734692113f, 0.73639816f},
-std::array<float,2>{0.980721295f, 0.315125853f},
-std::array<float,2>{0.343742847f, 0.139604747f},
-std::array<float,2>{0.525059998f, 0.752055764f},
-std::array<float,2>{0.434617668f, 0.98889029f},
-std::array<float,2>{0.715671837f, 0.0569023713f},
-std::array<float,2>{0.170692697f, 0.487681389f},
-std::array<float,2>{0.75063777f, 0.560261488f},
-std::array<float,2>{0.140977338f, 0.903359532f},
-std::array<float,2>{0.808917642f, 0.0875302181f},
-std::array<float,2>{0.40213275f, 0.416103244f},
-std::array<float,2>{0.727067888f, 0.608588457f},
-std::array<float,2>{0.36236003f, 0.67287159f},
-std::array<float,2>{0.5409711f, 0.284488499f},
-std::array<float,2>{0.036435809f, 0.199417695f},
-std::array<float,2>{0.963196456f, 0.87161386f},
-std::array<float,2>{0.107603341f, 0.512634456f},
-std::array<float,2>{0.888294876f, 0.456171632f},
-std::array<float,2>{0.295551598f, 0.0309484079f},
-std::array<float,2>{0.577702045f, 0.958989143f},
-std::array<float,2>{0.477015883f, 0.786774397f},
-std::array<float,2>{0.683547556f, 0.162258282f},
-std::array<float,2>{0.201520175f, 0.347791851f},
-std::array<float,2>{0.830649555f, 0.695113838f},
-std::array<float,2>{0.013005767f, 0.841064632f},
-std::array<float,2>{0.974434733f, 0.236613929f},
-std::array<float,2>{0.331468403f, 0.268696427f},
-std::array<float,2>{0.515689433f, 0.646435797f},
-std::array<float,2>{0.423276961f, 0.573195517f},
-std::array<float,2>{0.708783925f, 0.396513641f},
-std::array<float,2>{0.159582973f, 0.107805468f},
-std::array<float,2>{0.760853171f, 0.908495843f},
-std::array<float,2>{0.241615027f, 0.724490583f},
-std::array<float,2>{0.873190403f, 0.342595071f},
-std::array<float,2>{0.438657969f, 0.154934615f},
-std::array<float,2>{0.630139291f, 0.775914133f},
-std::array<float,2>{0.252971858f, 0.975584805f},
-std::array<float,2>{0.603240311f, 0.0447731093f},
-std::array<float,2>{0.0627486333f, 0.468852401f},
-std::array<float,2>{0.933942437f, 0.534573972f},
-std::array<float,2>{0.088620916f, 0.948593616f},
-std::array<float,2>{0.907879174f, 0.00591797661f},
-std::array<float,2>{0.280815572f, 0.444022804f},
-std::array<float,2>{0.609923661f, 0.519579887f},
-std::array<float,2>{0.460792482f, 0.716496229f},
-std::array<float,2>{0.647110641f, 0.373275608f},
-std::array<float,2>{0.226362973f, 0.180403903f},
-std::array<float,2>{0.847015679f, 0.805066228f},
-std::array<float,2>{0.176673099f, 0.623193383f},
-std::array<float,2>{0.773276806f, 0.437198997f},
-std::array<float,2>{0.411940724f, 0.0678517371f},
-std::array<float,2>{0.696727693f, 0.875286877f},
-std::array<float,2>{0.312628478f, 0.852320611f},
-std::array<float,2>{0.514247358f, 0.214665651f},
-std::array<float,2>{0.0310129523f, 0.299935102f},
-std::array<float,2>{0.987781048f, 0.662746131f},
-std::array<float,2>{0.2170849f, 0.755724609f},
-std::array<float,2>{0.815947533f, 0.133700401f},
-std::array<float,2>{0.497105658f, 0.318351448f},
-std::array<float,2>{0.666535318f, 0.741829932f},
-std::array<float,2>{0.310893446f, 0.558443487f},
-std::array<float,2>{0.585591435f, 0.491779268f},
-std::array<float,2>{0.118162356f, 0.0618852526f},
-std::array<float,2>{0.896790624f, 0.986942649f},
-std::array<float,2>{0.0535995439f, 0.636265635f},
-std::array<float,2>{0.941862285f, 0.252039582f},
-std::array<float,2>{0.351794451f, 0.230060115f},
-std::array<float,2>{0.553822517f, 0.822491467f},
-std::array<float,2>{0.388942629f, 0.924292088f},
-std::array<float,2>{0.740661025f, 0.11570026f},
-std::array<float,2>{0.129643872f, 0.376683086f},
-std::array<float,2>{0.783844173f, 0.59189105f},
-std::array<float,2>{0.229856208f, 0.995706737f},
-std::array<float,2>{0.853196263f, 0.0515212417f},
-std::array<float,2>{0.464094996f, 0.494122624f},
-std::array<float,2>{0.650390089f, 0.554033637f},
-std::array<float,2>{0.2714746f, 0.745898187f},
-std::array<float,2>{0.61911279f, 0.32056275f},
-std::array<float,2>{0.0805730298f, 0.131075308f},
-std::array<float,2>{0.916902542f, 0.762105167f},
-std::array<float,2>{0.0198978335f, 0.583678663f},
-std::array<float,2>{0.995893359f, 0.387698323f},
-std::array<float,2>{0.323377043f, 0.124461681f},
-std::array<float,2>{0.507348061f, 0.935885429f},
-std::array<float,2>{0.41993022f, 0.819487512f},
-std::array<float,2>{0.692986131f, 0.222009972f},
-std::array<float,2>{0.186218128f, 0.263080746f},
-std::array<float,2>{0.779427469f, 0.628538728f},
-std::array<float,2>{0.112884514f, 0.79974395f},
-std::array<float,2>{0.898703754f, 0.178567961f},
-std::array<float,2>{0.303573906f, 0.365259409f},
-std::array<float,2>{0.59331888f, 0.71040529f},
-std::array<float,2>{0.491093099f, 0.524150312f},
-std::array<float,2>{0.657791913f, 0.451992899f},
-std::array<float,2>{0.21062164f, 0.0127903121f},
-std::array<float,2>{0.826673806f, 0.94266665f},
-std::array<float,2>{0.138751626f, 0.671439588f},
-std::array<float,2>{0.796461046f, 0.308780104f},
-std::array<float,2>{0.376436114f, 0.20333074f},
-std::array<float,2>{0.742417812f, 0.850190639f},
-std::array<float,2>{0.344651312f, 0.888355792f},
-std::array<float,2>{0.556266367f, 0.0731735528f},
-std::array<float,2>{0.0602298155f, 0.428519577f},
-std::array<float,2>{0.949454784f, 0.611886978f},
-std::array<float,2>{0.0460379757f, 0.92097652f},
-std::array<float,2>{0.953704834f, 0.0941602513f},
-std::array<float,2>{0.372568101f, 0.403951705f},
-std::array<float,2>{0.536387563f, 0.569690168f},
-std::array<float,2>{0.39828375f, 0.650000155f},
-std::array<float,2>{0.722004652f, 0.274887621f},
-std::array<float,2>{0.154459015f, 0.24921526f},
-std::array<float,2>{0.804164052f, 0.83359468f},
-std::array<float,2>{0.192105711f, 0.541544795f},
-std::array<float,2>{0.842679143f, 0.477415949f},
-std::array<float,2>{0.471532464f, 0.0326688364f},
-std::array<float,2>{0.679672956f, 0.98071003f},
-std::array<float,2>{0.285034359f, 0.770936549f},
-std::array<float,2>{0.566921055f, 0.146271497f},
-std::array<float,2>{0.0942631289f, 0.331856072f},
-std::array<float,2>{0.878083348f, 0.730128706f},
-std::array<float,2>{0.167276025f, 0.865076602f},
-std::array<float,2>{0.757697046f, 0.190975621f},
-std::array<float,2>{0.432906687f, 0.292988181f},
-std::array<float,2>{0.711902261f, 0.684279501f},
-std::array<float,2>{0.336070031f, 0.601189971f},
-std::array<float,2>{0.53040576f, 0.409073442f},
-std::array<float,2>{0.00176326896f, 0.0799989626f},
-std::array<float,2>{0.977191925f, 0.89488405f},
-std::array<float,2>{0.0754183382f, 0.696894765f},
-std::array<float,2>{0.929622293f, 0.353813827f},
-std::array<float,2>{0.263670295f, 0.165471122f},
-std::array<float,2>{0.596252143f, 0.790834248f},
-std::array<float,2>{0.44779855f, 0.962180495f},
-std::array<float,2>{0.637585998f, 0.0176614802f},
-std::array<float,2>{0.245185122f, 0.463330328f},
-std::array<float,2>{0.86657691f, 0.50164479f},
-std::array<float,2>{0.236000687f, 0.885755897f},
-std::array<float,2>{0.87026453f, 0.0770376027f},
-std::array<float,2>{0.444417477f, 0.423563033f},
-std::array<float,2>{0.626144588f, 0.615446568f},
-std::array<float,2>{0.25682959f, 0.667957604f},
-std::array<float,2>{0.606491923f, 0.306681752f},
-std::array<float,2>{0.0690976456f, 0.210498288f},
-std::array<float,2>{0.933334708f, 0.845416605f},
-std::array<float,2>{0.0114490986f, 0.528889239f},
-std::array<float,2>{0.971229911f, 0.447470725f},
-std::array<float,2>{0.33490628f, 0.00908784755f},
-std::array<float,2>{0.523383081f, 0.938729465f},
-std::array<float,2>{0.426096201f, 0.803334177f},
-std::array<float,2>{0.705328584f, 0.172249317f},
-std::array<float,2>{0.160204664f, 0.360289961f},
-std::array<float,2>{0.762966394f, 0.705263019f},
-std::array<float,2>{0.102583051f, 0.815285265f},
-std::array<float,2>{0.885276735f, 0.224035591f},
-std::array<float,2>{0.292588055f, 0.259358019f},
-std::array<float,2>{0.573165596f, 0.630378127f},
-std::array<float,2>{0.484119415f, 0.58137995f},
-std::array<float,2>{0.687154114f, 0.383930892f},
-std::array<float,2>{0.195403382f, 0.118400231f},
-std::array<float,2>{0.835203707f, 0.930703521f},
-std::array<float,2>{0.146867946f, 0.749105275f},
-std::array<float,2>{0.807003498f, 0.324883431f},
-std::array<float,2>{0.402837783f, 0.128897533f},
-std::array<float,2>{0.731501162f, 0.759909272f},
-std::array<float,2>{0.363458991f, 0.998342454f},
-std::array<float,2>{0.543448508f, 0.0473611951f},
-std::array<float,2>{0.0325230733f, 0.499933779f},
-std::array<float,2>{0.968624949f, 0.546888649f},
-std::array<float,2>{0.0495186932f, 0.965465307f},
-std::array<float,2>{0.937641919f, 0.0209878236f},
-std::array<float,2>{0.357377887f, 0.465701818f},
-std::array<float,2>{0.549164832f, 0.506460309f},
-std::array<float,2>{0.383398741f, 0.700385809f},
-std::array<float,2>{0.736027658f, 0.355754644f},
-std::array<float,2>{0.127967238f, 0.171419665f},
-std::array<float,2>{0.785765827f, 0.794868112f},
-std::array<float,2>{0.213065356f, 0.596549153f},
-std::array<float,2>{0.819714963f, 0.41150558f},
-std::array<float,2>{0.494184613f, 0.084007889f},
-std::array<float,2>{0.670168996f, 0.890882909f},
-std::array<float,2>{0.305073529f, 0.860635281f},
-std::array<float,2>{0.579445004f, 0.194953844f},
-std::array<float,2>{0.123464614f, 0.290882081f},
-std::array<float,2>{0.891827285f, 0.68257314f},
-std::array<float,2>{0.174831808f, 0.766268969f},
-std::array<float,2>{0.766153634f, 0.14440681f},
-std::array<float,2>{0.40838775f, 0.332422614f},
-std::array<float,2>{0.702082992f, 0.733401299f},
-std::array<float,2>{0.318187684f, 0.545880616f},
-std::array<float,2>{0.510872424f, 0.483394057f},
-std::array<float,2>{0.024344869f, 0.0357144363f},
-std::array<float,2>{0.991454363f, 0.977380276f},
-std::array<float,2>{0.0911044031f, 0.656143546f},
-std::array<float,2>{0.913470864f, 0.280443698f},
-std::array<float,2>{0.27476275f, 0.243121192f},
-std::array<float,2>{0.615935147f, 0.83026123f},
-std::array<float,2>{0.456451893f, 0.915355265f},
-std::array<float,2>{0.640907943f, 0.100179538f},
-std::array<float,2>{0.219526201f, 0.400220066f},
-std::array<float,2>{0.851507723f, 0.562844992f},
-std::array<float,2>{0.135528579f, 0.970859885f},
-std::array<float,2>{0.7895872f, 0.0421169735f},
-std::array<float,2>{0.379250795f, 0.475372583f},
-std::array<float,2>{0.748992324f, 0.535896122f},
-std::array<float,2>{0.347892731f, 0.718800545f},
-std::array<float,2>{0.559650064f, 0.336817324f},
-std::array<float,2>{0.0563673675f, 0.151470631f},
-std::array<float,2>{0.947292686f, 0.777525425f},
-std::array<float,2>{0.113673747f, 0.576680303f},
-std::array<float,2>{0.90250355f, 0.391921788f},
-std::array<float,2>{0.299850702f, 0.10267318f},
-std::array<float,2>{0.588943541f, 0.91339612f},
-std::array<float,2>{0.486235112f, 0.838174641f},
-std::array<float,2>{0.662298739f, 0.239950821f},
-std::array<float,2>{0.203947291f, 0.272770762f},
-std::array<float,2>{0.82411474f, 0.640831649f},
-std::array<float,2>{0.0163685046f, 0.783267915f},
-std::array<float,2>{0.996135056f, 0.15894191f},
-std::array<float,2>{0.327987581f, 0.347005546f},
-std::array<float,2>{0.501156747f, 0.687792838f},
-std::array<float,2>{0.416443378f, 0.510022819f},
-std::array<float,2>{0.689981401f, 0.458130091f},
-std::array<float,2>{0.18348366f, 0.0253324695f},
-std::array<float,2>{0.77644664f, 0.953449368f},
-std::array<float,2>{0.231904432f, 0.67829591f},
-std::array<float,2>{0.858601332f, 0.285445005f},
-std::array<float,2>{0.465897143f, 0.197137937f},
-std::array<float,2>{0.65593338f, 0.869957328f},
-std::array<float,2>{0.267789662f, 0.90194571f},
-std::array<float,2>{0.62343353f, 0.0923780948f},
-std::array<float,2>{0.0820697471f, 0.421132386f},
-std::array<float,2>{0.920105517f, 0.605323374f},
-std::array<float,2>{0.0723131001f, 0.926878095f},
-std::array<float,2>{0.92222333f, 0.110224351f},
-std::array<float,2>{0.260744095f, 0.380621284f},
-std::array<float,2>{0.600650787f, 0.587954104f},
-std::array<float,2>{0.449431896f, 0.639548481f},
-std::array<float,2>{0.635397494f, 0.254517615f},
-std::array<float,2>{0.24734509f, 0.233309761f},
-std::array<float,2>{0.860562563f, 0.826253474f},
-std::array<float,2>{0.167978957f, 0.562074423f},
-std::array<float,2>{0.752650142f, 0.485808671f},
-std::array<float,2>{0.436071843f, 0.0566057563f},
-std::array<float,2>{0.717874587f, 0.991495967f},
-std::array<float,2>{0.341240436f, 0.751665294f},
-std::array<float,2>{0.526085258f, 0.138267905f},
-std::array<float,2>{0.00429767976f, 0.312573582f},
-std::array<float,2>{0.98359561f, 0.735682726f},
-std::array<float,2>{0.188187599f, 0.857291102f},
-std::array<float,2>{0.837166727f, 0.215877414f},
-std::array<float,2>{0.47421959f, 0.303986758f},
-std::array<float,2>{0.672131479f, 0.657669723f},
-std::array<float,2>{0.28679201f, 0.620640337f},
-std::array<float,2>{0.56307292f, 0.430858433f},
-std::array<float,2>{0.098272115f, 0.0643938705f},
-std::array<float,2>{0.879749119f, 0.881255388f},
-std::array<float,2>{0.0408159718f, 0.712667763f},
-std::array<float,2>{0.95844692f, 0.368710041f},
-std::array<float,2>{0.367843211f, 0.18445082f},
-std::array<float,2>{0.533630788f, 0.808794081f},
-std::array<float,2>{0.39327997f, 0.949552774f},
-std::array<float,2>{0.723204494f, 0.00249136612f},
-std::array<float,2>{0.151946977f, 0.439405948f},
-std::array<float,2>{0.800315142f, 0.516235232f},
-std::array<float,2>{0.156783178f, 0.907891989f},
-std::array<float,2>{0.75882411f, 0.106677331f},
-std::array<float,2>{0.425245374f, 0.394839406f},
-std::array<float,2>{0.709132135f, 0.571501136f},
-std::array<float,2>{0.329965144f, 0.647950888f},
-std::array<float,2>{0.519168675f, 0.266369045f},
-std::array<float,2>{0.0147037674f, 0.234766692f},
-std::array<float,2>{0.975519001f, 0.842839837f},
-std::array<float,2>{0.066089049f, 0.533061981f},
-std::array<float,2>{0.935610473f, 0.471516311f},
-std::array<float,2>{0.251235753f, 0.0450178497f},
-std::array<float,2>{0.603994608f, 0.974077284f},
-std::array<float,2>{0.441322088f, 0.77358681f},
-std::array<float,2>{0.631649613f, 0.153952479f},
-std::array<float,2>{0.239551216f, 0.340111107f},
-std::array<float,2>{0.871588767f, 0.725242674f},
-std::array<float,2>{0.0389118493f, 0.87411797f},
-std::array<float,2>{0.961779416f, 0.202626154f},
-std::array<float,2>{0.361321032f, 0.282978922f},
-std::array<float,2>{0.541348696f, 0.674813867f},
-std::array<float,2>{0.398975253f, 0.606368065f},
-std::array<float,2>{0.73019433f, 0.414422721f},
-std::array<float,2>{0.142951399f, 0.0888963789f},
-std::array<float,2>{0.811334074f, 0.905626118f},
-std::array<float,2>{0.199742764f, 0.692535222f},
-std::array<float,2>{0.829572082f, 0.350113571f},
-std::array<float,2>{0.4796817f, 0.160238981f},
-std::array<float,2>{0.680424631f, 0.789041877f},
-std::array<float,2>{0.294135243f, 0.957553387f},
-std::array<float,2>{0.574354589f, 0.0273461938f},
-std::array<float,2>{0.105836347f, 0.453996003f},
-std::array<float,2>{0.88944006f, 0.513745785f},
-std::array<float,2>{0.120094016f, 0.984831095f},
-std::array<float,2>{0.895224631f, 0.0604105853f},
-std::array<float,2>{0.310321122f, 0.488302022f},
-std::array<float,2>{0.583876729f, 0.555391312f},
-std::array<float,2>{0.498454779f, 0.738703191f},
-std::array<float,2>{0.665804148f, 0.320292532f},
-std::array<float,2>{0.215727985f, 0.135464311f},
-std::array<float,2>{0.81266439f, 0.757592618f},
-std::array<float,2>{0.131724104f, 0.591150403f},
-std::array<float,2>{0.781381607f, 0.377690554f},
-std::array<float,2>{0.388124526f, 0.113445751f},
-std::array<float,2>{0.73872304f, 0.922845066f},
-std::array<float,2>{0.355103284f, 0.821080625f},
-std::array<float,2>{0.552191556f, 0.22713989f},
-std::array<float,2>{0.0511640012f, 0.251139641f},
-std::array<float,2>{0.944395602f, 0.634628534f},
-std::array<float,2>{0.22401689f, 0.807095587f},
-std::array<float,2>{0.845371544f, 0.183533877f},
-std::array<float,2>{0.458691955f, 0.371939629f},
-std::array<float,2>{0.646111548f, 0.718513966f},
-std::array<float,2>{0.278827101f, 0.522788584f},
-std::array<float,2>{0.61162883f, 0.442153454f},
-std::array<float,2>{0.0860857591f, 0.00583106f},
-std::array<float,2>{0.908226371f, 0.946512461f},
-std::array<float,2>{0.0276294984f, 0.661173046f},
-std::array<float,2>{0.984453261f, 0.298465431f},
-std::array<float,2>{0.315102637f, 0.212622061f},
-std::array<float,2>{0.511774778f, 0.855049908f},
-std::array<float,2>{0.414017856f, 0.877221346f},
-std::array<float,2>{0.697780788f, 0.0695391446f},
-std::array<float,2>{0.179489732f, 0.435505122f},
-std::array<float,2>{0.770781994f, 0.621570885f},
-std::array<float,2>{0.207291767f, 0.944966912f},
-std::array<float,2>{0.825336039f, 0.0139675355f},
-std::array<float,2>{0.489420056f, 0.450156927f},
-std::array<float,2>{0.659936786f, 0.526977181f},
-std::array<float,2>{0.302034318f, 0.707940638f},
-std::array<float,2>{0.591261923f, 0.364651471f},
-std::array<float,2>{0.109980755f, 0.177548796f},
-std::array<float,2>{0.901609004f, 0.798744202f},
-std::array<float,2>{0.0608750843f, 0.609666526f},
-std::array<float,2>{0.952635646f, 0.427315623f},
-std::array<float,2>{0.346093059f, 0.0714457259f},
-std::array<float,2>{0.558027148f, 0.888905466f},
-std::array<float,2>{0.377963722f, 0.849403679f},
-std::array<float,2>{0.745816946f, 0.206016004f},
-std::array<float,2>{0.13836883f, 0.312030196f},
-std::array<float,2>{0.793843627f, 0.66849035f},
-std::array<float,2>{0.0791805089f, 0.765581131f},
-std::array<float,2>{0.915517569f, 0.13078478f},
-std::array<float,2>{0.273410499f, 0.322960466f},
-std::array<float,2>{0.620409191f, 0.742778003f},
-std::array<float,2>{0.461041391f, 0.550897062f},
-std::array<float,2>{0.651643932f, 0.494948298f},
-std::array<float,2>{0.22822994f, 0.0530799478f},
-std::array<float,2>{0.854856968f, 0.99279809f},
-std::array<float,2>{0.18505317f, 0.6262725f},
-std::array<float,2>{0.779265583f, 0.265144676f},
-std::array<float,2>{0.419766784f, 0.21976313f},
-std::array<float,2>{0.693715096f, 0.816673279f},
-std::array<float,2>{0.321821094f, 0.935417593f},
-std::array<float,2>{0.504792392f, 0.122546755f},
-std::array<float,2>{0.0223425627f, 0.38919121f},
-std::array<float,2>{0.993907988f, 0.584559739f},
-std::array<float,2>{0.00324957073f, 0.898086786f},
-std::array<float,2>{0.979092538f, 0.080990687f},
-std::array<float,2>{0.338148683f, 0.40718329f},
-std::array<float,2>{0.528157592f, 0.597853124f},
-std::array<float,2>{0.430556655f, 0.687479436f},
-std::array<float,2>{0.713841558f, 0.295995653f},
-std::array<float,2>{0.16429992f, 0.188058689f},
-std::array<float,2>{0.754585624f, 0.866093695f},
-std::array<float,2>{0.24292177f, 0.502555847f},
-std::array<float,2>{0.864992917f, 0.462789237f},
-std::array<float,2>{0.446020633f, 0.0166195333f},
-std::array<float,2>{0.63924849f, 0.964695036f},
-std::array<float,2>{0.265021592f, 0.792165875f},
-std::array<float,2>{0.593917072f, 0.166340306f},
-std::array<float,2>{0.0771086738f, 0.35300532f},
-std::array<float,2>{0.92655313f, 0.698560596f},
-std::array<float,2>{0.153218046f, 0.83440125f},
-std::array<float,2>{0.802723944f, 0.246678621f},
-std::array<float,2>{0.395182014f, 0.276844531f},
-std::array<float,2>{0.71960175f, 0.651993573f},
-std::array<float,2>{0.373502672f, 0.567234337f},
-std::array<float,2>{0.538399339f, 0.405644894f},
-std::array<float,2>{0.0440766588f, 0.0975351408f},
-std::array<float,2>{0.956554055f, 0.918811798f},
-std::array<float,2>{0.0975361913f, 0.726953506f},
-std::array<float,2>{0.876879156f, 0.329087466f},
-std::array<float,2>{0.282479227f, 0.147850603f},
-std::array<float,2>{0.568935096f, 0.772616386f},
-std::array<float,2>{0.469230235f, 0.983397245f},
-std::array<float,2>{0.67600745f, 0.0343948938f},
-std::array<float,2>{0.194340825f, 0.47917226f},
-std::array<float,2>{0.840478957f, 0.539412022f}}
\ No newline at end of file
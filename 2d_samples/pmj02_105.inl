@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.48051542f, 0.468691647f},
-std::array<float,2>{0.892629921f, 0.662662446f},
-std::array<float,2>{0.716577888f, 0.111489646f},
-std::array<float,2>{0.0627647266f, 0.967702746f},
-std::array<float,2>{0.167405725f, 0.178774789f},
-std::array<float,2>{0.600877285f, 0.832605362f},
-std::array<float,2>{0.870732427f, 0.324879855f},
-std::array<float,2>{0.340475321f, 0.507075906f},
-std::array<float,2>{0.302736521f, 0.0189599935f},
-std::array<float,2>{0.791638017f, 0.894078612f},
-std::array<float,2>{0.507741988f, 0.395589143f},
-std::array<float,2>{0.192350656f, 0.736982048f},
-std::array<float,2>{0.0467442274f, 0.256769866f},
-std::array<float,2>{0.638212085f, 0.598945379f},
-std::array<float,2>{0.942456543f, 0.189638481f},
-std::array<float,2>{0.431913048f, 0.796517491f},
-std::array<float,2>{0.3572779f, 0.344446301f},
-std::array<float,2>{0.83710593f, 0.55290246f},
-std::array<float,2>{0.568815768f, 0.143549547f},
-std::array<float,2>{0.1519389f, 0.860520005f},
-std::array<float,2>{0.0979675204f, 0.0794071779f},
-std::array<float,2>{0.731491387f, 0.973959565f},
-std::array<float,2>{0.93748641f, 0.494115591f},
-std::array<float,2>{0.441863149f, 0.626743257f},
-std::array<float,2>{0.404049933f, 0.221036851f},
-std::array<float,2>{0.995848835f, 0.771943033f},
-std::array<float,2>{0.679340422f, 0.294913828f},
-std::array<float,2>{0.00335408025f, 0.572362959f},
-std::array<float,2>{0.246745154f, 0.427189827f},
-std::array<float,2>{0.544604361f, 0.709648907f},
-std::array<float,2>{0.77587986f, 0.0553273112f},
-std::array<float,2>{0.265530944f, 0.923300326f},
-std::array<float,2>{0.408794671f, 0.311006933f},
-std::array<float,2>{0.956681252f, 0.581337571f},
-std::array<float,2>{0.652912498f, 0.239318311f},
-std::array<float,2>{0.0470275395f, 0.763681233f},
-std::array<float,2>{0.208684951f, 0.0390533842f},
-std::array<float,2>{0.521587491f, 0.909287155f},
-std::array<float,2>{0.805567265f, 0.409005761f},
-std::array<float,2>{0.288695902f, 0.689313889f},
-std::array<float,2>{0.313457757f, 0.125452325f},
-std::array<float,2>{0.846094429f, 0.846224964f},
-std::array<float,2>{0.615061283f, 0.368102759f},
-std::array<float,2>{0.181977838f, 0.542492986f},
-std::array<float,2>{0.0893323198f, 0.474226266f},
-std::array<float,2>{0.690205574f, 0.644908309f},
-std::array<float,2>{0.89036721f, 0.0742717832f},
-std::array<float,2>{0.492865622f, 0.989599168f},
-std::array<float,2>{0.277136087f, 0.381487221f},
-std::array<float,2>{0.757264495f, 0.721236765f},
-std::array<float,2>{0.557662189f, 0.00145274308f},
-std::array<float,2>{0.230948389f, 0.884743452f},
-std::array<float,2>{0.0201548412f, 0.214480072f},
-std::array<float,2>{0.663018346f, 0.808934033f},
-std::array<float,2>{0.979801536f, 0.270989716f},
-std::array<float,2>{0.37677002f, 0.616392612f},
-std::array<float,2>{0.464731425f, 0.0952497199f},
-std::array<float,2>{0.909704268f, 0.939707994f},
-std::array<float,2>{0.742177725f, 0.441054463f},
-std::array<float,2>{0.114860706f, 0.684520185f},
-std::array<float,2>{0.130931467f, 0.333922505f},
-std::array<float,2>{0.583931148f, 0.52915895f},
-std::array<float,2>{0.815369904f, 0.159921199f},
-std::array<float,2>{0.361130446f, 0.816901863f},
-std::array<float,2>{0.384137154f, 0.416216433f},
-std::array<float,2>{0.973828435f, 0.700207531f},
-std::array<float,2>{0.670269668f, 0.0456493571f},
-std::array<float,2>{0.0247293618f, 0.91901356f},
-std::array<float,2>{0.219037578f, 0.243399665f},
-std::array<float,2>{0.552436292f, 0.754276931f},
-std::array<float,2>{0.759631753f, 0.297497749f},
-std::array<float,2>{0.268123567f, 0.589382231f},
-std::array<float,2>{0.374876589f, 0.0690428317f},
-std::array<float,2>{0.822639287f, 0.993876219f},
-std::array<float,2>{0.589048326f, 0.483103365f},
-std::array<float,2>{0.136507377f, 0.654416978f},
-std::array<float,2>{0.123248026f, 0.364830136f},
-std::array<float,2>{0.749223709f, 0.53442353f},
-std::array<float,2>{0.914512217f, 0.13888973f},
-std::array<float,2>{0.453180403f, 0.858903587f},
-std::array<float,2>{0.295460314f, 0.274226159f},
-std::array<float,2>{0.803907275f, 0.624119103f},
-std::array<float,2>{0.52660954f, 0.209806919f},
-std::array<float,2>{0.215466455f, 0.80382508f},
-std::array<float,2>{0.0578388795f, 0.00865200534f},
-std::array<float,2>{0.647706628f, 0.878072798f},
-std::array<float,2>{0.96138835f, 0.386281013f},
-std::array<float,2>{0.414805502f, 0.732189298f},
-std::array<float,2>{0.4885903f, 0.169393912f},
-std::array<float,2>{0.875605047f, 0.821227074f},
-std::array<float,2>{0.700556457f, 0.340286553f},
-std::array<float,2>{0.0821285918f, 0.51953429f},
-std::array<float,2>{0.177823171f, 0.446885109f},
-std::array<float,2>{0.621029556f, 0.679156482f},
-std::array<float,2>{0.858233213f, 0.108523883f},
-std::array<float,2>{0.324740618f, 0.945379019f},
-std::array<float,2>{0.449723899f, 0.316106141f},
-std::array<float,2>{0.925893843f, 0.510972917f},
-std::array<float,2>{0.72350198f, 0.181262478f},
-std::array<float,2>{0.107535347f, 0.842909813f},
-std::array<float,2>{0.14814125f, 0.119750097f},
-std::array<float,2>{0.575217903f, 0.960827947f},
-std::array<float,2>{0.828525364f, 0.458992988f},
-std::array<float,2>{0.348628789f, 0.665932178f},
-std::array<float,2>{0.250261009f, 0.202311203f},
-std::array<float,2>{0.773160577f, 0.784575403f},
-std::array<float,2>{0.533830643f, 0.265529901f},
-std::array<float,2>{0.237691268f, 0.608062685f},
-std::array<float,2>{0.0117971413f, 0.401376545f},
-std::array<float,2>{0.684127927f, 0.746780157f},
-std::array<float,2>{0.990384936f, 0.0295967087f},
-std::array<float,2>{0.392407626f, 0.901345432f},
-std::array<float,2>{0.333401561f, 0.486640364f},
-std::array<float,2>{0.864936173f, 0.635309279f},
-std::array<float,2>{0.606492877f, 0.0894732028f},
-std::array<float,2>{0.160839647f, 0.97851187f},
-std::array<float,2>{0.0705936626f, 0.15211159f},
-std::array<float,2>{0.704334319f, 0.87291795f},
-std::array<float,2>{0.900746226f, 0.353205651f},
-std::array<float,2>{0.474159151f, 0.561828375f},
-std::array<float,2>{0.422417819f, 0.0536703952f},
-std::array<float,2>{0.945768416f, 0.931672573f},
-std::array<float,2>{0.627051592f, 0.432665497f},
-std::array<float,2>{0.0351214595f, 0.716721296f},
-std::array<float,2>{0.202513635f, 0.288284838f},
-std::array<float,2>{0.514251232f, 0.564596295f},
-std::array<float,2>{0.786783814f, 0.229010522f},
-std::array<float,2>{0.30659157f, 0.779113591f},
-std::array<float,2>{0.458825618f, 0.39308852f},
-std::array<float,2>{0.920386374f, 0.740881801f},
-std::array<float,2>{0.745903015f, 0.0223702397f},
-std::array<float,2>{0.117435388f, 0.895179987f},
-std::array<float,2>{0.140450537f, 0.194555804f},
-std::array<float,2>{0.591887832f, 0.789551437f},
-std::array<float,2>{0.826297402f, 0.253905207f},
-std::array<float,2>{0.370317757f, 0.595125437f},
-std::array<float,2>{0.271772236f, 0.115064457f},
-std::array<float,2>{0.763436794f, 0.96438998f},
-std::array<float,2>{0.550723672f, 0.461324155f},
-std::array<float,2>{0.223745987f, 0.657883108f},
-std::array<float,2>{0.030535249f, 0.322367758f},
-std::array<float,2>{0.667856157f, 0.502648056f},
-std::array<float,2>{0.968753517f, 0.175129235f},
-std::array<float,2>{0.389522791f, 0.828454554f},
-std::array<float,2>{0.321598023f, 0.289619923f},
-std::array<float,2>{0.852994978f, 0.574779093f},
-std::array<float,2>{0.624566197f, 0.226499528f},
-std::array<float,2>{0.175196856f, 0.767828166f},
-std::array<float,2>{0.0781908184f, 0.0609308109f},
-std::array<float,2>{0.697461247f, 0.926281631f},
-std::array<float,2>{0.882293284f, 0.424293071f},
-std::array<float,2>{0.486611396f, 0.704056919f},
-std::array<float,2>{0.420863897f, 0.145743027f},
-std::array<float,2>{0.966988444f, 0.865876019f},
-std::array<float,2>{0.644302964f, 0.350702643f},
-std::array<float,2>{0.0605889708f, 0.550418377f},
-std::array<float,2>{0.213071734f, 0.497255862f},
-std::array<float,2>{0.529353023f, 0.632199883f},
-std::array<float,2>{0.799704492f, 0.0822160095f},
-std::array<float,2>{0.289185166f, 0.969961941f},
-std::array<float,2>{0.395602316f, 0.371793479f},
-std::array<float,2>{0.988065183f, 0.543962717f},
-std::array<float,2>{0.68207866f, 0.130915239f},
-std::array<float,2>{0.00965804607f, 0.850072682f},
-std::array<float,2>{0.241268858f, 0.073450461f},
-std::array<float,2>{0.535377324f, 0.987547696f},
-std::array<float,2>{0.768442869f, 0.470429689f},
-std::array<float,2>{0.256498694f, 0.643403351f},
-std::array<float,2>{0.344795048f, 0.235222399f},
-std::array<float,2>{0.83528465f, 0.761548996f},
-std::array<float,2>{0.572963893f, 0.306582302f},
-std::array<float,2>{0.143577993f, 0.582045734f},
-std::array<float,2>{0.102183737f, 0.413004309f},
-std::array<float,2>{0.721858799f, 0.694979846f},
-std::array<float,2>{0.925283909f, 0.0322630741f},
-std::array<float,2>{0.445547551f, 0.913769484f},
-std::array<float,2>{0.309820592f, 0.442344368f},
-std::array<float,2>{0.782818854f, 0.680950165f},
-std::array<float,2>{0.510039568f, 0.10040196f},
-std::array<float,2>{0.195563003f, 0.943555713f},
-std::array<float,2>{0.0382126607f, 0.160343722f},
-std::array<float,2>{0.632275343f, 0.814376533f},
-std::array<float,2>{0.952756643f, 0.330271482f},
-std::array<float,2>{0.428955525f, 0.526399374f},
-std::array<float,2>{0.472404331f, 0.00429587346f},
-std::array<float,2>{0.9037624f, 0.887605131f},
-std::array<float,2>{0.710277438f, 0.376256555f},
-std::array<float,2>{0.0763752833f, 0.725798666f},
-std::array<float,2>{0.159184188f, 0.269198507f},
-std::array<float,2>{0.604226649f, 0.612695396f},
-std::array<float,2>{0.863205373f, 0.218568325f},
-std::array<float,2>{0.330392689f, 0.805158556f},
-std::array<float,2>{0.436005056f, 0.479611337f},
-std::array<float,2>{0.940700293f, 0.650272906f},
-std::array<float,2>{0.63421309f, 0.0653038919f},
-std::array<float,2>{0.0416115075f, 0.99795258f},
-std::array<float,2>{0.187875971f, 0.1354305f},
-std::array<float,2>{0.500978231f, 0.854606628f},
-std::array<float,2>{0.796041608f, 0.361846328f},
-std::array<float,2>{0.297262877f, 0.537611902f},
-std::array<float,2>{0.338891178f, 0.0427091569f},
-std::array<float,2>{0.873031676f, 0.915451825f},
-std::array<float,2>{0.596504569f, 0.42015785f},
-std::array<float,2>{0.16904217f, 0.696406782f},
-std::array<float,2>{0.0681517795f, 0.304132015f},
-std::array<float,2>{0.711818218f, 0.592237651f},
-std::array<float,2>{0.896949708f, 0.248137161f},
-std::array<float,2>{0.476605535f, 0.752362847f},
-std::array<float,2>{0.258806944f, 0.338158727f},
-std::array<float,2>{0.77839452f, 0.518963635f},
-std::array<float,2>{0.539958775f, 0.166724816f},
-std::array<float,2>{0.243977949f, 0.827302814f},
-std::array<float,2>{0.00607718667f, 0.102811538f},
-std::array<float,2>{0.675377488f, 0.950607121f},
-std::array<float,2>{0.999647558f, 0.451589257f},
-std::array<float,2>{0.400814652f, 0.67359823f},
-std::array<float,2>{0.438949496f, 0.203327835f},
-std::array<float,2>{0.933147311f, 0.798390031f},
-std::array<float,2>{0.728437185f, 0.281019956f},
-std::array<float,2>{0.0965183899f, 0.620684803f},
-std::array<float,2>{0.155347511f, 0.387925208f},
-std::array<float,2>{0.564556479f, 0.728871942f},
-std::array<float,2>{0.840590954f, 0.0134322252f},
-std::array<float,2>{0.35352844f, 0.879455447f},
-std::array<float,2>{0.497908831f, 0.259976089f},
-std::array<float,2>{0.883788228f, 0.602768779f},
-std::array<float,2>{0.694083691f, 0.19876042f},
-std::array<float,2>{0.0927832797f, 0.785758197f},
-std::array<float,2>{0.185556233f, 0.0267766528f},
-std::array<float,2>{0.612177312f, 0.906179011f},
-std::array<float,2>{0.849025071f, 0.403938502f},
-std::array<float,2>{0.317346454f, 0.743196964f},
-std::array<float,2>{0.284766257f, 0.186629295f},
-std::array<float,2>{0.812052727f, 0.839073062f},
-std::array<float,2>{0.516128719f, 0.318843275f},
-std::array<float,2>{0.204518259f, 0.512414873f},
-std::array<float,2>{0.050954666f, 0.456086218f},
-std::array<float,2>{0.650953114f, 0.671448052f},
-std::array<float,2>{0.960742354f, 0.121261396f},
-std::array<float,2>{0.412031084f, 0.954814613f},
-std::array<float,2>{0.36536321f, 0.43601501f},
-std::array<float,2>{0.818104446f, 0.711476982f},
-std::array<float,2>{0.57977438f, 0.0507781059f},
-std::array<float,2>{0.125914454f, 0.934157252f},
-std::array<float,2>{0.109511264f, 0.23156555f},
-std::array<float,2>{0.734534502f, 0.775136411f},
-std::array<float,2>{0.910568178f, 0.283586651f},
-std::array<float,2>{0.466959625f, 0.569109738f},
-std::array<float,2>{0.382319003f, 0.0924244225f},
-std::array<float,2>{0.982506275f, 0.980718017f},
-std::array<float,2>{0.657416046f, 0.490595907f},
-std::array<float,2>{0.0172058139f, 0.637281477f},
-std::array<float,2>{0.230322734f, 0.359093845f},
-std::array<float,2>{0.560173929f, 0.555014133f},
-std::array<float,2>{0.750885427f, 0.153565824f},
-std::array<float,2>{0.281072825f, 0.870062411f},
-std::array<float,2>{0.443942785f, 0.495681256f},
-std::array<float,2>{0.935429454f, 0.627300322f},
-std::array<float,2>{0.732608497f, 0.0817265064f},
-std::array<float,2>{0.100987218f, 0.975651503f},
-std::array<float,2>{0.149161115f, 0.142538518f},
-std::array<float,2>{0.568065345f, 0.862985313f},
-std::array<float,2>{0.838426352f, 0.347561449f},
-std::array<float,2>{0.358815104f, 0.552328944f},
-std::array<float,2>{0.263345659f, 0.0583623312f},
-std::array<float,2>{0.775354147f, 0.924280524f},
-std::array<float,2>{0.545567811f, 0.428582668f},
-std::array<float,2>{0.24838458f, 0.707060456f},
-std::array<float,2>{0.00181854516f, 0.29594174f},
-std::array<float,2>{0.677388012f, 0.571458638f},
-std::array<float,2>{0.993534267f, 0.219283134f},
-std::array<float,2>{0.404756904f, 0.771248758f},
-std::array<float,2>{0.34339717f, 0.326726556f},
-std::array<float,2>{0.868441701f, 0.505813003f},
-std::array<float,2>{0.599461198f, 0.176649556f},
-std::array<float,2>{0.165543735f, 0.835072041f},
-std::array<float,2>{0.0645881668f, 0.110770859f},
-std::array<float,2>{0.716964364f, 0.965278149f},
-std::array<float,2>{0.891384423f, 0.466358751f},
-std::array<float,2>{0.48351562f, 0.660521448f},
-std::array<float,2>{0.430521488f, 0.18929866f},
-std::array<float,2>{0.945026994f, 0.793608606f},
-std::array<float,2>{0.640045762f, 0.255219519f},
-std::array<float,2>{0.0435959995f, 0.601541758f},
-std::array<float,2>{0.19468984f, 0.396857321f},
-std::array<float,2>{0.504477501f, 0.735386193f},
-std::array<float,2>{0.790269196f, 0.017527109f},
-std::array<float,2>{0.301006407f, 0.892455459f},
-std::array<float,2>{0.377781123f, 0.272828639f},
-std::array<float,2>{0.977816641f, 0.615007997f},
-std::array<float,2>{0.660582483f, 0.211494595f},
-std::array<float,2>{0.0233907197f, 0.811819136f},
-std::array<float,2>{0.233449832f, 0.00342117972f},
-std::array<float,2>{0.555141866f, 0.886022806f},
-std::array<float,2>{0.755304694f, 0.379949808f},
-std::array<float,2>{0.274504006f, 0.719836533f},
-std::array<float,2>{0.363120347f, 0.15682137f},
-std::array<float,2>{0.814388871f, 0.819188178f},
-std::array<float,2>{0.585809767f, 0.334043562f},
-std::array<float,2>{0.128919095f, 0.530702531f},
-std::array<float,2>{0.116519168f, 0.437748998f},
-std::array<float,2>{0.738438129f, 0.686428905f},
-std::array<float,2>{0.907197475f, 0.0965620875f},
-std::array<float,2>{0.462331176f, 0.938534677f},
-std::array<float,2>{0.285757422f, 0.407348126f},
-std::array<float,2>{0.807027042f, 0.691105306f},
-std::array<float,2>{0.521131635f, 0.0358909033f},
-std::array<float,2>{0.210885793f, 0.906720817f},
-std::array<float,2>{0.049416624f, 0.242085174f},
-std::array<float,2>{0.65451169f, 0.76346606f},
-std::array<float,2>{0.954168975f, 0.309717f},
-std::array<float,2>{0.407102972f, 0.579238176f},
-std::array<float,2>{0.494959533f, 0.0772373527f},
-std::array<float,2>{0.888152897f, 0.99073571f},
-std::array<float,2>{0.688825667f, 0.475438565f},
-std::array<float,2>{0.0862868652f, 0.646807313f},
-std::array<float,2>{0.181205362f, 0.370637238f},
-std::array<float,2>{0.61611563f, 0.540926635f},
-std::array<float,2>{0.844494104f, 0.127783433f},
-std::array<float,2>{0.314952374f, 0.844245911f},
-std::array<float,2>{0.417854279f, 0.384557366f},
-std::array<float,2>{0.963824868f, 0.73255986f},
-std::array<float,2>{0.644904673f, 0.0115277125f},
-std::array<float,2>{0.0552267246f, 0.87545526f},
-std::array<float,2>{0.218546718f, 0.208731785f},
-std::array<float,2>{0.523455977f, 0.802364767f},
-std::array<float,2>{0.802053809f, 0.276236087f},
-std::array<float,2>{0.293727845f, 0.622393847f},
-std::array<float,2>{0.327736706f, 0.10736163f},
-std::array<float,2>{0.856199741f, 0.948394477f},
-std::array<float,2>{0.619008124f, 0.448345482f},
-std::array<float,2>{0.176868662f, 0.676662445f},
-std::array<float,2>{0.0855654925f, 0.341846555f},
-std::array<float,2>{0.702624023f, 0.52161628f},
-std::array<float,2>{0.877012134f, 0.171582788f},
-std::array<float,2>{0.491909772f, 0.82255882f},
-std::array<float,2>{0.266438544f, 0.299710929f},
-std::array<float,2>{0.761639237f, 0.58665812f},
-std::array<float,2>{0.553188384f, 0.245559663f},
-std::array<float,2>{0.220790073f, 0.756772935f},
-std::array<float,2>{0.0254797041f, 0.0442643389f},
-std::array<float,2>{0.668073893f, 0.920336306f},
-std::array<float,2>{0.974792063f, 0.415975362f},
-std::array<float,2>{0.385543346f, 0.702737093f},
-std::array<float,2>{0.455254048f, 0.137841061f},
-std::array<float,2>{0.916959703f, 0.85598737f},
-std::array<float,2>{0.747094154f, 0.367052078f},
-std::array<float,2>{0.122665659f, 0.531781912f},
-std::array<float,2>{0.133009985f, 0.480954707f},
-std::array<float,2>{0.587373972f, 0.653446794f},
-std::array<float,2>{0.821306705f, 0.0670864433f},
-std::array<float,2>{0.373045772f, 0.994703352f},
-std::array<float,2>{0.476005256f, 0.354147136f},
-std::array<float,2>{0.898957431f, 0.559631526f},
-std::array<float,2>{0.706534088f, 0.149554327f},
-std::array<float,2>{0.0724646151f, 0.874919713f},
-std::array<float,2>{0.162148431f, 0.0872447044f},
-std::array<float,2>{0.608491242f, 0.978628635f},
-std::array<float,2>{0.866472125f, 0.485957205f},
-std::array<float,2>{0.335746318f, 0.634519875f},
-std::array<float,2>{0.307415724f, 0.226631045f},
-std::array<float,2>{0.787920594f, 0.779830098f},
-std::array<float,2>{0.512334645f, 0.286025584f},
-std::array<float,2>{0.200996906f, 0.564249694f},
-std::array<float,2>{0.0320602357f, 0.430493057f},
-std::array<float,2>{0.625166178f, 0.718054891f},
-std::array<float,2>{0.948405385f, 0.0520481654f},
-std::array<float,2>{0.425298631f, 0.92989856f},
-std::array<float,2>{0.35147348f, 0.458533078f},
-std::array<float,2>{0.831335425f, 0.667855978f},
-std::array<float,2>{0.576447368f, 0.117794462f},
-std::array<float,2>{0.14644888f, 0.958683074f},
-std::array<float,2>{0.106911451f, 0.182811052f},
-std::array<float,2>{0.724729598f, 0.840601742f},
-std::array<float,2>{0.927996457f, 0.314172655f},
-std::array<float,2>{0.452790886f, 0.507962346f},
-std::array<float,2>{0.392937481f, 0.0273628049f},
-std::array<float,2>{0.989791393f, 0.898515522f},
-std::array<float,2>{0.685851812f, 0.398860067f},
-std::array<float,2>{0.0152505515f, 0.748788714f},
-std::array<float,2>{0.235653266f, 0.263098508f},
-std::array<float,2>{0.53273797f, 0.606382966f},
-std::array<float,2>{0.771259964f, 0.200855583f},
-std::array<float,2>{0.253156811f, 0.782103598f},
-std::array<float,2>{0.484622419f, 0.423735768f},
-std::array<float,2>{0.880213916f, 0.705770612f},
-std::array<float,2>{0.696551979f, 0.0586905479f},
-std::array<float,2>{0.0803170204f, 0.92942363f},
-std::array<float,2>{0.173269942f, 0.22402662f},
-std::array<float,2>{0.622776568f, 0.767566085f},
-std::array<float,2>{0.853918612f, 0.292179883f},
-std::array<float,2>{0.323886603f, 0.577539384f},
-std::array<float,2>{0.291808754f, 0.084028624f},
-std::array<float,2>{0.797169626f, 0.971252322f},
-std::array<float,2>{0.528335869f, 0.498641938f},
-std::array<float,2>{0.211506158f, 0.629961848f},
-std::array<float,2>{0.0592585914f, 0.349342436f},
-std::array<float,2>{0.640722096f, 0.548555553f},
-std::array<float,2>{0.966590106f, 0.148401156f},
-std::array<float,2>{0.418505996f, 0.864555478f},
-std::array<float,2>{0.36760062f, 0.250888288f},
-std::array<float,2>{0.825620294f, 0.596366763f},
-std::array<float,2>{0.590891004f, 0.192757934f},
-std::array<float,2>{0.137900516f, 0.791751206f},
-std::array<float,2>{0.120497435f, 0.0214700345f},
-std::array<float,2>{0.743159771f, 0.897421479f},
-std::array<float,2>{0.918988168f, 0.3920632f},
-std::array<float,2>{0.460583955f, 0.73977989f},
-std::array<float,2>{0.3883304f, 0.172190532f},
-std::array<float,2>{0.971888065f, 0.830484569f},
-std::array<float,2>{0.664920986f, 0.322091252f},
-std::array<float,2>{0.0282553062f, 0.500937939f},
-std::array<float,2>{0.22526899f, 0.464191645f},
-std::array<float,2>{0.547970235f, 0.658834159f},
-std::array<float,2>{0.764470339f, 0.116782494f},
-std::array<float,2>{0.270484358f, 0.961042285f},
-std::array<float,2>{0.427724361f, 0.328534037f},
-std::array<float,2>{0.950894535f, 0.523983479f},
-std::array<float,2>{0.629396915f, 0.163012117f},
-std::array<float,2>{0.0362289324f, 0.816219687f},
-std::array<float,2>{0.197570726f, 0.098350741f},
-std::array<float,2>{0.509442925f, 0.941527605f},
-std::array<float,2>{0.784653187f, 0.44482851f},
-std::array<float,2>{0.311538547f, 0.681929648f},
-std::array<float,2>{0.329648882f, 0.215890348f},
-std::array<float,2>{0.861027718f, 0.808335245f},
-std::array<float,2>{0.603486717f, 0.266732186f},
-std::array<float,2>{0.156443566f, 0.610282481f},
-std::array<float,2>{0.0754532218f, 0.378228337f},
-std::array<float,2>{0.708175004f, 0.723627746f},
-std::array<float,2>{0.904366195f, 0.00756631512f},
-std::array<float,2>{0.469339103f, 0.888767421f},
-std::array<float,2>{0.254016787f, 0.472001582f},
-std::array<float,2>{0.765826523f, 0.642363906f},
-std::array<float,2>{0.538683295f, 0.0706037134f},
-std::array<float,2>{0.238506526f, 0.985672593f},
-std::array<float,2>{0.0111616561f, 0.129433647f},
-std::array<float,2>{0.680803239f, 0.848852158f},
-std::array<float,2>{0.984548926f, 0.374646246f},
-std::array<float,2>{0.396970272f, 0.546156466f},
-std::array<float,2>{0.449006945f, 0.0346652456f},
-std::array<float,2>{0.922345102f, 0.910749555f},
-std::array<float,2>{0.719935834f, 0.411461294f},
-std::array<float,2>{0.104470044f, 0.692781687f},
-std::array<float,2>{0.141885862f, 0.30852291f},
-std::array<float,2>{0.570343077f, 0.584966183f},
-std::array<float,2>{0.832680404f, 0.237921551f},
-std::array<float,2>{0.347519308f, 0.758449852f},
-std::array<float,2>{0.398788333f, 0.450868726f},
-std::array<float,2>{0.997134209f, 0.674818695f},
-std::array<float,2>{0.673018813f, 0.103767402f},
-std::array<float,2>{0.00525945751f, 0.951472402f},
-std::array<float,2>{0.244257674f, 0.164085045f},
-std::array<float,2>{0.542791903f, 0.824448109f},
-std::array<float,2>{0.780942082f, 0.336944073f},
-std::array<float,2>{0.260474801f, 0.516949356f},
-std::array<float,2>{0.353318095f, 0.0137334419f},
-std::array<float,2>{0.842324197f, 0.881537855f},
-std::array<float,2>{0.562946737f, 0.388952196f},
-std::array<float,2>{0.152531981f, 0.72800529f},
-std::array<float,2>{0.0951285288f, 0.278642386f},
-std::array<float,2>{0.729831755f, 0.618257642f},
-std::array<float,2>{0.931135595f, 0.206145152f},
-std::array<float,2>{0.441085666f, 0.799297035f},
-std::array<float,2>{0.300088495f, 0.360329062f},
-std::array<float,2>{0.79431957f, 0.535693526f},
-std::array<float,2>{0.503819704f, 0.134105399f},
-std::array<float,2>{0.190400928f, 0.852531493f},
-std::array<float,2>{0.0391947292f, 0.064183794f},
-std::array<float,2>{0.635152876f, 0.99876678f},
-std::array<float,2>{0.938725948f, 0.477297097f},
-std::array<float,2>{0.433790714f, 0.651198626f},
-std::array<float,2>{0.478653431f, 0.24671787f},
-std::array<float,2>{0.894824147f, 0.751639962f},
-std::array<float,2>{0.713974476f, 0.300908178f},
-std::array<float,2>{0.068781428f, 0.590635121f},
-std::array<float,2>{0.170061216f, 0.418865055f},
-std::array<float,2>{0.594795048f, 0.698072016f},
-std::array<float,2>{0.873818338f, 0.0403877497f},
-std::array<float,2>{0.33633697f, 0.916906774f},
-std::array<float,2>{0.465423167f, 0.283194304f},
-std::array<float,2>{0.912267208f, 0.56699568f},
-std::array<float,2>{0.737745047f, 0.232445046f},
-std::array<float,2>{0.11264357f, 0.776275575f},
-std::array<float,2>{0.128798485f, 0.0482614487f},
-std::array<float,2>{0.581413209f, 0.937048316f},
-std::array<float,2>{0.819503784f, 0.434609413f},
-std::array<float,2>{0.363435835f, 0.713677645f},
-std::array<float,2>{0.279137373f, 0.154784843f},
-std::array<float,2>{0.753526688f, 0.86770469f},
-std::array<float,2>{0.560599923f, 0.357258826f},
-std::array<float,2>{0.226596639f, 0.557787657f},
-std::array<float,2>{0.0184935238f, 0.489021838f},
-std::array<float,2>{0.659244716f, 0.638721824f},
-std::array<float,2>{0.981447935f, 0.090277791f},
-std::array<float,2>{0.379008591f, 0.98253423f},
-std::array<float,2>{0.319967866f, 0.40621978f},
-std::array<float,2>{0.851025939f, 0.745490491f},
-std::array<float,2>{0.609786808f, 0.0249254946f},
-std::array<float,2>{0.184731156f, 0.903292239f},
-std::array<float,2>{0.091412656f, 0.19638899f},
-std::array<float,2>{0.693050683f, 0.787452877f},
-std::array<float,2>{0.884879172f, 0.259211183f},
-std::array<float,2>{0.499989033f, 0.604116082f},
-std::array<float,2>{0.413164914f, 0.123339415f},
-std::array<float,2>{0.958572865f, 0.956774414f},
-std::array<float,2>{0.649374425f, 0.454008043f},
-std::array<float,2>{0.0539138392f, 0.669748664f},
-std::array<float,2>{0.205338627f, 0.317109048f},
-std::array<float,2>{0.517894745f, 0.51545614f},
-std::array<float,2>{0.809839249f, 0.184004426f},
-std::array<float,2>{0.282738179f, 0.837717235f},
-std::array<float,2>{0.493869215f, 0.476032406f},
-std::array<float,2>{0.889633477f, 0.648340464f},
-std::array<float,2>{0.69137311f, 0.0767747685f},
-std::array<float,2>{0.0887141898f, 0.991630316f},
-std::array<float,2>{0.183201343f, 0.12829943f},
-std::array<float,2>{0.61406976f, 0.844899535f},
-std::array<float,2>{0.847409546f, 0.369592935f},
-std::array<float,2>{0.314411104f, 0.539579391f},
-std::array<float,2>{0.28770721f, 0.03694674f},
-std::array<float,2>{0.806584418f, 0.907390833f},
-std::array<float,2>{0.523314834f, 0.406717777f},
-std::array<float,2>{0.20709081f, 0.690170884f},
-std::array<float,2>{0.0480812453f, 0.308891952f},
-std::array<float,2>{0.653626204f, 0.578216255f},
-std::array<float,2>{0.955854595f, 0.24026309f},
-std::array<float,2>{0.409621f, 0.762357831f},
-std::array<float,2>{0.359768063f, 0.335867196f},
-std::array<float,2>{0.815591812f, 0.52973491f},
-std::array<float,2>{0.582939684f, 0.157590628f},
-std::array<float,2>{0.131989211f, 0.820181012f},
-std::array<float,2>{0.11356952f, 0.096734114f},
-std::array<float,2>{0.740817249f, 0.938419759f},
-std::array<float,2>{0.909087181f, 0.439166784f},
-std::array<float,2>{0.463235557f, 0.686954141f},
-std::array<float,2>{0.375282079f, 0.212657556f},
-std::array<float,2>{0.978698313f, 0.811466932f},
-std::array<float,2>{0.663172126f, 0.272032499f},
-std::array<float,2>{0.0212544277f, 0.613359749f},
-std::array<float,2>{0.231554598f, 0.379428059f},
-std::array<float,2>{0.557427585f, 0.718752086f},
-std::array<float,2>{0.755876303f, 0.00276978407f},
-std::array<float,2>{0.275964469f, 0.885582626f},
-std::array<float,2>{0.433069378f, 0.253924429f},
-std::array<float,2>{0.941683769f, 0.599666238f},
-std::array<float,2>{0.636911929f, 0.18779695f},
-std::array<float,2>{0.0452815183f, 0.794299006f},
-std::array<float,2>{0.193121597f, 0.0157862902f},
-std::array<float,2>{0.50664252f, 0.891049266f},
-std::array<float,2>{0.792263806f, 0.398408264f},
-std::array<float,2>{0.304576099f, 0.734434545f},
-std::array<float,2>{0.341629624f, 0.177016571f},
-std::array<float,2>{0.869152308f, 0.834895492f},
-std::array<float,2>{0.599964082f, 0.32758072f},
-std::array<float,2>{0.166231871f, 0.504422963f},
-std::array<float,2>{0.063521944f, 0.465746552f},
-std::array<float,2>{0.715023458f, 0.661345184f},
-std::array<float,2>{0.893910885f, 0.109949775f},
-std::array<float,2>{0.482108623f, 0.965894878f},
-std::array<float,2>{0.263901681f, 0.428717762f},
-std::array<float,2>{0.776865959f, 0.708822906f},
-std::array<float,2>{0.54376483f, 0.0569004901f},
-std::array<float,2>{0.247907251f, 0.925298095f},
-std::array<float,2>{0.00210254546f, 0.219890416f},
-std::array<float,2>{0.677931249f, 0.76987648f},
-std::array<float,2>{0.99440223f, 0.295474112f},
-std::array<float,2>{0.402897686f, 0.570324898f},
-std::array<float,2>{0.443123221f, 0.0802214444f},
-std::array<float,2>{0.935916483f, 0.975079536f},
-std::array<float,2>{0.730765402f, 0.494315326f},
-std::array<float,2>{0.0990391448f, 0.628056347f},
-std::array<float,2>{0.150439411f, 0.345950335f},
-std::array<float,2>{0.569997966f, 0.551620007f},
-std::array<float,2>{0.836724102f, 0.140672147f},
-std::array<float,2>{0.356369346f, 0.861591876f},
-std::array<float,2>{0.391250163f, 0.399599522f},
-std::array<float,2>{0.992049634f, 0.749899924f},
-std::array<float,2>{0.685303509f, 0.0292038452f},
-std::array<float,2>{0.0136373509f, 0.899491906f},
-std::array<float,2>{0.236543015f, 0.19949232f},
-std::array<float,2>{0.534363449f, 0.782737792f},
-std::array<float,2>{0.771658778f, 0.261809409f},
-std::array<float,2>{0.251068205f, 0.607298613f},
-std::array<float,2>{0.348861367f, 0.119054556f},
-std::array<float,2>{0.829650223f, 0.957165301f},
-std::array<float,2>{0.57492739f, 0.457855046f},
-std::array<float,2>{0.147096232f, 0.666673362f},
-std::array<float,2>{0.108645126f, 0.312867224f},
-std::array<float,2>{0.723887563f, 0.509702623f},
-std::array<float,2>{0.927020252f, 0.182280853f},
-std::array<float,2>{0.450255901f, 0.841668785f},
-std::array<float,2>{0.304726452f, 0.286435455f},
-std::array<float,2>{0.785370469f, 0.562562525f},
-std::array<float,2>{0.515236437f, 0.228448629f},
-std::array<float,2>{0.201613367f, 0.780892253f},
-std::array<float,2>{0.0339217559f, 0.0511803068f},
-std::array<float,2>{0.628342688f, 0.931311667f},
-std::array<float,2>{0.946336687f, 0.431537211f},
-std::array<float,2>{0.423294753f, 0.717238963f},
-std::array<float,2>{0.473598957f, 0.148631737f},
-std::array<float,2>{0.901810288f, 0.873578727f},
-std::array<float,2>{0.703298032f, 0.354989767f},
-std::array<float,2>{0.0713548586f, 0.559261799f},
-std::array<float,2>{0.161805913f, 0.484976977f},
-std::array<float,2>{0.605515957f, 0.6337834f},
-std::array<float,2>{0.86345464f, 0.0862759352f},
-std::array<float,2>{0.332149953f, 0.979588747f},
-std::array<float,2>{0.454898804f, 0.365815341f},
-std::array<float,2>{0.915858448f, 0.532807708f},
-std::array<float,2>{0.74810189f, 0.137211323f},
-std::array<float,2>{0.124784112f, 0.856776476f},
-std::array<float,2>{0.135367528f, 0.0674801767f},
-std::array<float,2>{0.588489175f, 0.995678663f},
-std::array<float,2>{0.82380867f, 0.481500089f},
-std::array<float,2>{0.37328884f, 0.65322274f},
-std::array<float,2>{0.268782943f, 0.244393393f},
-std::array<float,2>{0.758580923f, 0.75698787f},
-std::array<float,2>{0.550897181f, 0.299932778f},
-std::array<float,2>{0.219800174f, 0.58712548f},
-std::array<float,2>{0.024292089f, 0.414547592f},
-std::array<float,2>{0.671045303f, 0.701703012f},
-std::array<float,2>{0.973083913f, 0.0430769324f},
-std::array<float,2>{0.383294672f, 0.921421111f},
-std::array<float,2>{0.325967133f, 0.447553337f},
-std::array<float,2>{0.859137416f, 0.677357972f},
-std::array<float,2>{0.619942069f, 0.106003441f},
-std::array<float,2>{0.178874299f, 0.947651505f},
-std::array<float,2>{0.0837177932f, 0.170062855f},
-std::array<float,2>{0.699660122f, 0.823989987f},
-std::array<float,2>{0.876483142f, 0.342977077f},
-std::array<float,2>{0.489903539f, 0.522732377f},
-std::array<float,2>{0.415154785f, 0.0106117465f},
-std::array<float,2>{0.962225139f, 0.876803935f},
-std::array<float,2>{0.646788776f, 0.383628339f},
-std::array<float,2>{0.0567227527f, 0.734110594f},
-std::array<float,2>{0.215858996f, 0.277116656f},
-std::array<float,2>{0.526139796f, 0.621505082f},
-std::array<float,2>{0.803483188f, 0.207170054f},
-std::array<float,2>{0.296762288f, 0.80161804f},
-std::array<float,2>{0.446718037f, 0.410759956f},
-std::array<float,2>{0.924286425f, 0.691513479f},
-std::array<float,2>{0.721150279f, 0.0340829343f},
-std::array<float,2>{0.102566071f, 0.911416948f},
-std::array<float,2>{0.142862186f, 0.23662895f},
-std::array<float,2>{0.573723018f, 0.759706616f},
-std::array<float,2>{0.834605575f, 0.307424933f},
-std::array<float,2>{0.344687462f, 0.584749997f},
-std::array<float,2>{0.257634461f, 0.0715495795f},
-std::array<float,2>{0.769139886f, 0.98498112f},
-std::array<float,2>{0.536738455f, 0.470963657f},
-std::array<float,2>{0.241029307f, 0.640708685f},
-std::array<float,2>{0.00796371792f, 0.373783499f},
-std::array<float,2>{0.683312178f, 0.545316935f},
-std::array<float,2>{0.987245202f, 0.130437344f},
-std::array<float,2>{0.39511466f, 0.847897053f},
-std::array<float,2>{0.331364781f, 0.266068965f},
-std::array<float,2>{0.862220526f, 0.610586822f},
-std::array<float,2>{0.604947925f, 0.215491399f},
-std::array<float,2>{0.158662736f, 0.807167053f},
-std::array<float,2>{0.0779593736f, 0.00606741756f},
-std::array<float,2>{0.709952593f, 0.890612066f},
-std::array<float,2>{0.902714491f, 0.377548814f},
-std::array<float,2>{0.470878541f, 0.724202216f},
-std::array<float,2>{0.428266764f, 0.163493857f},
-std::array<float,2>{0.951657772f, 0.814925313f},
-std::array<float,2>{0.631353855f, 0.329316139f},
-std::array<float,2>{0.0375748612f, 0.524668157f},
-std::array<float,2>{0.196606368f, 0.444118679f},
-std::array<float,2>{0.511356235f, 0.682866573f},
-std::array<float,2>{0.781347036f, 0.0991051272f},
-std::array<float,2>{0.309509039f, 0.942781806f},
-std::array<float,2>{0.390523225f, 0.320732087f},
-std::array<float,2>{0.970351636f, 0.501628339f},
-std::array<float,2>{0.666199267f, 0.173128977f},
-std::array<float,2>{0.0297915582f, 0.831296742f},
-std::array<float,2>{0.222952902f, 0.1156542f},
-std::array<float,2>{0.549438477f, 0.962423027f},
-std::array<float,2>{0.76213342f, 0.463049024f},
-std::array<float,2>{0.272630066f, 0.659261882f},
-std::array<float,2>{0.369166136f, 0.191478044f},
-std::array<float,2>{0.827347696f, 0.792963266f},
-std::array<float,2>{0.592983603f, 0.251347989f},
-std::array<float,2>{0.138782084f, 0.597326279f},
-std::array<float,2>{0.119031049f, 0.39119038f},
-std::array<float,2>{0.74485302f, 0.738432109f},
-std::array<float,2>{0.921451688f, 0.0201231595f},
-std::array<float,2>{0.457451344f, 0.897592902f},
-std::array<float,2>{0.290447265f, 0.499134392f},
-std::array<float,2>{0.80028528f, 0.62966001f},
-std::array<float,2>{0.530482411f, 0.0851708055f},
-std::array<float,2>{0.214558378f, 0.972174823f},
-std::array<float,2>{0.0617341623f, 0.146955162f},
-std::array<float,2>{0.642809212f, 0.863768399f},
-std::array<float,2>{0.968628645f, 0.347673386f},
-std::array<float,2>{0.421377808f, 0.547614634f},
-std::array<float,2>{0.487939268f, 0.059812624f},
-std::array<float,2>{0.881008983f, 0.928264141f},
-std::array<float,2>{0.698486149f, 0.422695756f},
-std::array<float,2>{0.080049403f, 0.706279337f},
-std::array<float,2>{0.174611017f, 0.291500151f},
-std::array<float,2>{0.623684347f, 0.576612473f},
-std::array<float,2>{0.85252136f, 0.222946063f},
-std::array<float,2>{0.320691615f, 0.765630007f},
-std::array<float,2>{0.410533279f, 0.454176843f},
-std::array<float,2>{0.959377468f, 0.668469906f},
-std::array<float,2>{0.651596189f, 0.124321632f},
-std::array<float,2>{0.0527331866f, 0.955564201f},
-std::array<float,2>{0.203832537f, 0.185524017f},
-std::array<float,2>{0.517081439f, 0.836794257f},
-std::array<float,2>{0.811009705f, 0.317756087f},
-std::array<float,2>{0.283316791f, 0.51419431f},
-std::array<float,2>{0.317849427f, 0.0235228688f},
-std::array<float,2>{0.848361313f, 0.904149175f},
-std::array<float,2>{0.613096535f, 0.404981852f},
-std::array<float,2>{0.187143117f, 0.744301736f},
-std::array<float,2>{0.0927380845f, 0.258749008f},
-std::array<float,2>{0.695091248f, 0.604630053f},
-std::array<float,2>{0.884241998f, 0.195374906f},
-std::array<float,2>{0.496882647f, 0.788918555f},
-std::array<float,2>{0.280218959f, 0.356164128f},
-std::array<float,2>{0.751312971f, 0.557251394f},
-std::array<float,2>{0.559154093f, 0.155774802f},
-std::array<float,2>{0.229033008f, 0.868208468f},
-std::array<float,2>{0.0165464412f, 0.0908708349f},
-std::array<float,2>{0.656602263f, 0.984344482f},
-std::array<float,2>{0.983668327f, 0.489730388f},
-std::array<float,2>{0.380906284f, 0.64054805f},
-std::array<float,2>{0.467885643f, 0.233483359f},
-std::array<float,2>{0.911252141f, 0.77652359f},
-std::array<float,2>{0.735612988f, 0.281660706f},
-std::array<float,2>{0.11089687f, 0.567721784f},
-std::array<float,2>{0.126649752f, 0.434084326f},
-std::array<float,2>{0.578568995f, 0.714826286f},
-std::array<float,2>{0.816418767f, 0.0473578833f},
-std::array<float,2>{0.366940409f, 0.936248124f},
-std::array<float,2>{0.477879286f, 0.302710176f},
-std::array<float,2>{0.89800334f, 0.590980768f},
-std::array<float,2>{0.712441921f, 0.247292206f},
-std::array<float,2>{0.0671892837f, 0.750255227f},
-std::array<float,2>{0.168173164f, 0.0394103453f},
-std::array<float,2>{0.597116053f, 0.917607486f},
-std::array<float,2>{0.871836305f, 0.419531971f},
-std::array<float,2>{0.338264912f, 0.698945761f},
-std::array<float,2>{0.298479617f, 0.133461863f},
-std::array<float,2>{0.795893848f, 0.853095293f},
-std::array<float,2>{0.50006628f, 0.361255974f},
-std::array<float,2>{0.188965589f, 0.536180556f},
-std::array<float,2>{0.0420265161f, 0.477955341f},
-std::array<float,2>{0.633382201f, 0.651981711f},
-std::array<float,2>{0.94031173f, 0.0631017759f},
-std::array<float,2>{0.437285274f, 0.999364376f},
-std::array<float,2>{0.355448186f, 0.390576959f},
-std::array<float,2>{0.841661096f, 0.726808667f},
-std::array<float,2>{0.5655334f, 0.0147549137f},
-std::array<float,2>{0.154669628f, 0.882724762f},
-std::array<float,2>{0.0974043384f, 0.205403149f},
-std::array<float,2>{0.726746857f, 0.800271392f},
-std::array<float,2>{0.932154059f, 0.277830839f},
-std::array<float,2>{0.438329369f, 0.617606342f},
-std::array<float,2>{0.401878834f, 0.1045371f},
-std::array<float,2>{0.998812973f, 0.952851593f},
-std::array<float,2>{0.674433827f, 0.449530721f},
-std::array<float,2>{0.00760813802f, 0.674533308f},
-std::array<float,2>{0.242353186f, 0.336376548f},
-std::array<float,2>{0.540935218f, 0.516166687f},
-std::array<float,2>{0.777411699f, 0.165871888f},
-std::array<float,2>{0.258438438f, 0.825324118f},
-std::array<float,2>{0.460971117f, 0.440031409f},
-std::array<float,2>{0.907486379f, 0.685032487f},
-std::array<float,2>{0.739987314f, 0.0938764885f},
-std::array<float,2>{0.116017312f, 0.941058278f},
-std::array<float,2>{0.130754173f, 0.158561394f},
-std::array<float,2>{0.584943891f, 0.817981064f},
-std::array<float,2>{0.813100576f, 0.332311809f},
-std::array<float,2>{0.36175555f, 0.527774036f},
-std::array<float,2>{0.273520797f, 0.000417869422f},
-std::array<float,2>{0.75480932f, 0.883507848f},
-std::array<float,2>{0.555765748f, 0.382013083f},
-std::array<float,2>{0.233030438f, 0.722218454f},
-std::array<float,2>{0.0219077505f, 0.270062178f},
-std::array<float,2>{0.661227942f, 0.615513384f},
-std::array<float,2>{0.977479041f, 0.212936714f},
-std::array<float,2>{0.377978712f, 0.809684932f},
-std::array<float,2>{0.316013187f, 0.368786305f},
-std::array<float,2>{0.845623851f, 0.541092098f},
-std::array<float,2>{0.616390944f, 0.126803681f},
-std::array<float,2>{0.17985028f, 0.846929729f},
-std::array<float,2>{0.0877304077f, 0.0756053403f},
-std::array<float,2>{0.688262284f, 0.989177942f},
-std::array<float,2>{0.887266695f, 0.472669512f},
-std::array<float,2>{0.495417953f, 0.645517588f},
-std::array<float,2>{0.407966077f, 0.238758549f},
-std::array<float,2>{0.954032004f, 0.764687419f},
-std::array<float,2>{0.655969977f, 0.311736912f},
-std::array<float,2>{0.0503956713f, 0.580490172f},
-std::array<float,2>{0.209927484f, 0.409212053f},
-std::array<float,2>{0.519806027f, 0.687928438f},
-std::array<float,2>{0.808422327f, 0.0377543047f},
-std::array<float,2>{0.286415279f, 0.908346891f},
-std::array<float,2>{0.405748188f, 0.293652147f},
-std::array<float,2>{0.992963791f, 0.574019194f},
-std::array<float,2>{0.676740229f, 0.222304597f},
-std::array<float,2>{0.000373514631f, 0.773383081f},
-std::array<float,2>{0.249098703f, 0.0562344044f},
-std::array<float,2>{0.546613514f, 0.922835231f},
-std::array<float,2>{0.773505688f, 0.426534504f},
-std::array<float,2>{0.262356162f, 0.710547149f},
-std::array<float,2>{0.357660532f, 0.144478887f},
-std::array<float,2>{0.83950752f, 0.859449327f},
-std::array<float,2>{0.56663686f, 0.345119029f},
-std::array<float,2>{0.150199339f, 0.554304123f},
-std::array<float,2>{0.0998669043f, 0.492795348f},
-std::array<float,2>{0.733673334f, 0.625218809f},
-std::array<float,2>{0.934083402f, 0.0786234587f},
-std::array<float,2>{0.444535851f, 0.973412514f},
-std::array<float,2>{0.302424341f, 0.395227075f},
-std::array<float,2>{0.789786041f, 0.737566948f},
-std::array<float,2>{0.505492032f, 0.0176467486f},
-std::array<float,2>{0.194277227f, 0.89310056f},
-std::array<float,2>{0.0448170081f, 0.191086873f},
-std::array<float,2>{0.639419258f, 0.795268118f},
-std::array<float,2>{0.944237351f, 0.257573217f},
-std::array<float,2>{0.431531966f, 0.598254621f},
-std::array<float,2>{0.482523739f, 0.112416096f},
-std::array<float,2>{0.891706824f, 0.967965126f},
-std::array<float,2>{0.718732417f, 0.467175722f},
-std::array<float,2>{0.0654694438f, 0.663876832f},
-std::array<float,2>{0.164478675f, 0.3257263f},
-std::array<float,2>{0.598487079f, 0.505866349f},
-std::array<float,2>{0.867910802f, 0.178421602f},
-std::array<float,2>{0.342404693f, 0.833625853f},
-std::array<float,2>{0.424169689f, 0.43200615f},
-std::array<float,2>{0.948116064f, 0.71562475f},
-std::array<float,2>{0.626169443f, 0.053865023f},
-std::array<float,2>{0.0328084975f, 0.933095574f},
-std::array<float,2>{0.199947506f, 0.229721427f},
-std::array<float,2>{0.513555467f, 0.778223395f},
-std::array<float,2>{0.788205981f, 0.287588954f},
-std::array<float,2>{0.307990462f, 0.565621674f},
-std::array<float,2>{0.334780246f, 0.0887311175f},
-std::array<float,2>{0.865434587f, 0.97742331f},
-std::array<float,2>{0.607575715f, 0.487483442f},
-std::array<float,2>{0.163428992f, 0.635827661f},
-std::array<float,2>{0.073914133f, 0.352111101f},
-std::array<float,2>{0.705939889f, 0.560605586f},
-std::array<float,2>{0.899698377f, 0.151012331f},
-std::array<float,2>{0.475182146f, 0.871285677f},
-std::array<float,2>{0.252701342f, 0.264285684f},
-std::array<float,2>{0.769779623f, 0.609232903f},
-std::array<float,2>{0.531839788f, 0.201293498f},
-std::array<float,2>{0.235069752f, 0.783809721f},
-std::array<float,2>{0.0137871597f, 0.0304844063f},
-std::array<float,2>{0.68747741f, 0.901662111f},
-std::array<float,2>{0.988957763f, 0.40100655f},
-std::array<float,2>{0.393981636f, 0.74762243f},
-std::array<float,2>{0.451725483f, 0.179915041f},
-std::array<float,2>{0.929353118f, 0.841929674f},
-std::array<float,2>{0.726508737f, 0.315091103f},
-std::array<float,2>{0.10601037f, 0.510420084f},
-std::array<float,2>{0.144547328f, 0.460556149f},
-std::array<float,2>{0.577653944f, 0.664225459f},
-std::array<float,2>{0.830274343f, 0.120575823f},
-std::array<float,2>{0.350459486f, 0.959550977f},
-std::array<float,2>{0.491083682f, 0.341635138f},
-std::array<float,2>{0.878415465f, 0.52055198f},
-std::array<float,2>{0.701208711f, 0.1685673f},
-std::array<float,2>{0.0848775506f, 0.822225451f},
-std::array<float,2>{0.175879523f, 0.108162887f},
-std::array<float,2>{0.617857933f, 0.946602702f},
-std::array<float,2>{0.857408047f, 0.446089715f},
-std::array<float,2>{0.326479971f, 0.678245604f},
-std::array<float,2>{0.294838816f, 0.210632041f},
-std::array<float,2>{0.801242471f, 0.802944541f},
-std::array<float,2>{0.525390446f, 0.274454564f},
-std::array<float,2>{0.217535689f, 0.62387079f},
-std::array<float,2>{0.0563653409f, 0.385151893f},
-std::array<float,2>{0.645736694f, 0.73092705f},
-std::array<float,2>{0.964506805f, 0.00956299528f},
-std::array<float,2>{0.416043282f, 0.877374589f},
-std::array<float,2>{0.37123394f, 0.484189808f},
-std::array<float,2>{0.820328236f, 0.655275404f},
-std::array<float,2>{0.586127162f, 0.0695802495f},
-std::array<float,2>{0.134631082f, 0.992730796f},
-std::array<float,2>{0.121308796f, 0.14005971f},
-std::array<float,2>{0.746550024f, 0.85816437f},
-std::array<float,2>{0.917517722f, 0.363495857f},
-std::array<float,2>{0.456646085f, 0.533695459f},
-std::array<float,2>{0.386353135f, 0.0462556332f},
-std::array<float,2>{0.975930333f, 0.918005228f},
-std::array<float,2>{0.669064343f, 0.417563349f},
-std::array<float,2>{0.0271875225f, 0.699236214f},
-std::array<float,2>{0.221766099f, 0.298687935f},
-std::array<float,2>{0.553871632f, 0.588290155f},
-std::array<float,2>{0.76003176f, 0.242712051f},
-std::array<float,2>{0.266827941f, 0.755793095f},
-std::array<float,2>{0.469862849f, 0.375051349f},
-std::array<float,2>{0.906183124f, 0.725336194f},
-std::array<float,2>{0.707786798f, 0.00535862846f},
-std::array<float,2>{0.0744575709f, 0.88861692f},
-std::array<float,2>{0.157917067f, 0.21718815f},
-std::array<float,2>{0.602436066f, 0.805917084f},
-std::array<float,2>{0.859759927f, 0.268180311f},
-std::array<float,2>{0.328524083f, 0.611788094f},
-std::array<float,2>{0.311478823f, 0.101036377f},
-std::array<float,2>{0.78365612f, 0.944782853f},
-std::array<float,2>{0.50867027f, 0.443114251f},
-std::array<float,2>{0.199199528f, 0.680325389f},
-std::array<float,2>{0.0359008648f, 0.331850916f},
-std::array<float,2>{0.630749941f, 0.526194096f},
-std::array<float,2>{0.949747443f, 0.161399737f},
-std::array<float,2>{0.426323593f, 0.813216507f},
-std::array<float,2>{0.34589082f, 0.305348217f},
-std::array<float,2>{0.833111048f, 0.583759725f},
-std::array<float,2>{0.571901917f, 0.235486165f},
-std::array<float,2>{0.140893981f, 0.759773016f},
-std::array<float,2>{0.104994729f, 0.0318695679f},
-std::array<float,2>{0.719043016f, 0.912854254f},
-std::array<float,2>{0.923771262f, 0.414062381f},
-std::array<float,2>{0.447873741f, 0.693441868f},
-std::array<float,2>{0.398287237f, 0.132077485f},
-std::array<float,2>{0.986221671f, 0.851293564f},
-std::array<float,2>{0.680614114f, 0.372858465f},
-std::array<float,2>{0.01015878f, 0.543765903f},
-std::array<float,2>{0.239499986f, 0.469499528f},
-std::array<float,2>{0.537897944f, 0.644481957f},
-std::array<float,2>{0.766890407f, 0.0725275576f},
-std::array<float,2>{0.255561888f, 0.987276852f},
-std::array<float,2>{0.419448137f, 0.349699557f},
-std::array<float,2>{0.965023696f, 0.549657226f},
-std::array<float,2>{0.641881824f, 0.145295247f},
-std::array<float,2>{0.0598581769f, 0.866740704f},
-std::array<float,2>{0.212148815f, 0.0830617845f},
-std::array<float,2>{0.528082192f, 0.968802869f},
-std::array<float,2>{0.797871113f, 0.496537447f},
-std::array<float,2>{0.292477638f, 0.631244957f},
-std::array<float,2>{0.322868228f, 0.22516109f},
-std::array<float,2>{0.85493654f, 0.768676996f},
-std::array<float,2>{0.62150985f, 0.290977061f},
-std::array<float,2>{0.172102436f, 0.575464785f},
-std::array<float,2>{0.0818892568f, 0.425379783f},
-std::array<float,2>{0.695726395f, 0.704775333f},
-std::array<float,2>{0.879233122f, 0.0615416542f},
-std::array<float,2>{0.486095101f, 0.926907063f},
-std::array<float,2>{0.271181762f, 0.46256128f},
-std::array<float,2>{0.765517831f, 0.656305611f},
-std::array<float,2>{0.547386169f, 0.113961808f},
-std::array<float,2>{0.225922406f, 0.9633075f},
-std::array<float,2>{0.0287958086f, 0.174529269f},
-std::array<float,2>{0.665296555f, 0.830050409f},
-std::array<float,2>{0.971647441f, 0.323575646f},
-std::array<float,2>{0.387004405f, 0.503195941f},
-std::array<float,2>{0.459788114f, 0.0231317263f},
-std::array<float,2>{0.918055832f, 0.896216393f},
-std::array<float,2>{0.743736863f, 0.393606663f},
-std::array<float,2>{0.119460128f, 0.741391957f},
-std::array<float,2>{0.137597397f, 0.252927095f},
-std::array<float,2>{0.590184152f, 0.59380424f},
-std::array<float,2>{0.824396968f, 0.194130465f},
-std::array<float,2>{0.368290484f, 0.790631115f},
-std::array<float,2>{0.380542427f, 0.492130905f},
-std::array<float,2>{0.981256902f, 0.637763441f},
-std::array<float,2>{0.658705413f, 0.0927749723f},
-std::array<float,2>{0.0192453489f, 0.981999815f},
-std::array<float,2>{0.228411183f, 0.152524456f},
-std::array<float,2>{0.561701775f, 0.870588362f},
-std::array<float,2>{0.752928734f, 0.358178794f},
-std::array<float,2>{0.277504474f, 0.556105912f},
-std::array<float,2>{0.365126878f, 0.0491991825f},
-std::array<float,2>{0.818440795f, 0.935528457f},
-std::array<float,2>{0.580281019f, 0.437158823f},
-std::array<float,2>{0.127242118f, 0.712540329f},
-std::array<float,2>{0.111330278f, 0.284583509f},
-std::array<float,2>{0.737155914f, 0.569791913f},
-std::array<float,2>{0.913500369f, 0.230893075f},
-std::array<float,2>{0.466754436f, 0.773957551f},
-std::array<float,2>{0.281797498f, 0.319805205f},
-std::array<float,2>{0.809396982f, 0.513509631f},
-std::array<float,2>{0.519101977f, 0.186319381f},
-std::array<float,2>{0.20609276f, 0.8385728f},
-std::array<float,2>{0.0535493307f, 0.122521497f},
-std::array<float,2>{0.650147021f, 0.953537703f},
-std::array<float,2>{0.957703531f, 0.455695391f},
-std::array<float,2>{0.412213057f, 0.670532227f},
-std::array<float,2>{0.498532057f, 0.197589442f},
-std::array<float,2>{0.886488557f, 0.786532998f},
-std::array<float,2>{0.691477716f, 0.261571288f},
-std::array<float,2>{0.0907894447f, 0.601883113f},
-std::array<float,2>{0.183611006f, 0.403092921f},
-std::array<float,2>{0.610756695f, 0.742617011f},
-std::array<float,2>{0.849922717f, 0.0255592726f},
-std::array<float,2>{0.318870097f, 0.904549658f},
-std::array<float,2>{0.440118581f, 0.279359668f},
-std::array<float,2>{0.929991305f, 0.619912982f},
-std::array<float,2>{0.728693783f, 0.204154328f},
-std::array<float,2>{0.0941027105f, 0.797620118f},
-std::array<float,2>{0.15397428f, 0.0122107165f},
-std::array<float,2>{0.564030409f, 0.880845308f},
-std::array<float,2>{0.843124449f, 0.386828035f},
-std::array<float,2>{0.352460086f, 0.730119765f},
-std::array<float,2>{0.260798603f, 0.167005792f},
-std::array<float,2>{0.78013432f, 0.826932788f},
-std::array<float,2>{0.541025162f, 0.339651763f},
-std::array<float,2>{0.245705947f, 0.517765582f},
-std::array<float,2>{0.00473244488f, 0.453050733f},
-std::array<float,2>{0.672115207f, 0.672663987f},
-std::array<float,2>{0.996863306f, 0.101826355f},
-std::array<float,2>{0.399644107f, 0.949272454f},
-std::array<float,2>{0.337718517f, 0.42152527f},
-std::array<float,2>{0.874162018f, 0.695672393f},
-std::array<float,2>{0.594136596f, 0.0415509529f},
-std::array<float,2>{0.171407819f, 0.914640844f},
-std::array<float,2>{0.0695121065f, 0.249256283f},
-std::array<float,2>{0.713132799f, 0.75351429f},
-std::array<float,2>{0.895914078f, 0.302744418f},
-std::array<float,2>{0.480449736f, 0.592922032f},
-std::array<float,2>{0.434852272f, 0.0657148883f},
-std::array<float,2>{0.93752569f, 0.996687531f},
-std::array<float,2>{0.636592269f, 0.479404092f},
-std::array<float,2>{0.040390864f, 0.648526311f},
-std::array<float,2>{0.191094875f, 0.362612128f},
-std::array<float,2>{0.502029717f, 0.538171589f},
-std::array<float,2>{0.793919802f, 0.136132538f},
-std::array<float,2>{0.299390644f, 0.853531539f},
-std::array<float,2>{0.489637405f, 0.44568488f},
-std::array<float,2>{0.8760432f, 0.678160012f},
-std::array<float,2>{0.700195134f, 0.107443713f},
-std::array<float,2>{0.0834212229f, 0.947073579f},
-std::array<float,2>{0.179654911f, 0.168174192f},
-std::array<float,2>{0.619513154f, 0.821361601f},
-std::array<float,2>{0.858767927f, 0.341087312f},
-std::array<float,2>{0.325677425f, 0.521377444f},
-std::array<float,2>{0.29606837f, 0.00922042597f},
-std::array<float,2>{0.803204894f, 0.877720952f},
-std::array<float,2>{0.525873959f, 0.385571718f},
-std::array<float,2>{0.216588035f, 0.731416881f},
-std::array<float,2>{0.057529293f, 0.275229186f},
-std::array<float,2>{0.647217274f, 0.623191655f},
-std::array<float,2>{0.962464571f, 0.210110396f},
-std::array<float,2>{0.415765435f, 0.803265035f},
-std::array<float,2>{0.373812824f, 0.363970697f},
-std::array<float,2>{0.823572934f, 0.533501744f},
-std::array<float,2>{0.588257849f, 0.140174314f},
-std::array<float,2>{0.134847477f, 0.857564986f},
-std::array<float,2>{0.124368429f, 0.0700199157f},
-std::array<float,2>{0.748702466f, 0.992319167f},
-std::array<float,2>{0.915091872f, 0.48369807f},
-std::array<float,2>{0.454151005f, 0.655831695f},
-std::array<float,2>{0.383448422f, 0.242203102f},
-std::array<float,2>{0.973472476f, 0.755158007f},
-std::array<float,2>{0.671560228f, 0.298156947f},
-std::array<float,2>{0.0237519145f, 0.588802278f},
-std::array<float,2>{0.220685303f, 0.417437285f},
-std::array<float,2>{0.551296592f, 0.7001068f},
-std::array<float,2>{0.757937729f, 0.0468140915f},
-std::array<float,2>{0.269339085f, 0.918827116f},
-std::array<float,2>{0.423433065f, 0.287656069f},
-std::array<float,2>{0.946943879f, 0.565987706f},
-std::array<float,2>{0.628815413f, 0.230325252f},
-std::array<float,2>{0.0336365029f, 0.777653039f},
-std::array<float,2>{0.202020377f, 0.054609865f},
-std::array<float,2>{0.515128851f, 0.933266878f},
-std::array<float,2>{0.785775304f, 0.432415396f},
-std::array<float,2>{0.305253744f, 0.715088844f},
-std::array<float,2>{0.332537889f, 0.150779754f},
-std::array<float,2>{0.864145815f, 0.87186867f},
-std::array<float,2>{0.606146932f, 0.351660192f},
-std::array<float,2>{0.161354765f, 0.561500549f},
-std::array<float,2>{0.0718937144f, 0.487845331f},
-std::array<float,2>{0.703854382f, 0.63654989f},
-std::array<float,2>{0.901868582f, 0.0881988779f},
-std::array<float,2>{0.472713798f, 0.976686478f},
-std::array<float,2>{0.251782954f, 0.400801539f},
-std::array<float,2>{0.772021353f, 0.747406602f},
-std::array<float,2>{0.534966469f, 0.0310769137f},
-std::array<float,2>{0.237049684f, 0.902090073f},
-std::array<float,2>{0.013150678f, 0.201829374f},
-std::array<float,2>{0.684995294f, 0.783313096f},
-std::array<float,2>{0.991485775f, 0.264067888f},
-std::array<float,2>{0.390701324f, 0.608809531f},
-std::array<float,2>{0.450762719f, 0.120755605f},
-std::array<float,2>{0.927733779f, 0.959471524f},
-std::array<float,2>{0.724376917f, 0.460280776f},
-std::array<float,2>{0.108965427f, 0.665020943f},
-std::array<float,2>{0.146601424f, 0.314548075f},
-std::array<float,2>{0.574615061f, 0.51009351f},
-std::array<float,2>{0.829122126f, 0.180427819f},
-std::array<float,2>{0.349217892f, 0.842714965f},
-std::array<float,2>{0.40248546f, 0.426011175f},
-std::array<float,2>{0.994935036f, 0.709964931f},
-std::array<float,2>{0.678660929f, 0.0558361933f},
-std::array<float,2>{0.00255660876f, 0.922288597f},
-std::array<float,2>{0.247461542f, 0.222042754f},
-std::array<float,2>{0.543280125f, 0.772723019f},
-std::array<float,2>{0.776375473f, 0.293186098f},
-std::array<float,2>{0.264510095f, 0.573645771f},
-std::array<float,2>{0.355936646f, 0.0783278123f},
-std::array<float,2>{0.836373866f, 0.972953379f},
-std::array<float,2>{0.569806278f, 0.492533922f},
-std::array<float,2>{0.150898531f, 0.625541687f},
-std::array<float,2>{0.0992261991f, 0.345612466f},
-std::array<float,2>{0.731262982f, 0.554020882f},
-std::array<float,2>{0.936465383f, 0.14401567f},
-std::array<float,2>{0.442576796f, 0.86019963f},
-std::array<float,2>{0.30416134f, 0.256953269f},
-std::array<float,2>{0.792593479f, 0.597911894f},
-std::array<float,2>{0.506173551f, 0.190613165f},
-std::array<float,2>{0.192417979f, 0.795878172f},
-std::array<float,2>{0.0457764156f, 0.0182380136f},
-std::array<float,2>{0.637474418f, 0.892793894f},
-std::array<float,2>{0.942363977f, 0.394929886f},
-std::array<float,2>{0.433369517f, 0.738002479f},
-std::array<float,2>{0.481549501f, 0.177803382f},
-std::array<float,2>{0.894303679f, 0.833375037f},
-std::array<float,2>{0.715506256f, 0.325618893f},
-std::array<float,2>{0.0641194955f, 0.506535053f},
-std::array<float,2>{0.166732565f, 0.467494398f},
-std::array<float,2>{0.600325644f, 0.663215995f},
-std::array<float,2>{0.869802058f, 0.11282254f},
-std::array<float,2>{0.341286093f, 0.968664646f},
-std::array<float,2>{0.463667452f, 0.332694858f},
-std::array<float,2>{0.908274412f, 0.527925074f},
-std::array<float,2>{0.74030906f, 0.159065232f},
-std::array<float,2>{0.114067122f, 0.817822456f},
-std::array<float,2>{0.132555485f, 0.0944332853f},
-std::array<float,2>{0.582274437f, 0.940760851f},
-std::array<float,2>{0.81599623f, 0.439763427f},
-std::array<float,2>{0.360194236f, 0.685439765f},
-std::array<float,2>{0.275803298f, 0.213648483f},
-std::array<float,2>{0.756614387f, 0.810538232f},
-std::array<float,2>{0.556644261f, 0.269720018f},
-std::array<float,2>{0.231976315f, 0.616208732f},
-std::array<float,2>{0.0205331258f, 0.382403314f},
-std::array<float,2>{0.663918138f, 0.722076714f},
-std::array<float,2>{0.979400992f, 0.000634800643f},
-std::array<float,2>{0.375716448f, 0.882890284f},
-std::array<float,2>{0.313571304f, 0.47323522f},
-std::array<float,2>{0.846881926f, 0.646024883f},
-std::array<float,2>{0.613519192f, 0.0759984031f},
-std::array<float,2>{0.18268162f, 0.988384366f},
-std::array<float,2>{0.0882832035f, 0.12632595f},
-std::array<float,2>{0.690547228f, 0.847335815f},
-std::array<float,2>{0.888692141f, 0.368428916f},
-std::array<float,2>{0.493465245f, 0.541890025f},
-std::array<float,2>{0.409972131f, 0.0373056158f},
-std::array<float,2>{0.955085754f, 0.908741951f},
-std::array<float,2>{0.653949618f, 0.409679621f},
-std::array<float,2>{0.0485523418f, 0.688079894f},
-std::array<float,2>{0.207578182f, 0.312201738f},
-std::array<float,2>{0.522775948f, 0.580706239f},
-std::array<float,2>{0.805979311f, 0.238812327f},
-std::array<float,2>{0.287210584f, 0.765298307f},
-std::array<float,2>{0.43774125f, 0.387684435f},
-std::array<float,2>{0.932059228f, 0.729528069f},
-std::array<float,2>{0.727344692f, 0.012012626f},
-std::array<float,2>{0.0970112681f, 0.880330384f},
-std::array<float,2>{0.154916346f, 0.204856858f},
-std::array<float,2>{0.566027939f, 0.797240674f},
-std::array<float,2>{0.84096843f, 0.280065566f},
-std::array<float,2>{0.354792148f, 0.619257748f},
-std::array<float,2>{0.257842898f, 0.102479249f},
-std::array<float,2>{0.778074205f, 0.949795485f},
-std::array<float,2>{0.540093303f, 0.452590346f},
-std::array<float,2>{0.242918104f, 0.672187686f},
-std::array<float,2>{0.00696100108f, 0.338869482f},
-std::array<float,2>{0.67383641f, 0.518159986f},
-std::array<float,2>{0.998126149f, 0.167823911f},
-std::array<float,2>{0.401496738f, 0.826643109f},
-std::array<float,2>{0.338766694f, 0.303530663f},
-std::array<float,2>{0.871513903f, 0.593542039f},
-std::array<float,2>{0.597466946f, 0.249586433f},
-std::array<float,2>{0.168852225f, 0.753238082f},
-std::array<float,2>{0.0665002167f, 0.0410837792f},
-std::array<float,2>{0.712304533f, 0.914252043f},
-std::array<float,2>{0.897792816f, 0.421046346f},
-std::array<float,2>{0.478384495f, 0.696071208f},
-std::array<float,2>{0.436707437f, 0.136651233f},
-std::array<float,2>{0.939766765f, 0.854472041f},
-std::array<float,2>{0.633188903f, 0.363033742f},
-std::array<float,2>{0.0427062437f, 0.538877666f},
-std::array<float,2>{0.188568234f, 0.478724182f},
-std::array<float,2>{0.500846267f, 0.649185181f},
-std::array<float,2>{0.795110643f, 0.0663995221f},
-std::array<float,2>{0.298085243f, 0.996522784f},
-std::array<float,2>{0.381448448f, 0.357862115f},
-std::array<float,2>{0.984368205f, 0.556497931f},
-std::array<float,2>{0.656971157f, 0.15291965f},
-std::array<float,2>{0.015978992f, 0.871003389f},
-std::array<float,2>{0.228735313f, 0.0936734751f},
-std::array<float,2>{0.55883348f, 0.981874645f},
-std::array<float,2>{0.751571715f, 0.491329342f},
-std::array<float,2>{0.279679447f, 0.638246119f},
-std::array<float,2>{0.36631754f, 0.231105596f},
-std::array<float,2>{0.817367256f, 0.773666263f},
-std::array<float,2>{0.579026282f, 0.285069138f},
-std::array<float,2>{0.126303151f, 0.570118308f},
-std::array<float,2>{0.110359237f, 0.436658889f},
-std::array<float,2>{0.736317992f, 0.712339401f},
-std::array<float,2>{0.911742628f, 0.0497844741f},
-std::array<float,2>{0.468653888f, 0.934937358f},
-std::array<float,2>{0.283745557f, 0.455243856f},
-std::array<float,2>{0.811470151f, 0.670173943f},
-std::array<float,2>{0.517440259f, 0.122847997f},
-std::array<float,2>{0.203313157f, 0.953839839f},
-std::array<float,2>{0.0522155389f, 0.186011061f},
-std::array<float,2>{0.651930511f, 0.838059127f},
-std::array<float,2>{0.959630489f, 0.319974661f},
-std::array<float,2>{0.410948515f, 0.51310581f},
-std::array<float,2>{0.496101886f, 0.0261630304f},
-std::array<float,2>{0.884509742f, 0.90503335f},
-std::array<float,2>{0.694424808f, 0.402549684f},
-std::array<float,2>{0.0920580551f, 0.743103206f},
-std::array<float,2>{0.186716795f, 0.260793656f},
-std::array<float,2>{0.612690628f, 0.602441072f},
-std::array<float,2>{0.847944677f, 0.197838366f},
-std::array<float,2>{0.318273932f, 0.787035227f},
-std::array<float,2>{0.421543598f, 0.497042149f},
-std::array<float,2>{0.968102396f, 0.631643772f},
-std::array<float,2>{0.64354372f, 0.0836131573f},
-std::array<float,2>{0.0622964762f, 0.969283104f},
-std::array<float,2>{0.214189455f, 0.14468272f},
-std::array<float,2>{0.531193137f, 0.866585553f},
-std::array<float,2>{0.800618589f, 0.350475639f},
-std::array<float,2>{0.290664613f, 0.549242258f},
-std::array<float,2>{0.321288228f, 0.0620800965f},
-std::array<float,2>{0.851760745f, 0.927626371f},
-std::array<float,2>{0.623350084f, 0.42516458f},
-std::array<float,2>{0.173881516f, 0.704446197f},
-std::array<float,2>{0.0793076679f, 0.29042533f},
-std::array<float,2>{0.6990031f, 0.576042295f},
-std::array<float,2>{0.881640971f, 0.224723965f},
-std::array<float,2>{0.487687439f, 0.769172192f},
-std::array<float,2>{0.273010105f, 0.323969066f},
-std::array<float,2>{0.762235701f, 0.503842235f},
-std::array<float,2>{0.549246013f, 0.173849195f},
-std::array<float,2>{0.223264605f, 0.829320014f},
-std::array<float,2>{0.0294245314f, 0.113705963f},
-std::array<float,2>{0.666844785f, 0.963526785f},
-std::array<float,2>{0.969933212f, 0.462385923f},
-std::array<float,2>{0.389700621f, 0.657000601f},
-std::array<float,2>{0.457830727f, 0.193595186f},
-std::array<float,2>{0.92093879f, 0.790396512f},
-std::array<float,2>{0.744550765f, 0.252091318f},
-std::array<float,2>{0.11824318f, 0.594716549f},
-std::array<float,2>{0.13916789f, 0.394158155f},
-std::array<float,2>{0.593385458f, 0.741946042f},
-std::array<float,2>{0.827752948f, 0.0228677485f},
-std::array<float,2>{0.369912237f, 0.895838737f},
-std::array<float,2>{0.471365422f, 0.267656267f},
-std::array<float,2>{0.903083563f, 0.612010479f},
-std::array<float,2>{0.709292591f, 0.217664048f},
-std::array<float,2>{0.0774146616f, 0.806259274f},
-std::array<float,2>{0.158932731f, 0.00576461153f},
-std::array<float,2>{0.605090916f, 0.888028383f},
-std::array<float,2>{0.861584902f, 0.375721097f},
-std::array<float,2>{0.331883311f, 0.724877f},
-std::array<float,2>{0.309071094f, 0.161943093f},
-std::array<float,2>{0.781769812f, 0.812672853f},
-std::array<float,2>{0.510878742f, 0.331071913f},
-std::array<float,2>{0.196879864f, 0.525433838f},
-std::array<float,2>{0.0379259326f, 0.442424119f},
-std::array<float,2>{0.631197155f, 0.679740965f},
-std::array<float,2>{0.951857328f, 0.101152629f},
-std::array<float,2>{0.428168386f, 0.944957852f},
-std::array<float,2>{0.344158262f, 0.413457006f},
-std::array<float,2>{0.834163785f, 0.694055915f},
-std::array<float,2>{0.574020624f, 0.0316353478f},
-std::array<float,2>{0.143167272f, 0.912266135f},
-std::array<float,2>{0.103137337f, 0.235890478f},
-std::array<float,2>{0.721437573f, 0.760478795f},
-std::array<float,2>{0.924397528f, 0.304845929f},
-std::array<float,2>{0.446957558f, 0.583081484f},
-std::array<float,2>{0.394740522f, 0.0728866532f},
-std::array<float,2>{0.986542344f, 0.986632466f},
-std::array<float,2>{0.682630301f, 0.469127744f},
-std::array<float,2>{0.00873788446f, 0.643993139f},
-std::array<float,2>{0.240430638f, 0.372406006f},
-std::array<float,2>{0.536226809f, 0.543022633f},
-std::array<float,2>{0.768838048f, 0.132787272f},
-std::array<float,2>{0.257215768f, 0.851054132f},
-std::array<float,2>{0.456505567f, 0.482367098f},
-std::array<float,2>{0.917338312f, 0.652481794f},
-std::array<float,2>{0.746725202f, 0.0679203868f},
-std::array<float,2>{0.122003332f, 0.995289803f},
-std::array<float,2>{0.133969396f, 0.137159958f},
-std::array<float,2>{0.586663783f, 0.857224464f},
-std::array<float,2>{0.820992112f, 0.365686715f},
-std::array<float,2>{0.371931851f, 0.532665431f},
-std::array<float,2>{0.267550826f, 0.0437018499f},
-std::array<float,2>{0.760497749f, 0.921348512f},
-std::array<float,2>{0.554503083f, 0.414714843f},
-std::array<float,2>{0.222652674f, 0.701602936f},
-std::array<float,2>{0.0263687037f, 0.300531894f},
-std::array<float,2>{0.669516265f, 0.587533295f},
-std::array<float,2>{0.976261735f, 0.244982898f},
-std::array<float,2>{0.385811299f, 0.757729352f},
-std::array<float,2>{0.327122122f, 0.34366262f},
-std::array<float,2>{0.856671631f, 0.523168027f},
-std::array<float,2>{0.617373765f, 0.170687959f},
-std::array<float,2>{0.176725581f, 0.823482037f},
-std::array<float,2>{0.0842364877f, 0.105732955f},
-std::array<float,2>{0.701990664f, 0.947875381f},
-std::array<float,2>{0.878647208f, 0.447844565f},
-std::array<float,2>{0.490560383f, 0.676900744f},
-std::array<float,2>{0.416978955f, 0.207697719f},
-std::array<float,2>{0.96392417f, 0.800946474f},
-std::array<float,2>{0.646041691f, 0.276562512f},
-std::array<float,2>{0.05576884f, 0.621634305f},
-std::array<float,2>{0.216967225f, 0.38291198f},
-std::array<float,2>{0.524674475f, 0.733496368f},
-std::array<float,2>{0.801752806f, 0.0100576021f},
-std::array<float,2>{0.294078827f, 0.876057088f},
-std::array<float,2>{0.394524157f, 0.262585104f},
-std::array<float,2>{0.988698304f, 0.6066432f},
-std::array<float,2>{0.686703324f, 0.200100139f},
-std::array<float,2>{0.014450266f, 0.782705426f},
-std::array<float,2>{0.234801859f, 0.028653346f},
-std::array<float,2>{0.53151077f, 0.900097668f},
-std::array<float,2>{0.77038306f, 0.400073588f},
-std::array<float,2>{0.251983464f, 0.749224305f},
-std::array<float,2>{0.349696755f, 0.181647599f},
-std::array<float,2>{0.830597639f, 0.841304183f},
-std::array<float,2>{0.577149034f, 0.313414752f},
-std::array<float,2>{0.145098612f, 0.509244144f},
-std::array<float,2>{0.105797276f, 0.457370013f},
-std::array<float,2>{0.725656509f, 0.66639787f},
-std::array<float,2>{0.928951144f, 0.118169524f},
-std::array<float,2>{0.451657891f, 0.95759511f},
-std::array<float,2>{0.308277577f, 0.431048036f},
-std::array<float,2>{0.788867056f, 0.71740967f},
-std::array<float,2>{0.512927115f, 0.0513899326f},
-std::array<float,2>{0.199426174f, 0.931052923f},
-std::array<float,2>{0.0324009694f, 0.227974519f},
-std::array<float,2>{0.626940429f, 0.780539393f},
-std::array<float,2>{0.947650135f, 0.287045002f},
-std::array<float,2>{0.424757063f, 0.563107073f},
-std::array<float,2>{0.474932432f, 0.0868561268f},
-std::array<float,2>{0.900114596f, 0.98017329f},
-std::array<float,2>{0.705323756f, 0.484678566f},
-std::array<float,2>{0.0735620707f, 0.633118153f},
-std::array<float,2>{0.163643062f, 0.354492664f},
-std::array<float,2>{0.608014941f, 0.558896661f},
-std::array<float,2>{0.866111815f, 0.149237633f},
-std::array<float,2>{0.334038436f, 0.873339832f},
-std::array<float,2>{0.430709511f, 0.397520959f},
-std::array<float,2>{0.943840861f, 0.734872818f},
-std::array<float,2>{0.639079869f, 0.016540464f},
-std::array<float,2>{0.0443347692f, 0.891122162f},
-std::array<float,2>{0.193400487f, 0.188414052f},
-std::array<float,2>{0.505017459f, 0.794515133f},
-std::array<float,2>{0.7894696f, 0.25481236f},
-std::array<float,2>{0.30218786f, 0.600455105f},
-std::array<float,2>{0.34197551f, 0.109794594f},
-std::array<float,2>{0.86742717f, 0.966316223f},
-std::array<float,2>{0.597895265f, 0.465069443f},
-std::array<float,2>{0.164731652f, 0.661817789f},
-std::array<float,2>{0.0660913289f, 0.327784419f},
-std::array<float,2>{0.718041658f, 0.504030406f},
-std::array<float,2>{0.892357051f, 0.177592769f},
-std::array<float,2>{0.483242095f, 0.8343575f},
-std::array<float,2>{0.261848301f, 0.295379579f},
-std::array<float,2>{0.774400532f, 0.571200848f},
-std::array<float,2>{0.546206415f, 0.220404148f},
-std::array<float,2>{0.249813855f, 0.77009517f},
-std::array<float,2>{0.000917528057f, 0.0573738329f},
-std::array<float,2>{0.676030993f, 0.925086915f},
-std::array<float,2>{0.992415786f, 0.429408699f},
-std::array<float,2>{0.406051397f, 0.708493054f},
-std::array<float,2>{0.445058942f, 0.141330123f},
-std::array<float,2>{0.933957875f, 0.862170458f},
-std::array<float,2>{0.733991265f, 0.346619725f},
-std::array<float,2>{0.100319147f, 0.551115632f},
-std::array<float,2>{0.14985998f, 0.494692326f},
-std::array<float,2>{0.566992044f, 0.628435731f},
-std::array<float,2>{0.839038014f, 0.0808278099f},
-std::array<float,2>{0.358302355f, 0.975472271f},
-std::array<float,2>{0.495989919f, 0.369776547f},
-std::array<float,2>{0.886934757f, 0.539101005f},
-std::array<float,2>{0.687605858f, 0.128715456f},
-std::array<float,2>{0.0869705454f, 0.84523046f},
-std::array<float,2>{0.180322245f, 0.0766177401f},
-std::array<float,2>{0.616859555f, 0.991722584f},
-std::array<float,2>{0.845004499f, 0.476335704f},
-std::array<float,2>{0.315600604f, 0.647649169f},
-std::array<float,2>{0.286749482f, 0.240869462f},
-std::array<float,2>{0.808028877f, 0.761730313f},
-std::array<float,2>{0.520096421f, 0.309221536f},
-std::array<float,2>{0.209211603f, 0.578994036f},
-std::array<float,2>{0.0499173291f, 0.407053232f},
-std::array<float,2>{0.655595422f, 0.68982023f},
-std::array<float,2>{0.953514636f, 0.0365370065f},
-std::array<float,2>{0.407394081f, 0.907824159f},
-std::array<float,2>{0.362025559f, 0.438664675f},
-std::array<float,2>{0.812943459f, 0.687113583f},
-std::array<float,2>{0.58400929f, 0.0975431874f},
-std::array<float,2>{0.130318344f, 0.937884092f},
-std::array<float,2>{0.115245417f, 0.158026159f},
-std::array<float,2>{0.739689052f, 0.819353223f},
-std::array<float,2>{0.907726467f, 0.33533141f},
-std::array<float,2>{0.461856186f, 0.529851258f},
-std::array<float,2>{0.378697544f, 0.00231648609f},
-std::array<float,2>{0.976970553f, 0.884777665f},
-std::array<float,2>{0.661863863f, 0.378978193f},
-std::array<float,2>{0.0223582331f, 0.719530761f},
-std::array<float,2>{0.232621089f, 0.271567941f},
-std::array<float,2>{0.556586385f, 0.614140809f},
-std::array<float,2>{0.754317403f, 0.212210909f},
-std::array<float,2>{0.2742818f, 0.81060642f},
-std::array<float,2>{0.479967654f, 0.419028968f},
-std::array<float,2>{0.896310151f, 0.698265016f},
-std::array<float,2>{0.713572443f, 0.0395673327f},
-std::array<float,2>{0.0700561106f, 0.917410731f},
-std::array<float,2>{0.170989439f, 0.247862339f},
-std::array<float,2>{0.594268024f, 0.750882089f},
-std::array<float,2>{0.874544382f, 0.301883847f},
-std::array<float,2>{0.33713755f, 0.591507018f},
-std::array<float,2>{0.299117655f, 0.0625310019f},
-std::array<float,2>{0.793075085f, 0.999925613f},
-std::array<float,2>{0.502587974f, 0.478132188f},
-std::array<float,2>{0.190576807f, 0.651479244f},
-std::array<float,2>{0.0408617668f, 0.360421598f},
-std::array<float,2>{0.635885358f, 0.537007153f},
-std::array<float,2>{0.938445747f, 0.132997885f},
-std::array<float,2>{0.435459554f, 0.852556348f},
-std::array<float,2>{0.351893187f, 0.278282553f},
-std::array<float,2>{0.843605816f, 0.617996454f},
-std::array<float,2>{0.563575566f, 0.205651358f},
-std::array<float,2>{0.153483421f, 0.800680041f},
-std::array<float,2>{0.0943139791f, 0.0154839773f},
-std::array<float,2>{0.729063094f, 0.881931663f},
-std::array<float,2>{0.930193365f, 0.38965261f},
-std::array<float,2>{0.439487547f, 0.727073312f},
-std::array<float,2>{0.400368869f, 0.165486977f},
-std::array<float,2>{0.996539354f, 0.826063693f},
-std::array<float,2>{0.672748268f, 0.336435676f},
-std::array<float,2>{0.00420416985f, 0.515982211f},
-std::array<float,2>{0.245409742f, 0.449825257f},
-std::array<float,2>{0.541655123f, 0.674048424f},
-std::array<float,2>{0.779450893f, 0.105099335f},
-std::array<float,2>{0.261358321f, 0.952396393f},
-std::array<float,2>{0.412875086f, 0.317934483f},
-std::array<float,2>{0.957076252f, 0.513917744f},
-std::array<float,2>{0.649455309f, 0.184733093f},
-std::array<float,2>{0.05302874f, 0.836247444f},
-std::array<float,2>{0.206992716f, 0.124576792f},
-std::array<float,2>{0.518815279f, 0.955569208f},
-std::array<float,2>{0.808784544f, 0.454712272f},
-std::array<float,2>{0.281649172f, 0.668080151f},
-std::array<float,2>{0.318749905f, 0.196176082f},
-std::array<float,2>{0.850282907f, 0.788226604f},
-std::array<float,2>{0.611327171f, 0.258235365f},
-std::array<float,2>{0.184382826f, 0.605217755f},
-std::array<float,2>{0.0899248198f, 0.404527903f},
-std::array<float,2>{0.691933751f, 0.744983017f},
-std::array<float,2>{0.886018038f, 0.024355717f},
-std::array<float,2>{0.499008477f, 0.903782487f},
-std::array<float,2>{0.278044015f, 0.490223408f},
-std::array<float,2>{0.752215624f, 0.639717937f},
-std::array<float,2>{0.562315881f, 0.0917079225f},
-std::array<float,2>{0.227644846f, 0.983693719f},
-std::array<float,2>{0.0190395769f, 0.155478016f},
-std::array<float,2>{0.658610463f, 0.868776679f},
-std::array<float,2>{0.980916083f, 0.355514437f},
-std::array<float,2>{0.380086958f, 0.557025135f},
-std::array<float,2>{0.466213852f, 0.0477831252f},
-std::array<float,2>{0.914012015f, 0.935869873f},
-std::array<float,2>{0.736734629f, 0.434043854f},
-std::array<float,2>{0.112038299f, 0.713874221f},
-std::array<float,2>{0.127738535f, 0.281738997f},
-std::array<float,2>{0.581008792f, 0.568095624f},
-std::array<float,2>{0.819000065f, 0.234256655f},
-std::array<float,2>{0.364701957f, 0.777163088f},
-std::array<float,2>{0.387518615f, 0.463495553f},
-std::array<float,2>{0.971122444f, 0.659896135f},
-std::array<float,2>{0.665711045f, 0.11594867f},
-std::array<float,2>{0.0289282594f, 0.962279499f},
-std::array<float,2>{0.226514235f, 0.173476726f},
-std::array<float,2>{0.547216117f, 0.831570268f},
-std::array<float,2>{0.764810979f, 0.321038514f},
-std::array<float,2>{0.27060917f, 0.501425803f},
-std::array<float,2>{0.368918031f, 0.0196512118f},
-std::array<float,2>{0.824810266f, 0.897967756f},
-std::array<float,2>{0.590687096f, 0.390930831f},
-std::array<float,2>{0.13699238f, 0.738884091f},
-std::array<float,2>{0.119988106f, 0.251533836f},
-std::array<float,2>{0.743406653f, 0.597167909f},
-std::array<float,2>{0.918929696f, 0.191944093f},
-std::array<float,2>{0.459036827f, 0.792307496f},
-std::array<float,2>{0.292777002f, 0.348341137f},
-std::array<float,2>{0.798348904f, 0.547145128f},
-std::array<float,2>{0.527480066f, 0.147077918f},
-std::array<float,2>{0.212677956f, 0.863989949f},
-std::array<float,2>{0.0601445921f, 0.0855194926f},
-std::array<float,2>{0.642284274f, 0.972088873f},
-std::array<float,2>{0.965606213f, 0.499615788f},
-std::array<float,2>{0.419126242f, 0.629059851f},
-std::array<float,2>{0.485353917f, 0.223419473f},
-std::array<float,2>{0.879767776f, 0.766370714f},
-std::array<float,2>{0.696039736f, 0.29181546f},
-std::array<float,2>{0.0811127499f, 0.576683998f},
-std::array<float,2>{0.172766879f, 0.422133207f},
-std::array<float,2>{0.621651053f, 0.706869364f},
-std::array<float,2>{0.855393529f, 0.0604857542f},
-std::array<float,2>{0.322742492f, 0.928018153f},
-std::array<float,2>{0.447597295f, 0.306889653f},
-std::array<float,2>{0.923290312f, 0.584310889f},
-std::array<float,2>{0.71926254f, 0.236906052f},
-std::array<float,2>{0.104750872f, 0.759184778f},
-std::array<float,2>{0.141559377f, 0.0335880034f},
-std::array<float,2>{0.571700215f, 0.911944509f},
-std::array<float,2>{0.833652079f, 0.410346806f},
-std::array<float,2>{0.346528798f, 0.69194597f},
-std::array<float,2>{0.255144358f, 0.130162999f},
-std::array<float,2>{0.767534137f, 0.848199904f},
-std::array<float,2>{0.537493944f, 0.373473614f},
-std::array<float,2>{0.239971653f, 0.5455603f},
-std::array<float,2>{0.0103046112f, 0.471542358f},
-std::array<float,2>{0.679885328f, 0.641284108f},
-std::array<float,2>{0.985561848f, 0.0722619072f},
-std::array<float,2>{0.397657901f, 0.984425902f},
-std::array<float,2>{0.329095602f, 0.377174228f},
-std::array<float,2>{0.860106587f, 0.724082708f},
-std::array<float,2>{0.60199827f, 0.00659597013f},
-std::array<float,2>{0.15766643f, 0.889955819f},
-std::array<float,2>{0.0750856549f, 0.215255365f},
-std::array<float,2>{0.707309067f, 0.806940079f},
-std::array<float,2>{0.905514598f, 0.266116589f},
-std::array<float,2>{0.470682234f, 0.611112833f},
-std::array<float,2>{0.426142663f, 0.0994054303f},
-std::array<float,2>{0.949534953f, 0.943042874f},
-std::array<float,2>{0.630103648f, 0.443640351f},
-std::array<float,2>{0.0355037637f, 0.683588505f},
-std::array<float,2>{0.198366255f, 0.329613656f},
-std::array<float,2>{0.507896423f, 0.524968922f},
-std::array<float,2>{0.783802927f, 0.163916737f},
-std::array<float,2>{0.310914159f, 0.815360248f},
-std::array<float,2>{0.473948956f, 0.485665351f},
-std::array<float,2>{0.901103914f, 0.634105444f},
-std::array<float,2>{0.704637408f, 0.0878838897f},
-std::array<float,2>{0.0709870383f, 0.979386568f},
-std::array<float,2>{0.160623953f, 0.150100395f},
-std::array<float,2>{0.607069194f, 0.874199212f},
-std::array<float,2>{0.86467123f, 0.353636444f},
-std::array<float,2>{0.333602786f, 0.560181499f},
-std::array<float,2>{0.30581075f, 0.0522662252f},
-std::array<float,2>{0.786313355f, 0.930246472f},
-std::array<float,2>{0.51410991f, 0.430000961f},
-std::array<float,2>{0.203024f, 0.718691349f},
-std::array<float,2>{0.0345945284f, 0.285248935f},
-std::array<float,2>{0.627640665f, 0.563856065f},
-std::array<float,2>{0.946271539f, 0.227397159f},
-std::array<float,2>{0.4221645f, 0.779721797f},
-std::array<float,2>{0.348089755f, 0.313937664f},
-std::array<float,2>{0.828838944f, 0.508426428f},
-std::array<float,2>{0.575729609f, 0.183142513f},
-std::array<float,2>{0.147726968f, 0.839850187f},
-std::array<float,2>{0.107991926f, 0.117661998f},
-std::array<float,2>{0.723080575f, 0.958475411f},
-std::array<float,2>{0.92643714f, 0.458035469f},
-std::array<float,2>{0.449461222f, 0.66738379f},
-std::array<float,2>{0.391633779f, 0.200643256f},
-std::array<float,2>{0.990727425f, 0.781661272f},
-std::array<float,2>{0.6838395f, 0.263515681f},
-std::array<float,2>{0.0122253262f, 0.605493426f},
-std::array<float,2>{0.23797296f, 0.398984194f},
-std::array<float,2>{0.533237338f, 0.748096645f},
-std::array<float,2>{0.772740245f, 0.0282604713f},
-std::array<float,2>{0.250958055f, 0.899015784f},
-std::array<float,2>{0.414311677f, 0.2758497f},
-std::array<float,2>{0.961714506f, 0.622775376f},
-std::array<float,2>{0.64795208f, 0.208151981f},
-std::array<float,2>{0.0583246201f, 0.802131653f},
-std::array<float,2>{0.214940637f, 0.0108459396f},
-std::array<float,2>{0.527287364f, 0.875652373f},
-std::array<float,2>{0.804424584f, 0.383801281f},
-std::array<float,2>{0.29514721f, 0.733097672f},
-std::array<float,2>{0.32459721f, 0.171342745f},
-std::array<float,2>{0.857703686f, 0.822845995f},
-std::array<float,2>{0.620359242f, 0.34239018f},
-std::array<float,2>{0.178699479f, 0.522279024f},
-std::array<float,2>{0.0828417242f, 0.448969007f},
-std::array<float,2>{0.701038301f, 0.676237345f},
-std::array<float,2>{0.875130355f, 0.106614597f},
-std::array<float,2>{0.489189357f, 0.948860109f},
-std::array<float,2>{0.268044174f, 0.415454924f},
-std::array<float,2>{0.759029567f, 0.702449024f},
-std::array<float,2>{0.552164435f, 0.0444451645f},
-std::array<float,2>{0.219670877f, 0.920606911f},
-std::array<float,2>{0.024929367f, 0.245736331f},
-std::array<float,2>{0.670561314f, 0.756010771f},
-std::array<float,2>{0.97459054f, 0.298942059f},
-std::array<float,2>{0.38452813f, 0.58622843f},
-std::array<float,2>{0.45398584f, 0.0666553304f},
-std::array<float,2>{0.91474539f, 0.99421072f},
-std::array<float,2>{0.749694705f, 0.481238157f},
-std::array<float,2>{0.123598628f, 0.654036105f},
-std::array<float,2>{0.136194915f, 0.366289884f},
-std::array<float,2>{0.589736521f, 0.531573832f},
-std::array<float,2>{0.822937071f, 0.138586983f},
-std::array<float,2>{0.374410659f, 0.855551124f},
-std::array<float,2>{0.376319587f, 0.380684942f},
-std::array<float,2>{0.980216026f, 0.720446408f},
-std::array<float,2>{0.66241312f, 0.00323219411f},
-std::array<float,2>{0.0199335348f, 0.886489213f},
-std::array<float,2>{0.231343791f, 0.211214036f},
-std::array<float,2>{0.558547616f, 0.812024415f},
-std::array<float,2>{0.757412374f, 0.273058742f},
-std::array<float,2>{0.276401699f, 0.614655435f},
-std::array<float,2>{0.360664994f, 0.095846571f},
-std::array<float,2>{0.814741433f, 0.939073086f},
-std::array<float,2>{0.583348155f, 0.438122779f},
-std::array<float,2>{0.131605625f, 0.685866237f},
-std::array<float,2>{0.114263862f, 0.334772885f},
-std::array<float,2>{0.741230667f, 0.530871391f},
-std::array<float,2>{0.909545422f, 0.15642412f},
-std::array<float,2>{0.463978022f, 0.818479657f},
-std::array<float,2>{0.288496614f, 0.310433f},
-std::array<float,2>{0.804898739f, 0.579644382f},
-std::array<float,2>{0.522048712f, 0.241549611f},
-std::array<float,2>{0.208435938f, 0.762979448f},
-std::array<float,2>{0.047365699f, 0.0353466384f},
-std::array<float,2>{0.652677238f, 0.907161951f},
-std::array<float,2>{0.956280529f, 0.407758445f},
-std::array<float,2>{0.408353508f, 0.690664411f},
-std::array<float,2>{0.492313415f, 0.127118617f},
-std::array<float,2>{0.88972795f, 0.843793511f},
-std::array<float,2>{0.689638376f, 0.370157719f},
-std::array<float,2>{0.0897807106f, 0.540096462f},
-std::array<float,2>{0.182364017f, 0.474837512f},
-std::array<float,2>{0.614706397f, 0.647061408f},
-std::array<float,2>{0.846586883f, 0.0780791938f},
-std::array<float,2>{0.312911481f, 0.990584373f},
-std::array<float,2>{0.442345977f, 0.346744567f},
-std::array<float,2>{0.93674922f, 0.551989615f},
-std::array<float,2>{0.732173264f, 0.141719788f},
-std::array<float,2>{0.0982746109f, 0.862757087f},
-std::array<float,2>{0.151731864f, 0.0814296976f},
-std::array<float,2>{0.568985879f, 0.976486742f},
-std::array<float,2>{0.837415516f, 0.495466828f},
-std::array<float,2>{0.35669446f, 0.627567649f},
-std::array<float,2>{0.264665037f, 0.218995035f},
-std::array<float,2>{0.775847197f, 0.770944774f},
-std::array<float,2>{0.544126868f, 0.296543956f},
-std::array<float,2>{0.246487483f, 0.572053075f},
-std::array<float,2>{0.00359228067f, 0.428049535f},
-std::array<float,2>{0.679103196f, 0.707947731f},
-std::array<float,2>{0.995364308f, 0.0580832139f},
-std::array<float,2>{0.403449982f, 0.924682915f},
-std::array<float,2>{0.340132117f, 0.466032714f},
-std::array<float,2>{0.87038058f, 0.660920322f},
-std::array<float,2>{0.601390719f, 0.111033484f},
-std::array<float,2>{0.167597517f, 0.965651751f},
-std::array<float,2>{0.063328594f, 0.175872728f},
-std::array<float,2>{0.715973794f, 0.835763693f},
-std::array<float,2>{0.893081367f, 0.326275945f},
-std::array<float,2>{0.481102914f, 0.505338132f},
-std::array<float,2>{0.432271093f, 0.0169793125f},
-std::array<float,2>{0.942877054f, 0.891758323f},
-std::array<float,2>{0.637793422f, 0.396987587f},
-std::array<float,2>{0.0462794341f, 0.736201167f},
-std::array<float,2>{0.191861823f, 0.255465329f},
-std::array<float,2>{0.507157445f, 0.600746155f},
-std::array<float,2>{0.791141808f, 0.188885853f},
-std::array<float,2>{0.303357422f, 0.793271542f},
-std::array<float,2>{0.467380226f, 0.435337692f},
-std::array<float,2>{0.911031783f, 0.712934971f},
-std::array<float,2>{0.735068917f, 0.0486498959f},
-std::array<float,2>{0.110305242f, 0.936865211f},
-std::array<float,2>{0.125301123f, 0.233075559f},
-std::array<float,2>{0.579535544f, 0.775526226f},
-std::array<float,2>{0.817650557f, 0.282540083f},
-std::array<float,2>{0.366040289f, 0.56682384f},
-std::array<float,2>{0.280274183f, 0.090729624f},
-std::array<float,2>{0.750452101f, 0.983040512f},
-std::array<float,2>{0.559759259f, 0.488437116f},
-std::array<float,2>{0.229909077f, 0.639472544f},
-std::array<float,2>{0.0166879836f, 0.356790453f},
-std::array<float,2>{0.657720745f, 0.558422267f},
-std::array<float,2>{0.982986748f, 0.154862285f},
-std::array<float,2>{0.382374138f, 0.867382705f},
-std::array<float,2>{0.31656f, 0.259729058f},
-std::array<float,2>{0.849275172f, 0.603752494f},
-std::array<float,2>{0.61156565f, 0.197209969f},
-std::array<float,2>{0.186463878f, 0.788016856f},
-std::array<float,2>{0.0937035903f, 0.0246335361f},
-std::array<float,2>{0.693704724f, 0.90236342f},
-std::array<float,2>{0.882846236f, 0.405521929f},
-std::array<float,2>{0.497181088f, 0.745788157f},
-std::array<float,2>{0.411444545f, 0.184303924f},
-std::array<float,2>{0.960153759f, 0.837168038f},
-std::array<float,2>{0.650711715f, 0.316790193f},
-std::array<float,2>{0.0513938703f, 0.514679372f},
-std::array<float,2>{0.204778537f, 0.453327268f},
-std::array<float,2>{0.516044855f, 0.669158101f},
-std::array<float,2>{0.811888695f, 0.123551995f},
-std::array<float,2>{0.284484863f, 0.956443667f},
-std::array<float,2>{0.400904357f, 0.337726355f},
-std::array<float,2>{0.999302626f, 0.517232478f},
-std::array<float,2>{0.675204039f, 0.164933011f},
-std::array<float,2>{0.0066730706f, 0.825148046f},
-std::array<float,2>{0.243262798f, 0.104027577f},
-std::array<float,2>{0.539524555f, 0.952082574f},
-std::array<float,2>{0.77895391f, 0.450213611f},
-std::array<float,2>{0.259369403f, 0.675463378f},
-std::array<float,2>{0.354335099f, 0.206745371f},
-std::array<float,2>{0.839946389f, 0.79946208f},
-std::array<float,2>{0.565006673f, 0.279215991f},
-std::array<float,2>{0.15584828f, 0.619121313f},
-std::array<float,2>{0.0961607248f, 0.389561951f},
-std::array<float,2>{0.727781355f, 0.728139877f},
-std::array<float,2>{0.933067799f, 0.0141626718f},
-std::array<float,2>{0.439407796f, 0.881115913f},
-std::array<float,2>{0.297675818f, 0.476799935f},
-std::array<float,2>{0.79674983f, 0.650789201f},
-std::array<float,2>{0.501625061f, 0.0636629462f},
-std::array<float,2>{0.188330591f, 0.998340845f},
-std::array<float,2>{0.0412200093f, 0.134602293f},
-std::array<float,2>{0.634486198f, 0.851942182f},
-std::array<float,2>{0.940977275f, 0.359824836f},
-std::array<float,2>{0.436157614f, 0.535331666f},
-std::array<float,2>{0.477159321f, 0.0406087451f},
-std::array<float,2>{0.897289336f, 0.916458964f},
-std::array<float,2>{0.711128891f, 0.417974353f},
-std::array<float,2>{0.0677284896f, 0.697323084f},
-std::array<float,2>{0.169872031f, 0.301718414f},
-std::array<float,2>{0.595901549f, 0.590195894f},
-std::array<float,2>{0.87240088f, 0.246313065f},
-std::array<float,2>{0.339550555f, 0.751188278f},
-std::array<float,2>{0.429512203f, 0.444790721f},
-std::array<float,2>{0.952528596f, 0.68230474f},
-std::array<float,2>{0.632673025f, 0.0980734974f},
-std::array<float,2>{0.0385890417f, 0.94208771f},
-std::array<float,2>{0.196131527f, 0.162430719f},
-std::array<float,2>{0.510586023f, 0.815576851f},
-std::array<float,2>{0.782426775f, 0.328787029f},
-std::array<float,2>{0.310143292f, 0.523769379f},
-std::array<float,2>{0.331012428f, 0.0069445651f},
-std::array<float,2>{0.862635314f, 0.889162064f},
-std::array<float,2>{0.603879809f, 0.378822356f},
-std::array<float,2>{0.159800574f, 0.722698212f},
-std::array<float,2>{0.0771283284f, 0.267442167f},
-std::array<float,2>{0.710549653f, 0.609517753f},
-std::array<float,2>{0.903939664f, 0.216367483f},
-std::array<float,2>{0.471939266f, 0.808020175f},
-std::array<float,2>{0.256087035f, 0.374188572f},
-std::array<float,2>{0.767786741f, 0.546495318f},
-std::array<float,2>{0.535942852f, 0.129097447f},
-std::array<float,2>{0.241934508f, 0.849249363f},
-std::array<float,2>{0.00910956971f, 0.0709633157f},
-std::array<float,2>{0.682368398f, 0.985974431f},
-std::array<float,2>{0.987474263f, 0.472611964f},
-std::array<float,2>{0.396003842f, 0.641624689f},
-std::array<float,2>{0.446201831f, 0.237728074f},
-std::array<float,2>{0.925409257f, 0.758155227f},
-std::array<float,2>{0.722256422f, 0.308023304f},
-std::array<float,2>{0.101847686f, 0.585874796f},
-std::array<float,2>{0.144262284f, 0.412072986f},
-std::array<float,2>{0.572314262f, 0.693353117f},
-std::array<float,2>{0.835597515f, 0.0346864425f},
-std::array<float,2>{0.345320523f, 0.910293579f},
-std::array<float,2>{0.486925989f, 0.292880177f},
-std::array<float,2>{0.882547796f, 0.577885926f},
-std::array<float,2>{0.697839558f, 0.224343926f},
-std::array<float,2>{0.0790188834f, 0.766849041f},
-std::array<float,2>{0.175378338f, 0.0593736842f},
-std::array<float,2>{0.624046028f, 0.928886235f},
-std::array<float,2>{0.853346407f, 0.423274666f},
-std::array<float,2>{0.321882337f, 0.705547631f},
-std::array<float,2>{0.289717287f, 0.147625953f},
-std::array<float,2>{0.798980713f, 0.864824414f},
-std::array<float,2>{0.529940367f, 0.348668069f},
-std::array<float,2>{0.213584378f, 0.548032641f},
-std::array<float,2>{0.0612302199f, 0.498241723f},
-std::array<float,2>{0.64378649f, 0.630595148f},
-std::array<float,2>{0.967763722f, 0.0845611393f},
-std::array<float,2>{0.420057654f, 0.970715582f},
-std::array<float,2>{0.370717764f, 0.392364502f},
-std::array<float,2>{0.826792896f, 0.739267766f},
-std::array<float,2>{0.592334569f, 0.0206509922f},
-std::array<float,2>{0.139715895f, 0.896919131f},
-std::array<float,2>{0.117763795f, 0.193171799f},
-std::array<float,2>{0.745509744f, 0.791215539f},
-std::array<float,2>{0.920801818f, 0.250441462f},
-std::array<float,2>{0.458080411f, 0.595835268f},
-std::array<float,2>{0.388969541f, 0.116453193f},
-std::array<float,2>{0.969663918f, 0.961509824f},
-std::array<float,2>{0.667079866f, 0.464558333f},
-std::array<float,2>{0.0308585837f, 0.658441603f},
-std::array<float,2>{0.224280939f, 0.321315974f},
-std::array<float,2>{0.550030231f, 0.500035048f},
-std::array<float,2>{0.762791395f, 0.172556505f},
-std::array<float,2>{0.272059053f, 0.83085984f},
-std::array<float,2>{0.45226723f, 0.459549993f},
-std::array<float,2>{0.928479195f, 0.665492475f},
-std::array<float,2>{0.725462258f, 0.119529873f},
-std::array<float,2>{0.106989495f, 0.960240722f},
-std::array<float,2>{0.145776048f, 0.180865586f},
-std::array<float,2>{0.577078283f, 0.843310773f},
-std::array<float,2>{0.831939995f, 0.315762997f},
-std::array<float,2>{0.350756228f, 0.511536539f},
-std::array<float,2>{0.253581047f, 0.0298636276f},
-std::array<float,2>{0.770574212f, 0.900688827f},
-std::array<float,2>{0.53222996f, 0.402063459f},
-std::array<float,2>{0.236063719f, 0.746344388f},
-std::array<float,2>{0.0150198201f, 0.265072227f},
-std::array<float,2>{0.686065733f, 0.607862413f},
-std::array<float,2>{0.989739358f, 0.202688619f},
-std::array<float,2>{0.393290192f, 0.784800887f},
-std::array<float,2>{0.335390687f, 0.352911919f},
-std::array<float,2>{0.867032468f, 0.562447369f},
-std::array<float,2>{0.609322965f, 0.151542559f},
-std::array<float,2>{0.162708148f, 0.872477531f},
-std::array<float,2>{0.0727699995f, 0.0889059901f},
-std::array<float,2>{0.706818342f, 0.977831483f},
-std::array<float,2>{0.898762345f, 0.48711589f},
-std::array<float,2>{0.476322562f, 0.634842992f},
-std::array<float,2>{0.425104409f, 0.228663281f},
-std::array<float,2>{0.948879302f, 0.778411984f},
-std::array<float,2>{0.625493646f, 0.288596034f},
-std::array<float,2>{0.0316917002f, 0.565332234f},
-std::array<float,2>{0.200426057f, 0.433218986f},
-std::array<float,2>{0.511912227f, 0.716142118f},
-std::array<float,2>{0.787350118f, 0.0531382635f},
-std::array<float,2>{0.307000339f, 0.932357669f},
-std::array<float,2>{0.384820104f, 0.296901137f},
-std::array<float,2>{0.975201786f, 0.58910501f},
-std::array<float,2>{0.668758571f, 0.243999615f},
-std::array<float,2>{0.0260438994f, 0.754760623f},
-std::array<float,2>{0.221372515f, 0.0453696027f},
-std::array<float,2>{0.5535748f, 0.919499099f},
-std::array<float,2>{0.760963142f, 0.41694054f},
-std::array<float,2>{0.2660923f, 0.700790584f},
-std::array<float,2>{0.372166753f, 0.13934046f},
-std::array<float,2>{0.821921825f, 0.858442962f},
-std::array<float,2>{0.587810457f, 0.364677012f},
-std::array<float,2>{0.133615881f, 0.534993768f},
-std::array<float,2>{0.122531742f, 0.482506245f},
-std::array<float,2>{0.747919202f, 0.655011833f},
-std::array<float,2>{0.916049242f, 0.0687708259f},
-std::array<float,2>{0.45578891f, 0.993347526f},
-std::array<float,2>{0.293294519f, 0.385993928f},
-std::array<float,2>{0.802664161f, 0.731505275f},
-std::array<float,2>{0.52435416f, 0.00821798481f},
-std::array<float,2>{0.218146399f, 0.878696203f},
-std::array<float,2>{0.054702092f, 0.20913443f},
-std::array<float,2>{0.645301163f, 0.804429889f},
-std::array<float,2>{0.962893128f, 0.273720235f},
-std::array<float,2>{0.417078882f, 0.624556124f},
-std::array<float,2>{0.491452783f, 0.109118178f},
-std::array<float,2>{0.877831101f, 0.945986748f},
-std::array<float,2>{0.70278126f, 0.446640372f},
-std::array<float,2>{0.0853705779f, 0.679309607f},
-std::array<float,2>{0.177250057f, 0.340599298f},
-std::array<float,2>{0.618400097f, 0.520196259f},
-std::array<float,2>{0.855744481f, 0.169570118f},
-std::array<float,2>{0.327292025f, 0.820577025f},
-std::array<float,2>{0.406314671f, 0.408456028f},
-std::array<float,2>{0.955059588f, 0.688522995f},
-std::array<float,2>{0.655202568f, 0.0385077186f},
-std::array<float,2>{0.0490663424f, 0.910134792f},
-std::array<float,2>{0.210306495f, 0.240092739f},
-std::array<float,2>{0.520876586f, 0.76445514f},
-std::array<float,2>{0.807616651f, 0.311062098f},
-std::array<float,2>{0.285600454f, 0.581575155f},
-std::array<float,2>{0.314900249f, 0.0748416111f},
-std::array<float,2>{0.843762279f, 0.990090251f},
-std::array<float,2>{0.615518272f, 0.473632962f},
-std::array<float,2>{0.180844173f, 0.645185828f},
-std::array<float,2>{0.0866634548f, 0.367544174f},
-std::array<float,2>{0.689207554f, 0.542248428f},
-std::array<float,2>{0.888337374f, 0.125943244f},
-std::array<float,2>{0.494183064f, 0.84609127f},
-std::array<float,2>{0.274924606f, 0.271232218f},
-std::array<float,2>{0.755499184f, 0.616796374f},
-std::array<float,2>{0.555625975f, 0.214049444f},
-std::array<float,2>{0.233996928f, 0.809415698f},
-std::array<float,2>{0.0226100273f, 0.00180038856f},
-std::array<float,2>{0.660786867f, 0.884115577f},
-std::array<float,2>{0.978478312f, 0.381322205f},
-std::array<float,2>{0.37743479f, 0.720716894f},
-std::array<float,2>{0.462461025f, 0.159630641f},
-std::array<float,2>{0.906266451f, 0.816580355f},
-std::array<float,2>{0.739088118f, 0.333063185f},
-std::array<float,2>{0.117000371f, 0.528728843f},
-std::array<float,2>{0.129618108f, 0.440704793f},
-std::array<float,2>{0.5852139f, 0.683907568f},
-std::array<float,2>{0.813795626f, 0.0951432735f},
-std::array<float,2>{0.362714708f, 0.940153897f},
-std::array<float,2>{0.484094858f, 0.324610204f},
-std::array<float,2>{0.890691161f, 0.50747174f},
-std::array<float,2>{0.717318356f, 0.179356158f},
-std::array<float,2>{0.0653994605f, 0.83207798f},
-std::array<float,2>{0.165056646f, 0.111940838f},
-std::array<float,2>{0.599025607f, 0.966841698f},
-std::array<float,2>{0.868667305f, 0.468145221f},
-std::array<float,2>{0.343167663f, 0.66238302f},
-std::array<float,2>{0.301323026f, 0.190341592f},
-std::array<float,2>{0.79078275f, 0.796197116f},
-std::array<float,2>{0.504215896f, 0.255864888f},
-std::array<float,2>{0.195183933f, 0.599463701f},
-std::array<float,2>{0.0433210805f, 0.396322966f},
-std::array<float,2>{0.640262067f, 0.736354291f},
-std::array<float,2>{0.944441855f, 0.0190585423f},
-std::array<float,2>{0.429889768f, 0.893902779f},
-std::array<float,2>{0.359294474f, 0.493627638f},
-std::array<float,2>{0.838030636f, 0.626387358f},
-std::array<float,2>{0.567719519f, 0.0800704807f},
-std::array<float,2>{0.148727626f, 0.974518895f},
-std::array<float,2>{0.101381958f, 0.142949641f},
-std::array<float,2>{0.733329117f, 0.861075521f},
-std::array<float,2>{0.934999526f, 0.343835264f},
-std::array<float,2>{0.44368872f, 0.553462267f},
-std::array<float,2>{0.405153483f, 0.0549766049f},
-std::array<float,2>{0.99368304f, 0.923421085f},
-std::array<float,2>{0.677075326f, 0.427391768f},
-std::array<float,2>{0.00145263749f, 0.709215522f},
-std::array<float,2>{0.248587936f, 0.294324398f},
-std::array<float,2>{0.545261323f, 0.573184311f},
-std::array<float,2>{0.774431109f, 0.221538365f},
-std::array<float,2>{0.263162464f, 0.772031844f},
-std::array<float,2>{0.499271899f, 0.403486758f},
-std::array<float,2>{0.885663748f, 0.743907988f},
-std::array<float,2>{0.692798316f, 0.0270647407f},
-std::array<float,2>{0.0911210179f, 0.905640006f},
-std::array<float,2>{0.185134441f, 0.198601171f},
-std::array<float,2>{0.609873295f, 0.785334885f},
-std::array<float,2>{0.8514238f, 0.260403216f},
-std::array<float,2>{0.319751501f, 0.603450298f},
-std::array<float,2>{0.28244397f, 0.121864013f},
-std::array<float,2>{0.810506105f, 0.954398334f},
-std::array<float,2>{0.518371761f, 0.456954271f},
-std::array<float,2>{0.205879465f, 0.670954645f},
-std::array<float,2>{0.0545522608f, 0.31914404f},
-std::array<float,2>{0.648841381f, 0.512110829f},
-std::array<float,2>{0.958050013f, 0.187448472f},
-std::array<float,2>{0.413872182f, 0.839718342f},
-std::array<float,2>{0.363827556f, 0.283753783f},
-std::array<float,2>{0.819902956f, 0.568794489f},
-std::array<float,2>{0.581768036f, 0.232364044f},
-std::array<float,2>{0.128391549f, 0.774719119f},
-std::array<float,2>{0.112919249f, 0.0498113856f},
-std::array<float,2>{0.73826766f, 0.933857679f},
-std::array<float,2>{0.91286242f, 0.436070532f},
-std::array<float,2>{0.465018839f, 0.71108377f},
-std::array<float,2>{0.379803538f, 0.154045582f},
-std::array<float,2>{0.982157171f, 0.869360387f},
-std::array<float,2>{0.659973085f, 0.35857746f},
-std::array<float,2>{0.0179218911f, 0.555649579f},
-std::array<float,2>{0.227103233f, 0.490911663f},
-std::array<float,2>{0.561414182f, 0.636979103f},
-std::array<float,2>{0.753124297f, 0.0920137018f},
-std::array<float,2>{0.278762817f, 0.981294513f},
-std::array<float,2>{0.43414253f, 0.361810416f},
-std::array<float,2>{0.939118147f, 0.537243009f},
-std::array<float,2>{0.635360599f, 0.134845525f},
-std::array<float,2>{0.0397307016f, 0.855276287f},
-std::array<float,2>{0.189930752f, 0.0645858198f},
-std::array<float,2>{0.502953351f, 0.997139633f},
-std::array<float,2>{0.794551253f, 0.480383098f},
-std::array<float,2>{0.300449848f, 0.649416387f},
-std::array<float,2>{0.336776912f, 0.248592302f},
-std::array<float,2>{0.873519659f, 0.75258857f},
-std::array<float,2>{0.595362127f, 0.30423066f},
-std::array<float,2>{0.170660555f, 0.592722118f},
-std::array<float,2>{0.0689317808f, 0.420667917f},
-std::array<float,2>{0.714696765f, 0.697173595f},
-std::array<float,2>{0.895274222f, 0.0421299487f},
-std::array<float,2>{0.479186326f, 0.915690005f},
-std::array<float,2>{0.260141641f, 0.451674998f},
-std::array<float,2>{0.78036195f, 0.673301101f},
-std::array<float,2>{0.542479098f, 0.103067197f},
-std::array<float,2>{0.245097727f, 0.951156974f},
-std::array<float,2>{0.00562132802f, 0.166387022f},
-std::array<float,2>{0.673784614f, 0.827732682f},
-std::array<float,2>{0.99801904f, 0.338657171f},
-std::array<float,2>{0.398932427f, 0.519262195f},
-std::array<float,2>{0.440802842f, 0.012895708f},
-std::array<float,2>{0.931188226f, 0.879251182f},
-std::array<float,2>{0.73007822f, 0.388630211f},
-std::array<float,2>{0.0954871848f, 0.729363203f},
-std::array<float,2>{0.15298751f, 0.280567974f},
-std::array<float,2>{0.563120425f, 0.620498836f},
-std::array<float,2>{0.842179596f, 0.203778878f},
-std::array<float,2>{0.35273391f, 0.798323035f},
-std::array<float,2>{0.397321075f, 0.469770819f},
-std::array<float,2>{0.984909356f, 0.643029392f},
-std::array<float,2>{0.681513131f, 0.0737600848f},
-std::array<float,2>{0.011557973f, 0.988003194f},
-std::array<float,2>{0.239165857f, 0.13167122f},
-std::array<float,2>{0.538268924f, 0.850167215f},
-std::array<float,2>{0.76616925f, 0.371547312f},
-std::array<float,2>{0.254778504f, 0.544918358f},
-std::array<float,2>{0.346883595f, 0.0330071747f},
-std::array<float,2>{0.832262576f, 0.913197637f},
-std::array<float,2>{0.5709126f, 0.412580431f},
-std::array<float,2>{0.142417923f, 0.694777429f},
-std::array<float,2>{0.103984646f, 0.305870801f},
-std::array<float,2>{0.720228672f, 0.582705677f},
-std::array<float,2>{0.922690928f, 0.234708294f},
-std::array<float,2>{0.448431432f, 0.760855913f},
-std::array<float,2>{0.31209752f, 0.330769598f},
-std::array<float,2>{0.784734786f, 0.526906967f},
-std::array<float,2>{0.509141266f, 0.160664871f},
-std::array<float,2>{0.197970197f, 0.813922107f},
-std::array<float,2>{0.0367030278f, 0.0997703001f},
-std::array<float,2>{0.629270852f, 0.944240153f},
-std::array<float,2>{0.950466514f, 0.441544622f},
-std::array<float,2>{0.426945746f, 0.681212306f},
-std::array<float,2>{0.468911886f, 0.217973411f},
-std::array<float,2>{0.905197322f, 0.805264175f},
-std::array<float,2>{0.708892345f, 0.269004315f},
-std::array<float,2>{0.0759796202f, 0.613238275f},
-std::array<float,2>{0.156967729f, 0.376570761f},
-std::array<float,2>{0.602941215f, 0.726209223f},
-std::array<float,2>{0.860734105f, 0.00452855742f},
-std::array<float,2>{0.329384804f, 0.886922538f},
-std::array<float,2>{0.460124105f, 0.253267616f},
-std::array<float,2>{0.91945219f, 0.595579743f},
-std::array<float,2>{0.742439091f, 0.194868907f},
-std::array<float,2>{0.120805278f, 0.78917259f},
-std::array<float,2>{0.13836728f, 0.0215292089f},
-std::array<float,2>{0.591612816f, 0.894954979f},
-std::array<float,2>{0.826123476f, 0.392650992f},
-std::array<float,2>{0.368148565f, 0.740644097f},
-std::array<float,2>{0.269751161f, 0.175382793f},
-std::array<float,2>{0.764015794f, 0.828672826f},
-std::array<float,2>{0.548566997f, 0.322914571f},
-std::array<float,2>{0.224882305f, 0.501990914f},
-std::array<float,2>{0.0277165063f, 0.461458385f},
-std::array<float,2>{0.664319634f, 0.65724349f},
-std::array<float,2>{0.972313523f, 0.1146264f},
-std::array<float,2>{0.387752205f, 0.964024365f},
-std::array<float,2>{0.323313981f, 0.42441079f},
-std::array<float,2>{0.854100108f, 0.703594267f},
-std::array<float,2>{0.622372627f, 0.0612116717f},
-std::array<float,2>{0.173354536f, 0.926150143f},
-std::array<float,2>{0.0807126313f, 0.225819767f},
-std::array<float,2>{0.697200298f, 0.768094659f},
-std::array<float,2>{0.880749464f, 0.289182603f},
-std::array<float,2>{0.485304981f, 0.574433804f},
-std::array<float,2>{0.41802007f, 0.0827472061f},
-std::array<float,2>{0.965897739f, 0.97064364f},
-std::array<float,2>{0.641218722f, 0.497892618f},
-std::array<float,2>{0.0586563945f, 0.6325804f},
-std::array<float,2>{0.211280003f, 0.351499557f},
-std::array<float,2>{0.529246569f, 0.549806952f},
-std::array<float,2>{0.797752202f, 0.146127298f},
-std::array<float,2>{0.291079819f, 0.865388095f},
-std::array<float,2>{0.496758729f, 0.456748188f},
-std::array<float,2>{0.883951128f, 0.671183407f},
-std::array<float,2>{0.695010364f, 0.121614657f},
-std::array<float,2>{0.0923852623f, 0.954167247f},
-std::array<float,2>{0.187256992f, 0.187149733f},
-std::array<float,2>{0.612980962f, 0.839495122f},
-std::array<float,2>{0.848525822f, 0.319065154f},
-std::array<float,2>{0.317450553f, 0.51177156f},
-std::array<float,2>{0.283667058f, 0.0271334015f},
-std::array<float,2>{0.810722888f, 0.905367136f},
-std::array<float,2>{0.516783118f, 0.403788418f},
-std::array<float,2>{0.203971565f, 0.743741393f},
-std::array<float,2>{0.0522730276f, 0.260568619f},
-std::array<float,2>{0.651755035f, 0.603162527f},
-std::array<float,2>{0.959146738f, 0.198275313f},
-std::array<float,2>{0.410376132f, 0.785438299f},
-std::array<float,2>{0.36702472f, 0.358678579f},
-std::array<float,2>{0.816718459f, 0.555272341f},
-std::array<float,2>{0.578324676f, 0.154096216f},
-std::array<float,2>{0.126887023f, 0.869398296f},
-std::array<float,2>{0.111278787f, 0.0921568871f},
-std::array<float,2>{0.735589862f, 0.981128514f},
-std::array<float,2>{0.911391914f, 0.491080165f},
-std::array<float,2>{0.468235821f, 0.636881471f},
-std::array<float,2>{0.381305039f, 0.23203674f},
-std::array<float,2>{0.983529568f, 0.774438322f},
-std::array<float,2>{0.656256497f, 0.284017801f},
-std::array<float,2>{0.0161348879f, 0.56859076f},
-std::array<float,2>{0.229413047f, 0.436519444f},
-std::array<float,2>{0.559489965f, 0.711354434f},
-std::array<float,2>{0.751001358f, 0.0502212644f},
-std::array<float,2>{0.279859036f, 0.933596551f},
-std::array<float,2>{0.437224865f, 0.304663509f},
-std::array<float,2>{0.940061748f, 0.592515886f},
-std::array<float,2>{0.633720815f, 0.248833582f},
-std::array<float,2>{0.0424169041f, 0.752718389f},
-std::array<float,2>{0.189344317f, 0.0422734134f},
-std::array<float,2>{0.500287235f, 0.915786326f},
-std::array<float,2>{0.795638025f, 0.420452952f},
-std::array<float,2>{0.298647165f, 0.696967959f},
-std::array<float,2>{0.338114768f, 0.13515994f},
-std::array<float,2>{0.871771276f, 0.855194271f},
-std::array<float,2>{0.596698463f, 0.361394763f},
-std::array<float,2>{0.168265387f, 0.537443459f},
-std::array<float,2>{0.0669338256f, 0.480168372f},
-std::array<float,2>{0.712884605f, 0.649896622f},
-std::array<float,2>{0.898398459f, 0.0647212416f},
-std::array<float,2>{0.477683574f, 0.997509301f},
-std::array<float,2>{0.258676261f, 0.388325393f},
-std::array<float,2>{0.777727664f, 0.729087412f},
-std::array<float,2>{0.540690064f, 0.0130592631f},
-std::array<float,2>{0.242490605f, 0.879087508f},
-std::array<float,2>{0.00755077275f, 0.203888878f},
-std::array<float,2>{0.674628437f, 0.797918916f},
-std::array<float,2>{0.998749793f, 0.280410737f},
-std::array<float,2>{0.402192295f, 0.620164335f},
-std::array<float,2>{0.438053876f, 0.103334486f},
-std::array<float,2>{0.93239826f, 0.950842917f},
-std::array<float,2>{0.727031171f, 0.452033699f},
-std::array<float,2>{0.0974291936f, 0.672873259f},
-std::array<float,2>{0.154454634f, 0.338383496f},
-std::array<float,2>{0.565879226f, 0.519491136f},
-std::array<float,2>{0.841508269f, 0.166185692f},
-std::array<float,2>{0.354988098f, 0.827958405f},
-std::array<float,2>{0.395450145f, 0.412297755f},
-std::array<float,2>{0.986851931f, 0.694558024f},
-std::array<float,2>{0.683506727f, 0.0327224843f},
-std::array<float,2>{0.00817564316f, 0.91337353f},
-std::array<float,2>{0.240856081f, 0.23445195f},
-std::array<float,2>{0.537012339f, 0.761229217f},
-std::array<float,2>{0.769493937f, 0.306069881f},
-std::array<float,2>{0.257426709f, 0.58296138f},
-std::array<float,2>{0.344464749f, 0.0740699768f},
-std::array<float,2>{0.834769666f, 0.988176048f},
-std::array<float,2>{0.573351383f, 0.470146954f},
-std::array<float,2>{0.14258346f, 0.642722964f},
-std::array<float,2>{0.102834538f, 0.371193677f},
-std::array<float,2>{0.720938325f, 0.54466635f},
-std::array<float,2>{0.9239254f, 0.131550536f},
-std::array<float,2>{0.446523011f, 0.850564122f},
-std::array<float,2>{0.309123486f, 0.268778443f},
-std::array<float,2>{0.781543016f, 0.612883627f},
-std::array<float,2>{0.511520803f, 0.218075991f},
-std::array<float,2>{0.196516246f, 0.805621922f},
-std::array<float,2>{0.0372199416f, 0.00478771562f},
-std::array<float,2>{0.631788254f, 0.887012482f},
-std::array<float,2>{0.951409996f, 0.376762569f},
-std::array<float,2>{0.428624719f, 0.726534963f},
-std::array<float,2>{0.471184552f, 0.161095127f},
-std::array<float,2>{0.902397871f, 0.813694417f},
-std::array<float,2>{0.709715247f, 0.330985248f},
-std::array<float,2>{0.0776664466f, 0.527187347f},
-std::array<float,2>{0.158429444f, 0.441809863f},
-std::array<float,2>{0.604658008f, 0.681463659f},
-std::array<float,2>{0.861996174f, 0.0999455526f},
-std::array<float,2>{0.331230044f, 0.944071889f},
-std::array<float,2>{0.457096398f, 0.323218554f},
-std::array<float,2>{0.921693146f, 0.50225997f},
-std::array<float,2>{0.744974077f, 0.175567403f},
-std::array<float,2>{0.118727863f, 0.828887343f},
-std::array<float,2>{0.138944164f, 0.114465192f},
-std::array<float,2>{0.593101203f, 0.964248955f},
-std::array<float,2>{0.827564657f, 0.461676598f},
-std::array<float,2>{0.369463563f, 0.657660007f},
-std::array<float,2>{0.272881657f, 0.195299655f},
-std::array<float,2>{0.761745632f, 0.789419055f},
-std::array<float,2>{0.549719512f, 0.252980679f},
-std::array<float,2>{0.22287032f, 0.595403612f},
-std::array<float,2>{0.0302300993f, 0.392901808f},
-std::array<float,2>{0.666316092f, 0.740285993f},
-std::array<float,2>{0.970462382f, 0.0218839664f},
-std::array<float,2>{0.390304029f, 0.894669831f},
-std::array<float,2>{0.320467114f, 0.497686416f},
-std::array<float,2>{0.852185488f, 0.632418633f},
-std::array<float,2>{0.624007761f, 0.0827661678f},
-std::array<float,2>{0.174533397f, 0.970236599f},
-std::array<float,2>{0.0796794593f, 0.146292642f},
-std::array<float,2>{0.698691487f, 0.865702927f},
-std::array<float,2>{0.881157219f, 0.351249427f},
-std::array<float,2>{0.488129437f, 0.55018115f},
-std::array<float,2>{0.421063811f, 0.0612938143f},
-std::array<float,2>{0.968348444f, 0.92581284f},
-std::array<float,2>{0.642886996f, 0.424660236f},
-std::array<float,2>{0.061880935f, 0.703204334f},
-std::array<float,2>{0.214664921f, 0.28947404f},
-std::array<float,2>{0.530652463f, 0.574482858f},
-std::array<float,2>{0.799806297f, 0.225985527f},
-std::array<float,2>{0.290074199f, 0.768473804f},
-std::array<float,2>{0.450502336f, 0.402229846f},
-std::array<float,2>{0.926877022f, 0.746144116f},
-std::array<float,2>{0.723838449f, 0.0300884396f},
-std::array<float,2>{0.108617164f, 0.90045625f},
-std::array<float,2>{0.147262856f, 0.203031555f},
-std::array<float,2>{0.575069785f, 0.785088897f},
-std::array<float,2>{0.830001056f, 0.264883697f},
-std::array<float,2>{0.349117368f, 0.607664883f},
-std::array<float,2>{0.251376629f, 0.119356558f},
-std::array<float,2>{0.771749735f, 0.960114717f},
-std::array<float,2>{0.534623981f, 0.459917903f},
-std::array<float,2>{0.23668851f, 0.665171623f},
-std::array<float,2>{0.0132181412f, 0.315668583f},
-std::array<float,2>{0.685260057f, 0.511321843f},
-std::array<float,2>{0.991820514f, 0.181098402f},
-std::array<float,2>{0.391544878f, 0.843594253f},
-std::array<float,2>{0.332496613f, 0.288853288f},
-std::array<float,2>{0.863620758f, 0.564944267f},
-std::array<float,2>{0.605924785f, 0.22885628f},
-std::array<float,2>{0.161890462f, 0.778619707f},
-std::array<float,2>{0.07157024f, 0.0529099219f},
-std::array<float,2>{0.70350039f, 0.932405114f},
-std::array<float,2>{0.901472092f, 0.433510631f},
-std::array<float,2>{0.473356575f, 0.716014385f},
-std::array<float,2>{0.422988951f, 0.151644468f},
-std::array<float,2>{0.946621358f, 0.872100055f},
-std::array<float,2>{0.62796098f, 0.352564335f},
-std::array<float,2>{0.034123458f, 0.562094867f},
-std::array<float,2>{0.201251611f, 0.48702535f},
-std::array<float,2>{0.515537381f, 0.635192335f},
-std::array<float,2>{0.785607517f, 0.0892826691f},
-std::array<float,2>{0.305166602f, 0.977606952f},
-std::array<float,2>{0.383001208f, 0.36435315f},
-std::array<float,2>{0.972853243f, 0.534901202f},
-std::array<float,2>{0.671193957f, 0.13943781f},
-std::array<float,2>{0.0240096115f, 0.858854651f},
-std::array<float,2>{0.220121026f, 0.0684177279f},
-std::array<float,2>{0.551073551f, 0.993468881f},
-std::array<float,2>{0.758527815f, 0.48290962f},
-std::array<float,2>{0.268975884f, 0.65509814f},
-std::array<float,2>{0.373378485f, 0.243811324f},
-std::array<float,2>{0.824194014f, 0.75462079f},
-std::array<float,2>{0.588764966f, 0.297353536f},
-std::array<float,2>{0.135643274f, 0.589301586f},
-std::array<float,2>{0.124539219f, 0.416590661f},
-std::array<float,2>{0.748309076f, 0.701050162f},
-std::array<float,2>{0.915651023f, 0.0451245978f},
-std::array<float,2>{0.45472753f, 0.919694841f},
-std::array<float,2>{0.296534926f, 0.446453214f},
-std::array<float,2>{0.803377092f, 0.679616094f},
-std::array<float,2>{0.525951266f, 0.109250806f},
-std::array<float,2>{0.216284871f, 0.946117818f},
-std::array<float,2>{0.0570218898f, 0.169702575f},
-std::array<float,2>{0.646634698f, 0.820555925f},
-std::array<float,2>{0.962068796f, 0.340565115f},
-std::array<float,2>{0.415468931f, 0.520289958f},
-std::array<float,2>{0.490233153f, 0.00782370195f},
-std::array<float,2>{0.876828194f, 0.878453672f},
-std::array<float,2>{0.699272811f, 0.385978043f},
-std::array<float,2>{0.0837559327f, 0.731781542f},
-std::array<float,2>{0.178979993f, 0.273445219f},
-std::array<float,2>{0.619750023f, 0.624941468f},
-std::array<float,2>{0.859024227f, 0.209315628f},
-std::array<float,2>{0.325891942f, 0.804515421f},
-std::array<float,2>{0.409381986f, 0.47403881f},
-std::array<float,2>{0.955796897f, 0.645354569f},
-std::array<float,2>{0.653507471f, 0.0750290826f},
-std::array<float,2>{0.0481859446f, 0.989764452f},
-std::array<float,2>{0.207496017f, 0.125644729f},
-std::array<float,2>{0.523075521f, 0.845742404f},
-std::array<float,2>{0.806303382f, 0.367309719f},
-std::array<float,2>{0.288069248f, 0.542015851f},
-std::array<float,2>{0.313987315f, 0.0381168835f},
-std::array<float,2>{0.84747225f, 0.90989244f},
-std::array<float,2>{0.613809824f, 0.408382595f},
-std::array<float,2>{0.183382824f, 0.688853502f},
-std::array<float,2>{0.0884839073f, 0.311300308f},
-std::array<float,2>{0.690949976f, 0.581870198f},
-std::array<float,2>{0.889393806f, 0.239971414f},
-std::array<float,2>{0.494109422f, 0.764400542f},
-std::array<float,2>{0.276307076f, 0.333438545f},
-std::array<float,2>{0.756320119f, 0.528473616f},
-std::array<float,2>{0.557323873f, 0.15927282f},
-std::array<float,2>{0.231762201f, 0.816679657f},
-std::array<float,2>{0.0212021172f, 0.0947427824f},
-std::array<float,2>{0.6634776f, 0.940211415f},
-std::array<float,2>{0.978884101f, 0.440656811f},
-std::array<float,2>{0.375054926f, 0.683776617f},
-std::array<float,2>{0.463134527f, 0.214315861f},
-std::array<float,2>{0.908801913f, 0.809256613f},
-std::array<float,2>{0.741007388f, 0.271471918f},
-std::array<float,2>{0.113513432f, 0.61704421f},
-std::array<float,2>{0.132306531f, 0.381003261f},
-std::array<float,2>{0.582699001f, 0.721065879f},
-std::array<float,2>{0.815693617f, 0.00168325077f},
-std::array<float,2>{0.359491765f, 0.883807182f},
-std::array<float,2>{0.482370228f, 0.256212234f},
-std::array<float,2>{0.893784404f, 0.599171281f},
-std::array<float,2>{0.715200663f, 0.190175161f},
-std::array<float,2>{0.0638925359f, 0.795938075f},
-std::array<float,2>{0.166438267f, 0.0193628743f},
-std::array<float,2>{0.599764466f, 0.893774629f},
-std::array<float,2>{0.869603753f, 0.396169156f},
-std::array<float,2>{0.341382861f, 0.736730576f},
-std::array<float,2>{0.304349959f, 0.179666832f},
-std::array<float,2>{0.792038739f, 0.832431495f},
-std::array<float,2>{0.506565928f, 0.32432735f},
-std::array<float,2>{0.193051681f, 0.507643402f},
-std::array<float,2>{0.0450416543f, 0.467988312f},
-std::array<float,2>{0.637102306f, 0.662340522f},
-std::array<float,2>{0.941444218f, 0.112074539f},
-std::array<float,2>{0.432783842f, 0.96706897f},
-std::array<float,2>{0.356161982f, 0.427675456f},
-std::array<float,2>{0.836655915f, 0.709358871f},
-std::array<float,2>{0.570127487f, 0.0548488311f},
-std::array<float,2>{0.150732189f, 0.923649132f},
-std::array<float,2>{0.0988669768f, 0.221376777f},
-std::array<float,2>{0.73053658f, 0.772377849f},
-std::array<float,2>{0.935556293f, 0.294117212f},
-std::array<float,2>{0.442975581f, 0.572988808f},
-std::array<float,2>{0.403311878f, 0.0796501189f},
-std::array<float,2>{0.994354606f, 0.974202275f},
-std::array<float,2>{0.677991152f, 0.493288815f},
-std::array<float,2>{0.00235479791f, 0.626161277f},
-std::array<float,2>{0.247787908f, 0.344034344f},
-std::array<float,2>{0.543628275f, 0.553494573f},
-std::array<float,2>{0.777169108f, 0.142753437f},
-std::array<float,2>{0.264012843f, 0.861165822f},
-std::array<float,2>{0.466327578f, 0.488710791f},
-std::array<float,2>{0.913096189f, 0.639339566f},
-std::array<float,2>{0.737014413f, 0.0905466005f},
-std::array<float,2>{0.111770637f, 0.983294606f},
-std::array<float,2>{0.127171487f, 0.155225471f},
-std::array<float,2>{0.580562353f, 0.867568552f},
-std::array<float,2>{0.818784773f, 0.356529444f},
-std::array<float,2>{0.364858001f, 0.558331072f},
-std::array<float,2>{0.277728111f, 0.0485524125f},
-std::array<float,2>{0.75266242f, 0.936672986f},
-std::array<float,2>{0.561900556f, 0.435132325f},
-std::array<float,2>{0.228143051f, 0.713335454f},
-std::array<float,2>{0.0193333142f, 0.282394022f},
-std::array<float,2>{0.658989251f, 0.566461563f},
-std::array<float,2>{0.980980515f, 0.233322933f},
-std::array<float,2>{0.380691826f, 0.775721431f},
-std::array<float,2>{0.319215447f, 0.316605598f},
-std::array<float,2>{0.849652112f, 0.515104771f},
-std::array<float,2>{0.610470295f, 0.184400618f},
-std::array<float,2>{0.183995321f, 0.837080538f},
-std::array<float,2>{0.0904886872f, 0.123998344f},
-std::array<float,2>{0.691859543f, 0.956099272f},
-std::array<float,2>{0.88646847f, 0.453475863f},
-std::array<float,2>{0.49824205f, 0.669339776f},
-std::array<float,2>{0.412565053f, 0.196919918f},
-std::array<float,2>{0.957796812f, 0.787746131f},
-std::array<float,2>{0.649980962f, 0.259279102f},
-std::array<float,2>{0.0534409732f, 0.603926659f},
-std::array<float,2>{0.206472337f, 0.405402958f},
-std::array<float,2>{0.519377947f, 0.745920777f},
-std::array<float,2>{0.809148848f, 0.024745455f},
-std::array<float,2>{0.282151908f, 0.902668476f},
-std::array<float,2>{0.399660826f, 0.278829604f},
-std::array<float,2>{0.996636927f, 0.618873954f},
-std::array<float,2>{0.672284603f, 0.206938922f},
-std::array<float,2>{0.00443177251f, 0.799576461f},
-std::array<float,2>{0.245893255f, 0.0144833643f},
-std::array<float,2>{0.54137218f, 0.880899787f},
-std::array<float,2>{0.779857516f, 0.389211863f},
-std::array<float,2>{0.261081934f, 0.728294075f},
-std::array<float,2>{0.352105558f, 0.164785728f},
-std::array<float,2>{0.84279561f, 0.824901164f},
-std::array<float,2>{0.564450443f, 0.337499648f},
-std::array<float,2>{0.154285893f, 0.517370224f},
-std::array<float,2>{0.0939232633f, 0.450569838f},
-std::array<float,2>{0.728793621f, 0.675592899f},
-std::array<float,2>{0.929718673f, 0.104373805f},
-std::array<float,2>{0.440250486f, 0.951818109f},
-std::array<float,2>{0.299625278f, 0.418306351f},
-std::array<float,2>{0.793596983f, 0.697701395f},
-std::array<float,2>{0.502373397f, 0.0410075672f},
-std::array<float,2>{0.191265643f, 0.916079521f},
-std::array<float,2>{0.0402460694f, 0.246389225f},
-std::array<float,2>{0.636260688f, 0.751456261f},
-std::array<float,2>{0.937926352f, 0.301315755f},
-std::array<float,2>{0.43459776f, 0.589856863f},
-std::array<float,2>{0.480006188f, 0.0637327507f},
-std::array<float,2>{0.895713568f, 0.998063028f},
-std::array<float,2>{0.713221431f, 0.476882309f},
-std::array<float,2>{0.0697294697f, 0.650438964f},
-std::array<float,2>{0.171815783f, 0.359560579f},
-std::array<float,2>{0.593937933f, 0.535588801f},
-std::array<float,2>{0.874300122f, 0.134344786f},
-std::array<float,2>{0.337636769f, 0.851749063f},
-std::array<float,2>{0.426559389f, 0.378525645f},
-std::array<float,2>{0.95016247f, 0.722961187f},
-std::array<float,2>{0.630393684f, 0.00709491083f},
-std::array<float,2>{0.0356588215f, 0.889628947f},
-std::array<float,2>{0.198934391f, 0.21677801f},
-std::array<float,2>{0.508511364f, 0.807784855f},
-std::array<float,2>{0.783347964f, 0.267195463f},
-std::array<float,2>{0.311069131f, 0.609658957f},
-std::array<float,2>{0.32820186f, 0.0977216065f},
-std::array<float,2>{0.859514952f, 0.942339718f},
-std::array<float,2>{0.602227271f, 0.444365114f},
-std::array<float,2>{0.157965764f, 0.682376266f},
-std::array<float,2>{0.0744631737f, 0.328928888f},
-std::array<float,2>{0.707525909f, 0.523571193f},
-std::array<float,2>{0.905908585f, 0.162233636f},
-std::array<float,2>{0.470002562f, 0.815678596f},
-std::array<float,2>{0.255674481f, 0.307678044f},
-std::array<float,2>{0.766829491f, 0.585556269f},
-std::array<float,2>{0.537775338f, 0.237427339f},
-std::array<float,2>{0.239589199f, 0.757816851f},
-std::array<float,2>{0.00978176389f, 0.0349248238f},
-std::array<float,2>{0.680326879f, 0.910471499f},
-std::array<float,2>{0.986071169f, 0.411723822f},
-std::array<float,2>{0.398128808f, 0.692890644f},
-std::array<float,2>{0.448063225f, 0.129288182f},
-std::array<float,2>{0.92353785f, 0.849478781f},
-std::array<float,2>{0.718963027f, 0.374498099f},
-std::array<float,2>{0.105370477f, 0.546817303f},
-std::array<float,2>{0.140712574f, 0.47233966f},
-std::array<float,2>{0.572193384f, 0.642033458f},
-std::array<float,2>{0.833350062f, 0.0711986944f},
-std::array<float,2>{0.345995814f, 0.986118317f},
-std::array<float,2>{0.486000299f, 0.348907918f},
-std::array<float,2>{0.878952265f, 0.548319757f},
-std::array<float,2>{0.695488632f, 0.147842258f},
-std::array<float,2>{0.0816456079f, 0.865148485f},
-std::array<float,2>{0.172349572f, 0.0848312899f},
-std::array<float,2>{0.62131089f, 0.971148968f},
-std::array<float,2>{0.854517162f, 0.498345315f},
-std::array<float,2>{0.323054254f, 0.630763352f},
-std::array<float,2>{0.292135388f, 0.224521816f},
-std::array<float,2>{0.798120797f, 0.7667467f},
-std::array<float,2>{0.527988911f, 0.292595446f},
-std::array<float,2>{0.212218031f, 0.577871561f},
-std::array<float,2>{0.0597733334f, 0.422918558f},
-std::array<float,2>{0.641720772f, 0.705264866f},
-std::array<float,2>{0.965297937f, 0.0590985082f},
-std::array<float,2>{0.419894248f, 0.928983748f},
-std::array<float,2>{0.368643641f, 0.46469906f},
-std::array<float,2>{0.824510038f, 0.658463955f},
-std::array<float,2>{0.589903116f, 0.116505973f},
-std::array<float,2>{0.137280583f, 0.961675167f},
-std::array<float,2>{0.119177327f, 0.172842786f},
-std::array<float,2>{0.744018793f, 0.830576301f},
-std::array<float,2>{0.918276012f, 0.321760058f},
-std::array<float,2>{0.459517479f, 0.500333309f},
-std::array<float,2>{0.386932701f, 0.0207707882f},
-std::array<float,2>{0.971336186f, 0.896723449f},
-std::array<float,2>{0.665241838f, 0.392139018f},
-std::array<float,2>{0.028561512f, 0.739529192f},
-std::array<float,2>{0.225651413f, 0.250227571f},
-std::array<float,2>{0.547623992f, 0.596176147f},
-std::array<float,2>{0.765227675f, 0.193068817f},
-std::array<float,2>{0.271359533f, 0.791427314f},
-std::array<float,2>{0.475433826f, 0.429879755f},
-std::array<float,2>{0.899513721f, 0.718273342f},
-std::array<float,2>{0.705650806f, 0.0527203344f},
-std::array<float,2>{0.0741630048f, 0.930588245f},
-std::array<float,2>{0.163187891f, 0.227173373f},
-std::array<float,2>{0.607784986f, 0.779406965f},
-std::array<float,2>{0.865551651f, 0.285435289f},
-std::array<float,2>{0.334634185f, 0.56365186f},
-std::array<float,2>{0.307859957f, 0.0874206945f},
-std::array<float,2>{0.788517594f, 0.979192078f},
-std::array<float,2>{0.513220429f, 0.485528141f},
-std::array<float,2>{0.200040787f, 0.63392061f},
-std::array<float,2>{0.0329613872f, 0.353792548f},
-std::array<float,2>{0.626414835f, 0.560501337f},
-std::array<float,2>{0.947964728f, 0.150360316f},
-std::array<float,2>{0.42407158f, 0.874482214f},
-std::array<float,2>{0.350129396f, 0.263410181f},
-std::array<float,2>{0.830459654f, 0.605938554f},
-std::array<float,2>{0.577942312f, 0.20029749f},
-std::array<float,2>{0.144891188f, 0.7814852f},
-std::array<float,2>{0.106217854f, 0.028053835f},
-std::array<float,2>{0.726205468f, 0.899228036f},
-std::array<float,2>{0.929494083f, 0.399221003f},
-std::array<float,2>{0.452041179f, 0.74852246f},
-std::array<float,2>{0.393733084f, 0.183499366f},
-std::array<float,2>{0.989137352f, 0.840176105f},
-std::array<float,2>{0.687177122f, 0.313656598f},
-std::array<float,2>{0.0141037144f, 0.508770883f},
-std::array<float,2>{0.235331297f, 0.458463758f},
-std::array<float,2>{0.532029808f, 0.667222023f},
-std::array<float,2>{0.76961273f, 0.117239013f},
-std::array<float,2>{0.252525389f, 0.958181262f},
-std::array<float,2>{0.416374892f, 0.342713654f},
-std::array<float,2>{0.964743376f, 0.52207011f},
-std::array<float,2>{0.645937562f, 0.170916885f},
-std::array<float,2>{0.0565408953f, 0.82320255f},
-std::array<float,2>{0.217288807f, 0.106746972f},
-std::array<float,2>{0.524919569f, 0.94901526f},
-std::array<float,2>{0.800926149f, 0.449124008f},
-std::array<float,2>{0.29453069f, 0.675883591f},
-std::array<float,2>{0.326212883f, 0.208405092f},
-std::array<float,2>{0.857167721f, 0.801777065f},
-std::array<float,2>{0.61798209f, 0.275415957f},
-std::array<float,2>{0.176246241f, 0.622867107f},
-std::array<float,2>{0.0845228806f, 0.384190649f},
-std::array<float,2>{0.701487124f, 0.733244181f},
-std::array<float,2>{0.878166258f, 0.0109930551f},
-std::array<float,2>{0.490908355f, 0.875898838f},
-std::array<float,2>{0.266909659f, 0.481030226f},
-std::array<float,2>{0.759850264f, 0.654269755f},
-std::array<float,2>{0.554026008f, 0.0665565953f},
-std::array<float,2>{0.222064048f, 0.994560003f},
-std::array<float,2>{0.0269902293f, 0.138295114f},
-std::array<float,2>{0.669222891f, 0.85584861f},
-std::array<float,2>{0.975657046f, 0.366504341f},
-std::array<float,2>{0.386475027f, 0.531328797f},
-std::array<float,2>{0.456934661f, 0.0448573716f},
-std::array<float,2>{0.917843521f, 0.920656025f},
-std::array<float,2>{0.746269822f, 0.415045291f},
-std::array<float,2>{0.121373162f, 0.702351153f},
-std::array<float,2>{0.134411216f, 0.299160987f},
-std::array<float,2>{0.586271703f, 0.586045265f},
-std::array<float,2>{0.820607305f, 0.245977476f},
-std::array<float,2>{0.371538013f, 0.756175339f},
-std::array<float,2>{0.378176659f, 0.438379049f},
-std::array<float,2>{0.977181315f, 0.685581446f},
-std::array<float,2>{0.66143477f, 0.0960153565f},
-std::array<float,2>{0.0215678234f, 0.939378023f},
-std::array<float,2>{0.233163834f, 0.156536445f},
-std::array<float,2>{0.556053162f, 0.818798125f},
-std::array<float,2>{0.754399836f, 0.334684879f},
-std::array<float,2>{0.273814201f, 0.531069815f},
-std::array<float,2>{0.361504555f, 0.00293886731f},
-std::array<float,2>{0.813435256f, 0.886270881f},
-std::array<float,2>{0.584643066f, 0.380401969f},
-std::array<float,2>{0.130489275f, 0.720565557f},
-std::array<float,2>{0.115781687f, 0.273423493f},
-std::array<float,2>{0.740083635f, 0.614464402f},
-std::array<float,2>{0.907445252f, 0.211026415f},
-std::array<float,2>{0.461227268f, 0.812460959f},
-std::array<float,2>{0.286339432f, 0.370465726f},
-std::array<float,2>{0.808128178f, 0.540397644f},
-std::array<float,2>{0.519605219f, 0.127354234f},
-std::array<float,2>{0.209614262f, 0.844204962f},
-std::array<float,2>{0.0506505184f, 0.0777482763f},
-std::array<float,2>{0.656099021f, 0.990443468f},
-std::array<float,2>{0.953833282f, 0.475027114f},
-std::array<float,2>{0.407840222f, 0.647445142f},
-std::array<float,2>{0.495252907f, 0.241257563f},
-std::array<float,2>{0.887454748f, 0.762927115f},
-std::array<float,2>{0.688184738f, 0.310162574f},
-std::array<float,2>{0.0875822082f, 0.580038249f},
-std::array<float,2>{0.180167273f, 0.408062935f},
-std::array<float,2>{0.616485536f, 0.690851867f},
-std::array<float,2>{0.845458031f, 0.0354839936f},
-std::array<float,2>{0.316398114f, 0.906778097f},
-std::array<float,2>{0.444601387f, 0.296721488f},
-std::array<float,2>{0.934500039f, 0.571964383f},
-std::array<float,2>{0.733593225f, 0.218979374f},
-std::array<float,2>{0.0997074991f, 0.770568728f},
-std::array<float,2>{0.150024295f, 0.0576272383f},
-std::array<float,2>{0.566670835f, 0.924530804f},
-std::array<float,2>{0.839651704f, 0.427964091f},
-std::array<float,2>{0.357904881f, 0.707616866f},
-std::array<float,2>{0.262643725f, 0.141999841f},
-std::array<float,2>{0.773853123f, 0.862308085f},
-std::array<float,2>{0.546693921f, 0.347077817f},
-std::array<float,2>{0.249475539f, 0.552042127f},
-std::array<float,2>{0.000213694031f, 0.495207608f},
-std::array<float,2>{0.67650336f, 0.627755404f},
-std::array<float,2>{0.992761016f, 0.0812020227f},
-std::array<float,2>{0.40537256f, 0.97629714f},
-std::array<float,2>{0.342713326f, 0.397432595f},
-std::array<float,2>{0.868117988f, 0.736027598f},
-std::array<float,2>{0.598167539f, 0.0167989209f},
-std::array<float,2>{0.164249137f, 0.891893387f},
-std::array<float,2>{0.0658871308f, 0.188569978f},
-std::array<float,2>{0.718285978f, 0.793008506f},
-std::array<float,2>{0.892038047f, 0.255775332f},
-std::array<float,2>{0.482793957f, 0.600846589f},
-std::array<float,2>{0.431378961f, 0.111153483f},
-std::array<float,2>{0.943855166f, 0.965437472f},
-std::array<float,2>{0.639282763f, 0.4662669f},
-std::array<float,2>{0.0444944128f, 0.660732687f},
-std::array<float,2>{0.193931371f, 0.326526076f},
-std::array<float,2>{0.505693316f, 0.504956782f},
-std::array<float,2>{0.789846122f, 0.176261365f},
-std::array<float,2>{0.302626073f, 0.835596144f},
-std::array<float,2>{0.476956546f, 0.478391528f},
-std::array<float,2>{0.896579623f, 0.651686788f},
-std::array<float,2>{0.711542785f, 0.0629670471f},
-std::array<float,2>{0.0679828823f, 0.999520242f},
-std::array<float,2>{0.169322178f, 0.133221909f},
-std::array<float,2>{0.596434355f, 0.852911413f},
-std::array<float,2>{0.872580111f, 0.360722572f},
-std::array<float,2>{0.339201212f, 0.536753535f},
-std::array<float,2>{0.296981961f, 0.0398362651f},
-std::array<float,2>{0.796377957f, 0.917154431f},
-std::array<float,2>{0.501388609f, 0.419282168f},
-std::array<float,2>{0.187722698f, 0.698641777f},
-std::array<float,2>{0.0418990329f, 0.302007079f},
-std::array<float,2>{0.634002328f, 0.591761172f},
-std::array<float,2>{0.940508366f, 0.247564748f},
-std::array<float,2>{0.435575038f, 0.750636339f},
-std::array<float,2>{0.35389927f, 0.336853951f},
-std::array<float,2>{0.840544581f, 0.515678883f},
-std::array<float,2>{0.564920068f, 0.165234149f},
-std::array<float,2>{0.155625612f, 0.825804174f},
-std::array<float,2>{0.0963783041f, 0.105322033f},
-std::array<float,2>{0.728207529f, 0.952347875f},
-std::array<float,2>{0.933367372f, 0.450167596f},
-std::array<float,2>{0.438571006f, 0.674145162f},
-std::array<float,2>{0.400430799f, 0.205828339f},
-std::array<float,2>{0.999797165f, 0.800503373f},
-std::array<float,2>{0.675747931f, 0.277926326f},
-std::array<float,2>{0.0061117541f, 0.617713273f},
-std::array<float,2>{0.243798271f, 0.39007628f},
-std::array<float,2>{0.53967309f, 0.727452457f},
-std::array<float,2>{0.778788626f, 0.0153362807f},
-std::array<float,2>{0.259068102f, 0.882157683f},
-std::array<float,2>{0.411853462f, 0.257993251f},
-std::array<float,2>{0.960542738f, 0.605463982f},
-std::array<float,2>{0.651176572f, 0.195904076f},
-std::array<float,2>{0.0512069874f, 0.788512945f},
-std::array<float,2>{0.204322562f, 0.024010282f},
-std::array<float,2>{0.516373158f, 0.903398454f},
-std::array<float,2>{0.81241703f, 0.404546618f},
-std::array<float,2>{0.285009146f, 0.744742334f},
-std::array<float,2>{0.317030579f, 0.185049966f},
-std::array<float,2>{0.848736882f, 0.835988939f},
-std::array<float,2>{0.611963987f, 0.318192452f},
-std::array<float,2>{0.185917333f, 0.513706088f},
-std::array<float,2>{0.0931876153f, 0.454871863f},
-std::array<float,2>{0.694300234f, 0.668263972f},
-std::array<float,2>{0.883446038f, 0.124903843f},
-std::array<float,2>{0.497768372f, 0.956051648f},
-std::array<float,2>{0.280932218f, 0.433688134f},
-std::array<float,2>{0.75051409f, 0.71414727f},
-std::array<float,2>{0.560486257f, 0.0475653112f},
-std::array<float,2>{0.230052233f, 0.935742795f},
-std::array<float,2>{0.0173835084f, 0.234126493f},
-std::array<float,2>{0.657497823f, 0.777008533f},
-std::array<float,2>{0.982730269f, 0.282008946f},
-std::array<float,2>{0.382037908f, 0.568276227f},
-std::array<float,2>{0.467155039f, 0.0914127976f},
-std::array<float,2>{0.910344481f, 0.983409643f},
-std::array<float,2>{0.734683871f, 0.489913315f},
-std::array<float,2>{0.109650292f, 0.640047431f},
-std::array<float,2>{0.125728056f, 0.355772436f},
-std::array<float,2>{0.579939961f, 0.556742251f},
-std::array<float,2>{0.818270504f, 0.155625343f},
-std::array<float,2>{0.365591675f, 0.868932366f},
-std::array<float,2>{0.389288068f, 0.390774429f},
-std::array<float,2>{0.96902585f, 0.73911202f},
-std::array<float,2>{0.66764611f, 0.0199515913f},
-std::array<float,2>{0.0304708183f, 0.898221552f},
-std::array<float,2>{0.223938301f, 0.192316204f},
-std::array<float,2>{0.550320327f, 0.792090714f},
-std::array<float,2>{0.76337868f, 0.251819998f},
-std::array<float,2>{0.271559626f, 0.596832335f},
-std::array<float,2>{0.370424271f, 0.116162725f},
-std::array<float,2>{0.826514304f, 0.962010741f},
-std::array<float,2>{0.592048526f, 0.463788092f},
-std::array<float,2>{0.140166029f, 0.659931183f},
-std::array<float,2>{0.117265001f, 0.321271092f},
-std::array<float,2>{0.74573046f, 0.501157403f},
-std::array<float,2>{0.919952273f, 0.173746645f},
-std::array<float,2>{0.458621442f, 0.831901014f},
-std::array<float,2>{0.289512873f, 0.291597188f},
-std::array<float,2>{0.799517214f, 0.576921821f},
-std::array<float,2>{0.529644847f, 0.223149374f},
-std::array<float,2>{0.213354349f, 0.766212165f},
-std::array<float,2>{0.060895551f, 0.060271427f},
-std::array<float,2>{0.644141197f, 0.927895844f},
-std::array<float,2>{0.967240632f, 0.422023743f},
-std::array<float,2>{0.420467734f, 0.70665741f},
-std::array<float,2>{0.486427546f, 0.14741458f},
-std::array<float,2>{0.88187331f, 0.864052296f},
-std::array<float,2>{0.697533727f, 0.348455042f},
-std::array<float,2>{0.078401573f, 0.546895802f},
-std::array<float,2>{0.174880177f, 0.499792486f},
-std::array<float,2>{0.62486732f, 0.629304051f},
-std::array<float,2>{0.85263133f, 0.0857492909f},
-std::array<float,2>{0.321518123f, 0.971769571f},
-std::array<float,2>{0.445771962f, 0.373124152f},
-std::array<float,2>{0.925008118f, 0.545710325f},
-std::array<float,2>{0.722037137f, 0.129964292f},
-std::array<float,2>{0.102367051f, 0.848449945f},
-std::array<float,2>{0.143890083f, 0.0718083754f},
-std::array<float,2>{0.573038816f, 0.984837413f},
-std::array<float,2>{0.835073054f, 0.471378267f},
-std::array<float,2>{0.34514451f, 0.641382873f},
-std::array<float,2>{0.256751776f, 0.23723276f},
-std::array<float,2>{0.768244088f, 0.758838654f},
-std::array<float,2>{0.535483956f, 0.306821764f},
-std::array<float,2>{0.241597325f, 0.584082425f},
-std::array<float,2>{0.00929738209f, 0.410513133f},
-std::array<float,2>{0.681652188f, 0.692237556f},
-std::array<float,2>{0.987950623f, 0.0332983024f},
-std::array<float,2>{0.395872355f, 0.911724269f},
-std::array<float,2>{0.33011204f, 0.443596393f},
-std::array<float,2>{0.862852752f, 0.683260441f},
-std::array<float,2>{0.604488671f, 0.0993616059f},
-std::array<float,2>{0.159654781f, 0.943259358f},
-std::array<float,2>{0.0764300749f, 0.163655683f},
-std::array<float,2>{0.709964514f, 0.815001905f},
-std::array<float,2>{0.903408289f, 0.329883575f},
-std::array<float,2>{0.472651124f, 0.525207222f},
-std::array<float,2>{0.428876132f, 0.0064625619f},
-std::array<float,2>{0.953083158f, 0.889778018f},
-std::array<float,2>{0.632008553f, 0.377267927f},
-std::array<float,2>{0.0384739116f, 0.723781586f},
-std::array<float,2>{0.195511967f, 0.266405225f},
-std::array<float,2>{0.509982824f, 0.611002445f},
-std::array<float,2>{0.782995582f, 0.214964241f},
-std::array<float,2>{0.309588343f, 0.806715429f},
-std::array<float,2>{0.453450501f, 0.414910764f},
-std::array<float,2>{0.91406709f, 0.701305628f},
-std::array<float,2>{0.749406993f, 0.043514125f},
-std::array<float,2>{0.123526148f, 0.921083331f},
-std::array<float,2>{0.136398152f, 0.244744599f},
-std::array<float,2>{0.589192152f, 0.757451415f},
-std::array<float,2>{0.82233417f, 0.300551534f},
-std::array<float,2>{0.374597967f, 0.587816417f},
-std::array<float,2>{0.268354326f, 0.0682511926f},
-std::array<float,2>{0.759310901f, 0.995363712f},
-std::array<float,2>{0.552729368f, 0.482035249f},
-std::array<float,2>{0.218946308f, 0.652694941f},
-std::array<float,2>{0.0246344972f, 0.365273744f},
-std::array<float,2>{0.670086324f, 0.53231889f},
-std::array<float,2>{0.973902881f, 0.136773974f},
-std::array<float,2>{0.383939594f, 0.857154131f},
-std::array<float,2>{0.324956387f, 0.276632339f},
-std::array<float,2>{0.858122885f, 0.621965528f},
-std::array<float,2>{0.620650947f, 0.207910061f},
-std::array<float,2>{0.178107649f, 0.801189661f},
-std::array<float,2>{0.0822863951f, 0.00998825766f},
-std::array<float,2>{0.700376987f, 0.876344323f},
-std::array<float,2>{0.875908434f, 0.383200794f},
-std::array<float,2>{0.488502741f, 0.733695507f},
-std::array<float,2>{0.414756626f, 0.170503765f},
-std::array<float,2>{0.960998893f, 0.823686957f},
-std::array<float,2>{0.647634327f, 0.34345296f},
-std::array<float,2>{0.0579461008f, 0.523421288f},
-std::array<float,2>{0.215698332f, 0.448175937f},
-std::array<float,2>{0.526710212f, 0.67715174f},
-std::array<float,2>{0.804090738f, 0.105534427f},
-std::array<float,2>{0.2958211f, 0.948217154f},
-std::array<float,2>{0.392181367f, 0.313164175f},
-std::array<float,2>{0.990643561f, 0.508946955f},
-std::array<float,2>{0.684381783f, 0.181976005f},
-std::array<float,2>{0.0121945497f, 0.840905547f},
-std::array<float,2>{0.237420663f, 0.118458569f},
-std::array<float,2>{0.534083962f, 0.957909465f},
-std::array<float,2>{0.773286462f, 0.457078189f},
-std::array<float,2>{0.250014901f, 0.666227996f},
-std::array<float,2>{0.348368943f, 0.199835822f},
-std::array<float,2>{0.828160703f, 0.78237772f},
-std::array<float,2>{0.575631499f, 0.262218803f},
-std::array<float,2>{0.148352638f, 0.606690764f},
-std::array<float,2>{0.107681207f, 0.400182784f},
-std::array<float,2>{0.723277152f, 0.749497771f},
-std::array<float,2>{0.92610985f, 0.0284617413f},
-std::array<float,2>{0.450176448f, 0.90026629f},
-std::array<float,2>{0.306279272f, 0.484456003f},
-std::array<float,2>{0.786868513f, 0.632923424f},
-std::array<float,2>{0.514546573f, 0.086461015f},
-std::array<float,2>{0.202297196f, 0.980328739f},
-std::array<float,2>{0.0347305983f, 0.149147764f},
-std::array<float,2>{0.627213776f, 0.873261511f},
-std::array<float,2>{0.945465982f, 0.354839414f},
-std::array<float,2>{0.42264083f, 0.558678329f},
-std::array<float,2>{0.474447489f, 0.0515703447f},
-std::array<float,2>{0.900626421f, 0.930766404f},
-std::array<float,2>{0.704372168f, 0.430781513f},
-std::array<float,2>{0.070427835f, 0.717687428f},
-std::array<float,2>{0.161072999f, 0.286696374f},
-std::array<float,2>{0.606847405f, 0.563450634f},
-std::array<float,2>{0.86514914f, 0.227743059f},
-std::array<float,2>{0.333243608f, 0.78042382f},
-std::array<float,2>{0.431660116f, 0.46514228f},
-std::array<float,2>{0.94278729f, 0.661887825f},
-std::array<float,2>{0.638625503f, 0.109409854f},
-std::array<float,2>{0.0466022938f, 0.966715932f},
-std::array<float,2>{0.191924408f, 0.177264795f},
-std::array<float,2>{0.507397473f, 0.83415699f},
-std::array<float,2>{0.791811049f, 0.328078926f},
-std::array<float,2>{0.303206444f, 0.504160285f},
-std::array<float,2>{0.340652138f, 0.0161870383f},
-std::array<float,2>{0.870924711f, 0.891546965f},
-std::array<float,2>{0.600689352f, 0.397754759f},
-std::array<float,2>{0.167165995f, 0.735200524f},
-std::array<float,2>{0.0627296418f, 0.254427224f},
-std::array<float,2>{0.716433167f, 0.600137889f},
-std::array<float,2>{0.8928473f, 0.188091382f},
-std::array<float,2>{0.480915457f, 0.79477489f},
-std::array<float,2>{0.2652843f, 0.346388221f},
-std::array<float,2>{0.776235163f, 0.550925195f},
-std::array<float,2>{0.544763327f, 0.141454682f},
-std::array<float,2>{0.246869296f, 0.862060368f},
-std::array<float,2>{0.00294667878f, 0.0806440562f},
-std::array<float,2>{0.679534018f, 0.975164235f},
-std::array<float,2>{0.996061027f, 0.494941413f},
-std::array<float,2>{0.4042705f, 0.628804266f},
-std::array<float,2>{0.441548675f, 0.220600471f},
-std::array<float,2>{0.93710357f, 0.770475507f},
-std::array<float,2>{0.731854558f, 0.295140684f},
-std::array<float,2>{0.0977756679f, 0.570969284f},
-std::array<float,2>{0.15213348f, 0.42952919f},
-std::array<float,2>{0.56858021f, 0.708014071f},
-std::array<float,2>{0.837295234f, 0.0571652949f},
-std::array<float,2>{0.357156575f, 0.924947977f},
-std::array<float,2>{0.493159503f, 0.309563458f},
-std::array<float,2>{0.890486538f, 0.578709245f},
-std::array<float,2>{0.690145612f, 0.241021007f},
-std::array<float,2>{0.088914305f, 0.762043417f},
-std::array<float,2>{0.181770995f, 0.0361970067f},
-std::array<float,2>{0.614786267f, 0.90797472f},
-std::array<float,2>{0.845875204f, 0.40686813f},
-std::array<float,2>{0.313004851f, 0.689662516f},
-std::array<float,2>{0.288982242f, 0.128455684f},
-std::array<float,2>{0.805282235f, 0.845501006f},
-std::array<float,2>{0.521731913f, 0.370052189f},
-std::array<float,2>{0.208787203f, 0.539536774f},
-std::array<float,2>{0.047360044f, 0.476205468f},
-std::array<float,2>{0.653288603f, 0.647748828f},
-std::array<float,2>{0.957030177f, 0.0763270482f},
-std::array<float,2>{0.409151167f, 0.992055535f},
-std::array<float,2>{0.36105755f, 0.379339933f},
-std::array<float,2>{0.815048218f, 0.719456911f},
-std::array<float,2>{0.583724439f, 0.00203139056f},
-std::array<float,2>{0.131332383f, 0.885247827f},
-std::array<float,2>{0.115171909f, 0.211953923f},
-std::array<float,2>{0.741869152f, 0.810833275f},
-std::array<float,2>{0.910036385f, 0.271835893f},
-std::array<float,2>{0.464478046f, 0.613896012f},
-std::array<float,2>{0.376590759f, 0.0973492935f},
-std::array<float,2>{0.979590714f, 0.937589824f},
-std::array<float,2>{0.662785709f, 0.438957572f},
-std::array<float,2>{0.0203027502f, 0.687444508f},
-std::array<float,2>{0.230686471f, 0.335080177f},
-std::array<float,2>{0.558089137f, 0.530103326f},
-std::array<float,2>{0.756951809f, 0.157903448f},
-std::array<float,2>{0.276922286f, 0.819794297f},
-std::array<float,2>{0.441280842f, 0.452280343f},
-std::array<float,2>{0.930777252f, 0.671976149f},
-std::array<float,2>{0.729615927f, 0.102201216f},
-std::array<float,2>{0.0948437229f, 0.95015341f},
-std::array<float,2>{0.15259999f, 0.167486995f},
-std::array<float,2>{0.562624037f, 0.82621628f},
-std::array<float,2>{0.842580795f, 0.339127153f},
-std::array<float,2>{0.353093266f, 0.518545806f},
-std::array<float,2>{0.260506243f, 0.0117243137f},
-std::array<float,2>{0.781128466f, 0.880060732f},
-std::array<float,2>{0.542659998f, 0.387290239f},
-std::array<float,2>{0.244570374f, 0.729967713f},
-std::array<float,2>{0.00500454567f, 0.279970229f},
-std::array<float,2>{0.673214912f, 0.619397819f},
-std::array<float,2>{0.997413337f, 0.20461008f},
-std::array<float,2>{0.398635f, 0.797100306f},
-std::array<float,2>{0.33611232f, 0.363140315f},
-std::array<float,2>{0.873554051f, 0.538706779f},
-std::array<float,2>{0.59511447f, 0.136244327f},
-std::array<float,2>{0.170310199f, 0.854111791f},
-std::array<float,2>{0.0683653951f, 0.0660572499f},
-std::array<float,2>{0.71415168f, 0.996245503f},
-std::array<float,2>{0.894774675f, 0.478895992f},
-std::array<float,2>{0.478791386f, 0.649164736f},
-std::array<float,2>{0.4338485f, 0.249873713f},
-std::array<float,2>{0.9385553f, 0.753026903f},
-std::array<float,2>{0.634823501f, 0.303322464f},
-std::array<float,2>{0.0393735878f, 0.593354702f},
-std::array<float,2>{0.190066963f, 0.421176702f},
-std::array<float,2>{0.503568888f, 0.695841789f},
-std::array<float,2>{0.794052184f, 0.0412902236f},
-std::array<float,2>{0.299873799f, 0.914455056f},
-std::array<float,2>{0.379195541f, 0.28475678f},
-std::array<float,2>{0.981856644f, 0.570000231f},
-std::array<float,2>{0.65955162f, 0.231241688f},
-std::array<float,2>{0.0182445608f, 0.773736179f},
-std::array<float,2>{0.226962686f, 0.0493501723f},
-std::array<float,2>{0.560793042f, 0.934804738f},
-std::array<float,2>{0.753759921f, 0.436795861f},
-std::array<float,2>{0.279010385f, 0.711950839f},
-std::array<float,2>{0.363729388f, 0.153155625f},
-std::array<float,2>{0.819756925f, 0.870733917f},
-std::array<float,2>{0.581206501f, 0.35756737f},
-std::array<float,2>{0.128637388f, 0.55623889f},
-std::array<float,2>{0.112495616f, 0.49157539f},
-std::array<float,2>{0.737463832f, 0.638445318f},
-std::array<float,2>{0.912390947f, 0.0932788923f},
-std::array<float,2>{0.465611458f, 0.981582105f},
-std::array<float,2>{0.283169717f, 0.402656138f},
-std::array<float,2>{0.809746504f, 0.74271512f},
-std::array<float,2>{0.517589271f, 0.026046114f},
-std::array<float,2>{0.205085486f, 0.904952109f},
-std::array<float,2>{0.0540284216f, 0.198103771f},
-std::array<float,2>{0.649052262f, 0.786642075f},
-std::array<float,2>{0.958834291f, 0.261081398f},
-std::array<float,2>{0.413416624f, 0.602087498f},
-std::array<float,2>{0.499671221f, 0.122599706f},
-std::array<float,2>{0.885232985f, 0.954073429f},
-std::array<float,2>{0.693115771f, 0.455491036f},
-std::array<float,2>{0.0916433409f, 0.669929743f},
-std::array<float,2>{0.184899256f, 0.320311576f},
-std::array<float,2>{0.609586895f, 0.512787998f},
-std::array<float,2>{0.850638509f, 0.185760513f},
-std::array<float,2>{0.320242912f, 0.838374674f},
-std::array<float,2>{0.418741345f, 0.424975127f},
-std::array<float,2>{0.966433942f, 0.704272926f},
-std::array<float,2>{0.64103651f, 0.0623233467f},
-std::array<float,2>{0.0593894944f, 0.9274382f},
-std::array<float,2>{0.211682469f, 0.225049332f},
-std::array<float,2>{0.52871424f, 0.769344509f},
-std::array<float,2>{0.797029734f, 0.290042341f},
-std::array<float,2>{0.291639864f, 0.575737536f},
-std::array<float,2>{0.324089527f, 0.0837673694f},
-std::array<float,2>{0.853651047f, 0.969703913f},
-std::array<float,2>{0.62293601f, 0.496803969f},
-std::array<float,2>{0.172862694f, 0.631568789f},
-std::array<float,2>{0.0805193037f, 0.350248575f},
-std::array<float,2>{0.696354926f, 0.548855186f},
-std::array<float,2>{0.879947126f, 0.145010993f},
-std::array<float,2>{0.484445125f, 0.866352558f},
-std::array<float,2>{0.270059019f, 0.252300262f},
-std::array<float,2>{0.764211118f, 0.594454288f},
-std::array<float,2>{0.548338115f, 0.193674311f},
-std::array<float,2>{0.225426793f, 0.790071666f},
-std::array<float,2>{0.0279299784f, 0.0225058813f},
-std::array<float,2>{0.664602637f, 0.89566642f},
-std::array<float,2>{0.972135246f, 0.394406736f},
-std::array<float,2>{0.388574064f, 0.741709471f},
-std::array<float,2>{0.460795909f, 0.174232125f},
-std::array<float,2>{0.919254124f, 0.829428554f},
-std::array<float,2>{0.742741227f, 0.324001253f},
-std::array<float,2>{0.120232902f, 0.503577471f},
-std::array<float,2>{0.13818267f, 0.461963773f},
-std::array<float,2>{0.591188729f, 0.656763375f},
-std::array<float,2>{0.825331211f, 0.113495238f},
-std::array<float,2>{0.3672584f, 0.963850558f},
-std::array<float,2>{0.469501197f, 0.331400514f},
-std::array<float,2>{0.90460825f, 0.525680542f},
-std::array<float,2>{0.708412707f, 0.161713973f},
-std::array<float,2>{0.0752698332f, 0.812933445f},
-std::array<float,2>{0.156567991f, 0.101466499f},
-std::array<float,2>{0.603065372f, 0.945178151f},
-std::array<float,2>{0.861294627f, 0.44266665f},
-std::array<float,2>{0.329993457f, 0.680051148f},
-std::array<float,2>{0.311910063f, 0.217398301f},
-std::array<float,2>{0.784280121f, 0.806425393f},
-std::array<float,2>{0.509732187f, 0.267999619f},
-std::array<float,2>{0.197274715f, 0.612163842f},
-std::array<float,2>{0.0364382491f, 0.375763655f},
-std::array<float,2>{0.629773557f, 0.724838436f},
-std::array<float,2>{0.950994253f, 0.00553892553f},
-std::array<float,2>{0.427470237f, 0.887720048f},
-std::array<float,2>{0.347193003f, 0.468779564f},
-std::array<float,2>{0.832845032f, 0.643681228f},
-std::array<float,2>{0.570613086f, 0.0732117891f},
-std::array<float,2>{0.14173387f, 0.986376166f},
-std::array<float,2>{0.104093939f, 0.132398307f},
-std::array<float,2>{0.720133424f, 0.850635469f},
-std::array<float,2>{0.922005594f, 0.372277737f},
-std::array<float,2>{0.44875592f, 0.543410182f},
-std::array<float,2>{0.396552026f, 0.0313270092f},
-std::array<float,2>{0.984682083f, 0.912506104f},
-std::array<float,2>{0.681112647f, 0.413097203f},
-std::array<float,2>{0.0107683856f, 0.694167733f},
-std::array<float,2>{0.238763735f, 0.304963142f},
-std::array<float,2>{0.538991928f, 0.583483875f},
-std::array<float,2>{0.765937805f, 0.236321747f},
-std::array<float,2>{0.254216433f, 0.760696888f},
-std::array<float,2>{0.492063075f, 0.385365158f},
-std::array<float,2>{0.877374113f, 0.731035054f},
-std::array<float,2>{0.702339947f, 0.00882966816f},
-std::array<float,2>{0.0858873948f, 0.877534091f},
-std::array<float,2>{0.177201137f, 0.210289583f},
-std::array<float,2>{0.618856788f, 0.803628683f},
-std::array<float,2>{0.856304586f, 0.275038421f},
-std::array<float,2>{0.328006715f, 0.623412251f},
-std::array<float,2>{0.293469787f, 0.107824042f},
-std::array<float,2>{0.801890314f, 0.946957767f},
-std::array<float,2>{0.523730695f, 0.445368052f},
-std::array<float,2>{0.218368888f, 0.6778391f},
-std::array<float,2>{0.0556200966f, 0.341025174f},
-std::array<float,2>{0.64472878f, 0.521234155f},
-std::array<float,2>{0.963546991f, 0.168328181f},
-std::array<float,2>{0.417580187f, 0.821730494f},
-std::array<float,2>{0.372685671f, 0.297996372f},
-std::array<float,2>{0.821567059f, 0.588612974f},
-std::array<float,2>{0.586917877f, 0.242622718f},
-std::array<float,2>{0.133209988f, 0.755068719f},
-std::array<float,2>{0.12284223f, 0.0463951342f},
-std::array<float,2>{0.747469902f, 0.918689907f},
-std::array<float,2>{0.916556716f, 0.417048931f},
-std::array<float,2>{0.455424309f, 0.699725807f},
-std::array<float,2>{0.385282516f, 0.140425429f},
-std::array<float,2>{0.974998474f, 0.857881725f},
-std::array<float,2>{0.66827333f, 0.36409983f},
-std::array<float,2>{0.0257365834f, 0.533208609f},
-std::array<float,2>{0.221090481f, 0.483478367f},
-std::array<float,2>{0.552860796f, 0.656063378f},
-std::array<float,2>{0.761309028f, 0.070074819f},
-std::array<float,2>{0.266255379f, 0.992618203f},
-std::array<float,2>{0.425749153f, 0.351825148f},
-std::array<float,2>{0.948709071f, 0.561113715f},
-std::array<float,2>{0.625251055f, 0.150471762f},
-std::array<float,2>{0.0319687389f, 0.871662378f},
-std::array<float,2>{0.200825438f, 0.0880364925f},
-std::array<float,2>{0.512667418f, 0.976837158f},
-std::array<float,2>{0.787674665f, 0.488235712f},
-std::array<float,2>{0.307290733f, 0.636377871f},
-std::array<float,2>{0.335672408f, 0.229987726f},
-std::array<float,2>{0.866316676f, 0.777466953f},
-std::array<float,2>{0.608787119f, 0.287917703f},
-std::array<float,2>{0.162585586f, 0.566178024f},
-std::array<float,2>{0.0725258067f, 0.432367563f},
-std::array<float,2>{0.706108451f, 0.714931428f},
-std::array<float,2>{0.899338543f, 0.0544103123f},
-std::array<float,2>{0.475682408f, 0.933356524f},
-std::array<float,2>{0.253185928f, 0.459983796f},
-std::array<float,2>{0.771015823f, 0.664744258f},
-std::array<float,2>{0.532980144f, 0.120945819f},
-std::array<float,2>{0.235434413f, 0.959048748f},
-std::array<float,2>{0.0155139584f, 0.180257738f},
-std::array<float,2>{0.685701132f, 0.842286766f},
-std::array<float,2>{0.990066767f, 0.314713866f},
-std::array<float,2>{0.392668903f, 0.509881675f},
-std::array<float,2>{0.45300597f, 0.0308444723f},
-std::array<float,2>{0.927805603f, 0.902309895f},
-std::array<float,2>{0.724960506f, 0.400545299f},
-std::array<float,2>{0.106499657f, 0.747106135f},
-std::array<float,2>{0.146089762f, 0.26386106f},
-std::array<float,2>{0.576229095f, 0.608570457f},
-std::array<float,2>{0.831078887f, 0.202058241f},
-std::array<float,2>{0.351193458f, 0.783629894f},
-std::array<float,2>{0.404437393f, 0.492390364f},
-std::array<float,2>{0.993335724f, 0.625945628f},
-std::array<float,2>{0.677632093f, 0.0785943717f},
-std::array<float,2>{0.00151937699f, 0.972699285f},
-std::array<float,2>{0.248051599f, 0.1436079f},
-std::array<float,2>{0.545787096f, 0.859955132f},
-std::array<float,2>{0.775073826f, 0.345327318f},
-std::array<float,2>{0.263522804f, 0.553744793f},
-std::array<float,2>{0.358427852f, 0.0561336838f},
-std::array<float,2>{0.838638961f, 0.922022998f},
-std::array<float,2>{0.568297446f, 0.426150024f},
-std::array<float,2>{0.149208069f, 0.710333705f},
-std::array<float,2>{0.100810446f, 0.293427497f},
-std::array<float,2>{0.732794404f, 0.573336363f},
-std::array<float,2>{0.935164213f, 0.221790761f},
-std::array<float,2>{0.444169194f, 0.772666037f},
-std::array<float,2>{0.301044494f, 0.325362355f},
-std::array<float,2>{0.790444911f, 0.50660038f},
-std::array<float,2>{0.504766047f, 0.177997842f},
-std::array<float,2>{0.194578364f, 0.833248973f},
-std::array<float,2>{0.0437196717f, 0.113246791f},
-std::array<float,2>{0.639826834f, 0.968368173f},
-std::array<float,2>{0.945091665f, 0.467599452f},
-std::array<float,2>{0.430415869f, 0.663522124f},
-std::array<float,2>{0.483873546f, 0.190820351f},
-std::array<float,2>{0.89125824f, 0.795485377f},
-std::array<float,2>{0.717261672f, 0.257312953f},
-std::array<float,2>{0.0648501962f, 0.597688377f},
-std::array<float,2>{0.165857345f, 0.394728661f},
-std::array<float,2>{0.599256992f, 0.738185704f},
-std::array<float,2>{0.868169129f, 0.0185254794f},
-std::array<float,2>{0.343691349f, 0.893058777f},
-std::array<float,2>{0.462029546f, 0.269977838f},
-std::array<float,2>{0.906906784f, 0.615885437f},
-std::array<float,2>{0.738752127f, 0.213576421f},
-std::array<float,2>{0.116230026f, 0.810099959f},
-std::array<float,2>{0.12937668f, 0.000937046949f},
-std::array<float,2>{0.585574627f, 0.883174956f},
-std::array<float,2>{0.814057171f, 0.382683605f},
-std::array<float,2>{0.362863123f, 0.721687078f},
-std::array<float,2>{0.274795949f, 0.15881075f},
-std::array<float,2>{0.755020499f, 0.817538142f},
-std::array<float,2>{0.554892063f, 0.332976967f},
-std::array<float,2>{0.233716905f, 0.528134763f},
-std::array<float,2>{0.0229523331f, 0.439676523f},
-std::array<float,2>{0.660366952f, 0.685093999f},
-std::array<float,2>{0.977691293f, 0.0945365503f},
-std::array<float,2>{0.377564222f, 0.940609217f},
-std::array<float,2>{0.315210849f, 0.410084665f},
-std::array<float,2>{0.84440273f, 0.688278854f},
-std::array<float,2>{0.615722775f, 0.0374304466f},
-std::array<float,2>{0.18142581f, 0.909033716f},
-std::array<float,2>{0.0860198438f, 0.239158943f},
-std::array<float,2>{0.688552201f, 0.765445948f},
-std::array<float,2>{0.887700915f, 0.312261134f},
-std::array<float,2>{0.494684786f, 0.580926299f},
-std::array<float,2>{0.406929195f, 0.0757973194f},
-std::array<float,2>{0.954581738f, 0.988704324f},
-std::array<float,2>{0.6547001f, 0.473598391f},
-std::array<float,2>{0.0496268012f, 0.646474183f},
-std::array<float,2>{0.210625038f, 0.368358552f},
-std::array<float,2>{0.52145803f, 0.541725278f},
-std::array<float,2>{0.806647062f, 0.125982583f},
-std::array<float,2>{0.286119252f, 0.847593009f},
-std::array<float,2>{0.471758306f, 0.443135917f},
-std::array<float,2>{0.904193461f, 0.680536389f},
-std::array<float,2>{0.710868299f, 0.100719504f},
-std::array<float,2>{0.0767348185f, 0.944574952f},
-std::array<float,2>{0.160135403f, 0.161175042f},
-std::array<float,2>{0.603725553f, 0.813424766f},
-std::array<float,2>{0.862317443f, 0.331570745f},
-std::array<float,2>{0.330743998f, 0.526093185f},
-std::array<float,2>{0.310409009f, 0.00492748385f},
-std::array<float,2>{0.782624006f, 0.888276994f},
-std::array<float,2>{0.510403514f, 0.375292063f},
-std::array<float,2>{0.195875093f, 0.725451171f},
-std::array<float,2>{0.0390401296f, 0.268352479f},
-std::array<float,2>{0.632345259f, 0.611341f},
-std::array<float,2>{0.952202797f, 0.216820955f},
-std::array<float,2>{0.429205894f, 0.805772424f},
-std::array<float,2>{0.345608562f, 0.372610897f},
-std::array<float,2>{0.835890234f, 0.543527484f},
-std::array<float,2>{0.572577953f, 0.132259086f},
-std::array<float,2>{0.144454539f, 0.851521373f},
-std::array<float,2>{0.101666383f, 0.0722691193f},
-std::array<float,2>{0.722516894f, 0.986987948f},
-std::array<float,2>{0.925716698f, 0.469284981f},
-std::array<float,2>{0.445928723f, 0.644089222f},
-std::array<float,2>{0.396302402f, 0.23572436f},
-std::array<float,2>{0.98764044f, 0.760134339f},
-std::array<float,2>{0.682451546f, 0.305623472f},
-std::array<float,2>{0.00888175517f, 0.583556056f},
-std::array<float,2>{0.242001086f, 0.413743258f},
-std::array<float,2>{0.535715103f, 0.693606019f},
-std::array<float,2>{0.768030584f, 0.03217135f},
-std::array<float,2>{0.256142259f, 0.912756324f},
-std::array<float,2>{0.420375139f, 0.290759653f},
-std::array<float,2>{0.967395008f, 0.575257361f},
-std::array<float,2>{0.643887281f, 0.225584581f},
-std::array<float,2>{0.0614544228f, 0.768972814f},
-std::array<float,2>{0.213841468f, 0.061796058f},
-std::array<float,2>{0.530062675f, 0.927203834f},
-std::array<float,2>{0.799110651f, 0.425577998f},
-std::array<float,2>{0.28988412f, 0.704841256f},
-std::array<float,2>{0.32224232f, 0.145243466f},
-std::array<float,2>{0.853194594f, 0.866993725f},
-std::array<float,2>{0.624480546f, 0.350056142f},
-std::array<float,2>{0.17569153f, 0.549515367f},
-std::array<float,2>{0.0788218379f, 0.496134162f},
-std::array<float,2>{0.698082149f, 0.630886972f},
-std::array<float,2>{0.882730424f, 0.0832993165f},
-std::array<float,2>{0.487143785f, 0.969103992f},
-std::array<float,2>{0.272321552f, 0.393871635f},
-std::array<float,2>{0.76295042f, 0.741574228f},
-std::array<float,2>{0.550085247f, 0.0233967733f},
-std::array<float,2>{0.224478662f, 0.896373153f},
-std::array<float,2>{0.0311135333f, 0.194054559f},
-std::array<float,2>{0.667414129f, 0.790783405f},
-std::array<float,2>{0.969270051f, 0.252682477f},
-std::array<float,2>{0.3886832f, 0.594199836f},
-std::array<float,2>{0.458413512f, 0.114079915f},
-std::array<float,2>{0.92045325f, 0.963014066f},
-std::array<float,2>{0.745236874f, 0.462859869f},
-std::array<float,2>{0.117951542f, 0.656572819f},
-std::array<float,2>{0.139932916f, 0.323439121f},
-std::array<float,2>{0.592582881f, 0.503046691f},
-std::array<float,2>{0.826941133f, 0.174736619f},
-std::array<float,2>{0.370867789f, 0.829692066f},
-std::array<float,2>{0.382692575f, 0.437349111f},
-std::array<float,2>{0.983271837f, 0.712869644f},
-std::array<float,2>{0.658116221f, 0.0489334576f},
-std::array<float,2>{0.0169123225f, 0.935285449f},
-std::array<float,2>{0.229630366f, 0.230538219f},
-std::array<float,2>{0.55997175f, 0.77433461f},
-std::array<float,2>{0.75015074f, 0.284418017f},
-std::array<float,2>{0.280542701f, 0.569470108f},
-std::array<float,2>{0.365814626f, 0.0932101533f},
-std::array<float,2>{0.817512631f, 0.982314527f},
-std::array<float,2>{0.579182446f, 0.491762459f},
-std::array<float,2>{0.125039428f, 0.638148308f},
-std::array<float,2>{0.11001154f, 0.358064622f},
-std::array<float,2>{0.735272169f, 0.555697143f},
-std::array<float,2>{0.910866857f, 0.152607933f},
-std::array<float,2>{0.467761576f, 0.870330215f},
-std::array<float,2>{0.284241676f, 0.261348873f},
-std::array<float,2>{0.811554492f, 0.601563573f},
-std::array<float,2>{0.515652716f, 0.197329596f},
-std::array<float,2>{0.205027491f, 0.786370933f},
-std::array<float,2>{0.0515785366f, 0.0258376356f},
-std::array<float,2>{0.650505006f, 0.904363096f},
-std::array<float,2>{0.960282743f, 0.402865946f},
-std::array<float,2>{0.411166847f, 0.742389321f},
-std::array<float,2>{0.497329593f, 0.186262622f},
-std::array<float,2>{0.883086145f, 0.838811278f},
-std::array<float,2>{0.693431199f, 0.319553077f},
-std::array<float,2>{0.0934741795f, 0.513320386f},
-std::array<float,2>{0.186173916f, 0.456042677f},
-std::array<float,2>{0.611671746f, 0.670744717f},
-std::array<float,2>{0.849518359f, 0.122191347f},
-std::array<float,2>{0.31684652f, 0.953165293f},
-std::array<float,2>{0.439161062f, 0.339509517f},
-std::array<float,2>{0.932670474f, 0.517973304f},
-std::array<float,2>{0.728007555f, 0.167328417f},
-std::array<float,2>{0.095941022f, 0.826884151f},
-std::array<float,2>{0.156198904f, 0.101681598f},
-std::array<float,2>{0.565241277f, 0.949617624f},
-std::array<float,2>{0.840330482f, 0.452847779f},
-std::array<float,2>{0.354056865f, 0.672586918f},
-std::array<float,2>{0.25976339f, 0.204361662f},
-std::array<float,2>{0.779281616f, 0.797553062f},
-std::array<float,2>{0.539148867f, 0.279632449f},
-std::array<float,2>{0.243455395f, 0.619683683f},
-std::array<float,2>{0.00645521795f, 0.387064755f},
-std::array<float,2>{0.67494458f, 0.730363369f},
-std::array<float,2>{0.999147058f, 0.0125620384f},
-std::array<float,2>{0.401319712f, 0.880591273f},
-std::array<float,2>{0.339827865f, 0.479016483f},
-std::array<float,2>{0.872236133f, 0.648771703f},
-std::array<float,2>{0.596156716f, 0.0655754656f},
-std::array<float,2>{0.169504911f, 0.996858835f},
-std::array<float,2>{0.0676008314f, 0.135748401f},
-std::array<float,2>{0.711378574f, 0.853984475f},
-std::array<float,2>{0.897009075f, 0.362346888f},
-std::array<float,2>{0.477469712f, 0.538353264f},
-std::array<float,2>{0.436445355f, 0.0417916067f},
-std::array<float,2>{0.941385567f, 0.914897442f},
-std::array<float,2>{0.634635866f, 0.421803325f},
-std::array<float,2>{0.0412983857f, 0.695510387f},
-std::array<float,2>{0.188030899f, 0.303062648f},
-std::array<float,2>{0.501884997f, 0.593052328f},
-std::array<float,2>{0.796584606f, 0.249316782f},
-std::array<float,2>{0.297429234f, 0.753800213f},
-std::array<float,2>{0.464288831f, 0.382248282f},
-std::array<float,2>{0.909349024f, 0.722521901f},
-std::array<float,2>{0.741551757f, 4.13552261e-05f},
-std::array<float,2>{0.114627764f, 0.883670211f},
-std::array<float,2>{0.13155359f, 0.213359594f},
-std::array<float,2>{0.583069086f, 0.809882998f},
-std::array<float,2>{0.814652741f, 0.270386636f},
-std::array<float,2>{0.360429019f, 0.615332901f},
-std::array<float,2>{0.276742369f, 0.0941243917f},
-std::array<float,2>{0.757687211f, 0.941381395f},
-std::array<float,2>{0.558207154f, 0.440410078f},
-std::array<float,2>{0.231152624f, 0.684739172f},
-std::array<float,2>{0.0197572522f, 0.332223117f},
-std::array<float,2>{0.662206531f, 0.527533233f},
-std::array<float,2>{0.980453849f, 0.158347994f},
-std::array<float,2>{0.376088142f, 0.818246365f},
-std::array<float,2>{0.312687963f, 0.311957091f},
-std::array<float,2>{0.846314132f, 0.580168664f},
-std::array<float,2>{0.614297807f, 0.238470227f},
-std::array<float,2>{0.18249093f, 0.765014589f},
-std::array<float,2>{0.089492768f, 0.0380751044f},
-std::array<float,2>{0.689914584f, 0.908626556f},
-std::array<float,2>{0.890006065f, 0.409648538f},
-std::array<float,2>{0.492603958f, 0.687512875f},
-std::array<float,2>{0.408673078f, 0.126700997f},
-std::array<float,2>{0.956376135f, 0.846708357f},
-std::array<float,2>{0.652439773f, 0.369096488f},
-std::array<float,2>{0.0477943197f, 0.541293919f},
-std::array<float,2>{0.208194688f, 0.473110318f},
-std::array<float,2>{0.522358239f, 0.645970404f},
-std::array<float,2>{0.80515027f, 0.0752162412f},
-std::array<float,2>{0.288202465f, 0.988771081f},
-std::array<float,2>{0.40372926f, 0.344825417f},
-std::array<float,2>{0.995243371f, 0.554612219f},
-std::array<float,2>{0.678764522f, 0.144043282f},
-std::array<float,2>{0.00368942646f, 0.859709024f},
-std::array<float,2>{0.246292189f, 0.0789286792f},
-std::array<float,2>{0.544319093f, 0.973172367f},
-std::array<float,2>{0.775473535f, 0.493019998f},
-std::array<float,2>{0.264965802f, 0.62540561f},
-std::array<float,2>{0.356498003f, 0.222619221f},
-std::array<float,2>{0.837702572f, 0.773134232f},
-std::array<float,2>{0.569176555f, 0.293864697f},
-std::array<float,2>{0.151440337f, 0.57395196f},
-std::array<float,2>{0.098474063f, 0.42649129f},
-std::array<float,2>{0.732262492f, 0.710868478f},
-std::array<float,2>{0.936924398f, 0.0565340929f},
-std::array<float,2>{0.442081392f, 0.922501802f},
-std::array<float,2>{0.303669244f, 0.467014581f},
-std::array<float,2>{0.791368783f, 0.663753748f},
-std::array<float,2>{0.506858289f, 0.112726063f},
-std::array<float,2>{0.191621929f, 0.968073785f},
-std::array<float,2>{0.0460088924f, 0.178696454f},
-std::array<float,2>{0.63812542f, 0.833925784f},
-std::array<float,2>{0.943170011f, 0.325982571f},
-std::array<float,2>{0.432419211f, 0.506224155f},
-std::array<float,2>{0.481260598f, 0.0179825127f},
-std::array<float,2>{0.893371284f, 0.893402338f},
-std::array<float,2>{0.716220498f, 0.395330846f},
-std::array<float,2>{0.0631597862f, 0.737510324f},
-std::array<float,2>{0.167834759f, 0.25751996f},
-std::array<float,2>{0.60131222f, 0.598542392f},
-std::array<float,2>{0.870256126f, 0.191221118f},
-std::array<float,2>{0.340025455f, 0.795102894f},
-std::array<float,2>{0.422058344f, 0.487757295f},
-std::array<float,2>{0.945904791f, 0.636114061f},
-std::array<float,2>{0.627880871f, 0.0884953812f},
-std::array<float,2>{0.034328267f, 0.977206469f},
-std::array<float,2>{0.20270735f, 0.151195407f},
-std::array<float,2>{0.513808489f, 0.871577203f},
-std::array<float,2>{0.786616325f, 0.352362126f},
-std::array<float,2>{0.306030601f, 0.560950518f},
-std::array<float,2>{0.333774686f, 0.0539679304f},
-std::array<float,2>{0.864436686f, 0.93274647f},
-std::array<float,2>{0.607411385f, 0.431694955f},
-std::array<float,2>{0.160161018f, 0.715395629f},
-std::array<float,2>{0.071188584f, 0.287328154f},
-std::array<float,2>{0.704835474f, 0.565818369f},
-std::array<float,2>{0.901153147f, 0.229962155f},
-std::array<float,2>{0.473757029f, 0.77788794f},
-std::array<float,2>{0.250687331f, 0.315357774f},
-std::array<float,2>{0.772690177f, 0.510714531f},
-std::array<float,2>{0.533492625f, 0.179961309f},
-std::array<float,2>{0.238176823f, 0.842231572f},
-std::array<float,2>{0.0126195233f, 0.120149136f},
-std::array<float,2>{0.68359381f, 0.959771216f},
-std::array<float,2>{0.991132259f, 0.460815281f},
-std::array<float,2>{0.391926825f, 0.664307237f},
-std::array<float,2>{0.449493915f, 0.201649606f},
-std::array<float,2>{0.926595271f, 0.784175694f},
-std::array<float,2>{0.722697973f, 0.264464498f},
-std::array<float,2>{0.108164422f, 0.609117627f},
-std::array<float,2>{0.147684172f, 0.401233524f},
-std::array<float,2>{0.575930059f, 0.747810245f},
-std::array<float,2>{0.828922212f, 0.0305254068f},
-std::array<float,2>{0.34767279f, 0.901368558f},
-std::array<float,2>{0.488870353f, 0.274743527f},
-std::array<float,2>{0.875255823f, 0.623648524f},
-std::array<float,2>{0.700687468f, 0.210811391f},
-std::array<float,2>{0.0826651901f, 0.80312407f},
-std::array<float,2>{0.178303689f, 0.00939594861f},
-std::array<float,2>{0.620577931f, 0.877007544f},
-std::array<float,2>{0.85753864f, 0.385006309f},
-std::array<float,2>{0.324376106f, 0.730648398f},
-std::array<float,2>{0.295403033f, 0.168724447f},
-std::array<float,2>{0.80455941f, 0.821873367f},
-std::array<float,2>{0.526900709f, 0.341398001f},
-std::array<float,2>{0.215259969f, 0.520838439f},
-std::array<float,2>{0.0585831814f, 0.445993811f},
-std::array<float,2>{0.648361087f, 0.678682745f},
-std::array<float,2>{0.961615026f, 0.107941948f},
-std::array<float,2>{0.414198458f, 0.946371496f},
-std::array<float,2>{0.374263376f, 0.417775005f},
-std::array<float,2>{0.823009551f, 0.699632704f},
-std::array<float,2>{0.589497805f, 0.0460285097f},
-std::array<float,2>{0.135802925f, 0.918314219f},
-std::array<float,2>{0.123887435f, 0.243094251f},
-std::array<float,2>{0.749908924f, 0.755432427f},
-std::array<float,2>{0.914927125f, 0.298494905f},
-std::array<float,2>{0.453636706f, 0.588053226f},
-std::array<float,2>{0.384318233f, 0.069542557f},
-std::array<float,2>{0.974330366f, 0.99306196f},
-std::array<float,2>{0.670891345f, 0.484124959f},
-std::array<float,2>{0.0252800807f, 0.655645192f},
-std::array<float,2>{0.219345152f, 0.363548666f},
-std::array<float,2>{0.551880896f, 0.534090281f},
-std::array<float,2>{0.759093761f, 0.139860779f},
-std::array<float,2>{0.267599881f, 0.85809648f},
-std::array<float,2>{0.448609263f, 0.470822126f},
-std::array<float,2>{0.922555685f, 0.640909314f},
-std::array<float,2>{0.720625699f, 0.0714277476f},
-std::array<float,2>{0.103570014f, 0.985227942f},
-std::array<float,2>{0.142250568f, 0.13073121f},
-std::array<float,2>{0.5712502f, 0.848032594f},
-std::array<float,2>{0.832362354f, 0.373621821f},
-std::array<float,2>{0.347053975f, 0.545122147f},
-std::array<float,2>{0.254606217f, 0.0338607505f},
-std::array<float,2>{0.766471744f, 0.911155164f},
-std::array<float,2>{0.538461626f, 0.410958409f},
-std::array<float,2>{0.23898004f, 0.691717505f},
-std::array<float,2>{0.0113203302f, 0.307146043f},
-std::array<float,2>{0.681273282f, 0.584597111f},
-std::array<float,2>{0.985274196f, 0.236542761f},
-std::array<float,2>{0.397134036f, 0.759425282f},
-std::array<float,2>{0.329278916f, 0.32955271f},
-std::array<float,2>{0.860471308f, 0.524543643f},
-std::array<float,2>{0.60272938f, 0.163254991f},
-std::array<float,2>{0.15712285f, 0.814496219f},
-std::array<float,2>{0.0758045465f, 0.0986743122f},
-std::array<float,2>{0.708605826f, 0.942596436f},
-std::array<float,2>{0.904992223f, 0.443936437f},
-std::array<float,2>{0.469126999f, 0.682695448f},
-std::array<float,2>{0.427083045f, 0.215599686f},
-std::array<float,2>{0.95028913f, 0.807378054f},
-std::array<float,2>{0.628910661f, 0.265737444f},
-std::array<float,2>{0.0370725542f, 0.610718071f},
-std::array<float,2>{0.198221534f, 0.377780855f},
-std::array<float,2>{0.508836865f, 0.724553049f},
-std::array<float,2>{0.785094202f, 0.00625341572f},
-std::array<float,2>{0.312454104f, 0.89018023f},
-std::array<float,2>{0.388088256f, 0.251109958f},
-std::array<float,2>{0.972500443f, 0.597618759f},
-std::array<float,2>{0.66411972f, 0.191717133f},
-std::array<float,2>{0.0273978654f, 0.79252106f},
-std::array<float,2>{0.224666178f, 0.0204566605f},
-std::array<float,2>{0.548749328f, 0.897887528f},
-std::array<float,2>{0.763715029f, 0.391504139f},
-std::array<float,2>{0.269884169f, 0.738637447f},
-std::array<float,2>{0.367892653f, 0.173022807f},
-std::array<float,2>{0.825704098f, 0.831459939f},
-std::array<float,2>{0.5914253f, 0.320529163f},
-std::array<float,2>{0.138637438f, 0.501904547f},
-std::array<float,2>{0.120853424f, 0.463189393f},
-std::array<float,2>{0.742411613f, 0.659549892f},
-std::array<float,2>{0.919700027f, 0.115354218f},
-std::array<float,2>{0.46026054f, 0.962668419f},
-std::array<float,2>{0.291492254f, 0.422585368f},
-std::array<float,2>{0.797477484f, 0.706542194f},
-std::array<float,2>{0.52897799f, 0.0599181093f},
-std::array<float,2>{0.211078241f, 0.928575337f},
-std::array<float,2>{0.0589093007f, 0.222866848f},
-std::array<float,2>{0.641553342f, 0.766049802f},
-std::array<float,2>{0.966132045f, 0.291225135f},
-std::array<float,2>{0.418449372f, 0.576177597f},
-std::array<float,2>{0.485012621f, 0.0852483958f},
-std::array<float,2>{0.880559742f, 0.972607732f},
-std::array<float,2>{0.696825504f, 0.49930495f},
-std::array<float,2>{0.0810110494f, 0.629400074f},
-std::array<float,2>{0.173689052f, 0.348035246f},
-std::array<float,2>{0.622163713f, 0.547563851f},
-std::array<float,2>{0.854281664f, 0.146594957f},
-std::array<float,2>{0.32363534f, 0.863358438f},
-std::array<float,2>{0.413664103f, 0.405030757f},
-std::array<float,2>{0.95845294f, 0.74449116f},
-std::array<float,2>{0.648610651f, 0.0237786621f},
-std::array<float,2>{0.054260131f, 0.903980732f},
-std::array<float,2>{0.205754414f, 0.195590824f},
-std::array<float,2>{0.518309712f, 0.788726091f},
-std::array<float,2>{0.810079932f, 0.258415788f},
-std::array<float,2>{0.28256014f, 0.604803085f},
-std::array<float,2>{0.31935966f, 0.124045111f},
-std::array<float,2>{0.851317704f, 0.955297291f},
-std::array<float,2>{0.610322237f, 0.45456031f},
-std::array<float,2>{0.185373485f, 0.66883558f},
-std::array<float,2>{0.0910162628f, 0.317520827f},
-std::array<float,2>{0.692550719f, 0.514576077f},
-std::array<float,2>{0.88526088f, 0.185145169f},
-std::array<float,2>{0.499190211f, 0.836490333f},
-std::array<float,2>{0.27851665f, 0.281417787f},
-std::array<float,2>{0.753222346f, 0.567584932f},
-std::array<float,2>{0.561228216f, 0.233864293f},
-std::array<float,2>{0.227475852f, 0.776639938f},
-std::array<float,2>{0.0176380929f, 0.0469993986f},
-std::array<float,2>{0.659755588f, 0.936340034f},
-std::array<float,2>{0.982319593f, 0.434449136f},
-std::array<float,2>{0.379547864f, 0.714398384f},
-std::array<float,2>{0.465316981f, 0.156072497f},
-std::array<float,2>{0.91277355f, 0.868579507f},
-std::array<float,2>{0.737856328f, 0.356258273f},
-std::array<float,2>{0.113152802f, 0.557610452f},
-std::array<float,2>{0.128172517f, 0.489483327f},
-std::array<float,2>{0.581848919f, 0.640281975f},
-std::array<float,2>{0.8200863f, 0.0910762325f},
-std::array<float,2>{0.364129663f, 0.984116793f},
-std::array<float,2>{0.479489446f, 0.36095503f},
-std::array<float,2>{0.895247281f, 0.536531508f},
-std::array<float,2>{0.714512527f, 0.133727059f},
-std::array<float,2>{0.0693040639f, 0.85340178f},
-std::array<float,2>{0.170563057f, 0.0632916838f},
-std::array<float,2>{0.595653772f, 0.999219418f},
-std::array<float,2>{0.873066962f, 0.477603018f},
-std::array<float,2>{0.336634278f, 0.652284622f},
-std::array<float,2>{0.300568074f, 0.247320473f},
-std::array<float,2>{0.79488951f, 0.750181377f},
-std::array<float,2>{0.503242254f, 0.302264959f},
-std::array<float,2>{0.189610124f, 0.591121614f},
-std::array<float,2>{0.0399194919f, 0.41977635f},
-std::array<float,2>{0.63571173f, 0.698985815f},
-std::array<float,2>{0.939291656f, 0.0391609557f},
-std::array<float,2>{0.434565425f, 0.917802751f},
-std::array<float,2>{0.352889657f, 0.449454248f},
-std::array<float,2>{0.84197855f, 0.674667954f},
-std::array<float,2>{0.563426673f, 0.104789764f},
-std::array<float,2>{0.153255984f, 0.952881873f},
-std::array<float,2>{0.0954252109f, 0.165750936f},
-std::array<float,2>{0.730252564f, 0.825645328f},
-std::array<float,2>{0.931403279f, 0.336079299f},
-std::array<float,2>{0.440672696f, 0.516528487f},
-std::array<float,2>{0.399326026f, 0.014981959f},
-std::array<float,2>{0.997635603f, 0.882560313f},
-std::array<float,2>{0.673573017f, 0.390298039f},
-std::array<float,2>{0.00540507911f, 0.726763189f},
-std::array<float,2>{0.244661391f, 0.277417719f},
-std::array<float,2>{0.542207539f, 0.61733675f},
-std::array<float,2>{0.780569077f, 0.205209747f},
-std::array<float,2>{0.259966165f, 0.799988806f},
-std::array<float,2>{0.494428307f, 0.406268537f},
-std::array<float,2>{0.888660431f, 0.690414965f},
-std::array<float,2>{0.68922466f, 0.0367717743f},
-std::array<float,2>{0.0868405923f, 0.907489002f},
-std::array<float,2>{0.181014642f, 0.240708485f},
-std::array<float,2>{0.615272164f, 0.762470603f},
-std::array<float,2>{0.844192266f, 0.308636785f},
-std::array<float,2>{0.314632416f, 0.578603208f},
-std::array<float,2>{0.285368055f, 0.0771047771f},
-std::array<float,2>{0.807275832f, 0.991369843f},
-std::array<float,2>{0.520617664f, 0.475751847f},
-std::array<float,2>{0.209976435f, 0.648103952f},
-std::array<float,2>{0.0492024459f, 0.369381487f},
-std::array<float,2>{0.654967248f, 0.539992213f},
-std::array<float,2>{0.95465368f, 0.127931491f},
-std::array<float,2>{0.406677127f, 0.845065951f},
-std::array<float,2>{0.362471819f, 0.272351652f},
-std::array<float,2>{0.813716233f, 0.61371243f},
-std::array<float,2>{0.585078657f, 0.21264562f},
-std::array<float,2>{0.129799217f, 0.811072767f},
-std::array<float,2>{0.116762139f, 0.00247185095f},
-std::array<float,2>{0.738975525f, 0.88541019f},
-std::array<float,2>{0.906563759f, 0.379657447f},
-std::array<float,2>{0.462665409f, 0.719017744f},
-std::array<float,2>{0.377009094f, 0.157313719f},
-std::array<float,2>{0.978255749f, 0.819841325f},
-std::array<float,2>{0.661074281f, 0.33561781f},
-std::array<float,2>{0.0228747763f, 0.52935493f},
-std::array<float,2>{0.234199315f, 0.439357132f},
-std::array<float,2>{0.555335343f, 0.68674159f},
-std::array<float,2>{0.755658627f, 0.0969594344f},
-std::array<float,2>{0.275385916f, 0.938045442f},
-std::array<float,2>{0.430015743f, 0.327370495f},
-std::array<float,2>{0.944747984f, 0.504755437f},
-std::array<float,2>{0.640584469f, 0.176831305f},
-std::array<float,2>{0.0430607572f, 0.834525824f},
-std::array<float,2>{0.195006609f, 0.110232055f},
-std::array<float,2>{0.504033029f, 0.96607244f},
-std::array<float,2>{0.790726781f, 0.465418488f},
-std::array<float,2>{0.30170083f, 0.661389053f},
-std::array<float,2>{0.342827678f, 0.187560946f},
-std::array<float,2>{0.868997395f, 0.794086397f},
-std::array<float,2>{0.598731518f, 0.254180819f},
-std::array<float,2>{0.165361881f, 0.599878073f},
-std::array<float,2>{0.0651839972f, 0.398137242f},
-std::array<float,2>{0.717571914f, 0.734674513f},
-std::array<float,2>{0.891044736f, 0.0161025748f},
-std::array<float,2>{0.484146208f, 0.890861392f},
-std::array<float,2>{0.262856513f, 0.494484752f},
-std::array<float,2>{0.774708867f, 0.628345609f},
-std::array<float,2>{0.545093775f, 0.0804475248f},
-std::array<float,2>{0.248948082f, 0.974644542f},
-std::array<float,2>{0.00104236603f, 0.141049892f},
-std::array<float,2>{0.676827192f, 0.861501038f},
-std::array<float,2>{0.994103193f, 0.345863789f},
-std::array<float,2>{0.404912353f, 0.551451385f},
-std::array<float,2>{0.443418324f, 0.056875065f},
-std::array<float,2>{0.934608579f, 0.925607383f},
-std::array<float,2>{0.733066678f, 0.429196715f},
-std::array<float,2>{0.101288781f, 0.708547354f},
-std::array<float,2>{0.14852339f, 0.295762837f},
-std::array<float,2>{0.567625225f, 0.570577383f},
-std::array<float,2>{0.83826828f, 0.220060825f},
-std::array<float,2>{0.35909304f, 0.769566774f},
-std::array<float,2>{0.393524438f, 0.457543254f},
-std::array<float,2>{0.989287674f, 0.66678232f},
-std::array<float,2>{0.686316431f, 0.118883826f},
-std::array<float,2>{0.0147668356f, 0.957408905f},
-std::array<float,2>{0.236182466f, 0.182457641f},
-std::array<float,2>{0.532682836f, 0.841374993f},
-std::array<float,2>{0.7708354f, 0.312525421f},
-std::array<float,2>{0.253678083f, 0.509324491f},
-std::array<float,2>{0.351059586f, 0.0289049186f},
-std::array<float,2>{0.831670463f, 0.899840117f},
-std::array<float,2>{0.576711237f, 0.399674624f},
-std::array<float,2>{0.145546183f, 0.7496472f},
-std::array<float,2>{0.107294887f, 0.26216653f},
-std::array<float,2>{0.725337684f, 0.606957912f},
-std::array<float,2>{0.928384304f, 0.19930622f},
-std::array<float,2>{0.452419132f, 0.783202589f},
-std::array<float,2>{0.306837112f, 0.355395854f},
-std::array<float,2>{0.787457526f, 0.559370041f},
-std::array<float,2>{0.512077987f, 0.148739621f},
-std::array<float,2>{0.200489134f, 0.873993278f},
-std::array<float,2>{0.0312598124f, 0.086139828f},
-std::array<float,2>{0.625961065f, 0.97990042f},
-std::array<float,2>{0.949193358f, 0.48519665f},
-std::array<float,2>{0.424957186f, 0.6333161f},
-std::array<float,2>{0.47612533f, 0.228206411f},
-std::array<float,2>{0.89848125f, 0.781192482f},
-std::array<float,2>{0.706699431f, 0.286369175f},
-std::array<float,2>{0.0730321035f, 0.562804282f},
-std::array<float,2>{0.163004637f, 0.431366593f},
-std::array<float,2>{0.609120071f, 0.716968656f},
-std::array<float,2>{0.866746664f, 0.0508024096f},
-std::array<float,2>{0.334970444f, 0.931402802f},
-std::array<float,2>{0.456041127f, 0.300267011f},
-std::array<float,2>{0.916446149f, 0.587395847f},
-std::array<float,2>{0.747586727f, 0.244303375f},
-std::array<float,2>{0.12229576f, 0.757174492f},
-std::array<float,2>{0.133396745f, 0.0433996171f},
-std::array<float,2>{0.587429941f, 0.921666026f},
-std::array<float,2>{0.822081804f, 0.414125651f},
-std::array<float,2>{0.372347683f, 0.701973259f},
-std::array<float,2>{0.265629798f, 0.137470081f},
-std::array<float,2>{0.761109412f, 0.856673241f},
-std::array<float,2>{0.553360164f, 0.365997165f},
-std::array<float,2>{0.221635938f, 0.533109725f},
-std::array<float,2>{0.0262398105f, 0.481914431f},
-std::array<float,2>{0.668622375f, 0.652870119f},
-std::array<float,2>{0.975372493f, 0.0678475425f},
-std::array<float,2>{0.38504988f, 0.995885968f},
-std::array<float,2>{0.327539712f, 0.383496583f},
-std::array<float,2>{0.855612397f, 0.734298944f},
-std::array<float,2>{0.61845994f, 0.0104631474f},
-std::array<float,2>{0.177623019f, 0.876520693f},
-std::array<float,2>{0.0850782394f, 0.207297742f},
-std::array<float,2>{0.70307982f, 0.801492095f},
-std::array<float,2>{0.877660751f, 0.276973933f},
-std::array<float,2>{0.491502345f, 0.621222436f},
-std::array<float,2>{0.417426765f, 0.106418923f},
-std::array<float,2>{0.963237703f, 0.947382212f},
-std::array<float,2>{0.645193458f, 0.447305471f},
-std::array<float,2>{0.0550325364f, 0.677649736f},
-std::array<float,2>{0.218012422f, 0.343124419f},
-std::array<float,2>{0.524037361f, 0.522488356f},
-std::array<float,2>{0.802297413f, 0.170220852f},
-std::array<float,2>{0.293105543f, 0.823969543f},
-std::array<float,2>{0.48740992f, 0.498967588f},
-std::array<float,2>{0.881495357f, 0.63035208f},
-std::array<float,2>{0.698877394f, 0.0843065381f},
-std::array<float,2>{0.0795258507f, 0.971492231f},
-std::array<float,2>{0.174074396f, 0.148099735f},
-std::array<float,2>{0.623047411f, 0.864405274f},
-std::array<float,2>{0.85201937f, 0.349505723f},
-std::array<float,2>{0.320936352f, 0.548781335f},
-std::array<float,2>{0.290781051f, 0.0589890406f},
-std::array<float,2>{0.800311685f, 0.929522216f},
-std::array<float,2>{0.530923009f, 0.423550248f},
-std::array<float,2>{0.214072496f, 0.705822527f},
-std::array<float,2>{0.0621221773f, 0.292337179f},
-std::array<float,2>{0.643203914f, 0.577194691f},
-std::array<float,2>{0.967984259f, 0.223807082f},
-std::array<float,2>{0.421786457f, 0.767223716f},
-std::array<float,2>{0.369649917f, 0.321778744f},
-std::array<float,2>{0.828050435f, 0.500705183f},
-std::array<float,2>{0.59370774f, 0.171996221f},
-std::array<float,2>{0.139537618f, 0.830089629f},
-std::array<float,2>{0.118501015f, 0.116991356f},
-std::array<float,2>{0.744208217f, 0.961290598f},
-std::array<float,2>{0.921168387f, 0.463963777f},
-std::array<float,2>{0.457636386f, 0.659148455f},
-std::array<float,2>{0.390101016f, 0.192573622f},
-std::array<float,2>{0.970096111f, 0.791510642f},
-std::array<float,2>{0.66664207f, 0.250502557f},
-std::array<float,2>{0.0296624247f, 0.596655905f},
-std::array<float,2>{0.223515525f, 0.391757488f},
-std::array<float,2>{0.548891068f, 0.740233302f},
-std::array<float,2>{0.76247406f, 0.0210880693f},
-std::array<float,2>{0.273266524f, 0.897165775f},
-std::array<float,2>{0.427794844f, 0.267006397f},
-std::array<float,2>{0.95198828f, 0.609886527f},
-std::array<float,2>{0.630943835f, 0.216118574f},
-std::array<float,2>{0.0376497507f, 0.808473885f},
-std::array<float,2>{0.197240725f, 0.00778585812f},
-std::array<float,2>{0.511046112f, 0.888977289f},
-std::array<float,2>{0.782144248f, 0.378039867f},
-std::array<float,2>{0.308760822f, 0.723273754f},
-std::array<float,2>{0.331733227f, 0.16271697f},
-std::array<float,2>{0.861391366f, 0.816134751f},
-std::array<float,2>{0.60523659f, 0.328288347f},
-std::array<float,2>{0.159103453f, 0.524307191f},
-std::array<float,2>{0.0773831308f, 0.445198834f},
-std::array<float,2>{0.709148049f, 0.681833088f},
-std::array<float,2>{0.90304935f, 0.0984258354f},
-std::array<float,2>{0.471647948f, 0.94188267f},
-std::array<float,2>{0.25696975f, 0.411174327f},
-std::array<float,2>{0.768572688f, 0.692564845f},
-std::array<float,2>{0.536505997f, 0.0343457684f},
-std::array<float,2>{0.240565956f, 0.910932839f},
-std::array<float,2>{0.00841083936f, 0.238205105f},
-std::array<float,2>{0.682901442f, 0.758715808f},
-std::array<float,2>{0.986625791f, 0.308292925f},
-std::array<float,2>{0.394899845f, 0.585284531f},
-std::array<float,2>{0.447260767f, 0.0703978464f},
-std::array<float,2>{0.924593747f, 0.985458016f},
-std::array<float,2>{0.721396565f, 0.471754134f},
-std::array<float,2>{0.103360318f, 0.642222226f},
-std::array<float,2>{0.143499881f, 0.374797791f},
-std::array<float,2>{0.573921323f, 0.545911372f},
-std::array<float,2>{0.834228754f, 0.129655436f},
-std::array<float,2>{0.343887478f, 0.849015057f},
-std::array<float,2>{0.40172109f, 0.388742179f},
-std::array<float,2>{0.998356223f, 0.727670789f},
-std::array<float,2>{0.674117506f, 0.0140581001f},
-std::array<float,2>{0.00710662827f, 0.881684303f},
-std::array<float,2>{0.243023768f, 0.206336796f},
-std::array<float,2>{0.540378511f, 0.79892236f},
-std::array<float,2>{0.778310299f, 0.278454244f},
-std::array<float,2>{0.258268833f, 0.618577242f},
-std::array<float,2>{0.354638696f, 0.103645734f},
-std::array<float,2>{0.841154516f, 0.951382518f},
-std::array<float,2>{0.566404879f, 0.451167047f},
-std::array<float,2>{0.155270889f, 0.675138354f},
-std::array<float,2>{0.096708551f, 0.337256849f},
-std::array<float,2>{0.727191508f, 0.516616642f},
-std::array<float,2>{0.931728005f, 0.164525852f},
-std::array<float,2>{0.437781245f, 0.824685693f},
-std::array<float,2>{0.298095822f, 0.301222146f},
-std::array<float,2>{0.795167387f, 0.590387046f},
-std::array<float,2>{0.50053364f, 0.246918485f},
-std::array<float,2>{0.188888744f, 0.751830161f},
-std::array<float,2>{0.0429597348f, 0.0402319282f},
-std::array<float,2>{0.632840753f, 0.916657925f},
-std::array<float,2>{0.939504743f, 0.41851902f},
-std::array<float,2>{0.436879128f, 0.697908998f},
-std::array<float,2>{0.47817564f, 0.133930564f},
-std::array<float,2>{0.897546411f, 0.852143943f},
-std::array<float,2>{0.711964667f, 0.360080004f},
-std::array<float,2>{0.0667859986f, 0.53601712f},
-std::array<float,2>{0.16866073f, 0.477216303f},
-std::array<float,2>{0.597177565f, 0.650898397f},
-std::array<float,2>{0.871112645f, 0.0642245188f},
-std::array<float,2>{0.33843857f, 0.998903692f},
-std::array<float,2>{0.468451828f, 0.357169867f},
-std::array<float,2>{0.911930323f, 0.5580616f},
-std::array<float,2>{0.736080885f, 0.154420882f},
-std::array<float,2>{0.11082574f, 0.868024945f},
-std::array<float,2>{0.126139611f, 0.0900142714f},
-std::array<float,2>{0.578669071f, 0.982865751f},
-std::array<float,2>{0.817096889f, 0.489010781f},
-std::array<float,2>{0.366458386f, 0.639050722f},
-std::array<float,2>{0.279430658f, 0.232788906f},
-std::array<float,2>{0.751926839f, 0.776099145f},
-std::array<float,2>{0.558854461f, 0.282855272f},
-std::array<float,2>{0.228778929f, 0.567261159f},
-std::array<float,2>{0.0156297218f, 0.434883177f},
-std::array<float,2>{0.657218993f, 0.713406086f},
-std::array<float,2>{0.984059334f, 0.0478527397f},
-std::array<float,2>{0.381683946f, 0.937491834f},
-std::array<float,2>{0.318024307f, 0.453737617f},
-std::array<float,2>{0.847743154f, 0.669618607f},
-std::array<float,2>{0.612338305f, 0.123117827f},
-std::array<float,2>{0.186959848f, 0.956909299f},
-std::array<float,2>{0.0919326097f, 0.18375273f},
-std::array<float,2>{0.694628835f, 0.837545514f},
-std::array<float,2>{0.884544313f, 0.317180455f},
-std::array<float,2>{0.496451885f, 0.515333414f},
-std::array<float,2>{0.410659015f, 0.025317302f},
-std::array<float,2>{0.959763706f, 0.902961671f},
-std::array<float,2>{0.652103901f, 0.405943453f},
-std::array<float,2>{0.0518765301f, 0.745185077f},
-std::array<float,2>{0.203560516f, 0.259010047f},
-std::array<float,2>{0.517172635f, 0.6043154f},
-std::array<float,2>{0.811196148f, 0.196733475f},
-std::array<float,2>{0.284157604f, 0.787181854f},
-std::array<float,2>{0.442756921f, 0.428224325f},
-std::array<float,2>{0.936252594f, 0.707293212f},
-std::array<float,2>{0.73107928f, 0.058205571f},
-std::array<float,2>{0.0994948447f, 0.923906326f},
-std::array<float,2>{0.151355475f, 0.219637245f},
-std::array<float,2>{0.569468856f, 0.771049261f},
-std::array<float,2>{0.835946679f, 0.296235234f},
-std::array<float,2>{0.355555922f, 0.571556866f},
-std::array<float,2>{0.264317065f, 0.0818835422f},
-std::array<float,2>{0.776815832f, 0.976046085f},
-std::array<float,2>{0.543132007f, 0.495931417f},
-std::array<float,2>{0.247149244f, 0.626993179f},
-std::array<float,2>{0.00277227513f, 0.347228616f},
-std::array<float,2>{0.678412914f, 0.552662253f},
-std::array<float,2>{0.994694889f, 0.14223282f},
-std::array<float,2>{0.402830362f, 0.863154113f},
-std::array<float,2>{0.341047645f, 0.255114049f},
-std::array<float,2>{0.870067596f, 0.601220429f},
-std::array<float,2>{0.600406885f, 0.189145029f},
-std::array<float,2>{0.166920736f, 0.793812633f},
-std::array<float,2>{0.064406231f, 0.0171553511f},
-std::array<float,2>{0.71559763f, 0.892330706f},
-std::array<float,2>{0.894064009f, 0.39656353f},
-std::array<float,2>{0.481856465f, 0.735701859f},
-std::array<float,2>{0.433155179f, 0.176300839f},
-std::array<float,2>{0.942020059f, 0.835447133f},
-std::array<float,2>{0.637304723f, 0.32706812f},
-std::array<float,2>{0.0454305336f, 0.505408943f},
-std::array<float,2>{0.19268924f, 0.466759235f},
-std::array<float,2>{0.505881011f, 0.660333514f},
-std::array<float,2>{0.792937398f, 0.110487677f},
-std::array<float,2>{0.303838193f, 0.965076566f},
-std::array<float,2>{0.375799537f, 0.334341049f},
-std::array<float,2>{0.979124665f, 0.530346096f},
-std::array<float,2>{0.66379118f, 0.157118559f},
-std::array<float,2>{0.0209354386f, 0.818913102f},
-std::array<float,2>{0.2321942f, 0.0963597745f},
-std::array<float,2>{0.556923926f, 0.938742697f},
-std::array<float,2>{0.756378829f, 0.437695712f},
-std::array<float,2>{0.275533199f, 0.686062872f},
-std::array<float,2>{0.359923303f, 0.211885631f},
-std::array<float,2>{0.816169977f, 0.811763644f},
-std::array<float,2>{0.582433283f, 0.272504717f},
-std::array<float,2>{0.132600367f, 0.614762008f},
-std::array<float,2>{0.113901749f, 0.380296767f},
-std::array<float,2>{0.740491271f, 0.71997416f},
-std::array<float,2>{0.908471644f, 0.00369115197f},
-std::array<float,2>{0.463474423f, 0.885854483f},
-std::array<float,2>{0.287429124f, 0.475215912f},
-std::array<float,2>{0.805774927f, 0.646573961f},
-std::array<float,2>{0.522619188f, 0.0773985013f},
-std::array<float,2>{0.207857177f, 0.991119087f},
-std::array<float,2>{0.0486042798f, 0.127600133f},
-std::array<float,2>{0.654141366f, 0.844553053f},
-std::array<float,2>{0.955501735f, 0.370996594f},
-std::array<float,2>{0.40988794f, 0.540666521f},
-std::array<float,2>{0.493381619f, 0.0356854424f},
-std::array<float,2>{0.888962805f, 0.906492949f},
-std::array<float,2>{0.690817177f, 0.407650501f},
-std::array<float,2>{0.0880631134f, 0.691215336f},
-std::array<float,2>{0.183094308f, 0.309953779f},
-std::array<float,2>{0.613648355f, 0.579497397f},
-std::array<float,2>{0.847144246f, 0.241920725f},
-std::array<float,2>{0.313898146f, 0.763417065f},
-std::array<float,2>{0.415856928f, 0.448656827f},
-std::array<float,2>{0.96283716f, 0.676388562f},
-std::array<float,2>{0.647081852f, 0.107125118f},
-std::array<float,2>{0.0572400391f, 0.948685408f},
-std::array<float,2>{0.216450274f, 0.171659738f},
-std::array<float,2>{0.525425732f, 0.82244873f},
-std::array<float,2>{0.802768588f, 0.342239708f},
-std::array<float,2>{0.296187133f, 0.521923065f},
-std::array<float,2>{0.325231403f, 0.0112926904f},
-std::array<float,2>{0.858448267f, 0.875116527f},
-std::array<float,2>{0.619290769f, 0.384395301f},
-std::array<float,2>{0.179438651f, 0.732677579f},
-std::array<float,2>{0.083112523f, 0.276115239f},
-std::array<float,2>{0.699811995f, 0.622266769f},
-std::array<float,2>{0.876422107f, 0.208912671f},
-std::array<float,2>{0.489269078f, 0.802631259f},
-std::array<float,2>{0.269173443f, 0.366879165f},
-std::array<float,2>{0.758217752f, 0.532052159f},
-std::array<float,2>{0.551749706f, 0.13795878f},
-std::array<float,2>{0.220220283f, 0.85641247f},
-std::array<float,2>{0.0234911311f, 0.0673493519f},
-std::array<float,2>{0.671681046f, 0.994966567f},
-std::array<float,2>{0.973245442f, 0.48053211f},
-std::array<float,2>{0.383649588f, 0.653633118f},
-std::array<float,2>{0.4544954f, 0.245306924f},
-std::array<float,2>{0.915419936f, 0.756511807f},
-std::array<float,2>{0.74888587f, 0.299507707f},
-std::array<float,2>{0.124073222f, 0.586839437f},
-std::array<float,2>{0.135189667f, 0.4157134f},
-std::array<float,2>{0.588044286f, 0.703123271f},
-std::array<float,2>{0.823255777f, 0.0441814922f},
-std::array<float,2>{0.373714536f, 0.920085669f},
-std::array<float,2>{0.473064601f, 0.285723567f},
-std::array<float,2>{0.902190626f, 0.564009964f},
-std::array<float,2>{0.703975677f, 0.226908967f},
-std::array<float,2>{0.0721421465f, 0.780090213f},
-std::array<float,2>{0.161594763f, 0.0519157313f},
-std::array<float,2>{0.606318593f, 0.930113435f},
-std::array<float,2>{0.863990009f, 0.430378824f},
-std::array<float,2>{0.332884789f, 0.7177881f},
-std::array<float,2>{0.305642843f, 0.149858117f},
-std::array<float,2>{0.786070347f, 0.874575973f},
-std::array<float,2>{0.514782429f, 0.354281574f},
-std::array<float,2>{0.201760888f, 0.559956431f},
-std::array<float,2>{0.0334386416f, 0.486091703f},
-std::array<float,2>{0.628506184f, 0.634678125f},
-std::array<float,2>{0.947142065f, 0.0870555192f},
-std::array<float,2>{0.423678398f, 0.978907347f},
-std::array<float,2>{0.349525183f, 0.398530483f},
-std::array<float,2>{0.829578638f, 0.748601794f},
-std::array<float,2>{0.574305952f, 0.0278119259f},
-std::array<float,2>{0.146914929f, 0.898812115f},
-std::array<float,2>{0.10918656f, 0.201147079f},
-std::array<float,2>{0.724300861f, 0.781895757f},
-std::array<float,2>{0.927348495f, 0.26274547f},
-std::array<float,2>{0.450990826f, 0.606051326f},
-std::array<float,2>{0.390935898f, 0.118100211f},
-std::array<float,2>{0.991238117f, 0.958941996f},
-std::array<float,2>{0.68470031f, 0.458820552f},
-std::array<float,2>{0.012837653f, 0.667581499f},
-std::array<float,2>{0.237216339f, 0.314225942f},
-std::array<float,2>{0.53475827f, 0.508236289f},
-std::array<float,2>{0.77242893f, 0.183100432f},
-std::array<float,2>{0.251465291f, 0.840569973f},
-std::array<float,2>{0.459367067f, 0.461056173f},
-std::array<float,2>{0.91846174f, 0.657977223f},
-std::array<float,2>{0.743471384f, 0.11479713f},
-std::array<float,2>{0.119769827f, 0.964603901f},
-std::array<float,2>{0.136829853f, 0.17497398f},
-std::array<float,2>{0.590545535f, 0.828249216f},
-std::array<float,2>{0.824955344f, 0.32269913f},
-std::array<float,2>{0.368796706f, 0.502910852f},
-std::array<float,2>{0.270825475f, 0.0219909269f},
-std::array<float,2>{0.764941931f, 0.895320058f},
-std::array<float,2>{0.546908259f, 0.393336743f},
-std::array<float,2>{0.226146966f, 0.740975916f},
-std::array<float,2>{0.0291796289f, 0.253593713f},
-std::array<float,2>{0.665964007f, 0.594831288f},
-std::array<float,2>{0.970861197f, 0.194732547f},
-std::array<float,2>{0.387373269f, 0.790029824f},
-std::array<float,2>{0.322409213f, 0.35101071f},
-std::array<float,2>{0.85513258f, 0.55074656f},
-std::array<float,2>{0.621955156f, 0.145890355f},
-std::array<float,2>{0.172434643f, 0.866070569f},
-std::array<float,2>{0.0814858079f, 0.0823026747f},
-std::array<float,2>{0.696121633f, 0.970029771f},
-std::array<float,2>{0.879581153f, 0.497496158f},
-std::array<float,2>{0.485615939f, 0.632018209f},
-std::array<float,2>{0.419221938f, 0.226117641f},
-std::array<float,2>{0.965561748f, 0.767646313f},
-std::array<float,2>{0.642523289f, 0.289892465f},
-std::array<float,2>{0.0604080483f, 0.575151145f},
-std::array<float,2>{0.212444678f, 0.423963726f},
-std::array<float,2>{0.527652204f, 0.703741312f},
-std::array<float,2>{0.798801899f, 0.0606242642f},
-std::array<float,2>{0.29249543f, 0.926650405f},
-std::array<float,2>{0.397733808f, 0.306391716f},
-std::array<float,2>{0.985776007f, 0.582423866f},
-std::array<float,2>{0.680018127f, 0.235075027f},
-std::array<float,2>{0.0106964493f, 0.761329412f},
-std::array<float,2>{0.240024805f, 0.0326976553f},
-std::array<float,2>{0.537110746f, 0.913989484f},
-std::array<float,2>{0.767303526f, 0.412663549f},
-std::array<float,2>{0.254926652f, 0.695126414f},
-std::array<float,2>{0.346338511f, 0.131264761f},
-std::array<float,2>{0.833910346f, 0.849711955f},
-std::array<float,2>{0.571363926f, 0.372003824f},
-std::array<float,2>{0.141281709f, 0.544386268f},
-std::array<float,2>{0.10456387f, 0.47058621f},
-std::array<float,2>{0.719563544f, 0.643142819f},
-std::array<float,2>{0.922931254f, 0.0735255554f},
-std::array<float,2>{0.447479337f, 0.987702489f},
-std::array<float,2>{0.310581446f, 0.376165569f},
-std::array<float,2>{0.784056664f, 0.725874662f},
-std::array<float,2>{0.508113086f, 0.00404637679f},
-std::array<float,2>{0.198662922f, 0.887250185f},
-std::array<float,2>{0.0351991802f, 0.218303964f},
-std::array<float,2>{0.630202293f, 0.804704309f},
-std::array<float,2>{0.949444473f, 0.269418627f},
-std::array<float,2>{0.425962955f, 0.612497747f},
-std::array<float,2>{0.470401585f, 0.100159816f},
-std::array<float,2>{0.905566335f, 0.943647742f},
-std::array<float,2>{0.707158506f, 0.442095101f},
-std::array<float,2>{0.0748776197f, 0.680804849f},
-std::array<float,2>{0.157413244f, 0.330410868f},
-std::array<float,2>{0.60160023f, 0.526792169f},
-std::array<float,2>{0.860280693f, 0.160435498f},
-std::array<float,2>{0.328811318f, 0.814140797f},
-std::array<float,2>{0.435191274f, 0.420349121f},
-std::array<float,2>{0.938230097f, 0.696668983f},
-std::array<float,2>{0.636095643f, 0.0429249033f},
-std::array<float,2>{0.0405526757f, 0.915207922f},
-std::array<float,2>{0.190702289f, 0.248335317f},
-std::array<float,2>{0.502737403f, 0.751981437f},
-std::array<float,2>{0.793325305f, 0.303861409f},
-std::array<float,2>{0.298850417f, 0.59193784f},
-std::array<float,2>{0.337355942f, 0.0651663542f},
-std::array<float,2>{0.874952495f, 0.9977988f},
-std::array<float,2>{0.594608963f, 0.479752928f},
-std::array<float,2>{0.171286315f, 0.65012902f},
-std::array<float,2>{0.0702650473f, 0.362290651f},
-std::array<float,2>{0.71372515f, 0.538011134f},
-std::array<float,2>{0.896207511f, 0.13561134f},
-std::array<float,2>{0.479652226f, 0.854953766f},
-std::array<float,2>{0.261488438f, 0.280797601f},
-std::array<float,2>{0.779747546f, 0.62101233f},
-std::array<float,2>{0.541857064f, 0.203373283f},
-std::array<float,2>{0.245125026f, 0.798746884f},
-std::array<float,2>{0.00395954959f, 0.0133082857f},
-std::array<float,2>{0.67257601f, 0.879753292f},
-std::array<float,2>{0.996218145f, 0.387999058f},
-std::array<float,2>{0.400062501f, 0.728718758f},
-std::array<float,2>{0.439719319f, 0.166960046f},
-std::array<float,2>{0.930613875f, 0.82746315f},
-std::array<float,2>{0.729454696f, 0.338069052f},
-std::array<float,2>{0.0946256146f, 0.518573403f},
-std::array<float,2>{0.153714091f, 0.451306731f},
-std::array<float,2>{0.563878775f, 0.673380136f},
-std::array<float,2>{0.8433249f, 0.102731615f},
-std::array<float,2>{0.351639599f, 0.950349331f},
-std::array<float,2>{0.498556197f, 0.318434328f},
-std::array<float,2>{0.885892153f, 0.512591064f},
-std::array<float,2>{0.692244172f, 0.18682909f},
-std::array<float,2>{0.0903160945f, 0.839343727f},
-std::array<float,2>{0.184231132f, 0.121401042f},
-std::array<float,2>{0.610877812f, 0.955068529f},
-std::array<float,2>{0.850463271f, 0.456513643f},
-std::array<float,2>{0.318434f, 0.67186141f},
-std::array<float,2>{0.281265944f, 0.199092433f},
-std::array<float,2>{0.809035838f, 0.785950065f},
-std::array<float,2>{0.518616796f, 0.260038376f},
-std::array<float,2>{0.206643552f, 0.602976084f},
-std::array<float,2>{0.0528495312f, 0.404214501f},
-std::array<float,2>{0.649670541f, 0.743496418f},
-std::array<float,2>{0.957432389f, 0.0264419131f},
-std::array<float,2>{0.412686616f, 0.90585345f},
-std::array<float,2>{0.36445877f, 0.490464211f},
-std::array<float,2>{0.819257736f, 0.637583613f},
-std::array<float,2>{0.580636919f, 0.0927532241f},
-std::array<float,2>{0.127631947f, 0.980575144f},
-std::array<float,2>{0.112292506f, 0.153413042f},
-std::array<float,2>{0.736520171f, 0.869637966f},
-std::array<float,2>{0.91378969f, 0.359290004f},
-std::array<float,2>{0.46605128f, 0.554727435f},
-std::array<float,2>{0.380269617f, 0.0503348298f},
-std::array<float,2>{0.980498433f, 0.934427202f},
-std::array<float,2>{0.65832603f, 0.435600251f},
-std::array<float,2>{0.0187326167f, 0.711889863f},
-std::array<float,2>{0.227806181f, 0.283217251f},
-std::array<float,2>{0.56224364f, 0.56908375f},
-std::array<float,2>{0.752023518f, 0.231804937f},
-std::array<float,2>{0.278248847f, 0.775316954f},
-std::array<float,2>{0.483124435f, 0.395898223f},
-std::array<float,2>{0.892280698f, 0.737103164f},
-std::array<float,2>{0.717785597f, 0.0186404996f},
-std::array<float,2>{0.0662750676f, 0.894292593f},
-std::array<float,2>{0.164886266f, 0.189890847f},
-std::array<float,2>{0.59813267f, 0.79683888f},
-std::array<float,2>{0.867473841f, 0.256436199f},
-std::array<float,2>{0.342280567f, 0.598811448f},
-std::array<float,2>{0.301765889f, 0.111615658f},
-std::array<float,2>{0.789277971f, 0.967363179f},
-std::array<float,2>{0.505224705f, 0.468312681f},
-std::array<float,2>{0.193744257f, 0.662982643f},
-std::array<float,2>{0.0441498868f, 0.325016797f},
-std::array<float,2>{0.638873339f, 0.507178843f},
-std::array<float,2>{0.943603396f, 0.1790234f},
-std::array<float,2>{0.430935055f, 0.832894146f},
-std::array<float,2>{0.357962728f, 0.294637114f},
-std::array<float,2>{0.83919251f, 0.572545826f},
-std::array<float,2>{0.567177355f, 0.220859751f},
-std::array<float,2>{0.149464443f, 0.771535754f},
-std::array<float,2>{0.100497484f, 0.0556276888f},
-std::array<float,2>{0.734344542f, 0.922859848f},
-std::array<float,2>{0.933601141f, 0.426769674f},
-std::array<float,2>{0.445259243f, 0.70983094f},
-std::array<float,2>{0.405914128f, 0.143255457f},
-std::array<float,2>{0.992515206f, 0.860729814f},
-std::array<float,2>{0.67601949f, 0.344551235f},
-std::array<float,2>{0.000665090454f, 0.553108633f},
-std::array<float,2>{0.24969475f, 0.493742168f},
-std::array<float,2>{0.546079993f, 0.626514256f},
-std::array<float,2>{0.773947477f, 0.0793376639f},
-std::array<float,2>{0.261986315f, 0.973651946f},
-std::array<float,2>{0.407617033f, 0.367699265f},
-std::array<float,2>{0.953258693f, 0.54283154f},
-std::array<float,2>{0.655325711f, 0.125205338f},
-std::array<float,2>{0.0501477607f, 0.846636415f},
-std::array<float,2>{0.209422976f, 0.0745675042f},
-std::array<float,2>{0.520374656f, 0.989315689f},
-std::array<float,2>{0.807803214f, 0.474379838f},
-std::array<float,2>{0.286878824f, 0.644650817f},
-std::array<float,2>{0.315835208f, 0.239528939f},
-std::array<float,2>{0.844788015f, 0.763936281f},
-std::array<float,2>{0.617101908f, 0.310760856f},
-std::array<float,2>{0.180606291f, 0.581224918f},
-std::array<float,2>{0.0872545466f, 0.408716381f},
-std::array<float,2>{0.68793577f, 0.689124763f},
-std::array<float,2>{0.887084723f, 0.0387222022f},
-std::array<float,2>{0.495723695f, 0.90955323f},
-std::array<float,2>{0.274169296f, 0.441311717f},
-std::array<float,2>{0.75394249f, 0.684182167f},
-std::array<float,2>{0.556167722f, 0.095653981f},
-std::array<float,2>{0.232785344f, 0.939537585f},
-std::array<float,2>{0.0220075846f, 0.159894079f},
-std::array<float,2>{0.661953986f, 0.817192137f},
-std::array<float,2>{0.976714671f, 0.333605111f},
-std::array<float,2>{0.378591239f, 0.528830945f},
-std::array<float,2>{0.461443484f, 0.00103056419f},
-std::array<float,2>{0.908122361f, 0.884437203f},
-std::array<float,2>{0.739486217f, 0.381731659f},
-std::array<float,2>{0.115655497f, 0.721663475f},
-std::array<float,2>{0.129987866f, 0.270656914f},
-std::array<float,2>{0.584373057f, 0.616642177f},
-std::array<float,2>{0.81265378f, 0.214814067f},
-std::array<float,2>{0.362145454f, 0.808688402f},
-std::array<float,2>{0.38606894f, 0.483273864f},
-std::array<float,2>{0.976558805f, 0.654614091f},
-std::array<float,2>{0.66978544f, 0.0692561343f},
-std::array<float,2>{0.0267270263f, 0.993916154f},
-std::array<float,2>{0.222313836f, 0.139071345f},
-std::array<float,2>{0.554272771f, 0.859271109f},
-std::array<float,2>{0.760561943f, 0.365075856f},
-std::array<float,2>{0.2671597f, 0.5344733f},
-std::array<float,2>{0.371747494f, 0.0456992351f},
-std::array<float,2>{0.821132421f, 0.919270396f},
-std::array<float,2>{0.586735845f, 0.416413277f},
-std::array<float,2>{0.134244427f, 0.700531423f},
-std::array<float,2>{0.121760517f, 0.297844619f},
-std::array<float,2>{0.747058809f, 0.589830041f},
-std::array<float,2>{0.917176187f, 0.243518502f},
-std::array<float,2>{0.456229836f, 0.754014671f},
-std::array<float,2>{0.29433012f, 0.339888483f},
-std::array<float,2>{0.801380455f, 0.519881308f},
-std::array<float,2>{0.524609029f, 0.169092104f},
-std::array<float,2>{0.217141882f, 0.820863068f},
-std::array<float,2>{0.0559592359f, 0.108821556f},
-std::array<float,2>{0.646285892f, 0.945639014f},
-std::array<float,2>{0.96431917f, 0.447166085f},
-std::array<float,2>{0.41658783f, 0.678928018f},
-std::array<float,2>{0.49029395f, 0.209652245f},
-std::array<float,2>{0.878780246f, 0.804105639f},
-std::array<float,2>{0.701738179f, 0.273954421f},
-std::array<float,2>{0.0841865167f, 0.624367952f},
-std::array<float,2>{0.17632699f, 0.386691421f},
-std::array<float,2>{0.617543876f, 0.731939316f},
-std::array<float,2>{0.856879234f, 0.00840766728f},
-std::array<float,2>{0.32687664f, 0.878302038f},
-std::array<float,2>{0.451407552f, 0.265284836f},
-std::array<float,2>{0.929019928f, 0.60824579f},
-std::array<float,2>{0.725871027f, 0.202447385f},
-std::array<float,2>{0.105630219f, 0.784274578f},
-std::array<float,2>{0.145362899f, 0.029540481f},
-std::array<float,2>{0.577619851f, 0.901039183f},
-std::array<float,2>{0.830944777f, 0.401727378f},
-std::array<float,2>{0.349996507f, 0.74697274f},
-std::array<float,2>{0.252304912f, 0.181452304f},
-std::array<float,2>{0.770253122f, 0.843032658f},
-std::array<float,2>{0.531314194f, 0.316333592f},
-std::array<float,2>{0.234457523f, 0.5111534f},
-std::array<float,2>{0.0143456319f, 0.459249109f},
-std::array<float,2>{0.686937988f, 0.665532172f},
-std::array<float,2>{0.988521397f, 0.120079681f},
-std::array<float,2>{0.394285768f, 0.960549474f},
-std::array<float,2>{0.334255159f, 0.433073282f},
-std::array<float,2>{0.865770519f, 0.716478646f},
-std::array<float,2>{0.608287036f, 0.0533855297f},
-std::array<float,2>{0.164048851f, 0.931932986f},
-std::array<float,2>{0.073373653f, 0.229307145f},
-std::array<float,2>{0.705288231f, 0.77894628f},
-std::array<float,2>{0.900365174f, 0.288367718f},
-std::array<float,2>{0.47471568f, 0.564718068f},
-std::array<float,2>{0.424396515f, 0.0898040459f},
-std::array<float,2>{0.947490752f, 0.978125751f},
-std::array<float,2>{0.626540422f, 0.486361593f},
-std::array<float,2>{0.0325510204f, 0.635584891f},
-std::array<float,2>{0.199606299f, 0.353313267f},
-std::array<float,2>{0.512981594f, 0.561745405f},
-std::array<float,2>{0.788754642f, 0.151910856f},
-std::array<float,2>{0.308583826f, 0.872688651f}}
\ No newline at end of file
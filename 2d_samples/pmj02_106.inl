@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.651476681f, 0.46371612f},
-std::array<float,2>{0.40146479f, 0.773837447f},
-std::array<float,2>{0.908616722f, 0.537342727f},
-std::array<float,2>{0.100398384f, 0.147973582f},
-std::array<float,2>{0.864387572f, 0.0481172986f},
-std::array<float,2>{0.125228241f, 0.671185017f},
-std::array<float,2>{0.552288413f, 0.920547247f},
-std::array<float,2>{0.254550248f, 0.282939583f},
-std::array<float,2>{0.623892784f, 0.201251626f},
-std::array<float,2>{0.356466085f, 0.624795198f},
-std::array<float,2>{0.764988065f, 0.874596477f},
-std::array<float,2>{0.191671506f, 0.380729079f},
-std::array<float,2>{0.947512925f, 0.318892241f},
-std::array<float,2>{0.0445670784f, 0.951883256f},
-std::array<float,2>{0.720861912f, 0.720237613f},
-std::array<float,2>{0.480527461f, 0.120373987f},
-std::array<float,2>{0.503112555f, 0.252967805f},
-std::array<float,2>{0.30296728f, 0.886316776f},
-std::array<float,2>{0.824354589f, 0.627715528f},
-std::array<float,2>{0.173089668f, 0.0220169295f},
-std::array<float,2>{0.877595723f, 0.16815789f},
-std::array<float,2>{0.0638734922f, 0.519149303f},
-std::array<float,2>{0.660238743f, 0.798725486f},
-std::array<float,2>{0.429319769f, 0.480863363f},
-std::array<float,2>{0.695459664f, 0.0899455398f},
-std::array<float,2>{0.464650214f, 0.718341649f},
-std::array<float,2>{0.998982131f, 0.99947834f},
-std::array<float,2>{0.0255451109f, 0.367347002f},
-std::array<float,2>{0.806644261f, 0.436140656f},
-std::array<float,2>{0.224542066f, 0.825044692f},
-std::array<float,2>{0.567163944f, 0.579044044f},
-std::array<float,2>{0.316408724f, 0.226270765f},
-std::array<float,2>{0.747331798f, 0.348393708f},
-std::array<float,2>{0.485153615f, 0.975761294f},
-std::array<float,2>{0.957192838f, 0.69200623f},
-std::array<float,2>{0.0539613962f, 0.0720260069f},
-std::array<float,2>{0.768299878f, 0.245242611f},
-std::array<float,2>{0.20936951f, 0.576383114f},
-std::array<float,2>{0.606526375f, 0.837182939f},
-std::array<float,2>{0.371190608f, 0.417660803f},
-std::array<float,2>{0.543647707f, 0.0135936178f},
-std::array<float,2>{0.268611908f, 0.643579006f},
-std::array<float,2>{0.849738181f, 0.891473472f},
-std::array<float,2>{0.154946357f, 0.278866976f},
-std::array<float,2>{0.928106487f, 0.487643361f},
-std::array<float,2>{0.110549994f, 0.793284833f},
-std::array<float,2>{0.63910526f, 0.511518896f},
-std::array<float,2>{0.382628351f, 0.182696849f},
-std::array<float,2>{0.579803109f, 0.402500749f},
-std::array<float,2>{0.33361271f, 0.856984198f},
-std::array<float,2>{0.791469038f, 0.594358563f},
-std::array<float,2>{0.242260322f, 0.206601232f},
-std::array<float,2>{0.975271225f, 0.097414434f},
-std::array<float,2>{0.0152341016f, 0.742264092f},
-std::array<float,2>{0.717629671f, 0.965219498f},
-std::array<float,2>{0.441408604f, 0.341706902f},
-std::array<float,2>{0.67285639f, 0.127670795f},
-std::array<float,2>{0.409231007f, 0.552024961f},
-std::array<float,2>{0.8928262f, 0.764411867f},
-std::array<float,2>{0.0853996053f, 0.447736621f},
-std::array<float,2>{0.829288661f, 0.31153661f},
-std::array<float,2>{0.168933541f, 0.925695837f},
-std::array<float,2>{0.525063753f, 0.678861856f},
-std::array<float,2>{0.283713996f, 0.034744855f},
-std::array<float,2>{0.70658505f, 0.407610267f},
-std::array<float,2>{0.451067388f, 0.829916477f},
-std::array<float,2>{0.982407212f, 0.566655278f},
-std::array<float,2>{0.00209902041f, 0.242173284f},
-std::array<float,2>{0.782646954f, 0.0692407414f},
-std::array<float,2>{0.236937612f, 0.697741091f},
-std::array<float,2>{0.586364388f, 0.977706254f},
-std::array<float,2>{0.336998373f, 0.356925279f},
-std::array<float,2>{0.5216133f, 0.174832657f},
-std::array<float,2>{0.290806651f, 0.502130449f},
-std::array<float,2>{0.840419233f, 0.788974643f},
-std::array<float,2>{0.159472838f, 0.492467403f},
-std::array<float,2>{0.906006038f, 0.267410994f},
-std::array<float,2>{0.0864455998f, 0.904654562f},
-std::array<float,2>{0.681085467f, 0.655184865f},
-std::array<float,2>{0.418903828f, 0.00648953393f},
-std::array<float,2>{0.596866369f, 0.333300561f},
-std::array<float,2>{0.360197902f, 0.953132987f},
-std::array<float,2>{0.776547492f, 0.73550719f},
-std::array<float,2>{0.213830844f, 0.107731119f},
-std::array<float,2>{0.966835797f, 0.216154933f},
-std::array<float,2>{0.0605088808f, 0.602806449f},
-std::array<float,2>{0.737089813f, 0.849084854f},
-std::array<float,2>{0.498566985f, 0.394919068f},
-std::array<float,2>{0.629683733f, 0.0453447774f},
-std::array<float,2>{0.385676652f, 0.687051594f},
-std::array<float,2>{0.929811358f, 0.930509329f},
-std::array<float,2>{0.121935844f, 0.297151446f},
-std::array<float,2>{0.859060705f, 0.443592399f},
-std::array<float,2>{0.141961232f, 0.750547886f},
-std::array<float,2>{0.532676339f, 0.559186697f},
-std::array<float,2>{0.281014621f, 0.138103664f},
-std::array<float,2>{0.668550014f, 0.296645433f},
-std::array<float,2>{0.432821125f, 0.908036649f},
-std::array<float,2>{0.886478961f, 0.657265365f},
-std::array<float,2>{0.0761728585f, 0.0590167381f},
-std::array<float,2>{0.81896174f, 0.149617583f},
-std::array<float,2>{0.185195461f, 0.545626283f},
-std::array<float,2>{0.513162553f, 0.772044599f},
-std::array<float,2>{0.307593375f, 0.456033319f},
-std::array<float,2>{0.5759359f, 0.109719053f},
-std::array<float,2>{0.325341225f, 0.729126036f},
-std::array<float,2>{0.799203575f, 0.938021183f},
-std::array<float,2>{0.231719822f, 0.325445175f},
-std::array<float,2>{0.991012394f, 0.383938491f},
-std::array<float,2>{0.0189670715f, 0.86450088f},
-std::array<float,2>{0.690375328f, 0.609612107f},
-std::array<float,2>{0.46027863f, 0.192780539f},
-std::array<float,2>{0.558291972f, 0.473849118f},
-std::array<float,2>{0.260710984f, 0.810960233f},
-std::array<float,2>{0.872691929f, 0.525022388f},
-std::array<float,2>{0.138665095f, 0.158444464f},
-std::array<float,2>{0.916992188f, 0.031046167f},
-std::array<float,2>{0.103604123f, 0.633856177f},
-std::array<float,2>{0.643135428f, 0.876231611f},
-std::array<float,2>{0.393154502f, 0.260698736f},
-std::array<float,2>{0.728585064f, 0.228953317f},
-std::array<float,2>{0.471608907f, 0.586573839f},
-std::array<float,2>{0.943011642f, 0.813848972f},
-std::array<float,2>{0.0376710258f, 0.425358862f},
-std::array<float,2>{0.751578569f, 0.363886237f},
-std::array<float,2>{0.199958473f, 0.990768015f},
-std::array<float,2>{0.616531312f, 0.710222661f},
-std::array<float,2>{0.346134841f, 0.0847423151f},
-std::array<float,2>{0.683657765f, 0.376693577f},
-std::array<float,2>{0.417012572f, 0.870382607f},
-std::array<float,2>{0.898679197f, 0.620839417f},
-std::array<float,2>{0.0927494243f, 0.196561396f},
-std::array<float,2>{0.837067485f, 0.123587631f},
-std::array<float,2>{0.163708314f, 0.725707769f},
-std::array<float,2>{0.518751025f, 0.948422551f},
-std::array<float,2>{0.294567645f, 0.315126538f},
-std::array<float,2>{0.593030751f, 0.144230872f},
-std::array<float,2>{0.342723161f, 0.533522367f},
-std::array<float,2>{0.786175787f, 0.780965507f},
-std::array<float,2>{0.241735116f, 0.467186242f},
-std::array<float,2>{0.978490889f, 0.28553161f},
-std::array<float,2>{0.00481678173f, 0.915000081f},
-std::array<float,2>{0.709374547f, 0.666784883f},
-std::array<float,2>{0.447235167f, 0.0522340387f},
-std::array<float,2>{0.537180483f, 0.373873115f},
-std::array<float,2>{0.2739501f, 0.995149136f},
-std::array<float,2>{0.853633583f, 0.71458143f},
-std::array<float,2>{0.146919951f, 0.0891582444f},
-std::array<float,2>{0.936555147f, 0.21879898f},
-std::array<float,2>{0.119781256f, 0.584525883f},
-std::array<float,2>{0.628887773f, 0.824099183f},
-std::array<float,2>{0.390442282f, 0.432360828f},
-std::array<float,2>{0.741611421f, 0.0173931364f},
-std::array<float,2>{0.493419737f, 0.63255626f},
-std::array<float,2>{0.963406324f, 0.88922143f},
-std::array<float,2>{0.0548750833f, 0.254718035f},
-std::array<float,2>{0.779397845f, 0.479526997f},
-std::array<float,2>{0.217231438f, 0.803117871f},
-std::array<float,2>{0.598785222f, 0.519921899f},
-std::array<float,2>{0.36619693f, 0.16445832f},
-std::array<float,2>{0.694177151f, 0.276071966f},
-std::array<float,2>{0.453287721f, 0.894751012f},
-std::array<float,2>{0.987384737f, 0.646338642f},
-std::array<float,2>{0.020524485f, 0.0107074101f},
-std::array<float,2>{0.80087328f, 0.187114224f},
-std::array<float,2>{0.226794794f, 0.513815701f},
-std::array<float,2>{0.571445942f, 0.790450454f},
-std::array<float,2>{0.320831895f, 0.488962084f},
-std::array<float,2>{0.508964717f, 0.0774440616f},
-std::array<float,2>{0.309702039f, 0.687518299f},
-std::array<float,2>{0.814785838f, 0.972053409f},
-std::array<float,2>{0.182101488f, 0.347480267f},
-std::array<float,2>{0.887254417f, 0.421183348f},
-std::array<float,2>{0.0733282343f, 0.8434636f},
-std::array<float,2>{0.666955411f, 0.573326886f},
-std::array<float,2>{0.434376121f, 0.248332977f},
-std::array<float,2>{0.612633228f, 0.452279508f},
-std::array<float,2>{0.34772864f, 0.759100318f},
-std::array<float,2>{0.757717192f, 0.549817979f},
-std::array<float,2>{0.196896732f, 0.129941404f},
-std::array<float,2>{0.940235198f, 0.0384518877f},
-std::array<float,2>{0.0333910137f, 0.673474252f},
-std::array<float,2>{0.733448684f, 0.926763654f},
-std::array<float,2>{0.472858131f, 0.305270821f},
-std::array<float,2>{0.647296607f, 0.210031375f},
-std::array<float,2>{0.398388177f, 0.599986196f},
-std::array<float,2>{0.920921028f, 0.853672862f},
-std::array<float,2>{0.109039955f, 0.402036369f},
-std::array<float,2>{0.868382454f, 0.337308407f},
-std::array<float,2>{0.134223849f, 0.96233964f},
-std::array<float,2>{0.562438309f, 0.746713698f},
-std::array<float,2>{0.262744576f, 0.0983852521f},
-std::array<float,2>{0.724108517f, 0.496242106f},
-std::array<float,2>{0.477063954f, 0.783009648f},
-std::array<float,2>{0.952626526f, 0.505205274f},
-std::array<float,2>{0.0413439237f, 0.176275626f},
-std::array<float,2>{0.759017408f, 0.00139559957f},
-std::array<float,2>{0.190037161f, 0.651254892f},
-std::array<float,2>{0.620778739f, 0.901758671f},
-std::array<float,2>{0.353808105f, 0.272168189f},
-std::array<float,2>{0.549551606f, 0.2379594f},
-std::array<float,2>{0.251591295f, 0.562846482f},
-std::array<float,2>{0.863037586f, 0.83502084f},
-std::array<float,2>{0.131477267f, 0.410466939f},
-std::array<float,2>{0.910165131f, 0.354889244f},
-std::array<float,2>{0.096464701f, 0.983194232f},
-std::array<float,2>{0.655638933f, 0.703055322f},
-std::array<float,2>{0.402758718f, 0.0657094717f},
-std::array<float,2>{0.564724147f, 0.303662956f},
-std::array<float,2>{0.313909352f, 0.935467601f},
-std::array<float,2>{0.809214354f, 0.681461871f},
-std::array<float,2>{0.221971691f, 0.0423997603f},
-std::array<float,2>{0.992218614f, 0.134786546f},
-std::array<float,2>{0.0297994409f, 0.558415532f},
-std::array<float,2>{0.700265527f, 0.755428016f},
-std::array<float,2>{0.467559099f, 0.440168202f},
-std::array<float,2>{0.656528056f, 0.104347736f},
-std::array<float,2>{0.422706217f, 0.739028513f},
-std::array<float,2>{0.882194936f, 0.960386992f},
-std::array<float,2>{0.0670068264f, 0.330590338f},
-std::array<float,2>{0.822990477f, 0.3910079f},
-std::array<float,2>{0.178696826f, 0.845053136f},
-std::array<float,2>{0.505787671f, 0.605677664f},
-std::array<float,2>{0.299531132f, 0.211724579f},
-std::array<float,2>{0.636262238f, 0.32178086f},
-std::array<float,2>{0.37831369f, 0.943430245f},
-std::array<float,2>{0.923288226f, 0.732217133f},
-std::array<float,2>{0.11468026f, 0.115525283f},
-std::array<float,2>{0.847385406f, 0.190181702f},
-std::array<float,2>{0.151425317f, 0.613895953f},
-std::array<float,2>{0.541304648f, 0.861809909f},
-std::array<float,2>{0.272620618f, 0.388948768f},
-std::array<float,2>{0.601831675f, 0.0580013953f},
-std::array<float,2>{0.370240211f, 0.663631916f},
-std::array<float,2>{0.772080898f, 0.910871446f},
-std::array<float,2>{0.206835553f, 0.291112602f},
-std::array<float,2>{0.956951976f, 0.459261745f},
-std::array<float,2>{0.0476355366f, 0.769206226f},
-std::array<float,2>{0.745852709f, 0.53919661f},
-std::array<float,2>{0.489368021f, 0.154432088f},
-std::array<float,2>{0.530101895f, 0.428525001f},
-std::array<float,2>{0.287295192f, 0.818197012f},
-std::array<float,2>{0.83557564f, 0.590380549f},
-std::array<float,2>{0.167441741f, 0.232467279f},
-std::array<float,2>{0.897184074f, 0.0794378892f},
-std::array<float,2>{0.07912682f, 0.706429958f},
-std::array<float,2>{0.677224338f, 0.987388372f},
-std::array<float,2>{0.413527101f, 0.362058252f},
-std::array<float,2>{0.713001072f, 0.162628472f},
-std::array<float,2>{0.441273332f, 0.530635357f},
-std::array<float,2>{0.971960366f, 0.806560934f},
-std::array<float,2>{0.0112265395f, 0.470093369f},
-std::array<float,2>{0.796846151f, 0.264237583f},
-std::array<float,2>{0.249146193f, 0.882471144f},
-std::array<float,2>{0.583320022f, 0.637687802f},
-std::array<float,2>{0.330483973f, 0.0255227387f},
-std::array<float,2>{0.662660003f, 0.48272875f},
-std::array<float,2>{0.42619428f, 0.799308896f},
-std::array<float,2>{0.875597537f, 0.515822113f},
-std::array<float,2>{0.0645200387f, 0.170897573f},
-std::array<float,2>{0.827531576f, 0.0198942516f},
-std::array<float,2>{0.174875125f, 0.626880705f},
-std::array<float,2>{0.500068545f, 0.88377291f},
-std::array<float,2>{0.301247507f, 0.251478612f},
-std::array<float,2>{0.569499791f, 0.223135665f},
-std::array<float,2>{0.319396585f, 0.582013786f},
-std::array<float,2>{0.805357635f, 0.826273859f},
-std::array<float,2>{0.225030318f, 0.4341757f},
-std::array<float,2>{0.996534169f, 0.370971799f},
-std::array<float,2>{0.0239808299f, 0.997991681f},
-std::array<float,2>{0.698456347f, 0.715936184f},
-std::array<float,2>{0.462446123f, 0.0927074254f},
-std::array<float,2>{0.552737296f, 0.285130948f},
-std::array<float,2>{0.256656796f, 0.919360042f},
-std::array<float,2>{0.866879761f, 0.668184221f},
-std::array<float,2>{0.128111601f, 0.050028652f},
-std::array<float,2>{0.907131851f, 0.145429894f},
-std::array<float,2>{0.0994380787f, 0.536643863f},
-std::array<float,2>{0.64923811f, 0.776966095f},
-std::array<float,2>{0.399475813f, 0.461763948f},
-std::array<float,2>{0.718995094f, 0.119104967f},
-std::array<float,2>{0.483429611f, 0.721318126f},
-std::array<float,2>{0.946139514f, 0.950105309f},
-std::array<float,2>{0.0466583334f, 0.317707032f},
-std::array<float,2>{0.763651669f, 0.380975515f},
-std::array<float,2>{0.195167914f, 0.872521758f},
-std::array<float,2>{0.622964621f, 0.622985363f},
-std::array<float,2>{0.357722491f, 0.200722948f},
-std::array<float,2>{0.715116084f, 0.342411518f},
-std::array<float,2>{0.444371581f, 0.966890574f},
-std::array<float,2>{0.973502278f, 0.745879471f},
-std::array<float,2>{0.0127004953f, 0.094670184f},
-std::array<float,2>{0.790204048f, 0.204274684f},
-std::array<float,2>{0.245229051f, 0.595831037f},
-std::array<float,2>{0.581682026f, 0.857460499f},
-std::array<float,2>{0.334665537f, 0.404503226f},
-std::array<float,2>{0.525982618f, 0.031387452f},
-std::array<float,2>{0.282456249f, 0.675844789f},
-std::array<float,2>{0.831581473f, 0.923700452f},
-std::array<float,2>{0.17102468f, 0.309363157f},
-std::array<float,2>{0.89231652f, 0.445854992f},
-std::array<float,2>{0.0828494802f, 0.762573183f},
-std::array<float,2>{0.674995363f, 0.554662108f},
-std::array<float,2>{0.407156616f, 0.126160875f},
-std::array<float,2>{0.609281421f, 0.414114177f},
-std::array<float,2>{0.373583317f, 0.839281917f},
-std::array<float,2>{0.766336381f, 0.575897217f},
-std::array<float,2>{0.207517982f, 0.243680626f},
-std::array<float,2>{0.959650874f, 0.0739784092f},
-std::array<float,2>{0.0515296943f, 0.694097161f},
-std::array<float,2>{0.749659359f, 0.974426866f},
-std::array<float,2>{0.486387283f, 0.349848628f},
-std::array<float,2>{0.638410866f, 0.181313053f},
-std::array<float,2>{0.379437625f, 0.509286761f},
-std::array<float,2>{0.92665261f, 0.795903444f},
-std::array<float,2>{0.111604989f, 0.485145748f},
-std::array<float,2>{0.847915113f, 0.28105104f},
-std::array<float,2>{0.15367876f, 0.893274069f},
-std::array<float,2>{0.546874523f, 0.640837014f},
-std::array<float,2>{0.266535163f, 0.0138069727f},
-std::array<float,2>{0.734551013f, 0.396706074f},
-std::array<float,2>{0.497820258f, 0.849993169f},
-std::array<float,2>{0.964941978f, 0.604665995f},
-std::array<float,2>{0.0606630072f, 0.217593357f},
-std::array<float,2>{0.77494818f, 0.106945567f},
-std::array<float,2>{0.212716356f, 0.738270998f},
-std::array<float,2>{0.593902171f, 0.955649793f},
-std::array<float,2>{0.362193704f, 0.334026784f},
-std::array<float,2>{0.534444034f, 0.140455738f},
-std::array<float,2>{0.277633667f, 0.561902881f},
-std::array<float,2>{0.856975794f, 0.75271678f},
-std::array<float,2>{0.143907443f, 0.443220496f},
-std::array<float,2>{0.932370543f, 0.298968226f},
-std::array<float,2>{0.123948321f, 0.932479143f},
-std::array<float,2>{0.632601261f, 0.685134351f},
-std::array<float,2>{0.383668005f, 0.0442773215f},
-std::array<float,2>{0.588306963f, 0.35911721f},
-std::array<float,2>{0.338638932f, 0.978982925f},
-std::array<float,2>{0.784575641f, 0.695375681f},
-std::array<float,2>{0.236146793f, 0.0682528764f},
-std::array<float,2>{0.983648717f, 0.239536881f},
-std::array<float,2>{0.000233656901f, 0.569189847f},
-std::array<float,2>{0.703960598f, 0.830982566f},
-std::array<float,2>{0.452184767f, 0.408512831f},
-std::array<float,2>{0.682172f, 0.00437429501f},
-std::array<float,2>{0.419950068f, 0.652649105f},
-std::array<float,2>{0.903519392f, 0.902854264f},
-std::array<float,2>{0.0881828964f, 0.268873781f},
-std::array<float,2>{0.843085051f, 0.495985776f},
-std::array<float,2>{0.15691255f, 0.785668015f},
-std::array<float,2>{0.521161139f, 0.501501501f},
-std::array<float,2>{0.29290837f, 0.173802271f},
-std::array<float,2>{0.641270578f, 0.258916497f},
-std::array<float,2>{0.390717447f, 0.877996504f},
-std::array<float,2>{0.91567874f, 0.636278331f},
-std::array<float,2>{0.10321565f, 0.0289207641f},
-std::array<float,2>{0.873923004f, 0.156601623f},
-std::array<float,2>{0.139921933f, 0.525852382f},
-std::array<float,2>{0.554881454f, 0.809158146f},
-std::array<float,2>{0.258979261f, 0.475981921f},
-std::array<float,2>{0.613421738f, 0.0837861672f},
-std::array<float,2>{0.345344454f, 0.707075298f},
-std::array<float,2>{0.752770543f, 0.989749432f},
-std::array<float,2>{0.203067213f, 0.365319073f},
-std::array<float,2>{0.944814205f, 0.422508627f},
-std::array<float,2>{0.0366275683f, 0.815393507f},
-std::array<float,2>{0.727332473f, 0.58980912f},
-std::array<float,2>{0.470145136f, 0.228369668f},
-std::array<float,2>{0.514631569f, 0.453761548f},
-std::array<float,2>{0.305931509f, 0.771144748f},
-std::array<float,2>{0.81734544f, 0.543723762f},
-std::array<float,2>{0.186647326f, 0.150921866f},
-std::array<float,2>{0.884574831f, 0.0615777299f},
-std::array<float,2>{0.075776428f, 0.660116434f},
-std::array<float,2>{0.671579838f, 0.908533871f},
-std::array<float,2>{0.4301081f, 0.293448359f},
-std::array<float,2>{0.689069867f, 0.193789527f},
-std::array<float,2>{0.457330525f, 0.612342119f},
-std::array<float,2>{0.988658667f, 0.866032004f},
-std::array<float,2>{0.0166687369f, 0.385400146f},
-std::array<float,2>{0.798378825f, 0.326217741f},
-std::array<float,2>{0.234150946f, 0.940008104f},
-std::array<float,2>{0.577269673f, 0.727437496f},
-std::array<float,2>{0.327214062f, 0.112065949f},
-std::array<float,2>{0.626411736f, 0.431552917f},
-std::array<float,2>{0.387803555f, 0.821736932f},
-std::array<float,2>{0.934978426f, 0.583734274f},
-std::array<float,2>{0.118949898f, 0.22073707f},
-std::array<float,2>{0.852653861f, 0.0867275f},
-std::array<float,2>{0.144566998f, 0.712055326f},
-std::array<float,2>{0.536992133f, 0.993480325f},
-std::array<float,2>{0.276901722f, 0.372083664f},
-std::array<float,2>{0.599951327f, 0.167532161f},
-std::array<float,2>{0.363575339f, 0.522369742f},
-std::array<float,2>{0.778484225f, 0.802243292f},
-std::array<float,2>{0.214874655f, 0.478409499f},
-std::array<float,2>{0.96251744f, 0.256941497f},
-std::array<float,2>{0.0577563308f, 0.887531996f},
-std::array<float,2>{0.739286959f, 0.630563021f},
-std::array<float,2>{0.495126307f, 0.0190593749f},
-std::array<float,2>{0.515841603f, 0.313697815f},
-std::array<float,2>{0.296560168f, 0.946903288f},
-std::array<float,2>{0.839558601f, 0.722879708f},
-std::array<float,2>{0.161073521f, 0.122486919f},
-std::array<float,2>{0.901868045f, 0.198989734f},
-std::array<float,2>{0.0913786814f, 0.619095206f},
-std::array<float,2>{0.68677634f, 0.86768496f},
-std::array<float,2>{0.414783865f, 0.378763199f},
-std::array<float,2>{0.707215965f, 0.0534375347f},
-std::array<float,2>{0.447332323f, 0.665320277f},
-std::array<float,2>{0.979030132f, 0.917493761f},
-std::array<float,2>{0.00590171106f, 0.287195265f},
-std::array<float,2>{0.788434625f, 0.464881152f},
-std::array<float,2>{0.239095196f, 0.778662264f},
-std::array<float,2>{0.590899289f, 0.532849669f},
-std::array<float,2>{0.340425402f, 0.140647277f},
-std::array<float,2>{0.730740547f, 0.308488846f},
-std::array<float,2>{0.475037009f, 0.929397702f},
-std::array<float,2>{0.938449979f, 0.674298584f},
-std::array<float,2>{0.0314638726f, 0.0355916545f},
-std::array<float,2>{0.754226685f, 0.132430077f},
-std::array<float,2>{0.19731538f, 0.548259616f},
-std::array<float,2>{0.611137152f, 0.760181248f},
-std::array<float,2>{0.350013882f, 0.45001018f},
-std::array<float,2>{0.559035301f, 0.100744635f},
-std::array<float,2>{0.264081985f, 0.748379648f},
-std::array<float,2>{0.870690525f, 0.963647604f},
-std::array<float,2>{0.135194466f, 0.338600904f},
-std::array<float,2>{0.918211639f, 0.400366068f},
-std::array<float,2>{0.106221162f, 0.85201472f},
-std::array<float,2>{0.645136833f, 0.598917007f},
-std::array<float,2>{0.396319807f, 0.207570821f},
-std::array<float,2>{0.572771847f, 0.49045366f},
-std::array<float,2>{0.322792679f, 0.792493284f},
-std::array<float,2>{0.804268956f, 0.513402939f},
-std::array<float,2>{0.228936568f, 0.184617117f},
-std::array<float,2>{0.985867679f, 0.00833013467f},
-std::array<float,2>{0.0224886276f, 0.647923648f},
-std::array<float,2>{0.69216156f, 0.898310423f},
-std::array<float,2>{0.45672372f, 0.274472386f},
-std::array<float,2>{0.665223479f, 0.247521624f},
-std::array<float,2>{0.4366602f, 0.571733534f},
-std::array<float,2>{0.890122235f, 0.839986503f},
-std::array<float,2>{0.0719239041f, 0.419686615f},
-std::array<float,2>{0.812595665f, 0.344961256f},
-std::array<float,2>{0.180495679f, 0.970156968f},
-std::array<float,2>{0.511147022f, 0.691146314f},
-std::array<float,2>{0.311201513f, 0.0744327232f},
-std::array<float,2>{0.702454507f, 0.438941509f},
-std::array<float,2>{0.465776235f, 0.756081939f},
-std::array<float,2>{0.994554043f, 0.556032956f},
-std::array<float,2>{0.0288546439f, 0.134056911f},
-std::array<float,2>{0.812200427f, 0.0395547934f},
-std::array<float,2>{0.220232457f, 0.682193398f},
-std::array<float,2>{0.563410699f, 0.936504245f},
-std::array<float,2>{0.315873384f, 0.300827324f},
-std::array<float,2>{0.506399274f, 0.214255407f},
-std::array<float,2>{0.297988355f, 0.608230054f},
-std::array<float,2>{0.821283102f, 0.846710324f},
-std::array<float,2>{0.175892577f, 0.393867284f},
-std::array<float,2>{0.880014956f, 0.328828037f},
-std::array<float,2>{0.0692940131f, 0.958341837f},
-std::array<float,2>{0.658242345f, 0.741651475f},
-std::array<float,2>{0.42495203f, 0.102578774f},
-std::array<float,2>{0.617680669f, 0.270649999f},
-std::array<float,2>{0.351869017f, 0.898473024f},
-std::array<float,2>{0.760490298f, 0.648929596f},
-std::array<float,2>{0.18859303f, 0.00208315672f},
-std::array<float,2>{0.949596167f, 0.179350451f},
-std::array<float,2>{0.0392470881f, 0.506313264f},
-std::array<float,2>{0.726559579f, 0.784748197f},
-std::array<float,2>{0.479881257f, 0.498576373f},
-std::array<float,2>{0.653603375f, 0.0627065897f},
-std::array<float,2>{0.404328287f, 0.701077759f},
-std::array<float,2>{0.913940132f, 0.98093766f},
-std::array<float,2>{0.094865039f, 0.353134394f},
-std::array<float,2>{0.860956371f, 0.413376451f},
-std::array<float,2>{0.130090922f, 0.832624614f},
-std::array<float,2>{0.548754871f, 0.565352261f},
-std::array<float,2>{0.253326237f, 0.234804258f},
-std::array<float,2>{0.679274619f, 0.360200435f},
-std::array<float,2>{0.411429107f, 0.986039817f},
-std::array<float,2>{0.894897103f, 0.704288661f},
-std::array<float,2>{0.0817646533f, 0.0808600262f},
-std::array<float,2>{0.833209455f, 0.231209263f},
-std::array<float,2>{0.164459318f, 0.593672037f},
-std::array<float,2>{0.527513564f, 0.818446994f},
-std::array<float,2>{0.285307705f, 0.427415699f},
-std::array<float,2>{0.585311055f, 0.0243393146f},
-std::array<float,2>{0.329587817f, 0.639166951f},
-std::array<float,2>{0.794797242f, 0.879635334f},
-std::array<float,2>{0.247211799f, 0.262936801f},
-std::array<float,2>{0.969780207f, 0.470788449f},
-std::array<float,2>{0.00789530482f, 0.807286203f},
-std::array<float,2>{0.711045563f, 0.528077662f},
-std::array<float,2>{0.438016623f, 0.161910206f},
-std::array<float,2>{0.540256739f, 0.386782825f},
-std::array<float,2>{0.270214736f, 0.860192478f},
-std::array<float,2>{0.844568074f, 0.615400374f},
-std::array<float,2>{0.150317192f, 0.188604116f},
-std::array<float,2>{0.925220788f, 0.115187526f},
-std::array<float,2>{0.116905525f, 0.734100819f},
-std::array<float,2>{0.633883238f, 0.942738116f},
-std::array<float,2>{0.376731157f, 0.322798163f},
-std::array<float,2>{0.743213773f, 0.154117897f},
-std::array<float,2>{0.490304977f, 0.542656183f},
-std::array<float,2>{0.95492512f, 0.767302692f},
-std::array<float,2>{0.0506366454f, 0.457634121f},
-std::array<float,2>{0.770810902f, 0.290152758f},
-std::array<float,2>{0.203450859f, 0.913847685f},
-std::array<float,2>{0.604388475f, 0.66186744f},
-std::array<float,2>{0.368591994f, 0.0566298589f},
-std::array<float,2>{0.640036047f, 0.48612532f},
-std::array<float,2>{0.380950809f, 0.795049608f},
-std::array<float,2>{0.928979516f, 0.50861913f},
-std::array<float,2>{0.110336997f, 0.180209175f},
-std::array<float,2>{0.8513906f, 0.0152182439f},
-std::array<float,2>{0.156231493f, 0.641927838f},
-std::array<float,2>{0.54465878f, 0.894086897f},
-std::array<float,2>{0.267641008f, 0.279694557f},
-std::array<float,2>{0.605538309f, 0.242191017f},
-std::array<float,2>{0.372200489f, 0.574764788f},
-std::array<float,2>{0.769099474f, 0.838759422f},
-std::array<float,2>{0.210918978f, 0.415845096f},
-std::array<float,2>{0.958446145f, 0.350715369f},
-std::array<float,2>{0.0536532439f, 0.972771287f},
-std::array<float,2>{0.746482491f, 0.694706619f},
-std::array<float,2>{0.485539913f, 0.0726506338f},
-std::array<float,2>{0.524258256f, 0.310199529f},
-std::array<float,2>{0.284728914f, 0.922345102f},
-std::array<float,2>{0.828317821f, 0.677454829f},
-std::array<float,2>{0.169607729f, 0.0327842757f},
-std::array<float,2>{0.894215286f, 0.12511915f},
-std::array<float,2>{0.0842315257f, 0.552980006f},
-std::array<float,2>{0.672554374f, 0.762707591f},
-std::array<float,2>{0.408740163f, 0.446968168f},
-std::array<float,2>{0.717964232f, 0.0951856151f},
-std::array<float,2>{0.443035275f, 0.74484843f},
-std::array<float,2>{0.976400673f, 0.968551874f},
-std::array<float,2>{0.0139236683f, 0.343734562f},
-std::array<float,2>{0.792303622f, 0.40581128f},
-std::array<float,2>{0.243951559f, 0.858703256f},
-std::array<float,2>{0.578857958f, 0.597290635f},
-std::array<float,2>{0.332770199f, 0.203916296f},
-std::array<float,2>{0.721871436f, 0.316466093f},
-std::array<float,2>{0.481745273f, 0.950465262f},
-std::array<float,2>{0.948867679f, 0.722084463f},
-std::array<float,2>{0.0433481596f, 0.117376946f},
-std::array<float,2>{0.764050364f, 0.199436679f},
-std::array<float,2>{0.193020627f, 0.621346653f},
-std::array<float,2>{0.62424016f, 0.871722877f},
-std::array<float,2>{0.356177717f, 0.382140756f},
-std::array<float,2>{0.551339269f, 0.0488598794f},
-std::array<float,2>{0.255763173f, 0.669358909f},
-std::array<float,2>{0.86378628f, 0.918842316f},
-std::array<float,2>{0.126885995f, 0.283903658f},
-std::array<float,2>{0.910074651f, 0.462455332f},
-std::array<float,2>{0.101270281f, 0.77549094f},
-std::array<float,2>{0.651347697f, 0.535191476f},
-std::array<float,2>{0.401100904f, 0.145871416f},
-std::array<float,2>{0.567922175f, 0.435407043f},
-std::array<float,2>{0.317934632f, 0.827220023f},
-std::array<float,2>{0.808240592f, 0.580853283f},
-std::array<float,2>{0.223235399f, 0.224192992f},
-std::array<float,2>{0.999400616f, 0.0930319875f},
-std::array<float,2>{0.0272336211f, 0.71575588f},
-std::array<float,2>{0.69656384f, 0.996207356f},
-std::array<float,2>{0.463742405f, 0.370025992f},
-std::array<float,2>{0.66126281f, 0.171831176f},
-std::array<float,2>{0.4284738f, 0.517215431f},
-std::array<float,2>{0.878527045f, 0.799963951f},
-std::array<float,2>{0.0628272146f, 0.484099925f},
-std::array<float,2>{0.825889945f, 0.250820786f},
-std::array<float,2>{0.172145694f, 0.884559751f},
-std::array<float,2>{0.502726316f, 0.625876248f},
-std::array<float,2>{0.303728014f, 0.0209840704f},
-std::array<float,2>{0.690700531f, 0.386090666f},
-std::array<float,2>{0.458986461f, 0.866512418f},
-std::array<float,2>{0.991856635f, 0.611706316f},
-std::array<float,2>{0.0184210073f, 0.194847628f},
-std::array<float,2>{0.800265551f, 0.112593226f},
-std::array<float,2>{0.230623618f, 0.728315592f},
-std::array<float,2>{0.574263096f, 0.941167951f},
-std::array<float,2>{0.324521631f, 0.327807993f},
-std::array<float,2>{0.512324691f, 0.151582241f},
-std::array<float,2>{0.308332413f, 0.544405341f},
-std::array<float,2>{0.8197034f, 0.76986438f},
-std::array<float,2>{0.183777019f, 0.454247415f},
-std::array<float,2>{0.885611176f, 0.294481874f},
-std::array<float,2>{0.0778961629f, 0.909464955f},
-std::array<float,2>{0.669323683f, 0.658985853f},
-std::array<float,2>{0.431703627f, 0.0609393343f},
-std::array<float,2>{0.615648866f, 0.367165953f},
-std::array<float,2>{0.347603887f, 0.988676906f},
-std::array<float,2>{0.750089228f, 0.708017647f},
-std::array<float,2>{0.200893447f, 0.0827487111f},
-std::array<float,2>{0.941868305f, 0.227152407f},
-std::array<float,2>{0.038122952f, 0.588365793f},
-std::array<float,2>{0.730395079f, 0.816296279f},
-std::array<float,2>{0.471746117f, 0.422937274f},
-std::array<float,2>{0.643750072f, 0.0275482219f},
-std::array<float,2>{0.393645853f, 0.634815276f},
-std::array<float,2>{0.916364431f, 0.877227962f},
-std::array<float,2>{0.10469605f, 0.25866729f},
-std::array<float,2>{0.871411145f, 0.474778444f},
-std::array<float,2>{0.137050256f, 0.810090125f},
-std::array<float,2>{0.556731641f, 0.526454806f},
-std::array<float,2>{0.261053681f, 0.157935187f},
-std::array<float,2>{0.680483043f, 0.268107474f},
-std::array<float,2>{0.419404745f, 0.903589249f},
-std::array<float,2>{0.904709458f, 0.653896689f},
-std::array<float,2>{0.0876316279f, 0.00540804351f},
-std::array<float,2>{0.84137845f, 0.172124401f},
-std::array<float,2>{0.158725664f, 0.500612974f},
-std::array<float,2>{0.52262491f, 0.786505878f},
-std::array<float,2>{0.289820582f, 0.494218826f},
-std::array<float,2>{0.587743163f, 0.0666453242f},
-std::array<float,2>{0.336528629f, 0.697074771f},
-std::array<float,2>{0.781251848f, 0.980027378f},
-std::array<float,2>{0.237341106f, 0.358354121f},
-std::array<float,2>{0.980854928f, 0.40930739f},
-std::array<float,2>{0.00356764719f, 0.831101358f},
-std::array<float,2>{0.705183983f, 0.569542408f},
-std::array<float,2>{0.449824303f, 0.238601685f},
-std::array<float,2>{0.53138268f, 0.442339212f},
-std::array<float,2>{0.279720306f, 0.753126025f},
-std::array<float,2>{0.858379543f, 0.560831785f},
-std::array<float,2>{0.141260147f, 0.13871704f},
-std::array<float,2>{0.93087399f, 0.0430029258f},
-std::array<float,2>{0.122132629f, 0.684455216f},
-std::array<float,2>{0.630473077f, 0.932942808f},
-std::array<float,2>{0.386422813f, 0.300764561f},
-std::array<float,2>{0.737320304f, 0.218682081f},
-std::array<float,2>{0.499484569f, 0.603787243f},
-std::array<float,2>{0.968032837f, 0.850724936f},
-std::array<float,2>{0.0590443276f, 0.397867858f},
-std::array<float,2>{0.77595973f, 0.335635722f},
-std::array<float,2>{0.214174584f, 0.956218362f},
-std::array<float,2>{0.596286356f, 0.736388266f},
-std::array<float,2>{0.360641807f, 0.106283188f},
-std::array<float,2>{0.667241633f, 0.418233603f},
-std::array<float,2>{0.435325146f, 0.84139657f},
-std::array<float,2>{0.888328075f, 0.571161866f},
-std::array<float,2>{0.0731403679f, 0.246187598f},
-std::array<float,2>{0.81619221f, 0.07525336f},
-std::array<float,2>{0.183326095f, 0.690092325f},
-std::array<float,2>{0.508763969f, 0.969072878f},
-std::array<float,2>{0.308820099f, 0.344528317f},
-std::array<float,2>{0.571269095f, 0.183998108f},
-std::array<float,2>{0.321337283f, 0.512309313f},
-std::array<float,2>{0.801777542f, 0.791116774f},
-std::array<float,2>{0.227668449f, 0.492148459f},
-std::array<float,2>{0.98657912f, 0.273613274f},
-std::array<float,2>{0.0199152622f, 0.896875262f},
-std::array<float,2>{0.694488943f, 0.64679879f},
-std::array<float,2>{0.454795063f, 0.00944329146f},
-std::array<float,2>{0.561020732f, 0.338888019f},
-std::array<float,2>{0.262647986f, 0.964042068f},
-std::array<float,2>{0.868113399f, 0.749617398f},
-std::array<float,2>{0.133385465f, 0.100551635f},
-std::array<float,2>{0.920192003f, 0.208561808f},
-std::array<float,2>{0.10755007f, 0.5985232f},
-std::array<float,2>{0.647644937f, 0.853144169f},
-std::array<float,2>{0.397175014f, 0.399303228f},
-std::array<float,2>{0.732513428f, 0.0363613628f},
-std::array<float,2>{0.474366456f, 0.675023913f},
-std::array<float,2>{0.94099313f, 0.928211331f},
-std::array<float,2>{0.0347555988f, 0.307583302f},
-std::array<float,2>{0.756678879f, 0.450614899f},
-std::array<float,2>{0.195801109f, 0.761009336f},
-std::array<float,2>{0.612041533f, 0.547141433f},
-std::array<float,2>{0.349268168f, 0.131203592f},
-std::array<float,2>{0.710061789f, 0.288113475f},
-std::array<float,2>{0.445745885f, 0.916411102f},
-std::array<float,2>{0.976914406f, 0.664931715f},
-std::array<float,2>{0.00577988056f, 0.0538948365f},
-std::array<float,2>{0.78590852f, 0.142172918f},
-std::array<float,2>{0.240706906f, 0.532134533f},
-std::array<float,2>{0.592421532f, 0.778110027f},
-std::array<float,2>{0.342892975f, 0.466195673f},
-std::array<float,2>{0.517951965f, 0.121344462f},
-std::array<float,2>{0.29351604f, 0.724210858f},
-std::array<float,2>{0.836561263f, 0.945417285f},
-std::array<float,2>{0.162447184f, 0.313417524f},
-std::array<float,2>{0.899477959f, 0.377840608f},
-std::array<float,2>{0.0929002836f, 0.868437946f},
-std::array<float,2>{0.685240567f, 0.618116021f},
-std::array<float,2>{0.416413873f, 0.197443485f},
-std::array<float,2>{0.598178923f, 0.476982623f},
-std::array<float,2>{0.366936237f, 0.801157951f},
-std::array<float,2>{0.780385077f, 0.522477925f},
-std::array<float,2>{0.217807606f, 0.166193292f},
-std::array<float,2>{0.963961899f, 0.0182003751f},
-std::array<float,2>{0.0558955371f, 0.629767954f},
-std::array<float,2>{0.740614295f, 0.888259411f},
-std::array<float,2>{0.493080378f, 0.256445765f},
-std::array<float,2>{0.627002776f, 0.222018465f},
-std::array<float,2>{0.389544517f, 0.582951009f},
-std::array<float,2>{0.936491668f, 0.820694685f},
-std::array<float,2>{0.12099877f, 0.430483699f},
-std::array<float,2>{0.85526967f, 0.371532202f},
-std::array<float,2>{0.148378864f, 0.993125498f},
-std::array<float,2>{0.538704932f, 0.711794913f},
-std::array<float,2>{0.275205821f, 0.0872066543f},
-std::array<float,2>{0.744431794f, 0.458393902f},
-std::array<float,2>{0.489000231f, 0.76609534f},
-std::array<float,2>{0.955918074f, 0.541813791f},
-std::array<float,2>{0.0482942685f, 0.152573526f},
-std::array<float,2>{0.772650123f, 0.0549339615f},
-std::array<float,2>{0.20569697f, 0.6603176f},
-std::array<float,2>{0.602678299f, 0.912539601f},
-std::array<float,2>{0.369614244f, 0.289772809f},
-std::array<float,2>{0.541998029f, 0.188328132f},
-std::array<float,2>{0.271670103f, 0.617063463f},
-std::array<float,2>{0.846409976f, 0.861210406f},
-std::array<float,2>{0.150498778f, 0.38794741f},
-std::array<float,2>{0.922566473f, 0.323465675f},
-std::array<float,2>{0.113587715f, 0.94171989f},
-std::array<float,2>{0.635662138f, 0.732585907f},
-std::array<float,2>{0.377698243f, 0.113846451f},
-std::array<float,2>{0.582662821f, 0.261941105f},
-std::array<float,2>{0.331113786f, 0.880612671f},
-std::array<float,2>{0.795090437f, 0.640215695f},
-std::array<float,2>{0.248440817f, 0.0252408646f},
-std::array<float,2>{0.970861197f, 0.161048114f},
-std::array<float,2>{0.0102413027f, 0.529191732f},
-std::array<float,2>{0.714451075f, 0.807826281f},
-std::array<float,2>{0.440162897f, 0.472117722f},
-std::array<float,2>{0.676360607f, 0.0815136731f},
-std::array<float,2>{0.412856638f, 0.703926444f},
-std::array<float,2>{0.897809029f, 0.984746635f},
-std::array<float,2>{0.078311488f, 0.361031115f},
-std::array<float,2>{0.834618986f, 0.426080078f},
-std::array<float,2>{0.166976437f, 0.819341719f},
-std::array<float,2>{0.530911088f, 0.592220008f},
-std::array<float,2>{0.288322806f, 0.231506333f},
-std::array<float,2>{0.655079901f, 0.352044374f},
-std::array<float,2>{0.403749704f, 0.98217541f},
-std::array<float,2>{0.911597967f, 0.699916065f},
-std::array<float,2>{0.0967676342f, 0.0635411516f},
-std::array<float,2>{0.862114608f, 0.236018032f},
-std::array<float,2>{0.131938815f, 0.565728784f},
-std::array<float,2>{0.550001442f, 0.833529353f},
-std::array<float,2>{0.250892788f, 0.412574679f},
-std::array<float,2>{0.619996905f, 0.0029934179f},
-std::array<float,2>{0.354646593f, 0.650262356f},
-std::array<float,2>{0.757856309f, 0.89989078f},
-std::array<float,2>{0.191074595f, 0.26986599f},
-std::array<float,2>{0.951529562f, 0.499351144f},
-std::array<float,2>{0.0421997793f, 0.784082115f},
-std::array<float,2>{0.723632514f, 0.507080853f},
-std::array<float,2>{0.477884233f, 0.178300411f},
-std::array<float,2>{0.50398612f, 0.393478483f},
-std::array<float,2>{0.300077975f, 0.845991373f},
-std::array<float,2>{0.823907554f, 0.608756721f},
-std::array<float,2>{0.179405749f, 0.213218659f},
-std::array<float,2>{0.881594002f, 0.101991966f},
-std::array<float,2>{0.0677013025f, 0.740835071f},
-std::array<float,2>{0.657517314f, 0.957158446f},
-std::array<float,2>{0.423084527f, 0.329865426f},
-std::array<float,2>{0.699599922f, 0.132850319f},
-std::array<float,2>{0.468235254f, 0.555136919f},
-std::array<float,2>{0.993532777f, 0.757501662f},
-std::array<float,2>{0.0307315849f, 0.437882692f},
-std::array<float,2>{0.809705436f, 0.302149415f},
-std::array<float,2>{0.221564785f, 0.937071919f},
-std::array<float,2>{0.565523386f, 0.683107793f},
-std::array<float,2>{0.312594622f, 0.0409654379f},
-std::array<float,2>{0.673974991f, 0.448866695f},
-std::array<float,2>{0.407343477f, 0.765075445f},
-std::array<float,2>{0.891404331f, 0.551425397f},
-std::array<float,2>{0.0838130116f, 0.128530055f},
-std::array<float,2>{0.830440164f, 0.0340506397f},
-std::array<float,2>{0.170896277f, 0.67834419f},
-std::array<float,2>{0.526762247f, 0.923866391f},
-std::array<float,2>{0.281383961f, 0.311450899f},
-std::array<float,2>{0.580345869f, 0.205401033f},
-std::array<float,2>{0.335608065f, 0.595217049f},
-std::array<float,2>{0.789491355f, 0.855555713f},
-std::array<float,2>{0.244365022f, 0.403684467f},
-std::array<float,2>{0.97432673f, 0.340315193f},
-std::array<float,2>{0.0122888023f, 0.966612399f},
-std::array<float,2>{0.716623902f, 0.743448257f},
-std::array<float,2>{0.443552345f, 0.0962289721f},
-std::array<float,2>{0.545326889f, 0.27787444f},
-std::array<float,2>{0.266682714f, 0.892428696f},
-std::array<float,2>{0.849312007f, 0.642683983f},
-std::array<float,2>{0.152685896f, 0.0119185233f},
-std::array<float,2>{0.927613914f, 0.182452112f},
-std::array<float,2>{0.112318121f, 0.510723531f},
-std::array<float,2>{0.637081504f, 0.794822514f},
-std::array<float,2>{0.380803049f, 0.486570537f},
-std::array<float,2>{0.748819709f, 0.070558697f},
-std::array<float,2>{0.487744868f, 0.692643404f},
-std::array<float,2>{0.960162222f, 0.975020349f},
-std::array<float,2>{0.0521421693f, 0.348821044f},
-std::array<float,2>{0.766676962f, 0.416068763f},
-std::array<float,2>{0.208471939f, 0.836648583f},
-std::array<float,2>{0.607771277f, 0.577872694f},
-std::array<float,2>{0.374929637f, 0.245073467f},
-std::array<float,2>{0.697728038f, 0.368977219f},
-std::array<float,2>{0.461301029f, 0.999008834f},
-std::array<float,2>{0.997714162f, 0.717293322f},
-std::array<float,2>{0.024865292f, 0.0909426808f},
-std::array<float,2>{0.80605799f, 0.225302815f},
-std::array<float,2>{0.226004153f, 0.579305291f},
-std::array<float,2>{0.5684883f, 0.825376153f},
-std::array<float,2>{0.319048703f, 0.436916471f},
-std::array<float,2>{0.501908779f, 0.0228111371f},
-std::array<float,2>{0.30179441f, 0.628513992f},
-std::array<float,2>{0.826886356f, 0.885674298f},
-std::array<float,2>{0.174377888f, 0.252364814f},
-std::array<float,2>{0.876201332f, 0.482260317f},
-std::array<float,2>{0.0658886135f, 0.797810018f},
-std::array<float,2>{0.663800776f, 0.517823219f},
-std::array<float,2>{0.426972389f, 0.169905111f},
-std::array<float,2>{0.621594846f, 0.379512727f},
-std::array<float,2>{0.359319448f, 0.873463333f},
-std::array<float,2>{0.762069285f, 0.623914182f},
-std::array<float,2>{0.193430096f, 0.202671498f},
-std::array<float,2>{0.946494281f, 0.119702876f},
-std::array<float,2>{0.0457095653f, 0.718836665f},
-std::array<float,2>{0.720357358f, 0.95264256f},
-std::array<float,2>{0.483296186f, 0.319999874f},
-std::array<float,2>{0.650245726f, 0.146751672f},
-std::array<float,2>{0.399124056f, 0.538339913f},
-std::array<float,2>{0.907620907f, 0.774616301f},
-std::array<float,2>{0.0985916182f, 0.464690089f},
-std::array<float,2>{0.86526078f, 0.281303972f},
-std::array<float,2>{0.127098486f, 0.921657979f},
-std::array<float,2>{0.554421425f, 0.670732677f},
-std::array<float,2>{0.257597595f, 0.0473377407f},
-std::array<float,2>{0.728432536f, 0.424731046f},
-std::array<float,2>{0.468970925f, 0.813314855f},
-std::array<float,2>{0.94403702f, 0.587046385f},
-std::array<float,2>{0.0353935808f, 0.230429873f},
-std::array<float,2>{0.752952874f, 0.08559037f},
-std::array<float,2>{0.201547235f, 0.709152937f},
-std::array<float,2>{0.614916801f, 0.991806328f},
-std::array<float,2>{0.344231963f, 0.364377052f},
-std::array<float,2>{0.555849612f, 0.159494981f},
-std::array<float,2>{0.258051008f, 0.523814499f},
-std::array<float,2>{0.874919653f, 0.812105656f},
-std::array<float,2>{0.138730735f, 0.472785443f},
-std::array<float,2>{0.914559662f, 0.261485189f},
-std::array<float,2>{0.101962462f, 0.875255764f},
-std::array<float,2>{0.64211607f, 0.633053839f},
-std::array<float,2>{0.392353863f, 0.0301831774f},
-std::array<float,2>{0.576899171f, 0.325178564f},
-std::array<float,2>{0.326798052f, 0.939386427f},
-std::array<float,2>{0.7968961f, 0.730466664f},
-std::array<float,2>{0.233098999f, 0.110767022f},
-std::array<float,2>{0.989691019f, 0.191896841f},
-std::array<float,2>{0.0159423351f, 0.610706449f},
-std::array<float,2>{0.687996507f, 0.863867581f},
-std::array<float,2>{0.458318144f, 0.383401871f},
-std::array<float,2>{0.670619369f, 0.0597432144f},
-std::array<float,2>{0.431008399f, 0.656668723f},
-std::array<float,2>{0.882903755f, 0.906587183f},
-std::array<float,2>{0.0748068616f, 0.295610785f},
-std::array<float,2>{0.817892194f, 0.456787884f},
-std::array<float,2>{0.185900167f, 0.7726717f},
-std::array<float,2>{0.515345573f, 0.54635334f},
-std::array<float,2>{0.304874599f, 0.148612157f},
-std::array<float,2>{0.631347835f, 0.298568219f},
-std::array<float,2>{0.384497553f, 0.931415379f},
-std::array<float,2>{0.933076978f, 0.685917318f},
-std::array<float,2>{0.124975316f, 0.0462800823f},
-std::array<float,2>{0.855794668f, 0.137685999f},
-std::array<float,2>{0.143260598f, 0.560439587f},
-std::array<float,2>{0.533359528f, 0.751460195f},
-std::array<float,2>{0.278478086f, 0.444343179f},
-std::array<float,2>{0.595216751f, 0.108458333f},
-std::array<float,2>{0.362527072f, 0.735127032f},
-std::array<float,2>{0.774214923f, 0.954309225f},
-std::array<float,2>{0.211429507f, 0.33273825f},
-std::array<float,2>{0.966646433f, 0.39615503f},
-std::array<float,2>{0.0618232675f, 0.84824264f},
-std::array<float,2>{0.73541522f, 0.602119088f},
-std::array<float,2>{0.496684939f, 0.215164766f},
-std::array<float,2>{0.519750476f, 0.494093329f},
-std::array<float,2>{0.291871339f, 0.787350178f},
-std::array<float,2>{0.842242122f, 0.503632426f},
-std::array<float,2>{0.15727514f, 0.173851416f},
-std::array<float,2>{0.902498364f, 0.00767909642f},
-std::array<float,2>{0.0890712664f, 0.655364633f},
-std::array<float,2>{0.682999551f, 0.905856848f},
-std::array<float,2>{0.421454221f, 0.265766203f},
-std::array<float,2>{0.704397917f, 0.241038561f},
-std::array<float,2>{0.451807141f, 0.56772548f},
-std::array<float,2>{0.982805312f, 0.828575492f},
-std::array<float,2>{0.00173934177f, 0.406626076f},
-std::array<float,2>{0.78357172f, 0.35584709f},
-std::array<float,2>{0.234955162f, 0.976803958f},
-std::array<float,2>{0.588950574f, 0.698262334f},
-std::array<float,2>{0.338904917f, 0.0701677576f},
-std::array<float,2>{0.646142483f, 0.40071407f},
-std::array<float,2>{0.395058423f, 0.854955077f},
-std::array<float,2>{0.919041455f, 0.601338744f},
-std::array<float,2>{0.107347175f, 0.209560543f},
-std::array<float,2>{0.869737804f, 0.0989992693f},
-std::array<float,2>{0.136400267f, 0.747279227f},
-std::array<float,2>{0.560457468f, 0.961747646f},
-std::array<float,2>{0.265036315f, 0.336377412f},
-std::array<float,2>{0.610205293f, 0.129250661f},
-std::array<float,2>{0.351501703f, 0.549303949f},
-std::array<float,2>{0.755771577f, 0.75800246f},
-std::array<float,2>{0.199133903f, 0.45208469f},
-std::array<float,2>{0.939358711f, 0.306526035f},
-std::array<float,2>{0.0325024351f, 0.926630199f},
-std::array<float,2>{0.73189199f, 0.671972811f},
-std::array<float,2>{0.476303965f, 0.0376448371f},
-std::array<float,2>{0.510297894f, 0.346284091f},
-std::array<float,2>{0.312066019f, 0.97075516f},
-std::array<float,2>{0.814433753f, 0.689098895f},
-std::array<float,2>{0.181233466f, 0.0769547373f},
-std::array<float,2>{0.889002621f, 0.249176413f},
-std::array<float,2>{0.0710341632f, 0.572748363f},
-std::array<float,2>{0.664952278f, 0.841965914f},
-std::array<float,2>{0.436339825f, 0.420166314f},
-std::array<float,2>{0.6932441f, 0.0115452195f},
-std::array<float,2>{0.455764681f, 0.64511317f},
-std::array<float,2>{0.985141098f, 0.896469235f},
-std::array<float,2>{0.0220109485f, 0.276780754f},
-std::array<float,2>{0.803210497f, 0.489731491f},
-std::array<float,2>{0.229516953f, 0.789236367f},
-std::array<float,2>{0.574176371f, 0.515160322f},
-std::array<float,2>{0.324162483f, 0.18640092f},
-std::array<float,2>{0.739059985f, 0.25575313f},
-std::array<float,2>{0.494996965f, 0.889812708f},
-std::array<float,2>{0.96151787f, 0.631544352f},
-std::array<float,2>{0.0570382811f, 0.0163781475f},
-std::array<float,2>{0.778201401f, 0.165796459f},
-std::array<float,2>{0.216310129f, 0.521233201f},
-std::array<float,2>{0.601385713f, 0.803855598f},
-std::array<float,2>{0.364882261f, 0.479101539f},
-std::array<float,2>{0.535935819f, 0.0887822136f},
-std::array<float,2>{0.275640666f, 0.713697076f},
-std::array<float,2>{0.851791739f, 0.994372845f},
-std::array<float,2>{0.145558208f, 0.374044061f},
-std::array<float,2>{0.934477866f, 0.43332234f},
-std::array<float,2>{0.118119918f, 0.822881579f},
-std::array<float,2>{0.625441074f, 0.585487127f},
-std::array<float,2>{0.387102365f, 0.220673233f},
-std::array<float,2>{0.590348125f, 0.467991352f},
-std::array<float,2>{0.341023713f, 0.779477835f},
-std::array<float,2>{0.787314475f, 0.534970403f},
-std::array<float,2>{0.239522949f, 0.143166393f},
-std::array<float,2>{0.980300188f, 0.0512879603f},
-std::array<float,2>{0.0075410218f, 0.667582452f},
-std::array<float,2>{0.708798468f, 0.915386796f},
-std::array<float,2>{0.448566437f, 0.286972284f},
-std::array<float,2>{0.685870111f, 0.195446625f},
-std::array<float,2>{0.41556561f, 0.619468272f},
-std::array<float,2>{0.900395513f, 0.869841278f},
-std::array<float,2>{0.0902614519f, 0.37548098f},
-std::array<float,2>{0.838469326f, 0.31605348f},
-std::array<float,2>{0.161211058f, 0.947698951f},
-std::array<float,2>{0.51709938f, 0.725056171f},
-std::array<float,2>{0.295164078f, 0.12480098f},
-std::array<float,2>{0.712611198f, 0.469218016f},
-std::array<float,2>{0.439129233f, 0.804909289f},
-std::array<float,2>{0.968807518f, 0.529767036f},
-std::array<float,2>{0.00925119314f, 0.16344437f},
-std::array<float,2>{0.793207586f, 0.0264108703f},
-std::array<float,2>{0.246997982f, 0.638449311f},
-std::array<float,2>{0.584802508f, 0.88148284f},
-std::array<float,2>{0.328960687f, 0.265416712f},
-std::array<float,2>{0.528718174f, 0.234073386f},
-std::array<float,2>{0.286555529f, 0.591632843f},
-std::array<float,2>{0.832497299f, 0.816791534f},
-std::array<float,2>{0.165366977f, 0.429476261f},
-std::array<float,2>{0.896375299f, 0.36266157f},
-std::array<float,2>{0.0803260729f, 0.986537933f},
-std::array<float,2>{0.67783469f, 0.705194414f},
-std::array<float,2>{0.411048561f, 0.078863807f},
-std::array<float,2>{0.604930937f, 0.292186528f},
-std::array<float,2>{0.367625356f, 0.911202252f},
-std::array<float,2>{0.770379603f, 0.66289252f},
-std::array<float,2>{0.204325333f, 0.0575560108f},
-std::array<float,2>{0.953856707f, 0.155580178f},
-std::array<float,2>{0.0488397032f, 0.540698767f},
-std::array<float,2>{0.742449462f, 0.767831862f},
-std::array<float,2>{0.492090911f, 0.460110068f},
-std::array<float,2>{0.633657813f, 0.116591111f},
-std::array<float,2>{0.375805557f, 0.731286585f},
-std::array<float,2>{0.924250126f, 0.94481647f},
-std::array<float,2>{0.115259551f, 0.321136773f},
-std::array<float,2>{0.845428944f, 0.389849901f},
-std::array<float,2>{0.149197191f, 0.862831414f},
-std::array<float,2>{0.539382577f, 0.61428684f},
-std::array<float,2>{0.270894557f, 0.19116345f},
-std::array<float,2>{0.660087466f, 0.331501454f},
-std::array<float,2>{0.424332559f, 0.959925056f},
-std::array<float,2>{0.879398406f, 0.739383221f},
-std::array<float,2>{0.0694342777f, 0.104995616f},
-std::array<float,2>{0.822131157f, 0.211927727f},
-std::array<float,2>{0.17738387f, 0.606578827f},
-std::array<float,2>{0.507178724f, 0.843795776f},
-std::array<float,2>{0.297061354f, 0.391813368f},
-std::array<float,2>{0.5635041f, 0.041656781f},
-std::array<float,2>{0.315389484f, 0.680172741f},
-std::array<float,2>{0.811074436f, 0.933742464f},
-std::array<float,2>{0.219259605f, 0.304238707f},
-std::array<float,2>{0.995889544f, 0.44093138f},
-std::array<float,2>{0.0274823308f, 0.75409472f},
-std::array<float,2>{0.701506972f, 0.556802392f},
-std::array<float,2>{0.466687888f, 0.136563569f},
-std::array<float,2>{0.547551215f, 0.412007511f},
-std::array<float,2>{0.252347976f, 0.834634423f},
-std::array<float,2>{0.860288739f, 0.564333618f},
-std::array<float,2>{0.129692927f, 0.236743033f},
-std::array<float,2>{0.912292302f, 0.0647779331f},
-std::array<float,2>{0.0938170552f, 0.701850235f},
-std::array<float,2>{0.652915537f, 0.984371364f},
-std::array<float,2>{0.405274749f, 0.353559554f},
-std::array<float,2>{0.724627197f, 0.177301928f},
-std::array<float,2>{0.478583843f, 0.504604161f},
-std::array<float,2>{0.951166928f, 0.781685114f},
-std::array<float,2>{0.0403779373f, 0.497222602f},
-std::array<float,2>{0.761052608f, 0.273382396f},
-std::array<float,2>{0.187565774f, 0.900522709f},
-std::array<float,2>{0.619071305f, 0.651400924f},
-std::array<float,2>{0.352651596f, 0.000100888181f},
-std::array<float,2>{0.630002439f, 0.445161283f},
-std::array<float,2>{0.386122823f, 0.751484454f},
-std::array<float,2>{0.931580186f, 0.55986172f},
-std::array<float,2>{0.122995876f, 0.137185559f},
-std::array<float,2>{0.857548833f, 0.0467143729f},
-std::array<float,2>{0.140740961f, 0.686160386f},
-std::array<float,2>{0.532059371f, 0.931067288f},
-std::array<float,2>{0.280059069f, 0.298177302f},
-std::array<float,2>{0.596003592f, 0.215753525f},
-std::array<float,2>{0.36132288f, 0.601750135f},
-std::array<float,2>{0.775391817f, 0.848004043f},
-std::array<float,2>{0.214630529f, 0.395825148f},
-std::array<float,2>{0.968434036f, 0.33249256f},
-std::array<float,2>{0.0592380427f, 0.954787433f},
-std::array<float,2>{0.737916112f, 0.734800756f},
-std::array<float,2>{0.499627531f, 0.108932547f},
-std::array<float,2>{0.522962689f, 0.266222149f},
-std::array<float,2>{0.289350301f, 0.905607462f},
-std::array<float,2>{0.841207325f, 0.655919373f},
-std::array<float,2>{0.158649758f, 0.00702993246f},
-std::array<float,2>{0.904794276f, 0.174332708f},
-std::array<float,2>{0.0869348049f, 0.503325224f},
-std::array<float,2>{0.68002677f, 0.787807226f},
-std::array<float,2>{0.419896275f, 0.493204176f},
-std::array<float,2>{0.705697834f, 0.0693976656f},
-std::array<float,2>{0.449294031f, 0.69892019f},
-std::array<float,2>{0.981004f, 0.977524281f},
-std::array<float,2>{0.00316245994f, 0.356229365f},
-std::array<float,2>{0.781963885f, 0.406930387f},
-std::array<float,2>{0.237913013f, 0.828724205f},
-std::array<float,2>{0.586944103f, 0.568353415f},
-std::array<float,2>{0.33629331f, 0.240423143f},
-std::array<float,2>{0.72985667f, 0.365011841f},
-std::array<float,2>{0.472587734f, 0.99147594f},
-std::array<float,2>{0.942095399f, 0.709522784f},
-std::array<float,2>{0.0390286893f, 0.0850000009f},
-std::array<float,2>{0.750936985f, 0.229575992f},
-std::array<float,2>{0.200486362f, 0.587451518f},
-std::array<float,2>{0.615837276f, 0.812835813f},
-std::array<float,2>{0.347081721f, 0.424132973f},
-std::array<float,2>{0.557419538f, 0.0294525046f},
-std::array<float,2>{0.261322558f, 0.633755386f},
-std::array<float,2>{0.871900439f, 0.875924349f},
-std::array<float,2>{0.137655422f, 0.260981798f},
-std::array<float,2>{0.916589081f, 0.473620027f},
-std::array<float,2>{0.105377123f, 0.811558545f},
-std::array<float,2>{0.644079447f, 0.524235547f},
-std::array<float,2>{0.394359708f, 0.159796998f},
-std::array<float,2>{0.574941099f, 0.383253127f},
-std::array<float,2>{0.325060308f, 0.863589883f},
-std::array<float,2>{0.800542831f, 0.611062288f},
-std::array<float,2>{0.231243134f, 0.191606566f},
-std::array<float,2>{0.991272986f, 0.110882118f},
-std::array<float,2>{0.0177400969f, 0.7297225f},
-std::array<float,2>{0.691317916f, 0.938737094f},
-std::array<float,2>{0.459745467f, 0.324269921f},
-std::array<float,2>{0.669447958f, 0.149017423f},
-std::array<float,2>{0.432363272f, 0.546802402f},
-std::array<float,2>{0.88524121f, 0.773173273f},
-std::array<float,2>{0.0774380118f, 0.456350446f},
-std::array<float,2>{0.820146799f, 0.295118541f},
-std::array<float,2>{0.184381425f, 0.907032669f},
-std::array<float,2>{0.511880994f, 0.656959236f},
-std::array<float,2>{0.307694882f, 0.0604778752f},
-std::array<float,2>{0.69713676f, 0.437097818f},
-std::array<float,2>{0.463163376f, 0.826098621f},
-std::array<float,2>{0.999652743f, 0.580048144f},
-std::array<float,2>{0.0265170708f, 0.224782109f},
-std::array<float,2>{0.807944238f, 0.0915930048f},
-std::array<float,2>{0.222733304f, 0.716826081f},
-std::array<float,2>{0.567728162f, 0.998286605f},
-std::array<float,2>{0.317821711f, 0.368204057f},
-std::array<float,2>{0.50234586f, 0.169100091f},
-std::array<float,2>{0.304670393f, 0.518318534f},
-std::array<float,2>{0.825391471f, 0.796880245f},
-std::array<float,2>{0.172369495f, 0.481783807f},
-std::array<float,2>{0.878005624f, 0.252816498f},
-std::array<float,2>{0.0633500591f, 0.884856105f},
-std::array<float,2>{0.661967218f, 0.628402472f},
-std::array<float,2>{0.427957356f, 0.0233340673f},
-std::array<float,2>{0.624720395f, 0.3193672f},
-std::array<float,2>{0.355607778f, 0.952314615f},
-std::array<float,2>{0.764460742f, 0.719394028f},
-std::array<float,2>{0.192789152f, 0.119358853f},
-std::array<float,2>{0.948598444f, 0.202148944f},
-std::array<float,2>{0.0438492149f, 0.623342395f},
-std::array<float,2>{0.722428262f, 0.873643935f},
-std::array<float,2>{0.482174963f, 0.379009575f},
-std::array<float,2>{0.650709689f, 0.0478309952f},
-std::array<float,2>{0.400826991f, 0.670229137f},
-std::array<float,2>{0.909640193f, 0.920980155f},
-std::array<float,2>{0.100963853f, 0.282107919f},
-std::array<float,2>{0.863410711f, 0.463929623f},
-std::array<float,2>{0.126424074f, 0.775165737f},
-std::array<float,2>{0.550892413f, 0.538607955f},
-std::array<float,2>{0.255082875f, 0.147441238f},
-std::array<float,2>{0.672184348f, 0.310782343f},
-std::array<float,2>{0.408520609f, 0.924545527f},
-std::array<float,2>{0.893953681f, 0.677997172f},
-std::array<float,2>{0.0847684592f, 0.033643797f},
-std::array<float,2>{0.828843176f, 0.128285766f},
-std::array<float,2>{0.16928938f, 0.55110389f},
-std::array<float,2>{0.523456156f, 0.765553713f},
-std::array<float,2>{0.284247726f, 0.448420614f},
-std::array<float,2>{0.578550756f, 0.0961741731f},
-std::array<float,2>{0.332140237f, 0.744114161f},
-std::array<float,2>{0.792717636f, 0.966157496f},
-std::array<float,2>{0.243412897f, 0.340333909f},
-std::array<float,2>{0.975986779f, 0.404126823f},
-std::array<float,2>{0.014165082f, 0.855999351f},
-std::array<float,2>{0.718287051f, 0.594921708f},
-std::array<float,2>{0.442617536f, 0.205786869f},
-std::array<float,2>{0.544097006f, 0.487293214f},
-std::array<float,2>{0.268309027f, 0.794131339f},
-std::array<float,2>{0.85060674f, 0.510175049f},
-std::array<float,2>{0.155278787f, 0.182102889f},
-std::array<float,2>{0.929481328f, 0.0125102205f},
-std::array<float,2>{0.109781988f, 0.643529952f},
-std::array<float,2>{0.640556693f, 0.892065704f},
-std::array<float,2>{0.381792665f, 0.27766186f},
-std::array<float,2>{0.746587157f, 0.244200796f},
-std::array<float,2>{0.485906541f, 0.577628791f},
-std::array<float,2>{0.958529413f, 0.835958838f},
-std::array<float,2>{0.0527995341f, 0.416858971f},
-std::array<float,2>{0.768998742f, 0.3492634f},
-std::array<float,2>{0.210218862f, 0.975462615f},
-std::array<float,2>{0.605972409f, 0.69313556f},
-std::array<float,2>{0.372843623f, 0.0708503947f},
-std::array<float,2>{0.657849789f, 0.392306864f},
-std::array<float,2>{0.423678428f, 0.844381213f},
-std::array<float,2>{0.881226838f, 0.60706991f},
-std::array<float,2>{0.0683479458f, 0.212877214f},
-std::array<float,2>{0.823697686f, 0.104904838f},
-std::array<float,2>{0.178833485f, 0.740178168f},
-std::array<float,2>{0.504577994f, 0.959409177f},
-std::array<float,2>{0.30060187f, 0.33161366f},
-std::array<float,2>{0.565938175f, 0.135965407f},
-std::array<float,2>{0.313355953f, 0.557609856f},
-std::array<float,2>{0.810222924f, 0.754411697f},
-std::array<float,2>{0.220906481f, 0.440832585f},
-std::array<float,2>{0.993689537f, 0.304038256f},
-std::array<float,2>{0.0308089517f, 0.934268892f},
-std::array<float,2>{0.699914992f, 0.680393994f},
-std::array<float,2>{0.468511224f, 0.0413697213f},
-std::array<float,2>{0.550581455f, 0.354174078f},
-std::array<float,2>{0.250437409f, 0.98372215f},
-std::array<float,2>{0.861364305f, 0.701584756f},
-std::array<float,2>{0.132534444f, 0.0651564896f},
-std::array<float,2>{0.912002802f, 0.237211153f},
-std::array<float,2>{0.0973914638f, 0.5638358f},
-std::array<float,2>{0.654615104f, 0.834081531f},
-std::array<float,2>{0.403825134f, 0.411141843f},
-std::array<float,2>{0.723076642f, 0.000936902245f},
-std::array<float,2>{0.478442699f, 0.652016819f},
-std::array<float,2>{0.951970816f, 0.901340663f},
-std::array<float,2>{0.0426170044f, 0.272608072f},
-std::array<float,2>{0.758725703f, 0.497674584f},
-std::array<float,2>{0.190790534f, 0.781805396f},
-std::array<float,2>{0.61940515f, 0.504265547f},
-std::array<float,2>{0.355306536f, 0.177091926f},
-std::array<float,2>{0.713915586f, 0.264732778f},
-std::array<float,2>{0.439694792f, 0.881136179f},
-std::array<float,2>{0.97137481f, 0.637799323f},
-std::array<float,2>{0.0103789344f, 0.026871644f},
-std::array<float,2>{0.795452118f, 0.163741201f},
-std::array<float,2>{0.24871172f, 0.530189157f},
-std::array<float,2>{0.58236438f, 0.805193484f},
-std::array<float,2>{0.331627816f, 0.469669372f},
-std::array<float,2>{0.530637026f, 0.0785608739f},
-std::array<float,2>{0.288693935f, 0.705836654f},
-std::array<float,2>{0.834215522f, 0.987241149f},
-std::array<float,2>{0.166115761f, 0.3630656f},
-std::array<float,2>{0.898051322f, 0.428858072f},
-std::array<float,2>{0.0788160861f, 0.816969216f},
-std::array<float,2>{0.675856054f, 0.590901792f},
-std::array<float,2>{0.412341028f, 0.233822674f},
-std::array<float,2>{0.603416622f, 0.460532367f},
-std::array<float,2>{0.369945168f, 0.768520415f},
-std::array<float,2>{0.773300052f, 0.540423393f},
-std::array<float,2>{0.205215842f, 0.156084061f},
-std::array<float,2>{0.955510616f, 0.0568631031f},
-std::array<float,2>{0.0486069284f, 0.6622352f},
-std::array<float,2>{0.745109737f, 0.911902785f},
-std::array<float,2>{0.488481015f, 0.292692214f},
-std::array<float,2>{0.63516295f, 0.190593839f},
-std::array<float,2>{0.377175391f, 0.615154684f},
-std::array<float,2>{0.922013164f, 0.862536132f},
-std::array<float,2>{0.114093959f, 0.390313804f},
-std::array<float,2>{0.846111f, 0.320603758f},
-std::array<float,2>{0.151332825f, 0.944967449f},
-std::array<float,2>{0.542743266f, 0.73072654f},
-std::array<float,2>{0.272158444f, 0.116930462f},
-std::array<float,2>{0.740726411f, 0.47892642f},
-std::array<float,2>{0.49252522f, 0.804286182f},
-std::array<float,2>{0.964703798f, 0.520605862f},
-std::array<float,2>{0.056635268f, 0.165520281f},
-std::array<float,2>{0.781201959f, 0.0159498714f},
-std::array<float,2>{0.218576476f, 0.631024241f},
-std::array<float,2>{0.5977934f, 0.890461385f},
-std::array<float,2>{0.366422206f, 0.25506565f},
-std::array<float,2>{0.5382725f, 0.22005032f},
-std::array<float,2>{0.274428904f, 0.585193992f},
-std::array<float,2>{0.854563773f, 0.822317898f},
-std::array<float,2>{0.147635713f, 0.432876885f},
-std::array<float,2>{0.935568631f, 0.374539942f},
-std::array<float,2>{0.120525338f, 0.994798541f},
-std::array<float,2>{0.62751931f, 0.713258445f},
-std::array<float,2>{0.388742656f, 0.0882022381f},
-std::array<float,2>{0.591816247f, 0.286527127f},
-std::array<float,2>{0.34354955f, 0.915530801f},
-std::array<float,2>{0.785290182f, 0.66741991f},
-std::array<float,2>{0.240880758f, 0.050839439f},
-std::array<float,2>{0.977210999f, 0.142879501f},
-std::array<float,2>{0.00505922223f, 0.534396291f},
-std::array<float,2>{0.710893154f, 0.779816031f},
-std::array<float,2>{0.446158051f, 0.468509376f},
-std::array<float,2>{0.684791803f, 0.124090903f},
-std::array<float,2>{0.416620344f, 0.725520909f},
-std::array<float,2>{0.90017879f, 0.947829187f},
-std::array<float,2>{0.09332598f, 0.315906167f},
-std::array<float,2>{0.835975111f, 0.37574771f},
-std::array<float,2>{0.162990138f, 0.869322062f},
-std::array<float,2>{0.518158436f, 0.619841218f},
-std::array<float,2>{0.293194801f, 0.196137339f},
-std::array<float,2>{0.648044109f, 0.336698741f},
-std::array<float,2>{0.396963507f, 0.96132797f},
-std::array<float,2>{0.920669913f, 0.74785912f},
-std::array<float,2>{0.108167037f, 0.0991698503f},
-std::array<float,2>{0.867441654f, 0.209035292f},
-std::array<float,2>{0.13299495f, 0.600909054f},
-std::array<float,2>{0.561340809f, 0.855040133f},
-std::array<float,2>{0.262065142f, 0.40120548f},
-std::array<float,2>{0.611531556f, 0.0372591019f},
-std::array<float,2>{0.348858297f, 0.67248112f},
-std::array<float,2>{0.756116569f, 0.925952375f},
-std::array<float,2>{0.195613354f, 0.306005716f},
-std::array<float,2>{0.940870702f, 0.451351881f},
-std::array<float,2>{0.0343437344f, 0.758788526f},
-std::array<float,2>{0.732923567f, 0.549562812f},
-std::array<float,2>{0.473792404f, 0.129664749f},
-std::array<float,2>{0.507997036f, 0.420753717f},
-std::array<float,2>{0.309310734f, 0.842660308f},
-std::array<float,2>{0.815840721f, 0.572998345f},
-std::array<float,2>{0.183012336f, 0.249804139f},
-std::array<float,2>{0.888044298f, 0.0762071088f},
-std::array<float,2>{0.0723107904f, 0.688590407f},
-std::array<float,2>{0.667589486f, 0.971601665f},
-std::array<float,2>{0.434871197f, 0.34590888f},
-std::array<float,2>{0.694902003f, 0.1856509f},
-std::array<float,2>{0.454442769f, 0.515100479f},
-std::array<float,2>{0.987290025f, 0.789714158f},
-std::array<float,2>{0.0202366039f, 0.489768177f},
-std::array<float,2>{0.802652359f, 0.276878119f},
-std::array<float,2>{0.228333697f, 0.895750105f},
-std::array<float,2>{0.570554614f, 0.644760966f},
-std::array<float,2>{0.322058916f, 0.01093233f},
-std::array<float,2>{0.683162212f, 0.494794875f},
-std::array<float,2>{0.421023577f, 0.786966264f},
-std::array<float,2>{0.902853191f, 0.500472546f},
-std::array<float,2>{0.089725852f, 0.172374874f},
-std::array<float,2>{0.842717111f, 0.00503761321f},
-std::array<float,2>{0.158195928f, 0.653482735f},
-std::array<float,2>{0.520111799f, 0.903814793f},
-std::array<float,2>{0.291068673f, 0.267722815f},
-std::array<float,2>{0.589359522f, 0.239064097f},
-std::array<float,2>{0.339387894f, 0.570201099f},
-std::array<float,2>{0.783952534f, 0.831915081f},
-std::array<float,2>{0.234405473f, 0.409845501f},
-std::array<float,2>{0.983337939f, 0.35745424f},
-std::array<float,2>{0.00129206933f, 0.979695618f},
-std::array<float,2>{0.704847097f, 0.696620643f},
-std::array<float,2>{0.451258272f, 0.0670338497f},
-std::array<float,2>{0.533964932f, 0.30000332f},
-std::array<float,2>{0.279226482f, 0.933535337f},
-std::array<float,2>{0.856397927f, 0.68404299f},
-std::array<float,2>{0.142929003f, 0.0436456464f},
-std::array<float,2>{0.93312037f, 0.139401674f},
-std::array<float,2>{0.124264807f, 0.561432719f},
-std::array<float,2>{0.630990088f, 0.753463387f},
-std::array<float,2>{0.384171337f, 0.441525519f},
-std::array<float,2>{0.736255884f, 0.105802141f},
-std::array<float,2>{0.496421427f, 0.737120986f},
-std::array<float,2>{0.966240466f, 0.956915379f},
-std::array<float,2>{0.0620162077f, 0.335301846f},
-std::array<float,2>{0.773904681f, 0.398235023f},
-std::array<float,2>{0.211221665f, 0.851219654f},
-std::array<float,2>{0.594830155f, 0.604056418f},
-std::array<float,2>{0.362945557f, 0.217862651f},
-std::array<float,2>{0.687671781f, 0.327454954f},
-std::array<float,2>{0.458897442f, 0.94048202f},
-std::array<float,2>{0.989916027f, 0.727928638f},
-std::array<float,2>{0.0165018253f, 0.112821586f},
-std::array<float,2>{0.797364891f, 0.194451466f},
-std::array<float,2>{0.23281303f, 0.612018347f},
-std::array<float,2>{0.576630533f, 0.867058396f},
-std::array<float,2>{0.326516986f, 0.386612326f},
-std::array<float,2>{0.514781415f, 0.0614906326f},
-std::array<float,2>{0.305474281f, 0.65861243f},
-std::array<float,2>{0.817394137f, 0.909982502f},
-std::array<float,2>{0.186462894f, 0.294304311f},
-std::array<float,2>{0.883371711f, 0.454820216f},
-std::array<float,2>{0.0745429918f, 0.77039659f},
-std::array<float,2>{0.670046628f, 0.544761658f},
-std::array<float,2>{0.43119666f, 0.1519593f},
-std::array<float,2>{0.614400566f, 0.423350662f},
-std::array<float,2>{0.344462901f, 0.815913677f},
-std::array<float,2>{0.753429472f, 0.588830769f},
-std::array<float,2>{0.201682746f, 0.226819128f},
-std::array<float,2>{0.94382149f, 0.0823024735f},
-std::array<float,2>{0.0361082032f, 0.708929479f},
-std::array<float,2>{0.727552176f, 0.988949895f},
-std::array<float,2>{0.469465226f, 0.36645177f},
-std::array<float,2>{0.641962409f, 0.157679424f},
-std::array<float,2>{0.3918733f, 0.527065873f},
-std::array<float,2>{0.914400816f, 0.810021579f},
-std::array<float,2>{0.102076024f, 0.475368142f},
-std::array<float,2>{0.874353588f, 0.258022904f},
-std::array<float,2>{0.139554292f, 0.877721667f},
-std::array<float,2>{0.556367457f, 0.635264874f},
-std::array<float,2>{0.258444726f, 0.0279081259f},
-std::array<float,2>{0.720119715f, 0.382615566f},
-std::array<float,2>{0.482767522f, 0.871568203f},
-std::array<float,2>{0.946879983f, 0.621969581f},
-std::array<float,2>{0.0449220911f, 0.199726731f},
-std::array<float,2>{0.762621939f, 0.11772754f},
-std::array<float,2>{0.193920612f, 0.722308159f},
-std::array<float,2>{0.621213138f, 0.950833678f},
-std::array<float,2>{0.358726442f, 0.317241222f},
-std::array<float,2>{0.554100096f, 0.146002278f},
-std::array<float,2>{0.256951779f, 0.536057889f},
-std::array<float,2>{0.866070032f, 0.776253164f},
-std::array<float,2>{0.127658218f, 0.462168545f},
-std::array<float,2>{0.907727957f, 0.283288747f},
-std::array<float,2>{0.0980445519f, 0.918423414f},
-std::array<float,2>{0.649470985f, 0.66951108f},
-std::array<float,2>{0.398744017f, 0.0494975261f},
-std::array<float,2>{0.569151103f, 0.369375557f},
-std::array<float,2>{0.318402022f, 0.996984601f},
-std::array<float,2>{0.806286752f, 0.715225875f},
-std::array<float,2>{0.226109877f, 0.0932963789f},
-std::array<float,2>{0.997458279f, 0.224066362f},
-std::array<float,2>{0.0250377413f, 0.580097675f},
-std::array<float,2>{0.69800812f, 0.827706516f},
-std::array<float,2>{0.461860836f, 0.435028851f},
-std::array<float,2>{0.663220942f, 0.0212754998f},
-std::array<float,2>{0.427554876f, 0.625047088f},
-std::array<float,2>{0.876489162f, 0.883812129f},
-std::array<float,2>{0.0660746619f, 0.250211179f},
-std::array<float,2>{0.826384008f, 0.483455658f},
-std::array<float,2>{0.174312592f, 0.800342798f},
-std::array<float,2>{0.501132727f, 0.516690433f},
-std::array<float,2>{0.302720845f, 0.170926645f},
-std::array<float,2>{0.637451112f, 0.279884398f},
-std::array<float,2>{0.379962385f, 0.893697023f},
-std::array<float,2>{0.927122593f, 0.642346263f},
-std::array<float,2>{0.113157094f, 0.0149340406f},
-std::array<float,2>{0.848949969f, 0.179726228f},
-std::array<float,2>{0.153309077f, 0.508220315f},
-std::array<float,2>{0.545692623f, 0.795741498f},
-std::array<float,2>{0.267533123f, 0.485822648f},
-std::array<float,2>{0.60810405f, 0.0730737001f},
-std::array<float,2>{0.374308854f, 0.695271909f},
-std::array<float,2>{0.767244041f, 0.97332269f},
-std::array<float,2>{0.208572879f, 0.351269782f},
-std::array<float,2>{0.960904121f, 0.415154397f},
-std::array<float,2>{0.0527147017f, 0.837906361f},
-std::array<float,2>{0.748176873f, 0.57450217f},
-std::array<float,2>{0.487952918f, 0.243091464f},
-std::array<float,2>{0.527103543f, 0.446541905f},
-std::array<float,2>{0.281865895f, 0.763302207f},
-std::array<float,2>{0.830628812f, 0.553543448f},
-std::array<float,2>{0.170207471f, 0.125694007f},
-std::array<float,2>{0.890816689f, 0.0325701684f},
-std::array<float,2>{0.0834515914f, 0.677092612f},
-std::array<float,2>{0.674784541f, 0.922813177f},
-std::array<float,2>{0.408032447f, 0.309587985f},
-std::array<float,2>{0.716147602f, 0.203488484f},
-std::array<float,2>{0.443866611f, 0.597120106f},
-std::array<float,2>{0.973793924f, 0.858958125f},
-std::array<float,2>{0.0117495591f, 0.405297995f},
-std::array<float,2>{0.790029526f, 0.342800349f},
-std::array<float,2>{0.244645f, 0.967780113f},
-std::array<float,2>{0.580837786f, 0.744556904f},
-std::array<float,2>{0.335172713f, 0.0954659134f},
-std::array<float,2>{0.652492881f, 0.412783295f},
-std::array<float,2>{0.406113595f, 0.833189368f},
-std::array<float,2>{0.912816346f, 0.566214979f},
-std::array<float,2>{0.094656758f, 0.235659212f},
-std::array<float,2>{0.859395087f, 0.0639661551f},
-std::array<float,2>{0.12896812f, 0.699531496f},
-std::array<float,2>{0.546925545f, 0.981445432f},
-std::array<float,2>{0.252504259f, 0.352302879f},
-std::array<float,2>{0.618334174f, 0.177765965f},
-std::array<float,2>{0.353233576f, 0.507631302f},
-std::array<float,2>{0.761488855f, 0.783637166f},
-std::array<float,2>{0.188463718f, 0.499640286f},
-std::array<float,2>{0.950238705f, 0.270462602f},
-std::array<float,2>{0.0407552347f, 0.900069952f},
-std::array<float,2>{0.725519419f, 0.649666488f},
-std::array<float,2>{0.479488552f, 0.00369249936f},
-std::array<float,2>{0.507747412f, 0.329427719f},
-std::array<float,2>{0.297401607f, 0.957562327f},
-std::array<float,2>{0.821620464f, 0.740670681f},
-std::array<float,2>{0.177101985f, 0.102200322f},
-std::array<float,2>{0.879334867f, 0.213583589f},
-std::array<float,2>{0.0700733662f, 0.608894229f},
-std::array<float,2>{0.659363806f, 0.846331894f},
-std::array<float,2>{0.424215853f, 0.393014938f},
-std::array<float,2>{0.702147961f, 0.0403651893f},
-std::array<float,2>{0.466243386f, 0.682710528f},
-std::array<float,2>{0.995345235f, 0.9365713f},
-std::array<float,2>{0.0282574706f, 0.30251202f},
-std::array<float,2>{0.81091249f, 0.43822521f},
-std::array<float,2>{0.21908699f, 0.757061839f},
-std::array<float,2>{0.56438452f, 0.555190563f},
-std::array<float,2>{0.314858973f, 0.133543372f},
-std::array<float,2>{0.7430529f, 0.289213091f},
-std::array<float,2>{0.491235137f, 0.912989199f},
-std::array<float,2>{0.953362107f, 0.660983384f},
-std::array<float,2>{0.0495534614f, 0.0552592613f},
-std::array<float,2>{0.769698679f, 0.153257117f},
-std::array<float,2>{0.204834685f, 0.541232288f},
-std::array<float,2>{0.605377316f, 0.766149521f},
-std::array<float,2>{0.368156731f, 0.458636254f},
-std::array<float,2>{0.539811492f, 0.113764606f},
-std::array<float,2>{0.271190256f, 0.733170867f},
-std::array<float,2>{0.845204175f, 0.942138731f},
-std::array<float,2>{0.148626f, 0.324022651f},
-std::array<float,2>{0.924336493f, 0.388262868f},
-std::array<float,2>{0.116172567f, 0.860543191f},
-std::array<float,2>{0.63283205f, 0.616464794f},
-std::array<float,2>{0.375024766f, 0.187545463f},
-std::array<float,2>{0.584154069f, 0.47230348f},
-std::array<float,2>{0.328212142f, 0.808412492f},
-std::array<float,2>{0.793589652f, 0.528382719f},
-std::array<float,2>{0.24611862f, 0.160411566f},
-std::array<float,2>{0.969588757f, 0.0244788006f},
-std::array<float,2>{0.00938198436f, 0.639907122f},
-std::array<float,2>{0.712068498f, 0.880133688f},
-std::array<float,2>{0.438944399f, 0.262315631f},
-std::array<float,2>{0.678472102f, 0.231965497f},
-std::array<float,2>{0.410569608f, 0.592522442f},
-std::array<float,2>{0.895907581f, 0.820031285f},
-std::array<float,2>{0.0808278173f, 0.426675051f},
-std::array<float,2>{0.832691073f, 0.360804498f},
-std::array<float,2>{0.165989369f, 0.985082865f},
-std::array<float,2>{0.528918266f, 0.703518867f},
-std::array<float,2>{0.286808401f, 0.0818317682f},
-std::array<float,2>{0.708069921f, 0.466717392f},
-std::array<float,2>{0.448808432f, 0.777596235f},
-std::array<float,2>{0.9796772f, 0.531585932f},
-std::array<float,2>{0.00694405474f, 0.141976759f},
-std::array<float,2>{0.787812769f, 0.0546504855f},
-std::array<float,2>{0.240154237f, 0.664539278f},
-std::array<float,2>{0.590241671f, 0.916910291f},
-std::array<float,2>{0.341596484f, 0.288636923f},
-std::array<float,2>{0.516701221f, 0.197798029f},
-std::array<float,2>{0.29548496f, 0.617322266f},
-std::array<float,2>{0.838221252f, 0.868915439f},
-std::array<float,2>{0.161788002f, 0.37722519f},
-std::array<float,2>{0.901226401f, 0.312715679f},
-std::array<float,2>{0.0905800313f, 0.946288466f},
-std::array<float,2>{0.686365545f, 0.723956585f},
-std::array<float,2>{0.415354818f, 0.121670648f},
-std::array<float,2>{0.60093677f, 0.256252795f},
-std::array<float,2>{0.364365488f, 0.887741387f},
-std::array<float,2>{0.777344465f, 0.629203916f},
-std::array<float,2>{0.215900719f, 0.0176115632f},
-std::array<float,2>{0.960967004f, 0.166968644f},
-std::array<float,2>{0.0571608171f, 0.522966862f},
-std::array<float,2>{0.738357484f, 0.801291823f},
-std::array<float,2>{0.494496226f, 0.477068096f},
-std::array<float,2>{0.625609398f, 0.0876789913f},
-std::array<float,2>{0.387390286f, 0.711143732f},
-std::array<float,2>{0.933941066f, 0.992506385f},
-std::array<float,2>{0.117243439f, 0.371830463f},
-std::array<float,2>{0.852326453f, 0.429827183f},
-std::array<float,2>{0.146281689f, 0.821201146f},
-std::array<float,2>{0.53539902f, 0.582321465f},
-std::array<float,2>{0.276165158f, 0.222547933f},
-std::array<float,2>{0.664307117f, 0.343847066f},
-std::array<float,2>{0.435759485f, 0.969394445f},
-std::array<float,2>{0.889631689f, 0.689844906f},
-std::array<float,2>{0.0704969391f, 0.0759921372f},
-std::array<float,2>{0.813735485f, 0.246969149f},
-std::array<float,2>{0.180768922f, 0.570315182f},
-std::array<float,2>{0.509852767f, 0.841252565f},
-std::array<float,2>{0.311613768f, 0.418777943f},
-std::array<float,2>{0.573373199f, 0.00895788148f},
-std::array<float,2>{0.323355556f, 0.646987438f},
-std::array<float,2>{0.80351752f, 0.897274733f},
-std::array<float,2>{0.230201975f, 0.274190962f},
-std::array<float,2>{0.984579206f, 0.491659164f},
-std::array<float,2>{0.0216167979f, 0.791653037f},
-std::array<float,2>{0.692719817f, 0.512145817f},
-std::array<float,2>{0.455392301f, 0.184157968f},
-std::array<float,2>{0.559630632f, 0.398522079f},
-std::array<float,2>{0.26546073f, 0.852877796f},
-std::array<float,2>{0.869508028f, 0.597859681f},
-std::array<float,2>{0.136093453f, 0.208367452f},
-std::array<float,2>{0.919603884f, 0.0998418555f},
-std::array<float,2>{0.106911898f, 0.749302566f},
-std::array<float,2>{0.64555341f, 0.964769244f},
-std::array<float,2>{0.395005554f, 0.339637667f},
-std::array<float,2>{0.732150435f, 0.131419227f},
-std::array<float,2>{0.475621104f, 0.547743976f},
-std::array<float,2>{0.93862015f, 0.761361063f},
-std::array<float,2>{0.0330607854f, 0.451075852f},
-std::array<float,2>{0.755261958f, 0.307109207f},
-std::array<float,2>{0.198246419f, 0.928344607f},
-std::array<float,2>{0.609744787f, 0.675483882f},
-std::array<float,2>{0.350725174f, 0.0366593003f},
-std::array<float,2>{0.642736733f, 0.47621724f},
-std::array<float,2>{0.392788321f, 0.809023917f},
-std::array<float,2>{0.917919457f, 0.525933623f},
-std::array<float,2>{0.104059175f, 0.15721488f},
-std::array<float,2>{0.872484446f, 0.0286150854f},
-std::array<float,2>{0.138106421f, 0.635804951f},
-std::array<float,2>{0.558080494f, 0.878771484f},
-std::array<float,2>{0.259932727f, 0.25964582f},
-std::array<float,2>{0.617026865f, 0.22796914f},
-std::array<float,2>{0.34620586f, 0.589343607f},
-std::array<float,2>{0.751363873f, 0.814555585f},
-std::array<float,2>{0.199524894f, 0.422116041f},
-std::array<float,2>{0.942655802f, 0.365756482f},
-std::array<float,2>{0.0373223312f, 0.989373803f},
-std::array<float,2>{0.729453504f, 0.707987368f},
-std::array<float,2>{0.471083999f, 0.083413288f},
-std::array<float,2>{0.513485968f, 0.293738455f},
-std::array<float,2>{0.30675751f, 0.908786774f},
-std::array<float,2>{0.818546951f, 0.659232855f},
-std::array<float,2>{0.185008124f, 0.0621925816f},
-std::array<float,2>{0.885873377f, 0.150412381f},
-std::array<float,2>{0.0768972859f, 0.543316066f},
-std::array<float,2>{0.668177545f, 0.770810485f},
-std::array<float,2>{0.433323711f, 0.453464687f},
-std::array<float,2>{0.689830601f, 0.111797959f},
-std::array<float,2>{0.460820377f, 0.726917446f},
-std::array<float,2>{0.99064672f, 0.939812362f},
-std::array<float,2>{0.0192128103f, 0.326882839f},
-std::array<float,2>{0.799660861f, 0.385148883f},
-std::array<float,2>{0.2321821f, 0.865324557f},
-std::array<float,2>{0.575448811f, 0.612989604f},
-std::array<float,2>{0.326049954f, 0.194238871f},
-std::array<float,2>{0.736432731f, 0.334804505f},
-std::array<float,2>{0.49816829f, 0.95528388f},
-std::array<float,2>{0.96764344f, 0.737789154f},
-std::array<float,2>{0.0600545853f, 0.106605291f},
-std::array<float,2>{0.776936352f, 0.216952264f},
-std::array<float,2>{0.213252962f, 0.604980946f},
-std::array<float,2>{0.597224116f, 0.850200236f},
-std::array<float,2>{0.359431177f, 0.397301853f},
-std::array<float,2>{0.533004582f, 0.0444353782f},
-std::array<float,2>{0.280311793f, 0.68469739f},
-std::array<float,2>{0.858761132f, 0.931657672f},
-std::array<float,2>{0.14246431f, 0.299435288f},
-std::array<float,2>{0.93037498f, 0.44278425f},
-std::array<float,2>{0.121472657f, 0.752006173f},
-std::array<float,2>{0.629085422f, 0.562098205f},
-std::array<float,2>{0.385207593f, 0.139674112f},
-std::array<float,2>{0.58673805f, 0.408977747f},
-std::array<float,2>{0.337561578f, 0.830312431f},
-std::array<float,2>{0.783126235f, 0.568840623f},
-std::array<float,2>{0.236565053f, 0.240201473f},
-std::array<float,2>{0.981805325f, 0.0675349683f},
-std::array<float,2>{0.00280011282f, 0.696103573f},
-std::array<float,2>{0.70620358f, 0.979347646f},
-std::array<float,2>{0.450642228f, 0.358799279f},
-std::array<float,2>{0.681624353f, 0.173024163f},
-std::array<float,2>{0.418109059f, 0.501368701f},
-std::array<float,2>{0.905438066f, 0.785455883f},
-std::array<float,2>{0.0861662701f, 0.495328933f},
-std::array<float,2>{0.840146959f, 0.269092053f},
-std::array<float,2>{0.159889013f, 0.90265578f},
-std::array<float,2>{0.522061408f, 0.653218269f},
-std::array<float,2>{0.290198624f, 0.0045092199f},
-std::array<float,2>{0.717270553f, 0.405201733f},
-std::array<float,2>{0.4422355f, 0.858048201f},
-std::array<float,2>{0.974933743f, 0.596672118f},
-std::array<float,2>{0.0150295831f, 0.20481661f},
-std::array<float,2>{0.791991055f, 0.0938182548f},
-std::array<float,2>{0.243066907f, 0.745259881f},
-std::array<float,2>{0.579504132f, 0.967715621f},
-std::array<float,2>{0.333128631f, 0.342225403f},
-std::array<float,2>{0.524573624f, 0.126633227f},
-std::array<float,2>{0.283528626f, 0.553878605f},
-std::array<float,2>{0.830053687f, 0.762186706f},
-std::array<float,2>{0.167985901f, 0.445641547f},
-std::array<float,2>{0.893342316f, 0.308963329f},
-std::array<float,2>{0.0858637393f, 0.922874868f},
-std::array<float,2>{0.673780501f, 0.676670134f},
-std::array<float,2>{0.409879655f, 0.0319271944f},
-std::array<float,2>{0.607228756f, 0.350446016f},
-std::array<float,2>{0.371857345f, 0.973732293f},
-std::array<float,2>{0.767702401f, 0.693513215f},
-std::array<float,2>{0.20984523f, 0.073611401f},
-std::array<float,2>{0.957846642f, 0.243452162f},
-std::array<float,2>{0.0543823764f, 0.575220227f},
-std::array<float,2>{0.747819066f, 0.839395523f},
-std::array<float,2>{0.484784096f, 0.414554685f},
-std::array<float,2>{0.639412403f, 0.0145386644f},
-std::array<float,2>{0.381957322f, 0.641440809f},
-std::array<float,2>{0.928626359f, 0.892795026f},
-std::array<float,2>{0.111128584f, 0.280539185f},
-std::array<float,2>{0.850329757f, 0.484384865f},
-std::array<float,2>{0.154467762f, 0.796754718f},
-std::array<float,2>{0.543328822f, 0.508868754f},
-std::array<float,2>{0.269142717f, 0.181130916f},
-std::array<float,2>{0.660813808f, 0.251464397f},
-std::array<float,2>{0.428831547f, 0.883065939f},
-std::array<float,2>{0.877365589f, 0.626428723f},
-std::array<float,2>{0.064361684f, 0.0204110388f},
-std::array<float,2>{0.824798703f, 0.169988155f},
-std::array<float,2>{0.173501879f, 0.516247332f},
-std::array<float,2>{0.503537357f, 0.799730539f},
-std::array<float,2>{0.303394079f, 0.482938647f},
-std::array<float,2>{0.566488564f, 0.0918529704f},
-std::array<float,2>{0.317026854f, 0.71632576f},
-std::array<float,2>{0.807285786f, 0.997405827f},
-std::array<float,2>{0.223658353f, 0.370338947f},
-std::array<float,2>{0.998211086f, 0.433847338f},
-std::array<float,2>{0.0261613335f, 0.82689333f},
-std::array<float,2>{0.696194112f, 0.581128538f},
-std::array<float,2>{0.464278817f, 0.223566309f},
-std::array<float,2>{0.552074671f, 0.461346656f},
-std::array<float,2>{0.254185051f, 0.776676118f},
-std::array<float,2>{0.865203083f, 0.536379576f},
-std::array<float,2>{0.125607803f, 0.144859061f},
-std::array<float,2>{0.909097254f, 0.0506017879f},
-std::array<float,2>{0.0998754948f, 0.668934762f},
-std::array<float,2>{0.652088583f, 0.919894516f},
-std::array<float,2>{0.402139336f, 0.284604341f},
-std::array<float,2>{0.721383214f, 0.200327709f},
-std::array<float,2>{0.481193751f, 0.622455895f},
-std::array<float,2>{0.947841167f, 0.872991145f},
-std::array<float,2>{0.0440209918f, 0.381797999f},
-std::array<float,2>{0.765374064f, 0.318225354f},
-std::array<float,2>{0.191906691f, 0.949341416f},
-std::array<float,2>{0.62323612f, 0.7209571f},
-std::array<float,2>{0.357142836f, 0.118190609f},
-std::array<float,2>{0.677481949f, 0.427152634f},
-std::array<float,2>{0.414044648f, 0.81922543f},
-std::array<float,2>{0.89687115f, 0.592996776f},
-std::array<float,2>{0.079793267f, 0.230494142f},
-std::array<float,2>{0.835250914f, 0.0803051293f},
-std::array<float,2>{0.167665809f, 0.705012321f},
-std::array<float,2>{0.529427767f, 0.985815287f},
-std::array<float,2>{0.28779617f, 0.359577328f},
-std::array<float,2>{0.583980381f, 0.161404461f},
-std::array<float,2>{0.330678999f, 0.527484238f},
-std::array<float,2>{0.796130061f, 0.806743741f},
-std::array<float,2>{0.249686837f, 0.471366912f},
-std::array<float,2>{0.972340167f, 0.263488531f},
-std::array<float,2>{0.0114747072f, 0.879015028f},
-std::array<float,2>{0.713448524f, 0.639121234f},
-std::array<float,2>{0.440776646f, 0.0234685615f},
-std::array<float,2>{0.541982174f, 0.322562695f},
-std::array<float,2>{0.273394942f, 0.942875206f},
-std::array<float,2>{0.846729338f, 0.733865917f},
-std::array<float,2>{0.152309686f, 0.114547193f},
-std::array<float,2>{0.923503101f, 0.189320415f},
-std::array<float,2>{0.114971384f, 0.615912914f},
-std::array<float,2>{0.636098862f, 0.859501421f},
-std::array<float,2>{0.378715605f, 0.387352258f},
-std::array<float,2>{0.745181859f, 0.0559750646f},
-std::array<float,2>{0.489926755f, 0.661256969f},
-std::array<float,2>{0.956480324f, 0.913088799f},
-std::array<float,2>{0.0471897349f, 0.29087773f},
-std::array<float,2>{0.771534741f, 0.457375437f},
-std::array<float,2>{0.206199452f, 0.766689777f},
-std::array<float,2>{0.60211271f, 0.542431414f},
-std::array<float,2>{0.370728761f, 0.153457418f},
-std::array<float,2>{0.700740457f, 0.301748753f},
-std::array<float,2>{0.467005879f, 0.935881436f},
-std::array<float,2>{0.993072569f, 0.681984365f},
-std::array<float,2>{0.0293644648f, 0.0395096503f},
-std::array<float,2>{0.808660984f, 0.134576559f},
-std::array<float,2>{0.222462445f, 0.556464434f},
-std::array<float,2>{0.565046668f, 0.756569624f},
-std::array<float,2>{0.314134955f, 0.439077377f},
-std::array<float,2>{0.50507468f, 0.103183627f},
-std::array<float,2>{0.298931777f, 0.741713285f},
-std::array<float,2>{0.822596967f, 0.95878166f},
-std::array<float,2>{0.178080574f, 0.328545302f},
-std::array<float,2>{0.882367313f, 0.394223034f},
-std::array<float,2>{0.0667778552f, 0.84760952f},
-std::array<float,2>{0.657117844f, 0.607522905f},
-std::array<float,2>{0.422028273f, 0.214454785f},
-std::array<float,2>{0.620160222f, 0.49838382f},
-std::array<float,2>{0.354181826f, 0.784624815f},
-std::array<float,2>{0.759583354f, 0.506438792f},
-std::array<float,2>{0.189836279f, 0.179108679f},
-std::array<float,2>{0.952889442f, 0.00289777317f},
-std::array<float,2>{0.0418271273f, 0.648806095f},
-std::array<float,2>{0.724607229f, 0.899190128f},
-std::array<float,2>{0.476743072f, 0.271399736f},
-std::array<float,2>{0.656224608f, 0.23513037f},
-std::array<float,2>{0.402997702f, 0.564933002f},
-std::array<float,2>{0.910983086f, 0.832442403f},
-std::array<float,2>{0.0961385146f, 0.41374144f},
-std::array<float,2>{0.862792313f, 0.352878958f},
-std::array<float,2>{0.131020918f, 0.981318593f},
-std::array<float,2>{0.549103081f, 0.7004053f},
-std::array<float,2>{0.251313686f, 0.0632007718f},
-std::array<float,2>{0.734283984f, 0.44953239f},
-std::array<float,2>{0.473320454f, 0.760549366f},
-std::array<float,2>{0.93979615f, 0.548807859f},
-std::array<float,2>{0.0341294371f, 0.132064611f},
-std::array<float,2>{0.757165909f, 0.0358320028f},
-std::array<float,2>{0.196311161f, 0.674713731f},
-std::array<float,2>{0.613175511f, 0.929152906f},
-std::array<float,2>{0.348316133f, 0.307829976f},
-std::array<float,2>{0.561793864f, 0.207458347f},
-std::array<float,2>{0.263373077f, 0.599391282f},
-std::array<float,2>{0.868990064f, 0.852359831f},
-std::array<float,2>{0.134507522f, 0.399736017f},
-std::array<float,2>{0.921816409f, 0.338104635f},
-std::array<float,2>{0.108646184f, 0.963115931f},
-std::array<float,2>{0.646492243f, 0.748593628f},
-std::array<float,2>{0.397655576f, 0.101378225f},
-std::array<float,2>{0.572102547f, 0.275207937f},
-std::array<float,2>{0.320523143f, 0.897503674f},
-std::array<float,2>{0.801333368f, 0.648150146f},
-std::array<float,2>{0.227302253f, 0.00818351563f},
-std::array<float,2>{0.987954319f, 0.18528159f},
-std::array<float,2>{0.0210580733f, 0.512840033f},
-std::array<float,2>{0.693410635f, 0.792237639f},
-std::array<float,2>{0.453718513f, 0.490750164f},
-std::array<float,2>{0.666244328f, 0.0750290528f},
-std::array<float,2>{0.434024304f, 0.69071424f},
-std::array<float,2>{0.886987507f, 0.970566094f},
-std::array<float,2>{0.0741210803f, 0.34522438f},
-std::array<float,2>{0.815024436f, 0.419128656f},
-std::array<float,2>{0.182607085f, 0.840781808f},
-std::array<float,2>{0.509717762f, 0.571845353f},
-std::array<float,2>{0.31024313f, 0.247967914f},
-std::array<float,2>{0.628150225f, 0.372668952f},
-std::array<float,2>{0.390135735f, 0.993935645f},
-std::array<float,2>{0.937223911f, 0.71269834f},
-std::array<float,2>{0.119248144f, 0.0863691196f},
-std::array<float,2>{0.854237139f, 0.221325651f},
-std::array<float,2>{0.147288233f, 0.583478451f},
-std::array<float,2>{0.537810564f, 0.821892262f},
-std::array<float,2>{0.273531348f, 0.431146145f},
-std::array<float,2>{0.599345386f, 0.0186208449f},
-std::array<float,2>{0.365279019f, 0.630010307f},
-std::array<float,2>{0.780191064f, 0.887112439f},
-std::array<float,2>{0.21730119f, 0.257636398f},
-std::array<float,2>{0.963005304f, 0.477968097f},
-std::array<float,2>{0.0554995574f, 0.802598655f},
-std::array<float,2>{0.742048085f, 0.521805882f},
-std::array<float,2>{0.494015038f, 0.167292431f},
-std::array<float,2>{0.519369483f, 0.378037304f},
-std::array<float,2>{0.294331402f, 0.867309928f},
-std::array<float,2>{0.837584555f, 0.618335068f},
-std::array<float,2>{0.163519219f, 0.198313251f},
-std::array<float,2>{0.899267495f, 0.122572631f},
-std::array<float,2>{0.0918285549f, 0.72317642f},
-std::array<float,2>{0.684213221f, 0.946570814f},
-std::array<float,2>{0.417702258f, 0.31403017f},
-std::array<float,2>{0.70994097f, 0.141555503f},
-std::array<float,2>{0.446532637f, 0.532435715f},
-std::array<float,2>{0.977761805f, 0.779147983f},
-std::array<float,2>{0.00405555405f, 0.46573022f},
-std::array<float,2>{0.786742806f, 0.287913978f},
-std::array<float,2>{0.241340578f, 0.91724515f},
-std::array<float,2>{0.593458831f, 0.665818155f},
-std::array<float,2>{0.341926992f, 0.0529033393f},
-std::array<float,2>{0.671287358f, 0.455522001f},
-std::array<float,2>{0.430437058f, 0.771714389f},
-std::array<float,2>{0.884215593f, 0.545052052f},
-std::array<float,2>{0.0751981512f, 0.150014192f},
-std::array<float,2>{0.816855729f, 0.0592323132f},
-std::array<float,2>{0.187127024f, 0.658195615f},
-std::array<float,2>{0.51398313f, 0.907518983f},
-std::array<float,2>{0.306276947f, 0.295980752f},
-std::array<float,2>{0.577904224f, 0.192998007f},
-std::array<float,2>{0.327869892f, 0.610203624f},
-std::array<float,2>{0.797991991f, 0.864957213f},
-std::array<float,2>{0.233423218f, 0.384614587f},
-std::array<float,2>{0.988897562f, 0.326048434f},
-std::array<float,2>{0.0173838437f, 0.937902153f},
-std::array<float,2>{0.688818216f, 0.728628933f},
-std::array<float,2>{0.457588911f, 0.110080786f},
-std::array<float,2>{0.555267513f, 0.259936899f},
-std::array<float,2>{0.259539545f, 0.876945794f},
-std::array<float,2>{0.873475194f, 0.634587049f},
-std::array<float,2>{0.140452817f, 0.0306278653f},
-std::array<float,2>{0.915519357f, 0.158842191f},
-std::array<float,2>{0.102904864f, 0.524532139f},
-std::array<float,2>{0.640942693f, 0.811486065f},
-std::array<float,2>{0.391538501f, 0.474324733f},
-std::array<float,2>{0.726817787f, 0.0842802674f},
-std::array<float,2>{0.470685631f, 0.710544407f},
-std::array<float,2>{0.944999993f, 0.99064368f},
-std::array<float,2>{0.0362226404f, 0.363471627f},
-std::array<float,2>{0.752385974f, 0.425222933f},
-std::array<float,2>{0.20236285f, 0.814398825f},
-std::array<float,2>{0.614120305f, 0.586091161f},
-std::array<float,2>{0.345128864f, 0.22937578f},
-std::array<float,2>{0.703247726f, 0.356950819f},
-std::array<float,2>{0.452643842f, 0.978411198f},
-std::array<float,2>{0.98430115f, 0.698233128f},
-std::array<float,2>{0.000954583869f, 0.0684995428f},
-std::array<float,2>{0.78500551f, 0.241297886f},
-std::array<float,2>{0.235654324f, 0.566947997f},
-std::array<float,2>{0.588763416f, 0.829582393f},
-std::array<float,2>{0.337927371f, 0.407977164f},
-std::array<float,2>{0.520801425f, 0.00607646257f},
-std::array<float,2>{0.292133898f, 0.654336452f},
-std::array<float,2>{0.843592942f, 0.905264497f},
-std::array<float,2>{0.156446397f, 0.266806692f},
-std::array<float,2>{0.904016614f, 0.493161768f},
-std::array<float,2>{0.0888447762f, 0.788411915f},
-std::array<float,2>{0.681905687f, 0.502446473f},
-std::array<float,2>{0.420727372f, 0.175545946f},
-std::array<float,2>{0.594251752f, 0.395505577f},
-std::array<float,2>{0.361806124f, 0.849468887f},
-std::array<float,2>{0.774640143f, 0.603213072f},
-std::array<float,2>{0.212028384f, 0.216353774f},
-std::array<float,2>{0.965692103f, 0.108393647f},
-std::array<float,2>{0.0610627122f, 0.736249804f},
-std::array<float,2>{0.734895945f, 0.954071939f},
-std::array<float,2>{0.497144043f, 0.33360371f},
-std::array<float,2>{0.631950736f, 0.138282612f},
-std::array<float,2>{0.38284716f, 0.558643758f},
-std::array<float,2>{0.932076037f, 0.750405967f},
-std::array<float,2>{0.123097174f, 0.444235504f},
-std::array<float,2>{0.856578708f, 0.297668934f},
-std::array<float,2>{0.144366905f, 0.929912269f},
-std::array<float,2>{0.534894228f, 0.686675966f},
-std::array<float,2>{0.27826041f, 0.0457307324f},
-std::array<float,2>{0.749083042f, 0.417301238f},
-std::array<float,2>{0.486837387f, 0.837870419f},
-std::array<float,2>{0.959069312f, 0.577146649f},
-std::array<float,2>{0.0509767383f, 0.245983869f},
-std::array<float,2>{0.766103089f, 0.071526587f},
-std::array<float,2>{0.207938835f, 0.6915856f},
-std::array<float,2>{0.608462751f, 0.976534843f},
-std::array<float,2>{0.373146176f, 0.34774366f},
-std::array<float,2>{0.546145737f, 0.183566898f},
-std::array<float,2>{0.265657187f, 0.510988951f},
-std::array<float,2>{0.848575175f, 0.793603778f},
-std::array<float,2>{0.154059112f, 0.488218427f},
-std::array<float,2>{0.92625314f, 0.278532743f},
-std::array<float,2>{0.111903593f, 0.890820205f},
-std::array<float,2>{0.637776852f, 0.6442765f},
-std::array<float,2>{0.379288286f, 0.0130396048f},
-std::array<float,2>{0.581147611f, 0.341153145f},
-std::array<float,2>{0.334001184f, 0.965450406f},
-std::array<float,2>{0.790978372f, 0.742690086f},
-std::array<float,2>{0.245961294f, 0.0970946327f},
-std::array<float,2>{0.972929239f, 0.206223205f},
-std::array<float,2>{0.0133245662f, 0.594211102f},
-std::array<float,2>{0.715419352f, 0.856730878f},
-std::array<float,2>{0.445173919f, 0.402907759f},
-std::array<float,2>{0.675668299f, 0.0344505422f},
-std::array<float,2>{0.406572461f, 0.67951715f},
-std::array<float,2>{0.891752243f, 0.924999058f},
-std::array<float,2>{0.0824210793f, 0.312028557f},
-std::array<float,2>{0.831508994f, 0.447858453f},
-std::array<float,2>{0.171742767f, 0.763814569f},
-std::array<float,2>{0.525773883f, 0.552685916f},
-std::array<float,2>{0.28281343f, 0.12710762f},
-std::array<float,2>{0.64874047f, 0.282479316f},
-std::array<float,2>{0.400068671f, 0.919936895f},
-std::array<float,2>{0.906574905f, 0.671598136f},
-std::array<float,2>{0.0988151878f, 0.0487095118f},
-std::array<float,2>{0.866311431f, 0.14748098f},
-std::array<float,2>{0.128748268f, 0.537850797f},
-std::array<float,2>{0.553523481f, 0.774042904f},
-std::array<float,2>{0.256236017f, 0.463002324f},
-std::array<float,2>{0.622342646f, 0.12065728f},
-std::array<float,2>{0.358326077f, 0.719744146f},
-std::array<float,2>{0.763025463f, 0.951316655f},
-std::array<float,2>{0.19453612f, 0.318554223f},
-std::array<float,2>{0.945593119f, 0.380136281f},
-std::array<float,2>{0.0462570861f, 0.874116361f},
-std::array<float,2>{0.719664693f, 0.624459445f},
-std::array<float,2>{0.484113753f, 0.201845527f},
-std::array<float,2>{0.500927329f, 0.481043428f},
-std::array<float,2>{0.301552325f, 0.798280001f},
-std::array<float,2>{0.827753425f, 0.518581629f},
-std::array<float,2>{0.17564556f, 0.168696389f},
-std::array<float,2>{0.875374258f, 0.0218145512f},
-std::array<float,2>{0.0651237443f, 0.627353549f},
-std::array<float,2>{0.662339687f, 0.885811508f},
-std::array<float,2>{0.426455706f, 0.253462583f},
-std::array<float,2>{0.698965192f, 0.225847304f},
-std::array<float,2>{0.462329984f, 0.578577697f},
-std::array<float,2>{0.996826172f, 0.824401915f},
-std::array<float,2>{0.0234964434f, 0.435760945f},
-std::array<float,2>{0.805072308f, 0.368045568f},
-std::array<float,2>{0.225179121f, 0.999993742f},
-std::array<float,2>{0.569838107f, 0.717841148f},
-std::array<float,2>{0.320199221f, 0.0906885341f},
-std::array<float,2>{0.634489238f, 0.389419526f},
-std::array<float,2>{0.376329929f, 0.861950099f},
-std::array<float,2>{0.925456762f, 0.613421798f},
-std::array<float,2>{0.116311215f, 0.189536259f},
-std::array<float,2>{0.844039559f, 0.115773186f},
-std::array<float,2>{0.149618566f, 0.731473446f},
-std::array<float,2>{0.540851951f, 0.943942845f},
-std::array<float,2>{0.269856393f, 0.321661204f},
-std::array<float,2>{0.603828251f, 0.155012429f},
-std::array<float,2>{0.368950188f, 0.539591074f},
-std::array<float,2>{0.771174252f, 0.768710971f},
-std::array<float,2>{0.203774482f, 0.459797293f},
-std::array<float,2>{0.954514503f, 0.291671842f},
-std::array<float,2>{0.0498733893f, 0.910582602f},
-std::array<float,2>{0.744122267f, 0.663514793f},
-std::array<float,2>{0.490971178f, 0.0581095144f},
-std::array<float,2>{0.528124034f, 0.361477166f},
-std::array<float,2>{0.285646856f, 0.987968147f},
-std::array<float,2>{0.833607495f, 0.706803799f},
-std::array<float,2>{0.164561614f, 0.0799264312f},
-std::array<float,2>{0.895251393f, 0.23293975f},
-std::array<float,2>{0.0812952891f, 0.590301335f},
-std::array<float,2>{0.678853333f, 0.817794383f},
-std::array<float,2>{0.411634892f, 0.427914888f},
-std::array<float,2>{0.711787879f, 0.0262740366f},
-std::array<float,2>{0.437635899f, 0.63682276f},
-std::array<float,2>{0.970619798f, 0.882062972f},
-std::array<float,2>{0.00864512473f, 0.264014304f},
-std::array<float,2>{0.794080079f, 0.470542818f},
-std::array<float,2>{0.247884855f, 0.805810511f},
-std::array<float,2>{0.585731626f, 0.530808687f},
-std::array<float,2>{0.329972595f, 0.16213572f},
-std::array<float,2>{0.725692511f, 0.27188912f},
-std::array<float,2>{0.480318755f, 0.901929379f},
-std::array<float,2>{0.949851513f, 0.650434613f},
-std::array<float,2>{0.0397971086f, 0.00178648089f},
-std::array<float,2>{0.760139108f, 0.176046669f},
-std::array<float,2>{0.189302549f, 0.505642891f},
-std::array<float,2>{0.617267907f, 0.782402754f},
-std::array<float,2>{0.352263719f, 0.496611536f},
-std::array<float,2>{0.547904789f, 0.0663984939f},
-std::array<float,2>{0.253589183f, 0.702490568f},
-std::array<float,2>{0.860416114f, 0.982662022f},
-std::array<float,2>{0.13085486f, 0.355187327f},
-std::array<float,2>{0.913500845f, 0.411036521f},
-std::array<float,2>{0.0953435898f, 0.835565448f},
-std::array<float,2>{0.653859019f, 0.563431084f},
-std::array<float,2>{0.404984564f, 0.237763345f},
-std::array<float,2>{0.562712371f, 0.439784229f},
-std::array<float,2>{0.316047221f, 0.755313575f},
-std::array<float,2>{0.811810136f, 0.558082163f},
-std::array<float,2>{0.219780281f, 0.135428175f},
-std::array<float,2>{0.994985163f, 0.042906262f},
-std::array<float,2>{0.0287807956f, 0.680896163f},
-std::array<float,2>{0.702786207f, 0.935046136f},
-std::array<float,2>{0.465020239f, 0.302781254f},
-std::array<float,2>{0.658743262f, 0.211045384f},
-std::array<float,2>{0.425757915f, 0.606118679f},
-std::array<float,2>{0.880570412f, 0.845626652f},
-std::array<float,2>{0.0685546845f, 0.391527057f},
-std::array<float,2>{0.820673883f, 0.330187708f},
-std::array<float,2>{0.176678091f, 0.960863411f},
-std::array<float,2>{0.505950391f, 0.73873204f},
-std::array<float,2>{0.298521698f, 0.10353829f},
-std::array<float,2>{0.691801846f, 0.488496691f},
-std::array<float,2>{0.456434757f, 0.790592253f},
-std::array<float,2>{0.985649705f, 0.514539599f},
-std::array<float,2>{0.02317244f, 0.186687946f},
-std::array<float,2>{0.804086983f, 0.00982098561f},
-std::array<float,2>{0.229106948f, 0.645754039f},
-std::array<float,2>{0.572688937f, 0.89536047f},
-std::array<float,2>{0.322620422f, 0.27565822f},
-std::array<float,2>{0.511286378f, 0.248635709f},
-std::array<float,2>{0.310706407f, 0.573907018f},
-std::array<float,2>{0.813399315f, 0.843066037f},
-std::array<float,2>{0.179973498f, 0.421534926f},
-std::array<float,2>{0.89032197f, 0.346742719f},
-std::array<float,2>{0.0716081262f, 0.972424328f},
-std::array<float,2>{0.665721893f, 0.688380718f},
-std::array<float,2>{0.437271923f, 0.0776987895f},
-std::array<float,2>{0.610573828f, 0.30500558f},
-std::array<float,2>{0.350428194f, 0.927468896f},
-std::array<float,2>{0.754594266f, 0.673281372f},
-std::array<float,2>{0.197920248f, 0.0386372097f},
-std::array<float,2>{0.937653303f, 0.13079454f},
-std::array<float,2>{0.0318061411f, 0.550379097f},
-std::array<float,2>{0.731405675f, 0.759689093f},
-std::array<float,2>{0.475149453f, 0.452909589f},
-std::array<float,2>{0.644782484f, 0.0979447141f},
-std::array<float,2>{0.395929128f, 0.746136248f},
-std::array<float,2>{0.91862458f, 0.962502301f},
-std::array<float,2>{0.10576795f, 0.337837666f},
-std::array<float,2>{0.870157659f, 0.401666135f},
-std::array<float,2>{0.135352969f, 0.854110003f},
-std::array<float,2>{0.559226215f, 0.600123107f},
-std::array<float,2>{0.264504164f, 0.210885048f},
-std::array<float,2>{0.687192023f, 0.314464927f},
-std::array<float,2>{0.414495945f, 0.948735714f},
-std::array<float,2>{0.901839972f, 0.726344466f},
-std::array<float,2>{0.0910571143f, 0.123197123f},
-std::array<float,2>{0.839252472f, 0.197077096f},
-std::array<float,2>{0.160514891f, 0.620404243f},
-std::array<float,2>{0.516252756f, 0.870852709f},
-std::array<float,2>{0.296304196f, 0.376069754f},
-std::array<float,2>{0.591439188f, 0.052447129f},
-std::array<float,2>{0.340285063f, 0.666024923f},
-std::array<float,2>{0.788668633f, 0.914389133f},
-std::array<float,2>{0.238619789f, 0.28584367f},
-std::array<float,2>{0.978878677f, 0.467315614f},
-std::array<float,2>{0.00663159974f, 0.780466735f},
-std::array<float,2>{0.707803607f, 0.53414309f},
-std::array<float,2>{0.448024035f, 0.143940538f},
-std::array<float,2>{0.536317289f, 0.432123095f},
-std::array<float,2>{0.276593506f, 0.823497117f},
-std::array<float,2>{0.853177547f, 0.584005117f},
-std::array<float,2>{0.14512068f, 0.219311699f},
-std::array<float,2>{0.935205519f, 0.0896378085f},
-std::array<float,2>{0.118213035f, 0.714349985f},
-std::array<float,2>{0.626541436f, 0.995845795f},
-std::array<float,2>{0.388476938f, 0.373431534f},
-std::array<float,2>{0.740028262f, 0.165030971f},
-std::array<float,2>{0.495833635f, 0.520480752f},
-std::array<float,2>{0.962195039f, 0.803537071f},
-std::array<float,2>{0.0584790558f, 0.480426103f},
-std::array<float,2>{0.77906251f, 0.254231721f},
-std::array<float,2>{0.215659738f, 0.888904572f},
-std::array<float,2>{0.600168765f, 0.631920815f},
-std::array<float,2>{0.364201397f, 0.0168058593f},
-std::array<float,2>{0.635389268f, 0.45967263f},
-std::array<float,2>{0.377640635f, 0.768987834f},
-std::array<float,2>{0.922611594f, 0.539991558f},
-std::array<float,2>{0.113353439f, 0.155268803f},
-std::array<float,2>{0.846455336f, 0.0584399775f},
-std::array<float,2>{0.150645643f, 0.663127005f},
-std::array<float,2>{0.542421281f, 0.9101668f},
-std::array<float,2>{0.271794587f, 0.291954994f},
-std::array<float,2>{0.602944374f, 0.189927474f},
-std::array<float,2>{0.369265437f, 0.613566816f},
-std::array<float,2>{0.772918642f, 0.862232149f},
-std::array<float,2>{0.205924511f, 0.389279902f},
-std::array<float,2>{0.955670059f, 0.321491718f},
-std::array<float,2>{0.0480683334f, 0.944196284f},
-std::array<float,2>{0.744318902f, 0.731707811f},
-std::array<float,2>{0.489031821f, 0.116004035f},
-std::array<float,2>{0.531148434f, 0.263721913f},
-std::array<float,2>{0.288391292f, 0.882182896f},
-std::array<float,2>{0.83493799f, 0.637172103f},
-std::array<float,2>{0.166573048f, 0.0259185061f},
-std::array<float,2>{0.897555113f, 0.162583336f},
-std::array<float,2>{0.0786108449f, 0.531042278f},
-std::array<float,2>{0.676721454f, 0.805955529f},
-std::array<float,2>{0.412669837f, 0.470325589f},
-std::array<float,2>{0.714634418f, 0.0796416998f},
-std::array<float,2>{0.440357029f, 0.706589341f},
-std::array<float,2>{0.970970631f, 0.98822093f},
-std::array<float,2>{0.00985830184f, 0.361690521f},
-std::array<float,2>{0.795238137f, 0.428129941f},
-std::array<float,2>{0.248252019f, 0.817477584f},
-std::array<float,2>{0.582972646f, 0.590020776f},
-std::array<float,2>{0.331474632f, 0.233192712f},
-std::array<float,2>{0.723154187f, 0.355419308f},
-std::array<float,2>{0.477542311f, 0.982780039f},
-std::array<float,2>{0.951209843f, 0.70227021f},
-std::array<float,2>{0.0423608236f, 0.0659770072f},
-std::array<float,2>{0.758113444f, 0.23739478f},
-std::array<float,2>{0.19123973f, 0.563189745f},
-std::array<float,2>{0.619797528f, 0.83574152f},
-std::array<float,2>{0.354869246f, 0.410842866f},
-std::array<float,2>{0.550237834f, 0.00155106385f},
-std::array<float,2>{0.250594318f, 0.650835752f},
-std::array<float,2>{0.861942947f, 0.902246237f},
-std::array<float,2>{0.132306471f, 0.271638274f},
-std::array<float,2>{0.911278605f, 0.49700278f},
-std::array<float,2>{0.097085759f, 0.782656014f},
-std::array<float,2>{0.654901743f, 0.50560534f},
-std::array<float,2>{0.40350157f, 0.175926179f},
-std::array<float,2>{0.565818071f, 0.391161799f},
-std::array<float,2>{0.312860906f, 0.845241368f},
-std::array<float,2>{0.810048521f, 0.606359184f},
-std::array<float,2>{0.221238092f, 0.211237401f},
-std::array<float,2>{0.993318439f, 0.103865109f},
-std::array<float,2>{0.0303181112f, 0.738427758f},
-std::array<float,2>{0.699277222f, 0.960452199f},
-std::array<float,2>{0.467824072f, 0.330524027f},
-std::array<float,2>{0.657382488f, 0.135505125f},
-std::array<float,2>{0.423258811f, 0.557837844f},
-std::array<float,2>{0.881585181f, 0.754934847f},
-std::array<float,2>{0.0675425306f, 0.439676911f},
-std::array<float,2>{0.824121416f, 0.303205013f},
-std::array<float,2>{0.179461181f, 0.934666693f},
-std::array<float,2>{0.504171669f, 0.680918813f},
-std::array<float,2>{0.299839586f, 0.0426497385f},
-std::array<float,2>{0.694769382f, 0.421810687f},
-std::array<float,2>{0.455002397f, 0.842870831f},
-std::array<float,2>{0.986423194f, 0.574030399f},
-std::array<float,2>{0.0197164323f, 0.248855144f},
-std::array<float,2>{0.802239776f, 0.0780253038f},
-std::array<float,2>{0.227924719f, 0.688042164f},
-std::array<float,2>{0.570940793f, 0.97230643f},
-std::array<float,2>{0.321619213f, 0.347009093f},
-std::array<float,2>{0.508497536f, 0.18686004f},
-std::array<float,2>{0.309032649f, 0.514193773f},
-std::array<float,2>{0.81600821f, 0.791009843f},
-std::array<float,2>{0.183519393f, 0.488724351f},
-std::array<float,2>{0.888546109f, 0.275391847f},
-std::array<float,2>{0.0728949606f, 0.895126462f},
-std::array<float,2>{0.667052388f, 0.645701528f},
-std::array<float,2>{0.435217619f, 0.0102455374f},
-std::array<float,2>{0.612267077f, 0.337536693f},
-std::array<float,2>{0.349601954f, 0.962887347f},
-std::array<float,2>{0.756574869f, 0.746479332f},
-std::array<float,2>{0.196158886f, 0.0978750065f},
-std::array<float,2>{0.941199005f, 0.210532561f},
-std::array<float,2>{0.0350534208f, 0.600374579f},
-std::array<float,2>{0.732814908f, 0.854414761f},
-std::array<float,2>{0.474164009f, 0.401540786f},
-std::array<float,2>{0.647829592f, 0.0390136465f},
-std::array<float,2>{0.397444695f, 0.672986984f},
-std::array<float,2>{0.920001864f, 0.927598834f},
-std::array<float,2>{0.107736267f, 0.304732949f},
-std::array<float,2>{0.867886543f, 0.452697217f},
-std::array<float,2>{0.133774698f, 0.759490192f},
-std::array<float,2>{0.560666144f, 0.550728023f},
-std::array<float,2>{0.262209475f, 0.130420804f},
-std::array<float,2>{0.68551898f, 0.286071688f},
-std::array<float,2>{0.416039914f, 0.914154291f},
-std::array<float,2>{0.899786294f, 0.666429162f},
-std::array<float,2>{0.0931513533f, 0.0526745617f},
-std::array<float,2>{0.836877584f, 0.14378418f},
-std::array<float,2>{0.16222772f, 0.533905149f},
-std::array<float,2>{0.517699301f, 0.780748606f},
-std::array<float,2>{0.293925524f, 0.467750669f},
-std::array<float,2>{0.59273541f, 0.123347744f},
-std::array<float,2>{0.343142062f, 0.726317704f},
-std::array<float,2>{0.78564924f, 0.949157655f},
-std::array<float,2>{0.240341052f, 0.314766228f},
-std::array<float,2>{0.97678715f, 0.376296759f},
-std::array<float,2>{0.00545501756f, 0.870670378f},
-std::array<float,2>{0.710404634f, 0.620174706f},
-std::array<float,2>{0.445328265f, 0.196780518f},
-std::array<float,2>{0.539050937f, 0.480007559f},
-std::array<float,2>{0.275006145f, 0.803402424f},
-std::array<float,2>{0.855187416f, 0.520053566f},
-std::array<float,2>{0.148062378f, 0.164747611f},
-std::array<float,2>{0.936229527f, 0.017065892f},
-std::array<float,2>{0.120829232f, 0.632277429f},
-std::array<float,2>{0.627423167f, 0.889006257f},
-std::array<float,2>{0.38937363f, 0.253966987f},
-std::array<float,2>{0.740410566f, 0.219710678f},
-std::array<float,2>{0.492761999f, 0.584248424f},
-std::array<float,2>{0.964249194f, 0.82336539f},
-std::array<float,2>{0.0559575856f, 0.431746513f},
-std::array<float,2>{0.780557811f, 0.373194695f},
-std::array<float,2>{0.218225569f, 0.996061027f},
-std::array<float,2>{0.598399937f, 0.71395582f},
-std::array<float,2>{0.367119759f, 0.0893790498f},
-std::array<float,2>{0.66906178f, 0.384449244f},
-std::array<float,2>{0.432112992f, 0.86502552f},
-std::array<float,2>{0.885312438f, 0.609995186f},
-std::array<float,2>{0.0776574537f, 0.19333142f},
-std::array<float,2>{0.819530845f, 0.110120453f},
-std::array<float,2>{0.184044719f, 0.728850663f},
-std::array<float,2>{0.512687147f, 0.937625408f},
-std::array<float,2>{0.308511615f, 0.325737953f},
-std::array<float,2>{0.574565172f, 0.150342315f},
-std::array<float,2>{0.324330389f, 0.545351505f},
-std::array<float,2>{0.799983919f, 0.771842182f},
-std::array<float,2>{0.230852172f, 0.455275685f},
-std::array<float,2>{0.991987765f, 0.296341658f},
-std::array<float,2>{0.018110875f, 0.907462597f},
-std::array<float,2>{0.690478563f, 0.657768965f},
-std::array<float,2>{0.459408432f, 0.0594427288f},
-std::array<float,2>{0.557044923f, 0.363651156f},
-std::array<float,2>{0.26085645f, 0.990321815f},
-std::array<float,2>{0.871112287f, 0.710841894f},
-std::array<float,2>{0.136949524f, 0.084156923f},
-std::array<float,2>{0.916060686f, 0.229196638f},
-std::array<float,2>{0.104858324f, 0.586191893f},
-std::array<float,2>{0.644013107f, 0.814137101f},
-std::array<float,2>{0.393952698f, 0.425027013f},
-std::array<float,2>{0.730089605f, 0.0304832943f},
-std::array<float,2>{0.472082496f, 0.634491146f},
-std::array<float,2>{0.941464782f, 0.876506448f},
-std::array<float,2>{0.0384196267f, 0.26017344f},
-std::array<float,2>{0.75048697f, 0.474457353f},
-std::array<float,2>{0.200967908f, 0.811185241f},
-std::array<float,2>{0.615412652f, 0.524839401f},
-std::array<float,2>{0.347246528f, 0.159039229f},
-std::array<float,2>{0.705526412f, 0.266929656f},
-std::array<float,2>{0.449973524f, 0.90482229f},
-std::array<float,2>{0.980591118f, 0.654689729f},
-std::array<float,2>{0.00378763117f, 0.00616814336f},
-std::array<float,2>{0.781525195f, 0.175413385f},
-std::array<float,2>{0.237747148f, 0.502710462f},
-std::array<float,2>{0.587629199f, 0.788116395f},
-std::array<float,2>{0.336889476f, 0.492722958f},
-std::array<float,2>{0.522747278f, 0.0687171966f},
-std::array<float,2>{0.28972894f, 0.697932482f},
-std::array<float,2>{0.841796756f, 0.978075206f},
-std::array<float,2>{0.159116372f, 0.357249081f},
-std::array<float,2>{0.904433906f, 0.407813847f},
-std::array<float,2>{0.0878526196f, 0.829263389f},
-std::array<float,2>{0.680328369f, 0.567354381f},
-std::array<float,2>{0.419177741f, 0.241487965f},
-std::array<float,2>{0.596534669f, 0.443993002f},
-std::array<float,2>{0.360363007f, 0.750159979f},
-std::array<float,2>{0.776354909f, 0.558915019f},
-std::array<float,2>{0.214068145f, 0.138494268f},
-std::array<float,2>{0.967855096f, 0.0455964878f},
-std::array<float,2>{0.0586867891f, 0.686825693f},
-std::array<float,2>{0.737554431f, 0.930095911f},
-std::array<float,2>{0.49919495f, 0.297605187f},
-std::array<float,2>{0.630686164f, 0.216717482f},
-std::array<float,2>{0.386589825f, 0.603357673f},
-std::array<float,2>{0.931072176f, 0.849300146f},
-std::array<float,2>{0.122503452f, 0.39503327f},
-std::array<float,2>{0.857944191f, 0.333754689f},
-std::array<float,2>{0.141467661f, 0.953846991f},
-std::array<float,2>{0.531603992f, 0.736041546f},
-std::array<float,2>{0.279479325f, 0.108126767f},
-std::array<float,2>{0.746269286f, 0.487893015f},
-std::array<float,2>{0.485688239f, 0.793817103f},
-std::array<float,2>{0.95818758f, 0.510916173f},
-std::array<float,2>{0.0534650721f, 0.183241934f},
-std::array<float,2>{0.769301534f, 0.012784523f},
-std::array<float,2>{0.210485056f, 0.644446909f},
-std::array<float,2>{0.605787873f, 0.891028762f},
-std::array<float,2>{0.372385114f, 0.278669655f},
-std::array<float,2>{0.544746816f, 0.245611593f},
-std::array<float,2>{0.267851055f, 0.576860905f},
-std::array<float,2>{0.851132035f, 0.837403536f},
-std::array<float,2>{0.155854568f, 0.417133093f},
-std::array<float,2>{0.928937614f, 0.347999692f},
-std::array<float,2>{0.109921589f, 0.976159394f},
-std::array<float,2>{0.639819741f, 0.691713214f},
-std::array<float,2>{0.381176025f, 0.071630463f},
-std::array<float,2>{0.578724086f, 0.312414765f},
-std::array<float,2>{0.3326796f, 0.925284743f},
-std::array<float,2>{0.792042136f, 0.67936939f},
-std::array<float,2>{0.243819222f, 0.0342130885f},
-std::array<float,2>{0.976314843f, 0.127346039f},
-std::array<float,2>{0.0136844581f, 0.552380443f},
-std::array<float,2>{0.7182163f, 0.764153779f},
-std::array<float,2>{0.443184853f, 0.448021948f},
-std::array<float,2>{0.672783792f, 0.0967627019f},
-std::array<float,2>{0.408958524f, 0.742971122f},
-std::array<float,2>{0.894306183f, 0.965590835f},
-std::array<float,2>{0.0841320008f, 0.340872556f},
-std::array<float,2>{0.828419328f, 0.403255433f},
-std::array<float,2>{0.169793621f, 0.856623352f},
-std::array<float,2>{0.523929119f, 0.593815506f},
-std::array<float,2>{0.284987062f, 0.206510872f},
-std::array<float,2>{0.651085377f, 0.318663388f},
-std::array<float,2>{0.401155025f, 0.951539099f},
-std::array<float,2>{0.909798443f, 0.720145285f},
-std::array<float,2>{0.101400226f, 0.121047564f},
-std::array<float,2>{0.864105999f, 0.20191966f},
-std::array<float,2>{0.126574308f, 0.624203324f},
-std::array<float,2>{0.551722348f, 0.874310255f},
-std::array<float,2>{0.255520642f, 0.379942387f},
-std::array<float,2>{0.624289989f, 0.0483781695f},
-std::array<float,2>{0.356438637f, 0.671657979f},
-std::array<float,2>{0.763685286f, 0.920300126f},
-std::array<float,2>{0.193178087f, 0.282455772f},
-std::array<float,2>{0.949173272f, 0.463152945f},
-std::array<float,2>{0.0431818478f, 0.774199188f},
-std::array<float,2>{0.721998811f, 0.537720025f},
-std::array<float,2>{0.48161146f, 0.147814706f},
-std::array<float,2>{0.502573311f, 0.43583414f},
-std::array<float,2>{0.304033071f, 0.824501991f},
-std::array<float,2>{0.826016903f, 0.578154922f},
-std::array<float,2>{0.172028288f, 0.225731164f},
-std::array<float,2>{0.87876761f, 0.0905086547f},
-std::array<float,2>{0.062669903f, 0.718251526f},
-std::array<float,2>{0.661569476f, 0.999631464f},
-std::array<float,2>{0.428348571f, 0.367699444f},
-std::array<float,2>{0.696463346f, 0.16879335f},
-std::array<float,2>{0.463534743f, 0.518888533f},
-std::array<float,2>{0.999259233f, 0.797877729f},
-std::array<float,2>{0.0270513222f, 0.481332928f},
-std::array<float,2>{0.808590174f, 0.253820091f},
-std::array<float,2>{0.223601356f, 0.886026323f},
-std::array<float,2>{0.568266928f, 0.626979589f},
-std::array<float,2>{0.318239212f, 0.0217029955f},
-std::array<float,2>{0.678192019f, 0.471504003f},
-std::array<float,2>{0.41076085f, 0.806945086f},
-std::array<float,2>{0.896006286f, 0.527755201f},
-std::array<float,2>{0.0802821591f, 0.161262065f},
-std::array<float,2>{0.832264781f, 0.0238796882f},
-std::array<float,2>{0.165133998f, 0.63879323f},
-std::array<float,2>{0.528410852f, 0.8791731f},
-std::array<float,2>{0.286242157f, 0.263306677f},
-std::array<float,2>{0.584483802f, 0.230758801f},
-std::array<float,2>{0.328811049f, 0.593052864f},
-std::array<float,2>{0.793368518f, 0.819005132f},
-std::array<float,2>{0.246770829f, 0.426891565f},
-std::array<float,2>{0.969067574f, 0.359657317f},
-std::array<float,2>{0.00883874856f, 0.985521019f},
-std::array<float,2>{0.712697089f, 0.70481801f},
-std::array<float,2>{0.439432353f, 0.0805629715f},
-std::array<float,2>{0.539245903f, 0.290716797f},
-std::array<float,2>{0.270684123f, 0.913447797f},
-std::array<float,2>{0.845551133f, 0.661378205f},
-std::array<float,2>{0.149086863f, 0.0556982197f},
-std::array<float,2>{0.923990905f, 0.153754756f},
-std::array<float,2>{0.115552351f, 0.542179763f},
-std::array<float,2>{0.633444905f, 0.767015755f},
-std::array<float,2>{0.375503838f, 0.457100511f},
-std::array<float,2>{0.742254615f, 0.114391133f},
-std::array<float,2>{0.49179855f, 0.73342973f},
-std::array<float,2>{0.953932762f, 0.943184376f},
-std::array<float,2>{0.0491618477f, 0.322457403f},
-std::array<float,2>{0.770107567f, 0.387680858f},
-std::array<float,2>{0.204557613f, 0.859742165f},
-std::array<float,2>{0.604695916f, 0.615989983f},
-std::array<float,2>{0.367380947f, 0.189062387f},
-std::array<float,2>{0.701376379f, 0.328264385f},
-std::array<float,2>{0.466495842f, 0.958543479f},
-std::array<float,2>{0.995667279f, 0.741962135f},
-std::array<float,2>{0.0276010055f, 0.103324771f},
-std::array<float,2>{0.81136018f, 0.214785248f},
-std::array<float,2>{0.219544068f, 0.607672215f},
-std::array<float,2>{0.563759744f, 0.847352862f},
-std::array<float,2>{0.315108895f, 0.394429594f},
-std::array<float,2>{0.506923914f, 0.0392571278f},
-std::array<float,2>{0.297347397f, 0.681692421f},
-std::array<float,2>{0.82185334f, 0.935662091f},
-std::array<float,2>{0.17761381f, 0.301385343f},
-std::array<float,2>{0.879745305f, 0.439323902f},
-std::array<float,2>{0.0697250515f, 0.756609619f},
-std::array<float,2>{0.659670651f, 0.556199014f},
-std::array<float,2>{0.424633175f, 0.134345055f},
-std::array<float,2>{0.618710697f, 0.414011121f},
-std::array<float,2>{0.352994144f, 0.832184434f},
-std::array<float,2>{0.760747194f, 0.56452167f},
-std::array<float,2>{0.18785654f, 0.235093892f},
-std::array<float,2>{0.950787723f, 0.0632499531f},
-std::array<float,2>{0.0402622223f, 0.70055598f},
-std::array<float,2>{0.725077331f, 0.981104136f},
-std::array<float,2>{0.478985876f, 0.352554351f},
-std::array<float,2>{0.653288305f, 0.178896114f},
-std::array<float,2>{0.405641168f, 0.506797671f},
-std::array<float,2>{0.912549257f, 0.784230947f},
-std::array<float,2>{0.0941500962f, 0.498216033f},
-std::array<float,2>{0.860034466f, 0.271202058f},
-std::array<float,2>{0.129419237f, 0.89893949f},
-std::array<float,2>{0.547638834f, 0.648546159f},
-std::array<float,2>{0.25199002f, 0.00254379772f},
-std::array<float,2>{0.731616616f, 0.399475366f},
-std::array<float,2>{0.476516753f, 0.852083921f},
-std::array<float,2>{0.939175248f, 0.599139571f},
-std::array<float,2>{0.0323980786f, 0.2071971f},
-std::array<float,2>{0.755482495f, 0.101176843f},
-std::array<float,2>{0.198872536f, 0.748809159f},
-std::array<float,2>{0.61006242f, 0.963210106f},
-std::array<float,2>{0.3513138f, 0.338207811f},
-std::array<float,2>{0.560225606f, 0.132093504f},
-std::array<float,2>{0.264768332f, 0.548356712f},
-std::array<float,2>{0.869921505f, 0.76027447f},
-std::array<float,2>{0.136644125f, 0.449332058f},
-std::array<float,2>{0.91937083f, 0.307977408f},
-std::array<float,2>{0.107167855f, 0.928761244f},
-std::array<float,2>{0.646275759f, 0.674538851f},
-std::array<float,2>{0.395393044f, 0.0359253325f},
-std::array<float,2>{0.573793411f, 0.345591903f},
-std::array<float,2>{0.323874384f, 0.970441997f},
-std::array<float,2>{0.802751184f, 0.690488756f},
-std::array<float,2>{0.22980763f, 0.0747964382f},
-std::array<float,2>{0.985097766f, 0.247780919f},
-std::array<float,2>{0.0222939756f, 0.572210848f},
-std::array<float,2>{0.692910492f, 0.840436935f},
-std::array<float,2>{0.456039101f, 0.419367284f},
-std::array<float,2>{0.664707243f, 0.007930113f},
-std::array<float,2>{0.436100245f, 0.648234785f},
-std::array<float,2>{0.888682425f, 0.897898078f},
-std::array<float,2>{0.0712125376f, 0.275085688f},
-std::array<float,2>{0.81414628f, 0.49111113f},
-std::array<float,2>{0.181480512f, 0.792222857f},
-std::array<float,2>{0.51071614f, 0.513086557f},
-std::array<float,2>{0.312428504f, 0.185451761f},
-std::array<float,2>{0.625091076f, 0.257487714f},
-std::array<float,2>{0.386868328f, 0.886839092f},
-std::array<float,2>{0.934248745f, 0.630207419f},
-std::array<float,2>{0.117910415f, 0.018884575f},
-std::array<float,2>{0.851950526f, 0.167183533f},
-std::array<float,2>{0.145877123f, 0.521582365f},
-std::array<float,2>{0.535833418f, 0.802488804f},
-std::array<float,2>{0.275545686f, 0.477725774f},
-std::array<float,2>{0.601240993f, 0.0861401334f},
-std::array<float,2>{0.365231067f, 0.712403953f},
-std::array<float,2>{0.777955413f, 0.993753672f},
-std::array<float,2>{0.216784894f, 0.372833014f},
-std::array<float,2>{0.96184504f, 0.430884451f},
-std::array<float,2>{0.0568820052f, 0.822121978f},
-std::array<float,2>{0.739006996f, 0.583143473f},
-std::array<float,2>{0.494692117f, 0.221589252f},
-std::array<float,2>{0.517480731f, 0.465334564f},
-std::array<float,2>{0.29531461f, 0.778840244f},
-std::array<float,2>{0.838815451f, 0.532688975f},
-std::array<float,2>{0.16159147f, 0.141214788f},
-std::array<float,2>{0.900758147f, 0.0532014668f},
-std::array<float,2>{0.0900686234f, 0.665540218f},
-std::array<float,2>{0.685631692f, 0.917170882f},
-std::array<float,2>{0.415883809f, 0.287789345f},
-std::array<float,2>{0.708598673f, 0.19870685f},
-std::array<float,2>{0.448396176f, 0.618483067f},
-std::array<float,2>{0.980077386f, 0.867658854f},
-std::array<float,2>{0.00777932256f, 0.378240317f},
-std::array<float,2>{0.787491322f, 0.314354658f},
-std::array<float,2>{0.239266366f, 0.946346343f},
-std::array<float,2>{0.590631843f, 0.723494947f},
-std::array<float,2>{0.34110707f, 0.122816198f},
-std::array<float,2>{0.642377973f, 0.422363013f},
-std::array<float,2>{0.392116338f, 0.814856827f},
-std::array<float,2>{0.914968848f, 0.58892256f},
-std::array<float,2>{0.101713382f, 0.227699101f},
-std::array<float,2>{0.874634027f, 0.0830216706f},
-std::array<float,2>{0.139120847f, 0.707662582f},
-std::array<float,2>{0.556004226f, 0.98971194f},
-std::array<float,2>{0.258092582f, 0.366023362f},
-std::array<float,2>{0.615196943f, 0.15680337f},
-std::array<float,2>{0.343770117f, 0.52631104f},
-std::array<float,2>{0.753237069f, 0.808837056f},
-std::array<float,2>{0.201229006f, 0.476546645f},
-std::array<float,2>{0.944231987f, 0.25934428f},
-std::array<float,2>{0.0355176665f, 0.87847501f},
-std::array<float,2>{0.728119195f, 0.636121094f},
-std::array<float,2>{0.469145119f, 0.0283813626f},
-std::array<float,2>{0.515482008f, 0.326962799f},
-std::array<float,2>{0.304956973f, 0.93966043f},
-std::array<float,2>{0.818144739f, 0.726591945f},
-std::array<float,2>{0.185722798f, 0.111410417f},
-std::array<float,2>{0.883195281f, 0.193955049f},
-std::array<float,2>{0.0749757811f, 0.613238215f},
-std::array<float,2>{0.670710921f, 0.865627646f},
-std::array<float,2>{0.430886418f, 0.384995073f},
-std::array<float,2>{0.688351393f, 0.0622966476f},
-std::array<float,2>{0.458128452f, 0.659546256f},
-std::array<float,2>{0.989307344f, 0.909037471f},
-std::array<float,2>{0.0158035476f, 0.29356721f},
-std::array<float,2>{0.797243416f, 0.453311801f},
-std::array<float,2>{0.233189493f, 0.770547628f},
-std::array<float,2>{0.577054024f, 0.543031812f},
-std::array<float,2>{0.32708025f, 0.150643989f},
-std::array<float,2>{0.735597432f, 0.299641758f},
-std::array<float,2>{0.496887147f, 0.931965709f},
-std::array<float,2>{0.966416538f, 0.684896529f},
-std::array<float,2>{0.0617530532f, 0.0448865965f},
-std::array<float,2>{0.773949265f, 0.140069038f},
-std::array<float,2>{0.211790949f, 0.562298119f},
-std::array<float,2>{0.595560908f, 0.752346635f},
-std::array<float,2>{0.362775296f, 0.44247365f},
-std::array<float,2>{0.533518374f, 0.106705658f},
-std::array<float,2>{0.278714001f, 0.737487614f},
-std::array<float,2>{0.855569005f, 0.955403745f},
-std::array<float,2>{0.143519312f, 0.334561288f},
-std::array<float,2>{0.932676554f, 0.397062391f},
-std::array<float,2>{0.124550179f, 0.85052681f},
-std::array<float,2>{0.631826878f, 0.605346918f},
-std::array<float,2>{0.38456288f, 0.21706216f},
-std::array<float,2>{0.589339733f, 0.495497108f},
-std::array<float,2>{0.339348793f, 0.785301983f},
-std::array<float,2>{0.783284485f, 0.500983119f},
-std::array<float,2>{0.23521857f, 0.173138574f},
-std::array<float,2>{0.9824242f, 0.00481597707f},
-std::array<float,2>{0.00158427819f, 0.652864873f},
-std::array<float,2>{0.704273462f, 0.90244019f},
-std::array<float,2>{0.451995224f, 0.269364834f},
-std::array<float,2>{0.682749212f, 0.239813998f},
-std::array<float,2>{0.421751887f, 0.568542719f},
-std::array<float,2>{0.90281707f, 0.830508709f},
-std::array<float,2>{0.0891454071f, 0.408711404f},
-std::array<float,2>{0.841863871f, 0.358610272f},
-std::array<float,2>{0.157688215f, 0.979013324f},
-std::array<float,2>{0.519928277f, 0.695919335f},
-std::array<float,2>{0.291635334f, 0.0676598102f},
-std::array<float,2>{0.716359675f, 0.445507437f},
-std::array<float,2>{0.443665206f, 0.761801481f},
-std::array<float,2>{0.974489033f, 0.554166257f},
-std::array<float,2>{0.0125877904f, 0.126828983f},
-std::array<float,2>{0.789095819f, 0.0320985392f},
-std::array<float,2>{0.244450942f, 0.676358342f},
-std::array<float,2>{0.58012569f, 0.923175156f},
-std::array<float,2>{0.335694999f, 0.308664799f},
-std::array<float,2>{0.526552856f, 0.204977602f},
-std::array<float,2>{0.28155762f, 0.596199632f},
-std::array<float,2>{0.830209076f, 0.858163357f},
-std::array<float,2>{0.17053318f, 0.404962003f},
-std::array<float,2>{0.89123714f, 0.341944456f},
-std::array<float,2>{0.083661966f, 0.967291355f},
-std::array<float,2>{0.674240172f, 0.745422006f},
-std::array<float,2>{0.407534599f, 0.0941635892f},
-std::array<float,2>{0.607657015f, 0.28038916f},
-std::array<float,2>{0.374737799f, 0.893062711f},
-std::array<float,2>{0.767037511f, 0.64119184f},
-std::array<float,2>{0.208212852f, 0.0144038023f},
-std::array<float,2>{0.960302591f, 0.18069993f},
-std::array<float,2>{0.0518526509f, 0.509069979f},
-std::array<float,2>{0.748697281f, 0.796446145f},
-std::array<float,2>{0.487307698f, 0.484641433f},
-std::array<float,2>{0.636861503f, 0.0732456446f},
-std::array<float,2>{0.380463451f, 0.693736494f},
-std::array<float,2>{0.927269042f, 0.974052906f},
-std::array<float,2>{0.112622939f, 0.350262523f},
-std::array<float,2>{0.849534392f, 0.414832145f},
-std::array<float,2>{0.152526945f, 0.839621007f},
-std::array<float,2>{0.545143366f, 0.575665593f},
-std::array<float,2>{0.266925752f, 0.243258834f},
-std::array<float,2>{0.66397655f, 0.370474547f},
-std::array<float,2>{0.427022815f, 0.997219145f},
-std::array<float,2>{0.876433611f, 0.716609001f},
-std::array<float,2>{0.0654981062f, 0.092077896f},
-std::array<float,2>{0.82703346f, 0.223179191f},
-std::array<float,2>{0.17469576f, 0.581394494f},
-std::array<float,2>{0.501492202f, 0.82693702f},
-std::array<float,2>{0.302011549f, 0.433704823f},
-std::array<float,2>{0.56872654f, 0.0200552214f},
-std::array<float,2>{0.319175482f, 0.626206815f},
-std::array<float,2>{0.805716455f, 0.882822931f},
-std::array<float,2>{0.22567153f, 0.251040012f},
-std::array<float,2>{0.997872949f, 0.483319134f},
-std::array<float,2>{0.0245124921f, 0.799392283f},
-std::array<float,2>{0.697268009f, 0.516512811f},
-std::array<float,2>{0.461069047f, 0.170307741f},
-std::array<float,2>{0.55449003f, 0.381512225f},
-std::array<float,2>{0.257543623f, 0.872575283f},
-std::array<float,2>{0.865502417f, 0.622179687f},
-std::array<float,2>{0.127295285f, 0.200547561f},
-std::array<float,2>{0.907351434f, 0.118531518f},
-std::array<float,2>{0.0981671363f, 0.720703721f},
-std::array<float,2>{0.650143981f, 0.949540973f},
-std::array<float,2>{0.39924112f, 0.318049282f},
-std::array<float,2>{0.720566332f, 0.144699097f},
-std::array<float,2>{0.482955486f, 0.536141872f},
-std::array<float,2>{0.946772993f, 0.776382387f},
-std::array<float,2>{0.0455634557f, 0.460968733f},
-std::array<float,2>{0.761743546f, 0.284367144f},
-std::array<float,2>{0.193636745f, 0.919501066f},
-std::array<float,2>{0.622008502f, 0.668506622f},
-std::array<float,2>{0.359081417f, 0.0504228994f},
-std::array<float,2>{0.655391574f, 0.499817848f},
-std::array<float,2>{0.402406782f, 0.783381462f},
-std::array<float,2>{0.910448492f, 0.507437229f},
-std::array<float,2>{0.096346654f, 0.178100899f},
-std::array<float,2>{0.862821996f, 0.00359980529f},
-std::array<float,2>{0.131792352f, 0.649549305f},
-std::array<float,2>{0.549730957f, 0.900239646f},
-std::array<float,2>{0.251822978f, 0.270154297f},
-std::array<float,2>{0.620851398f, 0.235567406f},
-std::array<float,2>{0.353655249f, 0.566048443f},
-std::array<float,2>{0.759135067f, 0.833474815f},
-std::array<float,2>{0.190335259f, 0.412993342f},
-std::array<float,2>{0.952330649f, 0.352194428f},
-std::array<float,2>{0.0412256867f, 0.981800199f},
-std::array<float,2>{0.723641515f, 0.699319959f},
-std::array<float,2>{0.477475256f, 0.064338617f},
-std::array<float,2>{0.50557512f, 0.30232498f},
-std::array<float,2>{0.299621999f, 0.936832786f},
-std::array<float,2>{0.823078454f, 0.68287766f},
-std::array<float,2>{0.178283855f, 0.0402169526f},
-std::array<float,2>{0.882040679f, 0.133782774f},
-std::array<float,2>{0.0671667308f, 0.555495441f},
-std::array<float,2>{0.656308532f, 0.757173359f},
-std::array<float,2>{0.422519475f, 0.438384563f},
-std::array<float,2>{0.700462282f, 0.102391608f},
-std::array<float,2>{0.467526257f, 0.740447164f},
-std::array<float,2>{0.992530644f, 0.957813323f},
-std::array<float,2>{0.0302451886f, 0.329132169f},
-std::array<float,2>{0.809350729f, 0.392626137f},
-std::array<float,2>{0.221792743f, 0.846559584f},
-std::array<float,2>{0.564567447f, 0.609229088f},
-std::array<float,2>{0.313697726f, 0.213737383f},
-std::array<float,2>{0.745678782f, 0.323887438f},
-std::array<float,2>{0.489549458f, 0.941911042f},
-std::array<float,2>{0.956668615f, 0.732957661f},
-std::array<float,2>{0.0474198572f, 0.113336653f},
-std::array<float,2>{0.772300959f, 0.187931687f},
-std::array<float,2>{0.206603184f, 0.616341531f},
-std::array<float,2>{0.60175848f, 0.860729873f},
-std::array<float,2>{0.370556563f, 0.388513774f},
-std::array<float,2>{0.541160107f, 0.0555708632f},
-std::array<float,2>{0.272780806f, 0.660847425f},
-std::array<float,2>{0.847628891f, 0.912775815f},
-std::array<float,2>{0.151615188f, 0.28938219f},
-std::array<float,2>{0.922970593f, 0.458876759f},
-std::array<float,2>{0.114363171f, 0.766552091f},
-std::array<float,2>{0.636653066f, 0.541416228f},
-std::array<float,2>{0.377984136f, 0.153057024f},
-std::array<float,2>{0.583205879f, 0.426481634f},
-std::array<float,2>{0.330189824f, 0.820199966f},
-std::array<float,2>{0.796544075f, 0.592646062f},
-std::array<float,2>{0.249341741f, 0.232258931f},
-std::array<float,2>{0.971809626f, 0.0817258507f},
-std::array<float,2>{0.0108579174f, 0.703280091f},
-std::array<float,2>{0.713147938f, 0.985326469f},
-std::array<float,2>{0.440960258f, 0.360520363f},
-std::array<float,2>{0.676939726f, 0.160251305f},
-std::array<float,2>{0.413193256f, 0.528592706f},
-std::array<float,2>{0.897282124f, 0.808193028f},
-std::array<float,2>{0.0793946758f, 0.472568631f},
-std::array<float,2>{0.835847914f, 0.262506902f},
-std::array<float,2>{0.16708298f, 0.880075932f},
-std::array<float,2>{0.529848039f, 0.639876068f},
-std::array<float,2>{0.287370354f, 0.0247835275f},
-std::array<float,2>{0.709123254f, 0.377184719f},
-std::array<float,2>{0.44682619f, 0.868874729f},
-std::array<float,2>{0.97824347f, 0.617561936f},
-std::array<float,2>{0.00453407736f, 0.19818899f},
-std::array<float,2>{0.786412895f, 0.121840373f},
-std::array<float,2>{0.241944999f, 0.72381109f},
-std::array<float,2>{0.592949927f, 0.945804536f},
-std::array<float,2>{0.342414349f, 0.31289649f},
-std::array<float,2>{0.518815339f, 0.141658515f},
-std::array<float,2>{0.29478547f, 0.531430542f},
-std::array<float,2>{0.837177157f, 0.77739197f},
-std::array<float,2>{0.16397503f, 0.46648258f},
-std::array<float,2>{0.898707509f, 0.289049864f},
-std::array<float,2>{0.0924196243f, 0.916617334f},
-std::array<float,2>{0.684032261f, 0.664160073f},
-std::array<float,2>{0.41745922f, 0.0543526448f},
-std::array<float,2>{0.599018335f, 0.371591508f},
-std::array<float,2>{0.365742892f, 0.992286086f},
-std::array<float,2>{0.779660046f, 0.711212814f},
-std::array<float,2>{0.216876194f, 0.0874995962f},
-std::array<float,2>{0.963662982f, 0.222270697f},
-std::array<float,2>{0.0550405942f, 0.582172275f},
-std::array<float,2>{0.741435289f, 0.821025908f},
-std::array<float,2>{0.493355721f, 0.429986179f},
-std::array<float,2>{0.628472984f, 0.0180663411f},
-std::array<float,2>{0.39023599f, 0.629080653f},
-std::array<float,2>{0.936985612f, 0.887962341f},
-std::array<float,2>{0.11993473f, 0.256034702f},
-std::array<float,2>{0.853885233f, 0.477462679f},
-std::array<float,2>{0.146684945f, 0.801625729f},
-std::array<float,2>{0.537582397f, 0.523293376f},
-std::array<float,2>{0.274305105f, 0.166597933f},
-std::array<float,2>{0.66662246f, 0.274145097f},
-std::array<float,2>{0.434296995f, 0.897200644f},
-std::array<float,2>{0.887492239f, 0.64734453f},
-std::array<float,2>{0.0736247525f, 0.00920708757f},
-std::array<float,2>{0.814649284f, 0.184381455f},
-std::array<float,2>{0.181677893f, 0.511751711f},
-std::array<float,2>{0.509141982f, 0.791883588f},
-std::array<float,2>{0.309992462f, 0.491372585f},
-std::array<float,2>{0.571701169f, 0.0758680552f},
-std::array<float,2>{0.321200073f, 0.689633787f},
-std::array<float,2>{0.801245034f, 0.969712317f},
-std::array<float,2>{0.226938754f, 0.344038904f},
-std::array<float,2>{0.987616658f, 0.41858843f},
-std::array<float,2>{0.0207570419f, 0.841012001f},
-std::array<float,2>{0.694074452f, 0.570761442f},
-std::array<float,2>{0.453446358f, 0.246773586f},
-std::array<float,2>{0.562224925f, 0.45092389f},
-std::array<float,2>{0.263035774f, 0.761537671f},
-std::array<float,2>{0.868576884f, 0.547412455f},
-std::array<float,2>{0.133949757f, 0.13164635f},
-std::array<float,2>{0.921242893f, 0.0370298214f},
-std::array<float,2>{0.10927102f, 0.675749779f},
-std::array<float,2>{0.6471259f, 0.928619266f},
-std::array<float,2>{0.398105025f, 0.306690305f},
-std::array<float,2>{0.733851373f, 0.20816496f},
-std::array<float,2>{0.473111808f, 0.598126531f},
-std::array<float,2>{0.940084517f, 0.852577984f},
-std::array<float,2>{0.0335447043f, 0.398831159f},
-std::array<float,2>{0.757530451f, 0.33939141f},
-std::array<float,2>{0.197106466f, 0.964505136f},
-std::array<float,2>{0.612424254f, 0.749028206f},
-std::array<float,2>{0.348143578f, 0.100087382f},
-std::array<float,2>{0.680845737f, 0.410046577f},
-std::array<float,2>{0.418533385f, 0.831612587f},
-std::array<float,2>{0.905922949f, 0.569842756f},
-std::array<float,2>{0.0869087726f, 0.238968804f},
-std::array<float,2>{0.840815902f, 0.0672335029f},
-std::array<float,2>{0.159415558f, 0.696507335f},
-std::array<float,2>{0.52179426f, 0.979820549f},
-std::array<float,2>{0.290551126f, 0.357906878f},
-std::array<float,2>{0.586021006f, 0.172842056f},
-std::array<float,2>{0.337317735f, 0.500093818f},
-std::array<float,2>{0.782356918f, 0.78662771f},
-std::array<float,2>{0.237257823f, 0.494891047f},
-std::array<float,2>{0.982100248f, 0.267967612f},
-std::array<float,2>{0.0022939248f, 0.904152572f},
-std::array<float,2>{0.706812322f, 0.653650999f},
-std::array<float,2>{0.450916588f, 0.00531371916f},
-std::array<float,2>{0.532365739f, 0.33498463f},
-std::array<float,2>{0.280940861f, 0.956704319f},
-std::array<float,2>{0.859226048f, 0.736998737f},
-std::array<float,2>{0.141687527f, 0.105533093f},
-std::array<float,2>{0.930057108f, 0.218089715f},
-std::array<float,2>{0.121802352f, 0.604358554f},
-std::array<float,2>{0.629580259f, 0.851544142f},
-std::array<float,2>{0.385466546f, 0.398040771f},
-std::array<float,2>{0.736828029f, 0.0438461639f},
-std::array<float,2>{0.499001741f, 0.683759332f},
-std::array<float,2>{0.967093349f, 0.933238506f},
-std::array<float,2>{0.0602418073f, 0.30019787f},
-std::array<float,2>{0.776835263f, 0.441733658f},
-std::array<float,2>{0.213409379f, 0.753728032f},
-std::array<float,2>{0.597043574f, 0.561047614f},
-std::array<float,2>{0.360036224f, 0.139530733f},
-std::array<float,2>{0.690069437f, 0.294163465f},
-std::array<float,2>{0.460048288f, 0.909742594f},
-std::array<float,2>{0.990755737f, 0.65834111f},
-std::array<float,2>{0.0187125765f, 0.0610409193f},
-std::array<float,2>{0.799054027f, 0.152196646f},
-std::array<float,2>{0.231534645f, 0.544546127f},
-std::array<float,2>{0.575739205f, 0.770076632f},
-std::array<float,2>{0.325546265f, 0.454845786f},
-std::array<float,2>{0.512819588f, 0.113088183f},
-std::array<float,2>{0.307330966f, 0.727696836f},
-std::array<float,2>{0.819221914f, 0.940707445f},
-std::array<float,2>{0.185353428f, 0.32726723f},
-std::array<float,2>{0.886432707f, 0.386433065f},
-std::array<float,2>{0.0764372647f, 0.866817951f},
-std::array<float,2>{0.668765187f, 0.612108827f},
-std::array<float,2>{0.433043122f, 0.19468978f},
-std::array<float,2>{0.616351247f, 0.47533536f},
-std::array<float,2>{0.345794201f, 0.809739947f},
-std::array<float,2>{0.751709163f, 0.527339399f},
-std::array<float,2>{0.199763492f, 0.157457247f},
-std::array<float,2>{0.943307221f, 0.0281759687f},
-std::array<float,2>{0.0380454808f, 0.635551155f},
-std::array<float,2>{0.728885531f, 0.877597988f},
-std::array<float,2>{0.471248984f, 0.258079439f},
-std::array<float,2>{0.643391728f, 0.226709709f},
-std::array<float,2>{0.393470883f, 0.588511884f},
-std::array<float,2>{0.917312145f, 0.815604687f},
-std::array<float,2>{0.103977934f, 0.42381838f},
-std::array<float,2>{0.873018563f, 0.366624087f},
-std::array<float,2>{0.138405383f, 0.989123642f},
-std::array<float,2>{0.558382511f, 0.708691955f},
-std::array<float,2>{0.260315746f, 0.082100302f},
-std::array<float,2>{0.721074402f, 0.462038845f},
-std::array<float,2>{0.480943233f, 0.776038587f},
-std::array<float,2>{0.947384179f, 0.535857022f},
-std::array<float,2>{0.0447124504f, 0.1462989f},
-std::array<float,2>{0.76487416f, 0.0497736894f},
-std::array<float,2>{0.191552565f, 0.669834256f},
-std::array<float,2>{0.623611689f, 0.918106258f},
-std::array<float,2>{0.35675633f, 0.283636361f},
-std::array<float,2>{0.552499354f, 0.200112775f},
-std::array<float,2>{0.25476405f, 0.62158531f},
-std::array<float,2>{0.864635348f, 0.871161997f},
-std::array<float,2>{0.125342935f, 0.38243258f},
-std::array<float,2>{0.908248246f, 0.317133069f},
-std::array<float,2>{0.100250959f, 0.950927854f},
-std::array<float,2>{0.651767373f, 0.722477138f},
-std::array<float,2>{0.401753247f, 0.117965236f},
-std::array<float,2>{0.566999137f, 0.250428587f},
-std::array<float,2>{0.316891611f, 0.884092808f},
-std::array<float,2>{0.806936204f, 0.625305653f},
-std::array<float,2>{0.224194154f, 0.021139387f},
-std::array<float,2>{0.998737693f, 0.17137745f},
-std::array<float,2>{0.0257716253f, 0.516923726f},
-std::array<float,2>{0.695739567f, 0.800664544f},
-std::array<float,2>{0.464360863f, 0.483743638f},
-std::array<float,2>{0.660614729f, 0.0935149565f},
-std::array<float,2>{0.429639012f, 0.715087712f},
-std::array<float,2>{0.877810359f, 0.996711135f},
-std::array<float,2>{0.0635904074f, 0.369402826f},
-std::array<float,2>{0.824562311f, 0.434681147f},
-std::array<float,2>{0.173218265f, 0.827881753f},
-std::array<float,2>{0.503319204f, 0.580508649f},
-std::array<float,2>{0.303221971f, 0.223782286f},
-std::array<float,2>{0.638696074f, 0.351503104f},
-std::array<float,2>{0.382400155f, 0.973566055f},
-std::array<float,2>{0.92783308f, 0.695030034f},
-std::array<float,2>{0.11074166f, 0.0727936029f},
-std::array<float,2>{0.85002178f, 0.242815152f},
-std::array<float,2>{0.155182511f, 0.574318171f},
-std::array<float,2>{0.543851674f, 0.838334382f},
-std::array<float,2>{0.268855482f, 0.415331095f},
-std::array<float,2>{0.606870592f, 0.0147467777f},
-std::array<float,2>{0.371421009f, 0.64217329f},
-std::array<float,2>{0.768485069f, 0.893813968f},
-std::array<float,2>{0.209149331f, 0.280116111f},
-std::array<float,2>{0.957486749f, 0.485574037f},
-std::array<float,2>{0.0538695566f, 0.795594513f},
-std::array<float,2>{0.747160017f, 0.507822275f},
-std::array<float,2>{0.485041916f, 0.180126041f},
-std::array<float,2>{0.525262296f, 0.405656725f},
-std::array<float,2>{0.283986777f, 0.859200716f},
-std::array<float,2>{0.829365194f, 0.596810102f},
-std::array<float,2>{0.168683454f, 0.203145355f},
-std::array<float,2>{0.89263016f, 0.0953075215f},
-std::array<float,2>{0.0850139633f, 0.744178832f},
-std::array<float,2>{0.673311651f, 0.968049169f},
-std::array<float,2>{0.409438491f, 0.343126476f},
-std::array<float,2>{0.717328429f, 0.125818282f},
-std::array<float,2>{0.441655993f, 0.553266406f},
-std::array<float,2>{0.975574136f, 0.763604581f},
-std::array<float,2>{0.0154768461f, 0.446343184f},
-std::array<float,2>{0.791124344f, 0.309915006f},
-std::array<float,2>{0.242562532f, 0.922590077f},
-std::array<float,2>{0.580001116f, 0.676787734f},
-std::array<float,2>{0.333919793f, 0.0323438682f},
-std::array<float,2>{0.65853399f, 0.440519094f},
-std::array<float,2>{0.425158858f, 0.75470978f},
-std::array<float,2>{0.880198836f, 0.557356298f},
-std::array<float,2>{0.0690170527f, 0.136133835f},
-std::array<float,2>{0.820914209f, 0.0411394611f},
-std::array<float,2>{0.176203847f, 0.6804654f},
-std::array<float,2>{0.506593585f, 0.934408307f},
-std::array<float,2>{0.298150003f, 0.303842962f},
-std::array<float,2>{0.563207686f, 0.212606966f},
-std::array<float,2>{0.315484792f, 0.607388318f},
-std::array<float,2>{0.812436402f, 0.8446033f},
-std::array<float,2>{0.220520601f, 0.392425478f},
-std::array<float,2>{0.994230866f, 0.331864178f},
-std::array<float,2>{0.0292138215f, 0.959062099f},
-std::array<float,2>{0.702333212f, 0.739822626f},
-std::array<float,2>{0.465413481f, 0.104676686f},
-std::array<float,2>{0.548417091f, 0.272916377f},
-std::array<float,2>{0.253014237f, 0.900953412f},
-std::array<float,2>{0.861155391f, 0.652281761f},
-std::array<float,2>{0.130253792f, 0.00062980951f},
-std::array<float,2>{0.913597584f, 0.176838949f},
-std::array<float,2>{0.0951684564f, 0.504067421f},
-std::array<float,2>{0.653509378f, 0.782065988f},
-std::array<float,2>{0.404705495f, 0.497938842f},
-std::array<float,2>{0.726299882f, 0.0651895553f},
-std::array<float,2>{0.47961545f, 0.701272666f},
-std::array<float,2>{0.949266374f, 0.983552992f},
-std::array<float,2>{0.0394909009f, 0.354407847f},
-std::array<float,2>{0.760658085f, 0.41138944f},
-std::array<float,2>{0.188911527f, 0.834339738f},
-std::array<float,2>{0.617920578f, 0.563594043f},
-std::array<float,2>{0.351599962f, 0.23702012f},
-std::array<float,2>{0.711424708f, 0.362855673f},
-std::array<float,2>{0.43841204f, 0.986853123f},
-std::array<float,2>{0.970193624f, 0.705606103f},
-std::array<float,2>{0.008267086f, 0.078334406f},
-std::array<float,2>{0.794676185f, 0.233489871f},
-std::array<float,2>{0.247458994f, 0.59112519f},
-std::array<float,2>{0.584981978f, 0.817252159f},
-std::array<float,2>{0.329163343f, 0.429155171f},
-std::array<float,2>{0.527676761f, 0.0271992236f},
-std::array<float,2>{0.285430491f, 0.637953281f},
-std::array<float,2>{0.833318889f, 0.880984068f},
-std::array<float,2>{0.164084211f, 0.26506561f},
-std::array<float,2>{0.894708931f, 0.469407648f},
-std::array<float,2>{0.0819696113f, 0.805522323f},
-std::array<float,2>{0.679670393f, 0.529962659f},
-std::array<float,2>{0.411368281f, 0.16398479f},
-std::array<float,2>{0.604100883f, 0.390609324f},
-std::array<float,2>{0.368320167f, 0.862666607f},
-std::array<float,2>{0.770704448f, 0.61497283f},
-std::array<float,2>{0.203207389f, 0.190900892f},
-std::array<float,2>{0.95480895f, 0.117184572f},
-std::array<float,2>{0.0504330881f, 0.73065424f},
-std::array<float,2>{0.743591011f, 0.945248485f},
-std::array<float,2>{0.490566015f, 0.320391685f},
-std::array<float,2>{0.634036601f, 0.155932769f},
-std::array<float,2>{0.376569271f, 0.540241182f},
-std::array<float,2>{0.924880922f, 0.768154323f},
-std::array<float,2>{0.117183208f, 0.460855275f},
-std::array<float,2>{0.84438765f, 0.292933613f},
-std::array<float,2>{0.149963096f, 0.911665618f},
-std::array<float,2>{0.540498495f, 0.662564933f},
-std::array<float,2>{0.270420432f, 0.0570540577f},
-std::array<float,2>{0.739688098f, 0.432658643f},
-std::array<float,2>{0.495552808f, 0.822537899f},
-std::array<float,2>{0.962817311f, 0.585265338f},
-std::array<float,2>{0.0579653569f, 0.219753399f},
-std::array<float,2>{0.778729558f, 0.0880946815f},
-std::array<float,2>{0.215161145f, 0.713028193f},
-std::array<float,2>{0.599642634f, 0.994881868f},
-std::array<float,2>{0.363286555f, 0.374972999f},
-std::array<float,2>{0.536855102f, 0.165213138f},
-std::array<float,2>{0.277110428f, 0.520762086f},
-std::array<float,2>{0.852918625f, 0.80466944f},
-std::array<float,2>{0.144842044f, 0.478713959f},
-std::array<float,2>{0.93469429f, 0.255242258f},
-std::array<float,2>{0.118674569f, 0.89037627f},
-std::array<float,2>{0.625992f, 0.631166875f},
-std::array<float,2>{0.387951404f, 0.0157765131f},
-std::array<float,2>{0.591250479f, 0.315606385f},
-std::array<float,2>{0.340597898f, 0.948102891f},
-std::array<float,2>{0.788278639f, 0.725330412f},
-std::array<float,2>{0.238946855f, 0.124416828f},
-std::array<float,2>{0.979296744f, 0.195890665f},
-std::array<float,2>{0.00619924301f, 0.62000823f},
-std::array<float,2>{0.707304716f, 0.869432271f},
-std::array<float,2>{0.44763276f, 0.375497431f},
-std::array<float,2>{0.686627448f, 0.0511594117f},
-std::array<float,2>{0.414856136f, 0.667126775f},
-std::array<float,2>{0.902145982f, 0.915895104f},
-std::array<float,2>{0.0916029066f, 0.286232442f},
-std::array<float,2>{0.839616716f, 0.468385339f},
-std::array<float,2>{0.160789326f, 0.780073285f},
-std::array<float,2>{0.515883923f, 0.534528315f},
-std::array<float,2>{0.296682f, 0.14281103f},
-std::array<float,2>{0.645388603f, 0.305793941f},
-std::array<float,2>{0.396155953f, 0.926130176f},
-std::array<float,2>{0.918374598f, 0.672717452f},
-std::array<float,2>{0.105986118f, 0.0375368521f},
-std::array<float,2>{0.871088982f, 0.129569814f},
-std::array<float,2>{0.134864494f, 0.549326181f},
-std::array<float,2>{0.558782518f, 0.75848335f},
-std::array<float,2>{0.263674229f, 0.451426417f},
-std::array<float,2>{0.610858381f, 0.0995347574f},
-std::array<float,2>{0.349692047f, 0.747634709f},
-std::array<float,2>{0.754082978f, 0.961104989f},
-std::array<float,2>{0.197675616f, 0.336629152f},
-std::array<float,2>{0.938043475f, 0.400893599f},
-std::array<float,2>{0.0316250101f, 0.855329096f},
-std::array<float,2>{0.730530798f, 0.600615978f},
-std::array<float,2>{0.474650562f, 0.209388122f},
-std::array<float,2>{0.510849178f, 0.490063936f},
-std::array<float,2>{0.311302751f, 0.789853275f},
-std::array<float,2>{0.812913656f, 0.51481545f},
-std::array<float,2>{0.180411145f, 0.185973585f},
-std::array<float,2>{0.889676273f, 0.01122835f},
-std::array<float,2>{0.0720940083f, 0.644818068f},
-std::array<float,2>{0.665491998f, 0.895918608f},
-std::array<float,2>{0.436920315f, 0.277116686f},
-std::array<float,2>{0.692096949f, 0.249524757f},
-std::array<float,2>{0.456837714f, 0.572961867f},
-std::array<float,2>{0.986221731f, 0.842502594f},
-std::array<float,2>{0.0228711162f, 0.420574456f},
-std::array<float,2>{0.804585695f, 0.346051276f},
-std::array<float,2>{0.22866495f, 0.971242607f},
-std::array<float,2>{0.573168755f, 0.688914418f},
-std::array<float,2>{0.323186845f, 0.0766225308f},
-std::array<float,2>{0.632558167f, 0.395625949f},
-std::array<float,2>{0.383435369f, 0.847850263f},
-std::array<float,2>{0.932425141f, 0.601903677f},
-std::array<float,2>{0.12353994f, 0.21554929f},
-std::array<float,2>{0.857338488f, 0.109237149f},
-std::array<float,2>{0.143575534f, 0.734413028f},
-std::array<float,2>{0.534186244f, 0.955024898f},
-std::array<float,2>{0.277388453f, 0.332252085f},
-std::array<float,2>{0.594165862f, 0.136900052f},
-std::array<float,2>{0.36205247f, 0.559741676f},
-std::array<float,2>{0.775155962f, 0.751836002f},
-std::array<float,2>{0.212438866f, 0.444897592f},
-std::array<float,2>{0.965290964f, 0.297877878f},
-std::array<float,2>{0.0608312972f, 0.930782139f},
-std::array<float,2>{0.73464644f, 0.686507523f},
-std::array<float,2>{0.497669339f, 0.0464693047f},
-std::array<float,2>{0.521409214f, 0.356155425f},
-std::array<float,2>{0.292675078f, 0.977078974f},
-std::array<float,2>{0.842995942f, 0.699208677f},
-std::array<float,2>{0.157222286f, 0.0695955306f},
-std::array<float,2>{0.903631032f, 0.240515634f},
-std::array<float,2>{0.0880532637f, 0.56807065f},
-std::array<float,2>{0.682573736f, 0.828948915f},
-std::array<float,2>{0.420333982f, 0.407019049f},
-std::array<float,2>{0.70364368f, 0.00727484981f},
-std::array<float,2>{0.45252949f, 0.656084716f},
-std::array<float,2>{0.98357141f, 0.905496538f},
-std::array<float,2>{0.000367292087f, 0.266521245f},
-std::array<float,2>{0.784397602f, 0.493614614f},
-std::array<float,2>{0.236070216f, 0.787864208f},
-std::array<float,2>{0.588050365f, 0.5030514f},
-std::array<float,2>{0.338490248f, 0.17464304f},
-std::array<float,2>{0.72722435f, 0.261056423f},
-std::array<float,2>{0.469861418f, 0.87563467f},
-std::array<float,2>{0.944354057f, 0.63344866f},
-std::array<float,2>{0.0370429568f, 0.0295766257f},
-std::array<float,2>{0.752623558f, 0.160051674f},
-std::array<float,2>{0.202773735f, 0.524079204f},
-std::array<float,2>{0.613645256f, 0.811962545f},
-std::array<float,2>{0.345594883f, 0.473279387f},
-std::array<float,2>{0.555127859f, 0.0852169842f},
-std::array<float,2>{0.259047627f, 0.709866822f},
-std::array<float,2>{0.873751819f, 0.991302192f},
-std::array<float,2>{0.139666274f, 0.364859402f},
-std::array<float,2>{0.915871799f, 0.423985362f},
-std::array<float,2>{0.103306271f, 0.812573195f},
-std::array<float,2>{0.641580939f, 0.587758064f},
-std::array<float,2>{0.390906334f, 0.229859546f},
-std::array<float,2>{0.577470005f, 0.456093848f},
-std::array<float,2>{0.327409416f, 0.773361444f},
-std::array<float,2>{0.798688412f, 0.546506226f},
-std::array<float,2>{0.233978108f, 0.149310783f},
-std::array<float,2>{0.988404334f, 0.0601327606f},
-std::array<float,2>{0.0169456322f, 0.657131314f},
-std::array<float,2>{0.689336836f, 0.906965554f},
-std::array<float,2>{0.457033396f, 0.295207232f},
-std::array<float,2>{0.671791792f, 0.191857979f},
-std::array<float,2>{0.429806054f, 0.611097753f},
-std::array<float,2>{0.884509623f, 0.863327026f},
-std::array<float,2>{0.0759670809f, 0.383017957f},
-std::array<float,2>{0.817016482f, 0.32452026f},
-std::array<float,2>{0.186952516f, 0.938517988f},
-std::array<float,2>{0.51423043f, 0.729871452f},
-std::array<float,2>{0.305820614f, 0.111109309f},
-std::array<float,2>{0.698617876f, 0.481611103f},
-std::array<float,2>{0.462834358f, 0.797316313f},
-std::array<float,2>{0.996253014f, 0.518114328f},
-std::array<float,2>{0.0241835453f, 0.169316962f},
-std::array<float,2>{0.805637658f, 0.0231192484f},
-std::array<float,2>{0.224663407f, 0.628146172f},
-std::array<float,2>{0.569634378f, 0.885067105f},
-std::array<float,2>{0.319661319f, 0.252654076f},
-std::array<float,2>{0.500331759f, 0.225000709f},
-std::array<float,2>{0.300949365f, 0.579669654f},
-std::array<float,2>{0.827255845f, 0.825863421f},
-std::array<float,2>{0.175083667f, 0.437279522f},
-std::array<float,2>{0.875851274f, 0.368429452f},
-std::array<float,2>{0.0647765025f, 0.998528898f},
-std::array<float,2>{0.6630494f, 0.717147589f},
-std::array<float,2>{0.425802439f, 0.0915519148f},
-std::array<float,2>{0.622578561f, 0.281908572f},
-std::array<float,2>{0.357616007f, 0.921158552f},
-std::array<float,2>{0.763211131f, 0.670090437f},
-std::array<float,2>{0.19502762f, 0.0473744124f},
-std::array<float,2>{0.945974886f, 0.146990031f},
-std::array<float,2>{0.0464867763f, 0.539014041f},
-std::array<float,2>{0.718907833f, 0.774959028f},
-std::array<float,2>{0.483724743f, 0.464294583f},
-std::array<float,2>{0.648968399f, 0.11952877f},
-std::array<float,2>{0.39987126f, 0.719672143f},
-std::array<float,2>{0.906937361f, 0.952570021f},
-std::array<float,2>{0.0991928726f, 0.319819868f},
-std::array<float,2>{0.867004335f, 0.37935096f},
-std::array<float,2>{0.128324583f, 0.873861194f},
-std::array<float,2>{0.552991033f, 0.62311244f},
-std::array<float,2>{0.256419927f, 0.202408686f},
-std::array<float,2>{0.67524308f, 0.340701967f},
-std::array<float,2>{0.406798542f, 0.965827227f},
-std::array<float,2>{0.89234221f, 0.7438941f},
-std::array<float,2>{0.0826805979f, 0.0958838537f},
-std::array<float,2>{0.831991851f, 0.20587106f},
-std::array<float,2>{0.171365514f, 0.594985604f},
-std::array<float,2>{0.526269197f, 0.856282651f},
-std::array<float,2>{0.282504201f, 0.404026806f},
-std::array<float,2>{0.58186239f, 0.0333290845f},
-std::array<float,2>{0.33490774f, 0.677926838f},
-std::array<float,2>{0.790419519f, 0.924632609f},
-std::array<float,2>{0.245378479f, 0.311024666f},
-std::array<float,2>{0.973228455f, 0.448547482f},
-std::array<float,2>{0.0131341312f, 0.765317857f},
-std::array<float,2>{0.714967847f, 0.550874412f},
-std::array<float,2>{0.444711328f, 0.128054634f},
-std::array<float,2>{0.546627998f, 0.416605085f},
-std::array<float,2>{0.266233742f, 0.836379588f},
-std::array<float,2>{0.847710788f, 0.577158272f},
-std::array<float,2>{0.153452516f, 0.244432807f},
-std::array<float,2>{0.926454008f, 0.0711323172f},
-std::array<float,2>{0.111564003f, 0.693032146f},
-std::array<float,2>{0.638477683f, 0.975276232f},
-std::array<float,2>{0.379797667f, 0.349402457f},
-std::array<float,2>{0.749799728f, 0.181834906f},
-std::array<float,2>{0.486723781f, 0.509891152f},
-std::array<float,2>{0.959753215f, 0.794371545f},
-std::array<float,2>{0.0514663868f, 0.486864358f},
-std::array<float,2>{0.766424358f, 0.277426332f},
-std::array<float,2>{0.20717293f, 0.8916924f},
-std::array<float,2>{0.608947515f, 0.643081725f},
-std::array<float,2>{0.373845458f, 0.0123689007f},
-std::array<float,2>{0.646810889f, 0.451691598f},
-std::array<float,2>{0.397818446f, 0.758283496f},
-std::array<float,2>{0.921469986f, 0.548899174f},
-std::array<float,2>{0.108452521f, 0.129018068f},
-std::array<float,2>{0.868656516f, 0.0379047841f},
-std::array<float,2>{0.134609461f, 0.672256351f},
-std::array<float,2>{0.561646461f, 0.926344097f},
-std::array<float,2>{0.26346001f, 0.306234539f},
-std::array<float,2>{0.612812698f, 0.209718078f},
-std::array<float,2>{0.34850347f, 0.601300776f},
-std::array<float,2>{0.756870866f, 0.854594111f},
-std::array<float,2>{0.196716636f, 0.400441229f},
-std::array<float,2>{0.939642608f, 0.336003333f},
-std::array<float,2>{0.033722505f, 0.961532295f},
-std::array<float,2>{0.733922362f, 0.747468531f},
-std::array<float,2>{0.473607451f, 0.0986475497f},
-std::array<float,2>{0.509412348f, 0.276562929f},
-std::array<float,2>{0.310484082f, 0.896197796f},
-std::array<float,2>{0.815356195f, 0.64536649f},
-std::array<float,2>{0.182276338f, 0.0114165107f},
-std::array<float,2>{0.886730194f, 0.186071262f},
-std::array<float,2>{0.0739002824f, 0.51544255f},
-std::array<float,2>{0.666287065f, 0.789464235f},
-std::array<float,2>{0.433662772f, 0.489373595f},
-std::array<float,2>{0.693664551f, 0.0768456385f},
-std::array<float,2>{0.453963012f, 0.689235687f},
-std::array<float,2>{0.988215446f, 0.971115172f},
-std::array<float,2>{0.0213210937f, 0.346505076f},
-std::array<float,2>{0.801719964f, 0.420094788f},
-std::array<float,2>{0.227113932f, 0.842173934f},
-std::array<float,2>{0.572006702f, 0.572388947f},
-std::array<float,2>{0.320723921f, 0.249398366f},
-std::array<float,2>{0.741827667f, 0.374384403f},
-std::array<float,2>{0.493659526f, 0.994476736f},
-std::array<float,2>{0.963251114f, 0.713500142f},
-std::array<float,2>{0.055270046f, 0.0884359926f},
-std::array<float,2>{0.779862821f, 0.220215976f},
-std::array<float,2>{0.217565387f, 0.585915565f},
-std::array<float,2>{0.599365711f, 0.823038161f},
-std::array<float,2>{0.365485132f, 0.433465242f},
-std::array<float,2>{0.537947059f, 0.0163252857f},
-std::array<float,2>{0.273749858f, 0.631687045f},
-std::array<float,2>{0.854286849f, 0.890134871f},
-std::array<float,2>{0.147130847f, 0.255577922f},
-std::array<float,2>{0.937464118f, 0.479330719f},
-std::array<float,2>{0.119519204f, 0.804195702f},
-std::array<float,2>{0.628297091f, 0.521325529f},
-std::array<float,2>{0.389797747f, 0.165529028f},
-std::array<float,2>{0.593597531f, 0.375192642f},
-std::array<float,2>{0.342126042f, 0.86994803f},
-std::array<float,2>{0.786995173f, 0.61926198f},
-std::array<float,2>{0.241697028f, 0.195622727f},
-std::array<float,2>{0.97796905f, 0.124648653f},
-std::array<float,2>{0.00432451069f, 0.724852383f},
-std::array<float,2>{0.709490418f, 0.947481036f},
-std::array<float,2>{0.446710736f, 0.316203773f},
-std::array<float,2>{0.684440196f, 0.143517271f},
-std::array<float,2>{0.41784966f, 0.534843981f},
-std::array<float,2>{0.899146318f, 0.779771149f},
-std::array<float,2>{0.0921249911f, 0.468166828f},
-std::array<float,2>{0.837708473f, 0.286826581f},
-std::array<float,2>{0.163094267f, 0.915244699f},
-std::array<float,2>{0.519087613f, 0.667836726f},
-std::array<float,2>{0.293965846f, 0.0516257286f},
-std::array<float,2>{0.713638544f, 0.42942062f},
-std::array<float,2>{0.440600753f, 0.816473246f},
-std::array<float,2>{0.972519457f, 0.591456294f},
-std::array<float,2>{0.0112665258f, 0.234373704f},
-std::array<float,2>{0.79619348f, 0.0787983015f},
-std::array<float,2>{0.249851838f, 0.705385566f},
-std::array<float,2>{0.583530784f, 0.986599922f},
-std::array<float,2>{0.330936164f, 0.362544686f},
-std::array<float,2>{0.52975136f, 0.163168743f},
-std::array<float,2>{0.287911534f, 0.529533267f},
-std::array<float,2>{0.834991992f, 0.804968834f},
-std::array<float,2>{0.167770028f, 0.468979985f},
-std::array<float,2>{0.896684885f, 0.265190125f},
-std::array<float,2>{0.0799416155f, 0.881655097f},
-std::array<float,2>{0.677646399f, 0.638354838f},
-std::array<float,2>{0.413671017f, 0.0267703831f},
-std::array<float,2>{0.602534533f, 0.320825517f},
-std::array<float,2>{0.37095359f, 0.944407821f},
-std::array<float,2>{0.771924078f, 0.730976284f},
-std::array<float,2>{0.206405282f, 0.116424575f},
-std::array<float,2>{0.95607096f, 0.190974131f},
-std::array<float,2>{0.0470171608f, 0.61455375f},
-std::array<float,2>{0.74540025f, 0.863271713f},
-std::array<float,2>{0.490089297f, 0.390063912f},
-std::array<float,2>{0.635777771f, 0.0573038571f},
-std::array<float,2>{0.378623873f, 0.662830949f},
-std::array<float,2>{0.923672855f, 0.911432505f},
-std::array<float,2>{0.115147427f, 0.292322487f},
-std::array<float,2>{0.847039819f, 0.460218132f},
-std::array<float,2>{0.151859537f, 0.767617643f},
-std::array<float,2>{0.541519761f, 0.540877104f},
-std::array<float,2>{0.273014486f, 0.155286014f},
-std::array<float,2>{0.656793892f, 0.304670304f},
-std::array<float,2>{0.422146082f, 0.9340657f},
-std::array<float,2>{0.882628381f, 0.67986387f},
-std::array<float,2>{0.0664081424f, 0.0418901965f},
-std::array<float,2>{0.822493911f, 0.13628529f},
-std::array<float,2>{0.177795514f, 0.556955636f},
-std::array<float,2>{0.505217195f, 0.754267991f},
-std::array<float,2>{0.299282134f, 0.44139266f},
-std::array<float,2>{0.56536901f, 0.1053994f},
-std::array<float,2>{0.314432859f, 0.739584386f},
-std::array<float,2>{0.808911741f, 0.959593058f},
-std::array<float,2>{0.222291186f, 0.331099302f},
-std::array<float,2>{0.992742658f, 0.391879141f},
-std::array<float,2>{0.0296059679f, 0.84406364f},
-std::array<float,2>{0.700956166f, 0.606697798f},
-std::array<float,2>{0.467089266f, 0.212285176f},
-std::array<float,2>{0.548980951f, 0.497474521f},
-std::array<float,2>{0.251158416f, 0.781314254f},
-std::array<float,2>{0.862466991f, 0.504706085f},
-std::array<float,2>{0.131318092f, 0.177646935f},
-std::array<float,2>{0.910658717f, 0.000474507804f},
-std::array<float,2>{0.0959044546f, 0.651642203f},
-std::array<float,2>{0.655922651f, 0.900867641f},
-std::array<float,2>{0.403274417f, 0.273164064f},
-std::array<float,2>{0.724195421f, 0.236351147f},
-std::array<float,2>{0.476957053f, 0.564103067f},
-std::array<float,2>{0.95285064f, 0.834797502f},
-std::array<float,2>{0.0417387336f, 0.41176194f},
-std::array<float,2>{0.759326279f, 0.353964984f},
-std::array<float,2>{0.189508513f, 0.984076023f},
-std::array<float,2>{0.620514214f, 0.701986074f},
-std::array<float,2>{0.35438171f, 0.0645438135f},
-std::array<float,2>{0.673548043f, 0.40347141f},
-std::array<float,2>{0.410013407f, 0.85587585f},
-std::array<float,2>{0.893213093f, 0.595592082f},
-std::array<float,2>{0.08548069f, 0.205154762f},
-std::array<float,2>{0.82970041f, 0.0965180248f},
-std::array<float,2>{0.168360904f, 0.743263841f},
-std::array<float,2>{0.52468574f, 0.96647346f},
-std::array<float,2>{0.283209294f, 0.340045393f},
-std::array<float,2>{0.579281151f, 0.128827393f},
-std::array<float,2>{0.333284348f, 0.551578701f},
-std::array<float,2>{0.791546881f, 0.764807403f},
-std::array<float,2>{0.242793068f, 0.449021786f},
-std::array<float,2>{0.974834979f, 0.311102033f},
-std::array<float,2>{0.0148516307f, 0.924191535f},
-std::array<float,2>{0.71701467f, 0.678708196f},
-std::array<float,2>{0.441899478f, 0.0338868052f},
-std::array<float,2>{0.543090343f, 0.348878801f},
-std::array<float,2>{0.269530952f, 0.974618673f},
-std::array<float,2>{0.850344598f, 0.69238925f},
-std::array<float,2>{0.154736295f, 0.0705327094f},
-std::array<float,2>{0.928411007f, 0.244661376f},
-std::array<float,2>{0.110902108f, 0.577951491f},
-std::array<float,2>{0.639184058f, 0.836723983f},
-std::array<float,2>{0.382283062f, 0.416478068f},
-std::array<float,2>{0.747715592f, 0.012163084f},
-std::array<float,2>{0.48449707f, 0.642972529f},
-std::array<float,2>{0.957601309f, 0.892121196f},
-std::array<float,2>{0.0545455925f, 0.278283417f},
-std::array<float,2>{0.767846406f, 0.486766219f},
-std::array<float,2>{0.209531546f, 0.794456124f},
-std::array<float,2>{0.606969297f, 0.5102548f},
-std::array<float,2>{0.371676683f, 0.182198405f},
-std::array<float,2>{0.695870101f, 0.252035558f},
-std::array<float,2>{0.463876814f, 0.885280609f},
-std::array<float,2>{0.998395801f, 0.628757119f},
-std::array<float,2>{0.0259254538f, 0.0225581918f},
-std::array<float,2>{0.807478726f, 0.169535145f},
-std::array<float,2>{0.223911017f, 0.517646074f},
-std::array<float,2>{0.566683352f, 0.797607362f},
-std::array<float,2>{0.31736058f, 0.482146293f},
-std::array<float,2>{0.503802299f, 0.0910710096f},
-std::array<float,2>{0.303571343f, 0.717753828f},
-std::array<float,2>{0.825122416f, 0.998722076f},
-std::array<float,2>{0.173700407f, 0.368750811f},
-std::array<float,2>{0.877011716f, 0.43668589f},
-std::array<float,2>{0.0640854537f, 0.825489104f},
-std::array<float,2>{0.661093891f, 0.579491258f},
-std::array<float,2>{0.429017276f, 0.225356653f},
-std::array<float,2>{0.623389304f, 0.464513093f},
-std::array<float,2>{0.357340276f, 0.774686456f},
-std::array<float,2>{0.765461028f, 0.538172841f},
-std::array<float,2>{0.192238793f, 0.146502987f},
-std::array<float,2>{0.948069334f, 0.0469503365f},
-std::array<float,2>{0.0443415344f, 0.670538187f},
-std::array<float,2>{0.721605241f, 0.921587348f},
-std::array<float,2>{0.481296897f, 0.281532794f},
-std::array<float,2>{0.65215987f, 0.202953428f},
-std::array<float,2>{0.402022272f, 0.623600185f},
-std::array<float,2>{0.908933342f, 0.873210609f},
-std::array<float,2>{0.099831678f, 0.379751354f},
-std::array<float,2>{0.864876866f, 0.320257723f},
-std::array<float,2>{0.125970989f, 0.9530496f},
-std::array<float,2>{0.551933825f, 0.719012201f},
-std::array<float,2>{0.254132837f, 0.120035976f},
-std::array<float,2>{0.729099691f, 0.472911447f},
-std::array<float,2>{0.470738113f, 0.812319756f},
-std::array<float,2>{0.942496836f, 0.523662746f},
-std::array<float,2>{0.0374641083f, 0.159294337f},
-std::array<float,2>{0.751108289f, 0.0299485344f},
-std::array<float,2>{0.199287951f, 0.633154511f},
-std::array<float,2>{0.616862774f, 0.875025153f},
-std::array<float,2>{0.346646041f, 0.261333704f},
-std::array<float,2>{0.557793498f, 0.230087683f},
-std::array<float,2>{0.260112554f, 0.58721149f},
-std::array<float,2>{0.872189283f, 0.813098669f},
-std::array<float,2>{0.137928948f, 0.424368322f},
-std::array<float,2>{0.917679131f, 0.364718139f},
-std::array<float,2>{0.104351275f, 0.991962254f},
-std::array<float,2>{0.642980754f, 0.70939815f},
-std::array<float,2>{0.393002093f, 0.0858863369f},
-std::array<float,2>{0.575362444f, 0.295761794f},
-std::array<float,2>{0.325826973f, 0.906441152f},
-std::array<float,2>{0.799467087f, 0.656468749f},
-std::array<float,2>{0.232121691f, 0.0599474236f},
-std::array<float,2>{0.990470171f, 0.148695394f},
-std::array<float,2>{0.0193588249f, 0.546038985f},
-std::array<float,2>{0.689594507f, 0.772717416f},
-std::array<float,2>{0.460458726f, 0.456549257f},
-std::array<float,2>{0.668420911f, 0.110491656f},
-std::array<float,2>{0.433581173f, 0.730004787f},
-std::array<float,2>{0.886185825f, 0.939168334f},
-std::array<float,2>{0.0770120472f, 0.324754924f},
-std::array<float,2>{0.818788528f, 0.383694142f},
-std::array<float,2>{0.184589997f, 0.86410135f},
-std::array<float,2>{0.513322413f, 0.610513568f},
-std::array<float,2>{0.306990385f, 0.192279652f},
-std::array<float,2>{0.629252732f, 0.332880259f},
-std::array<float,2>{0.384941429f, 0.954487324f},
-std::array<float,2>{0.930586278f, 0.734865487f},
-std::array<float,2>{0.121228784f, 0.108782269f},
-std::array<float,2>{0.858405709f, 0.215057328f},
-std::array<float,2>{0.142172098f, 0.602403462f},
-std::array<float,2>{0.532829165f, 0.848428726f},
-std::array<float,2>{0.280700833f, 0.39632535f},
-std::array<float,2>{0.597586453f, 0.0459311232f},
-std::array<float,2>{0.359789938f, 0.685695052f},
-std::array<float,2>{0.777269542f, 0.931165874f},
-std::array<float,2>{0.212954193f, 0.298772514f},
-std::array<float,2>{0.967289269f, 0.444808006f},
-std::array<float,2>{0.0595758185f, 0.751094282f},
-std::array<float,2>{0.736654878f, 0.560162067f},
-std::array<float,2>{0.498419732f, 0.137423187f},
-std::array<float,2>{0.522318244f, 0.406344354f},
-std::array<float,2>{0.2904751f, 0.828292906f},
-std::array<float,2>{0.839847267f, 0.567402661f},
-std::array<float,2>{0.159961849f, 0.240782112f},
-std::array<float,2>{0.905529201f, 0.0699823946f},
-std::array<float,2>{0.0862566307f, 0.698539793f},
-std::array<float,2>{0.681342661f, 0.976887286f},
-std::array<float,2>{0.418337375f, 0.355692714f},
-std::array<float,2>{0.706456125f, 0.174307659f},
-std::array<float,2>{0.45035547f, 0.503860354f},
-std::array<float,2>{0.981624067f, 0.787510693f},
-std::array<float,2>{0.00254768622f, 0.493891984f},
-std::array<float,2>{0.782815218f, 0.265897393f},
-std::array<float,2>{0.236604914f, 0.906008899f},
-std::array<float,2>{0.58661902f, 0.655536652f},
-std::array<float,2>{0.337870896f, 0.00737216743f},
-std::array<float,2>{0.665883899f, 0.491707683f},
-std::array<float,2>{0.437083453f, 0.791355908f},
-std::array<float,2>{0.890413702f, 0.512628257f},
-std::array<float,2>{0.0714425519f, 0.183733717f},
-std::array<float,2>{0.813161433f, 0.00971124694f},
-std::array<float,2>{0.179892197f, 0.646504045f},
-std::array<float,2>{0.5116871f, 0.896689415f},
-std::array<float,2>{0.310822427f, 0.273914307f},
-std::array<float,2>{0.572330296f, 0.246580973f},
-std::array<float,2>{0.322435647f, 0.570857346f},
-std::array<float,2>{0.803732872f, 0.841631174f},
-std::array<float,2>{0.229329556f, 0.418122351f},
-std::array<float,2>{0.985409737f, 0.344260097f},
-std::array<float,2>{0.0233505778f, 0.968913019f},
-std::array<float,2>{0.691529751f, 0.690208435f},
-std::array<float,2>{0.456202239f, 0.0755859241f},
-std::array<float,2>{0.559395194f, 0.307181656f},
-std::array<float,2>{0.264386147f, 0.927925944f},
-std::array<float,2>{0.870500207f, 0.675264657f},
-std::array<float,2>{0.13553004f, 0.0366023779f},
-std::array<float,2>{0.918872714f, 0.130875766f},
-std::array<float,2>{0.105572693f, 0.546911836f},
-std::array<float,2>{0.644594789f, 0.760797918f},
-std::array<float,2>{0.395689487f, 0.450376719f},
-std::array<float,2>{0.73119545f, 0.100286655f},
-std::array<float,2>{0.475524634f, 0.749783874f},
-std::array<float,2>{0.937750161f, 0.964118659f},
-std::array<float,2>{0.0320075043f, 0.339119643f},
-std::array<float,2>{0.754790783f, 0.398999542f},
-std::array<float,2>{0.198040098f, 0.853326917f},
-std::array<float,2>{0.610817254f, 0.598213673f},
-std::array<float,2>{0.350221932f, 0.208795846f},
-std::array<float,2>{0.707543194f, 0.313126326f},
-std::array<float,2>{0.44776994f, 0.945615888f},
-std::array<float,2>{0.978759408f, 0.724603534f},
-std::array<float,2>{0.00651142467f, 0.121333338f},
-std::array<float,2>{0.788934708f, 0.197669223f},
-std::array<float,2>{0.238386124f, 0.617709517f},
-std::array<float,2>{0.591772199f, 0.868325353f},
-std::array<float,2>{0.339955777f, 0.377465248f},
-std::array<float,2>{0.516393185f, 0.0540578626f},
-std::array<float,2>{0.29590708f, 0.66460216f},
-std::array<float,2>{0.838911176f, 0.916107476f},
-std::array<float,2>{0.160350859f, 0.288422436f},
-std::array<float,2>{0.901514828f, 0.465855122f},
-std::array<float,2>{0.0911514238f, 0.777889371f},
-std::array<float,2>{0.687476575f, 0.531818271f},
-std::array<float,2>{0.414113998f, 0.142429292f},
-std::array<float,2>{0.600429952f, 0.430271208f},
-std::array<float,2>{0.363826096f, 0.820474207f},
-std::array<float,2>{0.778818369f, 0.582608819f},
-std::array<float,2>{0.215547219f, 0.221918106f},
-std::array<float,2>{0.962014914f, 0.0869245157f},
-std::array<float,2>{0.0581660271f, 0.711447775f},
-std::array<float,2>{0.739858508f, 0.992789984f},
-std::array<float,2>{0.495881051f, 0.371315032f},
-std::array<float,2>{0.626901984f, 0.166272998f},
-std::array<float,2>{0.388279587f, 0.522769511f},
-std::array<float,2>{0.935328543f, 0.801013052f},
-std::array<float,2>{0.118630946f, 0.476625174f},
-std::array<float,2>{0.853440106f, 0.256769985f},
-std::array<float,2>{0.145486757f, 0.888670027f},
-std::array<float,2>{0.536443532f, 0.629493177f},
-std::array<float,2>{0.27677995f, 0.0183798354f},
-std::array<float,2>{0.743659735f, 0.387868404f},
-std::array<float,2>{0.490885466f, 0.860997617f},
-std::array<float,2>{0.954147518f, 0.616886854f},
-std::array<float,2>{0.0501639545f, 0.188222155f},
-std::array<float,2>{0.771421075f, 0.114183396f},
-std::array<float,2>{0.204061612f, 0.732677758f},
-std::array<float,2>{0.603620052f, 0.941579401f},
-std::array<float,2>{0.368733287f, 0.323658913f},
-std::array<float,2>{0.540573239f, 0.152761877f},
-std::array<float,2>{0.269759953f, 0.541643739f},
-std::array<float,2>{0.843970656f, 0.765764534f},
-std::array<float,2>{0.149678767f, 0.458121419f},
-std::array<float,2>{0.925723732f, 0.289809227f},
-std::array<float,2>{0.116459101f, 0.912352145f},
-std::array<float,2>{0.634650588f, 0.660461068f},
-std::array<float,2>{0.376055181f, 0.0549238883f},
-std::array<float,2>{0.585592926f, 0.361284852f},
-std::array<float,2>{0.329689175f, 0.984553576f},
-std::array<float,2>{0.794200897f, 0.703847468f},
-std::array<float,2>{0.247730345f, 0.0811021104f},
-std::array<float,2>{0.970308423f, 0.231762901f},
-std::array<float,2>{0.008503858f, 0.591965139f},
-std::array<float,2>{0.711510062f, 0.819585085f},
-std::array<float,2>{0.437767655f, 0.425835222f},
-std::array<float,2>{0.679025829f, 0.0250645336f},
-std::array<float,2>{0.411925435f, 0.640388429f},
-std::array<float,2>{0.895281971f, 0.880855858f},
-std::array<float,2>{0.0814981312f, 0.262147665f},
-std::array<float,2>{0.833873749f, 0.471697211f},
-std::array<float,2>{0.164856017f, 0.807959735f},
-std::array<float,2>{0.527969062f, 0.528869689f},
-std::array<float,2>{0.285939217f, 0.160823122f},
-std::array<float,2>{0.654129207f, 0.269564539f},
-std::array<float,2>{0.405075163f, 0.899548948f},
-std::array<float,2>{0.913119435f, 0.6499874f},
-std::array<float,2>{0.0956031084f, 0.00331009203f},
-std::array<float,2>{0.860748053f, 0.178619936f},
-std::array<float,2>{0.130469322f, 0.507013261f},
-std::array<float,2>{0.548225105f, 0.783717334f},
-std::array<float,2>{0.253825992f, 0.499074221f},
-std::array<float,2>{0.617653012f, 0.0638742074f},
-std::array<float,2>{0.3524746f, 0.70012641f},
-std::array<float,2>{0.759937823f, 0.982243657f},
-std::array<float,2>{0.188992262f, 0.351783067f},
-std::array<float,2>{0.950041592f, 0.412346125f},
-std::array<float,2>{0.0395637415f, 0.833880723f},
-std::array<float,2>{0.725994408f, 0.565588176f},
-std::array<float,2>{0.480052084f, 0.236220926f},
-std::array<float,2>{0.506204426f, 0.437666774f},
-std::array<float,2>{0.298641175f, 0.757742643f},
-std::array<float,2>{0.820345819f, 0.554756761f},
-std::array<float,2>{0.176472634f, 0.133104146f},
-std::array<float,2>{0.880681753f, 0.0406840555f},
-std::array<float,2>{0.0688087717f, 0.683360636f},
-std::array<float,2>{0.659068882f, 0.937417209f},
-std::array<float,2>{0.425380766f, 0.301806241f},
-std::array<float,2>{0.703091621f, 0.212997392f},
-std::array<float,2>{0.465096414f, 0.608473957f},
-std::array<float,2>{0.994651496f, 0.845928788f},
-std::array<float,2>{0.0284598954f, 0.393236578f},
-std::array<float,2>{0.811576605f, 0.329728246f},
-std::array<float,2>{0.22017917f, 0.957514524f},
-std::array<float,2>{0.562833726f, 0.741040409f},
-std::array<float,2>{0.316366404f, 0.101669818f},
-std::array<float,2>{0.638017833f, 0.415707648f},
-std::array<float,2>{0.379062414f, 0.838596821f},
-std::array<float,2>{0.925810933f, 0.575016499f},
-std::array<float,2>{0.112234935f, 0.242571086f},
-std::array<float,2>{0.848310292f, 0.072267741f},
-std::array<float,2>{0.153978571f, 0.694573998f},
-std::array<float,2>{0.545941412f, 0.973121583f},
-std::array<float,2>{0.265972465f, 0.351011425f},
-std::array<float,2>{0.608754873f, 0.180552796f},
-std::array<float,2>{0.373406678f, 0.508356392f},
-std::array<float,2>{0.765793681f, 0.795373321f},
-std::array<float,2>{0.207588688f, 0.485864371f},
-std::array<float,2>{0.959319234f, 0.279456049f},
-std::array<float,2>{0.0511796027f, 0.894288957f},
-std::array<float,2>{0.749499023f, 0.641658366f},
-std::array<float,2>{0.487067252f, 0.0156241972f},
-std::array<float,2>{0.525423288f, 0.343405455f},
-std::array<float,2>{0.283166319f, 0.968269169f},
-std::array<float,2>{0.831274271f, 0.744946539f},
-std::array<float,2>{0.171535209f, 0.0947473422f},
-std::array<float,2>{0.891985893f, 0.203625962f},
-std::array<float,2>{0.0821767822f, 0.597577155f},
-std::array<float,2>{0.675480366f, 0.858509719f},
-std::array<float,2>{0.406419903f, 0.406031907f},
-std::array<float,2>{0.715615451f, 0.0329953767f},
-std::array<float,2>{0.445017755f, 0.677623034f},
-std::array<float,2>{0.972736061f, 0.921975255f},
-std::array<float,2>{0.0136226593f, 0.310491532f},
-std::array<float,2>{0.790624261f, 0.447086155f},
-std::array<float,2>{0.245803714f, 0.763019562f},
-std::array<float,2>{0.581450522f, 0.552940071f},
-std::array<float,2>{0.334392458f, 0.125319526f},
-std::array<float,2>{0.71923995f, 0.284135133f},
-std::array<float,2>{0.48420465f, 0.918667138f},
-std::array<float,2>{0.945521295f, 0.669068396f},
-std::array<float,2>{0.045944307f, 0.0491395667f},
-std::array<float,2>{0.76277864f, 0.145545259f},
-std::array<float,2>{0.194783017f, 0.535511494f},
-std::array<float,2>{0.622289121f, 0.775759399f},
-std::array<float,2>{0.358048826f, 0.462656945f},
-std::array<float,2>{0.553323209f, 0.117674284f},
-std::array<float,2>{0.255943865f, 0.721881866f},
-std::array<float,2>{0.866565406f, 0.950395882f},
-std::array<float,2>{0.12851578f, 0.316886783f},
-std::array<float,2>{0.906313777f, 0.381897181f},
-std::array<float,2>{0.0989395827f, 0.871833384f},
-std::array<float,2>{0.64858073f, 0.621217132f},
-std::array<float,2>{0.400157124f, 0.199649155f},
-std::array<float,2>{0.570298076f, 0.48422122f},
-std::array<float,2>{0.320063978f, 0.800141692f},
-std::array<float,2>{0.804794014f, 0.517548442f},
-std::array<float,2>{0.225490019f, 0.171492264f},
-std::array<float,2>{0.997064948f, 0.0206425302f},
-std::array<float,2>{0.023852706f, 0.625622511f},
-std::array<float,2>{0.699159801f, 0.884468496f},
-std::array<float,2>{0.462085158f, 0.25054875f},
-std::array<float,2>{0.662556171f, 0.224591032f},
-std::array<float,2>{0.426691443f, 0.580720663f},
-std::array<float,2>{0.875217974f, 0.827586055f},
-std::array<float,2>{0.0652668178f, 0.435066819f},
-std::array<float,2>{0.828102767f, 0.369856358f},
-std::array<float,2>{0.175398648f, 0.996473193f},
-std::array<float,2>{0.500660896f, 0.715416908f},
-std::array<float,2>{0.301434368f, 0.09298601f},
-std::array<float,2>{0.688499391f, 0.454446763f},
-std::array<float,2>{0.457776725f, 0.769741595f},
-std::array<float,2>{0.989247262f, 0.544146061f},
-std::array<float,2>{0.0171556976f, 0.151730567f},
-std::array<float,2>{0.798123717f, 0.0605878271f},
-std::array<float,2>{0.233700663f, 0.658751845f},
-std::array<float,2>{0.57775718f, 0.909309387f},
-std::array<float,2>{0.328109503f, 0.294750124f},
-std::array<float,2>{0.51370573f, 0.195270061f},
-std::array<float,2>{0.30653584f, 0.611366034f},
-std::array<float,2>{0.816485405f, 0.866371691f},
-std::array<float,2>{0.187306046f, 0.385921896f},
-std::array<float,2>{0.8838709f, 0.328086585f},
-std::array<float,2>{0.0755502358f, 0.941127539f},
-std::array<float,2>{0.671112478f, 0.728112757f},
-std::array<float,2>{0.430364877f, 0.112548456f},
-std::array<float,2>{0.613929093f, 0.258492142f},
-std::array<float,2>{0.344759017f, 0.877105415f},
-std::array<float,2>{0.75216943f, 0.635136366f},
-std::array<float,2>{0.20258683f, 0.0277582072f},
-std::array<float,2>{0.94530189f, 0.157989413f},
-std::array<float,2>{0.036507085f, 0.526741385f},
-std::array<float,2>{0.726683319f, 0.81032747f},
-std::array<float,2>{0.470302373f, 0.474859565f},
-std::array<float,2>{0.640736639f, 0.0828424916f},
-std::array<float,2>{0.391120285f, 0.708295822f},
-std::array<float,2>{0.915101707f, 0.988459587f},
-std::array<float,2>{0.102707744f, 0.366744041f},
-std::array<float,2>{0.873125911f, 0.423211932f},
-std::array<float,2>{0.140196189f, 0.816106319f},
-std::array<float,2>{0.555558205f, 0.588113964f},
-std::array<float,2>{0.259328395f, 0.227491617f},
-std::array<float,2>{0.681833625f, 0.358143508f},
-std::array<float,2>{0.420615554f, 0.980439186f},
-std::array<float,2>{0.904200971f, 0.696837783f},
-std::array<float,2>{0.0884355009f, 0.0668781027f},
-std::array<float,2>{0.843364716f, 0.23839958f},
-std::array<float,2>{0.156678095f, 0.569789886f},
-std::array<float,2>{0.520558298f, 0.831359386f},
-std::array<float,2>{0.292249441f, 0.40957883f},
-std::array<float,2>{0.58846271f, 0.00579831144f},
-std::array<float,2>{0.338160783f, 0.654154122f},
-std::array<float,2>{0.784855545f, 0.903437853f},
-std::array<float,2>{0.23553288f, 0.268424183f},
-std::array<float,2>{0.984059989f, 0.494515568f},
-std::array<float,2>{0.000561112713f, 0.786273777f},
-std::array<float,2>{0.703586698f, 0.500893295f},
-std::array<float,2>{0.452995479f, 0.171903551f},
-std::array<float,2>{0.535033882f, 0.397606701f},
-std::array<float,2>{0.278032511f, 0.851046324f},
-std::array<float,2>{0.856778741f, 0.603639007f},
-std::array<float,2>{0.14413543f, 0.218402609f},
-std::array<float,2>{0.931770623f, 0.106199674f},
-std::array<float,2>{0.123331986f, 0.736642122f},
-std::array<float,2>{0.632111669f, 0.956533492f},
-std::array<float,2>{0.383228481f, 0.33575058f},
-std::array<float,2>{0.735184729f, 0.139044121f},
-std::array<float,2>{0.497550577f, 0.560671985f},
-std::array<float,2>{0.965482354f, 0.753235996f},
-std::array<float,2>{0.0613301843f, 0.441991627f},
-std::array<float,2>{0.774875224f, 0.300507337f},
-std::array<float,2>{0.212257788f, 0.932847559f},
-std::array<float,2>{0.594642818f, 0.684182763f},
-std::array<float,2>{0.361418337f, 0.0434354618f},
-std::array<float,2>{0.62792331f, 0.478048712f},
-std::array<float,2>{0.389101326f, 0.801867962f},
-std::array<float,2>{0.935810983f, 0.521981061f},
-std::array<float,2>{0.120299079f, 0.167803258f},
-std::array<float,2>{0.854854286f, 0.0193868913f},
-std::array<float,2>{0.147743642f, 0.630685925f},
-std::array<float,2>{0.538493037f, 0.88740468f},
-std::array<float,2>{0.274827152f, 0.257195592f},
-std::array<float,2>{0.597921729f, 0.221110031f},
-std::array<float,2>{0.366598576f, 0.583892941f},
-std::array<float,2>{0.78083843f, 0.821409345f},
-std::array<float,2>{0.218341261f, 0.431371272f},
-std::array<float,2>{0.96453923f, 0.37244609f},
-std::array<float,2>{0.0562842973f, 0.993303418f},
-std::array<float,2>{0.741158962f, 0.712395072f},
-std::array<float,2>{0.492336363f, 0.0864376053f},
-std::array<float,2>{0.518501043f, 0.287479281f},
-std::array<float,2>{0.293378145f, 0.917762458f},
-std::array<float,2>{0.83629787f, 0.665103614f},
-std::array<float,2>{0.162708625f, 0.0535137206f},
-std::array<float,2>{0.900126636f, 0.1409695f},
-std::array<float,2>{0.0935517177f, 0.533150792f},
-std::array<float,2>{0.684839904f, 0.778396487f},
-std::array<float,2>{0.416897625f, 0.465194911f},
-std::array<float,2>{0.710549235f, 0.122248381f},
-std::array<float,2>{0.44596839f, 0.722930491f},
-std::array<float,2>{0.977441311f, 0.947201312f},
-std::array<float,2>{0.00519158086f, 0.313822895f},
-std::array<float,2>{0.78554213f, 0.378493577f},
-std::array<float,2>{0.241021007f, 0.868132412f},
-std::array<float,2>{0.592063785f, 0.61885184f},
-std::array<float,2>{0.343298763f, 0.198802486f},
-std::array<float,2>{0.733240426f, 0.33870399f},
-std::array<float,2>{0.473907292f, 0.96344161f},
-std::array<float,2>{0.940641403f, 0.74814111f},
-std::array<float,2>{0.0346621126f, 0.100937463f},
-std::array<float,2>{0.756023467f, 0.208005041f},
-std::array<float,2>{0.195366308f, 0.598765254f},
-std::array<float,2>{0.611661732f, 0.851683736f},
-std::array<float,2>{0.349038154f, 0.399928361f},
-std::array<float,2>{0.561265409f, 0.035163682f},
-std::array<float,2>{0.261891037f, 0.674039602f},
-std::array<float,2>{0.867310226f, 0.929468513f},
-std::array<float,2>{0.133261964f, 0.308125675f},
-std::array<float,2>{0.9206267f, 0.449898869f},
-std::array<float,2>{0.108092204f, 0.759781659f},
-std::array<float,2>{0.648286641f, 0.547892392f},
-std::array<float,2>{0.396713525f, 0.132584438f},
-std::array<float,2>{0.570706666f, 0.419566125f},
-std::array<float,2>{0.321777672f, 0.840198278f},
-std::array<float,2>{0.802394867f, 0.571511567f},
-std::array<float,2>{0.228186741f, 0.247279003f},
-std::array<float,2>{0.986860037f, 0.074506782f},
-std::array<float,2>{0.0202773251f, 0.691179812f},
-std::array<float,2>{0.695280552f, 0.969941974f},
-std::array<float,2>{0.454185009f, 0.344993919f},
-std::array<float,2>{0.667815208f, 0.184859648f},
-std::array<float,2>{0.434791952f, 0.513660491f},
-std::array<float,2>{0.88781178f, 0.792936862f},
-std::array<float,2>{0.0727533177f, 0.490551293f},
-std::array<float,2>{0.815553248f, 0.274894387f},
-std::array<float,2>{0.18275097f, 0.897966683f},
-std::array<float,2>{0.508300066f, 0.647469223f},
-std::array<float,2>{0.309363812f, 0.00877500605f},
-std::array<float,2>{0.700106323f, 0.393702537f},
-std::array<float,2>{0.468361676f, 0.8470608f},
-std::array<float,2>{0.993937254f, 0.608091474f},
-std::array<float,2>{0.0310437921f, 0.213889673f},
-std::array<float,2>{0.810504436f, 0.102914914f},
-std::array<float,2>{0.221038342f, 0.741425276f},
-std::array<float,2>{0.566189468f, 0.958149195f},
-std::array<float,2>{0.313140303f, 0.329077721f},
-std::array<float,2>{0.504792452f, 0.133816883f},
-std::array<float,2>{0.300504684f, 0.55588007f},
-std::array<float,2>{0.823457122f, 0.756263375f},
-std::array<float,2>{0.17919293f, 0.438710153f},
-std::array<float,2>{0.880910873f, 0.301221132f},
-std::array<float,2>{0.0679827034f, 0.936236739f},
-std::array<float,2>{0.658177793f, 0.682492137f},
-std::array<float,2>{0.423347533f, 0.0398736186f},
-std::array<float,2>{0.619313061f, 0.353324562f},
-std::array<float,2>{0.355067968f, 0.980545521f},
-std::array<float,2>{0.758544326f, 0.700825334f},
-std::array<float,2>{0.190438822f, 0.0629062951f},
-std::array<float,2>{0.951794505f, 0.234478012f},
-std::array<float,2>{0.0427293368f, 0.565152764f},
-std::array<float,2>{0.722860992f, 0.832923353f},
-std::array<float,2>{0.478256732f, 0.413220435f},
-std::array<float,2>{0.654428184f, 0.00225678552f},
-std::array<float,2>{0.404163778f, 0.64919591f},
-std::array<float,2>{0.911718488f, 0.89869386f},
-std::array<float,2>{0.0974269882f, 0.270758927f},
-std::array<float,2>{0.861672044f, 0.499009401f},
-std::array<float,2>{0.132754937f, 0.785004377f},
-std::array<float,2>{0.55040735f, 0.505886614f},
-std::array<float,2>{0.25012666f, 0.179631814f},
-std::array<float,2>{0.676039457f, 0.263037026f},
-std::array<float,2>{0.412388146f, 0.879653931f},
-std::array<float,2>{0.898355067f, 0.639551342f},
-std::array<float,2>{0.0790423974f, 0.024074791f},
-std::array<float,2>{0.834295332f, 0.161767662f},
-std::array<float,2>{0.166472316f, 0.527957141f},
-std::array<float,2>{0.530507147f, 0.807511032f},
-std::array<float,2>{0.289022803f, 0.471168131f},
-std::array<float,2>{0.582091451f, 0.0806656927f},
-std::array<float,2>{0.331902266f, 0.704427063f},
-std::array<float,2>{0.795686662f, 0.986223221f},
-std::array<float,2>{0.248968631f, 0.359953076f},
-std::array<float,2>{0.971464336f, 0.42767188f},
-std::array<float,2>{0.0107022226f, 0.818830252f},
-std::array<float,2>{0.714290261f, 0.593384504f},
-std::array<float,2>{0.439782113f, 0.231089473f},
-std::array<float,2>{0.542626977f, 0.457982838f},
-std::array<float,2>{0.272283405f, 0.767561197f},
-std::array<float,2>{0.845934033f, 0.542814076f},
-std::array<float,2>{0.151096195f, 0.153990105f},
-std::array<float,2>{0.922223449f, 0.0563477054f},
-std::array<float,2>{0.113930829f, 0.661795437f},
-std::array<float,2>{0.634845793f, 0.913766861f},
-std::array<float,2>{0.377234399f, 0.290376753f},
-std::array<float,2>{0.744736254f, 0.188891619f},
-std::array<float,2>{0.488726825f, 0.615657806f},
-std::array<float,2>{0.955280542f, 0.859973609f},
-std::array<float,2>{0.0483772047f, 0.387198657f},
-std::array<float,2>{0.772991598f, 0.323144138f},
-std::array<float,2>{0.205478281f, 0.942477226f},
-std::array<float,2>{0.603233635f, 0.734371483f},
-std::array<float,2>{0.369753003f, 0.114988729f},
-std::array<float,2>{0.661664128f, 0.434381336f},
-std::array<float,2>{0.428020477f, 0.826631069f},
-std::array<float,2>{0.878328323f, 0.581678391f},
-std::array<float,2>{0.0630959719f, 0.22287932f},
-std::array<float,2>{0.825467706f, 0.0923247784f},
-std::array<float,2>{0.172642544f, 0.716304362f},
-std::array<float,2>{0.50219214f, 0.997682452f},
-std::array<float,2>{0.304273814f, 0.370615125f},
-std::array<float,2>{0.567403734f, 0.170621887f},
-std::array<float,2>{0.31756413f, 0.516101301f},
-std::array<float,2>{0.807779849f, 0.799013317f},
-std::array<float,2>{0.222990647f, 0.482587397f},
-std::array<float,2>{0.999978065f, 0.251761973f},
-std::array<float,2>{0.0266694259f, 0.883365929f},
-std::array<float,2>{0.696954012f, 0.626583338f},
-std::array<float,2>{0.462987423f, 0.0197672229f},
-std::array<float,2>{0.551202595f, 0.317615151f},
-std::array<float,2>{0.255194843f, 0.949779391f},
-std::array<float,2>{0.863556504f, 0.721625447f},
-std::array<float,2>{0.126154616f, 0.118682757f},
-std::array<float,2>{0.909409404f, 0.200967982f},
-std::array<float,2>{0.100780681f, 0.622657537f},
-std::array<float,2>{0.650473416f, 0.872110188f},
-std::array<float,2>{0.400408f, 0.381346554f},
-std::array<float,2>{0.722310901f, 0.050075978f},
-std::array<float,2>{0.482367247f, 0.668414235f},
-std::array<float,2>{0.948386908f, 0.919164896f},
-std::array<float,2>{0.0436637923f, 0.28468886f},
-std::array<float,2>{0.764319301f, 0.461427063f},
-std::array<float,2>{0.192565486f, 0.777206719f},
-std::array<float,2>{0.624796391f, 0.53709805f},
-std::array<float,2>{0.355871469f, 0.145129293f},
-std::array<float,2>{0.718695045f, 0.309154332f},
-std::array<float,2>{0.442663074f, 0.923494458f},
-std::array<float,2>{0.975688994f, 0.676262915f},
-std::array<float,2>{0.0144771785f, 0.0316044204f},
-std::array<float,2>{0.792865098f, 0.126333192f},
-std::array<float,2>{0.243186101f, 0.554211974f},
-std::array<float,2>{0.578281641f, 0.762381673f},
-std::array<float,2>{0.332349986f, 0.44624868f},
-std::array<float,2>{0.523701668f, 0.0944341868f},
-std::array<float,2>{0.284624934f, 0.745639563f},
-std::array<float,2>{0.829099774f, 0.96712482f},
-std::array<float,2>{0.169009402f, 0.342532694f},
-std::array<float,2>{0.893592179f, 0.404720455f},
-std::array<float,2>{0.0845077187f, 0.857674778f},
-std::array<float,2>{0.672059834f, 0.596108019f},
-std::array<float,2>{0.408265293f, 0.204410464f},
-std::array<float,2>{0.606372178f, 0.484978884f},
-std::array<float,2>{0.372688204f, 0.79638356f},
-std::array<float,2>{0.768578529f, 0.509643257f},
-std::array<float,2>{0.210073069f, 0.181416482f},
-std::array<float,2>{0.958750904f, 0.0140926568f},
-std::array<float,2>{0.0531367213f, 0.641011596f},
-std::array<float,2>{0.747003794f, 0.893353581f},
-std::array<float,2>{0.486224979f, 0.28079316f},
-std::array<float,2>{0.640345156f, 0.244002536f},
-std::array<float,2>{0.381507158f, 0.576154888f},
-std::array<float,2>{0.929287672f, 0.83904022f},
-std::array<float,2>{0.109482221f, 0.414497942f},
-std::array<float,2>{0.850996554f, 0.350051224f},
-std::array<float,2>{0.155640051f, 0.974340439f},
-std::array<float,2>{0.544208407f, 0.693958879f},
-std::array<float,2>{0.268333465f, 0.0737550855f},
-std::array<float,2>{0.738192618f, 0.44292596f},
-std::array<float,2>{0.499867707f, 0.752624512f},
-std::array<float,2>{0.968570948f, 0.561615407f},
-std::array<float,2>{0.059423998f, 0.140364185f},
-std::array<float,2>{0.775762022f, 0.044154007f},
-std::array<float,2>{0.214539424f, 0.685472786f},
-std::array<float,2>{0.595818281f, 0.932197154f},
-std::array<float,2>{0.361005753f, 0.299233437f},
-std::array<float,2>{0.531855404f, 0.217400506f},
-std::array<float,2>{0.279934078f, 0.604799926f},
-std::array<float,2>{0.857883453f, 0.849816263f},
-std::array<float,2>{0.141100854f, 0.396730602f},
-std::array<float,2>{0.931212306f, 0.334462911f},
-std::array<float,2>{0.122731552f, 0.955975592f},
-std::array<float,2>{0.630287409f, 0.738034368f},
-std::array<float,2>{0.385854125f, 0.107233331f},
-std::array<float,2>{0.587244809f, 0.268683076f},
-std::array<float,2>{0.335982025f, 0.903209031f},
-std::array<float,2>{0.781992972f, 0.652504086f},
-std::array<float,2>{0.23816818f, 0.00410173973f},
-std::array<float,2>{0.981333077f, 0.17336154f},
-std::array<float,2>{0.00328891398f, 0.501879871f},
-std::array<float,2>{0.705857277f, 0.785979509f},
-std::array<float,2>{0.449547142f, 0.495847285f},
-std::array<float,2>{0.679742157f, 0.0679439083f},
-std::array<float,2>{0.419658095f, 0.695699036f},
-std::array<float,2>{0.905098736f, 0.978753984f},
-std::array<float,2>{0.087184608f, 0.359192044f},
-std::array<float,2>{0.841048419f, 0.408326417f},
-std::array<float,2>{0.158343613f, 0.83057338f},
-std::array<float,2>{0.523380697f, 0.569041073f},
-std::array<float,2>{0.289260745f, 0.239459872f},
-std::array<float,2>{0.6443156f, 0.365676939f},
-std::array<float,2>{0.394199491f, 0.990074933f},
-std::array<float,2>{0.916894674f, 0.707368135f},
-std::array<float,2>{0.10506095f, 0.083597891f},
-std::array<float,2>{0.87181735f, 0.228081912f},
-std::array<float,2>{0.137329906f, 0.58956933f},
-std::array<float,2>{0.557148099f, 0.814998925f},
-std::array<float,2>{0.26155588f, 0.422673255f},
-std::array<float,2>{0.616049886f, 0.0292225834f},
-std::array<float,2>{0.346885681f, 0.636541903f},
-std::array<float,2>{0.750652432f, 0.878365636f},
-std::array<float,2>{0.200328395f, 0.259174019f},
-std::array<float,2>{0.942259312f, 0.475751609f},
-std::array<float,2>{0.0387143642f, 0.809552193f},
-std::array<float,2>{0.72953999f, 0.525569141f},
-std::array<float,2>{0.472359359f, 0.156284526f},
-std::array<float,2>{0.512144685f, 0.385506451f},
-std::array<float,2>{0.30804202f, 0.865909517f},
-std::array<float,2>{0.819922328f, 0.612695515f},
-std::array<float,2>{0.184293166f, 0.19341287f},
-std::array<float,2>{0.884855688f, 0.112039305f},
-std::array<float,2>{0.0771677718f, 0.727119625f},
-std::array<float,2>{0.669905245f, 0.940320313f},
-std::array<float,2>{0.432602257f, 0.326431036f},
-std::array<float,2>{0.690965235f, 0.151236743f},
-std::array<float,2>{0.459618866f, 0.543546557f},
-std::array<float,2>{0.99147737f, 0.771304548f},
-std::array<float,2>{0.0180073138f, 0.453942448f},
-std::array<float,2>{0.800357521f, 0.293033004f},
-std::array<float,2>{0.231046349f, 0.908303618f},
-std::array<float,2>{0.575135708f, 0.65986836f},
-std::array<float,2>{0.32477355f, 0.06187791f},
-std::array<float,2>{0.686174452f, 0.466873199f},
-std::array<float,2>{0.41526109f, 0.781133354f},
-std::array<float,2>{0.901106834f, 0.533441424f},
-std::array<float,2>{0.0905041769f, 0.144482285f},
-std::array<float,2>{0.838108718f, 0.0519390069f},
-std::array<float,2>{0.161873326f, 0.666598082f},
-std::array<float,2>{0.516849577f, 0.914759696f},
-std::array<float,2>{0.295784265f, 0.285187989f},
-std::array<float,2>{0.590035737f, 0.196448222f},
-std::array<float,2>{0.341520041f, 0.620901346f},
-std::array<float,2>{0.788026035f, 0.870143473f},
-std::array<float,2>{0.23976171f, 0.376713932f},
-std::array<float,2>{0.979843974f, 0.315196812f},
-std::array<float,2>{0.00721341697f, 0.948535442f},
-std::array<float,2>{0.708273172f, 0.726004362f},
-std::array<float,2>{0.449007958f, 0.123855464f},
-std::array<float,2>{0.535533428f, 0.254582137f},
-std::array<float,2>{0.276093602f, 0.889545679f},
-std::array<float,2>{0.852197111f, 0.632722139f},
-std::array<float,2>{0.146064252f, 0.0171341877f},
-std::array<float,2>{0.933836341f, 0.164147794f},
-std::array<float,2>{0.117478125f, 0.519761324f},
-std::array<float,2>{0.625869989f, 0.802882016f},
-std::array<float,2>{0.387489557f, 0.479873836f},
-std::array<float,2>{0.73867625f, 0.0889390409f},
-std::array<float,2>{0.494264454f, 0.714742362f},
-std::array<float,2>{0.961389065f, 0.995598435f},
-std::array<float,2>{0.057608176f, 0.37372008f},
-std::array<float,2>{0.777670622f, 0.432453096f},
-std::array<float,2>{0.21610868f, 0.823863506f},
-std::array<float,2>{0.600675464f, 0.584761679f},
-std::array<float,2>{0.36454767f, 0.219234914f},
-std::array<float,2>{0.692482233f, 0.347390532f},
-std::array<float,2>{0.455131352f, 0.971734703f},
-std::array<float,2>{0.984704733f, 0.68792969f},
-std::array<float,2>{0.021862654f, 0.077381067f},
-std::array<float,2>{0.803258777f, 0.24823375f},
-std::array<float,2>{0.230289757f, 0.573636413f},
-std::array<float,2>{0.573643684f, 0.843669474f},
-std::array<float,2>{0.323713869f, 0.421111077f},
-std::array<float,2>{0.510140777f, 0.0102598043f},
-std::array<float,2>{0.312004536f, 0.646043122f},
-std::array<float,2>{0.813699007f, 0.894973278f},
-std::array<float,2>{0.181017369f, 0.276342362f},
-std::array<float,2>{0.889276326f, 0.489129931f},
-std::array<float,2>{0.0707362443f, 0.790179551f},
-std::array<float,2>{0.664174795f, 0.514072359f},
-std::array<float,2>{0.435975373f, 0.18741557f},
-std::array<float,2>{0.609438419f, 0.402293622f},
-std::array<float,2>{0.350989521f, 0.853921235f},
-std::array<float,2>{0.754897594f, 0.599778593f},
-std::array<float,2>{0.198624179f, 0.210392088f},
-std::array<float,2>{0.938784122f, 0.0985898226f},
-std::array<float,2>{0.0327794403f, 0.746958554f},
-std::array<float,2>{0.732371509f, 0.962043047f},
-std::array<float,2>{0.475968927f, 0.337134093f},
-std::array<float,2>{0.645872951f, 0.130226001f},
-std::array<float,2>{0.394690454f, 0.550192893f},
-std::array<float,2>{0.919834197f, 0.759005427f},
-std::array<float,2>{0.106663838f, 0.452428102f},
-std::array<float,2>{0.869291246f, 0.305536985f},
-std::array<float,2>{0.135968179f, 0.927160203f},
-std::array<float,2>{0.559891462f, 0.673663378f},
-std::array<float,2>{0.26520437f, 0.0382504463f},
-std::array<float,2>{0.725172579f, 0.41022104f},
-std::array<float,2>{0.479063451f, 0.835277915f},
-std::array<float,2>{0.950585365f, 0.562602699f},
-std::array<float,2>{0.0409735814f, 0.238070011f},
-std::array<float,2>{0.76134634f, 0.065614745f},
-std::array<float,2>{0.188010618f, 0.702788234f},
-std::array<float,2>{0.61849004f, 0.982990742f},
-std::array<float,2>{0.353402138f, 0.354546547f},
-std::array<float,2>{0.547253966f, 0.176630929f},
-std::array<float,2>{0.252746969f, 0.505123556f},
-std::array<float,2>{0.859637797f, 0.782941937f},
-std::array<float,2>{0.129357949f, 0.496395439f},
-std::array<float,2>{0.912855268f, 0.272272199f},
-std::array<float,2>{0.0943516865f, 0.901574135f},
-std::array<float,2>{0.652690172f, 0.650959671f},
-std::array<float,2>{0.406003714f, 0.00103997428f},
-std::array<float,2>{0.564069271f, 0.331040978f},
-std::array<float,2>{0.314479947f, 0.959964931f},
-std::array<float,2>{0.810691416f, 0.738812029f},
-std::array<float,2>{0.218865246f, 0.104077354f},
-std::array<float,2>{0.995447338f, 0.2115013f},
-std::array<float,2>{0.0279979855f, 0.605942905f},
-std::array<float,2>{0.701860785f, 0.844956696f},
-std::array<float,2>{0.465893209f, 0.390730739f},
-std::array<float,2>{0.65943414f, 0.042089615f},
-std::array<float,2>{0.423849374f, 0.681291699f},
-std::array<float,2>{0.878961563f, 0.935284436f},
-std::array<float,2>{0.0699507073f, 0.303415805f},
-std::array<float,2>{0.821386814f, 0.440284818f},
-std::array<float,2>{0.176885217f, 0.755684733f},
-std::array<float,2>{0.507380486f, 0.558217824f},
-std::array<float,2>{0.297774255f, 0.135113865f},
-std::array<float,2>{0.633257091f, 0.291350842f},
-std::array<float,2>{0.375471532f, 0.911070526f},
-std::array<float,2>{0.924562335f, 0.663820565f},
-std::array<float,2>{0.115781188f, 0.0577725694f},
-std::array<float,2>{0.84493649f, 0.15460813f},
-std::array<float,2>{0.148887366f, 0.539477885f},
-std::array<float,2>{0.539790928f, 0.76932174f},
-std::array<float,2>{0.271422595f, 0.45909965f},
-std::array<float,2>{0.605005741f, 0.115302078f},
-std::array<float,2>{0.367873609f, 0.731961787f},
-std::array<float,2>{0.76987654f, 0.94369173f},
-std::array<float,2>{0.204617396f, 0.322124898f},
-std::array<float,2>{0.953374684f, 0.388792187f},
-std::array<float,2>{0.0497161411f, 0.861538529f},
-std::array<float,2>{0.74278146f, 0.614069223f},
-std::array<float,2>{0.491668642f, 0.19036448f},
-std::array<float,2>{0.529135466f, 0.469855338f},
-std::array<float,2>{0.28689003f, 0.806359291f},
-std::array<float,2>{0.832906723f, 0.530477345f},
-std::array<float,2>{0.16575107f, 0.162953824f},
-std::array<float,2>{0.895575881f, 0.025680948f},
-std::array<float,2>{0.0807359368f, 0.637315512f},
-std::array<float,2>{0.678364992f, 0.882741153f},
-std::array<float,2>{0.410206199f, 0.264621794f},
-std::array<float,2>{0.712299168f, 0.23270537f},
-std::array<float,2>{0.438609004f, 0.590612054f},
-std::array<float,2>{0.969316542f, 0.818019867f},
-std::array<float,2>{0.00973836612f, 0.428459913f},
-std::array<float,2>{0.793714881f, 0.362253696f},
-std::array<float,2>{0.246360451f, 0.98759526f},
-std::array<float,2>{0.584338844f, 0.706223905f},
-std::array<float,2>{0.328387141f, 0.0792190582f},
-std::array<float,2>{0.649669409f, 0.380447417f},
-std::array<float,2>{0.398480058f, 0.874859393f},
-std::array<float,2>{0.907976866f, 0.624517322f},
-std::array<float,2>{0.0976793841f, 0.201422408f},
-std::array<float,2>{0.865881562f, 0.120234556f},
-std::array<float,2>{0.127761707f, 0.720512271f},
-std::array<float,2>{0.553949058f, 0.951945841f},
-std::array<float,2>{0.257176548f, 0.319142312f},
-std::array<float,2>{0.621408582f, 0.148235872f},
-std::array<float,2>{0.358615577f, 0.537438929f},
-std::array<float,2>{0.762304604f, 0.773569763f},
-std::array<float,2>{0.194147021f, 0.463402689f},
-std::array<float,2>{0.947119236f, 0.283020198f},
-std::array<float,2>{0.0453852005f, 0.92073077f},
-std::array<float,2>{0.719888031f, 0.670989156f},
-std::array<float,2>{0.482580513f, 0.0478697047f},
-std::array<float,2>{0.50125736f, 0.36758849f},
-std::array<float,2>{0.302279949f, 0.999089539f},
-std::array<float,2>{0.826509535f, 0.718671918f},
-std::array<float,2>{0.173957467f, 0.0901617035f},
-std::array<float,2>{0.876725733f, 0.226555049f},
-std::array<float,2>{0.0662752092f, 0.578848958f},
-std::array<float,2>{0.663492322f, 0.824901879f},
-std::array<float,2>{0.427398294f, 0.43637687f},
-std::array<float,2>{0.697771668f, 0.0223808978f},
-std::array<float,2>{0.46159932f, 0.627563894f},
-std::array<float,2>{0.997092664f, 0.88665843f},
-std::array<float,2>{0.0251926929f, 0.253188372f},
-std::array<float,2>{0.806495011f, 0.480674356f},
-std::array<float,2>{0.226427078f, 0.798448324f},
-std::array<float,2>{0.568974674f, 0.519295275f},
-std::array<float,2>{0.318827242f, 0.168353319f},
-std::array<float,2>{0.748394787f, 0.279232055f},
-std::array<float,2>{0.488129616f, 0.8912552f},
-std::array<float,2>{0.960488617f, 0.643956006f},
-std::array<float,2>{0.0522847176f, 0.0132427476f},
-std::array<float,2>{0.76752317f, 0.183033869f},
-std::array<float,2>{0.208926648f, 0.511246324f},
-std::array<float,2>{0.608240724f, 0.793152869f},
-std::array<float,2>{0.374085426f, 0.487409592f},
-std::array<float,2>{0.545631409f, 0.0718507394f},
-std::array<float,2>{0.267136902f, 0.692297459f},
-std::array<float,2>{0.848635972f, 0.976036012f},
-std::array<float,2>{0.153045252f, 0.348190188f},
-std::array<float,2>{0.926952541f, 0.417883515f},
-std::array<float,2>{0.112951666f, 0.837019682f},
-std::array<float,2>{0.637542963f, 0.576536119f},
-std::array<float,2>{0.380305797f, 0.245375991f},
-std::array<float,2>{0.580743551f, 0.447471827f},
-std::array<float,2>{0.335416257f, 0.764323175f},
-std::array<float,2>{0.78970331f, 0.551895142f},
-std::array<float,2>{0.24510546f, 0.127702877f},
-std::array<float,2>{0.974018514f, 0.0349651314f},
-std::array<float,2>{0.0120561272f, 0.679024041f},
-std::array<float,2>{0.715940714f, 0.925320446f},
-std::array<float,2>{0.444264323f, 0.312001944f},
-std::array<float,2>{0.674358428f, 0.206901595f},
-std::array<float,2>{0.407944858f, 0.594609559f},
-std::array<float,2>{0.890954673f, 0.857235849f},
-std::array<float,2>{0.0830202252f, 0.402808845f},
-std::array<float,2>{0.830928802f, 0.341372341f},
-std::array<float,2>{0.170101553f, 0.964855611f},
-std::array<float,2>{0.52690351f, 0.742462695f},
-std::array<float,2>{0.282092988f, 0.0972678736f},
-std::array<float,2>{0.704774201f, 0.492194682f},
-std::array<float,2>{0.451586932f, 0.788743734f},
-std::array<float,2>{0.983087301f, 0.502280235f},
-std::array<float,2>{0.00116380933f, 0.175284907f},
-std::array<float,2>{0.783728004f, 0.0068079601f},
-std::array<float,2>{0.234661579f, 0.654839635f},
-std::array<float,2>{0.589767575f, 0.904507577f},
-std::array<float,2>{0.339737296f, 0.267231286f},
-std::array<float,2>{0.520335555f, 0.241776079f},
-std::array<float,2>{0.291284233f, 0.566468716f},
-std::array<float,2>{0.842459023f, 0.829615414f},
-std::array<float,2>{0.157723397f, 0.407460511f},
-std::array<float,2>{0.903125823f, 0.356485039f},
-std::array<float,2>{0.0894374475f, 0.977850556f},
-std::array<float,2>{0.683377445f, 0.697409809f},
-std::array<float,2>{0.421340793f, 0.0689597502f},
-std::array<float,2>{0.594972432f, 0.297087729f},
-std::array<float,2>{0.363151729f, 0.930261791f},
-std::array<float,2>{0.773633361f, 0.687277973f},
-std::array<float,2>{0.211018741f, 0.0451585986f},
-std::array<float,2>{0.96593827f, 0.137806043f},
-std::array<float,2>{0.0623787083f, 0.559414089f},
-std::array<float,2>{0.736063182f, 0.750953078f},
-std::array<float,2>{0.496211886f, 0.443791568f},
-std::array<float,2>{0.631146371f, 0.107528821f},
-std::array<float,2>{0.383920908f, 0.735643864f},
-std::array<float,2>{0.933461249f, 0.953521311f},
-std::array<float,2>{0.124458112f, 0.333014637f},
-std::array<float,2>{0.856135964f, 0.394574493f},
-std::array<float,2>{0.142745063f, 0.84879142f},
-std::array<float,2>{0.533712387f, 0.602765322f},
-std::array<float,2>{0.27903825f, 0.215930343f},
-std::array<float,2>{0.670343578f, 0.325269163f},
-std::array<float,2>{0.431569517f, 0.938337505f},
-std::array<float,2>{0.883673847f, 0.729346037f},
-std::array<float,2>{0.0743940994f, 0.109561026f},
-std::array<float,2>{0.817772925f, 0.192600906f},
-std::array<float,2>{0.186054587f, 0.609619975f},
-std::array<float,2>{0.514964402f, 0.864639103f},
-std::array<float,2>{0.305310667f, 0.384175837f},
-std::array<float,2>{0.5762766f, 0.0585953183f},
-std::array<float,2>{0.326312721f, 0.657694578f},
-std::array<float,2>{0.797734916f, 0.907860756f},
-std::array<float,2>{0.232546866f, 0.296392798f},
-std::array<float,2>{0.990102232f, 0.455655277f},
-std::array<float,2>{0.0161865316f, 0.772374809f},
-std::array<float,2>{0.687960029f, 0.545874596f},
-std::array<float,2>{0.458626211f, 0.14979583f},
-std::array<float,2>{0.556487322f, 0.425651401f},
-std::array<float,2>{0.258702219f, 0.813506484f},
-std::array<float,2>{0.874080479f, 0.586904287f},
-std::array<float,2>{0.139277697f, 0.2287222f},
-std::array<float,2>{0.914096951f, 0.0845371857f},
-std::array<float,2>{0.102338202f, 0.710035384f},
-std::array<float,2>{0.64177531f, 0.991148412f},
-std::array<float,2>{0.39164266f, 0.364254177f},
-std::array<float,2>{0.727960587f, 0.158461571f},
-std::array<float,2>{0.469537497f, 0.525236309f},
-std::array<float,2>{0.943478942f, 0.810768366f},
-std::array<float,2>{0.0358421057f, 0.474038571f},
-std::array<float,2>{0.753851056f, 0.26031673f},
-std::array<float,2>{0.201974899f, 0.876007318f},
-std::array<float,2>{0.614685655f, 0.634272516f},
-std::array<float,2>{0.344695747f, 0.0309690796f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.657462895f, 0.880947232f},
-std::array<float,2>{0.339996994f, 0.481603682f},
-std::array<float,2>{0.799997211f, 0.0904821157f},
-std::array<float,2>{0.0322821103f, 0.670321465f},
-std::array<float,2>{0.886304438f, 0.591878414f},
-std::array<float,2>{0.243604705f, 0.130868331f},
-std::array<float,2>{0.542932272f, 0.284520268f},
-std::array<float,2>{0.485718399f, 0.760192156f},
-std::array<float,2>{0.61888814f, 0.689733148f},
-std::array<float,2>{0.39091292f, 0.00541681657f},
-std::array<float,2>{0.990515351f, 0.388680965f},
-std::array<float,2>{0.150527298f, 0.938343883f},
-std::array<float,2>{0.873901188f, 0.845480382f},
-std::array<float,2>{0.105044454f, 0.330942899f},
-std::array<float,2>{0.715395212f, 0.232439384f},
-std::array<float,2>{0.279183298f, 0.54837209f},
-std::array<float,2>{0.531008661f, 0.788140237f},
-std::array<float,2>{0.465609401f, 0.256004184f},
-std::array<float,2>{0.909572005f, 0.161863536f},
-std::array<float,2>{0.209576368f, 0.597223282f},
-std::array<float,2>{0.778075159f, 0.630487323f},
-std::array<float,2>{0.0210361909f, 0.118225686f},
-std::array<float,2>{0.643000603f, 0.446330279f},
-std::array<float,2>{0.354818612f, 0.931055367f},
-std::array<float,2>{0.725537002f, 0.512137771f},
-std::array<float,2>{0.306995958f, 0.210757598f},
-std::array<float,2>{0.833447397f, 0.364492118f},
-std::array<float,2>{0.0731690675f, 0.816208184f},
-std::array<float,2>{0.953051329f, 0.996546328f},
-std::array<float,2>{0.184193954f, 0.427275866f},
-std::array<float,2>{0.579373717f, 0.0434794128f},
-std::array<float,2>{0.432099313f, 0.72075069f},
-std::array<float,2>{0.690301597f, 0.83362484f},
-std::array<float,2>{0.259391487f, 0.346240729f},
-std::array<float,2>{0.848132908f, 0.20126988f},
-std::array<float,2>{0.11906144f, 0.523148894f},
-std::array<float,2>{0.979148865f, 0.740721166f},
-std::array<float,2>{0.138656229f, 0.0616172552f},
-std::array<float,2>{0.594180882f, 0.416262329f},
-std::array<float,2>{0.385373294f, 0.972345352f},
-std::array<float,2>{0.550279438f, 0.617021203f},
-std::array<float,2>{0.482658029f, 0.179640144f},
-std::array<float,2>{0.897875309f, 0.278432071f},
-std::array<float,2>{0.223031685f, 0.806365192f},
-std::array<float,2>{0.789923847f, 0.917913735f},
-std::array<float,2>{0.0541438721f, 0.467339247f},
-std::array<float,2>{0.687342405f, 0.108873479f},
-std::array<float,2>{0.323528826f, 0.655650556f},
-std::array<float,2>{0.569379389f, 0.955333531f},
-std::array<float,2>{0.408961594f, 0.39645502f},
-std::array<float,2>{0.965638638f, 0.0280514546f},
-std::array<float,2>{0.169128448f, 0.706084728f},
-std::array<float,2>{0.81833744f, 0.546109438f},
-std::array<float,2>{0.0925646499f, 0.242397755f},
-std::array<float,2>{0.736338615f, 0.323585302f},
-std::array<float,2>{0.294142306f, 0.862286687f},
-std::array<float,2>{0.63599813f, 0.68626076f},
-std::array<float,2>{0.368262708f, 0.072807841f},
-std::array<float,2>{0.751976669f, 0.49748984f},
-std::array<float,2>{0.00992466137f, 0.903879702f},
-std::array<float,2>{0.922554493f, 0.779224038f},
-std::array<float,2>{0.200180233f, 0.29839167f},
-std::array<float,2>{0.51126647f, 0.15615055f},
-std::array<float,2>{0.444416434f, 0.56496942f},
-std::array<float,2>{0.743269444f, 0.976764798f},
-std::array<float,2>{0.282126665f, 0.413658947f},
-std::array<float,2>{0.828070283f, 0.0546860471f},
-std::array<float,2>{0.0839470178f, 0.744460285f},
-std::array<float,2>{0.95593524f, 0.526921928f},
-std::array<float,2>{0.162717342f, 0.194563299f},
-std::array<float,2>{0.572435439f, 0.357153416f},
-std::array<float,2>{0.41776678f, 0.83749342f},
-std::array<float,2>{0.50489825f, 0.642186224f},
-std::array<float,2>{0.452519953f, 0.101150356f},
-std::array<float,2>{0.931382239f, 0.457192868f},
-std::array<float,2>{0.19134444f, 0.9067384f},
-std::array<float,2>{0.761891484f, 0.800067842f},
-std::array<float,2>{0.000858261657f, 0.266573519f},
-std::array<float,2>{0.626882076f, 0.186351717f},
-std::array<float,2>{0.360220224f, 0.62172097f},
-std::array<float,2>{0.604126275f, 0.872752905f},
-std::array<float,2>{0.378845453f, 0.31703496f},
-std::array<float,2>{0.974809051f, 0.240537018f},
-std::array<float,2>{0.130550355f, 0.534946978f},
-std::array<float,2>{0.858234167f, 0.717597365f},
-std::array<float,2>{0.114894189f, 0.0162981357f},
-std::array<float,2>{0.700021446f, 0.398485661f},
-std::array<float,2>{0.257341206f, 0.961264074f},
-std::array<float,2>{0.672258377f, 0.570767343f},
-std::array<float,2>{0.317120463f, 0.144925907f},
-std::array<float,2>{0.787891567f, 0.307047129f},
-std::array<float,2>{0.0577660128f, 0.768983483f},
-std::array<float,2>{0.903527677f, 0.893910944f},
-std::array<float,2>{0.22711958f, 0.485226363f},
-std::array<float,2>{0.560734451f, 0.0685867593f},
-std::array<float,2>{0.4710159f, 0.675635815f},
-std::array<float,2>{0.652254879f, 0.757330596f},
-std::array<float,2>{0.350810379f, 0.293450266f},
-std::array<float,2>{0.771007538f, 0.139339462f},
-std::array<float,2>{0.029871881f, 0.582695842f},
-std::array<float,2>{0.914570153f, 0.657330751f},
-std::array<float,2>{0.216551185f, 0.0841936916f},
-std::array<float,2>{0.519112885f, 0.473381847f},
-std::array<float,2>{0.456575155f, 0.887572408f},
-std::array<float,2>{0.586774826f, 0.557593942f},
-std::array<float,2>{0.425026864f, 0.22181721f},
-std::array<float,2>{0.944171488f, 0.342699856f},
-std::array<float,2>{0.174336359f, 0.85372591f},
-std::array<float,2>{0.838132083f, 0.9503811f},
-std::array<float,2>{0.0681986362f, 0.381293118f},
-std::array<float,2>{0.729246557f, 0.00849918928f},
-std::array<float,2>{0.302452385f, 0.70110786f},
-std::array<float,2>{0.533523202f, 0.924743295f},
-std::array<float,2>{0.496061862f, 0.443060726f},
-std::array<float,2>{0.879258215f, 0.11092478f},
-std::array<float,2>{0.235672265f, 0.635284245f},
-std::array<float,2>{0.809759378f, 0.609334052f},
-std::array<float,2>{0.0413907282f, 0.169068396f},
-std::array<float,2>{0.667660594f, 0.26236102f},
-std::array<float,2>{0.329541057f, 0.794328272f},
-std::array<float,2>{0.70524627f, 0.730428278f},
-std::array<float,2>{0.271788359f, 0.0376020558f},
-std::array<float,2>{0.860047221f, 0.431787074f},
-std::array<float,2>{0.101151794f, 0.98911351f},
-std::array<float,2>{0.99402988f, 0.826703966f},
-std::array<float,2>{0.148163512f, 0.371206999f},
-std::array<float,2>{0.611537993f, 0.217728376f},
-std::array<float,2>{0.401629955f, 0.505182028f},
-std::array<float,2>{0.630229115f, 0.944412589f},
-std::array<float,2>{0.364019036f, 0.385534197f},
-std::array<float,2>{0.758767962f, 0.00247847126f},
-std::array<float,2>{0.00453442568f, 0.693950593f},
-std::array<float,2>{0.935001254f, 0.554192841f},
-std::array<float,2>{0.194740564f, 0.229683161f},
-std::array<float,2>{0.501468062f, 0.332822084f},
-std::array<float,2>{0.447041541f, 0.848154783f},
-std::array<float,2>{0.575051785f, 0.66598314f},
-std::array<float,2>{0.421581209f, 0.0862428769f},
-std::array<float,2>{0.959923267f, 0.476923257f},
-std::array<float,2>{0.156701744f, 0.878477395f},
-std::array<float,2>{0.820530713f, 0.765281737f},
-std::array<float,2>{0.080428116f, 0.287156343f},
-std::array<float,2>{0.748152435f, 0.127438098f},
-std::array<float,2>{0.286776602f, 0.587254643f},
-std::array<float,2>{0.558419585f, 0.817905307f},
-std::array<float,2>{0.473036706f, 0.362956971f},
-std::array<float,2>{0.898526728f, 0.206936494f},
-std::array<float,2>{0.233590394f, 0.510488689f},
-std::array<float,2>{0.782781124f, 0.724997163f},
-std::array<float,2>{0.0617379919f, 0.0426717959f},
-std::array<float,2>{0.677872598f, 0.425558329f},
-std::array<float,2>{0.316170424f, 0.995126605f},
-std::array<float,2>{0.696368515f, 0.600138187f},
-std::array<float,2>{0.253831118f, 0.160112366f},
-std::array<float,2>{0.854224682f, 0.252988338f},
-std::array<float,2>{0.112425849f, 0.78188169f},
-std::array<float,2>{0.968900979f, 0.936843812f},
-std::array<float,2>{0.127276137f, 0.45266971f},
-std::array<float,2>{0.607811987f, 0.1212212f},
-std::array<float,2>{0.382143319f, 0.62833643f},
-std::array<float,2>{0.732101977f, 0.811630428f},
-std::array<float,2>{0.298084706f, 0.275757372f},
-std::array<float,2>{0.839863539f, 0.172031835f},
-std::array<float,2>{0.0647435039f, 0.613178611f},
-std::array<float,2>{0.941019595f, 0.652263463f},
-std::array<float,2>{0.179461375f, 0.104433872f},
-std::array<float,2>{0.591716945f, 0.463072121f},
-std::array<float,2>{0.428423613f, 0.918721497f},
-std::array<float,2>{0.521167874f, 0.518264294f},
-std::array<float,2>{0.460094035f, 0.197150409f},
-std::array<float,2>{0.919730604f, 0.349363506f},
-std::array<float,2>{0.213760093f, 0.830194771f},
-std::array<float,2>{0.768650055f, 0.97584343f},
-std::array<float,2>{0.0260381587f, 0.421258271f},
-std::array<float,2>{0.654278994f, 0.0562372543f},
-std::array<float,2>{0.347234249f, 0.734416723f},
-std::array<float,2>{0.613472283f, 0.902334392f},
-std::array<float,2>{0.405581683f, 0.492916971f},
-std::array<float,2>{0.996660113f, 0.0762817487f},
-std::array<float,2>{0.141362652f, 0.680295527f},
-std::array<float,2>{0.864902675f, 0.569741845f},
-std::array<float,2>{0.0949939266f, 0.152013719f},
-std::array<float,2>{0.708889306f, 0.301010072f},
-std::array<float,2>{0.268979728f, 0.77622962f},
-std::array<float,2>{0.668954313f, 0.7083565f},
-std::array<float,2>{0.332495481f, 0.023925107f},
-std::array<float,2>{0.80749464f, 0.39205876f},
-std::array<float,2>{0.0466819145f, 0.960831225f},
-std::array<float,2>{0.876973271f, 0.866319716f},
-std::array<float,2>{0.24035728f, 0.326537728f},
-std::array<float,2>{0.536955178f, 0.247134522f},
-std::array<float,2>{0.498296857f, 0.540990829f},
-std::array<float,2>{0.711569071f, 0.913648963f},
-std::array<float,2>{0.277211726f, 0.453199089f},
-std::array<float,2>{0.870900631f, 0.0947819948f},
-std::array<float,2>{0.107477672f, 0.646849334f},
-std::array<float,2>{0.987664759f, 0.618126988f},
-std::array<float,2>{0.153874978f, 0.182099879f},
-std::array<float,2>{0.621227145f, 0.270615339f},
-std::array<float,2>{0.397806525f, 0.802252948f},
-std::array<float,2>{0.543682158f, 0.74723804f},
-std::array<float,2>{0.489804208f, 0.0472598821f},
-std::array<float,2>{0.88752687f, 0.40888679f},
-std::array<float,2>{0.249306679f, 0.981206894f},
-std::array<float,2>{0.803909719f, 0.84123987f},
-std::array<float,2>{0.0356527902f, 0.353089213f},
-std::array<float,2>{0.661817014f, 0.187644497f},
-std::array<float,2>{0.338380456f, 0.530665755f},
-std::array<float,2>{0.583991468f, 0.771936297f},
-std::array<float,2>{0.436726898f, 0.310432434f},
-std::array<float,2>{0.945780516f, 0.144204408f},
-std::array<float,2>{0.181619182f, 0.574540198f},
-std::array<float,2>{0.829055905f, 0.679331601f},
-std::array<float,2>{0.0772537664f, 0.0630396754f},
-std::array<float,2>{0.718830645f, 0.488486618f},
-std::array<float,2>{0.309899628f, 0.897954822f},
-std::array<float,2>{0.646529794f, 0.538702428f},
-std::array<float,2>{0.356201977f, 0.236352369f},
-std::array<float,2>{0.776491046f, 0.314802617f},
-std::array<float,2>{0.0182187669f, 0.870417118f},
-std::array<float,2>{0.913872778f, 0.965591431f},
-std::array<float,2>{0.206656247f, 0.403131992f},
-std::array<float,2>{0.525350511f, 0.0231790356f},
-std::array<float,2>{0.461625874f, 0.713241935f},
-std::array<float,2>{0.683232844f, 0.855908751f},
-std::array<float,2>{0.325998455f, 0.338406444f},
-std::array<float,2>{0.796662986f, 0.225983784f},
-std::array<float,2>{0.0506106429f, 0.562293053f},
-std::array<float,2>{0.890806437f, 0.698436141f},
-std::array<float,2>{0.221557707f, 0.0128974104f},
-std::array<float,2>{0.554602861f, 0.375245392f},
-std::array<float,2>{0.476762086f, 0.94728905f},
-std::array<float,2>{0.598210931f, 0.578591108f},
-std::array<float,2>{0.389107138f, 0.13445121f},
-std::array<float,2>{0.983466804f, 0.290353566f},
-std::array<float,2>{0.13297233f, 0.7503075f},
-std::array<float,2>{0.846747756f, 0.884304941f},
-std::array<float,2>{0.121209987f, 0.468929738f},
-std::array<float,2>{0.694946826f, 0.0782128721f},
-std::array<float,2>{0.265227139f, 0.660791397f},
-std::array<float,2>{0.512381673f, 0.988117158f},
-std::array<float,2>{0.438673913f, 0.436060935f},
-std::array<float,2>{0.928145647f, 0.0342467725f},
-std::array<float,2>{0.196659058f, 0.732526243f},
-std::array<float,2>{0.756230891f, 0.501985133f},
-std::array<float,2>{0.0136804134f, 0.211780369f},
-std::array<float,2>{0.636895835f, 0.370691359f},
-std::array<float,2>{0.374305069f, 0.823010981f},
-std::array<float,2>{0.738477111f, 0.638242126f},
-std::array<float,2>{0.2913782f, 0.114685744f},
-std::array<float,2>{0.812624395f, 0.440322757f},
-std::array<float,2>{0.0896118581f, 0.928712845f},
-std::array<float,2>{0.962806225f, 0.790654957f},
-std::array<float,2>{0.165078416f, 0.258700609f},
-std::array<float,2>{0.565300345f, 0.165044442f},
-std::array<float,2>{0.413266599f, 0.604289114f},
-std::array<float,2>{0.641928852f, 0.933102131f},
-std::array<float,2>{0.351794451f, 0.448255539f},
-std::array<float,2>{0.781104684f, 0.121018238f},
-std::array<float,2>{0.0223381333f, 0.63152647f},
-std::array<float,2>{0.907417715f, 0.59394455f},
-std::array<float,2>{0.208348274f, 0.163439333f},
-std::array<float,2>{0.527563214f, 0.25396359f},
-std::array<float,2>{0.467518419f, 0.785686553f},
-std::array<float,2>{0.580812931f, 0.718869567f},
-std::array<float,2>{0.42999199f, 0.0455976836f},
-std::array<float,2>{0.949423015f, 0.428159654f},
-std::array<float,2>{0.187368557f, 0.998991847f},
-std::array<float,2>{0.835251629f, 0.814391017f},
-std::array<float,2>{0.0713370442f, 0.366568327f},
-std::array<float,2>{0.722918987f, 0.20871833f},
-std::array<float,2>{0.30472675f, 0.514072359f},
-std::array<float,2>{0.539937973f, 0.758277535f},
-std::array<float,2>{0.487693369f, 0.282936126f},
-std::array<float,2>{0.883647144f, 0.128940091f},
-std::array<float,2>{0.244570017f, 0.590821803f},
-std::array<float,2>{0.798587263f, 0.669663131f},
-std::array<float,2>{0.03473619f, 0.0932436287f},
-std::array<float,2>{0.658740342f, 0.48352471f},
-std::array<float,2>{0.342446715f, 0.879915237f},
-std::array<float,2>{0.718430817f, 0.549451649f},
-std::array<float,2>{0.27976957f, 0.23182115f},
-std::array<float,2>{0.87206316f, 0.328785777f},
-std::array<float,2>{0.102081604f, 0.846298456f},
-std::array<float,2>{0.990110576f, 0.94135201f},
-std::array<float,2>{0.150270179f, 0.386978626f},
-std::array<float,2>{0.619703948f, 0.00740103424f},
-std::array<float,2>{0.394194365f, 0.689314842f},
-std::array<float,2>{0.736299336f, 0.859967411f},
-std::array<float,2>{0.296694756f, 0.32174024f},
-std::array<float,2>{0.81855303f, 0.244821593f},
-std::array<float,2>{0.0916279033f, 0.543944001f},
-std::array<float,2>{0.968392193f, 0.704326928f},
-std::array<float,2>{0.170318142f, 0.0294210725f},
-std::array<float,2>{0.56675607f, 0.397329509f},
-std::array<float,2>{0.406797737f, 0.954121828f},
-std::array<float,2>{0.509752631f, 0.564425349f},
-std::array<float,2>{0.442421854f, 0.153061882f},
-std::array<float,2>{0.92411226f, 0.29967615f},
-std::array<float,2>{0.202510938f, 0.780042887f},
-std::array<float,2>{0.750742555f, 0.904595017f},
-std::array<float,2>{0.0083686281f, 0.499709845f},
-std::array<float,2>{0.634017944f, 0.0710112751f},
-std::array<float,2>{0.370467037f, 0.68492204f},
-std::array<float,2>{0.596090138f, 0.968755484f},
-std::array<float,2>{0.382838756f, 0.415231586f},
-std::array<float,2>{0.977965534f, 0.0597541258f},
-std::array<float,2>{0.140092343f, 0.739079595f},
-std::array<float,2>{0.850429833f, 0.520831883f},
-std::array<float,2>{0.12057735f, 0.200111955f},
-std::array<float,2>{0.687619507f, 0.344805539f},
-std::array<float,2>{0.261326402f, 0.834836006f},
-std::array<float,2>{0.685382247f, 0.654117525f},
-std::array<float,2>{0.32070893f, 0.106550209f},
-std::array<float,2>{0.791605651f, 0.466168076f},
-std::array<float,2>{0.0523550883f, 0.915470362f},
-std::array<float,2>{0.895395875f, 0.807509422f},
-std::array<float,2>{0.224727839f, 0.279702008f},
-std::array<float,2>{0.547857225f, 0.176128134f},
-std::array<float,2>{0.482003599f, 0.614710629f},
-std::array<float,2>{0.701571643f, 0.963373125f},
-std::array<float,2>{0.255084246f, 0.400801331f},
-std::array<float,2>{0.856348038f, 0.0176909454f},
-std::array<float,2>{0.116499104f, 0.716225982f},
-std::array<float,2>{0.97360599f, 0.531413019f},
-std::array<float,2>{0.131881714f, 0.239429146f},
-std::array<float,2>{0.601658881f, 0.319213122f},
-std::array<float,2>{0.375248849f, 0.873939991f},
-std::array<float,2>{0.560354471f, 0.673098683f},
-std::array<float,2>{0.47010839f, 0.0682406053f},
-std::array<float,2>{0.904809833f, 0.486554891f},
-std::array<float,2>{0.228573903f, 0.890969038f},
-std::array<float,2>{0.785623133f, 0.766762674f},
-std::array<float,2>{0.0559515916f, 0.306310147f},
-std::array<float,2>{0.674090743f, 0.147284195f},
-std::array<float,2>{0.319852829f, 0.574045777f},
-std::array<float,2>{0.571995378f, 0.839502633f},
-std::array<float,2>{0.414321065f, 0.357777685f},
-std::array<float,2>{0.953494489f, 0.193118304f},
-std::array<float,2>{0.161019742f, 0.524984002f},
-std::array<float,2>{0.82584244f, 0.742298901f},
-std::array<float,2>{0.084499076f, 0.0513805002f},
-std::array<float,2>{0.745093286f, 0.411562979f},
-std::array<float,2>{0.28495568f, 0.979367614f},
-std::array<float,2>{0.62850368f, 0.624165654f},
-std::array<float,2>{0.362976611f, 0.184959903f},
-std::array<float,2>{0.76404804f, 0.268917173f},
-std::array<float,2>{0.00275938003f, 0.798511326f},
-std::array<float,2>{0.932943225f, 0.908317566f},
-std::array<float,2>{0.188255474f, 0.459676087f},
-std::array<float,2>{0.506637752f, 0.0990389287f},
-std::array<float,2>{0.449943334f, 0.643857121f},
-std::array<float,2>{0.665331602f, 0.795057535f},
-std::array<float,2>{0.330364525f, 0.26391843f},
-std::array<float,2>{0.810946584f, 0.170682371f},
-std::array<float,2>{0.039590504f, 0.607398152f},
-std::array<float,2>{0.882733226f, 0.634650826f},
-std::array<float,2>{0.23718223f, 0.112211384f},
-std::array<float,2>{0.532799363f, 0.445138931f},
-std::array<float,2>{0.493108839f, 0.923078895f},
-std::array<float,2>{0.609476984f, 0.507492304f},
-std::array<float,2>{0.399197221f, 0.216703087f},
-std::array<float,2>{0.994418442f, 0.373767167f},
-std::array<float,2>{0.145142898f, 0.824612916f},
-std::array<float,2>{0.863129318f, 0.990591764f},
-std::array<float,2>{0.0989895314f, 0.430871934f},
-std::array<float,2>{0.703845441f, 0.0367860273f},
-std::array<float,2>{0.271424025f, 0.727030218f},
-std::array<float,2>{0.517145634f, 0.890027463f},
-std::array<float,2>{0.454529822f, 0.475155324f},
-std::array<float,2>{0.917613268f, 0.083498925f},
-std::array<float,2>{0.216918677f, 0.65997839f},
-std::array<float,2>{0.772807956f, 0.584261537f},
-std::array<float,2>{0.0288872626f, 0.136941105f},
-std::array<float,2>{0.649821937f, 0.295263112f},
-std::array<float,2>{0.347963631f, 0.755083501f},
-std::array<float,2>{0.726630569f, 0.70244199f},
-std::array<float,2>{0.304044127f, 0.0098820515f},
-std::array<float,2>{0.837004185f, 0.379383355f},
-std::array<float,2>{0.0696487278f, 0.951682746f},
-std::array<float,2>{0.942005277f, 0.85321492f},
-std::array<float,2>{0.172521412f, 0.341352314f},
-std::array<float,2>{0.589535296f, 0.219107866f},
-std::array<float,2>{0.422971904f, 0.554709911f},
-std::array<float,2>{0.677466333f, 0.992716849f},
-std::array<float,2>{0.312708199f, 0.422877014f},
-std::array<float,2>{0.78337115f, 0.0399590991f},
-std::array<float,2>{0.0596732683f, 0.723459005f},
-std::array<float,2>{0.902291656f, 0.508472741f},
-std::array<float,2>{0.232106f, 0.203181967f},
-std::array<float,2>{0.556218982f, 0.359476119f},
-std::array<float,2>{0.475266039f, 0.819273233f},
-std::array<float,2>{0.60710144f, 0.625206888f},
-std::array<float,2>{0.380294949f, 0.12460646f},
-std::array<float,2>{0.97186327f, 0.449617386f},
-std::array<float,2>{0.125294402f, 0.934589624f},
-std::array<float,2>{0.853016436f, 0.783391893f},
-std::array<float,2>{0.11070139f, 0.250494719f},
-std::array<float,2>{0.699042797f, 0.157188028f},
-std::array<float,2>{0.251465499f, 0.598656595f},
-std::array<float,2>{0.502847493f, 0.85014832f},
-std::array<float,2>{0.448127508f, 0.334847838f},
-std::array<float,2>{0.935758233f, 0.227656931f},
-std::array<float,2>{0.193206385f, 0.551686049f},
-std::array<float,2>{0.761717916f, 0.693191528f},
-std::array<float,2>{0.00649256306f, 0.00182514789f},
-std::array<float,2>{0.631205499f, 0.383811116f},
-std::array<float,2>{0.366530031f, 0.942909002f},
-std::array<float,2>{0.747979462f, 0.589387596f},
-std::array<float,2>{0.288535178f, 0.126029909f},
-std::array<float,2>{0.823009074f, 0.286829352f},
-std::array<float,2>{0.079441689f, 0.763543427f},
-std::array<float,2>{0.957850456f, 0.876533806f},
-std::array<float,2>{0.15943633f, 0.479115427f},
-std::array<float,2>{0.576813042f, 0.0884513706f},
-std::array<float,2>{0.419789612f, 0.666350484f},
-std::array<float,2>{0.710159004f, 0.775021315f},
-std::array<float,2>{0.266479909f, 0.303714097f},
-std::array<float,2>{0.865375876f, 0.148655027f},
-std::array<float,2>{0.0972579792f, 0.568049073f},
-std::array<float,2>{0.998417377f, 0.682467937f},
-std::array<float,2>{0.144074291f, 0.0758529529f},
-std::array<float,2>{0.617075741f, 0.494745612f},
-std::array<float,2>{0.403565943f, 0.899001002f},
-std::array<float,2>{0.538497984f, 0.542373717f},
-std::array<float,2>{0.496169418f, 0.248638541f},
-std::array<float,2>{0.876402676f, 0.326028913f},
-std::array<float,2>{0.240138754f, 0.863438368f},
-std::array<float,2>{0.806328177f, 0.958294928f},
-std::array<float,2>{0.0432001278f, 0.394199073f},
-std::array<float,2>{0.669949949f, 0.0259800777f},
-std::array<float,2>{0.335211396f, 0.709853947f},
-std::array<float,2>{0.592154741f, 0.921717465f},
-std::array<float,2>{0.427469194f, 0.462127388f},
-std::array<float,2>{0.939322352f, 0.101646714f},
-std::array<float,2>{0.176742792f, 0.650137424f},
-std::array<float,2>{0.841847897f, 0.61112994f},
-std::array<float,2>{0.0642935038f, 0.175400198f},
-std::array<float,2>{0.732520223f, 0.273650825f},
-std::array<float,2>{0.29990676f, 0.809341013f},
-std::array<float,2>{0.656060755f, 0.737364411f},
-std::array<float,2>{0.344842106f, 0.0580363609f},
-std::array<float,2>{0.76674813f, 0.418043435f},
-std::array<float,2>{0.0246383008f, 0.97297281f},
-std::array<float,2>{0.921716571f, 0.828402281f},
-std::array<float,2>{0.211904407f, 0.351535439f},
-std::array<float,2>{0.522418201f, 0.19920674f},
-std::array<float,2>{0.458567917f, 0.51743269f},
-std::array<float,2>{0.722552419f, 0.895359755f},
-std::array<float,2>{0.311322272f, 0.491506755f},
-std::array<float,2>{0.831481159f, 0.0658797696f},
-std::array<float,2>{0.0748863444f, 0.675869107f},
-std::array<float,2>{0.948642492f, 0.576314449f},
-std::array<float,2>{0.18174246f, 0.141963989f},
-std::array<float,2>{0.582284451f, 0.311389267f},
-std::array<float,2>{0.433925569f, 0.77129966f},
-std::array<float,2>{0.527056754f, 0.712767899f},
-std::array<float,2>{0.464085251f, 0.0195612106f},
-std::array<float,2>{0.91050607f, 0.40609467f},
-std::array<float,2>{0.204485551f, 0.966915786f},
-std::array<float,2>{0.773586333f, 0.868034899f},
-std::array<float,2>{0.0159775205f, 0.312500685f},
-std::array<float,2>{0.644798517f, 0.235886872f},
-std::array<float,2>{0.358420253f, 0.53518784f},
-std::array<float,2>{0.624545991f, 0.803292036f},
-std::array<float,2>{0.396233827f, 0.27235508f},
-std::array<float,2>{0.985002279f, 0.181050763f},
-std::array<float,2>{0.15539442f, 0.620134592f},
-std::array<float,2>{0.868633926f, 0.646305442f},
-std::array<float,2>{0.106217369f, 0.0975501388f},
-std::array<float,2>{0.714810729f, 0.456402749f},
-std::array<float,2>{0.274209499f, 0.911632657f},
-std::array<float,2>{0.662964284f, 0.52825737f},
-std::array<float,2>{0.336332053f, 0.19118762f},
-std::array<float,2>{0.802331924f, 0.353558928f},
-std::array<float,2>{0.0380021706f, 0.842879415f},
-std::array<float,2>{0.889210999f, 0.983153462f},
-std::array<float,2>{0.247631297f, 0.40674451f},
-std::array<float,2>{0.545354128f, 0.0505404249f},
-std::array<float,2>{0.490706086f, 0.748452902f},
-std::array<float,2>{0.640224457f, 0.822040617f},
-std::array<float,2>{0.372277945f, 0.367875934f},
-std::array<float,2>{0.754073024f, 0.213083223f},
-std::array<float,2>{0.0119135529f, 0.500247419f},
-std::array<float,2>{0.927235842f, 0.730821192f},
-std::array<float,2>{0.199099794f, 0.0320325308f},
-std::array<float,2>{0.515057445f, 0.433735967f},
-std::array<float,2>{0.44035849f, 0.985575795f},
-std::array<float,2>{0.564239323f, 0.602072954f},
-std::array<float,2>{0.411521614f, 0.166988954f},
-std::array<float,2>{0.963035345f, 0.260315537f},
-std::array<float,2>{0.166942164f, 0.792826474f},
-std::array<float,2>{0.815413117f, 0.92749238f},
-std::array<float,2>{0.087472938f, 0.43890664f},
-std::array<float,2>{0.742090344f, 0.115548871f},
-std::array<float,2>{0.289652407f, 0.639330685f},
-std::array<float,2>{0.55218935f, 0.946606934f},
-std::array<float,2>{0.479004651f, 0.378001034f},
-std::array<float,2>{0.892814636f, 0.0138163175f},
-std::array<float,2>{0.219455138f, 0.697025776f},
-std::array<float,2>{0.794240236f, 0.559261441f},
-std::array<float,2>{0.0476914532f, 0.223479494f},
-std::array<float,2>{0.681507587f, 0.337244898f},
-std::array<float,2>{0.327139437f, 0.858025968f},
-std::array<float,2>{0.692576706f, 0.662803352f},
-std::array<float,2>{0.262613803f, 0.081158869f},
-std::array<float,2>{0.84492135f, 0.471150368f},
-std::array<float,2>{0.124237977f, 0.88593328f},
-std::array<float,2>{0.982230783f, 0.753745258f},
-std::array<float,2>{0.136652187f, 0.292682171f},
-std::array<float,2>{0.599869967f, 0.136646956f},
-std::array<float,2>{0.387436181f, 0.581648529f},
-std::array<float,2>{0.686421156f, 0.914533317f},
-std::array<float,2>{0.322978318f, 0.4650805f},
-std::array<float,2>{0.790836155f, 0.106049947f},
-std::array<float,2>{0.0536696054f, 0.653103292f},
-std::array<float,2>{0.896907508f, 0.614004791f},
-std::array<float,2>{0.223721102f, 0.177026406f},
-std::array<float,2>{0.54935503f, 0.28119877f},
-std::array<float,2>{0.483515918f, 0.808361411f},
-std::array<float,2>{0.595522761f, 0.739368558f},
-std::array<float,2>{0.386212856f, 0.058665514f},
-std::array<float,2>{0.980338931f, 0.414540201f},
-std::array<float,2>{0.136992097f, 0.96996516f},
-std::array<float,2>{0.848849237f, 0.835266769f},
-std::array<float,2>{0.117316589f, 0.343907952f},
-std::array<float,2>{0.69062531f, 0.200379252f},
-std::array<float,2>{0.258220494f, 0.519852996f},
-std::array<float,2>{0.51053232f, 0.780428231f},
-std::array<float,2>{0.44341296f, 0.300283492f},
-std::array<float,2>{0.923418105f, 0.153355971f},
-std::array<float,2>{0.200367615f, 0.563205957f},
-std::array<float,2>{0.753751755f, 0.684544563f},
-std::array<float,2>{0.0115068154f, 0.071868971f},
-std::array<float,2>{0.635678232f, 0.498744041f},
-std::array<float,2>{0.367842466f, 0.905635655f},
-std::array<float,2>{0.737512827f, 0.544341445f},
-std::array<float,2>{0.293307096f, 0.245931059f},
-std::array<float,2>{0.816963971f, 0.320750266f},
-std::array<float,2>{0.0931049809f, 0.860774219f},
-std::array<float,2>{0.966546297f, 0.953297198f},
-std::array<float,2>{0.168372169f, 0.398132265f},
-std::array<float,2>{0.568999231f, 0.0310457814f},
-std::array<float,2>{0.409705788f, 0.703485429f},
-std::array<float,2>{0.716161966f, 0.84750247f},
-std::array<float,2>{0.277507216f, 0.329246461f},
-std::array<float,2>{0.874760687f, 0.23140803f},
-std::array<float,2>{0.103746377f, 0.550118744f},
-std::array<float,2>{0.991672814f, 0.687753677f},
-std::array<float,2>{0.152277887f, 0.00593796512f},
-std::array<float,2>{0.618003428f, 0.387872785f},
-std::array<float,2>{0.391690463f, 0.939800441f},
-std::array<float,2>{0.54112798f, 0.590420127f},
-std::array<float,2>{0.484873384f, 0.129946738f},
-std::array<float,2>{0.885221303f, 0.281449944f},
-std::array<float,2>{0.243048534f, 0.759753168f},
-std::array<float,2>{0.799626827f, 0.879509568f},
-std::array<float,2>{0.0321708247f, 0.482959867f},
-std::array<float,2>{0.656727135f, 0.0926232561f},
-std::array<float,2>{0.341469586f, 0.668570995f},
-std::array<float,2>{0.578248799f, 0.999224782f},
-std::array<float,2>{0.433369398f, 0.428789586f},
-std::array<float,2>{0.951251626f, 0.0463559851f},
-std::array<float,2>{0.184573159f, 0.720295787f},
-std::array<float,2>{0.832469046f, 0.5152421f},
-std::array<float,2>{0.0741659999f, 0.207162678f},
-std::array<float,2>{0.726131737f, 0.365794212f},
-std::array<float,2>{0.308280051f, 0.812651157f},
-std::array<float,2>{0.644105852f, 0.631958306f},
-std::array<float,2>{0.353580773f, 0.119557641f},
-std::array<float,2>{0.779149234f, 0.447714716f},
-std::array<float,2>{0.0197410639f, 0.931753933f},
-std::array<float,2>{0.90855509f, 0.786991894f},
-std::array<float,2>{0.20996888f, 0.25522247f},
-std::array<float,2>{0.530212343f, 0.163040668f},
-std::array<float,2>{0.46655333f, 0.594756663f},
-std::array<float,2>{0.730230689f, 0.9528265f},
-std::array<float,2>{0.30141449f, 0.380819082f},
-std::array<float,2>{0.839655697f, 0.0114941774f},
-std::array<float,2>{0.0669978037f, 0.701930463f},
-std::array<float,2>{0.94449985f, 0.556227207f},
-std::array<float,2>{0.175696403f, 0.220423684f},
-std::array<float,2>{0.587815762f, 0.340699375f},
-std::array<float,2>{0.424378604f, 0.851847351f},
-std::array<float,2>{0.51840502f, 0.658265054f},
-std::array<float,2>{0.45596543f, 0.082363911f},
-std::array<float,2>{0.91511035f, 0.476079166f},
-std::array<float,2>{0.214959756f, 0.889263332f},
-std::array<float,2>{0.770015001f, 0.75463891f},
-std::array<float,2>{0.0308531914f, 0.296599954f},
-std::array<float,2>{0.651194632f, 0.137925968f},
-std::array<float,2>{0.349635303f, 0.585326254f},
-std::array<float,2>{0.613221645f, 0.825261235f},
-std::array<float,2>{0.401027262f, 0.374868512f},
-std::array<float,2>{0.992801726f, 0.215409368f},
-std::array<float,2>{0.146514893f, 0.506296515f},
-std::array<float,2>{0.860415339f, 0.728484154f},
-std::array<float,2>{0.100091845f, 0.0353948064f},
-std::array<float,2>{0.706379831f, 0.430117279f},
-std::array<float,2>{0.272725046f, 0.99169296f},
-std::array<float,2>{0.666477203f, 0.606294334f},
-std::array<float,2>{0.328585982f, 0.171731174f},
-std::array<float,2>{0.808705688f, 0.265575767f},
-std::array<float,2>{0.0421467833f, 0.796769261f},
-std::array<float,2>{0.880842566f, 0.922595263f},
-std::array<float,2>{0.235077769f, 0.443370491f},
-std::array<float,2>{0.534264147f, 0.113156542f},
-std::array<float,2>{0.494196147f, 0.6330266f},
-std::array<float,2>{0.625890732f, 0.797766089f},
-std::array<float,2>{0.361301631f, 0.267724305f},
-std::array<float,2>{0.763194203f, 0.184443921f},
-std::array<float,2>{0.00145856978f, 0.623875678f},
-std::array<float,2>{0.930384636f, 0.643272996f},
-std::array<float,2>{0.190141633f, 0.0982756391f},
-std::array<float,2>{0.504747212f, 0.460025996f},
-std::array<float,2>{0.451634794f, 0.909402788f},
-std::array<float,2>{0.573793292f, 0.523500979f},
-std::array<float,2>{0.416244268f, 0.19215095f},
-std::array<float,2>{0.956183553f, 0.358783782f},
-std::array<float,2>{0.163334444f, 0.838001728f},
-std::array<float,2>{0.826352298f, 0.980006039f},
-std::array<float,2>{0.08209645f, 0.410337031f},
-std::array<float,2>{0.742849112f, 0.0523508266f},
-std::array<float,2>{0.283083051f, 0.743864179f},
-std::array<float,2>{0.562330186f, 0.891711771f},
-std::array<float,2>{0.472368866f, 0.488130569f},
-std::array<float,2>{0.902635217f, 0.0665848106f},
-std::array<float,2>{0.227707818f, 0.672525704f},
-std::array<float,2>{0.788571119f, 0.572727621f},
-std::array<float,2>{0.0570829622f, 0.148052767f},
-std::array<float,2>{0.67307508f, 0.304764301f},
-std::array<float,2>{0.318317413f, 0.766204178f},
-std::array<float,2>{0.7004686f, 0.715156794f},
-std::array<float,2>{0.256086677f, 0.0187693313f},
-std::array<float,2>{0.858409822f, 0.402115345f},
-std::array<float,2>{0.113706067f, 0.964526117f},
-std::array<float,2>{0.976246476f, 0.874551773f},
-std::array<float,2>{0.129640028f, 0.319645703f},
-std::array<float,2>{0.605289578f, 0.238453582f},
-std::array<float,2>{0.377028316f, 0.532465279f},
-std::array<float,2>{0.653024077f, 0.974170268f},
-std::array<float,2>{0.345867008f, 0.419392645f},
-std::array<float,2>{0.767649949f, 0.0569246598f},
-std::array<float,2>{0.0271197874f, 0.736544609f},
-std::array<float,2>{0.918424964f, 0.516336024f},
-std::array<float,2>{0.214692369f, 0.198136702f},
-std::array<float,2>{0.520305634f, 0.35050562f},
-std::array<float,2>{0.459083408f, 0.829892755f},
-std::array<float,2>{0.59011364f, 0.6485098f},
-std::array<float,2>{0.429619938f, 0.10344249f},
-std::array<float,2>{0.939487875f, 0.461427569f},
-std::array<float,2>{0.178195193f, 0.920558691f},
-std::array<float,2>{0.841202438f, 0.810173213f},
-std::array<float,2>{0.0661065951f, 0.275325447f},
-std::array<float,2>{0.730969369f, 0.17470479f},
-std::array<float,2>{0.29779774f, 0.610122681f},
-std::array<float,2>{0.535390258f, 0.864789307f},
-std::array<float,2>{0.499616742f, 0.324719518f},
-std::array<float,2>{0.878228724f, 0.249831289f},
-std::array<float,2>{0.241855204f, 0.541443825f},
-std::array<float,2>{0.807873487f, 0.710080624f},
-std::array<float,2>{0.0456779115f, 0.0271987915f},
-std::array<float,2>{0.668798566f, 0.393252224f},
-std::array<float,2>{0.333486617f, 0.95778662f},
-std::array<float,2>{0.707176924f, 0.567357004f},
-std::array<float,2>{0.267632544f, 0.149502769f},
-std::array<float,2>{0.86345011f, 0.302854806f},
-std::array<float,2>{0.0940822959f, 0.773682058f},
-std::array<float,2>{0.997698784f, 0.899479985f},
-std::array<float,2>{0.142137602f, 0.496065915f},
-std::array<float,2>{0.615179956f, 0.0744120926f},
-std::array<float,2>{0.404642761f, 0.68295455f},
-std::array<float,2>{0.749175429f, 0.762174189f},
-std::array<float,2>{0.28525719f, 0.285257757f},
-std::array<float,2>{0.821440816f, 0.125213549f},
-std::array<float,2>{0.0817235336f, 0.588236511f},
-std::array<float,2>{0.960917473f, 0.66769284f},
-std::array<float,2>{0.158027783f, 0.0890353993f},
-std::array<float,2>{0.575952113f, 0.480111629f},
-std::array<float,2>{0.420014262f, 0.87574327f},
-std::array<float,2>{0.500485957f, 0.551839411f},
-std::array<float,2>{0.445540428f, 0.227183118f},
-std::array<float,2>{0.934022188f, 0.335227162f},
-std::array<float,2>{0.194186315f, 0.850676477f},
-std::array<float,2>{0.759249806f, 0.941598654f},
-std::array<float,2>{0.00553973112f, 0.383770943f},
-std::array<float,2>{0.629010379f, 0.000489973638f},
-std::array<float,2>{0.364893168f, 0.691830516f},
-std::array<float,2>{0.608996212f, 0.933747232f},
-std::array<float,2>{0.381501734f, 0.450432628f},
-std::array<float,2>{0.969998717f, 0.123919532f},
-std::array<float,2>{0.128440693f, 0.626165092f},
-std::array<float,2>{0.854982555f, 0.598028541f},
-std::array<float,2>{0.111442477f, 0.157473207f},
-std::array<float,2>{0.696208417f, 0.251421511f},
-std::array<float,2>{0.252720326f, 0.784650683f},
-std::array<float,2>{0.67952472f, 0.723695397f},
-std::array<float,2>{0.31462115f, 0.040278621f},
-std::array<float,2>{0.781950831f, 0.422423124f},
-std::array<float,2>{0.0605782904f, 0.993828773f},
-std::array<float,2>{0.90000248f, 0.819569468f},
-std::array<float,2>{0.233022645f, 0.360686719f},
-std::array<float,2>{0.557577074f, 0.204110056f},
-std::array<float,2>{0.474558294f, 0.509088635f},
-std::array<float,2>{0.693756104f, 0.884859383f},
-std::array<float,2>{0.263931841f, 0.471828371f},
-std::array<float,2>{0.846020043f, 0.0801097751f},
-std::array<float,2>{0.122197554f, 0.66364038f},
-std::array<float,2>{0.982699037f, 0.580836952f},
-std::array<float,2>{0.134607866f, 0.134906843f},
-std::array<float,2>{0.599106669f, 0.291686624f},
-std::array<float,2>{0.389785439f, 0.752674162f},
-std::array<float,2>{0.553112984f, 0.696046054f},
-std::array<float,2>{0.478057235f, 0.0149589991f},
-std::array<float,2>{0.891974092f, 0.377606064f},
-std::array<float,2>{0.222563565f, 0.946074843f},
-std::array<float,2>{0.795473695f, 0.85872364f},
-std::array<float,2>{0.0497176535f, 0.336649925f},
-std::array<float,2>{0.681967497f, 0.224383771f},
-std::array<float,2>{0.324526906f, 0.559650779f},
-std::array<float,2>{0.565980077f, 0.791968942f},
-std::array<float,2>{0.412234694f, 0.260955662f},
-std::array<float,2>{0.961314976f, 0.167104498f},
-std::array<float,2>{0.164277017f, 0.603457212f},
-std::array<float,2>{0.813831091f, 0.640478492f},
-std::array<float,2>{0.0884213671f, 0.11644531f},
-std::array<float,2>{0.739570618f, 0.438200474f},
-std::array<float,2>{0.292462319f, 0.926475525f},
-std::array<float,2>{0.638563097f, 0.501275361f},
-std::array<float,2>{0.373515755f, 0.214151949f},
-std::array<float,2>{0.757480443f, 0.368678749f},
-std::array<float,2>{0.015209157f, 0.821104228f},
-std::array<float,2>{0.929337084f, 0.985043228f},
-std::array<float,2>{0.195988238f, 0.435277611f},
-std::array<float,2>{0.513255596f, 0.0322438031f},
-std::array<float,2>{0.437897742f, 0.731597662f},
-std::array<float,2>{0.660844088f, 0.842009187f},
-std::array<float,2>{0.339836597f, 0.354974449f},
-std::array<float,2>{0.803652883f, 0.190160453f},
-std::array<float,2>{0.0363403f, 0.528433383f},
-std::array<float,2>{0.887770474f, 0.74953109f},
-std::array<float,2>{0.248883933f, 0.0496458597f},
-std::array<float,2>{0.54428345f, 0.407607228f},
-std::array<float,2>{0.488648295f, 0.983927429f},
-std::array<float,2>{0.622425079f, 0.61935699f},
-std::array<float,2>{0.396969706f, 0.180028081f},
-std::array<float,2>{0.986975193f, 0.272899687f},
-std::array<float,2>{0.15252839f, 0.803928316f},
-std::array<float,2>{0.869357467f, 0.911035299f},
-std::array<float,2>{0.108734354f, 0.455545038f},
-std::array<float,2>{0.71258378f, 0.0962489769f},
-std::array<float,2>{0.276343942f, 0.644540012f},
-std::array<float,2>{0.523805618f, 0.968714416f},
-std::array<float,2>{0.462398767f, 0.404668629f},
-std::array<float,2>{0.912170947f, 0.0209544785f},
-std::array<float,2>{0.205868468f, 0.711610079f},
-std::array<float,2>{0.775902987f, 0.536296427f},
-std::array<float,2>{0.0188969038f, 0.235141441f},
-std::array<float,2>{0.648092389f, 0.314126402f},
-std::array<float,2>{0.356715918f, 0.86866641f},
-std::array<float,2>{0.72063148f, 0.677708745f},
-std::array<float,2>{0.309513688f, 0.0652855039f},
-std::array<float,2>{0.829506576f, 0.490642816f},
-std::array<float,2>{0.0770891309f, 0.895828724f},
-std::array<float,2>{0.946487963f, 0.769660711f},
-std::array<float,2>{0.18003805f, 0.31226477f},
-std::array<float,2>{0.585671544f, 0.141254574f},
-std::array<float,2>{0.435875893f, 0.578088284f},
-std::array<float,2>{0.632987738f, 0.902998805f},
-std::array<float,2>{0.369188488f, 0.496655881f},
-std::array<float,2>{0.751250088f, 0.073279351f},
-std::array<float,2>{0.00912623666f, 0.687447846f},
-std::array<float,2>{0.925211966f, 0.565653265f},
-std::array<float,2>{0.201908544f, 0.154644907f},
-std::array<float,2>{0.508149862f, 0.296970874f},
-std::array<float,2>{0.441598862f, 0.777543247f},
-std::array<float,2>{0.567756236f, 0.705662429f},
-std::array<float,2>{0.407864898f, 0.0292362068f},
-std::array<float,2>{0.967290223f, 0.395324677f},
-std::array<float,2>{0.171455041f, 0.956692517f},
-std::array<float,2>{0.819913507f, 0.862689555f},
-std::array<float,2>{0.0905199349f, 0.323048502f},
-std::array<float,2>{0.734492242f, 0.24410902f},
-std::array<float,2>{0.29521808f, 0.545811355f},
-std::array<float,2>{0.547447145f, 0.805441976f},
-std::array<float,2>{0.480772525f, 0.277859688f},
-std::array<float,2>{0.896054506f, 0.178626955f},
-std::array<float,2>{0.226488441f, 0.615754545f},
-std::array<float,2>{0.792576015f, 0.654953539f},
-std::array<float,2>{0.0514118113f, 0.108119078f},
-std::array<float,2>{0.684215009f, 0.468641818f},
-std::array<float,2>{0.32173717f, 0.916640937f},
-std::array<float,2>{0.688918889f, 0.5216977f},
-std::array<float,2>{0.259847373f, 0.20292604f},
-std::array<float,2>{0.850753009f, 0.346817017f},
-std::array<float,2>{0.119425006f, 0.83278656f},
-std::array<float,2>{0.97665602f, 0.971131742f},
-std::array<float,2>{0.13885434f, 0.417545736f},
-std::array<float,2>{0.597466886f, 0.0611981414f},
-std::array<float,2>{0.384153664f, 0.741855085f},
-std::array<float,2>{0.724082649f, 0.814969897f},
-std::array<float,2>{0.30584231f, 0.364164293f},
-std::array<float,2>{0.834127665f, 0.209258437f},
-std::array<float,2>{0.0706092417f, 0.512895763f},
-std::array<float,2>{0.950384021f, 0.722589076f},
-std::array<float,2>{0.185678393f, 0.0446795933f},
-std::array<float,2>{0.581356645f, 0.426099122f},
-std::array<float,2>{0.431178659f, 0.997615635f},
-std::array<float,2>{0.52874738f, 0.595770419f},
-std::array<float,2>{0.468194366f, 0.160697952f},
-std::array<float,2>{0.907134414f, 0.257357359f},
-std::array<float,2>{0.207060724f, 0.787752211f},
-std::array<float,2>{0.779877663f, 0.930096209f},
-std::array<float,2>{0.0227491073f, 0.445486665f},
-std::array<float,2>{0.640739679f, 0.118050031f},
-std::array<float,2>{0.35345754f, 0.629352033f},
-std::array<float,2>{0.62068516f, 0.939440429f},
-std::array<float,2>{0.392899305f, 0.390541434f},
-std::array<float,2>{0.988412321f, 0.00395756634f},
-std::array<float,2>{0.148917422f, 0.691052437f},
-std::array<float,2>{0.872354567f, 0.547766984f},
-std::array<float,2>{0.102654271f, 0.233753324f},
-std::array<float,2>{0.717149734f, 0.331339449f},
-std::array<float,2>{0.280365109f, 0.843772471f},
-std::array<float,2>{0.659875631f, 0.671450138f},
-std::array<float,2>{0.343613088f, 0.0911029577f},
-std::array<float,2>{0.7973122f, 0.481325626f},
-std::array<float,2>{0.0338607766f, 0.881946564f},
-std::array<float,2>{0.884651065f, 0.761258125f},
-std::array<float,2>{0.245631158f, 0.283231646f},
-std::array<float,2>{0.540751517f, 0.132285565f},
-std::array<float,2>{0.486702859f, 0.593427539f},
-std::array<float,2>{0.704277456f, 0.989895761f},
-std::array<float,2>{0.269873619f, 0.433279872f},
-std::array<float,2>{0.861630678f, 0.0384028703f},
-std::array<float,2>{0.0981199518f, 0.729356527f},
-std::array<float,2>{0.995873928f, 0.504707634f},
-std::array<float,2>{0.14563334f, 0.217800722f},
-std::array<float,2>{0.61123091f, 0.372468084f},
-std::array<float,2>{0.399427652f, 0.827341259f},
-std::array<float,2>{0.532020628f, 0.636325598f},
-std::array<float,2>{0.493766636f, 0.109808937f},
-std::array<float,2>{0.881157815f, 0.442305773f},
-std::array<float,2>{0.237343132f, 0.925320864f},
-std::array<float,2>{0.811603367f, 0.793570757f},
-std::array<float,2>{0.0402677618f, 0.262734115f},
-std::array<float,2>{0.664594769f, 0.168199331f},
-std::array<float,2>{0.331742615f, 0.607545555f},
-std::array<float,2>{0.588137627f, 0.855202675f},
-std::array<float,2>{0.422027171f, 0.343692482f},
-std::array<float,2>{0.942644775f, 0.221384138f},
-std::array<float,2>{0.173078448f, 0.558009148f},
-std::array<float,2>{0.83594346f, 0.699855506f},
-std::array<float,2>{0.069008559f, 0.00958274305f},
-std::array<float,2>{0.728326619f, 0.382253975f},
-std::array<float,2>{0.303330392f, 0.949227929f},
-std::array<float,2>{0.648600817f, 0.58397305f},
-std::array<float,2>{0.349226028f, 0.140226007f},
-std::array<float,2>{0.772239029f, 0.294269592f},
-std::array<float,2>{0.0274401922f, 0.756393135f},
-std::array<float,2>{0.916410625f, 0.887732863f},
-std::array<float,2>{0.218336865f, 0.474266022f},
-std::array<float,2>{0.515931606f, 0.0854792744f},
-std::array<float,2>{0.453194112f, 0.65683049f},
-std::array<float,2>{0.675198317f, 0.768041849f},
-std::array<float,2>{0.318369001f, 0.307956696f},
-std::array<float,2>{0.786660731f, 0.145671785f},
-std::array<float,2>{0.0547100343f, 0.572106659f},
-std::array<float,2>{0.906179726f, 0.674602807f},
-std::array<float,2>{0.230317459f, 0.0700628385f},
-std::array<float,2>{0.559289336f, 0.486112177f},
-std::array<float,2>{0.468914747f, 0.89343667f},
-std::array<float,2>{0.603157103f, 0.533550262f},
-std::array<float,2>{0.376369417f, 0.241489798f},
-std::array<float,2>{0.974366605f, 0.318223536f},
-std::array<float,2>{0.131487682f, 0.871623874f},
-std::array<float,2>{0.856531024f, 0.96244663f},
-std::array<float,2>{0.115499556f, 0.399650872f},
-std::array<float,2>{0.703006506f, 0.0175219122f},
-std::array<float,2>{0.254463881f, 0.718496978f},
-std::array<float,2>{0.50684154f, 0.907648802f},
-std::array<float,2>{0.450696319f, 0.458913088f},
-std::array<float,2>{0.932137668f, 0.0999936014f},
-std::array<float,2>{0.188697159f, 0.640769184f},
-std::array<float,2>{0.764768958f, 0.622757554f},
-std::array<float,2>{0.00295182387f, 0.186732292f},
-std::array<float,2>{0.626985788f, 0.266901881f},
-std::array<float,2>{0.36212793f, 0.79954809f},
-std::array<float,2>{0.745437086f, 0.745135784f},
-std::array<float,2>{0.283530235f, 0.053313382f},
-std::array<float,2>{0.825129509f, 0.41223529f},
-std::array<float,2>{0.0856135488f, 0.978334725f},
-std::array<float,2>{0.954546034f, 0.83644861f},
-std::array<float,2>{0.161556482f, 0.356391132f},
-std::array<float,2>{0.570714414f, 0.193422377f},
-std::array<float,2>{0.415844053f, 0.525800049f},
-std::array<float,2>{0.671039462f, 0.958998859f},
-std::array<float,2>{0.334904373f, 0.390868932f},
-std::array<float,2>{0.805482328f, 0.0245119855f},
-std::array<float,2>{0.0439690165f, 0.707967222f},
-std::array<float,2>{0.875552058f, 0.539859354f},
-std::array<float,2>{0.239221692f, 0.246652529f},
-std::array<float,2>{0.537837863f, 0.327384412f},
-std::array<float,2>{0.497272164f, 0.865472496f},
-std::array<float,2>{0.616092503f, 0.680925548f},
-std::array<float,2>{0.402629048f, 0.0780163184f},
-std::array<float,2>{0.999945223f, 0.493727386f},
-std::array<float,2>{0.143415824f, 0.900616467f},
-std::array<float,2>{0.866920531f, 0.77662766f},
-std::array<float,2>{0.0960325003f, 0.302371293f},
-std::array<float,2>{0.709710538f, 0.151265725f},
-std::array<float,2>{0.266875297f, 0.568601608f},
-std::array<float,2>{0.523382127f, 0.83135879f},
-std::array<float,2>{0.457420975f, 0.348113984f},
-std::array<float,2>{0.920769513f, 0.195747957f},
-std::array<float,2>{0.212731019f, 0.51908052f},
-std::array<float,2>{0.765806139f, 0.735495925f},
-std::array<float,2>{0.0243887212f, 0.0555819757f},
-std::array<float,2>{0.655256391f, 0.420019656f},
-std::array<float,2>{0.344640732f, 0.975360692f},
-std::array<float,2>{0.733838201f, 0.611903012f},
-std::array<float,2>{0.298994422f, 0.173317567f},
-std::array<float,2>{0.842980802f, 0.277200043f},
-std::array<float,2>{0.0632271841f, 0.810950518f},
-std::array<float,2>{0.938392818f, 0.919749379f},
-std::array<float,2>{0.17737861f, 0.464492857f},
-std::array<float,2>{0.593474209f, 0.104499049f},
-std::array<float,2>{0.426301032f, 0.651237845f},
-std::array<float,2>{0.698217094f, 0.782477558f},
-std::array<float,2>{0.250638604f, 0.252272218f},
-std::array<float,2>{0.85164851f, 0.158513114f},
-std::array<float,2>{0.110077076f, 0.600987732f},
-std::array<float,2>{0.971353889f, 0.627184451f},
-std::array<float,2>{0.126139715f, 0.122956753f},
-std::array<float,2>{0.605961263f, 0.451708794f},
-std::array<float,2>{0.379037827f, 0.935878217f},
-std::array<float,2>{0.55513984f, 0.511231542f},
-std::array<float,2>{0.476460099f, 0.205753908f},
-std::array<float,2>{0.901092887f, 0.361598521f},
-std::array<float,2>{0.230706096f, 0.81660068f},
-std::array<float,2>{0.784901679f, 0.994181275f},
-std::array<float,2>{0.0595028028f, 0.424298406f},
-std::array<float,2>{0.676525176f, 0.041970972f},
-std::array<float,2>{0.313816637f, 0.726440966f},
-std::array<float,2>{0.577520788f, 0.877737164f},
-std::array<float,2>{0.418693691f, 0.478062063f},
-std::array<float,2>{0.958693802f, 0.0875222981f},
-std::array<float,2>{0.158612669f, 0.664800704f},
-std::array<float,2>{0.823373139f, 0.585958958f},
-std::array<float,2>{0.0784065425f, 0.12818189f},
-std::array<float,2>{0.747036576f, 0.288435936f},
-std::array<float,2>{0.287799329f, 0.763973534f},
-std::array<float,2>{0.632328987f, 0.695281088f},
-std::array<float,2>{0.365435928f, 0.00372372963f},
-std::array<float,2>{0.76026994f, 0.385756105f},
-std::array<float,2>{0.00774266338f, 0.943446219f},
-std::array<float,2>{0.937331557f, 0.849133015f},
-std::array<float,2>{0.191801399f, 0.333571911f},
-std::array<float,2>{0.50311482f, 0.229349017f},
-std::array<float,2>{0.448662639f, 0.553150773f},
-std::array<float,2>{0.740686715f, 0.928509653f},
-std::array<float,2>{0.290079981f, 0.441135854f},
-std::array<float,2>{0.816096842f, 0.113817081f},
-std::array<float,2>{0.0860342085f, 0.637267947f},
-std::array<float,2>{0.964532137f, 0.605456233f},
-std::array<float,2>{0.167076603f, 0.164155871f},
-std::array<float,2>{0.562903166f, 0.259214342f},
-std::array<float,2>{0.410797328f, 0.789356947f},
-std::array<float,2>{0.513866365f, 0.733724713f},
-std::array<float,2>{0.440547019f, 0.0339858383f},
-std::array<float,2>{0.926527619f, 0.436995625f},
-std::array<float,2>{0.19730337f, 0.986469924f},
-std::array<float,2>{0.755416036f, 0.823250771f},
-std::array<float,2>{0.0132284686f, 0.369274497f},
-std::array<float,2>{0.639528275f, 0.212259263f},
-std::array<float,2>{0.371625125f, 0.503062129f},
-std::array<float,2>{0.600938022f, 0.751353562f},
-std::array<float,2>{0.388235122f, 0.289524525f},
-std::array<float,2>{0.981059074f, 0.133080155f},
-std::array<float,2>{0.135632336f, 0.579180419f},
-std::array<float,2>{0.843776822f, 0.661228001f},
-std::array<float,2>{0.123885773f, 0.0800753385f},
-std::array<float,2>{0.691715896f, 0.470417321f},
-std::array<float,2>{0.263275653f, 0.88306886f},
-std::array<float,2>{0.680190861f, 0.560925663f},
-std::array<float,2>{0.327681422f, 0.22473301f},
-std::array<float,2>{0.793486059f, 0.339737207f},
-std::array<float,2>{0.0483447611f, 0.856869698f},
-std::array<float,2>{0.894419134f, 0.949023843f},
-std::array<float,2>{0.220624462f, 0.376695007f},
-std::array<float,2>{0.55092603f, 0.012596339f},
-std::array<float,2>{0.479973078f, 0.697400391f},
-std::array<float,2>{0.645590246f, 0.869689107f},
-std::array<float,2>{0.357763916f, 0.315506727f},
-std::array<float,2>{0.775370002f, 0.237354457f},
-std::array<float,2>{0.0169283282f, 0.537799299f},
-std::array<float,2>{0.911581337f, 0.714786053f},
-std::array<float,2>{0.203764558f, 0.0219784882f},
-std::array<float,2>{0.526113808f, 0.403864771f},
-std::array<float,2>{0.46306318f, 0.966324389f},
-std::array<float,2>{0.58330512f, 0.575733423f},
-std::array<float,2>{0.434949964f, 0.142870784f},
-std::array<float,2>{0.947392702f, 0.30942452f},
-std::array<float,2>{0.183322847f, 0.772583544f},
-std::array<float,2>{0.83062917f, 0.896625102f},
-std::array<float,2>{0.0756692439f, 0.489264727f},
-std::array<float,2>{0.721157789f, 0.0635463223f},
-std::array<float,2>{0.311844349f, 0.678649187f},
-std::array<float,2>{0.545924246f, 0.981925905f},
-std::array<float,2>{0.491755426f, 0.409193844f},
-std::array<float,2>{0.890036225f, 0.0487744063f},
-std::array<float,2>{0.246401593f, 0.746262133f},
-std::array<float,2>{0.800805449f, 0.529447436f},
-std::array<float,2>{0.038915772f, 0.189128041f},
-std::array<float,2>{0.663445115f, 0.352314651f},
-std::array<float,2>{0.33706376f, 0.840450108f},
-std::array<float,2>{0.712893546f, 0.647983551f},
-std::array<float,2>{0.274555713f, 0.0945060402f},
-std::array<float,2>{0.868002772f, 0.454586595f},
-std::array<float,2>{0.107246652f, 0.912823796f},
-std::array<float,2>{0.986243308f, 0.800934434f},
-std::array<float,2>{0.155052796f, 0.270139813f},
-std::array<float,2>{0.623942316f, 0.183320984f},
-std::array<float,2>{0.394637913f, 0.618207753f},
-std::array<float,2>{0.673577964f, 0.893046379f},
-std::array<float,2>{0.317501187f, 0.485677809f},
-std::array<float,2>{0.788763285f, 0.0694937259f},
-std::array<float,2>{0.0573602952f, 0.673870981f},
-std::array<float,2>{0.902997255f, 0.571447909f},
-std::array<float,2>{0.228215382f, 0.146234453f},
-std::array<float,2>{0.561608732f, 0.308234662f},
-std::array<float,2>{0.471829236f, 0.768396854f},
-std::array<float,2>{0.60473305f, 0.717833698f},
-std::array<float,2>{0.37783125f, 0.0168928076f},
-std::array<float,2>{0.976013839f, 0.399935335f},
-std::array<float,2>{0.129297778f, 0.961945534f},
-std::array<float,2>{0.859033048f, 0.871316552f},
-std::array<float,2>{0.113950327f, 0.317767978f},
-std::array<float,2>{0.70116806f, 0.241798937f},
-std::array<float,2>{0.256703496f, 0.533946812f},
-std::array<float,2>{0.50398159f, 0.798957407f},
-std::array<float,2>{0.451970905f, 0.26722154f},
-std::array<float,2>{0.929879069f, 0.18709743f},
-std::array<float,2>{0.189539209f, 0.622412324f},
-std::array<float,2>{0.762792826f, 0.641588628f},
-std::array<float,2>{0.00171873055f, 0.10023687f},
-std::array<float,2>{0.625448227f, 0.458074629f},
-std::array<float,2>{0.36041832f, 0.907921255f},
-std::array<float,2>{0.742456377f, 0.526037633f},
-std::array<float,2>{0.282666773f, 0.194267452f},
-std::array<float,2>{0.827121317f, 0.355702013f},
-std::array<float,2>{0.0829468593f, 0.83619386f},
-std::array<float,2>{0.956888914f, 0.977573395f},
-std::array<float,2>{0.16378361f, 0.412845254f},
-std::array<float,2>{0.573439062f, 0.0528326631f},
-std::array<float,2>{0.416835487f, 0.745945334f},
-std::array<float,2>{0.706589401f, 0.827908218f},
-std::array<float,2>{0.273085564f, 0.372886956f},
-std::array<float,2>{0.861017466f, 0.21871756f},
-std::array<float,2>{0.100432254f, 0.503950417f},
-std::array<float,2>{0.992400467f, 0.728582442f},
-std::array<float,2>{0.147044525f, 0.0388306193f},
-std::array<float,2>{0.612391949f, 0.433005244f},
-std::array<float,2>{0.400834054f, 0.989441335f},
-std::array<float,2>{0.534790874f, 0.608395934f},
-std::array<float,2>{0.494650066f, 0.168664679f},
-std::array<float,2>{0.880346775f, 0.263576388f},
-std::array<float,2>{0.2345981f, 0.793135285f},
-std::array<float,2>{0.809452832f, 0.924838543f},
-std::array<float,2>{0.0426004566f, 0.44164592f},
-std::array<float,2>{0.666945755f, 0.11014428f},
-std::array<float,2>{0.328667819f, 0.636091113f},
-std::array<float,2>{0.587160468f, 0.95003283f},
-std::array<float,2>{0.42427361f, 0.382368892f},
-std::array<float,2>{0.945184529f, 0.00900522899f},
-std::array<float,2>{0.175238609f, 0.699476361f},
-std::array<float,2>{0.838922262f, 0.558542609f},
-std::array<float,2>{0.0664814189f, 0.221083179f},
-std::array<float,2>{0.729528785f, 0.343060821f},
-std::array<float,2>{0.301262707f, 0.854832411f},
-std::array<float,2>{0.650400043f, 0.656734884f},
-std::array<float,2>{0.350201607f, 0.08523684f},
-std::array<float,2>{0.770083666f, 0.473931551f},
-std::array<float,2>{0.0304160416f, 0.888429344f},
-std::array<float,2>{0.915752411f, 0.756254077f},
-std::array<float,2>{0.215400174f, 0.294903666f},
-std::array<float,2>{0.518056989f, 0.139797077f},
-std::array<float,2>{0.455355138f, 0.583351016f},
-std::array<float,2>{0.725833356f, 0.997092843f},
-std::array<float,2>{0.307853371f, 0.426376671f},
-std::array<float,2>{0.832579434f, 0.0443046205f},
-std::array<float,2>{0.0732938796f, 0.721950233f},
-std::array<float,2>{0.951763213f, 0.513216555f},
-std::array<float,2>{0.185165569f, 0.209728912f},
-std::array<float,2>{0.578646719f, 0.363393098f},
-std::array<float,2>{0.432703227f, 0.814632297f},
-std::array<float,2>{0.529478073f, 0.629806399f},
-std::array<float,2>{0.466193885f, 0.117639489f},
-std::array<float,2>{0.90888536f, 0.44610098f},
-std::array<float,2>{0.210920528f, 0.930372536f},
-std::array<float,2>{0.778592646f, 0.787368536f},
-std::array<float,2>{0.0203044005f, 0.256980449f},
-std::array<float,2>{0.644027114f, 0.160280347f},
-std::array<float,2>{0.354361594f, 0.596443832f},
-std::array<float,2>{0.617527485f, 0.844311178f},
-std::array<float,2>{0.392104357f, 0.33160007f},
-std::array<float,2>{0.992182016f, 0.234047264f},
-std::array<float,2>{0.151367456f, 0.546916187f},
-std::array<float,2>{0.874045432f, 0.690806985f},
-std::array<float,2>{0.104193062f, 0.00450427551f},
-std::array<float,2>{0.716752648f, 0.389969319f},
-std::array<float,2>{0.277955145f, 0.938723505f},
-std::array<float,2>{0.657207966f, 0.592900515f},
-std::array<float,2>{0.341292024f, 0.132344738f},
-std::array<float,2>{0.79926157f, 0.284053743f},
-std::array<float,2>{0.0313412882f, 0.76080811f},
-std::array<float,2>{0.885270655f, 0.882559717f},
-std::array<float,2>{0.242517129f, 0.480583131f},
-std::array<float,2>{0.541792631f, 0.091557093f},
-std::array<float,2>{0.484734297f, 0.6710639f},
-std::array<float,2>{0.6349172f, 0.778121889f},
-std::array<float,2>{0.367530614f, 0.297790527f},
-std::array<float,2>{0.753245771f, 0.154873133f},
-std::array<float,2>{0.0111255432f, 0.566073954f},
-std::array<float,2>{0.923045218f, 0.686796725f},
-std::array<float,2>{0.20104219f, 0.0740710348f},
-std::array<float,2>{0.510234237f, 0.496571034f},
-std::array<float,2>{0.443984061f, 0.90248251f},
-std::array<float,2>{0.568405807f, 0.545408189f},
-std::array<float,2>{0.409250647f, 0.243607298f},
-std::array<float,2>{0.966112196f, 0.322457284f},
-std::array<float,2>{0.168810561f, 0.863172412f},
-std::array<float,2>{0.816462934f, 0.956308603f},
-std::array<float,2>{0.0937153101f, 0.394779861f},
-std::array<float,2>{0.73797673f, 0.0287403632f},
-std::array<float,2>{0.293894351f, 0.705335498f},
-std::array<float,2>{0.54925251f, 0.916098058f},
-std::array<float,2>{0.484346598f, 0.467839926f},
-std::array<float,2>{0.897432685f, 0.10752663f},
-std::array<float,2>{0.224247962f, 0.654757977f},
-std::array<float,2>{0.790189445f, 0.615531921f},
-std::array<float,2>{0.0529253483f, 0.178145304f},
-std::array<float,2>{0.685620546f, 0.277601898f},
-std::array<float,2>{0.322330445f, 0.804728687f},
-std::array<float,2>{0.691055655f, 0.741532385f},
-std::array<float,2>{0.258435696f, 0.0608169809f},
-std::array<float,2>{0.849265873f, 0.417413443f},
-std::array<float,2>{0.117691599f, 0.97160399f},
-std::array<float,2>{0.979836404f, 0.83215028f},
-std::array<float,2>{0.137523189f, 0.347299278f},
-std::array<float,2>{0.595160961f, 0.202249125f},
-std::array<float,2>{0.386260808f, 0.522289455f},
-std::array<float,2>{0.647938013f, 0.966273785f},
-std::array<float,2>{0.35714826f, 0.403613299f},
-std::array<float,2>{0.775766492f, 0.0217695013f},
-std::array<float,2>{0.019467406f, 0.714098632f},
-std::array<float,2>{0.912641168f, 0.537569225f},
-std::array<float,2>{0.205167949f, 0.237809464f},
-std::array<float,2>{0.524199963f, 0.316197187f},
-std::array<float,2>{0.462503999f, 0.869347692f},
-std::array<float,2>{0.585330963f, 0.677845657f},
-std::array<float,2>{0.436484873f, 0.0640571341f},
-std::array<float,2>{0.946805954f, 0.489949942f},
-std::array<float,2>{0.180181593f, 0.897416949f},
-std::array<float,2>{0.829965413f, 0.773246944f},
-std::array<float,2>{0.0765918568f, 0.309078544f},
-std::array<float,2>{0.719973683f, 0.143368065f},
-std::array<float,2>{0.308997542f, 0.575197041f},
-std::array<float,2>{0.54449302f, 0.840091765f},
-std::array<float,2>{0.489251077f, 0.35174486f},
-std::array<float,2>{0.888654947f, 0.188896492f},
-std::array<float,2>{0.248135239f, 0.530066073f},
-std::array<float,2>{0.80287677f, 0.746988475f},
-std::array<float,2>{0.0369538181f, 0.0482386909f},
-std::array<float,2>{0.660349488f, 0.409751773f},
-std::array<float,2>{0.338899881f, 0.982067764f},
-std::array<float,2>{0.712390959f, 0.618690789f},
-std::array<float,2>{0.275843084f, 0.182881325f},
-std::array<float,2>{0.869991183f, 0.269791484f},
-std::array<float,2>{0.109314322f, 0.801312506f},
-std::array<float,2>{0.986582041f, 0.912386f},
-std::array<float,2>{0.152950048f, 0.454744786f},
-std::array<float,2>{0.622790039f, 0.0941683799f},
-std::array<float,2>{0.397408813f, 0.647664368f},
-std::array<float,2>{0.739831686f, 0.789854884f},
-std::array<float,2>{0.292764306f, 0.259434789f},
-std::array<float,2>{0.814261377f, 0.164745376f},
-std::array<float,2>{0.0882251263f, 0.604636252f},
-std::array<float,2>{0.961842358f, 0.636734903f},
-std::array<float,2>{0.164591104f, 0.113621406f},
-std::array<float,2>{0.565685213f, 0.440684021f},
-std::array<float,2>{0.412920475f, 0.928017914f},
-std::array<float,2>{0.512787402f, 0.503814518f},
-std::array<float,2>{0.438068688f, 0.21257104f},
-std::array<float,2>{0.928890347f, 0.369949371f},
-std::array<float,2>{0.195667028f, 0.824184775f},
-std::array<float,2>{0.757155955f, 0.98692131f},
-std::array<float,2>{0.0150557254f, 0.437461406f},
-std::array<float,2>{0.637983322f, 0.0333355404f},
-std::array<float,2>{0.373894423f, 0.734317243f},
-std::array<float,2>{0.599504054f, 0.883537173f},
-std::array<float,2>{0.390602916f, 0.469784975f},
-std::array<float,2>{0.983022392f, 0.0794761702f},
-std::array<float,2>{0.133820027f, 0.662017226f},
-std::array<float,2>{0.846407115f, 0.580013275f},
-std::array<float,2>{0.122887678f, 0.133418828f},
-std::array<float,2>{0.694004357f, 0.289813936f},
-std::array<float,2>{0.264190733f, 0.751523674f},
-std::array<float,2>{0.682571769f, 0.698088467f},
-std::array<float,2>{0.325146973f, 0.0120513076f},
-std::array<float,2>{0.795172751f, 0.376213431f},
-std::array<float,2>{0.0489313938f, 0.948301792f},
-std::array<float,2>{0.892094135f, 0.856944025f},
-std::array<float,2>{0.222058877f, 0.339005142f},
-std::array<float,2>{0.553449154f, 0.225124121f},
-std::array<float,2>{0.477983952f, 0.561370432f},
-std::array<float,2>{0.695467472f, 0.936480403f},
-std::array<float,2>{0.252159148f, 0.451620132f},
-std::array<float,2>{0.85453862f, 0.12220034f},
-std::array<float,2>{0.112118788f, 0.627666354f},
-std::array<float,2>{0.970503688f, 0.601115942f},
-std::array<float,2>{0.12819925f, 0.158773452f},
-std::array<float,2>{0.608702779f, 0.252882957f},
-std::array<float,2>{0.381235123f, 0.78307122f},
-std::array<float,2>{0.556897163f, 0.725756884f},
-std::array<float,2>{0.473828733f, 0.0411257297f},
-std::array<float,2>{0.899644375f, 0.424651742f},
-std::array<float,2>{0.232592747f, 0.994825542f},
-std::array<float,2>{0.781541407f, 0.817043424f},
-std::array<float,2>{0.0610768422f, 0.361951381f},
-std::array<float,2>{0.678887248f, 0.205383733f},
-std::array<float,2>{0.315038949f, 0.510783255f},
-std::array<float,2>{0.575415492f, 0.764193654f},
-std::array<float,2>{0.42067942f, 0.288882971f},
-std::array<float,2>{0.960052907f, 0.128555283f},
-std::array<float,2>{0.157638922f, 0.586798012f},
-std::array<float,2>{0.822117984f, 0.664415598f},
-std::array<float,2>{0.081106551f, 0.0872143731f},
-std::array<float,2>{0.749968052f, 0.477780461f},
-std::array<float,2>{0.285797387f, 0.877119601f},
-std::array<float,2>{0.6297822f, 0.553622007f},
-std::array<float,2>{0.364333302f, 0.22856994f},
-std::array<float,2>{0.759407043f, 0.333298683f},
-std::array<float,2>{0.00489254808f, 0.849032164f},
-std::array<float,2>{0.934430003f, 0.944294453f},
-std::array<float,2>{0.193705678f, 0.386481255f},
-std::array<float,2>{0.500935376f, 0.00298072491f},
-std::array<float,2>{0.446266323f, 0.694736004f},
-std::array<float,2>{0.668007255f, 0.865990281f},
-std::array<float,2>{0.333716124f, 0.327922344f},
-std::array<float,2>{0.808432877f, 0.2464623f},
-std::array<float,2>{0.045020055f, 0.539416432f},
-std::array<float,2>{0.878778875f, 0.707079947f},
-std::array<float,2>{0.241670877f, 0.0253757499f},
-std::array<float,2>{0.535961747f, 0.391314119f},
-std::array<float,2>{0.49913013f, 0.959512651f},
-std::array<float,2>{0.614690542f, 0.568957746f},
-std::array<float,2>{0.404794663f, 0.150810525f},
-std::array<float,2>{0.997269154f, 0.302191705f},
-std::array<float,2>{0.142020538f, 0.777259886f},
-std::array<float,2>{0.863837481f, 0.901102126f},
-std::array<float,2>{0.0943114236f, 0.493577421f},
-std::array<float,2>{0.707713187f, 0.0774085969f},
-std::array<float,2>{0.268075585f, 0.681582272f},
-std::array<float,2>{0.519897938f, 0.974851608f},
-std::array<float,2>{0.459665447f, 0.420550227f},
-std::array<float,2>{0.918482244f, 0.0551268905f},
-std::array<float,2>{0.21419102f, 0.7360062f},
-std::array<float,2>{0.768320918f, 0.518915355f},
-std::array<float,2>{0.0265929177f, 0.195838556f},
-std::array<float,2>{0.652532578f, 0.348176867f},
-std::array<float,2>{0.346217066f, 0.831546247f},
-std::array<float,2>{0.730607808f, 0.650599658f},
-std::array<float,2>{0.297024071f, 0.105414107f},
-std::array<float,2>{0.841616809f, 0.46429494f},
-std::array<float,2>{0.0657681003f, 0.91928184f},
-std::array<float,2>{0.940072715f, 0.811356306f},
-std::array<float,2>{0.178509966f, 0.276630461f},
-std::array<float,2>{0.59081918f, 0.173453152f},
-std::array<float,2>{0.42891106f, 0.611580312f},
-std::array<float,2>{0.627757132f, 0.90967083f},
-std::array<float,2>{0.361569256f, 0.460798323f},
-std::array<float,2>{0.765253127f, 0.0980356932f},
-std::array<float,2>{0.00386894424f, 0.642652273f},
-std::array<float,2>{0.931678414f, 0.623087347f},
-std::array<float,2>{0.189084664f, 0.183851853f},
-std::array<float,2>{0.507776916f, 0.268249631f},
-std::array<float,2>{0.450671494f, 0.79720962f},
-std::array<float,2>{0.570961297f, 0.743640125f},
-std::array<float,2>{0.415140927f, 0.0520984232f},
-std::array<float,2>{0.954642296f, 0.410685241f},
-std::array<float,2>{0.162047178f, 0.979531288f},
-std::array<float,2>{0.824511409f, 0.838558793f},
-std::array<float,2>{0.0850087777f, 0.358939379f},
-std::array<float,2>{0.745936751f, 0.191506445f},
-std::array<float,2>{0.28402102f, 0.524123192f},
-std::array<float,2>{0.559022307f, 0.766070127f},
-std::array<float,2>{0.469442695f, 0.305455327f},
-std::array<float,2>{0.905513883f, 0.147864237f},
-std::array<float,2>{0.22988078f, 0.572835386f},
-std::array<float,2>{0.786274076f, 0.671956539f},
-std::array<float,2>{0.0552245192f, 0.0672609136f},
-std::array<float,2>{0.675531745f, 0.487405121f},
-std::array<float,2>{0.31886372f, 0.892234862f},
-std::array<float,2>{0.702401996f, 0.532972574f},
-std::array<float,2>{0.253923535f, 0.239037976f},
-std::array<float,2>{0.857103348f, 0.320288837f},
-std::array<float,2>{0.116122335f, 0.874309897f},
-std::array<float,2>{0.973743081f, 0.964168966f},
-std::array<float,2>{0.131030619f, 0.401525319f},
-std::array<float,2>{0.602667868f, 0.0192800798f},
-std::array<float,2>{0.376727998f, 0.715487003f},
-std::array<float,2>{0.727693975f, 0.852278233f},
-std::array<float,2>{0.302754015f, 0.339871347f},
-std::array<float,2>{0.836849868f, 0.220165342f},
-std::array<float,2>{0.0685312152f, 0.555881023f},
-std::array<float,2>{0.943106472f, 0.701397061f},
-std::array<float,2>{0.173505098f, 0.0110554006f},
-std::array<float,2>{0.588543713f, 0.380244344f},
-std::array<float,2>{0.422551394f, 0.952268779f},
-std::array<float,2>{0.516394734f, 0.585821927f},
-std::array<float,2>{0.454090744f, 0.138512f},
-std::array<float,2>{0.91651243f, 0.296312034f},
-std::array<float,2>{0.217943847f, 0.7543329f},
-std::array<float,2>{0.771700978f, 0.889028192f},
-std::array<float,2>{0.0279466007f, 0.475864619f},
-std::array<float,2>{0.649004459f, 0.0825668499f},
-std::array<float,2>{0.348941445f, 0.659129322f},
-std::array<float,2>{0.61049825f, 0.992031872f},
-std::array<float,2>{0.399933606f, 0.430283427f},
-std::array<float,2>{0.995491803f, 0.0358714126f},
-std::array<float,2>{0.146388113f, 0.727624357f},
-std::array<float,2>{0.862218142f, 0.50674969f},
-std::array<float,2>{0.0986234173f, 0.215056449f},
-std::array<float,2>{0.704894066f, 0.374032289f},
-std::array<float,2>{0.270153552f, 0.825813353f},
-std::array<float,2>{0.664371967f, 0.633353889f},
-std::array<float,2>{0.331517428f, 0.112681024f},
-std::array<float,2>{0.812185466f, 0.44402799f},
-std::array<float,2>{0.040734116f, 0.922133267f},
-std::array<float,2>{0.881451368f, 0.796343088f},
-std::array<float,2>{0.238136247f, 0.264789969f},
-std::array<float,2>{0.53173089f, 0.171126679f},
-std::array<float,2>{0.493269295f, 0.60595417f},
-std::array<float,2>{0.717558444f, 0.940314412f},
-std::array<float,2>{0.280950993f, 0.388627857f},
-std::array<float,2>{0.872759938f, 0.00643266225f},
-std::array<float,2>{0.103433058f, 0.688436747f},
-std::array<float,2>{0.989151835f, 0.550445914f},
-std::array<float,2>{0.14941363f, 0.230518773f},
-std::array<float,2>{0.620578408f, 0.329673082f},
-std::array<float,2>{0.393492401f, 0.846731901f},
-std::array<float,2>{0.540461481f, 0.668277323f},
-std::array<float,2>{0.487216562f, 0.0919620395f},
-std::array<float,2>{0.884186625f, 0.482881099f},
-std::array<float,2>{0.245238289f, 0.879162431f},
-std::array<float,2>{0.797578931f, 0.759039104f},
-std::array<float,2>{0.03348336f, 0.281803787f},
-std::array<float,2>{0.659417987f, 0.130378798f},
-std::array<float,2>{0.343028516f, 0.590317607f},
-std::array<float,2>{0.581940413f, 0.813473761f},
-std::array<float,2>{0.43086642f, 0.365353942f},
-std::array<float,2>{0.950684488f, 0.20799388f},
-std::array<float,2>{0.186128303f, 0.514908791f},
-std::array<float,2>{0.834506154f, 0.720026135f},
-std::array<float,2>{0.0712104812f, 0.0466040932f},
-std::array<float,2>{0.724175036f, 0.429579854f},
-std::array<float,2>{0.30616653f, 0.999670088f},
-std::array<float,2>{0.641535521f, 0.595526636f},
-std::array<float,2>{0.352926105f, 0.162140042f},
-std::array<float,2>{0.779317915f, 0.255491853f},
-std::array<float,2>{0.0232937727f, 0.786172032f},
-std::array<float,2>{0.906270266f, 0.932323754f},
-std::array<float,2>{0.207873181f, 0.448217958f},
-std::array<float,2>{0.528819561f, 0.119879588f},
-std::array<float,2>{0.468526065f, 0.632702589f},
-std::array<float,2>{0.683784783f, 0.808087528f},
-std::array<float,2>{0.32182768f, 0.280645609f},
-std::array<float,2>{0.792365909f, 0.177648261f},
-std::array<float,2>{0.0508662462f, 0.613615692f},
-std::array<float,2>{0.895898283f, 0.652378201f},
-std::array<float,2>{0.22585246f, 0.105676576f},
-std::array<float,2>{0.547304392f, 0.465573996f},
-std::array<float,2>{0.48103717f, 0.914949358f},
-std::array<float,2>{0.596711576f, 0.52016896f},
-std::array<float,2>{0.384513915f, 0.201065198f},
-std::array<float,2>{0.977244437f, 0.344239354f},
-std::array<float,2>{0.139269218f, 0.835753918f},
-std::array<float,2>{0.851541519f, 0.970507324f},
-std::array<float,2>{0.120027907f, 0.414659619f},
-std::array<float,2>{0.689015388f, 0.0591118746f},
-std::array<float,2>{0.260732025f, 0.7400316f},
-std::array<float,2>{0.508653939f, 0.906154811f},
-std::array<float,2>{0.442347497f, 0.498263597f},
-std::array<float,2>{0.925677896f, 0.0716261491f},
-std::array<float,2>{0.201455757f, 0.683755398f},
-std::array<float,2>{0.751740873f, 0.56283766f},
-std::array<float,2>{0.00974420272f, 0.154065549f},
-std::array<float,2>{0.633780479f, 0.300410628f},
-std::array<float,2>{0.369792819f, 0.780856609f},
-std::array<float,2>{0.735115707f, 0.703969002f},
-std::array<float,2>{0.295637995f, 0.030360112f},
-std::array<float,2>{0.819367528f, 0.397777528f},
-std::array<float,2>{0.0903150067f, 0.954064965f},
-std::array<float,2>{0.967034996f, 0.861237347f},
-std::array<float,2>{0.171348289f, 0.321208775f},
-std::array<float,2>{0.568219841f, 0.245577872f},
-std::array<float,2>{0.407670736f, 0.544457316f},
-std::array<float,2>{0.663584948f, 0.98381412f},
-std::array<float,2>{0.337428987f, 0.407831311f},
-std::array<float,2>{0.801428676f, 0.0491801836f},
-std::array<float,2>{0.0383310281f, 0.749309361f},
-std::array<float,2>{0.890623212f, 0.529243469f},
-std::array<float,2>{0.246921837f, 0.189653173f},
-std::array<float,2>{0.546426475f, 0.355178535f},
-std::array<float,2>{0.491256416f, 0.842313707f},
-std::array<float,2>{0.623210847f, 0.645127773f},
-std::array<float,2>{0.395380706f, 0.0958621502f},
-std::array<float,2>{0.985412598f, 0.455862463f},
-std::array<float,2>{0.154778585f, 0.910182238f},
-std::array<float,2>{0.867481053f, 0.804501176f},
-std::array<float,2>{0.106489442f, 0.273393095f},
-std::array<float,2>{0.713398397f, 0.180493951f},
-std::array<float,2>{0.274963051f, 0.620025575f},
-std::array<float,2>{0.52576822f, 0.868248105f},
-std::array<float,2>{0.463805437f, 0.313638061f},
-std::array<float,2>{0.91170907f, 0.234673128f},
-std::array<float,2>{0.203597263f, 0.536739826f},
-std::array<float,2>{0.774485707f, 0.710952997f},
-std::array<float,2>{0.0174919311f, 0.0213792492f},
-std::array<float,2>{0.646064103f, 0.405135304f},
-std::array<float,2>{0.357991815f, 0.968184531f},
-std::array<float,2>{0.721433878f, 0.577484965f},
-std::array<float,2>{0.312302947f, 0.140773267f},
-std::array<float,2>{0.830334008f, 0.311704248f},
-std::array<float,2>{0.0760657117f, 0.770074546f},
-std::array<float,2>{0.948017478f, 0.896441698f},
-std::array<float,2>{0.183081105f, 0.49100998f},
-std::array<float,2>{0.583509028f, 0.0647303835f},
-std::array<float,2>{0.435075909f, 0.676893651f},
-std::array<float,2>{0.692023933f, 0.75206995f},
-std::array<float,2>{0.262939125f, 0.291088194f},
-std::array<float,2>{0.844360173f, 0.135308236f},
-std::array<float,2>{0.123448953f, 0.580207169f},
-std::array<float,2>{0.980900586f, 0.663096607f},
-std::array<float,2>{0.135227665f, 0.0806060731f},
-std::array<float,2>{0.601298392f, 0.472249717f},
-std::array<float,2>{0.387989879f, 0.885641038f},
-std::array<float,2>{0.551646829f, 0.560266316f},
-std::array<float,2>{0.480190754f, 0.223889723f},
-std::array<float,2>{0.893674433f, 0.336286247f},
-std::array<float,2>{0.219730824f, 0.859337687f},
-std::array<float,2>{0.793255091f, 0.945663095f},
-std::array<float,2>{0.0480084494f, 0.377031177f},
-std::array<float,2>{0.680153966f, 0.0153346248f},
-std::array<float,2>{0.327450871f, 0.695419848f},
-std::array<float,2>{0.563279927f, 0.925913572f},
-std::array<float,2>{0.410240263f, 0.437702715f},
-std::array<float,2>{0.964236975f, 0.116934799f},
-std::array<float,2>{0.167957649f, 0.639923334f},
-std::array<float,2>{0.815869689f, 0.602718353f},
-std::array<float,2>{0.0865051597f, 0.167810753f},
-std::array<float,2>{0.740892351f, 0.261644274f},
-std::array<float,2>{0.290636003f, 0.791199505f},
-std::array<float,2>{0.638983727f, 0.732282162f},
-std::array<float,2>{0.371194005f, 0.0330773704f},
-std::array<float,2>{0.754891455f, 0.434900552f},
-std::array<float,2>{0.0131624565f, 0.984551966f},
-std::array<float,2>{0.925992668f, 0.820729792f},
-std::array<float,2>{0.197855338f, 0.368645042f},
-std::array<float,2>{0.514629781f, 0.214415208f},
-std::array<float,2>{0.44114694f, 0.501528621f},
-std::array<float,2>{0.746382356f, 0.875365674f},
-std::array<float,2>{0.287254691f, 0.479633331f},
-std::array<float,2>{0.82392472f, 0.0896473601f},
-std::array<float,2>{0.0787522942f, 0.667436481f},
-std::array<float,2>{0.958127677f, 0.588619292f},
-std::array<float,2>{0.158817321f, 0.125499502f},
-std::array<float,2>{0.577836335f, 0.28578797f},
-std::array<float,2>{0.418346226f, 0.762252748f},
-std::array<float,2>{0.503646433f, 0.692332149f},
-std::array<float,2>{0.448956192f, 0.000478078728f},
-std::array<float,2>{0.936808586f, 0.383042157f},
-std::array<float,2>{0.192072451f, 0.941948175f},
-std::array<float,2>{0.760247409f, 0.85124743f},
-std::array<float,2>{0.00723241828f, 0.335488051f},
-std::array<float,2>{0.631891966f, 0.226821631f},
-std::array<float,2>{0.366012722f, 0.552370489f},
-std::array<float,2>{0.605616331f, 0.78472954f},
-std::array<float,2>{0.379478306f, 0.251650065f},
-std::array<float,2>{0.970861733f, 0.158012629f},
-std::array<float,2>{0.126695082f, 0.59842819f},
-std::array<float,2>{0.85239476f, 0.626811624f},
-std::array<float,2>{0.109613061f, 0.123154067f},
-std::array<float,2>{0.697284877f, 0.451124161f},
-std::array<float,2>{0.25026527f, 0.934119821f},
-std::array<float,2>{0.676133513f, 0.509510815f},
-std::array<float,2>{0.314409345f, 0.20461987f},
-std::array<float,2>{0.784346342f, 0.361234546f},
-std::array<float,2>{0.058636073f, 0.819955528f},
-std::array<float,2>{0.900393724f, 0.993347704f},
-std::array<float,2>{0.23143138f, 0.422250241f},
-std::array<float,2>{0.555326998f, 0.0406492762f},
-std::array<float,2>{0.475840569f, 0.724558473f},
-std::array<float,2>{0.654453814f, 0.829143226f},
-std::array<float,2>{0.343878239f, 0.349914283f},
-std::array<float,2>{0.766392171f, 0.197336018f},
-std::array<float,2>{0.0235104691f, 0.51602447f},
-std::array<float,2>{0.920249164f, 0.736885667f},
-std::array<float,2>{0.21212773f, 0.057469856f},
-std::array<float,2>{0.52281332f, 0.419781536f},
-std::array<float,2>{0.457598001f, 0.973674953f},
-std::array<float,2>{0.593165994f, 0.609627426f},
-std::array<float,2>{0.42596367f, 0.174021259f},
-std::array<float,2>{0.937775612f, 0.274575233f},
-std::array<float,2>{0.177237451f, 0.809954703f},
-std::array<float,2>{0.843309641f, 0.920070648f},
-std::array<float,2>{0.0627873093f, 0.461421311f},
-std::array<float,2>{0.734103978f, 0.102689944f},
-std::array<float,2>{0.299760729f, 0.649392366f},
-std::array<float,2>{0.53752625f, 0.957090437f},
-std::array<float,2>{0.49788031f, 0.392793626f},
-std::array<float,2>{0.875007689f, 0.0264993683f},
-std::array<float,2>{0.238337636f, 0.710567176f},
-std::array<float,2>{0.805114627f, 0.541741848f},
-std::array<float,2>{0.0444924608f, 0.24930577f},
-std::array<float,2>{0.671685457f, 0.324328631f},
-std::array<float,2>{0.334344268f, 0.864609122f},
-std::array<float,2>{0.70920366f, 0.68341285f},
-std::array<float,2>{0.267403305f, 0.074987486f},
-std::array<float,2>{0.866674185f, 0.495484531f},
-std::array<float,2>{0.0966610014f, 0.900018156f},
-std::array<float,2>{0.99906075f, 0.774324834f},
-std::array<float,2>{0.143047795f, 0.303433716f},
-std::array<float,2>{0.615470171f, 0.150311261f},
-std::array<float,2>{0.402964115f, 0.566435933f},
-std::array<float,2>{0.667056501f, 0.923428476f},
-std::array<float,2>{0.330070615f, 0.444477528f},
-std::array<float,2>{0.81024462f, 0.111384347f},
-std::array<float,2>{0.0418133736f, 0.634271622f},
-std::array<float,2>{0.879440129f, 0.606480837f},
-std::array<float,2>{0.236250103f, 0.170237973f},
-std::array<float,2>{0.533775389f, 0.264264107f},
-std::array<float,2>{0.495223731f, 0.795516491f},
-std::array<float,2>{0.612034559f, 0.727340341f},
-std::array<float,2>{0.40205431f, 0.0362732112f},
-std::array<float,2>{0.993477166f, 0.431309372f},
-std::array<float,2>{0.147911087f, 0.991210818f},
-std::array<float,2>{0.859402001f, 0.825194836f},
-std::array<float,2>{0.100701787f, 0.373103023f},
-std::array<float,2>{0.705611169f, 0.216084853f},
-std::array<float,2>{0.272087008f, 0.50708878f},
-std::array<float,2>{0.51888299f, 0.755458713f},
-std::array<float,2>{0.456215352f, 0.295548499f},
-std::array<float,2>{0.914450586f, 0.137296706f},
-std::array<float,2>{0.215869561f, 0.584487796f},
-std::array<float,2>{0.770578563f, 0.659451604f},
-std::array<float,2>{0.0294572897f, 0.0831785798f},
-std::array<float,2>{0.651636243f, 0.475058198f},
-std::array<float,2>{0.351218134f, 0.890298307f},
-std::array<float,2>{0.728749335f, 0.555474639f},
-std::array<float,2>{0.302030712f, 0.219641939f},
-std::array<float,2>{0.838851869f, 0.340942323f},
-std::array<float,2>{0.0674284175f, 0.852605283f},
-std::array<float,2>{0.943495095f, 0.951394796f},
-std::array<float,2>{0.173938394f, 0.379566431f},
-std::array<float,2>{0.586265981f, 0.0105606746f},
-std::array<float,2>{0.425669342f, 0.702804685f},
-std::array<float,2>{0.699552774f, 0.873460531f},
-std::array<float,2>{0.257262379f, 0.318680465f},
-std::array<float,2>{0.857477248f, 0.240166709f},
-std::array<float,2>{0.114381887f, 0.532096803f},
-std::array<float,2>{0.975315154f, 0.716645539f},
-std::array<float,2>{0.129899487f, 0.0182492677f},
-std::array<float,2>{0.603989542f, 0.40135327f},
-std::array<float,2>{0.3781434f, 0.963789582f},
-std::array<float,2>{0.561158657f, 0.573544025f},
-std::array<float,2>{0.471239507f, 0.146597087f},
-std::array<float,2>{0.904207766f, 0.305883974f},
-std::array<float,2>{0.226797387f, 0.767214f},
-std::array<float,2>{0.787225902f, 0.891349852f},
-std::array<float,2>{0.0581324026f, 0.487232298f},
-std::array<float,2>{0.672824621f, 0.0676559955f},
-std::array<float,2>{0.316802859f, 0.673808455f},
-std::array<float,2>{0.57323879f, 0.978859365f},
-std::array<float,2>{0.417031705f, 0.412091047f},
-std::array<float,2>{0.955320656f, 0.0510158092f},
-std::array<float,2>{0.16222541f, 0.743019819f},
-std::array<float,2>{0.827295303f, 0.524630845f},
-std::array<float,2>{0.0834414512f, 0.192604259f},
-std::array<float,2>{0.744102061f, 0.358269721f},
-std::array<float,2>{0.281561017f, 0.839105785f},
-std::array<float,2>{0.626274526f, 0.644365668f},
-std::array<float,2>{0.359616727f, 0.0994432569f},
-std::array<float,2>{0.762367725f, 0.459275842f},
-std::array<float,2>{0.000342365034f, 0.909150243f},
-std::array<float,2>{0.930818498f, 0.79786402f},
-std::array<float,2>{0.190646797f, 0.26947242f},
-std::array<float,2>{0.50548631f, 0.18518056f},
-std::array<float,2>{0.452807367f, 0.624882221f},
-std::array<float,2>{0.737296045f, 0.954967916f},
-std::array<float,2>{0.294601649f, 0.396559745f},
-std::array<float,2>{0.817781508f, 0.0298868511f},
-std::array<float,2>{0.0919641033f, 0.704677939f},
-std::array<float,2>{0.965133607f, 0.543399334f},
-std::array<float,2>{0.169895649f, 0.244574204f},
-std::array<float,2>{0.569979846f, 0.322030723f},
-std::array<float,2>{0.408467025f, 0.859614432f},
-std::array<float,2>{0.510820448f, 0.685171247f},
-std::array<float,2>{0.445172936f, 0.0706703812f},
-std::array<float,2>{0.921958268f, 0.499258757f},
-std::array<float,2>{0.199638531f, 0.905172169f},
-std::array<float,2>{0.752483547f, 0.779349566f},
-std::array<float,2>{0.0104339374f, 0.298842311f},
-std::array<float,2>{0.636503637f, 0.152475804f},
-std::array<float,2>{0.368700564f, 0.563650787f},
-std::array<float,2>{0.594676018f, 0.83399725f},
-std::array<float,2>{0.384781003f, 0.345456988f},
-std::array<float,2>{0.978650987f, 0.199272737f},
-std::array<float,2>{0.137894809f, 0.521348536f},
-std::array<float,2>{0.848555267f, 0.738629043f},
-std::array<float,2>{0.118173242f, 0.0601400584f},
-std::array<float,2>{0.689908564f, 0.415641189f},
-std::array<float,2>{0.259068578f, 0.969464064f},
-std::array<float,2>{0.686618388f, 0.614901781f},
-std::array<float,2>{0.323967487f, 0.176474974f},
-std::array<float,2>{0.789064646f, 0.279813856f},
-std::array<float,2>{0.0546704642f, 0.806712866f},
-std::array<float,2>{0.898038387f, 0.916003048f},
-std::array<float,2>{0.223626241f, 0.466730118f},
-std::array<float,2>{0.550577164f, 0.106980816f},
-std::array<float,2>{0.483224243f, 0.653791666f},
-std::array<float,2>{0.643179476f, 0.785243571f},
-std::array<float,2>{0.355073541f, 0.254754782f},
-std::array<float,2>{0.77782613f, 0.163973317f},
-std::array<float,2>{0.0209214315f, 0.594272673f},
-std::array<float,2>{0.910133839f, 0.631177723f},
-std::array<float,2>{0.208990112f, 0.120120659f},
-std::array<float,2>{0.530367136f, 0.44877708f},
-std::array<float,2>{0.465254426f, 0.933273315f},
-std::array<float,2>{0.579721928f, 0.514252186f},
-std::array<float,2>{0.432561219f, 0.208232284f},
-std::array<float,2>{0.952616513f, 0.366819829f},
-std::array<float,2>{0.184015989f, 0.813604116f},
-std::array<float,2>{0.833686829f, 0.998304605f},
-std::array<float,2>{0.072698392f, 0.428597391f},
-std::array<float,2>{0.725028634f, 0.0452078357f},
-std::array<float,2>{0.307130724f, 0.71953702f},
-std::array<float,2>{0.542392254f, 0.880451918f},
-std::array<float,2>{0.486259699f, 0.484267533f},
-std::array<float,2>{0.886100531f, 0.0934992358f},
-std::array<float,2>{0.24411647f, 0.669013083f},
-std::array<float,2>{0.800385535f, 0.59138906f},
-std::array<float,2>{0.0327990279f, 0.129570797f},
-std::array<float,2>{0.657977641f, 0.282300204f},
-std::array<float,2>{0.340624899f, 0.758454442f},
-std::array<float,2>{0.715328991f, 0.688532829f},
-std::array<float,2>{0.278769135f, 0.00703761494f},
-std::array<float,2>{0.873344243f, 0.387251258f},
-std::array<float,2>{0.104814127f, 0.940548182f},
-std::array<float,2>{0.991094887f, 0.845778167f},
-std::array<float,2>{0.150894642f, 0.328435481f},
-std::array<float,2>{0.61857152f, 0.232055366f},
-std::array<float,2>{0.391518235f, 0.549066305f},
-std::array<float,2>{0.637675583f, 0.98625344f},
-std::array<float,2>{0.374702781f, 0.434530973f},
-std::array<float,2>{0.756720185f, 0.0312605277f},
-std::array<float,2>{0.0142221693f, 0.731352329f},
-std::array<float,2>{0.928447545f, 0.50078994f},
-std::array<float,2>{0.197254896f, 0.213663071f},
-std::array<float,2>{0.511852324f, 0.367359012f},
-std::array<float,2>{0.43901968f, 0.821409523f},
-std::array<float,2>{0.564826787f, 0.638997197f},
-std::array<float,2>{0.413921475f, 0.116136536f},
-std::array<float,2>{0.962015271f, 0.439378589f},
-std::array<float,2>{0.165994838f, 0.926954329f},
-std::array<float,2>{0.813115835f, 0.792340338f},
-std::array<float,2>{0.0893263891f, 0.26016444f},
-std::array<float,2>{0.738862932f, 0.166318104f},
-std::array<float,2>{0.291581541f, 0.601630509f},
-std::array<float,2>{0.553855717f, 0.857425511f},
-std::array<float,2>{0.477141678f, 0.337687731f},
-std::array<float,2>{0.891198337f, 0.223127246f},
-std::array<float,2>{0.221005842f, 0.558830857f},
-std::array<float,2>{0.796104431f, 0.696573973f},
-std::array<float,2>{0.0502141453f, 0.0145933842f},
-std::array<float,2>{0.682967246f, 0.378544897f},
-std::array<float,2>{0.32557857f, 0.947006404f},
-std::array<float,2>{0.694651306f, 0.581176519f},
-std::array<float,2>{0.264775097f, 0.135795861f},
-std::array<float,2>{0.847206652f, 0.292027444f},
-std::array<float,2>{0.121622764f, 0.753350556f},
-std::array<float,2>{0.984111547f, 0.886567414f},
-std::array<float,2>{0.133655474f, 0.471325308f},
-std::array<float,2>{0.59798038f, 0.0818917826f},
-std::array<float,2>{0.389367402f, 0.66226691f},
-std::array<float,2>{0.719723761f, 0.770779431f},
-std::array<float,2>{0.310427934f, 0.310811639f},
-std::array<float,2>{0.8284567f, 0.142403632f},
-std::array<float,2>{0.0779096633f, 0.576862216f},
-std::array<float,2>{0.946138084f, 0.676418126f},
-std::array<float,2>{0.180709928f, 0.0660011992f},
-std::array<float,2>{0.584511638f, 0.492135614f},
-std::array<float,2>{0.437269509f, 0.894851804f},
-std::array<float,2>{0.524893701f, 0.535976827f},
-std::array<float,2>{0.461214364f, 0.235467017f},
-std::array<float,2>{0.913395464f, 0.31308049f},
-std::array<float,2>{0.206132904f, 0.86764437f},
-std::array<float,2>{0.777006805f, 0.967614591f},
-std::array<float,2>{0.0178505741f, 0.40558365f},
-std::array<float,2>{0.64731425f, 0.0201257542f},
-std::array<float,2>{0.355608046f, 0.712054193f},
-std::array<float,2>{0.622032166f, 0.911160767f},
-std::array<float,2>{0.398074061f, 0.456974864f},
-std::array<float,2>{0.988119423f, 0.0969807655f},
-std::array<float,2>{0.153328404f, 0.645868301f},
-std::array<float,2>{0.870243728f, 0.620661199f},
-std::array<float,2>{0.107934982f, 0.181387469f},
-std::array<float,2>{0.711275339f, 0.271855414f},
-std::array<float,2>{0.276608258f, 0.803087652f},
-std::array<float,2>{0.661587656f, 0.74861145f},
-std::array<float,2>{0.338055372f, 0.0502341539f},
-std::array<float,2>{0.804225802f, 0.406589419f},
-std::array<float,2>{0.0356407315f, 0.982632756f},
-std::array<float,2>{0.886852205f, 0.843712687f},
-std::array<float,2>{0.249962971f, 0.354374886f},
-std::array<float,2>{0.543113291f, 0.190669671f},
-std::array<float,2>{0.489459574f, 0.527361631f},
-std::array<float,2>{0.708045304f, 0.898811519f},
-std::array<float,2>{0.269462496f, 0.49450919f},
-std::array<float,2>{0.864425778f, 0.0754170865f},
-std::array<float,2>{0.0955219343f, 0.681772232f},
-std::array<float,2>{0.996244252f, 0.567635477f},
-std::array<float,2>{0.141018122f, 0.14918074f},
-std::array<float,2>{0.614172518f, 0.304223746f},
-std::array<float,2>{0.406100333f, 0.774902165f},
-std::array<float,2>{0.536471605f, 0.709463418f},
-std::array<float,2>{0.498605371f, 0.0254610889f},
-std::array<float,2>{0.87749064f, 0.393897057f},
-std::array<float,2>{0.240824759f, 0.958672822f},
-std::array<float,2>{0.807032645f, 0.864129126f},
-std::array<float,2>{0.0462694503f, 0.325427175f},
-std::array<float,2>{0.669543147f, 0.248471841f},
-std::array<float,2>{0.332942098f, 0.542806327f},
-std::array<float,2>{0.591016114f, 0.808600724f},
-std::array<float,2>{0.427818537f, 0.274337322f},
-std::array<float,2>{0.940540791f, 0.17507036f},
-std::array<float,2>{0.178728864f, 0.610481679f},
-std::array<float,2>{0.840376973f, 0.64988786f},
-std::array<float,2>{0.0650384277f, 0.102190219f},
-std::array<float,2>{0.731509864f, 0.462517262f},
-std::array<float,2>{0.298384219f, 0.921245754f},
-std::array<float,2>{0.653616548f, 0.516711354f},
-std::array<float,2>{0.346689403f, 0.198505446f},
-std::array<float,2>{0.769147873f, 0.350829035f},
-std::array<float,2>{0.0258225873f, 0.828682542f},
-std::array<float,2>{0.919403017f, 0.973350942f},
-std::array<float,2>{0.213346064f, 0.418825805f},
-std::array<float,2>{0.520585418f, 0.0582103804f},
-std::array<float,2>{0.46070686f, 0.738178551f},
-std::array<float,2>{0.678377151f, 0.818616927f},
-std::array<float,2>{0.315661579f, 0.360271692f},
-std::array<float,2>{0.782372594f, 0.203849629f},
-std::array<float,2>{0.0620811246f, 0.507828414f},
-std::array<float,2>{0.89907974f, 0.723036051f},
-std::array<float,2>{0.234204069f, 0.0394005254f},
-std::array<float,2>{0.558047712f, 0.423384815f},
-std::array<float,2>{0.473260581f, 0.992364168f},
-std::array<float,2>{0.60804081f, 0.599398375f},
-std::array<float,2>{0.382610321f, 0.156732813f},
-std::array<float,2>{0.96929276f, 0.250283629f},
-std::array<float,2>{0.127706856f, 0.783789217f},
-std::array<float,2>{0.853563428f, 0.935115755f},
-std::array<float,2>{0.113247931f, 0.45012781f},
-std::array<float,2>{0.696801305f, 0.12447843f},
-std::array<float,2>{0.253147751f, 0.625699043f},
-std::array<float,2>{0.50107497f, 0.942426741f},
-std::array<float,2>{0.446317613f, 0.38447243f},
-std::array<float,2>{0.935505271f, 0.001248157f},
-std::array<float,2>{0.195223257f, 0.692703784f},
-std::array<float,2>{0.757909775f, 0.551067948f},
-std::array<float,2>{0.00430217059f, 0.228360519f},
-std::array<float,2>{0.630723596f, 0.334343851f},
-std::array<float,2>{0.363368332f, 0.849893272f},
-std::array<float,2>{0.748842239f, 0.666730642f},
-std::array<float,2>{0.286584765f, 0.0879798904f},
-std::array<float,2>{0.820836842f, 0.47884503f},
-std::array<float,2>{0.08083193f, 0.876071632f},
-std::array<float,2>{0.95942837f, 0.762745976f},
-std::array<float,2>{0.156804681f, 0.286448479f},
-std::array<float,2>{0.57460922f, 0.126759991f},
-std::array<float,2>{0.42090261f, 0.589123964f},
-std::array<float,2>{0.650073171f, 0.887039304f},
-std::array<float,2>{0.348175287f, 0.472995669f},
-std::array<float,2>{0.773265183f, 0.0846109316f},
-std::array<float,2>{0.0285334773f, 0.65790242f},
-std::array<float,2>{0.917188883f, 0.582420409f},
-std::array<float,2>{0.217429757f, 0.138937742f},
-std::array<float,2>{0.516689003f, 0.293470621f},
-std::array<float,2>{0.454654008f, 0.757293582f},
-std::array<float,2>{0.589353323f, 0.700246394f},
-std::array<float,2>{0.423814893f, 0.00823444873f},
-std::array<float,2>{0.941640377f, 0.381554246f},
-std::array<float,2>{0.17188403f, 0.951119721f},
-std::array<float,2>{0.837872148f, 0.854437232f},
-std::array<float,2>{0.0699078515f, 0.342227101f},
-std::array<float,2>{0.727462471f, 0.222307473f},
-std::array<float,2>{0.304319561f, 0.5570786f},
-std::array<float,2>{0.532323003f, 0.794744372f},
-std::array<float,2>{0.49266988f, 0.261874348f},
-std::array<float,2>{0.882210255f, 0.169637576f},
-std::array<float,2>{0.236743644f, 0.608532131f},
-std::array<float,2>{0.811375618f, 0.635247886f},
-std::array<float,2>{0.0391497314f, 0.110404894f},
-std::array<float,2>{0.665609121f, 0.442679584f},
-std::array<float,2>{0.330676645f, 0.923850417f},
-std::array<float,2>{0.703288794f, 0.505787611f},
-std::array<float,2>{0.270649523f, 0.217137262f},
-std::array<float,2>{0.862650156f, 0.371739864f},
-std::array<float,2>{0.0994836167f, 0.826259255f},
-std::array<float,2>{0.995017529f, 0.988608658f},
-std::array<float,2>{0.14455241f, 0.432432741f},
-std::array<float,2>{0.609915376f, 0.0372001082f},
-std::array<float,2>{0.398569912f, 0.729752719f},
-std::array<float,2>{0.744341314f, 0.837192476f},
-std::array<float,2>{0.284397453f, 0.356761217f},
-std::array<float,2>{0.825511336f, 0.194884658f},
-std::array<float,2>{0.0842335969f, 0.526550531f},
-std::array<float,2>{0.953632891f, 0.744846582f},
-std::array<float,2>{0.160447359f, 0.0539302304f},
-std::array<float,2>{0.571503818f, 0.41347751f},
-std::array<float,2>{0.414981276f, 0.977218091f},
-std::array<float,2>{0.505945981f, 0.621217072f},
-std::array<float,2>{0.449268192f, 0.185812116f},
-std::array<float,2>{0.933425188f, 0.265627235f},
-std::array<float,2>{0.187618896f, 0.80041194f},
-std::array<float,2>{0.764221311f, 0.906539083f},
-std::array<float,2>{0.0022277385f, 0.457904041f},
-std::array<float,2>{0.627973378f, 0.100854799f},
-std::array<float,2>{0.362703592f, 0.642028451f},
-std::array<float,2>{0.602491438f, 0.961755991f},
-std::array<float,2>{0.375670373f, 0.399272621f},
-std::array<float,2>{0.973083675f, 0.0158770699f},
-std::array<float,2>{0.132662952f, 0.717009962f},
-std::array<float,2>{0.855902612f, 0.534493685f},
-std::array<float,2>{0.116820976f, 0.240964577f},
-std::array<float,2>{0.701701343f, 0.316859335f},
-std::array<float,2>{0.255652696f, 0.872071326f},
-std::array<float,2>{0.674420774f, 0.675199986f},
-std::array<float,2>{0.319705129f, 0.0692196786f},
-std::array<float,2>{0.785744071f, 0.48480466f},
-std::array<float,2>{0.0563908778f, 0.894334435f},
-std::array<float,2>{0.904399574f, 0.769141436f},
-std::array<float,2>{0.229200691f, 0.307504147f},
-std::array<float,2>{0.559705079f, 0.14516826f},
-std::array<float,2>{0.470608681f, 0.570959985f},
-std::array<float,2>{0.68847394f, 0.97204721f},
-std::array<float,2>{0.260975122f, 0.416553408f},
-std::array<float,2>{0.849675536f, 0.0621922091f},
-std::array<float,2>{0.120957263f, 0.740809381f},
-std::array<float,2>{0.978310227f, 0.522804558f},
-std::array<float,2>{0.140594274f, 0.202053398f},
-std::array<float,2>{0.596670449f, 0.345913142f},
-std::array<float,2>{0.38369596f, 0.83339119f},
-std::array<float,2>{0.548621655f, 0.656013906f},
-std::array<float,2>{0.481855333f, 0.108913176f},
-std::array<float,2>{0.894862294f, 0.467253208f},
-std::array<float,2>{0.22534357f, 0.917014062f},
-std::array<float,2>{0.791148663f, 0.805902958f},
-std::array<float,2>{0.0519679822f, 0.279062629f},
-std::array<float,2>{0.684769392f, 0.179103926f},
-std::array<float,2>{0.321009904f, 0.616406918f},
-std::array<float,2>{0.567117751f, 0.86162889f},
-std::array<float,2>{0.40633145f, 0.324153394f},
-std::array<float,2>{0.968077838f, 0.242798343f},
-std::array<float,2>{0.170807883f, 0.546684265f},
-std::array<float,2>{0.818909705f, 0.70696342f},
-std::array<float,2>{0.0910721421f, 0.0273642763f},
-std::array<float,2>{0.735532224f, 0.395865917f},
-std::array<float,2>{0.296106935f, 0.955663264f},
-std::array<float,2>{0.634480774f, 0.564802527f},
-std::array<float,2>{0.371059984f, 0.15539816f},
-std::array<float,2>{0.750476658f, 0.297934234f},
-std::array<float,2>{0.00799538195f, 0.778690994f},
-std::array<float,2>{0.924668372f, 0.903477967f},
-std::array<float,2>{0.202698454f, 0.497809172f},
-std::array<float,2>{0.50920707f, 0.0726224333f},
-std::array<float,2>{0.442977428f, 0.685732245f},
-std::array<float,2>{0.658385754f, 0.760269165f},
-std::array<float,2>{0.342137218f, 0.285148501f},
-std::array<float,2>{0.798096478f, 0.131490201f},
-std::array<float,2>{0.0343141742f, 0.592714489f},
-std::array<float,2>{0.882863343f, 0.67042464f},
-std::array<float,2>{0.244677186f, 0.0899844766f},
-std::array<float,2>{0.5394696f, 0.482161939f},
-std::array<float,2>{0.488119632f, 0.881413758f},
-std::array<float,2>{0.619187057f, 0.54800266f},
-std::array<float,2>{0.393885314f, 0.233285785f},
-std::array<float,2>{0.989457011f, 0.330558836f},
-std::array<float,2>{0.149820566f, 0.844958186f},
-std::array<float,2>{0.871404231f, 0.937842667f},
-std::array<float,2>{0.101760507f, 0.389382303f},
-std::array<float,2>{0.717812717f, 0.00509899203f},
-std::array<float,2>{0.279993206f, 0.690190732f},
-std::array<float,2>{0.528072178f, 0.931225955f},
-std::array<float,2>{0.467222601f, 0.446905434f},
-std::array<float,2>{0.907813191f, 0.119035572f},
-std::array<float,2>{0.208513081f, 0.630018294f},
-std::array<float,2>{0.78070724f, 0.597140789f},
-std::array<float,2>{0.0215279609f, 0.161575079f},
-std::array<float,2>{0.642315507f, 0.256800503f},
-std::array<float,2>{0.352250844f, 0.789051592f},
-std::array<float,2>{0.723585069f, 0.721512914f},
-std::array<float,2>{0.305301666f, 0.0434200689f},
-std::array<float,2>{0.835841775f, 0.426958799f},
-std::array<float,2>{0.0721504018f, 0.996845365f},
-std::array<float,2>{0.949820697f, 0.815464795f},
-std::array<float,2>{0.186889723f, 0.365096182f},
-std::array<float,2>{0.580236495f, 0.210371092f},
-std::array<float,2>{0.430259079f, 0.512598217f},
-std::array<float,2>{0.681121826f, 0.948193908f},
-std::array<float,2>{0.326349854f, 0.375631094f},
-std::array<float,2>{0.79452002f, 0.0134192668f},
-std::array<float,2>{0.0471218936f, 0.698800266f},
-std::array<float,2>{0.893413067f, 0.56179148f},
-std::array<float,2>{0.218986779f, 0.226377219f},
-std::array<float,2>{0.552449763f, 0.338216484f},
-std::array<float,2>{0.478798777f, 0.856108963f},
-std::array<float,2>{0.600530446f, 0.66050452f},
-std::array<float,2>{0.387015611f, 0.0786154568f},
-std::array<float,2>{0.981705308f, 0.469710141f},
-std::array<float,2>{0.135924071f, 0.883898139f},
-std::array<float,2>{0.845290422f, 0.75058639f},
-std::array<float,2>{0.124993965f, 0.291009009f},
-std::array<float,2>{0.693168044f, 0.133985952f},
-std::array<float,2>{0.262126923f, 0.578710735f},
-std::array<float,2>{0.515306354f, 0.82244724f},
-std::array<float,2>{0.439857513f, 0.370601058f},
-std::array<float,2>{0.927255154f, 0.211270675f},
-std::array<float,2>{0.198469475f, 0.502546608f},
-std::array<float,2>{0.754425287f, 0.733273149f},
-std::array<float,2>{0.0124433571f, 0.0349832401f},
-std::array<float,2>{0.639771819f, 0.435740083f},
-std::array<float,2>{0.372781157f, 0.987693489f},
-std::array<float,2>{0.74163872f, 0.603587985f},
-std::array<float,2>{0.289374828f, 0.165677026f},
-std::array<float,2>{0.814642251f, 0.258243233f},
-std::array<float,2>{0.0872019529f, 0.790327728f},
-std::array<float,2>{0.963483691f, 0.929494619f},
-std::array<float,2>{0.166143239f, 0.43946299f},
-std::array<float,2>{0.563724458f, 0.114877939f},
-std::array<float,2>{0.412064642f, 0.637782574f},
-std::array<float,2>{0.714266717f, 0.802021384f},
-std::array<float,2>{0.273670614f, 0.271325648f},
-std::array<float,2>{0.868978441f, 0.182349339f},
-std::array<float,2>{0.105757341f, 0.617658377f},
-std::array<float,2>{0.984760165f, 0.647107065f},
-std::array<float,2>{0.1560601f, 0.0953512043f},
-std::array<float,2>{0.62425983f, 0.453777283f},
-std::array<float,2>{0.395882756f, 0.913393974f},
-std::array<float,2>{0.545799613f, 0.530970633f},
-std::array<float,2>{0.49076286f, 0.188378736f},
-std::array<float,2>{0.888810933f, 0.352759778f},
-std::array<float,2>{0.24751395f, 0.841689587f},
-std::array<float,2>{0.80178386f, 0.980632901f},
-std::array<float,2>{0.0371318497f, 0.408628374f},
-std::array<float,2>{0.662388384f, 0.0477339104f},
-std::array<float,2>{0.336725831f, 0.747647166f},
-std::array<float,2>{0.582548738f, 0.8978194f},
-std::array<float,2>{0.434182316f, 0.489013284f},
-std::array<float,2>{0.949205637f, 0.0628106743f},
-std::array<float,2>{0.182192162f, 0.679090977f},
-std::array<float,2>{0.831964076f, 0.574718654f},
-std::array<float,2>{0.0742966533f, 0.143830314f},
-std::array<float,2>{0.722077131f, 0.309894651f},
-std::array<float,2>{0.310767591f, 0.77211982f},
-std::array<float,2>{0.645127416f, 0.713833928f},
-std::array<float,2>{0.358946413f, 0.0226263255f},
-std::array<float,2>{0.774304986f, 0.402414232f},
-std::array<float,2>{0.0164434575f, 0.964966714f},
-std::array<float,2>{0.911078453f, 0.871040404f},
-std::array<float,2>{0.204846978f, 0.314948708f},
-std::array<float,2>{0.526669204f, 0.236881375f},
-std::array<float,2>{0.464776695f, 0.538312674f},
-std::array<float,2>{0.732946813f, 0.918190062f},
-std::array<float,2>{0.300683528f, 0.463474303f},
-std::array<float,2>{0.842566013f, 0.103755243f},
-std::array<float,2>{0.0636944249f, 0.651405573f},
-std::array<float,2>{0.93875891f, 0.612778783f},
-std::array<float,2>{0.176254854f, 0.172484949f},
-std::array<float,2>{0.592654705f, 0.276209533f},
-std::array<float,2>{0.42692703f, 0.812055469f},
-std::array<float,2>{0.521656394f, 0.735340774f},
-std::array<float,2>{0.458108217f, 0.0560420975f},
-std::array<float,2>{0.921228349f, 0.421845317f},
-std::array<float,2>{0.21112223f, 0.976195574f},
-std::array<float,2>{0.767417789f, 0.830762327f},
-std::array<float,2>{0.0252935328f, 0.348909765f},
-std::array<float,2>{0.655492008f, 0.196677774f},
-std::array<float,2>{0.345684707f, 0.517898142f},
-std::array<float,2>{0.616623163f, 0.775605619f},
-std::array<float,2>{0.404075533f, 0.301505953f},
-std::array<float,2>{0.998966932f, 0.1518327f},
-std::array<float,2>{0.143854737f, 0.570253551f},
-std::array<float,2>{0.866107166f, 0.679911911f},
-std::array<float,2>{0.0969408453f, 0.0770268813f},
-std::array<float,2>{0.710867286f, 0.492321223f},
-std::array<float,2>{0.26574561f, 0.901403785f},
-std::array<float,2>{0.670512319f, 0.540323257f},
-std::array<float,2>{0.33561188f, 0.247664928f},
-std::array<float,2>{0.805885255f, 0.326796204f},
-std::array<float,2>{0.0438526794f, 0.86685729f},
-std::array<float,2>{0.876513004f, 0.960003555f},
-std::array<float,2>{0.239591151f, 0.392452985f},
-std::array<float,2>{0.538714945f, 0.0243759248f},
-std::array<float,2>{0.497011334f, 0.70866406f},
-std::array<float,2>{0.631382465f, 0.848041117f},
-std::array<float,2>{0.366767496f, 0.33216083f},
-std::array<float,2>{0.760874927f, 0.23034887f},
-std::array<float,2>{0.00599730248f, 0.554322839f},
-std::array<float,2>{0.93637538f, 0.693611383f},
-std::array<float,2>{0.192388162f, 0.00198888406f},
-std::array<float,2>{0.502342522f, 0.385016114f},
-std::array<float,2>{0.447690845f, 0.945286334f},
-std::array<float,2>{0.576410711f, 0.587876081f},
-std::array<float,2>{0.419409305f, 0.12764746f},
-std::array<float,2>{0.957120776f, 0.287808776f},
-std::array<float,2>{0.160052761f, 0.764942944f},
-std::array<float,2>{0.822425723f, 0.878159165f},
-std::array<float,2>{0.0799890384f, 0.477437228f},
-std::array<float,2>{0.747434974f, 0.0865344703f},
-std::array<float,2>{0.288871527f, 0.665183842f},
-std::array<float,2>{0.556082547f, 0.995608628f},
-std::array<float,2>{0.47479108f, 0.425115466f},
-std::array<float,2>{0.901423275f, 0.0422816388f},
-std::array<float,2>{0.231860906f, 0.725186527f},
-std::array<float,2>{0.784003735f, 0.510175169f},
-std::array<float,2>{0.0602967329f, 0.206273034f},
-std::array<float,2>{0.676875293f, 0.362681657f},
-std::array<float,2>{0.313138902f, 0.817628741f},
-std::array<float,2>{0.698469341f, 0.628475249f},
-std::array<float,2>{0.251086205f, 0.121664353f},
-std::array<float,2>{0.853149414f, 0.452396423f},
-std::array<float,2>{0.111172311f, 0.937493682f},
-std::array<float,2>{0.972569346f, 0.781282961f},
-std::array<float,2>{0.1256098f, 0.253904074f},
-std::array<float,2>{0.606820464f, 0.159352183f},
-std::array<float,2>{0.38060227f, 0.59965378f},
-std::array<float,2>{0.681727886f, 0.884247184f},
-std::array<float,2>{0.324405521f, 0.469404727f},
-std::array<float,2>{0.795690775f, 0.0790149793f},
-std::array<float,2>{0.0493546873f, 0.660237491f},
-std::array<float,2>{0.8917436f, 0.578997433f},
-std::array<float,2>{0.222340569f, 0.134202883f},
-std::array<float,2>{0.552784443f, 0.290617347f},
-std::array<float,2>{0.478411496f, 0.750946343f},
-std::array<float,2>{0.598682225f, 0.699206352f},
-std::array<float,2>{0.390089959f, 0.0134828407f},
-std::array<float,2>{0.982658744f, 0.375790179f},
-std::array<float,2>{0.134318098f, 0.947915494f},
-std::array<float,2>{0.845877171f, 0.856261969f},
-std::array<float,2>{0.122469611f, 0.337969154f},
-std::array<float,2>{0.693495095f, 0.226292714f},
-std::array<float,2>{0.263812214f, 0.561543763f},
-std::array<float,2>{0.513641596f, 0.790094972f},
-std::array<float,2>{0.437618852f, 0.25796786f},
-std::array<float,2>{0.929686785f, 0.165944576f},
-std::array<float,2>{0.196129248f, 0.603991032f},
-std::array<float,2>{0.75763166f, 0.637959242f},
-std::array<float,2>{0.0154552525f, 0.115157455f},
-std::array<float,2>{0.638386309f, 0.439892113f},
-std::array<float,2>{0.37308079f, 0.929283738f},
-std::array<float,2>{0.739328325f, 0.502774358f},
-std::array<float,2>{0.292181343f, 0.211017743f},
-std::array<float,2>{0.813652933f, 0.370300293f},
-std::array<float,2>{0.0887198001f, 0.822716236f},
-std::array<float,2>{0.961129725f, 0.987400532f},
-std::array<float,2>{0.164514527f, 0.435885847f},
-std::array<float,2>{0.566173375f, 0.0348922424f},
-std::array<float,2>{0.412502587f, 0.733020127f},
-std::array<float,2>{0.712708712f, 0.841416717f},
-std::array<float,2>{0.275921404f, 0.352850348f},
-std::array<float,2>{0.869391084f, 0.188136041f},
-std::array<float,2>{0.108513467f, 0.531227887f},
-std::array<float,2>{0.987095892f, 0.747941911f},
-std::array<float,2>{0.15283066f, 0.0475505628f},
-std::array<float,2>{0.622117102f, 0.408266157f},
-std::array<float,2>{0.396575481f, 0.980771542f},
-std::array<float,2>{0.544163883f, 0.617251813f},
-std::array<float,2>{0.488496989f, 0.182514504f},
-std::array<float,2>{0.888068974f, 0.27109009f},
-std::array<float,2>{0.248554066f, 0.801776588f},
-std::array<float,2>{0.803296566f, 0.913147867f},
-std::array<float,2>{0.0366074331f, 0.454067707f},
-std::array<float,2>{0.661085188f, 0.0956655592f},
-std::array<float,2>{0.339539111f, 0.647342086f},
-std::array<float,2>{0.585933328f, 0.965231478f},
-std::array<float,2>{0.435554177f, 0.402796835f},
-std::array<float,2>{0.946678877f, 0.0228539705f},
-std::array<float,2>{0.179864526f, 0.713480532f},
-std::array<float,2>{0.829213858f, 0.538436115f},
-std::array<float,2>{0.0767090023f, 0.237220854f},
-std::array<float,2>{0.72045356f, 0.315413743f},
-std::array<float,2>{0.309111297f, 0.870672703f},
-std::array<float,2>{0.64820689f, 0.678949058f},
-std::array<float,2>{0.356560409f, 0.0626470298f},
-std::array<float,2>{0.776328862f, 0.489237428f},
-std::array<float,2>{0.0187567919f, 0.897650123f},
-std::array<float,2>{0.912585139f, 0.772241414f},
-std::array<float,2>{0.20568338f, 0.309696853f},
-std::array<float,2>{0.523617864f, 0.143620804f},
-std::array<float,2>{0.461959064f, 0.575172365f},
-std::array<float,2>{0.73130399f, 0.976376772f},
-std::array<float,2>{0.297591448f, 0.421389192f},
-std::array<float,2>{0.840967834f, 0.0557129011f},
-std::array<float,2>{0.0663127825f, 0.734937727f},
-std::array<float,2>{0.939785898f, 0.517637312f},
-std::array<float,2>{0.177888349f, 0.196309209f},
-std::array<float,2>{0.589996517f, 0.348757535f},
-std::array<float,2>{0.429335952f, 0.830849588f},
-std::array<float,2>{0.520213604f, 0.651665449f},
-std::array<float,2>{0.459382564f, 0.103853136f},
-std::array<float,2>{0.918174982f, 0.463770002f},
-std::array<float,2>{0.214530766f, 0.918300748f},
-std::array<float,2>{0.767822564f, 0.812457263f},
-std::array<float,2>{0.0268896632f, 0.27610594f},
-std::array<float,2>{0.653131545f, 0.172835618f},
-std::array<float,2>{0.346068144f, 0.612333238f},
-std::array<float,2>{0.614977479f, 0.866949797f},
-std::array<float,2>{0.404361337f, 0.327043176f},
-std::array<float,2>{0.997810543f, 0.247869074f},
-std::array<float,2>{0.142492294f, 0.540180266f},
-std::array<float,2>{0.863727093f, 0.708763659f},
-std::array<float,2>{0.0938579664f, 0.0241697822f},
-std::array<float,2>{0.707348585f, 0.392287046f},
-std::array<float,2>{0.267886817f, 0.960210681f},
-std::array<float,2>{0.668604791f, 0.569853246f},
-std::array<float,2>{0.333098382f, 0.151552901f},
-std::array<float,2>{0.807753742f, 0.301734447f},
-std::array<float,2>{0.0455875322f, 0.775778353f},
-std::array<float,2>{0.878143251f, 0.901627004f},
-std::array<float,2>{0.241951481f, 0.492536187f},
-std::array<float,2>{0.535578609f, 0.0768496543f},
-std::array<float,2>{0.499783307f, 0.680022895f},
-std::array<float,2>{0.629299581f, 0.764747798f},
-std::array<float,2>{0.36505577f, 0.287864268f},
-std::array<float,2>{0.758898735f, 0.127894998f},
-std::array<float,2>{0.00568670966f, 0.587638974f},
-std::array<float,2>{0.933774352f, 0.665515721f},
-std::array<float,2>{0.194025949f, 0.0867821351f},
-std::array<float,2>{0.500240266f, 0.477224678f},
-std::array<float,2>{0.445571542f, 0.878293991f},
-std::array<float,2>{0.575780809f, 0.554668963f},
-std::array<float,2>{0.420390457f, 0.230185375f},
-std::array<float,2>{0.960538089f, 0.33251223f},
-std::array<float,2>{0.157937214f, 0.847660899f},
-std::array<float,2>{0.821770549f, 0.945059001f},
-std::array<float,2>{0.0818565562f, 0.384850591f},
-std::array<float,2>{0.749305129f, 0.00239098258f},
-std::array<float,2>{0.285497606f, 0.693370938f},
-std::array<float,2>{0.557206392f, 0.937188923f},
-std::array<float,2>{0.474316925f, 0.452203572f},
-std::array<float,2>{0.900301158f, 0.122058749f},
-std::array<float,2>{0.233230919f, 0.628863692f},
-std::array<float,2>{0.782121837f, 0.600052774f},
-std::array<float,2>{0.060934905f, 0.159662023f},
-std::array<float,2>{0.679428339f, 0.253601938f},
-std::array<float,2>{0.314873517f, 0.78159982f},
-std::array<float,2>{0.695930302f, 0.725539982f},
-std::array<float,2>{0.252538174f, 0.0420111045f},
-std::array<float,2>{0.855291307f, 0.424953669f},
-std::array<float,2>{0.111624978f, 0.995989919f},
-std::array<float,2>{0.969968617f, 0.817486823f},
-std::array<float,2>{0.128837064f, 0.362532169f},
-std::array<float,2>{0.609339356f, 0.206439391f},
-std::array<float,2>{0.381657094f, 0.509824038f},
-std::array<float,2>{0.651079714f, 0.950736523f},
-std::array<float,2>{0.34995079f, 0.381764263f},
-std::array<float,2>{0.769634366f, 0.00800987147f},
-std::array<float,2>{0.0310249962f, 0.700448215f},
-std::array<float,2>{0.915418148f, 0.556744516f},
-std::array<float,2>{0.215179726f, 0.222464249f},
-std::array<float,2>{0.518106699f, 0.341852516f},
-std::array<float,2>{0.455708653f, 0.854063749f},
-std::array<float,2>{0.587498903f, 0.658179998f},
-std::array<float,2>{0.424669325f, 0.0847321227f},
-std::array<float,2>{0.944707334f, 0.472896397f},
-std::array<float,2>{0.175428793f, 0.886865199f},
-std::array<float,2>{0.839535177f, 0.757039011f},
-std::array<float,2>{0.0672665313f, 0.293855071f},
-std::array<float,2>{0.730201364f, 0.138815388f},
-std::array<float,2>{0.301598907f, 0.582274675f},
-std::array<float,2>{0.534498155f, 0.826440752f},
-std::array<float,2>{0.494492412f, 0.371889353f},
-std::array<float,2>{0.880527139f, 0.217002943f},
-std::array<float,2>{0.23514764f, 0.505387008f},
-std::array<float,2>{0.808945656f, 0.729524553f},
-std::array<float,2>{0.0423638448f, 0.0373854972f},
-std::array<float,2>{0.666223466f, 0.432243615f},
-std::array<float,2>{0.328167766f, 0.988475263f},
-std::array<float,2>{0.706139922f, 0.608722866f},
-std::array<float,2>{0.272504836f, 0.169900462f},
-std::array<float,2>{0.860656083f, 0.261985093f},
-std::array<float,2>{0.0996162072f, 0.794532239f},
-std::array<float,2>{0.992955267f, 0.924265087f},
-std::array<float,2>{0.146874711f, 0.442450821f},
-std::array<float,2>{0.612878084f, 0.110643819f},
-std::array<float,2>{0.401232511f, 0.634781897f},
-std::array<float,2>{0.743102193f, 0.800555348f},
-std::array<float,2>{0.282826334f, 0.265952706f},
-std::array<float,2>{0.826562762f, 0.185548648f},
-std::array<float,2>{0.0824319571f, 0.621405959f},
-std::array<float,2>{0.956396937f, 0.641833305f},
-std::array<float,2>{0.163182557f, 0.100663453f},
-std::array<float,2>{0.57397598f, 0.457668781f},
-std::array<float,2>{0.416399479f, 0.906483054f},
-std::array<float,2>{0.50448519f, 0.526766002f},
-std::array<float,2>{0.451224744f, 0.195127621f},
-std::array<float,2>{0.930573344f, 0.356670976f},
-std::array<float,2>{0.190346643f, 0.837034881f},
-std::array<float,2>{0.763547063f, 0.977305114f},
-std::array<float,2>{0.00122001627f, 0.413234055f},
-std::array<float,2>{0.625725508f, 0.0541258566f},
-std::array<float,2>{0.361066848f, 0.744885623f},
-std::array<float,2>{0.605023861f, 0.894117713f},
-std::array<float,2>{0.37743181f, 0.484492928f},
-std::array<float,2>{0.976353228f, 0.0690339431f},
-std::array<float,2>{0.129576728f, 0.67497319f},
-std::array<float,2>{0.858813703f, 0.571059227f},
-std::array<float,2>{0.113367535f, 0.145296365f},
-std::array<float,2>{0.700394273f, 0.307226419f},
-std::array<float,2>{0.256267458f, 0.769380808f},
-std::array<float,2>{0.67315805f, 0.717111528f},
-std::array<float,2>{0.318024158f, 0.0156997088f},
-std::array<float,2>{0.788237512f, 0.398987114f},
-std::array<float,2>{0.0566756316f, 0.961522281f},
-std::array<float,2>{0.902545989f, 0.872385144f},
-std::array<float,2>{0.227783874f, 0.316558301f},
-std::array<float,2>{0.562014163f, 0.240969107f},
-std::array<float,2>{0.472423911f, 0.534230649f},
-std::array<float,2>{0.690815449f, 0.917452395f},
-std::array<float,2>{0.257993191f, 0.466836929f},
-std::array<float,2>{0.849099517f, 0.1093418f},
-std::array<float,2>{0.117591456f, 0.656001985f},
-std::array<float,2>{0.980008245f, 0.616506577f},
-std::array<float,2>{0.136755958f, 0.17892997f},
-std::array<float,2>{0.595264077f, 0.279007971f},
-std::array<float,2>{0.385819912f, 0.806065857f},
-std::array<float,2>{0.549781501f, 0.741071284f},
-std::array<float,2>{0.483675927f, 0.0624577664f},
-std::array<float,2>{0.896647453f, 0.416941226f},
-std::array<float,2>{0.224017024f, 0.971864641f},
-std::array<float,2>{0.790627956f, 0.833086491f},
-std::array<float,2>{0.0532655865f, 0.345961183f},
-std::array<float,2>{0.686137199f, 0.201710701f},
-std::array<float,2>{0.32319504f, 0.522483051f},
-std::array<float,2>{0.569170356f, 0.778531611f},
-std::array<float,2>{0.410009474f, 0.298238724f},
-std::array<float,2>{0.96657443f, 0.155697286f},
-std::array<float,2>{0.168078184f, 0.564693213f},
-std::array<float,2>{0.817220032f, 0.685887337f},
-std::array<float,2>{0.0928595662f, 0.0725062713f},
-std::array<float,2>{0.737639368f, 0.497777611f},
-std::array<float,2>{0.293117613f, 0.90365994f},
-std::array<float,2>{0.6354568f, 0.54661572f},
-std::array<float,2>{0.368018866f, 0.243092865f},
-std::array<float,2>{0.753488898f, 0.323794842f},
-std::array<float,2>{0.0114081642f, 0.861514926f},
-std::array<float,2>{0.923619986f, 0.95587182f},
-std::array<float,2>{0.200612023f, 0.395737618f},
-std::array<float,2>{0.510322869f, 0.0278186165f},
-std::array<float,2>{0.443763018f, 0.706735611f},
-std::array<float,2>{0.656253159f, 0.845047355f},
-std::array<float,2>{0.34175688f, 0.330268294f},
-std::array<float,2>{0.79952997f, 0.233027995f},
-std::array<float,2>{0.0318035446f, 0.548216343f},
-std::array<float,2>{0.884801865f, 0.690180004f},
-std::array<float,2>{0.242791802f, 0.00528645935f},
-std::array<float,2>{0.541324139f, 0.389509737f},
-std::array<float,2>{0.48523584f, 0.937741041f},
-std::array<float,2>{0.617747366f, 0.592372298f},
-std::array<float,2>{0.391963005f, 0.131746501f},
-std::array<float,2>{0.991403878f, 0.284757465f},
-std::array<float,2>{0.151928246f, 0.760628343f},
-std::array<float,2>{0.874626696f, 0.881749034f},
-std::array<float,2>{0.103907183f, 0.482262462f},
-std::array<float,2>{0.7158764f, 0.0902345181f},
-std::array<float,2>{0.27769953f, 0.670699179f},
-std::array<float,2>{0.529960096f, 0.996601284f},
-std::array<float,2>{0.466508716f, 0.427093655f},
-std::array<float,2>{0.908345222f, 0.0431430712f},
-std::array<float,2>{0.210357592f, 0.721434832f},
-std::array<float,2>{0.779028773f, 0.512390554f},
-std::array<float,2>{0.0199278556f, 0.209988117f},
-std::array<float,2>{0.644483328f, 0.364795238f},
-std::array<float,2>{0.353989601f, 0.815882504f},
-std::array<float,2>{0.726339042f, 0.630243361f},
-std::array<float,2>{0.308534205f, 0.118813351f},
-std::array<float,2>{0.832257509f, 0.447187841f},
-std::array<float,2>{0.0738344565f, 0.931466043f},
-std::array<float,2>{0.951444328f, 0.788647771f},
-std::array<float,2>{0.184983969f, 0.256408364f},
-std::array<float,2>{0.578373492f, 0.161362126f},
-std::array<float,2>{0.43317613f, 0.596766293f},
-std::array<float,2>{0.639177024f, 0.927229524f},
-std::array<float,2>{0.371870667f, 0.439058006f},
-std::array<float,2>{0.755713046f, 0.11572466f},
-std::array<float,2>{0.0136664025f, 0.638842702f},
-std::array<float,2>{0.926507533f, 0.601963997f},
-std::array<float,2>{0.197621316f, 0.166195214f},
-std::array<float,2>{0.514147758f, 0.259983271f},
-std::array<float,2>{0.440816373f, 0.792069912f},
-std::array<float,2>{0.56260705f, 0.731034577f},
-std::array<float,2>{0.410896778f, 0.0315884985f},
-std::array<float,2>{0.964758575f, 0.434303284f},
-std::array<float,2>{0.167451486f, 0.986014426f},
-std::array<float,2>{0.816326141f, 0.821667254f},
-std::array<float,2>{0.0862315297f, 0.367610425f},
-std::array<float,2>{0.740452468f, 0.213620722f},
-std::array<float,2>{0.29035905f, 0.500674427f},
-std::array<float,2>{0.551216304f, 0.753087699f},
-std::array<float,2>{0.479579687f, 0.29237327f},
-std::array<float,2>{0.894177616f, 0.136098385f},
-std::array<float,2>{0.220424727f, 0.581360936f},
-std::array<float,2>{0.793795586f, 0.662548542f},
-std::array<float,2>{0.0487644635f, 0.0816414133f},
-std::array<float,2>{0.68047148f, 0.47146368f},
-std::array<float,2>{0.327886969f, 0.886365175f},
-std::array<float,2>{0.691637099f, 0.558931649f},
-std::array<float,2>{0.263593197f, 0.222656831f},
-std::array<float,2>{0.844030023f, 0.337566078f},
-std::array<float,2>{0.123687319f, 0.857735038f},
-std::array<float,2>{0.981283009f, 0.947140098f},
-std::array<float,2>{0.135416418f, 0.378718585f},
-std::array<float,2>{0.600743651f, 0.0143716838f},
-std::array<float,2>{0.388554305f, 0.696320713f},
-std::array<float,2>{0.720863283f, 0.867368996f},
-std::array<float,2>{0.311556637f, 0.313333452f},
-std::array<float,2>{0.830956936f, 0.235799238f},
-std::array<float,2>{0.0753062889f, 0.535675228f},
-std::array<float,2>{0.94762975f, 0.712309003f},
-std::array<float,2>{0.183505327f, 0.0203083064f},
-std::array<float,2>{0.583224535f, 0.405357838f},
-std::array<float,2>{0.434576809f, 0.967366457f},
-std::array<float,2>{0.526126683f, 0.576929271f},
-std::array<float,2>{0.463200331f, 0.142171338f},
-std::array<float,2>{0.911152065f, 0.310695469f},
-std::array<float,2>{0.204031974f, 0.770598292f},
-std::array<float,2>{0.775086701f, 0.894755602f},
-std::array<float,2>{0.016758142f, 0.491820782f},
-std::array<float,2>{0.645855665f, 0.0663557425f},
-std::array<float,2>{0.357521355f, 0.67665714f},
-std::array<float,2>{0.623538554f, 0.982834101f},
-std::array<float,2>{0.39485091f, 0.406399846f},
-std::array<float,2>{0.98598206f, 0.0498598702f},
-std::array<float,2>{0.154792324f, 0.748798668f},
-std::array<float,2>{0.86777693f, 0.527747512f},
-std::array<float,2>{0.106972113f, 0.190685332f},
-std::array<float,2>{0.713293314f, 0.354123473f},
-std::array<float,2>{0.274818987f, 0.843466341f},
-std::array<float,2>{0.663103044f, 0.645729363f},
-std::array<float,2>{0.337374061f, 0.0966859609f},
-std::array<float,2>{0.80126667f, 0.456708252f},
-std::array<float,2>{0.0387628414f, 0.911479533f},
-std::array<float,2>{0.889808536f, 0.802783608f},
-std::array<float,2>{0.24626404f, 0.271593153f},
-std::array<float,2>{0.546379507f, 0.181610271f},
-std::array<float,2>{0.492113709f, 0.620975673f},
-std::array<float,2>{0.709863186f, 0.958903909f},
-std::array<float,2>{0.266662002f, 0.393669516f},
-std::array<float,2>{0.867070317f, 0.0258479044f},
-std::array<float,2>{0.0958853513f, 0.709029675f},
-std::array<float,2>{0.999550343f, 0.542520165f},
-std::array<float,2>{0.143179089f, 0.248233169f},
-std::array<float,2>{0.61574471f, 0.325487822f},
-std::array<float,2>{0.402454317f, 0.863897622f},
-std::array<float,2>{0.538068116f, 0.682061255f},
-std::array<float,2>{0.497432381f, 0.0754446909f},
-std::array<float,2>{0.875790298f, 0.494248331f},
-std::array<float,2>{0.238856092f, 0.898595929f},
-std::array<float,2>{0.805253863f, 0.774474263f},
-std::array<float,2>{0.0442080349f, 0.30450508f},
-std::array<float,2>{0.671348035f, 0.149117142f},
-std::array<float,2>{0.334485918f, 0.567617953f},
-std::array<float,2>{0.593557954f, 0.828997314f},
-std::array<float,2>{0.426700115f, 0.351061791f},
-std::array<float,2>{0.938097239f, 0.198298723f},
-std::array<float,2>{0.177588657f, 0.517079175f},
-std::array<float,2>{0.843199015f, 0.737836599f},
-std::array<float,2>{0.06333673f, 0.0583614185f},
-std::array<float,2>{0.7336092f, 0.418534577f},
-std::array<float,2>{0.299244553f, 0.973582864f},
-std::array<float,2>{0.654952288f, 0.610797107f},
-std::array<float,2>{0.34445864f, 0.174951434f},
-std::array<float,2>{0.766088843f, 0.274150193f},
-std::array<float,2>{0.024019653f, 0.809012651f},
-std::array<float,2>{0.920421839f, 0.921074569f},
-std::array<float,2>{0.212408856f, 0.46284309f},
-std::array<float,2>{0.522950649f, 0.102486953f},
-std::array<float,2>{0.457197964f, 0.649530768f},
-std::array<float,2>{0.676299274f, 0.7840873f},
-std::array<float,2>{0.313716114f, 0.250013947f},
-std::array<float,2>{0.784973621f, 0.156254396f},
-std::array<float,2>{0.059264645f, 0.599123597f},
-std::array<float,2>{0.901183128f, 0.625821948f},
-std::array<float,2>{0.230850697f, 0.124260798f},
-std::array<float,2>{0.554823995f, 0.449733794f},
-std::array<float,2>{0.476200759f, 0.935360432f},
-std::array<float,2>{0.606310308f, 0.508111477f},
-std::array<float,2>{0.379177064f, 0.20404014f},
-std::array<float,2>{0.971624613f, 0.360073894f},
-std::array<float,2>{0.126299039f, 0.818528771f},
-std::array<float,2>{0.852045059f, 0.992497146f},
-std::array<float,2>{0.110287689f, 0.42368257f},
-std::array<float,2>{0.697938442f, 0.0390983038f},
-std::array<float,2>{0.25086534f, 0.722848952f},
-std::array<float,2>{0.503404975f, 0.876429677f},
-std::array<float,2>{0.448317766f, 0.478559703f},
-std::array<float,2>{0.937100828f, 0.0882295817f},
-std::array<float,2>{0.191534579f, 0.666781604f},
-std::array<float,2>{0.76067239f, 0.589044571f},
-std::array<float,2>{0.00754220132f, 0.12649785f},
-std::array<float,2>{0.632757783f, 0.286351949f},
-std::array<float,2>{0.365592957f, 0.763177812f},
-std::array<float,2>{0.746690214f, 0.692388356f},
-std::array<float,2>{0.28797558f, 0.00120200787f},
-std::array<float,2>{0.823716402f, 0.384741336f},
-std::array<float,2>{0.078259699f, 0.942819297f},
-std::array<float,2>{0.958853781f, 0.849614501f},
-std::array<float,2>{0.158305287f, 0.334085792f},
-std::array<float,2>{0.577345014f, 0.228155836f},
-std::array<float,2>{0.418766826f, 0.550823927f},
-std::array<float,2>{0.664882958f, 0.990757942f},
-std::array<float,2>{0.331903994f, 0.431497276f},
-std::array<float,2>{0.811879575f, 0.0364361443f},
-std::array<float,2>{0.0403295308f, 0.7271505f},
-std::array<float,2>{0.880998552f, 0.507056952f},
-std::array<float,2>{0.237691805f, 0.215885818f},
-std::array<float,2>{0.531954765f, 0.373517901f},
-std::array<float,2>{0.493982315f, 0.824881852f},
-std::array<float,2>{0.610900164f, 0.633940399f},
-std::array<float,2>{0.399785578f, 0.111647919f},
-std::array<float,2>{0.99564141f, 0.444609344f},
-std::array<float,2>{0.145963475f, 0.923793435f},
-std::array<float,2>{0.861366868f, 0.795820236f},
-std::array<float,2>{0.0978630483f, 0.264480948f},
-std::array<float,2>{0.704412103f, 0.170147002f},
-std::array<float,2>{0.269734353f, 0.606779456f},
-std::array<float,2>{0.515850365f, 0.852973819f},
-std::array<float,2>{0.453529477f, 0.341243029f},
-std::array<float,2>{0.916069686f, 0.219248831f},
-std::array<float,2>{0.218507335f, 0.555353105f},
-std::array<float,2>{0.772191167f, 0.703123629f},
-std::array<float,2>{0.0277782716f, 0.0102868276f},
-std::array<float,2>{0.648820043f, 0.379711002f},
-std::array<float,2>{0.349428356f, 0.951491416f},
-std::array<float,2>{0.728210568f, 0.584865093f},
-std::array<float,2>{0.303678393f, 0.137514174f},
-std::array<float,2>{0.836290538f, 0.295862436f},
-std::array<float,2>{0.0691518039f, 0.755779624f},
-std::array<float,2>{0.942516804f, 0.890405416f},
-std::array<float,2>{0.173108205f, 0.474806994f},
-std::array<float,2>{0.587968409f, 0.0834826976f},
-std::array<float,2>{0.422161102f, 0.659347236f},
-std::array<float,2>{0.702684641f, 0.76752919f},
-std::array<float,2>{0.254724205f, 0.306070536f},
-std::array<float,2>{0.856752872f, 0.146738067f},
-std::array<float,2>{0.115286484f, 0.573402107f},
-std::array<float,2>{0.974293172f, 0.673360586f},
-std::array<float,2>{0.131767869f, 0.0674394295f},
-std::array<float,2>{0.603287458f, 0.486908674f},
-std::array<float,2>{0.376132399f, 0.891570985f},
-std::array<float,2>{0.559414268f, 0.531863987f},
-std::array<float,2>{0.469106942f, 0.239843562f},
-std::array<float,2>{0.90584749f, 0.318361402f},
-std::array<float,2>{0.230118319f, 0.873225152f},
-std::array<float,2>{0.786918044f, 0.963485003f},
-std::array<float,2>{0.0550597832f, 0.400960594f},
-std::array<float,2>{0.674947977f, 0.0185523108f},
-std::array<float,2>{0.318687439f, 0.716441631f},
-std::array<float,2>{0.570429265f, 0.908695459f},
-std::array<float,2>{0.415683806f, 0.459033132f},
-std::array<float,2>{0.954294026f, 0.0993579626f},
-std::array<float,2>{0.161267415f, 0.644114375f},
-std::array<float,2>{0.824760437f, 0.62461412f},
-std::array<float,2>{0.085815981f, 0.185521618f},
-std::array<float,2>{0.745151222f, 0.269164234f},
-std::array<float,2>{0.283421129f, 0.798113406f},
-std::array<float,2>{0.627400339f, 0.742688358f},
-std::array<float,2>{0.362033755f, 0.0511571318f},
-std::array<float,2>{0.765076995f, 0.411821514f},
-std::array<float,2>{0.0032508322f, 0.97853756f},
-std::array<float,2>{0.932415128f, 0.839266896f},
-std::array<float,2>{0.188818201f, 0.357952595f},
-std::array<float,2>{0.507322609f, 0.192679539f},
-std::array<float,2>{0.451156855f, 0.524828792f},
-std::array<float,2>{0.734699667f, 0.904971719f},
-std::array<float,2>{0.294967204f, 0.499336869f},
-std::array<float,2>{0.820271254f, 0.0704215914f},
-std::array<float,2>{0.0906546339f, 0.685407281f},
-std::array<float,2>{0.96773386f, 0.563839853f},
-std::array<float,2>{0.171748579f, 0.152751505f},
-std::array<float,2>{0.567563951f, 0.299175173f},
-std::array<float,2>{0.408187389f, 0.779600918f},
-std::array<float,2>{0.508014143f, 0.704869926f},
-std::array<float,2>{0.441742569f, 0.0301718265f},
-std::array<float,2>{0.924862027f, 0.396858454f},
-std::array<float,2>{0.201736882f, 0.954831958f},
-std::array<float,2>{0.751133919f, 0.859786689f},
-std::array<float,2>{0.00903230812f, 0.321903646f},
-std::array<float,2>{0.633058131f, 0.244325414f},
-std::array<float,2>{0.369435489f, 0.543055296f},
-std::array<float,2>{0.597327471f, 0.807028532f},
-std::array<float,2>{0.383793294f, 0.280122161f},
-std::array<float,2>{0.977049887f, 0.176698327f},
-std::array<float,2>{0.138992235f, 0.61500293f},
-std::array<float,2>{0.850876451f, 0.653356254f},
-std::array<float,2>{0.119336791f, 0.107248977f},
-std::array<float,2>{0.688697517f, 0.466356874f},
-std::array<float,2>{0.260036737f, 0.91576308f},
-std::array<float,2>{0.684515774f, 0.521100998f},
-std::array<float,2>{0.321531653f, 0.19946374f},
-std::array<float,2>{0.792823732f, 0.34551242f},
-std::array<float,2>{0.0517347269f, 0.834295988f},
-std::array<float,2>{0.896420121f, 0.969486952f},
-std::array<float,2>{0.226237833f, 0.415783614f},
-std::array<float,2>{0.547667742f, 0.0604926609f},
-std::array<float,2>{0.480540276f, 0.738389194f},
-std::array<float,2>{0.640899301f, 0.813921094f},
-std::array<float,2>{0.353247315f, 0.367125183f},
-std::array<float,2>{0.780035913f, 0.208449841f},
-std::array<float,2>{0.0226023197f, 0.514574289f},
-std::array<float,2>{0.906875193f, 0.719247401f},
-std::array<float,2>{0.20729661f, 0.0450327657f},
-std::array<float,2>{0.528390408f, 0.428294778f},
-std::array<float,2>{0.467856884f, 0.998128474f},
-std::array<float,2>{0.581093132f, 0.594635248f},
-std::array<float,2>{0.431491971f, 0.163623944f},
-std::array<float,2>{0.950469553f, 0.254536659f},
-std::array<float,2>{0.18590714f, 0.785486579f},
-std::array<float,2>{0.834353805f, 0.93340838f},
-std::array<float,2>{0.0703441203f, 0.449153125f},
-std::array<float,2>{0.723655343f, 0.120564722f},
-std::array<float,2>{0.305922866f, 0.630917192f},
-std::array<float,2>{0.5408023f, 0.940755069f},
-std::array<float,2>{0.486503929f, 0.387587368f},
-std::array<float,2>{0.884380698f, 0.00732208788f},
-std::array<float,2>{0.245902717f, 0.688737035f},
-std::array<float,2>{0.7970559f, 0.549188673f},
-std::array<float,2>{0.0339387394f, 0.23224853f},
-std::array<float,2>{0.660067976f, 0.328160405f},
-std::array<float,2>{0.34332481f, 0.846132457f},
-std::array<float,2>{0.716889918f, 0.669428825f},
-std::array<float,2>{0.280740947f, 0.0936422423f},
-std::array<float,2>{0.872095048f, 0.483992428f},
-std::array<float,2>{0.102808371f, 0.880758822f},
-std::array<float,2>{0.988621175f, 0.758702219f},
-std::array<float,2>{0.148633555f, 0.282622099f},
-std::array<float,2>{0.620854318f, 0.129684538f},
-std::array<float,2>{0.392662495f, 0.591667354f},
-std::array<float,2>{0.662049234f, 0.910497904f},
-std::array<float,2>{0.338749081f, 0.455650747f},
-std::array<float,2>{0.804108143f, 0.0961228311f},
-std::array<float,2>{0.036110349f, 0.645333111f},
-std::array<float,2>{0.887369394f, 0.619814813f},
-std::array<float,2>{0.249160886f, 0.180274934f},
-std::array<float,2>{0.543828845f, 0.273045301f},
-std::array<float,2>{0.490041792f, 0.804229677f},
-std::array<float,2>{0.621391952f, 0.749228299f},
-std::array<float,2>{0.397604704f, 0.0490238592f},
-std::array<float,2>{0.987426281f, 0.408043385f},
-std::array<float,2>{0.154226378f, 0.983576655f},
-std::array<float,2>{0.870834172f, 0.842749953f},
-std::array<float,2>{0.107811019f, 0.355440766f},
-std::array<float,2>{0.711677015f, 0.18993251f},
-std::array<float,2>{0.276859492f, 0.529048681f},
-std::array<float,2>{0.524933815f, 0.77030623f},
-std::array<float,2>{0.461783618f, 0.311884314f},
-std::array<float,2>{0.913775086f, 0.140962943f},
-std::array<float,2>{0.206814155f, 0.577228606f},
-std::array<float,2>{0.776652515f, 0.677075624f},
-std::array<float,2>{0.018320702f, 0.0646735355f},
-std::array<float,2>{0.646772146f, 0.490792066f},
-std::array<float,2>{0.35596016f, 0.896077037f},
-std::array<float,2>{0.719098091f, 0.536979198f},
-std::array<float,2>{0.309737235f, 0.234478578f},
-std::array<float,2>{0.828766286f, 0.313926995f},
-std::array<float,2>{0.0775074214f, 0.868643641f},
-std::array<float,2>{0.945503414f, 0.96781677f},
-std::array<float,2>{0.181226492f, 0.404880911f},
-std::array<float,2>{0.584371209f, 0.0210945606f},
-std::array<float,2>{0.436950266f, 0.71141988f},
-std::array<float,2>{0.695267618f, 0.859042346f},
-std::array<float,2>{0.265622228f, 0.336054802f},
-std::array<float,2>{0.847110033f, 0.223785967f},
-std::array<float,2>{0.121473029f, 0.560513318f},
-std::array<float,2>{0.983746767f, 0.695696592f},
-std::array<float,2>{0.133119345f, 0.0155345732f},
-std::array<float,2>{0.598399758f, 0.377209306f},
-std::array<float,2>{0.38869217f, 0.945448041f},
-std::array<float,2>{0.55422473f, 0.580502808f},
-std::array<float,2>{0.476855785f, 0.13569954f},
-std::array<float,2>{0.891019106f, 0.291280031f},
-std::array<float,2>{0.221349806f, 0.752366602f},
-std::array<float,2>{0.796546698f, 0.885261238f},
-std::array<float,2>{0.0504411757f, 0.472506016f},
-std::array<float,2>{0.683452964f, 0.0809622556f},
-std::array<float,2>{0.32585609f, 0.66348958f},
-std::array<float,2>{0.564975262f, 0.984752059f},
-std::array<float,2>{0.413557142f, 0.43465215f},
-std::array<float,2>{0.962403715f, 0.0329578444f},
-std::array<float,2>{0.165450275f, 0.732139468f},
-std::array<float,2>{0.812908411f, 0.501750648f},
-std::array<float,2>{0.0894592777f, 0.214669764f},
-std::array<float,2>{0.738740802f, 0.36826396f},
-std::array<float,2>{0.291205615f, 0.820385039f},
-std::array<float,2>{0.637151718f, 0.639884353f},
-std::array<float,2>{0.37414974f, 0.117108345f},
-std::array<float,2>{0.755907118f, 0.437941045f},
-std::array<float,2>{0.0140540143f, 0.926115751f},
-std::array<float,2>{0.927829027f, 0.791437089f},
-std::array<float,2>{0.196360394f, 0.261322081f},
-std::array<float,2>{0.512600183f, 0.167632699f},
-std::array<float,2>{0.438883483f, 0.602954507f},
-std::array<float,2>{0.748516738f, 0.94231236f},
-std::array<float,2>{0.287047386f, 0.383106589f},
-std::array<float,2>{0.820562959f, 0.000128079031f},
-std::array<float,2>{0.0801218152f, 0.692016244f},
-std::array<float,2>{0.959576368f, 0.552730978f},
-std::array<float,2>{0.156256869f, 0.226662636f},
-std::array<float,2>{0.574716687f, 0.33591938f},
-std::array<float,2>{0.42166546f, 0.851439714f},
-std::array<float,2>{0.501896143f, 0.667100728f},
-std::array<float,2>{0.44695434f, 0.0895952061f},
-std::array<float,2>{0.934638858f, 0.479929298f},
-std::array<float,2>{0.194429308f, 0.875005543f},
-std::array<float,2>{0.758533537f, 0.762469888f},
-std::array<float,2>{0.00474338559f, 0.286052585f},
-std::array<float,2>{0.629983544f, 0.125732496f},
-std::array<float,2>{0.363819122f, 0.588790119f},
-std::array<float,2>{0.607535064f, 0.820134997f},
-std::array<float,2>{0.381867915f, 0.360955238f},
-std::array<float,2>{0.969145894f, 0.204931021f},
-std::array<float,2>{0.127188802f, 0.509753227f},
-std::array<float,2>{0.854260743f, 0.724308908f},
-std::array<float,2>{0.11272759f, 0.0408539921f},
-std::array<float,2>{0.696676612f, 0.421982378f},
-std::array<float,2>{0.253650874f, 0.993488133f},
-std::array<float,2>{0.678024828f, 0.598157287f},
-std::array<float,2>{0.31593585f, 0.157937586f},
-std::array<float,2>{0.782960415f, 0.25176695f},
-std::array<float,2>{0.0618496388f, 0.785089731f},
-std::array<float,2>{0.898731709f, 0.934348404f},
-std::array<float,2>{0.233818263f, 0.450857311f},
-std::array<float,2>{0.558241129f, 0.123413093f},
-std::array<float,2>{0.47289747f, 0.626549661f},
-std::array<float,2>{0.65388906f, 0.809672058f},
-std::array<float,2>{0.347465545f, 0.274698198f},
-std::array<float,2>{0.768834233f, 0.174295649f},
-std::array<float,2>{0.0262281112f, 0.60952878f},
-std::array<float,2>{0.919491231f, 0.649032593f},
-std::array<float,2>{0.213574067f, 0.103020556f},
-std::array<float,2>{0.521452606f, 0.461052567f},
-std::array<float,2>{0.460320324f, 0.920293689f},
-std::array<float,2>{0.591466248f, 0.515861571f},
-std::array<float,2>{0.428674996f, 0.197645187f},
-std::array<float,2>{0.941328406f, 0.349792898f},
-std::array<float,2>{0.179325953f, 0.829457939f},
-std::array<float,2>{0.840192974f, 0.974115014f},
-std::array<float,2>{0.0646764711f, 0.419446409f},
-std::array<float,2>{0.732209384f, 0.0572898164f},
-std::array<float,2>{0.298204452f, 0.737222314f},
-std::array<float,2>{0.536697686f, 0.900167227f},
-std::array<float,2>{0.498140842f, 0.495360434f},
-std::array<float,2>{0.877200902f, 0.0748492256f},
-std::array<float,2>{0.240685195f, 0.683203816f},
-std::array<float,2>{0.807345212f, 0.566839695f},
-std::array<float,2>{0.0465395264f, 0.150145262f},
-std::array<float,2>{0.669404566f, 0.303582698f},
-std::array<float,2>{0.332100987f, 0.773962617f},
-std::array<float,2>{0.70855093f, 0.710711598f},
-std::array<float,2>{0.268645346f, 0.0266279764f},
-std::array<float,2>{0.865198791f, 0.393006921f},
-std::array<float,2>{0.0947434083f, 0.957295716f},
-std::array<float,2>{0.996933937f, 0.864471197f},
-std::array<float,2>{0.141335815f, 0.32470566f},
-std::array<float,2>{0.613699615f, 0.24909319f},
-std::array<float,2>{0.405373156f, 0.541900516f},
-std::array<float,2>{0.626521647f, 0.979935408f},
-std::array<float,2>{0.359868497f, 0.411118507f},
-std::array<float,2>{0.76197356f, 0.0519290045f},
-std::array<float,2>{0.000729654683f, 0.743389249f},
-std::array<float,2>{0.93157506f, 0.524375558f},
-std::array<float,2>{0.191118196f, 0.19173713f},
-std::array<float,2>{0.505351722f, 0.359265864f},
-std::array<float,2>{0.452380836f, 0.838810742f},
-std::array<float,2>{0.572710633f, 0.642866611f},
-std::array<float,2>{0.417496324f, 0.0976975635f},
-std::array<float,2>{0.955781698f, 0.460558563f},
-std::array<float,2>{0.163030848f, 0.909927487f},
-std::array<float,2>{0.82784307f, 0.797041893f},
-std::array<float,2>{0.0835313275f, 0.26835227f},
-std::array<float,2>{0.743427098f, 0.183772206f},
-std::array<float,2>{0.28180778f, 0.623530328f},
-std::array<float,2>{0.560993493f, 0.87411207f},
-std::array<float,2>{0.470827103f, 0.320006967f},
-std::array<float,2>{0.903803527f, 0.238925427f},
-std::array<float,2>{0.22739391f, 0.532873511f},
-std::array<float,2>{0.78772825f, 0.715723097f},
-std::array<float,2>{0.0579040349f, 0.0193931852f},
-std::array<float,2>{0.672092974f, 0.401632458f},
-std::array<float,2>{0.317354947f, 0.963876426f},
-std::array<float,2>{0.699741721f, 0.573025465f},
-std::array<float,2>{0.257772386f, 0.147588611f},
-std::array<float,2>{0.858038247f, 0.305249691f},
-std::array<float,2>{0.115083568f, 0.765655398f},
-std::array<float,2>{0.974894524f, 0.892502487f},
-std::array<float,2>{0.130727217f, 0.487726986f},
-std::array<float,2>{0.604349613f, 0.0671012178f},
-std::array<float,2>{0.378575683f, 0.672146499f},
-std::array<float,2>{0.729275227f, 0.754143894f},
-std::array<float,2>{0.302624732f, 0.296086103f},
-std::array<float,2>{0.8381778f, 0.138221383f},
-std::array<float,2>{0.0679821f, 0.585542321f},
-std::array<float,2>{0.943948567f, 0.658846259f},
-std::array<float,2>{0.1746144f, 0.0828052983f},
-std::array<float,2>{0.586570859f, 0.475637764f},
-std::array<float,2>{0.425207704f, 0.888871789f},
-std::array<float,2>{0.51930809f, 0.55611968f},
-std::array<float,2>{0.456864059f, 0.219870031f},
-std::array<float,2>{0.914846659f, 0.340327352f},
-std::array<float,2>{0.216637671f, 0.852351308f},
-std::array<float,2>{0.771473646f, 0.952556074f},
-std::array<float,2>{0.0301622525f, 0.380000472f},
-std::array<float,2>{0.651907325f, 0.0107898908f},
-std::array<float,2>{0.350850105f, 0.701422334f},
-std::array<float,2>{0.611664593f, 0.922073424f},
-std::array<float,2>{0.401450485f, 0.444268703f},
-std::array<float,2>{0.993739247f, 0.1123202f},
-std::array<float,2>{0.14824903f, 0.633722425f},
-std::array<float,2>{0.860180318f, 0.60551995f},
-std::array<float,2>{0.101344988f, 0.171167478f},
-std::array<float,2>{0.705537438f, 0.265122801f},
-std::array<float,2>{0.271535069f, 0.796046138f},
-std::array<float,2>{0.667816639f, 0.727899432f},
-std::array<float,2>{0.329301894f, 0.0359557234f},
-std::array<float,2>{0.80986166f, 0.4304353f},
-std::array<float,2>{0.0412106737f, 0.991789341f},
-std::array<float,2>{0.878947914f, 0.826099575f},
-std::array<float,2>{0.235421181f, 0.374412805f},
-std::array<float,2>{0.533295631f, 0.215238199f},
-std::array<float,2>{0.495671391f, 0.50634867f},
-std::array<float,2>{0.715649605f, 0.879067719f},
-std::array<float,2>{0.278969347f, 0.482603222f},
-std::array<float,2>{0.873696566f, 0.0922669098f},
-std::array<float,2>{0.105439343f, 0.668118954f},
-std::array<float,2>{0.990442097f, 0.589981437f},
-std::array<float,2>{0.150670275f, 0.130806357f},
-std::array<float,2>{0.619043946f, 0.282057196f},
-std::array<float,2>{0.390796632f, 0.758895218f},
-std::array<float,2>{0.542718649f, 0.688159347f},
-std::array<float,2>{0.485391796f, 0.00671051955f},
-std::array<float,2>{0.886527061f, 0.388372064f},
-std::array<float,2>{0.243339345f, 0.940175414f},
-std::array<float,2>{0.800216615f, 0.846942008f},
-std::array<float,2>{0.0326454565f, 0.329842508f},
-std::array<float,2>{0.657679796f, 0.230887681f},
-std::array<float,2>{0.340094596f, 0.550706089f},
-std::array<float,2>{0.579292119f, 0.786525965f},
-std::array<float,2>{0.431646556f, 0.255659431f},
-std::array<float,2>{0.952652931f, 0.162386358f},
-std::array<float,2>{0.18446517f, 0.59534055f},
-std::array<float,2>{0.833189666f, 0.632524967f},
-std::array<float,2>{0.0729820132f, 0.119642444f},
-std::array<float,2>{0.725338042f, 0.447835803f},
-std::array<float,2>{0.306702971f, 0.932397306f},
-std::array<float,2>{0.642685711f, 0.514782369f},
-std::array<float,2>{0.354541451f, 0.207576916f},
-std::array<float,2>{0.778145373f, 0.365495265f},
-std::array<float,2>{0.0212436803f, 0.813057065f},
-std::array<float,2>{0.909329355f, 0.999967217f},
-std::array<float,2>{0.209749863f, 0.429349869f},
-std::array<float,2>{0.530781448f, 0.0468577258f},
-std::array<float,2>{0.465431213f, 0.719819725f},
-std::array<float,2>{0.687252164f, 0.835582733f},
-std::array<float,2>{0.323364794f, 0.344528615f},
-std::array<float,2>{0.789789438f, 0.200733542f},
-std::array<float,2>{0.0537137352f, 0.520358741f},
-std::array<float,2>{0.897587299f, 0.739959121f},
-std::array<float,2>{0.222828254f, 0.0595578551f},
-std::array<float,2>{0.549969435f, 0.414903849f},
-std::array<float,2>{0.482898295f, 0.970311224f},
-std::array<float,2>{0.593778789f, 0.613329351f},
-std::array<float,2>{0.385719091f, 0.177269623f},
-std::array<float,2>{0.979452968f, 0.280485421f},
-std::array<float,2>{0.138356775f, 0.807696521f},
-std::array<float,2>{0.847779691f, 0.914704084f},
-std::array<float,2>{0.118780524f, 0.465743214f},
-std::array<float,2>{0.69010812f, 0.10591761f},
-std::array<float,2>{0.25959903f, 0.652718961f},
-std::array<float,2>{0.511499405f, 0.953822792f},
-std::array<float,2>{0.444697082f, 0.397464544f},
-std::array<float,2>{0.922611415f, 0.0305334646f},
-std::array<float,2>{0.199773282f, 0.703825116f},
-std::array<float,2>{0.752240837f, 0.544824541f},
-std::array<float,2>{0.0100142118f, 0.245130017f},
-std::array<float,2>{0.635909498f, 0.321001947f},
-std::array<float,2>{0.368599743f, 0.860921025f},
-std::array<float,2>{0.736737728f, 0.683892429f},
-std::array<float,2>{0.294204354f, 0.0713149235f},
-std::array<float,2>{0.818062127f, 0.498391777f},
-std::array<float,2>{0.0925109237f, 0.905869007f},
-std::array<float,2>{0.965388656f, 0.781068563f},
-std::array<float,2>{0.169197351f, 0.300549626f},
-std::array<float,2>{0.569821f, 0.154020652f},
-std::array<float,2>{0.408732504f, 0.562728941f},
-std::array<float,2>{0.644727111f, 0.897145092f},
-std::array<float,2>{0.358692229f, 0.490127623f},
-std::array<float,2>{0.773734629f, 0.0642833859f},
-std::array<float,2>{0.015628349f, 0.678015232f},
-std::array<float,2>{0.91024363f, 0.575518131f},
-std::array<float,2>{0.204193577f, 0.143134296f},
-std::array<float,2>{0.527230322f, 0.308808535f},
-std::array<float,2>{0.46424675f, 0.773091555f},
-std::array<float,2>{0.582152188f, 0.714297473f},
-std::array<float,2>{0.433725744f, 0.0215112194f},
-std::array<float,2>{0.948461235f, 0.403532118f},
-std::array<float,2>{0.182044372f, 0.965940058f},
-std::array<float,2>{0.831219137f, 0.869523525f},
-std::array<float,2>{0.0749721602f, 0.31614387f},
-std::array<float,2>{0.722353339f, 0.238238692f},
-std::array<float,2>{0.311056137f, 0.537164569f},
-std::array<float,2>{0.545108974f, 0.801628828f},
-std::array<float,2>{0.490340739f, 0.269604027f},
-std::array<float,2>{0.889563203f, 0.182690665f},
-std::array<float,2>{0.247803897f, 0.618916094f},
-std::array<float,2>{0.802675009f, 0.647916377f},
-std::array<float,2>{0.0377082266f, 0.0939316154f},
-std::array<float,2>{0.662786603f, 0.454865456f},
-std::array<float,2>{0.336106867f, 0.912324607f},
-std::array<float,2>{0.714580417f, 0.529970288f},
-std::array<float,2>{0.273967087f, 0.188635424f},
-std::array<float,2>{0.868186891f, 0.351924866f},
-std::array<float,2>{0.106184691f, 0.839901984f},
-std::array<float,2>{0.985126436f, 0.982240677f},
-std::array<float,2>{0.155698135f, 0.409955263f},
-std::array<float,2>{0.624846995f, 0.0479932912f},
-std::array<float,2>{0.396466643f, 0.746755362f},
-std::array<float,2>{0.7417624f, 0.823901057f},
-std::array<float,2>{0.289838761f, 0.369791389f},
-std::array<float,2>{0.815077305f, 0.212820217f},
-std::array<float,2>{0.0876503736f, 0.503506243f},
-std::array<float,2>{0.963248014f, 0.733969271f},
-std::array<float,2>{0.166556299f, 0.0336685367f},
-std::array<float,2>{0.564061701f, 0.437212497f},
-std::array<float,2>{0.411242664f, 0.987071097f},
-std::array<float,2>{0.514869392f, 0.604771733f},
-std::array<float,2>{0.440164417f, 0.164940476f},
-std::array<float,2>{0.926826f, 0.259719104f},
-std::array<float,2>{0.1987748f, 0.789672673f},
-std::array<float,2>{0.75438267f, 0.927974522f},
-std::array<float,2>{0.0120014977f, 0.440549701f},
-std::array<float,2>{0.640391588f, 0.113426842f},
-std::array<float,2>{0.372354507f, 0.637131751f},
-std::array<float,2>{0.599850535f, 0.948539138f},
-std::array<float,2>{0.387642622f, 0.376425683f},
-std::array<float,2>{0.982169509f, 0.011867309f},
-std::array<float,2>{0.136288643f, 0.697945118f},
-std::array<float,2>{0.845047772f, 0.561058223f},
-std::array<float,2>{0.124476172f, 0.225533277f},
-std::array<float,2>{0.692846715f, 0.339351177f},
-std::array<float,2>{0.262254268f, 0.857290387f},
-std::array<float,2>{0.681260109f, 0.661754489f},
-std::array<float,2>{0.326774001f, 0.0792214051f},
-std::array<float,2>{0.794091821f, 0.47005704f},
-std::array<float,2>{0.047493659f, 0.88361752f},
-std::array<float,2>{0.892838478f, 0.75183326f},
-std::array<float,2>{0.219565228f, 0.289616883f},
-std::array<float,2>{0.551908195f, 0.133725181f},
-std::array<float,2>{0.479430169f, 0.579771578f},
-std::array<float,2>{0.698943257f, 0.994962275f},
-std::array<float,2>{0.251854837f, 0.424322128f},
-std::array<float,2>{0.852711439f, 0.0413604192f},
-std::array<float,2>{0.110555299f, 0.726013064f},
-std::array<float,2>{0.972076356f, 0.511092961f},
-std::array<float,2>{0.125043318f, 0.205099821f},
-std::array<float,2>{0.60728097f, 0.362081707f},
-std::array<float,2>{0.3800731f, 0.817273796f},
-std::array<float,2>{0.556540132f, 0.627728045f},
-std::array<float,2>{0.475572199f, 0.122493133f},
-std::array<float,2>{0.90209657f, 0.45129317f},
-std::array<float,2>{0.23239629f, 0.936035872f},
-std::array<float,2>{0.78364259f, 0.782752812f},
-std::array<float,2>{0.0599704534f, 0.252488941f},
-std::array<float,2>{0.677719414f, 0.159082517f},
-std::array<float,2>{0.312833458f, 0.601326644f},
-std::array<float,2>{0.577031493f, 0.848760188f},
-std::array<float,2>{0.419454992f, 0.33301869f},
-std::array<float,2>{0.957708776f, 0.228923753f},
-std::array<float,2>{0.159363329f, 0.553385794f},
-std::array<float,2>{0.822908461f, 0.694480836f},
-std::array<float,2>{0.0791969374f, 0.00322215655f},
-std::array<float,2>{0.747760594f, 0.386419594f},
-std::array<float,2>{0.288283885f, 0.944049895f},
-std::array<float,2>{0.631079793f, 0.586655021f},
-std::array<float,2>{0.366300374f, 0.128882125f},
-std::array<float,2>{0.761464536f, 0.288664252f},
-std::array<float,2>{0.00671061175f, 0.764622927f},
-std::array<float,2>{0.935864151f, 0.877289951f},
-std::array<float,2>{0.193083316f, 0.477969468f},
-std::array<float,2>{0.502538085f, 0.0870795175f},
-std::array<float,2>{0.447802097f, 0.664264083f},
-std::array<float,2>{0.670337498f, 0.776950479f},
-std::array<float,2>{0.335104614f, 0.301919907f},
-std::array<float,2>{0.806563258f, 0.150605634f},
-std::array<float,2>{0.043280948f, 0.56932795f},
-std::array<float,2>{0.876191616f, 0.681379497f},
-std::array<float,2>{0.239968553f, 0.0772834197f},
-std::array<float,2>{0.538291335f, 0.493186444f},
-std::array<float,2>{0.496569157f, 0.901213884f},
-std::array<float,2>{0.616710782f, 0.539217591f},
-std::array<float,2>{0.403469235f, 0.246193752f},
-std::array<float,2>{0.998114467f, 0.327680826f},
-std::array<float,2>{0.14439261f, 0.865792692f},
-std::array<float,2>{0.865641952f, 0.959756017f},
-std::array<float,2>{0.0974788219f, 0.391583264f},
-std::array<float,2>{0.710364282f, 0.0251434483f},
-std::array<float,2>{0.266282141f, 0.707406402f},
-std::array<float,2>{0.522006094f, 0.919124961f},
-std::array<float,2>{0.458935678f, 0.464023501f},
-std::array<float,2>{0.921529055f, 0.105078176f},
-std::array<float,2>{0.21164158f, 0.650649846f},
-std::array<float,2>{0.76693511f, 0.611417651f},
-std::array<float,2>{0.0247134864f, 0.173799336f},
-std::array<float,2>{0.655952632f, 0.276547194f},
-std::array<float,2>{0.345144123f, 0.811192393f},
-std::array<float,2>{0.732768118f, 0.736101568f},
-std::array<float,2>{0.300064921f, 0.0548162758f},
-std::array<float,2>{0.8420946f, 0.420826882f},
-std::array<float,2>{0.0640582591f, 0.974870324f},
-std::array<float,2>{0.939098358f, 0.831815183f},
-std::array<float,2>{0.176333964f, 0.348490328f},
-std::array<float,2>{0.591966808f, 0.19619976f},
-std::array<float,2>{0.427540392f, 0.518663049f},
-std::array<float,2>{0.674053729f, 0.962314665f},
-std::array<float,2>{0.320204496f, 0.400325418f},
-std::array<float,2>{0.785320461f, 0.016603291f},
-std::array<float,2>{0.0556667037f, 0.718255162f},
-std::array<float,2>{0.905145943f, 0.533773065f},
-std::array<float,2>{0.228942171f, 0.242072389f},
-std::array<float,2>{0.560189724f, 0.317626476f},
-std::array<float,2>{0.469783902f, 0.871487856f},
-std::array<float,2>{0.601839781f, 0.674114585f},
-std::array<float,2>{0.375038058f, 0.0696589649f},
-std::array<float,2>{0.973344505f, 0.485524446f},
-std::array<float,2>{0.132181838f, 0.892798483f},
-std::array<float,2>{0.85602504f, 0.768116176f},
-std::array<float,2>{0.116282925f, 0.308350891f},
-std::array<float,2>{0.701203048f, 0.146428719f},
-std::array<float,2>{0.255210489f, 0.571693003f},
-std::array<float,2>{0.506479681f, 0.83617115f},
-std::array<float,2>{0.450117469f, 0.355764806f},
-std::array<float,2>{0.932723582f, 0.193895653f},
-std::array<float,2>{0.188070104f, 0.52612865f},
-std::array<float,2>{0.763809264f, 0.745702386f},
-std::array<float,2>{0.00261786603f, 0.053039182f},
-std::array<float,2>{0.628757238f, 0.412735611f},
-std::array<float,2>{0.363185376f, 0.978010595f},
-std::array<float,2>{0.744725108f, 0.62210989f},
-std::array<float,2>{0.284813911f, 0.187346831f},
-std::array<float,2>{0.826119304f, 0.267515212f},
-std::array<float,2>{0.0849227682f, 0.799103975f},
-std::array<float,2>{0.953361094f, 0.907986641f},
-std::array<float,2>{0.160818592f, 0.458449036f},
-std::array<float,2>{0.572183132f, 0.100461803f},
-std::array<float,2>{0.414097637f, 0.6412341f},
-std::array<float,2>{0.703877628f, 0.793410897f},
-std::array<float,2>{0.271172255f, 0.263216287f},
-std::array<float,2>{0.863019764f, 0.168756038f},
-std::array<float,2>{0.0986721218f, 0.608001351f},
-std::array<float,2>{0.994371951f, 0.63575691f},
-std::array<float,2>{0.145474881f, 0.109927528f},
-std::array<float,2>{0.609626889f, 0.44181636f},
-std::array<float,2>{0.398982078f, 0.925185442f},
-std::array<float,2>{0.533044517f, 0.504152298f},
-std::array<float,2>{0.492717206f, 0.218290374f},
-std::array<float,2>{0.88256675f, 0.372796863f},
-std::array<float,2>{0.236866355f, 0.827639639f},
-std::array<float,2>{0.810652316f, 0.989676893f},
-std::array<float,2>{0.0398656689f, 0.43272832f},
-std::array<float,2>{0.665066421f, 0.0387925394f},
-std::array<float,2>{0.330270052f, 0.728961945f},
-std::array<float,2>{0.589663625f, 0.888207257f},
-std::array<float,2>{0.423322976f, 0.473742783f},
-std::array<float,2>{0.942320228f, 0.0850260854f},
-std::array<float,2>{0.172635272f, 0.656383097f},
-std::array<float,2>{0.837229073f, 0.583030641f},
-std::array<float,2>{0.069513455f, 0.140083209f},
-std::array<float,2>{0.727005243f, 0.294513255f},
-std::array<float,2>{0.30392772f, 0.755981088f},
-std::array<float,2>{0.649656534f, 0.699324787f},
-std::array<float,2>{0.347686291f, 0.0091288127f},
-std::array<float,2>{0.772651732f, 0.382586002f},
-std::array<float,2>{0.0292283744f, 0.949860215f},
-std::array<float,2>{0.917829096f, 0.854585171f},
-std::array<float,2>{0.217041314f, 0.342947602f},
-std::array<float,2>{0.517559171f, 0.220734268f},
-std::array<float,2>{0.454122961f, 0.558323741f},
-std::array<float,2>{0.722835958f, 0.930635691f},
-std::array<float,2>{0.304995686f, 0.445832461f},
-std::array<float,2>{0.835151136f, 0.117354251f},
-std::array<float,2>{0.0716318712f, 0.629633904f},
-std::array<float,2>{0.949469626f, 0.596432626f},
-std::array<float,2>{0.187039658f, 0.160483301f},
-std::array<float,2>{0.580606401f, 0.257143348f},
-std::array<float,2>{0.42986998f, 0.787183285f},
-std::array<float,2>{0.527723193f, 0.721767843f},
-std::array<float,2>{0.467596501f, 0.0439986996f},
-std::array<float,2>{0.907635868f, 0.426536113f},
-std::array<float,2>{0.208139509f, 0.997340202f},
-std::array<float,2>{0.780857801f, 0.814774454f},
-std::array<float,2>{0.0220144186f, 0.363575339f},
-std::array<float,2>{0.641785085f, 0.209584728f},
-std::array<float,2>{0.351851732f, 0.513610065f},
-std::array<float,2>{0.620049953f, 0.760998785f},
-std::array<float,2>{0.394427896f, 0.283931911f},
-std::array<float,2>{0.989757538f, 0.132571429f},
-std::array<float,2>{0.149908274f, 0.593043089f},
-std::array<float,2>{0.87166208f, 0.671317101f},
-std::array<float,2>{0.102479912f, 0.0913178846f},
-std::array<float,2>{0.718717456f, 0.480853051f},
-std::array<float,2>{0.279482186f, 0.882640719f},
-std::array<float,2>{0.658982873f, 0.547302067f},
-std::array<float,2>{0.342645407f, 0.23436676f},
-std::array<float,2>{0.798496485f, 0.331798315f},
-std::array<float,2>{0.0350508578f, 0.844639301f},
-std::array<float,2>{0.883497179f, 0.938503206f},
-std::array<float,2>{0.244285658f, 0.389791608f},
-std::array<float,2>{0.539564073f, 0.00467265537f},
-std::array<float,2>{0.487415969f, 0.690446198f},
-std::array<float,2>{0.634131789f, 0.863022804f},
-std::array<float,2>{0.370134026f, 0.322632313f},
-std::array<float,2>{0.750628412f, 0.243259206f},
-std::array<float,2>{0.00859969947f, 0.545045674f},
-std::array<float,2>{0.924019039f, 0.705114007f},
-std::array<float,2>{0.202309594f, 0.028453853f},
-std::array<float,2>{0.509349108f, 0.394774973f},
-std::array<float,2>{0.442657351f, 0.956106663f},
-std::array<float,2>{0.566482365f, 0.56626302f},
-std::array<float,2>{0.407151788f, 0.155144453f},
-std::array<float,2>{0.968655884f, 0.29748711f},
-std::array<float,2>{0.16999869f, 0.777932286f},
-std::array<float,2>{0.818810642f, 0.902592123f},
-std::array<float,2>{0.0914630219f, 0.496117711f},
-std::array<float,2>{0.735879302f, 0.0737932995f},
-std::array<float,2>{0.296543956f, 0.686592042f},
-std::array<float,2>{0.548311949f, 0.971434414f},
-std::array<float,2>{0.482403845f, 0.417180151f},
-std::array<float,2>{0.895233452f, 0.0607639104f},
-std::array<float,2>{0.224967018f, 0.741222858f},
-std::array<float,2>{0.791877687f, 0.522001386f},
-std::array<float,2>{0.0526759885f, 0.202518418f},
-std::array<float,2>{0.685098588f, 0.347466797f},
-std::array<float,2>{0.320424229f, 0.832318127f},
-std::array<float,2>{0.687744558f, 0.654407263f},
-std::array<float,2>{0.261716127f, 0.107713014f},
-std::array<float,2>{0.850241661f, 0.468088776f},
-std::array<float,2>{0.120335981f, 0.91635561f},
-std::array<float,2>{0.977652431f, 0.805041313f},
-std::array<float,2>{0.139728248f, 0.277462333f},
-std::array<float,2>{0.595923245f, 0.177803978f},
-std::array<float,2>{0.383209974f, 0.615373611f},
-std::array<float,2>{0.669742405f, 0.900808156f},
-std::array<float,2>{0.332655013f, 0.494120568f},
-std::array<float,2>{0.80673182f, 0.0777351484f},
-std::array<float,2>{0.0459665805f, 0.680695295f},
-std::array<float,2>{0.877695918f, 0.568813741f},
-std::array<float,2>{0.241033703f, 0.150985628f},
-std::array<float,2>{0.536203742f, 0.302641571f},
-std::array<float,2>{0.498940587f, 0.776515782f},
-std::array<float,2>{0.613903046f, 0.707574308f},
-std::array<float,2>{0.405876815f, 0.0247946475f},
-std::array<float,2>{0.99648869f, 0.390994817f},
-std::array<float,2>{0.140822187f, 0.959281504f},
-std::array<float,2>{0.864520609f, 0.865715802f},
-std::array<float,2>{0.0953814536f, 0.327544957f},
-std::array<float,2>{0.708385885f, 0.246956661f},
-std::array<float,2>{0.269170016f, 0.539697528f},
-std::array<float,2>{0.520980775f, 0.81072557f},
-std::array<float,2>{0.460520893f, 0.277094513f},
-std::array<float,2>{0.919035614f, 0.173044324f},
-std::array<float,2>{0.212941334f, 0.612132192f},
-std::array<float,2>{0.76943469f, 0.650894403f},
-std::array<float,2>{0.0253999718f, 0.104894444f},
-std::array<float,2>{0.653472662f, 0.464618236f},
-std::array<float,2>{0.347067326f, 0.919479847f},
-std::array<float,2>{0.731859803f, 0.519419014f},
-std::array<float,2>{0.298657209f, 0.195434019f},
-std::array<float,2>{0.840729952f, 0.347829968f},
-std::array<float,2>{0.0652269199f, 0.831098735f},
-std::array<float,2>{0.940915585f, 0.975203514f},
-std::array<float,2>{0.179101616f, 0.420224041f},
-std::array<float,2>{0.591164589f, 0.055364076f},
-std::array<float,2>{0.428023696f, 0.735828698f},
-std::array<float,2>{0.697095692f, 0.816757739f},
-std::array<float,2>{0.253223956f, 0.361521184f},
-std::array<float,2>{0.854002774f, 0.205904126f},
-std::array<float,2>{0.112969048f, 0.511622667f},
-std::array<float,2>{0.969677866f, 0.726300359f},
-std::array<float,2>{0.127526909f, 0.0416691862f},
-std::array<float,2>{0.608258486f, 0.42386806f},
-std::array<float,2>{0.382512182f, 0.994436383f},
-std::array<float,2>{0.557846189f, 0.600721538f},
-std::array<float,2>{0.473579049f, 0.158369884f},
-std::array<float,2>{0.899219513f, 0.252035439f},
-std::array<float,2>{0.234068468f, 0.782325685f},
-std::array<float,2>{0.782609701f, 0.935649216f},
-std::array<float,2>{0.0622905344f, 0.45214805f},
-std::array<float,2>{0.678581715f, 0.122695304f},
-std::array<float,2>{0.315912604f, 0.627355874f},
-std::array<float,2>{0.574370682f, 0.943690598f},
-std::array<float,2>{0.421212196f, 0.386082381f},
-std::array<float,2>{0.958992779f, 0.0036464252f},
-std::array<float,2>{0.157012567f, 0.695011973f},
-std::array<float,2>{0.821162105f, 0.552922487f},
-std::array<float,2>{0.0807683617f, 0.229005814f},
-std::array<float,2>{0.748771191f, 0.333779633f},
-std::array<float,2>{0.286134541f, 0.849465489f},
-std::array<float,2>{0.630488992f, 0.664627612f},
-std::array<float,2>{0.363741666f, 0.0878299475f},
-std::array<float,2>{0.758283615f, 0.478490531f},
-std::array<float,2>{0.00413839426f, 0.877460301f},
-std::array<float,2>{0.935149014f, 0.763791144f},
-std::array<float,2>{0.194985256f, 0.288191259f},
-std::array<float,2>{0.501228631f, 0.12794368f},
-std::array<float,2>{0.446752638f, 0.586344123f},
-std::array<float,2>{0.739122093f, 0.986616611f},
-std::array<float,2>{0.291982681f, 0.436560094f},
-std::array<float,2>{0.813447118f, 0.0337918326f},
-std::array<float,2>{0.0890600756f, 0.733423233f},
-std::array<float,2>{0.962166548f, 0.503267646f},
-std::array<float,2>{0.165639162f, 0.21192272f},
-std::array<float,2>{0.564575255f, 0.369415253f},
-std::array<float,2>{0.413632482f, 0.823647439f},
-std::array<float,2>{0.512111843f, 0.637583435f},
-std::array<float,2>{0.439367861f, 0.114200257f},
-std::array<float,2>{0.928661942f, 0.441271663f},
-std::array<float,2>{0.196793541f, 0.92825073f},
-std::array<float,2>{0.756579936f, 0.78924191f},
-std::array<float,2>{0.0145504745f, 0.258927822f},
-std::array<float,2>{0.63724345f, 0.164490566f},
-std::array<float,2>{0.374797106f, 0.60501641f},
-std::array<float,2>{0.597703636f, 0.85646224f},
-std::array<float,2>{0.38960743f, 0.339517355f},
-std::array<float,2>{0.984370887f, 0.224991471f},
-std::array<float,2>{0.133383691f, 0.560756683f},
-std::array<float,2>{0.847573638f, 0.697612166f},
-std::array<float,2>{0.121927805f, 0.0122750802f},
-std::array<float,2>{0.694512367f, 0.376898497f},
-std::array<float,2>{0.265111417f, 0.94887042f},
-std::array<float,2>{0.682646573f, 0.579427123f},
-std::array<float,2>{0.325403333f, 0.1328132f},
-std::array<float,2>{0.796167493f, 0.289113313f},
-std::array<float,2>{0.0500237681f, 0.750977397f},
-std::array<float,2>{0.89155513f, 0.882875204f},
-std::array<float,2>{0.220785037f, 0.470568955f},
-std::array<float,2>{0.554112613f, 0.0797442794f},
-std::array<float,2>{0.477318376f, 0.661466837f},
-std::array<float,2>{0.647066116f, 0.772947133f},
-std::array<float,2>{0.355843544f, 0.309202522f},
-std::array<float,2>{0.777324438f, 0.142734215f},
-std::array<float,2>{0.0176711958f, 0.575979054f},
-std::array<float,2>{0.913120031f, 0.67844373f},
-std::array<float,2>{0.206313059f, 0.0637852103f},
-std::array<float,2>{0.524480999f, 0.489718288f},
-std::array<float,2>{0.46111834f, 0.896971881f},
-std::array<float,2>{0.584884167f, 0.537975132f},
-std::array<float,2>{0.437091738f, 0.23757565f},
-std::array<float,2>{0.945971906f, 0.315731496f},
-std::array<float,2>{0.181078807f, 0.870028496f},
-std::array<float,2>{0.828356743f, 0.966773152f},
-std::array<float,2>{0.0777522624f, 0.404205561f},
-std::array<float,2>{0.719316006f, 0.0223794561f},
-std::array<float,2>{0.310261607f, 0.714450359f},
-std::array<float,2>{0.543300748f, 0.91299367f},
-std::array<float,2>{0.489541799f, 0.454249114f},
-std::array<float,2>{0.88706547f, 0.0943958238f},
-std::array<float,2>{0.249672651f, 0.648425341f},
-std::array<float,2>{0.804458141f, 0.61845094f},
-std::array<float,2>{0.0353312604f, 0.183506906f},
-std::array<float,2>{0.661246359f, 0.270314485f},
-std::array<float,2>{0.338163614f, 0.801076889f},
-std::array<float,2>{0.711001992f, 0.746510029f},
-std::array<float,2>{0.276842326f, 0.0483469814f},
-std::array<float,2>{0.87059319f, 0.409570992f},
-std::array<float,2>{0.108164154f, 0.981679738f},
-std::array<float,2>{0.987938523f, 0.840747714f},
-std::array<float,2>{0.153582409f, 0.352127314f},
-std::array<float,2>{0.621608555f, 0.189327478f},
-std::array<float,2>{0.398332149f, 0.529666066f},
-std::array<float,2>{0.636466205f, 0.956919074f},
-std::array<float,2>{0.369087368f, 0.395043403f},
-std::array<float,2>{0.752827227f, 0.0289489944f},
-std::array<float,2>{0.0107324878f, 0.706028581f},
-std::array<float,2>{0.922212481f, 0.545601964f},
-std::array<float,2>{0.199453413f, 0.243723676f},
-std::array<float,2>{0.511018753f, 0.322876006f},
-std::array<float,2>{0.444836706f, 0.862314045f},
-std::array<float,2>{0.570217967f, 0.687219083f},
-std::array<float,2>{0.408255756f, 0.0735251382f},
-std::array<float,2>{0.964921534f, 0.496877313f},
-std::array<float,2>{0.169666439f, 0.903146863f},
-std::array<float,2>{0.817554533f, 0.777614832f},
-std::array<float,2>{0.0921293199f, 0.297196954f},
-std::array<float,2>{0.736971259f, 0.154339314f},
-std::array<float,2>{0.294801533f, 0.565860212f},
-std::array<float,2>{0.550524473f, 0.832720101f},
-std::array<float,2>{0.482941866f, 0.346928418f},
-std::array<float,2>{0.898211241f, 0.202821255f},
-std::array<float,2>{0.223321497f, 0.521957815f},
-std::array<float,2>{0.789438486f, 0.741972983f},
-std::array<float,2>{0.0543328077f, 0.0613654144f},
-std::array<float,2>{0.686975479f, 0.417864114f},
-std::array<float,2>{0.324171126f, 0.970894217f},
-std::array<float,2>{0.689494252f, 0.615967155f},
-std::array<float,2>{0.259011328f, 0.178383559f},
-std::array<float,2>{0.848256469f, 0.27818954f},
-std::array<float,2>{0.118546508f, 0.805249035f},
-std::array<float,2>{0.978768528f, 0.916989923f},
-std::array<float,2>{0.137989923f, 0.468348831f},
-std::array<float,2>{0.594425559f, 0.108171694f},
-std::array<float,2>{0.385220826f, 0.655097187f},
-std::array<float,2>{0.724643052f, 0.787930608f},
-std::array<float,2>{0.307408422f, 0.257661253f},
-std::array<float,2>{0.833919227f, 0.160946414f},
-std::array<float,2>{0.0723593608f, 0.596058786f},
-std::array<float,2>{0.952202082f, 0.629131913f},
-std::array<float,2>{0.183783889f, 0.117761098f},
-std::array<float,2>{0.579974413f, 0.445792198f},
-std::array<float,2>{0.432270348f, 0.929825485f},
-std::array<float,2>{0.530598044f, 0.512980998f},
-std::array<float,2>{0.464895397f, 0.209201202f},
-std::array<float,2>{0.909686744f, 0.363841146f},
-std::array<float,2>{0.209320053f, 0.815428078f},
-std::array<float,2>{0.777379811f, 0.997966588f},
-std::array<float,2>{0.0205281563f, 0.425951004f},
-std::array<float,2>{0.643489063f, 0.0444982499f},
-std::array<float,2>{0.355341524f, 0.722251475f},
-std::array<float,2>{0.618286133f, 0.882231414f},
-std::array<float,2>{0.391187221f, 0.481126457f},
-std::array<float,2>{0.990788221f, 0.09105625f},
-std::array<float,2>{0.151284665f, 0.671833515f},
-std::array<float,2>{0.873180687f, 0.593681872f},
-std::array<float,2>{0.104588524f, 0.131913975f},
-std::array<float,2>{0.715059936f, 0.283580005f},
-std::array<float,2>{0.278555363f, 0.761641264f},
-std::array<float,2>{0.657870114f, 0.691330016f},
-std::array<float,2>{0.340386719f, 0.00438016653f},
-std::array<float,2>{0.800745726f, 0.39035213f},
-std::array<float,2>{0.033032693f, 0.93919313f},
-std::array<float,2>{0.885796189f, 0.844123423f},
-std::array<float,2>{0.243718535f, 0.331114292f},
-std::array<float,2>{0.542077661f, 0.23353824f},
-std::array<float,2>{0.485899687f, 0.54749918f},
-std::array<float,2>{0.705953538f, 0.925731122f},
-std::array<float,2>{0.272458911f, 0.442036033f},
-std::array<float,2>{0.859799981f, 0.109403558f},
-std::array<float,2>{0.100868262f, 0.63651067f},
-std::array<float,2>{0.993312776f, 0.607688427f},
-std::array<float,2>{0.147580266f, 0.168217927f},
-std::array<float,2>{0.61212486f, 0.263156056f},
-std::array<float,2>{0.402111948f, 0.793885052f},
-std::array<float,2>{0.534169734f, 0.7290591f},
-std::array<float,2>{0.495544314f, 0.0382923707f},
-std::array<float,2>{0.879697323f, 0.433516115f},
-std::array<float,2>{0.235851616f, 0.990226805f},
-std::array<float,2>{0.810309291f, 0.827453852f},
-std::array<float,2>{0.0416964106f, 0.37217623f},
-std::array<float,2>{0.667318881f, 0.218039051f},
-std::array<float,2>{0.329667389f, 0.504405439f},
-std::array<float,2>{0.58613199f, 0.75665158f},
-std::array<float,2>{0.425387532f, 0.293964356f},
-std::array<float,2>{0.943803787f, 0.140388444f},
-std::array<float,2>{0.174305171f, 0.58359617f},
-std::array<float,2>{0.838409722f, 0.657122314f},
-std::array<float,2>{0.067676492f, 0.0856946707f},
-std::array<float,2>{0.728923321f, 0.474454731f},
-std::array<float,2>{0.301946282f, 0.888053596f},
-std::array<float,2>{0.651454628f, 0.557685137f},
-std::array<float,2>{0.351431668f, 0.221453071f},
-std::array<float,2>{0.770893812f, 0.343392164f},
-std::array<float,2>{0.0295524504f, 0.85538888f},
-std::array<float,2>{0.914209247f, 0.949669302f},
-std::array<float,2>{0.216245055f, 0.382035583f},
-std::array<float,2>{0.518794119f, 0.00941210333f},
-std::array<float,2>{0.456368297f, 0.700147092f},
-std::array<float,2>{0.672439575f, 0.871835411f},
-std::array<float,2>{0.316581517f, 0.318052351f},
-std::array<float,2>{0.787561417f, 0.241437688f},
-std::array<float,2>{0.0585643239f, 0.5333426f},
-std::array<float,2>{0.903972924f, 0.718614221f},
-std::array<float,2>{0.226888105f, 0.0173178501f},
-std::array<float,2>{0.561509788f, 0.399853617f},
-std::array<float,2>{0.471509397f, 0.962871969f},
-std::array<float,2>{0.603644371f, 0.57196027f},
-std::array<float,2>{0.378269464f, 0.145910203f},
-std::array<float,2>{0.9755705f, 0.30780378f},
-std::array<float,2>{0.130312771f, 0.767623842f},
-std::array<float,2>{0.857707083f, 0.893168092f},
-std::array<float,2>{0.114648312f, 0.486061424f},
-std::array<float,2>{0.699300766f, 0.0701704919f},
-std::array<float,2>{0.256931096f, 0.674486935f},
-std::array<float,2>{0.505829155f, 0.978266239f},
-std::array<float,2>{0.452912301f, 0.412461311f},
-std::array<float,2>{0.931096196f, 0.0536815673f},
-std::array<float,2>{0.190690279f, 0.745449126f},
-std::array<float,2>{0.76248014f, 0.525575757f},
-std::array<float,2>{0.000198418362f, 0.193620533f},
-std::array<float,2>{0.62603122f, 0.35611257f},
-std::array<float,2>{0.359666109f, 0.836804807f},
-std::array<float,2>{0.743693829f, 0.641028702f},
-std::array<float,2>{0.28137064f, 0.0996440127f},
-std::array<float,2>{0.827448189f, 0.458727986f},
-std::array<float,2>{0.0831437632f, 0.907409132f},
-std::array<float,2>{0.955558598f, 0.79957521f},
-std::array<float,2>{0.162355229f, 0.266695678f},
-std::array<float,2>{0.572800577f, 0.186981142f},
-std::array<float,2>{0.417383879f, 0.623011231f},
-std::array<float,2>{0.655551016f, 0.920731902f},
-std::array<float,2>{0.34542647f, 0.461777031f},
-std::array<float,2>{0.767115772f, 0.103141204f},
-std::array<float,2>{0.0249567777f, 0.648690045f},
-std::array<float,2>{0.921016455f, 0.610026538f},
-std::array<float,2>{0.211425617f, 0.174523249f},
-std::array<float,2>{0.52196449f, 0.275038093f},
-std::array<float,2>{0.458482802f, 0.810335994f},
-std::array<float,2>{0.592514157f, 0.736787975f},
-std::array<float,2>{0.427133292f, 0.0566642247f},
-std::array<float,2>{0.938683093f, 0.419105083f},
-std::array<float,2>{0.175796703f, 0.974582255f},
-std::array<float,2>{0.842393875f, 0.829597116f},
-std::array<float,2>{0.0637483075f, 0.35017851f},
-std::array<float,2>{0.733195186f, 0.197918147f},
-std::array<float,2>{0.300481141f, 0.516467214f},
-std::array<float,2>{0.538956821f, 0.773665369f},
-std::array<float,2>{0.496630371f, 0.303147763f},
-std::array<float,2>{0.876832545f, 0.14985013f},
-std::array<float,2>{0.23945199f, 0.566935062f},
-std::array<float,2>{0.806070924f, 0.68268466f},
-std::array<float,2>{0.0436145775f, 0.0745165423f},
-std::array<float,2>{0.670674384f, 0.495743394f},
-std::array<float,2>{0.335901856f, 0.899756551f},
-std::array<float,2>{0.710683882f, 0.54107213f},
-std::array<float,2>{0.265910178f, 0.24971576f},
-std::array<float,2>{0.865962684f, 0.325071216f},
-std::array<float,2>{0.0966968611f, 0.865164161f},
-std::array<float,2>{0.998685479f, 0.957587361f},
-std::array<float,2>{0.143617213f, 0.39346379f},
-std::array<float,2>{0.616332054f, 0.0269642845f},
-std::array<float,2>{0.403849393f, 0.710329533f},
-std::array<float,2>{0.747163773f, 0.851038992f},
-std::array<float,2>{0.28880766f, 0.335158169f},
-std::array<float,2>{0.822685599f, 0.227538094f},
-std::array<float,2>{0.0797398388f, 0.552157879f},
-std::array<float,2>{0.957357109f, 0.69158864f},
-std::array<float,2>{0.15968515f, 0.000975579082f},
-std::array<float,2>{0.576540291f, 0.383460045f},
-std::array<float,2>{0.419151872f, 0.941741228f},
-std::array<float,2>{0.502144337f, 0.587961197f},
-std::array<float,2>{0.447345197f, 0.125473127f},
-std::array<float,2>{0.936272562f, 0.285619169f},
-std::array<float,2>{0.192746162f, 0.761932552f},
-std::array<float,2>{0.761108577f, 0.875715733f},
-std::array<float,2>{0.00618477259f, 0.48030591f},
-std::array<float,2>{0.631687164f, 0.0892422423f},
-std::array<float,2>{0.367051572f, 0.667826533f},
-std::array<float,2>{0.606559873f, 0.994137704f},
-std::array<float,2>{0.380777448f, 0.422715873f},
-std::array<float,2>{0.972280979f, 0.0405118465f},
-std::array<float,2>{0.125972182f, 0.724083245f},
-std::array<float,2>{0.853391588f, 0.508824766f},
-std::array<float,2>{0.111031584f, 0.204471186f},
-std::array<float,2>{0.698724329f, 0.360456735f},
-std::array<float,2>{0.251259804f, 0.819654763f},
-std::array<float,2>{0.677162707f, 0.626334906f},
-std::array<float,2>{0.313313842f, 0.123633437f},
-std::array<float,2>{0.783869445f, 0.450588644f},
-std::array<float,2>{0.0604240373f, 0.933950007f},
-std::array<float,2>{0.90177542f, 0.784387112f},
-std::array<float,2>{0.231682122f, 0.251045763f},
-std::array<float,2>{0.555673182f, 0.15740858f},
-std::array<float,2>{0.475058138f, 0.597674549f},
-std::array<float,2>{0.693072736f, 0.945832253f},
-std::array<float,2>{0.261803418f, 0.377853304f},
-std::array<float,2>{0.845589817f, 0.0146706114f},
-std::array<float,2>{0.124740832f, 0.695878029f},
-std::array<float,2>{0.981687069f, 0.559883833f},
-std::array<float,2>{0.136146128f, 0.224211469f},
-std::array<float,2>{0.600315452f, 0.336753637f},
-std::array<float,2>{0.386956453f, 0.858511269f},
-std::array<float,2>{0.552584767f, 0.663840592f},
-std::array<float,2>{0.478666514f, 0.0804665312f},
-std::array<float,2>{0.89324075f, 0.472081006f},
-std::array<float,2>{0.219054356f, 0.885167956f},
-std::array<float,2>{0.794712007f, 0.752690673f},
-std::array<float,2>{0.0469155014f, 0.291974932f},
-std::array<float,2>{0.680730104f, 0.135014579f},
-std::array<float,2>{0.326486111f, 0.580714047f},
-std::array<float,2>{0.563509583f, 0.820910871f},
-std::array<float,2>{0.411651045f, 0.369000584f},
-std::array<float,2>{0.963642359f, 0.214055955f},
-std::array<float,2>{0.166377544f, 0.501015782f},
-std::array<float,2>{0.814921498f, 0.731701612f},
-std::array<float,2>{0.0870763436f, 0.0325614512f},
-std::array<float,2>{0.741233826f, 0.435486794f},
-std::array<float,2>{0.28909722f, 0.98530072f},
-std::array<float,2>{0.63998276f, 0.603268564f},
-std::array<float,2>{0.372901201f, 0.167309135f},
-std::array<float,2>{0.75464648f, 0.261208355f},
-std::array<float,2>{0.0125795528f, 0.791526556f},
-std::array<float,2>{0.927493274f, 0.926560998f},
-std::array<float,2>{0.19857423f, 0.438425511f},
-std::array<float,2>{0.51539588f, 0.116568945f},
-std::array<float,2>{0.439685851f, 0.640166581f},
-std::array<float,2>{0.662246883f, 0.803971767f},
-std::array<float,2>{0.336483926f, 0.272483706f},
-std::array<float,2>{0.802051127f, 0.179810181f},
-std::array<float,2>{0.0373957604f, 0.619624376f},
-std::array<float,2>{0.888955712f, 0.644947886f},
-std::array<float,2>{0.247108832f, 0.0964459702f},
-std::array<float,2>{0.545603454f, 0.455271125f},
-std::array<float,2>{0.490979016f, 0.910811305f},
-std::array<float,2>{0.624465287f, 0.528698444f},
-std::array<float,2>{0.395566255f, 0.19039847f},
-std::array<float,2>{0.984397411f, 0.354690105f},
-std::array<float,2>{0.155825868f, 0.842115104f},
-std::array<float,2>{0.868787587f, 0.98423332f},
-std::array<float,2>{0.105612889f, 0.407327831f},
-std::array<float,2>{0.713931739f, 0.0494561829f},
-std::array<float,2>{0.273823678f, 0.74989301f},
-std::array<float,2>{0.52650547f, 0.895585716f},
-std::array<float,2>{0.464576155f, 0.490292579f},
-std::array<float,2>{0.910795271f, 0.0649794564f},
-std::array<float,2>{0.204679072f, 0.677369773f},
-std::array<float,2>{0.773979604f, 0.577762425f},
-std::array<float,2>{0.0163398366f, 0.141548291f},
-std::array<float,2>{0.645425975f, 0.31217286f},
-std::array<float,2>{0.35923177f, 0.769913077f},
-std::array<float,2>{0.721729696f, 0.711713493f},
-std::array<float,2>{0.311029464f, 0.0206025187f},
-std::array<float,2>{0.831689596f, 0.404468596f},
-std::array<float,2>{0.0746932477f, 0.968498528f},
-std::array<float,2>{0.948907256f, 0.869000673f},
-std::array<float,2>{0.182469457f, 0.314354151f},
-std::array<float,2>{0.582964301f, 0.234960154f},
-std::array<float,2>{0.43448931f, 0.536455691f},
-std::array<float,2>{0.684893072f, 0.970121622f},
-std::array<float,2>{0.321213603f, 0.414202631f},
-std::array<float,2>{0.791456401f, 0.0588734187f},
-std::array<float,2>{0.0521852002f, 0.73950541f},
-std::array<float,2>{0.894635439f, 0.519598842f},
-std::array<float,2>{0.225119621f, 0.200472698f},
-std::array<float,2>{0.548554242f, 0.34400481f},
-std::array<float,2>{0.481556088f, 0.835019648f},
-std::array<float,2>{0.596191466f, 0.653033793f},
-std::array<float,2>{0.383367956f, 0.106404051f},
-std::array<float,2>{0.978203237f, 0.465131491f},
-std::array<float,2>{0.140340671f, 0.914122224f},
-std::array<float,2>{0.850033104f, 0.808125138f},
-std::array<float,2>{0.12077076f, 0.280861676f},
-std::array<float,2>{0.688061595f, 0.17691192f},
-std::array<float,2>{0.261136115f, 0.614068866f},
-std::array<float,2>{0.5088498f, 0.860403895f},
-std::array<float,2>{0.443130732f, 0.320507407f},
-std::array<float,2>{0.924526334f, 0.24570924f},
-std::array<float,2>{0.202942148f, 0.543951511f},
-std::array<float,2>{0.750197351f, 0.703253269f},
-std::array<float,2>{0.00829829462f, 0.0307859629f},
-std::array<float,2>{0.634603083f, 0.398374647f},
-std::array<float,2>{0.37073341f, 0.953538179f},
-std::array<float,2>{0.735624552f, 0.563258171f},
-std::array<float,2>{0.296313077f, 0.153627515f},
-std::array<float,2>{0.819238961f, 0.299859017f},
-std::array<float,2>{0.0909999013f, 0.780634582f},
-std::array<float,2>{0.96799016f, 0.905380189f},
-std::array<float,2>{0.170597419f, 0.498984963f},
-std::array<float,2>{0.567315578f, 0.0721522123f},
-std::array<float,2>{0.406498253f, 0.684171975f},
-std::array<float,2>{0.718165934f, 0.759336352f},
-std::array<float,2>{0.280076534f, 0.281586915f},
-std::array<float,2>{0.871230066f, 0.130219772f},
-std::array<float,2>{0.101825923f, 0.590780437f},
-std::array<float,2>{0.989509404f, 0.668870509f},
-std::array<float,2>{0.149522752f, 0.092465274f},
-std::array<float,2>{0.619619727f, 0.483258784f},
-std::array<float,2>{0.393794745f, 0.87967366f},
-std::array<float,2>{0.539238453f, 0.549904764f},
-std::array<float,2>{0.488000542f, 0.231090486f},
-std::array<float,2>{0.88327378f, 0.329498023f},
-std::array<float,2>{0.244903013f, 0.847288072f},
-std::array<float,2>{0.798030972f, 0.939645231f},
-std::array<float,2>{0.0346387662f, 0.388147801f},
-std::array<float,2>{0.658675134f, 0.00618630508f},
-std::array<float,2>{0.341994494f, 0.687701285f},
-std::array<float,2>{0.580353022f, 0.931888402f},
-std::array<float,2>{0.430449843f, 0.447369188f},
-std::array<float,2>{0.950052857f, 0.119231828f},
-std::array<float,2>{0.186699569f, 0.632303059f},
-std::array<float,2>{0.835549712f, 0.595170259f},
-std::array<float,2>{0.0719035789f, 0.162637904f},
-std::array<float,2>{0.72334671f, 0.254929066f},
-std::array<float,2>{0.305529505f, 0.78662318f},
-std::array<float,2>{0.642513752f, 0.720546424f},
-std::array<float,2>{0.352528155f, 0.0459073f},
-std::array<float,2>{0.780336618f, 0.428978473f},
-std::array<float,2>{0.0218988247f, 0.999403954f},
-std::array<float,2>{0.908076167f, 0.812757611f},
-std::array<float,2>{0.208841056f, 0.366127819f},
-std::array<float,2>{0.528288126f, 0.207321033f},
-std::array<float,2>{0.466911167f, 0.515453279f},
-std::array<float,2>{0.727075636f, 0.889620304f},
-std::array<float,2>{0.304642677f, 0.476376027f},
-std::array<float,2>{0.837604821f, 0.0822210312f},
-std::array<float,2>{0.0703013763f, 0.658514023f},
-std::array<float,2>{0.941658318f, 0.585098207f},
-std::array<float,2>{0.1723153f, 0.138004795f},
-std::array<float,2>{0.588961244f, 0.296734214f},
-std::array<float,2>{0.423504472f, 0.754404664f},
-std::array<float,2>{0.516955435f, 0.701702833f},
-std::array<float,2>{0.454866111f, 0.0113204988f},
-std::array<float,2>{0.917280793f, 0.380560994f},
-std::array<float,2>{0.217716634f, 0.953086019f},
-std::array<float,2>{0.773147464f, 0.851732492f},
-std::array<float,2>{0.028675003f, 0.340344965f},
-std::array<float,2>{0.650149286f, 0.220594466f},
-std::array<float,2>{0.348482043f, 0.556472719f},
-std::array<float,2>{0.610178649f, 0.796394944f},
-std::array<float,2>{0.39869988f, 0.265230238f},
-std::array<float,2>{0.994718969f, 0.171589121f},
-std::array<float,2>{0.144816414f, 0.605969787f},
-std::array<float,2>{0.862468004f, 0.633071959f},
-std::array<float,2>{0.099284105f, 0.112824425f},
-std::array<float,2>{0.70348835f, 0.44382146f},
-std::array<float,2>{0.270866364f, 0.922701657f},
-std::array<float,2>{0.665958762f, 0.506087542f},
-std::array<float,2>{0.330843598f, 0.215622231f},
-std::array<float,2>{0.811261714f, 0.374649376f},
-std::array<float,2>{0.0393679254f, 0.825649738f},
-std::array<float,2>{0.881938577f, 0.991235971f},
-std::array<float,2>{0.236476719f, 0.42989859f},
-std::array<float,2>{0.532480538f, 0.035584785f},
-std::array<float,2>{0.492335409f, 0.728166282f},
-std::array<float,2>{0.628280163f, 0.838301659f},
-std::array<float,2>{0.362412483f, 0.358550102f},
-std::array<float,2>{0.764448702f, 0.191937655f},
-std::array<float,2>{0.00198850315f, 0.523699999f},
-std::array<float,2>{0.933298111f, 0.74401927f},
-std::array<float,2>{0.187961817f, 0.0526214428f},
-std::array<float,2>{0.506294787f, 0.410511345f},
-std::array<float,2>{0.44965902f, 0.980359316f},
-std::array<float,2>{0.571746409f, 0.623632073f},
-std::array<float,2>{0.414719343f, 0.184237331f},
-std::array<float,2>{0.95405513f, 0.267900109f},
-std::array<float,2>{0.160186797f, 0.797431052f},
-std::array<float,2>{0.82521224f, 0.909425139f},
-std::array<float,2>{0.0841451883f, 0.460285664f},
-std::array<float,2>{0.744543016f, 0.0986068174f},
-std::array<float,2>{0.284603834f, 0.643348038f},
-std::array<float,2>{0.56001097f, 0.964745343f},
-std::array<float,2>{0.470447719f, 0.402021915f},
-std::array<float,2>{0.904678047f, 0.0188032072f},
-std::array<float,2>{0.229334906f, 0.715051234f},
-std::array<float,2>{0.786092341f, 0.532559156f},
-std::array<float,2>{0.0564080998f, 0.238526598f},
-std::array<float,2>{0.674697816f, 0.319350719f},
-std::array<float,2>{0.319392204f, 0.874777853f},
-std::array<float,2>{0.701966643f, 0.672667205f},
-std::array<float,2>{0.255495995f, 0.0668733865f},
-std::array<float,2>{0.855617702f, 0.487809956f},
-std::array<float,2>{0.116951704f, 0.892083645f},
-std::array<float,2>{0.97284919f, 0.766530037f},
-std::array<float,2>{0.132376641f, 0.305109203f},
-std::array<float,2>{0.602068603f, 0.148380518f},
-std::array<float,2>{0.375835836f, 0.572354257f},
-std::array<float,2>{0.678961456f, 0.934839308f},
-std::array<float,2>{0.315352231f, 0.449251056f},
-std::array<float,2>{0.781414092f, 0.12477643f},
-std::array<float,2>{0.0614576824f, 0.625255466f},
-std::array<float,2>{0.899661839f, 0.598905861f},
-std::array<float,2>{0.232756004f, 0.156972438f},
-std::array<float,2>{0.556663632f, 0.250874609f},
-std::array<float,2>{0.473932058f, 0.783659101f},
-std::array<float,2>{0.608554125f, 0.723295271f},
-std::array<float,2>{0.380938053f, 0.0397429988f},
-std::array<float,2>{0.970390022f, 0.423240274f},
-std::array<float,2>{0.128157005f, 0.992998958f},
-std::array<float,2>{0.854923487f, 0.81891346f},
-std::array<float,2>{0.11184831f, 0.359733701f},
-std::array<float,2>{0.695622623f, 0.203506917f},
-std::array<float,2>{0.25235635f, 0.508593976f},
-std::array<float,2>{0.500693679f, 0.763303697f},
-std::array<float,2>{0.445806235f, 0.286924452f},
-std::array<float,2>{0.934181154f, 0.126289099f},
-std::array<float,2>{0.193365514f, 0.58980602f},
-std::array<float,2>{0.759680808f, 0.666184723f},
-std::array<float,2>{0.00527389441f, 0.088641122f},
-std::array<float,2>{0.629539788f, 0.479478002f},
-std::array<float,2>{0.36464867f, 0.87691462f},
-std::array<float,2>{0.749685228f, 0.551300049f},
-std::array<float,2>{0.286007494f, 0.227784038f},
-std::array<float,2>{0.82190305f, 0.334537655f},
-std::array<float,2>{0.0813552737f, 0.85038048f},
-std::array<float,2>{0.960299373f, 0.943311393f},
-std::array<float,2>{0.15744634f, 0.38404274f},
-std::array<float,2>{0.575471997f, 0.00151143095f},
-std::array<float,2>{0.420636982f, 0.693082392f},
-std::array<float,2>{0.707933903f, 0.863626838f},
-std::array<float,2>{0.268475235f, 0.325719714f},
-std::array<float,2>{0.864037037f, 0.248928353f},
-std::array<float,2>{0.0945229307f, 0.542017579f},
-std::array<float,2>{0.997322261f, 0.709660172f},
-std::array<float,2>{0.141667321f, 0.0263435878f},
-std::array<float,2>{0.614481866f, 0.394317985f},
-std::array<float,2>{0.40505746f, 0.958238363f},
-std::array<float,2>{0.535666466f, 0.568262756f},
-std::array<float,2>{0.499349892f, 0.14868477f},
-std::array<float,2>{0.878622532f, 0.304006279f},
-std::array<float,2>{0.241380379f, 0.775200009f},
-std::array<float,2>{0.808208764f, 0.899373412f},
-std::array<float,2>{0.045311518f, 0.494990528f},
-std::array<float,2>{0.668345213f, 0.0760121942f},
-std::array<float,2>{0.333878249f, 0.682222128f},
-std::array<float,2>{0.590423405f, 0.972858012f},
-std::array<float,2>{0.429043949f, 0.418235213f},
-std::array<float,2>{0.94024545f, 0.0577929989f},
-std::array<float,2>{0.178276539f, 0.73772645f},
-std::array<float,2>{0.841448247f, 0.517246783f},
-std::array<float,2>{0.0655863956f, 0.198947087f},
-std::array<float,2>{0.730834365f, 0.351176113f},
-std::array<float,2>{0.297185808f, 0.828190446f},
-std::array<float,2>{0.652682006f, 0.650327742f},
-std::array<float,2>{0.346674144f, 0.101900354f},
-std::array<float,2>{0.768078268f, 0.46222052f},
-std::array<float,2>{0.0268086772f, 0.92141515f},
-std::array<float,2>{0.918870211f, 0.809303641f},
-std::array<float,2>{0.213999122f, 0.27378574f},
-std::array<float,2>{0.519553602f, 0.175561637f},
-std::array<float,2>{0.459903181f, 0.611048043f},
-std::array<float,2>{0.719864488f, 0.967241049f},
-std::array<float,2>{0.308807671f, 0.405792475f},
-std::array<float,2>{0.829778731f, 0.0199535694f},
-std::array<float,2>{0.0763874799f, 0.712614298f},
-std::array<float,2>{0.94714278f, 0.535562098f},
-std::array<float,2>{0.18053183f, 0.236194625f},
-std::array<float,2>{0.585075676f, 0.312790781f},
-std::array<float,2>{0.43626821f, 0.867895067f},
-std::array<float,2>{0.524123251f, 0.676160097f},
-std::array<float,2>{0.462757498f, 0.0656088293f},
-std::array<float,2>{0.913040698f, 0.491334468f},
-std::array<float,2>{0.205448002f, 0.895170629f},
-std::array<float,2>{0.775589347f, 0.771197796f},
-std::array<float,2>{0.0191777367f, 0.311088681f},
-std::array<float,2>{0.647521079f, 0.141680092f},
-std::array<float,2>{0.357202291f, 0.576591551f},
-std::array<float,2>{0.623030961f, 0.843207777f},
-std::array<float,2>{0.397073984f, 0.35376054f},
-std::array<float,2>{0.98643446f, 0.191065788f},
-std::array<float,2>{0.15323472f, 0.528073668f},
-std::array<float,2>{0.869725645f, 0.748211622f},
-std::array<float,2>{0.10904102f, 0.0503880195f},
-std::array<float,2>{0.712002695f, 0.407080084f},
-std::array<float,2>{0.27541554f, 0.983211935f},
-std::array<float,2>{0.660486817f, 0.620363295f},
-std::array<float,2>{0.339149624f, 0.180771947f},
-std::array<float,2>{0.803143144f, 0.272064716f},
-std::array<float,2>{0.0366235971f, 0.803495944f},
-std::array<float,2>{0.888419449f, 0.911914885f},
-std::array<float,2>{0.248462111f, 0.456204265f},
-std::array<float,2>{0.544737577f, 0.0972906351f},
-std::array<float,2>{0.48891148f, 0.646193683f},
-std::array<float,2>{0.637833238f, 0.792534649f},
-std::array<float,2>{0.373758107f, 0.260652274f},
-std::array<float,2>{0.756888807f, 0.166546896f},
-std::array<float,2>{0.0147555573f, 0.602423012f},
-std::array<float,2>{0.929034472f, 0.639609933f},
-std::array<float,2>{0.195463672f, 0.115387224f},
-std::array<float,2>{0.512972295f, 0.438570529f},
-std::array<float,2>{0.438310415f, 0.927259028f},
-std::array<float,2>{0.565571904f, 0.500024438f},
-std::array<float,2>{0.412734032f, 0.213366196f},
-std::array<float,2>{0.961602926f, 0.368160278f},
-std::array<float,2>{0.164840639f, 0.821923673f},
-std::array<float,2>{0.814089119f, 0.985832036f},
-std::array<float,2>{0.0879886523f, 0.43401137f},
-std::array<float,2>{0.740181983f, 0.0318080969f},
-std::array<float,2>{0.292690873f, 0.730540514f},
-std::array<float,2>{0.553595245f, 0.886065245f},
-std::array<float,2>{0.477768213f, 0.470714867f},
-std::array<float,2>{0.892558336f, 0.0814741179f},
-std::array<float,2>{0.22177811f, 0.662937522f},
-std::array<float,2>{0.795088112f, 0.581916153f},
-std::array<float,2>{0.0491571613f, 0.136473969f},
-std::array<float,2>{0.682280958f, 0.292790562f},
-std::array<float,2>{0.324712157f, 0.753634512f},
-std::array<float,2>{0.694263637f, 0.696962416f},
-std::array<float,2>{0.264591753f, 0.013945315f},
-std::array<float,2>{0.846482575f, 0.378275663f},
-std::array<float,2>{0.122741833f, 0.946408153f},
-std::array<float,2>{0.983224273f, 0.858284473f},
-std::array<float,2>{0.134240314f, 0.337050259f},
-std::array<float,2>{0.599355221f, 0.223346695f},
-std::array<float,2>{0.390138239f, 0.559543371f},
-std::array<float,2>{0.643609762f, 0.998616576f},
-std::array<float,2>{0.354239911f, 0.427755594f},
-std::array<float,2>{0.778328121f, 0.0456956439f},
-std::array<float,2>{0.0200564265f, 0.719152093f},
-std::array<float,2>{0.909004152f, 0.513881624f},
-std::array<float,2>{0.210630283f, 0.208922088f},
-std::array<float,2>{0.529606223f, 0.366293401f},
-std::array<float,2>{0.465894192f, 0.814149976f},
-std::array<float,2>{0.57888478f, 0.63180244f},
-std::array<float,2>{0.432932556f, 0.120804332f},
-std::array<float,2>{0.951973975f, 0.448508143f},
-std::array<float,2>{0.185501456f, 0.932795107f},
-std::array<float,2>{0.832772553f, 0.786017597f},
-std::array<float,2>{0.0736711696f, 0.254158586f},
-std::array<float,2>{0.725774884f, 0.163248941f},
-std::array<float,2>{0.308011204f, 0.594184816f},
-std::array<float,2>{0.541568637f, 0.846654177f},
-std::array<float,2>{0.484537035f, 0.328888893f},
-std::array<float,2>{0.885594428f, 0.231543645f},
-std::array<float,2>{0.242318586f, 0.549655557f},
-std::array<float,2>{0.798991382f, 0.688993275f},
-std::array<float,2>{0.0316750854f, 0.00772546045f},
-std::array<float,2>{0.656870186f, 0.386819988f},
-std::array<float,2>{0.340948045f, 0.940992296f},
-std::array<float,2>{0.716329336f, 0.591306269f},
-std::array<float,2>{0.278110147f, 0.129222333f},
-std::array<float,2>{0.874348402f, 0.283144593f},
-std::array<float,2>{0.104256928f, 0.757817864f},
-std::array<float,2>{0.991730809f, 0.880291998f},
-std::array<float,2>{0.15181008f, 0.483856082f},
-std::array<float,2>{0.617362082f, 0.0928836912f},
-std::array<float,2>{0.392415553f, 0.669769764f},
-std::array<float,2>{0.738117337f, 0.779810667f},
-std::array<float,2>{0.29365778f, 0.299366057f},
-std::array<float,2>{0.816852629f, 0.153214574f},
-std::array<float,2>{0.0934233889f, 0.563979506f},
-std::array<float,2>{0.965943456f, 0.68464601f},
-std::array<float,2>{0.168636665f, 0.0712565929f},
-std::array<float,2>{0.568709552f, 0.499816507f},
-std::array<float,2>{0.40964517f, 0.904342532f},
-std::array<float,2>{0.509874463f, 0.54348278f},
-std::array<float,2>{0.444224596f, 0.244928554f},
-std::array<float,2>{0.923335373f, 0.321484059f},
-std::array<float,2>{0.200862005f, 0.860138893f},
-std::array<float,2>{0.752942741f, 0.954357088f},
-std::array<float,2>{0.0109461695f, 0.397052467f},
-std::array<float,2>{0.635154545f, 0.0295650624f},
-std::array<float,2>{0.367423326f, 0.704558969f},
-std::array<float,2>{0.594955266f, 0.915069818f},
-std::array<float,2>{0.386491299f, 0.465931475f},
-std::array<float,2>{0.979584992f, 0.106806621f},
-std::array<float,2>{0.137387231f, 0.654007316f},
-std::array<float,2>{0.849520206f, 0.614496469f},
-std::array<float,2>{0.117925249f, 0.175853819f},
-std::array<float,2>{0.69133836f, 0.279423445f},
-std::array<float,2>{0.258764982f, 0.807226002f},
-std::array<float,2>{0.685823321f, 0.738865137f},
-std::array<float,2>{0.322731853f, 0.0598867461f},
-std::array<float,2>{0.790288389f, 0.415411532f},
-std::array<float,2>{0.0530885085f, 0.969179392f},
-std::array<float,2>{0.897083282f, 0.834481478f},
-std::array<float,2>{0.224398553f, 0.345045447f},
-std::array<float,2>{0.548939586f, 0.199865252f},
-std::array<float,2>{0.483913392f, 0.520718217f},
-std::array<float,2>{0.700891733f, 0.89081502f},
-std::array<float,2>{0.256567419f, 0.48665151f},
-std::array<float,2>{0.859205425f, 0.0681110322f},
-std::array<float,2>{0.114099748f, 0.672864616f},
-std::array<float,2>{0.975772321f, 0.573806643f},
-std::array<float,2>{0.129094452f, 0.147214204f},
-std::array<float,2>{0.604765177f, 0.306434065f},
-std::array<float,2>{0.377548486f, 0.766985238f},
-std::array<float,2>{0.561804652f, 0.715946376f},
-std::array<float,2>{0.472108424f, 0.0178223457f},
-std::array<float,2>{0.903151035f, 0.400450587f},
-std::array<float,2>{0.228390962f, 0.963111162f},
-std::array<float,2>{0.789051533f, 0.873725116f},
-std::array<float,2>{0.0574859455f, 0.31894663f},
-std::array<float,2>{0.673773289f, 0.239523008f},
-std::array<float,2>{0.317658395f, 0.531711996f},
-std::array<float,2>{0.573651016f, 0.798639119f},
-std::array<float,2>{0.416512102f, 0.268576056f},
-std::array<float,2>{0.956723273f, 0.184767932f},
-std::array<float,2>{0.163848057f, 0.624381423f},
-std::array<float,2>{0.82678169f, 0.643652737f},
-std::array<float,2>{0.0825610012f, 0.0987999961f},
-std::array<float,2>{0.742261946f, 0.459729463f},
-std::array<float,2>{0.282290161f, 0.908578277f},
-std::array<float,2>{0.625011802f, 0.525306284f},
-std::array<float,2>{0.360688448f, 0.192918241f},
-std::array<float,2>{0.762970746f, 0.357617021f},
-std::array<float,2>{0.00167191552f, 0.839717686f},
-std::array<float,2>{0.930143893f, 0.979029596f},
-std::array<float,2>{0.189767599f, 0.411218733f},
-std::array<float,2>{0.504228354f, 0.0516287498f},
-std::array<float,2>{0.451820612f, 0.742554605f},
-std::array<float,2>{0.666556597f, 0.824389815f},
-std::array<float,2>{0.328916311f, 0.373792231f},
-std::array<float,2>{0.809212923f, 0.21644263f},
-std::array<float,2>{0.0428931564f, 0.507659793f},
-std::array<float,2>{0.880010426f, 0.726588905f},
-std::array<float,2>{0.234624162f, 0.0368688367f},
-std::array<float,2>{0.535152614f, 0.431014478f},
-std::array<float,2>{0.495114714f, 0.990421474f},
-std::array<float,2>{0.612710118f, 0.607059896f},
-std::array<float,2>{0.400541246f, 0.170522511f},
-std::array<float,2>{0.992672503f, 0.263786852f},
-std::array<float,2>{0.147283852f, 0.795293272f},
-std::array<float,2>{0.861292779f, 0.923155963f},
-std::array<float,2>{0.100231178f, 0.44491598f},
-std::array<float,2>{0.707021534f, 0.112029247f},
-std::array<float,2>{0.273225904f, 0.634479284f},
-std::array<float,2>{0.517745733f, 0.952077866f},
-std::array<float,2>{0.455238402f, 0.379144788f},
-std::array<float,2>{0.915935695f, 0.0101980176f},
-std::array<float,2>{0.21571435f, 0.702244103f},
-std::array<float,2>{0.770286262f, 0.555021524f},
-std::array<float,2>{0.0306423493f, 0.218967721f},
-std::array<float,2>{0.650675237f, 0.341702193f},
-std::array<float,2>{0.35039565f, 0.853300214f},
-std::array<float,2>{0.729895711f, 0.659831345f},
-std::array<float,2>{0.300900489f, 0.0838137418f},
-std::array<float,2>{0.839328468f, 0.475440413f},
-std::array<float,2>{0.0667833537f, 0.889861286f},
-std::array<float,2>{0.944971085f, 0.755294859f},
-std::array<float,2>{0.174937084f, 0.295119226f},
-std::array<float,2>{0.587011755f, 0.137053937f},
-std::array<float,2>{0.424032331f, 0.58415556f},
-std::array<float,2>{0.632289648f, 0.878757f},
-std::array<float,2>{0.36585626f, 0.476617068f},
-std::array<float,2>{0.759837747f, 0.0860088319f},
-std::array<float,2>{0.00684728567f, 0.665770411f},
-std::array<float,2>{0.936686397f, 0.586954832f},
-std::array<float,2>{0.19216983f, 0.127035886f},
-std::array<float,2>{0.503667712f, 0.287418604f},
-std::array<float,2>{0.449202061f, 0.76546067f},
-std::array<float,2>{0.578048408f, 0.694303513f},
-std::array<float,2>{0.418156743f, 0.00273004663f},
-std::array<float,2>{0.958316684f, 0.385429293f},
-std::array<float,2>{0.159089893f, 0.94465518f},
-std::array<float,2>{0.824017644f, 0.848489165f},
-std::array<float,2>{0.0790302232f, 0.332665503f},
-std::array<float,2>{0.746307731f, 0.229918391f},
-std::array<float,2>{0.287397623f, 0.55387038f},
-std::array<float,2>{0.555613339f, 0.782178104f},
-std::array<float,2>{0.475672513f, 0.253262937f},
-std::array<float,2>{0.90075177f, 0.1597929f},
-std::array<float,2>{0.231143758f, 0.600530922f},
-std::array<float,2>{0.784562707f, 0.628044963f},
-std::array<float,2>{0.058944203f, 0.121432751f},
-std::array<float,2>{0.675970078f, 0.452983558f},
-std::array<float,2>{0.313988924f, 0.936756253f},
-std::array<float,2>{0.697597802f, 0.510546744f},
-std::array<float,2>{0.250010461f, 0.20673582f},
-std::array<float,2>{0.852088034f, 0.363119274f},
-std::array<float,2>{0.109703384f, 0.818152845f},
-std::array<float,2>{0.971134186f, 0.995395482f},
-std::array<float,2>{0.126781836f, 0.425450563f},
-std::array<float,2>{0.605800569f, 0.0428756438f},
-std::array<float,2>{0.379737765f, 0.724762499f},
-std::array<float,2>{0.734279156f, 0.830346048f},
-std::array<float,2>{0.299491674f, 0.349452496f},
-std::array<float,2>{0.843628228f, 0.196788549f},
-std::array<float,2>{0.0625502318f, 0.518517494f},
-std::array<float,2>{0.937688828f, 0.734683514f},
-std::array<float,2>{0.176945478f, 0.0566131733f},
-std::array<float,2>{0.592896938f, 0.421041161f},
-std::array<float,2>{0.426163256f, 0.97563386f},
-std::array<float,2>{0.522587836f, 0.612984419f},
-std::array<float,2>{0.457909584f, 0.17212005f},
-std::array<float,2>{0.920119941f, 0.275526971f},
-std::array<float,2>{0.212386921f, 0.81199652f},
-std::array<float,2>{0.766164303f, 0.918525994f},
-std::array<float,2>{0.0238516182f, 0.463300794f},
-std::array<float,2>{0.65457356f, 0.104201883f},
-std::array<float,2>{0.344222367f, 0.651884079f},
-std::array<float,2>{0.615596771f, 0.960459769f},
-std::array<float,2>{0.403159171f, 0.391796023f},
-std::array<float,2>{0.999421358f, 0.0236216895f},
-std::array<float,2>{0.14278844f, 0.708237112f},
-std::array<float,2>{0.86645478f, 0.540693641f},
-std::array<float,2>{0.0962943807f, 0.247523516f},
-std::array<float,2>{0.709270775f, 0.326272219f},
-std::array<float,2>{0.267183244f, 0.866486669f},
-std::array<float,2>{0.671563208f, 0.68049562f},
-std::array<float,2>{0.334224939f, 0.0765504166f},
-std::array<float,2>{0.804827213f, 0.492973417f},
-std::array<float,2>{0.0446991473f, 0.901990056f},
-std::array<float,2>{0.875453413f, 0.775920272f},
-std::array<float,2>{0.238740936f, 0.3010602f},
-std::array<float,2>{0.537244797f, 0.152294591f},
-std::array<float,2>{0.497650027f, 0.569448292f},
-std::array<float,2>{0.713655591f, 0.981064141f},
-std::array<float,2>{0.27528286f, 0.408964276f},
-std::array<float,2>{0.867203355f, 0.0468816012f},
-std::array<float,2>{0.106725775f, 0.747338653f},
-std::array<float,2>{0.985767901f, 0.530452192f},
-std::array<float,2>{0.154305294f, 0.187953115f},
-std::array<float,2>{0.623431861f, 0.353310794f},
-std::array<float,2>{0.395030141f, 0.841014981f},
-std::array<float,2>{0.546707392f, 0.646697402f},
-std::array<float,2>{0.491600424f, 0.095013611f},
-std::array<float,2>{0.89036715f, 0.453421712f},
-std::array<float,2>{0.246691838f, 0.91386342f},
-std::array<float,2>{0.801707983f, 0.802646935f},
-std::array<float,2>{0.0381914228f, 0.270898104f},
-std::array<float,2>{0.663966119f, 0.181869388f},
-std::array<float,2>{0.337843567f, 0.617765427f},
-std::array<float,2>{0.583759487f, 0.870154262f},
-std::array<float,2>{0.435304731f, 0.314503968f},
-std::array<float,2>{0.947768748f, 0.23677884f},
-std::array<float,2>{0.182837307f, 0.538826287f},
-std::array<float,2>{0.830156565f, 0.713054657f},
-std::array<float,2>{0.0757408738f, 0.0232570693f},
-std::array<float,2>{0.721470475f, 0.402993321f},
-std::array<float,2>{0.312133968f, 0.965512991f},
-std::array<float,2>{0.646418989f, 0.574253857f},
-std::array<float,2>{0.358349234f, 0.144512609f},
-std::array<float,2>{0.774796903f, 0.310106248f},
-std::array<float,2>{0.0171927195f, 0.771670282f},
-std::array<float,2>{0.911991537f, 0.898417711f},
-std::array<float,2>{0.203168646f, 0.488742799f},
-std::array<float,2>{0.525629401f, 0.0633335039f},
-std::array<float,2>{0.463607281f, 0.679630518f},
-std::array<float,2>{0.679819167f, 0.750139058f},
-std::array<float,2>{0.327259064f, 0.290150374f},
-std::array<float,2>{0.793107808f, 0.134654224f},
-std::array<float,2>{0.0483258292f, 0.578128517f},
-std::array<float,2>{0.893901229f, 0.661119163f},
-std::array<float,2>{0.220160529f, 0.0784158334f},
-std::array<float,2>{0.551499426f, 0.469232649f},
-std::array<float,2>{0.480395079f, 0.884680748f},
-std::array<float,2>{0.601504207f, 0.562212765f},
-std::array<float,2>{0.387803078f, 0.225680351f},
-std::array<float,2>{0.980616629f, 0.338663995f},
-std::array<float,2>{0.134790987f, 0.855563104f},
-std::array<float,2>{0.844626725f, 0.947665453f},
-std::array<float,2>{0.123243853f, 0.375027835f},
-std::array<float,2>{0.692260087f, 0.0130287949f},
-std::array<float,2>{0.263160437f, 0.698679447f},
-std::array<float,2>{0.514330149f, 0.929148495f},
-std::array<float,2>{0.44138661f, 0.44002673f},
-std::array<float,2>{0.926254451f, 0.114415407f},
-std::array<float,2>{0.198072165f, 0.638543546f},
-std::array<float,2>{0.755229235f, 0.60412997f},
-std::array<float,2>{0.0128273023f, 0.165477037f},
-std::array<float,2>{0.638829529f, 0.258393496f},
-std::array<float,2>{0.371367186f, 0.791004539f},
-std::array<float,2>{0.741154671f, 0.732786477f},
-std::array<float,2>{0.290843844f, 0.0346472301f},
-std::array<float,2>{0.815628588f, 0.436463356f},
-std::array<float,2>{0.086808458f, 0.987985969f},
-std::array<float,2>{0.964043081f, 0.822802484f},
-std::array<float,2>{0.16753751f, 0.370858103f},
-std::array<float,2>{0.563067436f, 0.211440235f},
-std::array<float,2>{0.410561532f, 0.502434969f},
-std::array<float,2>{0.659540057f, 0.93808198f},
-std::array<float,2>{0.342919528f, 0.388960123f},
-std::array<float,2>{0.797608197f, 0.00578600774f},
-std::array<float,2>{0.0334464051f, 0.689591765f},
-std::array<float,2>{0.883954465f, 0.548639476f},
-std::array<float,2>{0.245393991f, 0.232709885f},
-std::array<float,2>{0.540235102f, 0.330794811f},
-std::array<float,2>{0.487057775f, 0.845274329f},
-std::array<float,2>{0.620131195f, 0.670139194f},
-std::array<float,2>{0.393121243f, 0.0907503963f},
-std::array<float,2>{0.988890767f, 0.481851697f},
-std::array<float,2>{0.149154097f, 0.88121134f},
-std::array<float,2>{0.872855067f, 0.759903312f},
-std::array<float,2>{0.103109583f, 0.284221023f},
-std::array<float,2>{0.717390358f, 0.131268308f},
-std::array<float,2>{0.281028897f, 0.592177927f},
-std::array<float,2>{0.529228866f, 0.815945208f},
-std::array<float,2>{0.468381226f, 0.364602268f},
-std::array<float,2>{0.906727076f, 0.210669219f},
-std::array<float,2>{0.207649454f, 0.511961281f},
-std::array<float,2>{0.779657066f, 0.721186697f},
-std::array<float,2>{0.0230362285f, 0.0437506437f},
-std::array<float,2>{0.641310036f, 0.427615494f},
-std::array<float,2>{0.352778137f, 0.996141374f},
-std::array<float,2>{0.724584579f, 0.597524941f},
-std::array<float,2>{0.306554615f, 0.162040725f},
-std::array<float,2>{0.834851623f, 0.256277949f},
-std::array<float,2>{0.0710198805f, 0.788430154f},
-std::array<float,2>{0.951034129f, 0.930870831f},
-std::array<float,2>{0.186410949f, 0.446577549f},
-std::array<float,2>{0.581615865f, 0.118429154f},
-std::array<float,2>{0.43097201f, 0.630783737f},
-std::array<float,2>{0.689310908f, 0.806619465f},
-std::array<float,2>{0.260366231f, 0.278585911f},
-std::array<float,2>{0.851182103f, 0.179400474f},
-std::array<float,2>{0.119712755f, 0.616808176f},
-std::array<float,2>{0.977401495f, 0.655398488f},
-std::array<float,2>{0.139508218f, 0.108539008f},
-std::array<float,2>{0.597121894f, 0.467635542f},
-std::array<float,2>{0.3845433f, 0.917574048f},
-std::array<float,2>{0.547113478f, 0.52339828f},
-std::array<float,2>{0.4813205f, 0.201448187f},
-std::array<float,2>{0.895532668f, 0.346514285f},
-std::array<float,2>{0.225685433f, 0.833959401f},
-std::array<float,2>{0.792233527f, 0.972551942f},
-std::array<float,2>{0.0511924475f, 0.41623643f},
-std::array<float,2>{0.684002221f, 0.0619593859f},
-std::array<float,2>{0.322162479f, 0.740380347f},
-std::array<float,2>{0.568109035f, 0.904102206f},
-std::array<float,2>{0.407383204f, 0.497292668f},
-std::array<float,2>{0.967094421f, 0.0731809512f},
-std::array<float,2>{0.170934349f, 0.686356127f},
-std::array<float,2>{0.8196401f, 0.565245092f},
-std::array<float,2>{0.0899703875f, 0.155961514f},
-std::array<float,2>{0.735096335f, 0.298647553f},
-std::array<float,2>{0.295894474f, 0.779001832f},
-std::array<float,2>{0.633509219f, 0.70650357f},
-std::array<float,2>{0.370031089f, 0.0282223597f},
-std::array<float,2>{0.751589954f, 0.396109045f},
-std::array<float,2>{0.00942311436f, 0.955175757f},
-std::array<float,2>{0.925439417f, 0.861947834f},
-std::array<float,2>{0.20139727f, 0.323381007f},
-std::array<float,2>{0.508390188f, 0.242495224f},
-std::array<float,2>{0.441933066f, 0.54624337f},
-std::array<float,2>{0.745825768f, 0.907056689f},
-std::array<float,2>{0.283915251f, 0.457381994f},
-std::array<float,2>{0.82427454f, 0.101500057f},
-std::array<float,2>{0.0854362473f, 0.642531693f},
-std::array<float,2>{0.954936981f, 0.621925652f},
-std::array<float,2>{0.161632195f, 0.186049879f},
-std::array<float,2>{0.571257472f, 0.266224384f},
-std::array<float,2>{0.415441126f, 0.800003231f},
-std::array<float,2>{0.507364511f, 0.744248152f},
-std::array<float,2>{0.450199872f, 0.0543293655f},
-std::array<float,2>{0.932076335f, 0.413882285f},
-std::array<float,2>{0.189307153f, 0.977006495f},
-std::array<float,2>{0.765484571f, 0.837829351f},
-std::array<float,2>{0.0036235915f, 0.357334346f},
-std::array<float,2>{0.62756741f, 0.194642529f},
-std::array<float,2>{0.361682475f, 0.527326941f},
-std::array<float,2>{0.602801263f, 0.768717766f},
-std::array<float,2>{0.376543701f, 0.306693643f},
-std::array<float,2>{0.974012733f, 0.144609064f},
-std::array<float,2>{0.131168678f, 0.5704813f},
-std::array<float,2>{0.857200384f, 0.675306737f},
-std::array<float,2>{0.115783565f, 0.0686355904f},
-std::array<float,2>{0.702161491f, 0.484909654f},
-std::array<float,2>{0.254365921f, 0.89360708f},
-std::array<float,2>{0.675734758f, 0.534796894f},
-std::array<float,2>{0.319162458f, 0.240263879f},
-std::array<float,2>{0.786542654f, 0.317213386f},
-std::array<float,2>{0.0555899031f, 0.872824788f},
-std::array<float,2>{0.905664861f, 0.961041391f},
-std::array<float,2>{0.229624301f, 0.398723692f},
-std::array<float,2>{0.55873704f, 0.0165252648f},
-std::array<float,2>{0.469664395f, 0.717389822f},
-std::array<float,2>{0.649413466f, 0.853931129f},
-std::array<float,2>{0.348650575f, 0.342316866f},
-std::array<float,2>{0.771844625f, 0.222078592f},
-std::array<float,2>{0.028240541f, 0.557170868f},
-std::array<float,2>{0.916753352f, 0.70075357f},
-std::array<float,2>{0.218094096f, 0.00856929179f},
-std::array<float,2>{0.516222596f, 0.380897582f},
-std::array<float,2>{0.453768104f, 0.950443208f},
-std::array<float,2>{0.588739097f, 0.582844853f},
-std::array<float,2>{0.422670871f, 0.139532343f},
-std::array<float,2>{0.94334501f, 0.293171108f},
-std::array<float,2>{0.173622549f, 0.757809162f},
-std::array<float,2>{0.836456478f, 0.887250245f},
-std::array<float,2>{0.0686642304f, 0.47343871f},
-std::array<float,2>{0.727784097f, 0.084259294f},
-std::array<float,2>{0.303152561f, 0.657567441f},
-std::array<float,2>{0.531252682f, 0.988796234f},
-std::array<float,2>{0.493439436f, 0.432116628f},
-std::array<float,2>{0.881732881f, 0.0378848985f},
-std::array<float,2>{0.237824023f, 0.730117559f},
-std::array<float,2>{0.812364221f, 0.504986644f},
-std::array<float,2>{0.0409222022f, 0.217395052f},
-std::array<float,2>{0.664273798f, 0.37155053f},
-std::array<float,2>{0.331097394f, 0.827009141f},
-std::array<float,2>{0.704667091f, 0.635551512f},
-std::array<float,2>{0.270493746f, 0.111269929f},
-std::array<float,2>{0.862053454f, 0.443342179f},
-std::array<float,2>{0.0982451886f, 0.924409747f},
-std::array<float,2>{0.995284975f, 0.794031382f},
-std::array<float,2>{0.146167412f, 0.262499869f},
-std::array<float,2>{0.610804319f, 0.169347316f},
-std::array<float,2>{0.400251508f, 0.609058917f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.717244267f, 0.193837836f},
-std::array<float,2>{0.463539362f, 0.59168452f},
-std::array<float,2>{0.81529969f, 0.96915251f},
-std::array<float,2>{0.159109727f, 0.454987794f},
-std::array<float,2>{0.936607003f, 0.269907415f},
-std::array<float,2>{0.102367036f, 0.756579161f},
-std::array<float,2>{0.582250476f, 0.644024193f},
-std::array<float,2>{0.309696108f, 0.0214012768f},
-std::array<float,2>{0.554355025f, 0.377226055f},
-std::array<float,2>{0.323269099f, 0.895275593f},
-std::array<float,2>{0.994242668f, 0.545965135f},
-std::array<float,2>{0.0402886793f, 0.180052638f},
-std::array<float,2>{0.807369769f, 0.11994496f},
-std::array<float,2>{0.214780658f, 0.71463269f},
-std::array<float,2>{0.676388979f, 0.839221597f},
-std::array<float,2>{0.400884449f, 0.341321886f},
-std::array<float,2>{0.613845527f, 0.042546127f},
-std::array<float,2>{0.262916237f, 0.667849243f},
-std::array<float,2>{0.887345374f, 0.812087536f},
-std::array<float,2>{0.0896662548f, 0.298727244f},
-std::array<float,2>{0.857423007f, 0.484642416f},
-std::array<float,2>{0.128647298f, 0.961420834f},
-std::array<float,2>{0.739217699f, 0.598520637f},
-std::array<float,2>{0.483457595f, 0.249094084f},
-std::array<float,2>{0.649060547f, 0.355512887f},
-std::array<float,2>{0.424584806f, 0.847951531f},
-std::array<float,2>{0.753272235f, 0.721881688f},
-std::array<float,2>{0.224723876f, 0.0811356604f},
-std::array<float,2>{0.956662774f, 0.135345757f},
-std::array<float,2>{0.00214732857f, 0.525938451f},
-std::array<float,2>{0.520686567f, 0.922403932f},
-std::array<float,2>{0.371798187f, 0.42650789f},
-std::array<float,2>{0.500217795f, 0.162692502f},
-std::array<float,2>{0.347370684f, 0.557836831f},
-std::array<float,2>{0.944767535f, 0.877822936f},
-std::array<float,2>{0.030449599f, 0.392800152f},
-std::array<float,2>{0.77465266f, 0.3219679f},
-std::array<float,2>{0.239104539f, 0.82505393f},
-std::array<float,2>{0.634907126f, 0.68928504f},
-std::array<float,2>{0.410389721f, 0.108883202f},
-std::array<float,2>{0.721962452f, 0.449418634f},
-std::array<float,2>{0.492325097f, 0.994876921f},
-std::array<float,2>{0.860213518f, 0.566851199f},
-std::array<float,2>{0.155911967f, 0.217178702f},
-std::array<float,2>{0.90072f, 0.0043673492f},
-std::array<float,2>{0.0665569976f, 0.631964803f},
-std::array<float,2>{0.595576584f, 0.768821597f},
-std::array<float,2>{0.271147728f, 0.25683558f},
-std::array<float,2>{0.660456359f, 0.0653865859f},
-std::array<float,2>{0.385576904f, 0.738621831f},
-std::array<float,2>{0.790295601f, 0.863398969f},
-std::array<float,2>{0.193477884f, 0.366626352f},
-std::array<float,2>{0.969047189f, 0.412018985f},
-std::array<float,2>{0.0535000265f, 0.911857843f},
-std::array<float,2>{0.541606009f, 0.502141774f},
-std::array<float,2>{0.342752457f, 0.153231576f},
-std::array<float,2>{0.5735448f, 0.284830958f},
-std::array<float,2>{0.292789429f, 0.789260805f},
-std::array<float,2>{0.921572983f, 0.687161982f},
-std::array<float,2>{0.11969544f, 0.0495673493f},
-std::array<float,2>{0.828337491f, 0.226629362f},
-std::array<float,2>{0.183410719f, 0.619258881f},
-std::array<float,2>{0.691510439f, 0.95260489f},
-std::array<float,2>{0.439005911f, 0.483470947f},
-std::array<float,2>{0.628158927f, 0.143915102f},
-std::array<float,2>{0.419811606f, 0.508401811f},
-std::array<float,2>{0.772647023f, 0.915055335f},
-std::array<float,2>{0.247557431f, 0.419107407f},
-std::array<float,2>{0.948195934f, 0.373655736f},
-std::array<float,2>{0.0175185483f, 0.868051946f},
-std::array<float,2>{0.512454093f, 0.747460783f},
-std::array<float,2>{0.358445108f, 0.0717241094f},
-std::array<float,2>{0.609243631f, 0.472436726f},
-std::array<float,2>{0.277248502f, 0.937700152f},
-std::array<float,2>{0.893141091f, 0.610948145f},
-std::array<float,2>{0.0740674287f, 0.218854591f},
-std::array<float,2>{0.867503822f, 0.0611448586f},
-std::array<float,2>{0.144836411f, 0.672437906f},
-std::array<float,2>{0.73191762f, 0.786601782f},
-std::array<float,2>{0.488547385f, 0.289637178f},
-std::array<float,2>{0.533973515f, 0.0974397212f},
-std::array<float,2>{0.329991102f, 0.695892751f},
-std::array<float,2>{0.981757879f, 0.816494286f},
-std::array<float,2>{0.0591084957f, 0.314534009f},
-std::array<float,2>{0.78332305f, 0.400349021f},
-std::array<float,2>{0.19632633f, 0.885038137f},
-std::array<float,2>{0.664767027f, 0.549742401f},
-std::array<float,2>{0.375603199f, 0.165955663f},
-std::array<float,2>{0.697752893f, 0.264700949f},
-std::array<float,2>{0.4471744f, 0.780929685f},
-std::array<float,2>{0.843668938f, 0.639476836f},
-std::array<float,2>{0.176800624f, 0.0100713084f},
-std::array<float,2>{0.909865677f, 0.203552932f},
-std::array<float,2>{0.116958328f, 0.570870042f},
-std::array<float,2>{0.566383779f, 0.990006924f},
-std::array<float,2>{0.286442846f, 0.440937847f},
-std::array<float,2>{0.592942297f, 0.241404399f},
-std::array<float,2>{0.300671846f, 0.606403708f},
-std::array<float,2>{0.927042365f, 0.95416671f},
-std::array<float,2>{0.100535266f, 0.499713868f},
-std::array<float,2>{0.822465599f, 0.308377385f},
-std::array<float,2>{0.16852209f, 0.803030193f},
-std::array<float,2>{0.704465747f, 0.663343251f},
-std::array<float,2>{0.45470807f, 0.0353616923f},
-std::array<float,2>{0.686428607f, 0.431185126f},
-std::array<float,2>{0.393934578f, 0.930838823f},
-std::array<float,2>{0.799881101f, 0.520964205f},
-std::array<float,2>{0.210927114f, 0.131384954f},
-std::array<float,2>{0.989232123f, 0.0861891955f},
-std::array<float,2>{0.0376826003f, 0.732378602f},
-std::array<float,2>{0.562187731f, 0.857681394f},
-std::array<float,2>{0.317818254f, 0.349955916f},
-std::array<float,2>{0.748991966f, 0.0284808744f},
-std::array<float,2>{0.472654581f, 0.655240536f},
-std::array<float,2>{0.843958676f, 0.761239946f},
-std::array<float,2>{0.135183543f, 0.276929617f},
-std::array<float,2>{0.878116429f, 0.461762041f},
-std::array<float,2>{0.0854562819f, 0.978136182f},
-std::array<float,2>{0.619727075f, 0.581915557f},
-std::array<float,2>{0.254906565f, 0.202554926f},
-std::array<float,2>{0.524641633f, 0.328137755f},
-std::array<float,2>{0.360922337f, 0.82833004f},
-std::array<float,2>{0.966095686f, 0.703460097f},
-std::array<float,2>{0.0148194162f, 0.116557553f},
-std::array<float,2>{0.762173176f, 0.176315382f},
-std::array<float,2>{0.229999527f, 0.535512388f},
-std::array<float,2>{0.643753707f, 0.904844165f},
-std::array<float,2>{0.429851592f, 0.38743785f},
-std::array<float,2>{0.726811349f, 0.184450358f},
-std::array<float,2>{0.486745894f, 0.539849997f},
-std::array<float,2>{0.874549806f, 0.89253968f},
-std::array<float,2>{0.143090844f, 0.379013002f},
-std::array<float,2>{0.894880235f, 0.338602722f},
-std::array<float,2>{0.0780061409f, 0.840219319f},
-std::array<float,2>{0.602222323f, 0.715624452f},
-std::array<float,2>{0.277717054f, 0.121276252f},
-std::array<float,2>{0.510799885f, 0.459022611f},
-std::array<float,2>{0.354029864f, 0.972962737f},
-std::array<float,2>{0.950731874f, 0.589402318f},
-std::array<float,2>{0.0199561864f, 0.188406914f},
-std::array<float,2>{0.766388655f, 0.0163472183f},
-std::array<float,2>{0.242749527f, 0.644755721f},
-std::array<float,2>{0.632065833f, 0.753081739f},
-std::array<float,2>{0.416185588f, 0.267841816f},
-std::array<float,2>{0.567882121f, 0.0835736692f},
-std::array<float,2>{0.284800261f, 0.722887516f},
-std::array<float,2>{0.912363768f, 0.845532596f},
-std::array<float,2>{0.111477129f, 0.353714943f},
-std::array<float,2>{0.836266696f, 0.422996759f},
-std::array<float,2>{0.175456807f, 0.926861644f},
-std::array<float,2>{0.700277627f, 0.529353261f},
-std::array<float,2>{0.452937037f, 0.138822794f},
-std::array<float,2>{0.671509326f, 0.301955998f},
-std::array<float,2>{0.381724715f, 0.807447731f},
-std::array<float,2>{0.786487818f, 0.670794904f},
-std::array<float,2>{0.201756582f, 0.0432946831f},
-std::array<float,2>{0.977535546f, 0.242723972f},
-std::array<float,2>{0.0569920652f, 0.595003247f},
-std::array<float,2>{0.536589503f, 0.9684726f},
-std::array<float,2>{0.333003849f, 0.48848331f},
-std::array<float,2>{0.554751754f, 0.21308054f},
-std::array<float,2>{0.31474486f, 0.565541446f},
-std::array<float,2>{0.984418452f, 0.999435663f},
-std::array<float,2>{0.0315116048f, 0.448953569f},
-std::array<float,2>{0.801283121f, 0.253290445f},
-std::array<float,2>{0.204118788f, 0.772749305f},
-std::array<float,2>{0.681753755f, 0.625171363f},
-std::array<float,2>{0.397447437f, 0.000706570339f},
-std::array<float,2>{0.708119154f, 0.395820081f},
-std::array<float,2>{0.459933639f, 0.879254162f},
-std::array<float,2>{0.826372385f, 0.560084999f},
-std::array<float,2>{0.164240852f, 0.157493785f},
-std::array<float,2>{0.922895968f, 0.105027936f},
-std::array<float,2>{0.0967321768f, 0.693553388f},
-std::array<float,2>{0.586130917f, 0.823966205f},
-std::array<float,2>{0.303469539f, 0.325328499f},
-std::array<float,2>{0.648309648f, 0.0544507392f},
-std::array<float,2>{0.434492439f, 0.682215631f},
-std::array<float,2>{0.760715723f, 0.795030117f},
-std::array<float,2>{0.231736064f, 0.287431359f},
-std::array<float,2>{0.96094209f, 0.479417384f},
-std::array<float,2>{0.0114129549f, 0.948449671f},
-std::array<float,2>{0.527946174f, 0.622716486f},
-std::array<float,2>{0.36443907f, 0.232608512f},
-std::array<float,2>{0.622390091f, 0.36095354f},
-std::array<float,2>{0.253284633f, 0.86208272f},
-std::array<float,2>{0.880230665f, 0.736393213f},
-std::array<float,2>{0.0789742395f, 0.0699157417f},
-std::array<float,2>{0.850689888f, 0.14860785f},
-std::array<float,2>{0.140313491f, 0.505333483f},
-std::array<float,2>{0.744974971f, 0.909936845f},
-std::array<float,2>{0.475860655f, 0.408821613f},
-std::array<float,2>{0.675042331f, 0.223504767f},
-std::array<float,2>{0.403275192f, 0.6135813f},
-std::array<float,2>{0.808923364f, 0.942362368f},
-std::array<float,2>{0.21830605f, 0.4744519f},
-std::array<float,2>{0.998574078f, 0.295670062f},
-std::array<float,2>{0.0459093787f, 0.783588409f},
-std::array<float,2>{0.549999058f, 0.675884366f},
-std::array<float,2>{0.325244784f, 0.054899279f},
-std::array<float,2>{0.581920624f, 0.416373044f},
-std::array<float,2>{0.305465639f, 0.921585262f},
-std::array<float,2>{0.931493163f, 0.512795448f},
-std::array<float,2>{0.10728386f, 0.147107989f},
-std::array<float,2>{0.818319023f, 0.0771212652f},
-std::array<float,2>{0.164019406f, 0.743094027f},
-std::array<float,2>{0.712233305f, 0.8744542f},
-std::array<float,2>{0.465825856f, 0.37000218f},
-std::array<float,2>{0.517748713f, 0.0123669803f},
-std::array<float,2>{0.371052384f, 0.635769129f},
-std::array<float,2>{0.960113883f, 0.775166869f},
-std::array<float,2>{0.00455256831f, 0.261311442f},
-std::array<float,2>{0.756051064f, 0.443638176f},
-std::array<float,2>{0.221390098f, 0.985269308f},
-std::array<float,2>{0.654146671f, 0.575254858f},
-std::array<float,2>{0.428420693f, 0.207320467f},
-std::array<float,2>{0.735960186f, 0.316411942f},
-std::array<float,2>{0.478551716f, 0.816389859f},
-std::array<float,2>{0.854330003f, 0.69987762f},
-std::array<float,2>{0.130292118f, 0.101175219f},
-std::array<float,2>{0.885209382f, 0.168914035f},
-std::array<float,2>{0.0909642428f, 0.554679096f},
-std::array<float,2>{0.613167703f, 0.887376249f},
-std::array<float,2>{0.258139312f, 0.404235542f},
-std::array<float,2>{0.599813104f, 0.125572354f},
-std::array<float,2>{0.267603904f, 0.519429803f},
-std::array<float,2>{0.903544843f, 0.934011877f},
-std::array<float,2>{0.0638873875f, 0.436096281f},
-std::array<float,2>{0.864547133f, 0.346381843f},
-std::array<float,2>{0.149506807f, 0.852556348f},
-std::array<float,2>{0.722753048f, 0.729816198f},
-std::array<float,2>{0.499550641f, 0.0925650448f},
-std::array<float,2>{0.638258636f, 0.494411945f},
-std::array<float,2>{0.408194751f, 0.960686684f},
-std::array<float,2>{0.780884206f, 0.605081558f},
-std::array<float,2>{0.236178324f, 0.23458527f},
-std::array<float,2>{0.93978107f, 0.0348331407f},
-std::array<float,2>{0.024133388f, 0.659960926f},
-std::array<float,2>{0.507080853f, 0.7984671f},
-std::array<float,2>{0.348044217f, 0.311856896f},
-std::array<float,2>{0.689991117f, 0.111946739f},
-std::array<float,2>{0.442506135f, 0.710334659f},
-std::array<float,2>{0.835755587f, 0.833207369f},
-std::array<float,2>{0.185510591f, 0.335866988f},
-std::array<float,2>{0.915791571f, 0.38638857f},
-std::array<float,2>{0.124507934f, 0.898868442f},
-std::array<float,2>{0.57435298f, 0.531350017f},
-std::array<float,2>{0.294360638f, 0.174935952f},
-std::array<float,2>{0.544049025f, 0.277670145f},
-std::array<float,2>{0.337726384f, 0.764443219f},
-std::array<float,2>{0.973030508f, 0.651837587f},
-std::array<float,2>{0.0486930013f, 0.0260709412f},
-std::array<float,2>{0.795790076f, 0.197083071f},
-std::array<float,2>{0.190390572f, 0.582494676f},
-std::array<float,2>{0.658579767f, 0.982532561f},
-std::array<float,2>{0.387459219f, 0.466837168f},
-std::array<float,2>{0.741267979f, 0.247446865f},
-std::array<float,2>{0.481016576f, 0.60004735f},
-std::array<float,2>{0.856004834f, 0.964323521f},
-std::array<float,2>{0.125215918f, 0.487547964f},
-std::array<float,2>{0.890152454f, 0.30044654f},
-std::array<float,2>{0.0860437751f, 0.809777737f},
-std::array<float,2>{0.616701961f, 0.665655911f},
-std::array<float,2>{0.265243232f, 0.0400571674f},
-std::array<float,2>{0.522197604f, 0.429196775f},
-std::array<float,2>{0.374439299f, 0.925266802f},
-std::array<float,2>{0.954490066f, 0.523932993f},
-std::array<float,2>{0.000218295987f, 0.134517804f},
-std::array<float,2>{0.751529396f, 0.079257004f},
-std::array<float,2>{0.223317325f, 0.720194936f},
-std::array<float,2>{0.651972532f, 0.851048768f},
-std::array<float,2>{0.422558159f, 0.357921511f},
-std::array<float,2>{0.585869908f, 0.0230576247f},
-std::array<float,2>{0.311494261f, 0.640733957f},
-std::array<float,2>{0.934528053f, 0.755553186f},
-std::array<float,2>{0.104461141f, 0.27320537f},
-std::array<float,2>{0.813827276f, 0.456197053f},
-std::array<float,2>{0.15660727f, 0.97087431f},
-std::array<float,2>{0.71595186f, 0.593695879f},
-std::array<float,2>{0.462748647f, 0.191883937f},
-std::array<float,2>{0.679170251f, 0.34272176f},
-std::array<float,2>{0.400109619f, 0.837222159f},
-std::array<float,2>{0.805207193f, 0.712417901f},
-std::array<float,2>{0.210942224f, 0.117542893f},
-std::array<float,2>{0.994100511f, 0.183167413f},
-std::array<float,2>{0.0418831557f, 0.54340142f},
-std::array<float,2>{0.551983595f, 0.897963345f},
-std::array<float,2>{0.321269363f, 0.375825912f},
-std::array<float,2>{0.539792061f, 0.156042531f},
-std::array<float,2>{0.3405433f, 0.501827061f},
-std::array<float,2>{0.970934033f, 0.912388563f},
-std::array<float,2>{0.0526980497f, 0.412638366f},
-std::array<float,2>{0.791666031f, 0.363925815f},
-std::array<float,2>{0.19277662f, 0.866047561f},
-std::array<float,2>{0.663844645f, 0.740665734f},
-std::array<float,2>{0.383611619f, 0.0638365969f},
-std::array<float,2>{0.693695605f, 0.481282622f},
-std::array<float,2>{0.44018653f, 0.950643659f},
-std::array<float,2>{0.831689417f, 0.618572533f},
-std::array<float,2>{0.180831611f, 0.228587255f},
-std::array<float,2>{0.917978466f, 0.0477087647f},
-std::array<float,2>{0.11796312f, 0.684098184f},
-std::array<float,2>{0.571553648f, 0.7922768f},
-std::array<float,2>{0.290917546f, 0.282367915f},
-std::array<float,2>{0.632977486f, 0.107320122f},
-std::array<float,2>{0.413479716f, 0.690551281f},
-std::array<float,2>{0.776971638f, 0.826192975f},
-std::array<float,2>{0.241364315f, 0.323186547f},
-std::array<float,2>{0.94260174f, 0.39192456f},
-std::array<float,2>{0.0286528282f, 0.875302434f},
-std::array<float,2>{0.503635168f, 0.55517447f},
-std::array<float,2>{0.345253795f, 0.161343053f},
-std::array<float,2>{0.59639436f, 0.254264802f},
-std::array<float,2>{0.271746516f, 0.765948057f},
-std::array<float,2>{0.8988778f, 0.629452288f},
-std::array<float,2>{0.0701967105f, 0.00747144036f},
-std::array<float,2>{0.862747788f, 0.216560677f},
-std::array<float,2>{0.15348576f, 0.56967324f},
-std::array<float,2>{0.719692111f, 0.994137406f},
-std::array<float,2>{0.495608896f, 0.452768534f},
-std::array<float,2>{0.666317523f, 0.167743266f},
-std::array<float,2>{0.377520055f, 0.548192441f},
-std::array<float,2>{0.781326711f, 0.883711457f},
-std::array<float,2>{0.199057549f, 0.40138188f},
-std::array<float,2>{0.983918369f, 0.314434975f},
-std::array<float,2>{0.0606803f, 0.818392277f},
-std::array<float,2>{0.532367468f, 0.697405815f},
-std::array<float,2>{0.331295699f, 0.0943114832f},
-std::array<float,2>{0.562946916f, 0.437541515f},
-std::array<float,2>{0.287210494f, 0.990651786f},
-std::array<float,2>{0.907655656f, 0.573298872f},
-std::array<float,2>{0.11368636f, 0.205794439f},
-std::array<float,2>{0.841040909f, 0.0078635281f},
-std::array<float,2>{0.179060638f, 0.636972129f},
-std::array<float,2>{0.696027756f, 0.778860569f},
-std::array<float,2>{0.449192852f, 0.262754351f},
-std::array<float,2>{0.515395164f, 0.0722825602f},
-std::array<float,2>{0.355808914f, 0.748770535f},
-std::array<float,2>{0.945482075f, 0.870002747f},
-std::array<float,2>{0.0182146039f, 0.371764749f},
-std::array<float,2>{0.770250857f, 0.421500236f},
-std::array<float,2>{0.248936564f, 0.917372286f},
-std::array<float,2>{0.625920296f, 0.510758281f},
-std::array<float,2>{0.42079705f, 0.141535699f},
-std::array<float,2>{0.732931614f, 0.292543054f},
-std::array<float,2>{0.490550637f, 0.787351489f},
-std::array<float,2>{0.869453669f, 0.675561905f},
-std::array<float,2>{0.146875829f, 0.0602056384f},
-std::array<float,2>{0.891941428f, 0.221672118f},
-std::array<float,2>{0.0708791167f, 0.613241851f},
-std::array<float,2>{0.606683612f, 0.939903855f},
-std::array<float,2>{0.27399534f, 0.469152153f},
-std::array<float,2>{0.617222428f, 0.199973688f},
-std::array<float,2>{0.256594986f, 0.578954697f},
-std::array<float,2>{0.876734614f, 0.980004907f},
-std::array<float,2>{0.0832621679f, 0.464828044f},
-std::array<float,2>{0.847052991f, 0.273638785f},
-std::array<float,2>{0.133727014f, 0.759154975f},
-std::array<float,2>{0.747519135f, 0.652845681f},
-std::array<float,2>{0.469418347f, 0.0298213623f},
-std::array<float,2>{0.642200589f, 0.388906986f},
-std::array<float,2>{0.432698101f, 0.902661443f},
-std::array<float,2>{0.764711559f, 0.538117528f},
-std::array<float,2>{0.227416113f, 0.178458661f},
-std::array<float,2>{0.966835678f, 0.114698701f},
-std::array<float,2>{0.0129536595f, 0.706760228f},
-std::array<float,2>{0.526409566f, 0.830479741f},
-std::array<float,2>{0.361682743f, 0.331086308f},
-std::array<float,2>{0.706469953f, 0.0381295234f},
-std::array<float,2>{0.455242693f, 0.660962701f},
-std::array<float,2>{0.821197689f, 0.800963819f},
-std::array<float,2>{0.171535254f, 0.305796415f},
-std::array<float,2>{0.929061353f, 0.496917963f},
-std::array<float,2>{0.0986848101f, 0.956354082f},
-std::array<float,2>{0.590598702f, 0.608445466f},
-std::array<float,2>{0.298306435f, 0.238768578f},
-std::array<float,2>{0.559558511f, 0.348015159f},
-std::array<float,2>{0.31949982f, 0.857213855f},
-std::array<float,2>{0.991288304f, 0.734305739f},
-std::array<float,2>{0.0362072438f, 0.0893945247f},
-std::array<float,2>{0.798313975f, 0.130792752f},
-std::array<float,2>{0.208936438f, 0.523414075f},
-std::array<float,2>{0.685200036f, 0.932834685f},
-std::array<float,2>{0.392539024f, 0.431804895f},
-std::array<float,2>{0.702927172f, 0.136842936f},
-std::array<float,2>{0.450281233f, 0.528514922f},
-std::array<float,2>{0.838401139f, 0.929197192f},
-std::array<float,2>{0.173600122f, 0.424663067f},
-std::array<float,2>{0.910570502f, 0.352081507f},
-std::array<float,2>{0.1105453f, 0.846785128f},
-std::array<float,2>{0.569691002f, 0.726491809f},
-std::array<float,2>{0.281957656f, 0.0853351206f},
-std::array<float,2>{0.537435055f, 0.491670638f},
-std::array<float,2>{0.33565253f, 0.96503377f},
-std::array<float,2>{0.979142189f, 0.596384108f},
-std::array<float,2>{0.0549690723f, 0.244878009f},
-std::array<float,2>{0.787458479f, 0.0455135852f},
-std::array<float,2>{0.200896949f, 0.668616414f},
-std::array<float,2>{0.668788552f, 0.80627048f},
-std::array<float,2>{0.379428118f, 0.302830726f},
-std::array<float,2>{0.603517592f, 0.12379016f},
-std::array<float,2>{0.279626787f, 0.718023896f},
-std::array<float,2>{0.898346126f, 0.843566358f},
-std::array<float,2>{0.0743141174f, 0.336562395f},
-std::array<float,2>{0.871672869f, 0.381210059f},
-std::array<float,2>{0.141903803f, 0.893271983f},
-std::array<float,2>{0.729342878f, 0.542821288f},
-std::array<float,2>{0.485446393f, 0.186119124f},
-std::array<float,2>{0.629475951f, 0.266588867f},
-std::array<float,2>{0.414405018f, 0.750310957f},
-std::array<float,2>{0.769036472f, 0.647242486f},
-std::array<float,2>{0.24427399f, 0.0185117871f},
-std::array<float,2>{0.952419043f, 0.190146804f},
-std::array<float,2>{0.0220809579f, 0.587705851f},
-std::array<float,2>{0.508718073f, 0.975281775f},
-std::array<float,2>{0.352049291f, 0.458233058f},
-std::array<float,2>{0.530276537f, 0.230754882f},
-std::array<float,2>{0.366512388f, 0.623179793f},
-std::array<float,2>{0.963248014f, 0.94618398f},
-std::array<float,2>{0.00800161995f, 0.477820784f},
-std::array<float,2>{0.758843958f, 0.285191387f},
-std::array<float,2>{0.234346852f, 0.793438375f},
-std::array<float,2>{0.644684792f, 0.680180132f},
-std::array<float,2>{0.436719716f, 0.0524322651f},
-std::array<float,2>{0.743732333f, 0.408036321f},
-std::array<float,2>{0.47360605f, 0.907351732f},
-std::array<float,2>{0.848130643f, 0.507313132f},
-std::array<float,2>{0.138144463f, 0.151340544f},
-std::array<float,2>{0.881165862f, 0.0679105148f},
-std::array<float,2>{0.0806140155f, 0.735908806f},
-std::array<float,2>{0.624944627f, 0.859724224f},
-std::array<float,2>{0.250448346f, 0.362144202f},
-std::array<float,2>{0.680888534f, 0.00234735967f},
-std::array<float,2>{0.394868672f, 0.628890038f},
-std::array<float,2>{0.80300492f, 0.769985259f},
-std::array<float,2>{0.206752196f, 0.250113517f},
-std::array<float,2>{0.986878872f, 0.445509911f},
-std::array<float,2>{0.0340100862f, 0.997274041f},
-std::array<float,2>{0.557991982f, 0.563797355f},
-std::array<float,2>{0.314300835f, 0.211452037f},
-std::array<float,2>{0.589586735f, 0.328114122f},
-std::array<float,2>{0.301965475f, 0.820774376f},
-std::array<float,2>{0.924028158f, 0.693197131f},
-std::array<float,2>{0.0940761417f, 0.10313414f},
-std::array<float,2>{0.824265599f, 0.159027085f},
-std::array<float,2>{0.166193172f, 0.561604023f},
-std::array<float,2>{0.710865796f, 0.881785631f},
-std::array<float,2>{0.45773086f, 0.398421496f},
-std::array<float,2>{0.655950129f, 0.209929869f},
-std::array<float,2>{0.426921368f, 0.576984704f},
-std::array<float,2>{0.755253971f, 0.987964988f},
-std::array<float,2>{0.219902739f, 0.443009734f},
-std::array<float,2>{0.958261132f, 0.259722859f},
-std::array<float,2>{0.00660201628f, 0.776627481f},
-std::array<float,2>{0.517190576f, 0.634417474f},
-std::array<float,2>{0.36765936f, 0.0147865908f},
-std::array<float,2>{0.60958457f, 0.405239642f},
-std::array<float,2>{0.260599464f, 0.889640391f},
-std::array<float,2>{0.883403122f, 0.551239908f},
-std::array<float,2>{0.0930956528f, 0.171813682f},
-std::array<float,2>{0.851673484f, 0.0981965512f},
-std::array<float,2>{0.131173447f, 0.702778459f},
-std::array<float,2>{0.73737818f, 0.812519729f},
-std::array<float,2>{0.477445304f, 0.318957448f},
-std::array<float,2>{0.548044801f, 0.0573098734f},
-std::array<float,2>{0.327073187f, 0.67895025f},
-std::array<float,2>{0.996251166f, 0.782152116f},
-std::array<float,2>{0.0442075729f, 0.293615788f},
-std::array<float,2>{0.81219089f, 0.475199014f},
-std::array<float,2>{0.215195447f, 0.945175946f},
-std::array<float,2>{0.672160983f, 0.616940439f},
-std::array<float,2>{0.404431492f, 0.225444466f},
-std::array<float,2>{0.713286221f, 0.369097263f},
-std::array<float,2>{0.467986912f, 0.872078478f},
-std::array<float,2>{0.818841577f, 0.744414687f},
-std::array<float,2>{0.160596892f, 0.0757562518f},
-std::array<float,2>{0.932556033f, 0.14454022f},
-std::array<float,2>{0.107665017f, 0.514349639f},
-std::array<float,2>{0.578244209f, 0.918874264f},
-std::array<float,2>{0.306955874f, 0.41561535f},
-std::array<float,2>{0.577779353f, 0.173814282f},
-std::array<float,2>{0.295100272f, 0.534040928f},
-std::array<float,2>{0.917903125f, 0.901013434f},
-std::array<float,2>{0.122766167f, 0.383626461f},
-std::array<float,2>{0.83336252f, 0.333850145f},
-std::array<float,2>{0.187265694f, 0.834001899f},
-std::array<float,2>{0.688113868f, 0.708345592f},
-std::array<float,2>{0.444139719f, 0.110043168f},
-std::array<float,2>{0.657707453f, 0.465352178f},
-std::array<float,2>{0.388957113f, 0.981346786f},
-std::array<float,2>{0.793712795f, 0.585056186f},
-std::array<float,2>{0.188355207f, 0.199207917f},
-std::array<float,2>{0.975743771f, 0.0247152764f},
-std::array<float,2>{0.0505259633f, 0.64895308f},
-std::array<float,2>{0.546467006f, 0.762859464f},
-std::array<float,2>{0.339671224f, 0.280224442f},
-std::array<float,2>{0.725800097f, 0.0913393795f},
-std::array<float,2>{0.497232914f, 0.726850033f},
-std::array<float,2>{0.86689496f, 0.854562163f},
-std::array<float,2>{0.150580555f, 0.343962401f},
-std::array<float,2>{0.90514648f, 0.434591174f},
-std::array<float,2>{0.0659628659f, 0.937263727f},
-std::array<float,2>{0.597688675f, 0.516498923f},
-std::array<float,2>{0.26565811f, 0.127913296f},
-std::array<float,2>{0.504313409f, 0.309208333f},
-std::array<float,2>{0.350952685f, 0.799749911f},
-std::array<float,2>{0.939223647f, 0.657859683f},
-std::array<float,2>{0.0264936108f, 0.0319657847f},
-std::array<float,2>{0.777938426f, 0.237822264f},
-std::array<float,2>{0.238088146f, 0.603217125f},
-std::array<float,2>{0.640152574f, 0.957601666f},
-std::array<float,2>{0.40933758f, 0.492388606f},
-std::array<float,2>{0.72055167f, 0.218614236f},
-std::array<float,2>{0.494681954f, 0.567956746f},
-std::array<float,2>{0.862003446f, 0.995597064f},
-std::array<float,2>{0.152651608f, 0.450549841f},
-std::array<float,2>{0.90020597f, 0.257684469f},
-std::array<float,2>{0.0691066608f, 0.767666757f},
-std::array<float,2>{0.596780777f, 0.631158412f},
-std::array<float,2>{0.27338469f, 0.00544921774f},
-std::array<float,2>{0.502049208f, 0.394123822f},
-std::array<float,2>{0.344096631f, 0.878119111f},
-std::array<float,2>{0.941744983f, 0.557071924f},
-std::array<float,2>{0.0275727753f, 0.163974047f},
-std::array<float,2>{0.775542915f, 0.107637659f},
-std::array<float,2>{0.240604952f, 0.688368261f},
-std::array<float,2>{0.634304285f, 0.825610816f},
-std::array<float,2>{0.412237048f, 0.321037233f},
-std::array<float,2>{0.570473552f, 0.0503007881f},
-std::array<float,2>{0.289107174f, 0.685824037f},
-std::array<float,2>{0.919756949f, 0.790304959f},
-std::array<float,2>{0.118646875f, 0.284174144f},
-std::array<float,2>{0.831044018f, 0.483208597f},
-std::array<float,2>{0.180608153f, 0.951717794f},
-std::array<float,2>{0.694599032f, 0.620188177f},
-std::array<float,2>{0.440934211f, 0.22824654f},
-std::array<float,2>{0.6629529f, 0.365615547f},
-std::array<float,2>{0.384410352f, 0.864311635f},
-std::array<float,2>{0.792317212f, 0.739533365f},
-std::array<float,2>{0.192255005f, 0.0660553426f},
-std::array<float,2>{0.972418129f, 0.15394485f},
-std::array<float,2>{0.0513968989f, 0.503221452f},
-std::array<float,2>{0.540209472f, 0.910723686f},
-std::array<float,2>{0.341765225f, 0.410277337f},
-std::array<float,2>{0.551585078f, 0.181408077f},
-std::array<float,2>{0.321464062f, 0.545220613f},
-std::array<float,2>{0.992711425f, 0.895680964f},
-std::array<float,2>{0.0427474305f, 0.377945453f},
-std::array<float,2>{0.805774212f, 0.34057039f},
-std::array<float,2>{0.21202597f, 0.838020682f},
-std::array<float,2>{0.678079367f, 0.71334362f},
-std::array<float,2>{0.399015605f, 0.12091554f},
-std::array<float,2>{0.714969933f, 0.453722835f},
-std::array<float,2>{0.461389929f, 0.969892144f},
-std::array<float,2>{0.812670112f, 0.589885414f},
-std::array<float,2>{0.158042341f, 0.195236504f},
-std::array<float,2>{0.934999466f, 0.020420121f},
-std::array<float,2>{0.105295844f, 0.642661154f},
-std::array<float,2>{0.584366798f, 0.75715822f},
-std::array<float,2>{0.312444389f, 0.270984709f},
-std::array<float,2>{0.651301205f, 0.0807732344f},
-std::array<float,2>{0.423306525f, 0.721511066f},
-std::array<float,2>{0.750879705f, 0.849441946f},
-std::array<float,2>{0.224049434f, 0.357075363f},
-std::array<float,2>{0.953366399f, 0.42708087f},
-std::array<float,2>{0.0017543931f, 0.923115194f},
-std::array<float,2>{0.523183882f, 0.526830196f},
-std::array<float,2>{0.373551071f, 0.136200011f},
-std::array<float,2>{0.61598593f, 0.29763636f},
-std::array<float,2>{0.263682783f, 0.81097436f},
-std::array<float,2>{0.889425993f, 0.666653514f},
-std::array<float,2>{0.0871295929f, 0.0417489447f},
-std::array<float,2>{0.857102394f, 0.248408198f},
-std::array<float,2>{0.126718313f, 0.598932981f},
-std::array<float,2>{0.74102664f, 0.962386787f},
-std::array<float,2>{0.481877178f, 0.486062497f},
-std::array<float,2>{0.683663666f, 0.131968603f},
-std::array<float,2>{0.391456544f, 0.519965827f},
-std::array<float,2>{0.797183871f, 0.929929078f},
-std::array<float,2>{0.207833797f, 0.430329144f},
-std::array<float,2>{0.990620077f, 0.350975245f},
-std::array<float,2>{0.0353853144f, 0.858881593f},
-std::array<float,2>{0.560198426f, 0.730729997f},
-std::array<float,2>{0.318881541f, 0.0878236964f},
-std::array<float,2>{0.591375411f, 0.498785228f},
-std::array<float,2>{0.296988577f, 0.953686535f},
-std::array<float,2>{0.928349733f, 0.606823206f},
-std::array<float,2>{0.0979100615f, 0.240631461f},
-std::array<float,2>{0.822163343f, 0.0364721529f},
-std::array<float,2>{0.170633659f, 0.662341893f},
-std::array<float,2>{0.705306411f, 0.804127753f},
-std::array<float,2>{0.456374615f, 0.307545453f},
-std::array<float,2>{0.526120961f, 0.115863889f},
-std::array<float,2>{0.363270253f, 0.705016732f},
-std::array<float,2>{0.967930555f, 0.829557002f},
-std::array<float,2>{0.0121115521f, 0.330058843f},
-std::array<float,2>{0.764644802f, 0.388180077f},
-std::array<float,2>{0.227766573f, 0.905483186f},
-std::array<float,2>{0.641584098f, 0.536510766f},
-std::array<float,2>{0.432557613f, 0.177178398f},
-std::array<float,2>{0.746631265f, 0.276119202f},
-std::array<float,2>{0.470449179f, 0.760057509f},
-std::array<float,2>{0.846009016f, 0.655884504f},
-std::array<float,2>{0.13398841f, 0.0282399803f},
-std::array<float,2>{0.875926137f, 0.201943561f},
-std::array<float,2>{0.0826822817f, 0.580438435f},
-std::array<float,2>{0.618649662f, 0.976642489f},
-std::array<float,2>{0.257698596f, 0.462168187f},
-std::array<float,2>{0.605970383f, 0.220065266f},
-std::array<float,2>{0.274922311f, 0.609735429f},
-std::array<float,2>{0.890872359f, 0.939397633f},
-std::array<float,2>{0.0713068992f, 0.471546739f},
-std::array<float,2>{0.870919287f, 0.290102035f},
-std::array<float,2>{0.147868097f, 0.785256326f},
-std::array<float,2>{0.734178364f, 0.673443973f},
-std::array<float,2>{0.491971433f, 0.061989814f},
-std::array<float,2>{0.626164377f, 0.418442756f},
-std::array<float,2>{0.421180308f, 0.914765477f},
-std::array<float,2>{0.771262825f, 0.509626687f},
-std::array<float,2>{0.249988526f, 0.142683178f},
-std::array<float,2>{0.947185457f, 0.0711902231f},
-std::array<float,2>{0.0191428997f, 0.746868432f},
-std::array<float,2>{0.514076114f, 0.868658364f},
-std::array<float,2>{0.356657267f, 0.374493361f},
-std::array<float,2>{0.696561217f, 0.0113909105f},
-std::array<float,2>{0.448048323f, 0.640524447f},
-std::array<float,2>{0.840373814f, 0.779935122f},
-std::array<float,2>{0.177977696f, 0.26437211f},
-std::array<float,2>{0.906721532f, 0.439546674f},
-std::array<float,2>{0.115156926f, 0.9883008f},
-std::array<float,2>{0.564036846f, 0.571666956f},
-std::array<float,2>{0.28856945f, 0.204876035f},
-std::array<float,2>{0.531773567f, 0.316213101f},
-std::array<float,2>{0.330398649f, 0.817983866f},
-std::array<float,2>{0.982618809f, 0.696381509f},
-std::array<float,2>{0.0616658591f, 0.0966009051f},
-std::array<float,2>{0.782742262f, 0.164098948f},
-std::array<float,2>{0.197480366f, 0.550706923f},
-std::array<float,2>{0.667959511f, 0.886490345f},
-std::array<float,2>{0.378829926f, 0.399038881f},
-std::array<float,2>{0.709157228f, 0.156894997f},
-std::array<float,2>{0.4583911f, 0.559323907f},
-std::array<float,2>{0.825937331f, 0.879931808f},
-std::array<float,2>{0.167778835f, 0.395178854f},
-std::array<float,2>{0.925655723f, 0.324715346f},
-std::array<float,2>{0.0956864133f, 0.822347343f},
-std::array<float,2>{0.588727415f, 0.694681048f},
-std::array<float,2>{0.301046282f, 0.104170516f},
-std::array<float,2>{0.557548404f, 0.448144764f},
-std::array<float,2>{0.31287986f, 0.999010026f},
-std::array<float,2>{0.988022923f, 0.564931571f},
-std::array<float,2>{0.0342794508f, 0.214829862f},
-std::array<float,2>{0.804004014f, 0.00148579245f},
-std::array<float,2>{0.205693305f, 0.626621246f},
-std::array<float,2>{0.680242419f, 0.771522582f},
-std::array<float,2>{0.396032661f, 0.252321213f},
-std::array<float,2>{0.623954713f, 0.0686501265f},
-std::array<float,2>{0.25122577f, 0.73816669f},
-std::array<float,2>{0.881875575f, 0.862691462f},
-std::array<float,2>{0.0819856152f, 0.359499663f},
-std::array<float,2>{0.849388659f, 0.409417421f},
-std::array<float,2>{0.137309998f, 0.908500612f},
-std::array<float,2>{0.742630661f, 0.504849851f},
-std::array<float,2>{0.4738774f, 0.149538651f},
-std::array<float,2>{0.646007061f, 0.288784534f},
-std::array<float,2>{0.436487436f, 0.796704888f},
-std::array<float,2>{0.758377075f, 0.682822347f},
-std::array<float,2>{0.232458845f, 0.0531044863f},
-std::array<float,2>{0.96400094f, 0.23378174f},
-std::array<float,2>{0.00939622801f, 0.622018695f},
-std::array<float,2>{0.530229926f, 0.94746995f},
-std::array<float,2>{0.365450859f, 0.480051428f},
-std::array<float,2>{0.509128332f, 0.189327016f},
-std::array<float,2>{0.353495568f, 0.588561893f},
-std::array<float,2>{0.951228976f, 0.973634422f},
-std::array<float,2>{0.0227922779f, 0.460526496f},
-std::array<float,2>{0.768261254f, 0.268585056f},
-std::array<float,2>{0.246067822f, 0.752123952f},
-std::array<float,2>{0.630254686f, 0.645555258f},
-std::array<float,2>{0.415347964f, 0.0167730041f},
-std::array<float,2>{0.729581356f, 0.380242944f},
-std::array<float,2>{0.485022157f, 0.891318977f},
-std::array<float,2>{0.872526705f, 0.540265024f},
-std::array<float,2>{0.141110897f, 0.185376391f},
-std::array<float,2>{0.896636546f, 0.122208916f},
-std::array<float,2>{0.0755008534f, 0.716209531f},
-std::array<float,2>{0.604619741f, 0.84124285f},
-std::array<float,2>{0.280653387f, 0.339783281f},
-std::array<float,2>{0.669440269f, 0.0445039682f},
-std::array<float,2>{0.380027324f, 0.671432197f},
-std::array<float,2>{0.788393676f, 0.808301091f},
-std::array<float,2>{0.199475467f, 0.301176637f},
-std::array<float,2>{0.98022157f, 0.490024954f},
-std::array<float,2>{0.0558627695f, 0.96681416f},
-std::array<float,2>{0.538332939f, 0.594344318f},
-std::array<float,2>{0.334026307f, 0.243445337f},
-std::array<float,2>{0.568479121f, 0.354751348f},
-std::array<float,2>{0.283178926f, 0.844710231f},
-std::array<float,2>{0.911364138f, 0.724134207f},
-std::array<float,2>{0.11010354f, 0.0830011442f},
-std::array<float,2>{0.839581192f, 0.139937326f},
-std::array<float,2>{0.172072068f, 0.530807972f},
-std::array<float,2>{0.702014625f, 0.926015615f},
-std::array<float,2>{0.449701428f, 0.421933502f},
-std::array<float,2>{0.639313996f, 0.236196101f},
-std::array<float,2>{0.409109771f, 0.603876591f},
-std::array<float,2>{0.778346598f, 0.959244132f},
-std::array<float,2>{0.236915395f, 0.495268077f},
-std::array<float,2>{0.93765074f, 0.310989201f},
-std::array<float,2>{0.0262275171f, 0.797382653f},
-std::array<float,2>{0.505378008f, 0.658332944f},
-std::array<float,2>{0.35029462f, 0.0333299898f},
-std::array<float,2>{0.59940052f, 0.437375218f},
-std::array<float,2>{0.267349154f, 0.934766829f},
-std::array<float,2>{0.905586958f, 0.517851114f},
-std::array<float,2>{0.0647605732f, 0.126476079f},
-std::array<float,2>{0.865274608f, 0.0932870135f},
-std::array<float,2>{0.151380703f, 0.728627741f},
-std::array<float,2>{0.725205064f, 0.851879537f},
-std::array<float,2>{0.496290684f, 0.347503841f},
-std::array<float,2>{0.545402646f, 0.0266920552f},
-std::array<float,2>{0.338609964f, 0.650814891f},
-std::array<float,2>{0.975369394f, 0.764985621f},
-std::array<float,2>{0.0492607243f, 0.278550535f},
-std::array<float,2>{0.794071972f, 0.467801243f},
-std::array<float,2>{0.189118057f, 0.984358788f},
-std::array<float,2>{0.656602561f, 0.583864331f},
-std::array<float,2>{0.389935613f, 0.196283117f},
-std::array<float,2>{0.688905358f, 0.334089607f},
-std::array<float,2>{0.445063919f, 0.832898378f},
-std::array<float,2>{0.832312107f, 0.709839344f},
-std::array<float,2>{0.186517537f, 0.113044456f},
-std::array<float,2>{0.916435957f, 0.173876926f},
-std::array<float,2>{0.121252798f, 0.532849729f},
-std::array<float,2>{0.576914966f, 0.899454057f},
-std::array<float,2>{0.296823114f, 0.385509968f},
-std::array<float,2>{0.579578698f, 0.148294091f},
-std::array<float,2>{0.307806849f, 0.512614727f},
-std::array<float,2>{0.93293488f, 0.920845866f},
-std::array<float,2>{0.109189011f, 0.417556435f},
-std::array<float,2>{0.820230424f, 0.370657146f},
-std::array<float,2>{0.162107617f, 0.873990536f},
-std::array<float,2>{0.714609146f, 0.743385494f},
-std::array<float,2>{0.467274219f, 0.0776182115f},
-std::array<float,2>{0.673543274f, 0.473571509f},
-std::array<float,2>{0.405623019f, 0.942413211f},
-std::array<float,2>{0.811112642f, 0.615088642f},
-std::array<float,2>{0.215927705f, 0.224030003f},
-std::array<float,2>{0.997555673f, 0.0562974364f},
-std::array<float,2>{0.0431747846f, 0.677117348f},
-std::array<float,2>{0.547543168f, 0.784358621f},
-std::array<float,2>{0.327938884f, 0.296132565f},
-std::array<float,2>{0.736599505f, 0.100340255f},
-std::array<float,2>{0.478289247f, 0.700986922f},
-std::array<float,2>{0.853510857f, 0.815024614f},
-std::array<float,2>{0.132571146f, 0.317583352f},
-std::array<float,2>{0.883972704f, 0.403208494f},
-std::array<float,2>{0.0923269019f, 0.888380527f},
-std::array<float,2>{0.610912919f, 0.553290963f},
-std::array<float,2>{0.261130154f, 0.16925402f},
-std::array<float,2>{0.515822411f, 0.260709822f},
-std::array<float,2>{0.369025677f, 0.774207771f},
-std::array<float,2>{0.957746387f, 0.635233998f},
-std::array<float,2>{0.00757487677f, 0.0133472579f},
-std::array<float,2>{0.7542032f, 0.20808427f},
-std::array<float,2>{0.219666481f, 0.575170159f},
-std::array<float,2>{0.65498668f, 0.985404849f},
-std::array<float,2>{0.426166505f, 0.444625735f},
-std::array<float,2>{0.692387938f, 0.229889393f},
-std::array<float,2>{0.438046157f, 0.617943108f},
-std::array<float,2>{0.829559028f, 0.950140655f},
-std::array<float,2>{0.18191655f, 0.48202619f},
-std::array<float,2>{0.920724511f, 0.28222394f},
-std::array<float,2>{0.120766155f, 0.791249037f},
-std::array<float,2>{0.573071301f, 0.685121298f},
-std::array<float,2>{0.291639805f, 0.0479478724f},
-std::array<float,2>{0.542712092f, 0.413525075f},
-std::array<float,2>{0.342797041f, 0.913910449f},
-std::array<float,2>{0.970416725f, 0.500869155f},
-std::array<float,2>{0.0546299517f, 0.154508427f},
-std::array<float,2>{0.78927654f, 0.0627589449f},
-std::array<float,2>{0.194562867f, 0.741239905f},
-std::array<float,2>{0.662058055f, 0.866384506f},
-std::array<float,2>{0.386640429f, 0.364344835f},
-std::array<float,2>{0.593806624f, 0.00603445154f},
-std::array<float,2>{0.270366073f, 0.630124271f},
-std::array<float,2>{0.901767194f, 0.767428398f},
-std::array<float,2>{0.0676845163f, 0.255803108f},
-std::array<float,2>{0.860903323f, 0.451243788f},
-std::array<float,2>{0.15443854f, 0.992859542f},
-std::array<float,2>{0.721044362f, 0.568806112f},
-std::array<float,2>{0.493319899f, 0.214867979f},
-std::array<float,2>{0.636425078f, 0.323417991f},
-std::array<float,2>{0.411840141f, 0.827567577f},
-std::array<float,2>{0.773489654f, 0.689711809f},
-std::array<float,2>{0.239385545f, 0.106250323f},
-std::array<float,2>{0.943789899f, 0.161044747f},
-std::array<float,2>{0.0300691593f, 0.555879235f},
-std::array<float,2>{0.501810193f, 0.876049101f},
-std::array<float,2>{0.34619689f, 0.390636146f},
-std::array<float,2>{0.520423651f, 0.133583277f},
-std::array<float,2>{0.372562647f, 0.524753153f},
-std::array<float,2>{0.955680609f, 0.924282134f},
-std::array<float,2>{0.00304454169f, 0.428125143f},
-std::array<float,2>{0.75280875f, 0.358841658f},
-std::array<float,2>{0.225855425f, 0.850058556f},
-std::array<float,2>{0.650350809f, 0.719234884f},
-std::array<float,2>{0.425449044f, 0.078256689f},
-std::array<float,2>{0.739987195f, 0.486700326f},
-std::array<float,2>{0.48276794f, 0.963303983f},
-std::array<float,2>{0.858889997f, 0.601495206f},
-std::array<float,2>{0.127864927f, 0.246473834f},
-std::array<float,2>{0.888130724f, 0.0392870344f},
-std::array<float,2>{0.0885360613f, 0.664198995f},
-std::array<float,2>{0.615221262f, 0.809337735f},
-std::array<float,2>{0.262602389f, 0.299663603f},
-std::array<float,2>{0.676833093f, 0.118223622f},
-std::array<float,2>{0.401379764f, 0.71141392f},
-std::array<float,2>{0.808066666f, 0.836102843f},
-std::array<float,2>{0.213315964f, 0.343498647f},
-std::array<float,2>{0.995766938f, 0.376099944f},
-std::array<float,2>{0.0396223217f, 0.896969616f},
-std::array<float,2>{0.553669035f, 0.544884562f},
-std::array<float,2>{0.323188037f, 0.181817472f},
-std::array<float,2>{0.583295047f, 0.271930635f},
-std::array<float,2>{0.309179366f, 0.753959537f},
-std::array<float,2>{0.935863614f, 0.641861081f},
-std::array<float,2>{0.103485405f, 0.0217117164f},
-std::array<float,2>{0.816352963f, 0.192912593f},
-std::array<float,2>{0.159230754f, 0.591873348f},
-std::array<float,2>{0.717916787f, 0.972630024f},
-std::array<float,2>{0.464320034f, 0.455476224f},
-std::array<float,2>{0.642750502f, 0.179353476f},
-std::array<float,2>{0.431229323f, 0.53725034f},
-std::array<float,2>{0.762833476f, 0.90336144f},
-std::array<float,2>{0.229413807f, 0.390146375f},
-std::array<float,2>{0.965603232f, 0.330503643f},
-std::array<float,2>{0.0144987525f, 0.83120966f},
-std::array<float,2>{0.523854613f, 0.705374479f},
-std::array<float,2>{0.359985888f, 0.114076592f},
-std::array<float,2>{0.620405674f, 0.463621467f},
-std::array<float,2>{0.253910094f, 0.979015112f},
-std::array<float,2>{0.877265155f, 0.579930007f},
-std::array<float,2>{0.0849070102f, 0.200766832f},
-std::array<float,2>{0.845163584f, 0.031042859f},
-std::array<float,2>{0.136241153f, 0.653571069f},
-std::array<float,2>{0.749345303f, 0.757903397f},
-std::array<float,2>{0.470889479f, 0.274449587f},
-std::array<float,2>{0.560979724f, 0.0885758176f},
-std::array<float,2>{0.316468447f, 0.733383298f},
-std::array<float,2>{0.989417076f, 0.855684459f},
-std::array<float,2>{0.0387269817f, 0.34937498f},
-std::array<float,2>{0.799550176f, 0.433569849f},
-std::array<float,2>{0.209283113f, 0.932592213f},
-std::array<float,2>{0.687043488f, 0.521516383f},
-std::array<float,2>{0.39264515f, 0.129550889f},
-std::array<float,2>{0.703138709f, 0.304835081f},
-std::array<float,2>{0.453213453f, 0.801946819f},
-std::array<float,2>{0.82361263f, 0.661823869f},
-std::array<float,2>{0.169903606f, 0.0376465805f},
-std::array<float,2>{0.926381826f, 0.239844888f},
-std::array<float,2>{0.101296373f, 0.607708275f},
-std::array<float,2>{0.592319191f, 0.955236673f},
-std::array<float,2>{0.299500138f, 0.497623354f},
-std::array<float,2>{0.564883769f, 0.206566155f},
-std::array<float,2>{0.285719305f, 0.572497845f},
-std::array<float,2>{0.908410966f, 0.991764307f},
-std::array<float,2>{0.115337938f, 0.438790143f},
-std::array<float,2>{0.842212319f, 0.262597322f},
-std::array<float,2>{0.175847664f, 0.777941227f},
-std::array<float,2>{0.698641777f, 0.638472438f},
-std::array<float,2>{0.446248114f, 0.00888464041f},
-std::array<float,2>{0.66518265f, 0.401046336f},
-std::array<float,2>{0.376078188f, 0.883956552f},
-std::array<float,2>{0.784923136f, 0.547454298f},
-std::array<float,2>{0.196255744f, 0.166852936f},
-std::array<float,2>{0.981367648f, 0.0953306928f},
-std::array<float,2>{0.0596085154f, 0.698259652f},
-std::array<float,2>{0.535053849f, 0.820224226f},
-std::array<float,2>{0.328413844f, 0.313068241f},
-std::array<float,2>{0.731207013f, 0.0594621412f},
-std::array<float,2>{0.489895493f, 0.67437917f},
-std::array<float,2>{0.868231535f, 0.788518369f},
-std::array<float,2>{0.145759836f, 0.291455537f},
-std::array<float,2>{0.89424932f, 0.470094293f},
-std::array<float,2>{0.0731791928f, 0.940502644f},
-std::array<float,2>{0.608206153f, 0.611356854f},
-std::array<float,2>{0.276302338f, 0.221816689f},
-std::array<float,2>{0.512829065f, 0.372687399f},
-std::array<float,2>{0.357678384f, 0.870535493f},
-std::array<float,2>{0.948579073f, 0.749335468f},
-std::array<float,2>{0.0161672346f, 0.074141264f},
-std::array<float,2>{0.77226907f, 0.142462507f},
-std::array<float,2>{0.246290758f, 0.510662913f},
-std::array<float,2>{0.627676547f, 0.916800857f},
-std::array<float,2>{0.418028563f, 0.420781076f},
-std::array<float,2>{0.745648146f, 0.151457295f},
-std::array<float,2>{0.474998534f, 0.506206274f},
-std::array<float,2>{0.85021162f, 0.906410873f},
-std::array<float,2>{0.139480859f, 0.406397521f},
-std::array<float,2>{0.879369795f, 0.362671882f},
-std::array<float,2>{0.0798578262f, 0.860507727f},
-std::array<float,2>{0.621686935f, 0.73535043f},
-std::array<float,2>{0.252089292f, 0.0666248798f},
-std::array<float,2>{0.529050171f, 0.477458864f},
-std::array<float,2>{0.363523364f, 0.947044432f},
-std::array<float,2>{0.962190449f, 0.624033213f},
-std::array<float,2>{0.00982298702f, 0.231939301f},
-std::array<float,2>{0.761109412f, 0.0511251949f},
-std::array<float,2>{0.230685145f, 0.681294084f},
-std::array<float,2>{0.646926463f, 0.794835031f},
-std::array<float,2>{0.434910834f, 0.286488503f},
-std::array<float,2>{0.587458014f, 0.102401391f},
-std::array<float,2>{0.30446893f, 0.692288041f},
-std::array<float,2>{0.922216833f, 0.821604967f},
-std::array<float,2>{0.0961653814f, 0.326634318f},
-std::array<float,2>{0.827557862f, 0.397119939f},
-std::array<float,2>{0.16561994f, 0.88215214f},
-std::array<float,2>{0.707226634f, 0.561404109f},
-std::array<float,2>{0.459988832f, 0.160141587f},
-std::array<float,2>{0.683374465f, 0.251752317f},
-std::array<float,2>{0.397680998f, 0.770855844f},
-std::array<float,2>{0.802657664f, 0.627061903f},
-std::array<float,2>{0.203252822f, 0.00371062988f},
-std::array<float,2>{0.985691488f, 0.212629497f},
-std::array<float,2>{0.0329531953f, 0.563242435f},
-std::array<float,2>{0.555678964f, 0.996359706f},
-std::array<float,2>{0.31554684f, 0.446931034f},
-std::array<float,2>{0.535477281f, 0.245143235f},
-std::array<float,2>{0.333213836f, 0.597150445f},
-std::array<float,2>{0.977754533f, 0.966766298f},
-std::array<float,2>{0.057628572f, 0.490620613f},
-std::array<float,2>{0.785511553f, 0.304671675f},
-std::array<float,2>{0.202259779f, 0.805477262f},
-std::array<float,2>{0.66999656f, 0.669389188f},
-std::array<float,2>{0.381980121f, 0.0463012978f},
-std::array<float,2>{0.699495077f, 0.425101429f},
-std::array<float,2>{0.451971143f, 0.928150177f},
-std::array<float,2>{0.837028742f, 0.527551651f},
-std::array<float,2>{0.174765542f, 0.138446525f},
-std::array<float,2>{0.913176954f, 0.0841177106f},
-std::array<float,2>{0.112447232f, 0.724888325f},
-std::array<float,2>{0.567036033f, 0.846659958f},
-std::array<float,2>{0.284088671f, 0.353304237f},
-std::array<float,2>{0.631223619f, 0.0193280075f},
-std::array<float,2>{0.417758793f, 0.647881806f},
-std::array<float,2>{0.766930044f, 0.751481235f},
-std::array<float,2>{0.243882179f, 0.266653657f},
-std::array<float,2>{0.949765503f, 0.457093328f},
-std::array<float,2>{0.0212284513f, 0.975837529f},
-std::array<float,2>{0.51073879f, 0.586138427f},
-std::array<float,2>{0.355288267f, 0.190469027f},
-std::array<float,2>{0.602570415f, 0.337767243f},
-std::array<float,2>{0.279174656f, 0.84182626f},
-std::array<float,2>{0.896286547f, 0.717324972f},
-std::array<float,2>{0.0767708048f, 0.124384239f},
-std::array<float,2>{0.873227477f, 0.18697679f},
-std::array<float,2>{0.144191518f, 0.541150689f},
-std::array<float,2>{0.727882862f, 0.894238651f},
-std::array<float,2>{0.488056332f, 0.381863087f},
-std::array<float,2>{0.659891725f, 0.197539464f},
-std::array<float,2>{0.388186604f, 0.584272146f},
-std::array<float,2>{0.79615134f, 0.982314587f},
-std::array<float,2>{0.190513596f, 0.46589604f},
-std::array<float,2>{0.973789632f, 0.280418634f},
-std::array<float,2>{0.0472610258f, 0.762445867f},
-std::array<float,2>{0.543383896f, 0.649767876f},
-std::array<float,2>{0.336718798f, 0.0238236934f},
-std::array<float,2>{0.57586509f, 0.384562075f},
-std::array<float,2>{0.293325901f, 0.901400983f},
-std::array<float,2>{0.914752066f, 0.534197927f},
-std::array<float,2>{0.123974033f, 0.172244594f},
-std::array<float,2>{0.834874809f, 0.11065118f},
-std::array<float,2>{0.184199169f, 0.707239091f},
-std::array<float,2>{0.691263199f, 0.835458755f},
-std::array<float,2>{0.442105621f, 0.332859427f},
-std::array<float,2>{0.506740451f, 0.0330721773f},
-std::array<float,2>{0.349238455f, 0.656775415f},
-std::array<float,2>{0.940444887f, 0.799813569f},
-std::array<float,2>{0.0247192346f, 0.310455114f},
-std::array<float,2>{0.78000319f, 0.493677646f},
-std::array<float,2>{0.234635308f, 0.958655298f},
-std::array<float,2>{0.636925817f, 0.602054358f},
-std::array<float,2>{0.406978101f, 0.236788779f},
-std::array<float,2>{0.724061668f, 0.344858766f},
-std::array<float,2>{0.498618096f, 0.853755832f},
-std::array<float,2>{0.864202797f, 0.727686167f},
-std::array<float,2>{0.149406508f, 0.0904292166f},
-std::array<float,2>{0.902871728f, 0.128383234f},
-std::array<float,2>{0.0630472004f, 0.517085731f},
-std::array<float,2>{0.600633502f, 0.935896039f},
-std::array<float,2>{0.269464374f, 0.433631927f},
-std::array<float,2>{0.611841202f, 0.170708627f},
-std::array<float,2>{0.25909549f, 0.552444398f},
-std::array<float,2>{0.886247218f, 0.88984704f},
-std::array<float,2>{0.0899228156f, 0.405701846f},
-std::array<float,2>{0.855405748f, 0.319354117f},
-std::array<float,2>{0.129659221f, 0.814294457f},
-std::array<float,2>{0.735217631f, 0.701693118f},
-std::array<float,2>{0.479636669f, 0.0994558632f},
-std::array<float,2>{0.6529392f, 0.441998869f},
-std::array<float,2>{0.428806454f, 0.986779034f},
-std::array<float,2>{0.757504046f, 0.577754915f},
-std::array<float,2>{0.221825793f, 0.21063517f},
-std::array<float,2>{0.959226012f, 0.0140123954f},
-std::array<float,2>{0.00574269053f, 0.633488476f},
-std::array<float,2>{0.518956244f, 0.775630057f},
-std::array<float,2>{0.36930719f, 0.258128136f},
-std::array<float,2>{0.711664319f, 0.0745961666f},
-std::array<float,2>{0.465019703f, 0.745789289f},
-std::array<float,2>{0.817005992f, 0.872015178f},
-std::array<float,2>{0.162402555f, 0.368037969f},
-std::array<float,2>{0.930417597f, 0.414828598f},
-std::array<float,2>{0.105879217f, 0.919886351f},
-std::array<float,2>{0.580956757f, 0.515339434f},
-std::array<float,2>{0.306276172f, 0.14550975f},
-std::array<float,2>{0.549123585f, 0.294275224f},
-std::array<float,2>{0.324911565f, 0.78246671f},
-std::array<float,2>{0.999297917f, 0.6778633f},
-std::array<float,2>{0.0453580692f, 0.0580406822f},
-std::array<float,2>{0.810435414f, 0.226333708f},
-std::array<float,2>{0.217478186f, 0.615800261f},
-std::array<float,2>{0.673984945f, 0.943630338f},
-std::array<float,2>{0.404124618f, 0.476321667f},
-std::array<float,2>{0.698869288f, 0.204351515f},
-std::array<float,2>{0.445533693f, 0.572138846f},
-std::array<float,2>{0.842638254f, 0.98886162f},
-std::array<float,2>{0.17665188f, 0.440369904f},
-std::array<float,2>{0.908758104f, 0.263872921f},
-std::array<float,2>{0.115774475f, 0.779331088f},
-std::array<float,2>{0.565268755f, 0.640034735f},
-std::array<float,2>{0.285465091f, 0.0111316713f},
-std::array<float,2>{0.534373462f, 0.398670733f},
-std::array<float,2>{0.32904622f, 0.886061013f},
-std::array<float,2>{0.980901539f, 0.55028218f},
-std::array<float,2>{0.0602750927f, 0.165034488f},
-std::array<float,2>{0.78429848f, 0.0957974195f},
-std::array<float,2>{0.195411325f, 0.696789563f},
-std::array<float,2>{0.665895224f, 0.817726433f},
-std::array<float,2>{0.376493305f, 0.315823764f},
-std::array<float,2>{0.607832313f, 0.0620588399f},
-std::array<float,2>{0.275784999f, 0.67290777f},
-std::array<float,2>{0.893831253f, 0.786116421f},
-std::array<float,2>{0.0723086894f, 0.290914178f},
-std::array<float,2>{0.868838668f, 0.471043587f},
-std::array<float,2>{0.146323577f, 0.938948214f},
-std::array<float,2>{0.730951726f, 0.609892249f},
-std::array<float,2>{0.489726543f, 0.220296443f},
-std::array<float,2>{0.627309799f, 0.374978244f},
-std::array<float,2>{0.418638408f, 0.868415833f},
-std::array<float,2>{0.771561265f, 0.746499002f},
-std::array<float,2>{0.247030467f, 0.0707982183f},
-std::array<float,2>{0.949102223f, 0.14316082f},
-std::array<float,2>{0.016038686f, 0.509001374f},
-std::array<float,2>{0.513576806f, 0.914115489f},
-std::array<float,2>{0.357981473f, 0.418752044f},
-std::array<float,2>{0.524317324f, 0.177548513f},
-std::array<float,2>{0.359612882f, 0.536657274f},
-std::array<float,2>{0.965299249f, 0.90603447f},
-std::array<float,2>{0.0139595298f, 0.388184607f},
-std::array<float,2>{0.763523936f, 0.329217255f},
-std::array<float,2>{0.229000866f, 0.829939425f},
-std::array<float,2>{0.643373489f, 0.70416975f},
-std::array<float,2>{0.430848002f, 0.115527652f},
-std::array<float,2>{0.749861538f, 0.462735683f},
-std::array<float,2>{0.471352071f, 0.977526486f},
-std::array<float,2>{0.845624387f, 0.58078444f},
-std::array<float,2>{0.135893077f, 0.201203823f},
-std::array<float,2>{0.877638459f, 0.0275517665f},
-std::array<float,2>{0.084251985f, 0.655661047f},
-std::array<float,2>{0.620744407f, 0.760302484f},
-std::array<float,2>{0.254467428f, 0.275776029f},
-std::array<float,2>{0.686715543f, 0.0871323124f},
-std::array<float,2>{0.393121004f, 0.731045306f},
-std::array<float,2>{0.799268126f, 0.858995318f},
-std::array<float,2>{0.209713593f, 0.351414979f},
-std::array<float,2>{0.990002275f, 0.429927528f},
-std::array<float,2>{0.0384493992f, 0.930401504f},
-std::array<float,2>{0.56111145f, 0.520278335f},
-std::array<float,2>{0.316944659f, 0.132738084f},
-std::array<float,2>{0.591918588f, 0.306810677f},
-std::array<float,2>{0.29908371f, 0.804499447f},
-std::array<float,2>{0.926113963f, 0.662664235f},
-std::array<float,2>{0.100756936f, 0.0368176065f},
-std::array<float,2>{0.824101627f, 0.241062984f},
-std::array<float,2>{0.16909112f, 0.607211232f},
-std::array<float,2>{0.704073548f, 0.953360379f},
-std::array<float,2>{0.453702271f, 0.498419911f},
-std::array<float,2>{0.649721742f, 0.13653402f},
-std::array<float,2>{0.424935251f, 0.52717334f},
-std::array<float,2>{0.752251267f, 0.923374772f},
-std::array<float,2>{0.226143882f, 0.42735678f},
-std::array<float,2>{0.95510149f, 0.356854916f},
-std::array<float,2>{0.00364258117f, 0.848757446f},
-std::array<float,2>{0.519965529f, 0.720963061f},
-std::array<float,2>{0.372183859f, 0.0802910328f},
-std::array<float,2>{0.61437875f, 0.485734165f},
-std::array<float,2>{0.261984944f, 0.962812603f},
-std::array<float,2>{0.888574362f, 0.599557519f},
-std::array<float,2>{0.0881315544f, 0.248583913f},
-std::array<float,2>{0.85848105f, 0.0413568132f},
-std::array<float,2>{0.127013713f, 0.666421413f},
-std::array<float,2>{0.739734232f, 0.811400771f},
-std::array<float,2>{0.483134687f, 0.297295481f},
-std::array<float,2>{0.552940369f, 0.120469816f},
-std::array<float,2>{0.322748035f, 0.713627934f},
-std::array<float,2>{0.995163739f, 0.838800371f},
-std::array<float,2>{0.0392091684f, 0.340043306f},
-std::array<float,2>{0.808115244f, 0.378704906f},
-std::array<float,2>{0.213782907f, 0.896190464f},
-std::array<float,2>{0.677620292f, 0.54559797f},
-std::array<float,2>{0.402172863f, 0.180870518f},
-std::array<float,2>{0.718510687f, 0.27138871f},
-std::array<float,2>{0.464752406f, 0.757582963f},
-std::array<float,2>{0.81582737f, 0.643326402f},
-std::array<float,2>{0.15980798f, 0.0195477456f},
-std::array<float,2>{0.936214268f, 0.194477782f},
-std::array<float,2>{0.102859885f, 0.590380073f},
-std::array<float,2>{0.583958566f, 0.970299542f},
-std::array<float,2>{0.308828086f, 0.453519613f},
-std::array<float,2>{0.572338641f, 0.227936834f},
-std::array<float,2>{0.291279316f, 0.621002436f},
-std::array<float,2>{0.920406699f, 0.951172829f},
-std::array<float,2>{0.120432258f, 0.482463062f},
-std::array<float,2>{0.829753935f, 0.28351739f},
-std::array<float,2>{0.182461664f, 0.790862799f},
-std::array<float,2>{0.692940831f, 0.686428726f},
-std::array<float,2>{0.437735558f, 0.0501679927f},
-std::array<float,2>{0.661323667f, 0.411045521f},
-std::array<float,2>{0.385965347f, 0.910325468f},
-std::array<float,2>{0.790029109f, 0.503580093f},
-std::array<float,2>{0.19489029f, 0.153370723f},
-std::array<float,2>{0.970065355f, 0.065719232f},
-std::array<float,2>{0.0537165329f, 0.740203142f},
-std::array<float,2>{0.542169988f, 0.865158081f},
-std::array<float,2>{0.343597174f, 0.365916699f},
-std::array<float,2>{0.721427202f, 0.00494175358f},
-std::array<float,2>{0.49410218f, 0.631681323f},
-std::array<float,2>{0.86056447f, 0.768270671f},
-std::array<float,2>{0.15484497f, 0.257165015f},
-std::array<float,2>{0.90218395f, 0.450775951f},
-std::array<float,2>{0.0679066032f, 0.996066868f},
-std::array<float,2>{0.594520926f, 0.567723095f},
-std::array<float,2>{0.269643754f, 0.217973456f},
-std::array<float,2>{0.501416862f, 0.32035622f},
-std::array<float,2>{0.346022397f, 0.825969458f},
-std::array<float,2>{0.944081366f, 0.687852085f},
-std::array<float,2>{0.0294794869f, 0.108237617f},
-std::array<float,2>{0.774329603f, 0.163111806f},
-std::array<float,2>{0.240214601f, 0.557358861f},
-std::array<float,2>{0.636210501f, 0.878721297f},
-std::array<float,2>{0.411309808f, 0.393771648f},
-std::array<float,2>{0.73454529f, 0.169852093f},
-std::array<float,2>{0.480141312f, 0.553000093f},
-std::array<float,2>{0.854648471f, 0.888038218f},
-std::array<float,2>{0.129187316f, 0.402726918f},
-std::array<float,2>{0.886017621f, 0.317872912f},
-std::array<float,2>{0.0905168131f, 0.814617097f},
-std::array<float,2>{0.611663461f, 0.700242698f},
-std::array<float,2>{0.259739697f, 0.0997998714f},
-std::array<float,2>{0.519424856f, 0.444948375f},
-std::array<float,2>{0.369653881f, 0.985846639f},
-std::array<float,2>{0.959582508f, 0.574324965f},
-std::array<float,2>{0.00532173319f, 0.208559632f},
-std::array<float,2>{0.75685221f, 0.012754201f},
-std::array<float,2>{0.22246702f, 0.635263205f},
-std::array<float,2>{0.652661502f, 0.773671508f},
-std::array<float,2>{0.429277539f, 0.259912014f},
-std::array<float,2>{0.580397666f, 0.077752389f},
-std::array<float,2>{0.306121081f, 0.743822515f},
-std::array<float,2>{0.929949343f, 0.873526096f},
-std::array<float,2>{0.106015317f, 0.370493829f},
-std::array<float,2>{0.816475272f, 0.417048067f},
-std::array<float,2>{0.162977651f, 0.919955373f},
-std::array<float,2>{0.711137354f, 0.512090504f},
-std::array<float,2>{0.465557575f, 0.14790611f},
-std::array<float,2>{0.674471796f, 0.296713173f},
-std::array<float,2>{0.403331369f, 0.785136104f},
-std::array<float,2>{0.809939206f, 0.677581072f},
-std::array<float,2>{0.216885924f, 0.0557059161f},
-std::array<float,2>{0.999628246f, 0.224603191f},
-std::array<float,2>{0.0455015376f, 0.614349544f},
-std::array<float,2>{0.549747944f, 0.943159878f},
-std::array<float,2>{0.324568212f, 0.47311613f},
-std::array<float,2>{0.543824911f, 0.195696071f},
-std::array<float,2>{0.336330533f, 0.583113074f},
-std::array<float,2>{0.974591434f, 0.983861446f},
-std::array<float,2>{0.0475278348f, 0.468416363f},
-std::array<float,2>{0.796716332f, 0.278909117f},
-std::array<float,2>{0.1910353f, 0.7655195f},
-std::array<float,2>{0.659641802f, 0.651213944f},
-std::array<float,2>{0.387695551f, 0.0272120591f},
-std::array<float,2>{0.690633535f, 0.384812117f},
-std::array<float,2>{0.441443682f, 0.899961591f},
-std::array<float,2>{0.834082544f, 0.532638192f},
-std::array<float,2>{0.183630943f, 0.174491093f},
-std::array<float,2>{0.91444838f, 0.112589844f},
-std::array<float,2>{0.12339206f, 0.70940429f},
-std::array<float,2>{0.575237811f, 0.832330048f},
-std::array<float,2>{0.293780148f, 0.334667832f},
-std::array<float,2>{0.63759917f, 0.0337470248f},
-std::array<float,2>{0.406602472f, 0.658901215f},
-std::array<float,2>{0.77935034f, 0.797150254f},
-std::array<float,2>{0.235236451f, 0.311084598f},
-std::array<float,2>{0.941196978f, 0.495728642f},
-std::array<float,2>{0.0250720121f, 0.959494114f},
-std::array<float,2>{0.506005466f, 0.604254007f},
-std::array<float,2>{0.348968357f, 0.235658035f},
-std::array<float,2>{0.601086497f, 0.347164422f},
-std::array<float,2>{0.268824607f, 0.852444828f},
-std::array<float,2>{0.902368128f, 0.729084432f},
-std::array<float,2>{0.0628125072f, 0.0929133445f},
-std::array<float,2>{0.863586307f, 0.126004189f},
-std::array<float,2>{0.148683906f, 0.518426776f},
-std::array<float,2>{0.724172294f, 0.935187578f},
-std::array<float,2>{0.498086691f, 0.436683059f},
-std::array<float,2>{0.670442879f, 0.243661836f},
-std::array<float,2>{0.382744938f, 0.594220459f},
-std::array<float,2>{0.786040008f, 0.967342794f},
-std::array<float,2>{0.203110546f, 0.489604443f},
-std::array<float,2>{0.978481352f, 0.301275223f},
-std::array<float,2>{0.058580406f, 0.807796359f},
-std::array<float,2>{0.535714865f, 0.671220243f},
-std::array<float,2>{0.333517551f, 0.0442311242f},
-std::array<float,2>{0.566460967f, 0.422736079f},
-std::array<float,2>{0.283340454f, 0.926612556f},
-std::array<float,2>{0.914029479f, 0.530408263f},
-std::array<float,2>{0.113201268f, 0.140583605f},
-std::array<float,2>{0.837467015f, 0.0824077055f},
-std::array<float,2>{0.174108043f, 0.72391969f},
-std::array<float,2>{0.699843049f, 0.843957067f},
-std::array<float,2>{0.451335877f, 0.355034381f},
-std::array<float,2>{0.509779811f, 0.0172380283f},
-std::array<float,2>{0.354704857f, 0.646246552f},
-std::array<float,2>{0.949348152f, 0.752552569f},
-std::array<float,2>{0.0207561068f, 0.269198835f},
-std::array<float,2>{0.767444313f, 0.460230082f},
-std::array<float,2>{0.243385896f, 0.974376321f},
-std::array<float,2>{0.631665885f, 0.588081717f},
-std::array<float,2>{0.417087764f, 0.188518375f},
-std::array<float,2>{0.728305757f, 0.33914426f},
-std::array<float,2>{0.487627864f, 0.841330767f},
-std::array<float,2>{0.873685479f, 0.716535449f},
-std::array<float,2>{0.143663988f, 0.122697711f},
-std::array<float,2>{0.895853162f, 0.184845209f},
-std::array<float,2>{0.0766062662f, 0.540853918f},
-std::array<float,2>{0.603148699f, 0.890918493f},
-std::array<float,2>{0.278753042f, 0.380411565f},
-std::array<float,2>{0.621383905f, 0.149946943f},
-std::array<float,2>{0.252567738f, 0.504327476f},
-std::array<float,2>{0.879596353f, 0.909143984f},
-std::array<float,2>{0.079108879f, 0.40989691f},
-std::array<float,2>{0.849963188f, 0.35990119f},
-std::array<float,2>{0.138827398f, 0.863131523f},
-std::array<float,2>{0.745253444f, 0.737467706f},
-std::array<float,2>{0.475413084f, 0.0692789555f},
-std::array<float,2>{0.647309303f, 0.479812473f},
-std::array<float,2>{0.435468644f, 0.947873414f},
-std::array<float,2>{0.761594772f, 0.621203125f},
-std::array<float,2>{0.230961561f, 0.234373614f},
-std::array<float,2>{0.962842345f, 0.0536217839f},
-std::array<float,2>{0.0103167482f, 0.683108926f},
-std::array<float,2>{0.528412938f, 0.796187878f},
-std::array<float,2>{0.364057302f, 0.288523972f},
-std::array<float,2>{0.707825005f, 0.103771783f},
-std::array<float,2>{0.46069935f, 0.695184946f},
-std::array<float,2>{0.827983141f, 0.823007584f},
-std::array<float,2>{0.165467113f, 0.324559331f},
-std::array<float,2>{0.922729194f, 0.394799322f},
-std::array<float,2>{0.0965732113f, 0.88062799f},
-std::array<float,2>{0.587289214f, 0.558610201f},
-std::array<float,2>{0.304183602f, 0.156538427f},
-std::array<float,2>{0.556619287f, 0.252889574f},
-std::array<float,2>{0.316022784f, 0.772063375f},
-std::array<float,2>{0.986085534f, 0.626240969f},
-std::array<float,2>{0.0324063301f, 0.00125658221f},
-std::array<float,2>{0.801997721f, 0.214342773f},
-std::array<float,2>{0.203638032f, 0.565025449f},
-std::array<float,2>{0.683002114f, 0.998426199f},
-std::array<float,2>{0.398089498f, 0.447734594f},
-std::array<float,2>{0.733857632f, 0.222612157f},
-std::array<float,2>{0.491365314f, 0.612219691f},
-std::array<float,2>{0.870244026f, 0.941185832f},
-std::array<float,2>{0.148365602f, 0.4702923f},
-std::array<float,2>{0.89147079f, 0.291668922f},
-std::array<float,2>{0.0719652548f, 0.788698018f},
-std::array<float,2>{0.605907142f, 0.674067974f},
-std::array<float,2>{0.274701357f, 0.0588583685f},
-std::array<float,2>{0.514613807f, 0.420042306f},
-std::array<float,2>{0.356942654f, 0.916325212f},
-std::array<float,2>{0.94644326f, 0.510156333f},
-std::array<float,2>{0.0190183148f, 0.142057195f},
-std::array<float,2>{0.770764947f, 0.0734662786f},
-std::array<float,2>{0.249446526f, 0.74982965f},
-std::array<float,2>{0.626785219f, 0.870832264f},
-std::array<float,2>{0.421685547f, 0.372135609f},
-std::array<float,2>{0.563580632f, 0.00932579953f},
-std::array<float,2>{0.288800329f, 0.637861848f},
-std::array<float,2>{0.906752765f, 0.777781367f},
-std::array<float,2>{0.114670806f, 0.262117207f},
-std::array<float,2>{0.840215743f, 0.439100593f},
-std::array<float,2>{0.178279713f, 0.99146843f},
-std::array<float,2>{0.696952581f, 0.573090076f},
-std::array<float,2>{0.447722584f, 0.20616667f},
-std::array<float,2>{0.667461157f, 0.312911808f},
-std::array<float,2>{0.378030062f, 0.8197788f},
-std::array<float,2>{0.782289505f, 0.699161589f},
-std::array<float,2>{0.198153332f, 0.0950320736f},
-std::array<float,2>{0.983220816f, 0.166483626f},
-std::array<float,2>{0.0621894188f, 0.546899915f},
-std::array<float,2>{0.531428635f, 0.884720504f},
-std::array<float,2>{0.330932915f, 0.400535792f},
-std::array<float,2>{0.559982538f, 0.129021004f},
-std::array<float,2>{0.318667382f, 0.522102833f},
-std::array<float,2>{0.99091953f, 0.931895554f},
-std::array<float,2>{0.0359867439f, 0.432634652f},
-std::array<float,2>{0.797753632f, 0.349056065f},
-std::array<float,2>{0.207364842f, 0.856217921f},
-std::array<float,2>{0.684413552f, 0.732434571f},
-std::array<float,2>{0.390928298f, 0.0882632956f},
-std::array<float,2>{0.705833614f, 0.497414976f},
-std::array<float,2>{0.457008868f, 0.955598056f},
-std::array<float,2>{0.821292937f, 0.608038902f},
-std::array<float,2>{0.170065627f, 0.239548579f},
-std::array<float,2>{0.927934647f, 0.0374813601f},
-std::array<float,2>{0.0985563323f, 0.661478281f},
-std::array<float,2>{0.591097116f, 0.802676916f},
-std::array<float,2>{0.297398597f, 0.305216074f},
-std::array<float,2>{0.640824795f, 0.113417886f},
-std::array<float,2>{0.431944668f, 0.70602715f},
-std::array<float,2>{0.763985515f, 0.831869841f},
-std::array<float,2>{0.228326917f, 0.330784321f},
-std::array<float,2>{0.968747377f, 0.390045613f},
-std::array<float,2>{0.0122528113f, 0.904111207f},
-std::array<float,2>{0.525416791f, 0.538056672f},
-std::array<float,2>{0.362475097f, 0.178925574f},
-std::array<float,2>{0.618658841f, 0.27532959f},
-std::array<float,2>{0.256946951f, 0.758662999f},
-std::array<float,2>{0.875253499f, 0.654047549f},
-std::array<float,2>{0.0823811218f, 0.0306295417f},
-std::array<float,2>{0.84633857f, 0.200436473f},
-std::array<float,2>{0.134649768f, 0.579113424f},
-std::array<float,2>{0.746122062f, 0.978973866f},
-std::array<float,2>{0.469910145f, 0.463218659f},
-std::array<float,2>{0.678409755f, 0.182484776f},
-std::array<float,2>{0.398900688f, 0.544051826f},
-std::array<float,2>{0.806505322f, 0.897320986f},
-std::array<float,2>{0.21281594f, 0.376641423f},
-std::array<float,2>{0.992255509f, 0.343215436f},
-std::array<float,2>{0.0420524366f, 0.836457014f},
-std::array<float,2>{0.550999701f, 0.711526692f},
-std::array<float,2>{0.321891427f, 0.119035564f},
-std::array<float,2>{0.58466053f, 0.455579013f},
-std::array<float,2>{0.311551839f, 0.971965134f},
-std::array<float,2>{0.935521185f, 0.592449605f},
-std::array<float,2>{0.104672849f, 0.192715526f},
-std::array<float,2>{0.813169718f, 0.022420248f},
-std::array<float,2>{0.15761371f, 0.642567277f},
-std::array<float,2>{0.715447903f, 0.754609168f},
-std::array<float,2>{0.461800933f, 0.272234857f},
-std::array<float,2>{0.522587478f, 0.0788872093f},
-std::array<float,2>{0.373142064f, 0.719687939f},
-std::array<float,2>{0.953731179f, 0.850439548f},
-std::array<float,2>{0.0013135781f, 0.359135985f},
-std::array<float,2>{0.750215113f, 0.428568989f},
-std::array<float,2>{0.224160433f, 0.924716592f},
-std::array<float,2>{0.650717497f, 0.525047421f},
-std::array<float,2>{0.423360378f, 0.133165509f},
-std::array<float,2>{0.740654111f, 0.29925397f},
-std::array<float,2>{0.482223272f, 0.808611274f},
-std::array<float,2>{0.856576681f, 0.664743483f},
-std::array<float,2>{0.126362041f, 0.0396016166f},
-std::array<float,2>{0.888929665f, 0.246584639f},
-std::array<float,2>{0.087633729f, 0.60105288f},
-std::array<float,2>{0.615673423f, 0.963824987f},
-std::array<float,2>{0.264347285f, 0.487074524f},
-std::array<float,2>{0.597441852f, 0.215743944f},
-std::array<float,2>{0.27248624f, 0.56894511f},
-std::array<float,2>{0.899457216f, 0.992412925f},
-std::array<float,2>{0.0686006844f, 0.451931328f},
-std::array<float,2>{0.861689448f, 0.254974872f},
-std::array<float,2>{0.153290078f, 0.766861737f},
-std::array<float,2>{0.720140159f, 0.630757809f},
-std::array<float,2>{0.494245261f, 0.00645790808f},
-std::array<float,2>{0.634192646f, 0.391493082f},
-std::array<float,2>{0.413021713f, 0.876743436f},
-std::array<float,2>{0.776190221f, 0.556367278f},
-std::array<float,2>{0.241126671f, 0.160446987f},
-std::array<float,2>{0.941912889f, 0.105519995f},
-std::array<float,2>{0.0278723501f, 0.689976335f},
-std::array<float,2>{0.502442777f, 0.827755511f},
-std::array<float,2>{0.344256938f, 0.32386741f},
-std::array<float,2>{0.69513613f, 0.0485443585f},
-std::array<float,2>{0.440814704f, 0.684882104f},
-std::array<float,2>{0.830477238f, 0.791851461f},
-std::array<float,2>{0.179713875f, 0.281681389f},
-std::array<float,2>{0.919283211f, 0.48147282f},
-std::array<float,2>{0.118897721f, 0.949322045f},
-std::array<float,2>{0.571004689f, 0.617628992f},
-std::array<float,2>{0.289995879f, 0.230432272f},
-std::array<float,2>{0.540623367f, 0.365032554f},
-std::array<float,2>{0.341247559f, 0.866983712f},
-std::array<float,2>{0.971693158f, 0.74176687f},
-std::array<float,2>{0.0508970022f, 0.063108027f},
-std::array<float,2>{0.792792797f, 0.154948115f},
-std::array<float,2>{0.191712484f, 0.500068426f},
-std::array<float,2>{0.662588358f, 0.913107991f},
-std::array<float,2>{0.384217381f, 0.413674951f},
-std::array<float,2>{0.714012086f, 0.146311894f},
-std::array<float,2>{0.467358023f, 0.514866233f},
-std::array<float,2>{0.819395363f, 0.919212997f},
-std::array<float,2>{0.161609337f, 0.41408813f},
-std::array<float,2>{0.933435857f, 0.367310911f},
-std::array<float,2>{0.108501904f, 0.871416032f},
-std::array<float,2>{0.580060899f, 0.745570362f},
-std::array<float,2>{0.308167756f, 0.0747743174f},
-std::array<float,2>{0.547341764f, 0.475852668f},
-std::array<float,2>{0.327260762f, 0.944195926f},
-std::array<float,2>{0.997929871f, 0.615466774f},
-std::array<float,2>{0.0436450429f, 0.225595266f},
-std::array<float,2>{0.810779691f, 0.058308322f},
-std::array<float,2>{0.216726869f, 0.678446114f},
-std::array<float,2>{0.673263848f, 0.783177435f},
-std::array<float,2>{0.406034499f, 0.294766247f},
-std::array<float,2>{0.610353172f, 0.0986994058f},
-std::array<float,2>{0.261611819f, 0.701345861f},
-std::array<float,2>{0.884683609f, 0.813933134f},
-std::array<float,2>{0.092115432f, 0.320041955f},
-std::array<float,2>{0.852852762f, 0.406219333f},
-std::array<float,2>{0.132308051f, 0.890437305f},
-std::array<float,2>{0.736961782f, 0.55214721f},
-std::array<float,2>{0.477989197f, 0.170363739f},
-std::array<float,2>{0.654522538f, 0.258359551f},
-std::array<float,2>{0.426527202f, 0.776175261f},
-std::array<float,2>{0.754473448f, 0.632997334f},
-std::array<float,2>{0.218909696f, 0.0141669558f},
-std::array<float,2>{0.957508564f, 0.210352033f},
-std::array<float,2>{0.00702723907f, 0.577435136f},
-std::array<float,2>{0.516265213f, 0.986837804f},
-std::array<float,2>{0.368170887f, 0.441542655f},
-std::array<float,2>{0.505013347f, 0.236937657f},
-std::array<float,2>{0.349669814f, 0.60156852f},
-std::array<float,2>{0.938092113f, 0.958266318f},
-std::array<float,2>{0.0257536806f, 0.493613362f},
-std::array<float,2>{0.778887272f, 0.309619039f},
-std::array<float,2>{0.236723796f, 0.800484776f},
-std::array<float,2>{0.63898772f, 0.656323254f},
-std::array<float,2>{0.408504218f, 0.0322847106f},
-std::array<float,2>{0.724984705f, 0.434395254f},
-std::array<float,2>{0.496750265f, 0.936037421f},
-std::array<float,2>{0.866115987f, 0.517423689f},
-std::array<float,2>{0.152060285f, 0.128830671f},
-std::array<float,2>{0.905932128f, 0.0901526138f},
-std::array<float,2>{0.0651498288f, 0.728464901f},
-std::array<float,2>{0.598657846f, 0.854118884f},
-std::array<float,2>{0.266968757f, 0.345493138f},
-std::array<float,2>{0.65688324f, 0.0240850858f},
-std::array<float,2>{0.390248686f, 0.65015322f},
-std::array<float,2>{0.79480207f, 0.761968911f},
-std::array<float,2>{0.188675135f, 0.281043768f},
-std::array<float,2>{0.974934459f, 0.466516644f},
-std::array<float,2>{0.049522534f, 0.981595993f},
-std::array<float,2>{0.545827746f, 0.584798217f},
-std::array<float,2>{0.338358283f, 0.197974414f},
-std::array<float,2>{0.576599061f, 0.332149416f},
-std::array<float,2>{0.296113491f, 0.835338295f},
-std::array<float,2>{0.916978598f, 0.70795083f},
-std::array<float,2>{0.12168014f, 0.110866226f},
-std::array<float,2>{0.832644343f, 0.172539949f},
-std::array<float,2>{0.185769469f, 0.534675539f},
-std::array<float,2>{0.689044654f, 0.901865304f},
-std::array<float,2>{0.444734037f, 0.383797139f},
-std::array<float,2>{0.630509675f, 0.191361085f},
-std::array<float,2>{0.415552884f, 0.586666763f},
-std::array<float,2>{0.767771423f, 0.976387501f},
-std::array<float,2>{0.245151177f, 0.457800388f},
-std::array<float,2>{0.951685369f, 0.26757583f},
-std::array<float,2>{0.023218615f, 0.751261175f},
-std::array<float,2>{0.509440303f, 0.6482144f},
-std::array<float,2>{0.352945298f, 0.0188246425f},
-std::array<float,2>{0.605382681f, 0.382612228f},
-std::array<float,2>{0.280917853f, 0.893921494f},
-std::array<float,2>{0.897234142f, 0.541951537f},
-std::array<float,2>{0.0758988336f, 0.1873447f},
-std::array<float,2>{0.872566938f, 0.12494383f},
-std::array<float,2>{0.141490385f, 0.716951489f},
-std::array<float,2>{0.730452895f, 0.842543542f},
-std::array<float,2>{0.484632403f, 0.3370381f},
-std::array<float,2>{0.538606822f, 0.0465965904f},
-std::array<float,2>{0.334899008f, 0.669765651f},
-std::array<float,2>{0.979654193f, 0.804770947f},
-std::array<float,2>{0.0564413592f, 0.303786457f},
-std::array<float,2>{0.788928986f, 0.490775287f},
-std::array<float,2>{0.199970067f, 0.965822399f},
-std::array<float,2>{0.669231832f, 0.597226083f},
-std::array<float,2>{0.380451292f, 0.246091262f},
-std::array<float,2>{0.701254368f, 0.352860034f},
-std::array<float,2>{0.449946225f, 0.845709801f},
-std::array<float,2>{0.839059234f, 0.725278378f},
-std::array<float,2>{0.172366738f, 0.0846315548f},
-std::array<float,2>{0.911908329f, 0.137710422f},
-std::array<float,2>{0.109810695f, 0.527888f},
-std::array<float,2>{0.569003463f, 0.928331792f},
-std::array<float,2>{0.28263557f, 0.42534703f},
-std::array<float,2>{0.588075876f, 0.159360737f},
-std::array<float,2>{0.30171302f, 0.56078881f},
-std::array<float,2>{0.925157309f, 0.882685065f},
-std::array<float,2>{0.0947719663f, 0.396885186f},
-std::array<float,2>{0.825291932f, 0.326962978f},
-std::array<float,2>{0.16704984f, 0.821986377f},
-std::array<float,2>{0.709917426f, 0.691558003f},
-std::array<float,2>{0.458725989f, 0.101567745f},
-std::array<float,2>{0.679989576f, 0.446705848f},
-std::array<float,2>{0.395565331f, 0.996927857f},
-std::array<float,2>{0.804336488f, 0.562570274f},
-std::array<float,2>{0.20527254f, 0.212129116f},
-std::array<float,2>{0.987356007f, 0.00307836407f},
-std::array<float,2>{0.0348256975f, 0.627923965f},
-std::array<float,2>{0.556813717f, 0.771354616f},
-std::array<float,2>{0.313006938f, 0.251021773f},
-std::array<float,2>{0.742807031f, 0.0671287328f},
-std::array<float,2>{0.474183649f, 0.734715521f},
-std::array<float,2>{0.848752499f, 0.860972881f},
-std::array<float,2>{0.137093171f, 0.362957001f},
-std::array<float,2>{0.882597029f, 0.406754941f},
-std::array<float,2>{0.0811557546f, 0.906881988f},
-std::array<float,2>{0.623240352f, 0.506573379f},
-std::array<float,2>{0.251947612f, 0.152001888f},
-std::array<float,2>{0.529674053f, 0.286767513f},
-std::array<float,2>{0.365989268f, 0.794276178f},
-std::array<float,2>{0.964769065f, 0.680967391f},
-std::array<float,2>{0.00883944798f, 0.0515223108f},
-std::array<float,2>{0.757822096f, 0.231593952f},
-std::array<float,2>{0.233010992f, 0.624747097f},
-std::array<float,2>{0.645889997f, 0.9464311f},
-std::array<float,2>{0.436032951f, 0.476630479f},
-std::array<float,2>{0.747830749f, 0.202949554f},
-std::array<float,2>{0.469077766f, 0.581277311f},
-std::array<float,2>{0.847492218f, 0.97768265f},
-std::array<float,2>{0.133189112f, 0.461123317f},
-std::array<float,2>{0.876214504f, 0.276729584f},
-std::array<float,2>{0.0837715119f, 0.761125267f},
-std::array<float,2>{0.617825806f, 0.654525101f},
-std::array<float,2>{0.256123841f, 0.0290372111f},
-std::array<float,2>{0.527305782f, 0.386754811f},
-std::array<float,2>{0.362287402f, 0.904637456f},
-std::array<float,2>{0.967514992f, 0.53604126f},
-std::array<float,2>{0.013378636f, 0.175795853f},
-std::array<float,2>{0.765155733f, 0.117029205f},
-std::array<float,2>{0.227050021f, 0.703916132f},
-std::array<float,2>{0.64161551f, 0.828627348f},
-std::array<float,2>{0.433497518f, 0.328848779f},
-std::array<float,2>{0.590120256f, 0.0359236598f},
-std::array<float,2>{0.298696578f, 0.664058208f},
-std::array<float,2>{0.929270744f, 0.803294659f},
-std::array<float,2>{0.0992584601f, 0.307985306f},
-std::array<float,2>{0.820558012f, 0.499482155f},
-std::array<float,2>{0.171182513f, 0.954932511f},
-std::array<float,2>{0.706929505f, 0.605622888f},
-std::array<float,2>{0.455970615f, 0.242120609f},
-std::array<float,2>{0.684946537f, 0.350424647f},
-std::array<float,2>{0.391908914f, 0.858119547f},
-std::array<float,2>{0.798478723f, 0.731491089f},
-std::array<float,2>{0.208044171f, 0.0866631642f},
-std::array<float,2>{0.991990983f, 0.131335229f},
-std::array<float,2>{0.0369314551f, 0.521253943f},
-std::array<float,2>{0.558605075f, 0.931174397f},
-std::array<float,2>{0.320028752f, 0.430939049f},
-std::array<float,2>{0.533031881f, 0.165060014f},
-std::array<float,2>{0.331724972f, 0.548966169f},
-std::array<float,2>{0.983488917f, 0.885550499f},
-std::array<float,2>{0.0614478253f, 0.39983958f},
-std::array<float,2>{0.78191185f, 0.315104127f},
-std::array<float,2>{0.198569223f, 0.817034841f},
-std::array<float,2>{0.66663748f, 0.695730329f},
-std::array<float,2>{0.377242923f, 0.096770823f},
-std::array<float,2>{0.695430934f, 0.440672338f},
-std::array<float,2>{0.4484438f, 0.989383996f},
-std::array<float,2>{0.84161377f, 0.570546985f},
-std::array<float,2>{0.179678038f, 0.203780696f},
-std::array<float,2>{0.907856941f, 0.0102589028f},
-std::array<float,2>{0.114244245f, 0.638727009f},
-std::array<float,2>{0.563221753f, 0.780349076f},
-std::array<float,2>{0.287987381f, 0.265329897f},
-std::array<float,2>{0.625184298f, 0.071873866f},
-std::array<float,2>{0.420054257f, 0.74798578f},
-std::array<float,2>{0.76961422f, 0.867488146f},
-std::array<float,2>{0.248339042f, 0.373094708f},
-std::array<float,2>{0.946265578f, 0.419843674f},
-std::array<float,2>{0.0176994931f, 0.915536463f},
-std::array<float,2>{0.51473242f, 0.507890522f},
-std::array<float,2>{0.356285632f, 0.144455686f},
-std::array<float,2>{0.607210875f, 0.289262801f},
-std::array<float,2>{0.273506373f, 0.787079811f},
-std::array<float,2>{0.892147005f, 0.67197907f},
-std::array<float,2>{0.0705335289f, 0.0610159822f},
-std::array<float,2>{0.869717777f, 0.21958594f},
-std::array<float,2>{0.14716047f, 0.610448956f},
-std::array<float,2>{0.732507408f, 0.938083351f},
-std::array<float,2>{0.490751177f, 0.471996754f},
-std::array<float,2>{0.663442671f, 0.152786151f},
-std::array<float,2>{0.382911921f, 0.502851069f},
-std::array<float,2>{0.791090965f, 0.911503077f},
-std::array<float,2>{0.193298861f, 0.411145836f},
-std::array<float,2>{0.971380949f, 0.367108136f},
-std::array<float,2>{0.0519684926f, 0.864057124f},
-std::array<float,2>{0.539093614f, 0.739050746f},
-std::array<float,2>{0.340032279f, 0.0647590831f},
-std::array<float,2>{0.571917295f, 0.484197319f},
-std::array<float,2>{0.290339291f, 0.953120112f},
-std::array<float,2>{0.918479025f, 0.620116532f},
-std::array<float,2>{0.117252581f, 0.227223486f},
-std::array<float,2>{0.831224024f, 0.0489091575f},
-std::array<float,2>{0.181459352f, 0.686857462f},
-std::array<float,2>{0.694158018f, 0.790012479f},
-std::array<float,2>{0.439612627f, 0.284506232f},
-std::array<float,2>{0.503380835f, 0.109084874f},
-std::array<float,2>{0.345196843f, 0.688688636f},
-std::array<float,2>{0.943008006f, 0.824501812f},
-std::array<float,2>{0.028810529f, 0.321605355f},
-std::array<float,2>{0.776625395f, 0.393121064f},
-std::array<float,2>{0.241756469f, 0.877109289f},
-std::array<float,2>{0.633574903f, 0.558591604f},
-std::array<float,2>{0.413716406f, 0.162507921f},
-std::array<float,2>{0.719104469f, 0.256033093f},
-std::array<float,2>{0.495159954f, 0.769145966f},
-std::array<float,2>{0.862959385f, 0.632738113f},
-std::array<float,2>{0.154079452f, 0.00474698422f},
-std::array<float,2>{0.899255574f, 0.217706636f},
-std::array<float,2>{0.0696417093f, 0.567374647f},
-std::array<float,2>{0.595910251f, 0.99423945f},
-std::array<float,2>{0.27242595f, 0.449922681f},
-std::array<float,2>{0.616647542f, 0.249594405f},
-std::array<float,2>{0.265053779f, 0.597769201f},
-std::array<float,2>{0.889893472f, 0.961495876f},
-std::array<float,2>{0.0868585482f, 0.485080808f},
-std::array<float,2>{0.855853319f, 0.298154682f},
-std::array<float,2>{0.125492737f, 0.811868191f},
-std::array<float,2>{0.741726041f, 0.667226434f},
-std::array<float,2>{0.480896711f, 0.0420467369f},
-std::array<float,2>{0.651783049f, 0.426158011f},
-std::array<float,2>{0.422091812f, 0.921999037f},
-std::array<float,2>{0.751329362f, 0.525768459f},
-std::array<float,2>{0.222925112f, 0.135232329f},
-std::array<float,2>{0.954642951f, 0.0818988159f},
-std::array<float,2>{0.000968659646f, 0.722462416f},
-std::array<float,2>{0.521698833f, 0.848509192f},
-std::array<float,2>{0.37454769f, 0.356228679f},
-std::array<float,2>{0.716366231f, 0.0207326896f},
-std::array<float,2>{0.461916357f, 0.644236267f},
-std::array<float,2>{0.814087152f, 0.756036282f},
-std::array<float,2>{0.156907842f, 0.270086527f},
-std::array<float,2>{0.933604896f, 0.45412457f},
-std::array<float,2>{0.10384085f, 0.969595253f},
-std::array<float,2>{0.585150838f, 0.590864122f},
-std::array<float,2>{0.310845882f, 0.19416301f},
-std::array<float,2>{0.552568913f, 0.341164649f},
-std::array<float,2>{0.320444494f, 0.839663744f},
-std::array<float,2>{0.993318796f, 0.713931262f},
-std::array<float,2>{0.0412753522f, 0.119480006f},
-std::array<float,2>{0.804877877f, 0.180359259f},
-std::array<float,2>{0.211620957f, 0.546769381f},
-std::array<float,2>{0.67958498f, 0.894666433f},
-std::array<float,2>{0.399542451f, 0.377541274f},
-std::array<float,2>{0.687935591f, 0.175388962f},
-std::array<float,2>{0.443511814f, 0.531849444f},
-std::array<float,2>{0.833498418f, 0.899047971f},
-std::array<float,2>{0.186781257f, 0.385756463f},
-std::array<float,2>{0.917374074f, 0.335128158f},
-std::array<float,2>{0.12229009f, 0.833820164f},
-std::array<float,2>{0.577556968f, 0.710628331f},
-std::array<float,2>{0.295525908f, 0.111371398f},
-std::array<float,2>{0.546120763f, 0.467326552f},
-std::array<float,2>{0.33891502f, 0.983033061f},
-std::array<float,2>{0.976247787f, 0.582902968f},
-std::array<float,2>{0.0498877428f, 0.196709692f},
-std::array<float,2>{0.79310751f, 0.0254625715f},
-std::array<float,2>{0.18767339f, 0.65224719f},
-std::array<float,2>{0.658130407f, 0.763789177f},
-std::array<float,2>{0.389301598f, 0.277953774f},
-std::array<float,2>{0.598605812f, 0.0921497345f},
-std::array<float,2>{0.266206205f, 0.730249941f},
-std::array<float,2>{0.904749453f, 0.853460848f},
-std::array<float,2>{0.0654463693f, 0.34608385f},
-std::array<float,2>{0.866654515f, 0.435553551f},
-std::array<float,2>{0.151260749f, 0.934147835f},
-std::array<float,2>{0.726301968f, 0.518883765f},
-std::array<float,2>{0.497794002f, 0.125007644f},
-std::array<float,2>{0.639948249f, 0.312496215f},
-std::array<float,2>{0.409683287f, 0.798317254f},
-std::array<float,2>{0.77734679f, 0.659308434f},
-std::array<float,2>{0.237521723f, 0.0346190147f},
-std::array<float,2>{0.938671887f, 0.235158309f},
-std::array<float,2>{0.0272403173f, 0.604738355f},
-std::array<float,2>{0.504797161f, 0.960028291f},
-std::array<float,2>{0.351520509f, 0.495080858f},
-std::array<float,2>{0.516995311f, 0.207918197f},
-std::array<float,2>{0.367821127f, 0.575750351f},
-std::array<float,2>{0.958883703f, 0.984418213f},
-std::array<float,2>{0.00630815048f, 0.444118708f},
-std::array<float,2>{0.755852222f, 0.260786831f},
-std::array<float,2>{0.220580742f, 0.774540961f},
-std::array<float,2>{0.655462265f, 0.636328042f},
-std::array<float,2>{0.427437395f, 0.0118222171f},
-std::array<float,2>{0.737921417f, 0.403606087f},
-std::array<float,2>{0.476939827f, 0.886763632f},
-std::array<float,2>{0.85242033f, 0.553927541f},
-std::array<float,2>{0.131399557f, 0.168406129f},
-std::array<float,2>{0.882977068f, 0.10074228f},
-std::array<float,2>{0.0933883041f, 0.699617982f},
-std::array<float,2>{0.61016804f, 0.815710545f},
-std::array<float,2>{0.260012567f, 0.317002743f},
-std::array<float,2>{0.672839046f, 0.0555435792f},
-std::array<float,2>{0.405059099f, 0.676736295f},
-std::array<float,2>{0.811631799f, 0.784043193f},
-std::array<float,2>{0.215341389f, 0.295309335f},
-std::array<float,2>{0.996602118f, 0.473713636f},
-std::array<float,2>{0.0444478393f, 0.941749036f},
-std::array<float,2>{0.548672557f, 0.614078999f},
-std::array<float,2>{0.326457053f, 0.222957164f},
-std::array<float,2>{0.578920543f, 0.36929509f},
-std::array<float,2>{0.30754593f, 0.87464565f},
-std::array<float,2>{0.931851447f, 0.742460072f},
-std::array<float,2>{0.10834799f, 0.0762017593f},
-std::array<float,2>{0.818993926f, 0.146667987f},
-std::array<float,2>{0.160846099f, 0.513459086f},
-std::array<float,2>{0.713710725f, 0.92135632f},
-std::array<float,2>{0.468723595f, 0.416899979f},
-std::array<float,2>{0.645298064f, 0.232971579f},
-std::array<float,2>{0.437262356f, 0.622338414f},
-std::array<float,2>{0.759512484f, 0.949111998f},
-std::array<float,2>{0.233855397f, 0.478782922f},
-std::array<float,2>{0.963472426f, 0.287848145f},
-std::array<float,2>{0.00842266437f, 0.795572639f},
-std::array<float,2>{0.530848742f, 0.681651711f},
-std::array<float,2>{0.366816461f, 0.0539981648f},
-std::array<float,2>{0.624164164f, 0.408550799f},
-std::array<float,2>{0.250770092f, 0.909305096f},
-std::array<float,2>{0.881517053f, 0.505559325f},
-std::array<float,2>{0.0802997202f, 0.149323329f},
-std::array<float,2>{0.848617256f, 0.0697622076f},
-std::array<float,2>{0.138316438f, 0.737058997f},
-std::array<float,2>{0.743593633f, 0.861581326f},
-std::array<float,2>{0.473104268f, 0.360503793f},
-std::array<float,2>{0.5581972f, 0.000141921249f},
-std::array<float,2>{0.313902467f, 0.625634432f},
-std::array<float,2>{0.98635608f, 0.773091495f},
-std::array<float,2>{0.0334681273f, 0.253512472f},
-std::array<float,2>{0.803404689f, 0.448439091f},
-std::array<float,2>{0.206073999f, 0.99966085f},
-std::array<float,2>{0.681328475f, 0.566207707f},
-std::array<float,2>{0.395315915f, 0.213695958f},
-std::array<float,2>{0.710285127f, 0.326162189f},
-std::array<float,2>{0.457289934f, 0.823512018f},
-std::array<float,2>{0.824790597f, 0.694026649f},
-std::array<float,2>{0.166902766f, 0.104574934f},
-std::array<float,2>{0.924341202f, 0.157725915f},
-std::array<float,2>{0.0947057158f, 0.559761286f},
-std::array<float,2>{0.588943183f, 0.879590809f},
-std::array<float,2>{0.302260846f, 0.396185011f},
-std::array<float,2>{0.570078552f, 0.139603615f},
-std::array<float,2>{0.281643033f, 0.529823184f},
-std::array<float,2>{0.910846531f, 0.927384198f},
-std::array<float,2>{0.11106202f, 0.423398882f},
-std::array<float,2>{0.83790791f, 0.354236186f},
-std::array<float,2>{0.173263907f, 0.844920456f},
-std::array<float,2>{0.702189445f, 0.723480821f},
-std::array<float,2>{0.451000392f, 0.0832252428f},
-std::array<float,2>{0.668161809f, 0.488867074f},
-std::array<float,2>{0.379036784f, 0.968106389f},
-std::array<float,2>{0.787891626f, 0.595231593f},
-std::array<float,2>{0.200254679f, 0.242251337f},
-std::array<float,2>{0.978936374f, 0.0438467078f},
-std::array<float,2>{0.0552995726f, 0.66992259f},
-std::array<float,2>{0.537709296f, 0.806923926f},
-std::array<float,2>{0.33530274f, 0.302547365f},
-std::array<float,2>{0.728848875f, 0.121810995f},
-std::array<float,2>{0.486001045f, 0.715230882f},
-std::array<float,2>{0.871237993f, 0.840708673f},
-std::array<float,2>{0.142405435f, 0.33807081f},
-std::array<float,2>{0.89785856f, 0.379757524f},
-std::array<float,2>{0.0749518648f, 0.891665518f},
-std::array<float,2>{0.60443604f, 0.539501727f},
-std::array<float,2>{0.279845297f, 0.184055835f},
-std::array<float,2>{0.507829785f, 0.2681382f},
-std::array<float,2>{0.352312058f, 0.753861427f},
-std::array<float,2>{0.952788115f, 0.645463467f},
-std::array<float,2>{0.0214895066f, 0.016094042f},
-std::array<float,2>{0.769299388f, 0.187841266f},
-std::array<float,2>{0.24507302f, 0.589002132f},
-std::array<float,2>{0.629318118f, 0.973303556f},
-std::array<float,2>{0.414832056f, 0.459614962f},
-std::array<float,2>{0.704890728f, 0.239157677f},
-std::array<float,2>{0.454193562f, 0.609212458f},
-std::array<float,2>{0.822815001f, 0.956641555f},
-std::array<float,2>{0.16825752f, 0.496455938f},
-std::array<float,2>{0.927632272f, 0.306169808f},
-std::array<float,2>{0.0998359397f, 0.80171746f},
-std::array<float,2>{0.593511939f, 0.660252213f},
-std::array<float,2>{0.300210536f, 0.0390623026f},
-std::array<float,2>{0.561736941f, 0.432338953f},
-std::array<float,2>{0.318246245f, 0.933377743f},
-std::array<float,2>{0.988720477f, 0.522567153f},
-std::array<float,2>{0.0372930132f, 0.13005057f},
-std::array<float,2>{0.800346553f, 0.0889043808f},
-std::array<float,2>{0.210425898f, 0.733528316f},
-std::array<float,2>{0.685985565f, 0.856705427f},
-std::array<float,2>{0.394053131f, 0.348605692f},
-std::array<float,2>{0.619551778f, 0.029744165f},
-std::array<float,2>{0.255565435f, 0.652809799f},
-std::array<float,2>{0.878694594f, 0.759535253f},
-std::array<float,2>{0.085162729f, 0.274001688f},
-std::array<float,2>{0.844240546f, 0.464247733f},
-std::array<float,2>{0.135436967f, 0.979706645f},
-std::array<float,2>{0.74804914f, 0.578225553f},
-std::array<float,2>{0.471891582f, 0.199231893f},
-std::array<float,2>{0.644509912f, 0.331557512f},
-std::array<float,2>{0.430574149f, 0.830607712f},
-std::array<float,2>{0.762634993f, 0.706212044f},
-std::array<float,2>{0.229780674f, 0.114911236f},
-std::array<float,2>{0.96660459f, 0.177887082f},
-std::array<float,2>{0.0154739767f, 0.53901583f},
-std::array<float,2>{0.525150299f, 0.903148293f},
-std::array<float,2>{0.360376596f, 0.389181554f},
-std::array<float,2>{0.512149096f, 0.140691832f},
-std::array<float,2>{0.359003246f, 0.511294007f},
-std::array<float,2>{0.947326005f, 0.917708039f},
-std::array<float,2>{0.0170575995f, 0.421097904f},
-std::array<float,2>{0.773404241f, 0.371531159f},
-std::array<float,2>{0.247631386f, 0.869617045f},
-std::array<float,2>{0.6286394f, 0.748328447f},
-std::array<float,2>{0.418982744f, 0.0731773749f},
-std::array<float,2>{0.732272863f, 0.469671428f},
-std::array<float,2>{0.488908648f, 0.940273404f},
-std::array<float,2>{0.867757261f, 0.612732768f},
-std::array<float,2>{0.145400912f, 0.220927119f},
-std::array<float,2>{0.892616451f, 0.0598903969f},
-std::array<float,2>{0.0732459724f, 0.675042868f},
-std::array<float,2>{0.608752668f, 0.787813663f},
-std::array<float,2>{0.276745647f, 0.292247176f},
-std::array<float,2>{0.664503515f, 0.0941650346f},
-std::array<float,2>{0.375186473f, 0.698184907f},
-std::array<float,2>{0.783794701f, 0.818937421f},
-std::array<float,2>{0.196812242f, 0.313584566f},
-std::array<float,2>{0.982403159f, 0.402268797f},
-std::array<float,2>{0.0589096881f, 0.883252859f},
-std::array<float,2>{0.533222795f, 0.548531413f},
-std::array<float,2>{0.329283595f, 0.167167783f},
-std::array<float,2>{0.565502346f, 0.263297141f},
-std::array<float,2>{0.286873162f, 0.778694749f},
-std::array<float,2>{0.909364343f, 0.637303114f},
-std::array<float,2>{0.116470769f, 0.00835739542f},
-std::array<float,2>{0.843016684f, 0.205190256f},
-std::array<float,2>{0.1774728f, 0.573928714f},
-std::array<float,2>{0.698014379f, 0.990822852f},
-std::array<float,2>{0.446410656f, 0.438391626f},
-std::array<float,2>{0.635369003f, 0.161724716f},
-std::array<float,2>{0.411122084f, 0.555251896f},
-std::array<float,2>{0.775336385f, 0.875799239f},
-std::array<float,2>{0.238678724f, 0.39210403f},
-std::array<float,2>{0.944830298f, 0.322675079f},
-std::array<float,2>{0.0308436994f, 0.826781809f},
-std::array<float,2>{0.500540495f, 0.690982878f},
-std::array<float,2>{0.346864671f, 0.106829353f},
-std::array<float,2>{0.595101893f, 0.452411205f},
-std::array<float,2>{0.270895451f, 0.993514955f},
-std::array<float,2>{0.901131928f, 0.569828093f},
-std::array<float,2>{0.0671993643f, 0.215879649f},
-std::array<float,2>{0.85984832f, 0.00731550111f},
-std::array<float,2>{0.155476525f, 0.629162669f},
-std::array<float,2>{0.72225076f, 0.766477704f},
-std::array<float,2>{0.492940843f, 0.254842699f},
-std::array<float,2>{0.54143554f, 0.0641521141f},
-std::array<float,2>{0.341810286f, 0.741194963f},
-std::array<float,2>{0.969663203f, 0.86565119f},
-std::array<float,2>{0.0528642461f, 0.363364995f},
-std::array<float,2>{0.790922523f, 0.412129432f},
-std::array<float,2>{0.194110632f, 0.912701786f},
-std::array<float,2>{0.661112666f, 0.501293719f},
-std::array<float,2>{0.38509202f, 0.155323535f},
-std::array<float,2>{0.691928744f, 0.283138573f},
-std::array<float,2>{0.438881457f, 0.792733669f},
-std::array<float,2>{0.82892698f, 0.683831334f},
-std::array<float,2>{0.182873428f, 0.0472990982f},
-std::array<float,2>{0.921096921f, 0.229218006f},
-std::array<float,2>{0.119527921f, 0.61866194f},
-std::array<float,2>{0.574005663f, 0.951014042f},
-std::array<float,2>{0.292202353f, 0.480766892f},
-std::array<float,2>{0.582688332f, 0.191977859f},
-std::array<float,2>{0.310344458f, 0.593061864f},
-std::array<float,2>{0.93736738f, 0.971645951f},
-std::array<float,2>{0.101842396f, 0.456973732f},
-std::array<float,2>{0.814652801f, 0.2726399f},
-std::array<float,2>{0.158331186f, 0.754939497f},
-std::array<float,2>{0.71765846f, 0.641297162f},
-std::array<float,2>{0.463226825f, 0.0224685147f},
-std::array<float,2>{0.675894022f, 0.375286967f},
-std::array<float,2>{0.40080446f, 0.897687435f},
-std::array<float,2>{0.806855202f, 0.543475091f},
-std::array<float,2>{0.213937521f, 0.182860821f},
-std::array<float,2>{0.99466449f, 0.11793866f},
-std::array<float,2>{0.0405970849f, 0.712034941f},
-std::array<float,2>{0.553952694f, 0.837596118f},
-std::array<float,2>{0.323782831f, 0.341915369f},
-std::array<float,2>{0.738619506f, 0.0409920625f},
-std::array<float,2>{0.483971089f, 0.665332496f},
-std::array<float,2>{0.858021975f, 0.810142219f},
-std::array<float,2>{0.12814182f, 0.300078422f},
-std::array<float,2>{0.887048721f, 0.488092482f},
-std::array<float,2>{0.0892095342f, 0.964618444f},
-std::array<float,2>{0.613370657f, 0.600188136f},
-std::array<float,2>{0.263280451f, 0.247992337f},
-std::array<float,2>{0.521351576f, 0.357447445f},
-std::array<float,2>{0.371175438f, 0.851128221f},
-std::array<float,2>{0.956534564f, 0.720508575f},
-std::array<float,2>{0.00252727303f, 0.0797944143f},
-std::array<float,2>{0.753778517f, 0.133987516f},
-std::array<float,2>{0.225243956f, 0.523601174f},
-std::array<float,2>{0.648665547f, 0.925450742f},
-std::array<float,2>{0.424032241f, 0.429430485f},
-std::array<float,2>{0.723465323f, 0.127124861f},
-std::array<float,2>{0.499216527f, 0.515702963f},
-std::array<float,2>{0.864933372f, 0.936591744f},
-std::array<float,2>{0.150234401f, 0.435429841f},
-std::array<float,2>{0.904130638f, 0.344276339f},
-std::array<float,2>{0.0640487298f, 0.855260134f},
-std::array<float,2>{0.600125194f, 0.727071345f},
-std::array<float,2>{0.268390268f, 0.0910305604f},
-std::array<float,2>{0.507638693f, 0.493108779f},
-std::array<float,2>{0.348153144f, 0.957240164f},
-std::array<float,2>{0.940290272f, 0.602577507f},
-std::array<float,2>{0.0236911941f, 0.237422168f},
-std::array<float,2>{0.78046447f, 0.0313681066f},
-std::array<float,2>{0.235623419f, 0.657658339f},
-std::array<float,2>{0.63813889f, 0.799160361f},
-std::array<float,2>{0.407651514f, 0.308971077f},
-std::array<float,2>{0.574911535f, 0.109786004f},
-std::array<float,2>{0.294531018f, 0.7086007f},
-std::array<float,2>{0.915421247f, 0.83489114f},
-std::array<float,2>{0.124957979f, 0.333092541f},
-std::array<float,2>{0.835266173f, 0.383026302f},
-std::array<float,2>{0.184935272f, 0.900556505f},
-std::array<float,2>{0.689745426f, 0.533374548f},
-std::array<float,2>{0.442954987f, 0.173175097f},
-std::array<float,2>{0.65880245f, 0.279401749f},
-std::array<float,2>{0.38689065f, 0.763251901f},
-std::array<float,2>{0.795404255f, 0.648505092f},
-std::array<float,2>{0.189729035f, 0.0251754764f},
-std::array<float,2>{0.973237336f, 0.198487043f},
-std::array<float,2>{0.0482342765f, 0.585736275f},
-std::array<float,2>{0.544796228f, 0.980845213f},
-std::array<float,2>{0.337046415f, 0.465291023f},
-std::array<float,2>{0.550528109f, 0.224808007f},
-std::array<float,2>{0.326009691f, 0.616315067f},
-std::array<float,2>{0.998388529f, 0.944817901f},
-std::array<float,2>{0.046715375f, 0.474679023f},
-std::array<float,2>{0.809443474f, 0.293027014f},
-std::array<float,2>{0.21807158f, 0.781293273f},
-std::array<float,2>{0.675336361f, 0.679396987f},
-std::array<float,2>{0.402638644f, 0.0568885691f},
-std::array<float,2>{0.712629795f, 0.415243536f},
-std::array<float,2>{0.466560334f, 0.918354332f},
-std::array<float,2>{0.817478001f, 0.514135242f},
-std::array<float,2>{0.163112655f, 0.14510107f},
-std::array<float,2>{0.930821657f, 0.0756571069f},
-std::array<float,2>{0.106787972f, 0.745004833f},
-std::array<float,2>{0.581480742f, 0.872748554f},
-std::array<float,2>{0.304915547f, 0.368415594f},
-std::array<float,2>{0.653577566f, 0.0151579892f},
-std::array<float,2>{0.428152204f, 0.633861303f},
-std::array<float,2>{0.756666124f, 0.777038157f},
-std::array<float,2>{0.221001893f, 0.259102464f},
-std::array<float,2>{0.960705519f, 0.442503244f},
-std::array<float,2>{0.00408629095f, 0.987427115f},
-std::array<float,2>{0.518510759f, 0.576318085f},
-std::array<float,2>{0.370118439f, 0.209023133f},
-std::array<float,2>{0.612550914f, 0.318365276f},
-std::array<float,2>{0.258530587f, 0.813467145f},
-std::array<float,2>{0.885702133f, 0.702460468f},
-std::array<float,2>{0.0913557336f, 0.0977506042f},
-std::array<float,2>{0.853959382f, 0.17099826f},
-std::array<float,2>{0.130700678f, 0.551639676f},
-std::array<float,2>{0.735623896f, 0.888839483f},
-std::array<float,2>{0.479157627f, 0.40472585f},
-std::array<float,2>{0.682593286f, 0.211193517f},
-std::array<float,2>{0.396841347f, 0.564363837f},
-std::array<float,2>{0.801236808f, 0.997810721f},
-std::array<float,2>{0.204768002f, 0.445898861f},
-std::array<float,2>{0.985270381f, 0.250935197f},
-std::array<float,2>{0.0319657363f, 0.770103514f},
-std::array<float,2>{0.555380821f, 0.628380597f},
-std::array<float,2>{0.315314353f, 0.00258662668f},
-std::array<float,2>{0.586638272f, 0.397628099f},
-std::array<float,2>{0.302944779f, 0.881149054f},
-std::array<float,2>{0.923561156f, 0.562208772f},
-std::array<float,2>{0.0975071639f, 0.15835689f},
-std::array<float,2>{0.826789558f, 0.102829054f},
-std::array<float,2>{0.16457428f, 0.692471147f},
-std::array<float,2>{0.708960652f, 0.820884824f},
-std::array<float,2>{0.459005982f, 0.32735002f},
-std::array<float,2>{0.527823746f, 0.0521593839f},
-std::array<float,2>{0.364768595f, 0.67990464f},
-std::array<float,2>{0.961869776f, 0.793498576f},
-std::array<float,2>{0.0111676119f, 0.285811692f},
-std::array<float,2>{0.75996691f, 0.478226006f},
-std::array<float,2>{0.23203899f, 0.945473075f},
-std::array<float,2>{0.647933066f, 0.623760223f},
-std::array<float,2>{0.43381542f, 0.231351435f},
-std::array<float,2>{0.744303703f, 0.361359388f},
-std::array<float,2>{0.476514935f, 0.860034943f},
-std::array<float,2>{0.851240098f, 0.735475063f},
-std::array<float,2>{0.139924213f, 0.0674916208f},
-std::array<float,2>{0.880492508f, 0.150664538f},
-std::array<float,2>{0.0783930346f, 0.507394373f},
-std::array<float,2>{0.622766733f, 0.908098578f},
-std::array<float,2>{0.253700107f, 0.40749523f},
-std::array<float,2>{0.601735771f, 0.18577759f},
-std::array<float,2>{0.278063625f, 0.54233098f},
-std::array<float,2>{0.895071208f, 0.892930925f},
-std::array<float,2>{0.0774790719f, 0.381798148f},
-std::array<float,2>{0.874360979f, 0.336347461f},
-std::array<float,2>{0.142689705f, 0.843227088f},
-std::array<float,2>{0.727081716f, 0.718551755f},
-std::array<float,2>{0.487135679f, 0.123062171f},
-std::array<float,2>{0.632572055f, 0.458966881f},
-std::array<float,2>{0.416539848f, 0.974886954f},
-std::array<float,2>{0.76593852f, 0.587369621f},
-std::array<float,2>{0.242451206f, 0.189583048f},
-std::array<float,2>{0.950522602f, 0.0178780388f},
-std::array<float,2>{0.020319175f, 0.646495163f},
-std::array<float,2>{0.511604488f, 0.750783324f},
-std::array<float,2>{0.353906304f, 0.26599884f},
-std::array<float,2>{0.700700343f, 0.0857347026f},
-std::array<float,2>{0.4522174f, 0.72597748f},
-std::array<float,2>{0.836785018f, 0.847369254f},
-std::array<float,2>{0.174883291f, 0.351831436f},
-std::array<float,2>{0.912920952f, 0.423876584f},
-std::array<float,2>{0.111979619f, 0.929497957f},
-std::array<float,2>{0.567491353f, 0.529120445f},
-std::array<float,2>{0.284442246f, 0.137297183f},
-std::array<float,2>{0.536850035f, 0.303652734f},
-std::array<float,2>{0.332478553f, 0.806027174f},
-std::array<float,2>{0.976982236f, 0.668134749f},
-std::array<float,2>{0.0574986525f, 0.0451655164f},
-std::array<float,2>{0.787002921f, 0.244459867f},
-std::array<float,2>{0.201456875f, 0.595778167f},
-std::array<float,2>{0.670922756f, 0.965405941f},
-std::array<float,2>{0.381214321f, 0.491944283f},
-std::array<float,2>{0.708570063f, 0.214382172f},
-std::array<float,2>{0.459247351f, 0.564494431f},
-std::array<float,2>{0.826978266f, 0.998571217f},
-std::array<float,2>{0.164846435f, 0.44783935f},
-std::array<float,2>{0.923759639f, 0.252162546f},
-std::array<float,2>{0.0973316133f, 0.771788538f},
-std::array<float,2>{0.586895287f, 0.626747072f},
-std::array<float,2>{0.303069919f, 0.00185319141f},
-std::array<float,2>{0.555600345f, 0.395347446f},
-std::array<float,2>{0.315089703f, 0.880248964f},
-std::array<float,2>{0.985089421f, 0.559493542f},
-std::array<float,2>{0.0321288407f, 0.157225311f},
-std::array<float,2>{0.800802529f, 0.104485311f},
-std::array<float,2>{0.204849824f, 0.694371283f},
-std::array<float,2>{0.682272077f, 0.822542906f},
-std::array<float,2>{0.396550924f, 0.325172871f},
-std::array<float,2>{0.623012304f, 0.0528388396f},
-std::array<float,2>{0.253487587f, 0.682883561f},
-std::array<float,2>{0.880776405f, 0.796448648f},
-std::array<float,2>{0.0781532377f, 0.289000511f},
-std::array<float,2>{0.851447344f, 0.480229795f},
-std::array<float,2>{0.139804736f, 0.947519183f},
-std::array<float,2>{0.744425654f, 0.621679246f},
-std::array<float,2>{0.476117939f, 0.233583063f},
-std::array<float,2>{0.647579253f, 0.359637588f},
-std::array<float,2>{0.433958977f, 0.862453401f},
-std::array<float,2>{0.760061204f, 0.737981737f},
-std::array<float,2>{0.232212156f, 0.0684346035f},
-std::array<float,2>{0.96149075f, 0.149889871f},
-std::array<float,2>{0.0108562401f, 0.504516423f},
-std::array<float,2>{0.52734381f, 0.908363163f},
-std::array<float,2>{0.365122825f, 0.409578264f},
-std::array<float,2>{0.511343718f, 0.185062245f},
-std::array<float,2>{0.353604198f, 0.540301263f},
-std::array<float,2>{0.950372994f, 0.891505241f},
-std::array<float,2>{0.0202508438f, 0.379913688f},
-std::array<float,2>{0.765785635f, 0.339538366f},
-std::array<float,2>{0.242226034f, 0.84090519f},
-std::array<float,2>{0.632413566f, 0.715880096f},
-std::array<float,2>{0.416817009f, 0.122340672f},
-std::array<float,2>{0.727307916f, 0.460860759f},
-std::array<float,2>{0.486886352f, 0.974098504f},
-std::array<float,2>{0.874085069f, 0.58880955f},
-std::array<float,2>{0.142827719f, 0.188987538f},
-std::array<float,2>{0.895351291f, 0.0170632023f},
-std::array<float,2>{0.0773591399f, 0.6458022f},
-std::array<float,2>{0.602019131f, 0.75230974f},
-std::array<float,2>{0.278115571f, 0.268996775f},
-std::array<float,2>{0.671274185f, 0.082674779f},
-std::array<float,2>{0.380903095f, 0.724511504f},
-std::array<float,2>{0.78680408f, 0.84439379f},
-std::array<float,2>{0.201300994f, 0.354570746f},
-std::array<float,2>{0.976691842f, 0.422158003f},
-std::array<float,2>{0.0571826547f, 0.926128983f},
-std::array<float,2>{0.536998093f, 0.531150341f},
-std::array<float,2>{0.332146555f, 0.139663965f},
-std::array<float,2>{0.567658067f, 0.300935566f},
-std::array<float,2>{0.284181356f, 0.808542848f},
-std::array<float,2>{0.912689388f, 0.67172122f},
-std::array<float,2>{0.112115458f, 0.0446830429f},
-std::array<float,2>{0.836550236f, 0.243359178f},
-std::array<float,2>{0.175273255f, 0.594725192f},
-std::array<float,2>{0.701032281f, 0.967175305f},
-std::array<float,2>{0.452444583f, 0.489836723f},
-std::array<float,2>{0.637860835f, 0.126721993f},
-std::array<float,2>{0.407397479f, 0.517777264f},
-std::array<float,2>{0.780616224f, 0.934926152f},
-std::array<float,2>{0.235525727f, 0.437222958f},
-std::array<float,2>{0.940092087f, 0.347268105f},
-std::array<float,2>{0.0234739203f, 0.851665556f},
-std::array<float,2>{0.507435679f, 0.728958547f},
-std::array<float,2>{0.34849757f, 0.0937472284f},
-std::array<float,2>{0.600350797f, 0.495515883f},
-std::array<float,2>{0.268146455f, 0.959223926f},
-std::array<float,2>{0.904041946f, 0.603624344f},
-std::array<float,2>{0.0642310083f, 0.236046016f},
-std::array<float,2>{0.865150809f, 0.0336243995f},
-std::array<float,2>{0.150134534f, 0.658565283f},
-std::array<float,2>{0.723256588f, 0.797779799f},
-std::array<float,2>{0.499365181f, 0.310548991f},
-std::array<float,2>{0.544653535f, 0.112879694f},
-std::array<float,2>{0.337244004f, 0.709504008f},
-std::array<float,2>{0.973482251f, 0.832636178f},
-std::array<float,2>{0.048009675f, 0.33432439f},
-std::array<float,2>{0.794977188f, 0.385496616f},
-std::array<float,2>{0.189530656f, 0.899890304f},
-std::array<float,2>{0.658988595f, 0.532968879f},
-std::array<float,2>{0.387178689f, 0.174170211f},
-std::array<float,2>{0.68962431f, 0.278573066f},
-std::array<float,2>{0.443225473f, 0.764831364f},
-std::array<float,2>{0.835203826f, 0.650399208f},
-std::array<float,2>{0.184689686f, 0.0265697315f},
-std::array<float,2>{0.915120184f, 0.195859671f},
-std::array<float,2>{0.124634497f, 0.583658874f},
-std::array<float,2>{0.575106144f, 0.983887672f},
-std::array<float,2>{0.294875979f, 0.468024939f},
-std::array<float,2>{0.581076086f, 0.223681301f},
-std::array<float,2>{0.305063277f, 0.6148476f},
-std::array<float,2>{0.931048453f, 0.94268316f},
-std::array<float,2>{0.106533416f, 0.4731718f},
-std::array<float,2>{0.817849994f, 0.296271145f},
-std::array<float,2>{0.163519308f, 0.784468889f},
-std::array<float,2>{0.712816715f, 0.676770627f},
-std::array<float,2>{0.466360569f, 0.0566136129f},
-std::array<float,2>{0.67558372f, 0.417959094f},
-std::array<float,2>{0.402496606f, 0.920565605f},
-std::array<float,2>{0.80923903f, 0.512320638f},
-std::array<float,2>{0.217968106f, 0.148024216f},
-std::array<float,2>{0.998145461f, 0.0773079991f},
-std::array<float,2>{0.0466008037f, 0.743426919f},
-std::array<float,2>{0.550712228f, 0.873676002f},
-std::array<float,2>{0.325732648f, 0.371081412f},
-std::array<float,2>{0.735485733f, 0.0135043198f},
-std::array<float,2>{0.479269773f, 0.634918511f},
-std::array<float,2>{0.853622794f, 0.774033308f},
-std::array<float,2>{0.130562544f, 0.260478497f},
-std::array<float,2>{0.885272861f, 0.444362551f},
-std::array<float,2>{0.0917432383f, 0.985708892f},
-std::array<float,2>{0.612407088f, 0.574812055f},
-std::array<float,2>{0.258721024f, 0.208334982f},
-std::array<float,2>{0.518301725f, 0.317744702f},
-std::array<float,2>{0.370422572f, 0.81533879f},
-std::array<float,2>{0.960623205f, 0.700880945f},
-std::array<float,2>{0.00431638863f, 0.100553505f},
-std::array<float,2>{0.756430745f, 0.169114426f},
-std::array<float,2>{0.220923781f, 0.553697467f},
-std::array<float,2>{0.65354687f, 0.888523936f},
-std::array<float,2>{0.42794618f, 0.402959883f},
-std::array<float,2>{0.722601891f, 0.163595632f},
-std::array<float,2>{0.49270758f, 0.556764305f},
-std::array<float,2>{0.859376371f, 0.878251195f},
-std::array<float,2>{0.155651346f, 0.394323558f},
-std::array<float,2>{0.900936067f, 0.321227193f},
-std::array<float,2>{0.0669067428f, 0.825244546f},
-std::array<float,2>{0.594814122f, 0.688059628f},
-std::array<float,2>{0.270738006f, 0.107793055f},
-std::array<float,2>{0.500767708f, 0.450225174f},
-std::array<float,2>{0.347019225f, 0.995319605f},
-std::array<float,2>{0.94516623f, 0.568134606f},
-std::array<float,2>{0.0310916323f, 0.218424931f},
-std::array<float,2>{0.774948657f, 0.00573634729f},
-std::array<float,2>{0.238467202f, 0.631078184f},
-std::array<float,2>{0.635684609f, 0.767843664f},
-std::array<float,2>{0.410665363f, 0.257352591f},
-std::array<float,2>{0.573795497f, 0.0663806871f},
-std::array<float,2>{0.292239994f, 0.739345908f},
-std::array<float,2>{0.921164811f, 0.864718497f},
-std::array<float,2>{0.119278118f, 0.365342736f},
-std::array<float,2>{0.828632653f, 0.410555691f},
-std::array<float,2>{0.182845324f, 0.910891056f},
-std::array<float,2>{0.692223668f, 0.503083706f},
-std::array<float,2>{0.438563764f, 0.154187649f},
-std::array<float,2>{0.660874844f, 0.28383407f},
-std::array<float,2>{0.38482973f, 0.790050924f},
-std::array<float,2>{0.790737689f, 0.685594499f},
-std::array<float,2>{0.193982139f, 0.050604485f},
-std::array<float,2>{0.96947664f, 0.228499815f},
-std::array<float,2>{0.0530339144f, 0.620584309f},
-std::array<float,2>{0.541255355f, 0.951908231f},
-std::array<float,2>{0.342090398f, 0.482926875f},
-std::array<float,2>{0.553995013f, 0.195006132f},
-std::array<float,2>{0.324147552f, 0.590115368f},
-std::array<float,2>{0.994948566f, 0.970188439f},
-std::array<float,2>{0.0409102961f, 0.45395276f},
-std::array<float,2>{0.806891382f, 0.270510226f},
-std::array<float,2>{0.21431075f, 0.756998777f},
-std::array<float,2>{0.67607981f, 0.642918646f},
-std::array<float,2>{0.400566071f, 0.0201188326f},
-std::array<float,2>{0.717388749f, 0.378337324f},
-std::array<float,2>{0.463119566f, 0.895968199f},
-std::array<float,2>{0.814758956f, 0.545010924f},
-std::array<float,2>{0.158569142f, 0.181162342f},
-std::array<float,2>{0.937025487f, 0.120692886f},
-std::array<float,2>{0.10170202f, 0.712985277f},
-std::array<float,2>{0.582805932f, 0.838221133f},
-std::array<float,2>{0.310059994f, 0.340800881f},
-std::array<float,2>{0.648876309f, 0.041585695f},
-std::array<float,2>{0.424187601f, 0.666979134f},
-std::array<float,2>{0.753624141f, 0.81069684f},
-std::array<float,2>{0.22548683f, 0.297529131f},
-std::array<float,2>{0.956219971f, 0.486093283f},
-std::array<float,2>{0.00280370936f, 0.961919725f},
-std::array<float,2>{0.521108627f, 0.59886384f},
-std::array<float,2>{0.371431977f, 0.248236671f},
-std::array<float,2>{0.613621652f, 0.357187241f},
-std::array<float,2>{0.263568133f, 0.849158227f},
-std::array<float,2>{0.886752486f, 0.72119534f},
-std::array<float,2>{0.0890722945f, 0.0808389559f},
-std::array<float,2>{0.858294547f, 0.135905802f},
-std::array<float,2>{0.128199071f, 0.526529133f},
-std::array<float,2>{0.738508821f, 0.923041523f},
-std::array<float,2>{0.484189481f, 0.427000791f},
-std::array<float,2>{0.685599148f, 0.240302891f},
-std::array<float,2>{0.394294202f, 0.606492162f},
-std::array<float,2>{0.80064404f, 0.953965724f},
-std::array<float,2>{0.210109428f, 0.498562485f},
-std::array<float,2>{0.988368094f, 0.307236373f},
-std::array<float,2>{0.037442524f, 0.803858638f},
-std::array<float,2>{0.561931908f, 0.662484407f},
-std::array<float,2>{0.318115175f, 0.0362267755f},
-std::array<float,2>{0.593439579f, 0.430571556f},
-std::array<float,2>{0.300009161f, 0.930152953f},
-std::array<float,2>{0.927383065f, 0.51972729f},
-std::array<float,2>{0.10006126f, 0.132084489f},
-std::array<float,2>{0.823043287f, 0.0876364037f},
-std::array<float,2>{0.168177128f, 0.730639994f},
-std::array<float,2>{0.704751372f, 0.858411729f},
-std::array<float,2>{0.454430968f, 0.350792736f},
-std::array<float,2>{0.524907053f, 0.0279724542f},
-std::array<float,2>{0.360629499f, 0.656010509f},
-std::array<float,2>{0.96648097f, 0.759874344f},
-std::array<float,2>{0.0152140232f, 0.276221603f},
-std::array<float,2>{0.762210846f, 0.461919457f},
-std::array<float,2>{0.229713872f, 0.976846993f},
-std::array<float,2>{0.644072354f, 0.580319107f},
-std::array<float,2>{0.430187911f, 0.201873869f},
-std::array<float,2>{0.748482883f, 0.329639822f},
-std::array<float,2>{0.472151369f, 0.829259336f},
-std::array<float,2>{0.844672501f, 0.70472759f},
-std::array<float,2>{0.135597914f, 0.116147138f},
-std::array<float,2>{0.878630936f, 0.176920325f},
-std::array<float,2>{0.0853614956f, 0.536270142f},
-std::array<float,2>{0.61932528f, 0.905582488f},
-std::array<float,2>{0.255854666f, 0.387753934f},
-std::array<float,2>{0.608640611f, 0.142987862f},
-std::array<float,2>{0.276562423f, 0.509346187f},
-std::array<float,2>{0.892847776f, 0.914989471f},
-std::array<float,2>{0.0735662058f, 0.418169737f},
-std::array<float,2>{0.868005395f, 0.37423414f},
-std::array<float,2>{0.14515242f, 0.869030356f},
-std::array<float,2>{0.731972337f, 0.746599495f},
-std::array<float,2>{0.489195406f, 0.0708115846f},
-std::array<float,2>{0.628801405f, 0.471307248f},
-std::array<float,2>{0.419378817f, 0.939182103f},
-std::array<float,2>{0.773071885f, 0.609422863f},
-std::array<float,2>{0.247999668f, 0.219879568f},
-std::array<float,2>{0.947565079f, 0.0617057458f},
-std::array<float,2>{0.0167125277f, 0.673585355f},
-std::array<float,2>{0.511871219f, 0.785606861f},
-std::array<float,2>{0.359148681f, 0.290494591f},
-std::array<float,2>{0.697795331f, 0.0963005498f},
-std::array<float,2>{0.446585774f, 0.696649194f},
-std::array<float,2>{0.843206167f, 0.818358839f},
-std::array<float,2>{0.177697837f, 0.31606397f},
-std::array<float,2>{0.909654438f, 0.399181694f},
-std::array<float,2>{0.116336599f, 0.886387527f},
-std::array<float,2>{0.565890729f, 0.550447702f},
-std::array<float,2>{0.286666185f, 0.164385319f},
-std::array<float,2>{0.533471406f, 0.264630914f},
-std::array<float,2>{0.329363883f, 0.78006494f},
-std::array<float,2>{0.982005179f, 0.640362978f},
-std::array<float,2>{0.0588100478f, 0.0115587581f},
-std::array<float,2>{0.784004331f, 0.204632267f},
-std::array<float,2>{0.197177023f, 0.571491003f},
-std::array<float,2>{0.664169431f, 0.988666415f},
-std::array<float,2>{0.375422865f, 0.439711124f},
-std::array<float,2>{0.743219852f, 0.23221828f},
-std::array<float,2>{0.472842842f, 0.624442399f},
-std::array<float,2>{0.848348975f, 0.946843982f},
-std::array<float,2>{0.138535053f, 0.477192461f},
-std::array<float,2>{0.881820261f, 0.286328256f},
-std::array<float,2>{0.0804913864f, 0.794467509f},
-std::array<float,2>{0.624373078f, 0.681623697f},
-std::array<float,2>{0.25066483f, 0.0509033278f},
-std::array<float,2>{0.531225443f, 0.406666666f},
-std::array<float,2>{0.367093921f, 0.906535923f},
-std::array<float,2>{0.963831842f, 0.50592941f},
-std::array<float,2>{0.00863496866f, 0.15162988f},
-std::array<float,2>{0.75971055f, 0.0667827502f},
-std::array<float,2>{0.233473733f, 0.734971166f},
-std::array<float,2>{0.645213544f, 0.860683262f},
-std::array<float,2>{0.437224329f, 0.362328053f},
-std::array<float,2>{0.589175522f, 0.00344956107f},
-std::array<float,2>{0.302519381f, 0.627266645f},
-std::array<float,2>{0.924757063f, 0.770705521f},
-std::array<float,2>{0.0943508595f, 0.251684397f},
-std::array<float,2>{0.825092912f, 0.44711408f},
-std::array<float,2>{0.166537017f, 0.996239543f},
-std::array<float,2>{0.709995568f, 0.563178778f},
-std::array<float,2>{0.457233161f, 0.212659881f},
-std::array<float,2>{0.68146652f, 0.326366872f},
-std::array<float,2>{0.395170748f, 0.821408093f},
-std::array<float,2>{0.803569794f, 0.691988289f},
-std::array<float,2>{0.206334785f, 0.10217756f},
-std::array<float,2>{0.986769795f, 0.159880683f},
-std::array<float,2>{0.0334312506f, 0.56109786f},
-std::array<float,2>{0.558383763f, 0.881993711f},
-std::array<float,2>{0.313554674f, 0.397398174f},
-std::array<float,2>{0.538069069f, 0.138214827f},
-std::array<float,2>{0.335056156f, 0.527828157f},
-std::array<float,2>{0.978663146f, 0.927846909f},
-std::array<float,2>{0.0556222647f, 0.425048679f},
-std::array<float,2>{0.787635207f, 0.35304451f},
-std::array<float,2>{0.200590178f, 0.84620291f},
-std::array<float,2>{0.668288171f, 0.724768996f},
-std::array<float,2>{0.379150718f, 0.0844371095f},
-std::array<float,2>{0.702567577f, 0.490381688f},
-std::array<float,2>{0.450879097f, 0.966468751f},
-std::array<float,2>{0.838318765f, 0.596731424f},
-std::array<float,2>{0.172999054f, 0.245456606f},
-std::array<float,2>{0.911107481f, 0.0459569134f},
-std::array<float,2>{0.111286357f, 0.669120789f},
-std::array<float,2>{0.569904506f, 0.80522728f},
-std::array<float,2>{0.281451613f, 0.304412276f},
-std::array<float,2>{0.629036844f, 0.124189325f},
-std::array<float,2>{0.414785802f, 0.717646301f},
-std::array<float,2>{0.769285798f, 0.842079639f},
-std::array<float,2>{0.244659305f, 0.337429196f},
-std::array<float,2>{0.953121483f, 0.382189214f},
-std::array<float,2>{0.0218683127f, 0.894324005f},
-std::array<float,2>{0.508227468f, 0.541443229f},
-std::array<float,2>{0.352256179f, 0.186640278f},
-std::array<float,2>{0.604148924f, 0.266899168f},
-std::array<float,2>{0.280268759f, 0.751926601f},
-std::array<float,2>{0.897532642f, 0.647579789f},
-std::array<float,2>{0.0749412328f, 0.0192687549f},
-std::array<float,2>{0.871342719f, 0.190747485f},
-std::array<float,2>{0.142115131f, 0.586339116f},
-std::array<float,2>{0.728642166f, 0.975749671f},
-std::array<float,2>{0.486084074f, 0.45748958f},
-std::array<float,2>{0.65787077f, 0.172051072f},
-std::array<float,2>{0.389581561f, 0.534594417f},
-std::array<float,2>{0.793363988f, 0.901773691f},
-std::array<float,2>{0.187808499f, 0.38450247f},
-std::array<float,2>{0.97634989f, 0.332611948f},
-std::array<float,2>{0.0501268618f, 0.835699439f},
-std::array<float,2>{0.546246529f, 0.707300425f},
-std::array<float,2>{0.339336276f, 0.110459916f},
-std::array<float,2>{0.577282429f, 0.46614781f},
-std::array<float,2>{0.295822382f, 0.982000947f},
-std::array<float,2>{0.917167902f, 0.584078193f},
-std::array<float,2>{0.122522324f, 0.197345376f},
-std::array<float,2>{0.83393085f, 0.0235675108f},
-std::array<float,2>{0.18661359f, 0.649426281f},
-std::array<float,2>{0.687614858f, 0.762471914f},
-std::array<float,2>{0.443823427f, 0.280738175f},
-std::array<float,2>{0.504634559f, 0.0907114595f},
-std::array<float,2>{0.351250976f, 0.727946162f},
-std::array<float,2>{0.938835025f, 0.853982389f},
-std::array<float,2>{0.0268658493f, 0.345160782f},
-std::array<float,2>{0.777725041f, 0.433930367f},
-std::array<float,2>{0.237572059f, 0.935619056f},
-std::array<float,2>{0.639730692f, 0.516718447f},
-std::array<float,2>{0.409939945f, 0.127939299f},
-std::array<float,2>{0.726348877f, 0.310140431f},
-std::array<float,2>{0.49800837f, 0.800135851f},
-std::array<float,2>{0.86631006f, 0.657022238f},
-std::array<float,2>{0.150968611f, 0.0329426564f},
-std::array<float,2>{0.904500663f, 0.236371592f},
-std::array<float,2>{0.0658476353f, 0.602323413f},
-std::array<float,2>{0.598258376f, 0.95879519f},
-std::array<float,2>{0.266413659f, 0.49391982f},
-std::array<float,2>{0.609910429f, 0.210704878f},
-std::array<float,2>{0.259794354f, 0.578108788f},
-std::array<float,2>{0.883115709f, 0.986486197f},
-std::array<float,2>{0.0935663357f, 0.442216069f},
-std::array<float,2>{0.852120519f, 0.258039147f},
-std::array<float,2>{0.131635055f, 0.775672197f},
-std::array<float,2>{0.738039792f, 0.633583248f},
-std::array<float,2>{0.47658062f, 0.0137782013f},
-std::array<float,2>{0.655690908f, 0.405395687f},
-std::array<float,2>{0.427656025f, 0.890044391f},
-std::array<float,2>{0.755371511f, 0.552731812f},
-std::array<float,2>{0.220410734f, 0.170496687f},
-std::array<float,2>{0.958737195f, 0.0991391391f},
-std::array<float,2>{0.00597597426f, 0.701966226f},
-std::array<float,2>{0.516649067f, 0.814164817f},
-std::array<float,2>{0.367945582f, 0.319779724f},
-std::array<float,2>{0.713406861f, 0.0578501076f},
-std::array<float,2>{0.468490392f, 0.678027928f},
-std::array<float,2>{0.819105804f, 0.782519579f},
-std::array<float,2>{0.161056653f, 0.29396686f},
-std::array<float,2>{0.932121515f, 0.476114213f},
-std::array<float,2>{0.107972175f, 0.943590999f},
-std::array<float,2>{0.578733206f, 0.616181791f},
-std::array<float,2>{0.307293415f, 0.22610496f},
-std::array<float,2>{0.54855454f, 0.367787868f},
-std::array<float,2>{0.326182961f, 0.871776462f},
-std::array<float,2>{0.99699831f, 0.746027112f},
-std::array<float,2>{0.0447861664f, 0.0742884427f},
-std::array<float,2>{0.812003434f, 0.14589268f},
-std::array<float,2>{0.21565859f, 0.515568435f},
-std::array<float,2>{0.672511756f, 0.919604719f},
-std::array<float,2>{0.404899091f, 0.414740831f},
-std::array<float,2>{0.693955064f, 0.154552296f},
-std::array<float,2>{0.439833283f, 0.500660121f},
-std::array<float,2>{0.831518888f, 0.913715303f},
-std::array<float,2>{0.181353286f, 0.413238794f},
-std::array<float,2>{0.918789625f, 0.364585161f},
-std::array<float,2>{0.117535934f, 0.866582096f},
-std::array<float,2>{0.572118044f, 0.741515219f},
-std::array<float,2>{0.290235311f, 0.0625856742f},
-std::array<float,2>{0.539479077f, 0.48234117f},
-std::array<float,2>{0.340248168f, 0.949850559f},
-std::array<float,2>{0.971593082f, 0.61770004f},
-std::array<float,2>{0.052114673f, 0.229593992f},
-std::array<float,2>{0.791453898f, 0.0483033992f},
-std::array<float,2>{0.193014294f, 0.685417116f},
-std::array<float,2>{0.66332984f, 0.791448474f},
-std::array<float,2>{0.383067459f, 0.281964391f},
-std::array<float,2>{0.596052527f, 0.106019862f},
-std::array<float,2>{0.272124887f, 0.689659238f},
-std::array<float,2>{0.898928881f, 0.82729739f},
-std::array<float,2>{0.0694784895f, 0.323534399f},
-std::array<float,2>{0.863101184f, 0.390993029f},
-std::array<float,2>{0.153847516f, 0.876450658f},
-std::array<float,2>{0.718916655f, 0.556037068f},
-std::array<float,2>{0.495394439f, 0.160887197f},
-std::array<float,2>{0.633372426f, 0.255429119f},
-std::array<float,2>{0.413879216f, 0.767256737f},
-std::array<float,2>{0.776601851f, 0.63031286f},
-std::array<float,2>{0.24218592f, 0.00630545244f},
-std::array<float,2>{0.943251789f, 0.215090066f},
-std::array<float,2>{0.0292615574f, 0.568494976f},
-std::array<float,2>{0.503120184f, 0.992972434f},
-std::array<float,2>{0.344962209f, 0.451629013f},
-std::array<float,2>{0.521784484f, 0.246213064f},
-std::array<float,2>{0.374758184f, 0.601239026f},
-std::array<float,2>{0.95504868f, 0.963048995f},
-std::array<float,2>{0.000647985551f, 0.486471474f},
-std::array<float,2>{0.751213253f, 0.299424052f},
-std::array<float,2>{0.222716689f, 0.809284449f},
-std::array<float,2>{0.65148139f, 0.664513886f},
-std::array<float,2>{0.422299951f, 0.0395051241f},
-std::array<float,2>{0.742094219f, 0.427856773f},
-std::array<float,2>{0.480637908f, 0.923832417f},
-std::array<float,2>{0.855550587f, 0.524538279f},
-std::array<float,2>{0.125826016f, 0.133483365f},
-std::array<float,2>{0.889702797f, 0.0785180777f},
-std::array<float,2>{0.0865802243f, 0.718826175f},
-std::array<float,2>{0.616253972f, 0.849636793f},
-std::array<float,2>{0.264732569f, 0.358441412f},
-std::array<float,2>{0.679258585f, 0.0217575822f},
-std::array<float,2>{0.399836391f, 0.641833186f},
-std::array<float,2>{0.805108905f, 0.754168928f},
-std::array<float,2>{0.211790189f, 0.271491617f},
-std::array<float,2>{0.99360007f, 0.455221087f},
-std::array<float,2>{0.0411288701f, 0.972320378f},
-std::array<float,2>{0.552413762f, 0.592206299f},
-std::array<float,2>{0.32057336f, 0.193167537f},
-std::array<float,2>{0.585438013f, 0.343638748f},
-std::array<float,2>{0.310788691f, 0.836416543f},
-std::array<float,2>{0.933908403f, 0.711129129f},
-std::array<float,2>{0.103691317f, 0.118601218f},
-std::array<float,2>{0.814349055f, 0.181904346f},
-std::array<float,2>{0.157118708f, 0.544657648f},
-std::array<float,2>{0.716745853f, 0.896565974f},
-std::array<float,2>{0.462162107f, 0.376428455f},
-std::array<float,2>{0.64208889f, 0.201129928f},
-std::array<float,2>{0.433123171f, 0.579601288f},
-std::array<float,2>{0.765440166f, 0.979486883f},
-std::array<float,2>{0.226575702f, 0.463783085f},
-std::array<float,2>{0.967624485f, 0.274792582f},
-std::array<float,2>{0.0136197833f, 0.758212268f},
-std::array<float,2>{0.526945114f, 0.653362513f},
-std::array<float,2>{0.362024933f, 0.0308239385f},
-std::array<float,2>{0.618041277f, 0.390624046f},
-std::array<float,2>{0.255859673f, 0.903604686f},
-std::array<float,2>{0.876434565f, 0.537412465f},
-std::array<float,2>{0.0835235268f, 0.179597303f},
-std::array<float,2>{0.847211063f, 0.113962516f},
-std::array<float,2>{0.132894486f, 0.705307305f},
-std::array<float,2>{0.747570693f, 0.831513762f},
-std::array<float,2>{0.468876064f, 0.330163151f},
-std::array<float,2>{0.558863521f, 0.0379239433f},
-std::array<float,2>{0.320134461f, 0.661955714f},
-std::array<float,2>{0.991727412f, 0.802074254f},
-std::array<float,2>{0.0367797948f, 0.305028141f},
-std::array<float,2>{0.798698187f, 0.497866154f},
-std::array<float,2>{0.20827654f, 0.955424428f},
-std::array<float,2>{0.684622765f, 0.607465863f},
-std::array<float,2>{0.39160949f, 0.24022305f},
-std::array<float,2>{0.706782758f, 0.34932363f},
-std::array<float,2>{0.455651611f, 0.855921507f},
-std::array<float,2>{0.820485115f, 0.73309052f},
-std::array<float,2>{0.170959502f, 0.0887703001f},
-std::array<float,2>{0.929526508f, 0.12968266f},
-std::array<float,2>{0.0993692204f, 0.521892846f},
-std::array<float,2>{0.589844704f, 0.932338357f},
-std::array<float,2>{0.29849121f, 0.433240712f},
-std::array<float,2>{0.563447595f, 0.16655238f},
-std::array<float,2>{0.287641048f, 0.547765195f},
-std::array<float,2>{0.907981753f, 0.884234071f},
-std::array<float,2>{0.113902204f, 0.401215881f},
-std::array<float,2>{0.84152782f, 0.313341439f},
-std::array<float,2>{0.179257572f, 0.820005357f},
-std::array<float,2>{0.695612788f, 0.698561668f},
-std::array<float,2>{0.44860658f, 0.0956278816f},
-std::array<float,2>{0.666882038f, 0.438580126f},
-std::array<float,2>{0.377171457f, 0.992015958f},
-std::array<float,2>{0.78207773f, 0.57261008f},
-std::array<float,2>{0.198472172f, 0.206949547f},
-std::array<float,2>{0.983717084f, 0.00918824971f},
-std::array<float,2>{0.0610895045f, 0.638322711f},
-std::array<float,2>{0.532794356f, 0.778311789f},
-std::array<float,2>{0.331792533f, 0.262210339f},
-std::array<float,2>{0.73276639f, 0.0738797337f},
-std::array<float,2>{0.491041154f, 0.749249637f},
-std::array<float,2>{0.869913101f, 0.870183408f},
-std::array<float,2>{0.147290871f, 0.37302503f},
-std::array<float,2>{0.892548025f, 0.420579076f},
-std::array<float,2>{0.0706783384f, 0.916701198f},
-std::array<float,2>{0.606978774f, 0.510411024f},
-std::array<float,2>{0.273917973f, 0.142241433f},
-std::array<float,2>{0.514933527f, 0.29120025f},
-std::array<float,2>{0.356065482f, 0.788190544f},
-std::array<float,2>{0.945894241f, 0.674776912f},
-std::array<float,2>{0.0179643966f, 0.059108045f},
-std::array<float,2>{0.769918084f, 0.222000077f},
-std::array<float,2>{0.248103827f, 0.611708403f},
-std::array<float,2>{0.625405073f, 0.940841496f},
-std::array<float,2>{0.420324415f, 0.469899565f},
-std::array<float,2>{0.730151713f, 0.188089609f},
-std::array<float,2>{0.484420598f, 0.589808583f},
-std::array<float,2>{0.872943223f, 0.972656727f},
-std::array<float,2>{0.141225994f, 0.459428787f},
-std::array<float,2>{0.896995306f, 0.267703235f},
-std::array<float,2>{0.0761653259f, 0.753197551f},
-std::array<float,2>{0.605041206f, 0.644946694f},
-std::array<float,2>{0.281206846f, 0.0165790878f},
-std::array<float,2>{0.509621263f, 0.379252732f},
-std::array<float,2>{0.35267365f, 0.892314315f},
-std::array<float,2>{0.951997936f, 0.539747834f},
-std::array<float,2>{0.0230798032f, 0.184254289f},
-std::array<float,2>{0.767916739f, 0.121499576f},
-std::array<float,2>{0.245496228f, 0.715377688f},
-std::array<float,2>{0.630689323f, 0.839951217f},
-std::array<float,2>{0.415814966f, 0.33865431f},
-std::array<float,2>{0.569234669f, 0.043070402f},
-std::array<float,2>{0.282337904f, 0.670539618f},
-std::array<float,2>{0.911845982f, 0.807221413f},
-std::array<float,2>{0.109471448f, 0.30215016f},
-std::array<float,2>{0.839331448f, 0.488662034f},
-std::array<float,2>{0.17272462f, 0.968643188f},
-std::array<float,2>{0.7014305f, 0.594766617f},
-std::array<float,2>{0.450051516f, 0.242994398f},
-std::array<float,2>{0.669120073f, 0.353773117f},
-std::array<float,2>{0.380810678f, 0.845304191f},
-std::array<float,2>{0.788682938f, 0.723142028f},
-std::array<float,2>{0.199887827f, 0.0838131681f},
-std::array<float,2>{0.97977227f, 0.138962373f},
-std::array<float,2>{0.05617195f, 0.529650748f},
-std::array<float,2>{0.538854659f, 0.927224159f},
-std::array<float,2>{0.334527403f, 0.423175305f},
-std::array<float,2>{0.557123065f, 0.157401398f},
-std::array<float,2>{0.313319683f, 0.56041497f},
-std::array<float,2>{0.987672508f, 0.878929853f},
-std::array<float,2>{0.034973368f, 0.395744026f},
-std::array<float,2>{0.804670155f, 0.325476468f},
-std::array<float,2>{0.205507785f, 0.823995173f},
-std::array<float,2>{0.679878414f, 0.693609238f},
-std::array<float,2>{0.39591378f, 0.105333529f},
-std::array<float,2>{0.709542096f, 0.449215084f},
-std::array<float,2>{0.45882082f, 0.999190927f},
-std::array<float,2>{0.825604498f, 0.565701365f},
-std::array<float,2>{0.167316601f, 0.213265896f},
-std::array<float,2>{0.925040424f, 0.000776838337f},
-std::array<float,2>{0.0949946642f, 0.625308633f},
-std::array<float,2>{0.588148654f, 0.772540092f},
-std::array<float,2>{0.301299989f, 0.253138423f},
-std::array<float,2>{0.645531297f, 0.0701716244f},
-std::array<float,2>{0.435548991f, 0.736623645f},
-std::array<float,2>{0.758138835f, 0.861863136f},
-std::array<float,2>{0.233242929f, 0.361284912f},
-std::array<float,2>{0.964394093f, 0.408941001f},
-std::array<float,2>{0.00923711248f, 0.909698069f},
-std::array<float,2>{0.529420435f, 0.505064666f},
-std::array<float,2>{0.36592558f, 0.148836732f},
-std::array<float,2>{0.623304129f, 0.287127376f},
-std::array<float,2>{0.251598477f, 0.795239329f},
-std::array<float,2>{0.882334769f, 0.682568252f},
-std::array<float,2>{0.0813916922f, 0.0544124395f},
-std::array<float,2>{0.84889704f, 0.232902512f},
-std::array<float,2>{0.136749342f, 0.622845054f},
-std::array<float,2>{0.742999136f, 0.948491335f},
-std::array<float,2>{0.474531412f, 0.479243845f},
-std::array<float,2>{0.672959924f, 0.147370219f},
-std::array<float,2>{0.405871123f, 0.512996733f},
-std::array<float,2>{0.810971737f, 0.921718001f},
-std::array<float,2>{0.216464445f, 0.416216701f},
-std::array<float,2>{0.997673154f, 0.369711936f},
-std::array<float,2>{0.0438269302f, 0.874054253f},
-std::array<float,2>{0.546953022f, 0.742916524f},
-std::array<float,2>{0.327428311f, 0.0766857341f},
-std::array<float,2>{0.579633653f, 0.474122912f},
-std::array<float,2>{0.308407396f, 0.94192183f},
-std::array<float,2>{0.933242023f, 0.613469243f},
-std::array<float,2>{0.108711183f, 0.223239407f},
-std::array<float,2>{0.81979382f, 0.0549809895f},
-std::array<float,2>{0.161244333f, 0.676079988f},
-std::array<float,2>{0.714286566f, 0.783245802f},
-std::array<float,2>{0.467651457f, 0.295452356f},
-std::array<float,2>{0.516427577f, 0.101425566f},
-std::array<float,2>{0.368596911f, 0.700001061f},
-std::array<float,2>{0.957104862f, 0.816127658f},
-std::array<float,2>{0.0071880389f, 0.3168042f},
-std::array<float,2>{0.75465703f, 0.403944254f},
-std::array<float,2>{0.21922268f, 0.887463212f},
-std::array<float,2>{0.65470928f, 0.554338396f},
-std::array<float,2>{0.426324755f, 0.168678403f},
-std::array<float,2>{0.737237394f, 0.261572868f},
-std::array<float,2>{0.477593631f, 0.775110364f},
-std::array<float,2>{0.852594912f, 0.636111498f},
-std::array<float,2>{0.131962672f, 0.0125952912f},
-std::array<float,2>{0.884376585f, 0.207042128f},
-std::array<float,2>{0.0920206904f, 0.575681984f},
-std::array<float,2>{0.610705078f, 0.984935999f},
-std::array<float,2>{0.261378258f, 0.443523467f},
-std::array<float,2>{0.599100232f, 0.234656811f},
-std::array<float,2>{0.266700566f, 0.605280459f},
-std::array<float,2>{0.906223059f, 0.960757136f},
-std::array<float,2>{0.0652685612f, 0.494316816f},
-std::array<float,2>{0.865876138f, 0.311682194f},
-std::array<float,2>{0.152335882f, 0.798805773f},
-std::array<float,2>{0.724702299f, 0.659835458f},
-std::array<float,2>{0.497019678f, 0.0349235274f},
-std::array<float,2>{0.638822556f, 0.436435044f},
-std::array<float,2>{0.408230454f, 0.933624625f},
-std::array<float,2>{0.779204071f, 0.519082785f},
-std::array<float,2>{0.236405f, 0.125923425f},
-std::array<float,2>{0.938248634f, 0.092322804f},
-std::array<float,2>{0.0254245084f, 0.72955811f},
-std::array<float,2>{0.505311847f, 0.852958322f},
-std::array<float,2>{0.350025177f, 0.346464455f},
-std::array<float,2>{0.689384699f, 0.0262758881f},
-std::array<float,2>{0.444567233f, 0.651494205f},
-std::array<float,2>{0.832772613f, 0.764180422f},
-std::array<float,2>{0.185875505f, 0.277387738f},
-std::array<float,2>{0.916672409f, 0.467121482f},
-std::array<float,2>{0.122056477f, 0.982812941f},
-std::array<float,2>{0.576324046f, 0.582199037f},
-std::array<float,2>{0.296155363f, 0.19700627f},
-std::array<float,2>{0.545482397f, 0.335452586f},
-std::array<float,2>{0.33806473f, 0.833398223f},
-std::array<float,2>{0.974774063f, 0.710156441f},
-std::array<float,2>{0.0497556143f, 0.112250224f},
-std::array<float,2>{0.794543326f, 0.175231501f},
-std::array<float,2>{0.18884176f, 0.531637192f},
-std::array<float,2>{0.657095313f, 0.898627639f},
-std::array<float,2>{0.390590072f, 0.386546493f},
-std::array<float,2>{0.715610504f, 0.179778099f},
-std::array<float,2>{0.461437106f, 0.54626888f},
-std::array<float,2>{0.813266397f, 0.895161211f},
-std::array<float,2>{0.157432273f, 0.377039462f},
-std::array<float,2>{0.935061693f, 0.34165895f},
-std::array<float,2>{0.104828402f, 0.838991761f},
-std::array<float,2>{0.584945858f, 0.714566708f},
-std::array<float,2>{0.311920524f, 0.119701356f},
-std::array<float,2>{0.551191151f, 0.4548316f},
-std::array<float,2>{0.322262436f, 0.968866169f},
-std::array<float,2>{0.992522418f, 0.59131217f},
-std::array<float,2>{0.0424033627f, 0.193406358f},
-std::array<float,2>{0.806335449f, 0.0212020427f},
-std::array<float,2>{0.21248889f, 0.643671215f},
-std::array<float,2>{0.678572416f, 0.756626785f},
-std::array<float,2>{0.398674756f, 0.269766092f},
-std::array<float,2>{0.615473568f, 0.0814760402f},
-std::array<float,2>{0.264477223f, 0.721973956f},
-std::array<float,2>{0.888730049f, 0.847771347f},
-std::array<float,2>{0.0878886133f, 0.355860978f},
-std::array<float,2>{0.856919169f, 0.426683336f},
-std::array<float,2>{0.125979379f, 0.922850132f},
-std::array<float,2>{0.740475595f, 0.526218653f},
-std::array<float,2>{0.482075691f, 0.13557376f},
-std::array<float,2>{0.650493026f, 0.298534632f},
-std::array<float,2>{0.423608035f, 0.812355995f},
-std::array<float,2>{0.750276566f, 0.667492032f},
-std::array<float,2>{0.224512562f, 0.0427848287f},
-std::array<float,2>{0.954015911f, 0.249325603f},
-std::array<float,2>{0.0012032066f, 0.598170459f},
-std::array<float,2>{0.522789657f, 0.960975647f},
-std::array<float,2>{0.373358607f, 0.484516114f},
-std::array<float,2>{0.502927184f, 0.217006832f},
-std::array<float,2>{0.344513953f, 0.566433549f},
-std::array<float,2>{0.942371607f, 0.994756997f},
-std::array<float,2>{0.0283199549f, 0.44950521f},
-std::array<float,2>{0.775984108f, 0.256394565f},
-std::array<float,2>{0.240724459f, 0.768679321f},
-std::array<float,2>{0.633825898f, 0.632208228f},
-std::array<float,2>{0.412805855f, 0.00395730976f},
-std::array<float,2>{0.719741166f, 0.392917931f},
-std::array<float,2>{0.494534403f, 0.877672434f},
-std::array<float,2>{0.86153996f, 0.558009744f},
-std::array<float,2>{0.152849704f, 0.162915021f},
-std::array<float,2>{0.899736524f, 0.108593591f},
-std::array<float,2>{0.0686046332f, 0.68906945f},
-std::array<float,2>{0.597281098f, 0.824832976f},
-std::array<float,2>{0.272753239f, 0.322214067f},
-std::array<float,2>{0.662189245f, 0.0495395884f},
-std::array<float,2>{0.383856177f, 0.687321544f},
-std::array<float,2>{0.792714596f, 0.789325953f},
-std::array<float,2>{0.191577002f, 0.284950286f},
-std::array<float,2>{0.972058892f, 0.483775347f},
-std::array<float,2>{0.0511943921f, 0.952384531f},
-std::array<float,2>{0.54089886f, 0.619393766f},
-std::array<float,2>{0.340925068f, 0.226928622f},
-std::array<float,2>{0.571280897f, 0.366271645f},
-std::array<float,2>{0.289735585f, 0.863600314f},
-std::array<float,2>{0.918964386f, 0.738420606f},
-std::array<float,2>{0.118848652f, 0.0651773736f},
-std::array<float,2>{0.83025676f, 0.152907699f},
-std::array<float,2>{0.179933175f, 0.502436578f},
-std::array<float,2>{0.69482547f, 0.912062526f},
-std::array<float,2>{0.440612584f, 0.411854208f},
-std::array<float,2>{0.62670505f, 0.219132826f},
-std::array<float,2>{0.421585709f, 0.611154854f},
-std::array<float,2>{0.770592213f, 0.937967718f},
-std::array<float,2>{0.249069482f, 0.472353041f},
-std::array<float,2>{0.946595073f, 0.289933026f},
-std::array<float,2>{0.0186642669f, 0.786190391f},
-std::array<float,2>{0.51427269f, 0.672833443f},
-std::array<float,2>{0.35741654f, 0.0614710003f},
-std::array<float,2>{0.605707169f, 0.419365883f},
-std::array<float,2>{0.274492085f, 0.915449619f},
-std::array<float,2>{0.89133811f, 0.508676648f},
-std::array<float,2>{0.0720268786f, 0.143605754f},
-std::array<float,2>{0.870535016f, 0.0714028776f},
-std::array<float,2>{0.148037702f, 0.747304499f},
-std::array<float,2>{0.733525395f, 0.867896616f},
-std::array<float,2>{0.491493464f, 0.373799145f},
-std::array<float,2>{0.531530499f, 0.00992037915f},
-std::array<float,2>{0.330701351f, 0.639296353f},
-std::array<float,2>{0.982997417f, 0.781120658f},
-std::array<float,2>{0.0622577146f, 0.265096456f},
-std::array<float,2>{0.782597542f, 0.441182286f},
-std::array<float,2>{0.197931036f, 0.989834189f},
-std::array<float,2>{0.667157292f, 0.571103156f},
-std::array<float,2>{0.378217459f, 0.203168511f},
-std::array<float,2>{0.697071373f, 0.314736575f},
-std::array<float,2>{0.447328627f, 0.816804171f},
-std::array<float,2>{0.839854598f, 0.69617188f},
-std::array<float,2>{0.178584993f, 0.097206004f},
-std::array<float,2>{0.907035768f, 0.165680289f},
-std::array<float,2>{0.114498705f, 0.549482286f},
-std::array<float,2>{0.56378293f, 0.884893715f},
-std::array<float,2>{0.288985074f, 0.400000989f},
-std::array<float,2>{0.590878904f, 0.131700024f},
-std::array<float,2>{0.297702521f, 0.520730674f},
-std::array<float,2>{0.928161502f, 0.931048572f},
-std::array<float,2>{0.0983218253f, 0.431533992f},
-std::array<float,2>{0.821734607f, 0.349757046f},
-std::array<float,2>{0.170324937f, 0.85764432f},
-std::array<float,2>{0.705702722f, 0.732021809f},
-std::array<float,2>{0.456624538f, 0.0860319361f},
-std::array<float,2>{0.684116721f, 0.499765217f},
-std::array<float,2>{0.390663177f, 0.954475284f},
-std::array<float,2>{0.79760474f, 0.60619992f},
-std::array<float,2>{0.207148716f, 0.241501898f},
-std::array<float,2>{0.991037667f, 0.035622295f},
-std::array<float,2>{0.0356505774f, 0.663225412f},
-std::array<float,2>{0.559697986f, 0.802908361f},
-std::array<float,2>{0.318579316f, 0.308232814f},
-std::array<float,2>{0.746367216f, 0.116302818f},
-std::array<float,2>{0.470199049f, 0.703230262f},
-std::array<float,2>{0.846571088f, 0.828569353f},
-std::array<float,2>{0.134371802f, 0.328563601f},
-std::array<float,2>{0.875141442f, 0.387499243f},
-std::array<float,2>{0.082084015f, 0.905123293f},
-std::array<float,2>{0.618965149f, 0.535183907f},
-std::array<float,2>{0.257277399f, 0.176515251f},
-std::array<float,2>{0.525751948f, 0.277171046f},
-std::array<float,2>{0.362607867f, 0.761487305f},
-std::array<float,2>{0.968493938f, 0.65480125f},
-std::array<float,2>{0.0125117423f, 0.0286626872f},
-std::array<float,2>{0.763845146f, 0.202158153f},
-std::array<float,2>{0.22824347f, 0.581737578f},
-std::array<float,2>{0.641095221f, 0.978276849f},
-std::array<float,2>{0.431689471f, 0.461570084f},
-std::array<float,2>{0.700194418f, 0.244857669f},
-std::array<float,2>{0.451451063f, 0.596582651f},
-std::array<float,2>{0.837678075f, 0.965319157f},
-std::array<float,2>{0.17402342f, 0.491376996f},
-std::array<float,2>{0.913704991f, 0.303121507f},
-std::array<float,2>{0.112973087f, 0.806503057f},
-std::array<float,2>{0.566843569f, 0.668751299f},
-std::array<float,2>{0.283572674f, 0.0458594747f},
-std::array<float,2>{0.535921574f, 0.424321413f},
-std::array<float,2>{0.333899945f, 0.928712785f},
-std::array<float,2>{0.978140771f, 0.528656662f},
-std::array<float,2>{0.058123339f, 0.137056962f},
-std::array<float,2>{0.785792232f, 0.0850434154f},
-std::array<float,2>{0.202673525f, 0.726310253f},
-std::array<float,2>{0.670798838f, 0.847071171f},
-std::array<float,2>{0.382402748f, 0.352431297f},
-std::array<float,2>{0.603506863f, 0.0180708412f},
-std::array<float,2>{0.278421968f, 0.647148848f},
-std::array<float,2>{0.895662904f, 0.750089109f},
-std::array<float,2>{0.0762591213f, 0.26626122f},
-std::array<float,2>{0.873942792f, 0.458435744f},
-std::array<float,2>{0.143801942f, 0.975390315f},
-std::array<float,2>{0.728089392f, 0.58745414f},
-std::array<float,2>{0.487339109f, 0.190310612f},
-std::array<float,2>{0.631418705f, 0.336775482f},
-std::array<float,2>{0.417244315f, 0.843422115f},
-std::array<float,2>{0.76730293f, 0.71791774f},
-std::array<float,2>{0.243556023f, 0.123540618f},
-std::array<float,2>{0.949484885f, 0.18633993f},
-std::array<float,2>{0.0205432549f, 0.54260242f},
-std::array<float,2>{0.510093927f, 0.893396854f},
-std::array<float,2>{0.354942262f, 0.380996644f},
-std::array<float,2>{0.528687954f, 0.150998771f},
-std::array<float,2>{0.363984257f, 0.507009923f},
-std::array<float,2>{0.9625144f, 0.907611072f},
-std::array<float,2>{0.0106078144f, 0.407945484f},
-std::array<float,2>{0.761286438f, 0.361862987f},
-std::array<float,2>{0.231324747f, 0.85952723f},
-std::array<float,2>{0.647158444f, 0.736318886f},
-std::array<float,2>{0.435295194f, 0.068297796f},
-std::array<float,2>{0.745397449f, 0.477771938f},
-std::array<float,2>{0.475166172f, 0.946032465f},
-std::array<float,2>{0.849670649f, 0.623522341f},
-std::array<float,2>{0.138945773f, 0.23050417f},
-std::array<float,2>{0.879711926f, 0.0526495427f},
-std::array<float,2>{0.0793764964f, 0.680527627f},
-std::array<float,2>{0.621167183f, 0.792995274f},
-std::array<float,2>{0.25290525f, 0.285638332f},
-std::array<float,2>{0.682715535f, 0.103328384f},
-std::array<float,2>{0.398416162f, 0.692992389f},
-std::array<float,2>{0.802051961f, 0.820416689f},
-std::array<float,2>{0.203919485f, 0.32782343f},
-std::array<float,2>{0.98592937f, 0.398070037f},
-std::array<float,2>{0.0326585919f, 0.881445527f},
-std::array<float,2>{0.556271732f, 0.561824679f},
-std::array<float,2>{0.31625694f, 0.158846945f},
-std::array<float,2>{0.587024868f, 0.250265598f},
-std::array<float,2>{0.303794801f, 0.769703507f},
-std::array<float,2>{0.922385812f, 0.628585756f},
-std::array<float,2>{0.0962328389f, 0.0021789039f},
-std::array<float,2>{0.827798843f, 0.211869076f},
-std::array<float,2>{0.16511026f, 0.563648522f},
-std::array<float,2>{0.707526624f, 0.997358203f},
-std::array<float,2>{0.460652798f, 0.445761621f},
-std::array<float,2>{0.652493596f, 0.171606317f},
-std::array<float,2>{0.429648489f, 0.55085212f},
-std::array<float,2>{0.757239342f, 0.88924402f},
-std::array<float,2>{0.222315237f, 0.404789597f},
-std::array<float,2>{0.95991528f, 0.319169283f},
-std::array<float,2>{0.00508159539f, 0.812767386f},
-std::array<float,2>{0.519218087f, 0.703032196f},
-std::array<float,2>{0.370025486f, 0.0986207426f},
-std::array<float,2>{0.611558139f, 0.443183005f},
-std::array<float,2>{0.259347707f, 0.988196135f},
-std::array<float,2>{0.885936856f, 0.57671684f},
-std::array<float,2>{0.0907980651f, 0.209615827f},
-std::array<float,2>{0.854860306f, 0.0149764484f},
-std::array<float,2>{0.128987387f, 0.63461256f},
-std::array<float,2>{0.734736383f, 0.776421487f},
-std::array<float,2>{0.480343461f, 0.259337038f},
-std::array<float,2>{0.54949677f, 0.0761477873f},
-std::array<float,2>{0.324369133f, 0.744198561f},
-std::array<float,2>{0.9998523f, 0.872346997f},
-std::array<float,2>{0.0458591096f, 0.368708789f},
-std::array<float,2>{0.809807658f, 0.415830284f},
-std::array<float,2>{0.217068583f, 0.918511212f},
-std::array<float,2>{0.674788535f, 0.514560282f},
-std::array<float,2>{0.403766066f, 0.1449534f},
-std::array<float,2>{0.711237252f, 0.293793648f},
-std::array<float,2>{0.465753794f, 0.781864524f},
-std::array<float,2>{0.816841185f, 0.679017425f},
-std::array<float,2>{0.162626058f, 0.0575299524f},
-std::array<float,2>{0.929728627f, 0.225255683f},
-std::array<float,2>{0.106251955f, 0.616994202f},
-std::array<float,2>{0.580263436f, 0.944964826f},
-std::array<float,2>{0.305801928f, 0.475463063f},
-std::array<float,2>{0.57557559f, 0.198959127f},
-std::array<float,2>{0.293485403f, 0.585406005f},
-std::array<float,2>{0.914167762f, 0.981069744f},
-std::array<float,2>{0.123116069f, 0.465703338f},
-std::array<float,2>{0.83439827f, 0.279972196f},
-std::array<float,2>{0.184033602f, 0.762954354f},
-std::array<float,2>{0.690859199f, 0.64923197f},
-std::array<float,2>{0.441888332f, 0.0245237034f},
-std::array<float,2>{0.659289777f, 0.383451045f},
-std::array<float,2>{0.388031244f, 0.901230931f},
-std::array<float,2>{0.796533048f, 0.533870518f},
-std::array<float,2>{0.191320732f, 0.173413202f},
-std::array<float,2>{0.974127948f, 0.110295713f},
-std::array<float,2>{0.0478338264f, 0.70807153f},
-std::array<float,2>{0.543540478f, 0.834470987f},
-std::array<float,2>{0.336090773f, 0.333621889f},
-std::array<float,2>{0.724499583f, 0.0319861323f},
-std::array<float,2>{0.498461217f, 0.65798986f},
-std::array<float,2>{0.863306463f, 0.799410164f},
-std::array<float,2>{0.148661673f, 0.309418648f},
-std::array<float,2>{0.902621329f, 0.492514312f},
-std::array<float,2>{0.0627260953f, 0.95783323f},
-std::array<float,2>{0.601409674f, 0.603468359f},
-std::array<float,2>{0.268692493f, 0.238190845f},
-std::array<float,2>{0.506234109f, 0.344100475f},
-std::array<float,2>{0.348643839f, 0.854762971f},
-std::array<float,2>{0.941140115f, 0.72680068f},
-std::array<float,2>{0.0251605473f, 0.0915976465f},
-std::array<float,2>{0.779564261f, 0.127507672f},
-std::array<float,2>{0.235074654f, 0.516263366f},
-std::array<float,2>{0.637330234f, 0.937143028f},
-std::array<float,2>{0.406269073f, 0.435050547f},
-std::array<float,2>{0.73946321f, 0.134758472f},
-std::array<float,2>{0.483210176f, 0.524303257f},
-std::array<float,2>{0.858667731f, 0.924963892f},
-std::array<float,2>{0.127230167f, 0.428931803f},
-std::array<float,2>{0.888301313f, 0.358265817f},
-std::array<float,2>{0.0882446244f, 0.850699306f},
-std::array<float,2>{0.614507258f, 0.719803512f},
-std::array<float,2>{0.261746526f, 0.0794659555f},
-std::array<float,2>{0.51953882f, 0.487792164f},
-std::array<float,2>{0.372419149f, 0.963987648f},
-std::array<float,2>{0.955432236f, 0.599789202f},
-std::array<float,2>{0.00367949461f, 0.24715203f},
-std::array<float,2>{0.752096057f, 0.0404281132f},
-std::array<float,2>{0.226463363f, 0.665862858f},
-std::array<float,2>{0.649565995f, 0.809949279f},
-std::array<float,2>{0.425062776f, 0.300556093f},
-std::array<float,2>{0.583607793f, 0.117224619f},
-std::array<float,2>{0.309074014f, 0.712683916f},
-std::array<float,2>{0.936441183f, 0.837110877f},
-std::array<float,2>{0.102743469f, 0.342352688f},
-std::array<float,2>{0.815647244f, 0.375556171f},
-std::array<float,2>{0.160110757f, 0.898332417f},
-std::array<float,2>{0.718428195f, 0.543020844f},
-std::array<float,2>{0.464434564f, 0.183566108f},
-std::array<float,2>{0.677329123f, 0.272978634f},
-std::array<float,2>{0.401949644f, 0.75568378f},
-std::array<float,2>{0.808395624f, 0.640890718f},
-std::array<float,2>{0.213445544f, 0.0233729966f},
-std::array<float,2>{0.995408237f, 0.191643491f},
-std::array<float,2>{0.0395063683f, 0.593326569f},
-std::array<float,2>{0.5530743f, 0.971161127f},
-std::array<float,2>{0.322349072f, 0.456415385f},
-std::array<float,2>{0.542398036f, 0.228916109f},
-std::array<float,2>{0.343336284f, 0.618288159f},
-std::array<float,2>{0.969824135f, 0.950374544f},
-std::array<float,2>{0.0540197566f, 0.481046528f},
-std::array<float,2>{0.78969419f, 0.28265518f},
-std::array<float,2>{0.195165858f, 0.792187393f},
-std::array<float,2>{0.661609054f, 0.684347332f},
-std::array<float,2>{0.386061043f, 0.0475076698f},
-std::array<float,2>{0.693334401f, 0.41288802f},
-std::array<float,2>{0.437850267f, 0.912219226f},
-std::array<float,2>{0.829989135f, 0.501644254f},
-std::array<float,2>{0.182180911f, 0.155812398f},
-std::array<float,2>{0.920008898f, 0.0637071878f},
-std::array<float,2>{0.120313399f, 0.740400016f},
-std::array<float,2>{0.572738111f, 0.865764022f},
-std::array<float,2>{0.291196197f, 0.364120811f},
-std::array<float,2>{0.635900319f, 0.00774346525f},
-std::array<float,2>{0.411616892f, 0.62973088f},
-std::array<float,2>{0.774139762f, 0.765792549f},
-std::array<float,2>{0.239753783f, 0.253921866f},
-std::array<float,2>{0.944227993f, 0.453046888f},
-std::array<float,2>{0.0296132173f, 0.993774176f},
-std::array<float,2>{0.501152873f, 0.569476604f},
-std::array<float,2>{0.345784009f, 0.216333941f},
-std::array<float,2>{0.594377041f, 0.322807431f},
-std::array<float,2>{0.270013958f, 0.826513827f},
-std::array<float,2>{0.901902497f, 0.69070977f},
-std::array<float,2>{0.0681258738f, 0.106964834f},
-std::array<float,2>{0.86078155f, 0.16145514f},
-std::array<float,2>{0.155260667f, 0.554743707f},
-std::array<float,2>{0.721511424f, 0.875080168f},
-std::array<float,2>{0.493768483f, 0.391689897f},
-std::array<float,2>{0.665590823f, 0.205811262f},
-std::array<float,2>{0.376891404f, 0.573577821f},
-std::array<float,2>{0.78464061f, 0.990379155f},
-std::array<float,2>{0.195564181f, 0.437868208f},
-std::array<float,2>{0.980529666f, 0.263084352f},
-std::array<float,2>{0.0604633652f, 0.779196501f},
-std::array<float,2>{0.534656584f, 0.636874139f},
-std::array<float,2>{0.328767896f, 0.00820861477f},
-std::array<float,2>{0.565157115f, 0.401830137f},
-std::array<float,2>{0.285201043f, 0.883391917f},
-std::array<float,2>{0.909058452f, 0.547858357f},
-std::array<float,2>{0.116019368f, 0.167644784f},
-std::array<float,2>{0.842345357f, 0.0946684107f},
-std::array<float,2>{0.176408887f, 0.697673202f},
-std::array<float,2>{0.699115932f, 0.818839431f},
-std::array<float,2>{0.445748925f, 0.314019293f},
-std::array<float,2>{0.513342202f, 0.0604815558f},
-std::array<float,2>{0.35839054f, 0.675521135f},
-std::array<float,2>{0.948858082f, 0.787453294f},
-std::array<float,2>{0.0156413428f, 0.292842627f},
-std::array<float,2>{0.771884561f, 0.468879044f},
-std::array<float,2>{0.246732965f, 0.939679801f},
-std::array<float,2>{0.627018631f, 0.612908483f},
-std::array<float,2>{0.418764383f, 0.221357703f},
-std::array<float,2>{0.730551541f, 0.37201339f},
-std::array<float,2>{0.489394039f, 0.869769275f},
-std::array<float,2>{0.868905962f, 0.748843074f},
-std::array<float,2>{0.146220073f, 0.0727021247f},
-std::array<float,2>{0.893689334f, 0.141154766f},
-std::array<float,2>{0.072588779f, 0.511128843f},
-std::array<float,2>{0.607436955f, 0.917173922f},
-std::array<float,2>{0.275566369f, 0.421710312f},
-std::array<float,2>{0.620963156f, 0.178515881f},
-std::array<float,2>{0.254776061f, 0.538341582f},
-std::array<float,2>{0.877808511f, 0.902490795f},
-std::array<float,2>{0.0842025578f, 0.389020801f},
-std::array<float,2>{0.845379472f, 0.331509084f},
-std::array<float,2>{0.136028573f, 0.830210745f},
-std::array<float,2>{0.749531746f, 0.706985176f},
-std::array<float,2>{0.471673638f, 0.114352703f},
-std::array<float,2>{0.643073559f, 0.464500964f},
-std::array<float,2>{0.431151539f, 0.980260491f},
-std::array<float,2>{0.763337851f, 0.578854144f},
-std::array<float,2>{0.228653207f, 0.199777365f},
-std::array<float,2>{0.965057254f, 0.0302099623f},
-std::array<float,2>{0.0137073519f, 0.653296411f},
-std::array<float,2>{0.523938417f, 0.758824587f},
-std::array<float,2>{0.359681666f, 0.273726702f},
-std::array<float,2>{0.703714907f, 0.08978609f},
-std::array<float,2>{0.453980088f, 0.734086514f},
-std::array<float,2>{0.823789477f, 0.85708344f},
-std::array<float,2>{0.16919221f, 0.347782075f},
-std::array<float,2>{0.925784647f, 0.432124257f},
-std::array<float,2>{0.100893989f, 0.933085322f},
-std::array<float,2>{0.592137277f, 0.523034453f},
-std::array<float,2>{0.299011797f, 0.130425408f},
-std::array<float,2>{0.561418295f, 0.305943102f},
-std::array<float,2>{0.317268521f, 0.801070869f},
-std::array<float,2>{0.989811182f, 0.660853088f},
-std::array<float,2>{0.0382448547f, 0.0385291874f},
-std::array<float,2>{0.798934639f, 0.238420174f},
-std::array<float,2>{0.209732652f, 0.60874325f},
-std::array<float,2>{0.686986268f, 0.956057131f},
-std::array<float,2>{0.393528879f, 0.496674091f},
-std::array<float,2>{0.691016734f, 0.19631812f},
-std::array<float,2>{0.442209959f, 0.582758367f},
-std::array<float,2>{0.834612429f, 0.983368218f},
-std::array<float,2>{0.184385851f, 0.467728466f},
-std::array<float,2>{0.914800644f, 0.278179467f},
-std::array<float,2>{0.123762734f, 0.764060915f},
-std::array<float,2>{0.576090217f, 0.651903987f},
-std::array<float,2>{0.293113053f, 0.025810102f},
-std::array<float,2>{0.543054163f, 0.386165947f},
-std::array<float,2>{0.336525172f, 0.899205387f},
-std::array<float,2>{0.973996341f, 0.532201469f},
-std::array<float,2>{0.0468928255f, 0.175705031f},
-std::array<float,2>{0.796022236f, 0.11164666f},
-std::array<float,2>{0.190698221f, 0.710874677f},
-std::array<float,2>{0.660105467f, 0.833729088f},
-std::array<float,2>{0.388525128f, 0.335281193f},
-std::array<float,2>{0.600915074f, 0.034238115f},
-std::array<float,2>{0.269168288f, 0.659473956f},
-std::array<float,2>{0.903283358f, 0.798083007f},
-std::array<float,2>{0.0632659346f, 0.312176555f},
-std::array<float,2>{0.863893151f, 0.494665056f},
-std::array<float,2>{0.148969233f, 0.960227787f},
-std::array<float,2>{0.723867238f, 0.604538143f},
-std::array<float,2>{0.498862654f, 0.235049516f},
-std::array<float,2>{0.63707608f, 0.345796257f},
-std::array<float,2>{0.407002568f, 0.853045464f},
-std::array<float,2>{0.780211091f, 0.729981184f},
-std::array<float,2>{0.234587803f, 0.0919782966f},
-std::array<float,2>{0.940847993f, 0.125306219f},
-std::array<float,2>{0.0246144198f, 0.518681526f},
-std::array<float,2>{0.506360948f, 0.934523225f},
-std::array<float,2>{0.349384278f, 0.435813397f},
-std::array<float,2>{0.518626213f, 0.167985663f},
-std::array<float,2>{0.369541287f, 0.554156959f},
-std::array<float,2>{0.95934099f, 0.886968672f},
-std::array<float,2>{0.00554856844f, 0.40334776f},
-std::array<float,2>{0.757755816f, 0.317294925f},
-std::array<float,2>{0.222054482f, 0.815663993f},
-std::array<float,2>{0.653176129f, 0.699372232f},
-std::array<float,2>{0.428975582f, 0.100983158f},
-std::array<float,2>{0.735097826f, 0.44388184f},
-std::array<float,2>{0.479886591f, 0.984628499f},
-std::array<float,2>{0.855047703f, 0.57603991f},
-std::array<float,2>{0.129604653f, 0.20753099f},
-std::array<float,2>{0.886569321f, 0.0121037243f},
-std::array<float,2>{0.0901167542f, 0.636558712f},
-std::array<float,2>{0.612101436f, 0.774672747f},
-std::array<float,2>{0.258814633f, 0.261045843f},
-std::array<float,2>{0.674121857f, 0.0765114501f},
-std::array<float,2>{0.404047161f, 0.742329836f},
-std::array<float,2>{0.810151994f, 0.874850929f},
-std::array<float,2>{0.217540026f, 0.369415998f},
-std::array<float,2>{0.999045968f, 0.416672617f},
-std::array<float,2>{0.0449360199f, 0.920958161f},
-std::array<float,2>{0.549010754f, 0.513343394f},
-std::array<float,2>{0.324956775f, 0.146848053f},
-std::array<float,2>{0.5807302f, 0.295112878f},
-std::array<float,2>{0.306502223f, 0.783791482f},
-std::array<float,2>{0.930644512f, 0.676496506f},
-std::array<float,2>{0.105566494f, 0.0554023832f},
-std::array<float,2>{0.817165077f, 0.222700164f},
-std::array<float,2>{0.162190437f, 0.613853633f},
-std::array<float,2>{0.711907744f, 0.941544056f},
-std::array<float,2>{0.465182632f, 0.474117994f},
-std::array<float,2>{0.646561444f, 0.149041012f},
-std::array<float,2>{0.434742659f, 0.505856216f},
-std::array<float,2>{0.76094991f, 0.909582436f},
-std::array<float,2>{0.23084113f, 0.408342451f},
-std::array<float,2>{0.961955369f, 0.360829592f},
-std::array<float,2>{0.0101591768f, 0.861334741f},
-std::array<float,2>{0.529253602f, 0.737152219f},
-std::array<float,2>{0.363636971f, 0.0695243478f},
-std::array<float,2>{0.621840656f, 0.478660971f},
-std::array<float,2>{0.252394617f, 0.948882699f},
-std::array<float,2>{0.879021108f, 0.622205734f},
-std::array<float,2>{0.0796393156f, 0.2332616f},
-std::array<float,2>{0.850434899f, 0.0537169352f},
-std::array<float,2>{0.13940011f, 0.682055175f},
-std::array<float,2>{0.745938718f, 0.795747817f},
-std::array<float,2>{0.474786162f, 0.287613422f},
-std::array<float,2>{0.556130707f, 0.104744047f},
-std::array<float,2>{0.315814763f, 0.694174051f},
-std::array<float,2>{0.985514045f, 0.823410034f},
-std::array<float,2>{0.0330071524f, 0.325741768f},
-std::array<float,2>{0.802410066f, 0.396243006f},
-std::array<float,2>{0.203550398f, 0.8798033f},
-std::array<float,2>{0.683279037f, 0.560034454f},
-std::array<float,2>{0.397912443f, 0.157989889f},
-std::array<float,2>{0.707357228f, 0.253879219f},
-std::array<float,2>{0.460229456f, 0.773317397f},
-std::array<float,2>{0.827277601f, 0.62594825f},
-std::array<float,2>{0.16585657f, 0.000362622173f},
-std::array<float,2>{0.921952784f, 0.213429898f},
-std::array<float,2>{0.0957068577f, 0.565984845f},
-std::array<float,2>{0.587787926f, 0.999787033f},
-std::array<float,2>{0.304225683f, 0.448678702f},
-std::array<float,2>{0.567214906f, 0.242575169f},
-std::array<float,2>{0.283823252f, 0.595701933f},
-std::array<float,2>{0.913491845f, 0.967903435f},
-std::array<float,2>{0.112772211f, 0.489246964f},
-std::array<float,2>{0.837310374f, 0.302259654f},
-std::array<float,2>{0.174433231f, 0.806829989f},
-std::array<float,2>{0.699346542f, 0.670309424f},
-std::array<float,2>{0.451876491f, 0.0434749722f},
-std::array<float,2>{0.670257747f, 0.423740804f},
-std::array<float,2>{0.382090807f, 0.927599847f},
-std::array<float,2>{0.785300314f, 0.530138433f},
-std::array<float,2>{0.202590674f, 0.139201447f},
-std::array<float,2>{0.978006363f, 0.0834670737f},
-std::array<float,2>{0.0579223186f, 0.723196983f},
-std::array<float,2>{0.535253167f, 0.845081866f},
-std::array<float,2>{0.333415091f, 0.354331911f},
-std::array<float,2>{0.727672994f, 0.0157611091f},
-std::array<float,2>{0.487832606f, 0.645159423f},
-std::array<float,2>{0.873471379f, 0.753555536f},
-std::array<float,2>{0.14443022f, 0.268524796f},
-std::array<float,2>{0.89600265f, 0.459851056f},
-std::array<float,2>{0.076939024f, 0.973576188f},
-std::array<float,2>{0.602892876f, 0.58918792f},
-std::array<float,2>{0.278865218f, 0.187547714f},
-std::array<float,2>{0.510263741f, 0.338353336f},
-std::array<float,2>{0.355160773f, 0.840392053f},
-std::array<float,2>{0.95008409f, 0.714949787f},
-std::array<float,2>{0.0213126075f, 0.121899873f},
-std::array<float,2>{0.766836882f, 0.183815509f},
-std::array<float,2>{0.244036525f, 0.53918463f},
-std::array<float,2>{0.631079853f, 0.891948819f},
-std::array<float,2>{0.417516083f, 0.379457265f},
-std::array<float,2>{0.749097228f, 0.176199645f},
-std::array<float,2>{0.470952481f, 0.535844386f},
-std::array<float,2>{0.844856262f, 0.904350281f},
-std::array<float,2>{0.136683926f, 0.387172967f},
-std::array<float,2>{0.877190292f, 0.329000592f},
-std::array<float,2>{0.0845062733f, 0.828957915f},
-std::array<float,2>{0.620160937f, 0.703752697f},
-std::array<float,2>{0.254281044f, 0.116827905f},
-std::array<float,2>{0.523495078f, 0.461195767f},
-std::array<float,2>{0.360302776f, 0.977959752f},
-std::array<float,2>{0.965531886f, 0.581330121f},
-std::array<float,2>{0.0143738259f, 0.202693224f},
-std::array<float,2>{0.763168991f, 0.029249467f},
-std::array<float,2>{0.22902593f, 0.654759586f},
-std::array<float,2>{0.643049955f, 0.760776281f},
-std::array<float,2>{0.431616306f, 0.276589364f},
-std::array<float,2>{0.592630506f, 0.0867409855f},
-std::array<float,2>{0.29964453f, 0.731912374f},
-std::array<float,2>{0.926548541f, 0.858159125f},
-std::array<float,2>{0.101433232f, 0.350305289f},
-std::array<float,2>{0.823446333f, 0.430734843f},
-std::array<float,2>{0.169564724f, 0.931572318f},
-std::array<float,2>{0.703506231f, 0.52111876f},
-std::array<float,2>{0.453475446f, 0.130869508f},
-std::array<float,2>{0.687416434f, 0.307738602f},
-std::array<float,2>{0.392959028f, 0.803589225f},
-std::array<float,2>{0.799728215f, 0.663583636f},
-std::array<float,2>{0.209111616f, 0.0357524082f},
-std::array<float,2>{0.989565313f, 0.241881743f},
-std::array<float,2>{0.0389262028f, 0.605769813f},
-std::array<float,2>{0.560695648f, 0.954684615f},
-std::array<float,2>{0.316683739f, 0.499128759f},
-std::array<float,2>{0.534745753f, 0.203973994f},
-std::array<float,2>{0.3282969f, 0.570647597f},
-std::array<float,2>{0.981009483f, 0.989521265f},
-std::array<float,2>{0.0600400716f, 0.440755457f},
-std::array<float,2>{0.784905612f, 0.265497118f},
-std::array<float,2>{0.195911735f, 0.780519783f},
-std::array<float,2>{0.665320039f, 0.639000237f},
-std::array<float,2>{0.376416266f, 0.0107170977f},
-std::array<float,2>{0.698285222f, 0.399460346f},
-std::array<float,2>{0.445870697f, 0.885382116f},
-std::array<float,2>{0.841805637f, 0.549092233f},
-std::array<float,2>{0.176028684f, 0.165362105f},
-std::array<float,2>{0.908625424f, 0.0969275832f},
-std::array<float,2>{0.115697712f, 0.69532305f},
-std::array<float,2>{0.564625919f, 0.817268074f},
-std::array<float,2>{0.285983056f, 0.315310061f},
-std::array<float,2>{0.627774894f, 0.0605982244f},
-std::array<float,2>{0.418443531f, 0.672317445f},
-std::array<float,2>{0.772118926f, 0.786622107f},
-std::array<float,2>{0.246465907f, 0.289455771f},
-std::array<float,2>{0.948483646f, 0.471735716f},
-std::array<float,2>{0.0165917538f, 0.938325167f},
-std::array<float,2>{0.513104916f, 0.610779524f},
-std::array<float,2>{0.357583553f, 0.219400227f},
-std::array<float,2>{0.608126342f, 0.373446852f},
-std::array<float,2>{0.275901705f, 0.867422342f},
-std::array<float,2>{0.894353211f, 0.747760534f},
-std::array<float,2>{0.0729157031f, 0.0722506046f},
-std::array<float,2>{0.868493915f, 0.144148737f},
-std::array<float,2>{0.145708025f, 0.508189797f},
-std::array<float,2>{0.731200457f, 0.915845037f},
-std::array<float,2>{0.490078509f, 0.419533432f},
-std::array<float,2>{0.661845684f, 0.227490187f},
-std::array<float,2>{0.386259973f, 0.619840145f},
-std::array<float,2>{0.789518952f, 0.952725649f},
-std::array<float,2>{0.194805115f, 0.483982772f},
-std::array<float,2>{0.970691741f, 0.284253299f},
-std::array<float,2>{0.054255642f, 0.789654911f},
-std::array<float,2>{0.542884707f, 0.686760068f},
-std::array<float,2>{0.343145549f, 0.0491756201f},
-std::array<float,2>{0.572917879f, 0.411597103f},
-std::array<float,2>{0.291776538f, 0.911188424f},
-std::array<float,2>{0.920506895f, 0.502482116f},
-std::array<float,2>{0.120858848f, 0.152534544f},
-std::array<float,2>{0.829144061f, 0.0646724105f},
-std::array<float,2>{0.181656405f, 0.738865614f},
-std::array<float,2>{0.692751706f, 0.863980949f},
-std::array<float,2>{0.438244671f, 0.36688292f},
-std::array<float,2>{0.501588941f, 0.00440521166f},
-std::array<float,2>{0.346592784f, 0.632539332f},
-std::array<float,2>{0.943462729f, 0.769325256f},
-std::array<float,2>{0.0298127439f, 0.256134629f},
-std::array<float,2>{0.7738778f, 0.450011045f},
-std::array<float,2>{0.239717871f, 0.994544327f},
-std::array<float,2>{0.636487544f, 0.566901624f},
-std::array<float,2>{0.411868006f, 0.217362687f},
-std::array<float,2>{0.720932841f, 0.32149905f},
-std::array<float,2>{0.493457437f, 0.824383497f},
-std::array<float,2>{0.861139774f, 0.688917577f},
-std::array<float,2>{0.154562712f, 0.109221101f},
-std::array<float,2>{0.901533067f, 0.162154987f},
-std::array<float,2>{0.067577228f, 0.558230221f},
-std::array<float,2>{0.594210029f, 0.877401114f},
-std::array<float,2>{0.27018404f, 0.393503845f},
-std::array<float,2>{0.614800394f, 0.134809598f},
-std::array<float,2>{0.262306571f, 0.52549237f},
-std::array<float,2>{0.887752473f, 0.922204912f},
-std::array<float,2>{0.0887726247f, 0.425819069f},
-std::array<float,2>{0.85921824f, 0.35607025f},
-std::array<float,2>{0.127617612f, 0.848158658f},
-std::array<float,2>{0.740232706f, 0.722406507f},
-std::array<float,2>{0.482510626f, 0.0816937983f},
-std::array<float,2>{0.649968326f, 0.485158831f},
-std::array<float,2>{0.425705373f, 0.961745322f},
-std::array<float,2>{0.752602994f, 0.598045349f},
-std::array<float,2>{0.225685224f, 0.249781415f},
-std::array<float,2>{0.956002116f, 0.042419672f},
-std::array<float,2>{0.00317805423f, 0.667368293f},
-std::array<float,2>{0.520160019f, 0.811611891f},
-std::array<float,2>{0.372912616f, 0.297870308f},
-std::array<float,2>{0.718208015f, 0.119380765f},
-std::array<float,2>{0.463882059f, 0.714190066f},
-std::array<float,2>{0.815920413f, 0.839592576f},
-std::array<float,2>{0.159455806f, 0.341044247f},
-std::array<float,2>{0.935763538f, 0.377763569f},
-std::array<float,2>{0.103129104f, 0.894927859f},
-std::array<float,2>{0.583040476f, 0.546450794f},
-std::array<float,2>{0.309382081f, 0.18058832f},
-std::array<float,2>{0.553257227f, 0.270311356f},
-std::array<float,2>{0.322937995f, 0.756245852f},
-std::array<float,2>{0.995867491f, 0.644474208f},
-std::array<float,2>{0.0398080163f, 0.0207723863f},
-std::array<float,2>{0.807804227f, 0.193995774f},
-std::array<float,2>{0.213010177f, 0.591259658f},
-std::array<float,2>{0.677183568f, 0.96931684f},
-std::array<float,2>{0.401657552f, 0.454451144f},
-std::array<float,2>{0.725558043f, 0.237787783f},
-std::array<float,2>{0.496497542f, 0.602924585f},
-std::array<float,2>{0.865546942f, 0.957461596f},
-std::array<float,2>{0.151812539f, 0.492790043f},
-std::array<float,2>{0.905395746f, 0.308643341f},
-std::array<float,2>{0.0646473393f, 0.798907876f},
-std::array<float,2>{0.599279046f, 0.657326937f},
-std::array<float,2>{0.267123252f, 0.0315275416f},
-std::array<float,2>{0.505714059f, 0.435162187f},
-std::array<float,2>{0.350464225f, 0.93689245f},
-std::array<float,2>{0.937894404f, 0.515957713f},
-std::array<float,2>{0.0259025954f, 0.127326325f},
-std::array<float,2>{0.77863425f, 0.0911051035f},
-std::array<float,2>{0.237294734f, 0.727303624f},
-std::array<float,2>{0.639470696f, 0.855091333f},
-std::array<float,2>{0.408732951f, 0.344534487f},
-std::array<float,2>{0.576777995f, 0.0251404587f},
-std::array<float,2>{0.296474993f, 0.64888382f},
-std::array<float,2>{0.91624254f, 0.763519287f},
-std::array<float,2>{0.121372864f, 0.279741317f},
-std::array<float,2>{0.832072318f, 0.465079516f},
-std::array<float,2>{0.186204702f, 0.980633676f},
-std::array<float,2>{0.688641727f, 0.585602283f},
-std::array<float,2>{0.44519183f, 0.198486254f},
-std::array<float,2>{0.656442046f, 0.33330825f},
-std::array<float,2>{0.38969171f, 0.834585428f},
-std::array<float,2>{0.794416845f, 0.708970547f},
-std::array<float,2>{0.189399853f, 0.109530605f},
-std::array<float,2>{0.975317836f, 0.173089609f},
-std::array<float,2>{0.0488760099f, 0.533555984f},
-std::array<float,2>{0.545138001f, 0.900783181f},
-std::array<float,2>{0.338812411f, 0.383081287f},
-std::array<float,2>{0.547743797f, 0.145361856f},
-std::array<float,2>{0.32786867f, 0.513895094f},
-std::array<float,2>{0.997161448f, 0.918134391f},
-std::array<float,2>{0.0434082597f, 0.415431291f},
-std::array<float,2>{0.811513305f, 0.368380606f},
-std::array<float,2>{0.216121301f, 0.872916758f},
-std::array<float,2>{0.673825443f, 0.744703829f},
-std::array<float,2>{0.40544945f, 0.0753603876f},
-std::array<float,2>{0.7144835f, 0.47495082f},
-std::array<float,2>{0.466949135f, 0.944576502f},
-std::array<float,2>{0.819948077f, 0.616690576f},
-std::array<float,2>{0.161689594f, 0.224936903f},
-std::array<float,2>{0.932710469f, 0.0566893145f},
-std::array<float,2>{0.108988188f, 0.679538608f},
-std::array<float,2>{0.57919842f, 0.781505883f},
-std::array<float,2>{0.30802089f, 0.293285817f},
-std::array<float,2>{0.655039132f, 0.0980295613f},
-std::array<float,2>{0.425840586f, 0.702314317f},
-std::array<float,2>{0.753906369f, 0.813068449f},
-std::array<float,2>{0.219479635f, 0.318604916f},
-std::array<float,2>{0.957772017f, 0.404484928f},
-std::array<float,2>{0.00756579824f, 0.889083505f},
-std::array<float,2>{0.516011655f, 0.551352203f},
-std::array<float,2>{0.368784398f, 0.171345249f},
-std::array<float,2>{0.611172855f, 0.258918017f},
-std::array<float,2>{0.260792583f, 0.777302742f},
-std::array<float,2>{0.884245515f, 0.634255052f},
-std::array<float,2>{0.0926950276f, 0.0154581293f},
-std::array<float,2>{0.853072345f, 0.209447607f},
-std::array<float,2>{0.132468492f, 0.576503694f},
-std::array<float,2>{0.736408949f, 0.987751544f},
-std::array<float,2>{0.478218466f, 0.442752242f},
-std::array<float,2>{0.680470228f, 0.158585653f},
-std::array<float,2>{0.396347106f, 0.562446415f},
-std::array<float,2>{0.803898633f, 0.881099939f},
-std::array<float,2>{0.205865443f, 0.397755206f},
-std::array<float,2>{0.988045692f, 0.327629536f},
-std::array<float,2>{0.0344853662f, 0.821279764f},
-std::array<float,2>{0.557311296f, 0.692671418f},
-std::array<float,2>{0.312640578f, 0.102561958f},
-std::array<float,2>{0.588586628f, 0.446100056f},
-std::array<float,2>{0.300924599f, 0.997620225f},
-std::array<float,2>{0.925439775f, 0.564186156f},
-std::array<float,2>{0.0953354537f, 0.211113915f},
-std::array<float,2>{0.825874507f, 0.00284135854f},
-std::array<float,2>{0.167485714f, 0.628121734f},
-std::array<float,2>{0.709275246f, 0.770360172f},
-std::array<float,2>{0.458072513f, 0.250685424f},
-std::array<float,2>{0.529825091f, 0.0678258464f},
-std::array<float,2>{0.365569085f, 0.735749185f},
-std::array<float,2>{0.964152396f, 0.860268533f},
-std::array<float,2>{0.00967440661f, 0.361670166f},
-std::array<float,2>{0.758724868f, 0.407449633f},
-std::array<float,2>{0.232899338f, 0.907882154f},
-std::array<float,2>{0.646421969f, 0.507596314f},
-std::array<float,2>{0.436171889f, 0.150537968f},
-std::array<float,2>{0.742390454f, 0.285974503f},
-std::array<float,2>{0.473764479f, 0.793752134f},
-std::array<float,2>{0.849245071f, 0.680142999f},
-std::array<float,2>{0.137681991f, 0.0519712232f},
-std::array<float,2>{0.882096887f, 0.230986208f},
-std::array<float,2>{0.0816882327f, 0.623804033f},
-std::array<float,2>{0.623640358f, 0.945724487f},
-std::array<float,2>{0.251098543f, 0.478472203f},
-std::array<float,2>{0.604838431f, 0.189762697f},
-std::array<float,2>{0.280486763f, 0.586925805f},
-std::array<float,2>{0.896831155f, 0.9747926f},
-std::array<float,2>{0.0752050877f, 0.458680958f},
-std::array<float,2>{0.872259259f, 0.265682191f},
-std::array<float,2>{0.140706658f, 0.750513077f},
-std::array<float,2>{0.72989589f, 0.646813929f},
-std::array<float,2>{0.485272646f, 0.0177645609f},
-std::array<float,2>{0.630016685f, 0.381570637f},
-std::array<float,2>{0.41520521f, 0.892811537f},
-std::array<float,2>{0.768433452f, 0.542105317f},
-std::array<float,2>{0.245754808f, 0.186015829f},
-std::array<float,2>{0.951477408f, 0.123465091f},
-std::array<float,2>{0.0226590429f, 0.718462288f},
-std::array<float,2>{0.508911848f, 0.842918515f},
-std::array<float,2>{0.353175908f, 0.336051375f},
-std::array<float,2>{0.701729357f, 0.0454058126f},
-std::array<float,2>{0.449369341f, 0.668451071f},
-std::array<float,2>{0.839619935f, 0.805811167f},
-std::array<float,2>{0.172349989f, 0.303432554f},
-std::array<float,2>{0.911604226f, 0.491737753f},
-std::array<float,2>{0.110138036f, 0.965675354f},
-std::array<float,2>{0.568795085f, 0.5959692f},
-std::array<float,2>{0.282945961f, 0.244379684f},
-std::array<float,2>{0.538197339f, 0.351799428f},
-std::array<float,2>{0.334453195f, 0.847506225f},
-std::array<float,2>{0.980314195f, 0.725750566f},
-std::array<float,2>{0.0559205711f, 0.0856142566f},
-std::array<float,2>{0.788121462f, 0.137494102f},
-std::array<float,2>{0.199296251f, 0.529052079f},
-std::array<float,2>{0.669806719f, 0.929315388f},
-std::array<float,2>{0.380289853f, 0.424106538f},
-std::array<float,2>{0.70541203f, 0.130175397f},
-std::array<float,2>{0.45621857f, 0.522898674f},
-std::array<float,2>{0.821787357f, 0.933119357f},
-std::array<float,2>{0.170743227f, 0.432443917f},
-std::array<float,2>{0.928538501f, 0.348257899f},
-std::array<float,2>{0.0977951437f, 0.856666744f},
-std::array<float,2>{0.591634035f, 0.733719528f},
-std::array<float,2>{0.297175944f, 0.0891387239f},
-std::array<float,2>{0.560490727f, 0.49633503f},
-std::array<float,2>{0.319103897f, 0.956894338f},
-std::array<float,2>{0.990466058f, 0.609041452f},
-std::array<float,2>{0.035578724f, 0.238832697f},
-std::array<float,2>{0.797066808f, 0.0387536958f},
-std::array<float,2>{0.2077474f, 0.660411835f},
-std::array<float,2>{0.684007347f, 0.801273048f},
-std::array<float,2>{0.391307175f, 0.306558371f},
-std::array<float,2>{0.61818409f, 0.115007892f},
-std::array<float,2>{0.257338732f, 0.706434548f},
-std::array<float,2>{0.875694811f, 0.830917001f},
-std::array<float,2>{0.0829930454f, 0.331845254f},
-std::array<float,2>{0.845764935f, 0.389580339f},
-std::array<float,2>{0.134183124f, 0.902942359f},
-std::array<float,2>{0.747000456f, 0.538678169f},
-std::array<float,2>{0.47070083f, 0.178215072f},
-std::array<float,2>{0.641146362f, 0.274353921f},
-std::array<float,2>{0.432217002f, 0.759335101f},
-std::array<float,2>{0.764285982f, 0.652357757f},
-std::array<float,2>{0.227943853f, 0.0293210316f},
-std::array<float,2>{0.968238711f, 0.19947511f},
-std::array<float,2>{0.011765114f, 0.578432739f},
-std::array<float,2>{0.526365161f, 0.979754388f},
-std::array<float,2>{0.362970114f, 0.464060277f},
-std::array<float,2>{0.513853133f, 0.221034423f},
-std::array<float,2>{0.356702328f, 0.61244005f},
-std::array<float,2>{0.946863532f, 0.940092444f},
-std::array<float,2>{0.0194385462f, 0.469375312f},
-std::array<float,2>{0.771155715f, 0.292025685f},
-std::array<float,2>{0.249598458f, 0.788075507f},
-std::array<float,2>{0.62635392f, 0.675153017f},
-std::array<float,2>{0.420904607f, 0.0596118048f},
-std::array<float,2>{0.73406285f, 0.421174079f},
-std::array<float,2>{0.491811067f, 0.917873144f},
-std::array<float,2>{0.870682001f, 0.511511862f},
-std::array<float,2>{0.147480741f, 0.140933111f},
-std::array<float,2>{0.890782297f, 0.0729106143f},
-std::array<float,2>{0.0717201158f, 0.748266578f},
-std::array<float,2>{0.606368124f, 0.869154155f},
-std::array<float,2>{0.275388956f, 0.371178776f},
-std::array<float,2>{0.667678118f, 0.00855973642f},
-std::array<float,2>{0.378532588f, 0.637678623f},
-std::array<float,2>{0.78298229f, 0.778507233f},
-std::array<float,2>{0.197661608f, 0.263486207f},
-std::array<float,2>{0.982781351f, 0.438122094f},
-std::array<float,2>{0.0619890429f, 0.991166174f},
-std::array<float,2>{0.532011807f, 0.574034572f},
-std::array<float,2>{0.330255479f, 0.205464646f},
-std::array<float,2>{0.564326942f, 0.313924909f},
-std::array<float,2>{0.288261682f, 0.81931144f},
-std::array<float,2>{0.906287968f, 0.697817326f},
-std::array<float,2>{0.114905551f, 0.0939000398f},
-std::array<float,2>{0.84058702f, 0.167422846f},
-std::array<float,2>{0.178137824f, 0.548763871f},
-std::array<float,2>{0.696409404f, 0.882813573f},
-std::array<float,2>{0.447917759f, 0.401942074f},
-std::array<float,2>{0.634611785f, 0.216128826f},
-std::array<float,2>{0.412535638f, 0.570105612f},
-std::array<float,2>{0.775749087f, 0.993392408f},
-std::array<float,2>{0.240352198f, 0.45222342f},
-std::array<float,2>{0.941462934f, 0.254400373f},
-std::array<float,2>{0.0277320705f, 0.766186476f},
-std::array<float,2>{0.502327561f, 0.628927708f},
-std::array<float,2>{0.343918145f, 0.00701526226f},
-std::array<float,2>{0.596941233f, 0.392466366f},
-std::array<float,2>{0.273107558f, 0.875725508f},
-std::array<float,2>{0.900020123f, 0.555521905f},
-std::array<float,2>{0.0689787418f, 0.162092388f},
-std::array<float,2>{0.862119794f, 0.106462613f},
-std::array<float,2>{0.152404442f, 0.691229701f},
-std::array<float,2>{0.720412374f, 0.826950073f},
-std::array<float,2>{0.495076656f, 0.322477847f},
-std::array<float,2>{0.540300727f, 0.0469633676f},
-std::array<float,2>{0.341449142f, 0.683910608f},
-std::array<float,2>{0.972381711f, 0.792681575f},
-std::array<float,2>{0.0516258366f, 0.282799423f},
-std::array<float,2>{0.792043447f, 0.480516315f},
-std::array<float,2>{0.192083925f, 0.950869441f},
-std::array<float,2>{0.662775993f, 0.619056761f},
-std::array<float,2>{0.384751648f, 0.229347721f},
-std::array<float,2>{0.694496512f, 0.363725424f},
-std::array<float,2>{0.441335589f, 0.865443051f},
-std::array<float,2>{0.830618978f, 0.740878105f},
-std::array<float,2>{0.180316716f, 0.0643089712f},
-std::array<float,2>{0.919434667f, 0.155585393f},
-std::array<float,2>{0.118169732f, 0.500997305f},
-std::array<float,2>{0.570568085f, 0.912944734f},
-std::array<float,2>{0.289307743f, 0.412506878f},
-std::array<float,2>{0.584150136f, 0.182940647f},
-std::array<float,2>{0.312081933f, 0.543737829f},
-std::array<float,2>{0.934803665f, 0.897883356f},
-std::array<float,2>{0.105169155f, 0.375098377f},
-std::array<float,2>{0.812758267f, 0.342054456f},
-std::array<float,2>{0.157955244f, 0.837845802f},
-std::array<float,2>{0.7151227f, 0.712215483f},
-std::array<float,2>{0.46094197f, 0.11775396f},
-std::array<float,2>{0.677755594f, 0.45654735f},
-std::array<float,2>{0.399223924f, 0.971356273f},
-std::array<float,2>{0.806035638f, 0.592956007f},
-std::array<float,2>{0.212292477f, 0.192183539f},
-std::array<float,2>{0.993000567f, 0.0227512158f},
-std::array<float,2>{0.042501431f, 0.641429186f},
-std::array<float,2>{0.551368654f, 0.755188942f},
-std::array<float,2>{0.321539968f, 0.272781014f},
-std::array<float,2>{0.740743518f, 0.079899624f},
-std::array<float,2>{0.481534302f, 0.720276713f},
-std::array<float,2>{0.857311845f, 0.8514359f},
-std::array<float,2>{0.126558125f, 0.357701182f},
-std::array<float,2>{0.889390588f, 0.429559469f},
-std::array<float,2>{0.0872280672f, 0.925596058f},
-std::array<float,2>{0.615785241f, 0.523783565f},
-std::array<float,2>{0.2640194f, 0.134111762f},
-std::array<float,2>{0.52324605f, 0.300011426f},
-std::array<float,2>{0.373852372f, 0.810386658f},
-std::array<float,2>{0.953587711f, 0.665231526f},
-std::array<float,2>{0.00170278933f, 0.0406977162f},
-std::array<float,2>{0.750605881f, 0.247648492f},
-std::array<float,2>{0.223788083f, 0.600456178f},
-std::array<float,2>{0.650898933f, 0.964362502f},
-std::array<float,2>{0.423040152f, 0.487869203f},
-std::array<float,2>{0.737724125f, 0.208807275f},
-std::array<float,2>{0.477241337f, 0.574626803f},
-std::array<float,2>{0.852020204f, 0.9861449f},
-std::array<float,2>{0.130967095f, 0.445281953f},
-std::array<float,2>{0.883563101f, 0.260090262f},
-std::array<float,2>{0.0927744061f, 0.773833871f},
-std::array<float,2>{0.609751463f, 0.635528147f},
-std::array<float,2>{0.26036644f, 0.0129686622f},
-std::array<float,2>{0.517515779f, 0.402412653f},
-std::array<float,2>{0.367324054f, 0.887761831f},
-std::array<float,2>{0.95814085f, 0.552946091f},
-std::array<float,2>{0.00657561654f, 0.16946511f},
-std::array<float,2>{0.754981041f, 0.0999442562f},
-std::array<float,2>{0.22021459f, 0.700590968f},
-std::array<float,2>{0.656102479f, 0.814754844f},
-std::array<float,2>{0.427170575f, 0.31819436f},
-std::array<float,2>{0.578568697f, 0.0559574515f},
-std::array<float,2>{0.306719214f, 0.677295566f},
-std::array<float,2>{0.932279766f, 0.784751773f},
-std::array<float,2>{0.107666142f, 0.296481431f},
-std::array<float,2>{0.818408072f, 0.472762883f},
-std::array<float,2>{0.160248131f, 0.942992032f},
-std::array<float,2>{0.712972462f, 0.61474359f},
-std::array<float,2>{0.468242735f, 0.224328995f},
-std::array<float,2>{0.67210865f, 0.370200664f},
-std::array<float,2>{0.404623985f, 0.873186648f},
-std::array<float,2>{0.812296689f, 0.744057119f},
-std::array<float,2>{0.214942083f, 0.0780716762f},
-std::array<float,2>{0.996435404f, 0.147668123f},
-std::array<float,2>{0.0439807326f, 0.511850655f},
-std::array<float,2>{0.548102081f, 0.920304358f},
-std::array<float,2>{0.326889932f, 0.417379469f},
-std::array<float,2>{0.546852171f, 0.174561083f},
-std::array<float,2>{0.339435756f, 0.532332897f},
-std::array<float,2>{0.975981116f, 0.90027833f},
-std::array<float,2>{0.0505995192f, 0.385070145f},
-std::array<float,2>{0.793639481f, 0.334879011f},
-std::array<float,2>{0.188081175f, 0.832205057f},
-std::array<float,2>{0.657372892f, 0.709154665f},
-std::array<float,2>{0.388864964f, 0.112473965f},
-std::array<float,2>{0.68840003f, 0.468682796f},
-std::array<float,2>{0.444037348f, 0.983501136f},
-std::array<float,2>{0.833051145f, 0.583460629f},
-std::array<float,2>{0.18723911f, 0.19551377f},
-std::array<float,2>{0.917564154f, 0.0268833954f},
-std::array<float,2>{0.122920997f, 0.651000857f},
-std::array<float,2>{0.578067362f, 0.765293241f},
-std::array<float,2>{0.295363486f, 0.279211074f},
-std::array<float,2>{0.640601575f, 0.0932608396f},
-std::array<float,2>{0.409548938f, 0.729433656f},
-std::array<float,2>{0.778144717f, 0.85220176f},
-std::array<float,2>{0.238030061f, 0.346796542f},
-std::array<float,2>{0.939127564f, 0.436966091f},
-std::array<float,2>{0.0268039443f, 0.935305059f},
-std::array<float,2>{0.504068613f, 0.518240213f},
-std::array<float,2>{0.350602686f, 0.126458481f},
-std::array<float,2>{0.598035812f, 0.311331719f},
-std::array<float,2>{0.266047299f, 0.796905041f},
-std::array<float,2>{0.904970765f, 0.659011543f},
-std::array<float,2>{0.0662946105f, 0.034046825f},
-std::array<float,2>{0.867169142f, 0.235473514f},
-std::array<float,2>{0.150766551f, 0.604149044f},
-std::array<float,2>{0.726043284f, 0.959736466f},
-std::array<float,2>{0.497535437f, 0.496000856f},
-std::array<float,2>{0.668596506f, 0.140236691f},
-std::array<float,2>{0.379860014f, 0.530528486f},
-std::array<float,2>{0.787222981f, 0.926364601f},
-std::array<float,2>{0.200938478f, 0.422480881f},
-std::array<float,2>{0.979253829f, 0.355278164f},
-std::array<float,2>{0.054891862f, 0.84419173f},
-std::array<float,2>{0.537130952f, 0.723815858f},
-std::array<float,2>{0.335928559f, 0.0820445418f},
-std::array<float,2>{0.569420993f, 0.489394337f},
-std::array<float,2>{0.282127023f, 0.96775943f},
-std::array<float,2>{0.910338163f, 0.59395653f},
-std::array<float,2>{0.110599063f, 0.243992284f},
-std::array<float,2>{0.838846982f, 0.0441617556f},
-std::array<float,2>{0.173362836f, 0.670977652f},
-std::array<float,2>{0.702766538f, 0.807976246f},
-std::array<float,2>{0.450621575f, 0.301631689f},
-std::array<float,2>{0.508317828f, 0.1229636f},
-std::array<float,2>{0.351578206f, 0.716742039f},
-std::array<float,2>{0.952373087f, 0.841738462f},
-std::array<float,2>{0.0224364195f, 0.33908546f},
-std::array<float,2>{0.768783748f, 0.380670965f},
-std::array<float,2>{0.244421482f, 0.890694082f},
-std::array<float,2>{0.629732609f, 0.540602386f},
-std::array<float,2>{0.414081454f, 0.184577301f},
-std::array<float,2>{0.729033947f, 0.269347221f},
-std::array<float,2>{0.485795081f, 0.752891719f},
-std::array<float,2>{0.871850669f, 0.646218657f},
-std::array<float,2>{0.141661659f, 0.0174577348f},
-std::array<float,2>{0.898000121f, 0.188759401f},
-std::array<float,2>{0.0746019781f, 0.58829385f},
-std::array<float,2>{0.603795111f, 0.974357784f},
-std::array<float,2>{0.279419035f, 0.459999591f},
-std::array<float,2>{0.624697566f, 0.234073654f},
-std::array<float,2>{0.250225574f, 0.621548295f},
-std::array<float,2>{0.880906582f, 0.948104799f},
-std::array<float,2>{0.0808106214f, 0.479587108f},
-std::array<float,2>{0.847699642f, 0.288118243f},
-std::array<float,2>{0.137704238f, 0.795919359f},
-std::array<float,2>{0.744109452f, 0.683550358f},
-std::array<float,2>{0.473190039f, 0.0534117669f},
-std::array<float,2>{0.644875467f, 0.410003781f},
-std::array<float,2>{0.436960667f, 0.908831537f},
-std::array<float,2>{0.75912261f, 0.504007041f},
-std::array<float,2>{0.233935088f, 0.150307283f},
-std::array<float,2>{0.963081241f, 0.0690100417f},
-std::array<float,2>{0.00821658596f, 0.73776871f},
-std::array<float,2>{0.530690074f, 0.862989068f},
-std::array<float,2>{0.366277754f, 0.360263258f},
-std::array<float,2>{0.710635185f, 0.00120636867f},
-std::array<float,2>{0.457785159f, 0.626164019f},
-std::array<float,2>{0.824498892f, 0.772300124f},
-std::array<float,2>{0.166402206f, 0.252527088f},
-std::array<float,2>{0.924078405f, 0.447410673f},
-std::array<float,2>{0.0939701498f, 0.998123407f},
-std::array<float,2>{0.589750588f, 0.565210879f},
-std::array<float,2>{0.30207926f, 0.213932812f},
-std::array<float,2>{0.55766803f, 0.324219257f},
-std::array<float,2>{0.314099818f, 0.822874963f},
-std::array<float,2>{0.98726058f, 0.695004821f},
-std::array<float,2>{0.0338053294f, 0.103691608f},
-std::array<float,2>{0.802939057f, 0.156376362f},
-std::array<float,2>{0.206900731f, 0.558929086f},
-std::array<float,2>{0.68103224f, 0.880372524f},
-std::array<float,2>{0.394577324f, 0.394605219f},
-std::array<float,2>{0.69607234f, 0.164769605f},
-std::array<float,2>{0.448734611f, 0.549830675f},
-std::array<float,2>{0.841224492f, 0.88580215f},
-std::array<float,2>{0.178944781f, 0.398904324f},
-std::array<float,2>{0.907319725f, 0.315462351f},
-std::array<float,2>{0.113490134f, 0.817542553f},
-std::array<float,2>{0.562714636f, 0.697252393f},
-std::array<float,2>{0.287388414f, 0.0959943011f},
-std::array<float,2>{0.532591581f, 0.439982712f},
-std::array<float,2>{0.331443816f, 0.989063919f},
-std::array<float,2>{0.984209836f, 0.571970284f},
-std::array<float,2>{0.0609835684f, 0.204204559f},
-std::array<float,2>{0.78171128f, 0.0108092101f},
-std::array<float,2>{0.198941469f, 0.6396541f},
-std::array<float,2>{0.666243732f, 0.779694736f},
-std::array<float,2>{0.377735287f, 0.264025986f},
-std::array<float,2>{0.606853902f, 0.0704459548f},
-std::array<float,2>{0.274354905f, 0.746241868f},
-std::array<float,2>{0.891702116f, 0.868171155f},
-std::array<float,2>{0.0710551441f, 0.374536127f},
-std::array<float,2>{0.86926347f, 0.418586493f},
-std::array<float,2>{0.146586269f, 0.914382279f},
-std::array<float,2>{0.733202398f, 0.509053946f},
-std::array<float,2>{0.490290403f, 0.143403202f},
-std::array<float,2>{0.62555629f, 0.290731132f},
-std::array<float,2>{0.420581102f, 0.78575325f},
-std::array<float,2>{0.770282686f, 0.673297405f},
-std::array<float,2>{0.248659506f, 0.0622788183f},
-std::array<float,2>{0.945700824f, 0.220496327f},
-std::array<float,2>{0.0184514094f, 0.610227048f},
-std::array<float,2>{0.515186369f, 0.938622355f},
-std::array<float,2>{0.355600983f, 0.470866293f},
-std::array<float,2>{0.526656926f, 0.201574847f},
-std::array<float,2>{0.361355841f, 0.580826998f},
-std::array<float,2>{0.967265546f, 0.977168918f},
-std::array<float,2>{0.0128569286f, 0.462542981f},
-std::array<float,2>{0.764925361f, 0.275411338f},
-std::array<float,2>{0.227152914f, 0.760623932f},
-std::array<float,2>{0.642470777f, 0.655436933f},
-std::array<float,2>{0.432988018f, 0.0277031139f},
-std::array<float,2>{0.747134447f, 0.388643801f},
-std::array<float,2>{0.469629467f, 0.905960441f},
-std::array<float,2>{0.84679091f, 0.537061989f},
-std::array<float,2>{0.133315086f, 0.177424937f},
-std::array<float,2>{0.876615107f, 0.115335874f},
-std::array<float,2>{0.0831720978f, 0.704438269f},
-std::array<float,2>{0.617644548f, 0.829741061f},
-std::array<float,2>{0.256405473f, 0.329535902f},
-std::array<float,2>{0.685472786f, 0.0369081348f},
-std::array<float,2>{0.392161131f, 0.662979782f},
-std::array<float,2>{0.797952414f, 0.804261744f},
-std::array<float,2>{0.208591357f, 0.307007015f},
-std::array<float,2>{0.991600811f, 0.498248905f},
-std::array<float,2>{0.0364389308f, 0.953511298f},
-std::array<float,2>{0.559212089f, 0.607136011f},
-std::array<float,2>{0.319668353f, 0.240866125f},
-std::array<float,2>{0.59053129f, 0.351159573f},
-std::array<float,2>{0.298077345f, 0.859217286f},
-std::array<float,2>{0.928776026f, 0.731428027f},
-std::array<float,2>{0.098901853f, 0.0872737393f},
-std::array<float,2>{0.821000278f, 0.132531896f},
-std::array<float,2>{0.17173627f, 0.520183027f},
-std::array<float,2>{0.706297696f, 0.930614054f},
-std::array<float,2>{0.455412239f, 0.429960132f},
-std::array<float,2>{0.652245164f, 0.24883154f},
-std::array<float,2>{0.422768861f, 0.599276125f},
-std::array<float,2>{0.751769006f, 0.962474287f},
-std::array<float,2>{0.223413587f, 0.485487252f},
-std::array<float,2>{0.954284549f, 0.297031701f},
-std::array<float,2>{0.000270859018f, 0.811259508f},
-std::array<float,2>{0.522442698f, 0.666083813f},
-std::array<float,2>{0.374054074f, 0.0410771742f},
-std::array<float,2>{0.617101192f, 0.427572519f},
-std::array<float,2>{0.265481591f, 0.923603058f},
-std::array<float,2>{0.890576482f, 0.526971281f},
-std::array<float,2>{0.086374566f, 0.136398867f},
-std::array<float,2>{0.856390357f, 0.0804653093f},
-std::array<float,2>{0.125254303f, 0.720799625f},
-std::array<float,2>{0.741614044f, 0.849118888f},
-std::array<float,2>{0.481276482f, 0.356671631f},
-std::array<float,2>{0.552054048f, 0.0198543295f},
-std::array<float,2>{0.3209925f, 0.643305361f},
-std::array<float,2>{0.993709266f, 0.757540226f},
-std::array<float,2>{0.0416002646f, 0.271050721f},
-std::array<float,2>{0.805482566f, 0.453334242f},
-std::array<float,2>{0.211410448f, 0.97066021f},
-std::array<float,2>{0.67886138f, 0.590795755f},
-std::array<float,2>{0.400183082f, 0.194712251f},
-std::array<float,2>{0.716266334f, 0.340257257f},
-std::array<float,2>{0.462629795f, 0.838467658f},
-std::array<float,2>{0.813600063f, 0.713537991f},
-std::array<float,2>{0.156447038f, 0.120167844f},
-std::array<float,2>{0.934246004f, 0.180963352f},
-std::array<float,2>{0.104188919f, 0.545720816f},
-std::array<float,2>{0.585531414f, 0.896349132f},
-std::array<float,2>{0.311037779f, 0.378629506f},
-std::array<float,2>{0.57148999f, 0.1537067f},
-std::array<float,2>{0.290668249f, 0.503788829f},
-std::array<float,2>{0.918378592f, 0.910583198f},
-std::array<float,2>{0.11779093f, 0.410688072f},
-std::array<float,2>{0.832000613f, 0.365968257f},
-std::array<float,2>{0.180968285f, 0.864872277f},
-std::array<float,2>{0.6933797f, 0.739757895f},
-std::array<float,2>{0.440019131f, 0.0655564591f},
-std::array<float,2>{0.663654387f, 0.482711911f},
-std::array<float,2>{0.383330166f, 0.95154202f},
-std::array<float,2>{0.791956186f, 0.620847225f},
-std::array<float,2>{0.192462668f, 0.227674127f},
-std::array<float,2>{0.971101999f, 0.0499061123f},
-std::array<float,2>{0.0523673296f, 0.686263263f},
-std::array<float,2>{0.539971113f, 0.790573716f},
-std::array<float,2>{0.340643018f, 0.283317715f},
-std::array<float,2>{0.719367445f, 0.108100317f},
-std::array<float,2>{0.496054888f, 0.687508941f},
-std::array<float,2>{0.862383842f, 0.825738668f},
-std::array<float,2>{0.153715298f, 0.320700854f},
-std::array<float,2>{0.898464322f, 0.394025564f},
-std::array<float,2>{0.0700284988f, 0.878642499f},
-std::array<float,2>{0.596632421f, 0.557492137f},
-std::array<float,2>{0.271638602f, 0.163375393f},
-std::array<float,2>{0.503841341f, 0.256850272f},
-std::array<float,2>{0.345546484f, 0.76853919f},
-std::array<float,2>{0.942794859f, 0.631471694f},
-std::array<float,2>{0.0284335632f, 0.00524212886f},
-std::array<float,2>{0.777212262f, 0.218210846f},
-std::array<float,2>{0.241591811f, 0.567408621f},
-std::array<float,2>{0.633207798f, 0.995706499f},
-std::array<float,2>{0.413219839f, 0.451055199f},
-std::array<float,2>{0.712082863f, 0.225988552f},
-std::array<float,2>{0.466141373f, 0.615646243f},
-std::array<float,2>{0.817913532f, 0.943892241f},
-std::array<float,2>{0.163787678f, 0.475737751f},
-std::array<float,2>{0.931311905f, 0.294579268f},
-std::array<float,2>{0.107077017f, 0.7829566f},
-std::array<float,2>{0.581628323f, 0.678666353f},
-std::array<float,2>{0.305347532f, 0.0583775416f},
-std::array<float,2>{0.55015409f, 0.414412737f},
-std::array<float,2>{0.325583398f, 0.919184506f},
-std::array<float,2>{0.998868346f, 0.514945626f},
-std::array<float,2>{0.0463027544f, 0.146131024f},
-std::array<float,2>{0.808734059f, 0.074962683f},
-std::array<float,2>{0.218582004f, 0.745176375f},
-std::array<float,2>{0.675127745f, 0.871151447f},
-std::array<float,2>{0.40294978f, 0.367569506f},
-std::array<float,2>{0.612799466f, 0.0144809494f},
-std::array<float,2>{0.257936507f, 0.633284152f},
-std::array<float,2>{0.884836137f, 0.776047945f},
-std::array<float,2>{0.0911623761f, 0.25869137f},
-std::array<float,2>{0.854063869f, 0.441692412f},
-std::array<float,2>{0.130047143f, 0.987100303f},
-std::array<float,2>{0.736118793f, 0.577304423f},
-std::array<float,2>{0.478918761f, 0.210183397f},
-std::array<float,2>{0.654005408f, 0.320218325f},
-std::array<float,2>{0.428578705f, 0.813687742f},
-std::array<float,2>{0.756238639f, 0.701522827f},
-std::array<float,2>{0.221499845f, 0.0989238396f},
-std::array<float,2>{0.96035105f, 0.170061812f},
-std::array<float,2>{0.00469801622f, 0.551797032f},
-std::array<float,2>{0.517932534f, 0.890279531f},
-std::array<float,2>{0.370675057f, 0.40584901f},
-std::array<float,2>{0.507075548f, 0.128529936f},
-std::array<float,2>{0.347866565f, 0.517129004f},
-std::array<float,2>{0.939633012f, 0.936444998f},
-std::array<float,2>{0.0243603345f, 0.434222758f},
-std::array<float,2>{0.781112969f, 0.345362455f},
-std::array<float,2>{0.235846311f, 0.854369521f},
-std::array<float,2>{0.638591766f, 0.728061616f},
-std::array<float,2>{0.407836288f, 0.0899508521f},
-std::array<float,2>{0.723031044f, 0.493202627f},
-std::array<float,2>{0.499985665f, 0.958131135f},
-std::array<float,2>{0.864370167f, 0.601918519f},
-std::array<float,2>{0.149694249f, 0.237268344f},
-std::array<float,2>{0.903757632f, 0.032614924f},
-std::array<float,2>{0.0637003705f, 0.656575859f},
-std::array<float,2>{0.600006223f, 0.800667286f},
-std::array<float,2>{0.268028408f, 0.309824347f},
-std::array<float,2>{0.658372164f, 0.111105882f},
-std::array<float,2>{0.38743484f, 0.707735181f},
-std::array<float,2>{0.795558989f, 0.835061967f},
-std::array<float,2>{0.190043911f, 0.332376093f},
-std::array<float,2>{0.972826242f, 0.38420102f},
-std::array<float,2>{0.0483468175f, 0.902261138f},
-std::array<float,2>{0.544419289f, 0.535036266f},
-std::array<float,2>{0.337642223f, 0.172663108f},
-std::array<float,2>{0.574566364f, 0.280771136f},
-std::array<float,2>{0.293960869f, 0.761886775f},
-std::array<float,2>{0.915602803f, 0.65009284f},
-std::array<float,2>{0.124215424f, 0.0243049543f},
-std::array<float,2>{0.835452735f, 0.198205173f},
-std::array<float,2>{0.185060516f, 0.584522009f},
-std::array<float,2>{0.690416396f, 0.981711805f},
-std::array<float,2>{0.442671627f, 0.466754228f},
-std::array<float,2>{0.632088125f, 0.187114909f},
-std::array<float,2>{0.416468084f, 0.541514695f},
-std::array<float,2>{0.766168833f, 0.893757403f},
-std::array<float,2>{0.243100077f, 0.382561535f},
-std::array<float,2>{0.950946093f, 0.337310731f},
-std::array<float,2>{0.0196731724f, 0.84229672f},
-std::array<float,2>{0.511128783f, 0.717218399f},
-std::array<float,2>{0.354248822f, 0.124695331f},
-std::array<float,2>{0.60232693f, 0.457570702f},
-std::array<float,2>{0.277434975f, 0.976118267f},
-std::array<float,2>{0.89462769f, 0.586816072f},
-std::array<float,2>{0.0778553262f, 0.190977052f},
-std::array<float,2>{0.874774277f, 0.0187921003f},
-std::array<float,2>{0.143533662f, 0.648124278f},
-std::array<float,2>{0.726581395f, 0.751198649f},
-std::array<float,2>{0.486414313f, 0.267147988f},
-std::array<float,2>{0.536372662f, 0.0848188177f},
-std::array<float,2>{0.33264038f, 0.725446463f},
-std::array<float,2>{0.977149189f, 0.846135497f},
-std::array<float,2>{0.0567880049f, 0.352658629f},
-std::array<float,2>{0.786303401f, 0.425727218f},
-std::array<float,2>{0.20204933f, 0.928628206f},
-std::array<float,2>{0.671674609f, 0.528302491f},
-std::array<float,2>{0.381485581f, 0.138014078f},
-std::array<float,2>{0.700584888f, 0.304153442f},
-std::array<float,2>{0.452847004f, 0.805045485f},
-std::array<float,2>{0.835960805f, 0.669639707f},
-std::array<float,2>{0.175645858f, 0.0466533899f},
-std::array<float,2>{0.912326753f, 0.245842278f},
-std::array<float,2>{0.111629769f, 0.597537637f},
-std::array<float,2>{0.568147182f, 0.966180742f},
-std::array<float,2>{0.28510645f, 0.490972042f},
-std::array<float,2>{0.586203992f, 0.212197423f},
-std::array<float,2>{0.303322881f, 0.562986255f},
-std::array<float,2>{0.923329711f, 0.996599972f},
-std::array<float,2>{0.0971621275f, 0.446487904f},
-std::array<float,2>{0.826465905f, 0.251306355f},
-std::array<float,2>{0.164520547f, 0.771120191f},
-std::array<float,2>{0.708454847f, 0.627596438f},
-std::array<float,2>{0.459673822f, 0.00323561858f},
-std::array<float,2>{0.682017267f, 0.396722227f},
-std::array<float,2>{0.397192508f, 0.882541895f},
-std::array<float,2>{0.801570773f, 0.560998023f},
-std::array<float,2>{0.204557523f, 0.159643948f},
-std::array<float,2>{0.984663129f, 0.101895936f},
-std::array<float,2>{0.0313017666f, 0.69180572f},
-std::array<float,2>{0.555092037f, 0.822125912f},
-std::array<float,2>{0.314519018f, 0.326770306f},
-std::array<float,2>{0.744816065f, 0.0513563119f},
-std::array<float,2>{0.475667596f, 0.680864096f},
-std::array<float,2>{0.850838482f, 0.794142067f},
-std::array<float,2>{0.140438616f, 0.286873311f},
-std::array<float,2>{0.880069852f, 0.476931036f},
-std::array<float,2>{0.078827396f, 0.946575522f},
-std::array<float,2>{0.622142196f, 0.62481755f},
-std::array<float,2>{0.253067911f, 0.231751665f},
-std::array<float,2>{0.528228283f, 0.363240778f},
-std::array<float,2>{0.36452347f, 0.861093342f},
-std::array<float,2>{0.961333454f, 0.734565437f},
-std::array<float,2>{0.0115406429f, 0.0671649203f},
-std::array<float,2>{0.760282516f, 0.15225406f},
-std::array<float,2>{0.231491581f, 0.506603777f},
-std::array<float,2>{0.647982538f, 0.907114148f},
-std::array<float,2>{0.434161812f, 0.407119781f},
-std::array<float,2>{0.731656373f, 0.141607538f},
-std::array<float,2>{0.488429159f, 0.509863853f},
-std::array<float,2>{0.867193222f, 0.916241765f},
-std::array<float,2>{0.144686699f, 0.420262486f},
-std::array<float,2>{0.893535316f, 0.372451633f},
-std::array<float,2>{0.0738009885f, 0.87098223f},
-std::array<float,2>{0.608931363f, 0.749571621f},
-std::array<float,2>{0.277016521f, 0.0736367628f},
-std::array<float,2>{0.512232721f, 0.470564455f},
-std::array<float,2>{0.358677387f, 0.941122532f},
-std::array<float,2>{0.947970748f, 0.611850321f},
-std::array<float,2>{0.0172224026f, 0.222246513f},
-std::array<float,2>{0.772774875f, 0.0586429238f},
-std::array<float,2>{0.247071937f, 0.674144804f},
-std::array<float,2>{0.628230453f, 0.789042771f},
-std::array<float,2>{0.419573009f, 0.291852444f},
-std::array<float,2>{0.566035867f, 0.0949152336f},
-std::array<float,2>{0.286262661f, 0.69889468f},
-std::array<float,2>{0.91007638f, 0.819482982f},
-std::array<float,2>{0.116881825f, 0.312668413f},
-std::array<float,2>{0.843378901f, 0.400808215f},
-std::array<float,2>{0.177106157f, 0.884362876f},
-std::array<float,2>{0.697341502f, 0.547182262f},
-std::array<float,2>{0.446970373f, 0.166217417f},
-std::array<float,2>{0.664940834f, 0.261878043f},
-std::array<float,2>{0.375768125f, 0.77740705f},
-std::array<float,2>{0.783602357f, 0.638009191f},
-std::array<float,2>{0.196641892f, 0.00959605165f},
-std::array<float,2>{0.981605709f, 0.206473306f},
-std::array<float,2>{0.0594678037f, 0.572838008f},
-std::array<float,2>{0.533822477f, 0.991267562f},
-std::array<float,2>{0.3297337f, 0.439300686f},
-std::array<float,2>{0.562349319f, 0.239296943f},
-std::array<float,2>{0.31748426f, 0.608379662f},
-std::array<float,2>{0.98885119f, 0.956045926f},
-std::array<float,2>{0.0378457829f, 0.497274697f},
-std::array<float,2>{0.80013597f, 0.305465758f},
-std::array<float,2>{0.210485518f, 0.802395344f},
-std::array<float,2>{0.686075568f, 0.661254406f},
-std::array<float,2>{0.393734396f, 0.037158329f},
-std::array<float,2>{0.704185247f, 0.433020622f},
-std::array<float,2>{0.455051005f, 0.931714475f},
-std::array<float,2>{0.82263726f, 0.522352755f},
-std::array<float,2>{0.168764055f, 0.12926279f},
-std::array<float,2>{0.926843643f, 0.0881213248f},
-std::array<float,2>{0.100302942f, 0.73282361f},
-std::array<float,2>{0.593159616f, 0.856054664f},
-std::array<float,2>{0.300333768f, 0.348673254f},
-std::array<float,2>{0.643934429f, 0.0303454082f},
-std::array<float,2>{0.429932952f, 0.6542449f},
-std::array<float,2>{0.761938989f, 0.758401096f},
-std::array<float,2>{0.23040922f, 0.275132447f},
-std::array<float,2>{0.96590215f, 0.462997466f},
-std::array<float,2>{0.0149262166f, 0.978534639f},
-std::array<float,2>{0.524748206f, 0.579558909f},
-std::array<float,2>{0.361303657f, 0.20051755f},
-std::array<float,2>{0.620113254f, 0.330817193f},
-std::array<float,2>{0.255270809f, 0.83162576f},
-std::array<float,2>{0.878227532f, 0.705772698f},
-std::array<float,2>{0.0857846066f, 0.113727801f},
-std::array<float,2>{0.843997121f, 0.179168478f},
-std::array<float,2>{0.134810567f, 0.537626565f},
-std::array<float,2>{0.748585165f, 0.904000819f},
-std::array<float,2>{0.472358495f, 0.389716655f},
-std::array<float,2>{0.676565111f, 0.192427605f},
-std::array<float,2>{0.40134427f, 0.592634022f},
-std::array<float,2>{0.807554543f, 0.971853971f},
-std::array<float,2>{0.214470044f, 0.455929488f},
-std::array<float,2>{0.994392514f, 0.272007853f},
-std::array<float,2>{0.0401692763f, 0.754720926f},
-std::array<float,2>{0.554621041f, 0.642313898f},
-std::array<float,2>{0.323675245f, 0.0221629404f},
-std::array<float,2>{0.582489192f, 0.376923442f},
-std::array<float,2>{0.309835374f, 0.897082806f},
-std::array<float,2>{0.936939597f, 0.544422865f},
-std::array<float,2>{0.102168448f, 0.182273492f},
-std::array<float,2>{0.81501174f, 0.118852459f},
-std::array<float,2>{0.15876855f, 0.711875319f},
-std::array<float,2>{0.71703285f, 0.836695254f},
-std::array<float,2>{0.46372515f, 0.342999935f},
-std::array<float,2>{0.520990908f, 0.0398198999f},
-std::array<float,2>{0.371883571f, 0.664815307f},
-std::array<float,2>{0.956844568f, 0.808972538f},
-std::array<float,2>{0.00243144715f, 0.298934191f},
-std::array<float,2>{0.752978683f, 0.487037867f},
-std::array<float,2>{0.2248649f, 0.963597596f},
-std::array<float,2>{0.649341047f, 0.60070622f},
-std::array<float,2>{0.424371123f, 0.246937126f},
-std::array<float,2>{0.738961697f, 0.358905852f},
-std::array<float,2>{0.483770937f, 0.850268424f},
-std::array<float,2>{0.857865989f, 0.719325423f},
-std::array<float,2>{0.12867029f, 0.078684628f},
-std::array<float,2>{0.887664557f, 0.132816598f},
-std::array<float,2>{0.0893945619f, 0.525188625f},
-std::array<float,2>{0.614065766f, 0.924556434f},
-std::array<float,2>{0.263134241f, 0.428396761f},
-std::array<float,2>{0.595271707f, 0.160240218f},
-std::array<float,2>{0.271311432f, 0.556441605f},
-std::array<float,2>{0.900624931f, 0.87667644f},
-std::array<float,2>{0.0666913912f, 0.39122957f},
-std::array<float,2>{0.860101819f, 0.32413581f},
-std::array<float,2>{0.156126797f, 0.828045726f},
-std::array<float,2>{0.721874774f, 0.690314949f},
-std::array<float,2>{0.492538542f, 0.105929121f},
-std::array<float,2>{0.635191381f, 0.451790571f},
-std::array<float,2>{0.410432786f, 0.992560625f},
-std::array<float,2>{0.774703622f, 0.569277287f},
-std::array<float,2>{0.238860309f, 0.215434819f},
-std::array<float,2>{0.944495499f, 0.0066682552f},
-std::array<float,2>{0.0307515766f, 0.630528212f},
-std::array<float,2>{0.500469625f, 0.766726851f},
-std::array<float,2>{0.347486466f, 0.255180508f},
-std::array<float,2>{0.691894054f, 0.0632933825f},
-std::array<float,2>{0.439445794f, 0.742036998f},
-std::array<float,2>{0.82857132f, 0.866911113f},
-std::array<float,2>{0.183260247f, 0.364895731f},
-std::array<float,2>{0.921631277f, 0.413868338f},
-std::array<float,2>{0.12002217f, 0.913332164f},
-std::array<float,2>{0.573399305f, 0.500356793f},
-std::array<float,2>{0.29262197f, 0.155068234f},
-std::array<float,2>{0.541987956f, 0.281263262f},
-std::array<float,2>{0.342471778f, 0.791639447f},
-std::array<float,2>{0.968908787f, 0.684631526f},
-std::array<float,2>{0.0534427166f, 0.0486963578f},
-std::array<float,2>{0.79003948f, 0.230093867f},
-std::array<float,2>{0.19362779f, 0.617418885f},
-std::array<float,2>{0.660257697f, 0.949643075f},
-std::array<float,2>{0.385346889f, 0.481857002f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.610193133f, 0.310275346f},
-std::array<float,2>{0.391035914f, 0.596646726f},
-std::array<float,2>{0.0430613235f, 0.113021366f},
-std::array<float,2>{0.923043251f, 0.872919381f},
-std::array<float,2>{0.790736139f, 0.138496742f},
-std::array<float,2>{0.176637322f, 0.932559013f},
-std::array<float,2>{0.261723787f, 0.448359311f},
-std::array<float,2>{0.658459544f, 0.679392278f},
-std::array<float,2>{0.712066531f, 0.0386492014f},
-std::array<float,2>{0.344842523f, 0.780055404f},
-std::array<float,2>{0.214024827f, 0.366579503f},
-std::array<float,2>{0.816689849f, 0.550229013f},
-std::array<float,2>{0.959252775f, 0.434886545f},
-std::array<float,2>{0.112083927f, 0.740885794f},
-std::array<float,2>{0.451741099f, 0.198677257f},
-std::array<float,2>{0.554029346f, 0.966834903f},
-std::array<float,2>{0.655816495f, 0.493049264f},
-std::array<float,2>{0.293745518f, 0.656067491f},
-std::array<float,2>{0.134245411f, 0.161849275f},
-std::array<float,2>{0.770678997f, 0.879903555f},
-std::array<float,2>{0.882738054f, 0.075676389f},
-std::array<float,2>{0.00702475337f, 0.83252418f},
-std::array<float,2>{0.415857613f, 0.270283669f},
-std::array<float,2>{0.573381007f, 0.582569718f},
-std::array<float,2>{0.5046857f, 0.244091913f},
-std::array<float,2>{0.486126721f, 0.975481391f},
-std::array<float,2>{0.0633920133f, 0.392891318f},
-std::array<float,2>{0.981548131f, 0.691118419f},
-std::array<float,2>{0.84670788f, 0.342111886f},
-std::array<float,2>{0.240603954f, 0.510287106f},
-std::array<float,2>{0.329164416f, 0.0213005766f},
-std::array<float,2>{0.721094191f, 0.790765464f},
-std::array<float,2>{0.747897565f, 0.350944817f},
-std::array<float,2>{0.324608535f, 0.533054709f},
-std::array<float,2>{0.23002851f, 0.0539882444f},
-std::array<float,2>{0.868672013f, 0.763208747f},
-std::array<float,2>{0.99226135f, 0.204436779f},
-std::array<float,2>{0.0817676038f, 0.943816185f},
-std::array<float,2>{0.475584149f, 0.418557674f},
-std::array<float,2>{0.526051044f, 0.731158555f},
-std::array<float,2>{0.582761586f, 0.0986462981f},
-std::array<float,2>{0.433427542f, 0.851653039f},
-std::array<float,2>{0.0227099434f, 0.282910109f},
-std::array<float,2>{0.905131221f, 0.621091366f},
-std::array<float,2>{0.754601181f, 0.456941456f},
-std::array<float,2>{0.153235257f, 0.661006093f},
-std::array<float,2>{0.307024777f, 0.150921404f},
-std::array<float,2>{0.626407981f, 0.911610544f},
-std::array<float,2>{0.540854812f, 0.385852665f},
-std::array<float,2>{0.466230035f, 0.713346303f},
-std::array<float,2>{0.096872434f, 0.232025191f},
-std::array<float,2>{0.941402555f, 0.997498751f},
-std::array<float,2>{0.837638319f, 0.00639904477f},
-std::array<float,2>{0.19446449f, 0.807635963f},
-std::array<float,2>{0.373875648f, 0.318882585f},
-std::array<float,2>{0.693923891f, 0.52724421f},
-std::array<float,2>{0.672697067f, 0.17998445f},
-std::array<float,2>{0.269424796f, 0.902689815f},
-std::array<float,2>{0.166055575f, 0.481913805f},
-std::array<float,2>{0.799406171f, 0.638573229f},
-std::array<float,2>{0.907647073f, 0.25105691f},
-std::array<float,2>{0.0588320792f, 0.576833606f},
-std::array<float,2>{0.377883762f, 0.082299456f},
-std::array<float,2>{0.605403244f, 0.815568268f},
-std::array<float,2>{0.518287957f, 0.324811876f},
-std::array<float,2>{0.478183985f, 0.523292482f},
-std::array<float,2>{0.087439321f, 0.0155093847f},
-std::array<float,2>{0.990327001f, 0.80100292f},
-std::array<float,2>{0.860712707f, 0.225779086f},
-std::array<float,2>{0.223273292f, 0.988544285f},
-std::array<float,2>{0.314889938f, 0.376677305f},
-std::array<float,2>{0.73604542f, 0.710446119f},
-std::array<float,2>{0.639995933f, 0.0861551389f},
-std::array<float,2>{0.300277889f, 0.823569357f},
-std::array<float,2>{0.141977534f, 0.258250356f},
-std::array<float,2>{0.76339668f, 0.562723219f},
-std::array<float,2>{0.898053348f, 0.476166219f},
-std::array<float,2>{0.0249150302f, 0.63139534f},
-std::array<float,2>{0.427889705f, 0.173589081f},
-std::array<float,2>{0.592209816f, 0.896761835f},
-std::array<float,2>{0.697740853f, 0.409301251f},
-std::array<float,2>{0.361172378f, 0.719497561f},
-std::array<float,2>{0.20180729f, 0.212487161f},
-std::array<float,2>{0.830470204f, 0.95038271f},
-std::array<float,2>{0.95151037f, 0.0619227141f},
-std::array<float,2>{0.107811965f, 0.754500329f},
-std::array<float,2>{0.454859912f, 0.358094364f},
-std::array<float,2>{0.534641266f, 0.540036678f},
-std::array<float,2>{0.600023448f, 0.14112106f},
-std::array<float,2>{0.390263826f, 0.92117244f},
-std::array<float,2>{0.0540356264f, 0.461101323f},
-std::array<float,2>{0.918610692f, 0.666221201f},
-std::array<float,2>{0.808119118f, 0.293701738f},
-std::array<float,2>{0.160534501f, 0.614783645f},
-std::array<float,2>{0.276260346f, 0.102721192f},
-std::array<float,2>{0.681500256f, 0.848911405f},
-std::array<float,2>{0.670463979f, 0.280832261f},
-std::array<float,2>{0.25310117f, 0.588718951f},
-std::array<float,2>{0.183207855f, 0.0658586919f},
-std::array<float,2>{0.789014816f, 0.835943162f},
-std::array<float,2>{0.934258163f, 0.171534911f},
-std::array<float,2>{0.0330567583f, 0.884255886f},
-std::array<float,2>{0.403395563f, 0.488662511f},
-std::array<float,2>{0.62232089f, 0.645764589f},
-std::array<float,2>{0.562408507f, 0.0293824766f},
-std::array<float,2>{0.439055562f, 0.788196325f},
-std::array<float,2>{0.119315267f, 0.330672383f},
-std::array<float,2>{0.964643776f, 0.500592113f},
-std::array<float,2>{0.82520324f, 0.400431901f},
-std::array<float,2>{0.204331264f, 0.69651264f},
-std::array<float,2>{0.359002858f, 0.242157161f},
-std::array<float,2>{0.71061033f, 0.980534792f},
-std::array<float,2>{0.56821847f, 0.44238326f},
-std::array<float,2>{0.408817202f, 0.6850214f},
-std::array<float,2>{0.0133219324f, 0.12637417f},
-std::array<float,2>{0.885908246f, 0.922532737f},
-std::array<float,2>{0.776330471f, 0.12425077f},
-std::array<float,2>{0.127761871f, 0.860566318f},
-std::array<float,2>{0.283491284f, 0.30082038f},
-std::array<float,2>{0.642659128f, 0.604101002f},
-std::array<float,2>{0.731621504f, 0.189755246f},
-std::array<float,2>{0.340729952f, 0.954087615f},
-std::array<float,2>{0.249980241f, 0.422041744f},
-std::array<float,2>{0.854148805f, 0.744240701f},
-std::array<float,2>{0.970612705f, 0.372333258f},
-std::array<float,2>{0.070936963f, 0.562495351f},
-std::array<float,2>{0.495880544f, 0.0436297357f},
-std::array<float,2>{0.511052489f, 0.768124521f},
-std::array<float,2>{0.588277936f, 0.36261037f},
-std::array<float,2>{0.422649413f, 0.554680645f},
-std::array<float,2>{0.0287610348f, 0.0339877047f},
-std::array<float,2>{0.891840816f, 0.774151087f},
-std::array<float,2>{0.758073211f, 0.202550381f},
-std::array<float,2>{0.146010652f, 0.961460829f},
-std::array<float,2>{0.303151757f, 0.431537658f},
-std::array<float,2>{0.634475946f, 0.734657049f},
-std::array<float,2>{0.740520895f, 0.117150106f},
-std::array<float,2>{0.319619834f, 0.869960785f},
-std::array<float,2>{0.219642401f, 0.30665645f},
-std::array<float,2>{0.865711331f, 0.599092185f},
-std::array<float,2>{0.987721264f, 0.450351685f},
-std::array<float,2>{0.0919778273f, 0.675502002f},
-std::array<float,2>{0.481309503f, 0.135449916f},
-std::array<float,2>{0.520465255f, 0.937011898f},
-std::array<float,2>{0.685008585f, 0.397424817f},
-std::array<float,2>{0.280198514f, 0.693681717f},
-std::array<float,2>{0.156799778f, 0.248062596f},
-std::array<float,2>{0.80973959f, 0.970433533f},
-std::array<float,2>{0.917046249f, 0.0169567075f},
-std::array<float,2>{0.0497490577f, 0.794542849f},
-std::array<float,2>{0.384894818f, 0.339842707f},
-std::array<float,2>{0.597198784f, 0.512379766f},
-std::array<float,2>{0.537398994f, 0.158072039f},
-std::array<float,2>{0.457232922f, 0.876573801f},
-std::array<float,2>{0.104100883f, 0.498895228f},
-std::array<float,2>{0.946744025f, 0.6509009f},
-std::array<float,2>{0.832238615f, 0.268338293f},
-std::array<float,2>{0.19580175f, 0.578529775f},
-std::array<float,2>{0.367154956f, 0.071163781f},
-std::array<float,2>{0.702547371f, 0.828276336f},
-std::array<float,2>{0.70324713f, 0.285162956f},
-std::array<float,2>{0.355249554f, 0.622675419f},
-std::array<float,2>{0.210857272f, 0.0955965593f},
-std::array<float,2>{0.82117027f, 0.858308315f},
-std::array<float,2>{0.965655625f, 0.154327363f},
-std::array<float,2>{0.121586613f, 0.908979535f},
-std::array<float,2>{0.442142904f, 0.458945364f},
-std::array<float,2>{0.554760695f, 0.658622742f},
-std::array<float,2>{0.621031761f, 0.0506463349f},
-std::array<float,2>{0.401047707f, 0.758809388f},
-std::array<float,2>{0.0366008841f, 0.346252471f},
-std::array<float,2>{0.929816902f, 0.536517978f},
-std::array<float,2>{0.781275928f, 0.417808682f},
-std::array<float,2>{0.185501158f, 0.729935765f},
-std::array<float,2>{0.25486356f, 0.207877919f},
-std::array<float,2>{0.665677249f, 0.940416753f},
-std::array<float,2>{0.514036179f, 0.479990602f},
-std::array<float,2>{0.49836427f, 0.634297967f},
-std::array<float,2>{0.0773397535f, 0.187263146f},
-std::array<float,2>{0.97468406f, 0.898615181f},
-std::array<float,2>{0.855647445f, 0.0792658031f},
-std::array<float,2>{0.245973796f, 0.819267213f},
-std::array<float,2>{0.336009324f, 0.25577879f},
-std::array<float,2>{0.727252185f, 0.571947634f},
-std::array<float,2>{0.647644877f, 0.227807209f},
-std::array<float,2>{0.288294911f, 0.994919002f},
-std::array<float,2>{0.129967585f, 0.38706857f},
-std::array<float,2>{0.780308902f, 0.716159165f},
-std::array<float,2>{0.889140666f, 0.313143402f},
-std::array<float,2>{0.0105459495f, 0.528769851f},
-std::array<float,2>{0.410744965f, 0.000757450296f},
-std::array<float,2>{0.563323081f, 0.808727026f},
-std::array<float,2>{0.549043894f, 0.262456447f},
-std::array<float,2>{0.445753992f, 0.568801045f},
-std::array<float,2>{0.11349678f, 0.093649447f},
-std::array<float,2>{0.956355214f, 0.826031089f},
-std::array<float,2>{0.816295683f, 0.179416046f},
-std::array<float,2>{0.216429725f, 0.891890228f},
-std::array<float,2>{0.350734919f, 0.47072354f},
-std::array<float,2>{0.718084395f, 0.626827776f},
-std::array<float,2>{0.662198544f, 0.00783467479f},
-std::array<float,2>{0.261268467f, 0.797056437f},
-std::array<float,2>{0.174078852f, 0.321951151f},
-std::array<float,2>{0.794819832f, 0.517913282f},
-std::array<float,2>{0.926933706f, 0.380613267f},
-std::array<float,2>{0.0392226167f, 0.70340836f},
-std::array<float,2>{0.395997852f, 0.22046642f},
-std::array<float,2>{0.614268482f, 0.985721171f},
-std::array<float,2>{0.723638773f, 0.467065156f},
-std::array<float,2>{0.334499151f, 0.668267488f},
-std::array<float,2>{0.237122729f, 0.144910336f},
-std::array<float,2>{0.84829241f, 0.914514542f},
-std::array<float,2>{0.977397561f, 0.105902717f},
-std::array<float,2>{0.0699926093f, 0.844971418f},
-std::array<float,2>{0.489849359f, 0.289372116f},
-std::array<float,2>{0.502978027f, 0.610599577f},
-std::array<float,2>{0.576278448f, 0.215884745f},
-std::array<float,2>{0.420916319f, 0.945904732f},
-std::array<float,2>{0.00333410176f, 0.411830723f},
-std::array<float,2>{0.878410578f, 0.723623812f},
-std::array<float,2>{0.768532634f, 0.355011284f},
-std::array<float,2>{0.139056727f, 0.546199203f},
-std::array<float,2>{0.29159987f, 0.055225566f},
-std::array<float,2>{0.649890602f, 0.751193285f},
-std::array<float,2>{0.630444527f, 0.33560583f},
-std::array<float,2>{0.310569704f, 0.505274057f},
-std::array<float,2>{0.14887543f, 0.0268402193f},
-std::array<float,2>{0.752712131f, 0.782432795f},
-std::array<float,2>{0.902239978f, 0.234430969f},
-std::array<float,2>{0.0191000625f, 0.977695584f},
-std::array<float,2>{0.436001569f, 0.404417276f},
-std::array<float,2>{0.579145312f, 0.699626088f},
-std::array<float,2>{0.529392123f, 0.0693407431f},
-std::array<float,2>{0.469794393f, 0.842668712f},
-std::array<float,2>{0.0835714415f, 0.276785135f},
-std::array<float,2>{0.997599483f, 0.592840672f},
-std::array<float,2>{0.872537553f, 0.486728758f},
-std::array<float,2>{0.230660215f, 0.643415093f},
-std::array<float,2>{0.321748853f, 0.167261988f},
-std::array<float,2>{0.744593441f, 0.890414894f},
-std::array<float,2>{0.607990861f, 0.428635091f},
-std::array<float,2>{0.38104251f, 0.746550798f},
-std::array<float,2>{0.0583229661f, 0.193537012f},
-std::array<float,2>{0.913707376f, 0.959865034f},
-std::array<float,2>{0.802524984f, 0.0403171405f},
-std::array<float,2>{0.170900837f, 0.771298349f},
-std::array<float,2>{0.273148865f, 0.36860019f},
-std::array<float,2>{0.677184522f, 0.557451546f},
-std::array<float,2>{0.687944353f, 0.130693972f},
-std::array<float,2>{0.36834532f, 0.928859055f},
-std::array<float,2>{0.19049345f, 0.440730274f},
-std::array<float,2>{0.843570352f, 0.682459712f},
-std::array<float,2>{0.944832861f, 0.299523681f},
-std::array<float,2>{0.100602373f, 0.608602405f},
-std::array<float,2>{0.464291394f, 0.118033096f},
-std::array<float,2>{0.546288848f, 0.864857554f},
-std::array<float,2>{0.571147978f, 0.271744639f},
-std::array<float,2>{0.416998714f, 0.585107863f},
-std::array<float,2>{0.00432118354f, 0.0779959708f},
-std::array<float,2>{0.880725622f, 0.834824622f},
-std::array<float,2>{0.772988379f, 0.163942888f},
-std::array<float,2>{0.136400715f, 0.881995678f},
-std::array<float,2>{0.29603678f, 0.496061623f},
-std::array<float,2>{0.65262121f, 0.652439713f},
-std::array<float,2>{0.719199479f, 0.0229199696f},
-std::array<float,2>{0.331198663f, 0.791877449f},
-std::array<float,2>{0.238421828f, 0.340320617f},
-std::array<float,2>{0.844295204f, 0.508772194f},
-std::array<float,2>{0.984277368f, 0.392468363f},
-std::array<float,2>{0.0648711324f, 0.688465536f},
-std::array<float,2>{0.48797822f, 0.245516136f},
-std::array<float,2>{0.507502377f, 0.973208129f},
-std::array<float,2>{0.657879651f, 0.446724504f},
-std::array<float,2>{0.265455961f, 0.676184833f},
-std::array<float,2>{0.179008588f, 0.138745412f},
-std::array<float,2>{0.792602777f, 0.931060672f},
-std::array<float,2>{0.924449861f, 0.109815463f},
-std::array<float,2>{0.0452321768f, 0.873594344f},
-std::array<float,2>{0.392814904f, 0.310694605f},
-std::array<float,2>{0.613111854f, 0.594830096f},
-std::array<float,2>{0.552615225f, 0.195391402f},
-std::array<float,2>{0.449378252f, 0.964859366f},
-std::array<float,2>{0.11037875f, 0.436011165f},
-std::array<float,2>{0.957928479f, 0.73987323f},
-std::array<float,2>{0.818444848f, 0.365070015f},
-std::array<float,2>{0.212493837f, 0.548279583f},
-std::array<float,2>{0.346007258f, 0.0364131257f},
-std::array<float,2>{0.713636875f, 0.777914822f},
-std::array<float,2>{0.692978382f, 0.317626327f},
-std::array<float,2>{0.372385681f, 0.525189996f},
-std::array<float,2>{0.191597447f, 0.00468366127f},
-std::array<float,2>{0.838500082f, 0.805714369f},
-std::array<float,2>{0.93832761f, 0.233227372f},
-std::array<float,2>{0.0942846909f, 0.998149455f},
-std::array<float,2>{0.468580663f, 0.384687513f},
-std::array<float,2>{0.541543245f, 0.712854743f},
-std::array<float,2>{0.602824271f, 0.0851865038f},
-std::array<float,2>{0.376577526f, 0.813117623f},
-std::array<float,2>{0.0623085983f, 0.25282082f},
-std::array<float,2>{0.90899545f, 0.575565934f},
-std::array<float,2>{0.798691273f, 0.483753383f},
-std::array<float,2>{0.164961159f, 0.640579879f},
-std::array<float,2>{0.267285854f, 0.183340952f},
-std::array<float,2>{0.675242543f, 0.905572057f},
-std::array<float,2>{0.524004996f, 0.420449346f},
-std::array<float,2>{0.472727925f, 0.733350933f},
-std::array<float,2>{0.0793588907f, 0.206014842f},
-std::array<float,2>{0.995312274f, 0.941632092f},
-std::array<float,2>{0.870877087f, 0.0525698885f},
-std::array<float,2>{0.228505924f, 0.764968991f},
-std::array<float,2>{0.32634294f, 0.348765016f},
-std::array<float,2>{0.749038279f, 0.533395648f},
-std::array<float,2>{0.628208399f, 0.1493195f},
-std::array<float,2>{0.306361049f, 0.912114322f},
-std::array<float,2>{0.155645013f, 0.45380193f},
-std::array<float,2>{0.757511258f, 0.662833214f},
-std::array<float,2>{0.902717233f, 0.284970224f},
-std::array<float,2>{0.019609658f, 0.617489398f},
-std::array<float,2>{0.430275172f, 0.10025271f},
-std::array<float,2>{0.584154189f, 0.855044067f},
-std::array<float,2>{0.531880915f, 0.356551379f},
-std::array<float,2>{0.455317944f, 0.541672528f},
-std::array<float,2>{0.106709205f, 0.0590939969f},
-std::array<float,2>{0.950183511f, 0.757299542f},
-std::array<float,2>{0.829448998f, 0.214044839f},
-std::array<float,2>{0.19947347f, 0.952391148f},
-std::array<float,2>{0.362290263f, 0.40654242f},
-std::array<float,2>{0.696553171f, 0.722287178f},
-std::array<float,2>{0.682817161f, 0.105180606f},
-std::array<float,2>{0.27421841f, 0.851038635f},
-std::array<float,2>{0.163476124f, 0.29646042f},
-std::array<float,2>{0.805624962f, 0.615923464f},
-std::array<float,2>{0.920806706f, 0.463555634f},
-std::array<float,2>{0.0518066809f, 0.664799988f},
-std::array<float,2>{0.386980236f, 0.143896535f},
-std::array<float,2>{0.599515378f, 0.919367731f},
-std::array<float,2>{0.736818969f, 0.378745705f},
-std::array<float,2>{0.312817454f, 0.707317412f},
-std::array<float,2>{0.226325303f, 0.223277912f},
-std::array<float,2>{0.86314851f, 0.990448415f},
-std::array<float,2>{0.989797115f, 0.0117282234f},
-std::array<float,2>{0.0888046771f, 0.804468393f},
-std::array<float,2>{0.478976905f, 0.327762276f},
-std::array<float,2>{0.516387284f, 0.519568086f},
-std::array<float,2>{0.59155637f, 0.175695747f},
-std::array<float,2>{0.425995529f, 0.895235121f},
-std::array<float,2>{0.0262169167f, 0.473786563f},
-std::array<float,2>{0.894885838f, 0.629105449f},
-std::array<float,2>{0.764922976f, 0.261507809f},
-std::array<float,2>{0.143429935f, 0.566194534f},
-std::array<float,2>{0.297356218f, 0.0880880952f},
-std::array<float,2>{0.637428343f, 0.821219742f},
-std::array<float,2>{0.641605198f, 0.304118723f},
-std::array<float,2>{0.283112377f, 0.602394044f},
-std::array<float,2>{0.1259294f, 0.122562222f},
-std::array<float,2>{0.774078012f, 0.863249242f},
-std::array<float,2>{0.882824361f, 0.128263324f},
-std::array<float,2>{0.0147213629f, 0.925147891f},
-std::array<float,2>{0.406957835f, 0.443622082f},
-std::array<float,2>{0.568763614f, 0.686986804f},
-std::array<float,2>{0.509731531f, 0.0452757366f},
-std::array<float,2>{0.492535174f, 0.766189218f},
-std::array<float,2>{0.0725523829f, 0.373697191f},
-std::array<float,2>{0.971483171f, 0.558696628f},
-std::array<float,2>{0.851653337f, 0.424492449f},
-std::array<float,2>{0.246828303f, 0.743196666f},
-std::array<float,2>{0.342265546f, 0.188761964f},
-std::array<float,2>{0.733995616f, 0.955541074f},
-std::array<float,2>{0.624979675f, 0.492162883f},
-std::array<float,2>{0.405176789f, 0.647232831f},
-std::array<float,2>{0.0348969512f, 0.168592602f},
-std::array<float,2>{0.936989069f, 0.886525989f},
-std::array<float,2>{0.786908567f, 0.0625793263f},
-std::array<float,2>{0.180856511f, 0.838935375f},
-std::array<float,2>{0.250398099f, 0.278766483f},
-std::array<float,2>{0.668587089f, 0.586066663f},
-std::array<float,2>{0.707898736f, 0.239320278f},
-std::array<float,2>{0.355786741f, 0.982630968f},
-std::array<float,2>{0.205431491f, 0.398525059f},
-std::array<float,2>{0.826676369f, 0.697844625f},
-std::array<float,2>{0.96284914f, 0.329847842f},
-std::array<float,2>{0.117592007f, 0.503729761f},
-std::array<float,2>{0.440653831f, 0.0277369879f},
-std::array<float,2>{0.560297668f, 0.785404861f},
-std::array<float,2>{0.594134808f, 0.337822646f},
-std::array<float,2>{0.383115679f, 0.515246034f},
-std::array<float,2>{0.0478754081f, 0.0190902185f},
-std::array<float,2>{0.914809942f, 0.796374798f},
-std::array<float,2>{0.811842144f, 0.24677068f},
-std::array<float,2>{0.159177929f, 0.970911622f},
-std::array<float,2>{0.277925611f, 0.396032572f},
-std::array<float,2>{0.686653376f, 0.692564785f},
-std::array<float,2>{0.701150298f, 0.0723387897f},
-std::array<float,2>{0.365124077f, 0.830331683f},
-std::array<float,2>{0.197840035f, 0.267247289f},
-std::array<float,2>{0.835358858f, 0.580628812f},
-std::array<float,2>{0.947537959f, 0.496732235f},
-std::array<float,2>{0.103288881f, 0.649666607f},
-std::array<float,2>{0.460144192f, 0.159060821f},
-std::array<float,2>{0.536334217f, 0.878529012f},
-std::array<float,2>{0.63497746f, 0.431837589f},
-std::array<float,2>{0.301912904f, 0.737429619f},
-std::array<float,2>{0.148348629f, 0.200314194f},
-std::array<float,2>{0.760435343f, 0.963501871f},
-std::array<float,2>{0.894151151f, 0.0326769873f},
-std::array<float,2>{0.0296486486f, 0.777242661f},
-std::array<float,2>{0.425637186f, 0.360467374f},
-std::array<float,2>{0.58706665f, 0.55209744f},
-std::array<float,2>{0.523361027f, 0.134577543f},
-std::array<float,2>{0.48249799f, 0.934263527f},
-std::array<float,2>{0.0902975425f, 0.451318711f},
-std::array<float,2>{0.98497355f, 0.673677504f},
-std::array<float,2>{0.864009857f, 0.304715693f},
-std::array<float,2>{0.221993312f, 0.600867212f},
-std::array<float,2>{0.317085594f, 0.114964567f},
-std::array<float,2>{0.740088761f, 0.867693722f},
-std::array<float,2>{0.729834497f, 0.257018626f},
-std::array<float,2>{0.338214099f, 0.572693706f},
-std::array<float,2>{0.244029626f, 0.0806194693f},
-std::array<float,2>{0.858685613f, 0.817520976f},
-std::array<float,2>{0.972677767f, 0.184135005f},
-std::array<float,2>{0.0759284794f, 0.901633501f},
-std::array<float,2>{0.497490436f, 0.477285415f},
-std::array<float,2>{0.512453318f, 0.635620117f},
-std::array<float,2>{0.565532088f, 0.00325250998f},
-std::array<float,2>{0.413982868f, 0.811628997f},
-std::array<float,2>{0.00866671093f, 0.314650655f},
-std::array<float,2>{0.887967825f, 0.529534161f},
-std::array<float,2>{0.777484059f, 0.390147209f},
-std::array<float,2>{0.130976737f, 0.718577087f},
-std::array<float,2>{0.286369592f, 0.228883684f},
-std::array<float,2>{0.646118045f, 0.993153393f},
-std::array<float,2>{0.558496952f, 0.459758043f},
-std::array<float,2>{0.444619417f, 0.657303274f},
-std::array<float,2>{0.123496793f, 0.153967753f},
-std::array<float,2>{0.967530608f, 0.907158256f},
-std::array<float,2>{0.822392285f, 0.0964490697f},
-std::array<float,2>{0.208900362f, 0.856754899f},
-std::array<float,2>{0.352993339f, 0.28762123f},
-std::array<float,2>{0.706799269f, 0.62307179f},
-std::array<float,2>{0.666330636f, 0.21073781f},
-std::array<float,2>{0.257138819f, 0.937715769f},
-std::array<float,2>{0.185632348f, 0.415983468f},
-std::array<float,2>{0.784864128f, 0.726989269f},
-std::array<float,2>{0.932534039f, 0.343906641f},
-std::array<float,2>{0.0385773964f, 0.537535906f},
-std::array<float,2>{0.399591893f, 0.0482222214f},
-std::array<float,2>{0.617796242f, 0.759889603f},
-std::array<float,2>{0.501787186f, 0.291584522f},
-std::array<float,2>{0.490397304f, 0.611760497f},
-std::array<float,2>{0.0675662532f, 0.107517302f},
-std::array<float,2>{0.979053915f, 0.846287072f},
-std::array<float,2>{0.850633144f, 0.147140175f},
-std::array<float,2>{0.234968841f, 0.916939616f},
-std::array<float,2>{0.332299352f, 0.466793865f},
-std::array<float,2>{0.726315379f, 0.67035073f},
-std::array<float,2>{0.650782347f, 0.0584865287f},
-std::array<float,2>{0.290954083f, 0.753520608f},
-std::array<float,2>{0.1377711f, 0.353448004f},
-std::array<float,2>{0.766690671f, 0.54352814f},
-std::array<float,2>{0.875047624f, 0.413351059f},
-std::array<float,2>{0.0014294245f, 0.725143075f},
-std::array<float,2>{0.41922915f, 0.21698004f},
-std::array<float,2>{0.574321032f, 0.948799014f},
-std::array<float,2>{0.716452479f, 0.470013618f},
-std::array<float,2>{0.34856832f, 0.627225578f},
-std::array<float,2>{0.217688158f, 0.17688638f},
-std::array<float,2>{0.81408447f, 0.893316567f},
-std::array<float,2>{0.954294205f, 0.090750657f},
-std::array<float,2>{0.115334824f, 0.826409101f},
-std::array<float,2>{0.447661132f, 0.265338004f},
-std::array<float,2>{0.548464239f, 0.568338156f},
-std::array<float,2>{0.615501523f, 0.22212325f},
-std::array<float,2>{0.397828698f, 0.98669064f},
-std::array<float,2>{0.0417759493f, 0.382210106f},
-std::array<float,2>{0.928065598f, 0.706216216f},
-std::array<float,2>{0.795018435f, 0.322462887f},
-std::array<float,2>{0.173075408f, 0.51695317f},
-std::array<float,2>{0.259704828f, 0.010867713f},
-std::array<float,2>{0.661431372f, 0.799559891f},
-std::array<float,2>{0.679612875f, 0.369508058f},
-std::array<float,2>{0.270858824f, 0.554811001f},
-std::array<float,2>{0.169685394f, 0.0423522964f},
-std::array<float,2>{0.802933812f, 0.772612572f},
-std::array<float,2>{0.911005974f, 0.191785395f},
-std::array<float,2>{0.0549392514f, 0.957212269f},
-std::array<float,2>{0.379726082f, 0.427410483f},
-std::array<float,2>{0.606204927f, 0.749958158f},
-std::array<float,2>{0.544819772f, 0.119410582f},
-std::array<float,2>{0.462412387f, 0.866408706f},
-std::array<float,2>{0.0979767442f, 0.297050625f},
-std::array<float,2>{0.942515671f, 0.606769502f},
-std::array<float,2>{0.840388536f, 0.439374149f},
-std::array<float,2>{0.188926473f, 0.680238187f},
-std::array<float,2>{0.36920175f, 0.131906897f},
-std::array<float,2>{0.690334916f, 0.926842749f},
-std::array<float,2>{0.580188453f, 0.403903395f},
-std::array<float,2>{0.43399331f, 0.702765584f},
-std::array<float,2>{0.0173348021f, 0.23689954f},
-std::array<float,2>{0.900335789f, 0.979824662f},
-std::array<float,2>{0.750656843f, 0.0246148575f},
-std::array<float,2>{0.151492551f, 0.78442049f},
-std::array<float,2>{0.309034258f, 0.333670378f},
-std::array<float,2>{0.632553875f, 0.507455111f},
-std::array<float,2>{0.743657947f, 0.164362654f},
-std::array<float,2>{0.323574901f, 0.888402343f},
-std::array<float,2>{0.232570127f, 0.484729171f},
-std::array<float,2>{0.874863505f, 0.641712725f},
-std::array<float,2>{0.999379992f, 0.275183976f},
-std::array<float,2>{0.0856636539f, 0.591034293f},
-std::array<float,2>{0.471593142f, 0.0674660578f},
-std::array<float,2>{0.527679086f, 0.84100157f},
-std::array<float,2>{0.585178316f, 0.281612962f},
-std::array<float,2>{0.430935919f, 0.6199705f},
-std::array<float,2>{0.0207933411f, 0.0981907919f},
-std::array<float,2>{0.904021859f, 0.85273701f},
-std::array<float,2>{0.756033778f, 0.151921421f},
-std::array<float,2>{0.154488787f, 0.910878539f},
-std::array<float,2>{0.305185467f, 0.455495477f},
-std::array<float,2>{0.627277493f, 0.661474347f},
-std::array<float,2>{0.748094499f, 0.0527442545f},
-std::array<float,2>{0.32807827f, 0.762571692f},
-std::array<float,2>{0.226808295f, 0.349761635f},
-std::array<float,2>{0.869804859f, 0.531250775f},
-std::array<float,2>{0.995093405f, 0.419116676f},
-std::array<float,2>{0.0782615095f, 0.73236239f},
-std::array<float,2>{0.474436671f, 0.203355715f},
-std::array<float,2>{0.524590254f, 0.944970667f},
-std::array<float,2>{0.673992574f, 0.480938941f},
-std::array<float,2>{0.266575187f, 0.637196362f},
-std::array<float,2>{0.16592972f, 0.181636766f},
-std::array<float,2>{0.797823966f, 0.903541923f},
-std::array<float,2>{0.909386516f, 0.0837304443f},
-std::array<float,2>{0.0610592924f, 0.814798176f},
-std::array<float,2>{0.375525773f, 0.250347584f},
-std::array<float,2>{0.602285564f, 0.578008115f},
-std::array<float,2>{0.542092443f, 0.230838627f},
-std::array<float,2>{0.467223763f, 0.99697578f},
-std::array<float,2>{0.0950982273f, 0.385341257f},
-std::array<float,2>{0.939448476f, 0.714490414f},
-std::array<float,2>{0.839618802f, 0.319733858f},
-std::array<float,2>{0.192805037f, 0.525636613f},
-std::array<float,2>{0.371383429f, 0.00761799235f},
-std::array<float,2>{0.691824436f, 0.807171166f},
-std::array<float,2>{0.714457214f, 0.365900338f},
-std::array<float,2>{0.347602934f, 0.549434423f},
-std::array<float,2>{0.211297989f, 0.037145175f},
-std::array<float,2>{0.820125341f, 0.780772626f},
-std::array<float,2>{0.958026171f, 0.197602496f},
-std::array<float,2>{0.109741196f, 0.968400955f},
-std::array<float,2>{0.450395972f, 0.433857173f},
-std::array<float,2>{0.551336586f, 0.741218865f},
-std::array<float,2>{0.611926556f, 0.1120672f},
-std::array<float,2>{0.394430697f, 0.872039258f},
-std::array<float,2>{0.0468657538f, 0.308888078f},
-std::array<float,2>{0.924871743f, 0.597201586f},
-std::array<float,2>{0.791069269f, 0.447670966f},
-std::array<float,2>{0.178707972f, 0.67810446f},
-std::array<float,2>{0.264105856f, 0.137656122f},
-std::array<float,2>{0.657121956f, 0.93318516f},
-std::array<float,2>{0.506112337f, 0.393829018f},
-std::array<float,2>{0.486659408f, 0.689995408f},
-std::array<float,2>{0.0657043085f, 0.242947802f},
-std::array<float,2>{0.98259896f, 0.976037443f},
-std::array<float,2>{0.845336318f, 0.0200520325f},
-std::array<float,2>{0.240212992f, 0.78950727f},
-std::array<float,2>{0.330406159f, 0.342806518f},
-std::array<float,2>{0.720376134f, 0.511502266f},
-std::array<float,2>{0.653348744f, 0.160584673f},
-std::array<float,2>{0.295486301f, 0.879496932f},
-std::array<float,2>{0.135469601f, 0.493435979f},
-std::array<float,2>{0.771735549f, 0.655135691f},
-std::array<float,2>{0.879548848f, 0.27075237f},
-std::array<float,2>{0.00506624579f, 0.583444595f},
-std::array<float,2>{0.416208327f, 0.0750905573f},
-std::array<float,2>{0.571811497f, 0.833410621f},
-std::array<float,2>{0.559065104f, 0.331568182f},
-std::array<float,2>{0.440080523f, 0.501793325f},
-std::array<float,2>{0.118219383f, 0.03082758f},
-std::array<float,2>{0.961132765f, 0.787473738f},
-std::array<float,2>{0.827764153f, 0.240505055f},
-std::array<float,2>{0.206631586f, 0.981871486f},
-std::array<float,2>{0.356724024f, 0.40158692f},
-std::array<float,2>{0.708167374f, 0.695892453f},
-std::array<float,2>{0.669172108f, 0.0652785599f},
-std::array<float,2>{0.251348972f, 0.837595105f},
-std::array<float,2>{0.180109754f, 0.280078769f},
-std::array<float,2>{0.785534382f, 0.589826226f},
-std::array<float,2>{0.935629845f, 0.489571929f},
-std::array<float,2>{0.0336385816f, 0.644892037f},
-std::array<float,2>{0.405540526f, 0.170024335f},
-std::array<float,2>{0.623403192f, 0.883187413f},
-std::array<float,2>{0.733120859f, 0.423415333f},
-std::array<float,2>{0.343306452f, 0.745963693f},
-std::array<float,2>{0.247446284f, 0.190789253f},
-std::array<float,2>{0.852959812f, 0.954385161f},
-std::array<float,2>{0.97193718f, 0.0444372147f},
-std::array<float,2>{0.0733252242f, 0.768997192f},
-std::array<float,2>{0.493525147f, 0.371623248f},
-std::array<float,2>{0.508712649f, 0.560966253f},
-std::array<float,2>{0.569797873f, 0.12510474f},
-std::array<float,2>{0.407246083f, 0.923093617f},
-std::array<float,2>{0.0142816901f, 0.442257822f},
-std::array<float,2>{0.884434223f, 0.683996558f},
-std::array<float,2>{0.774882019f, 0.302041888f},
-std::array<float,2>{0.12622261f, 0.605451822f},
-std::array<float,2>{0.281318635f, 0.123213679f},
-std::array<float,2>{0.640931904f, 0.860166311f},
-std::array<float,2>{0.638492703f, 0.258908153f},
-std::array<float,2>{0.298421592f, 0.5643664f},
-std::array<float,2>{0.144472286f, 0.0873022377f},
-std::array<float,2>{0.764230311f, 0.822320938f},
-std::array<float,2>{0.895997584f, 0.172224417f},
-std::array<float,2>{0.0272205323f, 0.898083806f},
-std::array<float,2>{0.426834106f, 0.4751454f},
-std::array<float,2>{0.589942634f, 0.632571697f},
-std::array<float,2>{0.517557859f, 0.013780185f},
-std::array<float,2>{0.480245173f, 0.801981211f},
-std::array<float,2>{0.0892131627f, 0.325340182f},
-std::array<float,2>{0.98868072f, 0.521555424f},
-std::array<float,2>{0.861862063f, 0.375479817f},
-std::array<float,2>{0.225297526f, 0.709014535f},
-std::array<float,2>{0.313703388f, 0.22508347f},
-std::array<float,2>{0.738273561f, 0.989897668f},
-std::array<float,2>{0.59796536f, 0.461999148f},
-std::array<float,2>{0.388057709f, 0.66733402f},
-std::array<float,2>{0.051384639f, 0.142078668f},
-std::array<float,2>{0.921109736f, 0.92072922f},
-std::array<float,2>{0.805672228f, 0.101902023f},
-std::array<float,2>{0.162280977f, 0.84777236f},
-std::array<float,2>{0.274758369f, 0.294050843f},
-std::array<float,2>{0.682256997f, 0.613808393f},
-std::array<float,2>{0.696223676f, 0.211469442f},
-std::array<float,2>{0.363188833f, 0.949395239f},
-std::array<float,2>{0.200584367f, 0.408420801f},
-std::array<float,2>{0.8284868f, 0.720697403f},
-std::array<float,2>{0.950320959f, 0.358437896f},
-std::array<float,2>{0.105845325f, 0.540959775f},
-std::array<float,2>{0.456970811f, 0.0606541261f},
-std::array<float,2>{0.5329386f, 0.755042911f},
-std::array<float,2>{0.618774831f, 0.347174674f},
-std::array<float,2>{0.398623466f, 0.53519237f},
-std::array<float,2>{0.0372362696f, 0.0495457053f},
-std::array<float,2>{0.933214307f, 0.758442461f},
-std::array<float,2>{0.783467531f, 0.20869863f},
-std::array<float,2>{0.186711565f, 0.940507889f},
-std::array<float,2>{0.256830871f, 0.41611442f},
-std::array<float,2>{0.66780901f, 0.728884041f},
-std::array<float,2>{0.705191851f, 0.0943021178f},
-std::array<float,2>{0.35242942f, 0.858772099f},
-std::array<float,2>{0.207573995f, 0.286214739f},
-std::array<float,2>{0.823786914f, 0.621983647f},
-std::array<float,2>{0.968079984f, 0.457772583f},
-std::array<float,2>{0.124942735f, 0.65999651f},
-std::array<float,2>{0.444319457f, 0.155797288f},
-std::array<float,2>{0.556758285f, 0.909450054f},
-std::array<float,2>{0.645499706f, 0.388341635f},
-std::array<float,2>{0.285301149f, 0.715411603f},
-std::array<float,2>{0.132771671f, 0.226914778f},
-std::array<float,2>{0.778805673f, 0.995434105f},
-std::array<float,2>{0.887180865f, 0.00124436093f},
-std::array<float,2>{0.00925450027f, 0.809752166f},
-std::array<float,2>{0.412894607f, 0.31413725f},
-std::array<float,2>{0.564910173f, 0.527606189f},
-std::array<float,2>{0.5132007f, 0.186003f},
-std::array<float,2>{0.496876985f, 0.900390625f},
-std::array<float,2>{0.0743972957f, 0.478837699f},
-std::array<float,2>{0.97436285f, 0.632838786f},
-std::array<float,2>{0.857513785f, 0.254864484f},
-std::array<float,2>{0.242716715f, 0.57045573f},
-std::array<float,2>{0.33906278f, 0.0789880902f},
-std::array<float,2>{0.729236543f, 0.81980598f},
-std::array<float,2>{0.73895359f, 0.307876348f},
-std::array<float,2>{0.317428529f, 0.598571777f},
-std::array<float,2>{0.220931575f, 0.115864716f},
-std::array<float,2>{0.864642978f, 0.870320499f},
-std::array<float,2>{0.985555947f, 0.1365657f},
-std::array<float,2>{0.0915421247f, 0.936171472f},
-std::array<float,2>{0.483785123f, 0.449467868f},
-std::array<float,2>{0.522392571f, 0.674324691f},
-std::array<float,2>{0.586491942f, 0.034850046f},
-std::array<float,2>{0.42471242f, 0.775305867f},
-std::array<float,2>{0.0305116344f, 0.361715049f},
-std::array<float,2>{0.892934442f, 0.552798867f},
-std::array<float,2>{0.761163771f, 0.429949045f},
-std::array<float,2>{0.146702141f, 0.73552233f},
-std::array<float,2>{0.301095039f, 0.201852292f},
-std::array<float,2>{0.63620013f, 0.96237725f},
-std::array<float,2>{0.535607457f, 0.499865144f},
-std::array<float,2>{0.458989114f, 0.651538074f},
-std::array<float,2>{0.102240123f, 0.156406984f},
-std::array<float,2>{0.949082375f, 0.87537533f},
-std::array<float,2>{0.834847331f, 0.071799092f},
-std::array<float,2>{0.198328257f, 0.829580665f},
-std::array<float,2>{0.363560051f, 0.269255608f},
-std::array<float,2>{0.699250817f, 0.579310656f},
-std::array<float,2>{0.686265945f, 0.24943915f},
-std::array<float,2>{0.279202521f, 0.969027698f},
-std::array<float,2>{0.159633398f, 0.397927076f},
-std::array<float,2>{0.811291277f, 0.69443363f},
-std::array<float,2>{0.915101051f, 0.338477582f},
-std::array<float,2>{0.0473553017f, 0.513335407f},
-std::array<float,2>{0.38432771f, 0.0162686519f},
-std::array<float,2>{0.595003009f, 0.793562472f},
-std::array<float,2>{0.528909862f, 0.27593118f},
-std::array<float,2>{0.47243315f, 0.59242022f},
-std::array<float,2>{0.0849578008f, 0.0687356591f},
-std::array<float,2>{0.998553813f, 0.843002558f},
-std::array<float,2>{0.873268783f, 0.166578978f},
-std::array<float,2>{0.233409479f, 0.888920784f},
-std::array<float,2>{0.322597742f, 0.487836629f},
-std::array<float,2>{0.742800713f, 0.643854558f},
-std::array<float,2>{0.631305158f, 0.0255735833f},
-std::array<float,2>{0.310120076f, 0.781533241f},
-std::array<float,2>{0.151270583f, 0.334266841f},
-std::array<float,2>{0.751669228f, 0.504844129f},
-std::array<float,2>{0.898848832f, 0.405768603f},
-std::array<float,2>{0.0162375532f, 0.7011531f},
-std::array<float,2>{0.435019583f, 0.235751092f},
-std::array<float,2>{0.581666887f, 0.977077782f},
-std::array<float,2>{0.691210449f, 0.44001165f},
-std::array<float,2>{0.370799005f, 0.683155835f},
-std::array<float,2>{0.188326523f, 0.129062787f},
-std::array<float,2>{0.841013968f, 0.927788079f},
-std::array<float,2>{0.941714942f, 0.118405715f},
-std::array<float,2>{0.0993877724f, 0.864010453f},
-std::array<float,2>{0.461492389f, 0.300758153f},
-std::array<float,2>{0.543900728f, 0.608015776f},
-std::array<float,2>{0.607209086f, 0.194354132f},
-std::array<float,2>{0.380359322f, 0.960065842f},
-std::array<float,2>{0.0563424192f, 0.429297864f},
-std::array<float,2>{0.912003338f, 0.747584164f},
-std::array<float,2>{0.804338455f, 0.367236555f},
-std::array<float,2>{0.168008402f, 0.55853951f},
-std::array<float,2>{0.269720048f, 0.040037103f},
-std::array<float,2>{0.67868793f, 0.769536734f},
-std::array<float,2>{0.66063863f, 0.320314467f},
-std::array<float,2>{0.258283824f, 0.518651485f},
-std::array<float,2>{0.172005877f, 0.00935635716f},
-std::array<float,2>{0.796202242f, 0.798394561f},
-std::array<float,2>{0.929036498f, 0.219434351f},
-std::array<float,2>{0.04201217f, 0.984726846f},
-std::array<float,2>{0.39704603f, 0.379327565f},
-std::array<float,2>{0.616694808f, 0.705025673f},
-std::array<float,2>{0.547800779f, 0.0926189646f},
-std::array<float,2>{0.449002206f, 0.824461341f},
-std::array<float,2>{0.116665162f, 0.263479173f},
-std::array<float,2>{0.953903675f, 0.570271313f},
-std::array<float,2>{0.812870026f, 0.472397298f},
-std::array<float,2>{0.218294024f, 0.625087261f},
-std::array<float,2>{0.349528521f, 0.178444266f},
-std::array<float,2>{0.715592265f, 0.891393542f},
-std::array<float,2>{0.575991452f, 0.410378247f},
-std::array<float,2>{0.418274939f, 0.723989367f},
-std::array<float,2>{0.000918437727f, 0.215190411f},
-std::array<float,2>{0.876235783f, 0.94709295f},
-std::array<float,2>{0.765814066f, 0.0558277331f},
-std::array<float,2>{0.137535244f, 0.750769556f},
-std::array<float,2>{0.289694995f, 0.353620768f},
-std::array<float,2>{0.651803613f, 0.545410812f},
-std::array<float,2>{0.725544155f, 0.146328166f},
-std::array<float,2>{0.333874166f, 0.915607452f},
-std::array<float,2>{0.235604331f, 0.468482494f},
-std::array<float,2>{0.850260496f, 0.669229269f},
-std::array<float,2>{0.979862213f, 0.290605813f},
-std::array<float,2>{0.067212902f, 0.610072911f},
-std::array<float,2>{0.492017329f, 0.10671363f},
-std::array<float,2>{0.500768781f, 0.844185054f},
-std::array<float,2>{0.604014635f, 0.253278196f},
-std::array<float,2>{0.378533423f, 0.57510525f},
-std::array<float,2>{0.0604628995f, 0.0841022655f},
-std::array<float,2>{0.906367123f, 0.814092815f},
-std::array<float,2>{0.799900413f, 0.182449207f},
-std::array<float,2>{0.16785191f, 0.905226469f},
-std::array<float,2>{0.267939955f, 0.482658625f},
-std::array<float,2>{0.673751473f, 0.639312804f},
-std::array<float,2>{0.694829285f, 0.00524349324f},
-std::array<float,2>{0.37428695f, 0.804920316f},
-std::array<float,2>{0.193793282f, 0.317165613f},
-std::array<float,2>{0.836860597f, 0.523638427f},
-std::array<float,2>{0.940284312f, 0.383520395f},
-std::array<float,2>{0.0965754166f, 0.711910486f},
-std::array<float,2>{0.465095043f, 0.234147325f},
-std::array<float,2>{0.539274395f, 0.999028206f},
-std::array<float,2>{0.625256538f, 0.45414573f},
-std::array<float,2>{0.308404982f, 0.663599014f},
-std::array<float,2>{0.153504103f, 0.149832219f},
-std::array<float,2>{0.755329549f, 0.914007545f},
-std::array<float,2>{0.905747116f, 0.101296984f},
-std::array<float,2>{0.0219297744f, 0.853768468f},
-std::array<float,2>{0.432528436f, 0.283896804f},
-std::array<float,2>{0.583020151f, 0.618271768f},
-std::array<float,2>{0.526840627f, 0.206442595f},
-std::array<float,2>{0.476148576f, 0.943168342f},
-std::array<float,2>{0.0805623606f, 0.42138052f},
-std::array<float,2>{0.994044721f, 0.733963907f},
-std::array<float,2>{0.86735189f, 0.348172694f},
-std::array<float,2>{0.229404658f, 0.534934461f},
-std::array<float,2>{0.325405508f, 0.051740896f},
-std::array<float,2>{0.746339023f, 0.764043808f},
-std::array<float,2>{0.722390532f, 0.341386884f},
-std::array<float,2>{0.328981042f, 0.509087026f},
-std::array<float,2>{0.241750091f, 0.0223046988f},
-std::array<float,2>{0.845932782f, 0.79274416f},
-std::array<float,2>{0.980846345f, 0.245027065f},
-std::array<float,2>{0.063866809f, 0.973827958f},
-std::array<float,2>{0.484817922f, 0.390993446f},
-std::array<float,2>{0.50492382f, 0.689422429f},
-std::array<float,2>{0.573029697f, 0.0765913501f},
-std::array<float,2>{0.414568961f, 0.835825264f},
-std::array<float,2>{0.00679138536f, 0.272968203f},
-std::array<float,2>{0.88168937f, 0.584693253f},
-std::array<float,2>{0.770375669f, 0.494773448f},
-std::array<float,2>{0.133111209f, 0.653449476f},
-std::array<float,2>{0.29437083f, 0.162409678f},
-std::array<float,2>{0.65445751f, 0.881109536f},
-std::array<float,2>{0.552823007f, 0.436722577f},
-std::array<float,2>{0.45261699f, 0.738953888f},
-std::array<float,2>{0.112580761f, 0.197167903f},
-std::array<float,2>{0.960163116f, 0.965900838f},
-std::array<float,2>{0.818178773f, 0.0352265313f},
-std::array<float,2>{0.213610977f, 0.778700948f},
-std::array<float,2>{0.343792349f, 0.363425791f},
-std::array<float,2>{0.711449325f, 0.546905756f},
-std::array<float,2>{0.659888625f, 0.139791772f},
-std::array<float,2>{0.263363898f, 0.929996729f},
-std::array<float,2>{0.177183703f, 0.445709258f},
-std::array<float,2>{0.78943181f, 0.677215457f},
-std::array<float,2>{0.922514558f, 0.311908215f},
-std::array<float,2>{0.0439910889f, 0.594080865f},
-std::array<float,2>{0.39256677f, 0.111193083f},
-std::array<float,2>{0.611116767f, 0.874954164f},
-std::array<float,2>{0.510538816f, 0.374775708f},
-std::array<float,2>{0.494975388f, 0.560512543f},
-std::array<float,2>{0.0722370297f, 0.0463571958f},
-std::array<float,2>{0.968868792f, 0.767056406f},
-std::array<float,2>{0.85531342f, 0.187573209f},
-std::array<float,2>{0.248967513f, 0.956218064f},
-std::array<float,2>{0.341484994f, 0.425454795f},
-std::array<float,2>{0.730530798f, 0.742311597f},
-std::array<float,2>{0.643642724f, 0.121495485f},
-std::array<float,2>{0.284359694f, 0.861500025f},
-std::array<float,2>{0.128338978f, 0.303101331f},
-std::array<float,2>{0.777225792f, 0.602626383f},
-std::array<float,2>{0.885420203f, 0.444556862f},
-std::array<float,2>{0.011926542f, 0.68560183f},
-std::array<float,2>{0.40958333f, 0.127405301f},
-std::array<float,2>{0.567046523f, 0.924031079f},
-std::array<float,2>{0.709286869f, 0.399532318f},
-std::array<float,2>{0.357646316f, 0.698732436f},
-std::array<float,2>{0.20406127f, 0.238598078f},
-std::array<float,2>{0.824404299f, 0.984088719f},
-std::array<float,2>{0.96329844f, 0.0285456292f},
-std::array<float,2>{0.120735995f, 0.786790609f},
-std::array<float,2>{0.43778488f, 0.329069734f},
-std::array<float,2>{0.561097622f, 0.502413929f},
-std::array<float,2>{0.621907175f, 0.169618994f},
-std::array<float,2>{0.403247714f, 0.884920776f},
-std::array<float,2>{0.0318774506f, 0.490713537f},
-std::array<float,2>{0.935029924f, 0.647754669f},
-std::array<float,2>{0.787252188f, 0.27737999f},
-std::array<float,2>{0.181716055f, 0.587497771f},
-std::array<float,2>{0.252058804f, 0.0637234822f},
-std::array<float,2>{0.671786726f, 0.838825643f},
-std::array<float,2>{0.680306494f, 0.294994771f},
-std::array<float,2>{0.276541442f, 0.616417825f},
-std::array<float,2>{0.161880717f, 0.103686832f},
-std::array<float,2>{0.807345212f, 0.850029647f},
-std::array<float,2>{0.919279993f, 0.142773092f},
-std::array<float,2>{0.0527989902f, 0.918682098f},
-std::array<float,2>{0.389121264f, 0.464335024f},
-std::array<float,2>{0.601088881f, 0.665170848f},
-std::array<float,2>{0.533409357f, 0.0603732578f},
-std::array<float,2>{0.453285575f, 0.756664932f},
-std::array<float,2>{0.108421609f, 0.355942249f},
-std::array<float,2>{0.95258677f, 0.542066634f},
-std::array<float,2>{0.831825972f, 0.408063948f},
-std::array<float,2>{0.202399507f, 0.721165001f},
-std::array<float,2>{0.35998863f, 0.212911904f},
-std::array<float,2>{0.698714554f, 0.951780975f},
-std::array<float,2>{0.592900634f, 0.472872436f},
-std::array<float,2>{0.428935677f, 0.630422711f},
-std::array<float,2>{0.0240620673f, 0.174689993f},
-std::array<float,2>{0.89710772f, 0.896418929f},
-std::array<float,2>{0.761820078f, 0.0889952928f},
-std::array<float,2>{0.141042262f, 0.821886659f},
-std::array<float,2>{0.299671263f, 0.260028154f},
-std::array<float,2>{0.639107108f, 0.565094113f},
-std::array<float,2>{0.734470904f, 0.224087581f},
-std::array<float,2>{0.315529346f, 0.99196142f},
-std::array<float,2>{0.224558696f, 0.377476722f},
-std::array<float,2>{0.859651566f, 0.708325386f},
-std::array<float,2>{0.991733313f, 0.326644897f},
-std::array<float,2>{0.0862359926f, 0.520638645f},
-std::array<float,2>{0.476747781f, 0.0130841322f},
-std::array<float,2>{0.518673956f, 0.803382754f},
-std::array<float,2>{0.564284801f, 0.31543532f},
-std::array<float,2>{0.411762446f, 0.53048861f},
-std::array<float,2>{0.0116002094f, 0.00251837377f},
-std::array<float,2>{0.890575945f, 0.811486661f},
-std::array<float,2>{0.779402256f, 0.230222315f},
-std::array<float,2>{0.129478246f, 0.993437231f},
-std::array<float,2>{0.288000792f, 0.389503807f},
-std::array<float,2>{0.64719516f, 0.717239857f},
-std::array<float,2>{0.728150189f, 0.081102781f},
-std::array<float,2>{0.337025613f, 0.816903651f},
-std::array<float,2>{0.244463578f, 0.256550431f},
-std::array<float,2>{0.857096314f, 0.573410988f},
-std::array<float,2>{0.97646147f, 0.477893233f},
-std::array<float,2>{0.0770351514f, 0.636679947f},
-std::array<float,2>{0.499468505f, 0.185020819f},
-std::array<float,2>{0.515524268f, 0.901241481f},
-std::array<float,2>{0.664990664f, 0.414199978f},
-std::array<float,2>{0.255796224f, 0.728316963f},
-std::array<float,2>{0.183814526f, 0.209063604f},
-std::array<float,2>{0.783014476f, 0.939123571f},
-std::array<float,2>{0.931061625f, 0.0474970154f},
-std::array<float,2>{0.0355312526f, 0.761392236f},
-std::array<float,2>{0.402026892f, 0.345174134f},
-std::array<float,2>{0.620080352f, 0.538141549f},
-std::array<float,2>{0.55641216f, 0.153075874f},
-std::array<float,2>{0.442519099f, 0.908093691f},
-std::array<float,2>{0.122127473f, 0.460647374f},
-std::array<float,2>{0.96632266f, 0.656544149f},
-std::array<float,2>{0.822183907f, 0.288755268f},
-std::array<float,2>{0.209800273f, 0.624922454f},
-std::array<float,2>{0.354090244f, 0.0975435078f},
-std::array<float,2>{0.70498544f, 0.856343865f},
-std::array<float,2>{0.701521695f, 0.266018003f},
-std::array<float,2>{0.366051406f, 0.581845939f},
-std::array<float,2>{0.197188154f, 0.0738280565f},
-std::array<float,2>{0.833824813f, 0.831485629f},
-std::array<float,2>{0.94561404f, 0.159550011f},
-std::array<float,2>{0.104544878f, 0.877412379f},
-std::array<float,2>{0.45872578f, 0.497678101f},
-std::array<float,2>{0.538773894f, 0.649153113f},
-std::array<float,2>{0.596281409f, 0.0183777958f},
-std::array<float,2>{0.386110723f, 0.795488179f},
-std::array<float,2>{0.0498546027f, 0.336738765f},
-std::array<float,2>{0.916665852f, 0.514042377f},
-std::array<float,2>{0.809325635f, 0.395420134f},
-std::array<float,2>{0.158152089f, 0.692096174f},
-std::array<float,2>{0.280377537f, 0.247279853f},
-std::array<float,2>{0.68455863f, 0.972469151f},
-std::array<float,2>{0.520515978f, 0.453002125f},
-std::array<float,2>{0.481655091f, 0.672068357f},
-std::array<float,2>{0.0929511413f, 0.132872418f},
-std::array<float,2>{0.98683548f, 0.935531855f},
-std::array<float,2>{0.866953313f, 0.113422349f},
-std::array<float,2>{0.219884187f, 0.86833638f},
-std::array<float,2>{0.319167107f, 0.306194872f},
-std::array<float,2>{0.74149406f, 0.599975705f},
-std::array<float,2>{0.633708715f, 0.199376598f},
-std::array<float,2>{0.304640085f, 0.964526236f},
-std::array<float,2>{0.144918412f, 0.433087766f},
-std::array<float,2>{0.759183884f, 0.737089157f},
-std::array<float,2>{0.891167641f, 0.360137641f},
-std::array<float,2>{0.0283142086f, 0.550895333f},
-std::array<float,2>{0.423143625f, 0.0317332745f},
-std::array<float,2>{0.589701951f, 0.775546312f},
-std::array<float,2>{0.545379937f, 0.297916651f},
-std::array<float,2>{0.463203311f, 0.605779469f},
-std::array<float,2>{0.100570254f, 0.120738328f},
-std::array<float,2>{0.94380343f, 0.865305066f},
-std::array<float,2>{0.842712641f, 0.131766453f},
-std::array<float,2>{0.190061674f, 0.926490188f},
-std::array<float,2>{0.367786169f, 0.438221425f},
-std::array<float,2>{0.68871218f, 0.681495905f},
-std::array<float,2>{0.676162243f, 0.0413339548f},
-std::array<float,2>{0.271629006f, 0.771613121f},
-std::array<float,2>{0.170477584f, 0.370197803f},
-std::array<float,2>{0.801420569f, 0.555996895f},
-std::array<float,2>{0.912280321f, 0.425986946f},
-std::array<float,2>{0.056781698f, 0.748605192f},
-std::array<float,2>{0.38191241f, 0.192940757f},
-std::array<float,2>{0.608573973f, 0.958486259f},
-std::array<float,2>{0.745854676f, 0.485767365f},
-std::array<float,2>{0.320571959f, 0.641473711f},
-std::array<float,2>{0.232282743f, 0.165422201f},
-std::array<float,2>{0.871461034f, 0.887585878f},
-std::array<float,2>{0.997021854f, 0.0665206015f},
-std::array<float,2>{0.0821963251f, 0.840232491f},
-std::array<float,2>{0.46902737f, 0.273820639f},
-std::array<float,2>{0.530406654f, 0.590109468f},
-std::array<float,2>{0.579006732f, 0.237506792f},
-std::array<float,2>{0.43735981f, 0.979185104f},
-std::array<float,2>{0.0183187984f, 0.403067887f},
-std::array<float,2>{0.901264727f, 0.701765537f},
-std::array<float,2>{0.753507674f, 0.332073718f},
-std::array<float,2>{0.150341377f, 0.506473243f},
-std::array<float,2>{0.312105656f, 0.0238279998f},
-std::array<float,2>{0.629472852f, 0.783752859f},
-std::array<float,2>{0.648467302f, 0.351721019f},
-std::array<float,2>{0.29203245f, 0.544120431f},
-std::array<float,2>{0.139721498f, 0.05700415f},
-std::array<float,2>{0.769333541f, 0.752863705f},
-std::array<float,2>{0.877593756f, 0.217831448f},
-std::array<float,2>{0.0025168031f, 0.947418451f},
-std::array<float,2>{0.42080915f, 0.412133157f},
-std::array<float,2>{0.578079283f, 0.725741923f},
-std::array<float,2>{0.502641141f, 0.109340787f},
-std::array<float,2>{0.488899857f, 0.847501159f},
-std::array<float,2>{0.0686766654f, 0.292062938f},
-std::array<float,2>{0.977587998f, 0.613256276f},
-std::array<float,2>{0.84906733f, 0.465190947f},
-std::array<float,2>{0.238123193f, 0.671074271f},
-std::array<float,2>{0.335054845f, 0.147640526f},
-std::array<float,2>{0.722779095f, 0.917695522f},
-std::array<float,2>{0.613853991f, 0.381077647f},
-std::array<float,2>{0.395199597f, 0.705695152f},
-std::array<float,2>{0.0405461825f, 0.22087127f},
-std::array<float,2>{0.925868928f, 0.987922072f},
-std::array<float,2>{0.793846667f, 0.0101396134f},
-std::array<float,2>{0.175378323f, 0.800182045f},
-std::array<float,2>{0.259837538f, 0.324104548f},
-std::array<float,2>{0.663291097f, 0.516101778f},
-std::array<float,2>{0.717148006f, 0.17604661f},
-std::array<float,2>{0.349738836f, 0.894125283f},
-std::array<float,2>{0.214922845f, 0.469190419f},
-std::array<float,2>{0.814700007f, 0.628491521f},
-std::array<float,2>{0.955857635f, 0.263698786f},
-std::array<float,2>{0.115182698f, 0.567021787f},
-std::array<float,2>{0.446866691f, 0.0912669674f},
-std::array<float,2>{0.550061285f, 0.827633202f},
-std::array<float,2>{0.60069257f, 0.294751823f},
-std::array<float,2>{0.38945511f, 0.613331795f},
-std::array<float,2>{0.0532787368f, 0.102247298f},
-std::array<float,2>{0.919622362f, 0.848497093f},
-std::array<float,2>{0.80705595f, 0.142359048f},
-std::array<float,2>{0.161586344f, 0.919924259f},
-std::array<float,2>{0.276999921f, 0.462733269f},
-std::array<float,2>{0.679875672f, 0.667705894f},
-std::array<float,2>{0.698912024f, 0.0612724684f},
-std::array<float,2>{0.359547317f, 0.755800188f},
-std::array<float,2>{0.202691823f, 0.358985096f},
-std::array<float,2>{0.831257999f, 0.540420115f},
-std::array<float,2>{0.952718198f, 0.408911318f},
-std::array<float,2>{0.109213457f, 0.719839513f},
-std::array<float,2>{0.454027385f, 0.211213619f},
-std::array<float,2>{0.533989966f, 0.950145721f},
-std::array<float,2>{0.639289796f, 0.474754095f},
-std::array<float,2>{0.299243391f, 0.632021666f},
-std::array<float,2>{0.141262949f, 0.172747642f},
-std::array<float,2>{0.762493789f, 0.89766264f},
-std::array<float,2>{0.896949112f, 0.0875588879f},
-std::array<float,2>{0.0235573724f, 0.82281971f},
-std::array<float,2>{0.429344505f, 0.259682804f},
-std::array<float,2>{0.593553364f, 0.563797712f},
-std::array<float,2>{0.519231915f, 0.22516644f},
-std::array<float,2>{0.477208585f, 0.98957026f},
-std::array<float,2>{0.0865141451f, 0.375912845f},
-std::array<float,2>{0.991246939f, 0.709849358f},
-std::array<float,2>{0.859973669f, 0.32579881f},
-std::array<float,2>{0.223963439f, 0.522168398f},
-std::array<float,2>{0.316040218f, 0.0146016181f},
-std::array<float,2>{0.734971106f, 0.802336216f},
-std::array<float,2>{0.730998635f, 0.371494532f},
-std::array<float,2>{0.34087345f, 0.561260343f},
-std::array<float,2>{0.248490408f, 0.044081524f},
-std::array<float,2>{0.854626119f, 0.769261539f},
-std::array<float,2>{0.969435692f, 0.19112213f},
-std::array<float,2>{0.071746245f, 0.954689145f},
-std::array<float,2>{0.494340628f, 0.423293263f},
-std::array<float,2>{0.50979501f, 0.745125711f},
-std::array<float,2>{0.566618264f, 0.124010772f},
-std::array<float,2>{0.409729183f, 0.859491587f},
-std::array<float,2>{0.0124941599f, 0.302535534f},
-std::array<float,2>{0.884886324f, 0.60458225f},
-std::array<float,2>{0.776495516f, 0.441625297f},
-std::array<float,2>{0.128430307f, 0.684416234f},
-std::array<float,2>{0.285026431f, 0.1256973f},
-std::array<float,2>{0.644374788f, 0.923455954f},
-std::array<float,2>{0.560685098f, 0.401952714f},
-std::array<float,2>{0.438189507f, 0.695556104f},
-std::array<float,2>{0.120491713f, 0.240937918f},
-std::array<float,2>{0.963443935f, 0.98233664f},
-std::array<float,2>{0.824779153f, 0.0306895375f},
-std::array<float,2>{0.203292355f, 0.787853241f},
-std::array<float,2>{0.35804671f, 0.331241906f},
-std::array<float,2>{0.709709525f, 0.501222432f},
-std::array<float,2>{0.671260893f, 0.170456156f},
-std::array<float,2>{0.252455592f, 0.883677423f},
-std::array<float,2>{0.182253748f, 0.490019292f},
-std::array<float,2>{0.787636697f, 0.645192564f},
-std::array<float,2>{0.935118616f, 0.279364586f},
-std::array<float,2>{0.0316213407f, 0.58915627f},
-std::array<float,2>{0.402362347f, 0.0646910146f},
-std::array<float,2>{0.621278882f, 0.837360084f},
-std::array<float,2>{0.505826294f, 0.343668193f},
-std::array<float,2>{0.485101104f, 0.511099935f},
-std::array<float,2>{0.0644173771f, 0.0196024422f},
-std::array<float,2>{0.980959833f, 0.78961736f},
-std::array<float,2>{0.846311033f, 0.242563039f},
-std::array<float,2>{0.241664678f, 0.976446688f},
-std::array<float,2>{0.328401327f, 0.394073427f},
-std::array<float,2>{0.721874535f, 0.689472437f},
-std::array<float,2>{0.655067325f, 0.0745714754f},
-std::array<float,2>{0.294560462f, 0.833974421f},
-std::array<float,2>{0.13341631f, 0.271318287f},
-std::array<float,2>{0.76978153f, 0.583785713f},
-std::array<float,2>{0.881111443f, 0.493715048f},
-std::array<float,2>{0.00602181023f, 0.654710054f},
-std::array<float,2>{0.414168447f, 0.160990924f},
-std::array<float,2>{0.572355747f, 0.879394293f},
-std::array<float,2>{0.711051762f, 0.434148431f},
-std::array<float,2>{0.344562024f, 0.741831303f},
-std::array<float,2>{0.212919995f, 0.198134765f},
-std::array<float,2>{0.817402959f, 0.967984498f},
-std::array<float,2>{0.960870206f, 0.0377453007f},
-std::array<float,2>{0.11280378f, 0.780714273f},
-std::array<float,2>{0.453041077f, 0.365709901f},
-std::array<float,2>{0.553623557f, 0.549027026f},
-std::array<float,2>{0.610364497f, 0.136859328f},
-std::array<float,2>{0.391687304f, 0.932706594f},
-std::array<float,2>{0.0448499508f, 0.447985232f},
-std::array<float,2>{0.92200017f, 0.678444982f},
-std::array<float,2>{0.789919257f, 0.309243441f},
-std::array<float,2>{0.177547917f, 0.59708786f},
-std::array<float,2>{0.262967587f, 0.111738883f},
-std::array<float,2>{0.659228265f, 0.871231437f},
-std::array<float,2>{0.672977507f, 0.250753194f},
-std::array<float,2>{0.268233329f, 0.577576637f},
-std::array<float,2>{0.167302653f, 0.0830720887f},
-std::array<float,2>{0.800677955f, 0.815115094f},
-std::array<float,2>{0.907082021f, 0.180889502f},
-std::array<float,2>{0.0596744753f, 0.904199541f},
-std::array<float,2>{0.37809518f, 0.481361151f},
-std::array<float,2>{0.603966475f, 0.637693703f},
-std::array<float,2>{0.539586961f, 0.00711583067f},
-std::array<float,2>{0.46565643f, 0.80695945f},
-std::array<float,2>{0.0961817428f, 0.320032537f},
-std::array<float,2>{0.939736307f, 0.525924146f},
-std::array<float,2>{0.836282134f, 0.385117918f},
-std::array<float,2>{0.193919256f, 0.713897943f},
-std::array<float,2>{0.37451604f, 0.231244728f},
-std::array<float,2>{0.694617748f, 0.996438563f},
-std::array<float,2>{0.583911121f, 0.455748945f},
-std::array<float,2>{0.431785196f, 0.661885083f},
-std::array<float,2>{0.0219919514f, 0.151665673f},
-std::array<float,2>{0.905842006f, 0.91056633f},
-std::array<float,2>{0.755557895f, 0.0981067121f},
-std::array<float,2>{0.153967738f, 0.853196442f},
-std::array<float,2>{0.308030427f, 0.281946033f},
-std::array<float,2>{0.625887871f, 0.619521856f},
-std::array<float,2>{0.747031987f, 0.203634217f},
-std::array<float,2>{0.325944901f, 0.944558263f},
-std::array<float,2>{0.228616089f, 0.419750124f},
-std::array<float,2>{0.867700934f, 0.73164928f},
-std::array<float,2>{0.993239105f, 0.350209355f},
-std::array<float,2>{0.080880858f, 0.532215416f},
-std::array<float,2>{0.475663185f, 0.0537011512f},
-std::array<float,2>{0.527308524f, 0.761769712f},
-std::array<float,2>{0.577339888f, 0.354036033f},
-std::array<float,2>{0.420381755f, 0.545372903f},
-std::array<float,2>{0.00211403565f, 0.0564468279f},
-std::array<float,2>{0.877136946f, 0.75005579f},
-std::array<float,2>{0.768927395f, 0.215549871f},
-std::array<float,2>{0.140519813f, 0.946322143f},
-std::array<float,2>{0.29284656f, 0.41109246f},
-std::array<float,2>{0.649187088f, 0.724123716f},
-std::array<float,2>{0.723463953f, 0.107313439f},
-std::array<float,2>{0.335861355f, 0.844602525f},
-std::array<float,2>{0.237561524f, 0.290177047f},
-std::array<float,2>{0.849495888f, 0.609654844f},
-std::array<float,2>{0.978191674f, 0.467948258f},
-std::array<float,2>{0.0689676702f, 0.669745326f},
-std::array<float,2>{0.488741159f, 0.145656705f},
-std::array<float,2>{0.501980543f, 0.915133893f},
-std::array<float,2>{0.663637757f, 0.379608929f},
-std::array<float,2>{0.260654211f, 0.704486966f},
-std::array<float,2>{0.175016358f, 0.219118193f},
-std::array<float,2>{0.793241501f, 0.984866738f},
-std::array<float,2>{0.926739514f, 0.00899466593f},
-std::array<float,2>{0.0404587984f, 0.797900856f},
-std::array<float,2>{0.394691348f, 0.320999056f},
-std::array<float,2>{0.613416791f, 0.519393265f},
-std::array<float,2>{0.550353467f, 0.1778429f},
-std::array<float,2>{0.446669668f, 0.890883982f},
-std::array<float,2>{0.114416525f, 0.472083181f},
-std::array<float,2>{0.955566049f, 0.625559866f},
-std::array<float,2>{0.815244317f, 0.263119519f},
-std::array<float,2>{0.215480879f, 0.569612086f},
-std::array<float,2>{0.350239336f, 0.0921089351f},
-std::array<float,2>{0.71766156f, 0.82505995f},
-std::array<float,2>{0.689233422f, 0.300032943f},
-std::array<float,2>{0.367653847f, 0.607815444f},
-std::array<float,2>{0.189482391f, 0.119020745f},
-std::array<float,2>{0.841831386f, 0.863527238f},
-std::array<float,2>{0.944229484f, 0.129829705f},
-std::array<float,2>{0.0999033526f, 0.928613782f},
-std::array<float,2>{0.463822186f, 0.439787805f},
-std::array<float,2>{0.545459747f, 0.682893872f},
-std::array<float,2>{0.609172106f, 0.0394507237f},
-std::array<float,2>{0.382518947f, 0.770129204f},
-std::array<float,2>{0.0573130436f, 0.368085295f},
-std::array<float,2>{0.912621617f, 0.558055341f},
-std::array<float,2>{0.801169991f, 0.428751886f},
-std::array<float,2>{0.170141608f, 0.747368038f},
-std::array<float,2>{0.272164017f, 0.195271298f},
-std::array<float,2>{0.676682293f, 0.960879326f},
-std::array<float,2>{0.530964673f, 0.487739861f},
-std::array<float,2>{0.46948725f, 0.644228339f},
-std::array<float,2>{0.0828992054f, 0.166220367f},
-std::array<float,2>{0.996120453f, 0.889215648f},
-std::array<float,2>{0.871744275f, 0.0691576451f},
-std::array<float,2>{0.231680125f, 0.84338057f},
-std::array<float,2>{0.321218699f, 0.275425434f},
-std::array<float,2>{0.74557215f, 0.591985762f},
-std::array<float,2>{0.629355371f, 0.235994801f},
-std::array<float,2>{0.311970443f, 0.976801693f},
-std::array<float,2>{0.149489224f, 0.405335665f},
-std::array<float,2>{0.753180504f, 0.700304925f},
-std::array<float,2>{0.900409877f, 0.334525257f},
-std::array<float,2>{0.0179464091f, 0.504297435f},
-std::array<float,2>{0.436559439f, 0.0261813663f},
-std::array<float,2>{0.578478336f, 0.781859577f},
-std::array<float,2>{0.538552523f, 0.268680394f},
-std::array<float,2>{0.458281666f, 0.579708338f},
-std::array<float,2>{0.105095759f, 0.0714531541f},
-std::array<float,2>{0.9460603f, 0.829996586f},
-std::array<float,2>{0.833431721f, 0.156778961f},
-std::array<float,2>{0.196381897f, 0.87573123f},
-std::array<float,2>{0.365665287f, 0.499187797f},
-std::array<float,2>{0.701844573f, 0.652222097f},
-std::array<float,2>{0.683854043f, 0.0159079358f},
-std::array<float,2>{0.280819923f, 0.793200672f},
-std::array<float,2>{0.157291293f, 0.338196456f},
-std::array<float,2>{0.808736444f, 0.512851894f},
-std::array<float,2>{0.91642338f, 0.398298621f},
-std::array<float,2>{0.0504490174f, 0.694834054f},
-std::array<float,2>{0.386443108f, 0.249764547f},
-std::array<float,2>{0.595834136f, 0.969601512f},
-std::array<float,2>{0.741915286f, 0.449804962f},
-std::array<float,2>{0.318768919f, 0.673946977f},
-std::array<float,2>{0.220226884f, 0.13617371f},
-std::array<float,2>{0.866349041f, 0.935990512f},
-std::array<float,2>{0.986750841f, 0.115302697f},
-std::array<float,2>{0.0936342627f, 0.870971322f},
-std::array<float,2>{0.482047409f, 0.308402866f},
-std::array<float,2>{0.521480262f, 0.597746432f},
-std::array<float,2>{0.589254141f, 0.201375946f},
-std::array<float,2>{0.423576981f, 0.962458134f},
-std::array<float,2>{0.0274202544f, 0.430442095f},
-std::array<float,2>{0.89109838f, 0.736248493f},
-std::array<float,2>{0.759747386f, 0.362154663f},
-std::array<float,2>{0.14509052f, 0.553654909f},
-std::array<float,2>{0.303904563f, 0.034542907f},
-std::array<float,2>{0.632870674f, 0.774600506f},
-std::array<float,2>{0.64676559f, 0.313622415f},
-std::array<float,2>{0.287511587f, 0.528228819f},
-std::array<float,2>{0.129296407f, 0.00185239699f},
-std::array<float,2>{0.779913902f, 0.810511112f},
-std::array<float,2>{0.889990568f, 0.227428481f},
-std::array<float,2>{0.0111748166f, 0.995999753f},
-std::array<float,2>{0.411161512f, 0.387707055f},
-std::array<float,2>{0.563955963f, 0.715070784f},
-std::array<float,2>{0.514968693f, 0.0783219337f},
-std::array<float,2>{0.499635756f, 0.820019245f},
-std::array<float,2>{0.0765114054f, 0.254076183f},
-std::array<float,2>{0.975906432f, 0.571030915f},
-std::array<float,2>{0.856639266f, 0.479075402f},
-std::array<float,2>{0.244843721f, 0.633303285f},
-std::array<float,2>{0.337588936f, 0.186292842f},
-std::array<float,2>{0.727699459f, 0.899829686f},
-std::array<float,2>{0.619460702f, 0.416946381f},
-std::array<float,2>{0.401768327f, 0.729345918f},
-std::array<float,2>{0.0360159054f, 0.208134308f},
-std::array<float,2>{0.931401312f, 0.941026211f},
-std::array<float,2>{0.78250283f, 0.0492291339f},
-std::array<float,2>{0.184137359f, 0.758087218f},
-std::array<float,2>{0.254924476f, 0.346699119f},
-std::array<float,2>{0.664533377f, 0.535748005f},
-std::array<float,2>{0.704451323f, 0.155708089f},
-std::array<float,2>{0.353853017f, 0.910010874f},
-std::array<float,2>{0.209158763f, 0.457510024f},
-std::array<float,2>{0.82157886f, 0.659562826f},
-std::array<float,2>{0.965875685f, 0.286879301f},
-std::array<float,2>{0.122747481f, 0.62134999f},
-std::array<float,2>{0.443023026f, 0.0942183509f},
-std::array<float,2>{0.555944204f, 0.858953059f},
-std::array<float,2>{0.590549111f, 0.260396838f},
-std::array<float,2>{0.427507907f, 0.56455785f},
-std::array<float,2>{0.0264415164f, 0.0895051062f},
-std::array<float,2>{0.895861089f, 0.821504951f},
-std::array<float,2>{0.7639575f, 0.173951998f},
-std::array<float,2>{0.144020408f, 0.89567399f},
-std::array<float,2>{0.298152834f, 0.473362774f},
-std::array<float,2>{0.638125062f, 0.630169809f},
-std::array<float,2>{0.737631381f, 0.0133458748f},
-std::array<float,2>{0.314240545f, 0.803041637f},
-std::array<float,2>{0.224844784f, 0.327062547f},
-std::array<float,2>{0.861439466f, 0.521152437f},
-std::array<float,2>{0.989072025f, 0.377012968f},
-std::array<float,2>{0.0895482451f, 0.708749175f},
-std::array<float,2>{0.479821056f, 0.224604174f},
-std::array<float,2>{0.516894042f, 0.991340816f},
-std::array<float,2>{0.681759238f, 0.464383304f},
-std::array<float,2>{0.275277287f, 0.665784955f},
-std::array<float,2>{0.162724584f, 0.143102229f},
-std::array<float,2>{0.806189477f, 0.918117821f},
-std::array<float,2>{0.921629012f, 0.10414049f},
-std::array<float,2>{0.0509030484f, 0.850321531f},
-std::array<float,2>{0.388661355f, 0.295889616f},
-std::array<float,2>{0.598274291f, 0.61670804f},
-std::array<float,2>{0.53253901f, 0.213816479f},
-std::array<float,2>{0.456124246f, 0.951416671f},
-std::array<float,2>{0.106105626f, 0.407437503f},
-std::array<float,2>{0.951162279f, 0.721315801f},
-std::array<float,2>{0.828818381f, 0.356272072f},
-std::array<float,2>{0.200830981f, 0.542830348f},
-std::array<float,2>{0.36249426f, 0.0599599183f},
-std::array<float,2>{0.695442557f, 0.755964577f},
-std::array<float,2>{0.70872879f, 0.32833159f},
-std::array<float,2>{0.357341439f, 0.502635717f},
-std::array<float,2>{0.206237942f, 0.029002808f},
-std::array<float,2>{0.827323556f, 0.786188662f},
-std::array<float,2>{0.961743355f, 0.239090517f},
-std::array<float,2>{0.118793488f, 0.983830571f},
-std::array<float,2>{0.43974781f, 0.39996019f},
-std::array<float,2>{0.559510589f, 0.698513448f},
-std::array<float,2>{0.623679817f, 0.0641963556f},
-std::array<float,2>{0.40591684f, 0.837987065f},
-std::array<float,2>{0.0339045338f, 0.278120309f},
-std::array<float,2>{0.936294198f, 0.58704108f},
-std::array<float,2>{0.786081195f, 0.491081983f},
-std::array<float,2>{0.180423141f, 0.648074508f},
-std::array<float,2>{0.251566827f, 0.168985903f},
-std::array<float,2>{0.669735014f, 0.885491312f},
-std::array<float,2>{0.508075893f, 0.425214052f},
-std::array<float,2>{0.494085193f, 0.743031442f},
-std::array<float,2>{0.0741553903f, 0.188180104f},
-std::array<float,2>{0.972237587f, 0.956796348f},
-std::array<float,2>{0.853220999f, 0.0465396233f},
-std::array<float,2>{0.247829661f, 0.767438233f},
-std::array<float,2>{0.34303838f, 0.37440902f},
-std::array<float,2>{0.732731462f, 0.559830368f},
-std::array<float,2>{0.64148581f, 0.127527758f},
-std::array<float,2>{0.281784475f, 0.924482584f},
-std::array<float,2>{0.126706928f, 0.444947451f},
-std::array<float,2>{0.775220394f, 0.686130524f},
-std::array<float,2>{0.884047031f, 0.30323422f},
-std::array<float,2>{0.013976818f, 0.603365719f},
-std::array<float,2>{0.407741636f, 0.121963874f},
-std::array<float,2>{0.570245445f, 0.86185652f},
-std::array<float,2>{0.551015675f, 0.363841414f},
-std::array<float,2>{0.451139599f, 0.54745084f},
-std::array<float,2>{0.109873332f, 0.0358129293f},
-std::array<float,2>{0.958698452f, 0.779098272f},
-std::array<float,2>{0.819819748f, 0.196329221f},
-std::array<float,2>{0.211532503f, 0.966391742f},
-std::array<float,2>{0.347059935f, 0.437421024f},
-std::array<float,2>{0.713919222f, 0.738628745f},
-std::array<float,2>{0.656500101f, 0.110378809f},
-std::array<float,2>{0.264341563f, 0.874370039f},
-std::array<float,2>{0.177798599f, 0.312493086f},
-std::array<float,2>{0.79196012f, 0.594665349f},
-std::array<float,2>{0.9253546f, 0.445874274f},
-std::array<float,2>{0.0460777543f, 0.677641332f},
-std::array<float,2>{0.393995583f, 0.140509129f},
-std::array<float,2>{0.611605883f, 0.930413783f},
-std::array<float,2>{0.719935894f, 0.391178548f},
-std::array<float,2>{0.330602705f, 0.688782156f},
-std::array<float,2>{0.239373192f, 0.244532481f},
-std::array<float,2>{0.845007777f, 0.974371493f},
-std::array<float,2>{0.983323872f, 0.0219090357f},
-std::array<float,2>{0.0660784617f, 0.792005002f},
-std::array<float,2>{0.487252653f, 0.341287464f},
-std::array<float,2>{0.506614327f, 0.509607553f},
-std::array<float,2>{0.57156688f, 0.163060009f},
-std::array<float,2>{0.416598976f, 0.881700993f},
-std::array<float,2>{0.00539289648f, 0.494564146f},
-std::array<float,2>{0.879371643f, 0.654093444f},
-std::array<float,2>{0.772449732f, 0.272759765f},
-std::array<float,2>{0.134949625f, 0.584289014f},
-std::array<float,2>{0.294963956f, 0.0766861439f},
-std::array<float,2>{0.654177725f, 0.835323095f},
-std::array<float,2>{0.62746042f, 0.283571303f},
-std::array<float,2>{0.305011362f, 0.619006097f},
-std::array<float,2>{0.155195326f, 0.100851074f},
-std::array<float,2>{0.756480455f, 0.854147792f},
-std::array<float,2>{0.903774858f, 0.150032297f},
-std::array<float,2>{0.0210592542f, 0.91345793f},
-std::array<float,2>{0.431393147f, 0.455028296f},
-std::array<float,2>{0.585743785f, 0.663406789f},
-std::array<float,2>{0.525330484f, 0.0512488373f},
-std::array<float,2>{0.473867506f, 0.764277458f},
-std::array<float,2>{0.0790233389f, 0.347807646f},
-std::array<float,2>{0.994491577f, 0.534189284f},
-std::array<float,2>{0.869217098f, 0.421549082f},
-std::array<float,2>{0.227321625f, 0.733857036f},
-std::array<float,2>{0.327518761f, 0.206643179f},
-std::array<float,2>{0.748859286f, 0.942856908f},
-std::array<float,2>{0.60184139f, 0.483162344f},
-std::array<float,2>{0.375476092f, 0.638908923f},
-std::array<float,2>{0.0609782897f, 0.181809291f},
-std::array<float,2>{0.909723401f, 0.904301882f},
-std::array<float,2>{0.797039151f, 0.08464811f},
-std::array<float,2>{0.165150523f, 0.81392616f},
-std::array<float,2>{0.265764594f, 0.253576845f},
-std::array<float,2>{0.674740016f, 0.574531436f},
-std::array<float,2>{0.692371428f, 0.233462021f},
-std::array<float,2>{0.371740848f, 0.999753892f},
-std::array<float,2>{0.19293873f, 0.38318032f},
-std::array<float,2>{0.839328587f, 0.711190283f},
-std::array<float,2>{0.938735843f, 0.316791654f},
-std::array<float,2>{0.095409669f, 0.524058759f},
-std::array<float,2>{0.467677921f, 0.00548914168f},
-std::array<float,2>{0.542514205f, 0.80556941f},
-std::array<float,2>{0.616880953f, 0.323461384f},
-std::array<float,2>{0.396562219f, 0.516168892f},
-std::array<float,2>{0.0428835079f, 0.0104074534f},
-std::array<float,2>{0.929593027f, 0.800768375f},
-std::array<float,2>{0.796538651f, 0.221340969f},
-std::array<float,2>{0.172652543f, 0.987365305f},
-std::array<float,2>{0.258311898f, 0.381818205f},
-std::array<float,2>{0.661090612f, 0.705200016f},
-std::array<float,2>{0.715201378f, 0.0915566608f},
-std::array<float,2>{0.348730743f, 0.827928782f},
-std::array<float,2>{0.218067273f, 0.264486462f},
-std::array<float,2>{0.813384116f, 0.566561639f},
-std::array<float,2>{0.953249156f, 0.469421983f},
-std::array<float,2>{0.116835035f, 0.628283381f},
-std::array<float,2>{0.448477834f, 0.176500022f},
-std::array<float,2>{0.547221184f, 0.89399153f},
-std::array<float,2>{0.652132094f, 0.412671357f},
-std::array<float,2>{0.289517462f, 0.726187527f},
-std::array<float,2>{0.136872023f, 0.218558148f},
-std::array<float,2>{0.766228616f, 0.9480775f},
-std::array<float,2>{0.876565099f, 0.0574007221f},
-std::array<float,2>{0.000405115919f, 0.752004504f},
-std::array<float,2>{0.418878376f, 0.352122843f},
-std::array<float,2>{0.575491965f, 0.544917166f},
-std::array<float,2>{0.500340462f, 0.147976369f},
-std::array<float,2>{0.491466403f, 0.9171803f},
-std::array<float,2>{0.0668400601f, 0.465776712f},
-std::array<float,2>{0.980351925f, 0.671713889f},
-std::array<float,2>{0.849643052f, 0.292563379f},
-std::array<float,2>{0.236064509f, 0.612576246f},
-std::array<float,2>{0.333293021f, 0.108403966f},
-std::array<float,2>{0.725086987f, 0.847057045f},
-std::array<float,2>{0.742427707f, 0.273961395f},
-std::array<float,2>{0.322797239f, 0.590738595f},
-std::array<float,2>{0.234006256f, 0.0671974942f},
-std::array<float,2>{0.873923004f, 0.840575159f},
-std::array<float,2>{0.998293161f, 0.165803447f},
-std::array<float,2>{0.0840492472f, 0.886990726f},
-std::array<float,2>{0.47174862f, 0.485937506f},
-std::array<float,2>{0.528599203f, 0.641016722f},
-std::array<float,2>{0.581199884f, 0.0242723022f},
-std::array<float,2>{0.435438395f, 0.783284783f},
-std::array<float,2>{0.0156399347f, 0.332779706f},
-std::array<float,2>{0.899324834f, 0.506037176f},
-std::array<float,2>{0.751350582f, 0.402536362f},
-std::array<float,2>{0.150670364f, 0.701392412f},
-std::array<float,2>{0.309911489f, 0.238265142f},
-std::array<float,2>{0.631713212f, 0.978681684f},
-std::array<float,2>{0.543327212f, 0.437713295f},
-std::array<float,2>{0.460971355f, 0.680982471f},
-std::array<float,2>{0.0990828946f, 0.131117746f},
-std::array<float,2>{0.941904902f, 0.926014423f},
-std::array<float,2>{0.841567397f, 0.120253175f},
-std::array<float,2>{0.187817886f, 0.865961134f},
-std::array<float,2>{0.370145351f, 0.298525333f},
-std::array<float,2>{0.690642655f, 0.60623914f},
-std::array<float,2>{0.678147674f, 0.19256936f},
-std::array<float,2>{0.270347923f, 0.958870888f},
-std::array<float,2>{0.168669626f, 0.426356167f},
-std::array<float,2>{0.804177046f, 0.748343885f},
-std::array<float,2>{0.91121608f, 0.370906293f},
-std::array<float,2>{0.0559378341f, 0.556551874f},
-std::array<float,2>{0.380576432f, 0.0415393412f},
-std::array<float,2>{0.606719196f, 0.772107244f},
-std::array<float,2>{0.521609247f, 0.305855036f},
-std::array<float,2>{0.484300584f, 0.600121796f},
-std::array<float,2>{0.0908727869f, 0.114254788f},
-std::array<float,2>{0.986072898f, 0.868869662f},
-std::array<float,2>{0.865222692f, 0.133735493f},
-std::array<float,2>{0.221393451f, 0.934988737f},
-std::array<float,2>{0.317933649f, 0.452401757f},
-std::array<float,2>{0.738473058f, 0.672372043f},
-std::array<float,2>{0.636545122f, 0.031915199f},
-std::array<float,2>{0.301486105f, 0.775909722f},
-std::array<float,2>{0.147181839f, 0.359622777f},
-std::array<float,2>{0.761620581f, 0.551493049f},
-std::array<float,2>{0.893460751f, 0.433344901f},
-std::array<float,2>{0.0307799373f, 0.73649615f},
-std::array<float,2>{0.424251974f, 0.200068802f},
-std::array<float,2>{0.585986078f, 0.964046121f},
-std::array<float,2>{0.699783385f, 0.49741134f},
-std::array<float,2>{0.364040852f, 0.648814082f},
-std::array<float,2>{0.198945537f, 0.159903139f},
-std::array<float,2>{0.834314883f, 0.877814233f},
-std::array<float,2>{0.948656261f, 0.0732591152f},
-std::array<float,2>{0.10190282f, 0.831822991f},
-std::array<float,2>{0.459668607f, 0.26616177f},
-std::array<float,2>{0.535984993f, 0.581412613f},
-std::array<float,2>{0.595534444f, 0.247924477f},
-std::array<float,2>{0.384139776f, 0.971804142f},
-std::array<float,2>{0.0473913886f, 0.394787967f},
-std::array<float,2>{0.915686548f, 0.691408157f},
-std::array<float,2>{0.810847342f, 0.336345524f},
-std::array<float,2>{0.160076663f, 0.514635503f},
-std::array<float,2>{0.278344274f, 0.0178898312f},
-std::array<float,2>{0.685869455f, 0.795224845f},
-std::array<float,2>{0.667205393f, 0.345405012f},
-std::array<float,2>{0.256144017f, 0.538815379f},
-std::array<float,2>{0.187478617f, 0.0471121632f},
-std::array<float,2>{0.783896506f, 0.760789216f},
-std::array<float,2>{0.932767749f, 0.209702283f},
-std::array<float,2>{0.0379353985f, 0.938867509f},
-std::array<float,2>{0.399277896f, 0.414869934f},
-std::array<float,2>{0.618207991f, 0.727580845f},
-std::array<float,2>{0.557253599f, 0.0969158486f},
-std::array<float,2>{0.443532437f, 0.855877817f},
-std::array<float,2>{0.124087296f, 0.288264751f},
-std::array<float,2>{0.968342245f, 0.624129236f},
-std::array<float,2>{0.82358706f, 0.460385203f},
-std::array<float,2>{0.20742029f, 0.657098591f},
-std::array<float,2>{0.351881713f, 0.152642563f},
-std::array<float,2>{0.705826581f, 0.907517731f},
-std::array<float,2>{0.565044105f, 0.38902697f},
-std::array<float,2>{0.412152857f, 0.717466652f},
-std::array<float,2>{0.00944659486f, 0.229590639f},
-std::array<float,2>{0.887550116f, 0.993977427f},
-std::array<float,2>{0.778998673f, 0.00212882436f},
-std::array<float,2>{0.131973058f, 0.811012983f},
-std::array<float,2>{0.285775721f, 0.315929651f},
-std::array<float,2>{0.644997716f, 0.531211495f},
-std::array<float,2>{0.728753746f, 0.185136601f},
-std::array<float,2>{0.339786053f, 0.900877357f},
-std::array<float,2>{0.242272019f, 0.478360295f},
-std::array<float,2>{0.858229578f, 0.635914683f},
-std::array<float,2>{0.974068463f, 0.256227165f},
-std::array<float,2>{0.0750743151f, 0.573925793f},
-std::array<float,2>{0.496503383f, 0.0815923139f},
-std::array<float,2>{0.513130307f, 0.816785932f},
-std::array<float,2>{0.568968177f, 0.3016662f},
-std::array<float,2>{0.406665295f, 0.603800952f},
-std::array<float,2>{0.0153158102f, 0.124689393f},
-std::array<float,2>{0.883303344f, 0.861205101f},
-std::array<float,2>{0.773844659f, 0.126925796f},
-std::array<float,2>{0.125326052f, 0.921920657f},
-std::array<float,2>{0.282400846f, 0.443191379f},
-std::array<float,2>{0.642231882f, 0.685448349f},
-std::array<float,2>{0.733789265f, 0.0433713794f},
-std::array<float,2>{0.342671573f, 0.76794976f},
-std::array<float,2>{0.246096596f, 0.373002648f},
-std::array<float,2>{0.852208257f, 0.561761558f},
-std::array<float,2>{0.970814109f, 0.422691077f},
-std::array<float,2>{0.0731372386f, 0.744719923f},
-std::array<float,2>{0.493162006f, 0.190122142f},
-std::array<float,2>{0.509218812f, 0.953380346f},
-std::array<float,2>{0.668332756f, 0.488918155f},
-std::array<float,2>{0.25072062f, 0.646143854f},
-std::array<float,2>{0.181469202f, 0.171170697f},
-std::array<float,2>{0.786310017f, 0.884538233f},
-std::array<float,2>{0.937080979f, 0.0660045594f},
-std::array<float,2>{0.0344470926f, 0.836491346f},
-std::array<float,2>{0.404427052f, 0.280751228f},
-std::array<float,2>{0.624325097f, 0.588035047f},
-std::array<float,2>{0.56004405f, 0.241649702f},
-std::array<float,2>{0.441107452f, 0.98120743f},
-std::array<float,2>{0.117936797f, 0.401299238f},
-std::array<float,2>{0.96218574f, 0.697074115f},
-std::array<float,2>{0.826297522f, 0.330337405f},
-std::array<float,2>{0.205590859f, 0.500131369f},
-std::array<float,2>{0.35596475f, 0.0301580429f},
-std::array<float,2>{0.707387388f, 0.788591623f},
-std::array<float,2>{0.696798742f, 0.357893199f},
-std::array<float,2>{0.361341238f, 0.539122701f},
-std::array<float,2>{0.200175792f, 0.0621984564f},
-std::array<float,2>{0.830066085f, 0.75407511f},
-std::array<float,2>{0.94948256f, 0.212358057f},
-std::array<float,2>{0.107293762f, 0.951073766f},
-std::array<float,2>{0.455896318f, 0.409924686f},
-std::array<float,2>{0.531604111f, 0.719074845f},
-std::array<float,2>{0.598799765f, 0.103214681f},
-std::array<float,2>{0.387503773f, 0.849493623f},
-std::array<float,2>{0.0525770746f, 0.29339236f},
-std::array<float,2>{0.92007935f, 0.614741087f},
-std::array<float,2>{0.804948747f, 0.461712778f},
-std::array<float,2>{0.163717344f, 0.66652441f},
-std::array<float,2>{0.273771107f, 0.140695095f},
-std::array<float,2>{0.683427453f, 0.92143476f},
-std::array<float,2>{0.51609242f, 0.37612462f},
-std::array<float,2>{0.4793154f, 0.710713446f},
-std::array<float,2>{0.0881738737f, 0.226330057f},
-std::array<float,2>{0.989329755f, 0.988933146f},
-std::array<float,2>{0.86258924f, 0.0146865202f},
-std::array<float,2>{0.225924298f, 0.801394999f},
-std::array<float,2>{0.313434988f, 0.32423535f},
-std::array<float,2>{0.736503124f, 0.522616148f},
-std::array<float,2>{0.636979222f, 0.17293337f},
-std::array<float,2>{0.297503799f, 0.897019804f},
-std::array<float,2>{0.142623708f, 0.475936621f},
-std::array<float,2>{0.765582383f, 0.631343305f},
-std::array<float,2>{0.895318866f, 0.258743018f},
-std::array<float,2>{0.025425788f, 0.563378394f},
-std::array<float,2>{0.426407039f, 0.0866550058f},
-std::array<float,2>{0.591251314f, 0.82420212f},
-std::array<float,2>{0.54112035f, 0.318664938f},
-std::array<float,2>{0.468187988f, 0.526385188f},
-std::array<float,2>{0.093950212f, 0.0060676299f},
-std::array<float,2>{0.937872171f, 0.808116734f},
-std::array<float,2>{0.838154495f, 0.231660977f},
-std::array<float,2>{0.192278147f, 0.997856438f},
-std::array<float,2>{0.372920513f, 0.386476547f},
-std::array<float,2>{0.69241643f, 0.713710845f},
-std::array<float,2>{0.675677001f, 0.0829973221f},
-std::array<float,2>{0.267017901f, 0.816400588f},
-std::array<float,2>{0.164069116f, 0.251918137f},
-std::array<float,2>{0.798164606f, 0.576590657f},
-std::array<float,2>{0.908677697f, 0.482344091f},
-std::array<float,2>{0.0616234019f, 0.637968183f},
-std::array<float,2>{0.376018256f, 0.180463538f},
-std::array<float,2>{0.603387833f, 0.903060734f},
-std::array<float,2>{0.749929428f, 0.418267727f},
-std::array<float,2>{0.32687217f, 0.730725586f},
-std::array<float,2>{0.227589786f, 0.20502077f},
-std::array<float,2>{0.870164573f, 0.944152176f},
-std::array<float,2>{0.995742261f, 0.0545353219f},
-std::array<float,2>{0.0797505677f, 0.762877166f},
-std::array<float,2>{0.47347191f, 0.351559013f},
-std::array<float,2>{0.523772836f, 0.532443345f},
-std::array<float,2>{0.584496677f, 0.150632963f},
-std::array<float,2>{0.429856539f, 0.911846399f},
-std::array<float,2>{0.0202413723f, 0.456531197f},
-std::array<float,2>{0.902951896f, 0.660588741f},
-std::array<float,2>{0.75692296f, 0.282464445f},
-std::array<float,2>{0.156237423f, 0.62041074f},
-std::array<float,2>{0.305830121f, 0.0994420871f},
-std::array<float,2>{0.628611863f, 0.852071345f},
-std::array<float,2>{0.653300107f, 0.269666374f},
-std::array<float,2>{0.296475321f, 0.582272232f},
-std::array<float,2>{0.135978699f, 0.075800471f},
-std::array<float,2>{0.772720158f, 0.83228904f},
-std::array<float,2>{0.880064309f, 0.161364511f},
-std::array<float,2>{0.00474537397f, 0.880620897f},
-std::array<float,2>{0.417907596f, 0.492622882f},
-std::array<float,2>{0.570785999f, 0.655357718f},
-std::array<float,2>{0.507012367f, 0.0209484771f},
-std::array<float,2>{0.487717927f, 0.79034096f},
-std::array<float,2>{0.0650028661f, 0.342609853f},
-std::array<float,2>{0.98386538f, 0.509969652f},
-std::array<float,2>{0.843847215f, 0.393312424f},
-std::array<float,2>{0.239161566f, 0.690612674f},
-std::array<float,2>{0.331899643f, 0.243189514f},
-std::array<float,2>{0.719311893f, 0.974849522f},
-std::array<float,2>{0.612737119f, 0.449173927f},
-std::array<float,2>{0.39322716f, 0.678895533f},
-std::array<float,2>{0.0454706959f, 0.138144523f},
-std::array<float,2>{0.923994005f, 0.931720078f},
-std::array<float,2>{0.792212307f, 0.112509444f},
-std::array<float,2>{0.179341108f, 0.872539878f},
-std::array<float,2>{0.265114069f, 0.30960384f},
-std::array<float,2>{0.657274187f, 0.59575808f},
-std::array<float,2>{0.713063836f, 0.198769554f},
-std::array<float,2>{0.346655667f, 0.967341244f},
-std::array<float,2>{0.212054417f, 0.435509175f},
-std::array<float,2>{0.818906486f, 0.740434825f},
-std::array<float,2>{0.957429469f, 0.367005855f},
-std::array<float,2>{0.11121729f, 0.550343573f},
-std::array<float,2>{0.450156242f, 0.038509272f},
-std::array<float,2>{0.552086055f, 0.779338598f},
-std::array<float,2>{0.605742276f, 0.369054854f},
-std::array<float,2>{0.379158258f, 0.557056606f},
-std::array<float,2>{0.0553646982f, 0.04056466f},
-std::array<float,2>{0.910263121f, 0.770780802f},
-std::array<float,2>{0.803293943f, 0.193957746f},
-std::array<float,2>{0.169393703f, 0.95920527f},
-std::array<float,2>{0.271474212f, 0.428143024f},
-std::array<float,2>{0.679190159f, 0.74698323f},
-std::array<float,2>{0.689742506f, 0.11765036f},
-std::array<float,2>{0.369943351f, 0.864618957f},
-std::array<float,2>{0.189194441f, 0.299283206f},
-std::array<float,2>{0.840231121f, 0.609110296f},
-std::array<float,2>{0.943323553f, 0.440933734f},
-std::array<float,2>{0.0985822901f, 0.68205899f},
-std::array<float,2>{0.462043554f, 0.130275786f},
-std::array<float,2>{0.54410404f, 0.92920202f},
-std::array<float,2>{0.631968081f, 0.405004054f},
-std::array<float,2>{0.309111923f, 0.69987607f},
-std::array<float,2>{0.152067065f, 0.235217154f},
-std::array<float,2>{0.750371933f, 0.978320599f},
-std::array<float,2>{0.899856508f, 0.0272338018f},
-std::array<float,2>{0.017087413f, 0.783033133f},
-std::array<float,2>{0.434251666f, 0.33500576f},
-std::array<float,2>{0.581026256f, 0.505442977f},
-std::array<float,2>{0.528003454f, 0.167720005f},
-std::array<float,2>{0.471164644f, 0.890025377f},
-std::array<float,2>{0.0851300135f, 0.487282366f},
-std::array<float,2>{0.999867678f, 0.643051088f},
-std::array<float,2>{0.874444306f, 0.276923239f},
-std::array<float,2>{0.233351007f, 0.593307972f},
-std::array<float,2>{0.323874354f, 0.0701217353f},
-std::array<float,2>{0.743500769f, 0.842276394f},
-std::array<float,2>{0.725789189f, 0.289636731f},
-std::array<float,2>{0.332771301f, 0.611268759f},
-std::array<float,2>{0.234787837f, 0.106226936f},
-std::array<float,2>{0.851455629f, 0.845293581f},
-std::array<float,2>{0.978555918f, 0.145151287f},
-std::array<float,2>{0.0678869262f, 0.914947271f},
-std::array<float,2>{0.490889579f, 0.467606425f},
-std::array<float,2>{0.501136124f, 0.668937325f},
-std::array<float,2>{0.575065672f, 0.0550356992f},
-std::array<float,2>{0.419467002f, 0.751927435f},
-std::array<float,2>{0.0019003232f, 0.354496628f},
-std::array<float,2>{0.875653446f, 0.546597004f},
-std::array<float,2>{0.767171025f, 0.411214292f},
-std::array<float,2>{0.138262734f, 0.722668648f},
-std::array<float,2>{0.290461093f, 0.216413379f},
-std::array<float,2>{0.651235402f, 0.945453823f},
-std::array<float,2>{0.548277915f, 0.471612066f},
-std::array<float,2>{0.447991163f, 0.626272023f},
-std::array<float,2>{0.115857534f, 0.179103732f},
-std::array<float,2>{0.955062449f, 0.89250654f},
-std::array<float,2>{0.813711882f, 0.092833437f},
-std::array<float,2>{0.217134491f, 0.825505376f},
-std::array<float,2>{0.347792238f, 0.261839449f},
-std::array<float,2>{0.715990305f, 0.569188774f},
-std::array<float,2>{0.662011147f, 0.220099464f},
-std::array<float,2>{0.25909394f, 0.986166179f},
-std::array<float,2>{0.17338571f, 0.380272806f},
-std::array<float,2>{0.795672178f, 0.703934789f},
-std::array<float,2>{0.928289354f, 0.321566373f},
-std::array<float,2>{0.0413767286f, 0.518129587f},
-std::array<float,2>{0.398321182f, 0.00843791477f},
-std::array<float,2>{0.6158216f, 0.797706783f},
-std::array<float,2>{0.512153447f, 0.255021214f},
-std::array<float,2>{0.497651458f, 0.571433008f},
-std::array<float,2>{0.0754295811f, 0.0799949318f},
-std::array<float,2>{0.973199189f, 0.818644166f},
-std::array<float,2>{0.858925462f, 0.186991379f},
-std::array<float,2>{0.24344632f, 0.899140775f},
-std::array<float,2>{0.338700563f, 0.479916006f},
-std::array<float,2>{0.730427682f, 0.633828878f},
-std::array<float,2>{0.645995677f, 0.000332333526f},
-std::array<float,2>{0.286949843f, 0.809561193f},
-std::array<float,2>{0.131600425f, 0.312571645f},
-std::array<float,2>{0.778314531f, 0.52890861f},
-std::array<float,2>{0.888479054f, 0.387408465f},
-std::array<float,2>{0.00817734748f, 0.716593802f},
-std::array<float,2>{0.413118422f, 0.228039578f},
-std::array<float,2>{0.565918565f, 0.99422884f},
-std::array<float,2>{0.70609653f, 0.458421618f},
-std::array<float,2>{0.353357196f, 0.658937156f},
-std::array<float,2>{0.208362415f, 0.154940069f},
-std::array<float,2>{0.822802722f, 0.90857482f},
-std::array<float,2>{0.966994524f, 0.094924055f},
-std::array<float,2>{0.123992257f, 0.857658982f},
-std::array<float,2>{0.444850981f, 0.285796613f},
-std::array<float,2>{0.557647645f, 0.622124374f},
-std::array<float,2>{0.617299616f, 0.207265928f},
-std::array<float,2>{0.400083005f, 0.939784586f},
-std::array<float,2>{0.0384127274f, 0.417400867f},
-std::array<float,2>{0.93188262f, 0.730040431f},
-std::array<float,2>{0.784397781f, 0.346145391f},
-std::array<float,2>{0.186366439f, 0.537105978f},
-std::array<float,2>{0.257572144f, 0.0501616895f},
-std::array<float,2>{0.666668117f, 0.759484947f},
-std::array<float,2>{0.687316656f, 0.339052141f},
-std::array<float,2>{0.277781695f, 0.511753857f},
-std::array<float,2>{0.158463165f, 0.0172083825f},
-std::array<float,2>{0.812382221f, 0.794169426f},
-std::array<float,2>{0.914120018f, 0.248633385f},
-std::array<float,2>{0.048456274f, 0.969955504f},
-std::array<float,2>{0.383580059f, 0.396966457f},
-std::array<float,2>{0.594691038f, 0.694058657f},
-std::array<float,2>{0.53680563f, 0.070751816f},
-std::array<float,2>{0.460734576f, 0.828968048f},
-std::array<float,2>{0.102634169f, 0.267790824f},
-std::array<float,2>{0.947935998f, 0.578702152f},
-std::array<float,2>{0.835590124f, 0.498230696f},
-std::array<float,2>{0.197617963f, 0.650728464f},
-std::array<float,2>{0.364421278f, 0.157668114f},
-std::array<float,2>{0.700341582f, 0.876114845f},
-std::array<float,2>{0.587717235f, 0.431008667f},
-std::array<float,2>{0.425077021f, 0.735274494f},
-std::array<float,2>{0.0300664995f, 0.202852264f},
-std::array<float,2>{0.893668056f, 0.961331129f},
-std::array<float,2>{0.760208964f, 0.0336220302f},
-std::array<float,2>{0.147574008f, 0.773573816f},
-std::array<float,2>{0.302346766f, 0.362880766f},
-std::array<float,2>{0.63571775f, 0.554057896f},
-std::array<float,2>{0.739698827f, 0.134821296f},
-std::array<float,2>{0.316467077f, 0.936861157f},
-std::array<float,2>{0.222595543f, 0.451147676f},
-std::array<float,2>{0.863312006f, 0.674912512f},
-std::array<float,2>{0.984460294f, 0.307614923f},
-std::array<float,2>{0.0903967544f, 0.599589765f},
-std::array<float,2>{0.483388454f, 0.116318583f},
-std::array<float,2>{0.522924006f, 0.869520962f},
-std::array<float,2>{0.622686446f, 0.27921015f},
-std::array<float,2>{0.403937459f, 0.586473703f},
-std::array<float,2>{0.0325093828f, 0.0632619336f},
-std::array<float,2>{0.934011042f, 0.839757979f},
-std::array<float,2>{0.788531303f, 0.168370694f},
-std::array<float,2>{0.182849765f, 0.886157274f},
-std::array<float,2>{0.253650099f, 0.491585672f},
-std::array<float,2>{0.670302153f, 0.646888196f},
-std::array<float,2>{0.710226238f, 0.0279658381f},
-std::array<float,2>{0.358839899f, 0.7860111f},
-std::array<float,2>{0.204955131f, 0.329147398f},
-std::array<float,2>{0.82604003f, 0.502973974f},
-std::array<float,2>{0.964162648f, 0.399057657f},
-std::array<float,2>{0.119799092f, 0.697541058f},
-std::array<float,2>{0.438561141f, 0.239953801f},
-std::array<float,2>{0.561930537f, 0.982924521f},
-std::array<float,2>{0.643155813f, 0.444271326f},
-std::array<float,2>{0.284082085f, 0.687491655f},
-std::array<float,2>{0.127300814f, 0.128688529f},
-std::array<float,2>{0.77542305f, 0.92535013f},
-std::array<float,2>{0.886562526f, 0.12241488f},
-std::array<float,2>{0.0131442659f, 0.862433195f},
-std::array<float,2>{0.408533722f, 0.304232746f},
-std::array<float,2>{0.567664564f, 0.601824343f},
-std::array<float,2>{0.511496782f, 0.189227954f},
-std::array<float,2>{0.495358258f, 0.955642045f},
-std::array<float,2>{0.0705999658f, 0.42426154f},
-std::array<float,2>{0.969780624f, 0.744097769f},
-std::array<float,2>{0.853684783f, 0.37325415f},
-std::array<float,2>{0.249118432f, 0.559450209f},
-std::array<float,2>{0.340187997f, 0.0456483066f},
-std::array<float,2>{0.732071936f, 0.766088903f},
-std::array<float,2>{0.735389411f, 0.327599496f},
-std::array<float,2>{0.315185606f, 0.520229578f},
-std::array<float,2>{0.223018765f, 0.0126600647f},
-std::array<float,2>{0.860907018f, 0.804009438f},
-std::array<float,2>{0.991149783f, 0.222912937f},
-std::array<float,2>{0.0869759247f, 0.990891576f},
-std::array<float,2>{0.477715164f, 0.378361255f},
-std::array<float,2>{0.518011987f, 0.707565665f},
-std::array<float,2>{0.59268105f, 0.0884610713f},
-std::array<float,2>{0.428358227f, 0.820397139f},
-std::array<float,2>{0.0248149652f, 0.260956794f},
-std::array<float,2>{0.897812307f, 0.565730333f},
-std::array<float,2>{0.763177812f, 0.474496782f},
-std::array<float,2>{0.142273873f, 0.629408836f},
-std::array<float,2>{0.300455362f, 0.175009146f},
-std::array<float,2>{0.640598476f, 0.895014822f},
-std::array<float,2>{0.53487432f, 0.406910151f},
-std::array<float,2>{0.454186648f, 0.72170192f},
-std::array<float,2>{0.108336322f, 0.21439147f},
-std::array<float,2>{0.952069044f, 0.952708185f},
-std::array<float,2>{0.830596209f, 0.0590387508f},
-std::array<float,2>{0.201577395f, 0.757528603f},
-std::array<float,2>{0.360586107f, 0.357204914f},
-std::array<float,2>{0.698178768f, 0.541228592f},
-std::array<float,2>{0.680738151f, 0.144490764f},
-std::array<float,2>{0.275579244f, 0.919819236f},
-std::array<float,2>{0.160915703f, 0.462955683f},
-std::array<float,2>{0.8079561f, 0.664227664f},
-std::array<float,2>{0.918077826f, 0.296110213f},
-std::array<float,2>{0.0544161201f, 0.615290225f},
-std::array<float,2>{0.39008528f, 0.10477379f},
-std::array<float,2>{0.600355685f, 0.851259589f},
-std::array<float,2>{0.525856435f, 0.349410564f},
-std::array<float,2>{0.474819839f, 0.533766627f},
-std::array<float,2>{0.0814558193f, 0.0519831441f},
-std::array<float,2>{0.993087113f, 0.76546663f},
-std::array<float,2>{0.868606985f, 0.205115438f},
-std::array<float,2>{0.22992067f, 0.942354679f},
-std::array<float,2>{0.32476294f, 0.41999194f},
-std::array<float,2>{0.747513115f, 0.732888877f},
-std::array<float,2>{0.62668258f, 0.0996753871f},
-std::array<float,2>{0.307458997f, 0.854836762f},
-std::array<float,2>{0.15241158f, 0.284583062f},
-std::array<float,2>{0.753927171f, 0.618100822f},
-std::array<float,2>{0.904483795f, 0.453567147f},
-std::array<float,2>{0.0234166402f, 0.662175059f},
-std::array<float,2>{0.432834446f, 0.1484662f},
-std::array<float,2>{0.582455635f, 0.9127931f},
-std::array<float,2>{0.693656147f, 0.384043366f},
-std::array<float,2>{0.373320043f, 0.712233782f},
-std::array<float,2>{0.194952875f, 0.232840255f},
-std::array<float,2>{0.836921513f, 0.998707294f},
-std::array<float,2>{0.940688729f, 0.00409836276f},
-std::array<float,2>{0.0972626209f, 0.806279778f},
-std::array<float,2>{0.466771781f, 0.318264723f},
-std::array<float,2>{0.540230751f, 0.524895251f},
-std::array<float,2>{0.604883134f, 0.182967097f},
-std::array<float,2>{0.377181113f, 0.906142354f},
-std::array<float,2>{0.0594673902f, 0.484217942f},
-std::array<float,2>{0.907986879f, 0.640126824f},
-std::array<float,2>{0.799035013f, 0.252287716f},
-std::array<float,2>{0.166678444f, 0.57586199f},
-std::array<float,2>{0.268744797f, 0.085758917f},
-std::array<float,2>{0.672163367f, 0.812535763f},
-std::array<float,2>{0.659062982f, 0.311207563f},
-std::array<float,2>{0.262580216f, 0.595318913f},
-std::array<float,2>{0.176209688f, 0.110178217f},
-std::array<float,2>{0.790453911f, 0.873102784f},
-std::array<float,2>{0.923643708f, 0.139615938f},
-std::array<float,2>{0.0435429253f, 0.931206107f},
-std::array<float,2>{0.391134113f, 0.447250009f},
-std::array<float,2>{0.609482288f, 0.676741064f},
-std::array<float,2>{0.55462873f, 0.036862988f},
-std::array<float,2>{0.451506078f, 0.777615368f},
-std::array<float,2>{0.111453854f, 0.364703119f},
-std::array<float,2>{0.959595919f, 0.548544466f},
-std::array<float,2>{0.817181051f, 0.436091751f},
-std::array<float,2>{0.214359269f, 0.739636183f},
-std::array<float,2>{0.345557034f, 0.195859894f},
-std::array<float,2>{0.712732553f, 0.965626955f},
-std::array<float,2>{0.573852837f, 0.495157421f},
-std::array<float,2>{0.41517812f, 0.653249919f},
-std::array<float,2>{0.0075949179f, 0.163303405f},
-std::array<float,2>{0.882237136f, 0.88258183f},
-std::array<float,2>{0.771362245f, 0.0774625465f},
-std::array<float,2>{0.134482354f, 0.834284246f},
-std::array<float,2>{0.293122143f, 0.272264332f},
-std::array<float,2>{0.655355453f, 0.585778415f},
-std::array<float,2>{0.721641958f, 0.245729402f},
-std::array<float,2>{0.329873651f, 0.973110497f},
-std::array<float,2>{0.241172463f, 0.391698778f},
-std::array<float,2>{0.847187459f, 0.687661231f},
-std::array<float,2>{0.982052267f, 0.340800643f},
-std::array<float,2>{0.062883608f, 0.508060396f},
-std::array<float,2>{0.485470653f, 0.023228772f},
-std::array<float,2>{0.504162014f, 0.791231871f},
-std::array<float,2>{0.579631805f, 0.333361298f},
-std::array<float,2>{0.436435521f, 0.507089019f},
-std::array<float,2>{0.018579971f, 0.0252263583f},
-std::array<float,2>{0.901439488f, 0.784961641f},
-std::array<float,2>{0.752389014f, 0.236764908f},
-std::array<float,2>{0.149380341f, 0.980343699f},
-std::array<float,2>{0.311119556f, 0.403676778f},
-std::array<float,2>{0.630322278f, 0.702603519f},
-std::array<float,2>{0.74491179f, 0.0679773614f},
-std::array<float,2>{0.322010726f, 0.841512442f},
-std::array<float,2>{0.231252611f, 0.274555475f},
-std::array<float,2>{0.872925341f, 0.591363311f},
-std::array<float,2>{0.997400105f, 0.485217333f},
-std::array<float,2>{0.0831420347f, 0.642537773f},
-std::array<float,2>{0.470661461f, 0.164752319f},
-std::array<float,2>{0.530085802f, 0.887992144f},
-std::array<float,2>{0.677275419f, 0.42708993f},
-std::array<float,2>{0.272901535f, 0.749103487f},
-std::array<float,2>{0.171834186f, 0.192279369f},
-std::array<float,2>{0.802213073f, 0.957984388f},
-std::array<float,2>{0.913280308f, 0.0429407172f},
-std::array<float,2>{0.0580768138f, 0.773140311f},
-std::array<float,2>{0.381575048f, 0.369951338f},
-std::array<float,2>{0.60769254f, 0.55554527f},
-std::array<float,2>{0.546625137f, 0.132716388f},
-std::array<float,2>{0.464718193f, 0.927320123f},
-std::array<float,2>{0.1012794f, 0.43875435f},
-std::array<float,2>{0.944600642f, 0.680130124f},
-std::array<float,2>{0.842964709f, 0.297584057f},
-std::array<float,2>{0.191363871f, 0.606995046f},
-std::array<float,2>{0.368761271f, 0.119690493f},
-std::array<float,2>{0.688429117f, 0.86702472f},
-std::array<float,2>{0.718509614f, 0.265036076f},
-std::array<float,2>{0.35124135f, 0.567438066f},
-std::array<float,2>{0.215972006f, 0.0900484249f},
-std::array<float,2>{0.815855265f, 0.827007592f},
-std::array<float,2>{0.956712246f, 0.177565321f},
-std::array<float,2>{0.114019297f, 0.892853141f},
-std::array<float,2>{0.445920587f, 0.4705109f},
-std::array<float,2>{0.549420238f, 0.627496302f},
-std::array<float,2>{0.614748299f, 0.0113786142f},
-std::array<float,2>{0.395541131f, 0.799268007f},
-std::array<float,2>{0.0399523713f, 0.323024631f},
-std::array<float,2>{0.927467823f, 0.517124951f},
-std::array<float,2>{0.794004261f, 0.382406354f},
-std::array<float,2>{0.174437582f, 0.706852138f},
-std::array<float,2>{0.261041671f, 0.222581357f},
-std::array<float,2>{0.662685275f, 0.987140954f},
-std::array<float,2>{0.503418207f, 0.465900242f},
-std::array<float,2>{0.489505738f, 0.670608163f},
-std::array<float,2>{0.0696319342f, 0.146521196f},
-std::array<float,2>{0.976981103f, 0.916453481f},
-std::array<float,2>{0.847792804f, 0.108330727f},
-std::array<float,2>{0.23646149f, 0.846018314f},
-std::array<float,2>{0.334381938f, 0.291028261f},
-std::array<float,2>{0.724311173f, 0.611957967f},
-std::array<float,2>{0.649986744f, 0.217529371f},
-std::array<float,2>{0.291048765f, 0.948687613f},
-std::array<float,2>{0.139231905f, 0.414033741f},
-std::array<float,2>{0.767952561f, 0.72472471f},
-std::array<float,2>{0.878713489f, 0.352681279f},
-std::array<float,2>{0.0037033679f, 0.543257356f},
-std::array<float,2>{0.421468288f, 0.058020182f},
-std::array<float,2>{0.576808333f, 0.752930164f},
-std::array<float,2>{0.555586517f, 0.287503093f},
-std::array<float,2>{0.44185102f, 0.623742044f},
-std::array<float,2>{0.121451974f, 0.096049197f},
-std::array<float,2>{0.965134799f, 0.857248783f},
-std::array<float,2>{0.820558131f, 0.153379068f},
-std::array<float,2>{0.210427672f, 0.906255603f},
-std::array<float,2>{0.354846954f, 0.45913285f},
-std::array<float,2>{0.703679323f, 0.658200204f},
-std::array<float,2>{0.665104628f, 0.0486206673f},
-std::array<float,2>{0.254144549f, 0.760368824f},
-std::array<float,2>{0.184625864f, 0.344507039f},
-std::array<float,2>{0.782075107f, 0.537964821f},
-std::array<float,2>{0.930411637f, 0.415292978f},
-std::array<float,2>{0.0366858132f, 0.727272511f},
-std::array<float,2>{0.400794804f, 0.210097358f},
-std::array<float,2>{0.620135605f, 0.938281f},
-std::array<float,2>{0.726623595f, 0.476981372f},
-std::array<float,2>{0.336545169f, 0.634869337f},
-std::array<float,2>{0.245133996f, 0.183855519f},
-std::array<float,2>{0.856155276f, 0.902338684f},
-std::array<float,2>{0.975109994f, 0.0801216587f},
-std::array<float,2>{0.0778333247f, 0.818344533f},
-std::array<float,2>{0.498770952f, 0.257616192f},
-std::array<float,2>{0.514194369f, 0.572776079f},
-std::array<float,2>{0.56284529f, 0.229453728f},
-std::array<float,2>{0.410577774f, 0.992505014f},
-std::array<float,2>{0.010045385f, 0.389650822f},
-std::array<float,2>{0.889560044f, 0.718044758f},
-std::array<float,2>{0.780938983f, 0.315351427f},
-std::array<float,2>{0.130579025f, 0.530077159f},
-std::array<float,2>{0.288713843f, 0.00358508294f},
-std::array<float,2>{0.648021758f, 0.812027931f},
-std::array<float,2>{0.633985221f, 0.36112988f},
-std::array<float,2>{0.303339064f, 0.552726209f},
-std::array<float,2>{0.145610422f, 0.0329061821f},
-std::array<float,2>{0.758663774f, 0.776689053f},
-std::array<float,2>{0.892166138f, 0.200840369f},
-std::array<float,2>{0.0290662777f, 0.963010311f},
-std::array<float,2>{0.422361135f, 0.432295293f},
-std::array<float,2>{0.588748515f, 0.73791343f},
-std::array<float,2>{0.519735038f, 0.114557862f},
-std::array<float,2>{0.480681747f, 0.867415726f},
-std::array<float,2>{0.0924615189f, 0.305382162f},
-std::array<float,2>{0.987829268f, 0.601405859f},
-std::array<float,2>{0.865917146f, 0.452117145f},
-std::array<float,2>{0.218970925f, 0.673116267f},
-std::array<float,2>{0.319916964f, 0.134108871f},
-std::array<float,2>{0.740882277f, 0.934011638f},
-std::array<float,2>{0.596756577f, 0.395878106f},
-std::array<float,2>{0.38554129f, 0.693097591f},
-std::array<float,2>{0.0493145473f, 0.246225849f},
-std::array<float,2>{0.917619348f, 0.971630633f},
-std::array<float,2>{0.810297132f, 0.0185751896f},
-std::array<float,2>{0.156719282f, 0.796749055f},
-std::array<float,2>{0.279654622f, 0.337106973f},
-std::array<float,2>{0.685250044f, 0.514682055f},
-std::array<float,2>{0.702762067f, 0.158220097f},
-std::array<float,2>{0.366295129f, 0.878154635f},
-std::array<float,2>{0.1955612f, 0.496308714f},
-std::array<float,2>{0.832836211f, 0.649954379f},
-std::array<float,2>{0.946888626f, 0.266892582f},
-std::array<float,2>{0.103898637f, 0.580564618f},
-std::array<float,2>{0.457644999f, 0.073183693f},
-std::array<float,2>{0.537719786f, 0.8309834f},
-std::array<float,2>{0.620369613f, 0.286434978f},
-std::array<float,2>{0.400476277f, 0.621820569f},
-std::array<float,2>{0.0368853658f, 0.0946964696f},
-std::array<float,2>{0.930452645f, 0.858515918f},
-std::array<float,2>{0.781954706f, 0.156218112f},
-std::array<float,2>{0.184823915f, 0.909393907f},
-std::array<float,2>{0.254288971f, 0.457670838f},
-std::array<float,2>{0.66536653f, 0.659819067f},
-std::array<float,2>{0.703980505f, 0.0496438034f},
-std::array<float,2>{0.354566395f, 0.758551002f},
-std::array<float,2>{0.210005194f, 0.347492099f},
-std::array<float,2>{0.820373297f, 0.535555303f},
-std::array<float,2>{0.965085566f, 0.416475743f},
-std::array<float,2>{0.121219382f, 0.728651702f},
-std::array<float,2>{0.441550791f, 0.208975524f},
-std::array<float,2>{0.55532366f, 0.940724313f},
-std::array<float,2>{0.64824605f, 0.478579819f},
-std::array<float,2>{0.288981378f, 0.633285642f},
-std::array<float,2>{0.130811334f, 0.185752526f},
-std::array<float,2>{0.781241536f, 0.900045753f},
-std::array<float,2>{0.889175296f, 0.0786546171f},
-std::array<float,2>{0.0100007523f, 0.819575369f},
-std::array<float,2>{0.410242051f, 0.25439781f},
-std::array<float,2>{0.562724829f, 0.57076782f},
-std::array<float,2>{0.51456964f, 0.226754338f},
-std::array<float,2>{0.498801261f, 0.995157003f},
-std::array<float,2>{0.0780483782f, 0.388471812f},
-std::array<float,2>{0.975458384f, 0.715721607f},
-std::array<float,2>{0.856245875f, 0.314369351f},
-std::array<float,2>{0.245556816f, 0.527372479f},
-std::array<float,2>{0.336874485f, 0.00119611237f},
-std::array<float,2>{0.727037132f, 0.809981287f},
-std::array<float,2>{0.741131842f, 0.361419708f},
-std::array<float,2>{0.320095181f, 0.553117216f},
-std::array<float,2>{0.219183892f, 0.0350912064f},
-std::array<float,2>{0.866086245f, 0.774905205f},
-std::array<float,2>{0.988213062f, 0.202140763f},
-std::array<float,2>{0.092668213f, 0.961947322f},
-std::array<float,2>{0.480848879f, 0.429911792f},
-std::array<float,2>{0.519840002f, 0.735667348f},
-std::array<float,2>{0.588412404f, 0.116130382f},
-std::array<float,2>{0.422049284f, 0.870428979f},
-std::array<float,2>{0.0288584102f, 0.307796806f},
-std::array<float,2>{0.892557919f, 0.598216891f},
-std::array<float,2>{0.75836736f, 0.449286312f},
-std::array<float,2>{0.145758152f, 0.674706042f},
-std::array<float,2>{0.303569138f, 0.136421368f},
-std::array<float,2>{0.634215593f, 0.936447322f},
-std::array<float,2>{0.537899077f, 0.397659898f},
-std::array<float,2>{0.45781523f, 0.694666147f},
-std::array<float,2>{0.103701502f, 0.249175906f},
-std::array<float,2>{0.947073579f, 0.968845069f},
-std::array<float,2>{0.832558453f, 0.0164245516f},
-std::array<float,2>{0.195379078f, 0.793856263f},
-std::array<float,2>{0.366468936f, 0.33879146f},
-std::array<float,2>{0.702978313f, 0.513658583f},
-std::array<float,2>{0.685359538f, 0.156727061f},
-std::array<float,2>{0.279518157f, 0.875130892f},
-std::array<float,2>{0.156313032f, 0.499722779f},
-std::array<float,2>{0.810453117f, 0.651834428f},
-std::array<float,2>{0.917817354f, 0.269515902f},
-std::array<float,2>{0.0489302203f, 0.579394341f},
-std::array<float,2>{0.385403335f, 0.0720573291f},
-std::array<float,2>{0.597109437f, 0.829183102f},
-std::array<float,2>{0.529962599f, 0.334092677f},
-std::array<float,2>{0.470409334f, 0.504606843f},
-std::array<float,2>{0.0833347961f, 0.025786005f},
-std::array<float,2>{0.997211695f, 0.781455994f},
-std::array<float,2>{0.872666895f, 0.235499293f},
-std::array<float,2>{0.23098357f, 0.977406323f},
-std::array<float,2>{0.322101414f, 0.40620023f},
-std::array<float,2>{0.744674206f, 0.700748026f},
-std::array<float,2>{0.629940152f, 0.0685895681f},
-std::array<float,2>{0.31129235f, 0.843043685f},
-std::array<float,2>{0.149119064f, 0.276287824f},
-std::array<float,2>{0.752081394f, 0.592619896f},
-std::array<float,2>{0.901733398f, 0.488220662f},
-std::array<float,2>{0.0188661385f, 0.6437096f},
-std::array<float,2>{0.436273277f, 0.166821197f},
-std::array<float,2>{0.579978108f, 0.888771653f},
-std::array<float,2>{0.688138902f, 0.429639578f},
-std::array<float,2>{0.369011164f, 0.747987747f},
-std::array<float,2>{0.19099018f, 0.194781095f},
-std::array<float,2>{0.843250394f, 0.960359633f},
-std::array<float,2>{0.944339454f, 0.0397468954f},
-std::array<float,2>{0.1014015f, 0.770017385f},
-std::array<float,2>{0.464569986f, 0.367626369f},
-std::array<float,2>{0.546862841f, 0.558297634f},
-std::array<float,2>{0.607499123f, 0.129256651f},
-std::array<float,2>{0.381604254f, 0.928039968f},
-std::array<float,2>{0.0576432906f, 0.440211713f},
-std::array<float,2>{0.913450241f, 0.683560014f},
-std::array<float,2>{0.801847637f, 0.300470412f},
-std::array<float,2>{0.171548739f, 0.608200967f},
-std::array<float,2>{0.272660881f, 0.118539393f},
-std::array<float,2>{0.677584171f, 0.864183843f},
-std::array<float,2>{0.662918091f, 0.263271302f},
-std::array<float,2>{0.260903448f, 0.569958746f},
-std::array<float,2>{0.174622476f, 0.0923177376f},
-std::array<float,2>{0.794319332f, 0.824492157f},
-std::array<float,2>{0.927522063f, 0.1786713f},
-std::array<float,2>{0.039677754f, 0.891132534f},
-std::array<float,2>{0.39584595f, 0.472485602f},
-std::array<float,2>{0.615094304f, 0.625380576f},
-std::array<float,2>{0.549565554f, 0.00953996368f},
-std::array<float,2>{0.446175724f, 0.798677325f},
-std::array<float,2>{0.11385455f, 0.32077378f},
-std::array<float,2>{0.956852555f, 0.518968821f},
-std::array<float,2>{0.815622687f, 0.379015952f},
-std::array<float,2>{0.216111109f, 0.70471251f},
-std::array<float,2>{0.351524472f, 0.21969533f},
-std::array<float,2>{0.718454599f, 0.984496653f},
-std::array<float,2>{0.577135742f, 0.468643129f},
-std::array<float,2>{0.421868056f, 0.669104159f},
-std::array<float,2>{0.0035555074f, 0.146213293f},
-std::array<float,2>{0.878444552f, 0.915958226f},
-std::array<float,2>{0.767658055f, 0.10668239f},
-std::array<float,2>{0.139508575f, 0.843788624f},
-std::array<float,2>{0.291435122f, 0.290942132f},
-std::array<float,2>{0.650227547f, 0.610300899f},
-std::array<float,2>{0.724456728f, 0.214948818f},
-std::array<float,2>{0.33408922f, 0.946842372f},
-std::array<float,2>{0.236687496f, 0.410616666f},
-std::array<float,2>{0.848019183f, 0.723812819f},
-std::array<float,2>{0.976637721f, 0.353885382f},
-std::array<float,2>{0.0694361255f, 0.545687735f},
-std::array<float,2>{0.48944217f, 0.0560148433f},
-std::array<float,2>{0.503663301f, 0.750670016f},
-std::array<float,2>{0.582096338f, 0.349879742f},
-std::array<float,2>{0.432940334f, 0.531558633f},
-std::array<float,2>{0.023016192f, 0.0531419739f},
-std::array<float,2>{0.90476948f, 0.762294292f},
-std::array<float,2>{0.754154801f, 0.203571707f},
-std::array<float,2>{0.152802676f, 0.945290923f},
-std::array<float,2>{0.307320505f, 0.419257522f},
-std::array<float,2>{0.626768231f, 0.732115626f},
-std::array<float,2>{0.74728632f, 0.0984772369f},
-std::array<float,2>{0.325083792f, 0.852885842f},
-std::array<float,2>{0.229721591f, 0.281492651f},
-std::array<float,2>{0.868369758f, 0.619695723f},
-std::array<float,2>{0.992858231f, 0.455231994f},
-std::array<float,2>{0.0810898915f, 0.661361933f},
-std::array<float,2>{0.475046217f, 0.152155071f},
-std::array<float,2>{0.525536954f, 0.910921931f},
-std::array<float,2>{0.672106206f, 0.385523647f},
-std::array<float,2>{0.268843502f, 0.714798272f},
-std::array<float,2>{0.166903555f, 0.230522633f},
-std::array<float,2>{0.799125314f, 0.996780157f},
-std::array<float,2>{0.907874942f, 0.00734084891f},
-std::array<float,2>{0.0591350235f, 0.80737555f},
-std::array<float,2>{0.377282798f, 0.319439054f},
-std::array<float,2>{0.604651332f, 0.525535345f},
-std::array<float,2>{0.540315151f, 0.181314334f},
-std::array<float,2>{0.466345787f, 0.90363431f},
-std::array<float,2>{0.0975453779f, 0.480534822f},
-std::array<float,2>{0.940471709f, 0.636783063f},
-std::array<float,2>{0.837363482f, 0.2501899f},
-std::array<float,2>{0.195201665f, 0.577879846f},
-std::array<float,2>{0.373114407f, 0.0839227736f},
-std::array<float,2>{0.693542838f, 0.81468159f},
-std::array<float,2>{0.712630868f, 0.308669299f},
-std::array<float,2>{0.345237762f, 0.597535551f},
-std::array<float,2>{0.214677498f, 0.111958869f},
-std::array<float,2>{0.816952109f, 0.871668696f},
-std::array<float,2>{0.959795952f, 0.137310028f},
-std::array<float,2>{0.111620314f, 0.933357894f},
-std::array<float,2>{0.451228291f, 0.447337925f},
-std::array<float,2>{0.554237247f, 0.677811563f},
-std::array<float,2>{0.609758615f, 0.0373770259f},
-std::array<float,2>{0.391385525f, 0.781159103f},
-std::array<float,2>{0.0439131595f, 0.366174608f},
-std::array<float,2>{0.923482835f, 0.549584329f},
-std::array<float,2>{0.790073514f, 0.43381682f},
-std::array<float,2>{0.175810754f, 0.74153018f},
-std::array<float,2>{0.262330025f, 0.19732675f},
-std::array<float,2>{0.658694506f, 0.968543649f},
-std::array<float,2>{0.504102528f, 0.493311763f},
-std::array<float,2>{0.48565951f, 0.654915929f},
-std::array<float,2>{0.0625670254f, 0.160324246f},
-std::array<float,2>{0.982311726f, 0.879807889f},
-std::array<float,2>{0.847472787f, 0.0747233927f},
-std::array<float,2>{0.240930289f, 0.833161891f},
-std::array<float,2>{0.329617769f, 0.270638555f},
-std::array<float,2>{0.721265018f, 0.583128273f},
-std::array<float,2>{0.655756474f, 0.24271737f},
-std::array<float,2>{0.293422043f, 0.975691676f},
-std::array<float,2>{0.134694293f, 0.3936553f},
-std::array<float,2>{0.771026611f, 0.690407932f},
-std::array<float,2>{0.881982327f, 0.343126088f},
-std::array<float,2>{0.00743282726f, 0.511230588f},
-std::array<float,2>{0.415481776f, 0.0204422381f},
-std::array<float,2>{0.57405889f, 0.789186835f},
-std::array<float,2>{0.561558366f, 0.279835671f},
-std::array<float,2>{0.4388614f, 0.589548349f},
-std::array<float,2>{0.120066948f, 0.0650069118f},
-std::array<float,2>{0.964097917f, 0.837863743f},
-std::array<float,2>{0.825683653f, 0.1704088f},
-std::array<float,2>{0.204669595f, 0.882867634f},
-std::array<float,2>{0.358534634f, 0.489360303f},
-std::array<float,2>{0.710023522f, 0.64462167f},
-std::array<float,2>{0.670046926f, 0.0312257856f},
-std::array<float,2>{0.253777981f, 0.787163794f},
-std::array<float,2>{0.182869405f, 0.331858516f},
-std::array<float,2>{0.788286209f, 0.501612663f},
-std::array<float,2>{0.933714569f, 0.401801646f},
-std::array<float,2>{0.0323903747f, 0.696083128f},
-std::array<float,2>{0.404222846f, 0.240272731f},
-std::array<float,2>{0.622980475f, 0.981451511f},
-std::array<float,2>{0.732349277f, 0.442017704f},
-std::array<float,2>{0.340079039f, 0.6836707f},
-std::array<float,2>{0.249489471f, 0.125285894f},
-std::array<float,2>{0.853984237f, 0.923309028f},
-std::array<float,2>{0.970013142f, 0.123530388f},
-std::array<float,2>{0.0704159066f, 0.860094607f},
-std::array<float,2>{0.495480001f, 0.301918119f},
-std::array<float,2>{0.511391044f, 0.605004549f},
-std::array<float,2>{0.56753701f, 0.190441519f},
-std::array<float,2>{0.408400983f, 0.954188526f},
-std::array<float,2>{0.0127692977f, 0.423809707f},
-std::array<float,2>{0.886327386f, 0.745635092f},
-std::array<float,2>{0.77577734f, 0.371955574f},
-std::array<float,2>{0.127008528f, 0.56067121f},
-std::array<float,2>{0.28380999f, 0.044687558f},
-std::array<float,2>{0.64354974f, 0.768764853f},
-std::array<float,2>{0.640260398f, 0.325679362f},
-std::array<float,2>{0.300673962f, 0.521949768f},
-std::array<float,2>{0.142455429f, 0.014058074f},
-std::array<float,2>{0.762781441f, 0.802056909f},
-std::array<float,2>{0.89749831f, 0.22475794f},
-std::array<float,2>{0.0245705675f, 0.990184963f},
-std::array<float,2>{0.428648204f, 0.375001371f},
-std::array<float,2>{0.592335105f, 0.709267259f},
-std::array<float,2>{0.51762569f, 0.0870294943f},
-std::array<float,2>{0.477860421f, 0.822633684f},
-std::array<float,2>{0.0873468965f, 0.259080917f},
-std::array<float,2>{0.990781724f, 0.563975573f},
-std::array<float,2>{0.861212671f, 0.475387573f},
-std::array<float,2>{0.222747862f, 0.632472754f},
-std::array<float,2>{0.314980268f, 0.172030538f},
-std::array<float,2>{0.735651135f, 0.898255944f},
-std::array<float,2>{0.600166023f, 0.40864408f},
-std::array<float,2>{0.389736742f, 0.720223784f},
-std::array<float,2>{0.0544739515f, 0.211791083f},
-std::array<float,2>{0.918288112f, 0.949705899f},
-std::array<float,2>{0.807731688f, 0.0608141758f},
-std::array<float,2>{0.160885856f, 0.755300522f},
-std::array<float,2>{0.275687516f, 0.358885467f},
-std::array<float,2>{0.681071103f, 0.540628791f},
-std::array<float,2>{0.697873175f, 0.141798183f},
-std::array<float,2>{0.360672206f, 0.920438766f},
-std::array<float,2>{0.201186404f, 0.462159693f},
-std::array<float,2>{0.830814123f, 0.667224884f},
-std::array<float,2>{0.951864719f, 0.294389576f},
-std::array<float,2>{0.107964151f, 0.614197254f},
-std::array<float,2>{0.454527617f, 0.101789154f},
-std::array<float,2>{0.534914076f, 0.84790659f},
-std::array<float,2>{0.566333652f, 0.25677231f},
-std::array<float,2>{0.413405985f, 0.573546529f},
-std::array<float,2>{0.00802495889f, 0.0813436434f},
-std::array<float,2>{0.888373792f, 0.817247868f},
-std::array<float,2>{0.778026462f, 0.184788361f},
-std::array<float,2>{0.131377533f, 0.901072562f},
-std::array<float,2>{0.286758035f, 0.477659702f},
-std::array<float,2>{0.645651996f, 0.636363387f},
-std::array<float,2>{0.730037034f, 0.00279988744f},
-std::array<float,2>{0.338431686f, 0.811191916f},
-std::array<float,2>{0.243246153f, 0.315852135f},
-std::array<float,2>{0.859350383f, 0.530691326f},
-std::array<float,2>{0.973416269f, 0.389374703f},
-std::array<float,2>{0.0756538287f, 0.716978431f},
-std::array<float,2>{0.497978598f, 0.230391115f},
-std::array<float,2>{0.511932433f, 0.993192911f},
-std::array<float,2>{0.666770339f, 0.460894763f},
-std::array<float,2>{0.257524967f, 0.656378686f},
-std::array<float,2>{0.186152905f, 0.153243557f},
-std::array<float,2>{0.784583032f, 0.90794301f},
-std::array<float,2>{0.932115197f, 0.097406663f},
-std::array<float,2>{0.038135197f, 0.856131971f},
-std::array<float,2>{0.400374293f, 0.289009243f},
-std::array<float,2>{0.617654979f, 0.624664545f},
-std::array<float,2>{0.557965696f, 0.209330902f},
-std::array<float,2>{0.445183754f, 0.939246237f},
-std::array<float,2>{0.123564027f, 0.414504051f},
-std::array<float,2>{0.967205167f, 0.728060961f},
-std::array<float,2>{0.823204398f, 0.344952792f},
-std::array<float,2>{0.208043113f, 0.538553655f},
-std::array<float,2>{0.353081793f, 0.0478027612f},
-std::array<float,2>{0.70643878f, 0.761527538f},
-std::array<float,2>{0.700555623f, 0.336545587f},
-std::array<float,2>{0.364597023f, 0.513833463f},
-std::array<float,2>{0.197504029f, 0.0180747267f},
-std::array<float,2>{0.835735142f, 0.79580003f},
-std::array<float,2>{0.948130786f, 0.24750866f},
-std::array<float,2>{0.102934323f, 0.972370684f},
-std::array<float,2>{0.460669816f, 0.395057738f},
-std::array<float,2>{0.537074387f, 0.69214952f},
-std::array<float,2>{0.59437871f, 0.0740591958f},
-std::array<float,2>{0.383338958f, 0.831168771f},
-std::array<float,2>{0.0487152189f, 0.265749812f},
-std::array<float,2>{0.914360642f, 0.58159703f},
-std::array<float,2>{0.812017858f, 0.497883528f},
-std::array<float,2>{0.158275396f, 0.64940846f},
-std::array<float,2>{0.277510375f, 0.159255907f},
-std::array<float,2>{0.687120497f, 0.877115548f},
-std::array<float,2>{0.52265203f, 0.432739317f},
-std::array<float,2>{0.483134449f, 0.73699832f},
-std::array<float,2>{0.0906232297f, 0.199514344f},
-std::array<float,2>{0.984836876f, 0.964762688f},
-std::array<float,2>{0.863768935f, 0.031418249f},
-std::array<float,2>{0.222267389f, 0.775773883f},
-std::array<float,2>{0.316666663f, 0.360078454f},
-std::array<float,2>{0.739290774f, 0.551081896f},
-std::array<float,2>{0.635378122f, 0.133251682f},
-std::array<float,2>{0.302719355f, 0.935292006f},
-std::array<float,2>{0.147740915f, 0.452661544f},
-std::array<float,2>{0.75985539f, 0.672357261f},
-std::array<float,2>{0.894007087f, 0.306600332f},
-std::array<float,2>{0.0298959091f, 0.599825501f},
-std::array<float,2>{0.424850285f, 0.113747217f},
-std::array<float,2>{0.587445736f, 0.868589818f},
-std::array<float,2>{0.544206858f, 0.370388955f},
-std::array<float,2>{0.462184459f, 0.555673182f},
-std::array<float,2>{0.0983193293f, 0.0411777012f},
-std::array<float,2>{0.943108022f, 0.771897733f},
-std::array<float,2>{0.839979649f, 0.19316031f},
-std::array<float,2>{0.18931298f, 0.958030462f},
-std::array<float,2>{0.369676918f, 0.426266134f},
-std::array<float,2>{0.689519227f, 0.748805523f},
-std::array<float,2>{0.678797841f, 0.121016502f},
-std::array<float,2>{0.271114439f, 0.865524828f},
-std::array<float,2>{0.169012591f, 0.298103631f},
-std::array<float,2>{0.803562462f, 0.605590761f},
-std::array<float,2>{0.910556674f, 0.438391179f},
-std::array<float,2>{0.0554832667f, 0.681311607f},
-std::array<float,2>{0.37899822f, 0.13151066f},
-std::array<float,2>{0.60554266f, 0.926540613f},
-std::array<float,2>{0.743207693f, 0.403210044f},
-std::array<float,2>{0.32401824f, 0.702135086f},
-std::array<float,2>{0.232988715f, 0.237563029f},
-std::array<float,2>{0.87405926f, 0.979476511f},
-std::array<float,2>{0.999533355f, 0.02367213f},
-std::array<float,2>{0.0852843001f, 0.784116268f},
-std::array<float,2>{0.470844388f, 0.332280636f},
-std::array<float,2>{0.528183401f, 0.506694078f},
-std::array<float,2>{0.580644488f, 0.165217161f},
-std::array<float,2>{0.434364974f, 0.887347043f},
-std::array<float,2>{0.0168359615f, 0.48548013f},
-std::array<float,2>{0.899647653f, 0.64124018f},
-std::array<float,2>{0.750104725f, 0.273554116f},
-std::array<float,2>{0.15224123f, 0.590071321f},
-std::array<float,2>{0.309340984f, 0.0668181255f},
-std::array<float,2>{0.632133126f, 0.839844823f},
-std::array<float,2>{0.651088297f, 0.292407483f},
-std::array<float,2>{0.29007709f, 0.612873554f},
-std::array<float,2>{0.138600945f, 0.108907804f},
-std::array<float,2>{0.767345309f, 0.847363293f},
-std::array<float,2>{0.875790656f, 0.147736222f},
-std::array<float,2>{0.00146867405f, 0.917755902f},
-std::array<float,2>{0.419880629f, 0.465043306f},
-std::array<float,2>{0.574871719f, 0.671311975f},
-std::array<float,2>{0.501462519f, 0.0568235144f},
-std::array<float,2>{0.490979016f, 0.75252074f},
-std::array<float,2>{0.0681924745f, 0.351980746f},
-std::array<float,2>{0.978861332f, 0.544415534f},
-std::array<float,2>{0.851234198f, 0.412438393f},
-std::array<float,2>{0.234395579f, 0.726023614f},
-std::array<float,2>{0.332587898f, 0.218200326f},
-std::array<float,2>{0.726033986f, 0.94757843f},
-std::array<float,2>{0.616069913f, 0.46898219f},
-std::array<float,2>{0.398000032f, 0.628762841f},
-std::array<float,2>{0.0410490483f, 0.175946742f},
-std::array<float,2>{0.928627253f, 0.894317389f},
-std::array<float,2>{0.795625627f, 0.0908224136f},
-std::array<float,2>{0.173756734f, 0.827158689f},
-std::array<float,2>{0.258925766f, 0.263971835f},
-std::array<float,2>{0.661645591f, 0.56726867f},
-std::array<float,2>{0.716132641f, 0.221008405f},
-std::array<float,2>{0.347943366f, 0.988247633f},
-std::array<float,2>{0.216874123f, 0.381266236f},
-std::array<float,2>{0.813863516f, 0.705965936f},
-std::array<float,2>{0.95468092f, 0.323746592f},
-std::array<float,2>{0.116189905f, 0.515781105f},
-std::array<float,2>{0.448156923f, 0.00999566633f},
-std::array<float,2>{0.548018098f, 0.799883783f},
-std::array<float,2>{0.603189528f, 0.317083061f},
-std::array<float,2>{0.376352042f, 0.523713946f},
-std::array<float,2>{0.0618589483f, 0.0050793034f},
-std::array<float,2>{0.908312857f, 0.805044353f},
-std::array<float,2>{0.797887266f, 0.23409915f},
-std::array<float,2>{0.164401293f, 0.999482632f},
-std::array<float,2>{0.266811162f, 0.383643925f},
-std::array<float,2>{0.675476909f, 0.711631596f},
-std::array<float,2>{0.692707896f, 0.0844655484f},
-std::array<float,2>{0.372721255f, 0.814329445f},
-std::array<float,2>{0.192001209f, 0.253149271f},
-std::array<float,2>{0.837892413f, 0.574859083f},
-std::array<float,2>{0.937639534f, 0.482756585f},
-std::array<float,2>{0.0940624848f, 0.639568448f},
-std::array<float,2>{0.468007863f, 0.182154283f},
-std::array<float,2>{0.541344225f, 0.904949188f},
-std::array<float,2>{0.6287328f, 0.421070814f},
-std::array<float,2>{0.306147784f, 0.73427701f},
-std::array<float,2>{0.155985057f, 0.206164211f},
-std::array<float,2>{0.757156193f, 0.94305104f},
-std::array<float,2>{0.903159976f, 0.0515076146f},
-std::array<float,2>{0.0203757733f, 0.763787687f},
-std::array<float,2>{0.430116177f, 0.348580509f},
-std::array<float,2>{0.584925532f, 0.534890413f},
-std::array<float,2>{0.523523152f, 0.149500087f},
-std::array<float,2>{0.47322157f, 0.91381228f},
-std::array<float,2>{0.0798352659f, 0.454447329f},
-std::array<float,2>{0.996092141f, 0.663901508f},
-std::array<float,2>{0.870366335f, 0.284027189f},
-std::array<float,2>{0.227957472f, 0.618441463f},
-std::array<float,2>{0.327121615f, 0.10138949f},
-std::array<float,2>{0.749608994f, 0.853529215f},
-std::array<float,2>{0.719486177f, 0.273341298f},
-std::array<float,2>{0.33155629f, 0.58494246f},
-std::array<float,2>{0.238982633f, 0.0762951076f},
-std::array<float,2>{0.844067574f, 0.83545804f},
-std::array<float,2>{0.983490109f, 0.162319079f},
-std::array<float,2>{0.0652474612f, 0.880999804f},
-std::array<float,2>{0.487469912f, 0.495061666f},
-std::array<float,2>{0.507128417f, 0.653745234f},
-std::array<float,2>{0.570394993f, 0.0221725386f},
-std::array<float,2>{0.417481095f, 0.792504311f},
-std::array<float,2>{0.00455103675f, 0.34156391f},
-std::array<float,2>{0.880361021f, 0.508921087f},
-std::array<float,2>{0.77267158f, 0.390709579f},
-std::array<float,2>{0.136165529f, 0.689078569f},
-std::array<float,2>{0.29675284f, 0.244808853f},
-std::array<float,2>{0.653023362f, 0.97397387f},
-std::array<float,2>{0.551977277f, 0.445542961f},
-std::array<float,2>{0.449877888f, 0.676936626f},
-std::array<float,2>{0.110886998f, 0.139911607f},
-std::array<float,2>{0.957268655f, 0.929756165f},
-std::array<float,2>{0.819268644f, 0.110879585f},
-std::array<float,2>{0.212275669f, 0.874718964f},
-std::array<float,2>{0.34623909f, 0.311570078f},
-std::array<float,2>{0.71328485f, 0.593872726f},
-std::array<float,2>{0.657574832f, 0.196806446f},
-std::array<float,2>{0.264703602f, 0.966224551f},
-std::array<float,2>{0.179595977f, 0.437009692f},
-std::array<float,2>{0.792333186f, 0.739219189f},
-std::array<float,2>{0.924260914f, 0.363602787f},
-std::array<float,2>{0.045698218f, 0.547287345f},
-std::array<float,2>{0.393505603f, 0.0355358496f},
-std::array<float,2>{0.612419128f, 0.778354824f},
-std::array<float,2>{0.508940458f, 0.302922904f},
-std::array<float,2>{0.49279967f, 0.602821529f},
-std::array<float,2>{0.0728619397f, 0.121193521f},
-std::array<float,2>{0.970969558f, 0.861779332f},
-std::array<float,2>{0.852350295f, 0.126978785f},
-std::array<float,2>{0.246354595f, 0.924210668f},
-std::array<float,2>{0.342431098f, 0.444648981f},
-std::array<float,2>{0.733612597f, 0.685999632f},
-std::array<float,2>{0.642430127f, 0.0459498689f},
-std::array<float,2>{0.282643378f, 0.766648829f},
-std::array<float,2>{0.125050545f, 0.374610424f},
-std::array<float,2>{0.773566663f, 0.560226798f},
-std::array<float,2>{0.883728862f, 0.425776809f},
-std::array<float,2>{0.0155325579f, 0.742444456f},
-std::array<float,2>{0.406323195f, 0.18780905f},
-std::array<float,2>{0.569092512f, 0.956363261f},
-std::array<float,2>{0.707071126f, 0.490404785f},
-std::array<float,2>{0.356315017f, 0.647511363f},
-std::array<float,2>{0.205847427f, 0.169755101f},
-std::array<float,2>{0.826447546f, 0.885171056f},
-std::array<float,2>{0.961959362f, 0.0634888709f},
-std::array<float,2>{0.117823184f, 0.838423908f},
-std::array<float,2>{0.441305429f, 0.277820319f},
-std::array<float,2>{0.559789538f, 0.58766675f},
-std::array<float,2>{0.624060333f, 0.238436207f},
-std::array<float,2>{0.404737622f, 0.984231293f},
-std::array<float,2>{0.0342626311f, 0.399715215f},
-std::array<float,2>{0.937466681f, 0.699053943f},
-std::array<float,2>{0.786405444f, 0.328801483f},
-std::array<float,2>{0.181332543f, 0.502176404f},
-std::array<float,2>{0.250774026f, 0.0285964627f},
-std::array<float,2>{0.668143213f, 0.786943138f},
-std::array<float,2>{0.683306217f, 0.355595946f},
-std::array<float,2>{0.273531497f, 0.54232502f},
-std::array<float,2>{0.163831279f, 0.0602733493f},
-std::array<float,2>{0.804913223f, 0.75640136f},
-std::array<float,2>{0.920356691f, 0.213167876f},
-std::array<float,2>{0.0523466021f, 0.952017248f},
-std::array<float,2>{0.387443542f, 0.407719314f},
-std::array<float,2>{0.599077046f, 0.720750034f},
-std::array<float,2>{0.531370163f, 0.103883654f},
-std::array<float,2>{0.455668509f, 0.849831223f},
-std::array<float,2>{0.10706377f, 0.295382798f},
-std::array<float,2>{0.949382246f, 0.616694868f},
-std::array<float,2>{0.829731524f, 0.463948518f},
-std::array<float,2>{0.199778035f, 0.665396035f},
-std::array<float,2>{0.361675739f, 0.143011868f},
-std::array<float,2>{0.697183073f, 0.918707073f},
-std::array<float,2>{0.59088856f, 0.377716005f},
-std::array<float,2>{0.42654413f, 0.708176792f},
-std::array<float,2>{0.0256594568f, 0.223642975f},
-std::array<float,2>{0.895169854f, 0.99187088f},
-std::array<float,2>{0.765279055f, 0.0127583453f},
-std::array<float,2>{0.142968789f, 0.803559721f},
-std::array<float,2>{0.297629684f, 0.326226413f},
-std::array<float,2>{0.636938572f, 0.520915329f},
-std::array<float,2>{0.736793041f, 0.174402311f},
-std::array<float,2>{0.313212156f, 0.896108806f},
-std::array<float,2>{0.225709736f, 0.472962111f},
-std::array<float,2>{0.862536013f, 0.630743623f},
-std::array<float,2>{0.989552736f, 0.25987193f},
-std::array<float,2>{0.0879904553f, 0.565275967f},
-std::array<float,2>{0.479052424f, 0.0892237574f},
-std::array<float,2>{0.515864789f, 0.822161674f},
-std::array<float,2>{0.586288095f, 0.306894481f},
-std::array<float,2>{0.424060851f, 0.598654449f},
-std::array<float,2>{0.0312050506f, 0.116856195f},
-std::array<float,2>{0.893251538f, 0.869731009f},
-std::array<float,2>{0.761420548f, 0.135708407f},
-std::array<float,2>{0.147232816f, 0.937334716f},
-std::array<float,2>{0.301585644f, 0.450467855f},
-std::array<float,2>{0.636436224f, 0.675637066f},
-std::array<float,2>{0.738568604f, 0.0338513516f},
-std::array<float,2>{0.318178862f, 0.77418828f},
-std::array<float,2>{0.221492499f, 0.36241889f},
-std::array<float,2>{0.864887893f, 0.554402769f},
-std::array<float,2>{0.98627317f, 0.43136552f},
-std::array<float,2>{0.0912245736f, 0.734618306f},
-std::array<float,2>{0.483916342f, 0.202371836f},
-std::array<float,2>{0.521907985f, 0.961848855f},
-std::array<float,2>{0.685602963f, 0.498598129f},
-std::array<float,2>{0.278666973f, 0.65126425f},
-std::array<float,2>{0.159902915f, 0.157902926f},
-std::array<float,2>{0.810614288f, 0.876849353f},
-std::array<float,2>{0.915969193f, 0.0710012093f},
-std::array<float,2>{0.0476097651f, 0.82846415f},
-std::array<float,2>{0.383873403f, 0.268075258f},
-std::array<float,2>{0.595428407f, 0.578269422f},
-std::array<float,2>{0.535688162f, 0.248413503f},
-std::array<float,2>{0.459858537f, 0.970565081f},
-std::array<float,2>{0.101589285f, 0.397172719f},
-std::array<float,2>{0.948321521f, 0.693369269f},
-std::array<float,2>{0.834160924f, 0.339375585f},
-std::array<float,2>{0.199007213f, 0.512569308f},
-std::array<float,2>{0.363778532f, 0.016835846f},
-std::array<float,2>{0.699963391f, 0.794855833f},
-std::array<float,2>{0.705578804f, 0.346637189f},
-std::array<float,2>{0.351752728f, 0.536311924f},
-std::array<float,2>{0.207144335f, 0.0503605679f},
-std::array<float,2>{0.823398352f, 0.75913012f},
-std::array<float,2>{0.968618631f, 0.207730219f},
-std::array<float,2>{0.124326967f, 0.939982712f},
-std::array<float,2>{0.443619668f, 0.417565227f},
-std::array<float,2>{0.557507694f, 0.729619086f},
-std::array<float,2>{0.618455768f, 0.0952353179f},
-std::array<float,2>{0.399025381f, 0.858130872f},
-std::array<float,2>{0.0377780311f, 0.285527468f},
-std::array<float,2>{0.932988286f, 0.622829616f},
-std::array<float,2>{0.784010351f, 0.458731264f},
-std::array<float,2>{0.187107787f, 0.658244967f},
-std::array<float,2>{0.255878687f, 0.154615924f},
-std::array<float,2>{0.667331576f, 0.908774853f},
-std::array<float,2>{0.512817144f, 0.386955082f},
-std::array<float,2>{0.496282697f, 0.715881646f},
-std::array<float,2>{0.0748981833f, 0.227682471f},
-std::array<float,2>{0.973701715f, 0.994744301f},
-std::array<float,2>{0.857954502f, 0.000506201119f},
-std::array<float,2>{0.242530331f, 0.80899626f},
-std::array<float,2>{0.339363575f, 0.313258976f},
-std::array<float,2>{0.728817821f, 0.528370917f},
-std::array<float,2>{0.644579947f, 0.187039971f},
-std::array<float,2>{0.285904199f, 0.898774207f},
-std::array<float,2>{0.13213177f, 0.480423063f},
-std::array<float,2>{0.779138863f, 0.634592593f},
-std::array<float,2>{0.887376606f, 0.255614698f},
-std::array<float,2>{0.00973737426f, 0.57207197f},
-std::array<float,2>{0.412596881f, 0.0794175267f},
-std::array<float,2>{0.565217614f, 0.81893158f},
-std::array<float,2>{0.546885848f, 0.322171301f},
-std::array<float,2>{0.44866097f, 0.517665207f},
-std::array<float,2>{0.117026426f, 0.00823749229f},
-std::array<float,2>{0.953528285f, 0.797322094f},
-std::array<float,2>{0.813156188f, 0.220291033f},
-std::array<float,2>{0.217795983f, 0.985519409f},
-std::array<float,2>{0.349065781f, 0.380799353f},
-std::array<float,2>{0.714936674f, 0.703242362f},
-std::array<float,2>{0.660732746f, 0.093405813f},
-std::array<float,2>{0.258735955f, 0.825823128f},
-std::array<float,2>{0.17253238f, 0.262349963f},
-std::array<float,2>{0.796797216f, 0.568545878f},
-std::array<float,2>{0.929232657f, 0.471169233f},
-std::array<float,2>{0.0426906087f, 0.626686931f},
-std::array<float,2>{0.396832258f, 0.17946288f},
-std::array<float,2>{0.616997063f, 0.891794026f},
-std::array<float,2>{0.724818528f, 0.411869824f},
-std::array<float,2>{0.33302325f, 0.723221719f},
-std::array<float,2>{0.236123219f, 0.216078684f},
-std::array<float,2>{0.849999666f, 0.946193576f},
-std::array<float,2>{0.980202556f, 0.0555344485f},
-std::array<float,2>{0.0664324462f, 0.751416087f},
-std::array<float,2>{0.491362929f, 0.355277091f},
-std::array<float,2>{0.500064015f, 0.546117365f},
-std::array<float,2>{0.575235486f, 0.144641578f},
-std::array<float,2>{0.418509632f, 0.914186239f},
-std::array<float,2>{0.00010498042f, 0.466888428f},
-std::array<float,2>{0.876850247f, 0.668071449f},
-std::array<float,2>{0.766581774f, 0.289293766f},
-std::array<float,2>{0.13704285f, 0.610565007f},
-std::array<float,2>{0.289232552f, 0.10549131f},
-std::array<float,2>{0.652054906f, 0.844737113f},
-std::array<float,2>{0.63139683f, 0.276439369f},
-std::array<float,2>{0.309783489f, 0.593250155f},
-std::array<float,2>{0.150630787f, 0.0696685761f},
-std::array<float,2>{0.751147509f, 0.842463374f},
-std::array<float,2>{0.899064243f, 0.167096853f},
-std::array<float,2>{0.0159042422f, 0.890234828f},
-std::array<float,2>{0.435063303f, 0.486464977f},
-std::array<float,2>{0.581307411f, 0.643131077f},
-std::array<float,2>{0.528416932f, 0.0265781451f},
-std::array<float,2>{0.472025365f, 0.782677352f},
-std::array<float,2>{0.0842387378f, 0.335790277f},
-std::array<float,2>{0.998218119f, 0.504942596f},
-std::array<float,2>{0.873588145f, 0.404598504f},
-std::array<float,2>{0.234287605f, 0.699319065f},
-std::array<float,2>{0.32322225f, 0.234721765f},
-std::array<float,2>{0.742549956f, 0.978019059f},
-std::array<float,2>{0.60663408f, 0.440485269f},
-std::array<float,2>{0.380843639f, 0.682191789f},
-std::array<float,2>{0.0556721315f, 0.130575523f},
-std::array<float,2>{0.911416888f, 0.929153144f},
-std::array<float,2>{0.803714871f, 0.117908135f},
-std::array<float,2>{0.168724552f, 0.865022242f},
-std::array<float,2>{0.27025038f, 0.299591333f},
-std::array<float,2>{0.677765846f, 0.608780503f},
-std::array<float,2>{0.690759063f, 0.193768695f},
-std::array<float,2>{0.370528191f, 0.959599376f},
-std::array<float,2>{0.18767181f, 0.428396791f},
-std::array<float,2>{0.841415942f, 0.74626714f},
-std::array<float,2>{0.942304254f, 0.368249089f},
-std::array<float,2>{0.0988035724f, 0.557223439f},
-std::array<float,2>{0.461327553f, 0.0402087793f},
-std::array<float,2>{0.543196976f, 0.771012485f},
-std::array<float,2>{0.61155045f, 0.366272181f},
-std::array<float,2>{0.393627733f, 0.549902916f},
-std::array<float,2>{0.0462843888f, 0.0388548896f},
-std::array<float,2>{0.925663054f, 0.779965103f},
-std::array<float,2>{0.791743457f, 0.198438615f},
-std::array<float,2>{0.178104937f, 0.967183828f},
-std::array<float,2>{0.264412582f, 0.434788197f},
-std::array<float,2>{0.656403422f, 0.741199374f},
-std::array<float,2>{0.714297891f, 0.113217376f},
-std::array<float,2>{0.346811682f, 0.872642398f},
-std::array<float,2>{0.211773381f, 0.310392022f},
-std::array<float,2>{0.819509566f, 0.596318483f},
-std::array<float,2>{0.958800554f, 0.44872123f},
-std::array<float,2>{0.110283688f, 0.679546297f},
-std::array<float,2>{0.450786442f, 0.138344005f},
-std::array<float,2>{0.551203012f, 0.932340622f},
-std::array<float,2>{0.653840959f, 0.392798185f},
-std::array<float,2>{0.295401275f, 0.691225588f},
-std::array<float,2>{0.135176614f, 0.243860394f},
-std::array<float,2>{0.772180974f, 0.975184262f},
-std::array<float,2>{0.879002929f, 0.0211318769f},
-std::array<float,2>{0.00575483823f, 0.790856361f},
-std::array<float,2>{0.416756511f, 0.341981709f},
-std::array<float,2>{0.571322143f, 0.51066184f},
-std::array<float,2>{0.506408095f, 0.161995903f},
-std::array<float,2>{0.486977488f, 0.880347788f},
-std::array<float,2>{0.06637346f, 0.49282068f},
-std::array<float,2>{0.983120978f, 0.655795455f},
-std::array<float,2>{0.844963849f, 0.270237923f},
-std::array<float,2>{0.2395432f, 0.583002567f},
-std::array<float,2>{0.330879569f, 0.0752626806f},
-std::array<float,2>{0.719975054f, 0.832764804f},
-std::array<float,2>{0.748552859f, 0.283177614f},
-std::array<float,2>{0.327256173f, 0.620755017f},
-std::array<float,2>{0.227109641f, 0.0990098864f},
-std::array<float,2>{0.869532883f, 0.852018893f},
-std::array<float,2>{0.994238436f, 0.151243031f},
-std::array<float,2>{0.0786225125f, 0.911370337f},
-std::array<float,2>{0.474079221f, 0.456622988f},
-std::array<float,2>{0.524924934f, 0.660768628f},
-std::array<float,2>{0.585631073f, 0.0537608825f},
-std::array<float,2>{0.431451559f, 0.763552427f},
-std::array<float,2>{0.021333525f, 0.350803316f},
-std::array<float,2>{0.903363764f, 0.532950222f},
-std::array<float,2>{0.75676465f, 0.418851852f},
-std::array<float,2>{0.154854298f, 0.731206834f},
-std::array<float,2>{0.304720402f, 0.204296067f},
-std::array<float,2>{0.62792176f, 0.943441033f},
-std::array<float,2>{0.542911351f, 0.481570989f},
-std::array<float,2>{0.467382222f, 0.638232648f},
-std::array<float,2>{0.0954848677f, 0.179887235f},
-std::array<float,2>{0.938690126f, 0.902435005f},
-std::array<float,2>{0.838877559f, 0.0821929947f},
-std::array<float,2>{0.193123147f, 0.815818906f},
-std::array<float,2>{0.371925861f, 0.251221925f},
-std::array<float,2>{0.692098379f, 0.57714349f},
-std::array<float,2>{0.674471319f, 0.232277587f},
-std::array<float,2>{0.266045511f, 0.997205138f},
-std::array<float,2>{0.165476128f, 0.386215597f},
-std::array<float,2>{0.797350407f, 0.712994695f},
-std::array<float,2>{0.909954846f, 0.319166064f},
-std::array<float,2>{0.0606084988f, 0.52709341f},
-std::array<float,2>{0.375165492f, 0.00672406331f},
-std::array<float,2>{0.601693153f, 0.807962239f},
-std::array<float,2>{0.516798198f, 0.257912457f},
-std::array<float,2>{0.47958672f, 0.56291163f},
-std::array<float,2>{0.0896732509f, 0.0864074081f},
-std::array<float,2>{0.988894701f, 0.823267519f},
-std::array<float,2>{0.861598611f, 0.173418462f},
-std::array<float,2>{0.225022018f, 0.896707296f},
-std::array<float,2>{0.314195484f, 0.476423204f},
-std::array<float,2>{0.737486243f, 0.631724119f},
-std::array<float,2>{0.637869775f, 0.0152373677f},
-std::array<float,2>{0.298032314f, 0.801223576f},
-std::array<float,2>{0.143793359f, 0.324973762f},
-std::array<float,2>{0.763738692f, 0.523162961f},
-std::array<float,2>{0.895665944f, 0.376880616f},
-std::array<float,2>{0.0268314444f, 0.710145772f},
-std::array<float,2>{0.427411139f, 0.225982368f},
-std::array<float,2>{0.590676248f, 0.988516688f},
-std::array<float,2>{0.69564122f, 0.461207867f},
-std::array<float,2>{0.362758398f, 0.666393518f},
-std::array<float,2>{0.200934708f, 0.141401246f},
-std::array<float,2>{0.828859687f, 0.920987129f},
-std::array<float,2>{0.950747073f, 0.102970913f},
-std::array<float,2>{0.106244206f, 0.8488096f},
-std::array<float,2>{0.456522763f, 0.293569714f},
-std::array<float,2>{0.532381654f, 0.615124881f},
-std::array<float,2>{0.598463893f, 0.212802902f},
-std::array<float,2>{0.388374001f, 0.950586855f},
-std::array<float,2>{0.0510330759f, 0.409541279f},
-std::array<float,2>{0.921861529f, 0.719341159f},
-std::array<float,2>{0.806588531f, 0.358368635f},
-std::array<float,2>{0.162856907f, 0.539769173f},
-std::array<float,2>{0.275068164f, 0.061735224f},
-std::array<float,2>{0.681930959f, 0.754751146f},
-std::array<float,2>{0.669576406f, 0.330983162f},
-std::array<float,2>{0.251910418f, 0.500926375f},
-std::array<float,2>{0.180186614f, 0.0296557359f},
-std::array<float,2>{0.785688221f, 0.788359642f},
-std::array<float,2>{0.936228931f, 0.241825238f},
-std::array<float,2>{0.0340722539f, 0.980875909f},
-std::array<float,2>{0.406082481f, 0.400676399f},
-std::array<float,2>{0.623959482f, 0.696541905f},
-std::array<float,2>{0.559161305f, 0.0656269044f},
-std::array<float,2>{0.43956989f, 0.836241424f},
-std::array<float,2>{0.119021356f, 0.281113714f},
-std::array<float,2>{0.961515725f, 0.588386655f},
-std::array<float,2>{0.827554226f, 0.488335401f},
-std::array<float,2>{0.206462368f, 0.645730853f},
-std::array<float,2>{0.357086807f, 0.171787307f},
-std::array<float,2>{0.70878166f, 0.883804739f},
-std::array<float,2>{0.569957256f, 0.422278464f},
-std::array<float,2>{0.408103645f, 0.74451828f},
-std::array<float,2>{0.0137202581f, 0.189659834f},
-std::array<float,2>{0.884015262f, 0.953647971f},
-std::array<float,2>{0.774995387f, 0.0437190123f},
-std::array<float,2>{0.126938075f, 0.768369913f},
-std::array<float,2>{0.282118648f, 0.372224361f},
-std::array<float,2>{0.641134918f, 0.5622558f},
-std::array<float,2>{0.732523084f, 0.12609452f},
-std::array<float,2>{0.342906535f, 0.922803462f},
-std::array<float,2>{0.247596815f, 0.442795336f},
-std::array<float,2>{0.853277743f, 0.684789598f},
-std::array<float,2>{0.972545564f, 0.30126527f},
-std::array<float,2>{0.0737346932f, 0.604335964f},
-std::array<float,2>{0.493726343f, 0.124379888f},
-std::array<float,2>{0.50802058f, 0.860684395f},
-std::array<float,2>{0.596022308f, 0.267392457f},
-std::array<float,2>{0.386474997f, 0.580977261f},
-std::array<float,2>{0.0506097749f, 0.0726284534f},
-std::array<float,2>{0.916089654f, 0.830265701f},
-std::array<float,2>{0.809059858f, 0.158912927f},
-std::array<float,2>{0.15753895f, 0.878721654f},
-std::array<float,2>{0.281062871f, 0.496976495f},
-std::array<float,2>{0.683787823f, 0.649567783f},
-std::array<float,2>{0.701938152f, 0.019403344f},
-std::array<float,2>{0.365398824f, 0.796091855f},
-std::array<float,2>{0.196634784f, 0.337435544f},
-std::array<float,2>{0.833050132f, 0.51548785f},
-std::array<float,2>{0.946005642f, 0.396307737f},
-std::array<float,2>{0.105429202f, 0.692848802f},
-std::array<float,2>{0.458199233f, 0.246950284f},
-std::array<float,2>{0.538094163f, 0.971079707f},
-std::array<float,2>{0.633058548f, 0.451605856f},
-std::array<float,2>{0.304178298f, 0.673513234f},
-std::array<float,2>{0.145477325f, 0.134338439f},
-std::array<float,2>{0.759475768f, 0.934489429f},
-std::array<float,2>{0.890782773f, 0.11513713f},
-std::array<float,2>{0.0277170837f, 0.868131697f},
-std::array<float,2>{0.423758715f, 0.304956734f},
-std::array<float,2>{0.589107692f, 0.600827277f},
-std::array<float,2>{0.521171391f, 0.200662598f},
-std::array<float,2>{0.482286006f, 0.963751435f},
-std::array<float,2>{0.0932891965f, 0.431921929f},
-std::array<float,2>{0.986483276f, 0.737587452f},
-std::array<float,2>{0.866568148f, 0.36079967f},
-std::array<float,2>{0.220531389f, 0.551793218f},
-std::array<float,2>{0.31836471f, 0.0323618315f},
-std::array<float,2>{0.74196738f, 0.776985586f},
-std::array<float,2>{0.727999687f, 0.314856678f},
-std::array<float,2>{0.337744653f, 0.529566109f},
-std::array<float,2>{0.244992748f, 0.00309794466f},
-std::array<float,2>{0.856692612f, 0.811898947f},
-std::array<float,2>{0.975813806f, 0.228560254f},
-std::array<float,2>{0.0763567761f, 0.99281621f},
-std::array<float,2>{0.499987274f, 0.390529245f},
-std::array<float,2>{0.514667749f, 0.718334734f},
-std::array<float,2>{0.563509166f, 0.0809463933f},
-std::array<float,2>{0.411579549f, 0.817830265f},
-std::array<float,2>{0.0109411925f, 0.257243931f},
-std::array<float,2>{0.889870346f, 0.572300613f},
-std::array<float,2>{0.780075788f, 0.477360338f},
-std::array<float,2>{0.129016668f, 0.635432482f},
-std::array<float,2>{0.287351638f, 0.18443118f},
-std::array<float,2>{0.646684229f, 0.901383936f},
-std::array<float,2>{0.555734813f, 0.415748507f},
-std::array<float,2>{0.443162292f, 0.726728082f},
-std::array<float,2>{0.122937806f, 0.210685059f},
-std::array<float,2>{0.966114819f, 0.93796587f},
-std::array<float,2>{0.8213287f, 0.047974702f},
-std::array<float,2>{0.209339663f, 0.760104001f},
-std::array<float,2>{0.353527337f, 0.344123155f},
-std::array<float,2>{0.704339504f, 0.537291825f},
-std::array<float,2>{0.664137244f, 0.154178232f},
-std::array<float,2>{0.255281895f, 0.906853318f},
-std::array<float,2>{0.184377104f, 0.459573835f},
-std::array<float,2>{0.782333732f, 0.657693923f},
-std::array<float,2>{0.931187034f, 0.288026005f},
-std::array<float,2>{0.0357560217f, 0.623325348f},
-std::array<float,2>{0.401520073f, 0.0963743553f},
-std::array<float,2>{0.619268298f, 0.85667783f},
-std::array<float,2>{0.502254367f, 0.353130519f},
-std::array<float,2>{0.488425136f, 0.543745518f},
-std::array<float,2>{0.0693122074f, 0.058313746f},
-std::array<float,2>{0.978410244f, 0.753859699f},
-std::array<float,2>{0.849121213f, 0.217251748f},
-std::array<float,2>{0.237394631f, 0.949153125f},
-std::array<float,2>{0.33555755f, 0.413096875f},
-std::array<float,2>{0.723307312f, 0.725403845f},
-std::array<float,2>{0.649025679f, 0.107754804f},
-std::array<float,2>{0.292558163f, 0.846449196f},
-std::array<float,2>{0.140275434f, 0.291782498f},
-std::array<float,2>{0.768622279f, 0.611405611f},
-std::array<float,2>{0.877401233f, 0.466404349f},
-std::array<float,2>{0.0022707209f, 0.670161247f},
-std::array<float,2>{0.4199844f, 0.147389039f},
-std::array<float,2>{0.577499568f, 0.91666311f},
-std::array<float,2>{0.717332006f, 0.381850362f},
-std::array<float,2>{0.350392222f, 0.706347406f},
-std::array<float,2>{0.215786964f, 0.221902043f},
-std::array<float,2>{0.814959764f, 0.986479163f},
-std::array<float,2>{0.955272734f, 0.0111483f},
-std::array<float,2>{0.114739999f, 0.799690902f},
-std::array<float,2>{0.446326226f, 0.322712183f},
-std::array<float,2>{0.550609648f, 0.516631007f},
-std::array<float,2>{0.613737524f, 0.177033558f},
-std::array<float,2>{0.394853085f, 0.893277466f},
-std::array<float,2>{0.0401051156f, 0.469741076f},
-std::array<float,2>{0.926325142f, 0.627079129f},
-std::array<float,2>{0.793161154f, 0.265584677f},
-std::array<float,2>{0.175130188f, 0.568031251f},
-std::array<float,2>{0.260495007f, 0.0904435217f},
-std::array<float,2>{0.66404593f, 0.826433718f},
-std::array<float,2>{0.676353514f, 0.297165275f},
-std::array<float,2>{0.272432923f, 0.6066553f},
-std::array<float,2>{0.170285001f, 0.119266279f},
-std::array<float,2>{0.80089587f, 0.86668396f},
-std::array<float,2>{0.912847817f, 0.132134601f},
-std::array<float,2>{0.0575270429f, 0.92712611f},
-std::array<float,2>{0.382659137f, 0.439010859f},
-std::array<float,2>{0.609126568f, 0.680566072f},
-std::array<float,2>{0.545833111f, 0.0420223027f},
-std::array<float,2>{0.463584363f, 0.772795558f},
-std::array<float,2>{0.0996901393f, 0.369187862f},
-std::array<float,2>{0.943891287f, 0.554980576f},
-std::array<float,2>{0.842175543f, 0.427678049f},
-std::array<float,2>{0.189930826f, 0.749552011f},
-std::array<float,2>{0.367406577f, 0.191432178f},
-std::array<float,2>{0.689114094f, 0.957494259f},
-std::array<float,2>{0.578266799f, 0.48455444f},
-std::array<float,2>{0.436894029f, 0.641879141f},
-std::array<float,2>{0.0177726392f, 0.164164662f},
-std::array<float,2>{0.90083015f, 0.88866353f},
-std::array<float,2>{0.752975881f, 0.0676710606f},
-std::array<float,2>{0.149839431f, 0.841131091f},
-std::array<float,2>{0.311559021f, 0.274915546f},
-std::array<float,2>{0.629038572f, 0.591302037f},
-std::array<float,2>{0.745137513f, 0.237127349f},
-std::array<float,2>{0.320953906f, 0.979533374f},
-std::array<float,2>{0.231769487f, 0.404062688f},
-std::array<float,2>{0.871878564f, 0.702884555f},
-std::array<float,2>{0.996550918f, 0.333951414f},
-std::array<float,2>{0.0827040151f, 0.507719994f},
-std::array<float,2>{0.469382197f, 0.0247907322f},
-std::array<float,2>{0.531144202f, 0.784573138f},
-std::array<float,2>{0.572638452f, 0.339990258f},
-std::array<float,2>{0.414498389f, 0.508442879f},
-std::array<float,2>{0.00634066155f, 0.0225978699f},
-std::array<float,2>{0.881037891f, 0.791658342f},
-std::array<float,2>{0.769599438f, 0.245170206f},
-std::array<float,2>{0.133764893f, 0.973390996f},
-std::array<float,2>{0.294708729f, 0.392291218f},
-std::array<float,2>{0.654895961f, 0.688076854f},
-std::array<float,2>{0.721991956f, 0.0778288916f},
-std::array<float,2>{0.328225404f, 0.834521532f},
-std::array<float,2>{0.241290912f, 0.271621138f},
-std::array<float,2>{0.846574605f, 0.58538723f},
-std::array<float,2>{0.981417835f, 0.495736659f},
-std::array<float,2>{0.0641493127f, 0.652746618f},
-std::array<float,2>{0.485287637f, 0.163803443f},
-std::array<float,2>{0.505500913f, 0.882083595f},
-std::array<float,2>{0.659613252f, 0.435771912f},
-std::array<float,2>{0.262897968f, 0.740200102f},
-std::array<float,2>{0.177369282f, 0.195709303f},
-std::array<float,2>{0.789686501f, 0.965151846f},
-std::array<float,2>{0.922134221f, 0.0361724868f},
-std::array<float,2>{0.044446934f, 0.778117716f},
-std::array<float,2>{0.391992778f, 0.364981353f},
-std::array<float,2>{0.610764682f, 0.547961414f},
-std::array<float,2>{0.553465784f, 0.138922647f},
-std::array<float,2>{0.452878982f, 0.93081212f},
-std::array<float,2>{0.113168217f, 0.446528226f},
-std::array<float,2>{0.960688233f, 0.675906241f},
-std::array<float,2>{0.817767918f, 0.310867518f},
-std::array<float,2>{0.213289946f, 0.594978631f},
-std::array<float,2>{0.344354957f, 0.109432749f},
-std::array<float,2>{0.711338162f, 0.87401551f},
-std::array<float,2>{0.694353938f, 0.252613157f},
-std::array<float,2>{0.374894738f, 0.575416803f},
-std::array<float,2>{0.19425264f, 0.0852781311f},
-std::array<float,2>{0.836135507f, 0.813254952f},
-std::array<float,2>{0.939619422f, 0.183527097f},
-std::array<float,2>{0.0958438143f, 0.905495286f},
-std::array<float,2>{0.465386719f, 0.483570218f},
-std::array<float,2>{0.540000021f, 0.640372217f},
-std::array<float,2>{0.603734314f, 0.00445434358f},
-std::array<float,2>{0.378315628f, 0.805935025f},
-std::array<float,2>{0.0600387044f, 0.317714006f},
-std::array<float,2>{0.906819582f, 0.525021851f},
-std::array<float,2>{0.800347388f, 0.384506375f},
-std::array<float,2>{0.16719532f, 0.712637424f},
-std::array<float,2>{0.268352181f, 0.233009428f},
-std::array<float,2>{0.673194289f, 0.998452723f},
-std::array<float,2>{0.526935637f, 0.453938633f},
-std::array<float,2>{0.475943267f, 0.66296643f},
-std::array<float,2>{0.0805900618f, 0.149015114f},
-std::array<float,2>{0.993626535f, 0.912531435f},
-std::array<float,2>{0.868063867f, 0.100373499f},
-std::array<float,2>{0.228838906f, 0.85540998f},
-std::array<float,2>{0.325776428f, 0.284866273f},
-std::array<float,2>{0.746727765f, 0.617360115f},
-std::array<float,2>{0.625642896f, 0.205672443f},
-std::array<float,2>{0.30773288f, 0.941718042f},
-std::array<float,2>{0.154293671f, 0.420855612f},
-std::array<float,2>{0.755773246f, 0.732980192f},
-std::array<float,2>{0.906246543f, 0.349069446f},
-std::array<float,2>{0.0223699827f, 0.533563018f},
-std::array<float,2>{0.431911588f, 0.0522557534f},
-std::array<float,2>{0.583636165f, 0.764851809f},
-std::array<float,2>{0.533818245f, 0.296733618f},
-std::array<float,2>{0.453635365f, 0.616160333f},
-std::array<float,2>{0.108922139f, 0.105274163f},
-std::array<float,2>{0.952959657f, 0.850813925f},
-std::array<float,2>{0.831317484f, 0.143709227f},
-std::array<float,2>{0.203106701f, 0.919163525f},
-std::array<float,2>{0.359623224f, 0.463743269f},
-std::array<float,2>{0.699130893f, 0.664650261f},
-std::array<float,2>{0.680076659f, 0.0593490228f},
-std::array<float,2>{0.277255476f, 0.757059634f},
-std::array<float,2>{0.161181062f, 0.356816053f},
-std::array<float,2>{0.806665242f, 0.541898012f},
-std::array<float,2>{0.919776738f, 0.406263262f},
-std::array<float,2>{0.0535992123f, 0.722433448f},
-std::array<float,2>{0.389233202f, 0.214217111f},
-std::array<float,2>{0.600908518f, 0.952612698f},
-std::array<float,2>{0.735181928f, 0.473985851f},
-std::array<float,2>{0.316205412f, 0.629153907f},
-std::array<float,2>{0.223654002f, 0.175480455f},
-std::array<float,2>{0.860111535f, 0.895441413f},
-std::array<float,2>{0.991470456f, 0.0883435607f},
-std::array<float,2>{0.0868820921f, 0.820932865f},
-std::array<float,2>{0.477440298f, 0.261253715f},
-std::array<float,2>{0.519483984f, 0.566125989f},
-std::array<float,2>{0.593346119f, 0.223423183f},
-std::array<float,2>{0.42960909f, 0.990528226f},
-std::array<float,2>{0.023711931f, 0.378512114f},
-std::array<float,2>{0.896647871f, 0.707129776f},
-std::array<float,2>{0.762340605f, 0.328107506f},
-std::array<float,2>{0.141418993f, 0.519851387f},
-std::array<float,2>{0.299039245f, 0.0120377224f},
-std::array<float,2>{0.639508784f, 0.804203689f},
-std::array<float,2>{0.644095004f, 0.373915166f},
-std::array<float,2>{0.284737408f, 0.559071481f},
-std::array<float,2>{0.128820509f, 0.0450101793f},
-std::array<float,2>{0.776651084f, 0.766497195f},
-std::array<float,2>{0.885036528f, 0.188633442f},
-std::array<float,2>{0.0123765096f, 0.955316603f},
-std::array<float,2>{0.410027295f, 0.42476961f},
-std::array<float,2>{0.566774607f, 0.743510902f},
-std::array<float,2>{0.510027766f, 0.123038217f},
-std::array<float,2>{0.494551599f, 0.862955689f},
-std::array<float,2>{0.0714085251f, 0.303795397f},
-std::array<float,2>{0.96960479f, 0.602278173f},
-std::array<float,2>{0.854839385f, 0.443535954f},
-std::array<float,2>{0.248193786f, 0.686565042f},
-std::array<float,2>{0.341127753f, 0.12807107f},
-std::array<float,2>{0.731374681f, 0.924918056f},
-std::array<float,2>{0.621406257f, 0.398820817f},
-std::array<float,2>{0.402789146f, 0.698031187f},
-std::array<float,2>{0.0314758718f, 0.239662126f},
-std::array<float,2>{0.935491621f, 0.982794285f},
-std::array<float,2>{0.787992179f, 0.0274702869f},
-std::array<float,2>{0.182455778f, 0.785171151f},
-std::array<float,2>{0.252856612f, 0.329762131f},
-std::array<float,2>{0.670976877f, 0.503612936f},
-std::array<float,2>{0.709925652f, 0.168895558f},
-std::array<float,2>{0.358359575f, 0.886349201f},
-std::array<float,2>{0.203515202f, 0.491732508f},
-std::array<float,2>{0.825044036f, 0.647129178f},
-std::array<float,2>{0.963828802f, 0.278411925f},
-std::array<float,2>{0.120182335f, 0.586365163f},
-std::array<float,2>{0.438408762f, 0.0629025176f},
-std::array<float,2>{0.560843945f, 0.839183807f},
-std::array<float,2>{0.608678818f, 0.298836559f},
-std::array<float,2>{0.382112712f, 0.609265447f},
-std::array<float,2>{0.0569057725f, 0.11740043f},
-std::array<float,2>{0.912516594f, 0.864437521f},
-std::array<float,2>{0.801549315f, 0.129916534f},
-std::array<float,2>{0.170894265f, 0.92945087f},
-std::array<float,2>{0.271743357f, 0.441350073f},
-std::array<float,2>{0.675830781f, 0.681712091f},
-std::array<float,2>{0.688731909f, 0.0409674533f},
-std::array<float,2>{0.368076235f, 0.770584583f},
-std::array<float,2>{0.190407693f, 0.368710607f},
-std::array<float,2>{0.842332959f, 0.556743264f},
-std::array<float,2>{0.943388104f, 0.427910924f},
-std::array<float,2>{0.100337744f, 0.746609449f},
-std::array<float,2>{0.462958962f, 0.19428207f},
-std::array<float,2>{0.54494077f, 0.959339619f},
-std::array<float,2>{0.629782915f, 0.486828655f},
-std::array<float,2>{0.312411964f, 0.642607749f},
-std::array<float,2>{0.149940178f, 0.167965695f},
-std::array<float,2>{0.753748238f, 0.889742255f},
-std::array<float,2>{0.900972426f, 0.0699384511f},
-std::array<float,2>{0.0181816779f, 0.841945767f},
-std::array<float,2>{0.437030017f, 0.277192891f},
-std::array<float,2>{0.578786194f, 0.593701482f},
-std::array<float,2>{0.530749619f, 0.234904289f},
-std::array<float,2>{0.468758404f, 0.978200734f},
-std::array<float,2>{0.0824387223f, 0.405103147f},
-std::array<float,2>{0.99661988f, 0.699997902f},
-std::array<float,2>{0.871308625f, 0.335247874f},
-std::array<float,2>{0.231938764f, 0.505634546f},
-std::array<float,2>{0.320518494f, 0.0270243771f},
-std::array<float,2>{0.745695055f, 0.782775819f},
-std::array<float,2>{0.723077297f, 0.354900986f},
-std::array<float,2>{0.335366189f, 0.546863854f},
-std::array<float,2>{0.237905651f, 0.0548211783f},
-std::array<float,2>{0.848748922f, 0.751593828f},
-std::array<float,2>{0.977789044f, 0.21670793f},
-std::array<float,2>{0.0683969408f, 0.945659399f},
-std::array<float,2>{0.489208341f, 0.411554694f},
-std::array<float,2>{0.502864182f, 0.722986996f},
-std::array<float,2>{0.577815115f, 0.106093854f},
-std::array<float,2>{0.420606107f, 0.845510721f},
-std::array<float,2>{0.00286389072f, 0.289836377f},
-std::array<float,2>{0.877910018f, 0.610843182f},
-std::array<float,2>{0.76925534f, 0.467293739f},
-std::array<float,2>{0.139972255f, 0.668610513f},
-std::array<float,2>{0.292382538f, 0.145416632f},
-std::array<float,2>{0.648850024f, 0.914595544f},
-std::array<float,2>{0.549823761f, 0.380010694f},
-std::array<float,2>{0.447047085f, 0.703813374f},
-std::array<float,2>{0.114884987f, 0.219952002f},
-std::array<float,2>{0.955780745f, 0.986082256f},
-std::array<float,2>{0.814671993f, 0.00863429531f},
-std::array<float,2>{0.215275243f, 0.797560453f},
-std::array<float,2>{0.349893242f, 0.321485937f},
-std::array<float,2>{0.71681881f, 0.518407047f},
-std::array<float,2>{0.663386047f, 0.178863451f},
-std::array<float,2>{0.260206133f, 0.892206669f},
-std::array<float,2>{0.175638929f, 0.471267015f},
-std::array<float,2>{0.793464065f, 0.626030385f},
-std::array<float,2>{0.926181436f, 0.262107819f},
-std::array<float,2>{0.0408102237f, 0.569022775f},
-std::array<float,2>{0.395350277f, 0.0931753367f},
-std::array<float,2>{0.614054799f, 0.825289249f},
-std::array<float,2>{0.5153023f, 0.312810987f},
-std::array<float,2>{0.499226153f, 0.529121757f},
-std::array<float,2>{0.0766736344f, 3.56332712e-05f},
-std::array<float,2>{0.976293683f, 0.809132516f},
-std::array<float,2>{0.857350051f, 0.22850807f},
-std::array<float,2>{0.24435164f, 0.994396567f},
-std::array<float,2>{0.337282211f, 0.387608469f},
-std::array<float,2>{0.728289902f, 0.716522634f},
-std::array<float,2>{0.647304535f, 0.0798139647f},
-std::array<float,2>{0.287780106f, 0.818548083f},
-std::array<float,2>{0.129727215f, 0.255320191f},
-std::array<float,2>{0.77964592f, 0.571673095f},
-std::array<float,2>{0.890309691f, 0.479707628f},
-std::array<float,2>{0.0112910913f, 0.634234071f},
-std::array<float,2>{0.411991715f, 0.186746836f},
-std::array<float,2>{0.564136147f, 0.899222553f},
-std::array<float,2>{0.704646349f, 0.417076558f},
-std::array<float,2>{0.354296148f, 0.730282426f},
-std::array<float,2>{0.209713638f, 0.207350418f},
-std::array<float,2>{0.821934044f, 0.939457297f},
-std::array<float,2>{0.966733754f, 0.0499270558f},
-std::array<float,2>{0.122550271f, 0.75972724f},
-std::array<float,2>{0.442754447f, 0.345790595f},
-std::array<float,2>{0.556361735f, 0.536798477f},
-std::array<float,2>{0.619652033f, 0.155031458f},
-std::array<float,2>{0.402269483f, 0.908227623f},
-std::array<float,2>{0.035382539f, 0.45805952f},
-std::array<float,2>{0.930834234f, 0.658715904f},
-std::array<float,2>{0.782892406f, 0.285943747f},
-std::array<float,2>{0.183958471f, 0.622487485f},
-std::array<float,2>{0.255608916f, 0.0950311273f},
-std::array<float,2>{0.664749503f, 0.857788503f},
-std::array<float,2>{0.684260368f, 0.267858893f},
-std::array<float,2>{0.280718029f, 0.578906775f},
-std::array<float,2>{0.157844067f, 0.0703760013f},
-std::array<float,2>{0.809516907f, 0.828776658f},
-std::array<float,2>{0.916848719f, 0.157433987f},
-std::array<float,2>{0.0500628911f, 0.876434088f},
-std::array<float,2>{0.385862082f, 0.498425871f},
-std::array<float,2>{0.596543968f, 0.650606155f},
-std::array<float,2>{0.539031088f, 0.0175679624f},
-std::array<float,2>{0.458798558f, 0.794326723f},
-std::array<float,2>{0.104858376f, 0.339172721f},
-std::array<float,2>{0.945492029f, 0.512115657f},
-std::array<float,2>{0.833593547f, 0.396507978f},
-std::array<float,2>{0.196999639f, 0.694247067f},
-std::array<float,2>{0.36584565f, 0.248886675f},
-std::array<float,2>{0.701286018f, 0.970134258f},
-std::array<float,2>{0.58956027f, 0.450904518f},
-std::array<float,2>{0.423033118f, 0.67516005f},
-std::array<float,2>{0.0279524736f, 0.13514252f},
-std::array<float,2>{0.891360223f, 0.936757445f},
-std::array<float,2>{0.758816361f, 0.116478316f},
-std::array<float,2>{0.144542471f, 0.869326472f},
-std::array<float,2>{0.304395586f, 0.307149023f},
-std::array<float,2>{0.633461356f, 0.59915787f},
-std::array<float,2>{0.741374493f, 0.203044251f},
-std::array<float,2>{0.319018841f, 0.960954249f},
-std::array<float,2>{0.220033154f, 0.430796862f},
-std::array<float,2>{0.866749406f, 0.735063553f},
-std::array<float,2>{0.987221777f, 0.363195121f},
-std::array<float,2>{0.0931782722f, 0.553798258f},
-std::array<float,2>{0.481841564f, 0.0332542434f},
-std::array<float,2>{0.520949721f, 0.773834705f},
-std::array<float,2>{0.567283034f, 0.372784108f},
-std::array<float,2>{0.409327626f, 0.561896026f},
-std::array<float,2>{0.012164901f, 0.0431954302f},
-std::array<float,2>{0.885525465f, 0.767815709f},
-std::array<float,2>{0.777014196f, 0.190217853f},
-std::array<float,2>{0.128076881f, 0.95318687f},
-std::array<float,2>{0.284441233f, 0.422544986f},
-std::array<float,2>{0.643861771f, 0.745004177f},
-std::array<float,2>{0.730718911f, 0.124921665f},
-std::array<float,2>{0.341744632f, 0.861020029f},
-std::array<float,2>{0.248706803f, 0.301321417f},
-std::array<float,2>{0.855191112f, 0.603538513f},
-std::array<float,2>{0.969223142f, 0.442917734f},
-std::array<float,2>{0.0719428062f, 0.685062408f},
-std::array<float,2>{0.494843543f, 0.126597911f},
-std::array<float,2>{0.510380089f, 0.922151506f},
-std::array<float,2>{0.671557248f, 0.400909513f},
-std::array<float,2>{0.252227366f, 0.69687891f},
-std::array<float,2>{0.182063952f, 0.241391435f},
-std::array<float,2>{0.787575603f, 0.981146753f},
-std::array<float,2>{0.934756637f, 0.0299563836f},
-std::array<float,2>{0.0322105512f, 0.788913667f},
-std::array<float,2>{0.40283829f, 0.330189019f},
-std::array<float,2>{0.621594787f, 0.500456214f},
-std::array<float,2>{0.561323106f, 0.170916051f},
-std::array<float,2>{0.437535852f, 0.884356081f},
-std::array<float,2>{0.121014141f, 0.489221632f},
-std::array<float,2>{0.963096559f, 0.646351635f},
-std::array<float,2>{0.824521303f, 0.280348659f},
-std::array<float,2>{0.203691587f, 0.588363528f},
-std::array<float,2>{0.35781309f, 0.0661910772f},
-std::array<float,2>{0.709101319f, 0.836687148f},
-std::array<float,2>{0.698450506f, 0.293153822f},
-std::array<float,2>{0.360303521f, 0.614306271f},
-std::array<float,2>{0.202272072f, 0.103485227f},
-std::array<float,2>{0.831621945f, 0.849295676f},
-std::array<float,2>{0.952342689f, 0.141058743f},
-std::array<float,2>{0.108862206f, 0.921858311f},
-std::array<float,2>{0.453543574f, 0.461503446f},
-std::array<float,2>{0.533609092f, 0.666755199f},
-std::array<float,2>{0.601526737f, 0.062452592f},
-std::array<float,2>{0.388766944f, 0.754242778f},
-std::array<float,2>{0.0531236045f, 0.357463151f},
-std::array<float,2>{0.91906321f, 0.539463818f},
-std::array<float,2>{0.807379961f, 0.409669131f},
-std::array<float,2>{0.161799729f, 0.718897521f},
-std::array<float,2>{0.276742548f, 0.212086976f},
-std::array<float,2>{0.680507839f, 0.950697303f},
-std::array<float,2>{0.518899679f, 0.475692064f},
-std::array<float,2>{0.477036804f, 0.631014168f},
-std::array<float,2>{0.0861090943f, 0.173140571f},
-std::array<float,2>{0.992058396f, 0.897440791f},
-std::array<float,2>{0.859430134f, 0.0868661329f},
-std::array<float,2>{0.224256814f, 0.823866189f},
-std::array<float,2>{0.315695941f, 0.258477956f},
-std::array<float,2>{0.73464483f, 0.563080609f},
-std::array<float,2>{0.638727307f, 0.226154417f},
-std::array<float,2>{0.299442798f, 0.989227176f},
-std::array<float,2>{0.140757725f, 0.376384765f},
-std::array<float,2>{0.762189925f, 0.710489988f},
-std::array<float,2>{0.897228122f, 0.324471354f},
-std::array<float,2>{0.024406381f, 0.52280575f},
-std::array<float,2>{0.429024935f, 0.0149489148f},
-std::array<float,2>{0.593103051f, 0.801588476f},
-std::array<float,2>{0.539317012f, 0.251595259f},
-std::array<float,2>{0.464896679f, 0.576322496f},
-std::array<float,2>{0.0962145329f, 0.0827289894f},
-std::array<float,2>{0.940069377f, 0.816022217f},
-std::array<float,2>{0.836521626f, 0.180207148f},
-std::array<float,2>{0.193602771f, 0.903175712f},
-std::array<float,2>{0.37415424f, 0.481965154f},
-std::array<float,2>{0.695286989f, 0.637765646f},
-std::array<float,2>{0.673393309f, 0.00621514767f},
-std::array<float,2>{0.267642021f, 0.808401167f},
-std::array<float,2>{0.167629927f, 0.318428099f},
-std::array<float,2>{0.800264895f, 0.526616693f},
-std::array<float,2>{0.906622231f, 0.386430502f},
-std::array<float,2>{0.0600586869f, 0.71352458f},
-std::array<float,2>{0.378708005f, 0.231902033f},
-std::array<float,2>{0.60440582f, 0.997769356f},
-std::array<float,2>{0.746282399f, 0.456217945f},
-std::array<float,2>{0.325642586f, 0.66037941f},
-std::array<float,2>{0.229016423f, 0.150784194f},
-std::array<float,2>{0.86761862f, 0.911996067f},
-std::array<float,2>{0.993858039f, 0.0992608443f},
-std::array<float,2>{0.080096297f, 0.852347612f},
-std::array<float,2>{0.476318359f, 0.282650888f},
-std::array<float,2>{0.526471257f, 0.620270431f},
-std::array<float,2>{0.583403707f, 0.204779863f},
-std::array<float,2>{0.432311654f, 0.943853498f},
-std::array<float,2>{0.0216902196f, 0.418003082f},
-std::array<float,2>{0.905340135f, 0.730520129f},
-std::array<float,2>{0.755047441f, 0.351131111f},
-std::array<float,2>{0.153646901f, 0.532508433f},
-std::array<float,2>{0.308255911f, 0.0543587878f},
-std::array<float,2>{0.625071406f, 0.763102889f},
-std::array<float,2>{0.654728532f, 0.342340976f},
-std::array<float,2>{0.293946117f, 0.510174394f},
-std::array<float,2>{0.133038372f, 0.020717958f},
-std::array<float,2>{0.770233989f, 0.79010123f},
-std::array<float,2>{0.881578863f, 0.243641257f},
-std::array<float,2>{0.00635818066f, 0.974913836f},
-std::array<float,2>{0.414899439f, 0.393095911f},
-std::array<float,2>{0.57289958f, 0.690863729f},
-std::array<float,2>{0.50532949f, 0.0760377944f},
-std::array<float,2>{0.484515667f, 0.832261145f},
-std::array<float,2>{0.0636316836f, 0.269852042f},
-std::array<float,2>{0.980540633f, 0.582423985f},
-std::array<float,2>{0.845963657f, 0.492426068f},
-std::array<float,2>{0.242103279f, 0.65569067f},
-std::array<float,2>{0.328704327f, 0.16159305f},
-std::array<float,2>{0.722521305f, 0.880373478f},
-std::array<float,2>{0.611059785f, 0.435078144f},
-std::array<float,2>{0.39210847f, 0.740566373f},
-std::array<float,2>{0.0443892777f, 0.199139699f},
-std::array<float,2>{0.92261821f, 0.967571378f},
-std::array<float,2>{0.78918767f, 0.0382234491f},
-std::array<float,2>{0.176795751f, 0.779687703f},
-std::array<float,2>{0.263563812f, 0.366850525f},
-std::array<float,2>{0.659982979f, 0.550623775f},
-std::array<float,2>{0.711735785f, 0.137894943f},
-std::array<float,2>{0.344055891f, 0.932053626f},
-std::array<float,2>{0.21376659f, 0.448757499f},
-std::array<float,2>{0.817955554f, 0.679081321f},
-std::array<float,2>{0.960265458f, 0.309877783f},
-std::array<float,2>{0.11249736f, 0.596134126f},
-std::array<float,2>{0.452267617f, 0.112747706f},
-std::array<float,2>{0.553139269f, 0.872148931f},
-std::array<float,2>{0.581997514f, 0.274726659f},
-std::array<float,2>{0.43465668f, 0.591555536f},
-std::array<float,2>{0.0164896548f, 0.068316713f},
-std::array<float,2>{0.898453951f, 0.841564655f},
-std::array<float,2>{0.751751542f, 0.164915696f},
-std::array<float,2>{0.151101872f, 0.887808323f},
-std::array<float,2>{0.310450375f, 0.484986335f},
-std::array<float,2>{0.631015897f, 0.642207921f},
-std::array<float,2>{0.742996216f, 0.0250997469f},
-std::array<float,2>{0.322462529f, 0.784714699f},
-std::array<float,2>{0.233671129f, 0.333141148f},
-std::array<float,2>{0.873392761f, 0.506854713f},
-std::array<float,2>{0.998978257f, 0.403502643f},
-std::array<float,2>{0.08457461f, 0.702364504f},
-std::array<float,2>{0.472354889f, 0.236531302f},
-std::array<float,2>{0.529210865f, 0.980005562f},
-std::array<float,2>{0.678251386f, 0.438476622f},
-std::array<float,2>{0.26988399f, 0.679926395f},
-std::array<float,2>{0.168423668f, 0.132361099f},
-std::array<float,2>{0.804482877f, 0.927708864f},
-std::array<float,2>{0.911806762f, 0.120044857f},
-std::array<float,2>{0.0565427765f, 0.86689949f},
-std::array<float,2>{0.380010486f, 0.297613055f},
-std::array<float,2>{0.607081771f, 0.607335985f},
-std::array<float,2>{0.543671668f, 0.191988066f},
-std::array<float,2>{0.461768419f, 0.957616568f},
-std::array<float,2>{0.0992917344f, 0.426877618f},
-std::array<float,2>{0.941619754f, 0.749471903f},
-std::array<float,2>{0.841082633f, 0.369732618f},
-std::array<float,2>{0.188124344f, 0.555369616f},
-std::array<float,2>{0.370911568f, 0.0426138937f},
-std::array<float,2>{0.691011488f, 0.773267269f},
-std::array<float,2>{0.715535283f, 0.322817683f},
-std::array<float,2>{0.349131018f, 0.517524302f},
-std::array<float,2>{0.218680814f, 0.0115056708f},
-std::array<float,2>{0.812500119f, 0.798865855f},
-std::array<float,2>{0.953636706f, 0.222377419f},
-std::array<float,2>{0.116420291f, 0.986871719f},
-std::array<float,2>{0.448967069f, 0.382680804f},
-std::array<float,2>{0.54754746f, 0.706780076f},
-std::array<float,2>{0.616451681f, 0.0900911465f},
-std::array<float,2>{0.397386342f, 0.826695085f},
-std::array<float,2>{0.0422876589f, 0.264773428f},
-std::array<float,2>{0.928722382f, 0.567667842f},
-std::array<float,2>{0.795955539f, 0.470372111f},
-std::array<float,2>{0.172295853f, 0.627736092f},
-std::array<float,2>{0.258001983f, 0.177366838f},
-std::array<float,2>{0.660230517f, 0.892599106f},
-std::array<float,2>{0.500682235f, 0.413574785f},
-std::array<float,2>{0.491798908f, 0.724957168f},
-std::array<float,2>{0.0669308826f, 0.217321515f},
-std::array<float,2>{0.979504466f, 0.948358238f},
-std::array<float,2>{0.850453377f, 0.0576296598f},
-std::array<float,2>{0.235354364f, 0.753211141f},
-std::array<float,2>{0.333692342f, 0.352948338f},
-std::array<float,2>{0.725212812f, 0.542996228f},
-std::array<float,2>{0.6514346f, 0.14678891f},
-std::array<float,2>{0.289861381f, 0.91625917f},
-std::array<float,2>{0.137226805f, 0.466206849f},
-std::array<float,2>{0.765911341f, 0.670868158f},
-std::array<float,2>{0.876031816f, 0.291282862f},
-std::array<float,2>{0.000698516553f, 0.61222589f},
-std::array<float,2>{0.417998165f, 0.108077817f},
-std::array<float,2>{0.575729549f, 0.84571445f},
-std::array<float,2>{0.557070732f, 0.344448f},
-std::array<float,2>{0.444067419f, 0.537634432f},
-std::array<float,2>{0.124544658f, 0.0485814698f},
-std::array<float,2>{0.967782676f, 0.760699451f},
-std::array<float,2>{0.824117243f, 0.210434467f},
-std::array<float,2>{0.207938164f, 0.938158929f},
-std::array<float,2>{0.352289975f, 0.415200472f},
-std::array<float,2>{0.705520272f, 0.727301717f},
-std::array<float,2>{0.66771704f, 0.0957244411f},
-std::array<float,2>{0.256438643f, 0.85711813f},
-std::array<float,2>{0.186832175f, 0.287317783f},
-std::array<float,2>{0.783242404f, 0.623918056f},
-std::array<float,2>{0.933407843f, 0.4594374f},
-std::array<float,2>{0.0375640132f, 0.657805681f},
-std::array<float,2>{0.398822039f, 0.153671429f},
-std::array<float,2>{0.618930459f, 0.906699955f},
-std::array<float,2>{0.729453087f, 0.38998735f},
-std::array<float,2>{0.339320004f, 0.717790008f},
-std::array<float,2>{0.24307622f, 0.229239941f},
-std::array<float,2>{0.857726395f, 0.992396295f},
-std::array<float,2>{0.974529207f, 0.00376301259f},
-std::array<float,2>{0.0744928271f, 0.812464178f},
-std::array<float,2>{0.49680832f, 0.315144032f},
-std::array<float,2>{0.51361835f, 0.529882073f},
-std::array<float,2>{0.5646891f, 0.183754787f},
-std::array<float,2>{0.412671536f, 0.901962399f},
-std::array<float,2>{0.00903273281f, 0.476577312f},
-std::array<float,2>{0.886719763f, 0.635062575f},
-std::array<float,2>{0.778350413f, 0.257412851f},
-std::array<float,2>{0.132548884f, 0.57314676f},
-std::array<float,2>{0.285501689f, 0.0803980678f},
-std::array<float,2>{0.645233035f, 0.818056643f},
-std::array<float,2>{0.635743618f, 0.305525929f},
-std::array<float,2>{0.300899297f, 0.60129559f},
-std::array<float,2>{0.146774977f, 0.114488751f},
-std::array<float,2>{0.760766327f, 0.867506385f},
-std::array<float,2>{0.892752528f, 0.134016633f},
-std::array<float,2>{0.0307365954f, 0.933824003f},
-std::array<float,2>{0.424467772f, 0.451747745f},
-std::array<float,2>{0.586901009f, 0.672853529f},
-std::array<float,2>{0.522029936f, 0.0330081545f},
-std::array<float,2>{0.483625978f, 0.776423216f},
-std::array<float,2>{0.0915914401f, 0.360843748f},
-std::array<float,2>{0.985690057f, 0.552451134f},
-std::array<float,2>{0.864370108f, 0.432473302f},
-std::array<float,2>{0.22098431f, 0.738203943f},
-std::array<float,2>{0.317735761f, 0.201102838f},
-std::array<float,2>{0.739149511f, 0.963157475f},
-std::array<float,2>{0.594884157f, 0.496342212f},
-std::array<float,2>{0.384584308f, 0.650361776f},
-std::array<float,2>{0.0471129529f, 0.158477485f},
-std::array<float,2>{0.915308654f, 0.878262222f},
-std::array<float,2>{0.811240971f, 0.072924763f},
-std::array<float,2>{0.159288526f, 0.830579758f},
-std::array<float,2>{0.279008746f, 0.266637087f},
-std::array<float,2>{0.686337531f, 0.580123186f},
-std::array<float,2>{0.69953388f, 0.246564791f},
-std::array<float,2>{0.363383621f, 0.971317828f},
-std::array<float,2>{0.198572487f, 0.395730227f},
-std::array<float,2>{0.834573686f, 0.693136752f},
-std::array<float,2>{0.948827565f, 0.337371945f},
-std::array<float,2>{0.10241577f, 0.515023649f},
-std::array<float,2>{0.459271908f, 0.0188456569f},
-std::array<float,2>{0.535156429f, 0.796395361f},
-std::array<float,2>{0.623163283f, 0.329393595f},
-std::array<float,2>{0.405431837f, 0.503411651f},
-std::array<float,2>{0.0332526155f, 0.0283031724f},
-std::array<float,2>{0.936023831f, 0.785873473f},
-std::array<float,2>{0.785229981f, 0.240013674f},
-std::array<float,2>{0.179760501f, 0.983265758f},
-std::array<float,2>{0.251209646f, 0.399298996f},
-std::array<float,2>{0.669313788f, 0.697394133f},
-std::array<float,2>{0.708432019f, 0.0632263571f},
-std::array<float,2>{0.356593132f, 0.839591742f},
-std::array<float,2>{0.206803724f, 0.279018283f},
-std::array<float,2>{0.827895582f, 0.586783886f},
-std::array<float,2>{0.961419046f, 0.491224498f},
-std::array<float,2>{0.118608423f, 0.646519244f},
-std::array<float,2>{0.440348864f, 0.167973354f},
-std::array<float,2>{0.558715701f, 0.885765731f},
-std::array<float,2>{0.640673518f, 0.423936725f},
-std::array<float,2>{0.281578362f, 0.743758261f},
-std::array<float,2>{0.126022711f, 0.189086556f},
-std::array<float,2>{0.774462342f, 0.955909371f},
-std::array<float,2>{0.884551823f, 0.0457150005f},
-std::array<float,2>{0.0146317435f, 0.765652359f},
-std::array<float,2>{0.40759477f, 0.373484164f},
-std::array<float,2>{0.569356918f, 0.559298337f},
-std::array<float,2>{0.508425355f, 0.128527462f},
-std::array<float,2>{0.493364125f, 0.925652683f},
-std::array<float,2>{0.0737122819f, 0.444010913f},
-std::array<float,2>{0.971753776f, 0.687070787f},
-std::array<float,2>{0.852762401f, 0.304445595f},
-std::array<float,2>{0.247271717f, 0.601774633f},
-std::array<float,2>{0.343723476f, 0.122171f},
-std::array<float,2>{0.733190894f, 0.862713456f},
-std::array<float,2>{0.73799479f, 0.261044979f},
-std::array<float,2>{0.31375131f, 0.565602839f},
-std::array<float,2>{0.225403234f, 0.0888547897f},
-std::array<float,2>{0.862060845f, 0.820669532f},
-std::array<float,2>{0.988341391f, 0.175176203f},
-std::array<float,2>{0.0889875144f, 0.894704282f},
-std::array<float,2>{0.480163902f, 0.47416997f},
-std::array<float,2>{0.517131805f, 0.629686415f},
-std::array<float,2>{0.590219736f, 0.0124295019f},
-std::array<float,2>{0.427200526f, 0.803746164f},
-std::array<float,2>{0.0270409454f, 0.327165484f},
-std::array<float,2>{0.89639622f, 0.520400584f},
-std::array<float,2>{0.764490902f, 0.378120124f},
-std::array<float,2>{0.14413473f, 0.707872927f},
-std::array<float,2>{0.298715115f, 0.222787097f},
-std::array<float,2>{0.638246059f, 0.991045058f},
-std::array<float,2>{0.533120096f, 0.46322003f},
-std::array<float,2>{0.456577361f, 0.664453924f},
-std::array<float,2>{0.105673142f, 0.144095317f},
-std::array<float,2>{0.950583518f, 0.919663429f},
-std::array<float,2>{0.82824415f, 0.104591198f},
-std::array<float,2>{0.200280219f, 0.851366937f},
-std::array<float,2>{0.362985164f, 0.2963337f},
-std::array<float,2>{0.69602406f, 0.61569047f},
-std::array<float,2>{0.682486951f, 0.21465911f},
-std::array<float,2>{0.274657667f, 0.953025639f},
-std::array<float,2>{0.16243811f, 0.407168448f},
-std::array<float,2>{0.806072652f, 0.722149491f},
-std::array<float,2>{0.921297669f, 0.357097715f},
-std::array<float,2>{0.0517393984f, 0.54127425f},
-std::array<float,2>{0.387789756f, 0.0586699434f},
-std::array<float,2>{0.597820342f, 0.757714629f},
-std::array<float,2>{0.524764419f, 0.284394413f},
-std::array<float,2>{0.474273115f, 0.617768347f},
-std::array<float,2>{0.0785419866f, 0.0999590307f},
-std::array<float,2>{0.99467808f, 0.854601204f},
-std::array<float,2>{0.869888186f, 0.148751676f},
-std::array<float,2>{0.226623803f, 0.912956774f},
-std::array<float,2>{0.32767117f, 0.453276187f},
-std::array<float,2>{0.74832952f, 0.662465394f},
-std::array<float,2>{0.62714386f, 0.0522225425f},
-std::array<float,2>{0.305632085f, 0.765357494f},
-std::array<float,2>{0.154622838f, 0.349169701f},
-std::array<float,2>{0.75631088f, 0.533981144f},
-std::array<float,2>{0.904063582f, 0.420350552f},
-std::array<float,2>{0.0205797199f, 0.73252672f},
-std::array<float,2>{0.430707961f, 0.205482855f},
-std::array<float,2>{0.585239649f, 0.941903114f},
-std::array<float,2>{0.691643596f, 0.484107673f},
-std::array<float,2>{0.371139109f, 0.639853954f},
-std::array<float,2>{0.192528859f, 0.182639048f},
-std::array<float,2>{0.839498043f, 0.905898213f},
-std::array<float,2>{0.939140558f, 0.0854998976f},
-std::array<float,2>{0.0949321166f, 0.812900126f},
-std::array<float,2>{0.466960996f, 0.251967818f},
-std::array<float,2>{0.542436302f, 0.576102674f},
-std::array<float,2>{0.602402508f, 0.232609078f},
-std::array<float,2>{0.375759125f, 0.998994768f},
-std::array<float,2>{0.0613879599f, 0.383861333f},
-std::array<float,2>{0.90958035f, 0.712024391f},
-std::array<float,2>{0.797466218f, 0.318058372f},
-std::array<float,2>{0.165604189f, 0.524478197f},
-std::array<float,2>{0.266242594f, 0.00433144113f},
-std::array<float,2>{0.67420882f, 0.806534946f},
-std::array<float,2>{0.656827927f, 0.36434865f},
-std::array<float,2>{0.263844699f, 0.54864341f},
-std::array<float,2>{0.178279191f, 0.0369994976f},
-std::array<float,2>{0.79148078f, 0.777572811f},
-std::array<float,2>{0.925244927f, 0.19624567f},
-std::array<float,2>{0.0466005094f, 0.965361416f},
-std::array<float,2>{0.394120783f, 0.436314821f},
-std::array<float,2>{0.612097204f, 0.73949188f},
-std::array<float,2>{0.551587641f, 0.110057861f},
-std::array<float,2>{0.450481474f, 0.87351054f},
-std::array<float,2>{0.109603941f, 0.311389863f},
-std::array<float,2>{0.958378792f, 0.595522344f},
-std::array<float,2>{0.819868267f, 0.447018325f},
-std::array<float,2>{0.210968435f, 0.676282823f},
-std::array<float,2>{0.347284973f, 0.139277667f},
-std::array<float,2>{0.714659512f, 0.931518257f},
-std::array<float,2>{0.572067201f, 0.391928256f},
-std::array<float,2>{0.416418344f, 0.687780559f},
-std::array<float,2>{0.00517887343f, 0.246021166f},
-std::array<float,2>{0.879747748f, 0.972861707f},
-std::array<float,2>{0.771490216f, 0.0230629276f},
-std::array<float,2>{0.135732397f, 0.791342318f},
-std::array<float,2>{0.295881242f, 0.340421915f},
-std::array<float,2>{0.65377152f, 0.508045793f},
-std::array<float,2>{0.720488191f, 0.163442165f},
-std::array<float,2>{0.330272466f, 0.882416725f},
-std::array<float,2>{0.239855498f, 0.49548921f},
-std::array<float,2>{0.845582426f, 0.653067052f},
-std::array<float,2>{0.982733071f, 0.272006959f},
-std::array<float,2>{0.0655193478f, 0.5856148f},
-std::array<float,2>{0.48648119f, 0.0773228928f},
-std::array<float,2>{0.505937219f, 0.83406806f},
-std::array<float,2>{0.574627101f, 0.290500522f},
-std::array<float,2>{0.419171214f, 0.609531462f},
-std::array<float,2>{0.00104556687f, 0.106955044f},
-std::array<float,2>{0.875338733f, 0.844425499f},
-std::array<float,2>{0.767016649f, 0.145839408f},
-std::array<float,2>{0.13811405f, 0.915495634f},
-std::array<float,2>{0.290748775f, 0.468105078f},
-std::array<float,2>{0.650538623f, 0.669547617f},
-std::array<float,2>{0.726343393f, 0.056341067f},
-std::array<float,2>{0.332209021f, 0.750339329f},
-std::array<float,2>{0.235139385f, 0.354258269f},
-std::array<float,2>{0.850966632f, 0.544958711f},
-std::array<float,2>{0.979324102f, 0.410847276f},
-std::array<float,2>{0.0676507503f, 0.724606514f},
-std::array<float,2>{0.49051398f, 0.215783149f},
-std::array<float,2>{0.501496851f, 0.946601093f},
-std::array<float,2>{0.661331832f, 0.47176832f},
-std::array<float,2>{0.259427398f, 0.625782609f},
-std::array<float,2>{0.173096403f, 0.178055033f},
-std::array<float,2>{0.795379281f, 0.890685499f},
-std::array<float,2>{0.927922785f, 0.0918952525f},
-std::array<float,2>{0.041562587f, 0.824799895f},
-std::array<float,2>{0.397571981f, 0.262739956f},
-std::array<float,2>{0.615272164f, 0.569339931f},
-std::array<float,2>{0.54865694f, 0.218895018f},
-std::array<float,2>{0.447336882f, 0.985115826f},
-std::array<float,2>{0.1155077f, 0.379741549f},
-std::array<float,2>{0.954583883f, 0.704344213f},
-std::array<float,2>{0.814271033f, 0.321108997f},
-std::array<float,2>{0.217469424f, 0.519255459f},
-std::array<float,2>{0.348281592f, 0.00915470347f},
-std::array<float,2>{0.716706455f, 0.798147142f},
-std::array<float,2>{0.690171182f, 0.367793322f},
-std::array<float,2>{0.369576782f, 0.557709873f},
-std::array<float,2>{0.188481584f, 0.0390713103f},
-std::array<float,2>{0.840678453f, 0.770271838f},
-std::array<float,2>{0.942845345f, 0.194847494f},
-std::array<float,2>{0.0978353024f, 0.960621774f},
-std::array<float,2>{0.46288076f, 0.428981602f},
-std::array<float,2>{0.544507802f, 0.747127831f},
-std::array<float,2>{0.606069922f, 0.118867651f},
-std::array<float,2>{0.379399419f, 0.863465428f},
-std::array<float,2>{0.0548685789f, 0.300161868f},
-std::array<float,2>{0.910801709f, 0.607437551f},
-std::array<float,2>{0.803078711f, 0.439498007f},
-std::array<float,2>{0.169579014f, 0.682815909f},
-std::array<float,2>{0.270705432f, 0.129498795f},
-std::array<float,2>{0.679436862f, 0.928421497f},
-std::array<float,2>{0.527532995f, 0.405553102f},
-std::array<float,2>{0.471420467f, 0.700633407f},
-std::array<float,2>{0.0858552605f, 0.236098364f},
-std::array<float,2>{0.99918133f, 0.976896644f},
-std::array<float,2>{0.874679506f, 0.0259385835f},
-std::array<float,2>{0.232907414f, 0.782133937f},
-std::array<float,2>{0.323380142f, 0.334888846f},
-std::array<float,2>{0.744125664f, 0.504083455f},
-std::array<float,2>{0.632659316f, 0.166314095f},
-std::array<float,2>{0.308606595f, 0.889632821f},
-std::array<float,2>{0.15171352f, 0.487335265f},
-std::array<float,2>{0.750789404f, 0.644298732f},
-std::array<float,2>{0.900055647f, 0.275822848f},
-std::array<float,2>{0.0171512384f, 0.59214884f},
-std::array<float,2>{0.433731854f, 0.0689948499f},
-std::array<float,2>{0.580484331f, 0.843732297f},
-std::array<float,2>{0.536453784f, 0.338073969f},
-std::array<float,2>{0.46034044f, 0.513084471f},
-std::array<float,2>{0.103207015f, 0.0156674422f},
-std::array<float,2>{0.947420835f, 0.793249905f},
-std::array<float,2>{0.835160136f, 0.24953492f},
-std::array<float,2>{0.198155805f, 0.969438076f},
-std::array<float,2>{0.364862114f, 0.398129165f},
-std::array<float,2>{0.700689733f, 0.695096493f},
-std::array<float,2>{0.68677038f, 0.0717545301f},
-std::array<float,2>{0.278314799f, 0.82966572f},
-std::array<float,2>{0.158833385f, 0.268895149f},
-std::array<float,2>{0.811543763f, 0.579988301f},
-std::array<float,2>{0.914665282f, 0.499269456f},
-std::array<float,2>{0.0482257679f, 0.651989579f},
-std::array<float,2>{0.382838249f, 0.157061026f},
-std::array<float,2>{0.593779445f, 0.875793219f},
-std::array<float,2>{0.739929557f, 0.430309176f},
-std::array<float,2>{0.317266911f, 0.735971928f},
-std::array<float,2>{0.221864119f, 0.20160906f},
-std::array<float,2>{0.864149868f, 0.962776959f},
-std::array<float,2>{0.985322714f, 0.0342991352f},
-std::array<float,2>{0.0898443535f, 0.774837971f},
-std::array<float,2>{0.482892781f, 0.361880511f},
-std::array<float,2>{0.523160756f, 0.553318143f},
-std::array<float,2>{0.587173223f, 0.135836989f},
-std::array<float,2>{0.425305337f, 0.935727179f},
-std::array<float,2>{0.0295026768f, 0.450083137f},
-std::array<float,2>{0.894325733f, 0.674092472f},
-std::array<float,2>{0.760579288f, 0.30824542f},
-std::array<float,2>{0.148035631f, 0.597904086f},
-std::array<float,2>{0.302217841f, 0.115555122f},
-std::array<float,2>{0.635201097f, 0.870616674f},
-std::array<float,2>{0.646399558f, 0.254354119f},
-std::array<float,2>{0.286495328f, 0.571288466f},
-std::array<float,2>{0.131323919f, 0.0784472972f},
-std::array<float,2>{0.77776432f, 0.82014823f},
-std::array<float,2>{0.887880683f, 0.186068088f},
-std::array<float,2>{0.00832180399f, 0.899477124f},
-std::array<float,2>{0.413632721f, 0.479480535f},
-std::array<float,2>{0.565785944f, 0.633550525f},
-std::array<float,2>{0.512410402f, 0.00150142633f},
-std::array<float,2>{0.497201562f, 0.810167134f},
-std::array<float,2>{0.0759086534f, 0.313926041f},
-std::array<float,2>{0.97293514f, 0.528022289f},
-std::array<float,2>{0.85849297f, 0.388069242f},
-std::array<float,2>{0.243881449f, 0.715323865f},
-std::array<float,2>{0.337919682f, 0.227242187f},
-std::array<float,2>{0.729567468f, 0.995656848f},
-std::array<float,2>{0.618133128f, 0.457067341f},
-std::array<float,2>{0.399882466f, 0.659314752f},
-std::array<float,2>{0.038975466f, 0.155316174f},
-std::array<float,2>{0.932306707f, 0.909673274f},
-std::array<float,2>{0.785041153f, 0.0939370766f},
-std::array<float,2>{0.185920611f, 0.859171748f},
-std::array<float,2>{0.257034749f, 0.286766618f},
-std::array<float,2>{0.666131318f, 0.621213198f},
-std::array<float,2>{0.706655979f, 0.208452374f},
-std::array<float,2>{0.352547407f, 0.94133991f},
-std::array<float,2>{0.20872809f, 0.416631937f},
-std::array<float,2>{0.822595298f, 0.729190528f},
-std::array<float,2>{0.967433929f, 0.347156376f},
-std::array<float,2>{0.123075999f, 0.536057949f},
-std::array<float,2>{0.444546908f, 0.0490322523f},
-std::array<float,2>{0.558264852f, 0.757846236f},
-std::array<float,2>{0.59915477f, 0.359161526f},
-std::array<float,2>{0.386768967f, 0.540103555f},
-std::array<float,2>{0.0520452522f, 0.0614766963f},
-std::array<float,2>{0.920595884f, 0.755543292f},
-std::array<float,2>{0.805187106f, 0.210969388f},
-std::array<float,2>{0.163185626f, 0.949885249f},
-std::array<float,2>{0.273981899f, 0.409057021f},
-std::array<float,2>{0.682870865f, 0.720161974f},
-std::array<float,2>{0.696404696f, 0.102526389f},
-std::array<float,2>{0.362028986f, 0.848250508f},
-std::array<float,2>{0.199318171f, 0.294663697f},
-std::array<float,2>{0.829202235f, 0.613588929f},
-std::array<float,2>{0.949726284f, 0.462540001f},
-std::array<float,2>{0.106501102f, 0.667741656f},
-std::array<float,2>{0.455533713f, 0.142218918f},
-std::array<float,2>{0.532048583f, 0.920283437f},
-std::array<float,2>{0.637693703f, 0.375630438f},
-std::array<float,2>{0.297063708f, 0.709481955f},
-std::array<float,2>{0.143301994f, 0.225492656f},
-std::array<float,2>{0.764880657f, 0.989462614f},
-std::array<float,2>{0.894753754f, 0.0142935617f},
-std::array<float,2>{0.0258951113f, 0.802719295f},
-std::array<float,2>{0.426179022f, 0.326170474f},
-std::array<float,2>{0.591355681f, 0.522289336f},
-std::array<float,2>{0.516282916f, 0.172420025f},
-std::array<float,2>{0.478596956f, 0.897873163f},
-std::array<float,2>{0.0883944631f, 0.475096494f},
-std::array<float,2>{0.990059972f, 0.632161975f},
-std::array<float,2>{0.862809539f, 0.259430826f},
-std::array<float,2>{0.22622326f, 0.563699841f},
-std::array<float,2>{0.312538028f, 0.0878431946f},
-std::array<float,2>{0.73718375f, 0.823054075f},
-std::array<float,2>{0.734285533f, 0.302391827f},
-std::array<float,2>{0.341841519f, 0.604829729f},
-std::array<float,2>{0.246777147f, 0.123641722f},
-std::array<float,2>{0.851928115f, 0.859731793f},
-std::array<float,2>{0.971201479f, 0.125802279f},
-std::array<float,2>{0.07242015f, 0.923602283f},
-std::array<float,2>{0.492358536f, 0.441705137f},
-std::array<float,2>{0.509395003f, 0.684284747f},
-std::array<float,2>{0.568403184f, 0.0443840474f},
-std::array<float,2>{0.407087803f, 0.769524872f},
-std::array<float,2>{0.0150970239f, 0.371158153f},
-std::array<float,2>{0.883127868f, 0.561322033f},
-std::array<float,2>{0.774330497f, 0.422931641f},
-std::array<float,2>{0.125592947f, 0.745362163f},
-std::array<float,2>{0.282922804f, 0.191389725f},
-std::array<float,2>{0.642023563f, 0.954857647f},
-std::array<float,2>{0.560525954f, 0.489926368f},
-std::array<float,2>{0.440684885f, 0.645279527f},
-std::array<float,2>{0.117291063f, 0.170756295f},
-std::array<float,2>{0.962425232f, 0.883409083f},
-std::array<float,2>{0.82703346f, 0.0649098307f},
-std::array<float,2>{0.205107078f, 0.837138295f},
-std::array<float,2>{0.355590224f, 0.27973938f},
-std::array<float,2>{0.707556367f, 0.589057744f},
-std::array<float,2>{0.668786943f, 0.24106957f},
-std::array<float,2>{0.250100255f, 0.982069016f},
-std::array<float,2>{0.18111527f, 0.402173072f},
-std::array<float,2>{0.78668046f, 0.695587575f},
-std::array<float,2>{0.936712623f, 0.331383258f},
-std::array<float,2>{0.0350366421f, 0.500985682f},
-std::array<float,2>{0.404926181f, 0.0303206164f},
-std::array<float,2>{0.624627411f, 0.78775388f},
-std::array<float,2>{0.507747829f, 0.271062762f},
-std::array<float,2>{0.488107294f, 0.58358711f},
-std::array<float,2>{0.0645549223f, 0.0743018687f},
-std::array<float,2>{0.983979821f, 0.833559752f},
-std::array<float,2>{0.844494402f, 0.16080451f},
-std::array<float,2>{0.23874341f, 0.878931403f},
-std::array<float,2>{0.331307322f, 0.494001687f},
-std::array<float,2>{0.718802691f, 0.654320002f},
-std::array<float,2>{0.65238446f, 0.0199891198f},
-std::array<float,2>{0.29618454f, 0.789895892f},
-std::array<float,2>{0.136489198f, 0.343468517f},
-std::array<float,2>{0.773338735f, 0.510919094f},
-std::array<float,2>{0.880596876f, 0.394388646f},
-std::array<float,2>{0.00404262589f, 0.689712882f},
-std::array<float,2>{0.417382449f, 0.24226068f},
-std::array<float,2>{0.571015298f, 0.976308286f},
-std::array<float,2>{0.713605165f, 0.448010176f},
-std::array<float,2>{0.345846593f, 0.678489923f},
-std::array<float,2>{0.212690324f, 0.137069046f},
-std::array<float,2>{0.81884259f, 0.933050454f},
-std::array<float,2>{0.957762063f, 0.111459382f},
-std::array<float,2>{0.110733509f, 0.871480107f},
-std::array<float,2>{0.449515194f, 0.309548974f},
-std::array<float,2>{0.552426636f, 0.596916258f},
-std::array<float,2>{0.612965584f, 0.197817057f},
-std::array<float,2>{0.39282608f, 0.968033433f},
-std::array<float,2>{0.0450532734f, 0.434346259f},
-std::array<float,2>{0.924565732f, 0.742097437f},
-std::array<float,2>{0.792867303f, 0.365248054f},
-std::array<float,2>{0.178947106f, 0.549137414f},
-std::array<float,2>{0.265172541f, 0.0380811244f},
-std::array<float,2>{0.658013225f, 0.780430496f},
-std::array<float,2>{0.674972296f, 0.32022962f},
-std::array<float,2>{0.26745525f, 0.526343286f},
-std::array<float,2>{0.164634168f, 0.00703141699f},
-std::array<float,2>{0.798450172f, 0.806822598f},
-std::array<float,2>{0.908733726f, 0.230971217f},
-std::array<float,2>{0.0620974749f, 0.996231794f},
-std::array<float,2>{0.376745582f, 0.384969234f},
-std::array<float,2>{0.602705717f, 0.714342833f},
-std::array<float,2>{0.541864336f, 0.0834397078f},
-std::array<float,2>{0.468309671f, 0.815262794f},
-std::array<float,2>{0.0946780518f, 0.250708342f},
-std::array<float,2>{0.938063383f, 0.577184379f},
-std::array<float,2>{0.838708341f, 0.481185257f},
-std::array<float,2>{0.191694483f, 0.637444794f},
-std::array<float,2>{0.372144252f, 0.18106243f},
-std::array<float,2>{0.69315362f, 0.904024541f},
-std::array<float,2>{0.584255755f, 0.419511944f},
-std::array<float,2>{0.430617362f, 0.731851876f},
-std::array<float,2>{0.0198440962f, 0.203992382f},
-std::array<float,2>{0.902468562f, 0.944794476f},
-std::array<float,2>{0.757803261f, 0.0534513146f},
-std::array<float,2>{0.155376717f, 0.762099922f},
-std::array<float,2>{0.306524813f, 0.350575477f},
-std::array<float,2>{0.628070951f, 0.53184557f},
-std::array<float,2>{0.749460816f, 0.151565015f},
-std::array<float,2>{0.326631695f, 0.910298049f},
-std::array<float,2>{0.228098914f, 0.456010789f},
-std::array<float,2>{0.870759845f, 0.661678672f},
-std::array<float,2>{0.995549798f, 0.282224894f},
-std::array<float,2>{0.0791619048f, 0.619373441f},
-std::array<float,2>{0.4729698f, 0.0978683084f},
-std::array<float,2>{0.524253488f, 0.853279233f},
-std::array<float,2>{0.61459136f, 0.264232665f},
-std::array<float,2>{0.396257281f, 0.566776693f},
-std::array<float,2>{0.0394908004f, 0.0913582072f},
-std::array<float,2>{0.927153766f, 0.8278265f},
-std::array<float,2>{0.794637799f, 0.1767333f},
-std::array<float,2>{0.174009427f, 0.893798292f},
-std::array<float,2>{0.261659473f, 0.469594985f},
-std::array<float,2>{0.66251725f, 0.62804985f},
-std::array<float,2>{0.718010426f, 0.0105043966f},
-std::array<float,2>{0.350862682f, 0.800381005f},
-std::array<float,2>{0.216568887f, 0.323634624f},
-std::array<float,2>{0.81599021f, 0.516392231f},
-std::array<float,2>{0.956184983f, 0.381359667f},
-std::array<float,2>{0.113614529f, 0.705430031f},
-std::array<float,2>{0.445470691f, 0.22157982f},
-std::array<float,2>{0.549085557f, 0.987585008f},
-std::array<float,2>{0.649646401f, 0.465483129f},
-std::array<float,2>{0.29195115f, 0.671481967f},
-std::array<float,2>{0.13873218f, 0.148318484f},
-std::array<float,2>{0.768144608f, 0.91726023f},
-std::array<float,2>{0.878171682f, 0.108778201f},
-std::array<float,2>{0.00309734372f, 0.846899331f},
-std::array<float,2>{0.421352684f, 0.292800158f},
-std::array<float,2>{0.576655149f, 0.612390876f},
-std::array<float,2>{0.503211617f, 0.218320578f},
-std::array<float,2>{0.490225554f, 0.947961032f},
-std::array<float,2>{0.0701526254f, 0.412976325f},
-std::array<float,2>{0.977196336f, 0.726339281f},
-std::array<float,2>{0.848515451f, 0.352487266f},
-std::array<float,2>{0.236977696f, 0.544458985f},
-std::array<float,2>{0.334867269f, 0.0572794899f},
-std::array<float,2>{0.723925829f, 0.75232929f},
-std::array<float,2>{0.744245887f, 0.332639009f},
-std::array<float,2>{0.321459979f, 0.506337821f},
-std::array<float,2>{0.2309113f, 0.0239941515f},
-std::array<float,2>{0.872214973f, 0.783456683f},
-std::array<float,2>{0.997900724f, 0.237805799f},
-std::array<float,2>{0.0839065388f, 0.978956044f},
-std::array<float,2>{0.470151961f, 0.402763695f},
-std::array<float,2>{0.529773235f, 0.701522291f},
-std::array<float,2>{0.579459012f, 0.066977106f},
-std::array<float,2>{0.435767174f, 0.840756655f},
-std::array<float,2>{0.019480627f, 0.274191171f},
-std::array<float,2>{0.902053118f, 0.590454876f},
-std::array<float,2>{0.752656102f, 0.486170769f},
-std::array<float,2>{0.148499042f, 0.640810132f},
-std::array<float,2>{0.310823262f, 0.165660113f},
-std::array<float,2>{0.630737245f, 0.886743784f},
-std::array<float,2>{0.546074033f, 0.426653326f},
-std::array<float,2>{0.463910162f, 0.748123407f},
-std::array<float,2>{0.100996047f, 0.192814499f},
-std::array<float,2>{0.945280135f, 0.95872879f},
-std::array<float,2>{0.843265176f, 0.0418177918f},
-std::array<float,2>{0.190853268f, 0.772396386f},
-std::array<float,2>{0.368573278f, 0.370758235f},
-std::array<float,2>{0.687668204f, 0.556217611f},
-std::array<float,2>{0.676971018f, 0.131009489f},
-std::array<float,2>{0.27341345f, 0.926086068f},
-std::array<float,2>{0.171324879f, 0.437974632f},
-std::array<float,2>{0.802275419f, 0.680683911f},
-std::array<float,2>{0.914028704f, 0.29882136f},
-std::array<float,2>{0.0585122854f, 0.606167197f},
-std::array<float,2>{0.381136715f, 0.120423004f},
-std::array<float,2>{0.608340919f, 0.866162419f},
-std::array<float,2>{0.520220935f, 0.359561086f},
-std::array<float,2>{0.481186867f, 0.551551342f},
-std::array<float,2>{0.0920675546f, 0.0322155282f},
-std::array<float,2>{0.987321436f, 0.776281118f},
-std::array<float,2>{0.865414083f, 0.199808866f},
-std::array<float,2>{0.219328091f, 0.964117348f},
-std::array<float,2>{0.319345415f, 0.433580041f},
-std::array<float,2>{0.740375102f, 0.736598909f},
-std::array<float,2>{0.634643018f, 0.113859378f},
-std::array<float,2>{0.302859217f, 0.869076073f},
-std::array<float,2>{0.146455392f, 0.306023002f},
-std::array<float,2>{0.757975042f, 0.600520313f},
-std::array<float,2>{0.891973853f, 0.452376276f},
-std::array<float,2>{0.0284966473f, 0.672828972f},
-std::array<float,2>{0.422537446f, 0.133505255f},
-std::array<float,2>{0.588035345f, 0.934670985f},
-std::array<float,2>{0.7023592f, 0.394628733f},
-std::array<float,2>{0.366909593f, 0.691725075f},
-std::array<float,2>{0.19613567f, 0.247605711f},
-std::array<float,2>{0.832365394f, 0.97203815f},
-std::array<float,2>{0.946527243f, 0.0176012758f},
-std::array<float,2>{0.104397915f, 0.795160711f},
-std::array<float,2>{0.457433224f, 0.336055219f},
-std::array<float,2>{0.537191749f, 0.514340818f},
-std::array<float,2>{0.59745872f, 0.160038829f},
-std::array<float,2>{0.385113329f, 0.877591491f},
-std::array<float,2>{0.0495226718f, 0.49718076f},
-std::array<float,2>{0.917292714f, 0.648532867f},
-std::array<float,2>{0.809953034f, 0.266454786f},
-std::array<float,2>{0.157082424f, 0.581210256f},
-std::array<float,2>{0.280009478f, 0.0735161602f},
-std::array<float,2>{0.684743524f, 0.831598461f},
-std::array<float,2>{0.6658777f, 0.28833437f},
-std::array<float,2>{0.254430175f, 0.624305069f},
-std::array<float,2>{0.185196891f, 0.0971162245f},
-std::array<float,2>{0.781519532f, 0.85556525f},
-std::array<float,2>{0.929965734f, 0.152546048f},
-std::array<float,2>{0.0362581797f, 0.90742892f},
-std::array<float,2>{0.40129146f, 0.460182667f},
-std::array<float,2>{0.620652199f, 0.65682435f},
-std::array<float,2>{0.555081189f, 0.0472970791f},
-std::array<float,2>{0.442063302f, 0.761028945f},
-std::array<float,2>{0.12202961f, 0.34553504f},
-std::array<float,2>{0.965416849f, 0.538905561f},
-std::array<float,2>{0.82102406f, 0.414670795f},
-std::array<float,2>{0.210567236f, 0.727967739f},
-std::array<float,2>{0.355019391f, 0.209867433f},
-std::array<float,2>{0.70349431f, 0.938587725f},
-std::array<float,2>{0.563068509f, 0.478103459f},
-std::array<float,2>{0.410954148f, 0.636214614f},
-std::array<float,2>{0.0102602364f, 0.185473785f},
-std::array<float,2>{0.888729632f, 0.900476992f},
-std::array<float,2>{0.780623794f, 0.0818434507f},
-std::array<float,2>{0.13014023f, 0.816409707f},
-std::array<float,2>{0.28839016f, 0.256098151f},
-std::array<float,2>{0.647791088f, 0.57410109f},
-std::array<float,2>{0.72730875f, 0.229973987f},
-std::array<float,2>{0.336221814f, 0.993657529f},
-std::array<float,2>{0.245718226f, 0.38881433f},
-std::array<float,2>{0.855864644f, 0.717580795f},
-std::array<float,2>{0.97504741f, 0.316206485f},
-std::array<float,2>{0.0775047392f, 0.53100425f},
-std::array<float,2>{0.498073071f, 0.00236848812f},
-std::array<float,2>{0.513811707f, 0.810615301f},
-std::array<float,2>{0.591944456f, 0.326675385f},
-std::array<float,2>{0.428086668f, 0.5213148f},
-std::array<float,2>{0.0252131019f, 0.013568379f},
-std::array<float,2>{0.898366749f, 0.802800894f},
-std::array<float,2>{0.763471425f, 0.224254116f},
-std::array<float,2>{0.141693056f, 0.99157387f},
-std::array<float,2>{0.299841017f, 0.377296269f},
-std::array<float,2>{0.63970834f, 0.708665431f},
-std::array<float,2>{0.736223459f, 0.0896824002f},
-std::array<float,2>{0.314490914f, 0.821580827f},
-std::array<float,2>{0.223466411f, 0.260727942f},
-std::array<float,2>{0.860502422f, 0.564860046f},
-std::array<float,2>{0.990680277f, 0.473441154f},
-std::array<float,2>{0.0877779201f, 0.630097032f},
-std::array<float,2>{0.478370517f, 0.174140155f},
-std::array<float,2>{0.518321514f, 0.895969748f},
-std::array<float,2>{0.68133682f, 0.407635629f},
-std::array<float,2>{0.276105583f, 0.72160995f},
-std::array<float,2>{0.160254166f, 0.213448986f},
-std::array<float,2>{0.808480978f, 0.951350152f},
-std::array<float,2>{0.918772876f, 0.0597526953f},
-std::array<float,2>{0.0537719913f, 0.756140232f},
-std::array<float,2>{0.390408397f, 0.35601455f},
-std::array<float,2>{0.599814892f, 0.542705715f},
-std::array<float,2>{0.534194052f, 0.143435538f},
-std::array<float,2>{0.454636544f, 0.918237269f},
-std::array<float,2>{0.107478157f, 0.464641422f},
-std::array<float,2>{0.951313257f, 0.665741384f},
-std::array<float,2>{0.830289006f, 0.29551211f},
-std::array<float,2>{0.201999977f, 0.61705029f},
-std::array<float,2>{0.361028105f, 0.10435418f},
-std::array<float,2>{0.697339237f, 0.850485146f},
-std::array<float,2>{0.710820913f, 0.277935535f},
-std::array<float,2>{0.359198213f, 0.587242723f},
-std::array<float,2>{0.204413429f, 0.0643924326f},
-std::array<float,2>{0.825528264f, 0.838339627f},
-std::array<float,2>{0.964440525f, 0.169380113f},
-std::array<float,2>{0.119625643f, 0.88559109f},
-std::array<float,2>{0.439364523f, 0.490727514f},
-std::array<float,2>{0.562167883f, 0.648272634f},
-std::array<float,2>{0.622308969f, 0.0291291643f},
-std::array<float,2>{0.403643459f, 0.786421537f},
-std::array<float,2>{0.0328071639f, 0.328508794f},
-std::array<float,2>{0.934391439f, 0.502812922f},
-std::array<float,2>{0.788682103f, 0.400297433f},
-std::array<float,2>{0.18336679f, 0.69824791f},
-std::array<float,2>{0.253355682f, 0.238813713f},
-std::array<float,2>{0.670846045f, 0.983638227f},
-std::array<float,2>{0.510915935f, 0.445128232f},
-std::array<float,2>{0.495772123f, 0.686513662f},
-std::array<float,2>{0.0711696893f, 0.127687484f},
-std::array<float,2>{0.970387816f, 0.924640656f},
-std::array<float,2>{0.854294062f, 0.121725991f},
-std::array<float,2>{0.249551103f, 0.862236202f},
-std::array<float,2>{0.340500146f, 0.303530276f},
-std::array<float,2>{0.731745124f, 0.603077054f},
-std::array<float,2>{0.642992675f, 0.188458338f},
-std::array<float,2>{0.283285648f, 0.956595123f},
-std::array<float,2>{0.127612188f, 0.424975574f},
-std::array<float,2>{0.775983572f, 0.742876112f},
-std::array<float,2>{0.88611567f, 0.37419197f},
-std::array<float,2>{0.013519749f, 0.559720576f},
-std::array<float,2>{0.408935785f, 0.0466877148f},
-std::array<float,2>{0.567995787f, 0.767217457f},
-std::array<float,2>{0.553922355f, 0.312175959f},
-std::array<float,2>{0.451989442f, 0.594438076f},
-std::array<float,2>{0.111927621f, 0.110792167f},
-std::array<float,2>{0.959078074f, 0.874023914f},
-std::array<float,2>{0.816584527f, 0.140191212f},
-std::array<float,2>{0.214234307f, 0.93046397f},
-std::array<float,2>{0.345115155f, 0.446230978f},
-std::array<float,2>{0.712307692f, 0.677400112f},
-std::array<float,2>{0.658272624f, 0.0360646695f},
-std::array<float,2>{0.262198955f, 0.778875113f},
-std::array<float,2>{0.176331937f, 0.364189297f},
-std::array<float,2>{0.790964544f, 0.547632515f},
-std::array<float,2>{0.923188508f, 0.437026024f},
-std::array<float,2>{0.0433087461f, 0.738426387f},
-std::array<float,2>{0.390824288f, 0.19674857f},
-std::array<float,2>{0.61002332f, 0.966674089f},
-std::array<float,2>{0.720920324f, 0.494189769f},
-std::array<float,2>{0.329478264f, 0.653810501f},
-std::array<float,2>{0.240477577f, 0.162682816f},
-std::array<float,2>{0.847059846f, 0.881485045f},
-std::array<float,2>{0.981803834f, 0.0769201741f},
-std::array<float,2>{0.0630454421f, 0.83498174f},
-std::array<float,2>{0.485969126f, 0.272482097f},
-std::array<float,2>{0.504578233f, 0.584142923f},
-std::array<float,2>{0.573648512f, 0.244279042f},
-std::array<float,2>{0.415591091f, 0.974325538f},
-std::array<float,2>{0.00719293207f, 0.391410172f},
-std::array<float,2>{0.882474422f, 0.688523352f},
-std::array<float,2>{0.770818293f, 0.340878636f},
-std::array<float,2>{0.133991182f, 0.50927788f},
-std::array<float,2>{0.293618232f, 0.0216642953f},
-std::array<float,2>{0.656059802f, 0.792257309f},
-std::array<float,2>{0.626086414f, 0.34798494f},
-std::array<float,2>{0.306661576f, 0.534594834f},
-std::array<float,2>{0.153058082f, 0.0509538129f},
-std::array<float,2>{0.754746616f, 0.764629781f},
-std::array<float,2>{0.904826581f, 0.206955582f},
-std::array<float,2>{0.0225943513f, 0.942554891f},
-std::array<float,2>{0.433187246f, 0.42163524f},
-std::array<float,2>{0.582839906f, 0.733523786f},
-std::array<float,2>{0.526210368f, 0.100818455f},
-std::array<float,2>{0.475129277f, 0.854277611f},
-std::array<float,2>{0.0819605961f, 0.283266664f},
-std::array<float,2>{0.992634714f, 0.618721128f},
-std::array<float,2>{0.868903041f, 0.454627275f},
-std::array<float,2>{0.230366498f, 0.66313684f},
-std::array<float,2>{0.324331671f, 0.150187612f},
-std::array<float,2>{0.747710168f, 0.913224339f},
-std::array<float,2>{0.605151176f, 0.382963747f},
-std::array<float,2>{0.377569288f, 0.711022973f},
-std::array<float,2>{0.0590338483f, 0.233795509f},
-std::array<float,2>{0.907310665f, 0.999948204f},
-std::array<float,2>{0.799603581f, 0.00576080009f},
-std::array<float,2>{0.166469619f, 0.805291831f},
-std::array<float,2>{0.269277602f, 0.316539794f},
-std::array<float,2>{0.672522545f, 0.524229705f},
-std::array<float,2>{0.694178522f, 0.182002917f},
-std::array<float,2>{0.373726279f, 0.904559791f},
-std::array<float,2>{0.194766983f, 0.482922882f},
-std::array<float,2>{0.83769846f, 0.639109254f},
-std::array<float,2>{0.941154778f, 0.253886223f},
-std::array<float,2>{0.0971133411f, 0.574334025f},
-std::array<float,2>{0.465985328f, 0.0849093497f},
-std::array<float,2>{0.540575922f, 0.813477039f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.315611839f, 0.695851564f},
-std::array<float,2>{0.540072143f, 0.24650085f},
-std::array<float,2>{0.944339871f, 0.925380409f},
-std::array<float,2>{0.0538076051f, 0.439877182f},
-std::array<float,2>{0.211007193f, 0.795395136f},
-std::array<float,2>{0.847762585f, 0.305942327f},
-std::array<float,2>{0.631346166f, 0.539737463f},
-std::array<float,2>{0.41741249f, 0.0359339714f},
-std::array<float,2>{0.0782838017f, 0.587983012f},
-std::array<float,2>{0.926598251f, 0.069193162f},
-std::array<float,2>{0.593049407f, 0.846305311f},
-std::array<float,2>{0.279641837f, 0.330456913f},
-std::array<float,2>{0.474376231f, 0.999936879f},
-std::array<float,2>{0.732162476f, 0.384617239f},
-std::array<float,2>{0.771315336f, 0.628961921f},
-std::array<float,2>{0.170332342f, 0.130133197f},
-std::array<float,2>{0.386894137f, 0.503804386f},
-std::array<float,2>{0.67865634f, 0.0181018338f},
-std::array<float,2>{0.830108881f, 0.760687768f},
-std::array<float,2>{0.237527922f, 0.277506024f},
-std::array<float,2>{0.0135623477f, 0.892968357f},
-std::array<float,2>{0.991262674f, 0.483867407f},
-std::array<float,2>{0.530286431f, 0.726031423f},
-std::array<float,2>{0.343846709f, 0.207964316f},
-std::array<float,2>{0.147127196f, 0.682442009f},
-std::array<float,2>{0.803107917f, 0.180188552f},
-std::array<float,2>{0.698953569f, 0.94939065f},
-std::array<float,2>{0.439262092f, 0.419829667f},
-std::array<float,2>{0.298777312f, 0.813070536f},
-std::array<float,2>{0.59919703f, 0.344545245f},
-std::array<float,2>{0.890672684f, 0.622432709f},
-std::array<float,2>{0.0999137089f, 0.114294991f},
-std::array<float,2>{0.261638463f, 0.603539288f},
-std::array<float,2>{0.562901616f, 0.105563618f},
-std::array<float,2>{0.907262444f, 0.839538217f},
-std::array<float,2>{0.0754893199f, 0.363870025f},
-std::array<float,2>{0.177717f, 0.95358336f},
-std::array<float,2>{0.75453341f, 0.426061541f},
-std::array<float,2>{0.739176393f, 0.667707741f},
-std::array<float,2>{0.498819649f, 0.1665259f},
-std::array<float,2>{0.0397504345f, 0.742272377f},
-std::array<float,2>{0.967497468f, 0.200379729f},
-std::array<float,2>{0.551382303f, 0.886942983f},
-std::array<float,2>{0.339121401f, 0.491687924f},
-std::array<float,2>{0.431261808f, 0.767626345f},
-std::array<float,2>{0.655791879f, 0.25971368f},
-std::array<float,2>{0.868437231f, 0.518093705f},
-std::array<float,2>{0.201266587f, 0.0109915882f},
-std::array<float,2>{0.458596349f, 0.644290745f},
-std::array<float,2>{0.707244694f, 0.144082323f},
-std::array<float,2>{0.786734343f, 0.977657974f},
-std::array<float,2>{0.129863694f, 0.396179497f},
-std::array<float,2>{0.114033483f, 0.860739052f},
-std::array<float,2>{0.885069907f, 0.323906541f},
-std::array<float,2>{0.620760143f, 0.573423922f},
-std::array<float,2>{0.288684815f, 0.0822207928f},
-std::array<float,2>{0.220582783f, 0.560796499f},
-std::array<float,2>{0.81316793f, 0.0481296368f},
-std::array<float,2>{0.661375344f, 0.8069489f},
-std::array<float,2>{0.40160358f, 0.284741789f},
-std::array<float,2>{0.374132812f, 0.917632937f},
-std::array<float,2>{0.515078962f, 0.466374755f},
-std::array<float,2>{0.968952417f, 0.713739634f},
-std::array<float,2>{0.0210714284f, 0.221077576f},
-std::array<float,2>{0.296250463f, 0.656464517f},
-std::array<float,2>{0.615436494f, 0.15639098f},
-std::array<float,2>{0.879483581f, 0.967853427f},
-std::array<float,2>{0.118346974f, 0.437029034f},
-std::array<float,2>{0.1360697f, 0.835850656f},
-std::array<float,2>{0.790320575f, 0.368411779f},
-std::array<float,2>{0.712221086f, 0.599194288f},
-std::array<float,2>{0.461529434f, 0.0974940956f},
-std::array<float,2>{0.0259573497f, 0.531020045f},
-std::array<float,2>{0.977914453f, 0.00383781153f},
-std::array<float,2>{0.505576193f, 0.777163506f},
-std::array<float,2>{0.359796971f, 0.256657004f},
-std::array<float,2>{0.393995225f, 0.87963146f},
-std::array<float,2>{0.671739399f, 0.495108306f},
-std::array<float,2>{0.821698248f, 0.740121067f},
-std::array<float,2>{0.226792082f, 0.193878919f},
-std::array<float,2>{0.485602975f, 0.564112127f},
-std::array<float,2>{0.744507074f, 0.0928256363f},
-std::array<float,2>{0.761691093f, 0.870136082f},
-std::array<float,2>{0.180336356f, 0.316881388f},
-std::array<float,2>{0.0690264925f, 0.973640859f},
-std::array<float,2>{0.916399777f, 0.399729311f},
-std::array<float,2>{0.577427566f, 0.652387738f},
-std::array<float,2>{0.250308156f, 0.154419392f},
-std::array<float,2>{0.18797344f, 0.707685351f},
-std::array<float,2>{0.863719046f, 0.234110221f},
-std::array<float,2>{0.645592451f, 0.914056718f},
-std::array<float,2>{0.428074628f, 0.455326259f},
-std::array<float,2>{0.335056096f, 0.801637471f},
-std::array<float,2>{0.554733038f, 0.295033097f},
-std::array<float,2>{0.957091928f, 0.552282512f},
-std::array<float,2>{0.0318668671f, 0.0592903346f},
-std::array<float,2>{0.355110347f, 0.538582146f},
-std::array<float,2>{0.520217657f, 0.0467088409f},
-std::array<float,2>{0.992521346f, 0.788884699f},
-std::array<float,2>{0.00638248445f, 0.297177881f},
-std::array<float,2>{0.249621585f, 0.93090117f},
-std::array<float,2>{0.839321733f, 0.447706074f},
-std::array<float,2>{0.683809519f, 0.691677094f},
-std::array<float,2>{0.378810465f, 0.23885712f},
-std::array<float,2>{0.106501423f, 0.635721743f},
-std::array<float,2>{0.903865576f, 0.133335218f},
-std::array<float,2>{0.606907785f, 0.986343861f},
-std::array<float,2>{0.308648854f, 0.382747412f},
-std::array<float,2>{0.451230586f, 0.852402985f},
-std::array<float,2>{0.689808726f, 0.340157211f},
-std::array<float,2>{0.805946589f, 0.585113943f},
-std::array<float,2>{0.151366994f, 0.0719286874f},
-std::array<float,2>{0.409063369f, 0.728436828f},
-std::array<float,2>{0.636430562f, 0.218225703f},
-std::array<float,2>{0.852746367f, 0.903418303f},
-std::array<float,2>{0.20362328f, 0.469274938f},
-std::array<float,2>{0.0594272725f, 0.754075944f},
-std::array<float,2>{0.947154403f, 0.271877795f},
-std::array<float,2>{0.534694254f, 0.511813998f},
-std::array<float,2>{0.322924763f, 0.0258727092f},
-std::array<float,2>{0.162548006f, 0.615219116f},
-std::array<float,2>{0.780119896f, 0.118613958f},
-std::array<float,2>{0.720215499f, 0.823082983f},
-std::array<float,2>{0.478777856f, 0.353037655f},
-std::array<float,2>{0.270516604f, 0.938386798f},
-std::array<float,2>{0.582314014f, 0.407373548f},
-std::array<float,2>{0.933606923f, 0.672822893f},
-std::array<float,2>{0.0936616808f, 0.176712885f},
-std::array<float,2>{0.274256498f, 0.736314595f},
-std::array<float,2>{0.586277783f, 0.191299483f},
-std::array<float,2>{0.921923041f, 0.87641561f},
-std::array<float,2>{0.084138833f, 0.497875094f},
-std::array<float,2>{0.167180881f, 0.778691947f},
-std::array<float,2>{0.766492724f, 0.252881974f},
-std::array<float,2>{0.72689563f, 0.526608467f},
-std::array<float,2>{0.468960792f, 0.00492784008f},
-std::array<float,2>{0.0474162474f, 0.596655548f},
-std::array<float,2>{0.939736485f, 0.100752905f},
-std::array<float,2>{0.543307662f, 0.831881642f},
-std::array<float,2>{0.317400783f, 0.371753633f},
-std::array<float,2>{0.419209838f, 0.962989032f},
-std::array<float,2>{0.626242042f, 0.432930768f},
-std::array<float,2>{0.844363451f, 0.66093111f},
-std::array<float,2>{0.215807423f, 0.160649151f},
-std::array<float,2>{0.443914831f, 0.550229728f},
-std::array<float,2>{0.69998306f, 0.0565957353f},
-std::array<float,2>{0.796889603f, 0.79726994f},
-std::array<float,2>{0.143046483f, 0.290676117f},
-std::array<float,2>{0.0950537622f, 0.90704751f},
-std::array<float,2>{0.895321488f, 0.457951665f},
-std::array<float,2>{0.597496629f, 0.7054649f},
-std::array<float,2>{0.303700626f, 0.22686924f},
-std::array<float,2>{0.238414988f, 0.648586512f},
-std::array<float,2>{0.83536762f, 0.149862483f},
-std::array<float,2>{0.674954832f, 0.969194591f},
-std::array<float,2>{0.383361429f, 0.402999729f},
-std::array<float,2>{0.347828537f, 0.874649704f},
-std::array<float,2>{0.525814831f, 0.314811021f},
-std::array<float,2>{0.984582961f, 0.568327248f},
-std::array<float,2>{0.00936215837f, 0.0883299783f},
-std::array<float,2>{0.340419769f, 0.578399122f},
-std::array<float,2>{0.54877907f, 0.0768707246f},
-std::array<float,2>{0.964700997f, 0.857412517f},
-std::array<float,2>{0.0437303483f, 0.338190317f},
-std::array<float,2>{0.197240293f, 0.990342796f},
-std::array<float,2>{0.872161627f, 0.375711352f},
-std::array<float,2>{0.652008116f, 0.638305008f},
-std::array<float,2>{0.437437087f, 0.140568182f},
-std::array<float,2>{0.0717554688f, 0.687987089f},
-std::array<float,2>{0.910313845f, 0.238099962f},
-std::array<float,2>{0.56687516f, 0.93710506f},
-std::array<float,2>{0.263224483f, 0.450882912f},
-std::array<float,2>{0.494624227f, 0.783158004f},
-std::array<float,2>{0.735068858f, 0.302518159f},
-std::array<float,2>{0.750272214f, 0.533806264f},
-std::array<float,2>{0.174212113f, 0.0415300205f},
-std::array<float,2>{0.404100776f, 0.675911367f},
-std::array<float,2>{0.658482552f, 0.173269793f},
-std::array<float,2>{0.816720426f, 0.94424361f},
-std::array<float,2>{0.2250572f, 0.41168505f},
-std::array<float,2>{0.0193475839f, 0.826582193f},
-std::array<float,2>{0.972885132f, 0.357222885f},
-std::array<float,2>{0.511665583f, 0.609645545f},
-std::array<float,2>{0.368151784f, 0.121386588f},
-std::array<float,2>{0.126848355f, 0.510642111f},
-std::array<float,2>{0.784389794f, 0.0296649318f},
-std::array<float,2>{0.703426242f, 0.752263188f},
-std::array<float,2>{0.456075698f, 0.266467512f},
-std::array<float,2>{0.282777369f, 0.899672806f},
-std::array<float,2>{0.624285817f, 0.475227475f},
-std::array<float,2>{0.890217662f, 0.732788086f},
-std::array<float,2>{0.111617997f, 0.214091644f},
-std::array<float,2>{0.365742475f, 0.626655936f},
-std::array<float,2>{0.501240253f, 0.126281098f},
-std::array<float,2>{0.980753064f, 0.995987415f},
-std::array<float,2>{0.0284627937f, 0.390282869f},
-std::array<float,2>{0.233464763f, 0.850741148f},
-std::array<float,2>{0.827570498f, 0.335021615f},
-std::array<float,2>{0.665012896f, 0.59232682f},
-std::array<float,2>{0.397284567f, 0.0655027777f},
-std::array<float,2>{0.123925671f, 0.545195997f},
-std::array<float,2>{0.878385484f, 0.0349396728f},
-std::array<float,2>{0.61074239f, 0.792349756f},
-std::array<float,2>{0.290059447f, 0.308687657f},
-std::array<float,2>{0.467400044f, 0.928980708f},
-std::array<float,2>{0.717657089f, 0.443641633f},
-std::array<float,2>{0.794801354f, 0.701245546f},
-std::array<float,2>{0.138927564f, 0.245905995f},
-std::array<float,2>{0.423253566f, 0.620658994f},
-std::array<float,2>{0.644002438f, 0.110521689f},
-std::array<float,2>{0.861886144f, 0.818375468f},
-std::array<float,2>{0.191565394f, 0.349376351f},
-std::array<float,2>{0.038697321f, 0.948380768f},
-std::array<float,2>{0.955669045f, 0.415326267f},
-std::array<float,2>{0.562207937f, 0.686763048f},
-std::array<float,2>{0.33145085f, 0.1871977f},
-std::array<float,2>{0.187079266f, 0.719200909f},
-std::array<float,2>{0.762950182f, 0.204497725f},
-std::array<float,2>{0.748505712f, 0.897864103f},
-std::array<float,2>{0.489005059f, 0.479275256f},
-std::array<float,2>{0.254425943f, 0.761930704f},
-std::array<float,2>{0.572535694f, 0.274546176f},
-std::array<float,2>{0.919377625f, 0.507749319f},
-std::array<float,2>{0.0642410144f, 0.0221357532f},
-std::array<float,2>{0.305273086f, 0.521626651f},
-std::array<float,2>{0.603815198f, 0.0144376159f},
-std::array<float,2>{0.899452627f, 0.770042419f},
-std::array<float,2>{0.103553526f, 0.265058786f},
-std::array<float,2>{0.155042887f, 0.88628006f},
-std::array<float,2>{0.811668336f, 0.486564785f},
-std::array<float,2>{0.691593587f, 0.749441862f},
-std::array<float,2>{0.446421862f, 0.196235254f},
-std::array<float,2>{0.000312984979f, 0.669115484f},
-std::array<float,2>{0.997159719f, 0.17170316f},
-std::array<float,2>{0.515933394f, 0.960606515f},
-std::array<float,2>{0.358581483f, 0.423123926f},
-std::array<float,2>{0.382424444f, 0.841653466f},
-std::array<float,2>{0.679696083f, 0.363202631f},
-std::array<float,2>{0.843248725f, 0.608408153f},
-std::array<float,2>{0.244484454f, 0.102682881f},
-std::array<float,2>{0.481787264f, 0.717972219f},
-std::array<float,2>{0.725382507f, 0.222877815f},
-std::array<float,2>{0.776540697f, 0.919086874f},
-std::array<float,2>{0.157946691f, 0.463612288f},
-std::array<float,2>{0.0889977142f, 0.81030494f},
-std::array<float,2>{0.930404663f, 0.285549581f},
-std::array<float,2>{0.581330955f, 0.556086242f},
-std::array<float,2>{0.267186403f, 0.054013595f},
-std::array<float,2>{0.208572775f, 0.574397027f},
-std::array<float,2>{0.855723679f, 0.0806975216f},
-std::array<float,2>{0.638647735f, 0.864109457f},
-std::array<float,2>{0.413513988f, 0.327966779f},
-std::array<float,2>{0.32518363f, 0.983471394f},
-std::array<float,2>{0.536291301f, 0.39451769f},
-std::array<float,2>{0.952887595f, 0.646438837f},
-std::array<float,2>{0.0583972037f, 0.148336381f},
-std::array<float,2>{0.346618652f, 0.724328935f},
-std::array<float,2>{0.528065145f, 0.209638476f},
-std::array<float,2>{0.989208937f, 0.892434299f},
-std::array<float,2>{0.0154078398f, 0.482122093f},
-std::array<float,2>{0.236167237f, 0.759100378f},
-std::array<float,2>{0.828383744f, 0.279782951f},
-std::array<float,2>{0.677708507f, 0.501631021f},
-std::array<float,2>{0.390518248f, 0.0174870044f},
-std::array<float,2>{0.0986424834f, 0.623054028f},
-std::array<float,2>{0.893669069f, 0.116261363f},
-std::array<float,2>{0.599807799f, 0.814798594f},
-std::array<float,2>{0.299424797f, 0.346033663f},
-std::array<float,2>{0.439804226f, 0.951962173f},
-std::array<float,2>{0.696597755f, 0.421788394f},
-std::array<float,2>{0.801202893f, 0.68046087f},
-std::array<float,2>{0.145792261f, 0.18204762f},
-std::array<float,2>{0.414294511f, 0.541514874f},
-std::array<float,2>{0.630804956f, 0.037882816f},
-std::array<float,2>{0.850385606f, 0.79401356f},
-std::array<float,2>{0.214293614f, 0.308430195f},
-std::array<float,2>{0.0510500371f, 0.922216654f},
-std::array<float,2>{0.943295658f, 0.439056039f},
-std::array<float,2>{0.542346954f, 0.697423279f},
-std::array<float,2>{0.312641561f, 0.248745948f},
-std::array<float,2>{0.169082209f, 0.631743312f},
-std::array<float,2>{0.77245003f, 0.132693008f},
-std::array<float,2>{0.732829452f, 0.997202575f},
-std::array<float,2>{0.476536572f, 0.386323035f},
-std::array<float,2>{0.278714955f, 0.84501797f},
-std::array<float,2>{0.591352344f, 0.330040932f},
-std::array<float,2>{0.928906858f, 0.587048709f},
-std::array<float,2>{0.0818751007f, 0.0681993365f},
-std::array<float,2>{0.286869049f, 0.570700884f},
-std::array<float,2>{0.618159711f, 0.0858585238f},
-std::array<float,2>{0.884211719f, 0.862712562f},
-std::array<float,2>{0.115999833f, 0.320691586f},
-std::array<float,2>{0.131391406f, 0.97901237f},
-std::array<float,2>{0.787702024f, 0.397112727f},
-std::array<float,2>{0.710798502f, 0.642025948f},
-std::array<float,2>{0.459326029f, 0.140980437f},
-std::array<float,2>{0.0217942372f, 0.712213993f},
-std::array<float,2>{0.97103858f, 0.220546976f},
-std::array<float,2>{0.512743235f, 0.915426075f},
-std::array<float,2>{0.371162713f, 0.46736151f},
-std::array<float,2>{0.399425894f, 0.80573529f},
-std::array<float,2>{0.662671268f, 0.281745851f},
-std::array<float,2>{0.815297306f, 0.560519814f},
-std::array<float,2>{0.221868157f, 0.0506708287f},
-std::array<float,2>{0.496804178f, 0.664854646f},
-std::array<float,2>{0.741692126f, 0.16420953f},
-std::array<float,2>{0.757543266f, 0.956195831f},
-std::array<float,2>{0.179580525f, 0.428254157f},
-std::array<float,2>{0.0769219175f, 0.836461008f},
-std::array<float,2>{0.909362555f, 0.366101921f},
-std::array<float,2>{0.56507802f, 0.601822615f},
-std::array<float,2>{0.258412182f, 0.108488597f},
-std::array<float,2>{0.200783283f, 0.515960097f},
-std::array<float,2>{0.869452715f, 0.00866868813f},
-std::array<float,2>{0.653334141f, 0.767208219f},
-std::array<float,2>{0.432949245f, 0.261694759f},
-std::array<float,2>{0.336124957f, 0.890601039f},
-std::array<float,2>{0.554189205f, 0.489937872f},
-std::array<float,2>{0.965578735f, 0.745673895f},
-std::array<float,2>{0.0429073609f, 0.202056751f},
-std::array<float,2>{0.252810836f, 0.654830873f},
-std::array<float,2>{0.575806797f, 0.15334785f},
-std::array<float,2>{0.915880799f, 0.976164937f},
-std::array<float,2>{0.0683501288f, 0.400790542f},
-std::array<float,2>{0.183578372f, 0.867480218f},
-std::array<float,2>{0.758203566f, 0.318548083f},
-std::array<float,2>{0.743251503f, 0.56627816f},
-std::array<float,2>{0.486388296f, 0.0901963711f},
-std::array<float,2>{0.034102384f, 0.55404979f},
-std::array<float,2>{0.96063751f, 0.0615712591f},
-std::array<float,2>{0.558397055f, 0.802889287f},
-std::array<float,2>{0.333944768f, 0.293380678f},
-std::array<float,2>{0.426820546f, 0.91141504f},
-std::array<float,2>{0.64810437f, 0.454186141f},
-std::array<float,2>{0.86543256f, 0.709078193f},
-std::array<float,2>{0.190374047f, 0.232230723f},
-std::array<float,2>{0.463896275f, 0.600623012f},
-std::array<float,2>{0.71394223f, 0.0955914333f},
-std::array<float,2>{0.791230083f, 0.832648933f},
-std::array<float,2>{0.133937955f, 0.37098369f},
-std::array<float,2>{0.120677285f, 0.965242326f},
-std::array<float,2>{0.881159544f, 0.433720201f},
-std::array<float,2>{0.614848375f, 0.658509672f},
-std::array<float,2>{0.294006228f, 0.159597442f},
-std::array<float,2>{0.229326397f, 0.741909027f},
-std::array<float,2>{0.822471142f, 0.192799851f},
-std::array<float,2>{0.669757187f, 0.882199347f},
-std::array<float,2>{0.390663028f, 0.493672758f},
-std::array<float,2>{0.362051278f, 0.773492098f},
-std::array<float,2>{0.506346881f, 0.255056411f},
-std::array<float,2>{0.980242431f, 0.529088557f},
-std::array<float,2>{0.0234847292f, 0.000158419789f},
-std::array<float,2>{0.32160753f, 0.515308917f},
-std::array<float,2>{0.532147706f, 0.0245323908f},
-std::array<float,2>{0.94876343f, 0.757662475f},
-std::array<float,2>{0.0620675161f, 0.271056563f},
-std::array<float,2>{0.205341592f, 0.906006634f},
-std::array<float,2>{0.854880989f, 0.472174257f},
-std::array<float,2>{0.632931888f, 0.728762448f},
-std::array<float,2>{0.407601207f, 0.216235369f},
-std::array<float,2>{0.0906544626f, 0.674237132f},
-std::array<float,2>{0.937473714f, 0.179440603f},
-std::array<float,2>{0.584920824f, 0.93946445f},
-std::array<float,2>{0.271865577f, 0.409014523f},
-std::array<float,2>{0.478434145f, 0.821293712f},
-std::array<float,2>{0.721393526f, 0.354491323f},
-std::array<float,2>{0.778370798f, 0.615676224f},
-std::array<float,2>{0.160783187f, 0.120939255f},
-std::array<float,2>{0.376232505f, 0.694683433f},
-std::array<float,2>{0.686557949f, 0.240771532f},
-std::array<float,2>{0.83628583f, 0.931790531f},
-std::array<float,2>{0.246726125f, 0.447191596f},
-std::array<float,2>{0.00439287629f, 0.786644816f},
-std::array<float,2>{0.995500445f, 0.298874795f},
-std::array<float,2>{0.521579027f, 0.535584092f},
-std::array<float,2>{0.352194548f, 0.0439807437f},
-std::array<float,2>{0.148559764f, 0.582422137f},
-std::array<float,2>{0.807260215f, 0.0733669326f},
-std::array<float,2>{0.688543677f, 0.854158342f},
-std::array<float,2>{0.450607985f, 0.343438506f},
-std::array<float,2>{0.311484009f, 0.986280143f},
-std::array<float,2>{0.60907805f, 0.380338907f},
-std::array<float,2>{0.905505478f, 0.634761631f},
-std::array<float,2>{0.108245045f, 0.134809703f},
-std::array<float,2>{0.302713543f, 0.704906344f},
-std::array<float,2>{0.595081031f, 0.229129896f},
-std::array<float,2>{0.896716118f, 0.909534752f},
-std::array<float,2>{0.0970017612f, 0.460054696f},
-std::array<float,2>{0.142280966f, 0.800085962f},
-std::array<float,2>{0.799565077f, 0.292263269f},
-std::array<float,2>{0.701225877f, 0.548746824f},
-std::array<float,2>{0.442629337f, 0.0571969636f},
-std::array<float,2>{0.0105747348f, 0.568447232f},
-std::array<float,2>{0.9878456f, 0.0860835314f},
-std::array<float,2>{0.524566531f, 0.872599423f},
-std::array<float,2>{0.351373941f, 0.312975734f},
-std::array<float,2>{0.385778874f, 0.971164346f},
-std::array<float,2>{0.672852933f, 0.405539006f},
-std::array<float,2>{0.833543956f, 0.650667131f},
-std::array<float,2>{0.240853205f, 0.151736811f},
-std::array<float,2>{0.471527129f, 0.523925543f},
-std::array<float,2>{0.729456186f, 0.00700558675f},
-std::array<float,2>{0.768217623f, 0.779461086f},
-std::array<float,2>{0.165530846f, 0.251363456f},
-std::array<float,2>{0.0836006999f, 0.877137899f},
-std::array<float,2>{0.923836231f, 0.499301732f},
-std::array<float,2>{0.589123249f, 0.738037884f},
-std::array<float,2>{0.276837289f, 0.189395979f},
-std::array<float,2>{0.21772927f, 0.662825465f},
-std::array<float,2>{0.847266614f, 0.162426084f},
-std::array<float,2>{0.627722561f, 0.962138772f},
-std::array<float,2>{0.420217872f, 0.430276006f},
-std::array<float,2>{0.319409132f, 0.829048336f},
-std::array<float,2>{0.546288669f, 0.373466015f},
-std::array<float,2>{0.939301729f, 0.5938223f},
-std::array<float,2>{0.0500759073f, 0.0994225666f},
-std::array<float,2>{0.369864404f, 0.613216639f},
-std::array<float,2>{0.508756936f, 0.123847231f},
-std::array<float,2>{0.976331711f, 0.825812995f},
-std::array<float,2>{0.0157671571f, 0.358374953f},
-std::array<float,2>{0.223448157f, 0.941808403f},
-std::array<float,2>{0.818377733f, 0.412351936f},
-std::array<float,2>{0.658079207f, 0.679322124f},
-std::array<float,2>{0.405197591f, 0.175598502f},
-std::array<float,2>{0.109426379f, 0.731566787f},
-std::array<float,2>{0.887398839f, 0.212501958f},
-std::array<float,2>{0.621397018f, 0.901075423f},
-std::array<float,2>{0.283634722f, 0.473969966f},
-std::array<float,2>{0.454062641f, 0.751915991f},
-std::array<float,2>{0.705091357f, 0.267656714f},
-std::array<float,2>{0.781433403f, 0.507949471f},
-std::array<float,2>{0.127319396f, 0.0278311837f},
-std::array<float,2>{0.433765888f, 0.640443683f},
-std::array<float,2>{0.648898125f, 0.138409033f},
-std::array<float,2>{0.874568582f, 0.988282144f},
-std::array<float,2>{0.197378665f, 0.378343731f},
-std::array<float,2>{0.0456609949f, 0.858571947f},
-std::array<float,2>{0.962560594f, 0.33667013f},
-std::array<float,2>{0.549121857f, 0.58139497f},
-std::array<float,2>{0.342071474f, 0.0760744885f},
-std::array<float,2>{0.172856852f, 0.532614291f},
-std::array<float,2>{0.753804982f, 0.0392166264f},
-std::array<float,2>{0.736619473f, 0.784486055f},
-std::array<float,2>{0.493395269f, 0.303164482f},
-std::array<float,2>{0.263836354f, 0.933965147f},
-std::array<float,2>{0.568429112f, 0.452915579f},
-std::array<float,2>{0.91251117f, 0.689768374f},
-std::array<float,2>{0.0736452043f, 0.235875681f},
-std::array<float,2>{0.32859239f, 0.684195876f},
-std::array<float,2>{0.558755636f, 0.184877872f},
-std::array<float,2>{0.954479992f, 0.94551748f},
-std::array<float,2>{0.0368514843f, 0.417719632f},
-std::array<float,2>{0.194041312f, 0.81742841f},
-std::array<float,2>{0.860123038f, 0.349615365f},
-std::array<float,2>{0.641747653f, 0.617643237f},
-std::array<float,2>{0.424358189f, 0.112542361f},
-std::array<float,2>{0.0645128861f, 0.505544066f},
-std::array<float,2>{0.920377731f, 0.0210639071f},
-std::array<float,2>{0.571983457f, 0.763835728f},
-std::array<float,2>{0.255931646f, 0.276642889f},
-std::array<float,2>{0.492005825f, 0.896079957f},
-std::array<float,2>{0.746363282f, 0.478210419f},
-std::array<float,2>{0.765144408f, 0.72229147f},
-std::array<float,2>{0.185431316f, 0.206517339f},
-std::array<float,2>{0.395645112f, 0.590085924f},
-std::array<float,2>{0.666068375f, 0.0633681566f},
-std::array<float,2>{0.825690031f, 0.848692179f},
-std::array<float,2>{0.231041431f, 0.332117051f},
-std::array<float,2>{0.0309958756f, 0.992435217f},
-std::array<float,2>{0.983147025f, 0.388148397f},
-std::array<float,2>{0.503324389f, 0.627286553f},
-std::array<float,2>{0.364988297f, 0.127177909f},
-std::array<float,2>{0.136826947f, 0.699391425f},
-std::array<float,2>{0.796321511f, 0.243659496f},
-std::array<float,2>{0.715613604f, 0.926991522f},
-std::array<float,2>{0.465250492f, 0.442076325f},
-std::array<float,2>{0.291881949f, 0.790397942f},
-std::array<float,2>{0.611505985f, 0.310714662f},
-std::array<float,2>{0.876588464f, 0.54414624f},
-std::array<float,2>{0.121283814f, 0.0322753862f},
-std::array<float,2>{0.269079238f, 0.558393598f},
-std::array<float,2>{0.579143941f, 0.0523809083f},
-std::array<float,2>{0.932151854f, 0.811126232f},
-std::array<float,2>{0.0859724954f, 0.287255704f},
-std::array<float,2>{0.159726828f, 0.920800567f},
-std::array<float,2>{0.775208592f, 0.462002963f},
-std::array<float,2>{0.723408282f, 0.716338336f},
-std::array<float,2>{0.483207732f, 0.225743532f},
-std::array<float,2>{0.0555332676f, 0.648200452f},
-std::array<float,2>{0.950587749f, 0.14455241f},
-std::array<float,2>{0.537388027f, 0.981679678f},
-std::array<float,2>{0.327185214f, 0.39186579f},
-std::array<float,2>{0.410608351f, 0.865967155f},
-std::array<float,2>{0.640569925f, 0.325159192f},
-std::array<float,2>{0.858343661f, 0.57804203f},
-std::array<float,2>{0.209967434f, 0.078769125f},
-std::array<float,2>{0.447426736f, 0.74721688f},
-std::array<float,2>{0.69493109f, 0.198901221f},
-std::array<float,2>{0.809541404f, 0.882834435f},
-std::array<float,2>{0.152682006f, 0.485035956f},
-std::array<float,2>{0.10247349f, 0.772379279f},
-std::array<float,2>{0.901241302f, 0.262157619f},
-std::array<float,2>{0.603159249f, 0.51954025f},
-std::array<float,2>{0.308160841f, 0.0134397363f},
-std::array<float,2>{0.243770942f, 0.606699884f},
-std::array<float,2>{0.840654492f, 0.104214653f},
-std::array<float,2>{0.682952404f, 0.842939496f},
-std::array<float,2>{0.379011393f, 0.359866589f},
-std::array<float,2>{0.356860518f, 0.958273292f},
-std::array<float,2>{0.519383788f, 0.423924059f},
-std::array<float,2>{0.998288751f, 0.671309471f},
-std::array<float,2>{0.00301547116f, 0.168133169f},
-std::array<float,2>{0.338707983f, 0.744880199f},
-std::array<float,2>{0.552366316f, 0.202617511f},
-std::array<float,2>{0.967853487f, 0.889391363f},
-std::array<float,2>{0.0404824615f, 0.488701493f},
-std::array<float,2>{0.202770278f, 0.765647411f},
-std::array<float,2>{0.868041694f, 0.259923518f},
-std::array<float,2>{0.654876053f, 0.517006516f},
-std::array<float,2>{0.430567175f, 0.00935474224f},
-std::array<float,2>{0.0749230236f, 0.602557778f},
-std::array<float,2>{0.906575978f, 0.108103529f},
-std::array<float,2>{0.564145148f, 0.837641239f},
-std::array<float,2>{0.260000616f, 0.366961271f},
-std::array<float,2>{0.499171615f, 0.955494404f},
-std::array<float,2>{0.740005195f, 0.429682344f},
-std::array<float,2>{0.755733252f, 0.665810704f},
-std::array<float,2>{0.17598021f, 0.165094525f},
-std::array<float,2>{0.400399208f, 0.559480965f},
-std::array<float,2>{0.660671115f, 0.0492203683f},
-std::array<float,2>{0.813926399f, 0.805182815f},
-std::array<float,2>{0.21952787f, 0.282688797f},
-std::array<float,2>{0.0196715835f, 0.914769769f},
-std::array<float,2>{0.970417142f, 0.468053013f},
-std::array<float,2>{0.513698637f, 0.71095401f},
-std::array<float,2>{0.373277813f, 0.219713926f},
-std::array<float,2>{0.1307358f, 0.640855134f},
-std::array<float,2>{0.785858274f, 0.142455429f},
-std::array<float,2>{0.70837611f, 0.980107605f},
-std::array<float,2>{0.457283974f, 0.397494614f},
-std::array<float,2>{0.287536204f, 0.861958086f},
-std::array<float,2>{0.619741917f, 0.32143417f},
-std::array<float,2>{0.885905027f, 0.571838796f},
-std::array<float,2>{0.115193225f, 0.0848972425f},
-std::array<float,2>{0.280425549f, 0.586068153f},
-std::array<float,2>{0.592255712f, 0.0668403506f},
-std::array<float,2>{0.927224398f, 0.8443923f},
-std::array<float,2>{0.079200387f, 0.328777879f},
-std::array<float,2>{0.171170577f, 0.996746838f},
-std::array<float,2>{0.769762099f, 0.38542676f},
-std::array<float,2>{0.731067061f, 0.631882191f},
-std::array<float,2>{0.472950935f, 0.131065696f},
-std::array<float,2>{0.0533784777f, 0.698860765f},
-std::array<float,2>{0.943482637f, 0.249398053f},
-std::array<float,2>{0.539147794f, 0.923136473f},
-std::array<float,2>{0.31463629f, 0.437784821f},
-std::array<float,2>{0.416475832f, 0.793442547f},
-std::array<float,2>{0.631999135f, 0.307199091f},
-std::array<float,2>{0.849502325f, 0.542097747f},
-std::array<float,2>{0.212685466f, 0.0387227349f},
-std::array<float,2>{0.437880814f, 0.680826008f},
-std::array<float,2>{0.698216796f, 0.182629749f},
-std::array<float,2>{0.80454129f, 0.952799559f},
-std::array<float,2>{0.147464067f, 0.420778811f},
-std::array<float,2>{0.101001196f, 0.81558609f},
-std::array<float,2>{0.891929924f, 0.347450942f},
-std::array<float,2>{0.597888052f, 0.624677837f},
-std::array<float,2>{0.297294229f, 0.115812264f},
-std::array<float,2>{0.236589447f, 0.500899613f},
-std::array<float,2>{0.831172109f, 0.016214272f},
-std::array<float,2>{0.679377198f, 0.757969379f},
-std::array<float,2>{0.387841374f, 0.280825257f},
-std::array<float,2>{0.344831735f, 0.891171634f},
-std::array<float,2>{0.530117869f, 0.481015891f},
-std::array<float,2>{0.990384698f, 0.723090589f},
-std::array<float,2>{0.0124026928f, 0.210685134f},
-std::array<float,2>{0.309736609f, 0.63323456f},
-std::array<float,2>{0.606427133f, 0.136111468f},
-std::array<float,2>{0.902529895f, 0.984497666f},
-std::array<float,2>{0.105624616f, 0.379734695f},
-std::array<float,2>{0.152234659f, 0.85541904f},
-std::array<float,2>{0.804902315f, 0.342723936f},
-std::array<float,2>{0.690791428f, 0.583785653f},
-std::array<float,2>{0.452701539f, 0.0727962404f},
-std::array<float,2>{0.00735730957f, 0.536550701f},
-std::array<float,2>{0.993437231f, 0.0439181887f},
-std::array<float,2>{0.521051228f, 0.785314202f},
-std::array<float,2>{0.353790343f, 0.300710708f},
-std::array<float,2>{0.377567589f, 0.933239579f},
-std::array<float,2>{0.684780359f, 0.44571808f},
-std::array<float,2>{0.838563204f, 0.693451226f},
-std::array<float,2>{0.248517886f, 0.242051318f},
-std::array<float,2>{0.480119795f, 0.616814256f},
-std::array<float,2>{0.718981922f, 0.119666755f},
-std::array<float,2>{0.781116009f, 0.820949912f},
-std::array<float,2>{0.163370654f, 0.355443269f},
-std::array<float,2>{0.092248641f, 0.940731347f},
-std::array<float,2>{0.934928119f, 0.409448326f},
-std::array<float,2>{0.5833534f, 0.675168693f},
-std::array<float,2>{0.27023527f, 0.17853789f},
-std::array<float,2>{0.204472512f, 0.729955614f},
-std::array<float,2>{0.852016628f, 0.215733647f},
-std::array<float,2>{0.635221124f, 0.904393554f},
-std::array<float,2>{0.409393102f, 0.471433699f},
-std::array<float,2>{0.323517978f, 0.756292582f},
-std::array<float,2>{0.534074426f, 0.269856304f},
-std::array<float,2>{0.945791781f, 0.513684869f},
-std::array<float,2>{0.0600292943f, 0.0241353866f},
-std::array<float,2>{0.360967278f, 0.528165698f},
-std::array<float,2>{0.504552543f, 0.00125854125f},
-std::array<float,2>{0.976751864f, 0.775013208f},
-std::array<float,2>{0.0270276535f, 0.254441112f},
-std::array<float,2>{0.228475243f, 0.881325781f},
-std::array<float,2>{0.820503294f, 0.492887348f},
-std::array<float,2>{0.67058146f, 0.740234911f},
-std::array<float,2>{0.39345938f, 0.191815138f},
-std::array<float,2>{0.117493369f, 0.659785867f},
-std::array<float,2>{0.880280733f, 0.158512935f},
-std::array<float,2>{0.616721153f, 0.966395497f},
-std::array<float,2>{0.295790374f, 0.435382903f},
-std::array<float,2>{0.462646306f, 0.833975732f},
-std::array<float,2>{0.711271703f, 0.369541556f},
-std::array<float,2>{0.789899528f, 0.599743247f},
-std::array<float,2>{0.134817421f, 0.093945086f},
-std::array<float,2>{0.428950846f, 0.710765183f},
-std::array<float,2>{0.644794881f, 0.230934948f},
-std::array<float,2>{0.86442709f, 0.911124825f},
-std::array<float,2>{0.188931644f, 0.45386678f},
-std::array<float,2>{0.0324303508f, 0.803996384f},
-std::array<float,2>{0.958251059f, 0.29436484f},
-std::array<float,2>{0.555724859f, 0.553201914f},
-std::array<float,2>{0.334646046f, 0.0611275211f},
-std::array<float,2>{0.181128785f, 0.564633787f},
-std::array<float,2>{0.76033318f, 0.0916017666f},
-std::array<float,2>{0.745171487f, 0.868997574f},
-std::array<float,2>{0.48487404f, 0.32025215f},
-std::array<float,2>{0.251726389f, 0.975553393f},
-std::array<float,2>{0.576358736f, 0.401500732f},
-std::array<float,2>{0.917914748f, 0.655822098f},
-std::array<float,2>{0.0700702593f, 0.152766779f},
-std::array<float,2>{0.262212545f, 0.690926969f},
-std::array<float,2>{0.567596138f, 0.234420776f},
-std::array<float,2>{0.911435485f, 0.935456872f},
-std::array<float,2>{0.0710269883f, 0.45167467f},
-std::array<float,2>{0.175029382f, 0.783962727f},
-std::array<float,2>{0.751373529f, 0.304242581f},
-std::array<float,2>{0.735379815f, 0.531957507f},
-std::array<float,2>{0.495522648f, 0.0402171127f},
-std::array<float,2>{0.0442143418f, 0.580734134f},
-std::array<float,2>{0.963296831f, 0.074640356f},
-std::array<float,2>{0.5471766f, 0.858115792f},
-std::array<float,2>{0.341185778f, 0.337267786f},
-std::array<float,2>{0.436183453f, 0.9894647f},
-std::array<float,2>{0.650687099f, 0.377239883f},
-std::array<float,2>{0.871757567f, 0.639062405f},
-std::array<float,2>{0.196018323f, 0.137503996f},
-std::array<float,2>{0.455745548f, 0.508962154f},
-std::array<float,2>{0.704288065f, 0.0287168641f},
-std::array<float,2>{0.783300757f, 0.750938177f},
-std::array<float,2>{0.125442296f, 0.268672228f},
-std::array<float,2>{0.113108255f, 0.90155077f},
-std::array<float,2>{0.888761461f, 0.472954184f},
-std::array<float,2>{0.623804748f, 0.730613112f},
-std::array<float,2>{0.282006294f, 0.211372435f},
-std::array<float,2>{0.226119399f, 0.677857935f},
-std::array<float,2>{0.818163633f, 0.174126595f},
-std::array<float,2>{0.659375787f, 0.943270385f},
-std::array<float,2>{0.402636319f, 0.413414091f},
-std::array<float,2>{0.36881423f, 0.824841082f},
-std::array<float,2>{0.5100137f, 0.358449608f},
-std::array<float,2>{0.973695517f, 0.611509442f},
-std::array<float,2>{0.0183245689f, 0.124398537f},
-std::array<float,2>{0.31661886f, 0.595007777f},
-std::array<float,2>{0.544890642f, 0.0984868482f},
-std::array<float,2>{0.940588772f, 0.829377294f},
-std::array<float,2>{0.0482388847f, 0.37493515f},
-std::array<float,2>{0.216222152f, 0.961207211f},
-std::array<float,2>{0.845492363f, 0.431087434f},
-std::array<float,2>{0.625246704f, 0.663253188f},
-std::array<float,2>{0.418551356f, 0.163742185f},
-std::array<float,2>{0.0858421251f, 0.736395776f},
-std::array<float,2>{0.92340827f, 0.187881783f},
-std::array<float,2>{0.58785212f, 0.878706217f},
-std::array<float,2>{0.274757266f, 0.498909801f},
-std::array<float,2>{0.470292896f, 0.781099796f},
-std::array<float,2>{0.727562785f, 0.250419796f},
-std::array<float,2>{0.767243028f, 0.524825692f},
-std::array<float,2>{0.16685982f, 0.00653455453f},
-std::array<float,2>{0.383804023f, 0.651766777f},
-std::array<float,2>{0.674227536f, 0.150553524f},
-std::array<float,2>{0.834245086f, 0.971718729f},
-std::array<float,2>{0.239410743f, 0.405215144f},
-std::array<float,2>{0.00846287981f, 0.871634305f},
-std::array<float,2>{0.985407352f, 0.313871175f},
-std::array<float,2>{0.526808918f, 0.569714189f},
-std::array<float,2>{0.34875986f, 0.0875603035f},
-std::array<float,2>{0.144246578f, 0.547786891f},
-std::array<float,2>{0.7985605f, 0.0578910969f},
-std::array<float,2>{0.70093292f, 0.799574494f},
-std::array<float,2>{0.445115656f, 0.291288704f},
-std::array<float,2>{0.303929031f, 0.908280492f},
-std::array<float,2>{0.59607029f, 0.459095359f},
-std::array<float,2>{0.895886004f, 0.70316112f},
-std::array<float,2>{0.0938161686f, 0.230359793f},
-std::array<float,2>{0.357642919f, 0.670293927f},
-std::array<float,2>{0.517482519f, 0.169013619f},
-std::array<float,2>{0.996435225f, 0.957646191f},
-std::array<float,2>{0.000992755871f, 0.425188512f},
-std::array<float,2>{0.245138079f, 0.842627704f},
-std::array<float,2>{0.842166841f, 0.361043096f},
-std::array<float,2>{0.681242824f, 0.606371403f},
-std::array<float,2>{0.380938232f, 0.104895674f},
-std::array<float,2>{0.104763322f, 0.520647407f},
-std::array<float,2>{0.899402678f, 0.0119386027f},
-std::array<float,2>{0.604831219f, 0.773065686f},
-std::array<float,2>{0.305697113f, 0.263374209f},
-std::array<float,2>{0.445536524f, 0.884589076f},
-std::array<float,2>{0.693031311f, 0.485389143f},
-std::array<float,2>{0.811269343f, 0.746467948f},
-std::array<float,2>{0.155621633f, 0.198101103f},
-std::array<float,2>{0.412908554f, 0.57703954f},
-std::array<float,2>{0.637501597f, 0.0799390674f},
-std::array<float,2>{0.857223034f, 0.866669655f},
-std::array<float,2>{0.207762375f, 0.325665653f},
-std::array<float,2>{0.0570363812f, 0.98055321f},
-std::array<float,2>{0.951951921f, 0.391399413f},
-std::array<float,2>{0.536040604f, 0.647412062f},
-std::array<float,2>{0.325296342f, 0.146236748f},
-std::array<float,2>{0.15686664f, 0.715588272f},
-std::array<float,2>{0.775767803f, 0.225316748f},
-std::array<float,2>{0.725655735f, 0.921707034f},
-std::array<float,2>{0.481098711f, 0.461144269f},
-std::array<float,2>{0.266404599f, 0.811776757f},
-std::array<float,2>{0.580608428f, 0.288783491f},
-std::array<float,2>{0.930856526f, 0.557232678f},
-std::array<float,2>{0.0883898735f, 0.0514460541f},
-std::array<float,2>{0.29002583f, 0.543562591f},
-std::array<float,2>{0.609916985f, 0.0319200344f},
-std::array<float,2>{0.877144814f, 0.789559484f},
-std::array<float,2>{0.124765791f, 0.312398911f},
-std::array<float,2>{0.139909551f, 0.926656365f},
-std::array<float,2>{0.793257177f, 0.442863345f},
-std::array<float,2>{0.718679249f, 0.700659931f},
-std::array<float,2>{0.468342036f, 0.242965654f},
-std::array<float,2>{0.0274540186f, 0.628397286f},
-std::array<float,2>{0.982281268f, 0.128291473f},
-std::array<float,2>{0.500851631f, 0.994032741f},
-std::array<float,2>{0.366225153f, 0.386897236f},
-std::array<float,2>{0.397616059f, 0.847978473f},
-std::array<float,2>{0.665773392f, 0.333239406f},
-std::array<float,2>{0.82684052f, 0.590876102f},
-std::array<float,2>{0.233141258f, 0.0642792135f},
-std::array<float,2>{0.489888579f, 0.721355617f},
-std::array<float,2>{0.749789059f, 0.205143407f},
-std::array<float,2>{0.761937022f, 0.894605517f},
-std::array<float,2>{0.185886368f, 0.476750433f},
-std::array<float,2>{0.0627732873f, 0.765249491f},
-std::array<float,2>{0.918775439f, 0.276022583f},
-std::array<float,2>{0.573931873f, 0.504105628f},
-std::array<float,2>{0.255786926f, 0.0200793836f},
-std::array<float,2>{0.192500398f, 0.618503809f},
-std::array<float,2>{0.862863004f, 0.111973196f},
-std::array<float,2>{0.642752111f, 0.816454589f},
-std::array<float,2>{0.422201544f, 0.350614488f},
-std::array<float,2>{0.330423981f, 0.946718514f},
-std::array<float,2>{0.560924888f, 0.416527897f},
-std::array<float,2>{0.956500947f, 0.685356021f},
-std::array<float,2>{0.0374616086f, 0.183925092f},
-std::array<float,2>{0.372091115f, 0.714165032f},
-std::array<float,2>{0.512049556f, 0.222275257f},
-std::array<float,2>{0.972280085f, 0.916565895f},
-std::array<float,2>{0.0229333714f, 0.46494469f},
-std::array<float,2>{0.220809579f, 0.807691574f},
-std::array<float,2>{0.81588465f, 0.284142584f},
-std::array<float,2>{0.663553596f, 0.562415719f},
-std::array<float,2>{0.398896873f, 0.0469260514f},
-std::array<float,2>{0.116865061f, 0.572575808f},
-std::array<float,2>{0.882825911f, 0.0837405324f},
-std::array<float,2>{0.618311524f, 0.859677017f},
-std::array<float,2>{0.286033899f, 0.322986364f},
-std::array<float,2>{0.46003744f, 0.97683394f},
-std::array<float,2>{0.709627092f, 0.395221561f},
-std::array<float,2>{0.788236558f, 0.642739415f},
-std::array<float,2>{0.132498413f, 0.143468454f},
-std::array<float,2>{0.432250619f, 0.519106448f},
-std::array<float,2>{0.653270423f, 0.0105186133f},
-std::array<float,2>{0.870170832f, 0.769256592f},
-std::array<float,2>{0.200007901f, 0.258312732f},
-std::array<float,2>{0.0414342582f, 0.887853205f},
-std::array<float,2>{0.966213763f, 0.490558296f},
-std::array<float,2>{0.552951634f, 0.744016409f},
-std::array<float,2>{0.337248802f, 0.199483439f},
-std::array<float,2>{0.178310215f, 0.666255534f},
-std::array<float,2>{0.756301284f, 0.167871699f},
-std::array<float,2>{0.740631521f, 0.954369307f},
-std::array<float,2>{0.49768585f, 0.427568853f},
-std::array<float,2>{0.259280711f, 0.838220596f},
-std::array<float,2>{0.565434515f, 0.365153819f},
-std::array<float,2>{0.909171402f, 0.604789853f},
-std::array<float,2>{0.0772116408f, 0.106994718f},
-std::array<float,2>{0.299963742f, 0.621195018f},
-std::array<float,2>{0.600661397f, 0.113735005f},
-std::array<float,2>{0.892645419f, 0.813502312f},
-std::array<float,2>{0.097831592f, 0.344730496f},
-std::array<float,2>{0.145121306f, 0.950659633f},
-std::array<float,2>{0.80179888f, 0.418574214f},
-std::array<float,2>{0.69600141f, 0.68321687f},
-std::array<float,2>{0.441231549f, 0.180939019f},
-std::array<float,2>{0.0145938862f, 0.725345671f},
-std::array<float,2>{0.989804506f, 0.208227158f},
-std::array<float,2>{0.528914154f, 0.894040525f},
-std::array<float,2>{0.347446591f, 0.483089f},
-std::array<float,2>{0.388780057f, 0.761273324f},
-std::array<float,2>{0.67591846f, 0.278632283f},
-std::array<float,2>{0.829540372f, 0.502056062f},
-std::array<float,2>{0.234509975f, 0.0189136863f},
-std::array<float,2>{0.475494325f, 0.629940152f},
-std::array<float,2>{0.733922184f, 0.129053801f},
-std::array<float,2>{0.772788584f, 0.998062491f},
-std::array<float,2>{0.168535858f, 0.383271813f},
-std::array<float,2>{0.0807274729f, 0.847269654f},
-std::array<float,2>{0.928378582f, 0.3311553f},
-std::array<float,2>{0.590786755f, 0.589180052f},
-std::array<float,2>{0.277744651f, 0.0697200373f},
-std::array<float,2>{0.213823363f, 0.540191531f},
-std::array<float,2>{0.851521194f, 0.0361360349f},
-std::array<float,2>{0.629562616f, 0.795986056f},
-std::array<float,2>{0.415115416f, 0.305504352f},
-std::array<float,2>{0.314334691f, 0.924529731f},
-std::array<float,2>{0.541212201f, 0.441259861f},
-std::array<float,2>{0.941460311f, 0.696496189f},
-std::array<float,2>{0.0522226654f, 0.247631848f},
-std::array<float,2>{0.272944272f, 0.673456311f},
-std::array<float,2>{0.58534348f, 0.17741406f},
-std::array<float,2>{0.936108708f, 0.939208686f},
-std::array<float,2>{0.0908551589f, 0.407055616f},
-std::array<float,2>{0.161651179f, 0.823521495f},
-std::array<float,2>{0.777599394f, 0.352126926f},
-std::array<float,2>{0.722456217f, 0.613918602f},
-std::array<float,2>{0.476917267f, 0.118081398f},
-std::array<float,2>{0.0610041544f, 0.513571084f},
-std::array<float,2>{0.947292447f, 0.0271067917f},
-std::array<float,2>{0.532600284f, 0.755118251f},
-std::array<float,2>{0.320525855f, 0.273396224f},
-std::array<float,2>{0.406506628f, 0.902613342f},
-std::array<float,2>{0.634267628f, 0.470311791f},
-std::array<float,2>{0.854492188f, 0.726924598f},
-std::array<float,2>{0.206958815f, 0.217511043f},
-std::array<float,2>{0.449676454f, 0.584562838f},
-std::array<float,2>{0.687853754f, 0.0707986802f},
-std::array<float,2>{0.808248997f, 0.85324198f},
-std::array<float,2>{0.149422944f, 0.341697901f},
-std::array<float,2>{0.109354429f, 0.987565756f},
-std::array<float,2>{0.90495801f, 0.381588578f},
-std::array<float,2>{0.607472658f, 0.636023939f},
-std::array<float,2>{0.312120765f, 0.134314671f},
-std::array<float,2>{0.247310966f, 0.692931533f},
-std::array<float,2>{0.837359369f, 0.239881963f},
-std::array<float,2>{0.685749412f, 0.929850221f},
-std::array<float,2>{0.375903845f, 0.448760003f},
-std::array<float,2>{0.35350728f, 0.788084507f},
-std::array<float,2>{0.52315408f, 0.298086673f},
-std::array<float,2>{0.994390666f, 0.53746891f},
-std::array<float,2>{0.00497648446f, 0.0450165197f},
-std::array<float,2>{0.33277154f, 0.551038325f},
-std::array<float,2>{0.556782842f, 0.0600752309f},
-std::array<float,2>{0.959411919f, 0.801763713f},
-std::array<float,2>{0.0349657945f, 0.296042919f},
-std::array<float,2>{0.190582469f, 0.913017988f},
-std::array<float,2>{0.86696583f, 0.456280529f},
-std::array<float,2>{0.646668851f, 0.708383024f},
-std::array<float,2>{0.426757753f, 0.233083561f},
-std::array<float,2>{0.0669429749f, 0.653972745f},
-std::array<float,2>{0.914280474f, 0.155466869f},
-std::array<float,2>{0.574712932f, 0.97307384f},
-std::array<float,2>{0.253189325f, 0.398920119f},
-std::array<float,2>{0.487368822f, 0.869631827f},
-std::array<float,2>{0.742573142f, 0.317825079f},
-std::array<float,2>{0.759628654f, 0.563447714f},
-std::array<float,2>{0.182148084f, 0.0921049044f},
-std::array<float,2>{0.391770244f, 0.738768458f},
-std::array<float,2>{0.668614507f, 0.194388062f},
-std::array<float,2>{0.823422313f, 0.880828977f},
-std::array<float,2>{0.23042576f, 0.496077448f},
-std::array<float,2>{0.0253404621f, 0.776299298f},
-std::array<float,2>{0.978862524f, 0.257554889f},
-std::array<float,2>{0.50769794f, 0.529494464f},
-std::array<float,2>{0.362359226f, 0.00218255259f},
-std::array<float,2>{0.133544222f, 0.598559201f},
-std::array<float,2>{0.792105854f, 0.0958459079f},
-std::array<float,2>{0.713167369f, 0.834160089f},
-std::array<float,2>{0.463521212f, 0.367970049f},
-std::array<float,2>{0.293419778f, 0.967119336f},
-std::array<float,2>{0.614091218f, 0.436336279f},
-std::array<float,2>{0.88202405f, 0.657927454f},
-std::array<float,2>{0.119872108f, 0.158025041f},
-std::array<float,2>{0.284668565f, 0.733721912f},
-std::array<float,2>{0.622777879f, 0.213015944f},
-std::array<float,2>{0.887956083f, 0.898669422f},
-std::array<float,2>{0.111285888f, 0.476285964f},
-std::array<float,2>{0.1283461f, 0.753009915f},
-std::array<float,2>{0.782545328f, 0.267323941f},
-std::array<float,2>{0.706180632f, 0.511351824f},
-std::array<float,2>{0.454975069f, 0.0306995865f},
-std::array<float,2>{0.0167981349f, 0.611304224f},
-std::array<float,2>{0.975285947f, 0.122747503f},
-std::array<float,2>{0.509221852f, 0.827395797f},
-std::array<float,2>{0.370364338f, 0.355735719f},
-std::array<float,2>{0.405890882f, 0.945093453f},
-std::array<float,2>{0.656991243f, 0.410219043f},
-std::array<float,2>{0.819636166f, 0.677514076f},
-std::array<float,2>{0.223773494f, 0.17188932f},
-std::array<float,2>{0.492667794f, 0.534971237f},
-std::array<float,2>{0.737923324f, 0.0427595116f},
-std::array<float,2>{0.75196439f, 0.781297803f},
-std::array<float,2>{0.172181875f, 0.301258862f},
-std::array<float,2>{0.0726241171f, 0.935928226f},
-std::array<float,2>{0.914027095f, 0.449556112f},
-std::array<float,2>{0.570107341f, 0.688876987f},
-std::array<float,2>{0.265063882f, 0.236551672f},
-std::array<float,2>{0.198383182f, 0.637005746f},
-std::array<float,2>{0.873683095f, 0.138725862f},
-std::array<float,2>{0.64992547f, 0.991841614f},
-std::array<float,2>{0.435426086f, 0.376032144f},
-std::array<float,2>{0.343527228f, 0.855732203f},
-std::array<float,2>{0.550491512f, 0.339317739f},
-std::array<float,2>{0.961716294f, 0.579768658f},
-std::array<float,2>{0.0465081669f, 0.0776987523f},
-std::array<float,2>{0.349992305f, 0.566875041f},
-std::array<float,2>{0.524044633f, 0.088977389f},
-std::array<float,2>{0.986470938f, 0.873665273f},
-std::array<float,2>{0.0111203473f, 0.316052228f},
-std::array<float,2>{0.241853908f, 0.970260322f},
-std::array<float,2>{0.832933307f, 0.403897464f},
-std::array<float,2>{0.672249734f, 0.650318921f},
-std::array<float,2>{0.384973198f, 0.148682758f},
-std::array<float,2>{0.0963262841f, 0.706837356f},
-std::array<float,2>{0.897851288f, 0.228325769f},
-std::array<float,2>{0.59430486f, 0.907371998f},
-std::array<float,2>{0.300876319f, 0.458254069f},
-std::array<float,2>{0.442075074f, 0.798422575f},
-std::array<float,2>{0.702193022f, 0.289203882f},
-std::array<float,2>{0.80072397f, 0.549028277f},
-std::array<float,2>{0.141506761f, 0.0550169162f},
-std::array<float,2>{0.421702653f, 0.661672831f},
-std::array<float,2>{0.628839195f, 0.161469534f},
-std::array<float,2>{0.846622109f, 0.964199662f},
-std::array<float,2>{0.218466803f, 0.431961894f},
-std::array<float,2>{0.0495285504f, 0.830806077f},
-std::array<float,2>{0.937996686f, 0.372962296f},
-std::array<float,2>{0.545553803f, 0.596979618f},
-std::array<float,2>{0.319267333f, 0.100009717f},
-std::array<float,2>{0.164632514f, 0.525678337f},
-std::array<float,2>{0.768892646f, 0.00395422662f},
-std::array<float,2>{0.730292439f, 0.777982473f},
-std::array<float,2>{0.472466379f, 0.253056347f},
-std::array<float,2>{0.275458723f, 0.875453413f},
-std::array<float,2>{0.588077664f, 0.49637112f},
-std::array<float,2>{0.925113797f, 0.734868944f},
-std::array<float,2>{0.0825833455f, 0.190144151f},
-std::array<float,2>{0.326209456f, 0.645121992f},
-std::array<float,2>{0.538643956f, 0.146607354f},
-std::array<float,2>{0.950040638f, 0.983249664f},
-std::array<float,2>{0.0558786392f, 0.392717391f},
-std::array<float,2>{0.209405288f, 0.864424646f},
-std::array<float,2>{0.858790874f, 0.326259702f},
-std::array<float,2>{0.63924861f, 0.575872421f},
-std::array<float,2>{0.411576271f, 0.0815939456f},
-std::array<float,2>{0.0871622413f, 0.554728508f},
-std::array<float,2>{0.933240652f, 0.0528380089f},
-std::array<float,2>{0.578689277f, 0.808708608f},
-std::array<float,2>{0.268533945f, 0.286831468f},
-std::array<float,2>{0.483529657f, 0.918900013f},
-std::array<float,2>{0.723986924f, 0.46406281f},
-std::array<float,2>{0.774211645f, 0.7172364f},
-std::array<float,2>{0.158563271f, 0.224201724f},
-std::array<float,2>{0.380310327f, 0.608252108f},
-std::array<float,2>{0.681984782f, 0.102537937f},
-std::array<float,2>{0.841057658f, 0.840180099f},
-std::array<float,2>{0.242251247f, 0.361666739f},
-std::array<float,2>{0.00291101239f, 0.959330976f},
-std::array<float,2>{0.999867439f, 0.422147244f},
-std::array<float,2>{0.517605126f, 0.668426633f},
-std::array<float,2>{0.355900526f, 0.170840636f},
-std::array<float,2>{0.154009968f, 0.74890691f},
-std::array<float,2>{0.81039536f, 0.197064415f},
-std::array<float,2>{0.693496048f, 0.88561362f},
-std::array<float,2>{0.448428392f, 0.487776816f},
-std::array<float,2>{0.307192594f, 0.771464109f},
-std::array<float,2>{0.601603329f, 0.264578879f},
-std::array<float,2>{0.901715457f, 0.523312092f},
-std::array<float,2>{0.103052922f, 0.0147193223f},
-std::array<float,2>{0.257798284f, 0.506191552f},
-std::array<float,2>{0.57042098f, 0.0229470078f},
-std::array<float,2>{0.920960605f, 0.762868524f},
-std::array<float,2>{0.0654763505f, 0.273619056f},
-std::array<float,2>{0.183742687f, 0.896849275f},
-std::array<float,2>{0.763863206f, 0.479648054f},
-std::array<float,2>{0.747494996f, 0.719809532f},
-std::array<float,2>{0.490742713f, 0.203285575f},
-std::array<float,2>{0.035224162f, 0.686241388f},
-std::array<float,2>{0.953951478f, 0.186326832f},
-std::array<float,2>{0.559657693f, 0.947503746f},
-std::array<float,2>{0.329793483f, 0.414234906f},
-std::array<float,2>{0.425294548f, 0.820025027f},
-std::array<float,2>{0.64134258f, 0.348123252f},
-std::array<float,2>{0.860553384f, 0.619676173f},
-std::array<float,2>{0.195276812f, 0.109852053f},
-std::array<float,2>{0.466309726f, 0.702592194f},
-std::array<float,2>{0.715971291f, 0.244287297f},
-std::array<float,2>{0.795402586f, 0.928665757f},
-std::array<float,2>{0.138167068f, 0.445300907f},
-std::array<float,2>{0.122080423f, 0.791614294f},
-std::array<float,2>{0.875291526f, 0.309732407f},
-std::array<float,2>{0.612504721f, 0.546105385f},
-std::array<float,2>{0.292053252f, 0.0340542644f},
-std::array<float,2>{0.23213689f, 0.5937047f},
-std::array<float,2>{0.824945271f, 0.065363422f},
-std::array<float,2>{0.667163312f, 0.850312352f},
-std::array<float,2>{0.395042896f, 0.334631205f},
-std::array<float,2>{0.363366306f, 0.994425535f},
-std::array<float,2>{0.502884209f, 0.389507651f},
-std::array<float,2>{0.983712137f, 0.625245869f},
-std::array<float,2>{0.0293226056f, 0.125362754f},
-std::array<float,2>{0.334123313f, 0.708557963f},
-std::array<float,2>{0.556540489f, 0.23257111f},
-std::array<float,2>{0.958784401f, 0.912420452f},
-std::array<float,2>{0.0328326114f, 0.456762731f},
-std::array<float,2>{0.188967481f, 0.802505732f},
-std::array<float,2>{0.865130424f, 0.296531111f},
-std::array<float,2>{0.6453318f, 0.551523209f},
-std::array<float,2>{0.429474503f, 0.0598704144f},
-std::array<float,2>{0.0694296062f, 0.562500715f},
-std::array<float,2>{0.917393148f, 0.0926141441f},
-std::array<float,2>{0.577051818f, 0.869463682f},
-std::array<float,2>{0.251247019f, 0.318240076f},
-std::array<float,2>{0.484769583f, 0.97347945f},
-std::array<float,2>{0.745764613f, 0.399377286f},
-std::array<float,2>{0.760119498f, 0.653702497f},
-std::array<float,2>{0.181270018f, 0.155952513f},
-std::array<float,2>{0.39288646f, 0.530075371f},
-std::array<float,2>{0.670373499f, 0.00260832254f},
-std::array<float,2>{0.821277499f, 0.775394022f},
-std::array<float,2>{0.227550462f, 0.257213354f},
-std::array<float,2>{0.0265010074f, 0.879956901f},
-std::array<float,2>{0.977534413f, 0.495319724f},
-std::array<float,2>{0.504184365f, 0.738949835f},
-std::array<float,2>{0.360435992f, 0.19521828f},
-std::array<float,2>{0.135514259f, 0.65769428f},
-std::array<float,2>{0.789319694f, 0.157336697f},
-std::array<float,2>{0.711714566f, 0.967407107f},
-std::array<float,2>{0.462149233f, 0.435885191f},
-std::array<float,2>{0.295371145f, 0.834539473f},
-std::array<float,2>{0.616495252f, 0.367440134f},
-std::array<float,2>{0.880778849f, 0.598113835f},
-std::array<float,2>{0.117813557f, 0.0963561535f},
-std::array<float,2>{0.269999921f, 0.613570809f},
-std::array<float,2>{0.583698392f, 0.11762961f},
-std::array<float,2>{0.935543358f, 0.823870659f},
-std::array<float,2>{0.0925507993f, 0.351878017f},
-std::array<float,2>{0.163948581f, 0.938503027f},
-std::array<float,2>{0.780560076f, 0.406605929f},
-std::array<float,2>{0.719468534f, 0.67318368f},
-std::array<float,2>{0.479834855f, 0.177192792f},
-std::array<float,2>{0.0603319183f, 0.727466464f},
-std::array<float,2>{0.945805967f, 0.216877222f},
-std::array<float,2>{0.533557951f, 0.903079033f},
-std::array<float,2>{0.324203759f, 0.470169634f},
-std::array<float,2>{0.409816474f, 0.755697668f},
-std::array<float,2>{0.63542062f, 0.272797704f},
-std::array<float,2>{0.852225423f, 0.512987375f},
-std::array<float,2>{0.204974696f, 0.0267322436f},
-std::array<float,2>{0.452364266f, 0.636488974f},
-std::array<float,2>{0.691284478f, 0.134230778f},
-std::array<float,2>{0.805388391f, 0.987860262f},
-std::array<float,2>{0.151464298f, 0.381023794f},
-std::array<float,2>{0.10602919f, 0.85301739f},
-std::array<float,2>{0.903294265f, 0.340944916f},
-std::array<float,2>{0.605701268f, 0.58436054f},
-std::array<float,2>{0.310245097f, 0.0711283907f},
-std::array<float,2>{0.248972058f, 0.537998855f},
-std::array<float,2>{0.838371277f, 0.0457768776f},
-std::array<float,2>{0.685117543f, 0.787423313f},
-std::array<float,2>{0.377124429f, 0.298583508f},
-std::array<float,2>{0.354438096f, 0.930352628f},
-std::array<float,2>{0.520971596f, 0.448670447f},
-std::array<float,2>{0.993810296f, 0.692544103f},
-std::array<float,2>{0.00724284491f, 0.239553422f},
-std::array<float,2>{0.297658831f, 0.683034837f},
-std::array<float,2>{0.598279595f, 0.181622118f},
-std::array<float,2>{0.892571628f, 0.950869739f},
-std::array<float,2>{0.101245537f, 0.418318242f},
-std::array<float,2>{0.148240954f, 0.81442982f},
-std::array<float,2>{0.803882003f, 0.345642537f},
-std::array<float,2>{0.697626531f, 0.621606588f},
-std::array<float,2>{0.438275754f, 0.11414431f},
-std::array<float,2>{0.0118765114f, 0.502699494f},
-std::array<float,2>{0.990876794f, 0.0194335692f},
-std::array<float,2>{0.529671967f, 0.760809124f},
-std::array<float,2>{0.345534861f, 0.279048681f},
-std::array<float,2>{0.388544977f, 0.894522667f},
-std::array<float,2>{0.678999126f, 0.482586294f},
-std::array<float,2>{0.831917286f, 0.724939227f},
-std::array<float,2>{0.236953452f, 0.208809972f},
-std::array<float,2>{0.473352045f, 0.589688361f},
-std::array<float,2>{0.730733871f, 0.0699655414f},
-std::array<float,2>{0.770065963f, 0.8467682f},
-std::array<float,2>{0.17151694f, 0.331623286f},
-std::array<float,2>{0.0796908289f, 0.998784184f},
-std::array<float,2>{0.927599847f, 0.38376084f},
-std::array<float,2>{0.592618227f, 0.630738616f},
-std::array<float,2>{0.281081289f, 0.129647017f},
-std::array<float,2>{0.212337181f, 0.697015345f},
-std::array<float,2>{0.849065065f, 0.247406304f},
-std::array<float,2>{0.632774293f, 0.924223065f},
-std::array<float,2>{0.416630745f, 0.440525681f},
-std::array<float,2>{0.315331787f, 0.796528459f},
-std::array<float,2>{0.539950907f, 0.304908216f},
-std::array<float,2>{0.944150031f, 0.540763438f},
-std::array<float,2>{0.0527666807f, 0.0370918885f},
-std::array<float,2>{0.373608321f, 0.561689794f},
-std::array<float,2>{0.514318466f, 0.0478418656f},
-std::array<float,2>{0.970040143f, 0.808297575f},
-std::array<float,2>{0.0204618499f, 0.283600301f},
-std::array<float,2>{0.218816891f, 0.916144133f},
-std::array<float,2>{0.814065516f, 0.465338081f},
-std::array<float,2>{0.660227299f, 0.714675128f},
-std::array<float,2>{0.400896102f, 0.222075403f},
-std::array<float,2>{0.114319891f, 0.643378437f},
-std::array<float,2>{0.886498213f, 0.142701283f},
-std::array<float,2>{0.619369447f, 0.977131069f},
-std::array<float,2>{0.287960321f, 0.394909889f},
-std::array<float,2>{0.457765311f, 0.86011219f},
-std::array<float,2>{0.70873791f, 0.322736502f},
-std::array<float,2>{0.785214424f, 0.572850227f},
-std::array<float,2>{0.130240381f, 0.0834271908f},
-std::array<float,2>{0.430122763f, 0.743604898f},
-std::array<float,2>{0.654410899f, 0.199754342f},
-std::array<float,2>{0.867210686f, 0.888393223f},
-std::array<float,2>{0.202554196f, 0.49113059f},
-std::array<float,2>{0.0408953354f, 0.768855095f},
-std::array<float,2>{0.968663454f, 0.258080721f},
-std::array<float,2>{0.551973701f, 0.518671572f},
-std::array<float,2>{0.33791554f, 0.00977188349f},
-std::array<float,2>{0.17633152f, 0.60531348f},
-std::array<float,2>{0.75526458f, 0.10650038f},
-std::array<float,2>{0.739449561f, 0.838579118f},
-std::array<float,2>{0.499552369f, 0.364352793f},
-std::array<float,2>{0.260575026f, 0.954889238f},
-std::array<float,2>{0.563911676f, 0.427162617f},
-std::array<float,2>{0.907114029f, 0.666668355f},
-std::array<float,2>{0.0742948875f, 0.167029083f},
-std::array<float,2>{0.255016476f, 0.720369577f},
-std::array<float,2>{0.573710918f, 0.203846231f},
-std::array<float,2>{0.918278515f, 0.897361219f},
-std::array<float,2>{0.0633835867f, 0.480402797f},
-std::array<float,2>{0.186371401f, 0.763205707f},
-std::array<float,2>{0.76261878f, 0.274029195f},
-std::array<float,2>{0.74927038f, 0.506810963f},
-std::array<float,2>{0.489378691f, 0.0233341809f},
-std::array<float,2>{0.0376288705f, 0.619431317f},
-std::array<float,2>{0.956585884f, 0.110063575f},
-std::array<float,2>{0.561089814f, 0.819575071f},
-std::array<float,2>{0.330903232f, 0.348567575f},
-std::array<float,2>{0.422403097f, 0.947756171f},
-std::array<float,2>{0.643395662f, 0.414941341f},
-std::array<float,2>{0.862666309f, 0.68599683f},
-std::array<float,2>{0.19329527f, 0.185712188f},
-std::array<float,2>{0.467841327f, 0.546473145f},
-std::array<float,2>{0.718200862f, 0.0333453119f},
-std::array<float,2>{0.793627739f, 0.791354358f},
-std::array<float,2>{0.140154585f, 0.310357869f},
-std::array<float,2>{0.124094419f, 0.927885115f},
-std::array<float,2>{0.877785325f, 0.44457233f},
-std::array<float,2>{0.609724164f, 0.702803731f},
-std::array<float,2>{0.289231837f, 0.245101199f},
-std::array<float,2>{0.232856169f, 0.625560999f},
-std::array<float,2>{0.826575279f, 0.125871286f},
-std::array<float,2>{0.665039062f, 0.994719803f},
-std::array<float,2>{0.398066938f, 0.388705224f},
-std::array<float,2>{0.366994292f, 0.849642277f},
-std::array<float,2>{0.500185549f, 0.334162444f},
-std::array<float,2>{0.981911063f, 0.593235552f},
-std::array<float,2>{0.0280947164f, 0.0645675436f},
-std::array<float,2>{0.32602945f, 0.575377226f},
-std::array<float,2>{0.535274744f, 0.0814861208f},
-std::array<float,2>{0.951654971f, 0.865208626f},
-std::array<float,2>{0.0572827198f, 0.327079505f},
-std::array<float,2>{0.207211405f, 0.982775033f},
-std::array<float,2>{0.856509149f, 0.393459082f},
-std::array<float,2>{0.636924624f, 0.644799531f},
-std::array<float,2>{0.412446201f, 0.1474282f},
-std::array<float,2>{0.0883219093f, 0.717623353f},
-std::array<float,2>{0.931459725f, 0.224026009f},
-std::array<float,2>{0.580150604f, 0.918219328f},
-std::array<float,2>{0.266036391f, 0.464434683f},
-std::array<float,2>{0.480886608f, 0.809422731f},
-std::array<float,2>{0.726209342f, 0.286592543f},
-std::array<float,2>{0.775979161f, 0.55536145f},
-std::array<float,2>{0.156358048f, 0.0532522239f},
-std::array<float,2>{0.381550193f, 0.668703079f},
-std::array<float,2>{0.680920839f, 0.169937611f},
-std::array<float,2>{0.84242034f, 0.959699392f},
-std::array<float,2>{0.245900109f, 0.4226107f},
-std::array<float,2>{0.0016590138f, 0.840620041f},
-std::array<float,2>{0.996933162f, 0.362263381f},
-std::array<float,2>{0.516619921f, 0.607587278f},
-std::array<float,2>{0.358332396f, 0.10168606f},
-std::array<float,2>{0.156067863f, 0.522930801f},
-std::array<float,2>{0.810921609f, 0.0154711381f},
-std::array<float,2>{0.692803919f, 0.770799756f},
-std::array<float,2>{0.446063042f, 0.263950467f},
-std::array<float,2>{0.306448758f, 0.884976983f},
-std::array<float,2>{0.605023563f, 0.487927556f},
-std::array<float,2>{0.898522317f, 0.748095036f},
-std::array<float,2>{0.105274267f, 0.196498424f},
-std::array<float,2>{0.349251181f, 0.649846792f},
-std::array<float,2>{0.526919782f, 0.149406031f},
-std::array<float,2>{0.986316919f, 0.970143855f},
-std::array<float,2>{0.00790397171f, 0.403445572f},
-std::array<float,2>{0.239855915f, 0.873477101f},
-std::array<float,2>{0.83491683f, 0.315454453f},
-std::array<float,2>{0.674491405f, 0.567080617f},
-std::array<float,2>{0.384542912f, 0.0895714387f},
-std::array<float,2>{0.0945594162f, 0.549593329f},
-std::array<float,2>{0.896163225f, 0.0556502417f},
-std::array<float,2>{0.596342385f, 0.797934651f},
-std::array<float,2>{0.304403573f, 0.289884359f},
-std::array<float,2>{0.444557458f, 0.907813311f},
-std::array<float,2>{0.700411737f, 0.458920389f},
-std::array<float,2>{0.797894716f, 0.706432283f},
-std::array<float,2>{0.143805444f, 0.227758527f},
-std::array<float,2>{0.418095708f, 0.597249389f},
-std::array<float,2>{0.625679076f, 0.100402318f},
-std::array<float,2>{0.845021486f, 0.830532372f},
-std::array<float,2>{0.216767788f, 0.372332662f},
-std::array<float,2>{0.0487556718f, 0.964470685f},
-std::array<float,2>{0.941151083f, 0.432374299f},
-std::array<float,2>{0.543992937f, 0.661266148f},
-std::array<float,2>{0.316896677f, 0.161977381f},
-std::array<float,2>{0.166028038f, 0.734414518f},
-std::array<float,2>{0.766814888f, 0.18950364f},
-std::array<float,2>{0.72802794f, 0.875850856f},
-std::array<float,2>{0.470086187f, 0.49667716f},
-std::array<float,2>{0.275330573f, 0.777619839f},
-std::array<float,2>{0.587080777f, 0.253676444f},
-std::array<float,2>{0.923165083f, 0.526063144f},
-std::array<float,2>{0.0850360617f, 0.004557651f},
-std::array<float,2>{0.28138265f, 0.510871947f},
-std::array<float,2>{0.623344481f, 0.0309523195f},
-std::array<float,2>{0.889369547f, 0.753743112f},
-std::array<float,2>{0.112366445f, 0.266682744f},
-std::array<float,2>{0.125856355f, 0.899230719f},
-std::array<float,2>{0.784010589f, 0.475670129f},
-std::array<float,2>{0.705063879f, 0.733920515f},
-std::array<float,2>{0.455408454f, 0.213533148f},
-std::array<float,2>{0.0176866632f, 0.677214265f},
-std::array<float,2>{0.97428447f, 0.172557965f},
-std::array<float,2>{0.510437727f, 0.94452703f},
-std::array<float,2>{0.368336141f, 0.410998702f},
-std::array<float,2>{0.402849346f, 0.827876329f},
-std::array<float,2>{0.659737289f, 0.356386125f},
-std::array<float,2>{0.817649722f, 0.610556006f},
-std::array<float,2>{0.225919187f, 0.122179084f},
-std::array<float,2>{0.495681494f, 0.689102232f},
-std::array<float,2>{0.735964537f, 0.236854151f},
-std::array<float,2>{0.751728177f, 0.93646419f},
-std::array<float,2>{0.175705612f, 0.44972831f},
-std::array<float,2>{0.0704008788f, 0.781958997f},
-std::array<float,2>{0.912059605f, 0.301543444f},
-std::array<float,2>{0.568060815f, 0.534396768f},
-std::array<float,2>{0.262046427f, 0.0422512032f},
-std::array<float,2>{0.195402697f, 0.579280615f},
-std::array<float,2>{0.871323526f, 0.0775830373f},
-std::array<float,2>{0.651047468f, 0.855996132f},
-std::array<float,2>{0.435948342f, 0.339358091f},
-std::array<float,2>{0.341451317f, 0.991680205f},
-std::array<float,2>{0.5477705f, 0.376652867f},
-std::array<float,2>{0.963663638f, 0.637672842f},
-std::array<float,2>{0.044863902f, 0.139506772f},
-std::array<float,2>{0.363129944f, 0.740873516f},
-std::array<float,2>{0.506908476f, 0.192277104f},
-std::array<float,2>{0.979257584f, 0.881732047f},
-std::array<float,2>{0.0247065518f, 0.492329389f},
-std::array<float,2>{0.229965866f, 0.774653435f},
-std::array<float,2>{0.824041605f, 0.254287809f},
-std::array<float,2>{0.668323576f, 0.527392447f},
-std::array<float,2>{0.392307192f, 0.00181885692f},
-std::array<float,2>{0.119354323f, 0.600201368f},
-std::array<float,2>{0.882579565f, 0.0945426747f},
-std::array<float,2>{0.613523841f, 0.833272398f},
-std::array<float,2>{0.293896317f, 0.3697007f},
-std::array<float,2>{0.463143945f, 0.965938807f},
-std::array<float,2>{0.713802159f, 0.434850156f},
-std::array<float,2>{0.792588532f, 0.659212172f},
-std::array<float,2>{0.13305594f, 0.158695832f},
-std::array<float,2>{0.425854832f, 0.553633869f},
-std::array<float,2>{0.646985173f, 0.0605582558f},
-std::array<float,2>{0.866466343f, 0.804398358f},
-std::array<float,2>{0.191067085f, 0.294764161f},
-std::array<float,2>{0.0345228352f, 0.910196722f},
-std::array<float,2>{0.959578693f, 0.453346074f},
-std::array<float,2>{0.557338834f, 0.710081518f},
-std::array<float,2>{0.332072586f, 0.231297836f},
-std::array<float,2>{0.181998f, 0.655730724f},
-std::array<float,2>{0.758883595f, 0.153034762f},
-std::array<float,2>{0.742823482f, 0.974939764f},
-std::array<float,2>{0.487921774f, 0.40229696f},
-std::array<float,2>{0.253448993f, 0.868297994f},
-std::array<float,2>{0.574444115f, 0.319565237f},
-std::array<float,2>{0.914699435f, 0.565130353f},
-std::array<float,2>{0.066742152f, 0.0912226364f},
-std::array<float,2>{0.311743915f, 0.583406866f},
-std::array<float,2>{0.608166218f, 0.0727299601f},
-std::array<float,2>{0.904706955f, 0.854921937f},
-std::array<float,2>{0.108624816f, 0.342056632f},
-std::array<float,2>{0.150000274f, 0.98504138f},
-std::array<float,2>{0.807653964f, 0.378989369f},
-std::array<float,2>{0.688356102f, 0.633441389f},
-std::array<float,2>{0.450039446f, 0.136710167f},
-std::array<float,2>{0.0056846342f, 0.693958938f},
-std::array<float,2>{0.995029569f, 0.241523758f},
-std::array<float,2>{0.522493839f, 0.932740986f},
-std::array<float,2>{0.352636755f, 0.446152985f},
-std::array<float,2>{0.375197172f, 0.785776496f},
-std::array<float,2>{0.686172545f, 0.299831957f},
-std::array<float,2>{0.837591648f, 0.536810577f},
-std::array<float,2>{0.247835055f, 0.0433916338f},
-std::array<float,2>{0.477397829f, 0.675537765f},
-std::array<float,2>{0.721973658f, 0.177988037f},
-std::array<float,2>{0.777913034f, 0.941016078f},
-std::array<float,2>{0.161313936f, 0.409803987f},
-std::array<float,2>{0.0913245007f, 0.820376754f},
-std::array<float,2>{0.935603619f, 0.354883522f},
-std::array<float,2>{0.585854411f, 0.616587162f},
-std::array<float,2>{0.273034662f, 0.119400933f},
-std::array<float,2>{0.206069708f, 0.514528453f},
-std::array<float,2>{0.85384506f, 0.0235917475f},
-std::array<float,2>{0.634710789f, 0.756581128f},
-std::array<float,2>{0.407069355f, 0.270447344f},
-std::array<float,2>{0.321204603f, 0.905217588f},
-std::array<float,2>{0.532988429f, 0.471087694f},
-std::array<float,2>{0.947853267f, 0.730463982f},
-std::array<float,2>{0.0613123626f, 0.21504502f},
-std::array<float,2>{0.277983218f, 0.632563651f},
-std::array<float,2>{0.590190172f, 0.131686777f},
-std::array<float,2>{0.928187847f, 0.996258259f},
-std::array<float,2>{0.0803015307f, 0.385083109f},
-std::array<float,2>{0.168196172f, 0.843873382f},
-std::array<float,2>{0.773402214f, 0.328345686f},
-std::array<float,2>{0.733799279f, 0.586864889f},
-std::array<float,2>{0.474613965f, 0.0672660694f},
-std::array<float,2>{0.0524647683f, 0.542929709f},
-std::array<float,2>{0.942191303f, 0.038460277f},
-std::array<float,2>{0.541965425f, 0.793797433f},
-std::array<float,2>{0.313943863f, 0.306708187f},
-std::array<float,2>{0.415749937f, 0.923481822f},
-std::array<float,2>{0.629288077f, 0.438144267f},
-std::array<float,2>{0.850773871f, 0.698675275f},
-std::array<float,2>{0.213282809f, 0.249858648f},
-std::array<float,2>{0.440660655f, 0.624354661f},
-std::array<float,2>{0.6955809f, 0.115408808f},
-std::array<float,2>{0.80263418f, 0.815946937f},
-std::array<float,2>{0.144850343f, 0.346933275f},
-std::array<float,2>{0.0983479023f, 0.95249325f},
-std::array<float,2>{0.893186152f, 0.420210928f},
-std::array<float,2>{0.601338506f, 0.681386411f},
-std::array<float,2>{0.300323099f, 0.183506295f},
-std::array<float,2>{0.235179409f, 0.723200321f},
-std::array<float,2>{0.829764962f, 0.210092366f},
-std::array<float,2>{0.676646292f, 0.890921235f},
-std::array<float,2>{0.389317364f, 0.480638325f},
-std::array<float,2>{0.34670791f, 0.758489668f},
-std::array<float,2>{0.528570294f, 0.280508459f},
-std::array<float,2>{0.989648044f, 0.500044286f},
-std::array<float,2>{0.0139125818f, 0.0156275034f},
-std::array<float,2>{0.337842286f, 0.517105818f},
-std::array<float,2>{0.553518713f, 0.00887503661f},
-std::array<float,2>{0.966517925f, 0.766127586f},
-std::array<float,2>{0.0417569056f, 0.260314554f},
-std::array<float,2>{0.199534625f, 0.88915199f},
-std::array<float,2>{0.870819509f, 0.489214718f},
-std::array<float,2>{0.652549088f, 0.744426429f},
-std::array<float,2>{0.432109386f, 0.203097075f},
-std::array<float,2>{0.0780149922f, 0.66542083f},
-std::array<float,2>{0.908266902f, 0.165878445f},
-std::array<float,2>{0.565945089f, 0.955779374f},
-std::array<float,2>{0.258950591f, 0.428765893f},
-std::array<float,2>{0.49745363f, 0.837044895f},
-std::array<float,2>{0.74081403f, 0.366686434f},
-std::array<float,2>{0.756552577f, 0.603060842f},
-std::array<float,2>{0.177842379f, 0.107841454f},
-std::array<float,2>{0.39937079f, 0.711448848f},
-std::array<float,2>{0.66372627f, 0.218951359f},
-std::array<float,2>{0.816344142f, 0.914067328f},
-std::array<float,2>{0.221313074f, 0.468285024f},
-std::array<float,2>{0.0230980031f, 0.804957151f},
-std::array<float,2>{0.972160578f, 0.282916665f},
-std::array<float,2>{0.51263082f, 0.558827102f},
-std::array<float,2>{0.372621179f, 0.0494811311f},
-std::array<float,2>{0.132150576f, 0.571700215f},
-std::array<float,2>{0.788948119f, 0.0842034146f},
-std::array<float,2>{0.709310949f, 0.861809313f},
-std::array<float,2>{0.460719734f, 0.321812272f},
-std::array<float,2>{0.285325378f, 0.97966975f},
-std::array<float,2>{0.618942857f, 0.398386955f},
-std::array<float,2>{0.883554637f, 0.641573489f},
-std::array<float,2>{0.116404086f, 0.142033473f},
-std::array<float,2>{0.29250142f, 0.701018453f},
-std::array<float,2>{0.612914443f, 0.242468119f},
-std::array<float,2>{0.875634313f, 0.925987303f},
-std::array<float,2>{0.123036131f, 0.443022937f},
-std::array<float,2>{0.138420984f, 0.789063692f},
-std::array<float,2>{0.795847714f, 0.311574757f},
-std::array<float,2>{0.716420233f, 0.543199122f},
-std::array<float,2>{0.466168791f, 0.0316444673f},
-std::array<float,2>{0.0299805459f, 0.591674566f},
-std::array<float,2>{0.984217882f, 0.0639446899f},
-std::array<float,2>{0.501979947f, 0.848178089f},
-std::array<float,2>{0.364161342f, 0.333891749f},
-std::array<float,2>{0.394676298f, 0.993391216f},
-std::array<float,2>{0.667837679f, 0.387575775f},
-std::array<float,2>{0.824541032f, 0.628703892f},
-std::array<float,2>{0.231628135f, 0.128737092f},
-std::array<float,2>{0.490512162f, 0.504684269f},
-std::array<float,2>{0.747799098f, 0.019594837f},
-std::array<float,2>{0.764441848f, 0.764924467f},
-std::array<float,2>{0.184322f, 0.27575615f},
-std::array<float,2>{0.0661145151f, 0.895371735f},
-std::array<float,2>{0.921501994f, 0.477392137f},
-std::array<float,2>{0.570806324f, 0.720958948f},
-std::array<float,2>{0.257271707f, 0.205998808f},
-std::array<float,2>{0.194823653f, 0.684793115f},
-std::array<float,2>{0.860953093f, 0.18421644f},
-std::array<float,2>{0.64074409f, 0.947196424f},
-std::array<float,2>{0.42522645f, 0.416119963f},
-std::array<float,2>{0.329300046f, 0.817204297f},
-std::array<float,2>{0.560420811f, 0.351506263f},
-std::array<float,2>{0.953473091f, 0.619117618f},
-std::array<float,2>{0.0358409844f, 0.111509398f},
-std::array<float,2>{0.356023133f, 0.605653465f},
-std::array<float,2>{0.518388867f, 0.104999177f},
-std::array<float,2>{0.99938035f, 0.842179f},
-std::array<float,2>{0.00234250841f, 0.360606402f},
-std::array<float,2>{0.24280943f, 0.957173884f},
-std::array<float,2>{0.84150821f, 0.425528109f},
-std::array<float,2>{0.682405233f, 0.670874953f},
-std::array<float,2>{0.380696744f, 0.16972591f},
-std::array<float,2>{0.102657184f, 0.746720135f},
-std::array<float,2>{0.90202117f, 0.197575107f},
-std::array<float,2>{0.60214293f, 0.884099066f},
-std::array<float,2>{0.306776613f, 0.486076146f},
-std::array<float,2>{0.448848963f, 0.772853971f},
-std::array<float,2>{0.693949997f, 0.26294139f},
-std::array<float,2>{0.810002565f, 0.521429896f},
-std::array<float,2>{0.153348908f, 0.0126819089f},
-std::array<float,2>{0.411983043f, 0.646735966f},
-std::array<float,2>{0.639131188f, 0.145723045f},
-std::array<float,2>{0.859003901f, 0.981073499f},
-std::array<float,2>{0.209788218f, 0.390696615f},
-std::array<float,2>{0.0564172007f, 0.866874874f},
-std::array<float,2>{0.949319601f, 0.325903803f},
-std::array<float,2>{0.538459301f, 0.576454818f},
-std::array<float,2>{0.32703191f, 0.0794965401f},
-std::array<float,2>{0.158919141f, 0.557095349f},
-std::array<float,2>{0.773757875f, 0.0511236079f},
-std::array<float,2>{0.724499524f, 0.812498808f},
-std::array<float,2>{0.484003842f, 0.288146138f},
-std::array<float,2>{0.267747194f, 0.920973837f},
-std::array<float,2>{0.578319728f, 0.461874008f},
-std::array<float,2>{0.932677388f, 0.714932263f},
-std::array<float,2>{0.0876731053f, 0.224993512f},
-std::array<float,2>{0.318772167f, 0.663811982f},
-std::array<float,2>{0.545292675f, 0.163377807f},
-std::array<float,2>{0.937928081f, 0.961877823f},
-std::array<float,2>{0.0491008759f, 0.43156004f},
-std::array<float,2>{0.218236089f, 0.82961303f},
-std::array<float,2>{0.846121132f, 0.374107599f},
-std::array<float,2>{0.628231525f, 0.595633984f},
-std::array<float,2>{0.421277583f, 0.097674042f},
-std::array<float,2>{0.082095027f, 0.525276303f},
-std::array<float,2>{0.925685108f, 0.00615610974f},
-std::array<float,2>{0.588685095f, 0.780692339f},
-std::array<float,2>{0.276332855f, 0.25072962f},
-std::array<float,2>{0.4718633f, 0.878082752f},
-std::array<float,2>{0.729868472f, 0.498449594f},
-std::array<float,2>{0.76906991f, 0.737291038f},
-std::array<float,2>{0.164409548f, 0.188314006f},
-std::array<float,2>{0.385725021f, 0.570142448f},
-std::array<float,2>{0.672695518f, 0.0873202756f},
-std::array<float,2>{0.83216399f, 0.871127605f},
-std::array<float,2>{0.241318583f, 0.314007699f},
-std::array<float,2>{0.0116094556f, 0.972176194f},
-std::array<float,2>{0.987141728f, 0.404480517f},
-std::array<float,2>{0.523531795f, 0.652199388f},
-std::array<float,2>{0.350536644f, 0.151138693f},
-std::array<float,2>{0.140926063f, 0.703794777f},
-std::array<float,2>{0.800086796f, 0.229906082f},
-std::array<float,2>{0.70285517f, 0.909134507f},
-std::array<float,2>{0.441756159f, 0.459515184f},
-std::array<float,2>{0.301524401f, 0.799309194f},
-std::array<float,2>{0.593889773f, 0.291629106f},
-std::array<float,2>{0.898241282f, 0.546969891f},
-std::array<float,2>{0.0959802493f, 0.0583821647f},
-std::array<float,2>{0.265396297f, 0.531356633f},
-std::array<float,2>{0.569561124f, 0.0408780426f},
-std::array<float,2>{0.913158953f, 0.783558905f},
-std::array<float,2>{0.073208712f, 0.304187506f},
-std::array<float,2>{0.172758654f, 0.934644163f},
-std::array<float,2>{0.752500832f, 0.451601118f},
-std::array<float,2>{0.737746f, 0.690745056f},
-std::array<float,2>{0.492934614f, 0.235236675f},
-std::array<float,2>{0.0459350199f, 0.63954252f},
-std::array<float,2>{0.961221159f, 0.136886179f},
-std::array<float,2>{0.550041378f, 0.99002105f},
-std::array<float,2>{0.34296304f, 0.377736509f},
-std::array<float,2>{0.434963018f, 0.857574344f},
-std::array<float,2>{0.649554372f, 0.337882966f},
-std::array<float,2>{0.873069346f, 0.58013159f},
-std::array<float,2>{0.199126422f, 0.0750682354f},
-std::array<float,2>{0.45415616f, 0.731385052f},
-std::array<float,2>{0.706730902f, 0.211786091f},
-std::array<float,2>{0.782787383f, 0.902158082f},
-std::array<float,2>{0.128600627f, 0.473201275f},
-std::array<float,2>{0.110597447f, 0.750275016f},
-std::array<float,2>{0.88858664f, 0.269512832f},
-std::array<float,2>{0.622356415f, 0.509283364f},
-std::array<float,2>{0.284274727f, 0.0291804466f},
-std::array<float,2>{0.224235877f, 0.612075984f},
-std::array<float,2>{0.820022941f, 0.124677703f},
-std::array<float,2>{0.656699657f, 0.824236929f},
-std::array<float,2>{0.405282497f, 0.358900994f},
-std::array<float,2>{0.370783776f, 0.942448914f},
-std::array<float,2>{0.509556115f, 0.413630068f},
-std::array<float,2>{0.974748969f, 0.678270221f},
-std::array<float,2>{0.0171528496f, 0.174510837f},
-std::array<float,2>{0.322630793f, 0.729272485f},
-std::array<float,2>{0.534568727f, 0.216651157f},
-std::array<float,2>{0.94634366f, 0.905657709f},
-std::array<float,2>{0.0590530857f, 0.471773654f},
-std::array<float,2>{0.203466088f, 0.757187128f},
-std::array<float,2>{0.853227377f, 0.270985723f},
-std::array<float,2>{0.635787249f, 0.514955103f},
-std::array<float,2>{0.408445567f, 0.0252694879f},
-std::array<float,2>{0.0930072218f, 0.615873039f},
-std::array<float,2>{0.93456775f, 0.120216437f},
-std::array<float,2>{0.582609177f, 0.822205305f},
-std::array<float,2>{0.271089226f, 0.353597969f},
-std::array<float,2>{0.479363948f, 0.93994683f},
-std::array<float,2>{0.719825983f, 0.4083938f},
-std::array<float,2>{0.779299021f, 0.67443645f},
-std::array<float,2>{0.162984654f, 0.178884968f},
-std::array<float,2>{0.378080636f, 0.53574425f},
-std::array<float,2>{0.684556484f, 0.0445500836f},
-std::array<float,2>{0.839361846f, 0.786286414f},
-std::array<float,2>{0.249156848f, 0.299442589f},
-std::array<float,2>{0.00601211702f, 0.932196617f},
-std::array<float,2>{0.992944121f, 0.44637385f},
-std::array<float,2>{0.519922853f, 0.695208848f},
-std::array<float,2>{0.354691058f, 0.240337953f},
-std::array<float,2>{0.15055871f, 0.634261787f},
-std::array<float,2>{0.806265652f, 0.135551378f},
-std::array<float,2>{0.690299571f, 0.985373139f},
-std::array<float,2>{0.451805532f, 0.380827367f},
-std::array<float,2>{0.309221566f, 0.853607237f},
-std::array<float,2>{0.607318878f, 0.343222022f},
-std::array<float,2>{0.903694749f, 0.582546115f},
-std::array<float,2>{0.107377514f, 0.0741549879f},
-std::array<float,2>{0.250630528f, 0.565859377f},
-std::array<float,2>{0.577706397f, 0.0906405896f},
-std::array<float,2>{0.916595817f, 0.867708683f},
-std::array<float,2>{0.0687795654f, 0.319035798f},
-std::array<float,2>{0.180031344f, 0.975633919f},
-std::array<float,2>{0.761113405f, 0.401311815f},
-std::array<float,2>{0.744644225f, 0.654750407f},
-std::array<float,2>{0.485896379f, 0.154036552f},
-std::array<float,2>{0.0316520445f, 0.709878325f},
-std::array<float,2>{0.957556486f, 0.231640831f},
-std::array<float,2>{0.555328906f, 0.911910355f},
-std::array<float,2>{0.3356601f, 0.454715967f},
-std::array<float,2>{0.428478897f, 0.803450048f},
-std::array<float,2>{0.646141946f, 0.293891102f},
-std::array<float,2>{0.863971472f, 0.554507911f},
-std::array<float,2>{0.188207373f, 0.0623417385f},
-std::array<float,2>{0.46141535f, 0.658754587f},
-std::array<float,2>{0.712582529f, 0.159767792f},
-std::array<float,2>{0.790936232f, 0.965764999f},
-std::array<float,2>{0.136256337f, 0.434083849f},
-std::array<float,2>{0.118775778f, 0.832355082f},
-std::array<float,2>{0.879120708f, 0.370452255f},
-std::array<float,2>{0.616171598f, 0.601385295f},
-std::array<float,2>{0.296520859f, 0.0948530138f},
-std::array<float,2>{0.227474362f, 0.528466761f},
-std::array<float,2>{0.821888208f, 0.000558611413f},
-std::array<float,2>{0.671012521f, 0.774398863f},
-std::array<float,2>{0.394358605f, 0.255816549f},
-std::array<float,2>{0.359937549f, 0.882696271f},
-std::array<float,2>{0.504971683f, 0.49347502f},
-std::array<float,2>{0.978364885f, 0.74154073f},
-std::array<float,2>{0.0254892129f, 0.193100199f},
-std::array<float,2>{0.288479686f, 0.642373204f},
-std::array<float,2>{0.620383143f, 0.141170904f},
-std::array<float,2>{0.885379136f, 0.978628278f},
-std::array<float,2>{0.113660552f, 0.396495879f},
-std::array<float,2>{0.129036814f, 0.863047123f},
-std::array<float,2>{0.786219001f, 0.321284026f},
-std::array<float,2>{0.707885563f, 0.570970297f},
-std::array<float,2>{0.458258033f, 0.0852772668f},
-std::array<float,2>{0.0207383037f, 0.559599996f},
-std::array<float,2>{0.969318628f, 0.0499843583f},
-std::array<float,2>{0.515285313f, 0.806287527f},
-std::array<float,2>{0.374593258f, 0.281682432f},
-std::array<float,2>{0.402005613f, 0.915765643f},
-std::array<float,2>{0.661725402f, 0.466979623f},
-std::array<float,2>{0.812596262f, 0.71283865f},
-std::array<float,2>{0.219908342f, 0.220099419f},
-std::array<float,2>{0.498141825f, 0.6024822f},
-std::array<float,2>{0.738703668f, 0.10917791f},
-std::array<float,2>{0.754276514f, 0.836133897f},
-std::array<float,2>{0.177074343f, 0.365548879f},
-std::array<float,2>{0.0757013857f, 0.956612706f},
-std::array<float,2>{0.907732785f, 0.428159833f},
-std::array<float,2>{0.56339854f, 0.664281666f},
-std::array<float,2>{0.26099661f, 0.164681658f},
-std::array<float,2>{0.202036962f, 0.745159507f},
-std::array<float,2>{0.868986428f, 0.201317668f},
-std::array<float,2>{0.655531108f, 0.889910161f},
-std::array<float,2>{0.431061983f, 0.48927933f},
-std::array<float,2>{0.339385122f, 0.76692003f},
-std::array<float,2>{0.550885737f, 0.260760725f},
-std::array<float,2>{0.967079699f, 0.516479909f},
-std::array<float,2>{0.0390805714f, 0.00815903675f},
-std::array<float,2>{0.344292492f, 0.501260698f},
-std::array<float,2>{0.530831158f, 0.0168458987f},
-std::array<float,2>{0.991950452f, 0.759440482f},
-std::array<float,2>{0.0127028292f, 0.279848069f},
-std::array<float,2>{0.238127708f, 0.892006516f},
-std::array<float,2>{0.8306247f, 0.481482834f},
-std::array<float,2>{0.678200066f, 0.723977327f},
-std::array<float,2>{0.387280822f, 0.209029794f},
-std::array<float,2>{0.100490026f, 0.679719269f},
-std::array<float,2>{0.891560853f, 0.182297423f},
-std::array<float,2>{0.599047244f, 0.951380074f},
-std::array<float,2>{0.298327506f, 0.421128303f},
-std::array<float,2>{0.438637763f, 0.815015614f},
-std::array<float,2>{0.698546171f, 0.346247286f},
-std::array<float,2>{0.803429067f, 0.623970926f},
-std::array<float,2>{0.146486074f, 0.117172234f},
-std::array<float,2>{0.417716503f, 0.697862923f},
-std::array<float,2>{0.631436527f, 0.248531476f},
-std::array<float,2>{0.848218858f, 0.922769547f},
-std::array<float,2>{0.211427853f, 0.438805073f},
-std::array<float,2>{0.0544644892f, 0.794667065f},
-std::array<float,2>{0.945140183f, 0.307939231f},
-std::array<float,2>{0.540880561f, 0.541368544f},
-std::array<float,2>{0.316264421f, 0.0372237526f},
-std::array<float,2>{0.170782119f, 0.587466896f},
-std::array<float,2>{0.770648599f, 0.0674107447f},
-std::array<float,2>{0.731447458f, 0.845593274f},
-std::array<float,2>{0.4740206f, 0.329498947f},
-std::array<float,2>{0.279857308f, 0.997855783f},
-std::array<float,2>{0.593654633f, 0.385996282f},
-std::array<float,2>{0.926258326f, 0.630906641f},
-std::array<float,2>{0.0786854178f, 0.13206251f},
-std::array<float,2>{0.266895801f, 0.716189563f},
-std::array<float,2>{0.581725776f, 0.226082608f},
-std::array<float,2>{0.929765165f, 0.919925869f},
-std::array<float,2>{0.0898388252f, 0.462637365f},
-std::array<float,2>{0.157338291f, 0.810629785f},
-std::array<float,2>{0.777053952f, 0.287756741f},
-std::array<float,2>{0.724887908f, 0.558050513f},
-std::array<float,2>{0.482331842f, 0.0520292968f},
-std::array<float,2>{0.0579067841f, 0.57722044f},
-std::array<float,2>{0.952340722f, 0.0786091015f},
-std::array<float,2>{0.536826372f, 0.865335703f},
-std::array<float,2>{0.324572593f, 0.324588776f},
-std::array<float,2>{0.414012015f, 0.982085407f},
-std::array<float,2>{0.637730062f, 0.392300129f},
-std::array<float,2>{0.85601449f, 0.647573709f},
-std::array<float,2>{0.208179951f, 0.145270899f},
-std::array<float,2>{0.44707498f, 0.520440698f},
-std::array<float,2>{0.692368388f, 0.0130284745f},
-std::array<float,2>{0.81237638f, 0.771544337f},
-std::array<float,2>{0.154449224f, 0.262218207f},
-std::array<float,2>{0.104116186f, 0.883415282f},
-std::array<float,2>{0.900013268f, 0.48457858f},
-std::array<float,2>{0.604356945f, 0.747822285f},
-std::array<float,2>{0.305140674f, 0.198399708f},
-std::array<float,2>{0.245087504f, 0.671641409f},
-std::array<float,2>{0.843440354f, 0.168484911f},
-std::array<float,2>{0.68032223f, 0.958981514f},
-std::array<float,2>{0.381874502f, 0.424476743f},
-std::array<float,2>{0.359332085f, 0.84357655f},
-std::array<float,2>{0.516149163f, 0.359503597f},
-std::array<float,2>{0.997630298f, 0.607412755f},
-std::array<float,2>{0.000560706772f, 0.103745416f},
-std::array<float,2>{0.331764936f, 0.617730319f},
-std::array<float,2>{0.561790764f, 0.113035962f},
-std::array<float,2>{0.955384374f, 0.818150699f},
-std::array<float,2>{0.0381398089f, 0.350254297f},
-std::array<float,2>{0.192128643f, 0.946091413f},
-std::array<float,2>{0.861404657f, 0.417023748f},
-std::array<float,2>{0.644281209f, 0.684062421f},
-std::array<float,2>{0.423432946f, 0.18537949f},
-std::array<float,2>{0.063831456f, 0.722055852f},
-std::array<float,2>{0.919691205f, 0.206943274f},
-std::array<float,2>{0.572882473f, 0.895672739f},
-std::array<float,2>{0.254170209f, 0.477851152f},
-std::array<float,2>{0.488423198f, 0.764590085f},
-std::array<float,2>{0.748843014f, 0.277012944f},
-std::array<float,2>{0.763397694f, 0.505210936f},
-std::array<float,2>{0.186932132f, 0.0206831638f},
-std::array<float,2>{0.396969974f, 0.627444386f},
-std::array<float,2>{0.66428405f, 0.127567366f},
-std::array<float,2>{0.827965677f, 0.992928565f},
-std::array<float,2>{0.234259441f, 0.388365388f},
-std::array<float,2>{0.0289891083f, 0.849171758f},
-std::array<float,2>{0.981141746f, 0.332543641f},
-std::array<float,2>{0.501719832f, 0.590342224f},
-std::array<float,2>{0.365479589f, 0.0626171008f},
-std::array<float,2>{0.13934575f, 0.544449091f},
-std::array<float,2>{0.794252098f, 0.0331382565f},
-std::array<float,2>{0.717178106f, 0.791005075f},
-std::array<float,2>{0.467036486f, 0.311334491f},
-std::array<float,2>{0.291008323f, 0.92766428f},
-std::array<float,2>{0.610846698f, 0.441707402f},
-std::array<float,2>{0.87844038f, 0.699970663f},
-std::array<float,2>{0.123081289f, 0.24356164f},
-std::array<float,2>{0.367554516f, 0.678844988f},
-std::array<float,2>{0.510809779f, 0.174863622f},
-std::array<float,2>{0.973503947f, 0.942043483f},
-std::array<float,2>{0.0187547598f, 0.412977546f},
-std::array<float,2>{0.225432917f, 0.825610101f},
-std::array<float,2>{0.816976249f, 0.357696801f},
-std::array<float,2>{0.658776999f, 0.612595439f},
-std::array<float,2>{0.403450251f, 0.123244859f},
-std::array<float,2>{0.111881778f, 0.508347631f},
-std::array<float,2>{0.889875412f, 0.027859861f},
-std::array<float,2>{0.624870598f, 0.751049399f},
-std::array<float,2>{0.282638937f, 0.268285155f},
-std::array<float,2>{0.456724733f, 0.900839806f},
-std::array<float,2>{0.703892767f, 0.474178106f},
-std::array<float,2>{0.784971416f, 0.732413888f},
-std::array<float,2>{0.126324549f, 0.212044016f},
-std::array<float,2>{0.436746925f, 0.581997395f},
-std::array<float,2>{0.65146637f, 0.0753383785f},
-std::array<float,2>{0.872921348f, 0.859239936f},
-std::array<float,2>{0.196561739f, 0.336416125f},
-std::array<float,2>{0.0433623195f, 0.988892853f},
-std::array<float,2>{0.964351892f, 0.378762692f},
-std::array<float,2>{0.54832375f, 0.639674306f},
-std::array<float,2>{0.340237051f, 0.13787578f},
-std::array<float,2>{0.174588203f, 0.690254509f},
-std::array<float,2>{0.750922918f, 0.235597253f},
-std::array<float,2>{0.73467046f, 0.934351265f},
-std::array<float,2>{0.495049506f, 0.452203929f},
-std::array<float,2>{0.262984604f, 0.784888148f},
-std::array<float,2>{0.567142129f, 0.303433836f},
-std::array<float,2>{0.910693288f, 0.533015907f},
-std::array<float,2>{0.0721730813f, 0.0396480337f},
-std::array<float,2>{0.302979499f, 0.54829824f},
-std::array<float,2>{0.597104549f, 0.0568293035f},
-std::array<float,2>{0.894961953f, 0.800699711f},
-std::array<float,2>{0.0952371731f, 0.292696923f},
-std::array<float,2>{0.143397599f, 0.910047948f},
-std::array<float,2>{0.797371268f, 0.460799128f},
-std::array<float,2>{0.699541748f, 0.704231739f},
-std::array<float,2>{0.443701714f, 0.228649482f},
-std::array<float,2>{0.00903196633f, 0.651242971f},
-std::array<float,2>{0.984992683f, 0.151968598f},
-std::array<float,2>{0.526115775f, 0.971303463f},
-std::array<float,2>{0.348228991f, 0.405966789f},
-std::array<float,2>{0.383178622f, 0.872312486f},
-std::array<float,2>{0.675340235f, 0.313271761f},
-std::array<float,2>{0.835609138f, 0.569211543f},
-std::array<float,2>{0.239216506f, 0.0866528898f},
-std::array<float,2>{0.469448656f, 0.737511516f},
-std::array<float,2>{0.727097809f, 0.188874245f},
-std::array<float,2>{0.765774846f, 0.877796113f},
-std::array<float,2>{0.167511672f, 0.499993175f},
-std::array<float,2>{0.0845875144f, 0.780151844f},
-std::array<float,2>{0.922579765f, 0.251465291f},
-std::array<float,2>{0.586868584f, 0.524195373f},
-std::array<float,2>{0.273582816f, 0.00747324107f},
-std::array<float,2>{0.215138346f, 0.594469905f},
-std::array<float,2>{0.843943298f, 0.0990911871f},
-std::array<float,2>{0.626494706f, 0.828307629f},
-std::array<float,2>{0.419601172f, 0.373652756f},
-std::array<float,2>{0.318193913f, 0.962770283f},
-std::array<float,2>{0.543554544f, 0.429840654f},
-std::array<float,2>{0.940404296f, 0.662117481f},
-std::array<float,2>{0.0473062247f, 0.162855282f},
-std::array<float,2>{0.351783216f, 0.691977561f},
-std::array<float,2>{0.522214651f, 0.23838672f},
-std::array<float,2>{0.995643675f, 0.931155562f},
-std::array<float,2>{0.00465606106f, 0.447893649f},
-std::array<float,2>{0.246502578f, 0.788399577f},
-std::array<float,2>{0.836764812f, 0.297570646f},
-std::array<float,2>{0.687147498f, 0.538564742f},
-std::array<float,2>{0.376638621f, 0.0461111963f},
-std::array<float,2>{0.107762083f, 0.585471869f},
-std::array<float,2>{0.906021953f, 0.0713376924f},
-std::array<float,2>{0.608690679f, 0.851871371f},
-std::array<float,2>{0.310687482f, 0.340408146f},
-std::array<float,2>{0.451010704f, 0.98722744f},
-std::array<float,2>{0.689370692f, 0.382217407f},
-std::array<float,2>{0.807069123f, 0.635219038f},
-std::array<float,2>{0.149295196f, 0.132962063f},
-std::array<float,2>{0.407805949f, 0.512657523f},
-std::array<float,2>{0.633659005f, 0.025953196f},
-std::array<float,2>{0.855323493f, 0.754431605f},
-std::array<float,2>{0.205772921f, 0.272088915f},
-std::array<float,2>{0.0617061481f, 0.903810263f},
-std::array<float,2>{0.948678315f, 0.46904543f},
-std::array<float,2>{0.531441092f, 0.727664888f},
-std::array<float,2>{0.32204625f, 0.218443617f},
-std::array<float,2>{0.160221905f, 0.672136426f},
-std::array<float,2>{0.779205143f, 0.175897419f},
-std::array<float,2>{0.720858514f, 0.93782711f},
-std::array<float,2>{0.477847397f, 0.407772511f},
-std::array<float,2>{0.272012144f, 0.822476089f},
-std::array<float,2>{0.584145784f, 0.35263744f},
-std::array<float,2>{0.93664974f, 0.614581347f},
-std::array<float,2>{0.0901982337f, 0.118862785f},
-std::array<float,2>{0.294593453f, 0.598797679f},
-std::array<float,2>{0.614291131f, 0.0969442278f},
-std::array<float,2>{0.881634653f, 0.835220337f},
-std::array<float,2>{0.120357752f, 0.368858457f},
-std::array<float,2>{0.134389579f, 0.968640625f},
-std::array<float,2>{0.791869283f, 0.436880648f},
-std::array<float,2>{0.714820147f, 0.657181263f},
-std::array<float,2>{0.464444667f, 0.15701358f},
-std::array<float,2>{0.0242725592f, 0.739371538f},
-std::array<float,2>{0.97959131f, 0.193623245f},
-std::array<float,2>{0.50677222f, 0.879357934f},
-std::array<float,2>{0.361781538f, 0.494379014f},
-std::array<float,2>{0.391590327f, 0.776582599f},
-std::array<float,2>{0.669281542f, 0.256267101f},
-std::array<float,2>{0.823153317f, 0.530439973f},
-std::array<float,2>{0.228662774f, 0.00318243448f},
-std::array<float,2>{0.487134874f, 0.652939796f},
-std::array<float,2>{0.743907332f, 0.155161664f},
-std::array<float,2>{0.758474648f, 0.974263012f},
-std::array<float,2>{0.182749033f, 0.400372326f},
-std::array<float,2>{0.0677559003f, 0.870930076f},
-std::array<float,2>{0.91539526f, 0.316996455f},
-std::array<float,2>{0.575570762f, 0.563556015f},
-std::array<float,2>{0.252328128f, 0.0934676751f},
-std::array<float,2>{0.189867467f, 0.552156568f},
-std::array<float,2>{0.865779698f, 0.0588150322f},
-std::array<float,2>{0.647749603f, 0.800832987f},
-std::array<float,2>{0.427264363f, 0.295845419f},
-std::array<float,2>{0.333249599f, 0.913438678f},
-std::array<float,2>{0.557873309f, 0.455829948f},
-std::array<float,2>{0.960040331f, 0.707341313f},
-std::array<float,2>{0.0336355679f, 0.233703196f},
-std::array<float,2>{0.25814566f, 0.667298615f},
-std::array<float,2>{0.564472616f, 0.166474923f},
-std::array<float,2>{0.909861267f, 0.953835487f},
-std::array<float,2>{0.0766280442f, 0.426653594f},
-std::array<float,2>{0.178713247f, 0.839091897f},
-std::array<float,2>{0.756933808f, 0.363418698f},
-std::array<float,2>{0.74192363f, 0.604152262f},
-std::array<float,2>{0.496383399f, 0.106003448f},
-std::array<float,2>{0.0424068794f, 0.517754853f},
-std::array<float,2>{0.965071499f, 0.0115598515f},
-std::array<float,2>{0.554327428f, 0.768079042f},
-std::array<float,2>{0.336453438f, 0.25913924f},
-std::array<float,2>{0.433217466f, 0.887312412f},
-std::array<float,2>{0.653987467f, 0.492103577f},
-std::array<float,2>{0.869808674f, 0.743078351f},
-std::array<float,2>{0.200461909f, 0.200783089f},
-std::array<float,2>{0.459718078f, 0.574025273f},
-std::array<float,2>{0.710301936f, 0.0828764588f},
-std::array<float,2>{0.787326336f, 0.860946119f},
-std::array<float,2>{0.131154388f, 0.323554456f},
-std::array<float,2>{0.115665868f, 0.978242278f},
-std::array<float,2>{0.884439707f, 0.395937592f},
-std::array<float,2>{0.617350519f, 0.643812716f},
-std::array<float,2>{0.286245644f, 0.143606558f},
-std::array<float,2>{0.222454056f, 0.713116348f},
-std::array<float,2>{0.814901412f, 0.221357495f},
-std::array<float,2>{0.662495852f, 0.917367935f},
-std::array<float,2>{0.400207281f, 0.466016173f},
-std::array<float,2>{0.371601999f, 0.807370067f},
-std::array<float,2>{0.513269007f, 0.284639478f},
-std::array<float,2>{0.971196473f, 0.561296344f},
-std::array<float,2>{0.0220218562f, 0.0484746434f},
-std::array<float,2>{0.313287854f, 0.539538026f},
-std::array<float,2>{0.542521f, 0.0354090147f},
-std::array<float,2>{0.942487061f, 0.795492232f},
-std::array<float,2>{0.0514171682f, 0.306254387f},
-std::array<float,2>{0.214767739f, 0.925105035f},
-std::array<float,2>{0.849714696f, 0.4403871f},
-std::array<float,2>{0.629908025f, 0.695497155f},
-std::array<float,2>{0.414598972f, 0.246934399f},
-std::array<float,2>{0.0812002197f, 0.629778683f},
-std::array<float,2>{0.92964375f, 0.130580246f},
-std::array<float,2>{0.591151655f, 0.999189973f},
-std::array<float,2>{0.279046774f, 0.38410154f},
-std::array<float,2>{0.475847185f, 0.846056998f},
-std::array<float,2>{0.732940555f, 0.330906868f},
-std::array<float,2>{0.771544218f, 0.588678956f},
-std::array<float,2>{0.169482991f, 0.0686359704f},
-std::array<float,2>{0.390133262f, 0.726135552f},
-std::array<float,2>{0.677039325f, 0.207331017f},
-std::array<float,2>{0.828997016f, 0.893168628f},
-std::array<float,2>{0.235573694f, 0.483950645f},
-std::array<float,2>{0.014901448f, 0.760217071f},
-std::array<float,2>{0.988653183f, 0.278209776f},
-std::array<float,2>{0.527378678f, 0.503143549f},
-std::array<float,2>{0.346045434f, 0.0179689508f},
-std::array<float,2>{0.146214932f, 0.622672975f},
-std::array<float,2>{0.801626623f, 0.114821799f},
-std::array<float,2>{0.697172523f, 0.812737346f},
-std::array<float,2>{0.440037519f, 0.343961805f},
-std::array<float,2>{0.299059242f, 0.949903488f},
-std::array<float,2>{0.600335121f, 0.418961734f},
-std::array<float,2>{0.894061565f, 0.681829035f},
-std::array<float,2>{0.0993025526f, 0.179723114f},
-std::array<float,2>{0.307930857f, 0.749531567f},
-std::array<float,2>{0.602714419f, 0.195317611f},
-std::array<float,2>{0.900493324f, 0.885816395f},
-std::array<float,2>{0.101756737f, 0.487164259f},
-std::array<float,2>{0.152880535f, 0.769725621f},
-std::array<float,2>{0.808993042f, 0.265585572f},
-std::array<float,2>{0.694356799f, 0.522155344f},
-std::array<float,2>{0.4481861f, 0.013856614f},
-std::array<float,2>{0.00360734598f, 0.609007776f},
-std::array<float,2>{0.998574972f, 0.103194505f},
-std::array<float,2>{0.518779993f, 0.841019392f},
-std::array<float,2>{0.357335448f, 0.362791687f},
-std::array<float,2>{0.379597723f, 0.960128188f},
-std::array<float,2>{0.683493674f, 0.423706144f},
-std::array<float,2>{0.840139568f, 0.669547796f},
-std::array<float,2>{0.243259907f, 0.171383679f},
-std::array<float,2>{0.482780129f, 0.556602955f},
-std::array<float,2>{0.72306639f, 0.0544118173f},
-std::array<float,2>{0.774665594f, 0.809705973f},
-std::array<float,2>{0.159273341f, 0.28583771f},
-std::array<float,2>{0.0868633389f, 0.919510245f},
-std::array<float,2>{0.931895494f, 0.462906688f},
-std::array<float,2>{0.579710007f, 0.718534887f},
-std::array<float,2>{0.268898726f, 0.223517254f},
-std::array<float,2>{0.2106397f, 0.645911038f},
-std::array<float,2>{0.857710242f, 0.14768669f},
-std::array<float,2>{0.639775336f, 0.984303951f},
-std::array<float,2>{0.410758793f, 0.393736184f},
-std::array<float,2>{0.327960223f, 0.863727272f},
-std::array<float,2>{0.537648141f, 0.327345073f},
-std::array<float,2>{0.950940788f, 0.574755549f},
-std::array<float,2>{0.0547960103f, 0.0804045722f},
-std::array<float,2>{0.364696592f, 0.592144549f},
-std::array<float,2>{0.503537178f, 0.065970324f},
-std::array<float,2>{0.982833326f, 0.851122141f},
-std::array<float,2>{0.0306515452f, 0.335704029f},
-std::array<float,2>{0.230829239f, 0.995577812f},
-std::array<float,2>{0.825613797f, 0.390045762f},
-std::array<float,2>{0.666649342f, 0.626179993f},
-std::array<float,2>{0.396408021f, 0.126623139f},
-std::array<float,2>{0.121972598f, 0.70167923f},
-std::array<float,2>{0.87601912f, 0.245308131f},
-std::array<float,2>{0.612035394f, 0.929555118f},
-std::array<float,2>{0.291172266f, 0.444057584f},
-std::array<float,2>{0.465575397f, 0.79271847f},
-std::array<float,2>{0.714960098f, 0.309119731f},
-std::array<float,2>{0.796705306f, 0.545456648f},
-std::array<float,2>{0.137234956f, 0.0346111953f},
-std::array<float,2>{0.424038649f, 0.687129915f},
-std::array<float,2>{0.642268479f, 0.186558053f},
-std::array<float,2>{0.859642506f, 0.949201643f},
-std::array<float,2>{0.193631828f, 0.415722549f},
-std::array<float,2>{0.0362897366f, 0.819311857f},
-std::array<float,2>{0.954777777f, 0.348836899f},
-std::array<float,2>{0.559331536f, 0.6201756f},
-std::array<float,2>{0.329018086f, 0.110935226f},
-std::array<float,2>{0.184749693f, 0.507250607f},
-std::array<float,2>{0.764953077f, 0.0218880847f},
-std::array<float,2>{0.746793211f, 0.762211919f},
-std::array<float,2>{0.491356105f, 0.275222868f},
-std::array<float,2>{0.256562203f, 0.898296058f},
-std::array<float,2>{0.571611226f, 0.478530347f},
-std::array<float,2>{0.920843065f, 0.719321966f},
-std::array<float,2>{0.064973034f, 0.204861507f},
-std::array<float,2>{0.342379749f, 0.637734473f},
-std::array<float,2>{0.549726009f, 0.139904559f},
-std::array<float,2>{0.96221751f, 0.990936041f},
-std::array<float,2>{0.0451080799f, 0.375260651f},
-std::array<float,2>{0.198158637f, 0.856502593f},
-std::array<float,2>{0.874463201f, 0.338533223f},
-std::array<float,2>{0.649278939f, 0.578731179f},
-std::array<float,2>{0.434358656f, 0.0763746798f},
-std::array<float,2>{0.0740319639f, 0.533531129f},
-std::array<float,2>{0.912718415f, 0.0411443785f},
-std::array<float,2>{0.569081604f, 0.78246367f},
-std::array<float,2>{0.264257669f, 0.301878572f},
-std::array<float,2>{0.493682951f, 0.936626375f},
-std::array<float,2>{0.737276375f, 0.450676769f},
-std::array<float,2>{0.752938688f, 0.688306391f},
-std::array<float,2>{0.173379615f, 0.237756699f},
-std::array<float,2>{0.404570013f, 0.610002279f},
-std::array<float,2>{0.657329202f, 0.121860281f},
-std::array<float,2>{0.818901777f, 0.826804399f},
-std::array<float,2>{0.222851813f, 0.35661298f},
-std::array<float,2>{0.0164103955f, 0.943820834f},
-std::array<float,2>{0.975986779f, 0.411509126f},
-std::array<float,2>{0.508169353f, 0.676415324f},
-std::array<float,2>{0.369319379f, 0.173506111f},
-std::array<float,2>{0.127705947f, 0.733105659f},
-std::array<float,2>{0.781988382f, 0.214410305f},
-std::array<float,2>{0.705750585f, 0.899907529f},
-std::array<float,2>{0.453212321f, 0.474976808f},
-std::array<float,2>{0.283782303f, 0.752872169f},
-std::array<float,2>{0.621807158f, 0.265686989f},
-std::array<float,2>{0.886725843f, 0.509779096f},
-std::array<float,2>{0.110337391f, 0.0298175327f},
-std::array<float,2>{0.27696985f, 0.527186275f},
-std::array<float,2>{0.589553356f, 0.00541483797f},
-std::array<float,2>{0.924393475f, 0.778905869f},
-std::array<float,2>{0.0832177475f, 0.2521106f},
-std::array<float,2>{0.165292189f, 0.876790226f},
-std::array<float,2>{0.768026471f, 0.497419834f},
-std::array<float,2>{0.728562355f, 0.7357409f},
-std::array<float,2>{0.470764488f, 0.190596089f},
-std::array<float,2>{0.0507672131f, 0.660623372f},
-std::array<float,2>{0.938750267f, 0.160201237f},
-std::array<float,2>{0.546704173f, 0.963408113f},
-std::array<float,2>{0.320114344f, 0.433233649f},
-std::array<float,2>{0.420883298f, 0.831438005f},
-std::array<float,2>{0.627339661f, 0.371170878f},
-std::array<float,2>{0.847045183f, 0.595776618f},
-std::array<float,2>{0.21722348f, 0.101398252f},
-std::array<float,2>{0.442982763f, 0.705867231f},
-std::array<float,2>{0.702135146f, 0.227510393f},
-std::array<float,2>{0.799186349f, 0.906708598f},
-std::array<float,2>{0.141804427f, 0.457319975f},
-std::array<float,2>{0.0976006761f, 0.797754765f},
-std::array<float,2>{0.897070527f, 0.290336996f},
-std::array<float,2>{0.595659077f, 0.550359964f},
-std::array<float,2>{0.30191192f, 0.0557164066f},
-std::array<float,2>{0.240625992f, 0.567831576f},
-std::array<float,2>{0.83344692f, 0.0885076597f},
-std::array<float,2>{0.67364496f, 0.87411809f},
-std::array<float,2>{0.386650503f, 0.315215737f},
-std::array<float,2>{0.350843668f, 0.969421327f},
-std::array<float,2>{0.525318503f, 0.402580261f},
-std::array<float,2>{0.987527788f, 0.649072766f},
-std::array<float,2>{0.0100684408f, 0.150244728f},
-std::array<float,2>{0.324246675f, 0.716955245f},
-std::array<float,2>{0.536982596f, 0.22438319f},
-std::array<float,2>{0.952629447f, 0.918561041f},
-std::array<float,2>{0.0576699525f, 0.464335561f},
-std::array<float,2>{0.208482012f, 0.809036374f},
-std::array<float,2>{0.856360137f, 0.287005246f},
-std::array<float,2>{0.63811177f, 0.554948211f},
-std::array<float,2>{0.413668305f, 0.0532047898f},
-std::array<float,2>{0.0895599872f, 0.576073945f},
-std::array<float,2>{0.929936647f, 0.0818180516f},
-std::array<float,2>{0.581994772f, 0.864590406f},
-std::array<float,2>{0.266730249f, 0.326657027f},
-std::array<float,2>{0.482121915f, 0.982966363f},
-std::array<float,2>{0.724721074f, 0.392832547f},
-std::array<float,2>{0.777245224f, 0.645421684f},
-std::array<float,2>{0.15771234f, 0.146755531f},
-std::array<float,2>{0.382172227f, 0.523028791f},
-std::array<float,2>{0.680574536f, 0.0150036607f},
-std::array<float,2>{0.843563855f, 0.771174669f},
-std::array<float,2>{0.244797409f, 0.264255643f},
-std::array<float,2>{0.000933876378f, 0.885471523f},
-std::array<float,2>{0.997956634f, 0.487389535f},
-std::array<float,2>{0.516448498f, 0.748721719f},
-std::array<float,2>{0.358920813f, 0.197007567f},
-std::array<float,2>{0.154687703f, 0.668165028f},
-std::array<float,2>{0.812092245f, 0.170523137f},
-std::array<float,2>{0.691975772f, 0.959214389f},
-std::array<float,2>{0.446819365f, 0.421939939f},
-std::array<float,2>{0.30480513f, 0.84006381f},
-std::array<float,2>{0.604108572f, 0.361403972f},
-std::array<float,2>{0.900157332f, 0.608030021f},
-std::array<float,2>{0.104257904f, 0.102112696f},
-std::array<float,2>{0.253999561f, 0.619998455f},
-std::array<float,2>{0.573202729f, 0.109378442f},
-std::array<float,2>{0.919576168f, 0.820163786f},
-std::array<float,2>{0.0636052489f, 0.347798496f},
-std::array<float,2>{0.186611995f, 0.947534561f},
-std::array<float,2>{0.763592005f, 0.414359063f},
-std::array<float,2>{0.748705924f, 0.686390817f},
-std::array<float,2>{0.488760024f, 0.186273351f},
-std::array<float,2>{0.0384449847f, 0.720039427f},
-std::array<float,2>{0.955159843f, 0.203435749f},
-std::array<float,2>{0.561695278f, 0.896690726f},
-std::array<float,2>{0.332029849f, 0.479820997f},
-std::array<float,2>{0.423826098f, 0.763141453f},
-std::array<float,2>{0.644389331f, 0.273777813f},
-std::array<float,2>{0.861732841f, 0.505888164f},
-std::array<float,2>{0.192162991f, 0.0225297902f},
-std::array<float,2>{0.467084706f, 0.625009716f},
-std::array<float,2>{0.716919243f, 0.125060558f},
-std::array<float,2>{0.794093788f, 0.99426204f},
-std::array<float,2>{0.139601439f, 0.389366448f},
-std::array<float,2>{0.123457588f, 0.850473642f},
-std::array<float,2>{0.878697157f, 0.334828079f},
-std::array<float,2>{0.611105621f, 0.593346119f},
-std::array<float,2>{0.290682435f, 0.0651716441f},
-std::array<float,2>{0.234061539f, 0.546176136f},
-std::array<float,2>{0.827650189f, 0.0337640494f},
-std::array<float,2>{0.664536774f, 0.791855156f},
-std::array<float,2>{0.396511555f, 0.309942365f},
-std::array<float,2>{0.365364403f, 0.9283548f},
-std::array<float,2>{0.501704216f, 0.445017874f},
-std::array<float,2>{0.981415451f, 0.702379227f},
-std::array<float,2>{0.0291920546f, 0.244503126f},
-std::array<float,2>{0.282322139f, 0.677272975f},
-std::array<float,2>{0.624550104f, 0.172163308f},
-std::array<float,2>{0.890113354f, 0.945020914f},
-std::array<float,2>{0.112125061f, 0.410481453f},
-std::array<float,2>{0.126216695f, 0.827365577f},
-std::array<float,2>{0.784669936f, 0.355572283f},
-std::array<float,2>{0.703672886f, 0.610901415f},
-std::array<float,2>{0.456834614f, 0.122902527f},
-std::array<float,2>{0.0188365635f, 0.511516511f},
-std::array<float,2>{0.973221183f, 0.030365698f},
-std::array<float,2>{0.511004388f, 0.753393769f},
-std::array<float,2>{0.367256105f, 0.267572999f},
-std::array<float,2>{0.403747439f, 0.898891926f},
-std::array<float,2>{0.659126043f, 0.476534992f},
-std::array<float,2>{0.817220509f, 0.733576477f},
-std::array<float,2>{0.225216255f, 0.213332295f},
-std::array<float,2>{0.494760424f, 0.580000401f},
-std::array<float,2>{0.734557807f, 0.0781155005f},
-std::array<float,2>{0.750659525f, 0.855617464f},
-std::array<float,2>{0.174432904f, 0.339088917f},
-std::array<float,2>{0.0719354153f, 0.992055893f},
-std::array<float,2>{0.910937786f, 0.376455665f},
-std::array<float,2>{0.566971958f, 0.636787415f},
-std::array<float,2>{0.26289922f, 0.139075577f},
-std::array<float,2>{0.196487308f, 0.688664019f},
-std::array<float,2>{0.872705519f, 0.23673673f},
-std::array<float,2>{0.651757479f, 0.935687006f},
-std::array<float,2>{0.436787814f, 0.449420482f},
-std::array<float,2>{0.339922637f, 0.781573176f},
-std::array<float,2>{0.547873974f, 0.300781786f},
-std::array<float,2>{0.963956714f, 0.53476584f},
-std::array<float,2>{0.0430604555f, 0.0426567644f},
-std::array<float,2>{0.348464072f, 0.549162149f},
-std::array<float,2>{0.526154697f, 0.0549207032f},
-std::array<float,2>{0.985277414f, 0.798622966f},
-std::array<float,2>{0.00907237362f, 0.289475173f},
-std::array<float,2>{0.238843769f, 0.90768683f},
-std::array<float,2>{0.835776329f, 0.458084315f},
-std::array<float,2>{0.675598741f, 0.706741571f},
-std::array<float,2>{0.382950455f, 0.228161573f},
-std::array<float,2>{0.0955714583f, 0.65000695f},
-std::array<float,2>{0.894619286f, 0.148546517f},
-std::array<float,2>{0.596780241f, 0.970675349f},
-std::array<float,2>{0.302875131f, 0.404239655f},
-std::array<float,2>{0.443389922f, 0.873982728f},
-std::array<float,2>{0.699322462f, 0.316274256f},
-std::array<float,2>{0.797692895f, 0.566505969f},
-std::array<float,2>{0.143222883f, 0.0891430825f},
-std::array<float,2>{0.419720203f, 0.735224307f},
-std::array<float,2>{0.626910627f, 0.190401196f},
-std::array<float,2>{0.844037414f, 0.87515825f},
-std::array<float,2>{0.215056866f, 0.496311128f},
-std::array<float,2>{0.0469652638f, 0.77809751f},
-std::array<float,2>{0.940035164f, 0.253345639f},
-std::array<float,2>{0.543716908f, 0.525532067f},
-std::array<float,2>{0.317876041f, 0.00434715115f},
-std::array<float,2>{0.1678655f, 0.596689463f},
-std::array<float,2>{0.765929341f, 0.0996958688f},
-std::array<float,2>{0.727349043f, 0.830889702f},
-std::array<float,2>{0.469569445f, 0.372725546f},
-std::array<float,2>{0.273913324f, 0.96394825f},
-std::array<float,2>{0.586455941f, 0.431800634f},
-std::array<float,2>{0.922836781f, 0.66192764f},
-std::array<float,2>{0.0847590342f, 0.161134824f},
-std::array<float,2>{0.271276057f, 0.726631105f},
-std::array<float,2>{0.583003521f, 0.217726544f},
-std::array<float,2>{0.934154928f, 0.902436852f},
-std::array<float,2>{0.0931391492f, 0.470612049f},
-std::array<float,2>{0.16268675f, 0.755279303f},
-std::array<float,2>{0.779615343f, 0.272988707f},
-std::array<float,2>{0.720112741f, 0.513271689f},
-std::array<float,2>{0.479128003f, 0.0270509627f},
-std::array<float,2>{0.0586013943f, 0.614248574f},
-std::array<float,2>{0.946768522f, 0.117839597f},
-std::array<float,2>{0.534185112f, 0.823258638f},
-std::array<float,2>{0.322330385f, 0.352335125f},
-std::array<float,2>{0.408510923f, 0.939367831f},
-std::array<float,2>{0.63602066f, 0.40677014f},
-std::array<float,2>{0.853481054f, 0.673759401f},
-std::array<float,2>{0.203254834f, 0.177570492f},
-std::array<float,2>{0.452062428f, 0.537189424f},
-std::array<float,2>{0.689970195f, 0.0452457257f},
-std::array<float,2>{0.806542695f, 0.787811637f},
-std::array<float,2>{0.150827035f, 0.298122019f},
-std::array<float,2>{0.106946923f, 0.929988801f},
-std::array<float,2>{0.903552949f, 0.449165732f},
-std::array<float,2>{0.60706538f, 0.693309426f},
-std::array<float,2>{0.309382468f, 0.240193948f},
-std::array<float,2>{0.249292195f, 0.63585192f},
-std::array<float,2>{0.839809239f, 0.13473703f},
-std::array<float,2>{0.684217453f, 0.987535357f},
-std::array<float,2>{0.378209472f, 0.381728768f},
-std::array<float,2>{0.354921162f, 0.853330612f},
-std::array<float,2>{0.519763589f, 0.341395617f},
-std::array<float,2>{0.992836714f, 0.584912956f},
-std::array<float,2>{0.00617606658f, 0.0704426765f},
-std::array<float,2>{0.335936785f, 0.563117325f},
-std::array<float,2>{0.555551827f, 0.0918602347f},
-std::array<float,2>{0.957978964f, 0.870030165f},
-std::array<float,2>{0.0313284881f, 0.317480326f},
-std::array<float,2>{0.188388869f, 0.972672701f},
-std::array<float,2>{0.86410737f, 0.398659319f},
-std::array<float,2>{0.646356642f, 0.654262841f},
-std::array<float,2>{0.428420514f, 0.1555347f},
-std::array<float,2>{0.0685848296f, 0.708123505f},
-std::array<float,2>{0.916879952f, 0.23330155f},
-std::array<float,2>{0.577973187f, 0.91280812f},
-std::array<float,2>{0.250884652f, 0.456514359f},
-std::array<float,2>{0.486266047f, 0.802003205f},
-std::array<float,2>{0.745012581f, 0.296304852f},
-std::array<float,2>{0.760935843f, 0.551024556f},
-std::array<float,2>{0.179847956f, 0.060467992f},
-std::array<float,2>{0.394156486f, 0.658041775f},
-std::array<float,2>{0.671182871f, 0.157793954f},
-std::array<float,2>{0.822071016f, 0.966940224f},
-std::array<float,2>{0.227251917f, 0.436038166f},
-std::array<float,2>{0.0258137155f, 0.834451616f},
-std::array<float,2>{0.978138924f, 0.367876679f},
-std::array<float,2>{0.505297959f, 0.598253191f},
-std::array<float,2>{0.360170633f, 0.0961339921f},
-std::array<float,2>{0.136510938f, 0.529656947f},
-std::array<float,2>{0.790570557f, 0.00240551657f},
-std::array<float,2>{0.712827027f, 0.77598989f},
-std::array<float,2>{0.46096167f, 0.257677346f},
-std::array<float,2>{0.296682924f, 0.880381942f},
-std::array<float,2>{0.615846515f, 0.495705247f},
-std::array<float,2>{0.87919867f, 0.738372684f},
-std::array<float,2>{0.119081669f, 0.194640785f},
-std::array<float,2>{0.374946117f, 0.642917931f},
-std::array<float,2>{0.515391469f, 0.143109202f},
-std::array<float,2>{0.969679713f, 0.976705253f},
-std::array<float,2>{0.0209469814f, 0.395291924f},
-std::array<float,2>{0.220124349f, 0.859499991f},
-std::array<float,2>{0.812957346f, 0.323077589f},
-std::array<float,2>{0.661935031f, 0.572311819f},
-std::array<float,2>{0.402316362f, 0.0835442692f},
-std::array<float,2>{0.11347875f, 0.56218791f},
-std::array<float,2>{0.885584474f, 0.0471670479f},
-std::array<float,2>{0.62024039f, 0.807914853f},
-std::array<float,2>{0.288272262f, 0.283770055f},
-std::array<float,2>{0.458149284f, 0.916851163f},
-std::array<float,2>{0.707669377f, 0.465212554f},
-std::array<float,2>{0.786459267f, 0.713881731f},
-std::array<float,2>{0.129328802f, 0.222495362f},
-std::array<float,2>{0.430684566f, 0.604517758f},
-std::array<float,2>{0.655488372f, 0.107281387f},
-std::array<float,2>{0.868849337f, 0.838101804f},
-std::array<float,2>{0.201825619f, 0.36478126f},
-std::array<float,2>{0.0393795408f, 0.954187453f},
-std::array<float,2>{0.966930449f, 0.427476734f},
-std::array<float,2>{0.551044703f, 0.666397452f},
-std::array<float,2>{0.339628607f, 0.16750221f},
-std::array<float,2>{0.176835477f, 0.743806064f},
-std::array<float,2>{0.753962874f, 0.199328944f},
-std::array<float,2>{0.738308549f, 0.888051391f},
-std::array<float,2>{0.498315126f, 0.490430564f},
-std::array<float,2>{0.26094678f, 0.769355357f},
-std::array<float,2>{0.563116431f, 0.2586914f},
-std::array<float,2>{0.908171952f, 0.519381642f},
-std::array<float,2>{0.0761165917f, 0.0104026021f},
-std::array<float,2>{0.297997326f, 0.502209187f},
-std::array<float,2>{0.598782599f, 0.0187601633f},
-std::array<float,2>{0.891290784f, 0.761564076f},
-std::array<float,2>{0.100333445f, 0.278358966f},
-std::array<float,2>{0.146771058f, 0.893736839f},
-std::array<float,2>{0.803497732f, 0.483262002f},
-std::array<float,2>{0.698404074f, 0.725303531f},
-std::array<float,2>{0.438820958f, 0.208330736f},
-std::array<float,2>{0.0129676424f, 0.683496535f},
-std::array<float,2>{0.99173367f, 0.180807859f},
-std::array<float,2>{0.531236827f, 0.950374544f},
-std::array<float,2>{0.344691962f, 0.418846995f},
-std::array<float,2>{0.387628227f, 0.813943446f},
-std::array<float,2>{0.677817523f, 0.345047563f},
-std::array<float,2>{0.83082974f, 0.621492505f},
-std::array<float,2>{0.237793177f, 0.113419563f},
-std::array<float,2>{0.47369945f, 0.696581006f},
-std::array<float,2>{0.731779218f, 0.247929946f},
-std::array<float,2>{0.770894647f, 0.924709439f},
-std::array<float,2>{0.170553237f, 0.440989047f},
-std::array<float,2>{0.0790072083f, 0.796307623f},
-std::array<float,2>{0.925834715f, 0.305242777f},
-std::array<float,2>{0.59334904f, 0.540377796f},
-std::array<float,2>{0.280263841f, 0.0365211442f},
-std::array<float,2>{0.211893752f, 0.588974774f},
-std::array<float,2>{0.848441958f, 0.0694789812f},
-std::array<float,2>{0.631756544f, 0.847622037f},
-std::array<float,2>{0.417901367f, 0.331526428f},
-std::array<float,2>{0.315969497f, 0.998432159f},
-std::array<float,2>{0.540756464f, 0.382844597f},
-std::array<float,2>{0.944847047f, 0.630211711f},
-std::array<float,2>{0.0542509072f, 0.129298806f},
-std::array<float,2>{0.357122093f, 0.746129334f},
-std::array<float,2>{0.51887548f, 0.197985291f},
-std::array<float,2>{0.9988814f, 0.884437442f},
-std::array<float,2>{0.00374947302f, 0.485655785f},
-std::array<float,2>{0.243424237f, 0.773282349f},
-std::array<float,2>{0.840074778f, 0.263572872f},
-std::array<float,2>{0.683144093f, 0.520950496f},
-std::array<float,2>{0.379729122f, 0.0120574478f},
-std::array<float,2>{0.101927146f, 0.606127858f},
-std::array<float,2>{0.90072459f, 0.104722679f},
-std::array<float,2>{0.602893472f, 0.842291772f},
-std::array<float,2>{0.307857752f, 0.361282945f},
-std::array<float,2>{0.447908223f, 0.957926691f},
-std::array<float,2>{0.694759011f, 0.424938202f},
-std::array<float,2>{0.808600426f, 0.670158744f},
-std::array<float,2>{0.153194427f, 0.169238359f},
-std::array<float,2>{0.410994142f, 0.557515383f},
-std::array<float,2>{0.640033185f, 0.0516004711f},
-std::array<float,2>{0.857599795f, 0.811605155f},
-std::array<float,2>{0.210724458f, 0.289062232f},
-std::array<float,2>{0.0551144704f, 0.921584725f},
-std::array<float,2>{0.950731397f, 0.461267114f},
-std::array<float,2>{0.538010776f, 0.715513527f},
-std::array<float,2>{0.327663124f, 0.225514695f},
-std::array<float,2>{0.159430876f, 0.647058308f},
-std::array<float,2>{0.774459839f, 0.146306485f},
-std::array<float,2>{0.722716033f, 0.980811357f},
-std::array<float,2>{0.482648283f, 0.391152173f},
-std::array<float,2>{0.268676102f, 0.86637181f},
-std::array<float,2>{0.580043435f, 0.325427741f},
-std::array<float,2>{0.931821227f, 0.576782644f},
-std::array<float,2>{0.0864703581f, 0.0797024816f},
-std::array<float,2>{0.291503131f, 0.59113723f},
-std::array<float,2>{0.612213731f, 0.0640191361f},
-std::array<float,2>{0.876293182f, 0.847890973f},
-std::array<float,2>{0.121643215f, 0.333416164f},
-std::array<float,2>{0.137552336f, 0.993735671f},
-std::array<float,2>{0.796438634f, 0.387014508f},
-std::array<float,2>{0.715101242f, 0.627959907f},
-std::array<float,2>{0.465678513f, 0.128124714f},
-std::array<float,2>{0.030470714f, 0.700280368f},
-std::array<float,2>{0.982465148f, 0.242762148f},
-std::array<float,2>{0.50378865f, 0.926388144f},
-std::array<float,2>{0.364382058f, 0.442459196f},
-std::array<float,2>{0.396071345f, 0.789949059f},
-std::array<float,2>{0.666945457f, 0.312139153f},
-std::array<float,2>{0.825255752f, 0.543818891f},
-std::array<float,2>{0.230534405f, 0.0321517326f},
-std::array<float,2>{0.491677105f, 0.685275435f},
-std::array<float,2>{0.746870697f, 0.183608666f},
-std::array<float,2>{0.764773309f, 0.946424365f},
-std::array<float,2>{0.184892043f, 0.416976064f},
-std::array<float,2>{0.0652873591f, 0.816788316f},
-std::array<float,2>{0.920494795f, 0.350957543f},
-std::array<float,2>{0.571487308f, 0.618372262f},
-std::array<float,2>{0.256721556f, 0.112072915f},
-std::array<float,2>{0.193467975f, 0.504245222f},
-std::array<float,2>{0.859546661f, 0.0203094929f},
-std::array<float,2>{0.642528355f, 0.765590668f},
-std::array<float,2>{0.42419824f, 0.276296914f},
-std::array<float,2>{0.328620464f, 0.894788027f},
-std::array<float,2>{0.55919975f, 0.47704491f},
-std::array<float,2>{0.955001652f, 0.721654832f},
-std::array<float,2>{0.0364631154f, 0.205521137f},
-std::array<float,2>{0.26442048f, 0.638728797f},
-std::array<float,2>{0.569100857f, 0.13742581f},
-std::array<float,2>{0.912979484f, 0.989727557f},
-std::array<float,2>{0.0738098249f, 0.377149671f},
-std::array<float,2>{0.173591882f, 0.858340502f},
-std::array<float,2>{0.753402293f, 0.337113321f},
-std::array<float,2>{0.736992538f, 0.581014335f},
-std::array<float,2>{0.494096011f, 0.0744383633f},
-std::array<float,2>{0.045266252f, 0.531983793f},
-std::array<float,2>{0.96200639f, 0.0404669382f},
-std::array<float,2>{0.549512744f, 0.783801794f},
-std::array<float,2>{0.342579007f, 0.304631799f},
-std::array<float,2>{0.434187323f, 0.935233295f},
-std::array<float,2>{0.649055123f, 0.451919883f},
-std::array<float,2>{0.87413764f, 0.691384614f},
-std::array<float,2>{0.197884515f, 0.234646648f},
-std::array<float,2>{0.453471422f, 0.61166209f},
-std::array<float,2>{0.706004322f, 0.124082208f},
-std::array<float,2>{0.781973541f, 0.825080633f},
-std::array<float,2>{0.127518505f, 0.358714908f},
-std::array<float,2>{0.109917432f, 0.942961216f},
-std::array<float,2>{0.887095511f, 0.413296729f},
-std::array<float,2>{0.622026742f, 0.678004086f},
-std::array<float,2>{0.284081101f, 0.173836991f},
-std::array<float,2>{0.222970009f, 0.730872631f},
-std::array<float,2>{0.819190502f, 0.211064756f},
-std::array<float,2>{0.657541275f, 0.901835501f},
-std::array<float,2>{0.404488772f, 0.472815275f},
-std::array<float,2>{0.369446337f, 0.750616074f},
-std::array<float,2>{0.507844031f, 0.269022137f},
-std::array<float,2>{0.975812912f, 0.509103f},
-std::array<float,2>{0.0161874294f, 0.0285341609f},
-std::array<float,2>{0.320024729f, 0.524623334f},
-std::array<float,2>{0.546466768f, 0.00676728785f},
-std::array<float,2>{0.938618183f, 0.780953765f},
-std::array<float,2>{0.0503883995f, 0.250235677f},
-std::array<float,2>{0.216911465f, 0.878661752f},
-std::array<float,2>{0.846820176f, 0.49857679f},
-std::array<float,2>{0.627194643f, 0.736726403f},
-std::array<float,2>{0.42064926f, 0.18758969f},
-std::array<float,2>{0.0832900405f, 0.663473547f},
-std::array<float,2>{0.92478931f, 0.163856149f},
-std::array<float,2>{0.589699984f, 0.961113632f},
-std::array<float,2>{0.277164429f, 0.430772692f},
-std::array<float,2>{0.471088797f, 0.829196036f},
-std::array<float,2>{0.728897035f, 0.374645501f},
-std::array<float,2>{0.767672539f, 0.594782114f},
-std::array<float,2>{0.165117115f, 0.0981836691f},
-std::array<float,2>{0.386299342f, 0.703586519f},
-std::array<float,2>{0.673421681f, 0.230010286f},
-std::array<float,2>{0.833171427f, 0.908555686f},
-std::array<float,2>{0.240243211f, 0.459434271f},
-std::array<float,2>{0.00992772821f, 0.799439549f},
-std::array<float,2>{0.987659335f, 0.291219443f},
-std::array<float,2>{0.525144935f, 0.547373295f},
-std::array<float,2>{0.350825101f, 0.0576470457f},
-std::array<float,2>{0.141933993f, 0.569381475f},
-std::array<float,2>{0.798975646f, 0.0876481161f},
-std::array<float,2>{0.70186466f, 0.872005343f},
-std::array<float,2>{0.44329375f, 0.313500375f},
-std::array<float,2>{0.302231163f, 0.972000539f},
-std::array<float,2>{0.595409155f, 0.404969752f},
-std::array<float,2>{0.897264063f, 0.651511133f},
-std::array<float,2>{0.0973307937f, 0.150759622f},
-std::array<float,2>{0.310800195f, 0.693656683f},
-std::array<float,2>{0.608425677f, 0.241752803f},
-std::array<float,2>{0.905889571f, 0.933560848f},
-std::array<float,2>{0.107555337f, 0.445346594f},
-std::array<float,2>{0.14904502f, 0.785560608f},
-std::array<float,2>{0.80683583f, 0.300383508f},
-std::array<float,2>{0.689186811f, 0.536297977f},
-std::array<float,2>{0.450752676f, 0.0435135327f},
-std::array<float,2>{0.00449977769f, 0.583694041f},
-std::array<float,2>{0.995888174f, 0.0729998425f},
-std::array<float,2>{0.522355556f, 0.855009735f},
-std::array<float,2>{0.351989895f, 0.342354745f},
-std::array<float,2>{0.376906484f, 0.984680891f},
-std::array<float,2>{0.687303185f, 0.379542291f},
-std::array<float,2>{0.836477518f, 0.632865608f},
-std::array<float,2>{0.246133536f, 0.135973856f},
-std::array<float,2>{0.477742404f, 0.514091194f},
-std::array<float,2>{0.721072733f, 0.0242725201f},
-std::array<float,2>{0.778910041f, 0.755983233f},
-std::array<float,2>{0.160543799f, 0.269713342f},
-std::array<float,2>{0.0899050981f, 0.904672146f},
-std::array<float,2>{0.936875165f, 0.471442372f},
-std::array<float,2>{0.584351063f, 0.729611158f},
-std::array<float,2>{0.272317827f, 0.215338781f},
-std::array<float,2>{0.205930218f, 0.674911559f},
-std::array<float,2>{0.855075538f, 0.17839025f},
-std::array<float,2>{0.633526325f, 0.940478563f},
-std::array<float,2>{0.408086658f, 0.409369081f},
-std::array<float,2>{0.321927875f, 0.821087897f},
-std::array<float,2>{0.531570375f, 0.355029374f},
-std::array<float,2>{0.948376179f, 0.617184758f},
-std::array<float,2>{0.0617934987f, 0.119993664f},
-std::array<float,2>{0.361388534f, 0.599861324f},
-std::array<float,2>{0.50653547f, 0.0941629633f},
-std::array<float,2>{0.979881406f, 0.833582938f},
-std::array<float,2>{0.0239357986f, 0.369226485f},
-std::array<float,2>{0.228909597f, 0.966626227f},
-std::array<float,2>{0.822824776f, 0.435246587f},
-std::array<float,2>{0.669160128f, 0.660049677f},
-std::array<float,2>{0.391184032f, 0.158207208f},
-std::array<float,2>{0.120454997f, 0.740692019f},
-std::array<float,2>{0.881397784f, 0.19164896f},
-std::array<float,2>{0.614538074f, 0.880962491f},
-std::array<float,2>{0.294854105f, 0.492975831f},
-std::array<float,2>{0.464707226f, 0.775247633f},
-std::array<float,2>{0.71444118f, 0.254800528f},
-std::array<float,2>{0.791545808f, 0.527962387f},
-std::array<float,2>{0.134578854f, 0.000990384608f},
-std::array<float,2>{0.427566528f, 0.656233609f},
-std::array<float,2>{0.647594988f, 0.152394876f},
-std::array<float,2>{0.866141737f, 0.975123763f},
-std::array<float,2>{0.189550698f, 0.40165481f},
-std::array<float,2>{0.0333132446f, 0.868662834f},
-std::array<float,2>{0.960271776f, 0.319861352f},
-std::array<float,2>{0.557775736f, 0.564707577f},
-std::array<float,2>{0.333442926f, 0.0914094523f},
-std::array<float,2>{0.182912886f, 0.552881122f},
-std::array<float,2>{0.758668423f, 0.0613319725f},
-std::array<float,2>{0.743701041f, 0.803822577f},
-std::array<float,2>{0.486932337f, 0.293985456f},
-std::array<float,2>{0.252174675f, 0.910730302f},
-std::array<float,2>{0.57519716f, 0.453803658f},
-std::array<float,2>{0.915050566f, 0.710518122f},
-std::array<float,2>{0.0676078275f, 0.230588555f},
-std::array<float,2>{0.336673617f, 0.665700614f},
-std::array<float,2>{0.554634094f, 0.16543448f},
-std::array<float,2>{0.965209842f, 0.955105782f},
-std::array<float,2>{0.0421621054f, 0.429404557f},
-std::array<float,2>{0.200390726f, 0.837885439f},
-std::array<float,2>{0.870110869f, 0.366868854f},
-std::array<float,2>{0.654276073f, 0.602878153f},
-std::array<float,2>{0.433477432f, 0.108209297f},
-std::array<float,2>{0.0763036087f, 0.516604304f},
-std::array<float,2>{0.90999043f, 0.00952998083f},
-std::array<float,2>{0.564913452f, 0.766086102f},
-std::array<float,2>{0.25784418f, 0.260230005f},
-std::array<float,2>{0.496184409f, 0.889531255f},
-std::array<float,2>{0.742129862f, 0.48838684f},
-std::array<float,2>{0.757237315f, 0.744846463f},
-std::array<float,2>{0.178989217f, 0.202186316f},
-std::array<float,2>{0.400021225f, 0.572185993f},
-std::array<float,2>{0.662272394f, 0.0846063197f},
-std::array<float,2>{0.814639151f, 0.862216473f},
-std::array<float,2>{0.222271293f, 0.321580768f},
-std::array<float,2>{0.0223178249f, 0.980350494f},
-std::array<float,2>{0.971613824f, 0.397839516f},
-std::array<float,2>{0.513591647f, 0.641046047f},
-std::array<float,2>{0.37188974f, 0.142107606f},
-std::array<float,2>{0.131003901f, 0.711293578f},
-std::array<float,2>{0.787354648f, 0.219349474f},
-std::array<float,2>{0.710142374f, 0.914912701f},
-std::array<float,2>{0.459615797f, 0.467853427f},
-std::array<float,2>{0.286620498f, 0.805540919f},
-std::array<float,2>{0.617463291f, 0.282329232f},
-std::array<float,2>{0.884720266f, 0.559112906f},
-std::array<float,2>{0.115399957f, 0.0490630008f},
-std::array<float,2>{0.279083937f, 0.542278051f},
-std::array<float,2>{0.590889812f, 0.0390161909f},
-std::array<float,2>{0.929219961f, 0.793200195f},
-std::array<float,2>{0.0814047679f, 0.307513714f},
-std::array<float,2>{0.16981937f, 0.92306006f},
-std::array<float,2>{0.771846771f, 0.43754226f},
-std::array<float,2>{0.733341992f, 0.699101567f},
-std::array<float,2>{0.475818515f, 0.249042183f},
-std::array<float,2>{0.0516588353f, 0.63213414f},
-std::array<float,2>{0.942832828f, 0.131202415f},
-std::array<float,2>{0.542904973f, 0.997050107f},
-std::array<float,2>{0.313018888f, 0.385733575f},
-std::array<float,2>{0.415032834f, 0.844634593f},
-std::array<float,2>{0.630196869f, 0.328953624f},
-std::array<float,2>{0.850054145f, 0.586395383f},
-std::array<float,2>{0.214568153f, 0.0665972456f},
-std::array<float,2>{0.440249115f, 0.72270745f},
-std::array<float,2>{0.696857989f, 0.21084854f},
-std::array<float,2>{0.801449418f, 0.891517639f},
-std::array<float,2>{0.146282583f, 0.481336713f},
-std::array<float,2>{0.0995413959f, 0.758187711f},
-std::array<float,2>{0.89435637f, 0.281068295f},
-std::array<float,2>{0.600409746f, 0.500515699f},
-std::array<float,2>{0.299303144f, 0.0163978115f},
-std::array<float,2>{0.235806316f, 0.624927521f},
-std::array<float,2>{0.828677177f, 0.116160676f},
-std::array<float,2>{0.676762342f, 0.815826297f},
-std::array<float,2>{0.389864683f, 0.347403049f},
-std::array<float,2>{0.345910519f, 0.95296526f},
-std::array<float,2>{0.527790427f, 0.420547515f},
-std::array<float,2>{0.988397717f, 0.681142986f},
-std::array<float,2>{0.0146545768f, 0.18303518f},
-std::array<float,2>{0.330667675f, 0.722414374f},
-std::array<float,2>{0.561344624f, 0.20608598f},
-std::array<float,2>{0.956957519f, 0.896356821f},
-std::array<float,2>{0.0380857587f, 0.478317738f},
-std::array<float,2>{0.193058074f, 0.763922036f},
-std::array<float,2>{0.862441242f, 0.27657342f},
-std::array<float,2>{0.643147111f, 0.505741537f},
-std::array<float,2>{0.42282775f, 0.0213846564f},
-std::array<float,2>{0.0630105138f, 0.617299318f},
-std::array<float,2>{0.918073058f, 0.112764142f},
-std::array<float,2>{0.573346019f, 0.817762375f},
-std::array<float,2>{0.255266279f, 0.350047112f},
-std::array<float,2>{0.489733934f, 0.945575237f},
-std::array<float,2>{0.749147713f, 0.417865068f},
-std::array<float,2>{0.76229769f, 0.684384108f},
-std::array<float,2>{0.18608655f, 0.184717372f},
-std::array<float,2>{0.398323178f, 0.544194818f},
-std::array<float,2>{0.665487885f, 0.0326820351f},
-std::array<float,2>{0.82618171f, 0.790261149f},
-std::array<float,2>{0.232567012f, 0.310945511f},
-std::array<float,2>{0.0279355049f, 0.92714864f},
-std::array<float,2>{0.981457472f, 0.442164898f},
-std::array<float,2>{0.500393331f, 0.699517488f},
-std::array<float,2>{0.366906524f, 0.243910566f},
-std::array<float,2>{0.140601948f, 0.62695533f},
-std::array<float,2>{0.793833733f, 0.127287418f},
-std::array<float,2>{0.717861354f, 0.992211998f},
-std::array<float,2>{0.468214452f, 0.387859523f},
-std::array<float,2>{0.289329022f, 0.848999143f},
-std::array<float,2>{0.609612048f, 0.332458824f},
-std::array<float,2>{0.877621174f, 0.590191126f},
-std::array<float,2>{0.124413431f, 0.063079901f},
-std::array<float,2>{0.26573506f, 0.577870429f},
-std::array<float,2>{0.580542445f, 0.0790235475f},
-std::array<float,2>{0.931206048f, 0.8658849f},
-std::array<float,2>{0.0881058872f, 0.324726492f},
-std::array<float,2>{0.156646788f, 0.981762469f},
-std::array<float,2>{0.776213169f, 0.391764581f},
-std::array<float,2>{0.726465344f, 0.64808321f},
-std::array<float,2>{0.480478972f, 0.144802243f},
-std::array<float,2>{0.0574384928f, 0.716687918f},
-std::array<float,2>{0.951397657f, 0.22588256f},
-std::array<float,2>{0.535419345f, 0.920563102f},
-std::array<float,2>{0.32572934f, 0.462222248f},
-std::array<float,2>{0.412113696f, 0.81142813f},
-std::array<float,2>{0.636991084f, 0.287596315f},
-std::array<float,2>{0.856919348f, 0.558164477f},
-std::array<float,2>{0.20740138f, 0.0525126494f},
-std::array<float,2>{0.445811957f, 0.67113322f},
-std::array<float,2>{0.692447901f, 0.168296978f},
-std::array<float,2>{0.810552835f, 0.958102047f},
-std::array<float,2>{0.155873522f, 0.42429468f},
-std::array<float,2>{0.105192333f, 0.843255222f},
-std::array<float,2>{0.898896575f, 0.360122502f},
-std::array<float,2>{0.605451763f, 0.606474042f},
-std::array<float,2>{0.306317568f, 0.104478344f},
-std::array<float,2>{0.24567765f, 0.519929528f},
-std::array<float,2>{0.842570961f, 0.0131951384f},
-std::array<float,2>{0.680760264f, 0.772213697f},
-std::array<float,2>{0.381834656f, 0.261844546f},
-std::array<float,2>{0.35795337f, 0.883243442f},
-std::array<float,2>{0.516938567f, 0.485197872f},
-std::array<float,2>{0.99675703f, 0.747550845f},
-std::array<float,2>{0.00181225559f, 0.198983148f},
-std::array<float,2>{0.304640681f, 0.65042305f},
-std::array<float,2>{0.596649349f, 0.15151915f},
-std::array<float,2>{0.896259785f, 0.970815241f},
-std::array<float,2>{0.0944590271f, 0.405479938f},
-std::array<float,2>{0.143605813f, 0.87300539f},
-std::array<float,2>{0.798173845f, 0.31267181f},
-std::array<float,2>{0.700559795f, 0.568668783f},
-std::array<float,2>{0.444759518f, 0.0863534361f},
-std::array<float,2>{0.00822676253f, 0.548582494f},
-std::array<float,2>{0.986043513f, 0.0574483648f},
-std::array<float,2>{0.52727586f, 0.79995656f},
-std::array<float,2>{0.349424005f, 0.2920295f},
-std::array<float,2>{0.384464413f, 0.90929687f},
-std::array<float,2>{0.674651146f, 0.460344702f},
-std::array<float,2>{0.834501624f, 0.704821706f},
-std::array<float,2>{0.240134493f, 0.229292706f},
-std::array<float,2>{0.469840616f, 0.594228387f},
-std::array<float,2>{0.728515565f, 0.0993083715f},
-std::array<float,2>{0.76696986f, 0.828751683f},
-std::array<float,2>{0.166341186f, 0.37321046f},
-std::array<float,2>{0.0853789523f, 0.962308407f},
-std::array<float,2>{0.923058331f, 0.430635929f},
-std::array<float,2>{0.587168753f, 0.662879527f},
-std::array<float,2>{0.275065809f, 0.162194848f},
-std::array<float,2>{0.216552019f, 0.737813294f},
-std::array<float,2>{0.844969749f, 0.189119831f},
-std::array<float,2>{0.625747144f, 0.877367437f},
-std::array<float,2>{0.418344915f, 0.499216437f},
-std::array<float,2>{0.31714198f, 0.779694617f},
-std::array<float,2>{0.544261754f, 0.251188517f},
-std::array<float,2>{0.941273928f, 0.523526907f},
-std::array<float,2>{0.0483454019f, 0.00716447877f},
-std::array<float,2>{0.368647397f, 0.508178592f},
-std::array<float,2>{0.510564089f, 0.0275010262f},
-std::array<float,2>{0.974604189f, 0.751671791f},
-std::array<float,2>{0.0178667251f, 0.267985195f},
-std::array<float,2>{0.225697786f, 0.901200831f},
-std::array<float,2>{0.817386389f, 0.473637223f},
-std::array<float,2>{0.660092711f, 0.731828988f},
-std::array<float,2>{0.403181583f, 0.212682128f},
-std::array<float,2>{0.112753749f, 0.679615676f},
-std::array<float,2>{0.889407814f, 0.17551811f},
-std::array<float,2>{0.623134971f, 0.941485465f},
-std::array<float,2>{0.281545252f, 0.412440389f},
-std::array<float,2>{0.455300063f, 0.826018512f},
-std::array<float,2>{0.704737186f, 0.358003736f},
-std::array<float,2>{0.783773065f, 0.613017023f},
-std::array<float,2>{0.125524893f, 0.123646133f},
-std::array<float,2>{0.435601115f, 0.689631045f},
-std::array<float,2>{0.651359499f, 0.236272037f},
-std::array<float,2>{0.871380985f, 0.933623731f},
-std::array<float,2>{0.195593253f, 0.452795655f},
-std::array<float,2>{0.0445979945f, 0.784364939f},
-std::array<float,2>{0.963482022f, 0.302755475f},
-std::array<float,2>{0.547409058f, 0.532470286f},
-std::array<float,2>{0.341570526f, 0.0394287147f},
-std::array<float,2>{0.175314546f, 0.581165791f},
-std::array<float,2>{0.751614451f, 0.0757761672f},
-std::array<float,2>{0.736313403f, 0.858796f},
-std::array<float,2>{0.495910794f, 0.336551607f},
-std::array<float,2>{0.261759758f, 0.988621354f},
-std::array<float,2>{0.568199217f, 0.377962142f},
-std::array<float,2>{0.911768138f, 0.640248358f},
-std::array<float,2>{0.0706120357f, 0.138601825f},
-std::array<float,2>{0.251187205f, 0.709325969f},
-std::array<float,2>{0.576696038f, 0.232138306f},
-std::array<float,2>{0.916998863f, 0.911239862f},
-std::array<float,2>{0.0696942732f, 0.454494745f},
-std::array<float,2>{0.181640312f, 0.803106606f},
-std::array<float,2>{0.759777308f, 0.293054819f},
-std::array<float,2>{0.746061683f, 0.553922713f},
-std::array<float,2>{0.484414667f, 0.0619898476f},
-std::array<float,2>{0.0331035554f, 0.566071332f},
-std::array<float,2>{0.958721101f, 0.0899571553f},
-std::array<float,2>{0.556362152f, 0.867256939f},
-std::array<float,2>{0.334433407f, 0.318817049f},
-std::array<float,2>{0.429429412f, 0.97641027f},
-std::array<float,2>{0.645241201f, 0.400392592f},
-std::array<float,2>{0.8649562f, 0.655083477f},
-std::array<float,2>{0.18925944f, 0.153699204f},
-std::array<float,2>{0.462173581f, 0.528891444f},
-std::array<float,2>{0.711484015f, 0.000459145551f},
-std::array<float,2>{0.789116144f, 0.77377522f},
-std::array<float,2>{0.135355547f, 0.255318165f},
-std::array<float,2>{0.118152566f, 0.881959319f},
-std::array<float,2>{0.880416036f, 0.493947476f},
-std::array<float,2>{0.616260886f, 0.742186248f},
-std::array<float,2>{0.294932932f, 0.192400485f},
-std::array<float,2>{0.227970898f, 0.658431709f},
-std::array<float,2>{0.821019053f, 0.159185171f},
-std::array<float,2>{0.670046866f, 0.965007365f},
-std::array<float,2>{0.39279595f, 0.434029579f},
-std::array<float,2>{0.360637695f, 0.832885146f},
-std::array<float,2>{0.504067063f, 0.370827615f},
-std::array<float,2>{0.977112889f, 0.600946903f},
-std::array<float,2>{0.0267469827f, 0.0954122543f},
-std::array<float,2>{0.323788702f, 0.615441263f},
-std::array<float,2>{0.533219576f, 0.120713517f},
-std::array<float,2>{0.946058512f, 0.821538568f},
-std::array<float,2>{0.0602703728f, 0.3542023f},
-std::array<float,2>{0.204758808f, 0.939790666f},
-std::array<float,2>{0.852371156f, 0.408888459f},
-std::array<float,2>{0.635730088f, 0.673990488f},
-std::array<float,2>{0.410000116f, 0.179537699f},
-std::array<float,2>{0.0923147574f, 0.728566706f},
-std::array<float,2>{0.935172975f, 0.216006264f},
-std::array<float,2>{0.58397162f, 0.905829787f},
-std::array<float,2>{0.269634068f, 0.472636938f},
-std::array<float,2>{0.479561687f, 0.757361054f},
-std::array<float,2>{0.719597995f, 0.271449417f},
-std::array<float,2>{0.780296564f, 0.515611768f},
-std::array<float,2>{0.163611233f, 0.0247237645f},
-std::array<float,2>{0.377292603f, 0.634494722f},
-std::array<float,2>{0.685402751f, 0.135012329f},
-std::array<float,2>{0.83804673f, 0.985901594f},
-std::array<float,2>{0.248606041f, 0.380016714f},
-std::array<float,2>{0.00705229817f, 0.854463518f},
-std::array<float,2>{0.993985593f, 0.343654245f},
-std::array<float,2>{0.520742714f, 0.582194865f},
-std::array<float,2>{0.354241699f, 0.0737165958f},
-std::array<float,2>{0.151638761f, 0.535276294f},
-std::array<float,2>{0.805435121f, 0.0442531407f},
-std::array<float,2>{0.691115737f, 0.786990464f},
-std::array<float,2>{0.452525318f, 0.299225748f},
-std::array<float,2>{0.310425311f, 0.932026148f},
-std::array<float,2>{0.6059497f, 0.446933717f},
-std::array<float,2>{0.902952909f, 0.694524705f},
-std::array<float,2>{0.106285483f, 0.241130576f},
-std::array<float,2>{0.345257014f, 0.680411816f},
-std::array<float,2>{0.529384315f, 0.181714371f},
-std::array<float,2>{0.991083324f, 0.951892495f},
-std::array<float,2>{0.0120265447f, 0.421526939f},
-std::array<float,2>{0.237207189f, 0.814494073f},
-std::array<float,2>{0.831701934f, 0.345760316f},
-std::array<float,2>{0.678838074f, 0.623521924f},
-std::array<float,2>{0.388412505f, 0.116608836f},
-std::array<float,2>{0.101370052f, 0.501777232f},
-std::array<float,2>{0.892296433f, 0.0172737446f},
-std::array<float,2>{0.598577678f, 0.759010792f},
-std::array<float,2>{0.297422737f, 0.279468417f},
-std::array<float,2>{0.438212156f, 0.89213562f},
-std::array<float,2>{0.697476268f, 0.48237434f},
-std::array<float,2>{0.804023325f, 0.7244789f},
-std::array<float,2>{0.14813371f, 0.20983085f},
-std::array<float,2>{0.416834533f, 0.587366939f},
-std::array<float,2>{0.632341921f, 0.0680979937f},
-std::array<float,2>{0.84877336f, 0.844965398f},
-std::array<float,2>{0.212088346f, 0.329770476f},
-std::array<float,2>{0.0532137491f, 0.997324049f},
-std::array<float,2>{0.944051683f, 0.38668105f},
-std::array<float,2>{0.539669394f, 0.631410778f},
-std::array<float,2>{0.315031111f, 0.132483929f},
-std::array<float,2>{0.171672225f, 0.697672784f},
-std::array<float,2>{0.770430565f, 0.248800337f},
-std::array<float,2>{0.730687559f, 0.922050953f},
-std::array<float,2>{0.473492533f, 0.439437211f},
-std::array<float,2>{0.280937284f, 0.794360995f},
-std::array<float,2>{0.592306077f, 0.308331519f},
-std::array<float,2>{0.92735076f, 0.541796386f},
-std::array<float,2>{0.0800538808f, 0.0378079675f},
-std::array<float,2>{0.287630141f, 0.56024456f},
-std::array<float,2>{0.619524539f, 0.0504601821f},
-std::array<float,2>{0.886442244f, 0.805992603f},
-std::array<float,2>{0.11460954f, 0.282209367f},
-std::array<float,2>{0.130027637f, 0.915223241f},
-std::array<float,2>{0.785628974f, 0.467532277f},
-std::array<float,2>{0.708892345f, 0.711995244f},
-std::array<float,2>{0.457742423f, 0.220216662f},
-std::array<float,2>{0.0200581923f, 0.641716123f},
-std::array<float,2>{0.969831347f, 0.140653387f},
-std::array<float,2>{0.514536858f, 0.979476631f},
-std::array<float,2>{0.373968869f, 0.397383869f},
-std::array<float,2>{0.401131153f, 0.862451732f},
-std::array<float,2>{0.660451353f, 0.320362985f},
-std::array<float,2>{0.814350426f, 0.57043308f},
-std::array<float,2>{0.219164163f, 0.0856138319f},
-std::array<float,2>{0.499919742f, 0.74598819f},
-std::array<float,2>{0.739537656f, 0.201690555f},
-std::array<float,2>{0.754900992f, 0.890347004f},
-std::array<float,2>{0.176546484f, 0.490215719f},
-std::array<float,2>{0.0747009665f, 0.767559648f},
-std::array<float,2>{0.906924367f, 0.261425138f},
-std::array<float,2>{0.563516855f, 0.515741646f},
-std::array<float,2>{0.260327488f, 0.00846188143f},
-std::array<float,2>{0.202349052f, 0.601637185f},
-std::array<float,2>{0.867457032f, 0.108668998f},
-std::array<float,2>{0.654698491f, 0.836714208f},
-std::array<float,2>{0.429884464f, 0.365788132f},
-std::array<float,2>{0.338159829f, 0.956380129f},
-std::array<float,2>{0.552162945f, 0.428703219f},
-std::array<float,2>{0.968466938f, 0.664733052f},
-std::array<float,2>{0.0407517888f, 0.164539576f},
-std::array<float,2>{0.363888502f, 0.70160681f},
-std::array<float,2>{0.502277434f, 0.245703325f},
-std::array<float,2>{0.984113097f, 0.928919673f},
-std::array<float,2>{0.030246105f, 0.443595916f},
-std::array<float,2>{0.231690601f, 0.792220831f},
-std::array<float,2>{0.824225307f, 0.308995545f},
-std::array<float,2>{0.667646289f, 0.544926882f},
-std::array<float,2>{0.394861579f, 0.0347562395f},
-std::array<float,2>{0.122611679f, 0.592724204f},
-std::array<float,2>{0.875833273f, 0.0657850727f},
-std::array<float,2>{0.61323446f, 0.850951135f},
-std::array<float,2>{0.292906106f, 0.335211217f},
-std::array<float,2>{0.465938449f, 0.995827317f},
-std::array<float,2>{0.716595411f, 0.390534341f},
-std::array<float,2>{0.795519471f, 0.626749754f},
-std::array<float,2>{0.138457477f, 0.12620528f},
-std::array<float,2>{0.424992591f, 0.507373691f},
-std::array<float,2>{0.641060948f, 0.0223474093f},
-std::array<float,2>{0.861171007f, 0.76203692f},
-std::array<float,2>{0.194565684f, 0.274880171f},
-std::array<float,2>{0.036060743f, 0.897571206f},
-std::array<float,2>{0.953318834f, 0.479183733f},
-std::array<float,2>{0.560132444f, 0.7188254f},
-std::array<float,2>{0.329413772f, 0.204168737f},
-std::array<float,2>{0.184503376f, 0.686816573f},
-std::array<float,2>{0.764234602f, 0.187333941f},
-std::array<float,2>{0.748031139f, 0.948720813f},
-std::array<float,2>{0.490351051f, 0.415228218f},
-std::array<float,2>{0.256929874f, 0.818743169f},
-std::array<float,2>{0.571138859f, 0.349327236f},
-std::array<float,2>{0.921679497f, 0.621009886f},
-std::array<float,2>{0.066194877f, 0.11069265f},
-std::array<float,2>{0.30689165f, 0.608710766f},
-std::array<float,2>{0.602308214f, 0.102942958f},
-std::array<float,2>{0.902175486f, 0.841362f},
-std::array<float,2>{0.102826096f, 0.363012552f},
-std::array<float,2>{0.153692231f, 0.960754037f},
-std::array<float,2>{0.809777021f, 0.423039168f},
-std::array<float,2>{0.694153666f, 0.669206917f},
-std::array<float,2>{0.449040711f, 0.171499833f},
-std::array<float,2>{0.00203640922f, 0.749092102f},
-std::array<float,2>{0.999138117f, 0.195890129f},
-std::array<float,2>{0.518259406f, 0.886605024f},
-std::array<float,2>{0.356319934f, 0.48671189f},
-std::array<float,2>{0.380436152f, 0.770447075f},
-std::array<float,2>{0.682209194f, 0.26478973f},
-std::array<float,2>{0.841740012f, 0.521751046f},
-std::array<float,2>{0.243135825f, 0.0142338295f},
-std::array<float,2>{0.484155566f, 0.646162689f},
-std::array<float,2>{0.724302411f, 0.148106188f},
-std::array<float,2>{0.773619592f, 0.983845115f},
-std::array<float,2>{0.159153774f, 0.394058228f},
-std::array<float,2>{0.0874654576f, 0.863943219f},
-std::array<float,2>{0.933013797f, 0.327784896f},
-std::array<float,2>{0.578561962f, 0.57457906f},
-std::array<float,2>{0.267989278f, 0.0808838829f},
-std::array<float,2>{0.209685639f, 0.555792153f},
-std::array<float,2>{0.859181702f, 0.0539393388f},
-std::array<float,2>{0.638882041f, 0.810251117f},
-std::array<float,2>{0.411721677f, 0.285310894f},
-std::array<float,2>{0.326684058f, 0.919228196f},
-std::array<float,2>{0.538268089f, 0.463822693f},
-std::array<float,2>{0.949566126f, 0.718038857f},
-std::array<float,2>{0.0562093891f, 0.223069787f},
-std::array<float,2>{0.276064277f, 0.660853386f},
-std::array<float,2>{0.588614881f, 0.161037043f},
-std::array<float,2>{0.925302804f, 0.963193476f},
-std::array<float,2>{0.082486853f, 0.432774097f},
-std::array<float,2>{0.164300591f, 0.831602871f},
-std::array<float,2>{0.7693097f, 0.371938556f},
-std::array<float,2>{0.72966665f, 0.596372962f},
-std::array<float,2>{0.4721376f, 0.100845695f},
-std::array<float,2>{0.0488926545f, 0.526839435f},
-std::array<float,2>{0.937567413f, 0.00531491544f},
-std::array<float,2>{0.545110106f, 0.77854073f},
-std::array<float,2>{0.318597734f, 0.252605945f},
-std::array<float,2>{0.420957953f, 0.876076818f},
-std::array<float,2>{0.628070712f, 0.497754127f},
-std::array<float,2>{0.845773935f, 0.736022472f},
-std::array<float,2>{0.217813164f, 0.191103965f},
-std::array<float,2>{0.441449344f, 0.567979932f},
-std::array<float,2>{0.702966213f, 0.0880442932f},
-std::array<float,2>{0.79992485f, 0.874988317f},
-std::array<float,2>{0.140829772f, 0.314667523f},
-std::array<float,2>{0.0958497748f, 0.968775451f},
-std::array<float,2>{0.898095846f, 0.403172314f},
-std::array<float,2>{0.594219089f, 0.648877978f},
-std::array<float,2>{0.301303923f, 0.149518371f},
-std::array<float,2>{0.241477638f, 0.705178738f},
-std::array<float,2>{0.83248961f, 0.226683423f},
-std::array<float,2>{0.672452688f, 0.90697974f},
-std::array<float,2>{0.385485172f, 0.457589746f},
-std::array<float,2>{0.350321203f, 0.79707396f},
-std::array<float,2>{0.523836136f, 0.290871322f},
-std::array<float,2>{0.987026215f, 0.550030529f},
-std::array<float,2>{0.0113523146f, 0.0562988594f},
-std::array<float,2>{0.343233794f, 0.534099519f},
-std::array<float,2>{0.550222695f, 0.0418045111f},
-std::array<float,2>{0.960976124f, 0.782910407f},
-std::array<float,2>{0.0463802889f, 0.302354068f},
-std::array<float,2>{0.198958114f, 0.937455416f},
-std::array<float,2>{0.873533189f, 0.451065838f},
-std::array<float,2>{0.649718404f, 0.687634408f},
-std::array<float,2>{0.434724838f, 0.237985477f},
-std::array<float,2>{0.072895661f, 0.638508022f},
-std::array<float,2>{0.913430691f, 0.14019984f},
-std::array<float,2>{0.569659114f, 0.990677714f},
-std::array<float,2>{0.265183359f, 0.375847518f},
-std::array<float,2>{0.492758065f, 0.857125103f},
-std::array<float,2>{0.73749125f, 0.338109285f},
-std::array<float,2>{0.752774537f, 0.578188002f},
-std::array<float,2>{0.172472447f, 0.0770865381f},
-std::array<float,2>{0.405571342f, 0.732658744f},
-std::array<float,2>{0.656433523f, 0.21430254f},
-std::array<float,2>{0.820227981f, 0.899434388f},
-std::array<float,2>{0.224442437f, 0.475528389f},
-std::array<float,2>{0.0175682716f, 0.752186298f},
-std::array<float,2>{0.974963903f, 0.266270608f},
-std::array<float,2>{0.509326696f, 0.510483325f},
-std::array<float,2>{0.370979548f, 0.0294590537f},
-std::array<float,2>{0.128686443f, 0.609390378f},
-std::array<float,2>{0.783152103f, 0.121188775f},
-std::array<float,2>{0.706935227f, 0.826410294f},
-std::array<float,2>{0.454576433f, 0.357018679f},
-std::array<float,2>{0.28454715f, 0.943980157f},
-std::array<float,2>{0.622231424f, 0.411919236f},
-std::array<float,2>{0.888260901f, 0.676094055f},
-std::array<float,2>{0.110577732f, 0.172928751f},
-std::array<float,2>{0.293590605f, 0.739856184f},
-std::array<float,2>{0.613551736f, 0.194229603f},
-std::array<float,2>{0.882504642f, 0.879812241f},
-std::array<float,2>{0.119552083f, 0.494710565f},
-std::array<float,2>{0.1332452f, 0.77702558f},
-std::array<float,2>{0.792802393f, 0.256500304f},
-std::array<float,2>{0.713554382f, 0.530991256f},
-std::array<float,2>{0.463034153f, 0.00355535792f},
-std::array<float,2>{0.0245475117f, 0.599602044f},
-std::array<float,2>{0.979062915f, 0.0973959044f},
-std::array<float,2>{0.507239521f, 0.835631073f},
-std::array<float,2>{0.362795651f, 0.368346125f},
-std::array<float,2>{0.39236623f, 0.96808511f},
-std::array<float,2>{0.668035865f, 0.437277675f},
-std::array<float,2>{0.823732615f, 0.656564713f},
-std::array<float,2>{0.229604468f, 0.156534523f},
-std::array<float,2>{0.488231778f, 0.552700758f},
-std::array<float,2>{0.743013799f, 0.0594129935f},
-std::array<float,2>{0.759260595f, 0.801310122f},
-std::array<float,2>{0.18187955f, 0.29521957f},
-std::array<float,2>{0.0664908066f, 0.913670123f},
-std::array<float,2>{0.914867938f, 0.455101877f},
-std::array<float,2>{0.57447952f, 0.707922697f},
-std::array<float,2>{0.253832489f, 0.234339103f},
-std::array<float,2>{0.191347837f, 0.652699709f},
-std::array<float,2>{0.866277277f, 0.154730484f},
-std::array<float,2>{0.647260368f, 0.974014878f},
-std::array<float,2>{0.426265389f, 0.399450779f},
-std::array<float,2>{0.332351327f, 0.870552063f},
-std::array<float,2>{0.55756104f, 0.316592604f},
-std::array<float,2>{0.959884644f, 0.564273477f},
-std::array<float,2>{0.0344183035f, 0.0931277648f},
-std::array<float,2>{0.352870524f, 0.585346818f},
-std::array<float,2>{0.522813737f, 0.0721815377f},
-std::array<float,2>{0.994794309f, 0.852264583f},
-std::array<float,2>{0.00537364651f, 0.339846373f},
-std::array<float,2>{0.247773096f, 0.986757398f},
-std::array<float,2>{0.837760687f, 0.382506222f},
-std::array<float,2>{0.686349213f, 0.635394573f},
-std::array<float,2>{0.375390053f, 0.133677542f},
-std::array<float,2>{0.108869649f, 0.691594779f},
-std::array<float,2>{0.904325306f, 0.239173278f},
-std::array<float,2>{0.607937157f, 0.9310534f},
-std::array<float,2>{0.311857045f, 0.447466582f},
-std::array<float,2>{0.449846655f, 0.788600981f},
-std::array<float,2>{0.688186884f, 0.296891123f},
-std::array<float,2>{0.808102846f, 0.538992763f},
-std::array<float,2>{0.15032509f, 0.0466287844f},
-std::array<float,2>{0.406880081f, 0.672505617f},
-std::array<float,2>{0.634474754f, 0.176326603f},
-std::array<float,2>{0.853654027f, 0.938133538f},
-std::array<float,2>{0.206488118f, 0.407507092f},
-std::array<float,2>{0.0611283071f, 0.822768986f},
-std::array<float,2>{0.948022127f, 0.353422254f},
-std::array<float,2>{0.53293252f, 0.614949107f},
-std::array<float,2>{0.320824832f, 0.118207805f},
-std::array<float,2>{0.161408171f, 0.512138367f},
-std::array<float,2>{0.778238595f, 0.0254315808f},
-std::array<float,2>{0.721680641f, 0.754237413f},
-std::array<float,2>{0.477074414f, 0.271576464f},
-std::array<float,2>{0.273258775f, 0.903787017f},
-std::array<float,2>{0.585552335f, 0.469672859f},
-std::array<float,2>{0.935877144f, 0.728129029f},
-std::array<float,2>{0.0916401893f, 0.217863858f},
-std::array<float,2>{0.313690186f, 0.629327416f},
-std::array<float,2>{0.541624069f, 0.130060971f},
-std::array<float,2>{0.942063034f, 0.999583125f},
-std::array<float,2>{0.052692391f, 0.384416014f},
-std::array<float,2>{0.213083506f, 0.846509337f},
-std::array<float,2>{0.851060092f, 0.330192983f},
-std::array<float,2>{0.629116178f, 0.588300288f},
-std::array<float,2>{0.415845424f, 0.0690877959f},
-std::array<float,2>{0.0803703666f, 0.540023386f},
-std::array<float,2>{0.927746594f, 0.0358793922f},
-std::array<float,2>{0.589917898f, 0.794979632f},
-std::array<float,2>{0.278225571f, 0.305761725f},
-std::array<float,2>{0.474935532f, 0.925743997f},
-std::array<float,2>{0.733546078f, 0.43963939f},
-std::array<float,2>{0.773039818f, 0.696213067f},
-std::array<float,2>{0.168339893f, 0.246165231f},
-std::array<float,2>{0.389440626f, 0.622301102f},
-std::array<float,2>{0.676498353f, 0.114565112f},
-std::array<float,2>{0.830019593f, 0.813342273f},
-std::array<float,2>{0.234891355f, 0.344481885f},
-std::array<float,2>{0.0141215203f, 0.949673831f},
-std::array<float,2>{0.989321947f, 0.419530898f},
-std::array<float,2>{0.528495014f, 0.682137311f},
-std::array<float,2>{0.346963882f, 0.180520117f},
-std::array<float,2>{0.144593418f, 0.725813925f},
-std::array<float,2>{0.802461565f, 0.207736596f},
-std::array<float,2>{0.695480168f, 0.892785966f},
-std::array<float,2>{0.440917373f, 0.483418971f},
-std::array<float,2>{0.300683945f, 0.760492861f},
-std::array<float,2>{0.601095855f, 0.277621835f},
-std::array<float,2>{0.89354074f, 0.503561378f},
-std::array<float,2>{0.0983917341f, 0.0183688533f},
-std::array<float,2>{0.259066761f, 0.518522561f},
-std::array<float,2>{0.566252351f, 0.0109186517f},
-std::array<float,2>{0.908566654f, 0.768026769f},
-std::array<float,2>{0.0778666735f, 0.259406954f},
-std::array<float,2>{0.178074285f, 0.887044787f},
-std::array<float,2>{0.756667435f, 0.491300792f},
-std::array<float,2>{0.741209865f, 0.742591441f},
-std::array<float,2>{0.49715808f, 0.200476557f},
-std::array<float,2>{0.0415440239f, 0.66776067f},
-std::array<float,2>{0.966578126f, 0.166872337f},
-std::array<float,2>{0.55334574f, 0.953346133f},
-std::array<float,2>{0.3374919f, 0.425883383f},
-std::array<float,2>{0.431686014f, 0.839606583f},
-std::array<float,2>{0.652659535f, 0.364086449f},
-std::array<float,2>{0.870937347f, 0.603834867f},
-std::array<float,2>{0.199248746f, 0.105822302f},
-std::array<float,2>{0.460656404f, 0.713459253f},
-std::array<float,2>{0.709028602f, 0.220931202f},
-std::array<float,2>{0.788745761f, 0.9177683f},
-std::array<float,2>{0.131869391f, 0.466776401f},
-std::array<float,2>{0.116668642f, 0.806877792f},
-std::array<float,2>{0.883366644f, 0.28495726f},
-std::array<float,2>{0.618836284f, 0.560690403f},
-std::array<float,2>{0.285581261f, 0.0479239821f},
-std::array<float,2>{0.221614301f, 0.573496878f},
-std::array<float,2>{0.81602627f, 0.0824414715f},
-std::array<float,2>{0.663831413f, 0.860370338f},
-std::array<float,2>{0.398970604f, 0.324165106f},
-std::array<float,2>{0.372880638f, 0.977961421f},
-std::array<float,2>{0.512311041f, 0.396397829f},
-std::array<float,2>{0.971688151f, 0.644077778f},
-std::array<float,2>{0.0232087877f, 0.144407228f},
-std::array<float,2>{0.340970337f, 0.688008785f},
-std::array<float,2>{0.547092795f, 0.237350792f},
-std::array<float,2>{0.963102102f, 0.936813295f},
-std::array<float,2>{0.0440821238f, 0.450307637f},
-std::array<float,2>{0.196282834f, 0.78259033f},
-std::array<float,2>{0.871944487f, 0.302138984f},
-std::array<float,2>{0.650465608f, 0.533416092f},
-std::array<float,2>{0.436325282f, 0.0414388999f},
-std::array<float,2>{0.0712518021f, 0.57897985f},
-std::array<float,2>{0.911135912f, 0.0764293894f},
-std::array<float,2>{0.567848384f, 0.856773853f},
-std::array<float,2>{0.262616277f, 0.338837653f},
-std::array<float,2>{0.49524653f, 0.991108477f},
-std::array<float,2>{0.735669374f, 0.375122368f},
-std::array<float,2>{0.751194358f, 0.63801533f},
-std::array<float,2>{0.175101191f, 0.139785901f},
-std::array<float,2>{0.402347386f, 0.510023713f},
-std::array<float,2>{0.65944159f, 0.0302617978f},
-std::array<float,2>{0.817963243f, 0.752563059f},
-std::array<float,2>{0.226555154f, 0.265889466f},
-std::array<float,2>{0.0181561243f, 0.900340915f},
-std::array<float,2>{0.974017799f, 0.474617273f},
-std::array<float,2>{0.509808183f, 0.733260989f},
-std::array<float,2>{0.369090825f, 0.214797243f},
-std::array<float,2>{0.1251138f, 0.676629663f},
-std::array<float,2>{0.783563972f, 0.173722312f},
-std::array<float,2>{0.704576969f, 0.943439364f},
-std::array<float,2>{0.455945462f, 0.411346555f},
-std::array<float,2>{0.281937778f, 0.8269853f},
-std::array<float,2>{0.623642087f, 0.356902719f},
-std::array<float,2>{0.889073014f, 0.610319018f},
-std::array<float,2>{0.112995423f, 0.121699944f},
-std::array<float,2>{0.274472117f, 0.595952094f},
-std::array<float,2>{0.58748883f, 0.101197086f},
-std::array<float,2>{0.923652112f, 0.83117038f},
-std::array<float,2>{0.0856156498f, 0.371490479f},
-std::array<float,2>{0.166708559f, 0.963775754f},
-std::array<float,2>{0.7674312f, 0.433544844f},
-std::array<float,2>{0.727926433f, 0.66035378f},
-std::array<float,2>{0.470464379f, 0.160641924f},
-std::array<float,2>{0.0478830151f, 0.735407889f},
-std::array<float,2>{0.940694273f, 0.190906465f},
-std::array<float,2>{0.544478476f, 0.876603305f},
-std::array<float,2>{0.316690624f, 0.497109205f},
-std::array<float,2>{0.418797702f, 0.77910918f},
-std::array<float,2>{0.625105202f, 0.252248615f},
-std::array<float,2>{0.845254302f, 0.526877642f},
-std::array<float,2>{0.215836257f, 0.00565764075f},
-std::array<float,2>{0.445020109f, 0.649355531f},
-std::array<float,2>{0.700897753f, 0.150133997f},
-std::array<float,2>{0.798808634f, 0.969671607f},
-std::array<float,2>{0.14451465f, 0.402735442f},
-std::array<float,2>{0.0940702781f, 0.874479592f},
-std::array<float,2>{0.895627856f, 0.315062493f},
-std::array<float,2>{0.595882595f, 0.567536891f},
-std::array<float,2>{0.30406943f, 0.0886610821f},
-std::array<float,2>{0.239732116f, 0.550656199f},
-std::array<float,2>{0.834207416f, 0.0560391434f},
-std::array<float,2>{0.673931003f, 0.797369421f},
-std::array<float,2>{0.384235322f, 0.290215105f},
-std::array<float,2>{0.349067837f, 0.906370819f},
-std::array<float,2>{0.526422262f, 0.457274288f},
-std::array<float,2>{0.985805154f, 0.705621183f},
-std::array<float,2>{0.00874588732f, 0.227284446f},
-std::array<float,2>{0.306012422f, 0.669811845f},
-std::array<float,2>{0.604681909f, 0.171001211f},
-std::array<float,2>{0.899130583f, 0.960399568f},
-std::array<float,2>{0.104566358f, 0.4234007f},
-std::array<float,2>{0.155509084f, 0.841258049f},
-std::array<float,2>{0.811313629f, 0.362515807f},
-std::array<float,2>{0.69323796f, 0.609170735f},
-std::array<float,2>{0.44576624f, 0.10336595f},
-std::array<float,2>{0.00127776433f, 0.522362947f},
-std::array<float,2>{0.9961676f, 0.0140952989f},
-std::array<float,2>{0.517217219f, 0.76999563f},
-std::array<float,2>{0.357702792f, 0.265267521f},
-std::array<float,2>{0.381332815f, 0.886098385f},
-std::array<float,2>{0.681453168f, 0.487049818f},
-std::array<float,2>{0.842027903f, 0.749976218f},
-std::array<float,2>{0.245555758f, 0.195597589f},
-std::array<float,2>{0.481263697f, 0.575066924f},
-std::array<float,2>{0.72589165f, 0.0801790282f},
-std::array<float,2>{0.775409102f, 0.863299906f},
-std::array<float,2>{0.157153085f, 0.327464908f},
-std::array<float,2>{0.0888052955f, 0.983985662f},
-std::array<float,2>{0.93111062f, 0.393830806f},
-std::array<float,2>{0.581023276f, 0.645559847f},
-std::array<float,2>{0.266223311f, 0.14788942f},
-std::array<float,2>{0.207847908f, 0.718473911f},
-std::array<float,2>{0.856997848f, 0.22329244f},
-std::array<float,2>{0.637300551f, 0.919715881f},
-std::array<float,2>{0.41282323f, 0.463295817f},
-std::array<float,2>{0.325494915f, 0.809942365f},
-std::array<float,2>{0.535761535f, 0.286087334f},
-std::array<float,2>{0.951841354f, 0.556284964f},
-std::array<float,2>{0.0567305498f, 0.0545679517f},
-std::array<float,2>{0.366614461f, 0.545753777f},
-std::array<float,2>{0.500495553f, 0.0342450663f},
-std::array<float,2>{0.981965125f, 0.792880476f},
-std::array<float,2>{0.027620716f, 0.309529781f},
-std::array<float,2>{0.233268961f, 0.929302454f},
-std::array<float,2>{0.827123463f, 0.444178879f},
-std::array<float,2>{0.665570736f, 0.702038527f},
-std::array<float,2>{0.397726834f, 0.245482996f},
-std::array<float,2>{0.124557525f, 0.626335382f},
-std::array<float,2>{0.877412796f, 0.126810685f},
-std::array<float,2>{0.610130131f, 0.995143831f},
-std::array<float,2>{0.289612591f, 0.389746606f},
-std::array<float,2>{0.468509972f, 0.851409912f},
-std::array<float,2>{0.718415558f, 0.335635364f},
-std::array<float,2>{0.793198824f, 0.591839015f},
-std::array<float,2>{0.13978523f, 0.0662768409f},
-std::array<float,2>{0.421953261f, 0.719561517f},
-std::array<float,2>{0.64304328f, 0.20472388f},
-std::array<float,2>{0.863211513f, 0.897996664f},
-std::array<float,2>{0.192714095f, 0.478907526f},
-std::array<float,2>{0.0373531654f, 0.762655675f},
-std::array<float,2>{0.9561584f, 0.274977863f},
-std::array<float,2>{0.560749769f, 0.506917059f},
-std::array<float,2>{0.330293387f, 0.0216602664f},
-std::array<float,2>{0.185635746f, 0.620490015f},
-std::array<float,2>{0.762000144f, 0.111228459f},
-std::array<float,2>{0.749617636f, 0.818946898f},
-std::array<float,2>{0.490068406f, 0.348925769f},
-std::array<float,2>{0.255384952f, 0.948819757f},
-std::array<float,2>{0.57418555f, 0.415780723f},
-std::array<float,2>{0.91847688f, 0.687449515f},
-std::array<float,2>{0.0626226291f, 0.186885551f},
-std::array<float,2>{0.260154396f, 0.742688119f},
-std::array<float,2>{0.564295053f, 0.200970113f},
-std::array<float,2>{0.906300545f, 0.88751936f},
-std::array<float,2>{0.0749764964f, 0.491816789f},
-std::array<float,2>{0.17611441f, 0.768442571f},
-std::array<float,2>{0.755371332f, 0.258901924f},
-std::array<float,2>{0.739752352f, 0.518042743f},
-std::array<float,2>{0.499345005f, 0.0114063025f},
-std::array<float,2>{0.040254198f, 0.604296505f},
-std::array<float,2>{0.968033969f, 0.106419474f},
-std::array<float,2>{0.552528977f, 0.839305818f},
-std::array<float,2>{0.338617265f, 0.36353901f},
-std::array<float,2>{0.430286944f, 0.954008818f},
-std::array<float,2>{0.655080438f, 0.426288337f},
-std::array<float,2>{0.867768764f, 0.667080641f},
-std::array<float,2>{0.203067616f, 0.166212156f},
-std::array<float,2>{0.457179904f, 0.561154306f},
-std::array<float,2>{0.708010077f, 0.0486153699f},
-std::array<float,2>{0.785968602f, 0.807445765f},
-std::array<float,2>{0.130578503f, 0.284371406f},
-std::array<float,2>{0.114940643f, 0.917105079f},
-std::array<float,2>{0.886016428f, 0.466075599f},
-std::array<float,2>{0.619896114f, 0.713176131f},
-std::array<float,2>{0.287283957f, 0.221470609f},
-std::array<float,2>{0.219376981f, 0.643703461f},
-std::array<float,2>{0.813665867f, 0.144034788f},
-std::array<float,2>{0.661073148f, 0.978508055f},
-std::array<float,2>{0.400702775f, 0.39567259f},
-std::array<float,2>{0.373375565f, 0.861094952f},
-std::array<float,2>{0.514111221f, 0.323295921f},
-std::array<float,2>{0.970474541f, 0.573943615f},
-std::array<float,2>{0.0197803415f, 0.0825663581f},
-std::array<float,2>{0.314918458f, 0.588502049f},
-std::array<float,2>{0.539373517f, 0.0685380176f},
-std::array<float,2>{0.943828762f, 0.845943391f},
-std::array<float,2>{0.0537027232f, 0.330567509f},
-std::array<float,2>{0.212528676f, 0.999462008f},
-std::array<float,2>{0.849163473f, 0.383834988f},
-std::array<float,2>{0.632152438f, 0.629467607f},
-std::array<float,2>{0.41606757f, 0.130839422f},
-std::array<float,2>{0.0794554651f, 0.69561106f},
-std::array<float,2>{0.926961005f, 0.246582508f},
-std::array<float,2>{0.59184444f, 0.924917996f},
-std::array<float,2>{0.280640632f, 0.439956009f},
-std::array<float,2>{0.472726762f, 0.795695245f},
-std::array<float,2>{0.731369495f, 0.30660364f},
-std::array<float,2>{0.769794106f, 0.539083302f},
-std::array<float,2>{0.171104521f, 0.0353168286f},
-std::array<float,2>{0.387967288f, 0.68205601f},
-std::array<float,2>{0.679656982f, 0.179990828f},
-std::array<float,2>{0.831540942f, 0.950158238f},
-std::array<float,2>{0.236353353f, 0.419273823f},
-std::array<float,2>{0.0125782117f, 0.81275773f},
-std::array<float,2>{0.990539551f, 0.344055682f},
-std::array<float,2>{0.529990911f, 0.622824252f},
-std::array<float,2>{0.345025688f, 0.115140647f},
-std::array<float,2>{0.147843763f, 0.503187478f},
-std::array<float,2>{0.804341912f, 0.0176596679f},
-std::array<float,2>{0.697803855f, 0.75989455f},
-std::array<float,2>{0.437506735f, 0.277873427f},
-std::array<float,2>{0.29699862f, 0.893323541f},
-std::array<float,2>{0.598085165f, 0.484356105f},
-std::array<float,2>{0.891747952f, 0.7263785f},
-std::array<float,2>{0.100586265f, 0.207205698f},
-std::array<float,2>{0.353710979f, 0.634992719f},
-std::array<float,2>{0.521416545f, 0.133297443f},
-std::array<float,2>{0.993352234f, 0.986875117f},
-std::array<float,2>{0.00768248923f, 0.381836951f},
-std::array<float,2>{0.248063579f, 0.851721108f},
-std::array<float,2>{0.838793337f, 0.340616822f},
-std::array<float,2>{0.684999704f, 0.585879505f},
-std::array<float,2>{0.377909034f, 0.0716594905f},
-std::array<float,2>{0.105773553f, 0.538189888f},
-std::array<float,2>{0.902785957f, 0.046274066f},
-std::array<float,2>{0.606052101f, 0.78816998f},
-std::array<float,2>{0.31000191f, 0.297701061f},
-std::array<float,2>{0.453108013f, 0.931580424f},
-std::array<float,2>{0.690438867f, 0.448183775f},
-std::array<float,2>{0.805112243f, 0.692205012f},
-std::array<float,2>{0.152025968f, 0.238668799f},
-std::array<float,2>{0.409598231f, 0.614501417f},
-std::array<float,2>{0.63496834f, 0.119120158f},
-std::array<float,2>{0.85167551f, 0.822674036f},
-std::array<float,2>{0.204310596f, 0.352977753f},
-std::array<float,2>{0.0597718619f, 0.937555134f},
-std::array<float,2>{0.945524991f, 0.408191293f},
-std::array<float,2>{0.533748984f, 0.671875775f},
-std::array<float,2>{0.323356807f, 0.176027924f},
-std::array<float,2>{0.163302809f, 0.727817476f},
-std::array<float,2>{0.7808429f, 0.218601391f},
-std::array<float,2>{0.719186842f, 0.904260278f},
-std::array<float,2>{0.480228812f, 0.468856007f},
-std::array<float,2>{0.270394862f, 0.754729271f},
-std::array<float,2>{0.583075583f, 0.272439897f},
-std::array<float,2>{0.934813976f, 0.512248933f},
-std::array<float,2>{0.0919853076f, 0.026271442f},
-std::array<float,2>{0.295542866f, 0.530655861f},
-std::array<float,2>{0.617038667f, 0.00307898922f},
-std::array<float,2>{0.880060136f, 0.776627898f},
-std::array<float,2>{0.117307507f, 0.255876511f},
-std::array<float,2>{0.135120004f, 0.879041195f},
-std::array<float,2>{0.789580286f, 0.494405746f},
-std::array<float,2>{0.711058736f, 0.739685595f},
-std::array<float,2>{0.46267423f, 0.193481728f},
-std::array<float,2>{0.0271269158f, 0.656787574f},
-std::array<float,2>{0.976935744f, 0.156934798f},
-std::array<float,2>{0.504791319f, 0.968389988f},
-std::array<float,2>{0.361310124f, 0.436592996f},
-std::array<float,2>{0.393112659f, 0.834973752f},
-std::array<float,2>{0.67080754f, 0.369127363f},
-std::array<float,2>{0.820606053f, 0.598978639f},
-std::array<float,2>{0.228237703f, 0.0966990218f},
-std::array<float,2>{0.485184789f, 0.7072469f},
-std::array<float,2>{0.745569825f, 0.233500525f},
-std::array<float,2>{0.760715008f, 0.913184941f},
-std::array<float,2>{0.18088606f, 0.455711275f},
-std::array<float,2>{0.069848597f, 0.801088274f},
-std::array<float,2>{0.917486608f, 0.29561615f},
-std::array<float,2>{0.576497674f, 0.55186832f},
-std::array<float,2>{0.251578093f, 0.0589865409f},
-std::array<float,2>{0.188494146f, 0.563856423f},
-std::array<float,2>{0.864654481f, 0.0935682058f},
-std::array<float,2>{0.644712329f, 0.870841205f},
-std::array<float,2>{0.429160565f, 0.317375898f},
-std::array<float,2>{0.334938735f, 0.97452718f},
-std::array<float,2>{0.556035161f, 0.40011695f},
-std::array<float,2>{0.958454669f, 0.653244793f},
-std::array<float,2>{0.0326619074f, 0.155022576f},
-std::array<float,2>{0.370168507f, 0.732012212f},
-std::array<float,2>{0.508791506f, 0.212182432f},
-std::array<float,2>{0.975429833f, 0.900539994f},
-std::array<float,2>{0.0170680285f, 0.474582613f},
-std::array<float,2>{0.224038705f, 0.751253784f},
-std::array<float,2>{0.819531798f, 0.268416733f},
-std::array<float,2>{0.656936586f, 0.508638799f},
-std::array<float,2>{0.406075239f, 0.028197784f},
-std::array<float,2>{0.110939302f, 0.612321794f},
-std::array<float,2>{0.88784349f, 0.123508289f},
-std::array<float,2>{0.622976363f, 0.825301349f},
-std::array<float,2>{0.284958154f, 0.357561439f},
-std::array<float,2>{0.45460245f, 0.942216814f},
-std::array<float,2>{0.706335187f, 0.412643969f},
-std::array<float,2>{0.782427907f, 0.679173291f},
-std::array<float,2>{0.127945051f, 0.175051883f},
-std::array<float,2>{0.435296535f, 0.532750189f},
-std::array<float,2>{0.650272429f, 0.0400247052f},
-std::array<float,2>{0.874009848f, 0.785021067f},
-std::array<float,2>{0.198724493f, 0.303500712f},
-std::array<float,2>{0.0467821136f, 0.934177279f},
-std::array<float,2>{0.961452425f, 0.452579319f},
-std::array<float,2>{0.55063659f, 0.689973354f},
-std::array<float,2>{0.343346626f, 0.235590249f},
-std::array<float,2>{0.172006354f, 0.639959872f},
-std::array<float,2>{0.752357125f, 0.138026595f},
-std::array<float,2>{0.738141894f, 0.989257216f},
-std::array<float,2>{0.492207617f, 0.378423572f},
-std::array<float,2>{0.264690965f, 0.858969629f},
-std::array<float,2>{0.569854975f, 0.336171061f},
-std::array<float,2>{0.913587451f, 0.58171618f},
-std::array<float,2>{0.0724038333f, 0.0754990652f},
-std::array<float,2>{0.30116272f, 0.568984747f},
-std::array<float,2>{0.594673932f, 0.0868586972f},
-std::array<float,2>{0.897470117f, 0.872382581f},
-std::array<float,2>{0.0964360833f, 0.313196689f},
-std::array<float,2>{0.141144529f, 0.971503139f},
-std::array<float,2>{0.800439417f, 0.406226456f},
-std::array<float,2>{0.702507436f, 0.65091455f},
-std::array<float,2>{0.442277968f, 0.152324006f},
-std::array<float,2>{0.0108427489f, 0.704584241f},
-std::array<float,2>{0.986793697f, 0.228864729f},
-std::array<float,2>{0.524254262f, 0.909692407f},
-std::array<float,2>{0.349714905f, 0.460501015f},
-std::array<float,2>{0.385065377f, 0.800437212f},
-std::array<float,2>{0.671976268f, 0.292735487f},
-std::array<float,2>{0.83272016f, 0.547920942f},
-std::array<float,2>{0.242044523f, 0.0570865609f},
-std::array<float,2>{0.472210318f, 0.66239351f},
-std::array<float,2>{0.730121613f, 0.162614301f},
-std::array<float,2>{0.768596768f, 0.962402821f},
-std::array<float,2>{0.164857253f, 0.429956764f},
-std::array<float,2>{0.0828869417f, 0.828443885f},
-std::array<float,2>{0.924825847f, 0.373897433f},
-std::array<float,2>{0.588217497f, 0.594632268f},
-std::array<float,2>{0.275775969f, 0.0987652093f},
-std::array<float,2>{0.218664497f, 0.524118841f},
-std::array<float,2>{0.846288562f, 0.0076899617f},
-std::array<float,2>{0.62846446f, 0.779985964f},
-std::array<float,2>{0.421551406f, 0.251844883f},
-std::array<float,2>{0.319022f, 0.877517998f},
-std::array<float,2>{0.545693636f, 0.499733061f},
-std::array<float,2>{0.938436806f, 0.737753272f},
-std::array<float,2>{0.049752865f, 0.188600197f},
-std::array<float,2>{0.268211901f, 0.647887409f},
-std::array<float,2>{0.579061627f, 0.145250246f},
-std::array<float,2>{0.933550835f, 0.982369006f},
-std::array<float,2>{0.0871009529f, 0.392520756f},
-std::array<float,2>{0.158295512f, 0.865590155f},
-std::array<float,2>{0.773930013f, 0.324235559f},
-std::array<float,2>{0.723814309f, 0.577468812f},
-std::array<float,2>{0.483724505f, 0.0783456638f},
-std::array<float,2>{0.0561182834f, 0.557739973f},
-std::array<float,2>{0.949761093f, 0.0518855974f},
-std::array<float,2>{0.539028704f, 0.810975313f},
-std::array<float,2>{0.326451898f, 0.28803283f},
-std::array<float,2>{0.411275744f, 0.920229197f},
-std::array<float,2>{0.639438331f, 0.462750018f},
-std::array<float,2>{0.858595908f, 0.715923488f},
-std::array<float,2>{0.209142432f, 0.226377845f},
-std::array<float,2>{0.448697925f, 0.607061446f},
-std::array<float,2>{0.693700314f, 0.103768319f},
-std::array<float,2>{0.810255527f, 0.843491852f},
-std::array<float,2>{0.154238313f, 0.3598167f},
-std::array<float,2>{0.103412695f, 0.9585132f},
-std::array<float,2>{0.901470065f, 0.424734563f},
-std::array<float,2>{0.601994157f, 0.671485305f},
-std::array<float,2>{0.30756852f, 0.168764412f},
-std::array<float,2>{0.242598876f, 0.747799456f},
-std::array<float,2>{0.841180325f, 0.198543519f},
-std::array<float,2>{0.681880832f, 0.883680701f},
-std::array<float,2>{0.379910767f, 0.48473984f},
-std::array<float,2>{0.355545908f, 0.771868229f},
-std::array<float,2>{0.517866373f, 0.262475252f},
-std::array<float,2>{0.999581039f, 0.520183623f},
-std::array<float,2>{0.00258559245f, 0.0127218934f},
-std::array<float,2>{0.329958379f, 0.50494051f},
-std::array<float,2>{0.559968948f, 0.0209254846f},
-std::array<float,2>{0.953658342f, 0.764365137f},
-std::array<float,2>{0.0355098583f, 0.277249634f},
-std::array<float,2>{0.194828361f, 0.895890057f},
-std::array<float,2>{0.860628545f, 0.477731496f},
-std::array<float,2>{0.641592026f, 0.721711695f},
-std::array<float,2>{0.425699949f, 0.206753239f},
-std::array<float,2>{0.0659150779f, 0.683619738f},
-std::array<float,2>{0.921384752f, 0.185076058f},
-std::array<float,2>{0.57076031f, 0.945884287f},
-std::array<float,2>{0.257412881f, 0.417458624f},
-std::array<float,2>{0.491194189f, 0.818044245f},
-std::array<float,2>{0.747221768f, 0.350363463f},
-std::array<float,2>{0.764036953f, 0.618007779f},
-std::array<float,2>{0.184017897f, 0.113074787f},
-std::array<float,2>{0.395486116f, 0.699851334f},
-std::array<float,2>{0.667474329f, 0.243258476f},
-std::array<float,2>{0.825114846f, 0.927250683f},
-std::array<float,2>{0.232236952f, 0.441621989f},
-std::array<float,2>{0.0295490958f, 0.790614426f},
-std::array<float,2>{0.983472466f, 0.311110914f},
-std::array<float,2>{0.50253588f, 0.54484129f},
-std::array<float,2>{0.363708943f, 0.032896962f},
-std::array<float,2>{0.137697801f, 0.590790808f},
-std::array<float,2>{0.795129001f, 0.0628815368f},
-std::array<float,2>{0.716146767f, 0.849423528f},
-std::array<float,2>{0.466637075f, 0.332806021f},
-std::array<float,2>{0.292365611f, 0.992834687f},
-std::array<float,2>{0.612774611f, 0.388468325f},
-std::array<float,2>{0.875240505f, 0.627827287f},
-std::array<float,2>{0.122510888f, 0.127822757f},
-std::array<float,2>{0.285842031f, 0.712548733f},
-std::array<float,2>{0.618639588f, 0.219899446f},
-std::array<float,2>{0.883152902f, 0.915982008f},
-std::array<float,2>{0.116970725f, 0.467057377f},
-std::array<float,2>{0.13275972f, 0.806521595f},
-std::array<float,2>{0.788347423f, 0.281377703f},
-std::array<float,2>{0.709759772f, 0.559844494f},
-std::array<float,2>{0.46044153f, 0.0502506532f},
-std::array<float,2>{0.0225440916f, 0.571121693f},
-std::array<float,2>{0.972551763f, 0.0851413533f},
-std::array<float,2>{0.511778414f, 0.862959623f},
-std::array<float,2>{0.372436404f, 0.320907146f},
-std::array<float,2>{0.39857319f, 0.97882694f},
-std::array<float,2>{0.663120508f, 0.396801054f},
-std::array<float,2>{0.815528572f, 0.642317593f},
-std::array<float,2>{0.221097618f, 0.141560286f},
-std::array<float,2>{0.497933388f, 0.516355753f},
-std::array<float,2>{0.740277946f, 0.00789310411f},
-std::array<float,2>{0.755967319f, 0.766658843f},
-std::array<float,2>{0.178496704f, 0.261052221f},
-std::array<float,2>{0.0775345787f, 0.889791429f},
-std::array<float,2>{0.908926368f, 0.489602029f},
-std::array<float,2>{0.565704226f, 0.745594501f},
-std::array<float,2>{0.259612024f, 0.20154658f},
-std::array<float,2>{0.199722737f, 0.664547443f},
-std::array<float,2>{0.870478213f, 0.164861932f},
-std::array<float,2>{0.652860284f, 0.956942201f},
-std::array<float,2>{0.432515681f, 0.427809149f},
-std::array<float,2>{0.337091267f, 0.836269975f},
-std::array<float,2>{0.553005159f, 0.365475684f},
-std::array<float,2>{0.965860486f, 0.602292597f},
-std::array<float,2>{0.0411993377f, 0.108934425f},
-std::array<float,2>{0.347224802f, 0.623739183f},
-std::array<float,2>{0.529266f, 0.116702788f},
-std::array<float,2>{0.990129769f, 0.815374732f},
-std::array<float,2>{0.014271141f, 0.346531659f},
-std::array<float,2>{0.234632909f, 0.951458812f},
-std::array<float,2>{0.829303265f, 0.421225756f},
-std::array<float,2>{0.676169336f, 0.679943264f},
-std::array<float,2>{0.38906762f, 0.182593495f},
-std::array<float,2>{0.0979038104f, 0.723834395f},
-std::array<float,2>{0.892955422f, 0.209346533f},
-std::array<float,2>{0.600889206f, 0.891839147f},
-std::array<float,2>{0.300283343f, 0.481690913f},
-std::array<float,2>{0.440996021f, 0.759615541f},
-std::array<float,2>{0.696058035f, 0.280070156f},
-std::array<float,2>{0.802214622f, 0.501176953f},
-std::array<float,2>{0.14550291f, 0.0167938601f},
-std::array<float,2>{0.415367156f, 0.631313086f},
-std::array<float,2>{0.629882097f, 0.132311195f},
-std::array<float,2>{0.851115763f, 0.997707605f},
-std::array<float,2>{0.21359624f, 0.385770559f},
-std::array<float,2>{0.0518433824f, 0.845250428f},
-std::array<float,2>{0.941835761f, 0.329186678f},
-std::array<float,2>{0.541285396f, 0.58785224f},
-std::array<float,2>{0.314060599f, 0.0677956864f},
-std::array<float,2>{0.168835595f, 0.541208923f},
-std::array<float,2>{0.772537947f, 0.0375813507f},
-std::array<float,2>{0.734250546f, 0.794847608f},
-std::array<float,2>{0.47532782f, 0.307797611f},
-std::array<float,2>{0.277555466f, 0.922388077f},
-std::array<float,2>{0.590444565f, 0.438679665f},
-std::array<float,2>{0.928639472f, 0.698218822f},
-std::array<float,2>{0.0808883309f, 0.248047069f},
-std::array<float,2>{0.32064712f, 0.674616218f},
-std::array<float,2>{0.532359779f, 0.179056421f},
-std::array<float,2>{0.94754076f, 0.940346777f},
-std::array<float,2>{0.0605499633f, 0.408555359f},
-std::array<float,2>{0.206637517f, 0.82194823f},
-std::array<float,2>{0.854141355f, 0.353933752f},
-std::array<float,2>{0.634024858f, 0.616069376f},
-std::array<float,2>{0.406442314f, 0.120563187f},
-std::array<float,2>{0.0911872163f, 0.514830947f},
-std::array<float,2>{0.936504483f, 0.0250975471f},
-std::array<float,2>{0.585055351f, 0.757008553f},
-std::array<float,2>{0.272474557f, 0.270572037f},
-std::array<float,2>{0.476619184f, 0.905466795f},
-std::array<float,2>{0.722174168f, 0.472093254f},
-std::array<float,2>{0.777498901f, 0.729054987f},
-std::array<float,2>{0.161975518f, 0.216539398f},
-std::array<float,2>{0.375538021f, 0.58281225f},
-std::array<float,2>{0.685876489f, 0.0739018396f},
-std::array<float,2>{0.837025881f, 0.853834212f},
-std::array<float,2>{0.247397318f, 0.342898667f},
-std::array<float,2>{0.00526778353f, 0.985798717f},
-std::array<float,2>{0.994340062f, 0.380537868f},
-std::array<float,2>{0.523339927f, 0.634028196f},
-std::array<float,2>{0.353070974f, 0.135254338f},
-std::array<float,2>{0.149860784f, 0.694986939f},
-std::array<float,2>{0.808414698f, 0.240516618f},
-std::array<float,2>{0.68770498f, 0.932401121f},
-std::array<float,2>{0.4494358f, 0.446580708f},
-std::array<float,2>{0.312406272f, 0.786591589f},
-std::array<float,2>{0.607772052f, 0.299580872f},
-std::array<float,2>{0.905223548f, 0.535890818f},
-std::array<float,2>{0.108897947f, 0.0447557233f},
-std::array<float,2>{0.252945483f, 0.55439508f},
-std::array<float,2>{0.575122714f, 0.0622364394f},
-std::array<float,2>{0.914319992f, 0.803698719f},
-std::array<float,2>{0.0672294497f, 0.293604404f},
-std::array<float,2>{0.182376817f, 0.911685467f},
-std::array<float,2>{0.759352505f, 0.454885185f},
-std::array<float,2>{0.742393732f, 0.709716558f},
-std::array<float,2>{0.487709582f, 0.231759399f},
-std::array<float,2>{0.0348559655f, 0.654508352f},
-std::array<float,2>{0.959101677f, 0.154161364f},
-std::array<float,2>{0.55696255f, 0.97584182f},
-std::array<float,2>{0.332705557f, 0.401072979f},
-std::array<float,2>{0.426461935f, 0.868041158f},
-std::array<float,2>{0.646945596f, 0.319267929f},
-std::array<float,2>{0.866864741f, 0.56564045f},
-std::array<float,2>{0.190859452f, 0.0904986486f},
-std::array<float,2>{0.463742912f, 0.741261303f},
-std::array<float,2>{0.712938666f, 0.193279848f},
-std::array<float,2>{0.792344987f, 0.882372439f},
-std::array<float,2>{0.13356033f, 0.493213892f},
-std::array<float,2>{0.119961187f, 0.774097323f},
-std::array<float,2>{0.882231712f, 0.25557515f},
-std::array<float,2>{0.613969684f, 0.528769314f},
-std::array<float,2>{0.293097436f, 0.000830202713f},
-std::array<float,2>{0.230004445f, 0.601304591f},
-std::array<float,2>{0.823612213f, 0.0949746147f},
-std::array<float,2>{0.668851256f, 0.832047224f},
-std::array<float,2>{0.391956121f, 0.370170534f},
-std::array<float,2>{0.362564564f, 0.965504587f},
-std::array<float,2>{0.507561445f, 0.43452096f},
-std::array<float,2>{0.978571832f, 0.659018517f},
-std::array<float,2>{0.0250960421f, 0.160095066f},
-std::array<float,2>{0.317812443f, 0.736916542f},
-std::array<float,2>{0.543067932f, 0.18801114f},
-std::array<float,2>{0.939666152f, 0.878270447f},
-std::array<float,2>{0.0478204973f, 0.498079181f},
-std::array<float,2>{0.215456516f, 0.780414104f},
-std::array<float,2>{0.844560862f, 0.250920236f},
-std::array<float,2>{0.626055479f, 0.524976492f},
-std::array<float,2>{0.419101954f, 0.00594327645f},
-std::array<float,2>{0.0844447911f, 0.595283926f},
-std::array<float,2>{0.922340393f, 0.0981253013f},
-std::array<float,2>{0.58597523f, 0.829947352f},
-std::array<float,2>{0.274011374f, 0.374400049f},
-std::array<float,2>{0.46918866f, 0.961477101f},
-std::array<float,2>{0.726766109f, 0.431314766f},
-std::array<float,2>{0.766120374f, 0.663899362f},
-std::array<float,2>{0.167378888f, 0.163098544f},
-std::array<float,2>{0.383788615f, 0.547129929f},
-std::array<float,2>{0.675101817f, 0.0582695827f},
-std::array<float,2>{0.835172594f, 0.798990548f},
-std::array<float,2>{0.238534614f, 0.291986853f},
-std::array<float,2>{0.00957407802f, 0.908921063f},
-std::array<float,2>{0.984682798f, 0.459748477f},
-std::array<float,2>{0.525469065f, 0.703962028f},
-std::array<float,2>{0.347955406f, 0.229568869f},
-std::array<float,2>{0.142619222f, 0.651917458f},
-std::array<float,2>{0.797348559f, 0.151024938f},
-std::array<float,2>{0.6997177f, 0.972483456f},
-std::array<float,2>{0.444112241f, 0.404555112f},
-std::array<float,2>{0.303335547f, 0.87135762f},
-std::array<float,2>{0.597374916f, 0.314423829f},
-std::array<float,2>{0.895242751f, 0.5699839f},
-std::array<float,2>{0.094857052f, 0.0870935172f},
-std::array<float,2>{0.263646603f, 0.580348492f},
-std::array<float,2>{0.566525102f, 0.074773021f},
-std::array<float,2>{0.910583198f, 0.85779047f},
-std::array<float,2>{0.0713457912f, 0.337464869f},
-std::array<float,2>{0.173852265f, 0.989877105f},
-std::array<float,2>{0.750171244f, 0.377650589f},
-std::array<float,2>{0.735150695f, 0.639244854f},
-std::array<float,2>{0.494316489f, 0.137067229f},
-std::array<float,2>{0.0436265767f, 0.690500259f},
-std::array<float,2>{0.964513361f, 0.234995335f},
-std::array<float,2>{0.548478961f, 0.934958458f},
-std::array<float,2>{0.340620011f, 0.451316029f},
-std::array<float,2>{0.43724823f, 0.783310294f},
-std::array<float,2>{0.652133465f, 0.303879678f},
-std::array<float,2>{0.872440636f, 0.531653762f},
-std::array<float,2>{0.196833804f, 0.0406829938f},
-std::array<float,2>{0.456303954f, 0.678560674f},
-std::array<float,2>{0.703175366f, 0.174738646f},
-std::array<float,2>{0.784485519f, 0.942632616f},
-std::array<float,2>{0.126555249f, 0.41399318f},
-std::array<float,2>{0.111485392f, 0.824563444f},
-std::array<float,2>{0.89039886f, 0.359213591f},
-std::array<float,2>{0.624147117f, 0.612047851f},
-std::array<float,2>{0.283040166f, 0.124900348f},
-std::array<float,2>{0.224753737f, 0.50971663f},
-std::array<float,2>{0.81655997f, 0.0290425159f},
-std::array<float,2>{0.658391416f, 0.750048339f},
-std::array<float,2>{0.403870285f, 0.269120872f},
-std::array<float,2>{0.367721915f, 0.901905835f},
-std::array<float,2>{0.511335433f, 0.473597437f},
-std::array<float,2>{0.972961187f, 0.73115468f},
-std::array<float,2>{0.0191750787f, 0.211666971f},
-std::array<float,2>{0.290414244f, 0.628499031f},
-std::array<float,2>{0.610425949f, 0.128622785f},
-std::array<float,2>{0.877953291f, 0.993615627f},
-std::array<float,2>{0.123543404f, 0.387295425f},
-std::array<float,2>{0.13879779f, 0.848395586f},
-std::array<float,2>{0.79456234f, 0.333529115f},
-std::array<float,2>{0.717299879f, 0.591503799f},
-std::array<float,2>{0.467580587f, 0.0635815859f},
-std::array<float,2>{0.0287860334f, 0.543318391f},
-std::array<float,2>{0.98061192f, 0.03130804f},
-std::array<float,2>{0.501155853f, 0.789523661f},
-std::array<float,2>{0.36604473f, 0.311987549f},
-std::array<float,2>{0.39707911f, 0.926193655f},
-std::array<float,2>{0.664655626f, 0.443357229f},
-std::array<float,2>{0.827318013f, 0.700881243f},
-std::array<float,2>{0.233849883f, 0.242305204f},
-std::array<float,2>{0.489063829f, 0.618688464f},
-std::array<float,2>{0.748160779f, 0.111627959f},
-std::array<float,2>{0.762744784f, 0.817003787f},
-std::array<float,2>{0.187357917f, 0.351309299f},
-std::array<float,2>{0.064175494f, 0.94701457f},
-std::array<float,2>{0.919184983f, 0.41632238f},
-std::array<float,2>{0.572278976f, 0.68503654f},
-std::array<float,2>{0.25487718f, 0.184460938f},
-std::array<float,2>{0.19169721f, 0.720751524f},
-std::array<float,2>{0.862078667f, 0.205591902f},
-std::array<float,2>{0.643770337f, 0.895159125f},
-std::array<float,2>{0.422909647f, 0.477230191f},
-std::array<float,2>{0.331095994f, 0.764804006f},
-std::array<float,2>{0.562452734f, 0.275559276f},
-std::array<float,2>{0.955846906f, 0.504430115f},
-std::array<float,2>{0.0390441827f, 0.0199265163f},
-std::array<float,2>{0.358737648f, 0.52120322f},
-std::array<float,2>{0.515740573f, 0.0123988874f},
-std::array<float,2>{0.997398019f, 0.772547126f},
-std::array<float,2>{1.94352779e-05f, 0.262737006f},
-std::array<float,2>{0.244179785f, 0.883901238f},
-std::array<float,2>{0.842902362f, 0.486203969f},
-std::array<float,2>{0.680105746f, 0.746947527f},
-std::array<float,2>{0.382686973f, 0.197312638f},
-std::array<float,2>{0.10378404f, 0.670530975f},
-std::array<float,2>{0.899882615f, 0.169442371f},
-std::array<float,2>{0.603659809f, 0.957434595f},
-std::array<float,2>{0.305599809f, 0.425659865f},
-std::array<float,2>{0.446625739f, 0.841843426f},
-std::array<float,2>{0.691753864f, 0.360422581f},
-std::array<float,2>{0.811788201f, 0.605788827f},
-std::array<float,2>{0.154970348f, 0.105306163f},
-std::array<float,2>{0.413158f, 0.715100527f},
-std::array<float,2>{0.638227463f, 0.224747524f},
-std::array<float,2>{0.855589211f, 0.921383798f},
-std::array<float,2>{0.20894666f, 0.461611181f},
-std::array<float,2>{0.0581532381f, 0.812175691f},
-std::array<float,2>{0.952794909f, 0.288448155f},
-std::array<float,2>{0.536570132f, 0.556663632f},
-std::array<float,2>{0.324874997f, 0.0508913212f},
-std::array<float,2>{0.158048183f, 0.576414526f},
-std::array<float,2>{0.776701033f, 0.0792394727f},
-std::array<float,2>{0.725212395f, 0.86701566f},
-std::array<float,2>{0.481664717f, 0.32594806f},
-std::array<float,2>{0.267411143f, 0.981333315f},
-std::array<float,2>{0.581135273f, 0.390986413f},
-std::array<float,2>{0.930481791f, 0.646484554f},
-std::array<float,2>{0.0891336203f, 0.145806149f},
-std::array<float,2>{0.279364854f, 0.698383391f},
-std::array<float,2>{0.592846215f, 0.249615595f},
-std::array<float,2>{0.926455617f, 0.923777997f},
-std::array<float,2>{0.0785562694f, 0.438293189f},
-std::array<float,2>{0.17003724f, 0.793522f},
-std::array<float,2>{0.77115798f, 0.3068977f},
-std::array<float,2>{0.732367814f, 0.54272002f},
-std::array<float,2>{0.474218607f, 0.0381963179f},
-std::array<float,2>{0.0541621149f, 0.586455822f},
-std::array<float,2>{0.944704592f, 0.0670893192f},
-std::array<float,2>{0.540516198f, 0.844057262f},
-std::array<float,2>{0.315798461f, 0.328520119f},
-std::array<float,2>{0.417091429f, 0.996525645f},
-std::array<float,2>{0.630862117f, 0.384923518f},
-std::array<float,2>{0.848122835f, 0.632667243f},
-std::array<float,2>{0.2113415f, 0.131546825f},
-std::array<float,2>{0.439019829f, 0.500322878f},
-std::array<float,2>{0.699178457f, 0.0160851087f},
-std::array<float,2>{0.802758396f, 0.758764565f},
-std::array<float,2>{0.147398338f, 0.280555218f},
-std::array<float,2>{0.0997580141f, 0.890857577f},
-std::array<float,2>{0.890932322f, 0.480805784f},
-std::array<float,2>{0.599544108f, 0.72360307f},
-std::array<float,2>{0.29838264f, 0.210270554f},
-std::array<float,2>{0.237636417f, 0.681435585f},
-std::array<float,2>{0.830365539f, 0.183198571f},
-std::array<float,2>{0.678378761f, 0.952278495f},
-std::array<float,2>{0.386978f, 0.419934869f},
-std::array<float,2>{0.344222546f, 0.816313028f},
-std::array<float,2>{0.530528307f, 0.346707255f},
-std::array<float,2>{0.991614759f, 0.624234617f},
-std::array<float,2>{0.0133415144f, 0.115547396f},
-std::array<float,2>{0.33896482f, 0.603467941f},
-std::array<float,2>{0.551684618f, 0.10749995f},
-std::array<float,2>{0.967694879f, 0.837310612f},
-std::array<float,2>{0.0399049893f, 0.366315782f},
-std::array<float,2>{0.201524287f, 0.955980659f},
-std::array<float,2>{0.868369281f, 0.429106712f},
-std::array<float,2>{0.656113267f, 0.665155768f},
-std::array<float,2>{0.431445688f, 0.165615484f},
-std::array<float,2>{0.075348042f, 0.74414438f},
-std::array<float,2>{0.907629073f, 0.202825412f},
-std::array<float,2>{0.562682509f, 0.888793409f},
-std::array<float,2>{0.261443526f, 0.488934726f},
-std::array<float,2>{0.498758346f, 0.766572475f},
-std::array<float,2>{0.738775671f, 0.260716617f},
-std::array<float,2>{0.754694998f, 0.517358422f},
-std::array<float,2>{0.177438438f, 0.00912488066f},
-std::array<float,2>{0.401768088f, 0.641318142f},
-std::array<float,2>{0.661476076f, 0.141601622f},
-std::array<float,2>{0.813356638f, 0.979804933f},
-std::array<float,2>{0.220274642f, 0.398192376f},
-std::array<float,2>{0.0213072766f, 0.861563325f},
-std::array<float,2>{0.969191015f, 0.322244912f},
-std::array<float,2>{0.51474297f, 0.57147944f},
-std::array<float,2>{0.374377251f, 0.0842304006f},
-std::array<float,2>{0.129552841f, 0.559004366f},
-std::array<float,2>{0.787047625f, 0.0496940948f},
-std::array<float,2>{0.707442045f, 0.804744601f},
-std::array<float,2>{0.458874971f, 0.283083916f},
-std::array<float,2>{0.288904548f, 0.914498806f},
-std::array<float,2>{0.621053457f, 0.468583882f},
-std::array<float,2>{0.884824932f, 0.711717129f},
-std::array<float,2>{0.113924257f, 0.219057724f},
-std::array<float,2>{0.359479427f, 0.659604251f},
-std::array<float,2>{0.50568217f, 0.159162685f},
-std::array<float,2>{0.97767818f, 0.966085255f},
-std::array<float,2>{0.0262827557f, 0.434657067f},
-std::array<float,2>{0.227004364f, 0.833030581f},
-std::array<float,2>{0.821326852f, 0.370040596f},
-std::array<float,2>{0.671557009f, 0.600519478f},
-std::array<float,2>{0.393784612f, 0.0942754969f},
-std::array<float,2>{0.118645422f, 0.527747393f},
-std::array<float,2>{0.879777849f, 0.00160234526f},
-std::array<float,2>{0.615673721f, 0.774836659f},
-std::array<float,2>{0.29603371f, 0.254004449f},
-std::array<float,2>{0.461905658f, 0.88150239f},
-std::array<float,2>{0.712061286f, 0.492542356f},
-std::array<float,2>{0.790090978f, 0.74109453f},
-std::array<float,2>{0.135958135f, 0.19208084f},
-std::array<float,2>{0.4277744f, 0.565215349f},
-std::array<float,2>{0.645914555f, 0.0909376368f},
-std::array<float,2>{0.863405943f, 0.868446052f},
-std::array<float,2>{0.187547162f, 0.319631517f},
-std::array<float,2>{0.0321326107f, 0.974726558f},
-std::array<float,2>{0.95750469f, 0.401903033f},
-std::array<float,2>{0.554941535f, 0.655362606f},
-std::array<float,2>{0.335249424f, 0.153079093f},
-std::array<float,2>{0.180562556f, 0.710254133f},
-std::array<float,2>{0.761263132f, 0.230969757f},
-std::array<float,2>{0.744190395f, 0.910600364f},
-std::array<float,2>{0.485580385f, 0.453555673f},
-std::array<float,2>{0.250038743f, 0.804447055f},
-std::array<float,2>{0.577278197f, 0.294663608f},
-std::array<float,2>{0.916094184f, 0.553458035f},
-std::array<float,2>{0.0693174601f, 0.0608104318f},
-std::array<float,2>{0.308975577f, 0.537011206f},
-std::array<float,2>{0.606540918f, 0.0430971384f},
-std::array<float,2>{0.904122055f, 0.786082685f},
-std::array<float,2>{0.106912382f, 0.300165802f},
-std::array<float,2>{0.15103364f, 0.932875276f},
-std::array<float,2>{0.805727065f, 0.445810288f},
-std::array<float,2>{0.68958497f, 0.694160819f},
-std::array<float,2>{0.45146212f, 0.241308808f},
-std::array<float,2>{0.00665382436f, 0.633651376f},
-std::array<float,2>{0.992193878f, 0.136387229f},
-std::array<float,2>{0.520408988f, 0.985177636f},
-std::array<float,2>{0.355365098f, 0.379322857f},
-std::array<float,2>{0.378622323f, 0.854534149f},
-std::array<float,2>{0.68402487f, 0.341834575f},
-std::array<float,2>{0.839029968f, 0.58305645f},
-std::array<float,2>{0.249809608f, 0.0724528655f},
-std::array<float,2>{0.478692114f, 0.730084896f},
-std::array<float,2>{0.720670938f, 0.215251029f},
-std::array<float,2>{0.779846132f, 0.90482235f},
-std::array<float,2>{0.162139177f, 0.470733404f},
-std::array<float,2>{0.0934259892f, 0.756825149f},
-std::array<float,2>{0.934005737f, 0.270184815f},
-std::array<float,2>{0.582071066f, 0.514395237f},
-std::array<float,2>{0.270809442f, 0.0238612369f},
-std::array<float,2>{0.204006061f, 0.616218925f},
-std::array<float,2>{0.852947772f, 0.119319282f},
-std::array<float,2>{0.636656046f, 0.820561469f},
-std::array<float,2>{0.408913851f, 0.354708225f},
-std::array<float,2>{0.323239744f, 0.941194534f},
-std::array<float,2>{0.53509438f, 0.410151809f},
-std::array<float,2>{0.946923018f, 0.675305128f},
-std::array<float,2>{0.0591693148f, 0.177759141f},
-std::array<float,2>{0.351132154f, 0.706231296f},
-std::array<float,2>{0.524746597f, 0.227976143f},
-std::array<float,2>{0.988240421f, 0.908126891f},
-std::array<float,2>{0.0103965551f, 0.458527386f},
-std::array<float,2>{0.241043612f, 0.798172891f},
-std::array<float,2>{0.833954275f, 0.289676428f},
-std::array<float,2>{0.673111796f, 0.54940033f},
-std::array<float,2>{0.386061072f, 0.0553768799f},
-std::array<float,2>{0.096843347f, 0.567249537f},
-std::array<float,2>{0.896915615f, 0.0897604451f},
-std::array<float,2>{0.594729543f, 0.873119056f},
-std::array<float,2>{0.302389562f, 0.315755814f},
-std::array<float,2>{0.44247371f, 0.969898939f},
-std::array<float,2>{0.701651216f, 0.403691411f},
-std::array<float,2>{0.79949379f, 0.649615407f},
-std::array<float,2>{0.142534673f, 0.149123654f},
-std::array<float,2>{0.420098335f, 0.526229143f},
-std::array<float,2>{0.627442718f, 0.00476755388f},
-std::array<float,2>{0.847562671f, 0.77744168f},
-std::array<float,2>{0.217520833f, 0.253455102f},
-std::array<float,2>{0.0500340424f, 0.875497401f},
-std::array<float,2>{0.93912214f, 0.497038692f},
-std::array<float,2>{0.54602915f, 0.734707832f},
-std::array<float,2>{0.319713116f, 0.189832911f},
-std::array<float,2>{0.165853813f, 0.661414564f},
-std::array<float,2>{0.768413305f, 0.161658868f},
-std::array<float,2>{0.729187906f, 0.964695752f},
-std::array<float,2>{0.471217513f, 0.432303101f},
-std::array<float,2>{0.276527226f, 0.83020395f},
-std::array<float,2>{0.589059651f, 0.372303605f},
-std::array<float,2>{0.924102128f, 0.597547412f},
-std::array<float,2>{0.0838207901f, 0.100307152f},
-std::array<float,2>{0.283371717f, 0.610742331f},
-std::array<float,2>{0.621249735f, 0.122412629f},
-std::array<float,2>{0.887551546f, 0.827900887f},
-std::array<float,2>{0.109819017f, 0.35610202f},
-std::array<float,2>{0.127044052f, 0.944718122f},
-std::array<float,2>{0.781552792f, 0.410882264f},
-std::array<float,2>{0.705479383f, 0.676774263f},
-std::array<float,2>{0.453766584f, 0.172723189f},
-std::array<float,2>{0.0160607826f, 0.73433274f},
-std::array<float,2>{0.97616744f, 0.21386227f},
-std::array<float,2>{0.5083341f, 0.899164319f},
-std::array<float,2>{0.369903564f, 0.475836366f},
-std::array<float,2>{0.404840142f, 0.753555536f},
-std::array<float,2>{0.65794313f, 0.267049819f},
-std::array<float,2>{0.818668842f, 0.51117456f},
-std::array<float,2>{0.223188102f, 0.0311543029f},
-std::array<float,2>{0.493502021f, 0.637448668f},
-std::array<float,2>{0.736360371f, 0.139343023f},
-std::array<float,2>{0.753653884f, 0.991370201f},
-std::array<float,2>{0.17319496f, 0.376908123f},
-std::array<float,2>{0.0733898953f, 0.856333613f},
-std::array<float,2>{0.912348151f, 0.339779407f},
-std::array<float,2>{0.568720281f, 0.579447865f},
-std::array<float,2>{0.263948053f, 0.0772083029f},
-std::array<float,2>{0.197569668f, 0.534634173f},
-std::array<float,2>{0.874947667f, 0.0420508124f},
-std::array<float,2>{0.648562551f, 0.782144785f},
-std::array<float,2>{0.433851749f, 0.301336944f},
-std::array<float,2>{0.341942489f, 0.936234355f},
-std::array<float,2>{0.548858762f, 0.450040609f},
-std::array<float,2>{0.96267724f, 0.689392865f},
-std::array<float,2>{0.0456259921f, 0.237090766f},
-std::array<float,2>{0.256137371f, 0.685676992f},
-std::array<float,2>{0.572245479f, 0.185847089f},
-std::array<float,2>{0.920069277f, 0.948120773f},
-std::array<float,2>{0.0648379475f, 0.414700359f},
-std::array<float,2>{0.185200542f, 0.819739044f},
-std::array<float,2>{0.765589654f, 0.348371923f},
-std::array<float,2>{0.746104658f, 0.6192711f},
-std::array<float,2>{0.49181363f, 0.110284984f},
-std::array<float,2>{0.0369023159f, 0.506584764f},
-std::array<float,2>{0.95424217f, 0.023022633f},
-std::array<float,2>{0.558912456f, 0.763501465f},
-std::array<float,2>{0.328218281f, 0.274203479f},
-std::array<float,2>{0.424782246f, 0.897006273f},
-std::array<float,2>{0.641983151f, 0.480030239f},
-std::array<float,2>{0.860103488f, 0.720490456f},
-std::array<float,2>{0.194257975f, 0.203895211f},
-std::array<float,2>{0.465021342f, 0.592958868f},
-std::array<float,2>{0.715348542f, 0.0648063719f},
-std::array<float,2>{0.79591614f, 0.849975109f},
-std::array<float,2>{0.137095705f, 0.334314555f},
-std::array<float,2>{0.121468604f, 0.994947433f},
-std::array<float,2>{0.876826227f, 0.389083177f},
-std::array<float,2>{0.611632228f, 0.625928998f},
-std::array<float,2>{0.291682661f, 0.125683725f},
-std::array<float,2>{0.231207237f, 0.703028083f},
-std::array<float,2>{0.825940609f, 0.24479413f},
-std::array<float,2>{0.666494608f, 0.928050041f},
-std::array<float,2>{0.395944029f, 0.444764286f},
-std::array<float,2>{0.365211487f, 0.791235983f},
-std::array<float,2>{0.50300175f, 0.310188681f},
-std::array<float,2>{0.983172774f, 0.546635151f},
-std::array<float,2>{0.0310563222f, 0.0334554873f},
-std::array<float,2>{0.327573031f, 0.555615485f},
-std::array<float,2>{0.537205696f, 0.0536257662f},
-std::array<float,2>{0.950271308f, 0.809249759f},
-std::array<float,2>{0.0554138981f, 0.286212683f},
-std::array<float,2>{0.210336924f, 0.918123364f},
-std::array<float,2>{0.858035684f, 0.464609712f},
-std::array<float,2>{0.64032501f, 0.717352748f},
-std::array<float,2>{0.41017285f, 0.223806873f},
-std::array<float,2>{0.0863532498f, 0.644760847f},
-std::array<float,2>{0.932443857f, 0.147036687f},
-std::array<float,2>{0.579565942f, 0.98262471f},
-std::array<float,2>{0.269385964f, 0.393139094f},
-std::array<float,2>{0.482948869f, 0.864946663f},
-std::array<float,2>{0.723158181f, 0.326714277f},
-std::array<float,2>{0.774940968f, 0.575507939f},
-std::array<float,2>{0.160123169f, 0.0811992958f},
-std::array<float,2>{0.379272074f, 0.748354495f},
-std::array<float,2>{0.682746887f, 0.196546912f},
-std::array<float,2>{0.840345681f, 0.885115981f},
-std::array<float,2>{0.243980512f, 0.488061696f},
-std::array<float,2>{0.0034152898f, 0.770606339f},
-std::array<float,2>{0.998447657f, 0.263887346f},
-std::array<float,2>{0.519261301f, 0.522649586f},
-std::array<float,2>{0.35659495f, 0.0151582891f},
-std::array<float,2>{0.1523958f, 0.607697904f},
-std::array<float,2>{0.809193134f, 0.101818129f},
-std::array<float,2>{0.695296288f, 0.840441942f},
-std::array<float,2>{0.447622955f, 0.361911982f},
-std::array<float,2>{0.308408082f, 0.959848404f},
-std::array<float,2>{0.603291869f, 0.422460765f},
-std::array<float,2>{0.901110411f, 0.668641031f},
-std::array<float,2>{0.102109112f, 0.170200169f},
-std::array<float,2>{0.299706608f, 0.724727631f},
-std::array<float,2>{0.599953294f, 0.208636343f},
-std::array<float,2>{0.893841565f, 0.894051194f},
-std::array<float,2>{0.0990529284f, 0.482741535f},
-std::array<float,2>{0.145514742f, 0.761008024f},
-std::array<float,2>{0.80081898f, 0.279108763f},
-std::array<float,2>{0.696385622f, 0.502454162f},
-std::array<float,2>{0.439615905f, 0.0192111246f},
-std::array<float,2>{0.0151783498f, 0.621963084f},
-std::array<float,2>{0.989007354f, 0.113872573f},
-std::array<float,2>{0.528301656f, 0.814061522f},
-std::array<float,2>{0.346401989f, 0.345318556f},
-std::array<float,2>{0.390263051f, 0.951111495f},
-std::array<float,2>{0.67741406f, 0.41808784f},
-std::array<float,2>{0.828262746f, 0.682652712f},
-std::array<float,2>{0.235885397f, 0.181271061f},
-std::array<float,2>{0.476222157f, 0.540939987f},
-std::array<float,2>{0.73261112f, 0.0368373282f},
-std::array<float,2>{0.7721017f, 0.79671824f},
-std::array<float,2>{0.169368088f, 0.305032045f},
-std::array<float,2>{0.081756115f, 0.923944354f},
-std::array<float,2>{0.929039657f, 0.440763533f},
-std::array<float,2>{0.591690123f, 0.697169125f},
-std::array<float,2>{0.278353959f, 0.24718596f},
-std::array<float,2>{0.21396938f, 0.630603433f},
-std::array<float,2>{0.850206614f, 0.129431397f},
-std::array<float,2>{0.630504727f, 0.99860394f},
-std::array<float,2>{0.414437503f, 0.383447468f},
-std::array<float,2>{0.31297341f, 0.847108066f},
-std::array<float,2>{0.542158306f, 0.331855744f},
-std::array<float,2>{0.943061292f, 0.589547634f},
-std::array<float,2>{0.0509068966f, 0.0702290311f},
-std::array<float,2>{0.371479899f, 0.573095739f},
-std::array<float,2>{0.512997448f, 0.0830868483f},
-std::array<float,2>{0.970898151f, 0.859905422f},
-std::array<float,2>{0.0215577688f, 0.322383761f},
-std::array<float,2>{0.222105682f, 0.977383077f},
-std::array<float,2>{0.815159798f, 0.394658357f},
-std::array<float,2>{0.662977993f, 0.643101513f},
-std::array<float,2>{0.399730891f, 0.142950788f},
-std::array<float,2>{0.115836151f, 0.714393437f},
-std::array<float,2>{0.884025753f, 0.221891165f},
-std::array<float,2>{0.617895603f, 0.916368067f},
-std::array<float,2>{0.28665778f, 0.465762705f},
-std::array<float,2>{0.459124893f, 0.80841434f},
-std::array<float,2>{0.710610867f, 0.283394605f},
-std::array<float,2>{0.788065493f, 0.561921716f},
-std::array<float,2>{0.131748453f, 0.0475293733f},
-std::array<float,2>{0.432711512f, 0.666960895f},
-std::array<float,2>{0.653682351f, 0.167346671f},
-std::array<float,2>{0.869383454f, 0.954612732f},
-std::array<float,2>{0.201077878f, 0.426918119f},
-std::array<float,2>{0.0426851213f, 0.838654876f},
-std::array<float,2>{0.965384424f, 0.364700079f},
-std::array<float,2>{0.553751171f, 0.604985595f},
-std::array<float,2>{0.336223453f, 0.106858544f},
-std::array<float,2>{0.179417878f, 0.518898487f},
-std::array<float,2>{0.757786334f, 0.0100416904f},
-std::array<float,2>{0.741282403f, 0.768577397f},
-std::array<float,2>{0.496890932f, 0.257867098f},
-std::array<float,2>{0.258636326f, 0.888498366f},
-std::array<float,2>{0.565256536f, 0.490841836f},
-std::array<float,2>{0.909513593f, 0.74339062f},
-std::array<float,2>{0.0766663477f, 0.200081021f},
-std::array<float,2>{0.333666593f, 0.653515041f},
-std::array<float,2>{0.558336496f, 0.156197324f},
-std::array<float,2>{0.96082592f, 0.973151267f},
-std::array<float,2>{0.0337875262f, 0.39902243f},
-std::array<float,2>{0.189995304f, 0.869358301f},
-std::array<float,2>{0.865636587f, 0.317874253f},
-std::array<float,2>{0.648370504f, 0.562823057f},
-std::array<float,2>{0.427218497f, 0.0923381969f},
-std::array<float,2>{0.0679651499f, 0.551330626f},
-std::array<float,2>{0.915705323f, 0.0595974848f},
-std::array<float,2>{0.575982869f, 0.802478373f},
-std::array<float,2>{0.252596915f, 0.296772569f},
-std::array<float,2>{0.486747205f, 0.912285209f},
-std::array<float,2>{0.743411303f, 0.456968784f},
-std::array<float,2>{0.757943392f, 0.708818197f},
-std::array<float,2>{0.183222547f, 0.232844383f},
-std::array<float,2>{0.390926063f, 0.597799122f},
-std::array<float,2>{0.669527352f, 0.0965730175f},
-std::array<float,2>{0.822733998f, 0.834744632f},
-std::array<float,2>{0.229101211f, 0.367257684f},
-std::array<float,2>{0.0237244908f, 0.967734218f},
-std::array<float,2>{0.980185688f, 0.435578763f},
-std::array<float,2>{0.506080866f, 0.65729332f},
-std::array<float,2>{0.362275392f, 0.157482386f},
-std::array<float,2>{0.134203941f, 0.739238799f},
-std::array<float,2>{0.791317701f, 0.195027739f},
-std::array<float,2>{0.71419996f, 0.880340457f},
-std::array<float,2>{0.464227974f, 0.495477229f},
-std::array<float,2>{0.29428494f, 0.775809288f},
-std::array<float,2>{0.615123928f, 0.256967783f},
-std::array<float,2>{0.88106966f, 0.529869974f},
-std::array<float,2>{0.120895803f, 0.00271166931f},
-std::array<float,2>{0.271681637f, 0.512778401f},
-std::array<float,2>{0.584709167f, 0.0265398379f},
-std::array<float,2>{0.93708235f, 0.755528748f},
-std::array<float,2>{0.0904058293f, 0.272540122f},
-std::array<float,2>{0.161067903f, 0.903011203f},
-std::array<float,2>{0.778664172f, 0.469900191f},
-std::array<float,2>{0.721599102f, 0.727218568f},
-std::array<float,2>{0.47821793f, 0.217254832f},
-std::array<float,2>{0.0624466389f, 0.672951102f},
-std::array<float,2>{0.949184954f, 0.176851124f},
-std::array<float,2>{0.531781197f, 0.93879348f},
-std::array<float,2>{0.321300477f, 0.406330317f},
-std::array<float,2>{0.407375664f, 0.824164689f},
-std::array<float,2>{0.633122325f, 0.35170123f},
-std::array<float,2>{0.854698479f, 0.613466382f},
-std::array<float,2>{0.205132946f, 0.117377378f},
-std::array<float,2>{0.450393468f, 0.692722261f},
-std::array<float,2>{0.688947856f, 0.23940666f},
-std::array<float,2>{0.807480335f, 0.930586755f},
-std::array<float,2>{0.148702502f, 0.44835043f},
-std::array<float,2>{0.107988179f, 0.787350118f},
-std::array<float,2>{0.905702829f, 0.298652053f},
-std::array<float,2>{0.60925132f, 0.53770107f},
-std::array<float,2>{0.311044633f, 0.0456384718f},
-std::array<float,2>{0.246936306f, 0.584160924f},
-std::array<float,2>{0.835943162f, 0.0709174797f},
-std::array<float,2>{0.686960578f, 0.852711201f},
-std::array<float,2>{0.376182586f, 0.341278255f},
-std::array<float,2>{0.352323681f, 0.98816222f},
-std::array<float,2>{0.521877527f, 0.381133795f},
-std::array<float,2>{0.99521172f, 0.636437774f},
-std::array<float,2>{0.00397755019f, 0.133957744f}}
\ No newline at end of file
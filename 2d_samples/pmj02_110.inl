@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.41382429f, 0.372624844f},
-std::array<float,2>{0.570902407f, 0.709203124f},
-std::array<float,2>{0.22089465f, 0.796715975f},
-std::array<float,2>{0.998475492f, 0.218673542f},
-std::array<float,2>{0.122253999f, 0.0119730895f},
-std::array<float,2>{0.842442632f, 0.898776054f},
-std::array<float,2>{0.293477565f, 0.540148616f},
-std::array<float,2>{0.676686525f, 0.375484735f},
-std::array<float,2>{0.321885467f, 0.184881434f},
-std::array<float,2>{0.740811646f, 0.836632192f},
-std::array<float,2>{0.0283261668f, 0.628867507f},
-std::array<float,2>{0.790558338f, 0.263883084f},
-std::array<float,2>{0.134092033f, 0.445033103f},
-std::array<float,2>{0.894515157f, 0.588218629f},
-std::array<float,2>{0.496543199f, 0.992620766f},
-std::array<float,2>{0.530970812f, 0.0668921471f},
-std::array<float,2>{0.276248604f, 0.423399359f},
-std::array<float,2>{0.653860748f, 0.524778426f},
-std::array<float,2>{0.0779618025f, 0.934805989f},
-std::array<float,2>{0.847940505f, 0.059458442f},
-std::array<float,2>{0.191320911f, 0.222124472f},
-std::array<float,2>{0.94716537f, 0.75230974f},
-std::array<float,2>{0.402965516f, 0.730950475f},
-std::array<float,2>{0.602883697f, 0.337883502f},
-std::array<float,2>{0.44338268f, 0.109259285f},
-std::array<float,2>{0.541038871f, 0.960291564f},
-std::array<float,2>{0.159613281f, 0.61944437f},
-std::array<float,2>{0.930080771f, 0.497995824f},
-std::array<float,2>{0.0598156899f, 0.288406909f},
-std::array<float,2>{0.762685299f, 0.673795342f},
-std::array<float,2>{0.356147975f, 0.848899841f},
-std::array<float,2>{0.700938642f, 0.138187587f},
-std::array<float,2>{0.480583221f, 0.47005868f},
-std::array<float,2>{0.503926754f, 0.598380744f},
-std::array<float,2>{0.141888991f, 0.945639789f},
-std::array<float,2>{0.88352716f, 0.119834371f},
-std::array<float,2>{0.00982837193f, 0.154482171f},
-std::array<float,2>{0.802373827f, 0.863699138f},
-std::array<float,2>{0.332444847f, 0.668158412f},
-std::array<float,2>{0.731406689f, 0.304830819f},
-std::array<float,2>{0.310494065f, 0.0361293554f},
-std::array<float,2>{0.663258255f, 0.919085443f},
-std::array<float,2>{0.0954772681f, 0.508819818f},
-std::array<float,2>{0.820289373f, 0.414305598f},
-std::array<float,2>{0.239796415f, 0.327122569f},
-std::array<float,2>{0.982022285f, 0.73912555f},
-std::array<float,2>{0.42940551f, 0.780237377f},
-std::array<float,2>{0.587968588f, 0.234673068f},
-std::array<float,2>{0.366618365f, 0.269702733f},
-std::array<float,2>{0.717908978f, 0.653150141f},
-std::array<float,2>{0.041233439f, 0.824255526f},
-std::array<float,2>{0.776988089f, 0.166171238f},
-std::array<float,2>{0.184585467f, 0.0786520019f},
-std::array<float,2>{0.919966936f, 0.970039725f},
-std::array<float,2>{0.461337388f, 0.571112573f},
-std::array<float,2>{0.560114622f, 0.460243195f},
-std::array<float,2>{0.386307299f, 0.197036043f},
-std::array<float,2>{0.616647303f, 0.807995021f},
-std::array<float,2>{0.216076076f, 0.689724326f},
-std::array<float,2>{0.968375921f, 0.355509251f},
-std::array<float,2>{0.0933492109f, 0.391530305f},
-std::array<float,2>{0.866990089f, 0.551336586f},
-std::array<float,2>{0.250877857f, 0.890075505f},
-std::array<float,2>{0.639227986f, 0.0226660836f},
-std::array<float,2>{0.460414559f, 0.300900757f},
-std::array<float,2>{0.547380149f, 0.659100115f},
-std::array<float,2>{0.174638763f, 0.868165433f},
-std::array<float,2>{0.910061538f, 0.145300731f},
-std::array<float,2>{0.0353684947f, 0.115503274f},
-std::array<float,2>{0.769227743f, 0.937836945f},
-std::array<float,2>{0.367239803f, 0.607408762f},
-std::array<float,2>{0.706570387f, 0.483276308f},
-std::array<float,2>{0.265083432f, 0.24427034f},
-std::array<float,2>{0.62921077f, 0.771259904f},
-std::array<float,2>{0.0803852305f, 0.742192924f},
-std::array<float,2>{0.867814243f, 0.314777195f},
-std::array<float,2>{0.208963856f, 0.406696409f},
-std::array<float,2>{0.95709157f, 0.500938416f},
-std::array<float,2>{0.376050085f, 0.907516718f},
-std::array<float,2>{0.620448053f, 0.0397753902f},
-std::array<float,2>{0.338404357f, 0.463506609f},
-std::array<float,2>{0.719462931f, 0.570249319f},
-std::array<float,2>{0.00303615583f, 0.980047762f},
-std::array<float,2>{0.806326866f, 0.0889775231f},
-std::array<float,2>{0.15233165f, 0.162659168f},
-std::array<float,2>{0.881746292f, 0.814669788f},
-std::array<float,2>{0.47207877f, 0.64819169f},
-std::array<float,2>{0.509160578f, 0.275619328f},
-std::array<float,2>{0.435737133f, 0.0240741037f},
-std::array<float,2>{0.583938599f, 0.878419638f},
-std::array<float,2>{0.247841731f, 0.560290813f},
-std::array<float,2>{0.971962154f, 0.400314629f},
-std::array<float,2>{0.104828767f, 0.343890011f},
-std::array<float,2>{0.828124166f, 0.700782895f},
-std::array<float,2>{0.302225947f, 0.802698672f},
-std::array<float,2>{0.666158736f, 0.188638866f},
-std::array<float,2>{0.390822887f, 0.387233645f},
-std::array<float,2>{0.594614804f, 0.531316638f},
-std::array<float,2>{0.199666679f, 0.895816565f},
-std::array<float,2>{0.937956989f, 0.00269265287f},
-std::array<float,2>{0.0629347116f, 0.208383322f},
-std::array<float,2>{0.853533506f, 0.787915647f},
-std::array<float,2>{0.266752899f, 0.714827895f},
-std::array<float,2>{0.648353457f, 0.363996238f},
-std::array<float,2>{0.346770406f, 0.0750162229f},
-std::array<float,2>{0.692602992f, 0.985780656f},
-std::array<float,2>{0.0518779755f, 0.584378183f},
-std::array<float,2>{0.755224168f, 0.451154798f},
-std::array<float,2>{0.168656752f, 0.251392752f},
-std::array<float,2>{0.9224509f, 0.633064568f},
-std::array<float,2>{0.452896237f, 0.833718657f},
-std::array<float,2>{0.533185482f, 0.179316789f},
-std::array<float,2>{0.287090212f, 0.331330091f},
-std::array<float,2>{0.679949403f, 0.722019374f},
-std::array<float,2>{0.113823347f, 0.761467636f},
-std::array<float,2>{0.82824111f, 0.228103012f},
-std::array<float,2>{0.227065206f, 0.0499906279f},
-std::array<float,2>{0.990974069f, 0.929320574f},
-std::array<float,2>{0.415986747f, 0.515969872f},
-std::array<float,2>{0.568799078f, 0.430378854f},
-std::array<float,2>{0.486901611f, 0.128748417f},
-std::array<float,2>{0.51861155f, 0.854816794f},
-std::array<float,2>{0.126146287f, 0.686602771f},
-std::array<float,2>{0.900733829f, 0.2944749f},
-std::array<float,2>{0.0224708468f, 0.490400136f},
-std::array<float,2>{0.782181501f, 0.612861574f},
-std::array<float,2>{0.313166916f, 0.966813385f},
-std::array<float,2>{0.749774635f, 0.094759874f},
-std::array<float,2>{0.379427075f, 0.260482758f},
-std::array<float,2>{0.623661041f, 0.629903972f},
-std::array<float,2>{0.205310717f, 0.842577577f},
-std::array<float,2>{0.955539465f, 0.179746732f},
-std::array<float,2>{0.0850965381f, 0.0658113733f},
-std::array<float,2>{0.874448836f, 0.997048378f},
-std::array<float,2>{0.258220524f, 0.590264022f},
-std::array<float,2>{0.626608431f, 0.439630866f},
-std::array<float,2>{0.37306565f, 0.213433489f},
-std::array<float,2>{0.707866549f, 0.789477706f},
-std::array<float,2>{0.0331712775f, 0.706551969f},
-std::array<float,2>{0.773159206f, 0.368893176f},
-std::array<float,2>{0.177508309f, 0.38186264f},
-std::array<float,2>{0.912065506f, 0.544099331f},
-std::array<float,2>{0.454814196f, 0.902857721f},
-std::array<float,2>{0.551512957f, 0.0084470259f},
-std::array<float,2>{0.297933519f, 0.495243788f},
-std::array<float,2>{0.667972863f, 0.62488842f},
-std::array<float,2>{0.105655648f, 0.956093967f},
-std::array<float,2>{0.822865963f, 0.101809956f},
-std::array<float,2>{0.242986083f, 0.133342296f},
-std::array<float,2>{0.975175321f, 0.847402871f},
-std::array<float,2>{0.43217352f, 0.677680314f},
-std::array<float,2>{0.580134809f, 0.2831361f},
-std::array<float,2>{0.473775655f, 0.055168245f},
-std::array<float,2>{0.513868272f, 0.932232618f},
-std::array<float,2>{0.155085087f, 0.52866888f},
-std::array<float,2>{0.876928031f, 0.427188754f},
-std::array<float,2>{0.00415510777f, 0.342787653f},
-std::array<float,2>{0.812240899f, 0.72824198f},
-std::array<float,2>{0.342905521f, 0.757469714f},
-std::array<float,2>{0.725601137f, 0.223027542f},
-std::array<float,2>{0.447154522f, 0.420665979f},
-std::array<float,2>{0.537685633f, 0.514939666f},
-std::array<float,2>{0.165020198f, 0.916641295f},
-std::array<float,2>{0.928724825f, 0.0340907685f},
-std::array<float,2>{0.0506637283f, 0.238926664f},
-std::array<float,2>{0.753423154f, 0.777051687f},
-std::array<float,2>{0.350745261f, 0.737775087f},
-std::array<float,2>{0.687861681f, 0.322033197f},
-std::array<float,2>{0.271096438f, 0.124274492f},
-std::array<float,2>{0.641398132f, 0.95027864f},
-std::array<float,2>{0.0668406188f, 0.597317874f},
-std::array<float,2>{0.856347919f, 0.476556987f},
-std::array<float,2>{0.19615525f, 0.31239596f},
-std::array<float,2>{0.942451715f, 0.664605856f},
-std::array<float,2>{0.394725353f, 0.861433268f},
-std::array<float,2>{0.60047704f, 0.149690166f},
-std::array<float,2>{0.318419993f, 0.352437913f},
-std::array<float,2>{0.745214462f, 0.692774236f},
-std::array<float,2>{0.0189041272f, 0.810804844f},
-std::array<float,2>{0.787311077f, 0.201296419f},
-std::array<float,2>{0.129771829f, 0.0185531043f},
-std::array<float,2>{0.905114353f, 0.88395083f},
-std::array<float,2>{0.49188152f, 0.549086452f},
-std::array<float,2>{0.522643805f, 0.397750616f},
-std::array<float,2>{0.418427438f, 0.169434056f},
-std::array<float,2>{0.563733041f, 0.821760118f},
-std::array<float,2>{0.233145475f, 0.649277687f},
-std::array<float,2>{0.985468984f, 0.268267632f},
-std::array<float,2>{0.110901371f, 0.454285711f},
-std::array<float,2>{0.834891379f, 0.576701105f},
-std::array<float,2>{0.281515598f, 0.974947214f},
-std::array<float,2>{0.685842693f, 0.0834693313f},
-std::array<float,2>{0.492451876f, 0.316949159f},
-std::array<float,2>{0.525669098f, 0.748610735f},
-std::array<float,2>{0.1400318f, 0.76842922f},
-std::array<float,2>{0.896957397f, 0.248695344f},
-std::array<float,2>{0.0251436625f, 0.0444812551f},
-std::array<float,2>{0.795224011f, 0.911911249f},
-std::array<float,2>{0.32767126f, 0.504816234f},
-std::array<float,2>{0.735396564f, 0.413784564f},
-std::array<float,2>{0.28997913f, 0.143987119f},
-std::array<float,2>{0.672312677f, 0.871427298f},
-std::array<float,2>{0.120404199f, 0.662543416f},
-std::array<float,2>{0.838277459f, 0.298054725f},
-std::array<float,2>{0.225876048f, 0.479314953f},
-std::array<float,2>{0.994783223f, 0.605284095f},
-std::array<float,2>{0.408263773f, 0.94302386f},
-std::array<float,2>{0.577320695f, 0.112780809f},
-std::array<float,2>{0.352681935f, 0.404334843f},
-std::array<float,2>{0.696718693f, 0.554705739f},
-std::array<float,2>{0.0552939437f, 0.882125497f},
-std::array<float,2>{0.759744644f, 0.0298681818f},
-std::array<float,2>{0.16385971f, 0.194634631f},
-std::array<float,2>{0.933682859f, 0.799932659f},
-std::array<float,2>{0.437784672f, 0.697700024f},
-std::array<float,2>{0.544025719f, 0.348854989f},
-std::array<float,2>{0.401045531f, 0.0924065933f},
-std::array<float,2>{0.606050253f, 0.981270075f},
-std::array<float,2>{0.194033638f, 0.565153837f},
-std::array<float,2>{0.95027405f, 0.465147406f},
-std::array<float,2>{0.0734361634f, 0.279800355f},
-std::array<float,2>{0.846520185f, 0.641447425f},
-std::array<float,2>{0.281109184f, 0.818297505f},
-std::array<float,2>{0.649423718f, 0.160044149f},
-std::array<float,2>{0.424978614f, 0.448025286f},
-std::array<float,2>{0.59307915f, 0.578391612f},
-std::array<float,2>{0.236767009f, 0.991740108f},
-std::array<float,2>{0.976985991f, 0.0711018741f},
-std::array<float,2>{0.0993463546f, 0.172823548f},
-std::array<float,2>{0.813756287f, 0.831544101f},
-std::array<float,2>{0.308147281f, 0.639703214f},
-std::array<float,2>{0.658039689f, 0.25764212f},
-std::array<float,2>{0.328788936f, 0.00538157439f},
-std::array<float,2>{0.726813912f, 0.892008781f},
-std::array<float,2>{0.0137046091f, 0.535486042f},
-std::array<float,2>{0.800109804f, 0.383935869f},
-std::array<float,2>{0.145651743f, 0.362100035f},
-std::array<float,2>{0.887800515f, 0.716532826f},
-std::array<float,2>{0.477590144f, 0.784364939f},
-std::array<float,2>{0.500437498f, 0.204973966f},
-std::array<float,2>{0.256434441f, 0.291000605f},
-std::array<float,2>{0.634727776f, 0.680486321f},
-std::array<float,2>{0.0866255537f, 0.855964303f},
-std::array<float,2>{0.862723291f, 0.129032269f},
-std::array<float,2>{0.211398065f, 0.0985029861f},
-std::array<float,2>{0.96315372f, 0.961607814f},
-std::array<float,2>{0.389323801f, 0.615770221f},
-std::array<float,2>{0.612408042f, 0.485238433f},
-std::array<float,2>{0.467667371f, 0.230894864f},
-std::array<float,2>{0.558017373f, 0.762730122f},
-std::array<float,2>{0.180902377f, 0.72327292f},
-std::array<float,2>{0.914611876f, 0.332332373f},
-std::array<float,2>{0.0437963009f, 0.436813116f},
-std::array<float,2>{0.777378559f, 0.523182154f},
-std::array<float,2>{0.362542182f, 0.922813058f},
-std::array<float,2>{0.711210847f, 0.0519665591f},
-std::array<float,2>{0.405588061f, 0.339318782f},
-std::array<float,2>{0.605026722f, 0.733040929f},
-std::array<float,2>{0.188897282f, 0.751541018f},
-std::array<float,2>{0.948708117f, 0.220038369f},
-std::array<float,2>{0.0753190368f, 0.0616552196f},
-std::array<float,2>{0.850457132f, 0.93744272f},
-std::array<float,2>{0.274640828f, 0.526172519f},
-std::array<float,2>{0.655454934f, 0.424973905f},
-std::array<float,2>{0.359338522f, 0.139918625f},
-std::array<float,2>{0.702326417f, 0.850257337f},
-std::array<float,2>{0.0621103756f, 0.675158679f},
-std::array<float,2>{0.764971793f, 0.285657108f},
-std::array<float,2>{0.157503769f, 0.499833107f},
-std::array<float,2>{0.932100654f, 0.617682695f},
-std::array<float,2>{0.441963196f, 0.957679331f},
-std::array<float,2>{0.540650725f, 0.107118852f},
-std::array<float,2>{0.296022832f, 0.378679186f},
-std::array<float,2>{0.679643631f, 0.541028678f},
-std::array<float,2>{0.124913201f, 0.902205706f},
-std::array<float,2>{0.840215504f, 0.0149512719f},
-std::array<float,2>{0.219295815f, 0.216020882f},
-std::array<float,2>{0.996895552f, 0.793997169f},
-std::array<float,2>{0.410352409f, 0.708046138f},
-std::array<float,2>{0.573197186f, 0.373194098f},
-std::array<float,2>{0.498575449f, 0.0697673708f},
-std::array<float,2>{0.527730048f, 0.994724214f},
-std::array<float,2>{0.135133058f, 0.587236643f},
-std::array<float,2>{0.89081341f, 0.441843629f},
-std::array<float,2>{0.0303924903f, 0.262433499f},
-std::array<float,2>{0.791213334f, 0.625853598f},
-std::array<float,2>{0.322636306f, 0.838603318f},
-std::array<float,2>{0.738438427f, 0.18647562f},
-std::array<float,2>{0.463674933f, 0.457559556f},
-std::array<float,2>{0.560793698f, 0.573930025f},
-std::array<float,2>{0.187166363f, 0.971833527f},
-std::array<float,2>{0.918138564f, 0.0809362531f},
-std::array<float,2>{0.0407464206f, 0.164622039f},
-std::array<float,2>{0.775205016f, 0.827376306f},
-std::array<float,2>{0.363437355f, 0.656201124f},
-std::array<float,2>{0.715955973f, 0.272878319f},
-std::array<float,2>{0.253407061f, 0.0208125934f},
-std::array<float,2>{0.637609005f, 0.888306081f},
-std::array<float,2>{0.0907523185f, 0.552971184f},
-std::array<float,2>{0.865205109f, 0.392725348f},
-std::array<float,2>{0.21809876f, 0.357998997f},
-std::array<float,2>{0.965047657f, 0.687990844f},
-std::array<float,2>{0.384027034f, 0.806467116f},
-std::array<float,2>{0.614804149f, 0.198867083f},
-std::array<float,2>{0.334239751f, 0.308366299f},
-std::array<float,2>{0.7335127f, 0.670308828f},
-std::array<float,2>{0.00845748f, 0.866803586f},
-std::array<float,2>{0.804531634f, 0.152721688f},
-std::array<float,2>{0.142832741f, 0.11853794f},
-std::array<float,2>{0.885125935f, 0.948883951f},
-std::array<float,2>{0.483556598f, 0.600469291f},
-std::array<float,2>{0.506342232f, 0.472140253f},
-std::array<float,2>{0.42698279f, 0.236804172f},
-std::array<float,2>{0.585965633f, 0.778257489f},
-std::array<float,2>{0.240535602f, 0.742072523f},
-std::array<float,2>{0.983299732f, 0.324932396f},
-std::array<float,2>{0.0969192907f, 0.417143315f},
-std::array<float,2>{0.816848338f, 0.510725379f},
-std::array<float,2>{0.311725527f, 0.91998589f},
-std::array<float,2>{0.662067175f, 0.0386701822f},
-std::array<float,2>{0.470557898f, 0.274108648f},
-std::array<float,2>{0.510095358f, 0.645044148f},
-std::array<float,2>{0.150313124f, 0.813485265f},
-std::array<float,2>{0.880486727f, 0.160652474f},
-std::array<float,2>{5.43527967e-05f, 0.0878875032f},
-std::array<float,2>{0.808317125f, 0.978239298f},
-std::array<float,2>{0.336288065f, 0.567106903f},
-std::array<float,2>{0.721517563f, 0.462207228f},
-std::array<float,2>{0.303153366f, 0.189565033f},
-std::array<float,2>{0.66513747f, 0.802858174f},
-std::array<float,2>{0.103251629f, 0.703074515f},
-std::array<float,2>{0.824875593f, 0.346379876f},
-std::array<float,2>{0.248328909f, 0.400501579f},
-std::array<float,2>{0.969694555f, 0.561950922f},
-std::array<float,2>{0.433827966f, 0.875250041f},
-std::array<float,2>{0.584872663f, 0.0273091719f},
-std::array<float,2>{0.369218409f, 0.480720341f},
-std::array<float,2>{0.704483449f, 0.607827783f},
-std::array<float,2>{0.0388469882f, 0.940181315f},
-std::array<float,2>{0.766714275f, 0.114304781f},
-std::array<float,2>{0.173374787f, 0.147833943f},
-std::array<float,2>{0.907669485f, 0.86941725f},
-std::array<float,2>{0.457160413f, 0.657387733f},
-std::array<float,2>{0.549370348f, 0.304555863f},
-std::array<float,2>{0.37743181f, 0.042830199f},
-std::array<float,2>{0.618619025f, 0.909603f},
-std::array<float,2>{0.209631756f, 0.503749073f},
-std::array<float,2>{0.960143387f, 0.409223884f},
-std::array<float,2>{0.0793334544f, 0.31378749f},
-std::array<float,2>{0.870798945f, 0.745960832f},
-std::array<float,2>{0.261889219f, 0.772690535f},
-std::array<float,2>{0.631636202f, 0.243725106f},
-std::array<float,2>{0.417460024f, 0.432470351f},
-std::array<float,2>{0.566954017f, 0.519125581f},
-std::array<float,2>{0.229961276f, 0.927622736f},
-std::array<float,2>{0.989507198f, 0.0471668243f},
-std::array<float,2>{0.115694538f, 0.22921671f},
-std::array<float,2>{0.830724835f, 0.759617925f},
-std::array<float,2>{0.288394094f, 0.718963206f},
-std::array<float,2>{0.682175636f, 0.328158617f},
-std::array<float,2>{0.315860659f, 0.097201623f},
-std::array<float,2>{0.747417986f, 0.966511011f},
-std::array<float,2>{0.0208133608f, 0.610771537f},
-std::array<float,2>{0.78449744f, 0.489575118f},
-std::array<float,2>{0.128270745f, 0.295242429f},
-std::array<float,2>{0.899146497f, 0.68423605f},
-std::array<float,2>{0.485126734f, 0.853001177f},
-std::array<float,2>{0.515887737f, 0.125171542f},
-std::array<float,2>{0.269406796f, 0.366598934f},
-std::array<float,2>{0.644829631f, 0.711771429f},
-std::array<float,2>{0.0654632375f, 0.78702265f},
-std::array<float,2>{0.851704478f, 0.210082918f},
-std::array<float,2>{0.202559531f, 0.000314065692f},
-std::array<float,2>{0.940178633f, 0.897687554f},
-std::array<float,2>{0.392942488f, 0.53337729f},
-std::array<float,2>{0.597372413f, 0.388931334f},
-std::array<float,2>{0.449390948f, 0.176632375f},
-std::array<float,2>{0.534216464f, 0.834285975f},
-std::array<float,2>{0.170474306f, 0.635319769f},
-std::array<float,2>{0.925741673f, 0.252284646f},
-std::array<float,2>{0.05383569f, 0.451922178f},
-std::array<float,2>{0.757352769f, 0.583001554f},
-std::array<float,2>{0.34427622f, 0.987272382f},
-std::array<float,2>{0.694831252f, 0.0772111714f},
-std::array<float,2>{0.431520253f, 0.285010427f},
-std::array<float,2>{0.57942611f, 0.679223955f},
-std::array<float,2>{0.245307013f, 0.845310748f},
-std::array<float,2>{0.973724246f, 0.135314256f},
-std::array<float,2>{0.107716739f, 0.105448544f},
-std::array<float,2>{0.821080565f, 0.953589499f},
-std::array<float,2>{0.300555646f, 0.622731388f},
-std::array<float,2>{0.670125127f, 0.492436767f},
-std::array<float,2>{0.340579957f, 0.225697935f},
-std::array<float,2>{0.723917902f, 0.754547656f},
-std::array<float,2>{0.00766580552f, 0.730385423f},
-std::array<float,2>{0.810187042f, 0.340305239f},
-std::array<float,2>{0.15304023f, 0.428301901f},
-std::array<float,2>{0.877947569f, 0.531053245f},
-std::array<float,2>{0.476079375f, 0.931384742f},
-std::array<float,2>{0.511977494f, 0.0573225059f},
-std::array<float,2>{0.260966182f, 0.438381106f},
-std::array<float,2>{0.627385139f, 0.592310011f},
-std::array<float,2>{0.0827407613f, 0.999747276f},
-std::array<float,2>{0.872306108f, 0.0635129213f},
-std::array<float,2>{0.204507083f, 0.182049975f},
-std::array<float,2>{0.953304172f, 0.841401577f},
-std::array<float,2>{0.382618219f, 0.632243037f},
-std::array<float,2>{0.622890949f, 0.257938951f},
-std::array<float,2>{0.455898434f, 0.00997644104f},
-std::array<float,2>{0.554170072f, 0.904590428f},
-std::array<float,2>{0.177802831f, 0.545514345f},
-std::array<float,2>{0.912703753f, 0.380490392f},
-std::array<float,2>{0.0342018157f, 0.370430857f},
-std::array<float,2>{0.770767212f, 0.7050758f},
-std::array<float,2>{0.371759921f, 0.791573942f},
-std::array<float,2>{0.710467458f, 0.211301357f},
-std::array<float,2>{0.489778847f, 0.39607048f},
-std::array<float,2>{0.519973397f, 0.548244715f},
-std::array<float,2>{0.131682247f, 0.885243595f},
-std::array<float,2>{0.9038077f, 0.0173835922f},
-std::array<float,2>{0.0163699016f, 0.199491903f},
-std::array<float,2>{0.785553515f, 0.809183359f},
-std::array<float,2>{0.318309903f, 0.693617761f},
-std::array<float,2>{0.743194818f, 0.353617996f},
-std::array<float,2>{0.283906043f, 0.0858639628f},
-std::array<float,2>{0.685144305f, 0.973676085f},
-std::array<float,2>{0.112190537f, 0.575922549f},
-std::array<float,2>{0.833155811f, 0.455483943f},
-std::array<float,2>{0.230760738f, 0.267054379f},
-std::array<float,2>{0.988048375f, 0.651161134f},
-std::array<float,2>{0.420071125f, 0.824109197f},
-std::array<float,2>{0.565109074f, 0.170871109f},
-std::array<float,2>{0.348521471f, 0.322874963f},
-std::array<float,2>{0.690399766f, 0.735061765f},
-std::array<float,2>{0.0473326668f, 0.774843931f},
-std::array<float,2>{0.751514792f, 0.241393641f},
-std::array<float,2>{0.166093647f, 0.0318568423f},
-std::array<float,2>{0.925927162f, 0.915717721f},
-std::array<float,2>{0.44811222f, 0.512580693f},
-std::array<float,2>{0.536999106f, 0.419697315f},
-std::array<float,2>{0.397261977f, 0.152107745f},
-std::array<float,2>{0.598174632f, 0.86024493f},
-std::array<float,2>{0.197795719f, 0.667814612f},
-std::array<float,2>{0.945212305f, 0.308944225f},
-std::array<float,2>{0.069837153f, 0.473933727f},
-std::array<float,2>{0.857609153f, 0.595288217f},
-std::array<float,2>{0.273429036f, 0.952168941f},
-std::array<float,2>{0.643712819f, 0.12119168f},
-std::array<float,2>{0.439502507f, 0.350545347f},
-std::array<float,2>{0.545169652f, 0.696355104f},
-std::array<float,2>{0.160241991f, 0.798362374f},
-std::array<float,2>{0.936600804f, 0.193160027f},
-std::array<float,2>{0.0577176102f, 0.0282077678f},
-std::array<float,2>{0.760061681f, 0.879322171f},
-std::array<float,2>{0.355412394f, 0.558066249f},
-std::array<float,2>{0.698993027f, 0.403137684f},
-std::array<float,2>{0.279282421f, 0.156749994f},
-std::array<float,2>{0.651235759f, 0.820006728f},
-std::array<float,2>{0.0709589124f, 0.643990517f},
-std::array<float,2>{0.845058084f, 0.279084921f},
-std::array<float,2>{0.192213044f, 0.466860145f},
-std::array<float,2>{0.952777803f, 0.562520385f},
-std::array<float,2>{0.398972631f, 0.982814908f},
-std::array<float,2>{0.609159708f, 0.0904958174f},
-std::array<float,2>{0.326087862f, 0.410463363f},
-std::array<float,2>{0.737486124f, 0.506214499f},
-std::array<float,2>{0.0263709463f, 0.9130193f},
-std::array<float,2>{0.794667363f, 0.0460215732f},
-std::array<float,2>{0.137391046f, 0.246379852f},
-std::array<float,2>{0.894557714f, 0.767226577f},
-std::array<float,2>{0.495935947f, 0.746243358f},
-std::array<float,2>{0.525104702f, 0.319455564f},
-std::array<float,2>{0.407111347f, 0.110689431f},
-std::array<float,2>{0.575333059f, 0.943613052f},
-std::array<float,2>{0.224344566f, 0.602253616f},
-std::array<float,2>{0.992839396f, 0.476665258f},
-std::array<float,2>{0.118012771f, 0.299113303f},
-std::array<float,2>{0.835985065f, 0.660977662f},
-std::array<float,2>{0.292389035f, 0.874777913f},
-std::array<float,2>{0.674818158f, 0.142150789f},
-std::array<float,2>{0.387391031f, 0.487353742f},
-std::array<float,2>{0.61076498f, 0.614182711f},
-std::array<float,2>{0.213093638f, 0.963872492f},
-std::array<float,2>{0.962782145f, 0.10153199f},
-std::array<float,2>{0.0892436579f, 0.132802054f},
-std::array<float,2>{0.860693872f, 0.857626498f},
-std::array<float,2>{0.254809231f, 0.683132946f},
-std::array<float,2>{0.636057198f, 0.29144603f},
-std::array<float,2>{0.359404624f, 0.0545234047f},
-std::array<float,2>{0.714545846f, 0.924075723f},
-std::array<float,2>{0.0462563038f, 0.521024585f},
-std::array<float,2>{0.779298186f, 0.43413955f},
-std::array<float,2>{0.181790933f, 0.335739046f},
-std::array<float,2>{0.916583657f, 0.725489855f},
-std::array<float,2>{0.465560585f, 0.764406145f},
-std::array<float,2>{0.555817425f, 0.232454225f},
-std::array<float,2>{0.306424469f, 0.254492223f},
-std::array<float,2>{0.659437001f, 0.638436496f},
-std::array<float,2>{0.100126952f, 0.828400373f},
-std::array<float,2>{0.81593436f, 0.174598709f},
-std::array<float,2>{0.235682055f, 0.0738635212f},
-std::array<float,2>{0.980101943f, 0.989509583f},
-std::array<float,2>{0.423774749f, 0.581622541f},
-std::array<float,2>{0.590649366f, 0.446438819f},
-std::array<float,2>{0.47917065f, 0.206102043f},
-std::array<float,2>{0.502225101f, 0.781443775f},
-std::array<float,2>{0.147086471f, 0.718486369f},
-std::array<float,2>{0.889498949f, 0.360567331f},
-std::array<float,2>{0.0130236512f, 0.385824978f},
-std::array<float,2>{0.797668934f, 0.537647307f},
-std::array<float,2>{0.330759346f, 0.894473732f},
-std::array<float,2>{0.729251564f, 0.0077771754f},
-std::array<float,2>{0.382873893f, 0.357099026f},
-std::array<float,2>{0.613382757f, 0.691298008f},
-std::array<float,2>{0.216836244f, 0.807267189f},
-std::array<float,2>{0.966004252f, 0.196144596f},
-std::array<float,2>{0.0911166444f, 0.0222928375f},
-std::array<float,2>{0.864190578f, 0.889618397f},
-std::array<float,2>{0.252480298f, 0.552126586f},
-std::array<float,2>{0.637938082f, 0.392195493f},
-std::array<float,2>{0.364736766f, 0.167145431f},
-std::array<float,2>{0.715021014f, 0.82579726f},
-std::array<float,2>{0.0396401063f, 0.65366143f},
-std::array<float,2>{0.773974419f, 0.27140367f},
-std::array<float,2>{0.186454162f, 0.459677547f},
-std::array<float,2>{0.919055462f, 0.57141006f},
-std::array<float,2>{0.464493901f, 0.96940136f},
-std::array<float,2>{0.561861217f, 0.0796484351f},
-std::array<float,2>{0.310973734f, 0.41573295f},
-std::array<float,2>{0.660864353f, 0.508358717f},
-std::array<float,2>{0.0964947194f, 0.918249011f},
-std::array<float,2>{0.817569971f, 0.0366053022f},
-std::array<float,2>{0.241864443f, 0.236147985f},
-std::array<float,2>{0.984224141f, 0.780782342f},
-std::array<float,2>{0.426280767f, 0.739741921f},
-std::array<float,2>{0.58763051f, 0.327240825f},
-std::array<float,2>{0.482929468f, 0.120836996f},
-std::array<float,2>{0.507244051f, 0.947094917f},
-std::array<float,2>{0.143998116f, 0.599268377f},
-std::array<float,2>{0.885789275f, 0.469036371f},
-std::array<float,2>{0.00950134266f, 0.305909932f},
-std::array<float,2>{0.802874565f, 0.669192791f},
-std::array<float,2>{0.335286945f, 0.865198672f},
-std::array<float,2>{0.733171463f, 0.156206444f},
-std::array<float,2>{0.442982644f, 0.497066557f},
-std::array<float,2>{0.539715946f, 0.621043324f},
-std::array<float,2>{0.156829953f, 0.959932566f},
-std::array<float,2>{0.933420241f, 0.107991159f},
-std::array<float,2>{0.0611307472f, 0.137690783f},
-std::array<float,2>{0.764364004f, 0.847731709f},
-std::array<float,2>{0.358358026f, 0.672552407f},
-std::array<float,2>{0.701460004f, 0.287114054f},
-std::array<float,2>{0.274396867f, 0.0603913367f},
-std::array<float,2>{0.654990196f, 0.934562206f},
-std::array<float,2>{0.0751485601f, 0.523702145f},
-std::array<float,2>{0.851109564f, 0.422222972f},
-std::array<float,2>{0.187869817f, 0.336680532f},
-std::array<float,2>{0.947300792f, 0.732313752f},
-std::array<float,2>{0.404904693f, 0.753243327f},
-std::array<float,2>{0.604208112f, 0.22080484f},
-std::array<float,2>{0.32344535f, 0.264714628f},
-std::array<float,2>{0.739912331f, 0.627282202f},
-std::array<float,2>{0.0301811434f, 0.837572753f},
-std::array<float,2>{0.792426586f, 0.184454381f},
-std::array<float,2>{0.136555046f, 0.0675984547f},
-std::array<float,2>{0.891913056f, 0.994113624f},
-std::array<float,2>{0.499929637f, 0.589799643f},
-std::array<float,2>{0.528640509f, 0.443374664f},
-std::array<float,2>{0.41117847f, 0.217049599f},
-std::array<float,2>{0.574029863f, 0.795092583f},
-std::array<float,2>{0.220250562f, 0.710857213f},
-std::array<float,2>{0.997723341f, 0.371151567f},
-std::array<float,2>{0.123308703f, 0.376241267f},
-std::array<float,2>{0.840860367f, 0.539829552f},
-std::array<float,2>{0.295157939f, 0.900263309f},
-std::array<float,2>{0.678688288f, 0.0136148026f},
-std::array<float,2>{0.485922784f, 0.293378979f},
-std::array<float,2>{0.517564893f, 0.686260402f},
-std::array<float,2>{0.127577767f, 0.854274273f},
-std::array<float,2>{0.899816334f, 0.127261654f},
-std::array<float,2>{0.0202875882f, 0.0937760323f},
-std::array<float,2>{0.783319056f, 0.9678756f},
-std::array<float,2>{0.315054208f, 0.611409128f},
-std::array<float,2>{0.746321321f, 0.491898537f},
-std::array<float,2>{0.287521183f, 0.227106616f},
-std::array<float,2>{0.683576167f, 0.760446668f},
-std::array<float,2>{0.116306834f, 0.720770299f},
-std::array<float,2>{0.831896484f, 0.330781907f},
-std::array<float,2>{0.22867465f, 0.431520939f},
-std::array<float,2>{0.988325179f, 0.516771674f},
-std::array<float,2>{0.416364759f, 0.928279996f},
-std::array<float,2>{0.568003654f, 0.0492380261f},
-std::array<float,2>{0.345158756f, 0.449701577f},
-std::array<float,2>{0.694279552f, 0.585527182f},
-std::array<float,2>{0.0531875193f, 0.98523128f},
-std::array<float,2>{0.756055713f, 0.0754519105f},
-std::array<float,2>{0.171868622f, 0.178193927f},
-std::array<float,2>{0.924052238f, 0.83227706f},
-std::array<float,2>{0.45043689f, 0.634372115f},
-std::array<float,2>{0.533477724f, 0.250846654f},
-std::array<float,2>{0.394237638f, 0.00310597196f},
-std::array<float,2>{0.596002221f, 0.895490825f},
-std::array<float,2>{0.202042758f, 0.533200502f},
-std::array<float,2>{0.940880477f, 0.387887836f},
-std::array<float,2>{0.0647809356f, 0.364661306f},
-std::array<float,2>{0.853349745f, 0.71348232f},
-std::array<float,2>{0.268527806f, 0.788734257f},
-std::array<float,2>{0.645932019f, 0.207820103f},
-std::array<float,2>{0.435513079f, 0.398751199f},
-std::array<float,2>{0.585538328f, 0.558862507f},
-std::array<float,2>{0.249679282f, 0.877522171f},
-std::array<float,2>{0.96982038f, 0.0247518774f},
-std::array<float,2>{0.101641044f, 0.188162565f},
-std::array<float,2>{0.825701296f, 0.801243484f},
-std::array<float,2>{0.30405274f, 0.699850857f},
-std::array<float,2>{0.664702892f, 0.345471382f},
-std::array<float,2>{0.33695668f, 0.0882242694f},
-std::array<float,2>{0.722213447f, 0.978750408f},
-std::array<float,2>{0.00130553253f, 0.569201767f},
-std::array<float,2>{0.80741173f, 0.464054316f},
-std::array<float,2>{0.149329692f, 0.277213186f},
-std::array<float,2>{0.87946564f, 0.646814346f},
-std::array<float,2>{0.469424486f, 0.815773427f},
-std::array<float,2>{0.510919034f, 0.163086668f},
-std::array<float,2>{0.262852103f, 0.3158696f},
-std::array<float,2>{0.632220984f, 0.743934691f},
-std::array<float,2>{0.0782253072f, 0.769856453f},
-std::array<float,2>{0.869879365f, 0.245999366f},
-std::array<float,2>{0.210743085f, 0.0405544974f},
-std::array<float,2>{0.959195077f, 0.906327903f},
-std::array<float,2>{0.37834844f, 0.501882851f},
-std::array<float,2>{0.617914379f, 0.408040792f},
-std::array<float,2>{0.458802521f, 0.145860553f},
-std::array<float,2>{0.549987495f, 0.867912591f},
-std::array<float,2>{0.172391906f, 0.659396052f},
-std::array<float,2>{0.906903803f, 0.302392811f},
-std::array<float,2>{0.0376635268f, 0.483530849f},
-std::array<float,2>{0.766212225f, 0.605580389f},
-std::array<float,2>{0.371022195f, 0.93895942f},
-std::array<float,2>{0.703356445f, 0.116321683f},
-std::array<float,2>{0.421743393f, 0.269384861f},
-std::array<float,2>{0.565941989f, 0.650194764f},
-std::array<float,2>{0.23234345f, 0.820636451f},
-std::array<float,2>{0.986595392f, 0.168148905f},
-std::array<float,2>{0.112408161f, 0.0827613771f},
-std::array<float,2>{0.832779348f, 0.975758076f},
-std::array<float,2>{0.28507477f, 0.578028202f},
-std::array<float,2>{0.68400389f, 0.454099715f},
-std::array<float,2>{0.316409439f, 0.202701971f},
-std::array<float,2>{0.74309653f, 0.811963022f},
-std::array<float,2>{0.0175038446f, 0.691830039f},
-std::array<float,2>{0.786491215f, 0.353319407f},
-std::array<float,2>{0.13217631f, 0.396971315f},
-std::array<float,2>{0.902664363f, 0.549846411f},
-std::array<float,2>{0.488626808f, 0.883540332f},
-std::array<float,2>{0.521325707f, 0.0188152678f},
-std::array<float,2>{0.271496445f, 0.475141019f},
-std::array<float,2>{0.642877281f, 0.596603155f},
-std::array<float,2>{0.0683869645f, 0.950192809f},
-std::array<float,2>{0.859185338f, 0.123315863f},
-std::array<float,2>{0.199046671f, 0.148483291f},
-std::array<float,2>{0.944189906f, 0.862769425f},
-std::array<float,2>{0.39787966f, 0.665604889f},
-std::array<float,2>{0.599469244f, 0.310925245f},
-std::array<float,2>{0.448435754f, 0.0345205739f},
-std::array<float,2>{0.535651982f, 0.917273939f},
-std::array<float,2>{0.167853653f, 0.514361501f},
-std::array<float,2>{0.927525818f, 0.421749204f},
-std::array<float,2>{0.0479538217f, 0.320481986f},
-std::array<float,2>{0.750101089f, 0.736714244f},
-std::array<float,2>{0.349297196f, 0.775545895f},
-std::array<float,2>{0.690471172f, 0.239941016f},
-std::array<float,2>{0.475274116f, 0.42618522f},
-std::array<float,2>{0.512716234f, 0.527455032f},
-std::array<float,2>{0.153765321f, 0.933582485f},
-std::array<float,2>{0.877149045f, 0.056480322f},
-std::array<float,2>{0.00603081845f, 0.223750368f},
-std::array<float,2>{0.808839798f, 0.756014049f},
-std::array<float,2>{0.341486841f, 0.726647973f},
-std::array<float,2>{0.723615825f, 0.342491627f},
-std::array<float,2>{0.298918188f, 0.103277728f},
-std::array<float,2>{0.67165941f, 0.955999672f},
-std::array<float,2>{0.108410642f, 0.623760998f},
-std::array<float,2>{0.822065353f, 0.494350135f},
-std::array<float,2>{0.244429037f, 0.281314373f},
-std::array<float,2>{0.973509133f, 0.676133454f},
-std::array<float,2>{0.429694951f, 0.846158862f},
-std::array<float,2>{0.578388035f, 0.134455457f},
-std::array<float,2>{0.372362137f, 0.367380172f},
-std::array<float,2>{0.709792376f, 0.705590069f},
-std::array<float,2>{0.033593636f, 0.791009665f},
-std::array<float,2>{0.769918978f, 0.214691043f},
-std::array<float,2>{0.178783149f, 0.00955261104f},
-std::array<float,2>{0.913357675f, 0.903508246f},
-std::array<float,2>{0.456879944f, 0.543351471f},
-std::array<float,2>{0.553541183f, 0.381002218f},
-std::array<float,2>{0.381081939f, 0.180728227f},
-std::array<float,2>{0.621991158f, 0.843202412f},
-std::array<float,2>{0.203565732f, 0.629581809f},
-std::array<float,2>{0.954997241f, 0.260802656f},
-std::array<float,2>{0.0838736221f, 0.440828502f},
-std::array<float,2>{0.871536016f, 0.59143132f},
-std::array<float,2>{0.259843707f, 0.997581005f},
-std::array<float,2>{0.628775895f, 0.0653840676f},
-std::array<float,2>{0.466482013f, 0.333523631f},
-std::array<float,2>{0.554778218f, 0.724303544f},
-std::array<float,2>{0.183313116f, 0.762414277f},
-std::array<float,2>{0.917110384f, 0.231915221f},
-std::array<float,2>{0.0452407971f, 0.0509041585f},
-std::array<float,2>{0.780897677f, 0.923715234f},
-std::array<float,2>{0.361125976f, 0.522247076f},
-std::array<float,2>{0.71291846f, 0.435843945f},
-std::array<float,2>{0.255242795f, 0.130021363f},
-std::array<float,2>{0.635602653f, 0.856617153f},
-std::array<float,2>{0.0881205946f, 0.680920482f},
-std::array<float,2>{0.859401643f, 0.289530069f},
-std::array<float,2>{0.214146048f, 0.485919178f},
-std::array<float,2>{0.961290061f, 0.616553962f},
-std::array<float,2>{0.388172835f, 0.962228775f},
-std::array<float,2>{0.609666228f, 0.099522166f},
-std::array<float,2>{0.331322223f, 0.38375473f},
-std::array<float,2>{0.729676962f, 0.536200404f},
-std::array<float,2>{0.0117237531f, 0.891115308f},
-std::array<float,2>{0.798047841f, 0.00442817295f},
-std::array<float,2>{0.147991449f, 0.203512937f},
-std::array<float,2>{0.890399277f, 0.784146488f},
-std::array<float,2>{0.480188549f, 0.715392828f},
-std::array<float,2>{0.503592074f, 0.363120526f},
-std::array<float,2>{0.421910077f, 0.0719646662f},
-std::array<float,2>{0.591713607f, 0.991078556f},
-std::array<float,2>{0.235120758f, 0.579540372f},
-std::array<float,2>{0.97874707f, 0.448794305f},
-std::array<float,2>{0.101050474f, 0.256143242f},
-std::array<float,2>{0.815211356f, 0.638724148f},
-std::array<float,2>{0.305648774f, 0.83068794f},
-std::array<float,2>{0.65873456f, 0.173244983f},
-std::array<float,2>{0.399740815f, 0.466004133f},
-std::array<float,2>{0.607493877f, 0.565977573f},
-std::array<float,2>{0.193069443f, 0.982102334f},
-std::array<float,2>{0.951704443f, 0.0931868479f},
-std::array<float,2>{0.0714395419f, 0.158674434f},
-std::array<float,2>{0.844637513f, 0.81722486f},
-std::array<float,2>{0.278069943f, 0.641934514f},
-std::array<float,2>{0.651556671f, 0.280561239f},
-std::array<float,2>{0.354289919f, 0.0304361619f},
-std::array<float,2>{0.698078811f, 0.881290674f},
-std::array<float,2>{0.0571484305f, 0.556135952f},
-std::array<float,2>{0.761245906f, 0.405844182f},
-std::array<float,2>{0.161203831f, 0.348341256f},
-std::array<float,2>{0.93628782f, 0.698358536f},
-std::array<float,2>{0.44075942f, 0.799408555f},
-std::array<float,2>{0.546554089f, 0.193611309f},
-std::array<float,2>{0.291609913f, 0.297577918f},
-std::array<float,2>{0.673962355f, 0.663307309f},
-std::array<float,2>{0.118482605f, 0.872112632f},
-std::array<float,2>{0.836992681f, 0.142789304f},
-std::array<float,2>{0.222787008f, 0.112116508f},
-std::array<float,2>{0.993907928f, 0.941553235f},
-std::array<float,2>{0.407654434f, 0.60353744f},
-std::array<float,2>{0.57497412f, 0.479996562f},
-std::array<float,2>{0.494868696f, 0.249094278f},
-std::array<float,2>{0.523931384f, 0.768759608f},
-std::array<float,2>{0.13801901f, 0.749091566f},
-std::array<float,2>{0.89569062f, 0.317746162f},
-std::array<float,2>{0.0261393785f, 0.412943244f},
-std::array<float,2>{0.79389894f, 0.505735219f},
-std::array<float,2>{0.324280024f, 0.91095233f},
-std::array<float,2>{0.736386478f, 0.0438345522f},
-std::array<float,2>{0.428094625f, 0.325725317f},
-std::array<float,2>{0.589232326f, 0.740372121f},
-std::array<float,2>{0.238454565f, 0.778780222f},
-std::array<float,2>{0.981174588f, 0.23817043f},
-std::array<float,2>{0.0945060998f, 0.0379487835f},
-std::array<float,2>{0.818597019f, 0.921852112f},
-std::array<float,2>{0.308934778f, 0.511094689f},
-std::array<float,2>{0.663039446f, 0.416629374f},
-std::array<float,2>{0.333587915f, 0.153681368f},
-std::array<float,2>{0.732269347f, 0.865470231f},
-std::array<float,2>{0.0117017459f, 0.671499193f},
-std::array<float,2>{0.801258981f, 0.306714088f},
-std::array<float,2>{0.140706912f, 0.471544772f},
-std::array<float,2>{0.884244025f, 0.60066092f},
-std::array<float,2>{0.48169753f, 0.947566986f},
-std::array<float,2>{0.505068481f, 0.117482208f},
-std::array<float,2>{0.25141117f, 0.394512743f},
-std::array<float,2>{0.639775515f, 0.553970575f},
-std::array<float,2>{0.0921217725f, 0.887569726f},
-std::array<float,2>{0.865821302f, 0.0199894868f},
-std::array<float,2>{0.21511817f, 0.198018476f},
-std::array<float,2>{0.96711427f, 0.805223107f},
-std::array<float,2>{0.384989321f, 0.688574016f},
-std::array<float,2>{0.616171539f, 0.359331846f},
-std::array<float,2>{0.462412298f, 0.0816544369f},
-std::array<float,2>{0.558681369f, 0.970982313f},
-std::array<float,2>{0.184204146f, 0.572681546f},
-std::array<float,2>{0.921783268f, 0.458202481f},
-std::array<float,2>{0.0425982624f, 0.272240996f},
-std::array<float,2>{0.776220202f, 0.655205846f},
-std::array<float,2>{0.36591351f, 0.826399565f},
-std::array<float,2>{0.717274785f, 0.165283576f},
-std::array<float,2>{0.498038471f, 0.442688525f},
-std::array<float,2>{0.529752791f, 0.586098731f},
-std::array<float,2>{0.13296631f, 0.996059775f},
-std::array<float,2>{0.893446207f, 0.0687289238f},
-std::array<float,2>{0.0281917136f, 0.187185511f},
-std::array<float,2>{0.789068341f, 0.8397066f},
-std::array<float,2>{0.320794702f, 0.626713991f},
-std::array<float,2>{0.741743147f, 0.262928009f},
-std::array<float,2>{0.294320583f, 0.0138546443f},
-std::array<float,2>{0.677487195f, 0.900390744f},
-std::array<float,2>{0.121487692f, 0.542353332f},
-std::array<float,2>{0.843569577f, 0.37777099f},
-std::array<float,2>{0.222203985f, 0.374069184f},
-std::array<float,2>{0.999798894f, 0.707996786f},
-std::array<float,2>{0.41215378f, 0.79305315f},
-std::array<float,2>{0.57186532f, 0.214984566f},
-std::array<float,2>{0.356519341f, 0.286672086f},
-std::array<float,2>{0.699456573f, 0.673939645f},
-std::array<float,2>{0.0594115183f, 0.850654662f},
-std::array<float,2>{0.763105392f, 0.13894929f},
-std::array<float,2>{0.158409104f, 0.105770871f},
-std::array<float,2>{0.931092441f, 0.958400428f},
-std::array<float,2>{0.444863081f, 0.619127929f},
-std::array<float,2>{0.54270184f, 0.498411059f},
-std::array<float,2>{0.404056549f, 0.218987539f},
-std::array<float,2>{0.602317512f, 0.750298202f},
-std::array<float,2>{0.190417677f, 0.733721137f},
-std::array<float,2>{0.945604384f, 0.338231504f},
-std::array<float,2>{0.0764553621f, 0.424640328f},
-std::array<float,2>{0.849204361f, 0.526884496f},
-std::array<float,2>{0.277151018f, 0.935745597f},
-std::array<float,2>{0.652457416f, 0.0608333237f},
-std::array<float,2>{0.451509953f, 0.253823072f},
-std::array<float,2>{0.532148838f, 0.635798156f},
-std::array<float,2>{0.169492617f, 0.835191548f},
-std::array<float,2>{0.923119545f, 0.177734345f},
-std::array<float,2>{0.0515727736f, 0.0766148046f},
-std::array<float,2>{0.754258811f, 0.987782359f},
-std::array<float,2>{0.345887005f, 0.583529472f},
-std::array<float,2>{0.692341447f, 0.452809185f},
-std::array<float,2>{0.266113847f, 0.209642231f},
-std::array<float,2>{0.646669269f, 0.785418212f},
-std::array<float,2>{0.0641651005f, 0.712123692f},
-std::array<float,2>{0.855181634f, 0.365892887f},
-std::array<float,2>{0.200318471f, 0.390182644f},
-std::array<float,2>{0.938879848f, 0.534306467f},
-std::array<float,2>{0.392124921f, 0.896750808f},
-std::array<float,2>{0.595384896f, 0.00138503534f},
-std::array<float,2>{0.314276993f, 0.488870025f},
-std::array<float,2>{0.748987079f, 0.610219896f},
-std::array<float,2>{0.0224116687f, 0.965443015f},
-std::array<float,2>{0.782656133f, 0.0958481133f},
-std::array<float,2>{0.125741512f, 0.126102626f},
-std::array<float,2>{0.901929021f, 0.851664662f},
-std::array<float,2>{0.487914145f, 0.685094953f},
-std::array<float,2>{0.518328965f, 0.296830565f},
-std::array<float,2>{0.414810926f, 0.0478789583f},
-std::array<float,2>{0.570152402f, 0.926553071f},
-std::array<float,2>{0.228465647f, 0.51810956f},
-std::array<float,2>{0.991292715f, 0.433131814f},
-std::array<float,2>{0.114530653f, 0.330076575f},
-std::array<float,2>{0.829460561f, 0.720116377f},
-std::array<float,2>{0.285291672f, 0.758216262f},
-std::array<float,2>{0.681130886f, 0.230321631f},
-std::array<float,2>{0.375932276f, 0.40863353f},
-std::array<float,2>{0.619730473f, 0.502773106f},
-std::array<float,2>{0.20761852f, 0.908719122f},
-std::array<float,2>{0.958041072f, 0.041228462f},
-std::array<float,2>{0.0817750245f, 0.242980614f},
-std::array<float,2>{0.868243814f, 0.772002161f},
-std::array<float,2>{0.264010996f, 0.74460125f},
-std::array<float,2>{0.630400717f, 0.313122183f},
-std::array<float,2>{0.368904382f, 0.113405183f},
-std::array<float,2>{0.705872178f, 0.940874517f},
-std::array<float,2>{0.0368585214f, 0.60852313f},
-std::array<float,2>{0.767950594f, 0.482140452f},
-std::array<float,2>{0.175775036f, 0.303288341f},
-std::array<float,2>{0.90828979f, 0.656740308f},
-std::array<float,2>{0.459182352f, 0.870538235f},
-std::array<float,2>{0.548093438f, 0.146659762f},
-std::array<float,2>{0.301371187f, 0.346797258f},
-std::array<float,2>{0.667163789f, 0.701232851f},
-std::array<float,2>{0.103837118f, 0.803965628f},
-std::array<float,2>{0.826325834f, 0.191098064f},
-std::array<float,2>{0.246754304f, 0.026067581f},
-std::array<float,2>{0.971084595f, 0.876874745f},
-std::array<float,2>{0.436557233f, 0.561238945f},
-std::array<float,2>{0.582369924f, 0.40169245f},
-std::array<float,2>{0.471254945f, 0.161994621f},
-std::array<float,2>{0.508420944f, 0.812640786f},
-std::array<float,2>{0.150748163f, 0.646374464f},
-std::array<float,2>{0.882589817f, 0.274871379f},
-std::array<float,2>{0.00266483449f, 0.461231172f},
-std::array<float,2>{0.805321395f, 0.567594469f},
-std::array<float,2>{0.339431763f, 0.97703445f},
-std::array<float,2>{0.720370471f, 0.0868651867f},
-std::array<float,2>{0.396259665f, 0.309847862f},
-std::array<float,2>{0.601553619f, 0.666837454f},
-std::array<float,2>{0.196839437f, 0.860505104f},
-std::array<float,2>{0.942335367f, 0.15069373f},
-std::array<float,2>{0.0677950531f, 0.122292422f},
-std::array<float,2>{0.857175589f, 0.951209366f},
-std::array<float,2>{0.27015233f, 0.593777955f},
-std::array<float,2>{0.642543972f, 0.473225296f},
-std::array<float,2>{0.349949956f, 0.240877256f},
-std::array<float,2>{0.688536763f, 0.774256408f},
-std::array<float,2>{0.049683556f, 0.736059308f},
-std::array<float,2>{0.752672553f, 0.323294073f},
-std::array<float,2>{0.165244609f, 0.41848731f},
-std::array<float,2>{0.928473949f, 0.512984157f},
-std::array<float,2>{0.445953578f, 0.914305627f},
-std::array<float,2>{0.538604558f, 0.0322471149f},
-std::array<float,2>{0.283155054f, 0.456114411f},
-std::array<float,2>{0.687234879f, 0.575073898f},
-std::array<float,2>{0.109409653f, 0.973043382f},
-std::array<float,2>{0.835682273f, 0.0840940401f},
-std::array<float,2>{0.234222785f, 0.171046704f},
-std::array<float,2>{0.985241473f, 0.823229611f},
-std::array<float,2>{0.419507504f, 0.651638687f},
-std::array<float,2>{0.563048363f, 0.266498387f},
-std::array<float,2>{0.490997821f, 0.0161658786f},
-std::array<float,2>{0.521539807f, 0.885911822f},
-std::array<float,2>{0.130590454f, 0.547841668f},
-std::array<float,2>{0.905444622f, 0.395241231f},
-std::array<float,2>{0.0178067666f, 0.35534513f},
-std::array<float,2>{0.788538694f, 0.695249438f},
-std::array<float,2>{0.320170969f, 0.809935987f},
-std::array<float,2>{0.744571149f, 0.200305417f},
-std::array<float,2>{0.453309983f, 0.379880786f},
-std::array<float,2>{0.552409649f, 0.546287119f},
-std::array<float,2>{0.176001132f, 0.906237781f},
-std::array<float,2>{0.910914242f, 0.0109563358f},
-std::array<float,2>{0.0321045667f, 0.211954489f},
-std::array<float,2>{0.772460938f, 0.792760551f},
-std::array<float,2>{0.374495864f, 0.70369184f},
-std::array<float,2>{0.708156049f, 0.369434744f},
-std::array<float,2>{0.259714544f, 0.0628381297f},
-std::array<float,2>{0.625635505f, 0.998884737f},
-std::array<float,2>{0.0843626633f, 0.593747556f},
-std::array<float,2>{0.873210073f, 0.439006776f},
-std::array<float,2>{0.206838995f, 0.259441495f},
-std::array<float,2>{0.956288457f, 0.631630361f},
-std::array<float,2>{0.38004303f, 0.840463459f},
-std::array<float,2>{0.624736667f, 0.183556259f},
-std::array<float,2>{0.342404455f, 0.341042995f},
-std::array<float,2>{0.724895298f, 0.728745401f},
-std::array<float,2>{0.00585425459f, 0.755594552f},
-std::array<float,2>{0.811215401f, 0.225429684f},
-std::array<float,2>{0.155890077f, 0.0579278395f},
-std::array<float,2>{0.875035942f, 0.930355906f},
-std::array<float,2>{0.473275453f, 0.529898882f},
-std::array<float,2>{0.515173316f, 0.429484129f},
-std::array<float,2>{0.433458179f, 0.136172786f},
-std::array<float,2>{0.581236959f, 0.844489992f},
-std::array<float,2>{0.243626013f, 0.67801255f},
-std::array<float,2>{0.976325274f, 0.283502042f},
-std::array<float,2>{0.107321166f, 0.493948311f},
-std::array<float,2>{0.823627293f, 0.621559024f},
-std::array<float,2>{0.297196507f, 0.95441395f},
-std::array<float,2>{0.669743538f, 0.103554823f},
-std::array<float,2>{0.477429152f, 0.360308677f},
-std::array<float,2>{0.501383662f, 0.717013776f},
-std::array<float,2>{0.144901246f, 0.782550275f},
-std::array<float,2>{0.887086213f, 0.205832168f},
-std::array<float,2>{0.0151162436f, 0.00618235953f},
-std::array<float,2>{0.799639881f, 0.893487096f},
-std::array<float,2>{0.329686373f, 0.538411856f},
-std::array<float,2>{0.727871358f, 0.385708839f},
-std::array<float,2>{0.306697071f, 0.175210655f},
-std::array<float,2>{0.656882346f, 0.830025375f},
-std::array<float,2>{0.0981281027f, 0.637023509f},
-std::array<float,2>{0.813217819f, 0.255640149f},
-std::array<float,2>{0.237524539f, 0.446271122f},
-std::array<float,2>{0.977737904f, 0.580296636f},
-std::array<float,2>{0.423976421f, 0.988303363f},
-std::array<float,2>{0.591819227f, 0.0725394487f},
-std::array<float,2>{0.362144142f, 0.435430855f},
-std::array<float,2>{0.712370634f, 0.520318508f},
-std::array<float,2>{0.0449213162f, 0.925056815f},
-std::array<float,2>{0.778407633f, 0.0534841754f},
-std::array<float,2>{0.180006817f, 0.23424308f},
-std::array<float,2>{0.915947914f, 0.764911175f},
-std::array<float,2>{0.468224078f, 0.72610724f},
-std::array<float,2>{0.556707978f, 0.334746808f},
-std::array<float,2>{0.390114248f, 0.0997846574f},
-std::array<float,2>{0.61148566f, 0.963429034f},
-std::array<float,2>{0.212854326f, 0.61508733f},
-std::array<float,2>{0.96481353f, 0.4872486f},
-std::array<float,2>{0.0870978236f, 0.292517871f},
-std::array<float,2>{0.861414135f, 0.682483137f},
-std::array<float,2>{0.257008821f, 0.859332383f},
-std::array<float,2>{0.63359946f, 0.131704316f},
-std::array<float,2>{0.409602761f, 0.478340536f},
-std::array<float,2>{0.576931834f, 0.602649689f},
-std::array<float,2>{0.225212723f, 0.944547713f},
-std::array<float,2>{0.99532485f, 0.10997761f},
-std::array<float,2>{0.119658053f, 0.141150907f},
-std::array<float,2>{0.839089036f, 0.873287618f},
-std::array<float,2>{0.29082641f, 0.661679029f},
-std::array<float,2>{0.673118591f, 0.300779045f},
-std::array<float,2>{0.326572478f, 0.0455598645f},
-std::array<float,2>{0.734665513f, 0.913441598f},
-std::array<float,2>{0.0236811731f, 0.506848514f},
-std::array<float,2>{0.796516299f, 0.412067115f},
-std::array<float,2>{0.13946946f, 0.318825811f},
-std::array<float,2>{0.897642851f, 0.747249782f},
-std::array<float,2>{0.493239254f, 0.766563177f},
-std::array<float,2>{0.526514828f, 0.247384503f},
-std::array<float,2>{0.280007541f, 0.27801761f},
-std::array<float,2>{0.649121523f, 0.642893255f},
-std::array<float,2>{0.0730253533f, 0.818851054f},
-std::array<float,2>{0.847314239f, 0.157551631f},
-std::array<float,2>{0.194562942f, 0.0914146379f},
-std::array<float,2>{0.949845314f, 0.984021962f},
-std::array<float,2>{0.401989818f, 0.564063847f},
-std::array<float,2>{0.607397914f, 0.468438059f},
-std::array<float,2>{0.439418614f, 0.191667154f},
-std::array<float,2>{0.543493152f, 0.797580242f},
-std::array<float,2>{0.16243951f, 0.695910275f},
-std::array<float,2>{0.934762001f, 0.350616962f},
-std::array<float,2>{0.0565796979f, 0.403715163f},
-std::array<float,2>{0.758074224f, 0.557067215f},
-std::array<float,2>{0.352274954f, 0.88076359f},
-std::array<float,2>{0.695639312f, 0.0287898146f},
-std::array<float,2>{0.437396824f, 0.344956547f},
-std::array<float,2>{0.582665741f, 0.699631751f},
-std::array<float,2>{0.246543676f, 0.80127728f},
-std::array<float,2>{0.971477449f, 0.187543094f},
-std::array<float,2>{0.104267716f, 0.0253891498f},
-std::array<float,2>{0.826801836f, 0.877376616f},
-std::array<float,2>{0.300920397f, 0.559327483f},
-std::array<float,2>{0.667892814f, 0.399061918f},
-std::array<float,2>{0.338937163f, 0.163867816f},
-std::array<float,2>{0.719767511f, 0.815998971f},
-std::array<float,2>{0.00208413508f, 0.647395253f},
-std::array<float,2>{0.80500257f, 0.276737928f},
-std::array<float,2>{0.151351452f, 0.464411288f},
-std::array<float,2>{0.881967902f, 0.568365455f},
-std::array<float,2>{0.470825315f, 0.97931546f},
-std::array<float,2>{0.508200049f, 0.0887206793f},
-std::array<float,2>{0.264541954f, 0.407653451f},
-std::array<float,2>{0.63030839f, 0.501338065f},
-std::array<float,2>{0.0813911036f, 0.906754971f},
-std::array<float,2>{0.868995965f, 0.0402659997f},
-std::array<float,2>{0.207433075f, 0.245376989f},
-std::array<float,2>{0.958671689f, 0.770181537f},
-std::array<float,2>{0.37533778f, 0.743173182f},
-std::array<float,2>{0.619533598f, 0.316278696f},
-std::array<float,2>{0.459498316f, 0.117052287f},
-std::array<float,2>{0.548440635f, 0.939166903f},
-std::array<float,2>{0.174846336f, 0.606150568f},
-std::array<float,2>{0.909056485f, 0.484065622f},
-std::array<float,2>{0.0364112183f, 0.302187473f},
-std::array<float,2>{0.768266022f, 0.659819305f},
-std::array<float,2>{0.368648291f, 0.86762768f},
-std::array<float,2>{0.705498099f, 0.146048069f},
-std::array<float,2>{0.487443596f, 0.491412222f},
-std::array<float,2>{0.517768502f, 0.611824572f},
-std::array<float,2>{0.12526986f, 0.968548059f},
-std::array<float,2>{0.90161854f, 0.0943413004f},
-std::array<float,2>{0.0217626188f, 0.127924353f},
-std::array<float,2>{0.782959223f, 0.853682578f},
-std::array<float,2>{0.31392011f, 0.685644031f},
-std::array<float,2>{0.748092234f, 0.293772668f},
-std::array<float,2>{0.286059886f, 0.0495343208f},
-std::array<float,2>{0.681190073f, 0.927802563f},
-std::array<float,2>{0.115040772f, 0.517364264f},
-std::array<float,2>{0.829984426f, 0.430931777f},
-std::array<float,2>{0.227741838f, 0.330166936f},
-std::array<float,2>{0.991900325f, 0.721401095f},
-std::array<float,2>{0.414394855f, 0.759879947f},
-std::array<float,2>{0.569506407f, 0.226645067f},
-std::array<float,2>{0.346364439f, 0.25033319f},
-std::array<float,2>{0.691700995f, 0.633936167f},
-std::array<float,2>{0.0508274436f, 0.832730472f},
-std::array<float,2>{0.754514217f, 0.17869328f},
-std::array<float,2>{0.169038162f, 0.0761552528f},
-std::array<float,2>{0.923607945f, 0.984845996f},
-std::array<float,2>{0.451755434f, 0.584985375f},
-std::array<float,2>{0.531428933f, 0.450070322f},
-std::array<float,2>{0.391979635f, 0.20715937f},
-std::array<float,2>{0.595080912f, 0.788291276f},
-std::array<float,2>{0.20074904f, 0.712964356f},
-std::array<float,2>{0.939091086f, 0.364870429f},
-std::array<float,2>{0.0636882409f, 0.38846156f},
-std::array<float,2>{0.854561746f, 0.532276154f},
-std::array<float,2>{0.265973687f, 0.894619107f},
-std::array<float,2>{0.647216678f, 0.00369191775f},
-std::array<float,2>{0.44435513f, 0.28783226f},
-std::array<float,2>{0.542421579f, 0.672149122f},
-std::array<float,2>{0.159102529f, 0.848614872f},
-std::array<float,2>{0.931432247f, 0.136971548f},
-std::array<float,2>{0.0589738674f, 0.107679971f},
-std::array<float,2>{0.76333189f, 0.959232152f},
-std::array<float,2>{0.356945664f, 0.620534301f},
-std::array<float,2>{0.699778855f, 0.49638018f},
-std::array<float,2>{0.276831031f, 0.22135359f},
-std::array<float,2>{0.653310895f, 0.753422916f},
-std::array<float,2>{0.0766628012f, 0.731687844f},
-std::array<float,2>{0.848849893f, 0.33619535f},
-std::array<float,2>{0.189847857f, 0.422531396f},
-std::array<float,2>{0.945929348f, 0.523953497f},
-std::array<float,2>{0.403596431f, 0.933763504f},
-std::array<float,2>{0.601576328f, 0.0596056618f},
-std::array<float,2>{0.320803702f, 0.444200277f},
-std::array<float,2>{0.741218269f, 0.588932335f},
-std::array<float,2>{0.0276365895f, 0.993644416f},
-std::array<float,2>{0.789699137f, 0.0682623312f},
-std::array<float,2>{0.13377656f, 0.184040412f},
-std::array<float,2>{0.892752409f, 0.836994946f},
-std::array<float,2>{0.497337431f, 0.627471983f},
-std::array<float,2>{0.530188203f, 0.265587866f},
-std::array<float,2>{0.412857175f, 0.0128026875f},
-std::array<float,2>{0.571441531f, 0.899777293f},
-std::array<float,2>{0.221712619f, 0.539510489f},
-std::array<float,2>{0.999494553f, 0.376906037f},
-std::array<float,2>{0.122029364f, 0.371986985f},
-std::array<float,2>{0.842838645f, 0.710444808f},
-std::array<float,2>{0.294693857f, 0.795425773f},
-std::array<float,2>{0.676817417f, 0.217389658f},
-std::array<float,2>{0.385472447f, 0.39206931f},
-std::array<float,2>{0.615279734f, 0.552271187f},
-std::array<float,2>{0.215613693f, 0.88872081f},
-std::array<float,2>{0.967547059f, 0.0216111541f},
-std::array<float,2>{0.0927456915f, 0.195410714f},
-std::array<float,2>{0.865237236f, 0.807101309f},
-std::array<float,2>{0.251655966f, 0.690511644f},
-std::array<float,2>{0.640543818f, 0.356681019f},
-std::array<float,2>{0.365422249f, 0.0795512572f},
-std::array<float,2>{0.717749596f, 0.969186187f},
-std::array<float,2>{0.0424414426f, 0.571835279f},
-std::array<float,2>{0.775477052f, 0.459338933f},
-std::array<float,2>{0.183950678f, 0.27055335f},
-std::array<float,2>{0.921247602f, 0.653826535f},
-std::array<float,2>{0.46236226f, 0.825426102f},
-std::array<float,2>{0.5594486f, 0.167902574f},
-std::array<float,2>{0.309519291f, 0.327642709f},
-std::array<float,2>{0.662585318f, 0.739841342f},
-std::array<float,2>{0.0941726416f, 0.780350029f},
-std::array<float,2>{0.819210947f, 0.23541753f},
-std::array<float,2>{0.239232615f, 0.0368124582f},
-std::array<float,2>{0.980831504f, 0.918646753f},
-std::array<float,2>{0.428709894f, 0.508248568f},
-std::array<float,2>{0.58945483f, 0.415041089f},
-std::array<float,2>{0.481940448f, 0.155683503f},
-std::array<float,2>{0.505562961f, 0.864528418f},
-std::array<float,2>{0.141594633f, 0.66985631f},
-std::array<float,2>{0.884621799f, 0.306422174f},
-std::array<float,2>{0.011086897f, 0.46939826f},
-std::array<float,2>{0.801354289f, 0.599114895f},
-std::array<float,2>{0.333313614f, 0.946529686f},
-std::array<float,2>{0.731796682f, 0.120258525f},
-std::array<float,2>{0.401493102f, 0.281036258f},
-std::array<float,2>{0.606629848f, 0.642559052f},
-std::array<float,2>{0.194909796f, 0.816523135f},
-std::array<float,2>{0.949600935f, 0.158803567f},
-std::array<float,2>{0.0725235641f, 0.0934130549f},
-std::array<float,2>{0.846769989f, 0.981471658f},
-std::array<float,2>{0.279340625f, 0.565529227f},
-std::array<float,2>{0.648891985f, 0.466685325f},
-std::array<float,2>{0.351742595f, 0.194116324f},
-std::array<float,2>{0.696211755f, 0.799051464f},
-std::array<float,2>{0.0559082329f, 0.698825002f},
-std::array<float,2>{0.758308232f, 0.348102808f},
-std::array<float,2>{0.163051993f, 0.405532151f},
-std::array<float,2>{0.935159028f, 0.556214929f},
-std::array<float,2>{0.438938618f, 0.881478965f},
-std::array<float,2>{0.54331553f, 0.030780362f},
-std::array<float,2>{0.290133506f, 0.479704082f},
-std::array<float,2>{0.673715532f, 0.604141295f},
-std::array<float,2>{0.11914748f, 0.942321599f},
-std::array<float,2>{0.839449942f, 0.111491293f},
-std::array<float,2>{0.224710956f, 0.143544748f},
-std::array<float,2>{0.995714366f, 0.872882128f},
-std::array<float,2>{0.409746259f, 0.66365546f},
-std::array<float,2>{0.576216042f, 0.297208816f},
-std::array<float,2>{0.493813485f, 0.0431440473f},
-std::array<float,2>{0.527082205f, 0.910220146f},
-std::array<float,2>{0.138774604f, 0.505028188f},
-std::array<float,2>{0.898068309f, 0.412465394f},
-std::array<float,2>{0.0243554711f, 0.318066478f},
-std::array<float,2>{0.796369195f, 0.74959892f},
-std::array<float,2>{0.326677382f, 0.769479156f},
-std::array<float,2>{0.734864533f, 0.249541521f},
-std::array<float,2>{0.468503594f, 0.436226279f},
-std::array<float,2>{0.557446301f, 0.521714747f},
-std::array<float,2>{0.180313051f, 0.923072577f},
-std::array<float,2>{0.915186048f, 0.0516017117f},
-std::array<float,2>{0.0441340134f, 0.232137516f},
-std::array<float,2>{0.779057562f, 0.762020886f},
-std::array<float,2>{0.361665815f, 0.723766208f},
-std::array<float,2>{0.712502599f, 0.333210468f},
-std::array<float,2>{0.257464021f, 0.0990569592f},
-std::array<float,2>{0.633203566f, 0.962430596f},
-std::array<float,2>{0.0878571868f, 0.616743386f},
-std::array<float,2>{0.862039566f, 0.485618323f},
-std::array<float,2>{0.21215345f, 0.289866775f},
-std::array<float,2>{0.963914514f, 0.681237578f},
-std::array<float,2>{0.390245169f, 0.857301056f},
-std::array<float,2>{0.611882627f, 0.130823329f},
-std::array<float,2>{0.329143375f, 0.36258629f},
-std::array<float,2>{0.728039503f, 0.715219498f},
-std::array<float,2>{0.0151398685f, 0.783478677f},
-std::array<float,2>{0.79889828f, 0.204098612f},
-std::array<float,2>{0.145161599f, 0.00432045711f},
-std::array<float,2>{0.887221992f, 0.890667021f},
-std::array<float,2>{0.47696653f, 0.536663294f},
-std::array<float,2>{0.501532793f, 0.383267403f},
-std::array<float,2>{0.424785882f, 0.173796758f},
-std::array<float,2>{0.592408836f, 0.830167055f},
-std::array<float,2>{0.238097504f, 0.639352739f},
-std::array<float,2>{0.978089213f, 0.256548315f},
-std::array<float,2>{0.0982425734f, 0.448629856f},
-std::array<float,2>{0.812984049f, 0.580021977f},
-std::array<float,2>{0.307430744f, 0.99048233f},
-std::array<float,2>{0.656592965f, 0.0715295747f},
-std::array<float,2>{0.472898662f, 0.34188655f},
-std::array<float,2>{0.514962256f, 0.727506697f},
-std::array<float,2>{0.155529484f, 0.756406128f},
-std::array<float,2>{0.875609815f, 0.224299744f},
-std::array<float,2>{0.0049829497f, 0.0560238175f},
-std::array<float,2>{0.810845733f, 0.933050811f},
-std::array<float,2>{0.342160106f, 0.52829057f},
-std::array<float,2>{0.725480258f, 0.426525056f},
-std::array<float,2>{0.297638267f, 0.133804321f},
-std::array<float,2>{0.669020534f, 0.846398115f},
-std::array<float,2>{0.106820613f, 0.676489711f},
-std::array<float,2>{0.823895574f, 0.282010227f},
-std::array<float,2>{0.243851379f, 0.494792491f},
-std::array<float,2>{0.975623846f, 0.623513222f},
-std::array<float,2>{0.432730645f, 0.955431283f},
-std::array<float,2>{0.581849456f, 0.103002489f},
-std::array<float,2>{0.374934316f, 0.381606907f},
-std::array<float,2>{0.708538175f, 0.543700814f},
-std::array<float,2>{0.0316913649f, 0.903834522f},
-std::array<float,2>{0.771879256f, 0.00925383251f},
-std::array<float,2>{0.176295817f, 0.213958934f},
-std::array<float,2>{0.910216987f, 0.790301383f},
-std::array<float,2>{0.453695387f, 0.70541501f},
-std::array<float,2>{0.551893651f, 0.368020117f},
-std::array<float,2>{0.380825907f, 0.0644562468f},
-std::array<float,2>{0.624046743f, 0.997430742f},
-std::array<float,2>{0.206350878f, 0.591087878f},
-std::array<float,2>{0.956572652f, 0.44127965f},
-std::array<float,2>{0.0849442258f, 0.261380017f},
-std::array<float,2>{0.873885691f, 0.629086912f},
-std::array<float,2>{0.259193093f, 0.843654573f},
-std::array<float,2>{0.62503022f, 0.181335554f},
-std::array<float,2>{0.419008851f, 0.453255147f},
-std::array<float,2>{0.562623978f, 0.577258825f},
-std::array<float,2>{0.233882859f, 0.976282537f},
-std::array<float,2>{0.98476243f, 0.0820826516f},
-std::array<float,2>{0.109984219f, 0.16855526f},
-std::array<float,2>{0.835037708f, 0.821185052f},
-std::array<float,2>{0.282300144f, 0.649751663f},
-std::array<float,2>{0.687000751f, 0.268571049f},
-std::array<float,2>{0.319435626f, 0.0193027239f},
-std::array<float,2>{0.744716287f, 0.883232534f},
-std::array<float,2>{0.018395748f, 0.55036211f},
-std::array<float,2>{0.788859487f, 0.397321135f},
-std::array<float,2>{0.130188182f, 0.352558196f},
-std::array<float,2>{0.906024277f, 0.691935301f},
-std::array<float,2>{0.490487605f, 0.812142015f},
-std::array<float,2>{0.522260129f, 0.202464879f},
-std::array<float,2>{0.269541204f, 0.311407834f},
-std::array<float,2>{0.641681135f, 0.665100932f},
-std::array<float,2>{0.0680548251f, 0.863179386f},
-std::array<float,2>{0.856718302f, 0.149342075f},
-std::array<float,2>{0.19668965f, 0.124007434f},
-std::array<float,2>{0.941569865f, 0.949625552f},
-std::array<float,2>{0.395831376f, 0.596163869f},
-std::array<float,2>{0.600754857f, 0.474904716f},
-std::array<float,2>{0.445389122f, 0.239587724f},
-std::array<float,2>{0.538270235f, 0.775906205f},
-std::array<float,2>{0.165914893f, 0.736918688f},
-std::array<float,2>{0.928060353f, 0.321276128f},
-std::array<float,2>{0.0492887683f, 0.421035677f},
-std::array<float,2>{0.752427757f, 0.513922215f},
-std::array<float,2>{0.350244761f, 0.917571068f},
-std::array<float,2>{0.689135194f, 0.0347325206f},
-std::array<float,2>{0.378470123f, 0.312802941f},
-std::array<float,2>{0.617655098f, 0.745096445f},
-std::array<float,2>{0.210292116f, 0.771558285f},
-std::array<float,2>{0.959720612f, 0.242633075f},
-std::array<float,2>{0.0790678114f, 0.0416627042f},
-std::array<float,2>{0.869274259f, 0.9086321f},
-std::array<float,2>{0.263354778f, 0.502209842f},
-std::array<float,2>{0.632384717f, 0.408819258f},
-std::array<float,2>{0.37024942f, 0.147350505f},
-std::array<float,2>{0.703703046f, 0.870616615f},
-std::array<float,2>{0.0374634899f, 0.656621814f},
-std::array<float,2>{0.766034663f, 0.30318743f},
-std::array<float,2>{0.172125891f, 0.481799871f},
-std::array<float,2>{0.906570137f, 0.609126031f},
-std::array<float,2>{0.458435535f, 0.940930307f},
-std::array<float,2>{0.550484061f, 0.114241406f},
-std::array<float,2>{0.304554015f, 0.401951462f},
-std::array<float,2>{0.66428405f, 0.560857475f},
-std::array<float,2>{0.102283783f, 0.876246691f},
-std::array<float,2>{0.825591922f, 0.025521094f},
-std::array<float,2>{0.249133453f, 0.190889999f},
-std::array<float,2>{0.970668495f, 0.804554105f},
-std::array<float,2>{0.434691668f, 0.701932192f},
-std::array<float,2>{0.585436046f, 0.34765175f},
-std::array<float,2>{0.469212115f, 0.0862707049f},
-std::array<float,2>{0.511468172f, 0.977199733f},
-std::array<float,2>{0.148798153f, 0.56819278f},
-std::array<float,2>{0.879168212f, 0.461895257f},
-std::array<float,2>{0.00192726043f, 0.275370151f},
-std::array<float,2>{0.807030618f, 0.645840526f},
-std::array<float,2>{0.337630689f, 0.813190818f},
-std::array<float,2>{0.721914947f, 0.161514029f},
-std::array<float,2>{0.450813651f, 0.45223394f},
-std::array<float,2>{0.533875346f, 0.58343637f},
-std::array<float,2>{0.171329468f, 0.98781383f},
-std::array<float,2>{0.924336553f, 0.0769706443f},
-std::array<float,2>{0.0532341674f, 0.177023217f},
-std::array<float,2>{0.756763816f, 0.835870445f},
-std::array<float,2>{0.345576584f, 0.636410177f},
-std::array<float,2>{0.693781018f, 0.252986938f},
-std::array<float,2>{0.267873317f, 0.00176301866f},
-std::array<float,2>{0.646361828f, 0.897337437f},
-std::array<float,2>{0.0649585202f, 0.535051644f},
-std::array<float,2>{0.852841675f, 0.389674306f},
-std::array<float,2>{0.201400459f, 0.36565423f},
-std::array<float,2>{0.941085935f, 0.712814867f},
-std::array<float,2>{0.394002467f, 0.786110699f},
-std::array<float,2>{0.596478522f, 0.209111959f},
-std::array<float,2>{0.314617544f, 0.29603526f},
-std::array<float,2>{0.746876895f, 0.684784651f},
-std::array<float,2>{0.019837385f, 0.852263987f},
-std::array<float,2>{0.78388387f, 0.126530468f},
-std::array<float,2>{0.126996636f, 0.0964353904f},
-std::array<float,2>{0.900168717f, 0.965047956f},
-std::array<float,2>{0.485360622f, 0.60984695f},
-std::array<float,2>{0.516906023f, 0.48851341f},
-std::array<float,2>{0.416527689f, 0.229743153f},
-std::array<float,2>{0.567480147f, 0.758498967f},
-std::array<float,2>{0.22902374f, 0.720327318f},
-std::array<float,2>{0.989240766f, 0.32953611f},
-std::array<float,2>{0.117023736f, 0.432624459f},
-std::array<float,2>{0.831492066f, 0.517646074f},
-std::array<float,2>{0.287916839f, 0.926136911f},
-std::array<float,2>{0.683062673f, 0.0487333946f},
-std::array<float,2>{0.499344856f, 0.26365751f},
-std::array<float,2>{0.528945386f, 0.626080692f},
-std::array<float,2>{0.135910571f, 0.839273393f},
-std::array<float,2>{0.892353415f, 0.186585709f},
-std::array<float,2>{0.0296327174f, 0.0689447001f},
-std::array<float,2>{0.792844594f, 0.995124102f},
-std::array<float,2>{0.324012786f, 0.586835802f},
-std::array<float,2>{0.739467561f, 0.442955554f},
-std::array<float,2>{0.295577496f, 0.215377256f},
-std::array<float,2>{0.678077221f, 0.793895483f},
-std::array<float,2>{0.123768345f, 0.707397282f},
-std::array<float,2>{0.84144628f, 0.374812216f},
-std::array<float,2>{0.21996671f, 0.377184898f},
-std::array<float,2>{0.99730128f, 0.542842388f},
-std::array<float,2>{0.412066698f, 0.901070833f},
-std::array<float,2>{0.573466718f, 0.0143620353f},
-std::array<float,2>{0.357819647f, 0.49899435f},
-std::array<float,2>{0.701874197f, 0.618433118f},
-std::array<float,2>{0.060841497f, 0.958639681f},
-std::array<float,2>{0.764012039f, 0.106146462f},
-std::array<float,2>{0.156480849f, 0.139187187f},
-std::array<float,2>{0.933070719f, 0.851556301f},
-std::array<float,2>{0.442604959f, 0.674752593f},
-std::array<float,2>{0.539401114f, 0.286260486f},
-std::array<float,2>{0.404360741f, 0.0613956749f},
-std::array<float,2>{0.603528202f, 0.936512351f},
-std::array<float,2>{0.188365266f, 0.526489258f},
-std::array<float,2>{0.947989345f, 0.424188316f},
-std::array<float,2>{0.0745254233f, 0.338783085f},
-std::array<float,2>{0.850602329f, 0.733897984f},
-std::array<float,2>{0.273732245f, 0.75061065f},
-std::array<float,2>{0.654482126f, 0.219507903f},
-std::array<float,2>{0.425942838f, 0.416351199f},
-std::array<float,2>{0.58692503f, 0.51155889f},
-std::array<float,2>{0.241678089f, 0.9209764f},
-std::array<float,2>{0.98366487f, 0.0373958424f},
-std::array<float,2>{0.0958474278f, 0.237525627f},
-std::array<float,2>{0.817877829f, 0.77890569f},
-std::array<float,2>{0.311463892f, 0.741163373f},
-std::array<float,2>{0.660372853f, 0.325511217f},
-std::array<float,2>{0.335913032f, 0.117698595f},
-std::array<float,2>{0.732739151f, 0.947969377f},
-std::array<float,2>{0.00903998781f, 0.601525307f},
-std::array<float,2>{0.803610861f, 0.470736295f},
-std::array<float,2>{0.144135281f, 0.307509243f},
-std::array<float,2>{0.886641741f, 0.671015441f},
-std::array<float,2>{0.482632369f, 0.866007268f},
-std::array<float,2>{0.507376373f, 0.154156476f},
-std::array<float,2>{0.251973718f, 0.358760178f},
-std::array<float,2>{0.638338745f, 0.689112902f},
-std::array<float,2>{0.0917851701f, 0.804758728f},
-std::array<float,2>{0.863696516f, 0.19737643f},
-std::array<float,2>{0.217466414f, 0.0200576354f},
-std::array<float,2>{0.966475189f, 0.887175083f},
-std::array<float,2>{0.383514762f, 0.554347456f},
-std::array<float,2>{0.613849223f, 0.393685669f},
-std::array<float,2>{0.464180917f, 0.165993258f},
-std::array<float,2>{0.562436223f, 0.826847911f},
-std::array<float,2>{0.185969546f, 0.654304206f},
-std::array<float,2>{0.919877768f, 0.27154386f},
-std::array<float,2>{0.0392906442f, 0.458708972f},
-std::array<float,2>{0.77387768f, 0.573139787f},
-std::array<float,2>{0.36514172f, 0.971255898f},
-std::array<float,2>{0.715649843f, 0.0813346282f},
-std::array<float,2>{0.407794476f, 0.299955487f},
-std::array<float,2>{0.574409127f, 0.661493421f},
-std::array<float,2>{0.223401695f, 0.873953164f},
-std::array<float,2>{0.993304431f, 0.140922472f},
-std::array<float,2>{0.118954763f, 0.109388158f},
-std::array<float,2>{0.837750316f, 0.944973648f},
-std::array<float,2>{0.291345686f, 0.603418708f},
-std::array<float,2>{0.674463272f, 0.477684766f},
-std::array<float,2>{0.325121224f, 0.247779548f},
-std::array<float,2>{0.737262249f, 0.765739977f},
-std::array<float,2>{0.0254695565f, 0.747863948f},
-std::array<float,2>{0.793220341f, 0.318945289f},
-std::array<float,2>{0.138292775f, 0.411292136f},
-std::array<float,2>{0.896147251f, 0.507443845f},
-std::array<float,2>{0.494475096f, 0.913860798f},
-std::array<float,2>{0.523875892f, 0.0453121476f},
-std::array<float,2>{0.277576923f, 0.46782583f},
-std::array<float,2>{0.651857615f, 0.563734651f},
-std::array<float,2>{0.0719700828f, 0.983445764f},
-std::array<float,2>{0.843871176f, 0.0910624489f},
-std::array<float,2>{0.192652956f, 0.157917321f},
-std::array<float,2>{0.951328576f, 0.818519294f},
-std::array<float,2>{0.40009439f, 0.643553317f},
-std::array<float,2>{0.608166337f, 0.277505606f},
-std::array<float,2>{0.44099018f, 0.0289598778f},
-std::array<float,2>{0.54618758f, 0.880086184f},
-std::array<float,2>{0.161869019f, 0.557210565f},
-std::array<float,2>{0.935943305f, 0.403824717f},
-std::array<float,2>{0.0569833405f, 0.351340473f},
-std::array<float,2>{0.761086524f, 0.695716381f},
-std::array<float,2>{0.35368216f, 0.797141016f},
-std::array<float,2>{0.69753468f, 0.192008361f},
-std::array<float,2>{0.479532361f, 0.385193348f},
-std::array<float,2>{0.503347397f, 0.539010227f},
-std::array<float,2>{0.147862881f, 0.892839193f},
-std::array<float,2>{0.889685452f, 0.00640346948f},
-std::array<float,2>{0.0125276158f, 0.205167025f},
-std::array<float,2>{0.798403382f, 0.782772899f},
-std::array<float,2>{0.331750095f, 0.717430711f},
-std::array<float,2>{0.730102122f, 0.359712273f},
-std::array<float,2>{0.305062264f, 0.0728203803f},
-std::array<float,2>{0.658663929f, 0.988830566f},
-std::array<float,2>{0.101186186f, 0.580741405f},
-std::array<float,2>{0.814626575f, 0.445732623f},
-std::array<float,2>{0.234376863f, 0.255295008f},
-std::array<float,2>{0.979254186f, 0.637227535f},
-std::array<float,2>{0.422684312f, 0.829246223f},
-std::array<float,2>{0.5912202f, 0.17566663f},
-std::array<float,2>{0.360626787f, 0.334182143f},
-std::array<float,2>{0.713626027f, 0.725971401f},
-std::array<float,2>{0.0456060767f, 0.765163064f},
-std::array<float,2>{0.78072679f, 0.233398512f},
-std::array<float,2>{0.183077946f, 0.0528535657f},
-std::array<float,2>{0.917927146f, 0.925525904f},
-std::array<float,2>{0.466219246f, 0.51983583f},
-std::array<float,2>{0.555202782f, 0.434621751f},
-std::array<float,2>{0.388356566f, 0.131156608f},
-std::array<float,2>{0.609914422f, 0.858561337f},
-std::array<float,2>{0.214376882f, 0.682111502f},
-std::array<float,2>{0.961885929f, 0.292189896f},
-std::array<float,2>{0.0887779444f, 0.486625969f},
-std::array<float,2>{0.860158801f, 0.614665091f},
-std::array<float,2>{0.255621225f, 0.963263929f},
-std::array<float,2>{0.634940565f, 0.100178152f},
-std::array<float,2>{0.456234783f, 0.369870692f},
-std::array<float,2>{0.552865565f, 0.703553915f},
-std::array<float,2>{0.179676399f, 0.79236424f},
-std::array<float,2>{0.913861096f, 0.212530553f},
-std::array<float,2>{0.034029942f, 0.01150948f},
-std::array<float,2>{0.770341635f, 0.905663311f},
-std::array<float,2>{0.37273708f, 0.546806931f},
-std::array<float,2>{0.709398389f, 0.379000276f},
-std::array<float,2>{0.260370463f, 0.183049396f},
-std::array<float,2>{0.628111839f, 0.840075314f},
-std::array<float,2>{0.0832955837f, 0.631206989f},
-std::array<float,2>{0.871765912f, 0.259206444f},
-std::array<float,2>{0.203728408f, 0.438754886f},
-std::array<float,2>{0.954297483f, 0.593180418f},
-std::array<float,2>{0.381576538f, 0.998391211f},
-std::array<float,2>{0.621560276f, 0.0633765683f},
-std::array<float,2>{0.340990305f, 0.428905845f},
-std::array<float,2>{0.722804427f, 0.529463887f},
-std::array<float,2>{0.00666006375f, 0.929961026f},
-std::array<float,2>{0.809111834f, 0.0585739724f},
-std::array<float,2>{0.153831095f, 0.224807158f},
-std::array<float,2>{0.877516389f, 0.755280018f},
-std::array<float,2>{0.475023657f, 0.72934854f},
-std::array<float,2>{0.513573349f, 0.341720581f},
-std::array<float,2>{0.430308372f, 0.104016922f},
-std::array<float,2>{0.578998029f, 0.95500797f},
-std::array<float,2>{0.24467434f, 0.62169838f},
-std::array<float,2>{0.972886086f, 0.493537933f},
-std::array<float,2>{0.109333925f, 0.283691734f},
-std::array<float,2>{0.821393251f, 0.678372502f},
-std::array<float,2>{0.299549758f, 0.84408921f},
-std::array<float,2>{0.671281576f, 0.136514202f},
-std::array<float,2>{0.398312658f, 0.473122597f},
-std::array<float,2>{0.599056065f, 0.594420612f},
-std::array<float,2>{0.198505253f, 0.951681256f},
-std::array<float,2>{0.943451166f, 0.122740015f},
-std::array<float,2>{0.0688635558f, 0.151156038f},
-std::array<float,2>{0.858719647f, 0.861318588f},
-std::array<float,2>{0.272200644f, 0.66620332f},
-std::array<float,2>{0.643068492f, 0.310239911f},
-std::array<float,2>{0.34868148f, 0.0328312665f},
-std::array<float,2>{0.691187799f, 0.915036619f},
-std::array<float,2>{0.0487405322f, 0.513604224f},
-std::array<float,2>{0.750618935f, 0.418453544f},
-std::array<float,2>{0.167188153f, 0.323839813f},
-std::array<float,2>{0.927060843f, 0.735674381f},
-std::array<float,2>{0.448941439f, 0.773541868f},
-std::array<float,2>{0.535431385f, 0.240418658f},
-std::array<float,2>{0.284657687f, 0.265917182f},
-std::array<float,2>{0.68425262f, 0.652106464f},
-std::array<float,2>{0.113071553f, 0.822606444f},
-std::array<float,2>{0.832450688f, 0.171689078f},
-std::array<float,2>{0.231532604f, 0.0846959874f},
-std::array<float,2>{0.987146676f, 0.973424196f},
-std::array<float,2>{0.421265841f, 0.574328661f},
-std::array<float,2>{0.565697968f, 0.456576139f},
-std::array<float,2>{0.489241838f, 0.201038137f},
-std::array<float,2>{0.520613313f, 0.81031996f},
-std::array<float,2>{0.132796705f, 0.694473922f},
-std::array<float,2>{0.903208613f, 0.354528785f},
-std::array<float,2>{0.0170320477f, 0.394563854f},
-std::array<float,2>{0.786962569f, 0.547089994f},
-std::array<float,2>{0.317015827f, 0.886386216f},
-std::array<float,2>{0.742631733f, 0.0157740135f},
-std::array<float,2>{0.393301666f, 0.363761514f},
-std::array<float,2>{0.596692383f, 0.71388185f},
-std::array<float,2>{0.202940166f, 0.787284672f},
-std::array<float,2>{0.939708412f, 0.208713502f},
-std::array<float,2>{0.0663038194f, 0.00200408068f},
-std::array<float,2>{0.852100909f, 0.89643538f},
-std::array<float,2>{0.268679887f, 0.532033801f},
-std::array<float,2>{0.645026207f, 0.387204051f},
-std::array<float,2>{0.343925148f, 0.179059058f},
-std::array<float,2>{0.69456917f, 0.833074749f},
-std::array<float,2>{0.0544465482f, 0.633440495f},
-std::array<float,2>{0.757232308f, 0.251767337f},
-std::array<float,2>{0.170289695f, 0.450473726f},
-std::array<float,2>{0.925200701f, 0.58449024f},
-std::array<float,2>{0.450187504f, 0.986205876f},
-std::array<float,2>{0.534850776f, 0.0742661282f},
-std::array<float,2>{0.288643748f, 0.429803818f},
-std::array<float,2>{0.681949556f, 0.516369224f},
-std::array<float,2>{0.115959361f, 0.928718626f},
-std::array<float,2>{0.830335855f, 0.0507609956f},
-std::array<float,2>{0.230281144f, 0.227554962f},
-std::array<float,2>{0.990072489f, 0.760811627f},
-std::array<float,2>{0.417808354f, 0.722645402f},
-std::array<float,2>{0.56686002f, 0.331873804f},
-std::array<float,2>{0.484702826f, 0.0955949947f},
-std::array<float,2>{0.516311228f, 0.967481792f},
-std::array<float,2>{0.128890276f, 0.61232847f},
-std::array<float,2>{0.898509085f, 0.490729004f},
-std::array<float,2>{0.0211160108f, 0.294210017f},
-std::array<float,2>{0.785039663f, 0.68733263f},
-std::array<float,2>{0.316018611f, 0.855376065f},
-std::array<float,2>{0.747815847f, 0.127930462f},
-std::array<float,2>{0.457993537f, 0.482494146f},
-std::array<float,2>{0.548994899f, 0.606580853f},
-std::array<float,2>{0.172981218f, 0.938005567f},
-std::array<float,2>{0.90788269f, 0.115810469f},
-std::array<float,2>{0.0384006761f, 0.144652933f},
-std::array<float,2>{0.767432153f, 0.868703604f},
-std::array<float,2>{0.369942904f, 0.658360064f},
-std::array<float,2>{0.704678535f, 0.301603138f},
-std::array<float,2>{0.262364805f, 0.0394221433f},
-std::array<float,2>{0.631100237f, 0.908023119f},
-std::array<float,2>{0.0798738673f, 0.500279963f},
-std::array<float,2>{0.87018919f, 0.406816781f},
-std::array<float,2>{0.20906736f, 0.315048158f},
-std::array<float,2>{0.960832834f, 0.742961168f},
-std::array<float,2>{0.377856702f, 0.77092272f},
-std::array<float,2>{0.618757784f, 0.244640917f},
-std::array<float,2>{0.336876065f, 0.276272446f},
-std::array<float,2>{0.720934808f, 0.64790684f},
-std::array<float,2>{0.000815968786f, 0.815156102f},
-std::array<float,2>{0.808101058f, 0.162264362f},
-std::array<float,2>{0.149778634f, 0.0893613175f},
-std::array<float,2>{0.880331099f, 0.979860604f},
-std::array<float,2>{0.47013101f, 0.569485664f},
-std::array<float,2>{0.510459065f, 0.463254392f},
-std::array<float,2>{0.43419832f, 0.189354718f},
-std::array<float,2>{0.584119976f, 0.801990151f},
-std::array<float,2>{0.248903722f, 0.700515568f},
-std::array<float,2>{0.96912235f, 0.344623387f},
-std::array<float,2>{0.102894388f, 0.399809808f},
-std::array<float,2>{0.824665904f, 0.559618235f},
-std::array<float,2>{0.30357638f, 0.878116667f},
-std::array<float,2>{0.665928662f, 0.0234743208f},
-std::array<float,2>{0.483942002f, 0.305341721f},
-std::array<float,2>{0.506643593f, 0.668944001f},
-std::array<float,2>{0.143181771f, 0.863868117f},
-std::array<float,2>{0.885476768f, 0.15517509f},
-std::array<float,2>{0.00821390655f, 0.119521365f},
-std::array<float,2>{0.803745449f, 0.945934176f},
-std::array<float,2>{0.334755421f, 0.598070741f},
-std::array<float,2>{0.734367549f, 0.470400155f},
-std::array<float,2>{0.312109202f, 0.235134333f},
-std::array<float,2>{0.661371529f, 0.779439032f},
-std::array<float,2>{0.097289592f, 0.738689184f},
-std::array<float,2>{0.817206681f, 0.32631883f},
-std::array<float,2>{0.241124406f, 0.414705634f},
-std::array<float,2>{0.982572675f, 0.509659648f},
-std::array<float,2>{0.427725494f, 0.919780254f},
-std::array<float,2>{0.586471558f, 0.0353234299f},
-std::array<float,2>{0.363916606f, 0.460594356f},
-std::array<float,2>{0.716477692f, 0.570410967f},
-std::array<float,2>{0.0404118858f, 0.970574319f},
-std::array<float,2>{0.774468005f, 0.0785334483f},
-std::array<float,2>{0.186542779f, 0.166551575f},
-std::array<float,2>{0.918598175f, 0.82514596f},
-std::array<float,2>{0.463175178f, 0.652505696f},
-std::array<float,2>{0.561396897f, 0.27018705f},
-std::array<float,2>{0.384317964f, 0.0230404437f},
-std::array<float,2>{0.614367485f, 0.890382946f},
-std::array<float,2>{0.218617052f, 0.550888836f},
-std::array<float,2>{0.965440691f, 0.390795439f},
-std::array<float,2>{0.0901264548f, 0.356261224f},
-std::array<float,2>{0.864290476f, 0.69020623f},
-std::array<float,2>{0.25361973f, 0.808339953f},
-std::array<float,2>{0.636973858f, 0.196776256f},
-std::array<float,2>{0.410806566f, 0.375535935f},
-std::array<float,2>{0.572726548f, 0.540714681f},
-std::array<float,2>{0.219152033f, 0.89927727f},
-std::array<float,2>{0.996315002f, 0.0122475028f},
-std::array<float,2>{0.124166906f, 0.218000725f},
-std::array<float,2>{0.840337098f, 0.796373725f},
-std::array<float,2>{0.296608746f, 0.709668577f},
-std::array<float,2>{0.679096222f, 0.372268289f},
-std::array<float,2>{0.322756827f, 0.067171298f},
-std::array<float,2>{0.73878628f, 0.993003547f},
-std::array<float,2>{0.030900158f, 0.588460803f},
-std::array<float,2>{0.791808546f, 0.444646716f},
-std::array<float,2>{0.135741755f, 0.264606327f},
-std::array<float,2>{0.891556978f, 0.628272772f},
-std::array<float,2>{0.49812302f, 0.836089194f},
-std::array<float,2>{0.528025508f, 0.185498148f},
-std::array<float,2>{0.275045753f, 0.337235004f},
-std::array<float,2>{0.656196058f, 0.731309891f},
-std::array<float,2>{0.0760003403f, 0.752866924f},
-std::array<float,2>{0.85005039f, 0.222515672f},
-std::array<float,2>{0.189007729f, 0.058614932f},
-std::array<float,2>{0.949054956f, 0.935102761f},
-std::array<float,2>{0.405784905f, 0.525162578f},
-std::array<float,2>{0.604614198f, 0.423329562f},
-std::array<float,2>{0.441856205f, 0.13788867f},
-std::array<float,2>{0.540320218f, 0.849173307f},
-std::array<float,2>{0.157861844f, 0.67310816f},
-std::array<float,2>{0.932563782f, 0.28885439f},
-std::array<float,2>{0.0615585372f, 0.49743852f},
-std::array<float,2>{0.76515919f, 0.619814217f},
-std::array<float,2>{0.358487993f, 0.960825622f},
-std::array<float,2>{0.702862144f, 0.108573355f},
-std::array<float,2>{0.423165113f, 0.257026076f},
-std::array<float,2>{0.589908183f, 0.640180409f},
-std::array<float,2>{0.236204177f, 0.83116734f},
-std::array<float,2>{0.979742229f, 0.172143251f},
-std::array<float,2>{0.10002172f, 0.0703765452f},
-std::array<float,2>{0.815864623f, 0.991579175f},
-std::array<float,2>{0.306055754f, 0.578939736f},
-std::array<float,2>{0.659685016f, 0.447281182f},
-std::array<float,2>{0.330504477f, 0.20413433f},
-std::array<float,2>{0.728686035f, 0.784757257f},
-std::array<float,2>{0.0134172849f, 0.716293693f},
-std::array<float,2>{0.797298431f, 0.3614088f},
-std::array<float,2>{0.146938547f, 0.384698302f},
-std::array<float,2>{0.888863981f, 0.536114991f},
-std::array<float,2>{0.478803068f, 0.892296195f},
-std::array<float,2>{0.502577782f, 0.00493498705f},
-std::array<float,2>{0.253956348f, 0.484429508f},
-std::array<float,2>{0.636493146f, 0.615661263f},
-std::array<float,2>{0.0894767344f, 0.961077452f},
-std::array<float,2>{0.860932648f, 0.0977679789f},
-std::array<float,2>{0.213581026f, 0.129868627f},
-std::array<float,2>{0.962023675f, 0.855822384f},
-std::array<float,2>{0.386876702f, 0.679876566f},
-std::array<float,2>{0.611221731f, 0.290301204f},
-std::array<float,2>{0.465293884f, 0.0524960756f},
-std::array<float,2>{0.556533158f, 0.922262192f},
-std::array<float,2>{0.182179123f, 0.522900164f},
-std::array<float,2>{0.91637969f, 0.43749094f},
-std::array<float,2>{0.0467799567f, 0.332649499f},
-std::array<float,2>{0.780200779f, 0.722806573f},
-std::array<float,2>{0.360345125f, 0.763323486f},
-std::array<float,2>{0.714336336f, 0.231400937f},
-std::array<float,2>{0.495428413f, 0.413253874f},
-std::array<float,2>{0.524553597f, 0.504331231f},
-std::array<float,2>{0.137088239f, 0.911407888f},
-std::array<float,2>{0.895292342f, 0.0440466404f},
-std::array<float,2>{0.0269859135f, 0.248322055f},
-std::array<float,2>{0.794061601f, 0.767647445f},
-std::array<float,2>{0.325353891f, 0.748059809f},
-std::array<float,2>{0.737921417f, 0.316871017f},
-std::array<float,2>{0.292667359f, 0.112847514f},
-std::array<float,2>{0.675403237f, 0.942842841f},
-std::array<float,2>{0.117671609f, 0.604727924f},
-std::array<float,2>{0.836675346f, 0.478858143f},
-std::array<float,2>{0.22375384f, 0.298708439f},
-std::array<float,2>{0.992278159f, 0.662987769f},
-std::array<float,2>{0.406677276f, 0.872054219f},
-std::array<float,2>{0.575769067f, 0.144520357f},
-std::array<float,2>{0.35479629f, 0.349387825f},
-std::array<float,2>{0.698436499f, 0.697770894f},
-std::array<float,2>{0.0581760332f, 0.800467491f},
-std::array<float,2>{0.760489285f, 0.194847971f},
-std::array<float,2>{0.16080761f, 0.0297490209f},
-std::array<float,2>{0.937173367f, 0.882594109f},
-std::array<float,2>{0.44011122f, 0.555438578f},
-std::array<float,2>{0.545725584f, 0.404802233f},
-std::array<float,2>{0.398481727f, 0.159239054f},
-std::array<float,2>{0.608846366f, 0.81746918f},
-std::array<float,2>{0.191828564f, 0.640696228f},
-std::array<float,2>{0.952377975f, 0.279751539f},
-std::array<float,2>{0.0707941279f, 0.465673357f},
-std::array<float,2>{0.845326543f, 0.564883411f},
-std::array<float,2>{0.278526008f, 0.980881155f},
-std::array<float,2>{0.650724292f, 0.0919101089f},
-std::array<float,2>{0.447681457f, 0.321695507f},
-std::array<float,2>{0.536162496f, 0.738170087f},
-std::array<float,2>{0.166816711f, 0.776535273f},
-std::array<float,2>{0.926356971f, 0.238387585f},
-std::array<float,2>{0.0476282872f, 0.0336426236f},
-std::array<float,2>{0.751110375f, 0.916279018f},
-std::array<float,2>{0.348133415f, 0.515530348f},
-std::array<float,2>{0.689932048f, 0.420166224f},
-std::array<float,2>{0.27287218f, 0.15011619f},
-std::array<float,2>{0.644495964f, 0.861995101f},
-std::array<float,2>{0.0696438551f, 0.664241314f},
-std::array<float,2>{0.858017385f, 0.311896563f},
-std::array<float,2>{0.197330847f, 0.475725919f},
-std::array<float,2>{0.944425941f, 0.596889138f},
-std::array<float,2>{0.396828204f, 0.951171041f},
-std::array<float,2>{0.597671449f, 0.124807663f},
-std::array<float,2>{0.317550451f, 0.398434788f},
-std::array<float,2>{0.743763089f, 0.549721241f},
-std::array<float,2>{0.0156938192f, 0.884319782f},
-std::array<float,2>{0.786108851f, 0.0180031862f},
-std::array<float,2>{0.131175607f, 0.201924086f},
-std::array<float,2>{0.904268622f, 0.81119442f},
-std::array<float,2>{0.489437222f, 0.693300903f},
-std::array<float,2>{0.520120084f, 0.351898253f},
-std::array<float,2>{0.420823753f, 0.0836902559f},
-std::array<float,2>{0.564538181f, 0.975561559f},
-std::array<float,2>{0.23108685f, 0.576426029f},
-std::array<float,2>{0.987754762f, 0.45498395f},
-std::array<float,2>{0.111484542f, 0.267861575f},
-std::array<float,2>{0.833749354f, 0.648472369f},
-std::array<float,2>{0.283311546f, 0.821941555f},
-std::array<float,2>{0.684916735f, 0.169052482f},
-std::array<float,2>{0.382090777f, 0.440313935f},
-std::array<float,2>{0.622305393f, 0.590374589f},
-std::array<float,2>{0.204845414f, 0.99647975f},
-std::array<float,2>{0.954070687f, 0.0662622526f},
-std::array<float,2>{0.0820505843f, 0.1806591f},
-std::array<float,2>{0.872973382f, 0.842065454f},
-std::array<float,2>{0.261370301f, 0.630452752f},
-std::array<float,2>{0.627641678f, 0.259872109f},
-std::array<float,2>{0.371278107f, 0.00801684987f},
-std::array<float,2>{0.710442901f, 0.902704537f},
-std::array<float,2>{0.0348720774f, 0.544832468f},
-std::array<float,2>{0.77128166f, 0.382731408f},
-std::array<float,2>{0.178629607f, 0.368239999f},
-std::array<float,2>{0.912318528f, 0.706484139f},
-std::array<float,2>{0.455309749f, 0.789889097f},
-std::array<float,2>{0.554467857f, 0.212920099f},
-std::array<float,2>{0.300225705f, 0.282241225f},
-std::array<float,2>{0.67045778f, 0.676867306f},
-std::array<float,2>{0.108228453f, 0.846811891f},
-std::array<float,2>{0.820617199f, 0.133226588f},
-std::array<float,2>{0.245770544f, 0.102264516f},
-std::array<float,2>{0.974398136f, 0.956625462f},
-std::array<float,2>{0.431152284f, 0.62434119f},
-std::array<float,2>{0.57975179f, 0.495870829f},
-std::array<float,2>{0.476045817f, 0.223272949f},
-std::array<float,2>{0.512266815f, 0.756974578f},
-std::array<float,2>{0.15282847f, 0.727988362f},
-std::array<float,2>{0.878512323f, 0.343406379f},
-std::array<float,2>{0.00702700671f, 0.427460164f},
-std::array<float,2>{0.809954941f, 0.528897226f},
-std::array<float,2>{0.340273291f, 0.931675553f},
-std::array<float,2>{0.724255502f, 0.0553194359f},
-std::array<float,2>{0.415047675f, 0.328974843f},
-std::array<float,2>{0.569292367f, 0.719243705f},
-std::array<float,2>{0.227049455f, 0.759211481f},
-std::array<float,2>{0.990484476f, 0.228846699f},
-std::array<float,2>{0.113683507f, 0.0475380458f},
-std::array<float,2>{0.828930318f, 0.927138567f},
-std::array<float,2>{0.286247313f, 0.518577278f},
-std::array<float,2>{0.680255353f, 0.431716651f},
-std::array<float,2>{0.312855244f, 0.125670776f},
-std::array<float,2>{0.749306738f, 0.853072107f},
-std::array<float,2>{0.0232765768f, 0.683983982f},
-std::array<float,2>{0.781505823f, 0.295789242f},
-std::array<float,2>{0.126554251f, 0.490044653f},
-std::array<float,2>{0.900972068f, 0.61091876f},
-std::array<float,2>{0.486423314f, 0.96620059f},
-std::array<float,2>{0.519396484f, 0.0969087481f},
-std::array<float,2>{0.26755783f, 0.389256448f},
-std::array<float,2>{0.647577047f, 0.534152091f},
-std::array<float,2>{0.0631727725f, 0.898341835f},
-std::array<float,2>{0.854276776f, 0.000968537643f},
-std::array<float,2>{0.199801043f, 0.210536569f},
-std::array<float,2>{0.938065886f, 0.786441326f},
-std::array<float,2>{0.391204745f, 0.710946262f},
-std::array<float,2>{0.594177365f, 0.366715789f},
-std::array<float,2>{0.452232003f, 0.0778286383f},
-std::array<float,2>{0.532583117f, 0.986670017f},
-std::array<float,2>{0.168427095f, 0.582444668f},
-std::array<float,2>{0.922316849f, 0.45148313f},
-std::array<float,2>{0.0527247488f, 0.252463102f},
-std::array<float,2>{0.755746722f, 0.635092258f},
-std::array<float,2>{0.347413391f, 0.834808469f},
-std::array<float,2>{0.693351626f, 0.176198959f},
-std::array<float,2>{0.472222865f, 0.462455779f},
-std::array<float,2>{0.509309828f, 0.56650269f},
-std::array<float,2>{0.151844144f, 0.977896273f},
-std::array<float,2>{0.881242514f, 0.087282598f},
-std::array<float,2>{0.00373121211f, 0.160506889f},
-std::array<float,2>{0.805756211f, 0.814367473f},
-std::array<float,2>{0.33816275f, 0.644805253f},
-std::array<float,2>{0.718982756f, 0.273776799f},
-std::array<float,2>{0.302425683f, 0.0266912691f},
-std::array<float,2>{0.666592598f, 0.87553066f},
-std::array<float,2>{0.105021283f, 0.562442958f},
-std::array<float,2>{0.827464879f, 0.401217073f},
-std::array<float,2>{0.247356802f, 0.345857114f},
-std::array<float,2>{0.972225249f, 0.70236665f},
-std::array<float,2>{0.43603611f, 0.803400218f},
-std::array<float,2>{0.583367229f, 0.190130934f},
-std::array<float,2>{0.368049443f, 0.303879768f},
-std::array<float,2>{0.706120491f, 0.657932758f},
-std::array<float,2>{0.036057055f, 0.870058715f},
-std::array<float,2>{0.768703103f, 0.148198336f},
-std::array<float,2>{0.174295411f, 0.115058742f},
-std::array<float,2>{0.909249187f, 0.939858973f},
-std::array<float,2>{0.460521102f, 0.608115911f},
-std::array<float,2>{0.547362149f, 0.481411517f},
-std::array<float,2>{0.376781732f, 0.243461356f},
-std::array<float,2>{0.620658934f, 0.773259401f},
-std::array<float,2>{0.208343953f, 0.745299757f},
-std::array<float,2>{0.957778752f, 0.314179212f},
-std::array<float,2>{0.0807830021f, 0.410112888f},
-std::array<float,2>{0.867454708f, 0.503367186f},
-std::array<float,2>{0.265244216f, 0.909701169f},
-std::array<float,2>{0.629488647f, 0.0422649533f},
-std::array<float,2>{0.461907297f, 0.2730335f},
-std::array<float,2>{0.560004711f, 0.655661643f},
-std::array<float,2>{0.185489342f, 0.827739477f},
-std::array<float,2>{0.920719326f, 0.164308429f},
-std::array<float,2>{0.0415811874f, 0.0801118836f},
-std::array<float,2>{0.776720703f, 0.972424388f},
-std::array<float,2>{0.366916031f, 0.573626101f},
-std::array<float,2>{0.718532443f, 0.457315117f},
-std::array<float,2>{0.250285983f, 0.198658615f},
-std::array<float,2>{0.638955295f, 0.805680752f},
-std::array<float,2>{0.0931558684f, 0.68791616f},
-std::array<float,2>{0.866251588f, 0.357488781f},
-std::array<float,2>{0.216516882f, 0.393188328f},
-std::array<float,2>{0.9681409f, 0.55325067f},
-std::array<float,2>{0.386148989f, 0.88805908f},
-std::array<float,2>{0.616811752f, 0.0214190055f},
-std::array<float,2>{0.332638025f, 0.472510755f},
-std::array<float,2>{0.730732441f, 0.599612772f},
-std::array<float,2>{0.0106247636f, 0.948485851f},
-std::array<float,2>{0.801869094f, 0.11896202f},
-std::array<float,2>{0.142363936f, 0.153236941f},
-std::array<float,2>{0.883151591f, 0.866345942f},
-std::array<float,2>{0.481212378f, 0.67088306f},
-std::array<float,2>{0.504770458f, 0.308055907f},
-std::array<float,2>{0.428918064f, 0.0381337218f},
-std::array<float,2>{0.588685334f, 0.920784235f},
-std::array<float,2>{0.239570141f, 0.509986579f},
-std::array<float,2>{0.981595814f, 0.417808622f},
-std::array<float,2>{0.0950971618f, 0.324403495f},
-std::array<float,2>{0.819655478f, 0.741627753f},
-std::array<float,2>{0.309841841f, 0.777561247f},
-std::array<float,2>{0.663839757f, 0.237212032f},
-std::array<float,2>{0.40238893f, 0.425659031f},
-std::array<float,2>{0.603109002f, 0.525535405f},
-std::array<float,2>{0.190534443f, 0.936807632f},
-std::array<float,2>{0.946415007f, 0.0620533675f},
-std::array<float,2>{0.0774326026f, 0.220320985f},
-std::array<float,2>{0.848355055f, 0.751077354f},
-std::array<float,2>{0.275631934f, 0.732612193f},
-std::array<float,2>{0.653397024f, 0.339513391f},
-std::array<float,2>{0.355928272f, 0.106922254f},
-std::array<float,2>{0.700361371f, 0.957347214f},
-std::array<float,2>{0.060401544f, 0.617343426f},
-std::array<float,2>{0.761944771f, 0.49934715f},
-std::array<float,2>{0.159695357f, 0.285488367f},
-std::array<float,2>{0.930403113f, 0.675362945f},
-std::array<float,2>{0.444326222f, 0.849962115f},
-std::array<float,2>{0.541952193f, 0.140405893f},
-std::array<float,2>{0.293113858f, 0.373849332f},
-std::array<float,2>{0.676055551f, 0.708923995f},
-std::array<float,2>{0.122886941f, 0.794453263f},
-std::array<float,2>{0.841899633f, 0.216390103f},
-std::array<float,2>{0.221477151f, 0.0152966827f},
-std::array<float,2>{0.998691797f, 0.901447952f},
-std::array<float,2>{0.413353682f, 0.541513503f},
-std::array<float,2>{0.570381343f, 0.378408492f},
-std::array<float,2>{0.496836573f, 0.18570511f},
-std::array<float,2>{0.530438066f, 0.838354409f},
-std::array<float,2>{0.13438873f, 0.625338078f},
-std::array<float,2>{0.893696904f, 0.261969715f},
-std::array<float,2>{0.0289934948f, 0.442044884f},
-std::array<float,2>{0.790052891f, 0.587733209f},
-std::array<float,2>{0.321743339f, 0.994382739f},
-std::array<float,2>{0.740415037f, 0.069879055f},
-std::array<float,2>{0.38872233f, 0.29177922f},
-std::array<float,2>{0.613146067f, 0.68271935f},
-std::array<float,2>{0.211563841f, 0.858002722f},
-std::array<float,2>{0.96355921f, 0.132129788f},
-std::array<float,2>{0.0862597004f, 0.100768417f},
-std::array<float,2>{0.862973571f, 0.964579284f},
-std::array<float,2>{0.255901307f, 0.613700449f},
-std::array<float,2>{0.633931637f, 0.488020748f},
-std::array<float,2>{0.362942547f, 0.233375013f},
-std::array<float,2>{0.711426675f, 0.763943493f},
-std::array<float,2>{0.0430306196f, 0.724855661f},
-std::array<float,2>{0.777877271f, 0.335055411f},
-std::array<float,2>{0.181426018f, 0.433971792f},
-std::array<float,2>{0.914112151f, 0.520860434f},
-std::array<float,2>{0.466849357f, 0.924380183f},
-std::array<float,2>{0.558113873f, 0.0537916906f},
-std::array<float,2>{0.307667971f, 0.446825534f},
-std::array<float,2>{0.657703578f, 0.581086218f},
-std::array<float,2>{0.099022463f, 0.990071774f},
-std::array<float,2>{0.81435281f, 0.0733587593f},
-std::array<float,2>{0.237190396f, 0.173849702f},
-std::array<float,2>{0.977436244f, 0.829003274f},
-std::array<float,2>{0.425678939f, 0.637786865f},
-std::array<float,2>{0.593500853f, 0.254256338f},
-std::array<float,2>{0.478417158f, 0.00712849759f},
-std::array<float,2>{0.500600934f, 0.893555343f},
-std::array<float,2>{0.14645955f, 0.53757f},
-std::array<float,2>{0.888269722f, 0.386286646f},
-std::array<float,2>{0.0143037774f, 0.361144006f},
-std::array<float,2>{0.800767243f, 0.717963278f},
-std::array<float,2>{0.328451127f, 0.781852663f},
-std::array<float,2>{0.72712028f, 0.206996977f},
-std::array<float,2>{0.438073754f, 0.402452469f},
-std::array<float,2>{0.544699907f, 0.558225751f},
-std::array<float,2>{0.163130596f, 0.879539847f},
-std::array<float,2>{0.934223533f, 0.0275944248f},
-std::array<float,2>{0.0549995229f, 0.192630365f},
-std::array<float,2>{0.759141028f, 0.798320174f},
-std::array<float,2>{0.353467852f, 0.697093904f},
-std::array<float,2>{0.696858764f, 0.349624485f},
-std::array<float,2>{0.280285537f, 0.0900697261f},
-std::array<float,2>{0.650248289f, 0.983208895f},
-std::array<float,2>{0.0742029399f, 0.563168168f},
-std::array<float,2>{0.845731497f, 0.467606097f},
-std::array<float,2>{0.193817586f, 0.278701723f},
-std::array<float,2>{0.950706065f, 0.644312441f},
-std::array<float,2>{0.400797278f, 0.819556594f},
-std::array<float,2>{0.605902791f, 0.156358331f},
-std::array<float,2>{0.327359915f, 0.319930702f},
-std::array<float,2>{0.735980034f, 0.746960938f},
-std::array<float,2>{0.0245365072f, 0.766965687f},
-std::array<float,2>{0.79570961f, 0.246743202f},
-std::array<float,2>{0.140144199f, 0.0466188788f},
-std::array<float,2>{0.897421718f, 0.912147522f},
-std::array<float,2>{0.493067861f, 0.506435156f},
-std::array<float,2>{0.526073694f, 0.411051542f},
-std::array<float,2>{0.409029514f, 0.141662836f},
-std::array<float,2>{0.577760816f, 0.874136806f},
-std::array<float,2>{0.226462051f, 0.660274804f},
-std::array<float,2>{0.994395256f, 0.299536169f},
-std::array<float,2>{0.120784864f, 0.477351308f},
-std::array<float,2>{0.838843644f, 0.601812363f},
-std::array<float,2>{0.289086699f, 0.943971455f},
-std::array<float,2>{0.67278862f, 0.11129351f},
-std::array<float,2>{0.491639584f, 0.354007006f},
-std::array<float,2>{0.523077667f, 0.694115162f},
-std::array<float,2>{0.128947705f, 0.808883131f},
-std::array<float,2>{0.904593468f, 0.200062037f},
-std::array<float,2>{0.0191414226f, 0.0168874506f},
-std::array<float,2>{0.788002253f, 0.885525525f},
-std::array<float,2>{0.319004089f, 0.548820376f},
-std::array<float,2>{0.746092319f, 0.395821959f},
-std::array<float,2>{0.282122374f, 0.170346096f},
-std::array<float,2>{0.686436355f, 0.823324859f},
-std::array<float,2>{0.110637799f, 0.650645137f},
-std::array<float,2>{0.834290504f, 0.26733008f},
-std::array<float,2>{0.232677042f, 0.455819428f},
-std::array<float,2>{0.985935092f, 0.575311303f},
-std::array<float,2>{0.418470144f, 0.974471092f},
-std::array<float,2>{0.564418375f, 0.0851659626f},
-std::array<float,2>{0.351396084f, 0.419405341f},
-std::array<float,2>{0.688322484f, 0.511931419f},
-std::array<float,2>{0.0499434434f, 0.915110111f},
-std::array<float,2>{0.753255188f, 0.0314439163f},
-std::array<float,2>{0.164433524f, 0.241804913f},
-std::array<float,2>{0.929350495f, 0.775333524f},
-std::array<float,2>{0.446415782f, 0.734385729f},
-std::array<float,2>{0.537110507f, 0.322540492f},
-std::array<float,2>{0.395161837f, 0.122027606f},
-std::array<float,2>{0.599884331f, 0.952867568f},
-std::array<float,2>{0.195768058f, 0.594983459f},
-std::array<float,2>{0.942884862f, 0.474464118f},
-std::array<float,2>{0.0672349483f, 0.309379458f},
-std::array<float,2>{0.855847478f, 0.667467654f},
-std::array<float,2>{0.270924777f, 0.859810412f},
-std::array<float,2>{0.640641868f, 0.151838869f},
-std::array<float,2>{0.431987226f, 0.492865086f},
-std::array<float,2>{0.580960929f, 0.62230432f},
-std::array<float,2>{0.242266715f, 0.953918576f},
-std::array<float,2>{0.974779844f, 0.104865268f},
-std::array<float,2>{0.106005751f, 0.135184571f},
-std::array<float,2>{0.822514594f, 0.844904721f},
-std::array<float,2>{0.298458308f, 0.678976536f},
-std::array<float,2>{0.668640912f, 0.284391344f},
-std::array<float,2>{0.343726397f, 0.0567904301f},
-std::array<float,2>{0.726561129f, 0.930799961f},
-std::array<float,2>{0.00445567165f, 0.530613005f},
-std::array<float,2>{0.811974585f, 0.428078264f},
-std::array<float,2>{0.154440865f, 0.340642095f},
-std::array<float,2>{0.876114011f, 0.72963208f},
-std::array<float,2>{0.474433213f, 0.754072666f},
-std::array<float,2>{0.514165223f, 0.226420835f},
-std::array<float,2>{0.258642197f, 0.258553833f},
-std::array<float,2>{0.626013577f, 0.632345617f},
-std::array<float,2>{0.0857167616f, 0.841301024f},
-std::array<float,2>{0.874513805f, 0.182303339f},
-std::array<float,2>{0.205962777f, 0.0643075779f},
-std::array<float,2>{0.955978572f, 0.99914676f},
-std::array<float,2>{0.379327863f, 0.592092991f},
-std::array<float,2>{0.62316072f, 0.437573195f},
-std::array<float,2>{0.454528272f, 0.211721256f},
-std::array<float,2>{0.551227331f, 0.791220665f},
-std::array<float,2>{0.176945671f, 0.70432651f},
-std::array<float,2>{0.911470354f, 0.370841324f},
-std::array<float,2>{0.032345023f, 0.380170107f},
-std::array<float,2>{0.772535801f, 0.545296848f},
-std::array<float,2>{0.373698592f, 0.905231118f},
-std::array<float,2>{0.707387149f, 0.0104382169f},
-std::array<float,2>{0.41885823f, 0.353196681f},
-std::array<float,2>{0.563994706f, 0.691581547f},
-std::array<float,2>{0.232572317f, 0.811736703f},
-std::array<float,2>{0.986263275f, 0.203017682f},
-std::array<float,2>{0.110375524f, 0.0185552761f},
-std::array<float,2>{0.833990514f, 0.883774281f},
-std::array<float,2>{0.281824976f, 0.550218403f},
-std::array<float,2>{0.68618834f, 0.396702826f},
-std::array<float,2>{0.319097608f, 0.168253437f},
-std::array<float,2>{0.745724142f, 0.820387363f},
-std::array<float,2>{0.0193188228f, 0.649933875f},
-std::array<float,2>{0.787668467f, 0.269276798f},
-std::array<float,2>{0.12932305f, 0.453794837f},
-std::array<float,2>{0.904529929f, 0.577824593f},
-std::array<float,2>{0.491368383f, 0.975969493f},
-std::array<float,2>{0.523378789f, 0.0827695653f},
-std::array<float,2>{0.270520002f, 0.421413422f},
-std::array<float,2>{0.640918791f, 0.514517844f},
-std::array<float,2>{0.0669840351f, 0.917096496f},
-std::array<float,2>{0.85549736f, 0.0343126506f},
-std::array<float,2>{0.195519492f, 0.240143046f},
-std::array<float,2>{0.943234205f, 0.775655925f},
-std::array<float,2>{0.395331353f, 0.736511111f},
-std::array<float,2>{0.5997473f, 0.320723116f},
-std::array<float,2>{0.446611971f, 0.123225376f},
-std::array<float,2>{0.537460864f, 0.949875534f},
-std::array<float,2>{0.16418682f, 0.596311748f},
-std::array<float,2>{0.929546416f, 0.47550559f},
-std::array<float,2>{0.0501692295f, 0.310642451f},
-std::array<float,2>{0.752960205f, 0.666012883f},
-std::array<float,2>{0.351187199f, 0.862340868f},
-std::array<float,2>{0.688141823f, 0.148906454f},
-std::array<float,2>{0.474269897f, 0.494492263f},
-std::array<float,2>{0.514470577f, 0.623804033f},
-std::array<float,2>{0.154657334f, 0.955788016f},
-std::array<float,2>{0.876388967f, 0.103142112f},
-std::array<float,2>{0.00468367618f, 0.134661511f},
-std::array<float,2>{0.811703801f, 0.845866561f},
-std::array<float,2>{0.343366742f, 0.675787807f},
-std::array<float,2>{0.72625494f, 0.281647414f},
-std::array<float,2>{0.298597485f, 0.0561541393f},
-std::array<float,2>{0.668879986f, 0.933330834f},
-std::array<float,2>{0.106346332f, 0.527671039f},
-std::array<float,2>{0.8224141f, 0.426003963f},
-std::array<float,2>{0.242610946f, 0.342620343f},
-std::array<float,2>{0.974967897f, 0.726930559f},
-std::array<float,2>{0.431781679f, 0.756116211f},
-std::array<float,2>{0.580672145f, 0.224015713f},
-std::array<float,2>{0.374017984f, 0.261040866f},
-std::array<float,2>{0.707190096f, 0.629782259f},
-std::array<float,2>{0.0325463824f, 0.842888772f},
-std::array<float,2>{0.772873163f, 0.181096509f},
-std::array<float,2>{0.177110687f, 0.0650293082f},
-std::array<float,2>{0.911348224f, 0.997845709f},
-std::array<float,2>{0.454202771f, 0.591620386f},
-std::array<float,2>{0.550970316f, 0.440597564f},
-std::array<float,2>{0.37903744f, 0.214553714f},
-std::array<float,2>{0.623506963f, 0.790637434f},
-std::array<float,2>{0.20573166f, 0.705876589f},
-std::array<float,2>{0.955566585f, 0.367572308f},
-std::array<float,2>{0.0856358409f, 0.381345004f},
-std::array<float,2>{0.874971271f, 0.54312712f},
-std::array<float,2>{0.258375108f, 0.903636932f},
-std::array<float,2>{0.626410306f, 0.0093278233f},
-std::array<float,2>{0.467175215f, 0.289075732f},
-std::array<float,2>{0.558479071f, 0.680758357f},
-std::array<float,2>{0.181312293f, 0.85690248f},
-std::array<float,2>{0.914362252f, 0.130289346f},
-std::array<float,2>{0.043412298f, 0.0993492231f},
-std::array<float,2>{0.778111339f, 0.96205008f},
-std::array<float,2>{0.363271683f, 0.616266727f},
-std::array<float,2>{0.711794078f, 0.486215025f},
-std::array<float,2>{0.256117135f, 0.231536806f},
-std::array<float,2>{0.634089231f, 0.762661517f},
-std::array<float,2>{0.0861040056f, 0.724562883f},
-std::array<float,2>{0.863229573f, 0.333761781f},
-std::array<float,2>{0.21186842f, 0.435764551f},
-std::array<float,2>{0.963863552f, 0.522017956f},
-std::array<float,2>{0.388916522f, 0.923512816f},
-std::array<float,2>{0.61301887f, 0.0512132533f},
-std::array<float,2>{0.328142583f, 0.449017107f},
-std::array<float,2>{0.727460384f, 0.579119623f},
-std::array<float,2>{0.0144711398f, 0.990754306f},
-std::array<float,2>{0.800448954f, 0.0720961019f},
-std::array<float,2>{0.146004036f, 0.173062339f},
-std::array<float,2>{0.888441801f, 0.830879152f},
-std::array<float,2>{0.478067875f, 0.639138222f},
-std::array<float,2>{0.500904858f, 0.256011397f},
-std::array<float,2>{0.42537716f, 0.00470384303f},
-std::array<float,2>{0.593547046f, 0.891429842f},
-std::array<float,2>{0.236946061f, 0.536525011f},
-std::array<float,2>{0.977244854f, 0.383412033f},
-std::array<float,2>{0.0988434181f, 0.362849534f},
-std::array<float,2>{0.814028978f, 0.715700328f},
-std::array<float,2>{0.308088869f, 0.783783913f},
-std::array<float,2>{0.657449841f, 0.203278452f},
-std::array<float,2>{0.400422186f, 0.406155586f},
-std::array<float,2>{0.605487466f, 0.555894554f},
-std::array<float,2>{0.193516821f, 0.881029069f},
-std::array<float,2>{0.951167405f, 0.0305982493f},
-std::array<float,2>{0.0739548132f, 0.193491533f},
-std::array<float,2>{0.845982015f, 0.799708843f},
-std::array<float,2>{0.280685902f, 0.698681056f},
-std::array<float,2>{0.65012598f, 0.34845385f},
-std::array<float,2>{0.353170872f, 0.0927825868f},
-std::array<float,2>{0.697069287f, 0.982284784f},
-std::array<float,2>{0.0547538102f, 0.566264093f},
-std::array<float,2>{0.758839011f, 0.466234773f},
-std::array<float,2>{0.16356577f, 0.280440211f},
-std::array<float,2>{0.934354067f, 0.641762912f},
-std::array<float,2>{0.438286275f, 0.817056596f},
-std::array<float,2>{0.544639289f, 0.158279747f},
-std::array<float,2>{0.289366156f, 0.317439467f},
-std::array<float,2>{0.672381222f, 0.749436617f},
-std::array<float,2>{0.120927125f, 0.768982112f},
-std::array<float,2>{0.838613689f, 0.24943015f},
-std::array<float,2>{0.226211891f, 0.0435470715f},
-std::array<float,2>{0.994268656f, 0.910710514f},
-std::array<float,2>{0.408747762f, 0.505597413f},
-std::array<float,2>{0.578059673f, 0.412738979f},
-std::array<float,2>{0.492719084f, 0.142981738f},
-std::array<float,2>{0.526271522f, 0.872445047f},
-std::array<float,2>{0.140473902f, 0.663512766f},
-std::array<float,2>{0.897006452f, 0.297717333f},
-std::array<float,2>{0.0246608667f, 0.480333f},
-std::array<float,2>{0.795472741f, 0.603767097f},
-std::array<float,2>{0.327421725f, 0.941714525f},
-std::array<float,2>{0.736172378f, 0.111818738f},
-std::array<float,2>{0.38591978f, 0.271052957f},
-std::array<float,2>{0.617000818f, 0.653389513f},
-std::array<float,2>{0.216736123f, 0.82598263f},
-std::array<float,2>{0.968015432f, 0.167251691f},
-std::array<float,2>{0.0929031074f, 0.0800721124f},
-std::array<float,2>{0.866531789f, 0.969569445f},
-std::array<float,2>{0.250202715f, 0.57161355f},
-std::array<float,2>{0.638803244f, 0.459822297f},
-std::array<float,2>{0.367138535f, 0.196026817f},
-std::array<float,2>{0.718364835f, 0.807440996f},
-std::array<float,2>{0.0418515727f, 0.69115752f},
-std::array<float,2>{0.776596427f, 0.357262552f},
-std::array<float,2>{0.185218021f, 0.392380536f},
-std::array<float,2>{0.92057687f, 0.551914275f},
-std::array<float,2>{0.46163398f, 0.889370263f},
-std::array<float,2>{0.559790909f, 0.0220185444f},
-std::array<float,2>{0.309663445f, 0.468908787f},
-std::array<float,2>{0.663712323f, 0.599502087f},
-std::array<float,2>{0.0947316289f, 0.947006047f},
-std::array<float,2>{0.819424987f, 0.120974593f},
-std::array<float,2>{0.239392862f, 0.155964524f},
-std::array<float,2>{0.981869519f, 0.864977181f},
-std::array<float,2>{0.429061204f, 0.669045389f},
-std::array<float,2>{0.588508666f, 0.305776387f},
-std::array<float,2>{0.481154442f, 0.0361348987f},
-std::array<float,2>{0.504464924f, 0.918099999f},
-std::array<float,2>{0.142282665f, 0.508667707f},
-std::array<float,2>{0.882820904f, 0.415847331f},
-std::array<float,2>{0.0103023099f, 0.327393711f},
-std::array<float,2>{0.802108884f, 0.739468098f},
-std::array<float,2>{0.332846403f, 0.781064808f},
-std::array<float,2>{0.730489016f, 0.235955641f},
-std::array<float,2>{0.443886757f, 0.421990871f},
-std::array<float,2>{0.541657984f, 0.523490548f},
-std::array<float,2>{0.160049334f, 0.934228778f},
-std::array<float,2>{0.930581689f, 0.0600759722f},
-std::array<float,2>{0.0601064712f, 0.221174881f},
-std::array<float,2>{0.762060046f, 0.75301522f},
-std::array<float,2>{0.355686933f, 0.732099652f},
-std::array<float,2>{0.700613141f, 0.3365587f},
-std::array<float,2>{0.275683284f, 0.108370632f},
-std::array<float,2>{0.653805494f, 0.959697664f},
-std::array<float,2>{0.0773809105f, 0.620693684f},
-std::array<float,2>{0.84862709f, 0.496589273f},
-std::array<float,2>{0.190822393f, 0.287452102f},
-std::array<float,2>{0.946730077f, 0.672692955f},
-std::array<float,2>{0.402651012f, 0.848099411f},
-std::array<float,2>{0.603487551f, 0.137416825f},
-std::array<float,2>{0.321431369f, 0.371566176f},
-std::array<float,2>{0.740507305f, 0.710679173f},
-std::array<float,2>{0.0292941462f, 0.795272946f},
-std::array<float,2>{0.790363014f, 0.216903776f},
-std::array<float,2>{0.134718016f, 0.0132732047f},
-std::array<float,2>{0.893804967f, 0.900051892f},
-std::array<float,2>{0.496792465f, 0.539556623f},
-std::array<float,2>{0.530667067f, 0.376022995f},
-std::array<float,2>{0.413250327f, 0.18422085f},
-std::array<float,2>{0.570591509f, 0.837711453f},
-std::array<float,2>{0.22119835f, 0.627065063f},
-std::array<float,2>{0.998806298f, 0.265069366f},
-std::array<float,2>{0.122584917f, 0.443784684f},
-std::array<float,2>{0.842275441f, 0.589512765f},
-std::array<float,2>{0.293435276f, 0.993790746f},
-std::array<float,2>{0.675961018f, 0.0677284151f},
-std::array<float,2>{0.486679137f, 0.330931753f},
-std::array<float,2>{0.519111395f, 0.720978022f},
-std::array<float,2>{0.12683484f, 0.760631621f},
-std::array<float,2>{0.901223302f, 0.227338672f},
-std::array<float,2>{0.0230659135f, 0.0489994809f},
-std::array<float,2>{0.781294465f, 0.928647339f},
-std::array<float,2>{0.312701046f, 0.517041028f},
-std::array<float,2>{0.749234378f, 0.431324393f},
-std::array<float,2>{0.286585033f, 0.127139494f},
-std::array<float,2>{0.680422843f, 0.854234576f},
-std::array<float,2>{0.113380663f, 0.686467111f},
-std::array<float,2>{0.828675687f, 0.293198645f},
-std::array<float,2>{0.226799339f, 0.49198401f},
-std::array<float,2>{0.990444362f, 0.611783385f},
-std::array<float,2>{0.415335625f, 0.968037486f},
-std::array<float,2>{0.569017589f, 0.0941965282f},
-std::array<float,2>{0.347311795f, 0.388075948f},
-std::array<float,2>{0.693050861f, 0.532867074f},
-std::array<float,2>{0.0523435883f, 0.895098746f},
-std::array<float,2>{0.755386531f, 0.00329130515f},
-std::array<float,2>{0.168001845f, 0.20764336f},
-std::array<float,2>{0.921922624f, 0.788835406f},
-std::array<float,2>{0.452410311f, 0.713651001f},
-std::array<float,2>{0.532295763f, 0.364391148f},
-std::array<float,2>{0.391375691f, 0.0754176825f},
-std::array<float,2>{0.593933821f, 0.985089123f},
-std::array<float,2>{0.200159222f, 0.585784674f},
-std::array<float,2>{0.93825227f, 0.449297458f},
-std::array<float,2>{0.0633715466f, 0.250613242f},
-std::array<float,2>{0.854245782f, 0.634741843f},
-std::array<float,2>{0.267140239f, 0.832162678f},
-std::array<float,2>{0.6478104f, 0.177793846f},
-std::array<float,2>{0.436294883f, 0.464255899f},
-std::array<float,2>{0.583159864f, 0.569059312f},
-std::array<float,2>{0.24726522f, 0.979003549f},
-std::array<float,2>{0.972584486f, 0.0881138742f},
-std::array<float,2>{0.105422728f, 0.163374215f},
-std::array<float,2>{0.827323198f, 0.815513015f},
-std::array<float,2>{0.302659094f, 0.646529198f},
-std::array<float,2>{0.666854382f, 0.277071625f},
-std::array<float,2>{0.337953597f, 0.0246552862f},
-std::array<float,2>{0.719220102f, 0.877729893f},
-std::array<float,2>{0.00366052496f, 0.558761179f},
-std::array<float,2>{0.806116462f, 0.398502469f},
-std::array<float,2>{0.151433945f, 0.34527272f},
-std::array<float,2>{0.881051421f, 0.69997716f},
-std::array<float,2>{0.472539812f, 0.800789654f},
-std::array<float,2>{0.509691119f, 0.188333169f},
-std::array<float,2>{0.265469521f, 0.302667052f},
-std::array<float,2>{0.62965554f, 0.659488499f},
-std::array<float,2>{0.0810237005f, 0.867985249f},
-std::array<float,2>{0.867197454f, 0.145572647f},
-std::array<float,2>{0.208215311f, 0.116584696f},
-std::array<float,2>{0.957714319f, 0.938553452f},
-std::array<float,2>{0.37652421f, 0.605906308f},
-std::array<float,2>{0.620906353f, 0.48377648f},
-std::array<float,2>{0.46075657f, 0.245734259f},
-std::array<float,2>{0.546974599f, 0.769723415f},
-std::array<float,2>{0.174014598f, 0.743881941f},
-std::array<float,2>{0.909487188f, 0.315646827f},
-std::array<float,2>{0.0357699953f, 0.407843262f},
-std::array<float,2>{0.76904279f, 0.501552224f},
-std::array<float,2>{0.367819548f, 0.906549752f},
-std::array<float,2>{0.706301332f, 0.0408870131f},
-std::array<float,2>{0.396649659f, 0.323730201f},
-std::array<float,2>{0.598143935f, 0.736145616f},
-std::array<float,2>{0.197748825f, 0.773985207f},
-std::array<float,2>{0.944628358f, 0.241070271f},
-std::array<float,2>{0.0694674551f, 0.0324949324f},
-std::array<float,2>{0.858177841f, 0.914521456f},
-std::array<float,2>{0.27267769f, 0.512931347f},
-std::array<float,2>{0.64406085f, 0.418919355f},
-std::array<float,2>{0.347889811f, 0.150403067f},
-std::array<float,2>{0.689522922f, 0.860729396f},
-std::array<float,2>{0.0473682359f, 0.666737199f},
-std::array<float,2>{0.751269877f, 0.309694886f},
-std::array<float,2>{0.166716322f, 0.473445475f},
-std::array<float,2>{0.926708162f, 0.594163001f},
-std::array<float,2>{0.447345912f, 0.951496899f},
-std::array<float,2>{0.536453545f, 0.122347437f},
-std::array<float,2>{0.283581346f, 0.39543131f},
-std::array<float,2>{0.684690237f, 0.547475636f},
-std::array<float,2>{0.111806355f, 0.886069834f},
-std::array<float,2>{0.833560705f, 0.016367523f},
-std::array<float,2>{0.23133941f, 0.20058611f},
-std::array<float,2>{0.987488151f, 0.809808135f},
-std::array<float,2>{0.420518547f, 0.694946051f},
-std::array<float,2>{0.564751506f, 0.355115891f},
-std::array<float,2>{0.489674211f, 0.08434017f},
-std::array<float,2>{0.520275056f, 0.972661197f},
-std::array<float,2>{0.131023571f, 0.57481575f},
-std::array<float,2>{0.903841615f, 0.456366628f},
-std::array<float,2>{0.0160274785f, 0.266220689f},
-std::array<float,2>{0.785773337f, 0.651530683f},
-std::array<float,2>{0.317678571f, 0.822870076f},
-std::array<float,2>{0.743896842f, 0.171266049f},
-std::array<float,2>{0.455559134f, 0.439303547f},
-std::array<float,2>{0.5544011f, 0.593491197f},
-std::array<float,2>{0.17838195f, 0.998651803f},
-std::array<float,2>{0.91242677f, 0.0625767484f},
-std::array<float,2>{0.0350818448f, 0.183212444f},
-std::array<float,2>{0.771062553f, 0.840746224f},
-std::array<float,2>{0.371517271f, 0.631380856f},
-std::array<float,2>{0.71002692f, 0.259662837f},
-std::array<float,2>{0.26151368f, 0.0110663492f},
-std::array<float,2>{0.627750039f, 0.905943811f},
-std::array<float,2>{0.0823060796f, 0.546098769f},
-std::array<float,2>{0.872721672f, 0.379452348f},
-std::array<float,2>{0.204640165f, 0.36937806f},
-std::array<float,2>{0.953758895f, 0.703930378f},
-std::array<float,2>{0.381963044f, 0.792688966f},
-std::array<float,2>{0.622521639f, 0.212214664f},
-std::array<float,2>{0.339947999f, 0.283256918f},
-std::array<float,2>{0.72445792f, 0.677789867f},
-std::array<float,2>{0.00717657292f, 0.844250619f},
-std::array<float,2>{0.809659541f, 0.135796845f},
-std::array<float,2>{0.152361378f, 0.103773788f},
-std::array<float,2>{0.878888667f, 0.954244375f},
-std::array<float,2>{0.475724101f, 0.621189237f},
-std::array<float,2>{0.512513399f, 0.493684381f},
-std::array<float,2>{0.430689931f, 0.225212544f},
-std::array<float,2>{0.579999804f, 0.755665183f},
-std::array<float,2>{0.246029854f, 0.728987217f},
-std::array<float,2>{0.974249721f, 0.341109127f},
-std::array<float,2>{0.107964233f, 0.429353416f},
-std::array<float,2>{0.820384026f, 0.530186772f},
-std::array<float,2>{0.299936384f, 0.930483222f},
-std::array<float,2>{0.670763612f, 0.057640072f},
-std::array<float,2>{0.478634626f, 0.255611092f},
-std::array<float,2>{0.502890825f, 0.636733294f},
-std::array<float,2>{0.146721378f, 0.829788208f},
-std::array<float,2>{0.889053881f, 0.174885154f},
-std::array<float,2>{0.0135255745f, 0.0722948164f},
-std::array<float,2>{0.797107697f, 0.988680601f},
-std::array<float,2>{0.33020547f, 0.580381215f},
-std::array<float,2>{0.72884053f, 0.445839077f},
-std::array<float,2>{0.305797935f, 0.205758095f},
-std::array<float,2>{0.660057604f, 0.782308459f},
-std::array<float,2>{0.0998243988f, 0.717277586f},
-std::array<float,2>{0.815530896f, 0.359894365f},
-std::array<float,2>{0.236041114f, 0.385310888f},
-std::array<float,2>{0.979574084f, 0.538318694f},
-std::array<float,2>{0.422948897f, 0.893150568f},
-std::array<float,2>{0.590131283f, 0.00589691289f},
-std::array<float,2>{0.359951407f, 0.486988097f},
-std::array<float,2>{0.713923097f, 0.614807665f},
-std::array<float,2>{0.0464404859f, 0.963851154f},
-std::array<float,2>{0.779997826f, 0.100073256f},
-std::array<float,2>{0.182479039f, 0.131373093f},
-std::array<float,2>{0.916119874f, 0.858992934f},
-std::array<float,2>{0.465072423f, 0.682355344f},
-std::array<float,2>{0.556380987f, 0.292869449f},
-std::array<float,2>{0.386974096f, 0.0534092039f},
-std::array<float,2>{0.611072123f, 0.92485708f},
-std::array<float,2>{0.213770419f, 0.520089328f},
-std::array<float,2>{0.96238941f, 0.435186833f},
-std::array<float,2>{0.089604862f, 0.334541291f},
-std::array<float,2>{0.861198068f, 0.726524889f},
-std::array<float,2>{0.254216343f, 0.764864028f},
-std::array<float,2>{0.636419058f, 0.234124959f},
-std::array<float,2>{0.406294614f, 0.411737829f},
-std::array<float,2>{0.575938642f, 0.507086575f},
-std::array<float,2>{0.223947525f, 0.913227499f},
-std::array<float,2>{0.992577493f, 0.0457868762f},
-std::array<float,2>{0.117255278f, 0.24707821f},
-std::array<float,2>{0.836565673f, 0.766251564f},
-std::array<float,2>{0.292910308f, 0.747515202f},
-std::array<float,2>{0.675720692f, 0.318403751f},
-std::array<float,2>{0.325602144f, 0.1102392f},
-std::array<float,2>{0.738249958f, 0.944591463f},
-std::array<float,2>{0.0272137765f, 0.602794588f},
-std::array<float,2>{0.794320226f, 0.47804898f},
-std::array<float,2>{0.136850536f, 0.300307393f},
-std::array<float,2>{0.895190418f, 0.661966145f},
-std::array<float,2>{0.495305657f, 0.873398125f},
-std::array<float,2>{0.524826586f, 0.141364262f},
-std::array<float,2>{0.278564513f, 0.350860983f},
-std::array<float,2>{0.650592864f, 0.696099222f},
-std::array<float,2>{0.0704571605f, 0.797761917f},
-std::array<float,2>{0.845693648f, 0.191612646f},
-std::array<float,2>{0.191414163f, 0.0284350887f},
-std::array<float,2>{0.952512145f, 0.880505264f},
-std::array<float,2>{0.398787677f, 0.55664283f},
-std::array<float,2>{0.608478427f, 0.403454036f},
-std::array<float,2>{0.440225571f, 0.157372788f},
-std::array<float,2>{0.545531571f, 0.819169283f},
-std::array<float,2>{0.160914853f, 0.642667353f},
-std::array<float,2>{0.937375784f, 0.278256446f},
-std::array<float,2>{0.0584341511f, 0.468514502f},
-std::array<float,2>{0.760648489f, 0.564419985f},
-std::array<float,2>{0.354663402f, 0.984286308f},
-std::array<float,2>{0.698536754f, 0.0916503444f},
-std::array<float,2>{0.427261293f, 0.307073653f},
-std::array<float,2>{0.586888731f, 0.671661973f},
-std::array<float,2>{0.240909487f, 0.865532398f},
-std::array<float,2>{0.982881069f, 0.153335303f},
-std::array<float,2>{0.0974394158f, 0.117417485f},
-std::array<float,2>{0.816896856f, 0.947360277f},
-std::array<float,2>{0.312291503f, 0.601069093f},
-std::array<float,2>{0.661404669f, 0.471280009f},
-std::array<float,2>{0.33470881f, 0.23780556f},
-std::array<float,2>{0.734015465f, 0.778490067f},
-std::array<float,2>{0.00797074381f, 0.740685344f},
-std::array<float,2>{0.804178476f, 0.325943887f},
-std::array<float,2>{0.143396407f, 0.4169074f},
-std::array<float,2>{0.885511696f, 0.510848343f},
-std::array<float,2>{0.484368593f, 0.921615124f},
-std::array<float,2>{0.506356418f, 0.0378039591f},
-std::array<float,2>{0.25370717f, 0.458472252f},
-std::array<float,2>{0.63676399f, 0.572426558f},
-std::array<float,2>{0.0899399295f, 0.970766306f},
-std::array<float,2>{0.864556372f, 0.0818328112f},
-std::array<float,2>{0.218405753f, 0.165122822f},
-std::array<float,2>{0.965739608f, 0.826475084f},
-std::array<float,2>{0.384586424f, 0.65480274f},
-std::array<float,2>{0.614645362f, 0.272104651f},
-std::array<float,2>{0.462963909f, 0.019586483f},
-std::array<float,2>{0.561061323f, 0.887309372f},
-std::array<float,2>{0.186908856f, 0.55394429f},
-std::array<float,2>{0.918717265f, 0.394254386f},
-std::array<float,2>{0.0400892198f, 0.35904026f},
-std::array<float,2>{0.774731696f, 0.688897371f},
-std::array<float,2>{0.36413613f, 0.805652559f},
-std::array<float,2>{0.716623247f, 0.19780618f},
-std::array<float,2>{0.498354673f, 0.377618402f},
-std::array<float,2>{0.528159201f, 0.542195797f},
-std::array<float,2>{0.13528432f, 0.900672674f},
-std::array<float,2>{0.891229749f, 0.0139698293f},
-std::array<float,2>{0.031210592f, 0.215096429f},
-std::array<float,2>{0.791652441f, 0.793220162f},
-std::array<float,2>{0.323153257f, 0.707717001f},
-std::array<float,2>{0.739247739f, 0.374427885f},
-std::array<float,2>{0.296666235f, 0.0685458034f},
-std::array<float,2>{0.678952634f, 0.995688856f},
-std::array<float,2>{0.124476098f, 0.586299837f},
-std::array<float,2>{0.840804875f, 0.442557991f},
-std::array<float,2>{0.218840435f, 0.263028234f},
-std::array<float,2>{0.996545613f, 0.626705289f},
-std::array<float,2>{0.411045223f, 0.83946842f},
-std::array<float,2>{0.572352231f, 0.187380984f},
-std::array<float,2>{0.358799875f, 0.338022441f},
-std::array<float,2>{0.702897966f, 0.73348856f},
-std::array<float,2>{0.0619546659f, 0.750100732f},
-std::array<float,2>{0.765616596f, 0.219042286f},
-std::array<float,2>{0.158011481f, 0.0607160628f},
-std::array<float,2>{0.932268858f, 0.935970902f},
-std::array<float,2>{0.441610396f, 0.52724117f},
-std::array<float,2>{0.540154934f, 0.424534053f},
-std::array<float,2>{0.406195968f, 0.138909116f},
-std::array<float,2>{0.604849458f, 0.850943208f},
-std::array<float,2>{0.189432785f, 0.674145937f},
-std::array<float,2>{0.948936462f, 0.287050217f},
-std::array<float,2>{0.0757902861f, 0.498251438f},
-std::array<float,2>{0.849624991f, 0.618744433f},
-std::array<float,2>{0.275183082f, 0.958049417f},
-std::array<float,2>{0.655990303f, 0.105482332f},
-std::array<float,2>{0.44978404f, 0.366198361f},
-std::array<float,2>{0.534949541f, 0.71236366f},
-std::array<float,2>{0.170048833f, 0.785170078f},
-std::array<float,2>{0.924828053f, 0.209941268f},
-std::array<float,2>{0.0543677211f, 0.00115233962f},
-std::array<float,2>{0.756947339f, 0.896639407f},
-std::array<float,2>{0.344123751f, 0.534488142f},
-std::array<float,2>{0.694626033f, 0.390464455f},
-std::array<float,2>{0.269008249f, 0.177321449f},
-std::array<float,2>{0.64529562f, 0.83525759f},
-std::array<float,2>{0.0659680218f, 0.636220694f},
-std::array<float,2>{0.852421522f, 0.253524572f},
-std::array<float,2>{0.202806234f, 0.452915162f},
-std::array<float,2>{0.939581335f, 0.583762944f},
-std::array<float,2>{0.393428355f, 0.987387121f},
-std::array<float,2>{0.59696877f, 0.0762467608f},
-std::array<float,2>{0.316170216f, 0.433495194f},
-std::array<float,2>{0.747574151f, 0.518492579f},
-std::array<float,2>{0.0213720817f, 0.926304638f},
-std::array<float,2>{0.784893751f, 0.0481749959f},
-std::array<float,2>{0.128650069f, 0.230087921f},
-std::array<float,2>{0.898909509f, 0.757912993f},
-std::array<float,2>{0.484613419f, 0.719898999f},
-std::array<float,2>{0.516504586f, 0.329661995f},
-std::array<float,2>{0.417702138f, 0.096122928f},
-std::array<float,2>{0.566512465f, 0.965643287f},
-std::array<float,2>{0.230067074f, 0.609874606f},
-std::array<float,2>{0.989962578f, 0.489235193f},
-std::array<float,2>{0.115980983f, 0.296534449f},
-std::array<float,2>{0.830092549f, 0.685531557f},
-std::array<float,2>{0.288872868f, 0.851861358f},
-std::array<float,2>{0.681753755f, 0.126317427f},
-std::array<float,2>{0.377588749f, 0.482237995f},
-std::array<float,2>{0.619080842f, 0.608734071f},
-std::array<float,2>{0.209403709f, 0.940484583f},
-std::array<float,2>{0.960672677f, 0.113571346f},
-std::array<float,2>{0.0796533301f, 0.146837994f},
-std::array<float,2>{0.870419621f, 0.87017709f},
-std::array<float,2>{0.262481421f, 0.657064676f},
-std::array<float,2>{0.631118476f, 0.30352366f},
-std::array<float,2>{0.369657576f, 0.0413890444f},
-std::array<float,2>{0.704900801f, 0.909169018f},
-std::array<float,2>{0.038321875f, 0.50265193f},
-std::array<float,2>{0.767303884f, 0.408390492f},
-std::array<float,2>{0.173320204f, 0.313410878f},
-std::array<float,2>{0.908150315f, 0.744215131f},
-std::array<float,2>{0.457550645f, 0.772240996f},
-std::array<float,2>{0.549084723f, 0.242783919f},
-std::array<float,2>{0.30344075f, 0.274579912f},
-std::array<float,2>{0.665683508f, 0.646208942f},
-std::array<float,2>{0.102696195f, 0.812800646f},
-std::array<float,2>{0.824306607f, 0.161697671f},
-std::array<float,2>{0.248746112f, 0.0864731371f},
-std::array<float,2>{0.968958855f, 0.976610601f},
-std::array<float,2>{0.434458524f, 0.56767714f},
-std::array<float,2>{0.584344923f, 0.460944504f},
-std::array<float,2>{0.469826281f, 0.191178635f},
-std::array<float,2>{0.510623813f, 0.803877831f},
-std::array<float,2>{0.149595261f, 0.701530576f},
-std::array<float,2>{0.880074739f, 0.347034484f},
-std::array<float,2>{0.000507245015f, 0.401582181f},
-std::array<float,2>{0.807720959f, 0.561391771f},
-std::array<float,2>{0.336472899f, 0.876465738f},
-std::array<float,2>{0.720975697f, 0.0261495337f},
-std::array<float,2>{0.381704837f, 0.369090557f},
-std::array<float,2>{0.621204078f, 0.706918895f},
-std::array<float,2>{0.20403102f, 0.789120555f},
-std::array<float,2>{0.954374015f, 0.213663444f},
-std::array<float,2>{0.0831189156f, 0.00860598125f},
-std::array<float,2>{0.871841609f, 0.903218865f},
-std::array<float,2>{0.260734439f, 0.544279277f},
-std::array<float,2>{0.62819159f, 0.382147044f},
-std::array<float,2>{0.372988462f, 0.180085495f},
-std::array<float,2>{0.709123194f, 0.842462003f},
-std::array<float,2>{0.0338799432f, 0.630132318f},
-std::array<float,2>{0.770162523f, 0.260617703f},
-std::array<float,2>{0.179374471f, 0.439938903f},
-std::array<float,2>{0.913684011f, 0.590078115f},
-std::array<float,2>{0.456448972f, 0.996646225f},
-std::array<float,2>{0.553059518f, 0.0655232966f},
-std::array<float,2>{0.299648136f, 0.42698431f},
-std::array<float,2>{0.671028495f, 0.5284217f},
-std::array<float,2>{0.109049916f, 0.932480156f},
-std::array<float,2>{0.821595967f, 0.0548488609f},
-std::array<float,2>{0.244917825f, 0.222802892f},
-std::array<float,2>{0.973089397f, 0.757644653f},
-std::array<float,2>{0.430492908f, 0.728351355f},
-std::array<float,2>{0.578730822f, 0.343135148f},
-std::array<float,2>{0.474620014f, 0.101614259f},
-std::array<float,2>{0.513427377f, 0.956401408f},
-std::array<float,2>{0.154170498f, 0.624698043f},
-std::array<float,2>{0.877870381f, 0.49551934f},
-std::array<float,2>{0.00646689115f, 0.28289929f},
-std::array<float,2>{0.809409916f, 0.677311659f},
-std::array<float,2>{0.341074735f, 0.847464204f},
-std::array<float,2>{0.723088682f, 0.133688122f},
-std::array<float,2>{0.449088186f, 0.476235092f},
-std::array<float,2>{0.535250187f, 0.597511172f},
-std::array<float,2>{0.167247996f, 0.950614631f},
-std::array<float,2>{0.926761448f, 0.124219202f},
-std::array<float,2>{0.0485123135f, 0.149594828f},
-std::array<float,2>{0.75082463f, 0.861771703f},
-std::array<float,2>{0.34895432f, 0.665005744f},
-std::array<float,2>{0.691019654f, 0.312208325f},
-std::array<float,2>{0.272459835f, 0.0337903835f},
-std::array<float,2>{0.643355131f, 0.916918099f},
-std::array<float,2>{0.0693079829f, 0.514729321f},
-std::array<float,2>{0.858521581f, 0.420466959f},
-std::array<float,2>{0.198407069f, 0.321859181f},
-std::array<float,2>{0.943668067f, 0.737316668f},
-std::array<float,2>{0.398025274f, 0.77731365f},
-std::array<float,2>{0.598759532f, 0.239091367f},
-std::array<float,2>{0.317292809f, 0.268317074f},
-std::array<float,2>{0.742388844f, 0.649120331f},
-std::array<float,2>{0.0167416651f, 0.821306109f},
-std::array<float,2>{0.786801934f, 0.169746801f},
-std::array<float,2>{0.132438064f, 0.083164081f},
-std::array<float,2>{0.903038323f, 0.974720836f},
-std::array<float,2>{0.488861144f, 0.576972604f},
-std::array<float,2>{0.520974517f, 0.4545874f},
-std::array<float,2>{0.421035349f, 0.201435655f},
-std::array<float,2>{0.565656424f, 0.810732245f},
-std::array<float,2>{0.23170726f, 0.692410469f},
-std::array<float,2>{0.986999571f, 0.352278203f},
-std::array<float,2>{0.112921067f, 0.397479951f},
-std::array<float,2>{0.83213532f, 0.548850954f},
-std::array<float,2>{0.284349471f, 0.884108245f},
-std::array<float,2>{0.684525549f, 0.0181560256f},
-std::array<float,2>{0.494366437f, 0.298291236f},
-std::array<float,2>{0.523613274f, 0.6622504f},
-std::array<float,2>{0.138474211f, 0.871199191f},
-std::array<float,2>{0.896349549f, 0.143756703f},
-std::array<float,2>{0.0258419923f, 0.112331569f},
-std::array<float,2>{0.793128014f, 0.943344533f},
-std::array<float,2>{0.324916929f, 0.605145276f},
-std::array<float,2>{0.736855328f, 0.479173601f},
-std::array<float,2>{0.291018039f, 0.248921111f},
-std::array<float,2>{0.674619913f, 0.768091738f},
-std::array<float,2>{0.118867546f, 0.748847008f},
-std::array<float,2>{0.837603927f, 0.317369908f},
-std::array<float,2>{0.223243043f, 0.414037615f},
-std::array<float,2>{0.993606389f, 0.504630148f},
-std::array<float,2>{0.408146173f, 0.911711752f},
-std::array<float,2>{0.574596822f, 0.0446876436f},
-std::array<float,2>{0.353941143f, 0.464986801f},
-std::array<float,2>{0.697457135f, 0.565393686f},
-std::array<float,2>{0.0568822362f, 0.981027305f},
-std::array<float,2>{0.760745287f, 0.0927677304f},
-std::array<float,2>{0.161759868f, 0.159695134f},
-std::array<float,2>{0.935580194f, 0.817970812f},
-std::array<float,2>{0.441219687f, 0.641150951f},
-std::array<float,2>{0.545958102f, 0.280182481f},
-std::array<float,2>{0.400255382f, 0.0302307401f},
-std::array<float,2>{0.608114898f, 0.881914616f},
-std::array<float,2>{0.192615658f, 0.555172801f},
-std::array<float,2>{0.951610565f, 0.404635161f},
-std::array<float,2>{0.0721433237f, 0.348931104f},
-std::array<float,2>{0.84423244f, 0.697387457f},
-std::array<float,2>{0.277801275f, 0.800101995f},
-std::array<float,2>{0.652278721f, 0.194563001f},
-std::array<float,2>{0.422470599f, 0.384251535f},
-std::array<float,2>{0.591053963f, 0.53537488f},
-std::array<float,2>{0.234747633f, 0.891745508f},
-std::array<float,2>{0.979143798f, 0.00566200586f},
-std::array<float,2>{0.101478405f, 0.204832643f},
-std::array<float,2>{0.814887702f, 0.784639716f},
-std::array<float,2>{0.30478695f, 0.71668905f},
-std::array<float,2>{0.658358335f, 0.361931592f},
-std::array<float,2>{0.331870019f, 0.0710168406f},
-std::array<float,2>{0.730271339f, 0.992186606f},
-std::array<float,2>{0.0124116866f, 0.578314543f},
-std::array<float,2>{0.798746705f, 0.44788143f},
-std::array<float,2>{0.147555649f, 0.257473171f},
-std::array<float,2>{0.890076816f, 0.639931679f},
-std::array<float,2>{0.479853809f, 0.831816971f},
-std::array<float,2>{0.503032327f, 0.172507659f},
-std::array<float,2>{0.255606532f, 0.332045764f},
-std::array<float,2>{0.635221064f, 0.723608255f},
-std::array<float,2>{0.0885223821f, 0.76318264f},
-std::array<float,2>{0.859915435f, 0.2305848f},
-std::array<float,2>{0.214731261f, 0.052017305f},
-std::array<float,2>{0.961630285f, 0.922433317f},
-std::array<float,2>{0.388663501f, 0.523262203f},
-std::array<float,2>{0.610167563f, 0.436674863f},
-std::array<float,2>{0.465948433f, 0.129208863f},
-std::array<float,2>{0.555603266f, 0.85628897f},
-std::array<float,2>{0.182702273f, 0.680305064f},
-std::array<float,2>{0.917577922f, 0.290623516f},
-std::array<float,2>{0.045865912f, 0.484946698f},
-std::array<float,2>{0.780503631f, 0.616090775f},
-std::array<float,2>{0.360490084f, 0.961707175f},
-std::array<float,2>{0.713463128f, 0.0981705114f},
-std::array<float,2>{0.411725253f, 0.263995856f},
-std::array<float,2>{0.573642969f, 0.628605127f},
-std::array<float,2>{0.220055491f, 0.836777747f},
-std::array<float,2>{0.997436464f, 0.184743404f},
-std::array<float,2>{0.123951778f, 0.0665986165f},
-std::array<float,2>{0.841746986f, 0.992219806f},
-std::array<float,2>{0.295853138f, 0.587981224f},
-std::array<float,2>{0.677845716f, 0.445218891f},
-std::array<float,2>{0.32394594f, 0.218465433f},
-std::array<float,2>{0.739527643f, 0.796613216f},
-std::array<float,2>{0.0295111053f, 0.709448576f},
-std::array<float,2>{0.792588234f, 0.372897774f},
-std::array<float,2>{0.136160448f, 0.375151366f},
-std::array<float,2>{0.892215192f, 0.540506363f},
-std::array<float,2>{0.499166101f, 0.898484349f},
-std::array<float,2>{0.529097855f, 0.0119603127f},
-std::array<float,2>{0.273491979f, 0.497656852f},
-std::array<float,2>{0.654737413f, 0.619175076f},
-std::array<float,2>{0.0744199976f, 0.960065722f},
-std::array<float,2>{0.850854218f, 0.108958289f},
-std::array<float,2>{0.188043147f, 0.138625443f},
-std::array<float,2>{0.948068619f, 0.84877944f},
-std::array<float,2>{0.404640079f, 0.673383415f},
-std::array<float,2>{0.60384661f, 0.28812924f},
-std::array<float,2>{0.442699492f, 0.0591827072f},
-std::array<float,2>{0.539205909f, 0.934820712f},
-std::array<float,2>{0.156601921f, 0.524470568f},
-std::array<float,2>{0.932757974f, 0.423750222f},
-std::array<float,2>{0.0607065856f, 0.337454021f},
-std::array<float,2>{0.763890386f, 0.730525792f},
-std::array<float,2>{0.357605249f, 0.752005696f},
-std::array<float,2>{0.702070355f, 0.221751481f},
-std::array<float,2>{0.482788414f, 0.414474607f},
-std::array<float,2>{0.507615387f, 0.509043813f},
-std::array<float,2>{0.144322425f, 0.919394195f},
-std::array<float,2>{0.88625294f, 0.0356645323f},
-std::array<float,2>{0.00895957928f, 0.234536767f},
-std::array<float,2>{0.803433001f, 0.779981613f},
-std::array<float,2>{0.335630566f, 0.738949358f},
-std::array<float,2>{0.732470155f, 0.326818615f},
-std::array<float,2>{0.311081886f, 0.119913384f},
-std::array<float,2>{0.660594225f, 0.945523679f},
-std::array<float,2>{0.0959868208f, 0.598558545f},
-std::array<float,2>{0.818256974f, 0.469939888f},
-std::array<float,2>{0.241224259f, 0.305102527f},
-std::array<float,2>{0.983439445f, 0.668345213f},
-std::array<float,2>{0.426086336f, 0.863387346f},
-std::array<float,2>{0.5873757f, 0.154593378f},
-std::array<float,2>{0.364963502f, 0.355775505f},
-std::array<float,2>{0.71534586f, 0.689467669f},
-std::array<float,2>{0.0394460298f, 0.807753384f},
-std::array<float,2>{0.773506403f, 0.196938828f},
-std::array<float,2>{0.185744077f, 0.0228401981f},
-std::array<float,2>{0.919644296f, 0.889859617f},
-std::array<float,2>{0.46394074f, 0.551642418f},
-std::array<float,2>{0.562015593f, 0.391259998f},
-std::array<float,2>{0.383635074f, 0.166466683f},
-std::array<float,2>{0.614201188f, 0.824574351f},
-std::array<float,2>{0.217680305f, 0.652860999f},
-std::array<float,2>{0.966706991f, 0.2698479f},
-std::array<float,2>{0.0913323388f, 0.460161299f},
-std::array<float,2>{0.863425612f, 0.570829391f},
-std::array<float,2>{0.252382666f, 0.969752431f},
-std::array<float,2>{0.638469517f, 0.0789580941f},
-std::array<float,2>{0.458186358f, 0.31462875f},
-std::array<float,2>{0.550558388f, 0.742493689f},
-std::array<float,2>{0.172024786f, 0.77111876f},
-std::array<float,2>{0.906328559f, 0.244509637f},
-std::array<float,2>{0.0371180885f, 0.0400235169f},
-std::array<float,2>{0.765855014f, 0.907244325f},
-std::array<float,2>{0.370514691f, 0.500516951f},
-std::array<float,2>{0.704073012f, 0.406369567f},
-std::array<float,2>{0.2634646f, 0.145203501f},
-std::array<float,2>{0.632594526f, 0.868514001f},
-std::array<float,2>{0.0787517875f, 0.65875411f},
-std::array<float,2>{0.869494915f, 0.301038712f},
-std::array<float,2>{0.210090041f, 0.483128756f},
-std::array<float,2>{0.959480047f, 0.606959403f},
-std::array<float,2>{0.378736228f, 0.937683225f},
-std::array<float,2>{0.617419481f, 0.11543601f},
-std::array<float,2>{0.3378672f, 0.400114894f},
-std::array<float,2>{0.722154558f, 0.560444236f},
-std::array<float,2>{0.00154422945f, 0.878718674f},
-std::array<float,2>{0.806877017f, 0.0243048295f},
-std::array<float,2>{0.148526669f, 0.188841835f},
-std::array<float,2>{0.879100025f, 0.802408218f},
-std::array<float,2>{0.468836635f, 0.701022506f},
-std::array<float,2>{0.511693776f, 0.344187647f},
-std::array<float,2>{0.434818983f, 0.0893468037f},
-std::array<float,2>{0.584972978f, 0.98038727f},
-std::array<float,2>{0.249426439f, 0.569896579f},
-std::array<float,2>{0.970277488f, 0.463711351f},
-std::array<float,2>{0.102464907f, 0.275783569f},
-std::array<float,2>{0.825251937f, 0.648294628f},
-std::array<float,2>{0.304201752f, 0.814721525f},
-std::array<float,2>{0.664421737f, 0.162902758f},
-std::array<float,2>{0.393686146f, 0.450922817f},
-std::array<float,2>{0.596311927f, 0.584010601f},
-std::array<float,2>{0.201422229f, 0.985501111f},
-std::array<float,2>{0.941288888f, 0.0747716129f},
-std::array<float,2>{0.0654282644f, 0.179503992f},
-std::array<float,2>{0.8526088f, 0.833808839f},
-std::array<float,2>{0.26782164f, 0.632864892f},
-std::array<float,2>{0.646091819f, 0.251104206f},
-std::array<float,2>{0.345402151f, 0.00250701583f},
-std::array<float,2>{0.693457186f, 0.895730555f},
-std::array<float,2>{0.0535712056f, 0.531620085f},
-std::array<float,2>{0.756540537f, 0.387552559f},
-std::array<float,2>{0.17101191f, 0.36415562f},
-std::array<float,2>{0.924769521f, 0.714356065f},
-std::array<float,2>{0.451068848f, 0.787610233f},
-std::array<float,2>{0.533969283f, 0.208029926f},
-std::array<float,2>{0.287736326f, 0.29491955f},
-std::array<float,2>{0.682733178f, 0.686993003f},
-std::array<float,2>{0.116836138f, 0.854688466f},
-std::array<float,2>{0.831248462f, 0.128569454f},
-std::array<float,2>{0.229490474f, 0.0950614214f},
-std::array<float,2>{0.988862574f, 0.967247546f},
-std::array<float,2>{0.41688624f, 0.613136828f},
-std::array<float,2>{0.567717016f, 0.490548939f},
-std::array<float,2>{0.485732198f, 0.228481904f},
-std::array<float,2>{0.516733587f, 0.761679232f},
-std::array<float,2>{0.127424136f, 0.721835196f},
-std::array<float,2>{0.900078356f, 0.331279844f},
-std::array<float,2>{0.0197750442f, 0.430427551f},
-std::array<float,2>{0.784101605f, 0.51569742f},
-std::array<float,2>{0.314822316f, 0.929465532f},
-std::array<float,2>{0.746663928f, 0.0502572097f},
-std::array<float,2>{0.432887077f, 0.340067089f},
-std::array<float,2>{0.581618488f, 0.730020046f},
-std::array<float,2>{0.244063973f, 0.754756153f},
-std::array<float,2>{0.976009607f, 0.2259406f},
-std::array<float,2>{0.10662169f, 0.0575986281f},
-std::array<float,2>{0.824048519f, 0.931566477f},
-std::array<float,2>{0.297517449f, 0.530821502f},
-std::array<float,2>{0.669288695f, 0.428579122f},
-std::array<float,2>{0.341835231f, 0.135575488f},
-std::array<float,2>{0.725209117f, 0.845633388f},
-std::array<float,2>{0.00530959247f, 0.679460943f},
-std::array<float,2>{0.810729802f, 0.284675866f},
-std::array<float,2>{0.155447856f, 0.492281795f},
-std::array<float,2>{0.875965476f, 0.622965217f},
-std::array<float,2>{0.472972572f, 0.953330696f},
-std::array<float,2>{0.514870584f, 0.105095528f},
-std::array<float,2>{0.258981436f, 0.38076961f},
-std::array<float,2>{0.625366986f, 0.545804322f},
-std::array<float,2>{0.0844818875f, 0.90444833f},
-std::array<float,2>{0.873601735f, 0.010081674f},
-std::array<float,2>{0.206268385f, 0.211079702f},
-std::array<float,2>{0.957016587f, 0.791826069f},
-std::array<float,2>{0.380434722f, 0.704673409f},
-std::array<float,2>{0.624414921f, 0.370224744f},
-std::array<float,2>{0.453951448f, 0.06378337f},
-std::array<float,2>{0.552198172f, 0.999850094f},
-std::array<float,2>{0.176650435f, 0.592760384f},
-std::array<float,2>{0.9104954f, 0.438123614f},
-std::array<float,2>{0.0314251296f, 0.258229882f},
-std::array<float,2>{0.771572113f, 0.631902516f},
-std::array<float,2>{0.374709815f, 0.841563523f},
-std::array<float,2>{0.708842337f, 0.181759611f},
-std::array<float,2>{0.490272492f, 0.455180436f},
-std::array<float,2>{0.522157609f, 0.576047242f},
-std::array<float,2>{0.13004747f, 0.974082708f},
-std::array<float,2>{0.906005025f, 0.0856517404f},
-std::array<float,2>{0.0180804674f, 0.170567289f},
-std::array<float,2>{0.78875649f, 0.823823214f},
-std::array<float,2>{0.31968984f, 0.651119709f},
-std::array<float,2>{0.745097697f, 0.266686767f},
-std::array<float,2>{0.282558084f, 0.0172448959f},
-std::array<float,2>{0.686581612f, 0.885008752f},
-std::array<float,2>{0.110142648f, 0.548024774f},
-std::array<float,2>{0.835392654f, 0.396410048f},
-std::array<float,2>{0.233475789f, 0.353968441f},
-std::array<float,2>{0.984483719f, 0.693501174f},
-std::array<float,2>{0.419297695f, 0.809568584f},
-std::array<float,2>{0.562755525f, 0.199447572f},
-std::array<float,2>{0.35056442f, 0.308717042f},
-std::array<float,2>{0.689349294f, 0.667482495f},
-std::array<float,2>{0.0490157306f, 0.859888256f},
-std::array<float,2>{0.751980126f, 0.151958883f},
-std::array<float,2>{0.165660664f, 0.12134628f},
-std::array<float,2>{0.927966893f, 0.952616215f},
-std::array<float,2>{0.445746273f, 0.595631659f},
-std::array<float,2>{0.53837359f, 0.473792285f},
-std::array<float,2>{0.395622432f, 0.241606221f},
-std::array<float,2>{0.601049602f, 0.774617493f},
-std::array<float,2>{0.196324259f, 0.735257566f},
-std::array<float,2>{0.941736162f, 0.323025376f},
-std::array<float,2>{0.0682714954f, 0.419517338f},
-std::array<float,2>{0.856537998f, 0.512242734f},
-std::array<float,2>{0.269863814f, 0.915847063f},
-std::array<float,2>{0.642026126f, 0.0321099684f},
-std::array<float,2>{0.438523382f, 0.278989255f},
-std::array<float,2>{0.54305613f, 0.643560886f},
-std::array<float,2>{0.162816569f, 0.820309758f},
-std::array<float,2>{0.935338259f, 0.157086298f},
-std::array<float,2>{0.0557169989f, 0.0906897187f},
-std::array<float,2>{0.758764863f, 0.982469201f},
-std::array<float,2>{0.351964831f, 0.562802374f},
-std::array<float,2>{0.696013987f, 0.46704331f},
-std::array<float,2>{0.279575109f, 0.192894384f},
-std::array<float,2>{0.648490787f, 0.798615813f},
-std::array<float,2>{0.0724291578f, 0.696548462f},
-std::array<float,2>{0.84713465f, 0.350229949f},
-std::array<float,2>{0.19511275f, 0.403005093f},
-std::array<float,2>{0.949247479f, 0.557672679f},
-std::array<float,2>{0.401799917f, 0.879060686f},
-std::array<float,2>{0.606854916f, 0.0280554555f},
-std::array<float,2>{0.326939762f, 0.476999998f},
-std::array<float,2>{0.73521775f, 0.602466941f},
-std::array<float,2>{0.0239920244f, 0.943414629f},
-std::array<float,2>{0.795917451f, 0.110486507f},
-std::array<float,2>{0.139130592f, 0.142412379f},
-std::array<float,2>{0.898224771f, 0.874737203f},
-std::array<float,2>{0.49412483f, 0.660812855f},
-std::array<float,2>{0.527234733f, 0.299054027f},
-std::array<float,2>{0.410151064f, 0.0463813767f},
-std::array<float,2>{0.576416969f, 0.912738085f},
-std::array<float,2>{0.224984691f, 0.506050289f},
-std::array<float,2>{0.996032238f, 0.410250425f},
-std::array<float,2>{0.119588874f, 0.319778532f},
-std::array<float,2>{0.839700818f, 0.746391833f},
-std::array<float,2>{0.290491343f, 0.767422378f},
-std::array<float,2>{0.673512638f, 0.246134758f},
-std::array<float,2>{0.390429318f, 0.434408903f},
-std::array<float,2>{0.612228036f, 0.521465838f},
-std::array<float,2>{0.212183967f, 0.923869193f},
-std::array<float,2>{0.964326501f, 0.0544023067f},
-std::array<float,2>{0.0875989273f, 0.232670993f},
-std::array<float,2>{0.862265527f, 0.764227092f},
-std::array<float,2>{0.257569611f, 0.72518158f},
-std::array<float,2>{0.632921696f, 0.335680872f},
-std::array<float,2>{0.361570567f, 0.101265863f},
-std::array<float,2>{0.712826908f, 0.964336693f},
-std::array<float,2>{0.0441954471f, 0.613944292f},
-std::array<float,2>{0.77897042f, 0.487731755f},
-std::array<float,2>{0.180591464f, 0.291243672f},
-std::array<float,2>{0.9154194f, 0.68353194f},
-std::array<float,2>{0.468551219f, 0.857855797f},
-std::array<float,2>{0.557138741f, 0.132473513f},
-std::array<float,2>{0.307202935f, 0.360811442f},
-std::array<float,2>{0.656334341f, 0.718659401f},
-std::array<float,2>{0.0984439403f, 0.781496763f},
-std::array<float,2>{0.812654555f, 0.206461236f},
-std::array<float,2>{0.237819359f, 0.0074596717f},
-std::array<float,2>{0.978339493f, 0.894111633f},
-std::array<float,2>{0.424455911f, 0.537973762f},
-std::array<float,2>{0.592609346f, 0.385999143f},
-std::array<float,2>{0.47676006f, 0.17448096f},
-std::array<float,2>{0.501736581f, 0.828146994f},
-std::array<float,2>{0.145311177f, 0.638244271f},
-std::array<float,2>{0.88759172f, 0.254776806f},
-std::array<float,2>{0.0154238325f, 0.446619391f},
-std::array<float,2>{0.799190402f, 0.581802845f},
-std::array<float,2>{0.329351455f, 0.989489317f},
-std::array<float,2>{0.728428841f, 0.073996067f},
-std::array<float,2>{0.403505802f, 0.286117077f},
-std::array<float,2>{0.601861358f, 0.675009608f},
-std::array<float,2>{0.189468428f, 0.850387692f},
-std::array<float,2>{0.946242869f, 0.139804214f},
-std::array<float,2>{0.0770081207f, 0.107311435f},
-std::array<float,2>{0.848949313f, 0.957869232f},
-std::array<float,2>{0.276463211f, 0.618011475f},
-std::array<float,2>{0.653032541f, 0.499627084f},
-std::array<float,2>{0.357285261f, 0.219804898f},
-std::array<float,2>{0.7001158f, 0.751829922f},
-std::array<float,2>{0.0586539321f, 0.733300447f},
-std::array<float,2>{0.76345098f, 0.338929802f},
-std::array<float,2>{0.158933476f, 0.425277829f},
-std::array<float,2>{0.93121922f, 0.526033342f},
-std::array<float,2>{0.444706023f, 0.937182963f},
-std::array<float,2>{0.542072713f, 0.0619766377f},
-std::array<float,2>{0.294582397f, 0.441618294f},
-std::array<float,2>{0.677007616f, 0.587115169f},
-std::array<float,2>{0.121819146f, 0.995019317f},
-std::array<float,2>{0.843209267f, 0.0694675744f},
-std::array<float,2>{0.222038209f, 0.186076984f},
-std::array<float,2>{0.999219894f, 0.838861346f},
-std::array<float,2>{0.412790149f, 0.625710428f},
-std::array<float,2>{0.571723878f, 0.262537986f},
-std::array<float,2>{0.497144282f, 0.0146536799f},
-std::array<float,2>{0.529807806f, 0.902094662f},
-std::array<float,2>{0.133380368f, 0.541277349f},
-std::array<float,2>{0.892971635f, 0.378653735f},
-std::array<float,2>{0.0274433643f, 0.3733643f},
-std::array<float,2>{0.789958477f, 0.708346605f},
-std::array<float,2>{0.321100622f, 0.794245005f},
-std::array<float,2>{0.741658747f, 0.216211721f},
-std::array<float,2>{0.462045908f, 0.392919302f},
-std::array<float,2>{0.55921948f, 0.55308181f},
-std::array<float,2>{0.18380405f, 0.888430893f},
-std::array<float,2>{0.921044588f, 0.0205773711f},
-std::array<float,2>{0.0420955159f, 0.19908981f},
-std::array<float,2>{0.775825858f, 0.806167483f},
-std::array<float,2>{0.365600288f, 0.688244283f},
-std::array<float,2>{0.717396855f, 0.3582353f},
-std::array<float,2>{0.25194037f, 0.0806972086f},
-std::array<float,2>{0.640360475f, 0.971924782f},
-std::array<float,2>{0.0923682675f, 0.574146986f},
-std::array<float,2>{0.8655563f, 0.457800627f},
-std::array<float,2>{0.215424553f, 0.272592247f},
-std::array<float,2>{0.967365324f, 0.655928552f},
-std::array<float,2>{0.385734737f, 0.827435434f},
-std::array<float,2>{0.615502596f, 0.164806396f},
-std::array<float,2>{0.333138317f, 0.324993551f},
-std::array<float,2>{0.731494665f, 0.741749942f},
-std::array<float,2>{0.0108713387f, 0.777915776f},
-std::array<float,2>{0.80167377f, 0.236406192f},
-std::array<float,2>{0.141350761f, 0.0390287489f},
-std::array<float,2>{0.884450912f, 0.92038244f},
-std::array<float,2>{0.482292056f, 0.510382593f},
-std::array<float,2>{0.505831659f, 0.417388439f},
-std::array<float,2>{0.428232521f, 0.152539983f},
-std::array<float,2>{0.589679778f, 0.867025316f},
-std::array<float,2>{0.238905832f, 0.670138836f},
-std::array<float,2>{0.980580389f, 0.308178335f},
-std::array<float,2>{0.0938527882f, 0.471850723f},
-std::array<float,2>{0.818884432f, 0.600302756f},
-std::array<float,2>{0.309097588f, 0.949069381f},
-std::array<float,2>{0.662216544f, 0.118312158f},
-std::array<float,2>{0.470987499f, 0.346546918f},
-std::array<float,2>{0.507873595f, 0.702738047f},
-std::array<float,2>{0.1509341f, 0.802994907f},
-std::array<float,2>{0.882248759f, 0.18990095f},
-std::array<float,2>{0.0022088699f, 0.0269679204f},
-std::array<float,2>{0.804691613f, 0.875128329f},
-std::array<float,2>{0.339327335f, 0.561686516f},
-std::array<float,2>{0.720158577f, 0.400812656f},
-std::array<float,2>{0.301030815f, 0.160996601f},
-std::array<float,2>{0.66752243f, 0.813851476f},
-std::array<float,2>{0.104157314f, 0.645496964f},
-std::array<float,2>{0.827034295f, 0.274230152f},
-std::array<float,2>{0.246247396f, 0.461970747f},
-std::array<float,2>{0.971380711f, 0.567370892f},
-std::array<float,2>{0.437247306f, 0.97837162f},
-std::array<float,2>{0.582771897f, 0.0874770656f},
-std::array<float,2>{0.368361801f, 0.409596264f},
-std::array<float,2>{0.705255926f, 0.503557682f},
-std::array<float,2>{0.036192961f, 0.909276485f},
-std::array<float,2>{0.768521547f, 0.0425852947f},
-std::array<float,2>{0.175198525f, 0.244106308f},
-std::array<float,2>{0.908858955f, 0.772814393f},
-std::array<float,2>{0.459800124f, 0.745735228f},
-std::array<float,2>{0.548696935f, 0.313667566f},
-std::array<float,2>{0.375145555f, 0.114706852f},
-std::array<float,2>{0.619344175f, 0.940372765f},
-std::array<float,2>{0.207206771f, 0.607572913f},
-std::array<float,2>{0.95892036f, 0.48048678f},
-std::array<float,2>{0.0812889412f, 0.304355234f},
-std::array<float,2>{0.868869007f, 0.65752393f},
-std::array<float,2>{0.264325619f, 0.869272888f},
-std::array<float,2>{0.629995108f, 0.147645116f},
-std::array<float,2>{0.414239109f, 0.489394724f},
-std::array<float,2>{0.569782674f, 0.610363603f},
-std::array<float,2>{0.227836639f, 0.966715693f},
-std::array<float,2>{0.992167056f, 0.097419709f},
-std::array<float,2>{0.114787623f, 0.125266269f},
-std::array<float,2>{0.829775155f, 0.852773905f},
-std::array<float,2>{0.285785347f, 0.684369802f},
-std::array<float,2>{0.681600511f, 0.295085788f},
-std::array<float,2>{0.313520133f, 0.0470337942f},
-std::array<float,2>{0.748426795f, 0.927255094f},
-std::array<float,2>{0.0215844698f, 0.519499004f},
-std::array<float,2>{0.782896459f, 0.432205081f},
-std::array<float,2>{0.125209048f, 0.328498423f},
-std::array<float,2>{0.90154928f, 0.719036222f},
-std::array<float,2>{0.487610668f, 0.759474695f},
-std::array<float,2>{0.518025458f, 0.229301721f},
-std::array<float,2>{0.265773684f, 0.251989394f},
-std::array<float,2>{0.647263288f, 0.6356408f},
-std::array<float,2>{0.0637570992f, 0.834015906f},
-std::array<float,2>{0.85483557f, 0.176472753f},
-std::array<float,2>{0.201110601f, 0.0774986446f},
-std::array<float,2>{0.939261019f, 0.986999035f},
-std::array<float,2>{0.391735166f, 0.582722425f},
-std::array<float,2>{0.59485805f, 0.451672107f},
-std::array<float,2>{0.452017725f, 0.210226923f},
-std::array<float,2>{0.531615734f, 0.78680402f},
-std::array<float,2>{0.169240072f, 0.711632967f},
-std::array<float,2>{0.923566341f, 0.366339087f},
-std::array<float,2>{0.0511989295f, 0.388837665f},
-std::array<float,2>{0.754705369f, 0.533448815f},
-std::array<float,2>{0.346650034f, 0.89787215f},
-std::array<float,2>{0.691426694f, 6.33687305e-05f},
-std::array<float,2>{0.424224168f, 0.361811131f},
-std::array<float,2>{0.592186511f, 0.716053188f},
-std::array<float,2>{0.237714499f, 0.785118937f},
-std::array<float,2>{0.977857709f, 0.20440729f},
-std::array<float,2>{0.0977221653f, 0.00516915554f},
-std::array<float,2>{0.813368082f, 0.892574608f},
-std::array<float,2>{0.307001263f, 0.53575933f},
-std::array<float,2>{0.657101452f, 0.384320676f},
-std::array<float,2>{0.32995227f, 0.172025397f},
-std::array<float,2>{0.727603257f, 0.831495345f},
-std::array<float,2>{0.0146533903f, 0.640443265f},
-std::array<float,2>{0.799544573f, 0.257096887f},
-std::array<float,2>{0.144774184f, 0.447739452f},
-std::array<float,2>{0.886958122f, 0.578783631f},
-std::array<float,2>{0.477106184f, 0.991450846f},
-std::array<float,2>{0.501139402f, 0.0707260817f},
-std::array<float,2>{0.257234544f, 0.437215f},
-std::array<float,2>{0.633355558f, 0.522678733f},
-std::array<float,2>{0.0871722326f, 0.921937644f},
-std::array<float,2>{0.861802995f, 0.0523646362f},
-std::array<float,2>{0.212622091f, 0.231003195f},
-std::array<float,2>{0.964450061f, 0.763513982f},
-std::array<float,2>{0.389851332f, 0.723088741f},
-std::array<float,2>{0.611658931f, 0.332952023f},
-std::array<float,2>{0.467978895f, 0.0981067047f},
-std::array<float,2>{0.556931436f, 0.961228788f},
-std::array<float,2>{0.179897979f, 0.615300834f},
-std::array<float,2>{0.915633857f, 0.484660625f},
-std::array<float,2>{0.0444808044f, 0.29011932f},
-std::array<float,2>{0.778747559f, 0.680038452f},
-std::array<float,2>{0.361920089f, 0.855477691f},
-std::array<float,2>{0.712099731f, 0.129626676f},
-std::array<float,2>{0.493575841f, 0.478571177f},
-std::array<float,2>{0.526623607f, 0.60497725f},
-std::array<float,2>{0.139345258f, 0.942427456f},
-std::array<float,2>{0.897805989f, 0.113165587f},
-std::array<float,2>{0.0237905849f, 0.144198105f},
-std::array<float,2>{0.796848297f, 0.871760309f},
-std::array<float,2>{0.326205254f, 0.662609577f},
-std::array<float,2>{0.734573185f, 0.298560679f},
-std::array<float,2>{0.290764004f, 0.0443847626f},
-std::array<float,2>{0.673018634f, 0.911170125f},
-std::array<float,2>{0.120066434f, 0.50397253f},
-std::array<float,2>{0.839347839f, 0.413346678f},
-std::array<float,2>{0.225459307f, 0.316581398f},
-std::array<float,2>{0.995523453f, 0.748375297f},
-std::array<float,2>{0.409299642f, 0.768001199f},
-std::array<float,2>{0.576850235f, 0.248171985f},
-std::array<float,2>{0.352360845f, 0.279379696f},
-std::array<float,2>{0.695376575f, 0.640964746f},
-std::array<float,2>{0.0563772842f, 0.817827106f},
-std::array<float,2>{0.757838905f, 0.159464583f},
-std::array<float,2>{0.162124783f, 0.0922463089f},
-std::array<float,2>{0.934946775f, 0.98052007f},
-std::array<float,2>{0.438975573f, 0.564650536f},
-std::array<float,2>{0.543903708f, 0.465562224f},
-std::array<float,2>{0.402136177f, 0.195144668f},
-std::array<float,2>{0.607017398f, 0.800667584f},
-std::array<float,2>{0.194607586f, 0.698055625f},
-std::array<float,2>{0.950143814f, 0.349190146f},
-std::array<float,2>{0.072944358f, 0.405089319f},
-std::array<float,2>{0.847455323f, 0.555314481f},
-std::array<float,2>{0.280197918f, 0.882401824f},
-std::array<float,2>{0.649274766f, 0.0295382068f},
-std::array<float,2>{0.446288288f, 0.311607718f},
-std::array<float,2>{0.53898859f, 0.664437115f},
-std::array<float,2>{0.165384024f, 0.862281859f},
-std::array<float,2>{0.928426802f, 0.150302753f},
-std::array<float,2>{0.0493730046f, 0.124730691f},
-std::array<float,2>{0.752786517f, 0.950729609f},
-std::array<float,2>{0.349820852f, 0.597126245f},
-std::array<float,2>{0.688723028f, 0.475927204f},
-std::array<float,2>{0.270309746f, 0.238732338f},
-std::array<float,2>{0.642275214f, 0.776843965f},
-std::array<float,2>{0.0673844218f, 0.73797363f},
-std::array<float,2>{0.857351601f, 0.321411431f},
-std::array<float,2>{0.197258562f, 0.419994622f},
-std::array<float,2>{0.941964924f, 0.515325665f},
-std::array<float,2>{0.396094233f, 0.916058898f},
-std::array<float,2>{0.601226389f, 0.0334316008f},
-std::array<float,2>{0.319830596f, 0.454703093f},
-std::array<float,2>{0.744285464f, 0.576255858f},
-std::array<float,2>{0.0180437621f, 0.975280523f},
-std::array<float,2>{0.788250744f, 0.0837868452f},
-std::array<float,2>{0.13068521f, 0.169364944f},
-std::array<float,2>{0.905561924f, 0.822043121f},
-std::array<float,2>{0.490758449f, 0.648726285f},
-std::array<float,2>{0.521763802f, 0.267607123f},
-std::array<float,2>{0.419862777f, 0.0176530685f},
-std::array<float,2>{0.563278854f, 0.884732842f},
-std::array<float,2>{0.23401165f, 0.549376607f},
-std::array<float,2>{0.984949946f, 0.398003966f},
-std::array<float,2>{0.10975863f, 0.351614118f},
-std::array<float,2>{0.835875273f, 0.692952514f},
-std::array<float,2>{0.282725185f, 0.811307847f},
-std::array<float,2>{0.687332511f, 0.201843455f},
-std::array<float,2>{0.380262911f, 0.382514775f},
-std::array<float,2>{0.624857128f, 0.544620037f},
-std::array<float,2>{0.206619561f, 0.902394295f},
-std::array<float,2>{0.956389725f, 0.00812859926f},
-std::array<float,2>{0.0839937702f, 0.21314013f},
-std::array<float,2>{0.873296976f, 0.789657831f},
-std::array<float,2>{0.259495199f, 0.706219256f},
-std::array<float,2>{0.625874162f, 0.368541002f},
-std::array<float,2>{0.374033034f, 0.0659464449f},
-std::array<float,2>{0.708278418f, 0.996151447f},
-std::array<float,2>{0.0317789726f, 0.590749145f},
-std::array<float,2>{0.771987081f, 0.440159142f},
-std::array<float,2>{0.17616652f, 0.260052443f},
-std::array<float,2>{0.910880864f, 0.630639255f},
-std::array<float,2>{0.453460395f, 0.841881096f},
-std::array<float,2>{0.552655697f, 0.180329025f},
-std::array<float,2>{0.296975672f, 0.343507797f},
-std::array<float,2>{0.669581175f, 0.727671862f},
-std::array<float,2>{0.107063748f, 0.757198393f},
-std::array<float,2>{0.823275983f, 0.223576725f},
-std::array<float,2>{0.243343964f, 0.0555503964f},
-std::array<float,2>{0.976114333f, 0.932124197f},
-std::array<float,2>{0.433305591f, 0.529092968f},
-std::array<float,2>{0.581388414f, 0.42766872f},
-std::array<float,2>{0.473489583f, 0.132891744f},
-std::array<float,2>{0.515422821f, 0.846986353f},
-std::array<float,2>{0.156190366f, 0.67719394f},
-std::array<float,2>{0.875261486f, 0.282687038f},
-std::array<float,2>{0.00559564121f, 0.49583894f},
-std::array<float,2>{0.811392486f, 0.624024749f},
-std::array<float,2>{0.342718124f, 0.95692724f},
-std::array<float,2>{0.724820912f, 0.102433987f},
-std::array<float,2>{0.392432392f, 0.251469493f},
-std::array<float,2>{0.595694542f, 0.633785248f},
-std::array<float,2>{0.200549453f, 0.833277941f},
-std::array<float,2>{0.938585401f, 0.178715587f},
-std::array<float,2>{0.0643028468f, 0.0745118931f},
-std::array<float,2>{0.855312645f, 0.985973895f},
-std::array<float,2>{0.266394496f, 0.584855855f},
-std::array<float,2>{0.646827936f, 0.450319797f},
-std::array<float,2>{0.346185297f, 0.208873793f},
-std::array<float,2>{0.691973746f, 0.787422717f},
-std::array<float,2>{0.0513824299f, 0.714296162f},
-std::array<float,2>{0.753950357f, 0.363483876f},
-std::array<float,2>{0.169834808f, 0.386864811f},
-std::array<float,2>{0.922873139f, 0.531864285f},
-std::array<float,2>{0.451345205f, 0.896222949f},
-std::array<float,2>{0.531751037f, 0.00237306859f},
-std::array<float,2>{0.285556465f, 0.491072893f},
-std::array<float,2>{0.680901587f, 0.6125862f},
-std::array<float,2>{0.114307895f, 0.967614412f},
-std::array<float,2>{0.82913053f, 0.0953619182f},
-std::array<float,2>{0.228168041f, 0.128399417f},
-std::array<float,2>{0.991538286f, 0.855012774f},
-std::array<float,2>{0.414637834f, 0.687103748f},
-std::array<float,2>{0.569972456f, 0.294182092f},
-std::array<float,2>{0.488271296f, 0.0504341573f},
-std::array<float,2>{0.518234491f, 0.928983867f},
-std::array<float,2>{0.125600517f, 0.516299188f},
-std::array<float,2>{0.902289212f, 0.430033416f},
-std::array<float,2>{0.0220990349f, 0.331713468f},
-std::array<float,2>{0.782415092f, 0.722197533f},
-std::array<float,2>{0.314199656f, 0.761058271f},
-std::array<float,2>{0.748693168f, 0.227995083f},
-std::array<float,2>{0.459313065f, 0.407102674f},
-std::array<float,2>{0.548306882f, 0.500003457f},
-std::array<float,2>{0.175294027f, 0.907903016f},
-std::array<float,2>{0.908625305f, 0.0391389653f},
-std::array<float,2>{0.0369476862f, 0.245046392f},
-std::array<float,2>{0.767808855f, 0.770595431f},
-std::array<float,2>{0.368830264f, 0.742754281f},
-std::array<float,2>{0.705684483f, 0.315360099f},
-std::array<float,2>{0.263725162f, 0.116208747f},
-std::array<float,2>{0.630712032f, 0.938451827f},
-std::array<float,2>{0.0817963406f, 0.606724799f},
-std::array<float,2>{0.868543088f, 0.482891768f},
-std::array<float,2>{0.207928896f, 0.301408857f},
-std::array<float,2>{0.958322525f, 0.658460379f},
-std::array<float,2>{0.375678539f, 0.869125962f},
-std::array<float,2>{0.620081961f, 0.144935042f},
-std::array<float,2>{0.339622796f, 0.344260722f},
-std::array<float,2>{0.720688879f, 0.700363159f},
-std::array<float,2>{0.00288746343f, 0.80222404f},
-std::array<float,2>{0.805501819f, 0.189059585f},
-std::array<float,2>{0.150628552f, 0.0236856733f},
-std::array<float,2>{0.882448852f, 0.87834692f},
-std::array<float,2>{0.471644431f, 0.55997175f},
-std::array<float,2>{0.508562028f, 0.399567187f},
-std::array<float,2>{0.437000483f, 0.162542135f},
-std::array<float,2>{0.582112432f, 0.815193772f},
-std::array<float,2>{0.246883363f, 0.647468269f},
-std::array<float,2>{0.97078073f, 0.275993854f},
-std::array<float,2>{0.103602029f, 0.462997794f},
-std::array<float,2>{0.826518834f, 0.569821537f},
-std::array<float,2>{0.301682383f, 0.979557753f},
-std::array<float,2>{0.667310119f, 0.0897859931f},
-std::array<float,2>{0.481669039f, 0.326417983f},
-std::array<float,2>{0.505240917f, 0.738321006f},
-std::array<float,2>{0.141001761f, 0.77968508f},
-std::array<float,2>{0.883852899f, 0.234982863f},
-std::array<float,2>{0.0113226902f, 0.0355675779f},
-std::array<float,2>{0.80101043f, 0.919567943f},
-std::array<float,2>{0.333886027f, 0.509472549f},
-std::array<float,2>{0.732144594f, 0.414991736f},
-std::array<float,2>{0.308795273f, 0.154854029f},
-std::array<float,2>{0.662801743f, 0.86418128f},
-std::array<float,2>{0.0942513645f, 0.668481112f},
-std::array<float,2>{0.818645835f, 0.30543676f},
-std::array<float,2>{0.238647521f, 0.470563591f},
-std::array<float,2>{0.98140049f, 0.597687721f},
-std::array<float,2>{0.427937269f, 0.94620049f},
-std::array<float,2>{0.589001f, 0.119289257f},
-std::array<float,2>{0.366142124f, 0.391055137f},
-std::array<float,2>{0.716901898f, 0.55124867f},
-std::array<float,2>{0.0427691862f, 0.890205324f},
-std::array<float,2>{0.775985956f, 0.0232157614f},
-std::array<float,2>{0.184567288f, 0.196322322f},
-std::array<float,2>{0.92143482f, 0.808540046f},
-std::array<float,2>{0.462794662f, 0.690161288f},
-std::array<float,2>{0.559060693f, 0.355969638f},
-std::array<float,2>{0.385117352f, 0.0781419128f},
-std::array<float,2>{0.615954638f, 0.970432937f},
-std::array<float,2>{0.215082943f, 0.57068646f},
-std::array<float,2>{0.96699667f, 0.460696369f},
-std::array<float,2>{0.0919672102f, 0.270335436f},
-std::array<float,2>{0.86606288f, 0.652797401f},
-std::array<float,2>{0.251101673f, 0.824765086f},
-std::array<float,2>{0.639995277f, 0.166903317f},
-std::array<float,2>{0.412510991f, 0.444392174f},
-std::array<float,2>{0.572186291f, 0.588831007f},
-std::array<float,2>{0.222546622f, 0.992740393f},
-std::array<float,2>{0.999640584f, 0.0671335831f},
-std::array<float,2>{0.121095054f, 0.185175329f},
-std::array<float,2>{0.84342283f, 0.836271942f},
-std::array<float,2>{0.294170469f, 0.628077209f},
-std::array<float,2>{0.677726269f, 0.264372468f},
-std::array<float,2>{0.320501179f, 0.012546299f},
-std::array<float,2>{0.742019713f, 0.898986638f},
-std::array<float,2>{0.028029792f, 0.540963113f},
-std::array<float,2>{0.78949523f, 0.375743091f},
-std::array<float,2>{0.133261725f, 0.372511446f},
-std::array<float,2>{0.893081784f, 0.709748149f},
-std::array<float,2>{0.497736424f, 0.795994043f},
-std::array<float,2>{0.529330373f, 0.218017742f},
-std::array<float,2>{0.277047515f, 0.288804799f},
-std::array<float,2>{0.652699709f, 0.672930658f},
-std::array<float,2>{0.0763742104f, 0.849398613f},
-std::array<float,2>{0.849397063f, 0.138033286f},
-std::array<float,2>{0.190061018f, 0.108849622f},
-std::array<float,2>{0.945529699f, 0.960667312f},
-std::array<float,2>{0.403941423f, 0.619985819f},
-std::array<float,2>{0.602141857f, 0.497111291f},
-std::array<float,2>{0.44510299f, 0.222185105f},
-std::array<float,2>{0.542884469f, 0.752501309f},
-std::array<float,2>{0.158680707f, 0.731047153f},
-std::array<float,2>{0.930812597f, 0.337128848f},
-std::array<float,2>{0.0592772141f, 0.422867328f},
-std::array<float,2>{0.762880087f, 0.525034428f},
-std::array<float,2>{0.356795013f, 0.935383797f},
-std::array<float,2>{0.699475348f, 0.0590706542f},
-std::array<float,2>{0.387937337f, 0.335427254f},
-std::array<float,2>{0.609502375f, 0.724667013f},
-std::array<float,2>{0.214014769f, 0.763853252f},
-std::array<float,2>{0.9611395f, 0.233139351f},
-std::array<float,2>{0.0883393064f, 0.0539975837f},
-std::array<float,2>{0.859827399f, 0.924564481f},
-std::array<float,2>{0.255063385f, 0.520620584f},
-std::array<float,2>{0.635495722f, 0.433704466f},
-std::array<float,2>{0.360952407f, 0.131995961f},
-std::array<float,2>{0.713265479f, 0.858299792f},
-std::array<float,2>{0.0450154729f, 0.68295002f},
-std::array<float,2>{0.781193137f, 0.291585267f},
-std::array<float,2>{0.183372721f, 0.488066316f},
-std::array<float,2>{0.917361259f, 0.613407314f},
-std::array<float,2>{0.466670066f, 0.964788556f},
-std::array<float,2>{0.554976404f, 0.100913547f},
-std::array<float,2>{0.305204839f, 0.386689603f},
-std::array<float,2>{0.65905273f, 0.537262678f},
-std::array<float,2>{0.100691564f, 0.893973947f},
-std::array<float,2>{0.815069675f, 0.00693496456f},
-std::array<float,2>{0.235003367f, 0.206763789f},
-std::array<float,2>{0.978823006f, 0.78221184f},
-std::array<float,2>{0.422146797f, 0.7180897f},
-std::array<float,2>{0.591530442f, 0.360852361f},
-std::array<float,2>{0.480319142f, 0.0735565871f},
-std::array<float,2>{0.503666103f, 0.989985645f},
-std::array<float,2>{0.14841041f, 0.581468225f},
-std::array<float,2>{0.890196145f, 0.447263688f},
-std::array<float,2>{0.0120906727f, 0.253910244f},
-std::array<float,2>{0.798201025f, 0.638119459f},
-std::array<float,2>{0.331199735f, 0.828671873f},
-std::array<float,2>{0.72982043f, 0.174153209f},
-std::array<float,2>{0.440662801f, 0.467514157f},
-std::array<float,2>{0.546810746f, 0.563334346f},
-std::array<float,2>{0.161503837f, 0.983154297f},
-std::array<float,2>{0.936104178f, 0.090290904f},
-std::array<float,2>{0.0574910939f, 0.156573504f},
-std::array<float,2>{0.761475861f, 0.819808722f},
-std::array<float,2>{0.354183882f, 0.644171417f},
-std::array<float,2>{0.697836876f, 0.278404504f},
-std::array<float,2>{0.278315365f, 0.0274915732f},
-std::array<float,2>{0.651760697f, 0.87978524f},
-std::array<float,2>{0.071759358f, 0.558449268f},
-std::array<float,2>{0.844319344f, 0.402615488f},
-std::array<float,2>{0.193293691f, 0.349877656f},
-std::array<float,2>{0.951979816f, 0.696852624f},
-std::array<float,2>{0.399540871f, 0.797955096f},
-std::array<float,2>{0.60777998f, 0.192592725f},
-std::array<float,2>{0.324561119f, 0.299707204f},
-std::array<float,2>{0.736689091f, 0.660412669f},
-std::array<float,2>{0.0260651037f, 0.874394476f},
-std::array<float,2>{0.793621421f, 0.141857371f},
-std::array<float,2>{0.13773571f, 0.110976256f},
-std::array<float,2>{0.895926237f, 0.944286227f},
-std::array<float,2>{0.495041937f, 0.601655424f},
-std::array<float,2>{0.524276853f, 0.477292687f},
-std::array<float,2>{0.407432318f, 0.24701333f},
-std::array<float,2>{0.574769557f, 0.766615927f},
-std::array<float,2>{0.223122731f, 0.746685803f},
-std::array<float,2>{0.993812203f, 0.320076942f},
-std::array<float,2>{0.118292391f, 0.410675228f},
-std::array<float,2>{0.837229371f, 0.50678122f},
-std::array<float,2>{0.291748405f, 0.912469804f},
-std::array<float,2>{0.674298525f, 0.0467248894f},
-std::array<float,2>{0.488458514f, 0.267335415f},
-std::array<float,2>{0.521037221f, 0.650530219f},
-std::array<float,2>{0.131971315f, 0.823582172f},
-std::array<float,2>{0.902535021f, 0.170150176f},
-std::array<float,2>{0.0171681084f, 0.0853046477f},
-std::array<float,2>{0.786179423f, 0.974285543f},
-std::array<float,2>{0.316743821f, 0.575460494f},
-std::array<float,2>{0.742875814f, 0.455606252f},
-std::array<float,2>{0.28469035f, 0.199738517f},
-std::array<float,2>{0.68380785f, 0.808638632f},
-std::array<float,2>{0.112582736f, 0.693975091f},
-std::array<float,2>{0.832724452f, 0.354355156f},
-std::array<float,2>{0.232015476f, 0.395660669f},
-std::array<float,2>{0.986501753f, 0.548570931f},
-std::array<float,2>{0.421389222f, 0.88532728f},
-std::array<float,2>{0.566376328f, 0.0168177821f},
-std::array<float,2>{0.349389493f, 0.474305451f},
-std::array<float,2>{0.690756142f, 0.594919145f},
-std::array<float,2>{0.0482562631f, 0.95302093f},
-std::array<float,2>{0.7503708f, 0.121741705f},
-std::array<float,2>{0.16771993f, 0.151474684f},
-std::array<float,2>{0.927247465f, 0.859385788f},
-std::array<float,2>{0.448671609f, 0.667103767f},
-std::array<float,2>{0.536117196f, 0.309257537f},
-std::array<float,2>{0.397550076f, 0.0316909291f},
-std::array<float,2>{0.599142909f, 0.915297806f},
-std::array<float,2>{0.198957801f, 0.512003243f},
-std::array<float,2>{0.943935752f, 0.419147879f},
-std::array<float,2>{0.0687818304f, 0.322469026f},
-std::array<float,2>{0.858924448f, 0.734715939f},
-std::array<float,2>{0.271760046f, 0.774918079f},
-std::array<float,2>{0.642724156f, 0.241955847f},
-std::array<float,2>{0.430080235f, 0.427800119f},
-std::array<float,2>{0.578290582f, 0.530473351f},
-std::array<float,2>{0.244311988f, 0.931069136f},
-std::array<float,2>{0.97319603f, 0.0569176152f},
-std::array<float,2>{0.108846694f, 0.226179302f},
-std::array<float,2>{0.821930051f, 0.754168272f},
-std::array<float,2>{0.299201071f, 0.729800045f},
-std::array<float,2>{0.671456099f, 0.340441734f},
-std::array<float,2>{0.341592014f, 0.104674861f},
-std::array<float,2>{0.72338742f, 0.953802645f},
-std::array<float,2>{0.00614776416f, 0.622509956f},
-std::array<float,2>{0.808773935f, 0.493131936f},
-std::array<float,2>{0.153457999f, 0.284463227f},
-std::array<float,2>{0.877343357f, 0.678806841f},
-std::array<float,2>{0.475471705f, 0.84505266f},
-std::array<float,2>{0.513101101f, 0.134832844f},
-std::array<float,2>{0.260169983f, 0.370970458f},
-std::array<float,2>{0.628514767f, 0.704424679f},
-std::array<float,2>{0.0836064741f, 0.791439652f},
-std::array<float,2>{0.87119168f, 0.211468816f},
-std::array<float,2>{0.203148618f, 0.0105490144f},
-std::array<float,2>{0.954625309f, 0.904928565f},
-std::array<float,2>{0.381336659f, 0.54505229f},
-std::array<float,2>{0.621608555f, 0.379955798f},
-std::array<float,2>{0.456586331f, 0.182592124f},
-std::array<float,2>{0.553365171f, 0.84104079f},
-std::array<float,2>{0.179154038f, 0.632752538f},
-std::array<float,2>{0.913091362f, 0.258500129f},
-std::array<float,2>{0.0333458744f, 0.437974513f},
-std::array<float,2>{0.769658387f, 0.591933131f},
-std::array<float,2>{0.372108817f, 0.999305248f},
-std::array<float,2>{0.709547997f, 0.0641671121f},
-std::array<float,2>{0.416140705f, 0.295477957f},
-std::array<float,2>{0.568164706f, 0.683781862f},
-std::array<float,2>{0.228815854f, 0.853327513f},
-std::array<float,2>{0.988599181f, 0.125858799f},
-std::array<float,2>{0.116683684f, 0.0969785303f},
-std::array<float,2>{0.831684291f, 0.965970993f},
-std::array<float,2>{0.287248343f, 0.611162126f},
-std::array<float,2>{0.683124661f, 0.489806265f},
-std::array<float,2>{0.315390319f, 0.228632972f},
-std::array<float,2>{0.746578574f, 0.758863389f},
-std::array<float,2>{0.0200631078f, 0.719664633f},
-std::array<float,2>{0.783679605f, 0.328627735f},
-std::array<float,2>{0.127849638f, 0.432036102f},
-std::array<float,2>{0.899450898f, 0.518846452f},
-std::array<float,2>{0.48630026f, 0.926916599f},
-std::array<float,2>{0.517122507f, 0.0477160439f},
-std::array<float,2>{0.268199772f, 0.451283991f},
-std::array<float,2>{0.645536184f, 0.582075894f},
-std::array<float,2>{0.0644846261f, 0.986530066f},
-std::array<float,2>{0.853087127f, 0.0779270753f},
-std::array<float,2>{0.201875404f, 0.176010862f},
-std::array<float,2>{0.940526366f, 0.834577739f},
-std::array<float,2>{0.394342065f, 0.634957433f},
-std::array<float,2>{0.595765352f, 0.252773106f},
-std::array<float,2>{0.450440079f, 0.000670523616f},
-std::array<float,2>{0.533215582f, 0.898076117f},
-std::array<float,2>{0.171397939f, 0.533855855f},
-std::array<float,2>{0.92416811f, 0.389491826f},
-std::array<float,2>{0.0529777631f, 0.367042601f},
-std::array<float,2>{0.756314754f, 0.711212933f},
-std::array<float,2>{0.344839424f, 0.786362112f},
-std::array<float,2>{0.694039106f, 0.210913956f},
-std::array<float,2>{0.469643563f, 0.401112914f},
-std::array<float,2>{0.511008441f, 0.562059939f},
-std::array<float,2>{0.149039567f, 0.875850677f},
-std::array<float,2>{0.879802108f, 0.0264602862f},
-std::array<float,2>{0.0010286941f, 0.190246955f},
-std::array<float,2>{0.807332635f, 0.803700566f},
-std::array<float,2>{0.337162703f, 0.702458918f},
-std::array<float,2>{0.722417295f, 0.346095294f},
-std::array<float,2>{0.303903043f, 0.0870275348f},
-std::array<float,2>{0.665003538f, 0.977572083f},
-std::array<float,2>{0.101900578f, 0.566713154f},
-std::array<float,2>{0.825930297f, 0.462713242f},
-std::array<float,2>{0.249904007f, 0.273474008f},
-std::array<float,2>{0.969970882f, 0.64453882f},
-std::array<float,2>{0.43522051f, 0.814158261f},
-std::array<float,2>{0.585869551f, 0.160237819f},
-std::array<float,2>{0.370660335f, 0.314249307f},
-std::array<float,2>{0.70354259f, 0.745380163f},
-std::array<float,2>{0.0380058214f, 0.773138285f},
-std::array<float,2>{0.766554892f, 0.24335295f},
-std::array<float,2>{0.172719061f, 0.0421427712f},
-std::array<float,2>{0.907121241f, 0.909973741f},
-std::array<float,2>{0.458547086f, 0.503107786f},
-std::array<float,2>{0.550070107f, 0.409814715f},
-std::array<float,2>{0.378032386f, 0.147974238f},
-std::array<float,2>{0.617923498f, 0.869630992f},
-std::array<float,2>{0.210580885f, 0.658094466f},
-std::array<float,2>{0.959310651f, 0.304171026f},
-std::array<float,2>{0.0784386918f, 0.481132209f},
-std::array<float,2>{0.869817197f, 0.608217359f},
-std::array<float,2>{0.263170034f, 0.93960917f},
-std::array<float,2>{0.632069647f, 0.114755586f},
-std::array<float,2>{0.464618117f, 0.357857674f},
-std::array<float,2>{0.561733961f, 0.687518239f},
-std::array<float,2>{0.186151862f, 0.806002915f},
-std::array<float,2>{0.919372916f, 0.198374584f},
-std::array<float,2>{0.0398987941f, 0.0211994592f},
-std::array<float,2>{0.774361849f, 0.887885273f},
-std::array<float,2>{0.364490449f, 0.553548038f},
-std::array<float,2>{0.715101123f, 0.393431723f},
-std::array<float,2>{0.252827853f, 0.164211482f},
-std::array<float,2>{0.638060093f, 0.82802403f},
-std::array<float,2>{0.0908795595f, 0.655434787f},
-std::array<float,2>{0.863969386f, 0.27324903f},
-std::array<float,2>{0.217146575f, 0.457227468f},
-std::array<float,2>{0.966132641f, 0.573284686f},
-std::array<float,2>{0.38315165f, 0.972270012f},
-std::array<float,2>{0.613616049f, 0.0805251375f},
-std::array<float,2>{0.335129529f, 0.417516947f},
-std::array<float,2>{0.732938766f, 0.510109723f},
-std::array<float,2>{0.0097055994f, 0.920518637f},
-std::array<float,2>{0.803188026f, 0.0384419151f},
-std::array<float,2>{0.143752158f, 0.236839935f},
-std::array<float,2>{0.886106908f, 0.777644396f},
-std::array<float,2>{0.483309507f, 0.741364896f},
-std::array<float,2>{0.507023394f, 0.324546844f},
-std::array<float,2>{0.426610082f, 0.118704796f},
-std::array<float,2>{0.587767899f, 0.948498368f},
-std::array<float,2>{0.242122039f, 0.599868834f},
-std::array<float,2>{0.983905792f, 0.472225428f},
-std::array<float,2>{0.0962497815f, 0.307688624f},
-std::array<float,2>{0.817735672f, 0.670564294f},
-std::array<float,2>{0.310730815f, 0.866577208f},
-std::array<float,2>{0.661095858f, 0.152964175f},
-std::array<float,2>{0.405243367f, 0.499213338f},
-std::array<float,2>{0.604462564f, 0.6175493f},
-std::array<float,2>{0.187608272f, 0.957118869f},
-std::array<float,2>{0.947544217f, 0.106655419f},
-std::array<float,2>{0.0749012306f, 0.140327692f},
-std::array<float,2>{0.851419449f, 0.849836171f},
-std::array<float,2>{0.273947418f, 0.675662458f},
-std::array<float,2>{0.655230284f, 0.285179555f},
-std::array<float,2>{0.358109921f, 0.0623000525f},
-std::array<float,2>{0.701297879f, 0.936738729f},
-std::array<float,2>{0.0614500642f, 0.525776207f},
-std::array<float,2>{0.764614463f, 0.425397158f},
-std::array<float,2>{0.156996176f, 0.339682817f},
-std::array<float,2>{0.93328923f, 0.732845843f},
-std::array<float,2>{0.443259567f, 0.751384854f},
-std::array<float,2>{0.539805591f, 0.220612884f},
-std::array<float,2>{0.295222789f, 0.261837423f},
-std::array<float,2>{0.678442597f, 0.625235379f},
-std::array<float,2>{0.123076141f, 0.838116884f},
-std::array<float,2>{0.841098845f, 0.185981557f},
-std::array<float,2>{0.220605612f, 0.0701083615f},
-std::array<float,2>{0.99801904f, 0.994558692f},
-std::array<float,2>{0.41161108f, 0.587463617f},
-std::array<float,2>{0.573856413f, 0.442156523f},
-std::array<float,2>{0.499744266f, 0.216669917f},
-std::array<float,2>{0.528450906f, 0.794836283f},
-std::array<float,2>{0.136366606f, 0.70865643f},
-std::array<float,2>{0.891732931f, 0.373636931f},
-std::array<float,2>{0.03000875f, 0.377969086f},
-std::array<float,2>{0.792155564f, 0.541985393f},
-std::array<float,2>{0.323565751f, 0.901650846f},
-std::array<float,2>{0.740137994f, 0.0154193882f},
-std::array<float,2>{0.399297535f, 0.347740591f},
-std::array<float,2>{0.609041452f, 0.6990453f},
-std::array<float,2>{0.192072928f, 0.799144685f},
-std::array<float,2>{0.952920377f, 0.194045559f},
-std::array<float,2>{0.0711434782f, 0.0311714076f},
-std::array<float,2>{0.844912708f, 0.881689668f},
-std::array<float,2>{0.279043257f, 0.556433618f},
-std::array<float,2>{0.651119888f, 0.405491203f},
-std::array<float,2>{0.355141908f, 0.158961475f},
-std::array<float,2>{0.698913932f, 0.816801131f},
-std::array<float,2>{0.0580354333f, 0.642113924f},
-std::array<float,2>{0.7599985f, 0.280949116f},
-std::array<float,2>{0.160580605f, 0.466487765f},
-std::array<float,2>{0.936809421f, 0.565820694f},
-std::array<float,2>{0.439911604f, 0.981883943f},
-std::array<float,2>{0.545158684f, 0.0936676562f},
-std::array<float,2>{0.292038471f, 0.412238151f},
-std::array<float,2>{0.675096154f, 0.505171418f},
-std::array<float,2>{0.117905192f, 0.910504878f},
-std::array<float,2>{0.836340666f, 0.043396607f},
-std::array<float,2>{0.224514559f, 0.249928087f},
-std::array<float,2>{0.993093669f, 0.769242287f},
-std::array<float,2>{0.406926602f, 0.749931097f},
-std::array<float,2>{0.575445116f, 0.318184018f},
-std::array<float,2>{0.495660394f, 0.111591585f},
-std::array<float,2>{0.525316656f, 0.942078412f},
-std::array<float,2>{0.137468144f, 0.604324877f},
-std::array<float,2>{0.894860029f, 0.479784012f},
-std::array<float,2>{0.0267376341f, 0.297030985f},
-std::array<float,2>{0.794707119f, 0.663901031f},
-std::array<float,2>{0.325918317f, 0.872718751f},
-std::array<float,2>{0.737750292f, 0.143117234f},
-std::array<float,2>{0.465717554f, 0.485529244f},
-std::array<float,2>{0.555996954f, 0.617062628f},
-std::array<float,2>{0.181937426f, 0.962732732f},
-std::array<float,2>{0.916823745f, 0.0988554433f},
-std::array<float,2>{0.0459950939f, 0.130434111f},
-std::array<float,2>{0.779558837f, 0.857156098f},
-std::array<float,2>{0.359634191f, 0.681635201f},
-std::array<float,2>{0.714709103f, 0.28958109f},
-std::array<float,2>{0.254610717f, 0.0512705147f},
-std::array<float,2>{0.635857761f, 0.923169851f},
-std::array<float,2>{0.0889900327f, 0.521829426f},
-std::array<float,2>{0.860562801f, 0.436437696f},
-std::array<float,2>{0.213250786f, 0.33340472f},
-std::array<float,2>{0.96255964f, 0.724073887f},
-std::array<float,2>{0.387537211f, 0.761874318f},
-std::array<float,2>{0.610571504f, 0.232389897f},
-std::array<float,2>{0.330980033f, 0.256633162f},
-std::array<float,2>{0.72902751f, 0.639504015f},
-std::array<float,2>{0.0129360938f, 0.830444753f},
-std::array<float,2>{0.797519565f, 0.173460186f},
-std::array<float,2>{0.147350118f, 0.0716527849f},
-std::array<float,2>{0.88923043f, 0.990310729f},
-std::array<float,2>{0.479336143f, 0.579830348f},
-std::array<float,2>{0.501981616f, 0.448377341f},
-std::array<float,2>{0.423407316f, 0.20384489f},
-std::array<float,2>{0.590399325f, 0.783422172f},
-std::array<float,2>{0.235508338f, 0.71502316f},
-std::array<float,2>{0.980397701f, 0.362342328f},
-std::array<float,2>{0.100578822f, 0.382868439f},
-std::array<float,2>{0.816355705f, 0.536943972f},
-std::array<float,2>{0.306221992f, 0.891013384f},
-std::array<float,2>{0.659285486f, 0.00392313581f},
-std::array<float,2>{0.476372927f, 0.281852782f},
-std::array<float,2>{0.511787295f, 0.676692069f},
-std::array<float,2>{0.153294533f, 0.846562028f},
-std::array<float,2>{0.878383696f, 0.134226948f},
-std::array<float,2>{0.00743468432f, 0.102664858f},
-std::array<float,2>{0.810402453f, 0.955143213f},
-std::array<float,2>{0.340468377f, 0.623273194f},
-std::array<float,2>{0.723694324f, 0.495038569f},
-std::array<float,2>{0.300362498f, 0.224410564f},
-std::array<float,2>{0.670270622f, 0.756786764f},
-std::array<float,2>{0.107480362f, 0.727181911f},
-std::array<float,2>{0.82086283f, 0.342199624f},
-std::array<float,2>{0.245583147f, 0.426390946f},
-std::array<float,2>{0.974107563f, 0.528003216f},
-std::array<float,2>{0.431237936f, 0.932786942f},
-std::array<float,2>{0.579154372f, 0.05586496f},
-std::array<float,2>{0.371946931f, 0.441143155f},
-std::array<float,2>{0.710814655f, 0.590986967f},
-std::array<float,2>{0.0346221775f, 0.997301817f},
-std::array<float,2>{0.770599902f, 0.0648571476f},
-std::array<float,2>{0.178138584f, 0.181608483f},
-std::array<float,2>{0.912984073f, 0.84326452f},
-std::array<float,2>{0.455608726f, 0.629185498f},
-std::array<float,2>{0.553845167f, 0.261610657f},
-std::array<float,2>{0.382530183f, 0.00891560968f},
-std::array<float,2>{0.6226722f, 0.904265523f},
-std::array<float,2>{0.204164445f, 0.5437783f},
-std::array<float,2>{0.953526139f, 0.381382763f},
-std::array<float,2>{0.0829378664f, 0.367741287f},
-std::array<float,2>{0.87240231f, 0.705115438f},
-std::array<float,2>{0.261144042f, 0.790236354f},
-std::array<float,2>{0.62717694f, 0.214292854f},
-std::array<float,2>{0.420247197f, 0.397174507f},
-std::array<float,2>{0.565234959f, 0.550750256f},
-std::array<float,2>{0.23048383f, 0.882897258f},
-std::array<float,2>{0.987855136f, 0.0190605987f},
-std::array<float,2>{0.1120167f, 0.202178627f},
-std::array<float,2>{0.833295941f, 0.812324405f},
-std::array<float,2>{0.284091592f, 0.692286909f},
-std::array<float,2>{0.685495555f, 0.353009582f},
-std::array<float,2>{0.31807524f, 0.0824880823f},
-std::array<float,2>{0.743530571f, 0.976380289f},
-std::array<float,2>{0.0162391793f, 0.577565253f},
-std::array<float,2>{0.785253823f, 0.453529894f},
-std::array<float,2>{0.131486028f, 0.268889189f},
-std::array<float,2>{0.903378189f, 0.649545014f},
-std::array<float,2>{0.490138948f, 0.820915341f},
-std::array<float,2>{0.5196293f, 0.168744966f},
-std::array<float,2>{0.273102671f, 0.320823908f},
-std::array<float,2>{0.643897712f, 0.737219989f},
-std::array<float,2>{0.0701874644f, 0.776333988f},
-std::array<float,2>{0.857714891f, 0.23925963f},
-std::array<float,2>{0.198138937f, 0.035080824f},
-std::array<float,2>{0.944903135f, 0.917958319f},
-std::array<float,2>{0.397100091f, 0.513805747f},
-std::array<float,2>{0.598419726f, 0.42128256f},
-std::array<float,2>{0.447763264f, 0.148946315f},
-std::array<float,2>{0.536830485f, 0.862957776f},
-std::array<float,2>{0.166334108f, 0.665404856f},
-std::array<float,2>{0.92606473f, 0.311145604f},
-std::array<float,2>{0.0471009873f, 0.47484383f},
-std::array<float,2>{0.751928508f, 0.595758319f},
-std::array<float,2>{0.348195612f, 0.949290991f},
-std::array<float,2>{0.689962268f, 0.123757191f},
-std::array<float,2>{0.434012622f, 0.276527226f},
-std::array<float,2>{0.584630489f, 0.647173285f},
-std::array<float,2>{0.248050809f, 0.816363513f},
-std::array<float,2>{0.969266117f, 0.163700834f},
-std::array<float,2>{0.103470929f, 0.0884137601f},
-std::array<float,2>{0.824978232f, 0.979185402f},
-std::array<float,2>{0.302933127f, 0.568637908f},
-std::array<float,2>{0.665510476f, 0.464698583f},
-std::array<float,2>{0.336177707f, 0.187923819f},
-std::array<float,2>{0.72124809f, 0.801605821f},
-std::array<float,2>{0.000429514941f, 0.699272931f},
-std::array<float,2>{0.808478594f, 0.345117867f},
-std::array<float,2>{0.14999412f, 0.399262786f},
-std::array<float,2>{0.880794704f, 0.559323907f},
-std::array<float,2>{0.470231652f, 0.877131104f},
-std::array<float,2>{0.509939492f, 0.025094917f},
-std::array<float,2>{0.262027204f, 0.484281301f},
-std::array<float,2>{0.63138932f, 0.606221855f},
-std::array<float,2>{0.0795722604f, 0.939260423f},
-std::array<float,2>{0.871072948f, 0.116898887f},
-std::array<float,2>{0.209902495f, 0.146350488f},
-std::array<float,2>{0.960353017f, 0.867362678f},
-std::array<float,2>{0.377127767f, 0.659917593f},
-std::array<float,2>{0.618384659f, 0.301805317f},
-std::array<float,2>{0.457396626f, 0.040375147f},
-std::array<float,2>{0.549761474f, 0.907053351f},
-std::array<float,2>{0.173726797f, 0.501100361f},
-std::array<float,2>{0.907438755f, 0.407358617f},
-std::array<float,2>{0.0387550928f, 0.31593138f},
-std::array<float,2>{0.767065465f, 0.743650377f},
-std::array<float,2>{0.369545519f, 0.770387232f},
-std::array<float,2>{0.704272628f, 0.245177656f},
-std::array<float,2>{0.485085219f, 0.43076843f},
-std::array<float,2>{0.515763879f, 0.517153502f},
-std::array<float,2>{0.128154412f, 0.928082705f},
-std::array<float,2>{0.899246514f, 0.049693469f},
-std::array<float,2>{0.0207350012f, 0.227015004f},
-std::array<float,2>{0.784302413f, 0.76022923f},
-std::array<float,2>{0.315663397f, 0.721638083f},
-std::array<float,2>{0.747305453f, 0.330547929f},
-std::array<float,2>{0.288196206f, 0.0946898833f},
-std::array<float,2>{0.682534873f, 0.968314707f},
-std::array<float,2>{0.115477137f, 0.612258315f},
-std::array<float,2>{0.830990791f, 0.491469026f},
-std::array<float,2>{0.229562476f, 0.293541968f},
-std::array<float,2>{0.989356458f, 0.685917258f},
-std::array<float,2>{0.417144686f, 0.853802502f},
-std::array<float,2>{0.567368925f, 0.127567858f},
-std::array<float,2>{0.344628185f, 0.365012199f},
-std::array<float,2>{0.69524157f, 0.713260531f},
-std::array<float,2>{0.0540672205f, 0.788443387f},
-std::array<float,2>{0.757594168f, 0.207334936f},
-std::array<float,2>{0.170833528f, 0.00363178039f},
-std::array<float,2>{0.925481319f, 0.894965947f},
-std::array<float,2>{0.449579835f, 0.532598436f},
-std::array<float,2>{0.534521103f, 0.388274044f},
-std::array<float,2>{0.392680764f, 0.178382576f},
-std::array<float,2>{0.597498596f, 0.832934916f},
-std::array<float,2>{0.202152759f, 0.634098172f},
-std::array<float,2>{0.94032377f, 0.250033259f},
-std::array<float,2>{0.0657619014f, 0.449827164f},
-std::array<float,2>{0.851903498f, 0.58535707f},
-std::array<float,2>{0.269120604f, 0.98446095f},
-std::array<float,2>{0.644726694f, 0.0757617429f},
-std::array<float,2>{0.442214519f, 0.336110085f},
-std::array<float,2>{0.540825605f, 0.731724203f},
-std::array<float,2>{0.157442585f, 0.753838956f},
-std::array<float,2>{0.931784689f, 0.221530676f},
-std::array<float,2>{0.0623631589f, 0.0599270426f},
-std::array<float,2>{0.764850378f, 0.934051991f},
-std::array<float,2>{0.359130621f, 0.52430439f},
-std::array<float,2>{0.702614546f, 0.422645897f},
-std::array<float,2>{0.274812669f, 0.136954606f},
-std::array<float,2>{0.655537963f, 0.848376811f},
-std::array<float,2>{0.0755699649f, 0.672108471f},
-std::array<float,2>{0.850321412f, 0.288007706f},
-std::array<float,2>{0.188582823f, 0.496220469f},
-std::array<float,2>{0.948463738f, 0.620238185f},
-std::array<float,2>{0.405464321f, 0.959021509f},
-std::array<float,2>{0.6054039f, 0.107447997f},
-std::array<float,2>{0.322305828f, 0.376665264f},
-std::array<float,2>{0.738719881f, 0.539123416f},
-std::array<float,2>{0.0306409746f, 0.8994326f},
-std::array<float,2>{0.791294158f, 0.0131304273f},
-std::array<float,2>{0.134855479f, 0.217546791f},
-std::array<float,2>{0.891068816f, 0.795743406f},
-std::array<float,2>{0.499015242f, 0.71002239f},
-std::array<float,2>{0.527388215f, 0.3716515f},
-std::array<float,2>{0.410439968f, 0.067966491f},
-std::array<float,2>{0.572812498f, 0.993400753f},
-std::array<float,2>{0.219550505f, 0.589220107f},
-std::array<float,2>{0.996777713f, 0.444081575f},
-std::array<float,2>{0.124518462f, 0.265143901f},
-std::array<float,2>{0.839855433f, 0.627781391f},
-std::array<float,2>{0.296159506f, 0.837204993f},
-std::array<float,2>{0.679402828f, 0.183795676f},
-std::array<float,2>{0.384202331f, 0.459109724f},
-std::array<float,2>{0.615013778f, 0.572127759f},
-std::array<float,2>{0.21789512f, 0.968838155f},
-std::array<float,2>{0.965187073f, 0.0791042596f},
-std::array<float,2>{0.0904055759f, 0.167646974f},
-std::array<float,2>{0.86489892f, 0.825449407f},
-std::array<float,2>{0.253051877f, 0.654179335f},
-std::array<float,2>{0.637317121f, 0.270916104f},
-std::array<float,2>{0.363764971f, 0.0219342075f},
-std::array<float,2>{0.716286957f, 0.888994455f},
-std::array<float,2>{0.0408293903f, 0.552624226f},
-std::array<float,2>{0.775009215f, 0.391732305f},
-std::array<float,2>{0.187336534f, 0.356728673f},
-std::array<float,2>{0.918331146f, 0.690733373f},
-std::array<float,2>{0.463408232f, 0.806755245f},
-std::array<float,2>{0.560635805f, 0.195641056f},
-std::array<float,2>{0.311854541f, 0.306219965f},
-std::array<float,2>{0.661649227f, 0.669481754f},
-std::array<float,2>{0.097117506f, 0.864387393f},
-std::array<float,2>{0.816621721f, 0.155367047f},
-std::array<float,2>{0.240410179f, 0.12049558f},
-std::array<float,2>{0.983085155f, 0.946692467f},
-std::array<float,2>{0.427016884f, 0.59879899f},
-std::array<float,2>{0.586189747f, 0.469637334f},
-std::array<float,2>{0.483805835f, 0.235808164f},
-std::array<float,2>{0.506012857f, 0.780755341f},
-std::array<float,2>{0.142726526f, 0.740069389f},
-std::array<float,2>{0.884937227f, 0.327942401f},
-std::array<float,2>{0.00871519186f, 0.415495127f},
-std::array<float,2>{0.804394901f, 0.507923901f},
-std::array<float,2>{0.334062368f, 0.918753147f},
-std::array<float,2>{0.733838975f, 0.0369526446f},
-std::array<float,2>{0.408622444f, 0.3192527f},
-std::array<float,2>{0.577424169f, 0.74756825f},
-std::array<float,2>{0.225643769f, 0.765917063f},
-std::array<float,2>{0.994875193f, 0.247837856f},
-std::array<float,2>{0.120213434f, 0.0449606702f},
-std::array<float,2>{0.838002801f, 0.913717031f},
-std::array<float,2>{0.289657205f, 0.507655859f},
-std::array<float,2>{0.671947956f, 0.411428571f},
-std::array<float,2>{0.328072488f, 0.140737653f},
-std::array<float,2>{0.73568964f, 0.873742402f},
-std::array<float,2>{0.0252551213f, 0.661149263f},
-std::array<float,2>{0.794951737f, 0.300097525f},
-std::array<float,2>{0.139831558f, 0.477896005f},
-std::array<float,2>{0.896627963f, 0.60307765f},
-std::array<float,2>{0.492222369f, 0.945119858f},
-std::array<float,2>{0.525544822f, 0.109696575f},
-std::array<float,2>{0.280856609f, 0.404224247f},
-std::array<float,2>{0.649659216f, 0.55758059f},
-std::array<float,2>{0.0736439303f, 0.880210757f},
-std::array<float,2>{0.846387327f, 0.0291972701f},
-std::array<float,2>{0.194119111f, 0.192348197f},
-std::array<float,2>{0.950469971f, 0.797096252f},
-std::array<float,2>{0.401156783f, 0.695536077f},
-std::array<float,2>{0.606230378f, 0.351118267f},
-std::array<float,2>{0.437618047f, 0.0911833495f},
-std::array<float,2>{0.5444206f, 0.983877718f},
-std::array<float,2>{0.163668901f, 0.563621759f},
-std::array<float,2>{0.934081733f, 0.468215048f},
-std::array<float,2>{0.0555165075f, 0.277799666f},
-std::array<float,2>{0.759431064f, 0.643137932f},
-std::array<float,2>{0.352898568f, 0.818757236f},
-std::array<float,2>{0.696485281f, 0.158154294f},
-std::array<float,2>{0.477900892f, 0.445347846f},
-std::array<float,2>{0.500138342f, 0.580918491f},
-std::array<float,2>{0.14576982f, 0.989032209f},
-std::array<float,2>{0.888046205f, 0.0730499253f},
-std::array<float,2>{0.0140316738f, 0.175494939f},
-std::array<float,2>{0.800043166f, 0.829359412f},
-std::array<float,2>{0.328944176f, 0.637600839f},
-std::array<float,2>{0.726776659f, 0.255039692f},
-std::array<float,2>{0.308384389f, 0.00672215922f},
-std::array<float,2>{0.657833636f, 0.892604411f},
-std::array<float,2>{0.0993952751f, 0.538729548f},
-std::array<float,2>{0.813650548f, 0.384794176f},
-std::array<float,2>{0.236330628f, 0.359531581f},
-std::array<float,2>{0.976637125f, 0.717645109f},
-std::array<float,2>{0.425121188f, 0.783137739f},
-std::array<float,2>{0.592820466f, 0.205445513f},
-std::array<float,2>{0.362672389f, 0.292389691f},
-std::array<float,2>{0.711095035f, 0.681740701f},
-std::array<float,2>{0.0436603688f, 0.858722925f},
-std::array<float,2>{0.777755201f, 0.130874678f},
-std::array<float,2>{0.18094416f, 0.100368902f},
-std::array<float,2>{0.914965153f, 0.962905884f},
-std::array<float,2>{0.467455f, 0.614340365f},
-std::array<float,2>{0.557643592f, 0.486410379f},
-std::array<float,2>{0.389554113f, 0.233736798f},
-std::array<float,2>{0.612718582f, 0.765581131f},
-std::array<float,2>{0.211145043f, 0.725669384f},
-std::array<float,2>{0.96310246f, 0.33425945f},
-std::array<float,2>{0.0866904631f, 0.434943467f},
-std::array<float,2>{0.862498164f, 0.519746065f},
-std::array<float,2>{0.256790191f, 0.925672293f},
-std::array<float,2>{0.634468377f, 0.0530629419f},
-std::array<float,2>{0.455053329f, 0.258894503f},
-std::array<float,2>{0.551540673f, 0.631078184f},
-std::array<float,2>{0.177427784f, 0.840207934f},
-std::array<float,2>{0.911647141f, 0.182696939f},
-std::array<float,2>{0.032884568f, 0.063194409f},
-std::array<float,2>{0.773235083f, 0.998235703f},
-std::array<float,2>{0.373292565f, 0.593016267f},
-std::array<float,2>{0.707587898f, 0.438542634f},
-std::array<float,2>{0.257912248f, 0.212671474f},
-std::array<float,2>{0.626824856f, 0.792050898f},
-std::array<float,2>{0.0852129906f, 0.703361332f},
-std::array<float,2>{0.874239981f, 0.369904041f},
-std::array<float,2>{0.205335721f, 0.379258633f},
-std::array<float,2>{0.955258906f, 0.546491921f},
-std::array<float,2>{0.379823864f, 0.905314267f},
-std::array<float,2>{0.623941123f, 0.0113675594f},
-std::array<float,2>{0.343235493f, 0.493265331f},
-std::array<float,2>{0.725982904f, 0.621830881f},
-std::array<float,2>{0.00406870106f, 0.954657555f},
-std::array<float,2>{0.812472105f, 0.104373723f},
-std::array<float,2>{0.154892579f, 0.136298254f},
-std::array<float,2>{0.87669903f, 0.843980968f},
-std::array<float,2>{0.473888695f, 0.678623438f},
-std::array<float,2>{0.513965487f, 0.283993602f},
-std::array<float,2>{0.432403445f, 0.0581523404f},
-std::array<float,2>{0.580389202f, 0.929893315f},
-std::array<float,2>{0.242750034f, 0.529556692f},
-std::array<float,2>{0.975344718f, 0.429052949f},
-std::array<float,2>{0.105742671f, 0.34143874f},
-std::array<float,2>{0.82314992f, 0.729032159f},
-std::array<float,2>{0.29825148f, 0.755115569f},
-std::array<float,2>{0.668314874f, 0.224861354f},
-std::array<float,2>{0.394932479f, 0.418195188f},
-std::array<float,2>{0.600169063f, 0.513332784f},
-std::array<float,2>{0.195952103f, 0.914609313f},
-std::array<float,2>{0.942852914f, 0.0331516005f},
-std::array<float,2>{0.0664576516f, 0.240620047f},
-std::array<float,2>{0.856130183f, 0.773925126f},
-std::array<float,2>{0.271262407f, 0.735526562f},
-std::array<float,2>{0.641217113f, 0.324208677f},
-std::array<float,2>{0.350965768f, 0.122866042f},
-std::array<float,2>{0.687566221f, 0.952024519f},
-std::array<float,2>{0.0503892601f, 0.59455204f},
-std::array<float,2>{0.753722548f, 0.472715229f},
-std::array<float,2>{0.164745837f, 0.310380876f},
-std::array<float,2>{0.929128945f, 0.666286111f},
-std::array<float,2>{0.446800411f, 0.86089921f},
-std::array<float,2>{0.538015425f, 0.15110299f},
-std::array<float,2>{0.281458229f, 0.354873031f},
-std::array<float,2>{0.685623825f, 0.694758713f},
-std::array<float,2>{0.11111287f, 0.810179651f},
-std::array<float,2>{0.834510326f, 0.200915694f},
-std::array<float,2>{0.233213142f, 0.0159096271f},
-std::array<float,2>{0.985802472f, 0.886568844f},
-std::array<float,2>{0.417995125f, 0.547231853f},
-std::array<float,2>{0.563637733f, 0.394802719f},
-std::array<float,2>{0.492186338f, 0.17149137f},
-std::array<float,2>{0.52270627f, 0.822434723f},
-std::array<float,2>{0.129436448f, 0.651856244f},
-std::array<float,2>{0.904881656f, 0.265748292f},
-std::array<float,2>{0.0187590402f, 0.456914276f},
-std::array<float,2>{0.78752178f, 0.574597478f},
-std::array<float,2>{0.318693042f, 0.973382592f},
-std::array<float,2>{0.74547106f, 0.0849310085f},
-std::array<float,2>{0.376375347f, 0.302899301f},
-std::array<float,2>{0.62014991f, 0.65640831f},
-std::array<float,2>{0.208712056f, 0.871071696f},
-std::array<float,2>{0.957308114f, 0.14713864f},
-std::array<float,2>{0.08029636f, 0.113837011f},
-std::array<float,2>{0.868108153f, 0.94122535f},
-std::array<float,2>{0.264710099f, 0.609142661f},
-std::array<float,2>{0.629064441f, 0.481555939f},
-std::array<float,2>{0.367494643f, 0.242187783f},
-std::array<float,2>{0.706868172f, 0.771746039f},
-std::array<float,2>{0.0354757719f, 0.744764566f},
-std::array<float,2>{0.769361675f, 0.31254077f},
-std::array<float,2>{0.17436631f, 0.409168035f},
-std::array<float,2>{0.909814358f, 0.502175152f},
-std::array<float,2>{0.460157394f, 0.908441484f},
-std::array<float,2>{0.547776341f, 0.0419581756f},
-std::array<float,2>{0.30188331f, 0.461581558f},
-std::array<float,2>{0.666325808f, 0.568003714f},
-std::array<float,2>{0.104719698f, 0.977339923f},
-std::array<float,2>{0.827780247f, 0.0861460343f},
-std::array<float,2>{0.247701764f, 0.161197141f},
-std::array<float,2>{0.971743047f, 0.813440084f},
-std::array<float,2>{0.435936481f, 0.645627737f},
-std::array<float,2>{0.583589256f, 0.274937183f},
-std::array<float,2>{0.47179234f, 0.0256523583f},
-std::array<float,2>{0.508922935f, 0.876063704f},
-std::array<float,2>{0.152007818f, 0.560761809f},
-std::array<float,2>{0.881568253f, 0.402185649f},
-std::array<float,2>{0.00334778777f, 0.347339869f},
-std::array<float,2>{0.806449294f, 0.701827466f},
-std::array<float,2>{0.33876124f, 0.804381609f},
-std::array<float,2>{0.719498158f, 0.190472886f},
-std::array<float,2>{0.452876776f, 0.389965892f},
-std::array<float,2>{0.532747626f, 0.534812927f},
-std::array<float,2>{0.168869853f, 0.897143006f},
-std::array<float,2>{0.922703445f, 0.00150008861f},
-std::array<float,2>{0.0520497262f, 0.209353268f},
-std::array<float,2>{0.754952252f, 0.785678267f},
-std::array<float,2>{0.347109079f, 0.712524593f},
-std::array<float,2>{0.692667425f, 0.36540705f},
-std::array<float,2>{0.266862571f, 0.0768540278f},
-std::array<float,2>{0.648006797f, 0.98823303f},
-std::array<float,2>{0.0625757426f, 0.583209872f},
-std::array<float,2>{0.853907108f, 0.452450991f},
-std::array<float,2>{0.19937706f, 0.253206939f},
-std::array<float,2>{0.937701643f, 0.636635721f},
-std::array<float,2>{0.391001791f, 0.835592449f},
-std::array<float,2>{0.594480097f, 0.176957175f},
-std::array<float,2>{0.313472807f, 0.329286098f},
-std::array<float,2>{0.749645472f, 0.720666468f},
-std::array<float,2>{0.0227563754f, 0.758610487f},
-std::array<float,2>{0.781918347f, 0.229544356f},
-std::array<float,2>{0.126354858f, 0.0484757312f},
-std::array<float,2>{0.900390863f, 0.925971806f},
-std::array<float,2>{0.487114668f, 0.517939329f},
-std::array<float,2>{0.518923044f, 0.43309778f},
-std::array<float,2>{0.415752172f, 0.126867831f},
-std::array<float,2>{0.568390965f, 0.852365136f},
-std::array<float,2>{0.22738713f, 0.685048342f},
-std::array<float,2>{0.990790606f, 0.296276033f},
-std::array<float,2>{0.114169911f, 0.488565087f},
-std::array<float,2>{0.828452289f, 0.609596789f},
-std::array<float,2>{0.286749989f, 0.965259373f},
-std::array<float,2>{0.679902136f, 0.0966025144f},
-std::array<float,2>{0.496136993f, 0.374604315f},
-std::array<float,2>{0.531075537f, 0.707142651f},
-std::array<float,2>{0.133824781f, 0.793642759f},
-std::array<float,2>{0.894189179f, 0.215802759f},
-std::array<float,2>{0.0285702068f, 0.0145122763f},
-std::array<float,2>{0.790923953f, 0.901193678f},
-std::array<float,2>{0.322257966f, 0.542639434f},
-std::array<float,2>{0.740998387f, 0.377207249f},
-std::array<float,2>{0.293838888f, 0.186930314f},
-std::array<float,2>{0.676376283f, 0.838970661f},
-std::array<float,2>{0.122537464f, 0.626252413f},
-std::array<float,2>{0.842615843f, 0.263204038f},
-std::array<float,2>{0.221183077f, 0.443133861f},
-std::array<float,2>{0.998206139f, 0.586593211f},
-std::array<float,2>{0.413728416f, 0.995464265f},
-std::array<float,2>{0.571225107f, 0.0691622049f},
-std::array<float,2>{0.356222034f, 0.424069673f},
-std::array<float,2>{0.700792849f, 0.52680397f},
-std::array<float,2>{0.059669517f, 0.936183095f},
-std::array<float,2>{0.762302339f, 0.0611020811f},
-std::array<float,2>{0.15923588f, 0.219296068f},
-std::array<float,2>{0.929889739f, 0.750942528f},
-std::array<float,2>{0.443620503f, 0.734191239f},
-std::array<float,2>{0.541360378f, 0.338565528f},
-std::array<float,2>{0.403145969f, 0.106323786f},
-std::array<float,2>{0.602618754f, 0.958983362f},
-std::array<float,2>{0.191132605f, 0.618356943f},
-std::array<float,2>{0.946865261f, 0.498643607f},
-std::array<float,2>{0.0778462216f, 0.286546826f},
-std::array<float,2>{0.847894788f, 0.674387276f},
-std::array<float,2>{0.275910467f, 0.851156175f},
-std::array<float,2>{0.654198587f, 0.139568835f},
-std::array<float,2>{0.429541856f, 0.471105546f},
-std::array<float,2>{0.588220835f, 0.601093113f},
-std::array<float,2>{0.240152806f, 0.948105395f},
-std::array<float,2>{0.982303739f, 0.117920756f},
-std::array<float,2>{0.0952404439f, 0.153887749f},
-std::array<float,2>{0.819835424f, 0.86575532f},
-std::array<float,2>{0.310279131f, 0.671381772f},
-std::array<float,2>{0.663541019f, 0.307161093f},
-std::array<float,2>{0.33215487f, 0.0373134315f},
-std::array<float,2>{0.730977297f, 0.921309233f},
-std::array<float,2>{0.0100406567f, 0.511419713f},
-std::array<float,2>{0.802683413f, 0.416031778f},
-std::array<float,2>{0.141777456f, 0.325396091f},
-std::array<float,2>{0.88374269f, 0.740742445f},
-std::array<float,2>{0.480840117f, 0.779109657f},
-std::array<float,2>{0.504300296f, 0.237782881f},
-std::array<float,2>{0.250606209f, 0.271941125f},
-std::array<float,2>{0.639605403f, 0.654698372f},
-std::array<float,2>{0.093543157f, 0.827092648f},
-std::array<float,2>{0.866830707f, 0.165614784f},
-std::array<float,2>{0.215938106f, 0.0812178627f},
-std::array<float,2>{0.968602955f, 0.971513331f},
-std::array<float,2>{0.386532128f, 0.572855771f},
-std::array<float,2>{0.616281688f, 0.458900958f},
-std::array<float,2>{0.461171925f, 0.197592676f},
-std::array<float,2>{0.560398877f, 0.805014491f},
-std::array<float,2>{0.184928313f, 0.689376831f},
-std::array<float,2>{0.920283973f, 0.3585217f},
-std::array<float,2>{0.0413465202f, 0.393972754f},
-std::array<float,2>{0.777235687f, 0.554481268f},
-std::array<float,2>{0.366399407f, 0.886830986f},
-std::array<float,2>{0.718153119f, 0.0204809494f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.157838866f, 0.949130237f},
-std::array<float,2>{0.787033021f, 0.203461111f},
-std::array<float,2>{0.453410357f, 0.461222231f},
-std::array<float,2>{0.648914099f, 0.504748702f},
-std::array<float,2>{0.345581234f, 0.683410585f},
-std::array<float,2>{0.594882607f, 0.283364654f},
-std::array<float,2>{0.0540812351f, 0.0402369536f},
-std::array<float,2>{0.995617688f, 0.820115685f},
-std::array<float,2>{0.433252931f, 0.778153419f},
-std::array<float,2>{0.703035951f, 0.118054554f},
-std::array<float,2>{0.209152058f, 0.336246252f},
-std::array<float,2>{0.835848868f, 0.695275903f},
-std::array<float,2>{0.102528535f, 0.585388541f},
-std::array<float,2>{0.891848505f, 0.391050875f},
-std::array<float,2>{0.311330914f, 0.16768457f},
-std::array<float,2>{0.544198871f, 0.904216945f},
-std::array<float,2>{0.0230083223f, 0.859775484f},
-std::array<float,2>{0.955590189f, 0.00916159339f},
-std::array<float,2>{0.323886096f, 0.250365764f},
-std::array<float,2>{0.582843602f, 0.655413508f},
-std::array<float,2>{0.479497999f, 0.545592487f},
-std::array<float,2>{0.665815771f, 0.497369468f},
-std::array<float,2>{0.15533112f, 0.229849607f},
-std::array<float,2>{0.773215771f, 0.994632006f},
-std::array<float,2>{0.252760828f, 0.924708307f},
-std::array<float,2>{0.511623323f, 0.132247835f},
-std::array<float,2>{0.074784562f, 0.422677189f},
-std::array<float,2>{0.908616781f, 0.609133303f},
-std::array<float,2>{0.23669444f, 0.744168282f},
-std::array<float,2>{0.871009231f, 0.369378567f},
-std::array<float,2>{0.384908557f, 0.0768509135f},
-std::array<float,2>{0.723147511f, 0.795248568f},
-std::array<float,2>{0.190411642f, 0.811192691f},
-std::array<float,2>{0.827118695f, 0.0791473761f},
-std::array<float,2>{0.412914693f, 0.352734238f},
-std::array<float,2>{0.703709066f, 0.726075649f},
-std::array<float,2>{0.28528744f, 0.623177886f},
-std::array<float,2>{0.548393965f, 0.407923907f},
-std::array<float,2>{0.117047317f, 0.144991487f},
-std::array<float,2>{0.880419791f, 0.9180125f},
-std::array<float,2>{0.444077641f, 0.969363093f},
-std::array<float,2>{0.635122597f, 0.238620222f},
-std::array<float,2>{0.185683519f, 0.48178196f},
-std::array<float,2>{0.799455583f, 0.554641724f},
-std::array<float,2>{0.0384566523f, 0.632122636f},
-std::array<float,2>{0.969346106f, 0.267158151f},
-std::array<float,2>{0.365563512f, 0.0240131579f},
-std::array<float,2>{0.617334902f, 0.849570096f},
-std::array<float,2>{0.0854958221f, 0.8876459f},
-std::array<float,2>{0.928186357f, 0.172116265f},
-std::array<float,2>{0.267268717f, 0.388155013f},
-std::array<float,2>{0.517004371f, 0.562677801f},
-std::array<float,2>{0.395499229f, 0.706582427f},
-std::array<float,2>{0.747928143f, 0.318158478f},
-std::array<float,2>{0.229677305f, 0.0984881297f},
-std::array<float,2>{0.847107708f, 0.75993216f},
-std::array<float,2>{0.332913697f, 0.834285975f},
-std::array<float,2>{0.564873099f, 0.0557380579f},
-std::array<float,2>{0.00413436582f, 0.311944485f},
-std::array<float,2>{0.948637903f, 0.66940707f},
-std::array<float,2>{0.13002497f, 0.516270697f},
-std::array<float,2>{0.76131922f, 0.442385226f},
-std::array<float,2>{0.484715998f, 0.190643489f},
-std::array<float,2>{0.684887528f, 0.961456001f},
-std::array<float,2>{0.220029801f, 0.913620055f},
-std::array<float,2>{0.859051704f, 0.150780529f},
-std::array<float,2>{0.404598564f, 0.416076452f},
-std::array<float,2>{0.735364556f, 0.616851509f},
-std::array<float,2>{0.274046093f, 0.729577839f},
-std::array<float,2>{0.526947379f, 0.343883604f},
-std::array<float,2>{0.0929505751f, 0.0906948298f},
-std::array<float,2>{0.934915721f, 0.798677802f},
-std::array<float,2>{0.496230006f, 0.852412462f},
-std::array<float,2>{0.677000284f, 0.0189418774f},
-std::array<float,2>{0.139189184f, 0.275753111f},
-std::array<float,2>{0.757506549f, 0.638997018f},
-std::array<float,2>{0.0101649323f, 0.56116426f},
-std::array<float,2>{0.940332174f, 0.475826025f},
-std::array<float,2>{0.339871109f, 0.247897536f},
-std::array<float,2>{0.573237777f, 0.978063285f},
-std::array<float,2>{0.118117228f, 0.751667559f},
-std::array<float,2>{0.887315452f, 0.107596107f},
-std::array<float,2>{0.29592523f, 0.325864226f},
-std::array<float,2>{0.561441362f, 0.718005598f},
-std::array<float,2>{0.417700261f, 0.572324038f},
-std::array<float,2>{0.716386318f, 0.378266394f},
-std::array<float,2>{0.19764258f, 0.184458733f},
-std::array<float,2>{0.814417601f, 0.882032514f},
-std::array<float,2>{0.368695199f, 0.958210945f},
-std::array<float,2>{0.616575122f, 0.196504548f},
-std::array<float,2>{0.0443493538f, 0.445520192f},
-std::array<float,2>{0.980996847f, 0.524073064f},
-std::array<float,2>{0.176818088f, 0.657092452f},
-std::array<float,2>{0.805043995f, 0.299825251f},
-std::array<float,2>{0.450649977f, 0.054401312f},
-std::array<float,2>{0.625513911f, 0.842178285f},
-std::array<float,2>{0.144256711f, 0.820622444f},
-std::array<float,2>{0.777566195f, 0.0365011506f},
-std::array<float,2>{0.473253936f, 0.29049167f},
-std::array<float,2>{0.657909751f, 0.67541641f},
-std::array<float,2>{0.319526196f, 0.509537995f},
-std::array<float,2>{0.592125237f, 0.453833997f},
-std::array<float,2>{0.0304944068f, 0.211574465f},
-std::array<float,2>{0.963998377f, 0.94284308f},
-std::array<float,2>{0.37911576f, 0.896534681f},
-std::array<float,2>{0.728554308f, 0.159091473f},
-std::array<float,2>{0.243407577f, 0.403866291f},
-std::array<float,2>{0.862935543f, 0.586208999f},
-std::array<float,2>{0.0625759959f, 0.703061521f},
-std::array<float,2>{0.916779399f, 0.335024059f},
-std::array<float,2>{0.258932501f, 0.116046123f},
-std::array<float,2>{0.504293084f, 0.772197366f},
-std::array<float,2>{0.0575506948f, 0.989839494f},
-std::array<float,2>{0.989379585f, 0.223281741f},
-std::array<float,2>{0.354403585f, 0.488283485f},
-std::array<float,2>{0.603249371f, 0.53336215f},
-std::array<float,2>{0.463720113f, 0.647445202f},
-std::array<float,2>{0.642980576f, 0.262136906f},
-std::array<float,2>{0.165062487f, 0.00482019549f},
-std::array<float,2>{0.791585386f, 0.868289828f},
-std::array<float,2>{0.299271524f, 0.783178687f},
-std::array<float,2>{0.537386477f, 0.0625777245f},
-std::array<float,2>{0.101429999f, 0.365034282f},
-std::array<float,2>{0.903954923f, 0.736982822f},
-std::array<float,2>{0.218666032f, 0.598598778f},
-std::array<float,2>{0.838503957f, 0.43033132f},
-std::array<float,2>{0.422734529f, 0.139864028f},
-std::array<float,2>{0.691825092f, 0.937240839f},
-std::array<float,2>{0.13576147f, 0.901340544f},
-std::array<float,2>{0.752246618f, 0.169133812f},
-std::array<float,2>{0.495379835f, 0.397645086f},
-std::array<float,2>{0.674409568f, 0.578304648f},
-std::array<float,2>{0.338551641f, 0.687795818f},
-std::array<float,2>{0.575059891f, 0.340817451f},
-std::array<float,2>{0.0134577127f, 0.121322609f},
-std::array<float,2>{0.943357587f, 0.773463726f},
-std::array<float,2>{0.398598552f, 0.812848508f},
-std::array<float,2>{0.740743876f, 0.0467555709f},
-std::array<float,2>{0.22310847f, 0.286897063f},
-std::array<float,2>{0.852154315f, 0.687317133f},
-std::array<float,2>{0.0869621709f, 0.500225902f},
-std::array<float,2>{0.93214792f, 0.465644449f},
-std::array<float,2>{0.279629648f, 0.208496436f},
-std::array<float,2>{0.530417919f, 0.951193154f},
-std::array<float,2>{0.0397634283f, 0.792524278f},
-std::array<float,2>{0.977331042f, 0.0704337135f},
-std::array<float,2>{0.373003036f, 0.373635441f},
-std::array<float,2>{0.611831725f, 0.749179602f},
-std::array<float,2>{0.446222037f, 0.603958786f},
-std::array<float,2>{0.630087614f, 0.427325785f},
-std::array<float,2>{0.175599843f, 0.127112716f},
-std::array<float,2>{0.811330259f, 0.926113665f},
-std::array<float,2>{0.290584356f, 0.998346865f},
-std::array<float,2>{0.556764901f, 0.231655344f},
-std::array<float,2>{0.123690464f, 0.493012071f},
-std::array<float,2>{0.885476232f, 0.540561855f},
-std::array<float,2>{0.203032255f, 0.651716352f},
-std::array<float,2>{0.819651842f, 0.253927112f},
-std::array<float,2>{0.41807273f, 0.0125031602f},
-std::array<float,2>{0.713012576f, 0.865383029f},
-std::array<float,2>{0.247474432f, 0.844816148f},
-std::array<float,2>{0.86579293f, 0.0297846869f},
-std::array<float,2>{0.375606626f, 0.271238357f},
-std::array<float,2>{0.730992436f, 0.625404418f},
-std::array<float,2>{0.26194039f, 0.550557554f},
-std::array<float,2>{0.503774822f, 0.477119952f},
-std::array<float,2>{0.070214048f, 0.238278821f},
-std::array<float,2>{0.919813633f, 0.97303319f},
-std::array<float,2>{0.469444841f, 0.914707422f},
-std::array<float,2>{0.660273731f, 0.141710669f},
-std::array<float,2>{0.14697811f, 0.412796229f},
-std::array<float,2>{0.775048971f, 0.619462311f},
-std::array<float,2>{0.0244371947f, 0.721350491f},
-std::array<float,2>{0.964892089f, 0.35583666f},
-std::array<float,2>{0.313278854f, 0.0829942971f},
-std::array<float,2>{0.586865783f, 0.804764092f},
-std::array<float,2>{0.0942365602f, 0.967510343f},
-std::array<float,2>{0.899509072f, 0.191984192f},
-std::array<float,2>{0.302887082f, 0.440301031f},
-std::array<float,2>{0.533952415f, 0.521875679f},
-std::array<float,2>{0.426498562f, 0.666924f},
-std::array<float,2>{0.690005183f, 0.304693937f},
-std::array<float,2>{0.214491263f, 0.0609574988f},
-std::array<float,2>{0.840254068f, 0.830764472f},
-std::array<float,2>{0.359022796f, 0.764748752f},
-std::array<float,2>{0.607430935f, 0.0964372829f},
-std::array<float,2>{0.0615582392f, 0.314928353f},
-std::array<float,2>{0.987466633f, 0.707865477f},
-std::array<float,2>{0.168743119f, 0.569934964f},
-std::array<float,2>{0.794581115f, 0.384664953f},
-std::array<float,2>{0.467276603f, 0.17719081f},
-std::array<float,2>{0.648243487f, 0.886360109f},
-std::array<float,2>{0.204155415f, 0.981235325f},
-std::array<float,2>{0.829322994f, 0.244130254f},
-std::array<float,2>{0.435393572f, 0.47215879f},
-std::array<float,2>{0.697862327f, 0.555702329f},
-std::array<float,2>{0.308151782f, 0.634380281f},
-std::array<float,2>{0.540607512f, 0.2775006f},
-std::array<float,2>{0.10914094f, 0.0196486935f},
-std::array<float,2>{0.896792829f, 0.858806551f},
-std::array<float,2>{0.460754484f, 0.803358912f},
-std::array<float,2>{0.65434742f, 0.089239791f},
-std::array<float,2>{0.160672814f, 0.34868893f},
-std::array<float,2>{0.782668412f, 0.733558595f},
-std::array<float,2>{0.0499498732f, 0.612636745f},
-std::array<float,2>{0.999384105f, 0.420846909f},
-std::array<float,2>{0.349307477f, 0.15597789f},
-std::array<float,2>{0.599154055f, 0.909718394f},
-std::array<float,2>{0.0730953217f, 0.838416696f},
-std::array<float,2>{0.912970722f, 0.0483461171f},
-std::array<float,2>{0.254755944f, 0.303025186f},
-std::array<float,2>{0.513024867f, 0.661490381f},
-std::array<float,2>{0.387801349f, 0.527898192f},
-std::array<float,2>{0.722155631f, 0.450670063f},
-std::array<float,2>{0.239911109f, 0.200727403f},
-std::array<float,2>{0.874454319f, 0.956428826f},
-std::array<float,2>{0.327964962f, 0.875029862f},
-std::array<float,2>{0.580465615f, 0.181429908f},
-std::array<float,2>{0.018721832f, 0.382605821f},
-std::array<float,2>{0.958093941f, 0.575545549f},
-std::array<float,2>{0.14981012f, 0.714827001f},
-std::array<float,2>{0.767416298f, 0.323064625f},
-std::array<float,2>{0.48375994f, 0.10481216f},
-std::array<float,2>{0.670993388f, 0.7565853f},
-std::array<float,2>{0.181349993f, 0.767976403f},
-std::array<float,2>{0.802973926f, 0.111727796f},
-std::array<float,2>{0.438380808f, 0.329657674f},
-std::array<float,2>{0.636979938f, 0.698860765f},
-std::array<float,2>{0.360187054f, 0.590946138f},
-std::array<float,2>{0.622615755f, 0.401006103f},
-std::array<float,2>{0.0323180817f, 0.16164954f},
-std::array<float,2>{0.973354042f, 0.894464016f},
-std::array<float,2>{0.406768948f, 0.938888252f},
-std::array<float,2>{0.710228086f, 0.217953727f},
-std::array<float,2>{0.192589372f, 0.458983332f},
-std::array<float,2>{0.821154296f, 0.512921333f},
-std::array<float,2>{0.112520926f, 0.677036583f},
-std::array<float,2>{0.875608027f, 0.293473959f},
-std::array<float,2>{0.284740865f, 0.0329464786f},
-std::array<float,2>{0.553774059f, 0.827999234f},
-std::array<float,2>{0.00183628802f, 0.931463063f},
-std::array<float,2>{0.952183008f, 0.135514364f},
-std::array<float,2>{0.329487532f, 0.434905231f},
-std::array<float,2>{0.56716001f, 0.59454155f},
-std::array<float,2>{0.491038203f, 0.738550305f},
-std::array<float,2>{0.679818332f, 0.362925082f},
-std::array<float,2>{0.126826495f, 0.0678325519f},
-std::array<float,2>{0.765283287f, 0.787403464f},
-std::array<float,2>{0.273083478f, 0.871918678f},
-std::array<float,2>{0.521882415f, 0.00346347503f},
-std::array<float,2>{0.0785917863f, 0.260190547f},
-std::array<float,2>{0.922173321f, 0.642314076f},
-std::array<float,2>{0.231928229f, 0.536210597f},
-std::array<float,2>{0.851173818f, 0.484766066f},
-std::array<float,2>{0.393593222f, 0.221416652f},
-std::array<float,2>{0.742432654f, 0.98789233f},
-std::array<float,2>{0.15259023f, 0.993903637f},
-std::array<float,2>{0.770920873f, 0.228019029f},
-std::array<float,2>{0.477684289f, 0.49986282f},
-std::array<float,2>{0.667059183f, 0.54392612f},
-std::array<float,2>{0.320407152f, 0.652919471f},
-std::array<float,2>{0.584939003f, 0.25337708f},
-std::array<float,2>{0.0207676552f, 0.0111242384f},
-std::array<float,2>{0.954290986f, 0.862016976f},
-std::array<float,2>{0.384674072f, 0.793252587f},
-std::array<float,2>{0.725284994f, 0.0749700144f},
-std::array<float,2>{0.236304909f, 0.367495f},
-std::array<float,2>{0.868766546f, 0.74311173f},
-std::array<float,2>{0.0769383684f, 0.607089877f},
-std::array<float,2>{0.906448364f, 0.425670683f},
-std::array<float,2>{0.250092953f, 0.129743576f},
-std::array<float,2>{0.509254336f, 0.923160613f},
-std::array<float,2>{0.0521619134f, 0.81670928f},
-std::array<float,2>{0.994110048f, 0.0424753577f},
-std::array<float,2>{0.345813453f, 0.28297922f},
-std::array<float,2>{0.596613109f, 0.680176198f},
-std::array<float,2>{0.456706583f, 0.507454813f},
-std::array<float,2>{0.65114367f, 0.464094818f},
-std::array<float,2>{0.158763215f, 0.205869764f},
-std::array<float,2>{0.788224399f, 0.946727455f},
-std::array<float,2>{0.309561938f, 0.906175733f},
-std::array<float,2>{0.544938207f, 0.165599734f},
-std::array<float,2>{0.104018115f, 0.393778294f},
-std::array<float,2>{0.89392972f, 0.583981037f},
-std::array<float,2>{0.208472297f, 0.692029953f},
-std::array<float,2>{0.833152592f, 0.339372754f},
-std::array<float,2>{0.430977762f, 0.119484052f},
-std::array<float,2>{0.70011121f, 0.78080374f},
-std::array<float,2>{0.226901695f, 0.758185923f},
-std::array<float,2>{0.844729543f, 0.10044878f},
-std::array<float,2>{0.397475988f, 0.320071995f},
-std::array<float,2>{0.749108315f, 0.704139233f},
-std::array<float,2>{0.269211024f, 0.565504909f},
-std::array<float,2>{0.519460917f, 0.390151829f},
-std::array<float,2>{0.082835421f, 0.175391465f},
-std::array<float,2>{0.92692256f, 0.890241504f},
-std::array<float,2>{0.486809075f, 0.964385569f},
-std::array<float,2>{0.68694073f, 0.187585607f},
-std::array<float,2>{0.132053211f, 0.444884062f},
-std::array<float,2>{0.758997381f, 0.519053221f},
-std::array<float,2>{0.00666843401f, 0.67021966f},
-std::array<float,2>{0.945993006f, 0.309699595f},
-std::array<float,2>{0.335925519f, 0.0582624525f},
-std::array<float,2>{0.563039362f, 0.833075464f},
-std::array<float,2>{0.114736699f, 0.920642018f},
-std::array<float,2>{0.882635951f, 0.146897107f},
-std::array<float,2>{0.287150472f, 0.410082281f},
-std::array<float,2>{0.550584853f, 0.62224555f},
-std::array<float,2>{0.411745459f, 0.723240674f},
-std::array<float,2>{0.706921101f, 0.354750872f},
-std::array<float,2>{0.187824637f, 0.0815504342f},
-std::array<float,2>{0.825437427f, 0.810119569f},
-std::array<float,2>{0.363579869f, 0.850885272f},
-std::array<float,2>{0.619878948f, 0.0262178406f},
-std::array<float,2>{0.0354070365f, 0.268608242f},
-std::array<float,2>{0.972516418f, 0.629448235f},
-std::array<float,2>{0.183730662f, 0.552530766f},
-std::array<float,2>{0.798104167f, 0.482527196f},
-std::array<float,2>{0.443347603f, 0.241680637f},
-std::array<float,2>{0.634334624f, 0.971440852f},
-std::array<float,2>{0.196246028f, 0.88023293f},
-std::array<float,2>{0.815731823f, 0.185978323f},
-std::array<float,2>{0.415911943f, 0.375705421f},
-std::array<float,2>{0.717087448f, 0.570502341f},
-std::array<float,2>{0.293827623f, 0.715324581f},
-std::array<float,2>{0.559535086f, 0.327330947f},
-std::array<float,2>{0.12071187f, 0.106756225f},
-std::array<float,2>{0.890285969f, 0.753344893f},
-std::array<float,2>{0.452766418f, 0.840598404f},
-std::array<float,2>{0.628820777f, 0.0515867434f},
-std::array<float,2>{0.179457575f, 0.297249645f},
-std::array<float,2>{0.807903111f, 0.658290625f},
-std::array<float,2>{0.0466975272f, 0.526477277f},
-std::array<float,2>{0.982597947f, 0.448193759f},
-std::array<float,2>{0.369702935f, 0.198269054f},
-std::array<float,2>{0.614314556f, 0.959706962f},
-std::array<float,2>{0.0902939588f, 0.80037564f},
-std::array<float,2>{0.936002016f, 0.0920128673f},
-std::array<float,2>{0.275939405f, 0.347288013f},
-std::array<float,2>{0.525291383f, 0.72760731f},
-std::array<float,2>{0.403055072f, 0.614116311f},
-std::array<float,2>{0.736468375f, 0.414690644f},
-std::array<float,2>{0.222338453f, 0.149835035f},
-std::array<float,2>{0.855560899f, 0.911502957f},
-std::array<float,2>{0.342402458f, 0.979801834f},
-std::array<float,2>{0.571371019f, 0.248073474f},
-std::array<float,2>{0.00852261949f, 0.474303901f},
-std::array<float,2>{0.937625766f, 0.559304953f},
-std::array<float,2>{0.137226865f, 0.637063444f},
-std::array<float,2>{0.754012764f, 0.273459673f},
-std::array<float,2>{0.498360842f, 0.0169679541f},
-std::array<float,2>{0.678738832f, 0.855442584f},
-std::array<float,2>{0.166145116f, 0.870225489f},
-std::array<float,2>{0.789894044f, 0.00661381008f},
-std::array<float,2>{0.46139285f, 0.263910949f},
-std::array<float,2>{0.641664326f, 0.646366298f},
-std::array<float,2>{0.351923585f, 0.532599807f},
-std::array<float,2>{0.60524869f, 0.491156995f},
-std::array<float,2>{0.0553738177f, 0.225762933f},
-std::array<float,2>{0.991122842f, 0.990412295f},
-std::array<float,2>{0.425661087f, 0.933770776f},
-std::array<float,2>{0.694413781f, 0.137787372f},
-std::array<float,2>{0.21637027f, 0.432880819f},
-std::array<float,2>{0.837264001f, 0.599912941f},
-std::array<float,2>{0.0990366042f, 0.736297607f},
-std::array<float,2>{0.904935122f, 0.3660869f},
-std::array<float,2>{0.297842652f, 0.0653188825f},
-std::array<float,2>{0.535200715f, 0.784026206f},
-std::array<float,2>{0.0280225407f, 0.945110559f},
-std::array<float,2>{0.962689757f, 0.214796767f},
-std::array<float,2>{0.31808567f, 0.455364555f},
-std::array<float,2>{0.591298759f, 0.510057211f},
-std::array<float,2>{0.474765539f, 0.672785223f},
-std::array<float,2>{0.659264147f, 0.291264296f},
-std::array<float,2>{0.142491937f, 0.0380255394f},
-std::array<float,2>{0.780075014f, 0.822715998f},
-std::array<float,2>{0.260173261f, 0.770460188f},
-std::array<float,2>{0.506649315f, 0.11390952f},
-std::array<float,2>{0.0647171885f, 0.333888859f},
-std::array<float,2>{0.915631413f, 0.70096451f},
-std::array<float,2>{0.245918751f, 0.588174164f},
-std::array<float,2>{0.859790564f, 0.404996634f},
-std::array<float,2>{0.382448137f, 0.156544283f},
-std::array<float,2>{0.728503287f, 0.894545317f},
-std::array<float,2>{0.173309803f, 0.927743077f},
-std::array<float,2>{0.810457706f, 0.126884937f},
-std::array<float,2>{0.448594451f, 0.428734511f},
-std::array<float,2>{0.632734478f, 0.602643311f},
-std::array<float,2>{0.373542547f, 0.746380925f},
-std::array<float,2>{0.610451102f, 0.371174991f},
-std::array<float,2>{0.0429518521f, 0.0736523867f},
-std::array<float,2>{0.979130447f, 0.790569901f},
-std::array<float,2>{0.420139343f, 0.863540471f},
-std::array<float,2>{0.712756038f, 0.013789529f},
-std::array<float,2>{0.200152457f, 0.257032812f},
-std::array<float,2>{0.817651391f, 0.649187207f},
-std::array<float,2>{0.12168318f, 0.541876078f},
-std::array<float,2>{0.883772433f, 0.495695114f},
-std::array<float,2>{0.291653991f, 0.232565939f},
-std::array<float,2>{0.555192113f, 0.997078836f},
-std::array<float,2>{0.0142268697f, 0.775637865f},
-std::array<float,2>{0.944703162f, 0.123822547f},
-std::array<float,2>{0.336747408f, 0.342561245f},
-std::array<float,2>{0.576453567f, 0.68969363f},
-std::array<float,2>{0.493087798f, 0.581950724f},
-std::array<float,2>{0.672232032f, 0.395468622f},
-std::array<float,2>{0.134614542f, 0.171262935f},
-std::array<float,2>{0.750303626f, 0.898942351f},
-std::array<float,2>{0.277679861f, 0.950914562f},
-std::array<float,2>{0.528098345f, 0.209121361f},
-std::array<float,2>{0.0894769356f, 0.467074305f},
-std::array<float,2>{0.930302322f, 0.502126336f},
-std::array<float,2>{0.225001395f, 0.685268402f},
-std::array<float,2>{0.855214596f, 0.287142992f},
-std::array<float,2>{0.402087182f, 0.043131575f},
-std::array<float,2>{0.740057349f, 0.81558609f},
-std::array<float,2>{0.211664438f, 0.830075085f},
-std::array<float,2>{0.842337608f, 0.0603537187f},
-std::array<float,2>{0.429627389f, 0.306846589f},
-std::array<float,2>{0.688409388f, 0.664804876f},
-std::array<float,2>{0.302274406f, 0.521410644f},
-std::array<float,2>{0.531421185f, 0.438142627f},
-std::array<float,2>{0.0962011144f, 0.193723544f},
-std::array<float,2>{0.902078867f, 0.965966821f},
-std::array<float,2>{0.465869635f, 0.883686244f},
-std::array<float,2>{0.644583106f, 0.179487213f},
-std::array<float,2>{0.170915633f, 0.386472434f},
-std::array<float,2>{0.796319783f, 0.567350864f},
-std::array<float,2>{0.0601549037f, 0.709818244f},
-std::array<float,2>{0.986151516f, 0.313708723f},
-std::array<float,2>{0.355976462f, 0.0946110934f},
-std::array<float,2>{0.607188702f, 0.763495684f},
-std::array<float,2>{0.0670884326f, 0.975611866f},
-std::array<float,2>{0.921499431f, 0.234832883f},
-std::array<float,2>{0.265317529f, 0.480435729f},
-std::array<float,2>{0.501924992f, 0.546951652f},
-std::array<float,2>{0.377922356f, 0.627525091f},
-std::array<float,2>{0.73348695f, 0.272649527f},
-std::array<float,2>{0.248748422f, 0.0289566424f},
-std::array<float,2>{0.863576353f, 0.846864045f},
-std::array<float,2>{0.314703643f, 0.808173776f},
-std::array<float,2>{0.58969897f, 0.0852335244f},
-std::array<float,2>{0.0268299133f, 0.358256906f},
-std::array<float,2>{0.96728462f, 0.720343649f},
-std::array<float,2>{0.14576368f, 0.618403852f},
-std::array<float,2>{0.776598573f, 0.411769718f},
-std::array<float,2>{0.471452832f, 0.143752873f},
-std::array<float,2>{0.663517594f, 0.917820215f},
-std::array<float,2>{0.241610736f, 0.955044925f},
-std::array<float,2>{0.87147963f, 0.201971188f},
-std::array<float,2>{0.389642447f, 0.451759964f},
-std::array<float,2>{0.719141603f, 0.530934989f},
-std::array<float,2>{0.255878806f, 0.662499845f},
-std::array<float,2>{0.51543045f, 0.30174765f},
-std::array<float,2>{0.0704204589f, 0.0503049754f},
-std::array<float,2>{0.911126614f, 0.837466896f},
-std::array<float,2>{0.482352883f, 0.753916502f},
-std::array<float,2>{0.669600785f, 0.103392228f},
-std::array<float,2>{0.150961146f, 0.320975065f},
-std::array<float,2>{0.768822193f, 0.711982012f},
-std::array<float,2>{0.0174585506f, 0.577705801f},
-std::array<float,2>{0.959907949f, 0.380666763f},
-std::array<float,2>{0.325117826f, 0.182881176f},
-std::array<float,2>{0.578510165f, 0.877157569f},
-std::array<float,2>{0.10572125f, 0.856902719f},
-std::array<float,2>{0.894559979f, 0.0226900615f},
-std::array<float,2>{0.30542618f, 0.280350715f},
-std::array<float,2>{0.542576313f, 0.635824442f},
-std::array<float,2>{0.436048895f, 0.558328569f},
-std::array<float,2>{0.69560647f, 0.468973488f},
-std::array<float,2>{0.205960959f, 0.244382307f},
-std::array<float,2>{0.830231786f, 0.983400643f},
-std::array<float,2>{0.351049721f, 0.907685757f},
-std::array<float,2>{0.60125041f, 0.15246062f},
-std::array<float,2>{0.0479256883f, 0.419709831f},
-std::array<float,2>{0.99677515f, 0.610598862f},
-std::array<float,2>{0.163415745f, 0.731201589f},
-std::array<float,2>{0.783212602f, 0.35040158f},
-std::array<float,2>{0.458817124f, 0.0874017775f},
-std::array<float,2>{0.654109299f, 0.802528381f},
-std::array<float,2>{0.128118575f, 0.786125839f},
-std::array<float,2>{0.76343894f, 0.068458125f},
-std::array<float,2>{0.48894015f, 0.361276239f},
-std::array<float,2>{0.683101654f, 0.74120146f},
-std::array<float,2>{0.330447078f, 0.59749037f},
-std::array<float,2>{0.569198787f, 0.436018467f},
-std::array<float,2>{0.00345198554f, 0.133789405f},
-std::array<float,2>{0.950941622f, 0.93270129f},
-std::array<float,2>{0.390836537f, 0.984906256f},
-std::array<float,2>{0.74504137f, 0.219353169f},
-std::array<float,2>{0.234352425f, 0.486903578f},
-std::array<float,2>{0.848442137f, 0.538012207f},
-std::array<float,2>{0.080893442f, 0.642613173f},
-std::array<float,2>{0.925287664f, 0.25966081f},
-std::array<float,2>{0.270941585f, 0.00057875365f},
-std::array<float,2>{0.520692706f, 0.874622226f},
-std::array<float,2>{0.0345280394f, 0.891792178f},
-std::array<float,2>{0.974694967f, 0.163936973f},
-std::array<float,2>{0.361484677f, 0.398770273f},
-std::array<float,2>{0.623293281f, 0.592121243f},
-std::array<float,2>{0.440476149f, 0.697105885f},
-std::array<float,2>{0.640538275f, 0.331607163f},
-std::array<float,2>{0.182742521f, 0.11037863f},
-std::array<float,2>{0.80224508f, 0.767459393f},
-std::array<float,2>{0.281894743f, 0.825493395f},
-std::array<float,2>{0.551813126f, 0.0347406864f},
-std::array<float,2>{0.109596692f, 0.296256185f},
-std::array<float,2>{0.878668368f, 0.679261208f},
-std::array<float,2>{0.193487242f, 0.514440835f},
-std::array<float,2>{0.824111283f, 0.459796309f},
-std::array<float,2>{0.40993011f, 0.215173438f},
-std::array<float,2>{0.707633376f, 0.939554155f},
-std::array<float,2>{0.13181375f, 0.962650001f},
-std::array<float,2>{0.758483648f, 0.189533129f},
-std::array<float,2>{0.487380892f, 0.441504002f},
-std::array<float,2>{0.685628116f, 0.516976058f},
-std::array<float,2>{0.333999187f, 0.668296576f},
-std::array<float,2>{0.564193428f, 0.311290592f},
-std::array<float,2>{0.00724144606f, 0.0548459105f},
-std::array<float,2>{0.946806371f, 0.835567713f},
-std::array<float,2>{0.396846354f, 0.761269808f},
-std::array<float,2>{0.748706877f, 0.0995300636f},
-std::array<float,2>{0.228333145f, 0.316651344f},
-std::array<float,2>{0.844309032f, 0.705885887f},
-std::array<float,2>{0.0834867433f, 0.564285159f},
-std::array<float,2>{0.926043332f, 0.38700977f},
-std::array<float,2>{0.267676651f, 0.173735112f},
-std::array<float,2>{0.518400133f, 0.88822937f},
-std::array<float,2>{0.036430873f, 0.848453522f},
-std::array<float,2>{0.97157836f, 0.0253638607f},
-std::array<float,2>{0.36505422f, 0.265716642f},
-std::array<float,2>{0.620608926f, 0.630958855f},
-std::array<float,2>{0.4423666f, 0.5528723f},
-std::array<float,2>{0.63363117f, 0.480628133f},
-std::array<float,2>{0.184863389f, 0.239685297f},
-std::array<float,2>{0.796914518f, 0.970395446f},
-std::array<float,2>{0.288507462f, 0.919615328f},
-std::array<float,2>{0.549260855f, 0.146033153f},
-std::array<float,2>{0.113351703f, 0.406825662f},
-std::array<float,2>{0.881149471f, 0.624909699f},
-std::array<float,2>{0.189289913f, 0.725445032f},
-std::array<float,2>{0.82516712f, 0.352171123f},
-std::array<float,2>{0.410853863f, 0.0785308257f},
-std::array<float,2>{0.705536127f, 0.812120676f},
-std::array<float,2>{0.234441981f, 0.79677403f},
-std::array<float,2>{0.86779058f, 0.0776179433f},
-std::array<float,2>{0.382892758f, 0.3701832f},
-std::array<float,2>{0.726049602f, 0.745341122f},
-std::array<float,2>{0.251951665f, 0.607883036f},
-std::array<float,2>{0.508105457f, 0.423598886f},
-std::array<float,2>{0.077609472f, 0.13122198f},
-std::array<float,2>{0.907784164f, 0.92516923f},
-std::array<float,2>{0.476608276f, 0.995767772f},
-std::array<float,2>{0.666735649f, 0.228726551f},
-std::array<float,2>{0.153677315f, 0.496432036f},
-std::array<float,2>{0.769822359f, 0.546267986f},
-std::array<float,2>{0.0202983115f, 0.654968858f},
-std::array<float,2>{0.953280091f, 0.251211941f},
-std::array<float,2>{0.321727842f, 0.00857351813f},
-std::array<float,2>{0.585066617f, 0.860389769f},
-std::array<float,2>{0.105362117f, 0.902707934f},
-std::array<float,2>{0.893048108f, 0.16634357f},
-std::array<float,2>{0.309655219f, 0.392034292f},
-std::array<float,2>{0.546175122f, 0.584367156f},
-std::array<float,2>{0.43043831f, 0.693534374f},
-std::array<float,2>{0.700509548f, 0.337208629f},
-std::array<float,2>{0.207364708f, 0.118562512f},
-std::array<float,2>{0.832408667f, 0.778494895f},
-std::array<float,2>{0.347408295f, 0.818551838f},
-std::array<float,2>{0.596691012f, 0.0396537445f},
-std::array<float,2>{0.0508810915f, 0.284968078f},
-std::array<float,2>{0.992530465f, 0.681853116f},
-std::array<float,2>{0.159414604f, 0.505829036f},
-std::array<float,2>{0.78752017f, 0.462490052f},
-std::array<float,2>{0.455662102f, 0.204877764f},
-std::array<float,2>{0.651947379f, 0.947339237f},
-std::array<float,2>{0.21489124f, 0.935909212f},
-std::array<float,2>{0.836090744f, 0.139639333f},
-std::array<float,2>{0.424024582f, 0.430951774f},
-std::array<float,2>{0.693535089f, 0.599515557f},
-std::array<float,2>{0.298130602f, 0.738236547f},
-std::array<float,2>{0.537107646f, 0.363664627f},
-std::array<float,2>{0.098188892f, 0.064047195f},
-std::array<float,2>{0.905710459f, 0.781765044f},
-std::array<float,2>{0.462821871f, 0.867324591f},
-std::array<float,2>{0.641123712f, 0.00523086498f},
-std::array<float,2>{0.167530447f, 0.263386399f},
-std::array<float,2>{0.790757775f, 0.64839828f},
-std::array<float,2>{0.0556941181f, 0.534457445f},
-std::array<float,2>{0.991575062f, 0.4900195f},
-std::array<float,2>{0.353017241f, 0.223640308f},
-std::array<float,2>{0.60392499f, 0.989107132f},
-std::array<float,2>{0.0663380399f, 0.772865653f},
-std::array<float,2>{0.914920568f, 0.116700776f},
-std::array<float,2>{0.261576265f, 0.33431381f},
-std::array<float,2>{0.506919563f, 0.701534033f},
-std::array<float,2>{0.381817371f, 0.587189019f},
-std::array<float,2>{0.727173924f, 0.40282771f},
-std::array<float,2>{0.244513795f, 0.159824952f},
-std::array<float,2>{0.860895872f, 0.897785664f},
-std::array<float,2>{0.316563278f, 0.941908717f},
-std::array<float,2>{0.590279162f, 0.212166473f},
-std::array<float,2>{0.0286333095f, 0.454285204f},
-std::array<float,2>{0.961544335f, 0.508173347f},
-std::array<float,2>{0.141001001f, 0.674083114f},
-std::array<float,2>{0.780751646f, 0.289430648f},
-std::array<float,2>{0.476386487f, 0.0356791876f},
-std::array<float,2>{0.65826112f, 0.822068393f},
-std::array<float,2>{0.177850172f, 0.843565047f},
-std::array<float,2>{0.807540357f, 0.0535630323f},
-std::array<float,2>{0.451521546f, 0.299050242f},
-std::array<float,2>{0.627383173f, 0.658074856f},
-std::array<float,2>{0.370919228f, 0.524709761f},
-std::array<float,2>{0.613973558f, 0.447106689f},
-std::array<float,2>{0.0457826927f, 0.195805162f},
-std::array<float,2>{0.984232545f, 0.957388222f},
-std::array<float,2>{0.414936215f, 0.880965054f},
-std::array<float,2>{0.717931211f, 0.185422793f},
-std::array<float,2>{0.196438566f, 0.377842844f},
-std::array<float,2>{0.814936936f, 0.573853016f},
-std::array<float,2>{0.119386747f, 0.717271745f},
-std::array<float,2>{0.889308929f, 0.325115055f},
-std::array<float,2>{0.294894665f, 0.109062098f},
-std::array<float,2>{0.559578896f, 0.750326991f},
-std::array<float,2>{0.00949038193f, 0.976691246f},
-std::array<float,2>{0.938995838f, 0.246314555f},
-std::array<float,2>{0.342988729f, 0.47529009f},
-std::array<float,2>{0.570883453f, 0.56189549f},
-std::array<float,2>{0.499661535f, 0.639990151f},
-std::array<float,2>{0.67841208f, 0.276781738f},
-std::array<float,2>{0.137970075f, 0.0184946973f},
-std::array<float,2>{0.755294263f, 0.852688015f},
-std::array<float,2>{0.277248889f, 0.797262311f},
-std::array<float,2>{0.524072826f, 0.090822041f},
-std::array<float,2>{0.0911582932f, 0.344986826f},
-std::array<float,2>{0.937069356f, 0.728970051f},
-std::array<float,2>{0.221521974f, 0.615281701f},
-std::array<float,2>{0.856739163f, 0.41718328f},
-std::array<float,2>{0.403839439f, 0.15192768f},
-std::array<float,2>{0.737611651f, 0.912417948f},
-std::array<float,2>{0.170686841f, 0.885179043f},
-std::array<float,2>{0.795765936f, 0.176116243f},
-std::array<float,2>{0.465312362f, 0.383491814f},
-std::array<float,2>{0.646120191f, 0.56890732f},
-std::array<float,2>{0.357202768f, 0.708080947f},
-std::array<float,2>{0.60572052f, 0.316311359f},
-std::array<float,2>{0.0591872446f, 0.0967704132f},
-std::array<float,2>{0.985125005f, 0.763890743f},
-std::array<float,2>{0.428487211f, 0.831133366f},
-std::array<float,2>{0.689366639f, 0.0618195646f},
-std::array<float,2>{0.212331161f, 0.305928469f},
-std::array<float,2>{0.843666494f, 0.667072952f},
-std::array<float,2>{0.0974851474f, 0.522936463f},
-std::array<float,2>{0.90130353f, 0.440569639f},
-std::array<float,2>{0.300937235f, 0.192809597f},
-std::array<float,2>{0.532311916f, 0.967793345f},
-std::array<float,2>{0.0258071367f, 0.80647856f},
-std::array<float,2>{0.968045413f, 0.0831869543f},
-std::array<float,2>{0.315788835f, 0.356600404f},
-std::array<float,2>{0.588096678f, 0.722571611f},
-std::array<float,2>{0.472248793f, 0.620306492f},
-std::array<float,2>{0.663001716f, 0.413787216f},
-std::array<float,2>{0.145269811f, 0.14098604f},
-std::array<float,2>{0.776064575f, 0.915307164f},
-std::array<float,2>{0.264536798f, 0.973888397f},
-std::array<float,2>{0.500443518f, 0.237197936f},
-std::array<float,2>{0.0675100759f, 0.478499353f},
-std::array<float,2>{0.919930518f, 0.549669802f},
-std::array<float,2>{0.249505371f, 0.626880765f},
-std::array<float,2>{0.864377201f, 0.269911408f},
-std::array<float,2>{0.377953857f, 0.0310642868f},
-std::array<float,2>{0.732783496f, 0.843996286f},
-std::array<float,2>{0.200748906f, 0.866919518f},
-std::array<float,2>{0.816649497f, 0.0135849025f},
-std::array<float,2>{0.421201974f, 0.255418837f},
-std::array<float,2>{0.711833835f, 0.650498152f},
-std::array<float,2>{0.292794734f, 0.539417088f},
-std::array<float,2>{0.555965841f, 0.493758649f},
-std::array<float,2>{0.122286581f, 0.231045321f},
-std::array<float,2>{0.884501755f, 0.999762893f},
-std::array<float,2>{0.447838813f, 0.927622378f},
-std::array<float,2>{0.631658614f, 0.128466502f},
-std::array<float,2>{0.171931356f, 0.426703602f},
-std::array<float,2>{0.808826804f, 0.605148971f},
-std::array<float,2>{0.041151423f, 0.748522222f},
-std::array<float,2>{0.9800421f, 0.374148548f},
-std::array<float,2>{0.374763012f, 0.0722284243f},
-std::array<float,2>{0.610054433f, 0.791131973f},
-std::array<float,2>{0.0883055851f, 0.95232439f},
-std::array<float,2>{0.931492031f, 0.207426175f},
-std::array<float,2>{0.278449863f, 0.466140807f},
-std::array<float,2>{0.529220223f, 0.501155436f},
-std::array<float,2>{0.400608271f, 0.685596764f},
-std::array<float,2>{0.738481045f, 0.285782933f},
-std::array<float,2>{0.22626555f, 0.0450170785f},
-std::array<float,2>{0.854324281f, 0.813578248f},
-std::array<float,2>{0.337778002f, 0.774730504f},
-std::array<float,2>{0.577603817f, 0.122664854f},
-std::array<float,2>{0.0148964729f, 0.341204941f},
-std::array<float,2>{0.943488002f, 0.689018071f},
-std::array<float,2>{0.133556813f, 0.579873085f},
-std::array<float,2>{0.751652896f, 0.397017866f},
-std::array<float,2>{0.493978053f, 0.167997912f},
-std::array<float,2>{0.673370123f, 0.902329326f},
-std::array<float,2>{0.232898906f, 0.986798823f},
-std::array<float,2>{0.849513769f, 0.222412616f},
-std::array<float,2>{0.39194864f, 0.485975623f},
-std::array<float,2>{0.745824575f, 0.535883546f},
-std::array<float,2>{0.269764513f, 0.640941501f},
-std::array<float,2>{0.520383775f, 0.26103732f},
-std::array<float,2>{0.0818200186f, 0.00286443136f},
-std::array<float,2>{0.924234748f, 0.87293458f},
-std::array<float,2>{0.490002602f, 0.788703144f},
-std::array<float,2>{0.682416797f, 0.0670490265f},
-std::array<float,2>{0.127216294f, 0.361785322f},
-std::array<float,2>{0.762676299f, 0.739765525f},
-std::array<float,2>{0.00207018829f, 0.595356584f},
-std::array<float,2>{0.949350119f, 0.433855325f},
-std::array<float,2>{0.331744105f, 0.136167824f},
-std::array<float,2>{0.569771528f, 0.929785728f},
-std::array<float,2>{0.111279987f, 0.826742828f},
-std::array<float,2>{0.877928436f, 0.0317975804f},
-std::array<float,2>{0.282307476f, 0.294333279f},
-std::array<float,2>{0.550792217f, 0.676097751f},
-std::array<float,2>{0.40882507f, 0.512217641f},
-std::array<float,2>{0.708670795f, 0.457445204f},
-std::array<float,2>{0.194390059f, 0.217295021f},
-std::array<float,2>{0.822288275f, 0.937535226f},
-std::array<float,2>{0.362892032f, 0.89331764f},
-std::array<float,2>{0.624116063f, 0.160603479f},
-std::array<float,2>{0.0332206376f, 0.401541471f},
-std::array<float,2>{0.976163208f, 0.589877486f},
-std::array<float,2>{0.182525456f, 0.69806385f},
-std::array<float,2>{0.801107645f, 0.328898519f},
-std::array<float,2>{0.440262645f, 0.113153957f},
-std::array<float,2>{0.63897568f, 0.769169509f},
-std::array<float,2>{0.151938468f, 0.757129967f},
-std::array<float,2>{0.768203378f, 0.103919193f},
-std::array<float,2>{0.481182188f, 0.323475122f},
-std::array<float,2>{0.668498099f, 0.713859677f},
-std::array<float,2>{0.32613346f, 0.574813664f},
-std::array<float,2>{0.579648614f, 0.381219596f},
-std::array<float,2>{0.0160769224f, 0.179716617f},
-std::array<float,2>{0.960344672f, 0.876296103f},
-std::array<float,2>{0.389817834f, 0.955518365f},
-std::array<float,2>{0.719965577f, 0.199632421f},
-std::array<float,2>{0.240457222f, 0.449344516f},
-std::array<float,2>{0.872492611f, 0.529094815f},
-std::array<float,2>{0.0715629235f, 0.660881877f},
-std::array<float,2>{0.91132158f, 0.304449767f},
-std::array<float,2>{0.256908178f, 0.0476248935f},
-std::array<float,2>{0.51367563f, 0.839329183f},
-std::array<float,2>{0.0469831713f, 0.909076452f},
-std::array<float,2>{0.997206688f, 0.154384866f},
-std::array<float,2>{0.350287825f, 0.421779871f},
-std::array<float,2>{0.599614382f, 0.611379206f},
-std::array<float,2>{0.457721382f, 0.733291745f},
-std::array<float,2>{0.652635038f, 0.348068297f},
-std::array<float,2>{0.162529141f, 0.0880520046f},
-std::array<float,2>{0.785116136f, 0.804472446f},
-std::array<float,2>{0.305721492f, 0.858178675f},
-std::array<float,2>{0.541479409f, 0.0207967423f},
-std::array<float,2>{0.106783837f, 0.2790654f},
-std::array<float,2>{0.895516932f, 0.633534491f},
-std::array<float,2>{0.206700236f, 0.555374324f},
-std::array<float,2>{0.831226707f, 0.471648306f},
-std::array<float,2>{0.436933637f, 0.242550194f},
-std::array<float,2>{0.69637239f, 0.982090592f},
-std::array<float,2>{0.187144473f, 0.972648799f},
-std::array<float,2>{0.800351322f, 0.24059844f},
-std::array<float,2>{0.444583088f, 0.484026521f},
-std::array<float,2>{0.635869265f, 0.55103308f},
-std::array<float,2>{0.366289347f, 0.630679071f},
-std::array<float,2>{0.618538916f, 0.267751813f},
-std::array<float,2>{0.0371643752f, 0.0271833744f},
-std::array<float,2>{0.969853401f, 0.850301862f},
-std::array<float,2>{0.413320541f, 0.809530556f},
-std::array<float,2>{0.704319775f, 0.0805967301f},
-std::array<float,2>{0.190984488f, 0.353760004f},
-std::array<float,2>{0.827388406f, 0.724059701f},
-std::array<float,2>{0.116135888f, 0.621688664f},
-std::array<float,2>{0.879382849f, 0.40912044f},
-std::array<float,2>{0.286347926f, 0.147741288f},
-std::array<float,2>{0.547378242f, 0.921409905f},
-std::array<float,2>{0.0048967395f, 0.832089901f},
-std::array<float,2>{0.94804281f, 0.0571369044f},
-std::array<float,2>{0.333696097f, 0.309259534f},
-std::array<float,2>{0.565671444f, 0.671027839f},
-std::array<float,2>{0.486208856f, 0.517909288f},
-std::array<float,2>{0.683656693f, 0.443541139f},
-std::array<float,2>{0.129550278f, 0.189331979f},
-std::array<float,2>{0.759811342f, 0.963752627f},
-std::array<float,2>{0.266081333f, 0.888752103f},
-std::array<float,2>{0.516254306f, 0.174099416f},
-std::array<float,2>{0.0844264403f, 0.38924545f},
-std::array<float,2>{0.929101169f, 0.565175176f},
-std::array<float,2>{0.229195312f, 0.703393161f},
-std::array<float,2>{0.846130013f, 0.319230378f},
-std::array<float,2>{0.395759642f, 0.101188995f},
-std::array<float,2>{0.74643755f, 0.758967876f},
-std::array<float,2>{0.21031101f, 0.779784918f},
-std::array<float,2>{0.834647417f, 0.120368317f},
-std::array<float,2>{0.432006687f, 0.338862479f},
-std::array<float,2>{0.701760173f, 0.692896664f},
-std::array<float,2>{0.312224418f, 0.582567632f},
-std::array<float,2>{0.543783486f, 0.392654449f},
-std::array<float,2>{0.102870002f, 0.164465487f},
-std::array<float,2>{0.8909868f, 0.904763162f},
-std::array<float,2>{0.455077916f, 0.946234822f},
-std::array<float,2>{0.649567723f, 0.206088468f},
-std::array<float,2>{0.156487241f, 0.463448435f},
-std::array<float,2>{0.786017358f, 0.506338954f},
-std::array<float,2>{0.0536069982f, 0.680984139f},
-std::array<float,2>{0.994215012f, 0.281369805f},
-std::array<float,2>{0.344187081f, 0.0412771069f},
-std::array<float,2>{0.59461993f, 0.818119824f},
-std::array<float,2>{0.0754157752f, 0.922198176f},
-std::array<float,2>{0.909666598f, 0.130315423f},
-std::array<float,2>{0.253793687f, 0.424362987f},
-std::array<float,2>{0.510255158f, 0.605774879f},
-std::array<float,2>{0.386520475f, 0.743453503f},
-std::array<float,2>{0.72459501f, 0.368419379f},
-std::array<float,2>{0.237507567f, 0.0755574405f},
-std::array<float,2>{0.869549274f, 0.794921458f},
-std::array<float,2>{0.322425455f, 0.862850845f},
-std::array<float,2>{0.583593547f, 0.010673631f},
-std::array<float,2>{0.0222162288f, 0.252313793f},
-std::array<float,2>{0.956088543f, 0.654109418f},
-std::array<float,2>{0.154568613f, 0.544865727f},
-std::array<float,2>{0.771560133f, 0.498112053f},
-std::array<float,2>{0.479075432f, 0.226878345f},
-std::array<float,2>{0.664344847f, 0.992318034f},
-std::array<float,2>{0.243099734f, 0.896477103f},
-std::array<float,2>{0.861478686f, 0.15742138f},
-std::array<float,2>{0.380543768f, 0.405669361f},
-std::array<float,2>{0.73000586f, 0.588888228f},
-std::array<float,2>{0.258329511f, 0.699345767f},
-std::array<float,2>{0.505166471f, 0.332132727f},
-std::array<float,2>{0.0644354075f, 0.115159757f},
-std::array<float,2>{0.917028904f, 0.770657837f},
-std::array<float,2>{0.473696381f, 0.823487341f},
-std::array<float,2>{0.656390965f, 0.0390440226f},
-std::array<float,2>{0.143499911f, 0.292591214f},
-std::array<float,2>{0.778461218f, 0.673076272f},
-std::array<float,2>{0.0302576516f, 0.511297047f},
-std::array<float,2>{0.963118494f, 0.456634998f},
-std::array<float,2>{0.319081098f, 0.213642389f},
-std::array<float,2>{0.593162f, 0.943681657f},
-std::array<float,2>{0.0998653248f, 0.784400105f},
-std::array<float,2>{0.902694583f, 0.065878205f},
-std::array<float,2>{0.300393492f, 0.36661762f},
-std::array<float,2>{0.538834989f, 0.735244215f},
-std::array<float,2>{0.423171431f, 0.60106492f},
-std::array<float,2>{0.692523897f, 0.432249755f},
-std::array<float,2>{0.217035055f, 0.13742134f},
-std::array<float,2>{0.838910818f, 0.9347561f},
-std::array<float,2>{0.355226338f, 0.992108047f},
-std::array<float,2>{0.601694882f, 0.22556296f},
-std::array<float,2>{0.0579344146f, 0.491250157f},
-std::array<float,2>{0.989150345f, 0.53167218f},
-std::array<float,2>{0.16446504f, 0.645012617f},
-std::array<float,2>{0.792797327f, 0.264810503f},
-std::array<float,2>{0.464013726f, 0.00714023225f},
-std::array<float,2>{0.644509315f, 0.869153321f},
-std::array<float,2>{0.140396729f, 0.853575885f},
-std::array<float,2>{0.755912125f, 0.0158924498f},
-std::array<float,2>{0.497468352f, 0.274683475f},
-std::array<float,2>{0.67623657f, 0.638304651f},
-std::array<float,2>{0.34097147f, 0.560370266f},
-std::array<float,2>{0.573845387f, 0.473521352f},
-std::array<float,2>{0.0113297291f, 0.249810368f},
-std::array<float,2>{0.94084549f, 0.97916913f},
-std::array<float,2>{0.40527606f, 0.911089838f},
-std::array<float,2>{0.735034049f, 0.149306685f},
-std::array<float,2>{0.21909979f, 0.415712655f},
-std::array<float,2>{0.858378232f, 0.614826202f},
-std::array<float,2>{0.0918218568f, 0.726895034f},
-std::array<float,2>{0.934351265f, 0.346187681f},
-std::array<float,2>{0.275386602f, 0.0932119191f},
-std::array<float,2>{0.526319265f, 0.799553692f},
-std::array<float,2>{0.0435492136f, 0.960098684f},
-std::array<float,2>{0.982374668f, 0.197999775f},
-std::array<float,2>{0.368150234f, 0.448338062f},
-std::array<float,2>{0.61558938f, 0.52571851f},
-std::array<float,2>{0.449854583f, 0.65983063f},
-std::array<float,2>{0.626219749f, 0.298416406f},
-std::array<float,2>{0.176640123f, 0.0519433841f},
-std::array<float,2>{0.806253076f, 0.841134667f},
-std::array<float,2>{0.295483798f, 0.752480745f},
-std::array<float,2>{0.562472403f, 0.106322892f},
-std::array<float,2>{0.119088866f, 0.326643944f},
-std::array<float,2>{0.888405025f, 0.716107011f},
-std::array<float,2>{0.199120134f, 0.571454406f},
-std::array<float,2>{0.813205957f, 0.376917541f},
-std::array<float,2>{0.4168396f, 0.187130556f},
-std::array<float,2>{0.715530932f, 0.879873633f},
-std::array<float,2>{0.148379639f, 0.916266084f},
-std::array<float,2>{0.774216771f, 0.142898008f},
-std::array<float,2>{0.469792634f, 0.410282344f},
-std::array<float,2>{0.661825597f, 0.617857277f},
-std::array<float,2>{0.313848138f, 0.718780875f},
-std::array<float,2>{0.587347806f, 0.359373987f},
-std::array<float,2>{0.0239622928f, 0.0843338668f},
-std::array<float,2>{0.966232657f, 0.80687654f},
-std::array<float,2>{0.376545042f, 0.845876634f},
-std::array<float,2>{0.731541693f, 0.0280661806f},
-std::array<float,2>{0.246780589f, 0.272048831f},
-std::array<float,2>{0.866225064f, 0.628195524f},
-std::array<float,2>{0.0685992166f, 0.548478246f},
-std::array<float,2>{0.918486059f, 0.47925815f},
-std::array<float,2>{0.262889326f, 0.236099377f},
-std::array<float,2>{0.502108991f, 0.975558698f},
-std::array<float,2>{0.0612225272f, 0.761782885f},
-std::array<float,2>{0.98633033f, 0.0951795429f},
-std::array<float,2>{0.35823825f, 0.31320262f},
-std::array<float,2>{0.608495891f, 0.710842013f},
-std::array<float,2>{0.468500733f, 0.568077803f},
-std::array<float,2>{0.646500826f, 0.384852707f},
-std::array<float,2>{0.169263035f, 0.17781727f},
-std::array<float,2>{0.793431938f, 0.884218395f},
-std::array<float,2>{0.3043437f, 0.965616465f},
-std::array<float,2>{0.534198582f, 0.194925308f},
-std::array<float,2>{0.0948087126f, 0.438839257f},
-std::array<float,2>{0.898811638f, 0.519946814f},
-std::array<float,2>{0.213304624f, 0.665279746f},
-std::array<float,2>{0.840832651f, 0.30807662f},
-std::array<float,2>{0.427250266f, 0.0586107932f},
-std::array<float,2>{0.691078007f, 0.828719854f},
-std::array<float,2>{0.224471703f, 0.815196931f},
-std::array<float,2>{0.852875113f, 0.0447393507f},
-std::array<float,2>{0.40020147f, 0.28815046f},
-std::array<float,2>{0.741510868f, 0.6840536f},
-std::array<float,2>{0.280671269f, 0.503680527f},
-std::array<float,2>{0.52949512f, 0.468095928f},
-std::array<float,2>{0.0860867947f, 0.210329622f},
-std::array<float,2>{0.933173478f, 0.949230373f},
-std::array<float,2>{0.49467957f, 0.89982003f},
-std::array<float,2>{0.675072551f, 0.170455933f},
-std::array<float,2>{0.135080367f, 0.39571324f},
-std::array<float,2>{0.753393114f, 0.58021754f},
-std::array<float,2>{0.0118057728f, 0.691293955f},
-std::array<float,2>{0.941876948f, 0.343343586f},
-std::array<float,2>{0.339826792f, 0.124283634f},
-std::array<float,2>{0.575769842f, 0.77704829f},
-std::array<float,2>{0.124206372f, 0.996746421f},
-std::array<float,2>{0.886503577f, 0.233468175f},
-std::array<float,2>{0.289932191f, 0.494594306f},
-std::array<float,2>{0.557979524f, 0.54248631f},
-std::array<float,2>{0.419805557f, 0.649787903f},
-std::array<float,2>{0.714213431f, 0.256599367f},
-std::array<float,2>{0.201290354f, 0.0149153052f},
-std::array<float,2>{0.819297075f, 0.865049839f},
-std::array<float,2>{0.371520609f, 0.789961219f},
-std::array<float,2>{0.61253351f, 0.0727030858f},
-std::array<float,2>{0.0407581255f, 0.372493505f},
-std::array<float,2>{0.978005052f, 0.747790813f},
-std::array<float,2>{0.174391046f, 0.601873636f},
-std::array<float,2>{0.812132478f, 0.427890748f},
-std::array<float,2>{0.446487278f, 0.125138491f},
-std::array<float,2>{0.629592896f, 0.92889899f},
-std::array<float,2>{0.191546351f, 0.941203117f},
-std::array<float,2>{0.821433544f, 0.216529161f},
-std::array<float,2>{0.407541007f, 0.460912049f},
-std::array<float,2>{0.709511578f, 0.515080392f},
-std::array<float,2>{0.28416723f, 0.67870748f},
-std::array<float,2>{0.553661406f, 0.295640677f},
-std::array<float,2>{0.111736476f, 0.0334145352f},
-std::array<float,2>{0.876457453f, 0.824955046f},
-std::array<float,2>{0.439215541f, 0.766167343f},
-std::array<float,2>{0.638390243f, 0.109886758f},
-std::array<float,2>{0.179846063f, 0.331000715f},
-std::array<float,2>{0.803921938f, 0.695534587f},
-std::array<float,2>{0.0316580161f, 0.593279839f},
-std::array<float,2>{0.973875582f, 0.399431705f},
-std::array<float,2>{0.361022532f, 0.162638128f},
-std::array<float,2>{0.621869922f, 0.89149797f},
-std::array<float,2>{0.0796224996f, 0.873182714f},
-std::array<float,2>{0.923034906f, 0.0015454503f},
-std::array<float,2>{0.271966398f, 0.258066952f},
-std::array<float,2>{0.52267611f, 0.644411385f},
-std::array<float,2>{0.393117577f, 0.538759053f},
-std::array<float,2>{0.744001627f, 0.488234758f},
-std::array<float,2>{0.231182247f, 0.219991535f},
-std::array<float,2>{0.850480556f, 0.985983074f},
-std::array<float,2>{0.328125387f, 0.932336986f},
-std::array<float,2>{0.568074882f, 0.133115813f},
-std::array<float,2>{0.000718730735f, 0.436916649f},
-std::array<float,2>{0.951701343f, 0.595927835f},
-std::array<float,2>{0.125169352f, 0.742171764f},
-std::array<float,2>{0.764229f, 0.359425247f},
-std::array<float,2>{0.492158622f, 0.0696432367f},
-std::array<float,2>{0.680869937f, 0.786402225f},
-std::array<float,2>{0.161205962f, 0.800852716f},
-std::array<float,2>{0.781537116f, 0.0859881639f},
-std::array<float,2>{0.459733874f, 0.3508434f},
-std::array<float,2>{0.655347645f, 0.731471837f},
-std::array<float,2>{0.347715318f, 0.609923542f},
-std::array<float,2>{0.598402739f, 0.418239146f},
-std::array<float,2>{0.0496358685f, 0.154010534f},
-std::array<float,2>{0.998759925f, 0.90692848f},
-std::array<float,2>{0.434231013f, 0.982434213f},
-std::array<float,2>{0.698687077f, 0.245681226f},
-std::array<float,2>{0.203291401f, 0.470648348f},
-std::array<float,2>{0.828719854f, 0.556899846f},
-std::array<float,2>{0.107966289f, 0.635357559f},
-std::array<float,2>{0.897696376f, 0.280118138f},
-std::array<float,2>{0.307026356f, 0.022205811f},
-std::array<float,2>{0.539756715f, 0.855713665f},
-std::array<float,2>{0.018302545f, 0.877946377f},
-std::array<float,2>{0.957877159f, 0.182537034f},
-std::array<float,2>{0.326751769f, 0.379438132f},
-std::array<float,2>{0.581701279f, 0.576494932f},
-std::array<float,2>{0.482650399f, 0.7114712f},
-std::array<float,2>{0.670211196f, 0.321532041f},
-std::array<float,2>{0.148845851f, 0.102197304f},
-std::array<float,2>{0.765626311f, 0.755130887f},
-std::array<float,2>{0.255247027f, 0.836354315f},
-std::array<float,2>{0.512540102f, 0.0496066175f},
-std::array<float,2>{0.0733938292f, 0.302206635f},
-std::array<float,2>{0.913366199f, 0.663796425f},
-std::array<float,2>{0.238796979f, 0.530253053f},
-std::array<float,2>{0.873525798f, 0.452270418f},
-std::array<float,2>{0.387694895f, 0.202927947f},
-std::array<float,2>{0.721367657f, 0.953666151f},
-std::array<float,2>{0.176170468f, 0.957721829f},
-std::array<float,2>{0.80572474f, 0.195775568f},
-std::array<float,2>{0.44928962f, 0.44631657f},
-std::array<float,2>{0.626890957f, 0.525014877f},
-std::array<float,2>{0.367357165f, 0.657411873f},
-std::array<float,2>{0.61580503f, 0.29969728f},
-std::array<float,2>{0.0431479327f, 0.0529381298f},
-std::array<float,2>{0.981794f, 0.842954099f},
-std::array<float,2>{0.416092694f, 0.750490904f},
-std::array<float,2>{0.71487087f, 0.108528614f},
-std::array<float,2>{0.198616758f, 0.324515492f},
-std::array<float,2>{0.812934101f, 0.717773139f},
-std::array<float,2>{0.118481666f, 0.573345006f},
-std::array<float,2>{0.888078094f, 0.377132922f},
-std::array<float,2>{0.295226067f, 0.184580356f},
-std::array<float,2>{0.561894834f, 0.881514668f},
-std::array<float,2>{0.0111819338f, 0.853458345f},
-std::array<float,2>{0.941340983f, 0.0178688932f},
-std::array<float,2>{0.341699421f, 0.27713266f},
-std::array<float,2>{0.573522449f, 0.640392363f},
-std::array<float,2>{0.497601718f, 0.562030733f},
-std::array<float,2>{0.676580131f, 0.474775523f},
-std::array<float,2>{0.139731348f, 0.246583134f},
-std::array<float,2>{0.756441414f, 0.977269351f},
-std::array<float,2>{0.274597079f, 0.912716568f},
-std::array<float,2>{0.525575042f, 0.151657954f},
-std::array<float,2>{0.0924858972f, 0.417913586f},
-std::array<float,2>{0.933672488f, 0.615899801f},
-std::array<float,2>{0.219665095f, 0.729366124f},
-std::array<float,2>{0.857897341f, 0.345644653f},
-std::array<float,2>{0.406105876f, 0.0914428309f},
-std::array<float,2>{0.734385908f, 0.797523558f},
-std::array<float,2>{0.217335328f, 0.781665146f},
-std::array<float,2>{0.839521289f, 0.0635447353f},
-std::array<float,2>{0.423437536f, 0.363826782f},
-std::array<float,2>{0.693327129f, 0.737546027f},
-std::array<float,2>{0.299965322f, 0.598801076f},
-std::array<float,2>{0.53830421f, 0.43147099f},
-std::array<float,2>{0.100148082f, 0.138850257f},
-std::array<float,2>{0.902989805f, 0.936267197f},
-std::array<float,2>{0.464368135f, 0.988405049f},
-std::array<float,2>{0.643664181f, 0.22414881f},
-std::array<float,2>{0.16455318f, 0.489348382f},
-std::array<float,2>{0.792431593f, 0.534859955f},
-std::array<float,2>{0.0582313165f, 0.647846341f},
-std::array<float,2>{0.988662362f, 0.262884825f},
-std::array<float,2>{0.354676932f, 0.00575612346f},
-std::array<float,2>{0.602079928f, 0.867732167f},
-std::array<float,2>{0.06373135f, 0.898055077f},
-std::array<float,2>{0.917859316f, 0.159334794f},
-std::array<float,2>{0.258164644f, 0.40291065f},
-std::array<float,2>{0.50585115f, 0.587437272f},
-std::array<float,2>{0.380144447f, 0.70212549f},
-std::array<float,2>{0.729729235f, 0.334814578f},
-std::array<float,2>{0.242370695f, 0.116604514f},
-std::array<float,2>{0.861839473f, 0.773006976f},
-std::array<float,2>{0.318680257f, 0.821655929f},
-std::array<float,2>{0.593676507f, 0.0354894698f},
-std::array<float,2>{0.0293266661f, 0.289798975f},
-std::array<float,2>{0.963742435f, 0.674387276f},
-std::array<float,2>{0.14305611f, 0.508349955f},
-std::array<float,2>{0.779049873f, 0.455041111f},
-std::array<float,2>{0.474393874f, 0.212561026f},
-std::array<float,2>{0.65685004f, 0.941496074f},
-std::array<float,2>{0.23816219f, 0.925636768f},
-std::array<float,2>{0.869817734f, 0.13146174f},
-std::array<float,2>{0.385771304f, 0.422973096f},
-std::array<float,2>{0.723734856f, 0.608187497f},
-std::array<float,2>{0.253371119f, 0.745825708f},
-std::array<float,2>{0.509815753f, 0.370722651f},
-std::array<float,2>{0.0758177042f, 0.0778071135f},
-std::array<float,2>{0.910020113f, 0.796291411f},
-std::array<float,2>{0.478746653f, 0.860911727f},
-std::array<float,2>{0.664880335f, 0.00817419216f},
-std::array<float,2>{0.155238435f, 0.251927257f},
-std::array<float,2>{0.772220731f, 0.654713035f},
-std::array<float,2>{0.0217694379f, 0.546481073f},
-std::array<float,2>{0.956830978f, 0.496731102f},
-std::array<float,2>{0.32295534f, 0.22906287f},
-std::array<float,2>{0.583280861f, 0.995509923f},
-std::array<float,2>{0.103202373f, 0.778996587f},
-std::array<float,2>{0.891414762f, 0.118792757f},
-std::array<float,2>{0.311555147f, 0.337508291f},
-std::array<float,2>{0.543424904f, 0.693882167f},
-std::array<float,2>{0.432468653f, 0.584719718f},
-std::array<float,2>{0.701643586f, 0.392468661f},
-std::array<float,2>{0.210783884f, 0.16679956f},
-std::array<float,2>{0.834234059f, 0.902842224f},
-std::array<float,2>{0.344434261f, 0.947953165f},
-std::array<float,2>{0.593866765f, 0.204538837f},
-std::array<float,2>{0.0529809371f, 0.46225825f},
-std::array<float,2>{0.995109677f, 0.505106866f},
-std::array<float,2>{0.156986356f, 0.682141721f},
-std::array<float,2>{0.785539567f, 0.284504086f},
-std::array<float,2>{0.454400331f, 0.0394550487f},
-std::array<float,2>{0.65019685f, 0.819281459f},
-std::array<float,2>{0.129158124f, 0.835306644f},
-std::array<float,2>{0.760326862f, 0.0552688949f},
-std::array<float,2>{0.485499114f, 0.310949653f},
-std::array<float,2>{0.684288919f, 0.668653905f},
-std::array<float,2>{0.33304137f, 0.517295241f},
-std::array<float,2>{0.56624645f, 0.442280889f},
-std::array<float,2>{0.00572141213f, 0.190283537f},
-std::array<float,2>{0.947726369f, 0.962400198f},
-std::array<float,2>{0.396294296f, 0.887866974f},
-std::array<float,2>{0.746970594f, 0.173049822f},
-std::array<float,2>{0.228980467f, 0.387658328f},
-std::array<float,2>{0.846370876f, 0.563863873f},
-std::array<float,2>{0.0847468451f, 0.705098927f},
-std::array<float,2>{0.929369032f, 0.316990644f},
-std::array<float,2>{0.266387165f, 0.0986911952f},
-std::array<float,2>{0.515950441f, 0.761048317f},
-std::array<float,2>{0.0378113985f, 0.969763041f},
-std::array<float,2>{0.97061497f, 0.24007912f},
-std::array<float,2>{0.36688745f, 0.481412202f},
-std::array<float,2>{0.619110763f, 0.553609967f},
-std::array<float,2>{0.445234329f, 0.631562054f},
-std::array<float,2>{0.636261702f, 0.266502142f},
-std::array<float,2>{0.186876535f, 0.0244186483f},
-std::array<float,2>{0.800022364f, 0.847658515f},
-std::array<float,2>{0.286687464f, 0.811761141f},
-std::array<float,2>{0.547342062f, 0.0790175423f},
-std::array<float,2>{0.11569263f, 0.351878643f},
-std::array<float,2>{0.879595518f, 0.725019813f},
-std::array<float,2>{0.190909877f, 0.624308944f},
-std::array<float,2>{0.827891529f, 0.406579345f},
-std::array<float,2>{0.413906932f, 0.14589563f},
-std::array<float,2>{0.70471257f, 0.919342041f},
-std::array<float,2>{0.148989305f, 0.876646042f},
-std::array<float,2>{0.766117275f, 0.180321708f},
-std::array<float,2>{0.483150601f, 0.38143307f},
-std::array<float,2>{0.670670986f, 0.574670017f},
-std::array<float,2>{0.326347262f, 0.712985992f},
-std::array<float,2>{0.581412375f, 0.323825419f},
-std::array<float,2>{0.0177907608f, 0.104039192f},
-std::array<float,2>{0.957045019f, 0.757797778f},
-std::array<float,2>{0.38676244f, 0.839704752f},
-std::array<float,2>{0.72104001f, 0.0473220795f},
-std::array<float,2>{0.238360271f, 0.304132015f},
-std::array<float,2>{0.873877525f, 0.660629213f},
-std::array<float,2>{0.0740951747f, 0.528806806f},
-std::array<float,2>{0.91406244f, 0.450103015f},
-std::array<float,2>{0.255555481f, 0.199884593f},
-std::array<float,2>{0.511865139f, 0.955841839f},
-std::array<float,2>{0.0489267744f, 0.803993642f},
-std::array<float,2>{0.998105407f, 0.0887987316f},
-std::array<float,2>{0.348269284f, 0.348201811f},
-std::array<float,2>{0.597865045f, 0.732439399f},
-std::array<float,2>{0.45942989f, 0.611926258f},
-std::array<float,2>{0.656074822f, 0.421287715f},
-std::array<float,2>{0.161644191f, 0.155147523f},
-std::array<float,2>{0.781917095f, 0.908536792f},
-std::array<float,2>{0.307173222f, 0.981641233f},
-std::array<float,2>{0.539483011f, 0.242810339f},
-std::array<float,2>{0.107888892f, 0.47095269f},
-std::array<float,2>{0.897950709f, 0.554784536f},
-std::array<float,2>{0.203956217f, 0.632957816f},
-std::array<float,2>{0.82857126f, 0.278674692f},
-std::array<float,2>{0.433854073f, 0.021433169f},
-std::array<float,2>{0.698999763f, 0.857429504f},
-std::array<float,2>{0.230767801f, 0.87230444f},
-std::array<float,2>{0.849862456f, 0.00217208848f},
-std::array<float,2>{0.392581284f, 0.261395961f},
-std::array<float,2>{0.743399441f, 0.64146775f},
-std::array<float,2>{0.27234596f, 0.535412908f},
-std::array<float,2>{0.523185551f, 0.485571653f},
-std::array<float,2>{0.0792374685f, 0.221866429f},
-std::array<float,2>{0.92344147f, 0.986977577f},
-std::array<float,2>{0.491685152f, 0.930284321f},
-std::array<float,2>{0.681257844f, 0.136605725f},
-std::array<float,2>{0.125654206f, 0.434384257f},
-std::array<float,2>{0.764114201f, 0.59503305f},
-std::array<float,2>{0.00042481054f, 0.739350319f},
-std::array<float,2>{0.951304555f, 0.36189875f},
-std::array<float,2>{0.328756005f, 0.0664823949f},
-std::array<float,2>{0.567648351f, 0.788266718f},
-std::array<float,2>{0.112142034f, 0.938466907f},
-std::array<float,2>{0.876903355f, 0.217132583f},
-std::array<float,2>{0.283392578f, 0.457814336f},
-std::array<float,2>{0.552844703f, 0.512012959f},
-std::array<float,2>{0.407816231f, 0.676285267f},
-std::array<float,2>{0.709074855f, 0.294780433f},
-std::array<float,2>{0.192292139f, 0.0314891562f},
-std::array<float,2>{0.822020352f, 0.826337934f},
-std::array<float,2>{0.360545963f, 0.76868242f},
-std::array<float,2>{0.621356964f, 0.112477563f},
-std::array<float,2>{0.0318568088f, 0.328314096f},
-std::array<float,2>{0.974544227f, 0.697363496f},
-std::array<float,2>{0.180587903f, 0.590545952f},
-std::array<float,2>{0.804424226f, 0.401991993f},
-std::array<float,2>{0.438911825f, 0.161074787f},
-std::array<float,2>{0.638005972f, 0.892644107f},
-std::array<float,2>{0.2018511f, 0.999162853f},
-std::array<float,2>{0.818799138f, 0.230697572f},
-std::array<float,2>{0.419094503f, 0.493395865f},
-std::array<float,2>{0.714381814f, 0.539959729f},
-std::array<float,2>{0.289130211f, 0.651163936f},
-std::array<float,2>{0.558543503f, 0.254950017f},
-std::array<float,2>{0.124844708f, 0.0128023801f},
-std::array<float,2>{0.88605082f, 0.866628051f},
-std::array<float,2>{0.447216511f, 0.791845322f},
-std::array<float,2>{0.629138052f, 0.071698688f},
-std::array<float,2>{0.173882335f, 0.374777555f},
-std::array<float,2>{0.81200552f, 0.748919249f},
-std::array<float,2>{0.040109843f, 0.604658842f},
-std::array<float,2>{0.978330672f, 0.425957084f},
-std::array<float,2>{0.371732086f, 0.128006116f},
-std::array<float,2>{0.612901986f, 0.926853478f},
-std::array<float,2>{0.0865775943f, 0.814027369f},
-std::array<float,2>{0.932821453f, 0.0456965491f},
-std::array<float,2>{0.280914247f, 0.28534013f},
-std::array<float,2>{0.530223489f, 0.686282337f},
-std::array<float,2>{0.399525821f, 0.501791298f},
-std::array<float,2>{0.742042542f, 0.466788024f},
-std::array<float,2>{0.223976567f, 0.207688808f},
-std::array<float,2>{0.853028357f, 0.952775657f},
-std::array<float,2>{0.338990003f, 0.901601255f},
-std::array<float,2>{0.575521588f, 0.168731719f},
-std::array<float,2>{0.0124256983f, 0.396834821f},
-std::array<float,2>{0.942362607f, 0.579411864f},
-std::array<float,2>{0.135338575f, 0.688849926f},
-std::array<float,2>{0.75349611f, 0.341494948f},
-std::array<float,2>{0.494273722f, 0.122295313f},
-std::array<float,2>{0.675295174f, 0.774913132f},
-std::array<float,2>{0.16954571f, 0.764339387f},
-std::array<float,2>{0.79385978f, 0.0974359214f},
-std::array<float,2>{0.46819815f, 0.315883815f},
-std::array<float,2>{0.647303402f, 0.708959877f},
-std::array<float,2>{0.357891947f, 0.568528891f},
-std::array<float,2>{0.609235227f, 0.383193463f},
-std::array<float,2>{0.0606765412f, 0.176701844f},
-std::array<float,2>{0.986890137f, 0.885729253f},
-std::array<float,2>{0.426834494f, 0.968693018f},
-std::array<float,2>{0.690461934f, 0.193134531f},
-std::array<float,2>{0.213514179f, 0.441333324f},
-std::array<float,2>{0.841499567f, 0.523303926f},
-std::array<float,2>{0.0955767259f, 0.667751849f},
-std::array<float,2>{0.899141192f, 0.306515455f},
-std::array<float,2>{0.3037889f, 0.0621869825f},
-std::array<float,2>{0.534758151f, 0.831853807f},
-std::array<float,2>{0.0237823948f, 0.915676832f},
-std::array<float,2>{0.966405511f, 0.141197756f},
-std::array<float,2>{0.314208627f, 0.413198024f},
-std::array<float,2>{0.587593734f, 0.621067941f},
-std::array<float,2>{0.470363498f, 0.722070932f},
-std::array<float,2>{0.661396384f, 0.357285827f},
-std::array<float,2>{0.147762313f, 0.0836980268f},
-std::array<float,2>{0.773498595f, 0.805951715f},
-std::array<float,2>{0.263661385f, 0.844254434f},
-std::array<float,2>{0.50289911f, 0.0304422714f},
-std::array<float,2>{0.0692371652f, 0.270169735f},
-std::array<float,2>{0.918375134f, 0.626375377f},
-std::array<float,2>{0.24618122f, 0.54905206f},
-std::array<float,2>{0.867183089f, 0.478026122f},
-std::array<float,2>{0.376266241f, 0.236517161f},
-std::array<float,2>{0.732092857f, 0.974187076f},
-std::array<float,2>{0.138633981f, 0.978636503f},
-std::array<float,2>{0.755609214f, 0.24924399f},
-std::array<float,2>{0.499062866f, 0.473107725f},
-std::array<float,2>{0.677974045f, 0.559848607f},
-std::array<float,2>{0.343613505f, 0.638003945f},
-std::array<float,2>{0.570649147f, 0.274920732f},
-std::array<float,2>{0.00899899937f, 0.016151458f},
-std::array<float,2>{0.938591361f, 0.854368329f},
-std::array<float,2>{0.4033328f, 0.799258709f},
-std::array<float,2>{0.738071263f, 0.0933513492f},
-std::array<float,2>{0.221184462f, 0.346195012f},
-std::array<float,2>{0.857336879f, 0.727475584f},
-std::array<float,2>{0.0914205462f, 0.614578187f},
-std::array<float,2>{0.936836958f, 0.415050179f},
-std::array<float,2>{0.276561677f, 0.148626015f},
-std::array<float,2>{0.5234676f, 0.91041249f},
-std::array<float,2>{0.044947844f, 0.841350794f},
-std::array<float,2>{0.983646154f, 0.0525365733f},
-std::array<float,2>{0.370574504f, 0.297917604f},
-std::array<float,2>{0.61342293f, 0.659600735f},
-std::array<float,2>{0.451982558f, 0.526176929f},
-std::array<float,2>{0.6278162f, 0.449044794f},
-std::array<float,2>{0.17868942f, 0.197353229f},
-std::array<float,2>{0.806923866f, 0.960511565f},
-std::array<float,2>{0.293975502f, 0.879055798f},
-std::array<float,2>{0.56052345f, 0.186759323f},
-std::array<float,2>{0.119912073f, 0.376145422f},
-std::array<float,2>{0.889015973f, 0.571796834f},
-std::array<float,2>{0.196902558f, 0.716409743f},
-std::array<float,2>{0.814968109f, 0.327109486f},
-std::array<float,2>{0.414065838f, 0.105638042f},
-std::array<float,2>{0.718646586f, 0.752047539f},
-std::array<float,2>{0.244944841f, 0.771098733f},
-std::array<float,2>{0.860474169f, 0.114361539f},
-std::array<float,2>{0.381139904f, 0.332899332f},
-std::array<float,2>{0.726905167f, 0.700092316f},
-std::array<float,2>{0.260886937f, 0.589515269f},
-std::array<float,2>{0.507399499f, 0.406095654f},
-std::array<float,2>{0.0656459406f, 0.158092275f},
-std::array<float,2>{0.914387345f, 0.895620525f},
-std::array<float,2>{0.475883573f, 0.943918169f},
-std::array<float,2>{0.658714652f, 0.213007182f},
-std::array<float,2>{0.141395614f, 0.456441432f},
-std::array<float,2>{0.780913711f, 0.511220157f},
-std::array<float,2>{0.0292292684f, 0.673438609f},
-std::array<float,2>{0.961211085f, 0.292345017f},
-std::array<float,2>{0.317224652f, 0.0381507911f},
-std::array<float,2>{0.590704262f, 0.823935807f},
-std::array<float,2>{0.0978548154f, 0.935223699f},
-std::array<float,2>{0.905806065f, 0.136970773f},
-std::array<float,2>{0.298629075f, 0.431955963f},
-std::array<float,2>{0.536397815f, 0.601270437f},
-std::array<float,2>{0.424688488f, 0.734679163f},
-std::array<float,2>{0.694208145f, 0.367146283f},
-std::array<float,2>{0.215686783f, 0.0662495121f},
-std::array<float,2>{0.8365345f, 0.784802377f},
-std::array<float,2>{0.353359312f, 0.870011628f},
-std::array<float,2>{0.604366362f, 0.00750629045f},
-std::array<float,2>{0.056235332f, 0.265547216f},
-std::array<float,2>{0.991748691f, 0.645321012f},
-std::array<float,2>{0.167417869f, 0.531862736f},
-std::array<float,2>{0.790495992f, 0.492074728f},
-std::array<float,2>{0.461950749f, 0.224769339f},
-std::array<float,2>{0.641080678f, 0.991591394f},
-std::array<float,2>{0.207664326f, 0.905053675f},
-std::array<float,2>{0.83291477f, 0.16463089f},
-std::array<float,2>{0.430162072f, 0.393160671f},
-std::array<float,2>{0.700805306f, 0.582071543f},
-std::array<float,2>{0.310254335f, 0.692736387f},
-std::array<float,2>{0.54676348f, 0.338037521f},
-std::array<float,2>{0.104760237f, 0.120888084f},
-std::array<float,2>{0.893549502f, 0.779972494f},
-std::array<float,2>{0.455498725f, 0.817632079f},
-std::array<float,2>{0.651554227f, 0.0419096425f},
-std::array<float,2>{0.15991132f, 0.282179534f},
-std::array<float,2>{0.788014352f, 0.681227028f},
-std::array<float,2>{0.0514150523f, 0.506591976f},
-std::array<float,2>{0.993130505f, 0.463319123f},
-std::array<float,2>{0.346951723f, 0.206543893f},
-std::array<float,2>{0.597630084f, 0.945669532f},
-std::array<float,2>{0.0780551583f, 0.794096887f},
-std::array<float,2>{0.907503068f, 0.0761623532f},
-std::array<float,2>{0.251289099f, 0.368882388f},
-std::array<float,2>{0.508574605f, 0.74405092f},
-std::array<float,2>{0.383423805f, 0.606211722f},
-std::array<float,2>{0.726547182f, 0.424215913f},
-std::array<float,2>{0.235244006f, 0.13037838f},
-std::array<float,2>{0.867466807f, 0.922417581f},
-std::array<float,2>{0.321790218f, 0.993135035f},
-std::array<float,2>{0.585803032f, 0.227142498f},
-std::array<float,2>{0.0196355358f, 0.498847872f},
-std::array<float,2>{0.953679204f, 0.543946326f},
-std::array<float,2>{0.154240191f, 0.653534114f},
-std::array<float,2>{0.770478189f, 0.252446055f},
-std::array<float,2>{0.477331698f, 0.0101034539f},
-std::array<float,2>{0.666442692f, 0.862676799f},
-std::array<float,2>{0.18525584f, 0.850002766f},
-std::array<float,2>{0.79740262f, 0.0267159529f},
-std::array<float,2>{0.44180125f, 0.268178701f},
-std::array<float,2>{0.633066773f, 0.630014479f},
-std::array<float,2>{0.36426267f, 0.551295161f},
-std::array<float,2>{0.620407701f, 0.483402252f},
-std::array<float,2>{0.0368627347f, 0.241207406f},
-std::array<float,2>{0.970824718f, 0.971883714f},
-std::array<float,2>{0.410474956f, 0.921122849f},
-std::array<float,2>{0.705599189f, 0.148006395f},
-std::array<float,2>{0.188785866f, 0.4083125f},
-std::array<float,2>{0.824491739f, 0.621171117f},
-std::array<float,2>{0.114119627f, 0.724325836f},
-std::array<float,2>{0.881649911f, 0.354025215f},
-std::array<float,2>{0.289007276f, 0.0804640874f},
-std::array<float,2>{0.54976815f, 0.808603287f},
-std::array<float,2>{0.00738135865f, 0.963114619f},
-std::array<float,2>{0.946472406f, 0.188729569f},
-std::array<float,2>{0.334525079f, 0.444121659f},
-std::array<float,2>{0.563510716f, 0.518224657f},
-std::array<float,2>{0.487908036f, 0.671785414f},
-std::array<float,2>{0.686228037f, 0.308736354f},
-std::array<float,2>{0.131134093f, 0.0566806458f},
-std::array<float,2>{0.758173943f, 0.832633257f},
-std::array<float,2>{0.268523186f, 0.75951457f},
-std::array<float,2>{0.51777631f, 0.100774892f},
-std::array<float,2>{0.083894603f, 0.318518847f},
-std::array<float,2>{0.926575065f, 0.703626573f},
-std::array<float,2>{0.227918237f, 0.564503431f},
-std::array<float,2>{0.843975186f, 0.388920903f},
-std::array<float,2>{0.397014737f, 0.174557149f},
-std::array<float,2>{0.748442948f, 0.889329135f},
-std::array<float,2>{0.162770942f, 0.906642735f},
-std::array<float,2>{0.784195662f, 0.153673142f},
-std::array<float,2>{0.457110822f, 0.418902397f},
-std::array<float,2>{0.653040648f, 0.609692454f},
-std::array<float,2>{0.349700361f, 0.732333362f},
-std::array<float,2>{0.600558579f, 0.351541907f},
-std::array<float,2>{0.0477969684f, 0.0867544487f},
-std::array<float,2>{0.998021841f, 0.80129528f},
-std::array<float,2>{0.437024295f, 0.856080294f},
-std::array<float,2>{0.696853936f, 0.0219723061f},
-std::array<float,2>{0.206345245f, 0.279510856f},
-std::array<float,2>{0.831675112f, 0.634803593f},
-std::array<float,2>{0.107240722f, 0.557411075f},
-std::array<float,2>{0.896210968f, 0.470134228f},
-std::array<float,2>{0.306233466f, 0.245269269f},
-std::array<float,2>{0.54167515f, 0.983384967f},
-std::array<float,2>{0.0163539071f, 0.755395174f},
-std::array<float,2>{0.960668027f, 0.10182935f},
-std::array<float,2>{0.325676143f, 0.322000295f},
-std::array<float,2>{0.579110265f, 0.711045206f},
-std::array<float,2>{0.480501145f, 0.576682925f},
-std::array<float,2>{0.668437064f, 0.379069388f},
-std::array<float,2>{0.151601419f, 0.181682348f},
-std::array<float,2>{0.767706275f, 0.878734887f},
-std::array<float,2>{0.257461071f, 0.95319581f},
-std::array<float,2>{0.514599264f, 0.202597558f},
-std::array<float,2>{0.0722012445f, 0.452967197f},
-std::array<float,2>{0.912034273f, 0.529532373f},
-std::array<float,2>{0.24085398f, 0.663151383f},
-std::array<float,2>{0.872860074f, 0.302289903f},
-std::array<float,2>{0.390270233f, 0.0492114685f},
-std::array<float,2>{0.720591307f, 0.836568952f},
-std::array<float,2>{0.194901794f, 0.824271441f},
-std::array<float,2>{0.822962701f, 0.0337399431f},
-std::array<float,2>{0.40859589f, 0.29500705f},
-std::array<float,2>{0.708430648f, 0.678035975f},
-std::array<float,2>{0.282971114f, 0.515150607f},
-std::array<float,2>{0.551632345f, 0.460047841f},
-std::array<float,2>{0.110516891f, 0.216113567f},
-std::array<float,2>{0.877084255f, 0.940772176f},
-std::array<float,2>{0.439746827f, 0.890936792f},
-std::array<float,2>{0.639637589f, 0.162146211f},
-std::array<float,2>{0.181845844f, 0.40034309f},
-std::array<float,2>{0.801562428f, 0.593247712f},
-std::array<float,2>{0.0339150727f, 0.695836961f},
-std::array<float,2>{0.975738585f, 0.330521643f},
-std::array<float,2>{0.362675995f, 0.109775439f},
-std::array<float,2>{0.624723017f, 0.765777767f},
-std::array<float,2>{0.0814990625f, 0.985527933f},
-std::array<float,2>{0.924453557f, 0.220408648f},
-std::array<float,2>{0.270032525f, 0.487594604f},
-std::array<float,2>{0.519659042f, 0.538520515f},
-std::array<float,2>{0.392535061f, 0.643720269f},
-std::array<float,2>{0.745153904f, 0.258428246f},
-std::array<float,2>{0.233280003f, 0.00101679645f},
-std::array<float,2>{0.848940134f, 0.87363553f},
-std::array<float,2>{0.331286371f, 0.786911368f},
-std::array<float,2>{0.570015132f, 0.0698253363f},
-std::array<float,2>{0.00287519605f, 0.360294431f},
-std::array<float,2>{0.950135291f, 0.741219163f},
-std::array<float,2>{0.127798542f, 0.596376777f},
-std::array<float,2>{0.761806488f, 0.43707034f},
-std::array<float,2>{0.489293098f, 0.133449167f},
-std::array<float,2>{0.681794167f, 0.931821525f},
-std::array<float,2>{0.225676045f, 0.949864507f},
-std::array<float,2>{0.853759587f, 0.210784003f},
-std::array<float,2>{0.400899231f, 0.468706667f},
-std::array<float,2>{0.739012539f, 0.503249407f},
-std::array<float,2>{0.279157609f, 0.684433699f},
-std::array<float,2>{0.528552532f, 0.288623601f},
-std::array<float,2>{0.0887809917f, 0.0444142744f},
-std::array<float,2>{0.930824578f, 0.814802051f},
-std::array<float,2>{0.493309051f, 0.776846588f},
-std::array<float,2>{0.673127353f, 0.124735959f},
-std::array<float,2>{0.132970601f, 0.343125075f},
-std::array<float,2>{0.751418948f, 0.690527976f},
-std::array<float,2>{0.0151413362f, 0.580595016f},
-std::array<float,2>{0.944298923f, 0.396160752f},
-std::array<float,2>{0.337293744f, 0.170392305f},
-std::array<float,2>{0.577680171f, 0.899970114f},
-std::array<float,2>{0.122937627f, 0.864387572f},
-std::array<float,2>{0.88388449f, 0.0154819321f},
-std::array<float,2>{0.292028248f, 0.256025732f},
-std::array<float,2>{0.556223989f, 0.650062799f},
-std::array<float,2>{0.421528429f, 0.542117596f},
-std::array<float,2>{0.711208463f, 0.495081306f},
-std::array<float,2>{0.200309798f, 0.234258384f},
-std::array<float,2>{0.8171826f, 0.996375978f},
-std::array<float,2>{0.374450862f, 0.929659784f},
-std::array<float,2>{0.609660983f, 0.125873223f},
-std::array<float,2>{0.0419278778f, 0.428415269f},
-std::array<float,2>{0.97977519f, 0.602392256f},
-std::array<float,2>{0.17242378f, 0.747210503f},
-std::array<float,2>{0.809446931f, 0.372975349f},
-std::array<float,2>{0.447312176f, 0.0730800852f},
-std::array<float,2>{0.630915284f, 0.789065957f},
-std::array<float,2>{0.144964397f, 0.807591617f},
-std::array<float,2>{0.775414407f, 0.0844997838f},
-std::array<float,2>{0.471756279f, 0.358621538f},
-std::array<float,2>{0.662491322f, 0.719533086f},
-std::array<float,2>{0.316258639f, 0.61728245f},
-std::array<float,2>{0.588576615f, 0.41065529f},
-std::array<float,2>{0.0258972161f, 0.143240824f},
-std::array<float,2>{0.96835053f, 0.916655898f},
-std::array<float,2>{0.378710836f, 0.974786401f},
-std::array<float,2>{0.73306179f, 0.235725641f},
-std::array<float,2>{0.249513954f, 0.478660077f},
-std::array<float,2>{0.865047872f, 0.547915578f},
-std::array<float,2>{0.0683232993f, 0.628867388f},
-std::array<float,2>{0.920491397f, 0.27191782f},
-std::array<float,2>{0.263742417f, 0.0277257692f},
-std::array<float,2>{0.500489473f, 0.846571147f},
-std::array<float,2>{0.0590683147f, 0.884421945f},
-std::array<float,2>{0.984531224f, 0.17833142f},
-std::array<float,2>{0.356536657f, 0.385713965f},
-std::array<float,2>{0.605991542f, 0.567389965f},
-std::array<float,2>{0.465497196f, 0.710445166f},
-std::array<float,2>{0.645560086f, 0.312837124f},
-std::array<float,2>{0.170227498f, 0.095565252f},
-std::array<float,2>{0.795068741f, 0.762470782f},
-std::array<float,2>{0.301578104f, 0.828358948f},
-std::array<float,2>{0.532990634f, 0.0591068305f},
-std::array<float,2>{0.0969229043f, 0.308210701f},
-std::array<float,2>{0.900736988f, 0.665847182f},
-std::array<float,2>{0.212697625f, 0.520110607f},
-std::array<float,2>{0.843165219f, 0.439019799f},
-std::array<float,2>{0.427896291f, 0.194560707f},
-std::array<float,2>{0.688717484f, 0.965082824f},
-std::array<float,2>{0.141682655f, 0.943237245f},
-std::array<float,2>{0.779664516f, 0.210997194f},
-std::array<float,2>{0.475489169f, 0.453534991f},
-std::array<float,2>{0.659857154f, 0.509196699f},
-std::array<float,2>{0.317815393f, 0.675223351f},
-std::array<float,2>{0.591488302f, 0.290912211f},
-std::array<float,2>{0.0277630053f, 0.0368257686f},
-std::array<float,2>{0.962312877f, 0.820830047f},
-std::array<float,2>{0.382262677f, 0.771659315f},
-std::array<float,2>{0.727901816f, 0.115615502f},
-std::array<float,2>{0.245393008f, 0.335460961f},
-std::array<float,2>{0.86024332f, 0.702475131f},
-std::array<float,2>{0.0649651587f, 0.586586833f},
-std::array<float,2>{0.915520549f, 0.40358597f},
-std::array<float,2>{0.260293037f, 0.158404216f},
-std::array<float,2>{0.506223917f, 0.897377491f},
-std::array<float,2>{0.0548943989f, 0.869100809f},
-std::array<float,2>{0.990446508f, 0.00400174968f},
-std::array<float,2>{0.352369577f, 0.262439907f},
-std::array<float,2>{0.604823887f, 0.646900594f},
-std::array<float,2>{0.461771071f, 0.533801317f},
-std::array<float,2>{0.642180502f, 0.488912642f},
-std::array<float,2>{0.16672796f, 0.223143518f},
-std::array<float,2>{0.789111614f, 0.989432752f},
-std::array<float,2>{0.297166944f, 0.936832786f},
-std::array<float,2>{0.535963297f, 0.14057909f},
-std::array<float,2>{0.0994285941f, 0.430121541f},
-std::array<float,2>{0.904315412f, 0.597898126f},
-std::array<float,2>{0.216156662f, 0.73642391f},
-std::array<float,2>{0.837457001f, 0.364658296f},
-std::array<float,2>{0.424804896f, 0.0633853823f},
-std::array<float,2>{0.694943428f, 0.782522857f},
-std::array<float,2>{0.221775815f, 0.798260868f},
-std::array<float,2>{0.85600692f, 0.089972578f},
-std::array<float,2>{0.40271166f, 0.344622135f},
-std::array<float,2>{0.737080693f, 0.730434835f},
-std::array<float,2>{0.275744319f, 0.616288185f},
-std::array<float,2>{0.524537563f, 0.416984677f},
-std::array<float,2>{0.0906413943f, 0.151111975f},
-std::array<float,2>{0.936473489f, 0.913165987f},
-std::array<float,2>{0.498570681f, 0.977955043f},
-std::array<float,2>{0.679253221f, 0.247538909f},
-std::array<float,2>{0.13677977f, 0.476529062f},
-std::array<float,2>{0.754604399f, 0.560720623f},
-std::array<float,2>{0.00800839718f, 0.639198244f},
-std::array<float,2>{0.938123226f, 0.275911272f},
-std::array<float,2>{0.341811895f, 0.0193368252f},
-std::array<float,2>{0.572095752f, 0.851863682f},
-std::array<float,2>{0.120329797f, 0.882424772f},
-std::array<float,2>{0.890109658f, 0.183718696f},
-std::array<float,2>{0.293227106f, 0.378472269f},
-std::array<float,2>{0.559057653f, 0.57287848f},
-std::array<float,2>{0.415439069f, 0.718659103f},
-std::array<float,2>{0.717491925f, 0.325523645f},
-std::array<float,2>{0.195712283f, 0.108128354f},
-std::array<float,2>{0.816045582f, 0.751370072f},
-std::array<float,2>{0.36954689f, 0.842460394f},
-std::array<float,2>{0.615004241f, 0.0541613214f},
-std::array<float,2>{0.0459484681f, 0.300480902f},
-std::array<float,2>{0.983299792f, 0.656485379f},
-std::array<float,2>{0.179080606f, 0.52390492f},
-std::array<float,2>{0.808288395f, 0.445824862f},
-std::array<float,2>{0.452321738f, 0.19703576f},
-std::array<float,2>{0.628207266f, 0.95878166f},
-std::array<float,2>{0.188240319f, 0.91871053f},
-std::array<float,2>{0.825924337f, 0.145077318f},
-std::array<float,2>{0.411537766f, 0.407422841f},
-std::array<float,2>{0.706254005f, 0.62365073f},
-std::array<float,2>{0.287680954f, 0.725959539f},
-std::array<float,2>{0.550062537f, 0.353496939f},
-std::array<float,2>{0.115144953f, 0.0798015147f},
-std::array<float,2>{0.882085621f, 0.810672343f},
-std::array<float,2>{0.442398041f, 0.848939955f},
-std::array<float,2>{0.633913219f, 0.0237351023f},
-std::array<float,2>{0.184246853f, 0.266605467f},
-std::array<float,2>{0.798496068f, 0.632434547f},
-std::array<float,2>{0.0360317193f, 0.554116189f},
-std::array<float,2>{0.97184217f, 0.482294172f},
-std::array<float,2>{0.364080369f, 0.238777339f},
-std::array<float,2>{0.619599462f, 0.969044209f},
-std::array<float,2>{0.0823187828f, 0.760712206f},
-std::array<float,2>{0.927438915f, 0.0978583992f},
-std::array<float,2>{0.268954158f, 0.317505926f},
-std::array<float,2>{0.518889844f, 0.706490636f},
-std::array<float,2>{0.398179501f, 0.563216507f},
-std::array<float,2>{0.749529362f, 0.38856554f},
-std::array<float,2>{0.227131784f, 0.17244567f},
-std::array<float,2>{0.845659912f, 0.886963308f},
-std::array<float,2>{0.335291356f, 0.961286664f},
-std::array<float,2>{0.562728941f, 0.191308022f},
-std::array<float,2>{0.00614197366f, 0.443084568f},
-std::array<float,2>{0.945459664f, 0.515627265f},
-std::array<float,2>{0.132404655f, 0.669903815f},
-std::array<float,2>{0.75959003f, 0.312182814f},
-std::array<float,2>{0.487064898f, 0.0563637093f},
-std::array<float,2>{0.687264979f, 0.83492887f},
-std::array<float,2>{0.158387721f, 0.819779217f},
-std::array<float,2>{0.789004624f, 0.0409978144f},
-std::array<float,2>{0.456438839f, 0.283840567f},
-std::array<float,2>{0.65046078f, 0.682792306f},
-std::array<float,2>{0.346516579f, 0.504326224f},
-std::array<float,2>{0.596022606f, 0.461714953f},
-std::array<float,2>{0.0527107418f, 0.203890041f},
-std::array<float,2>{0.993650734f, 0.948652983f},
-std::array<float,2>{0.431203961f, 0.903661966f},
-std::array<float,2>{0.699332416f, 0.167302817f},
-std::array<float,2>{0.208548531f, 0.391539752f},
-std::array<float,2>{0.833630383f, 0.585742712f},
-std::array<float,2>{0.103667296f, 0.694429755f},
-std::array<float,2>{0.894164205f, 0.336750865f},
-std::array<float,2>{0.309066355f, 0.117244221f},
-std::array<float,2>{0.545588076f, 0.777673721f},
-std::array<float,2>{0.0210679378f, 0.994334936f},
-std::array<float,2>{0.954707205f, 0.230338991f},
-std::array<float,2>{0.321062475f, 0.497684389f},
-std::array<float,2>{0.58433181f, 0.544995666f},
-std::array<float,2>{0.478137672f, 0.656087816f},
-std::array<float,2>{0.66788888f, 0.250689179f},
-std::array<float,2>{0.153141975f, 0.00972328987f},
-std::array<float,2>{0.771136701f, 0.860049546f},
-std::array<float,2>{0.250800878f, 0.795621634f},
-std::array<float,2>{0.509376466f, 0.0762006268f},
-std::array<float,2>{0.0764621198f, 0.369680792f},
-std::array<float,2>{0.906949759f, 0.744895756f},
-std::array<float,2>{0.235524327f, 0.608648896f},
-std::array<float,2>{0.868524909f, 0.421883732f},
-std::array<float,2>{0.383839041f, 0.132497802f},
-std::array<float,2>{0.724618495f, 0.924131989f},
-std::array<float,2>{0.183167443f, 0.893749833f},
-std::array<float,2>{0.802497506f, 0.161349684f},
-std::array<float,2>{0.441188663f, 0.400634527f},
-std::array<float,2>{0.640111864f, 0.591460407f},
-std::array<float,2>{0.362157673f, 0.698312938f},
-std::array<float,2>{0.623807132f, 0.329261631f},
-std::array<float,2>{0.034978833f, 0.111998357f},
-std::array<float,2>{0.975403488f, 0.768411994f},
-std::array<float,2>{0.409265488f, 0.827251375f},
-std::array<float,2>{0.70707041f, 0.0324919187f},
-std::array<float,2>{0.193990111f, 0.293153256f},
-std::array<float,2>{0.823347092f, 0.677732766f},
-std::array<float,2>{0.110164657f, 0.513500273f},
-std::array<float,2>{0.878364563f, 0.458410442f},
-std::array<float,2>{0.281412721f, 0.21870096f},
-std::array<float,2>{0.552249074f, 0.939204693f},
-std::array<float,2>{0.00313918013f, 0.788027465f},
-std::array<float,2>{0.950410903f, 0.0683035925f},
-std::array<float,2>{0.330759734f, 0.362688869f},
-std::array<float,2>{0.568707466f, 0.739037216f},
-std::array<float,2>{0.488546997f, 0.594030678f},
-std::array<float,2>{0.683377326f, 0.435235977f},
-std::array<float,2>{0.128554061f, 0.134879485f},
-std::array<float,2>{0.762701333f, 0.930675387f},
-std::array<float,2>{0.271313488f, 0.987659097f},
-std::array<float,2>{0.52144289f, 0.221104324f},
-std::array<float,2>{0.0804491118f, 0.485063165f},
-std::array<float,2>{0.92544806f, 0.536936462f},
-std::array<float,2>{0.233534083f, 0.641982198f},
-std::array<float,2>{0.848031521f, 0.260730207f},
-std::array<float,2>{0.39150539f, 0.00333340024f},
-std::array<float,2>{0.744550288f, 0.871128321f},
-std::array<float,2>{0.205089495f, 0.859060407f},
-std::array<float,2>{0.83091563f, 0.0203623436f},
-std::array<float,2>{0.435620397f, 0.27806142f},
-std::array<float,2>{0.696113288f, 0.634246111f},
-std::array<float,2>{0.304971367f, 0.556636095f},
-std::array<float,2>{0.542274296f, 0.472375929f},
-std::array<float,2>{0.106423751f, 0.243645221f},
-std::array<float,2>{0.895448923f, 0.980567336f},
-std::array<float,2>{0.458026797f, 0.909279227f},
-std::array<float,2>{0.653685451f, 0.15545921f},
-std::array<float,2>{0.163978204f, 0.420380086f},
-std::array<float,2>{0.783891678f, 0.613174975f},
-std::array<float,2>{0.048797559f, 0.734258413f},
-std::array<float,2>{0.996579051f, 0.349285305f},
-std::array<float,2>{0.351152033f, 0.0897061378f},
-std::array<float,2>{0.600605369f, 0.802863419f},
-std::array<float,2>{0.071007818f, 0.956827402f},
-std::array<float,2>{0.91046679f, 0.200683549f},
-std::array<float,2>{0.256529003f, 0.450735211f},
-std::array<float,2>{0.514782012f, 0.527586997f},
-std::array<float,2>{0.388966054f, 0.661873043f},
-std::array<float,2>{0.719591677f, 0.303511173f},
-std::array<float,2>{0.241706759f, 0.0482961386f},
-std::array<float,2>{0.871865153f, 0.838188887f},
-std::array<float,2>{0.324241579f, 0.756308794f},
-std::array<float,2>{0.578966618f, 0.105135597f},
-std::array<float,2>{0.0169228278f, 0.322500914f},
-std::array<float,2>{0.959188223f, 0.713913858f},
-std::array<float,2>{0.150537938f, 0.575843155f},
-std::array<float,2>{0.769072533f, 0.38196373f},
-std::array<float,2>{0.481553018f, 0.181139246f},
-std::array<float,2>{0.669178367f, 0.875807405f},
-std::array<float,2>{0.248115703f, 0.973460793f},
-std::array<float,2>{0.863856435f, 0.237645611f},
-std::array<float,2>{0.377028137f, 0.47685802f},
-std::array<float,2>{0.73388952f, 0.549848139f},
-std::array<float,2>{0.265065253f, 0.625587046f},
-std::array<float,2>{0.501311958f, 0.270840496f},
-std::array<float,2>{0.066798605f, 0.0297857821f},
-std::array<float,2>{0.921256661f, 0.845517099f},
-std::array<float,2>{0.470803142f, 0.805537045f},
-std::array<float,2>{0.663736224f, 0.0822685733f},
-std::array<float,2>{0.145998955f, 0.356155097f},
-std::array<float,2>{0.777272999f, 0.720811665f},
-std::array<float,2>{0.0273222495f, 0.61995697f},
-std::array<float,2>{0.967721701f, 0.41256991f},
-std::array<float,2>{0.315421283f, 0.142373294f},
-std::array<float,2>{0.589072466f, 0.914269269f},
-std::array<float,2>{0.0961616337f, 0.830335736f},
-std::array<float,2>{0.901655316f, 0.0610453859f},
-std::array<float,2>{0.3018457f, 0.305650979f},
-std::array<float,2>{0.532167017f, 0.666168094f},
-std::array<float,2>{0.42901057f, 0.52211082f},
-std::array<float,2>{0.687650383f, 0.439891607f},
-std::array<float,2>{0.211091071f, 0.191641107f},
-std::array<float,2>{0.842251062f, 0.967080355f},
-std::array<float,2>{0.355864197f, 0.885922909f},
-std::array<float,2>{0.606558979f, 0.177468717f},
-std::array<float,2>{0.0595931225f, 0.383964628f},
-std::array<float,2>{0.985626221f, 0.569365859f},
-std::array<float,2>{0.171734214f, 0.707453489f},
-std::array<float,2>{0.796569824f, 0.315144449f},
-std::array<float,2>{0.466345608f, 0.0957943872f},
-std::array<float,2>{0.645344377f, 0.765221179f},
-std::array<float,2>{0.133902565f, 0.773963928f},
-std::array<float,2>{0.750923038f, 0.12191271f},
-std::array<float,2>{0.492443919f, 0.33995083f},
-std::array<float,2>{0.67269522f, 0.688091159f},
-std::array<float,2>{0.336141646f, 0.578965545f},
-std::array<float,2>{0.57671839f, 0.398198694f},
-std::array<float,2>{0.0139451232f, 0.16948843f},
-std::array<float,2>{0.944954157f, 0.900521696f},
-std::array<float,2>{0.40161407f, 0.952043533f},
-std::array<float,2>{0.739733398f, 0.208407551f},
-std::array<float,2>{0.225394398f, 0.4652116f},
-std::array<float,2>{0.854673505f, 0.500836849f},
-std::array<float,2>{0.0890810788f, 0.686821163f},
-std::array<float,2>{0.929888546f, 0.286409825f},
-std::array<float,2>{0.277864665f, 0.0461462811f},
-std::array<float,2>{0.527352452f, 0.813023806f},
-std::array<float,2>{0.0421936624f, 0.926541209f},
-std::array<float,2>{0.97852391f, 0.1274454f},
-std::array<float,2>{0.373426676f, 0.427185744f},
-std::array<float,2>{0.611269951f, 0.604116261f},
-std::array<float,2>{0.44911617f, 0.749546409f},
-std::array<float,2>{0.631865323f, 0.373505741f},
-std::array<float,2>{0.173556536f, 0.0711635575f},
-std::array<float,2>{0.81004262f, 0.792153716f},
-std::array<float,2>{0.291380882f, 0.865727723f},
-std::array<float,2>{0.554814219f, 0.0118085416f},
-std::array<float,2>{0.121356793f, 0.254500538f},
-std::array<float,2>{0.883217633f, 0.65200609f},
-std::array<float,2>{0.199228272f, 0.540486455f},
-std::array<float,2>{0.817900717f, 0.492410421f},
-std::array<float,2>{0.420445144f, 0.232025653f},
-std::array<float,2>{0.712013066f, 0.999011636f},
-std::array<float,2>{0.165886834f, 0.990891159f},
-std::array<float,2>{0.791122556f, 0.226285398f},
-std::array<float,2>{0.463336527f, 0.490430653f},
-std::array<float,2>{0.643359363f, 0.532848597f},
-std::array<float,2>{0.353683382f, 0.645637631f},
-std::array<float,2>{0.602647483f, 0.264512956f},
-std::array<float,2>{0.0568768121f, 0.00616310071f},
-std::array<float,2>{0.990181208f, 0.870841801f},
-std::array<float,2>{0.422330499f, 0.783553004f},
-std::array<float,2>{0.691964984f, 0.0645170212f},
-std::array<float,2>{0.218087405f, 0.36565271f},
-std::array<float,2>{0.837967038f, 0.735787868f},
-std::array<float,2>{0.101001985f, 0.600549281f},
-std::array<float,2>{0.903568268f, 0.433177561f},
-std::array<float,2>{0.299327463f, 0.138393819f},
-std::array<float,2>{0.538037181f, 0.934467137f},
-std::array<float,2>{0.0310519114f, 0.82278192f},
-std::array<float,2>{0.964385986f, 0.0374293178f},
-std::array<float,2>{0.320230871f, 0.291566283f},
-std::array<float,2>{0.592466533f, 0.672295332f},
-std::array<float,2>{0.473001957f, 0.510325253f},
-std::array<float,2>{0.657660067f, 0.45584324f},
-std::array<float,2>{0.1439282f, 0.213972792f},
-std::array<float,2>{0.777864397f, 0.944768548f},
-std::array<float,2>{0.259667099f, 0.895104945f},
-std::array<float,2>{0.504640341f, 0.156898528f},
-std::array<float,2>{0.063155055f, 0.404499918f},
-std::array<float,2>{0.91607815f, 0.588677227f},
-std::array<float,2>{0.244020954f, 0.700566769f},
-std::array<float,2>{0.862660527f, 0.333073944f},
-std::array<float,2>{0.379788339f, 0.113669947f},
-std::array<float,2>{0.729391754f, 0.770010233f},
-std::array<float,2>{0.198145717f, 0.753475666f},
-std::array<float,2>{0.813913703f, 0.107057549f},
-std::array<float,2>{0.417181462f, 0.327720135f},
-std::array<float,2>{0.716245472f, 0.715502918f},
-std::array<float,2>{0.296562195f, 0.570848405f},
-std::array<float,2>{0.5608657f, 0.375186592f},
-std::array<float,2>{0.117298543f, 0.186134741f},
-std::array<float,2>{0.887030959f, 0.880377471f},
-std::array<float,2>{0.451090902f, 0.959399223f},
-std::array<float,2>{0.625436962f, 0.199186265f},
-std::array<float,2>{0.177288949f, 0.447733164f},
-std::array<float,2>{0.805452526f, 0.527283847f},
-std::array<float,2>{0.0444690436f, 0.658891618f},
-std::array<float,2>{0.980582893f, 0.297450602f},
-std::array<float,2>{0.368642598f, 0.0509028137f},
-std::array<float,2>{0.617172956f, 0.840118051f},
-std::array<float,2>{0.0934607163f, 0.912001014f},
-std::array<float,2>{0.935281634f, 0.150328368f},
-std::array<float,2>{0.273544997f, 0.414535463f},
-std::array<float,2>{0.526563764f, 0.613368869f},
-std::array<float,2>{0.404841483f, 0.728166223f},
-std::array<float,2>{0.736092746f, 0.346843541f},
-std::array<float,2>{0.220362455f, 0.0924822465f},
-std::array<float,2>{0.858473182f, 0.800271988f},
-std::array<float,2>{0.340644032f, 0.85454607f},
-std::array<float,2>{0.572558522f, 0.0175685044f},
-std::array<float,2>{0.0103452802f, 0.274067223f},
-std::array<float,2>{0.939699233f, 0.637433231f},
-std::array<float,2>{0.13894099f, 0.558953226f},
-std::array<float,2>{0.756945133f, 0.473779231f},
-std::array<float,2>{0.496736676f, 0.248694271f},
-std::array<float,2>{0.677374542f, 0.98001492f},
-std::array<float,2>{0.230302051f, 0.88978076f},
-std::array<float,2>{0.847603202f, 0.17509903f},
-std::array<float,2>{0.394807637f, 0.389701933f},
-std::array<float,2>{0.747305751f, 0.566000342f},
-std::array<float,2>{0.266927779f, 0.705035388f},
-std::array<float,2>{0.517146468f, 0.319407165f},
-std::array<float,2>{0.0852320492f, 0.100046583f},
-std::array<float,2>{0.928382337f, 0.758692324f},
-std::array<float,2>{0.485005021f, 0.833629727f},
-std::array<float,2>{0.685230196f, 0.057889834f},
-std::array<float,2>{0.130377486f, 0.310478508f},
-std::array<float,2>{0.760746479f, 0.670782626f},
-std::array<float,2>{0.00483262446f, 0.518744349f},
-std::array<float,2>{0.949077368f, 0.444622159f},
-std::array<float,2>{0.332286149f, 0.188438997f},
-std::array<float,2>{0.565330267f, 0.964136064f},
-std::array<float,2>{0.11630401f, 0.809784591f},
-std::array<float,2>{0.880323589f, 0.0811722502f},
-std::array<float,2>{0.285816371f, 0.355043232f},
-std::array<float,2>{0.548174858f, 0.722702384f},
-std::array<float,2>{0.412193567f, 0.622658432f},
-std::array<float,2>{0.703571022f, 0.409392595f},
-std::array<float,2>{0.189504713f, 0.14725399f},
-std::array<float,2>{0.826248109f, 0.919993639f},
-std::array<float,2>{0.365998f, 0.970785022f},
-std::array<float,2>{0.617768049f, 0.242086068f},
-std::array<float,2>{0.0390201695f, 0.482924581f},
-std::array<float,2>{0.968839884f, 0.552048028f},
-std::array<float,2>{0.18622455f, 0.62921983f},
-std::array<float,2>{0.799192905f, 0.269396275f},
-std::array<float,2>{0.443660587f, 0.0255188588f},
-std::array<float,2>{0.635536373f, 0.85114038f},
-std::array<float,2>{0.155930489f, 0.861564398f},
-std::array<float,2>{0.772842824f, 0.011416181f},
-std::array<float,2>{0.4801943f, 0.25348717f},
-std::array<float,2>{0.665153444f, 0.65248394f},
-std::array<float,2>{0.32352519f, 0.542970479f},
-std::array<float,2>{0.582496524f, 0.499425948f},
-std::array<float,2>{0.0226512011f, 0.228384003f},
-std::array<float,2>{0.955151498f, 0.993276715f},
-std::array<float,2>{0.385332763f, 0.923362792f},
-std::array<float,2>{0.722928226f, 0.129183829f},
-std::array<float,2>{0.237096518f, 0.425273657f},
-std::array<float,2>{0.870138645f, 0.606818497f},
-std::array<float,2>{0.0745864734f, 0.742425382f},
-std::array<float,2>{0.909057736f, 0.367719054f},
-std::array<float,2>{0.252301633f, 0.0746090636f},
-std::array<float,2>{0.510904551f, 0.79368937f},
-std::array<float,2>{0.0546187609f, 0.94718194f},
-std::array<float,2>{0.995550156f, 0.205484003f},
-std::array<float,2>{0.345052689f, 0.464447618f},
-std::array<float,2>{0.595521986f, 0.506847203f},
-std::array<float,2>{0.454003453f, 0.680087864f},
-std::array<float,2>{0.649100423f, 0.28247577f},
-std::array<float,2>{0.15748772f, 0.0429271981f},
-std::array<float,2>{0.786208928f, 0.816946507f},
-std::array<float,2>{0.310676366f, 0.780409992f},
-std::array<float,2>{0.544892073f, 0.119815007f},
-std::array<float,2>{0.101781309f, 0.339235842f},
-std::array<float,2>{0.89238435f, 0.69170469f},
-std::array<float,2>{0.209486276f, 0.58305335f},
-std::array<float,2>{0.835112631f, 0.394234747f},
-std::array<float,2>{0.433076441f, 0.165348753f},
-std::array<float,2>{0.702164292f, 0.905635297f},
-std::array<float,2>{0.126249582f, 0.933336437f},
-std::array<float,2>{0.764766037f, 0.134609058f},
-std::array<float,2>{0.490604013f, 0.436296046f},
-std::array<float,2>{0.680208564f, 0.596760929f},
-std::array<float,2>{0.330073625f, 0.740310252f},
-std::array<float,2>{0.566571116f, 0.360783726f},
-std::array<float,2>{0.00114943355f, 0.0690167472f},
-std::array<float,2>{0.952839732f, 0.785515964f},
-std::array<float,2>{0.394215733f, 0.874132276f},
-std::array<float,2>{0.742961645f, 0.000411681423f},
-std::array<float,2>{0.23235096f, 0.259182096f},
-std::array<float,2>{0.850643933f, 0.643306255f},
-std::array<float,2>{0.0787219703f, 0.537231326f},
-std::array<float,2>{0.92267108f, 0.486500353f},
-std::array<float,2>{0.272862017f, 0.218912527f},
-std::array<float,2>{0.522325337f, 0.984426022f},
-std::array<float,2>{0.0328125656f, 0.767001092f},
-std::array<float,2>{0.972720087f, 0.111080274f},
-std::array<float,2>{0.359582037f, 0.331509501f},
-std::array<float,2>{0.622093797f, 0.696722269f},
-std::array<float,2>{0.437582821f, 0.592329323f},
-std::array<float,2>{0.637564123f, 0.39919731f},
-std::array<float,2>{0.180782065f, 0.163360313f},
-std::array<float,2>{0.803596795f, 0.892567813f},
-std::array<float,2>{0.284479976f, 0.940228641f},
-std::array<float,2>{0.554674566f, 0.215401769f},
-std::array<float,2>{0.113165513f, 0.459169835f},
-std::array<float,2>{0.875285983f, 0.513885617f},
-std::array<float,2>{0.192931935f, 0.67893064f},
-std::array<float,2>{0.820639253f, 0.296388954f},
-std::array<float,2>{0.406676114f, 0.034494292f},
-std::array<float,2>{0.710757196f, 0.825947642f},
-std::array<float,2>{0.239487424f, 0.837348044f},
-std::array<float,2>{0.87495482f, 0.0502233841f},
-std::array<float,2>{0.388407826f, 0.301122785f},
-std::array<float,2>{0.722268581f, 0.662922621f},
-std::array<float,2>{0.254148573f, 0.530302703f},
-std::array<float,2>{0.513195157f, 0.451450706f},
-std::array<float,2>{0.0725970566f, 0.201313123f},
-std::array<float,2>{0.91216594f, 0.954327047f},
-std::array<float,2>{0.484304309f, 0.877640545f},
-std::array<float,2>{0.671872139f, 0.183445558f},
-std::array<float,2>{0.150005087f, 0.380169868f},
-std::array<float,2>{0.766709685f, 0.577376068f},
-std::array<float,2>{0.0192024652f, 0.712666333f},
-std::array<float,2>{0.958759785f, 0.32058087f},
-std::array<float,2>{0.327156842f, 0.102727547f},
-std::array<float,2>{0.58078593f, 0.754784048f},
-std::array<float,2>{0.108531214f, 0.984232008f},
-std::array<float,2>{0.897132576f, 0.244835332f},
-std::array<float,2>{0.308089495f, 0.469453514f},
-std::array<float,2>{0.540393889f, 0.557654023f},
-std::array<float,2>{0.434619844f, 0.636420071f},
-std::array<float,2>{0.697657466f, 0.281102806f},
-std::array<float,2>{0.20484367f, 0.023012042f},
-std::array<float,2>{0.829861939f, 0.857209206f},
-std::array<float,2>{0.348688126f, 0.801787436f},
-std::array<float,2>{0.598797441f, 0.0877234265f},
-std::array<float,2>{0.0505329072f, 0.349856645f},
-std::array<float,2>{0.999910474f, 0.730668187f},
-std::array<float,2>{0.160284966f, 0.61095041f},
-std::array<float,2>{0.783075154f, 0.4190346f},
-std::array<float,2>{0.460195065f, 0.153309003f},
-std::array<float,2>{0.655212224f, 0.907866776f},
-std::array<float,2>{0.214181796f, 0.966569066f},
-std::array<float,2>{0.840583444f, 0.193878308f},
-std::array<float,2>{0.425897241f, 0.437937558f},
-std::array<float,2>{0.689674377f, 0.52078414f},
-std::array<float,2>{0.303634405f, 0.664118528f},
-std::array<float,2>{0.533523262f, 0.307582438f},
-std::array<float,2>{0.0945228115f, 0.0599457882f},
-std::array<float,2>{0.89994818f, 0.829525292f},
-std::array<float,2>{0.467334926f, 0.762881875f},
-std::array<float,2>{0.647853255f, 0.0942229107f},
-std::array<float,2>{0.168437883f, 0.313987046f},
-std::array<float,2>{0.794251204f, 0.709411502f},
-std::array<float,2>{0.0624881797f, 0.566738248f},
-std::array<float,2>{0.987922132f, 0.385945708f},
-std::array<float,2>{0.358405739f, 0.179109722f},
-std::array<float,2>{0.608378768f, 0.883265018f},
-std::array<float,2>{0.0694135427f, 0.847183526f},
-std::array<float,2>{0.918978751f, 0.0283431709f},
-std::array<float,2>{0.262585461f, 0.273239195f},
-std::array<float,2>{0.503279924f, 0.627078176f},
-std::array<float,2>{0.375048906f, 0.547415555f},
-std::array<float,2>{0.730471015f, 0.479674846f},
-std::array<float,2>{0.247879595f, 0.23492673f},
-std::array<float,2>{0.865304112f, 0.976482987f},
-std::array<float,2>{0.312903643f, 0.917151093f},
-std::array<float,2>{0.586375356f, 0.144138277f},
-std::array<float,2>{0.0252553988f, 0.41134873f},
-std::array<float,2>{0.965479553f, 0.619095445f},
-std::array<float,2>{0.146961436f, 0.720060885f},
-std::array<float,2>{0.774509728f, 0.357597649f},
-std::array<float,2>{0.468951792f, 0.0856238008f},
-std::array<float,2>{0.66095084f, 0.807696223f},
-std::array<float,2>{0.175239936f, 0.7905007f},
-std::array<float,2>{0.810802937f, 0.0738342032f},
-std::array<float,2>{0.445505649f, 0.371996284f},
-std::array<float,2>{0.630460978f, 0.746620417f},
-std::array<float,2>{0.372513264f, 0.603285253f},
-std::array<float,2>{0.611400723f, 0.429483235f},
-std::array<float,2>{0.0394598022f, 0.126060814f},
-std::array<float,2>{0.976948202f, 0.928374827f},
-std::array<float,2>{0.418793261f, 0.997658312f},
-std::array<float,2>{0.713386655f, 0.233322546f},
-std::array<float,2>{0.202331245f, 0.495148897f},
-std::array<float,2>{0.819966197f, 0.541025102f},
-std::array<float,2>{0.123264343f, 0.648738563f},
-std::array<float,2>{0.885078728f, 0.257589817f},
-std::array<float,2>{0.290385306f, 0.0144640682f},
-std::array<float,2>{0.557472527f, 0.863922954f},
-std::array<float,2>{0.0131168291f, 0.89850229f},
-std::array<float,2>{0.942579925f, 0.171623915f},
-std::array<float,2>{0.337953836f, 0.394721657f},
-std::array<float,2>{0.574501872f, 0.581241846f},
-std::array<float,2>{0.496070355f, 0.689977288f},
-std::array<float,2>{0.674043417f, 0.341832846f},
-std::array<float,2>{0.136595264f, 0.123301849f},
-std::array<float,2>{0.752864838f, 0.775981545f},
-std::array<float,2>{0.279941201f, 0.816029251f},
-std::array<float,2>{0.530919015f, 0.0437365957f},
-std::array<float,2>{0.0877258927f, 0.28775093f},
-std::array<float,2>{0.932016194f, 0.684653878f},
-std::array<float,2>{0.223301351f, 0.502552748f},
-std::array<float,2>{0.851904571f, 0.467499375f},
-std::array<float,2>{0.399075866f, 0.209613249f},
-std::array<float,2>{0.740398765f, 0.950499773f},
-std::array<float,2>{0.179957882f, 0.939411163f},
-std::array<float,2>{0.804020703f, 0.218377545f},
-std::array<float,2>{0.439058661f, 0.45818767f},
-std::array<float,2>{0.638451636f, 0.513265967f},
-std::array<float,2>{0.361084938f, 0.677326858f},
-std::array<float,2>{0.621667743f, 0.29340744f},
-std::array<float,2>{0.0314490907f, 0.0323078297f},
-std::array<float,2>{0.974025071f, 0.827471912f},
-std::array<float,2>{0.407279313f, 0.768074691f},
-std::array<float,2>{0.709746838f, 0.112233505f},
-std::array<float,2>{0.191714615f, 0.329403847f},
-std::array<float,2>{0.82165271f, 0.698504746f},
-std::array<float,2>{0.111331709f, 0.591633916f},
-std::array<float,2>{0.876181841f, 0.400857538f},
-std::array<float,2>{0.283699006f, 0.16159068f},
-std::array<float,2>{0.553420961f, 0.893851936f},
-std::array<float,2>{0.000881793036f, 0.871445835f},
-std::array<float,2>{0.952121735f, 0.00299021765f},
-std::array<float,2>{0.32841593f, 0.260491222f},
-std::array<float,2>{0.568312526f, 0.641665995f},
-std::array<float,2>{0.491873831f, 0.536849201f},
-std::array<float,2>{0.681107759f, 0.485253304f},
-std::array<float,2>{0.125288665f, 0.220709503f},
-std::array<float,2>{0.764499307f, 0.987431467f},
-std::array<float,2>{0.271720976f, 0.931075096f},
-std::array<float,2>{0.522881508f, 0.135097995f},
-std::array<float,2>{0.0798448026f, 0.435502559f},
-std::array<float,2>{0.923272192f, 0.593786836f},
-std::array<float,2>{0.231374815f, 0.73886621f},
-std::array<float,2>{0.8501122f, 0.362522393f},
-std::array<float,2>{0.39342621f, 0.0680128857f},
-std::array<float,2>{0.743884742f, 0.787654698f},
-std::array<float,2>{0.203579336f, 0.803198874f},
-std::array<float,2>{0.829056859f, 0.0893950686f},
-std::array<float,2>{0.434539527f, 0.349483132f},
-std::array<float,2>{0.69825536f, 0.734017253f},
-std::array<float,2>{0.306647599f, 0.612810612f},
-std::array<float,2>{0.539995432f, 0.420158267f},
-std::array<float,2>{0.108173415f, 0.155627295f},
-std::array<float,2>{0.897770345f, 0.909659386f},
-std::array<float,2>{0.459502012f, 0.980901182f},
-std::array<float,2>{0.655610681f, 0.2433649f},
-std::array<float,2>{0.1614144f, 0.472509712f},
-std::array<float,2>{0.781333089f, 0.556200325f},
-std::array<float,2>{0.0495285466f, 0.634009421f},
-std::array<float,2>{0.998810232f, 0.27830562f},
-std::array<float,2>{0.347963721f, 0.0201710574f},
-std::array<float,2>{0.598281384f, 0.859228373f},
-std::array<float,2>{0.0735350922f, 0.875724196f},
-std::array<float,2>{0.913302004f, 0.180843025f},
-std::array<float,2>{0.255035013f, 0.382163495f},
-std::array<float,2>{0.512400508f, 0.576059818f},
-std::array<float,2>{0.387332469f, 0.71428746f},
-std::array<float,2>{0.721517324f, 0.32258445f},
-std::array<float,2>{0.239135563f, 0.105331503f},
-std::array<float,2>{0.873138666f, 0.756053329f},
-std::array<float,2>{0.327121764f, 0.838070989f},
-std::array<float,2>{0.581958711f, 0.0480435714f},
-std::array<float,2>{0.0185411908f, 0.30339551f},
-std::array<float,2>{0.957560182f, 0.661666512f},
-std::array<float,2>{0.148474231f, 0.527831793f},
-std::array<float,2>{0.765972912f, 0.451050848f},
-std::array<float,2>{0.482835978f, 0.200256482f},
-std::array<float,2>{0.66998893f, 0.95662868f},
-std::array<float,2>{0.246946767f, 0.914323926f},
-std::array<float,2>{0.866571128f, 0.14217703f},
-std::array<float,2>{0.376827359f, 0.412268102f},
-std::array<float,2>{0.731869638f, 0.619782448f},
-std::array<float,2>{0.26297012f, 0.721158803f},
-std::array<float,2>{0.502261996f, 0.35623017f},
-std::array<float,2>{0.0687987879f, 0.0823969692f},
-std::array<float,2>{0.918786645f, 0.805402935f},
-std::array<float,2>{0.470073521f, 0.8454265f},
-std::array<float,2>{0.662044525f, 0.0301387478f},
-std::array<float,2>{0.148189873f, 0.270652831f},
-std::array<float,2>{0.774108887f, 0.625822186f},
-std::array<float,2>{0.0242580455f, 0.550263047f},
-std::array<float,2>{0.965879202f, 0.476648957f},
-std::array<float,2>{0.313515723f, 0.23751016f},
-std::array<float,2>{0.587092519f, 0.973231554f},
-std::array<float,2>{0.0951532647f, 0.765386224f},
-std::array<float,2>{0.898643613f, 0.096159488f},
-std::array<float,2>{0.304580927f, 0.315424234f},
-std::array<float,2>{0.53453815f, 0.7072106f},
-std::array<float,2>{0.427588552f, 0.569705248f},
-std::array<float,2>{0.69127965f, 0.384232223f},
-std::array<float,2>{0.212938964f, 0.177569851f},
-std::array<float,2>{0.841145456f, 0.886171818f},
-std::array<float,2>{0.358133346f, 0.966802716f},
-std::array<float,2>{0.608753741f, 0.191683695f},
-std::array<float,2>{0.0614639707f, 0.439604402f},
-std::array<float,2>{0.986760437f, 0.522348166f},
-std::array<float,2>{0.168976873f, 0.666490912f},
-std::array<float,2>{0.793105781f, 0.305336297f},
-std::array<float,2>{0.468677223f, 0.0615044236f},
-std::array<float,2>{0.646807313f, 0.830230057f},
-std::array<float,2>{0.134912893f, 0.813343704f},
-std::array<float,2>{0.753043413f, 0.0460988171f},
-std::array<float,2>{0.494892865f, 0.286253452f},
-std::array<float,2>{0.674983859f, 0.686691582f},
-std::array<float,2>{0.339562148f, 0.500671685f},
-std::array<float,2>{0.576098382f, 0.464953274f},
-std::array<float,2>{0.0121710813f, 0.208062023f},
-std::array<float,2>{0.941471517f, 0.951889515f},
-std::array<float,2>{0.400056303f, 0.900820374f},
-std::array<float,2>{0.741257071f, 0.169920936f},
-std::array<float,2>{0.224306017f, 0.398096383f},
-std::array<float,2>{0.852678657f, 0.578820348f},
-std::array<float,2>{0.0862788185f, 0.688368261f},
-std::array<float,2>{0.933477521f, 0.340170115f},
-std::array<float,2>{0.280291855f, 0.121643789f},
-std::array<float,2>{0.529611647f, 0.77439177f},
-std::array<float,2>{0.0407898165f, 0.998754025f},
-std::array<float,2>{0.977695763f, 0.232323676f},
-std::array<float,2>{0.371174604f, 0.492472798f},
-std::array<float,2>{0.612787187f, 0.540068924f},
-std::array<float,2>{0.446537882f, 0.652106583f},
-std::array<float,2>{0.629701197f, 0.254655451f},
-std::array<float,2>{0.174603954f, 0.0121474713f},
-std::array<float,2>{0.812313199f, 0.866062939f},
-std::array<float,2>{0.289771795f, 0.792434931f},
-std::array<float,2>{0.557734191f, 0.0708341673f},
-std::array<float,2>{0.124299556f, 0.373264343f},
-std::array<float,2>{0.886296153f, 0.749827862f},
-std::array<float,2>{0.201513693f, 0.60437274f},
-std::array<float,2>{0.818868637f, 0.42684558f},
-std::array<float,2>{0.419441074f, 0.127906159f},
-std::array<float,2>{0.713873327f, 0.926433146f},
-std::array<float,2>{0.143267795f, 0.897098541f},
-std::array<float,2>{0.778766632f, 0.15862833f},
-std::array<float,2>{0.473938316f, 0.403372675f},
-std::array<float,2>{0.656602621f, 0.586908937f},
-std::array<float,2>{0.319253981f, 0.702338874f},
-std::array<float,2>{0.592871785f, 0.335781842f},
-std::array<float,2>{0.0300061721f, 0.115359463f},
-std::array<float,2>{0.963251054f, 0.771782279f},
-std::array<float,2>{0.380672157f, 0.821206689f},
-std::array<float,2>{0.730253577f, 0.0368922614f},
-std::array<float,2>{0.242800236f, 0.290608704f},
-std::array<float,2>{0.861592472f, 0.675014436f},
-std::array<float,2>{0.0641053841f, 0.508827448f},
-std::array<float,2>{0.917353034f, 0.453188837f},
-std::array<float,2>{0.258778006f, 0.211320654f},
-std::array<float,2>{0.505109072f, 0.943016887f},
-std::array<float,2>{0.0577061996f, 0.782378614f},
-std::array<float,2>{0.988862813f, 0.0630317926f},
-std::array<float,2>{0.355120182f, 0.364426255f},
-std::array<float,2>{0.602033138f, 0.736621737f},
-std::array<float,2>{0.464268535f, 0.598008692f},
-std::array<float,2>{0.644221365f, 0.42991811f},
-std::array<float,2>{0.164269611f, 0.140293851f},
-std::array<float,2>{0.792670667f, 0.9365713f},
-std::array<float,2>{0.300742894f, 0.989582002f},
-std::array<float,2>{0.538594425f, 0.222897097f},
-std::array<float,2>{0.0997757167f, 0.489089549f},
-std::array<float,2>{0.902356923f, 0.533944964f},
-std::array<float,2>{0.217062175f, 0.646541893f},
-std::array<float,2>{0.839240313f, 0.262561351f},
-std::array<float,2>{0.42285949f, 0.00415699556f},
-std::array<float,2>{0.692703426f, 0.868852139f},
-std::array<float,2>{0.218872741f, 0.851708949f},
-std::array<float,2>{0.857947767f, 0.0192450322f},
-std::array<float,2>{0.405531794f, 0.276247859f},
-std::array<float,2>{0.735120296f, 0.63942492f},
-std::array<float,2>{0.275080353f, 0.56102103f},
-std::array<float,2>{0.525977194f, 0.476291746f},
-std::array<float,2>{0.0922739506f, 0.247159556f},
-std::array<float,2>{0.934284687f, 0.977604985f},
-std::array<float,2>{0.497073799f, 0.913554668f},
-std::array<float,2>{0.675951719f, 0.151348799f},
-std::array<float,2>{0.140246168f, 0.416530371f},
-std::array<float,2>{0.756201744f, 0.616489172f},
-std::array<float,2>{0.0115858959f, 0.730023563f},
-std::array<float,2>{0.940446496f, 0.344324499f},
-std::array<float,2>{0.341175944f, 0.0902517959f},
-std::array<float,2>{0.574118435f, 0.797875702f},
-std::array<float,2>{0.118779443f, 0.958620191f},
-std::array<float,2>{0.888526201f, 0.196852803f},
-std::array<float,2>{0.295732856f, 0.446073472f},
-std::array<float,2>{0.562046111f, 0.523588896f},
-std::array<float,2>{0.416619927f, 0.656727374f},
-std::array<float,2>{0.715818882f, 0.300712615f},
-std::array<float,2>{0.198873952f, 0.0538755432f},
-std::array<float,2>{0.813385546f, 0.842595577f},
-std::array<float,2>{0.367722422f, 0.751103997f},
-std::array<float,2>{0.615372956f, 0.108374834f},
-std::array<float,2>{0.043708995f, 0.325392395f},
-std::array<float,2>{0.981942832f, 0.718322515f},
-std::array<float,2>{0.176511154f, 0.573085427f},
-std::array<float,2>{0.806444287f, 0.378684074f},
-std::array<float,2>{0.450158983f, 0.183855355f},
-std::array<float,2>{0.626343369f, 0.882574499f},
-std::array<float,2>{0.191171721f, 0.968831837f},
-std::array<float,2>{0.827421248f, 0.239112705f},
-std::array<float,2>{0.413567454f, 0.481969565f},
-std::array<float,2>{0.704408407f, 0.55390662f},
-std::array<float,2>{0.286599219f, 0.632810235f},
-std::array<float,2>{0.547757745f, 0.267053217f},
-std::array<float,2>{0.115957811f, 0.0235988777f},
-std::array<float,2>{0.878983796f, 0.848716497f},
-std::array<float,2>{0.444358498f, 0.810939729f},
-std::array<float,2>{0.636135459f, 0.0800677463f},
-std::array<float,2>{0.18741256f, 0.353129923f},
-std::array<float,2>{0.800632656f, 0.725811541f},
-std::array<float,2>{0.0375116467f, 0.623865962f},
-std::array<float,2>{0.970137715f, 0.407581657f},
-std::array<float,2>{0.366519004f, 0.145354986f},
-std::array<float,2>{0.61831671f, 0.918480277f},
-std::array<float,2>{0.084081389f, 0.834639013f},
-std::array<float,2>{0.928844512f, 0.0564559922f},
-std::array<float,2>{0.265801698f, 0.312420577f},
-std::array<float,2>{0.516515911f, 0.669477761f},
-std::array<float,2>{0.395604938f, 0.515986025f},
-std::array<float,2>{0.746197045f, 0.443201542f},
-std::array<float,2>{0.229487985f, 0.190995842f},
-std::array<float,2>{0.845918536f, 0.960937917f},
-std::array<float,2>{0.33389765f, 0.886735797f},
-std::array<float,2>{0.56589067f, 0.172778666f},
-std::array<float,2>{0.00519692292f, 0.388390213f},
-std::array<float,2>{0.947884321f, 0.56340909f},
-std::array<float,2>{0.129751042f, 0.706130683f},
-std::array<float,2>{0.760048747f, 0.317844093f},
-std::array<float,2>{0.486060858f, 0.0979296416f},
-std::array<float,2>{0.68386513f, 0.760356009f},
-std::array<float,2>{0.156611994f, 0.777404189f},
-std::array<float,2>{0.785679996f, 0.117471248f},
-std::array<float,2>{0.454628199f, 0.336632222f},
-std::array<float,2>{0.649664521f, 0.69465512f},
-std::array<float,2>{0.343821764f, 0.5856269f},
-std::array<float,2>{0.594311118f, 0.39133966f},
-std::array<float,2>{0.053340897f, 0.167068839f},
-std::array<float,2>{0.994550169f, 0.903464794f},
-std::array<float,2>{0.431728274f, 0.948399663f},
-std::array<float,2>{0.702062786f, 0.20382607f},
-std::array<float,2>{0.210089311f, 0.461607754f},
-std::array<float,2>{0.834792614f, 0.504147351f},
-std::array<float,2>{0.102668755f, 0.683047473f},
-std::array<float,2>{0.890703797f, 0.28399992f},
-std::array<float,2>{0.31246534f, 0.0406900086f},
-std::array<float,2>{0.543585896f, 0.819343209f},
-std::array<float,2>{0.0222711954f, 0.923990607f},
-std::array<float,2>{0.956456721f, 0.132592782f},
-std::array<float,2>{0.322653562f, 0.422129869f},
-std::array<float,2>{0.583932817f, 0.60843569f},
-std::array<float,2>{0.479446441f, 0.744749188f},
-std::array<float,2>{0.664138377f, 0.370093107f},
-std::array<float,2>{0.154389828f, 0.076644972f},
-std::array<float,2>{0.771858096f, 0.795740187f},
-std::array<float,2>{0.253552616f, 0.860110641f},
-std::array<float,2>{0.510723531f, 0.00933031458f},
-std::array<float,2>{0.0754871592f, 0.250937074f},
-std::array<float,2>{0.90929848f, 0.655762672f},
-std::array<float,2>{0.237766922f, 0.54537642f},
-std::array<float,2>{0.86929363f, 0.498029202f},
-std::array<float,2>{0.386373967f, 0.230076954f},
-std::array<float,2>{0.724142969f, 0.994427323f},
-std::array<float,2>{0.127155811f, 0.984751642f},
-std::array<float,2>{0.762281597f, 0.219218731f},
-std::array<float,2>{0.489762962f, 0.486671418f},
-std::array<float,2>{0.682283282f, 0.537512302f},
-std::array<float,2>{0.33200717f, 0.64351809f},
-std::array<float,2>{0.569545329f, 0.258830845f},
-std::array<float,2>{0.00238764775f, 1.55725354e-06f},
-std::array<float,2>{0.949689269f, 0.874452293f},
-std::array<float,2>{0.391783684f, 0.785295844f},
-std::array<float,2>{0.746036112f, 0.0692907199f},
-std::array<float,2>{0.232555464f, 0.360506535f},
-std::array<float,2>{0.849159658f, 0.740493834f},
-std::array<float,2>{0.0817743465f, 0.597098291f},
-std::array<float,2>{0.92383939f, 0.436088353f},
-std::array<float,2>{0.26999703f, 0.134350836f},
-std::array<float,2>{0.520099759f, 0.933501482f},
-std::array<float,2>{0.0335946828f, 0.825902462f},
-std::array<float,2>{0.976521432f, 0.0342160091f},
-std::array<float,2>{0.363097519f, 0.296713799f},
-std::array<float,2>{0.624479949f, 0.679147422f},
-std::array<float,2>{0.440020233f, 0.513970971f},
-std::array<float,2>{0.638855219f, 0.459292591f},
-std::array<float,2>{0.182331145f, 0.215630621f},
-std::array<float,2>{0.800967932f, 0.939989865f},
-std::array<float,2>{0.282602996f, 0.892333508f},
-std::array<float,2>{0.551065028f, 0.163221166f},
-std::array<float,2>{0.110995345f, 0.399112672f},
-std::array<float,2>{0.877616882f, 0.592751086f},
-std::array<float,2>{0.19471474f, 0.696426153f},
-std::array<float,2>{0.822744429f, 0.331274658f},
-std::array<float,2>{0.409018964f, 0.111270547f},
-std::array<float,2>{0.708929121f, 0.766648173f},
-std::array<float,2>{0.240668461f, 0.754474878f},
-std::array<float,2>{0.872198045f, 0.102973051f},
-std::array<float,2>{0.389982253f, 0.32038784f},
-std::array<float,2>{0.720020592f, 0.71261996f},
-std::array<float,2>{0.257099509f, 0.577500105f},
-std::array<float,2>{0.513953507f, 0.379912943f},
-std::array<float,2>{0.0713124424f, 0.183124274f},
-std::array<float,2>{0.911435783f, 0.877749503f},
-std::array<float,2>{0.481376588f, 0.954547048f},
-std::array<float,2>{0.668803573f, 0.201617986f},
-std::array<float,2>{0.152302027f, 0.451259702f},
-std::array<float,2>{0.768539131f, 0.530562103f},
-std::array<float,2>{0.0156696755f, 0.662833333f},
-std::array<float,2>{0.960104644f, 0.30078578f},
-std::array<float,2>{0.325805902f, 0.0499404818f},
-std::array<float,2>{0.579904735f, 0.837005734f},
-std::array<float,2>{0.106686532f, 0.908037007f},
-std::array<float,2>{0.895799518f, 0.152966946f},
-std::array<float,2>{0.306077093f, 0.419233084f},
-std::array<float,2>{0.541075945f, 0.611262083f},
-std::array<float,2>{0.436692864f, 0.730800569f},
-std::array<float,2>{0.696586013f, 0.349810302f},
-std::array<float,2>{0.206899166f, 0.087632671f},
-std::array<float,2>{0.831531048f, 0.802109778f},
-std::array<float,2>{0.350473344f, 0.857083261f},
-std::array<float,2>{0.599911273f, 0.0233727079f},
-std::array<float,2>{0.0472521782f, 0.28077662f},
-std::array<float,2>{0.997512341f, 0.636594892f},
-std::array<float,2>{0.162164599f, 0.558077157f},
-std::array<float,2>{0.784796715f, 0.469600409f},
-std::array<float,2>{0.457780927f, 0.244946435f},
-std::array<float,2>{0.652446985f, 0.984115303f},
-std::array<float,2>{0.211936697f, 0.882934213f},
-std::array<float,2>{0.843489289f, 0.178721234f},
-std::array<float,2>{0.428290516f, 0.386062086f},
-std::array<float,2>{0.68914783f, 0.566591144f},
-std::array<float,2>{0.30125007f, 0.709114969f},
-std::array<float,2>{0.532538414f, 0.314318508f},
-std::array<float,2>{0.0973428413f, 0.0939762965f},
-std::array<float,2>{0.900963724f, 0.763178825f},
-std::array<float,2>{0.465057194f, 0.829291284f},
-std::array<float,2>{0.646406889f, 0.0595906973f},
-std::array<float,2>{0.170419216f, 0.307169169f},
-std::array<float,2>{0.795421302f, 0.664360642f},
-std::array<float,2>{0.0595115274f, 0.520511031f},
-std::array<float,2>{0.984923959f, 0.43762365f},
-std::array<float,2>{0.357176125f, 0.194112033f},
-std::array<float,2>{0.605680704f, 0.96654439f},
-std::array<float,2>{0.0677321702f, 0.807876825f},
-std::array<float,2>{0.920268714f, 0.0858424678f},
-std::array<float,2>{0.264384061f, 0.357679218f},
-std::array<float,2>{0.500214994f, 0.719958007f},
-std::array<float,2>{0.378242224f, 0.618804216f},
-std::array<float,2>{0.732537746f, 0.411387861f},
-std::array<float,2>{0.249130011f, 0.144463211f},
-std::array<float,2>{0.864566565f, 0.917314589f},
-std::array<float,2>{0.31556043f, 0.976274192f},
-std::array<float,2>{0.588251948f, 0.235120207f},
-std::array<float,2>{0.0254360363f, 0.479798138f},
-std::array<float,2>{0.967943132f, 0.547679663f},
-std::array<float,2>{0.145174637f, 0.627322078f},
-std::array<float,2>{0.776181519f, 0.273061275f},
-std::array<float,2>{0.47246775f, 0.0287066046f},
-std::array<float,2>{0.662835181f, 0.847598135f},
-std::array<float,2>{0.172190145f, 0.864212632f},
-std::array<float,2>{0.808915734f, 0.0143093793f},
-std::array<float,2>{0.448103458f, 0.257366955f},
-std::array<float,2>{0.631412566f, 0.648668766f},
-std::array<float,2>{0.374540418f, 0.54126215f},
-std::array<float,2>{0.610295057f, 0.495554954f},
-std::array<float,2>{0.0413771532f, 0.233045995f},
-std::array<float,2>{0.980230927f, 0.997830153f},
-std::array<float,2>{0.420992672f, 0.928508639f},
-std::array<float,2>{0.71149987f, 0.126458019f},
-std::array<float,2>{0.20113878f, 0.429228157f},
-std::array<float,2>{0.816722393f, 0.603170693f},
-std::array<float,2>{0.122332722f, 0.746948719f},
-std::array<float,2>{0.884715557f, 0.3716847f},
-std::array<float,2>{0.292554796f, 0.0740591884f},
-std::array<float,2>{0.555687129f, 0.790116072f},
-std::array<float,2>{0.0146542117f, 0.950380743f},
-std::array<float,2>{0.94370693f, 0.209956154f},
-std::array<float,2>{0.337503225f, 0.467624962f},
-std::array<float,2>{0.577187181f, 0.502793252f},
-std::array<float,2>{0.493792146f, 0.68484515f},
-std::array<float,2>{0.673734248f, 0.287869364f},
-std::array<float,2>{0.133486643f, 0.0435362868f},
-std::array<float,2>{0.751806796f, 0.816270113f},
-std::array<float,2>{0.278686613f, 0.776336551f},
-std::array<float,2>{0.529003203f, 0.12313167f},
-std::array<float,2>{0.0879875869f, 0.34208405f},
-std::array<float,2>{0.931237042f, 0.690246522f},
-std::array<float,2>{0.226371646f, 0.58145982f},
-std::array<float,2>{0.854192436f, 0.394848287f},
-std::array<float,2>{0.400737554f, 0.171754822f},
-std::array<float,2>{0.738716185f, 0.898709476f},
-std::array<float,2>{0.167949528f, 0.934181988f},
-std::array<float,2>{0.790890634f, 0.13845706f},
-std::array<float,2>{0.462643087f, 0.433386773f},
-std::array<float,2>{0.641501069f, 0.600327134f},
-std::array<float,2>{0.352600992f, 0.735354662f},
-std::array<float,2>{0.603746712f, 0.365250289f},
-std::array<float,2>{0.0561338104f, 0.0648103133f},
-std::array<float,2>{0.991248786f, 0.783203959f},
-std::array<float,2>{0.424212873f, 0.871046722f},
-std::array<float,2>{0.693828225f, 0.0060023074f},
-std::array<float,2>{0.215159327f, 0.264242083f},
-std::array<float,2>{0.836264729f, 0.645967901f},
-std::array<float,2>{0.0985539481f, 0.533095002f},
-std::array<float,2>{0.905354679f, 0.490660518f},
-std::array<float,2>{0.297952324f, 0.226513252f},
-std::array<float,2>{0.536834955f, 0.991136193f},
-std::array<float,2>{0.0284451935f, 0.769663155f},
-std::array<float,2>{0.961859107f, 0.113392845f},
-std::array<float,2>{0.316666692f, 0.333443254f},
-std::array<float,2>{0.589852989f, 0.70040834f},
-std::array<float,2>{0.476287693f, 0.588584423f},
-std::array<float,2>{0.658580303f, 0.404578954f},
-std::array<float,2>{0.140798703f, 0.157214716f},
-std::array<float,2>{0.780482471f, 0.895433903f},
-std::array<float,2>{0.261431485f, 0.94447577f},
-std::array<float,2>{0.507182837f, 0.214312986f},
-std::array<float,2>{0.0660953075f, 0.4556835f},
-std::array<float,2>{0.914776146f, 0.510610998f},
-std::array<float,2>{0.244362846f, 0.672075868f},
-std::array<float,2>{0.86128509f, 0.291987896f},
-std::array<float,2>{0.381457776f, 0.037326403f},
-std::array<float,2>{0.727422476f, 0.823053062f},
-std::array<float,2>{0.19672887f, 0.840020716f},
-std::array<float,2>{0.814532518f, 0.0510482714f},
-std::array<float,2>{0.414597034f, 0.29783991f},
-std::array<float,2>{0.71805954f, 0.658944786f},
-std::array<float,2>{0.294500828f, 0.527019858f},
-std::array<float,2>{0.559959292f, 0.447345525f},
-std::array<float,2>{0.1192623f, 0.198960736f},
-std::array<float,2>{0.889546514f, 0.95914942f},
-std::array<float,2>{0.451187879f, 0.880788743f},
-std::array<float,2>{0.627018571f, 0.186447859f},
-std::array<float,2>{0.178046808f, 0.375316322f},
-std::array<float,2>{0.807269454f, 0.571066201f},
-std::array<float,2>{0.0454477556f, 0.71577239f},
-std::array<float,2>{0.984063327f, 0.32797277f},
-std::array<float,2>{0.37066564f, 0.107399426f},
-std::array<float,2>{0.614257455f, 0.753748477f},
-std::array<float,2>{0.0909435153f, 0.980380237f},
-std::array<float,2>{0.937256098f, 0.248835891f},
-std::array<float,2>{0.277040154f, 0.473975539f},
-std::array<float,2>{0.524278998f, 0.558786035f},
-std::array<float,2>{0.404269516f, 0.637533665f},
-std::array<float,2>{0.737405658f, 0.274190754f},
-std::array<float,2>{0.221206084f, 0.0172648784f},
-std::array<float,2>{0.856539905f, 0.854887605f},
-std::array<float,2>{0.343207479f, 0.799824715f},
-std::array<float,2>{0.571214736f, 0.092720516f},
-std::array<float,2>{0.00973115955f, 0.347138017f},
-std::array<float,2>{0.939439237f, 0.728274524f},
-std::array<float,2>{0.137893453f, 0.613668084f},
-std::array<float,2>{0.754956126f, 0.414074808f},
-std::array<float,2>{0.499766976f, 0.150106147f},
-std::array<float,2>{0.678495228f, 0.911832809f},
-std::array<float,2>{0.228101924f, 0.964017808f},
-std::array<float,2>{0.844560564f, 0.188225582f},
-std::array<float,2>{0.396725446f, 0.444491833f},
-std::array<float,2>{0.748832583f, 0.518922508f},
-std::array<float,2>{0.267914921f, 0.670488298f},
-std::array<float,2>{0.518239439f, 0.310239345f},
-std::array<float,2>{0.0832165256f, 0.0576565005f},
-std::array<float,2>{0.925950944f, 0.833953261f},
-std::array<float,2>{0.487630963f, 0.758538365f},
-std::array<float,2>{0.68590641f, 0.0998135656f},
-std::array<float,2>{0.131525755f, 0.31978029f},
-std::array<float,2>{0.758776605f, 0.704626381f},
-std::array<float,2>{0.00685960148f, 0.566351771f},
-std::array<float,2>{0.947190106f, 0.389909834f},
-std::array<float,2>{0.334399253f, 0.175003633f},
-std::array<float,2>{0.564243615f, 0.89007777f},
-std::array<float,2>{0.113768667f, 0.851423025f},
-std::array<float,2>{0.881071091f, 0.02576866f},
-std::array<float,2>{0.288104564f, 0.26909548f},
-std::array<float,2>{0.54905498f, 0.629141808f},
-std::array<float,2>{0.411069036f, 0.551975429f},
-std::array<float,2>{0.705182672f, 0.48322624f},
-std::array<float,2>{0.189050019f, 0.241813198f},
-std::array<float,2>{0.824890375f, 0.971148789f},
-std::array<float,2>{0.364879429f, 0.920347214f},
-std::array<float,2>{0.621016264f, 0.147203237f},
-std::array<float,2>{0.0362603255f, 0.409638166f},
-std::array<float,2>{0.971326351f, 0.622810125f},
-std::array<float,2>{0.184582248f, 0.722908497f},
-std::array<float,2>{0.797218144f, 0.355312943f},
-std::array<float,2>{0.442056775f, 0.0814110339f},
-std::array<float,2>{0.633522034f, 0.809871852f},
-std::array<float,2>{0.15350835f, 0.793774724f},
-std::array<float,2>{0.769623637f, 0.074281536f},
-std::array<float,2>{0.476921648f, 0.368115991f},
-std::array<float,2>{0.666918337f, 0.742548108f},
-std::array<float,2>{0.321351945f, 0.606466711f},
-std::array<float,2>{0.585320532f, 0.424995214f},
-std::array<float,2>{0.0200481024f, 0.129050136f},
-std::array<float,2>{0.953454971f, 0.923727453f},
-std::array<float,2>{0.383083314f, 0.99353075f},
-std::array<float,2>{0.725680768f, 0.228262454f},
-std::array<float,2>{0.234715715f, 0.49922508f},
-std::array<float,2>{0.868163049f, 0.543301105f},
-std::array<float,2>{0.0772908479f, 0.652664661f},
-std::array<float,2>{0.908109128f, 0.253884703f},
-std::array<float,2>{0.251569569f, 0.0116710691f},
-std::array<float,2>{0.507848799f, 0.861636162f},
-std::array<float,2>{0.0510639735f, 0.905332088f},
-std::array<float,2>{0.992218077f, 0.165097281f},
-std::array<float,2>{0.34748134f, 0.394530982f},
-std::array<float,2>{0.597132266f, 0.583269835f},
-std::array<float,2>{0.456012398f, 0.691540837f},
-std::array<float,2>{0.652240396f, 0.339051008f},
-std::array<float,2>{0.1595705f, 0.119995952f},
-std::array<float,2>{0.78726995f, 0.780518293f},
-std::array<float,2>{0.309909731f, 0.817184508f},
-std::array<float,2>{0.546013415f, 0.0425004177f},
-std::array<float,2>{0.105097927f, 0.282302916f},
-std::array<float,2>{0.892683327f, 0.679875135f},
-std::array<float,2>{0.207230046f, 0.50714159f},
-std::array<float,2>{0.832261145f, 0.464705706f},
-std::array<float,2>{0.430269331f, 0.205202684f},
-std::array<float,2>{0.700223505f, 0.946896136f},
-std::array<float,2>{0.151298404f, 0.955733538f},
-std::array<float,2>{0.768792331f, 0.200002953f},
-std::array<float,2>{0.482111663f, 0.449889302f},
-std::array<float,2>{0.669900656f, 0.528483152f},
-std::array<float,2>{0.324905843f, 0.660337269f},
-std::array<float,2>{0.578159988f, 0.303790331f},
-std::array<float,2>{0.0172161758f, 0.0470613241f},
-std::array<float,2>{0.959485471f, 0.839504719f},
-std::array<float,2>{0.389242262f, 0.757537067f},
-std::array<float,2>{0.718848348f, 0.104313552f},
-std::array<float,2>{0.241366848f, 0.324062735f},
-std::array<float,2>{0.871159732f, 0.713218272f},
-std::array<float,2>{0.070561111f, 0.574427307f},
-std::array<float,2>{0.910747647f, 0.38173607f},
-std::array<float,2>{0.256278664f, 0.180627108f},
-std::array<float,2>{0.515228748f, 0.876892805f},
-std::array<float,2>{0.0481128842f, 0.857849717f},
-std::array<float,2>{0.997043848f, 0.0210597999f},
-std::array<float,2>{0.350588262f, 0.278416246f},
-std::array<float,2>{0.60135603f, 0.633292913f},
-std::array<float,2>{0.458599776f, 0.555111825f},
-std::array<float,2>{0.653959572f, 0.470704347f},
-std::array<float,2>{0.163198426f, 0.242962822f},
-std::array<float,2>{0.78344965f, 0.981751144f},
-std::array<float,2>{0.305346727f, 0.908428192f},
-std::array<float,2>{0.54294008f, 0.155008391f},
-std::array<float,2>{0.105676435f, 0.421112835f},
-std::array<float,2>{0.8949247f, 0.6122877f},
-std::array<float,2>{0.205587491f, 0.732675076f},
-std::array<float,2>{0.83040297f, 0.348393053f},
-std::array<float,2>{0.436313123f, 0.0885897726f},
-std::array<float,2>{0.695435941f, 0.803744137f},
-std::array<float,2>{0.233938307f, 0.788507342f},
-std::array<float,2>{0.848387122f, 0.0666871667f},
-std::array<float,2>{0.39096418f, 0.362198561f},
-std::array<float,2>{0.74478662f, 0.739706993f},
-std::array<float,2>{0.270640552f, 0.594883442f},
-std::array<float,2>{0.520838261f, 0.434174627f},
-std::array<float,2>{0.0806068406f, 0.136322483f},
-std::array<float,2>{0.92504251f, 0.930655479f},
-std::array<float,2>{0.489113867f, 0.987113774f},
-std::array<float,2>{0.682713747f, 0.22213155f},
-std::array<float,2>{0.128199846f, 0.48581329f},
-std::array<float,2>{0.763351262f, 0.535231471f},
-std::array<float,2>{0.00379527407f, 0.641227961f},
-std::array<float,2>{0.950739145f, 0.26163739f},
-std::array<float,2>{0.330137938f, 0.00220725243f},
-std::array<float,2>{0.568975389f, 0.872554839f},
-std::array<float,2>{0.109811209f, 0.892893493f},
-std::array<float,2>{0.878453791f, 0.160790727f},
-std::array<float,2>{0.282074362f, 0.402339786f},
-std::array<float,2>{0.552212536f, 0.590584874f},
-std::array<float,2>{0.409879059f, 0.697747946f},
-std::array<float,2>{0.708005071f, 0.328592598f},
-std::array<float,2>{0.193715334f, 0.112610668f},
-std::array<float,2>{0.823889136f, 0.768989563f},
-std::array<float,2>{0.361758053f, 0.826597929f},
-std::array<float,2>{0.623189032f, 0.0316296406f},
-std::array<float,2>{0.0343364216f, 0.294556856f},
-std::array<float,2>{0.974976003f, 0.676600099f},
-std::array<float,2>{0.182968751f, 0.511837602f},
-std::array<float,2>{0.801910758f, 0.457731545f},
-std::array<float,2>{0.440702349f, 0.216924518f},
-std::array<float,2>{0.640201986f, 0.93809551f},
-std::array<float,2>{0.199919581f, 0.927222729f},
-std::array<float,2>{0.817583859f, 0.128401309f},
-std::array<float,2>{0.420345575f, 0.426055521f},
-std::array<float,2>{0.712625742f, 0.604952455f},
-std::array<float,2>{0.291838318f, 0.748726606f},
-std::array<float,2>{0.55565238f, 0.37474063f},
-std::array<float,2>{0.12203671f, 0.0713559017f},
-std::array<float,2>{0.883359313f, 0.79173398f},
-std::array<float,2>{0.448331147f, 0.866280735f},
-std::array<float,2>{0.632396281f, 0.0130421678f},
-std::array<float,2>{0.172854468f, 0.255253762f},
-std::array<float,2>{0.810243785f, 0.651094735f},
-std::array<float,2>{0.0424866267f, 0.539763272f},
-std::array<float,2>{0.979460239f, 0.493495941f},
-std::array<float,2>{0.373900056f, 0.230758443f},
-std::array<float,2>{0.610618711f, 0.999397397f},
-std::array<float,2>{0.0896930695f, 0.775286853f},
-std::array<float,2>{0.930433571f, 0.122385174f},
-std::array<float,2>{0.277550459f, 0.341790289f},
-std::array<float,2>{0.527901232f, 0.688483298f},
-std::array<float,2>{0.402151674f, 0.579129517f},
-std::array<float,2>{0.739929676f, 0.396601111f},
-std::array<float,2>{0.224827901f, 0.168670669f},
-std::array<float,2>{0.855260551f, 0.901771486f},
-std::array<float,2>{0.33651951f, 0.953075945f},
-std::array<float,2>{0.576225936f, 0.207905069f},
-std::array<float,2>{0.0145138372f, 0.466526896f},
-std::array<float,2>{0.944474876f, 0.501491427f},
-std::array<float,2>{0.134298831f, 0.686212361f},
-std::array<float,2>{0.75013715f, 0.285541266f},
-std::array<float,2>{0.492821276f, 0.0456074886f},
-std::array<float,2>{0.671951294f, 0.814447343f},
-std::array<float,2>{0.171148822f, 0.831715763f},
-std::array<float,2>{0.796049714f, 0.0624812916f},
-std::array<float,2>{0.466101885f, 0.306324184f},
-std::array<float,2>{0.644837141f, 0.66768837f},
-std::array<float,2>{0.356322557f, 0.523026347f},
-std::array<float,2>{0.606984258f, 0.441022784f},
-std::array<float,2>{0.0604850277f, 0.192902133f},
-std::array<float,2>{0.985847831f, 0.968315721f},
-std::array<float,2>{0.429357618f, 0.885482728f},
-std::array<float,2>{0.68814522f, 0.176440641f},
-std::array<float,2>{0.211841688f, 0.383022159f},
-std::array<float,2>{0.8425892f, 0.56867075f},
-std::array<float,2>{0.0965664387f, 0.708646417f},
-std::array<float,2>{0.902107894f, 0.315441906f},
-std::array<float,2>{0.302511424f, 0.0972106382f},
-std::array<float,2>{0.531545758f, 0.764417529f},
-std::array<float,2>{0.0263991207f, 0.974383295f},
-std::array<float,2>{0.966939092f, 0.236619219f},
-std::array<float,2>{0.314490825f, 0.477597862f},
-std::array<float,2>{0.589420617f, 0.549298704f},
-std::array<float,2>{0.471295655f, 0.626192689f},
-std::array<float,2>{0.663256884f, 0.270281196f},
-std::array<float,2>{0.145684198f, 0.0306401849f},
-std::array<float,2>{0.776809394f, 0.844671428f},
-std::array<float,2>{0.265574783f, 0.80575186f},
-std::array<float,2>{0.501690269f, 0.0839059651f},
-std::array<float,2>{0.0672896951f, 0.357041329f},
-std::array<float,2>{0.921798289f, 0.721791625f},
-std::array<float,2>{0.24892351f, 0.620675683f},
-std::array<float,2>{0.863319099f, 0.413470507f},
-std::array<float,2>{0.377501726f, 0.141358465f},
-std::array<float,2>{0.733878016f, 0.915931463f},
-std::array<float,2>{0.179297864f, 0.881623745f},
-std::array<float,2>{0.807745159f, 0.185034811f},
-std::array<float,2>{0.45295462f, 0.377381146f},
-std::array<float,2>{0.628654957f, 0.573504508f},
-std::array<float,2>{0.370063812f, 0.717371583f},
-std::array<float,2>{0.614697337f, 0.324225456f},
-std::array<float,2>{0.0463911369f, 0.108845323f},
-std::array<float,2>{0.982780933f, 0.750895262f},
-std::array<float,2>{0.415637732f, 0.843102694f},
-std::array<float,2>{0.717003405f, 0.0529904142f},
-std::array<float,2>{0.196001306f, 0.299460471f},
-std::array<float,2>{0.815531194f, 0.657655895f},
-std::array<float,2>{0.120890327f, 0.525220335f},
-std::array<float,2>{0.890522242f, 0.446534336f},
-std::array<float,2>{0.293552995f, 0.195369482f},
-std::array<float,2>{0.559187353f, 0.957916558f},
-std::array<float,2>{0.00876821484f, 0.7977494f},
-std::array<float,2>{0.937757671f, 0.0916923285f},
-std::array<float,2>{0.342653483f, 0.345252693f},
-std::array<float,2>{0.571612597f, 0.729024053f},
-std::array<float,2>{0.498165399f, 0.616008341f},
-std::array<float,2>{0.679105282f, 0.417602599f},
-std::array<float,2>{0.137533575f, 0.151607677f},
-std::array<float,2>{0.754303992f, 0.91292572f},
-std::array<float,2>{0.27616325f, 0.977435589f},
-std::array<float,2>{0.525087833f, 0.247058958f},
-std::array<float,2>{0.0898727179f, 0.474855155f},
-std::array<float,2>{0.935780823f, 0.562330127f},
-std::array<float,2>{0.2226246f, 0.640266955f},
-std::array<float,2>{0.85595125f, 0.277055025f},
-std::array<float,2>{0.403177291f, 0.0176016577f},
-std::array<float,2>{0.736649513f, 0.853118718f},
-std::array<float,2>{0.2167781f, 0.867974579f},
-std::array<float,2>{0.836984158f, 0.00555311143f},
-std::array<float,2>{0.425315499f, 0.263073057f},
-std::array<float,2>{0.694741786f, 0.647547245f},
-std::array<float,2>{0.297399879f, 0.535073876f},
-std::array<float,2>{0.535460353f, 0.489599258f},
-std::array<float,2>{0.0988426134f, 0.224543229f},
-std::array<float,2>{0.905049622f, 0.988652468f},
-std::array<float,2>{0.461063504f, 0.936308384f},
-std::array<float,2>{0.641906917f, 0.138918981f},
-std::array<float,2>{0.166381508f, 0.431319445f},
-std::array<float,2>{0.789780617f, 0.59910816f},
-std::array<float,2>{0.0556430966f, 0.73762691f},
-std::array<float,2>{0.990906715f, 0.364202231f},
-std::array<float,2>{0.35157308f, 0.0638477355f},
-std::array<float,2>{0.605088413f, 0.78125459f},
-std::array<float,2>{0.0646372661f, 0.941705108f},
-std::array<float,2>{0.915932298f, 0.212759241f},
-std::array<float,2>{0.259895653f, 0.454649329f},
-std::array<float,2>{0.506367445f, 0.508656442f},
-std::array<float,2>{0.382609665f, 0.674801588f},
-std::array<float,2>{0.728080928f, 0.289594412f},
-std::array<float,2>{0.24563086f, 0.0352457948f},
-std::array<float,2>{0.859552443f, 0.821353018f},
-std::array<float,2>{0.318265706f, 0.773333132f},
-std::array<float,2>{0.590843022f, 0.116359115f},
-std::array<float,2>{0.0281553976f, 0.334715664f},
-std::array<float,2>{0.962416768f, 0.701862633f},
-std::array<float,2>{0.142122075f, 0.587867856f},
-std::array<float,2>{0.77978766f, 0.403142452f},
-std::array<float,2>{0.474963576f, 0.15958114f},
-std::array<float,2>{0.659667015f, 0.898356318f},
-std::array<float,2>{0.236066833f, 0.995195329f},
-std::array<float,2>{0.868990779f, 0.229339167f},
-std::array<float,2>{0.384375483f, 0.497049212f},
-std::array<float,2>{0.725390196f, 0.546790063f},
-std::array<float,2>{0.250253052f, 0.654538512f},
-std::array<float,2>{0.508799911f, 0.25165844f},
-std::array<float,2>{0.0768709406f, 0.00802256726f},
-std::array<float,2>{0.906557381f, 0.861102104f},
-std::array<float,2>{0.477898121f, 0.796084464f},
-std::array<float,2>{0.66742599f, 0.0779955834f},
-std::array<float,2>{0.152573153f, 0.370916277f},
-std::array<float,2>{0.770539284f, 0.74588871f},
-std::array<float,2>{0.0207320191f, 0.608011365f},
-std::array<float,2>{0.954538286f, 0.423137844f},
-std::array<float,2>{0.320685476f, 0.131607682f},
-std::array<float,2>{0.584631026f, 0.925420582f},
-std::array<float,2>{0.104248613f, 0.818929255f},
-std::array<float,2>{0.893601358f, 0.0392699875f},
-std::array<float,2>{0.309320897f, 0.28420046f},
-std::array<float,2>{0.545331955f, 0.682541251f},
-std::array<float,2>{0.430769235f, 0.505171657f},
-std::array<float,2>{0.699794292f, 0.462108821f},
-std::array<float,2>{0.208203197f, 0.204247758f},
-std::array<float,2>{0.833273828f, 0.948224485f},
-std::array<float,2>{0.346008271f, 0.903299689f},
-std::array<float,2>{0.596247077f, 0.166724458f},
-std::array<float,2>{0.0519910455f, 0.392157972f},
-std::array<float,2>{0.993820965f, 0.584498167f},
-std::array<float,2>{0.159174591f, 0.69412601f},
-std::array<float,2>{0.788503051f, 0.337669402f},
-std::array<float,2>{0.456949681f, 0.119131759f},
-std::array<float,2>{0.650958002f, 0.779283822f},
-std::array<float,2>{0.132155553f, 0.760874629f},
-std::array<float,2>{0.759122908f, 0.0989131778f},
-std::array<float,2>{0.486374319f, 0.317272753f},
-std::array<float,2>{0.686628103f, 0.705422223f},
-std::array<float,2>{0.335470051f, 0.56353122f},
-std::array<float,2>{0.563444614f, 0.387390256f},
-std::array<float,2>{0.00655062823f, 0.173279732f},
-std::array<float,2>{0.946225405f, 0.887993336f},
-std::array<float,2>{0.397819996f, 0.962046087f},
-std::array<float,2>{0.749467432f, 0.190121934f},
-std::array<float,2>{0.226586685f, 0.442047834f},
-std::array<float,2>{0.845033526f, 0.517483473f},
-std::array<float,2>{0.0827515647f, 0.668724597f},
-std::array<float,2>{0.927035213f, 0.310655028f},
-std::array<float,2>{0.269296795f, 0.0556377359f},
-std::array<float,2>{0.519172847f, 0.835072815f},
-std::array<float,2>{0.0351976641f, 0.919014931f},
-std::array<float,2>{0.972268164f, 0.14552325f},
-std::array<float,2>{0.363432169f, 0.406327665f},
-std::array<float,2>{0.619817317f, 0.624160469f},
-std::array<float,2>{0.442971766f, 0.724675298f},
-std::array<float,2>{0.634618759f, 0.351720959f},
-std::array<float,2>{0.183934093f, 0.0787673891f},
-std::array<float,2>{0.798094749f, 0.811792135f},
-std::array<float,2>{0.287406683f, 0.847984374f},
-std::array<float,2>{0.550438166f, 0.0248217434f},
-std::array<float,2>{0.114287414f, 0.266166091f},
-std::array<float,2>{0.882368863f, 0.63176322f},
-std::array<float,2>{0.187689513f, 0.553409755f},
-std::array<float,2>{0.825453341f, 0.480977684f},
-std::array<float,2>{0.41188553f, 0.239896581f},
-std::array<float,2>{0.706723511f, 0.970104396f},
-std::array<float,2>{0.16100359f, 0.982942939f},
-std::array<float,2>{0.782239199f, 0.24555786f},
-std::array<float,2>{0.460680395f, 0.469888717f},
-std::array<float,2>{0.654611707f, 0.557150066f},
-std::array<float,2>{0.349419594f, 0.635177135f},
-std::array<float,2>{0.599388897f, 0.279726207f},
-std::array<float,2>{0.0500658713f, 0.0215238668f},
-std::array<float,2>{0.99908644f, 0.856433928f},
-std::array<float,2>{0.435294658f, 0.80161041f},
-std::array<float,2>{0.698019981f, 0.0865024403f},
-std::array<float,2>{0.204414114f, 0.351290852f},
-std::array<float,2>{0.829554975f, 0.732025564f},
-std::array<float,2>{0.10908851f, 0.609513342f},
-std::array<float,2>{0.896650314f, 0.418573916f},
-std::array<float,2>{0.308459401f, 0.153468654f},
-std::array<float,2>{0.540975213f, 0.906465232f},
-std::array<float,2>{0.0189177189f, 0.836822569f},
-std::array<float,2>{0.958483815f, 0.0489248186f},
-std::array<float,2>{0.327828199f, 0.302573442f},
-std::array<float,2>{0.580177188f, 0.663527846f},
-std::array<float,2>{0.483553231f, 0.529772341f},
-std::array<float,2>{0.671265841f, 0.452652633f},
-std::array<float,2>{0.149475306f, 0.20228529f},
-std::array<float,2>{0.767171264f, 0.953413665f},
-std::array<float,2>{0.25440225f, 0.878426909f},
-std::array<float,2>{0.512841821f, 0.182128102f},
-std::array<float,2>{0.0728746504f, 0.379290462f},
-std::array<float,2>{0.912830174f, 0.577091575f},
-std::array<float,2>{0.240039438f, 0.711182833f},
-std::array<float,2>{0.874173164f, 0.322212756f},
-std::array<float,2>{0.388114035f, 0.101588607f},
-std::array<float,2>{0.721848488f, 0.755761325f},
-std::array<float,2>{0.192816377f, 0.765928924f},
-std::array<float,2>{0.820815563f, 0.109452151f},
-std::array<float,2>{0.406989932f, 0.330099761f},
-std::array<float,2>{0.710201085f, 0.696154535f},
-std::array<float,2>{0.285003781f, 0.59298867f},
-std::array<float,2>{0.554012477f, 0.399994314f},
-std::array<float,2>{0.112669051f, 0.162428305f},
-std::array<float,2>{0.87582916f, 0.890687287f},
-std::array<float,2>{0.438207924f, 0.940653384f},
-std::array<float,2>{0.636853933f, 0.215937465f},
-std::array<float,2>{0.181435093f, 0.46024546f},
-std::array<float,2>{0.803008795f, 0.515413642f},
-std::array<float,2>{0.0325658955f, 0.677970767f},
-std::array<float,2>{0.97344619f, 0.295185089f},
-std::array<float,2>{0.359911531f, 0.034116663f},
-std::array<float,2>{0.622807801f, 0.824702084f},
-std::array<float,2>{0.0782056078f, 0.932007015f},
-std::array<float,2>{0.922010422f, 0.133753896f},
-std::array<float,2>{0.273369074f, 0.43735829f},
-std::array<float,2>{0.521719992f, 0.59643966f},
-std::array<float,2>{0.393928766f, 0.741462767f},
-std::array<float,2>{0.742268384f, 0.359940499f},
-std::array<float,2>{0.23160024f, 0.0701239929f},
-std::array<float,2>{0.851344347f, 0.78668505f},
-std::array<float,2>{0.329334974f, 0.873918533f},
-std::array<float,2>{0.566899121f, 0.00125265692f},
-std::array<float,2>{0.00158830197f, 0.258727342f},
-std::array<float,2>{0.952538729f, 0.643924475f},
-std::array<float,2>{0.12659277f, 0.538146794f},
-std::array<float,2>{0.765583754f, 0.48745659f},
-std::array<float,2>{0.490925819f, 0.220659956f},
-std::array<float,2>{0.680142105f, 0.985639155f},
-std::array<float,2>{0.222701952f, 0.900284469f},
-std::array<float,2>{0.852395892f, 0.170053557f},
-std::array<float,2>{0.398813456f, 0.396355689f},
-std::array<float,2>{0.741188586f, 0.581006169f},
-std::array<float,2>{0.279464036f, 0.690859973f},
-std::array<float,2>{0.530746222f, 0.342890352f},
-std::array<float,2>{0.0872664005f, 0.124890134f},
-std::array<float,2>{0.932606876f, 0.776373267f},
-std::array<float,2>{0.495350748f, 0.814696968f},
-std::array<float,2>{0.674667299f, 0.0439896397f},
-std::array<float,2>{0.136207208f, 0.289037585f},
-std::array<float,2>{0.752158999f, 0.684289515f},
-std::array<float,2>{0.0133020151f, 0.503142297f},
-std::array<float,2>{0.943059385f, 0.468301028f},
-std::array<float,2>{0.338822365f, 0.210638121f},
-std::array<float,2>{0.574744701f, 0.95003289f},
-std::array<float,2>{0.124010488f, 0.789528906f},
-std::array<float,2>{0.885656595f, 0.0727840737f},
-std::array<float,2>{0.290914536f, 0.372605175f},
-std::array<float,2>{0.556900561f, 0.747451842f},
-std::array<float,2>{0.418404251f, 0.602195799f},
-std::array<float,2>{0.713263392f, 0.428504586f},
-std::array<float,2>{0.20285143f, 0.12551479f},
-std::array<float,2>{0.819417119f, 0.929279745f},
-std::array<float,2>{0.372681111f, 0.996167541f},
-std::array<float,2>{0.612110436f, 0.233895972f},
-std::array<float,2>{0.0399780013f, 0.494842976f},
-std::array<float,2>{0.97713989f, 0.542310059f},
-std::array<float,2>{0.175404847f, 0.650279522f},
-std::array<float,2>{0.811087608f, 0.25617367f},
-std::array<float,2>{0.445885777f, 0.0153226443f},
-std::array<float,2>{0.630329907f, 0.864550829f},
-std::array<float,2>{0.147354946f, 0.846224368f},
-std::array<float,2>{0.775230944f, 0.0273898039f},
-std::array<float,2>{0.469622165f, 0.271503389f},
-std::array<float,2>{0.66050756f, 0.628642797f},
-std::array<float,2>{0.313215584f, 0.548244834f},
-std::array<float,2>{0.586533725f, 0.478961647f},
-std::array<float,2>{0.0246619713f, 0.235579491f},
-std::array<float,2>{0.965263665f, 0.974892735f},
-std::array<float,2>{0.375846893f, 0.916836381f},
-std::array<float,2>{0.731391907f, 0.143485665f},
-std::array<float,2>{0.247281671f, 0.410916895f},
-std::array<float,2>{0.866122901f, 0.617467165f},
-std::array<float,2>{0.0698438436f, 0.719243228f},
-std::array<float,2>{0.919578731f, 0.358653367f},
-std::array<float,2>{0.262006074f, 0.0848121867f},
-std::array<float,2>{0.503516376f, 0.807355285f},
-std::array<float,2>{0.0619997345f, 0.965147674f},
-std::array<float,2>{0.987731397f, 0.194798782f},
-std::array<float,2>{0.35926196f, 0.439240694f},
-std::array<float,2>{0.607687533f, 0.52041024f},
-std::array<float,2>{0.466816187f, 0.665562272f},
-std::array<float,2>{0.648009002f, 0.308513433f},
-std::array<float,2>{0.168555558f, 0.0593849458f},
-std::array<float,2>{0.794831395f, 0.828545749f},
-std::array<float,2>{0.303157151f, 0.762406826f},
-std::array<float,2>{0.533874571f, 0.0952476636f},
-std::array<float,2>{0.0939872116f, 0.312714845f},
-std::array<float,2>{0.899749398f, 0.710150421f},
-std::array<float,2>{0.214704886f, 0.567754507f},
-std::array<float,2>{0.84002912f, 0.385423511f},
-std::array<float,2>{0.426676035f, 0.178492203f},
-std::array<float,2>{0.690213799f, 0.884582698f},
-std::array<float,2>{0.139558285f, 0.910238564f},
-std::array<float,2>{0.757631958f, 0.148833737f},
-std::array<float,2>{0.496568292f, 0.415414751f},
-std::array<float,2>{0.677131414f, 0.614273965f},
-std::array<float,2>{0.340108156f, 0.727064908f},
-std::array<float,2>{0.572887957f, 0.346466869f},
-std::array<float,2>{0.00987245142f, 0.0936660096f},
-std::array<float,2>{0.940044463f, 0.798889756f},
-std::array<float,2>{0.404349446f, 0.854227543f},
-std::array<float,2>{0.73577112f, 0.0164395049f},
-std::array<float,2>{0.21974656f, 0.275371611f},
-std::array<float,2>{0.859217584f, 0.637928247f},
-std::array<float,2>{0.0932039469f, 0.559622943f},
-std::array<float,2>{0.934635997f, 0.472893715f},
-std::array<float,2>{0.27437377f, 0.249437764f},
-std::array<float,2>{0.527324855f, 0.978927672f},
-std::array<float,2>{0.04400279f, 0.75228554f},
-std::array<float,2>{0.981242597f, 0.105891936f},
-std::array<float,2>{0.369081587f, 0.326730818f},
-std::array<float,2>{0.616303921f, 0.716633499f},
-std::array<float,2>{0.450418383f, 0.572129786f},
-std::array<float,2>{0.625891924f, 0.376261413f},
-std::array<float,2>{0.177174315f, 0.186920285f},
-std::array<float,2>{0.804788113f, 0.879180908f},
-std::array<float,2>{0.296359211f, 0.960858345f},
-std::array<float,2>{0.561096787f, 0.197639927f},
-std::array<float,2>{0.117815703f, 0.448841512f},
-std::array<float,2>{0.887621403f, 0.525923252f},
-std::array<float,2>{0.197396353f, 0.659330666f},
-std::array<float,2>{0.814085126f, 0.298236758f},
-std::array<float,2>{0.417785704f, 0.0524702705f},
-std::array<float,2>{0.716699421f, 0.841590643f},
-std::array<float,2>{0.243631706f, 0.824065804f},
-std::array<float,2>{0.863061547f, 0.03855028f},
-std::array<float,2>{0.379307657f, 0.292226881f},
-std::array<float,2>{0.728945196f, 0.673585176f},
-std::array<float,2>{0.259102225f, 0.51089853f},
-std::array<float,2>{0.504031181f, 0.456110239f},
-std::array<float,2>{0.0628746897f, 0.213162929f},
-std::array<float,2>{0.916650593f, 0.944264591f},
-std::array<float,2>{0.473608106f, 0.89587152f},
-std::array<float,2>{0.658199787f, 0.157818958f},
-std::array<float,2>{0.14433971f, 0.405939072f},
-std::array<float,2>{0.777633965f, 0.589611351f},
-std::array<float,2>{0.0306782722f, 0.699911416f},
-std::array<float,2>{0.96425277f, 0.332530528f},
-std::array<float,2>{0.319639266f, 0.114612713f},
-std::array<float,2>{0.592013597f, 0.771447718f},
-std::array<float,2>{0.101292752f, 0.991269886f},
-std::array<float,2>{0.904283822f, 0.225080699f},
-std::array<float,2>{0.298981458f, 0.491931796f},
-std::array<float,2>{0.537280619f, 0.532012939f},
-std::array<float,2>{0.422374576f, 0.645169079f},
-std::array<float,2>{0.691554904f, 0.265291214f},
-std::array<float,2>{0.218400478f, 0.00762710907f},
-std::array<float,2>{0.838844955f, 0.869797647f},
-std::array<float,2>{0.354009926f, 0.784917593f},
-std::array<float,2>{0.603422165f, 0.0659597367f},
-std::array<float,2>{0.0573423095f, 0.366819024f},
-std::array<float,2>{0.989715576f, 0.734461725f},
-std::array<float,2>{0.165422708f, 0.601398528f},
-std::array<float,2>{0.791950762f, 0.431831092f},
-std::array<float,2>{0.463511765f, 0.136792019f},
-std::array<float,2>{0.642678142f, 0.935513914f},
-std::array<float,2>{0.209378183f, 0.945329368f},
-std::array<float,2>{0.835511923f, 0.206858531f},
-std::array<float,2>{0.433515996f, 0.462943852f},
-std::array<float,2>{0.70282495f, 0.506549478f},
-std::array<float,2>{0.311109483f, 0.681535304f},
-std::array<float,2>{0.544169188f, 0.28174594f},
-std::array<float,2>{0.102178857f, 0.041565448f},
-std::array<float,2>{0.891616046f, 0.817550242f},
-std::array<float,2>{0.453145802f, 0.780250192f},
-std::array<float,2>{0.648556411f, 0.120826542f},
-std::array<float,2>{0.15805456f, 0.338145643f},
-std::array<float,2>{0.786629617f, 0.692587554f},
-std::array<float,2>{0.0539500862f, 0.582495153f},
-std::array<float,2>{0.995855451f, 0.393367082f},
-std::array<float,2>{0.34539786f, 0.165009543f},
-std::array<float,2>{0.595140755f, 0.904865921f},
-std::array<float,2>{0.0749777853f, 0.862494588f},
-std::array<float,2>{0.908272564f, 0.00981287099f},
-std::array<float,2>{0.25267297f, 0.252890766f},
-std::array<float,2>{0.511397958f, 0.653805017f},
-std::array<float,2>{0.385149717f, 0.544405103f},
-std::array<float,2>{0.723619878f, 0.498652846f},
-std::array<float,2>{0.236487046f, 0.227519497f},
-std::array<float,2>{0.870691776f, 0.992711902f},
-std::array<float,2>{0.323995411f, 0.922702491f},
-std::array<float,2>{0.582752407f, 0.130624384f},
-std::array<float,2>{0.0232440606f, 0.423999012f},
-std::array<float,2>{0.955928087f, 0.606168091f},
-std::array<float,2>{0.155622974f, 0.743792474f},
-std::array<float,2>{0.77316767f, 0.368964583f},
-std::array<float,2>{0.479974985f, 0.0757018849f},
-std::array<float,2>{0.66554904f, 0.794354141f},
-std::array<float,2>{0.185853958f, 0.80892837f},
-std::array<float,2>{0.799677908f, 0.0802683756f},
-std::array<float,2>{0.444302171f, 0.354398698f},
-std::array<float,2>{0.634863198f, 0.724470615f},
-std::array<float,2>{0.365352988f, 0.621386111f},
-std::array<float,2>{0.617470801f, 0.408477426f},
-std::array<float,2>{0.038210202f, 0.148358688f},
-std::array<float,2>{0.969544947f, 0.921176076f},
-std::array<float,2>{0.412648916f, 0.972128093f},
-std::array<float,2>{0.70407474f, 0.240840912f},
-std::array<float,2>{0.189959943f, 0.483696073f},
-std::array<float,2>{0.826735854f, 0.551629901f},
-std::array<float,2>{0.116921775f, 0.630201578f},
-std::array<float,2>{0.880712509f, 0.268553138f},
-std::array<float,2>{0.285527587f, 0.0264367741f},
-std::array<float,2>{0.548706472f, 0.849673212f},
-std::array<float,2>{0.00420161523f, 0.889620662f},
-std::array<float,2>{0.948403716f, 0.174802333f},
-std::array<float,2>{0.332713813f, 0.388905257f},
-std::array<float,2>{0.564556181f, 0.564777792f},
-std::array<float,2>{0.484384358f, 0.703870595f},
-std::array<float,2>{0.684734583f, 0.318746418f},
-std::array<float,2>{0.130207554f, 0.100996569f},
-std::array<float,2>{0.761610985f, 0.759730935f},
-std::array<float,2>{0.267561853f, 0.832870066f},
-std::array<float,2>{0.516688347f, 0.0569180436f},
-std::array<float,2>{0.0857154652f, 0.309078813f},
-std::array<float,2>{0.927959144f, 0.671606958f},
-std::array<float,2>{0.229915649f, 0.518511057f},
-std::array<float,2>{0.846819878f, 0.444024652f},
-std::array<float,2>{0.395258725f, 0.188527197f},
-std::array<float,2>{0.747614741f, 0.963283062f},
-std::array<float,2>{0.167977497f, 0.968086123f},
-std::array<float,2>{0.794051528f, 0.192457214f},
-std::array<float,2>{0.467627764f, 0.440773159f},
-std::array<float,2>{0.647475064f, 0.522558212f},
-std::array<float,2>{0.35872665f, 0.667338789f},
-std::array<float,2>{0.608141661f, 0.305744499f},
-std::array<float,2>{0.062144246f, 0.06172622f},
-std::array<float,2>{0.988132596f, 0.831369758f},
-std::array<float,2>{0.426180631f, 0.763943613f},
-std::array<float,2>{0.689774632f, 0.0969569832f},
-std::array<float,2>{0.214064553f, 0.316060543f},
-std::array<float,2>{0.840352833f, 0.708361387f},
-std::array<float,2>{0.0942707583f, 0.569180071f},
-std::array<float,2>{0.900201261f, 0.383652776f},
-std::array<float,2>{0.303405136f, 0.175905645f},
-std::array<float,2>{0.533302009f, 0.884914041f},
-std::array<float,2>{0.024988642f, 0.84385705f},
-std::array<float,2>{0.965799153f, 0.03086848f},
-std::array<float,2>{0.312708706f, 0.269578665f},
-std::array<float,2>{0.586117387f, 0.626479745f},
-std::array<float,2>{0.469180316f, 0.549489319f},
-std::array<float,2>{0.660886467f, 0.478077292f},
-std::array<float,2>{0.146674544f, 0.237016618f},
-std::array<float,2>{0.774856389f, 0.973797023f},
-std::array<float,2>{0.262290686f, 0.915097177f},
-std::array<float,2>{0.503020406f, 0.140804157f},
-std::array<float,2>{0.0697100163f, 0.413987249f},
-std::array<float,2>{0.919262767f, 0.620483041f},
-std::array<float,2>{0.247772917f, 0.722368658f},
-std::array<float,2>{0.865606785f, 0.356749266f},
-std::array<float,2>{0.375474066f, 0.0834476277f},
-std::array<float,2>{0.730862021f, 0.806167543f},
-std::array<float,2>{0.202629089f, 0.791493773f},
-std::array<float,2>{0.820119083f, 0.0717782453f},
-std::array<float,2>{0.418501645f, 0.374271721f},
-std::array<float,2>{0.713835001f, 0.748260915f},
-std::array<float,2>{0.29012838f, 0.605468571f},
-std::array<float,2>{0.55714345f, 0.426402092f},
-std::array<float,2>{0.123393103f, 0.128700107f},
-std::array<float,2>{0.884872854f, 0.927367985f},
-std::array<float,2>{0.445636153f, 0.999750674f},
-std::array<float,2>{0.630762935f, 0.23124972f},
-std::array<float,2>{0.174990013f, 0.494013101f},
-std::array<float,2>{0.810698509f, 0.539198339f},
-std::array<float,2>{0.0392873734f, 0.650831819f},
-std::array<float,2>{0.976685464f, 0.255780578f},
-std::array<float,2>{0.372161955f, 0.0133215208f},
-std::array<float,2>{0.611758411f, 0.867044151f},
-std::array<float,2>{0.0875369236f, 0.901903272f},
-std::array<float,2>{0.931660652f, 0.168264076f},
-std::array<float,2>{0.280054182f, 0.397324502f},
-std::array<float,2>{0.531073749f, 0.579756975f},
-std::array<float,2>{0.399302214f, 0.689345896f},
-std::array<float,2>{0.740492225f, 0.340944976f},
-std::array<float,2>{0.223475561f, 0.123027697f},
-std::array<float,2>{0.851568222f, 0.774547994f},
-std::array<float,2>{0.338345766f, 0.813890398f},
-std::array<float,2>{0.574416637f, 0.0452938117f},
-std::array<float,2>{0.0129357232f, 0.285905361f},
-std::array<float,2>{0.942733407f, 0.685875118f},
-std::array<float,2>{0.136361256f, 0.50122112f},
-std::array<float,2>{0.752673864f, 0.46600464f},
-std::array<float,2>{0.495720178f, 0.207237616f},
-std::array<float,2>{0.674117029f, 0.952418506f},
-std::array<float,2>{0.232039019f, 0.930030465f},
-std::array<float,2>{0.850840032f, 0.135922968f},
-std::array<float,2>{0.394430518f, 0.433737785f},
-std::array<float,2>{0.742722392f, 0.595661402f},
-std::array<float,2>{0.272548527f, 0.740218043f},
-std::array<float,2>{0.522214413f, 0.361345679f},
-std::array<float,2>{0.0790462494f, 0.0671389699f},
-std::array<float,2>{0.922459185f, 0.788874269f},
-std::array<float,2>{0.490431309f, 0.872730851f},
-std::array<float,2>{0.680511773f, 0.00255600642f},
-std::array<float,2>{0.126011759f, 0.260857224f},
-std::array<float,2>{0.764923811f, 0.640851855f},
-std::array<float,2>{0.00131612655f, 0.536112607f},
-std::array<float,2>{0.952927709f, 0.486125559f},
-std::array<float,2>{0.329783797f, 0.222243398f},
-std::array<float,2>{0.566827118f, 0.986553669f},
-std::array<float,2>{0.11297638f, 0.769497871f},
-std::array<float,2>{0.875070274f, 0.112917513f},
-std::array<float,2>{0.284357727f, 0.328769654f},
-std::array<float,2>{0.554323614f, 0.697993994f},
-std::array<float,2>{0.406266063f, 0.590213299f},
-std::array<float,2>{0.710557222f, 0.401805222f},
-std::array<float,2>{0.19333066f, 0.160169467f},
-std::array<float,2>{0.820336223f, 0.893131137f},
-std::array<float,2>{0.359795034f, 0.937847674f},
-std::array<float,2>{0.622488856f, 0.217625126f},
-std::array<float,2>{0.0331232138f, 0.457147986f},
-std::array<float,2>{0.972984493f, 0.51259464f},
-std::array<float,2>{0.18108882f, 0.675857246f},
-std::array<float,2>{0.803310931f, 0.294076949f},
-std::array<float,2>{0.437969267f, 0.0321680866f},
-std::array<float,2>{0.637242734f, 0.827062011f},
-std::array<float,2>{0.150372341f, 0.839058697f},
-std::array<float,2>{0.766943336f, 0.0474238135f},
-std::array<float,2>{0.483924359f, 0.304201782f},
-std::array<float,2>{0.67140013f, 0.661048532f},
-std::array<float,2>{0.327519298f, 0.528967083f},
-std::array<float,2>{0.581053615f, 0.449549913f},
-std::array<float,2>{0.0193337463f, 0.19929564f},
-std::array<float,2>{0.958719492f, 0.95514065f},
-std::array<float,2>{0.388507396f, 0.876219094f},
-std::array<float,2>{0.722443402f, 0.180126965f},
-std::array<float,2>{0.239559576f, 0.380900115f},
-std::array<float,2>{0.874703944f, 0.575018406f},
-std::array<float,2>{0.0722719729f, 0.713500321f},
-std::array<float,2>{0.912434399f, 0.323652774f},
-std::array<float,2>{0.25436154f, 0.103521273f},
-std::array<float,2>{0.513564825f, 0.756903827f},
-std::array<float,2>{0.0506766774f, 0.982251465f},
-std::array<float,2>{0.999643207f, 0.242312282f},
-std::array<float,2>{0.348997146f, 0.471263021f},
-std::array<float,2>{0.599072456f, 0.555663049f},
-std::array<float,2>{0.460327774f, 0.633656025f},
-std::array<float,2>{0.654973328f, 0.278873891f},
-std::array<float,2>{0.16054301f, 0.0206211731f},
-std::array<float,2>{0.782943726f, 0.858144462f},
-std::array<float,2>{0.307629526f, 0.804330885f},
-std::array<float,2>{0.540139556f, 0.0882776901f},
-std::array<float,2>{0.10870827f, 0.347711623f},
-std::array<float,2>{0.897307694f, 0.732914269f},
-std::array<float,2>{0.204617754f, 0.611742973f},
-std::array<float,2>{0.829622626f, 0.421413958f},
-std::array<float,2>{0.435004056f, 0.154565156f},
-std::array<float,2>{0.697289288f, 0.908880353f},
-std::array<float,2>{0.130847901f, 0.888437629f},
-std::array<float,2>{0.761063933f, 0.173387706f},
-std::array<float,2>{0.485303104f, 0.38685748f},
-std::array<float,2>{0.685459733f, 0.564002037f},
-std::array<float,2>{0.332210183f, 0.705692708f},
-std::array<float,2>{0.564952493f, 0.316631883f},
-std::array<float,2>{0.00458935555f, 0.0993179902f},
-std::array<float,2>{0.948967516f, 0.761588752f},
-std::array<float,2>{0.394685388f, 0.83585453f},
-std::array<float,2>{0.747344315f, 0.0550432727f},
-std::array<float,2>{0.230051234f, 0.311205447f},
-std::array<float,2>{0.847303987f, 0.668179393f},
-std::array<float,2>{0.0851587355f, 0.516618192f},
-std::array<float,2>{0.928520739f, 0.441739678f},
-std::array<float,2>{0.266792327f, 0.189763427f},
-std::array<float,2>{0.517544806f, 0.962560892f},
-std::array<float,2>{0.0387345366f, 0.812292755f},
-std::array<float,2>{0.969059229f, 0.0782639384f},
-std::array<float,2>{0.365750194f, 0.352403641f},
-std::array<float,2>{0.618101358f, 0.725159287f},
-std::array<float,2>{0.443558574f, 0.624548197f},
-std::array<float,2>{0.635418177f, 0.407183319f},
-std::array<float,2>{0.186451524f, 0.146405563f},
-std::array<float,2>{0.798924685f, 0.919850051f},
-std::array<float,2>{0.286009371f, 0.970527828f},
-std::array<float,2>{0.547996759f, 0.239273027f},
-std::array<float,2>{0.116654254f, 0.480891615f},
-std::array<float,2>{0.880118132f, 0.553208292f},
-std::array<float,2>{0.189793646f, 0.631127596f},
-std::array<float,2>{0.82656616f, 0.266026944f},
-std::array<float,2>{0.412479997f, 0.0249761175f},
-std::array<float,2>{0.703155279f, 0.848291039f},
-std::array<float,2>{0.236872703f, 0.860799074f},
-std::array<float,2>{0.870493233f, 0.00837765541f},
-std::array<float,2>{0.385660827f, 0.251341969f},
-std::array<float,2>{0.722759485f, 0.655045986f},
-std::array<float,2>{0.252003521f, 0.546089709f},
-std::array<float,2>{0.511129737f, 0.496242166f},
-std::array<float,2>{0.0743459165f, 0.228994459f},
-std::array<float,2>{0.908784389f, 0.996076286f},
-std::array<float,2>{0.48046872f, 0.924984276f},
-std::array<float,2>{0.665462077f, 0.13107039f},
-std::array<float,2>{0.156118169f, 0.423388004f},
-std::array<float,2>{0.772696853f, 0.607604742f},
-std::array<float,2>{0.0227085929f, 0.745598018f},
-std::array<float,2>{0.955487669f, 0.370390117f},
-std::array<float,2>{0.323257565f, 0.0773076788f},
-std::array<float,2>{0.582123518f, 0.79649502f},
-std::array<float,2>{0.102042653f, 0.947728932f},
-std::array<float,2>{0.892282367f, 0.204600275f},
-std::array<float,2>{0.310791343f, 0.462773621f},
-std::array<float,2>{0.544597805f, 0.505457938f},
-std::array<float,2>{0.43279022f, 0.681952834f},
-std::array<float,2>{0.702545106f, 0.284821361f},
-std::array<float,2>{0.209855467f, 0.039886754f},
-std::array<float,2>{0.835444331f, 0.818804979f},
-std::array<float,2>{0.344821543f, 0.778708875f},
-std::array<float,2>{0.595414698f, 0.118173935f},
-std::array<float,2>{0.054327447f, 0.336999387f},
-std::array<float,2>{0.995211661f, 0.693765938f},
-std::array<float,2>{0.157366291f, 0.584177732f},
-std::array<float,2>{0.786444128f, 0.391745061f},
-std::array<float,2>{0.453713745f, 0.166042596f},
-std::array<float,2>{0.649376035f, 0.902397573f},
-std::array<float,2>{0.217840999f, 0.988843143f},
-std::array<float,2>{0.838355243f, 0.224059016f},
-std::array<float,2>{0.421919584f, 0.489924073f},
-std::array<float,2>{0.692285419f, 0.534345269f},
-std::array<float,2>{0.299589932f, 0.648047268f},
-std::array<float,2>{0.537778974f, 0.263670892f},
-std::array<float,2>{0.100801684f, 0.00498442631f},
-std::array<float,2>{0.903552115f, 0.867607594f},
-std::array<float,2>{0.462986857f, 0.782224953f},
-std::array<float,2>{0.643184602f, 0.0642770231f},
-std::array<float,2>{0.165675685f, 0.363357216f},
-std::array<float,2>{0.791405201f, 0.737938821f},
-std::array<float,2>{0.0570569634f, 0.599255919f},
-std::array<float,2>{0.989986002f, 0.430796891f},
-std::array<float,2>{0.353929073f, 0.139394239f},
-std::array<float,2>{0.602958262f, 0.935638726f},
-std::array<float,2>{0.0633500293f, 0.821861982f},
-std::array<float,2>{0.916390717f, 0.0359372646f},
-std::array<float,2>{0.259363532f, 0.289167821f},
-std::array<float,2>{0.504478276f, 0.674023271f},
-std::array<float,2>{0.379404336f, 0.507972658f},
-std::array<float,2>{0.72915566f, 0.454423785f},
-std::array<float,2>{0.243809626f, 0.211970985f},
-std::array<float,2>{0.862421155f, 0.942360938f},
-std::array<float,2>{0.319999754f, 0.897479713f},
-std::array<float,2>{0.592732668f, 0.160073906f},
-std::array<float,2>{0.0308829676f, 0.402473569f},
-std::array<float,2>{0.964640915f, 0.587022781f},
-std::array<float,2>{0.143671215f, 0.701266587f},
-std::array<float,2>{0.778190374f, 0.334088057f},
-std::array<float,2>{0.472671419f, 0.116955638f},
-std::array<float,2>{0.657430947f, 0.772557676f},
-std::array<float,2>{0.177716002f, 0.750097692f},
-std::array<float,2>{0.805336177f, 0.109349504f},
-std::array<float,2>{0.45072937f, 0.324784786f},
-std::array<float,2>{0.625057399f, 0.716876686f},
-std::array<float,2>{0.368288428f, 0.574075222f},
-std::array<float,2>{0.616892338f, 0.377525538f},
-std::array<float,2>{0.0449008308f, 0.185216248f},
-std::array<float,2>{0.98077178f, 0.881186962f},
-std::array<float,2>{0.417251766f, 0.957035601f},
-std::array<float,2>{0.715865791f, 0.196067199f},
-std::array<float,2>{0.19781974f, 0.446845591f},
-std::array<float,2>{0.813653529f, 0.524464071f},
-std::array<float,2>{0.117581591f, 0.657955945f},
-std::array<float,2>{0.886797726f, 0.299274743f},
-std::array<float,2>{0.296786278f, 0.0532607213f},
-std::array<float,2>{0.560667813f, 0.843310177f},
-std::array<float,2>{0.0105557814f, 0.912219405f},
-std::array<float,2>{0.939564705f, 0.152333751f},
-std::array<float,2>{0.340348661f, 0.417382747f},
-std::array<float,2>{0.57246244f, 0.615678847f},
-std::array<float,2>{0.496968269f, 0.728661835f},
-std::array<float,2>{0.677661061f, 0.344918251f},
-std::array<float,2>{0.138881028f, 0.0912538618f},
-std::array<float,2>{0.757323384f, 0.796902895f},
-std::array<float,2>{0.273867667f, 0.852899909f},
-std::array<float,2>{0.526617408f, 0.0182231013f},
-std::array<float,2>{0.0935600996f, 0.276564479f},
-std::array<float,2>{0.935415626f, 0.639835656f},
-std::array<float,2>{0.220653266f, 0.561598361f},
-std::array<float,2>{0.858733714f, 0.475569665f},
-std::array<float,2>{0.405122578f, 0.246357128f},
-std::array<float,2>{0.735855401f, 0.977050722f},
-std::array<float,2>{0.146473095f, 0.975288033f},
-std::array<float,2>{0.777075469f, 0.235871315f},
-std::array<float,2>{0.471014589f, 0.479080617f},
-std::array<float,2>{0.663910449f, 0.548735857f},
-std::array<float,2>{0.31502682f, 0.628054023f},
-std::array<float,2>{0.589166164f, 0.272319973f},
-std::array<float,2>{0.0269303806f, 0.0282705184f},
-std::array<float,2>{0.967450738f, 0.846063852f},
-std::array<float,2>{0.37743181f, 0.806923866f},
-std::array<float,2>{0.734249234f, 0.0841729194f},
-std::array<float,2>{0.248421922f, 0.359023005f},
-std::array<float,2>{0.864030123f, 0.719168603f},
-std::array<float,2>{0.0664336458f, 0.618125737f},
-std::array<float,2>{0.920938253f, 0.410500675f},
-std::array<float,2>{0.26487577f, 0.14260444f},
-std::array<float,2>{0.501103878f, 0.91602093f},
-std::array<float,2>{0.059992671f, 0.82897681f},
-std::array<float,2>{0.985388219f, 0.0589908548f},
-std::array<float,2>{0.355710655f, 0.307740867f},
-std::array<float,2>{0.606915951f, 0.665383577f},
-std::array<float,2>{0.466617882f, 0.519583344f},
-std::array<float,2>{0.645235837f, 0.438653439f},
-std::array<float,2>{0.171408907f, 0.195137262f},
-std::array<float,2>{0.796684563f, 0.965442419f},
-std::array<float,2>{0.302044958f, 0.883853197f},
-std::array<float,2>{0.531795323f, 0.178108305f},
-std::array<float,2>{0.0957671627f, 0.385015577f},
-std::array<float,2>{0.901546121f, 0.568172157f},
-std::array<float,2>{0.21126166f, 0.710480928f},
-std::array<float,2>{0.841986597f, 0.313448727f},
-std::array<float,2>{0.42882514f, 0.094828032f},
-std::array<float,2>{0.687864125f, 0.762140095f},
-std::array<float,2>{0.225102633f, 0.777139306f},
-std::array<float,2>{0.854847014f, 0.12412113f},
-std::array<float,2>{0.401515782f, 0.343574554f},
-std::array<float,2>{0.73938036f, 0.691018701f},
-std::array<float,2>{0.278138131f, 0.580358088f},
-std::array<float,2>{0.527716935f, 0.395757437f},
-std::array<float,2>{0.0891572461f, 0.170685455f},
-std::array<float,2>{0.930120051f, 0.899576843f},
-std::array<float,2>{0.492326289f, 0.94964087f},
-std::array<float,2>{0.672481537f, 0.210174769f},
-std::array<float,2>{0.134132653f, 0.467881292f},
-std::array<float,2>{0.750586212f, 0.503500044f},
-std::array<float,2>{0.0137431938f, 0.683769047f},
-std::array<float,2>{0.94508028f, 0.288543016f},
-std::array<float,2>{0.336201489f, 0.0446384177f},
-std::array<float,2>{0.57713294f, 0.815158069f},
-std::array<float,2>{0.121124916f, 0.929156363f},
-std::array<float,2>{0.88293761f, 0.1253113f},
-std::array<float,2>{0.291206747f, 0.428015411f},
-std::array<float,2>{0.554984391f, 0.601798534f},
-std::array<float,2>{0.420817554f, 0.747906089f},
-std::array<float,2>{0.71228826f, 0.372206807f},
-std::array<float,2>{0.199509695f, 0.0724469721f},
-std::array<float,2>{0.818242848f, 0.789722681f},
-std::array<float,2>{0.3731125f, 0.864798009f},
-std::array<float,2>{0.610944211f, 0.0146790305f},
-std::array<float,2>{0.0424114093f, 0.256582528f},
-std::array<float,2>{0.978962123f, 0.64960736f},
-std::array<float,2>{0.173747137f, 0.542885423f},
-std::array<float,2>{0.809786022f, 0.49421528f},
-std::array<float,2>{0.44884038f, 0.233656868f},
-std::array<float,2>{0.63211143f, 0.996971846f},
-std::array<float,2>{0.194314569f, 0.891159892f},
-std::array<float,2>{0.823687434f, 0.162893981f},
-std::array<float,2>{0.409502894f, 0.399704427f},
-std::array<float,2>{0.707433581f, 0.59359026f},
-std::array<float,2>{0.281528473f, 0.695750177f},
-std::array<float,2>{0.552699029f, 0.330592602f},
-std::array<float,2>{0.10996557f, 0.110149331f},
-std::array<float,2>{0.877985418f, 0.766507506f},
-std::array<float,2>{0.441117346f, 0.824806571f},
-std::array<float,2>{0.639713764f, 0.0334713049f},
-std::array<float,2>{0.183583513f, 0.295761794f},
-std::array<float,2>{0.802410543f, 0.678382099f},
-std::array<float,2>{0.0348266251f, 0.514832139f},
-std::array<float,2>{0.975292325f, 0.460690588f},
-std::array<float,2>{0.361876756f, 0.216772407f},
-std::array<float,2>{0.623776793f, 0.941125393f},
-std::array<float,2>{0.0801809803f, 0.786244571f},
-std::array<float,2>{0.925580442f, 0.0695140436f},
-std::array<float,2>{0.27120766f, 0.359816581f},
-std::array<float,2>{0.521164954f, 0.741886616f},
-std::array<float,2>{0.391240388f, 0.596115291f},
-std::array<float,2>{0.74428612f, 0.436759144f},
-std::array<float,2>{0.233680099f, 0.132947221f},
-std::array<float,2>{0.847847164f, 0.932400823f},
-std::array<float,2>{0.331022799f, 0.986223042f},
-std::array<float,2>{0.568373382f, 0.219838411f},
-std::array<float,2>{0.00322844507f, 0.487938046f},
-std::array<float,2>{0.950558305f, 0.539056778f},
-std::array<float,2>{0.128707826f, 0.644082248f},
-std::array<float,2>{0.763037562f, 0.257891715f},
-std::array<float,2>{0.48851651f, 0.00186285947f},
-std::array<float,2>{0.683287501f, 0.873374283f},
-std::array<float,2>{0.163717464f, 0.855651736f},
-std::array<float,2>{0.784130514f, 0.0223419312f},
-std::array<float,2>{0.458300531f, 0.279879808f},
-std::array<float,2>{0.65356338f, 0.63567996f},
-std::array<float,2>{0.351539403f, 0.556659341f},
-std::array<float,2>{0.600949705f, 0.470421344f},
-std::array<float,2>{0.0483835936f, 0.24593623f},
-std::array<float,2>{0.996177495f, 0.982890427f},
-std::array<float,2>{0.435818851f, 0.907066405f},
-std::array<float,2>{0.695970297f, 0.154130116f},
-std::array<float,2>{0.205492601f, 0.418038875f},
-std::array<float,2>{0.830593526f, 0.610116899f},
-std::array<float,2>{0.10596963f, 0.731896758f},
-std::array<float,2>{0.895084202f, 0.350645274f},
-std::array<float,2>{0.304774523f, 0.0862071961f},
-std::array<float,2>{0.542219996f, 0.801175892f},
-std::array<float,2>{0.0166697726f, 0.953859091f},
-std::array<float,2>{0.959434807f, 0.202798024f},
-std::array<float,2>{0.324515462f, 0.452422738f},
-std::array<float,2>{0.578820109f, 0.529882789f},
-std::array<float,2>{0.481893748f, 0.663903713f},
-std::array<float,2>{0.66919601f, 0.301945299f},
-std::array<float,2>{0.150739402f, 0.0493260249f},
-std::array<float,2>{0.769401371f, 0.836129725f},
-std::array<float,2>{0.256783277f, 0.755038083f},
-std::array<float,2>{0.515116036f, 0.102324098f},
-std::array<float,2>{0.0711285621f, 0.321740568f},
-std::array<float,2>{0.910393059f, 0.711676002f},
-std::array<float,2>{0.242005497f, 0.576391757f},
-std::array<float,2>{0.871667862f, 0.379717886f},
-std::array<float,2>{0.388786405f, 0.182334885f},
-std::array<float,2>{0.719479144f, 0.878203392f},
-std::array<float,2>{0.184336632f, 0.921833336f},
-std::array<float,2>{0.798772335f, 0.147703394f},
-std::array<float,2>{0.442839682f, 0.408789486f},
-std::array<float,2>{0.634228349f, 0.621893466f},
-std::array<float,2>{0.36385718f, 0.723746121f},
-std::array<float,2>{0.619296074f, 0.353643775f},
-std::array<float,2>{0.0358190909f, 0.0810493156f},
-std::array<float,2>{0.971969664f, 0.809309185f},
-std::array<float,2>{0.411336601f, 0.850402057f},
-std::array<float,2>{0.706506371f, 0.0269371085f},
-std::array<float,2>{0.188210621f, 0.267928272f},
-std::array<float,2>{0.826164544f, 0.63050133f},
-std::array<float,2>{0.114747904f, 0.550844014f},
-std::array<float,2>{0.881871879f, 0.484310061f},
-std::array<float,2>{0.287931144f, 0.24037385f},
-std::array<float,2>{0.549920797f, 0.972363174f},
-std::array<float,2>{0.006059648f, 0.759078741f},
-std::array<float,2>{0.945605278f, 0.101538114f},
-std::array<float,2>{0.335108966f, 0.319050014f},
-std::array<float,2>{0.562932372f, 0.703153908f},
-std::array<float,2>{0.486906946f, 0.565334678f},
-std::array<float,2>{0.687058151f, 0.38949576f},
-std::array<float,2>{0.132750168f, 0.174010903f},
-std::array<float,2>{0.759436429f, 0.888938308f},
-std::array<float,2>{0.268790096f, 0.96361059f},
-std::array<float,2>{0.518755972f, 0.18902576f},
-std::array<float,2>{0.0822053179f, 0.443734914f},
-std::array<float,2>{0.927699924f, 0.517807543f},
-std::array<float,2>{0.227437347f, 0.671179354f},
-std::array<float,2>{0.845383286f, 0.309563875f},
-std::array<float,2>{0.398392588f, 0.057373628f},
-std::array<float,2>{0.749904811f, 0.832296848f},
-std::array<float,2>{0.208845407f, 0.817973912f},
-std::array<float,2>{0.833812714f, 0.0412108824f},
-std::array<float,2>{0.431408554f, 0.281516194f},
-std::array<float,2>{0.699701369f, 0.680743754f},
-std::array<float,2>{0.30864352f, 0.505874157f},
-std::array<float,2>{0.54572171f, 0.463803232f},
-std::array<float,2>{0.103799239f, 0.206433162f},
-std::array<float,2>{0.894380212f, 0.945852101f},
-std::array<float,2>{0.456124365f, 0.904480159f},
-std::array<float,2>{0.650841117f, 0.164176673f},
-std::array<float,2>{0.158655018f, 0.393041611f},
-std::array<float,2>{0.788706839f, 0.582859397f},
-std::array<float,2>{0.0522822812f, 0.693311334f},
-std::array<float,2>{0.99318558f, 0.338567168f},
-std::array<float,2>{0.346246332f, 0.1201315f},
-std::array<float,2>{0.595754623f, 0.779359937f},
-std::array<float,2>{0.076369904f, 0.992521822f},
-std::array<float,2>{0.906997919f, 0.226584584f},
-std::array<float,2>{0.250566155f, 0.498450071f},
-std::array<float,2>{0.50959003f, 0.544557989f},
-std::array<float,2>{0.384040207f, 0.65383482f},
-std::array<float,2>{0.725057125f, 0.251958549f},
-std::array<float,2>{0.23581031f, 0.0104493788f},
-std::array<float,2>{0.868389308f, 0.863071024f},
-std::array<float,2>{0.320932895f, 0.794519305f},
-std::array<float,2>{0.584178746f, 0.0752661079f},
-std::array<float,2>{0.0214469451f, 0.368338913f},
-std::array<float,2>{0.95490706f, 0.743274987f},
-std::array<float,2>{0.15284647f, 0.605554342f},
-std::array<float,2>{0.771405816f, 0.424618214f},
-std::array<float,2>{0.478486866f, 0.130001172f},
-std::array<float,2>{0.667527795f, 0.922078431f},
-std::array<float,2>{0.245322332f, 0.943504214f},
-std::array<float,2>{0.859900057f, 0.213517219f},
-std::array<float,2>{0.381850183f, 0.456990927f},
-std::array<float,2>{0.72775352f, 0.511697114f},
-std::array<float,2>{0.260514647f, 0.673189163f},
-std::array<float,2>{0.505964816f, 0.292889059f},
-std::array<float,2>{0.0653475896f, 0.0386395976f},
-std::array<float,2>{0.915201008f, 0.823265135f},
-std::array<float,2>{0.47533828f, 0.770823359f},
-std::array<float,2>{0.660097539f, 0.114902183f},
-std::array<float,2>{0.142045677f, 0.332319498f},
-std::array<float,2>{0.77936846f, 0.699488521f},
-std::array<float,2>{0.027418565f, 0.589228034f},
-std::array<float,2>{0.961922944f, 0.405285299f},
-std::array<float,2>{0.317449301f, 0.157477424f},
-std::array<float,2>{0.59172529f, 0.896002054f},
-std::array<float,2>{0.0993176997f, 0.869532704f},
-std::array<float,2>{0.904615521f, 0.00684686704f},
-std::array<float,2>{0.296943873f, 0.265003324f},
-std::array<float,2>{0.535827458f, 0.64472425f},
-std::array<float,2>{0.425078094f, 0.53142792f},
-std::array<float,2>{0.695162296f, 0.491562933f},
-std::array<float,2>{0.215891078f, 0.225235313f},
-std::array<float,2>{0.837734103f, 0.991699696f},
-std::array<float,2>{0.352241307f, 0.934849501f},
-std::array<float,2>{0.604508817f, 0.137508348f},
-std::array<float,2>{0.0549849644f, 0.432566345f},
-std::array<float,2>{0.990589559f, 0.600636125f},
-std::array<float,2>{0.166902751f, 0.73501575f},
-std::array<float,2>{0.789391756f, 0.366360009f},
-std::array<float,2>{0.461603254f, 0.0656140894f},
-std::array<float,2>{0.642497778f, 0.784592211f},
-std::array<float,2>{0.137074918f, 0.799687803f},
-std::array<float,2>{0.7548787f, 0.0928265229f},
-std::array<float,2>{0.499013454f, 0.345715463f},
-std::array<float,2>{0.679620981f, 0.726792276f},
-std::array<float,2>{0.342117727f, 0.615039289f},
-std::array<float,2>{0.571916938f, 0.415776759f},
-std::array<float,2>{0.00807706639f, 0.149153128f},
-std::array<float,2>{0.938466966f, 0.910794437f},
-std::array<float,2>{0.402397513f, 0.979334533f},
-std::array<float,2>{0.736912131f, 0.249717355f},
-std::array<float,2>{0.222067863f, 0.473251194f},
-std::array<float,2>{0.856210232f, 0.56007272f},
-std::array<float,2>{0.0905479267f, 0.638568103f},
-std::array<float,2>{0.936238468f, 0.274443328f},
-std::array<float,2>{0.275541186f, 0.0157463811f},
-std::array<float,2>{0.524760306f, 0.853857696f},
-std::array<float,2>{0.0461826324f, 0.879513085f},
-std::array<float,2>{0.982993186f, 0.187475324f},
-std::array<float,2>{0.369308412f, 0.376490682f},
-std::array<float,2>{0.614778996f, 0.571628332f},
-std::array<float,2>{0.452575952f, 0.716033936f},
-std::array<float,2>{0.628072977f, 0.326361597f},
-std::array<float,2>{0.178809837f, 0.105979487f},
-std::array<float,2>{0.808541238f, 0.752836883f},
-std::array<float,2>{0.293126255f, 0.8409006f},
-std::array<float,2>{0.558777213f, 0.0521395281f},
-std::array<float,2>{0.12058726f, 0.29858458f},
-std::array<float,2>{0.889709651f, 0.660047472f},
-std::array<float,2>{0.195323899f, 0.525538385f},
-std::array<float,2>{0.816322565f, 0.448566139f},
-std::array<float,2>{0.415279776f, 0.197822273f},
-std::array<float,2>{0.717688024f, 0.960365117f},
-std::array<float,2>{0.133149385f, 0.951626301f},
-std::array<float,2>{0.751058757f, 0.208766162f},
-std::array<float,2>{0.493414938f, 0.465377837f},
-std::array<float,2>{0.672975183f, 0.500359356f},
-std::array<float,2>{0.337096781f, 0.687034667f},
-std::array<float,2>{0.578116238f, 0.286749631f},
-std::array<float,2>{0.0155652035f, 0.0465096422f},
-std::array<float,2>{0.943967104f, 0.812686622f},
-std::array<float,2>{0.401313245f, 0.773780942f},
-std::array<float,2>{0.73921603f, 0.121429659f},
-std::array<float,2>{0.226069972f, 0.340428829f},
-std::array<float,2>{0.853889883f, 0.687633216f},
-std::array<float,2>{0.0885148793f, 0.578537405f},
-std::array<float,2>{0.930977166f, 0.397875696f},
-std::array<float,2>{0.278922319f, 0.169273987f},
-std::array<float,2>{0.528733373f, 0.900985956f},
-std::array<float,2>{0.0416803174f, 0.865658522f},
-std::array<float,2>{0.979537368f, 0.0123179434f},
-std::array<float,2>{0.37402609f, 0.254345328f},
-std::array<float,2>{0.609389663f, 0.651367843f},
-std::array<float,2>{0.447622776f, 0.540859938f},
-std::array<float,2>{0.631331623f, 0.492810696f},
-std::array<float,2>{0.172785491f, 0.231738642f},
-std::array<float,2>{0.809275925f, 0.998272359f},
-std::array<float,2>{0.29229188f, 0.925863802f},
-std::array<float,2>{0.556410849f, 0.127282664f},
-std::array<float,2>{0.122624867f, 0.427575439f},
-std::array<float,2>{0.884145021f, 0.603524268f},
-std::array<float,2>{0.200600341f, 0.749487698f},
-std::array<float,2>{0.816969395f, 0.373790234f},
-std::array<float,2>{0.421678096f, 0.0705823898f},
-std::array<float,2>{0.710979939f, 0.792843819f},
-std::array<float,2>{0.249804184f, 0.805108011f},
-std::array<float,2>{0.864972711f, 0.0826201886f},
-std::array<float,2>{0.378601879f, 0.355553329f},
-std::array<float,2>{0.733172774f, 0.721546054f},
-std::array<float,2>{0.264027685f, 0.619253993f},
-std::array<float,2>{0.500834644f, 0.412848145f},
-std::array<float,2>{0.0680621117f, 0.141960368f},
-std::array<float,2>{0.920729935f, 0.914821088f},
-std::array<float,2>{0.471938819f, 0.972880781f},
-std::array<float,2>{0.662112713f, 0.238023788f},
-std::array<float,2>{0.144548923f, 0.477461606f},
-std::array<float,2>{0.775846601f, 0.55052197f},
-std::array<float,2>{0.0263595879f, 0.625164092f},
-std::array<float,2>{0.968638182f, 0.271335781f},
-std::array<float,2>{0.315930694f, 0.0294287223f},
-std::array<float,2>{0.588743925f, 0.845166743f},
-std::array<float,2>{0.0969908312f, 0.886493444f},
-std::array<float,2>{0.900532305f, 0.17678085f},
-std::array<float,2>{0.301466048f, 0.384493619f},
-std::array<float,2>{0.532930195f, 0.570262134f},
-std::array<float,2>{0.428153723f, 0.707657099f},
-std::array<float,2>{0.688860178f, 0.314549983f},
-std::array<float,2>{0.212438494f, 0.0962595642f},
-std::array<float,2>{0.84290731f, 0.765063405f},
-std::array<float,2>{0.356919765f, 0.830825329f},
-std::array<float,2>{0.606261671f, 0.0605931766f},
-std::array<float,2>{0.058630161f, 0.30500409f},
-std::array<float,2>{0.984837413f, 0.666529834f},
-std::array<float,2>{0.170133695f, 0.52150768f},
-std::array<float,2>{0.795305669f, 0.440177798f},
-std::array<float,2>{0.465671271f, 0.192329988f},
-std::array<float,2>{0.645920634f, 0.967770517f},
-std::array<float,2>{0.206273228f, 0.909990847f},
-std::array<float,2>{0.831988513f, 0.156158224f},
-std::array<float,2>{0.437411726f, 0.420437753f},
-std::array<float,2>{0.697200358f, 0.612432599f},
-std::array<float,2>{0.306584984f, 0.733655512f},
-std::array<float,2>{0.541987896f, 0.349078506f},
-std::array<float,2>{0.107131138f, 0.0890054628f},
-std::array<float,2>{0.89635402f, 0.803696215f},
-std::array<float,2>{0.457445502f, 0.858481586f},
-std::array<float,2>{0.653233767f, 0.0199311506f},
-std::array<float,2>{0.163053438f, 0.277823031f},
-std::array<float,2>{0.784540653f, 0.63462311f},
-std::array<float,2>{0.0475682095f, 0.556127071f},
-std::array<float,2>{0.997590542f, 0.471737355f},
-std::array<float,2>{0.349853545f, 0.243807495f},
-std::array<float,2>{0.600306213f, 0.981182396f},
-std::array<float,2>{0.0719452575f, 0.756776452f},
-std::array<float,2>{0.911805272f, 0.104682632f},
-std::array<float,2>{0.257692456f, 0.322940558f},
-std::array<float,2>{0.514256001f, 0.714376986f},
-std::array<float,2>{0.39040643f, 0.575329483f},
-std::array<float,2>{0.72033155f, 0.382466108f},
-std::array<float,2>{0.241070554f, 0.181390718f},
-std::array<float,2>{0.87262404f, 0.875453889f},
-std::array<float,2>{0.32541725f, 0.956180274f},
-std::array<float,2>{0.579540908f, 0.200980723f},
-std::array<float,2>{0.0163993109f, 0.45036158f},
-std::array<float,2>{0.96086818f, 0.528099477f},
-std::array<float,2>{0.151850715f, 0.661143243f},
-std::array<float,2>{0.768031478f, 0.302902162f},
-std::array<float,2>{0.480754465f, 0.0488180183f},
-std::array<float,2>{0.668195307f, 0.838656604f},
-std::array<float,2>{0.181934819f, 0.827686787f},
-std::array<float,2>{0.801452577f, 0.0330712758f},
-std::array<float,2>{0.439510107f, 0.293788642f},
-std::array<float,2>{0.639365375f, 0.676951051f},
-std::array<float,2>{0.362491906f, 0.513020575f},
-std::array<float,2>{0.624952912f, 0.4585765f},
-std::array<float,2>{0.0340867788f, 0.218223691f},
-std::array<float,2>{0.975889921f, 0.938502014f},
-std::array<float,2>{0.408259451f, 0.894086957f},
-std::array<float,2>{0.708026052f, 0.161969721f},
-std::array<float,2>{0.195139602f, 0.401334524f},
-std::array<float,2>{0.823137164f, 0.591173947f},
-std::array<float,2>{0.11072202f, 0.699009478f},
-std::array<float,2>{0.877213955f, 0.329989135f},
-std::array<float,2>{0.282819152f, 0.111371256f},
-std::array<float,2>{0.55138582f, 0.767604649f},
-std::array<float,2>{0.00267652515f, 0.988063037f},
-std::array<float,2>{0.949803233f, 0.221647307f},
-std::array<float,2>{0.331298918f, 0.484427691f},
-std::array<float,2>{0.570224166f, 0.536489367f},
-std::array<float,2>{0.489652991f, 0.642480075f},
-std::array<float,2>{0.682090878f, 0.259936988f},
-std::array<float,2>{0.127634212f, 0.0037597008f},
-std::array<float,2>{0.762037933f, 0.871753216f},
-std::array<float,2>{0.270365417f, 0.78731817f},
-std::array<float,2>{0.519788742f, 0.0675610676f},
-std::array<float,2>{0.0811172351f, 0.363179326f},
-std::array<float,2>{0.924794197f, 0.738411486f},
-std::array<float,2>{0.233022705f, 0.594318986f},
-std::array<float,2>{0.848809063f, 0.434810966f},
-std::array<float,2>{0.392300308f, 0.135481283f},
-std::array<float,2>{0.745523453f, 0.931192517f},
-std::array<float,2>{0.159984991f, 0.903862119f},
-std::array<float,2>{0.787772179f, 0.167844549f},
-std::array<float,2>{0.455099851f, 0.3908391f},
-std::array<float,2>{0.651846886f, 0.585110843f},
-std::array<float,2>{0.346901417f, 0.694939375f},
-std::array<float,2>{0.597219586f, 0.33597818f},
-std::array<float,2>{0.0516322926f, 0.117733024f},
-std::array<float,2>{0.992710769f, 0.777898371f},
-std::array<float,2>{0.429760188f, 0.819950521f},
-std::array<float,2>{0.701054692f, 0.0404839478f},
-std::array<float,2>{0.207871333f, 0.28351894f},
-std::array<float,2>{0.832642019f, 0.683219194f},
-std::array<float,2>{0.104612969f, 0.504585624f},
-std::array<float,2>{0.893126428f, 0.461103648f},
-std::array<float,2>{0.31043902f, 0.203258604f},
-std::array<float,2>{0.546570063f, 0.948732197f},
-std::array<float,2>{0.0199839137f, 0.795032263f},
-std::array<float,2>{0.954003036f, 0.0769063011f},
-std::array<float,2>{0.322042197f, 0.369445115f},
-std::array<float,2>{0.585639417f, 0.74452287f},
-std::array<float,2>{0.477073729f, 0.608966887f},
-std::array<float,2>{0.666178286f, 0.422457576f},
-std::array<float,2>{0.154022083f, 0.131984845f},
-std::array<float,2>{0.77012217f, 0.924536347f},
-std::array<float,2>{0.251091629f, 0.99511379f},
-std::array<float,2>{0.508324027f, 0.229556605f},
-std::array<float,2>{0.0777305886f, 0.497187793f},
-std::array<float,2>{0.907277286f, 0.545793533f},
-std::array<float,2>{0.234989002f, 0.655698299f},
-std::array<float,2>{0.867232382f, 0.250151485f},
-std::array<float,2>{0.383704334f, 0.00882874988f},
-std::array<float,2>{0.726206899f, 0.859449267f},
-std::array<float,2>{0.188708156f, 0.849214315f},
-std::array<float,2>{0.824332833f, 0.024350889f},
-std::array<float,2>{0.410225123f, 0.267397523f},
-std::array<float,2>{0.706009626f, 0.631850004f},
-std::array<float,2>{0.288712233f, 0.554225206f},
-std::array<float,2>{0.549342752f, 0.481543541f},
-std::array<float,2>{0.113866284f, 0.238291264f},
-std::array<float,2>{0.88143903f, 0.969589174f},
-std::array<float,2>{0.441563666f, 0.918422163f},
-std::array<float,2>{0.632884085f, 0.144686669f},
-std::array<float,2>{0.185505241f, 0.407984614f},
-std::array<float,2>{0.797850192f, 0.623389721f},
-std::array<float,2>{0.0368734486f, 0.726518989f},
-std::array<float,2>{0.971063316f, 0.352923393f},
-std::array<float,2>{0.364566267f, 0.0794429407f},
-std::array<float,2>{0.620210469f, 0.811402738f},
-std::array<float,2>{0.0837003216f, 0.961739063f},
-std::array<float,2>{0.926480293f, 0.190730259f},
-std::array<float,2>{0.268226534f, 0.44280991f},
-std::array<float,2>{0.517971575f, 0.516473234f},
-std::array<float,2>{0.39730534f, 0.668962717f},
-std::array<float,2>{0.748079896f, 0.311647087f},
-std::array<float,2>{0.227587447f, 0.0559498146f},
-std::array<float,2>{0.844215393f, 0.834044158f},
-std::array<float,2>{0.33494857f, 0.760236263f},
-std::array<float,2>{0.563791215f, 0.0983031169f},
-std::array<float,2>{0.00770280091f, 0.318103045f},
-std::array<float,2>{0.946743786f, 0.706934333f},
-std::array<float,2>{0.130989328f, 0.562897444f},
-std::array<float,2>{0.757968068f, 0.387848288f},
-std::array<float,2>{0.488216013f, 0.172284603f},
-std::array<float,2>{0.686373651f, 0.887268186f},
-std::array<float,2>{0.220709756f, 0.9784711f},
-std::array<float,2>{0.857165515f, 0.247584462f},
-std::array<float,2>{0.40365839f, 0.47594142f},
-std::array<float,2>{0.737989962f, 0.56128788f},
-std::array<float,2>{0.276703805f, 0.638673604f},
-std::array<float,2>{0.523832023f, 0.275551528f},
-std::array<float,2>{0.0916670337f, 0.0187381152f},
-std::array<float,2>{0.93659246f, 0.852114856f},
-std::array<float,2>{0.49932766f, 0.798449755f},
-std::array<float,2>{0.678135455f, 0.0904389396f},
-std::array<float,2>{0.138377443f, 0.344158053f},
-std::array<float,2>{0.755820572f, 0.729741871f},
-std::array<float,2>{0.0090412721f, 0.617121816f},
-std::array<float,2>{0.938926756f, 0.416291833f},
-std::array<float,2>{0.343492866f, 0.150469616f},
-std::array<float,2>{0.570479691f, 0.913860977f},
-std::array<float,2>{0.119758658f, 0.841854215f},
-std::array<float,2>{0.888831437f, 0.0545983799f},
-std::array<float,2>{0.294315994f, 0.300072968f},
-std::array<float,2>{0.560062647f, 0.656891525f},
-std::array<float,2>{0.414379269f, 0.524378061f},
-std::array<float,2>{0.718435109f, 0.445731431f},
-std::array<float,2>{0.197174996f, 0.196656764f},
-std::array<float,2>{0.815258622f, 0.958416283f},
-std::array<float,2>{0.370235085f, 0.882319331f},
-std::array<float,2>{0.613554358f, 0.184264794f},
-std::array<float,2>{0.0453659594f, 0.378166199f},
-std::array<float,2>{0.983553886f, 0.572523415f},
-std::array<float,2>{0.178460285f, 0.718193233f},
-std::array<float,2>{0.806823671f, 0.325991213f},
-std::array<float,2>{0.451701105f, 0.107696317f},
-std::array<float,2>{0.627682924f, 0.751825571f},
-std::array<float,2>{0.141222909f, 0.772259176f},
-std::array<float,2>{0.781198859f, 0.115770377f},
-std::array<float,2>{0.475606918f, 0.335251361f},
-std::array<float,2>{0.659109712f, 0.702642322f},
-std::array<float,2>{0.317049593f, 0.58597815f},
-std::array<float,2>{0.590486228f, 0.404269516f},
-std::array<float,2>{0.0290123336f, 0.158895656f},
-std::array<float,2>{0.961171091f, 0.896951854f},
-std::array<float,2>{0.380877078f, 0.942518175f},
-std::array<float,2>{0.726659119f, 0.211762011f},
-std::array<float,2>{0.244715154f, 0.454017937f},
-std::array<float,2>{0.860696018f, 0.509294093f},
-std::array<float,2>{0.0657464191f, 0.675626159f},
-std::array<float,2>{0.914169669f, 0.290097505f},
-std::array<float,2>{0.261217386f, 0.0361656472f},
-std::array<float,2>{0.507736206f, 0.820497513f},
-std::array<float,2>{0.0565753952f, 0.93733716f},
-std::array<float,2>{0.992041111f, 0.140122354f},
-std::array<float,2>{0.353142053f, 0.430637002f},
-std::array<float,2>{0.604070425f, 0.598299801f},
-std::array<float,2>{0.462373167f, 0.737115145f},
-std::array<float,2>{0.640658379f, 0.364760339f},
-std::array<float,2>{0.167037264f, 0.0628699288f},
-std::array<float,2>{0.790065169f, 0.782883584f},
-std::array<float,2>{0.298362494f, 0.8686288f},
-std::array<float,2>{0.536147296f, 0.00447735703f},
-std::array<float,2>{0.0979974344f, 0.261781961f},
-std::array<float,2>{0.906141996f, 0.647161126f},
-std::array<float,2>{0.215509623f, 0.533607602f},
-std::array<float,2>{0.836700439f, 0.488666296f},
-std::array<float,2>{0.424361676f, 0.223612651f},
-std::array<float,2>{0.693870306f, 0.990021586f},
-std::array<float,2>{0.174192294f, 0.997513413f},
-std::array<float,2>{0.811616361f, 0.232844904f},
-std::array<float,2>{0.446944714f, 0.495893061f},
-std::array<float,2>{0.629152119f, 0.541631639f},
-std::array<float,2>{0.37196517f, 0.649101019f},
-std::array<float,2>{0.613239944f, 0.257213622f},
-std::array<float,2>{0.0403932482f, 0.0140577266f},
-std::array<float,2>{0.978222609f, 0.863311589f},
-std::array<float,2>{0.419265509f, 0.790866315f},
-std::array<float,2>{0.714714944f, 0.0732885078f},
-std::array<float,2>{0.202045053f, 0.371456891f},
-std::array<float,2>{0.818558872f, 0.746222734f},
-std::array<float,2>{0.12465997f, 0.602863491f},
-std::array<float,2>{0.885865867f, 0.429114789f},
-std::array<float,2>{0.289537936f, 0.126603141f},
-std::array<float,2>{0.558167756f, 0.928061783f},
-std::array<float,2>{0.0124713518f, 0.815785944f},
-std::array<float,2>{0.942021072f, 0.0433815308f},
-std::array<float,2>{0.339301109f, 0.287424684f},
-std::array<float,2>{0.575215936f, 0.685533762f},
-std::array<float,2>{0.494539648f, 0.502327442f},
-std::array<float,2>{0.675747335f, 0.466977715f},
-std::array<float,2>{0.135662407f, 0.209432334f},
-std::array<float,2>{0.753872156f, 0.951084435f},
-std::array<float,2>{0.281019926f, 0.899220645f},
-std::array<float,2>{0.529846013f, 0.171019509f},
-std::array<float,2>{0.0867905244f, 0.395236164f},
-std::array<float,2>{0.932952344f, 0.581568539f},
-std::array<float,2>{0.223801419f, 0.689805627f},
-std::array<float,2>{0.853424489f, 0.342495471f},
-std::array<float,2>{0.399714589f, 0.123720661f},
-std::array<float,2>{0.74189043f, 0.775500238f},
-std::array<float,2>{0.213844955f, 0.763250291f},
-std::array<float,2>{0.841690004f, 0.0944250003f},
-std::array<float,2>{0.427200317f, 0.313807935f},
-std::array<float,2>{0.690780461f, 0.709611058f},
-std::array<float,2>{0.304087102f, 0.566936255f},
-std::array<float,2>{0.535010815f, 0.386573553f},
-std::array<float,2>{0.095220685f, 0.179238737f},
-std::array<float,2>{0.899234116f, 0.883496284f},
-std::array<float,2>{0.467929304f, 0.966301918f},
-std::array<float,2>{0.647064269f, 0.193488166f},
-std::array<float,2>{0.16979906f, 0.438463628f},
-std::array<float,2>{0.793517351f, 0.521039307f},
-std::array<float,2>{0.0608205125f, 0.664579213f},
-std::array<float,2>{0.987129152f, 0.30711472f},
-std::array<float,2>{0.357507944f, 0.0600924678f},
-std::array<float,2>{0.608898938f, 0.829598844f},
-std::array<float,2>{0.0689931288f, 0.917509139f},
-std::array<float,2>{0.918194532f, 0.143871292f},
-std::array<float,2>{0.26321277f, 0.411997318f},
-std::array<float,2>{0.502485633f, 0.618609428f},
-std::array<float,2>{0.376085609f, 0.720496714f},
-std::array<float,2>{0.732385337f, 0.35793221f},
-std::array<float,2>{0.246512741f, 0.0852027163f},
-std::array<float,2>{0.866731822f, 0.808543205f},
-std::array<float,2>{0.314284623f, 0.847040713f},
-std::array<float,2>{0.587790847f, 0.0291352049f},
-std::array<float,2>{0.0235426687f, 0.27289775f},
-std::array<float,2>{0.966563642f, 0.62769413f},
-std::array<float,2>{0.147502869f, 0.547171354f},
-std::array<float,2>{0.773873687f, 0.48020646f},
-std::array<float,2>{0.470666349f, 0.234522328f},
-std::array<float,2>{0.661314309f, 0.976027071f},
-std::array<float,2>{0.23856394f, 0.877430975f},
-std::array<float,2>{0.873686433f, 0.182750791f},
-std::array<float,2>{0.38711217f, 0.380474836f},
-std::array<float,2>{0.720777512f, 0.577972531f},
-std::array<float,2>{0.255781233f, 0.712239683f},
-std::array<float,2>{0.512010455f, 0.321101546f},
-std::array<float,2>{0.0738316551f, 0.10303048f},
-std::array<float,2>{0.913624942f, 0.754227638f},
-std::array<float,2>{0.483318895f, 0.837757647f},
-std::array<float,2>{0.670463145f, 0.0505887009f},
-std::array<float,2>{0.149264231f, 0.3014597f},
-std::array<float,2>{0.766590059f, 0.662322521f},
-std::array<float,2>{0.0180130713f, 0.53100878f},
-std::array<float,2>{0.957484424f, 0.452022672f},
-std::array<float,2>{0.326416999f, 0.201671273f},
-std::array<float,2>{0.5810619f, 0.954666972f},
-std::array<float,2>{0.10762848f, 0.802285373f},
-std::array<float,2>{0.89831388f, 0.0870162323f},
-std::array<float,2>{0.307475358f, 0.350230426f},
-std::array<float,2>{0.539114416f, 0.730971396f},
-std::array<float,2>{0.433617681f, 0.610594749f},
-std::array<float,2>{0.698859036f, 0.419671416f},
-std::array<float,2>{0.203636616f, 0.152785897f},
-std::array<float,2>{0.828159153f, 0.907412469f},
-std::array<float,2>{0.348631233f, 0.983852088f},
-std::array<float,2>{0.5979231f, 0.244591087f},
-std::array<float,2>{0.0491055697f, 0.469136804f},
-std::array<float,2>{0.998447478f, 0.558415413f},
-std::array<float,2>{0.162038893f, 0.636177957f},
-std::array<float,2>{0.782012284f, 0.280677915f},
-std::array<float,2>{0.459089488f, 0.0228840783f},
-std::array<float,2>{0.6558249f, 0.856552482f},
-std::array<float,2>{0.125767916f, 0.87497437f},
-std::array<float,2>{0.76377362f, 0.000877311046f},
-std::array<float,2>{0.49144569f, 0.259372413f},
-std::array<float,2>{0.681414068f, 0.643037617f},
-std::array<float,2>{0.328971088f, 0.537650108f},
-std::array<float,2>{0.567547619f, 0.48707521f},
-std::array<float,2>{0.000138202231f, 0.219598502f},
-std::array<float,2>{0.951541662f, 0.985168517f},
-std::array<float,2>{0.392930657f, 0.933004379f},
-std::array<float,2>{0.743571401f, 0.13418667f},
-std::array<float,2>{0.230540499f, 0.435724914f},
-std::array<float,2>{0.849623263f, 0.597322524f},
-std::array<float,2>{0.0794890597f, 0.740876257f},
-std::array<float,2>{0.923684716f, 0.361007363f},
-std::array<float,2>{0.272212744f, 0.068635866f},
-std::array<float,2>{0.523199618f, 0.785847127f},
-std::array<float,2>{0.0320123918f, 0.939781845f},
-std::array<float,2>{0.974175751f, 0.215049297f},
-std::array<float,2>{0.360644639f, 0.4595294f},
-std::array<float,2>{0.62115097f, 0.514251053f},
-std::array<float,2>{0.438517064f, 0.679650843f},
-std::array<float,2>{0.637889266f, 0.296037525f},
-std::array<float,2>{0.180198744f, 0.0350364409f},
-std::array<float,2>{0.804667175f, 0.825198352f},
-std::array<float,2>{0.283592254f, 0.767185271f},
-std::array<float,2>{0.553016186f, 0.110633805f},
-std::array<float,2>{0.111980423f, 0.331966966f},
-std::array<float,2>{0.876706123f, 0.696872234f},
-std::array<float,2>{0.19195883f, 0.5918836f},
-std::array<float,2>{0.82222116f, 0.398476541f},
-std::array<float,2>{0.408079952f, 0.163595393f},
-std::array<float,2>{0.709313869f, 0.891878307f},
-std::array<float,2>{0.154964581f, 0.923063815f},
-std::array<float,2>{0.772090435f, 0.129405588f},
-std::array<float,2>{0.478976399f, 0.425464064f},
-std::array<float,2>{0.664753497f, 0.607245445f},
-std::array<float,2>{0.323217005f, 0.742852807f},
-std::array<float,2>{0.583036423f, 0.367235869f},
-std::array<float,2>{0.0215341505f, 0.074802123f},
-std::array<float,2>{0.956676304f, 0.793067455f},
-std::array<float,2>{0.386140436f, 0.862135887f},
-std::array<float,2>{0.723944306f, 0.0108305747f},
-std::array<float,2>{0.237821549f, 0.252948731f},
-std::array<float,2>{0.870035946f, 0.653129101f},
-std::array<float,2>{0.0760998577f, 0.543695033f},
-std::array<float,2>{0.909868777f, 0.499619395f},
-std::array<float,2>{0.253039747f, 0.227765962f},
-std::array<float,2>{0.510236859f, 0.993731081f},
-std::array<float,2>{0.0527863353f, 0.781227529f},
-std::array<float,2>{0.994702458f, 0.119165771f},
-std::array<float,2>{0.344504565f, 0.339686722f},
-std::array<float,2>{0.594201863f, 0.692234159f},
-std::array<float,2>{0.454130054f, 0.583675444f},
-std::array<float,2>{0.649998665f, 0.393932253f},
-std::array<float,2>{0.156782836f, 0.165947184f},
-std::array<float,2>{0.785173297f, 0.905804813f},
-std::array<float,2>{0.311916053f, 0.946335256f},
-std::array<float,2>{0.542972386f, 0.205646694f},
-std::array<float,2>{0.103484854f, 0.464349538f},
-std::array<float,2>{0.891308546f, 0.507683396f},
-std::array<float,2>{0.21052666f, 0.680528641f},
-std::array<float,2>{0.834172308f, 0.282880694f},
-std::array<float,2>{0.432360172f, 0.0422292687f},
-std::array<float,2>{0.701337099f, 0.81650418f},
-std::array<float,2>{0.228551835f, 0.833366275f},
-std::array<float,2>{0.846538544f, 0.0584552325f},
-std::array<float,2>{0.396124631f, 0.30999881f},
-std::array<float,2>{0.74680841f, 0.669923723f},
-std::array<float,2>{0.266121656f, 0.51937294f},
-std::array<float,2>{0.515789211f, 0.445169985f},
-std::array<float,2>{0.0845542252f, 0.187778771f},
-std::array<float,2>{0.929477572f, 0.964831531f},
-std::array<float,2>{0.485822469f, 0.890521407f},
-std::array<float,2>{0.684460998f, 0.175673097f},
-std::array<float,2>{0.129043624f, 0.390593618f},
-std::array<float,2>{0.760547876f, 0.565854073f},
-std::array<float,2>{0.00549871987f, 0.704425514f},
-std::array<float,2>{0.947339594f, 0.319925308f},
-std::array<float,2>{0.333443284f, 0.100256741f},
-std::array<float,2>{0.566002965f, 0.757942021f},
-std::array<float,2>{0.115419999f, 0.97126472f},
-std::array<float,2>{0.879655242f, 0.241359502f},
-std::array<float,2>{0.287031174f, 0.482720792f},
-std::array<float,2>{0.546992302f, 0.552286804f},
-std::array<float,2>{0.413641363f, 0.629826963f},
-std::array<float,2>{0.704860449f, 0.268824309f},
-std::array<float,2>{0.190632999f, 0.0260475129f},
-std::array<float,2>{0.827861667f, 0.850683868f},
-std::array<float,2>{0.367121339f, 0.81034416f},
-std::array<float,2>{0.618655384f, 0.0820256323f},
-std::array<float,2>{0.0379859395f, 0.354551911f},
-std::array<float,2>{0.970275044f, 0.72361511f},
-std::array<float,2>{0.186649129f, 0.622463822f},
-std::array<float,2>{0.800050497f, 0.409833997f},
-std::array<float,2>{0.44487676f, 0.146678314f},
-std::array<float,2>{0.636486411f, 0.9208197f},
-std::array<float,2>{0.198251814f, 0.959890485f},
-std::array<float,2>{0.812586904f, 0.198662013f},
-std::array<float,2>{0.41629532f, 0.447809041f},
-std::array<float,2>{0.715260267f, 0.526647925f},
-std::array<float,2>{0.295151174f, 0.658477187f},
-std::array<float,2>{0.561552703f, 0.296894252f},
-std::array<float,2>{0.118346944f, 0.0512742177f},
-std::array<float,2>{0.887797415f, 0.840420544f},
-std::array<float,2>{0.449677855f, 0.75311482f},
-std::array<float,2>{0.626500547f, 0.106596373f},
-std::array<float,2>{0.175937742f, 0.327449024f},
-std::array<float,2>{0.805988014f, 0.714911878f},
-std::array<float,2>{0.0432640314f, 0.570755661f},
-std::array<float,2>{0.981596112f, 0.375911921f},
-std::array<float,2>{0.367580891f, 0.185773537f},
-std::array<float,2>{0.616153002f, 0.880017877f},
-std::array<float,2>{0.0926340222f, 0.855208039f},
-std::array<float,2>{0.933972001f, 0.0168265365f},
-std::array<float,2>{0.274805933f, 0.273859203f},
-std::array<float,2>{0.525673032f, 0.636779368f},
-std::array<float,2>{0.405886561f, 0.559499383f},
-std::array<float,2>{0.734654367f, 0.474422485f},
-std::array<float,2>{0.219436154f, 0.248511612f},
-std::array<float,2>{0.85752964f, 0.979593694f},
-std::array<float,2>{0.341485262f, 0.911153734f},
-std::array<float,2>{0.573330462f, 0.149540827f},
-std::array<float,2>{0.0109444233f, 0.414932638f},
-std::array<float,2>{0.941150129f, 0.613959551f},
-std::array<float,2>{0.139984891f, 0.727811873f},
-std::array<float,2>{0.756756008f, 0.347516328f},
-std::array<float,2>{0.497876614f, 0.0922803879f},
-std::array<float,2>{0.67634815f, 0.800635934f},
-std::array<float,2>{0.164911821f, 0.783908904f},
-std::array<float,2>{0.792021215f, 0.0651785806f},
-std::array<float,2>{0.464744687f, 0.365793169f},
-std::array<float,2>{0.64395082f, 0.736060262f},
-std::array<float,2>{0.354897678f, 0.599719107f},
-std::array<float,2>{0.602491736f, 0.432798147f},
-std::array<float,2>{0.0584550761f, 0.137944043f},
-std::array<float,2>{0.98847127f, 0.934016943f},
-std::array<float,2>{0.423782527f, 0.990655184f},
-std::array<float,2>{0.693060338f, 0.226049706f},
-std::array<float,2>{0.217722148f, 0.49075827f},
-std::array<float,2>{0.83964479f, 0.532404184f},
-std::array<float,2>{0.100476794f, 0.646235585f},
-std::array<float,2>{0.903114974f, 0.263965309f},
-std::array<float,2>{0.300180763f, 0.0065856725f},
-std::array<float,2>{0.538520753f, 0.870517254f},
-std::array<float,2>{0.0297265071f, 0.894971251f},
-std::array<float,2>{0.963607907f, 0.156282082f},
-std::array<float,2>{0.318504632f, 0.405244946f},
-std::array<float,2>{0.593480885f, 0.588118792f},
-std::array<float,2>{0.47430253f, 0.700927019f},
-std::array<float,2>{0.657222271f, 0.333672643f},
-std::array<float,2>{0.142688736f, 0.114224896f},
-std::array<float,2>{0.779190183f, 0.770263374f},
-std::array<float,2>{0.257952809f, 0.82246232f},
-std::array<float,2>{0.505604446f, 0.0377459563f},
-std::array<float,2>{0.0636199191f, 0.29118067f},
-std::array<float,2>{0.917698145f, 0.672387719f},
-std::array<float,2>{0.242593676f, 0.509910643f},
-std::array<float,2>{0.862194359f, 0.455191135f},
-std::array<float,2>{0.380104303f, 0.214560136f},
-std::array<float,2>{0.729858875f, 0.944846153f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.693895102f, 0.0230217315f},
-std::array<float,2>{0.195118114f, 0.553641021f},
-std::array<float,2>{0.754723728f, 0.862628102f},
-std::array<float,2>{0.260566652f, 0.402794808f},
-std::array<float,2>{0.899116337f, 0.285969317f},
-std::array<float,2>{0.419185549f, 0.983901739f},
-std::array<float,2>{0.536174178f, 0.649299026f},
-std::array<float,2>{0.0243476368f, 0.241808504f},
-std::array<float,2>{0.848952174f, 0.144832671f},
-std::array<float,2>{0.323803604f, 0.702107131f},
-std::array<float,2>{0.653845966f, 0.928583086f},
-std::array<float,2>{0.181187585f, 0.333569765f},
-std::array<float,2>{0.579235077f, 0.466494977f},
-std::array<float,2>{0.120303214f, 0.811187387f},
-std::array<float,2>{0.959451795f, 0.584768236f},
-std::array<float,2>{0.494081855f, 0.114422701f},
-std::array<float,2>{0.504771352f, 0.213379398f},
-std::array<float,2>{0.0505988598f, 0.669751525f},
-std::array<float,2>{0.934952319f, 0.944377005f},
-std::array<float,2>{0.404466212f, 0.25985986f},
-std::array<float,2>{0.808516622f, 0.415621847f},
-std::array<float,2>{0.307994008f, 0.835436165f},
-std::array<float,2>{0.722027361f, 0.502206981f},
-std::array<float,2>{0.244989082f, 0.0361445025f},
-std::array<float,2>{0.98000735f, 0.0783015937f},
-std::array<float,2>{0.458705932f, 0.594664514f},
-std::array<float,2>{0.61155051f, 0.762821376f},
-std::array<float,2>{0.0758533403f, 0.480359286f},
-std::array<float,2>{0.67625612f, 0.355527282f},
-std::array<float,2>{0.155810952f, 0.882103026f},
-std::array<float,2>{0.840428829f, 0.742254138f},
-std::array<float,2>{0.370235831f, 0.159093276f},
-std::array<float,2>{0.598596752f, 0.0975534916f},
-std::array<float,2>{0.0914509296f, 0.574454427f},
-std::array<float,2>{0.991970122f, 0.795149684f},
-std::array<float,2>{0.441266894f, 0.452592582f},
-std::array<float,2>{0.819058716f, 0.315448195f},
-std::array<float,2>{0.345819235f, 0.920727789f},
-std::array<float,2>{0.658713877f, 0.716861963f},
-std::array<float,2>{0.129865631f, 0.139142677f},
-std::array<float,2>{0.907587886f, 0.221264243f},
-std::array<float,2>{0.38684234f, 0.63589114f},
-std::array<float,2>{0.527227104f, 0.995652676f},
-std::array<float,2>{0.0425583571f, 0.310061991f},
-std::array<float,2>{0.738039851f, 0.390027881f},
-std::array<float,2>{0.221438229f, 0.854374588f},
-std::array<float,2>{0.792168021f, 0.54071331f},
-std::array<float,2>{0.288708359f, 0.0141941486f},
-std::array<float,2>{0.629686356f, 0.175012067f},
-std::array<float,2>{0.167881832f, 0.719527185f},
-std::array<float,2>{0.869798779f, 0.891462624f},
-std::array<float,2>{0.335152239f, 0.363983303f},
-std::array<float,2>{0.948711038f, 0.489650309f},
-std::array<float,2>{0.477238029f, 0.776454329f},
-std::array<float,2>{0.564381421f, 0.613152027f},
-std::array<float,2>{0.098104924f, 0.073892653f},
-std::array<float,2>{0.771313906f, 0.0601185858f},
-std::array<float,2>{0.268760592f, 0.528479636f},
-std::array<float,2>{0.705652058f, 0.821203887f},
-std::array<float,2>{0.210334092f, 0.435049951f},
-std::array<float,2>{0.557658195f, 0.270363599f},
-std::array<float,2>{0.00624836935f, 0.958598375f},
-std::array<float,2>{0.890552163f, 0.677474976f},
-std::array<float,2>{0.426528454f, 0.187876329f},
-std::array<float,2>{0.667183757f, 0.0635447577f},
-std::array<float,2>{0.136839345f, 0.6244663f},
-std::array<float,2>{0.8267349f, 0.766880929f},
-std::array<float,2>{0.354175001f, 0.495151013f},
-std::array<float,2>{0.996598601f, 0.372978687f},
-std::array<float,2>{0.447546035f, 0.905540764f},
-std::array<float,2>{0.606699467f, 0.733883977f},
-std::array<float,2>{0.0815897509f, 0.182793573f},
-std::array<float,2>{0.78635788f, 0.199396402f},
-std::array<float,2>{0.291412085f, 0.682226002f},
-std::array<float,2>{0.744834721f, 0.961438179f},
-std::array<float,2>{0.228612632f, 0.275767505f},
-std::array<float,2>{0.52267009f, 0.421932071f},
-std::array<float,2>{0.0380599052f, 0.814269125f},
-std::array<float,2>{0.91618526f, 0.516449809f},
-std::array<float,2>{0.377304584f, 0.0532235764f},
-std::array<float,2>{0.573866308f, 0.125633165f},
-std::array<float,2>{0.104879394f, 0.705297351f},
-std::array<float,2>{0.93923521f, 0.912789643f},
-std::array<float,2>{0.472801507f, 0.326898694f},
-std::array<float,2>{0.866764069f, 0.444030881f},
-std::array<float,2>{0.338467151f, 0.784545898f},
-std::array<float,2>{0.640192389f, 0.563794494f},
-std::array<float,2>{0.163762122f, 0.108675808f},
-std::array<float,2>{0.880828619f, 0.00487807626f},
-std::array<float,2>{0.429726571f, 0.534994006f},
-std::array<float,2>{0.552546442f, 0.849765718f},
-std::array<float,2>{0.00978245772f, 0.376258045f},
-std::array<float,2>{0.717218101f, 0.298770994f},
-std::array<float,2>{0.211404607f, 0.988651395f},
-std::array<float,2>{0.778282762f, 0.626227021f},
-std::array<float,2>{0.276868075f, 0.233204409f},
-std::array<float,2>{0.539293647f, 0.040741127f},
-std::array<float,2>{0.0196695067f, 0.514131606f},
-std::array<float,2>{0.89064461f, 0.837032378f},
-std::array<float,2>{0.413425326f, 0.408938766f},
-std::array<float,2>{0.760410905f, 0.255585015f},
-std::array<float,2>{0.257384241f, 0.948365033f},
-std::array<float,2>{0.698330939f, 0.661709547f},
-std::array<float,2>{0.196967915f, 0.207324415f},
-std::array<float,2>{0.962443233f, 0.171016484f},
-std::array<float,2>{0.486010492f, 0.735387087f},
-std::array<float,2>{0.592547119f, 0.88752681f},
-std::array<float,2>{0.110819168f, 0.348793358f},
-std::array<float,2>{0.646712959f, 0.476079464f},
-std::array<float,2>{0.172561079f, 0.756721675f},
-std::array<float,2>{0.855232894f, 0.604498029f},
-std::array<float,2>{0.317734897f, 0.0862448514f},
-std::array<float,2>{0.72953397f, 0.244897559f},
-std::array<float,2>{0.237877354f, 0.642673254f},
-std::array<float,2>{0.800064921f, 0.975722909f},
-std::array<float,2>{0.301864743f, 0.293719739f},
-std::array<float,2>{0.922982097f, 0.396207064f},
-std::array<float,2>{0.39189294f, 0.873744965f},
-std::array<float,2>{0.508281231f, 0.560690522f},
-std::array<float,2>{0.057281211f, 0.0257168021f},
-std::array<float,2>{0.829963267f, 0.118808627f},
-std::array<float,2>{0.361577779f, 0.588326335f},
-std::array<float,2>{0.685316443f, 0.800936699f},
-std::array<float,2>{0.141245037f, 0.460443646f},
-std::array<float,2>{0.618965626f, 0.343437105f},
-std::array<float,2>{0.0682811588f, 0.930276096f},
-std::array<float,2>{0.975538433f, 0.693898976f},
-std::array<float,2>{0.461693615f, 0.152334273f},
-std::array<float,2>{0.747725189f, 0.111355178f},
-std::array<float,2>{0.233797252f, 0.581759095f},
-std::array<float,2>{0.782647133f, 0.805645883f},
-std::array<float,2>{0.296714902f, 0.462829173f},
-std::array<float,2>{0.9188748f, 0.331351459f},
-std::array<float,2>{0.381973296f, 0.922519922f},
-std::array<float,2>{0.518371165f, 0.695321023f},
-std::array<float,2>{0.0336608551f, 0.142539799f},
-std::array<float,2>{0.821293533f, 0.23763597f},
-std::array<float,2>{0.35732919f, 0.652709544f},
-std::array<float,2>{0.6680215f, 0.979572296f},
-std::array<float,2>{0.133130252f, 0.281693876f},
-std::array<float,2>{0.605002701f, 0.399662167f},
-std::array<float,2>{0.0822024494f, 0.863627672f},
-std::array<float,2>{0.993760884f, 0.550187826f},
-std::array<float,2>{0.452447772f, 0.0181329139f},
-std::array<float,2>{0.549590349f, 0.160715535f},
-std::array<float,2>{0.0126665672f, 0.748175502f},
-std::array<float,2>{0.877059579f, 0.877701879f},
-std::array<float,2>{0.43477127f, 0.354020327f},
-std::array<float,2>{0.776354313f, 0.481348097f},
-std::array<float,2>{0.277887672f, 0.760421574f},
-std::array<float,2>{0.714083433f, 0.598810017f},
-std::array<float,2>{0.217081517f, 0.0822471902f},
-std::array<float,2>{0.945160866f, 0.0315786861f},
-std::array<float,2>{0.46979633f, 0.506724119f},
-std::array<float,2>{0.576309144f, 0.829690754f},
-std::array<float,2>{0.10556715f, 0.419405311f},
-std::array<float,2>{0.635124564f, 0.261967093f},
-std::array<float,2>{0.158054873f, 0.937557518f},
-std::array<float,2>{0.862804949f, 0.664784908f},
-std::array<float,2>{0.342189342f, 0.216598392f},
-std::array<float,2>{0.588074267f, 0.011698029f},
-std::array<float,2>{0.115159549f, 0.545499623f},
-std::array<float,2>{0.968010068f, 0.85905081f},
-std::array<float,2>{0.49131766f, 0.383279204f},
-std::array<float,2>{0.856773138f, 0.307034165f},
-std::array<float,2>{0.315605044f, 0.996267855f},
-std::array<float,2>{0.640779555f, 0.637270629f},
-std::array<float,2>{0.179288149f, 0.22420758f},
-std::array<float,2>{0.897801101f, 0.135271639f},
-std::array<float,2>{0.406549543f, 0.710951507f},
-std::array<float,2>{0.544177294f, 0.916106641f},
-std::array<float,2>{0.0178507213f, 0.316746086f},
-std::array<float,2>{0.701107264f, 0.445722461f},
-std::array<float,2>{0.202537164f, 0.790428221f},
-std::array<float,2>{0.763473511f, 0.570800483f},
-std::array<float,2>{0.253691852f, 0.0996747464f},
-std::array<float,2>{0.680211663f, 0.194937453f},
-std::array<float,2>{0.147078395f, 0.674861908f},
-std::array<float,2>{0.835132837f, 0.953867376f},
-std::array<float,2>{0.3633416f, 0.269030362f},
-std::array<float,2>{0.970044613f, 0.433503032f},
-std::array<float,2>{0.467599243f, 0.827412844f},
-std::array<float,2>{0.623777449f, 0.523948669f},
-std::array<float,2>{0.0633198619f, 0.0583606735f},
-std::array<float,2>{0.801987946f, 0.0766714513f},
-std::array<float,2>{0.297827274f, 0.617186964f},
-std::array<float,2>{0.730715752f, 0.777475655f},
-std::array<float,2>{0.241291031f, 0.486686647f},
-std::array<float,2>{0.512648463f, 0.361541659f},
-std::array<float,2>{0.0604136251f, 0.895925879f},
-std::array<float,2>{0.928773522f, 0.724719882f},
-std::array<float,2>{0.394533247f, 0.176746994f},
-std::array<float,2>{0.648593605f, 0.0474770404f},
-std::array<float,2>{0.186641827f, 0.522390962f},
-std::array<float,2>{0.846339822f, 0.818712175f},
-std::array<float,2>{0.324277431f, 0.429484367f},
-std::array<float,2>{0.953238189f, 0.277575046f},
-std::array<float,2>{0.499612898f, 0.966782212f},
-std::array<float,2>{0.583942533f, 0.684121192f},
-std::array<float,2>{0.121488951f, 0.196517959f},
-std::array<float,2>{0.75226897f, 0.184778318f},
-std::array<float,2>{0.262793303f, 0.726595879f},
-std::array<float,2>{0.689165413f, 0.901847839f},
-std::array<float,2>{0.190262899f, 0.370476574f},
-std::array<float,2>{0.532007098f, 0.496491283f},
-std::array<float,2>{0.0306482706f, 0.771383166f},
-std::array<float,2>{0.904435933f, 0.617815435f},
-std::array<float,2>{0.416064709f, 0.0672410801f},
-std::array<float,2>{0.613377392f, 0.228692144f},
-std::array<float,2>{0.0719700232f, 0.630913436f},
-std::array<float,2>{0.984068573f, 0.986222208f},
-std::array<float,2>{0.456453502f, 0.303847015f},
-std::array<float,2>{0.836990416f, 0.379764438f},
-std::array<float,2>{0.374287874f, 0.846189857f},
-std::array<float,2>{0.674767196f, 0.537982523f},
-std::array<float,2>{0.150819391f, 0.00315042329f},
-std::array<float,2>{0.929931462f, 0.101795971f},
-std::array<float,2>{0.400722295f, 0.569481194f},
-std::array<float,2>{0.500627935f, 0.788113892f},
-std::array<float,2>{0.0528155714f, 0.441090584f},
-std::array<float,2>{0.725090384f, 0.322093308f},
-std::array<float,2>{0.248685092f, 0.90869844f},
-std::array<float,2>{0.810273945f, 0.707544446f},
-std::array<float,2>{0.309922814f, 0.131011367f},
-std::array<float,2>{0.529816031f, 0.0909301639f},
-std::array<float,2>{0.0464372002f, 0.607307971f},
-std::array<float,2>{0.912665725f, 0.752213538f},
-std::array<float,2>{0.385020912f, 0.470020562f},
-std::array<float,2>{0.793014407f, 0.344444215f},
-std::array<float,2>{0.282569408f, 0.882855594f},
-std::array<float,2>{0.741434276f, 0.741918266f},
-std::array<float,2>{0.225304991f, 0.165301666f},
-std::array<float,2>{0.98562324f, 0.206354797f},
-std::array<float,2>{0.443539053f, 0.65656352f},
-std::array<float,2>{0.595293939f, 0.95170486f},
-std::array<float,2>{0.0876864195f, 0.252949983f},
-std::array<float,2>{0.661510885f, 0.410209358f},
-std::array<float,2>{0.126196817f, 0.84321785f},
-std::array<float,2>{0.813151956f, 0.508031011f},
-std::array<float,2>{0.350372732f, 0.0445801094f},
-std::array<float,2>{0.709142268f, 0.15554367f},
-std::array<float,2>{0.206835285f, 0.690880716f},
-std::array<float,2>{0.769489288f, 0.937383175f},
-std::array<float,2>{0.270722538f, 0.339752018f},
-std::array<float,2>{0.884063959f, 0.455199331f},
-std::array<float,2>{0.423192799f, 0.799131572f},
-std::array<float,2>{0.559548795f, 0.589920759f},
-std::array<float,2>{0.00154898106f, 0.1212992f},
-std::array<float,2>{0.873623312f, 0.0301842168f},
-std::array<float,2>{0.329890788f, 0.554724216f},
-std::array<float,2>{0.628200889f, 0.870382011f},
-std::array<float,2>{0.170892119f, 0.393024772f},
-std::array<float,2>{0.566831946f, 0.290450454f},
-std::array<float,2>{0.0966203734f, 0.969928563f},
-std::array<float,2>{0.950092733f, 0.646911025f},
-std::array<float,2>{0.480899096f, 0.247821897f},
-std::array<float,2>{0.719195843f, 0.0388105623f},
-std::array<float,2>{0.2428644f, 0.50164181f},
-std::array<float,2>{0.805176973f, 0.832385361f},
-std::array<float,2>{0.304704696f, 0.417590618f},
-std::array<float,2>{0.936784506f, 0.258397758f},
-std::array<float,2>{0.403578579f, 0.943232954f},
-std::array<float,2>{0.506183088f, 0.670125961f},
-std::array<float,2>{0.0485635214f, 0.212200597f},
-std::array<float,2>{0.842976868f, 0.157748714f},
-std::array<float,2>{0.36836338f, 0.745361686f},
-std::array<float,2>{0.678621173f, 0.880194843f},
-std::array<float,2>{0.153921828f, 0.359349221f},
-std::array<float,2>{0.610601544f, 0.476712614f},
-std::array<float,2>{0.0780190006f, 0.764775038f},
-std::array<float,2>{0.976611733f, 0.596803725f},
-std::array<float,2>{0.460599095f, 0.0805329233f},
-std::array<float,2>{0.538385689f, 0.23957698f},
-std::array<float,2>{0.0263224673f, 0.651138127f},
-std::array<float,2>{0.90229398f, 0.982010126f},
-std::array<float,2>{0.420725316f, 0.287591368f},
-std::array<float,2>{0.756694734f, 0.405259609f},
-std::array<float,2>{0.258127123f, 0.860107362f},
-std::array<float,2>{0.693250477f, 0.552600145f},
-std::array<float,2>{0.192519486f, 0.0208115671f},
-std::array<float,2>{0.958284497f, 0.116444744f},
-std::array<float,2>{0.494413197f, 0.583267391f},
-std::array<float,2>{0.581688881f, 0.809329271f},
-std::array<float,2>{0.11827977f, 0.467118412f},
-std::array<float,2>{0.654510558f, 0.334468186f},
-std::array<float,2>{0.181815073f, 0.927360415f},
-std::array<float,2>{0.851183116f, 0.700960398f},
-std::array<float,2>{0.322211117f, 0.147376806f},
-std::array<float,2>{0.564962804f, 0.0713570192f},
-std::array<float,2>{0.100340165f, 0.611011684f},
-std::array<float,2>{0.946581066f, 0.774494588f},
-std::array<float,2>{0.480365336f, 0.492044359f},
-std::array<float,2>{0.86762768f, 0.365557045f},
-std::array<float,2>{0.333301485f, 0.894098163f},
-std::array<float,2>{0.631518066f, 0.721532643f},
-std::array<float,2>{0.165191457f, 0.1736826f},
-std::array<float,2>{0.888668239f, 0.190320835f},
-std::array<float,2>{0.428313315f, 0.67826587f},
-std::array<float,2>{0.55601126f, 0.959285438f},
-std::array<float,2>{0.00427158223f, 0.271599501f},
-std::array<float,2>{0.703652382f, 0.435658544f},
-std::array<float,2>{0.208072811f, 0.824181914f},
-std::array<float,2>{0.771952987f, 0.529544652f},
-std::array<float,2>{0.265669793f, 0.0607149191f},
-std::array<float,2>{0.657417119f, 0.137857348f},
-std::array<float,2>{0.132775247f, 0.715917706f},
-std::array<float,2>{0.816426635f, 0.917969286f},
-std::array<float,2>{0.344969302f, 0.313479006f},
-std::array<float,2>{0.990111291f, 0.451136172f},
-std::array<float,2>{0.438229293f, 0.793889284f},
-std::array<float,2>{0.600052655f, 0.576850891f},
-std::array<float,2>{0.0933336318f, 0.0952450857f},
-std::array<float,2>{0.790263176f, 0.0123044178f},
-std::array<float,2>{0.287103236f, 0.542925537f},
-std::array<float,2>{0.734397709f, 0.853512406f},
-std::array<float,2>{0.219980761f, 0.388619125f},
-std::array<float,2>{0.525104225f, 0.311420977f},
-std::array<float,2>{0.0392021202f, 0.992372751f},
-std::array<float,2>{0.909919322f, 0.633924723f},
-std::array<float,2>{0.38887924f, 0.219323337f},
-std::array<float,2>{0.638655424f, 0.107031174f},
-std::array<float,2>{0.160581395f, 0.564595222f},
-std::array<float,2>{0.864995182f, 0.782464325f},
-std::array<float,2>{0.337727904f, 0.442121267f},
-std::array<float,2>{0.940237522f, 0.324679047f},
-std::array<float,2>{0.476011515f, 0.9111588f},
-std::array<float,2>{0.571168661f, 0.704992175f},
-std::array<float,2>{0.103057623f, 0.128512785f},
-std::array<float,2>{0.781202078f, 0.231348738f},
-std::array<float,2>{0.273489237f, 0.627168536f},
-std::array<float,2>{0.715459645f, 0.990873039f},
-std::array<float,2>{0.213004038f, 0.299607038f},
-std::array<float,2>{0.553150237f, 0.377271354f},
-std::array<float,2>{0.0088321073f, 0.84862864f},
-std::array<float,2>{0.882353187f, 0.531859398f},
-std::array<float,2>{0.432912201f, 0.00640121521f},
-std::array<float,2>{0.607699752f, 0.180699542f},
-std::array<float,2>{0.0785960555f, 0.731489539f},
-std::array<float,2>{0.998074353f, 0.903364539f},
-std::array<float,2>{0.447049499f, 0.373544782f},
-std::array<float,2>{0.824425042f, 0.493942678f},
-std::array<float,2>{0.35320276f, 0.76785779f},
-std::array<float,2>{0.664265931f, 0.621242225f},
-std::array<float,2>{0.13924922f, 0.0649808571f},
-std::array<float,2>{0.915414155f, 0.0523714535f},
-std::array<float,2>{0.376480937f, 0.517592907f},
-std::array<float,2>{0.519668698f, 0.814668298f},
-std::array<float,2>{0.0357790738f, 0.425132692f},
-std::array<float,2>{0.742268085f, 0.274033606f},
-std::array<float,2>{0.226620689f, 0.963630617f},
-std::array<float,2>{0.787967145f, 0.681451559f},
-std::array<float,2>{0.29073599f, 0.20148854f},
-std::array<float,2>{0.511693001f, 0.0244538002f},
-std::array<float,2>{0.0550032668f, 0.559141397f},
-std::array<float,2>{0.924508274f, 0.87300849f},
-std::array<float,2>{0.393531919f, 0.397449464f},
-std::array<float,2>{0.79837817f, 0.296393931f},
-std::array<float,2>{0.304483235f, 0.973785281f},
-std::array<float,2>{0.726679504f, 0.641756415f},
-std::array<float,2>{0.234788865f, 0.244068339f},
-std::array<float,2>{0.973843217f, 0.148877382f},
-std::array<float,2>{0.464810699f, 0.691466689f},
-std::array<float,2>{0.619277596f, 0.933315694f},
-std::array<float,2>{0.0697755516f, 0.341198742f},
-std::array<float,2>{0.686684251f, 0.457727432f},
-std::array<float,2>{0.143481687f, 0.803495407f},
-std::array<float,2>{0.830899835f, 0.586731136f},
-std::array<float,2>{0.359697551f, 0.12098287f},
-std::array<float,2>{0.695461452f, 0.210901782f},
-std::array<float,2>{0.197320566f, 0.663226902f},
-std::array<float,2>{0.758351862f, 0.946208417f},
-std::array<float,2>{0.255202293f, 0.256397754f},
-std::array<float,2>{0.893213093f, 0.406742364f},
-std::array<float,2>{0.411654502f, 0.838086307f},
-std::array<float,2>{0.542814493f, 0.512187719f},
-std::array<float,2>{0.0234008301f, 0.0428831503f},
-std::array<float,2>{0.852264345f, 0.0888993368f},
-std::array<float,2>{0.318508625f, 0.60288012f},
-std::array<float,2>{0.64640528f, 0.75504458f},
-std::array<float,2>{0.175533205f, 0.473775029f},
-std::array<float,2>{0.589908719f, 0.349655867f},
-std::array<float,2>{0.112257317f, 0.890252292f},
-std::array<float,2>{0.963379741f, 0.736374617f},
-std::array<float,2>{0.48691237f, 0.168921053f},
-std::array<float,2>{0.711530149f, 0.0854007751f},
-std::array<float,2>{0.215157181f, 0.601186991f},
-std::array<float,2>{0.773441076f, 0.758521974f},
-std::array<float,2>{0.280053467f, 0.483396649f},
-std::array<float,2>{0.876348197f, 0.352968186f},
-std::array<float,2>{0.436360568f, 0.876865149f},
-std::array<float,2>{0.548817694f, 0.747374594f},
-std::array<float,2>{0.0154382838f, 0.162189141f},
-std::array<float,2>{0.861163199f, 0.218694434f},
-std::array<float,2>{0.341103792f, 0.667870343f},
-std::array<float,2>{0.632889986f, 0.939936399f},
-std::array<float,2>{0.159247324f, 0.265127093f},
-std::array<float,2>{0.574900508f, 0.421804339f},
-std::array<float,2>{0.108183995f, 0.830937862f},
-std::array<float,2>{0.943337977f, 0.504904687f},
-std::array<float,2>{0.471024901f, 0.0338855237f},
-std::array<float,2>{0.515970051f, 0.143502831f},
-std::array<float,2>{0.0331433564f, 0.697539628f},
-std::array<float,2>{0.920623362f, 0.924542367f},
-std::array<float,2>{0.379873037f, 0.328151345f},
-std::array<float,2>{0.783530116f, 0.464686841f},
-std::array<float,2>{0.294867277f, 0.807748199f},
-std::array<float,2>{0.748230875f, 0.579375207f},
-std::array<float,2>{0.230707675f, 0.111137651f},
-std::array<float,2>{0.995313644f, 0.0169098228f},
-std::array<float,2>{0.450420409f, 0.548247635f},
-std::array<float,2>{0.603472948f, 0.8667413f},
-std::array<float,2>{0.0855540782f, 0.401416332f},
-std::array<float,2>{0.670369744f, 0.283975124f},
-std::array<float,2>{0.136337891f, 0.976997852f},
-std::array<float,2>{0.82229054f, 0.65617317f},
-std::array<float,2>{0.357941806f, 0.234737158f},
-std::array<float,2>{0.622574925f, 0.05598047f},
-std::array<float,2>{0.0652104765f, 0.526941836f},
-std::array<float,2>{0.972652793f, 0.825418651f},
-std::array<float,2>{0.465733528f, 0.429975599f},
-std::array<float,2>{0.832785904f, 0.266406327f},
-std::array<float,2>{0.365869462f, 0.955894113f},
-std::array<float,2>{0.682230055f, 0.673712313f},
-std::array<float,2>{0.146063522f, 0.19226037f},
-std::array<float,2>{0.926703155f, 0.179417759f},
-std::array<float,2>{0.398029f, 0.723682225f},
-std::array<float,2>{0.513810456f, 0.896837115f},
-std::array<float,2>{0.0620295666f, 0.359613329f},
-std::array<float,2>{0.73431772f, 0.484657854f},
-std::array<float,2>{0.23895219f, 0.781149745f},
-std::array<float,2>{0.803070426f, 0.614883721f},
-std::array<float,2>{0.300487101f, 0.0755592361f},
-std::array<float,2>{0.64305532f, 0.225262254f},
-std::array<float,2>{0.177147821f, 0.640027344f},
-std::array<float,2>{0.858613014f, 0.998494804f},
-std::array<float,2>{0.313988537f, 0.305437058f},
-std::array<float,2>{0.96636802f, 0.386039436f},
-std::array<float,2>{0.489428908f, 0.857277632f},
-std::array<float,2>{0.586426914f, 0.543153942f},
-std::array<float,2>{0.116677366f, 0.00786630996f},
-std::array<float,2>{0.763824344f, 0.097703442f},
-std::array<float,2>{0.250949651f, 0.572365999f},
-std::array<float,2>{0.701322436f, 0.792463779f},
-std::array<float,2>{0.201121956f, 0.447660148f},
-std::array<float,2>{0.545872211f, 0.318371177f},
-std::array<float,2>{0.016349528f, 0.915277064f},
-std::array<float,2>{0.896011472f, 0.713725567f},
-std::array<float,2>{0.409175873f, 0.134689599f},
-std::array<float,2>{0.672408581f, 0.00195281906f},
-std::array<float,2>{0.15004918f, 0.536718726f},
-std::array<float,2>{0.839715302f, 0.844010413f},
-std::array<float,2>{0.371767342f, 0.382511586f},
-std::array<float,2>{0.981783867f, 0.301762551f},
-std::array<float,2>{0.454050094f, 0.987233996f},
-std::array<float,2>{0.61546427f, 0.630855501f},
-std::array<float,2>{0.0733376145f, 0.228348807f},
-std::array<float,2>{0.811208844f, 0.130463526f},
-std::array<float,2>{0.310629457f, 0.710464239f},
-std::array<float,2>{0.723765969f, 0.906675816f},
-std::array<float,2>{0.247448832f, 0.322928935f},
-std::array<float,2>{0.503422439f, 0.438122898f},
-std::array<float,2>{0.05184054f, 0.785358429f},
-std::array<float,2>{0.932592034f, 0.567896843f},
-std::array<float,2>{0.398449868f, 0.105159499f},
-std::array<float,2>{0.584210753f, 0.198210821f},
-std::array<float,2>{0.123208515f, 0.687397838f},
-std::array<float,2>{0.956293941f, 0.968616486f},
-std::array<float,2>{0.49704656f, 0.280450553f},
-std::array<float,2>{0.845009267f, 0.42579636f},
-std::array<float,2>{0.327156007f, 0.816888452f},
-std::array<float,2>{0.652295053f, 0.519816339f},
-std::array<float,2>{0.183933958f, 0.0503562465f},
-std::array<float,2>{0.90328747f, 0.0698059499f},
-std::array<float,2>{0.415882856f, 0.619992375f},
-std::array<float,2>{0.533323944f, 0.771517217f},
-std::array<float,2>{0.0274415556f, 0.498559326f},
-std::array<float,2>{0.690326273f, 0.368437886f},
-std::array<float,2>{0.187942177f, 0.898973465f},
-std::array<float,2>{0.750509441f, 0.728779733f},
-std::array<float,2>{0.263972491f, 0.187236741f},
-std::array<float,2>{0.56138438f, 0.123716094f},
-std::array<float,2>{0.00343626947f, 0.591982067f},
-std::array<float,2>{0.886193752f, 0.798383832f},
-std::array<float,2>{0.425088733f, 0.454215169f},
-std::array<float,2>{0.76713562f, 0.337630123f},
-std::array<float,2>{0.272645593f, 0.934396446f},
-std::array<float,2>{0.707578897f, 0.688229322f},
-std::array<float,2>{0.203803569f, 0.152594566f},
-std::array<float,2>{0.952349305f, 0.248126253f},
-std::array<float,2>{0.482448041f, 0.64491117f},
-std::array<float,2>{0.568422794f, 0.971412718f},
-std::array<float,2>{0.0951746851f, 0.292082608f},
-std::array<float,2>{0.625328898f, 0.392469823f},
-std::array<float,2>{0.168289557f, 0.86897248f},
-std::array<float,2>{0.871480823f, 0.557898283f},
-std::array<float,2>{0.331376106f, 0.0292568188f},
-std::array<float,2>{0.738405764f, 0.166285291f},
-std::array<float,2>{0.224217072f, 0.739637613f},
-std::array<float,2>{0.796053469f, 0.886102676f},
-std::array<float,2>{0.284412533f, 0.345710993f},
-std::array<float,2>{0.910318851f, 0.471445262f},
-std::array<float,2>{0.383715123f, 0.750171423f},
-std::array<float,2>{0.528810084f, 0.608015478f},
-std::array<float,2>{0.0432252698f, 0.0931045339f},
-std::array<float,2>{0.814915895f, 0.046020925f},
-std::array<float,2>{0.34874475f, 0.510170996f},
-std::array<float,2>{0.662985861f, 0.84007287f},
-std::array<float,2>{0.127581507f, 0.412854463f},
-std::array<float,2>{0.597283244f, 0.25100261f},
-std::array<float,2>{0.0898092613f, 0.950240493f},
-std::array<float,2>{0.986781776f, 0.659566224f},
-std::array<float,2>{0.44219166f, 0.203281954f},
-std::array<float,2>{0.735430598f, 0.0149073936f},
-std::array<float,2>{0.218752965f, 0.539221108f},
-std::array<float,2>{0.789645195f, 0.854696274f},
-std::array<float,2>{0.285971373f, 0.38899222f},
-std::array<float,2>{0.90869081f, 0.309521914f},
-std::array<float,2>{0.390470117f, 0.995037615f},
-std::array<float,2>{0.524084628f, 0.635391116f},
-std::array<float,2>{0.0403037369f, 0.221861914f},
-std::array<float,2>{0.818294644f, 0.140316129f},
-std::array<float,2>{0.344515026f, 0.71872437f},
-std::array<float,2>{0.657020271f, 0.921766639f},
-std::array<float,2>{0.131173387f, 0.315075904f},
-std::array<float,2>{0.601329446f, 0.452128619f},
-std::array<float,2>{0.0925887004f, 0.79619503f},
-std::array<float,2>{0.988502383f, 0.575469673f},
-std::array<float,2>{0.43852517f, 0.0966714546f},
-std::array<float,2>{0.554823637f, 0.18901512f},
-std::array<float,2>{0.00568161765f, 0.676295757f},
-std::array<float,2>{0.887652695f, 0.957327247f},
-std::array<float,2>{0.429654449f, 0.271202892f},
-std::array<float,2>{0.773278594f, 0.433685452f},
-std::array<float,2>{0.267320663f, 0.821415126f},
-std::array<float,2>{0.70475173f, 0.52807337f},
-std::array<float,2>{0.207383171f, 0.0591117516f},
-std::array<float,2>{0.945872605f, 0.0726965815f},
-std::array<float,2>{0.478843719f, 0.611705542f},
-std::array<float,2>{0.566161931f, 0.776238084f},
-std::array<float,2>{0.101146631f, 0.488520086f},
-std::array<float,2>{0.631991327f, 0.36463508f},
-std::array<float,2>{0.164196476f, 0.892512977f},
-std::array<float,2>{0.869116902f, 0.719919026f},
-std::array<float,2>{0.332462847f, 0.174213678f},
-std::array<float,2>{0.580672324f, 0.113935627f},
-std::array<float,2>{0.117393784f, 0.585618496f},
-std::array<float,2>{0.957998335f, 0.812271178f},
-std::array<float,2>{0.495233625f, 0.465277165f},
-std::array<float,2>{0.84976846f, 0.332948774f},
-std::array<float,2>{0.32049951f, 0.929051995f},
-std::array<float,2>{0.656015992f, 0.702387989f},
-std::array<float,2>{0.18299298f, 0.145667031f},
-std::array<float,2>{0.901284814f, 0.241045147f},
-std::array<float,2>{0.421630591f, 0.650232077f},
-std::array<float,2>{0.53747642f, 0.982751608f},
-std::array<float,2>{0.0265727621f, 0.286450207f},
-std::array<float,2>{0.6916641f, 0.403457046f},
-std::array<float,2>{0.191877171f, 0.862297535f},
-std::array<float,2>{0.757113993f, 0.553782463f},
-std::array<float,2>{0.259304017f, 0.0223837402f},
-std::array<float,2>{0.679314435f, 0.159719437f},
-std::array<float,2>{0.152923554f, 0.743437707f},
-std::array<float,2>{0.842582524f, 0.881037951f},
-std::array<float,2>{0.368116885f, 0.356761456f},
-std::array<float,2>{0.977991581f, 0.478819162f},
-std::array<float,2>{0.459160328f, 0.762604296f},
-std::array<float,2>{0.609798551f, 0.595564425f},
-std::array<float,2>{0.0764947906f, 0.0797410086f},
-std::array<float,2>{0.806006491f, 0.0358742028f},
-std::array<float,2>{0.305985421f, 0.503361702f},
-std::array<float,2>{0.720211327f, 0.834836543f},
-std::array<float,2>{0.243454486f, 0.414088905f},
-std::array<float,2>{0.50777787f, 0.261410415f},
-std::array<float,2>{0.0470325984f, 0.944196582f},
-std::array<float,2>{0.935590267f, 0.668887854f},
-std::array<float,2>{0.403205961f, 0.214746714f},
-std::array<float,2>{0.644539952f, 0.0869643688f},
-std::array<float,2>{0.17444481f, 0.604158878f},
-std::array<float,2>{0.852937341f, 0.756881475f},
-std::array<float,2>{0.320184082f, 0.475485623f},
-std::array<float,2>{0.963968933f, 0.348010123f},
-std::array<float,2>{0.487878412f, 0.888548553f},
-std::array<float,2>{0.590928614f, 0.735304892f},
-std::array<float,2>{0.112503946f, 0.170023084f},
-std::array<float,2>{0.75933069f, 0.208657533f},
-std::array<float,2>{0.254056513f, 0.660583735f},
-std::array<float,2>{0.696808636f, 0.947771609f},
-std::array<float,2>{0.19863537f, 0.254736066f},
-std::array<float,2>{0.541858077f, 0.409479856f},
-std::array<float,2>{0.0217216164f, 0.836015284f},
-std::array<float,2>{0.894406736f, 0.514772356f},
-std::array<float,2>{0.410740077f, 0.0397958606f},
-std::array<float,2>{0.620687366f, 0.150437817f},
-std::array<float,2>{0.068789646f, 0.694512665f},
-std::array<float,2>{0.972742736f, 0.930964112f},
-std::array<float,2>{0.463461846f, 0.342656344f},
-std::array<float,2>{0.831333637f, 0.459925413f},
-std::array<float,2>{0.360958576f, 0.802078605f},
-std::array<float,2>{0.685721993f, 0.589459956f},
-std::array<float,2>{0.143759206f, 0.117558852f},
-std::array<float,2>{0.925430477f, 0.0267776512f},
-std::array<float,2>{0.394158304f, 0.562055171f},
-std::array<float,2>{0.510546327f, 0.874254465f},
-std::array<float,2>{0.0566196144f, 0.395341992f},
-std::array<float,2>{0.728460968f, 0.294864058f},
-std::array<float,2>{0.235445574f, 0.975250363f},
-std::array<float,2>{0.797182977f, 0.644395769f},
-std::array<float,2>{0.303325206f, 0.245468795f},
-std::array<float,2>{0.521088302f, 0.0542090051f},
-std::array<float,2>{0.036377728f, 0.517499745f},
-std::array<float,2>{0.914522588f, 0.812764108f},
-std::array<float,2>{0.375031978f, 0.423735619f},
-std::array<float,2>{0.788275838f, 0.276624203f},
-std::array<float,2>{0.289114207f, 0.962235153f},
-std::array<float,2>{0.743357718f, 0.682884157f},
-std::array<float,2>{0.227843508f, 0.200780824f},
-std::array<float,2>{0.999613762f, 0.182559177f},
-std::array<float,2>{0.445796162f, 0.733092904f},
-std::array<float,2>{0.60916549f, 0.905023575f},
-std::array<float,2>{0.0798987299f, 0.371619523f},
-std::array<float,2>{0.665151298f, 0.495100945f},
-std::array<float,2>{0.140533164f, 0.765823185f},
-std::array<float,2>{0.825347722f, 0.623511851f},
-std::array<float,2>{0.351959556f, 0.0627926886f},
-std::array<float,2>{0.71677202f, 0.23425971f},
-std::array<float,2>{0.214455247f, 0.625023901f},
-std::array<float,2>{0.779383004f, 0.989599347f},
-std::array<float,2>{0.27513507f, 0.297469854f},
-std::array<float,2>{0.881592453f, 0.375846565f},
-std::array<float,2>{0.432486624f, 0.851415515f},
-std::array<float,2>{0.554578066f, 0.533529162f},
-std::array<float,2>{0.00808452349f, 0.00516015384f},
-std::array<float,2>{0.863514066f, 0.10793642f},
-std::array<float,2>{0.336692005f, 0.56321305f},
-std::array<float,2>{0.637295187f, 0.783711016f},
-std::array<float,2>{0.161955982f, 0.444399387f},
-std::array<float,2>{0.57178992f, 0.327623308f},
-std::array<float,2>{0.102073304f, 0.913424432f},
-std::array<float,2>{0.941402912f, 0.706776202f},
-std::array<float,2>{0.475297868f, 0.126774952f},
-std::array<float,2>{0.703080773f, 0.100700103f},
-std::array<float,2>{0.19964768f, 0.571383893f},
-std::array<float,2>{0.765042186f, 0.78996706f},
-std::array<float,2>{0.251061589f, 0.446430892f},
-std::array<float,2>{0.895293713f, 0.317492038f},
-std::array<float,2>{0.409215927f, 0.917597353f},
-std::array<float,2>{0.54605937f, 0.712653518f},
-std::array<float,2>{0.0166807678f, 0.136351004f},
-std::array<float,2>{0.858178616f, 0.223368198f},
-std::array<float,2>{0.312745512f, 0.63857758f},
-std::array<float,2>{0.644232631f, 0.9976421f},
-std::array<float,2>{0.176450491f, 0.308335513f},
-std::array<float,2>{0.587281823f, 0.384258509f},
-std::array<float,2>{0.115465842f, 0.858141184f},
-std::array<float,2>{0.965283573f, 0.546133876f},
-std::array<float,2>{0.488592446f, 0.0104731964f},
-std::array<float,2>{0.515240371f, 0.177006215f},
-std::array<float,2>{0.0609559491f, 0.725812554f},
-std::array<float,2>{0.926967502f, 0.895073295f},
-std::array<float,2>{0.397229433f, 0.363170803f},
-std::array<float,2>{0.804247022f, 0.488012165f},
-std::array<float,2>{0.299235135f, 0.778526008f},
-std::array<float,2>{0.732964277f, 0.61581558f},
-std::array<float,2>{0.239312783f, 0.077998966f},
-std::array<float,2>{0.97138828f, 0.0570425577f},
-std::array<float,2>{0.466194123f, 0.52480185f},
-std::array<float,2>{0.621486783f, 0.826512992f},
-std::array<float,2>{0.0659768134f, 0.43220529f},
-std::array<float,2>{0.68317914f, 0.268447757f},
-std::array<float,2>{0.145315945f, 0.954640806f},
-std::array<float,2>{0.833973348f, 0.674435318f},
-std::array<float,2>{0.366212845f, 0.193511501f},
-std::array<float,2>{0.602456331f, 0.0194381215f},
-std::array<float,2>{0.0848932639f, 0.549046099f},
-std::array<float,2>{0.994950294f, 0.864803314f},
-std::array<float,2>{0.449826926f, 0.398513556f},
-std::array<float,2>{0.823939204f, 0.28306663f},
-std::array<float,2>{0.359278232f, 0.979462445f},
-std::array<float,2>{0.671527207f, 0.653359592f},
-std::array<float,2>{0.135252893f, 0.237162158f},
-std::array<float,2>{0.920919299f, 0.141076565f},
-std::array<float,2>{0.380420178f, 0.696631372f},
-std::array<float,2>{0.516918302f, 0.923367262f},
-std::array<float,2>{0.0314361304f, 0.330790728f},
-std::array<float,2>{0.749728501f, 0.461859494f},
-std::array<float,2>{0.232085586f, 0.806185722f},
-std::array<float,2>{0.784627736f, 0.58058399f},
-std::array<float,2>{0.293276787f, 0.112781107f},
-std::array<float,2>{0.634364605f, 0.215549901f},
-std::array<float,2>{0.158342153f, 0.665506661f},
-std::array<float,2>{0.86025393f, 0.939171255f},
-std::array<float,2>{0.340455055f, 0.263632566f},
-std::array<float,2>{0.941420317f, 0.418228656f},
-std::array<float,2>{0.471945226f, 0.82812798f},
-std::array<float,2>{0.575337946f, 0.507727444f},
-std::array<float,2>{0.109133855f, 0.033089716f},
-std::array<float,2>{0.7752949f, 0.083541058f},
-std::array<float,2>{0.280406266f, 0.598074377f},
-std::array<float,2>{0.7119205f, 0.761170566f},
-std::array<float,2>{0.216048196f, 0.481609643f},
-std::array<float,2>{0.546898544f, 0.354937524f},
-std::array<float,2>{0.0140389865f, 0.878149271f},
-std::array<float,2>{0.875586033f, 0.749381602f},
-std::array<float,2>{0.437333882f, 0.161558047f},
-std::array<float,2>{0.663522482f, 0.0433133505f},
-std::array<float,2>{0.128148958f, 0.509616315f},
-std::array<float,2>{0.815531611f, 0.842409372f},
-std::array<float,2>{0.348173171f, 0.411994755f},
-std::array<float,2>{0.987601817f, 0.252305746f},
-std::array<float,2>{0.443229347f, 0.95271939f},
-std::array<float,2>{0.596598744f, 0.657607317f},
-std::array<float,2>{0.0880382061f, 0.205917031f},
-std::array<float,2>{0.795527637f, 0.164297253f},
-std::array<float,2>{0.283820361f, 0.74101311f},
-std::array<float,2>{0.739893556f, 0.884420455f},
-std::array<float,2>{0.222794667f, 0.345278174f},
-std::array<float,2>{0.528037071f, 0.468825698f},
-std::array<float,2>{0.0447124168f, 0.753375173f},
-std::array<float,2>{0.911471844f, 0.605507135f},
-std::array<float,2>{0.384283721f, 0.0904421583f},
-std::array<float,2>{0.569581807f, 0.246868268f},
-std::array<float,2>{0.0940020457f, 0.647873282f},
-std::array<float,2>{0.951764762f, 0.968879938f},
-std::array<float,2>{0.484261483f, 0.289817631f},
-std::array<float,2>{0.872438014f, 0.393818796f},
-std::array<float,2>{0.330267698f, 0.869452357f},
-std::array<float,2>{0.626777053f, 0.556368291f},
-std::array<float,2>{0.169646978f, 0.0305790268f},
-std::array<float,2>{0.885629416f, 0.12221244f},
-std::array<float,2>{0.424775898f, 0.591617584f},
-std::array<float,2>{0.561930835f, 0.800459445f},
-std::array<float,2>{0.00287010288f, 0.45675528f},
-std::array<float,2>{0.708408952f, 0.337974399f},
-std::array<float,2>{0.204123929f, 0.936449647f},
-std::array<float,2>{0.766425073f, 0.690351367f},
-std::array<float,2>{0.271564454f, 0.154586315f},
-std::array<float,2>{0.534383774f, 0.0680797845f},
-std::array<float,2>{0.0286267772f, 0.618878305f},
-std::array<float,2>{0.903682053f, 0.769761682f},
-std::array<float,2>{0.414983422f, 0.497602612f},
-std::array<float,2>{0.75170362f, 0.369168133f},
-std::array<float,2>{0.264927685f, 0.900483608f},
-std::array<float,2>{0.691234112f, 0.727765799f},
-std::array<float,2>{0.189120203f, 0.184257701f},
-std::array<float,2>{0.955801129f, 0.196189567f},
-std::array<float,2>{0.498000503f, 0.684926987f},
-std::array<float,2>{0.585896492f, 0.965274274f},
-std::array<float,2>{0.124896549f, 0.278558016f},
-std::array<float,2>{0.650746167f, 0.427991897f},
-std::array<float,2>{0.1854918f, 0.81964016f},
-std::array<float,2>{0.844213665f, 0.522474051f},
-std::array<float,2>{0.326800108f, 0.0482011549f},
-std::array<float,2>{0.723298907f, 0.132639334f},
-std::array<float,2>{0.246141434f, 0.708746493f},
-std::array<float,2>{0.81176573f, 0.909378648f},
-std::array<float,2>{0.312286407f, 0.320444793f},
-std::array<float,2>{0.93358767f, 0.439496577f},
-std::array<float,2>{0.399676383f, 0.787331939f},
-std::array<float,2>{0.502806962f, 0.568620741f},
-std::array<float,2>{0.0510389991f, 0.102733023f},
-std::array<float,2>{0.838071704f, 0.00283246813f},
-std::array<float,2>{0.372316629f, 0.538282454f},
-std::array<float,2>{0.672882318f, 0.846876144f},
-std::array<float,2>{0.149101332f, 0.380814254f},
-std::array<float,2>{0.61646682f, 0.303163946f},
-std::array<float,2>{0.0728673637f, 0.98455143f},
-std::array<float,2>{0.981343746f, 0.632573605f},
-std::array<float,2>{0.454110861f, 0.23029843f},
-std::array<float,2>{0.706267238f, 0.0621797144f},
-std::array<float,2>{0.209440634f, 0.530936897f},
-std::array<float,2>{0.769977748f, 0.822597563f},
-std::array<float,2>{0.268104523f, 0.437018961f},
-std::array<float,2>{0.889641643f, 0.272906899f},
-std::array<float,2>{0.427229196f, 0.960870445f},
-std::array<float,2>{0.557383895f, 0.679481268f},
-std::array<float,2>{0.00740133505f, 0.191176683f},
-std::array<float,2>{0.870386481f, 0.172314554f},
-std::array<float,2>{0.334276885f, 0.722498596f},
-std::array<float,2>{0.630424857f, 0.892794311f},
-std::array<float,2>{0.166901544f, 0.366774321f},
-std::array<float,2>{0.563299298f, 0.490926206f},
-std::array<float,2>{0.0992752016f, 0.773546457f},
-std::array<float,2>{0.94803828f, 0.609821498f},
-std::array<float,2>{0.47791791f, 0.0711667016f},
-std::array<float,2>{0.526242316f, 0.220430776f},
-std::array<float,2>{0.0417794585f, 0.633669674f},
-std::array<float,2>{0.906390011f, 0.993344784f},
-std::array<float,2>{0.388153017f, 0.311611384f},
-std::array<float,2>{0.791623712f, 0.387168199f},
-std::array<float,2>{0.287862539f, 0.852310002f},
-std::array<float,2>{0.737150192f, 0.541361809f},
-std::array<float,2>{0.22235328f, 0.0130391335f},
-std::array<float,2>{0.991153419f, 0.0940356925f},
-std::array<float,2>{0.440220147f, 0.577264845f},
-std::array<float,2>{0.599085212f, 0.794290841f},
-std::array<float,2>{0.0905231237f, 0.449552774f},
-std::array<float,2>{0.660105467f, 0.313117355f},
-std::array<float,2>{0.130433723f, 0.919790924f},
-std::array<float,2>{0.819736898f, 0.715201557f},
-std::array<float,2>{0.347081482f, 0.136764988f},
-std::array<float,2>{0.612400293f, 0.0811406896f},
-std::array<float,2>{0.0745873824f, 0.595905662f},
-std::array<float,2>{0.978787482f, 0.764446259f},
-std::array<float,2>{0.457745343f, 0.4779706f},
-std::array<float,2>{0.840906262f, 0.357548684f},
-std::array<float,2>{0.369993329f, 0.879798114f},
-std::array<float,2>{0.676941991f, 0.744402587f},
-std::array<float,2>{0.154661149f, 0.156320646f},
-std::array<float,2>{0.933798015f, 0.211457819f},
-std::array<float,2>{0.405430466f, 0.671802759f},
-std::array<float,2>{0.50518012f, 0.94169879f},
-std::array<float,2>{0.0495798439f, 0.258850694f},
-std::array<float,2>{0.720962942f, 0.416772872f},
-std::array<float,2>{0.245592207f, 0.833611846f},
-std::array<float,2>{0.80731684f, 0.500652432f},
-std::array<float,2>{0.307127714f, 0.0372927487f},
-std::array<float,2>{0.65306139f, 0.14768064f},
-std::array<float,2>{0.17990762f, 0.69997716f},
-std::array<float,2>{0.847929597f, 0.926204145f},
-std::array<float,2>{0.322714925f, 0.335905492f},
-std::array<float,2>{0.960844636f, 0.468549043f},
-std::array<float,2>{0.492451698f, 0.809990585f},
-std::array<float,2>{0.578210711f, 0.582691491f},
-std::array<float,2>{0.119821265f, 0.116191112f},
-std::array<float,2>{0.755541503f, 0.0196003616f},
-std::array<float,2>{0.261107534f, 0.551752269f},
-std::array<float,2>{0.695171416f, 0.860416234f},
-std::array<float,2>{0.193705574f, 0.406003684f},
-std::array<float,2>{0.53573221f, 0.288978606f},
-std::array<float,2>{0.0246252194f, 0.980480731f},
-std::array<float,2>{0.899579406f, 0.651644945f},
-std::array<float,2>{0.418282241f, 0.239105448f},
-std::array<float,2>{0.684215665f, 0.119701914f},
-std::array<float,2>{0.14173767f, 0.587021053f},
-std::array<float,2>{0.828265905f, 0.804509819f},
-std::array<float,2>{0.362852454f, 0.458515972f},
-std::array<float,2>{0.975949168f, 0.339917421f},
-std::array<float,2>{0.462664425f, 0.932432532f},
-std::array<float,2>{0.617755473f, 0.69311893f},
-std::array<float,2>{0.0671254992f, 0.150239378f},
-std::array<float,2>{0.799333036f, 0.242748842f},
-std::array<float,2>{0.30165717f, 0.640782177f},
-std::array<float,2>{0.728901088f, 0.972885609f},
-std::array<float,2>{0.236689791f, 0.295534194f},
-std::array<float,2>{0.509522796f, 0.398380727f},
-std::array<float,2>{0.0583544672f, 0.871973336f},
-std::array<float,2>{0.92271632f, 0.560363412f},
-std::array<float,2>{0.39151907f, 0.0239715092f},
-std::array<float,2>{0.593407333f, 0.169591442f},
-std::array<float,2>{0.109945662f, 0.738134563f},
-std::array<float,2>{0.961253822f, 0.889334917f},
-std::array<float,2>{0.48486501f, 0.350674152f},
-std::array<float,2>{0.853637695f, 0.47272408f},
-std::array<float,2>{0.317263812f, 0.754254699f},
-std::array<float,2>{0.648311496f, 0.602196157f},
-std::array<float,2>{0.173716262f, 0.0879156888f},
-std::array<float,2>{0.892388999f, 0.0412475429f},
-std::array<float,2>{0.413081706f, 0.512809753f},
-std::array<float,2>{0.540925205f, 0.838933051f},
-std::array<float,2>{0.0207007974f, 0.407737315f},
-std::array<float,2>{0.697698414f, 0.256908536f},
-std::array<float,2>{0.195957407f, 0.946849942f},
-std::array<float,2>{0.761031926f, 0.662840188f},
-std::array<float,2>{0.256829888f, 0.209746346f},
-std::array<float,2>{0.551651895f, 0.00694481889f},
-std::array<float,2>{0.0115101468f, 0.532779276f},
-std::array<float,2>{0.879092932f, 0.849529266f},
-std::array<float,2>{0.43097499f, 0.378658205f},
-std::array<float,2>{0.778569698f, 0.29988721f},
-std::array<float,2>{0.276335448f, 0.991713941f},
-std::array<float,2>{0.718390107f, 0.6280846f},
-std::array<float,2>{0.212099284f, 0.231619596f},
-std::array<float,2>{0.937609434f, 0.127826363f},
-std::array<float,2>{0.474477679f, 0.703447998f},
-std::array<float,2>{0.572366059f, 0.910865068f},
-std::array<float,2>{0.104451723f, 0.325278193f},
-std::array<float,2>{0.639379561f, 0.443142176f},
-std::array<float,2>{0.162241921f, 0.781706035f},
-std::array<float,2>{0.865586102f, 0.565857649f},
-std::array<float,2>{0.339821666f, 0.105725259f},
-std::array<float,2>{0.74521637f, 0.202519521f},
-std::array<float,2>{0.229732439f, 0.680599988f},
-std::array<float,2>{0.785744607f, 0.964638412f},
-std::array<float,2>{0.292148948f, 0.274784684f},
-std::array<float,2>{0.917236507f, 0.424454093f},
-std::array<float,2>{0.378801316f, 0.816218317f},
-std::array<float,2>{0.522064745f, 0.519190073f},
-std::array<float,2>{0.0382152945f, 0.0511300378f},
-std::array<float,2>{0.828055561f, 0.065770492f},
-std::array<float,2>{0.3550255f, 0.622224391f},
-std::array<float,2>{0.666869938f, 0.768792689f},
-std::array<float,2>{0.138083473f, 0.49310109f},
-std::array<float,2>{0.60613209f, 0.374209821f},
-std::array<float,2>{0.0808624774f, 0.902357042f},
-std::array<float,2>{0.997407496f, 0.731357753f},
-std::array<float,2>{0.448942035f, 0.180188388f},
-std::array<float,2>{0.732214332f, 0.074835144f},
-std::array<float,2>{0.240736678f, 0.613451242f},
-std::array<float,2>{0.801538467f, 0.779725194f},
-std::array<float,2>{0.298249096f, 0.486295015f},
-std::array<float,2>{0.9281708f, 0.360869646f},
-std::array<float,2>{0.396429271f, 0.897922814f},
-std::array<float,2>{0.512946546f, 0.72305274f},
-std::array<float,2>{0.0595646501f, 0.178178981f},
-std::array<float,2>{0.83417356f, 0.193119451f},
-std::array<float,2>{0.364295006f, 0.672002852f},
-std::array<float,2>{0.681560099f, 0.956068099f},
-std::array<float,2>{0.147660971f, 0.267557651f},
-std::array<float,2>{0.624947369f, 0.430877566f},
-std::array<float,2>{0.0636134297f, 0.82430625f},
-std::array<float,2>{0.969640076f, 0.526191533f},
-std::array<float,2>{0.467959374f, 0.0553458519f},
-std::array<float,2>{0.54352212f, 0.133716777f},
-std::array<float,2>{0.0191417634f, 0.714166582f},
-std::array<float,2>{0.896910369f, 0.914865017f},
-std::array<float,2>{0.407619983f, 0.319994926f},
-std::array<float,2>{0.762037516f, 0.449016333f},
-std::array<float,2>{0.252521187f, 0.79167676f},
-std::array<float,2>{0.700154722f, 0.573970139f},
-std::array<float,2>{0.201337129f, 0.099111788f},
-std::array<float,2>{0.967514515f, 0.00938605051f},
-std::array<float,2>{0.49050498f, 0.544080734f},
-std::array<float,2>{0.588958979f, 0.856226087f},
-std::array<float,2>{0.114068575f, 0.384859622f},
-std::array<float,2>{0.642550886f, 0.306353927f},
-std::array<float,2>{0.178596511f, 0.99906534f},
-std::array<float,2>{0.855763257f, 0.639584482f},
-std::array<float,2>{0.315171421f, 0.225722328f},
-std::array<float,2>{0.577154636f, 0.0343416594f},
-std::array<float,2>{0.107214615f, 0.503912747f},
-std::array<float,2>{0.944072843f, 0.831540227f},
-std::array<float,2>{0.469342619f, 0.420324057f},
-std::array<float,2>{0.861364603f, 0.264539301f},
-std::array<float,2>{0.343564302f, 0.940865517f},
-std::array<float,2>{0.636453629f, 0.666136265f},
-std::array<float,2>{0.156809166f, 0.21711801f},
-std::array<float,2>{0.878214359f, 0.163916066f},
-std::array<float,2>{0.43361333f, 0.746357143f},
-std::array<float,2>{0.549819291f, 0.875896573f},
-std::array<float,2>{0.0134852575f, 0.352418214f},
-std::array<float,2>{0.712962985f, 0.483889043f},
-std::array<float,2>{0.218630046f, 0.759621918f},
-std::array<float,2>{0.777098596f, 0.599819303f},
-std::array<float,2>{0.278910398f, 0.0845911875f},
-std::array<float,2>{0.669184685f, 0.236313134f},
-std::array<float,2>{0.134243205f, 0.655205011f},
-std::array<float,2>{0.820462883f, 0.977853835f},
-std::array<float,2>{0.355609894f, 0.284870118f},
-std::array<float,2>{0.99246341f, 0.400883853f},
-std::array<float,2>{0.45189783f, 0.8653754f},
-std::array<float,2>{0.604287803f, 0.547269046f},
-std::array<float,2>{0.083768934f, 0.0157673173f},
-std::array<float,2>{0.781810343f, 0.109529033f},
-std::array<float,2>{0.295797795f, 0.57830137f},
-std::array<float,2>{0.746867418f, 0.806915939f},
-std::array<float,2>{0.232455045f, 0.463824123f},
-std::array<float,2>{0.519463122f, 0.329970509f},
-std::array<float,2>{0.0344203748f, 0.924940109f},
-std::array<float,2>{0.919159174f, 0.699162781f},
-std::array<float,2>{0.381394774f, 0.143698886f},
-std::array<float,2>{0.627650321f, 0.0275448747f},
-std::array<float,2>{0.171434686f, 0.557581782f},
-std::array<float,2>{0.874510348f, 0.867229879f},
-std::array<float,2>{0.328713983f, 0.391229361f},
-std::array<float,2>{0.951041162f, 0.291576862f},
-std::array<float,2>{0.482018024f, 0.972337902f},
-std::array<float,2>{0.568056822f, 0.646135271f},
-std::array<float,2>{0.0975563377f, 0.249536186f},
-std::array<float,2>{0.768301189f, 0.153763875f},
-std::array<float,2>{0.270340025f, 0.688994884f},
-std::array<float,2>{0.710332096f, 0.935203195f},
-std::array<float,2>{0.20598717f, 0.336366028f},
-std::array<float,2>{0.559681594f, 0.453627735f},
-std::array<float,2>{2.07248104e-05f, 0.797014415f},
-std::array<float,2>{0.883634508f, 0.593533516f},
-std::array<float,2>{0.422247082f, 0.124207854f},
-std::array<float,2>{0.594503105f, 0.205071017f},
-std::array<float,2>{0.0859570354f, 0.658514977f},
-std::array<float,2>{0.985310912f, 0.949348032f},
-std::array<float,2>{0.445193112f, 0.25017494f},
-std::array<float,2>{0.814234495f, 0.413546145f},
-std::array<float,2>{0.350827664f, 0.841458857f},
-std::array<float,2>{0.66050601f, 0.510837078f},
-std::array<float,2>{0.12536782f, 0.0458514616f},
-std::array<float,2>{0.913458407f, 0.0927557796f},
-std::array<float,2>{0.386357963f, 0.60901022f},
-std::array<float,2>{0.530861795f, 0.751390398f},
-std::array<float,2>{0.0452619456f, 0.471709818f},
-std::array<float,2>{0.741168678f, 0.347551256f},
-std::array<float,2>{0.226509914f, 0.885428727f},
-std::array<float,2>{0.794120848f, 0.739030302f},
-std::array<float,2>{0.281353951f, 0.167407691f},
-std::array<float,2>{0.501570225f, 0.103787363f},
-std::array<float,2>{0.0543347895f, 0.566558301f},
-std::array<float,2>{0.931526959f, 0.786197722f},
-std::array<float,2>{0.401912451f, 0.438834399f},
-std::array<float,2>{0.809130013f, 0.323526651f},
-std::array<float,2>{0.309532583f, 0.907317877f},
-std::array<float,2>{0.725725591f, 0.709609032f},
-std::array<float,2>{0.24975127f, 0.129634395f},
-std::array<float,2>{0.983332753f, 0.226821199f},
-std::array<float,2>{0.455164909f, 0.629501283f},
-std::array<float,2>{0.614532232f, 0.988130212f},
-std::array<float,2>{0.0711732581f, 0.301367253f},
-std::array<float,2>{0.675267637f, 0.381689638f},
-std::array<float,2>{0.151456296f, 0.845340729f},
-std::array<float,2>{0.836825073f, 0.535893679f},
-std::array<float,2>{0.373228043f, 0.000573115889f},
-std::array<float,2>{0.688173592f, 0.186388314f},
-std::array<float,2>{0.190931708f, 0.729823351f},
-std::array<float,2>{0.753476441f, 0.900255084f},
-std::array<float,2>{0.262540877f, 0.367817402f},
-std::array<float,2>{0.905749083f, 0.499923855f},
-std::array<float,2>{0.417123854f, 0.772635937f},
-std::array<float,2>{0.5325225f, 0.620200217f},
-std::array<float,2>{0.0301210452f, 0.0689302832f},
-std::array<float,2>{0.847267866f, 0.0494724661f},
-std::array<float,2>{0.325952142f, 0.520683289f},
-std::array<float,2>{0.649631202f, 0.818072915f},
-std::array<float,2>{0.186438873f, 0.427562922f},
-std::array<float,2>{0.582607746f, 0.279802024f},
-std::array<float,2>{0.122779779f, 0.967197955f},
-std::array<float,2>{0.954369426f, 0.686153471f},
-std::array<float,2>{0.498298168f, 0.199107349f},
-std::array<float,2>{0.71805501f, 0.00543919578f},
-std::array<float,2>{0.212473676f, 0.534095943f},
-std::array<float,2>{0.779271066f, 0.850609303f},
-std::array<float,2>{0.275636315f, 0.375256598f},
-std::array<float,2>{0.879701972f, 0.297319978f},
-std::array<float,2>{0.43144545f, 0.989854217f},
-std::array<float,2>{0.551135063f, 0.625853956f},
-std::array<float,2>{0.0110218599f, 0.233626947f},
-std::array<float,2>{0.866207123f, 0.126244247f},
-std::array<float,2>{0.339125782f, 0.706218421f},
-std::array<float,2>{0.639086843f, 0.913993776f},
-std::array<float,2>{0.162684247f, 0.3276878f},
-std::array<float,2>{0.572767973f, 0.445245683f},
-std::array<float,2>{0.103821285f, 0.78357482f},
-std::array<float,2>{0.93802166f, 0.56289804f},
-std::array<float,2>{0.474098742f, 0.107500888f},
-std::array<float,2>{0.521720707f, 0.200329557f},
-std::array<float,2>{0.0386950038f, 0.683240235f},
-std::array<float,2>{0.917701721f, 0.962652147f},
-std::array<float,2>{0.378038198f, 0.277035415f},
-std::array<float,2>{0.785269141f, 0.423205435f},
-std::array<float,2>{0.29281196f, 0.813401639f},
-std::array<float,2>{0.745937407f, 0.516687095f},
-std::array<float,2>{0.230047211f, 0.05373656f},
-std::array<float,2>{0.997788489f, 0.0631296337f},
-std::array<float,2>{0.448604435f, 0.623718858f},
-std::array<float,2>{0.60573101f, 0.766444087f},
-std::array<float,2>{0.0801113844f, 0.494238526f},
-std::array<float,2>{0.666030824f, 0.371477664f},
-std::array<float,2>{0.138526961f, 0.904660106f},
-std::array<float,2>{0.827276647f, 0.732872486f},
-std::array<float,2>{0.354674637f, 0.181837365f},
-std::array<float,2>{0.617250681f, 0.117959693f},
-std::array<float,2>{0.0665357038f, 0.589009285f},
-std::array<float,2>{0.976409733f, 0.802469969f},
-std::array<float,2>{0.4622491f, 0.459378719f},
-std::array<float,2>{0.829015136f, 0.342233181f},
-std::array<float,2>{0.362496883f, 0.931332827f},
-std::array<float,2>{0.684038401f, 0.694972932f},
-std::array<float,2>{0.142472103f, 0.151264876f},
-std::array<float,2>{0.922160089f, 0.245759338f},
-std::array<float,2>{0.390642226f, 0.643855512f},
-std::array<float,2>{0.509193003f, 0.974853039f},
-std::array<float,2>{0.0580830276f, 0.294136822f},
-std::array<float,2>{0.729098022f, 0.394760042f},
-std::array<float,2>{0.237156272f, 0.874966502f},
-std::array<float,2>{0.798891902f, 0.561907113f},
-std::array<float,2>{0.301251352f, 0.0270387344f},
-std::array<float,2>{0.64764744f, 0.170494676f},
-std::array<float,2>{0.173094571f, 0.734494209f},
-std::array<float,2>{0.854181409f, 0.887849927f},
-std::array<float,2>{0.316751838f, 0.348515511f},
-std::array<float,2>{0.961795092f, 0.475063831f},
-std::array<float,2>{0.484728277f, 0.757381797f},
-std::array<float,2>{0.592853725f, 0.603919744f},
-std::array<float,2>{0.109467231f, 0.0874264985f},
-std::array<float,2>{0.761481583f, 0.0392400548f},
-std::array<float,2>{0.256023347f, 0.515236735f},
-std::array<float,2>{0.698016584f, 0.836582601f},
-std::array<float,2>{0.195426792f, 0.410075665f},
-std::array<float,2>{0.54021728f, 0.254320234f},
-std::array<float,2>{0.0211382639f, 0.947676659f},
-std::array<float,2>{0.892085552f, 0.661086202f},
-std::array<float,2>{0.412278146f, 0.208138943f},
-std::array<float,2>{0.67743969f, 0.0794167146f},
-std::array<float,2>{0.154941678f, 0.594978213f},
-std::array<float,2>{0.841474414f, 0.761838734f},
-std::array<float,2>{0.369267493f, 0.479191571f},
-std::array<float,2>{0.979484677f, 0.357221603f},
-std::array<float,2>{0.457446247f, 0.881662905f},
-std::array<float,2>{0.613083422f, 0.743777573f},
-std::array<float,2>{0.0748970583f, 0.159243405f},
-std::array<float,2>{0.806646764f, 0.213894382f},
-std::array<float,2>{0.307399988f, 0.668128729f},
-std::array<float,2>{0.721340895f, 0.943674505f},
-std::array<float,2>{0.245811418f, 0.260756344f},
-std::array<float,2>{0.505547047f, 0.414721757f},
-std::array<float,2>{0.0493002236f, 0.834087074f},
-std::array<float,2>{0.934356749f, 0.503877699f},
-std::array<float,2>{0.406071156f, 0.0353747383f},
-std::array<float,2>{0.579028308f, 0.146276832f},
-std::array<float,2>{0.119281352f, 0.702874899f},
-std::array<float,2>{0.960132957f, 0.929414034f},
-std::array<float,2>{0.49306494f, 0.332149267f},
-std::array<float,2>{0.848371804f, 0.465419739f},
-std::array<float,2>{0.322849333f, 0.811910033f},
-std::array<float,2>{0.652609944f, 0.585375011f},
-std::array<float,2>{0.180356398f, 0.113582894f},
-std::array<float,2>{0.899977207f, 0.0215319023f},
-std::array<float,2>{0.418601781f, 0.55425477f},
-std::array<float,2>{0.535441756f, 0.86170274f},
-std::array<float,2>{0.0249434486f, 0.403916836f},
-std::array<float,2>{0.694364488f, 0.286658585f},
-std::array<float,2>{0.194246545f, 0.983391285f},
-std::array<float,2>{0.755046666f, 0.649774909f},
-std::array<float,2>{0.261531979f, 0.240323409f},
-std::array<float,2>{0.556983471f, 0.0590050183f},
-std::array<float,2>{0.00700206868f, 0.527423739f},
-std::array<float,2>{0.888841331f, 0.822041035f},
-std::array<float,2>{0.427606463f, 0.434213728f},
-std::array<float,2>{0.770273924f, 0.270783156f},
-std::array<float,2>{0.267599523f, 0.957995117f},
-std::array<float,2>{0.70689249f, 0.676158726f},
-std::array<float,2>{0.209922791f, 0.18860659f},
-std::array<float,2>{0.947372139f, 0.174469233f},
-std::array<float,2>{0.478324413f, 0.72031635f},
-std::array<float,2>{0.562978923f, 0.891739845f},
-std::array<float,2>{0.0989411399f, 0.365079522f},
-std::array<float,2>{0.629991531f, 0.488929272f},
-std::array<float,2>{0.166101471f, 0.775650024f},
-std::array<float,2>{0.870767057f, 0.612285495f},
-std::array<float,2>{0.334509641f, 0.0729320124f},
-std::array<float,2>{0.736795545f, 0.222241327f},
-std::array<float,2>{0.221872434f, 0.634888589f},
-std::array<float,2>{0.791217566f, 0.994502127f},
-std::array<float,2>{0.287240058f, 0.308785111f},
-std::array<float,2>{0.906766236f, 0.389252901f},
-std::array<float,2>{0.388393134f, 0.855085969f},
-std::array<float,2>{0.525534034f, 0.539791346f},
-std::array<float,2>{0.0411829799f, 0.0154058756f},
-std::array<float,2>{0.820146978f, 0.0960591063f},
-std::array<float,2>{0.34753418f, 0.576093733f},
-std::array<float,2>{0.659435332f, 0.796574235f},
-std::array<float,2>{0.13003476f, 0.451172292f},
-std::array<float,2>{0.59937948f, 0.314610422f},
-std::array<float,2>{0.0900684744f, 0.921261787f},
-std::array<float,2>{0.990674675f, 0.717869341f},
-std::array<float,2>{0.439479083f, 0.139898092f},
-std::array<float,2>{0.726227403f, 0.103334002f},
-std::array<float,2>{0.249324545f, 0.569276333f},
-std::array<float,2>{0.809036255f, 0.788071096f},
-std::array<float,2>{0.308634758f, 0.440013081f},
-std::array<float,2>{0.931143343f, 0.321009696f},
-std::array<float,2>{0.401439428f, 0.90968883f},
-std::array<float,2>{0.501414061f, 0.708232224f},
-std::array<float,2>{0.0537719727f, 0.132209092f},
-std::array<float,2>{0.836363316f, 0.229873732f},
-std::array<float,2>{0.373667419f, 0.63189733f},
-std::array<float,2>{0.675372183f, 0.984920859f},
-std::array<float,2>{0.151977167f, 0.303643703f},
-std::array<float,2>{0.614898026f, 0.380228758f},
-std::array<float,2>{0.0703336596f, 0.847337425f},
-std::array<float,2>{0.982507467f, 0.538981318f},
-std::array<float,2>{0.455763787f, 0.00237516034f},
-std::array<float,2>{0.533196926f, 0.183876872f},
-std::array<float,2>{0.029403897f, 0.728184223f},
-std::array<float,2>{0.905837059f, 0.901052296f},
-std::array<float,2>{0.417859852f, 0.370030165f},
-std::array<float,2>{0.753225446f, 0.497168511f},
-std::array<float,2>{0.261742622f, 0.770276189f},
-std::array<float,2>{0.687866271f, 0.61848402f},
-std::array<float,2>{0.190572634f, 0.0673847422f},
-std::array<float,2>{0.954778314f, 0.048618529f},
-std::array<float,2>{0.4985497f, 0.522996128f},
-std::array<float,2>{0.582478702f, 0.820093334f},
-std::array<float,2>{0.122290909f, 0.428497493f},
-std::array<float,2>{0.650242627f, 0.279114276f},
-std::array<float,2>{0.185847387f, 0.965395212f},
-std::array<float,2>{0.847132564f, 0.685243428f},
-std::array<float,2>{0.325296581f, 0.195532247f},
-std::array<float,2>{0.567662179f, 0.0309684239f},
-std::array<float,2>{0.0970916823f, 0.555855215f},
-std::array<float,2>{0.950250745f, 0.870107234f},
-std::array<float,2>{0.481869638f, 0.394451916f},
-std::array<float,2>{0.87472266f, 0.289545566f},
-std::array<float,2>{0.328247219f, 0.969711959f},
-std::array<float,2>{0.626985312f, 0.648156583f},
-std::array<float,2>{0.171287537f, 0.246431291f},
-std::array<float,2>{0.883298099f, 0.154800192f},
-std::array<float,2>{0.422656089f, 0.689883292f},
-std::array<float,2>{0.560366094f, 0.935883343f},
-std::array<float,2>{0.00083172397f, 0.338680655f},
-std::array<float,2>{0.710707128f, 0.456315845f},
-std::array<float,2>{0.20552136f, 0.800010085f},
-std::array<float,2>{0.767968118f, 0.591054857f},
-std::array<float,2>{0.27000007f, 0.122670218f},
-std::array<float,2>{0.66104269f, 0.205232933f},
-std::array<float,2>{0.125550807f, 0.657751799f},
-std::array<float,2>{0.81364435f, 0.952545941f},
-std::array<float,2>{0.351409644f, 0.252900839f},
-std::array<float,2>{0.984528244f, 0.411238551f},
-std::array<float,2>{0.444523424f, 0.842201233f},
-std::array<float,2>{0.594113827f, 0.509157956f},
-std::array<float,2>{0.0866758525f, 0.0438295752f},
-std::array<float,2>{0.794566929f, 0.0901872069f},
-std::array<float,2>{0.281885237f, 0.605992615f},
-std::array<float,2>{0.740280569f, 0.753784418f},
-std::array<float,2>{0.225715354f, 0.469288379f},
-std::array<float,2>{0.530557036f, 0.345119268f},
-std::array<float,2>{0.0455393605f, 0.884109676f},
-std::array<float,2>{0.913737714f, 0.740618289f},
-std::array<float,2>{0.385814428f, 0.164819643f},
-std::array<float,2>{0.63580066f, 0.0326671526f},
-std::array<float,2>{0.156426236f, 0.507181346f},
-std::array<float,2>{0.862037361f, 0.828927636f},
-std::array<float,2>{0.342971176f, 0.418532372f},
-std::array<float,2>{0.943383753f, 0.263172716f},
-std::array<float,2>{0.468957484f, 0.938599646f},
-std::array<float,2>{0.578033268f, 0.665645897f},
-std::array<float,2>{0.106602371f, 0.214934602f},
-std::array<float,2>{0.776643276f, 0.162109107f},
-std::array<float,2>{0.278414875f, 0.749571919f},
-std::array<float,2>{0.713818789f, 0.878692687f},
-std::array<float,2>{0.218207955f, 0.355068266f},
-std::array<float,2>{0.550486326f, 0.482170552f},
-std::array<float,2>{0.0129493037f, 0.761484087f},
-std::array<float,2>{0.878730237f, 0.59819597f},
-std::array<float,2>{0.434214592f, 0.0831305683f},
-std::array<float,2>{0.603545547f, 0.236599207f},
-std::array<float,2>{0.0830118433f, 0.653968394f},
-std::array<float,2>{0.992683291f, 0.978812575f},
-std::array<float,2>{0.451500267f, 0.282296419f},
-std::array<float,2>{0.820927262f, 0.399010599f},
-std::array<float,2>{0.356084645f, 0.864270926f},
-std::array<float,2>{0.66960001f, 0.549522281f},
-std::array<float,2>{0.134558275f, 0.018740207f},
-std::array<float,2>{0.919672608f, 0.112948291f},
-std::array<float,2>{0.380896538f, 0.580164135f},
-std::array<float,2>{0.51863724f, 0.806120813f},
-std::array<float,2>{0.0350598022f, 0.461393505f},
-std::array<float,2>{0.746267617f, 0.330277294f},
-std::array<float,2>{0.233324587f, 0.923033297f},
-std::array<float,2>{0.781611979f, 0.697046101f},
-std::array<float,2>{0.295210838f, 0.141372904f},
-std::array<float,2>{0.513631165f, 0.0773284733f},
-std::array<float,2>{0.0586508475f, 0.615354896f},
-std::array<float,2>{0.928367257f, 0.779076993f},
-std::array<float,2>{0.395622849f, 0.487324804f},
-std::array<float,2>{0.801062465f, 0.362632394f},
-std::array<float,2>{0.298663497f, 0.894676328f},
-std::array<float,2>{0.731927037f, 0.726192474f},
-std::array<float,2>{0.240336984f, 0.177459762f},
-std::array<float,2>{0.969148576f, 0.193896547f},
-std::array<float,2>{0.468538731f, 0.674254835f},
-std::array<float,2>{0.624269128f, 0.954234719f},
-std::array<float,2>{0.064406313f, 0.26797998f},
-std::array<float,2>{0.680900097f, 0.432057977f},
-std::array<float,2>{0.148359045f, 0.826793134f},
-std::array<float,2>{0.834917247f, 0.52529037f},
-std::array<float,2>{0.365164608f, 0.0571901575f},
-std::array<float,2>{0.699356675f, 0.135792598f},
-std::array<float,2>{0.201759949f, 0.712006092f},
-std::array<float,2>{0.762454569f, 0.917036057f},
-std::array<float,2>{0.252082407f, 0.318023235f},
-std::array<float,2>{0.897177339f, 0.447101265f},
-std::array<float,2>{0.407859206f, 0.789539576f},
-std::array<float,2>{0.543194056f, 0.572171807f},
-std::array<float,2>{0.018836176f, 0.101373613f},
-std::array<float,2>{0.856273651f, 0.0101812622f},
-std::array<float,2>{0.314469427f, 0.54643178f},
-std::array<float,2>{0.641666889f, 0.857852101f},
-std::array<float,2>{0.177829012f, 0.384655923f},
-std::array<float,2>{0.589620411f, 0.308064222f},
-std::array<float,2>{0.113538705f, 0.997410893f},
-std::array<float,2>{0.966941833f, 0.637960911f},
-std::array<float,2>{0.490726858f, 0.222658753f},
-std::array<float,2>{0.743810475f, 0.0512884557f},
-std::array<float,2>{0.228477389f, 0.51885283f},
-std::array<float,2>{0.789037168f, 0.815455616f},
-std::array<float,2>{0.289992988f, 0.424015671f},
-std::array<float,2>{0.914667249f, 0.274948776f},
-std::array<float,2>{0.375863075f, 0.964297473f},
-std::array<float,2>{0.520570576f, 0.680170119f},
-std::array<float,2>{0.0367972851f, 0.202704683f},
-std::array<float,2>{0.825694144f, 0.18000102f},
-std::array<float,2>{0.352073729f, 0.730831742f},
-std::array<float,2>{0.665682614f, 0.903070152f},
-std::array<float,2>{0.140003681f, 0.374585778f},
-std::array<float,2>{0.608721256f, 0.492346913f},
-std::array<float,2>{0.0795422569f, 0.769330621f},
-std::array<float,2>{0.999441326f, 0.622847974f},
-std::array<float,2>{0.445971817f, 0.0660659894f},
-std::array<float,2>{0.553771615f, 0.232167691f},
-std::array<float,2>{0.00847196579f, 0.628495097f},
-std::array<float,2>{0.88093555f, 0.991354346f},
-std::array<float,2>{0.431965858f, 0.30064711f},
-std::array<float,2>{0.780160189f, 0.377963632f},
-std::array<float,2>{0.274783045f, 0.848763824f},
-std::array<float,2>{0.71614641f, 0.532695115f},
-std::array<float,2>{0.214131683f, 0.00734101748f},
-std::array<float,2>{0.940558374f, 0.105970368f},
-std::array<float,2>{0.474888146f, 0.5660429f},
-std::array<float,2>{0.57165736f, 0.782012045f},
-std::array<float,2>{0.101954229f, 0.442726016f},
-std::array<float,2>{0.636782408f, 0.325908512f},
-std::array<float,2>{0.161491603f, 0.910305023f},
-std::array<float,2>{0.863879859f, 0.703939259f},
-std::array<float,2>{0.336257607f, 0.127197847f},
-std::array<float,2>{0.591531634f, 0.0883835852f},
-std::array<float,2>{0.113000788f, 0.601738393f},
-std::array<float,2>{0.964528739f, 0.754715085f},
-std::array<float,2>{0.487321854f, 0.473542899f},
-std::array<float,2>{0.85328269f, 0.351295799f},
-std::array<float,2>{0.31960234f, 0.888774931f},
-std::array<float,2>{0.645174563f, 0.737448514f},
-std::array<float,2>{0.1742111f, 0.169093177f},
-std::array<float,2>{0.89361459f, 0.209387645f},
-std::array<float,2>{0.410334587f, 0.662264287f},
-std::array<float,2>{0.541143954f, 0.94668299f},
-std::array<float,2>{0.0220347065f, 0.257795244f},
-std::array<float,2>{0.696493745f, 0.407688737f},
-std::array<float,2>{0.198820442f, 0.839784682f},
-std::array<float,2>{0.759118378f, 0.513212085f},
-std::array<float,2>{0.254553378f, 0.0415992066f},
-std::array<float,2>{0.686252058f, 0.149492174f},
-std::array<float,2>{0.144478813f, 0.692502201f},
-std::array<float,2>{0.831811905f, 0.931712568f},
-std::array<float,2>{0.360662133f, 0.340640187f},
-std::array<float,2>{0.97316283f, 0.458364367f},
-std::array<float,2>{0.463197827f, 0.803814471f},
-std::array<float,2>{0.620208859f, 0.587844789f},
-std::array<float,2>{0.0691411719f, 0.119519763f},
-std::array<float,2>{0.797585964f, 0.0238198303f},
-std::array<float,2>{0.302837253f, 0.559871376f},
-std::array<float,2>{0.72787708f, 0.871108949f},
-std::array<float,2>{0.236119583f, 0.397763878f},
-std::array<float,2>{0.510231197f, 0.295064062f},
-std::array<float,2>{0.0559411347f, 0.973177433f},
-std::array<float,2>{0.925078392f, 0.641449749f},
-std::array<float,2>{0.393883914f, 0.242506236f},
-std::array<float,2>{0.655436516f, 0.115610369f},
-std::array<float,2>{0.183543012f, 0.582495213f},
-std::array<float,2>{0.850517869f, 0.810078621f},
-std::array<float,2>{0.321261287f, 0.468258977f},
-std::array<float,2>{0.957061768f, 0.335144937f},
-std::array<float,2>{0.495848745f, 0.926305771f},
-std::array<float,2>{0.580223918f, 0.699367225f},
-std::array<float,2>{0.117962539f, 0.148262531f},
-std::array<float,2>{0.757799089f, 0.238767028f},
-std::array<float,2>{0.258933723f, 0.652260721f},
-std::array<float,2>{0.692021072f, 0.981145322f},
-std::array<float,2>{0.192106068f, 0.288239807f},
-std::array<float,2>{0.537611067f, 0.405671537f},
-std::array<float,2>{0.0270349979f, 0.861262798f},
-std::array<float,2>{0.900656402f, 0.550794959f},
-std::array<float,2>{0.420956969f, 0.0202049203f},
-std::array<float,2>{0.610133767f, 0.156916335f},
-std::array<float,2>{0.0768579245f, 0.744952023f},
-std::array<float,2>{0.978236198f, 0.879260123f},
-std::array<float,2>{0.459644467f, 0.357952327f},
-std::array<float,2>{0.842010498f, 0.478226364f},
-std::array<float,2>{0.367488205f, 0.764071941f},
-std::array<float,2>{0.678770244f, 0.596310854f},
-std::array<float,2>{0.152400419f, 0.0815472826f},
-std::array<float,2>{0.936457813f, 0.0379045755f},
-std::array<float,2>{0.402549624f, 0.500011444f},
-std::array<float,2>{0.506904364f, 0.833050489f},
-std::array<float,2>{0.0474010222f, 0.416307628f},
-std::array<float,2>{0.720592618f, 0.259728551f},
-std::array<float,2>{0.244010717f, 0.942004919f},
-std::array<float,2>{0.806635976f, 0.671092927f},
-std::array<float,2>{0.3064031f, 0.211026311f},
-std::array<float,2>{0.523734093f, 0.0135556385f},
-std::array<float,2>{0.0409005918f, 0.541545928f},
-std::array<float,2>{0.908760846f, 0.851883054f},
-std::array<float,2>{0.389759243f, 0.387644589f},
-std::array<float,2>{0.789525151f, 0.312132537f},
-std::array<float,2>{0.285294533f, 0.993832827f},
-std::array<float,2>{0.736129761f, 0.633004606f},
-std::array<float,2>{0.219374478f, 0.219857991f},
-std::array<float,2>{0.989167213f, 0.137348354f},
-std::array<float,2>{0.439317554f, 0.715400159f},
-std::array<float,2>{0.600605845f, 0.919025421f},
-std::array<float,2>{0.0920813009f, 0.312635481f},
-std::array<float,2>{0.656488955f, 0.450190634f},
-std::array<float,2>{0.131457672f, 0.794635892f},
-std::array<float,2>{0.817504764f, 0.577767193f},
-std::array<float,2>{0.343975306f, 0.094696708f},
-std::array<float,2>{0.704160631f, 0.190634191f},
-std::array<float,2>{0.207770765f, 0.678847432f},
-std::array<float,2>{0.772662103f, 0.960414648f},
-std::array<float,2>{0.266937166f, 0.273297876f},
-std::array<float,2>{0.886826336f, 0.437010914f},
-std::array<float,2>{0.429062337f, 0.822899103f},
-std::array<float,2>{0.555616438f, 0.530302465f},
-std::array<float,2>{0.00509108696f, 0.0618864633f},
-std::array<float,2>{0.868455052f, 0.0706268251f},
-std::array<float,2>{0.332785904f, 0.609898388f},
-std::array<float,2>{0.632595479f, 0.774238467f},
-std::array<float,2>{0.16497086f, 0.490574718f},
-std::array<float,2>{0.565559089f, 0.366256952f},
-std::array<float,2>{0.100681551f, 0.893487632f},
-std::array<float,2>{0.945313931f, 0.722080231f},
-std::array<float,2>{0.479132831f, 0.172396958f},
-std::array<float,2>{0.690794885f, 0.0687657669f},
-std::array<float,2>{0.188638791f, 0.620667815f},
-std::array<float,2>{0.751252949f, 0.77342838f},
-std::array<float,2>{0.265477151f, 0.49935028f},
-std::array<float,2>{0.903838754f, 0.367204815f},
-std::array<float,2>{0.414461255f, 0.899896681f},
-std::array<float,2>{0.534772336f, 0.73009181f},
-std::array<float,2>{0.0289326888f, 0.186020628f},
-std::array<float,2>{0.84428364f, 0.198465586f},
-std::array<float,2>{0.326404035f, 0.685633361f},
-std::array<float,2>{0.651273429f, 0.967343032f},
-std::array<float,2>{0.185035616f, 0.279732794f},
-std::array<float,2>{0.585085154f, 0.427108407f},
-std::array<float,2>{0.124317288f, 0.817706227f},
-std::array<float,2>{0.955439627f, 0.521303833f},
-std::array<float,2>{0.497365087f, 0.0492241792f},
-std::array<float,2>{0.502343833f, 0.129084066f},
-std::array<float,2>{0.0513008423f, 0.709106803f},
-std::array<float,2>{0.932819784f, 0.907734036f},
-std::array<float,2>{0.400168628f, 0.323937267f},
-std::array<float,2>{0.812099934f, 0.439077735f},
-std::array<float,2>{0.311603546f, 0.786750257f},
-std::array<float,2>{0.722666442f, 0.566939056f},
-std::array<float,2>{0.24678503f, 0.104151934f},
-std::array<float,2>{0.980636001f, 0.000202760115f},
-std::array<float,2>{0.45502764f, 0.535409153f},
-std::array<float,2>{0.616809666f, 0.844914854f},
-std::array<float,2>{0.0727031901f, 0.381102741f},
-std::array<float,2>{0.673711598f, 0.300834954f},
-std::array<float,2>{0.148727f, 0.987564206f},
-std::array<float,2>{0.838754594f, 0.628973007f},
-std::array<float,2>{0.372802347f, 0.227078959f},
-std::array<float,2>{0.595846355f, 0.0451444089f},
-std::array<float,2>{0.0885327086f, 0.511394739f},
-std::array<float,2>{0.988185644f, 0.840940833f},
-std::array<float,2>{0.442712754f, 0.413704097f},
-std::array<float,2>{0.816078901f, 0.250943214f},
-std::array<float,2>{0.347694337f, 0.949728727f},
-std::array<float,2>{0.663754225f, 0.659041405f},
-std::array<float,2>{0.128720149f, 0.204112127f},
-std::array<float,2>{0.911712766f, 0.16768606f},
-std::array<float,2>{0.384243846f, 0.738574624f},
-std::array<float,2>{0.52751559f, 0.885109842f},
-std::array<float,2>{0.0442494676f, 0.346734285f},
-std::array<float,2>{0.739351809f, 0.472425848f},
-std::array<float,2>{0.223518029f, 0.751641035f},
-std::array<float,2>{0.795138896f, 0.608441293f},
-std::array<float,2>{0.283301711f, 0.0921213776f},
-std::array<float,2>{0.626375079f, 0.24928914f},
-std::array<float,2>{0.169373348f, 0.645677745f},
-std::array<float,2>{0.872905791f, 0.972076714f},
-std::array<float,2>{0.330792904f, 0.291159183f},
-std::array<float,2>{0.951512575f, 0.39110589f},
-std::array<float,2>{0.483414233f, 0.868041217f},
-std::array<float,2>{0.570121229f, 0.556933403f},
-std::array<float,2>{0.0944710523f, 0.0280686487f},
-std::array<float,2>{0.765906394f, 0.124679208f},
-std::array<float,2>{0.272184551f, 0.593176484f},
-std::array<float,2>{0.708674312f, 0.797787309f},
-std::array<float,2>{0.205044761f, 0.453368336f},
-std::array<float,2>{0.562095881f, 0.336585522f},
-std::array<float,2>{0.00205754675f, 0.934885025f},
-std::array<float,2>{0.885087132f, 0.688672304f},
-std::array<float,2>{0.424208194f, 0.153973997f},
-std::array<float,2>{0.671035111f, 0.0162942354f},
-std::array<float,2>{0.135465011f, 0.547364891f},
-std::array<float,2>{0.823408484f, 0.866123676f},
-std::array<float,2>{0.358670354f, 0.400537968f},
-std::array<float,2>{0.994343221f, 0.28436327f},
-std::array<float,2>{0.449279666f, 0.978278875f},
-std::array<float,2>{0.601854503f, 0.654487729f},
-std::array<float,2>{0.0839999244f, 0.235609472f},
-std::array<float,2>{0.784797966f, 0.144392535f},
-std::array<float,2>{0.29369089f, 0.698313117f},
-std::array<float,2>{0.749410629f, 0.925735414f},
-std::array<float,2>{0.231583238f, 0.329438001f},
-std::array<float,2>{0.517139494f, 0.462929755f},
-std::array<float,2>{0.031812299f, 0.80727464f},
-std::array<float,2>{0.921409428f, 0.579064429f},
-std::array<float,2>{0.379910171f, 0.110325694f},
-std::array<float,2>{0.575910926f, 0.217749506f},
-std::array<float,2>{0.10880433f, 0.666790366f},
-std::array<float,2>{0.942133665f, 0.940958977f},
-std::array<float,2>{0.472408473f, 0.263906181f},
-std::array<float,2>{0.859673202f, 0.420745105f},
-std::array<float,2>{0.340168089f, 0.831578791f},
-std::array<float,2>{0.634020984f, 0.504627764f},
-std::array<float,2>{0.159039229f, 0.0349538364f},
-std::array<float,2>{0.875282645f, 0.0842592269f},
-std::array<float,2>{0.436902463f, 0.600520253f},
-std::array<float,2>{0.547512352f, 0.75902158f},
-std::array<float,2>{0.0143286251f, 0.483614892f},
-std::array<float,2>{0.712562561f, 0.351835519f},
-std::array<float,2>{0.216737598f, 0.875061572f},
-std::array<float,2>{0.774734318f, 0.746800065f},
-std::array<float,2>{0.280944198f, 0.163354412f},
-std::array<float,2>{0.546689212f, 0.099536486f},
-std::array<float,2>{0.0171990693f, 0.573347449f},
-std::array<float,2>{0.895015299f, 0.791270196f},
-std::array<float,2>{0.409696639f, 0.448521048f},
-std::array<float,2>{0.765582204f, 0.319536895f},
-std::array<float,2>{0.251882821f, 0.914538264f},
-std::array<float,2>{0.702455163f, 0.714828908f},
-std::array<float,2>{0.199711472f, 0.132942662f},
-std::array<float,2>{0.965686798f, 0.226319641f},
-std::array<float,2>{0.489159822f, 0.639096797f},
-std::array<float,2>{0.587823093f, 0.999945164f},
-std::array<float,2>{0.115848228f, 0.3057037f},
-std::array<float,2>{0.643903255f, 0.385561824f},
-std::array<float,2>{0.176002055f, 0.855491281f},
-std::array<float,2>{0.857639492f, 0.544679523f},
-std::array<float,2>{0.313111126f, 0.00888883788f},
-std::array<float,2>{0.732641935f, 0.178665191f},
-std::array<float,2>{0.240009129f, 0.723474622f},
-std::array<float,2>{0.804154158f, 0.898050785f},
-std::array<float,2>{0.299493253f, 0.36050126f},
-std::array<float,2>{0.927674651f, 0.485746354f},
-std::array<float,2>{0.396774799f, 0.780231357f},
-std::array<float,2>{0.51486522f, 0.614237845f},
-std::array<float,2>{0.0612207651f, 0.0744909346f},
-std::array<float,2>{0.833030164f, 0.0550355688f},
-std::array<float,2>{0.366814226f, 0.525679529f},
-std::array<float,2>{0.682990432f, 0.824882567f},
-std::array<float,2>{0.145007417f, 0.43145299f},
-std::array<float,2>{0.621945798f, 0.267071098f},
-std::array<float,2>{0.0655226633f, 0.9568156f},
-std::array<float,2>{0.970740855f, 0.672708631f},
-std::array<float,2>{0.466378808f, 0.192718297f},
-std::array<float,2>{0.72728622f, 0.0260116514f},
-std::array<float,2>{0.235178798f, 0.561392963f},
-std::array<float,2>{0.79789412f, 0.873286247f},
-std::array<float,2>{0.303982437f, 0.395886719f},
-std::array<float,2>{0.924137831f, 0.292980552f},
-std::array<float,2>{0.392955422f, 0.976282597f},
-std::array<float,2>{0.510783017f, 0.64354527f},
-std::array<float,2>{0.0552988797f, 0.244616315f},
-std::array<float,2>{0.830292463f, 0.151676476f},
-std::array<float,2>{0.359867275f, 0.693694472f},
-std::array<float,2>{0.68707341f, 0.93015027f},
-std::array<float,2>{0.14278245f, 0.343059272f},
-std::array<float,2>{0.6199103f, 0.460786104f},
-std::array<float,2>{0.0701162517f, 0.801647186f},
-std::array<float,2>{0.974139094f, 0.588710606f},
-std::array<float,2>{0.464170754f, 0.118602663f},
-std::array<float,2>{0.542370319f, 0.207799256f},
-std::array<float,2>{0.0226933192f, 0.661544144f},
-std::array<float,2>{0.892858684f, 0.94905895f},
-std::array<float,2>{0.411137044f, 0.255280793f},
-std::array<float,2>{0.75829041f, 0.408463329f},
-std::array<float,2>{0.255808681f, 0.837737679f},
-std::array<float,2>{0.69591248f, 0.514571071f},
-std::array<float,2>{0.197971344f, 0.040449284f},
-std::array<float,2>{0.962977588f, 0.0867531449f},
-std::array<float,2>{0.48663646f, 0.605427325f},
-std::array<float,2>{0.590718925f, 0.756113231f},
-std::array<float,2>{0.11169821f, 0.475996196f},
-std::array<float,2>{0.645919085f, 0.349298626f},
-std::array<float,2>{0.17506136f, 0.886951208f},
-std::array<float,2>{0.851713061f, 0.735885382f},
-std::array<float,2>{0.319176316f, 0.171563596f},
-std::array<float,2>{0.570702434f, 0.109332882f},
-std::array<float,2>{0.102884069f, 0.564024627f},
-std::array<float,2>{0.93976903f, 0.78473568f},
-std::array<float,2>{0.476369351f, 0.443798512f},
-std::array<float,2>{0.864287078f, 0.326275587f},
-std::array<float,2>{0.337158442f, 0.91231513f},
-std::array<float,2>{0.63793689f, 0.705817997f},
-std::array<float,2>{0.160901949f, 0.125343964f},
-std::array<float,2>{0.882017732f, 0.232696176f},
-std::array<float,2>{0.433236331f, 0.626782358f},
-std::array<float,2>{0.553652465f, 0.989076614f},
-std::array<float,2>{0.00957357697f, 0.297907561f},
-std::array<float,2>{0.715294063f, 0.37666297f},
-std::array<float,2>{0.213526741f, 0.850582719f},
-std::array<float,2>{0.78029561f, 0.534217298f},
-std::array<float,2>{0.274191141f, 0.00410321169f},
-std::array<float,2>{0.664653301f, 0.183449596f},
-std::array<float,2>{0.138676822f, 0.734252691f},
-std::array<float,2>{0.825135469f, 0.906163692f},
-std::array<float,2>{0.352999955f, 0.372254908f},
-std::array<float,2>{0.998586655f, 0.495978802f},
-std::array<float,2>{0.446599662f, 0.767541111f},
-std::array<float,2>{0.607912123f, 0.624801874f},
-std::array<float,2>{0.0787794217f, 0.064077124f},
-std::array<float,2>{0.787590563f, 0.0531564206f},
-std::array<float,2>{0.290498793f, 0.51584965f},
-std::array<float,2>{0.74271059f, 0.813954175f},
-std::array<float,2>{0.227496207f, 0.422512472f},
-std::array<float,2>{0.520498693f, 0.276048303f},
-std::array<float,2>{0.0352575444f, 0.961241007f},
-std::array<float,2>{0.91556865f, 0.681949198f},
-std::array<float,2>{0.376241624f, 0.199843749f},
-std::array<float,2>{0.631242216f, 0.0734435245f},
-std::array<float,2>{0.165643021f, 0.612732947f},
-std::array<float,2>{0.867717385f, 0.776951671f},
-std::array<float,2>{0.333515018f, 0.48996672f},
-std::array<float,2>{0.946892619f, 0.363477796f},
-std::array<float,2>{0.479762435f, 0.890748978f},
-std::array<float,2>{0.564602435f, 0.718756676f},
-std::array<float,2>{0.0997090042f, 0.175509468f},
-std::array<float,2>{0.772060752f, 0.188042238f},
-std::array<float,2>{0.266503006f, 0.676841378f},
-std::array<float,2>{0.703569531f, 0.958259046f},
-std::array<float,2>{0.208558932f, 0.26967144f},
-std::array<float,2>{0.556297004f, 0.435141265f},
-std::array<float,2>{0.00475551933f, 0.820319235f},
-std::array<float,2>{0.888062537f, 0.52896595f},
-std::array<float,2>{0.428004414f, 0.0598037615f},
-std::array<float,2>{0.600179851f, 0.13920702f},
-std::array<float,2>{0.0928922072f, 0.717401922f},
-std::array<float,2>{0.989480495f, 0.920105577f},
-std::array<float,2>{0.437667221f, 0.31599623f},
-std::array<float,2>{0.817332089f, 0.453054667f},
-std::array<float,2>{0.345231652f, 0.795583665f},
-std::array<float,2>{0.65805757f, 0.575178862f},
-std::array<float,2>{0.131865159f, 0.0968148187f},
-std::array<float,2>{0.90939945f, 0.0138939694f},
-std::array<float,2>{0.389606327f, 0.54034102f},
-std::array<float,2>{0.524821043f, 0.853566825f},
-std::array<float,2>{0.0399291441f, 0.390547603f},
-std::array<float,2>{0.735189378f, 0.309580088f},
-std::array<float,2>{0.220541686f, 0.995217264f},
-std::array<float,2>{0.790943146f, 0.636622369f},
-std::array<float,2>{0.286343217f, 0.220996916f},
-std::array<float,2>{0.506619215f, 0.0369973257f},
-std::array<float,2>{0.0480303541f, 0.50274539f},
-std::array<float,2>{0.937227964f, 0.835702717f},
-std::array<float,2>{0.404073536f, 0.415220469f},
-std::array<float,2>{0.80471313f, 0.260354728f},
-std::array<float,2>{0.305609375f, 0.944854975f},
-std::array<float,2>{0.719278216f, 0.669352174f},
-std::array<float,2>{0.242411017f, 0.213314876f},
-std::array<float,2>{0.977196932f, 0.158627927f},
-std::array<float,2>{0.460266501f, 0.742941499f},
-std::array<float,2>{0.611307919f, 0.882664144f},
-std::array<float,2>{0.077246055f, 0.356089234f},
-std::array<float,2>{0.677898347f, 0.479751974f},
-std::array<float,2>{0.153370082f, 0.763201058f},
-std::array<float,2>{0.843352616f, 0.593984723f},
-std::array<float,2>{0.368786514f, 0.0789988041f},
-std::array<float,2>{0.692508638f, 0.241300702f},
-std::array<float,2>{0.193314746f, 0.648617446f},
-std::array<float,2>{0.756156564f, 0.983404458f},
-std::array<float,2>{0.258450389f, 0.285361141f},
-std::array<float,2>{0.901787937f, 0.402983993f},
-std::array<float,2>{0.420380622f, 0.86314255f},
-std::array<float,2>{0.538923264f, 0.553219378f},
-std::array<float,2>{0.0255929437f, 0.0226269495f},
-std::array<float,2>{0.851024926f, 0.115018681f},
-std::array<float,2>{0.321582258f, 0.584027767f},
-std::array<float,2>{0.654868484f, 0.810559809f},
-std::array<float,2>{0.182331145f, 0.466078818f},
-std::array<float,2>{0.581182122f, 0.333431453f},
-std::array<float,2>{0.118714444f, 0.927954853f},
-std::array<float,2>{0.95854032f, 0.701399267f},
-std::array<float,2>{0.494809717f, 0.145431265f},
-std::array<float,2>{0.7072317f, 0.121955186f},
-std::array<float,2>{0.203172401f, 0.590767026f},
-std::array<float,2>{0.766824603f, 0.799646854f},
-std::array<float,2>{0.273391753f, 0.455711246f},
-std::array<float,2>{0.886411309f, 0.339307547f},
-std::array<float,2>{0.425531596f, 0.936744273f},
-std::array<float,2>{0.560626447f, 0.691154718f},
-std::array<float,2>{0.00313295517f, 0.155873924f},
-std::array<float,2>{0.87164861f, 0.247444987f},
-std::array<float,2>{0.331561625f, 0.647055924f},
-std::array<float,2>{0.625559032f, 0.970270932f},
-std::array<float,2>{0.168746606f, 0.290917516f},
-std::array<float,2>{0.568871021f, 0.393326521f},
-std::array<float,2>{0.0954168215f, 0.870730817f},
-std::array<float,2>{0.953041017f, 0.555542827f},
-std::array<float,2>{0.483115911f, 0.0295950156f},
-std::array<float,2>{0.528351605f, 0.165799141f},
-std::array<float,2>{0.0438219942f, 0.74137795f},
-std::array<float,2>{0.91096139f, 0.883582354f},
-std::array<float,2>{0.383114725f, 0.343991131f},
-std::array<float,2>{0.7968418f, 0.470519423f},
-std::array<float,2>{0.28496483f, 0.752633631f},
-std::array<float,2>{0.739019275f, 0.606744885f},
-std::array<float,2>{0.223800451f, 0.0917185545f},
-std::array<float,2>{0.987029314f, 0.0441792868f},
-std::array<float,2>{0.441812366f, 0.508550882f},
-std::array<float,2>{0.596877873f, 0.843571007f},
-std::array<float,2>{0.0893552229f, 0.410664082f},
-std::array<float,2>{0.662351012f, 0.253446698f},
-std::array<float,2>{0.1270293f, 0.951415896f},
-std::array<float,2>{0.815171897f, 0.657194197f},
-std::array<float,2>{0.349238157f, 0.206603825f},
-std::array<float,2>{0.616165221f, 0.00361496117f},
-std::array<float,2>{0.0741686672f, 0.537226915f},
-std::array<float,2>{0.982417583f, 0.846391797f},
-std::array<float,2>{0.453473419f, 0.37901029f},
-std::array<float,2>{0.839031994f, 0.304641604f},
-std::array<float,2>{0.371254534f, 0.98544383f},
-std::array<float,2>{0.671877086f, 0.631580532f},
-std::array<float,2>{0.149612054f, 0.229122996f},
-std::array<float,2>{0.931843698f, 0.131734356f},
-std::array<float,2>{0.399131268f, 0.707348943f},
-std::array<float,2>{0.50306493f, 0.908223033f},
-std::array<float,2>{0.0523990579f, 0.321441919f},
-std::array<float,2>{0.724232435f, 0.440780431f},
-std::array<float,2>{0.248023942f, 0.788618505f},
-std::array<float,2>{0.810621023f, 0.569964349f},
-std::array<float,2>{0.311305791f, 0.102323465f},
-std::array<float,2>{0.651780367f, 0.196806803f},
-std::array<float,2>{0.184143245f, 0.683768511f},
-std::array<float,2>{0.845669031f, 0.965908587f},
-std::array<float,2>{0.327980638f, 0.278261185f},
-std::array<float,2>{0.956737578f, 0.428773046f},
-std::array<float,2>{0.496172011f, 0.819090426f},
-std::array<float,2>{0.584565341f, 0.521533012f},
-std::array<float,2>{0.123944886f, 0.0470574498f},
-std::array<float,2>{0.750319004f, 0.0667584762f},
-std::array<float,2>{0.264301628f, 0.61738956f},
-std::array<float,2>{0.689579189f, 0.770619988f},
-std::array<float,2>{0.188190669f, 0.496869087f},
-std::array<float,2>{0.533919573f, 0.371022701f},
-std::array<float,2>{0.0281024724f, 0.90193373f},
-std::array<float,2>{0.902647436f, 0.727142155f},
-std::array<float,2>{0.41514793f, 0.185265988f},
-std::array<float,2>{0.682043195f, 0.0581024513f},
-std::array<float,2>{0.145780221f, 0.523856044f},
-std::array<float,2>{0.83228159f, 0.82804966f},
-std::array<float,2>{0.36536327f, 0.432801992f},
-std::array<float,2>{0.971689939f, 0.269144982f},
-std::array<float,2>{0.464895129f, 0.953282356f},
-std::array<float,2>{0.622307658f, 0.675738871f},
-std::array<float,2>{0.0648760423f, 0.194401473f},
-std::array<float,2>{0.803574264f, 0.176065132f},
-std::array<float,2>{0.299914241f, 0.725389302f},
-std::array<float,2>{0.733554125f, 0.896420717f},
-std::array<float,2>{0.238357842f, 0.362259567f},
-std::array<float,2>{0.514207304f, 0.487274289f},
-std::array<float,2>{0.0619733967f, 0.778077245f},
-std::array<float,2>{0.925891519f, 0.616399586f},
-std::array<float,2>{0.397506863f, 0.0761919767f},
-std::array<float,2>{0.586040437f, 0.223907113f},
-std::array<float,2>{0.116929732f, 0.636753201f},
-std::array<float,2>{0.966102064f, 0.996903658f},
-std::array<float,2>{0.490223676f, 0.307507604f},
-std::array<float,2>{0.859306276f, 0.383758843f},
-std::array<float,2>{0.313729018f, 0.858834445f},
-std::array<float,2>{0.643128932f, 0.545327425f},
-std::array<float,2>{0.177460328f, 0.011064752f},
-std::array<float,2>{0.895712674f, 0.100472085f},
-std::array<float,2>{0.408287793f, 0.571242392f},
-std::array<float,2>{0.545120597f, 0.790846825f},
-std::array<float,2>{0.0156614967f, 0.445809513f},
-std::array<float,2>{0.702097952f, 0.316906631f},
-std::array<float,2>{0.200367361f, 0.916591048f},
-std::array<float,2>{0.764505982f, 0.711663961f},
-std::array<float,2>{0.250471264f, 0.13520959f},
-std::array<float,2>{0.548329294f, 0.0825618953f},
-std::array<float,2>{0.0148152709f, 0.599289775f},
-std::array<float,2>{0.87659508f, 0.760146797f},
-std::array<float,2>{0.435576171f, 0.48067084f},
-std::array<float,2>{0.774054587f, 0.353657722f},
-std::array<float,2>{0.279652297f, 0.877279162f},
-std::array<float,2>{0.71133852f, 0.748932898f},
-std::array<float,2>{0.215816811f, 0.160306677f},
-std::array<float,2>{0.94265157f, 0.216236651f},
-std::array<float,2>{0.471560419f, 0.664125085f},
-std::array<float,2>{0.574665129f, 0.938375294f},
-std::array<float,2>{0.107901923f, 0.262496799f},
-std::array<float,2>{0.633592784f, 0.419562727f},
-std::array<float,2>{0.159978569f, 0.82919848f},
-std::array<float,2>{0.860560536f, 0.506010175f},
-std::array<float,2>{0.341565311f, 0.0319167227f},
-std::array<float,2>{0.748941243f, 0.141835183f},
-std::array<float,2>{0.231285214f, 0.69581306f},
-std::array<float,2>{0.783932507f, 0.922172785f},
-std::array<float,2>{0.294112593f, 0.331844121f},
-std::array<float,2>{0.920190334f, 0.462168545f},
-std::array<float,2>{0.379012734f, 0.804968536f},
-std::array<float,2>{0.516546488f, 0.581509531f},
-std::array<float,2>{0.0325781032f, 0.112002514f},
-std::array<float,2>{0.823009491f, 0.0177168846f},
-std::array<float,2>{0.357742637f, 0.55053401f},
-std::array<float,2>{0.670522332f, 0.863853931f},
-std::array<float,2>{0.136164427f, 0.399949133f},
-std::array<float,2>{0.602793694f, 0.28191337f},
-std::array<float,2>{0.0853746012f, 0.980390131f},
-std::array<float,2>{0.995959222f, 0.652833819f},
-std::array<float,2>{0.451126635f, 0.238072768f},
-std::array<float,2>{0.699055791f, 0.042112425f},
-std::array<float,2>{0.196339428f, 0.512644708f},
-std::array<float,2>{0.759978354f, 0.838560164f},
-std::array<float,2>{0.257227063f, 0.406435281f},
-std::array<float,2>{0.891592085f, 0.256309509f},
-std::array<float,2>{0.413741022f, 0.945768118f},
-std::array<float,2>{0.540027142f, 0.664001644f},
-std::array<float,2>{0.0201748237f, 0.210346743f},
-std::array<float,2>{0.854655802f, 0.168211997f},
-std::array<float,2>{0.318082243f, 0.73703897f},
-std::array<float,2>{0.647200704f, 0.889767587f},
-std::array<float,2>{0.171917692f, 0.350508153f},
-std::array<float,2>{0.592182338f, 0.474600822f},
-std::array<float,2>{0.110854328f, 0.755397856f},
-std::array<float,2>{0.962295115f, 0.603179634f},
-std::array<float,2>{0.485590786f, 0.0897431746f},
-std::array<float,2>{0.508305192f, 0.243452892f},
-std::array<float,2>{0.0568030886f, 0.642241895f},
-std::array<float,2>{0.923398018f, 0.974393845f},
-std::array<float,2>{0.392268121f, 0.296022266f},
-std::array<float,2>{0.800512612f, 0.396660149f},
-std::array<float,2>{0.302608907f, 0.872447848f},
-std::array<float,2>{0.730453789f, 0.558737576f},
-std::array<float,2>{0.237689599f, 0.0253394339f},
-std::array<float,2>{0.974828243f, 0.120498449f},
-std::array<float,2>{0.461419851f, 0.58599323f},
-std::array<float,2>{0.618188202f, 0.802985549f},
-std::array<float,2>{0.0674833283f, 0.457237005f},
-std::array<float,2>{0.684663475f, 0.341786176f},
-std::array<float,2>{0.140898183f, 0.932978988f},
-std::array<float,2>{0.829174817f, 0.692157805f},
-std::array<float,2>{0.361980766f, 0.149359405f},
-std::array<float,2>{0.607037544f, 0.0648172498f},
-std::array<float,2>{0.0814712048f, 0.621670783f},
-std::array<float,2>{0.996427596f, 0.768263876f},
-std::array<float,2>{0.447958201f, 0.493245631f},
-std::array<float,2>{0.826605797f, 0.373157591f},
-std::array<float,2>{0.353971601f, 0.904072762f},
-std::array<float,2>{0.667702734f, 0.73200202f},
-std::array<float,2>{0.137500212f, 0.181466922f},
-std::array<float,2>{0.916588545f, 0.202081054f},
-std::array<float,2>{0.377723932f, 0.680731416f},
-std::array<float,2>{0.523340583f, 0.963363171f},
-std::array<float,2>{0.0371264033f, 0.273900211f},
-std::array<float,2>{0.744438112f, 0.42539975f},
-std::array<float,2>{0.229276851f, 0.815050602f},
-std::array<float,2>{0.786989808f, 0.51850611f},
-std::array<float,2>{0.291812897f, 0.0521303788f},
-std::array<float,2>{0.639793634f, 0.128099516f},
-std::array<float,2>{0.163102835f, 0.704125285f},
-std::array<float,2>{0.866698802f, 0.911878347f},
-std::array<float,2>{0.33811751f, 0.324727595f},
-std::array<float,2>{0.93861258f, 0.441841185f},
-std::array<float,2>{0.473297805f, 0.782877564f},
-std::array<float,2>{0.573610961f, 0.565224051f},
-std::array<float,2>{0.10512162f, 0.106597267f},
-std::array<float,2>{0.777458429f, 0.00601289375f},
-std::array<float,2>{0.276813328f, 0.531310737f},
-std::array<float,2>{0.717740417f, 0.847854555f},
-std::array<float,2>{0.211624369f, 0.377809912f},
-std::array<float,2>{0.552143633f, 0.299049258f},
-std::array<float,2>{0.0103266342f, 0.990350127f},
-std::array<float,2>{0.880003273f, 0.627899766f},
-std::array<float,2>{0.430181891f, 0.230646521f},
-std::array<float,2>{0.658568561f, 0.0950200632f},
-std::array<float,2>{0.128946126f, 0.576647878f},
-std::array<float,2>{0.818832994f, 0.793330908f},
-std::array<float,2>{0.346660495f, 0.450501055f},
-std::array<float,2>{0.991223812f, 0.314160854f},
-std::array<float,2>{0.440682471f, 0.91857475f},
-std::array<float,2>{0.598097026f, 0.716543376f},
-std::array<float,2>{0.0909224823f, 0.13841337f},
-std::array<float,2>{0.792633772f, 0.21917592f},
-std::array<float,2>{0.288534194f, 0.634389818f},
-std::array<float,2>{0.737753153f, 0.993142486f},
-std::array<float,2>{0.221132115f, 0.310669839f},
-std::array<float,2>{0.526407242f, 0.387889147f},
-std::array<float,2>{0.0423278511f, 0.852851868f},
-std::array<float,2>{0.907736301f, 0.542020023f},
-std::array<float,2>{0.387295842f, 0.0117641594f},
-std::array<float,2>{0.563625216f, 0.173285693f},
-std::array<float,2>{0.0983704776f, 0.721169353f},
-std::array<float,2>{0.948818207f, 0.894018114f},
-std::array<float,2>{0.476904929f, 0.365811944f},
-std::array<float,2>{0.869379342f, 0.491388857f},
-std::array<float,2>{0.33575809f, 0.775184751f},
-std::array<float,2>{0.629091024f, 0.610473156f},
-std::array<float,2>{0.167002067f, 0.0719190687f},
-std::array<float,2>{0.89007622f, 0.0611295328f},
-std::array<float,2>{0.425862193f, 0.529925466f},
-std::array<float,2>{0.558502197f, 0.823671877f},
-std::array<float,2>{0.00646672118f, 0.43647936f},
-std::array<float,2>{0.7053653f, 0.272047311f},
-std::array<float,2>{0.210635498f, 0.959880292f},
-std::array<float,2>{0.770860374f, 0.677760363f},
-std::array<float,2>{0.269165277f, 0.18976818f},
-std::array<float,2>{0.53702867f, 0.0211894978f},
-std::array<float,2>{0.023718467f, 0.551986814f},
-std::array<float,2>{0.898899615f, 0.859832823f},
-std::array<float,2>{0.41971451f, 0.40462482f},
-std::array<float,2>{0.754199266f, 0.287917733f},
-std::array<float,2>{0.259780645f, 0.981462061f},
-std::array<float,2>{0.693687141f, 0.650403321f},
-std::array<float,2>{0.194724828f, 0.240054861f},
-std::array<float,2>{0.959717453f, 0.146971032f},
-std::array<float,2>{0.493264526f, 0.700268507f},
-std::array<float,2>{0.579915643f, 0.927204251f},
-std::array<float,2>{0.120889701f, 0.334662825f},
-std::array<float,2>{0.653660893f, 0.467615545f},
-std::array<float,2>{0.180849925f, 0.808875442f},
-std::array<float,2>{0.84948653f, 0.583626926f},
-std::array<float,2>{0.323460668f, 0.11697866f},
-std::array<float,2>{0.722347319f, 0.212661535f},
-std::array<float,2>{0.24442035f, 0.670568526f},
-std::array<float,2>{0.80793035f, 0.942791998f},
-std::array<float,2>{0.308255017f, 0.258262604f},
-std::array<float,2>{0.93536061f, 0.416996926f},
-std::array<float,2>{0.405052811f, 0.832859159f},
-std::array<float,2>{0.504210413f, 0.501334906f},
-std::array<float,2>{0.0498549119f, 0.0381780006f},
-std::array<float,2>{0.840172768f, 0.0806119964f},
-std::array<float,2>{0.371075034f, 0.59756428f},
-std::array<float,2>{0.676302075f, 0.76555407f},
-std::array<float,2>{0.155420184f, 0.477150112f},
-std::array<float,2>{0.612041712f, 0.358693272f},
-std::array<float,2>{0.0752043426f, 0.88053906f},
-std::array<float,2>{0.979640186f, 0.746079087f},
-std::array<float,2>{0.458325386f, 0.157526925f},
-std::array<float,2>{0.742158771f, 0.09345714f},
-std::array<float,2>{0.224865571f, 0.607709706f},
-std::array<float,2>{0.793835938f, 0.750554502f},
-std::array<float,2>{0.283166081f, 0.470753461f},
-std::array<float,2>{0.912470341f, 0.346295267f},
-std::array<float,2>{0.385353893f, 0.886556447f},
-std::array<float,2>{0.529603064f, 0.739845335f},
-std::array<float,2>{0.0461932383f, 0.166745111f},
-std::array<float,2>{0.812773943f, 0.2036587f},
-std::array<float,2>{0.349779248f, 0.660021305f},
-std::array<float,2>{0.661834657f, 0.950965881f},
-std::array<float,2>{0.126791626f, 0.251667529f},
-std::array<float,2>{0.594859719f, 0.412577271f},
-std::array<float,2>{0.0870241076f, 0.840480685f},
-std::array<float,2>{0.986239076f, 0.510646999f},
-std::array<float,2>{0.444030106f, 0.0467300117f},
-std::array<float,2>{0.558905482f, 0.153162941f},
-std::array<float,2>{0.00119910296f, 0.687612474f},
-std::array<float,2>{0.884536505f, 0.933820963f},
-std::array<float,2>{0.423623711f, 0.337355614f},
-std::array<float,2>{0.768735111f, 0.454828531f},
-std::array<float,2>{0.271244138f, 0.798004687f},
-std::array<float,2>{0.709482551f, 0.592654288f},
-std::array<float,2>{0.206314355f, 0.123251133f},
-std::array<float,2>{0.949629128f, 0.0286994986f},
-std::array<float,2>{0.481291503f, 0.558578312f},
-std::array<float,2>{0.567227364f, 0.868465364f},
-std::array<float,2>{0.0957976952f, 0.391664267f},
-std::array<float,2>{0.628588676f, 0.292488813f},
-std::array<float,2>{0.170002863f, 0.970900834f},
-std::array<float,2>{0.873173475f, 0.645091355f},
-std::array<float,2>{0.329151183f, 0.24897477f},
-std::array<float,2>{0.58320725f, 0.049955979f},
-std::array<float,2>{0.121586159f, 0.52034992f},
-std::array<float,2>{0.954052627f, 0.816927791f},
-std::array<float,2>{0.499395132f, 0.426738858f},
-std::array<float,2>{0.845707297f, 0.281054109f},
-std::array<float,2>{0.325153291f, 0.967994273f},
-std::array<float,2>{0.649291217f, 0.686992466f},
-std::array<float,2>{0.187093168f, 0.197416469f},
-std::array<float,2>{0.904973507f, 0.186722472f},
-std::array<float,2>{0.41689688f, 0.729008019f},
-std::array<float,2>{0.531653047f, 0.898756921f},
-std::array<float,2>{0.0309040789f, 0.368688673f},
-std::array<float,2>{0.68847996f, 0.498440981f},
-std::array<float,2>{0.18977356f, 0.7719962f},
-std::array<float,2>{0.752532423f, 0.619293392f},
-std::array<float,2>{0.263350964f, 0.0699946135f},
-std::array<float,2>{0.67391783f, 0.227688566f},
-std::array<float,2>{0.151038691f, 0.630114079f},
-std::array<float,2>{0.837556839f, 0.986690581f},
-std::array<float,2>{0.374693096f, 0.30235523f},
-std::array<float,2>{0.983440578f, 0.381989837f},
-std::array<float,2>{0.45667392f, 0.84431535f},
-std::array<float,2>{0.613770962f, 0.536345482f},
-std::array<float,2>{0.0717245713f, 0.00142092048f},
-std::array<float,2>{0.809665978f, 0.104578175f},
-std::array<float,2>{0.310397267f, 0.567606807f},
-std::array<float,2>{0.725167096f, 0.785666883f},
-std::array<float,2>{0.248261541f, 0.437545568f},
-std::array<float,2>{0.500183105f, 0.322281957f},
-std::array<float,2>{0.0534380749f, 0.90683639f},
-std::array<float,2>{0.930304229f, 0.710229158f},
-std::array<float,2>{0.40107131f, 0.13019076f},
-std::array<float,2>{0.641560733f, 0.00871810876f},
-std::array<float,2>{0.178931653f, 0.54348892f},
-std::array<float,2>{0.857306182f, 0.856650054f},
-std::array<float,2>{0.316140682f, 0.38632372f},
-std::array<float,2>{0.96852237f, 0.305154413f},
-std::array<float,2>{0.491984606f, 0.998797476f},
-std::array<float,2>{0.588837147f, 0.640321076f},
-std::array<float,2>{0.114717834f, 0.225036368f},
-std::array<float,2>{0.763024092f, 0.13394621f},
-std::array<float,2>{0.253402412f, 0.713328779f},
-std::array<float,2>{0.700564742f, 0.915614307f},
-std::array<float,2>{0.202862993f, 0.318977058f},
-std::array<float,2>{0.544548392f, 0.44818303f},
-std::array<float,2>{0.0184033606f, 0.792654455f},
-std::array<float,2>{0.898272991f, 0.572826266f},
-std::array<float,2>{0.406876981f, 0.0981506556f},
-std::array<float,2>{0.623374522f, 0.191689506f},
-std::array<float,2>{0.0625088066f, 0.673200428f},
-std::array<float,2>{0.970360458f, 0.955190659f},
-std::array<float,2>{0.467160225f, 0.265806556f},
-std::array<float,2>{0.835708261f, 0.430337518f},
-std::array<float,2>{0.364037901f, 0.825875759f},
-std::array<float,2>{0.679989457f, 0.526647091f},
-std::array<float,2>{0.146553993f, 0.0563419871f},
-std::array<float,2>{0.929471314f, 0.076102905f},
-std::array<float,2>{0.39504379f, 0.61433661f},
-std::array<float,2>{0.512111604f, 0.780555725f},
-std::array<float,2>{0.0597450733f, 0.484866589f},
-std::array<float,2>{0.730988145f, 0.360256761f},
-std::array<float,2>{0.241760656f, 0.897132158f},
-std::array<float,2>{0.802687526f, 0.724140048f},
-std::array<float,2>{0.29688853f, 0.178876027f},
-std::array<float,2>{0.517853081f, 0.110745303f},
-std::array<float,2>{0.0340158828f, 0.579941928f},
-std::array<float,2>{0.918370545f, 0.808242619f},
-std::array<float,2>{0.382774174f, 0.46386984f},
-std::array<float,2>{0.782717586f, 0.329026908f},
-std::array<float,2>{0.296108902f, 0.923951685f},
-std::array<float,2>{0.747297883f, 0.69776547f},
-std::array<float,2>{0.234076023f, 0.142987117f},
-std::array<float,2>{0.993372083f, 0.234962076f},
-std::array<float,2>{0.452896446f, 0.655537903f},
-std::array<float,2>{0.604912043f, 0.977069914f},
-std::array<float,2>{0.0826494098f, 0.283680528f},
-std::array<float,2>{0.668690979f, 0.401992381f},
-std::array<float,2>{0.133529693f, 0.866537809f},
-std::array<float,2>{0.821880639f, 0.548597217f},
-std::array<float,2>{0.356750399f, 0.0174848028f},
-std::array<float,2>{0.714841068f, 0.162812486f},
-std::array<float,2>{0.217529535f, 0.747566521f},
-std::array<float,2>{0.775608838f, 0.876272798f},
-std::array<float,2>{0.27780354f, 0.353246182f},
-std::array<float,2>{0.877859235f, 0.48282668f},
-std::array<float,2>{0.435167134f, 0.758003116f},
-std::array<float,2>{0.549185455f, 0.600897133f},
-std::array<float,2>{0.0117521342f, 0.0855824575f},
-std::array<float,2>{0.862586796f, 0.0332342274f},
-std::array<float,2>{0.342492133f, 0.505565286f},
-std::array<float,2>{0.635498703f, 0.830460608f},
-std::array<float,2>{0.157236263f, 0.42105943f},
-std::array<float,2>{0.576925099f, 0.265186995f},
-std::array<float,2>{0.10617137f, 0.940315902f},
-std::array<float,2>{0.944499195f, 0.667460918f},
-std::array<float,2>{0.470616996f, 0.218224376f},
-std::array<float,2>{0.700253367f, 0.0105020087f},
-std::array<float,2>{0.203107625f, 0.546305776f},
-std::array<float,2>{0.762930453f, 0.858170807f},
-std::array<float,2>{0.253101975f, 0.383948535f},
-std::array<float,2>{0.898043811f, 0.30842936f},
-std::array<float,2>{0.407141894f, 0.99785465f},
-std::array<float,2>{0.544751763f, 0.638307512f},
-std::array<float,2>{0.018067833f, 0.223547474f},
-std::array<float,2>{0.857090056f, 0.136549652f},
-std::array<float,2>{0.316199481f, 0.71253562f},
-std::array<float,2>{0.641225338f, 0.917888641f},
-std::array<float,2>{0.179017574f, 0.317762524f},
-std::array<float,2>{0.588600039f, 0.446718454f},
-std::array<float,2>{0.114369698f, 0.789649546f},
-std::array<float,2>{0.968292475f, 0.571545064f},
-std::array<float,2>{0.491867423f, 0.101059422f},
-std::array<float,2>{0.511894166f, 0.193638906f},
-std::array<float,2>{0.0598833002f, 0.674690604f},
-std::array<float,2>{0.92925626f, 0.955004692f},
-std::array<float,2>{0.395316631f, 0.268191397f},
-std::array<float,2>{0.802263558f, 0.432414621f},
-std::array<float,2>{0.297162145f, 0.826369286f},
-std::array<float,2>{0.73132062f, 0.524596572f},
-std::array<float,2>{0.242084309f, 0.0567388274f},
-std::array<float,2>{0.970687926f, 0.0777843073f},
-std::array<float,2>{0.46688503f, 0.616013408f},
-std::array<float,2>{0.623101294f, 0.778752208f},
-std::array<float,2>{0.0628558993f, 0.488204271f},
-std::array<float,2>{0.679831088f, 0.362870067f},
-std::array<float,2>{0.146908671f, 0.895307481f},
-std::array<float,2>{0.835507631f, 0.726020873f},
-std::array<float,2>{0.363815606f, 0.176917061f},
-std::array<float,2>{0.604556859f, 0.112360366f},
-std::array<float,2>{0.0827705711f, 0.580845952f},
-std::array<float,2>{0.993594527f, 0.806546986f},
-std::array<float,2>{0.452693909f, 0.461629421f},
-std::array<float,2>{0.822066486f, 0.331046373f},
-std::array<float,2>{0.356585622f, 0.923685372f},
-std::array<float,2>{0.668909371f, 0.696426272f},
-std::array<float,2>{0.133773759f, 0.140790969f},
-std::array<float,2>{0.918202281f, 0.236818492f},
-std::array<float,2>{0.382531554f, 0.653707683f},
-std::array<float,2>{0.517794251f, 0.979085207f},
-std::array<float,2>{0.0337576941f, 0.282777041f},
-std::array<float,2>{0.747537613f, 0.398907334f},
-std::array<float,2>{0.234132811f, 0.865088463f},
-std::array<float,2>{0.783007085f, 0.549252152f},
-std::array<float,2>{0.296155006f, 0.0190463513f},
-std::array<float,2>{0.635369956f, 0.161265329f},
-std::array<float,2>{0.157567203f, 0.749087334f},
-std::array<float,2>{0.862399161f, 0.878228188f},
-std::array<float,2>{0.342543066f, 0.354548633f},
-std::array<float,2>{0.944660485f, 0.481805772f},
-std::array<float,2>{0.470295995f, 0.760931194f},
-std::array<float,2>{0.576863706f, 0.597850502f},
-std::array<float,2>{0.106253795f, 0.0837794691f},
-std::array<float,2>{0.775842965f, 0.0328254141f},
-std::array<float,2>{0.277373582f, 0.507528305f},
-std::array<float,2>{0.71437943f, 0.828419328f},
-std::array<float,2>{0.217525184f, 0.418030113f},
-std::array<float,2>{0.548877954f, 0.263224721f},
-std::array<float,2>{0.011995811f, 0.939248681f},
-std::array<float,2>{0.877499521f, 0.665208876f},
-std::array<float,2>{0.435412467f, 0.215625495f},
-std::array<float,2>{0.662002206f, 0.0907914191f},
-std::array<float,2>{0.126549959f, 0.605929375f},
-std::array<float,2>{0.81250602f, 0.753027439f},
-std::array<float,2>{0.349919677f, 0.469155282f},
-std::array<float,2>{0.985875368f, 0.345658094f},
-std::array<float,2>{0.444126874f, 0.884574115f},
-std::array<float,2>{0.595097125f, 0.740769923f},
-std::array<float,2>{0.0873337165f, 0.164453447f},
-std::array<float,2>{0.793667376f, 0.205614313f},
-std::array<float,2>{0.282816201f, 0.657290399f},
-std::array<float,2>{0.741854668f, 0.953071952f},
-std::array<float,2>{0.224851266f, 0.25197047f},
-std::array<float,2>{0.529464364f, 0.411672533f},
-std::array<float,2>{0.0461127758f, 0.842725396f},
-std::array<float,2>{0.912230134f, 0.509397209f},
-std::array<float,2>{0.385500759f, 0.043157652f},
-std::array<float,2>{0.567064166f, 0.154398978f},
-std::array<float,2>{0.0960475951f, 0.69003737f},
-std::array<float,2>{0.949442446f, 0.936095595f},
-std::array<float,2>{0.481154293f, 0.338262379f},
-std::array<float,2>{0.873514712f, 0.456807375f},
-std::array<float,2>{0.329515904f, 0.800586402f},
-std::array<float,2>{0.628844798f, 0.591524243f},
-std::array<float,2>{0.170351073f, 0.122496456f},
-std::array<float,2>{0.88436836f, 0.0303145833f},
-std::array<float,2>{0.423347563f, 0.556439281f},
-std::array<float,2>{0.558826208f, 0.86933738f},
-std::array<float,2>{0.00144754513f, 0.393557936f},
-std::array<float,2>{0.709733725f, 0.28960371f},
-std::array<float,2>{0.206230402f, 0.968996286f},
-std::array<float,2>{0.768839955f, 0.647625685f},
-std::array<float,2>{0.27109924f, 0.24666664f},
-std::array<float,2>{0.531375408f, 0.047928948f},
-std::array<float,2>{0.0310103334f, 0.522854328f},
-std::array<float,2>{0.905233443f, 0.819438636f},
-std::array<float,2>{0.416629195f, 0.427927136f},
-std::array<float,2>{0.752823114f, 0.278672636f},
-std::array<float,2>{0.263611764f, 0.965009868f},
-std::array<float,2>{0.688920319f, 0.684694052f},
-std::array<float,2>{0.189492434f, 0.195940137f},
-std::array<float,2>{0.953786016f, 0.184392333f},
-std::array<float,2>{0.499120116f, 0.727812648f},
-std::array<float,2>{0.583435774f, 0.900650978f},
-std::array<float,2>{0.121871188f, 0.369411141f},
-std::array<float,2>{0.649158061f, 0.497876436f},
-std::array<float,2>{0.187411159f, 0.76993227f},
-std::array<float,2>{0.846148849f, 0.61898762f},
-std::array<float,2>{0.324730635f, 0.068343699f},
-std::array<float,2>{0.725575089f, 0.230014056f},
-std::array<float,2>{0.248459399f, 0.632505178f},
-std::array<float,2>{0.809867978f, 0.984661937f},
-std::array<float,2>{0.310077965f, 0.302805007f},
-std::array<float,2>{0.930512249f, 0.380522609f},
-std::array<float,2>{0.401329279f, 0.847004116f},
-std::array<float,2>{0.500359178f, 0.538496971f},
-std::array<float,2>{0.0536556318f, 0.00252337777f},
-std::array<float,2>{0.837881386f, 0.102944531f},
-std::array<float,2>{0.374757409f, 0.568531513f},
-std::array<float,2>{0.674093544f, 0.787420213f},
-std::array<float,2>{0.151332155f, 0.439826787f},
-std::array<float,2>{0.614216506f, 0.320746213f},
-std::array<float,2>{0.0713108927f, 0.909581125f},
-std::array<float,2>{0.983756423f, 0.70858866f},
-std::array<float,2>{0.456889093f, 0.132481575f},
-std::array<float,2>{0.737365067f, 0.0962973982f},
-std::array<float,2>{0.220780507f, 0.575430572f},
-std::array<float,2>{0.792727947f, 0.79612875f},
-std::array<float,2>{0.288223654f, 0.451768726f},
-std::array<float,2>{0.907966137f, 0.315226585f},
-std::array<float,2>{0.387462705f, 0.921560287f},
-std::array<float,2>{0.526723146f, 0.718494296f},
-std::array<float,2>{0.0420909487f, 0.140617669f},
-std::array<float,2>{0.818556964f, 0.222069293f},
-std::array<float,2>{0.346392244f, 0.635712981f},
-std::array<float,2>{0.658395588f, 0.994662285f},
-std::array<float,2>{0.129223108f, 0.309174478f},
-std::array<float,2>{0.597704887f, 0.388763905f},
-std::array<float,2>{0.0911637992f, 0.854782104f},
-std::array<float,2>{0.991616309f, 0.539320946f},
-std::array<float,2>{0.440590233f, 0.0148299076f},
-std::array<float,2>{0.558110535f, 0.173905522f},
-std::array<float,2>{0.00677955477f, 0.719996393f},
-std::array<float,2>{0.889710784f, 0.892180026f},
-std::array<float,2>{0.426223904f, 0.364399344f},
-std::array<float,2>{0.770642459f, 0.48870039f},
-std::array<float,2>{0.269419134f, 0.77605468f},
-std::array<float,2>{0.70532167f, 0.611511588f},
-std::array<float,2>{0.210933864f, 0.0725049525f},
-std::array<float,2>{0.949009717f, 0.0594734401f},
-std::array<float,2>{0.476586878f, 0.528100133f},
-std::array<float,2>{0.563894272f, 0.821563303f},
-std::array<float,2>{0.0985332876f, 0.433948755f},
-std::array<float,2>{0.629224122f, 0.271408528f},
-std::array<float,2>{0.167344689f, 0.957258701f},
-std::array<float,2>{0.869492054f, 0.676644266f},
-std::array<float,2>{0.335687876f, 0.189407408f},
-std::array<float,2>{0.579640269f, 0.0222116429f},
-std::array<float,2>{0.120613746f, 0.554002404f},
-std::array<float,2>{0.959487081f, 0.861880124f},
-std::array<float,2>{0.493549198f, 0.403618544f},
-std::array<float,2>{0.849227726f, 0.286292285f},
-std::array<float,2>{0.323521763f, 0.982489824f},
-std::array<float,2>{0.653353393f, 0.650002956f},
-std::array<float,2>{0.181106761f, 0.240898937f},
-std::array<float,2>{0.898441553f, 0.145799264f},
-std::array<float,2>{0.419601321f, 0.702595413f},
-std::array<float,2>{0.536730945f, 0.928865492f},
-std::array<float,2>{0.0236642081f, 0.332640022f},
-std::array<float,2>{0.693550467f, 0.464903235f},
-std::array<float,2>{0.19456628f, 0.812102973f},
-std::array<float,2>{0.754118085f, 0.585884809f},
-std::array<float,2>{0.260031879f, 0.114094809f},
-std::array<float,2>{0.676520169f, 0.214361057f},
-std::array<float,2>{0.155587658f, 0.668627858f},
-std::array<float,2>{0.839997888f, 0.943943977f},
-std::array<float,2>{0.370818347f, 0.261512071f},
-std::array<float,2>{0.979910314f, 0.414504588f},
-std::array<float,2>{0.458117217f, 0.834599137f},
-std::array<float,2>{0.612108767f, 0.503172696f},
-std::array<float,2>{0.0756141245f, 0.0360258147f},
-std::array<float,2>{0.807685137f, 0.0798633024f},
-std::array<float,2>{0.308521599f, 0.595277965f},
-std::array<float,2>{0.72255969f, 0.762278318f},
-std::array<float,2>{0.244316339f, 0.478642732f},
-std::array<float,2>{0.503936052f, 0.356578708f},
-std::array<float,2>{0.0501386002f, 0.881300569f},
-std::array<float,2>{0.935182154f, 0.743175864f},
-std::array<float,2>{0.404797792f, 0.16012463f},
-std::array<float,2>{0.647363842f, 0.0397441275f},
-std::array<float,2>{0.172361866f, 0.515067339f},
-std::array<float,2>{0.854974031f, 0.83626163f},
-std::array<float,2>{0.318227828f, 0.409389645f},
-std::array<float,2>{0.962017655f, 0.254445225f},
-std::array<float,2>{0.485687852f, 0.948188961f},
-std::array<float,2>{0.592007637f, 0.660268009f},
-std::array<float,2>{0.111317746f, 0.208872199f},
-std::array<float,2>{0.760220706f, 0.170379788f},
-std::array<float,2>{0.256917208f, 0.735074461f},
-std::array<float,2>{0.698824584f, 0.888391137f},
-std::array<float,2>{0.196776912f, 0.347788841f},
-std::array<float,2>{0.539613843f, 0.475220263f},
-std::array<float,2>{0.0204262007f, 0.757085502f},
-std::array<float,2>{0.891261876f, 0.60441035f},
-std::array<float,2>{0.413864732f, 0.0873420686f},
-std::array<float,2>{0.618505418f, 0.245168284f},
-std::array<float,2>{0.0677396357f, 0.644272208f},
-std::array<float,2>{0.974977791f, 0.975373685f},
-std::array<float,2>{0.461155742f, 0.294659883f},
-std::array<float,2>{0.829559028f, 0.395203441f},
-std::array<float,2>{0.362201214f, 0.874294996f},
-std::array<float,2>{0.684852481f, 0.562286139f},
-std::array<float,2>{0.140787512f, 0.0265132766f},
-std::array<float,2>{0.923746586f, 0.117366038f},
-std::array<float,2>{0.392450422f, 0.589793563f},
-std::array<float,2>{0.508613765f, 0.801907301f},
-std::array<float,2>{0.0571194366f, 0.459532678f},
-std::array<float,2>{0.730051994f, 0.342496574f},
-std::array<float,2>{0.237346619f, 0.930665433f},
-std::array<float,2>{0.80071044f, 0.694765329f},
-std::array<float,2>{0.302355498f, 0.150828153f},
-std::array<float,2>{0.523018062f, 0.0627218112f},
-std::array<float,2>{0.0374385491f, 0.62316215f},
-std::array<float,2>{0.91697824f, 0.766063631f},
-std::array<float,2>{0.377540827f, 0.494793504f},
-std::array<float,2>{0.78665483f, 0.371978015f},
-std::array<float,2>{0.29152295f, 0.905196726f},
-std::array<float,2>{0.744177699f, 0.733178139f},
-std::array<float,2>{0.22908093f, 0.18214038f},
-std::array<float,2>{0.996299267f, 0.201133177f},
-std::array<float,2>{0.448123783f, 0.682653129f},
-std::array<float,2>{0.607264817f, 0.962077796f},
-std::array<float,2>{0.0812604129f, 0.276476741f},
-std::array<float,2>{0.66785109f, 0.423453718f},
-std::array<float,2>{0.137365416f, 0.812655807f},
-std::array<float,2>{0.82619828f, 0.517201304f},
-std::array<float,2>{0.353616804f, 0.0546214283f},
-std::array<float,2>{0.717399597f, 0.126490086f},
-std::array<float,2>{0.211671621f, 0.706833184f},
-std::array<float,2>{0.777713597f, 0.913241982f},
-std::array<float,2>{0.276438296f, 0.327177495f},
-std::array<float,2>{0.880366564f, 0.444781959f},
-std::array<float,2>{0.430482656f, 0.784062564f},
-std::array<float,2>{0.551820576f, 0.563472271f},
-std::array<float,2>{0.0107278973f, 0.108314306f},
-std::array<float,2>{0.86626941f, 0.00508619659f},
-std::array<float,2>{0.338285863f, 0.533412337f},
-std::array<float,2>{0.640076935f, 0.85128063f},
-std::array<float,2>{0.163485587f, 0.375552922f},
-std::array<float,2>{0.573299766f, 0.297645241f},
-std::array<float,2>{0.105322123f, 0.989387751f},
-std::array<float,2>{0.938792467f, 0.625476658f},
-std::array<float,2>{0.473444283f, 0.233937904f},
-std::array<float,2>{0.733813882f, 0.055485975f},
-std::array<float,2>{0.238535717f, 0.525928736f},
-std::array<float,2>{0.803376079f, 0.824629426f},
-std::array<float,2>{0.300055116f, 0.430946618f},
-std::array<float,2>{0.926118851f, 0.267141193f},
-std::array<float,2>{0.397877812f, 0.956305265f},
-std::array<float,2>{0.514521062f, 0.672337174f},
-std::array<float,2>{0.0616299994f, 0.192943692f},
-std::array<float,2>{0.832172215f, 0.177786455f},
-std::array<float,2>{0.365516961f, 0.722891331f},
-std::array<float,2>{0.681879759f, 0.897582352f},
-std::array<float,2>{0.145598054f, 0.361103356f},
-std::array<float,2>{0.622464776f, 0.485967517f},
-std::array<float,2>{0.0646485239f, 0.77944082f},
-std::array<float,2>{0.971930146f, 0.613653719f},
-std::array<float,2>{0.465246856f, 0.0749616548f},
-std::array<float,2>{0.545228004f, 0.225913644f},
-std::array<float,2>{0.0160146486f, 0.639184237f},
-std::array<float,2>{0.895794868f, 0.999296248f},
-std::array<float,2>{0.408637464f, 0.306406736f},
-std::array<float,2>{0.76419878f, 0.385247111f},
-std::array<float,2>{0.250193954f, 0.855985522f},
-std::array<float,2>{0.701719999f, 0.544207633f},
-std::array<float,2>{0.200510889f, 0.00966111477f},
-std::array<float,2>{0.966024935f, 0.0988678634f},
-std::array<float,2>{0.489885896f, 0.574066401f},
-std::array<float,2>{0.586211741f, 0.791963518f},
-std::array<float,2>{0.116998859f, 0.448779583f},
-std::array<float,2>{0.643552125f, 0.320236206f},
-std::array<float,2>{0.177520111f, 0.914598942f},
-std::array<float,2>{0.859095335f, 0.713936508f},
-std::array<float,2>{0.313661397f, 0.133524373f},
-std::array<float,2>{0.574288905f, 0.0848927051f},
-std::array<float,2>{0.107475549f, 0.5998981f},
-std::array<float,2>{0.942422092f, 0.759384036f},
-std::array<float,2>{0.471214473f, 0.484362781f},
-std::array<float,2>{0.860774279f, 0.352080673f},
-std::array<float,2>{0.34151876f, 0.875576317f},
-std::array<float,2>{0.633425474f, 0.74614799f},
-std::array<float,2>{0.159681976f, 0.163692266f},
-std::array<float,2>{0.876856267f, 0.216977254f},
-std::array<float,2>{0.435897976f, 0.666464984f},
-std::array<float,2>{0.547919929f, 0.940498292f},
-std::array<float,2>{0.0150167365f, 0.264208436f},
-std::array<float,2>{0.710957706f, 0.420050472f},
-std::array<float,2>{0.215420023f, 0.831250429f},
-std::array<float,2>{0.774217248f, 0.504285753f},
-std::array<float,2>{0.279438555f, 0.0345350727f},
-std::array<float,2>{0.670711577f, 0.143849745f},
-std::array<float,2>{0.135910884f, 0.69881618f},
-std::array<float,2>{0.82284224f, 0.925068855f},
-std::array<float,2>{0.357560605f, 0.329649657f},
-std::array<float,2>{0.995712996f, 0.463505954f},
-std::array<float,2>{0.450771868f, 0.806673348f},
-std::array<float,2>{0.602710545f, 0.578404188f},
-std::array<float,2>{0.0850126147f, 0.109820217f},
-std::array<float,2>{0.784135401f, 0.0160978176f},
-std::array<float,2>{0.294216424f, 0.547103345f},
-std::array<float,2>{0.748699009f, 0.865656316f},
-std::array<float,2>{0.231092125f, 0.401337743f},
-std::array<float,2>{0.516136467f, 0.285133362f},
-std::array<float,2>{0.0323912762f, 0.977688909f},
-std::array<float,2>{0.92013979f, 0.65480119f},
-std::array<float,2>{0.379268169f, 0.236056969f},
-std::array<float,2>{0.625850379f, 0.124408282f},
-std::array<float,2>{0.168469325f, 0.593273938f},
-std::array<float,2>{0.871876299f, 0.797138572f},
-std::array<float,2>{0.332028687f, 0.453873634f},
-std::array<float,2>{0.952743471f, 0.336083889f},
-std::array<float,2>{0.483163297f, 0.935438573f},
-std::array<float,2>{0.56931746f, 0.689398468f},
-std::array<float,2>{0.0954621956f, 0.153506666f},
-std::array<float,2>{0.76687485f, 0.249980509f},
-std::array<float,2>{0.273175746f, 0.646325111f},
-std::array<float,2>{0.707518697f, 0.972540498f},
-std::array<float,2>{0.20349057f, 0.291924149f},
-std::array<float,2>{0.561023414f, 0.391448498f},
-std::array<float,2>{0.00330984523f, 0.867672265f},
-std::array<float,2>{0.886518896f, 0.557207167f},
-std::array<float,2>{0.425710618f, 0.0276200231f},
-std::array<float,2>{0.597158909f, 0.167189226f},
-std::array<float,2>{0.088916719f, 0.738807082f},
-std::array<float,2>{0.987235367f, 0.885535955f},
-std::array<float,2>{0.441596001f, 0.347380608f},
-std::array<float,2>{0.815379918f, 0.4721497f},
-std::array<float,2>{0.349442631f, 0.751136959f},
-std::array<float,2>{0.662368059f, 0.60923028f},
-std::array<float,2>{0.127218246f, 0.0925174505f},
-std::array<float,2>{0.91088289f, 0.0454607345f},
-std::array<float,2>{0.382920474f, 0.51111114f},
-std::array<float,2>{0.528648853f, 0.841796637f},
-std::array<float,2>{0.0434630476f, 0.413173199f},
-std::array<float,2>{0.738988221f, 0.250411034f},
-std::array<float,2>{0.224093378f, 0.94951427f},
-std::array<float,2>{0.796621263f, 0.65830791f},
-std::array<float,2>{0.28472653f, 0.204662949f},
-std::array<float,2>{0.503409028f, 0.000865174457f},
-std::array<float,2>{0.0525986627f, 0.535720885f},
-std::array<float,2>{0.932113588f, 0.84547776f},
-std::array<float,2>{0.399197519f, 0.381576777f},
-std::array<float,2>{0.810949385f, 0.301686764f},
-std::array<float,2>{0.311058998f, 0.987928987f},
-std::array<float,2>{0.724367321f, 0.629812956f},
-std::array<float,2>{0.247749448f, 0.226669326f},
-std::array<float,2>{0.982136488f, 0.129697263f},
-std::array<float,2>{0.45324856f, 0.709755957f},
-std::array<float,2>{0.615797222f, 0.907595038f},
-std::array<float,2>{0.0738571733f, 0.323403299f},
-std::array<float,2>{0.672257543f, 0.438538343f},
-std::array<float,2>{0.149829835f, 0.786452055f},
-std::array<float,2>{0.839112937f, 0.566689968f},
-std::array<float,2>{0.371358752f, 0.103539541f},
-std::array<float,2>{0.689859152f, 0.198860586f},
-std::array<float,2>{0.188232437f, 0.686422825f},
-std::array<float,2>{0.750224829f, 0.966886878f},
-std::array<float,2>{0.264608532f, 0.280179083f},
-std::array<float,2>{0.902394831f, 0.427312285f},
-std::array<float,2>{0.415447026f, 0.818244398f},
-std::array<float,2>{0.533970654f, 0.520800889f},
-std::array<float,2>{0.02785258f, 0.0498004667f},
-std::array<float,2>{0.84532547f, 0.0692251325f},
-std::array<float,2>{0.32776162f, 0.620517313f},
-std::array<float,2>{0.651501894f, 0.772716641f},
-std::array<float,2>{0.184429884f, 0.499732435f},
-std::array<float,2>{0.58492744f, 0.368118167f},
-std::array<float,2>{0.123737819f, 0.89994055f},
-std::array<float,2>{0.956821084f, 0.729510784f},
-std::array<float,2>{0.496549934f, 0.186082467f},
-std::array<float,2>{0.703365445f, 0.0709354728f},
-std::array<float,2>{0.20891425f, 0.609498739f},
-std::array<float,2>{0.772244394f, 0.773884177f},
-std::array<float,2>{0.266289979f, 0.491182715f},
-std::array<float,2>{0.887864113f, 0.367152154f},
-std::array<float,2>{0.427759647f, 0.892907441f},
-std::array<float,2>{0.556450009f, 0.722204328f},
-std::array<float,2>{0.00439946633f, 0.172097921f},
-std::array<float,2>{0.868091643f, 0.191062793f},
-std::array<float,2>{0.333818465f, 0.679216325f},
-std::array<float,2>{0.631065428f, 0.960606873f},
-std::array<float,2>{0.165911093f, 0.272655427f},
-std::array<float,2>{0.564750969f, 0.437309593f},
-std::array<float,2>{0.0999275297f, 0.822291255f},
-std::array<float,2>{0.947235405f, 0.531207263f},
-std::array<float,2>{0.479585707f, 0.0624968931f},
-std::array<float,2>{0.524487078f, 0.136976585f},
-std::array<float,2>{0.0395870358f, 0.714917362f},
-std::array<float,2>{0.909536064f, 0.919489443f},
-std::array<float,2>{0.389211148f, 0.313422889f},
-std::array<float,2>{0.790628612f, 0.449378639f},
-std::array<float,2>{0.286535352f, 0.794139445f},
-std::array<float,2>{0.735103667f, 0.577423155f},
-std::array<float,2>{0.220220536f, 0.0938263685f},
-std::array<float,2>{0.989679694f, 0.0128020691f},
-std::array<float,2>{0.437810272f, 0.541140616f},
-std::array<float,2>{0.600566149f, 0.852288544f},
-std::array<float,2>{0.0930645019f, 0.386839539f},
-std::array<float,2>{0.657899797f, 0.311888218f},
-std::array<float,2>{0.132198319f, 0.99350661f},
-std::array<float,2>{0.816934824f, 0.633469045f},
-std::array<float,2>{0.345597029f, 0.220559239f},
-std::array<float,2>{0.610862195f, 0.0375944711f},
-std::array<float,2>{0.0775523931f, 0.500844479f},
-std::array<float,2>{0.977362871f, 0.833964527f},
-std::array<float,2>{0.460091799f, 0.4165079f},
-std::array<float,2>{0.84356904f, 0.259147197f},
-std::array<float,2>{0.368950933f, 0.941501439f},
-std::array<float,2>{0.67803061f, 0.67150116f},
-std::array<float,2>{0.153591529f, 0.211767122f},
-std::array<float,2>{0.937399864f, 0.156663731f},
-std::array<float,2>{0.403865516f, 0.744354725f},
-std::array<float,2>{0.506385565f, 0.879418731f},
-std::array<float,2>{0.0481739193f, 0.357848406f},
-std::array<float,2>{0.719657958f, 0.477646619f},
-std::array<float,2>{0.242466226f, 0.764254987f},
-std::array<float,2>{0.804955363f, 0.596049249f},
-std::array<float,2>{0.30522269f, 0.0815198198f},
-std::array<float,2>{0.655094564f, 0.238962084f},
-std::array<float,2>{0.182526082f, 0.651383221f},
-std::array<float,2>{0.850720584f, 0.980867982f},
-std::array<float,2>{0.321511984f, 0.288666993f},
-std::array<float,2>{0.958970964f, 0.406054616f},
-std::array<float,2>{0.494880706f, 0.860684097f},
-std::array<float,2>{0.581479251f, 0.55140692f},
-std::array<float,2>{0.118928909f, 0.019899575f},
-std::array<float,2>{0.755918562f, 0.115965746f},
-std::array<float,2>{0.258702964f, 0.582809329f},
-std::array<float,2>{0.692860723f, 0.809636831f},
-std::array<float,2>{0.193021536f, 0.468502432f},
-std::array<float,2>{0.538717568f, 0.335550129f},
-std::array<float,2>{0.0257778838f, 0.925934613f},
-std::array<float,2>{0.901530623f, 0.699724078f},
-std::array<float,2>{0.420014352f, 0.147732273f},
-std::array<float,2>{0.687317193f, 0.0243318789f},
-std::array<float,2>{0.143041566f, 0.560107291f},
-std::array<float,2>{0.83043164f, 0.871703625f},
-std::array<float,2>{0.360267043f, 0.398009121f},
-std::array<float,2>{0.974373281f, 0.295762479f},
-std::array<float,2>{0.464107066f, 0.972947061f},
-std::array<float,2>{0.619752645f, 0.640981853f},
-std::array<float,2>{0.0700279847f, 0.242992058f},
-std::array<float,2>{0.798111796f, 0.149945855f},
-std::array<float,2>{0.303910077f, 0.692939043f},
-std::array<float,2>{0.727414131f, 0.932317376f},
-std::array<float,2>{0.234999388f, 0.340172648f},
-std::array<float,2>{0.511226177f, 0.458881795f},
-std::array<float,2>{0.0556297265f, 0.804290652f},
-std::array<float,2>{0.923972726f, 0.58730489f},
-std::array<float,2>{0.392692894f, 0.120072797f},
-std::array<float,2>{0.590474308f, 0.209632933f},
-std::array<float,2>{0.111402065f, 0.66305095f},
-std::array<float,2>{0.963310957f, 0.947109401f},
-std::array<float,2>{0.486437023f, 0.257147491f},
-std::array<float,2>{0.8519333f, 0.40800932f},
-std::array<float,2>{0.31908825f, 0.839342475f},
-std::array<float,2>{0.645526469f, 0.513046324f},
-std::array<float,2>{0.175001249f, 0.0412752889f},
-std::array<float,2>{0.892686427f, 0.0882079899f},
-std::array<float,2>{0.411592394f, 0.602331042f},
-std::array<float,2>{0.542051971f, 0.753991246f},
-std::array<float,2>{0.0229141302f, 0.472900927f},
-std::array<float,2>{0.696131289f, 0.350980818f},
-std::array<float,2>{0.198160455f, 0.889599323f},
-std::array<float,2>{0.758044839f, 0.737956524f},
-std::array<float,2>{0.255456358f, 0.169813529f},
-std::array<float,2>{0.553340375f, 0.105577759f},
-std::array<float,2>{0.00938106421f, 0.565464377f},
-std::array<float,2>{0.882275939f, 0.781448722f},
-std::array<float,2>{0.433368951f, 0.443029314f},
-std::array<float,2>{0.780524015f, 0.325555503f},
-std::array<float,2>{0.274126589f, 0.910971344f},
-std::array<float,2>{0.714851797f, 0.703219354f},
-std::array<float,2>{0.213847443f, 0.127631366f},
-std::array<float,2>{0.939649403f, 0.231917784f},
-std::array<float,2>{0.47608158f, 0.628294647f},
-std::array<float,2>{0.570514679f, 0.991999269f},
-std::array<float,2>{0.102609508f, 0.300118089f},
-std::array<float,2>{0.638046443f, 0.378807217f},
-std::array<float,2>{0.160854325f, 0.849163532f},
-std::array<float,2>{0.864605486f, 0.533011675f},
-std::array<float,2>{0.337001055f, 0.00722156046f},
-std::array<float,2>{0.743072748f, 0.180540666f},
-std::array<float,2>{0.227123439f, 0.731187105f},
-std::array<float,2>{0.787210584f, 0.902724624f},
-std::array<float,2>{0.290232122f, 0.374268234f},
-std::array<float,2>{0.915873468f, 0.492703557f},
-std::array<float,2>{0.376206338f, 0.768934071f},
-std::array<float,2>{0.520096362f, 0.622397184f},
-std::array<float,2>{0.0356270596f, 0.0655454546f},
-std::array<float,2>{0.824737549f, 0.0509656444f},
-std::array<float,2>{0.352734298f, 0.519295692f},
-std::array<float,2>{0.664813221f, 0.816040516f},
-std::array<float,2>{0.139027283f, 0.424711734f},
-std::array<float,2>{0.60833782f, 0.274443686f},
-std::array<float,2>{0.0790802836f, 0.964447737f},
-std::array<float,2>{0.999022424f, 0.680324793f},
-std::array<float,2>{0.446419656f, 0.202314138f},
-std::array<float,2>{0.749106705f, 0.0183705799f},
-std::array<float,2>{0.231840849f, 0.550004423f},
-std::array<float,2>{0.785036564f, 0.863381743f},
-std::array<float,2>{0.293737471f, 0.39956215f},
-std::array<float,2>{0.921642482f, 0.2813721f},
-std::array<float,2>{0.38022843f, 0.979846001f},
-std::array<float,2>{0.51756072f, 0.652585626f},
-std::array<float,2>{0.0320305377f, 0.237429276f},
-std::array<float,2>{0.823671579f, 0.142165646f},
-std::array<float,2>{0.35858041f, 0.695689082f},
-std::array<float,2>{0.671377301f, 0.922612727f},
-std::array<float,2>{0.135732159f, 0.331287652f},
-std::array<float,2>{0.601749778f, 0.462408751f},
-std::array<float,2>{0.0844596252f, 0.80535692f},
-std::array<float,2>{0.994525075f, 0.58201617f},
-std::array<float,2>{0.449599266f, 0.111630909f},
-std::array<float,2>{0.547747195f, 0.216317624f},
-std::array<float,2>{0.0146247651f, 0.664957881f},
-std::array<float,2>{0.875226378f, 0.937921584f},
-std::array<float,2>{0.436609864f, 0.261884868f},
-std::array<float,2>{0.77455765f, 0.41900751f},
-std::array<float,2>{0.281090111f, 0.82989198f},
-std::array<float,2>{0.712783754f, 0.506571412f},
-std::array<float,2>{0.216463983f, 0.0314311795f},
-std::array<float,2>{0.942151606f, 0.0823389664f},
-std::array<float,2>{0.472623765f, 0.599110603f},
-std::array<float,2>{0.576009095f, 0.76073122f},
-std::array<float,2>{0.108593762f, 0.481090397f},
-std::array<float,2>{0.634120941f, 0.354464561f},
-std::array<float,2>{0.158759639f, 0.877565444f},
-std::array<float,2>{0.859531581f, 0.748342335f},
-std::array<float,2>{0.339987785f, 0.161035523f},
-std::array<float,2>{0.587456763f, 0.099890627f},
-std::array<float,2>{0.11607448f, 0.570449173f},
-std::array<float,2>{0.965348005f, 0.790177107f},
-std::array<float,2>{0.488841414f, 0.445341319f},
-std::array<float,2>{0.857681513f, 0.316608548f},
-std::array<float,2>{0.313393891f, 0.916327059f},
-std::array<float,2>{0.643609107f, 0.711349666f},
-std::array<float,2>{0.176144376f, 0.135634035f},
-std::array<float,2>{0.894642651f, 0.224449471f},
-std::array<float,2>{0.41007629f, 0.637596369f},
-std::array<float,2>{0.546584904f, 0.996460438f},
-std::array<float,2>{0.0175433233f, 0.306767851f},
-std::array<float,2>{0.702356637f, 0.383037448f},
-std::array<float,2>{0.20018141f, 0.859283566f},
-std::array<float,2>{0.765341341f, 0.545894086f},
-std::array<float,2>{0.251562923f, 0.0113981906f},
-std::array<float,2>{0.682842493f, 0.176446274f},
-std::array<float,2>{0.14461574f, 0.725085735f},
-std::array<float,2>{0.833273292f, 0.895532727f},
-std::array<float,2>{0.366956592f, 0.361614764f},
-std::array<float,2>{0.97102803f, 0.486507595f},
-std::array<float,2>{0.466631234f, 0.777777553f},
-std::array<float,2>{0.621732414f, 0.616932094f},
-std::array<float,2>{0.0658080652f, 0.0770955384f},
-std::array<float,2>{0.803804278f, 0.0583119653f},
-std::array<float,2>{0.299731761f, 0.524325371f},
-std::array<float,2>{0.732674479f, 0.827317297f},
-std::array<float,2>{0.239920244f, 0.433156103f},
-std::array<float,2>{0.514967382f, 0.268557698f},
-std::array<float,2>{0.0614066496f, 0.953654289f},
-std::array<float,2>{0.927379429f, 0.67523706f},
-std::array<float,2>{0.396520674f, 0.195070416f},
-std::array<float,2>{0.65110594f, 0.0671354607f},
-std::array<float,2>{0.184742182f, 0.618122995f},
-std::array<float,2>{0.8445701f, 0.771095574f},
-std::array<float,2>{0.326430231f, 0.496278971f},
-std::array<float,2>{0.955163956f, 0.370332032f},
-std::array<float,2>{0.497104883f, 0.901386678f},
-std::array<float,2>{0.585309446f, 0.727012217f},
-std::array<float,2>{0.124188043f, 0.185033783f},
-std::array<float,2>{0.75114578f, 0.196548775f},
-std::array<float,2>{0.265218347f, 0.684522808f},
-std::array<float,2>{0.690435588f, 0.966364503f},
-std::array<float,2>{0.188958228f, 0.277810544f},
-std::array<float,2>{0.53508395f, 0.429383337f},
-std::array<float,2>{0.0291232727f, 0.818579614f},
-std::array<float,2>{0.904217005f, 0.521995783f},
-std::array<float,2>{0.414295882f, 0.0476973392f},
-std::array<float,2>{0.617092729f, 0.131314963f},
-std::array<float,2>{0.072345309f, 0.707826793f},
-std::array<float,2>{0.980880558f, 0.909074664f},
-std::array<float,2>{0.454694092f, 0.3218804f},
-std::array<float,2>{0.838507414f, 0.441209346f},
-std::array<float,2>{0.373013318f, 0.788560331f},
-std::array<float,2>{0.673369944f, 0.569791377f},
-std::array<float,2>{0.148467347f, 0.1018667f},
-std::array<float,2>{0.932950556f, 0.00332855829f},
-std::array<float,2>{0.40003252f, 0.537712395f},
-std::array<float,2>{0.502125323f, 0.845776975f},
-std::array<float,2>{0.0516103804f, 0.379426062f},
-std::array<float,2>{0.723051369f, 0.303964764f},
-std::array<float,2>{0.246982545f, 0.98595351f},
-std::array<float,2>{0.812446833f, 0.63126868f},
-std::array<float,2>{0.311866969f, 0.228991643f},
-std::array<float,2>{0.527632833f, 0.0447820686f},
-std::array<float,2>{0.0441576876f, 0.50823921f},
-std::array<float,2>{0.911902606f, 0.842865944f},
-std::array<float,2>{0.383981138f, 0.410550743f},
-std::array<float,2>{0.795346498f, 0.253352821f},
-std::array<float,2>{0.283567011f, 0.952109575f},
-std::array<float,2>{0.739637554f, 0.656307161f},
-std::array<float,2>{0.223303869f, 0.206155047f},
-std::array<float,2>{0.987903953f, 0.165092036f},
-std::array<float,2>{0.442566365f, 0.74218291f},
-std::array<float,2>{0.596153915f, 0.883095264f},
-std::array<float,2>{0.0886571854f, 0.344572872f},
-std::array<float,2>{0.664053977f, 0.469904423f},
-std::array<float,2>{0.128564477f, 0.751964748f},
-std::array<float,2>{0.816395164f, 0.607058883f},
-std::array<float,2>{0.347955346f, 0.0910655856f},
-std::array<float,2>{0.708744526f, 0.247779235f},
-std::array<float,2>{0.204663649f, 0.646587014f},
-std::array<float,2>{0.765846014f, 0.970042408f},
-std::array<float,2>{0.272396505f, 0.290208519f},
-std::array<float,2>{0.884945512f, 0.39271754f},
-std::array<float,2>{0.424025238f, 0.870225072f},
-std::array<float,2>{0.562344372f, 0.55510658f},
-std::array<float,2>{0.0022425151f, 0.0299880393f},
-std::array<float,2>{0.87276268f, 0.121406466f},
-std::array<float,2>{0.330863535f, 0.590263903f},
-std::array<float,2>{0.626035452f, 0.798925817f},
-std::array<float,2>{0.169022813f, 0.455357313f},
-std::array<float,2>{0.569837213f, 0.339378715f},
-std::array<float,2>{0.0946174785f, 0.937156379f},
-std::array<float,2>{0.951386094f, 0.690510929f},
-std::array<float,2>{0.483818233f, 0.155422583f},
-std::array<float,2>{0.692367196f, 0.114585653f},
-std::array<float,2>{0.192289084f, 0.584649801f},
-std::array<float,2>{0.757553577f, 0.811484337f},
-std::array<float,2>{0.25915876f, 0.466645598f},
-std::array<float,2>{0.900572419f, 0.333742857f},
-std::array<float,2>{0.421296507f, 0.928426802f},
-std::array<float,2>{0.5379529f, 0.701865971f},
-std::array<float,2>{0.0271676276f, 0.144591317f},
-std::array<float,2>{0.85013622f, 0.242121339f},
-std::array<float,2>{0.320937514f, 0.649154305f},
-std::array<float,2>{0.655749381f, 0.984319329f},
-std::array<float,2>{0.183316216f, 0.285677433f},
-std::array<float,2>{0.580465317f, 0.402552217f},
-std::array<float,2>{0.117845707f, 0.862333059f},
-std::array<float,2>{0.957355082f, 0.553456604f},
-std::array<float,2>{0.496027529f, 0.0233621877f},
-std::array<float,2>{0.507113218f, 0.15877901f},
-std::array<float,2>{0.0477202609f, 0.742485225f},
-std::array<float,2>{0.936049342f, 0.881975889f},
-std::array<float,2>{0.402591258f, 0.355892092f},
-std::array<float,2>{0.806349814f, 0.480180115f},
-std::array<float,2>{0.306223392f, 0.763017654f},
-std::array<float,2>{0.720381439f, 0.594474852f},
-std::array<float,2>{0.243820578f, 0.0783704743f},
-std::array<float,2>{0.978271604f, 0.0363786742f},
-std::array<float,2>{0.459765583f, 0.502068579f},
-std::array<float,2>{0.610073626f, 0.835200071f},
-std::array<float,2>{0.0770649835f, 0.415957242f},
-std::array<float,2>{0.679055035f, 0.26009804f},
-std::array<float,2>{0.152659893f, 0.944693506f},
-std::array<float,2>{0.842058003f, 0.669628799f},
-std::array<float,2>{0.367215186f, 0.213697746f},
-std::array<float,2>{0.600972116f, 0.0145258978f},
-std::array<float,2>{0.0917980224f, 0.541008055f},
-std::array<float,2>{0.988867879f, 0.854078531f},
-std::array<float,2>{0.438976824f, 0.389868349f},
-std::array<float,2>{0.817864895f, 0.310409486f},
-std::array<float,2>{0.344001025f, 0.996011913f},
-std::array<float,2>{0.656612456f, 0.63617748f},
-std::array<float,2>{0.131774977f, 0.221489549f},
-std::array<float,2>{0.909157038f, 0.138752475f},
-std::array<float,2>{0.390076548f, 0.717119217f},
-std::array<float,2>{0.523665488f, 0.920588434f},
-std::array<float,2>{0.0405720547f, 0.315680623f},
-std::array<float,2>{0.735936642f, 0.452181488f},
-std::array<float,2>{0.21954985f, 0.795329034f},
-std::array<float,2>{0.789223969f, 0.574657559f},
-std::array<float,2>{0.28542906f, 0.0971730649f},
-std::array<float,2>{0.632505119f, 0.187581256f},
-std::array<float,2>{0.164710268f, 0.677582502f},
-std::array<float,2>{0.868307173f, 0.958836436f},
-std::array<float,2>{0.332703769f, 0.270020187f},
-std::array<float,2>{0.945730031f, 0.43477723f},
-std::array<float,2>{0.479413062f, 0.820917189f},
-std::array<float,2>{0.565788507f, 0.528599024f},
-std::array<float,2>{0.101049967f, 0.0605302416f},
-std::array<float,2>{0.772901714f, 0.0740290359f},
-std::array<float,2>{0.266646862f, 0.612900496f},
-std::array<float,2>{0.70434612f, 0.776825845f},
-std::array<float,2>{0.207733482f, 0.489275366f},
-std::array<float,2>{0.555222809f, 0.364147782f},
-std::array<float,2>{0.00529495999f, 0.891195118f},
-std::array<float,2>{0.886997283f, 0.719406486f},
-std::array<float,2>{0.428898245f, 0.175158411f},
-std::array<float,2>{0.665934563f, 0.0535502806f},
-std::array<float,2>{0.139806733f, 0.51629293f},
-std::array<float,2>{0.826104581f, 0.814184129f},
-std::array<float,2>{0.352334231f, 0.422143996f},
-std::array<float,2>{0.99922806f, 0.275536954f},
-std::array<float,2>{0.446115881f, 0.961767316f},
-std::array<float,2>{0.608588398f, 0.682476282f},
-std::array<float,2>{0.079219155f, 0.199582875f},
-std::array<float,2>{0.788677037f, 0.18293342f},
-std::array<float,2>{0.28967604f, 0.733594954f},
-std::array<float,2>{0.744001269f, 0.905462682f},
-std::array<float,2>{0.228121892f, 0.372762293f},
-std::array<float,2>{0.520910025f, 0.495565146f},
-std::array<float,2>{0.0369956791f, 0.76663202f},
-std::array<float,2>{0.914903224f, 0.624171138f},
-std::array<float,2>{0.375641733f, 0.0637965128f},
-std::array<float,2>{0.571490765f, 0.232992813f},
-std::array<float,2>{0.101730831f, 0.626038611f},
-std::array<float,2>{0.940831184f, 0.988453448f},
-std::array<float,2>{0.474648505f, 0.298350275f},
-std::array<float,2>{0.86417836f, 0.376072526f},
-std::array<float,2>{0.335994601f, 0.849958062f},
-std::array<float,2>{0.637010932f, 0.534761846f},
-std::array<float,2>{0.161324516f, 0.00463520177f},
-std::array<float,2>{0.881174564f, 0.108485356f},
-std::array<float,2>{0.431696236f, 0.563667059f},
-std::array<float,2>{0.554152369f, 0.784326971f},
-std::array<float,2>{0.00865288638f, 0.444102496f},
-std::array<float,2>{0.716033638f, 0.327137679f},
-std::array<float,2>{0.21401155f, 0.913035452f},
-std::array<float,2>{0.779964745f, 0.705495119f},
-std::array<float,2>{0.27463904f, 0.125742882f},
-std::array<float,2>{0.541283906f, 0.0861130357f},
-std::array<float,2>{0.0223859493f, 0.604893088f},
-std::array<float,2>{0.893938839f, 0.756434202f},
-std::array<float,2>{0.410445392f, 0.476546139f},
-std::array<float,2>{0.758871913f, 0.348936141f},
-std::array<float,2>{0.254687399f, 0.88728708f},
-std::array<float,2>{0.696555197f, 0.735768497f},
-std::array<float,2>{0.199171066f, 0.171158865f},
-std::array<float,2>{0.964802861f, 0.207132027f},
-std::array<float,2>{0.48772642f, 0.66202724f},
-std::array<float,2>{0.591587663f, 0.948576272f},
-std::array<float,2>{0.113154881f, 0.255826712f},
-std::array<float,2>{0.645351708f, 0.408831298f},
-std::array<float,2>{0.173841417f, 0.837328494f},
-std::array<float,2>{0.853064597f, 0.513799787f},
-std::array<float,2>{0.31957072f, 0.0409466103f},
-std::array<float,2>{0.727766573f, 0.152061969f},
-std::array<float,2>{0.235892072f, 0.69414562f},
-std::array<float,2>{0.797677875f, 0.930654645f},
-std::array<float,2>{0.303184301f, 0.343551874f},
-std::array<float,2>{0.924971223f, 0.460033059f},
-std::array<float,2>{0.39376989f, 0.801251471f},
-std::array<float,2>{0.509858608f, 0.587983608f},
-std::array<float,2>{0.0558067411f, 0.118938185f},
-std::array<float,2>{0.831702709f, 0.0254741162f},
-std::array<float,2>{0.360364139f, 0.560877919f},
-std::array<float,2>{0.686450005f, 0.87389493f},
-std::array<float,2>{0.144121274f, 0.396480829f},
-std::array<float,2>{0.620371819f, 0.293532848f},
-std::array<float,2>{0.06885048f, 0.976012468f},
-std::array<float,2>{0.973626912f, 0.642979324f},
-std::array<float,2>{0.462924033f, 0.244676471f},
-std::array<float,2>{0.713580489f, 0.0341552868f},
-std::array<float,2>{0.21793139f, 0.505254984f},
-std::array<float,2>{0.776534796f, 0.830781758f},
-std::array<float,2>{0.278649807f, 0.421444982f},
-std::array<float,2>{0.878495574f, 0.264886945f},
-std::array<float,2>{0.434462607f, 0.939667284f},
-std::array<float,2>{0.550742745f, 0.667485535f},
-std::array<float,2>{0.0127886562f, 0.218440801f},
-std::array<float,2>{0.862247288f, 0.162516117f},
-std::array<float,2>{0.34315443f, 0.747199655f},
-std::array<float,2>{0.635996878f, 0.876501501f},
-std::array<float,2>{0.156699821f, 0.352570534f},
-std::array<float,2>{0.577660084f, 0.482958555f},
-std::array<float,2>{0.106871963f, 0.758708835f},
-std::array<float,2>{0.943680644f, 0.601356626f},
-std::array<float,2>{0.46906662f, 0.0850187913f},
-std::array<float,2>{0.51893574f, 0.234498546f},
-std::array<float,2>{0.0347583592f, 0.655967534f},
-std::array<float,2>{0.919702649f, 0.976670146f},
-std::array<float,2>{0.381164938f, 0.283919901f},
-std::array<float,2>{0.781319976f, 0.40164417f},
-std::array<float,2>{0.295112044f, 0.867129028f},
-std::array<float,2>{0.746370673f, 0.548074484f},
-std::array<float,2>{0.233025789f, 0.016674811f},
-std::array<float,2>{0.993115306f, 0.110990927f},
-std::array<float,2>{0.451197386f, 0.579253197f},
-std::array<float,2>{0.603907347f, 0.807898998f},
-std::array<float,2>{0.0834344104f, 0.464583963f},
-std::array<float,2>{0.669848979f, 0.328513026f},
-std::array<float,2>{0.134404421f, 0.924612463f},
-std::array<float,2>{0.821201682f, 0.697276771f},
-std::array<float,2>{0.356322855f, 0.143156797f},
-std::array<float,2>{0.624085546f, 0.0752673373f},
-std::array<float,2>{0.0641022548f, 0.615121365f},
-std::array<float,2>{0.968992233f, 0.780893624f},
-std::array<float,2>{0.468504697f, 0.484547019f},
-std::array<float,2>{0.834483027f, 0.359628707f},
-std::array<float,2>{0.364760667f, 0.896576524f},
-std::array<float,2>{0.68113476f, 0.72399807f},
-std::array<float,2>{0.148181304f, 0.179658324f},
-std::array<float,2>{0.92855978f, 0.191971317f},
-std::array<float,2>{0.395838797f, 0.673543513f},
-std::array<float,2>{0.513356566f, 0.955744982f},
-std::array<float,2>{0.0590093099f, 0.266175508f},
-std::array<float,2>{0.731586516f, 0.429792315f},
-std::array<float,2>{0.240676329f, 0.825658619f},
-std::array<float,2>{0.800940514f, 0.527229249f},
-std::array<float,2>{0.298407376f, 0.0558892451f},
-std::array<float,2>{0.641906381f, 0.134437561f},
-std::array<float,2>{0.178162679f, 0.713419914f},
-std::array<float,2>{0.856198311f, 0.915340126f},
-std::array<float,2>{0.314840347f, 0.318813026f},
-std::array<float,2>{0.967108607f, 0.447446704f},
-std::array<float,2>{0.49101159f, 0.792127848f},
-std::array<float,2>{0.589442909f, 0.572558105f},
-std::array<float,2>{0.113309324f, 0.0979716256f},
-std::array<float,2>{0.76223886f, 0.00826175325f},
-std::array<float,2>{0.252278328f, 0.543246865f},
-std::array<float,2>{0.699519098f, 0.856947064f},
-std::array<float,2>{0.201966777f, 0.385772049f},
-std::array<float,2>{0.543455064f, 0.305357307f},
-std::array<float,2>{0.0187894106f, 0.998155951f},
-std::array<float,2>{0.897298336f, 0.639825106f},
-std::array<float,2>{0.40803501f, 0.225404426f},
-std::array<float,2>{0.675689161f, 0.105236106f},
-std::array<float,2>{0.152195305f, 0.568188012f},
-std::array<float,2>{0.835985899f, 0.785443842f},
-std::array<float,2>{0.374004126f, 0.438244581f},
-std::array<float,2>{0.982841671f, 0.323164672f},
-std::array<float,2>{0.455963492f, 0.906265974f},
-std::array<float,2>{0.615019262f, 0.710874617f},
-std::array<float,2>{0.0705954283f, 0.13065289f},
-std::array<float,2>{0.808822513f, 0.228060097f},
-std::array<float,2>{0.309072316f, 0.630449176f},
-std::array<float,2>{0.726528227f, 0.98698175f},
-std::array<float,2>{0.249098197f, 0.302238762f},
-std::array<float,2>{0.50115329f, 0.382600039f},
-std::array<float,2>{0.0541943684f, 0.843991935f},
-std::array<float,2>{0.930736899f, 0.536944926f},
-std::array<float,2>{0.401632667f, 0.00162112084f},
-std::array<float,2>{0.582081854f, 0.187470824f},
-std::array<float,2>{0.122364812f, 0.72861141f},
-std::array<float,2>{0.955050945f, 0.899216771f},
-std::array<float,2>{0.498793542f, 0.368405223f},
-std::array<float,2>{0.8468858f, 0.498838186f},
-std::array<float,2>{0.325632215f, 0.771861553f},
-std::array<float,2>{0.650004089f, 0.619657516f},
-std::array<float,2>{0.185728267f, 0.0694785267f},
-std::array<float,2>{0.906011045f, 0.0507016778f},
-std::array<float,2>{0.417604923f, 0.519648194f},
-std::array<float,2>{0.532895327f, 0.816557884f},
-std::array<float,2>{0.0296828821f, 0.426148564f},
-std::array<float,2>{0.687507272f, 0.280654758f},
-std::array<float,2>{0.19080171f, 0.968445182f},
-std::array<float,2>{0.7531721f, 0.687180996f},
-std::array<float,2>{0.262097955f, 0.197869956f},
-std::array<float,2>{0.560296118f, 0.029037863f},
-std::array<float,2>{0.000528298726f, 0.557799101f},
-std::array<float,2>{0.882852256f, 0.868721008f},
-std::array<float,2>{0.422593176f, 0.392102093f},
-std::array<float,2>{0.767655134f, 0.292467088f},
-std::array<float,2>{0.2697649f, 0.971665382f},
-std::array<float,2>{0.710575104f, 0.644754112f},
-std::array<float,2>{0.205321833f, 0.248341829f},
-std::array<float,2>{0.950587213f, 0.152366996f},
-std::array<float,2>{0.481505901f, 0.688452125f},
-std::array<float,2>{0.567463756f, 0.934317708f},
-std::array<float,2>{0.0967123285f, 0.337662041f},
-std::array<float,2>{0.627427578f, 0.45448041f},
-std::array<float,2>{0.171039566f, 0.798599958f},
-std::array<float,2>{0.874913633f, 0.592128873f},
-std::array<float,2>{0.328554451f, 0.123939931f},
-std::array<float,2>{0.740487874f, 0.203499123f},
-std::array<float,2>{0.22605449f, 0.65932548f},
-std::array<float,2>{0.794683814f, 0.950473309f},
-std::array<float,2>{0.282147467f, 0.25143981f},
-std::array<float,2>{0.913960516f, 0.412774622f},
-std::array<float,2>{0.386088192f, 0.840185046f},
-std::array<float,2>{0.530342519f, 0.509960055f},
-std::array<float,2>{0.0458619185f, 0.0463052951f},
-std::array<float,2>{0.813830137f, 0.0930074379f},
-std::array<float,2>{0.351204932f, 0.608378291f},
-std::array<float,2>{0.660777986f, 0.75043714f},
-std::array<float,2>{0.125816613f, 0.471319944f},
-std::array<float,2>{0.593900681f, 0.346110821f},
-std::array<float,2>{0.0864437744f, 0.885793924f},
-std::array<float,2>{0.984630942f, 0.739265978f},
-std::array<float,2>{0.444692731f, 0.166242972f},
-std::array<float,2>{0.721569121f, 0.0803138241f},
-std::array<float,2>{0.245947927f, 0.597030818f},
-std::array<float,2>{0.807019174f, 0.765104771f},
-std::array<float,2>{0.307262659f, 0.47684893f},
-std::array<float,2>{0.934084237f, 0.358999342f},
-std::array<float,2>{0.405792922f, 0.879922986f},
-std::array<float,2>{0.505624413f, 0.745347083f},
-std::array<float,2>{0.0490010381f, 0.158037856f},
-std::array<float,2>{0.841754794f, 0.212119088f},
-std::array<float,2>{0.369520277f, 0.67027849f},
-std::array<float,2>{0.677520812f, 0.942905009f},
-std::array<float,2>{0.155192718f, 0.258558929f},
-std::array<float,2>{0.612984359f, 0.417869925f},
-std::array<float,2>{0.0751414001f, 0.83223927f},
-std::array<float,2>{0.979228318f, 0.501856267f},
-std::array<float,2>{0.457167536f, 0.0388944261f},
-std::array<float,2>{0.535179377f, 0.147191152f},
-std::array<float,2>{0.0253455862f, 0.700902939f},
-std::array<float,2>{0.900152981f, 0.927715719f},
-std::array<float,2>{0.418806463f, 0.334139407f},
-std::array<float,2>{0.755345285f, 0.466826737f},
-std::array<float,2>{0.261411935f, 0.809145093f},
-std::array<float,2>{0.694739521f, 0.583050072f},
-std::array<float,2>{0.193984374f, 0.116523832f},
-std::array<float,2>{0.960344434f, 0.0205399971f},
-std::array<float,2>{0.492863625f, 0.552404344f},
-std::array<float,2>{0.57864958f, 0.860161364f},
-std::array<float,2>{0.119516224f, 0.404997289f},
-std::array<float,2>{0.652376831f, 0.28730908f},
-std::array<float,2>{0.180461332f, 0.982403696f},
-std::array<float,2>{0.848629415f, 0.651105404f},
-std::array<float,2>{0.323156685f, 0.239362091f},
-std::array<float,2>{0.562682092f, 0.0608499721f},
-std::array<float,2>{0.0987757221f, 0.52950877f},
-std::array<float,2>{0.947689414f, 0.823855996f},
-std::array<float,2>{0.478080451f, 0.435829848f},
-std::array<float,2>{0.870852172f, 0.271948189f},
-std::array<float,2>{0.334785759f, 0.959030569f},
-std::array<float,2>{0.630298674f, 0.678477764f},
-std::array<float,2>{0.166294485f, 0.189951539f},
-std::array<float,2>{0.889098942f, 0.173458785f},
-std::array<float,2>{0.427482963f, 0.721322536f},
-std::array<float,2>{0.556829333f, 0.894449413f},
-std::array<float,2>{0.00717831217f, 0.365354598f},
-std::array<float,2>{0.706555605f, 0.491888553f},
-std::array<float,2>{0.209598511f, 0.774890184f},
-std::array<float,2>{0.770217121f, 0.611207366f},
-std::array<float,2>{0.267889857f, 0.0717665032f},
-std::array<float,2>{0.659292638f, 0.219589531f},
-std::array<float,2>{0.130181313f, 0.63416332f},
-std::array<float,2>{0.819912255f, 0.992520452f},
-std::array<float,2>{0.347329021f, 0.311099142f},
-std::array<float,2>{0.990271449f, 0.388371646f},
-std::array<float,2>{0.439759135f, 0.853211462f},
-std::array<float,2>{0.599186778f, 0.54262352f},
-std::array<float,2>{0.0902930424f, 0.0126231238f},
-std::array<float,2>{0.791464627f, 0.095570147f},
-std::array<float,2>{0.287509233f, 0.577004194f},
-std::array<float,2>{0.736406505f, 0.793525219f},
-std::array<float,2>{0.222021088f, 0.450837255f},
-std::array<float,2>{0.525641382f, 0.313735873f},
-std::array<float,2>{0.0412694477f, 0.918223083f},
-std::array<float,2>{0.9069947f, 0.716257632f},
-std::array<float,2>{0.388428658f, 0.13795045f},
-std::array<float,2>{0.638773501f, 0.00668912986f},
-std::array<float,2>{0.162990063f, 0.532005608f},
-std::array<float,2>{0.865939319f, 0.848383546f},
-std::array<float,2>{0.339073032f, 0.376971722f},
-std::array<float,2>{0.938438296f, 0.299351901f},
-std::array<float,2>{0.473647714f, 0.991115451f},
-std::array<float,2>{0.573064268f, 0.627220869f},
-std::array<float,2>{0.103721328f, 0.23114872f},
-std::array<float,2>{0.778887153f, 0.128667086f},
-std::array<float,2>{0.275390744f, 0.704728186f},
-std::array<float,2>{0.717850626f, 0.911552608f},
-std::array<float,2>{0.212808281f, 0.324440688f},
-std::array<float,2>{0.550863922f, 0.44236061f},
-std::array<float,2>{0.0108463131f, 0.782685935f},
-std::array<float,2>{0.879522562f, 0.564890265f},
-std::array<float,2>{0.431278437f, 0.107202239f},
-std::array<float,2>{0.60563004f, 0.201320708f},
-std::array<float,2>{0.0803774893f, 0.68129158f},
-std::array<float,2>{0.997925282f, 0.96353972f},
-std::array<float,2>{0.448433846f, 0.274171412f},
-std::array<float,2>{0.827526271f, 0.424812078f},
-std::array<float,2>{0.354853868f, 0.814794779f},
-std::array<float,2>{0.666491389f, 0.51801765f},
-std::array<float,2>{0.138304234f, 0.0524916388f},
-std::array<float,2>{0.917846441f, 0.0653607696f},
-std::array<float,2>{0.378315121f, 0.621468365f},
-std::array<float,2>{0.521878481f, 0.76770252f},
-std::array<float,2>{0.0389642902f, 0.493753642f},
-std::array<float,2>{0.745694757f, 0.373996943f},
-std::array<float,2>{0.230392054f, 0.903751254f},
-std::array<float,2>{0.785566747f, 0.731796563f},
-std::array<float,2>{0.292512119f, 0.181019828f},
-std::array<float,2>{0.509003997f, 0.120701306f},
-std::array<float,2>{0.0577277839f, 0.586508453f},
-std::array<float,2>{0.921976984f, 0.803413749f},
-std::array<float,2>{0.391102552f, 0.457942814f},
-std::array<float,2>{0.799194038f, 0.340852201f},
-std::array<float,2>{0.300970882f, 0.933399856f},
-std::array<float,2>{0.729342401f, 0.691825926f},
-std::array<float,2>{0.236875042f, 0.148449317f},
-std::array<float,2>{0.976201534f, 0.243743584f},
-std::array<float,2>{0.462158054f, 0.641933799f},
-std::array<float,2>{0.61745441f, 0.974021852f},
-std::array<float,2>{0.0668038055f, 0.296871513f},
-std::array<float,2>{0.683692515f, 0.397041917f},
-std::array<float,2>{0.142164603f, 0.872619629f},
-std::array<float,2>{0.828728914f, 0.559413671f},
-std::array<float,2>{0.362585753f, 0.0248520207f},
-std::array<float,2>{0.69781208f, 0.168540686f},
-std::array<float,2>{0.195781335f, 0.736803174f},
-std::array<float,2>{0.76124531f, 0.890590608f},
-std::array<float,2>{0.256236583f, 0.349958628f},
-std::array<float,2>{0.891640306f, 0.473981529f},
-std::array<float,2>{0.412541479f, 0.755142808f},
-std::array<float,2>{0.540287316f, 0.602760792f},
-std::array<float,2>{0.0213326775f, 0.0891868845f},
-std::array<float,2>{0.854302526f, 0.042509716f},
-std::array<float,2>{0.316539586f, 0.511918247f},
-std::array<float,2>{0.647847474f, 0.838200688f},
-std::array<float,2>{0.173265874f, 0.40706715f},
-std::array<float,2>{0.593116283f, 0.256812036f},
-std::array<float,2>{0.109823823f, 0.945908904f},
-std::array<float,2>{0.961455166f, 0.663538277f},
-std::array<float,2>{0.484598756f, 0.210654989f},
-std::array<float,2>{0.710056365f, 0.0293158665f},
-std::array<float,2>{0.205809548f, 0.555415392f},
-std::array<float,2>{0.768503845f, 0.871033311f},
-std::array<float,2>{0.270131469f, 0.393158108f},
-std::array<float,2>{0.883470654f, 0.290762573f},
-std::array<float,2>{0.422076911f, 0.970476449f},
-std::array<float,2>{0.560019732f, 0.647382438f},
-std::array<float,2>{0.000271552359f, 0.247089565f},
-std::array<float,2>{0.874192238f, 0.156032652f},
-std::array<float,2>{0.328931212f, 0.691311121f},
-std::array<float,2>{0.627876818f, 0.93691045f},
-std::array<float,2>{0.171763062f, 0.338950604f},
-std::array<float,2>{0.568351209f, 0.455889672f},
-std::array<float,2>{0.0972651094f, 0.799335182f},
-std::array<float,2>{0.950797319f, 0.59035486f},
-std::array<float,2>{0.482252359f, 0.121618994f},
-std::array<float,2>{0.531044543f, 0.20693253f},
-std::array<float,2>{0.0450394228f, 0.656961739f},
-std::array<float,2>{0.913177848f, 0.951483011f},
-std::array<float,2>{0.386673301f, 0.253877312f},
-std::array<float,2>{0.794259727f, 0.410956085f},
-std::array<float,2>{0.281696171f, 0.843384981f},
-std::array<float,2>{0.740752399f, 0.508520722f},
-std::array<float,2>{0.226195529f, 0.0444038808f},
-std::array<float,2>{0.985042632f, 0.0913244039f},
-std::array<float,2>{0.44489041f, 0.606568575f},
-std::array<float,2>{0.594323814f, 0.752900124f},
-std::array<float,2>{0.0862184316f, 0.470266253f},
-std::array<float,2>{0.660326779f, 0.344077826f},
-std::array<float,2>{0.125119239f, 0.883382022f},
-std::array<float,2>{0.814053178f, 0.741517484f},
-std::array<float,2>{0.35106194f, 0.165742978f},
-std::array<float,2>{0.614432514f, 0.102117419f},
-std::array<float,2>{0.0709498003f, 0.570143282f},
-std::array<float,2>{0.982973695f, 0.788893819f},
-std::array<float,2>{0.455454826f, 0.440441459f},
-std::array<float,2>{0.836536348f, 0.321592331f},
-std::array<float,2>{0.373410285f, 0.90850383f},
-std::array<float,2>{0.675046146f, 0.707179785f},
-std::array<float,2>{0.15180102f, 0.131369606f},
-std::array<float,2>{0.931380093f, 0.229365036f},
-std::array<float,2>{0.402179837f, 0.631755352f},
-std::array<float,2>{0.501914322f, 0.985634506f},
-std::array<float,2>{0.0545369051f, 0.30428201f},
-std::array<float,2>{0.726065636f, 0.379174441f},
-std::array<float,2>{0.249847427f, 0.84658289f},
-std::array<float,2>{0.809332907f, 0.537554204f},
-std::array<float,2>{0.309309632f, 0.00372563815f},
-std::array<float,2>{0.649803579f, 0.185533568f},
-std::array<float,2>{0.186076358f, 0.727432787f},
-std::array<float,2>{0.847594738f, 0.90210402f},
-std::array<float,2>{0.325887054f, 0.370761067f},
-std::array<float,2>{0.954260409f, 0.496596307f},
-std::array<float,2>{0.498215616f, 0.770841897f},
-std::array<float,2>{0.582802474f, 0.617543221f},
-std::array<float,2>{0.122869126f, 0.0666488409f},
-std::array<float,2>{0.753824115f, 0.0471976213f},
-std::array<float,2>{0.262223542f, 0.521751404f},
-std::array<float,2>{0.688343406f, 0.819278717f},
-std::array<float,2>{0.191403151f, 0.429012805f},
-std::array<float,2>{0.532447159f, 0.27783522f},
-std::array<float,2>{0.0297925249f, 0.966253757f},
-std::array<float,2>{0.905403912f, 0.684058964f},
-std::array<float,2>{0.41740799f, 0.197075576f},
-std::array<float,2>{0.681372166f, 0.0765704736f},
-std::array<float,2>{0.147943065f, 0.616626203f},
-std::array<float,2>{0.834384441f, 0.777947724f},
-std::array<float,2>{0.364696652f, 0.486833066f},
-std::array<float,2>{0.969277263f, 0.361837417f},
-std::array<float,2>{0.468187451f, 0.896228313f},
-std::array<float,2>{0.624540508f, 0.725331843f},
-std::array<float,2>{0.0638856068f, 0.175796092f},
-std::array<float,2>{0.801292956f, 0.194619268f},
-std::array<float,2>{0.297964096f, 0.675498903f},
-std::array<float,2>{0.732003987f, 0.953551292f},
-std::array<float,2>{0.241109535f, 0.269526601f},
-std::array<float,2>{0.51282686f, 0.433021665f},
-std::array<float,2>{0.0590895377f, 0.827821851f},
-std::array<float,2>{0.927764297f, 0.523478985f},
-std::array<float,2>{0.395997763f, 0.0577311814f},
-std::array<float,2>{0.589159429f, 0.134998292f},
-std::array<float,2>{0.113969892f, 0.711813569f},
-std::array<float,2>{0.967712879f, 0.916884482f},
-std::array<float,2>{0.490370512f, 0.317248762f},
-std::array<float,2>{0.855669022f, 0.446239918f},
-std::array<float,2>{0.3153826f, 0.790560603f},
-std::array<float,2>{0.64211005f, 0.570806921f},
-std::array<float,2>{0.17844215f, 0.100211635f},
-std::array<float,2>{0.896652341f, 0.0109548848f},
-std::array<float,2>{0.407253861f, 0.544928551f},
-std::array<float,2>{0.543719709f, 0.858491123f},
-std::array<float,2>{0.0194063839f, 0.383345187f},
-std::array<float,2>{0.699783683f, 0.307165921f},
-std::array<float,2>{0.201495141f, 0.996599317f},
-std::array<float,2>{0.761927009f, 0.636988163f},
-std::array<float,2>{0.25277409f, 0.223807782f},
-std::array<float,2>{0.550123274f, 0.0321741179f},
-std::array<float,2>{0.0133299455f, 0.506260872f},
-std::array<float,2>{0.877943516f, 0.829578042f},
-std::array<float,2>{0.434015065f, 0.419909805f},
-std::array<float,2>{0.777143598f, 0.262392819f},
-std::array<float,2>{0.279055268f, 0.93817395f},
-std::array<float,2>{0.713156402f, 0.66440767f},
-std::array<float,2>{0.218362212f, 0.215903386f},
-std::array<float,2>{0.944288254f, 0.160532013f},
-std::array<float,2>{0.469499499f, 0.748704255f},
-std::array<float,2>{0.577437997f, 0.87697643f},
-std::array<float,2>{0.107130215f, 0.353964418f},
-std::array<float,2>{0.636600018f, 0.480751991f},
-std::array<float,2>{0.15708822f, 0.759913325f},
-std::array<float,2>{0.861655235f, 0.599552453f},
-std::array<float,2>{0.343428522f, 0.0829593614f},
-std::array<float,2>{0.746588767f, 0.237969428f},
-std::array<float,2>{0.232799619f, 0.653138101f},
-std::array<float,2>{0.782186806f, 0.980158687f},
-std::array<float,2>{0.295654237f, 0.282013118f},
-std::array<float,2>{0.919300854f, 0.400278986f},
-std::array<float,2>{0.381671786f, 0.86408627f},
-std::array<float,2>{0.51908493f, 0.550770044f},
-std::array<float,2>{0.0344428942f, 0.0178562757f},
-std::array<float,2>{0.820626974f, 0.112174176f},
-std::array<float,2>{0.355859399f, 0.581194699f},
-std::array<float,2>{0.669260919f, 0.804924428f},
-std::array<float,2>{0.133824661f, 0.462139994f},
-std::array<float,2>{0.604247928f, 0.331632912f},
-std::array<float,2>{0.0836257115f, 0.921952546f},
-std::array<float,2>{0.992416263f, 0.696167409f},
-std::array<float,2>{0.452136159f, 0.14198339f},
-std::array<float,2>{0.72859925f, 0.118324786f},
-std::array<float,2>{0.236440673f, 0.588479578f},
-std::array<float,2>{0.799695373f, 0.801394522f},
-std::array<float,2>{0.301506519f, 0.460527182f},
-std::array<float,2>{0.922416806f, 0.342844963f},
-std::array<float,2>{0.391320199f, 0.929913402f},
-std::array<float,2>{0.50944066f, 0.693526387f},
-std::array<float,2>{0.0582465418f, 0.151594698f},
-std::array<float,2>{0.828409493f, 0.244150117f},
-std::array<float,2>{0.363145918f, 0.643100858f},
-std::array<float,2>{0.684503973f, 0.976553023f},
-std::array<float,2>{0.142009273f, 0.293271244f},
-std::array<float,2>{0.617981434f, 0.395688325f},
-std::array<float,2>{0.0673439428f, 0.873410881f},
-std::array<float,2>{0.975795209f, 0.561151981f},
-std::array<float,2>{0.462560892f, 0.0262755807f},
-std::array<float,2>{0.540666819f, 0.171657577f},
-std::array<float,2>{0.0208791867f, 0.736238301f},
-std::array<float,2>{0.89220953f, 0.887123406f},
-std::array<float,2>{0.412786633f, 0.349450856f},
-std::array<float,2>{0.760813355f, 0.475653738f},
-std::array<float,2>{0.256410182f, 0.756078005f},
-std::array<float,2>{0.697491288f, 0.60507524f},
-std::array<float,2>{0.196254656f, 0.086493887f},
-std::array<float,2>{0.961060643f, 0.0400708467f},
-std::array<float,2>{0.485270232f, 0.514378488f},
-std::array<float,2>{0.593705535f, 0.83740747f},
-std::array<float,2>{0.11031235f, 0.408342153f},
-std::array<float,2>{0.648001671f, 0.255040586f},
-std::array<float,2>{0.173448756f, 0.948771894f},
-std::array<float,2>{0.853832066f, 0.661245406f},
-std::array<float,2>{0.317108512f, 0.20754391f},
-std::array<float,2>{0.572744608f, 0.00429849233f},
-std::array<float,2>{0.10408508f, 0.534501672f},
-std::array<float,2>{0.937837899f, 0.850293696f},
-std::array<float,2>{0.474350154f, 0.37672767f},
-std::array<float,2>{0.865448475f, 0.29815194f},
-std::array<float,2>{0.33959341f, 0.988873661f},
-std::array<float,2>{0.639469445f, 0.626618087f},
-std::array<float,2>{0.162476584f, 0.232439414f},
-std::array<float,2>{0.879345655f, 0.125173017f},
-std::array<float,2>{0.430894494f, 0.705697596f},
-std::array<float,2>{0.551389098f, 0.912545323f},
-std::array<float,2>{0.0113256769f, 0.326468289f},
-std::array<float,2>{0.718730748f, 0.443418413f},
-std::array<float,2>{0.212379783f, 0.785068572f},
-std::array<float,2>{0.778407991f, 0.564344227f},
-std::array<float,2>{0.276041806f, 0.108945057f},
-std::array<float,2>{0.666540205f, 0.200077698f},
-std::array<float,2>{0.137812793f, 0.681825519f},
-std::array<float,2>{0.827783287f, 0.961094022f},
-std::array<float,2>{0.355468452f, 0.276174247f},
-std::array<float,2>{0.997312248f, 0.422717154f},
-std::array<float,2>{0.449150175f, 0.813492835f},
-std::array<float,2>{0.606428623f, 0.515875041f},
-std::array<float,2>{0.0806867033f, 0.0527924411f},
-std::array<float,2>{0.786061645f, 0.064325355f},
-std::array<float,2>{0.292391509f, 0.624516964f},
-std::array<float,2>{0.745563209f, 0.767322183f},
-std::array<float,2>{0.2298816f, 0.495674431f},
-std::array<float,2>{0.522385359f, 0.372440338f},
-std::array<float,2>{0.0383418351f, 0.905991375f},
-std::array<float,2>{0.91709584f, 0.733991563f},
-std::array<float,2>{0.378446311f, 0.183233052f},
-std::array<float,2>{0.630650997f, 0.0600165576f},
-std::array<float,2>{0.166510552f, 0.529138267f},
-std::array<float,2>{0.870164037f, 0.820741832f},
-std::array<float,2>{0.334206372f, 0.435429513f},
-std::array<float,2>{0.947758675f, 0.269927353f},
-std::array<float,2>{0.477741539f, 0.958180428f},
-std::array<float,2>{0.563223839f, 0.677037179f},
-std::array<float,2>{0.0996037051f, 0.188257024f},
-std::array<float,2>{0.769718409f, 0.175599322f},
-std::array<float,2>{0.268477559f, 0.719039142f},
-std::array<float,2>{0.706532061f, 0.8910923f},
-std::array<float,2>{0.209188268f, 0.363540292f},
-std::array<float,2>{0.557168245f, 0.490017802f},
-std::array<float,2>{0.00776956649f, 0.777333081f},
-std::array<float,2>{0.889266908f, 0.612418234f},
-std::array<float,2>{0.426906496f, 0.0737068728f},
-std::array<float,2>{0.598718584f, 0.220703766f},
-std::array<float,2>{0.090683952f, 0.636328757f},
-std::array<float,2>{0.990792692f, 0.995508611f},
-std::array<float,2>{0.439949334f, 0.309922546f},
-std::array<float,2>{0.81948936f, 0.390360206f},
-std::array<float,2>{0.34689945f, 0.853955388f},
-std::array<float,2>{0.659812093f, 0.540091991f},
-std::array<float,2>{0.130662858f, 0.0139881196f},
-std::array<float,2>{0.906562567f, 0.0969481021f},
-std::array<float,2>{0.387907863f, 0.574895978f},
-std::array<float,2>{0.525912762f, 0.795810282f},
-std::array<float,2>{0.0415412001f, 0.45264861f},
-std::array<float,2>{0.737002432f, 0.316392779f},
-std::array<float,2>{0.222450495f, 0.920172453f},
-std::array<float,2>{0.791960716f, 0.717666268f},
-std::array<float,2>{0.287817657f, 0.139608443f},
-std::array<float,2>{0.505085289f, 0.0786527842f},
-std::array<float,2>{0.0494132377f, 0.594173074f},
-std::array<float,2>{0.933983386f, 0.763552248f},
-std::array<float,2>{0.405565768f, 0.479654491f},
-std::array<float,2>{0.807555735f, 0.356236726f},
-std::array<float,2>{0.30667001f, 0.882467508f},
-std::array<float,2>{0.720726967f, 0.742871761f},
-std::array<float,2>{0.24534899f, 0.158374891f},
-std::array<float,2>{0.978717446f, 0.212997779f},
-std::array<float,2>{0.45795539f, 0.669154286f},
-std::array<float,2>{0.612677515f, 0.945170403f},
-std::array<float,2>{0.0742275864f, 0.260659933f},
-std::array<float,2>{0.677042902f, 0.415526688f},
-std::array<float,2>{0.154334068f, 0.835678399f},
-std::array<float,2>{0.841240406f, 0.502506495f},
-std::array<float,2>{0.369829357f, 0.0366433635f},
-std::array<float,2>{0.695017695f, 0.14510417f},
-std::array<float,2>{0.19337602f, 0.701595724f},
-std::array<float,2>{0.75584805f, 0.928037703f},
-std::array<float,2>{0.26090008f, 0.333185941f},
-std::array<float,2>{0.89978677f, 0.465955794f},
-std::array<float,2>{0.41798228f, 0.810976028f},
-std::array<float,2>{0.535988808f, 0.584359467f},
-std::array<float,2>{0.0248250887f, 0.114956394f},
-std::array<float,2>{0.84775877f, 0.0229369588f},
-std::array<float,2>{0.322451353f, 0.552965343f},
-std::array<float,2>{0.653151631f, 0.862964511f},
-std::array<float,2>{0.180030346f, 0.40326333f},
-std::array<float,2>{0.578544497f, 0.28552556f},
-std::array<float,2>{0.11993064f, 0.983837426f},
-std::array<float,2>{0.960490942f, 0.648788929f},
-std::array<float,2>{0.492211431f, 0.241606191f},
-std::array<float,2>{0.740175664f, 0.046541106f},
-std::array<float,2>{0.222914055f, 0.510334432f},
-std::array<float,2>{0.795810044f, 0.840623856f},
-std::array<float,2>{0.284030855f, 0.412213832f},
-std::array<float,2>{0.911224842f, 0.251790553f},
-std::array<float,2>{0.38475579f, 0.950808764f},
-std::array<float,2>{0.528187692f, 0.659834206f},
-std::array<float,2>{0.0445996821f, 0.203862458f},
-std::array<float,2>{0.815859675f, 0.166976154f},
-std::array<float,2>{0.348433316f, 0.740213692f},
-std::array<float,2>{0.663199186f, 0.886232495f},
-std::array<float,2>{0.12831074f, 0.346505404f},
-std::array<float,2>{0.596304059f, 0.471127391f},
-std::array<float,2>{0.0882694498f, 0.750827849f},
-std::array<float,2>{0.987485409f, 0.607473671f},
-std::array<float,2>{0.443112016f, 0.093601495f},
-std::array<float,2>{0.5615412f, 0.248552963f},
-std::array<float,2>{0.00245159422f, 0.645277262f},
-std::array<float,2>{0.885258079f, 0.970968485f},
-std::array<float,2>{0.424502015f, 0.29284814f},
-std::array<float,2>{0.766202867f, 0.391854703f},
-std::array<float,2>{0.271899819f, 0.868245125f},
-std::array<float,2>{0.708152771f, 0.558323801f},
-std::array<float,2>{0.204568356f, 0.0284314007f},
-std::array<float,2>{0.952011049f, 0.123523548f},
-std::array<float,2>{0.483945459f, 0.5924595f},
-std::array<float,2>{0.569467664f, 0.798311055f},
-std::array<float,2>{0.093791455f, 0.454865277f},
-std::array<float,2>{0.626523316f, 0.337103039f},
-std::array<float,2>{0.169880733f, 0.933859408f},
-std::array<float,2>{0.872284353f, 0.6878739f},
-std::array<float,2>{0.330396205f, 0.152939826f},
-std::array<float,2>{0.585461378f, 0.0702569559f},
-std::array<float,2>{0.124585323f, 0.619469583f},
-std::array<float,2>{0.95591706f, 0.77221787f},
-std::array<float,2>{0.497691512f, 0.49826473f},
-std::array<float,2>{0.843797207f, 0.369002402f},
-std::array<float,2>{0.327123225f, 0.898634911f},
-std::array<float,2>{0.650631905f, 0.72945857f},
-std::array<float,2>{0.185116544f, 0.186818287f},
-std::array<float,2>{0.903386116f, 0.197604507f},
-std::array<float,2>{0.414700627f, 0.686570644f},
-std::array<float,2>{0.534483135f, 0.968228102f},
-std::array<float,2>{0.0284216143f, 0.280979097f},
-std::array<float,2>{0.690955818f, 0.426357627f},
-std::array<float,2>{0.189268962f, 0.817165315f},
-std::array<float,2>{0.751710474f, 0.520121753f},
-std::array<float,2>{0.264838189f, 0.0501067638f},
-std::array<float,2>{0.673173368f, 0.129941478f},
-std::array<float,2>{0.149198309f, 0.710007131f},
-std::array<float,2>{0.838292122f, 0.907093167f},
-std::array<float,2>{0.372128248f, 0.322533697f},
-std::array<float,2>{0.980983913f, 0.437810093f},
-std::array<float,2>{0.454547286f, 0.786052585f},
-std::array<float,2>{0.616371334f, 0.567707062f},
-std::array<float,2>{0.0730817914f, 0.104847893f},
-std::array<float,2>{0.811865091f, 0.0009957375f},
-std::array<float,2>{0.312105089f, 0.536604643f},
-std::array<float,2>{0.723528028f, 0.844608307f},
-std::array<float,2>{0.246546596f, 0.382272512f},
-std::array<float,2>{0.50248903f, 0.302571297f},
-std::array<float,2>{0.050895948f, 0.986368001f},
-std::array<float,2>{0.933146358f, 0.630198836f},
-std::array<float,2>{0.399594277f, 0.227900222f},
-std::array<float,2>{0.644337595f, 0.0985781178f},
-std::array<float,2>{0.176626906f, 0.573143005f},
-std::array<float,2>{0.858054101f, 0.792830706f},
-std::array<float,2>{0.312629908f, 0.447943807f},
-std::array<float,2>{0.96487093f, 0.319219202f},
-std::array<float,2>{0.48830989f, 0.9158957f},
-std::array<float,2>{0.587072849f, 0.713125169f},
-std::array<float,2>{0.115605034f, 0.134146705f},
-std::array<float,2>{0.764831364f, 0.224752903f},
-std::array<float,2>{0.251234591f, 0.640602708f},
-std::array<float,2>{0.702725828f, 0.998672545f},
-std::array<float,2>{0.199287564f, 0.304816335f},
-std::array<float,2>{0.546295404f, 0.386588842f},
-std::array<float,2>{0.0170588344f, 0.856909692f},
-std::array<float,2>{0.895172119f, 0.543931842f},
-std::array<float,2>{0.409441322f, 0.0084725963f},
-std::array<float,2>{0.621172309f, 0.179020837f},
-std::array<float,2>{0.066401042f, 0.724531174f},
-std::array<float,2>{0.971508205f, 0.89733398f},
-std::array<float,2>{0.46585232f, 0.360027522f},
-std::array<float,2>{0.833721042f, 0.485123873f},
-std::array<float,2>{0.366691113f, 0.780394673f},
-std::array<float,2>{0.683474302f, 0.614533365f},
-std::array<float,2>{0.145106107f, 0.0757942125f},
-std::array<float,2>{0.927030265f, 0.0565041415f},
-std::array<float,2>{0.397042274f, 0.526596129f},
-std::array<float,2>{0.51550734f, 0.826081216f},
-std::array<float,2>{0.0606351085f, 0.43056336f},
-std::array<float,2>{0.733320117f, 0.266076356f},
-std::array<float,2>{0.239681393f, 0.955542386f},
-std::array<float,2>{0.804546475f, 0.673060179f},
-std::array<float,2>{0.298934966f, 0.191562116f},
-std::array<float,2>{0.516659617f, 0.0173186511f},
-std::array<float,2>{0.0316208079f, 0.548497796f},
-std::array<float,2>{0.921279669f, 0.866212368f},
-std::array<float,2>{0.380627006f, 0.402164698f},
-std::array<float,2>{0.784185231f, 0.283358574f},
-std::array<float,2>{0.293155223f, 0.977321684f},
-std::array<float,2>{0.749932051f, 0.655486405f},
-std::array<float,2>{0.232364714f, 0.235249832f},
-std::array<float,2>{0.994864583f, 0.142671302f},
-std::array<float,2>{0.450122297f, 0.698001325f},
-std::array<float,2>{0.602084994f, 0.924122512f},
-std::array<float,2>{0.0846404359f, 0.328662187f},
-std::array<float,2>{0.671855867f, 0.464172989f},
-std::array<float,2>{0.134933561f, 0.808564901f},
-std::array<float,2>{0.824181139f, 0.579722762f},
-std::array<float,2>{0.358987957f, 0.110482827f},
-std::array<float,2>{0.712312937f, 0.217931956f},
-std::array<float,2>{0.216185167f, 0.66704917f},
-std::array<float,2>{0.775069058f, 0.940167606f},
-std::array<float,2>{0.280666769f, 0.265609235f},
-std::array<float,2>{0.875883162f, 0.421375096f},
-std::array<float,2>{0.437136859f, 0.830221832f},
-std::array<float,2>{0.547176659f, 0.505739748f},
-std::array<float,2>{0.0137171559f, 0.0336742848f},
-std::array<float,2>{0.860046268f, 0.0858120918f},
-std::array<float,2>{0.340593636f, 0.600642085f},
-std::array<float,2>{0.634679317f, 0.758243859f},
-std::array<float,2>{0.158485577f, 0.48265183f},
-std::array<float,2>{0.575573504f, 0.353445917f},
-std::array<float,2>{0.109072767f, 0.875989676f},
-std::array<float,2>{0.941721022f, 0.747962058f},
-std::array<float,2>{0.471796602f, 0.162843421f},
-std::array<float,2>{0.697120547f, 0.089356415f},
-std::array<float,2>{0.198485196f, 0.603289068f},
-std::array<float,2>{0.759759605f, 0.755845368f},
-std::array<float,2>{0.254217148f, 0.474298239f},
-std::array<float,2>{0.894057155f, 0.350205153f},
-std::array<float,2>{0.410995454f, 0.890134871f},
-std::array<float,2>{0.541710675f, 0.737132967f},
-std::array<float,2>{0.0217326023f, 0.16834344f},
-std::array<float,2>{0.852719009f, 0.210127279f},
-std::array<float,2>{0.319942147f, 0.663678586f},
-std::array<float,2>{0.644805312f, 0.94545573f},
-std::array<float,2>{0.174644828f, 0.255939037f},
-std::array<float,2>{0.59114331f, 0.406588554f},
-std::array<float,2>{0.112696312f, 0.838793635f},
-std::array<float,2>{0.96413964f, 0.512270868f},
-std::array<float,2>{0.488246977f, 0.0423521549f},
-std::array<float,2>{0.510291636f, 0.149090305f},
-std::array<float,2>{0.0563104935f, 0.691932917f},
-std::array<float,2>{0.925572276f, 0.932646275f},
-std::array<float,2>{0.39452678f, 0.341517389f},
-std::array<float,2>{0.79711175f, 0.457298338f},
-std::array<float,2>{0.303677738f, 0.802958906f},
-std::array<float,2>{0.72819823f, 0.586240232f},
-std::array<float,2>{0.235833123f, 0.12020357f},
-std::array<float,2>{0.972962141f, 0.0249042716f},
-std::array<float,2>{0.463643134f, 0.558923483f},
-std::array<float,2>{0.620889962f, 0.872207105f},
-std::array<float,2>{0.0684327483f, 0.39692232f},
-std::array<float,2>{0.685899854f, 0.296174198f},
-std::array<float,2>{0.143941194f, 0.974357963f},
-std::array<float,2>{0.831109226f, 0.642383158f},
-std::array<float,2>{0.361156702f, 0.243341431f},
-std::array<float,2>{0.609019637f, 0.0517804027f},
-std::array<float,2>{0.0797091201f, 0.518185675f},
-std::array<float,2>{0.99993968f, 0.8152951f},
-std::array<float,2>{0.445422024f, 0.425763905f},
-std::array<float,2>{0.825537205f, 0.273527086f},
-std::array<float,2>{0.351566762f, 0.962917447f},
-std::array<float,2>{0.665305376f, 0.68092829f},
-std::array<float,2>{0.140368849f, 0.201723665f},
-std::array<float,2>{0.914277852f, 0.181392923f},
-std::array<float,2>{0.375436127f, 0.732316315f},
-std::array<float,2>{0.521372139f, 0.903935969f},
-std::array<float,2>{0.0363420174f, 0.373424023f},
-std::array<float,2>{0.743421316f, 0.493533522f},
-std::array<float,2>{0.227691606f, 0.768326759f},
-std::array<float,2>{0.788557291f, 0.622032702f},
-std::array<float,2>{0.289490432f, 0.0644550398f},
-std::array<float,2>{0.63746202f, 0.230854049f},
-std::array<float,2>{0.161810964f, 0.627466857f},
-std::array<float,2>{0.86362052f, 0.9906376f},
-std::array<float,2>{0.336429209f, 0.299151659f},
-std::array<float,2>{0.941026866f, 0.377643138f},
-std::array<float,2>{0.475420922f, 0.848067343f},
-std::array<float,2>{0.572206318f, 0.531637907f},
-std::array<float,2>{0.102450021f, 0.00617014337f},
-std::array<float,2>{0.779574335f, 0.106712244f},
-std::array<float,2>{0.275201917f, 0.565008759f},
-std::array<float,2>{0.716364324f, 0.783004284f},
-std::array<float,2>{0.214656115f, 0.441449702f},
-std::array<float,2>{0.554399312f, 0.325153708f},
-std::array<float,2>{0.007839269f, 0.911769748f},
-std::array<float,2>{0.881490707f, 0.704461396f},
-std::array<float,2>{0.432265878f, 0.128179595f},
-std::array<float,2>{0.656778634f, 0.0120491562f},
-std::array<float,2>{0.130878821f, 0.542301655f},
-std::array<float,2>{0.817897379f, 0.852640271f},
-std::array<float,2>{0.344275713f, 0.38801074f},
-std::array<float,2>{0.988764584f, 0.310876548f},
-std::array<float,2>{0.438821584f, 0.992765427f},
-std::array<float,2>{0.601275325f, 0.634631157f},
-std::array<float,2>{0.0924156979f, 0.218838647f},
-std::array<float,2>{0.789879084f, 0.138563424f},
-std::array<float,2>{0.285878867f, 0.716774344f},
-std::array<float,2>{0.735717177f, 0.918871999f},
-std::array<float,2>{0.219034672f, 0.314435512f},
-std::array<float,2>{0.524294913f, 0.450271934f},
-std::array<float,2>{0.0400840454f, 0.793039441f},
-std::array<float,2>{0.908300817f, 0.576258898f},
-std::array<float,2>{0.390258372f, 0.0949558094f},
-std::array<float,2>{0.566333652f, 0.1896521f},
-std::array<float,2>{0.101534545f, 0.678115129f},
-std::array<float,2>{0.946046174f, 0.95952034f},
-std::array<float,2>{0.478758663f, 0.272436947f},
-std::array<float,2>{0.868696809f, 0.436192751f},
-std::array<float,2>{0.332234949f, 0.823390663f},
-std::array<float,2>{0.632105231f, 0.530138671f},
-std::array<float,2>{0.164436564f, 0.0613902695f},
-std::array<float,2>{0.887393057f, 0.0722648874f},
-std::array<float,2>{0.429326385f, 0.610777736f},
-std::array<float,2>{0.555089593f, 0.774948776f},
-std::array<float,2>{0.00549335871f, 0.491588593f},
-std::array<float,2>{0.704927742f, 0.366205812f},
-std::array<float,2>{0.207048491f, 0.893726766f},
-std::array<float,2>{0.773016572f, 0.720766664f},
-std::array<float,2>{0.267405808f, 0.17285639f},
-std::array<float,2>{0.537298739f, 0.1168423f},
-std::array<float,2>{0.0267659947f, 0.583972275f},
-std::array<float,2>{0.900919557f, 0.808756113f},
-std::array<float,2>{0.421670824f, 0.467334896f},
-std::array<float,2>{0.756979585f, 0.334824443f},
-std::array<float,2>{0.259702384f, 0.92684406f},
-std::array<float,2>{0.691597283f, 0.700567603f},
-std::array<float,2>{0.191617593f, 0.146490574f},
-std::array<float,2>{0.957727373f, 0.239825711f},
-std::array<float,2>{0.495532393f, 0.650732636f},
-std::array<float,2>{0.581032753f, 0.981862307f},
-std::array<float,2>{0.117523119f, 0.287643284f},
-std::array<float,2>{0.655872822f, 0.404425532f},
-std::array<float,2>{0.182777479f, 0.85951978f},
-std::array<float,2>{0.850017369f, 0.552156866f},
-std::array<float,2>{0.320605218f, 0.0214552581f},
-std::array<float,2>{0.719836712f, 0.157384783f},
-std::array<float,2>{0.243334919f, 0.745662451f},
-std::array<float,2>{0.805682898f, 0.880731106f},
-std::array<float,2>{0.305855721f, 0.358432502f},
-std::array<float,2>{0.936001003f, 0.477413774f},
-std::array<float,2>{0.40288195f, 0.765168548f},
-std::array<float,2>{0.507358134f, 0.597229958f},
-std::array<float,2>{0.0472163036f, 0.0809484348f},
-std::array<float,2>{0.842373669f, 0.0384950265f},
-std::array<float,2>{0.367818117f, 0.501006007f},
-std::array<float,2>{0.679584742f, 0.832735777f},
-std::array<float,2>{0.15328218f, 0.417442381f},
-std::array<float,2>{0.609563708f, 0.257858396f},
-std::array<float,2>{0.0762156695f, 0.94240731f},
-std::array<float,2>{0.977616429f, 0.670687854f},
-std::array<float,2>{0.459298193f, 0.212549031f},
-std::array<float,2>{0.723948002f, 0.00202593533f},
-std::array<float,2>{0.24712871f, 0.538650215f},
-std::array<float,2>{0.811455965f, 0.84759587f},
-std::array<float,2>{0.310819089f, 0.380112946f},
-std::array<float,2>{0.93235153f, 0.303451449f},
-std::array<float,2>{0.398867428f, 0.985266924f},
-std::array<float,2>{0.503686845f, 0.632226825f},
-std::array<float,2>{0.0521775186f, 0.229496613f},
-std::array<float,2>{0.839380682f, 0.131837487f},
-std::array<float,2>{0.371893048f, 0.70849061f},
-std::array<float,2>{0.672702074f, 0.910013378f},
-std::array<float,2>{0.15019381f, 0.321283787f},
-std::array<float,2>{0.615539491f, 0.44018954f},
-std::array<float,2>{0.0735318735f, 0.787835956f},
-std::array<float,2>{0.98149085f, 0.568862855f},
-std::array<float,2>{0.453857005f, 0.103264488f},
-std::array<float,2>{0.533674538f, 0.195732847f},
-std::array<float,2>{0.0276659746f, 0.685323417f},
-std::array<float,2>{0.902997255f, 0.965600431f},
-std::array<float,2>{0.415647745f, 0.279013723f},
-std::array<float,2>{0.750840425f, 0.428367764f},
-std::array<float,2>{0.26385498f, 0.819940746f},
-std::array<float,2>{0.690014541f, 0.52328527f},
-std::array<float,2>{0.187708393f, 0.0485564955f},
-std::array<float,2>{0.956512749f, 0.0677182749f},
-std::array<float,2>{0.496752501f, 0.618283272f},
-std::array<float,2>{0.584258318f, 0.770065844f},
-std::array<float,2>{0.123503558f, 0.497548074f},
-std::array<float,2>{0.652024984f, 0.369734168f},
-std::array<float,2>{0.183828384f, 0.901293933f},
-std::array<float,2>{0.844861388f, 0.728272319f},
-std::array<float,2>{0.327518791f, 0.183642238f},
-std::array<float,2>{0.568785846f, 0.122909524f},
-std::array<float,2>{0.094869256f, 0.591109931f},
-std::array<float,2>{0.952511013f, 0.800162733f},
-std::array<float,2>{0.482794374f, 0.456151366f},
-std::array<float,2>{0.871285021f, 0.338564754f},
-std::array<float,2>{0.331082702f, 0.935625374f},
-std::array<float,2>{0.625005782f, 0.689518452f},
-std::array<float,2>{0.168016076f, 0.15503563f},
-std::array<float,2>{0.885840654f, 0.246167883f},
-std::array<float,2>{0.424931705f, 0.648204088f},
-std::array<float,2>{0.561117709f, 0.969464183f},
-std::array<float,2>{0.0037010801f, 0.289100856f},
-std::array<float,2>{0.707979441f, 0.394167185f},
-std::array<float,2>{0.20393464f, 0.86985749f},
-std::array<float,2>{0.767542899f, 0.555971742f},
-std::array<float,2>{0.272799194f, 0.0310724881f},
-std::array<float,2>{0.662679791f, 0.164771467f},
-std::array<float,2>{0.127766028f, 0.740270078f},
-std::array<float,2>{0.814674795f, 0.883817673f},
-std::array<float,2>{0.349040806f, 0.344836593f},
-std::array<float,2>{0.986552656f, 0.469591707f},
-std::array<float,2>{0.442121804f, 0.75351125f},
-std::array<float,2>{0.597524464f, 0.606223047f},
-std::array<float,2>{0.0894960538f, 0.0898916423f},
-std::array<float,2>{0.796200693f, 0.0435280353f},
-std::array<float,2>{0.284641355f, 0.508917689f},
-std::array<float,2>{0.738769293f, 0.841915071f},
-std::array<float,2>{0.224576354f, 0.411552131f},
-std::array<float,2>{0.5291484f, 0.252552062f},
-std::array<float,2>{0.0430973098f, 0.952368259f},
-std::array<float,2>{0.910569787f, 0.658149064f},
-std::array<float,2>{0.383312792f, 0.205340549f},
-std::array<float,2>{0.633297682f, 0.0833557174f},
-std::array<float,2>{0.159585357f, 0.598543882f},
-std::array<float,2>{0.860988379f, 0.761446953f},
-std::array<float,2>{0.341026515f, 0.482297421f},
-std::array<float,2>{0.94287163f, 0.355463743f},
-std::array<float,2>{0.470762074f, 0.878460586f},
-std::array<float,2>{0.575101614f, 0.749803603f},
-std::array<float,2>{0.108151972f, 0.161661357f},
-std::array<float,2>{0.77385807f, 0.215247989f},
-std::array<float,2>{0.279879391f, 0.665842712f},
-std::array<float,2>{0.711743832f, 0.938902318f},
-std::array<float,2>{0.215034291f, 0.262919158f},
-std::array<float,2>{0.5484851f, 0.418852687f},
-std::array<float,2>{0.0152124921f, 0.828830004f},
-std::array<float,2>{0.876015306f, 0.507066429f},
-std::array<float,2>{0.436259836f, 0.0323680677f},
-std::array<float,2>{0.60324502f, 0.141152963f},
-std::array<float,2>{0.0857599303f, 0.696867287f},
-std::array<float,2>{0.995367587f, 0.923222244f},
-std::array<float,2>{0.450475484f, 0.330504775f},
-std::array<float,2>{0.822603881f, 0.461029947f},
-std::array<float,2>{0.358161569f, 0.805843592f},
-std::array<float,2>{0.670136511f, 0.580450892f},
-std::array<float,2>{0.136646971f, 0.113057382f},
-std::array<float,2>{0.920846879f, 0.0189319961f},
-std::array<float,2>{0.379416406f, 0.549669802f},
-std::array<float,2>{0.515777171f, 0.864730537f},
-std::array<float,2>{0.0328598917f, 0.399246663f},
-std::array<float,2>{0.748477578f, 0.282658219f},
-std::array<float,2>{0.230884627f, 0.97858876f},
-std::array<float,2>{0.783273458f, 0.654214621f},
-std::array<float,2>{0.294442058f, 0.236488611f},
-std::array<float,2>{0.514032483f, 0.0574790537f},
-std::array<float,2>{0.0623770319f, 0.525034666f},
-std::array<float,2>{0.926350117f, 0.827053487f},
-std::array<float,2>{0.398390293f, 0.43167749f},
-std::array<float,2>{0.802869797f, 0.267676145f},
-std::array<float,2>{0.300632179f, 0.954431832f},
-std::array<float,2>{0.734128356f, 0.674028099f},
-std::array<float,2>{0.239177763f, 0.194179967f},
-std::array<float,2>{0.972361088f, 0.177556008f},
-std::array<float,2>{0.465561032f, 0.726479828f},
-std::array<float,2>{0.62304306f, 0.894781232f},
-std::array<float,2>{0.0651011467f, 0.362428993f},
-std::array<float,2>{0.682449698f, 0.487652421f},
-std::array<float,2>{0.146474212f, 0.778983355f},
-std::array<float,2>{0.832650185f, 0.61562264f},
-std::array<float,2>{0.366015226f, 0.0774398744f},
-std::array<float,2>{0.701594234f, 0.223119721f},
-std::array<float,2>{0.200760603f, 0.637888193f},
-std::array<float,2>{0.764153302f, 0.997281313f},
-std::array<float,2>{0.250501513f, 0.307663441f},
-std::array<float,2>{0.896318376f, 0.384460658f},
-std::array<float,2>{0.40873304f, 0.857455611f},
-std::array<float,2>{0.545414925f, 0.546669364f},
-std::array<float,2>{0.016378494f, 0.00988577586f},
-std::array<float,2>{0.858663082f, 0.101284511f},
-std::array<float,2>{0.314424872f, 0.571877241f},
-std::array<float,2>{0.642605782f, 0.789218664f},
-std::array<float,2>{0.176787913f, 0.446912199f},
-std::array<float,2>{0.586750686f, 0.318317622f},
-std::array<float,2>{0.116398536f, 0.917259634f},
-std::array<float,2>{0.966571033f, 0.712179124f},
-std::array<float,2>{0.489702851f, 0.136229694f},
-std::array<float,2>{0.715742171f, 0.107819214f},
-std::array<float,2>{0.213143066f, 0.562631905f},
-std::array<float,2>{0.780930161f, 0.783341289f},
-std::array<float,2>{0.273739696f, 0.445000559f},
-std::array<float,2>{0.882586956f, 0.32801339f},
-std::array<float,2>{0.432791382f, 0.913640022f},
-std::array<float,2>{0.552833259f, 0.706310689f},
-std::array<float,2>{0.00915144011f, 0.126113117f},
-std::array<float,2>{0.864878654f, 0.233867809f},
-std::array<float,2>{0.337480932f, 0.625683069f},
-std::array<float,2>{0.638194799f, 0.990197957f},
-std::array<float,2>{0.160269558f, 0.297057003f},
-std::array<float,2>{0.570909441f, 0.375016809f},
-std::array<float,2>{0.10333062f, 0.851042092f},
-std::array<float,2>{0.940179944f, 0.53393513f},
-std::array<float,2>{0.475709945f, 0.00570663856f},
-std::array<float,2>{0.519881427f, 0.181906268f},
-std::array<float,2>{0.0359847955f, 0.732459128f},
-std::array<float,2>{0.915250897f, 0.904425859f},
-std::array<float,2>{0.376946986f, 0.371209472f},
-std::array<float,2>{0.787838101f, 0.494616717f},
-std::array<float,2>{0.290945172f, 0.766176879f},
-std::array<float,2>{0.742431939f, 0.623975456f},
-std::array<float,2>{0.226976827f, 0.0632640943f},
-std::array<float,2>{0.998411417f, 0.0540205762f},
-std::array<float,2>{0.446813911f, 0.516850889f},
-std::array<float,2>{0.607559383f, 0.813147902f},
-std::array<float,2>{0.0781526864f, 0.423059464f},
-std::array<float,2>{0.664486349f, 0.277146548f},
-std::array<float,2>{0.139569283f, 0.962435603f},
-std::array<float,2>{0.824471951f, 0.683578491f},
-std::array<float,2>{0.35340783f, 0.200451016f},
-std::array<float,2>{0.619617164f, 0.0271519385f},
-std::array<float,2>{0.0695501938f, 0.561628461f},
-std::array<float,2>{0.97390008f, 0.874717653f},
-std::array<float,2>{0.464397013f, 0.394888163f},
-std::array<float,2>{0.830784261f, 0.294275403f},
-std::array<float,2>{0.359491885f, 0.974878192f},
-std::array<float,2>{0.686849952f, 0.643784344f},
-std::array<float,2>{0.143147588f, 0.245887518f},
-std::array<float,2>{0.924629569f, 0.150983199f},
-std::array<float,2>{0.393194407f, 0.69527936f},
-std::array<float,2>{0.511233985f, 0.931468844f},
-std::array<float,2>{0.0547668189f, 0.342028886f},
-std::array<float,2>{0.726806879f, 0.459188044f},
-std::array<float,2>{0.234451547f, 0.802566469f},
-std::array<float,2>{0.798675179f, 0.589283764f},
-std::array<float,2>{0.304323316f, 0.11784859f},
-std::array<float,2>{0.646042109f, 0.208332643f},
-std::array<float,2>{0.17564775f, 0.660837471f},
-std::array<float,2>{0.8523826f, 0.947438538f},
-std::array<float,2>{0.318756074f, 0.25413546f},
-std::array<float,2>{0.963802874f, 0.409692854f},
-std::array<float,2>{0.487259269f, 0.836718917f},
-std::array<float,2>{0.590172946f, 0.515557587f},
-std::array<float,2>{0.111907415f, 0.0394687802f},
-std::array<float,2>{0.758591175f, 0.0876850784f},
-std::array<float,2>{0.254893482f, 0.603715241f},
-std::array<float,2>{0.695631564f, 0.757611334f},
-std::array<float,2>{0.197696522f, 0.474742532f},
-std::array<float,2>{0.542721748f, 0.348243743f},
-std::array<float,2>{0.0229779761f, 0.888173103f},
-std::array<float,2>{0.893428683f, 0.734766841f},
-std::array<float,2>{0.411866993f, 0.170662403f},
-std::array<float,2>{0.678266048f, 0.0355749093f},
-std::array<float,2>{0.154221043f, 0.503430843f},
-std::array<float,2>{0.843110144f, 0.83435744f},
-std::array<float,2>{0.368616819f, 0.414901525f},
-std::array<float,2>{0.977021813f, 0.261019707f},
-std::array<float,2>{0.460786998f, 0.943409204f},
-std::array<float,2>{0.610479474f, 0.668345332f},
-std::array<float,2>{0.0778766125f, 0.214142069f},
-std::array<float,2>{0.805462241f, 0.15956755f},
-std::array<float,2>{0.304994226f, 0.744092405f},
-std::array<float,2>{0.718870044f, 0.881501436f},
-std::array<float,2>{0.242993027f, 0.356943786f},
-std::array<float,2>{0.505934119f, 0.479426682f},
-std::array<float,2>{0.0487194024f, 0.762037873f},
-std::array<float,2>{0.936700761f, 0.594768882f},
-std::array<float,2>{0.403385878f, 0.0791063309f},
-std::array<float,2>{0.582028091f, 0.24059321f},
-std::array<float,2>{0.118638821f, 0.649653018f},
-std::array<float,2>{0.958021164f, 0.982986748f},
-std::array<float,2>{0.494161516f, 0.287036628f},
-std::array<float,2>{0.85149616f, 0.404253453f},
-std::array<float,2>{0.32190755f, 0.861496627f},
-std::array<float,2>{0.654766321f, 0.554621875f},
-std::array<float,2>{0.182078093f, 0.0217612609f},
-std::array<float,2>{0.901928723f, 0.11335589f},
-std::array<float,2>{0.420426667f, 0.585142672f},
-std::array<float,2>{0.538262904f, 0.811609566f},
-std::array<float,2>{0.0260045603f, 0.465810359f},
-std::array<float,2>{0.692871869f, 0.33239907f},
-std::array<float,2>{0.192681134f, 0.92955792f},
-std::array<float,2>{0.756450832f, 0.703021526f},
-std::array<float,2>{0.258051842f, 0.146160319f},
-std::array<float,2>{0.555746138f, 0.0730713233f},
-std::array<float,2>{0.003992307f, 0.611953557f},
-std::array<float,2>{0.888194442f, 0.775630236f},
-std::array<float,2>{0.428703427f, 0.489167213f},
-std::array<float,2>{0.771725357f, 0.364785612f},
-std::array<float,2>{0.266038775f, 0.891899824f},
-std::array<float,2>{0.70391643f, 0.720687926f},
-std::array<float,2>{0.208264858f, 0.174672872f},
-std::array<float,2>{0.946457505f, 0.188827932f},
-std::array<float,2>{0.480199963f, 0.675967216f},
-std::array<float,2>{0.565422058f, 0.957579553f},
-std::array<float,2>{0.100466058f, 0.270670533f},
-std::array<float,2>{0.631753504f, 0.434345454f},
-std::array<float,2>{0.165314063f, 0.821984351f},
-std::array<float,2>{0.867381692f, 0.527695775f},
-std::array<float,2>{0.333173215f, 0.058807198f},
-std::array<float,2>{0.73468703f, 0.139689386f},
-std::array<float,2>{0.219809011f, 0.718214333f},
-std::array<float,2>{0.790465295f, 0.921082497f},
-std::array<float,2>{0.286646307f, 0.314879417f},
-std::array<float,2>{0.909690738f, 0.451567024f},
-std::array<float,2>{0.389046878f, 0.796739101f},
-std::array<float,2>{0.525331676f, 0.575775802f},
-std::array<float,2>{0.0393972918f, 0.0958618447f},
-std::array<float,2>{0.816735268f, 0.0151863825f},
-std::array<float,2>{0.345112979f, 0.5399791f},
-std::array<float,2>{0.657647014f, 0.855311513f},
-std::array<float,2>{0.132367089f, 0.38953051f},
-std::array<float,2>{0.599677861f, 0.309037566f},
-std::array<float,2>{0.0936480835f, 0.994280398f},
-std::array<float,2>{0.989830852f, 0.635118604f},
-std::array<float,2>{0.438252866f, 0.222483486f},
-std::array<float,2>{0.689362526f, 0.0488530248f},
-std::array<float,2>{0.190095484f, 0.521237552f},
-std::array<float,2>{0.752175629f, 0.817433178f},
-std::array<float,2>{0.263152272f, 0.426970482f},
-std::array<float,2>{0.904645383f, 0.279470176f},
-std::array<float,2>{0.416379452f, 0.96764046f},
-std::array<float,2>{0.531932235f, 0.685942471f},
-std::array<float,2>{0.0304678157f, 0.198598072f},
-std::array<float,2>{0.846569836f, 0.185573146f},
-std::array<float,2>{0.324647218f, 0.730257094f},
-std::array<float,2>{0.648687959f, 0.899568439f},
-std::array<float,2>{0.186861634f, 0.367476374f},
-std::array<float,2>{0.583729923f, 0.499034196f},
-std::array<float,2>{0.121275894f, 0.773102939f},
-std::array<float,2>{0.953540146f, 0.620950997f},
-std::array<float,2>{0.499936432f, 0.0684439167f},
-std::array<float,2>{0.500976264f, 0.227521271f},
-std::array<float,2>{0.0532058328f, 0.629292548f},
-std::array<float,2>{0.929951727f, 0.98752439f},
-std::array<float,2>{0.400487542f, 0.301255703f},
-std::array<float,2>{0.810336292f, 0.381199002f},
-std::array<float,2>{0.309604973f, 0.845180213f},
-std::array<float,2>{0.724701524f, 0.535328567f},
-std::array<float,2>{0.248821646f, 0.000468800514f},
-std::array<float,2>{0.984255672f, 0.10425023f},
-std::array<float,2>{0.45618701f, 0.567342639f},
-std::array<float,2>{0.613559961f, 0.786906004f},
-std::array<float,2>{0.0722445846f, 0.439326614f},
-std::array<float,2>{0.67443651f, 0.324180037f},
-std::array<float,2>{0.150451958f, 0.908111691f},
-std::array<float,2>{0.837395489f, 0.709393919f},
-std::array<float,2>{0.374136925f, 0.129179165f},
-std::array<float,2>{0.595540524f, 0.0918264017f},
-std::array<float,2>{0.087484479f, 0.608869553f},
-std::array<float,2>{0.985594749f, 0.751791537f},
-std::array<float,2>{0.443805277f, 0.472168833f},
-std::array<float,2>{0.813280106f, 0.347076148f},
-std::array<float,2>{0.350169688f, 0.885001957f},
-std::array<float,2>{0.661246777f, 0.738502681f},
-std::array<float,2>{0.126255199f, 0.167829022f},
-std::array<float,2>{0.912885129f, 0.204356581f},
-std::array<float,2>{0.384808332f, 0.658888757f},
-std::array<float,2>{0.530206084f, 0.950153053f},
-std::array<float,2>{0.0467854068f, 0.250725448f},
-std::array<float,2>{0.741626084f, 0.413884372f},
-std::array<float,2>{0.225439653f, 0.841300547f},
-std::array<float,2>{0.793432534f, 0.511586607f},
-std::array<float,2>{0.282314956f, 0.0453367047f},
-std::array<float,2>{0.628072739f, 0.154087245f},
-std::array<float,2>{0.170495585f, 0.688817799f},
-std::array<float,2>{0.873860598f, 0.934689999f},
-std::array<float,2>{0.329697102f, 0.336864978f},
-std::array<float,2>{0.949730039f, 0.45352307f},
-std::array<float,2>{0.480610967f, 0.797383904f},
-std::array<float,2>{0.566638827f, 0.59281528f},
-std::array<float,2>{0.0964060351f, 0.124945521f},
-std::array<float,2>{0.769215643f, 0.0283101238f},
-std::array<float,2>{0.270873636f, 0.556771994f},
-std::array<float,2>{0.70944947f, 0.867903411f},
-std::array<float,2>{0.206648722f, 0.390628159f},
-std::array<float,2>{0.559132993f, 0.291488737f},
-std::array<float,2>{0.00193920534f, 0.971716166f},
-std::array<float,2>{0.883946836f, 0.645977855f},
-std::array<float,2>{0.422999501f, 0.249244466f},
-std::array<float,2>{0.668272495f, 0.11004357f},
-std::array<float,2>{0.132966787f, 0.578740358f},
-std::array<float,2>{0.821692407f, 0.807465732f},
-std::array<float,2>{0.357088178f, 0.463271976f},
-std::array<float,2>{0.993925035f, 0.329297632f},
-std::array<float,2>{0.452154875f, 0.925477445f},
-std::array<float,2>{0.605362296f, 0.698512793f},
-std::array<float,2>{0.0823486522f, 0.144165456f},
-std::array<float,2>{0.78232199f, 0.235474646f},
-std::array<float,2>{0.296454906f, 0.654548705f},
-std::array<float,2>{0.747968197f, 0.978111625f},
-std::array<float,2>{0.23344253f, 0.284529418f},
-std::array<float,2>{0.518217444f, 0.400832713f},
-std::array<float,2>{0.0333028771f, 0.865793109f},
-std::array<float,2>{0.918588758f, 0.547820091f},
-std::array<float,2>{0.382284135f, 0.0165100954f},
-std::array<float,2>{0.576646209f, 0.163264528f},
-std::array<float,2>{0.105734035f, 0.747005045f},
-std::array<float,2>{0.945029557f, 0.875319898f},
-std::array<float,2>{0.470095336f, 0.351730704f},
-std::array<float,2>{0.863124073f, 0.483688861f},
-std::array<float,2>{0.341813773f, 0.759038925f},
-std::array<float,2>{0.634995222f, 0.600204527f},
-std::array<float,2>{0.15784587f, 0.0841137692f},
-std::array<float,2>{0.877375662f, 0.0348091535f},
-std::array<float,2>{0.434981346f, 0.504775941f},
-std::array<float,2>{0.549475551f, 0.831797123f},
-std::array<float,2>{0.0123799415f, 0.420583576f},
-std::array<float,2>{0.714335859f, 0.264068604f},
-std::array<float,2>{0.216999635f, 0.941176951f},
-std::array<float,2>{0.77601546f, 0.666549265f},
-std::array<float,2>{0.278164774f, 0.217485696f},
-std::array<float,2>{0.544313788f, 0.00910576154f},
-std::array<float,2>{0.0176465493f, 0.544606268f},
-std::array<float,2>{0.897658706f, 0.855878949f},
-std::array<float,2>{0.406271547f, 0.385320216f},
-std::array<float,2>{0.763269365f, 0.305993676f},
-std::array<float,2>{0.253436863f, 0.999520898f},
-std::array<float,2>{0.700819373f, 0.638716817f},
-std::array<float,2>{0.202331603f, 0.226211533f},
-std::array<float,2>{0.968130708f, 0.133102879f},
-std::array<float,2>{0.491662502f, 0.714583755f},
-std::array<float,2>{0.588290334f, 0.914290965f},
-std::array<float,2>{0.114935838f, 0.31958136f},
-std::array<float,2>{0.641001284f, 0.448302269f},
-std::array<float,2>{0.179524571f, 0.791048944f},
-std::array<float,2>{0.856575608f, 0.573546827f},
-std::array<float,2>{0.31571871f, 0.0992102325f},
-std::array<float,2>{0.730710804f, 0.192491338f},
-std::array<float,2>{0.241619319f, 0.672586083f},
-std::array<float,2>{0.802098632f, 0.956742764f},
-std::array<float,2>{0.29758057f, 0.266819805f},
-std::array<float,2>{0.928974152f, 0.431366265f},
-std::array<float,2>{0.394963652f, 0.825098872f},
-std::array<float,2>{0.512382925f, 0.525604308f},
-std::array<float,2>{0.0601195656f, 0.0547369272f},
-std::array<float,2>{0.835279286f, 0.0743068457f},
-std::array<float,2>{0.363665879f, 0.613994718f},
-std::array<float,2>{0.680616379f, 0.779897511f},
-std::array<float,2>{0.147392988f, 0.485476851f},
-std::array<float,2>{0.623997152f, 0.360751331f},
-std::array<float,2>{0.0630944222f, 0.898410499f},
-std::array<float,2>{0.9699049f, 0.723156214f},
-std::array<float,2>{0.467413753f, 0.178306326f},
-std::array<float,2>{0.745052159f, 0.0663874522f},
-std::array<float,2>{0.228990704f, 0.622698367f},
-std::array<float,2>{0.78645128f, 0.769139767f},
-std::array<float,2>{0.291201353f, 0.492536038f},
-std::array<float,2>{0.916474462f, 0.374762565f},
-std::array<float,2>{0.377141356f, 0.903178334f},
-std::array<float,2>{0.522763908f, 0.73066026f},
-std::array<float,2>{0.0377958156f, 0.179802611f},
-std::array<float,2>{0.827028573f, 0.20292528f},
-std::array<float,2>{0.354353845f, 0.679742813f},
-std::array<float,2>{0.667289793f, 0.963917494f},
-std::array<float,2>{0.137197226f, 0.27529642f},
-std::array<float,2>{0.606623352f, 0.424178511f},
-std::array<float,2>{0.0819891021f, 0.815750957f},
-std::array<float,2>{0.996836245f, 0.518616259f},
-std::array<float,2>{0.447364658f, 0.0516366288f},
-std::array<float,2>{0.552421749f, 0.126975462f},
-std::array<float,2>{0.0101472205f, 0.70365715f},
-std::array<float,2>{0.880488694f, 0.910620391f},
-std::array<float,2>{0.430095404f, 0.326005757f},
-std::array<float,2>{0.777930915f, 0.442467898f},
-std::array<float,2>{0.277193725f, 0.781761885f},
-std::array<float,2>{0.7169348f, 0.566248298f},
-std::array<float,2>{0.211025774f, 0.106268026f},
-std::array<float,2>{0.93908906f, 0.00780038303f},
-std::array<float,2>{0.472912341f, 0.532356143f},
-std::array<float,2>{0.574096322f, 0.848933399f},
-std::array<float,2>{0.104635045f, 0.378380477f},
-std::array<float,2>{0.640416741f, 0.300505012f},
-std::array<float,2>{0.163988471f, 0.99152571f},
-std::array<float,2>{0.866964936f, 0.628855407f},
-std::array<float,2>{0.338646382f, 0.232280642f},
-std::array<float,2>{0.59230715f, 0.0417652652f},
-std::array<float,2>{0.110372558f, 0.513501167f},
-std::array<float,2>{0.962708116f, 0.839409828f},
-std::array<float,2>{0.486247301f, 0.407411397f},
-std::array<float,2>{0.854987144f, 0.25738427f},
-std::array<float,2>{0.317496151f, 0.946395099f},
-std::array<float,2>{0.6468907f, 0.662401676f},
-std::array<float,2>{0.172743171f, 0.209119558f},
-std::array<float,2>{0.891098499f, 0.16936557f},
-std::array<float,2>{0.413315237f, 0.737789392f},
-std::array<float,2>{0.539491177f, 0.889110386f},
-std::array<float,2>{0.0198784471f, 0.351372272f},
-std::array<float,2>{0.698530018f, 0.4733679f},
-std::array<float,2>{0.197053954f, 0.754459798f},
-std::array<float,2>{0.760542452f, 0.601990402f},
-std::array<float,2>{0.257684529f, 0.0887207687f},
-std::array<float,2>{0.685188115f, 0.242382511f},
-std::array<float,2>{0.141518563f, 0.641228914f},
-std::array<float,2>{0.829816282f, 0.973612368f},
-std::array<float,2>{0.361357003f, 0.295236856f},
-std::array<float,2>{0.975306392f, 0.397616357f},
-std::array<float,2>{0.46155414f, 0.87158072f},
-std::array<float,2>{0.618766963f, 0.559572935f},
-std::array<float,2>{0.068039678f, 0.0235416554f},
-std::array<float,2>{0.799964249f, 0.119152524f},
-std::array<float,2>{0.302179277f, 0.58754909f},
-std::array<float,2>{0.729793966f, 0.80417186f},
-std::array<float,2>{0.23810558f, 0.458168f},
-std::array<float,2>{0.507903457f, 0.340524435f},
-std::array<float,2>{0.0573927015f, 0.931907594f},
-std::array<float,2>{0.923291624f, 0.692684352f},
-std::array<float,2>{0.391798913f, 0.149900451f},
-std::array<float,2>{0.654184699f, 0.0204560123f},
-std::array<float,2>{0.181488395f, 0.551110685f},
-std::array<float,2>{0.848674774f, 0.860921264f},
-std::array<float,2>{0.32401377f, 0.405424923f},
-std::array<float,2>{0.959138691f, 0.288398772f},
-std::array<float,2>{0.493886411f, 0.981236398f},
-std::array<float,2>{0.579506397f, 0.651916265f},
-std::array<float,2>{0.120369382f, 0.238420621f},
-std::array<float,2>{0.754592538f, 0.148008436f},
-std::array<float,2>{0.260466248f, 0.699512661f},
-std::array<float,2>{0.694241166f, 0.926618874f},
-std::array<float,2>{0.194854692f, 0.335357398f},
-std::array<float,2>{0.536505699f, 0.467976242f},
-std::array<float,2>{0.0240682159f, 0.810336351f},
-std::array<float,2>{0.899211347f, 0.582122386f},
-std::array<float,2>{0.419311732f, 0.115329519f},
-std::array<float,2>{0.611666143f, 0.211306736f},
-std::array<float,2>{0.0761571229f, 0.671381235f},
-std::array<float,2>{0.980397224f, 0.942309082f},
-std::array<float,2>{0.458898365f, 0.259495288f},
-std::array<float,2>{0.840596616f, 0.416207254f},
-std::array<float,2>{0.370518357f, 0.833446324f},
-std::array<float,2>{0.675912023f, 0.500401795f},
-std::array<float,2>{0.156123519f, 0.0377223268f},
-std::array<float,2>{0.934605777f, 0.0818458647f},
-std::array<float,2>{0.404763162f, 0.596595347f},
-std::array<float,2>{0.50451833f, 0.763864279f},
-std::array<float,2>{0.0503083766f, 0.478291214f},
-std::array<float,2>{0.721847057f, 0.35836339f},
-std::array<float,2>{0.244809061f, 0.879140377f},
-std::array<float,2>{0.808154821f, 0.744727969f},
-std::array<float,2>{0.30779767f, 0.157217935f},
-std::array<float,2>{0.527076542f, 0.0942418501f},
-std::array<float,2>{0.0429645814f, 0.577997863f},
-std::array<float,2>{0.90723604f, 0.794817924f},
-std::array<float,2>{0.387191743f, 0.449803889f},
-std::array<float,2>{0.792366922f, 0.312822491f},
-std::array<float,2>{0.289027452f, 0.919338942f},
-std::array<float,2>{0.737945795f, 0.715627372f},
-std::array<float,2>{0.221275777f, 0.137659907f},
-std::array<float,2>{0.991702139f, 0.220170841f},
-std::array<float,2>{0.441066116f, 0.633247495f},
-std::array<float,2>{0.598332167f, 0.993904948f},
-std::array<float,2>{0.0917711183f, 0.312330008f},
-std::array<float,2>{0.65903753f, 0.387312621f},
-std::array<float,2>{0.129523799f, 0.851667166f},
-std::array<float,2>{0.819230795f, 0.54191035f},
-std::array<float,2>{0.346119195f, 0.0132725015f},
-std::array<float,2>{0.705971301f, 0.172684342f},
-std::array<float,2>{0.209962592f, 0.721922696f},
-std::array<float,2>{0.77113688f, 0.893137515f},
-std::array<float,2>{0.268943191f, 0.366598934f},
-std::array<float,2>{0.890309155f, 0.490355223f},
-std::array<float,2>{0.426490247f, 0.773935914f},
-std::array<float,2>{0.557981491f, 0.610141158f},
-std::array<float,2>{0.00609172368f, 0.0704706311f},
-std::array<float,2>{0.87007916f, 0.0615373142f},
-std::array<float,2>{0.335304886f, 0.530661643f},
-std::array<float,2>{0.629456222f, 0.823154211f},
-std::array<float,2>{0.167708188f, 0.436694503f},
-std::array<float,2>{0.564208031f, 0.27306664f},
-std::array<float,2>{0.0977769271f, 0.960088909f},
-std::array<float,2>{0.948395908f, 0.678993464f},
-std::array<float,2>{0.477511942f, 0.190754086f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.872035146f, 0.179868683f},
-std::array<float,2>{0.423333526f, 0.980091631f},
-std::array<float,2>{0.0826413035f, 0.457158715f},
-std::array<float,2>{0.560816824f, 0.720751941f},
-std::array<float,2>{0.688210547f, 0.373264611f},
-std::array<float,2>{0.189590305f, 0.51225239f},
-std::array<float,2>{0.265833378f, 0.0493121929f},
-std::array<float,2>{0.93990767f, 0.812634587f},
-std::array<float,2>{0.890145719f, 0.419216424f},
-std::array<float,2>{0.328831881f, 0.682503164f},
-std::array<float,2>{0.16511561f, 0.210904673f},
-std::array<float,2>{0.670240283f, 0.928476632f},
-std::array<float,2>{0.584313333f, 0.0921759158f},
-std::array<float,2>{0.0569544472f, 0.777962089f},
-std::array<float,2>{0.477599174f, 0.263951063f},
-std::array<float,2>{0.804573894f, 0.605865717f},
-std::array<float,2>{0.969248831f, 0.0274370443f},
-std::array<float,2>{0.299495488f, 0.851005614f},
-std::array<float,2>{0.237932742f, 0.327406555f},
-std::array<float,2>{0.744359255f, 0.545458794f},
-std::array<float,2>{0.50798589f, 0.499748379f},
-std::array<float,2>{0.118864834f, 0.699115396f},
-std::array<float,2>{0.403734118f, 0.149737462f},
-std::array<float,2>{0.817304194f, 0.9481861f},
-std::array<float,2>{0.759622872f, 0.291197062f},
-std::array<float,2>{0.462379813f, 0.581267595f},
-std::array<float,2>{0.0244224519f, 0.121623293f},
-std::array<float,2>{0.614886522f, 0.801878393f},
-std::array<float,2>{0.62943083f, 0.247806564f},
-std::array<float,2>{0.137721494f, 0.88218075f},
-std::array<float,2>{0.350903481f, 0.380066335f},
-std::array<float,2>{0.934753478f, 0.633150518f},
-std::array<float,2>{0.792789102f, 0.100241005f},
-std::array<float,2>{0.496527582f, 0.786560059f},
-std::array<float,2>{0.038573835f, 0.307546556f},
-std::array<float,2>{0.571738005f, 0.572505236f},
-std::array<float,2>{0.675364375f, 0.402739346f},
-std::array<float,2>{0.178840265f, 0.654874444f},
-std::array<float,2>{0.317698985f, 0.22711125f},
-std::array<float,2>{0.90597254f, 0.899296165f},
-std::array<float,2>{0.96186167f, 0.337343931f},
-std::array<float,2>{0.261148721f, 0.561749101f},
-std::array<float,2>{0.217890367f, 0.00470821094f},
-std::array<float,2>{0.708758593f, 0.866521478f},
-std::array<float,2>{0.533676088f, 0.132671773f},
-std::array<float,2>{0.0693367496f, 0.958195984f},
-std::array<float,2>{0.418856025f, 0.482099354f},
-std::array<float,2>{0.850430429f, 0.712757587f},
-std::array<float,2>{0.909683287f, 0.194248319f},
-std::array<float,2>{0.365127683f, 0.913824141f},
-std::array<float,2>{0.146675393f, 0.437077761f},
-std::array<float,2>{0.641850531f, 0.658540606f},
-std::array<float,2>{0.606399894f, 0.268642515f},
-std::array<float,2>{0.00918741804f, 0.620143712f},
-std::array<float,2>{0.43949607f, 0.0753921345f},
-std::array<float,2>{0.77192378f, 0.75237149f},
-std::array<float,2>{0.835416973f, 0.450601816f},
-std::array<float,2>{0.386203557f, 0.748528957f},
-std::array<float,2>{0.104543731f, 0.163482532f},
-std::array<float,2>{0.52825433f, 0.998960197f},
-std::array<float,2>{0.723837733f, 0.0388235264f},
-std::array<float,2>{0.231469318f, 0.83385241f},
-std::array<float,2>{0.291127712f, 0.349271208f},
-std::array<float,2>{0.985102892f, 0.52603507f},
-std::array<float,2>{0.773927093f, 0.221206293f},
-std::array<float,2>{0.447270989f, 0.892680049f},
-std::array<float,2>{0.00738318637f, 0.39429453f},
-std::array<float,2>{0.597902715f, 0.646924317f},
-std::array<float,2>{0.65434581f, 0.29762271f},
-std::array<float,2>{0.153890505f, 0.567821145f},
-std::array<float,2>{0.367717117f, 0.10332033f},
-std::array<float,2>{0.914748609f, 0.789432168f},
-std::array<float,2>{0.999294221f, 0.474673897f},
-std::array<float,2>{0.282112449f, 0.708480537f},
-std::array<float,2>{0.220059603f, 0.137074485f},
-std::array<float,2>{0.732586563f, 0.964320779f},
-std::array<float,2>{0.521721959f, 0.00996082462f},
-std::array<float,2>{0.0987106636f, 0.867648244f},
-std::array<float,2>{0.381935447f, 0.334394485f},
-std::array<float,2>{0.838878453f, 0.5480268f},
-std::array<float,2>{0.896328926f, 0.0692292377f},
-std::array<float,2>{0.32673353f, 0.757952929f},
-std::array<float,2>{0.187302187f, 0.27575165f},
-std::array<float,2>{0.681894481f, 0.61015141f},
-std::array<float,2>{0.567173421f, 0.425338745f},
-std::array<float,2>{0.039164979f, 0.670154274f},
-std::array<float,2>{0.487705857f, 0.197800979f},
-std::array<float,2>{0.786586761f, 0.918655157f},
-std::array<float,2>{0.854553998f, 0.35271132f},
-std::array<float,2>{0.407082349f, 0.522294581f},
-std::array<float,2>{0.0755682737f, 0.0463981591f},
-std::array<float,2>{0.540033937f, 0.841480315f},
-std::array<float,2>{0.712093353f, 0.171643198f},
-std::array<float,2>{0.206478521f, 0.987939715f},
-std::array<float,2>{0.254934251f, 0.444267958f},
-std::array<float,2>{0.954601109f, 0.741016567f},
-std::array<float,2>{0.821615696f, 0.0579076707f},
-std::array<float,2>{0.391608864f, 0.827722371f},
-std::array<float,2>{0.116150811f, 0.362023801f},
-std::array<float,2>{0.50168258f, 0.502631366f},
-std::array<float,2>{0.735115588f, 0.461421072f},
-std::array<float,2>{0.242727444f, 0.732536793f},
-std::array<float,2>{0.308256626f, 0.178346723f},
-std::array<float,2>{0.979479313f, 0.971355796f},
-std::array<float,2>{0.921935678f, 0.252199352f},
-std::array<float,2>{0.356472671f, 0.597321808f},
-std::array<float,2>{0.131907806f, 0.0828198344f},
-std::array<float,2>{0.637399375f, 0.765753269f},
-std::array<float,2>{0.618788302f, 0.213671938f},
-std::array<float,2>{0.0175183881f, 0.930586278f},
-std::array<float,2>{0.457515836f, 0.408129752f},
-std::array<float,2>{0.755708992f, 0.674205005f},
-std::array<float,2>{0.949580431f, 0.14459087f},
-std::array<float,2>{0.279646099f, 0.942611635f},
-std::array<float,2>{0.199768752f, 0.488417625f},
-std::array<float,2>{0.702956617f, 0.689628661f},
-std::array<float,2>{0.552493632f, 0.313839465f},
-std::array<float,2>{0.0869977549f, 0.536331713f},
-std::array<float,2>{0.433439493f, 0.0174773969f},
-std::array<float,2>{0.86092037f, 0.855918646f},
-std::array<float,2>{0.806388021f, 0.390558392f},
-std::array<float,2>{0.471255064f, 0.627543271f},
-std::array<float,2>{0.0531327575f, 0.24027808f},
-std::array<float,2>{0.585992992f, 0.89032644f},
-std::array<float,2>{0.663565218f, 0.115424529f},
-std::array<float,2>{0.15849404f, 0.805936515f},
-std::array<float,2>{0.338909298f, 0.282663852f},
-std::array<float,2>{0.877664268f, 0.593406439f},
-std::array<float,2>{0.79829663f, 0.136309892f},
-std::array<float,2>{0.483778685f, 0.965575039f},
-std::array<float,2>{0.0596778095f, 0.469780535f},
-std::array<float,2>{0.578576207f, 0.704169869f},
-std::array<float,2>{0.664696813f, 0.32834065f},
-std::array<float,2>{0.168679178f, 0.551634073f},
-std::array<float,2>{0.332853436f, 0.0122186374f},
-std::array<float,2>{0.882991552f, 0.874675214f},
-std::array<float,2>{0.943594575f, 0.39529869f},
-std::array<float,2>{0.270884007f, 0.641150057f},
-std::array<float,2>{0.19431825f, 0.22338821f},
-std::array<float,2>{0.694894493f, 0.895170331f},
-std::array<float,2>{0.555545986f, 0.108703531f},
-std::array<float,2>{0.0811187699f, 0.795180798f},
-std::array<float,2>{0.427013278f, 0.30221343f},
-std::array<float,2>{0.867561877f, 0.56345731f},
-std::array<float,2>{0.932913721f, 0.0403441377f},
-std::array<float,2>{0.343863636f, 0.839269757f},
-std::array<float,2>{0.135213956f, 0.356023341f},
-std::array<float,2>{0.627017617f, 0.518055916f},
-std::array<float,2>{0.611149967f, 0.438138932f},
-std::array<float,2>{0.0303160157f, 0.73744005f},
-std::array<float,2>{0.468485624f, 0.166282341f},
-std::array<float,2>{0.765074551f, 0.989864647f},
-std::array<float,2>{0.815035939f, 0.278316617f},
-std::array<float,2>{0.399669796f, 0.613696277f},
-std::array<float,2>{0.121693142f, 0.0627003461f},
-std::array<float,2>{0.513969302f, 0.763413548f},
-std::array<float,2>{0.747925222f, 0.199601173f},
-std::array<float,2>{0.238362849f, 0.915475368f},
-std::array<float,2>{0.303810269f, 0.426797777f},
-std::array<float,2>{0.975168526f, 0.665241897f},
-std::array<float,2>{0.846435308f, 0.0804173648f},
-std::array<float,2>{0.415595829f, 0.772226751f},
-std::array<float,2>{0.0636013895f, 0.254707694f},
-std::array<float,2>{0.538786411f, 0.599766433f},
-std::array<float,2>{0.703327239f, 0.41332972f},
-std::array<float,2>{0.212936416f, 0.679357648f},
-std::array<float,2>{0.263954639f, 0.217150316f},
-std::array<float,2>{0.968014121f, 0.936872661f},
-std::array<float,2>{0.899198234f, 0.365528882f},
-std::array<float,2>{0.314249784f, 0.506821573f},
-std::array<float,2>{0.174772486f, 0.0600289814f},
-std::array<float,2>{0.675874174f, 0.822576761f},
-std::array<float,2>{0.575054288f, 0.174465433f},
-std::array<float,2>{0.0345637389f, 0.976295948f},
-std::array<float,2>{0.495222598f, 0.467778474f},
-std::array<float,2>{0.796012282f, 0.728821456f},
-std::array<float,2>{0.990285933f, 0.235518515f},
-std::array<float,2>{0.293088615f, 0.886137307f},
-std::array<float,2>{0.229661733f, 0.383177578f},
-std::array<float,2>{0.719408035f, 0.631958365f},
-std::array<float,2>{0.524493933f, 0.285925835f},
-std::array<float,2>{0.10631822f, 0.588912308f},
-std::array<float,2>{0.390396804f, 0.112566896f},
-std::array<float,2>{0.831723332f, 0.81033963f},
-std::array<float,2>{0.766604841f, 0.485908985f},
-std::array<float,2>{0.443454087f, 0.69396019f},
-std::array<float,2>{0.0147911785f, 0.141560167f},
-std::array<float,2>{0.601813614f, 0.940167248f},
-std::array<float,2>{0.647673011f, 0.0224853009f},
-std::array<float,2>{0.143077359f, 0.854774415f},
-std::array<float,2>{0.361931562f, 0.320248038f},
-std::array<float,2>{0.91268003f, 0.532239914f},
-std::array<float,2>{0.839871943f, 0.206918091f},
-std::array<float,2>{0.378547221f, 0.924773097f},
-std::array<float,2>{0.0967357308f, 0.414930761f},
-std::array<float,2>{0.51687634f, 0.685767114f},
-std::array<float,2>{0.730464339f, 0.258972794f},
-std::array<float,2>{0.225726217f, 0.603173494f},
-std::array<float,2>{0.286649853f, 0.0897057354f},
-std::array<float,2>{0.994765162f, 0.773938298f},
-std::array<float,2>{0.918974936f, 0.45564878f},
-std::array<float,2>{0.372598946f, 0.724040687f},
-std::array<float,2>{0.148484141f, 0.185089305f},
-std::array<float,2>{0.651649475f, 0.984348238f},
-std::array<float,2>{0.596148193f, 0.0520586595f},
-std::array<float,2>{0.0014682347f, 0.81655252f},
-std::array<float,2>{0.451477736f, 0.368870676f},
-std::array<float,2>{0.779496789f, 0.508034527f},
-std::array<float,2>{0.958316088f, 0.120146118f},
-std::array<float,2>{0.25002715f, 0.797550201f},
-std::array<float,2>{0.209737971f, 0.296325028f},
-std::array<float,2>{0.716461718f, 0.585274041f},
-std::array<float,2>{0.54542762f, 0.376862228f},
-std::array<float,2>{0.0726607367f, 0.639627576f},
-std::array<float,2>{0.410780758f, 0.243628696f},
-std::array<float,2>{0.857838154f, 0.87505883f},
-std::array<float,2>{0.784775019f, 0.321116894f},
-std::array<float,2>{0.48995021f, 0.542106271f},
-std::array<float,2>{0.0450434946f, 0.0262096934f},
-std::array<float,2>{0.565692186f, 0.845981121f},
-std::array<float,2>{0.685606778f, 0.15269953f},
-std::array<float,2>{0.181818828f, 0.953059077f},
-std::array<float,2>{0.322816044f, 0.495680511f},
-std::array<float,2>{0.893215835f, 0.700493634f},
-std::array<float,2>{0.753441572f, 0.00183349149f},
-std::array<float,2>{0.456719041f, 0.863001764f},
-std::array<float,2>{0.0204741545f, 0.341102839f},
-std::array<float,2>{0.622147858f, 0.55736661f},
-std::array<float,2>{0.636455297f, 0.478480041f},
-std::array<float,2>{0.126658469f, 0.718221784f},
-std::array<float,2>{0.354560673f, 0.12777628f},
-std::array<float,2>{0.92887938f, 0.956320107f},
-std::array<float,2>{0.982888699f, 0.312097281f},
-std::array<float,2>{0.30866918f, 0.576384485f},
-std::array<float,2>{0.246833101f, 0.0939030796f},
-std::array<float,2>{0.740935504f, 0.781514943f},
-std::array<float,2>{0.504992962f, 0.232364953f},
-std::array<float,2>{0.111821257f, 0.905197263f},
-std::array<float,2>{0.395367235f, 0.39981696f},
-std::array<float,2>{0.824863672f, 0.651211023f},
-std::array<float,2>{0.880916238f, 0.157775164f},
-std::array<float,2>{0.340305418f, 0.993611455f},
-std::array<float,2>{0.162863478f, 0.446785808f},
-std::array<float,2>{0.658858061f, 0.743008614f},
-std::array<float,2>{0.590742409f, 0.346986473f},
-std::array<float,2>{0.0477118045f, 0.530250371f},
-std::array<float,2>{0.475617766f, 0.0346672907f},
-std::array<float,2>{0.81203568f, 0.829331458f},
-std::array<float,2>{0.864647925f, 0.432293952f},
-std::array<float,2>{0.436331123f, 0.660346448f},
-std::array<float,2>{0.0914535522f, 0.190574154f},
-std::array<float,2>{0.550052106f, 0.906331003f},
-std::array<float,2>{0.696105182f, 0.0720109567f},
-std::array<float,2>{0.197634459f, 0.755459189f},
-std::array<float,2>{0.276455224f, 0.27328667f},
-std::array<float,2>{0.946828842f, 0.621278346f},
-std::array<float,2>{0.819491506f, 0.151172355f},
-std::array<float,2>{0.405387849f, 0.946415484f},
-std::array<float,2>{0.120607547f, 0.496980608f},
-std::array<float,2>{0.510365784f, 0.695509195f},
-std::array<float,2>{0.743525088f, 0.326107383f},
-std::array<float,2>{0.23577255f, 0.543406248f},
-std::array<float,2>{0.2972579f, 0.0293088499f},
-std::array<float,2>{0.972169816f, 0.848579109f},
-std::array<float,2>{0.935854316f, 0.382704169f},
-std::array<float,2>{0.348510772f, 0.634943366f},
-std::array<float,2>{0.140174046f, 0.249700636f},
-std::array<float,2>{0.631774306f, 0.88045913f},
-std::array<float,2>{0.616942763f, 0.124971777f},
-std::array<float,2>{0.0262904204f, 0.804270327f},
-std::array<float,2>{0.463870734f, 0.290135533f},
-std::array<float,2>{0.760549784f, 0.578956842f},
-std::array<float,2>{0.939111352f, 0.0483196266f},
-std::array<float,2>{0.268662512f, 0.816144705f},
-std::array<float,2>{0.189206868f, 0.37267974f},
-std::array<float,2>{0.691273034f, 0.515155852f},
-std::array<float,2>{0.559895873f, 0.459647268f},
-std::array<float,2>{0.0849997178f, 0.720021427f},
-std::array<float,2>{0.424496591f, 0.183151901f},
-std::array<float,2>{0.873145938f, 0.977585793f},
-std::array<float,2>{0.800850034f, 0.262948245f},
-std::array<float,2>{0.47935006f, 0.608095944f},
-std::array<float,2>{0.0547557995f, 0.0903977826f},
-std::array<float,2>{0.582519889f, 0.779872537f},
-std::array<float,2>{0.669633508f, 0.207813635f},
-std::array<float,2>{0.166737676f, 0.927018464f},
-std::array<float,2>{0.331164479f, 0.421488017f},
-std::array<float,2>{0.887487352f, 0.680511057f},
-std::array<float,2>{0.769920707f, 0.0766611025f},
-std::array<float,2>{0.437832117f, 0.751239538f},
-std::array<float,2>{0.0115040513f, 0.265696138f},
-std::array<float,2>{0.607983887f, 0.61821717f},
-std::array<float,2>{0.643715858f, 0.434791595f},
-std::array<float,2>{0.145619735f, 0.657646716f},
-std::array<float,2>{0.366229057f, 0.191789865f},
-std::array<float,2>{0.907824099f, 0.911151707f},
-std::array<float,2>{0.987366796f, 0.349996686f},
-std::array<float,2>{0.289083928f, 0.523554027f},
-std::array<float,2>{0.233727977f, 0.0363490283f},
-std::array<float,2>{0.725511789f, 0.834326386f},
-std::array<float,2>{0.530577004f, 0.160639867f},
-std::array<float,2>{0.10223154f, 0.997004747f},
-std::array<float,2>{0.382820815f, 0.452531934f},
-std::array<float,2>{0.832428873f, 0.747538388f},
-std::array<float,2>{0.903906107f, 0.228964195f},
-std::array<float,2>{0.319970578f, 0.900549114f},
-std::array<float,2>{0.176231518f, 0.405847222f},
-std::array<float,2>{0.671953738f, 0.653763235f},
-std::array<float,2>{0.572677016f, 0.305759668f},
-std::array<float,2>{0.037040066f, 0.571320117f},
-std::array<float,2>{0.499706209f, 0.0979763418f},
-std::array<float,2>{0.790029287f, 0.787312269f},
-std::array<float,2>{0.84825784f, 0.483343244f},
-std::array<float,2>{0.420284003f, 0.714048088f},
-std::array<float,2>{0.0682944879f, 0.129815027f},
-std::array<float,2>{0.532564163f, 0.960125566f},
-std::array<float,2>{0.709713638f, 0.00659505604f},
-std::array<float,2>{0.215006322f, 0.863548279f},
-std::array<float,2>{0.259514034f, 0.338759601f},
-std::array<float,2>{0.96322161f, 0.560060918f},
-std::array<float,2>{0.788631976f, 0.195504695f},
-std::array<float,2>{0.485463738f, 0.920646966f},
-std::array<float,2>{0.0424863771f, 0.422978669f},
-std::array<float,2>{0.56930697f, 0.668932796f},
-std::array<float,2>{0.680736244f, 0.274619043f},
-std::array<float,2>{0.184681103f, 0.611359835f},
-std::array<float,2>{0.324536949f, 0.0670113936f},
-std::array<float,2>{0.897410095f, 0.760881066f},
-std::array<float,2>{0.956984758f, 0.44250989f},
-std::array<float,2>{0.256627768f, 0.739206195f},
-std::array<float,2>{0.20481801f, 0.169571176f},
-std::array<float,2>{0.713699877f, 0.985791266f},
-std::array<float,2>{0.541253388f, 0.0430235974f},
-std::array<float,2>{0.0773569196f, 0.843283832f},
-std::array<float,2>{0.409692287f, 0.354854822f},
-std::array<float,2>{0.851830482f, 0.521125257f},
-std::array<float,2>{0.917247474f, 0.104174934f},
-std::array<float,2>{0.370940357f, 0.792341828f},
-std::array<float,2>{0.155513436f, 0.300586134f},
-std::array<float,2>{0.654079556f, 0.568549514f},
-std::array<float,2>{0.601481974f, 0.390765667f},
-std::array<float,2>{0.0050978777f, 0.645381927f},
-std::array<float,2>{0.446535647f, 0.219903052f},
-std::array<float,2>{0.776564777f, 0.891661406f},
-std::array<float,2>{0.83702147f, 0.333011001f},
-std::array<float,2>{0.379225761f, 0.550195217f},
-std::array<float,2>{0.101066224f, 0.00858456735f},
-std::array<float,2>{0.520256162f, 0.870874643f},
-std::array<float,2>{0.731320798f, 0.138689056f},
-std::array<float,2>{0.222039625f, 0.961262167f},
-std::array<float,2>{0.283968836f, 0.472885907f},
-std::array<float,2>{0.996190846f, 0.710858226f},
-std::array<float,2>{0.862380326f, 0.018639762f},
-std::array<float,2>{0.431289732f, 0.859012246f},
-std::array<float,2>{0.0893172398f, 0.315587312f},
-std::array<float,2>{0.553460896f, 0.53894335f},
-std::array<float,2>{0.699768722f, 0.49138236f},
-std::array<float,2>{0.203055099f, 0.688277125f},
-std::array<float,2>{0.278765321f, 0.146753579f},
-std::array<float,2>{0.951739371f, 0.944225729f},
-std::array<float,2>{0.876161277f, 0.284057319f},
-std::array<float,2>{0.336720616f, 0.591221988f},
-std::array<float,2>{0.157103136f, 0.114640683f},
-std::array<float,2>{0.660449028f, 0.806816041f},
-std::array<float,2>{0.588752925f, 0.239176959f},
-std::array<float,2>{0.0518344641f, 0.887750089f},
-std::array<float,2>{0.469893843f, 0.388621718f},
-std::array<float,2>{0.807077408f, 0.62511456f},
-std::array<float,2>{0.978275657f, 0.176900551f},
-std::array<float,2>{0.305744439f, 0.970652282f},
-std::array<float,2>{0.244222805f, 0.464608729f},
-std::array<float,2>{0.736500144f, 0.731281817f},
-std::array<float,2>{0.503523409f, 0.360233217f},
-std::array<float,2>{0.113626048f, 0.500485778f},
-std::array<float,2>{0.394332469f, 0.056136582f},
-std::array<float,2>{0.823841512f, 0.824315369f},
-std::array<float,2>{0.756421089f, 0.408269256f},
-std::array<float,2>{0.460496545f, 0.672054231f},
-std::array<float,2>{0.0180388354f, 0.211110339f},
-std::array<float,2>{0.620058537f, 0.932482839f},
-std::array<float,2>{0.6399827f, 0.0857340544f},
-std::array<float,2>{0.129906446f, 0.767767549f},
-std::array<float,2>{0.35915193f, 0.251342326f},
-std::array<float,2>{0.924330473f, 0.595581055f},
-std::array<float,2>{0.762272477f, 0.165101707f},
-std::array<float,2>{0.466200858f, 0.992070675f},
-std::array<float,2>{0.0291457288f, 0.440180302f},
-std::array<float,2>{0.613009453f, 0.736197889f},
-std::array<float,2>{0.625674844f, 0.358672053f},
-std::array<float,2>{0.132977903f, 0.517489493f},
-std::array<float,2>{0.34592253f, 0.0423444957f},
-std::array<float,2>{0.930920124f, 0.836941957f},
-std::array<float,2>{0.973254561f, 0.42779851f},
-std::array<float,2>{0.301803052f, 0.667777181f},
-std::array<float,2>{0.240543231f, 0.201857686f},
-std::array<float,2>{0.74987787f, 0.91759938f},
-std::array<float,2>{0.511872232f, 0.065978013f},
-std::array<float,2>{0.124746054f, 0.764291346f},
-std::array<float,2>{0.401016384f, 0.281158149f},
-std::array<float,2>{0.812768579f, 0.616841853f},
-std::array<float,2>{0.886576533f, 0.0153511856f},
-std::array<float,2>{0.334081799f, 0.871828437f},
-std::array<float,2>{0.170534104f, 0.330350161f},
-std::array<float,2>{0.666912079f, 0.553230703f},
-std::array<float,2>{0.582015455f, 0.472176522f},
-std::array<float,2>{0.0619242415f, 0.70690906f},
-std::array<float,2>{0.482203394f, 0.133488223f},
-std::array<float,2>{0.799330115f, 0.96860373f},
-std::array<float,2>{0.869933963f, 0.303819209f},
-std::array<float,2>{0.429568857f, 0.565501213f},
-std::array<float,2>{0.0796612948f, 0.106126167f},
-std::array<float,2>{0.557196915f, 0.794663966f},
-std::array<float,2>{0.692231119f, 0.225262269f},
-std::array<float,2>{0.191513628f, 0.897519648f},
-std::array<float,2>{0.272166789f, 0.396729022f},
-std::array<float,2>{0.941745102f, 0.643758297f},
-std::array<float,2>{0.829543948f, 0.110811532f},
-std::array<float,2>{0.387164891f, 0.811671734f},
-std::array<float,2>{0.108842082f, 0.288184434f},
-std::array<float,2>{0.527332246f, 0.58668071f},
-std::array<float,2>{0.721689045f, 0.386361599f},
-std::array<float,2>{0.228024557f, 0.630538225f},
-std::array<float,2>{0.296757519f, 0.23741883f},
-std::array<float,2>{0.989455521f, 0.884685695f},
-std::array<float,2>{0.910257041f, 0.316959977f},
-std::array<float,2>{0.359407723f, 0.533891678f},
-std::array<float,2>{0.141582355f, 0.0196677782f},
-std::array<float,2>{0.645999908f, 0.852182865f},
-std::array<float,2>{0.60359925f, 0.142654553f},
-std::array<float,2>{0.0117506785f, 0.939167261f},
-std::array<float,2>{0.442642868f, 0.486539274f},
-std::array<float,2>{0.767962217f, 0.692541659f},
-std::array<float,2>{0.965899467f, 0.21625784f},
-std::array<float,2>{0.262587488f, 0.934999585f},
-std::array<float,2>{0.211740136f, 0.411924988f},
-std::array<float,2>{0.705857396f, 0.675844967f},
-std::array<float,2>{0.535767436f, 0.25673762f},
-std::array<float,2>{0.0648929328f, 0.598983586f},
-std::array<float,2>{0.416182637f, 0.0783414096f},
-std::array<float,2>{0.844539106f, 0.770999849f},
-std::array<float,2>{0.79392767f, 0.46521315f},
-std::array<float,2>{0.492220193f, 0.728409886f},
-std::array<float,2>{0.0320945159f, 0.172575712f},
-std::array<float,2>{0.576524496f, 0.973608613f},
-std::array<float,2>{0.67951107f, 0.0621389374f},
-std::array<float,2>{0.17254138f, 0.820686758f},
-std::array<float,2>{0.314598411f, 0.364708751f},
-std::array<float,2>{0.900717437f, 0.504015803f},
-std::array<float,2>{0.857035637f, 0.244767562f},
-std::array<float,2>{0.413508296f, 0.877079785f},
-std::array<float,2>{0.0704038963f, 0.377328843f},
-std::array<float,2>{0.544011116f, 0.637779355f},
-std::array<float,2>{0.718572736f, 0.294516206f},
-std::array<float,2>{0.207103968f, 0.582742095f},
-std::array<float,2>{0.253409535f, 0.119011372f},
-std::array<float,2>{0.959500492f, 0.799126804f},
-std::array<float,2>{0.892248809f, 0.493469179f},
-std::array<float,2>{0.321557671f, 0.701653779f},
-std::array<float,2>{0.181037351f, 0.155617982f},
-std::array<float,2>{0.684427381f, 0.950481057f},
-std::array<float,2>{0.562899172f, 0.0244567227f},
-std::array<float,2>{0.0448537506f, 0.843856871f},
-std::array<float,2>{0.490364194f, 0.322485179f},
-std::array<float,2>{0.782193363f, 0.539463222f},
-std::array<float,2>{0.993668437f, 0.0876623988f},
-std::array<float,2>{0.287569135f, 0.776899338f},
-std::array<float,2>{0.224422485f, 0.260221571f},
-std::array<float,2>{0.728047252f, 0.604239821f},
-std::array<float,2>{0.519358814f, 0.417758197f},
-std::array<float,2>{0.0956021845f, 0.684536159f},
-std::array<float,2>{0.376837403f, 0.203451723f},
-std::array<float,2>{0.842136145f, 0.923076153f},
-std::array<float,2>{0.778056085f, 0.371044517f},
-std::array<float,2>{0.450560033f, 0.51004535f},
-std::array<float,2>{0.00267178705f, 0.0543641783f},
-std::array<float,2>{0.594872713f, 0.819081306f},
-std::array<float,2>{0.649376333f, 0.18727605f},
-std::array<float,2>{0.150787249f, 0.981588125f},
-std::array<float,2>{0.373725146f, 0.455063313f},
-std::array<float,2>{0.921163619f, 0.725865841f},
-std::array<float,2>{0.809440136f, 0.0330153629f},
-std::array<float,2>{0.474226087f, 0.831967652f},
-std::array<float,2>{0.0488975681f, 0.345682979f},
-std::array<float,2>{0.592275321f, 0.528419077f},
-std::array<float,2>{0.65713495f, 0.448006213f},
-std::array<float,2>{0.161211118f, 0.744818985f},
-std::array<float,2>{0.343187124f, 0.159514487f},
-std::array<float,2>{0.879640102f, 0.996089041f},
-std::array<float,2>{0.948544502f, 0.269883811f},
-std::array<float,2>{0.27467069f, 0.624410152f},
-std::array<float,2>{0.196990415f, 0.0736803859f},
-std::array<float,2>{0.698237956f, 0.756684899f},
-std::array<float,2>{0.547426164f, 0.187555149f},
-std::array<float,2>{0.0919594318f, 0.908680499f},
-std::array<float,2>{0.433899373f, 0.4309223f},
-std::array<float,2>{0.866295159f, 0.662965119f},
-std::array<float,2>{0.926806867f, 0.126859963f},
-std::array<float,2>{0.351951957f, 0.953850508f},
-std::array<float,2>{0.127680734f, 0.479171842f},
-std::array<float,2>{0.63435024f, 0.715470493f},
-std::array<float,2>{0.624986887f, 0.343138844f},
-std::array<float,2>{0.0227467511f, 0.555037856f},
-std::array<float,2>{0.454170913f, 0.00325421616f},
-std::array<float,2>{0.750522256f, 0.859845877f},
-std::array<float,2>{0.8275913f, 0.401835382f},
-std::array<float,2>{0.398099154f, 0.649898291f},
-std::array<float,2>{0.109395146f, 0.232883558f},
-std::array<float,2>{0.507086337f, 0.903771281f},
-std::array<float,2>{0.739578068f, 0.0957707316f},
-std::array<float,2>{0.248307049f, 0.784672439f},
-std::array<float,2>{0.3108778f, 0.309534967f},
-std::array<float,2>{0.981867075f, 0.574703038f},
-std::array<float,2>{0.851006687f, 0.130116284f},
-std::array<float,2>{0.419359982f, 0.959065318f},
-std::array<float,2>{0.0690659434f, 0.483772278f},
-std::array<float,2>{0.534265876f, 0.713285387f},
-std::array<float,2>{0.707287788f, 0.339166135f},
-std::array<float,2>{0.217683807f, 0.558938801f},
-std::array<float,2>{0.260486066f, 0.00712264143f},
-std::array<float,2>{0.962051868f, 0.864483654f},
-std::array<float,2>{0.90479064f, 0.404683411f},
-std::array<float,2>{0.316939026f, 0.652835667f},
-std::array<float,2>{0.178557605f, 0.230419621f},
-std::array<float,2>{0.674419403f, 0.90216887f},
-std::array<float,2>{0.571195424f, 0.0990816057f},
-std::array<float,2>{0.037473999f, 0.788657963f},
-std::array<float,2>{0.497893691f, 0.305057526f},
-std::array<float,2>{0.791752756f, 0.570507824f},
-std::array<float,2>{0.985871494f, 0.0359236374f},
-std::array<float,2>{0.291999787f, 0.834962308f},
-std::array<float,2>{0.231193438f, 0.351185083f},
-std::array<float,2>{0.722867846f, 0.524813652f},
-std::array<float,2>{0.52838558f, 0.451731414f},
-std::array<float,2>{0.103992373f, 0.746641457f},
-std::array<float,2>{0.385241538f, 0.161560595f},
-std::array<float,2>{0.834151745f, 0.998030961f},
-std::array<float,2>{0.772634625f, 0.267184198f},
-std::array<float,2>{0.441371858f, 0.618133545f},
-std::array<float,2>{0.00863732677f, 0.0774705485f},
-std::array<float,2>{0.60703063f, 0.750792325f},
-std::array<float,2>{0.641508281f, 0.192929372f},
-std::array<float,2>{0.14780286f, 0.910272658f},
-std::array<float,2>{0.363921374f, 0.434366703f},
-std::array<float,2>{0.908257008f, 0.656481385f},
-std::array<float,2>{0.80304867f, 0.0910067707f},
-std::array<float,2>{0.477286369f, 0.780380487f},
-std::array<float,2>{0.057783179f, 0.262338161f},
-std::array<float,2>{0.585808218f, 0.608415306f},
-std::array<float,2>{0.671371579f, 0.420844495f},
-std::array<float,2>{0.16410102f, 0.681160331f},
-std::array<float,2>{0.329115629f, 0.208311796f},
-std::array<float,2>{0.888732851f, 0.925792992f},
-std::array<float,2>{0.941147685f, 0.371436179f},
-std::array<float,2>{0.266890109f, 0.513818979f},
-std::array<float,2>{0.190430954f, 0.0472042672f},
-std::array<float,2>{0.688697398f, 0.815124035f},
-std::array<float,2>{0.561734915f, 0.182558879f},
-std::array<float,2>{0.0833336562f, 0.977178335f},
-std::array<float,2>{0.422056675f, 0.460121393f},
-std::array<float,2>{0.872879684f, 0.71931088f},
-std::array<float,2>{0.934152126f, 0.248534635f},
-std::array<float,2>{0.350460619f, 0.878977776f},
-std::array<float,2>{0.136750624f, 0.3813923f},
-std::array<float,2>{0.630449653f, 0.636594653f},
-std::array<float,2>{0.613583386f, 0.289827108f},
-std::array<float,2>{0.024001807f, 0.58007288f},
-std::array<float,2>{0.460997254f, 0.123887062f},
-std::array<float,2>{0.758682311f, 0.802948296f},
-std::array<float,2>{0.817773342f, 0.497972578f},
-std::array<float,2>{0.403146535f, 0.69645983f},
-std::array<float,2>{0.117825165f, 0.151751831f},
-std::array<float,2>{0.509746492f, 0.946048737f},
-std::array<float,2>{0.745365679f, 0.0308197737f},
-std::array<float,2>{0.236906603f, 0.849016845f},
-std::array<float,2>{0.300413579f, 0.324540228f},
-std::array<float,2>{0.970134735f, 0.544685125f},
-std::array<float,2>{0.754418075f, 0.212729558f},
-std::array<float,2>{0.458947271f, 0.932679653f},
-std::array<float,2>{0.0165366624f, 0.409376621f},
-std::array<float,2>{0.617695928f, 0.673186839f},
-std::array<float,2>{0.638329268f, 0.250467569f},
-std::array<float,2>{0.13173911f, 0.594379544f},
-std::array<float,2>{0.356297016f, 0.0849380344f},
-std::array<float,2>{0.923245966f, 0.769053578f},
-std::array<float,2>{0.980393827f, 0.463024974f},
-std::array<float,2>{0.307552755f, 0.732162654f},
-std::array<float,2>{0.243402302f, 0.176561505f},
-std::array<float,2>{0.736088514f, 0.968935788f},
-std::array<float,2>{0.500392139f, 0.0548672155f},
-std::array<float,2>{0.116436429f, 0.826140463f},
-std::array<float,2>{0.391287833f, 0.361040741f},
-std::array<float,2>{0.820441604f, 0.501153111f},
-std::array<float,2>{0.878087163f, 0.113907963f},
-std::array<float,2>{0.338219464f, 0.807681441f},
-std::array<float,2>{0.160103351f, 0.284252435f},
-std::array<float,2>{0.662767053f, 0.590106487f},
-std::array<float,2>{0.587581277f, 0.387522846f},
-std::array<float,2>{0.0542867221f, 0.626554072f},
-std::array<float,2>{0.472022682f, 0.239472687f},
-std::array<float,2>{0.805427551f, 0.887118101f},
-std::array<float,2>{0.85946089f, 0.315134078f},
-std::array<float,2>{0.432414174f, 0.537756145f},
-std::array<float,2>{0.0866404548f, 0.0178106762f},
-std::array<float,2>{0.551298141f, 0.858294547f},
-std::array<float,2>{0.702100575f, 0.14835608f},
-std::array<float,2>{0.200645402f, 0.944751978f},
-std::array<float,2>{0.280826479f, 0.491145253f},
-std::array<float,2>{0.95116502f, 0.688692272f},
-std::array<float,2>{0.838624716f, 0.00883398205f},
-std::array<float,2>{0.381185323f, 0.869579971f},
-std::array<float,2>{0.0983552188f, 0.332706094f},
-std::array<float,2>{0.522773564f, 0.54973805f},
-std::array<float,2>{0.733882725f, 0.47415787f},
-std::array<float,2>{0.218874708f, 0.709691226f},
-std::array<float,2>{0.282337427f, 0.140367731f},
-std::array<float,2>{0.998619795f, 0.962419868f},
-std::array<float,2>{0.915718853f, 0.299210489f},
-std::array<float,2>{0.368231177f, 0.57025516f},
-std::array<float,2>{0.152845502f, 0.105243497f},
-std::array<float,2>{0.655496836f, 0.791052401f},
-std::array<float,2>{0.598677754f, 0.219296232f},
-std::array<float,2>{0.00603268668f, 0.891572654f},
-std::array<float,2>{0.448915392f, 0.392383456f},
-std::array<float,2>{0.774820268f, 0.645525098f},
-std::array<float,2>{0.953184307f, 0.168596268f},
-std::array<float,2>{0.254809737f, 0.984795749f},
-std::array<float,2>{0.205196247f, 0.441854894f},
-std::array<float,2>{0.711834431f, 0.739778459f},
-std::array<float,2>{0.540102184f, 0.353839785f},
-std::array<float,2>{0.0744075328f, 0.52023989f},
-std::array<float,2>{0.407444686f, 0.0440913439f},
-std::array<float,2>{0.8544662f, 0.842579663f},
-std::array<float,2>{0.785753429f, 0.421882242f},
-std::array<float,2>{0.487215489f, 0.669367254f},
-std::array<float,2>{0.0403905213f, 0.196891874f},
-std::array<float,2>{0.567951858f, 0.92090565f},
-std::array<float,2>{0.682641387f, 0.0678957105f},
-std::array<float,2>{0.186283037f, 0.759885132f},
-std::array<float,2>{0.32808423f, 0.273857445f},
-std::array<float,2>{0.89528966f, 0.612919748f},
-std::array<float,2>{0.79569453f, 0.173208803f},
-std::array<float,2>{0.494467527f, 0.973938048f},
-std::array<float,2>{0.0340477899f, 0.466298103f},
-std::array<float,2>{0.575321734f, 0.727202952f},
-std::array<float,2>{0.677547276f, 0.363682747f},
-std::array<float,2>{0.175440565f, 0.504909694f},
-std::array<float,2>{0.313292086f, 0.0614544377f},
-std::array<float,2>{0.899903476f, 0.82197845f},
-std::array<float,2>{0.967337251f, 0.410794795f},
-std::array<float,2>{0.265501827f, 0.676859438f},
-std::array<float,2>{0.213977665f, 0.214981452f},
-std::array<float,2>{0.704646587f, 0.933729291f},
-std::array<float,2>{0.53767705f, 0.0791854039f},
-std::array<float,2>{0.0634370968f, 0.770286798f},
-std::array<float,2>{0.414074153f, 0.257720739f},
-std::array<float,2>{0.847144246f, 0.598552108f},
-std::array<float,2>{0.913734078f, 0.0209780615f},
-std::array<float,2>{0.362863302f, 0.853332102f},
-std::array<float,2>{0.144430622f, 0.317449987f},
-std::array<float,2>{0.647019506f, 0.534893572f},
-std::array<float,2>{0.6031636f, 0.487782151f},
-std::array<float,2>{0.0145449564f, 0.692291498f},
-std::array<float,2>{0.444667339f, 0.143782943f},
-std::array<float,2>{0.765804946f, 0.938289285f},
-std::array<float,2>{0.830914557f, 0.287871242f},
-std::array<float,2>{0.389049649f, 0.587610781f},
-std::array<float,2>{0.106891729f, 0.109661557f},
-std::array<float,2>{0.523956478f, 0.811420441f},
-std::array<float,2>{0.719938099f, 0.237013221f},
-std::array<float,2>{0.22922276f, 0.88317436f},
-std::array<float,2>{0.294364035f, 0.385716796f},
-std::array<float,2>{0.991514385f, 0.62913841f},
-std::array<float,2>{0.868847907f, 0.107047372f},
-std::array<float,2>{0.42668885f, 0.79392457f},
-std::array<float,2>{0.0805950537f, 0.303341031f},
-std::array<float,2>{0.556545675f, 0.564994574f},
-std::array<float,2>{0.693426907f, 0.397964388f},
-std::array<float,2>{0.195112884f, 0.643064082f},
-std::array<float,2>{0.269669384f, 0.225796595f},
-std::array<float,2>{0.944509745f, 0.896826386f},
-std::array<float,2>{0.884307146f, 0.33109802f},
-std::array<float,2>{0.333775252f, 0.553811669f},
-std::array<float,2>{0.169533566f, 0.014321574f},
-std::array<float,2>{0.665692389f, 0.872629464f},
-std::array<float,2>{0.57992214f, 0.134057969f},
-std::array<float,2>{0.0591086634f, 0.967241943f},
-std::array<float,2>{0.482600451f, 0.471599519f},
-std::array<float,2>{0.797493398f, 0.705373406f},
-std::array<float,2>{0.975662291f, 0.202556014f},
-std::array<float,2>{0.303458452f, 0.916728616f},
-std::array<float,2>{0.23975721f, 0.429534912f},
-std::array<float,2>{0.746532083f, 0.666103065f},
-std::array<float,2>{0.515489578f, 0.279817551f},
-std::array<float,2>{0.122757241f, 0.615769506f},
-std::array<float,2>{0.398606896f, 0.0650380254f},
-std::array<float,2>{0.81637615f, 0.765583634f},
-std::array<float,2>{0.763776362f, 0.440816373f},
-std::array<float,2>{0.467474222f, 0.734713256f},
-std::array<float,2>{0.0295755286f, 0.164515078f},
-std::array<float,2>{0.609862864f, 0.990843594f},
-std::array<float,2>{0.628902853f, 0.0412676372f},
-std::array<float,2>{0.136463642f, 0.836112738f},
-std::array<float,2>{0.345250398f, 0.358121514f},
-std::array<float,2>{0.932154655f, 0.516288936f},
-std::array<float,2>{0.825668454f, 0.234188259f},
-std::array<float,2>{0.396052212f, 0.903083563f},
-std::array<float,2>{0.113060571f, 0.400829196f},
-std::array<float,2>{0.504484415f, 0.648990214f},
-std::array<float,2>{0.742062211f, 0.309901088f},
-std::array<float,2>{0.247776762f, 0.57550329f},
-std::array<float,2>{0.309690088f, 0.0972749516f},
-std::array<float,2>{0.984014392f, 0.784019411f},
-std::array<float,2>{0.928553462f, 0.480437517f},
-std::array<float,2>{0.354467094f, 0.716272652f},
-std::array<float,2>{0.125337586f, 0.12591733f},
-std::array<float,2>{0.635611832f, 0.954654455f},
-std::array<float,2>{0.621906638f, 0.00217235484f},
-std::array<float,2>{0.021049967f, 0.860779405f},
-std::array<float,2>{0.455236226f, 0.342548639f},
-std::array<float,2>{0.752903521f, 0.556324124f},
-std::array<float,2>{0.946147025f, 0.0728241131f},
-std::array<float,2>{0.275564402f, 0.75721705f},
-std::array<float,2>{0.198986545f, 0.271222979f},
-std::array<float,2>{0.697126746f, 0.623391986f},
-std::array<float,2>{0.549783587f, 0.430266768f},
-std::array<float,2>{0.0903562978f, 0.663581729f},
-std::array<float,2>{0.437314004f, 0.189335987f},
-std::array<float,2>{0.863293231f, 0.909560382f},
-std::array<float,2>{0.811394334f, 0.344047338f},
-std::array<float,2>{0.475149095f, 0.528153419f},
-std::array<float,2>{0.0482899584f, 0.0317648649f},
-std::array<float,2>{0.591722667f, 0.830101848f},
-std::array<float,2>{0.65940237f, 0.158717707f},
-std::array<float,2>{0.163467765f, 0.995098591f},
-std::array<float,2>{0.34173733f, 0.448286891f},
-std::array<float,2>{0.88244015f, 0.745168865f},
-std::array<float,2>{0.780422747f, 0.0532155037f},
-std::array<float,2>{0.453014463f, 0.81998533f},
-std::array<float,2>{0.00041844431f, 0.370002627f},
-std::array<float,2>{0.596775651f, 0.510754883f},
-std::array<float,2>{0.651300609f, 0.454039395f},
-std::array<float,2>{0.149833366f, 0.7251423f},
-std::array<float,2>{0.371963561f, 0.186300844f},
-std::array<float,2>{0.917977512f, 0.980471671f},
-std::array<float,2>{0.995639384f, 0.261604756f},
-std::array<float,2>{0.285715908f, 0.604982913f},
-std::array<float,2>{0.225513235f, 0.0861739963f},
-std::array<float,2>{0.728767455f, 0.775850952f},
-std::array<float,2>{0.516540468f, 0.204521656f},
-std::array<float,2>{0.096400097f, 0.921884894f},
-std::array<float,2>{0.377414316f, 0.416796684f},
-std::array<float,2>{0.841785729f, 0.685207486f},
-std::array<float,2>{0.893612623f, 0.154970571f},
-std::array<float,2>{0.323685467f, 0.94946897f},
-std::array<float,2>{0.183364704f, 0.492446721f},
-std::array<float,2>{0.687385738f, 0.702624023f},
-std::array<float,2>{0.564499676f, 0.323272228f},
-std::array<float,2>{0.0460445769f, 0.540771186f},
-std::array<float,2>{0.488582224f, 0.0237768926f},
-std::array<float,2>{0.783937454f, 0.845492005f},
-std::array<float,2>{0.859283149f, 0.378831059f},
-std::array<float,2>{0.411254168f, 0.637375772f},
-std::array<float,2>{0.0738723874f, 0.246062532f},
-std::array<float,2>{0.546036661f, 0.87800163f},
-std::array<float,2>{0.715687037f, 0.117374204f},
-std::array<float,2>{0.210496321f, 0.800420761f},
-std::array<float,2>{0.251414418f, 0.293452114f},
-std::array<float,2>{0.95783633f, 0.583658934f},
-std::array<float,2>{0.833225727f, 0.162185043f},
-std::array<float,2>{0.384640664f, 0.999475062f},
-std::array<float,2>{0.102766335f, 0.449899673f},
-std::array<float,2>{0.529707372f, 0.749551833f},
-std::array<float,2>{0.726293683f, 0.348349899f},
-std::array<float,2>{0.232721865f, 0.526536226f},
-std::array<float,2>{0.290935457f, 0.0375197604f},
-std::array<float,2>{0.987062752f, 0.832961023f},
-std::array<float,2>{0.906252384f, 0.435922325f},
-std::array<float,2>{0.365263492f, 0.659722626f},
-std::array<float,2>{0.145387039f, 0.195295632f},
-std::array<float,2>{0.643438518f, 0.912977993f},
-std::array<float,2>{0.608674467f, 0.0751753971f},
-std::array<float,2>{0.0097876424f, 0.753255606f},
-std::array<float,2>{0.43902424f, 0.267961442f},
-std::array<float,2>{0.7706424f, 0.619888365f},
-std::array<float,2>{0.964453042f, 0.00520778541f},
-std::array<float,2>{0.258142292f, 0.866162479f},
-std::array<float,2>{0.216414794f, 0.336637408f},
-std::array<float,2>{0.710110664f, 0.561133504f},
-std::array<float,2>{0.532129169f, 0.480602354f},
-std::array<float,2>{0.0665242523f, 0.711493194f},
-std::array<float,2>{0.420913488f, 0.131761178f},
-std::array<float,2>{0.848683298f, 0.957213402f},
-std::array<float,2>{0.790262163f, 0.307787418f},
-std::array<float,2>{0.498958081f, 0.57388103f},
-std::array<float,2>{0.0352233499f, 0.100613259f},
-std::array<float,2>{0.573865652f, 0.785730958f},
-std::array<float,2>{0.673526049f, 0.22770825f},
-std::array<float,2>{0.177616581f, 0.899490595f},
-std::array<float,2>{0.318597883f, 0.403602868f},
-std::array<float,2>{0.903119624f, 0.6554721f},
-std::array<float,2>{0.761361599f, 0.122970447f},
-std::array<float,2>{0.463787556f, 0.800925255f},
-std::array<float,2>{0.0269137677f, 0.292412162f},
-std::array<float,2>{0.61559093f, 0.580994368f},
-std::array<float,2>{0.632029712f, 0.379618704f},
-std::array<float,2>{0.139102653f, 0.634593487f},
-std::array<float,2>{0.34922412f, 0.246277556f},
-std::array<float,2>{0.937404633f, 0.880906641f},
-std::array<float,2>{0.971146047f, 0.326482445f},
-std::array<float,2>{0.298564702f, 0.546639442f},
-std::array<float,2>{0.235079393f, 0.0284598395f},
-std::array<float,2>{0.742584288f, 0.850056469f},
-std::array<float,2>{0.51150012f, 0.149029776f},
-std::array<float,2>{0.119719297f, 0.94915241f},
-std::array<float,2>{0.405146718f, 0.499008089f},
-std::array<float,2>{0.819068968f, 0.697267532f},
-std::array<float,2>{0.888142228f, 0.209323078f},
-std::array<float,2>{0.33042118f, 0.928861737f},
-std::array<float,2>{0.167156607f, 0.418801129f},
-std::array<float,2>{0.668889642f, 0.683120668f},
-std::array<float,2>{0.58306855f, 0.264749408f},
-std::array<float,2>{0.0562656596f, 0.606756687f},
-std::array<float,2>{0.479746491f, 0.0935085565f},
-std::array<float,2>{0.80253911f, 0.779098332f},
-std::array<float,2>{0.87454778f, 0.458063543f},
-std::array<float,2>{0.424825996f, 0.722165227f},
-std::array<float,2>{0.0842979029f, 0.181078106f},
-std::array<float,2>{0.558814406f, 0.979002893f},
-std::array<float,2>{0.689672589f, 0.0505266935f},
-std::array<float,2>{0.188317493f, 0.814328372f},
-std::array<float,2>{0.267846882f, 0.374363214f},
-std::array<float,2>{0.93830812f, 0.513670444f},
-std::array<float,2>{0.807798266f, 0.241425976f},
-std::array<float,2>{0.469425529f, 0.888799012f},
-std::array<float,2>{0.0514312871f, 0.388860494f},
-std::array<float,2>{0.589075029f, 0.628369212f},
-std::array<float,2>{0.661893487f, 0.282095283f},
-std::array<float,2>{0.157776311f, 0.592635691f},
-std::array<float,2>{0.337526679f, 0.116850071f},
-std::array<float,2>{0.875166178f, 0.805339575f},
-std::array<float,2>{0.952727377f, 0.489559829f},
-std::array<float,2>{0.278178155f, 0.690528274f},
-std::array<float,2>{0.201350883f, 0.146182984f},
-std::array<float,2>{0.700546384f, 0.942301869f},
-std::array<float,2>{0.553868115f, 0.0162429977f},
-std::array<float,2>{0.0887114704f, 0.857059419f},
-std::array<float,2>{0.430492759f, 0.313049167f},
-std::array<float,2>{0.861554146f, 0.535752892f},
-std::array<float,2>{0.924957335f, 0.083753936f},
-std::array<float,2>{0.357563585f, 0.766921639f},
-std::array<float,2>{0.129477933f, 0.253577501f},
-std::array<float,2>{0.63906908f, 0.596018016f},
-std::array<float,2>{0.621046722f, 0.407181591f},
-std::array<float,2>{0.0194979459f, 0.6755023f},
-std::array<float,2>{0.459523648f, 0.214081317f},
-std::array<float,2>{0.757442653f, 0.930763602f},
-std::array<float,2>{0.822459996f, 0.36248526f},
-std::array<float,2>{0.392959177f, 0.502980232f},
-std::array<float,2>{0.114827476f, 0.0567116998f},
-std::array<float,2>{0.502377987f, 0.826869607f},
-std::array<float,2>{0.737787068f, 0.179350004f},
-std::array<float,2>{0.245978445f, 0.972223997f},
-std::array<float,2>{0.305388123f, 0.462087393f},
-std::array<float,2>{0.977151275f, 0.733519673f},
-std::array<float,2>{0.853377342f, 0.0458943658f},
-std::array<float,2>{0.40869531f, 0.840643346f},
-std::array<float,2>{0.0766010731f, 0.351979673f},
-std::array<float,2>{0.54268539f, 0.522628963f},
-std::array<float,2>{0.714120269f, 0.444707692f},
-std::array<float,2>{0.203411281f, 0.741390467f},
-std::array<float,2>{0.257418931f, 0.170454323f},
-std::array<float,2>{0.955736876f, 0.987057328f},
-std::array<float,2>{0.897549093f, 0.27654624f},
-std::array<float,2>{0.32576865f, 0.61051178f},
-std::array<float,2>{0.184406281f, 0.0694254786f},
-std::array<float,2>{0.680594921f, 0.758803427f},
-std::array<float,2>{0.570299447f, 0.198925257f},
-std::array<float,2>{0.0418853648f, 0.919637442f},
-std::array<float,2>{0.484850556f, 0.424153268f},
-std::array<float,2>{0.787665904f, 0.671443343f},
-std::array<float,2>{0.997352123f, 0.138231426f},
-std::array<float,2>{0.284645528f, 0.963388622f},
-std::array<float,2>{0.221241578f, 0.476451725f},
-std::array<float,2>{0.732089281f, 0.707171798f},
-std::array<float,2>{0.521272719f, 0.335217535f},
-std::array<float,2>{0.0999133959f, 0.547600269f},
-std::array<float,2>{0.380539268f, 0.011178894f},
-std::array<float,2>{0.836435616f, 0.869002581f},
-std::array<float,2>{0.775445044f, 0.39310351f},
-std::array<float,2>{0.445385814f, 0.64800179f},
-std::array<float,2>{0.00442309212f, 0.222005114f},
-std::array<float,2>{0.600092769f, 0.893565834f},
-std::array<float,2>{0.653198421f, 0.102231547f},
-std::array<float,2>{0.154457256f, 0.790896773f},
-std::array<float,2>{0.369184077f, 0.298230529f},
-std::array<float,2>{0.916683197f, 0.567196548f},
-std::array<float,2>{0.7690956f, 0.142502919f},
-std::array<float,2>{0.442297071f, 0.941272557f},
-std::array<float,2>{0.0129006924f, 0.485200852f},
-std::array<float,2>{0.605097651f, 0.694796264f},
-std::array<float,2>{0.645169795f, 0.319239438f},
-std::array<float,2>{0.142215699f, 0.531921029f},
-std::array<float,2>{0.360609055f, 0.0224561449f},
-std::array<float,2>{0.911289275f, 0.853895068f},
-std::array<float,2>{0.988501191f, 0.384342313f},
-std::array<float,2>{0.295346737f, 0.631432414f},
-std::array<float,2>{0.227285504f, 0.234742388f},
-std::array<float,2>{0.721589744f, 0.885351896f},
-std::array<float,2>{0.525618792f, 0.111358784f},
-std::array<float,2>{0.108248122f, 0.809164584f},
-std::array<float,2>{0.387759268f, 0.286426812f},
-std::array<float,2>{0.828599215f, 0.588750482f},
-std::array<float,2>{0.901960731f, 0.0586212836f},
-std::array<float,2>{0.315535873f, 0.823461235f},
-std::array<float,2>{0.173677787f, 0.366400212f},
-std::array<float,2>{0.678678215f, 0.507797837f},
-std::array<float,2>{0.577429414f, 0.467507899f},
-std::array<float,2>{0.0326239094f, 0.73006016f},
-std::array<float,2>{0.494114399f, 0.175606847f},
-std::array<float,2>{0.794224739f, 0.974734664f},
-std::array<float,2>{0.845042884f, 0.255194128f},
-std::array<float,2>{0.417157769f, 0.600993514f},
-std::array<float,2>{0.0661521778f, 0.0815096945f},
-std::array<float,2>{0.536729097f, 0.773341298f},
-std::array<float,2>{0.706662595f, 0.218040958f},
-std::array<float,2>{0.212801158f, 0.935972035f},
-std::array<float,2>{0.263087183f, 0.412568271f},
-std::array<float,2>{0.96579206f, 0.678330362f},
-std::array<float,2>{0.813743293f, 0.0637869984f},
-std::array<float,2>{0.402338386f, 0.762331843f},
-std::array<float,2>{0.123897023f, 0.279253334f},
-std::array<float,2>{0.512800097f, 0.614792764f},
-std::array<float,2>{0.748548687f, 0.426647931f},
-std::array<float,2>{0.241350517f, 0.664430201f},
-std::array<float,2>{0.301128596f, 0.20059818f},
-std::array<float,2>{0.973659515f, 0.914604068f},
-std::array<float,2>{0.929775059f, 0.357143342f},
-std::array<float,2>{0.347168535f, 0.519227684f},
-std::array<float,2>{0.134617314f, 0.0397310443f},
-std::array<float,2>{0.626787484f, 0.838562965f},
-std::array<float,2>{0.611523807f, 0.167819336f},
-std::array<float,2>{0.0280044097f, 0.98909229f},
-std::array<float,2>{0.464901328f, 0.439254135f},
-std::array<float,2>{0.763432682f, 0.736931801f},
-std::array<float,2>{0.94240427f, 0.224294797f},
-std::array<float,2>{0.273204178f, 0.895805657f},
-std::array<float,2>{0.193086579f, 0.396420836f},
-std::array<float,2>{0.692923069f, 0.642532587f},
-std::array<float,2>{0.55806756f, 0.301718593f},
-std::array<float,2>{0.0783392638f, 0.563534558f},
-std::array<float,2>{0.428344995f, 0.107581809f},
-std::array<float,2>{0.870872378f, 0.796072841f},
-std::array<float,2>{0.800683916f, 0.469205648f},
-std::array<float,2>{0.480541289f, 0.703428268f},
-std::array<float,2>{0.0614914969f, 0.135376438f},
-std::array<float,2>{0.580906034f, 0.966283917f},
-std::array<float,2>{0.667459667f, 0.0135932183f},
-std::array<float,2>{0.171155065f, 0.873920858f},
-std::array<float,2>{0.335138857f, 0.329294801f},
-std::array<float,2>{0.885090768f, 0.552698672f},
-std::array<float,2>{0.865568936f, 0.190046415f},
-std::array<float,2>{0.435165167f, 0.90812242f},
-std::array<float,2>{0.0929116234f, 0.433444083f},
-std::array<float,2>{0.548069f, 0.661717534f},
-std::array<float,2>{0.698967993f, 0.271488756f},
-std::array<float,2>{0.19560203f, 0.622816086f},
-std::array<float,2>{0.273970932f, 0.0704822987f},
-std::array<float,2>{0.947787404f, 0.754299998f},
-std::array<float,2>{0.880320132f, 0.445370317f},
-std::array<float,2>{0.342751712f, 0.744120836f},
-std::array<float,2>{0.160193115f, 0.157042727f},
-std::array<float,2>{0.657830715f, 0.992578983f},
-std::array<float,2>{0.592829704f, 0.033928223f},
-std::array<float,2>{0.0498081781f, 0.828238308f},
-std::array<float,2>{0.47295773f, 0.346254259f},
-std::array<float,2>{0.80980587f, 0.530564666f},
-std::array<float,2>{0.981351554f, 0.0949095488f},
-std::array<float,2>{0.312232286f, 0.783184528f},
-std::array<float,2>{0.249432132f, 0.310775042f},
-std::array<float,2>{0.738465369f, 0.577629745f},
-std::array<float,2>{0.506357133f, 0.398590028f},
-std::array<float,2>{0.110964775f, 0.651594758f},
-std::array<float,2>{0.396606624f, 0.23080197f},
-std::array<float,2>{0.826345146f, 0.90620929f},
-std::array<float,2>{0.751869082f, 0.34006989f},
-std::array<float,2>{0.454099268f, 0.55848527f},
-std::array<float,2>{0.02222603f, 0.000970526307f},
-std::array<float,2>{0.623685122f, 0.861944675f},
-std::array<float,2>{0.633148372f, 0.128393471f},
-std::array<float,2>{0.12879914f, 0.955484688f},
-std::array<float,2>{0.353455991f, 0.477178067f},
-std::array<float,2>{0.926253796f, 0.717754245f},
-std::array<float,2>{0.782461107f, 0.0264955703f},
-std::array<float,2>{0.49125874f, 0.847314239f},
-std::array<float,2>{0.0437464975f, 0.321800649f},
-std::array<float,2>{0.563828886f, 0.541040957f},
-std::array<float,2>{0.684571028f, 0.495071292f},
-std::array<float,2>{0.180107594f, 0.700008869f},
-std::array<float,2>{0.32058385f, 0.154217452f},
-std::array<float,2>{0.890855014f, 0.951292515f},
-std::array<float,2>{0.960796773f, 0.295627505f},
-std::array<float,2>{0.252731621f, 0.584432662f},
-std::array<float,2>{0.208561063f, 0.120072238f},
-std::array<float,2>{0.717141151f, 0.798761308f},
-std::array<float,2>{0.543907225f, 0.242825508f},
-std::array<float,2>{0.0716573969f, 0.876266956f},
-std::array<float,2>{0.412633687f, 0.375766248f},
-std::array<float,2>{0.855855942f, 0.639701307f},
-std::array<float,2>{0.920378864f, 0.18386209f},
-std::array<float,2>{0.374670565f, 0.983328342f},
-std::array<float,2>{0.152188823f, 0.45639661f},
-std::array<float,2>{0.650345981f, 0.72331959f},
-std::array<float,2>{0.594207227f, 0.36733821f},
-std::array<float,2>{0.00322947185f, 0.509466887f},
-std::array<float,2>{0.449843496f, 0.0510757156f},
-std::array<float,2>{0.779034972f, 0.817882657f},
-std::array<float,2>{0.84356004f, 0.415709049f},
-std::array<float,2>{0.375015378f, 0.687292874f},
-std::array<float,2>{0.0945869312f, 0.20543839f},
-std::array<float,2>{0.518211544f, 0.925193369f},
-std::array<float,2>{0.726716757f, 0.088778235f},
-std::array<float,2>{0.222904697f, 0.77442807f},
-std::array<float,2>{0.288242996f, 0.258395463f},
-std::array<float,2>{0.992909491f, 0.601686597f},
-std::array<float,2>{0.853725135f, 0.170212299f},
-std::array<float,2>{0.407945305f, 0.986464858f},
-std::array<float,2>{0.0747210011f, 0.44503659f},
-std::array<float,2>{0.54064846f, 0.741778314f},
-std::array<float,2>{0.711226642f, 0.352245659f},
-std::array<float,2>{0.205821022f, 0.523155808f},
-std::array<float,2>{0.253919095f, 0.0452602468f},
-std::array<float,2>{0.953685641f, 0.840055048f},
-std::array<float,2>{0.894705176f, 0.424746782f},
-std::array<float,2>{0.32725358f, 0.671167672f},
-std::array<float,2>{0.185897246f, 0.198404878f},
-std::array<float,2>{0.683188498f, 0.919313908f},
-std::array<float,2>{0.56746006f, 0.070044741f},
-std::array<float,2>{0.0407778136f, 0.759605885f},
-std::array<float,2>{0.486703604f, 0.277288795f},
-std::array<float,2>{0.785633743f, 0.610986292f},
-std::array<float,2>{0.998351216f, 0.011447018f},
-std::array<float,2>{0.282847464f, 0.868253231f},
-std::array<float,2>{0.219583735f, 0.335556537f},
-std::array<float,2>{0.733997345f, 0.546924055f},
-std::array<float,2>{0.523275316f, 0.475639015f},
-std::array<float,2>{0.0981414691f, 0.707977951f},
-std::array<float,2>{0.381497175f, 0.138063088f},
-std::array<float,2>{0.837898254f, 0.963154078f},
-std::array<float,2>{0.775185287f, 0.298824221f},
-std::array<float,2>{0.448673159f, 0.566702425f},
-std::array<float,2>{0.00650973385f, 0.101795889f},
-std::array<float,2>{0.599360108f, 0.790140271f},
-std::array<float,2>{0.655843377f, 0.222438723f},
-std::array<float,2>{0.152396068f, 0.894255817f},
-std::array<float,2>{0.369020402f, 0.392681539f},
-std::array<float,2>{0.91538167f, 0.647563994f},
-std::array<float,2>{0.8049559f, 0.116252027f},
-std::array<float,2>{0.472358108f, 0.804927647f},
-std::array<float,2>{0.0537358709f, 0.281596065f},
-std::array<float,2>{0.587362945f, 0.592051208f},
-std::array<float,2>{0.662247241f, 0.389643341f},
-std::array<float,2>{0.159381062f, 0.62869966f},
-std::array<float,2>{0.338852435f, 0.24210532f},
-std::array<float,2>{0.878692925f, 0.889176905f},
-std::array<float,2>{0.950385511f, 0.312571317f},
-std::array<float,2>{0.280311257f, 0.535457075f},
-std::array<float,2>{0.200771198f, 0.0159184821f},
-std::array<float,2>{0.701431274f, 0.85651046f},
-std::array<float,2>{0.551182449f, 0.145676956f},
-std::array<float,2>{0.0861016139f, 0.941725373f},
-std::array<float,2>{0.432103813f, 0.489754915f},
-std::array<float,2>{0.8602162f, 0.690998435f},
-std::array<float,2>{0.923760772f, 0.214566246f},
-std::array<float,2>{0.355751216f, 0.931241214f},
-std::array<float,2>{0.131145775f, 0.406621605f},
-std::array<float,2>{0.63785249f, 0.674922764f},
-std::array<float,2>{0.617582619f, 0.253226548f},
-std::array<float,2>{0.0159234144f, 0.596377313f},
-std::array<float,2>{0.458245903f, 0.0832260475f},
-std::array<float,2>{0.754202008f, 0.767372489f},
-std::array<float,2>{0.820894182f, 0.462648958f},
-std::array<float,2>{0.390683591f, 0.733978927f},
-std::array<float,2>{0.11708492f, 0.179107279f},
-std::array<float,2>{0.500518084f, 0.971794009f},
-std::array<float,2>{0.735690951f, 0.0572876483f},
-std::array<float,2>{0.243749291f, 0.826351404f},
-std::array<float,2>{0.307050347f, 0.363249689f},
-std::array<float,2>{0.979597569f, 0.5036515f},
-std::array<float,2>{0.757875085f, 0.246799856f},
-std::array<float,2>{0.46157679f, 0.881471574f},
-std::array<float,2>{0.0235123876f, 0.379208028f},
-std::array<float,2>{0.614103496f, 0.634128273f},
-std::array<float,2>{0.630297959f, 0.292516023f},
-std::array<float,2>{0.137679592f, 0.580334783f},
-std::array<float,2>{0.349734664f, 0.122298099f},
-std::array<float,2>{0.933772922f, 0.801545084f},
-std::array<float,2>{0.970579207f, 0.498352945f},
-std::array<float,2>{0.300158828f, 0.698237896f},
-std::array<float,2>{0.236397803f, 0.148817018f},
-std::array<float,2>{0.745757639f, 0.948333085f},
-std::array<float,2>{0.509206235f, 0.029014837f},
-std::array<float,2>{0.117287762f, 0.850531459f},
-std::array<float,2>{0.402488083f, 0.327057719f},
-std::array<float,2>{0.817922354f, 0.546124697f},
-std::array<float,2>{0.889189124f, 0.0932054445f},
-std::array<float,2>{0.329936653f, 0.778732479f},
-std::array<float,2>{0.164845377f, 0.265263826f},
-std::array<float,2>{0.671719193f, 0.60703367f},
-std::array<float,2>{0.585144997f, 0.418015867f},
-std::array<float,2>{0.0585369207f, 0.682984948f},
-std::array<float,2>{0.477022946f, 0.209661633f},
-std::array<float,2>{0.803590298f, 0.929278791f},
-std::array<float,2>{0.872474134f, 0.374740839f},
-std::array<float,2>{0.422452629f, 0.513179362f},
-std::array<float,2>{0.0837239102f, 0.0500970334f},
-std::array<float,2>{0.562160432f, 0.813777566f},
-std::array<float,2>{0.689300597f, 0.181623682f},
-std::array<float,2>{0.191186115f, 0.979116082f},
-std::array<float,2>{0.267358929f, 0.458805412f},
-std::array<float,2>{0.940674424f, 0.722247541f},
-std::array<float,2>{0.834918082f, 0.0379249416f},
-std::array<float,2>{0.385458052f, 0.83212918f},
-std::array<float,2>{0.10446234f, 0.348013401f},
-std::array<float,2>{0.529050589f, 0.527124166f},
-std::array<float,2>{0.723623991f, 0.449593365f},
-std::array<float,2>{0.230913579f, 0.749031782f},
-std::array<float,2>{0.292574048f, 0.16265741f},
-std::array<float,2>{0.985386491f, 0.999762714f},
-std::array<float,2>{0.908759534f, 0.268184274f},
-std::array<float,2>{0.363286912f, 0.619388342f},
-std::array<float,2>{0.148033068f, 0.0746085867f},
-std::array<float,2>{0.641111076f, 0.753549576f},
-std::array<float,2>{0.606755197f, 0.194518849f},
-std::array<float,2>{0.00785421208f, 0.912119925f},
-std::array<float,2>{0.440436065f, 0.436378747f},
-std::array<float,2>{0.773218513f, 0.65924865f},
-std::array<float,2>{0.962698638f, 0.13101013f},
-std::array<float,2>{0.259992421f, 0.957734585f},
-std::array<float,2>{0.21726124f, 0.481335193f},
-std::array<float,2>{0.707973838f, 0.711066127f},
-std::array<float,2>{0.534938276f, 0.336151391f},
-std::array<float,2>{0.0687419623f, 0.560988069f},
-std::array<float,2>{0.41959396f, 0.0057138172f},
-std::array<float,2>{0.851214409f, 0.865292788f},
-std::array<float,2>{0.791389048f, 0.40405798f},
-std::array<float,2>{0.497237116f, 0.656202257f},
-std::array<float,2>{0.0376586914f, 0.228152826f},
-std::array<float,2>{0.570452929f, 0.899960279f},
-std::array<float,2>{0.674236238f, 0.101372704f},
-std::array<float,2>{0.177832723f, 0.785545826f},
-std::array<float,2>{0.316470802f, 0.308573574f},
-std::array<float,2>{0.904621601f, 0.57363075f},
-std::array<float,2>{0.783255577f, 0.153621554f},
-std::array<float,2>{0.48900646f, 0.95202893f},
-std::array<float,2>{0.0465375036f, 0.494422227f},
-std::array<float,2>{0.56509161f, 0.699533224f},
-std::array<float,2>{0.686885476f, 0.321378082f},
-std::array<float,2>{0.182711214f, 0.541664124f},
-std::array<float,2>{0.324041724f, 0.0269945636f},
-std::array<float,2>{0.894279897f, 0.846762776f},
-std::array<float,2>{0.957322896f, 0.37503311f},
-std::array<float,2>{0.251571298f, 0.640543401f},
-std::array<float,2>{0.21013689f, 0.242603779f},
-std::array<float,2>{0.714943409f, 0.876923978f},
-std::array<float,2>{0.546565294f, 0.11935658f},
-std::array<float,2>{0.0733896345f, 0.798264325f},
-std::array<float,2>{0.412065178f, 0.294927865f},
-std::array<float,2>{0.858707905f, 0.584620237f},
-std::array<float,2>{0.91879487f, 0.0513909236f},
-std::array<float,2>{0.371159762f, 0.817547262f},
-std::array<float,2>{0.149953917f, 0.367973357f},
-std::array<float,2>{0.650723815f, 0.508836091f},
-std::array<float,2>{0.597478688f, 0.456673801f},
-std::array<float,2>{0.0005867203f, 0.722882211f},
-std::array<float,2>{0.452154547f, 0.184190929f},
-std::array<float,2>{0.781113565f, 0.982646942f},
-std::array<float,2>{0.841115773f, 0.257864505f},
-std::array<float,2>{0.377607316f, 0.602298915f},
-std::array<float,2>{0.0959835351f, 0.0879330188f},
-std::array<float,2>{0.515756547f, 0.775355816f},
-std::array<float,2>{0.729011536f, 0.205850646f},
-std::array<float,2>{0.224692211f, 0.925460517f},
-std::array<float,2>{0.285426706f, 0.415322006f},
-std::array<float,2>{0.995272815f, 0.686869979f},
-std::array<float,2>{0.864232421f, 0.0710845217f},
-std::array<float,2>{0.436630189f, 0.75459379f},
-std::array<float,2>{0.0900998414f, 0.272460252f},
-std::array<float,2>{0.549265981f, 0.62212795f},
-std::array<float,2>{0.696548045f, 0.43304792f},
-std::array<float,2>{0.198398232f, 0.661498845f},
-std::array<float,2>{0.275915921f, 0.189726919f},
-std::array<float,2>{0.945785046f, 0.907645106f},
-std::array<float,2>{0.882154167f, 0.345767409f},
-std::array<float,2>{0.341148615f, 0.531220198f},
-std::array<float,2>{0.16388616f, 0.0332895592f},
-std::array<float,2>{0.659724116f, 0.828846872f},
-std::array<float,2>{0.591018975f, 0.156669438f},
-std::array<float,2>{0.0483499095f, 0.993149579f},
-std::array<float,2>{0.474687487f, 0.445838034f},
-std::array<float,2>{0.810777962f, 0.743555248f},
-std::array<float,2>{0.983844101f, 0.231044441f},
-std::array<float,2>{0.310469687f, 0.905573606f},
-std::array<float,2>{0.247114584f, 0.399142563f},
-std::array<float,2>{0.741345346f, 0.651947737f},
-std::array<float,2>{0.504309952f, 0.311071306f},
-std::array<float,2>{0.112629771f, 0.577964008f},
-std::array<float,2>{0.39562422f, 0.0952217877f},
-std::array<float,2>{0.825941324f, 0.782336235f},
-std::array<float,2>{0.752438486f, 0.476858795f},
-std::array<float,2>{0.455637187f, 0.717122257f},
-std::array<float,2>{0.0208147205f, 0.128814474f},
-std::array<float,2>{0.621234179f, 0.955895305f},
-std::array<float,2>{0.634860933f, 0.000457678078f},
-std::array<float,2>{0.12554346f, 0.861393392f},
-std::array<float,2>{0.353671432f, 0.340757579f},
-std::array<float,2>{0.928162575f, 0.557891726f},
-std::array<float,2>{0.815567195f, 0.200858712f},
-std::array<float,2>{0.399141073f, 0.91433531f},
-std::array<float,2>{0.122252278f, 0.425977826f},
-std::array<float,2>{0.514789939f, 0.664928377f},
-std::array<float,2>{0.746887386f, 0.278387994f},
-std::array<float,2>{0.239463076f, 0.614639938f},
-std::array<float,2>{0.302834153f, 0.0639789179f},
-std::array<float,2>{0.976200521f, 0.762178123f},
-std::array<float,2>{0.931680799f, 0.438847959f},
-std::array<float,2>{0.344862521f, 0.736731887f},
-std::array<float,2>{0.136195257f, 0.167253479f},
-std::array<float,2>{0.628106356f, 0.988765836f},
-std::array<float,2>{0.610244513f, 0.0391449034f},
-std::array<float,2>{0.030266542f, 0.83815974f},
-std::array<float,2>{0.467031896f, 0.356647402f},
-std::array<float,2>{0.764445484f, 0.518776536f},
-std::array<float,2>{0.945259333f, 0.108030923f},
-std::array<float,2>{0.270335048f, 0.796469271f},
-std::array<float,2>{0.194776416f, 0.301220417f},
-std::array<float,2>{0.693938553f, 0.564046621f},
-std::array<float,2>{0.555968881f, 0.395857871f},
-std::array<float,2>{0.0803754926f, 0.642030358f},
-std::array<float,2>{0.426154643f, 0.223660409f},
-std::array<float,2>{0.868305087f, 0.896384239f},
-std::array<float,2>{0.797165334f, 0.32992211f},
-std::array<float,2>{0.483067513f, 0.552220643f},
-std::array<float,2>{0.0589559451f, 0.012761849f},
-std::array<float,2>{0.579302192f, 0.873384833f},
-std::array<float,2>{0.665091336f, 0.134802461f},
-std::array<float,2>{0.169140205f, 0.966562331f},
-std::array<float,2>{0.333258361f, 0.46925053f},
-std::array<float,2>{0.884149969f, 0.703868985f},
-std::array<float,2>{0.766405284f, 0.0218325648f},
-std::array<float,2>{0.445130467f, 0.854460001f},
-std::array<float,2>{0.0138884308f, 0.31864953f},
-std::array<float,2>{0.602549553f, 0.531462431f},
-std::array<float,2>{0.646859586f, 0.4844262f},
-std::array<float,2>{0.143712953f, 0.694830477f},
-std::array<float,2>{0.362668455f, 0.141933888f},
-std::array<float,2>{0.913337231f, 0.94067502f},
-std::array<float,2>{0.991766632f, 0.286842346f},
-std::array<float,2>{0.294508338f, 0.587927401f},
-std::array<float,2>{0.228693157f, 0.111911282f},
-std::array<float,2>{0.720280409f, 0.808680952f},
-std::array<float,2>{0.523653448f, 0.235310018f},
-std::array<float,2>{0.107168339f, 0.884785295f},
-std::array<float,2>{0.389445603f, 0.384189963f},
-std::array<float,2>{0.830123127f, 0.630884171f},
-std::array<float,2>{0.899533272f, 0.174909577f},
-std::array<float,2>{0.312555909f, 0.9753263f},
-std::array<float,2>{0.17488952f, 0.467267543f},
-std::array<float,2>{0.676861882f, 0.729784429f},
-std::array<float,2>{0.576170802f, 0.366764694f},
-std::array<float,2>{0.03335144f, 0.507302523f},
-std::array<float,2>{0.494718403f, 0.0594293699f},
-std::array<float,2>{0.795326054f, 0.823734403f},
-std::array<float,2>{0.847539723f, 0.413038552f},
-std::array<float,2>{0.414833367f, 0.678184092f},
-std::array<float,2>{0.0629587024f, 0.218311399f},
-std::array<float,2>{0.537307024f, 0.936296284f},
-std::array<float,2>{0.704527617f, 0.0819702148f},
-std::array<float,2>{0.214609623f, 0.77277571f},
-std::array<float,2>{0.264695764f, 0.255589843f},
-std::array<float,2>{0.967015266f, 0.601148903f},
-std::array<float,2>{0.836174369f, 0.139884219f},
-std::array<float,2>{0.380138963f, 0.962088287f},
-std::array<float,2>{0.100286402f, 0.473686516f},
-std::array<float,2>{0.520798326f, 0.7090078f},
-std::array<float,2>{0.731585026f, 0.332136184f},
-std::array<float,2>{0.220876992f, 0.549227595f},
-std::array<float,2>{0.285066634f, 0.0096089663f},
-std::array<float,2>{0.997692823f, 0.869702995f},
-std::array<float,2>{0.916110992f, 0.391616106f},
-std::array<float,2>{0.369673967f, 0.6462515f},
-std::array<float,2>{0.154831231f, 0.219020769f},
-std::array<float,2>{0.65262711f, 0.89081043f},
-std::array<float,2>{0.600538135f, 0.104933865f},
-std::array<float,2>{0.00435393257f, 0.791599989f},
-std::array<float,2>{0.446040213f, 0.299546212f},
-std::array<float,2>{0.776057303f, 0.569498062f},
-std::array<float,2>{0.95520103f, 0.0449048355f},
-std::array<float,2>{0.257199347f, 0.84215802f},
-std::array<float,2>{0.203751326f, 0.354092628f},
-std::array<float,2>{0.714754462f, 0.519738495f},
-std::array<float,2>{0.542200327f, 0.442121565f},
-std::array<float,2>{0.0767809898f, 0.739691019f},
-std::array<float,2>{0.408596277f, 0.16806975f},
-std::array<float,2>{0.852978587f, 0.985004723f},
-std::array<float,2>{0.787433267f, 0.273971617f},
-std::array<float,2>{0.485109895f, 0.612432063f},
-std::array<float,2>{0.0412915722f, 0.0674405396f},
-std::array<float,2>{0.569364727f, 0.760509431f},
-std::array<float,2>{0.680137813f, 0.19654116f},
-std::array<float,2>{0.183952928f, 0.921483755f},
-std::array<float,2>{0.325223744f, 0.422833353f},
-std::array<float,2>{0.89835459f, 0.66980499f},
-std::array<float,2>{0.757301211f, 0.0841155797f},
-std::array<float,2>{0.459237695f, 0.768572986f},
-std::array<float,2>{0.0186060723f, 0.250740856f},
-std::array<float,2>{0.6204409f, 0.593805075f},
-std::array<float,2>{0.639243186f, 0.409881204f},
-std::array<float,2>{0.129016757f, 0.673348427f},
-std::array<float,2>{0.358296901f, 0.212305158f},
-std::array<float,2>{0.925465584f, 0.933464944f},
-std::array<float,2>{0.976982832f, 0.360741377f},
-std::array<float,2>{0.305027694f, 0.501714408f},
-std::array<float,2>{0.245168045f, 0.0554718263f},
-std::array<float,2>{0.737856627f, 0.825365841f},
-std::array<float,2>{0.502827406f, 0.176138908f},
-std::array<float,2>{0.114296727f, 0.969435692f},
-std::array<float,2>{0.393094361f, 0.463438749f},
-std::array<float,2>{0.823017001f, 0.731484532f},
-std::array<float,2>{0.875851452f, 0.240171403f},
-std::array<float,2>{0.337319702f, 0.887598991f},
-std::array<float,2>{0.157705262f, 0.386794925f},
-std::array<float,2>{0.661401868f, 0.626279652f},
-std::array<float,2>{0.589756906f, 0.285051644f},
-std::array<float,2>{0.0510395691f, 0.590660572f},
-std::array<float,2>{0.469047427f, 0.113311179f},
-std::array<float,2>{0.808556914f, 0.808380723f},
-std::array<float,2>{0.862063944f, 0.490319639f},
-std::array<float,2>{0.430038333f, 0.689097762f},
-std::array<float,2>{0.0879961848f, 0.14788276f},
-std::array<float,2>{0.55427438f, 0.945299625f},
-std::array<float,2>{0.700694799f, 0.0184133798f},
-std::array<float,2>{0.20176281f, 0.857579589f},
-std::array<float,2>{0.277435094f, 0.31452024f},
-std::array<float,2>{0.952303886f, 0.537235379f},
-std::array<float,2>{0.802040517f, 0.208611012f},
-std::array<float,2>{0.48006478f, 0.926499426f},
-std::array<float,2>{0.0560629591f, 0.420030683f},
-std::array<float,2>{0.583570004f, 0.680761755f},
-std::array<float,2>{0.668173552f, 0.26214847f},
-std::array<float,2>{0.167712629f, 0.609080434f},
-std::array<float,2>{0.33067748f, 0.0917921215f},
-std::array<float,2>{0.8884179f, 0.780802786f},
-std::array<float,2>{0.937857985f, 0.460878015f},
-std::array<float,2>{0.268305123f, 0.718795121f},
-std::array<float,2>{0.187520877f, 0.181682572f},
-std::array<float,2>{0.690239072f, 0.976984143f},
-std::array<float,2>{0.55908531f, 0.0475468822f},
-std::array<float,2>{0.0848418921f, 0.814715087f},
-std::array<float,2>{0.425618082f, 0.371726364f},
-std::array<float,2>{0.874110162f, 0.514395297f},
-std::array<float,2>{0.936639369f, 0.123262785f},
-std::array<float,2>{0.348641127f, 0.803329825f},
-std::array<float,2>{0.139311746f, 0.289250344f},
-std::array<float,2>{0.632698596f, 0.579196811f},
-std::array<float,2>{0.616192758f, 0.380866736f},
-std::array<float,2>{0.0264150724f, 0.635998428f},
-std::array<float,2>{0.463010728f, 0.249023184f},
-std::array<float,2>{0.760796964f, 0.879443586f},
-std::array<float,2>{0.818622887f, 0.324844956f},
-std::array<float,2>{0.404369295f, 0.544408858f},
-std::array<float,2>{0.11930237f, 0.03061595f},
-std::array<float,2>{0.510846734f, 0.849143386f},
-std::array<float,2>{0.742720544f, 0.151976615f},
-std::array<float,2>{0.234733582f, 0.945317805f},
-std::array<float,2>{0.298315227f, 0.497486055f},
-std::array<float,2>{0.971426129f, 0.697175264f},
-std::array<float,2>{0.849326491f, 0.00744408974f},
-std::array<float,2>{0.421627492f, 0.864880085f},
-std::array<float,2>{0.0669913813f, 0.339567006f},
-std::array<float,2>{0.531413913f, 0.559221864f},
-std::array<float,2>{0.710865438f, 0.484239608f},
-std::array<float,2>{0.215964749f, 0.713634968f},
-std::array<float,2>{0.258374214f, 0.130679294f},
-std::array<float,2>{0.963920534f, 0.959663153f},
-std::array<float,2>{0.902803481f, 0.30528602f},
-std::array<float,2>{0.319309056f, 0.571056008f},
-std::array<float,2>{0.176932797f, 0.0995448455f},
-std::array<float,2>{0.673111379f, 0.788449049f},
-std::array<float,2>{0.573531806f, 0.229577094f},
-std::array<float,2>{0.0359946229f, 0.901616216f},
-std::array<float,2>{0.498323202f, 0.405083716f},
-std::array<float,2>{0.790953636f, 0.652498662f},
-std::array<float,2>{0.986557066f, 0.161738649f},
-std::array<float,2>{0.290315032f, 0.997167349f},
-std::array<float,2>{0.233395606f, 0.451458097f},
-std::array<float,2>{0.725909829f, 0.746477902f},
-std::array<float,2>{0.530036807f, 0.35096398f},
-std::array<float,2>{0.103028663f, 0.525322855f},
-std::array<float,2>{0.384011835f, 0.0355985761f},
-std::array<float,2>{0.833522379f, 0.835734427f},
-std::array<float,2>{0.771113575f, 0.433615267f},
-std::array<float,2>{0.438723713f, 0.657009244f},
-std::array<float,2>{0.0104505252f, 0.192388445f},
-std::array<float,2>{0.608907282f, 0.910944164f},
-std::array<float,2>{0.642969847f, 0.0777157471f},
-std::array<float,2>{0.144600809f, 0.750385225f},
-std::array<float,2>{0.365975469f, 0.266722471f},
-std::array<float,2>{0.90674901f, 0.617644787f},
-std::array<float,2>{0.778768718f, 0.185568526f},
-std::array<float,2>{0.449517727f, 0.980999887f},
-std::array<float,2>{0.00346733793f, 0.453546852f},
-std::array<float,2>{0.594340384f, 0.724728584f},
-std::array<float,2>{0.649430871f, 0.36924541f},
-std::array<float,2>{0.15174593f, 0.511400342f},
-std::array<float,2>{0.374134392f, 0.0535252579f},
-std::array<float,2>{0.920600891f, 0.819805086f},
-std::array<float,2>{0.992212474f, 0.416500807f},
-std::array<float,2>{0.288840383f, 0.684930861f},
-std::array<float,2>{0.223346353f, 0.204924911f},
-std::array<float,2>{0.727256536f, 0.922564387f},
-std::array<float,2>{0.517730355f, 0.0864697248f},
-std::array<float,2>{0.0940707847f, 0.776366949f},
-std::array<float,2>{0.375642419f, 0.26100719f},
-std::array<float,2>{0.842878699f, 0.604896307f},
-std::array<float,2>{0.891424417f, 0.0240430161f},
-std::array<float,2>{0.321096778f, 0.844991446f},
-std::array<float,2>{0.180265427f, 0.32379052f},
-std::array<float,2>{0.685247838f, 0.540380478f},
-std::array<float,2>{0.564248383f, 0.49281621f},
-std::array<float,2>{0.0433855914f, 0.703118145f},
-std::array<float,2>{0.491951376f, 0.154467478f},
-std::array<float,2>{0.782988191f, 0.949814379f},
-std::array<float,2>{0.856136143f, 0.293799698f},
-std::array<float,2>{0.412569612f, 0.58339262f},
-std::array<float,2>{0.0719663352f, 0.117994927f},
-std::array<float,2>{0.543001056f, 0.800158024f},
-std::array<float,2>{0.717479408f, 0.245308891f},
-std::array<float,2>{0.208269835f, 0.878745675f},
-std::array<float,2>{0.252276063f, 0.37831223f},
-std::array<float,2>{0.96005857f, 0.637035847f},
-std::array<float,2>{0.827141404f, 0.0967524126f},
-std::array<float,2>{0.39704746f, 0.783253491f},
-std::array<float,2>{0.110478885f, 0.310383141f},
-std::array<float,2>{0.50607723f, 0.575787902f},
-std::array<float,2>{0.739254534f, 0.401147366f},
-std::array<float,2>{0.249752805f, 0.648646295f},
-std::array<float,2>{0.311944336f, 0.233620733f},
-std::array<float,2>{0.980645478f, 0.902461588f},
-std::array<float,2>{0.926397264f, 0.342028826f},
-std::array<float,2>{0.352897018f, 0.556068718f},
-std::array<float,2>{0.128277749f, 0.00291564455f},
-std::array<float,2>{0.633387506f, 0.861055613f},
-std::array<float,2>{0.623290658f, 0.125350207f},
-std::array<float,2>{0.0216897018f, 0.954429567f},
-std::array<float,2>{0.453467369f, 0.479817122f},
-std::array<float,2>{0.750977755f, 0.716395199f},
-std::array<float,2>{0.947509944f, 0.188821539f},
-std::array<float,2>{0.273775756f, 0.909820676f},
-std::array<float,2>{0.195937961f, 0.430014133f},
-std::array<float,2>{0.698687255f, 0.663375139f},
-std::array<float,2>{0.548780143f, 0.270989001f},
-std::array<float,2>{0.0936645418f, 0.623826563f},
-std::array<float,2>{0.434971362f, 0.0726436377f},
-std::array<float,2>{0.866152287f, 0.757730067f},
-std::array<float,2>{0.810213327f, 0.448884815f},
-std::array<float,2>{0.473347247f, 0.746003389f},
-std::array<float,2>{0.0507121645f, 0.158639252f},
-std::array<float,2>{0.593383372f, 0.994522452f},
-std::array<float,2>{0.657689691f, 0.0313043743f},
-std::array<float,2>{0.160946473f, 0.830765605f},
-std::array<float,2>{0.34188959f, 0.344287723f},
-std::array<float,2>{0.88063097f, 0.527536094f},
-std::array<float,2>{0.870551646f, 0.22639282f},
-std::array<float,2>{0.427865148f, 0.897008121f},
-std::array<float,2>{0.078809917f, 0.397893727f},
-std::array<float,2>{0.558292449f, 0.643484533f},
-std::array<float,2>{0.692850053f, 0.30300343f},
-std::array<float,2>{0.192697927f, 0.564768493f},
-std::array<float,2>{0.272665292f, 0.106569707f},
-std::array<float,2>{0.942880273f, 0.793096483f},
-std::array<float,2>{0.885594606f, 0.471103549f},
-std::array<float,2>{0.335757315f, 0.705828428f},
-std::array<float,2>{0.17173551f, 0.13456893f},
-std::array<float,2>{0.667791128f, 0.967762351f},
-std::array<float,2>{0.580094695f, 0.0140272379f},
-std::array<float,2>{0.0609695166f, 0.872450054f},
-std::array<float,2>{0.481321275f, 0.331794351f},
-std::array<float,2>{0.800056338f, 0.554571331f},
-std::array<float,2>{0.9742257f, 0.0646292642f},
-std::array<float,2>{0.30163914f, 0.764939308f},
-std::array<float,2>{0.242063433f, 0.279484361f},
-std::array<float,2>{0.74816817f, 0.615681589f},
-std::array<float,2>{0.513570845f, 0.428981304f},
-std::array<float,2>{0.12318024f, 0.666630149f},
-std::array<float,2>{0.401679009f, 0.202696711f},
-std::array<float,2>{0.814027309f, 0.916090727f},
-std::array<float,2>{0.763043463f, 0.35767895f},
-std::array<float,2>{0.465788066f, 0.515957773f},
-std::array<float,2>{0.0276461598f, 0.0415224619f},
-std::array<float,2>{0.61198324f, 0.836579561f},
-std::array<float,2>{0.62638855f, 0.164821327f},
-std::array<float,2>{0.134250596f, 0.990721405f},
-std::array<float,2>{0.346928805f, 0.441176683f},
-std::array<float,2>{0.930335939f, 0.735227048f},
-std::array<float,2>{0.794876814f, 0.0609962642f},
-std::array<float,2>{0.493496925f, 0.821424127f},
-std::array<float,2>{0.0330155902f, 0.364184827f},
-std::array<float,2>{0.577933073f, 0.505398512f},
-std::array<float,2>{0.677863121f, 0.466640085f},
-std::array<float,2>{0.173198283f, 0.726779222f},
-std::array<float,2>{0.315960586f, 0.17335856f},
-std::array<float,2>{0.901691377f, 0.97443676f},
-std::array<float,2>{0.965080798f, 0.25698483f},
-std::array<float,2>{0.263222218f, 0.598139405f},
-std::array<float,2>{0.212250069f, 0.0798758864f},
-std::array<float,2>{0.70606184f, 0.769535422f},
-std::array<float,2>{0.536152899f, 0.215808928f},
-std::array<float,2>{0.0657792166f, 0.934216201f},
-std::array<float,2>{0.417734355f, 0.410261869f},
-std::array<float,2>{0.84532243f, 0.677434027f},
-std::array<float,2>{0.911941946f, 0.144074008f},
-std::array<float,2>{0.360851258f, 0.937790811f},
-std::array<float,2>{0.14196068f, 0.488061696f},
-std::array<float,2>{0.644688666f, 0.691638768f},
-std::array<float,2>{0.60483551f, 0.317954361f},
-std::array<float,2>{0.0135684451f, 0.53458941f},
-std::array<float,2>{0.44182232f, 0.021210704f},
-std::array<float,2>{0.768914402f, 0.852758884f},
-std::array<float,2>{0.828747332f, 0.384834558f},
-std::array<float,2>{0.388545722f, 0.629660368f},
-std::array<float,2>{0.107700504f, 0.236640573f},
-std::array<float,2>{0.526262701f, 0.883442104f},
-std::array<float,2>{0.720792592f, 0.110068671f},
-std::array<float,2>{0.226816058f, 0.811000228f},
-std::array<float,2>{0.295735329f, 0.287219256f},
-std::array<float,2>{0.988910913f, 0.587354839f},
-std::array<float,2>{0.860491812f, 0.147299349f},
-std::array<float,2>{0.432751358f, 0.943664491f},
-std::array<float,2>{0.0874072909f, 0.491820276f},
-std::array<float,2>{0.551877022f, 0.687880874f},
-std::array<float,2>{0.702192008f, 0.315980792f},
-std::array<float,2>{0.199241742f, 0.538193941f},
-std::array<float,2>{0.279899299f, 0.0190638658f},
-std::array<float,2>{0.949935019f, 0.858464122f},
-std::array<float,2>{0.877113938f, 0.387874037f},
-std::array<float,2>{0.339678556f, 0.625629604f},
-std::array<float,2>{0.159136787f, 0.238718852f},
-std::array<float,2>{0.663729429f, 0.888479173f},
-std::array<float,2>{0.586721539f, 0.11506553f},
-std::array<float,2>{0.0533170253f, 0.807300985f},
-std::array<float,2>{0.471161485f, 0.283627599f},
-std::array<float,2>{0.805767655f, 0.591515183f},
-std::array<float,2>{0.978698432f, 0.0564249493f},
-std::array<float,2>{0.308046103f, 0.825157344f},
-std::array<float,2>{0.242476106f, 0.359499335f},
-std::array<float,2>{0.734770715f, 0.500638425f},
-std::array<float,2>{0.501337528f, 0.46432364f},
-std::array<float,2>{0.115401395f, 0.730615675f},
-std::array<float,2>{0.392163813f, 0.177449435f},
-std::array<float,2>{0.822026789f, 0.970072925f},
-std::array<float,2>{0.755311787f, 0.251733005f},
-std::array<float,2>{0.457796246f, 0.594859898f},
-std::array<float,2>{0.0169732086f, 0.0852173492f},
-std::array<float,2>{0.618484437f, 0.768451571f},
-std::array<float,2>{0.636893928f, 0.211635575f},
-std::array<float,2>{0.132446155f, 0.9318524f},
-std::array<float,2>{0.357295364f, 0.409087211f},
-std::array<float,2>{0.922793627f, 0.672412097f},
-std::array<float,2>{0.787075043f, 0.0664610043f},
-std::array<float,2>{0.487823784f, 0.761514723f},
-std::array<float,2>{0.0397923812f, 0.275067061f},
-std::array<float,2>{0.566598415f, 0.612118304f},
-std::array<float,2>{0.682414412f, 0.423686206f},
-std::array<float,2>{0.186554685f, 0.6682145f},
-std::array<float,2>{0.326601624f, 0.196205571f},
-std::array<float,2>{0.895971775f, 0.920016646f},
-std::array<float,2>{0.954546809f, 0.355178028f},
-std::array<float,2>{0.25575164f, 0.520653903f},
-std::array<float,2>{0.206684023f, 0.0435224399f},
-std::array<float,2>{0.712724924f, 0.8431319f},
-std::array<float,2>{0.539404154f, 0.169406667f},
-std::array<float,2>{0.0760704353f, 0.986265719f},
-std::array<float,2>{0.406680435f, 0.443294227f},
-std::array<float,2>{0.855467975f, 0.738343358f},
-std::array<float,2>{0.9143489f, 0.220675245f},
-std::array<float,2>{0.367667347f, 0.892368376f},
-std::array<float,2>{0.153442353f, 0.391182423f},
-std::array<float,2>{0.655090809f, 0.644964039f},
-std::array<float,2>{0.598263144f, 0.300200969f},
-std::array<float,2>{0.00691077486f, 0.569046736f},
-std::array<float,2>{0.44799158f, 0.103572085f},
-std::array<float,2>{0.773582458f, 0.792517245f},
-std::array<float,2>{0.839737535f, 0.473556101f},
-std::array<float,2>{0.382554352f, 0.710248828f},
-std::array<float,2>{0.0992678255f, 0.139235526f},
-std::array<float,2>{0.522432208f, 0.961506903f},
-std::array<float,2>{0.733261764f, 0.00800232682f},
-std::array<float,2>{0.22038506f, 0.870524526f},
-std::array<float,2>{0.281568229f, 0.333785892f},
-std::array<float,2>{0.999986708f, 0.550600469f},
-std::array<float,2>{0.771977246f, 0.192163661f},
-std::array<float,2>{0.440315753f, 0.911778867f},
-std::array<float,2>{0.00944000669f, 0.435085028f},
-std::array<float,2>{0.605502784f, 0.657875061f},
-std::array<float,2>{0.642483473f, 0.266397804f},
-std::array<float,2>{0.14714019f, 0.618828714f},
-std::array<float,2>{0.36432001f, 0.0765331164f},
-std::array<float,2>{0.90934366f, 0.751654387f},
-std::array<float,2>{0.984735131f, 0.452885002f},
-std::array<float,2>{0.291986555f, 0.747960091f},
-std::array<float,2>{0.232310921f, 0.161006421f},
-std::array<float,2>{0.724183261f, 0.996140122f},
-std::array<float,2>{0.527777851f, 0.0366246589f},
-std::array<float,2>{0.105040565f, 0.834960699f},
-std::array<float,2>{0.386466563f, 0.350383103f},
-std::array<float,2>{0.835670769f, 0.524077058f},
-std::array<float,2>{0.905410051f, 0.0982088f},
-std::array<float,2>{0.318160743f, 0.788048148f},
-std::array<float,2>{0.1794817f, 0.306301236f},
-std::array<float,2>{0.675242305f, 0.571805298f},
-std::array<float,2>{0.571971178f, 0.405501753f},
-std::array<float,2>{0.0390468538f, 0.653981209f},
-std::array<float,2>{0.496655017f, 0.229325607f},
-std::array<float,2>{0.792110264f, 0.901282012f},
-std::array<float,2>{0.849610507f, 0.338326871f},
-std::array<float,2>{0.418223977f, 0.559800267f},
-std::array<float,2>{0.0699178353f, 0.0060461075f},
-std::array<float,2>{0.533771455f, 0.863907516f},
-std::array<float,2>{0.708314598f, 0.128995568f},
-std::array<float,2>{0.218692705f, 0.96089834f},
-std::array<float,2>{0.261351049f, 0.482704431f},
-std::array<float,2>{0.961085021f, 0.714820743f},
-std::array<float,2>{0.816503584f, 0.0301829875f},
-std::array<float,2>{0.403883189f, 0.848094046f},
-std::array<float,2>{0.118376747f, 0.325388193f},
-std::array<float,2>{0.508416295f, 0.543600023f},
-std::array<float,2>{0.744875789f, 0.496415854f},
-std::array<float,2>{0.237714261f, 0.696115673f},
-std::array<float,2>{0.299176365f, 0.150648803f},
-std::array<float,2>{0.968804836f, 0.946877897f},
-std::array<float,2>{0.93526721f, 0.291007787f},
-std::array<float,2>{0.351376086f, 0.57856071f},
-std::array<float,2>{0.138536245f, 0.124472037f},
-std::array<float,2>{0.629011095f, 0.803922594f},
-std::array<float,2>{0.614303291f, 0.249079004f},
-std::array<float,2>{0.0249998868f, 0.880164742f},
-std::array<float,2>{0.462735206f, 0.382140398f},
-std::array<float,2>{0.759139776f, 0.635721028f},
-std::array<float,2>{0.940024972f, 0.182745799f},
-std::array<float,2>{0.266438901f, 0.978340268f},
-std::array<float,2>{0.19029814f, 0.459039122f},
-std::array<float,2>{0.687678993f, 0.720407903f},
-std::array<float,2>{0.561330497f, 0.372132361f},
-std::array<float,2>{0.0821353421f, 0.515109003f},
-std::array<float,2>{0.42374295f, 0.0486095324f},
-std::array<float,2>{0.871331215f, 0.815704465f},
-std::array<float,2>{0.803975403f, 0.421027899f},
-std::array<float,2>{0.478315204f, 0.68011111f},
-std::array<float,2>{0.0574758202f, 0.207432255f},
-std::array<float,2>{0.584849715f, 0.927695036f},
-std::array<float,2>{0.670799553f, 0.0902256072f},
-std::array<float,2>{0.165895328f, 0.779729843f},
-std::array<float,2>{0.328410029f, 0.263186961f},
-std::array<float,2>{0.889958441f, 0.607686102f},
-std::array<float,2>{0.811938643f, 0.159875929f},
-std::array<float,2>{0.476467937f, 0.995545328f},
-std::array<float,2>{0.0473579057f, 0.447544426f},
-std::array<float,2>{0.590268016f, 0.744559407f},
-std::array<float,2>{0.65835011f, 0.34513557f},
-std::array<float,2>{0.162508696f, 0.528811276f},
-std::array<float,2>{0.340336263f, 0.0324437879f},
-std::array<float,2>{0.881709218f, 0.831350684f},
-std::array<float,2>{0.946465731f, 0.431583017f},
-std::array<float,2>{0.277100682f, 0.66217047f},
-std::array<float,2>{0.1981913f, 0.188058063f},
-std::array<float,2>{0.695693195f, 0.908851445f},
-std::array<float,2>{0.550734937f, 0.0740519986f},
-std::array<float,2>{0.0908205882f, 0.756325066f},
-std::array<float,2>{0.435754836f, 0.270044565f},
-std::array<float,2>{0.864924014f, 0.624803543f},
-std::array<float,2>{0.929578841f, 0.00380848115f},
-std::array<float,2>{0.355126977f, 0.860317409f},
-std::array<float,2>{0.126448452f, 0.343646824f},
-std::array<float,2>{0.636217356f, 0.555328608f},
-std::array<float,2>{0.622778177f, 0.478835046f},
-std::array<float,2>{0.0197960772f, 0.715025902f},
-std::array<float,2>{0.456175268f, 0.126349077f},
-std::array<float,2>{0.753325462f, 0.953281641f},
-std::array<float,2>{0.82423389f, 0.308761418f},
-std::array<float,2>{0.394663483f, 0.574853957f},
-std::array<float,2>{0.111475915f, 0.0963612124f},
-std::array<float,2>{0.505527556f, 0.78466481f},
-std::array<float,2>{0.740507364f, 0.233214453f},
-std::array<float,2>{0.24609673f, 0.903980136f},
-std::array<float,2>{0.309355825f, 0.401968598f},
-std::array<float,2>{0.983152568f, 0.650183082f},
-std::array<float,2>{0.858119726f, 0.118190631f},
-std::array<float,2>{0.410476893f, 0.799345613f},
-std::array<float,2>{0.0727956891f, 0.294235289f},
-std::array<float,2>{0.545135796f, 0.582110465f},
-std::array<float,2>{0.716202497f, 0.377690226f},
-std::array<float,2>{0.209296405f, 0.638484359f},
-std::array<float,2>{0.250872523f, 0.244147748f},
-std::array<float,2>{0.958960056f, 0.877757072f},
-std::array<float,2>{0.892895699f, 0.322810352f},
-std::array<float,2>{0.322719961f, 0.539644003f},
-std::array<float,2>{0.182227269f, 0.0253497828f},
-std::array<float,2>{0.686365545f, 0.844665766f},
-std::array<float,2>{0.566380143f, 0.156123146f},
-std::array<float,2>{0.0455587916f, 0.951092303f},
-std::array<float,2>{0.489678144f, 0.493686676f},
-std::array<float,2>{0.78457123f, 0.701778591f},
-std::array<float,2>{0.994251311f, 0.203919321f},
-std::array<float,2>{0.286450028f, 0.923809171f},
-std::array<float,2>{0.226494461f, 0.417087793f},
-std::array<float,2>{0.729934514f, 0.68361944f},
-std::array<float,2>{0.51744175f, 0.260506719f},
-std::array<float,2>{0.0974771827f, 0.603723824f},
-std::array<float,2>{0.378022641f, 0.0873326212f},
-std::array<float,2>{0.840512276f, 0.776464641f},
-std::array<float,2>{0.77985698f, 0.454252452f},
-std::array<float,2>{0.451713711f, 0.72655499f},
-std::array<float,2>{0.00112714968f, 0.186916888f},
-std::array<float,2>{0.596413851f, 0.982332647f},
-std::array<float,2>{0.652004361f, 0.0539004318f},
-std::array<float,2>{0.149157256f, 0.818397582f},
-std::array<float,2>{0.372391492f, 0.3701967f},
-std::array<float,2>{0.919818699f, 0.510629475f},
-std::array<float,2>{0.831115305f, 0.237922996f},
-std::array<float,2>{0.389879346f, 0.884167612f},
-std::array<float,2>{0.105558433f, 0.385924727f},
-std::array<float,2>{0.525111854f, 0.630369902f},
-std::array<float,2>{0.719117045f, 0.288836837f},
-std::array<float,2>{0.230350211f, 0.586127281f},
-std::array<float,2>{0.293922305f, 0.110975556f},
-std::array<float,2>{0.990863025f, 0.812467277f},
-std::array<float,2>{0.912516057f, 0.487148374f},
-std::array<float,2>{0.361688256f, 0.693032444f},
-std::array<float,2>{0.143019125f, 0.143437862f},
-std::array<float,2>{0.648007154f, 0.938597441f},
-std::array<float,2>{0.602509558f, 0.0201108921f},
-std::array<float,2>{0.015610056f, 0.85161382f},
-std::array<float,2>{0.444255739f, 0.316742092f},
-std::array<float,2>{0.76732713f, 0.533659458f},
-std::array<float,2>{0.968263984f, 0.0787795484f},
-std::array<float,2>{0.264189631f, 0.77057457f},
-std::array<float,2>{0.213444129f, 0.256247908f},
-std::array<float,2>{0.703737617f, 0.599272728f},
-std::array<float,2>{0.538170993f, 0.411474735f},
-std::array<float,2>{0.0641458109f, 0.676651478f},
-std::array<float,2>{0.415039748f, 0.216764182f},
-std::array<float,2>{0.845739126f, 0.935120881f},
-std::array<float,2>{0.796724558f, 0.365168512f},
-std::array<float,2>{0.496023685f, 0.504442453f},
-std::array<float,2>{0.0349245556f, 0.061554309f},
-std::array<float,2>{0.574553847f, 0.821213603f},
-std::array<float,2>{0.676407456f, 0.171973214f},
-std::array<float,2>{0.173904598f, 0.972887456f},
-std::array<float,2>{0.313838303f, 0.465805888f},
-std::array<float,2>{0.898735166f, 0.727731884f},
-std::array<float,2>{0.765436172f, 0.042539414f},
-std::array<float,2>{0.46811524f, 0.837611556f},
-std::array<float,2>{0.0309828706f, 0.358894944f},
-std::array<float,2>{0.610540211f, 0.51684469f},
-std::array<float,2>{0.627684414f, 0.439665854f},
-std::array<float,2>{0.135262743f, 0.735715985f},
-std::array<float,2>{0.344597459f, 0.165954456f},
-std::array<float,2>{0.933588922f, 0.991342485f},
-std::array<float,2>{0.975048304f, 0.28070125f},
-std::array<float,2>{0.304217964f, 0.616540194f},
-std::array<float,2>{0.23912248f, 0.0654943436f},
-std::array<float,2>{0.747460425f, 0.764074504f},
-std::array<float,2>{0.514407218f, 0.201220959f},
-std::array<float,2>{0.121518217f, 0.917418301f},
-std::array<float,2>{0.400057286f, 0.428474635f},
-std::array<float,2>{0.814490616f, 0.667155147f},
-std::array<float,2>{0.883631587f, 0.133166566f},
-std::array<float,2>{0.332107604f, 0.968194604f},
-std::array<float,2>{0.167977855f, 0.472152084f},
-std::array<float,2>{0.664165199f, 0.706299543f},
-std::array<float,2>{0.578742266f, 0.330927789f},
-std::array<float,2>{0.0600920282f, 0.552765608f},
-std::array<float,2>{0.484032422f, 0.0150649706f},
-std::array<float,2>{0.798698604f, 0.871173739f},
-std::array<float,2>{0.868114531f, 0.397170931f},
-std::array<float,2>{0.427325487f, 0.644050539f},
-std::array<float,2>{0.0819965005f, 0.224677771f},
-std::array<float,2>{0.555153131f, 0.897953451f},
-std::array<float,2>{0.694431067f, 0.10554076f},
-std::array<float,2>{0.193665147f, 0.79429853f},
-std::array<float,2>{0.271110952f, 0.304387003f},
-std::array<float,2>{0.943931937f, 0.566300035f},
-std::array<float,2>{0.823725879f, 0.177870393f},
-std::array<float,2>{0.393844754f, 0.971023321f},
-std::array<float,2>{0.113992736f, 0.461544126f},
-std::array<float,2>{0.503074229f, 0.733058155f},
-std::array<float,2>{0.737095594f, 0.361472756f},
-std::array<float,2>{0.244879127f, 0.502010942f},
-std::array<float,2>{0.306407839f, 0.058224231f},
-std::array<float,2>{0.977834344f, 0.827260554f},
-std::array<float,2>{0.924065292f, 0.407483697f},
-std::array<float,2>{0.358761162f, 0.674783647f},
-std::array<float,2>{0.130655572f, 0.212973982f},
-std::array<float,2>{0.640522897f, 0.930092335f},
-std::array<float,2>{0.619173408f, 0.0824968442f},
-std::array<float,2>{0.0182487182f, 0.76614815f},
-std::array<float,2>{0.459998637f, 0.252715468f},
-std::array<float,2>{0.755991757f, 0.597129762f},
-std::array<float,2>{0.95138979f, 0.0170134231f},
-std::array<float,2>{0.278917223f, 0.856310189f},
-std::array<float,2>{0.202574641f, 0.314434856f},
-std::array<float,2>{0.699652791f, 0.537033558f},
-std::array<float,2>{0.552960396f, 0.489162266f},
-std::array<float,2>{0.0895986333f, 0.690134227f},
-std::array<float,2>{0.431095511f, 0.145030156f},
-std::array<float,2>{0.862834632f, 0.943302155f},
-std::array<float,2>{0.807438672f, 0.282786131f},
-std::array<float,2>{0.470635563f, 0.592907906f},
-std::array<float,2>{0.0523499846f, 0.115775734f},
-std::array<float,2>{0.588244379f, 0.806361377f},
-std::array<float,2>{0.661057651f, 0.241032422f},
-std::array<float,2>{0.15632768f, 0.890111089f},
-std::array<float,2>{0.335949808f, 0.390047371f},
-std::array<float,2>{0.876543343f, 0.627257407f},
-std::array<float,2>{0.77727735f, 0.102631226f},
-std::array<float,2>{0.447251201f, 0.789553821f},
-std::array<float,2>{0.00573887397f, 0.297350734f},
-std::array<float,2>{0.600652099f, 0.56801939f},
-std::array<float,2>{0.653739095f, 0.393745601f},
-std::array<float,2>{0.155977294f, 0.647336185f},
-std::array<float,2>{0.370139927f, 0.220894486f},
-std::array<float,2>{0.917534113f, 0.893331826f},
-std::array<float,2>{0.996942043f, 0.334593564f},
-std::array<float,2>{0.283360571f, 0.548808157f},
-std::array<float,2>{0.222338662f, 0.0106225079f},
-std::array<float,2>{0.730660975f, 0.867956877f},
-std::array<float,2>{0.519666314f, 0.137662575f},
-std::array<float,2>{0.10155417f, 0.964384317f},
-std::array<float,2>{0.379778445f, 0.475287795f},
-std::array<float,2>{0.837596357f, 0.708665967f},
-std::array<float,2>{0.896751463f, 0.197407857f},
-std::array<float,2>{0.324859977f, 0.918365538f},
-std::array<float,2>{0.185450405f, 0.424898118f},
-std::array<float,2>{0.681525052f, 0.670780122f},
-std::array<float,2>{0.568736911f, 0.276115149f},
-std::array<float,2>{0.0422668457f, 0.609680414f},
-std::array<float,2>{0.486316621f, 0.0687018186f},
-std::array<float,2>{0.788335264f, 0.75844878f},
-std::array<float,2>{0.852498829f, 0.443722993f},
-std::array<float,2>{0.409420907f, 0.740599155f},
-std::array<float,2>{0.0777346119f, 0.171263739f},
-std::array<float,2>{0.541526079f, 0.98734647f},
-std::array<float,2>{0.713128865f, 0.0463277549f},
-std::array<float,2>{0.204349011f, 0.841157734f},
-std::array<float,2>{0.256283551f, 0.353397697f},
-std::array<float,2>{0.956362009f, 0.521797419f},
-std::array<float,2>{0.789220691f, 0.226735249f},
-std::array<float,2>{0.499486536f, 0.898887396f},
-std::array<float,2>{0.0361737497f, 0.403148115f},
-std::array<float,2>{0.572943926f, 0.654552042f},
-std::array<float,2>{0.672469795f, 0.306749791f},
-std::array<float,2>{0.176272377f, 0.573130548f},
-std::array<float,2>{0.319412202f, 0.0996393636f},
-std::array<float,2>{0.903490126f, 0.786928296f},
-std::array<float,2>{0.963412583f, 0.48145467f},
-std::array<float,2>{0.258850545f, 0.712042093f},
-std::array<float,2>{0.215440944f, 0.132208452f},
-std::array<float,2>{0.709094048f, 0.958749413f},
-std::array<float,2>{0.533144116f, 0.00439413171f},
-std::array<float,2>{0.0677082017f, 0.866840422f},
-std::array<float,2>{0.4206523f, 0.337607145f},
-std::array<float,2>{0.847715378f, 0.562043488f},
-std::array<float,2>{0.90770942f, 0.0756882802f},
-std::array<float,2>{0.366913348f, 0.75249052f},
-std::array<float,2>{0.146393418f, 0.26918301f},
-std::array<float,2>{0.644213259f, 0.620662212f},
-std::array<float,2>{0.607760787f, 0.436983615f},
-std::array<float,2>{0.0110570919f, 0.658781767f},
-std::array<float,2>{0.438116759f, 0.193587333f},
-std::array<float,2>{0.770419419f, 0.913121641f},
-std::array<float,2>{0.832964301f, 0.349112689f},
-std::array<float,2>{0.383775651f, 0.525395513f},
-std::array<float,2>{0.102048084f, 0.0381196178f},
-std::array<float,2>{0.531098068f, 0.83343786f},
-std::array<float,2>{0.724937201f, 0.163974911f},
-std::array<float,2>{0.234187782f, 0.998179913f},
-std::array<float,2>{0.289819151f, 0.450775862f},
-std::array<float,2>{0.988119125f, 0.748537898f},
-std::array<float,2>{0.873893559f, 0.0495261624f},
-std::array<float,2>{0.424042046f, 0.813449025f},
-std::array<float,2>{0.0856376588f, 0.373786271f},
-std::array<float,2>{0.560130477f, 0.512008429f},
-std::array<float,2>{0.69062078f, 0.457972795f},
-std::array<float,2>{0.188725397f, 0.721574068f},
-std::array<float,2>{0.269406557f, 0.180397138f},
-std::array<float,2>{0.938601613f, 0.979676664f},
-std::array<float,2>{0.887182057f, 0.264576882f},
-std::array<float,2>{0.331736654f, 0.606255829f},
-std::array<float,2>{0.166040108f, 0.0924207941f},
-std::array<float,2>{0.669089556f, 0.777495801f},
-std::array<float,2>{0.582093239f, 0.210157797f},
-std::array<float,2>{0.0553466417f, 0.927864671f},
-std::array<float,2>{0.478578061f, 0.41967079f},
-std::array<float,2>{0.801331043f, 0.681931496f},
-std::array<float,2>{0.972117841f, 0.150259376f},
-std::array<float,2>{0.297391027f, 0.947461307f},
-std::array<float,2>{0.236237749f, 0.499145538f},
-std::array<float,2>{0.744030356f, 0.698506296f},
-std::array<float,2>{0.510190785f, 0.327743798f},
-std::array<float,2>{0.12032795f, 0.544947624f},
-std::array<float,2>{0.406144798f, 0.0282227304f},
-std::array<float,2>{0.820275962f, 0.851466954f},
-std::array<float,2>{0.760039032f, 0.380811185f},
-std::array<float,2>{0.464649618f, 0.633490801f},
-std::array<float,2>{0.025823677f, 0.247095793f},
-std::array<float,2>{0.616351187f, 0.882325947f},
-std::array<float,2>{0.631157398f, 0.121341102f},
-std::array<float,2>{0.140016213f, 0.802284002f},
-std::array<float,2>{0.347694516f, 0.291518956f},
-std::array<float,2>{0.936511874f, 0.581815362f},
-std::array<float,2>{0.750211298f, 0.127410799f},
-std::array<float,2>{0.455075145f, 0.956565022f},
-std::array<float,2>{0.0230269525f, 0.477590114f},
-std::array<float,2>{0.62429595f, 0.718728065f},
-std::array<float,2>{0.634162605f, 0.341375828f},
-std::array<float,2>{0.127054468f, 0.557099581f},
-std::array<float,2>{0.352308482f, 0.00125761994f},
-std::array<float,2>{0.927326858f, 0.862765193f},
-std::array<float,2>{0.982407749f, 0.400203228f},
-std::array<float,2>{0.31134057f, 0.650674105f},
-std::array<float,2>{0.248650044f, 0.23179765f},
-std::array<float,2>{0.739864051f, 0.904349446f},
-std::array<float,2>{0.507534862f, 0.0943832248f},
-std::array<float,2>{0.110104688f, 0.781974137f},
-std::array<float,2>{0.397517204f, 0.311611265f},
-std::array<float,2>{0.828009427f, 0.576844275f},
-std::array<float,2>{0.878959298f, 0.0349569768f},
-std::array<float,2>{0.343334168f, 0.829829454f},
-std::array<float,2>{0.16198577f, 0.347541422f},
-std::array<float,2>{0.656419396f, 0.529471517f},
-std::array<float,2>{0.592305303f, 0.446340233f},
-std::array<float,2>{0.0494642332f, 0.742286623f},
-std::array<float,2>{0.473737955f, 0.15730682f},
-std::array<float,2>{0.809041262f, 0.993810892f},
-std::array<float,2>{0.866852462f, 0.272471279f},
-std::array<float,2>{0.43451637f, 0.621632457f},
-std::array<float,2>{0.0926595554f, 0.071367465f},
-std::array<float,2>{0.547150016f, 0.755311608f},
-std::array<float,2>{0.697527468f, 0.191034928f},
-std::array<float,2>{0.196385235f, 0.906867683f},
-std::array<float,2>{0.275032848f, 0.432123303f},
-std::array<float,2>{0.948971868f, 0.661000311f},
-std::array<float,2>{0.842525423f, 0.0888770819f},
-std::array<float,2>{0.376283079f, 0.77359426f},
-std::array<float,2>{0.0948617756f, 0.259581923f},
-std::array<float,2>{0.518729568f, 0.602877378f},
-std::array<float,2>{0.727590203f, 0.41427651f},
-std::array<float,2>{0.223678336f, 0.686300397f},
-std::array<float,2>{0.2877509f, 0.206476182f},
-std::array<float,2>{0.993387461f, 0.924205244f},
-std::array<float,2>{0.921554208f, 0.368498325f},
-std::array<float,2>{0.373393655f, 0.508754373f},
-std::array<float,2>{0.151218578f, 0.0523720197f},
-std::array<float,2>{0.648610175f, 0.816984594f},
-std::array<float,2>{0.59523952f, 0.184579685f},
-std::array<float,2>{0.00233298657f, 0.983528376f},
-std::array<float,2>{0.450776845f, 0.455185443f},
-std::array<float,2>{0.777543724f, 0.724230766f},
-std::array<float,2>{0.959011078f, 0.244074926f},
-std::array<float,2>{0.253885806f, 0.875590205f},
-std::array<float,2>{0.20773828f, 0.376335084f},
-std::array<float,2>{0.718260467f, 0.63875103f},
-std::array<float,2>{0.544436514f, 0.296769768f},
-std::array<float,2>{0.0708926022f, 0.585477114f},
-std::array<float,2>{0.413700104f, 0.120652631f},
-std::array<float,2>{0.856606543f, 0.797018945f},
-std::array<float,2>{0.781576753f, 0.495243669f},
-std::array<float,2>{0.491071343f, 0.701011777f},
-std::array<float,2>{0.0442005582f, 0.153124899f},
-std::array<float,2>{0.563252449f, 0.9525823f},
-std::array<float,2>{0.683682799f, 0.025782872f},
-std::array<float,2>{0.181276202f, 0.846627653f},
-std::array<float,2>{0.322235852f, 0.320706069f},
-std::array<float,2>{0.891915321f, 0.54272455f},
-std::array<float,2>{0.844073534f, 0.217285752f},
-std::array<float,2>{0.416555554f, 0.937023699f},
-std::array<float,2>{0.065245755f, 0.413734019f},
-std::array<float,2>{0.535200238f, 0.678976595f},
-std::array<float,2>{0.705161393f, 0.254348308f},
-std::array<float,2>{0.211249337f, 0.600330412f},
-std::array<float,2>{0.261891752f, 0.0806583092f},
-std::array<float,2>{0.966485977f, 0.77187556f},
-std::array<float,2>{0.900963783f, 0.468320429f},
-std::array<float,2>{0.315032184f, 0.729228079f},
-std::array<float,2>{0.172188416f, 0.174242571f},
-std::array<float,2>{0.678737998f, 0.97597605f},
-std::array<float,2>{0.577004194f, 0.0603840314f},
-std::array<float,2>{0.031259805f, 0.823218524f},
-std::array<float,2>{0.492884248f, 0.36616236f},
-std::array<float,2>{0.793352485f, 0.505926132f},
-std::array<float,2>{0.990155458f, 0.113076732f},
-std::array<float,2>{0.296019197f, 0.809793174f},
-std::array<float,2>{0.228267387f, 0.285577953f},
-std::array<float,2>{0.722345352f, 0.589800894f},
-std::array<float,2>{0.526771069f, 0.383747965f},
-std::array<float,2>{0.10933248f, 0.632742286f},
-std::array<float,2>{0.387243569f, 0.236098126f},
-std::array<float,2>{0.82960254f, 0.886463165f},
-std::array<float,2>{0.768489659f, 0.319561958f},
-std::array<float,2>{0.443107784f, 0.53271997f},
-std::array<float,2>{0.0122155026f, 0.0232725441f},
-std::array<float,2>{0.604117215f, 0.855080009f},
-std::array<float,2>{0.645760894f, 0.140645742f},
-std::array<float,2>{0.140873283f, 0.939462602f},
-std::array<float,2>{0.359949976f, 0.485660315f},
-std::array<float,2>{0.911112905f, 0.693633795f},
-std::array<float,2>{0.798859537f, 0.0117440047f},
-std::array<float,2>{0.481573164f, 0.874421537f},
-std::array<float,2>{0.0622498766f, 0.328767478f},
-std::array<float,2>{0.581368625f, 0.55101037f},
-std::array<float,2>{0.666470647f, 0.470323622f},
-std::array<float,2>{0.170181707f, 0.704970777f},
-std::array<float,2>{0.334583789f, 0.1358978f},
-std::array<float,2>{0.885802805f, 0.965228319f},
-std::array<float,2>{0.942078114f, 0.302467078f},
-std::array<float,2>{0.271501243f, 0.562939882f},
-std::array<float,2>{0.19206959f, 0.109359376f},
-std::array<float,2>{0.691798627f, 0.795848429f},
-std::array<float,2>{0.556925476f, 0.222770035f},
-std::array<float,2>{0.0794203654f, 0.894649863f},
-std::array<float,2>{0.428809047f, 0.39478597f},
-std::array<float,2>{0.869409859f, 0.641097367f},
-std::array<float,2>{0.931195438f, 0.166586772f},
-std::array<float,2>{0.346679538f, 0.989372909f},
-std::array<float,2>{0.133719668f, 0.437757283f},
-std::array<float,2>{0.625345826f, 0.737921417f},
-std::array<float,2>{0.612618685f, 0.355615199f},
-std::array<float,2>{0.0284357276f, 0.518347383f},
-std::array<float,2>{0.4665609f, 0.0408283509f},
-std::array<float,2>{0.762035608f, 0.839545608f},
-std::array<float,2>{0.813460708f, 0.427599132f},
-std::array<float,2>{0.400686771f, 0.66591984f},
-std::array<float,2>{0.124485806f, 0.200087145f},
-std::array<float,2>{0.512208402f, 0.915553212f},
-std::array<float,2>{0.749097109f, 0.0634283572f},
-std::array<float,2>{0.240874588f, 0.762876093f},
-std::array<float,2>{0.302256942f, 0.277505755f},
-std::array<float,2>{0.97285372f, 0.613770306f},
-std::array<float,2>{0.865072906f, 0.156780437f},
-std::array<float,2>{0.43584305f, 0.992218852f},
-std::array<float,2>{0.091220282f, 0.445675224f},
-std::array<float,2>{0.550354004f, 0.743829429f},
-std::array<float,2>{0.695403278f, 0.346652329f},
-std::array<float,2>{0.197760776f, 0.530411124f},
-std::array<float,2>{0.276904255f, 0.0341407098f},
-std::array<float,2>{0.946593583f, 0.828465402f},
-std::array<float,2>{0.881451309f, 0.433124274f},
-std::array<float,2>{0.340696871f, 0.662089348f},
-std::array<float,2>{0.162199631f, 0.190296471f},
-std::array<float,2>{0.658496439f, 0.907808185f},
-std::array<float,2>{0.590079784f, 0.0706562549f},
-std::array<float,2>{0.0468860045f, 0.753946424f},
-std::array<float,2>{0.476137251f, 0.271778911f},
-std::array<float,2>{0.811756015f, 0.622749805f},
-std::array<float,2>{0.983378589f, 0.000555851671f},
-std::array<float,2>{0.309160024f, 0.862223387f},
-std::array<float,2>{0.246476144f, 0.340256035f},
-std::array<float,2>{0.740436733f, 0.558195651f},
-std::array<float,2>{0.50584209f, 0.477419913f},
-std::array<float,2>{0.111665897f, 0.717387557f},
-std::array<float,2>{0.394843668f, 0.128065616f},
-std::array<float,2>{0.824550748f, 0.955138505f},
-std::array<float,2>{0.752993345f, 0.311026096f},
-std::array<float,2>{0.456422001f, 0.577193379f},
-std::array<float,2>{0.0195316039f, 0.0950876549f},
-std::array<float,2>{0.623039186f, 0.782779813f},
-std::array<float,2>{0.635882795f, 0.230489746f},
-std::array<float,2>{0.126010939f, 0.905772269f},
-std::array<float,2>{0.355388731f, 0.398702621f},
-std::array<float,2>{0.929302692f, 0.6516276f},
-std::array<float,2>{0.78424108f, 0.119640991f},
-std::array<float,2>{0.489342451f, 0.798490703f},
-std::array<float,2>{0.0457125902f, 0.29571262f},
-std::array<float,2>{0.565965354f, 0.584017634f},
-std::array<float,2>{0.68606621f, 0.375564933f},
-std::array<float,2>{0.182474062f, 0.639959216f},
-std::array<float,2>{0.322391152f, 0.243080989f},
-std::array<float,2>{0.892755628f, 0.876015782f},
-std::array<float,2>{0.958652318f, 0.322044849f},
-std::array<float,2>{0.250538021f, 0.541296065f},
-std::array<float,2>{0.209099621f, 0.0266884305f},
-std::array<float,2>{0.715826154f, 0.847607374f},
-std::array<float,2>{0.545374572f, 0.153811261f},
-std::array<float,2>{0.0731891319f, 0.951586425f},
-std::array<float,2>{0.410318822f, 0.494844168f},
-std::array<float,2>{0.858318925f, 0.699822545f},
-std::array<float,2>{0.919469416f, 0.205193341f},
-std::array<float,2>{0.372103155f, 0.92482239f},
-std::array<float,2>{0.149175286f, 0.415882856f},
-std::array<float,2>{0.652268708f, 0.687219381f},
-std::array<float,2>{0.596534908f, 0.258725822f},
-std::array<float,2>{0.00142537756f, 0.60199213f},
-std::array<float,2>{0.452130765f, 0.0883795843f},
-std::array<float,2>{0.780094028f, 0.774724364f},
-std::array<float,2>{0.840793073f, 0.456242263f},
-std::array<float,2>{0.378262222f, 0.723547399f},
-std::array<float,2>{0.0972108468f, 0.183732942f},
-std::array<float,2>{0.51716131f, 0.983008981f},
-std::array<float,2>{0.729658604f, 0.050788939f},
-std::array<float,2>{0.226099297f, 0.818176866f},
-std::array<float,2>{0.286249459f, 0.367507279f},
-std::array<float,2>{0.994398236f, 0.509567499f},
-std::array<float,2>{0.767461002f, 0.234600022f},
-std::array<float,2>{0.444037527f, 0.885565341f},
-std::array<float,2>{0.0151676293f, 0.384600252f},
-std::array<float,2>{0.602208853f, 0.631831706f},
-std::array<float,2>{0.648304939f, 0.286195844f},
-std::array<float,2>{0.142747775f, 0.588446856f},
-std::array<float,2>{0.361381054f, 0.111757882f},
-std::array<float,2>{0.912205279f, 0.809559703f},
-std::array<float,2>{0.99119395f, 0.484875858f},
-std::array<float,2>{0.293538421f, 0.694366455f},
-std::array<float,2>{0.230215654f, 0.142126724f},
-std::array<float,2>{0.718876958f, 0.941156387f},
-std::array<float,2>{0.525183558f, 0.0220976528f},
-std::array<float,2>{0.105798803f, 0.853686094f},
-std::array<float,2>{0.390123069f, 0.318877429f},
-std::array<float,2>{0.831408262f, 0.532178819f},
-std::array<float,2>{0.898603201f, 0.0812630951f},
-std::array<float,2>{0.31369859f, 0.773035824f},
-std::array<float,2>{0.174150094f, 0.254925549f},
-std::array<float,2>{0.67666316f, 0.600622773f},
-std::array<float,2>{0.574338496f, 0.412267685f},
-std::array<float,2>{0.0346995592f, 0.678472817f},
-std::array<float,2>{0.495720893f, 0.217867658f},
-std::array<float,2>{0.796391428f, 0.935595989f},
-std::array<float,2>{0.845980227f, 0.366594344f},
-std::array<float,2>{0.415432096f, 0.507555127f},
-std::array<float,2>{0.0642500892f, 0.0588697493f},
-std::array<float,2>{0.538380563f, 0.823614597f},
-std::array<float,2>{0.703905821f, 0.175468475f},
-std::array<float,2>{0.213666365f, 0.97497046f},
-std::array<float,2>{0.264539152f, 0.467535019f},
-std::array<float,2>{0.968616426f, 0.730319738f},
-std::array<float,2>{0.814760864f, 0.0398064591f},
-std::array<float,2>{0.400165081f, 0.83876574f},
-std::array<float,2>{0.121154852f, 0.357242703f},
-std::array<float,2>{0.514241695f, 0.519429326f},
-std::array<float,2>{0.747162223f, 0.439043432f},
-std::array<float,2>{0.238929331f, 0.737088859f},
-std::array<float,2>{0.304522485f, 0.167613566f},
-std::array<float,2>{0.974627614f, 0.988813579f},
-std::array<float,2>{0.933221936f, 0.279039532f},
-std::array<float,2>{0.344265282f, 0.615139723f},
-std::array<float,2>{0.135674506f, 0.0636832565f},
-std::array<float,2>{0.627836287f, 0.762681842f},
-std::array<float,2>{0.610732436f, 0.200320154f},
-std::array<float,2>{0.0310709625f, 0.914898038f},
-std::array<float,2>{0.467870772f, 0.42641589f},
-std::array<float,2>{0.765269399f, 0.664214492f},
-std::array<float,2>{0.944198132f, 0.135677457f},
-std::array<float,2>{0.271259278f, 0.966029227f},
-std::array<float,2>{0.193478316f, 0.468850255f},
-std::array<float,2>{0.694781482f, 0.703296602f},
-std::array<float,2>{0.554761708f, 0.329580188f},
-std::array<float,2>{0.081657514f, 0.55241406f},
-std::array<float,2>{0.427501291f, 0.0133011565f},
-std::array<float,2>{0.867683351f, 0.87354362f},
-std::array<float,2>{0.798543811f, 0.396035433f},
-std::array<float,2>{0.484359086f, 0.642230093f},
-std::array<float,2>{0.0605192892f, 0.224479735f},
-std::array<float,2>{0.579070389f, 0.895591915f},
-std::array<float,2>{0.664422274f, 0.107737191f},
-std::array<float,2>{0.168315426f, 0.796213925f},
-std::array<float,2>{0.332516611f, 0.30143851f},
-std::array<float,2>{0.8834306f, 0.563898802f},
-std::array<float,2>{0.806105137f, 0.146282583f},
-std::array<float,2>{0.47087267f, 0.941917479f},
-std::array<float,2>{0.0536083579f, 0.489308536f},
-std::array<float,2>{0.58654964f, 0.690734804f},
-std::array<float,2>{0.664056718f, 0.313435405f},
-std::array<float,2>{0.158706814f, 0.536062062f},
-std::array<float,2>{0.339466751f, 0.0164244138f},
-std::array<float,2>{0.877392769f, 0.857398748f},
-std::array<float,2>{0.950001955f, 0.38906908f},
-std::array<float,2>{0.280109346f, 0.628131807f},
-std::array<float,2>{0.199558228f, 0.241458848f},
-std::array<float,2>{0.70241797f, 0.889126241f},
-std::array<float,2>{0.552084267f, 0.11695344f},
-std::array<float,2>{0.0878410786f, 0.805512547f},
-std::array<float,2>{0.432945639f, 0.281846792f},
-std::array<float,2>{0.860791266f, 0.592498779f},
-std::array<float,2>{0.922386289f, 0.0570335388f},
-std::array<float,2>{0.357117146f, 0.827009261f},
-std::array<float,2>{0.132585749f, 0.362657219f},
-std::array<float,2>{0.637112319f, 0.503375411f},
-std::array<float,2>{0.618246436f, 0.462243915f},
-std::array<float,2>{0.0166899581f, 0.733716846f},
-std::array<float,2>{0.457745135f, 0.179597706f},
-std::array<float,2>{0.754984021f, 0.972607493f},
-std::array<float,2>{0.821965754f, 0.253669024f},
-std::array<float,2>{0.392403573f, 0.595727265f},
-std::array<float,2>{0.115542099f, 0.083607316f},
-std::array<float,2>{0.501094401f, 0.7666049f},
-std::array<float,2>{0.73453784f, 0.214314312f},
-std::array<float,2>{0.242187843f, 0.931051731f},
-std::array<float,2>{0.307843864f, 0.406783223f},
-std::array<float,2>{0.978963554f, 0.675772846f},
-std::array<float,2>{0.854994059f, 0.0696034655f},
-std::array<float,2>{0.406395167f, 0.759263575f},
-std::array<float,2>{0.075846605f, 0.276851982f},
-std::array<float,2>{0.539298236f, 0.610676646f},
-std::array<float,2>{0.712433577f, 0.424070477f},
-std::array<float,2>{0.206905738f, 0.671860039f},
-std::array<float,2>{0.255411655f, 0.199192002f},
-std::array<float,2>{0.95413506f, 0.919861555f},
-std::array<float,2>{0.895514071f, 0.351668805f},
-std::array<float,2>{0.32633397f, 0.522920191f},
-std::array<float,2>{0.186908349f, 0.0455730334f},
-std::array<float,2>{0.682319462f, 0.840393007f},
-std::array<float,2>{0.566681564f, 0.17077668f},
-std::array<float,2>{0.0398606062f, 0.98727715f},
-std::array<float,2>{0.488275319f, 0.444459587f},
-std::array<float,2>{0.786811888f, 0.741510868f},
-std::array<float,2>{0.999666631f, 0.221771419f},
-std::array<float,2>{0.281351626f, 0.893880785f},
-std::array<float,2>{0.220507875f, 0.39349705f},
-std::array<float,2>{0.733042181f, 0.648220181f},
-std::array<float,2>{0.522070289f, 0.297866434f},
-std::array<float,2>{0.0994676873f, 0.566896379f},
-std::array<float,2>{0.382674962f, 0.10238333f},
-std::array<float,2>{0.839378953f, 0.790711522f},
-std::array<float,2>{0.773883581f, 0.476240337f},
-std::array<float,2>{0.448211432f, 0.707370758f},
-std::array<float,2>{0.00725759519f, 0.138643801f},
-std::array<float,2>{0.598583162f, 0.963739395f},
-std::array<float,2>{0.654899418f, 0.0109675368f},
-std::array<float,2>{0.153582111f, 0.868785381f},
-std::array<float,2>{0.367357612f, 0.335179836f},
-std::array<float,2>{0.914292991f, 0.547783852f},
-std::array<float,2>{0.835895419f, 0.195051655f},
-std::array<float,2>{0.386651069f, 0.912713945f},
-std::array<float,2>{0.105238631f, 0.435733259f},
-std::array<float,2>{0.527563334f, 0.660051346f},
-std::array<float,2>{0.724453926f, 0.267727613f},
-std::array<float,2>{0.231933892f, 0.619638026f},
-std::array<float,2>{0.291741431f, 0.0747739822f},
-std::array<float,2>{0.98451966f, 0.753098071f},
-std::array<float,2>{0.909581482f, 0.450106084f},
-std::array<float,2>{0.364716381f, 0.749939024f},
-std::array<float,2>{0.147306859f, 0.162372962f},
-std::array<float,2>{0.642237663f, 0.999178529f},
-std::array<float,2>{0.605817854f, 0.037252035f},
-std::array<float,2>{0.00957944151f, 0.832763255f},
-std::array<float,2>{0.440036744f, 0.348407567f},
-std::array<float,2>{0.772377908f, 0.526645064f},
-std::array<float,2>{0.961255968f, 0.100889713f},
-std::array<float,2>{0.261592507f, 0.786081135f},
-std::array<float,2>{0.218453482f, 0.308036208f},
-std::array<float,2>{0.708175242f, 0.574073195f},
-std::array<float,2>{0.533945262f, 0.403525889f},
-std::array<float,2>{0.0702495649f, 0.655679345f},
-std::array<float,2>{0.417992771f, 0.227980956f},
-std::array<float,2>{0.849973023f, 0.89984113f},
-std::array<float,2>{0.792389512f, 0.336858034f},
-std::array<float,2>{0.496863574f, 0.561486661f},
-std::array<float,2>{0.0387025438f, 0.00503693055f},
-std::array<float,2>{0.572161913f, 0.865932524f},
-std::array<float,2>{0.674812376f, 0.131482124f},
-std::array<float,2>{0.179225013f, 0.957401276f},
-std::array<float,2>{0.317936093f, 0.480775356f},
-std::array<float,2>{0.905733526f, 0.711769044f},
-std::array<float,2>{0.75901854f, 0.0287218112f},
-std::array<float,2>{0.462552607f, 0.849622667f},
-std::array<float,2>{0.0251563732f, 0.326384336f},
-std::array<float,2>{0.614503622f, 0.546441853f},
-std::array<float,2>{0.629392385f, 0.498718321f},
-std::array<float,2>{0.138319194f, 0.697671294f},
-std::array<float,2>{0.351077229f, 0.14934583f},
-std::array<float,2>{0.935444236f, 0.94894886f},
-std::array<float,2>{0.969085872f, 0.292055637f},
-std::array<float,2>{0.298935533f, 0.580796182f},
-std::array<float,2>{0.237523213f, 0.122581422f},
-std::array<float,2>{0.744869232f, 0.801053941f},
-std::array<float,2>{0.508750141f, 0.246501878f},
-std::array<float,2>{0.118610673f, 0.88119477f},
-std::array<float,2>{0.404183924f, 0.379799187f},
-std::array<float,2>{0.816865802f, 0.634416521f},
-std::array<float,2>{0.889822781f, 0.180690512f},
-std::array<float,2>{0.328154773f, 0.978733242f},
-std::array<float,2>{0.165730938f, 0.458315998f},
-std::array<float,2>{0.670547962f, 0.721785724f},
-std::array<float,2>{0.584527671f, 0.37410897f},
-std::array<float,2>{0.0572990291f, 0.51324749f},
-std::array<float,2>{0.478163481f, 0.0507219583f},
-std::array<float,2>{0.803780496f, 0.81398958f},
-std::array<float,2>{0.871401846f, 0.418645203f},
-std::array<float,2>{0.423365027f, 0.683452785f},
-std::array<float,2>{0.0822976753f, 0.209070757f},
-std::array<float,2>{0.561131895f, 0.929099798f},
-std::array<float,2>{0.687843084f, 0.0934655964f},
-std::array<float,2>{0.190121904f, 0.778830707f},
-std::array<float,2>{0.266131997f, 0.264898598f},
-std::array<float,2>{0.940345466f, 0.606574953f},
-std::array<float,2>{0.827663958f, 0.125582501f},
-std::array<float,2>{0.397947311f, 0.954859912f},
-std::array<float,2>{0.110202372f, 0.480081081f},
-std::array<float,2>{0.50762558f, 0.716015697f},
-std::array<float,2>{0.740013123f, 0.34228754f},
-std::array<float,2>{0.248801291f, 0.556560397f},
-std::array<float,2>{0.311160654f, 0.00227988884f},
-std::array<float,2>{0.981963694f, 0.860416889f},
-std::array<float,2>{0.927513957f, 0.40040344f},
-std::array<float,2>{0.352165252f, 0.64938724f},
-std::array<float,2>{0.127261221f, 0.234062493f},
-std::array<float,2>{0.633800924f, 0.903013051f},
-std::array<float,2>{0.624175847f, 0.0976201743f},
-std::array<float,2>{0.023204824f, 0.78377974f},
-std::array<float,2>{0.454781502f, 0.309785366f},
-std::array<float,2>{0.750293255f, 0.575274825f},
-std::array<float,2>{0.949202538f, 0.0321258008f},
-std::array<float,2>{0.275233388f, 0.830528438f},
-std::array<float,2>{0.196582288f, 0.343787521f},
-std::array<float,2>{0.697469473f, 0.527855456f},
-std::array<float,2>{0.546964467f, 0.448579043f},
-std::array<float,2>{0.0923988f, 0.745527148f},
-std::array<float,2>{0.434300154f, 0.159167066f},
-std::array<float,2>{0.867082775f, 0.994805276f},
-std::array<float,2>{0.808731675f, 0.271408826f},
-std::array<float,2>{0.473956227f, 0.623124838f},
-std::array<float,2>{0.0496562943f, 0.0731045753f},
-std::array<float,2>{0.592754006f, 0.75690794f},
-std::array<float,2>{0.656512916f, 0.189077541f},
-std::array<float,2>{0.161804959f, 0.909214795f},
-std::array<float,2>{0.343737811f, 0.43042466f},
-std::array<float,2>{0.879380703f, 0.664027035f},
-std::array<float,2>{0.777733326f, 0.0862444043f},
-std::array<float,2>{0.451149136f, 0.775550663f},
-std::array<float,2>{0.00196884992f, 0.261375636f},
-std::array<float,2>{0.595683873f, 0.605281055f},
-std::array<float,2>{0.648697019f, 0.416594625f},
-std::array<float,2>{0.150899917f, 0.685393095f},
-std::array<float,2>{0.373280019f, 0.204210699f},
-std::array<float,2>{0.921759188f, 0.922268093f},
-std::array<float,2>{0.993430853f, 0.369686693f},
-std::array<float,2>{0.288084298f, 0.511197031f},
-std::array<float,2>{0.223881006f, 0.0527556613f},
-std::array<float,2>{0.727989078f, 0.82024163f},
-std::array<float,2>{0.518847167f, 0.186043069f},
-std::array<float,2>{0.0951512456f, 0.98094064f},
-std::array<float,2>{0.376068473f, 0.45381397f},
-std::array<float,2>{0.842604637f, 0.725545585f},
-std::array<float,2>{0.891821325f, 0.245725319f},
-std::array<float,2>{0.321906179f, 0.878327131f},
-std::array<float,2>{0.181433201f, 0.378427327f},
-std::array<float,2>{0.68405515f, 0.637695074f},
-std::array<float,2>{0.563061476f, 0.292973816f},
-std::array<float,2>{0.0441219211f, 0.583792925f},
-std::array<float,2>{0.490842491f, 0.117461286f},
-std::array<float,2>{0.781282902f, 0.800602794f},
-std::array<float,2>{0.85688144f, 0.492291212f},
-std::array<float,2>{0.413851768f, 0.70215559f},
-std::array<float,2>{0.0711881295f, 0.155139506f},
-std::array<float,2>{0.544762671f, 0.949243367f},
-std::array<float,2>{0.717861176f, 0.0236736499f},
-std::array<float,2>{0.207842991f, 0.845321596f},
-std::array<float,2>{0.253570229f, 0.323594511f},
-std::array<float,2>{0.959392786f, 0.540979981f},
-std::array<float,2>{0.793171227f, 0.215216219f},
-std::array<float,2>{0.493022203f, 0.93387562f},
-std::array<float,2>{0.0315318182f, 0.410894364f},
-std::array<float,2>{0.576804936f, 0.6771698f},
-std::array<float,2>{0.679187953f, 0.257425308f},
-std::array<float,2>{0.171994627f, 0.598247886f},
-std::array<float,2>{0.315342486f, 0.0794419944f},
-std::array<float,2>{0.901342571f, 0.770231724f},
-std::array<float,2>{0.966685712f, 0.465906352f},
-std::array<float,2>{0.261979997f, 0.727449536f},
-std::array<float,2>{0.210945621f, 0.1730133f},
-std::array<float,2>{0.70552057f, 0.973861396f},
-std::array<float,2>{0.535640836f, 0.061107561f},
-std::array<float,2>{0.0651313961f, 0.822123051f},
-std::array<float,2>{0.416865498f, 0.36334151f},
-std::array<float,2>{0.843884408f, 0.505233228f},
-std::array<float,2>{0.910705626f, 0.109424822f},
-std::array<float,2>{0.360118717f, 0.811078429f},
-std::array<float,2>{0.140706047f, 0.287680477f},
-std::array<float,2>{0.645587623f, 0.587805927f},
-std::array<float,2>{0.604372025f, 0.385441869f},
-std::array<float,2>{0.0125940125f, 0.62938112f},
-std::array<float,2>{0.443276167f, 0.237193614f},
-std::array<float,2>{0.768114626f, 0.883033752f},
-std::array<float,2>{0.830019832f, 0.317660064f},
-std::array<float,2>{0.387584239f, 0.53494674f},
-std::array<float,2>{0.108895674f, 0.0205888897f},
-std::array<float,2>{0.526461542f, 0.85303241f},
-std::array<float,2>{0.722527444f, 0.143983692f},
-std::array<float,2>{0.228506476f, 0.938098311f},
-std::array<float,2>{0.296281368f, 0.487493724f},
-std::array<float,2>{0.989807844f, 0.692043126f},
-std::array<float,2>{0.869169474f, 0.0146354968f},
-std::array<float,2>{0.429005027f, 0.87283057f},
-std::array<float,2>{0.0792316124f, 0.331450194f},
-std::array<float,2>{0.556718647f, 0.55414325f},
-std::array<float,2>{0.691489875f, 0.47120747f},
-std::array<float,2>{0.192301959f, 0.705206811f},
-std::array<float,2>{0.271760941f, 0.133910775f},
-std::array<float,2>{0.942194998f, 0.96691668f},
-std::array<float,2>{0.886084557f, 0.30369401f},
-std::array<float,2>{0.334764063f, 0.565338552f},
-std::array<float,2>{0.169949353f, 0.107213005f},
-std::array<float,2>{0.666160762f, 0.793576777f},
-std::array<float,2>{0.581086695f, 0.226005346f},
-std::array<float,2>{0.0624867417f, 0.896637321f},
-std::array<float,2>{0.481692523f, 0.39821884f},
-std::array<float,2>{0.7992993f, 0.642809629f},
-std::array<float,2>{0.972968519f, 0.164275959f},
-std::array<float,2>{0.302618057f, 0.991169691f},
-std::array<float,2>{0.24107264f, 0.440469801f},
-std::array<float,2>{0.749316514f, 0.734455526f},
-std::array<float,2>{0.512675226f, 0.358164608f},
-std::array<float,2>{0.124158233f, 0.516567469f},
-std::array<float,2>{0.400629103f, 0.0410378464f},
-std::array<float,2>{0.813227534f, 0.836414874f},
-std::array<float,2>{0.761791587f, 0.429283828f},
-std::array<float,2>{0.46639058f, 0.666475534f},
-std::array<float,2>{0.02856897f, 0.202219009f},
-std::array<float,2>{0.612451732f, 0.916986763f},
-std::array<float,2>{0.625112355f, 0.0652178451f},
-std::array<float,2>{0.133350968f, 0.765192211f},
-std::array<float,2>{0.346300185f, 0.280242026f},
-std::array<float,2>{0.931435943f, 0.61598146f},
-std::array<float,2>{0.756201088f, 0.17631714f},
-std::array<float,2>{0.460303187f, 0.969198346f},
-std::array<float,2>{0.0185484551f, 0.463312596f},
-std::array<float,2>{0.619544268f, 0.732299387f},
-std::array<float,2>{0.640348613f, 0.3612369f},
-std::array<float,2>{0.130604029f, 0.501316726f},
-std::array<float,2>{0.358439267f, 0.0550098792f},
-std::array<float,2>{0.924218178f, 0.825864613f},
-std::array<float,2>{0.977587283f, 0.409575313f},
-std::array<float,2>{0.306232631f, 0.67286253f},
-std::array<float,2>{0.244728878f, 0.212489635f},
-std::array<float,2>{0.737015724f, 0.932893634f},
-std::array<float,2>{0.503233194f, 0.0846046805f},
-std::array<float,2>{0.114155971f, 0.769490659f},
-std::array<float,2>{0.393722534f, 0.250044465f},
-std::array<float,2>{0.823281348f, 0.594698429f},
-std::array<float,2>{0.876951039f, 0.0180300809f},
-std::array<float,2>{0.336333096f, 0.85809505f},
-std::array<float,2>{0.15667142f, 0.315353006f},
-std::array<float,2>{0.660820305f, 0.537949443f},
-std::array<float,2>{0.587912917f, 0.490738064f},
-std::array<float,2>{0.052729018f, 0.688850701f},
-std::array<float,2>{0.47040087f, 0.148012251f},
-std::array<float,2>{0.80722928f, 0.944346368f},
-std::array<float,2>{0.86316967f, 0.28453812f},
-std::array<float,2>{0.430871755f, 0.589938104f},
-std::array<float,2>{0.0896294415f, 0.114116326f},
-std::array<float,2>{0.553049207f, 0.807861984f},
-std::array<float,2>{0.699302256f, 0.239729911f},
-std::array<float,2>{0.202280581f, 0.886850417f},
-std::array<float,2>{0.279250503f, 0.38735947f},
-std::array<float,2>{0.951526642f, 0.626951516f},
-std::array<float,2>{0.837765872f, 0.105158299f},
-std::array<float,2>{0.379595399f, 0.791498721f},
-std::array<float,2>{0.101277761f, 0.29894647f},
-std::array<float,2>{0.519841731f, 0.570015371f},
-std::array<float,2>{0.730870724f, 0.392311901f},
-std::array<float,2>{0.222599402f, 0.645837426f},
-std::array<float,2>{0.283527225f, 0.219601542f},
-std::array<float,2>{0.996778131f, 0.891264975f},
-std::array<float,2>{0.917816758f, 0.332769036f},
-std::array<float,2>{0.370403975f, 0.549336612f},
-std::array<float,2>{0.156139761f, 0.00913406815f},
-std::array<float,2>{0.653342843f, 0.869338036f},
-std::array<float,2>{0.600948989f, 0.140616491f},
-std::array<float,2>{0.00541494507f, 0.962782323f},
-std::array<float,2>{0.446982056f, 0.474561185f},
-std::array<float,2>{0.776884198f, 0.709799707f},
-std::array<float,2>{0.956273019f, 0.197052896f},
-std::array<float,2>{0.255975336f, 0.92135942f},
-std::array<float,2>{0.204266593f, 0.422158957f},
-std::array<float,2>{0.713296056f, 0.669023514f},
-std::array<float,2>{0.541905642f, 0.273612916f},
-std::array<float,2>{0.0780766979f, 0.613043427f},
-std::array<float,2>{0.409477443f, 0.0682829171f},
-std::array<float,2>{0.852201939f, 0.760124981f},
-std::array<float,2>{0.788104296f, 0.441439152f},
-std::array<float,2>{0.4859927f, 0.74018085f},
-std::array<float,2>{0.0422253646f, 0.168759391f},
-std::array<float,2>{0.568459332f, 0.984561265f},
-std::array<float,2>{0.681190252f, 0.0443891063f},
-std::array<float,2>{0.185119137f, 0.842447102f},
-std::array<float,2>{0.325015813f, 0.353580326f},
-std::array<float,2>{0.896650553f, 0.520433068f},
-std::array<float,2>{0.848102629f, 0.230119437f},
-std::array<float,2>{0.420798153f, 0.901974559f},
-std::array<float,2>{0.0674876124f, 0.40454039f},
-std::array<float,2>{0.532746792f, 0.653087795f},
-std::array<float,2>{0.709303617f, 0.304858029f},
-std::array<float,2>{0.215610906f, 0.570604444f},
-std::array<float,2>{0.259066075f, 0.0987810567f},
-std::array<float,2>{0.963851392f, 0.789026618f},
-std::array<float,2>{0.903704882f, 0.48362124f},
-std::array<float,2>{0.319789737f, 0.713012218f},
-std::array<float,2>{0.176653996f, 0.130182415f},
-std::array<float,2>{0.672711313f, 0.959325194f},
-std::array<float,2>{0.573074818f, 0.00684626959f},
-std::array<float,2>{0.0364003032f, 0.864605427f},
-std::array<float,2>{0.499130845f, 0.338969111f},
-std::array<float,2>{0.789440811f, 0.558776736f},
-std::array<float,2>{0.988001704f, 0.0772137493f},
-std::array<float,2>{0.289553344f, 0.750689268f},
-std::array<float,2>{0.234119594f, 0.267518908f},
-std::array<float,2>{0.724645853f, 0.617711902f},
-std::array<float,2>{0.530875206f, 0.434108049f},
-std::array<float,2>{0.101640992f, 0.656497896f},
-std::array<float,2>{0.383528918f, 0.193221956f},
-std::array<float,2>{0.832736313f, 0.910426617f},
-std::array<float,2>{0.770199001f, 0.351436526f},
-std::array<float,2>{0.438385099f, 0.524479508f},
-std::array<float,2>{0.0108538214f, 0.0356673077f},
-std::array<float,2>{0.60746026f, 0.835287392f},
-std::array<float,2>{0.644414008f, 0.161238432f},
-std::array<float,2>{0.146053731f, 0.99772203f},
-std::array<float,2>{0.367012888f, 0.451978505f},
-std::array<float,2>{0.907358646f, 0.74697125f},
-std::array<float,2>{0.801551163f, 0.0469684526f},
-std::array<float,2>{0.478996903f, 0.815209746f},
-std::array<float,2>{0.0556089431f, 0.371209085f},
-std::array<float,2>{0.582498431f, 0.514138639f},
-std::array<float,2>{0.669229746f, 0.460387528f},
-std::array<float,2>{0.166481286f, 0.71957612f},
-std::array<float,2>{0.331883878f, 0.18221949f},
-std::array<float,2>{0.88688916f, 0.977378905f},
-std::array<float,2>{0.938854933f, 0.262479931f},
-std::array<float,2>{0.269176364f, 0.608863533f},
-std::array<float,2>{0.188669115f, 0.0912997425f},
-std::array<float,2>{0.690806389f, 0.780633509f},
-std::array<float,2>{0.560336292f, 0.208236158f},
-std::array<float,2>{0.0857019052f, 0.926184833f},
-std::array<float,2>{0.424116105f, 0.42042011f},
-std::array<float,2>{0.873610735f, 0.681558609f},
-std::array<float,2>{0.936129391f, 0.151572004f},
-std::array<float,2>{0.347918659f, 0.945995986f},
-std::array<float,2>{0.139796361f, 0.497599274f},
-std::array<float,2>{0.631018043f, 0.696600258f},
-std::array<float,2>{0.61667031f, 0.324324608f},
-std::array<float,2>{0.0255145933f, 0.544657469f},
-std::array<float,2>{0.464433998f, 0.0312036183f},
-std::array<float,2>{0.759927273f, 0.848817706f},
-std::array<float,2>{0.819853783f, 0.381695777f},
-std::array<float,2>{0.405981183f, 0.636354148f},
-std::array<float,2>{0.120412625f, 0.24819158f},
-std::array<float,2>{0.509931147f, 0.879270971f},
-std::array<float,2>{0.743850887f, 0.123630337f},
-std::array<float,2>{0.2359882f, 0.803187013f},
-std::array<float,2>{0.297650307f, 0.289703369f},
-std::array<float,2>{0.971861959f, 0.579813361f},
-std::array<float,2>{0.85843122f, 0.155313253f},
-std::array<float,2>{0.411854237f, 0.950273693f},
-std::array<float,2>{0.0734890476f, 0.493180931f},
-std::array<float,2>{0.546732426f, 0.701200187f},
-std::array<float,2>{0.715089023f, 0.322624177f},
-std::array<float,2>{0.210267365f, 0.53921479f},
-std::array<float,2>{0.251952529f, 0.0247198679f},
-std::array<float,2>{0.957215548f, 0.844184875f},
-std::array<float,2>{0.894351363f, 0.377113044f},
-std::array<float,2>{0.323778898f, 0.637963891f},
-std::array<float,2>{0.182884172f, 0.244952381f},
-std::array<float,2>{0.686543286f, 0.87719804f},
-std::array<float,2>{0.565210938f, 0.118821219f},
-std::array<float,2>{0.0467121787f, 0.798845351f},
-std::array<float,2>{0.489242256f, 0.294741392f},
-std::array<float,2>{0.78359288f, 0.583001196f},
-std::array<float,2>{0.995487571f, 0.0545102954f},
-std::array<float,2>{0.285177827f, 0.819329023f},
-std::array<float,2>{0.225011989f, 0.370643377f},
-std::array<float,2>{0.729334176f, 0.509927452f},
-std::array<float,2>{0.516027212f, 0.454643756f},
-std::array<float,2>{0.0958333239f, 0.72579962f},
-std::array<float,2>{0.377793103f, 0.187050387f},
-std::array<float,2>{0.840987384f, 0.981832683f},
-std::array<float,2>{0.780818045f, 0.259908468f},
-std::array<float,2>{0.452607423f, 0.60439074f},
-std::array<float,2>{0.000876865175f, 0.0875524953f},
-std::array<float,2>{0.597396791f, 0.77727586f},
-std::array<float,2>{0.650560558f, 0.203136891f},
-std::array<float,2>{0.150162652f, 0.923228323f},
-std::array<float,2>{0.371562213f, 0.417620778f},
-std::array<float,2>{0.918562174f, 0.684149742f},
-std::array<float,2>{0.810999334f, 0.0734580234f},
-std::array<float,2>{0.474931091f, 0.756528199f},
-std::array<float,2>{0.0486286953f, 0.269774467f},
-std::array<float,2>{0.591140628f, 0.6240502f},
-std::array<float,2>{0.660048127f, 0.430722654f},
-std::array<float,2>{0.163756147f, 0.662692547f},
-std::array<float,2>{0.340858817f, 0.187883139f},
-std::array<float,2>{0.881869853f, 0.908278108f},
-std::array<float,2>{0.945320189f, 0.345343679f},
-std::array<float,2>{0.276270628f, 0.528781354f},
-std::array<float,2>{0.198587209f, 0.0328752138f},
-std::array<float,2>{0.696510375f, 0.831684589f},
-std::array<float,2>{0.549034536f, 0.159417093f},
-std::array<float,2>{0.0900110677f, 0.995689094f},
-std::array<float,2>{0.436826378f, 0.447938532f},
-std::array<float,2>{0.863907754f, 0.745116651f},
-std::array<float,2>{0.927933455f, 0.232564539f},
-std::array<float,2>{0.353864342f, 0.903502882f},
-std::array<float,2>{0.125765711f, 0.401598036f},
-std::array<float,2>{0.63524425f, 0.649591267f},
-std::array<float,2>{0.621406019f, 0.309174776f},
-std::array<float,2>{0.0206209347f, 0.574340403f},
-std::array<float,2>{0.455997467f, 0.0959732234f},
-std::array<float,2>{0.752001822f, 0.784968376f},
-std::array<float,2>{0.825920582f, 0.479293704f},
-std::array<float,2>{0.395898163f, 0.715603888f},
-std::array<float,2>{0.112411104f, 0.126580983f},
-std::array<float,2>{0.504065633f, 0.95392406f},
-std::array<float,2>{0.74148792f, 0.00305535598f},
-std::array<float,2>{0.247471392f, 0.85950321f},
-std::array<float,2>{0.310256153f, 0.342863113f},
-std::array<float,2>{0.983639359f, 0.55489397f},
-std::array<float,2>{0.764249861f, 0.20195049f},
-std::array<float,2>{0.467268735f, 0.917844176f},
-std::array<float,2>{0.0298650898f, 0.428003103f},
-std::array<float,2>{0.609872341f, 0.66768074f},
-std::array<float,2>{0.628339946f, 0.280859917f},
-std::array<float,2>{0.135901242f, 0.617132545f},
-std::array<float,2>{0.345063865f, 0.0661910698f},
-std::array<float,2>{0.932041526f, 0.764447331f},
-std::array<float,2>{0.976341724f, 0.440384686f},
-std::array<float,2>{0.303075939f, 0.736081421f},
-std::array<float,2>{0.23973532f, 0.165504277f},
-std::array<float,2>{0.746602952f, 0.991754591f},
-std::array<float,2>{0.514934421f, 0.0421913788f},
-std::array<float,2>{0.122335583f, 0.837278664f},
-std::array<float,2>{0.399201542f, 0.358555377f},
-std::array<float,2>{0.815775394f, 0.517144501f},
-std::array<float,2>{0.883789897f, 0.106314965f},
-std::array<float,2>{0.333225906f, 0.794891298f},
-std::array<float,2>{0.169397444f, 0.303960413f},
-std::array<float,2>{0.665290952f, 0.565746546f},
-std::array<float,2>{0.57944721f, 0.396583557f},
-std::array<float,2>{0.058763478f, 0.643830597f},
-std::array<float,2>{0.483220935f, 0.225406453f},
-std::array<float,2>{0.796977103f, 0.897922754f},
-std::array<float,2>{0.868552506f, 0.330185294f},
-std::array<float,2>{0.425919354f, 0.553505123f},
-std::array<float,2>{0.0801534578f, 0.0155797461f},
-std::array<float,2>{0.555747926f, 0.87177968f},
-std::array<float,2>{0.694229543f, 0.133624971f},
-std::array<float,2>{0.194542989f, 0.968397975f},
-std::array<float,2>{0.270256758f, 0.472625434f},
-std::array<float,2>{0.944969237f, 0.706544816f},
-std::array<float,2>{0.830558598f, 0.0198333301f},
-std::array<float,2>{0.389381498f, 0.852310598f},
-std::array<float,2>{0.107248627f, 0.31737572f},
-std::array<float,2>{0.523777246f, 0.534052551f},
-std::array<float,2>{0.720558643f, 0.486651421f},
-std::array<float,2>{0.228822291f, 0.692778111f},
-std::array<float,2>{0.294901669f, 0.142983988f},
-std::array<float,2>{0.992052376f, 0.939352632f},
-std::array<float,2>{0.91319412f, 0.288468152f},
-std::array<float,2>{0.362439007f, 0.586666107f},
-std::array<float,2>{0.144001201f, 0.11058633f},
-std::array<float,2>{0.646642208f, 0.811919868f},
-std::array<float,2>{0.602884293f, 0.237707034f},
-std::array<float,2>{0.0140932603f, 0.884374022f},
-std::array<float,2>{0.445037782f, 0.38664639f},
-std::array<float,2>{0.766356409f, 0.63071388f},
-std::array<float,2>{0.967281342f, 0.172679767f},
-std::array<float,2>{0.264942467f, 0.973216116f},
-std::array<float,2>{0.214376256f, 0.465020746f},
-std::array<float,2>{0.704336941f, 0.728186011f},
-std::array<float,2>{0.537557602f, 0.364434123f},
-std::array<float,2>{0.0626183525f, 0.504227042f},
-std::array<float,2>{0.414697081f, 0.0624659546f},
-std::array<float,2>{0.847388864f, 0.820347428f},
-std::array<float,2>{0.794958413f, 0.411751002f},
-std::array<float,2>{0.494898945f, 0.676254153f},
-std::array<float,2>{0.0336045362f, 0.215941429f},
-std::array<float,2>{0.575728357f, 0.934576571f},
-std::array<float,2>{0.677093208f, 0.0784740821f},
-std::array<float,2>{0.175163791f, 0.771335363f},
-std::array<float,2>{0.312930167f, 0.256453484f},
-std::array<float,2>{0.899815559f, 0.598749518f},
-std::array<float,2>{0.785186172f, 0.169808745f},
-std::array<float,2>{0.486489505f, 0.985542476f},
-std::array<float,2>{0.040612217f, 0.442862928f},
-std::array<float,2>{0.567868114f, 0.738957405f},
-std::array<float,2>{0.683429599f, 0.35454911f},
-std::array<float,2>{0.185745239f, 0.521467984f},
-std::array<float,2>{0.327490598f, 0.0433242992f},
-std::array<float,2>{0.894966066f, 0.843689442f},
-std::array<float,2>{0.953967273f, 0.423097253f},
-std::array<float,2>{0.254184067f, 0.668485045f},
-std::array<float,2>{0.205679163f, 0.195745513f},
-std::array<float,2>{0.711089611f, 0.920699716f},
-std::array<float,2>{0.540970504f, 0.0671476275f},
-std::array<float,2>{0.0750153735f, 0.76113826f},
-std::array<float,2>{0.40816921f, 0.274778157f},
-std::array<float,2>{0.853916407f, 0.611654997f},
-std::array<float,2>{0.915203929f, 0.00853644591f},
-std::array<float,2>{0.368840516f, 0.870677769f},
-std::array<float,2>{0.152695864f, 0.333488643f},
-std::array<float,2>{0.656049013f, 0.549941361f},
-std::array<float,2>{0.59946239f, 0.473098189f},
-std::array<float,2>{0.00666246377f, 0.71068418f},
-std::array<float,2>{0.448476642f, 0.139114648f},
-std::array<float,2>{0.775146127f, 0.961097538f},
-std::array<float,2>{0.838277102f, 0.300310165f},
-std::array<float,2>{0.381643683f, 0.568821967f},
-std::array<float,2>{0.0976573676f, 0.104295284f},
-std::array<float,2>{0.523028135f, 0.792086422f},
-std::array<float,2>{0.734237611f, 0.220097616f},
-std::array<float,2>{0.219254658f, 0.891880691f},
-std::array<float,2>{0.28302145f, 0.391107917f},
-std::array<float,2>{0.99805367f, 0.645047903f},
-std::array<float,2>{0.859985113f, 0.114493966f},
-std::array<float,2>{0.431761771f, 0.806990802f},
-std::array<float,2>{0.0862075835f, 0.283784121f},
-std::array<float,2>{0.550988138f, 0.590821326f},
-std::array<float,2>{0.701374948f, 0.388266146f},
-std::array<float,2>{0.201061636f, 0.625385463f},
-std::array<float,2>{0.280682474f, 0.238934025f},
-std::array<float,2>{0.950557649f, 0.888066709f},
-std::array<float,2>{0.878585577f, 0.315845042f},
-std::array<float,2>{0.338464469f, 0.53874737f},
-std::array<float,2>{0.159541368f, 0.0189097915f},
-std::array<float,2>{0.662526011f, 0.859135509f},
-std::array<float,2>{0.587072015f, 0.146529526f},
-std::array<float,2>{0.0540828258f, 0.943856478f},
-std::array<float,2>{0.472602576f, 0.491668493f},
-std::array<float,2>{0.804792702f, 0.688024044f},
-std::array<float,2>{0.979795694f, 0.211277559f},
-std::array<float,2>{0.306783527f, 0.932355225f},
-std::array<float,2>{0.243908092f, 0.408623993f},
-std::array<float,2>{0.735419571f, 0.672227979f},
-std::array<float,2>{0.500762403f, 0.251056403f},
-std::array<float,2>{0.116811708f, 0.595239818f},
-std::array<float,2>{0.391103685f, 0.0856539756f},
-std::array<float,2>{0.8210783f, 0.767994463f},
-std::array<float,2>{0.753986418f, 0.464506239f},
-std::array<float,2>{0.458483458f, 0.731078565f},
-std::array<float,2>{0.0157680884f, 0.177189082f},
-std::array<float,2>{0.617266774f, 0.970420897f},
-std::array<float,2>{0.6380831f, 0.0558956712f},
-std::array<float,2>{0.131039053f, 0.824645221f},
-std::array<float,2>{0.355566472f, 0.359928966f},
-std::array<float,2>{0.923542857f, 0.500067115f},
-std::array<float,2>{0.818212926f, 0.249763623f},
-std::array<float,2>{0.4027659f, 0.880767584f},
-std::array<float,2>{0.117642283f, 0.382543474f},
-std::array<float,2>{0.508804858f, 0.635250211f},
-std::array<float,2>{0.745998681f, 0.290426731f},
-std::array<float,2>{0.236685738f, 0.578716099f},
-std::array<float,2>{0.300002456f, 0.124556229f},
-std::array<float,2>{0.970268548f, 0.804626584f},
-std::array<float,2>{0.933852196f, 0.496776283f},
-std::array<float,2>{0.349961132f, 0.695569038f},
-std::array<float,2>{0.137307838f, 0.150903866f},
-std::array<float,2>{0.630010843f, 0.946583629f},
-std::array<float,2>{0.613932908f, 0.0296818707f},
-std::array<float,2>{0.0237381402f, 0.848302245f},
-std::array<float,2>{0.461818606f, 0.325780779f},
-std::array<float,2>{0.758109748f, 0.543082416f},
-std::array<float,2>{0.940475821f, 0.0907954648f},
-std::array<float,2>{0.267259538f, 0.780139506f},
-std::array<float,2>{0.190941542f, 0.262696534f},
-std::array<float,2>{0.689147949f, 0.608348668f},
-std::array<float,2>{0.562418938f, 0.421729565f},
-std::array<float,2>{0.0838181525f, 0.680261672f},
-std::array<float,2>{0.42268309f, 0.207655594f},
-std::array<float,2>{0.872238338f, 0.926867425f},
-std::array<float,2>{0.803296685f, 0.37291643f},
-std::array<float,2>{0.476625383f, 0.515445709f},
-std::array<float,2>{0.0583073199f, 0.047997918f},
-std::array<float,2>{0.585299551f, 0.816251636f},
-std::array<float,2>{0.671426177f, 0.183371261f},
-std::array<float,2>{0.164656594f, 0.977844775f},
-std::array<float,2>{0.329772592f, 0.459907979f},
-std::array<float,2>{0.889497519f, 0.719753861f},
-std::array<float,2>{0.773113549f, 0.0364212021f},
-std::array<float,2>{0.440751672f, 0.834070504f},
-std::array<float,2>{0.00822158717f, 0.349628627f},
-std::array<float,2>{0.606453776f, 0.523833752f},
-std::array<float,2>{0.640634298f, 0.452264339f},
-std::array<float,2>{0.148347184f, 0.747127831f},
-std::array<float,2>{0.36365658f, 0.160288975f},
-std::array<float,2>{0.909160852f, 0.99679333f},
-std::array<float,2>{0.985833347f, 0.265915841f},
-std::array<float,2>{0.292926908f, 0.618601441f},
-std::array<float,2>{0.230473623f, 0.077062577f},
-std::array<float,2>{0.723337889f, 0.750991762f},
-std::array<float,2>{0.529256403f, 0.191633612f},
-std::array<float,2>{0.104050912f, 0.911513627f},
-std::array<float,2>{0.385524869f, 0.434981763f},
-std::array<float,2>{0.834686399f, 0.657253802f},
-std::array<float,2>{0.904363275f, 0.129486412f},
-std::array<float,2>{0.316851288f, 0.960359931f},
-std::array<float,2>{0.178062931f, 0.483094126f},
-std::array<float,2>{0.673909962f, 0.714224696f},
-std::array<float,2>{0.570735812f, 0.338608593f},
-std::array<float,2>{0.0380404852f, 0.560544729f},
-std::array<float,2>{0.497545093f, 0.00636875164f},
-std::array<float,2>{0.791148186f, 0.863421142f},
-std::array<float,2>{0.851369321f, 0.406076342f},
-std::array<float,2>{0.419760525f, 0.653523862f},
-std::array<float,2>{0.068383798f, 0.228688329f},
-std::array<float,2>{0.534718573f, 0.900713027f},
-std::array<float,2>{0.707757652f, 0.0978253484f},
-std::array<float,2>{0.216836557f, 0.787565827f},
-std::array<float,2>{0.260205239f, 0.306042165f},
-std::array<float,2>{0.96254462f, 0.571649849f},
-std::array<float,2>{0.843055546f, 0.185326174f},
-std::array<float,2>{0.375910163f, 0.984051883f},
-std::array<float,2>{0.0938552991f, 0.45604533f},
-std::array<float,2>{0.517850101f, 0.723770261f},
-std::array<float,2>{0.727481842f, 0.368941754f},
-std::array<float,2>{0.223594442f, 0.508280277f},
-std::array<float,2>{0.288607359f, 0.0518444888f},
-std::array<float,2>{0.992643833f, 0.816749454f},
-std::array<float,2>{0.920860648f, 0.414659292f},
-std::array<float,2>{0.374312013f, 0.685862362f},
-std::array<float,2>{0.151560828f, 0.206560239f},
-std::array<float,2>{0.649734974f, 0.924440205f},
-std::array<float,2>{0.594587147f, 0.0895144045f},
-std::array<float,2>{0.00367751881f, 0.774199307f},
-std::array<float,2>{0.449326456f, 0.259064466f},
-std::array<float,2>{0.778506041f, 0.60341686f},
-std::array<float,2>{0.960404396f, 0.0261154678f},
-std::array<float,2>{0.252119988f, 0.845768273f},
-std::array<float,2>{0.208028436f, 0.320951968f},
-std::array<float,2>{0.71761328f, 0.542248189f},
-std::array<float,2>{0.54343313f, 0.496062607f},
-std::array<float,2>{0.0722470805f, 0.700377882f},
-std::array<float,2>{0.412270844f, 0.152408913f},
-std::array<float,2>{0.856431484f, 0.952670991f},
-std::array<float,2>{0.782736778f, 0.295944691f},
-std::array<float,2>{0.491735876f, 0.584971547f},
-std::array<float,2>{0.0431082621f, 0.120418027f},
-std::array<float,2>{0.564122558f, 0.797677875f},
-std::array<float,2>{0.685531139f, 0.243197203f},
-std::array<float,2>{0.180502012f, 0.875349104f},
-std::array<float,2>{0.321012139f, 0.376507461f},
-std::array<float,2>{0.891293883f, 0.63939625f},
-std::array<float,2>{0.751283288f, 0.0940266177f},
-std::array<float,2>{0.453328401f, 0.781263411f},
-std::array<float,2>{0.0217698291f, 0.312478989f},
-std::array<float,2>{0.623496115f, 0.576456368f},
-std::array<float,2>{0.633744359f, 0.399478167f},
-std::array<float,2>{0.127994046f, 0.651106894f},
-std::array<float,2>{0.352716744f, 0.232120797f},
-std::array<float,2>{0.926516593f, 0.904808044f},
-std::array<float,2>{0.980859101f, 0.340911895f},
-std::array<float,2>{0.311666608f, 0.557390511f},
-std::array<float,2>{0.249819547f, 0.00150074647f},
-std::array<float,2>{0.738925397f, 0.863197684f},
-std::array<float,2>{0.506208003f, 0.127589151f},
-std::array<float,2>{0.110814266f, 0.956065714f},
-std::array<float,2>{0.397230327f, 0.478105575f},
-std::array<float,2>{0.826880574f, 0.717980921f},
-std::array<float,2>{0.880552292f, 0.190719888f},
-std::array<float,2>{0.342103481f, 0.906546474f},
-std::array<float,2>{0.16075781f, 0.432459176f},
-std::array<float,2>{0.657296658f, 0.660444975f},
-std::array<float,2>{0.59375f, 0.272981822f},
-std::array<float,2>{0.0503757931f, 0.621387959f},
-std::array<float,2>{0.473627508f, 0.0720598549f},
-std::array<float,2>{0.810416877f, 0.755665004f},
-std::array<float,2>{0.865753293f, 0.447160035f},
-std::array<float,2>{0.434671193f, 0.742726207f},
-std::array<float,2>{0.093278341f, 0.158120722f},
-std::array<float,2>{0.548503637f, 0.993232012f},
-std::array<float,2>{0.698395133f, 0.0342634507f},
-std::array<float,2>{0.196068317f, 0.829517841f},
-std::array<float,2>{0.273517519f, 0.346862137f},
-std::array<float,2>{0.947282016f, 0.529843986f},
-std::array<float,2>{0.800044775f, 0.223618984f},
-std::array<float,2>{0.480980366f, 0.895420313f},
-std::array<float,2>{0.0607821532f, 0.395039707f},
-std::array<float,2>{0.580513597f, 0.641399741f},
-std::array<float,2>{0.667664587f, 0.301820934f},
-std::array<float,2>{0.171535373f, 0.563215554f},
-std::array<float,2>{0.335522592f, 0.108481772f},
-std::array<float,2>{0.885411501f, 0.795062661f},
-std::array<float,2>{0.943194389f, 0.470086634f},
-std::array<float,2>{0.272710949f, 0.704585254f},
-std::array<float,2>{0.192553759f, 0.136476472f},
-std::array<float,2>{0.692459702f, 0.965687573f},
-std::array<float,2>{0.558349907f, 0.0126300044f},
-std::array<float,2>{0.0789235607f, 0.87485522f},
-std::array<float,2>{0.428147644f, 0.328421444f},
-std::array<float,2>{0.870140314f, 0.55150795f},
-std::array<float,2>{0.93066144f, 0.0629774109f},
-std::array<float,2>{0.346713871f, 0.763520658f},
-std::array<float,2>{0.134009331f, 0.277916521f},
-std::array<float,2>{0.62601316f, 0.613423467f},
-std::array<float,2>{0.612228811f, 0.42720142f},
-std::array<float,2>{0.0273943357f, 0.665354311f},
-std::array<float,2>{0.465519786f, 0.199263722f},
-std::array<float,2>{0.762827575f, 0.915211678f},
-std::array<float,2>{0.814452946f, 0.356307149f},
-std::array<float,2>{0.401522279f, 0.517633677f},
-std::array<float,2>{0.123472244f, 0.0401013196f},
-std::array<float,2>{0.513408542f, 0.838909447f},
-std::array<float,2>{0.748441398f, 0.166023672f},
-std::array<float,2>{0.241791651f, 0.990233004f},
-std::array<float,2>{0.301482081f, 0.438433826f},
-std::array<float,2>{0.974568367f, 0.737608135f},
-std::array<float,2>{0.845505059f, 0.0596662052f},
-std::array<float,2>{0.41752705f, 0.822448552f},
-std::array<float,2>{0.0656471699f, 0.365464389f},
-std::array<float,2>{0.536548138f, 0.506509781f},
-std::array<float,2>{0.706304491f, 0.468225807f},
-std::array<float,2>{0.211968198f, 0.728613973f},
-std::array<float,2>{0.263449103f, 0.174613476f},
-std::array<float,2>{0.965222657f, 0.976533234f},
-std::array<float,2>{0.901404738f, 0.25452137f},
-std::array<float,2>{0.316276342f, 0.599925697f},
-std::array<float,2>{0.172999814f, 0.0801496357f},
-std::array<float,2>{0.678154945f, 0.772172928f},
-std::array<float,2>{0.577879548f, 0.216871351f},
-std::array<float,2>{0.032812044f, 0.936643064f},
-std::array<float,2>{0.493217885f, 0.413385481f},
-std::array<float,2>{0.794614494f, 0.679652691f},
-std::array<float,2>{0.989171505f, 0.141313031f},
-std::array<float,2>{0.29556939f, 0.940416574f},
-std::array<float,2>{0.226614401f, 0.486243248f},
-std::array<float,2>{0.721158147f, 0.69432652f},
-std::array<float,2>{0.52599144f, 0.319987923f},
-std::array<float,2>{0.107513264f, 0.532514513f},
-std::array<float,2>{0.38836953f, 0.022727292f},
-std::array<float,2>{0.828935444f, 0.854714632f},
-std::array<float,2>{0.768614829f, 0.382974863f},
-std::array<float,2>{0.441576689f, 0.632227004f},
-std::array<float,2>{0.0133420993f, 0.235812366f},
-std::array<float,2>{0.604626596f, 0.885915935f},
-std::array<float,2>{0.644834936f, 0.11233221f},
-std::array<float,2>{0.141719848f, 0.810210645f},
-std::array<float,2>{0.361113936f, 0.28581664f},
-std::array<float,2>{0.911851227f, 0.589326918f},
-std::array<float,2>{0.776338637f, 0.136864573f},
-std::array<float,2>{0.446244001f, 0.963977218f},
-std::array<float,2>{0.00391391153f, 0.474958539f},
-std::array<float,2>{0.600220263f, 0.708014786f},
-std::array<float,2>{0.652573347f, 0.334162354f},
-std::array<float,2>{0.155090496f, 0.548300624f},
-std::array<float,2>{0.369914621f, 0.0101355175f},
-std::array<float,2>{0.916434467f, 0.867326617f},
-std::array<float,2>{0.997923791f, 0.39427945f},
-std::array<float,2>{0.284854114f, 0.646590829f},
-std::array<float,2>{0.220967665f, 0.221481159f},
-std::array<float,2>{0.73177141f, 0.892856956f},
-std::array<float,2>{0.520594597f, 0.103102989f},
-std::array<float,2>{0.100354895f, 0.78914088f},
-std::array<float,2>{0.380078673f, 0.297558755f},
-std::array<float,2>{0.836370587f, 0.567485929f},
-std::array<float,2>{0.897979319f, 0.0466871113f},
-std::array<float,2>{0.325537264f, 0.841603637f},
-std::array<float,2>{0.183770075f, 0.352886319f},
-std::array<float,2>{0.679840088f, 0.522087932f},
-std::array<float,2>{0.569678247f, 0.443949431f},
-std::array<float,2>{0.0412114561f, 0.740887523f},
-std::array<float,2>{0.485003054f, 0.171579972f},
-std::array<float,2>{0.787347555f, 0.988157928f},
-std::array<float,2>{0.852748156f, 0.275627494f},
-std::array<float,2>{0.408366799f, 0.609927535f},
-std::array<float,2>{0.0769209489f, 0.0690129548f},
-std::array<float,2>{0.542291999f, 0.75813365f},
-std::array<float,2>{0.71456933f, 0.198002756f},
-std::array<float,2>{0.20397447f, 0.918742537f},
-std::array<float,2>{0.256945968f, 0.425769746f},
-std::array<float,2>{0.955394268f, 0.670212924f},
-std::array<float,2>{0.822949529f, 0.0826915503f},
-std::array<float,2>{0.39336893f, 0.765983999f},
-std::array<float,2>{0.114551976f, 0.252126157f},
-std::array<float,2>{0.502643824f, 0.597415447f},
-std::array<float,2>{0.738067687f, 0.407888263f},
-std::array<float,2>{0.245427206f, 0.673879564f},
-std::array<float,2>{0.304905027f, 0.213555589f},
-std::array<float,2>{0.976643384f, 0.930249751f},
-std::array<float,2>{0.925654292f, 0.362138689f},
-std::array<float,2>{0.357999861f, 0.50285989f},
-std::array<float,2>{0.129308894f, 0.0577914305f},
-std::array<float,2>{0.639617562f, 0.828047276f},
-std::array<float,2>{0.620215893f, 0.178610027f},
-std::array<float,2>{0.0188164245f, 0.971547604f},
-std::array<float,2>{0.459022969f, 0.461018533f},
-std::array<float,2>{0.756911874f, 0.732833564f},
-std::array<float,2>{0.952474415f, 0.240667894f},
-std::array<float,2>{0.27767396f, 0.890399754f},
-std::array<float,2>{0.201993808f, 0.390186578f},
-std::array<float,2>{0.700974822f, 0.627795279f},
-std::array<float,2>{0.554558396f, 0.282308519f},
-std::array<float,2>{0.0883156657f, 0.59367013f},
-std::array<float,2>{0.429730922f, 0.115517229f},
-std::array<float,2>{0.862016201f, 0.805786729f},
-std::array<float,2>{0.808130443f, 0.488581121f},
-std::array<float,2>{0.468949199f, 0.689827561f},
-std::array<float,2>{0.0509254783f, 0.144980833f},
-std::array<float,2>{0.589376569f, 0.942786157f},
-std::array<float,2>{0.661135554f, 0.0172116403f},
-std::array<float,2>{0.157437831f, 0.855584383f},
-std::array<float,2>{0.337129205f, 0.313720375f},
-std::array<float,2>{0.875568211f, 0.53653425f},
-std::array<float,2>{0.874483824f, 0.210562214f},
-std::array<float,2>{0.425431997f, 0.928377867f},
-std::array<float,2>{0.0847083405f, 0.419178665f},
-std::array<float,2>{0.559558392f, 0.682249069f},
-std::array<float,2>{0.690175533f, 0.263912767f},
-std::array<float,2>{0.187812418f, 0.605542243f},
-std::array<float,2>{0.26850903f, 0.0917995349f},
-std::array<float,2>{0.937689602f, 0.778183877f},
-std::array<float,2>{0.888489544f, 0.457419544f},
-std::array<float,2>{0.330943733f, 0.720962584f},
-std::array<float,2>{0.167943582f, 0.180080876f},
-std::array<float,2>{0.668304205f, 0.980345905f},
-std::array<float,2>{0.583860695f, 0.0489632897f},
-std::array<float,2>{0.0556945093f, 0.812747478f},
-std::array<float,2>{0.48033753f, 0.373300791f},
-std::array<float,2>{0.801783323f, 0.512652636f},
-std::array<float,2>{0.971608579f, 0.121832587f},
-std::array<float,2>{0.298058301f, 0.80219382f},
-std::array<float,2>{0.234586343f, 0.291456759f},
-std::array<float,2>{0.743004024f, 0.581412196f},
-std::array<float,2>{0.511222541f, 0.38022849f},
-std::array<float,2>{0.119436435f, 0.63304311f},
-std::array<float,2>{0.404607445f, 0.247765854f},
-std::array<float,2>{0.818407595f, 0.881937265f},
-std::array<float,2>{0.761229038f, 0.327304125f},
-std::array<float,2>{0.463340253f, 0.545656443f},
-std::array<float,2>{0.0267162062f, 0.0276048705f},
-std::array<float,2>{0.615836382f, 0.850814641f},
-std::array<float,2>{0.632359147f, 0.149457633f},
-std::array<float,2>{0.13952817f, 0.94791007f},
-std::array<float,2>{0.34902221f, 0.499791086f},
-std::array<float,2>{0.936896503f, 0.698930323f},
-std::array<float,2>{0.790678859f, 0.00457577733f},
-std::array<float,2>{0.498154908f, 0.866432428f},
-std::array<float,2>{0.0358703621f, 0.336918771f},
-std::array<float,2>{0.573386788f, 0.561799824f},
-std::array<float,2>{0.672973514f, 0.482295424f},
-std::array<float,2>{0.177017868f, 0.712477982f},
-std::array<float,2>{0.318920255f, 0.132432222f},
-std::array<float,2>{0.902441084f, 0.958494246f},
-std::array<float,2>{0.964208305f, 0.307317495f},
-std::array<float,2>{0.258670896f, 0.572740495f},
-std::array<float,2>{0.216264635f, 0.100517683f},
-std::array<float,2>{0.710564435f, 0.78634274f},
-std::array<float,2>{0.531642675f, 0.227361187f},
-std::array<float,2>{0.0673366934f, 0.899021208f},
-std::array<float,2>{0.421813577f, 0.402563363f},
-std::array<float,2>{0.849466145f, 0.655072153f},
-std::array<float,2>{0.907219529f, 0.163195416f},
-std::array<float,2>{0.365868151f, 0.99861306f},
-std::array<float,2>{0.144899368f, 0.450439274f},
-std::array<float,2>{0.642602444f, 0.748154223f},
-std::array<float,2>{0.609232664f, 0.349494398f},
-std::array<float,2>{0.0106118117f, 0.526279032f},
-std::array<float,2>{0.438621163f, 0.0387875438f},
-std::array<float,2>{0.771396995f, 0.833672225f},
-std::array<float,2>{0.833843172f, 0.437343925f},
-std::array<float,2>{0.38407895f, 0.658236444f},
-std::array<float,2>{0.103427708f, 0.194014579f},
-std::array<float,2>{0.530013442f, 0.913638294f},
-std::array<float,2>{0.725716174f, 0.0755064711f},
-std::array<float,2>{0.233065993f, 0.751980484f},
-std::array<float,2>{0.290063888f, 0.26884833f},
-std::array<float,2>{0.986785948f, 0.620437443f},
-std::array<float,2>{0.846882641f, 0.173968121f},
-std::array<float,2>{0.414343208f, 0.975744784f},
-std::array<float,2>{0.0630933344f, 0.468535423f},
-std::array<float,2>{0.537950039f, 0.729373932f},
-std::array<float,2>{0.705022991f, 0.365940332f},
-std::array<float,2>{0.214215159f, 0.506297529f},
-std::array<float,2>{0.265200227f, 0.0600967146f},
-std::array<float,2>{0.967701435f, 0.822786033f},
-std::array<float,2>{0.900243878f, 0.413850397f},
-std::array<float,2>{0.313186407f, 0.678786397f},
-std::array<float,2>{0.175720632f, 0.217541918f},
-std::array<float,2>{0.677365124f, 0.937318265f},
-std::array<float,2>{0.575525463f, 0.0810039937f},
-std::array<float,2>{0.0338925682f, 0.771537781f},
-std::array<float,2>{0.494227231f, 0.253961325f},
-std::array<float,2>{0.795464814f, 0.600532293f},
-std::array<float,2>{0.991225302f, 0.0230786111f},
-std::array<float,2>{0.293996215f, 0.855268359f},
-std::array<float,2>{0.229481235f, 0.319669873f},
-std::array<float,2>{0.720137775f, 0.533045232f},
-std::array<float,2>{0.524174035f, 0.485385686f},
-std::array<float,2>{0.106474601f, 0.693445563f},
-std::array<float,2>{0.388897091f, 0.140968889f},
-std::array<float,2>{0.830592573f, 0.939786732f},
-std::array<float,2>{0.765960276f, 0.285222262f},
-std::array<float,2>{0.444441617f, 0.589592695f},
-std::array<float,2>{0.0142541295f, 0.113004334f},
-std::array<float,2>{0.603414357f, 0.809842706f},
-std::array<float,2>{0.647362947f, 0.235944986f},
-std::array<float,2>{0.144128129f, 0.886688709f},
-std::array<float,2>{0.363060862f, 0.383485466f},
-std::array<float,2>{0.914047062f, 0.632468224f},
-std::array<float,2>{0.797659099f, 0.109060772f},
-std::array<float,2>{0.482852668f, 0.795496881f},
-std::array<float,2>{0.0595592894f, 0.302562505f},
-std::array<float,2>{0.579665482f, 0.562656581f},
-std::array<float,2>{0.665985584f, 0.394687116f},
-std::array<float,2>{0.169680446f, 0.640765727f},
-std::array<float,2>{0.333599478f, 0.223070771f},
-std::array<float,2>{0.88476038f, 0.894957125f},
-std::array<float,2>{0.944683433f, 0.329054773f},
-std::array<float,2>{0.269917667f, 0.55121392f},
-std::array<float,2>{0.194846645f, 0.012010918f},
-std::array<float,2>{0.693651199f, 0.87416923f},
-std::array<float,2>{0.556225061f, 0.13609913f},
-std::array<float,2>{0.0808986947f, 0.965078235f},
-std::array<float,2>{0.426422805f, 0.470528722f},
-std::array<float,2>{0.86889869f, 0.704778314f},
-std::array<float,2>{0.932539999f, 0.199881911f},
-std::array<float,2>{0.345595121f, 0.915991485f},
-std::array<float,2>{0.136685908f, 0.42740041f},
-std::array<float,2>{0.628537595f, 0.665651977f},
-std::array<float,2>{0.609491467f, 0.277631849f},
-std::array<float,2>{0.0295085199f, 0.614206135f},
-std::array<float,2>{0.46753338f, 0.0631809607f},
-std::array<float,2>{0.764129281f, 0.762992024f},
-std::array<float,2>{0.81597805f, 0.437548012f},
-std::array<float,2>{0.39870435f, 0.738264143f},
-std::array<float,2>{0.122862875f, 0.166779414f},
-std::array<float,2>{0.51531738f, 0.989584386f},
-std::array<float,2>{0.746188879f, 0.0406619944f},
-std::array<float,2>{0.240038216f, 0.839710534f},
-std::array<float,2>{0.303563237f, 0.355923355f},
-std::array<float,2>{0.976042747f, 0.518275857f},
-std::array<float,2>{0.752507627f, 0.231508553f},
-std::array<float,2>{0.455561042f, 0.904700577f},
-std::array<float,2>{0.0213455688f, 0.399944812f},
-std::array<float,2>{0.621711075f, 0.650537908f},
-std::array<float,2>{0.635434091f, 0.311788708f},
-std::array<float,2>{0.125191495f, 0.577114642f},
-std::array<float,2>{0.354017973f, 0.0945847258f},
-std::array<float,2>{0.928238153f, 0.782151639f},
-std::array<float,2>{0.984198391f, 0.477860719f},
-std::array<float,2>{0.3098571f, 0.718308985f},
-std::array<float,2>{0.248011112f, 0.127003267f},
-std::array<float,2>{0.74180609f, 0.956944108f},
-std::array<float,2>{0.504752457f, 0.00117223442f},
-std::array<float,2>{0.112812638f, 0.862392783f},
-std::array<float,2>{0.396308273f, 0.341636926f},
-std::array<float,2>{0.825293481f, 0.556770921f},
-std::array<float,2>{0.882602096f, 0.0716144443f},
-std::array<float,2>{0.341373056f, 0.754924297f},
-std::array<float,2>{0.163254097f, 0.272792578f},
-std::array<float,2>{0.659457326f, 0.62202692f},
-std::array<float,2>{0.591520727f, 0.431641668f},
-std::array<float,2>{0.0479660779f, 0.660880506f},
-std::array<float,2>{0.475575358f, 0.191340387f},
-std::array<float,2>{0.811248064f, 0.90716958f},
-std::array<float,2>{0.863643706f, 0.34720549f},
-std::array<float,2>{0.437158525f, 0.529584765f},
-std::array<float,2>{0.0908171609f, 0.0347015187f},
-std::array<float,2>{0.549517155f, 0.830036342f},
-std::array<float,2>{0.696845412f, 0.157603472f},
-std::array<float,2>{0.198797226f, 0.993913293f},
-std::array<float,2>{0.275707722f, 0.446771324f},
-std::array<float,2>{0.945842981f, 0.742623806f},
-std::array<float,2>{0.841502905f, 0.0525448434f},
-std::array<float,2>{0.377103806f, 0.817287147f},
-std::array<float,2>{0.0966715813f, 0.368339062f},
-std::array<float,2>{0.516157627f, 0.508533776f},
-std::array<float,2>{0.728758872f, 0.455441773f},
-std::array<float,2>{0.22510165f, 0.724601269f},
-std::array<float,2>{0.285908431f, 0.184923291f},
-std::array<float,2>{0.996045947f, 0.983672082f},
-std::array<float,2>{0.918340385f, 0.259473264f},
-std::array<float,2>{0.371602476f, 0.602775514f},
-std::array<float,2>{0.149416521f, 0.0891300067f},
-std::array<float,2>{0.650999427f, 0.773752928f},
-std::array<float,2>{0.597041368f, 0.206109971f},
-std::array<float,2>{0.000186911158f, 0.923972309f},
-std::array<float,2>{0.452725083f, 0.414494276f},
-std::array<float,2>{0.780613601f, 0.686213732f},
-std::array<float,2>{0.957668245f, 0.152891144f},
-std::array<float,2>{0.251083851f, 0.952201664f},
-std::array<float,2>{0.210788682f, 0.495457917f},
-std::array<float,2>{0.71541512f, 0.700799704f},
-std::array<float,2>{0.546177328f, 0.320521861f},
-std::array<float,2>{0.0739787295f, 0.542857111f},
-std::array<float,2>{0.41159603f, 0.0254646707f},
-std::array<float,2>{0.859027982f, 0.846413255f},
-std::array<float,2>{0.783767819f, 0.376058608f},
-std::array<float,2>{0.488486052f, 0.638995707f},
-std::array<float,2>{0.0462290086f, 0.243796065f},
-std::array<float,2>{0.564738512f, 0.875767231f},
-std::array<float,2>{0.68714112f, 0.120936148f},
-std::array<float,2>{0.183215484f, 0.79712081f},
-std::array<float,2>{0.323254883f, 0.296584576f},
-std::array<float,2>{0.893993437f, 0.585851431f},
-std::array<float,2>{0.791728318f, 0.131885722f},
-std::array<float,2>{0.497758418f, 0.958586514f},
-std::array<float,2>{0.0371260941f, 0.481742561f},
-std::array<float,2>{0.570895493f, 0.712334931f},
-std::array<float,2>{0.674781144f, 0.33767572f},
-std::array<float,2>{0.178466126f, 0.562425375f},
-std::array<float,2>{0.317214012f, 0.00406496366f},
-std::array<float,2>{0.90507859f, 0.866945982f},
-std::array<float,2>{0.962326407f, 0.403041512f},
-std::array<float,2>{0.260717183f, 0.654469311f},
-std::array<float,2>{0.217455f, 0.226939902f},
-std::array<float,2>{0.707083762f, 0.898467898f},
-std::array<float,2>{0.534543514f, 0.100068599f},
-std::array<float,2>{0.0692451596f, 0.786656559f},
-std::array<float,2>{0.419105619f, 0.306952268f},
-std::array<float,2>{0.850646317f, 0.572895825f},
-std::array<float,2>{0.908467948f, 0.0383770615f},
-std::array<float,2>{0.364115506f, 0.83312726f},
-std::array<float,2>{0.147647247f, 0.348634571f},
-std::array<float,2>{0.641320348f, 0.52575767f},
-std::array<float,2>{0.607188106f, 0.451096177f},
-std::array<float,2>{0.008305002f, 0.74900198f},
-std::array<float,2>{0.440956533f, 0.163676783f},
-std::array<float,2>{0.772740722f, 0.998336554f},
-std::array<float,2>{0.834415674f, 0.269498914f},
-std::array<float,2>{0.38498652f, 0.620959878f},
-std::array<float,2>{0.10375423f, 0.0759553239f},
-std::array<float,2>{0.528639019f, 0.75273478f},
-std::array<float,2>{0.722967207f, 0.193723097f},
-std::array<float,2>{0.231308058f, 0.913405061f},
-std::array<float,2>{0.292466938f, 0.436689347f},
-std::array<float,2>{0.986218452f, 0.65906918f},
-std::array<float,2>{0.872681558f, 0.0927350372f},
-std::array<float,2>{0.422354251f, 0.777598917f},
-std::array<float,2>{0.0832286775f, 0.264374077f},
-std::array<float,2>{0.561781347f, 0.606111586f},
-std::array<float,2>{0.688733757f, 0.419695318f},
-std::array<float,2>{0.19073391f, 0.681844592f},
-std::array<float,2>{0.266832232f, 0.210277379f},
-std::array<float,2>{0.941243708f, 0.927987397f},
-std::array<float,2>{0.889092922f, 0.373770446f},
-std::array<float,2>{0.329472065f, 0.511933506f},
-std::array<float,2>{0.164529517f, 0.049740769f},
-std::array<float,2>{0.671062469f, 0.813159108f},
-std::array<float,2>{0.585600078f, 0.180521145f},
-std::array<float,2>{0.0580538139f, 0.97996372f},
-std::array<float,2>{0.477381796f, 0.457592368f},
-std::array<float,2>{0.802772522f, 0.721333742f},
-std::array<float,2>{0.969843745f, 0.247373372f},
-std::array<float,2>{0.300593555f, 0.88276583f},
-std::array<float,2>{0.23728855f, 0.380491465f},
-std::array<float,2>{0.74527359f, 0.633739471f},
-std::array<float,2>{0.509420812f, 0.291800588f},
-std::array<float,2>{0.118081897f, 0.581779242f},
-std::array<float,2>{0.402964234f, 0.121322758f},
-std::array<float,2>{0.817575157f, 0.8027035f},
-std::array<float,2>{0.758508205f, 0.499307066f},
-std::array<float,2>{0.461243033f, 0.698432565f},
-std::array<float,2>{0.0242497493f, 0.149952456f},
-std::array<float,2>{0.613382816f, 0.947565198f},
-std::array<float,2>{0.630710244f, 0.0279836357f},
-std::array<float,2>{0.137127176f, 0.851238668f},
-std::array<float,2>{0.350230485f, 0.328049809f},
-std::array<float,2>{0.934458077f, 0.545229435f},
-std::array<float,2>{0.820721447f, 0.213312477f},
-std::array<float,2>{0.391555995f, 0.929863095f},
-std::array<float,2>{0.116529629f, 0.407449245f},
-std::array<float,2>{0.500136912f, 0.674472213f},
-std::array<float,2>{0.735934317f, 0.252488524f},
-std::array<float,2>{0.243602768f, 0.596734762f},
-std::array<float,2>{0.307177275f, 0.0821438655f},
-std::array<float,2>{0.980218887f, 0.766396284f},
-std::array<float,2>{0.922959685f, 0.461798906f},
-std::array<float,2>{0.356128663f, 0.733355105f},
-std::array<float,2>{0.131571829f, 0.178173035f},
-std::array<float,2>{0.638646126f, 0.970728159f},
-std::array<float,2>{0.618066907f, 0.0585470796f},
-std::array<float,2>{0.0162868276f, 0.827410579f},
-std::array<float,2>{0.458624244f, 0.36173597f},
-std::array<float,2>{0.754717886f, 0.502225518f},
-std::array<float,2>{0.95090431f, 0.116074108f},
-std::array<float,2>{0.281036466f, 0.806452096f},
-std::array<float,2>{0.200372368f, 0.28296724f},
-std::array<float,2>{0.701812208f, 0.593081534f},
-std::array<float,2>{0.551694751f, 0.389696449f},
-std::array<float,2>{0.0868013054f, 0.627191663f},
-std::array<float,2>{0.432129353f, 0.240914851f},
-std::array<float,2>{0.859862089f, 0.889701664f},
-std::array<float,2>{0.805306256f, 0.314180583f},
-std::array<float,2>{0.471832365f, 0.536676824f},
-std::array<float,2>{0.0544554405f, 0.0168378092f},
-std::array<float,2>{0.587715924f, 0.856122255f},
-std::array<float,2>{0.66304189f, 0.145445466f},
-std::array<float,2>{0.159779742f, 0.942889929f},
-std::array<float,2>{0.338104993f, 0.488853663f},
-std::array<float,2>{0.878198147f, 0.690383136f},
-std::array<float,2>{0.774638474f, 0.0104347542f},
-std::array<float,2>{0.449032992f, 0.867732882f},
-std::array<float,2>{0.00620187819f, 0.334941953f},
-std::array<float,2>{0.598933876f, 0.548375785f},
-std::array<float,2>{0.655557275f, 0.475420773f},
-std::array<float,2>{0.153268382f, 0.708795726f},
-std::array<float,2>{0.368486732f, 0.137212023f},
-std::array<float,2>{0.915908098f, 0.964652121f},
-std::array<float,2>{0.998939931f, 0.297071755f},
-std::array<float,2>{0.282516211f, 0.568250299f},
-std::array<float,2>{0.219216257f, 0.102943704f},
-std::array<float,2>{0.733481765f, 0.790006757f},
-std::array<float,2>{0.522634685f, 0.22104913f},
-std::array<float,2>{0.0984028801f, 0.893194616f},
-std::array<float,2>{0.380920947f, 0.393806279f},
-std::array<float,2>{0.838397145f, 0.647132516f},
-std::array<float,2>{0.895213783f, 0.171132281f},
-std::array<float,2>{0.327681929f, 0.98770082f},
-std::array<float,2>{0.18623656f, 0.44355455f},
-std::array<float,2>{0.683027864f, 0.74030602f},
-std::array<float,2>{0.568246305f, 0.353256226f},
-std::array<float,2>{0.0402801894f, 0.521603882f},
-std::array<float,2>{0.487007886f, 0.0459068716f},
-std::array<float,2>{0.786000073f, 0.841002584f},
-std::array<float,2>{0.854134023f, 0.425280273f},
-std::array<float,2>{0.40771246f, 0.670499384f},
-std::array<float,2>{0.0744650513f, 0.197626978f},
-std::array<float,2>{0.540515542f, 0.91799736f},
-std::array<float,2>{0.711612999f, 0.0684144795f},
-std::array<float,2>{0.205328286f, 0.758585036f},
-std::array<float,2>{0.254585445f, 0.276314378f},
-std::array<float,2>{0.953388393f, 0.609456599f},
-std::array<float,2>{0.828277707f, 0.143306822f},
-std::array<float,2>{0.388121367f, 0.93884635f},
-std::array<float,2>{0.108017199f, 0.486953139f},
-std::array<float,2>{0.525722444f, 0.693178236f},
-std::array<float,2>{0.721226394f, 0.316496402f},
-std::array<float,2>{0.227426946f, 0.533379316f},
-std::array<float,2>{0.295151711f, 0.0205035917f},
-std::array<float,2>{0.988625765f, 0.851832628f},
-std::array<float,2>{0.911557496f, 0.38598913f},
-std::array<float,2>{0.360466063f, 0.629960477f},
-std::array<float,2>{0.142342716f, 0.238184571f},
-std::array<float,2>{0.645291746f, 0.883893788f},
-std::array<float,2>{0.605401218f, 0.111098066f},
-std::array<float,2>{0.0131763779f, 0.812060595f},
-std::array<float,2>{0.441979468f, 0.288760513f},
-std::array<float,2>{0.769377232f, 0.586251795f},
-std::array<float,2>{0.965452373f, 0.0618802719f},
-std::array<float,2>{0.262746781f, 0.820869505f},
-std::array<float,2>{0.21242483f, 0.364810526f},
-std::array<float,2>{0.706893086f, 0.504825294f},
-std::array<float,2>{0.537033916f, 0.465362161f},
-std::array<float,2>{0.0661745742f, 0.727839708f},
-std::array<float,2>{0.417298615f, 0.172343701f},
-std::array<float,2>{0.844887137f, 0.973108292f},
-std::array<float,2>{0.793985844f, 0.256079823f},
-std::array<float,2>{0.49368149f, 0.599416375f},
-std::array<float,2>{0.0323463194f, 0.0790446997f},
-std::array<float,2>{0.577289224f, 0.770753503f},
-std::array<float,2>{0.678416491f, 0.216442689f},
-std::array<float,2>{0.173564389f, 0.935374916f},
-std::array<float,2>{0.315812767f, 0.411313236f},
-std::array<float,2>{0.902267396f, 0.676313162f},
-std::array<float,2>{0.763232648f, 0.0658220425f},
-std::array<float,2>{0.465287089f, 0.763801396f},
-std::array<float,2>{0.0281596128f, 0.280347079f},
-std::array<float,2>{0.611768365f, 0.616270065f},
-std::array<float,2>{0.626684427f, 0.428285152f},
-std::array<float,2>{0.134336069f, 0.667479336f},
-std::array<float,2>{0.347539961f, 0.201507673f},
-std::array<float,2>{0.929995418f, 0.917059004f},
-std::array<float,2>{0.973910272f, 0.359199375f},
-std::array<float,2>{0.300853699f, 0.516931295f},
-std::array<float,2>{0.241686314f, 0.0429344103f},
-std::array<float,2>{0.748804152f, 0.837735653f},
-std::array<float,2>{0.513021708f, 0.165539607f},
-std::array<float,2>{0.12358705f, 0.99164325f},
-std::array<float,2>{0.402063668f, 0.439715236f},
-std::array<float,2>{0.813515484f, 0.735426962f},
-std::array<float,2>{0.884891987f, 0.225037366f},
-std::array<float,2>{0.335318387f, 0.898415804f},
-std::array<float,2>{0.170977309f, 0.397324234f},
-std::array<float,2>{0.667019129f, 0.644319952f},
-std::array<float,2>{0.580660105f, 0.304562151f},
-std::array<float,2>{0.0611928925f, 0.565951467f},
-std::array<float,2>{0.48081556f, 0.105947249f},
-std::array<float,2>{0.80035615f, 0.79412961f},
-std::array<float,2>{0.870843232f, 0.471820772f},
-std::array<float,2>{0.428642243f, 0.706129014f},
-std::array<float,2>{0.0784653276f, 0.133045077f},
-std::array<float,2>{0.557766795f, 0.967999279f},
-std::array<float,2>{0.693125367f, 0.0147872474f},
-std::array<float,2>{0.193197325f, 0.871455014f},
-std::array<float,2>{0.272961885f, 0.330600768f},
-std::array<float,2>{0.942649961f, 0.553168297f},
-std::array<float,2>{0.809840679f, 0.188369423f},
-std::array<float,2>{0.472673446f, 0.908986807f},
-std::array<float,2>{0.0502756201f, 0.431367189f},
-std::array<float,2>{0.593178511f, 0.662582874f},
-std::array<float,2>{0.658042789f, 0.27036944f},
-std::array<float,2>{0.160502404f, 0.624621093f},
-std::array<float,2>{0.342479616f, 0.073801212f},
-std::array<float,2>{0.880018711f, 0.756032944f},
-std::array<float,2>{0.948063135f, 0.447440207f},
-std::array<float,2>{0.274272919f, 0.744371831f},
-std::array<float,2>{0.195383802f, 0.160079837f},
-std::array<float,2>{0.699149847f, 0.995171428f},
-std::array<float,2>{0.548304796f, 0.0326285101f},
-std::array<float,2>{0.0931829065f, 0.831138492f},
-std::array<float,2>{0.435431063f, 0.344867587f},
-std::array<float,2>{0.865382552f, 0.529226184f},
-std::array<float,2>{0.925874531f, 0.0964405164f},
-std::array<float,2>{0.353049785f, 0.784261346f},
-std::array<float,2>{0.128508404f, 0.308927745f},
-std::array<float,2>{0.633001626f, 0.575013518f},
-std::array<float,2>{0.623976946f, 0.402115554f},
-std::array<float,2>{0.0221279077f, 0.650135279f},
-std::array<float,2>{0.453747422f, 0.233123928f},
-std::array<float,2>{0.751477599f, 0.904087007f},
-std::array<float,2>{0.826475739f, 0.343319774f},
-std::array<float,2>{0.396738231f, 0.555583954f},
-std::array<float,2>{0.111241527f, 0.00354362512f},
-std::array<float,2>{0.506638408f, 0.859919727f},
-std::array<float,2>{0.73874563f, 0.126092747f},
-std::array<float,2>{0.249257267f, 0.95356828f},
-std::array<float,2>{0.312393159f, 0.478625298f},
-std::array<float,2>{0.980988681f, 0.715207875f},
-std::array<float,2>{0.855581164f, 0.025044499f},
-std::array<float,2>{0.413076431f, 0.844468057f},
-std::array<float,2>{0.0714817122f, 0.323137164f},
-std::array<float,2>{0.543501675f, 0.539906979f},
-std::array<float,2>{0.716982901f, 0.493974239f},
-std::array<float,2>{0.208799735f, 0.702076912f},
-std::array<float,2>{0.252504855f, 0.15589194f},
-std::array<float,2>{0.960647225f, 0.950778544f},
-std::array<float,2>{0.890941858f, 0.294134259f},
-std::array<float,2>{0.320368886f, 0.582315803f},
-std::array<float,2>{0.1798345f, 0.118476592f},
-std::array<float,2>{0.684915721f, 0.799768865f},
-std::array<float,2>{0.563657284f, 0.244435012f},
-std::array<float,2>{0.0435536988f, 0.877467394f},
-std::array<float,2>{0.491698742f, 0.377518445f},
-std::array<float,2>{0.782533109f, 0.638205409f},
-std::array<float,2>{0.993043125f, 0.186667085f},
-std::array<float,2>{0.288508773f, 0.982151091f},
-std::array<float,2>{0.222739518f, 0.454518318f},
-std::array<float,2>{0.726897895f, 0.72608614f},
-std::array<float,2>{0.518528938f, 0.370417684f},
-std::array<float,2>{0.0943552479f, 0.510435104f},
-std::array<float,2>{0.37535128f, 0.0541408584f},
-std::array<float,2>{0.843471289f, 0.818606853f},
-std::array<float,2>{0.779142439f, 0.41738829f},
-std::array<float,2>{0.450179368f, 0.683889091f},
-std::array<float,2>{0.00305028423f, 0.203619346f},
-std::array<float,2>{0.593781531f, 0.923507333f},
-std::array<float,2>{0.649922073f, 0.0869921446f},
-std::array<float,2>{0.152002409f, 0.776793659f},
-std::array<float,2>{0.374865651f, 0.260355711f},
-std::array<float,2>{0.920101464f, 0.603787601f},
-std::array<float,2>{0.770818889f, 0.160742849f},
-std::array<float,2>{0.439284563f, 0.996502101f},
-std::array<float,2>{0.0100550521f, 0.452695519f},
-std::array<float,2>{0.608635545f, 0.747731745f},
-std::array<float,2>{0.643167913f, 0.350209534f},
-std::array<float,2>{0.145058706f, 0.524267495f},
-std::array<float,2>{0.365516216f, 0.0370074511f},
-std::array<float,2>{0.906570435f, 0.834477603f},
-std::array<float,2>{0.986949861f, 0.435390294f},
-std::array<float,2>{0.290633798f, 0.658164322f},
-std::array<float,2>{0.232599914f, 0.192087978f},
-std::array<float,2>{0.726406276f, 0.911893785f},
-std::array<float,2>{0.529525697f, 0.0763264745f},
-std::array<float,2>{0.102794424f, 0.751789689f},
-std::array<float,2>{0.38428542f, 0.266262829f},
-std::array<float,2>{0.833355248f, 0.61911577f},
-std::array<float,2>{0.903047025f, 0.00624670228f},
-std::array<float,2>{0.318618566f, 0.864216387f},
-std::array<float,2>{0.177323997f, 0.337908894f},
-std::array<float,2>{0.67361474f, 0.5599733f},
-std::array<float,2>{0.574108839f, 0.482592434f},
-std::array<float,2>{0.0354281254f, 0.714483619f},
-std::array<float,2>{0.498665601f, 0.129195273f},
-std::array<float,2>{0.790471911f, 0.960537434f},
-std::array<float,2>{0.848905265f, 0.306563944f},
-std::array<float,2>{0.42137289f, 0.572170317f},
-std::array<float,2>{0.0666620284f, 0.0984989181f},
-std::array<float,2>{0.53188926f, 0.787791789f},
-std::array<float,2>{0.710232019f, 0.229019523f},
-std::array<float,2>{0.216589823f, 0.900998831f},
-std::array<float,2>{0.258056164f, 0.405574143f},
-std::array<float,2>{0.964721262f, 0.654085755f},
-std::array<float,2>{0.819206834f, 0.124148682f},
-std::array<float,2>{0.40497604f, 0.804097116f},
-std::array<float,2>{0.120097339f, 0.290661842f},
-std::array<float,2>{0.511275351f, 0.578331888f},
-std::array<float,2>{0.742362499f, 0.382000536f},
-std::array<float,2>{0.23532404f, 0.635422766f},
-std::array<float,2>{0.298659176f, 0.24950622f},
-std::array<float,2>{0.970755279f, 0.880090356f},
-std::array<float,2>{0.937173307f, 0.325546235f},
-std::array<float,2>{0.349422812f, 0.543865442f},
-std::array<float,2>{0.138727933f, 0.0298113637f},
-std::array<float,2>{0.632241845f, 0.847773314f},
-std::array<float,2>{0.615324557f, 0.150560841f},
-std::array<float,2>{0.0271120835f, 0.947219074f},
-std::array<float,2>{0.46361044f, 0.496284187f},
-std::array<float,2>{0.761528015f, 0.695831954f},
-std::array<float,2>{0.938168764f, 0.207231283f},
-std::array<float,2>{0.267734706f, 0.927380681f},
-std::array<float,2>{0.187998205f, 0.421193719f},
-std::array<float,2>{0.689751744f, 0.679861248f},
-std::array<float,2>{0.559042871f, 0.263520747f},
-std::array<float,2>{0.0840959102f, 0.607427657f},
-std::array<float,2>{0.425260693f, 0.0898579955f},
-std::array<float,2>{0.874996603f, 0.779510856f},
-std::array<float,2>{0.802387059f, 0.459311992f},
-std::array<float,2>{0.479643792f, 0.720474839f},
-std::array<float,2>{0.0565652214f, 0.183062583f},
-std::array<float,2>{0.583259821f, 0.978054643f},
-std::array<float,2>{0.66846019f, 0.0484592244f},
-std::array<float,2>{0.167395219f, 0.815435708f},
-std::array<float,2>{0.33016786f, 0.372469187f},
-std::array<float,2>{0.887842834f, 0.514812052f},
-std::array<float,2>{0.861714959f, 0.238406271f},
-std::array<float,2>{0.430318713f, 0.888423204f},
-std::array<float,2>{0.0884390026f, 0.388046056f},
-std::array<float,2>{0.554164529f, 0.62596488f},
-std::array<float,2>{0.700215638f, 0.283211052f},
-std::array<float,2>{0.201461732f, 0.591682196f},
-std::array<float,2>{0.278054833f, 0.114961103f},
-std::array<float,2>{0.952962458f, 0.807611406f},
-std::array<float,2>{0.875314593f, 0.492023259f},
-std::array<float,2>{0.337723613f, 0.687679648f},
-std::array<float,2>{0.15806222f, 0.14717257f},
-std::array<float,2>{0.661778867f, 0.943387985f},
-std::array<float,2>{0.589298725f, 0.0193152074f},
-std::array<float,2>{0.0516898595f, 0.858838081f},
-std::array<float,2>{0.469702899f, 0.316227227f},
-std::array<float,2>{0.807963908f, 0.538509548f},
-std::array<float,2>{0.977448165f, 0.0851896107f},
-std::array<float,2>{0.305589139f, 0.768078148f},
-std::array<float,2>{0.24571763f, 0.251559019f},
-std::array<float,2>{0.737516701f, 0.595135272f},
-std::array<float,2>{0.502101183f, 0.408698767f},
-std::array<float,2>{0.115114287f, 0.672637939f},
-std::array<float,2>{0.392588377f, 0.211767718f},
-std::array<float,2>{0.822624743f, 0.931978047f},
-std::array<float,2>{0.757794023f, 0.359823644f},
-std::array<float,2>{0.459731907f, 0.50079596f},
-std::array<float,2>{0.0191984624f, 0.0561952591f},
-std::array<float,2>{0.620746195f, 0.824792266f},
-std::array<float,2>{0.638877928f, 0.17753917f},
-std::array<float,2>{0.129702523f, 0.969902813f},
-std::array<float,2>{0.35787484f, 0.463975459f},
-std::array<float,2>{0.925146282f, 0.730724871f},
-std::array<float,2>{0.787859917f, 0.0437052511f},
-std::array<float,2>{0.484524608f, 0.842792511f},
-std::array<float,2>{0.0415573083f, 0.355294585f},
-std::array<float,2>{0.570054471f, 0.520951152f},
-std::array<float,2>{0.680398107f, 0.442871332f},
-std::array<float,2>{0.184169769f, 0.738643348f},
-std::array<float,2>{0.325997472f, 0.169115499f},
-std::array<float,2>{0.897881627f, 0.985850275f},
-std::array<float,2>{0.956047893f, 0.275379419f},
-std::array<float,2>{0.257619232f, 0.611959755f},
-std::array<float,2>{0.20336163f, 0.0667720884f},
-std::array<float,2>{0.713876367f, 0.761435807f},
-std::array<float,2>{0.542956114f, 0.195973426f},
-std::array<float,2>{0.0762208551f, 0.920177996f},
-std::array<float,2>{0.408963531f, 0.42345193f},
-std::array<float,2>{0.85318327f, 0.668119729f},
-std::array<float,2>{0.916978121f, 0.139552176f},
-std::array<float,2>{0.36958009f, 0.961784542f},
-std::array<float,2>{0.15463765f, 0.473208427f},
-std::array<float,2>{0.652980566f, 0.710110486f},
-std::array<float,2>{0.599760413f, 0.333580732f},
-std::array<float,2>{0.00481630582f, 0.550481677f},
-std::array<float,2>{0.445800364f, 0.0082466118f},
-std::array<float,2>{0.775774002f, 0.870200276f},
-std::array<float,2>{0.836859047f, 0.391566724f},
-std::array<float,2>{0.380727142f, 0.644665658f},
-std::array<float,2>{0.0997198746f, 0.220238462f},
-std::array<float,2>{0.521158218f, 0.892202795f},
-std::array<float,2>{0.732330322f, 0.103774808f},
-std::array<float,2>{0.221593156f, 0.792881072f},
-std::array<float,2>{0.284404755f, 0.299966127f},
-std::array<float,2>{0.997144222f, 0.569272757f},
-std::array<float,2>{0.867207587f, 0.134415686f},
-std::array<float,2>{0.426940858f, 0.967433929f},
-std::array<float,2>{0.0813608095f, 0.470946997f},
-std::array<float,2>{0.555358291f, 0.705567598f},
-std::array<float,2>{0.695134699f, 0.331741691f},
-std::array<float,2>{0.193854004f, 0.554341853f},
-std::array<float,2>{0.270538449f, 0.0138919884f},
-std::array<float,2>{0.943750739f, 0.872136533f},
-std::array<float,2>{0.883175194f, 0.397647917f},
-std::array<float,2>{0.332678795f, 0.64311415f},
-std::array<float,2>{0.168844745f, 0.226212099f},
-std::array<float,2>{0.664977252f, 0.89740485f},
-std::array<float,2>{0.578351498f, 0.106887728f},
-std::array<float,2>{0.0599776581f, 0.793410957f},
-std::array<float,2>{0.483581096f, 0.302978396f},
-std::array<float,2>{0.797905564f, 0.564470947f},
-std::array<float,2>{0.975538731f, 0.0419795252f},
-std::array<float,2>{0.304015756f, 0.836900353f},
-std::array<float,2>{0.238620743f, 0.357642293f},
-std::array<float,2>{0.747697413f, 0.515790045f},
-std::array<float,2>{0.513743103f, 0.440947682f},
-std::array<float,2>{0.12183968f, 0.735041201f},
-std::array<float,2>{0.399557441f, 0.16458115f},
-std::array<float,2>{0.815258026f, 0.990341485f},
-std::array<float,2>{0.764668465f, 0.279630542f},
-std::array<float,2>{0.468565106f, 0.615268052f},
-std::array<float,2>{0.0305300243f, 0.0648701042f},
-std::array<float,2>{0.611008167f, 0.764854193f},
-std::array<float,2>{0.627208471f, 0.202899709f},
-std::array<float,2>{0.134943783f, 0.916430712f},
-std::array<float,2>{0.344218701f, 0.428867877f},
-std::array<float,2>{0.932714522f, 0.666835487f},
-std::array<float,2>{0.796187341f, 0.0796528831f},
-std::array<float,2>{0.495421767f, 0.769856155f},
-std::array<float,2>{0.0343635641f, 0.25726226f},
-std::array<float,2>{0.57481575f, 0.59767729f},
-std::array<float,2>{0.676211476f, 0.410441816f},
-std::array<float,2>{0.174543262f, 0.677536428f},
-std::array<float,2>{0.313989311f, 0.215410963f},
-std::array<float,2>{0.899041712f, 0.934528172f},
-std::array<float,2>{0.968241572f, 0.363898605f},
-std::array<float,2>{0.263771325f, 0.505710542f},
-std::array<float,2>{0.213177368f, 0.0605686903f},
-std::array<float,2>{0.703428805f, 0.82154882f},
-std::array<float,2>{0.538957417f, 0.173720106f},
-std::array<float,2>{0.0637973696f, 0.974284351f},
-std::array<float,2>{0.41579929f, 0.466362983f},
-std::array<float,2>{0.846621215f, 0.726897717f},
-std::array<float,2>{0.912943423f, 0.236398071f},
-std::array<float,2>{0.362067372f, 0.883660197f},
-std::array<float,2>{0.143406317f, 0.385041714f},
-std::array<float,2>{0.647792816f, 0.629589915f},
-std::array<float,2>{0.601705849f, 0.287523389f},
-std::array<float,2>{0.0149512663f, 0.586971879f},
-std::array<float,2>{0.443725705f, 0.110229649f},
-std::array<float,2>{0.76695478f, 0.810674846f},
-std::array<float,2>{0.831918359f, 0.487994969f},
-std::array<float,2>{0.390335113f, 0.691747129f},
-std::array<float,2>{0.106153488f, 0.144325003f},
-std::array<float,2>{0.524815798f, 0.937655568f},
-std::array<float,2>{0.719550908f, 0.0214411523f},
-std::array<float,2>{0.229969814f, 0.852845132f},
-std::array<float,2>{0.293270081f, 0.31833148f},
-std::array<float,2>{0.990638077f, 0.534415245f},
-std::array<float,2>{0.779762685f, 0.20473066f},
-std::array<float,2>{0.451289386f, 0.922689378f},
-std::array<float,2>{0.0018485313f, 0.416065454f},
-std::array<float,2>{0.595930099f, 0.684755087f},
-std::array<float,2>{0.651431441f, 0.260859758f},
-std::array<float,2>{0.148772359f, 0.604613066f},
-std::array<float,2>{0.37280643f, 0.0868534148f},
-std::array<float,2>{0.919276834f, 0.775923312f},
-std::array<float,2>{0.995033681f, 0.453202784f},
-std::array<float,2>{0.286898464f, 0.724988461f},
-std::array<float,2>{0.225985065f, 0.186001122f},
-std::array<float,2>{0.730014563f, 0.981426418f},
-std::array<float,2>{0.516838312f, 0.0532800555f},
-std::array<float,2>{0.0970876738f, 0.819443643f},
-std::array<float,2>{0.378662318f, 0.369414032f},
-std::array<float,2>{0.840266705f, 0.511617601f},
-std::array<float,2>{0.893441081f, 0.117735773f},
-std::array<float,2>{0.323109806f, 0.79997772f},
-std::array<float,2>{0.182087526f, 0.29348892f},
-std::array<float,2>{0.685969055f, 0.583125472f},
-std::array<float,2>{0.56559366f, 0.378060758f},
-std::array<float,2>{0.0453136079f, 0.636893332f},
-std::array<float,2>{0.490132481f, 0.245412171f},
-std::array<float,2>{0.784929037f, 0.878473222f},
-std::array<float,2>{0.857581079f, 0.32401213f},
-std::array<float,2>{0.410971969f, 0.540213883f},
-std::array<float,2>{0.0724166632f, 0.0242649261f},
-std::array<float,2>{0.545686722f, 0.844844818f},
-std::array<float,2>{0.71656239f, 0.154541865f},
-std::array<float,2>{0.209707186f, 0.950172305f},
-std::array<float,2>{0.250309795f, 0.493127435f},
-std::array<float,2>{0.958066165f, 0.702660322f},
-std::array<float,2>{0.825147748f, 0.00246326928f},
-std::array<float,2>{0.395129293f, 0.861127675f},
-std::array<float,2>{0.112071984f, 0.342119843f},
-std::array<float,2>{0.505179346f, 0.55569005f},
-std::array<float,2>{0.740976572f, 0.47949782f},
-std::array<float,2>{0.246693373f, 0.716713727f},
-std::array<float,2>{0.308906108f, 0.125021219f},
-std::array<float,2>{0.982481062f, 0.954215169f},
-std::array<float,2>{0.929150283f, 0.310101688f},
-std::array<float,2>{0.354877472f, 0.575969875f},
-std::array<float,2>{0.126779333f, 0.0969330668f},
-std::array<float,2>{0.636689425f, 0.783464909f},
-std::array<float,2>{0.622419477f, 0.233691156f},
-std::array<float,2>{0.020230813f, 0.902799785f},
-std::array<float,2>{0.456860363f, 0.401098251f},
-std::array<float,2>{0.753844023f, 0.648717761f},
-std::array<float,2>{0.947206497f, 0.158324361f},
-std::array<float,2>{0.276844054f, 0.99434042f},
-std::array<float,2>{0.197436243f, 0.44908154f},
-std::array<float,2>{0.695982277f, 0.745615005f},
-std::array<float,2>{0.549838126f, 0.344543964f},
-std::array<float,2>{0.0917397961f, 0.527678847f},
-std::array<float,2>{0.4360497f, 0.0316146091f},
-std::array<float,2>{0.864433944f, 0.830913782f},
-std::array<float,2>{0.812282264f, 0.429821193f},
-std::array<float,2>{0.475953847f, 0.663113832f},
-std::array<float,2>{0.0475538038f, 0.188563615f},
-std::array<float,2>{0.590430498f, 0.910093606f},
-std::array<float,2>{0.659152508f, 0.0724088848f},
-std::array<float,2>{0.162755057f, 0.757528782f},
-std::array<float,2>{0.34001404f, 0.270749509f},
-std::array<float,2>{0.881297231f, 0.623625457f},
-std::array<float,2>{0.804318428f, 0.182021454f},
-std::array<float,2>{0.478022546f, 0.976730049f},
-std::array<float,2>{0.0566853583f, 0.460574597f},
-std::array<float,2>{0.584195435f, 0.719206035f},
-std::array<float,2>{0.669982731f, 0.371962726f},
-std::array<float,2>{0.165393531f, 0.514503896f},
-std::array<float,2>{0.328895837f, 0.0476984307f},
-std::array<float,2>{0.890427053f, 0.814651668f},
-std::array<float,2>{0.939517558f, 0.420297414f},
-std::array<float,2>{0.266006947f, 0.681119204f},
-std::array<float,2>{0.189736038f, 0.208882645f},
-std::array<float,2>{0.688360929f, 0.926536441f},
-std::array<float,2>{0.560756862f, 0.0914141759f},
-std::array<float,2>{0.0828716382f, 0.78104341f},
-std::array<float,2>{0.422869325f, 0.261902779f},
-std::array<float,2>{0.871805549f, 0.609356105f},
-std::array<float,2>{0.934962273f, 0.0304061249f},
-std::array<float,2>{0.350814372f, 0.849563777f},
-std::array<float,2>{0.138022527f, 0.32501629f},
-std::array<float,2>{0.629814804f, 0.544074953f},
-std::array<float,2>{0.615232587f, 0.497302026f},
-std::array<float,2>{0.0247685574f, 0.696913779f},
-std::array<float,2>{0.462059945f, 0.152295828f},
-std::array<float,2>{0.759360254f, 0.945600688f},
-std::array<float,2>{0.817037702f, 0.289507866f},
-std::array<float,2>{0.403359473f, 0.579543054f},
-std::array<float,2>{0.11909917f, 0.123416103f},
-std::array<float,2>{0.508122623f, 0.803593576f},
-std::array<float,2>{0.744541109f, 0.248675153f},
-std::array<float,2>{0.238055795f, 0.879654706f},
-std::array<float,2>{0.299709409f, 0.381341368f},
-std::array<float,2>{0.969531775f, 0.635787964f},
-std::array<float,2>{0.85023284f, 0.099236317f},
-std::array<float,2>{0.41860491f, 0.788110912f},
-std::array<float,2>{0.0696282014f, 0.30545947f},
-std::array<float,2>{0.533203959f, 0.570983827f},
-std::array<float,2>{0.708538651f, 0.404803544f},
-std::array<float,2>{0.218048856f, 0.652673304f},
-std::array<float,2>{0.260868341f, 0.229813904f},
-std::array<float,2>{0.961592495f, 0.90158236f},
-std::array<float,2>{0.906138301f, 0.339619428f},
-std::array<float,2>{0.317600101f, 0.559528768f},
-std::array<float,2>{0.179153174f, 0.0076110689f},
-std::array<float,2>{0.675759137f, 0.865184546f},
-std::array<float,2>{0.571413994f, 0.130614012f},
-std::array<float,2>{0.0382279269f, 0.959918439f},
-std::array<float,2>{0.49628529f, 0.484047532f},
-std::array<float,2>{0.792706013f, 0.713514507f},
-std::array<float,2>{0.985133529f, 0.192840055f},
-std::array<float,2>{0.291432947f, 0.910873294f},
-std::array<float,2>{0.231889307f, 0.433925271f},
-std::array<float,2>{0.723908722f, 0.656779885f},
-std::array<float,2>{0.528054476f, 0.267051667f},
-std::array<float,2>{0.104738452f, 0.617417216f},
-std::array<float,2>{0.385840058f, 0.0780649185f},
-std::array<float,2>{0.83514601f, 0.750227988f},
-std::array<float,2>{0.771708786f, 0.451270223f},
-std::array<float,2>{0.439874202f, 0.746121287f},
-std::array<float,2>{0.00888388511f, 0.162103012f},
-std::array<float,2>{0.605967343f, 0.997407615f},
-std::array<float,2>{0.641745567f, 0.0352057479f},
-std::array<float,2>{0.146785289f, 0.835658491f},
-std::array<float,2>{0.364857644f, 0.350652725f},
-std::array<float,2>{0.910048962f, 0.525051355f},
-std::array<float,2>{0.839318931f, 0.218973204f},
-std::array<float,2>{0.382134467f, 0.89093864f},
-std::array<float,2>{0.0989510864f, 0.391993523f},
-std::array<float,2>{0.521745503f, 0.64610815f},
-std::array<float,2>{0.732713819f, 0.299643785f},
-std::array<float,2>{0.219871372f, 0.569640756f},
-std::array<float,2>{0.281898648f, 0.104652844f},
-std::array<float,2>{0.999034464f, 0.791772902f},
-std::array<float,2>{0.914909244f, 0.474004388f},
-std::array<float,2>{0.367992431f, 0.709429681f},
-std::array<float,2>{0.154251948f, 0.139977083f},
-std::array<float,2>{0.654577792f, 0.962305069f},
-std::array<float,2>{0.597757399f, 0.00937979762f},
-std::array<float,2>{0.00773532828f, 0.86995399f},
-std::array<float,2>{0.447665781f, 0.332309425f},
-std::array<float,2>{0.774306476f, 0.548829913f},
-std::array<float,2>{0.954851151f, 0.067651622f},
-std::array<float,2>{0.25522998f, 0.760369539f},
-std::array<float,2>{0.206287324f, 0.274176717f},
-std::array<float,2>{0.712251782f, 0.612791181f},
-std::array<float,2>{0.539571166f, 0.422477603f},
-std::array<float,2>{0.0752486438f, 0.669670701f},
-std::array<float,2>{0.406746745f, 0.196491808f},
-std::array<float,2>{0.854960918f, 0.921644747f},
-std::array<float,2>{0.786290824f, 0.354324222f},
-std::array<float,2>{0.48738423f, 0.519837141f},
-std::array<float,2>{0.0393170007f, 0.0446119681f},
-std::array<float,2>{0.567118883f, 0.842006326f},
-std::array<float,2>{0.68182081f, 0.168303028f},
-std::array<float,2>{0.187049031f, 0.985120118f},
-std::array<float,2>{0.327036113f, 0.442270696f},
-std::array<float,2>{0.89618367f, 0.73933506f},
-std::array<float,2>{0.755556464f, 0.0553467609f},
-std::array<float,2>{0.457269847f, 0.825635016f},
-std::array<float,2>{0.0171208363f, 0.360515952f},
-std::array<float,2>{0.619007289f, 0.501596749f},
-std::array<float,2>{0.637661576f, 0.46378997f},
-std::array<float,2>{0.132265866f, 0.731849074f},
-std::array<float,2>{0.356805712f, 0.175867438f},
-std::array<float,2>{0.922206044f, 0.969484091f},
-std::array<float,2>{0.979207695f, 0.250634849f},
-std::array<float,2>{0.308487594f, 0.594203889f},
-std::array<float,2>{0.243080914f, 0.084452562f},
-std::array<float,2>{0.734970272f, 0.769023359f},
-std::array<float,2>{0.501782835f, 0.212030336f},
-std::array<float,2>{0.115777344f, 0.933270395f},
-std::array<float,2>{0.391978115f, 0.410091966f},
-std::array<float,2>{0.821439683f, 0.673692584f},
-std::array<float,2>{0.87788707f, 0.147643298f},
-std::array<float,2>{0.339130044f, 0.944969177f},
-std::array<float,2>{0.158413529f, 0.490705043f},
-std::array<float,2>{0.663273156f, 0.68935895f},
-std::array<float,2>{0.586407244f, 0.31483537f},
-std::array<float,2>{0.0529753491f, 0.53738308f},
-std::array<float,2>{0.471564531f, 0.0181547645f},
-std::array<float,2>{0.806592882f, 0.85778445f},
-std::array<float,2>{0.861302197f, 0.387206793f},
-std::array<float,2>{0.433205634f, 0.626018465f},
-std::array<float,2>{0.0872529298f, 0.239804193f},
-std::array<float,2>{0.552326679f, 0.887240231f},
-std::array<float,2>{0.702863336f, 0.113707878f},
-std::array<float,2>{0.200003207f, 0.808265328f},
-std::array<float,2>{0.279531091f, 0.284702033f},
-std::array<float,2>{0.949382186f, 0.590382636f},
-std::array<float,2>{0.812537372f, 0.16702269f},
-std::array<float,2>{0.401308835f, 0.98845005f},
-std::array<float,2>{0.124790609f, 0.438617259f},
-std::array<float,2>{0.512116015f, 0.736521244f},
-std::array<float,2>{0.749511838f, 0.35679239f},
-std::array<float,2>{0.240286842f, 0.518978059f},
-std::array<float,2>{0.302192122f, 0.0394020602f},
-std::array<float,2>{0.973417103f, 0.838031411f},
-std::array<float,2>{0.930823624f, 0.426027f},
-std::array<float,2>{0.346000969f, 0.664605796f},
-std::array<float,2>{0.133247688f, 0.200936899f},
-std::array<float,2>{0.62594229f, 0.914140642f},
-std::array<float,2>{0.613100052f, 0.0642198026f},
-std::array<float,2>{0.0289992876f, 0.761730969f},
-std::array<float,2>{0.465959489f, 0.278764337f},
-std::array<float,2>{0.762513161f, 0.614415944f},
-std::array<float,2>{0.941460788f, 0.0129516833f},
-std::array<float,2>{0.272441089f, 0.873143137f},
-std::array<float,2>{0.191791207f, 0.329755694f},
-std::array<float,2>{0.69205296f, 0.551763773f},
-std::array<float,2>{0.557386339f, 0.469620913f},
-std::array<float,2>{0.0798663646f, 0.703617334f},
-std::array<float,2>{0.429323733f, 0.135216773f},
-std::array<float,2>{0.869841695f, 0.966450632f},
-std::array<float,2>{0.799696267f, 0.300801128f},
-std::array<float,2>{0.482024252f, 0.564442456f},
-std::array<float,2>{0.0615389533f, 0.108301423f},
-std::array<float,2>{0.581767678f, 0.79678899f},
-std::array<float,2>{0.666656256f, 0.22391364f},
-std::array<float,2>{0.170745373f, 0.896073878f},
-std::array<float,2>{0.334234029f, 0.395743877f},
-std::array<float,2>{0.886418462f, 0.641714513f},
-std::array<float,2>{0.76769799f, 0.112149261f},
-std::array<float,2>{0.442590922f, 0.809014738f},
-std::array<float,2>{0.0121773193f, 0.287058711f},
-std::array<float,2>{0.603870213f, 0.588265717f},
-std::array<float,2>{0.646367252f, 0.383965909f},
-std::array<float,2>{0.141270369f, 0.631117165f},
-std::array<float,2>{0.359834909f, 0.234894097f},
-std::array<float,2>{0.910644293f, 0.885160685f},
-std::array<float,2>{0.989720702f, 0.318443f},
-std::array<float,2>{0.296496511f, 0.531568706f},
-std::array<float,2>{0.227692381f, 0.0215278659f},
-std::array<float,2>{0.722015679f, 0.854083121f},
-std::array<float,2>{0.527063906f, 0.141630039f},
-std::array<float,2>{0.108438015f, 0.94062978f},
-std::array<float,2>{0.386923343f, 0.484685838f},
-std::array<float,2>{0.829291046f, 0.695143878f},
-std::array<float,2>{0.900419056f, 0.218596727f},
-std::array<float,2>{0.314924866f, 0.936126411f},
-std::array<float,2>{0.172637433f, 0.41272679f},
-std::array<float,2>{0.679331541f, 0.677827835f},
-std::array<float,2>{0.576308966f, 0.255699992f},
-std::array<float,2>{0.0317718349f, 0.601540864f},
-std::array<float,2>{0.492651045f, 0.0817810595f},
-std::array<float,2>{0.793695688f, 0.77267015f},
-std::array<float,2>{0.844347179f, 0.467026561f},
-std::array<float,2>{0.416492522f, 0.729650021f},
-std::array<float,2>{0.0644545779f, 0.175098836f},
-std::array<float,2>{0.536025286f, 0.975417554f},
-std::array<float,2>{0.705778301f, 0.0591907948f},
-std::array<float,2>{0.211643934f, 0.824196219f},
-std::array<float,2>{0.262430698f, 0.367006302f},
-std::array<float,2>{0.966240883f, 0.506858528f},
-std::array<float,2>{0.781787395f, 0.242323801f},
-std::array<float,2>{0.490518689f, 0.876641095f},
-std::array<float,2>{0.0445093922f, 0.375385344f},
-std::array<float,2>{0.562581778f, 0.640194178f},
-std::array<float,2>{0.684311807f, 0.295305789f},
-std::array<float,2>{0.180775434f, 0.584923148f},
-std::array<float,2>{0.321482807f, 0.119513661f},
-std::array<float,2>{0.89248246f, 0.79802829f},
-std::array<float,2>{0.959912121f, 0.494244874f},
-std::array<float,2>{0.253026336f, 0.699444056f},
-std::array<float,2>{0.207441285f, 0.153334931f},
-std::array<float,2>{0.718366921f, 0.951855958f},
-std::array<float,2>{0.544316769f, 0.0271268748f},
-std::array<float,2>{0.0706035122f, 0.847030878f},
-std::array<float,2>{0.413148969f, 0.321582526f},
-std::array<float,2>{0.857299864f, 0.541859508f},
-std::array<float,2>{0.921001613f, 0.0883286744f},
-std::array<float,2>{0.373843282f, 0.774982631f},
-std::array<float,2>{0.15044181f, 0.258268207f},
-std::array<float,2>{0.649147153f, 0.602224052f},
-std::array<float,2>{0.595082998f, 0.415100038f},
-std::array<float,2>{0.00287910784f, 0.686756134f},
-std::array<float,2>{0.450331658f, 0.205573991f},
-std::array<float,2>{0.778084099f, 0.92569381f},
-std::array<float,2>{0.841994286f, 0.367864698f},
-std::array<float,2>{0.376686096f, 0.509130597f},
-std::array<float,2>{0.0953782275f, 0.0516055711f},
-std::array<float,2>{0.519147813f, 0.817797065f},
-std::array<float,2>{0.728514731f, 0.184539601f},
-std::array<float,2>{0.224361256f, 0.982821941f},
-std::array<float,2>{0.287161589f, 0.456907451f},
-std::array<float,2>{0.994019568f, 0.723002136f},
-std::array<float,2>{0.866562128f, 0.0336322822f},
-std::array<float,2>{0.433604628f, 0.828992426f},
-std::array<float,2>{0.092167303f, 0.34595409f},
-std::array<float,2>{0.547731638f, 0.530783117f},
-std::array<float,2>{0.697875142f, 0.446237445f},
-std::array<float,2>{0.197032034f, 0.743201196f},
-std::array<float,2>{0.274509311f, 0.156296283f},
-std::array<float,2>{0.948300421f, 0.992917359f},
-std::array<float,2>{0.879495382f, 0.272208363f},
-std::array<float,2>{0.342880517f, 0.622502208f},
-std::array<float,2>{0.161494225f, 0.0709139183f},
-std::array<float,2>{0.656775177f, 0.754723012f},
-std::array<float,2>{0.591818452f, 0.189655811f},
-std::array<float,2>{0.0492765717f, 0.907293797f},
-std::array<float,2>{0.474604905f, 0.432672352f},
-std::array<float,2>{0.809102833f, 0.661152363f},
-std::array<float,2>{0.981471658f, 0.128458709f},
-std::array<float,2>{0.310707301f, 0.955736518f},
-std::array<float,2>{0.248057365f, 0.476662785f},
-std::array<float,2>{0.739334285f, 0.716917276f},
-std::array<float,2>{0.507075191f, 0.340553939f},
-std::array<float,2>{0.10981936f, 0.557782114f},
-std::array<float,2>{0.398335099f, 1.76159483e-05f},
-std::array<float,2>{0.827221751f, 0.861638725f},
-std::array<float,2>{0.750855029f, 0.399170101f},
-std::array<float,2>{0.454543322f, 0.652272582f},
-std::array<float,2>{0.0225786604f, 0.231356099f},
-std::array<float,2>{0.624692976f, 0.905353308f},
-std::array<float,2>{0.634735644f, 0.0955938771f},
-std::array<float,2>{0.127905533f, 0.782520294f},
-std::array<float,2>{0.351697803f, 0.311406374f},
-std::array<float,2>{0.92712009f, 0.577804625f},
-std::array<float,2>{0.760332644f, 0.148446098f},
-std::array<float,2>{0.464208096f, 0.948642671f},
-std::array<float,2>{0.0260788575f, 0.498149663f},
-std::array<float,2>{0.617134988f, 0.697938144f},
-std::array<float,2>{0.631440938f, 0.326706767f},
-std::array<float,2>{0.140591621f, 0.546229362f},
-std::array<float,2>{0.348371923f, 0.0291877203f},
-std::array<float,2>{0.93578881f, 0.850282907f},
-std::array<float,2>{0.972621083f, 0.379080564f},
-std::array<float,2>{0.29709506f, 0.634007215f},
-std::array<float,2>{0.235375121f, 0.24692139f},
-std::array<float,2>{0.743353069f, 0.881789327f},
-std::array<float,2>{0.510515153f, 0.122335039f},
-std::array<float,2>{0.120860316f, 0.801305115f},
-std::array<float,2>{0.405656159f, 0.292915761f},
-std::array<float,2>{0.819622457f, 0.58017087f},
-std::array<float,2>{0.887224197f, 0.0499714836f},
-std::array<float,2>{0.331299841f, 0.81357342f},
-std::array<float,2>{0.166875705f, 0.374949366f},
-std::array<float,2>{0.669797897f, 0.51277113f},
-std::array<float,2>{0.582991064f, 0.458722681f},
-std::array<float,2>{0.0551746227f, 0.722609341f},
-std::array<float,2>{0.47903052f, 0.181262195f},
-std::array<float,2>{0.801121533f, 0.97943157f},
-std::array<float,2>{0.873411357f, 0.265518755f},
-std::array<float,2>{0.424575478f, 0.607345879f},
-std::array<float,2>{0.0853017122f, 0.0929094329f},
-std::array<float,2>{0.559601307f, 0.778350592f},
-std::array<float,2>{0.690956116f, 0.209859878f},
-std::array<float,2>{0.189322516f, 0.929599345f},
-std::array<float,2>{0.268809497f, 0.418418527f},
-std::array<float,2>{0.939311922f, 0.682723463f},
-std::array<float,2>{0.832109511f, 0.074312292f},
-std::array<float,2>{0.383216053f, 0.753810883f},
-std::array<float,2>{0.102440231f, 0.268413991f},
-std::array<float,2>{0.530440271f, 0.619250059f},
-std::array<float,2>{0.725186884f, 0.436204851f},
-std::array<float,2>{0.233473897f, 0.65957582f},
-std::array<float,2>{0.289532036f, 0.194786161f},
-std::array<float,2>{0.987584949f, 0.912579f},
-std::array<float,2>{0.908075929f, 0.347680271f},
-std::array<float,2>{0.366523236f, 0.526924968f},
-std::array<float,2>{0.145860091f, 0.0376253687f},
-std::array<float,2>{0.644002378f, 0.832374692f},
-std::array<float,2>{0.608346641f, 0.162985563f},
-std::array<float,2>{0.0112336492f, 0.999584734f},
-std::array<float,2>{0.43753916f, 0.449355245f},
-std::array<float,2>{0.769591868f, 0.749406755f},
-std::array<float,2>{0.963030338f, 0.228294387f},
-std::array<float,2>{0.259546459f, 0.900372088f},
-std::array<float,2>{0.215268582f, 0.40393433f},
-std::array<float,2>{0.709768236f, 0.655911446f},
-std::array<float,2>{0.532262743f, 0.308345973f},
-std::array<float,2>{0.0679732859f, 0.573364317f},
-std::array<float,2>{0.42015186f, 0.10124629f},
-std::array<float,2>{0.848465919f, 0.785335124f},
-std::array<float,2>{0.789692461f, 0.481032431f},
-std::array<float,2>{0.49989146f, 0.711320817f},
-std::array<float,2>{0.0367799066f, 0.131307393f},
-std::array<float,2>{0.572443068f, 0.957936466f},
-std::array<float,2>{0.672254086f, 0.00549210049f},
-std::array<float,2>{0.176019937f, 0.865632534f},
-std::array<float,2>{0.320273757f, 0.336191922f},
-std::array<float,2>{0.904091239f, 0.560652792f},
-std::array<float,2>{0.851613224f, 0.19866851f},
-std::array<float,2>{0.409968019f, 0.918961048f},
-std::array<float,2>{0.0774388313f, 0.424510866f},
-std::array<float,2>{0.541446149f, 0.67094332f},
-std::array<float,2>{0.713389516f, 0.277002543f},
-std::array<float,2>{0.204874903f, 0.611092985f},
-std::array<float,2>{0.256516606f, 0.0701188669f},
-std::array<float,2>{0.956717074f, 0.759477973f},
-std::array<float,2>{0.897110164f, 0.445299119f},
-std::array<float,2>{0.324241072f, 0.742017448f},
-std::array<float,2>{0.184972227f, 0.170045272f},
-std::array<float,2>{0.680989206f, 0.986680806f},
-std::array<float,2>{0.569049299f, 0.0451066904f},
-std::array<float,2>{0.0429455712f, 0.840088367f},
-std::array<float,2>{0.485656768f, 0.352463543f},
-std::array<float,2>{0.789060116f, 0.523238122f},
-std::array<float,2>{0.996480942f, 0.101911865f},
-std::array<float,2>{0.283793867f, 0.790428996f},
-std::array<float,2>{0.22176829f, 0.298563987f},
-std::array<float,2>{0.731145859f, 0.566414654f},
-std::array<float,2>{0.520423532f, 0.392858982f},
-std::array<float,2>{0.10076052f, 0.647794366f},
-std::array<float,2>{0.379028499f, 0.222214773f},
-std::array<float,2>{0.837284565f, 0.894389987f},
-std::array<float,2>{0.776780844f, 0.33577919f},
-std::array<float,2>{0.446438611f, 0.547281027f},
-std::array<float,2>{0.00513342721f, 0.0117087448f},
-std::array<float,2>{0.601222277f, 0.868476868f},
-std::array<float,2>{0.653823256f, 0.137734756f},
-std::array<float,2>{0.155695319f, 0.962967515f},
-std::array<float,2>{0.370756358f, 0.47596249f},
-std::array<float,2>{0.917009473f, 0.707584381f},
-std::array<float,2>{0.8068012f, 0.0156580266f},
-std::array<float,2>{0.470072329f, 0.85684216f},
-std::array<float,2>{0.0521699823f, 0.312809438f},
-std::array<float,2>{0.588614285f, 0.535251915f},
-std::array<float,2>{0.660386562f, 0.490202218f},
-std::array<float,2>{0.156979695f, 0.691207886f},
-std::array<float,2>{0.336542875f, 0.145963594f},
-std::array<float,2>{0.87641269f, 0.94147104f},
-std::array<float,2>{0.951966405f, 0.281354964f},
-std::array<float,2>{0.278372079f, 0.591931581f},
-std::array<float,2>{0.20279932f, 0.116687514f},
-std::array<float,2>{0.700010061f, 0.805098414f},
-std::array<float,2>{0.553628862f, 0.24174127f},
-std::array<float,2>{0.089102529f, 0.889458239f},
-std::array<float,2>{0.431458741f, 0.389179528f},
-std::array<float,2>{0.862724721f, 0.628534019f},
-std::array<float,2>{0.924566686f, 0.178867891f},
-std::array<float,2>{0.358984262f, 0.972102582f},
-std::array<float,2>{0.130154669f, 0.462518692f},
-std::array<float,2>{0.639826179f, 0.734203935f},
-std::array<float,2>{0.619791031f, 0.362944305f},
-std::array<float,2>{0.0175962858f, 0.503682077f},
-std::array<float,2>{0.460757762f, 0.0575242005f},
-std::array<float,2>{0.756650329f, 0.826534569f},
-std::array<float,2>{0.82407707f, 0.406456053f},
-std::array<float,2>{0.394212008f, 0.675130427f},
-std::array<float,2>{0.113442689f, 0.214808553f},
-std::array<float,2>{0.503698945f, 0.931525409f},
-std::array<float,2>{0.736677766f, 0.0833369941f},
-std::array<float,2>{0.244401038f, 0.767258108f},
-std::array<float,2>{0.306062996f, 0.25298351f},
-std::array<float,2>{0.978144169f, 0.596560419f}}
\ No newline at end of file
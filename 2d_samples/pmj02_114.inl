@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.142999634f, 0.93899405f},
-std::array<float,2>{0.996878445f, 0.342916161f},
-std::array<float,2>{0.255435437f, 0.121718846f},
-std::array<float,2>{0.586057484f, 0.531618953f},
-std::array<float,2>{0.392502964f, 0.669564724f},
-std::array<float,2>{0.65080297f, 0.141743794f},
-std::array<float,2>{0.114091389f, 0.406061918f},
-std::array<float,2>{0.754743814f, 0.850267768f},
-std::array<float,2>{0.37495783f, 0.776339889f},
-std::array<float,2>{0.524276078f, 0.49107942f},
-std::array<float,2>{0.213755608f, 0.213738993f},
-std::array<float,2>{0.928518653f, 0.715749145f},
-std::array<float,2>{0.0557675175f, 0.597274959f},
-std::array<float,2>{0.849480748f, 0.0180737413f},
-std::array<float,2>{0.473293841f, 0.254045457f},
-std::array<float,2>{0.719068527f, 0.914476693f},
-std::array<float,2>{0.0739931017f, 0.81411463f},
-std::array<float,2>{0.781419218f, 0.436620325f},
-std::array<float,2>{0.436714739f, 0.180802822f},
-std::array<float,2>{0.687499225f, 0.628586948f},
-std::array<float,2>{0.305606484f, 0.512340665f},
-std::array<float,2>{0.616241336f, 0.0702969506f},
-std::array<float,2>{0.18047601f, 0.364481032f},
-std::array<float,2>{0.941135883f, 0.984862328f},
-std::array<float,2>{0.443178654f, 0.892566741f},
-std::array<float,2>{0.709447205f, 0.304100275f},
-std::array<float,2>{0.00633319328f, 0.0466553941f},
-std::array<float,2>{0.833340585f, 0.588800073f},
-std::array<float,2>{0.221088991f, 0.747956991f},
-std::array<float,2>{0.883790672f, 0.220128223f},
-std::array<float,2>{0.34017393f, 0.439034879f},
-std::array<float,2>{0.535650611f, 0.797337949f},
-std::array<float,2>{0.19854933f, 0.781912029f},
-std::array<float,2>{0.916986346f, 0.464494199f},
-std::array<float,2>{0.353329271f, 0.235047638f},
-std::array<float,2>{0.509361386f, 0.725706637f},
-std::array<float,2>{0.490004778f, 0.563793957f},
-std::array<float,2>{0.749677181f, 0.0561093017f},
-std::array<float,2>{0.0323028155f, 0.290762395f},
-std::array<float,2>{0.863507569f, 0.88828069f},
-std::array<float,2>{0.276422054f, 0.977382481f},
-std::array<float,2>{0.571061254f, 0.357355714f},
-std::array<float,2>{0.130313754f, 0.0806049854f},
-std::array<float,2>{0.983469963f, 0.523358762f},
-std::array<float,2>{0.100785896f, 0.648377836f},
-std::array<float,2>{0.776182652f, 0.169511691f},
-std::array<float,2>{0.376303852f, 0.414606422f},
-std::array<float,2>{0.633367002f, 0.842158735f},
-std::array<float,2>{0.0209916178f, 0.929232717f},
-std::array<float,2>{0.825522959f, 0.2710343f},
-std::array<float,2>{0.462052375f, 0.0147214076f},
-std::array<float,2>{0.693261445f, 0.616098523f},
-std::array<float,2>{0.319880426f, 0.693402827f},
-std::array<float,2>{0.560353696f, 0.194109023f},
-std::array<float,2>{0.246847659f, 0.482337773f},
-std::array<float,2>{0.904524863f, 0.753030062f},
-std::array<float,2>{0.415201277f, 0.865373015f},
-std::array<float,2>{0.665639699f, 0.377694666f},
-std::array<float,2>{0.0900858268f, 0.13106893f},
-std::array<float,2>{0.798165619f, 0.686199486f},
-std::array<float,2>{0.170024693f, 0.551468432f},
-std::array<float,2>{0.95320791f, 0.106534503f},
-std::array<float,2>{0.284133136f, 0.314851344f},
-std::array<float,2>{0.596160889f, 0.964261293f},
-std::array<float,2>{0.236831695f, 0.875744104f},
-std::array<float,2>{0.897489846f, 0.28184256f},
-std::array<float,2>{0.322090119f, 0.0516715944f},
-std::array<float,2>{0.550208449f, 0.57262212f},
-std::array<float,2>{0.460024297f, 0.731333911f},
-std::array<float,2>{0.702343822f, 0.24263826f},
-std::array<float,2>{0.0293647777f, 0.458488971f},
-std::array<float,2>{0.812921822f, 0.790289879f},
-std::array<float,2>{0.290206492f, 0.831184089f},
-std::array<float,2>{0.602840066f, 0.406490594f},
-std::array<float,2>{0.16199325f, 0.163631186f},
-std::array<float,2>{0.965930223f, 0.65578115f},
-std::array<float,2>{0.0806412622f, 0.53064239f},
-std::array<float,2>{0.805481076f, 0.0922439024f},
-std::array<float,2>{0.406674981f, 0.345066518f},
-std::array<float,2>{0.660907984f, 0.968787849f},
-std::array<float,2>{0.0426950566f, 0.762941837f},
-std::array<float,2>{0.873823285f, 0.472918302f},
-std::array<float,2>{0.494226605f, 0.198889732f},
-std::array<float,2>{0.738686562f, 0.69877404f},
-std::array<float,2>{0.348595023f, 0.62454623f},
-std::array<float,2>{0.503929079f, 0.00611741422f},
-std::array<float,2>{0.193016529f, 0.279500484f},
-std::array<float,2>{0.907092214f, 0.932672441f},
-std::array<float,2>{0.385723352f, 0.954260409f},
-std::array<float,2>{0.626490057f, 0.327039272f},
-std::array<float,2>{0.108226717f, 0.10092444f},
-std::array<float,2>{0.769573033f, 0.559392869f},
-std::array<float,2>{0.13411282f, 0.672219992f},
-std::array<float,2>{0.970493674f, 0.138906762f},
-std::array<float,2>{0.269028872f, 0.387585998f},
-std::array<float,2>{0.564785182f, 0.868528008f},
-std::array<float,2>{0.178315699f, 0.851940334f},
-std::array<float,2>{0.950221419f, 0.392744243f},
-std::array<float,2>{0.302586317f, 0.150291517f},
-std::array<float,2>{0.622285128f, 0.66340214f},
-std::array<float,2>{0.422851056f, 0.543171823f},
-std::array<float,2>{0.674305797f, 0.112526312f},
-std::array<float,2>{0.0693662167f, 0.335004419f},
-std::array<float,2>{0.790629208f, 0.953041077f},
-std::array<float,2>{0.330951333f, 0.906565785f},
-std::array<float,2>{0.544435263f, 0.264311939f},
-std::array<float,2>{0.232919022f, 0.030109277f},
-std::array<float,2>{0.877261579f, 0.602666497f},
-std::array<float,2>{0.00862143561f, 0.70972538f},
-std::array<float,2>{0.840157807f, 0.206994385f},
-std::array<float,2>{0.452059746f, 0.497967541f},
-std::array<float,2>{0.718269348f, 0.772916973f},
-std::array<float,2>{0.118137404f, 0.999146461f},
-std::array<float,2>{0.762217641f, 0.374923855f},
-std::array<float,2>{0.403412908f, 0.0732324719f},
-std::array<float,2>{0.642740905f, 0.506609559f},
-std::array<float,2>{0.258179277f, 0.634349763f},
-std::array<float,2>{0.582047105f, 0.179643735f},
-std::array<float,2>{0.151971236f, 0.429479331f},
-std::array<float,2>{0.991127908f, 0.820680797f},
-std::array<float,2>{0.483071744f, 0.811825991f},
-std::array<float,2>{0.728048682f, 0.450657487f},
-std::array<float,2>{0.0483612083f, 0.232181683f},
-std::array<float,2>{0.855209768f, 0.741528332f},
-std::array<float,2>{0.20889236f, 0.583151102f},
-std::array<float,2>{0.929825366f, 0.0321729444f},
-std::array<float,2>{0.362371862f, 0.309295297f},
-std::array<float,2>{0.516334295f, 0.900673151f},
-std::array<float,2>{0.216863394f, 0.975843608f},
-std::array<float,2>{0.923619568f, 0.350703746f},
-std::array<float,2>{0.368585438f, 0.0870855004f},
-std::array<float,2>{0.528476357f, 0.52615416f},
-std::array<float,2>{0.469596446f, 0.650794923f},
-std::array<float,2>{0.726050436f, 0.156330496f},
-std::array<float,2>{0.0591997541f, 0.413572371f},
-std::array<float,2>{0.844774485f, 0.83312571f},
-std::array<float,2>{0.251749098f, 0.794162869f},
-std::array<float,2>{0.593519032f, 0.456876099f},
-std::array<float,2>{0.146189064f, 0.249681219f},
-std::array<float,2>{0.993718743f, 0.728294313f},
-std::array<float,2>{0.112283342f, 0.575062513f},
-std::array<float,2>{0.751771152f, 0.0501881056f},
-std::array<float,2>{0.396202981f, 0.286472976f},
-std::array<float,2>{0.654804528f, 0.881284893f},
-std::array<float,2>{0.00345097808f, 0.874140322f},
-std::array<float,2>{0.828510463f, 0.385875314f},
-std::array<float,2>{0.438411295f, 0.13449578f},
-std::array<float,2>{0.705702424f, 0.677841723f},
-std::array<float,2>{0.336304367f, 0.557174146f},
-std::array<float,2>{0.533900619f, 0.0966777056f},
-std::array<float,2>{0.224499658f, 0.320451945f},
-std::array<float,2>{0.887134135f, 0.959344864f},
-std::array<float,2>{0.432758629f, 0.935490549f},
-std::array<float,2>{0.683542728f, 0.27426514f},
-std::array<float,2>{0.0752661154f, 0.00050092343f},
-std::array<float,2>{0.787457883f, 0.618235409f},
-std::array<float,2>{0.18686685f, 0.700849354f},
-std::array<float,2>{0.942402005f, 0.200351357f},
-std::array<float,2>{0.309527427f, 0.470403552f},
-std::array<float,2>{0.609420359f, 0.760598063f},
-std::array<float,2>{0.126943961f, 0.76898849f},
-std::array<float,2>{0.980336249f, 0.495574355f},
-std::array<float,2>{0.278473318f, 0.208983988f},
-std::array<float,2>{0.577049494f, 0.703379512f},
-std::array<float,2>{0.381130397f, 0.60552913f},
-std::array<float,2>{0.640172839f, 0.0236134641f},
-std::array<float,2>{0.0940697342f, 0.257874936f},
-std::array<float,2>{0.780218959f, 0.912896335f},
-std::array<float,2>{0.358057141f, 0.948827624f},
-std::array<float,2>{0.513754189f, 0.328528076f},
-std::array<float,2>{0.202625439f, 0.114440113f},
-std::array<float,2>{0.918631375f, 0.541743338f},
-std::array<float,2>{0.038758792f, 0.658310294f},
-std::array<float,2>{0.862193882f, 0.154513955f},
-std::array<float,2>{0.485175401f, 0.394644767f},
-std::array<float,2>{0.744769752f, 0.856410563f},
-std::array<float,2>{0.0891508311f, 0.905390024f},
-std::array<float,2>{0.802886724f, 0.30525291f},
-std::array<float,2>{0.421402872f, 0.0363891982f},
-std::array<float,2>{0.66900897f, 0.581173182f},
-std::array<float,2>{0.286762714f, 0.736397564f},
-std::array<float,2>{0.599527538f, 0.230406478f},
-std::array<float,2>{0.167374969f, 0.448801041f},
-std::array<float,2>{0.957441092f, 0.806353807f},
-std::array<float,2>{0.466845989f, 0.826512694f},
-std::array<float,2>{0.690394819f, 0.425572544f},
-std::array<float,2>{0.017786108f, 0.175746724f},
-std::array<float,2>{0.822806895f, 0.639424682f},
-std::array<float,2>{0.243719667f, 0.502478719f},
-std::array<float,2>{0.900634706f, 0.0743657574f},
-std::array<float,2>{0.315212727f, 0.368184686f},
-std::array<float,2>{0.555637598f, 0.994265497f},
-std::array<float,2>{0.159327582f, 0.918152571f},
-std::array<float,2>{0.964595497f, 0.250701696f},
-std::array<float,2>{0.294330478f, 0.0229909979f},
-std::array<float,2>{0.609141529f, 0.600320756f},
-std::array<float,2>{0.410656899f, 0.714404702f},
-std::array<float,2>{0.659279466f, 0.21603024f},
-std::array<float,2>{0.082482785f, 0.484651655f},
-std::array<float,2>{0.80913502f, 0.779529095f},
-std::array<float,2>{0.325828522f, 0.845979393f},
-std::array<float,2>{0.552363396f, 0.400036335f},
-std::array<float,2>{0.238478571f, 0.14703013f},
-std::array<float,2>{0.893033803f, 0.665165246f},
-std::array<float,2>{0.0234620385f, 0.538183212f},
-std::array<float,2>{0.816496968f, 0.117262952f},
-std::array<float,2>{0.455891997f, 0.336234748f},
-std::array<float,2>{0.695505083f, 0.943912268f},
-std::array<float,2>{0.103775829f, 0.802794337f},
-std::array<float,2>{0.767220259f, 0.444508255f},
-std::array<float,2>{0.386887044f, 0.225787938f},
-std::array<float,2>{0.63146472f, 0.744380057f},
-std::array<float,2>{0.271342635f, 0.592065454f},
-std::array<float,2>{0.567071199f, 0.0413338244f},
-std::array<float,2>{0.138996691f, 0.300113618f},
-std::array<float,2>{0.97269839f, 0.896178067f},
-std::array<float,2>{0.496840984f, 0.988713443f},
-std::array<float,2>{0.735616207f, 0.36012736f},
-std::array<float,2>{0.0435076617f, 0.064718999f},
-std::array<float,2>{0.870020688f, 0.510424733f},
-std::array<float,2>{0.190944746f, 0.631641388f},
-std::array<float,2>{0.911367357f, 0.183746859f},
-std::array<float,2>{0.347481042f, 0.432847232f},
-std::array<float,2>{0.503495157f, 0.819217861f},
-std::array<float,2>{0.228173479f, 0.839467824f},
-std::array<float,2>{0.88054204f, 0.418778479f},
-std::array<float,2>{0.335534751f, 0.164936975f},
-std::array<float,2>{0.540851295f, 0.641208649f},
-std::array<float,2>{0.445386708f, 0.517045796f},
-std::array<float,2>{0.71099478f, 0.0848711133f},
-std::array<float,2>{0.0144190891f, 0.355208278f},
-std::array<float,2>{0.839127302f, 0.982335389f},
-std::array<float,2>{0.297516137f, 0.882898331f},
-std::array<float,2>{0.619162083f, 0.296736836f},
-std::array<float,2>{0.172453955f, 0.0593177341f},
-std::array<float,2>{0.94565773f, 0.56816262f},
-std::array<float,2>{0.0632946044f, 0.721669018f},
-std::array<float,2>{0.796750367f, 0.239940435f},
-std::array<float,2>{0.426293314f, 0.46557191f},
-std::array<float,2>{0.678223729f, 0.785882175f},
-std::array<float,2>{0.0512147211f, 0.967128396f},
-std::array<float,2>{0.858476043f, 0.31900081f},
-std::array<float,2>{0.479120225f, 0.105431177f},
-std::array<float,2>{0.730674505f, 0.549383223f},
-std::array<float,2>{0.364753336f, 0.68215102f},
-std::array<float,2>{0.523053646f, 0.127570987f},
-std::array<float,2>{0.207018137f, 0.382242858f},
-std::array<float,2>{0.936349034f, 0.862064302f},
-std::array<float,2>{0.398757607f, 0.757583082f},
-std::array<float,2>{0.646971464f, 0.479417384f},
-std::array<float,2>{0.123155288f, 0.191042066f},
-std::array<float,2>{0.760156035f, 0.689183295f},
-std::array<float,2>{0.154613048f, 0.609421968f},
-std::array<float,2>{0.985397756f, 0.00962311868f},
-std::array<float,2>{0.264311194f, 0.267118603f},
-std::array<float,2>{0.57828778f, 0.925178945f},
-std::array<float,2>{0.181728274f, 0.987721145f},
-std::array<float,2>{0.937629521f, 0.367045432f},
-std::array<float,2>{0.307277322f, 0.068299748f},
-std::array<float,2>{0.614459753f, 0.514696717f},
-std::array<float,2>{0.435471416f, 0.625531495f},
-std::array<float,2>{0.683980227f, 0.181797922f},
-std::array<float,2>{0.0721170828f, 0.434678733f},
-std::array<float,2>{0.784471035f, 0.815910578f},
-std::array<float,2>{0.341819465f, 0.798949003f},
-std::array<float,2>{0.538799942f, 0.440338254f},
-std::array<float,2>{0.218911663f, 0.221360907f},
-std::array<float,2>{0.885673463f, 0.74992919f},
-std::array<float,2>{0.00578554999f, 0.587535322f},
-std::array<float,2>{0.834659457f, 0.0446460061f},
-std::array<float,2>{0.444266051f, 0.301345706f},
-std::array<float,2>{0.708732784f, 0.893901944f},
-std::array<float,2>{0.115792692f, 0.848445535f},
-std::array<float,2>{0.756538272f, 0.404223382f},
-std::array<float,2>{0.393339813f, 0.14352192f},
-std::array<float,2>{0.649878621f, 0.671114743f},
-std::array<float,2>{0.256723523f, 0.533652246f},
-std::array<float,2>{0.587935269f, 0.124199398f},
-std::array<float,2>{0.140769422f, 0.339942038f},
-std::array<float,2>{0.998205662f, 0.941185236f},
-std::array<float,2>{0.474949002f, 0.916308284f},
-std::array<float,2>{0.722029448f, 0.255888343f},
-std::array<float,2>{0.0570896007f, 0.015691001f},
-std::array<float,2>{0.850172043f, 0.595638633f},
-std::array<float,2>{0.212735668f, 0.71789819f},
-std::array<float,2>{0.927441478f, 0.211759999f},
-std::array<float,2>{0.371679276f, 0.488831043f},
-std::array<float,2>{0.526554167f, 0.773650289f},
-std::array<float,2>{0.249470547f, 0.751414657f},
-std::array<float,2>{0.904179096f, 0.483000219f},
-std::array<float,2>{0.317267716f, 0.192223147f},
-std::array<float,2>{0.561893523f, 0.692230582f},
-std::array<float,2>{0.463742644f, 0.614623368f},
-std::array<float,2>{0.695271671f, 0.0131861167f},
-std::array<float,2>{0.0218854863f, 0.273170114f},
-std::array<float,2>{0.827625334f, 0.927658737f},
-std::array<float,2>{0.282821923f, 0.96100229f},
-std::array<float,2>{0.594485581f, 0.313769042f},
-std::array<float,2>{0.168671817f, 0.109215312f},
-std::array<float,2>{0.955370426f, 0.552877665f},
-std::array<float,2>{0.0919980034f, 0.685177207f},
-std::array<float,2>{0.800176263f, 0.13064608f},
-std::array<float,2>{0.417304397f, 0.376294762f},
-std::array<float,2>{0.666314006f, 0.864473939f},
-std::array<float,2>{0.0334931947f, 0.889187634f},
-std::array<float,2>{0.865614772f, 0.292282373f},
-std::array<float,2>{0.491402596f, 0.0582516454f},
-std::array<float,2>{0.747495234f, 0.564861476f},
-std::array<float,2>{0.354704112f, 0.723920405f},
-std::array<float,2>{0.511204362f, 0.237880111f},
-std::array<float,2>{0.19607909f, 0.462095618f},
-std::array<float,2>{0.91487956f, 0.783921838f},
-std::array<float,2>{0.377519935f, 0.840382636f},
-std::array<float,2>{0.636349678f, 0.417746097f},
-std::array<float,2>{0.0977042839f, 0.17032738f},
-std::array<float,2>{0.774707556f, 0.646166861f},
-std::array<float,2>{0.131094024f, 0.520660758f},
-std::array<float,2>{0.981076658f, 0.078773886f},
-std::array<float,2>{0.274089962f, 0.359326303f},
-std::array<float,2>{0.572311044f, 0.979880154f},
-std::array<float,2>{0.195303097f, 0.929804027f},
-std::array<float,2>{0.908575058f, 0.277901828f},
-std::array<float,2>{0.350259453f, 0.00428873021f},
-std::array<float,2>{0.506289959f, 0.621558309f},
-std::array<float,2>{0.492858201f, 0.695542455f},
-std::array<float,2>{0.741326213f, 0.195594728f},
-std::array<float,2>{0.039100267f, 0.47635752f},
-std::array<float,2>{0.872368693f, 0.765080512f},
-std::array<float,2>{0.267048657f, 0.869575024f},
-std::array<float,2>{0.562779605f, 0.390408695f},
-std::array<float,2>{0.136395797f, 0.137409925f},
-std::array<float,2>{0.972214043f, 0.675197661f},
-std::array<float,2>{0.107282087f, 0.561159611f},
-std::array<float,2>{0.77341944f, 0.0983294323f},
-std::array<float,2>{0.382966071f, 0.325593978f},
-std::array<float,2>{0.627795279f, 0.955114782f},
-std::array<float,2>{0.0283695888f, 0.791198552f},
-std::array<float,2>{0.81475991f, 0.459396392f},
-std::array<float,2>{0.458666831f, 0.245923743f},
-std::array<float,2>{0.700512409f, 0.73403585f},
-std::array<float,2>{0.323126018f, 0.571171105f},
-std::array<float,2>{0.547294378f, 0.0540680811f},
-std::array<float,2>{0.234523565f, 0.284568965f},
-std::array<float,2>{0.8956213f, 0.878577173f},
-std::array<float,2>{0.409547478f, 0.971969664f},
-std::array<float,2>{0.663406432f, 0.34616074f},
-std::array<float,2>{0.0789876729f, 0.0913414583f},
-std::array<float,2>{0.808140874f, 0.528868079f},
-std::array<float,2>{0.163880646f, 0.653407693f},
-std::array<float,2>{0.966885686f, 0.1603643f},
-std::array<float,2>{0.2922225f, 0.409705698f},
-std::array<float,2>{0.60490489f, 0.830024123f},
-std::array<float,2>{0.149940461f, 0.823629081f},
-std::array<float,2>{0.98887521f, 0.427166641f},
-std::array<float,2>{0.260128498f, 0.176580191f},
-std::array<float,2>{0.585889161f, 0.636427641f},
-std::array<float,2>{0.405286044f, 0.504819512f},
-std::array<float,2>{0.640807033f, 0.0714473426f},
-std::array<float,2>{0.1199449f, 0.371499389f},
-std::array<float,2>{0.763860047f, 0.997373283f},
-std::array<float,2>{0.361305833f, 0.898977816f},
-std::array<float,2>{0.519276917f, 0.310827523f},
-std::array<float,2>{0.20964694f, 0.0335671529f},
-std::array<float,2>{0.931906998f, 0.585492611f},
-std::array<float,2>{0.0500366911f, 0.739780366f},
-std::array<float,2>{0.852617741f, 0.232880726f},
-std::array<float,2>{0.481442183f, 0.452396274f},
-std::array<float,2>{0.728808701f, 0.80913645f},
-std::array<float,2>{0.0670974702f, 0.949748337f},
-std::array<float,2>{0.791995704f, 0.333191454f},
-std::array<float,2>{0.424228162f, 0.110368915f},
-std::array<float,2>{0.672779977f, 0.546430588f},
-std::array<float,2>{0.303836197f, 0.661553681f},
-std::array<float,2>{0.624590218f, 0.151891306f},
-std::array<float,2>{0.175797239f, 0.391457856f},
-std::array<float,2>{0.952572644f, 0.854290903f},
-std::array<float,2>{0.449570954f, 0.769533694f},
-std::array<float,2>{0.714973927f, 0.49891609f},
-std::array<float,2>{0.0098397499f, 0.203608692f},
-std::array<float,2>{0.842360198f, 0.708747506f},
-std::array<float,2>{0.230577171f, 0.604435921f},
-std::array<float,2>{0.875790656f, 0.0275832489f},
-std::array<float,2>{0.328125358f, 0.262030065f},
-std::array<float,2>{0.546611726f, 0.910035789f},
-std::array<float,2>{0.225862384f, 0.958739221f},
-std::array<float,2>{0.890510082f, 0.324125618f},
-std::array<float,2>{0.339294702f, 0.094435297f},
-std::array<float,2>{0.532465339f, 0.555047095f},
-std::array<float,2>{0.440556705f, 0.677087188f},
-std::array<float,2>{0.704433978f, 0.135021329f},
-std::array<float,2>{0.00151024119f, 0.383976787f},
-std::array<float,2>{0.831448138f, 0.872622192f},
-std::array<float,2>{0.311536461f, 0.759178698f},
-std::array<float,2>{0.612855613f, 0.472403526f},
-std::array<float,2>{0.184620425f, 0.201745778f},
-std::array<float,2>{0.945131123f, 0.701797128f},
-std::array<float,2>{0.0762096345f, 0.620654047f},
-std::array<float,2>{0.785417378f, 0.0021388398f},
-std::array<float,2>{0.430300832f, 0.277112633f},
-std::array<float,2>{0.680349946f, 0.93723762f},
-std::array<float,2>{0.0609169453f, 0.83438617f},
-std::array<float,2>{0.846295357f, 0.410628617f},
-std::array<float,2>{0.471542478f, 0.15891102f},
-std::array<float,2>{0.723604023f, 0.649297893f},
-std::array<float,2>{0.369400352f, 0.524340987f},
-std::array<float,2>{0.529920936f, 0.088143602f},
-std::array<float,2>{0.215771943f, 0.348987252f},
-std::array<float,2>{0.92440027f, 0.974418163f},
-std::array<float,2>{0.396853566f, 0.879890144f},
-std::array<float,2>{0.653176308f, 0.287356406f},
-std::array<float,2>{0.111167461f, 0.0479466356f},
-std::array<float,2>{0.752321959f, 0.576991677f},
-std::array<float,2>{0.147979677f, 0.728948712f},
-std::array<float,2>{0.994435787f, 0.246466652f},
-std::array<float,2>{0.252482742f, 0.454275489f},
-std::array<float,2>{0.590828359f, 0.796603084f},
-std::array<float,2>{0.165428564f, 0.807045579f},
-std::array<float,2>{0.959216654f, 0.446747333f},
-std::array<float,2>{0.287228078f, 0.227070004f},
-std::array<float,2>{0.60086447f, 0.735000432f},
-std::array<float,2>{0.418594927f, 0.579405785f},
-std::array<float,2>{0.671344042f, 0.0382927842f},
-std::array<float,2>{0.0877646506f, 0.308249801f},
-std::array<float,2>{0.802725077f, 0.902892768f},
-std::array<float,2>{0.312928468f, 0.992304623f},
-std::array<float,2>{0.556855857f, 0.370668232f},
-std::array<float,2>{0.245413005f, 0.0764255896f},
-std::array<float,2>{0.900263071f, 0.501440823f},
-std::array<float,2>{0.0156789143f, 0.638022244f},
-std::array<float,2>{0.821466386f, 0.173003972f},
-std::array<float,2>{0.465000153f, 0.422965288f},
-std::array<float,2>{0.687711537f, 0.826058924f},
-std::array<float,2>{0.0972456411f, 0.91043359f},
-std::array<float,2>{0.778567851f, 0.260002553f},
-std::array<float,2>{0.379881442f, 0.0272776056f},
-std::array<float,2>{0.636860967f, 0.608985364f},
-std::array<float,2>{0.279500157f, 0.70594877f},
-std::array<float,2>{0.575312018f, 0.209379584f},
-std::array<float,2>{0.12804018f, 0.492959678f},
-std::array<float,2>{0.97843349f, 0.767300844f},
-std::array<float,2>{0.486635596f, 0.858010173f},
-std::array<float,2>{0.743436635f, 0.397334337f},
-std::array<float,2>{0.036542207f, 0.153816253f},
-std::array<float,2>{0.860663176f, 0.65746516f},
-std::array<float,2>{0.199801967f, 0.54085511f},
-std::array<float,2>{0.920537829f, 0.116302207f},
-std::array<float,2>{0.356789052f, 0.331498861f},
-std::array<float,2>{0.512390673f, 0.945989788f},
-std::array<float,2>{0.138413891f, 0.897506297f},
-std::array<float,2>{0.974838316f, 0.298443615f},
-std::array<float,2>{0.273120552f, 0.0395941511f},
-std::array<float,2>{0.568701804f, 0.590977669f},
-std::array<float,2>{0.389127791f, 0.743823588f},
-std::array<float,2>{0.629938424f, 0.224354506f},
-std::array<float,2>{0.102701955f, 0.443115622f},
-std::array<float,2>{0.768517613f, 0.802074254f},
-std::array<float,2>{0.344734609f, 0.817796528f},
-std::array<float,2>{0.500569463f, 0.430855572f},
-std::array<float,2>{0.188979939f, 0.186569765f},
-std::array<float,2>{0.913863361f, 0.630019963f},
-std::array<float,2>{0.0453497507f, 0.508167744f},
-std::array<float,2>{0.868176699f, 0.0630796403f},
-std::array<float,2>{0.499113619f, 0.361371726f},
-std::array<float,2>{0.737861812f, 0.99178046f},
-std::array<float,2>{0.0844146311f, 0.777638376f},
-std::array<float,2>{0.812392533f, 0.486685038f},
-std::array<float,2>{0.412911892f, 0.217124879f},
-std::array<float,2>{0.657737017f, 0.712644577f},
-std::array<float,2>{0.294996053f, 0.597820103f},
-std::array<float,2>{0.605748057f, 0.0199370999f},
-std::array<float,2>{0.158125132f, 0.253406048f},
-std::array<float,2>{0.96144563f, 0.921083331f},
-std::array<float,2>{0.454978257f, 0.942168474f},
-std::array<float,2>{0.697916329f, 0.33906284f},
-std::array<float,2>{0.0262333304f, 0.120470963f},
-std::array<float,2>{0.82013762f, 0.535312116f},
-std::array<float,2>{0.24046275f, 0.667509139f},
-std::array<float,2>{0.890906036f, 0.145842671f},
-std::array<float,2>{0.32623148f, 0.401673734f},
-std::array<float,2>{0.554145217f, 0.843755007f},
-std::array<float,2>{0.203500584f, 0.859610081f},
-std::array<float,2>{0.934783518f, 0.379129231f},
-std::array<float,2>{0.366710901f, 0.125469685f},
-std::array<float,2>{0.520367324f, 0.681113243f},
-std::array<float,2>{0.477757514f, 0.546987414f},
-std::array<float,2>{0.733056247f, 0.101767041f},
-std::array<float,2>{0.0535400398f, 0.318002194f},
-std::array<float,2>{0.8571105f, 0.966779113f},
-std::array<float,2>{0.26208818f, 0.921986222f},
-std::array<float,2>{0.580870569f, 0.268302113f},
-std::array<float,2>{0.153483585f, 0.011358832f},
-std::array<float,2>{0.987433612f, 0.612321436f},
-std::array<float,2>{0.121913418f, 0.691061914f},
-std::array<float,2>{0.758542061f, 0.18932128f},
-std::array<float,2>{0.401575297f, 0.477674812f},
-std::array<float,2>{0.645428836f, 0.754386127f},
-std::array<float,2>{0.0117539335f, 0.983315825f},
-std::array<float,2>{0.837463021f, 0.353264809f},
-std::array<float,2>{0.448848128f, 0.0837578624f},
-std::array<float,2>{0.714739025f, 0.518648088f},
-std::array<float,2>{0.332825184f, 0.644359887f},
-std::array<float,2>{0.542230904f, 0.167574406f},
-std::array<float,2>{0.229716375f, 0.421539873f},
-std::array<float,2>{0.881836057f, 0.837890208f},
-std::array<float,2>{0.429683208f, 0.787512898f},
-std::array<float,2>{0.676090121f, 0.468329906f},
-std::array<float,2>{0.0651618615f, 0.240611523f},
-std::array<float,2>{0.794353187f, 0.718976498f},
-std::array<float,2>{0.175729826f, 0.569655061f},
-std::array<float,2>{0.948970675f, 0.0605492033f},
-std::array<float,2>{0.299621642f, 0.293207139f},
-std::array<float,2>{0.61740905f, 0.885262489f},
-std::array<float,2>{0.16974856f, 0.963798761f},
-std::array<float,2>{0.956799209f, 0.316239357f},
-std::array<float,2>{0.281322211f, 0.106398143f},
-std::array<float,2>{0.595617831f, 0.552481472f},
-std::array<float,2>{0.416677505f, 0.68711108f},
-std::array<float,2>{0.667892694f, 0.132083729f},
-std::array<float,2>{0.0932490826f, 0.37799558f},
-std::array<float,2>{0.799153388f, 0.866280556f},
-std::array<float,2>{0.318052322f, 0.752839029f},
-std::array<float,2>{0.561170459f, 0.480824351f},
-std::array<float,2>{0.248476312f, 0.194817871f},
-std::array<float,2>{0.903093219f, 0.694894373f},
-std::array<float,2>{0.022697866f, 0.616750002f},
-std::array<float,2>{0.826738954f, 0.0141258892f},
-std::array<float,2>{0.463901728f, 0.26976499f},
-std::array<float,2>{0.693560302f, 0.928685844f},
-std::array<float,2>{0.0988671184f, 0.84339577f},
-std::array<float,2>{0.773968458f, 0.415269405f},
-std::array<float,2>{0.377947599f, 0.168660775f},
-std::array<float,2>{0.634911418f, 0.647388279f},
-std::array<float,2>{0.275338054f, 0.521720111f},
-std::array<float,2>{0.573524356f, 0.0820157826f},
-std::array<float,2>{0.132744923f, 0.355481178f},
-std::array<float,2>{0.982402623f, 0.977550089f},
-std::array<float,2>{0.491125584f, 0.886836112f},
-std::array<float,2>{0.746783674f, 0.289746106f},
-std::array<float,2>{0.0342404991f, 0.0548375882f},
-std::array<float,2>{0.866237462f, 0.562979043f},
-std::array<float,2>{0.196752414f, 0.725568116f},
-std::array<float,2>{0.915816128f, 0.23617208f},
-std::array<float,2>{0.353966057f, 0.4631657f},
-std::array<float,2>{0.509976149f, 0.782471657f},
-std::array<float,2>{0.219952285f, 0.79812938f},
-std::array<float,2>{0.885980725f, 0.438354611f},
-std::array<float,2>{0.34334144f, 0.218973309f},
-std::array<float,2>{0.537146151f, 0.746257663f},
-std::array<float,2>{0.444723785f, 0.588948011f},
-std::array<float,2>{0.707553148f, 0.0451548547f},
-std::array<float,2>{0.00408505509f, 0.303185999f},
-std::array<float,2>{0.835527658f, 0.890982449f},
-std::array<float,2>{0.308376491f, 0.986066103f},
-std::array<float,2>{0.614218771f, 0.363544166f},
-std::array<float,2>{0.182998821f, 0.0687432811f},
-std::array<float,2>{0.938902736f, 0.513653457f},
-std::array<float,2>{0.0704839602f, 0.627239525f},
-std::array<float,2>{0.783352494f, 0.180462331f},
-std::array<float,2>{0.433813095f, 0.436324328f},
-std::array<float,2>{0.684760988f, 0.813384473f},
-std::array<float,2>{0.0577696636f, 0.915547848f},
-std::array<float,2>{0.850847244f, 0.255366266f},
-std::array<float,2>{0.475848287f, 0.0192134641f},
-std::array<float,2>{0.720863104f, 0.596354246f},
-std::array<float,2>{0.372956336f, 0.716092646f},
-std::array<float,2>{0.526068926f, 0.213918284f},
-std::array<float,2>{0.211702377f, 0.491990566f},
-std::array<float,2>{0.926327705f, 0.776546001f},
-std::array<float,2>{0.39374423f, 0.850989342f},
-std::array<float,2>{0.649106741f, 0.404520929f},
-std::array<float,2>{0.116468906f, 0.140978798f},
-std::array<float,2>{0.757452071f, 0.668533623f},
-std::array<float,2>{0.141657606f, 0.532821715f},
-std::array<float,2>{0.999353468f, 0.122082591f},
-std::array<float,2>{0.257419199f, 0.342662513f},
-std::array<float,2>{0.589721441f, 0.937528789f},
-std::array<float,2>{0.210541129f, 0.901964188f},
-std::array<float,2>{0.933234394f, 0.310432941f},
-std::array<float,2>{0.360136241f, 0.0325564183f},
-std::array<float,2>{0.518382668f, 0.582966685f},
-std::array<float,2>{0.482165426f, 0.740500867f},
-std::array<float,2>{0.730104983f, 0.230679989f},
-std::array<float,2>{0.0494192913f, 0.450095087f},
-std::array<float,2>{0.852008939f, 0.810892403f},
-std::array<float,2>{0.261583716f, 0.821534574f},
-std::array<float,2>{0.584824979f, 0.428040177f},
-std::array<float,2>{0.148618549f, 0.177955672f},
-std::array<float,2>{0.989623725f, 0.633642137f},
-std::array<float,2>{0.120958842f, 0.50757885f},
-std::array<float,2>{0.764680743f, 0.0738303438f},
-std::array<float,2>{0.405266315f, 0.373245478f},
-std::array<float,2>{0.642137587f, 0.998449862f},
-std::array<float,2>{0.0115472861f, 0.772426903f},
-std::array<float,2>{0.842798889f, 0.496310532f},
-std::array<float,2>{0.450727791f, 0.205360621f},
-std::array<float,2>{0.715909839f, 0.710443199f},
-std::array<float,2>{0.329541445f, 0.602199733f},
-std::array<float,2>{0.545280039f, 0.0302934293f},
-std::array<float,2>{0.232256427f, 0.265414387f},
-std::array<float,2>{0.876619399f, 0.907809436f},
-std::array<float,2>{0.425527036f, 0.951415598f},
-std::array<float,2>{0.672868013f, 0.334731072f},
-std::array<float,2>{0.0675261915f, 0.111980267f},
-std::array<float,2>{0.791084051f, 0.543951452f},
-std::array<float,2>{0.177627206f, 0.662647426f},
-std::array<float,2>{0.951814294f, 0.148496047f},
-std::array<float,2>{0.303199351f, 0.394160151f},
-std::array<float,2>{0.624001265f, 0.852725208f},
-std::array<float,2>{0.135574922f, 0.867400706f},
-std::array<float,2>{0.970909715f, 0.387814045f},
-std::array<float,2>{0.266394794f, 0.140069455f},
-std::array<float,2>{0.563537478f, 0.673604667f},
-std::array<float,2>{0.384099275f, 0.560284495f},
-std::array<float,2>{0.6285972f, 0.100168914f},
-std::array<float,2>{0.10611701f, 0.327542454f},
-std::array<float,2>{0.771665156f, 0.953665078f},
-std::array<float,2>{0.350804389f, 0.931874394f},
-std::array<float,2>{0.507068098f, 0.280337572f},
-std::array<float,2>{0.193849489f, 0.00753662782f},
-std::array<float,2>{0.909256697f, 0.623839736f},
-std::array<float,2>{0.0409674086f, 0.697892427f},
-std::array<float,2>{0.871141493f, 0.197279274f},
-std::array<float,2>{0.493206441f, 0.473891854f},
-std::array<float,2>{0.740317583f, 0.762592316f},
-std::array<float,2>{0.0793719739f, 0.97064817f},
-std::array<float,2>{0.807170093f, 0.344527066f},
-std::array<float,2>{0.408597529f, 0.0930935666f},
-std::array<float,2>{0.662119687f, 0.530270994f},
-std::array<float,2>{0.291159004f, 0.65504849f},
-std::array<float,2>{0.603776813f, 0.163045928f},
-std::array<float,2>{0.162292063f, 0.407796979f},
-std::array<float,2>{0.968672395f, 0.830771327f},
-std::array<float,2>{0.457538754f, 0.789174199f},
-std::array<float,2>{0.699791253f, 0.457822353f},
-std::array<float,2>{0.0274942331f, 0.244102329f},
-std::array<float,2>{0.815447748f, 0.73167479f},
-std::array<float,2>{0.236271471f, 0.573641539f},
-std::array<float,2>{0.895245254f, 0.0526434928f},
-std::array<float,2>{0.323787093f, 0.283175856f},
-std::array<float,2>{0.548821151f, 0.87598151f},
-std::array<float,2>{0.244785666f, 0.995189548f},
-std::array<float,2>{0.898596227f, 0.368050545f},
-std::array<float,2>{0.314371705f, 0.0755634084f},
-std::array<float,2>{0.558537483f, 0.50356859f},
-std::array<float,2>{0.466330737f, 0.639878869f},
-std::array<float,2>{0.688983083f, 0.174284041f},
-std::array<float,2>{0.0172110666f, 0.424111247f},
-std::array<float,2>{0.821150303f, 0.827998698f},
-std::array<float,2>{0.288802177f, 0.805212617f},
-std::array<float,2>{0.599875987f, 0.447913408f},
-std::array<float,2>{0.164177343f, 0.228915587f},
-std::array<float,2>{0.960113347f, 0.738143563f},
-std::array<float,2>{0.0868215039f, 0.580482244f},
-std::array<float,2>{0.801567733f, 0.035905052f},
-std::array<float,2>{0.419594169f, 0.306309402f},
-std::array<float,2>{0.670764267f, 0.904495478f},
-std::array<float,2>{0.0356809013f, 0.857313395f},
-std::array<float,2>{0.860095143f, 0.395824045f},
-std::array<float,2>{0.487708449f, 0.155410096f},
-std::array<float,2>{0.742633164f, 0.659292161f},
-std::array<float,2>{0.355648577f, 0.542960346f},
-std::array<float,2>{0.512770891f, 0.113630623f},
-std::array<float,2>{0.20051387f, 0.329658002f},
-std::array<float,2>{0.921230316f, 0.947293222f},
-std::array<float,2>{0.380318105f, 0.913755476f},
-std::array<float,2>{0.637945533f, 0.259716272f},
-std::array<float,2>{0.0962786674f, 0.0249729883f},
-std::array<float,2>{0.77805984f, 0.606847346f},
-std::array<float,2>{0.127099827f, 0.704763591f},
-std::array<float,2>{0.97712791f, 0.207730919f},
-std::array<float,2>{0.280370653f, 0.494420201f},
-std::array<float,2>{0.575127721f, 0.768166006f},
-std::array<float,2>{0.183906719f, 0.761019945f},
-std::array<float,2>{0.943651736f, 0.469554573f},
-std::array<float,2>{0.311004996f, 0.199343756f},
-std::array<float,2>{0.611650169f, 0.699239075f},
-std::array<float,2>{0.431307167f, 0.617526889f},
-std::array<float,2>{0.680745542f, 0.00138642325f},
-std::array<float,2>{0.0777573511f, 0.275017232f},
-std::array<float,2>{0.786698461f, 0.934254348f},
-std::array<float,2>{0.338097751f, 0.960840404f},
-std::array<float,2>{0.5314942f, 0.321823865f},
-std::array<float,2>{0.224988595f, 0.0969082415f},
-std::array<float,2>{0.889366508f, 0.557954311f},
-std::array<float,2>{0.000826904841f, 0.679022908f},
-std::array<float,2>{0.83069545f, 0.133552611f},
-std::array<float,2>{0.43972981f, 0.384850234f},
-std::array<float,2>{0.703611732f, 0.873609066f},
-std::array<float,2>{0.109919712f, 0.882166564f},
-std::array<float,2>{0.753642678f, 0.285695404f},
-std::array<float,2>{0.397562206f, 0.0493753962f},
-std::array<float,2>{0.653409719f, 0.575531542f},
-std::array<float,2>{0.253078133f, 0.726725221f},
-std::array<float,2>{0.590157926f, 0.248166203f},
-std::array<float,2>{0.146647274f, 0.455230087f},
-std::array<float,2>{0.995324731f, 0.793377936f},
-std::array<float,2>{0.472314447f, 0.832535326f},
-std::array<float,2>{0.724317372f, 0.41253823f},
-std::array<float,2>{0.0622121319f, 0.158176869f},
-std::array<float,2>{0.847589552f, 0.652085364f},
-std::array<float,2>{0.216793701f, 0.526496887f},
-std::array<float,2>{0.925403297f, 0.0860287398f},
-std::array<float,2>{0.370277494f, 0.350481302f},
-std::array<float,2>{0.531058371f, 0.975318134f},
-std::array<float,2>{0.152632892f, 0.924080312f},
-std::array<float,2>{0.986596465f, 0.265869379f},
-std::array<float,2>{0.26308468f, 0.00818660017f},
-std::array<float,2>{0.581784785f, 0.610532403f},
-std::array<float,2>{0.400973558f, 0.687847614f},
-std::array<float,2>{0.646389127f, 0.190003783f},
-std::array<float,2>{0.122668572f, 0.479665309f},
-std::array<float,2>{0.758986533f, 0.756605864f},
-std::array<float,2>{0.365573913f, 0.862440705f},
-std::array<float,2>{0.520846725f, 0.381266534f},
-std::array<float,2>{0.204356402f, 0.128789514f},
-std::array<float,2>{0.933830261f, 0.683280647f},
-std::array<float,2>{0.0539974533f, 0.550201058f},
-std::array<float,2>{0.855852842f, 0.103904545f},
-std::array<float,2>{0.477161676f, 0.32019189f},
-std::array<float,2>{0.734094381f, 0.968541086f},
-std::array<float,2>{0.0662284866f, 0.786152184f},
-std::array<float,2>{0.793250263f, 0.466330588f},
-std::array<float,2>{0.428266734f, 0.238926858f},
-std::array<float,2>{0.677588522f, 0.722506702f},
-std::array<float,2>{0.299979448f, 0.567147255f},
-std::array<float,2>{0.618376493f, 0.0601887517f},
-std::array<float,2>{0.174316838f, 0.295638949f},
-std::array<float,2>{0.947278082f, 0.884474933f},
-std::array<float,2>{0.447393924f, 0.980923057f},
-std::array<float,2>{0.713544905f, 0.353605062f},
-std::array<float,2>{0.0130692832f, 0.0859264955f},
-std::array<float,2>{0.836712182f, 0.516341627f},
-std::array<float,2>{0.228601009f, 0.641774118f},
-std::array<float,2>{0.881158888f, 0.165405184f},
-std::array<float,2>{0.333112836f, 0.418969095f},
-std::array<float,2>{0.541817605f, 0.83805567f},
-std::array<float,2>{0.187744334f, 0.819997966f},
-std::array<float,2>{0.91224581f, 0.432601333f},
-std::array<float,2>{0.344284236f, 0.185479328f},
-std::array<float,2>{0.501254678f, 0.632803082f},
-std::array<float,2>{0.498911768f, 0.51079005f},
-std::array<float,2>{0.736452878f, 0.0659994036f},
-std::array<float,2>{0.0461807661f, 0.360865027f},
-std::array<float,2>{0.867276728f, 0.989390373f},
-std::array<float,2>{0.271944731f, 0.894809067f},
-std::array<float,2>{0.56983453f, 0.299396873f},
-std::array<float,2>{0.137081578f, 0.0426993296f},
-std::array<float,2>{0.97643441f, 0.592959106f},
-std::array<float,2>{0.101989046f, 0.745903015f},
-std::array<float,2>{0.769109428f, 0.224629f},
-std::array<float,2>{0.389737725f, 0.443629682f},
-std::array<float,2>{0.629561543f, 0.803840697f},
-std::array<float,2>{0.0266954266f, 0.944352448f},
-std::array<float,2>{0.818937123f, 0.336985022f},
-std::array<float,2>{0.453612179f, 0.118927799f},
-std::array<float,2>{0.698758125f, 0.537663937f},
-std::array<float,2>{0.327181011f, 0.664660871f},
-std::array<float,2>{0.553617239f, 0.148257196f},
-std::array<float,2>{0.241961315f, 0.398604602f},
-std::array<float,2>{0.891685307f, 0.846811533f},
-std::array<float,2>{0.413545549f, 0.780287921f},
-std::array<float,2>{0.656615734f, 0.485493332f},
-std::array<float,2>{0.0853408724f, 0.215418413f},
-std::array<float,2>{0.811236739f, 0.713003576f},
-std::array<float,2>{0.156971261f, 0.600906432f},
-std::array<float,2>{0.962749481f, 0.022314027f},
-std::array<float,2>{0.296710223f, 0.251755208f},
-std::array<float,2>{0.607245207f, 0.919592619f},
-std::array<float,2>{0.129294068f, 0.979451835f},
-std::array<float,2>{0.982791066f, 0.357913584f},
-std::array<float,2>{0.276244015f, 0.0795683637f},
-std::array<float,2>{0.571936011f, 0.519830763f},
-std::array<float,2>{0.375698358f, 0.645062149f},
-std::array<float,2>{0.634029984f, 0.171339765f},
-std::array<float,2>{0.10021393f, 0.416689545f},
-std::array<float,2>{0.77705127f, 0.841134548f},
-std::array<float,2>{0.352055013f, 0.784585953f},
-std::array<float,2>{0.508227646f, 0.461883813f},
-std::array<float,2>{0.197784916f, 0.237095043f},
-std::array<float,2>{0.917940021f, 0.72315222f},
-std::array<float,2>{0.0321139321f, 0.566011429f},
-std::array<float,2>{0.864854336f, 0.0567997135f},
-std::array<float,2>{0.488946229f, 0.291440994f},
-std::array<float,2>{0.748432398f, 0.890135884f},
-std::array<float,2>{0.0916709229f, 0.863698304f},
-std::array<float,2>{0.796928465f, 0.375830948f},
-std::array<float,2>{0.41445452f, 0.128962174f},
-std::array<float,2>{0.664933324f, 0.683712482f},
-std::array<float,2>{0.285036981f, 0.554047942f},
-std::array<float,2>{0.597327709f, 0.108330332f},
-std::array<float,2>{0.171521455f, 0.312813431f},
-std::array<float,2>{0.954395711f, 0.96205008f},
-std::array<float,2>{0.461266726f, 0.926552653f},
-std::array<float,2>{0.69226408f, 0.271505326f},
-std::array<float,2>{0.0199852008f, 0.0124528473f},
-std::array<float,2>{0.824870288f, 0.613996029f},
-std::array<float,2>{0.247203827f, 0.692696452f},
-std::array<float,2>{0.905627191f, 0.192943662f},
-std::array<float,2>{0.318782955f, 0.483558714f},
-std::array<float,2>{0.559525549f, 0.750716984f},
-std::array<float,2>{0.214720085f, 0.775150955f},
-std::array<float,2>{0.929621875f, 0.489651769f},
-std::array<float,2>{0.373253614f, 0.21238628f},
-std::array<float,2>{0.524808764f, 0.71681875f},
-std::array<float,2>{0.473749638f, 0.594520986f},
-std::array<float,2>{0.720338404f, 0.0167771857f},
-std::array<float,2>{0.0547944941f, 0.257488638f},
-std::array<float,2>{0.848175824f, 0.917960167f},
-std::array<float,2>{0.253951162f, 0.939692736f},
-std::array<float,2>{0.587264478f, 0.340880483f},
-std::array<float,2>{0.14444524f, 0.123228766f},
-std::array<float,2>{0.997925997f, 0.534440398f},
-std::array<float,2>{0.11452388f, 0.670716643f},
-std::array<float,2>{0.754913867f, 0.144391119f},
-std::array<float,2>{0.390967429f, 0.403319776f},
-std::array<float,2>{0.651751399f, 0.849126995f},
-std::array<float,2>{0.00711608725f, 0.893335462f},
-std::array<float,2>{0.832486093f, 0.301875323f},
-std::array<float,2>{0.441431046f, 0.0436502695f},
-std::array<float,2>{0.710760891f, 0.586836815f},
-std::array<float,2>{0.340918124f, 0.748591542f},
-std::array<float,2>{0.536229253f, 0.222631961f},
-std::array<float,2>{0.222069144f, 0.440930426f},
-std::array<float,2>{0.883161604f, 0.800632119f},
-std::array<float,2>{0.436092913f, 0.814510882f},
-std::array<float,2>{0.685763538f, 0.434127182f},
-std::array<float,2>{0.0728705302f, 0.183462426f},
-std::array<float,2>{0.782631636f, 0.626635194f},
-std::array<float,2>{0.181612745f, 0.513739347f},
-std::array<float,2>{0.939706504f, 0.0670596808f},
-std::array<float,2>{0.306551546f, 0.365499467f},
-std::array<float,2>{0.616130292f, 0.987079203f},
-std::array<float,2>{0.234091356f, 0.9089697f},
-std::array<float,2>{0.878393471f, 0.262839139f},
-std::array<float,2>{0.33152011f, 0.0287225153f},
-std::array<float,2>{0.543754935f, 0.605220556f},
-std::array<float,2>{0.452682734f, 0.707828522f},
-std::array<float,2>{0.717036903f, 0.204140544f},
-std::array<float,2>{0.00915920082f, 0.49985671f},
-std::array<float,2>{0.840822875f, 0.770735383f},
-std::array<float,2>{0.301572293f, 0.855357707f},
-std::array<float,2>{0.62174803f, 0.391618937f},
-std::array<float,2>{0.179578751f, 0.151012048f},
-std::array<float,2>{0.950085759f, 0.660325646f},
-std::array<float,2>{0.0691238269f, 0.545810819f},
-std::array<float,2>{0.789446473f, 0.110326968f},
-std::array<float,2>{0.423773736f, 0.332200319f},
-std::array<float,2>{0.675774038f, 0.950785935f},
-std::array<float,2>{0.0477172285f, 0.809841216f},
-std::array<float,2>{0.854058027f, 0.451949805f},
-std::array<float,2>{0.483527601f, 0.234173134f},
-std::array<float,2>{0.726789236f, 0.7386356f},
-std::array<float,2>{0.36189577f, 0.584662616f},
-std::array<float,2>{0.517411292f, 0.0344105847f},
-std::array<float,2>{0.207208738f, 0.312337577f},
-std::array<float,2>{0.931112528f, 0.899862647f},
-std::array<float,2>{0.403265089f, 0.997022331f},
-std::array<float,2>{0.644269645f, 0.372665644f},
-std::array<float,2>{0.118237719f, 0.0708248839f},
-std::array<float,2>{0.763071835f, 0.505310655f},
-std::array<float,2>{0.150750533f, 0.635331571f},
-std::array<float,2>{0.992078841f, 0.177054018f},
-std::array<float,2>{0.259140193f, 0.426667899f},
-std::array<float,2>{0.583954453f, 0.823064566f},
-std::array<float,2>{0.16071707f, 0.828813434f},
-std::array<float,2>{0.965373576f, 0.408672124f},
-std::array<float,2>{0.289091945f, 0.161788046f},
-std::array<float,2>{0.602122128f, 0.652374268f},
-std::array<float,2>{0.407227904f, 0.528056383f},
-std::array<float,2>{0.661679804f, 0.0898544937f},
-std::array<float,2>{0.0813083798f, 0.346762836f},
-std::array<float,2>{0.805952787f, 0.970882654f},
-std::array<float,2>{0.320935696f, 0.876991034f},
-std::array<float,2>{0.549055755f, 0.283997297f},
-std::array<float,2>{0.238082334f, 0.0536478162f},
-std::array<float,2>{0.897339344f, 0.571924269f},
-std::array<float,2>{0.0310078673f, 0.733101308f},
-std::array<float,2>{0.814350545f, 0.245102495f},
-std::array<float,2>{0.459855497f, 0.460127801f},
-std::array<float,2>{0.701922894f, 0.792806268f},
-std::array<float,2>{0.108992681f, 0.956550419f},
-std::array<float,2>{0.770814061f, 0.324301124f},
-std::array<float,2>{0.386513054f, 0.0992439762f},
-std::array<float,2>{0.625197411f, 0.562114358f},
-std::array<float,2>{0.267817438f, 0.674616396f},
-std::array<float,2>{0.565908313f, 0.138273686f},
-std::array<float,2>{0.133762598f, 0.389040589f},
-std::array<float,2>{0.969531178f, 0.870551765f},
-std::array<float,2>{0.496023923f, 0.763907552f},
-std::array<float,2>{0.739997745f, 0.475479901f},
-std::array<float,2>{0.0410565734f, 0.19724226f},
-std::array<float,2>{0.874633551f, 0.696914494f},
-std::array<float,2>{0.191646829f, 0.622080266f},
-std::array<float,2>{0.907654405f, 0.00505153323f},
-std::array<float,2>{0.349017471f, 0.278432131f},
-std::array<float,2>{0.505028129f, 0.93134129f},
-std::array<float,2>{0.202037528f, 0.947168946f},
-std::array<float,2>{0.919461548f, 0.330347538f},
-std::array<float,2>{0.358788013f, 0.115937524f},
-std::array<float,2>{0.515097678f, 0.539109528f},
-std::array<float,2>{0.486086041f, 0.656371117f},
-std::array<float,2>{0.745976925f, 0.152594969f},
-std::array<float,2>{0.0379331708f, 0.397492409f},
-std::array<float,2>{0.863029063f, 0.858843446f},
-std::array<float,2>{0.27804479f, 0.766343296f},
-std::array<float,2>{0.577828825f, 0.493674278f},
-std::array<float,2>{0.125084057f, 0.210189193f},
-std::array<float,2>{0.97932142f, 0.706613064f},
-std::array<float,2>{0.0955929384f, 0.607976437f},
-std::array<float,2>{0.780537724f, 0.0256941859f},
-std::array<float,2>{0.382787675f, 0.260903984f},
-std::array<float,2>{0.638983905f, 0.912071645f},
-std::array<float,2>{0.0194113888f, 0.82488662f},
-std::array<float,2>{0.823927045f, 0.422551066f},
-std::array<float,2>{0.468737304f, 0.172497734f},
-std::array<float,2>{0.690447569f, 0.637241423f},
-std::array<float,2>{0.315882474f, 0.500537932f},
-std::array<float,2>{0.556161582f, 0.0780899599f},
-std::array<float,2>{0.242328301f, 0.370002747f},
-std::array<float,2>{0.902175784f, 0.993241251f},
-std::array<float,2>{0.42037639f, 0.903780282f},
-std::array<float,2>{0.668473959f, 0.30728516f},
-std::array<float,2>{0.0880403742f, 0.0373960994f},
-std::array<float,2>{0.803911865f, 0.578277588f},
-std::array<float,2>{0.166435122f, 0.73537308f},
-std::array<float,2>{0.958312809f, 0.228173286f},
-std::array<float,2>{0.285946727f, 0.445420623f},
-std::array<float,2>{0.598003864f, 0.808375657f},
-std::array<float,2>{0.144954711f, 0.795857906f},
-std::array<float,2>{0.992749393f, 0.453155935f},
-std::array<float,2>{0.250609457f, 0.247940347f},
-std::array<float,2>{0.592054486f, 0.730221152f},
-std::array<float,2>{0.394563109f, 0.577721238f},
-std::array<float,2>{0.655955255f, 0.0476780571f},
-std::array<float,2>{0.113203011f, 0.28888011f},
-std::array<float,2>{0.750446022f, 0.879462063f},
-std::array<float,2>{0.367656052f, 0.973514795f},
-std::array<float,2>{0.52769047f, 0.348553509f},
-std::array<float,2>{0.217934236f, 0.0897252262f},
-std::array<float,2>{0.922048688f, 0.52445811f},
-std::array<float,2>{0.0596823283f, 0.649883986f},
-std::array<float,2>{0.844656348f, 0.159179762f},
-std::array<float,2>{0.470389009f, 0.411566913f},
-std::array<float,2>{0.724965096f, 0.835849702f},
-std::array<float,2>{0.0746101141f, 0.935918629f},
-std::array<float,2>{0.7888363f, 0.275546551f},
-std::array<float,2>{0.431668907f, 0.0036467996f},
-std::array<float,2>{0.682018757f, 0.619147718f},
-std::array<float,2>{0.310531616f, 0.702461421f},
-std::array<float,2>{0.611226559f, 0.202906117f},
-std::array<float,2>{0.186396748f, 0.470913112f},
-std::array<float,2>{0.942266762f, 0.757831693f},
-std::array<float,2>{0.439396054f, 0.871493638f},
-std::array<float,2>{0.706096947f, 0.382856995f},
-std::array<float,2>{0.00263728481f, 0.135966986f},
-std::array<float,2>{0.829989493f, 0.676627159f},
-std::array<float,2>{0.22344631f, 0.556324124f},
-std::array<float,2>{0.88778919f, 0.0948394015f},
-std::array<float,2>{0.337366849f, 0.323163003f},
-std::array<float,2>{0.534366369f, 0.957644641f},
-std::array<float,2>{0.173541769f, 0.886287928f},
-std::array<float,2>{0.946891308f, 0.294526607f},
-std::array<float,2>{0.298682153f, 0.0623357557f},
-std::array<float,2>{0.620995164f, 0.569163799f},
-std::array<float,2>{0.426934689f, 0.720695376f},
-std::array<float,2>{0.679171443f, 0.241992861f},
-std::array<float,2>{0.0638988838f, 0.467680901f},
-std::array<float,2>{0.795761585f, 0.788443208f},
-std::array<float,2>{0.334656656f, 0.836528063f},
-std::array<float,2>{0.539607108f, 0.419964522f},
-std::array<float,2>{0.226816416f, 0.166916654f},
-std::array<float,2>{0.879815817f, 0.64283812f},
-std::array<float,2>{0.0155374892f, 0.51824826f},
-std::array<float,2>{0.837979078f, 0.082190901f},
-std::array<float,2>{0.44705987f, 0.351802081f},
-std::array<float,2>{0.712787688f, 0.983458102f},
-std::array<float,2>{0.124814287f, 0.755845904f},
-std::array<float,2>{0.761178672f, 0.476989448f},
-std::array<float,2>{0.399430573f, 0.188345671f},
-std::array<float,2>{0.647977471f, 0.689846516f},
-std::array<float,2>{0.265395582f, 0.611524045f},
-std::array<float,2>{0.579306066f, 0.010643065f},
-std::array<float,2>{0.156017542f, 0.269308716f},
-std::array<float,2>{0.98477143f, 0.923767328f},
-std::array<float,2>{0.479596138f, 0.965256393f},
-std::array<float,2>{0.731714249f, 0.31701228f},
-std::array<float,2>{0.0521188714f, 0.102743588f},
-std::array<float,2>{0.858150303f, 0.548727214f},
-std::array<float,2>{0.205559805f, 0.68009907f},
-std::array<float,2>{0.936903596f, 0.126432583f},
-std::array<float,2>{0.36422959f, 0.380524457f},
-std::array<float,2>{0.521995068f, 0.86112994f},
-std::array<float,2>{0.239612669f, 0.845534027f},
-std::array<float,2>{0.894056916f, 0.40071094f},
-std::array<float,2>{0.324732363f, 0.144888103f},
-std::array<float,2>{0.551030278f, 0.666292369f},
-std::array<float,2>{0.456937522f, 0.536962807f},
-std::array<float,2>{0.69723177f, 0.119259469f},
-std::array<float,2>{0.02499157f, 0.338460892f},
-std::array<float,2>{0.818279624f, 0.942616284f},
-std::array<float,2>{0.293042332f, 0.920499444f},
-std::array<float,2>{0.607858539f, 0.252479434f},
-std::array<float,2>{0.158537537f, 0.0206225663f},
-std::array<float,2>{0.963072717f, 0.599170625f},
-std::array<float,2>{0.0835934505f, 0.710955918f},
-std::array<float,2>{0.810425341f, 0.218265384f},
-std::array<float,2>{0.411247015f, 0.487648964f},
-std::array<float,2>{0.658726573f, 0.779281199f},
-std::array<float,2>{0.0444718413f, 0.990615845f},
-std::array<float,2>{0.870268703f, 0.362673134f},
-std::array<float,2>{0.497472525f, 0.0636356473f},
-std::array<float,2>{0.735168874f, 0.509205401f},
-std::array<float,2>{0.346532345f, 0.629674077f},
-std::array<float,2>{0.502309322f, 0.185824648f},
-std::array<float,2>{0.190266192f, 0.430656761f},
-std::array<float,2>{0.910319149f, 0.816446602f},
-std::array<float,2>{0.388135761f, 0.801199317f},
-std::array<float,2>{0.632410467f, 0.44232595f},
-std::array<float,2>{0.104951784f, 0.223230824f},
-std::array<float,2>{0.766281605f, 0.743071735f},
-std::array<float,2>{0.140055001f, 0.589920223f},
-std::array<float,2>{0.974131763f, 0.0408587493f},
-std::array<float,2>{0.269556791f, 0.297333509f},
-std::array<float,2>{0.56805253f, 0.89667356f},
-std::array<float,2>{0.132875666f, 0.953276515f},
-std::array<float,2>{0.968826234f, 0.327972382f},
-std::array<float,2>{0.268234581f, 0.0996975377f},
-std::array<float,2>{0.566392958f, 0.55982393f},
-std::array<float,2>{0.386219561f, 0.673334479f},
-std::array<float,2>{0.625690579f, 0.140266687f},
-std::array<float,2>{0.10864985f, 0.38821891f},
-std::array<float,2>{0.771453202f, 0.867915511f},
-std::array<float,2>{0.349203616f, 0.761932254f},
-std::array<float,2>{0.505450547f, 0.474416226f},
-std::array<float,2>{0.19211407f, 0.197981492f},
-std::array<float,2>{0.907854736f, 0.697280169f},
-std::array<float,2>{0.0416405089f, 0.623353541f},
-std::array<float,2>{0.874157965f, 0.00693538273f},
-std::array<float,2>{0.495158494f, 0.281189263f},
-std::array<float,2>{0.739546955f, 0.932515919f},
-std::array<float,2>{0.0820255205f, 0.830317438f},
-std::array<float,2>{0.806321204f, 0.407699764f},
-std::array<float,2>{0.407957226f, 0.162469193f},
-std::array<float,2>{0.661580503f, 0.65468663f},
-std::array<float,2>{0.289730519f, 0.529313207f},
-std::array<float,2>{0.601690292f, 0.0933353305f},
-std::array<float,2>{0.160500363f, 0.344162017f},
-std::array<float,2>{0.965224266f, 0.969810307f},
-std::array<float,2>{0.459116638f, 0.876868963f},
-std::array<float,2>{0.701427042f, 0.282391161f},
-std::array<float,2>{0.0304334778f, 0.0521731041f},
-std::array<float,2>{0.813627779f, 0.573774099f},
-std::array<float,2>{0.237362623f, 0.732288897f},
-std::array<float,2>{0.896965086f, 0.243393794f},
-std::array<float,2>{0.320799142f, 0.457298875f},
-std::array<float,2>{0.549431741f, 0.789927125f},
-std::array<float,2>{0.20775485f, 0.811230183f},
-std::array<float,2>{0.931448281f, 0.449238747f},
-std::array<float,2>{0.361755908f, 0.230988234f},
-std::array<float,2>{0.516655922f, 0.740932643f},
-std::array<float,2>{0.484098315f, 0.582267046f},
-std::array<float,2>{0.727528334f, 0.0329951122f},
-std::array<float,2>{0.0469992459f, 0.310038835f},
-std::array<float,2>{0.853837192f, 0.901397347f},
-std::array<float,2>{0.259352177f, 0.998846054f},
-std::array<float,2>{0.583281577f, 0.373675317f},
-std::array<float,2>{0.151297927f, 0.0735464245f},
-std::array<float,2>{0.99135673f, 0.507274687f},
-std::array<float,2>{0.119018897f, 0.632941365f},
-std::array<float,2>{0.763203323f, 0.17838186f},
-std::array<float,2>{0.402399153f, 0.428488791f},
-std::array<float,2>{0.643796742f, 0.821949184f},
-std::array<float,2>{0.00935323164f, 0.907358587f},
-std::array<float,2>{0.841482878f, 0.264911801f},
-std::array<float,2>{0.452328652f, 0.0311109722f},
-std::array<float,2>{0.717309713f, 0.601785362f},
-std::array<float,2>{0.331813157f, 0.710851729f},
-std::array<float,2>{0.542995632f, 0.205621496f},
-std::array<float,2>{0.233853385f, 0.497024328f},
-std::array<float,2>{0.87889421f, 0.771950841f},
-std::array<float,2>{0.423034847f, 0.853038073f},
-std::array<float,2>{0.675283194f, 0.393651903f},
-std::array<float,2>{0.0685809329f, 0.149412185f},
-std::array<float,2>{0.789711595f, 0.662148595f},
-std::array<float,2>{0.179050937f, 0.544635296f},
-std::array<float,2>{0.949705422f, 0.111517675f},
-std::array<float,2>{0.301067978f, 0.334406346f},
-std::array<float,2>{0.621256053f, 0.951700747f},
-std::array<float,2>{0.222295329f, 0.891345918f},
-std::array<float,2>{0.883632541f, 0.303342968f},
-std::array<float,2>{0.341707885f, 0.0457457379f},
-std::array<float,2>{0.536841452f, 0.589797556f},
-std::array<float,2>{0.442101926f, 0.746648848f},
-std::array<float,2>{0.710028112f, 0.219412118f},
-std::array<float,2>{0.00770157855f, 0.437666923f},
-std::array<float,2>{0.832661629f, 0.798390865f},
-std::array<float,2>{0.305954963f, 0.812798917f},
-std::array<float,2>{0.615558147f, 0.435716152f},
-std::array<float,2>{0.180761442f, 0.180168673f},
-std::array<float,2>{0.940078855f, 0.627515256f},
-std::array<float,2>{0.0725921616f, 0.513162673f},
-std::array<float,2>{0.783155918f, 0.0689576343f},
-std::array<float,2>{0.435810775f, 0.363815188f},
-std::array<float,2>{0.686224282f, 0.985545516f},
-std::array<float,2>{0.0552485622f, 0.777026594f},
-std::array<float,2>{0.847862244f, 0.491596401f},
-std::array<float,2>{0.474390686f, 0.214734316f},
-std::array<float,2>{0.719909012f, 0.716524065f},
-std::array<float,2>{0.373846352f, 0.596079588f},
-std::array<float,2>{0.52509445f, 0.0187207069f},
-std::array<float,2>{0.213903129f, 0.255533367f},
-std::array<float,2>{0.928953588f, 0.91527009f},
-std::array<float,2>{0.391196936f, 0.938436091f},
-std::array<float,2>{0.652017534f, 0.342096418f},
-std::array<float,2>{0.114906289f, 0.122777537f},
-std::array<float,2>{0.755446672f, 0.532296896f},
-std::array<float,2>{0.143664002f, 0.66830796f},
-std::array<float,2>{0.997520268f, 0.141354546f},
-std::array<float,2>{0.254848242f, 0.404802293f},
-std::array<float,2>{0.587497711f, 0.851188898f},
-std::array<float,2>{0.171242237f, 0.866715133f},
-std::array<float,2>{0.955017209f, 0.37887606f},
-std::array<float,2>{0.284336895f, 0.132799566f},
-std::array<float,2>{0.596788228f, 0.686971188f},
-std::array<float,2>{0.414703518f, 0.552101552f},
-std::array<float,2>{0.664309859f, 0.105609111f},
-std::array<float,2>{0.0909419209f, 0.31589666f},
-std::array<float,2>{0.797569811f, 0.963287354f},
-std::array<float,2>{0.319156915f, 0.928068459f},
-std::array<float,2>{0.558857918f, 0.270372808f},
-std::array<float,2>{0.247683719f, 0.0142894452f},
-std::array<float,2>{0.905997992f, 0.616628349f},
-std::array<float,2>{0.0200470127f, 0.694359064f},
-std::array<float,2>{0.824378729f, 0.194825605f},
-std::array<float,2>{0.461551338f, 0.481020212f},
-std::array<float,2>{0.691644967f, 0.752026975f},
-std::array<float,2>{0.0996877551f, 0.978249013f},
-std::array<float,2>{0.776470602f, 0.35598883f},
-std::array<float,2>{0.37512207f, 0.0811672658f},
-std::array<float,2>{0.634730756f, 0.522140741f},
-std::array<float,2>{0.275790691f, 0.646889448f},
-std::array<float,2>{0.571776927f, 0.168387055f},
-std::array<float,2>{0.129712597f, 0.415746093f},
-std::array<float,2>{0.983395457f, 0.843114793f},
-std::array<float,2>{0.488634139f, 0.782972157f},
-std::array<float,2>{0.748559654f, 0.463673264f},
-std::array<float,2>{0.0313762426f, 0.235580161f},
-std::array<float,2>{0.864465714f, 0.724807203f},
-std::array<float,2>{0.197285056f, 0.56319052f},
-std::array<float,2>{0.917250156f, 0.0552726835f},
-std::array<float,2>{0.351933837f, 0.289226532f},
-std::array<float,2>{0.508516729f, 0.887442887f},
-std::array<float,2>{0.189861491f, 0.989933133f},
-std::array<float,2>{0.911064684f, 0.360538781f},
-std::array<float,2>{0.345833302f, 0.0658711195f},
-std::array<float,2>{0.502860725f, 0.511258721f},
-std::array<float,2>{0.497885257f, 0.631988227f},
-std::array<float,2>{0.734694898f, 0.184731215f},
-std::array<float,2>{0.0444295779f, 0.43166706f},
-std::array<float,2>{0.870836616f, 0.819679439f},
-std::array<float,2>{0.270103723f, 0.804281294f},
-std::array<float,2>{0.567473888f, 0.44432199f},
-std::array<float,2>{0.140568137f, 0.225305051f},
-std::array<float,2>{0.973656118f, 0.745347917f},
-std::array<float,2>{0.105429873f, 0.593453884f},
-std::array<float,2>{0.76594919f, 0.0424372107f},
-std::array<float,2>{0.388497382f, 0.299094647f},
-std::array<float,2>{0.63228339f, 0.89519161f},
-std::array<float,2>{0.0247533452f, 0.847402871f},
-std::array<float,2>{0.817607999f, 0.399109483f},
-std::array<float,2>{0.456193358f, 0.147852987f},
-std::array<float,2>{0.696320653f, 0.66443187f},
-std::array<float,2>{0.324283242f, 0.537493646f},
-std::array<float,2>{0.551619232f, 0.118579499f},
-std::array<float,2>{0.240183324f, 0.337755024f},
-std::array<float,2>{0.893719018f, 0.944950819f},
-std::array<float,2>{0.412095517f, 0.919063151f},
-std::array<float,2>{0.658373892f, 0.25131917f},
-std::array<float,2>{0.0834933147f, 0.0215080827f},
-std::array<float,2>{0.809660494f, 0.60153985f},
-std::array<float,2>{0.158834696f, 0.713732064f},
-std::array<float,2>{0.963410497f, 0.215173975f},
-std::array<float,2>{0.293647826f, 0.486116171f},
-std::array<float,2>{0.60812211f, 0.781086624f},
-std::array<float,2>{0.155754209f, 0.756210685f},
-std::array<float,2>{0.985057652f, 0.48020798f},
-std::array<float,2>{0.264867872f, 0.189626917f},
-std::array<float,2>{0.579795778f, 0.688317835f},
-std::array<float,2>{0.400116116f, 0.610921144f},
-std::array<float,2>{0.647844195f, 0.00849458762f},
-std::array<float,2>{0.124489613f, 0.266496062f},
-std::array<float,2>{0.761636496f, 0.924532831f},
-std::array<float,2>{0.363308489f, 0.967842638f},
-std::array<float,2>{0.521961153f, 0.319625765f},
-std::array<float,2>{0.205867916f, 0.104275867f},
-std::array<float,2>{0.937195003f, 0.550561011f},
-std::array<float,2>{0.0527072698f, 0.682794094f},
-std::array<float,2>{0.857483506f, 0.128296256f},
-std::array<float,2>{0.480207175f, 0.381594032f},
-std::array<float,2>{0.731994569f, 0.862924933f},
-std::array<float,2>{0.0641034096f, 0.883855164f},
-std::array<float,2>{0.795019627f, 0.295330942f},
-std::array<float,2>{0.427338392f, 0.059930753f},
-std::array<float,2>{0.679460406f, 0.566423476f},
-std::array<float,2>{0.297873706f, 0.72211802f},
-std::array<float,2>{0.620426416f, 0.238368675f},
-std::array<float,2>{0.17294921f, 0.466008276f},
-std::array<float,2>{0.946680784f, 0.786629319f},
-std::array<float,2>{0.446431875f, 0.838818431f},
-std::array<float,2>{0.712166429f, 0.419916004f},
-std::array<float,2>{0.0149811748f, 0.165527776f},
-std::array<float,2>{0.838452399f, 0.642130792f},
-std::array<float,2>{0.227217674f, 0.516088784f},
-std::array<float,2>{0.879033864f, 0.0853922889f},
-std::array<float,2>{0.334418118f, 0.354082644f},
-std::array<float,2>{0.539182842f, 0.981092751f},
-std::array<float,2>{0.186017305f, 0.933618307f},
-std::array<float,2>{0.941428721f, 0.27473864f},
-std::array<float,2>{0.309847087f, 0.00151060859f},
-std::array<float,2>{0.610614538f, 0.617741108f},
-std::array<float,2>{0.43214941f, 0.700065315f},
-std::array<float,2>{0.682378173f, 0.199783742f},
-std::array<float,2>{0.0750191659f, 0.469102085f},
-std::array<float,2>{0.788404524f, 0.761514962f},
-std::array<float,2>{0.337553769f, 0.873081326f},
-std::array<float,2>{0.5350402f, 0.385681242f},
-std::array<float,2>{0.222738668f, 0.133069396f},
-std::array<float,2>{0.888395369f, 0.679596066f},
-std::array<float,2>{0.00240834802f, 0.558147967f},
-std::array<float,2>{0.829391062f, 0.0975530222f},
-std::array<float,2>{0.43895638f, 0.321603924f},
-std::array<float,2>{0.707014024f, 0.960002124f},
-std::array<float,2>{0.112424627f, 0.793924868f},
-std::array<float,2>{0.750827014f, 0.455762148f},
-std::array<float,2>{0.395163298f, 0.248985082f},
-std::array<float,2>{0.655421674f, 0.727282822f},
-std::array<float,2>{0.250176877f, 0.575685799f},
-std::array<float,2>{0.592305541f, 0.0489601083f},
-std::array<float,2>{0.14523299f, 0.285240144f},
-std::array<float,2>{0.992580533f, 0.882646441f},
-std::array<float,2>{0.46995455f, 0.97468251f},
-std::array<float,2>{0.725438058f, 0.349612147f},
-std::array<float,2>{0.06023819f, 0.0868637711f},
-std::array<float,2>{0.843867719f, 0.527036369f},
-std::array<float,2>{0.218711376f, 0.651678324f},
-std::array<float,2>{0.92272073f, 0.157533124f},
-std::array<float,2>{0.367848128f, 0.413038522f},
-std::array<float,2>{0.528233469f, 0.832143903f},
-std::array<float,2>{0.242982298f, 0.827323794f},
-std::array<float,2>{0.90141052f, 0.424640656f},
-std::array<float,2>{0.316384166f, 0.174415573f},
-std::array<float,2>{0.555724204f, 0.640426338f},
-std::array<float,2>{0.468099803f, 0.503235102f},
-std::array<float,2>{0.691000044f, 0.0761656538f},
-std::array<float,2>{0.0186991524f, 0.367366642f},
-std::array<float,2>{0.823625505f, 0.995905578f},
-std::array<float,2>{0.285239428f, 0.904790819f},
-std::array<float,2>{0.598590612f, 0.306140512f},
-std::array<float,2>{0.166527763f, 0.035272412f},
-std::array<float,2>{0.958607495f, 0.580818534f},
-std::array<float,2>{0.0885769725f, 0.737483978f},
-std::array<float,2>{0.804549515f, 0.229311183f},
-std::array<float,2>{0.420699209f, 0.447357744f},
-std::array<float,2>{0.668441117f, 0.804929793f},
-std::array<float,2>{0.0373506024f, 0.94794035f},
-std::array<float,2>{0.862683833f, 0.329574496f},
-std::array<float,2>{0.485528916f, 0.11404819f},
-std::array<float,2>{0.745382547f, 0.542257607f},
-std::array<float,2>{0.359318674f, 0.659848154f},
-std::array<float,2>{0.515492201f, 0.156035915f},
-std::array<float,2>{0.201423451f, 0.396460801f},
-std::array<float,2>{0.919383705f, 0.856896877f},
-std::array<float,2>{0.382036179f, 0.767624378f},
-std::array<float,2>{0.639571667f, 0.495076597f},
-std::array<float,2>{0.0947521701f, 0.207077414f},
-std::array<float,2>{0.780817807f, 0.704324186f},
-std::array<float,2>{0.125663832f, 0.607171059f},
-std::array<float,2>{0.978830695f, 0.0248970296f},
-std::array<float,2>{0.277803093f, 0.259022772f},
-std::array<float,2>{0.577466369f, 0.913340569f},
-std::array<float,2>{0.162732333f, 0.971626818f},
-std::array<float,2>{0.967947483f, 0.347552031f},
-std::array<float,2>{0.29196921f, 0.0904090554f},
-std::array<float,2>{0.60421145f, 0.527722716f},
-std::array<float,2>{0.408893228f, 0.652963996f},
-std::array<float,2>{0.662606359f, 0.161486477f},
-std::array<float,2>{0.079859063f, 0.409110665f},
-std::array<float,2>{0.806961238f, 0.828331172f},
-std::array<float,2>{0.323425561f, 0.792076468f},
-std::array<float,2>{0.548073947f, 0.460802376f},
-std::array<float,2>{0.235574499f, 0.244404629f},
-std::array<float,2>{0.894854188f, 0.73244828f},
-std::array<float,2>{0.0281504653f, 0.571741402f},
-std::array<float,2>{0.815967381f, 0.0531784147f},
-std::array<float,2>{0.457149535f, 0.283205658f},
-std::array<float,2>{0.699662685f, 0.877519429f},
-std::array<float,2>{0.105696909f, 0.870641589f},
-std::array<float,2>{0.77206713f, 0.389533639f},
-std::array<float,2>{0.384585589f, 0.137843519f},
-std::array<float,2>{0.628079951f, 0.674286664f},
-std::array<float,2>{0.265642345f, 0.561706126f},
-std::array<float,2>{0.564240217f, 0.098736465f},
-std::array<float,2>{0.135007098f, 0.324796319f},
-std::array<float,2>{0.971496224f, 0.956306636f},
-std::array<float,2>{0.493990302f, 0.930952132f},
-std::array<float,2>{0.740983367f, 0.278845906f},
-std::array<float,2>{0.0401434042f, 0.00538567035f},
-std::array<float,2>{0.871872306f, 0.622891009f},
-std::array<float,2>{0.193383381f, 0.69656986f},
-std::array<float,2>{0.910146773f, 0.196750551f},
-std::array<float,2>{0.351460129f, 0.475003123f},
-std::array<float,2>{0.507442951f, 0.764292836f},
-std::array<float,2>{0.23171182f, 0.771353483f},
-std::array<float,2>{0.876303852f, 0.499349624f},
-std::array<float,2>{0.330024689f, 0.204831317f},
-std::array<float,2>{0.545537472f, 0.707075f},
-std::array<float,2>{0.450675786f, 0.604731023f},
-std::array<float,2>{0.716336668f, 0.0288128462f},
-std::array<float,2>{0.0109801954f, 0.263643324f},
-std::array<float,2>{0.843692005f, 0.908273339f},
-std::array<float,2>{0.303468347f, 0.950447798f},
-std::array<float,2>{0.623273909f, 0.332862586f},
-std::array<float,2>{0.177158713f, 0.109526411f},
-std::array<float,2>{0.951298773f, 0.545110226f},
-std::array<float,2>{0.06811364f, 0.660986245f},
-std::array<float,2>{0.791947484f, 0.150719255f},
-std::array<float,2>{0.425151676f, 0.392526329f},
-std::array<float,2>{0.673461139f, 0.854497313f},
-std::array<float,2>{0.0492251925f, 0.899941921f},
-std::array<float,2>{0.852526009f, 0.311704934f},
-std::array<float,2>{0.48169443f, 0.0350564606f},
-std::array<float,2>{0.729581058f, 0.58441323f},
-std::array<float,2>{0.359473437f, 0.739000022f},
-std::array<float,2>{0.517998338f, 0.23364599f},
-std::array<float,2>{0.210440546f, 0.451326132f},
-std::array<float,2>{0.933091462f, 0.810354471f},
-std::array<float,2>{0.404704332f, 0.822604597f},
-std::array<float,2>{0.641682565f, 0.426002771f},
-std::array<float,2>{0.120287016f, 0.177472442f},
-std::array<float,2>{0.765152514f, 0.635135174f},
-std::array<float,2>{0.149356976f, 0.505700588f},
-std::array<float,2>{0.989988863f, 0.0704874843f},
-std::array<float,2>{0.260910183f, 0.372257471f},
-std::array<float,2>{0.584068358f, 0.996127307f},
-std::array<float,2>{0.211328447f, 0.917086601f},
-std::array<float,2>{0.926141918f, 0.256876022f},
-std::array<float,2>{0.372241557f, 0.0174505711f},
-std::array<float,2>{0.525423586f, 0.593855321f},
-std::array<float,2>{0.476466268f, 0.717354119f},
-std::array<float,2>{0.721407175f, 0.212809369f},
-std::array<float,2>{0.0581064597f, 0.489978164f},
-std::array<float,2>{0.851524949f, 0.774761915f},
-std::array<float,2>{0.256932229f, 0.848689616f},
-std::array<float,2>{0.58929801f, 0.40248248f},
-std::array<float,2>{0.142397344f, 0.143634588f},
-std::array<float,2>{0.999578297f, 0.669962525f},
-std::array<float,2>{0.116956905f, 0.535125911f},
-std::array<float,2>{0.757122695f, 0.123859532f},
-std::array<float,2>{0.394095659f, 0.34134385f},
-std::array<float,2>{0.648604214f, 0.940321147f},
-std::array<float,2>{0.00477460539f, 0.800060511f},
-std::array<float,2>{0.835096717f, 0.440834701f},
-std::array<float,2>{0.445077717f, 0.222156674f},
-std::array<float,2>{0.707046509f, 0.74841696f},
-std::array<float,2>{0.34313491f, 0.586294234f},
-std::array<float,2>{0.538013935f, 0.0434167236f},
-std::array<float,2>{0.220471472f, 0.302423716f},
-std::array<float,2>{0.886588395f, 0.892675698f},
-std::array<float,2>{0.434389621f, 0.986502886f},
-std::array<float,2>{0.685082555f, 0.36586085f},
-std::array<float,2>{0.0708638728f, 0.0665417463f},
-std::array<float,2>{0.784145176f, 0.514565885f},
-std::array<float,2>{0.183509231f, 0.626084268f},
-std::array<float,2>{0.93903023f, 0.183010831f},
-std::array<float,2>{0.307659656f, 0.43379879f},
-std::array<float,2>{0.613551259f, 0.815346599f},
-std::array<float,2>{0.132131025f, 0.841463745f},
-std::array<float,2>{0.981672406f, 0.416120678f},
-std::array<float,2>{0.274844378f, 0.171416849f},
-std::array<float,2>{0.574179411f, 0.644831538f},
-std::array<float,2>{0.378838956f, 0.520058334f},
-std::array<float,2>{0.635551393f, 0.0797447637f},
-std::array<float,2>{0.0992934927f, 0.357653737f},
-std::array<float,2>{0.77385062f, 0.978538156f},
-std::array<float,2>{0.354100853f, 0.890575588f},
-std::array<float,2>{0.510572493f, 0.291794837f},
-std::array<float,2>{0.197103411f, 0.0571535267f},
-std::array<float,2>{0.91516149f, 0.565587282f},
-std::array<float,2>{0.0348344781f, 0.72292012f},
-std::array<float,2>{0.866945148f, 0.236464396f},
-std::array<float,2>{0.490575433f, 0.460969746f},
-std::array<float,2>{0.746094108f, 0.784948885f},
-std::array<float,2>{0.0936302543f, 0.962423861f},
-std::array<float,2>{0.799378991f, 0.313311189f},
-std::array<float,2>{0.416126877f, 0.10779994f},
-std::array<float,2>{0.667016864f, 0.554671943f},
-std::array<float,2>{0.281781763f, 0.684217572f},
-std::array<float,2>{0.59487313f, 0.12977691f},
-std::array<float,2>{0.169423327f, 0.375348002f},
-std::array<float,2>{0.9564358f, 0.864211738f},
-std::array<float,2>{0.464799106f, 0.750187993f},
-std::array<float,2>{0.693935573f, 0.484100968f},
-std::array<float,2>{0.0230593439f, 0.192431495f},
-std::array<float,2>{0.826238394f, 0.693301141f},
-std::array<float,2>{0.248669118f, 0.613325953f},
-std::array<float,2>{0.902541816f, 0.0117203789f},
-std::array<float,2>{0.317859888f, 0.272354633f},
-std::array<float,2>{0.560851514f, 0.925880849f},
-std::array<float,2>{0.241437763f, 0.943000734f},
-std::array<float,2>{0.892184615f, 0.338203698f},
-std::array<float,2>{0.327682316f, 0.120054826f},
-std::array<float,2>{0.553110003f, 0.536159635f},
-std::array<float,2>{0.453735471f, 0.66667074f},
-std::array<float,2>{0.69829005f, 0.145092934f},
-std::array<float,2>{0.0269953981f, 0.401361644f},
-std::array<float,2>{0.818586826f, 0.844985068f},
-std::array<float,2>{0.295963585f, 0.778630197f},
-std::array<float,2>{0.60685432f, 0.488077223f},
-std::array<float,2>{0.156707987f, 0.217866555f},
-std::array<float,2>{0.961928606f, 0.711860776f},
-std::array<float,2>{0.0856841281f, 0.59881109f},
-std::array<float,2>{0.81062746f, 0.021314824f},
-std::array<float,2>{0.413839519f, 0.25216791f},
-std::array<float,2>{0.657225728f, 0.919983149f},
-std::array<float,2>{0.0467024893f, 0.817109942f},
-std::array<float,2>{0.867679954f, 0.429828167f},
-std::array<float,2>{0.498236537f, 0.18621996f},
-std::array<float,2>{0.737273216f, 0.629038632f},
-std::array<float,2>{0.343760252f, 0.509470284f},
-std::array<float,2>{0.501769423f, 0.0641358048f},
-std::array<float,2>{0.188249663f, 0.363086909f},
-std::array<float,2>{0.9126665f, 0.991210222f},
-std::array<float,2>{0.390195429f, 0.897021294f},
-std::array<float,2>{0.629232585f, 0.297506094f},
-std::array<float,2>{0.102111362f, 0.0403305516f},
-std::array<float,2>{0.768767357f, 0.590613365f},
-std::array<float,2>{0.13730289f, 0.742675662f},
-std::array<float,2>{0.975604355f, 0.222734794f},
-std::array<float,2>{0.272435188f, 0.441489428f},
-std::array<float,2>{0.56976068f, 0.801362813f},
-std::array<float,2>{0.17404075f, 0.788694859f},
-std::array<float,2>{0.948001742f, 0.46686703f},
-std::array<float,2>{0.300528109f, 0.241447836f},
-std::array<float,2>{0.618935287f, 0.720116735f},
-std::array<float,2>{0.427855879f, 0.568775594f},
-std::array<float,2>{0.67677027f, 0.061552424f},
-std::array<float,2>{0.0657472908f, 0.29432252f},
-std::array<float,2>{0.79358536f, 0.885745764f},
-std::array<float,2>{0.333728254f, 0.984138966f},
-std::array<float,2>{0.54139936f, 0.352265149f},
-std::array<float,2>{0.229101151f, 0.0827373788f},
-std::array<float,2>{0.881484807f, 0.517692685f},
-std::array<float,2>{0.0132679306f, 0.643268645f},
-std::array<float,2>{0.835961461f, 0.166114077f},
-std::array<float,2>{0.447760165f, 0.420628458f},
-std::array<float,2>{0.713270724f, 0.835971892f},
-std::array<float,2>{0.122385085f, 0.923171401f},
-std::array<float,2>{0.759277582f, 0.269027174f},
-std::array<float,2>{0.400558293f, 0.00997200795f},
-std::array<float,2>{0.645566285f, 0.612198055f},
-std::array<float,2>{0.263319075f, 0.689977765f},
-std::array<float,2>{0.581360102f, 0.187821954f},
-std::array<float,2>{0.152966276f, 0.47733292f},
-std::array<float,2>{0.987153292f, 0.755181015f},
-std::array<float,2>{0.476870984f, 0.860694945f},
-std::array<float,2>{0.733471811f, 0.37991178f},
-std::array<float,2>{0.0545828491f, 0.12668623f},
-std::array<float,2>{0.856130064f, 0.680209339f},
-std::array<float,2>{0.204825878f, 0.548317909f},
-std::array<float,2>{0.934355378f, 0.103129044f},
-std::array<float,2>{0.365723342f, 0.316883713f},
-std::array<float,2>{0.521002769f, 0.965735137f},
-std::array<float,2>{0.147376314f, 0.879046202f},
-std::array<float,2>{0.995823145f, 0.288268954f},
-std::array<float,2>{0.253576905f, 0.0471206717f},
-std::array<float,2>{0.59065634f, 0.577251196f},
-std::array<float,2>{0.398137122f, 0.729725301f},
-std::array<float,2>{0.65385747f, 0.247211412f},
-std::array<float,2>{0.109538607f, 0.453663737f},
-std::array<float,2>{0.753112495f, 0.795300841f},
-std::array<float,2>{0.370726734f, 0.835113049f},
-std::array<float,2>{0.530564368f, 0.411750346f},
-std::array<float,2>{0.216010079f, 0.159997493f},
-std::array<float,2>{0.924831331f, 0.650207877f},
-std::array<float,2>{0.061888814f, 0.524953902f},
-std::array<float,2>{0.846924365f, 0.0889028013f},
-std::array<float,2>{0.471845537f, 0.348129243f},
-std::array<float,2>{0.723816216f, 0.97294873f},
-std::array<float,2>{0.0775695592f, 0.758523822f},
-std::array<float,2>{0.786405325f, 0.471357793f},
-std::array<float,2>{0.431131452f, 0.202630311f},
-std::array<float,2>{0.681512892f, 0.703090191f},
-std::array<float,2>{0.311351717f, 0.620023549f},
-std::array<float,2>{0.612251759f, 0.00331061124f},
-std::array<float,2>{0.18439357f, 0.276065588f},
-std::array<float,2>{0.944152117f, 0.936471999f},
-std::array<float,2>{0.440092355f, 0.957177818f},
-std::array<float,2>{0.703814209f, 0.322537154f},
-std::array<float,2>{0.000467168138f, 0.0954987109f},
-std::array<float,2>{0.830547988f, 0.55602318f},
-std::array<float,2>{0.225460961f, 0.67605108f},
-std::array<float,2>{0.888771236f, 0.136714265f},
-std::array<float,2>{0.338434786f, 0.383726746f},
-std::array<float,2>{0.531882584f, 0.871604145f},
-std::array<float,2>{0.200698555f, 0.859083772f},
-std::array<float,2>{0.921613097f, 0.39808166f},
-std::array<float,2>{0.355988175f, 0.153048635f},
-std::array<float,2>{0.513512373f, 0.656800508f},
-std::array<float,2>{0.487822264f, 0.539703429f},
-std::array<float,2>{0.742822468f, 0.115598492f},
-std::array<float,2>{0.0352146365f, 0.33075726f},
-std::array<float,2>{0.859851301f, 0.946624219f},
-std::array<float,2>{0.281092793f, 0.911429286f},
-std::array<float,2>{0.574320614f, 0.261705816f},
-std::array<float,2>{0.127748847f, 0.0259721f},
-std::array<float,2>{0.976761222f, 0.607821882f},
-std::array<float,2>{0.0960089564f, 0.706377864f},
-std::array<float,2>{0.777471364f, 0.210771903f},
-std::array<float,2>{0.380392492f, 0.493316382f},
-std::array<float,2>{0.638493896f, 0.765755117f},
-std::array<float,2>{0.0166253783f, 0.99408555f},
-std::array<float,2>{0.820611179f, 0.369189054f},
-std::array<float,2>{0.466049492f, 0.0774707645f},
-std::array<float,2>{0.688725591f, 0.500419915f},
-std::array<float,2>{0.313738674f, 0.636857569f},
-std::array<float,2>{0.557975113f, 0.171995923f},
-std::array<float,2>{0.244321078f, 0.422328144f},
-std::array<float,2>{0.899254441f, 0.824671447f},
-std::array<float,2>{0.419114083f, 0.807706296f},
-std::array<float,2>{0.670246184f, 0.445861697f},
-std::array<float,2>{0.0863876268f, 0.227762371f},
-std::array<float,2>{0.800899625f, 0.735920191f},
-std::array<float,2>{0.16487515f, 0.578726411f},
-std::array<float,2>{0.960872829f, 0.0380790755f},
-std::array<float,2>{0.288492024f, 0.306660235f},
-std::array<float,2>{0.600433648f, 0.903896153f},
-std::array<float,2>{0.176551834f, 0.952477276f},
-std::array<float,2>{0.952935815f, 0.335888863f},
-std::array<float,2>{0.30452016f, 0.113174006f},
-std::array<float,2>{0.624403477f, 0.543569982f},
-std::array<float,2>{0.424432069f, 0.663598418f},
-std::array<float,2>{0.672192931f, 0.149785265f},
-std::array<float,2>{0.0666406974f, 0.393446892f},
-std::array<float,2>{0.792481124f, 0.852199376f},
-std::array<float,2>{0.328744292f, 0.773180544f},
-std::array<float,2>{0.545902491f, 0.497230291f},
-std::array<float,2>{0.231143162f, 0.206131876f},
-std::array<float,2>{0.875234604f, 0.709372222f},
-std::array<float,2>{0.0106044663f, 0.603447974f},
-std::array<float,2>{0.84204632f, 0.0293870214f},
-std::array<float,2>{0.450087517f, 0.264146447f},
-std::array<float,2>{0.715679407f, 0.907032311f},
-std::array<float,2>{0.119499154f, 0.821212649f},
-std::array<float,2>{0.764413714f, 0.429103673f},
-std::array<float,2>{0.405920208f, 0.179126129f},
-std::array<float,2>{0.641284406f, 0.63387239f},
-std::array<float,2>{0.260631293f, 0.50632f},
-std::array<float,2>{0.585082114f, 0.0722927675f},
-std::array<float,2>{0.149426833f, 0.374083668f},
-std::array<float,2>{0.98848033f, 0.999759376f},
-std::array<float,2>{0.480955094f, 0.901015282f},
-std::array<float,2>{0.729476988f, 0.309049875f},
-std::array<float,2>{0.0504419282f, 0.0312590376f},
-std::array<float,2>{0.853127837f, 0.583699524f},
-std::array<float,2>{0.209151015f, 0.742059469f},
-std::array<float,2>{0.932546318f, 0.231578901f},
-std::array<float,2>{0.360526502f, 0.450913399f},
-std::array<float,2>{0.518578768f, 0.812472582f},
-std::array<float,2>{0.23511824f, 0.790531158f},
-std::array<float,2>{0.896157026f, 0.45893538f},
-std::array<float,2>{0.322520286f, 0.242837757f},
-std::array<float,2>{0.547388971f, 0.730722308f},
-std::array<float,2>{0.458337396f, 0.573190093f},
-std::array<float,2>{0.70116955f, 0.0512408614f},
-std::array<float,2>{0.0291220136f, 0.281562209f},
-std::array<float,2>{0.815234065f, 0.87519902f},
-std::array<float,2>{0.292621762f, 0.969420254f},
-std::array<float,2>{0.605121613f, 0.345311522f},
-std::array<float,2>{0.163556188f, 0.0924874991f},
-std::array<float,2>{0.967337489f, 0.531247556f},
-std::array<float,2>{0.0782591552f, 0.655316293f},
-std::array<float,2>{0.807954192f, 0.163165644f},
-std::array<float,2>{0.409974903f, 0.407049179f},
-std::array<float,2>{0.663579345f, 0.831947625f},
-std::array<float,2>{0.0398572162f, 0.933309257f},
-std::array<float,2>{0.872697651f, 0.280171752f},
-std::array<float,2>{0.492418259f, 0.00653501181f},
-std::array<float,2>{0.741987288f, 0.624250948f},
-std::array<float,2>{0.34967652f, 0.698451817f},
-std::array<float,2>{0.506697178f, 0.198544398f},
-std::array<float,2>{0.194367841f, 0.473243386f},
-std::array<float,2>{0.908975065f, 0.763611853f},
-std::array<float,2>{0.383585125f, 0.86907059f},
-std::array<float,2>{0.627429664f, 0.387091786f},
-std::array<float,2>{0.106468908f, 0.139218494f},
-std::array<float,2>{0.772609293f, 0.67251873f},
-std::array<float,2>{0.135833547f, 0.559075177f},
-std::array<float,2>{0.972071767f, 0.10117016f},
-std::array<float,2>{0.267484426f, 0.326414496f},
-std::array<float,2>{0.562996387f, 0.954700589f},
-std::array<float,2>{0.195319965f, 0.887797415f},
-std::array<float,2>{0.91436106f, 0.290431887f},
-std::array<float,2>{0.355145574f, 0.0566143915f},
-std::array<float,2>{0.51132673f, 0.564319968f},
-std::array<float,2>{0.491832644f, 0.726521611f},
-std::array<float,2>{0.748007238f, 0.234395802f},
-std::array<float,2>{0.0337149687f, 0.463934422f},
-std::array<float,2>{0.866021454f, 0.781335235f},
-std::array<float,2>{0.273599058f, 0.842308939f},
-std::array<float,2>{0.572789848f, 0.414243847f},
-std::array<float,2>{0.131791279f, 0.169175193f},
-std::array<float,2>{0.980597854f, 0.647868574f},
-std::array<float,2>{0.0982549414f, 0.522938371f},
-std::array<float,2>{0.775332808f, 0.0803134814f},
-std::array<float,2>{0.37730208f, 0.356718123f},
-std::array<float,2>{0.63593632f, 0.976717114f},
-std::array<float,2>{0.0224160757f, 0.753461719f},
-std::array<float,2>{0.8279441f, 0.481832057f},
-std::array<float,2>{0.463330507f, 0.193554565f},
-std::array<float,2>{0.69462657f, 0.694178283f},
-std::array<float,2>{0.316888005f, 0.615410447f},
-std::array<float,2>{0.562435925f, 0.0156007474f},
-std::array<float,2>{0.249897957f, 0.270923287f},
-std::array<float,2>{0.903711617f, 0.92891413f},
-std::array<float,2>{0.417587698f, 0.964681447f},
-std::array<float,2>{0.666919887f, 0.314942777f},
-std::array<float,2>{0.0924724415f, 0.107371651f},
-std::array<float,2>{0.800680816f, 0.551010132f},
-std::array<float,2>{0.168183029f, 0.685742915f},
-std::array<float,2>{0.955791295f, 0.131653771f},
-std::array<float,2>{0.282546014f, 0.377030104f},
-std::array<float,2>{0.593840897f, 0.866035223f},
-std::array<float,2>{0.141547188f, 0.849917591f},
-std::array<float,2>{0.998543084f, 0.405663937f},
-std::array<float,2>{0.256332129f, 0.142541006f},
-std::array<float,2>{0.588536322f, 0.66916436f},
-std::array<float,2>{0.393014997f, 0.53182435f},
-std::array<float,2>{0.650162458f, 0.121532016f},
-std::array<float,2>{0.115297489f, 0.343574315f},
-std::array<float,2>{0.756009579f, 0.938476622f},
-std::array<float,2>{0.371194959f, 0.914947033f},
-std::array<float,2>{0.527037084f, 0.254406929f},
-std::array<float,2>{0.212359682f, 0.0177949127f},
-std::array<float,2>{0.927222013f, 0.597085416f},
-std::array<float,2>{0.0575168207f, 0.715062618f},
-std::array<float,2>{0.849739134f, 0.213303268f},
-std::array<float,2>{0.475191802f, 0.490500003f},
-std::array<float,2>{0.722431421f, 0.77582407f},
-std::array<float,2>{0.071569629f, 0.984934032f},
-std::array<float,2>{0.784700036f, 0.364780515f},
-std::array<float,2>{0.435035557f, 0.0693967491f},
-std::array<float,2>{0.684550822f, 0.512100935f},
-std::array<float,2>{0.307009459f, 0.628276467f},
-std::array<float,2>{0.614759743f, 0.181564584f},
-std::array<float,2>{0.182252511f, 0.437446952f},
-std::array<float,2>{0.938195944f, 0.813565135f},
-std::array<float,2>{0.443492442f, 0.797702909f},
-std::array<float,2>{0.708112657f, 0.438697606f},
-std::array<float,2>{0.00488340296f, 0.22066766f},
-std::array<float,2>{0.834394515f, 0.747093558f},
-std::array<float,2>{0.219642594f, 0.58789444f},
-std::array<float,2>{0.885154784f, 0.0463290438f},
-std::array<float,2>{0.342345983f, 0.304278344f},
-std::array<float,2>{0.538189948f, 0.891814947f},
-std::array<float,2>{0.230246738f, 0.981667519f},
-std::array<float,2>{0.882804334f, 0.354825348f},
-std::array<float,2>{0.332174242f, 0.084064208f},
-std::array<float,2>{0.542501986f, 0.517435372f},
-std::array<float,2>{0.448471606f, 0.640735805f},
-std::array<float,2>{0.713993192f, 0.164404601f},
-std::array<float,2>{0.0124839665f, 0.418111384f},
-std::array<float,2>{0.837183297f, 0.839320064f},
-std::array<float,2>{0.298977524f, 0.785229266f},
-std::array<float,2>{0.618028164f, 0.46492821f},
-std::array<float,2>{0.175276637f, 0.239362121f},
-std::array<float,2>{0.948506951f, 0.72116816f},
-std::array<float,2>{0.064899601f, 0.567600906f},
-std::array<float,2>{0.794829845f, 0.0590476952f},
-std::array<float,2>{0.429173499f, 0.296101451f},
-std::array<float,2>{0.676407158f, 0.883361578f},
-std::array<float,2>{0.0528088212f, 0.861508071f},
-std::array<float,2>{0.856779993f, 0.382745743f},
-std::array<float,2>{0.478052348f, 0.12707825f},
-std::array<float,2>{0.732602715f, 0.681672215f},
-std::array<float,2>{0.366653591f, 0.549195707f},
-std::array<float,2>{0.519577444f, 0.104860075f},
-std::array<float,2>{0.203797519f, 0.318372726f},
-std::array<float,2>{0.935238004f, 0.967688262f},
-std::array<float,2>{0.40224424f, 0.925523579f},
-std::array<float,2>{0.644568324f, 0.266982913f},
-std::array<float,2>{0.121388689f, 0.00902125146f},
-std::array<float,2>{0.757878006f, 0.609889686f},
-std::array<float,2>{0.154212475f, 0.688683748f},
-std::array<float,2>{0.988210618f, 0.190657869f},
-std::array<float,2>{0.26252228f, 0.478805333f},
-std::array<float,2>{0.580330789f, 0.756915569f},
-std::array<float,2>{0.157607108f, 0.780018747f},
-std::array<float,2>{0.961090505f, 0.485329181f},
-std::array<float,2>{0.295587778f, 0.216728643f},
-std::array<float,2>{0.606418371f, 0.71435529f},
-std::array<float,2>{0.41245997f, 0.600036621f},
-std::array<float,2>{0.65759927f, 0.0228371844f},
-std::array<float,2>{0.0846697092f, 0.250464171f},
-std::array<float,2>{0.811581492f, 0.918555021f},
-std::array<float,2>{0.3269068f, 0.943825185f},
-std::array<float,2>{0.554523349f, 0.336534172f},
-std::array<float,2>{0.241142333f, 0.117820457f},
-std::array<float,2>{0.891544759f, 0.538616657f},
-std::array<float,2>{0.0257179886f, 0.665943623f},
-std::array<float,2>{0.819382668f, 0.146922603f},
-std::array<float,2>{0.454256475f, 0.399521738f},
-std::array<float,2>{0.697624147f, 0.846318305f},
-std::array<float,2>{0.103486717f, 0.895945251f},
-std::array<float,2>{0.767940938f, 0.300662488f},
-std::array<float,2>{0.389597476f, 0.0417776108f},
-std::array<float,2>{0.630760014f, 0.59265691f},
-std::array<float,2>{0.272790372f, 0.744660676f},
-std::array<float,2>{0.569054365f, 0.226201445f},
-std::array<float,2>{0.138168186f, 0.445246428f},
-std::array<float,2>{0.975447297f, 0.803524613f},
-std::array<float,2>{0.499831885f, 0.818478048f},
-std::array<float,2>{0.737687886f, 0.433483541f},
-std::array<float,2>{0.045461636f, 0.184190527f},
-std::array<float,2>{0.868703783f, 0.631183803f},
-std::array<float,2>{0.188486949f, 0.509882629f},
-std::array<float,2>{0.913090408f, 0.0651690587f},
-std::array<float,2>{0.345453382f, 0.359821469f},
-std::array<float,2>{0.500314355f, 0.988867283f},
-std::array<float,2>{0.128550544f, 0.912326276f},
-std::array<float,2>{0.977727771f, 0.258782208f},
-std::array<float,2>{0.280014277f, 0.0243119821f},
-std::array<float,2>{0.576017618f, 0.60620147f},
-std::array<float,2>{0.379125804f, 0.703688502f},
-std::array<float,2>{0.637526631f, 0.2080587f},
-std::array<float,2>{0.0967842638f, 0.495921552f},
-std::array<float,2>{0.779043257f, 0.769199431f},
-std::array<float,2>{0.357193559f, 0.855771899f},
-std::array<float,2>{0.511803746f, 0.395401716f},
-std::array<float,2>{0.19960314f, 0.155004278f},
-std::array<float,2>{0.920230567f, 0.65892756f},
-std::array<float,2>{0.0367353f, 0.541145802f},
-std::array<float,2>{0.861190438f, 0.11515756f},
-std::array<float,2>{0.487257212f, 0.328784049f},
-std::array<float,2>{0.74384141f, 0.948586643f},
-std::array<float,2>{0.0869155079f, 0.806065738f},
-std::array<float,2>{0.802072585f, 0.448678672f},
-std::array<float,2>{0.418417335f, 0.229761243f},
-std::array<float,2>{0.671848655f, 0.737093687f},
-std::array<float,2>{0.287992179f, 0.58186543f},
-std::array<float,2>{0.601209164f, 0.0368621349f},
-std::array<float,2>{0.165919885f, 0.305050164f},
-std::array<float,2>{0.959860027f, 0.906081319f},
-std::array<float,2>{0.465688616f, 0.995017171f},
-std::array<float,2>{0.688078046f, 0.368935257f},
-std::array<float,2>{0.0163400825f, 0.0747897103f},
-std::array<float,2>{0.822263837f, 0.502115548f},
-std::array<float,2>{0.245854691f, 0.638897955f},
-std::array<float,2>{0.899621725f, 0.175010249f},
-std::array<float,2>{0.312989175f, 0.425179273f},
-std::array<float,2>{0.557601213f, 0.826949656f},
-std::array<float,2>{0.215282649f, 0.833722413f},
-std::array<float,2>{0.923876643f, 0.413888812f},
-std::array<float,2>{0.369913459f, 0.156898797f},
-std::array<float,2>{0.529550016f, 0.651148379f},
-std::array<float,2>{0.470730126f, 0.525489748f},
-std::array<float,2>{0.722846687f, 0.0874079838f},
-std::array<float,2>{0.0611936674f, 0.351440668f},
-std::array<float,2>{0.845905542f, 0.976550043f},
-std::array<float,2>{0.252234697f, 0.881508231f},
-std::array<float,2>{0.591320217f, 0.286749274f},
-std::array<float,2>{0.147715241f, 0.050346218f},
-std::array<float,2>{0.994723082f, 0.574370027f},
-std::array<float,2>{0.110506155f, 0.727726042f},
-std::array<float,2>{0.752809465f, 0.249506623f},
-std::array<float,2>{0.397257835f, 0.456537604f},
-std::array<float,2>{0.652430475f, 0.794864058f},
-std::array<float,2>{0.00139365206f, 0.959688902f},
-std::array<float,2>{0.83191061f, 0.320966512f},
-std::array<float,2>{0.441390842f, 0.0958493873f},
-std::array<float,2>{0.704790473f, 0.556815743f},
-std::array<float,2>{0.339384139f, 0.678270698f},
-std::array<float,2>{0.533132374f, 0.133934945f},
-std::array<float,2>{0.226391718f, 0.386619329f},
-std::array<float,2>{0.889660239f, 0.874953568f},
-std::array<float,2>{0.429970205f, 0.759880126f},
-std::array<float,2>{0.679782271f, 0.470160902f},
-std::array<float,2>{0.0768864229f, 0.200961426f},
-std::array<float,2>{0.785815537f, 0.70054698f},
-std::array<float,2>{0.185241476f, 0.618948162f},
-std::array<float,2>{0.94450444f, 7.22791447e-05f},
-std::array<float,2>{0.312458724f, 0.273527712f},
-std::array<float,2>{0.612368286f, 0.934572935f},
-std::array<float,2>{0.151605144f, 0.997857749f},
-std::array<float,2>{0.990386486f, 0.371755928f},
-std::array<float,2>{0.258309186f, 0.0718464106f},
-std::array<float,2>{0.582847953f, 0.504352868f},
-std::array<float,2>{0.404249907f, 0.635825515f},
-std::array<float,2>{0.643083453f, 0.176074371f},
-std::array<float,2>{0.117546804f, 0.427338868f},
-std::array<float,2>{0.761755109f, 0.824068606f},
-std::array<float,2>{0.363130093f, 0.808706164f},
-std::array<float,2>{0.515661359f, 0.452932417f},
-std::array<float,2>{0.208303317f, 0.233024284f},
-std::array<float,2>{0.930623591f, 0.739497721f},
-std::array<float,2>{0.0481033213f, 0.584984124f},
-std::array<float,2>{0.854926288f, 0.0338603631f},
-std::array<float,2>{0.48288399f, 0.311182171f},
-std::array<float,2>{0.72781992f, 0.89847374f},
-std::array<float,2>{0.0699975714f, 0.853802025f},
-std::array<float,2>{0.790470421f, 0.391089827f},
-std::array<float,2>{0.422038049f, 0.151802018f},
-std::array<float,2>{0.674667597f, 0.661759973f},
-std::array<float,2>{0.302234232f, 0.546108067f},
-std::array<float,2>{0.623007357f, 0.110970572f},
-std::array<float,2>{0.177917764f, 0.333547503f},
-std::array<float,2>{0.950890779f, 0.949337423f},
-std::array<float,2>{0.451639712f, 0.909514844f},
-std::array<float,2>{0.718181133f, 0.262320876f},
-std::array<float,2>{0.00801218208f, 0.0279614665f},
-std::array<float,2>{0.840770423f, 0.603968561f},
-std::array<float,2>{0.232663974f, 0.708140135f},
-std::array<float,2>{0.877624094f, 0.203863218f},
-std::array<float,2>{0.330227911f, 0.498125017f},
-std::array<float,2>{0.544255018f, 0.770235419f},
-std::array<float,2>{0.192512646f, 0.765216112f},
-std::array<float,2>{0.906540811f, 0.475617468f},
-std::array<float,2>{0.34799844f, 0.195943967f},
-std::array<float,2>{0.504723489f, 0.696011245f},
-std::array<float,2>{0.495033115f, 0.622032344f},
-std::array<float,2>{0.739252806f, 0.0046677771f},
-std::array<float,2>{0.0424197242f, 0.277754784f},
-std::array<float,2>{0.873094916f, 0.930511594f},
-std::array<float,2>{0.269419253f, 0.955668211f},
-std::array<float,2>{0.565048635f, 0.325983763f},
-std::array<float,2>{0.134569198f, 0.097854957f},
-std::array<float,2>{0.97017765f, 0.560830355f},
-std::array<float,2>{0.107760489f, 0.675692856f},
-std::array<float,2>{0.770440459f, 0.136984721f},
-std::array<float,2>{0.38501513f, 0.389785498f},
-std::array<float,2>{0.62638694f, 0.869953811f},
-std::array<float,2>{0.0301747788f, 0.878233731f},
-std::array<float,2>{0.813231409f, 0.284692466f},
-std::array<float,2>{0.460880846f, 0.0546363555f},
-std::array<float,2>{0.702907145f, 0.570658922f},
-std::array<float,2>{0.32162416f, 0.733631432f},
-std::array<float,2>{0.550711036f, 0.245294541f},
-std::array<float,2>{0.236781716f, 0.459912032f},
-std::array<float,2>{0.8982265f, 0.791746199f},
-std::array<float,2>{0.407181889f, 0.82937175f},
-std::array<float,2>{0.660336077f, 0.409398735f},
-std::array<float,2>{0.0803513154f, 0.161000803f},
-std::array<float,2>{0.804754615f, 0.654020369f},
-std::array<float,2>{0.161589205f, 0.528513432f},
-std::array<float,2>{0.966359735f, 0.0910718367f},
-std::array<float,2>{0.290899247f, 0.346514732f},
-std::array<float,2>{0.603082895f, 0.972191691f},
-std::array<float,2>{0.24637723f, 0.926900566f},
-std::array<float,2>{0.90506798f, 0.27278167f},
-std::array<float,2>{0.319488406f, 0.0129618654f},
-std::array<float,2>{0.559821188f, 0.615119696f},
-std::array<float,2>{0.462749183f, 0.691474497f},
-std::array<float,2>{0.692866266f, 0.191713527f},
-std::array<float,2>{0.0210444592f, 0.482690066f},
-std::array<float,2>{0.82571888f, 0.751853704f},
-std::array<float,2>{0.283402473f, 0.864967287f},
-std::array<float,2>{0.596495628f, 0.376792848f},
-std::array<float,2>{0.170586899f, 0.130015537f},
-std::array<float,2>{0.953650713f, 0.68464005f},
-std::array<float,2>{0.0906637236f, 0.553582191f},
-std::array<float,2>{0.798663259f, 0.108496882f},
-std::array<float,2>{0.415598214f, 0.314144254f},
-std::array<float,2>{0.665259421f, 0.961817086f},
-std::array<float,2>{0.0330423638f, 0.783653021f},
-std::array<float,2>{0.864193857f, 0.462497145f},
-std::array<float,2>{0.489537209f, 0.23754479f},
-std::array<float,2>{0.749063969f, 0.724254727f},
-std::array<float,2>{0.3530128f, 0.565338731f},
-std::array<float,2>{0.509101152f, 0.057639692f},
-std::array<float,2>{0.199153543f, 0.292944491f},
-std::array<float,2>{0.916405559f, 0.888802588f},
-std::array<float,2>{0.376498848f, 0.980357409f},
-std::array<float,2>{0.633200109f, 0.3587901f},
-std::array<float,2>{0.101281539f, 0.0784986913f},
-std::array<float,2>{0.775639772f, 0.521053314f},
-std::array<float,2>{0.130713984f, 0.645826936f},
-std::array<float,2>{0.984256983f, 0.170888156f},
-std::array<float,2>{0.277133614f, 0.417401731f},
-std::array<float,2>{0.570679665f, 0.840061069f},
-std::array<float,2>{0.179758012f, 0.816144168f},
-std::array<float,2>{0.940498173f, 0.435442805f},
-std::array<float,2>{0.30470258f, 0.182192057f},
-std::array<float,2>{0.616757572f, 0.625405669f},
-std::array<float,2>{0.437063277f, 0.515167952f},
-std::array<float,2>{0.686710298f, 0.0675989091f},
-std::array<float,2>{0.0736677721f, 0.366680115f},
-std::array<float,2>{0.781862676f, 0.988020539f},
-std::array<float,2>{0.340566963f, 0.894058764f},
-std::array<float,2>{0.535624266f, 0.301094711f},
-std::array<float,2>{0.221609563f, 0.0441816337f},
-std::array<float,2>{0.88445127f, 0.587377548f},
-std::array<float,2>{0.00639298977f, 0.749322772f},
-std::array<float,2>{0.833602726f, 0.220878839f},
-std::array<float,2>{0.442488074f, 0.439902723f},
-std::array<float,2>{0.709483385f, 0.799736083f},
-std::array<float,2>{0.113635585f, 0.940666199f},
-std::array<float,2>{0.75421375f, 0.34078604f},
-std::array<float,2>{0.391699165f, 0.124873057f},
-std::array<float,2>{0.65135783f, 0.534053385f},
-std::array<float,2>{0.255016029f, 0.671869516f},
-std::array<float,2>{0.586826503f, 0.142639175f},
-std::array<float,2>{0.143542334f, 0.403735965f},
-std::array<float,2>{0.996572852f, 0.847766936f},
-std::array<float,2>{0.472686768f, 0.773927867f},
-std::array<float,2>{0.719424605f, 0.488588929f},
-std::array<float,2>{0.0564775839f, 0.211051896f},
-std::array<float,2>{0.848997056f, 0.718569934f},
-std::array<float,2>{0.21309118f, 0.59477365f},
-std::array<float,2>{0.928080559f, 0.0162610523f},
-std::array<float,2>{0.374373883f, 0.256729692f},
-std::array<float,2>{0.523669422f, 0.916587949f},
-std::array<float,2>{0.206098408f, 0.965941966f},
-std::array<float,2>{0.936025977f, 0.317477226f},
-std::array<float,2>{0.364734679f, 0.102305003f},
-std::array<float,2>{0.52259475f, 0.547548771f},
-std::array<float,2>{0.478938311f, 0.681285203f},
-std::array<float,2>{0.731101036f, 0.125653431f},
-std::array<float,2>{0.0514070913f, 0.379408568f},
-std::array<float,2>{0.859103382f, 0.860062361f},
-std::array<float,2>{0.263883084f, 0.754516184f},
-std::array<float,2>{0.578845561f, 0.47829026f},
-std::array<float,2>{0.155153334f, 0.188697129f},
-std::array<float,2>{0.986084998f, 0.69053328f},
-std::array<float,2>{0.123990394f, 0.612904847f},
-std::array<float,2>{0.760307789f, 0.0107517922f},
-std::array<float,2>{0.399274617f, 0.268045962f},
-std::array<float,2>{0.647054493f, 0.922778428f},
-std::array<float,2>{0.0141349332f, 0.837389469f},
-std::array<float,2>{0.839748263f, 0.421247303f},
-std::array<float,2>{0.445871055f, 0.16721949f},
-std::array<float,2>{0.711427867f, 0.64390409f},
-std::array<float,2>{0.335336059f, 0.519053936f},
-std::array<float,2>{0.540251732f, 0.0833159313f},
-std::array<float,2>{0.227566153f, 0.352970153f},
-std::array<float,2>{0.880177081f, 0.98289305f},
-std::array<float,2>{0.425782293f, 0.884892344f},
-std::array<float,2>{0.678072035f, 0.293594629f},
-std::array<float,2>{0.0628763512f, 0.0612212792f},
-std::array<float,2>{0.795914412f, 0.570090413f},
-std::array<float,2>{0.172104537f, 0.719311059f},
-std::array<float,2>{0.946209192f, 0.240836963f},
-std::array<float,2>{0.297233731f, 0.467943758f},
-std::array<float,2>{0.619870901f, 0.787705958f},
-std::array<float,2>{0.139447764f, 0.802324414f},
-std::array<float,2>{0.973218322f, 0.442725241f},
-std::array<float,2>{0.270765394f, 0.223979875f},
-std::array<float,2>{0.566777825f, 0.743430912f},
-std::array<float,2>{0.387685359f, 0.591618598f},
-std::array<float,2>{0.63102001f, 0.03942018f},
-std::array<float,2>{0.104372792f, 0.297997385f},
-std::array<float,2>{0.766914546f, 0.898258209f},
-std::array<float,2>{0.346762359f, 0.99130851f},
-std::array<float,2>{0.503060699f, 0.362073451f},
-std::array<float,2>{0.190673977f, 0.0625991151f},
-std::array<float,2>{0.911987126f, 0.508539259f},
-std::array<float,2>{0.0430625975f, 0.630684614f},
-std::array<float,2>{0.869530618f, 0.187477022f},
-std::array<float,2>{0.496523798f, 0.431507021f},
-std::array<float,2>{0.736096025f, 0.81792295f},
-std::array<float,2>{0.0825936198f, 0.921734929f},
-std::array<float,2>{0.809028387f, 0.253594995f},
-std::array<float,2>{0.410311401f, 0.0204373393f},
-std::array<float,2>{0.659959912f, 0.598290563f},
-std::array<float,2>{0.2947326f, 0.712173045f},
-std::array<float,2>{0.608768463f, 0.217660785f},
-std::array<float,2>{0.159718409f, 0.487103552f},
-std::array<float,2>{0.964076102f, 0.778136373f},
-std::array<float,2>{0.455248445f, 0.844658732f},
-std::array<float,2>{0.695943773f, 0.402110875f},
-std::array<float,2>{0.0241631288f, 0.146186352f},
-std::array<float,2>{0.817316651f, 0.667093098f},
-std::array<float,2>{0.238910452f, 0.536066532f},
-std::array<float,2>{0.893346727f, 0.121083371f},
-std::array<float,2>{0.325649679f, 0.339530528f},
-std::array<float,2>{0.551971734f, 0.941884339f},
-std::array<float,2>{0.167776152f, 0.902510464f},
-std::array<float,2>{0.957855403f, 0.307720244f},
-std::array<float,2>{0.286583126f, 0.0386847667f},
-std::array<float,2>{0.598953605f, 0.579979122f},
-std::array<float,2>{0.420995772f, 0.734471321f},
-std::array<float,2>{0.669542849f, 0.226864725f},
-std::array<float,2>{0.0895267203f, 0.446789503f},
-std::array<float,2>{0.803492725f, 0.807521284f},
-std::array<float,2>{0.314672321f, 0.825575233f},
-std::array<float,2>{0.554793239f, 0.423600405f},
-std::array<float,2>{0.243451476f, 0.17381455f},
-std::array<float,2>{0.901324272f, 0.638248563f},
-std::array<float,2>{0.018359378f, 0.501727402f},
-std::array<float,2>{0.822608769f, 0.0771378428f},
-std::array<float,2>{0.467603505f, 0.370482951f},
-std::array<float,2>{0.689458787f, 0.992719769f},
-std::array<float,2>{0.0945677012f, 0.766694605f},
-std::array<float,2>{0.779425442f, 0.492640734f},
-std::array<float,2>{0.381831944f, 0.209657833f},
-std::array<float,2>{0.639685273f, 0.70546037f},
-std::array<float,2>{0.278828293f, 0.608404517f},
-std::array<float,2>{0.576638579f, 0.0267052203f},
-std::array<float,2>{0.12617062f, 0.260302216f},
-std::array<float,2>{0.979967833f, 0.910913527f},
-std::array<float,2>{0.484591961f, 0.945666373f},
-std::array<float,2>{0.744402707f, 0.331761807f},
-std::array<float,2>{0.0383147746f, 0.117153727f},
-std::array<float,2>{0.861429393f, 0.540075898f},
-std::array<float,2>{0.202937931f, 0.657784164f},
-std::array<float,2>{0.918285787f, 0.153644651f},
-std::array<float,2>{0.357637376f, 0.396961361f},
-std::array<float,2>{0.514275968f, 0.857458472f},
-std::array<float,2>{0.223701939f, 0.872335374f},
-std::array<float,2>{0.88723594f, 0.384635121f},
-std::array<float,2>{0.336877555f, 0.135447398f},
-std::array<float,2>{0.533495247f, 0.677502275f},
-std::array<float,2>{0.437907428f, 0.555226564f},
-std::array<float,2>{0.705422819f, 0.0939301699f},
-std::array<float,2>{0.00340126036f, 0.323637694f},
-std::array<float,2>{0.829047918f, 0.958070934f},
-std::array<float,2>{0.308704913f, 0.936569333f},
-std::array<float,2>{0.609889328f, 0.276501477f},
-std::array<float,2>{0.187264144f, 0.00253898744f},
-std::array<float,2>{0.942915618f, 0.620394826f},
-std::array<float,2>{0.0760478228f, 0.701411784f},
-std::array<float,2>{0.787961423f, 0.201481506f},
-std::array<float,2>{0.433505952f, 0.472084045f},
-std::array<float,2>{0.682789266f, 0.759550929f},
-std::array<float,2>{0.0588685982f, 0.973803401f},
-std::array<float,2>{0.845516622f, 0.349546671f},
-std::array<float,2>{0.469181061f, 0.0888279304f},
-std::array<float,2>{0.726433635f, 0.523903728f},
-std::array<float,2>{0.36869812f, 0.648547471f},
-std::array<float,2>{0.529146373f, 0.158403143f},
-std::array<float,2>{0.217608348f, 0.410666943f},
-std::array<float,2>{0.923286021f, 0.834481418f},
-std::array<float,2>{0.395538211f, 0.795906901f},
-std::array<float,2>{0.654315472f, 0.455058485f},
-std::array<float,2>{0.111711152f, 0.246666119f},
-std::array<float,2>{0.75111717f, 0.729485691f},
-std::array<float,2>{0.145510286f, 0.576500237f},
-std::array<float,2>{0.993419409f, 0.0487732999f},
-std::array<float,2>{0.251128078f, 0.287790358f},
-std::array<float,2>{0.593017817f, 0.880788505f},
-std::array<float,2>{0.154928371f, 0.968505502f},
-std::array<float,2>{0.985845566f, 0.319850326f},
-std::array<float,2>{0.264140129f, 0.103637539f},
-std::array<float,2>{0.57894218f, 0.549954355f},
-std::array<float,2>{0.398934096f, 0.683396876f},
-std::array<float,2>{0.647286057f, 0.128566653f},
-std::array<float,2>{0.123585261f, 0.380872518f},
-std::array<float,2>{0.76050806f, 0.862622023f},
-std::array<float,2>{0.364484519f, 0.756392717f},
-std::array<float,2>{0.522856414f, 0.479880571f},
-std::array<float,2>{0.206455916f, 0.190363288f},
-std::array<float,2>{0.935739934f, 0.687621593f},
-std::array<float,2>{0.0516326167f, 0.610719264f},
-std::array<float,2>{0.859294415f, 0.00794327445f},
-std::array<float,2>{0.478546917f, 0.265701532f},
-std::array<float,2>{0.731401563f, 0.923881054f},
-std::array<float,2>{0.0627102554f, 0.838150263f},
-std::array<float,2>{0.796315849f, 0.419299215f},
-std::array<float,2>{0.426251858f, 0.16504392f},
-std::array<float,2>{0.677884877f, 0.642046392f},
-std::array<float,2>{0.297010958f, 0.516384184f},
-std::array<float,2>{0.620012343f, 0.085652858f},
-std::array<float,2>{0.17214112f, 0.353798568f},
-std::array<float,2>{0.94585681f, 0.980499148f},
-std::array<float,2>{0.446174145f, 0.884587288f},
-std::array<float,2>{0.711765468f, 0.295818776f},
-std::array<float,2>{0.0138587048f, 0.0604714118f},
-std::array<float,2>{0.839553952f, 0.566937327f},
-std::array<float,2>{0.227900818f, 0.722290933f},
-std::array<float,2>{0.880033076f, 0.239026874f},
-std::array<float,2>{0.334965348f, 0.466760516f},
-std::array<float,2>{0.540332913f, 0.786534011f},
-std::array<float,2>{0.190539122f, 0.804112613f},
-std::array<float,2>{0.911624134f, 0.443422347f},
-std::array<float,2>{0.347061872f, 0.224984407f},
-std::array<float,2>{0.503298044f, 0.745784998f},
-std::array<float,2>{0.496127784f, 0.593069375f},
-std::array<float,2>{0.735944927f, 0.0427779704f},
-std::array<float,2>{0.0433233641f, 0.299602002f},
-std::array<float,2>{0.869320989f, 0.894746602f},
-std::array<float,2>{0.270634472f, 0.989515305f},
-std::array<float,2>{0.56657052f, 0.361101478f},
-std::array<float,2>{0.139248505f, 0.0662928298f},
-std::array<float,2>{0.973449826f, 0.511066854f},
-std::array<float,2>{0.104195789f, 0.632556617f},
-std::array<float,2>{0.766682029f, 0.185145468f},
-std::array<float,2>{0.387251914f, 0.432212293f},
-std::array<float,2>{0.631307006f, 0.820188165f},
-std::array<float,2>{0.0243145954f, 0.919872105f},
-std::array<float,2>{0.817088246f, 0.251612842f},
-std::array<float,2>{0.455468416f, 0.0221709739f},
-std::array<float,2>{0.696091294f, 0.600810885f},
-std::array<float,2>{0.325384766f, 0.713250458f},
-std::array<float,2>{0.552141309f, 0.215630814f},
-std::array<float,2>{0.239039287f, 0.485752553f},
-std::array<float,2>{0.893305123f, 0.780656219f},
-std::array<float,2>{0.41055277f, 0.847131729f},
-std::array<float,2>{0.659736216f, 0.398750752f},
-std::array<float,2>{0.0829158798f, 0.148031592f},
-std::array<float,2>{0.808596134f, 0.664945066f},
-std::array<float,2>{0.159983873f, 0.537927628f},
-std::array<float,2>{0.964201272f, 0.11888101f},
-std::array<float,2>{0.2944718f, 0.337204695f},
-std::array<float,2>{0.608495653f, 0.944771826f},
-std::array<float,2>{0.243275762f, 0.904553115f},
-std::array<float,2>{0.900972068f, 0.306550682f},
-std::array<float,2>{0.314881593f, 0.0357762277f},
-std::array<float,2>{0.555071414f, 0.580281734f},
-std::array<float,2>{0.467298597f, 0.737847149f},
-std::array<float,2>{0.689775229f, 0.228568226f},
-std::array<float,2>{0.0181029718f, 0.448019952f},
-std::array<float,2>{0.822274387f, 0.805468798f},
-std::array<float,2>{0.286311895f, 0.827830076f},
-std::array<float,2>{0.59866184f, 0.423902899f},
-std::array<float,2>{0.167518258f, 0.173919916f},
-std::array<float,2>{0.957574487f, 0.639929533f},
-std::array<float,2>{0.0897557512f, 0.503739119f},
-std::array<float,2>{0.80331552f, 0.0752539113f},
-std::array<float,2>{0.421204001f, 0.367803395f},
-std::array<float,2>{0.669831395f, 0.995561957f},
-std::array<float,2>{0.0385735631f, 0.768530071f},
-std::array<float,2>{0.861622691f, 0.494253814f},
-std::array<float,2>{0.48462525f, 0.20795089f},
-std::array<float,2>{0.744154751f, 0.705051005f},
-std::array<float,2>{0.357861847f, 0.606653094f},
-std::array<float,2>{0.51461935f, 0.0253558457f},
-std::array<float,2>{0.202679589f, 0.25950554f},
-std::array<float,2>{0.91809088f, 0.913897395f},
-std::array<float,2>{0.381372452f, 0.947724342f},
-std::array<float,2>{0.640047669f, 0.33005622f},
-std::array<float,2>{0.0943728164f, 0.113311216f},
-std::array<float,2>{0.779698551f, 0.542710245f},
-std::array<float,2>{0.126316085f, 0.659463704f},
-std::array<float,2>{0.979688048f, 0.155647546f},
-std::array<float,2>{0.279212415f, 0.395738691f},
-std::array<float,2>{0.576182842f, 0.85713619f},
-std::array<float,2>{0.187233686f, 0.873903215f},
-std::array<float,2>{0.943172693f, 0.385182798f},
-std::array<float,2>{0.309036583f, 0.133502722f},
-std::array<float,2>{0.610334754f, 0.678847134f},
-std::array<float,2>{0.433243901f, 0.557798028f},
-std::array<float,2>{0.682887256f, 0.0971500948f},
-std::array<float,2>{0.0758810043f, 0.32212618f},
-std::array<float,2>{0.787778139f, 0.960492969f},
-std::array<float,2>{0.336653799f, 0.934459031f},
-std::array<float,2>{0.533420324f, 0.275196642f},
-std::array<float,2>{0.223927453f, 0.0011878314f},
-std::array<float,2>{0.887486756f, 0.617289722f},
-std::array<float,2>{0.0031611803f, 0.699548006f},
-std::array<float,2>{0.828639507f, 0.199490577f},
-std::array<float,2>{0.437506527f, 0.469407171f},
-std::array<float,2>{0.705289662f, 0.760965526f},
-std::array<float,2>{0.111496359f, 0.97541678f},
-std::array<float,2>{0.751408756f, 0.350126147f},
-std::array<float,2>{0.395890146f, 0.0862258598f},
-std::array<float,2>{0.654770315f, 0.52666676f},
-std::array<float,2>{0.251320183f, 0.652300537f},
-std::array<float,2>{0.592949867f, 0.157850266f},
-std::array<float,2>{0.145979837f, 0.412199795f},
-std::array<float,2>{0.99338448f, 0.832811236f},
-std::array<float,2>{0.468857914f, 0.793016076f},
-std::array<float,2>{0.72626245f, 0.455510348f},
-std::array<float,2>{0.058719337f, 0.248385161f},
-std::array<float,2>{0.845265329f, 0.726875603f},
-std::array<float,2>{0.217500165f, 0.575270057f},
-std::array<float,2>{0.922995389f, 0.0497323573f},
-std::array<float,2>{0.368984669f, 0.285963565f},
-std::array<float,2>{0.528940618f, 0.88187629f},
-std::array<float,2>{0.208071157f, 0.998242557f},
-std::array<float,2>{0.930228591f, 0.373388201f},
-std::array<float,2>{0.362800688f, 0.0740771443f},
-std::array<float,2>{0.51606971f, 0.507326365f},
-std::array<float,2>{0.482449263f, 0.633404195f},
-std::array<float,2>{0.727700174f, 0.178191513f},
-std::array<float,2>{0.0479573384f, 0.427844286f},
-std::array<float,2>{0.854603529f, 0.82134068f},
-std::array<float,2>{0.25875628f, 0.810617566f},
-std::array<float,2>{0.582744181f, 0.449708253f},
-std::array<float,2>{0.151766703f, 0.230764464f},
-std::array<float,2>{0.990497291f, 0.740257263f},
-std::array<float,2>{0.117406003f, 0.582557678f},
-std::array<float,2>{0.762180984f, 0.0324389376f},
-std::array<float,2>{0.403946906f, 0.310285866f},
-std::array<float,2>{0.643434465f, 0.902316332f},
-std::array<float,2>{0.00815674011f, 0.85300827f},
-std::array<float,2>{0.840385556f, 0.394346029f},
-std::array<float,2>{0.451405108f, 0.148683429f},
-std::array<float,2>{0.717968047f, 0.663027644f},
-std::array<float,2>{0.330503374f, 0.544261098f},
-std::array<float,2>{0.54396069f, 0.112279937f},
-std::array<float,2>{0.232856825f, 0.334689945f},
-std::array<float,2>{0.877763212f, 0.951624572f},
-std::array<float,2>{0.422308177f, 0.908152699f},
-std::array<float,2>{0.674398541f, 0.26535514f},
-std::array<float,2>{0.0701977089f, 0.0307340808f},
-std::array<float,2>{0.79022944f, 0.602446496f},
-std::array<float,2>{0.178056911f, 0.71000737f},
-std::array<float,2>{0.951051176f, 0.205117002f},
-std::array<float,2>{0.301930755f, 0.49649024f},
-std::array<float,2>{0.622654974f, 0.772193789f},
-std::array<float,2>{0.134431943f, 0.762389243f},
-std::array<float,2>{0.969741642f, 0.473854333f},
-std::array<float,2>{0.269133538f, 0.19758065f},
-std::array<float,2>{0.565224648f, 0.698138654f},
-std::array<float,2>{0.384798944f, 0.623718321f},
-std::array<float,2>{0.626166821f, 0.00779770594f},
-std::array<float,2>{0.107493013f, 0.28067556f},
-std::array<float,2>{0.770186245f, 0.9319942f},
-std::array<float,2>{0.347806543f, 0.953890264f},
-std::array<float,2>{0.504421949f, 0.327317059f},
-std::array<float,2>{0.192630053f, 0.100414701f},
-std::array<float,2>{0.906448066f, 0.560494244f},
-std::array<float,2>{0.0421093963f, 0.673554778f},
-std::array<float,2>{0.87343508f, 0.139881611f},
-std::array<float,2>{0.494744003f, 0.388024479f},
-std::array<float,2>{0.738931358f, 0.867634416f},
-std::array<float,2>{0.0801533833f, 0.876255035f},
-std::array<float,2>{0.80505383f, 0.282905191f},
-std::array<float,2>{0.406948388f, 0.0524750687f},
-std::array<float,2>{0.660567105f, 0.573388517f},
-std::array<float,2>{0.290649682f, 0.731812418f},
-std::array<float,2>{0.603419065f, 0.243750349f},
-std::array<float,2>{0.161153734f, 0.457654834f},
-std::array<float,2>{0.966654897f, 0.789489329f},
-std::array<float,2>{0.46051982f, 0.830931783f},
-std::array<float,2>{0.70273459f, 0.408142596f},
-std::array<float,2>{0.030004276f, 0.162797943f},
-std::array<float,2>{0.813349366f, 0.65498358f},
-std::array<float,2>{0.236365944f, 0.529939353f},
-std::array<float,2>{0.898061454f, 0.0928273201f},
-std::array<float,2>{0.321415961f, 0.344263166f},
-std::array<float,2>{0.550535023f, 0.970286608f},
-std::array<float,2>{0.170820788f, 0.928259134f},
-std::array<float,2>{0.953867078f, 0.269931346f},
-std::array<float,2>{0.283460021f, 0.0137262046f},
-std::array<float,2>{0.596233428f, 0.617079198f},
-std::array<float,2>{0.415854603f, 0.695172727f},
-std::array<float,2>{0.665292203f, 0.194516003f},
-std::array<float,2>{0.0904748291f, 0.48052913f},
-std::array<float,2>{0.798394084f, 0.752614915f},
-std::array<float,2>{0.319725096f, 0.866566658f},
-std::array<float,2>{0.55976063f, 0.378307849f},
-std::array<float,2>{0.246238843f, 0.132017985f},
-std::array<float,2>{0.904915035f, 0.687317252f},
-std::array<float,2>{0.0213406328f, 0.552577734f},
-std::array<float,2>{0.825963676f, 0.106132105f},
-std::array<float,2>{0.462568253f, 0.316114724f},
-std::array<float,2>{0.692611873f, 0.963540792f},
-std::array<float,2>{0.101490349f, 0.782392263f},
-std::array<float,2>{0.775595546f, 0.463117689f},
-std::array<float,2>{0.376912475f, 0.23595722f},
-std::array<float,2>{0.63283819f, 0.725276411f},
-std::array<float,2>{0.277033925f, 0.562578738f},
-std::array<float,2>{0.570462167f, 0.0551197603f},
-std::array<float,2>{0.13053669f, 0.289943933f},
-std::array<float,2>{0.984116852f, 0.887001991f},
-std::array<float,2>{0.489319444f, 0.977790356f},
-std::array<float,2>{0.749335229f, 0.355715811f},
-std::array<float,2>{0.0327347443f, 0.0817101747f},
-std::array<float,2>{0.8640064f, 0.521934271f},
-std::array<float,2>{0.198960587f, 0.647092164f},
-std::array<float,2>{0.91612488f, 0.168919459f},
-std::array<float,2>{0.352757931f, 0.41540724f},
-std::array<float,2>{0.50902307f, 0.843547046f},
-std::array<float,2>{0.221343458f, 0.813006878f},
-std::array<float,2>{0.884550214f, 0.436224341f},
-std::array<float,2>{0.34072867f, 0.180375859f},
-std::array<float,2>{0.535391152f, 0.627076924f},
-std::array<float,2>{0.442699194f, 0.513267577f},
-std::array<float,2>{0.709831238f, 0.0685124546f},
-std::array<float,2>{0.00682305219f, 0.363320351f},
-std::array<float,2>{0.833870113f, 0.986283243f},
-std::array<float,2>{0.305155933f, 0.890856206f},
-std::array<float,2>{0.617082179f, 0.302761674f},
-std::array<float,2>{0.18009536f, 0.045366928f},
-std::array<float,2>{0.940828621f, 0.589255691f},
-std::array<float,2>{0.0734431371f, 0.74644351f},
-std::array<float,2>{0.781992435f, 0.219185084f},
-std::array<float,2>{0.437301368f, 0.438064963f},
-std::array<float,2>{0.686992407f, 0.797858953f},
-std::array<float,2>{0.0563481227f, 0.937934875f},
-std::array<float,2>{0.848746121f, 0.342332542f},
-std::array<float,2>{0.473006845f, 0.122510858f},
-std::array<float,2>{0.719545364f, 0.532996535f},
-std::array<float,2>{0.374138862f, 0.668717742f},
-std::array<float,2>{0.523790181f, 0.140625194f},
-std::array<float,2>{0.213155851f, 0.404559523f},
-std::array<float,2>{0.927891791f, 0.850640476f},
-std::array<float,2>{0.391855389f, 0.776712418f},
-std::array<float,2>{0.651016414f, 0.491798311f},
-std::array<float,2>{0.113505796f, 0.214221165f},
-std::array<float,2>{0.753952086f, 0.715948105f},
-std::array<float,2>{0.143167868f, 0.596582234f},
-std::array<float,2>{0.996244133f, 0.0194727667f},
-std::array<float,2>{0.25520432f, 0.255081803f},
-std::array<float,2>{0.586548984f, 0.91593492f},
-std::array<float,2>{0.174997717f, 0.983791232f},
-std::array<float,2>{0.948446333f, 0.351979434f},
-std::array<float,2>{0.2990731f, 0.0824759677f},
-std::array<float,2>{0.617706299f, 0.518334091f},
-std::array<float,2>{0.428794622f, 0.642813206f},
-std::array<float,2>{0.67673099f, 0.166732222f},
-std::array<float,2>{0.0644903407f, 0.420232832f},
-std::array<float,2>{0.794586241f, 0.836857975f},
-std::array<float,2>{0.332305044f, 0.788201153f},
-std::array<float,2>{0.542956769f, 0.467393279f},
-std::array<float,2>{0.230012104f, 0.241782218f},
-std::array<float,2>{0.882432282f, 0.720294774f},
-std::array<float,2>{0.012310612f, 0.569015026f},
-std::array<float,2>{0.837126434f, 0.0621416271f},
-std::array<float,2>{0.448576868f, 0.294828117f},
-std::array<float,2>{0.714148939f, 0.886491239f},
-std::array<float,2>{0.121185131f, 0.860988438f},
-std::array<float,2>{0.758061647f, 0.380725265f},
-std::array<float,2>{0.401976556f, 0.126009852f},
-std::array<float,2>{0.644999921f, 0.679714441f},
-std::array<float,2>{0.262323856f, 0.548574269f},
-std::array<float,2>{0.580269873f, 0.102864072f},
-std::array<float,2>{0.153860301f, 0.317343056f},
-std::array<float,2>{0.987829685f, 0.965066135f},
-std::array<float,2>{0.478337109f, 0.923487902f},
-std::array<float,2>{0.732756436f, 0.269191563f},
-std::array<float,2>{0.0529994555f, 0.010461905f},
-std::array<float,2>{0.856674552f, 0.61168474f},
-std::array<float,2>{0.203891709f, 0.689504027f},
-std::array<float,2>{0.935504556f, 0.188180625f},
-std::array<float,2>{0.366239846f, 0.47662127f},
-std::array<float,2>{0.519893706f, 0.755559981f},
-std::array<float,2>{0.240836486f, 0.778829753f},
-std::array<float,2>{0.891314924f, 0.487434685f},
-std::array<float,2>{0.326702446f, 0.218604743f},
-std::array<float,2>{0.554260373f, 0.71132803f},
-std::array<float,2>{0.454581171f, 0.599399745f},
-std::array<float,2>{0.697319448f, 0.0209356491f},
-std::array<float,2>{0.0255303308f, 0.252788156f},
-std::array<float,2>{0.819778025f, 0.920863092f},
-std::array<float,2>{0.295864463f, 0.942785859f},
-std::array<float,2>{0.606110632f, 0.338697195f},
-std::array<float,2>{0.157337025f, 0.119593903f},
-std::array<float,2>{0.961302102f, 0.536665559f},
-std::array<float,2>{0.0849566683f, 0.666118562f},
-std::array<float,2>{0.811946154f, 0.144721717f},
-std::array<float,2>{0.41218999f, 0.400549203f},
-std::array<float,2>{0.657351792f, 0.845409513f},
-std::array<float,2>{0.0457243882f, 0.896836698f},
-std::array<float,2>{0.869053483f, 0.296897411f},
-std::array<float,2>{0.499576628f, 0.0406605229f},
-std::array<float,2>{0.737525582f, 0.590313435f},
-std::array<float,2>{0.34564364f, 0.742803514f},
-std::array<float,2>{0.500034451f, 0.223415136f},
-std::array<float,2>{0.188764319f, 0.442001641f},
-std::array<float,2>{0.913510144f, 0.800842941f},
-std::array<float,2>{0.389390498f, 0.816652238f},
-std::array<float,2>{0.630534112f, 0.430324614f},
-std::array<float,2>{0.103054442f, 0.185791016f},
-std::array<float,2>{0.767793536f, 0.629569769f},
-std::array<float,2>{0.13788189f, 0.508976877f},
-std::array<float,2>{0.975182474f, 0.0638555214f},
-std::array<float,2>{0.272574723f, 0.362447679f},
-std::array<float,2>{0.569138765f, 0.990346909f},
-std::array<float,2>{0.199427977f, 0.911786735f},
-std::array<float,2>{0.920036197f, 0.261078477f},
-std::array<float,2>{0.357100844f, 0.02540824f},
-std::array<float,2>{0.512196183f, 0.608321905f},
-std::array<float,2>{0.48705104f, 0.706990421f},
-std::array<float,2>{0.743909717f, 0.210414395f},
-std::array<float,2>{0.0370565094f, 0.494140148f},
-std::array<float,2>{0.861081958f, 0.766572595f},
-std::array<float,2>{0.280031323f, 0.858622789f},
-std::array<float,2>{0.575793445f, 0.397803247f},
-std::array<float,2>{0.12870799f, 0.152390853f},
-std::array<float,2>{0.97778523f, 0.656641781f},
-std::array<float,2>{0.0969693437f, 0.539414227f},
-std::array<float,2>{0.77923876f, 0.116039649f},
-std::array<float,2>{0.37939018f, 0.330207974f},
-std::array<float,2>{0.63724798f, 0.947007656f},
-std::array<float,2>{0.0164571293f, 0.808166981f},
-std::array<float,2>{0.821778774f, 0.445679903f},
-std::array<float,2>{0.465368062f, 0.228493437f},
-std::array<float,2>{0.688452005f, 0.735599041f},
-std::array<float,2>{0.313419133f, 0.578503132f},
-std::array<float,2>{0.557322323f, 0.0373206139f},
-std::array<float,2>{0.245676458f, 0.30752188f},
-std::array<float,2>{0.899752319f, 0.903527141f},
-std::array<float,2>{0.418096781f, 0.993568122f},
-std::array<float,2>{0.671471536f, 0.369692355f},
-std::array<float,2>{0.0873900205f, 0.0776690841f},
-std::array<float,2>{0.801806688f, 0.500800848f},
-std::array<float,2>{0.16561231f, 0.637683392f},
-std::array<float,2>{0.959595203f, 0.172810748f},
-std::array<float,2>{0.287826657f, 0.422717899f},
-std::array<float,2>{0.601424813f, 0.824992716f},
-std::array<float,2>{0.147621065f, 0.835675776f},
-std::array<float,2>{0.995074451f, 0.411329657f},
-std::array<float,2>{0.252176762f, 0.15947327f},
-std::array<float,2>{0.591594458f, 0.649634719f},
-std::array<float,2>{0.397183418f, 0.524901271f},
-std::array<float,2>{0.652639627f, 0.0895779654f},
-std::array<float,2>{0.110632673f, 0.348183066f},
-std::array<float,2>{0.752668619f, 0.973156929f},
-std::array<float,2>{0.36973834f, 0.879793704f},
-std::array<float,2>{0.529494941f, 0.288695812f},
-std::array<float,2>{0.214976832f, 0.0475158282f},
-std::array<float,2>{0.924108922f, 0.577912807f},
-std::array<float,2>{0.0613310859f, 0.730232775f},
-std::array<float,2>{0.84604162f, 0.24773173f},
-std::array<float,2>{0.470966458f, 0.453605622f},
-std::array<float,2>{0.72290951f, 0.795427263f},
-std::array<float,2>{0.0771300271f, 0.957777798f},
-std::array<float,2>{0.785915136f, 0.322937518f},
-std::array<float,2>{0.429704636f, 0.0951517597f},
-std::array<float,2>{0.679979503f, 0.556590557f},
-std::array<float,2>{0.312155455f, 0.676301122f},
-std::array<float,2>{0.612603724f, 0.136117727f},
-std::array<float,2>{0.185478941f, 0.383087695f},
-std::array<float,2>{0.944687545f, 0.871185422f},
-std::array<float,2>{0.441134095f, 0.758146524f},
-std::array<float,2>{0.705009758f, 0.470986187f},
-std::array<float,2>{0.00110701076f, 0.20269002f},
-std::array<float,2>{0.831757188f, 0.702390671f},
-std::array<float,2>{0.226271138f, 0.619448483f},
-std::array<float,2>{0.889915228f, 0.00366228982f},
-std::array<float,2>{0.339664668f, 0.27580744f},
-std::array<float,2>{0.532724917f, 0.935691416f},
-std::array<float,2>{0.231375515f, 0.950996339f},
-std::array<float,2>{0.875469029f, 0.332304388f},
-std::array<float,2>{0.328866869f, 0.110033229f},
-std::array<float,2>{0.546372652f, 0.545469165f},
-std::array<float,2>{0.449947476f, 0.660607696f},
-std::array<float,2>{0.715341568f, 0.151243135f},
-std::array<float,2>{0.0104521774f, 0.391941577f},
-std::array<float,2>{0.841800928f, 0.855151355f},
-std::array<float,2>{0.304229915f, 0.770951927f},
-std::array<float,2>{0.624103427f, 0.499715567f},
-std::array<float,2>{0.176390767f, 0.204470545f},
-std::array<float,2>{0.952653944f, 0.707709074f},
-std::array<float,2>{0.0668713525f, 0.605231106f},
-std::array<float,2>{0.79281801f, 0.0284415297f},
-std::array<float,2>{0.424797863f, 0.262966275f},
-std::array<float,2>{0.671937346f, 0.908808053f},
-std::array<float,2>{0.0505558997f, 0.822838962f},
-std::array<float,2>{0.853339553f, 0.426283568f},
-std::array<float,2>{0.480490088f, 0.17677094f},
-std::array<float,2>{0.729170978f, 0.635504365f},
-std::array<float,2>{0.360775143f, 0.505126894f},
-std::array<float,2>{0.518983901f, 0.0711025521f},
-std::array<float,2>{0.209449634f, 0.372865975f},
-std::array<float,2>{0.932140231f, 0.996716797f},
-std::array<float,2>{0.406040609f, 0.899547517f},
-std::array<float,2>{0.641386986f, 0.312085897f},
-std::array<float,2>{0.119172707f, 0.0344373211f},
-std::array<float,2>{0.764398336f, 0.584720373f},
-std::array<float,2>{0.149863839f, 0.738321483f},
-std::array<float,2>{0.988610923f, 0.233908758f},
-std::array<float,2>{0.260419726f, 0.451901704f},
-std::array<float,2>{0.585237384f, 0.809683561f},
-std::array<float,2>{0.163312271f, 0.792634666f},
-std::array<float,2>{0.96770525f, 0.460262686f},
-std::array<float,2>{0.292883068f, 0.244647339f},
-std::array<float,2>{0.605436325f, 0.733184874f},
-std::array<float,2>{0.409895539f, 0.572198272f},
-std::array<float,2>{0.664008379f, 0.0534382574f},
-std::array<float,2>{0.0783909783f, 0.283703059f},
-std::array<float,2>{0.807677865f, 0.877393007f},
-std::array<float,2>{0.322375655f, 0.971103072f},
-std::array<float,2>{0.547849476f, 0.347086191f},
-std::array<float,2>{0.234898821f, 0.0901217982f},
-std::array<float,2>{0.896402597f, 0.528185725f},
-std::array<float,2>{0.0289216992f, 0.652715623f},
-std::array<float,2>{0.815017641f, 0.161984056f},
-std::array<float,2>{0.458037764f, 0.408243865f},
-std::array<float,2>{0.700711727f, 0.828896642f},
-std::array<float,2>{0.106832571f, 0.931621134f},
-std::array<float,2>{0.77274394f, 0.278753519f},
-std::array<float,2>{0.383329004f, 0.00533830421f},
-std::array<float,2>{0.627071023f, 0.622470856f},
-std::array<float,2>{0.267246813f, 0.697201073f},
-std::array<float,2>{0.563390017f, 0.196989492f},
-std::array<float,2>{0.136013031f, 0.475265026f},
-std::array<float,2>{0.971834004f, 0.764024794f},
-std::array<float,2>{0.492634654f, 0.870197356f},
-std::array<float,2>{0.741866648f, 0.388879091f},
-std::array<float,2>{0.039751254f, 0.138637811f},
-std::array<float,2>{0.872992933f, 0.674452901f},
-std::array<float,2>{0.194635257f, 0.562492549f},
-std::array<float,2>{0.908896506f, 0.0993826017f},
-std::array<float,2>{0.349965245f, 0.324656069f},
-std::array<float,2>{0.506406903f, 0.956831515f},
-std::array<float,2>{0.131400064f, 0.889679015f},
-std::array<float,2>{0.980916381f, 0.291109234f},
-std::array<float,2>{0.273723453f, 0.0570646636f},
-std::array<float,2>{0.573205173f, 0.566206157f},
-std::array<float,2>{0.3769719f, 0.723424613f},
-std::array<float,2>{0.636071384f, 0.237048879f},
-std::array<float,2>{0.0986040831f, 0.461628109f},
-std::array<float,2>{0.774985015f, 0.784194827f},
-std::array<float,2>{0.355281681f, 0.840898514f},
-std::array<float,2>{0.511687338f, 0.416902214f},
-std::array<float,2>{0.195601091f, 0.171051681f},
-std::array<float,2>{0.914306045f, 0.645398736f},
-std::array<float,2>{0.0341462456f, 0.519553602f},
-std::array<float,2>{0.865728855f, 0.0791874826f},
-std::array<float,2>{0.491971105f, 0.358325213f},
-std::array<float,2>{0.747627676f, 0.979213417f},
-std::array<float,2>{0.0927016512f, 0.750748277f},
-std::array<float,2>{0.800398409f, 0.483832717f},
-std::array<float,2>{0.417753667f, 0.193350181f},
-std::array<float,2>{0.666521549f, 0.692596376f},
-std::array<float,2>{0.282380998f, 0.614036024f},
-std::array<float,2>{0.59410882f, 0.0122890631f},
-std::array<float,2>{0.168363959f, 0.271820277f},
-std::array<float,2>{0.956004202f, 0.926498234f},
-std::array<float,2>{0.463054359f, 0.962331116f},
-std::array<float,2>{0.694349885f, 0.31259343f},
-std::array<float,2>{0.0220116097f, 0.10791488f},
-std::array<float,2>{0.827848434f, 0.553864479f},
-std::array<float,2>{0.249564007f, 0.683951199f},
-std::array<float,2>{0.903497636f, 0.12916784f},
-std::array<float,2>{0.316435516f, 0.375726849f},
-std::array<float,2>{0.562137902f, 0.863490939f},
-std::array<float,2>{0.212148964f, 0.849417806f},
-std::array<float,2>{0.92697072f, 0.402848661f},
-std::array<float,2>{0.371465683f, 0.144264296f},
-std::array<float,2>{0.527167141f, 0.670467436f},
-std::array<float,2>{0.475574046f, 0.534332395f},
-std::array<float,2>{0.722352684f, 0.123312987f},
-std::array<float,2>{0.0572124906f, 0.341176867f},
-std::array<float,2>{0.850039482f, 0.939798415f},
-std::array<float,2>{0.255984068f, 0.917613506f},
-std::array<float,2>{0.588737309f, 0.257594496f},
-std::array<float,2>{0.141206607f, 0.016957026f},
-std::array<float,2>{0.99900496f, 0.59434396f},
-std::array<float,2>{0.11552611f, 0.717104912f},
-std::array<float,2>{0.756159484f, 0.212115049f},
-std::array<float,2>{0.392803282f, 0.4894135f},
-std::array<float,2>{0.649922788f, 0.775077403f},
-std::array<float,2>{0.00519554596f, 0.98705405f},
-std::array<float,2>{0.834079206f, 0.365296423f},
-std::array<float,2>{0.44383356f, 0.0671490133f},
-std::array<float,2>{0.708308518f, 0.51407212f},
-std::array<float,2>{0.342535019f, 0.626830935f},
-std::array<float,2>{0.538494825f, 0.183286756f},
-std::array<float,2>{0.219465122f, 0.434452921f},
-std::array<float,2>{0.884815276f, 0.814846516f},
-std::array<float,2>{0.434620142f, 0.800317228f},
-std::array<float,2>{0.684155405f, 0.441356331f},
-std::array<float,2>{0.0713530034f, 0.222399339f},
-std::array<float,2>{0.784995556f, 0.748790324f},
-std::array<float,2>{0.182497874f, 0.586447418f},
-std::array<float,2>{0.938433826f, 0.0437467843f},
-std::array<float,2>{0.306836128f, 0.302203953f},
-std::array<float,2>{0.615006745f, 0.893301666f},
-std::array<float,2>{0.156420663f, 0.944161713f},
-std::array<float,2>{0.96232903f, 0.336134523f},
-std::array<float,2>{0.296321154f, 0.117601842f},
-std::array<float,2>{0.606469214f, 0.538544834f},
-std::array<float,2>{0.413717568f, 0.665367305f},
-std::array<float,2>{0.656962693f, 0.147303268f},
-std::array<float,2>{0.0859123394f, 0.400385946f},
-std::array<float,2>{0.811001658f, 0.845892847f},
-std::array<float,2>{0.328121513f, 0.77977711f},
-std::array<float,2>{0.552961111f, 0.484499723f},
-std::array<float,2>{0.241536364f, 0.216097951f},
-std::array<float,2>{0.892556012f, 0.7147879f},
-std::array<float,2>{0.0271502323f, 0.600459218f},
-std::array<float,2>{0.818664789f, 0.0232747644f},
-std::array<float,2>{0.453985661f, 0.250853717f},
-std::array<float,2>{0.698491931f, 0.918396354f},
-std::array<float,2>{0.102504f, 0.818955779f},
-std::array<float,2>{0.768904328f, 0.433101594f},
-std::array<float,2>{0.39055407f, 0.183857784f},
-std::array<float,2>{0.629069388f, 0.631442726f},
-std::array<float,2>{0.27219221f, 0.510704041f},
-std::array<float,2>{0.569509685f, 0.0646510124f},
-std::array<float,2>{0.137664303f, 0.360043466f},
-std::array<float,2>{0.97600621f, 0.988350332f},
-std::array<float,2>{0.49837327f, 0.896443844f},
-std::array<float,2>{0.736943901f, 0.299947381f},
-std::array<float,2>{0.0464136079f, 0.0411986932f},
-std::array<float,2>{0.867990375f, 0.591894865f},
-std::array<float,2>{0.188194767f, 0.744394243f},
-std::array<float,2>{0.912942529f, 0.225865006f},
-std::array<float,2>{0.34411636f, 0.444589853f},
-std::array<float,2>{0.501695454f, 0.803038955f},
-std::array<float,2>{0.229313418f, 0.78609699f},
-std::array<float,2>{0.881812453f, 0.465729058f},
-std::array<float,2>{0.333818853f, 0.240227655f},
-std::array<float,2>{0.541061163f, 0.72121805f},
-std::array<float,2>{0.448241383f, 0.567957461f},
-std::array<float,2>{0.71299237f, 0.0594878495f},
-std::array<float,2>{0.0134477606f, 0.296401471f},
-std::array<float,2>{0.836203694f, 0.883057237f},
-std::array<float,2>{0.300586015f, 0.982131004f},
-std::array<float,2>{0.618727863f, 0.355465174f},
-std::array<float,2>{0.174286902f, 0.0847118646f},
-std::array<float,2>{0.94792068f, 0.51680094f},
-std::array<float,2>{0.0656185672f, 0.641381979f},
-std::array<float,2>{0.793803036f, 0.164561525f},
-std::array<float,2>{0.428180516f, 0.418658942f},
-std::array<float,2>{0.677218914f, 0.8396312f},
-std::array<float,2>{0.0542797409f, 0.924867988f},
-std::array<float,2>{0.856348395f, 0.267534703f},
-std::array<float,2>{0.476735741f, 0.00937618222f},
-std::array<float,2>{0.733654499f, 0.60968703f},
-std::array<float,2>{0.366185606f, 0.689438641f},
-std::array<float,2>{0.52148205f, 0.191314355f},
-std::array<float,2>{0.204973519f, 0.479155391f},
-std::array<float,2>{0.934183896f, 0.757426679f},
-std::array<float,2>{0.400693655f, 0.862020373f},
-std::array<float,2>{0.645980895f, 0.38207224f},
-std::array<float,2>{0.122143358f, 0.127869084f},
-std::array<float,2>{0.759733915f, 0.682396591f},
-std::array<float,2>{0.153081939f, 0.549600661f},
-std::array<float,2>{0.986979783f, 0.105127633f},
-std::array<float,2>{0.263593256f, 0.319333643f},
-std::array<float,2>{0.581234932f, 0.96690017f},
-std::array<float,2>{0.216161981f, 0.881086946f},
-std::array<float,2>{0.925053895f, 0.286332905f},
-std::array<float,2>{0.370899618f, 0.049875997f},
-std::array<float,2>{0.530435205f, 0.574917614f},
-std::array<float,2>{0.472008914f, 0.728233099f},
-std::array<float,2>{0.723895609f, 0.249808401f},
-std::array<float,2>{0.0617115945f, 0.456560969f},
-std::array<float,2>{0.846768558f, 0.79432863f},
-std::array<float,2>{0.253688723f, 0.83334434f},
-std::array<float,2>{0.590480089f, 0.413108915f},
-std::array<float,2>{0.146979973f, 0.156681344f},
-std::array<float,2>{0.995982766f, 0.650451362f},
-std::array<float,2>{0.109626852f, 0.526039243f},
-std::array<float,2>{0.753294826f, 0.0872514918f},
-std::array<float,2>{0.398203254f, 0.350888401f},
-std::array<float,2>{0.654129565f, 0.975766182f},
-std::array<float,2>{1.80185925e-05f, 0.760418415f},
-std::array<float,2>{0.830311775f, 0.470500201f},
-std::array<float,2>{0.440354943f, 0.200653732f},
-std::array<float,2>{0.70392257f, 0.701169074f},
-std::array<float,2>{0.338755339f, 0.618647873f},
-std::array<float,2>{0.532040775f, 0.00079395785f},
-std::array<float,2>{0.225125954f, 0.273990571f},
-std::array<float,2>{0.889110386f, 0.935258508f},
-std::array<float,2>{0.43075487f, 0.959197164f},
-std::array<float,2>{0.681248844f, 0.320600957f},
-std::array<float,2>{0.0773599148f, 0.0963427871f},
-std::array<float,2>{0.786364734f, 0.557381451f},
-std::array<float,2>{0.184152514f, 0.678094506f},
-std::array<float,2>{0.943969369f, 0.134590402f},
-std::array<float,2>{0.311204284f, 0.385992378f},
-std::array<float,2>{0.611846805f, 0.874321938f},
-std::array<float,2>{0.127588034f, 0.855962038f},
-std::array<float,2>{0.976843774f, 0.394961685f},
-std::array<float,2>{0.280940711f, 0.154707953f},
-std::array<float,2>{0.574551046f, 0.658608556f},
-std::array<float,2>{0.380809903f, 0.541941404f},
-std::array<float,2>{0.638409078f, 0.114570975f},
-std::array<float,2>{0.0957528278f, 0.328267723f},
-std::array<float,2>{0.777763188f, 0.948999763f},
-std::array<float,2>{0.356224746f, 0.91275394f},
-std::array<float,2>{0.513310552f, 0.258266181f},
-std::array<float,2>{0.201036319f, 0.0239195805f},
-std::array<float,2>{0.921690345f, 0.605856657f},
-std::array<float,2>{0.0355697498f, 0.703208148f},
-std::array<float,2>{0.859534025f, 0.208621055f},
-std::array<float,2>{0.488125473f, 0.495133042f},
-std::array<float,2>{0.743163228f, 0.768789351f},
-std::array<float,2>{0.086008206f, 0.994446754f},
-std::array<float,2>{0.801158905f, 0.368553638f},
-std::array<float,2>{0.419302702f, 0.0746104866f},
-std::array<float,2>{0.67006129f, 0.502735496f},
-std::array<float,2>{0.288328886f, 0.639261246f},
-std::array<float,2>{0.600260735f, 0.175387815f},
-std::array<float,2>{0.164649561f, 0.425354481f},
-std::array<float,2>{0.960600078f, 0.826268256f},
-std::array<float,2>{0.466073751f, 0.806461334f},
-std::array<float,2>{0.688516915f, 0.44909656f},
-std::array<float,2>{0.0169738643f, 0.230102211f},
-std::array<float,2>{0.820424676f, 0.736614823f},
-std::array<float,2>{0.244475424f, 0.581334114f},
-std::array<float,2>{0.89899087f, 0.0362075567f},
-std::array<float,2>{0.313625216f, 0.305545986f},
-std::array<float,2>{0.557652533f, 0.905697227f},
-std::array<float,2>{0.235786021f, 0.96922189f},
-std::array<float,2>{0.894665897f, 0.344869852f},
-std::array<float,2>{0.323539406f, 0.0918573737f},
-std::array<float,2>{0.548283875f, 0.530391693f},
-std::array<float,2>{0.457411349f, 0.656026006f},
-std::array<float,2>{0.699341357f, 0.163915664f},
-std::array<float,2>{0.0279185288f, 0.406544834f},
-std::array<float,2>{0.816380024f, 0.831540704f},
-std::array<float,2>{0.291737497f, 0.790123105f},
-std::array<float,2>{0.604347348f, 0.458147734f},
-std::array<float,2>{0.163001493f, 0.242297605f},
-std::array<float,2>{0.968160212f, 0.731137574f},
-std::array<float,2>{0.0796567649f, 0.572432756f},
-std::array<float,2>{0.806647897f, 0.051484663f},
-std::array<float,2>{0.408944815f, 0.282128006f},
-std::array<float,2>{0.663033247f, 0.87570411f},
-std::array<float,2>{0.0404882021f, 0.868406296f},
-std::array<float,2>{0.871798933f, 0.387233257f},
-std::array<float,2>{0.493671805f, 0.139080063f},
-std::array<float,2>{0.740895987f, 0.672003746f},
-std::array<float,2>{0.351114541f, 0.55923295f},
-std::array<float,2>{0.507618546f, 0.100621291f},
-std::array<float,2>{0.193736404f, 0.326768547f},
-std::array<float,2>{0.909883916f, 0.954380989f},
-std::array<float,2>{0.384459287f, 0.933045328f},
-std::array<float,2>{0.6282534f, 0.279703468f},
-std::array<float,2>{0.105775021f, 0.00589191495f},
-std::array<float,2>{0.772417009f, 0.624964058f},
-std::array<float,2>{0.135165796f, 0.699103415f},
-std::array<float,2>{0.97130549f, 0.199158505f},
-std::array<float,2>{0.266082168f, 0.472702533f},
-std::array<float,2>{0.564112246f, 0.762802482f},
-std::array<float,2>{0.176823735f, 0.772482574f},
-std::array<float,2>{0.951517403f, 0.497758955f},
-std::array<float,2>{0.303443044f, 0.206718326f},
-std::array<float,2>{0.623373449f, 0.709712982f},
-std::array<float,2>{0.424905568f, 0.602873206f},
-std::array<float,2>{0.67372942f, 0.0300224889f},
-std::array<float,2>{0.0682646111f, 0.264629662f},
-std::array<float,2>{0.791589439f, 0.906457245f},
-std::array<float,2>{0.329610676f, 0.952655017f},
-std::array<float,2>{0.545773387f, 0.335422307f},
-std::array<float,2>{0.231622413f, 0.112785429f},
-std::array<float,2>{0.876185f, 0.543281555f},
-std::array<float,2>{0.011051964f, 0.663186252f},
-std::array<float,2>{0.843397021f, 0.15005593f},
-std::array<float,2>{0.450434804f, 0.39285174f},
-std::array<float,2>{0.716751277f, 0.851680279f},
-std::array<float,2>{0.120497018f, 0.900605381f},
-std::array<float,2>{0.765515208f, 0.309564054f},
-std::array<float,2>{0.404339492f, 0.0319068171f},
-std::array<float,2>{0.641863704f, 0.583433747f},
-std::array<float,2>{0.261010915f, 0.741316199f},
-std::array<float,2>{0.584279954f, 0.232016504f},
-std::array<float,2>{0.148966059f, 0.450340271f},
-std::array<float,2>{0.990095139f, 0.81171906f},
-std::array<float,2>{0.481652379f, 0.820499957f},
-std::array<float,2>{0.729769886f, 0.429255784f},
-std::array<float,2>{0.048953861f, 0.179219961f},
-std::array<float,2>{0.852133274f, 0.634743333f},
-std::array<float,2>{0.209987119f, 0.506546259f},
-std::array<float,2>{0.932635963f, 0.0728134885f},
-std::array<float,2>{0.359623432f, 0.374526858f},
-std::array<float,2>{0.517668247f, 0.999498188f},
-std::array<float,2>{0.142198801f, 0.914250076f},
-std::array<float,2>{0.999983966f, 0.254289985f},
-std::array<float,2>{0.257082999f, 0.0185326189f},
-std::array<float,2>{0.589072168f, 0.59760648f},
-std::array<float,2>{0.394425064f, 0.715416908f},
-std::array<float,2>{0.64880985f, 0.213621423f},
-std::array<float,2>{0.116832703f, 0.490757197f},
-std::array<float,2>{0.757077098f, 0.776047945f},
-std::array<float,2>{0.372511923f, 0.850537896f},
-std::array<float,2>{0.525771081f, 0.405940264f},
-std::array<float,2>{0.211016893f, 0.142076716f},
-std::array<float,2>{0.925841153f, 0.669782341f},
-std::array<float,2>{0.0585291907f, 0.531370997f},
-std::array<float,2>{0.851126015f, 0.121919461f},
-std::array<float,2>{0.476305783f, 0.343059391f},
-std::array<float,2>{0.721463799f, 0.939209104f},
-std::array<float,2>{0.0712416992f, 0.797066748f},
-std::array<float,2>{0.783702433f, 0.439234316f},
-std::array<float,2>{0.434256911f, 0.219839185f},
-std::array<float,2>{0.685406089f, 0.747802198f},
-std::array<float,2>{0.308003813f, 0.58837992f},
-std::array<float,2>{0.613327086f, 0.0464848205f},
-std::array<float,2>{0.183153033f, 0.3038598f},
-std::array<float,2>{0.939298689f, 0.89226985f},
-std::array<float,2>{0.445020139f, 0.984422624f},
-std::array<float,2>{0.707416177f, 0.36457625f},
-std::array<float,2>{0.00450891117f, 0.0699554607f},
-std::array<float,2>{0.835205197f, 0.512554049f},
-std::array<float,2>{0.220292017f, 0.628759384f},
-std::array<float,2>{0.886277139f, 0.180912063f},
-std::array<float,2>{0.342809319f, 0.436852366f},
-std::array<float,2>{0.537664473f, 0.814393997f},
-std::array<float,2>{0.196957693f, 0.841973245f},
-std::array<float,2>{0.915444911f, 0.414907455f},
-std::array<float,2>{0.354401499f, 0.169909269f},
-std::array<float,2>{0.510291278f, 0.648076355f},
-std::array<float,2>{0.4903979f, 0.523080945f},
-std::array<float,2>{0.746349394f, 0.080837734f},
-std::array<float,2>{0.0350615419f, 0.357013136f},
-std::array<float,2>{0.866846681f, 0.977110326f},
-std::array<float,2>{0.274475574f, 0.888590336f},
-std::array<float,2>{0.573774278f, 0.290991932f},
-std::array<float,2>{0.132075131f, 0.0558705479f},
-std::array<float,2>{0.981761038f, 0.563599765f},
-std::array<float,2>{0.0995549783f, 0.726019561f},
-std::array<float,2>{0.7736215f, 0.235199884f},
-std::array<float,2>{0.378616601f, 0.464834332f},
-std::array<float,2>{0.635411322f, 0.782136083f},
-std::array<float,2>{0.0233127177f, 0.964068174f},
-std::array<float,2>{0.826426029f, 0.31447199f},
-std::array<float,2>{0.464464068f, 0.10681808f},
-std::array<float,2>{0.694274068f, 0.551678121f},
-std::array<float,2>{0.317476898f, 0.68636328f},
-std::array<float,2>{0.560659766f, 0.131254807f},
-std::array<float,2>{0.248881891f, 0.377568185f},
-std::array<float,2>{0.902783513f, 0.865693033f},
-std::array<float,2>{0.416352302f, 0.753414452f},
-std::array<float,2>{0.667434692f, 0.482096493f},
-std::array<float,2>{0.093505092f, 0.194089562f},
-std::array<float,2>{0.799629152f, 0.693698168f},
-std::array<float,2>{0.169129789f, 0.615818024f},
-std::array<float,2>{0.95616734f, 0.0149594033f},
-std::array<float,2>{0.282064974f, 0.271478325f},
-std::array<float,2>{0.594998121f, 0.929555416f},
-std::array<float,2>{0.14025265f, 0.991995275f},
-std::array<float,2>{0.974012434f, 0.361684293f},
-std::array<float,2>{0.270275474f, 0.0632657111f},
-std::array<float,2>{0.567750335f, 0.507891297f},
-std::array<float,2>{0.388202667f, 0.630311847f},
-std::array<float,2>{0.63193959f, 0.186865702f},
-std::array<float,2>{0.105009325f, 0.43097496f},
-std::array<float,2>{0.765653312f, 0.817439318f},
-std::array<float,2>{0.346120507f, 0.801902354f},
-std::array<float,2>{0.502524257f, 0.443108261f},
-std::array<float,2>{0.189646199f, 0.224512473f},
-std::array<float,2>{0.910822988f, 0.744094789f},
-std::array<float,2>{0.0439925715f, 0.591099262f},
-std::array<float,2>{0.87106967f, 0.0399648398f},
-std::array<float,2>{0.497642845f, 0.298711866f},
-std::array<float,2>{0.734580219f, 0.89787668f},
-std::array<float,2>{0.0830275938f, 0.844149232f},
-std::array<float,2>{0.809870183f, 0.401405662f},
-std::array<float,2>{0.411828607f, 0.145711035f},
-std::array<float,2>{0.658582687f, 0.667845011f},
-std::array<float,2>{0.29378134f, 0.535478294f},
-std::array<float,2>{0.608228445f, 0.120176874f},
-std::array<float,2>{0.159005761f, 0.339175045f},
-std::array<float,2>{0.963814735f, 0.942129791f},
-std::array<float,2>{0.456372261f, 0.921193838f},
-std::array<float,2>{0.696732163f, 0.253050596f},
-std::array<float,2>{0.0246283282f, 0.0195681565f},
-std::array<float,2>{0.817808151f, 0.597994566f},
-std::array<float,2>{0.239853337f, 0.712702632f},
-std::array<float,2>{0.893854201f, 0.216805428f},
-std::array<float,2>{0.324580073f, 0.486347914f},
-std::array<float,2>{0.551318944f, 0.777502298f},
-std::array<float,2>{0.205641806f, 0.753959298f},
-std::array<float,2>{0.93732959f, 0.477953702f},
-std::array<float,2>{0.363735288f, 0.189015821f},
-std::array<float,2>{0.521640658f, 0.691217721f},
-std::array<float,2>{0.480371058f, 0.6127671f},
-std::array<float,2>{0.732277989f, 0.0115902768f},
-std::array<float,2>{0.05234956f, 0.268527895f},
-std::array<float,2>{0.857707977f, 0.922134042f},
-std::array<float,2>{0.264947861f, 0.96651715f},
-std::array<float,2>{0.580061913f, 0.318158507f},
-std::array<float,2>{0.155328423f, 0.10181427f},
-std::array<float,2>{0.985143423f, 0.547198176f},
-std::array<float,2>{0.124246582f, 0.680759013f},
-std::array<float,2>{0.761471927f, 0.125218928f},
-std::array<float,2>{0.400387347f, 0.379158556f},
-std::array<float,2>{0.647645116f, 0.859839737f},
-std::array<float,2>{0.014802943f, 0.885593891f},
-std::array<float,2>{0.838714957f, 0.293234617f},
-std::array<float,2>{0.446763426f, 0.0610229373f},
-std::array<float,2>{0.711956799f, 0.569406807f},
-std::array<float,2>{0.334028482f, 0.719101965f},
-std::array<float,2>{0.539550722f, 0.240449309f},
-std::array<float,2>{0.227404803f, 0.468717635f},
-std::array<float,2>{0.879252017f, 0.787332058f},
-std::array<float,2>{0.427602708f, 0.837622643f},
-std::array<float,2>{0.679340184f, 0.421643287f},
-std::array<float,2>{0.0642454103f, 0.167876378f},
-std::array<float,2>{0.795372069f, 0.644123912f},
-std::array<float,2>{0.173311889f, 0.519022465f},
-std::array<float,2>{0.946351409f, 0.0836338475f},
-std::array<float,2>{0.298112661f, 0.353312433f},
-std::array<float,2>{0.620212257f, 0.983083904f},
-std::array<float,2>{0.222983062f, 0.93736279f},
-std::array<float,2>{0.888507485f, 0.277054995f},
-std::array<float,2>{0.33782205f, 0.00243742322f},
-std::array<float,2>{0.534858108f, 0.621006489f},
-std::array<float,2>{0.438501179f, 0.702020824f},
-std::array<float,2>{0.706697345f, 0.202067778f},
-std::array<float,2>{0.00211207033f, 0.472600728f},
-std::array<float,2>{0.829131663f, 0.758867204f},
-std::array<float,2>{0.30971849f, 0.872918606f},
-std::array<float,2>{0.610415936f, 0.384108663f},
-std::array<float,2>{0.185785756f, 0.134866118f},
-std::array<float,2>{0.94172591f, 0.676786482f},
-std::array<float,2>{0.0748805553f, 0.554856002f},
-std::array<float,2>{0.788268566f, 0.0946908519f},
-std::array<float,2>{0.432403237f, 0.323964745f},
-std::array<float,2>{0.682163835f, 0.958908081f},
-std::array<float,2>{0.0603565574f, 0.796701074f},
-std::array<float,2>{0.844090044f, 0.454460204f},
-std::array<float,2>{0.470072538f, 0.246231943f},
-std::array<float,2>{0.725168526f, 0.728734374f},
-std::array<float,2>{0.367921472f, 0.576756001f},
-std::array<float,2>{0.52797538f, 0.0482153632f},
-std::array<float,2>{0.21848397f, 0.287217975f},
-std::array<float,2>{0.922382355f, 0.880141437f},
-std::array<float,2>{0.395277828f, 0.974305153f},
-std::array<float,2>{0.655571222f, 0.348676562f},
-std::array<float,2>{0.11258629f, 0.0878955722f},
-std::array<float,2>{0.750605166f, 0.52400732f},
-std::array<float,2>{0.145434737f, 0.648944139f},
-std::array<float,2>{0.992343307f, 0.159025997f},
-std::array<float,2>{0.250487953f, 0.410313368f},
-std::array<float,2>{0.592542708f, 0.834196448f},
-std::array<float,2>{0.166803017f, 0.825727761f},
-std::array<float,2>{0.958947897f, 0.423168093f},
-std::array<float,2>{0.285492718f, 0.173314542f},
-std::array<float,2>{0.598288894f, 0.637914658f},
-std::array<float,2>{0.420639604f, 0.501023352f},
-std::array<float,2>{0.668003142f, 0.0763253048f},
-std::array<float,2>{0.0886543691f, 0.371037275f},
-std::array<float,2>{0.80424279f, 0.992620945f},
-std::array<float,2>{0.315922081f, 0.903158545f},
-std::array<float,2>{0.556067169f, 0.308468372f},
-std::array<float,2>{0.242767021f, 0.0384740978f},
-std::array<float,2>{0.901731014f, 0.579214156f},
-std::array<float,2>{0.0190099478f, 0.735182703f},
-std::array<float,2>{0.823351264f, 0.22730048f},
-std::array<float,2>{0.467780262f, 0.446403265f},
-std::array<float,2>{0.691204488f, 0.806727111f},
-std::array<float,2>{0.0950488374f, 0.946164012f},
-std::array<float,2>{0.781105101f, 0.331277013f},
-std::array<float,2>{0.38225317f, 0.116466038f},
-std::array<float,2>{0.639378905f, 0.540764689f},
-std::array<float,2>{0.277567357f, 0.657711625f},
-std::array<float,2>{0.57727766f, 0.154199168f},
-std::array<float,2>{0.125851065f, 0.397123307f},
-std::array<float,2>{0.978734732f, 0.858206034f},
-std::array<float,2>{0.485708863f, 0.767457187f},
-std::array<float,2>{0.745165527f, 0.492797971f},
-std::array<float,2>{0.0375730842f, 0.209147081f},
-std::array<float,2>{0.862411499f, 0.705624342f},
-std::array<float,2>{0.201261893f, 0.609189272f},
-std::array<float,2>{0.919126749f, 0.0268633533f},
-std::array<float,2>{0.359052211f, 0.260036439f},
-std::array<float,2>{0.515334725f, 0.910280824f},
-std::array<float,2>{0.192215726f, 0.955491424f},
-std::array<float,2>{0.908137202f, 0.325265795f},
-std::array<float,2>{0.349426568f, 0.0985699147f},
-std::array<float,2>{0.505717278f, 0.56132853f},
-std::array<float,2>{0.495458364f, 0.674916625f},
-std::array<float,2>{0.739343345f, 0.137612715f},
-std::array<float,2>{0.0418162122f, 0.390199423f},
-std::array<float,2>{0.874400914f, 0.869269729f},
-std::array<float,2>{0.268363088f, 0.764754713f},
-std::array<float,2>{0.566040218f, 0.476221055f},
-std::array<float,2>{0.133247226f, 0.195376709f},
-std::array<float,2>{0.969131052f, 0.695590854f},
-std::array<float,2>{0.10860341f, 0.621138513f},
-std::array<float,2>{0.771168292f, 0.003944722f},
-std::array<float,2>{0.385970265f, 0.2783086f},
-std::array<float,2>{0.625975847f, 0.930036008f},
-std::array<float,2>{0.0307035707f, 0.82967627f},
-std::array<float,2>{0.81394124f, 0.409940004f},
-std::array<float,2>{0.459246129f, 0.160629302f},
-std::array<float,2>{0.701242745f, 0.653747022f},
-std::array<float,2>{0.320388824f, 0.529134929f},
-std::array<float,2>{0.549661994f, 0.0916731134f},
-std::array<float,2>{0.237710103f, 0.345773131f},
-std::array<float,2>{0.896722078f, 0.971912146f},
-std::array<float,2>{0.40805766f, 0.878710806f},
-std::array<float,2>{0.661219299f, 0.284346372f},
-std::array<float,2>{0.081688121f, 0.0537282415f},
-std::array<float,2>{0.806592822f, 0.570951521f},
-std::array<float,2>{0.160216987f, 0.734223366f},
-std::array<float,2>{0.964909971f, 0.245618701f},
-std::array<float,2>{0.290036142f, 0.459083468f},
-std::array<float,2>{0.601925433f, 0.791408062f},
-std::array<float,2>{0.150909558f, 0.809420586f},
-std::array<float,2>{0.991487324f, 0.452173442f},
-std::array<float,2>{0.259678066f, 0.23257114f},
-std::array<float,2>{0.583233833f, 0.740143538f},
-std::array<float,2>{0.40271616f, 0.585932493f},
-std::array<float,2>{0.643933177f, 0.0332684144f},
-std::array<float,2>{0.118747979f, 0.310761601f},
-std::array<float,2>{0.763496399f, 0.899388254f},
-std::array<float,2>{0.361389637f, 0.997190237f},
-std::array<float,2>{0.517088652f, 0.371151209f},
-std::array<float,2>{0.207875699f, 0.0717250854f},
-std::array<float,2>{0.931226373f, 0.504630029f},
-std::array<float,2>{0.0471963733f, 0.636631429f},
-std::array<float,2>{0.853528261f, 0.176280528f},
-std::array<float,2>{0.48436588f, 0.42697686f},
-std::array<float,2>{0.727127969f, 0.823287547f},
-std::array<float,2>{0.0686737075f, 0.909821212f},
-std::array<float,2>{0.790001094f, 0.261877686f},
-std::array<float,2>{0.42323333f, 0.0278066527f},
-std::array<float,2>{0.674849808f, 0.604174078f},
-std::array<float,2>{0.300962299f, 0.70853442f},
-std::array<float,2>{0.621575058f, 0.203143194f},
-std::array<float,2>{0.178725824f, 0.498716354f},
-std::array<float,2>{0.949392498f, 0.770011306f},
-std::array<float,2>{0.452449471f, 0.854142368f},
-std::array<float,2>{0.717729509f, 0.3913562f},
-std::array<float,2>{0.00970369577f, 0.152315751f},
-std::array<float,2>{0.841613352f, 0.661236107f},
-std::array<float,2>{0.233547479f, 0.546873808f},
-std::array<float,2>{0.878607988f, 0.110794872f},
-std::array<float,2>{0.331774443f, 0.333423108f},
-std::array<float,2>{0.543337166f, 0.950191677f},
-std::array<float,2>{0.180986613f, 0.89358896f},
-std::array<float,2>{0.940206587f, 0.301642746f},
-std::array<float,2>{0.305808187f, 0.0448504314f},
-std::array<float,2>{0.615461588f, 0.587786138f},
-std::array<float,2>{0.435632646f, 0.749588013f},
-std::array<float,2>{0.686440945f, 0.221441671f},
-std::array<float,2>{0.0723814741f, 0.440086722f},
-std::array<float,2>{0.782764196f, 0.799192011f},
-std::array<float,2>{0.341317922f, 0.815644026f},
-std::array<float,2>{0.536886334f, 0.434979051f},
-std::array<float,2>{0.222654298f, 0.182020813f},
-std::array<float,2>{0.883485377f, 0.625819743f},
-std::array<float,2>{0.00739143789f, 0.515111566f},
-std::array<float,2>{0.83281368f, 0.0679265186f},
-std::array<float,2>{0.442336291f, 0.366704345f},
-std::array<float,2>{0.710440576f, 0.987517357f},
-std::array<float,2>{0.115054287f, 0.773760796f},
-std::array<float,2>{0.755767941f, 0.489117622f},
-std::array<float,2>{0.391541153f, 0.211623341f},
-std::array<float,2>{0.652120233f, 0.718121171f},
-std::array<float,2>{0.254588008f, 0.595447898f},
-std::array<float,2>{0.587693572f, 0.0159100369f},
-std::array<float,2>{0.143854141f, 0.256271064f},
-std::array<float,2>{0.99724263f, 0.916099787f},
-std::array<float,2>{0.474264354f, 0.941010773f},
-std::array<float,2>{0.720068991f, 0.340194792f},
-std::array<float,2>{0.0554724038f, 0.124490105f},
-std::array<float,2>{0.84808445f, 0.533380985f},
-std::array<float,2>{0.214183971f, 0.671269834f},
-std::array<float,2>{0.929198742f, 0.143131986f},
-std::array<float,2>{0.373675317f, 0.403927982f},
-std::array<float,2>{0.52533406f, 0.848215461f},
-std::array<float,2>{0.247951239f, 0.864684463f},
-std::array<float,2>{0.906106532f, 0.376110733f},
-std::array<float,2>{0.318874151f, 0.130419344f},
-std::array<float,2>{0.558600783f, 0.685504556f},
-std::array<float,2>{0.461829156f, 0.553177536f},
-std::array<float,2>{0.691676915f, 0.108963013f},
-std::array<float,2>{0.0204986706f, 0.313570112f},
-std::array<float,2>{0.824534833f, 0.961313963f},
-std::array<float,2>{0.284538299f, 0.927306414f},
-std::array<float,2>{0.596958637f, 0.273356169f},
-std::array<float,2>{0.170921504f, 0.0134518128f},
-std::array<float,2>{0.954633474f, 0.614393175f},
-std::array<float,2>{0.0911930054f, 0.692039251f},
-std::array<float,2>{0.797709286f, 0.19195424f},
-std::array<float,2>{0.414921761f, 0.483348519f},
-std::array<float,2>{0.664295256f, 0.751160681f},
-std::array<float,2>{0.0316222049f, 0.979505956f},
-std::array<float,2>{0.864672065f, 0.358911991f},
-std::array<float,2>{0.488336504f, 0.0789074525f},
-std::array<float,2>{0.748920918f, 0.520797551f},
-std::array<float,2>{0.351605326f, 0.646470904f},
-std::array<float,2>{0.508569896f, 0.170127153f},
-std::array<float,2>{0.197531506f, 0.41761604f},
-std::array<float,2>{0.917040586f, 0.840635478f},
-std::array<float,2>{0.375319123f, 0.784100831f},
-std::array<float,2>{0.634492934f, 0.462250501f},
-std::array<float,2>{0.100085691f, 0.238158658f},
-std::array<float,2>{0.77670759f, 0.723750353f},
-std::array<float,2>{0.129593059f, 0.56466496f},
-std::array<float,2>{0.983141065f, 0.0584576651f},
-std::array<float,2>{0.275576264f, 0.292066813f},
-std::array<float,2>{0.571376503f, 0.889446259f},
-std::array<float,2>{0.12538597f, 0.94827348f},
-std::array<float,2>{0.979009926f, 0.329080164f},
-std::array<float,2>{0.278104007f, 0.114936367f},
-std::array<float,2>{0.577919006f, 0.54132086f},
-std::array<float,2>{0.382463127f, 0.659087479f},
-std::array<float,2>{0.638698399f, 0.155182227f},
-std::array<float,2>{0.0953260213f, 0.395094663f},
-std::array<float,2>{0.780393958f, 0.855511785f},
-std::array<float,2>{0.358422279f, 0.76935035f},
-std::array<float,2>{0.514747143f, 0.495611846f},
-std::array<float,2>{0.201834157f, 0.208399206f},
-std::array<float,2>{0.919882655f, 0.703932762f},
-std::array<float,2>{0.0378274769f, 0.605983913f},
-std::array<float,2>{0.863170803f, 0.0241059884f},
-std::array<float,2>{0.485845387f, 0.258315086f},
-std::array<float,2>{0.745754957f, 0.912446201f},
-std::array<float,2>{0.0882660896f, 0.826677561f},
-std::array<float,2>{0.804061413f, 0.424840331f},
-std::array<float,2>{0.420095593f, 0.175217628f},
-std::array<float,2>{0.668719947f, 0.639127731f},
-std::array<float,2>{0.285723954f, 0.502317727f},
-std::array<float,2>{0.597831607f, 0.0750117898f},
-std::array<float,2>{0.16607371f, 0.368699074f},
-std::array<float,2>{0.958162427f, 0.994640529f},
-std::array<float,2>{0.468314141f, 0.905824244f},
-std::array<float,2>{0.690854371f, 0.304724634f},
-std::array<float,2>{0.0190824028f, 0.0369595475f},
-std::array<float,2>{0.824075103f, 0.581565201f},
-std::array<float,2>{0.242504314f, 0.736906767f},
-std::array<float,2>{0.902041197f, 0.229504973f},
-std::array<float,2>{0.315659523f, 0.448348463f},
-std::array<float,2>{0.556584716f, 0.805711329f},
-std::array<float,2>{0.218025759f, 0.79459393f},
-std::array<float,2>{0.922230482f, 0.456257343f},
-std::array<float,2>{0.367428035f, 0.249126583f},
-std::array<float,2>{0.527572513f, 0.727848172f},
-std::array<float,2>{0.470522165f, 0.574522555f},
-std::array<float,2>{0.724644721f, 0.0507789403f},
-std::array<float,2>{0.0598500185f, 0.286935389f},
-std::array<float,2>{0.844316244f, 0.881758332f},
-std::array<float,2>{0.250813097f, 0.976196051f},
-std::array<float,2>{0.59199661f, 0.351150364f},
-std::array<float,2>{0.14457725f, 0.0876710266f},
-std::array<float,2>{0.992976785f, 0.52564913f},
-std::array<float,2>{0.112926558f, 0.651070416f},
-std::array<float,2>{0.750110328f, 0.157210305f},
-std::array<float,2>{0.394982308f, 0.413746446f},
-std::array<float,2>{0.656179667f, 0.833875537f},
-std::array<float,2>{0.00290382863f, 0.934942126f},
-std::array<float,2>{0.829745591f, 0.273700178f},
-std::array<float,2>{0.438980848f, 0.000366396533f},
-std::array<float,2>{0.706458211f, 0.618814647f},
-std::array<float,2>{0.337051928f, 0.700202823f},
-std::array<float,2>{0.5345999f, 0.200879231f},
-std::array<float,2>{0.223208874f, 0.469831556f},
-std::array<float,2>{0.888109446f, 0.760095716f},
-std::array<float,2>{0.432021528f, 0.874520719f},
-std::array<float,2>{0.681865692f, 0.386364162f},
-std::array<float,2>{0.0744048133f, 0.134088472f},
-std::array<float,2>{0.788678706f, 0.678605258f},
-std::array<float,2>{0.186262116f, 0.557062745f},
-std::array<float,2>{0.9419505f, 0.0960439891f},
-std::array<float,2>{0.310196102f, 0.321062326f},
-std::array<float,2>{0.611055613f, 0.95988512f},
-std::array<float,2>{0.226675108f, 0.883620858f},
-std::array<float,2>{0.879511535f, 0.296383321f},
-std::array<float,2>{0.334915638f, 0.0586287715f},
-std::array<float,2>{0.539876521f, 0.567659974f},
-std::array<float,2>{0.446936339f, 0.720727682f},
-std::array<float,2>{0.712561786f, 0.23964119f},
-std::array<float,2>{0.0152160171f, 0.465248108f},
-std::array<float,2>{0.83819139f, 0.785602212f},
-std::array<float,2>{0.298352003f, 0.838879526f},
-std::array<float,2>{0.620629549f, 0.418219835f},
-std::array<float,2>{0.173595071f, 0.164161906f},
-std::array<float,2>{0.947236419f, 0.64092809f},
-std::array<float,2>{0.0635732487f, 0.517125666f},
-std::array<float,2>{0.795476019f, 0.0843675062f},
-std::array<float,2>{0.427137971f, 0.35449481f},
-std::array<float,2>{0.678815603f, 0.98180306f},
-std::array<float,2>{0.0518336557f, 0.757205606f},
-std::array<float,2>{0.85826993f, 0.478709042f},
-std::array<float,2>{0.479952455f, 0.190795749f},
-std::array<float,2>{0.731619596f, 0.688875198f},
-std::array<float,2>{0.363816947f, 0.610311091f},
-std::array<float,2>{0.522397637f, 0.00914148428f},
-std::array<float,2>{0.205090329f, 0.266776979f},
-std::array<float,2>{0.936611295f, 0.92577517f},
-std::array<float,2>{0.399781168f, 0.967377305f},
-std::array<float,2>{0.648323238f, 0.318637669f},
-std::array<float,2>{0.124608435f, 0.104673408f},
-std::array<float,2>{0.760757864f, 0.548953295f},
-std::array<float,2>{0.155889153f, 0.681905031f},
-std::array<float,2>{0.984471917f, 0.127302855f},
-std::array<float,2>{0.265187174f, 0.382420957f},
-std::array<float,2>{0.579402268f, 0.861710489f},
-std::array<float,2>{0.158317402f, 0.846447349f},
-std::array<float,2>{0.963277996f, 0.399713963f},
-std::array<float,2>{0.293247491f, 0.146589607f},
-std::array<float,2>{0.607517719f, 0.665563583f},
-std::array<float,2>{0.411544293f, 0.538874865f},
-std::array<float,2>{0.659086585f, 0.117999114f},
-std::array<float,2>{0.0837987661f, 0.336898059f},
-std::array<float,2>{0.810219228f, 0.943590522f},
-std::array<float,2>{0.324985057f, 0.918709576f},
-std::array<float,2>{0.550855577f, 0.250165313f},
-std::array<float,2>{0.239358902f, 0.0225743093f},
-std::array<float,2>{0.894290805f, 0.599780083f},
-std::array<float,2>{0.0251998678f, 0.714093029f},
-std::array<float,2>{0.818070471f, 0.216420457f},
-std::array<float,2>{0.456757009f, 0.485068679f},
-std::array<float,2>{0.696797609f, 0.780175328f},
-std::array<float,2>{0.104558676f, 0.989236951f},
-std::array<float,2>{0.766420603f, 0.359542668f},
-std::array<float,2>{0.387743622f, 0.0652017742f},
-std::array<float,2>{0.632647276f, 0.510245681f},
-std::array<float,2>{0.269932419f, 0.630909383f},
-std::array<float,2>{0.568151891f, 0.184477434f},
-std::array<float,2>{0.139654562f, 0.433220059f},
-std::array<float,2>{0.974418044f, 0.818765879f},
-std::array<float,2>{0.497253299f, 0.803382099f},
-std::array<float,2>{0.734883428f, 0.444908261f},
-std::array<float,2>{0.044870846f, 0.226358443f},
-std::array<float,2>{0.87059319f, 0.744917274f},
-std::array<float,2>{0.190135658f, 0.592411995f},
-std::array<float,2>{0.910521686f, 0.041545067f},
-std::array<float,2>{0.346307069f, 0.300448388f},
-std::array<float,2>{0.501981378f, 0.895646513f},
-std::array<float,2>{0.198010549f, 0.976905346f},
-std::array<float,2>{0.917687476f, 0.356473953f},
-std::array<float,2>{0.352306545f, 0.0804855376f},
-std::array<float,2>{0.507927835f, 0.52251035f},
-std::array<float,2>{0.489217877f, 0.64765358f},
-std::array<float,2>{0.748149514f, 0.169322446f},
-std::array<float,2>{0.0319040231f, 0.414453447f},
-std::array<float,2>{0.865222394f, 0.842641473f},
-std::array<float,2>{0.276042551f, 0.781564534f},
-std::array<float,2>{0.572181225f, 0.464291364f},
-std::array<float,2>{0.129074067f, 0.234829023f},
-std::array<float,2>{0.982496142f, 0.726146162f},
-std::array<float,2>{0.10044165f, 0.564041317f},
-std::array<float,2>{0.777260721f, 0.0562785268f},
-std::array<float,2>{0.375957787f, 0.290160507f},
-std::array<float,2>{0.634065866f, 0.888066888f},
-std::array<float,2>{0.0196739826f, 0.865932047f},
-std::array<float,2>{0.824994147f, 0.377408057f},
-std::array<float,2>{0.461046159f, 0.13151367f},
-std::array<float,2>{0.691994429f, 0.686016619f},
-std::array<float,2>{0.318365484f, 0.551067352f},
-std::array<float,2>{0.559165895f, 0.106952421f},
-std::array<float,2>{0.247386798f, 0.315215111f},
-std::array<float,2>{0.905275464f, 0.964547932f},
-std::array<float,2>{0.414239556f, 0.929059923f},
-std::array<float,2>{0.664567649f, 0.270632505f},
-std::array<float,2>{0.0914481282f, 0.015225281f},
-std::array<float,2>{0.797126889f, 0.615562975f},
-std::array<float,2>{0.171678469f, 0.694007933f},
-std::array<float,2>{0.954310417f, 0.193696737f},
-std::array<float,2>{0.284856766f, 0.481560379f},
-std::array<float,2>{0.597435415f, 0.753789663f},
-std::array<float,2>{0.144084901f, 0.775620401f},
-std::array<float,2>{0.997763574f, 0.490290016f},
-std::array<float,2>{0.254362732f, 0.212968245f},
-std::array<float,2>{0.586914897f, 0.71512264f},
-std::array<float,2>{0.390851229f, 0.596851408f},
-std::array<float,2>{0.651505053f, 0.0179073922f},
-std::array<float,2>{0.114425763f, 0.254746795f},
-std::array<float,2>{0.755162001f, 0.914652288f},
-std::array<float,2>{0.373500347f, 0.938853443f},
-std::array<float,2>{0.524476707f, 0.343446374f},
-std::array<float,2>{0.214502946f, 0.121302977f},
-std::array<float,2>{0.929438412f, 0.532156646f},
-std::array<float,2>{0.0550905876f, 0.669201434f},
-std::array<float,2>{0.848507643f, 0.142186001f},
-std::array<float,2>{0.474120677f, 0.405390322f},
-std::array<float,2>{0.720583856f, 0.849769294f},
-std::array<float,2>{0.0730720013f, 0.89203012f},
-std::array<float,2>{0.782447159f, 0.304632455f},
-std::array<float,2>{0.436506689f, 0.0459324121f},
-std::array<float,2>{0.68603164f, 0.588242888f},
-std::array<float,2>{0.306321442f, 0.747385263f},
-std::array<float,2>{0.615849555f, 0.220361426f},
-std::array<float,2>{0.181293532f, 0.43896082f},
-std::array<float,2>{0.939528763f, 0.797564685f},
-std::array<float,2>{0.44179377f, 0.813830495f},
-std::array<float,2>{0.710686982f, 0.437082857f},
-std::array<float,2>{0.00691864546f, 0.181395575f},
-std::array<float,2>{0.832105815f, 0.628136754f},
-std::array<float,2>{0.221891358f, 0.511789143f},
-std::array<float,2>{0.882943034f, 0.0697701946f},
-std::array<float,2>{0.341222286f, 0.365194261f},
-std::array<float,2>{0.536470473f, 0.985318422f},
-std::array<float,2>{0.179361135f, 0.90695554f},
-std::array<float,2>{0.949902773f, 0.263679713f},
-std::array<float,2>{0.301300317f, 0.0295647029f},
-std::array<float,2>{0.621914864f, 0.6031937f},
-std::array<float,2>{0.423512638f, 0.70922637f},
-std::array<float,2>{0.675361693f, 0.206535876f},
-std::array<float,2>{0.0689434558f, 0.497393936f},
-std::array<float,2>{0.789270937f, 0.773356378f},
-std::array<float,2>{0.331136137f, 0.852466881f},
-std::array<float,2>{0.54361552f, 0.393103749f},
-std::array<float,2>{0.234212339f, 0.14960964f},
-std::array<float,2>{0.878076375f, 0.663994908f},
-std::array<float,2>{0.00881447736f, 0.543825448f},
-std::array<float,2>{0.841275811f, 0.113005117f},
-std::array<float,2>{0.453000724f, 0.335605353f},
-std::array<float,2>{0.717131436f, 0.952173471f},
-std::array<float,2>{0.118642747f, 0.812179625f},
-std::array<float,2>{0.762877226f, 0.450972825f},
-std::array<float,2>{0.402833223f, 0.231853709f},
-std::array<float,2>{0.644508302f, 0.741723239f},
-std::array<float,2>{0.258996874f, 0.583757579f},
-std::array<float,2>{0.58366704f, 0.0316745602f},
-std::array<float,2>{0.150566041f, 0.308759212f},
-std::array<float,2>{0.991743267f, 0.901282907f},
-std::array<float,2>{0.483826548f, 0.999681056f},
-std::array<float,2>{0.726932049f, 0.374393672f},
-std::array<float,2>{0.047562398f, 0.0725381747f},
-std::array<float,2>{0.854378223f, 0.506085932f},
-std::array<float,2>{0.207503065f, 0.634041429f},
-std::array<float,2>{0.930676937f, 0.178934798f},
-std::array<float,2>{0.362290591f, 0.428816617f},
-std::array<float,2>{0.517324388f, 0.820965827f},
-std::array<float,2>{0.238027707f, 0.831581235f},
-std::array<float,2>{0.897139311f, 0.406947345f},
-std::array<float,2>{0.321078211f, 0.163369045f},
-std::array<float,2>{0.549126446f, 0.655532777f},
-std::array<float,2>{0.459647804f, 0.530914545f},
-std::array<float,2>{0.701832056f, 0.0927065983f},
-std::array<float,2>{0.0307898223f, 0.3455185f},
-std::array<float,2>{0.814038754f, 0.969620466f},
-std::array<float,2>{0.289315969f, 0.875373244f},
-std::array<float,2>{0.602469146f, 0.281398803f},
-std::array<float,2>{0.161010325f, 0.0509262159f},
-std::array<float,2>{0.965586424f, 0.572908282f},
-std::array<float,2>{0.0812194422f, 0.73047483f},
-std::array<float,2>{0.805834591f, 0.243040875f},
-std::array<float,2>{0.407498628f, 0.458734244f},
-std::array<float,2>{0.662069678f, 0.790803075f},
-std::array<float,2>{0.0413791388f, 0.955015063f},
-std::array<float,2>{0.874996662f, 0.326437652f},
-std::array<float,2>{0.495703548f, 0.101408698f},
-std::array<float,2>{0.739953876f, 0.558727026f},
-std::array<float,2>{0.348836303f, 0.672627687f},
-std::array<float,2>{0.505298257f, 0.139517397f},
-std::array<float,2>{0.191885322f, 0.386782795f},
-std::array<float,2>{0.9074651f, 0.868767917f},
-std::array<float,2>{0.386350542f, 0.763190746f},
-std::array<float,2>{0.625456989f, 0.473605931f},
-std::array<float,2>{0.109162264f, 0.198425367f},
-std::array<float,2>{0.77060318f, 0.698647261f},
-std::array<float,2>{0.133316696f, 0.624482572f},
-std::array<float,2>{0.969274521f, 0.0068235076f},
-std::array<float,2>{0.267935425f, 0.279963315f},
-std::array<float,2>{0.565436244f, 0.933350623f},
-std::array<float,2>{0.164403737f, 0.992934942f},
-std::array<float,2>{0.96021378f, 0.370294511f},
-std::array<float,2>{0.289013296f, 0.0768741667f},
-std::array<float,2>{0.599677384f, 0.501473606f},
-std::array<float,2>{0.419803768f, 0.638660848f},
-std::array<float,2>{0.670554161f, 0.173399612f},
-std::array<float,2>{0.0866254494f, 0.423519492f},
-std::array<float,2>{0.801452875f, 0.825379074f},
-std::array<float,2>{0.313967049f, 0.807270706f},
-std::array<float,2>{0.558336377f, 0.447062701f},
-std::array<float,2>{0.245005816f, 0.226623505f},
-std::array<float,2>{0.898829579f, 0.734708607f},
-std::array<float,2>{0.0175474323f, 0.579659522f},
-std::array<float,2>{0.820996344f, 0.0388506688f},
-std::array<float,2>{0.466652572f, 0.308017433f},
-std::array<float,2>{0.68941927f, 0.902750909f},
-std::array<float,2>{0.0965806171f, 0.857833445f},
-std::array<float,2>{0.778201818f, 0.396680862f},
-std::array<float,2>{0.379955143f, 0.153352499f},
-std::array<float,2>{0.637727141f, 0.657963157f},
-std::array<float,2>{0.28062582f, 0.540340483f},
-std::array<float,2>{0.574872077f, 0.11689508f},
-std::array<float,2>{0.127353713f, 0.331992865f},
-std::array<float,2>{0.977374494f, 0.94539243f},
-std::array<float,2>{0.487524152f, 0.910837233f},
-std::array<float,2>{0.742400825f, 0.260568678f},
-std::array<float,2>{0.035896346f, 0.0264467113f},
-std::array<float,2>{0.860209405f, 0.608729601f},
-std::array<float,2>{0.200370207f, 0.705100894f},
-std::array<float,2>{0.921045125f, 0.209958345f},
-std::array<float,2>{0.355730623f, 0.492210835f},
-std::array<float,2>{0.512960076f, 0.767044246f},
-std::array<float,2>{0.224669725f, 0.759316564f},
-std::array<float,2>{0.889643848f, 0.471877724f},
-std::array<float,2>{0.338312894f, 0.201259911f},
-std::array<float,2>{0.531386256f, 0.701499045f},
-std::array<float,2>{0.43950808f, 0.620117486f},
-std::array<float,2>{0.703229785f, 0.00282290415f},
-std::array<float,2>{0.000602175482f, 0.276803046f},
-std::array<float,2>{0.830959916f, 0.936795235f},
-std::array<float,2>{0.31056726f, 0.958268225f},
-std::array<float,2>{0.611447811f, 0.323399931f},
-std::array<float,2>{0.183757067f, 0.0942200795f},
-std::array<float,2>{0.943377614f, 0.555642426f},
-std::array<float,2>{0.0780883208f, 0.677449167f},
-std::array<float,2>{0.786950886f, 0.135663569f},
-std::array<float,2>{0.431556106f, 0.384465188f},
-std::array<float,2>{0.681063056f, 0.87218523f},
-std::array<float,2>{0.0624215528f, 0.880549133f},
-std::array<float,2>{0.847288311f, 0.287920147f},
-std::array<float,2>{0.472484767f, 0.0484849811f},
-std::array<float,2>{0.724497199f, 0.576364338f},
-std::array<float,2>{0.370454401f, 0.729204535f},
-std::array<float,2>{0.53089577f, 0.247028157f},
-std::array<float,2>{0.216479167f, 0.454805106f},
-std::array<float,2>{0.925780058f, 0.796240389f},
-std::array<float,2>{0.397873312f, 0.834724784f},
-std::array<float,2>{0.653753221f, 0.41090104f},
-std::array<float,2>{0.110198021f, 0.158606127f},
-std::array<float,2>{0.753670573f, 0.648711503f},
-std::array<float,2>{0.146929637f, 0.523554325f},
-std::array<float,2>{0.995384216f, 0.0884985328f},
-std::array<float,2>{0.253294051f, 0.349167079f},
-std::array<float,2>{0.589895904f, 0.973915696f},
-std::array<float,2>{0.204339385f, 0.922553539f},
-std::array<float,2>{0.933857799f, 0.267651945f},
-std::array<float,2>{0.365320623f, 0.0110848136f},
-std::array<float,2>{0.520743787f, 0.613270164f},
-std::array<float,2>{0.477444798f, 0.690744758f},
-std::array<float,2>{0.734155893f, 0.188957527f},
-std::array<float,2>{0.0538579263f, 0.47810322f},
-std::array<float,2>{0.855630279f, 0.754795432f},
-std::array<float,2>{0.262708515f, 0.860159278f},
-std::array<float,2>{0.581988633f, 0.379664928f},
-std::array<float,2>{0.15245986f, 0.125874296f},
-std::array<float,2>{0.98650676f, 0.681549966f},
-std::array<float,2>{0.123012565f, 0.547795117f},
-std::array<float,2>{0.759061754f, 0.102206409f},
-std::array<float,2>{0.40128836f, 0.31773451f},
-std::array<float,2>{0.646001875f, 0.966240823f},
-std::array<float,2>{0.0128588434f, 0.788063943f},
-std::array<float,2>{0.836597681f, 0.468073189f},
-std::array<float,2>{0.447566658f, 0.240978509f},
-std::array<float,2>{0.713819265f, 0.719526291f},
-std::array<float,2>{0.333396226f, 0.569915652f},
-std::array<float,2>{0.541544378f, 0.0614463575f},
-std::array<float,2>{0.228932887f, 0.293798089f},
-std::array<float,2>{0.880865335f, 0.885131717f},
-std::array<float,2>{0.428689122f, 0.982597947f},
-std::array<float,2>{0.677454174f, 0.352540672f},
-std::array<float,2>{0.0660157129f, 0.0831058323f},
-std::array<float,2>{0.79319638f, 0.519405723f},
-std::array<float,2>{0.174562052f, 0.643555284f},
-std::array<float,2>{0.947633207f, 0.167405337f},
-std::array<float,2>{0.300214142f, 0.421119124f},
-std::array<float,2>{0.618446767f, 0.837103963f},
-std::array<float,2>{0.13677375f, 0.818224549f},
-std::array<float,2>{0.976232529f, 0.431348532f},
-std::array<float,2>{0.271695912f, 0.187252894f},
-std::array<float,2>{0.570269942f, 0.630509853f},
-std::array<float,2>{0.390080988f, 0.508719087f},
-std::array<float,2>{0.629853547f, 0.0627563223f},
-std::array<float,2>{0.101797089f, 0.361982077f},
-std::array<float,2>{0.769369602f, 0.99151665f},
-std::array<float,2>{0.344580442f, 0.898127735f},
-std::array<float,2>{0.500980496f, 0.298328787f},
-std::array<float,2>{0.187691703f, 0.0390958972f},
-std::array<float,2>{0.912400782f, 0.591402888f},
-std::array<float,2>{0.0460090451f, 0.743290067f},
-std::array<float,2>{0.867583454f, 0.223646313f},
-std::array<float,2>{0.49864468f, 0.442612588f},
-std::array<float,2>{0.736748517f, 0.802649677f},
-std::array<float,2>{0.0850821808f, 0.941441357f},
-std::array<float,2>{0.811501265f, 0.339800745f},
-std::array<float,2>{0.413103789f, 0.120722502f},
-std::array<float,2>{0.656405747f, 0.53587383f},
-std::array<float,2>{0.296606481f, 0.667401135f},
-std::array<float,2>{0.607160687f, 0.146449924f},
-std::array<float,2>{0.157029495f, 0.401964903f},
-std::array<float,2>{0.962509513f, 0.84432894f},
-std::array<float,2>{0.453169823f, 0.777857184f},
-std::array<float,2>{0.699110866f, 0.486946046f},
-std::array<float,2>{0.0265013278f, 0.217495099f},
-std::array<float,2>{0.819139361f, 0.71197933f},
-std::array<float,2>{0.241824955f, 0.598577023f},
-std::array<float,2>{0.892011285f, 0.0201743301f},
-std::array<float,2>{0.327546299f, 0.253703654f},
-std::array<float,2>{0.553383887f, 0.921392977f},
-std::array<float,2>{0.248207033f, 0.961455226f},
-std::array<float,2>{0.903033257f, 0.314270735f},
-std::array<float,2>{0.318310201f, 0.108810075f},
-std::array<float,2>{0.561506033f, 0.553236723f},
-std::array<float,2>{0.464139104f, 0.684945643f},
-std::array<float,2>{0.693684638f, 0.130315453f},
-std::array<float,2>{0.0229478832f, 0.376482546f},
-std::array<float,2>{0.827138722f, 0.865097582f},
-std::array<float,2>{0.281679153f, 0.751663327f},
-std::array<float,2>{0.595281124f, 0.48257336f},
-std::array<float,2>{0.169608727f, 0.19142361f},
-std::array<float,2>{0.956658304f, 0.691848934f},
-std::array<float,2>{0.0929860771f, 0.614980221f},
-std::array<float,2>{0.798931599f, 0.0127376663f},
-std::array<float,2>{0.416911215f, 0.272588342f},
-std::array<float,2>{0.667628884f, 0.92715174f},
-std::array<float,2>{0.0345425457f, 0.840158701f},
-std::array<float,2>{0.866565764f, 0.417074502f},
-std::array<float,2>{0.490959048f, 0.170479968f},
-std::array<float,2>{0.746921837f, 0.645614505f},
-std::array<float,2>{0.353563935f, 0.521295428f},
-std::array<float,2>{0.510024488f, 0.0782729015f},
-std::array<float,2>{0.196514636f, 0.358633965f},
-std::array<float,2>{0.915654123f, 0.980078995f},
-std::array<float,2>{0.378203481f, 0.889089227f},
-std::array<float,2>{0.635032356f, 0.292697281f},
-std::array<float,2>{0.09900143f, 0.0578656867f},
-std::array<float,2>{0.774200916f, 0.565092921f},
-std::array<float,2>{0.132528856f, 0.724604845f},
-std::array<float,2>{0.982001424f, 0.237584472f},
-std::array<float,2>{0.275018454f, 0.462873578f},
-std::array<float,2>{0.573298872f, 0.783229113f},
-std::array<float,2>{0.182622239f, 0.799507737f},
-std::array<float,2>{0.938510478f, 0.439668834f},
-std::array<float,2>{0.308134675f, 0.220964938f},
-std::array<float,2>{0.613915682f, 0.749072194f},
-std::array<float,2>{0.433913201f, 0.587025166f},
-std::array<float,2>{0.684889317f, 0.0443115495f},
-std::array<float,2>{0.0706255063f, 0.300786316f},
-std::array<float,2>{0.783452213f, 0.894388378f},
-std::array<float,2>{0.34356764f, 0.98816371f},
-std::array<float,2>{0.537399709f, 0.366402149f},
-std::array<float,2>{0.220184684f, 0.0676909611f},
-std::array<float,2>{0.886116683f, 0.515432477f},
-std::array<float,2>{0.00438354397f, 0.625116825f},
-std::array<float,2>{0.835788608f, 0.18259348f},
-std::array<float,2>{0.444416344f, 0.435239106f},
-std::array<float,2>{0.707837701f, 0.816386104f},
-std::array<float,2>{0.116370194f, 0.916891694f},
-std::array<float,2>{0.757749379f, 0.256551743f},
-std::array<float,2>{0.394004822f, 0.016503375f},
-std::array<float,2>{0.649308443f, 0.595047057f},
-std::array<float,2>{0.257748723f, 0.718279421f},
-std::array<float,2>{0.589583635f, 0.211329192f},
-std::array<float,2>{0.14200075f, 0.488509923f},
-std::array<float,2>{0.99917984f, 0.774192214f},
-std::array<float,2>{0.475667506f, 0.847943187f},
-std::array<float,2>{0.721108973f, 0.403361797f},
-std::array<float,2>{0.0579954349f, 0.143025413f},
-std::array<float,2>{0.850788713f, 0.671528935f},
-std::array<float,2>{0.211665794f, 0.533803761f},
-std::array<float,2>{0.926669359f, 0.124643721f},
-std::array<float,2>{0.372740924f, 0.340545386f},
-std::array<float,2>{0.526227057f, 0.940757811f},
-std::array<float,2>{0.148772061f, 0.89875108f},
-std::array<float,2>{0.989451408f, 0.311484128f},
-std::array<float,2>{0.261435926f, 0.0339895189f},
-std::array<float,2>{0.584556997f, 0.585362792f},
-std::array<float,2>{0.404815495f, 0.739542127f},
-std::array<float,2>{0.642347574f, 0.233392432f},
-std::array<float,2>{0.120629326f, 0.452753723f},
-std::array<float,2>{0.765093803f, 0.808994412f},
-std::array<float,2>{0.359903485f, 0.823838949f},
-std::array<float,2>{0.518096209f, 0.427510947f},
-std::array<float,2>{0.210818499f, 0.175794616f},
-std::array<float,2>{0.933466136f, 0.635990679f},
-std::array<float,2>{0.0495972969f, 0.504149258f},
-std::array<float,2>{0.851730227f, 0.0721720234f},
-std::array<float,2>{0.48219797f, 0.371837258f},
-std::array<float,2>{0.730320871f, 0.997605503f},
-std::array<float,2>{0.0676848218f, 0.77041775f},
-std::array<float,2>{0.791355312f, 0.498466104f},
-std::array<float,2>{0.425584257f, 0.203681365f},
-std::array<float,2>{0.673312783f, 0.708391011f},
-std::array<float,2>{0.302967578f, 0.603550494f},
-std::array<float,2>{0.623670936f, 0.0282260776f},
-std::array<float,2>{0.177293792f, 0.262497723f},
-std::array<float,2>{0.952121079f, 0.90939343f},
-std::array<float,2>{0.45097357f, 0.949538648f},
-std::array<float,2>{0.716271102f, 0.333872437f},
-std::array<float,2>{0.0113498559f, 0.111278199f},
-std::array<float,2>{0.843078673f, 0.546296299f},
-std::array<float,2>{0.232083872f, 0.662029803f},
-std::array<float,2>{0.876715899f, 0.1515425f},
-std::array<float,2>{0.329134822f, 0.390668541f},
-std::array<float,2>{0.544949174f, 0.853658736f},
-std::array<float,2>{0.194093317f, 0.869716227f},
-std::array<float,2>{0.909433961f, 0.390051395f},
-std::array<float,2>{0.350910574f, 0.136809036f},
-std::array<float,2>{0.507302761f, 0.675376892f},
-std::array<float,2>{0.493531972f, 0.560567141f},
-std::array<float,2>{0.740664542f, 0.0980857834f},
-std::array<float,2>{0.040643543f, 0.325768948f},
-std::array<float,2>{0.871468186f, 0.955866694f},
-std::array<float,2>{0.266320527f, 0.930354476f},
-std::array<float,2>{0.563752651f, 0.277460545f},
-std::array<float,2>{0.135351792f, 0.00446990831f},
-std::array<float,2>{0.970995307f, 0.621740282f},
-std::array<float,2>{0.106290199f, 0.696150184f},
-std::array<float,2>{0.771778166f, 0.196120024f},
-std::array<float,2>{0.383877397f, 0.475977153f},
-std::array<float,2>{0.628885686f, 0.765444338f},
-std::array<float,2>{0.0277042147f, 0.972449958f},
-std::array<float,2>{0.815844059f, 0.346310794f},
-std::array<float,2>{0.457807004f, 0.0910266116f},
-std::array<float,2>{0.700097263f, 0.52878958f},
-std::array<float,2>{0.324024141f, 0.654127955f},
-std::array<float,2>{0.548360288f, 0.160822451f},
-std::array<float,2>{0.235916987f, 0.409447789f},
-std::array<float,2>{0.89540863f, 0.82918191f},
-std::array<float,2>{0.408347994f, 0.791840374f},
-std::array<float,2>{0.662564933f, 0.459610075f},
-std::array<float,2>{0.0791113824f, 0.245371044f},
-std::array<float,2>{0.807515442f, 0.733832121f},
-std::array<float,2>{0.162469476f, 0.570345879f},
-std::array<float,2>{0.968465507f, 0.0542795099f},
-std::array<float,2>{0.291403323f, 0.285009325f},
-std::array<float,2>{0.603622139f, 0.878060222f},
-std::array<float,2>{0.185001671f, 0.960399747f},
-std::array<float,2>{0.945062935f, 0.321517587f},
-std::array<float,2>{0.311869144f, 0.0972612575f},
-std::array<float,2>{0.613057494f, 0.558574617f},
-std::array<float,2>{0.430594534f, 0.67932874f},
-std::array<float,2>{0.68043381f, 0.13292259f},
-std::array<float,2>{0.0764227435f, 0.385489494f},
-std::array<float,2>{0.785250008f, 0.873480797f},
-std::array<float,2>{0.339111149f, 0.761327565f},
-std::array<float,2>{0.532688141f, 0.46880281f},
-std::array<float,2>{0.22560887f, 0.199954793f},
-std::array<float,2>{0.89033401f, 0.699866891f},
-std::array<float,2>{0.00190247281f, 0.618157804f},
-std::array<float,2>{0.831088126f, 0.00190854876f},
-std::array<float,2>{0.440831125f, 0.274654239f},
-std::array<float,2>{0.704264164f, 0.933845997f},
-std::array<float,2>{0.1110131f, 0.832370341f},
-std::array<float,2>{0.752054811f, 0.412781447f},
-std::array<float,2>{0.396678299f, 0.157301441f},
-std::array<float,2>{0.652888954f, 0.651423931f},
-std::array<float,2>{0.252768368f, 0.527144015f},
-std::array<float,2>{0.591155052f, 0.0865217f},
-std::array<float,2>{0.148394823f, 0.349972218f},
-std::array<float,2>{0.994281828f, 0.975026727f},
-std::array<float,2>{0.471273333f, 0.882486343f},
-std::array<float,2>{0.723361552f, 0.285538375f},
-std::array<float,2>{0.0607608333f, 0.0493015908f},
-std::array<float,2>{0.84645474f, 0.576027095f},
-std::array<float,2>{0.215527624f, 0.727339625f},
-std::array<float,2>{0.924647927f, 0.248552069f},
-std::array<float,2>{0.369197339f, 0.455838442f},
-std::array<float,2>{0.530185223f, 0.793586969f},
-std::array<float,2>{0.245344758f, 0.804990172f},
-std::array<float,2>{0.899966598f, 0.447687119f},
-std::array<float,2>{0.312534124f, 0.229012087f},
-std::array<float,2>{0.557076693f, 0.737679899f},
-std::array<float,2>{0.465312034f, 0.580582738f},
-std::array<float,2>{0.687927544f, 0.0354025438f},
-std::array<float,2>{0.0160900671f, 0.305808574f},
-std::array<float,2>{0.821581662f, 0.905122101f},
-std::array<float,2>{0.287543297f, 0.995845318f},
-std::array<float,2>{0.600755036f, 0.36751917f},
-std::array<float,2>{0.16504468f, 0.0758361518f},
-std::array<float,2>{0.959449649f, 0.502977073f},
-std::array<float,2>{0.0875742286f, 0.640218377f},
-std::array<float,2>{0.802482128f, 0.174634412f},
-std::array<float,2>{0.418900043f, 0.424516112f},
-std::array<float,2>{0.671014905f, 0.82745558f},
-std::array<float,2>{0.0363549702f, 0.913239956f},
-std::array<float,2>{0.860593736f, 0.259151906f},
-std::array<float,2>{0.486329108f, 0.0245728958f},
-std::array<float,2>{0.743382931f, 0.607388377f},
-std::array<float,2>{0.356503636f, 0.704453945f},
-std::array<float,2>{0.512624204f, 0.207483679f},
-std::array<float,2>{0.200126022f, 0.494709522f},
-std::array<float,2>{0.920732141f, 0.768010795f},
-std::array<float,2>{0.379636049f, 0.856533766f},
-std::array<float,2>{0.637147784f, 0.39614889f},
-std::array<float,2>{0.097536318f, 0.155841321f},
-std::array<float,2>{0.778337598f, 0.65993607f},
-std::array<float,2>{0.128348693f, 0.542133451f},
-std::array<float,2>{0.978114843f, 0.11398185f},
-std::array<float,2>{0.279747665f, 0.329135746f},
-std::array<float,2>{0.575676858f, 0.948207676f},
-std::array<float,2>{0.189396903f, 0.895483017f},
-std::array<float,2>{0.913731456f, 0.299058855f},
-std::array<float,2>{0.345072448f, 0.0421454012f},
-std::array<float,2>{0.500972092f, 0.593544722f},
-std::array<float,2>{0.499475509f, 0.745427489f},
-std::array<float,2>{0.738228798f, 0.2253571f},
-std::array<float,2>{0.0451097116f, 0.443929285f},
-std::array<float,2>{0.868544757f, 0.804503679f},
-std::array<float,2>{0.273211062f, 0.81946218f},
-std::array<float,2>{0.568475127f, 0.431964785f},
-std::array<float,2>{0.138610139f, 0.185002699f},
-std::array<float,2>{0.975007236f, 0.632130206f},
-std::array<float,2>{0.103018478f, 0.511711597f},
-std::array<float,2>{0.768110991f, 0.0654967278f},
-std::array<float,2>{0.388764858f, 0.360712379f},
-std::array<float,2>{0.630221248f, 0.990030825f},
-std::array<float,2>{0.0259242281f, 0.780762374f},
-std::array<float,2>{0.81982553f, 0.486046016f},
-std::array<float,2>{0.454737484f, 0.214991212f},
-std::array<float,2>{0.698061526f, 0.713598073f},
-std::array<float,2>{0.326601386f, 0.601264775f},
-std::array<float,2>{0.553806722f, 0.0217656642f},
-std::array<float,2>{0.240512043f, 0.251175553f},
-std::array<float,2>{0.890671313f, 0.919227779f},
-std::array<float,2>{0.412718028f, 0.945228577f},
-std::array<float,2>{0.658039689f, 0.337464422f},
-std::array<float,2>{0.084090203f, 0.118376479f},
-std::array<float,2>{0.812170804f, 0.537122846f},
-std::array<float,2>{0.157748178f, 0.664234757f},
-std::array<float,2>{0.961885631f, 0.147591934f},
-std::array<float,2>{0.295370638f, 0.399350733f},
-std::array<float,2>{0.605560482f, 0.84759903f},
-std::array<float,2>{0.153617486f, 0.86327821f},
-std::array<float,2>{0.98764658f, 0.381560177f},
-std::array<float,2>{0.261945784f, 0.128041059f},
-std::array<float,2>{0.580681682f, 0.683066189f},
-std::array<float,2>{0.401624084f, 0.550416052f},
-std::array<float,2>{0.645020127f, 0.104158059f},
-std::array<float,2>{0.121688016f, 0.31951791f},
-std::array<float,2>{0.758582234f, 0.968161404f},
-std::array<float,2>{0.367107123f, 0.924623132f},
-std::array<float,2>{0.520093203f, 0.266325265f},
-std::array<float,2>{0.203248844f, 0.00871309917f},
-std::array<float,2>{0.934998512f, 0.611235082f},
-std::array<float,2>{0.0533941388f, 0.688123286f},
-std::array<float,2>{0.857273042f, 0.189893588f},
-std::array<float,2>{0.47797215f, 0.480356246f},
-std::array<float,2>{0.733278215f, 0.756082177f},
-std::array<float,2>{0.0652406141f, 0.981432021f},
-std::array<float,2>{0.794055581f, 0.354376256f},
-std::array<float,2>{0.429439962f, 0.0850150883f},
-std::array<float,2>{0.67601794f, 0.515812218f},
-std::array<float,2>{0.299369067f, 0.642411053f},
-std::array<float,2>{0.617523313f, 0.165998787f},
-std::array<float,2>{0.175417185f, 0.419480056f},
-std::array<float,2>{0.949044168f, 0.838500202f},
-std::array<float,2>{0.448976427f, 0.786927521f},
-std::array<float,2>{0.714417994f, 0.466099262f},
-std::array<float,2>{0.0120162535f, 0.238699034f},
-std::array<float,2>{0.837864876f, 0.721904993f},
-std::array<float,2>{0.229978278f, 0.566850603f},
-std::array<float,2>{0.882085919f, 0.0596454479f},
-std::array<float,2>{0.332751632f, 0.295148045f},
-std::array<float,2>{0.542247176f, 0.884192765f},
-std::array<float,2>{0.219043568f, 0.985808253f},
-std::array<float,2>{0.885436296f, 0.3640365f},
-std::array<float,2>{0.342198163f, 0.0692873597f},
-std::array<float,2>{0.538873911f, 0.512882411f},
-std::array<float,2>{0.443896115f, 0.627876878f},
-std::array<float,2>{0.708775818f, 0.179855436f},
-std::array<float,2>{0.00537498668f, 0.436017722f},
-std::array<float,2>{0.83491993f, 0.812719166f},
-std::array<float,2>{0.307448238f, 0.798700511f},
-std::array<float,2>{0.614623487f, 0.437814832f},
-std::array<float,2>{0.182123542f, 0.219699204f},
-std::array<float,2>{0.937865198f, 0.747018456f},
-std::array<float,2>{0.0720152929f, 0.58946228f},
-std::array<float,2>{0.784399509f, 0.0454716347f},
-std::array<float,2>{0.43525809f, 0.303645462f},
-std::array<float,2>{0.683701754f, 0.891528368f},
-std::array<float,2>{0.056656532f, 0.851457655f},
-std::array<float,2>{0.850509048f, 0.405169547f},
-std::array<float,2>{0.474851131f, 0.141413659f},
-std::array<float,2>{0.721852541f, 0.668090105f},
-std::array<float,2>{0.371855706f, 0.532652617f},
-std::array<float,2>{0.526781917f, 0.122990653f},
-std::array<float,2>{0.212487817f, 0.341819435f},
-std::array<float,2>{0.927570164f, 0.938183725f},
-std::array<float,2>{0.393196434f, 0.915366054f},
-std::array<float,2>{0.649569154f, 0.255705625f},
-std::array<float,2>{0.116163589f, 0.0188136026f},
-std::array<float,2>{0.756822705f, 0.595941842f},
-std::array<float,2>{0.141083032f, 0.716762781f},
-std::array<float,2>{0.998495042f, 0.214500234f},
-std::array<float,2>{0.256569803f, 0.491385907f},
-std::array<float,2>{0.58814162f, 0.777309f},
-std::array<float,2>{0.168913841f, 0.75223875f},
-std::array<float,2>{0.955230892f, 0.481256127f},
-std::array<float,2>{0.283105165f, 0.195071533f},
-std::array<float,2>{0.594319224f, 0.694716215f},
-std::array<float,2>{0.4171471f, 0.616280854f},
-std::array<float,2>{0.66607666f, 0.0145594599f},
-std::array<float,2>{0.0922579244f, 0.270153373f},
-std::array<float,2>{0.799984157f, 0.927763522f},
-std::array<float,2>{0.316947162f, 0.962902546f},
-std::array<float,2>{0.561688066f, 0.315545231f},
-std::array<float,2>{0.249093622f, 0.105912209f},
-std::array<float,2>{0.903828859f, 0.551832318f},
-std::array<float,2>{0.0215665158f, 0.686652482f},
-std::array<float,2>{0.827210724f, 0.132553458f},
-std::array<float,2>{0.46347937f, 0.378540903f},
-std::array<float,2>{0.695039868f, 0.867162049f},
-std::array<float,2>{0.098066546f, 0.88752991f},
-std::array<float,2>{0.774537504f, 0.289532274f},
-std::array<float,2>{0.37790823f, 0.0556422323f},
-std::array<float,2>{0.636555851f, 0.563420236f},
-std::array<float,2>{0.274304956f, 0.724903703f},
-std::array<float,2>{0.572639108f, 0.235771865f},
-std::array<float,2>{0.131130159f, 0.463600725f},
-std::array<float,2>{0.981417537f, 0.782776892f},
-std::array<float,2>{0.491513312f, 0.842881441f},
-std::array<float,2>{0.747089207f, 0.415929258f},
-std::array<float,2>{0.033233881f, 0.168097064f},
-std::array<float,2>{0.865454972f, 0.646697462f},
-std::array<float,2>{0.195934862f, 0.522240102f},
-std::array<float,2>{0.91456145f, 0.0814433917f},
-std::array<float,2>{0.35483259f, 0.356371373f},
-std::array<float,2>{0.510754108f, 0.97827822f},
-std::array<float,2>{0.136675835f, 0.932134211f},
-std::array<float,2>{0.972496092f, 0.280930102f},
-std::array<float,2>{0.266649574f, 0.00727323955f},
-std::array<float,2>{0.562740207f, 0.623057008f},
-std::array<float,2>{0.383254588f, 0.697611988f},
-std::array<float,2>{0.627606332f, 0.198016733f},
-std::array<float,2>{0.106944785f, 0.474207431f},
-std::array<float,2>{0.77295053f, 0.762007713f},
-std::array<float,2>{0.350573301f, 0.868070602f},
-std::array<float,2>{0.505879521f, 0.388553739f},
-std::array<float,2>{0.194996238f, 0.140384749f},
-std::array<float,2>{0.908278644f, 0.673070908f},
-std::array<float,2>{0.0395348333f, 0.559650302f},
-std::array<float,2>{0.872186065f, 0.100081772f},
-std::array<float,2>{0.493163705f, 0.327877641f},
-std::array<float,2>{0.741687417f, 0.953610122f},
-std::array<float,2>{0.0786773935f, 0.789756656f},
-std::array<float,2>{0.808500946f, 0.457273781f},
-std::array<float,2>{0.409299642f, 0.243619278f},
-std::array<float,2>{0.663123012f, 0.732019782f},
-std::array<float,2>{0.292410195f, 0.574182451f},
-std::array<float,2>{0.604700983f, 0.0519359373f},
-std::array<float,2>{0.163797721f, 0.282498747f},
-std::array<float,2>{0.967145383f, 0.876690328f},
-std::array<float,2>{0.458837628f, 0.970013022f},
-std::array<float,2>{0.70036763f, 0.343846828f},
-std::array<float,2>{0.028707182f, 0.0936399773f},
-std::array<float,2>{0.814543545f, 0.529642522f},
-std::array<float,2>{0.234705999f, 0.654524982f},
-std::array<float,2>{0.895766318f, 0.162204102f},
-std::array<float,2>{0.322884053f, 0.407456756f},
-std::array<float,2>{0.547007322f, 0.830516756f},
-std::array<float,2>{0.209820837f, 0.822099268f},
-std::array<float,2>{0.931726635f, 0.42824775f},
-std::array<float,2>{0.36107567f, 0.178514659f},
-std::array<float,2>{0.519514978f, 0.633099377f},
-std::array<float,2>{0.481178224f, 0.506875575f},
-std::array<float,2>{0.728611112f, 0.0732776374f},
-std::array<float,2>{0.0501276851f, 0.37395981f},
-std::array<float,2>{0.852916956f, 0.998643517f},
-std::array<float,2>{0.259939581f, 0.901815176f},
-std::array<float,2>{0.585480034f, 0.309615135f},
-std::array<float,2>{0.150148496f, 0.0327735543f},
-std::array<float,2>{0.989102006f, 0.582454264f},
-std::array<float,2>{0.119844437f, 0.74099791f},
-std::array<float,2>{0.764074564f, 0.231386274f},
-std::array<float,2>{0.405699044f, 0.449516952f},
-std::array<float,2>{0.640941322f, 0.811311126f},
-std::array<float,2>{0.0100991325f, 0.951913774f},
-std::array<float,2>{0.84255749f, 0.334184945f},
-std::array<float,2>{0.449255526f, 0.11168775f},
-std::array<float,2>{0.715140462f, 0.544762135f},
-std::array<float,2>{0.3284024f, 0.662461996f},
-std::array<float,2>{0.546841979f, 0.148939207f},
-std::array<float,2>{0.230929673f, 0.393868268f},
-std::array<float,2>{0.875534594f, 0.853298366f},
-std::array<float,2>{0.423846632f, 0.771504879f},
-std::array<float,2>{0.672548294f, 0.496678829f},
-std::array<float,2>{0.0671870112f, 0.205975324f},
-std::array<float,2>{0.792345881f, 0.710483611f},
-std::array<float,2>{0.176230773f, 0.601879537f},
-std::array<float,2>{0.952151716f, 0.030969454f},
-std::array<float,2>{0.304142922f, 0.264845997f},
-std::array<float,2>{0.624802411f, 0.907512009f},
-std::array<float,2>{0.146405339f, 0.972878993f},
-std::array<float,2>{0.99390161f, 0.347762853f},
-std::array<float,2>{0.251592189f, 0.0892148539f},
-std::array<float,2>{0.593480289f, 0.525218189f},
-std::array<float,2>{0.39647311f, 0.64994812f},
-std::array<float,2>{0.655058205f, 0.159748927f},
-std::array<float,2>{0.111908868f, 0.412036568f},
-std::array<float,2>{0.751507282f, 0.835289836f},
-std::array<float,2>{0.368250787f, 0.794976056f},
-std::array<float,2>{0.528584361f, 0.45392859f},
-std::array<float,2>{0.217216715f, 0.247504711f},
-std::array<float,2>{0.923499405f, 0.729808271f},
-std::array<float,2>{0.0595632866f, 0.577465594f},
-std::array<float,2>{0.845210254f, 0.0471037142f},
-std::array<float,2>{0.469337553f, 0.288457513f},
-std::array<float,2>{0.725600958f, 0.879303217f},
-std::array<float,2>{0.0755046532f, 0.872059822f},
-std::array<float,2>{0.787258804f, 0.383301616f},
-std::array<float,2>{0.432894528f, 0.136319667f},
-std::array<float,2>{0.68311739f, 0.675970554f},
-std::array<float,2>{0.309248209f, 0.555782914f},
-std::array<float,2>{0.609635174f, 0.0952283815f},
-std::array<float,2>{0.186680228f, 0.322439313f},
-std::array<float,2>{0.942679822f, 0.95748812f},
-std::array<float,2>{0.438162863f, 0.936128259f},
-std::array<float,2>{0.705944121f, 0.276229024f},
-std::array<float,2>{0.00374245248f, 0.00304667675f},
-std::array<float,2>{0.828219414f, 0.619800031f},
-std::array<float,2>{0.224187315f, 0.70287925f},
-std::array<float,2>{0.886945903f, 0.202279299f},
-std::array<float,2>{0.336159766f, 0.471465707f},
-std::array<float,2>{0.533940613f, 0.758732677f},
-std::array<float,2>{0.202214211f, 0.76603502f},
-std::array<float,2>{0.918766081f, 0.493569553f},
-std::array<float,2>{0.358294606f, 0.210496917f},
-std::array<float,2>{0.513955057f, 0.706166983f},
-std::array<float,2>{0.484965205f, 0.607595444f},
-std::array<float,2>{0.744950473f, 0.0263656899f},
-std::array<float,2>{0.038865909f, 0.261276692f},
-std::array<float,2>{0.862006783f, 0.911250174f},
-std::array<float,2>{0.278603941f, 0.946475804f},
-std::array<float,2>{0.576694667f, 0.331050336f},
-std::array<float,2>{0.126605526f, 0.115281545f},
-std::array<float,2>{0.980075955f, 0.539835334f},
-std::array<float,2>{0.093909882f, 0.657000124f},
-std::array<float,2>{0.780000865f, 0.153298706f},
-std::array<float,2>{0.3809596f, 0.398356587f},
-std::array<float,2>{0.640444577f, 0.859229207f},
-std::array<float,2>{0.0178783722f, 0.904071033f},
-std::array<float,2>{0.823068142f, 0.307056963f},
-std::array<float,2>{0.467210144f, 0.037812613f},
-std::array<float,2>{0.690110743f, 0.578950405f},
-std::array<float,2>{0.315165579f, 0.736148596f},
-std::array<float,2>{0.555377185f, 0.227786973f},
-std::array<float,2>{0.244057193f, 0.446264178f},
-std::array<float,2>{0.900788188f, 0.808000565f},
-std::array<float,2>{0.421684921f, 0.824264288f},
-std::array<float,2>{0.669252932f, 0.422004372f},
-std::array<float,2>{0.0890184492f, 0.172144532f},
-std::array<float,2>{0.803085625f, 0.63709408f},
-std::array<float,2>{0.167024329f, 0.500182271f},
-std::array<float,2>{0.957269669f, 0.0772976652f},
-std::array<float,2>{0.287106276f, 0.369481832f},
-std::array<float,2>{0.599217534f, 0.993805885f},
-std::array<float,2>{0.238760218f, 0.920167565f},
-std::array<float,2>{0.89279902f, 0.252231121f},
-std::array<float,2>{0.326109618f, 0.0210801736f},
-std::array<float,2>{0.552502453f, 0.599059999f},
-std::array<float,2>{0.455649167f, 0.711608827f},
-std::array<float,2>{0.695587575f, 0.218200654f},
-std::array<float,2>{0.0237165969f, 0.487832993f},
-std::array<float,2>{0.816687822f, 0.778485f},
-std::array<float,2>{0.293968499f, 0.844816387f},
-std::array<float,2>{0.608889163f, 0.401003897f},
-std::array<float,2>{0.159526914f, 0.1453989f},
-std::array<float,2>{0.964814365f, 0.666937113f},
-std::array<float,2>{0.082272619f, 0.536618471f},
-std::array<float,2>{0.809534907f, 0.119820543f},
-std::array<float,2>{0.411108822f, 0.33801195f},
-std::array<float,2>{0.65954715f, 0.943173409f},
-std::array<float,2>{0.0438900553f, 0.801625311f},
-std::array<float,2>{0.869802654f, 0.441823244f},
-std::array<float,2>{0.496724337f, 0.223048836f},
-std::array<float,2>{0.73544383f, 0.742380261f},
-std::array<float,2>{0.347225547f, 0.590425313f},
-std::array<float,2>{0.503684819f, 0.0402187705f},
-std::array<float,2>{0.191385761f, 0.297697216f},
-std::array<float,2>{0.911540568f, 0.897410631f},
-std::array<float,2>{0.38711977f, 0.990827441f},
-std::array<float,2>{0.631629109f, 0.362832159f},
-std::array<float,2>{0.103593625f, 0.0643149912f},
-std::array<float,2>{0.767466426f, 0.509608269f},
-std::array<float,2>{0.138690352f, 0.629242957f},
-std::array<float,2>{0.972996831f, 0.186336234f},
-std::array<float,2>{0.271211118f, 0.430069447f},
-std::array<float,2>{0.567372501f, 0.817376494f},
-std::array<float,2>{0.172828674f, 0.836193144f},
-std::array<float,2>{0.945415616f, 0.420782179f},
-std::array<float,2>{0.297678113f, 0.166335955f},
-std::array<float,2>{0.619604945f, 0.643432677f},
-std::array<float,2>{0.426525801f, 0.51786375f},
-std::array<float,2>{0.678618491f, 0.0829201564f},
-std::array<float,2>{0.0632293075f, 0.352524877f},
-std::array<float,2>{0.796536744f, 0.983958483f},
-std::array<float,2>{0.335702091f, 0.886080325f},
-std::array<float,2>{0.540579975f, 0.294010907f},
-std::array<float,2>{0.228497833f, 0.0620105043f},
-std::array<float,2>{0.880746007f, 0.568603218f},
-std::array<float,2>{0.0143491291f, 0.719789803f},
-std::array<float,2>{0.838897347f, 0.241547003f},
-std::array<float,2>{0.445710599f, 0.46709168f},
-std::array<float,2>{0.711286724f, 0.78887403f},
-std::array<float,2>{0.12341287f, 0.965554357f},
-std::array<float,2>{0.759913266f, 0.316584378f},
-std::array<float,2>{0.398621142f, 0.103373885f},
-std::array<float,2>{0.64663887f, 0.547929406f},
-std::array<float,2>{0.26460886f, 0.680527687f},
-std::array<float,2>{0.578456044f, 0.126922503f},
-std::array<float,2>{0.154440552f, 0.380231887f},
-std::array<float,2>{0.985807002f, 0.86053431f},
-std::array<float,2>{0.479387283f, 0.755001068f},
-std::array<float,2>{0.730859816f, 0.477263063f},
-std::array<float,2>{0.0508848168f, 0.187656581f},
-std::array<float,2>{0.858815908f, 0.690419555f},
-std::array<float,2>{0.206783533f, 0.612025321f},
-std::array<float,2>{0.936156929f, 0.0101089142f},
-std::array<float,2>{0.365027785f, 0.268647939f},
-std::array<float,2>{0.523263872f, 0.923045754f},
-std::array<float,2>{0.213544533f, 0.940101504f},
-std::array<float,2>{0.928354502f, 0.34156993f},
-std::array<float,2>{0.37458685f, 0.123542942f},
-std::array<float,2>{0.524110079f, 0.534746647f},
-std::array<float,2>{0.473598421f, 0.670382202f},
-std::array<float,2>{0.718892574f, 0.14396143f},
-std::array<float,2>{0.05593298f, 0.40273115f},
-std::array<float,2>{0.849182308f, 0.848988533f},
-std::array<float,2>{0.25583744f, 0.774517477f},
-std::array<float,2>{0.586357057f, 0.49007535f},
-std::array<float,2>{0.142785326f, 0.212438121f},
-std::array<float,2>{0.996625066f, 0.7176103f},
-std::array<float,2>{0.113850661f, 0.5942204f},
-std::array<float,2>{0.75449276f, 0.0171415191f},
-std::array<float,2>{0.392267734f, 0.257162601f},
-std::array<float,2>{0.650415838f, 0.917276859f},
-std::array<float,2>{0.00592549518f, 0.814948738f},
-std::array<float,2>{0.8331756f, 0.434010565f},
-std::array<float,2>{0.44298172f, 0.182719246f},
-std::array<float,2>{0.709133863f, 0.626353443f},
-std::array<float,2>{0.339905322f, 0.514249086f},
-std::array<float,2>{0.535910249f, 0.0667539909f},
-std::array<float,2>{0.220747173f, 0.365982622f},
-std::array<float,2>{0.884107053f, 0.986770272f},
-std::array<float,2>{0.437002122f, 0.892871201f},
-std::array<float,2>{0.687242627f, 0.302586704f},
-std::array<float,2>{0.0739549845f, 0.0429860987f},
-std::array<float,2>{0.781572759f, 0.586157978f},
-std::array<float,2>{0.180257291f, 0.748157322f},
-std::array<float,2>{0.941325545f, 0.221891448f},
-std::array<float,2>{0.305297941f, 0.440440774f},
-std::array<float,2>{0.616496146f, 0.799919009f},
-std::array<float,2>{0.129937187f, 0.784712493f},
-std::array<float,2>{0.983862042f, 0.461424261f},
-std::array<float,2>{0.276694208f, 0.23659569f},
-std::array<float,2>{0.570994556f, 0.722880781f},
-std::array<float,2>{0.375986934f, 0.565910459f},
-std::array<float,2>{0.633625567f, 0.0575065725f},
-std::array<float,2>{0.100972749f, 0.291657865f},
-std::array<float,2>{0.775895417f, 0.890178442f},
-std::array<float,2>{0.353204757f, 0.97893405f},
-std::array<float,2>{0.509644508f, 0.357687205f},
-std::array<float,2>{0.198265746f, 0.0799362436f},
-std::array<float,2>{0.916508734f, 0.520297885f},
-std::array<float,2>{0.0327136964f, 0.644596756f},
-std::array<float,2>{0.863669217f, 0.171775669f},
-std::array<float,2>{0.489881307f, 0.416310281f},
-std::array<float,2>{0.749785841f, 0.841766894f},
-std::array<float,2>{0.0902786851f, 0.926225305f},
-std::array<float,2>{0.797872484f, 0.272000939f},
-std::array<float,2>{0.415332288f, 0.012021035f},
-std::array<float,2>{0.665920436f, 0.613636196f},
-std::array<float,2>{0.283705592f, 0.692902863f},
-std::array<float,2>{0.59593761f, 0.192822441f},
-std::array<float,2>{0.170263499f, 0.484265745f},
-std::array<float,2>{0.953473449f, 0.750446498f},
-std::array<float,2>{0.46239239f, 0.863936722f},
-std::array<float,2>{0.693001091f, 0.375058353f},
-std::array<float,2>{0.0206815619f, 0.129482985f},
-std::array<float,2>{0.825431108f, 0.684564829f},
-std::array<float,2>{0.24680756f, 0.554228544f},
-std::array<float,2>{0.904640377f, 0.107583024f},
-std::array<float,2>{0.320295244f, 0.313131869f},
-std::array<float,2>{0.560109854f, 0.962786198f},
-std::array<float,2>{0.161675394f, 0.877802014f},
-std::array<float,2>{0.966128469f, 0.283621788f},
-std::array<float,2>{0.290365219f, 0.0527696498f},
-std::array<float,2>{0.602753341f, 0.571350276f},
-std::array<float,2>{0.406386584f, 0.732763529f},
-std::array<float,2>{0.660707653f, 0.24428907f},
-std::array<float,2>{0.0808446705f, 0.460667044f},
-std::array<float,2>{0.805190921f, 0.792296767f},
-std::array<float,2>{0.32199949f, 0.828530192f},
-std::array<float,2>{0.549988568f, 0.408705145f},
-std::array<float,2>{0.237129614f, 0.161247447f},
-std::array<float,2>{0.897936404f, 0.653078139f},
-std::array<float,2>{0.0295838006f, 0.527508318f},
-std::array<float,2>{0.812740266f, 0.0905778706f},
-std::array<float,2>{0.46031636f, 0.34728092f},
-std::array<float,2>{0.702511847f, 0.971281707f},
-std::array<float,2>{0.108042702f, 0.764614403f},
-std::array<float,2>{0.769859076f, 0.474784166f},
-std::array<float,2>{0.385460645f, 0.19649002f},
-std::array<float,2>{0.626783848f, 0.696490407f},
-std::array<float,2>{0.268739283f, 0.62276119f},
-std::array<float,2>{0.564694583f, 0.00576703157f},
-std::array<float,2>{0.13383162f, 0.27923578f},
-std::array<float,2>{0.970448613f, 0.930794537f},
-std::array<float,2>{0.494576335f, 0.956295311f},
-std::array<float,2>{0.738489568f, 0.325186133f},
-std::array<float,2>{0.0428796522f, 0.0990194157f},
-std::array<float,2>{0.873666525f, 0.56191349f},
-std::array<float,2>{0.193147242f, 0.673997641f},
-std::array<float,2>{0.906869233f, 0.138080046f},
-std::array<float,2>{0.348156601f, 0.389338195f},
-std::array<float,2>{0.504259229f, 0.87093246f},
-std::array<float,2>{0.233394206f, 0.854950726f},
-std::array<float,2>{0.877099931f, 0.392199427f},
-std::array<float,2>{0.330699295f, 0.15062277f},
-std::array<float,2>{0.544816971f, 0.660759687f},
-std::array<float,2>{0.451804787f, 0.545384049f},
-std::array<float,2>{0.718583345f, 0.109803796f},
-std::array<float,2>{0.00854292512f, 0.332711935f},
-std::array<float,2>{0.840084255f, 0.950259447f},
-std::array<float,2>{0.302357107f, 0.908613622f},
-std::array<float,2>{0.622540653f, 0.263295919f},
-std::array<float,2>{0.178677544f, 0.0292855594f},
-std::array<float,2>{0.950481474f, 0.604947269f},
-std::array<float,2>{0.0696349591f, 0.707402408f},
-std::array<float,2>{0.790950954f, 0.204962343f},
-std::array<float,2>{0.422466516f, 0.49913305f},
-std::array<float,2>{0.674021363f, 0.771066129f},
-std::array<float,2>{0.0486981161f, 0.996350169f},
-std::array<float,2>{0.855336607f, 0.372464836f},
-std::array<float,2>{0.483345479f, 0.0705595315f},
-std::array<float,2>{0.728314638f, 0.505429387f},
-std::array<float,2>{0.36279127f, 0.634829044f},
-std::array<float,2>{0.51636821f, 0.17772834f},
-std::array<float,2>{0.208583161f, 0.426041901f},
-std::array<float,2>{0.929940045f, 0.822380841f},
-std::array<float,2>{0.403605908f, 0.810245693f},
-std::array<float,2>{0.643034875f, 0.451550305f},
-std::array<float,2>{0.117725879f, 0.233516738f},
-std::array<float,2>{0.762625813f, 0.73921746f},
-std::array<float,2>{0.1521492f, 0.584144533f},
-std::array<float,2>{0.990750134f, 0.0348017476f},
-std::array<float,2>{0.257895887f, 0.31196776f},
-std::array<float,2>{0.582351506f, 0.900276899f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.424555391f, 0.67970711f},
-std::array<float,2>{0.796663582f, 0.40708524f},
-std::array<float,2>{0.108576201f, 0.143336564f},
-std::array<float,2>{0.550032616f, 0.985795081f},
-std::array<float,2>{0.183532834f, 0.874382973f},
-std::array<float,2>{0.642870188f, 0.0507453829f},
-std::array<float,2>{0.296041787f, 0.367082924f},
-std::array<float,2>{0.927618384f, 0.527307928f},
-std::array<float,2>{0.0140905371f, 0.589416087f},
-std::array<float,2>{0.624856055f, 0.251071006f},
-std::array<float,2>{0.492174208f, 0.0682815313f},
-std::array<float,2>{0.873973727f, 0.774738431f},
-std::array<float,2>{0.34702459f, 0.916480422f},
-std::array<float,2>{0.951117337f, 0.219318047f},
-std::array<float,2>{0.191714451f, 0.488199383f},
-std::array<float,2>{0.727825284f, 0.70147115f},
-std::array<float,2>{0.276463389f, 0.537536621f},
-std::array<float,2>{0.897579968f, 0.313568741f},
-std::array<float,2>{0.128715962f, 0.00439997483f},
-std::array<float,2>{0.676459312f, 0.821376562f},
-std::array<float,2>{0.0817766041f, 0.949384272f},
-std::array<float,2>{0.513312101f, 0.161249936f},
-std::array<float,2>{0.380329162f, 0.382489413f},
-std::array<float,2>{0.775212526f, 0.633291006f},
-std::array<float,2>{0.24667798f, 0.72996968f},
-std::array<float,2>{0.70643127f, 0.444669962f},
-std::array<float,2>{0.321146369f, 0.201649159f},
-std::array<float,2>{0.969293296f, 0.880128324f},
-std::array<float,2>{0.44665724f, 0.80121243f},
-std::array<float,2>{0.821519554f, 0.110837989f},
-std::array<float,2>{0.0410171151f, 0.302763909f},
-std::array<float,2>{0.575345099f, 0.601531446f},
-std::array<float,2>{0.334575474f, 0.709067881f},
-std::array<float,2>{0.99889338f, 0.477512747f},
-std::array<float,2>{0.230525762f, 0.241015807f},
-std::array<float,2>{0.689176619f, 0.935599625f},
-std::array<float,2>{0.054116033f, 0.76182735f},
-std::array<float,2>{0.591790855f, 0.0909542143f},
-std::array<float,2>{0.468088627f, 0.26600641f},
-std::array<float,2>{0.835974932f, 0.575913787f},
-std::array<float,2>{0.14478597f, 0.507817864f},
-std::array<float,2>{0.670027435f, 0.344094217f},
-std::array<float,2>{0.262350559f, 0.0329070501f},
-std::array<float,2>{0.883033097f, 0.847360015f},
-std::array<float,2>{0.399937212f, 0.969862998f},
-std::array<float,2>{0.755669773f, 0.132938057f},
-std::array<float,2>{0.0684101582f, 0.424891293f},
-std::array<float,2>{0.52245605f, 0.670005977f},
-std::array<float,2>{0.482905835f, 0.620480359f},
-std::array<float,2>{0.84995985f, 0.288522929f},
-std::array<float,2>{0.0166992452f, 0.098931618f},
-std::array<float,2>{0.602495193f, 0.790441215f},
-std::array<float,2>{0.217440248f, 0.895899773f},
-std::array<float,2>{0.745194495f, 0.211024314f},
-std::array<float,2>{0.372963578f, 0.458692729f},
-std::array<float,2>{0.955467045f, 0.740139484f},
-std::array<float,2>{0.123916887f, 0.648925185f},
-std::array<float,2>{0.543227553f, 0.392946571f},
-std::array<float,2>{0.419242829f, 0.183103085f},
-std::array<float,2>{0.798533559f, 0.961910009f},
-std::array<float,2>{0.311151385f, 0.836919069f},
-std::array<float,2>{0.915886402f, 0.0176672619f},
-std::array<float,2>{0.161030486f, 0.329276681f},
-std::array<float,2>{0.634725571f, 0.555207372f},
-std::array<float,2>{0.460592389f, 0.743481815f},
-std::array<float,2>{0.83033967f, 0.462863982f},
-std::array<float,2>{0.0605938844f, 0.209473029f},
-std::array<float,2>{0.580175817f, 0.900707424f},
-std::array<float,2>{0.221932784f, 0.788611889f},
-std::array<float,2>{0.697608054f, 0.102168225f},
-std::array<float,2>{0.341421485f, 0.291619867f},
-std::array<float,2>{0.991539419f, 0.610420525f},
-std::array<float,2>{0.0776788816f, 0.552193999f},
-std::array<float,2>{0.529402852f, 0.338233203f},
-std::array<float,2>{0.396548152f, 0.0275392327f},
-std::array<float,2>{0.762022018f, 0.834881365f},
-std::array<float,2>{0.252590567f, 0.956152678f},
-std::array<float,2>{0.878579259f, 0.177735195f},
-std::array<float,2>{0.154754266f, 0.401284605f},
-std::array<float,2>{0.656324744f, 0.648382604f},
-std::array<float,2>{0.361750871f, 0.564864278f},
-std::array<float,2>{0.968167186f, 0.277434677f},
-std::array<float,2>{0.205840945f, 0.0795677006f},
-std::array<float,2>{0.740406036f, 0.755729079f},
-std::array<float,2>{0.025577547f, 0.923854053f},
-std::array<float,2>{0.600514114f, 0.243961781f},
-std::array<float,2>{0.469115078f, 0.470333129f},
-std::array<float,2>{0.859334052f, 0.716529548f},
-std::array<float,2>{0.171470791f, 0.6580953f},
-std::array<float,2>{0.627232909f, 0.43456468f},
-std::array<float,2>{0.30421257f, 0.128123209f},
-std::array<float,2>{0.910137415f, 0.983024716f},
-std::array<float,2>{0.40895763f, 0.858239472f},
-std::array<float,2>{0.808411658f, 0.0459064506f},
-std::array<float,2>{0.114137754f, 0.358947128f},
-std::array<float,2>{0.53362453f, 0.500911593f},
-std::array<float,2>{0.281913936f, 0.626568317f},
-std::array<float,2>{0.935237825f, 0.389706999f},
-std::array<float,2>{0.176534295f, 0.164817676f},
-std::array<float,2>{0.649600387f, 0.942831874f},
-std::array<float,2>{0.0978260562f, 0.819688559f},
-std::array<float,2>{0.558787286f, 0.0153378379f},
-std::array<float,2>{0.434708446f, 0.327884644f},
-std::array<float,2>{0.785342097f, 0.540734529f},
-std::array<float,2>{0.197712302f, 0.602020502f},
-std::array<float,2>{0.719764173f, 0.310005605f},
-std::array<float,2>{0.354963154f, 0.124620132f},
-std::array<float,2>{0.941366196f, 0.81080848f},
-std::array<float,2>{0.498244435f, 0.886561036f},
-std::array<float,2>{0.865712762f, 0.188101858f},
-std::array<float,2>{0.00258853193f, 0.449372351f},
-std::array<float,2>{0.617106855f, 0.722291708f},
-std::array<float,2>{0.384092659f, 0.521254838f},
-std::array<float,2>{0.767169535f, 0.371628553f},
-std::array<float,2>{0.0872159749f, 0.0608013868f},
-std::array<float,2>{0.501857936f, 0.865005851f},
-std::array<float,2>{0.133468419f, 0.994429827f},
-std::array<float,2>{0.680890262f, 0.154567152f},
-std::array<float,2>{0.271821767f, 0.417196333f},
-std::array<float,2>{0.89870894f, 0.675326407f},
-std::array<float,2>{0.0378841199f, 0.694007754f},
-std::array<float,2>{0.568644762f, 0.495874017f},
-std::array<float,2>{0.441800117f, 0.232482344f},
-std::array<float,2>{0.815628529f, 0.910382509f},
-std::array<float,2>{0.313385278f, 0.767955363f},
-std::array<float,2>{0.981750667f, 0.0752201527f},
-std::array<float,2>{0.235897824f, 0.265588462f},
-std::array<float,2>{0.713762045f, 0.57824564f},
-std::array<float,2>{0.485370278f, 0.641645193f},
-std::array<float,2>{0.868434191f, 0.402642161f},
-std::array<float,2>{0.0104092499f, 0.173864573f},
-std::array<float,2>{0.620560467f, 0.957626224f},
-std::array<float,2>{0.189478919f, 0.831689417f},
-std::array<float,2>{0.73287183f, 0.023719972f},
-std::array<float,2>{0.348137707f, 0.342325211f},
-std::array<float,2>{0.947648346f, 0.550024629f},
-std::array<float,2>{0.104896486f, 0.615868509f},
-std::array<float,2>{0.551516712f, 0.293808013f},
-std::array<float,2>{0.426360875f, 0.10674078f},
-std::array<float,2>{0.792337239f, 0.784269214f},
-std::array<float,2>{0.289075345f, 0.903937161f},
-std::array<float,2>{0.922513247f, 0.203867003f},
-std::array<float,2>{0.18424882f, 0.468712777f},
-std::array<float,2>{0.646587431f, 0.748393178f},
-std::array<float,2>{0.325216025f, 0.507066071f},
-std::array<float,2>{0.975583315f, 0.352014422f},
-std::array<float,2>{0.245301798f, 0.0408869237f},
-std::array<float,2>{0.708338618f, 0.852088988f},
-std::array<float,2>{0.0453774817f, 0.980162024f},
-std::array<float,2>{0.574044585f, 0.132552862f},
-std::array<float,2>{0.450403035f, 0.430838257f},
-std::array<float,2>{0.826287746f, 0.663268268f},
-std::array<float,2>{0.128993258f, 0.712029934f},
-std::array<float,2>{0.674408734f, 0.475942105f},
-std::array<float,2>{0.280596167f, 0.246946216f},
-std::array<float,2>{0.893776119f, 0.925911248f},
-std::array<float,2>{0.375387639f, 0.753196061f},
-std::array<float,2>{0.778890491f, 0.0823755339f},
-std::array<float,2>{0.08266031f, 0.275012434f},
-std::array<float,2>{0.510875046f, 0.56697911f},
-std::array<float,2>{0.259600669f, 0.724675894f},
-std::array<float,2>{0.887422144f, 0.446993917f},
-std::array<float,2>{0.141223893f, 0.192229643f},
-std::array<float,2>{0.664734185f, 0.890012443f},
-std::array<float,2>{0.0629214719f, 0.80688113f},
-std::array<float,2>{0.51879555f, 0.118850917f},
-std::array<float,2>{0.404408634f, 0.304924875f},
-std::array<float,2>{0.753270626f, 0.607607126f},
-std::array<float,2>{0.228678524f, 0.543014824f},
-std::array<float,2>{0.693489969f, 0.321572334f},
-std::array<float,2>{0.330617905f, 0.0116435746f},
-std::array<float,2>{0.993897259f, 0.814230323f},
-std::array<float,2>{0.461897045f, 0.939531088f},
-std::array<float,2>{0.842238784f, 0.169944406f},
-std::array<float,2>{0.0473116972f, 0.383857191f},
-std::array<float,2>{0.5880512f, 0.630002499f},
-std::array<float,2>{0.415269256f, 0.583861291f},
-std::array<float,2>{0.804154932f, 0.260579139f},
-std::array<float,2>{0.120161578f, 0.0726083741f},
-std::array<float,2>{0.541358054f, 0.771833122f},
-std::array<float,2>{0.15761514f, 0.909173727f},
-std::array<float,2>{0.637480438f, 0.229420379f},
-std::array<float,2>{0.304818273f, 0.498698354f},
-std::array<float,2>{0.919503629f, 0.689694524f},
-std::array<float,2>{0.0228190087f, 0.679272652f},
-std::array<float,2>{0.607060552f, 0.421572655f},
-std::array<float,2>{0.478360772f, 0.149139911f},
-std::array<float,2>{0.844604313f, 0.996311784f},
-std::array<float,2>{0.369234651f, 0.862383127f},
-std::array<float,2>{0.958057404f, 0.0566340312f},
-std::array<float,2>{0.213981047f, 0.369702339f},
-std::array<float,2>{0.74620223f, 0.515922129f},
-std::array<float,2>{0.393698841f, 0.696280539f},
-std::array<float,2>{0.758710384f, 0.49087134f},
-std::array<float,2>{0.074101992f, 0.225759909f},
-std::array<float,2>{0.525861621f, 0.919845045f},
-std::array<float,2>{0.149577051f, 0.779117525f},
-std::array<float,2>{0.660488904f, 0.0646830499f},
-std::array<float,2>{0.256047875f, 0.253985792f},
-std::array<float,2>{0.882073641f, 0.590776026f},
-std::array<float,2>{0.0548022948f, 0.527433336f},
-std::array<float,2>{0.585812569f, 0.362841338f},
-std::array<float,2>{0.453693777f, 0.052462779f},
-std::array<float,2>{0.832755566f, 0.87021029f},
-std::array<float,2>{0.338576645f, 0.992035866f},
-std::array<float,2>{0.984434545f, 0.148009315f},
-std::array<float,2>{0.226032302f, 0.410752743f},
-std::array<float,2>{0.699278891f, 0.684514046f},
-std::array<float,2>{0.300148487f, 0.594819188f},
-std::array<float,2>{0.911002934f, 0.299345881f},
-std::array<float,2>{0.165285438f, 0.116439559f},
-std::array<float,2>{0.631580472f, 0.797073722f},
-std::array<float,2>{0.112010159f, 0.877315819f},
-std::array<float,2>{0.538668931f, 0.198401392f},
-std::array<float,2>{0.413180828f, 0.441393852f},
-std::array<float,2>{0.809229016f, 0.730718732f},
-std::array<float,2>{0.208044261f, 0.638537228f},
-std::array<float,2>{0.735332251f, 0.377822995f},
-std::array<float,2>{0.363338232f, 0.157638833f},
-std::array<float,2>{0.962100506f, 0.946267664f},
-std::array<float,2>{0.473448068f, 0.827966452f},
-std::array<float,2>{0.853547812f, 0.00175561185f},
-std::array<float,2>{0.0285333954f, 0.319614172f},
-std::array<float,2>{0.595916033f, 0.532871425f},
-std::array<float,2>{0.359264642f, 0.666610539f},
-std::array<float,2>{0.943923593f, 0.428209722f},
-std::array<float,2>{0.202049613f, 0.138060242f},
-std::array<float,2>{0.725653529f, 0.974429727f},
-std::array<float,2>{0.00570546091f, 0.848488271f},
-std::array<float,2>{0.611805677f, 0.0355200097f},
-std::array<float,2>{0.495185941f, 0.350741982f},
-std::array<float,2>{0.860272348f, 0.514015079f},
-std::array<float,2>{0.172954559f, 0.57181567f},
-std::array<float,2>{0.656070352f, 0.272231579f},
-std::array<float,2>{0.288186431f, 0.0888186097f},
-std::array<float,2>{0.930150688f, 0.759451628f},
-std::array<float,2>{0.433294773f, 0.930456698f},
-std::array<float,2>{0.783485889f, 0.237109348f},
-std::array<float,2>{0.0948049203f, 0.481221914f},
-std::array<float,2>{0.555882692f, 0.705668271f},
-std::array<float,2>{0.44010824f, 0.559644103f},
-std::array<float,2>{0.816869736f, 0.333053738f},
-std::array<float,2>{0.033222381f, 0.0221997835f},
-std::array<float,2>{0.562980056f, 0.841675401f},
-std::array<float,2>{0.240967423f, 0.966571867f},
-std::array<float,2>{0.718619168f, 0.184958234f},
-std::array<float,2>{0.318117529f, 0.396172673f},
-std::array<float,2>{0.979938984f, 0.655205369f},
-std::array<float,2>{0.0906909481f, 0.73567909f},
-std::array<float,2>{0.504832923f, 0.454373777f},
-std::array<float,2>{0.389498949f, 0.216836244f},
-std::array<float,2>{0.773121476f, 0.892926395f},
-std::array<float,2>{0.26907143f, 0.793216228f},
-std::array<float,2>{0.902370155f, 0.0957230255f},
-std::array<float,2>{0.138267636f, 0.284450442f},
-std::array<float,2>{0.683998048f, 0.623759747f},
-std::array<float,2>{0.38275066f, 0.636504829f},
-std::array<float,2>{0.775861561f, 0.380039334f},
-std::array<float,2>{0.0799461231f, 0.163737103f},
-std::array<float,2>{0.515098512f, 0.951616883f},
-std::array<float,2>{0.125268713f, 0.822857559f},
-std::array<float,2>{0.67960757f, 0.00627298607f},
-std::array<float,2>{0.274992466f, 0.315698862f},
-std::array<float,2>{0.895912588f, 0.53646642f},
-std::array<float,2>{0.0404969975f, 0.598418653f},
-std::array<float,2>{0.577455759f, 0.301636875f},
-std::array<float,2>{0.44808501f, 0.111774318f},
-std::array<float,2>{0.823414207f, 0.803107619f},
-std::array<float,2>{0.323185086f, 0.882489741f},
-std::array<float,2>{0.972194672f, 0.199579671f},
-std::array<float,2>{0.248366654f, 0.441991568f},
-std::array<float,2>{0.704797208f, 0.726660609f},
-std::array<float,2>{0.293624312f, 0.523542762f},
-std::array<float,2>{0.929456413f, 0.365013361f},
-std::array<float,2>{0.17979151f, 0.0476302877f},
-std::array<float,2>{0.64095819f, 0.872759342f},
-std::array<float,2>{0.105566315f, 0.987406254f},
-std::array<float,2>{0.548279226f, 0.140899003f},
-std::array<float,2>{0.423084259f, 0.40913114f},
-std::array<float,2>{0.794789314f, 0.682096601f},
-std::array<float,2>{0.193511441f, 0.700585067f},
-std::array<float,2>{0.730216682f, 0.484398842f},
-std::array<float,2>{0.344661444f, 0.221168861f},
-std::array<float,2>{0.952098906f, 0.914552808f},
-std::array<float,2>{0.48901388f, 0.776983261f},
-std::array<float,2>{0.872618616f, 0.070157513f},
-std::array<float,2>{0.0127584422f, 0.253391653f},
-std::array<float,2>{0.622879744f, 0.586352229f},
-std::array<float,2>{0.373895049f, 0.740748703f},
-std::array<float,2>{0.95352298f, 0.460513622f},
-std::array<float,2>{0.215263918f, 0.214398324f},
-std::array<float,2>{0.742799997f, 0.897182405f},
-std::array<float,2>{0.0194559526f, 0.792048872f},
-std::array<float,2>{0.603596091f, 0.100213505f},
-std::array<float,2>{0.480721802f, 0.285326153f},
-std::array<float,2>{0.848453879f, 0.618976176f},
-std::array<float,2>{0.16301164f, 0.557351351f},
-std::array<float,2>{0.636356413f, 0.331080645f},
-std::array<float,2>{0.309729069f, 0.0164189283f},
-std::array<float,2>{0.917544663f, 0.839172959f},
-std::array<float,2>{0.420140654f, 0.963328779f},
-std::array<float,2>{0.798852563f, 0.181472585f},
-std::array<float,2>{0.122097008f, 0.391626805f},
-std::array<float,2>{0.546139836f, 0.652237833f},
-std::array<float,2>{0.466759533f, 0.5773983f},
-std::array<float,2>{0.83900249f, 0.26946792f},
-std::array<float,2>{0.0520439781f, 0.0935484469f},
-std::array<float,2>{0.59343189f, 0.765160322f},
-std::array<float,2>{0.233895883f, 0.934170544f},
-std::array<float,2>{0.690189004f, 0.239712492f},
-std::array<float,2>{0.332302213f, 0.479083866f},
-std::array<float,2>{0.997714221f, 0.707997918f},
-std::array<float,2>{0.0668983087f, 0.669218481f},
-std::array<float,2>{0.519663572f, 0.423384249f},
-std::array<float,2>{0.401795596f, 0.135968119f},
-std::array<float,2>{0.755895495f, 0.971409619f},
-std::array<float,2>{0.264435232f, 0.844210744f},
-std::array<float,2>{0.884921789f, 0.0335283764f},
-std::array<float,2>{0.146612495f, 0.346195757f},
-std::array<float,2>{0.66874516f, 0.510643959f},
-std::array<float,2>{0.471426338f, 0.717256308f},
-std::array<float,2>{0.857222974f, 0.47169289f},
-std::array<float,2>{0.0237069149f, 0.24582684f},
-std::array<float,2>{0.598046482f, 0.923603475f},
-std::array<float,2>{0.204566285f, 0.756688595f},
-std::array<float,2>{0.739776254f, 0.0806856826f},
-std::array<float,2>{0.360544771f, 0.28042984f},
-std::array<float,2>{0.965780973f, 0.563027024f},
-std::array<float,2>{0.117067754f, 0.503898203f},
-std::array<float,2>{0.531267464f, 0.35624218f},
-std::array<float,2>{0.407955259f, 0.0445197225f},
-std::array<float,2>{0.805273533f, 0.855620205f},
-std::array<float,2>{0.301097214f, 0.981267929f},
-std::array<float,2>{0.906821012f, 0.125222474f},
-std::array<float,2>{0.168739125f, 0.436215401f},
-std::array<float,2>{0.625375628f, 0.659069598f},
-std::array<float,2>{0.343092829f, 0.611587703f},
-std::array<float,2>{0.989221036f, 0.289636195f},
-std::array<float,2>{0.219788849f, 0.103821993f},
-std::array<float,2>{0.69531852f, 0.785389304f},
-std::array<float,2>{0.0587258972f, 0.900305808f},
-std::array<float,2>{0.578801036f, 0.207634687f},
-std::array<float,2>{0.458975166f, 0.463946313f},
-std::array<float,2>{0.828672469f, 0.745326996f},
-std::array<float,2>{0.154231727f, 0.646100938f},
-std::array<float,2>{0.659584045f, 0.399474561f},
-std::array<float,2>{0.250830561f, 0.1765434f},
-std::array<float,2>{0.875105739f, 0.953542531f},
-std::array<float,2>{0.396438569f, 0.832305253f},
-std::array<float,2>{0.763873339f, 0.0301776044f},
-std::array<float,2>{0.0760291517f, 0.337577701f},
-std::array<float,2>{0.52896893f, 0.553926647f},
-std::array<float,2>{0.269940346f, 0.67187649f},
-std::array<float,2>{0.900535703f, 0.414187253f},
-std::array<float,2>{0.135392621f, 0.153177902f},
-std::array<float,2>{0.682051778f, 0.992208421f},
-std::array<float,2>{0.0885623693f, 0.866619885f},
-std::array<float,2>{0.502071917f, 0.0589198023f},
-std::array<float,2>{0.385106057f, 0.374185562f},
-std::array<float,2>{0.767998397f, 0.521831274f},
-std::array<float,2>{0.236828431f, 0.581781566f},
-std::array<float,2>{0.712271154f, 0.26233685f},
-std::array<float,2>{0.316001803f, 0.0773950219f},
-std::array<float,2>{0.984133124f, 0.76756084f},
-std::array<float,2>{0.445185959f, 0.912785172f},
-std::array<float,2>{0.81274879f, 0.23215799f},
-std::array<float,2>{0.0369534269f, 0.492914796f},
-std::array<float,2>{0.566785574f, 0.692059159f},
-std::array<float,2>{0.435922116f, 0.542921901f},
-std::array<float,2>{0.788222432f, 0.325835735f},
-std::array<float,2>{0.100022793f, 0.0135006309f},
-std::array<float,2>{0.560611129f, 0.817976773f},
-std::array<float,2>{0.178367198f, 0.945163012f},
-std::array<float,2>{0.65225172f, 0.16794765f},
-std::array<float,2>{0.284989655f, 0.387941092f},
-std::array<float,2>{0.936054051f, 0.627813518f},
-std::array<float,2>{0.00112442859f, 0.719590247f},
-std::array<float,2>{0.613793969f, 0.451833338f},
-std::array<float,2>{0.496303946f, 0.190800324f},
-std::array<float,2>{0.864479303f, 0.884180307f},
-std::array<float,2>{0.351903528f, 0.810350478f},
-std::array<float,2>{0.938697875f, 0.121589735f},
-std::array<float,2>{0.196292788f, 0.311057091f},
-std::array<float,2>{0.72259289f, 0.603554785f},
-std::array<float,2>{0.451306909f, 0.66122359f},
-std::array<float,2>{0.825997353f, 0.431921959f},
-std::array<float,2>{0.0436247177f, 0.129545182f},
-std::array<float,2>{0.571416795f, 0.976924479f},
-std::array<float,2>{0.243139088f, 0.855362535f},
-std::array<float,2>{0.70916146f, 0.0426417626f},
-std::array<float,2>{0.326211542f, 0.354352981f},
-std::array<float,2>{0.972869337f, 0.505730391f},
-std::array<float,2>{0.0850197673f, 0.569193184f},
-std::array<float,2>{0.508503377f, 0.276848495f},
-std::array<float,2>{0.377067f, 0.0853798315f},
-std::array<float,2>{0.78116864f, 0.751254082f},
-std::array<float,2>{0.27928248f, 0.928150952f},
-std::array<float,2>{0.890936375f, 0.248583049f},
-std::array<float,2>{0.131658435f, 0.473423511f},
-std::array<float,2>{0.672502875f, 0.713851929f},
-std::array<float,2>{0.350467741f, 0.547664046f},
-std::array<float,2>{0.945728123f, 0.340379298f},
-std::array<float,2>{0.189175978f, 0.0266123731f},
-std::array<float,2>{0.730564773f, 0.828130662f},
-std::array<float,2>{0.00816681236f, 0.959917486f},
-std::array<float,2>{0.618842363f, 0.172068447f},
-std::array<float,2>{0.486882389f, 0.406223863f},
-std::array<float,2>{0.870344222f, 0.644122601f},
-std::array<float,2>{0.185599327f, 0.746322751f},
-std::array<float,2>{0.644625306f, 0.465987444f},
-std::array<float,2>{0.292381644f, 0.205277503f},
-std::array<float,2>{0.924573421f, 0.905205786f},
-std::array<float,2>{0.427854747f, 0.783106387f},
-std::array<float,2>{0.789262891f, 0.108845785f},
-std::array<float,2>{0.102939166f, 0.295764416f},
-std::array<float,2>{0.553206861f, 0.614590704f},
-std::array<float,2>{0.307586879f, 0.689289451f},
-std::array<float,2>{0.921825469f, 0.496264338f},
-std::array<float,2>{0.158724844f, 0.226623237f},
-std::array<float,2>{0.639413357f, 0.90739429f},
-std::array<float,2>{0.117254727f, 0.77090472f},
-std::array<float,2>{0.540066779f, 0.0720630139f},
-std::array<float,2>{0.41672194f, 0.259480417f},
-std::array<float,2>{0.800843775f, 0.584576845f},
-std::array<float,2>{0.212059796f, 0.518970728f},
-std::array<float,2>{0.748379529f, 0.367582649f},
-std::array<float,2>{0.367263794f, 0.0576011837f},
-std::array<float,2>{0.959994137f, 0.861106634f},
-std::array<float,2>{0.478799731f, 0.99998033f},
-std::array<float,2>{0.846144736f, 0.151319548f},
-std::array<float,2>{0.0209014621f, 0.419880122f},
-std::array<float,2>{0.609129071f, 0.677254617f},
-std::array<float,2>{0.402378947f, 0.605594158f},
-std::array<float,2>{0.751896143f, 0.307175428f},
-std::array<float,2>{0.0654025525f, 0.120193467f},
-std::array<float,2>{0.51695776f, 0.805978656f},
-std::array<float,2>{0.142850086f, 0.887190342f},
-std::array<float,2>{0.666948736f, 0.195215166f},
-std::array<float,2>{0.259775966f, 0.449116439f},
-std::array<float,2>{0.890540957f, 0.723502278f},
-std::array<float,2>{0.0506702885f, 0.631994247f},
-std::array<float,2>{0.587279916f, 0.386013448f},
-std::array<float,2>{0.463489771f, 0.169416979f},
-std::array<float,2>{0.840359271f, 0.93876344f},
-std::array<float,2>{0.328211606f, 0.815695763f},
-std::array<float,2>{0.995930731f, 0.00782272592f},
-std::array<float,2>{0.228408381f, 0.322531223f},
-std::array<float,2>{0.69178158f, 0.545024455f},
-std::array<float,2>{0.411705077f, 0.732438624f},
-std::array<float,2>{0.81185478f, 0.438972652f},
-std::array<float,2>{0.110166855f, 0.196004987f},
-std::array<float,2>{0.536228716f, 0.876710892f},
-std::array<float,2>{0.16683048f, 0.80062288f},
-std::array<float,2>{0.630206823f, 0.114769682f},
-std::array<float,2>{0.298770726f, 0.297001541f},
-std::array<float,2>{0.912760973f, 0.597597659f},
-std::array<float,2>{0.029832134f, 0.533889294f},
-std::array<float,2>{0.594367564f, 0.316582471f},
-std::array<float,2>{0.476369679f, 0.00330679119f},
-std::array<float,2>{0.851766825f, 0.82480514f},
-std::array<float,2>{0.366588205f, 0.948372662f},
-std::array<float,2>{0.964799941f, 0.159474999f},
-std::array<float,2>{0.210673049f, 0.375101715f},
-std::array<float,2>{0.737593532f, 0.640520632f},
-std::array<float,2>{0.25534305f, 0.591870368f},
-std::array<float,2>{0.879367948f, 0.257319272f},
-std::array<float,2>{0.15073213f, 0.0637541115f},
-std::array<float,2>{0.66342485f, 0.77930516f},
-std::array<float,2>{0.0712712109f, 0.920877516f},
-std::array<float,2>{0.525195062f, 0.222755656f},
-std::array<float,2>{0.391279131f, 0.489525467f},
-std::array<float,2>{0.7616238f, 0.698188007f},
-std::array<float,2>{0.223460972f, 0.686091542f},
-std::array<float,2>{0.702210724f, 0.413018823f},
-std::array<float,2>{0.336545348f, 0.145960465f},
-std::array<float,2>{0.987229288f, 0.989730954f},
-std::array<float,2>{0.456515014f, 0.869062424f},
-std::array<float,2>{0.835196435f, 0.0535369441f},
-std::array<float,2>{0.0574646667f, 0.359641701f},
-std::array<float,2>{0.582079649f, 0.529389024f},
-std::array<float,2>{0.320099503f, 0.652748227f},
-std::array<float,2>{0.977534354f, 0.397877485f},
-std::array<float,2>{0.238521174f, 0.185784966f},
-std::array<float,2>{0.715960681f, 0.967810631f},
-std::array<float,2>{0.032086093f, 0.843549252f},
-std::array<float,2>{0.565945804f, 0.0200378969f},
-std::array<float,2>{0.43816933f, 0.334735364f},
-std::array<float,2>{0.818992019f, 0.562001765f},
-std::array<float,2>{0.139324039f, 0.621872962f},
-std::array<float,2>{0.686632156f, 0.282731622f},
-std::array<float,2>{0.26710403f, 0.094482474f},
-std::array<float,2>{0.90594089f, 0.796723068f},
-std::array<float,2>{0.38731432f, 0.891113997f},
-std::array<float,2>{0.769538939f, 0.216408536f},
-std::array<float,2>{0.0924019367f, 0.456366092f},
-std::array<float,2>{0.506720006f, 0.736954689f},
-std::array<float,2>{0.493144244f, 0.513166964f},
-std::array<float,2>{0.861933291f, 0.34944272f},
-std::array<float,2>{0.00734929508f, 0.037573278f},
-std::array<float,2>{0.610953093f, 0.851382852f},
-std::array<float,2>{0.200548574f, 0.975664973f},
-std::array<float,2>{0.723266184f, 0.140499145f},
-std::array<float,2>{0.355709165f, 0.427715361f},
-std::array<float,2>{0.94268167f, 0.665717244f},
-std::array<float,2>{0.0969109163f, 0.704186618f},
-std::array<float,2>{0.558434308f, 0.483351529f},
-std::array<float,2>{0.430231363f, 0.234416097f},
-std::array<float,2>{0.782623887f, 0.932097971f},
-std::array<float,2>{0.286667049f, 0.761484146f},
-std::array<float,2>{0.932184458f, 0.0864466876f},
-std::array<float,2>{0.173907369f, 0.271219939f},
-std::array<float,2>{0.653700531f, 0.573298633f},
-std::array<float,2>{0.400710613f, 0.671787143f},
-std::array<float,2>{0.757283688f, 0.424602419f},
-std::array<float,2>{0.0680271611f, 0.134556323f},
-std::array<float,2>{0.521268904f, 0.969422877f},
-std::array<float,2>{0.148411155f, 0.845832407f},
-std::array<float,2>{0.669914126f, 0.0314712524f},
-std::array<float,2>{0.265255272f, 0.345555067f},
-std::array<float,2>{0.886634469f, 0.509477556f},
-std::array<float,2>{0.0507875495f, 0.575145245f},
-std::array<float,2>{0.592158437f, 0.266929507f},
-std::array<float,2>{0.465349048f, 0.0906037092f},
-std::array<float,2>{0.838688076f, 0.763106942f},
-std::array<float,2>{0.333325922f, 0.937318683f},
-std::array<float,2>{0.996740162f, 0.242047682f},
-std::array<float,2>{0.232898533f, 0.477539271f},
-std::array<float,2>{0.690954864f, 0.710517466f},
-std::array<float,2>{0.308701456f, 0.556191742f},
-std::array<float,2>{0.916024446f, 0.32845065f},
-std::array<float,2>{0.163989037f, 0.0187680926f},
-std::array<float,2>{0.635028958f, 0.836715817f},
-std::array<float,2>{0.121816196f, 0.96246326f},
-std::array<float,2>{0.545293987f, 0.182300523f},
-std::array<float,2>{0.421407759f, 0.393568963f},
-std::array<float,2>{0.799850345f, 0.650305092f},
-std::array<float,2>{0.216525555f, 0.738742769f},
-std::array<float,2>{0.743779719f, 0.457407802f},
-std::array<float,2>{0.374814838f, 0.212802574f},
-std::array<float,2>{0.954424918f, 0.894580841f},
-std::array<float,2>{0.48186332f, 0.78938818f},
-std::array<float,2>{0.849138081f, 0.0984636322f},
-std::array<float,2>{0.0184228718f, 0.287277639f},
-std::array<float,2>{0.604518592f, 0.620116889f},
-std::array<float,2>{0.345301419f, 0.702414811f},
-std::array<float,2>{0.952396452f, 0.487298459f},
-std::array<float,2>{0.195135459f, 0.220121577f},
-std::array<float,2>{0.72899878f, 0.917120457f},
-std::array<float,2>{0.0123696784f, 0.774328589f},
-std::array<float,2>{0.622025132f, 0.0666827708f},
-std::array<float,2>{0.490176678f, 0.250002474f},
-std::array<float,2>{0.87171042f, 0.587947965f},
-std::array<float,2>{0.181174174f, 0.526113033f},
-std::array<float,2>{0.642120838f, 0.365784705f},
-std::array<float,2>{0.294202209f, 0.0489560477f},
-std::array<float,2>{0.927736282f, 0.873593092f},
-std::array<float,2>{0.422672451f, 0.984761477f},
-std::array<float,2>{0.79300189f, 0.144059569f},
-std::array<float,2>{0.106590465f, 0.407590717f},
-std::array<float,2>{0.547026575f, 0.681105673f},
-std::array<float,2>{0.448779523f, 0.600359201f},
-std::array<float,2>{0.823140919f, 0.304598808f},
-std::array<float,2>{0.0393667258f, 0.110211052f},
-std::array<float,2>{0.576814711f, 0.802664876f},
-std::array<float,2>{0.249968484f, 0.879569352f},
-std::array<float,2>{0.703467131f, 0.202213585f},
-std::array<float,2>{0.324206829f, 0.443715006f},
-std::array<float,2>{0.971268654f, 0.729062617f},
-std::array<float,2>{0.0786622018f, 0.634014189f},
-std::array<float,2>{0.514178395f, 0.381554782f},
-std::array<float,2>{0.380898684f, 0.161086842f},
-std::array<float,2>{0.776393414f, 0.951011658f},
-std::array<float,2>{0.274067789f, 0.821193755f},
-std::array<float,2>{0.895040452f, 0.00492097298f},
-std::array<float,2>{0.125987664f, 0.313222051f},
-std::array<float,2>{0.678522408f, 0.538746715f},
-std::array<float,2>{0.497503996f, 0.72164309f},
-std::array<float,2>{0.864162982f, 0.450403422f},
-std::array<float,2>{1.47751398e-05f, 0.189417839f},
-std::array<float,2>{0.615011752f, 0.885094285f},
-std::array<float,2>{0.196227759f, 0.811675966f},
-std::array<float,2>{0.721497655f, 0.123877712f},
-std::array<float,2>{0.353296936f, 0.309153706f},
-std::array<float,2>{0.938141108f, 0.603510618f},
-std::array<float,2>{0.101113424f, 0.53935951f},
-std::array<float,2>{0.562024534f, 0.326189786f},
-std::array<float,2>{0.437119991f, 0.0145175736f},
-std::array<float,2>{0.787167847f, 0.819142401f},
-std::array<float,2>{0.28325817f, 0.942199528f},
-std::array<float,2>{0.936737001f, 0.16527018f},
-std::array<float,2>{0.179587647f, 0.388861418f},
-std::array<float,2>{0.650883198f, 0.625413299f},
-std::array<float,2>{0.315256417f, 0.579225957f},
-std::array<float,2>{0.983018398f, 0.264287382f},
-std::array<float,2>{0.238249823f, 0.0750382021f},
-std::array<float,2>{0.711131036f, 0.768863082f},
-std::array<float,2>{0.035580907f, 0.911851883f},
-std::array<float,2>{0.567437053f, 0.234020784f},
-std::array<float,2>{0.444328725f, 0.494590163f},
-std::array<float,2>{0.813841999f, 0.694540143f},
-std::array<float,2>{0.136631355f, 0.674164474f},
-std::array<float,2>{0.683121502f, 0.416894794f},
-std::array<float,2>{0.270542085f, 0.156206578f},
-std::array<float,2>{0.901998401f, 0.995158911f},
-std::array<float,2>{0.385871351f, 0.863828957f},
-std::array<float,2>{0.769175708f, 0.0619350225f},
-std::array<float,2>{0.0895936415f, 0.373007149f},
-std::array<float,2>{0.502969325f, 0.51961261f},
-std::array<float,2>{0.251474738f, 0.647181511f},
-std::array<float,2>{0.876522005f, 0.401628643f},
-std::array<float,2>{0.152930811f, 0.179457143f},
-std::array<float,2>{0.658829093f, 0.955599546f},
-std::array<float,2>{0.0744689032f, 0.835820496f},
-std::array<float,2>{0.527448416f, 0.0283991899f},
-std::array<float,2>{0.394881904f, 0.339339644f},
-std::array<float,2>{0.765322983f, 0.550821602f},
-std::array<float,2>{0.219115213f, 0.609607458f},
-std::array<float,2>{0.696729362f, 0.292281121f},
-std::array<float,2>{0.342401922f, 0.103252649f},
-std::array<float,2>{0.989468575f, 0.787206054f},
-std::array<float,2>{0.457498133f, 0.902316213f},
-std::array<float,2>{0.829127192f, 0.210546955f},
-std::array<float,2>{0.0600963309f, 0.461391926f},
-std::array<float,2>{0.579696357f, 0.742292166f},
-std::array<float,2>{0.406410962f, 0.501072109f},
-std::array<float,2>{0.805782974f, 0.357799113f},
-std::array<float,2>{0.115513384f, 0.04504136f},
-std::array<float,2>{0.533114195f, 0.858830929f},
-std::array<float,2>{0.169369578f, 0.983977437f},
-std::array<float,2>{0.626517475f, 0.127520338f},
-std::array<float,2>{0.301898122f, 0.435422331f},
-std::array<float,2>{0.907523334f, 0.656647742f},
-std::array<float,2>{0.0246472489f, 0.715071142f},
-std::array<float,2>{0.598818183f, 0.468768954f},
-std::array<float,2>{0.471715242f, 0.242379338f},
-std::array<float,2>{0.856403053f, 0.925777197f},
-std::array<float,2>{0.359722704f, 0.75451225f},
-std::array<float,2>{0.966326773f, 0.0783302858f},
-std::array<float,2>{0.203698382f, 0.278395355f},
-std::array<float,2>{0.738696396f, 0.566250443f},
-std::array<float,2>{0.464497387f, 0.6296525f},
-std::array<float,2>{0.841523707f, 0.383222252f},
-std::array<float,2>{0.0488424376f, 0.171580717f},
-std::array<float,2>{0.586665571f, 0.940997005f},
-std::array<float,2>{0.226698786f, 0.812986016f},
-std::array<float,2>{0.692438304f, 0.00994064473f},
-std::array<float,2>{0.329598129f, 0.320816696f},
-std::array<float,2>{0.99467963f, 0.544270754f},
-std::array<float,2>{0.0659618452f, 0.609206676f},
-std::array<float,2>{0.516009867f, 0.306504875f},
-std::array<float,2>{0.403720647f, 0.117984727f},
-std::array<float,2>{0.750250816f, 0.808365822f},
-std::array<float,2>{0.260836571f, 0.888944566f},
-std::array<float,2>{0.888781846f, 0.192924485f},
-std::array<float,2>{0.143983483f, 0.446288705f},
-std::array<float,2>{0.667131424f, 0.725757241f},
-std::array<float,2>{0.368397951f, 0.517476618f},
-std::array<float,2>{0.959771216f, 0.37056157f},
-std::array<float,2>{0.211542338f, 0.0554585829f},
-std::array<float,2>{0.749486327f, 0.862232268f},
-std::array<float,2>{0.0198588092f, 0.997404754f},
-std::array<float,2>{0.607734382f, 0.150272965f},
-std::array<float,2>{0.479973525f, 0.41993171f},
-std::array<float,2>{0.846767008f, 0.677918613f},
-std::array<float,2>{0.159346059f, 0.691215813f},
-std::array<float,2>{0.639783204f, 0.499402285f},
-std::array<float,2>{0.307668597f, 0.230338424f},
-std::array<float,2>{0.92045778f, 0.909968495f},
-std::array<float,2>{0.417161107f, 0.772984207f},
-std::array<float,2>{0.802705705f, 0.0741768777f},
-std::array<float,2>{0.11908029f, 0.261636972f},
-std::array<float,2>{0.53970623f, 0.582716703f},
-std::array<float,2>{0.291276932f, 0.749569595f},
-std::array<float,2>{0.925387979f, 0.467009515f},
-std::array<float,2>{0.18665354f, 0.204179317f},
-std::array<float,2>{0.645901382f, 0.902926922f},
-std::array<float,2>{0.102484703f, 0.783209205f},
-std::array<float,2>{0.553989708f, 0.105802044f},
-std::array<float,2>{0.428893f, 0.294278622f},
-std::array<float,2>{0.790424347f, 0.617029667f},
-std::array<float,2>{0.188134775f, 0.549223661f},
-std::array<float,2>{0.73144865f, 0.343113661f},
-std::array<float,2>{0.350875676f, 0.0244737733f},
-std::array<float,2>{0.946500719f, 0.830528438f},
-std::array<float,2>{0.487914592f, 0.958166242f},
-std::array<float,2>{0.869320869f, 0.175539389f},
-std::array<float,2>{0.00945308432f, 0.403711021f},
-std::array<float,2>{0.617782176f, 0.640716732f},
-std::array<float,2>{0.3785972f, 0.567807019f},
-std::array<float,2>{0.779704869f, 0.274151742f},
-std::array<float,2>{0.084511511f, 0.0832345188f},
-std::array<float,2>{0.509449005f, 0.752755404f},
-std::array<float,2>{0.13252221f, 0.927668273f},
-std::array<float,2>{0.673042655f, 0.247276932f},
-std::array<float,2>{0.277701467f, 0.475387961f},
-std::array<float,2>{0.891831517f, 0.71155405f},
-std::array<float,2>{0.0448489562f, 0.662112951f},
-std::array<float,2>{0.570420265f, 0.4305906f},
-std::array<float,2>{0.452697039f, 0.131391838f},
-std::array<float,2>{0.824631751f, 0.978703201f},
-std::array<float,2>{0.327373624f, 0.853045523f},
-std::array<float,2>{0.97416538f, 0.0391709097f},
-std::array<float,2>{0.244000554f, 0.353404164f},
-std::array<float,2>{0.709979355f, 0.506434381f},
-std::array<float,2>{0.431242287f, 0.706185579f},
-std::array<float,2>{0.781549513f, 0.48151356f},
-std::array<float,2>{0.096223928f, 0.237861425f},
-std::array<float,2>{0.557215571f, 0.931391239f},
-std::array<float,2>{0.174811438f, 0.758340776f},
-std::array<float,2>{0.652434111f, 0.0897934884f},
-std::array<float,2>{0.285533786f, 0.273415536f},
-std::array<float,2>{0.933130026f, 0.570508599f},
-std::array<float,2>{0.00593811041f, 0.515212655f},
-std::array<float,2>{0.610210061f, 0.350383252f},
-std::array<float,2>{0.493831217f, 0.0367554612f},
-std::array<float,2>{0.862804472f, 0.849498749f},
-std::array<float,2>{0.356932253f, 0.973601222f},
-std::array<float,2>{0.941636086f, 0.136935234f},
-std::array<float,2>{0.199452624f, 0.428948194f},
-std::array<float,2>{0.724321663f, 0.667358339f},
-std::array<float,2>{0.265749335f, 0.624180198f},
-std::array<float,2>{0.904566288f, 0.283571839f},
-std::array<float,2>{0.13985531f, 0.097016573f},
-std::array<float,2>{0.68614465f, 0.794563711f},
-std::array<float,2>{0.0931771919f, 0.894104898f},
-std::array<float,2>{0.5073843f, 0.218426868f},
-std::array<float,2>{0.388402164f, 0.453237593f},
-std::array<float,2>{0.770748973f, 0.734878898f},
-std::array<float,2>{0.239499778f, 0.655508101f},
-std::array<float,2>{0.71521455f, 0.394937098f},
-std::array<float,2>{0.318517447f, 0.183611065f},
-std::array<float,2>{0.978067398f, 0.964928091f},
-std::array<float,2>{0.43858856f, 0.840409875f},
-std::array<float,2>{0.819692671f, 0.0233431738f},
-std::array<float,2>{0.0329984315f, 0.332301199f},
-std::array<float,2>{0.565179288f, 0.558852017f},
-std::array<float,2>{0.337449282f, 0.684760571f},
-std::array<float,2>{0.98808229f, 0.411683291f},
-std::array<float,2>{0.223879635f, 0.146510541f},
-std::array<float,2>{0.70197922f, 0.99112767f},
-std::array<float,2>{0.0579692684f, 0.869289041f},
-std::array<float,2>{0.583325505f, 0.0511262342f},
-std::array<float,2>{0.45570159f, 0.361534595f},
-std::array<float,2>{0.834382474f, 0.529010475f},
-std::array<float,2>{0.152141482f, 0.591697812f},
-std::array<float,2>{0.663059235f, 0.255251914f},
-std::array<float,2>{0.254355907f, 0.0660305545f},
-std::array<float,2>{0.88077569f, 0.777870297f},
-std::array<float,2>{0.392433733f, 0.918237448f},
-std::array<float,2>{0.759899497f, 0.225233346f},
-std::array<float,2>{0.0712970048f, 0.491926402f},
-std::array<float,2>{0.523998082f, 0.696426392f},
-std::array<float,2>{0.475064933f, 0.531374037f},
-std::array<float,2>{0.852815509f, 0.318663657f},
-std::array<float,2>{0.0310526304f, 0.000134234724f},
-std::array<float,2>{0.594760716f, 0.826943636f},
-std::array<float,2>{0.209265634f, 0.946774721f},
-std::array<float,2>{0.736622572f, 0.156601563f},
-std::array<float,2>{0.365243465f, 0.378168523f},
-std::array<float,2>{0.963025749f, 0.637471855f},
-std::array<float,2>{0.11077477f, 0.731973708f},
-std::array<float,2>{0.536062241f, 0.439556539f},
-std::array<float,2>{0.410867035f, 0.198098078f},
-std::array<float,2>{0.811041057f, 0.878396094f},
-std::array<float,2>{0.297712088f, 0.798665106f},
-std::array<float,2>{0.913606107f, 0.116197087f},
-std::array<float,2>{0.167430475f, 0.300685138f},
-std::array<float,2>{0.629282475f, 0.59419626f},
-std::array<float,2>{0.418216556f, 0.650867343f},
-std::array<float,2>{0.79690659f, 0.390749633f},
-std::array<float,2>{0.124705851f, 0.180214524f},
-std::array<float,2>{0.544652939f, 0.964832246f},
-std::array<float,2>{0.161526605f, 0.838089883f},
-std::array<float,2>{0.632965803f, 0.0169075858f},
-std::array<float,2>{0.311970621f, 0.330705315f},
-std::array<float,2>{0.914774954f, 0.557819426f},
-std::array<float,2>{0.0160652213f, 0.618088484f},
-std::array<float,2>{0.603154302f, 0.287067026f},
-std::array<float,2>{0.483716518f, 0.101006389f},
-std::array<float,2>{0.850723207f, 0.791861534f},
-std::array<float,2>{0.37170139f, 0.898385346f},
-std::array<float,2>{0.956437826f, 0.213730156f},
-std::array<float,2>{0.218641996f, 0.459101021f},
-std::array<float,2>{0.744935036f, 0.741465092f},
-std::array<float,2>{0.263287544f, 0.511252224f},
-std::array<float,2>{0.884539604f, 0.347224236f},
-std::array<float,2>{0.14624922f, 0.0349207036f},
-std::array<float,2>{0.671016514f, 0.844896972f},
-std::array<float,2>{0.0693938434f, 0.972315729f},
-std::array<float,2>{0.522627234f, 0.135282174f},
-std::array<float,2>{0.398995697f, 0.422837168f},
-std::array<float,2>{0.75472343f, 0.668566763f},
-std::array<float,2>{0.231679425f, 0.708906412f},
-std::array<float,2>{0.688093722f, 0.480165869f},
-std::array<float,2>{0.335291952f, 0.238579765f},
-std::array<float,2>{0.999959111f, 0.935176015f},
-std::array<float,2>{0.467659891f, 0.764507949f},
-std::array<float,2>{0.83780086f, 0.0920663327f},
-std::array<float,2>{0.0531671569f, 0.267896503f},
-std::array<float,2>{0.59064579f, 0.576951683f},
-std::array<float,2>{0.322040677f, 0.72840327f},
-std::array<float,2>{0.969739199f, 0.443100691f},
-std::array<float,2>{0.247983709f, 0.200588405f},
-std::array<float,2>{0.705711782f, 0.881142914f},
-std::array<float,2>{0.0420061834f, 0.804528892f},
-std::array<float,2>{0.574429452f, 0.112975568f},
-std::array<float,2>{0.44556424f, 0.301865518f},
-std::array<float,2>{0.820528388f, 0.599528909f},
-std::array<float,2>{0.127118453f, 0.535172582f},
-std::array<float,2>{0.677672803f, 0.314645201f},
-std::array<float,2>{0.276002377f, 0.00714903837f},
-std::array<float,2>{0.896777153f, 0.823661208f},
-std::array<float,2>{0.37972194f, 0.952172518f},
-std::array<float,2>{0.774150014f, 0.162148595f},
-std::array<float,2>{0.0802407265f, 0.379471004f},
-std::array<float,2>{0.512199879f, 0.635529101f},
-std::array<float,2>{0.490597934f, 0.587242901f},
-std::array<float,2>{0.874146938f, 0.252044797f},
-std::array<float,2>{0.0147308875f, 0.0687841401f},
-std::array<float,2>{0.623148441f, 0.775818586f},
-std::array<float,2>{0.193053037f, 0.915651977f},
-std::array<float,2>{0.726980746f, 0.222594365f},
-std::array<float,2>{0.345897198f, 0.485509753f},
-std::array<float,2>{0.950129271f, 0.700144708f},
-std::array<float,2>{0.107446492f, 0.683458745f},
-std::array<float,2>{0.549034119f, 0.409362912f},
-std::array<float,2>{0.425039083f, 0.142160922f},
-std::array<float,2>{0.795764387f, 0.987265587f},
-std::array<float,2>{0.295132101f, 0.871962249f},
-std::array<float,2>{0.926235676f, 0.0479671694f},
-std::array<float,2>{0.182566434f, 0.364071846f},
-std::array<float,2>{0.644494057f, 0.524533987f},
-std::array<float,2>{0.442510068f, 0.692453563f},
-std::array<float,2>{0.815394044f, 0.493333787f},
-std::array<float,2>{0.0389844589f, 0.231413797f},
-std::array<float,2>{0.569388747f, 0.914026499f},
-std::array<float,2>{0.234397799f, 0.76604718f},
-std::array<float,2>{0.714155495f, 0.0763971433f},
-std::array<float,2>{0.314050287f, 0.263305843f},
-std::array<float,2>{0.980663061f, 0.58033973f},
-std::array<float,2>{0.0859514028f, 0.522829175f},
-std::array<float,2>{0.500632167f, 0.3739779f},
-std::array<float,2>{0.38353017f, 0.0601806939f},
-std::array<float,2>{0.765651524f, 0.865641594f},
-std::array<float,2>{0.273091495f, 0.993457615f},
-std::array<float,2>{0.900111854f, 0.15385595f},
-std::array<float,2>{0.134290308f, 0.415370107f},
-std::array<float,2>{0.680309772f, 0.673653245f},
-std::array<float,2>{0.354403734f, 0.604511619f},
-std::array<float,2>{0.939900935f, 0.312467396f},
-std::array<float,2>{0.199212238f, 0.122348651f},
-std::array<float,2>{0.719349742f, 0.808736563f},
-std::array<float,2>{0.00338832964f, 0.883509338f},
-std::array<float,2>{0.615478516f, 0.190279022f},
-std::array<float,2>{0.499278605f, 0.452811748f},
-std::array<float,2>{0.866597891f, 0.720179081f},
-std::array<float,2>{0.177207857f, 0.628754079f},
-std::array<float,2>{0.649024844f, 0.3873595f},
-std::array<float,2>{0.282337755f, 0.166373089f},
-std::array<float,2>{0.93455404f, 0.94415319f},
-std::array<float,2>{0.434316844f, 0.816467285f},
-std::array<float,2>{0.786534488f, 0.0125312554f},
-std::array<float,2>{0.0989022925f, 0.324821115f},
-std::array<float,2>{0.560299993f, 0.541577041f},
-std::array<float,2>{0.303618848f, 0.659851909f},
-std::array<float,2>{0.908634901f, 0.437037945f},
-std::array<float,2>{0.170717791f, 0.126133427f},
-std::array<float,2>{0.62829566f, 0.98161757f},
-std::array<float,2>{0.11503467f, 0.85732162f},
-std::array<float,2>{0.534192681f, 0.0431218669f},
-std::array<float,2>{0.40972212f, 0.356942505f},
-std::array<float,2>{0.807168126f, 0.502298534f},
-std::array<float,2>{0.206380263f, 0.563901067f},
-std::array<float,2>{0.741364777f, 0.279321313f},
-std::array<float,2>{0.362746328f, 0.0815842077f},
-std::array<float,2>{0.966840029f, 0.757626534f},
-std::array<float,2>{0.470253825f, 0.922512114f},
-std::array<float,2>{0.857989013f, 0.244869202f},
-std::array<float,2>{0.0271348227f, 0.470770001f},
-std::array<float,2>{0.601107061f, 0.71778661f},
-std::array<float,2>{0.397972792f, 0.552967131f},
-std::array<float,2>{0.763637185f, 0.336151898f},
-std::array<float,2>{0.0766103566f, 0.0303909965f},
-std::array<float,2>{0.531123817f, 0.833914399f},
-std::array<float,2>{0.156056508f, 0.954691648f},
-std::array<float,2>{0.657476604f, 0.176806122f},
-std::array<float,2>{0.253636003f, 0.39876923f},
-std::array<float,2>{0.877773881f, 0.645463884f},
-std::array<float,2>{0.0624782927f, 0.744813204f},
-std::array<float,2>{0.581805706f, 0.463320911f},
-std::array<float,2>{0.45949322f, 0.208796635f},
-std::array<float,2>{0.831812799f, 0.899125397f},
-std::array<float,2>{0.340010434f, 0.786336124f},
-std::array<float,2>{0.990617454f, 0.105005786f},
-std::array<float,2>{0.220844105f, 0.290143907f},
-std::array<float,2>{0.698285699f, 0.612731516f},
-std::array<float,2>{0.476671338f, 0.676686645f},
-std::array<float,2>{0.8447631f, 0.417973131f},
-std::array<float,2>{0.0220395066f, 0.151528925f},
-std::array<float,2>{0.606178582f, 0.998707712f},
-std::array<float,2>{0.213821352f, 0.859461129f},
-std::array<float,2>{0.747204006f, 0.0577681363f},
-std::array<float,2>{0.371054292f, 0.369047523f},
-std::array<float,2>{0.957178891f, 0.517909288f},
-std::array<float,2>{0.119364589f, 0.585618317f},
-std::array<float,2>{0.542812169f, 0.258103341f},
-std::array<float,2>{0.414880246f, 0.0706187487f},
-std::array<float,2>{0.803661168f, 0.769614398f},
-std::array<float,2>{0.306332499f, 0.906502366f},
-std::array<float,2>{0.918460548f, 0.228061751f},
-std::array<float,2>{0.156872779f, 0.49765721f},
-std::array<float,2>{0.638230681f, 0.687670469f},
-std::array<float,2>{0.331779569f, 0.545972347f},
-std::array<float,2>{0.992241502f, 0.323480397f},
-std::array<float,2>{0.229772985f, 0.0090118153f},
-std::array<float,2>{0.694778025f, 0.815288842f},
-std::array<float,2>{0.0485227928f, 0.937690198f},
-std::array<float,2>{0.58952266f, 0.168356881f},
-std::array<float,2>{0.462680042f, 0.384826988f},
-std::array<float,2>{0.843075752f, 0.631620169f},
-std::array<float,2>{0.141987264f, 0.72368598f},
-std::array<float,2>{0.665819645f, 0.447631836f},
-std::array<float,2>{0.258323967f, 0.19407995f},
-std::array<float,2>{0.888586462f, 0.88849175f},
-std::array<float,2>{0.405544817f, 0.804748833f},
-std::array<float,2>{0.752104819f, 0.119585574f},
-std::array<float,2>{0.0640982911f, 0.308288246f},
-std::array<float,2>{0.51792264f, 0.606595755f},
-std::array<float,2>{0.279658169f, 0.714392364f},
-std::array<float,2>{0.893419683f, 0.474052459f},
-std::array<float,2>{0.130372599f, 0.24919866f},
-std::array<float,2>{0.67521745f, 0.928736746f},
-std::array<float,2>{0.0836094543f, 0.750394523f},
-std::array<float,2>{0.51020956f, 0.0841385648f},
-std::array<float,2>{0.376767665f, 0.275440305f},
-std::array<float,2>{0.777387917f, 0.569694102f},
-std::array<float,2>{0.244356066f, 0.504175782f},
-std::array<float,2>{0.707729638f, 0.355056673f},
-std::array<float,2>{0.325082123f, 0.041863557f},
-std::array<float,2>{0.975673378f, 0.854481518f},
-std::array<float,2>{0.449570775f, 0.977787435f},
-std::array<float,2>{0.82798171f, 0.130627647f},
-std::array<float,2>{0.0467682295f, 0.433318734f},
-std::array<float,2>{0.57238251f, 0.66050446f},
-std::array<float,2>{0.427466869f, 0.614239991f},
-std::array<float,2>{0.791588843f, 0.296831608f},
-std::array<float,2>{0.103525974f, 0.108266674f},
-std::array<float,2>{0.551923394f, 0.78148663f},
-std::array<float,2>{0.185426682f, 0.90546447f},
-std::array<float,2>{0.648422241f, 0.206437141f},
-std::array<float,2>{0.290302068f, 0.465682477f},
-std::array<float,2>{0.923234224f, 0.747073174f},
-std::array<float,2>{0.0116424803f, 0.643098474f},
-std::array<float,2>{0.620093584f, 0.404545248f},
-std::array<float,2>{0.485221773f, 0.173465177f},
-std::array<float,2>{0.867839277f, 0.959964871f},
-std::array<float,2>{0.349355936f, 0.829605937f},
-std::array<float,2>{0.949022114f, 0.0256524496f},
-std::array<float,2>{0.191388652f, 0.341723263f},
-std::array<float,2>{0.733745933f, 0.548263729f},
-std::array<float,2>{0.390297472f, 0.737493515f},
-std::array<float,2>{0.771866381f, 0.455122918f},
-std::array<float,2>{0.0915988162f, 0.21522288f},
-std::array<float,2>{0.505704224f, 0.892573833f},
-std::array<float,2>{0.136942446f, 0.795237899f},
-std::array<float,2>{0.68483609f, 0.0953320116f},
-std::array<float,2>{0.268064559f, 0.281384826f},
-std::array<float,2>{0.904138744f, 0.622551203f},
-std::array<float,2>{0.0346844345f, 0.561111808f},
-std::array<float,2>{0.564001858f, 0.335071832f},
-std::array<float,2>{0.440476298f, 0.0211512558f},
-std::array<float,2>{0.818314731f, 0.842441797f},
-std::array<float,2>{0.316471457f, 0.967026532f},
-std::array<float,2>{0.978928864f, 0.186628655f},
-std::array<float,2>{0.24147141f, 0.397145748f},
-std::array<float,2>{0.717251062f, 0.654133499f},
-std::array<float,2>{0.287397414f, 0.572363555f},
-std::array<float,2>{0.931299508f, 0.269873083f},
-std::array<float,2>{0.171914041f, 0.0877648145f},
-std::array<float,2>{0.654995739f, 0.760148764f},
-std::array<float,2>{0.094383873f, 0.933525145f},
-std::array<float,2>{0.555607557f, 0.235943258f},
-std::array<float,2>{0.431944132f, 0.483489454f},
-std::array<float,2>{0.784769714f, 0.704091191f},
-std::array<float,2>{0.202261627f, 0.664079845f},
-std::array<float,2>{0.724716365f, 0.425974011f},
-std::array<float,2>{0.357688844f, 0.138818339f},
-std::array<float,2>{0.944504499f, 0.974661827f},
-std::array<float,2>{0.49417755f, 0.849648714f},
-std::array<float,2>{0.861161113f, 0.0384081826f},
-std::array<float,2>{0.00476917438f, 0.34774667f},
-std::array<float,2>{0.612851441f, 0.512334168f},
-std::array<float,2>{0.364812762f, 0.639217615f},
-std::array<float,2>{0.961848557f, 0.376522779f},
-std::array<float,2>{0.207878217f, 0.158891305f},
-std::array<float,2>{0.735417008f, 0.947761834f},
-std::array<float,2>{0.0280202013f, 0.826007485f},
-std::array<float,2>{0.597421169f, 0.00217390433f},
-std::array<float,2>{0.474521577f, 0.318247676f},
-std::array<float,2>{0.855405569f, 0.535079718f},
-std::array<float,2>{0.164290264f, 0.596664488f},
-std::array<float,2>{0.632619262f, 0.298095286f},
-std::array<float,2>{0.299627155f, 0.113921016f},
-std::array<float,2>{0.911766887f, 0.799187839f},
-std::array<float,2>{0.412549615f, 0.875760257f},
-std::array<float,2>{0.809670269f, 0.196353212f},
-std::array<float,2>{0.112672217f, 0.43843469f},
-std::array<float,2>{0.537872076f, 0.73402375f},
-std::array<float,2>{0.454478979f, 0.530630529f},
-std::array<float,2>{0.833907723f, 0.36089012f},
-std::array<float,2>{0.0559453145f, 0.0545035526f},
-std::array<float,2>{0.583985686f, 0.867243886f},
-std::array<float,2>{0.225535437f, 0.988423109f},
-std::array<float,2>{0.700822949f, 0.145417213f},
-std::array<float,2>{0.339278758f, 0.413412273f},
-std::array<float,2>{0.985923648f, 0.687389612f},
-std::array<float,2>{0.0729128942f, 0.698761225f},
-std::array<float,2>{0.526722491f, 0.489168495f},
-std::array<float,2>{0.393509448f, 0.223701537f},
-std::array<float,2>{0.759651423f, 0.921340585f},
-std::array<float,2>{0.257232577f, 0.781137645f},
-std::array<float,2>{0.881081223f, 0.0630927086f},
-std::array<float,2>{0.149330184f, 0.256611258f},
-std::array<float,2>{0.661840081f, 0.593586385f},
-std::array<float,2>{0.409344465f, 0.656791687f},
-std::array<float,2>{0.806905866f, 0.434660256f},
-std::array<float,2>{0.114462875f, 0.127265394f},
-std::array<float,2>{0.534701467f, 0.983653486f},
-std::array<float,2>{0.170028165f, 0.858888745f},
-std::array<float,2>{0.628647923f, 0.0457258448f},
-std::array<float,2>{0.303152472f, 0.358336508f},
-std::array<float,2>{0.908710778f, 0.501564741f},
-std::array<float,2>{0.0266109463f, 0.565652132f},
-std::array<float,2>{0.600749969f, 0.279124618f},
-std::array<float,2>{0.470045328f, 0.0787299499f},
-std::array<float,2>{0.857675493f, 0.753963649f},
-std::array<float,2>{0.363269329f, 0.925199568f},
-std::array<float,2>{0.967623234f, 0.242939398f},
-std::array<float,2>{0.206631273f, 0.469679117f},
-std::array<float,2>{0.741869509f, 0.715636849f},
-std::array<float,2>{0.253132612f, 0.55130744f},
-std::array<float,2>{0.877347767f, 0.339684844f},
-std::array<float,2>{0.155441597f, 0.0288979616f},
-std::array<float,2>{0.658068061f, 0.835265517f},
-std::array<float,2>{0.0768595412f, 0.955177188f},
-std::array<float,2>{0.530381441f, 0.178730056f},
-std::array<float,2>{0.397795528f, 0.402106404f},
-std::array<float,2>{0.762722969f, 0.646938384f},
-std::array<float,2>{0.221211165f, 0.742814481f},
-std::array<float,2>{0.699147463f, 0.461743474f},
-std::array<float,2>{0.340712875f, 0.210377395f},
-std::array<float,2>{0.991024315f, 0.901386082f},
-std::array<float,2>{0.459369153f, 0.787965953f},
-std::array<float,2>{0.831212461f, 0.102939397f},
-std::array<float,2>{0.061942257f, 0.292676359f},
-std::array<float,2>{0.581474006f, 0.610111177f},
-std::array<float,2>{0.313524097f, 0.695011914f},
-std::array<float,2>{0.981123269f, 0.49504751f},
-std::array<float,2>{0.235014528f, 0.233775318f},
-std::array<float,2>{0.714827716f, 0.911281168f},
-std::array<float,2>{0.0384307802f, 0.769200921f},
-std::array<float,2>{0.570204675f, 0.0745404437f},
-std::array<float,2>{0.443105072f, 0.264078885f},
-std::array<float,2>{0.814687014f, 0.579781115f},
-std::array<float,2>{0.134074524f, 0.520050883f},
-std::array<float,2>{0.679694057f, 0.372213364f},
-std::array<float,2>{0.272729039f, 0.0623315684f},
-std::array<float,2>{0.899597406f, 0.863315701f},
-std::array<float,2>{0.383222342f, 0.995889068f},
-std::array<float,2>{0.766148984f, 0.155561566f},
-std::array<float,2>{0.0868776143f, 0.416105866f},
-std::array<float,2>{0.500400007f, 0.674521804f},
-std::array<float,2>{0.49995321f, 0.602954745f},
-std::array<float,2>{0.867145419f, 0.309066474f},
-std::array<float,2>{0.00349743734f, 0.123348393f},
-std::array<float,2>{0.615972757f, 0.812470615f},
-std::array<float,2>{0.19868353f, 0.885628521f},
-std::array<float,2>{0.719019711f, 0.188622519f},
-std::array<float,2>{0.353866816f, 0.451080889f},
-std::array<float,2>{0.940052867f, 0.720750809f},
-std::array<float,2>{0.0995836854f, 0.625911772f},
-std::array<float,2>{0.559973717f, 0.389226824f},
-std::array<float,2>{0.433892965f, 0.165814787f},
-std::array<float,2>{0.786713362f, 0.941457152f},
-std::array<float,2>{0.282791853f, 0.818422377f},
-std::array<float,2>{0.933868945f, 0.014155901f},
-std::array<float,2>{0.177727014f, 0.326830417f},
-std::array<float,2>{0.648530781f, 0.540005565f},
-std::array<float,2>{0.446180224f, 0.728692353f},
-std::array<float,2>{0.821139932f, 0.444179624f},
-std::array<float,2>{0.0426984355f, 0.202940151f},
-std::array<float,2>{0.574924111f, 0.87899822f},
-std::array<float,2>{0.247434914f, 0.801781535f},
-std::array<float,2>{0.705468476f, 0.109560929f},
-std::array<float,2>{0.321764231f, 0.304167747f},
-std::array<float,2>{0.970270276f, 0.599946499f},
-std::array<float,2>{0.081028007f, 0.538252294f},
-std::array<float,2>{0.512412548f, 0.312671483f},
-std::array<float,2>{0.378922373f, 0.00572056929f},
-std::array<float,2>{0.773540854f, 0.820538878f},
-std::array<float,2>{0.275428057f, 0.950330079f},
-std::array<float,2>{0.897201002f, 0.160523415f},
-std::array<float,2>{0.12754041f, 0.381328106f},
-std::array<float,2>{0.677029908f, 0.63438338f},
-std::array<float,2>{0.3463687f, 0.588784158f},
-std::array<float,2>{0.949401796f, 0.250620306f},
-std::array<float,2>{0.192742363f, 0.0669260696f},
-std::array<float,2>{0.727363765f, 0.773464203f},
-std::array<float,2>{0.0155563205f, 0.917763054f},
-std::array<float,2>{0.623881757f, 0.220412135f},
-std::array<float,2>{0.491137981f, 0.486742914f},
-std::array<float,2>{0.874879658f, 0.702844441f},
-std::array<float,2>{0.182054341f, 0.681365788f},
-std::array<float,2>{0.644034803f, 0.408079684f},
-std::array<float,2>{0.295537442f, 0.143792301f},
-std::array<float,2>{0.926667154f, 0.985131502f},
-std::array<float,2>{0.425578654f, 0.873089612f},
-std::array<float,2>{0.795178115f, 0.0496970117f},
-std::array<float,2>{0.108062014f, 0.365616262f},
-std::array<float,2>{0.549520552f, 0.525754511f},
-std::array<float,2>{0.312166661f, 0.649428964f},
-std::array<float,2>{0.914486945f, 0.394482374f},
-std::array<float,2>{0.161824405f, 0.181850389f},
-std::array<float,2>{0.633554578f, 0.962185085f},
-std::array<float,2>{0.124035954f, 0.836061597f},
-std::array<float,2>{0.544252574f, 0.0192387495f},
-std::array<float,2>{0.418777227f, 0.328799248f},
-std::array<float,2>{0.797548115f, 0.556022942f},
-std::array<float,2>{0.218100056f, 0.619596183f},
-std::array<float,2>{0.744153857f, 0.288080394f},
-std::array<float,2>{0.371493518f, 0.0981051624f},
-std::array<float,2>{0.956610203f, 0.789554894f},
-std::array<float,2>{0.484306544f, 0.895328701f},
-std::array<float,2>{0.851206183f, 0.212385625f},
-std::array<float,2>{0.0162339937f, 0.457832217f},
-std::array<float,2>{0.602618456f, 0.739185631f},
-std::array<float,2>{0.39844802f, 0.50908494f},
-std::array<float,2>{0.754393876f, 0.345156938f},
-std::array<float,2>{0.0699224919f, 0.0321222134f},
-std::array<float,2>{0.523428917f, 0.846363485f},
-std::array<float,2>{0.14554359f, 0.969165504f},
-std::array<float,2>{0.671462417f, 0.133941218f},
-std::array<float,2>{0.26305151f, 0.424023807f},
-std::array<float,2>{0.883867025f, 0.671048462f},
-std::array<float,2>{0.0534945913f, 0.710325539f},
-std::array<float,2>{0.590331197f, 0.478429347f},
-std::array<float,2>{0.466919273f, 0.241446733f},
-std::array<float,2>{0.836973906f, 0.936685801f},
-std::array<float,2>{0.335789919f, 0.76325202f},
-std::array<float,2>{0.999457955f, 0.0900452882f},
-std::array<float,2>{0.232130006f, 0.267222553f},
-std::array<float,2>{0.687913537f, 0.574424267f},
-std::array<float,2>{0.473715335f, 0.63698256f},
-std::array<float,2>{0.854782403f, 0.378819317f},
-std::array<float,2>{0.0276692808f, 0.15714933f},
-std::array<float,2>{0.596926868f, 0.946860373f},
-std::array<float,2>{0.20749788f, 0.826210618f},
-std::array<float,2>{0.735889375f, 0.000572463381f},
-std::array<float,2>{0.364682674f, 0.319093496f},
-std::array<float,2>{0.961140871f, 0.532200873f},
-std::array<float,2>{0.112959675f, 0.594635725f},
-std::array<float,2>{0.537235618f, 0.300052315f},
-std::array<float,2>{0.412969947f, 0.115541831f},
-std::array<float,2>{0.810421944f, 0.798118591f},
-std::array<float,2>{0.298891157f, 0.878697991f},
-std::array<float,2>{0.911138594f, 0.197491929f},
-std::array<float,2>{0.164591476f, 0.439960986f},
-std::array<float,2>{0.632291675f, 0.731727362f},
-std::array<float,2>{0.339388013f, 0.528492033f},
-std::array<float,2>{0.985375702f, 0.362206489f},
-std::array<float,2>{0.22483024f, 0.0514022745f},
-std::array<float,2>{0.700458765f, 0.870009065f},
-std::array<float,2>{0.0565619729f, 0.990570962f},
-std::array<float,2>{0.584834635f, 0.147441313f},
-std::array<float,2>{0.454774588f, 0.411167532f},
-std::array<float,2>{0.833027601f, 0.685292959f},
-std::array<float,2>{0.14859277f, 0.697145879f},
-std::array<float,2>{0.661270916f, 0.491584033f},
-std::array<float,2>{0.25737083f, 0.224852011f},
-std::array<float,2>{0.881605387f, 0.918832242f},
-std::array<float,2>{0.392931789f, 0.777794898f},
-std::array<float,2>{0.759223044f, 0.0655516312f},
-std::array<float,2>{0.0723491311f, 0.25538373f},
-std::array<float,2>{0.527264476f, 0.590997398f},
-std::array<float,2>{0.268532425f, 0.734457791f},
-std::array<float,2>{0.903477848f, 0.453926831f},
-std::array<float,2>{0.13731271f, 0.218076542f},
-std::array<float,2>{0.685286462f, 0.893636346f},
-std::array<float,2>{0.0912441462f, 0.794191301f},
-std::array<float,2>{0.504926801f, 0.0976177379f},
-std::array<float,2>{0.389710575f, 0.283936501f},
-std::array<float,2>{0.772194088f, 0.624810934f},
-std::array<float,2>{0.241919369f, 0.559430361f},
-std::array<float,2>{0.717475593f, 0.332797199f},
-std::array<float,2>{0.317353994f, 0.0225673206f},
-std::array<float,2>{0.979141355f, 0.840244949f},
-std::array<float,2>{0.441310376f, 0.965725601f},
-std::array<float,2>{0.817536354f, 0.18435213f},
-std::array<float,2>{0.0343303382f, 0.395504594f},
-std::array<float,2>{0.563935697f, 0.655877948f},
-std::array<float,2>{0.432300687f, 0.570897996f},
-std::array<float,2>{0.784349382f, 0.27269879f},
-std::array<float,2>{0.09378241f, 0.0889362022f},
-std::array<float,2>{0.554714084f, 0.758066595f},
-std::array<float,2>{0.172491148f, 0.930687129f},
-std::array<float,2>{0.654634535f, 0.237772778f},
-std::array<float,2>{0.287801355f, 0.481995553f},
-std::array<float,2>{0.931144714f, 0.707000971f},
-std::array<float,2>{0.00426392816f, 0.667838693f},
-std::array<float,2>{0.612373114f, 0.429546565f},
-std::array<float,2>{0.494758993f, 0.137537003f},
-std::array<float,2>{0.860603571f, 0.972705364f},
-std::array<float,2>{0.357924938f, 0.848634422f},
-std::array<float,2>{0.945211351f, 0.0361337215f},
-std::array<float,2>{0.202847108f, 0.3497774f},
-std::array<float,2>{0.725553095f, 0.514852166f},
-std::array<float,2>{0.376177341f, 0.711147308f},
-std::array<float,2>{0.778198123f, 0.474968255f},
-std::array<float,2>{0.0832581371f, 0.247976705f},
-std::array<float,2>{0.510672629f, 0.926971138f},
-std::array<float,2>{0.129933864f, 0.752049685f},
-std::array<float,2>{0.675390601f, 0.0836742297f},
-std::array<float,2>{0.280217052f, 0.273563564f},
-std::array<float,2>{0.893016696f, 0.568087161f},
-std::array<float,2>{0.0460419804f, 0.505899012f},
-std::array<float,2>{0.573181987f, 0.352947772f},
-std::array<float,2>{0.450066656f, 0.0397503152f},
-std::array<float,2>{0.827424526f, 0.852807939f},
-std::array<float,2>{0.324594915f, 0.979189813f},
-std::array<float,2>{0.976476789f, 0.130915448f},
-std::array<float,2>{0.24494642f, 0.430025429f},
-std::array<float,2>{0.707113624f, 0.662679553f},
-std::array<float,2>{0.290852755f, 0.616631508f},
-std::array<float,2>{0.923546314f, 0.294580013f},
-std::array<float,2>{0.184927538f, 0.106359206f},
-std::array<float,2>{0.647586048f, 0.784089625f},
-std::array<float,2>{0.104106471f, 0.902735054f},
-std::array<float,2>{0.552502692f, 0.204874694f},
-std::array<float,2>{0.426823646f, 0.467541516f},
-std::array<float,2>{0.791372359f, 0.749248326f},
-std::array<float,2>{0.190685034f, 0.64140588f},
-std::array<float,2>{0.73429507f, 0.404015154f},
-std::array<float,2>{0.348884314f, 0.175288349f},
-std::array<float,2>{0.948670506f, 0.958943129f},
-std::array<float,2>{0.484590948f, 0.830981553f},
-std::array<float,2>{0.867672384f, 0.0253237188f},
-std::array<float,2>{0.0108961985f, 0.343475103f},
-std::array<float,2>{0.619371593f, 0.549414098f},
-std::array<float,2>{0.370394379f, 0.678405046f},
-std::array<float,2>{0.957648396f, 0.420430928f},
-std::array<float,2>{0.213097781f, 0.149623066f},
-std::array<float,2>{0.747799516f, 0.997880995f},
-std::array<float,2>{0.0215593651f, 0.861706257f},
-std::array<float,2>{0.605636895f, 0.0548771173f},
-std::array<float,2>{0.477485418f, 0.37063098f},
-std::array<float,2>{0.845253468f, 0.517006397f},
-std::array<float,2>{0.156617343f, 0.582339883f},
-std::array<float,2>{0.638133705f, 0.261069328f},
-std::array<float,2>{0.305793285f, 0.0734173954f},
-std::array<float,2>{0.918091118f, 0.772856534f},
-std::array<float,2>{0.414457828f, 0.909592271f},
-std::array<float,2>{0.802818358f, 0.229946196f},
-std::array<float,2>{0.119682297f, 0.499796331f},
-std::array<float,2>{0.542359054f, 0.690633535f},
-std::array<float,2>{0.461939603f, 0.544605136f},
-std::array<float,2>{0.84351635f, 0.320343077f},
-std::array<float,2>{0.0480268262f, 0.010716863f},
-std::array<float,2>{0.589190602f, 0.81320703f},
-std::array<float,2>{0.230293572f, 0.940494955f},
-std::array<float,2>{0.695125878f, 0.171206921f},
-std::array<float,2>{0.331520796f, 0.383547574f},
-std::array<float,2>{0.993010759f, 0.629276693f},
-std::array<float,2>{0.0635082349f, 0.726160347f},
-std::array<float,2>{0.518157482f, 0.445508122f},
-std::array<float,2>{0.405930281f, 0.192856818f},
-std::array<float,2>{0.752578259f, 0.889420927f},
-std::array<float,2>{0.257907778f, 0.807787657f},
-std::array<float,2>{0.887982607f, 0.11764434f},
-std::array<float,2>{0.142463833f, 0.305953592f},
-std::array<float,2>{0.665331006f, 0.608596325f},
-std::array<float,2>{0.395438015f, 0.644744694f},
-std::array<float,2>{0.764862537f, 0.399224788f},
-std::array<float,2>{0.0748148486f, 0.177517325f},
-std::array<float,2>{0.528095663f, 0.954398572f},
-std::array<float,2>{0.152785838f, 0.833463609f},
-std::array<float,2>{0.658226073f, 0.0310904589f},
-std::array<float,2>{0.251158506f, 0.336745024f},
-std::array<float,2>{0.876149118f, 0.553322792f},
-std::array<float,2>{0.0600128286f, 0.613236189f},
-std::array<float,2>{0.579396009f, 0.290841281f},
-std::array<float,2>{0.457716346f, 0.104497045f},
-std::array<float,2>{0.829958797f, 0.786925375f},
-std::array<float,2>{0.34216702f, 0.898483276f},
-std::array<float,2>{0.989823759f, 0.208053231f},
-std::array<float,2>{0.219239846f, 0.463855565f},
-std::array<float,2>{0.696807086f, 0.74439466f},
-std::array<float,2>{0.302271724f, 0.502741277f},
-std::array<float,2>{0.907951057f, 0.356879741f},
-std::array<float,2>{0.169454053f, 0.0436850637f},
-std::array<float,2>{0.62606436f, 0.856867373f},
-std::array<float,2>{0.115903877f, 0.98237586f},
-std::array<float,2>{0.532669663f, 0.126646131f},
-std::array<float,2>{0.406908214f, 0.436746866f},
-std::array<float,2>{0.806630909f, 0.659424424f},
-std::array<float,2>{0.203296885f, 0.71838963f},
-std::array<float,2>{0.738910139f, 0.471430451f},
-std::array<float,2>{0.360295951f, 0.244530126f},
-std::array<float,2>{0.965953231f, 0.922228754f},
-std::array<float,2>{0.472459078f, 0.757142246f},
-std::array<float,2>{0.855486512f, 0.0812368318f},
-std::array<float,2>{0.0251159128f, 0.280091524f},
-std::array<float,2>{0.599187851f, 0.564068854f},
-std::array<float,2>{0.352681816f, 0.720530927f},
-std::array<float,2>{0.937580824f, 0.452592045f},
-std::array<float,2>{0.19544749f, 0.189928308f},
-std::array<float,2>{0.720797122f, 0.883098245f},
-std::array<float,2>{0.000628278067f, 0.809396267f},
-std::array<float,2>{0.614633977f, 0.122626647f},
-std::array<float,2>{0.497931421f, 0.312004894f},
-std::array<float,2>{0.863664746f, 0.605391502f},
-std::array<float,2>{0.178944126f, 0.541038394f},
-std::array<float,2>{0.650844514f, 0.324705929f},
-std::array<float,2>{0.28373313f, 0.0120057538f},
-std::array<float,2>{0.937208295f, 0.817227423f},
-std::array<float,2>{0.436665654f, 0.943387866f},
-std::array<float,2>{0.78804034f, 0.166648492f},
-std::array<float,2>{0.101048693f, 0.386724144f},
-std::array<float,2>{0.561724424f, 0.628011823f},
-std::array<float,2>{0.443691164f, 0.580712438f},
-std::array<float,2>{0.814367771f, 0.263086736f},
-std::array<float,2>{0.0357291549f, 0.0770853013f},
-std::array<float,2>{0.568184674f, 0.766446412f},
-std::array<float,2>{0.237386987f, 0.913210034f},
-std::array<float,2>{0.711654782f, 0.230732441f},
-std::array<float,2>{0.314484864f, 0.493767381f},
-std::array<float,2>{0.982482433f, 0.693164825f},
-std::array<float,2>{0.0892062634f, 0.673300028f},
-std::array<float,2>{0.503645182f, 0.416007549f},
-std::array<float,2>{0.386604607f, 0.153757319f},
-std::array<float,2>{0.768653095f, 0.99367708f},
-std::array<float,2>{0.271307558f, 0.865820229f},
-std::array<float,2>{0.901851892f, 0.0597172491f},
-std::array<float,2>{0.13605988f, 0.373235703f},
-std::array<float,2>{0.682912111f, 0.523354292f},
-std::array<float,2>{0.489461809f, 0.699372649f},
-std::array<float,2>{0.871308565f, 0.486032903f},
-std::array<float,2>{0.0119061638f, 0.221704796f},
-std::array<float,2>{0.621257007f, 0.915349662f},
-std::array<float,2>{0.194345668f, 0.77600503f},
-std::array<float,2>{0.729058623f, 0.0692350417f},
-std::array<float,2>{0.34519282f, 0.252579421f},
-std::array<float,2>{0.952639163f, 0.587549508f},
-std::array<float,2>{0.10725937f, 0.525125504f},
-std::array<float,2>{0.547779918f, 0.363326997f},
-std::array<float,2>{0.422311217f, 0.0483813733f},
-std::array<float,2>{0.793633699f, 0.871412873f},
-std::array<float,2>{0.294864535f, 0.986374021f},
-std::array<float,2>{0.928469479f, 0.141736537f},
-std::array<float,2>{0.180804014f, 0.40974018f},
-std::array<float,2>{0.641932905f, 0.68297261f},
-std::array<float,2>{0.323355258f, 0.598838747f},
-std::array<float,2>{0.970912516f, 0.302618235f},
-std::array<float,2>{0.249044076f, 0.112744227f},
-std::array<float,2>{0.703977823f, 0.803957582f},
-std::array<float,2>{0.0396018848f, 0.88135463f},
-std::array<float,2>{0.576324999f, 0.200740233f},
-std::array<float,2>{0.448301166f, 0.442447811f},
-std::array<float,2>{0.822587311f, 0.727726579f},
-std::array<float,2>{0.126486599f, 0.634921908f},
-std::array<float,2>{0.67822051f, 0.378907472f},
-std::array<float,2>{0.273841977f, 0.162866801f},
-std::array<float,2>{0.894756556f, 0.952957094f},
-std::array<float,2>{0.381723702f, 0.824108839f},
-std::array<float,2>{0.777079344f, 0.00744459033f},
-std::array<float,2>{0.0784726366f, 0.315014601f},
-std::array<float,2>{0.513859689f, 0.535945117f},
-std::array<float,2>{0.264713973f, 0.668304205f},
-std::array<float,2>{0.885938466f, 0.421966285f},
-std::array<float,2>{0.147844002f, 0.134829059f},
-std::array<float,2>{0.669344187f, 0.972023427f},
-std::array<float,2>{0.0675801039f, 0.845702946f},
-std::array<float,2>{0.520562291f, 0.0342965834f},
-std::array<float,2>{0.401150167f, 0.346787035f},
-std::array<float,2>{0.757633865f, 0.51093924f},
-std::array<float,2>{0.233275667f, 0.576604128f},
-std::array<float,2>{0.690891147f, 0.268366456f},
-std::array<float,2>{0.333875895f, 0.0927078426f},
-std::array<float,2>{0.996113539f, 0.764008939f},
-std::array<float,2>{0.465316743f, 0.934927285f},
-std::array<float,2>{0.837930679f, 0.239156693f},
-std::array<float,2>{0.0515134633f, 0.479706734f},
-std::array<float,2>{0.592618048f, 0.708434761f},
-std::array<float,2>{0.420964032f, 0.558178484f},
-std::array<float,2>{0.800657809f, 0.330525428f},
-std::array<float,2>{0.121465631f, 0.017416453f},
-std::array<float,2>{0.545681f, 0.838749528f},
-std::array<float,2>{0.163289115f, 0.96386832f},
-std::array<float,2>{0.63528043f, 0.180159181f},
-std::array<float,2>{0.30924964f, 0.391134918f},
-std::array<float,2>{0.916980743f, 0.650907755f},
-std::array<float,2>{0.0180579126f, 0.742134333f},
-std::array<float,2>{0.605138719f, 0.459587604f},
-std::array<float,2>{0.482380688f, 0.21308583f},
-std::array<float,2>{0.848826766f, 0.897733212f},
-std::array<float,2>{0.37413466f, 0.791016817f},
-std::array<float,2>{0.955026686f, 0.101299599f},
-std::array<float,2>{0.216022372f, 0.286578536f},
-std::array<float,2>{0.74322927f, 0.617657304f},
-std::array<float,2>{0.45517987f, 0.686620235f},
-std::array<float,2>{0.834646523f, 0.413770139f},
-std::array<float,2>{0.0585326143f, 0.144959033f},
-std::array<float,2>{0.583557546f, 0.988826454f},
-std::array<float,2>{0.224417031f, 0.868008316f},
-std::array<float,2>{0.701540709f, 0.0540914163f},
-std::array<float,2>{0.337212563f, 0.360351712f},
-std::array<float,2>{0.987323999f, 0.53097862f},
-std::array<float,2>{0.0722243041f, 0.593060911f},
-std::array<float,2>{0.523485243f, 0.256311119f},
-std::array<float,2>{0.391788125f, 0.0629591197f},
-std::array<float,2>{0.760347724f, 0.780381918f},
-std::array<float,2>{0.25474298f, 0.921807289f},
-std::array<float,2>{0.880148709f, 0.224285319f},
-std::array<float,2>{0.151429936f, 0.488720298f},
-std::array<float,2>{0.662301123f, 0.698247135f},
-std::array<float,2>{0.366025746f, 0.534353256f},
-std::array<float,2>{0.963791251f, 0.317856789f},
-std::array<float,2>{0.209872201f, 0.00253190473f},
-std::array<float,2>{0.736908674f, 0.825654924f},
-std::array<float,2>{0.0306045301f, 0.947747409f},
-std::array<float,2>{0.595470846f, 0.15826124f},
-std::array<float,2>{0.475457549f, 0.376031846f},
-std::array<float,2>{0.853212118f, 0.638816237f},
-std::array<float,2>{0.167498216f, 0.733505547f},
-std::array<float,2>{0.629779458f, 0.437608629f},
-std::array<float,2>{0.297330439f, 0.196829587f},
-std::array<float,2>{0.913284123f, 0.875032961f},
-std::array<float,2>{0.410482228f, 0.799401522f},
-std::array<float,2>{0.810747504f, 0.113721408f},
-std::array<float,2>{0.111039512f, 0.298488885f},
-std::array<float,2>{0.535591602f, 0.595867217f},
-std::array<float,2>{0.285966337f, 0.703372777f},
-std::array<float,2>{0.932685196f, 0.484004766f},
-std::array<float,2>{0.175614566f, 0.235771686f},
-std::array<float,2>{0.652921498f, 0.93303287f},
-std::array<float,2>{0.0961031839f, 0.760475814f},
-std::array<float,2>{0.556752205f, 0.0870886818f},
-std::array<float,2>{0.431081593f, 0.270450175f},
-std::array<float,2>{0.781922936f, 0.57294625f},
-std::array<float,2>{0.199780971f, 0.512198389f},
-std::array<float,2>{0.723672152f, 0.348561794f},
-std::array<float,2>{0.357358992f, 0.038925916f},
-std::array<float,2>{0.942346036f, 0.85042268f},
-std::array<float,2>{0.493576944f, 0.975272238f},
-std::array<float,2>{0.862625539f, 0.139453858f},
-std::array<float,2>{0.00637569418f, 0.426383555f},
-std::array<float,2>{0.609638929f, 0.664993942f},
-std::array<float,2>{0.387848616f, 0.622708857f},
-std::array<float,2>{0.771211803f, 0.281740934f},
-std::array<float,2>{0.0936999843f, 0.0951634347f},
-std::array<float,2>{0.50691551f, 0.795545638f},
-std::array<float,2>{0.140169635f, 0.891813099f},
-std::array<float,2>{0.685985863f, 0.215534538f},
-std::array<float,2>{0.266484559f, 0.455567688f},
-std::array<float,2>{0.904861152f, 0.737959325f},
-std::array<float,2>{0.0325636193f, 0.653361797f},
-std::array<float,2>{0.564513028f, 0.396635354f},
-std::array<float,2>{0.439095229f, 0.187353179f},
-std::array<float,2>{0.820186436f, 0.96736753f},
-std::array<float,2>{0.319064111f, 0.842197895f},
-std::array<float,2>{0.977769732f, 0.0209408291f},
-std::array<float,2>{0.239797354f, 0.335455477f},
-std::array<float,2>{0.715633452f, 0.560614109f},
-std::array<float,2>{0.429599106f, 0.747795463f},
-std::array<float,2>{0.790759087f, 0.465026885f},
-std::array<float,2>{0.101944529f, 0.206914738f},
-std::array<float,2>{0.554335773f, 0.905810654f},
-std::array<float,2>{0.18704477f, 0.782004535f},
-std::array<float,2>{0.646094441f, 0.107892461f},
-std::array<float,2>{0.291749924f, 0.296041459f},
-std::array<float,2>{0.92480886f, 0.613654435f},
-std::array<float,2>{0.00892617647f, 0.548493147f},
-std::array<float,2>{0.617536545f, 0.341032922f},
-std::array<float,2>{0.48769623f, 0.0262425225f},
-std::array<float,2>{0.869752109f, 0.829574466f},
-std::array<float,2>{0.351351351f, 0.960589886f},
-std::array<float,2>{0.947097242f, 0.172938049f},
-std::array<float,2>{0.187880635f, 0.404834092f},
-std::array<float,2>{0.732053697f, 0.642957211f},
-std::array<float,2>{0.278244257f, 0.570111752f},
-std::array<float,2>{0.892316937f, 0.276298791f},
-std::array<float,2>{0.131944388f, 0.0846218839f},
-std::array<float,2>{0.673703432f, 0.750490844f},
-std::array<float,2>{0.0843741596f, 0.929338455f},
-std::array<float,2>{0.509250462f, 0.249940485f},
-std::array<float,2>{0.378394336f, 0.474146813f},
-std::array<float,2>{0.779857039f, 0.714309514f},
-std::array<float,2>{0.243474618f, 0.661076784f},
-std::array<float,2>{0.710508227f, 0.432991683f},
-std::array<float,2>{0.328067273f, 0.129945606f},
-std::array<float,2>{0.973927557f, 0.978393078f},
-std::array<float,2>{0.452177167f, 0.853789866f},
-std::array<float,2>{0.825084805f, 0.0411311761f},
-std::array<float,2>{0.0443693846f, 0.354646772f},
-std::array<float,2>{0.570976794f, 0.504599214f},
-std::array<float,2>{0.329271317f, 0.630947292f},
-std::array<float,2>{0.994283617f, 0.385575265f},
-std::array<float,2>{0.227305919f, 0.168625265f},
-std::array<float,2>{0.693130434f, 0.938056052f},
-std::array<float,2>{0.0495451093f, 0.8146348f},
-std::array<float,2>{0.586192846f, 0.00967162196f},
-std::array<float,2>{0.464069873f, 0.324168742f},
-std::array<float,2>{0.841303229f, 0.546511471f},
-std::array<float,2>{0.144452006f, 0.607402384f},
-std::array<float,2>{0.667715549f, 0.308014274f},
-std::array<float,2>{0.261259824f, 0.119752549f},
-std::array<float,2>{0.889378309f, 0.805443525f},
-std::array<float,2>{0.404028118f, 0.887716234f},
-std::array<float,2>{0.750527442f, 0.193755537f},
-std::array<float,2>{0.0655897707f, 0.448183209f},
-std::array<float,2>{0.516150057f, 0.724255204f},
-std::array<float,2>{0.480245501f, 0.518288076f},
-std::array<float,2>{0.84718436f, 0.368607461f},
-std::array<float,2>{0.0202111509f, 0.0584641248f},
-std::array<float,2>{0.608052731f, 0.859962821f},
-std::array<float,2>{0.210974514f, 0.998170495f},
-std::array<float,2>{0.749705195f, 0.152254462f},
-std::array<float,2>{0.368774861f, 0.4185265f},
-std::array<float,2>{0.959345162f, 0.676232755f},
-std::array<float,2>{0.118591599f, 0.68835032f},
-std::array<float,2>{0.53934598f, 0.497528404f},
-std::array<float,2>{0.417839825f, 0.227959767f},
-std::array<float,2>{0.802082181f, 0.906945765f},
-std::array<float,2>{0.308201939f, 0.770453751f},
-std::array<float,2>{0.920248866f, 0.071287863f},
-std::array<float,2>{0.160105079f, 0.258463353f},
-std::array<float,2>{0.640487432f, 0.585353374f},
-std::array<float,2>{0.385614425f, 0.675155878f},
-std::array<float,2>{0.768420458f, 0.417579293f},
-std::array<float,2>{0.0880157202f, 0.154887721f},
-std::array<float,2>{0.502645254f, 0.994712055f},
-std::array<float,2>{0.134907156f, 0.864501715f},
-std::array<float,2>{0.682457626f, 0.0610893182f},
-std::array<float,2>{0.270425797f, 0.371297359f},
-std::array<float,2>{0.901067317f, 0.520573437f},
-std::array<float,2>{0.0365043357f, 0.578810573f},
-std::array<float,2>{0.567064047f, 0.264680058f},
-std::array<float,2>{0.444813937f, 0.0761538073f},
-std::array<float,2>{0.813335598f, 0.768356621f},
-std::array<float,2>{0.31587559f, 0.910655677f},
-std::array<float,2>{0.983875215f, 0.233177856f},
-std::array<float,2>{0.236482307f, 0.495135963f},
-std::array<float,2>{0.712834299f, 0.693515599f},
-std::array<float,2>{0.284487575f, 0.540060103f},
-std::array<float,2>{0.935915709f, 0.327518404f},
-std::array<float,2>{0.177807972f, 0.014967531f},
-std::array<float,2>{0.651796699f, 0.820160687f},
-std::array<float,2>{0.100373685f, 0.943188071f},
-std::array<float,2>{0.561295569f, 0.164193451f},
-std::array<float,2>{0.436286569f, 0.390589297f},
-std::array<float,2>{0.789033473f, 0.62635994f},
-std::array<float,2>{0.19718881f, 0.721900046f},
-std::array<float,2>{0.722153008f, 0.449870676f},
-std::array<float,2>{0.352420062f, 0.187645569f},
-std::array<float,2>{0.939102232f, 0.885859847f},
-std::array<float,2>{0.496718645f, 0.811381817f},
-std::array<float,2>{0.865167856f, 0.1243755f},
-std::array<float,2>{0.00187138794f, 0.310256869f},
-std::array<float,2>{0.613672972f, 0.602088869f},
-std::array<float,2>{0.361012936f, 0.715994596f},
-std::array<float,2>{0.965223134f, 0.470167071f},
-std::array<float,2>{0.204619378f, 0.243277535f},
-std::array<float,2>{0.739548624f, 0.924450696f},
-std::array<float,2>{0.0243016798f, 0.755162835f},
-std::array<float,2>{0.598567545f, 0.0797430053f},
-std::array<float,2>{0.470918536f, 0.278045207f},
-std::array<float,2>{0.856519759f, 0.565100431f},
-std::array<float,2>{0.168064475f, 0.500142038f},
-std::array<float,2>{0.625536561f, 0.358810931f},
-std::array<float,2>{0.301342815f, 0.0468536802f},
-std::array<float,2>{0.906390488f, 0.857802153f},
-std::array<float,2>{0.407658309f, 0.982510746f},
-std::array<float,2>{0.80516535f, 0.128459111f},
-std::array<float,2>{0.1166225f, 0.433702916f},
-std::array<float,2>{0.531939566f, 0.657660604f},
-std::array<float,2>{0.458202511f, 0.611174405f},
-std::array<float,2>{0.828554273f, 0.291071922f},
-std::array<float,2>{0.0592378043f, 0.101988055f},
-std::array<float,2>{0.578469217f, 0.788502932f},
-std::array<float,2>{0.220670223f, 0.90126586f},
-std::array<float,2>{0.696216285f, 0.209201008f},
-std::array<float,2>{0.343324721f, 0.462084979f},
-std::array<float,2>{0.988747656f, 0.74388808f},
-std::array<float,2>{0.075518623f, 0.647561014f},
-std::array<float,2>{0.528486729f, 0.400577009f},
-std::array<float,2>{0.395880073f, 0.178653196f},
-std::array<float,2>{0.764406323f, 0.957024038f},
-std::array<float,2>{0.250084639f, 0.83421272f},
-std::array<float,2>{0.875538409f, 0.0278376751f},
-std::array<float,2>{0.153526008f, 0.33875379f},
-std::array<float,2>{0.660094798f, 0.552621305f},
-std::array<float,2>{0.481007457f, 0.73946017f},
-std::array<float,2>{0.847960532f, 0.458095729f},
-std::array<float,2>{0.0189657807f, 0.211564332f},
-std::array<float,2>{0.604283512f, 0.896405399f},
-std::array<float,2>{0.215663821f, 0.790652812f},
-std::array<float,2>{0.742267847f, 0.0992500633f},
-std::array<float,2>{0.373436093f, 0.28883931f},
-std::array<float,2>{0.953923881f, 0.620642066f},
-std::array<float,2>{0.123042122f, 0.555049896f},
-std::array<float,2>{0.546655953f, 0.329835027f},
-std::array<float,2>{0.420812994f, 0.0181851555f},
-std::array<float,2>{0.799505949f, 0.837804675f},
-std::array<float,2>{0.310410857f, 0.961365402f},
-std::array<float,2>{0.917354286f, 0.18345803f},
-std::array<float,2>{0.162121907f, 0.393126667f},
-std::array<float,2>{0.635970831f, 0.64926362f},
-std::array<float,2>{0.332531214f, 0.57553345f},
-std::array<float,2>{0.997296691f, 0.266323119f},
-std::array<float,2>{0.233664468f, 0.0915733799f},
-std::array<float,2>{0.689529121f, 0.762505889f},
-std::array<float,2>{0.0526041985f, 0.936092377f},
-std::array<float,2>{0.593215644f, 0.240302563f},
-std::array<float,2>{0.466288775f, 0.477004141f},
-std::array<float,2>{0.83951503f, 0.70990777f},
-std::array<float,2>{0.14713721f, 0.670419753f},
-std::array<float,2>{0.668408036f, 0.425493389f},
-std::array<float,2>{0.264149994f, 0.13360332f},
-std::array<float,2>{0.88560003f, 0.970324576f},
-std::array<float,2>{0.402236253f, 0.846828818f},
-std::array<float,2>{0.756788254f, 0.0324544609f},
-std::array<float,2>{0.0668945014f, 0.344507337f},
-std::array<float,2>{0.520387113f, 0.50864023f},
-std::array<float,2>{0.274767816f, 0.633770645f},
-std::array<float,2>{0.89603734f, 0.381968915f},
-std::array<float,2>{0.125827715f, 0.161786944f},
-std::array<float,2>{0.678995967f, 0.950047195f},
-std::array<float,2>{0.0794627517f, 0.821799517f},
-std::array<float,2>{0.515141368f, 0.00431041652f},
-std::array<float,2>{0.381839633f, 0.314257324f},
-std::array<float,2>{0.775977731f, 0.538044214f},
-std::array<float,2>{0.248538986f, 0.600803554f},
-std::array<float,2>{0.70446682f, 0.303282559f},
-std::array<float,2>{0.322582752f, 0.111109301f},
-std::array<float,2>{0.97180599f, 0.801469922f},
-std::array<float,2>{0.447616547f, 0.880676448f},
-std::array<float,2>{0.824146509f, 0.201674163f},
-std::array<float,2>{0.0409326591f, 0.444942325f},
-std::array<float,2>{0.578087687f, 0.73022151f},
-std::array<float,2>{0.423642993f, 0.526791096f},
-std::array<float,2>{0.794088066f, 0.366478652f},
-std::array<float,2>{0.106037095f, 0.050292179f},
-std::array<float,2>{0.548707187f, 0.874754667f},
-std::array<float,2>{0.180413648f, 0.986170888f},
-std::array<float,2>{0.641320586f, 0.142876253f},
-std::array<float,2>{0.293173701f, 0.406565368f},
-std::array<float,2>{0.928894818f, 0.680401087f},
-std::array<float,2>{0.0133376205f, 0.701711833f},
-std::array<float,2>{0.622478485f, 0.487561524f},
-std::array<float,2>{0.48872152f, 0.218819037f},
-std::array<float,2>{0.872083127f, 0.916820943f},
-std::array<float,2>{0.344165921f, 0.774951935f},
-std::array<float,2>{0.951516628f, 0.0675384924f},
-std::array<float,2>{0.194101468f, 0.251675189f},
-std::array<float,2>{0.729744554f, 0.589251101f},
-std::array<float,2>{0.437737495f, 0.654301822f},
-std::array<float,2>{0.818627775f, 0.395914376f},
-std::array<float,2>{0.0315272398f, 0.185092285f},
-std::array<float,2>{0.565493584f, 0.96620959f},
-std::array<float,2>{0.238809466f, 0.841066182f},
-std::array<float,2>{0.716438711f, 0.0218983628f},
-std::array<float,2>{0.319550157f, 0.333571434f},
-std::array<float,2>{0.976669312f, 0.560086906f},
-std::array<float,2>{0.0918966383f, 0.623396635f},
-std::array<float,2>{0.506079078f, 0.285075396f},
-std::array<float,2>{0.386860698f, 0.0965429544f},
-std::array<float,2>{0.77019304f, 0.793734074f},
-std::array<float,2>{0.266977102f, 0.893119335f},
-std::array<float,2>{0.905702591f, 0.217677593f},
-std::array<float,2>{0.138916716f, 0.454781353f},
-std::array<float,2>{0.687429011f, 0.736125469f},
-std::array<float,2>{0.356227189f, 0.514607787f},
-std::array<float,2>{0.943201661f, 0.351205349f},
-std::array<float,2>{0.200700596f, 0.0357478373f},
-std::array<float,2>{0.722767711f, 0.847824216f},
-std::array<float,2>{0.00683963019f, 0.974015057f},
-std::array<float,2>{0.610436022f, 0.13819544f},
-std::array<float,2>{0.492520809f, 0.428592205f},
-std::array<float,2>{0.861727238f, 0.666369259f},
-std::array<float,2>{0.174327821f, 0.705221772f},
-std::array<float,2>{0.65408659f, 0.480600655f},
-std::array<float,2>{0.286461323f, 0.236539572f},
-std::array<float,2>{0.931980014f, 0.93008244f},
-std::array<float,2>{0.430074424f, 0.758871853f},
-std::array<float,2>{0.782909036f, 0.0883750841f},
-std::array<float,2>{0.0972489938f, 0.271683991f},
-std::array<float,2>{0.557977617f, 0.571467221f},
-std::array<float,2>{0.298154891f, 0.73106581f},
-std::array<float,2>{0.912208498f, 0.440639347f},
-std::array<float,2>{0.166349232f, 0.198898345f},
-std::array<float,2>{0.630577028f, 0.877620816f},
-std::array<float,2>{0.109391384f, 0.79747045f},
-std::array<float,2>{0.53690815f, 0.116731606f},
-std::array<float,2>{0.411432087f, 0.299117267f},
-std::array<float,2>{0.812427998f, 0.595265806f},
-std::array<float,2>{0.209997818f, 0.532525718f},
-std::array<float,2>{0.737995386f, 0.32021898f},
-std::array<float,2>{0.367050946f, 0.00109065278f},
-std::array<float,2>{0.963883698f, 0.827602088f},
-std::array<float,2>{0.476002514f, 0.945366025f},
-std::array<float,2>{0.852496862f, 0.157927811f},
-std::array<float,2>{0.029370036f, 0.377378613f},
-std::array<float,2>{0.594159007f, 0.638018489f},
-std::array<float,2>{0.39103806f, 0.590215743f},
-std::array<float,2>{0.761030555f, 0.254436165f},
-std::array<float,2>{0.0704001635f, 0.0652217939f},
-std::array<float,2>{0.524513543f, 0.778334081f},
-std::array<float,2>{0.151363432f, 0.919195473f},
-std::array<float,2>{0.66402024f, 0.226308733f},
-std::array<float,2>{0.255758822f, 0.490390718f},
-std::array<float,2>{0.879480541f, 0.695665777f},
-std::array<float,2>{0.0569978096f, 0.683632195f},
-std::array<float,2>{0.582558692f, 0.410231531f},
-std::array<float,2>{0.456986099f, 0.147635788f},
-std::array<float,2>{0.835513473f, 0.991556644f},
-std::array<float,2>{0.336002618f, 0.870776236f},
-std::array<float,2>{0.986698389f, 0.052230183f},
-std::array<float,2>{0.222930253f, 0.362530619f},
-std::array<float,2>{0.703028321f, 0.528220892f},
-std::array<float,2>{0.41639182f, 0.690369964f},
-std::array<float,2>{0.801624835f, 0.498472601f},
-std::array<float,2>{0.11795111f, 0.228924617f},
-std::array<float,2>{0.540661573f, 0.908629596f},
-std::array<float,2>{0.158332959f, 0.772142947f},
-std::array<float,2>{0.638736248f, 0.0730659068f},
-std::array<float,2>{0.306726724f, 0.259800136f},
-std::array<float,2>{0.92136389f, 0.583075762f},
-std::array<float,2>{0.0211952664f, 0.516467273f},
-std::array<float,2>{0.608471811f, 0.369409621f},
-std::array<float,2>{0.479314715f, 0.0561164655f},
-std::array<float,2>{0.846325874f, 0.862951279f},
-std::array<float,2>{0.367996305f, 0.996637285f},
-std::array<float,2>{0.960851729f, 0.148887873f},
-std::array<float,2>{0.212442726f, 0.42107746f},
-std::array<float,2>{0.748854399f, 0.679093242f},
-std::array<float,2>{0.260443598f, 0.608143747f},
-std::array<float,2>{0.889981627f, 0.305223763f},
-std::array<float,2>{0.143132478f, 0.118368283f},
-std::array<float,2>{0.666268349f, 0.807534993f},
-std::array<float,2>{0.0646473095f, 0.890444517f},
-std::array<float,2>{0.517569482f, 0.19180882f},
-std::array<float,2>{0.403194249f, 0.446537554f},
-std::array<float,2>{0.75100404f, 0.725191593f},
-std::array<float,2>{0.227572024f, 0.630383372f},
-std::array<float,2>{0.691902697f, 0.384485602f},
-std::array<float,2>{0.328870296f, 0.170610309f},
-std::array<float,2>{0.995247245f, 0.940400064f},
-std::array<float,2>{0.462954313f, 0.813844383f},
-std::array<float,2>{0.83989346f, 0.0107757598f},
-std::array<float,2>{0.0501329973f, 0.322199404f},
-std::array<float,2>{0.587459803f, 0.543563783f},
-std::array<float,2>{0.327012926f, 0.664016306f},
-std::array<float,2>{0.973283648f, 0.431578964f},
-std::array<float,2>{0.242666915f, 0.132030457f},
-std::array<float,2>{0.709715426f, 0.979671597f},
-std::array<float,2>{0.0431249551f, 0.85160172f},
-std::array<float,2>{0.571826696f, 0.0405150987f},
-std::array<float,2>{0.451891989f, 0.352155179f},
-std::array<float,2>{0.825232029f, 0.507337749f},
-std::array<float,2>{0.13086462f, 0.566821992f},
-std::array<float,2>{0.67191875f, 0.274536312f},
-std::array<float,2>{0.278464288f, 0.0829329118f},
-std::array<float,2>{0.891323686f, 0.753689289f},
-std::array<float,2>{0.377696604f, 0.926343858f},
-std::array<float,2>{0.780400157f, 0.24613817f},
-std::array<float,2>{0.0855523497f, 0.476476759f},
-std::array<float,2>{0.508140981f, 0.71243304f},
-std::array<float,2>{0.486749023f, 0.550417364f},
-std::array<float,2>{0.870786369f, 0.341815114f},
-std::array<float,2>{0.00872743689f, 0.0240704399f},
-std::array<float,2>{0.618605793f, 0.831075728f},
-std::array<float,2>{0.18862997f, 0.957143009f},
-std::array<float,2>{0.731413841f, 0.174717084f},
-std::array<float,2>{0.350059718f, 0.402919412f},
-std::array<float,2>{0.946160734f, 0.64211911f},
-std::array<float,2>{0.10318476f, 0.748681307f},
-std::array<float,2>{0.553686082f, 0.467924237f},
-std::array<float,2>{0.428229779f, 0.203354105f},
-std::array<float,2>{0.789998889f, 0.903392494f},
-std::array<float,2>{0.292671323f, 0.784986019f},
-std::array<float,2>{0.924130857f, 0.10723228f},
-std::array<float,2>{0.186079443f, 0.293108404f},
-std::array<float,2>{0.645233393f, 0.615471423f},
-std::array<float,2>{0.435200483f, 0.627405047f},
-std::array<float,2>{0.785942435f, 0.388525665f},
-std::array<float,2>{0.0981980339f, 0.167334542f},
-std::array<float,2>{0.559428751f, 0.944793642f},
-std::array<float,2>{0.176140994f, 0.817765176f},
-std::array<float,2>{0.650350273f, 0.0131290518f},
-std::array<float,2>{0.281709731f, 0.325442612f},
-std::array<float,2>{0.934907615f, 0.54242152f},
-std::array<float,2>{0.00210411195f, 0.604205728f},
-std::array<float,2>{0.616346717f, 0.310587674f},
-std::array<float,2>{0.498852968f, 0.121112421f},
-std::array<float,2>{0.865926445f, 0.809586585f},
-std::array<float,2>{0.355064631f, 0.884674132f},
-std::array<float,2>{0.940620422f, 0.191211089f},
-std::array<float,2>{0.197857559f, 0.451380014f},
-std::array<float,2>{0.720411897f, 0.718872547f},
-std::array<float,2>{0.27215451f, 0.522202551f},
-std::array<float,2>{0.899101973f, 0.374897897f},
-std::array<float,2>{0.133247942f, 0.0591732599f},
-std::array<float,2>{0.681186914f, 0.867125809f},
-std::array<float,2>{0.0875455886f, 0.992768824f},
-std::array<float,2>{0.501414835f, 0.152732864f},
-std::array<float,2>{0.384401828f, 0.41469124f},
-std::array<float,2>{0.766853034f, 0.672396302f},
-std::array<float,2>{0.235759839f, 0.691858172f},
-std::array<float,2>{0.71336329f, 0.492596805f},
-std::array<float,2>{0.312508523f, 0.231657192f},
-std::array<float,2>{0.982284367f, 0.912260592f},
-std::array<float,2>{0.442342371f, 0.766745448f},
-std::array<float,2>{0.816203237f, 0.0780622959f},
-std::array<float,2>{0.0375655442f, 0.261998147f},
-std::array<float,2>{0.569062114f, 0.581257641f},
-std::array<float,2>{0.340850592f, 0.74608773f},
-std::array<float,2>{0.991722047f, 0.464758784f},
-std::array<float,2>{0.222449109f, 0.207215503f},
-std::array<float,2>{0.697895646f, 0.899569094f},
-std::array<float,2>{0.0611514002f, 0.78608489f},
-std::array<float,2>{0.580764472f, 0.104415372f},
-std::array<float,2>{0.460206777f, 0.289341003f},
-std::array<float,2>{0.830737412f, 0.612132788f},
-std::array<float,2>{0.155097276f, 0.554611802f},
-std::array<float,2>{0.656853378f, 0.337385893f},
-std::array<float,2>{0.25225094f, 0.0296192169f},
-std::array<float,2>{0.878233254f, 0.832736313f},
-std::array<float,2>{0.397157311f, 0.954069734f},
-std::array<float,2>{0.762666464f, 0.175877467f},
-std::array<float,2>{0.0774870291f, 0.400351197f},
-std::array<float,2>{0.529886723f, 0.645793974f},
-std::array<float,2>{0.469334304f, 0.562529981f},
-std::array<float,2>{0.858791888f, 0.281123191f},
-std::array<float,2>{0.0263449568f, 0.0801210031f},
-std::array<float,2>{0.599813223f, 0.756026685f},
-std::array<float,2>{0.205429226f, 0.923070192f},
-std::array<float,2>{0.741024494f, 0.245141387f},
-std::array<float,2>{0.361824632f, 0.472603261f},
-std::array<float,2>{0.968367696f, 0.717710316f},
-std::array<float,2>{0.113555536f, 0.658212662f},
-std::array<float,2>{0.533922136f, 0.435820669f},
-std::array<float,2>{0.408689439f, 0.125576973f},
-std::array<float,2>{0.807988882f, 0.980870664f},
-std::array<float,2>{0.304070443f, 0.855974376f},
-std::array<float,2>{0.909299374f, 0.0440876186f},
-std::array<float,2>{0.171124682f, 0.355840445f},
-std::array<float,2>{0.62759459f, 0.503091097f},
-std::array<float,2>{0.468495876f, 0.707159221f},
-std::array<float,2>{0.836566985f, 0.479002804f},
-std::array<float,2>{0.0542586893f, 0.240059868f},
-std::array<float,2>{0.590913177f, 0.933813393f},
-std::array<float,2>{0.231102169f, 0.765101671f},
-std::array<float,2>{0.688806832f, 0.0930587277f},
-std::array<float,2>{0.334424675f, 0.269016445f},
-std::array<float,2>{0.998265564f, 0.578100204f},
-std::array<float,2>{0.06916783f, 0.509953141f},
-std::array<float,2>{0.521577775f, 0.345966041f},
-std::array<float,2>{0.39962849f, 0.0338558704f},
-std::array<float,2>{0.755205512f, 0.844320476f},
-std::array<float,2>{0.261950284f, 0.970752835f},
-std::array<float,2>{0.883393943f, 0.136668459f},
-std::array<float,2>{0.145491868f, 0.423023224f},
-std::array<float,2>{0.670498967f, 0.669800401f},
-std::array<float,2>{0.372525632f, 0.618616402f},
-std::array<float,2>{0.955601275f, 0.285858274f},
-std::array<float,2>{0.216928139f, 0.0999968275f},
-std::array<float,2>{0.745794535f, 0.792515635f},
-std::array<float,2>{0.0175719988f, 0.896844149f},
-std::array<float,2>{0.60181582f, 0.214255348f},
-std::array<float,2>{0.483396024f, 0.460333645f},
-std::array<float,2>{0.850345612f, 0.740560293f},
-std::array<float,2>{0.160214096f, 0.651607215f},
-std::array<float,2>{0.634190083f, 0.392372191f},
-std::array<float,2>{0.310795099f, 0.180686951f},
-std::array<float,2>{0.915346205f, 0.963514984f},
-std::array<float,2>{0.41954872f, 0.839448154f},
-std::array<float,2>{0.798144877f, 0.0156589858f},
-std::array<float,2>{0.123282805f, 0.331949025f},
-std::array<float,2>{0.543920755f, 0.556663871f},
-std::array<float,2>{0.296867579f, 0.682365656f},
-std::array<float,2>{0.926832557f, 0.408607334f},
-std::array<float,2>{0.182870388f, 0.141446143f},
-std::array<float,2>{0.643389165f, 0.987859249f},
-std::array<float,2>{0.10932631f, 0.872495532f},
-std::array<float,2>{0.550737262f, 0.0469178744f},
-std::array<float,2>{0.42419073f, 0.364286155f},
-std::array<float,2>{0.796233594f, 0.524011135f},
-std::array<float,2>{0.192214027f, 0.586560071f},
-std::array<float,2>{0.728497744f, 0.253665328f},
-std::array<float,2>{0.347397506f, 0.069584623f},
-std::array<float,2>{0.950559437f, 0.776849568f},
-std::array<float,2>{0.491494745f, 0.914155841f},
-std::array<float,2>{0.873318195f, 0.221588239f},
-std::array<float,2>{0.0143405031f, 0.485312164f},
-std::array<float,2>{0.624236941f, 0.701068759f},
-std::array<float,2>{0.380828291f, 0.536751211f},
-std::array<float,2>{0.774597764f, 0.316293895f},
-std::array<float,2>{0.0812704489f, 0.00636550272f},
-std::array<float,2>{0.513020039f, 0.822402835f},
-std::array<float,2>{0.12836954f, 0.951892674f},
-std::array<float,2>{0.676174283f, 0.163105786f},
-std::array<float,2>{0.277085125f, 0.380838543f},
-std::array<float,2>{0.898423195f, 0.635889649f},
-std::array<float,2>{0.0417553633f, 0.727111101f},
-std::array<float,2>{0.576002002f, 0.441461891f},
-std::array<float,2>{0.446781427f, 0.199884593f},
-std::array<float,2>{0.821843028f, 0.882086873f},
-std::array<float,2>{0.320667028f, 0.803606272f},
-std::array<float,2>{0.969025135f, 0.111971289f},
-std::array<float,2>{0.246324509f, 0.301173747f},
-std::array<float,2>{0.70698446f, 0.597896695f},
-std::array<float,2>{0.495988846f, 0.665079057f},
-std::array<float,2>{0.859858692f, 0.426800042f},
-std::array<float,2>{0.0049756649f, 0.13993147f},
-std::array<float,2>{0.612005472f, 0.976433635f},
-std::array<float,2>{0.201240107f, 0.850949764f},
-std::array<float,2>{0.726424456f, 0.0380556099f},
-std::array<float,2>{0.358420461f, 0.349060088f},
-std::array<float,2>{0.943731189f, 0.513358533f},
-std::array<float,2>{0.0956700295f, 0.574096799f},
-std::array<float,2>{0.556466341f, 0.27076751f},
-std::array<float,2>{0.432916075f, 0.0863899291f},
-std::array<float,2>{0.784003854f, 0.761152506f},
-std::array<float,2>{0.288716465f, 0.932236195f},
-std::array<float,2>{0.930376709f, 0.23521933f},
-std::array<float,2>{0.173756674f, 0.482659668f},
-std::array<float,2>{0.655299008f, 0.70488292f},
-std::array<float,2>{0.317491442f, 0.562061429f},
-std::array<float,2>{0.980267882f, 0.334057987f},
-std::array<float,2>{0.240478471f, 0.0197068173f},
-std::array<float,2>{0.718046129f, 0.842808247f},
-std::array<float,2>{0.0341453552f, 0.968262255f},
-std::array<float,2>{0.563332438f, 0.186178088f},
-std::array<float,2>{0.439765126f, 0.398266792f},
-std::array<float,2>{0.817314565f, 0.65296948f},
-std::array<float,2>{0.137812659f, 0.736761749f},
-std::array<float,2>{0.684338033f, 0.456769496f},
-std::array<float,2>{0.268783271f, 0.216055736f},
-std::array<float,2>{0.902975619f, 0.89071548f},
-std::array<float,2>{0.388848722f, 0.796042442f},
-std::array<float,2>{0.772650957f, 0.0938900039f},
-std::array<float,2>{0.089913927f, 0.282620847f},
-std::array<float,2>{0.504186451f, 0.621271312f},
-std::array<float,2>{0.256531805f, 0.697463334f},
-std::array<float,2>{0.882658958f, 0.489920348f},
-std::array<float,2>{0.150035962f, 0.223316565f},
-std::array<float,2>{0.660953701f, 0.920264363f},
-std::array<float,2>{0.0734477118f, 0.780002356f},
-std::array<float,2>{0.526152015f, 0.0641712323f},
-std::array<float,2>{0.394142866f, 0.257464796f},
-std::array<float,2>{0.758125722f, 0.592661798f},
-std::array<float,2>{0.226331413f, 0.529978335f},
-std::array<float,2>{0.699821651f, 0.35986346f},
-std::array<float,2>{0.337960631f, 0.0528516844f},
-std::array<float,2>{0.985004127f, 0.868237615f},
-std::array<float,2>{0.45355624f, 0.989864826f},
-std::array<float,2>{0.832071483f, 0.146250859f},
-std::array<float,2>{0.0554808043f, 0.412242025f},
-std::array<float,2>{0.585199773f, 0.685952067f},
-std::array<float,2>{0.413848519f, 0.596709847f},
-std::array<float,2>{0.808841646f, 0.297848076f},
-std::array<float,2>{0.111707695f, 0.114703074f},
-std::array<float,2>{0.538553953f, 0.799831808f},
-std::array<float,2>{0.16567494f, 0.876106322f},
-std::array<float,2>{0.631095946f, 0.195421472f},
-std::array<float,2>{0.300628304f, 0.438776612f},
-std::array<float,2>{0.910344064f, 0.733235717f},
-std::array<float,2>{0.0288513359f, 0.639992058f},
-std::array<float,2>{0.596414387f, 0.375519305f},
-std::array<float,2>{0.472706646f, 0.159956053f},
-std::array<float,2>{0.854402721f, 0.949173391f},
-std::array<float,2>{0.363976359f, 0.824349344f},
-std::array<float,2>{0.962585449f, 0.00354168261f},
-std::array<float,2>{0.208537921f, 0.317030311f},
-std::array<float,2>{0.734692037f, 0.533280909f},
-std::array<float,2>{0.404793531f, 0.722854614f},
-std::array<float,2>{0.75365746f, 0.44841516f},
-std::array<float,2>{0.0630802736f, 0.194486648f},
-std::array<float,2>{0.519462943f, 0.887479484f},
-std::array<float,2>{0.140700459f, 0.806351721f},
-std::array<float,2>{0.664271772f, 0.120711483f},
-std::array<float,2>{0.25926134f, 0.306917042f},
-std::array<float,2>{0.88679105f, 0.60622716f},
-std::array<float,2>{0.0473819114f, 0.545891345f},
-std::array<float,2>{0.588715136f, 0.323068172f},
-std::array<float,2>{0.460993677f, 0.0087337764f},
-std::array<float,2>{0.842353582f, 0.815939367f},
-std::array<float,2>{0.330274522f, 0.939278722f},
-std::array<float,2>{0.99329412f, 0.169489846f},
-std::array<float,2>{0.229059115f, 0.386638254f},
-std::array<float,2>{0.694200873f, 0.632582247f},
-std::array<float,2>{0.305373609f, 0.584218264f},
-std::array<float,2>{0.918956161f, 0.258967191f},
-std::array<float,2>{0.157721832f, 0.0713226646f},
-std::array<float,2>{0.636962056f, 0.771472216f},
-std::array<float,2>{0.120918415f, 0.908110619f},
-std::array<float,2>{0.541875482f, 0.2271965f},
-std::array<float,2>{0.415745616f, 0.496737093f},
-std::array<float,2>{0.804649115f, 0.688917041f},
-std::array<float,2>{0.214637563f, 0.6769889f},
-std::array<float,2>{0.747056961f, 0.419266433f},
-std::array<float,2>{0.369978815f, 0.150820777f},
-std::array<float,2>{0.958793938f, 0.999335766f},
-std::array<float,2>{0.47755146f, 0.860391915f},
-std::array<float,2>{0.844178975f, 0.056653861f},
-std::array<float,2>{0.0231224149f, 0.367878497f},
-std::array<float,2>{0.606852055f, 0.519266009f},
-std::array<float,2>{0.348152548f, 0.643704772f},
-std::array<float,2>{0.947888672f, 0.405454248f},
-std::array<float,2>{0.190057427f, 0.172847435f},
-std::array<float,2>{0.733283639f, 0.95928371f},
-std::array<float,2>{0.0101990532f, 0.828976572f},
-std::array<float,2>{0.62084806f, 0.0273028333f},
-std::array<float,2>{0.485970914f, 0.339970618f},
-std::array<float,2>{0.869008601f, 0.547036231f},
-std::array<float,2>{0.183696255f, 0.615179002f},
-std::array<float,2>{0.64721632f, 0.295102477f},
-std::array<float,2>{0.290023983f, 0.109272815f},
-std::array<float,2>{0.922055066f, 0.782601893f},
-std::array<float,2>{0.426082551f, 0.904334307f},
-std::array<float,2>{0.792895019f, 0.205792248f},
-std::array<float,2>{0.105144657f, 0.466441005f},
-std::array<float,2>{0.550994933f, 0.746931493f},
-std::array<float,2>{0.450945348f, 0.505248249f},
-std::array<float,2>{0.826951802f, 0.353935599f},
-std::array<float,2>{0.0457850024f, 0.0422433726f},
-std::array<float,2>{0.573476076f, 0.854633093f},
-std::array<float,2>{0.245779097f, 0.977066875f},
-std::array<float,2>{0.708912373f, 0.129274189f},
-std::array<float,2>{0.326138049f, 0.432141125f},
-std::array<float,2>{0.975021303f, 0.661760271f},
-std::array<float,2>{0.0820315629f, 0.712995768f},
-std::array<float,2>{0.511380792f, 0.473090559f},
-std::array<float,2>{0.375662357f, 0.248138651f},
-std::array<float,2>{0.778642118f, 0.928393245f},
-std::array<float,2>{0.281094074f, 0.751544058f},
-std::array<float,2>{0.894521296f, 0.0859170854f},
-std::array<float,2>{0.1294204f, 0.276929647f},
-std::array<float,2>{0.674197733f, 0.568586111f},
-std::array<float,2>{0.414557725f, 0.678812146f},
-std::array<float,2>{0.803426802f, 0.421278f},
-std::array<float,2>{0.119391881f, 0.148480356f},
-std::array<float,2>{0.542545855f, 0.996987343f},
-std::array<float,2>{0.157067746f, 0.863100708f},
-std::array<float,2>{0.638561904f, 0.0557241775f},
-std::array<float,2>{0.306552529f, 0.369374067f},
-std::array<float,2>{0.918909609f, 0.516276538f},
-std::array<float,2>{0.0223350767f, 0.583466709f},
-std::array<float,2>{0.606212139f, 0.260116309f},
-std::array<float,2>{0.477048039f, 0.0727644935f},
-std::array<float,2>{0.845134258f, 0.772314787f},
-std::array<float,2>{0.370665699f, 0.908267438f},
-std::array<float,2>{0.957275867f, 0.228616223f},
-std::array<float,2>{0.213396162f, 0.498155028f},
-std::array<float,2>{0.747438669f, 0.690162003f},
-std::array<float,2>{0.258713037f, 0.543774247f},
-std::array<float,2>{0.888231218f, 0.321778834f},
-std::array<float,2>{0.141692951f, 0.0110227698f},
-std::array<float,2>{0.665597141f, 0.813531399f},
-std::array<float,2>{0.0644350871f, 0.939997196f},
-std::array<float,2>{0.51769489f, 0.170745164f},
-std::array<float,2>{0.405458599f, 0.384723037f},
-std::array<float,2>{0.752340317f, 0.630640864f},
-std::array<float,2>{0.229583114f, 0.725490212f},
-std::array<float,2>{0.694485962f, 0.446339637f},
-std::array<float,2>{0.332025766f, 0.191411793f},
-std::array<float,2>{0.99243331f, 0.890294015f},
-std::array<float,2>{0.46249482f, 0.807179332f},
-std::array<float,2>{0.842897952f, 0.118460275f},
-std::array<float,2>{0.0486894958f, 0.305658281f},
-std::array<float,2>{0.58977896f, 0.608394742f},
-std::array<float,2>{0.32492581f, 0.71282208f},
-std::array<float,2>{0.975969076f, 0.476173878f},
-std::array<float,2>{0.244619817f, 0.246470451f},
-std::array<float,2>{0.707956553f, 0.926527917f},
-std::array<float,2>{0.0464068092f, 0.753469884f},
-std::array<float,2>{0.572614968f, 0.0825818107f},
-std::array<float,2>{0.449411273f, 0.274865836f},
-std::array<float,2>{0.82768786f, 0.566585183f},
-std::array<float,2>{0.130669713f, 0.507617712f},
-std::array<float,2>{0.674826801f, 0.35251385f},
-std::array<float,2>{0.279512078f, 0.0402518921f},
-std::array<float,2>{0.893106699f, 0.851808369f},
-std::array<float,2>{0.376531333f, 0.979892373f},
-std::array<float,2>{0.777820587f, 0.13218753f},
-std::array<float,2>{0.0839662403f, 0.431395203f},
-std::array<float,2>{0.509938598f, 0.663659811f},
-std::array<float,2>{0.484870285f, 0.615517795f},
-std::array<float,2>{0.868001759f, 0.293446541f},
-std::array<float,2>{0.0113057178f, 0.10694699f},
-std::array<float,2>{0.619737983f, 0.784878314f},
-std::array<float,2>{0.191056445f, 0.903644979f},
-std::array<float,2>{0.733630121f, 0.203465149f},
-std::array<float,2>{0.349599928f, 0.468176216f},
-std::array<float,2>{0.948795199f, 0.748877168f},
-std::array<float,2>{0.103811465f, 0.642392695f},
-std::array<float,2>{0.55214572f, 0.403300107f},
-std::array<float,2>{0.427637666f, 0.174430639f},
-std::array<float,2>{0.791976154f, 0.957424223f},
-std::array<float,2>{0.290143371f, 0.831523895f},
-std::array<float,2>{0.923076451f, 0.0242639389f},
-std::array<float,2>{0.18508625f, 0.342143476f},
-std::array<float,2>{0.64818126f, 0.550611496f},
-std::array<float,2>{0.440749496f, 0.735938072f},
-std::array<float,2>{0.818025649f, 0.4548513f},
-std::array<float,2>{0.0351147503f, 0.217395246f},
-std::array<float,2>{0.56441021f, 0.893330157f},
-std::array<float,2>{0.241321519f, 0.793665946f},
-std::array<float,2>{0.717033625f, 0.0963513702f},
-std::array<float,2>{0.316883475f, 0.284909576f},
-std::array<float,2>{0.978745461f, 0.623169541f},
-std::array<float,2>{0.0915517211f, 0.560463369f},
-std::array<float,2>{0.505556405f, 0.333742619f},
-std::array<float,2>{0.390530139f, 0.021546606f},
-std::array<float,2>{0.771565139f, 0.840826511f},
-std::array<float,2>{0.267650038f, 0.966039777f},
-std::array<float,2>{0.904032528f, 0.185348377f},
-std::array<float,2>{0.136994019f, 0.395718217f},
-std::array<float,2>{0.684791207f, 0.654634416f},
-std::array<float,2>{0.357511669f, 0.571556211f},
-std::array<float,2>{0.944813728f, 0.271798342f},
-std::array<float,2>{0.202580631f, 0.088129811f},
-std::array<float,2>{0.724895358f, 0.759135842f},
-std::array<float,2>{0.00461550336f, 0.929726183f},
-std::array<float,2>{0.613075435f, 0.236811563f},
-std::array<float,2>{0.494402975f, 0.480822921f},
-std::array<float,2>{0.860917151f, 0.705368996f},
-std::array<float,2>{0.172285274f, 0.666105986f},
-std::array<float,2>{0.655143917f, 0.428456217f},
-std::array<float,2>{0.287224263f, 0.138506711f},
-std::array<float,2>{0.931613624f, 0.973797202f},
-std::array<float,2>{0.431711644f, 0.847913623f},
-std::array<float,2>{0.785017431f, 0.0361137614f},
-std::array<float,2>{0.0945280194f, 0.35143286f},
-std::array<float,2>{0.55519706f, 0.514171422f},
-std::array<float,2>{0.299536824f, 0.637911439f},
-std::array<float,2>{0.912043095f, 0.377038926f},
-std::array<float,2>{0.164314732f, 0.158136174f},
-std::array<float,2>{0.6324175f, 0.945738614f},
-std::array<float,2>{0.112399846f, 0.827372372f},
-std::array<float,2>{0.537796617f, 0.00145539478f},
-std::array<float,2>{0.412165403f, 0.319952518f},
-std::array<float,2>{0.810046017f, 0.532327592f},
-std::array<float,2>{0.207685515f, 0.595468104f},
-std::array<float,2>{0.735815525f, 0.298907578f},
-std::array<float,2>{0.365131736f, 0.117176756f},
-std::array<float,2>{0.961491823f, 0.797724843f},
-std::array<float,2>{0.474298865f, 0.877876639f},
-std::array<float,2>{0.855034769f, 0.199089646f},
-std::array<float,2>{0.0282101333f, 0.440765321f},
-std::array<float,2>{0.597330153f, 0.731419206f},
-std::array<float,2>{0.393209517f, 0.527996123f},
-std::array<float,2>{0.759362519f, 0.362698197f},
-std::array<float,2>{0.0731371641f, 0.0518433712f},
-std::array<float,2>{0.52640295f, 0.871012747f},
-std::array<float,2>{0.14910835f, 0.991415381f},
-std::array<float,2>{0.662013948f, 0.147918463f},
-std::array<float,2>{0.256956309f, 0.410556674f},
-std::array<float,2>{0.881340504f, 0.683890641f},
-std::array<float,2>{0.0557616092f, 0.695401311f},
-std::array<float,2>{0.584289789f, 0.490698814f},
-std::array<float,2>{0.454342663f, 0.226494059f},
-std::array<float,2>{0.833499253f, 0.918965399f},
-std::array<float,2>{0.338965803f, 0.778795004f},
-std::array<float,2>{0.986258388f, 0.0649932474f},
-std::array<float,2>{0.225131944f, 0.254671574f},
-std::array<float,2>{0.700992763f, 0.59005475f},
-std::array<float,2>{0.48355791f, 0.648982644f},
-std::array<float,2>{0.850868881f, 0.39341417f},
-std::array<float,2>{0.0156963803f, 0.183228612f},
-std::array<float,2>{0.60341233f, 0.961126983f},
-std::array<float,2>{0.218353555f, 0.837434649f},
-std::array<float,2>{0.744846225f, 0.0184341725f},
-std::array<float,2>{0.371840119f, 0.329629689f},
-std::array<float,2>{0.95627296f, 0.554790914f},
-std::array<float,2>{0.124894939f, 0.62105751f},
-std::array<float,2>{0.544691563f, 0.288800716f},
-std::array<float,2>{0.417998642f, 0.099379465f},
-std::array<float,2>{0.797304213f, 0.790844917f},
-std::array<float,2>{0.311683953f, 0.896137357f},
-std::array<float,2>{0.914986908f, 0.211746231f},
-std::array<float,2>{0.161226943f, 0.458422393f},
-std::array<float,2>{0.633237898f, 0.739511013f},
-std::array<float,2>{0.335027933f, 0.508474112f},
-std::array<float,2>{0.999721587f, 0.344351828f},
-std::array<float,2>{0.231730863f, 0.0326598808f},
-std::array<float,2>{0.688449621f, 0.847146809f},
-std::array<float,2>{0.0527825728f, 0.970505953f},
-std::array<float,2>{0.590479314f, 0.133346081f},
-std::array<float,2>{0.467401534f, 0.425544143f},
-std::array<float,2>{0.837581515f, 0.670694828f},
-std::array<float,2>{0.146093801f, 0.709619164f},
-std::array<float,2>{0.671237588f, 0.476699352f},
-std::array<float,2>{0.263557643f, 0.240618035f},
-std::array<float,2>{0.884442151f, 0.936458826f},
-std::array<float,2>{0.399334401f, 0.762295544f},
-std::array<float,2>{0.754431784f, 0.091354847f},
-std::array<float,2>{0.0696565881f, 0.266548544f},
-std::array<float,2>{0.522922695f, 0.575248361f},
-std::array<float,2>{0.276239067f, 0.730415583f},
-std::array<float,2>{0.896629751f, 0.445163906f},
-std::array<float,2>{0.127226144f, 0.202006668f},
-std::array<float,2>{0.677469134f, 0.880425632f},
-std::array<float,2>{0.0804093704f, 0.801571131f},
-std::array<float,2>{0.51183337f, 0.111081935f},
-std::array<float,2>{0.379566163f, 0.303521633f},
-std::array<float,2>{0.774286926f, 0.601046383f},
-std::array<float,2>{0.247628987f, 0.537825942f},
-std::array<float,2>{0.705907166f, 0.313989431f},
-std::array<float,2>{0.321930587f, 0.00405776361f},
-std::array<float,2>{0.970189273f, 0.822227359f},
-std::array<float,2>{0.445523649f, 0.949937701f},
-std::array<float,2>{0.820665836f, 0.161988765f},
-std::array<float,2>{0.0424722433f, 0.382226646f},
-std::array<float,2>{0.574605644f, 0.633321285f},
-std::array<float,2>{0.425155759f, 0.58910507f},
-std::array<float,2>{0.795449495f, 0.251824617f},
-std::array<float,2>{0.107689373f, 0.0677285641f},
-std::array<float,2>{0.549153626f, 0.775190055f},
-std::array<float,2>{0.182289526f, 0.916548908f},
-std::array<float,2>{0.644160867f, 0.219156727f},
-std::array<float,2>{0.295346886f, 0.487351388f},
-std::array<float,2>{0.925952077f, 0.701969683f},
-std::array<float,2>{0.0150325354f, 0.680581272f},
-std::array<float,2>{0.623440862f, 0.40628475f},
-std::array<float,2>{0.49046427f, 0.142748922f},
-std::array<float,2>{0.874318957f, 0.985849023f},
-std::array<float,2>{0.346172482f, 0.874762118f},
-std::array<float,2>{0.949726522f, 0.0498525649f},
-std::array<float,2>{0.193167597f, 0.366334379f},
-std::array<float,2>{0.726707578f, 0.526474357f},
-std::array<float,2>{0.383583754f, 0.693731844f},
-std::array<float,2>{0.76607579f, 0.495592684f},
-std::array<float,2>{0.086333245f, 0.233041197f},
-std::array<float,2>{0.50080204f, 0.911033869f},
-std::array<float,2>{0.134579599f, 0.768132627f},
-std::array<float,2>{0.680498421f, 0.0758719519f},
-std::array<float,2>{0.273434162f, 0.265036374f},
-std::array<float,2>{0.900169909f, 0.579017222f},
-std::array<float,2>{0.0387345441f, 0.52079165f},
-std::array<float,2>{0.569783807f, 0.371454924f},
-std::array<float,2>{0.442650855f, 0.0613388866f},
-std::array<float,2>{0.815162301f, 0.864533603f},
-std::array<float,2>{0.314350694f, 0.994913101f},
-std::array<float,2>{0.980891705f, 0.155106381f},
-std::array<float,2>{0.234765187f, 0.417740524f},
-std::array<float,2>{0.714093685f, 0.674846113f},
-std::array<float,2>{0.282662898f, 0.602513433f},
-std::array<float,2>{0.934310198f, 0.310536325f},
-std::array<float,2>{0.176983997f, 0.124253385f},
-std::array<float,2>{0.649339259f, 0.811176062f},
-std::array<float,2>{0.0986940339f, 0.886013687f},
-std::array<float,2>{0.560522854f, 0.187767357f},
-std::array<float,2>{0.434413552f, 0.450155705f},
-std::array<float,2>{0.786286116f, 0.722063363f},
-std::array<float,2>{0.198761985f, 0.626146376f},
-std::array<float,2>{0.719534993f, 0.39032355f},
-std::array<float,2>{0.354037464f, 0.164443552f},
-std::array<float,2>{0.939693153f, 0.942949831f},
-std::array<float,2>{0.499198794f, 0.819969714f},
-std::array<float,2>{0.866358638f, 0.0146931186f},
-std::array<float,2>{0.00307451095f, 0.327217072f},
-std::array<float,2>{0.61524564f, 0.540316164f},
-std::array<float,2>{0.362399727f, 0.657281995f},
-std::array<float,2>{0.967129052f, 0.434032351f},
-std::array<float,2>{0.206203341f, 0.128752574f},
-std::array<float,2>{0.741577446f, 0.98288703f},
-std::array<float,2>{0.0268689208f, 0.857609093f},
-std::array<float,2>{0.601319909f, 0.046591267f},
-std::array<float,2>{0.470549047f, 0.358494699f},
-std::array<float,2>{0.85831064f, 0.500343025f},
-std::array<float,2>{0.170524821f, 0.565397024f},
-std::array<float,2>{0.627975881f, 0.278180391f},
-std::array<float,2>{0.303400278f, 0.0799353495f},
-std::array<float,2>{0.908228517f, 0.754921079f},
-std::array<float,2>{0.409989834f, 0.924597621f},
-std::array<float,2>{0.807473004f, 0.243649304f},
-std::array<float,2>{0.114886254f, 0.469842851f},
-std::array<float,2>{0.534486532f, 0.716282248f},
-std::array<float,2>{0.459746599f, 0.552361429f},
-std::array<float,2>{0.831655085f, 0.338593811f},
-std::array<float,2>{0.0621726327f, 0.0281928424f},
-std::array<float,2>{0.581609368f, 0.834393859f},
-std::array<float,2>{0.221034855f, 0.956625104f},
-std::array<float,2>{0.69849205f, 0.178394899f},
-std::array<float,2>{0.340331078f, 0.400681168f},
-std::array<float,2>{0.990418553f, 0.647756159f},
-std::array<float,2>{0.0763817877f, 0.744004905f},
-std::array<float,2>{0.530855477f, 0.46220386f},
-std::array<float,2>{0.398212016f, 0.209430665f},
-std::array<float,2>{0.763364375f, 0.900910735f},
-std::array<float,2>{0.253710061f, 0.788226008f},
-std::array<float,2>{0.877676189f, 0.101750419f},
-std::array<float,2>{0.155882418f, 0.291481346f},
-std::array<float,2>{0.657296717f, 0.611060917f},
-std::array<float,2>{0.403325081f, 0.632369339f},
-std::array<float,2>{0.750157118f, 0.386332542f},
-std::array<float,2>{0.0663862452f, 0.16968298f},
-std::array<float,2>{0.515734732f, 0.93908453f},
-std::array<float,2>{0.143655792f, 0.816250741f},
-std::array<float,2>{0.667452276f, 0.00831562467f},
-std::array<float,2>{0.2610856f, 0.322995424f},
-std::array<float,2>{0.889008522f, 0.545534074f},
-std::array<float,2>{0.0492621325f, 0.6059677f},
-std::array<float,2>{0.586715639f, 0.306813449f},
-std::array<float,2>{0.464608699f, 0.121036336f},
-std::array<float,2>{0.8416242f, 0.806516409f},
-std::array<float,2>{0.329887748f, 0.887345672f},
-std::array<float,2>{0.994939983f, 0.194778264f},
-std::array<float,2>{0.226866722f, 0.448678464f},
-std::array<float,2>{0.692760825f, 0.722997904f},
-std::array<float,2>{0.307979286f, 0.519500673f},
-std::array<float,2>{0.920870125f, 0.368084133f},
-std::array<float,2>{0.159566835f, 0.0569278561f},
-std::array<float,2>{0.640102506f, 0.860658765f},
-std::array<float,2>{0.11874216f, 0.999102592f},
-std::array<float,2>{0.539875865f, 0.150434405f},
-std::array<float,2>{0.417359591f, 0.419038326f},
-std::array<float,2>{0.802473009f, 0.677172124f},
-std::array<float,2>{0.211879343f, 0.688555479f},
-std::array<float,2>{0.749237597f, 0.496977836f},
-std::array<float,2>{0.368539184f, 0.227350473f},
-std::array<float,2>{0.959529519f, 0.9077667f},
-std::array<float,2>{0.479604572f, 0.771077096f},
-std::array<float,2>{0.846954703f, 0.0716347322f},
-std::array<float,2>{0.0196186733f, 0.259176284f},
-std::array<float,2>{0.607459664f, 0.584272504f},
-std::array<float,2>{0.350598633f, 0.746783137f},
-std::array<float,2>{0.946668923f, 0.466618776f},
-std::array<float,2>{0.188249066f, 0.205927774f},
-std::array<float,2>{0.731801569f, 0.904726624f},
-std::array<float,2>{0.00970406458f, 0.782326818f},
-std::array<float,2>{0.61792618f, 0.1090931f},
-std::array<float,2>{0.488124698f, 0.295371979f},
-std::array<float,2>{0.869582653f, 0.614881456f},
-std::array<float,2>{0.186886564f, 0.547251165f},
-std::array<float,2>{0.64558512f, 0.340097606f},
-std::array<float,2>{0.291045159f, 0.0268587563f},
-std::array<float,2>{0.925541341f, 0.828784943f},
-std::array<float,2>{0.428963006f, 0.959102869f},
-std::array<float,2>{0.790206552f, 0.172452793f},
-std::array<float,2>{0.102169141f, 0.405545413f},
-std::array<float,2>{0.553791642f, 0.64393419f},
-std::array<float,2>{0.452955067f, 0.568830431f},
-std::array<float,2>{0.824454725f, 0.27715224f},
-std::array<float,2>{0.0444738194f, 0.085641183f},
-std::array<float,2>{0.570665479f, 0.751714587f},
-std::array<float,2>{0.243840426f, 0.928518772f},
-std::array<float,2>{0.710295916f, 0.248519123f},
-std::array<float,2>{0.327486366f, 0.472707182f},
-std::array<float,2>{0.974565268f, 0.713289857f},
-std::array<float,2>{0.0847617015f, 0.661981821f},
-std::array<float,2>{0.509693205f, 0.432605684f},
-std::array<float,2>{0.378713965f, 0.12898086f},
-std::array<float,2>{0.77947408f, 0.977508903f},
-std::array<float,2>{0.277429461f, 0.854790628f},
-std::array<float,2>{0.892015994f, 0.0422076061f},
-std::array<float,2>{0.132714987f, 0.353638321f},
-std::array<float,2>{0.673322678f, 0.505065143f},
-std::array<float,2>{0.494026631f, 0.704752326f},
-std::array<float,2>{0.863042831f, 0.482837856f},
-std::array<float,2>{0.00631841412f, 0.234924451f},
-std::array<float,2>{0.610102355f, 0.93249923f},
-std::array<float,2>{0.199627504f, 0.760967016f},
-std::array<float,2>{0.724553525f, 0.086160779f},
-std::array<float,2>{0.356547117f, 0.2705217f},
-std::array<float,2>{0.941712558f, 0.573784649f},
-std::array<float,2>{0.0966053605f, 0.513624191f},
-std::array<float,2>{0.557615519f, 0.348719299f},
-std::array<float,2>{0.431599498f, 0.0377744101f},
-std::array<float,2>{0.781490862f, 0.850619614f},
-std::array<float,2>{0.285292298f, 0.976290703f},
-std::array<float,2>{0.933583975f, 0.139785945f},
-std::array<float,2>{0.17514582f, 0.427195936f},
-std::array<float,2>{0.652811408f, 0.66533035f},
-std::array<float,2>{0.318798155f, 0.621465266f},
-std::array<float,2>{0.978354275f, 0.282465219f},
-std::array<float,2>{0.239569172f, 0.0942054614f},
-std::array<float,2>{0.714922607f, 0.796237171f},
-std::array<float,2>{0.0327506587f, 0.890973985f},
-std::array<float,2>{0.565344214f, 0.216301933f},
-std::array<float,2>{0.43882975f, 0.456918567f},
-std::array<float,2>{0.8193385f, 0.736329019f},
-std::array<float,2>{0.139929488f, 0.653292537f},
-std::array<float,2>{0.686366796f, 0.397967905f},
-std::array<float,2>{0.266026378f, 0.186489567f},
-std::array<float,2>{0.904316068f, 0.968688726f},
-std::array<float,2>{0.388605505f, 0.843033373f},
-std::array<float,2>{0.770907938f, 0.0199777689f},
-std::array<float,2>{0.093001157f, 0.3342942f},
-std::array<float,2>{0.507774711f, 0.562447906f},
-std::array<float,2>{0.253966212f, 0.685739517f},
-std::array<float,2>{0.880510449f, 0.412407041f},
-std::array<float,2>{0.152000755f, 0.146017864f},
-std::array<float,2>{0.662724435f, 0.990085244f},
-std::array<float,2>{0.0716011077f, 0.868498087f},
-std::array<float,2>{0.524365425f, 0.0531834513f},
-std::array<float,2>{0.392211705f, 0.360135794f},
-std::array<float,2>{0.760112166f, 0.530098319f},
-std::array<float,2>{0.223833278f, 0.592340231f},
-std::array<float,2>{0.701786101f, 0.257663935f},
-std::array<float,2>{0.337696701f, 0.0642780885f},
-std::array<float,2>{0.987961173f, 0.780174375f},
-std::array<float,2>{0.456026822f, 0.919983923f},
-std::array<float,2>{0.834160745f, 0.223494127f},
-std::array<float,2>{0.0576994829f, 0.490206122f},
-std::array<float,2>{0.583030343f, 0.697639883f},
-std::array<float,2>{0.410984427f, 0.533536017f},
-std::array<float,2>{0.811491132f, 0.317140788f},
-std::array<float,2>{0.11042314f, 0.00390317896f},
-std::array<float,2>{0.535645723f, 0.824504554f},
-std::array<float,2>{0.167058706f, 0.948778808f},
-std::array<float,2>{0.629092932f, 0.159725443f},
-std::array<float,2>{0.297388107f, 0.375787795f},
-std::array<float,2>{0.913919091f, 0.639802933f},
-std::array<float,2>{0.030931063f, 0.733053207f},
-std::array<float,2>{0.595088303f, 0.438659519f},
-std::array<float,2>{0.47472468f, 0.195566475f},
-std::array<float,2>{0.852632761f, 0.876282394f},
-std::array<float,2>{0.36569044f, 0.800216079f},
-std::array<float,2>{0.963195384f, 0.11427851f},
-std::array<float,2>{0.209048718f, 0.297606349f},
-std::array<float,2>{0.73643285f, 0.596924663f},
-std::array<float,2>{0.465593964f, 0.669540226f},
-std::array<float,2>{0.838524759f, 0.423132032f},
-std::array<float,2>{0.051037211f, 0.136325076f},
-std::array<float,2>{0.592024028f, 0.971122503f},
-std::array<float,2>{0.232539847f, 0.844664931f},
-std::array<float,2>{0.691355407f, 0.0340176374f},
-std::array<float,2>{0.333248079f, 0.345860422f},
-std::array<float,2>{0.997069955f, 0.510202825f},
-std::array<float,2>{0.0681805238f, 0.577673316f},
-std::array<float,2>{0.521063805f, 0.268556386f},
-std::array<float,2>{0.400521517f, 0.0928176418f},
-std::array<float,2>{0.756940305f, 0.7648682f},
-std::array<float,2>{0.265392274f, 0.933923244f},
-std::array<float,2>{0.886402607f, 0.239921376f},
-std::array<float,2>{0.148044258f, 0.478536576f},
-std::array<float,2>{0.669481516f, 0.707285464f},
-std::array<float,2>{0.374666959f, 0.556912482f},
-std::array<float,2>{0.954172552f, 0.331602693f},
-std::array<float,2>{0.216744378f, 0.016050797f},
-std::array<float,2>{0.743981421f, 0.83976239f},
-std::array<float,2>{0.0182653572f, 0.96374917f},
-std::array<float,2>{0.604888737f, 0.181104019f},
-std::array<float,2>{0.481675893f, 0.392215192f},
-std::array<float,2>{0.84946692f, 0.651759505f},
-std::array<float,2>{0.16366592f, 0.74043566f},
-std::array<float,2>{0.634798944f, 0.460180372f},
-std::array<float,2>{0.308935165f, 0.213886619f},
-std::array<float,2>{0.91633451f, 0.896593153f},
-std::array<float,2>{0.421674609f, 0.792867601f},
-std::array<float,2>{0.800127327f, 0.0997312367f},
-std::array<float,2>{0.122020729f, 0.286131978f},
-std::array<float,2>{0.544937134f, 0.618273437f},
-std::array<float,2>{0.294020385f, 0.700685501f},
-std::array<float,2>{0.928134739f, 0.484871745f},
-std::array<float,2>{0.181602061f, 0.221330717f},
-std::array<float,2>{0.642381728f, 0.914498091f},
-std::array<float,2>{0.106871836f, 0.776594818f},
-std::array<float,2>{0.547198176f, 0.0693378001f},
-std::array<float,2>{0.42259559f, 0.253427267f},
-std::array<float,2>{0.793250501f, 0.586674333f},
-std::array<float,2>{0.194962606f, 0.524234951f},
-std::array<float,2>{0.728643358f, 0.364718437f},
-std::array<float,2>{0.345598161f, 0.0473580472f},
-std::array<float,2>{0.952331305f, 0.872138262f},
-std::array<float,2>{0.489781111f, 0.988269627f},
-std::array<float,2>{0.872056365f, 0.141195104f},
-std::array<float,2>{0.0125708785f, 0.408222646f},
-std::array<float,2>{0.621582508f, 0.682614207f},
-std::array<float,2>{0.381320775f, 0.597991407f},
-std::array<float,2>{0.776771307f, 0.300865442f},
-std::array<float,2>{0.0789603069f, 0.112191312f},
-std::array<float,2>{0.514474452f, 0.803445995f},
-std::array<float,2>{0.126413137f, 0.881855547f},
-std::array<float,2>{0.678313255f, 0.200092942f},
-std::array<float,2>{0.274412274f, 0.441708773f},
-std::array<float,2>{0.895308256f, 0.727493763f},
-std::array<float,2>{0.0391373262f, 0.636131108f},
-std::array<float,2>{0.576912105f, 0.3804802f},
-std::array<float,2>{0.448980123f, 0.163417518f},
-std::array<float,2>{0.822840333f, 0.952001214f},
-std::array<float,2>{0.323868871f, 0.822623789f},
-std::array<float,2>{0.971456945f, 0.00669973856f},
-std::array<float,2>{0.249747857f, 0.316052794f},
-std::array<float,2>{0.70328021f, 0.537000597f},
-std::array<float,2>{0.437352329f, 0.719109893f},
-std::array<float,2>{0.787449002f, 0.451511085f},
-std::array<float,2>{0.101337373f, 0.191037342f},
-std::array<float,2>{0.562452614f, 0.884389997f},
-std::array<float,2>{0.179376468f, 0.80986321f},
-std::array<float,2>{0.651268423f, 0.12143109f},
-std::array<float,2>{0.283664852f, 0.310950696f},
-std::array<float,2>{0.936905086f, 0.604378819f},
-std::array<float,2>{0.000372330309f, 0.542113483f},
-std::array<float,2>{0.614747286f, 0.325273246f},
-std::array<float,2>{0.497250199f, 0.0127662849f},
-std::array<float,2>{0.863809407f, 0.817503154f},
-std::array<float,2>{0.353210181f, 0.944444776f},
-std::array<float,2>{0.938299358f, 0.167206571f},
-std::array<float,2>{0.195820957f, 0.388350189f},
-std::array<float,2>{0.721353233f, 0.627079785f},
-std::array<float,2>{0.270907342f, 0.581422567f},
-std::array<float,2>{0.902206302f, 0.261893094f},
-std::array<float,2>{0.136244595f, 0.0776548833f},
-std::array<float,2>{0.683425665f, 0.767045796f},
-std::array<float,2>{0.0898118764f, 0.912505448f},
-std::array<float,2>{0.503329575f, 0.231915012f},
-std::array<float,2>{0.386219501f, 0.492420524f},
-std::array<float,2>{0.769473314f, 0.69140929f},
-std::array<float,2>{0.237810373f, 0.672812104f},
-std::array<float,2>{0.711255908f, 0.415028214f},
-std::array<float,2>{0.315124094f, 0.152498096f},
-std::array<float,2>{0.983250678f, 0.99296689f},
-std::array<float,2>{0.443866044f, 0.866890132f},
-std::array<float,2>{0.813708782f, 0.0594919436f},
-std::array<float,2>{0.0353192687f, 0.374514759f},
-std::array<float,2>{0.567634106f, 0.52228874f},
-std::array<float,2>{0.342648119f, 0.645617723f},
-std::array<float,2>{0.989571393f, 0.40010038f},
-std::array<float,2>{0.218841717f, 0.176195398f},
-std::array<float,2>{0.696384668f, 0.953848958f},
-std::array<float,2>{0.0603080094f, 0.832976997f},
-std::array<float,2>{0.579969406f, 0.0293547325f},
-std::array<float,2>{0.457168132f, 0.33706215f},
-std::array<float,2>{0.829446256f, 0.554235339f},
-std::array<float,2>{0.153228983f, 0.611986518f},
-std::array<float,2>{0.659013927f, 0.289082587f},
-std::array<float,2>{0.25192827f, 0.104206905f},
-std::array<float,2>{0.876834691f, 0.785824537f},
-std::array<float,2>{0.394582093f, 0.89973408f},
-std::array<float,2>{0.765469432f, 0.207404792f},
-std::array<float,2>{0.0743633583f, 0.464579016f},
-std::array<float,2>{0.527610183f, 0.745818019f},
-std::array<float,2>{0.47214666f, 0.503299475f},
-std::array<float,2>{0.856035054f, 0.35554862f},
-std::array<float,2>{0.0248125754f, 0.0443862155f},
-std::array<float,2>{0.598884821f, 0.856382906f},
-std::array<float,2>{0.204014823f, 0.980620325f},
-std::array<float,2>{0.738357127f, 0.125927061f},
-std::array<float,2>{0.359445184f, 0.435771734f},
-std::array<float,2>{0.966725945f, 0.658682823f},
-std::array<float,2>{0.115275711f, 0.717340231f},
-std::array<float,2>{0.53288281f, 0.472225785f},
-std::array<float,2>{0.406660408f, 0.245541543f},
-std::array<float,2>{0.806003511f, 0.923231781f},
-std::array<float,2>{0.302007258f, 0.756153226f},
-std::array<float,2>{0.907246351f, 0.0804028064f},
-std::array<float,2>{0.169072732f, 0.28093347f},
-std::array<float,2>{0.626774013f, 0.5629704f},
-std::array<float,2>{0.377375305f, 0.662895858f},
-std::array<float,2>{0.780970931f, 0.429872096f},
-std::array<float,2>{0.0852105021f, 0.131316453f},
-std::array<float,2>{0.508625567f, 0.979485869f},
-std::array<float,2>{0.131425157f, 0.852589309f},
-std::array<float,2>{0.672846556f, 0.0399261229f},
-std::array<float,2>{0.278924227f, 0.352625549f},
-std::array<float,2>{0.890629947f, 0.506279767f},
-std::array<float,2>{0.0439132117f, 0.568358541f},
-std::array<float,2>{0.571542919f, 0.273852855f},
-std::array<float,2>{0.451550782f, 0.0839604065f},
-std::array<float,2>{0.825877726f, 0.752386868f},
-std::array<float,2>{0.326612741f, 0.927235007f},
-std::array<float,2>{0.973100483f, 0.247620553f},
-std::array<float,2>{0.242815539f, 0.474671364f},
-std::array<float,2>{0.709235728f, 0.711318731f},
-std::array<float,2>{0.29216826f, 0.549702048f},
-std::array<float,2>{0.924555361f, 0.343743235f},
-std::array<float,2>{0.18587701f, 0.0249211211f},
-std::array<float,2>{0.645013034f, 0.830599189f},
-std::array<float,2>{0.102720506f, 0.958555877f},
-std::array<float,2>{0.55278492f, 0.174951881f},
-std::array<float,2>{0.428151488f, 0.404249072f},
-std::array<float,2>{0.789510369f, 0.641340196f},
-std::array<float,2>{0.189427778f, 0.749413073f},
-std::array<float,2>{0.730920434f, 0.467322409f},
-std::array<float,2>{0.350120008f, 0.204642206f},
-std::array<float,2>{0.94535023f, 0.902509391f},
-std::array<float,2>{0.487224936f, 0.783895314f},
-std::array<float,2>{0.870519876f, 0.106200337f},
-std::array<float,2>{0.00783629715f, 0.294844687f},
-std::array<float,2>{0.618940294f, 0.616380751f},
-std::array<float,2>{0.367673904f, 0.690676808f},
-std::array<float,2>{0.960249007f, 0.499602795f},
-std::array<float,2>{0.212325186f, 0.229658708f},
-std::array<float,2>{0.748152196f, 0.909422457f},
-std::array<float,2>{0.0205802284f, 0.772491276f},
-std::array<float,2>{0.609277725f, 0.0736402422f},
-std::array<float,2>{0.478613198f, 0.2607508f},
-std::array<float,2>{0.845855653f, 0.582185328f},
-std::array<float,2>{0.15904887f, 0.516674221f},
-std::array<float,2>{0.639339924f, 0.37103644f},
-std::array<float,2>{0.307140797f, 0.055102054f},
-std::array<float,2>{0.921609998f, 0.861496449f},
-std::array<float,2>{0.416840911f, 0.997665823f},
-std::array<float,2>{0.801127613f, 0.149767965f},
-std::array<float,2>{0.117518216f, 0.420712411f},
-std::array<float,2>{0.54030019f, 0.678590655f},
-std::array<float,2>{0.46379894f, 0.60877353f},
-std::array<float,2>{0.840772748f, 0.305792212f},
-std::array<float,2>{0.0503099263f, 0.117216192f},
-std::array<float,2>{0.587060452f, 0.808084965f},
-std::array<float,2>{0.228092641f, 0.889395237f},
-std::array<float,2>{0.691505253f, 0.192505687f},
-std::array<float,2>{0.328546941f, 0.445663124f},
-std::array<float,2>{0.995644569f, 0.726545632f},
-std::array<float,2>{0.0649936721f, 0.629110992f},
-std::array<float,2>{0.516799033f, 0.383515656f},
-std::array<float,2>{0.402658314f, 0.171067417f},
-std::array<float,2>{0.751521707f, 0.940853357f},
-std::array<float,2>{0.260169774f, 0.813326716f},
-std::array<float,2>{0.890271783f, 0.0102649722f},
-std::array<float,2>{0.142772734f, 0.320761681f},
-std::array<float,2>{0.666685045f, 0.544792414f},
-std::array<float,2>{0.47631228f, 0.731639147f},
-std::array<float,2>{0.85197705f, 0.440428436f},
-std::array<float,2>{0.0300370585f, 0.197532579f},
-std::array<float,2>{0.594716549f, 0.87861371f},
-std::array<float,2>{0.210879415f, 0.798064888f},
-std::array<float,2>{0.737529457f, 0.115370706f},
-std::array<float,2>{0.366417468f, 0.299844176f},
-std::array<float,2>{0.964463055f, 0.594421446f},
-std::array<float,2>{0.110029005f, 0.531933725f},
-std::array<float,2>{0.536492765f, 0.319054812f},
-std::array<float,2>{0.412031502f, 0.000965515501f},
-std::array<float,2>{0.811681926f, 0.826533139f},
-std::array<float,2>{0.298493266f, 0.94702518f},
-std::array<float,2>{0.912844718f, 0.156844541f},
-std::array<float,2>{0.16664733f, 0.378476858f},
-std::array<float,2>{0.630064368f, 0.636925876f},
-std::array<float,2>{0.336842805f, 0.591252685f},
-std::array<float,2>{0.986944079f, 0.255694866f},
-std::array<float,2>{0.223333582f, 0.0657681376f},
-std::array<float,2>{0.702616513f, 0.777404487f},
-std::array<float,2>{0.0572011098f, 0.918533385f},
-std::array<float,2>{0.582320809f, 0.224853948f},
-std::array<float,2>{0.456263632f, 0.491290629f},
-std::array<float,2>{0.83527559f, 0.696902096f},
-std::array<float,2>{0.150487587f, 0.685448706f},
-std::array<float,2>{0.663093746f, 0.41141504f},
-std::array<float,2>{0.254951835f, 0.146983206f},
-std::array<float,2>{0.879048884f, 0.990401328f},
-std::array<float,2>{0.391372532f, 0.869708359f},
-std::array<float,2>{0.761402905f, 0.051518742f},
-std::array<float,2>{0.0710426494f, 0.361914575f},
-std::array<float,2>{0.525031745f, 0.528759897f},
-std::array<float,2>{0.26734671f, 0.656180561f},
-std::array<float,2>{0.90602237f, 0.395029187f},
-std::array<float,2>{0.139503539f, 0.184172511f},
-std::array<float,2>{0.686907291f, 0.965436339f},
-std::array<float,2>{0.0925435051f, 0.839985669f},
-std::array<float,2>{0.506462216f, 0.0229155533f},
-std::array<float,2>{0.387640476f, 0.332521677f},
-std::array<float,2>{0.769868433f, 0.559182942f},
-std::array<float,2>{0.238721266f, 0.624713182f},
-std::array<float,2>{0.716148138f, 0.283926874f},
-std::array<float,2>{0.319975078f, 0.0972077623f},
-std::array<float,2>{0.977184594f, 0.794023097f},
-std::array<float,2>{0.438317597f, 0.893913388f},
-std::array<float,2>{0.819298208f, 0.217857972f},
-std::array<float,2>{0.0319030136f, 0.453634858f},
-std::array<float,2>{0.566325545f, 0.734850466f},
-std::array<float,2>{0.430463821f, 0.51499629f},
-std::array<float,2>{0.782310188f, 0.349865735f},
-std::array<float,2>{0.0971305519f, 0.0365593769f},
-std::array<float,2>{0.558167934f, 0.848928154f},
-std::array<float,2>{0.174286842f, 0.972934723f},
-std::array<float,2>{0.653502524f, 0.137244895f},
-std::array<float,2>{0.286888778f, 0.429202467f},
-std::array<float,2>{0.932562888f, 0.667603552f},
-std::array<float,2>{0.00763122365f, 0.706753731f},
-std::array<float,2>{0.611313343f, 0.482334048f},
-std::array<float,2>{0.492851943f, 0.237424463f},
-std::array<float,2>{0.862107635f, 0.931008458f},
-std::array<float,2>{0.355763972f, 0.758028448f},
-std::array<float,2>{0.942486644f, 0.089190729f},
-std::array<float,2>{0.200407863f, 0.272893786f},
-std::array<float,2>{0.723600864f, 0.571113527f},
-std::array<float,2>{0.447846681f, 0.634650588f},
-std::array<float,2>{0.82368052f, 0.381046534f},
-std::array<float,2>{0.0400793478f, 0.160278425f},
-std::array<float,2>{0.57720238f, 0.95059073f},
-std::array<float,2>{0.248176187f, 0.820614219f},
-std::array<float,2>{0.704837739f, 0.00541622844f},
-std::array<float,2>{0.322906524f, 0.312915385f},
-std::array<float,2>{0.972503722f, 0.538527727f},
-std::array<float,2>{0.0797471851f, 0.599770844f},
-std::array<float,2>{0.514727056f, 0.303887665f},
-std::array<float,2>{0.382425636f, 0.109806933f},
-std::array<float,2>{0.775575042f, 0.802211881f},
-std::array<float,2>{0.27534768f, 0.879155934f},
-std::array<float,2>{0.895562887f, 0.20271875f},
-std::array<float,2>{0.125144035f, 0.444009721f},
-std::array<float,2>{0.679318488f, 0.728856325f},
-std::array<float,2>{0.344461471f, 0.52552402f},
-std::array<float,2>{0.951755345f, 0.3654522f},
-std::array<float,2>{0.193718582f, 0.0494758226f},
-std::array<float,2>{0.730238259f, 0.873410344f},
-std::array<float,2>{0.0131028863f, 0.985009193f},
-std::array<float,2>{0.622709274f, 0.143859327f},
-std::array<float,2>{0.488975048f, 0.407921225f},
-std::array<float,2>{0.873046398f, 0.681419551f},
-std::array<float,2>{0.180011764f, 0.703085184f},
-std::array<float,2>{0.640715659f, 0.486380219f},
-std::array<float,2>{0.29391396f, 0.220639214f},
-std::array<float,2>{0.929266036f, 0.917480886f},
-std::array<float,2>{0.423186928f, 0.773835957f},
-std::array<float,2>{0.794546783f, 0.0671512559f},
-std::array<float,2>{0.105844334f, 0.250838578f},
-std::array<float,2>{0.547938764f, 0.588578463f},
-std::array<float,2>{0.309817493f, 0.738798976f},
-std::array<float,2>{0.917829633f, 0.45762822f},
-std::array<float,2>{0.162736386f, 0.212048277f},
-std::array<float,2>{0.636712551f, 0.895119369f},
-std::array<float,2>{0.122403435f, 0.790011525f},
-std::array<float,2>{0.546239674f, 0.0977371931f},
-std::array<float,2>{0.420296878f, 0.28763929f},
-std::array<float,2>{0.799271405f, 0.619240582f},
-std::array<float,2>{0.215049744f, 0.555714965f},
-std::array<float,2>{0.743003309f, 0.328902364f},
-std::array<float,2>{0.373542547f, 0.0193127804f},
-std::array<float,2>{0.953312993f, 0.836235762f},
-std::array<float,2>{0.480528623f, 0.96202445f},
-std::array<float,2>{0.848288417f, 0.182058826f},
-std::array<float,2>{0.0190748852f, 0.394280732f},
-std::array<float,2>{0.603919685f, 0.649769306f},
-std::array<float,2>{0.401577652f, 0.574539542f},
-std::array<float,2>{0.756228209f, 0.267437637f},
-std::array<float,2>{0.0672068447f, 0.0901074857f},
-std::array<float,2>{0.519944072f, 0.76342839f},
-std::array<float,2>{0.146735698f, 0.936875105f},
-std::array<float,2>{0.668587863f, 0.24158667f},
-std::array<float,2>{0.264359027f, 0.478201419f},
-std::array<float,2>{0.885104358f, 0.709988654f},
-std::array<float,2>{0.051833231f, 0.671265006f},
-std::array<float,2>{0.593702137f, 0.424163789f},
-std::array<float,2>{0.466441274f, 0.134060472f},
-std::array<float,2>{0.839242041f, 0.968803227f},
-std::array<float,2>{0.332244903f, 0.846639156f},
-std::array<float,2>{0.99794662f, 0.0317745171f},
-std::array<float,2>{0.234164715f, 0.344878942f},
-std::array<float,2>{0.690084755f, 0.508958817f},
-std::array<float,2>{0.408050984f, 0.715574861f},
-std::array<float,2>{0.805606723f, 0.46931228f},
-std::array<float,2>{0.116818093f, 0.24291572f},
-std::array<float,2>{0.531620562f, 0.924840689f},
-std::array<float,2>{0.168643668f, 0.754268944f},
-std::array<float,2>{0.625145435f, 0.0789290965f},
-std::array<float,2>{0.300832778f, 0.278857678f},
-std::array<float,2>{0.907164991f, 0.565914273f},
-std::array<float,2>{0.0236381795f, 0.501718998f},
-std::array<float,2>{0.597714484f, 0.358039498f},
-std::array<float,2>{0.471660197f, 0.045592811f},
-std::array<float,2>{0.856989622f, 0.859306335f},
-std::array<float,2>{0.360689491f, 0.983537197f},
-std::array<float,2>{0.965481877f, 0.126965329f},
-std::array<float,2>{0.204202205f, 0.435025305f},
-std::array<float,2>{0.740215361f, 0.657130241f},
-std::array<float,2>{0.250724554f, 0.60997808f},
-std::array<float,2>{0.875471115f, 0.292877406f},
-std::array<float,2>{0.15396896f, 0.102742709f},
-std::array<float,2>{0.659276783f, 0.787710726f},
-std::array<float,2>{0.0757689774f, 0.901727736f},
-std::array<float,2>{0.529107153f, 0.210149288f},
-std::array<float,2>{0.396154493f, 0.461487979f},
-std::array<float,2>{0.764156222f, 0.743012607f},
-std::array<float,2>{0.220155522f, 0.646645665f},
-std::array<float,2>{0.695570707f, 0.401885659f},
-std::array<float,2>{0.342948407f, 0.179172352f},
-std::array<float,2>{0.988791049f, 0.955479562f},
-std::array<float,2>{0.45850271f, 0.835069001f},
-std::array<float,2>{0.828870058f, 0.0291000567f},
-std::array<float,2>{0.0590627566f, 0.339560241f},
-std::array<float,2>{0.579073071f, 0.551564753f},
-std::array<float,2>{0.316397846f, 0.674732089f},
-std::array<float,2>{0.984027863f, 0.416300029f},
-std::array<float,2>{0.237094045f, 0.155396387f},
-std::array<float,2>{0.711988926f, 0.995847702f},
-std::array<float,2>{0.0368106104f, 0.863526225f},
-std::array<float,2>{0.566453636f, 0.062241938f},
-std::array<float,2>{0.445014566f, 0.372525424f},
-std::array<float,2>{0.812536478f, 0.520319045f},
-std::array<float,2>{0.135571837f, 0.579995632f},
-std::array<float,2>{0.681739986f, 0.263853937f},
-std::array<float,2>{0.269725978f, 0.0744581893f},
-std::array<float,2>{0.900678754f, 0.769377232f},
-std::array<float,2>{0.38478902f, 0.911467075f},
-std::array<float,2>{0.767592072f, 0.233602628f},
-std::array<float,2>{0.0888005495f, 0.494780898f},
-std::array<float,2>{0.502398968f, 0.695114911f},
-std::array<float,2>{0.496553004f, 0.539725721f},
-std::array<float,2>{0.864523053f, 0.327108979f},
-std::array<float,2>{0.00136945536f, 0.0138952872f},
-std::array<float,2>{0.614123225f, 0.818812191f},
-std::array<float,2>{0.196642518f, 0.941685736f},
-std::array<float,2>{0.722287357f, 0.165533304f},
-std::array<float,2>{0.351569563f, 0.389476299f},
-std::array<float,2>{0.938795328f, 0.625613213f},
-std::array<float,2>{0.0997668281f, 0.721052289f},
-std::array<float,2>{0.560983717f, 0.45092684f},
-std::array<float,2>{0.435602814f, 0.188720927f},
-std::array<float,2>{0.788360834f, 0.885259867f},
-std::array<float,2>{0.284883529f, 0.812221885f},
-std::array<float,2>{0.936337948f, 0.123254031f},
-std::array<float,2>{0.178546801f, 0.308799028f},
-std::array<float,2>{0.652047634f, 0.602766633f},
-std::array<float,2>{0.426563382f, 0.642643154f},
-std::array<float,2>{0.792233706f, 0.405210197f},
-std::array<float,2>{0.104522727f, 0.173258811f},
-std::array<float,2>{0.551506281f, 0.960904479f},
-std::array<float,2>{0.184387788f, 0.829221189f},
-std::array<float,2>{0.646968246f, 0.0259948522f},
-std::array<float,2>{0.289406151f, 0.341185391f},
-std::array<float,2>{0.922724724f, 0.548614085f},
-std::array<float,2>{0.0106370281f, 0.613363743f},
-std::array<float,2>{0.6203354f, 0.296148807f},
-std::array<float,2>{0.485644639f, 0.10764268f},
-std::array<float,2>{0.868348062f, 0.781962454f},
-std::array<float,2>{0.347892582f, 0.90604347f},
-std::array<float,2>{0.947356045f, 0.20668608f},
-std::array<float,2>{0.18985945f, 0.465202749f},
-std::array<float,2>{0.732629836f, 0.747837067f},
-std::array<float,2>{0.280516118f, 0.504793167f},
-std::array<float,2>{0.893895864f, 0.35477078f},
-std::array<float,2>{0.12935482f, 0.0413268358f},
-std::array<float,2>{0.674774587f, 0.853732586f},
-std::array<float,2>{0.0827988461f, 0.978165448f},
-std::array<float,2>{0.511179447f, 0.130153432f},
-std::array<float,2>{0.375027359f, 0.432792157f},
-std::array<float,2>{0.779266894f, 0.660659552f},
-std::array<float,2>{0.245517761f, 0.714013577f},
-std::array<float,2>{0.708156109f, 0.474431515f},
-std::array<float,2>{0.32559818f, 0.249556959f},
-std::array<float,2>{0.97514993f, 0.92949152f},
-std::array<float,2>{0.450563937f, 0.750823855f},
-std::array<float,2>{0.826549053f, 0.084953174f},
-std::array<float,2>{0.0451194234f, 0.276115656f},
-std::array<float,2>{0.573813677f, 0.569990754f},
-std::array<float,2>{0.330943555f, 0.724416018f},
-std::array<float,2>{0.99382025f, 0.447925299f},
-std::array<float,2>{0.228803128f, 0.193439692f},
-std::array<float,2>{0.693790376f, 0.887957871f},
-std::array<float,2>{0.0470632054f, 0.805361271f},
-std::array<float,2>{0.588157296f, 0.119909622f},
-std::array<float,2>{0.46161598f, 0.307811588f},
-std::array<float,2>{0.841824174f, 0.60711211f},
-std::array<float,2>{0.141516998f, 0.546645582f},
-std::array<float,2>{0.665035665f, 0.323748499f},
-std::array<float,2>{0.259294182f, 0.00947148353f},
-std::array<float,2>{0.887582004f, 0.814853132f},
-std::array<float,2>{0.404733926f, 0.938383222f},
-std::array<float,2>{0.753071666f, 0.168899581f},
-std::array<float,2>{0.0626321137f, 0.385320991f},
-std::array<float,2>{0.51883018f, 0.631326675f},
-std::array<float,2>{0.4782646f, 0.585005045f},
-std::array<float,2>{0.844477594f, 0.25867933f},
-std::array<float,2>{0.0225847568f, 0.0710187629f},
-std::array<float,2>{0.607349515f, 0.770127773f},
-std::array<float,2>{0.214156702f, 0.907192826f},
-std::array<float,2>{0.746510148f, 0.227564231f},
-std::array<float,2>{0.369568735f, 0.497234255f},
-std::array<float,2>{0.958383143f, 0.688006163f},
-std::array<float,2>{0.120378472f, 0.675815403f},
-std::array<float,2>{0.541049182f, 0.41877979f},
-std::array<float,2>{0.41540879f, 0.1519548f},
-std::array<float,2>{0.803932965f, 0.998446822f},
-std::array<float,2>{0.305029631f, 0.860331714f},
-std::array<float,2>{0.919747114f, 0.0582242161f},
-std::array<float,2>{0.157253012f, 0.368360132f},
-std::array<float,2>{0.637434363f, 0.518417597f},
-std::array<float,2>{0.453963816f, 0.698681116f},
-std::array<float,2>{0.832912385f, 0.488465875f},
-std::array<float,2>{0.0551129207f, 0.224499673f},
-std::array<float,2>{0.585475087f, 0.921445668f},
-std::array<float,2>{0.22574982f, 0.780665159f},
-std::array<float,2>{0.699642777f, 0.0627029911f},
-std::array<float,2>{0.338630825f, 0.255910724f},
-std::array<float,2>{0.984668553f, 0.592807472f},
-std::array<float,2>{0.0738863647f, 0.531098187f},
-std::array<float,2>{0.525472522f, 0.36073947f},
-std::array<float,2>{0.393956214f, 0.0539119095f},
-std::array<float,2>{0.758301675f, 0.867758274f},
-std::array<float,2>{0.256115079f, 0.989088118f},
-std::array<float,2>{0.882208109f, 0.144694388f},
-std::array<float,2>{0.149895921f, 0.414061815f},
-std::array<float,2>{0.660169423f, 0.686978459f},
-std::array<float,2>{0.36376828f, 0.596164048f},
-std::array<float,2>{0.962359011f, 0.298648745f},
-std::array<float,2>{0.208335176f, 0.113359429f},
-std::array<float,2>{0.73494494f, 0.79977417f},
-std::array<float,2>{0.0286709536f, 0.875346661f},
-std::array<float,2>{0.596029162f, 0.197155386f},
-std::array<float,2>{0.47324416f, 0.437905937f},
-std::array<float,2>{0.853895187f, 0.733787537f},
-std::array<float,2>{0.165071547f, 0.638944328f},
-std::array<float,2>{0.631666422f, 0.376370549f},
-std::array<float,2>{0.299871594f, 0.158570364f},
-std::array<float,2>{0.910755336f, 0.947296917f},
-std::array<float,2>{0.413567334f, 0.82529819f},
-std::array<float,2>{0.809492052f, 0.00289522228f},
-std::array<float,2>{0.112064458f, 0.317611247f},
-std::array<float,2>{0.538981915f, 0.534551203f},
-std::array<float,2>{0.288415998f, 0.664592862f},
-std::array<float,2>{0.929860175f, 0.426594019f},
-std::array<float,2>{0.173325107f, 0.139284298f},
-std::array<float,2>{0.655939341f, 0.975380838f},
-std::array<float,2>{0.0950442329f, 0.850148559f},
-std::array<float,2>{0.556104958f, 0.0386875719f},
-std::array<float,2>{0.433417559f, 0.34831652f},
-std::array<float,2>{0.783362687f, 0.511765003f},
-std::array<float,2>{0.201750726f, 0.573127568f},
-std::array<float,2>{0.72587198f, 0.270038992f},
-std::array<float,2>{0.359060287f, 0.0871595368f},
-std::array<float,2>{0.944118679f, 0.760555744f},
-std::array<float,2>{0.495449215f, 0.932845473f},
-std::array<float,2>{0.859881341f, 0.235380441f},
-std::array<float,2>{0.00550514041f, 0.484365404f},
-std::array<float,2>{0.61142993f, 0.703270674f},
-std::array<float,2>{0.389288008f, 0.561002851f},
-std::array<float,2>{0.773277819f, 0.33573103f},
-std::array<float,2>{0.0905141309f, 0.0205792077f},
-std::array<float,2>{0.504611015f, 0.841804326f},
-std::array<float,2>{0.138657331f, 0.967618883f},
-std::array<float,2>{0.683703661f, 0.187132388f},
-std::array<float,2>{0.269330144f, 0.396926939f},
-std::array<float,2>{0.90260601f, 0.653589427f},
-std::array<float,2>{0.0336636379f, 0.738242984f},
-std::array<float,2>{0.562573552f, 0.455995142f},
-std::array<float,2>{0.440190196f, 0.215754062f},
-std::array<float,2>{0.816648901f, 0.891956568f},
-std::array<float,2>{0.31804806f, 0.795695305f},
-std::array<float,2>{0.979559243f, 0.0948465466f},
-std::array<float,2>{0.240858346f, 0.282147318f},
-std::array<float,2>{0.718307137f, 0.622971058f},
-std::array<float,2>{0.491712987f, 0.682692349f},
-std::array<float,2>{0.873539925f, 0.410124868f},
-std::array<float,2>{0.0136744455f, 0.142063498f},
-std::array<float,2>{0.624681532f, 0.986768663f},
-std::array<float,2>{0.191482052f, 0.871099174f},
-std::array<float,2>{0.727605999f, 0.0486889891f},
-std::array<float,2>{0.346896768f, 0.36367622f},
-std::array<float,2>{0.950884461f, 0.525386572f},
-std::array<float,2>{0.108661994f, 0.587865114f},
-std::array<float,2>{0.550112247f, 0.252828449f},
-std::array<float,2>{0.42465049f, 0.0688702017f},
-std::array<float,2>{0.796460152f, 0.776343226f},
-std::array<float,2>{0.29618153f, 0.915156245f},
-std::array<float,2>{0.927309334f, 0.22193338f},
-std::array<float,2>{0.18316476f, 0.486200184f},
-std::array<float,2>{0.642659187f, 0.699503064f},
-std::array<float,2>{0.321030378f, 0.535811722f},
-std::array<float,2>{0.969634771f, 0.315414369f},
-std::array<float,2>{0.246889129f, 0.00770072406f},
-std::array<float,2>{0.706258476f, 0.823754072f},
-std::array<float,2>{0.0413052142f, 0.95268172f},
-std::array<float,2>{0.575622797f, 0.162829146f},
-std::array<float,2>{0.446316242f, 0.379361421f},
-std::array<float,2>{0.821555853f, 0.635076344f},
-std::array<float,2>{0.128490418f, 0.727945685f},
-std::array<float,2>{0.676702857f, 0.442828983f},
-std::array<float,2>{0.276840806f, 0.201148301f},
-std::array<float,2>{0.897873342f, 0.881756842f},
-std::array<float,2>{0.38011381f, 0.803829789f},
-std::array<float,2>{0.775031507f, 0.112355836f},
-std::array<float,2>{0.0818600655f, 0.302384764f},
-std::array<float,2>{0.513566434f, 0.599027336f},
-std::array<float,2>{0.262509435f, 0.708212554f},
-std::array<float,2>{0.883096397f, 0.479901135f},
-std::array<float,2>{0.144715995f, 0.238798946f},
-std::array<float,2>{0.670170069f, 0.934761643f},
-std::array<float,2>{0.0687889084f, 0.76369375f},
-std::array<float,2>{0.52200824f, 0.0924567729f},
-std::array<float,2>{0.400359631f, 0.268296957f},
-std::array<float,2>{0.75545162f, 0.576361716f},
-std::array<float,2>{0.230744481f, 0.511119783f},
-std::array<float,2>{0.689357877f, 0.347038716f},
-std::array<float,2>{0.334853172f, 0.0345421098f},
-std::array<float,2>{0.998652637f, 0.845230103f},
-std::array<float,2>{0.467868805f, 0.971703827f},
-std::array<float,2>{0.836245537f, 0.135184363f},
-std::array<float,2>{0.0537368618f, 0.422191292f},
-std::array<float,2>{0.591409087f, 0.668078005f},
-std::array<float,2>{0.4191145f, 0.617385924f},
-std::array<float,2>{0.798641384f, 0.286229193f},
-std::array<float,2>{0.123583339f, 0.101371802f},
-std::array<float,2>{0.543094873f, 0.791434646f},
-std::array<float,2>{0.160733536f, 0.897669137f},
-std::array<float,2>{0.6344437f, 0.213235468f},
-std::array<float,2>{0.311334163f, 0.459776044f},
-std::array<float,2>{0.915558636f, 0.741904914f},
-std::array<float,2>{0.016971156f, 0.651208758f},
-std::array<float,2>{0.602259338f, 0.391482651f},
-std::array<float,2>{0.482512802f, 0.179733679f},
-std::array<float,2>{0.849795938f, 0.964176297f},
-std::array<float,2>{0.372620821f, 0.838388383f},
-std::array<float,2>{0.955281138f, 0.0172302313f},
-std::array<float,2>{0.217537299f, 0.330276281f},
-std::array<float,2>{0.745394349f, 0.558537722f},
-std::array<float,2>{0.396796912f, 0.744331241f},
-std::array<float,2>{0.761748791f, 0.463436633f},
-std::array<float,2>{0.0779107735f, 0.208463088f},
-std::array<float,2>{0.529670298f, 0.898913026f},
-std::array<float,2>{0.154522687f, 0.786696732f},
-std::array<float,2>{0.656707466f, 0.104877234f},
-std::array<float,2>{0.25284335f, 0.290690958f},
-std::array<float,2>{0.878860593f, 0.613020122f},
-std::array<float,2>{0.0610222779f, 0.553592622f},
-std::array<float,2>{0.580395818f, 0.336532861f},
-std::array<float,2>{0.460775077f, 0.0308884699f},
-std::array<float,2>{0.83030653f, 0.833150208f},
-std::array<float,2>{0.3417961f, 0.954281569f},
-std::array<float,2>{0.99130553f, 0.177359194f},
-std::array<float,2>{0.221804202f, 0.399100393f},
-std::array<float,2>{0.697309673f, 0.64486289f},
-std::array<float,2>{0.304494023f, 0.564377546f},
-std::array<float,2>{0.90986222f, 0.279834241f},
-std::array<float,2>{0.17187421f, 0.0815146565f},
-std::array<float,2>{0.627095222f, 0.756919086f},
-std::array<float,2>{0.113990262f, 0.922086477f},
-std::array<float,2>{0.533281505f, 0.244245708f},
-std::array<float,2>{0.408733726f, 0.471495718f},
-std::array<float,2>{0.808248281f, 0.71868819f},
-std::array<float,2>{0.205699593f, 0.659417152f},
-std::array<float,2>{0.740530908f, 0.436994374f},
-std::array<float,2>{0.361519396f, 0.126952246f},
-std::array<float,2>{0.967865705f, 0.98199445f},
-std::array<float,2>{0.468824655f, 0.856611371f},
-std::array<float,2>{0.859073102f, 0.0437073074f},
-std::array<float,2>{0.0258312803f, 0.356542587f},
-std::array<float,2>{0.600278139f, 0.50255692f},
-std::array<float,2>{0.354645431f, 0.628391802f},
-std::array<float,2>{0.940935373f, 0.387113899f},
-std::array<float,2>{0.197491243f, 0.166969359f},
-std::array<float,2>{0.720099092f, 0.943716347f},
-std::array<float,2>{0.00284663518f, 0.81698364f},
-std::array<float,2>{0.616754651f, 0.0118470825f},
-std::array<float,2>{0.498336136f, 0.324433535f},
-std::array<float,2>{0.865372598f, 0.541404366f},
-std::array<float,2>{0.176291257f, 0.604998291f},
-std::array<float,2>{0.649838209f, 0.31153354f},
-std::array<float,2>{0.282045066f, 0.122885197f},
-std::array<float,2>{0.935512483f, 0.80912286f},
-std::array<float,2>{0.434900641f, 0.883004129f},
-std::array<float,2>{0.785591006f, 0.18954213f},
-std::array<float,2>{0.0979843512f, 0.452274978f},
-std::array<float,2>{0.558885515f, 0.72026521f},
-std::array<float,2>{0.441526622f, 0.523164213f},
-std::array<float,2>{0.815831959f, 0.373386472f},
-std::array<float,2>{0.0377925858f, 0.0600311644f},
-std::array<float,2>{0.568588495f, 0.86609447f},
-std::array<float,2>{0.236179516f, 0.994135141f},
-std::array<float,2>{0.713438869f, 0.153403103f},
-std::array<float,2>{0.313081115f, 0.415631413f},
-std::array<float,2>{0.981645167f, 0.672991991f},
-std::array<float,2>{0.0871123448f, 0.693083346f},
-std::array<float,2>{0.501535237f, 0.49389711f},
-std::array<float,2>{0.38395682f, 0.230683476f},
-std::array<float,2>{0.767538607f, 0.913347423f},
-std::array<float,2>{0.271698207f, 0.766349435f},
-std::array<float,2>{0.898475349f, 0.0767198801f},
-std::array<float,2>{0.133671328f, 0.262907147f},
-std::array<float,2>{0.681082785f, 0.580843687f},
-std::array<float,2>{0.432716846f, 0.667205393f},
-std::array<float,2>{0.783782542f, 0.429089069f},
-std::array<float,2>{0.0954173058f, 0.137174562f},
-std::array<float,2>{0.556290388f, 0.973150909f},
-std::array<float,2>{0.173582241f, 0.84913528f},
-std::array<float,2>{0.655540943f, 0.0370068923f},
-std::array<float,2>{0.289013743f, 0.350123078f},
-std::array<float,2>{0.930634677f, 0.515392601f},
-std::array<float,2>{0.00532336161f, 0.570626855f},
-std::array<float,2>{0.61221683f, 0.273150712f},
-std::array<float,2>{0.495704085f, 0.0895047709f},
-std::array<float,2>{0.859594703f, 0.758701801f},
-std::array<float,2>{0.358712107f, 0.93156004f},
-std::array<float,2>{0.943559647f, 0.238075495f},
-std::array<float,2>{0.201578856f, 0.481788963f},
-std::array<float,2>{0.726173639f, 0.706466317f},
-std::array<float,2>{0.268813133f, 0.558658421f},
-std::array<float,2>{0.9032951f, 0.332248777f},
-std::array<float,2>{0.138061985f, 0.0230624471f},
-std::array<float,2>{0.68428427f, 0.840707839f},
-std::array<float,2>{0.0902651548f, 0.965247273f},
-std::array<float,2>{0.504048169f, 0.183915362f},
-std::array<float,2>{0.389088154f, 0.394664735f},
-std::array<float,2>{0.772744954f, 0.655526996f},
-std::array<float,2>{0.240666747f, 0.735134661f},
-std::array<float,2>{0.717805803f, 0.4533903f},
-std::array<float,2>{0.317727238f, 0.218628138f},
-std::array<float,2>{0.980193079f, 0.894518971f},
-std::array<float,2>{0.439639837f, 0.794740856f},
-std::array<float,2>{0.8170138f, 0.0967427418f},
-std::array<float,2>{0.0338311642f, 0.283307016f},
-std::array<float,2>{0.563143194f, 0.624289513f},
-std::array<float,2>{0.338192195f, 0.69661665f},
-std::array<float,2>{0.985338807f, 0.492001504f},
-std::array<float,2>{0.226123586f, 0.225416765f},
-std::array<float,2>{0.700015128f, 0.918089747f},
-std::array<float,2>{0.0553134717f, 0.778201044f},
-std::array<float,2>{0.585218668f, 0.0662050247f},
-std::array<float,2>{0.453166157f, 0.254900306f},
-std::array<float,2>{0.832457542f, 0.591433644f},
-std::array<float,2>{0.150216013f, 0.529177725f},
-std::array<float,2>{0.660713494f, 0.361740559f},
-std::array<float,2>{0.256702632f, 0.0509797148f},
-std::array<float,2>{0.882564783f, 0.869556844f},
-std::array<float,2>{0.394344419f, 0.990823448f},
-std::array<float,2>{0.758008897f, 0.146832258f},
-std::array<float,2>{0.0735572129f, 0.411931008f},
-std::array<float,2>{0.525880098f, 0.684904516f},
-std::array<float,2>{0.472975135f, 0.593871117f},
-std::array<float,2>{0.854130924f, 0.300404489f},
-std::array<float,2>{0.0291806161f, 0.115829289f},
-std::array<float,2>{0.596444666f, 0.798416018f},
-std::array<float,2>{0.208751842f, 0.878145933f},
-std::array<float,2>{0.734451354f, 0.197947353f},
-std::array<float,2>{0.364157319f, 0.43976301f},
-std::array<float,2>{0.962748528f, 0.732275248f},
-std::array<float,2>{0.111537755f, 0.63727814f},
-std::array<float,2>{0.538278759f, 0.378308505f},
-std::array<float,2>{0.41379565f, 0.15640226f},
-std::array<float,2>{0.80861783f, 0.946479499f},
-std::array<float,2>{0.300302893f, 0.826786458f},
-std::array<float,2>{0.910444915f, 0.000385154708f},
-std::array<float,2>{0.165997684f, 0.31859234f},
-std::array<float,2>{0.631247103f, 0.531546533f},
-std::array<float,2>{0.461362153f, 0.725962102f},
-std::array<float,2>{0.842719316f, 0.445880681f},
-std::array<float,2>{0.0476887822f, 0.193319425f},
-std::array<float,2>{0.588522971f, 0.888905823f},
-std::array<float,2>{0.229309916f, 0.808269918f},
-std::array<float,2>{0.694024861f, 0.117911197f},
-std::array<float,2>{0.330549479f, 0.306378186f},
-std::array<float,2>{0.99347055f, 0.608971894f},
-std::array<float,2>{0.0632961467f, 0.544070721f},
-std::array<float,2>{0.519222021f, 0.321124047f},
-std::array<float,2>{0.405087054f, 0.0101397056f},
-std::array<float,2>{0.753793657f, 0.812642097f},
-std::array<float,2>{0.258803666f, 0.94122225f},
-std::array<float,2>{0.887022138f, 0.171715319f},
-std::array<float,2>{0.140902385f, 0.382866114f},
-std::array<float,2>{0.664474607f, 0.629493475f},
-std::array<float,2>{0.369687408f, 0.582986593f},
-std::array<float,2>{0.958661497f, 0.261412561f},
-std::array<float,2>{0.214472651f, 0.0739103928f},
-std::array<float,2>{0.746692002f, 0.773375869f},
-std::array<float,2>{0.0233007893f, 0.909678936f},
-std::array<float,2>{0.606455386f, 0.230163574f},
-std::array<float,2>{0.477803797f, 0.499211431f},
-std::array<float,2>{0.843807936f, 0.691159904f},
-std::array<float,2>{0.15810667f, 0.67802912f},
-std::array<float,2>{0.637012064f, 0.4203237f},
-std::array<float,2>{0.305626303f, 0.149924055f},
-std::array<float,2>{0.919257939f, 0.997233868f},
-std::array<float,2>{0.415777802f, 0.861820579f},
-std::array<float,2>{0.804288387f, 0.0553957559f},
-std::array<float,2>{0.12077108f, 0.370168209f},
-std::array<float,2>{0.541549981f, 0.51729238f},
-std::array<float,2>{0.28968668f, 0.640954077f},
-std::array<float,2>{0.922353208f, 0.403499126f},
-std::array<float,2>{0.184020132f, 0.175466523f},
-std::array<float,2>{0.647234678f, 0.958457828f},
-std::array<float,2>{0.105374001f, 0.830160201f},
-std::array<float,2>{0.551104724f, 0.0248607285f},
-std::array<float,2>{0.425856858f, 0.342930287f},
-std::array<float,2>{0.792558074f, 0.549028099f},
-std::array<float,2>{0.190292865f, 0.616845489f},
-std::array<float,2>{0.733084917f, 0.294029206f},
-std::array<float,2>{0.34849456f, 0.105705976f},
-std::array<float,2>{0.948176384f, 0.783648729f},
-std::array<float,2>{0.486097753f, 0.903198779f},
-std::array<float,2>{0.868856132f, 0.204406857f},
-std::array<float,2>{0.00999962445f, 0.467135519f},
-std::array<float,2>{0.620966136f, 0.749804199f},
-std::array<float,2>{0.375807464f, 0.506756067f},
-std::array<float,2>{0.778557897f, 0.353225231f},
-std::array<float,2>{0.0823853165f, 0.0393563583f},
-std::array<float,2>{0.5116328f, 0.85348779f},
-std::array<float,2>{0.12968497f, 0.978897214f},
-std::array<float,2>{0.673890412f, 0.13162066f},
-std::array<float,2>{0.280787498f, 0.430352628f},
-std::array<float,2>{0.894253671f, 0.662386298f},
-std::array<float,2>{0.045414187f, 0.711754441f},
-std::array<float,2>{0.573595047f, 0.475220144f},
-std::array<float,2>{0.450863838f, 0.247428074f},
-std::array<float,2>{0.826849103f, 0.927286506f},
-std::array<float,2>{0.325770229f, 0.752630591f},
-std::array<float,2>{0.97475189f, 0.0833647773f},
-std::array<float,2>{0.245912224f, 0.27422902f},
-std::array<float,2>{0.708612442f, 0.567401409f},
-std::array<float,2>{0.498625964f, 0.625052333f},
-std::array<float,2>{0.866059661f, 0.388924062f},
-std::array<float,2>{0.00220578234f, 0.165460438f},
-std::array<float,2>{0.616636515f, 0.942126632f},
-std::array<float,2>{0.198071674f, 0.819059074f},
-std::array<float,2>{0.720615625f, 0.0142131792f},
-std::array<float,2>{0.355284035f, 0.326531172f},
-std::array<float,2>{0.940754473f, 0.539102256f},
-std::array<float,2>{0.0984663293f, 0.603169024f},
-std::array<float,2>{0.559287965f, 0.309364289f},
-std::array<float,2>{0.435530514f, 0.123632371f},
-std::array<float,2>{0.78569001f, 0.811971188f},
-std::array<float,2>{0.281337917f, 0.884917498f},
-std::array<float,2>{0.934747994f, 0.189120993f},
-std::array<float,2>{0.175852999f, 0.450626493f},
-std::array<float,2>{0.650075495f, 0.721235812f},
-std::array<float,2>{0.312903404f, 0.519917428f},
-std::array<float,2>{0.982120991f, 0.372641563f},
-std::array<float,2>{0.235407308f, 0.0615634769f},
-std::array<float,2>{0.713032663f, 0.864126503f},
-std::array<float,2>{0.0372503996f, 0.995479286f},
-std::array<float,2>{0.569196522f, 0.155849084f},
-std::array<float,2>{0.441986948f, 0.41670683f},
-std::array<float,2>{0.81599617f, 0.673984051f},
-std::array<float,2>{0.133021474f, 0.694684863f},
-std::array<float,2>{0.681489646f, 0.494339108f},
-std::array<float,2>{0.272401094f, 0.234329104f},
-std::array<float,2>{0.899251521f, 0.911866784f},
-std::array<float,2>{0.384695143f, 0.76872474f},
-std::array<float,2>{0.76665014f, 0.0748452097f},
-std::array<float,2>{0.0878018215f, 0.264553547f},
-std::array<float,2>{0.501011372f, 0.579559684f},
-std::array<float,2>{0.252131701f, 0.742529392f},
-std::array<float,2>{0.878118157f, 0.461121082f},
-std::array<float,2>{0.154814437f, 0.210783139f},
-std::array<float,2>{0.657023072f, 0.901979327f},
-std::array<float,2>{0.0772378296f, 0.787397504f},
-std::array<float,2>{0.530172944f, 0.103491224f},
-std::array<float,2>{0.397453398f, 0.292159438f},
-std::array<float,2>{0.762352526f, 0.609753132f},
-std::array<float,2>{0.222298265f, 0.551026225f},
-std::array<float,2>{0.698183417f, 0.33891964f},
-std::array<float,2>{0.341176033f, 0.028641209f},
-std::array<float,2>{0.992082179f, 0.835590601f},
-std::array<float,2>{0.460183799f, 0.955821693f},
-std::array<float,2>{0.830825806f, 0.17940174f},
-std::array<float,2>{0.061484579f, 0.401489347f},
-std::array<float,2>{0.581020415f, 0.64744246f},
-std::array<float,2>{0.408406675f, 0.566151679f},
-std::array<float,2>{0.807744801f, 0.278779298f},
-std::array<float,2>{0.113300659f, 0.0785122737f},
-std::array<float,2>{0.534106433f, 0.754643261f},
-std::array<float,2>{0.171352535f, 0.925405681f},
-std::array<float,2>{0.627805114f, 0.242647797f},
-std::array<float,2>{0.303863645f, 0.46912393f},
-std::array<float,2>{0.909456491f, 0.715203524f},
-std::array<float,2>{0.0258861743f, 0.656267047f},
-std::array<float,2>{0.600085497f, 0.435151488f},
-std::array<float,2>{0.46955204f, 0.127800956f},
-std::array<float,2>{0.858577847f, 0.984337926f},
-std::array<float,2>{0.36212182f, 0.858553052f},
-std::array<float,2>{0.968515337f, 0.0452168435f},
-std::array<float,2>{0.205165714f, 0.357567906f},
-std::array<float,2>{0.740893126f, 0.501401901f},
-std::array<float,2>{0.399850309f, 0.7107023f},
-std::array<float,2>{0.754891753f, 0.478016615f},
-std::array<float,2>{0.0690031573f, 0.241712555f},
-std::array<float,2>{0.521882176f, 0.937127411f},
-std::array<float,2>{0.1450883f, 0.762699783f},
-std::array<float,2>{0.670696259f, 0.090479508f},
-std::array<float,2>{0.262078971f, 0.26669839f},
-std::array<float,2>{0.883681118f, 0.574850976f},
-std::array<float,2>{0.0544930324f, 0.509758711f},
-std::array<float,2>{0.591221273f, 0.345436871f},
-std::array<float,2>{0.46862182f, 0.0316205435f},
-std::array<float,2>{0.836693943f, 0.846053481f},
-std::array<float,2>{0.334124386f, 0.969553351f},
-std::array<float,2>{0.998471022f, 0.134293094f},
-std::array<float,2>{0.231256053f, 0.424360216f},
-std::array<float,2>{0.688704193f, 0.67139709f},
-std::array<float,2>{0.310747236f, 0.619645834f},
-std::array<float,2>{0.915220916f, 0.287584394f},
-std::array<float,2>{0.160456851f, 0.0982123092f},
-std::array<float,2>{0.633791625f, 0.789298356f},
-std::array<float,2>{0.123522349f, 0.894839406f},
-std::array<float,2>{0.543496609f, 0.212563843f},
-std::array<float,2>{0.419914484f, 0.457081527f},
-std::array<float,2>{0.798056483f, 0.73848325f},
-std::array<float,2>{0.217232734f, 0.649990141f},
-std::array<float,2>{0.745879471f, 0.393822372f},
-std::array<float,2>{0.372308344f, 0.182547301f},
-std::array<float,2>{0.955900013f, 0.962832391f},
-std::array<float,2>{0.482911944f, 0.836544931f},
-std::array<float,2>{0.850158453f, 0.0188261438f},
-std::array<float,2>{0.0172292739f, 0.328214794f},
-std::array<float,2>{0.601599932f, 0.556435287f},
-std::array<float,2>{0.347610533f, 0.680837572f},
-std::array<float,2>{0.950199187f, 0.407315075f},
-std::array<float,2>{0.192013234f, 0.144367442f},
-std::array<float,2>{0.728163183f, 0.984377801f},
-std::array<float,2>{0.0144570116f, 0.873840034f},
-std::array<float,2>{0.624295831f, 0.0491355211f},
-std::array<float,2>{0.491363287f, 0.366143405f},
-std::array<float,2>{0.873140633f, 0.526130736f},
-std::array<float,2>{0.182637349f, 0.588240802f},
-std::array<float,2>{0.643101394f, 0.250276595f},
-std::array<float,2>{0.296511203f, 0.0666156486f},
-std::array<float,2>{0.927066863f, 0.774033189f},
-std::array<float,2>{0.423855007f, 0.917340815f},
-std::array<float,2>{0.796092451f, 0.219852895f},
-std::array<float,2>{0.10896302f, 0.486907184f},
-std::array<float,2>{0.550400555f, 0.702293158f},
-std::array<float,2>{0.447033435f, 0.539002895f},
-std::array<float,2>{0.822112203f, 0.313239753f},
-std::array<float,2>{0.0416906774f, 0.0053116465f},
-std::array<float,2>{0.575690269f, 0.82103312f},
-std::array<float,2>{0.24646686f, 0.950737178f},
-std::array<float,2>{0.706760287f, 0.160727605f},
-std::array<float,2>{0.320545286f, 0.381762892f},
-std::array<float,2>{0.968865514f, 0.63419807f},
-std::array<float,2>{0.0814830661f, 0.729272544f},
-std::array<float,2>{0.512805343f, 0.44354105f},
-std::array<float,2>{0.380377084f, 0.202437386f},
-std::array<float,2>{0.774887919f, 0.879835963f},
-std::array<float,2>{0.277321488f, 0.802490115f},
-std::array<float,2>{0.898044288f, 0.109892212f},
-std::array<float,2>{0.127941519f, 0.304200023f},
-std::array<float,2>{0.675963938f, 0.60026145f},
-std::array<float,2>{0.387191951f, 0.653889775f},
-std::array<float,2>{0.770333946f, 0.397362024f},
-std::array<float,2>{0.0922576785f, 0.186818674f},
-std::array<float,2>{0.506284654f, 0.967141211f},
-std::array<float,2>{0.138857514f, 0.842656076f},
-std::array<float,2>{0.687157512f, 0.0213597082f},
-std::array<float,2>{0.266654283f, 0.335398406f},
-std::array<float,2>{0.905449748f, 0.56128788f},
-std::array<float,2>{0.0314747393f, 0.622195542f},
-std::array<float,2>{0.565872252f, 0.281591982f},
-std::array<float,2>{0.437882274f, 0.0956555456f},
-std::array<float,2>{0.818600416f, 0.794940054f},
-std::array<float,2>{0.319704145f, 0.892261565f},
-std::array<float,2>{0.976914167f, 0.214993179f},
-std::array<float,2>{0.239109516f, 0.45545271f},
-std::array<float,2>{0.716586411f, 0.737641454f},
-std::array<float,2>{0.286343098f, 0.51267314f},
-std::array<float,2>{0.931766212f, 0.348015189f},
-std::array<float,2>{0.174665779f, 0.0381890796f},
-std::array<float,2>{0.653972864f, 0.849897623f},
-std::array<float,2>{0.0974865034f, 0.975046992f},
-std::array<float,2>{0.55780673f, 0.138960972f},
-std::array<float,2>{0.429921865f, 0.426222682f},
-std::array<float,2>{0.783167183f, 0.664375067f},
-std::array<float,2>{0.201022699f, 0.70365715f},
-std::array<float,2>{0.723011017f, 0.483696103f},
-std::array<float,2>{0.356109947f, 0.236212641f},
-std::array<float,2>{0.943043232f, 0.933313429f},
-std::array<float,2>{0.492401928f, 0.759970069f},
-std::array<float,2>{0.861560524f, 0.0875899866f},
-std::array<float,2>{0.00724859582f, 0.269603521f},
-std::array<float,2>{0.61060071f, 0.572662175f},
-std::array<float,2>{0.366707951f, 0.734293401f},
-std::array<float,2>{0.964250326f, 0.438033253f},
-std::array<float,2>{0.210216448f, 0.196545258f},
-std::array<float,2>{0.738058031f, 0.875700593f},
-std::array<float,2>{0.0296054985f, 0.79885751f},
-std::array<float,2>{0.593941748f, 0.114187002f},
-std::array<float,2>{0.475658685f, 0.298142195f},
-std::array<float,2>{0.852225244f, 0.596431732f},
-std::array<float,2>{0.166216195f, 0.534876406f},
-std::array<float,2>{0.630739987f, 0.317951292f},
-std::array<float,2>{0.297882318f, 0.00242983177f},
-std::array<float,2>{0.912471414f, 0.825725555f},
-std::array<float,2>{0.411189318f, 0.948009789f},
-std::array<float,2>{0.812126398f, 0.159084156f},
-std::array<float,2>{0.109772369f, 0.376932472f},
-std::array<float,2>{0.536836028f, 0.639605939f},
-std::array<float,2>{0.456713259f, 0.593459606f},
-std::array<float,2>{0.83590579f, 0.256399959f},
-std::array<float,2>{0.0566888079f, 0.0632467568f},
-std::array<float,2>{0.582950652f, 0.780859947f},
-std::array<float,2>{0.222870544f, 0.920962334f},
-std::array<float,2>{0.702759087f, 0.223989502f},
-std::array<float,2>{0.336358339f, 0.488808453f},
-std::array<float,2>{0.98649621f, 0.699164689f},
-std::array<float,2>{0.0706860721f, 0.687125385f},
-std::array<float,2>{0.524820268f, 0.413140208f},
-std::array<float,2>{0.390748888f, 0.14512229f},
-std::array<float,2>{0.760810971f, 0.988590539f},
-std::array<float,2>{0.255376548f, 0.867512763f},
-std::array<float,2>{0.879699886f, 0.0543415546f},
-std::array<float,2>{0.15098688f, 0.361208737f},
-std::array<float,2>{0.663774788f, 0.530409694f},
-std::array<float,2>{0.479209483f, 0.687838078f},
-std::array<float,2>{0.846464276f, 0.497822165f},
-std::array<float,2>{0.0214586053f, 0.228437468f},
-std::array<float,2>{0.608838201f, 0.906450272f},
-std::array<float,2>{0.212671652f, 0.769917905f},
-std::array<float,2>{0.748551607f, 0.0704908967f},
-std::array<float,2>{0.367913663f, 0.257858604f},
-std::array<float,2>{0.960515082f, 0.585783839f},
-std::array<float,2>{0.117878638f, 0.517677486f},
-std::array<float,2>{0.540991247f, 0.368770868f},
-std::array<float,2>{0.416257471f, 0.0580036603f},
-std::array<float,2>{0.801394403f, 0.859810412f},
-std::array<float,2>{0.306997657f, 0.998815715f},
-std::array<float,2>{0.921121836f, 0.151624501f},
-std::array<float,2>{0.158550277f, 0.418437988f},
-std::array<float,2>{0.639090538f, 0.676471829f},
-std::array<float,2>{0.32863462f, 0.606693268f},
-std::array<float,2>{0.995532393f, 0.30841732f},
-std::array<float,2>{0.22797592f, 0.119366072f},
-std::array<float,2>{0.69217521f, 0.805167496f},
-std::array<float,2>{0.0498259068f, 0.888213873f},
-std::array<float,2>{0.587855875f, 0.194125369f},
-std::array<float,2>{0.463217944f, 0.447270155f},
-std::array<float,2>{0.84023422f, 0.724114478f},
-std::array<float,2>{0.143366516f, 0.631549239f},
-std::array<float,2>{0.6660164f, 0.385093093f},
-std::array<float,2>{0.260556161f, 0.16816856f},
-std::array<float,2>{0.889891863f, 0.937933981f},
-std::array<float,2>{0.402965069f, 0.81497097f},
-std::array<float,2>{0.751249611f, 0.009235912f},
-std::array<float,2>{0.064713642f, 0.323709279f},
-std::array<float,2>{0.517198622f, 0.546199739f},
-std::array<float,2>{0.278680086f, 0.660344779f},
-std::array<float,2>{0.891486108f, 0.433416724f},
-std::array<float,2>{0.131190136f, 0.130450502f},
-std::array<float,2>{0.672304451f, 0.977592528f},
-std::array<float,2>{0.0857636333f, 0.854096472f},
-std::array<float,2>{0.50786829f, 0.0415635556f},
-std::array<float,2>{0.377595633f, 0.355226219f},
-std::array<float,2>{0.780689716f, 0.504058421f},
-std::array<float,2>{0.242311999f, 0.569556355f},
-std::array<float,2>{0.709825337f, 0.275673985f},
-std::array<float,2>{0.326679379f, 0.0843537673f},
-std::array<float,2>{0.973583758f, 0.750148535f},
-std::array<float,2>{0.4519777f, 0.92909205f},
-std::array<float,2>{0.825553298f, 0.24950619f},
-std::array<float,2>{0.0432629138f, 0.473769158f},
-std::array<float,2>{0.572078943f, 0.714639664f},
-std::array<float,2>{0.428705394f, 0.547977448f},
-std::array<float,2>{0.789591372f, 0.341374427f},
-std::array<float,2>{0.103495009f, 0.02551906f},
-std::array<float,2>{0.553386092f, 0.829883754f},
-std::array<float,2>{0.186486959f, 0.960254431f},
-std::array<float,2>{0.645330548f, 0.173673213f},
-std::array<float,2>{0.292776346f, 0.404342175f},
-std::array<float,2>{0.924018145f, 0.643541098f},
-std::array<float,2>{0.00851213653f, 0.747335434f},
-std::array<float,2>{0.618203104f, 0.465431392f},
-std::array<float,2>{0.486442059f, 0.206074223f},
-std::array<float,2>{0.871004045f, 0.905535877f},
-std::array<float,2>{0.349722147f, 0.7815364f},
-std::array<float,2>{0.945846379f, 0.108078524f},
-std::array<float,2>{0.188730597f, 0.296460956f},
-std::array<float,2>{0.731046498f, 0.613778532f},
-std::array<float,2>{0.444351047f, 0.673495591f},
-std::array<float,2>{0.813144088f, 0.415264875f},
-std::array<float,2>{0.0362071507f, 0.154195949f},
-std::array<float,2>{0.567324877f, 0.993234456f},
-std::array<float,2>{0.236717165f, 0.865465283f},
-std::array<float,2>{0.712607086f, 0.060472358f},
-std::array<float,2>{0.315618962f, 0.373761147f},
-std::array<float,2>{0.983534694f, 0.52264291f},
-std::array<float,2>{0.0882423744f, 0.580295086f},
-std::array<float,2>{0.50290817f, 0.263559878f},
-std::array<float,2>{0.385458678f, 0.0766572431f},
-std::array<float,2>{0.768120706f, 0.76582551f},
-std::array<float,2>{0.27013272f, 0.913643658f},
-std::array<float,2>{0.90136683f, 0.231080145f},
-std::array<float,2>{0.135161906f, 0.493606865f},
-std::array<float,2>{0.682134986f, 0.692739904f},
-std::array<float,2>{0.35227102f, 0.541893601f},
-std::array<float,2>{0.939256549f, 0.325162858f},
-std::array<float,2>{0.196871832f, 0.0122708092f},
-std::array<float,2>{0.721689641f, 0.81682688f},
-std::array<float,2>{0.00151368976f, 0.943897128f},
-std::array<float,2>{0.613463104f, 0.166176811f},
-std::array<float,2>{0.496908337f, 0.387559861f},
-std::array<float,2>{0.864753842f, 0.628515482f},
-std::array<float,2>{0.178167999f, 0.719937801f},
-std::array<float,2>{0.651492178f, 0.452976555f},
-std::array<float,2>{0.284387976f, 0.189971536f},
-std::array<float,2>{0.93570888f, 0.883719385f},
-std::array<float,2>{0.43620643f, 0.808934689f},
-std::array<float,2>{0.788756311f, 0.12209817f},
-std::array<float,2>{0.100192174f, 0.31210801f},
-std::array<float,2>{0.561119378f, 0.60494709f},
-std::array<float,2>{0.301705897f, 0.71817863f},
-std::array<float,2>{0.9067204f, 0.471156031f},
-std::array<float,2>{0.168451965f, 0.245027214f},
-std::array<float,2>{0.625913024f, 0.922758758f},
-std::array<float,2>{0.116341084f, 0.75745523f},
-std::array<float,2>{0.532182455f, 0.0818255395f},
-std::array<float,2>{0.407459825f, 0.279753357f},
-std::array<float,2>{0.80485028f, 0.563518405f},
-std::array<float,2>{0.204990193f, 0.501972318f},
-std::array<float,2>{0.739296973f, 0.357186347f},
-std::array<float,2>{0.361317307f, 0.0434242561f},
-std::array<float,2>{0.965019941f, 0.857058227f},
-std::array<float,2>{0.471017241f, 0.98183769f},
-std::array<float,2>{0.856788218f, 0.12640433f},
-std::array<float,2>{0.0241631679f, 0.437498093f},
-std::array<float,2>{0.598290443f, 0.660057127f},
-std::array<float,2>{0.395683736f, 0.612380624f},
-std::array<float,2>{0.764187694f, 0.290473372f},
-std::array<float,2>{0.075399369f, 0.10535273f},
-std::array<float,2>{0.528574586f, 0.786593139f},
-std::array<float,2>{0.153764114f, 0.899327576f},
-std::array<float,2>{0.659868658f, 0.208639875f},
-std::array<float,2>{0.250410348f, 0.463068604f},
-std::array<float,2>{0.875963628f, 0.745058656f},
-std::array<float,2>{0.0593699217f, 0.64525336f},
-std::array<float,2>{0.578284562f, 0.39848718f},
-std::array<float,2>{0.458382517f, 0.177123457f},
-std::array<float,2>{0.828362167f, 0.954968572f},
-std::array<float,2>{0.343708605f, 0.83367604f},
-std::array<float,2>{0.988330185f, 0.0306575f},
-std::array<float,2>{0.220274493f, 0.336342067f},
-std::array<float,2>{0.696037471f, 0.5532161f},
-std::array<float,2>{0.420517683f, 0.741385221f},
-std::array<float,2>{0.799788535f, 0.459449112f},
-std::array<float,2>{0.122591004f, 0.213511929f},
-std::array<float,2>{0.546460927f, 0.898141861f},
-std::array<float,2>{0.162364528f, 0.791520953f},
-std::array<float,2>{0.63615948f, 0.100738026f},
-std::array<float,2>{0.310284346f, 0.286814004f},
-std::array<float,2>{0.917058289f, 0.617848516f},
-std::array<float,2>{0.0187534131f, 0.55797267f},
-std::array<float,2>{0.604037523f, 0.331019253f},
-std::array<float,2>{0.481423587f, 0.0166276563f},
-std::array<float,2>{0.847668409f, 0.838193953f},
-std::array<float,2>{0.373159915f, 0.964459121f},
-std::array<float,2>{0.953754663f, 0.180494562f},
-std::array<float,2>{0.215515837f, 0.390990704f},
-std::array<float,2>{0.742506921f, 0.650431633f},
-std::array<float,2>{0.263733268f, 0.57679373f},
-std::array<float,2>{0.885291398f, 0.267622828f},
-std::array<float,2>{0.147245407f, 0.0918586925f},
-std::array<float,2>{0.668166041f, 0.764241278f},
-std::array<float,2>{0.0665208623f, 0.93534416f},
-std::array<float,2>{0.52010119f, 0.238282025f},
-std::array<float,2>{0.401902884f, 0.480294168f},
-std::array<float,2>{0.756590128f, 0.708724558f},
-std::array<float,2>{0.233438984f, 0.668804348f},
-std::array<float,2>{0.689915478f, 0.422583371f},
-std::array<float,2>{0.333002597f, 0.135616168f},
-std::array<float,2>{0.997455597f, 0.972546279f},
-std::array<float,2>{0.465891898f, 0.845131636f},
-std::array<float,2>{0.839801788f, 0.0348064601f},
-std::array<float,2>{0.0523786582f, 0.34764728f},
-std::array<float,2>{0.593010902f, 0.511604726f},
-std::array<float,2>{0.322372139f, 0.635401607f},
-std::array<float,2>{0.972132206f, 0.379848987f},
-std::array<float,2>{0.249021918f, 0.162397146f},
-std::array<float,2>{0.704284489f, 0.952519715f},
-std::array<float,2>{0.040704608f, 0.82331723f},
-std::array<float,2>{0.577844262f, 0.00685815513f},
-std::array<float,2>{0.447401762f, 0.314714581f},
-std::array<float,2>{0.823803067f, 0.53564316f},
-std::array<float,2>{0.125553355f, 0.599336922f},
-std::array<float,2>{0.678948164f, 0.302191705f},
-std::array<float,2>{0.274653792f, 0.11306747f},
-std::array<float,2>{0.896348536f, 0.804398894f},
-std::array<float,2>{0.382101446f, 0.88098228f},
-std::array<float,2>{0.776296854f, 0.20027858f},
-std::array<float,2>{0.0792121962f, 0.44330138f},
-std::array<float,2>{0.515593648f, 0.728082478f},
-std::array<float,2>{0.488420576f, 0.52477634f},
-std::array<float,2>{0.872408807f, 0.363959998f},
-std::array<float,2>{0.0135616558f, 0.0481203236f},
-std::array<float,2>{0.622271955f, 0.871722579f},
-std::array<float,2>{0.194091246f, 0.986828446f},
-std::array<float,2>{0.729566276f, 0.142429724f},
-std::array<float,2>{0.343904346f, 0.40955621f},
-std::array<float,2>{0.95121789f, 0.68317163f},
-std::array<float,2>{0.106339954f, 0.699763f},
-std::array<float,2>{0.548410296f, 0.48560226f},
-std::array<float,2>{0.423450708f, 0.222173125f},
-std::array<float,2>{0.794361651f, 0.915871501f},
-std::array<float,2>{0.293298423f, 0.775628388f},
-std::array<float,2>{0.929038942f, 0.0684055835f},
-std::array<float,2>{0.180584162f, 0.252361327f},
-std::array<float,2>{0.641541541f, 0.587093949f},
-std::array<float,2>{0.391929597f, 0.684215665f},
-std::array<float,2>{0.760595798f, 0.411118984f},
-std::array<float,2>{0.0719548985f, 0.148417041f},
-std::array<float,2>{0.523906529f, 0.991750658f},
-std::array<float,2>{0.151656419f, 0.870467663f},
-std::array<float,2>{0.662596762f, 0.0527181923f},
-std::array<float,2>{0.254510701f, 0.363250256f},
-std::array<float,2>{0.880068243f, 0.527739227f},
-std::array<float,2>{0.0581579022f, 0.590385199f},
-std::array<float,2>{0.583769858f, 0.254173845f},
-std::array<float,2>{0.455515623f, 0.0647887662f},
-std::array<float,2>{0.834893107f, 0.778940499f},
-std::array<float,2>{0.337115437f, 0.919489622f},
-std::array<float,2>{0.98756361f, 0.22597146f},
-std::array<float,2>{0.224124789f, 0.490978777f},
-std::array<float,2>{0.701361477f, 0.695919633f},
-std::array<float,2>{0.296916991f, 0.533143461f},
-std::array<float,2>{0.91350764f, 0.319385141f},
-std::array<float,2>{0.167859212f, 0.00146854063f},
-std::array<float,2>{0.629638493f, 0.827773988f},
-std::array<float,2>{0.111152209f, 0.945894122f},
-std::array<float,2>{0.535253942f, 0.157446146f},
-std::array<float,2>{0.410377473f, 0.377504468f},
-std::array<float,2>{0.810887456f, 0.638333023f},
-std::array<float,2>{0.209581792f, 0.730484247f},
-std::array<float,2>{0.73706615f, 0.441041291f},
-std::array<float,2>{0.36595583f, 0.198560596f},
-std::array<float,2>{0.963416338f, 0.877070606f},
-std::array<float,2>{0.475152105f, 0.797235608f},
-std::array<float,2>{0.853408933f, 0.116575517f},
-std::array<float,2>{0.0303789657f, 0.299793065f},
-std::array<float,2>{0.595353425f, 0.59517312f},
-std::array<float,2>{0.357174546f, 0.705875337f},
-std::array<float,2>{0.942064106f, 0.481027782f},
-std::array<float,2>{0.200104907f, 0.236996442f},
-std::array<float,2>{0.723893702f, 0.930212617f},
-std::array<float,2>{0.00683077425f, 0.759610057f},
-std::array<float,2>{0.609490454f, 0.0885422453f},
-std::array<float,2>{0.493176162f, 0.272026181f},
-std::array<float,2>{0.862471461f, 0.572065532f},
-std::array<float,2>{0.175342098f, 0.513890386f},
-std::array<float,2>{0.65309763f, 0.350886226f},
-std::array<float,2>{0.285748482f, 0.0353687368f},
-std::array<float,2>{0.932954669f, 0.848322511f},
-std::array<float,2>{0.430828571f, 0.974194944f},
-std::array<float,2>{0.782028496f, 0.137760803f},
-std::array<float,2>{0.095744729f, 0.42795071f},
-std::array<float,2>{0.556922138f, 0.666918099f},
-std::array<float,2>{0.439345568f, 0.623880804f},
-std::array<float,2>{0.819863379f, 0.284334421f},
-std::array<float,2>{0.0324176177f, 0.0960595161f},
-std::array<float,2>{0.564757288f, 0.793175817f},
-std::array<float,2>{0.240046605f, 0.892690599f},
-std::array<float,2>{0.715453982f, 0.217142478f},
-std::array<float,2>{0.319289446f, 0.454184294f},
-std::array<float,2>{0.97788161f, 0.735435069f},
-std::array<float,2>{0.0933857113f, 0.654905677f},
-std::array<float,2>{0.507147014f, 0.396330178f},
-std::array<float,2>{0.388129443f, 0.18466635f},
-std::array<float,2>{0.771363318f, 0.966323376f},
-std::array<float,2>{0.266328156f, 0.841506064f},
-std::array<float,2>{0.905041516f, 0.0224565361f},
-std::array<float,2>{0.140611291f, 0.333260655f},
-std::array<float,2>{0.685683906f, 0.55987215f},
-std::array<float,2>{0.487466812f, 0.748109043f},
-std::array<float,2>{0.870108187f, 0.468348384f},
-std::array<float,2>{0.00924780592f, 0.203833759f},
-std::array<float,2>{0.617236257f, 0.904135108f},
-std::array<float,2>{0.187647387f, 0.784585655f},
-std::array<float,2>{0.732395172f, 0.106491804f},
-std::array<float,2>{0.35120979f, 0.293514639f},
-std::array<float,2>{0.946913362f, 0.61616689f},
-std::array<float,2>{0.101703197f, 0.550127447f},
-std::array<float,2>{0.554590762f, 0.342543125f},
-std::array<float,2>{0.429242402f, 0.0234874357f},
-std::array<float,2>{0.79099822f, 0.831834674f},
-std::array<float,2>{0.291646272f, 0.957781076f},
-std::array<float,2>{0.925233185f, 0.174225003f},
-std::array<float,2>{0.187387332f, 0.402564615f},
-std::array<float,2>{0.6464625f, 0.641955554f},
-std::array<float,2>{0.327708364f, 0.567346096f},
-std::array<float,2>{0.973772109f, 0.275359511f},
-std::array<float,2>{0.243278861f, 0.0822596401f},
-std::array<float,2>{0.710861862f, 0.752959549f},
-std::array<float,2>{0.0440937318f, 0.926177323f},
-std::array<float,2>{0.571132898f, 0.246723518f},
-std::array<float,2>{0.452403605f, 0.475822419f},
-std::array<float,2>{0.824904203f, 0.712382674f},
-std::array<float,2>{0.132183611f, 0.663358629f},
-std::array<float,2>{0.673513591f, 0.430912435f},
-std::array<float,2>{0.27785176f, 0.132649586f},
-std::array<float,2>{0.892524123f, 0.980423927f},
-std::array<float,2>{0.378115267f, 0.852529526f},
-std::array<float,2>{0.780040383f, 0.0405534692f},
-std::array<float,2>{0.083998695f, 0.35158509f},
-std::array<float,2>{0.509010732f, 0.507179856f},
-std::array<float,2>{0.261602014f, 0.630218565f},
-std::array<float,2>{0.889613211f, 0.384221971f},
-std::array<float,2>{0.144175559f, 0.170365453f},
-std::array<float,2>{0.667770505f, 0.939819515f},
-std::array<float,2>{0.0658036247f, 0.81411624f},
-std::array<float,2>{0.516468227f, 0.0112478882f},
-std::array<float,2>{0.404218554f, 0.321307033f},
-std::array<float,2>{0.750894785f, 0.543229938f},
-std::array<float,2>{0.227132067f, 0.607879579f},
-std::array<float,2>{0.692887366f, 0.305150956f},
-std::array<float,2>{0.329415977f, 0.118975975f},
-std::array<float,2>{0.994524658f, 0.806920886f},
-std::array<float,2>{0.464179635f, 0.889715552f},
-std::array<float,2>{0.840965807f, 0.192048192f},
-std::array<float,2>{0.0496631376f, 0.447059542f},
-std::array<float,2>{0.586101949f, 0.724868894f},
-std::array<float,2>{0.41771403f, 0.515625834f},
-std::array<float,2>{0.801916957f, 0.369928867f},
-std::array<float,2>{0.118284233f, 0.0562418662f},
-std::array<float,2>{0.539133251f, 0.862790465f},
-std::array<float,2>{0.159750417f, 0.996449769f},
-std::array<float,2>{0.640203357f, 0.149322569f},
-std::array<float,2>{0.308436066f, 0.421727031f},
-std::array<float,2>{0.920091033f, 0.679616094f},
-std::array<float,2>{0.020484129f, 0.689818859f},
-std::array<float,2>{0.608230114f, 0.498921394f},
-std::array<float,2>{0.480024248f, 0.229039475f},
-std::array<float,2>{0.847421169f, 0.908925772f},
-std::array<float,2>{0.36893788f, 0.771651328f},
-std::array<float,2>{0.959183216f, 0.0723118782f},
-std::array<float,2>{0.211332694f, 0.260489374f},
-std::array<float,2>{0.749987185f, 0.583698034f},
-std::array<float,2>{0.457886308f, 0.647952735f},
-std::array<float,2>{0.829692185f, 0.401007861f},
-std::array<float,2>{0.0597604252f, 0.178220361f},
-std::array<float,2>{0.57924813f, 0.956385374f},
-std::array<float,2>{0.219637841f, 0.834582031f},
-std::array<float,2>{0.697101712f, 0.0276937764f},
-std::array<float,2>{0.342035651f, 0.337957472f},
-std::array<float,2>{0.990137875f, 0.551884472f},
-std::array<float,2>{0.0750779957f, 0.610812962f},
-std::array<float,2>{0.52807498f, 0.291884154f},
-std::array<float,2>{0.395044655f, 0.102319866f},
-std::array<float,2>{0.764967561f, 0.78888309f},
-std::array<float,2>{0.251254678f, 0.900590479f},
-std::array<float,2>{0.876437545f, 0.209837064f},
-std::array<float,2>{0.152356192f, 0.462413371f},
-std::array<float,2>{0.658650696f, 0.743393838f},
-std::array<float,2>{0.360076994f, 0.500703275f},
-std::array<float,2>{0.966289937f, 0.359257072f},
-std::array<float,2>{0.203584f, 0.0462613478f},
-std::array<float,2>{0.739205241f, 0.857980907f},
-std::array<float,2>{0.0253410675f, 0.983393848f},
-std::array<float,2>{0.599527299f, 0.128254473f},
-std::array<float,2>{0.472386271f, 0.434113771f},
-std::array<float,2>{0.855786026f, 0.657755136f},
-std::array<float,2>{0.169760391f, 0.716778755f},
-std::array<float,2>{0.626322448f, 0.470580518f},
-std::array<float,2>{0.302619696f, 0.2437471f},
-std::array<float,2>{0.908023477f, 0.924289346f},
-std::array<float,2>{0.407174051f, 0.7556144f},
-std::array<float,2>{0.806275666f, 0.0791061744f},
-std::array<float,2>{0.115983307f, 0.27768451f},
-std::array<float,2>{0.532336295f, 0.564472795f},
-std::array<float,2>{0.283987552f, 0.722500801f},
-std::array<float,2>{0.937286615f, 0.449676752f},
-std::array<float,2>{0.179068968f, 0.188453853f},
-std::array<float,2>{0.650459409f, 0.886446893f},
-std::array<float,2>{0.100691564f, 0.810599029f},
-std::array<float,2>{0.561822593f, 0.124812819f},
-std::array<float,2>{0.436891139f, 0.309707969f},
-std::array<float,2>{0.787831962f, 0.60168916f},
-std::array<float,2>{0.195772588f, 0.540918589f},
-std::array<float,2>{0.72094804f, 0.327871799f},
-std::array<float,2>{0.352951586f, 0.0155574512f},
-std::array<float,2>{0.937888086f, 0.819560945f},
-std::array<float,2>{0.497568578f, 0.942547977f},
-std::array<float,2>{0.863396168f, 0.164629117f},
-std::array<float,2>{0.000927723479f, 0.39005211f},
-std::array<float,2>{0.614258051f, 0.626874745f},
-std::array<float,2>{0.386403084f, 0.57857883f},
-std::array<float,2>{0.768986642f, 0.265192688f},
-std::array<float,2>{0.089051649f, 0.0755666271f},
-std::array<float,2>{0.503862381f, 0.767748177f},
-std::array<float,2>{0.135900676f, 0.910401881f},
-std::array<float,2>{0.682639241f, 0.232669264f},
-std::array<float,2>{0.271088868f, 0.495642036f},
-std::array<float,2>{0.901534021f, 0.694226205f},
-std::array<float,2>{0.0358981639f, 0.675552785f},
-std::array<float,2>{0.568031013f, 0.417302132f},
-std::array<float,2>{0.44359079f, 0.154506534f},
-std::array<float,2>{0.813989997f, 0.994153023f},
-std::array<float,2>{0.314911693f, 0.864921391f},
-std::array<float,2>{0.982843876f, 0.0606425032f},
-std::array<float,2>{0.237566307f, 0.371903121f},
-std::array<float,2>{0.711894572f, 0.521132886f},
-std::array<float,2>{0.422046125f, 0.701388776f},
-std::array<float,2>{0.793786347f, 0.487867653f},
-std::array<float,2>{0.107109956f, 0.219651967f},
-std::array<float,2>{0.547456682f, 0.916245937f},
-std::array<float,2>{0.180924773f, 0.774542153f},
-std::array<float,2>{0.641765475f, 0.0678856f},
-std::array<float,2>{0.294496387f, 0.251439512f},
-std::array<float,2>{0.928395391f, 0.589773655f},
-std::array<float,2>{0.0120755434f, 0.526949406f},
-std::array<float,2>{0.621407866f, 0.36676681f},
-std::array<float,2>{0.489675432f, 0.0504311807f},
-std::array<float,2>{0.871535003f, 0.874081135f},
-std::array<float,2>{0.344763577f, 0.985593915f},
-std::array<float,2>{0.95308423f, 0.143234789f},
-std::array<float,2>{0.194585621f, 0.406761199f},
-std::array<float,2>{0.729395211f, 0.679997981f},
-std::array<float,2>{0.273624778f, 0.601178348f},
-std::array<float,2>{0.894796789f, 0.303023338f},
-std::array<float,2>{0.126829371f, 0.110359058f},
-std::array<float,2>{0.677977204f, 0.800966561f},
-std::array<float,2>{0.078175962f, 0.880061328f},
-std::array<float,2>{0.513954699f, 0.201259658f},
-std::array<float,2>{0.381548077f, 0.444388777f},
-std::array<float,2>{0.77725935f, 0.729563057f},
-std::array<float,2>{0.249504343f, 0.632857203f},
-std::array<float,2>{0.703625977f, 0.382787079f},
-std::array<float,2>{0.323703647f, 0.161471739f},
-std::array<float,2>{0.971073508f, 0.949666321f},
-std::array<float,2>{0.448558658f, 0.821755171f},
-std::array<float,2>{0.822423577f, 0.00469853636f},
-std::array<float,2>{0.0398592129f, 0.313813657f},
-std::array<float,2>{0.576582491f, 0.537125409f},
-std::array<float,2>{0.333518833f, 0.670243084f},
-std::array<float,2>{0.996566594f, 0.425184518f},
-std::array<float,2>{0.233127773f, 0.13328518f},
-std::array<float,2>{0.690496862f, 0.970040381f},
-std::array<float,2>{0.0516292863f, 0.847452283f},
-std::array<float,2>{0.59237045f, 0.0330086946f},
-std::array<float,2>{0.465039819f, 0.343900234f},
-std::array<float,2>{0.838302135f, 0.508074284f},
-std::array<float,2>{0.147628874f, 0.57609874f},
-std::array<float,2>{0.669123948f, 0.265790015f},
-std::array<float,2>{0.265126914f, 0.0912009254f},
-std::array<float,2>{0.886215866f, 0.76217109f},
-std::array<float,2>{0.400945812f, 0.935987115f},
-std::array<float,2>{0.757505298f, 0.240940213f},
-std::array<float,2>{0.0677546784f, 0.477099508f},
-std::array<float,2>{0.520891786f, 0.709454715f},
-std::array<float,2>{0.482177615f, 0.555518568f},
-std::array<float,2>{0.849105358f, 0.329537243f},
-std::array<float,2>{0.0176044051f, 0.0180339422f},
-std::array<float,2>{0.605243444f, 0.837287188f},
-std::array<float,2>{0.216175318f, 0.961438715f},
-std::array<float,2>{0.743453741f, 0.182730317f},
-std::array<float,2>{0.374410272f, 0.392656982f},
-std::array<float,2>{0.954768002f, 0.648603737f},
-std::array<float,2>{0.121284798f, 0.739964426f},
-std::array<float,2>{0.545519292f, 0.458892941f},
-std::array<float,2>{0.421181262f, 0.211331397f},
-std::array<float,2>{0.800489008f, 0.895686388f},
-std::array<float,2>{0.309390336f, 0.79028213f},
-std::array<float,2>{0.916702867f, 0.0987027586f},
-std::array<float,2>{0.163570762f, 0.288273066f},
-std::array<float,2>{0.63567853f, 0.620296776f},
-std::array<float,2>{0.412606031f, 0.640143931f},
-std::array<float,2>{0.81017524f, 0.375431597f},
-std::array<float,2>{0.113067381f, 0.159186706f},
-std::array<float,2>{0.537549317f, 0.9485811f},
-std::array<float,2>{0.164985895f, 0.825134873f},
-std::array<float,2>{0.632007897f, 0.00296888826f},
-std::array<float,2>{0.299098074f, 0.316749066f},
-std::array<float,2>{0.911555588f, 0.53409946f},
-std::array<float,2>{0.0275869276f, 0.597344458f},
-std::array<float,2>{0.596812129f, 0.297260493f},
-std::array<float,2>{0.473985642f, 0.115090944f},
-std::array<float,2>{0.854519904f, 0.800504684f},
-std::array<float,2>{0.364350021f, 0.876696229f},
-std::array<float,2>{0.96119827f, 0.19618769f},
-std::array<float,2>{0.207224265f, 0.439432055f},
-std::array<float,2>{0.736257195f, 0.732763052f},
-std::array<float,2>{0.257704824f, 0.52973628f},
-std::array<float,2>{0.881348193f, 0.359429181f},
-std::array<float,2>{0.14885132f, 0.053334754f},
-std::array<float,2>{0.661566377f, 0.868825614f},
-std::array<float,2>{0.0727436095f, 0.989426911f},
-std::array<float,2>{0.527059138f, 0.145715073f},
-std::array<float,2>{0.392739564f, 0.412698179f},
-std::array<float,2>{0.758811653f, 0.686343968f},
-std::array<float,2>{0.22495456f, 0.697754622f},
-std::array<float,2>{0.700225711f, 0.489494085f},
-std::array<float,2>{0.339756906f, 0.223059967f},
-std::array<float,2>{0.985752404f, 0.920470655f},
-std::array<float,2>{0.455034435f, 0.779723048f},
-std::array<float,2>{0.833266854f, 0.0635059476f},
-std::array<float,2>{0.0563771389f, 0.256899446f},
-std::array<float,2>{0.584494054f, 0.592089415f},
-std::array<float,2>{0.316929251f, 0.737183094f},
-std::array<float,2>{0.979337394f, 0.45611462f},
-std::array<float,2>{0.24209632f, 0.216645822f},
-std::array<float,2>{0.717769265f, 0.891456127f},
-std::array<float,2>{0.0344253927f, 0.796412647f},
-std::array<float,2>{0.563633561f, 0.094246231f},
-std::array<float,2>{0.44107458f, 0.283028066f},
-std::array<float,2>{0.817760289f, 0.621786714f},
-std::array<float,2>{0.137631774f, 0.561745286f},
-std::array<float,2>{0.685341001f, 0.334486008f},
-std::array<float,2>{0.268208563f, 0.0204081628f},
-std::array<float,2>{0.903743863f, 0.843388557f},
-std::array<float,2>{0.390022427f, 0.968055844f},
-std::array<float,2>{0.772218585f, 0.185998231f},
-std::array<float,2>{0.0909471735f, 0.397656351f},
-std::array<float,2>{0.505146563f, 0.652576685f},
-std::array<float,2>{0.495037615f, 0.573521793f},
-std::array<float,2>{0.860445082f, 0.271404207f},
-std::array<float,2>{0.0041405824f, 0.0868459493f},
-std::array<float,2>{0.612591982f, 0.761324644f},
-std::array<float,2>{0.203075171f, 0.931782663f},
-std::array<float,2>{0.72517097f, 0.234789699f},
-std::array<float,2>{0.358292311f, 0.482987761f},
-std::array<float,2>{0.944876254f, 0.704437554f},
-std::array<float,2>{0.0941401944f, 0.665853858f},
-std::array<float,2>{0.555015028f, 0.42730087f},
-std::array<float,2>{0.432557404f, 0.140349194f},
-std::array<float,2>{0.784576178f, 0.975857139f},
-std::array<float,2>{0.287872076f, 0.851304054f},
-std::array<float,2>{0.930848658f, 0.0371616855f},
-std::array<float,2>{0.172834292f, 0.349282116f},
-std::array<float,2>{0.654384434f, 0.512770295f},
-std::array<float,2>{0.449735433f, 0.713484526f},
-std::array<float,2>{0.827318966f, 0.47328645f},
-std::array<float,2>{0.0462858267f, 0.248799607f},
-std::array<float,2>{0.572806954f, 0.927894235f},
-std::array<float,2>{0.244798869f, 0.751017392f},
-std::array<float,2>{0.7073524f, 0.0851938426f},
-std::array<float,2>{0.324299127f, 0.276564717f},
-std::array<float,2>{0.97625196f, 0.568885267f},
-std::array<float,2>{0.0831549168f, 0.505454779f},
-std::array<float,2>{0.510299861f, 0.354162186f},
-std::array<float,2>{0.376232803f, 0.042789761f},
-std::array<float,2>{0.777901828f, 0.855013549f},
-std::array<float,2>{0.279865444f, 0.976599157f},
-std::array<float,2>{0.892754853f, 0.129811436f},
-std::array<float,2>{0.130194589f, 0.431806773f},
-std::array<float,2>{0.675677717f, 0.66144228f},
-std::array<float,2>{0.34881115f, 0.614365757f},
-std::array<float,2>{0.948360085f, 0.295560271f},
-std::array<float,2>{0.190579876f, 0.108540185f},
-std::array<float,2>{0.734033883f, 0.782900751f},
-std::array<float,2>{0.0110841366f, 0.904892147f},
-std::array<float,2>{0.619528711f, 0.205452979f},
-std::array<float,2>{0.484841257f, 0.466290563f},
-std::array<float,2>{0.867217481f, 0.746407688f},
-std::array<float,2>{0.184609905f, 0.644346356f},
-std::array<float,2>{0.647747099f, 0.405982584f},
-std::array<float,2>{0.290623873f, 0.172145858f},
-std::array<float,2>{0.923736453f, 0.959673405f},
-std::array<float,2>{0.427079111f, 0.828504682f},
-std::array<float,2>{0.79119873f, 0.0264060795f},
-std::array<float,2>{0.104267925f, 0.340732008f},
-std::array<float,2>{0.552268207f, 0.54752028f},
-std::array<float,2>{0.306111723f, 0.677682042f},
-std::array<float,2>{0.918456256f, 0.41964215f},
-std::array<float,2>{0.156349152f, 0.150989473f},
-std::array<float,2>{0.637880564f, 0.999606311f},
-std::array<float,2>{0.120114982f, 0.861021101f},
-std::array<float,2>{0.542046547f, 0.0572377406f},
-std::array<float,2>{0.414276004f, 0.367336363f},
-std::array<float,2>{0.803109169f, 0.518648088f},
-std::array<float,2>{0.213344187f, 0.584925771f},
-std::array<float,2>{0.747899532f, 0.259578466f},
-std::array<float,2>{0.370240688f, 0.0720000342f},
-std::array<float,2>{0.957846701f, 0.770580888f},
-std::array<float,2>{0.477137983f, 0.907618105f},
-std::array<float,2>{0.845552087f, 0.226895019f},
-std::array<float,2>{0.0219637733f, 0.496408731f},
-std::array<float,2>{0.605877578f, 0.689198613f},
-std::array<float,2>{0.406152457f, 0.545330167f},
-std::array<float,2>{0.752849042f, 0.32239908f},
-std::array<float,2>{0.0638334379f, 0.00828382559f},
-std::array<float,2>{0.51841408f, 0.81547749f},
-std::array<float,2>{0.142173335f, 0.938664913f},
-std::array<float,2>{0.66527462f, 0.169023275f},
-std::array<float,2>{0.258066952f, 0.385878265f},
-std::array<float,2>{0.887804925f, 0.632226825f},
-std::array<float,2>{0.0482516028f, 0.723171294f},
-std::array<float,2>{0.58901757f, 0.448733479f},
-std::array<float,2>{0.462231874f, 0.19497107f},
-std::array<float,2>{0.843304813f, 0.886815429f},
-std::array<float,2>{0.331173271f, 0.805860221f},
-std::array<float,2>{0.992909551f, 0.120444715f},
-std::array<float,2>{0.230085045f, 0.307419717f},
-std::array<float,2>{0.695066392f, 0.605753183f},
-std::array<float,2>{0.469895214f, 0.658849716f},
-std::array<float,2>{0.857441366f, 0.436431259f},
-std::array<float,2>{0.0267103035f, 0.125301719f},
-std::array<float,2>{0.600992501f, 0.980995536f},
-std::array<float,2>{0.206929445f, 0.855895877f},
-std::array<float,2>{0.742013514f, 0.0448253006f},
-std::array<float,2>{0.36293146f, 0.356103599f},
-std::array<float,2>{0.967517555f, 0.503418565f},
-std::array<float,2>{0.11457102f, 0.563286781f},
-std::array<float,2>{0.535124362f, 0.280685633f},
-std::array<float,2>{0.409465402f, 0.0808376968f},
-std::array<float,2>{0.806730807f, 0.756354034f},
-std::array<float,2>{0.30291602f, 0.923436224f},
-std::array<float,2>{0.909169078f, 0.245922744f},
-std::array<float,2>{0.170244291f, 0.471958965f},
-std::array<float,2>{0.628671646f, 0.71698302f},
-std::array<float,2>{0.340369672f, 0.554151177f},
-std::array<float,2>{0.990940154f, 0.337768048f},
-std::array<float,2>{0.221658126f, 0.029795913f},
-std::array<float,2>{0.69880718f, 0.832239985f},
-std::array<float,2>{0.0615639389f, 0.953350127f},
-std::array<float,2>{0.581123769f, 0.176476836f},
-std::array<float,2>{0.459098071f, 0.399741143f},
-std::array<float,2>{0.831381559f, 0.646345854f},
-std::array<float,2>{0.155653507f, 0.745603919f},
-std::array<float,2>{0.657717288f, 0.464278787f},
-std::array<float,2>{0.253174454f, 0.207894221f},
-std::array<float,2>{0.877063513f, 0.90004462f},
-std::array<float,2>{0.397550941f, 0.785565138f},
-std::array<float,2>{0.763100266f, 0.103604198f},
-std::array<float,2>{0.0770984143f, 0.289911091f},
-std::array<float,2>{0.530524313f, 0.611415446f},
-std::array<float,2>{0.272482425f, 0.692231655f},
-std::array<float,2>{0.899731994f, 0.492929101f},
-std::array<float,2>{0.133800209f, 0.232202709f},
-std::array<float,2>{0.680047452f, 0.913000941f},
-std::array<float,2>{0.0866098329f, 0.767213941f},
-std::array<float,2>{0.500035763f, 0.0772826523f},
-std::array<float,2>{0.383021355f, 0.262640297f},
-std::array<float,2>{0.766400754f, 0.582019866f},
-std::array<float,2>{0.235200703f, 0.521617413f},
-std::array<float,2>{0.714460194f, 0.374314249f},
-std::array<float,2>{0.313753486f, 0.0586065911f},
-std::array<float,2>{0.981301844f, 0.866243899f},
-std::array<float,2>{0.443225205f, 0.99250108f},
-std::array<float,2>{0.814719319f, 0.153010011f},
-std::array<float,2>{0.0381788053f, 0.414497286f},
-std::array<float,2>{0.569841862f, 0.672143877f},
-std::array<float,2>{0.433750689f, 0.603813529f},
-std::array<float,2>{0.787014067f, 0.311476469f},
-std::array<float,2>{0.0991600603f, 0.122027293f},
-std::array<float,2>{0.559647322f, 0.810223997f},
-std::array<float,2>{0.177312836f, 0.883831263f},
-std::array<float,2>{0.648800969f, 0.190439776f},
-std::array<float,2>{0.283022672f, 0.452122003f},
-std::array<float,2>{0.933645189f, 0.719357789f},
-std::array<float,2>{0.00366548845f, 0.627535045f},
-std::array<float,2>{0.615776181f, 0.387703806f},
-std::array<float,2>{0.499585778f, 0.167505652f},
-std::array<float,2>{0.866703212f, 0.944970012f},
-std::array<float,2>{0.353670955f, 0.818227708f},
-std::array<float,2>{0.940428078f, 0.0132378498f},
-std::array<float,2>{0.198242262f, 0.326147318f},
-std::array<float,2>{0.718900144f, 0.542520583f},
-std::array<float,2>{0.379265487f, 0.726971507f},
-std::array<float,2>{0.773685277f, 0.442204833f},
-std::array<float,2>{0.0807328671f, 0.199352801f},
-std::array<float,2>{0.512517691f, 0.882728815f},
-std::array<float,2>{0.127895653f, 0.802865982f},
-std::array<float,2>{0.676782787f, 0.111399494f},
-std::array<float,2>{0.275823861f, 0.30146423f},
-std::array<float,2>{0.897290111f, 0.598329902f},
-std::array<float,2>{0.0428196155f, 0.5362885f},
-std::array<float,2>{0.575032413f, 0.31559822f},
-std::array<float,2>{0.446002513f, 0.00595754338f},
-std::array<float,2>{0.820893288f, 0.823002279f},
-std::array<float,2>{0.321487576f, 0.951340199f},
-std::array<float,2>{0.970467925f, 0.164018258f},
-std::array<float,2>{0.247291803f, 0.380181164f},
-std::array<float,2>{0.705198824f, 0.63623637f},
-std::array<float,2>{0.295796812f, 0.58615309f},
-std::array<float,2>{0.926312208f, 0.25316292f},
-std::array<float,2>{0.181658387f, 0.0700635239f},
-std::array<float,2>{0.643617332f, 0.777230561f},
-std::array<float,2>{0.108193897f, 0.915030777f},
-std::array<float,2>{0.549719155f, 0.220932573f},
-std::array<float,2>{0.4254466f, 0.484810531f},
-std::array<float,2>{0.794935882f, 0.700332046f},
-std::array<float,2>{0.192443639f, 0.681845367f},
-std::array<float,2>{0.727156937f, 0.408799708f},
-std::array<float,2>{0.346645534f, 0.140794873f},
-std::array<float,2>{0.949512184f, 0.987735868f},
-std::array<float,2>{0.490780741f, 0.873036921f},
-std::array<float,2>{0.874538064f, 0.0473999009f},
-std::array<float,2>{0.0152134104f, 0.364858925f},
-std::array<float,2>{0.62365973f, 0.523765445f},
-std::array<float,2>{0.371121407f, 0.651994109f},
-std::array<float,2>{0.95686692f, 0.392014861f},
-std::array<float,2>{0.217782915f, 0.181321621f},
-std::array<float,2>{0.744624078f, 0.963073552f},
-std::array<float,2>{0.0165207274f, 0.83897984f},
-std::array<float,2>{0.602870703f, 0.0161870867f},
-std::array<float,2>{0.48399803f, 0.331435889f},
-std::array<float,2>{0.851336837f, 0.557545245f},
-std::array<float,2>{0.161895931f, 0.618731976f},
-std::array<float,2>{0.633440673f, 0.285570413f},
-std::array<float,2>{0.312348396f, 0.100537293f},
-std::array<float,2>{0.914269984f, 0.792275131f},
-std::array<float,2>{0.418699771f, 0.897407472f},
-std::array<float,2>{0.797641575f, 0.214625865f},
-std::array<float,2>{0.124471612f, 0.460862815f},
-std::array<float,2>{0.544044614f, 0.741194665f},
-std::array<float,2>{0.467067748f, 0.510478973f},
-std::array<float,2>{0.837278187f, 0.346554428f},
-std::array<float,2>{0.0534305014f, 0.0332930274f},
-std::array<float,2>{0.5900051f, 0.843764603f},
-std::array<float,2>{0.232251689f, 0.971594989f},
-std::array<float,2>{0.687568009f, 0.136091322f},
-std::array<float,2>{0.335624725f, 0.423791766f},
-std::array<float,2>{0.999261975f, 0.669108212f},
-std::array<float,2>{0.0702680573f, 0.707534313f},
-std::array<float,2>{0.523068726f, 0.479392052f},
-std::array<float,2>{0.398716211f, 0.239313379f},
-std::array<float,2>{0.754090667f, 0.934411168f},
-std::array<float,2>{0.262704551f, 0.765440464f},
-std::array<float,2>{0.884151399f, 0.0933921188f},
-std::array<float,2>{0.145798147f, 0.269227296f},
-std::array<float,2>{0.671689272f, 0.57720536f}}
\ No newline at end of file
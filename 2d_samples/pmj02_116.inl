@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.741102755f, 0.871173799f},
-std::array<float,2>{0.0730450824f, 0.385653794f},
-std::array<float,2>{0.33492732f, 0.563844204f},
-std::array<float,2>{0.750660002f, 0.0686030611f},
-std::array<float,2>{0.922748685f, 0.747006357f},
-std::array<float,2>{0.431425482f, 0.216161087f},
-std::array<float,2>{0.22381331f, 0.885834992f},
-std::array<float,2>{0.544904828f, 0.366997272f},
-std::array<float,2>{0.828110099f, 0.984762967f},
-std::array<float,2>{0.251210004f, 0.277144969f},
-std::array<float,2>{0.0193213467f, 0.645980239f},
-std::array<float,2>{0.677106738f, 0.160594121f},
-std::array<float,2>{0.597101212f, 0.502210498f},
-std::array<float,2>{0.13090618f, 0.0339919776f},
-std::array<float,2>{0.439716876f, 0.764487863f},
-std::array<float,2>{0.977838159f, 0.458628714f},
-std::array<float,2>{0.503199041f, 0.907525182f},
-std::array<float,2>{0.217279688f, 0.324207127f},
-std::array<float,2>{0.386875749f, 0.713990808f},
-std::array<float,2>{0.892239094f, 0.238136202f},
-std::array<float,2>{0.791148901f, 0.610894203f},
-std::array<float,2>{0.370391577f, 0.124357924f},
-std::array<float,2>{0.113371924f, 0.82011205f},
-std::array<float,2>{0.701699078f, 0.417858541f},
-std::array<float,2>{0.940530837f, 0.797099054f},
-std::array<float,2>{0.472514719f, 0.478933156f},
-std::array<float,2>{0.177200302f, 0.562206745f},
-std::array<float,2>{0.588172376f, 0.0268134493f},
-std::array<float,2>{0.632249177f, 0.669145167f},
-std::array<float,2>{0.0386905484f, 0.147465691f},
-std::array<float,2>{0.28633064f, 0.940728307f},
-std::array<float,2>{0.874769688f, 0.303685695f},
-std::array<float,2>{0.574636757f, 0.770065188f},
-std::array<float,2>{0.168960944f, 0.445995778f},
-std::array<float,2>{0.486608386f, 0.524201572f},
-std::array<float,2>{0.959057152f, 0.062314041f},
-std::array<float,2>{0.857185483f, 0.637822509f},
-std::array<float,2>{0.297998101f, 0.174511731f},
-std::array<float,2>{0.0475546569f, 0.970218837f},
-std::array<float,2>{0.651165366f, 0.251460373f},
-std::array<float,2>{0.889297962f, 0.895781517f},
-std::array<float,2>{0.401661336f, 0.355468363f},
-std::array<float,2>{0.192819402f, 0.727407455f},
-std::array<float,2>{0.523491383f, 0.189236403f},
-std::array<float,2>{0.708749235f, 0.587432027f},
-std::array<float,2>{0.105226755f, 0.09116631f},
-std::array<float,2>{0.346541613f, 0.846660078f},
-std::array<float,2>{0.800092518f, 0.390721232f},
-std::array<float,2>{0.660712481f, 0.964470744f},
-std::array<float,2>{0.0101797832f, 0.292278022f},
-std::array<float,2>{0.272730142f, 0.678622484f},
-std::array<float,2>{0.841421545f, 0.133667007f},
-std::array<float,2>{0.9951545f, 0.544152141f},
-std::array<float,2>{0.466675073f, 9.34495765e-05f},
-std::array<float,2>{0.153075367f, 0.782062411f},
-std::array<float,2>{0.62233299f, 0.497948527f},
-std::array<float,2>{0.770144105f, 0.836320281f},
-std::array<float,2>{0.327133089f, 0.42592752f},
-std::array<float,2>{0.0794551298f, 0.603660703f},
-std::array<float,2>{0.731957734f, 0.0995901376f},
-std::array<float,2>{0.554699004f, 0.697330832f},
-std::array<float,2>{0.239861816f, 0.234027565f},
-std::array<float,2>{0.420430124f, 0.922936082f},
-std::array<float,2>{0.921117306f, 0.340384781f},
-std::array<float,2>{0.645551085f, 0.791976094f},
-std::array<float,2>{0.059227623f, 0.485048264f},
-std::array<float,2>{0.308087021f, 0.533627391f},
-std::array<float,2>{0.846623421f, 0.011377397f},
-std::array<float,2>{0.968543708f, 0.684646249f},
-std::array<float,2>{0.49839589f, 0.130962431f},
-std::array<float,2>{0.161599487f, 0.957788944f},
-std::array<float,2>{0.56374979f, 0.286167473f},
-std::array<float,2>{0.80639869f, 0.933556557f},
-std::array<float,2>{0.352514118f, 0.330282629f},
-std::array<float,2>{0.09642452f, 0.688676476f},
-std::array<float,2>{0.718121469f, 0.221998885f},
-std::array<float,2>{0.517033637f, 0.599994004f},
-std::array<float,2>{0.197060183f, 0.104137748f},
-std::array<float,2>{0.390929937f, 0.834503233f},
-std::array<float,2>{0.876270056f, 0.433734804f},
-std::array<float,2>{0.615389347f, 0.982027352f},
-std::array<float,2>{0.144322634f, 0.259174705f},
-std::array<float,2>{0.460413367f, 0.628368199f},
-std::array<float,2>{0.987806499f, 0.184009939f},
-std::array<float,2>{0.831559539f, 0.523006797f},
-std::array<float,2>{0.277967304f, 0.0504341684f},
-std::array<float,2>{0.00488745095f, 0.78119123f},
-std::array<float,2>{0.667519867f, 0.442591429f},
-std::array<float,2>{0.912232578f, 0.856318831f},
-std::array<float,2>{0.412454188f, 0.399953783f},
-std::array<float,2>{0.245671809f, 0.578632534f},
-std::array<float,2>{0.552481174f, 0.0854717046f},
-std::array<float,2>{0.722529352f, 0.724204004f},
-std::array<float,2>{0.0881356746f, 0.202346757f},
-std::array<float,2>{0.315334022f, 0.903365076f},
-std::array<float,2>{0.777878761f, 0.347930282f},
-std::array<float,2>{0.537099838f, 0.826113701f},
-std::array<float,2>{0.228321552f, 0.408011585f},
-std::array<float,2>{0.425401479f, 0.618696988f},
-std::array<float,2>{0.937189698f, 0.110100597f},
-std::array<float,2>{0.765616715f, 0.704981625f},
-std::array<float,2>{0.341500401f, 0.245954171f},
-std::array<float,2>{0.0642963573f, 0.919466496f},
-std::array<float,2>{0.743426025f, 0.319523305f},
-std::array<float,2>{0.973307252f, 0.952874124f},
-std::array<float,2>{0.4495956f, 0.310594618f},
-std::array<float,2>{0.140227541f, 0.65907234f},
-std::array<float,2>{0.603867829f, 0.155908629f},
-std::array<float,2>{0.682820082f, 0.549252748f},
-std::array<float,2>{0.025225224f, 0.0162701122f},
-std::array<float,2>{0.261835039f, 0.807137132f},
-std::array<float,2>{0.817501307f, 0.470874012f},
-std::array<float,2>{0.687929213f, 0.882607281f},
-std::array<float,2>{0.122401461f, 0.374562621f},
-std::array<float,2>{0.367020696f, 0.741373718f},
-std::array<float,2>{0.781395197f, 0.2042505f},
-std::array<float,2>{0.902975738f, 0.572395146f},
-std::array<float,2>{0.381277919f, 0.0732032731f},
-std::array<float,2>{0.207337335f, 0.865812659f},
-std::array<float,2>{0.509489834f, 0.376637399f},
-std::array<float,2>{0.861204743f, 0.756615996f},
-std::array<float,2>{0.292638481f, 0.461600304f},
-std::array<float,2>{0.0402513258f, 0.513098896f},
-std::array<float,2>{0.634336352f, 0.0393214785f},
-std::array<float,2>{0.585021436f, 0.649725258f},
-std::array<float,2>{0.181977183f, 0.171580821f},
-std::array<float,2>{0.478212059f, 0.995492637f},
-std::array<float,2>{0.952486694f, 0.272239476f},
-std::array<float,2>{0.673866689f, 0.829573274f},
-std::array<float,2>{0.0199621469f, 0.429865569f},
-std::array<float,2>{0.257699251f, 0.594384015f},
-std::array<float,2>{0.823548317f, 0.106080778f},
-std::array<float,2>{0.981529713f, 0.694663584f},
-std::array<float,2>{0.443093985f, 0.226357326f},
-std::array<float,2>{0.128612682f, 0.935564399f},
-std::array<float,2>{0.600743949f, 0.333898574f},
-std::array<float,2>{0.754837096f, 0.954595923f},
-std::array<float,2>{0.328770727f, 0.281498164f},
-std::array<float,2>{0.0760469735f, 0.680002093f},
-std::array<float,2>{0.736206412f, 0.128614113f},
-std::array<float,2>{0.53920424f, 0.537534297f},
-std::array<float,2>{0.219716311f, 0.0117790168f},
-std::array<float,2>{0.435174674f, 0.793674886f},
-std::array<float,2>{0.926496923f, 0.489670426f},
-std::array<float,2>{0.590242267f, 0.902099848f},
-std::array<float,2>{0.172272429f, 0.344515085f},
-std::array<float,2>{0.47535041f, 0.720420122f},
-std::array<float,2>{0.942697823f, 0.199085146f},
-std::array<float,2>{0.868321419f, 0.583529353f},
-std::array<float,2>{0.281575233f, 0.0786791816f},
-std::array<float,2>{0.031708084f, 0.854348361f},
-std::array<float,2>{0.626520395f, 0.402890414f},
-std::array<float,2>{0.894693613f, 0.774413705f},
-std::array<float,2>{0.386698216f, 0.437837452f},
-std::array<float,2>{0.213026553f, 0.516274154f},
-std::array<float,2>{0.504694641f, 0.0546547361f},
-std::array<float,2>{0.695780694f, 0.632656574f},
-std::array<float,2>{0.109830894f, 0.181240857f},
-std::array<float,2>{0.372917593f, 0.978326619f},
-std::array<float,2>{0.794466615f, 0.265615106f},
-std::array<float,2>{0.530265629f, 0.808862925f},
-std::array<float,2>{0.188644931f, 0.475355595f},
-std::array<float,2>{0.403241575f, 0.551689804f},
-std::array<float,2>{0.883762062f, 0.0219528284f},
-std::array<float,2>{0.801044285f, 0.663057208f},
-std::array<float,2>{0.350721091f, 0.152208462f},
-std::array<float,2>{0.108778276f, 0.947708488f},
-std::array<float,2>{0.706553817f, 0.305062413f},
-std::array<float,2>{0.956058502f, 0.916026592f},
-std::array<float,2>{0.490324587f, 0.316189617f},
-std::array<float,2>{0.166366518f, 0.710199833f},
-std::array<float,2>{0.571226537f, 0.247900352f},
-std::array<float,2>{0.655258358f, 0.621469676f},
-std::array<float,2>{0.0530704223f, 0.114524603f},
-std::array<float,2>{0.303323448f, 0.823233843f},
-std::array<float,2>{0.853726983f, 0.413641393f},
-std::array<float,2>{0.728198946f, 0.997962594f},
-std::array<float,2>{0.0853595808f, 0.267779201f},
-std::array<float,2>{0.322543681f, 0.652396083f},
-std::array<float,2>{0.767231524f, 0.164172709f},
-std::array<float,2>{0.91631639f, 0.508651257f},
-std::array<float,2>{0.416914552f, 0.0439745039f},
-std::array<float,2>{0.23463212f, 0.75366354f},
-std::array<float,2>{0.562422395f, 0.465673476f},
-std::array<float,2>{0.83872968f, 0.862994969f},
-std::array<float,2>{0.267776728f, 0.382071257f},
-std::array<float,2>{0.0149848107f, 0.577926517f},
-std::array<float,2>{0.65978843f, 0.0744502619f},
-std::array<float,2>{0.61959058f, 0.736817956f},
-std::array<float,2>{0.151229292f, 0.207686514f},
-std::array<float,2>{0.464392185f, 0.876664102f},
-std::array<float,2>{0.99909693f, 0.370808899f},
-std::array<float,2>{0.714662015f, 0.759447813f},
-std::array<float,2>{0.0993565768f, 0.456802577f},
-std::array<float,2>{0.356358409f, 0.505673468f},
-std::array<float,2>{0.809356391f, 0.0356289074f},
-std::array<float,2>{0.880592287f, 0.64214623f},
-std::array<float,2>{0.395092666f, 0.156870663f},
-std::array<float,2>{0.202578798f, 0.988433242f},
-std::array<float,2>{0.522740424f, 0.280511171f},
-std::array<float,2>{0.849702239f, 0.886967599f},
-std::array<float,2>{0.309556007f, 0.363260955f},
-std::array<float,2>{0.0576628298f, 0.743007004f},
-std::array<float,2>{0.643915415f, 0.213093534f},
-std::array<float,2>{0.568943799f, 0.569050431f},
-std::array<float,2>{0.156859711f, 0.0638007373f},
-std::array<float,2>{0.492836207f, 0.86841172f},
-std::array<float,2>{0.961813152f, 0.386786073f},
-std::array<float,2>{0.547710717f, 0.944612145f},
-std::array<float,2>{0.246189848f, 0.299137533f},
-std::array<float,2>{0.408726752f, 0.666165888f},
-std::array<float,2>{0.908110797f, 0.142643988f},
-std::array<float,2>{0.776430905f, 0.556998849f},
-std::array<float,2>{0.319481939f, 0.0305903666f},
-std::array<float,2>{0.0932111144f, 0.804620564f},
-std::array<float,2>{0.723504007f, 0.481567442f},
-std::array<float,2>{0.990694702f, 0.816082001f},
-std::array<float,2>{0.454566926f, 0.418718994f},
-std::array<float,2>{0.145170182f, 0.616671443f},
-std::array<float,2>{0.612266243f, 0.119388402f},
-std::array<float,2>{0.668930233f, 0.71653384f},
-std::array<float,2>{0.00222064485f, 0.242144898f},
-std::array<float,2>{0.274760604f, 0.911581814f},
-std::array<float,2>{0.835888207f, 0.325662374f},
-std::array<float,2>{0.608052194f, 0.849807143f},
-std::array<float,2>{0.136184856f, 0.395561039f},
-std::array<float,2>{0.44896549f, 0.591249943f},
-std::array<float,2>{0.971541047f, 0.0884256661f},
-std::array<float,2>{0.816218257f, 0.733081222f},
-std::array<float,2>{0.260879248f, 0.193663239f},
-std::array<float,2>{0.0294196848f, 0.891718566f},
-std::array<float,2>{0.686807632f, 0.356515139f},
-std::array<float,2>{0.933455229f, 0.975714743f},
-std::array<float,2>{0.427673072f, 0.254549801f},
-std::array<float,2>{0.232278422f, 0.636588931f},
-std::array<float,2>{0.53212887f, 0.179425314f},
-std::array<float,2>{0.749278963f, 0.530413806f},
-std::array<float,2>{0.0672055483f, 0.0568311363f},
-std::array<float,2>{0.338478386f, 0.766716599f},
-std::array<float,2>{0.75883311f, 0.450731426f},
-std::array<float,2>{0.639141202f, 0.927557528f},
-std::array<float,2>{0.0456320085f, 0.338739574f},
-std::array<float,2>{0.295869589f, 0.700163245f},
-std::array<float,2>{0.866346657f, 0.229287446f},
-std::array<float,2>{0.949205279f, 0.607958674f},
-std::array<float,2>{0.481798977f, 0.0962074324f},
-std::array<float,2>{0.186273322f, 0.839887798f},
-std::array<float,2>{0.578612745f, 0.424193263f},
-std::array<float,2>{0.78702724f, 0.787103951f},
-std::array<float,2>{0.36278823f, 0.492670238f},
-std::array<float,2>{0.119559765f, 0.539989829f},
-std::array<float,2>{0.693315268f, 0.0046299831f},
-std::array<float,2>{0.514815092f, 0.673875272f},
-std::array<float,2>{0.205515414f, 0.139870659f},
-std::array<float,2>{0.375420272f, 0.965837538f},
-std::array<float,2>{0.89896059f, 0.293829739f},
-std::array<float,2>{0.700931668f, 0.81733501f},
-std::array<float,2>{0.116427578f, 0.415668756f},
-std::array<float,2>{0.368980825f, 0.612339795f},
-std::array<float,2>{0.789105833f, 0.122638054f},
-std::array<float,2>{0.893305302f, 0.711005211f},
-std::array<float,2>{0.389729202f, 0.235872135f},
-std::array<float,2>{0.215071201f, 0.909937561f},
-std::array<float,2>{0.500161409f, 0.32204774f},
-std::array<float,2>{0.873042285f, 0.939030051f},
-std::array<float,2>{0.287960976f, 0.301644027f},
-std::array<float,2>{0.0358673185f, 0.671378314f},
-std::array<float,2>{0.630349398f, 0.146175504f},
-std::array<float,2>{0.587306559f, 0.558757722f},
-std::array<float,2>{0.178340793f, 0.0239162408f},
-std::array<float,2>{0.47054857f, 0.799932957f},
-std::array<float,2>{0.939103484f, 0.477122426f},
-std::array<float,2>{0.546239197f, 0.884565413f},
-std::array<float,2>{0.226040348f, 0.365067989f},
-std::array<float,2>{0.431836605f, 0.748640478f},
-std::array<float,2>{0.924788654f, 0.217266575f},
-std::array<float,2>{0.753688693f, 0.564987183f},
-std::array<float,2>{0.333921045f, 0.0664388612f},
-std::array<float,2>{0.071862489f, 0.873550892f},
-std::array<float,2>{0.739008307f, 0.383413613f},
-std::array<float,2>{0.98036474f, 0.762371182f},
-std::array<float,2>{0.438904107f, 0.460348785f},
-std::array<float,2>{0.130038813f, 0.500144064f},
-std::array<float,2>{0.595626056f, 0.0320034996f},
-std::array<float,2>{0.678837597f, 0.647156715f},
-std::array<float,2>{0.0165156648f, 0.163544685f},
-std::array<float,2>{0.25356099f, 0.988128603f},
-std::array<float,2>{0.825527608f, 0.273841947f},
-std::array<float,2>{0.623055875f, 0.783663392f},
-std::array<float,2>{0.154420689f, 0.498656034f},
-std::array<float,2>{0.467475593f, 0.545976639f},
-std::array<float,2>{0.992899954f, 0.0020164547f},
-std::array<float,2>{0.84217912f, 0.67646867f},
-std::array<float,2>{0.270790428f, 0.13533397f},
-std::array<float,2>{0.00912102312f, 0.961149275f},
-std::array<float,2>{0.663345635f, 0.289097339f},
-std::array<float,2>{0.919565976f, 0.925515652f},
-std::array<float,2>{0.419385135f, 0.343010217f},
-std::array<float,2>{0.241596192f, 0.695408463f},
-std::array<float,2>{0.557765305f, 0.231714487f},
-std::array<float,2>{0.733453691f, 0.60332644f},
-std::array<float,2>{0.0801802799f, 0.10072194f},
-std::array<float,2>{0.324471623f, 0.839040577f},
-std::array<float,2>{0.772469103f, 0.428824663f},
-std::array<float,2>{0.649202228f, 0.972621381f},
-std::array<float,2>{0.0495392866f, 0.25238803f},
-std::array<float,2>{0.2995978f, 0.639142454f},
-std::array<float,2>{0.858391881f, 0.173602268f},
-std::array<float,2>{0.957587004f, 0.52541554f},
-std::array<float,2>{0.485799938f, 0.059499938f},
-std::array<float,2>{0.170039818f, 0.772658885f},
-std::array<float,2>{0.576911926f, 0.447887182f},
-std::array<float,2>{0.797281623f, 0.843842149f},
-std::array<float,2>{0.34524563f, 0.393629104f},
-std::array<float,2>{0.102058031f, 0.589600384f},
-std::array<float,2>{0.710844636f, 0.0921963826f},
-std::array<float,2>{0.526611805f, 0.729635596f},
-std::array<float,2>{0.194470406f, 0.191249982f},
-std::array<float,2>{0.400103956f, 0.898272276f},
-std::array<float,2>{0.887788594f, 0.352978289f},
-std::array<float,2>{0.6660074f, 0.778445005f},
-std::array<float,2>{0.00691555347f, 0.445084006f},
-std::array<float,2>{0.280349433f, 0.52096802f},
-std::array<float,2>{0.828383148f, 0.047766123f},
-std::array<float,2>{0.985700488f, 0.625540376f},
-std::array<float,2>{0.457996219f, 0.186154887f},
-std::array<float,2>{0.141473725f, 0.982630312f},
-std::array<float,2>{0.614206791f, 0.261138111f},
-std::array<float,2>{0.779918611f, 0.904378533f},
-std::array<float,2>{0.313349694f, 0.350882858f},
-std::array<float,2>{0.0862972364f, 0.724835396f},
-std::array<float,2>{0.720170617f, 0.199327692f},
-std::array<float,2>{0.552950799f, 0.580579579f},
-std::array<float,2>{0.242235124f, 0.0826098919f},
-std::array<float,2>{0.411327481f, 0.858966887f},
-std::array<float,2>{0.911086738f, 0.40051347f},
-std::array<float,2>{0.565314054f, 0.960932434f},
-std::array<float,2>{0.1624787f, 0.28735745f},
-std::array<float,2>{0.497148901f, 0.686667323f},
-std::array<float,2>{0.964921236f, 0.129597127f},
-std::array<float,2>{0.845022619f, 0.531716406f},
-std::array<float,2>{0.305394918f, 0.00928848889f},
-std::array<float,2>{0.0609371737f, 0.790794253f},
-std::array<float,2>{0.646990359f, 0.487766832f},
-std::array<float,2>{0.878228366f, 0.833351612f},
-std::array<float,2>{0.394506097f, 0.43578881f},
-std::array<float,2>{0.198009387f, 0.59936285f},
-std::array<float,2>{0.518696249f, 0.103464283f},
-std::array<float,2>{0.715889275f, 0.689763546f},
-std::array<float,2>{0.0954785794f, 0.220466629f},
-std::array<float,2>{0.354794145f, 0.93163687f},
-std::array<float,2>{0.807037473f, 0.328692555f},
-std::array<float,2>{0.510267079f, 0.864545345f},
-std::array<float,2>{0.209554046f, 0.377356172f},
-std::array<float,2>{0.380639344f, 0.571147978f},
-std::array<float,2>{0.905367315f, 0.0713039786f},
-std::array<float,2>{0.784797966f, 0.738395095f},
-std::array<float,2>{0.365096778f, 0.205549315f},
-std::array<float,2>{0.124264777f, 0.880060196f},
-std::array<float,2>{0.690830469f, 0.372985095f},
-std::array<float,2>{0.950446546f, 0.992378652f},
-std::array<float,2>{0.478605986f, 0.270769656f},
-std::array<float,2>{0.180864066f, 0.651885211f},
-std::array<float,2>{0.583023846f, 0.169374093f},
-std::array<float,2>{0.636268616f, 0.514008164f},
-std::array<float,2>{0.0424204431f, 0.042520605f},
-std::array<float,2>{0.290092438f, 0.754173815f},
-std::array<float,2>{0.861542702f, 0.463441372f},
-std::array<float,2>{0.74557054f, 0.921116292f},
-std::array<float,2>{0.066031456f, 0.316845745f},
-std::array<float,2>{0.342106014f, 0.70698607f},
-std::array<float,2>{0.762950242f, 0.243241936f},
-std::array<float,2>{0.935499072f, 0.619720638f},
-std::array<float,2>{0.423464298f, 0.112190694f},
-std::array<float,2>{0.229734972f, 0.826615572f},
-std::array<float,2>{0.538378358f, 0.409926087f},
-std::array<float,2>{0.819696009f, 0.806102693f},
-std::array<float,2>{0.265548885f, 0.469064057f},
-std::array<float,2>{0.0272265058f, 0.548211098f},
-std::array<float,2>{0.679870546f, 0.0182939731f},
-std::array<float,2>{0.602770269f, 0.65797925f},
-std::array<float,2>{0.138137221f, 0.152908742f},
-std::array<float,2>{0.452127665f, 0.950157642f},
-std::array<float,2>{0.976227343f, 0.310166985f},
-std::array<float,2>{0.627492785f, 0.853389263f},
-std::array<float,2>{0.0339977741f, 0.405093282f},
-std::array<float,2>{0.28369531f, 0.584953308f},
-std::array<float,2>{0.870635092f, 0.0802485272f},
-std::array<float,2>{0.94458878f, 0.721798718f},
-std::array<float,2>{0.474225193f, 0.196779847f},
-std::array<float,2>{0.175472826f, 0.899852514f},
-std::array<float,2>{0.591881156f, 0.346965045f},
-std::array<float,2>{0.796006262f, 0.978575528f},
-std::array<float,2>{0.373197794f, 0.262602955f},
-std::array<float,2>{0.113114826f, 0.630533814f},
-std::array<float,2>{0.699031413f, 0.182869092f},
-std::array<float,2>{0.506596744f, 0.518664777f},
-std::array<float,2>{0.212312445f, 0.0517529063f},
-std::array<float,2>{0.383796304f, 0.776702166f},
-std::array<float,2>{0.898078799f, 0.440208167f},
-std::array<float,2>{0.597682595f, 0.934841871f},
-std::array<float,2>{0.126649931f, 0.335719049f},
-std::array<float,2>{0.445185602f, 0.691777766f},
-std::array<float,2>{0.982483089f, 0.223003849f},
-std::array<float,2>{0.820883572f, 0.59577471f},
-std::array<float,2>{0.254704893f, 0.108561993f},
-std::array<float,2>{0.0222875793f, 0.830135345f},
-std::array<float,2>{0.672581732f, 0.433226079f},
-std::array<float,2>{0.929407179f, 0.795727611f},
-std::array<float,2>{0.436597794f, 0.491823614f},
-std::array<float,2>{0.222505093f, 0.536220551f},
-std::array<float,2>{0.542365491f, 0.0146964323f},
-std::array<float,2>{0.738185227f, 0.682436347f},
-std::array<float,2>{0.077613309f, 0.126571536f},
-std::array<float,2>{0.331157982f, 0.955358386f},
-std::array<float,2>{0.756452143f, 0.283735067f},
-std::array<float,2>{0.559529305f, 0.750910163f},
-std::array<float,2>{0.237463802f, 0.467932791f},
-std::array<float,2>{0.414498717f, 0.511510551f},
-std::array<float,2>{0.915806413f, 0.0449930429f},
-std::array<float,2>{0.768402874f, 0.654515743f},
-std::array<float,2>{0.320981711f, 0.167344972f},
-std::array<float,2>{0.0822063759f, 0.999209404f},
-std::array<float,2>{0.73015815f, 0.266749769f},
-std::array<float,2>{0.997493327f, 0.878315628f},
-std::array<float,2>{0.461429685f, 0.368283808f},
-std::array<float,2>{0.150188029f, 0.735886812f},
-std::array<float,2>{0.617483377f, 0.209409371f},
-std::array<float,2>{0.657765746f, 0.575760305f},
-std::array<float,2>{0.012137223f, 0.0767488256f},
-std::array<float,2>{0.266090333f, 0.859537125f},
-std::array<float,2>{0.836987793f, 0.379186511f},
-std::array<float,2>{0.703276992f, 0.946682155f},
-std::array<float,2>{0.106079355f, 0.308468461f},
-std::array<float,2>{0.349258095f, 0.661935568f},
-std::array<float,2>{0.803849936f, 0.149439469f},
-std::array<float,2>{0.885770559f, 0.553823054f},
-std::array<float,2>{0.40569374f, 0.0210187417f},
-std::array<float,2>{0.189702779f, 0.811231971f},
-std::array<float,2>{0.528370082f, 0.473615915f},
-std::array<float,2>{0.851660669f, 0.821761131f},
-std::array<float,2>{0.30095917f, 0.410759419f},
-std::array<float,2>{0.0508881509f, 0.623761475f},
-std::array<float,2>{0.654134154f, 0.116252579f},
-std::array<float,2>{0.573081136f, 0.708576322f},
-std::array<float,2>{0.165794119f, 0.24903664f},
-std::array<float,2>{0.488531053f, 0.915641606f},
-std::array<float,2>{0.953321636f, 0.313219905f},
-std::array<float,2>{0.726282716f, 0.801768959f},
-std::array<float,2>{0.0904861316f, 0.483549058f},
-std::array<float,2>{0.317462981f, 0.55524683f},
-std::array<float,2>{0.775132835f, 0.0286071543f},
-std::array<float,2>{0.909399629f, 0.665004194f},
-std::array<float,2>{0.407163769f, 0.142373696f},
-std::array<float,2>{0.249481797f, 0.942595124f},
-std::array<float,2>{0.549648643f, 0.29689768f},
-std::array<float,2>{0.832384348f, 0.912850618f},
-std::array<float,2>{0.275715709f, 0.327429324f},
-std::array<float,2>{7.40611576e-05f, 0.716881156f},
-std::array<float,2>{0.671554148f, 0.23828809f},
-std::array<float,2>{0.610496759f, 0.613395929f},
-std::array<float,2>{0.148020655f, 0.117307194f},
-std::array<float,2>{0.455286533f, 0.812567115f},
-std::array<float,2>{0.989878237f, 0.420534819f},
-std::array<float,2>{0.520991981f, 0.991084754f},
-std::array<float,2>{0.200345367f, 0.278986067f},
-std::array<float,2>{0.397318661f, 0.643920958f},
-std::array<float,2>{0.882721186f, 0.159806192f},
-std::array<float,2>{0.812371254f, 0.506451666f},
-std::array<float,2>{0.359024346f, 0.0383158922f},
-std::array<float,2>{0.100464948f, 0.760405123f},
-std::array<float,2>{0.712863863f, 0.453139871f},
-std::array<float,2>{0.964558184f, 0.869679332f},
-std::array<float,2>{0.495242983f, 0.38920486f},
-std::array<float,2>{0.159592673f, 0.567803323f},
-std::array<float,2>{0.568284869f, 0.0653286576f},
-std::array<float,2>{0.641883373f, 0.74495858f},
-std::array<float,2>{0.0560550913f, 0.2120599f},
-std::array<float,2>{0.311846375f, 0.889588296f},
-std::array<float,2>{0.848961473f, 0.359794527f},
-std::array<float,2>{0.58079499f, 0.841855824f},
-std::array<float,2>{0.183673561f, 0.423387736f},
-std::array<float,2>{0.48431465f, 0.606099308f},
-std::array<float,2>{0.945497453f, 0.0946077853f},
-std::array<float,2>{0.864966571f, 0.702841878f},
-std::array<float,2>{0.294436932f, 0.227999806f},
-std::array<float,2>{0.0432664342f, 0.929003894f},
-std::array<float,2>{0.638345003f, 0.337344438f},
-std::array<float,2>{0.90213716f, 0.967220366f},
-std::array<float,2>{0.377196968f, 0.296384335f},
-std::array<float,2>{0.204057202f, 0.672865987f},
-std::array<float,2>{0.512922347f, 0.136774063f},
-std::array<float,2>{0.693929732f, 0.541496217f},
-std::array<float,2>{0.118445173f, 0.00677893171f},
-std::array<float,2>{0.361244977f, 0.787638903f},
-std::array<float,2>{0.788981855f, 0.495930225f},
-std::array<float,2>{0.684443474f, 0.893058538f},
-std::array<float,2>{0.0276519395f, 0.358644038f},
-std::array<float,2>{0.259352028f, 0.730753362f},
-std::array<float,2>{0.814049184f, 0.191492543f},
-std::array<float,2>{0.970574021f, 0.593285263f},
-std::array<float,2>{0.445939213f, 0.0870131999f},
-std::array<float,2>{0.134035274f, 0.848467886f},
-std::array<float,2>{0.606927276f, 0.397610575f},
-std::array<float,2>{0.75989157f, 0.768097281f},
-std::array<float,2>{0.337536812f, 0.452233821f},
-std::array<float,2>{0.0693174452f, 0.527999222f},
-std::array<float,2>{0.746186078f, 0.0560315326f},
-std::array<float,2>{0.534547269f, 0.633921444f},
-std::array<float,2>{0.234249145f, 0.17595157f},
-std::array<float,2>{0.42814219f, 0.973000944f},
-std::array<float,2>{0.930319905f, 0.256563038f},
-std::array<float,2>{0.709879518f, 0.846887112f},
-std::array<float,2>{0.103153199f, 0.39174518f},
-std::array<float,2>{0.344041467f, 0.586132765f},
-std::array<float,2>{0.798806846f, 0.0903322324f},
-std::array<float,2>{0.886820734f, 0.728427172f},
-std::array<float,2>{0.398578405f, 0.188180864f},
-std::array<float,2>{0.193645f, 0.894773185f},
-std::array<float,2>{0.526284158f, 0.353850991f},
-std::array<float,2>{0.858439267f, 0.969304681f},
-std::array<float,2>{0.30005607f, 0.250005424f},
-std::array<float,2>{0.050461594f, 0.637684643f},
-std::array<float,2>{0.650186062f, 0.175607011f},
-std::array<float,2>{0.577152014f, 0.524646699f},
-std::array<float,2>{0.171656847f, 0.0614202097f},
-std::array<float,2>{0.484823495f, 0.770760655f},
-std::array<float,2>{0.958829939f, 0.44714886f},
-std::array<float,2>{0.556741297f, 0.922332346f},
-std::array<float,2>{0.241156146f, 0.340880811f},
-std::array<float,2>{0.418286055f, 0.698457599f},
-std::array<float,2>{0.918725193f, 0.232918471f},
-std::array<float,2>{0.771800578f, 0.605100274f},
-std::array<float,2>{0.325292319f, 0.0983724073f},
-std::array<float,2>{0.0811533779f, 0.837797165f},
-std::array<float,2>{0.732843816f, 0.427331567f},
-std::array<float,2>{0.993661225f, 0.78292352f},
-std::array<float,2>{0.468182921f, 0.496424079f},
-std::array<float,2>{0.156196222f, 0.543939769f},
-std::array<float,2>{0.624488771f, 0.0011933255f},
-std::array<float,2>{0.662782013f, 0.678993285f},
-std::array<float,2>{0.00794896856f, 0.133878544f},
-std::array<float,2>{0.269668907f, 0.963321686f},
-std::array<float,2>{0.843265533f, 0.29163304f},
-std::array<float,2>{0.594532669f, 0.765083194f},
-std::array<float,2>{0.129782289f, 0.457148254f},
-std::array<float,2>{0.437641442f, 0.503208518f},
-std::array<float,2>{0.978914678f, 0.0342923142f},
-std::array<float,2>{0.824502289f, 0.644758403f},
-std::array<float,2>{0.252843797f, 0.161478743f},
-std::array<float,2>{0.0168712344f, 0.986028731f},
-std::array<float,2>{0.678665161f, 0.275483102f},
-std::array<float,2>{0.925420642f, 0.885258615f},
-std::array<float,2>{0.432689339f, 0.366094589f},
-std::array<float,2>{0.225235149f, 0.747245967f},
-std::array<float,2>{0.545703292f, 0.214868292f},
-std::array<float,2>{0.739699304f, 0.562968791f},
-std::array<float,2>{0.0712662488f, 0.0694699213f},
-std::array<float,2>{0.332986116f, 0.8726511f},
-std::array<float,2>{0.752792299f, 0.3863644f},
-std::array<float,2>{0.629193246f, 0.939690828f},
-std::array<float,2>{0.0368631259f, 0.304372489f},
-std::array<float,2>{0.288752109f, 0.668088138f},
-std::array<float,2>{0.8712942f, 0.14710851f},
-std::array<float,2>{0.937955558f, 0.561039627f},
-std::array<float,2>{0.469703227f, 0.0259992145f},
-std::array<float,2>{0.179076001f, 0.79832375f},
-std::array<float,2>{0.585983813f, 0.480452538f},
-std::array<float,2>{0.790305853f, 0.818883002f},
-std::array<float,2>{0.367896646f, 0.41683358f},
-std::array<float,2>{0.115460239f, 0.610129774f},
-std::array<float,2>{0.699619353f, 0.123982243f},
-std::array<float,2>{0.501367092f, 0.713019073f},
-std::array<float,2>{0.216684356f, 0.236979768f},
-std::array<float,2>{0.389500171f, 0.906615198f},
-std::array<float,2>{0.894171f, 0.322738886f},
-std::array<float,2>{0.681307912f, 0.807813704f},
-std::array<float,2>{0.0260798149f, 0.471975535f},
-std::array<float,2>{0.26426211f, 0.550351024f},
-std::array<float,2>{0.818787396f, 0.017086586f},
-std::array<float,2>{0.974910319f, 0.659699082f},
-std::array<float,2>{0.452979088f, 0.154457048f},
-std::array<float,2>{0.137187406f, 0.952023149f},
-std::array<float,2>{0.601603031f, 0.312269598f},
-std::array<float,2>{0.762465596f, 0.918587327f},
-std::array<float,2>{0.34323287f, 0.318640858f},
-std::array<float,2>{0.0644747466f, 0.70369041f},
-std::array<float,2>{0.744710863f, 0.24496378f},
-std::array<float,2>{0.5371961f, 0.617297649f},
-std::array<float,2>{0.229284972f, 0.111263067f},
-std::array<float,2>{0.422321528f, 0.824824989f},
-std::array<float,2>{0.933700085f, 0.406666309f},
-std::array<float,2>{0.582170844f, 0.994718909f},
-std::array<float,2>{0.180570841f, 0.272960037f},
-std::array<float,2>{0.480367631f, 0.649410069f},
-std::array<float,2>{0.950040817f, 0.170833617f},
-std::array<float,2>{0.863208771f, 0.512500405f},
-std::array<float,2>{0.289323986f, 0.0408848599f},
-std::array<float,2>{0.0414901227f, 0.756902635f},
-std::array<float,2>{0.635493159f, 0.462098449f},
-std::array<float,2>{0.904979527f, 0.866330624f},
-std::array<float,2>{0.378974169f, 0.375366271f},
-std::array<float,2>{0.210927382f, 0.573832929f},
-std::array<float,2>{0.511190414f, 0.073290281f},
-std::array<float,2>{0.689927816f, 0.740607381f},
-std::array<float,2>{0.123743676f, 0.203781694f},
-std::array<float,2>{0.363979906f, 0.881625235f},
-std::array<float,2>{0.784101725f, 0.373811632f},
-std::array<float,2>{0.517831326f, 0.835384488f},
-std::array<float,2>{0.199138448f, 0.435493022f},
-std::array<float,2>{0.392587811f, 0.600996554f},
-std::array<float,2>{0.877180099f, 0.104860015f},
-std::array<float,2>{0.807984352f, 0.687650204f},
-std::array<float,2>{0.35425356f, 0.221035138f},
-std::array<float,2>{0.0943712667f, 0.932155669f},
-std::array<float,2>{0.715022147f, 0.331773579f},
-std::array<float,2>{0.966446936f, 0.958485007f},
-std::array<float,2>{0.496309102f, 0.286067098f},
-std::array<float,2>{0.163626447f, 0.684126735f},
-std::array<float,2>{0.566395879f, 0.132521972f},
-std::array<float,2>{0.647625089f, 0.534859776f},
-std::array<float,2>{0.0622470342f, 0.0104410527f},
-std::array<float,2>{0.306294143f, 0.792625964f},
-std::array<float,2>{0.844005704f, 0.485875279f},
-std::array<float,2>{0.719234645f, 0.90325743f},
-std::array<float,2>{0.0872490332f, 0.349018574f},
-std::array<float,2>{0.313659102f, 0.722980738f},
-std::array<float,2>{0.780683517f, 0.201951727f},
-std::array<float,2>{0.911914825f, 0.579774678f},
-std::array<float,2>{0.410274833f, 0.0842482969f},
-std::array<float,2>{0.243458867f, 0.856610537f},
-std::array<float,2>{0.554286718f, 0.399408072f},
-std::array<float,2>{0.82928282f, 0.779823661f},
-std::array<float,2>{0.279437989f, 0.441424757f},
-std::array<float,2>{0.00590065448f, 0.52230823f},
-std::array<float,2>{0.664527774f, 0.0490003787f},
-std::array<float,2>{0.615130305f, 0.627741873f},
-std::array<float,2>{0.141771078f, 0.184726715f},
-std::array<float,2>{0.458066672f, 0.981360793f},
-std::array<float,2>{0.98441565f, 0.258517355f},
-std::array<float,2>{0.653301775f, 0.823533237f},
-std::array<float,2>{0.052316457f, 0.412906826f},
-std::array<float,2>{0.302447677f, 0.622796237f},
-std::array<float,2>{0.852561593f, 0.113796167f},
-std::array<float,2>{0.954964221f, 0.709578574f},
-std::array<float,2>{0.489705533f, 0.246252358f},
-std::array<float,2>{0.164908901f, 0.917471886f},
-std::array<float,2>{0.573907614f, 0.315013528f},
-std::array<float,2>{0.803597689f, 0.949059963f},
-std::array<float,2>{0.348590732f, 0.306441396f},
-std::array<float,2>{0.10716778f, 0.663138866f},
-std::array<float,2>{0.704551816f, 0.150472403f},
-std::array<float,2>{0.528080106f, 0.552277982f},
-std::array<float,2>{0.190525725f, 0.0227842014f},
-std::array<float,2>{0.404641092f, 0.810410976f},
-std::array<float,2>{0.885008454f, 0.47619763f},
-std::array<float,2>{0.618686199f, 0.875850379f},
-std::array<float,2>{0.149272114f, 0.369436204f},
-std::array<float,2>{0.462146431f, 0.73752284f},
-std::array<float,2>{0.996782362f, 0.20898369f},
-std::array<float,2>{0.836801291f, 0.5762586f},
-std::array<float,2>{0.266786247f, 0.076150462f},
-std::array<float,2>{0.0129924919f, 0.861985028f},
-std::array<float,2>{0.656276822f, 0.381551772f},
-std::array<float,2>{0.91413945f, 0.752601743f},
-std::array<float,2>{0.415217042f, 0.466474593f},
-std::array<float,2>{0.237031579f, 0.509588063f},
-std::array<float,2>{0.559609652f, 0.0430533551f},
-std::array<float,2>{0.729084194f, 0.653363824f},
-std::array<float,2>{0.0836466327f, 0.165176481f},
-std::array<float,2>{0.322129786f, 0.997023463f},
-std::array<float,2>{0.769318521f, 0.269191861f},
-std::array<float,2>{0.541817367f, 0.794646919f},
-std::array<float,2>{0.221186459f, 0.489250422f},
-std::array<float,2>{0.435798526f, 0.538830519f},
-std::array<float,2>{0.927978456f, 0.0129011367f},
-std::array<float,2>{0.757616699f, 0.680717468f},
-std::array<float,2>{0.330831677f, 0.127719268f},
-std::array<float,2>{0.0766040236f, 0.953615248f},
-std::array<float,2>{0.736879289f, 0.282283098f},
-std::array<float,2>{0.984091163f, 0.936598539f},
-std::array<float,2>{0.443436205f, 0.33258003f},
-std::array<float,2>{0.125208378f, 0.694247067f},
-std::array<float,2>{0.599423707f, 0.224997774f},
-std::array<float,2>{0.673683584f, 0.594805717f},
-std::array<float,2>{0.0226760656f, 0.107138373f},
-std::array<float,2>{0.255815148f, 0.828661263f},
-std::array<float,2>{0.821775198f, 0.430985272f},
-std::array<float,2>{0.69733268f, 0.976927757f},
-std::array<float,2>{0.111706711f, 0.263885587f},
-std::array<float,2>{0.374507904f, 0.631175995f},
-std::array<float,2>{0.795205295f, 0.180600867f},
-std::array<float,2>{0.897297025f, 0.517543912f},
-std::array<float,2>{0.383419484f, 0.0531425588f},
-std::array<float,2>{0.211210549f, 0.775132775f},
-std::array<float,2>{0.507774889f, 0.438621432f},
-std::array<float,2>{0.869556069f, 0.854812264f},
-std::array<float,2>{0.284709156f, 0.403686076f},
-std::array<float,2>{0.0346279889f, 0.582876861f},
-std::array<float,2>{0.628085196f, 0.0797532722f},
-std::array<float,2>{0.593735278f, 0.719431102f},
-std::array<float,2>{0.174085766f, 0.197282657f},
-std::array<float,2>{0.472678334f, 0.900509357f},
-std::array<float,2>{0.944307268f, 0.345508039f},
-std::array<float,2>{0.747126698f, 0.766130865f},
-std::array<float,2>{0.0699202567f, 0.449486941f},
-std::array<float,2>{0.336205155f, 0.529863596f},
-std::array<float,2>{0.761381388f, 0.0579001643f},
-std::array<float,2>{0.931275904f, 0.635430396f},
-std::array<float,2>{0.429207891f, 0.178031385f},
-std::array<float,2>{0.233103737f, 0.975082397f},
-std::array<float,2>{0.533874512f, 0.255143613f},
-std::array<float,2>{0.81253165f, 0.890770972f},
-std::array<float,2>{0.257990062f, 0.356353134f},
-std::array<float,2>{0.0289920904f, 0.733716607f},
-std::array<float,2>{0.684859753f, 0.194578841f},
-std::array<float,2>{0.605726838f, 0.590209126f},
-std::array<float,2>{0.13356635f, 0.089687556f},
-std::array<float,2>{0.446339697f, 0.851370215f},
-std::array<float,2>{0.969294965f, 0.394902647f},
-std::array<float,2>{0.511928558f, 0.965508103f},
-std::array<float,2>{0.204238772f, 0.294878244f},
-std::array<float,2>{0.378415465f, 0.675654411f},
-std::array<float,2>{0.900668859f, 0.138876051f},
-std::array<float,2>{0.787626565f, 0.540440917f},
-std::array<float,2>{0.359424353f, 0.00490310136f},
-std::array<float,2>{0.118000045f, 0.785511553f},
-std::array<float,2>{0.695174098f, 0.493465334f},
-std::array<float,2>{0.946590006f, 0.841122925f},
-std::array<float,2>{0.482505679f, 0.425352037f},
-std::array<float,2>{0.185190171f, 0.608534217f},
-std::array<float,2>{0.581990778f, 0.0975112244f},
-std::array<float,2>{0.637691021f, 0.700286388f},
-std::array<float,2>{0.0439668745f, 0.230078608f},
-std::array<float,2>{0.29314974f, 0.92630291f},
-std::array<float,2>{0.863473892f, 0.338965327f},
-std::array<float,2>{0.56684798f, 0.868110597f},
-std::array<float,2>{0.158773571f, 0.388052702f},
-std::array<float,2>{0.495098144f, 0.569533467f},
-std::array<float,2>{0.963319898f, 0.0626612455f},
-std::array<float,2>{0.848172247f, 0.743399322f},
-std::array<float,2>{0.311242312f, 0.214502111f},
-std::array<float,2>{0.0549196154f, 0.888356447f},
-std::array<float,2>{0.640632629f, 0.362000674f},
-std::array<float,2>{0.881822467f, 0.9894014f},
-std::array<float,2>{0.398148268f, 0.279916704f},
-std::array<float,2>{0.199373171f, 0.641450346f},
-std::array<float,2>{0.52038008f, 0.15819107f},
-std::array<float,2>{0.711087823f, 0.504040599f},
-std::array<float,2>{0.101327181f, 0.036405798f},
-std::array<float,2>{0.358145833f, 0.758333981f},
-std::array<float,2>{0.810932517f, 0.456054479f},
-std::array<float,2>{0.670315087f, 0.91024518f},
-std::array<float,2>{0.00100945227f, 0.32451427f},
-std::array<float,2>{0.276707977f, 0.71571523f},
-std::array<float,2>{0.833854198f, 0.241137683f},
-std::array<float,2>{0.989254594f, 0.615321875f},
-std::array<float,2>{0.456321388f, 0.120322399f},
-std::array<float,2>{0.147224158f, 0.814907372f},
-std::array<float,2>{0.609990597f, 0.419557899f},
-std::array<float,2>{0.773806572f, 0.803645551f},
-std::array<float,2>{0.317336231f, 0.481235236f},
-std::array<float,2>{0.0916919187f, 0.557826698f},
-std::array<float,2>{0.724674106f, 0.0302112624f},
-std::array<float,2>{0.550434828f, 0.66718483f},
-std::array<float,2>{0.248571426f, 0.144042805f},
-std::array<float,2>{0.407764912f, 0.944214046f},
-std::array<float,2>{0.908438623f, 0.300566554f},
-std::array<float,2>{0.731030881f, 0.837923944f},
-std::array<float,2>{0.0788442865f, 0.428558677f},
-std::array<float,2>{0.327648401f, 0.601801634f},
-std::array<float,2>{0.770789206f, 0.0996883661f},
-std::array<float,2>{0.920230806f, 0.696293831f},
-std::array<float,2>{0.420999825f, 0.23080495f},
-std::array<float,2>{0.238350838f, 0.924262285f},
-std::array<float,2>{0.556034207f, 0.341815263f},
-std::array<float,2>{0.84063071f, 0.962725639f},
-std::array<float,2>{0.27176702f, 0.290397763f},
-std::array<float,2>{0.0115069281f, 0.677262485f},
-std::array<float,2>{0.661840439f, 0.136223659f},
-std::array<float,2>{0.622026563f, 0.545105219f},
-std::array<float,2>{0.153878063f, 0.00301296241f},
-std::array<float,2>{0.465545833f, 0.784567714f},
-std::array<float,2>{0.994893193f, 0.499161601f},
-std::array<float,2>{0.524697185f, 0.897125363f},
-std::array<float,2>{0.1921321f, 0.352308601f},
-std::array<float,2>{0.401043028f, 0.729003072f},
-std::array<float,2>{0.890599728f, 0.189523712f},
-std::array<float,2>{0.798952341f, 0.588544011f},
-std::array<float,2>{0.347563595f, 0.0928224996f},
-std::array<float,2>{0.104288995f, 0.845260799f},
-std::array<float,2>{0.707944512f, 0.393051684f},
-std::array<float,2>{0.960682869f, 0.771569252f},
-std::array<float,2>{0.487669349f, 0.448578656f},
-std::array<float,2>{0.168165013f, 0.526796699f},
-std::array<float,2>{0.576149106f, 0.0598312095f},
-std::array<float,2>{0.65167439f, 0.64051187f},
-std::array<float,2>{0.0479104742f, 0.172020674f},
-std::array<float,2>{0.297844559f, 0.971035123f},
-std::array<float,2>{0.85633862f, 0.253478438f},
-std::array<float,2>{0.588907599f, 0.79906702f},
-std::array<float,2>{0.176744223f, 0.47774598f},
-std::array<float,2>{0.471221119f, 0.560280859f},
-std::array<float,2>{0.939733088f, 0.0247956011f},
-std::array<float,2>{0.873443305f, 0.670047283f},
-std::array<float,2>{0.285232008f, 0.145289987f},
-std::array<float,2>{0.0379109383f, 0.938273251f},
-std::array<float,2>{0.631544888f, 0.302159995f},
-std::array<float,2>{0.891115904f, 0.90843457f},
-std::array<float,2>{0.388534456f, 0.321070671f},
-std::array<float,2>{0.218421713f, 0.712359846f},
-std::array<float,2>{0.502773881f, 0.235148489f},
-std::array<float,2>{0.70248425f, 0.611703813f},
-std::array<float,2>{0.11504589f, 0.121182494f},
-std::array<float,2>{0.369812548f, 0.817676842f},
-std::array<float,2>{0.792871058f, 0.414356053f},
-std::array<float,2>{0.676574111f, 0.986397684f},
-std::array<float,2>{0.0180453192f, 0.274894923f},
-std::array<float,2>{0.250438899f, 0.647617102f},
-std::array<float,2>{0.826513588f, 0.162120998f},
-std::array<float,2>{0.977310836f, 0.501705468f},
-std::array<float,2>{0.440921277f, 0.0326248556f},
-std::array<float,2>{0.132600129f, 0.763449788f},
-std::array<float,2>{0.596160829f, 0.459501058f},
-std::array<float,2>{0.751917839f, 0.874522865f},
-std::array<float,2>{0.335837513f, 0.384376854f},
-std::array<float,2>{0.0735334903f, 0.566231489f},
-std::array<float,2>{0.741888285f, 0.0680567399f},
-std::array<float,2>{0.543882847f, 0.749847174f},
-std::array<float,2>{0.223363683f, 0.218344495f},
-std::array<float,2>{0.430357933f, 0.883268416f},
-std::array<float,2>{0.923818767f, 0.363968402f},
-std::array<float,2>{0.63327229f, 0.755709887f},
-std::array<float,2>{0.0394342579f, 0.464709759f},
-std::array<float,2>{0.291218132f, 0.514753044f},
-std::array<float,2>{0.860193551f, 0.0417800732f},
-std::array<float,2>{0.952016354f, 0.650860012f},
-std::array<float,2>{0.477478296f, 0.168762416f},
-std::array<float,2>{0.18269594f, 0.993173897f},
-std::array<float,2>{0.584614396f, 0.269791722f},
-std::array<float,2>{0.782942116f, 0.879688978f},
-std::array<float,2>{0.365419954f, 0.371452183f},
-std::array<float,2>{0.121884227f, 0.739582181f},
-std::array<float,2>{0.688882411f, 0.20608294f},
-std::array<float,2>{0.508709192f, 0.572084904f},
-std::array<float,2>{0.208025202f, 0.0706240162f},
-std::array<float,2>{0.381949097f, 0.863402367f},
-std::array<float,2>{0.903696239f, 0.378498226f},
-std::array<float,2>{0.605137885f, 0.950452328f},
-std::array<float,2>{0.138966322f, 0.309000343f},
-std::array<float,2>{0.450244427f, 0.656873465f},
-std::array<float,2>{0.973670065f, 0.154018804f},
-std::array<float,2>{0.817084789f, 0.547105908f},
-std::array<float,2>{0.263303161f, 0.0191907994f},
-std::array<float,2>{0.024226727f, 0.805334687f},
-std::array<float,2>{0.682114661f, 0.470211029f},
-std::array<float,2>{0.935858428f, 0.828084707f},
-std::array<float,2>{0.423907459f, 0.408815622f},
-std::array<float,2>{0.227059811f, 0.620872021f},
-std::array<float,2>{0.535259783f, 0.112625286f},
-std::array<float,2>{0.742289543f, 0.705807567f},
-std::array<float,2>{0.0625429973f, 0.243087843f},
-std::array<float,2>{0.339878291f, 0.920187175f},
-std::array<float,2>{0.764059186f, 0.318353951f},
-std::array<float,2>{0.551738203f, 0.858173788f},
-std::array<float,2>{0.244696125f, 0.401997268f},
-std::array<float,2>{0.413930595f, 0.581244171f},
-std::array<float,2>{0.914013743f, 0.0839313269f},
-std::array<float,2>{0.779124498f, 0.725973427f},
-std::array<float,2>{0.31552279f, 0.20029214f},
-std::array<float,2>{0.0896421f, 0.905287564f},
-std::array<float,2>{0.721229136f, 0.350500852f},
-std::array<float,2>{0.986405969f, 0.983665884f},
-std::array<float,2>{0.459197193f, 0.260418147f},
-std::array<float,2>{0.142610729f, 0.626492441f},
-std::array<float,2>{0.616216481f, 0.187167466f},
-std::array<float,2>{0.666557193f, 0.519801557f},
-std::array<float,2>{0.00418077502f, 0.0486181453f},
-std::array<float,2>{0.278888911f, 0.777936518f},
-std::array<float,2>{0.830303133f, 0.443918169f},
-std::array<float,2>{0.71768105f, 0.930483937f},
-std::array<float,2>{0.0973086283f, 0.329925776f},
-std::array<float,2>{0.353481054f, 0.691007674f},
-std::array<float,2>{0.804956079f, 0.219407678f},
-std::array<float,2>{0.875759184f, 0.597847164f},
-std::array<float,2>{0.392325938f, 0.102113001f},
-std::array<float,2>{0.195948303f, 0.832077563f},
-std::array<float,2>{0.516082525f, 0.436903685f},
-std::array<float,2>{0.846858859f, 0.789616644f},
-std::array<float,2>{0.307248324f, 0.486579627f},
-std::array<float,2>{0.0601871721f, 0.532841146f},
-std::array<float,2>{0.645175815f, 0.00823861454f},
-std::array<float,2>{0.562824368f, 0.686266422f},
-std::array<float,2>{0.160921738f, 0.1303197f},
-std::array<float,2>{0.499266267f, 0.959140241f},
-std::array<float,2>{0.96728456f, 0.288497359f},
-std::array<float,2>{0.65836525f, 0.860674798f},
-std::array<float,2>{0.0137654049f, 0.380155981f},
-std::array<float,2>{0.269153357f, 0.574502885f},
-std::array<float,2>{0.839137733f, 0.0778536424f},
-std::array<float,2>{0.998888314f, 0.734426916f},
-std::array<float,2>{0.463349342f, 0.210723847f},
-std::array<float,2>{0.152107015f, 0.877566457f},
-std::array<float,2>{0.620607555f, 0.367393345f},
-std::array<float,2>{0.765867829f, 0.998336434f},
-std::array<float,2>{0.323629111f, 0.266103089f},
-std::array<float,2>{0.0842507929f, 0.656106532f},
-std::array<float,2>{0.727388084f, 0.166278139f},
-std::array<float,2>{0.561026096f, 0.510618091f},
-std::array<float,2>{0.235629022f, 0.0464265123f},
-std::array<float,2>{0.417002946f, 0.751209378f},
-std::array<float,2>{0.917238712f, 0.466902107f},
-std::array<float,2>{0.572234929f, 0.914907157f},
-std::array<float,2>{0.167136952f, 0.314087272f},
-std::array<float,2>{0.491910785f, 0.707427144f},
-std::array<float,2>{0.95559448f, 0.248234853f},
-std::array<float,2>{0.854878843f, 0.624915361f},
-std::array<float,2>{0.304010808f, 0.115561418f},
-std::array<float,2>{0.0546745993f, 0.821264029f},
-std::array<float,2>{0.655641675f, 0.411140859f},
-std::array<float,2>{0.884477854f, 0.812228501f},
-std::array<float,2>{0.403815508f, 0.473853737f},
-std::array<float,2>{0.187778249f, 0.55293566f},
-std::array<float,2>{0.530771315f, 0.0203188919f},
-std::array<float,2>{0.705155134f, 0.661009073f},
-std::array<float,2>{0.108006582f, 0.148809955f},
-std::array<float,2>{0.350194633f, 0.945805073f},
-std::array<float,2>{0.802233815f, 0.307166636f},
-std::array<float,2>{0.5049842f, 0.775579691f},
-std::array<float,2>{0.2146945f, 0.440446377f},
-std::array<float,2>{0.385018736f, 0.518293858f},
-std::array<float,2>{0.895854831f, 0.0520060286f},
-std::array<float,2>{0.793299556f, 0.629656911f},
-std::array<float,2>{0.371789664f, 0.18205373f},
-std::array<float,2>{0.111292653f, 0.979916394f},
-std::array<float,2>{0.6971277f, 0.263005674f},
-std::array<float,2>{0.941938639f, 0.898512721f},
-std::array<float,2>{0.475696743f, 0.345888555f},
-std::array<float,2>{0.173819244f, 0.721442938f},
-std::array<float,2>{0.591702461f, 0.19544746f},
-std::array<float,2>{0.625857472f, 0.584976673f},
-std::array<float,2>{0.032977052f, 0.0810978562f},
-std::array<float,2>{0.282487214f, 0.851590455f},
-std::array<float,2>{0.868029237f, 0.405527472f},
-std::array<float,2>{0.735033035f, 0.95657444f},
-std::array<float,2>{0.0742734745f, 0.284552097f},
-std::array<float,2>{0.329546183f, 0.682949185f},
-std::array<float,2>{0.755735993f, 0.125552341f},
-std::array<float,2>{0.927655756f, 0.536116362f},
-std::array<float,2>{0.434335917f, 0.0144013073f},
-std::array<float,2>{0.219924077f, 0.795971155f},
-std::array<float,2>{0.540052474f, 0.49091813f},
-std::array<float,2>{0.823121607f, 0.831789613f},
-std::array<float,2>{0.256036282f, 0.43251738f},
-std::array<float,2>{0.0211552642f, 0.597325861f},
-std::array<float,2>{0.675407708f, 0.108365096f},
-std::array<float,2>{0.600451231f, 0.692489922f},
-std::array<float,2>{0.127754077f, 0.223896369f},
-std::array<float,2>{0.442274779f, 0.934232473f},
-std::array<float,2>{0.980919778f, 0.3347103f},
-std::array<float,2>{0.692023337f, 0.788164675f},
-std::array<float,2>{0.120183624f, 0.494842768f},
-std::array<float,2>{0.362294257f, 0.542609155f},
-std::array<float,2>{0.78610462f, 0.0077231559f},
-std::array<float,2>{0.89966023f, 0.67275399f},
-std::array<float,2>{0.376434237f, 0.138539702f},
-std::array<float,2>{0.206106976f, 0.96827358f},
-std::array<float,2>{0.513730288f, 0.295230985f},
-std::array<float,2>{0.865813851f, 0.928273797f},
-std::array<float,2>{0.296506524f, 0.336756557f},
-std::array<float,2>{0.0465287305f, 0.701996744f},
-std::array<float,2>{0.640456498f, 0.226748675f},
-std::array<float,2>{0.579203784f, 0.606968045f},
-std::array<float,2>{0.186636001f, 0.0949916616f},
-std::array<float,2>{0.480788738f, 0.84321177f},
-std::array<float,2>{0.947282732f, 0.422475517f},
-std::array<float,2>{0.532785714f, 0.974380136f},
-std::array<float,2>{0.230813727f, 0.25755927f},
-std::array<float,2>{0.426159978f, 0.632824659f},
-std::array<float,2>{0.932508111f, 0.17745626f},
-std::array<float,2>{0.757999003f, 0.528599858f},
-std::array<float,2>{0.338875562f, 0.0553967431f},
-std::array<float,2>{0.0683141574f, 0.768588483f},
-std::array<float,2>{0.748793542f, 0.451455176f},
-std::array<float,2>{0.971950889f, 0.849504113f},
-std::array<float,2>{0.447975516f, 0.396562129f},
-std::array<float,2>{0.135143608f, 0.592292607f},
-std::array<float,2>{0.609168172f, 0.0865095109f},
-std::array<float,2>{0.685790598f, 0.731730163f},
-std::array<float,2>{0.0311623756f, 0.19300887f},
-std::array<float,2>{0.259920746f, 0.89445734f},
-std::array<float,2>{0.814998448f, 0.357921332f},
-std::array<float,2>{0.613060176f, 0.813549399f},
-std::array<float,2>{0.145866603f, 0.421636313f},
-std::array<float,2>{0.453783929f, 0.614453793f},
-std::array<float,2>{0.992090702f, 0.118578486f},
-std::array<float,2>{0.834497154f, 0.718063176f},
-std::array<float,2>{0.274328291f, 0.239697948f},
-std::array<float,2>{0.0038446018f, 0.913561463f},
-std::array<float,2>{0.669242442f, 0.3270863f},
-std::array<float,2>{0.906962931f, 0.942336142f},
-std::array<float,2>{0.409680992f, 0.298593432f},
-std::array<float,2>{0.247681558f, 0.665742815f},
-std::array<float,2>{0.548057079f, 0.140897155f},
-std::array<float,2>{0.723986745f, 0.55631268f},
-std::array<float,2>{0.0922803208f, 0.0276915636f},
-std::array<float,2>{0.318452209f, 0.801312983f},
-std::array<float,2>{0.775564671f, 0.483375609f},
-std::array<float,2>{0.643162906f, 0.890049815f},
-std::array<float,2>{0.0566533729f, 0.361007482f},
-std::array<float,2>{0.310099095f, 0.745147705f},
-std::array<float,2>{0.850629687f, 0.211015403f},
-std::array<float,2>{0.962208688f, 0.56645745f},
-std::array<float,2>{0.493544757f, 0.0654937625f},
-std::array<float,2>{0.157516941f, 0.870592237f},
-std::array<float,2>{0.570066094f, 0.39056161f},
-std::array<float,2>{0.810414672f, 0.760863245f},
-std::array<float,2>{0.356935561f, 0.454998493f},
-std::array<float,2>{0.0983236656f, 0.507747114f},
-std::array<float,2>{0.713454425f, 0.0379752852f},
-std::array<float,2>{0.521956682f, 0.642811656f},
-std::array<float,2>{0.201189414f, 0.158667371f},
-std::array<float,2>{0.396188349f, 0.991630137f},
-std::array<float,2>{0.879776239f, 0.27819261f},
-std::array<float,2>{0.720937908f, 0.857072651f},
-std::array<float,2>{0.0888846219f, 0.398789018f},
-std::array<float,2>{0.316348553f, 0.579398036f},
-std::array<float,2>{0.778625786f, 0.0846184194f},
-std::array<float,2>{0.913485944f, 0.723266423f},
-std::array<float,2>{0.413354903f, 0.201307103f},
-std::array<float,2>{0.244391829f, 0.902368546f},
-std::array<float,2>{0.551081836f, 0.349471301f},
-std::array<float,2>{0.830845177f, 0.980853379f},
-std::array<float,2>{0.278612792f, 0.258028477f},
-std::array<float,2>{0.00482741045f, 0.627048314f},
-std::array<float,2>{0.666049063f, 0.185228825f},
-std::array<float,2>{0.616870701f, 0.521835566f},
-std::array<float,2>{0.143484488f, 0.0495437235f},
-std::array<float,2>{0.459887266f, 0.779663324f},
-std::array<float,2>{0.987134516f, 0.4421359f},
-std::array<float,2>{0.516511977f, 0.931968868f},
-std::array<float,2>{0.1957369f, 0.331315726f},
-std::array<float,2>{0.391705185f, 0.688231051f},
-std::array<float,2>{0.87530601f, 0.221631721f},
-std::array<float,2>{0.80538249f, 0.601379454f},
-std::array<float,2>{0.352807909f, 0.105311505f},
-std::array<float,2>{0.0969439298f, 0.835873187f},
-std::array<float,2>{0.716982126f, 0.434827268f},
-std::array<float,2>{0.9674052f, 0.792141438f},
-std::array<float,2>{0.499520183f, 0.485775799f},
-std::array<float,2>{0.160624683f, 0.534554183f},
-std::array<float,2>{0.563174307f, 0.00979249366f},
-std::array<float,2>{0.644615054f, 0.683832467f},
-std::array<float,2>{0.0597313419f, 0.132112339f},
-std::array<float,2>{0.306805134f, 0.958801448f},
-std::array<float,2>{0.847512364f, 0.285631388f},
-std::array<float,2>{0.584226489f, 0.757756233f},
-std::array<float,2>{0.183191955f, 0.462495208f},
-std::array<float,2>{0.476757288f, 0.512049615f},
-std::array<float,2>{0.951648176f, 0.0405020975f},
-std::array<float,2>{0.859461308f, 0.648538172f},
-std::array<float,2>{0.291600794f, 0.170122132f},
-std::array<float,2>{0.0398377366f, 0.99422735f},
-std::array<float,2>{0.633428574f, 0.272838145f},
-std::array<float,2>{0.904020667f, 0.881149411f},
-std::array<float,2>{0.382573366f, 0.373047054f},
-std::array<float,2>{0.208948106f, 0.740981579f},
-std::array<float,2>{0.507862329f, 0.203491554f},
-std::array<float,2>{0.689279437f, 0.573372424f},
-std::array<float,2>{0.121495672f, 0.0740686804f},
-std::array<float,2>{0.365985632f, 0.867150009f},
-std::array<float,2>{0.782611132f, 0.375941455f},
-std::array<float,2>{0.682614565f, 0.951398134f},
-std::array<float,2>{0.0235182308f, 0.311959416f},
-std::array<float,2>{0.26305905f, 0.659220755f},
-std::array<float,2>{0.816426456f, 0.15483354f},
-std::array<float,2>{0.974529386f, 0.549972892f},
-std::array<float,2>{0.450820982f, 0.0172188859f},
-std::array<float,2>{0.13940835f, 0.808520675f},
-std::array<float,2>{0.604809046f, 0.472261906f},
-std::array<float,2>{0.764381945f, 0.824703991f},
-std::array<float,2>{0.340729147f, 0.406883568f},
-std::array<float,2>{0.063041456f, 0.617918074f},
-std::array<float,2>{0.742966175f, 0.11057768f},
-std::array<float,2>{0.536036789f, 0.703493774f},
-std::array<float,2>{0.22699444f, 0.244241193f},
-std::array<float,2>{0.424340755f, 0.918438673f},
-std::array<float,2>{0.936460793f, 0.318890125f},
-std::array<float,2>{0.63124156f, 0.798742235f},
-std::array<float,2>{0.0371739008f, 0.479686499f},
-std::array<float,2>{0.285750836f, 0.560661733f},
-std::array<float,2>{0.873593271f, 0.0256968867f},
-std::array<float,2>{0.940339625f, 0.668768704f},
-std::array<float,2>{0.470946521f, 0.146633014f},
-std::array<float,2>{0.175841287f, 0.940308034f},
-std::array<float,2>{0.589750528f, 0.303854495f},
-std::array<float,2>{0.792226255f, 0.906998754f},
-std::array<float,2>{0.369491935f, 0.323227674f},
-std::array<float,2>{0.1146961f, 0.713863909f},
-std::array<float,2>{0.703035295f, 0.236418083f},
-std::array<float,2>{0.502055645f, 0.609544098f},
-std::array<float,2>{0.217846826f, 0.123280369f},
-std::array<float,2>{0.387965322f, 0.818438649f},
-std::array<float,2>{0.89100796f, 0.416298807f},
-std::array<float,2>{0.596629322f, 0.98571521f},
-std::array<float,2>{0.131956115f, 0.276117027f},
-std::array<float,2>{0.440552533f, 0.645231724f},
-std::array<float,2>{0.976612687f, 0.16199173f},
-std::array<float,2>{0.82701081f, 0.503759086f},
-std::array<float,2>{0.250761986f, 0.0351485349f},
-std::array<float,2>{0.0184380487f, 0.765157759f},
-std::array<float,2>{0.676027298f, 0.457964152f},
-std::array<float,2>{0.922926605f, 0.872092485f},
-std::array<float,2>{0.429880917f, 0.386115819f},
-std::array<float,2>{0.222788244f, 0.563297749f},
-std::array<float,2>{0.543214738f, 0.0702987835f},
-std::array<float,2>{0.741443157f, 0.74800539f},
-std::array<float,2>{0.074059993f, 0.215435535f},
-std::array<float,2>{0.335224301f, 0.885020018f},
-std::array<float,2>{0.751081586f, 0.365454257f},
-std::array<float,2>{0.556197762f, 0.837257564f},
-std::array<float,2>{0.238975167f, 0.427070051f},
-std::array<float,2>{0.421499014f, 0.60479176f},
-std::array<float,2>{0.920627654f, 0.0980322435f},
-std::array<float,2>{0.771307826f, 0.698776782f},
-std::array<float,2>{0.327179193f, 0.232765913f},
-std::array<float,2>{0.0783711746f, 0.92273885f},
-std::array<float,2>{0.730726182f, 0.341590196f},
-std::array<float,2>{0.994160891f, 0.96347791f},
-std::array<float,2>{0.465250283f, 0.291237533f},
-std::array<float,2>{0.153615177f, 0.679368734f},
-std::array<float,2>{0.62124902f, 0.134370595f},
-std::array<float,2>{0.661533356f, 0.543073118f},
-std::array<float,2>{0.0108791981f, 0.00159524952f},
-std::array<float,2>{0.272276878f, 0.782696068f},
-std::array<float,2>{0.8398996f, 0.496974349f},
-std::array<float,2>{0.70735538f, 0.895441711f},
-std::array<float,2>{0.103569701f, 0.354244113f},
-std::array<float,2>{0.347147107f, 0.727844119f},
-std::array<float,2>{0.799393594f, 0.18765448f},
-std::array<float,2>{0.889715254f, 0.586440861f},
-std::array<float,2>{0.400808752f, 0.0901693329f},
-std::array<float,2>{0.191578358f, 0.847269118f},
-std::array<float,2>{0.525325179f, 0.392145604f},
-std::array<float,2>{0.855576515f, 0.771057963f},
-std::array<float,2>{0.296984106f, 0.446774185f},
-std::array<float,2>{0.0484888405f, 0.525163472f},
-std::array<float,2>{0.65203172f, 0.0607440434f},
-std::array<float,2>{0.575484872f, 0.636956036f},
-std::array<float,2>{0.168597251f, 0.17509456f},
-std::array<float,2>{0.488048702f, 0.969232678f},
-std::array<float,2>{0.960147023f, 0.250860631f},
-std::array<float,2>{0.66964817f, 0.815389693f},
-std::array<float,2>{0.00292991335f, 0.419124931f},
-std::array<float,2>{0.273544937f, 0.616131008f},
-std::array<float,2>{0.834411263f, 0.12081746f},
-std::array<float,2>{0.991613984f, 0.715158761f},
-std::array<float,2>{0.453386694f, 0.240288213f},
-std::array<float,2>{0.146269709f, 0.911047757f},
-std::array<float,2>{0.612591922f, 0.324893504f},
-std::array<float,2>{0.775963783f, 0.943514347f},
-std::array<float,2>{0.319036365f, 0.299870968f},
-std::array<float,2>{0.0923523679f, 0.667752087f},
-std::array<float,2>{0.72460407f, 0.144479468f},
-std::array<float,2>{0.548489511f, 0.558161914f},
-std::array<float,2>{0.24708426f, 0.0293186251f},
-std::array<float,2>{0.40959239f, 0.803220332f},
-std::array<float,2>{0.906702042f, 0.480852306f},
-std::array<float,2>{0.569672167f, 0.88803494f},
-std::array<float,2>{0.157776535f, 0.361754507f},
-std::array<float,2>{0.493692547f, 0.74378258f},
-std::array<float,2>{0.962799668f, 0.214289322f},
-std::array<float,2>{0.851109684f, 0.570046127f},
-std::array<float,2>{0.310040176f, 0.0632268414f},
-std::array<float,2>{0.0572410338f, 0.867430031f},
-std::array<float,2>{0.642912924f, 0.388389558f},
-std::array<float,2>{0.87891686f, 0.758216977f},
-std::array<float,2>{0.395807773f, 0.455410928f},
-std::array<float,2>{0.201754898f, 0.504686892f},
-std::array<float,2>{0.522110641f, 0.0370617919f},
-std::array<float,2>{0.713340998f, 0.640670657f},
-std::array<float,2>{0.0978482738f, 0.157279477f},
-std::array<float,2>{0.3567065f, 0.989978015f},
-std::array<float,2>{0.809987187f, 0.279306918f},
-std::array<float,2>{0.514263451f, 0.786073327f},
-std::array<float,2>{0.206877977f, 0.493788421f},
-std::array<float,2>{0.376747757f, 0.54073596f},
-std::array<float,2>{0.899997234f, 0.00542364269f},
-std::array<float,2>{0.785513937f, 0.674892366f},
-std::array<float,2>{0.361638725f, 0.139242575f},
-std::array<float,2>{0.120696373f, 0.965258718f},
-std::array<float,2>{0.691807032f, 0.294159681f},
-std::array<float,2>{0.94798857f, 0.926126599f},
-std::array<float,2>{0.481182218f, 0.339376152f},
-std::array<float,2>{0.187352449f, 0.700960755f},
-std::array<float,2>{0.579767466f, 0.229647502f},
-std::array<float,2>{0.639756024f, 0.609255672f},
-std::array<float,2>{0.0461465158f, 0.0966902599f},
-std::array<float,2>{0.295948893f, 0.841505289f},
-std::array<float,2>{0.86562711f, 0.424833447f},
-std::array<float,2>{0.748372614f, 0.975239217f},
-std::array<float,2>{0.0677702054f, 0.255474448f},
-std::array<float,2>{0.339692593f, 0.635097206f},
-std::array<float,2>{0.758666337f, 0.178495616f},
-std::array<float,2>{0.932066083f, 0.529724896f},
-std::array<float,2>{0.426647574f, 0.0584611446f},
-std::array<float,2>{0.231429398f, 0.766078353f},
-std::array<float,2>{0.532274961f, 0.44981271f},
-std::array<float,2>{0.81454891f, 0.850773871f},
-std::array<float,2>{0.260471165f, 0.395207345f},
-std::array<float,2>{0.0307080895f, 0.590589285f},
-std::array<float,2>{0.686422944f, 0.0892915353f},
-std::array<float,2>{0.60856545f, 0.734161973f},
-std::array<float,2>{0.135483548f, 0.195168823f},
-std::array<float,2>{0.447499722f, 0.891346872f},
-std::array<float,2>{0.972323418f, 0.355517328f},
-std::array<float,2>{0.696642458f, 0.774476528f},
-std::array<float,2>{0.110829338f, 0.439280897f},
-std::array<float,2>{0.371199399f, 0.516816616f},
-std::array<float,2>{0.79391551f, 0.0534370169f},
-std::array<float,2>{0.896452785f, 0.631683469f},
-std::array<float,2>{0.385254711f, 0.179753497f},
-std::array<float,2>{0.214054719f, 0.97721827f},
-std::array<float,2>{0.505666137f, 0.264470756f},
-std::array<float,2>{0.867546797f, 0.901154697f},
-std::array<float,2>{0.282940209f, 0.344772995f},
-std::array<float,2>{0.0323498771f, 0.718777478f},
-std::array<float,2>{0.625110626f, 0.197939008f},
-std::array<float,2>{0.591185033f, 0.582195401f},
-std::array<float,2>{0.173208803f, 0.0792935342f},
-std::array<float,2>{0.476470321f, 0.85508579f},
-std::array<float,2>{0.94152689f, 0.404097855f},
-std::array<float,2>{0.540972352f, 0.953557968f},
-std::array<float,2>{0.220606714f, 0.282767206f},
-std::array<float,2>{0.433958322f, 0.681287348f},
-std::array<float,2>{0.926960111f, 0.127411798f},
-std::array<float,2>{0.755364478f, 0.538236499f},
-std::array<float,2>{0.329623252f, 0.0134809734f},
-std::array<float,2>{0.0751020163f, 0.79401952f},
-std::array<float,2>{0.734599411f, 0.488766998f},
-std::array<float,2>{0.981403828f, 0.828224242f},
-std::array<float,2>{0.441501796f, 0.431191981f},
-std::array<float,2>{0.127384707f, 0.595552146f},
-std::array<float,2>{0.599955559f, 0.106637225f},
-std::array<float,2>{0.674987137f, 0.693639398f},
-std::array<float,2>{0.0205283109f, 0.225504249f},
-std::array<float,2>{0.256576091f, 0.937388659f},
-std::array<float,2>{0.822500944f, 0.332364142f},
-std::array<float,2>{0.620154142f, 0.861765563f},
-std::array<float,2>{0.151743472f, 0.381255209f},
-std::array<float,2>{0.463792354f, 0.577062488f},
-std::array<float,2>{0.998308659f, 0.0754965693f},
-std::array<float,2>{0.839501619f, 0.738124311f},
-std::array<float,2>{0.268753707f, 0.208423316f},
-std::array<float,2>{0.0143768014f, 0.875286818f},
-std::array<float,2>{0.658908308f, 0.370114893f},
-std::array<float,2>{0.917543828f, 0.996127725f},
-std::array<float,2>{0.417740554f, 0.269005805f},
-std::array<float,2>{0.23613812f, 0.653832912f},
-std::array<float,2>{0.561439395f, 0.1658815f},
-std::array<float,2>{0.726892054f, 0.508929253f},
-std::array<float,2>{0.0848079249f, 0.0436171778f},
-std::array<float,2>{0.323792756f, 0.752085328f},
-std::array<float,2>{0.76651752f, 0.466152191f},
-std::array<float,2>{0.656131029f, 0.917484283f},
-std::array<float,2>{0.0538077466f, 0.314576477f},
-std::array<float,2>{0.304559171f, 0.709235489f},
-std::array<float,2>{0.855460465f, 0.247053459f},
-std::array<float,2>{0.955394566f, 0.622262776f},
-std::array<float,2>{0.491593659f, 0.113364682f},
-std::array<float,2>{0.167697325f, 0.824033201f},
-std::array<float,2>{0.571358919f, 0.412386268f},
-std::array<float,2>{0.802590787f, 0.809705377f},
-std::array<float,2>{0.349669546f, 0.475603312f},
-std::array<float,2>{0.107720375f, 0.552165508f},
-std::array<float,2>{0.705617428f, 0.0232928041f},
-std::array<float,2>{0.530427992f, 0.66367805f},
-std::array<float,2>{0.188448533f, 0.151005924f},
-std::array<float,2>{0.40333268f, 0.948593438f},
-std::array<float,2>{0.884254634f, 0.305858314f},
-std::array<float,2>{0.71581465f, 0.832650959f},
-std::array<float,2>{0.0938837007f, 0.437269777f},
-std::array<float,2>{0.353835881f, 0.598314941f},
-std::array<float,2>{0.808238268f, 0.101843633f},
-std::array<float,2>{0.877851546f, 0.690911293f},
-std::array<float,2>{0.393472642f, 0.218809769f},
-std::array<float,2>{0.198289379f, 0.929890275f},
-std::array<float,2>{0.518440664f, 0.329108179f},
-std::array<float,2>{0.844252169f, 0.95968163f},
-std::array<float,2>{0.305763125f, 0.288933814f},
-std::array<float,2>{0.0616926998f, 0.686015904f},
-std::array<float,2>{0.648297071f, 0.130654693f},
-std::array<float,2>{0.565654874f, 0.532446682f},
-std::array<float,2>{0.163158685f, 0.00838759542f},
-std::array<float,2>{0.496657819f, 0.789287984f},
-std::array<float,2>{0.966032147f, 0.486817569f},
-std::array<float,2>{0.553829193f, 0.906019509f},
-std::array<float,2>{0.243763417f, 0.349615306f},
-std::array<float,2>{0.410847843f, 0.726487935f},
-std::array<float,2>{0.911592901f, 0.200804234f},
-std::array<float,2>{0.781055093f, 0.581736684f},
-std::array<float,2>{0.314218104f, 0.0831912756f},
-std::array<float,2>{0.087532796f, 0.857850075f},
-std::array<float,2>{0.719424963f, 0.401453882f},
-std::array<float,2>{0.985082448f, 0.777360678f},
-std::array<float,2>{0.458580881f, 0.443590105f},
-std::array<float,2>{0.142477602f, 0.520139873f},
-std::array<float,2>{0.614474833f, 0.0483287945f},
-std::array<float,2>{0.664848924f, 0.626254022f},
-std::array<float,2>{0.00655699009f, 0.18668808f},
-std::array<float,2>{0.2799173f, 0.983923078f},
-std::array<float,2>{0.829700053f, 0.260193527f},
-std::array<float,2>{0.602165163f, 0.805150092f},
-std::array<float,2>{0.137436107f, 0.470604211f},
-std::array<float,2>{0.452471793f, 0.54771781f},
-std::array<float,2>{0.975350142f, 0.0187654775f},
-std::array<float,2>{0.819030464f, 0.656542957f},
-std::array<float,2>{0.26369831f, 0.153731182f},
-std::array<float,2>{0.0254341438f, 0.95099175f},
-std::array<float,2>{0.681045949f, 0.309396297f},
-std::array<float,2>{0.934552848f, 0.920454025f},
-std::array<float,2>{0.422673851f, 0.317571402f},
-std::array<float,2>{0.228593305f, 0.705237031f},
-std::array<float,2>{0.537898958f, 0.242414147f},
-std::array<float,2>{0.744299054f, 0.620285273f},
-std::array<float,2>{0.0653544217f, 0.113091365f},
-std::array<float,2>{0.343425483f, 0.827292025f},
-std::array<float,2>{0.762040615f, 0.408669293f},
-std::array<float,2>{0.634998918f, 0.99385184f},
-std::array<float,2>{0.0416799374f, 0.270483077f},
-std::array<float,2>{0.289801151f, 0.651298106f},
-std::array<float,2>{0.862360835f, 0.168195277f},
-std::array<float,2>{0.949586511f, 0.515513957f},
-std::array<float,2>{0.479738355f, 0.0412971564f},
-std::array<float,2>{0.180050746f, 0.75494802f},
-std::array<float,2>{0.582612038f, 0.464257985f},
-std::array<float,2>{0.783665419f, 0.863774359f},
-std::array<float,2>{0.363768905f, 0.378003538f},
-std::array<float,2>{0.123436786f, 0.571369886f},
-std::array<float,2>{0.690410137f, 0.0711262003f},
-std::array<float,2>{0.511686981f, 0.739818871f},
-std::array<float,2>{0.210411057f, 0.206878617f},
-std::array<float,2>{0.379680574f, 0.879245162f},
-std::array<float,2>{0.904784322f, 0.371728212f},
-std::array<float,2>{0.677905381f, 0.76280266f},
-std::array<float,2>{0.0171402581f, 0.459101766f},
-std::array<float,2>{0.251991272f, 0.501119375f},
-std::array<float,2>{0.824766576f, 0.033033561f},
-std::array<float,2>{0.979102671f, 0.648359656f},
-std::array<float,2>{0.438103348f, 0.162718773f},
-std::array<float,2>{0.129250154f, 0.987244844f},
-std::array<float,2>{0.593840837f, 0.274969935f},
-std::array<float,2>{0.752010882f, 0.883343339f},
-std::array<float,2>{0.332505763f, 0.363329142f},
-std::array<float,2>{0.0703444928f, 0.749172807f},
-std::array<float,2>{0.739870965f, 0.21813105f},
-std::array<float,2>{0.545301974f, 0.565821886f},
-std::array<float,2>{0.224906653f, 0.0673881769f},
-std::array<float,2>{0.433287024f, 0.874158263f},
-std::array<float,2>{0.925272405f, 0.384075224f},
-std::array<float,2>{0.58685565f, 0.93792063f},
-std::array<float,2>{0.179281309f, 0.302660435f},
-std::array<float,2>{0.469043165f, 0.670423329f},
-std::array<float,2>{0.938157082f, 0.144583106f},
-std::array<float,2>{0.871649265f, 0.560048401f},
-std::array<float,2>{0.288422257f, 0.025008766f},
-std::array<float,2>{0.0363779329f, 0.79979521f},
-std::array<float,2>{0.629616916f, 0.478131592f},
-std::array<float,2>{0.893835425f, 0.817954481f},
-std::array<float,2>{0.388692111f, 0.414725184f},
-std::array<float,2>{0.215870753f, 0.611861765f},
-std::array<float,2>{0.501553953f, 0.121969357f},
-std::array<float,2>{0.700107038f, 0.712631464f},
-std::array<float,2>{0.115798458f, 0.234759957f},
-std::array<float,2>{0.367515266f, 0.909174681f},
-std::array<float,2>{0.790864646f, 0.320578009f},
-std::array<float,2>{0.525596738f, 0.845018983f},
-std::array<float,2>{0.193931654f, 0.393166602f},
-std::array<float,2>{0.399393111f, 0.588289618f},
-std::array<float,2>{0.887515783f, 0.0935305133f},
-std::array<float,2>{0.798071384f, 0.729206443f},
-std::array<float,2>{0.344388634f, 0.190391436f},
-std::array<float,2>{0.102563322f, 0.896736205f},
-std::array<float,2>{0.709214687f, 0.352019399f},
-std::array<float,2>{0.958107829f, 0.971541882f},
-std::array<float,2>{0.48489058f, 0.253379673f},
-std::array<float,2>{0.171017602f, 0.640044749f},
-std::array<float,2>{0.577910841f, 0.172842011f},
-std::array<float,2>{0.649634838f, 0.526969135f},
-std::array<float,2>{0.0499744751f, 0.0603652596f},
-std::array<float,2>{0.300554186f, 0.772281766f},
-std::array<float,2>{0.858979106f, 0.44887805f},
-std::array<float,2>{0.733089983f, 0.924627185f},
-std::array<float,2>{0.0817903802f, 0.342651188f},
-std::array<float,2>{0.325810134f, 0.697076917f},
-std::array<float,2>{0.772118866f, 0.231430843f},
-std::array<float,2>{0.918419838f, 0.602268875f},
-std::array<float,2>{0.41855666f, 0.100186333f},
-std::array<float,2>{0.240436077f, 0.838747025f},
-std::array<float,2>{0.557222903f, 0.427954465f},
-std::array<float,2>{0.842934549f, 0.785124242f},
-std::array<float,2>{0.270444095f, 0.499749005f},
-std::array<float,2>{0.00850366894f, 0.545766056f},
-std::array<float,2>{0.66235435f, 0.00343677751f},
-std::array<float,2>{0.624825239f, 0.676881552f},
-std::array<float,2>{0.155552f, 0.136694536f},
-std::array<float,2>{0.468736231f, 0.962244213f},
-std::array<float,2>{0.993530273f, 0.290928483f},
-std::array<float,2>{0.64122045f, 0.870731056f},
-std::array<float,2>{0.0554782003f, 0.390030265f},
-std::array<float,2>{0.31103158f, 0.567281425f},
-std::array<float,2>{0.847675085f, 0.0661010444f},
-std::array<float,2>{0.963748455f, 0.745924115f},
-std::array<float,2>{0.494548589f, 0.211747989f},
-std::array<float,2>{0.158453837f, 0.890529871f},
-std::array<float,2>{0.567192793f, 0.360574692f},
-std::array<float,2>{0.811499953f, 0.992121637f},
-std::array<float,2>{0.357440352f, 0.277417511f},
-std::array<float,2>{0.100771919f, 0.643361211f},
-std::array<float,2>{0.71189779f, 0.15882729f},
-std::array<float,2>{0.519737363f, 0.507114708f},
-std::array<float,2>{0.199714348f, 0.0372665524f},
-std::array<float,2>{0.397766918f, 0.761352301f},
-std::array<float,2>{0.880952835f, 0.454228461f},
-std::array<float,2>{0.609458447f, 0.913935661f},
-std::array<float,2>{0.146895066f, 0.326231778f},
-std::array<float,2>{0.456854761f, 0.718421817f},
-std::array<float,2>{0.988435805f, 0.240165189f},
-std::array<float,2>{0.833135724f, 0.614787757f},
-std::array<float,2>{0.276955128f, 0.119025111f},
-std::array<float,2>{0.00180209137f, 0.814005494f},
-std::array<float,2>{0.670590341f, 0.42094937f},
-std::array<float,2>{0.908692718f, 0.80095458f},
-std::array<float,2>{0.407357901f, 0.482428819f},
-std::array<float,2>{0.248075679f, 0.555976987f},
-std::array<float,2>{0.550075233f, 0.0280386079f},
-std::array<float,2>{0.725206673f, 0.665496528f},
-std::array<float,2>{0.091052264f, 0.14149709f},
-std::array<float,2>{0.316611975f, 0.941886544f},
-std::array<float,2>{0.774121702f, 0.298140109f},
-std::array<float,2>{0.53324908f, 0.769493759f},
-std::array<float,2>{0.232732609f, 0.452104479f},
-std::array<float,2>{0.428910345f, 0.529055595f},
-std::array<float,2>{0.930748463f, 0.055009529f},
-std::array<float,2>{0.760930777f, 0.633477509f},
-std::array<float,2>{0.336592317f, 0.17714037f},
-std::array<float,2>{0.0696595982f, 0.974023819f},
-std::array<float,2>{0.74800396f, 0.257089823f},
-std::array<float,2>{0.969176114f, 0.893738151f},
-std::array<float,2>{0.4472287f, 0.357859194f},
-std::array<float,2>{0.133011892f, 0.732347906f},
-std::array<float,2>{0.60599947f, 0.192610934f},
-std::array<float,2>{0.685360432f, 0.592054009f},
-std::array<float,2>{0.028601082f, 0.0861111134f},
-std::array<float,2>{0.258326381f, 0.84906745f},
-std::array<float,2>{0.813105166f, 0.397295654f},
-std::array<float,2>{0.694501817f, 0.967926025f},
-std::array<float,2>{0.117587663f, 0.295441091f},
-std::array<float,2>{0.360146046f, 0.672235191f},
-std::array<float,2>{0.787554979f, 0.137887791f},
-std::array<float,2>{0.901067376f, 0.542109728f},
-std::array<float,2>{0.378702492f, 0.00702715246f},
-std::array<float,2>{0.204828694f, 0.788645804f},
-std::array<float,2>{0.512641132f, 0.494172841f},
-std::array<float,2>{0.863942921f, 0.843732178f},
-std::array<float,2>{0.293837339f, 0.422164291f},
-std::array<float,2>{0.044792138f, 0.606682897f},
-std::array<float,2>{0.637105942f, 0.0952241868f},
-std::array<float,2>{0.581153035f, 0.701645792f},
-std::array<float,2>{0.184756443f, 0.227411956f},
-std::array<float,2>{0.48308447f, 0.927969038f},
-std::array<float,2>{0.946891665f, 0.336272597f},
-std::array<float,2>{0.736677349f, 0.796498835f},
-std::array<float,2>{0.07693813f, 0.49061197f},
-std::array<float,2>{0.330314159f, 0.535337806f},
-std::array<float,2>{0.757196903f, 0.0138138887f},
-std::array<float,2>{0.928251565f, 0.683118522f},
-std::array<float,2>{0.436139554f, 0.125181809f},
-std::array<float,2>{0.221517354f, 0.956184208f},
-std::array<float,2>{0.541186094f, 0.284728825f},
-std::array<float,2>{0.82216692f, 0.933633208f},
-std::array<float,2>{0.255226076f, 0.334286958f},
-std::array<float,2>{0.0234223846f, 0.693206549f},
-std::array<float,2>{0.67327863f, 0.224592879f},
-std::array<float,2>{0.598812103f, 0.596898139f},
-std::array<float,2>{0.125751153f, 0.107552782f},
-std::array<float,2>{0.444040328f, 0.831409991f},
-std::array<float,2>{0.983399153f, 0.43168065f},
-std::array<float,2>{0.507155001f, 0.980197787f},
-std::array<float,2>{0.211622089f, 0.263497174f},
-std::array<float,2>{0.383109927f, 0.629347086f},
-std::array<float,2>{0.896578431f, 0.182253003f},
-std::array<float,2>{0.795817852f, 0.517819762f},
-std::array<float,2>{0.374720514f, 0.0525968373f},
-std::array<float,2>{0.112005085f, 0.77632159f},
-std::array<float,2>{0.698221564f, 0.441038966f},
-std::array<float,2>{0.943671167f, 0.852161884f},
-std::array<float,2>{0.473252684f, 0.405775338f},
-std::array<float,2>{0.17469041f, 0.58569324f},
-std::array<float,2>{0.593191564f, 0.0817568302f},
-std::array<float,2>{0.628788412f, 0.720791757f},
-std::array<float,2>{0.0350614488f, 0.195812553f},
-std::array<float,2>{0.284277678f, 0.898965299f},
-std::array<float,2>{0.869889855f, 0.346463263f},
-std::array<float,2>{0.573466003f, 0.820521176f},
-std::array<float,2>{0.164211854f, 0.41177088f},
-std::array<float,2>{0.489799231f, 0.62425077f},
-std::array<float,2>{0.954484224f, 0.115978882f},
-std::array<float,2>{0.853178263f, 0.707857132f},
-std::array<float,2>{0.302084565f, 0.248838216f},
-std::array<float,2>{0.0521294549f, 0.914375722f},
-std::array<float,2>{0.652354777f, 0.313509285f},
-std::array<float,2>{0.885510564f, 0.945552588f},
-std::array<float,2>{0.40499717f, 0.30699411f},
-std::array<float,2>{0.190927029f, 0.660211086f},
-std::array<float,2>{0.527725816f, 0.149191856f},
-std::array<float,2>{0.704651773f, 0.553376377f},
-std::array<float,2>{0.10656748f, 0.0199475605f},
-std::array<float,2>{0.348066092f, 0.811958194f},
-std::array<float,2>{0.80294019f, 0.474426597f},
-std::array<float,2>{0.657119334f, 0.877064466f},
-std::array<float,2>{0.0133284908f, 0.368158877f},
-std::array<float,2>{0.267165959f, 0.735143304f},
-std::array<float,2>{0.836019814f, 0.210247412f},
-std::array<float,2>{0.996341884f, 0.574930549f},
-std::array<float,2>{0.462670058f, 0.0774085298f},
-std::array<float,2>{0.148522675f, 0.86130631f},
-std::array<float,2>{0.618390679f, 0.380688399f},
-std::array<float,2>{0.768897176f, 0.751904547f},
-std::array<float,2>{0.321694404f, 0.467353672f},
-std::array<float,2>{0.08332818f, 0.509882927f},
-std::array<float,2>{0.728668153f, 0.0461638756f},
-std::array<float,2>{0.560192585f, 0.655356646f},
-std::array<float,2>{0.236416623f, 0.166854098f},
-std::array<float,2>{0.415993571f, 0.998978972f},
-std::array<float,2>{0.914648533f, 0.266264468f},
-std::array<float,2>{0.691003561f, 0.865698159f},
-std::array<float,2>{0.124791116f, 0.376311362f},
-std::array<float,2>{0.364526361f, 0.573071003f},
-std::array<float,2>{0.78444165f, 0.0726300031f},
-std::array<float,2>{0.906233728f, 0.741990089f},
-std::array<float,2>{0.380270392f, 0.204945132f},
-std::array<float,2>{0.209363148f, 0.882028282f},
-std::array<float,2>{0.509985507f, 0.374264121f},
-std::array<float,2>{0.861949444f, 0.995677352f},
-std::array<float,2>{0.290955842f, 0.271800458f},
-std::array<float,2>{0.0428898931f, 0.65008992f},
-std::array<float,2>{0.636062026f, 0.17100805f},
-std::array<float,2>{0.583914876f, 0.513539314f},
-std::array<float,2>{0.181395307f, 0.0400369018f},
-std::array<float,2>{0.479217857f, 0.756257415f},
-std::array<float,2>{0.950949073f, 0.461322427f},
-std::array<float,2>{0.538856626f, 0.918955088f},
-std::array<float,2>{0.230372757f, 0.320129573f},
-std::array<float,2>{0.422874004f, 0.704343081f},
-std::array<float,2>{0.934799552f, 0.245146558f},
-std::array<float,2>{0.763641477f, 0.61840409f},
-std::array<float,2>{0.342378289f, 0.1097719f},
-std::array<float,2>{0.0654591322f, 0.825610876f},
-std::array<float,2>{0.745786488f, 0.40727818f},
-std::array<float,2>{0.975779057f, 0.806952536f},
-std::array<float,2>{0.45119378f, 0.471420586f},
-std::array<float,2>{0.138301447f, 0.549744606f},
-std::array<float,2>{0.603054762f, 0.0159475096f},
-std::array<float,2>{0.680583358f, 0.658414006f},
-std::array<float,2>{0.0266372375f, 0.155413643f},
-std::array<float,2>{0.264710158f, 0.952489138f},
-std::array<float,2>{0.820195854f, 0.311096996f},
-std::array<float,2>{0.613556921f, 0.780678511f},
-std::array<float,2>{0.141094893f, 0.443124264f},
-std::array<float,2>{0.457379937f, 0.522806525f},
-std::array<float,2>{0.986170113f, 0.0502224974f},
-std::array<float,2>{0.828868151f, 0.628446639f},
-std::array<float,2>{0.281099737f, 0.184091017f},
-std::array<float,2>{0.00739287632f, 0.981799185f},
-std::array<float,2>{0.665189505f, 0.259592265f},
-std::array<float,2>{0.910469651f, 0.903824449f},
-std::array<float,2>{0.411666006f, 0.348378927f},
-std::array<float,2>{0.243134305f, 0.723840415f},
-std::array<float,2>{0.553276539f, 0.202947333f},
-std::array<float,2>{0.720244765f, 0.578527868f},
-std::array<float,2>{0.0865147784f, 0.0854011327f},
-std::array<float,2>{0.312871546f, 0.855516315f},
-std::array<float,2>{0.779327512f, 0.399867833f},
-std::array<float,2>{0.646863818f, 0.957315564f},
-std::array<float,2>{0.0614009351f, 0.286915123f},
-std::array<float,2>{0.304844797f, 0.685252845f},
-std::array<float,2>{0.845609725f, 0.131467596f},
-std::array<float,2>{0.965806603f, 0.534179151f},
-std::array<float,2>{0.497676015f, 0.011093366f},
-std::array<float,2>{0.162707895f, 0.79137224f},
-std::array<float,2>{0.564775944f, 0.484523147f},
-std::array<float,2>{0.80734849f, 0.83446604f},
-std::array<float,2>{0.355047017f, 0.43425414f},
-std::array<float,2>{0.0949161798f, 0.600447416f},
-std::array<float,2>{0.716362476f, 0.103859834f},
-std::array<float,2>{0.519428492f, 0.688991666f},
-std::array<float,2>{0.197445869f, 0.22242713f},
-std::array<float,2>{0.393700987f, 0.932725668f},
-std::array<float,2>{0.87848109f, 0.330982327f},
-std::array<float,2>{0.663599491f, 0.781687796f},
-std::array<float,2>{0.00975502562f, 0.497534305f},
-std::array<float,2>{0.271200448f, 0.544622064f},
-std::array<float,2>{0.842351735f, 0.000692707952f},
-std::array<float,2>{0.992467403f, 0.678048491f},
-std::array<float,2>{0.466830045f, 0.133234367f},
-std::array<float,2>{0.154844195f, 0.963969469f},
-std::array<float,2>{0.623959422f, 0.292789698f},
-std::array<float,2>{0.773057401f, 0.923818588f},
-std::array<float,2>{0.32488358f, 0.339844495f},
-std::array<float,2>{0.080728963f, 0.697839439f},
-std::array<float,2>{0.734369993f, 0.233676299f},
-std::array<float,2>{0.558310509f, 0.604138196f},
-std::array<float,2>{0.242134586f, 0.0986726508f},
-std::array<float,2>{0.419680148f, 0.836634278f},
-std::array<float,2>{0.919409156f, 0.426456988f},
-std::array<float,2>{0.576505601f, 0.970055342f},
-std::array<float,2>{0.17046006f, 0.251838207f},
-std::array<float,2>{0.486174703f, 0.638284922f},
-std::array<float,2>{0.957269192f, 0.173900127f},
-std::array<float,2>{0.857849777f, 0.523789704f},
-std::array<float,2>{0.298855841f, 0.0616033264f},
-std::array<float,2>{0.0492901765f, 0.769604087f},
-std::array<float,2>{0.648776174f, 0.445594251f},
-std::array<float,2>{0.888224125f, 0.845768154f},
-std::array<float,2>{0.399416298f, 0.391295284f},
-std::array<float,2>{0.195069402f, 0.587093651f},
-std::array<float,2>{0.526886344f, 0.0913688838f},
-std::array<float,2>{0.710399091f, 0.72679168f},
-std::array<float,2>{0.10168229f, 0.188842282f},
-std::array<float,2>{0.344984263f, 0.896003246f},
-std::array<float,2>{0.797808528f, 0.354671299f},
-std::array<float,2>{0.500590742f, 0.819397092f},
-std::array<float,2>{0.215471014f, 0.417025208f},
-std::array<float,2>{0.390394211f, 0.610542536f},
-std::array<float,2>{0.892681122f, 0.124934241f},
-std::array<float,2>{0.78975147f, 0.714656651f},
-std::array<float,2>{0.368275791f, 0.237749875f},
-std::array<float,2>{0.117087856f, 0.907737613f},
-std::array<float,2>{0.70051986f, 0.3233836f},
-std::array<float,2>{0.938764155f, 0.941091061f},
-std::array<float,2>{0.469912201f, 0.303123772f},
-std::array<float,2>{0.177824765f, 0.669740975f},
-std::array<float,2>{0.587635517f, 0.148387745f},
-std::array<float,2>{0.630567849f, 0.561610043f},
-std::array<float,2>{0.0355887711f, 0.0271792933f},
-std::array<float,2>{0.287209213f, 0.797547579f},
-std::array<float,2>{0.872103274f, 0.479435742f},
-std::array<float,2>{0.738699794f, 0.886300743f},
-std::array<float,2>{0.0717433468f, 0.366526634f},
-std::array<float,2>{0.333297908f, 0.746357322f},
-std::array<float,2>{0.753038704f, 0.216723517f},
-std::array<float,2>{0.923912942f, 0.564348638f},
-std::array<float,2>{0.4322429f, 0.0692325309f},
-std::array<float,2>{0.226288915f, 0.871921659f},
-std::array<float,2>{0.546592176f, 0.384976745f},
-std::array<float,2>{0.825911283f, 0.763832211f},
-std::array<float,2>{0.252984285f, 0.458431005f},
-std::array<float,2>{0.0160632227f, 0.502770483f},
-std::array<float,2>{0.67924124f, 0.0333671607f},
-std::array<float,2>{0.594916165f, 0.646032453f},
-std::array<float,2>{0.130855426f, 0.160767704f},
-std::array<float,2>{0.43944931f, 0.985179901f},
-std::array<float,2>{0.9796229f, 0.276766509f},
-std::array<float,2>{0.637874484f, 0.840396047f},
-std::array<float,2>{0.043622423f, 0.424633116f},
-std::array<float,2>{0.294313014f, 0.607583523f},
-std::array<float,2>{0.864542902f, 0.0958220884f},
-std::array<float,2>{0.946212173f, 0.699504852f},
-std::array<float,2>{0.483521432f, 0.228529513f},
-std::array<float,2>{0.184197068f, 0.927212715f},
-std::array<float,2>{0.580341935f, 0.338006288f},
-std::array<float,2>{0.788129985f, 0.966788471f},
-std::array<float,2>{0.360827297f, 0.293253928f},
-std::array<float,2>{0.118799508f, 0.674394131f},
-std::array<float,2>{0.69337213f, 0.140380576f},
-std::array<float,2>{0.513503194f, 0.539199233f},
-std::array<float,2>{0.203160748f, 0.00392847881f},
-std::array<float,2>{0.377874345f, 0.786412477f},
-std::array<float,2>{0.901704848f, 0.492851347f},
-std::array<float,2>{0.607380569f, 0.892467737f},
-std::array<float,2>{0.134332776f, 0.35738799f},
-std::array<float,2>{0.445749581f, 0.732423127f},
-std::array<float,2>{0.970160007f, 0.193848982f},
-std::array<float,2>{0.813514113f, 0.591589212f},
-std::array<float,2>{0.25913021f, 0.0879755467f},
-std::array<float,2>{0.0280688182f, 0.850149035f},
-std::array<float,2>{0.683801711f, 0.396380335f},
-std::array<float,2>{0.929689884f, 0.767103434f},
-std::array<float,2>{0.428279191f, 0.450286537f},
-std::array<float,2>{0.233511761f, 0.531002581f},
-std::array<float,2>{0.534804404f, 0.057577502f},
-std::array<float,2>{0.746920347f, 0.635982633f},
-std::array<float,2>{0.0685260445f, 0.178869858f},
-std::array<float,2>{0.337105602f, 0.976340711f},
-std::array<float,2>{0.760722995f, 0.254074335f},
-std::array<float,2>{0.549216211f, 0.804044604f},
-std::array<float,2>{0.249884591f, 0.481979728f},
-std::array<float,2>{0.406405389f, 0.557252824f},
-std::array<float,2>{0.909918964f, 0.0311204698f},
-std::array<float,2>{0.774591148f, 0.666783273f},
-std::array<float,2>{0.318338573f, 0.143096372f},
-std::array<float,2>{0.0902846679f, 0.945031643f},
-std::array<float,2>{0.725954711f, 0.299380362f},
-std::array<float,2>{0.989302278f, 0.911929429f},
-std::array<float,2>{0.455688298f, 0.326109231f},
-std::array<float,2>{0.147636011f, 0.715928137f},
-std::array<float,2>{0.610984266f, 0.241367951f},
-std::array<float,2>{0.671355844f, 0.616940081f},
-std::array<float,2>{0.000940148719f, 0.120026328f},
-std::array<float,2>{0.276278585f, 0.81587702f},
-std::array<float,2>{0.83254236f, 0.418200165f},
-std::array<float,2>{0.712040067f, 0.989004374f},
-std::array<float,2>{0.099713698f, 0.281245887f},
-std::array<float,2>{0.358683735f, 0.641691208f},
-std::array<float,2>{0.81193763f, 0.15628536f},
-std::array<float,2>{0.88188231f, 0.505334496f},
-std::array<float,2>{0.396850526f, 0.0359682515f},
-std::array<float,2>{0.200930014f, 0.759086192f},
-std::array<float,2>{0.52132827f, 0.456116945f},
-std::array<float,2>{0.849337161f, 0.868864655f},
-std::array<float,2>{0.312308639f, 0.387378395f},
-std::array<float,2>{0.0564451255f, 0.56836313f},
-std::array<float,2>{0.642356277f, 0.0643214732f},
-std::array<float,2>{0.56751579f, 0.742262602f},
-std::array<float,2>{0.159924462f, 0.213512436f},
-std::array<float,2>{0.495694458f, 0.887585104f},
-std::array<float,2>{0.964094579f, 0.362641096f},
-std::array<float,2>{0.729839623f, 0.753172517f},
-std::array<float,2>{0.0825441778f, 0.46531111f},
-std::array<float,2>{0.320665985f, 0.508013189f},
-std::array<float,2>{0.767872572f, 0.0446323007f},
-std::array<float,2>{0.915507197f, 0.652985573f},
-std::array<float,2>{0.414581895f, 0.164902464f},
-std::array<float,2>{0.238176763f, 0.997121334f},
-std::array<float,2>{0.558871329f, 0.268094867f},
-std::array<float,2>{0.837727845f, 0.876315832f},
-std::array<float,2>{0.26632759f, 0.370517552f},
-std::array<float,2>{0.0124686155f, 0.736775398f},
-std::array<float,2>{0.657228827f, 0.207506821f},
-std::array<float,2>{0.618147314f, 0.577322245f},
-std::array<float,2>{0.149422944f, 0.0751621798f},
-std::array<float,2>{0.461364865f, 0.862510324f},
-std::array<float,2>{0.998022676f, 0.382385492f},
-std::array<float,2>{0.52915442f, 0.947998703f},
-std::array<float,2>{0.190170124f, 0.305520535f},
-std::array<float,2>{0.406148583f, 0.662236631f},
-std::array<float,2>{0.886409521f, 0.151705757f},
-std::array<float,2>{0.80432719f, 0.551003218f},
-std::array<float,2>{0.348906696f, 0.021994032f},
-std::array<float,2>{0.105874851f, 0.809089541f},
-std::array<float,2>{0.703901827f, 0.474837273f},
-std::array<float,2>{0.953832448f, 0.822717011f},
-std::array<float,2>{0.489234775f, 0.413350224f},
-std::array<float,2>{0.165214762f, 0.621874094f},
-std::array<float,2>{0.572409928f, 0.115080126f},
-std::array<float,2>{0.653727591f, 0.710813046f},
-std::array<float,2>{0.0514736623f, 0.247470826f},
-std::array<float,2>{0.301285326f, 0.916909456f},
-std::array<float,2>{0.852402747f, 0.31570214f},
-std::array<float,2>{0.592484057f, 0.853997886f},
-std::array<float,2>{0.175080299f, 0.402457178f},
-std::array<float,2>{0.474019617f, 0.583116591f},
-std::array<float,2>{0.945290804f, 0.0783254057f},
-std::array<float,2>{0.870426059f, 0.720072985f},
-std::array<float,2>{0.283567816f, 0.198543429f},
-std::array<float,2>{0.0332447961f, 0.901517868f},
-std::array<float,2>{0.627407551f, 0.343881845f},
-std::array<float,2>{0.897850037f, 0.977765203f},
-std::array<float,2>{0.384473354f, 0.265013784f},
-std::array<float,2>{0.212629169f, 0.63205111f},
-std::array<float,2>{0.506061494f, 0.180790722f},
-std::array<float,2>{0.698583245f, 0.515964806f},
-std::array<float,2>{0.112455517f, 0.0538337268f},
-std::array<float,2>{0.37401101f, 0.773539007f},
-std::array<float,2>{0.796475947f, 0.438322842f},
-std::array<float,2>{0.672026217f, 0.93644923f},
-std::array<float,2>{0.0216351021f, 0.3334032f},
-std::array<float,2>{0.254057318f, 0.695222318f},
-std::array<float,2>{0.820763171f, 0.225672096f},
-std::array<float,2>{0.983263612f, 0.593979716f},
-std::array<float,2>{0.444580525f, 0.105907977f},
-std::array<float,2>{0.126128018f, 0.829676509f},
-std::array<float,2>{0.598262191f, 0.430268258f},
-std::array<float,2>{0.756121993f, 0.793030024f},
-std::array<float,2>{0.332015663f, 0.489893496f},
-std::array<float,2>{0.0780141875f, 0.538020313f},
-std::array<float,2>{0.737508178f, 0.0125006437f},
-std::array<float,2>{0.542937517f, 0.680468857f},
-std::array<float,2>{0.221753463f, 0.128168225f},
-std::array<float,2>{0.437271237f, 0.954102933f},
-std::array<float,2>{0.929025114f, 0.282215059f},
-std::array<float,2>{0.744126618f, 0.827119112f},
-std::array<float,2>{0.0636195913f, 0.409431845f},
-std::array<float,2>{0.340917677f, 0.619551182f},
-std::array<float,2>{0.765113115f, 0.111803748f},
-std::array<float,2>{0.936718047f, 0.706458151f},
-std::array<float,2>{0.425100982f, 0.243773639f},
-std::array<float,2>{0.227580979f, 0.921415508f},
-std::array<float,2>{0.536217451f, 0.317287147f},
-std::array<float,2>{0.818092227f, 0.949300945f},
-std::array<float,2>{0.262464464f, 0.309894949f},
-std::array<float,2>{0.024835607f, 0.657603383f},
-std::array<float,2>{0.683585405f, 0.152521983f},
-std::array<float,2>{0.604076922f, 0.548422933f},
-std::array<float,2>{0.139750078f, 0.0179546475f},
-std::array<float,2>{0.450193703f, 0.80661577f},
-std::array<float,2>{0.973135591f, 0.469621569f},
-std::array<float,2>{0.508809626f, 0.880765021f},
-std::array<float,2>{0.207966864f, 0.372100443f},
-std::array<float,2>{0.381811529f, 0.739094317f},
-std::array<float,2>{0.902760208f, 0.205904379f},
-std::array<float,2>{0.781990588f, 0.570664704f},
-std::array<float,2>{0.366427362f, 0.0717910007f},
-std::array<float,2>{0.122899123f, 0.864815652f},
-std::array<float,2>{0.688425362f, 0.377720535f},
-std::array<float,2>{0.953018248f, 0.754619658f},
-std::array<float,2>{0.477901131f, 0.463350058f},
-std::array<float,2>{0.18235451f, 0.514550149f},
-std::array<float,2>{0.585691571f, 0.0421494618f},
-std::array<float,2>{0.634132504f, 0.651406407f},
-std::array<float,2>{0.0409406722f, 0.169741035f},
-std::array<float,2>{0.292449355f, 0.9929052f},
-std::array<float,2>{0.860837579f, 0.271063328f},
-std::array<float,2>{0.564438462f, 0.790464699f},
-std::array<float,2>{0.16188027f, 0.488076121f},
-std::array<float,2>{0.499018937f, 0.531747937f},
-std::array<float,2>{0.968178391f, 0.00890783034f},
-std::array<float,2>{0.845747173f, 0.687326252f},
-std::array<float,2>{0.308207154f, 0.129154861f},
-std::array<float,2>{0.0586778149f, 0.960139632f},
-std::array<float,2>{0.646197975f, 0.287777454f},
-std::array<float,2>{0.876549363f, 0.930703759f},
-std::array<float,2>{0.391374379f, 0.32843703f},
-std::array<float,2>{0.196712375f, 0.690265298f},
-std::array<float,2>{0.517331183f, 0.220042422f},
-std::array<float,2>{0.7185179f, 0.599117756f},
-std::array<float,2>{0.0958639458f, 0.102773845f},
-std::array<float,2>{0.351990938f, 0.833701491f},
-std::array<float,2>{0.805734754f, 0.436109304f},
-std::array<float,2>{0.667271078f, 0.983072281f},
-std::array<float,2>{0.00570870331f, 0.261457831f},
-std::array<float,2>{0.277675599f, 0.625316978f},
-std::array<float,2>{0.831347525f, 0.185670212f},
-std::array<float,2>{0.98742801f, 0.521148801f},
-std::array<float,2>{0.460756212f, 0.0470698141f},
-std::array<float,2>{0.14358528f, 0.778988183f},
-std::array<float,2>{0.61595434f, 0.444452286f},
-std::array<float,2>{0.77779752f, 0.858448505f},
-std::array<float,2>{0.314531744f, 0.400893331f},
-std::array<float,2>{0.0885430127f, 0.580323637f},
-std::array<float,2>{0.722141027f, 0.0821892098f},
-std::array<float,2>{0.551799536f, 0.725490153f},
-std::array<float,2>{0.245125815f, 0.199809045f},
-std::array<float,2>{0.413062423f, 0.905045688f},
-std::array<float,2>{0.912705004f, 0.351350933f},
-std::array<float,2>{0.650652766f, 0.773177683f},
-std::array<float,2>{0.0472981595f, 0.447687358f},
-std::array<float,2>{0.298615366f, 0.526107311f},
-std::array<float,2>{0.856474519f, 0.0589537919f},
-std::array<float,2>{0.959922552f, 0.639283895f},
-std::array<float,2>{0.487049043f, 0.173009038f},
-std::array<float,2>{0.169790477f, 0.971913934f},
-std::array<float,2>{0.574881375f, 0.252642125f},
-std::array<float,2>{0.800524592f, 0.897575796f},
-std::array<float,2>{0.346140623f, 0.35335958f},
-std::array<float,2>{0.104597189f, 0.730291605f},
-std::array<float,2>{0.708414137f, 0.190586686f},
-std::array<float,2>{0.524015903f, 0.589277089f},
-std::array<float,2>{0.193188965f, 0.0926761478f},
-std::array<float,2>{0.401891202f, 0.8444345f},
-std::array<float,2>{0.889031172f, 0.394188732f},
-std::array<float,2>{0.622609854f, 0.96181488f},
-std::array<float,2>{0.152663201f, 0.289777666f},
-std::array<float,2>{0.465824455f, 0.675797701f},
-std::array<float,2>{0.995726287f, 0.134877622f},
-std::array<float,2>{0.840833604f, 0.546677113f},
-std::array<float,2>{0.272974819f, 0.0028122298f},
-std::array<float,2>{0.0103824828f, 0.783980489f},
-std::array<float,2>{0.660321176f, 0.498228401f},
-std::array<float,2>{0.921631396f, 0.839562774f},
-std::array<float,2>{0.420126557f, 0.42955479f},
-std::array<float,2>{0.239410058f, 0.60269767f},
-std::array<float,2>{0.555354118f, 0.101078279f},
-std::array<float,2>{0.73179096f, 0.696148872f},
-std::array<float,2>{0.080076009f, 0.232337743f},
-std::array<float,2>{0.326243311f, 0.924898028f},
-std::array<float,2>{0.769537687f, 0.343286127f},
-std::array<float,2>{0.544081748f, 0.87323302f},
-std::array<float,2>{0.224232078f, 0.383100897f},
-std::array<float,2>{0.430859566f, 0.564675689f},
-std::array<float,2>{0.922100008f, 0.0673399344f},
-std::array<float,2>{0.750300586f, 0.748209417f},
-std::array<float,2>{0.334038615f, 0.21766673f},
-std::array<float,2>{0.0725630522f, 0.883987308f},
-std::array<float,2>{0.740472615f, 0.364723593f},
-std::array<float,2>{0.978284001f, 0.987471581f},
-std::array<float,2>{0.440033495f, 0.274354398f},
-std::array<float,2>{0.131470829f, 0.64671886f},
-std::array<float,2>{0.597232938f, 0.163792893f},
-std::array<float,2>{0.677353978f, 0.500971913f},
-std::array<float,2>{0.0187061075f, 0.031253662f},
-std::array<float,2>{0.251655489f, 0.762029946f},
-std::array<float,2>{0.827477872f, 0.460856676f},
-std::array<float,2>{0.701171994f, 0.909416676f},
-std::array<float,2>{0.11419367f, 0.321542084f},
-std::array<float,2>{0.370801598f, 0.711491227f},
-std::array<float,2>{0.791854978f, 0.235360056f},
-std::array<float,2>{0.891965687f, 0.613239884f},
-std::array<float,2>{0.387387663f, 0.1220771f},
-std::array<float,2>{0.21747911f, 0.816414654f},
-std::array<float,2>{0.503565371f, 0.415053695f},
-std::array<float,2>{0.874031782f, 0.800583243f},
-std::array<float,2>{0.286639065f, 0.476849884f},
-std::array<float,2>{0.038516365f, 0.559202254f},
-std::array<float,2>{0.632468939f, 0.0242803469f},
-std::array<float,2>{0.588509619f, 0.671765864f},
-std::array<float,2>{0.177709609f, 0.14560695f},
-std::array<float,2>{0.471914053f, 0.93867898f},
-std::array<float,2>{0.941130996f, 0.300855428f},
-std::array<float,2>{0.687097728f, 0.847777903f},
-std::array<float,2>{0.0297975503f, 0.398066849f},
-std::array<float,2>{0.261386484f, 0.593046904f},
-std::array<float,2>{0.81572628f, 0.0875139907f},
-std::array<float,2>{0.971171141f, 0.73110956f},
-std::array<float,2>{0.448681056f, 0.191900879f},
-std::array<float,2>{0.136695504f, 0.8932634f},
-std::array<float,2>{0.607696593f, 0.359218627f},
-std::array<float,2>{0.759418607f, 0.973149419f},
-std::array<float,2>{0.338272929f, 0.256160051f},
-std::array<float,2>{0.0668531656f, 0.634654403f},
-std::array<float,2>{0.749785781f, 0.176393941f},
-std::array<float,2>{0.531546474f, 0.527492225f},
-std::array<float,2>{0.231554717f, 0.0563555807f},
-std::array<float,2>{0.42699945f, 0.767581284f},
-std::array<float,2>{0.932975948f, 0.452962935f},
-std::array<float,2>{0.57863301f, 0.929465175f},
-std::array<float,2>{0.185589522f, 0.337705612f},
-std::array<float,2>{0.48215279f, 0.702447951f},
-std::array<float,2>{0.948409915f, 0.228267699f},
-std::array<float,2>{0.866860032f, 0.605852604f},
-std::array<float,2>{0.295206934f, 0.0941771194f},
-std::array<float,2>{0.0452775434f, 0.84231329f},
-std::array<float,2>{0.639353812f, 0.423146367f},
-std::array<float,2>{0.898517072f, 0.787123322f},
-std::array<float,2>{0.375957578f, 0.495127678f},
-std::array<float,2>{0.205838367f, 0.541767359f},
-std::array<float,2>{0.515488327f, 0.005893806f},
-std::array<float,2>{0.692846715f, 0.673374772f},
-std::array<float,2>{0.119826153f, 0.137455523f},
-std::array<float,2>{0.362954974f, 0.967611074f},
-std::array<float,2>{0.786524951f, 0.296626925f},
-std::array<float,2>{0.523222923f, 0.760038257f},
-std::array<float,2>{0.202642068f, 0.453923851f},
-std::array<float,2>{0.394838631f, 0.506166041f},
-std::array<float,2>{0.880118191f, 0.0388177373f},
-std::array<float,2>{0.808841228f, 0.644127131f},
-std::array<float,2>{0.355801433f, 0.159657255f},
-std::array<float,2>{0.098657243f, 0.990338862f},
-std::array<float,2>{0.714089751f, 0.278376997f},
-std::array<float,2>{0.961175561f, 0.889055371f},
-std::array<float,2>{0.492491573f, 0.360285491f},
-std::array<float,2>{0.156499147f, 0.744381547f},
-std::array<float,2>{0.568530321f, 0.212436274f},
-std::array<float,2>{0.644285142f, 0.568151295f},
-std::array<float,2>{0.0585721955f, 0.0648695752f},
-std::array<float,2>{0.308958888f, 0.869391084f},
-std::array<float,2>{0.850451946f, 0.389142126f},
-std::array<float,2>{0.723124981f, 0.943318784f},
-std::array<float,2>{0.0933166444f, 0.297519207f},
-std::array<float,2>{0.320148528f, 0.664392829f},
-std::array<float,2>{0.776985109f, 0.142044857f},
-std::array<float,2>{0.907536268f, 0.554783583f},
-std::array<float,2>{0.408375025f, 0.029202709f},
-std::array<float,2>{0.246825829f, 0.802516103f},
-std::array<float,2>{0.547015548f, 0.483923256f},
-std::array<float,2>{0.835280716f, 0.813248634f},
-std::array<float,2>{0.275060683f, 0.420035183f},
-std::array<float,2>{0.00257129082f, 0.613819599f},
-std::array<float,2>{0.668040514f, 0.117862485f},
-std::array<float,2>{0.611773193f, 0.717300534f},
-std::array<float,2>{0.144746587f, 0.239066273f},
-std::array<float,2>{0.455010891f, 0.912286282f},
-std::array<float,2>{0.991152823f, 0.327860564f},
-std::array<float,2>{0.706332266f, 0.810976088f},
-std::array<float,2>{0.109139904f, 0.472749531f},
-std::array<float,2>{0.351328224f, 0.554436743f},
-std::array<float,2>{0.801619589f, 0.0209889598f},
-std::array<float,2>{0.883259594f, 0.661531329f},
-std::array<float,2>{0.402401567f, 0.150278509f},
-std::array<float,2>{0.189288378f, 0.947034299f},
-std::array<float,2>{0.529461682f, 0.307855189f},
-std::array<float,2>{0.854259312f, 0.915304244f},
-std::array<float,2>{0.303204656f, 0.312503874f},
-std::array<float,2>{0.0534728058f, 0.708383203f},
-std::array<float,2>{0.654527128f, 0.249848709f},
-std::array<float,2>{0.570465028f, 0.623414397f},
-std::array<float,2>{0.166574448f, 0.116835445f},
-std::array<float,2>{0.490872115f, 0.821989655f},
-std::array<float,2>{0.956846118f, 0.41045925f},
-std::array<float,2>{0.561567605f, 0.999847531f},
-std::array<float,2>{0.235210836f, 0.267403245f},
-std::array<float,2>{0.416027248f, 0.655113339f},
-std::array<float,2>{0.916849852f, 0.167622849f},
-std::array<float,2>{0.767078698f, 0.510864139f},
-std::array<float,2>{0.323235422f, 0.0455402732f},
-std::array<float,2>{0.0856200904f, 0.750454485f},
-std::array<float,2>{0.727693081f, 0.468548447f},
-std::array<float,2>{0.999598145f, 0.860310555f},
-std::array<float,2>{0.464334428f, 0.379653662f},
-std::array<float,2>{0.150717959f, 0.575517833f},
-std::array<float,2>{0.619659066f, 0.0762210935f},
-std::array<float,2>{0.659427404f, 0.735453784f},
-std::array<float,2>{0.0155131454f, 0.209489584f},
-std::array<float,2>{0.268073559f, 0.878564417f},
-std::array<float,2>{0.838289559f, 0.368714809f},
-std::array<float,2>{0.601202667f, 0.830964446f},
-std::array<float,2>{0.128339201f, 0.432940394f},
-std::array<float,2>{0.442698181f, 0.596625984f},
-std::array<float,2>{0.982272506f, 0.109194346f},
-std::array<float,2>{0.823809743f, 0.692357719f},
-std::array<float,2>{0.25719884f, 0.22337395f},
-std::array<float,2>{0.0200541653f, 0.935156167f},
-std::array<float,2>{0.674345374f, 0.335144877f},
-std::array<float,2>{0.925997198f, 0.955618262f},
-std::array<float,2>{0.434905231f, 0.283594817f},
-std::array<float,2>{0.219149664f, 0.682006121f},
-std::array<float,2>{0.539961517f, 0.126354933f},
-std::array<float,2>{0.735707819f, 0.536791325f},
-std::array<float,2>{0.0755604208f, 0.0154118454f},
-std::array<float,2>{0.328441203f, 0.795292318f},
-std::array<float,2>{0.754092932f, 0.491637468f},
-std::array<float,2>{0.626277149f, 0.900277376f},
-std::array<float,2>{0.0317770466f, 0.347535044f},
-std::array<float,2>{0.281740755f, 0.722186863f},
-std::array<float,2>{0.869003296f, 0.196451604f},
-std::array<float,2>{0.94328022f, 0.584415615f},
-std::array<float,2>{0.475053996f, 0.0808178633f},
-std::array<float,2>{0.172809437f, 0.852984607f},
-std::array<float,2>{0.590763748f, 0.404688239f},
-std::array<float,2>{0.794402122f, 0.777132988f},
-std::array<float,2>{0.372349411f, 0.439864516f},
-std::array<float,2>{0.109988891f, 0.51937604f},
-std::array<float,2>{0.695883036f, 0.0509847738f},
-std::array<float,2>{0.504188538f, 0.630135417f},
-std::array<float,2>{0.213452682f, 0.183373675f},
-std::array<float,2>{0.386188924f, 0.979422331f},
-std::array<float,2>{0.895409226f, 0.261933863f},
-std::array<float,2>{0.727123141f, 0.862624109f},
-std::array<float,2>{0.0840841979f, 0.382653356f},
-std::array<float,2>{0.323452413f, 0.57740581f},
-std::array<float,2>{0.765896618f, 0.074798964f},
-std::array<float,2>{0.917201102f, 0.736415982f},
-std::array<float,2>{0.417448193f, 0.207048818f},
-std::array<float,2>{0.235421583f, 0.876095474f},
-std::array<float,2>{0.560628712f, 0.370283067f},
-std::array<float,2>{0.838878095f, 0.997534752f},
-std::array<float,2>{0.269419551f, 0.268513799f},
-std::array<float,2>{0.0140492888f, 0.653109968f},
-std::array<float,2>{0.658584118f, 0.164620623f},
-std::array<float,2>{0.620912671f, 0.508219182f},
-std::array<float,2>{0.152051315f, 0.0447976291f},
-std::array<float,2>{0.463104248f, 0.75318712f},
-std::array<float,2>{0.998550296f, 0.464935243f},
-std::array<float,2>{0.531105399f, 0.916566014f},
-std::array<float,2>{0.18753916f, 0.315508932f},
-std::array<float,2>{0.404201865f, 0.710596919f},
-std::array<float,2>{0.884549975f, 0.247281477f},
-std::array<float,2>{0.801973045f, 0.621647537f},
-std::array<float,2>{0.350550383f, 0.114957355f},
-std::array<float,2>{0.108305588f, 0.822485149f},
-std::array<float,2>{0.705355465f, 0.413143814f},
-std::array<float,2>{0.956027687f, 0.809419274f},
-std::array<float,2>{0.492106736f, 0.47490412f},
-std::array<float,2>{0.167376727f, 0.551091969f},
-std::array<float,2>{0.572000265f, 0.0222963244f},
-std::array<float,2>{0.655474067f, 0.662389159f},
-std::array<float,2>{0.0543296337f, 0.151539162f},
-std::array<float,2>{0.303792983f, 0.947874546f},
-std::array<float,2>{0.854611576f, 0.305258304f},
-std::array<float,2>{0.591525137f, 0.773688078f},
-std::array<float,2>{0.173434466f, 0.438024253f},
-std::array<float,2>{0.476056755f, 0.515750468f},
-std::array<float,2>{0.942289174f, 0.0541989133f},
-std::array<float,2>{0.867836535f, 0.632136643f},
-std::array<float,2>{0.282422066f, 0.180936694f},
-std::array<float,2>{0.0328794755f, 0.977948785f},
-std::array<float,2>{0.625722826f, 0.264717251f},
-std::array<float,2>{0.895575762f, 0.901667237f},
-std::array<float,2>{0.384790242f, 0.344216973f},
-std::array<float,2>{0.214447305f, 0.719769955f},
-std::array<float,2>{0.505154431f, 0.198397577f},
-std::array<float,2>{0.696780741f, 0.58342284f},
-std::array<float,2>{0.111063547f, 0.0784816816f},
-std::array<float,2>{0.371869862f, 0.853755534f},
-std::array<float,2>{0.793132544f, 0.402744621f},
-std::array<float,2>{0.675643742f, 0.954465508f},
-std::array<float,2>{0.0212586951f, 0.281977832f},
-std::array<float,2>{0.256246507f, 0.680348158f},
-std::array<float,2>{0.82282871f, 0.128361419f},
-std::array<float,2>{0.980677545f, 0.537599802f},
-std::array<float,2>{0.442053467f, 0.0123982541f},
-std::array<float,2>{0.127612129f, 0.793415964f},
-std::array<float,2>{0.600162148f, 0.490081698f},
-std::array<float,2>{0.755457401f, 0.829957962f},
-std::array<float,2>{0.329149663f, 0.430535167f},
-std::array<float,2>{0.0746154413f, 0.594025791f},
-std::array<float,2>{0.735187769f, 0.105671979f},
-std::array<float,2>{0.54040581f, 0.694854915f},
-std::array<float,2>{0.22015509f, 0.225990191f},
-std::array<float,2>{0.434097409f, 0.936201513f},
-std::array<float,2>{0.927277982f, 0.333143294f},
-std::array<float,2>{0.640220106f, 0.786139905f},
-std::array<float,2>{0.046721492f, 0.493139088f},
-std::array<float,2>{0.29677251f, 0.539438963f},
-std::array<float,2>{0.866147995f, 0.00424344745f},
-std::array<float,2>{0.947622538f, 0.674701333f},
-std::array<float,2>{0.480677426f, 0.140506953f},
-std::array<float,2>{0.186860427f, 0.966428578f},
-std::array<float,2>{0.579363585f, 0.293199599f},
-std::array<float,2>{0.785778761f, 0.926936865f},
-std::array<float,2>{0.362020224f, 0.338358492f},
-std::array<float,2>{0.120415658f, 0.69936657f},
-std::array<float,2>{0.692382514f, 0.228806034f},
-std::array<float,2>{0.514113486f, 0.607827783f},
-std::array<float,2>{0.206338108f, 0.0959885642f},
-std::array<float,2>{0.376176894f, 0.840617478f},
-std::array<float,2>{0.899649024f, 0.424519241f},
-std::array<float,2>{0.608965933f, 0.97616142f},
-std::array<float,2>{0.134976521f, 0.254371077f},
-std::array<float,2>{0.448139131f, 0.636096954f},
-std::array<float,2>{0.971773863f, 0.179048836f},
-std::array<float,2>{0.81536603f, 0.531097233f},
-std::array<float,2>{0.260146558f, 0.0572293811f},
-std::array<float,2>{0.0310027786f, 0.767503738f},
-std::array<float,2>{0.685839295f, 0.45066312f},
-std::array<float,2>{0.932227373f, 0.850402057f},
-std::array<float,2>{0.425835818f, 0.396232069f},
-std::array<float,2>{0.230681539f, 0.59138f},
-std::array<float,2>{0.533140242f, 0.0882448927f},
-std::array<float,2>{0.748682022f, 0.732734561f},
-std::array<float,2>{0.0679075643f, 0.194097981f},
-std::array<float,2>{0.339289099f, 0.892129302f},
-std::array<float,2>{0.758119106f, 0.356978685f},
-std::array<float,2>{0.548299372f, 0.815474153f},
-std::array<float,2>{0.247852191f, 0.418361515f},
-std::array<float,2>{0.409957767f, 0.617074788f},
-std::array<float,2>{0.907040894f, 0.119830132f},
-std::array<float,2>{0.775695026f, 0.716305971f},
-std::array<float,2>{0.318736017f, 0.2416026f},
-std::array<float,2>{0.0918048471f, 0.911652863f},
-std::array<float,2>{0.723792195f, 0.325830519f},
-std::array<float,2>{0.99184525f, 0.945108712f},
-std::array<float,2>{0.453940302f, 0.29975152f},
-std::array<float,2>{0.145515785f, 0.666533947f},
-std::array<float,2>{0.613017797f, 0.143338531f},
-std::array<float,2>{0.669029117f, 0.557516873f},
-std::array<float,2>{0.00358859496f, 0.030950848f},
-std::array<float,2>{0.273939013f, 0.803802013f},
-std::array<float,2>{0.834945917f, 0.482208967f},
-std::array<float,2>{0.713625908f, 0.887217522f},
-std::array<float,2>{0.0986085236f, 0.3623707f},
-std::array<float,2>{0.357351512f, 0.742616355f},
-std::array<float,2>{0.810197711f, 0.213721365f},
-std::array<float,2>{0.879556835f, 0.568709671f},
-std::array<float,2>{0.396274358f, 0.0639667138f},
-std::array<float,2>{0.201430142f, 0.86901933f},
-std::array<float,2>{0.521702111f, 0.387591988f},
-std::array<float,2>{0.851059675f, 0.758886099f},
-std::array<float,2>{0.310534179f, 0.456419468f},
-std::array<float,2>{0.0570507422f, 0.504886329f},
-std::array<float,2>{0.643340111f, 0.0358527675f},
-std::array<float,2>{0.570212007f, 0.642009795f},
-std::array<float,2>{0.157259196f, 0.156618118f},
-std::array<float,2>{0.493263394f, 0.989059448f},
-std::array<float,2>{0.962087095f, 0.280782074f},
-std::array<float,2>{0.662058353f, 0.836694837f},
-std::array<float,2>{0.0112394914f, 0.426649451f},
-std::array<float,2>{0.271691769f, 0.604248762f},
-std::array<float,2>{0.8404845f, 0.0991157889f},
-std::array<float,2>{0.994830549f, 0.698225319f},
-std::array<float,2>{0.465728939f, 0.233506247f},
-std::array<float,2>{0.154071733f, 0.923502982f},
-std::array<float,2>{0.62168473f, 0.340159625f},
-std::array<float,2>{0.770549715f, 0.96429342f},
-std::array<float,2>{0.328037053f, 0.292510629f},
-std::array<float,2>{0.078874357f, 0.677824616f},
-std::array<float,2>{0.731369615f, 0.133045346f},
-std::array<float,2>{0.555672705f, 0.544859469f},
-std::array<float,2>{0.238624409f, 0.000752594147f},
-std::array<float,2>{0.421155334f, 0.781393826f},
-std::array<float,2>{0.919960082f, 0.49718526f},
-std::array<float,2>{0.575735986f, 0.896320403f},
-std::array<float,2>{0.168240577f, 0.35496822f},
-std::array<float,2>{0.48734048f, 0.726891339f},
-std::array<float,2>{0.960823357f, 0.18860884f},
-std::array<float,2>{0.855991006f, 0.587290466f},
-std::array<float,2>{0.297481477f, 0.0917610079f},
-std::array<float,2>{0.0482006893f, 0.846037507f},
-std::array<float,2>{0.651376307f, 0.391515195f},
-std::array<float,2>{0.890338898f, 0.769982576f},
-std::array<float,2>{0.401163548f, 0.445405126f},
-std::array<float,2>{0.192293212f, 0.523564696f},
-std::array<float,2>{0.524514794f, 0.0619348288f},
-std::array<float,2>{0.707625031f, 0.638448596f},
-std::array<float,2>{0.104090825f, 0.174278468f},
-std::array<float,2>{0.347296685f, 0.969732344f},
-std::array<float,2>{0.799098313f, 0.251498908f},
-std::array<float,2>{0.502573609f, 0.797794402f},
-std::array<float,2>{0.218694523f, 0.479125947f},
-std::array<float,2>{0.388390183f, 0.561824501f},
-std::array<float,2>{0.891489685f, 0.0269121211f},
-std::array<float,2>{0.792682111f, 0.669561625f},
-std::array<float,2>{0.369976223f, 0.148137406f},
-std::array<float,2>{0.114846841f, 0.941332579f},
-std::array<float,2>{0.702386439f, 0.302906513f},
-std::array<float,2>{0.939568937f, 0.9079687f},
-std::array<float,2>{0.471507818f, 0.323658288f},
-std::array<float,2>{0.176303893f, 0.71459645f},
-std::array<float,2>{0.589252532f, 0.237317428f},
-std::array<float,2>{0.63165164f, 0.610804796f},
-std::array<float,2>{0.0378358401f, 0.124712519f},
-std::array<float,2>{0.285427779f, 0.819633543f},
-std::array<float,2>{0.873049021f, 0.417368263f},
-std::array<float,2>{0.742028296f, 0.984874308f},
-std::array<float,2>{0.0734791756f, 0.276436716f},
-std::array<float,2>{0.335572988f, 0.646265507f},
-std::array<float,2>{0.751706123f, 0.161094084f},
-std::array<float,2>{0.923514545f, 0.502627492f},
-std::array<float,2>{0.430646181f, 0.0336130559f},
-std::array<float,2>{0.223579332f, 0.764021456f},
-std::array<float,2>{0.543647766f, 0.458042592f},
-std::array<float,2>{0.826218843f, 0.871792078f},
-std::array<float,2>{0.250012249f, 0.385013908f},
-std::array<float,2>{0.0177588798f, 0.563985884f},
-std::array<float,2>{0.676350474f, 0.0689712912f},
-std::array<float,2>{0.59581238f, 0.746269405f},
-std::array<float,2>{0.132504568f, 0.216452405f},
-std::array<float,2>{0.441331297f, 0.886605263f},
-std::array<float,2>{0.977272987f, 0.366280824f},
-std::array<float,2>{0.68869108f, 0.756017983f},
-std::array<float,2>{0.121697396f, 0.461116791f},
-std::array<float,2>{0.365521282f, 0.513310373f},
-std::array<float,2>{0.783123374f, 0.0397467799f},
-std::array<float,2>{0.903478444f, 0.650230825f},
-std::array<float,2>{0.382187366f, 0.171177372f},
-std::array<float,2>{0.208370388f, 0.995995522f},
-std::array<float,2>{0.508493304f, 0.271609545f},
-std::array<float,2>{0.860047042f, 0.882256925f},
-std::array<float,2>{0.291470796f, 0.374270916f},
-std::array<float,2>{0.0391729064f, 0.741924822f},
-std::array<float,2>{0.632864118f, 0.204766572f},
-std::array<float,2>{0.584836483f, 0.572854877f},
-std::array<float,2>{0.182956442f, 0.0724527016f},
-std::array<float,2>{0.477291673f, 0.865434229f},
-std::array<float,2>{0.951830983f, 0.376101345f},
-std::array<float,2>{0.535440505f, 0.952222586f},
-std::array<float,2>{0.227342546f, 0.311448991f},
-std::array<float,2>{0.42414391f, 0.658513367f},
-std::array<float,2>{0.935764134f, 0.155573472f},
-std::array<float,2>{0.763849318f, 0.549479544f},
-std::array<float,2>{0.3400985f, 0.0158251505f},
-std::array<float,2>{0.0629881024f, 0.806709528f},
-std::array<float,2>{0.74263835f, 0.471664041f},
-std::array<float,2>{0.974115849f, 0.825375736f},
-std::array<float,2>{0.450587094f, 0.407488883f},
-std::array<float,2>{0.138683334f, 0.618420899f},
-std::array<float,2>{0.605233252f, 0.109424353f},
-std::array<float,2>{0.681807995f, 0.704456508f},
-std::array<float,2>{0.0241668746f, 0.245518327f},
-std::array<float,2>{0.263548553f, 0.919286013f},
-std::array<float,2>{0.817156911f, 0.319920093f},
-std::array<float,2>{0.616563022f, 0.855790615f},
-std::array<float,2>{0.142892852f, 0.399493635f},
-std::array<float,2>{0.459272355f, 0.578168333f},
-std::array<float,2>{0.98677963f, 0.0850547925f},
-std::array<float,2>{0.830447733f, 0.723888516f},
-std::array<float,2>{0.279208481f, 0.202638462f},
-std::array<float,2>{0.00397358695f, 0.904129565f},
-std::array<float,2>{0.666760623f, 0.34850961f},
-std::array<float,2>{0.913574994f, 0.981473505f},
-std::array<float,2>{0.413782626f, 0.259436667f},
-std::array<float,2>{0.24503997f, 0.628781736f},
-std::array<float,2>{0.55135572f, 0.184330225f},
-std::array<float,2>{0.721462846f, 0.522591472f},
-std::array<float,2>{0.0893779993f, 0.0498446412f},
-std::array<float,2>{0.315744936f, 0.78046757f},
-std::array<float,2>{0.778992891f, 0.442930311f},
-std::array<float,2>{0.645495832f, 0.932938099f},
-std::array<float,2>{0.0603084303f, 0.330681562f},
-std::array<float,2>{0.307471454f, 0.689301193f},
-std::array<float,2>{0.846975625f, 0.222187921f},
-std::array<float,2>{0.966909468f, 0.600183368f},
-std::array<float,2>{0.499463707f, 0.103758253f},
-std::array<float,2>{0.160815746f, 0.834049702f},
-std::array<float,2>{0.562502086f, 0.434544981f},
-std::array<float,2>{0.804929018f, 0.791070879f},
-std::array<float,2>{0.353090256f, 0.484699368f},
-std::array<float,2>{0.0976177081f, 0.533783019f},
-std::array<float,2>{0.717430532f, 0.0109394966f},
-std::array<float,2>{0.51578927f, 0.685371637f},
-std::array<float,2>{0.196061984f, 0.131772041f},
-std::array<float,2>{0.392336965f, 0.957044661f},
-std::array<float,2>{0.875605166f, 0.286630809f},
-std::array<float,2>{0.704249442f, 0.822041869f},
-std::array<float,2>{0.107372105f, 0.410187662f},
-std::array<float,2>{0.348342985f, 0.623102248f},
-std::array<float,2>{0.80323863f, 0.116967387f},
-std::array<float,2>{0.885166526f, 0.708013177f},
-std::array<float,2>{0.404463828f, 0.24974294f},
-std::array<float,2>{0.190717474f, 0.915099442f},
-std::array<float,2>{0.528045952f, 0.312965691f},
-std::array<float,2>{0.852882683f, 0.946829259f},
-std::array<float,2>{0.302514285f, 0.307889551f},
-std::array<float,2>{0.0525177419f, 0.661369979f},
-std::array<float,2>{0.653056204f, 0.149952024f},
-std::array<float,2>{0.574027538f, 0.554648876f},
-std::array<float,2>{0.164633155f, 0.0205270518f},
-std::array<float,2>{0.489436567f, 0.810606897f},
-std::array<float,2>{0.954815865f, 0.473040938f},
-std::array<float,2>{0.560022771f, 0.878890872f},
-std::array<float,2>{0.237287343f, 0.369063288f},
-std::array<float,2>{0.415435016f, 0.735748649f},
-std::array<float,2>{0.91445291f, 0.209848806f},
-std::array<float,2>{0.769126415f, 0.575324833f},
-std::array<float,2>{0.321850598f, 0.0764972568f},
-std::array<float,2>{0.0839842111f, 0.860001206f},
-std::array<float,2>{0.729483426f, 0.379618049f},
-std::array<float,2>{0.996892393f, 0.750162542f},
-std::array<float,2>{0.462327152f, 0.468493223f},
-std::array<float,2>{0.149000227f, 0.511199117f},
-std::array<float,2>{0.619014144f, 0.0458001234f},
-std::array<float,2>{0.656720221f, 0.654942214f},
-std::array<float,2>{0.0128598288f, 0.167885199f},
-std::array<float,2>{0.266884893f, 0.999530554f},
-std::array<float,2>{0.836582661f, 0.267161757f},
-std::array<float,2>{0.599150717f, 0.795087457f},
-std::array<float,2>{0.125251427f, 0.491454035f},
-std::array<float,2>{0.443823457f, 0.536891878f},
-std::array<float,2>{0.984250426f, 0.0153002124f},
-std::array<float,2>{0.821445465f, 0.681782842f},
-std::array<float,2>{0.255479723f, 0.125998452f},
-std::array<float,2>{0.0227205995f, 0.955916822f},
-std::array<float,2>{0.673421919f, 0.283282399f},
-std::array<float,2>{0.928036749f, 0.935491145f},
-std::array<float,2>{0.435786545f, 0.335356474f},
-std::array<float,2>{0.220707849f, 0.691947997f},
-std::array<float,2>{0.541718602f, 0.223463282f},
-std::array<float,2>{0.73706907f, 0.596295953f},
-std::array<float,2>{0.076263912f, 0.108984351f},
-std::array<float,2>{0.330657482f, 0.830720603f},
-std::array<float,2>{0.757519722f, 0.432727665f},
-std::array<float,2>{0.628194869f, 0.979203939f},
-std::array<float,2>{0.0344098173f, 0.262010843f},
-std::array<float,2>{0.284915596f, 0.630054057f},
-std::array<float,2>{0.869301379f, 0.183173195f},
-std::array<float,2>{0.944076002f, 0.519140482f},
-std::array<float,2>{0.472947538f, 0.0512291901f},
-std::array<float,2>{0.173882574f, 0.777037978f},
-std::array<float,2>{0.593449295f, 0.439523607f},
-std::array<float,2>{0.795119643f, 0.852627337f},
-std::array<float,2>{0.374212235f, 0.40444991f},
-std::array<float,2>{0.11135f, 0.584180117f},
-std::array<float,2>{0.697622597f, 0.0805669054f},
-std::array<float,2>{0.507517099f, 0.722556531f},
-std::array<float,2>{0.211022034f, 0.196777061f},
-std::array<float,2>{0.383560866f, 0.900106788f},
-std::array<float,2>{0.897041082f, 0.347386569f},
-std::array<float,2>{0.684673429f, 0.767940819f},
-std::array<float,2>{0.0291360188f, 0.452797055f},
-std::array<float,2>{0.258254081f, 0.527734697f},
-std::array<float,2>{0.81285423f, 0.0565399975f},
-std::array<float,2>{0.969522059f, 0.634295642f},
-std::array<float,2>{0.446589708f, 0.176542848f},
-std::array<float,2>{0.133477584f, 0.973506033f},
-std::array<float,2>{0.605544627f, 0.256101012f},
-std::array<float,2>{0.761690855f, 0.893487453f},
-std::array<float,2>{0.336164951f, 0.359038025f},
-std::array<float,2>{0.0701803267f, 0.731202066f},
-std::array<float,2>{0.747394741f, 0.192151278f},
-std::array<float,2>{0.534162581f, 0.592884839f},
-std::array<float,2>{0.233199716f, 0.0877770707f},
-std::array<float,2>{0.429445833f, 0.847932577f},
-std::array<float,2>{0.931488156f, 0.398240775f},
-std::array<float,2>{0.581750393f, 0.967434824f},
-std::array<float,2>{0.185391486f, 0.296822459f},
-std::array<float,2>{0.482843369f, 0.673648238f},
-std::array<float,2>{0.946331918f, 0.13721922f},
-std::array<float,2>{0.863575459f, 0.541699886f},
-std::array<float,2>{0.293375105f, 0.00633047102f},
-std::array<float,2>{0.0443498567f, 0.78748858f},
-std::array<float,2>{0.637272656f, 0.495579988f},
-std::array<float,2>{0.900600076f, 0.842591524f},
-std::array<float,2>{0.377997369f, 0.422985226f},
-std::array<float,2>{0.204575717f, 0.605541825f},
-std::array<float,2>{0.512159705f, 0.0938049033f},
-std::array<float,2>{0.695048809f, 0.702315331f},
-std::array<float,2>{0.117809474f, 0.228435412f},
-std::array<float,2>{0.359666616f, 0.929351091f},
-std::array<float,2>{0.787939906f, 0.337633759f},
-std::array<float,2>{0.52022773f, 0.869318724f},
-std::array<float,2>{0.199521452f, 0.388748497f},
-std::array<float,2>{0.398302048f, 0.568096161f},
-std::array<float,2>{0.881496966f, 0.0644874051f},
-std::array<float,2>{0.810733259f, 0.744605601f},
-std::array<float,2>{0.358191729f, 0.212862954f},
-std::array<float,2>{0.101142541f, 0.888815343f},
-std::array<float,2>{0.711420298f, 0.35988456f},
-std::array<float,2>{0.962944627f, 0.990622938f},
-std::array<float,2>{0.494788826f, 0.278762937f},
-std::array<float,2>{0.159171984f, 0.64433825f},
-std::array<float,2>{0.566489518f, 0.159387305f},
-std::array<float,2>{0.641060054f, 0.505862772f},
-std::array<float,2>{0.0550639145f, 0.0390180238f},
-std::array<float,2>{0.311455816f, 0.759867191f},
-std::array<float,2>{0.848405123f, 0.453852385f},
-std::array<float,2>{0.724900961f, 0.912429392f},
-std::array<float,2>{0.0914579257f, 0.328122228f},
-std::array<float,2>{0.317051858f, 0.717532635f},
-std::array<float,2>{0.773600042f, 0.238887489f},
-std::array<float,2>{0.908460438f, 0.614125431f},
-std::array<float,2>{0.4080621f, 0.118086144f},
-std::array<float,2>{0.248980105f, 0.813098192f},
-std::array<float,2>{0.55066067f, 0.420169622f},
-std::array<float,2>{0.833592117f, 0.802470982f},
-std::array<float,2>{0.276410788f, 0.484182209f},
-std::array<float,2>{0.00131822575f, 0.555153966f},
-std::array<float,2>{0.670031726f, 0.0289566349f},
-std::array<float,2>{0.61030364f, 0.66420275f},
-std::array<float,2>{0.146974981f, 0.141661584f},
-std::array<float,2>{0.45608449f, 0.943044603f},
-std::array<float,2>{0.988978803f, 0.297791034f},
-std::array<float,2>{0.650032043f, 0.844603121f},
-std::array<float,2>{0.0507608019f, 0.394432932f},
-std::array<float,2>{0.299815506f, 0.589069724f},
-std::array<float,2>{0.858678043f, 0.0923447534f},
-std::array<float,2>{0.958586633f, 0.73009485f},
-std::array<float,2>{0.484465003f, 0.190780133f},
-std::array<float,2>{0.171463087f, 0.89779973f},
-std::array<float,2>{0.57746011f, 0.353045821f},
-std::array<float,2>{0.798484743f, 0.972010016f},
-std::array<float,2>{0.343813002f, 0.25274083f},
-std::array<float,2>{0.103443019f, 0.639541805f},
-std::array<float,2>{0.709574223f, 0.173098639f},
-std::array<float,2>{0.526046574f, 0.526148438f},
-std::array<float,2>{0.19355619f, 0.0586925186f},
-std::array<float,2>{0.398684323f, 0.773393095f},
-std::array<float,2>{0.887142479f, 0.447484106f},
-std::array<float,2>{0.624088049f, 0.925140619f},
-std::array<float,2>{0.155828163f, 0.343663961f},
-std::array<float,2>{0.467882752f, 0.695889294f},
-std::array<float,2>{0.994076014f, 0.232111827f},
-std::array<float,2>{0.843705654f, 0.602807045f},
-std::array<float,2>{0.269851118f, 0.101319119f},
-std::array<float,2>{0.00825123489f, 0.839835525f},
-std::array<float,2>{0.662897944f, 0.429228365f},
-std::array<float,2>{0.918610454f, 0.783709705f},
-std::array<float,2>{0.418200552f, 0.498439431f},
-std::array<float,2>{0.240838662f, 0.546560466f},
-std::array<float,2>{0.556934714f, 0.00259256782f},
-std::array<float,2>{0.732520044f, 0.676056921f},
-std::array<float,2>{0.081398502f, 0.135213658f},
-std::array<float,2>{0.325450718f, 0.961491585f},
-std::array<float,2>{0.771698952f, 0.289971113f},
-std::array<float,2>{0.545420229f, 0.761761129f},
-std::array<float,2>{0.22545591f, 0.460490525f},
-std::array<float,2>{0.433084756f, 0.500683546f},
-std::array<float,2>{0.925764978f, 0.0316193067f},
-std::array<float,2>{0.75252682f, 0.646786988f},
-std::array<float,2>{0.332634002f, 0.163855538f},
-std::array<float,2>{0.0710338503f, 0.987588048f},
-std::array<float,2>{0.739379227f, 0.273990005f},
-std::array<float,2>{0.978625834f, 0.884133697f},
-std::array<float,2>{0.437965721f, 0.364360452f},
-std::array<float,2>{0.129564658f, 0.748308778f},
-std::array<float,2>{0.594390333f, 0.217518017f},
-std::array<float,2>{0.678462088f, 0.564924359f},
-std::array<float,2>{0.0168026388f, 0.0670922399f},
-std::array<float,2>{0.252489626f, 0.873411298f},
-std::array<float,2>{0.82438606f, 0.382967085f},
-std::array<float,2>{0.699383974f, 0.938809335f},
-std::array<float,2>{0.115633741f, 0.301187366f},
-std::array<float,2>{0.367956161f, 0.671503007f},
-std::array<float,2>{0.790073693f, 0.145895705f},
-std::array<float,2>{0.894447565f, 0.559420466f},
-std::array<float,2>{0.38938123f, 0.0239376612f},
-std::array<float,2>{0.216523424f, 0.800403118f},
-std::array<float,2>{0.501048863f, 0.476762533f},
-std::array<float,2>{0.871569097f, 0.816654384f},
-std::array<float,2>{0.28887856f, 0.415476441f},
-std::array<float,2>{0.0370023735f, 0.613016963f},
-std::array<float,2>{0.628929257f, 0.122484811f},
-std::array<float,2>{0.586308897f, 0.711729705f},
-std::array<float,2>{0.178866237f, 0.235632777f},
-std::array<float,2>{0.469337732f, 0.90961045f},
-std::array<float,2>{0.937614322f, 0.321393788f},
-std::array<float,2>{0.744889259f, 0.80624181f},
-std::array<float,2>{0.0648484454f, 0.469453543f},
-std::array<float,2>{0.342844129f, 0.548600078f},
-std::array<float,2>{0.762369573f, 0.0176140033f},
-std::array<float,2>{0.93405807f, 0.65743947f},
-std::array<float,2>{0.421930522f, 0.152761891f},
-std::array<float,2>{0.229110464f, 0.949625134f},
-std::array<float,2>{0.537429512f, 0.309759289f},
-std::array<float,2>{0.818377376f, 0.921693146f},
-std::array<float,2>{0.264643162f, 0.317121327f},
-std::array<float,2>{0.0262720715f, 0.706244886f},
-std::array<float,2>{0.681523383f, 0.244079798f},
-std::array<float,2>{0.601946592f, 0.619256854f},
-std::array<float,2>{0.136747599f, 0.111535259f},
-std::array<float,2>{0.452675581f, 0.826847196f},
-std::array<float,2>{0.97474581f, 0.409232378f},
-std::array<float,2>{0.510955155f, 0.992978036f},
-std::array<float,2>{0.210689023f, 0.271460742f},
-std::array<float,2>{0.379150808f, 0.65163523f},
-std::array<float,2>{0.905270278f, 0.169585064f},
-std::array<float,2>{0.783904791f, 0.514351964f},
-std::array<float,2>{0.364257008f, 0.0424689911f},
-std::array<float,2>{0.123999156f, 0.754780948f},
-std::array<float,2>{0.689656556f, 0.463114172f},
-std::array<float,2>{0.949867904f, 0.865049362f},
-std::array<float,2>{0.480100662f, 0.377656639f},
-std::array<float,2>{0.180201337f, 0.570452929f},
-std::array<float,2>{0.582490206f, 0.0722033754f},
-std::array<float,2>{0.635541856f, 0.738872766f},
-std::array<float,2>{0.041236341f, 0.205587f},
-std::array<float,2>{0.289198875f, 0.880564332f},
-std::array<float,2>{0.862882197f, 0.372387171f},
-std::array<float,2>{0.566127181f, 0.833813667f},
-std::array<float,2>{0.163954958f, 0.436510772f},
-std::array<float,2>{0.496526361f, 0.598805785f},
-std::array<float,2>{0.966634572f, 0.102888629f},
-std::array<float,2>{0.84377718f, 0.690136552f},
-std::array<float,2>{0.306568891f, 0.219912037f},
-std::array<float,2>{0.0623632222f, 0.931129456f},
-std::array<float,2>{0.647750616f, 0.328307509f},
-std::array<float,2>{0.877413034f, 0.960403621f},
-std::array<float,2>{0.392909497f, 0.288024276f},
-std::array<float,2>{0.198749125f, 0.687103093f},
-std::array<float,2>{0.517719269f, 0.129125893f},
-std::array<float,2>{0.715173304f, 0.532149613f},
-std::array<float,2>{0.0946038812f, 0.00916454103f},
-std::array<float,2>{0.354107052f, 0.790154338f},
-std::array<float,2>{0.807805717f, 0.487835526f},
-std::array<float,2>{0.664093852f, 0.904795766f},
-std::array<float,2>{0.00626684306f, 0.351270586f},
-std::array<float,2>{0.279708773f, 0.725236893f},
-std::array<float,2>{0.829424441f, 0.200146407f},
-std::array<float,2>{0.984631062f, 0.580286086f},
-std::array<float,2>{0.45840475f, 0.0824761018f},
-std::array<float,2>{0.141939804f, 0.858694375f},
-std::array<float,2>{0.614955068f, 0.401151091f},
-std::array<float,2>{0.78032583f, 0.779272676f},
-std::array<float,2>{0.313866138f, 0.44473511f},
-std::array<float,2>{0.0869971514f, 0.521340728f},
-std::array<float,2>{0.718958378f, 0.0473619252f},
-std::array<float,2>{0.554585874f, 0.625180006f},
-std::array<float,2>{0.243331432f, 0.185860977f},
-std::array<float,2>{0.410466552f, 0.983225524f},
-std::array<float,2>{0.911693513f, 0.261488885f},
-std::array<float,2>{0.698822618f, 0.855439603f},
-std::array<float,2>{0.112826549f, 0.404017329f},
-std::array<float,2>{0.373425186f, 0.582310498f},
-std::array<float,2>{0.796368599f, 0.0793509036f},
-std::array<float,2>{0.898261309f, 0.719079733f},
-std::array<float,2>{0.384255826f, 0.198221698f},
-std::array<float,2>{0.212003678f, 0.901030481f},
-std::array<float,2>{0.506451726f, 0.345201015f},
-std::array<float,2>{0.870896995f, 0.977484822f},
-std::array<float,2>{0.284053594f, 0.264171422f},
-std::array<float,2>{0.0337206461f, 0.631516874f},
-std::array<float,2>{0.62774086f, 0.180070966f},
-std::array<float,2>{0.592080951f, 0.516964436f},
-std::array<float,2>{0.175744802f, 0.0535875037f},
-std::array<float,2>{0.474471211f, 0.774745226f},
-std::array<float,2>{0.94456017f, 0.438993156f},
-std::array<float,2>{0.542081296f, 0.937143028f},
-std::array<float,2>{0.222266823f, 0.332165062f},
-std::array<float,2>{0.437006652f, 0.693516552f},
-std::array<float,2>{0.929643393f, 0.225316674f},
-std::array<float,2>{0.756750882f, 0.595388889f},
-std::array<float,2>{0.331370294f, 0.10670311f},
-std::array<float,2>{0.0773669407f, 0.828430057f},
-std::array<float,2>{0.738012552f, 0.431607723f},
-std::array<float,2>{0.982868373f, 0.794342399f},
-std::array<float,2>{0.444831133f, 0.488384843f},
-std::array<float,2>{0.126747027f, 0.538486302f},
-std::array<float,2>{0.597947896f, 0.0133635206f},
-std::array<float,2>{0.672704518f, 0.681453109f},
-std::array<float,2>{0.022045007f, 0.126983285f},
-std::array<float,2>{0.254431427f, 0.95320648f},
-std::array<float,2>{0.821285963f, 0.282991797f},
-std::array<float,2>{0.617205024f, 0.752381086f},
-std::array<float,2>{0.149977908f, 0.466017365f},
-std::array<float,2>{0.461716443f, 0.509271145f},
-std::array<float,2>{0.997071683f, 0.0438773297f},
-std::array<float,2>{0.83734864f, 0.654285789f},
-std::array<float,2>{0.26575309f, 0.165551871f},
-std::array<float,2>{0.0118063763f, 0.996578276f},
-std::array<float,2>{0.658126056f, 0.268656939f},
-std::array<float,2>{0.915706694f, 0.875242949f},
-std::array<float,2>{0.414215267f, 0.369787484f},
-std::array<float,2>{0.237603605f, 0.737826169f},
-std::array<float,2>{0.559285581f, 0.208104625f},
-std::array<float,2>{0.730319381f, 0.576751053f},
-std::array<float,2>{0.0823702291f, 0.0752918348f},
-std::array<float,2>{0.321273118f, 0.86134994f},
-std::array<float,2>{0.768275321f, 0.38094002f},
-std::array<float,2>{0.653965831f, 0.948253214f},
-std::array<float,2>{0.051196605f, 0.306082249f},
-std::array<float,2>{0.301087141f, 0.663915932f},
-std::array<float,2>{0.852000535f, 0.151258647f},
-std::array<float,2>{0.953403473f, 0.551831424f},
-std::array<float,2>{0.488374949f, 0.0229495168f},
-std::array<float,2>{0.16559574f, 0.810012758f},
-std::array<float,2>{0.572945476f, 0.475913852f},
-std::array<float,2>{0.804028988f, 0.823860168f},
-std::array<float,2>{0.349423409f, 0.412229449f},
-std::array<float,2>{0.106302872f, 0.622349918f},
-std::array<float,2>{0.70356077f, 0.113549799f},
-std::array<float,2>{0.528630793f, 0.709059656f},
-std::array<float,2>{0.189547226f, 0.246619284f},
-std::array<float,2>{0.405301899f, 0.917849958f},
-std::array<float,2>{0.886044383f, 0.314784974f},
-std::array<float,2>{0.671810985f, 0.802754402f},
-std::array<float,2>{0.000324942375f, 0.480655134f},
-std::array<float,2>{0.275433302f, 0.558547258f},
-std::array<float,2>{0.832147956f, 0.0295557026f},
-std::array<float,2>{0.990077853f, 0.667674065f},
-std::array<float,2>{0.455541342f, 0.144068256f},
-std::array<float,2>{0.148355037f, 0.943685353f},
-std::array<float,2>{0.61072892f, 0.300177902f},
-std::array<float,2>{0.775352538f, 0.910766304f},
-std::array<float,2>{0.317666292f, 0.325174749f},
-std::array<float,2>{0.0907703862f, 0.71508491f},
-std::array<float,2>{0.726389289f, 0.240557596f},
-std::array<float,2>{0.549381196f, 0.615948081f},
-std::array<float,2>{0.249265879f, 0.1209976f},
-std::array<float,2>{0.406925678f, 0.815087914f},
-std::array<float,2>{0.909626901f, 0.419297397f},
-std::array<float,2>{0.568108439f, 0.990037799f},
-std::array<float,2>{0.159233466f, 0.27977249f},
-std::array<float,2>{0.495550662f, 0.64095217f},
-std::array<float,2>{0.964821398f, 0.15749675f},
-std::array<float,2>{0.848857522f, 0.504433215f},
-std::array<float,2>{0.311655641f, 0.0367011875f},
-std::array<float,2>{0.0557394922f, 0.757901788f},
-std::array<float,2>{0.641762972f, 0.455182016f},
-std::array<float,2>{0.882533133f, 0.867547512f},
-std::array<float,2>{0.397032857f, 0.388600945f},
-std::array<float,2>{0.200449064f, 0.570305526f},
-std::array<float,2>{0.520729005f, 0.0633825287f},
-std::array<float,2>{0.712483466f, 0.743906856f},
-std::array<float,2>{0.100227118f, 0.213981256f},
-std::array<float,2>{0.359145969f, 0.88787514f},
-std::array<float,2>{0.812224746f, 0.361484855f},
-std::array<float,2>{0.51302743f, 0.841694891f},
-std::array<float,2>{0.203745276f, 0.425081193f},
-std::array<float,2>{0.377342939f, 0.608909786f},
-std::array<float,2>{0.902070105f, 0.0970447883f},
-std::array<float,2>{0.788813174f, 0.700754642f},
-std::array<float,2>{0.361021012f, 0.229857177f},
-std::array<float,2>{0.11831639f, 0.925895452f},
-std::array<float,2>{0.694250941f, 0.339665473f},
-std::array<float,2>{0.945623815f, 0.964868546f},
-std::array<float,2>{0.483894378f, 0.294244468f},
-std::array<float,2>{0.18391338f, 0.67522192f},
-std::array<float,2>{0.580870628f, 0.139468446f},
-std::array<float,2>{0.638667583f, 0.540885031f},
-std::array<float,2>{0.0431248732f, 0.00574070681f},
-std::array<float,2>{0.294899344f, 0.7857669f},
-std::array<float,2>{0.865108073f, 0.494005501f},
-std::array<float,2>{0.746537685f, 0.891416132f},
-std::array<float,2>{0.0690218881f, 0.355833918f},
-std::array<float,2>{0.337662935f, 0.733901262f},
-std::array<float,2>{0.76023823f, 0.194954067f},
-std::array<float,2>{0.930638134f, 0.590374529f},
-std::array<float,2>{0.427869916f, 0.0888712183f},
-std::array<float,2>{0.23403427f, 0.85089761f},
-std::array<float,2>{0.534320354f, 0.395347476f},
-std::array<float,2>{0.814294517f, 0.765797734f},
-std::array<float,2>{0.259614021f, 0.450032264f},
-std::array<float,2>{0.0275649019f, 0.529436409f},
-std::array<float,2>{0.684260726f, 0.0583155565f},
-std::array<float,2>{0.606545806f, 0.634873867f},
-std::array<float,2>{0.133968368f, 0.178304404f},
-std::array<float,2>{0.446266502f, 0.975507379f},
-std::array<float,2>{0.970256507f, 0.255795151f},
-std::array<float,2>{0.62989068f, 0.818643272f},
-std::array<float,2>{0.0360417515f, 0.416187584f},
-std::array<float,2>{0.287634969f, 0.609784245f},
-std::array<float,2>{0.872681797f, 0.12332917f},
-std::array<float,2>{0.939349651f, 0.713555634f},
-std::array<float,2>{0.470389485f, 0.236689016f},
-std::array<float,2>{0.178656429f, 0.906945705f},
-std::array<float,2>{0.586972058f, 0.322966784f},
-std::array<float,2>{0.789504409f, 0.940183997f},
-std::array<float,2>{0.368868381f, 0.303966552f},
-std::array<float,2>{0.116459675f, 0.66856581f},
-std::array<float,2>{0.700766146f, 0.146809205f},
-std::array<float,2>{0.500386238f, 0.561025441f},
-std::array<float,2>{0.21530138f, 0.0254315231f},
-std::array<float,2>{0.389898449f, 0.798411667f},
-std::array<float,2>{0.893381119f, 0.479794532f},
-std::array<float,2>{0.595423758f, 0.884804308f},
-std::array<float,2>{0.130336478f, 0.365626603f},
-std::array<float,2>{0.438478827f, 0.747570038f},
-std::array<float,2>{0.980083466f, 0.215603635f},
-std::array<float,2>{0.825356185f, 0.563122213f},
-std::array<float,2>{0.253829151f, 0.0699944198f},
-std::array<float,2>{0.016233284f, 0.87233448f},
-std::array<float,2>{0.679087877f, 0.385962903f},
-std::array<float,2>{0.924386859f, 0.765590191f},
-std::array<float,2>{0.431991339f, 0.457576483f},
-std::array<float,2>{0.225798368f, 0.503429234f},
-std::array<float,2>{0.545979202f, 0.0347420983f},
-std::array<float,2>{0.739149988f, 0.64548552f},
-std::array<float,2>{0.072034508f, 0.161816999f},
-std::array<float,2>{0.333664268f, 0.985356927f},
-std::array<float,2>{0.75346601f, 0.276282519f},
-std::array<float,2>{0.557866335f, 0.78239429f},
-std::array<float,2>{0.24137713f, 0.496649474f},
-std::array<float,2>{0.419146657f, 0.543229222f},
-std::array<float,2>{0.919702291f, 0.00177309546f},
-std::array<float,2>{0.772708297f, 0.679502428f},
-std::array<float,2>{0.32429412f, 0.134658873f},
-std::array<float,2>{0.0805400461f, 0.963792562f},
-std::array<float,2>{0.733731806f, 0.291354626f},
-std::array<float,2>{0.99314636f, 0.922498107f},
-std::array<float,2>{0.467715144f, 0.341475159f},
-std::array<float,2>{0.154758155f, 0.699171305f},
-std::array<float,2>{0.623522103f, 0.232501671f},
-std::array<float,2>{0.663255751f, 0.604626238f},
-std::array<float,2>{0.00884097349f, 0.0977948681f},
-std::array<float,2>{0.27072522f, 0.83692199f},
-std::array<float,2>{0.842006445f, 0.426999807f},
-std::array<float,2>{0.710516632f, 0.968955159f},
-std::array<float,2>{0.102434337f, 0.250677973f},
-std::array<float,2>{0.345521659f, 0.637080252f},
-std::array<float,2>{0.797042489f, 0.17491813f},
-std::array<float,2>{0.888148248f, 0.525073946f},
-std::array<float,2>{0.400380343f, 0.060861554f},
-std::array<float,2>{0.194789588f, 0.771382928f},
-std::array<float,2>{0.526408494f, 0.446370363f},
-std::array<float,2>{0.85802722f, 0.847524703f},
-std::array<float,2>{0.299457848f, 0.392510384f},
-std::array<float,2>{0.0496506765f, 0.586719394f},
-std::array<float,2>{0.649065495f, 0.089913711f},
-std::array<float,2>{0.576707482f, 0.727735519f},
-std::array<float,2>{0.170347735f, 0.187941596f},
-std::array<float,2>{0.485352248f, 0.895252168f},
-std::array<float,2>{0.95778811f, 0.354337424f},
-std::array<float,2>{0.719847798f, 0.77937001f},
-std::array<float,2>{0.0861710086f, 0.442285269f},
-std::array<float,2>{0.313201696f, 0.521580279f},
-std::array<float,2>{0.780064166f, 0.0497566275f},
-std::array<float,2>{0.910844743f, 0.627288282f},
-std::array<float,2>{0.411399275f, 0.185315177f},
-std::array<float,2>{0.242596239f, 0.980662346f},
-std::array<float,2>{0.553151608f, 0.258133054f},
-std::array<float,2>{0.828270853f, 0.902623236f},
-std::array<float,2>{0.280664235f, 0.34925133f},
-std::array<float,2>{0.00727817137f, 0.723566592f},
-std::array<float,2>{0.665762722f, 0.20157975f},
-std::array<float,2>{0.613964379f, 0.579256237f},
-std::array<float,2>{0.141306713f, 0.0849299207f},
-std::array<float,2>{0.457676858f, 0.85725832f},
-std::array<float,2>{0.985355198f, 0.398623884f},
-std::array<float,2>{0.518989205f, 0.958584249f},
-std::array<float,2>{0.197793677f, 0.285363853f},
-std::array<float,2>{0.394154549f, 0.684025943f},
-std::array<float,2>{0.878128946f, 0.131867319f},
-std::array<float,2>{0.806655049f, 0.53441f},
-std::array<float,2>{0.354551047f, 0.0100483326f},
-std::array<float,2>{0.0953438804f, 0.79242152f},
-std::array<float,2>{0.716145277f, 0.485528022f},
-std::array<float,2>{0.965189099f, 0.835472107f},
-std::array<float,2>{0.497446209f, 0.434669703f},
-std::array<float,2>{0.162336528f, 0.601232231f},
-std::array<float,2>{0.56505543f, 0.105192825f},
-std::array<float,2>{0.647334158f, 0.688341916f},
-std::array<float,2>{0.0607104264f, 0.221406564f},
-std::array<float,2>{0.305438399f, 0.931773245f},
-std::array<float,2>{0.844970405f, 0.331243634f},
-std::array<float,2>{0.583398223f, 0.866898656f},
-std::array<float,2>{0.181118026f, 0.375493854f},
-std::array<float,2>{0.47892803f, 0.573526502f},
-std::array<float,2>{0.950202167f, 0.0738686249f},
-std::array<float,2>{0.861735344f, 0.740847826f},
-std::array<float,2>{0.290492207f, 0.203245386f},
-std::array<float,2>{0.0421870872f, 0.880881131f},
-std::array<float,2>{0.636683464f, 0.373454213f},
-std::array<float,2>{0.905726016f, 0.994517565f},
-std::array<float,2>{0.38058126f, 0.272478729f},
-std::array<float,2>{0.209786102f, 0.648825526f},
-std::array<float,2>{0.51050818f, 0.170301959f},
-std::array<float,2>{0.690633357f, 0.511753142f},
-std::array<float,2>{0.124420531f, 0.0402318239f},
-std::array<float,2>{0.36497888f, 0.757564187f},
-std::array<float,2>{0.785059452f, 0.462824404f},
-std::array<float,2>{0.679955184f, 0.918120623f},
-std::array<float,2>{0.0268565919f, 0.319140762f},
-std::array<float,2>{0.265161008f, 0.703166068f},
-std::array<float,2>{0.819427133f, 0.244533956f},
-std::array<float,2>{0.976559997f, 0.618101776f},
-std::array<float,2>{0.451815397f, 0.110600866f},
-std::array<float,2>{0.13776283f, 0.824376881f},
-std::array<float,2>{0.602990806f, 0.407213658f},
-std::array<float,2>{0.762914777f, 0.808302939f},
-std::array<float,2>{0.341947049f, 0.47259593f},
-std::array<float,2>{0.066258058f, 0.550240934f},
-std::array<float,2>{0.74530673f, 0.0174644738f},
-std::array<float,2>{0.538255632f, 0.659530401f},
-std::array<float,2>{0.229889542f, 0.155200422f},
-std::array<float,2>{0.423738211f, 0.951553583f},
-std::array<float,2>{0.935133874f, 0.31156233f},
-std::array<float,2>{0.735863268f, 0.831193566f},
-std::array<float,2>{0.0758459121f, 0.431905895f},
-std::array<float,2>{0.329015851f, 0.597039819f},
-std::array<float,2>{0.754553378f, 0.107782215f},
-std::array<float,2>{0.926744819f, 0.693079412f},
-std::array<float,2>{0.435357392f, 0.224122137f},
-std::array<float,2>{0.219441816f, 0.934031606f},
-std::array<float,2>{0.539372861f, 0.334001988f},
-std::array<float,2>{0.823289752f, 0.956479549f},
-std::array<float,2>{0.257565051f, 0.285024136f},
-std::array<float,2>{0.0197327752f, 0.683550298f},
-std::array<float,2>{0.674245298f, 0.125283614f},
-std::array<float,2>{0.600932777f, 0.535428047f},
-std::array<float,2>{0.128905252f, 0.0141340215f},
-std::array<float,2>{0.443190664f, 0.796661973f},
-std::array<float,2>{0.981843054f, 0.490259707f},
-std::array<float,2>{0.50458777f, 0.899196625f},
-std::array<float,2>{0.213149697f, 0.346307904f},
-std::array<float,2>{0.386377752f, 0.721102476f},
-std::array<float,2>{0.89482975f, 0.196197882f},
-std::array<float,2>{0.794700563f, 0.585934162f},
-std::array<float,2>{0.372597873f, 0.0819742456f},
-std::array<float,2>{0.109387711f, 0.85239768f},
-std::array<float,2>{0.695345521f, 0.406169027f},
-std::array<float,2>{0.942478299f, 0.77595067f},
-std::array<float,2>{0.475205034f, 0.441301733f},
-std::array<float,2>{0.171994612f, 0.518014789f},
-std::array<float,2>{0.59001708f, 0.0524477698f},
-std::array<float,2>{0.626856089f, 0.628923416f},
-std::array<float,2>{0.0313238986f, 0.182594404f},
-std::array<float,2>{0.281368256f, 0.980351925f},
-std::array<float,2>{0.868547022f, 0.26324749f},
-std::array<float,2>{0.571020126f, 0.811553359f},
-std::array<float,2>{0.166253433f, 0.474153996f},
-std::array<float,2>{0.490592688f, 0.553634226f},
-std::array<float,2>{0.956486046f, 0.0197319183f},
-std::array<float,2>{0.853859842f, 0.660611093f},
-std::array<float,2>{0.303567916f, 0.149151847f},
-std::array<float,2>{0.052893199f, 0.945704222f},
-std::array<float,2>{0.654896975f, 0.306663603f},
-std::array<float,2>{0.883392513f, 0.914215505f},
-std::array<float,2>{0.402892679f, 0.313822657f},
-std::array<float,2>{0.188957095f, 0.707662225f},
-std::array<float,2>{0.529964983f, 0.248674124f},
-std::array<float,2>{0.706904292f, 0.624295413f},
-std::array<float,2>{0.108569883f, 0.115930229f},
-std::array<float,2>{0.350860834f, 0.820774198f},
-std::array<float,2>{0.80079037f, 0.412016273f},
-std::array<float,2>{0.660092115f, 0.998631299f},
-std::array<float,2>{0.0148015013f, 0.266563863f},
-std::array<float,2>{0.268006146f, 0.655586421f},
-std::array<float,2>{0.838451505f, 0.166590825f},
-std::array<float,2>{0.999267757f, 0.510205209f},
-std::array<float,2>{0.464642137f, 0.0460072495f},
-std::array<float,2>{0.150894091f, 0.751596689f},
-std::array<float,2>{0.619357765f, 0.467675239f},
-std::array<float,2>{0.767459333f, 0.86100322f},
-std::array<float,2>{0.322399199f, 0.380373627f},
-std::array<float,2>{0.0849865377f, 0.575160325f},
-std::array<float,2>{0.728461087f, 0.0772160441f},
-std::array<float,2>{0.562140167f, 0.734924793f},
-std::array<float,2>{0.234449476f, 0.210123643f},
-std::array<float,2>{0.416671246f, 0.877278805f},
-std::array<float,2>{0.916066527f, 0.367816329f},
-std::array<float,2>{0.643701136f, 0.761485636f},
-std::array<float,2>{0.058021687f, 0.454354167f},
-std::array<float,2>{0.309241623f, 0.507005632f},
-std::array<float,2>{0.850073576f, 0.0373768508f},
-std::array<float,2>{0.96165514f, 0.643189788f},
-std::array<float,2>{0.49310869f, 0.158994228f},
-std::array<float,2>{0.157030255f, 0.991807878f},
-std::array<float,2>{0.569172263f, 0.277811855f},
-std::array<float,2>{0.809203923f, 0.890315235f},
-std::array<float,2>{0.356015861f, 0.360622108f},
-std::array<float,2>{0.0994864106f, 0.745622158f},
-std::array<float,2>{0.714405775f, 0.211505473f},
-std::array<float,2>{0.522676826f, 0.566965163f},
-std::array<float,2>{0.202291355f, 0.0663254187f},
-std::array<float,2>{0.395290822f, 0.870962024f},
-std::array<float,2>{0.880809188f, 0.389860302f},
-std::array<float,2>{0.612056911f, 0.941500664f},
-std::array<float,2>{0.145439729f, 0.297920614f},
-std::array<float,2>{0.45421797f, 0.665138423f},
-std::array<float,2>{0.990254879f, 0.141281754f},
-std::array<float,2>{0.835668087f, 0.555792809f},
-std::array<float,2>{0.274484843f, 0.0282683689f},
-std::array<float,2>{0.00207395595f, 0.80111599f},
-std::array<float,2>{0.66863662f, 0.482829869f},
-std::array<float,2>{0.907947302f, 0.814382792f},
-std::array<float,2>{0.409004956f, 0.421172768f},
-std::array<float,2>{0.246508628f, 0.615028322f},
-std::array<float,2>{0.547569215f, 0.118793324f},
-std::array<float,2>{0.72319001f, 0.718550622f},
-std::array<float,2>{0.0929890275f, 0.239775151f},
-std::array<float,2>{0.319749087f, 0.913631976f},
-std::array<float,2>{0.776820958f, 0.326444656f},
-std::array<float,2>{0.531907856f, 0.84868592f},
-std::array<float,2>{0.232098177f, 0.397032142f},
-std::array<float,2>{0.427362531f, 0.591807663f},
-std::array<float,2>{0.93312186f, 0.0862998143f},
-std::array<float,2>{0.759189546f, 0.731972039f},
-std::array<float,2>{0.338680804f, 0.192783669f},
-std::array<float,2>{0.0669766814f, 0.893978715f},
-std::array<float,2>{0.749200106f, 0.357555449f},
-std::array<float,2>{0.971348643f, 0.973829627f},
-std::array<float,2>{0.449106663f, 0.256900191f},
-std::array<float,2>{0.135756299f, 0.633742809f},
-std::array<float,2>{0.608208239f, 0.176968932f},
-std::array<float,2>{0.686536968f, 0.529023349f},
-std::array<float,2>{0.0297198128f, 0.0546994992f},
-std::array<float,2>{0.261126995f, 0.769066334f},
-std::array<float,2>{0.816041231f, 0.451735646f},
-std::array<float,2>{0.69292295f, 0.92803365f},
-std::array<float,2>{0.119164988f, 0.336152345f},
-std::array<float,2>{0.362397581f, 0.701307833f},
-std::array<float,2>{0.786838889f, 0.227164388f},
-std::array<float,2>{0.899284065f, 0.606849313f},
-std::array<float,2>{0.375040829f, 0.0955601856f},
-std::array<float,2>{0.205217078f, 0.843356133f},
-std::array<float,2>{0.515022576f, 0.422067493f},
-std::array<float,2>{0.866612315f, 0.788942814f},
-std::array<float,2>{0.29552725f, 0.494389892f},
-std::array<float,2>{0.0458950922f, 0.542446315f},
-std::array<float,2>{0.638890684f, 0.00730829872f},
-std::array<float,2>{0.578162551f, 0.671993554f},
-std::array<float,2>{0.18637149f, 0.137994438f},
-std::array<float,2>{0.481644511f, 0.968167126f},
-std::array<float,2>{0.948888659f, 0.295713931f},
-std::array<float,2>{0.676992476f, 0.874327123f},
-std::array<float,2>{0.0190958157f, 0.383971959f},
-std::array<float,2>{0.251391888f, 0.565511346f},
-std::array<float,2>{0.827702224f, 0.0677656904f},
-std::array<float,2>{0.977752447f, 0.749436855f},
-std::array<float,2>{0.439491838f, 0.217967227f},
-std::array<float,2>{0.131290764f, 0.883592784f},
-std::array<float,2>{0.59685266f, 0.363725066f},
-std::array<float,2>{0.750825584f, 0.986849546f},
-std::array<float,2>{0.334643155f, 0.275200486f},
-std::array<float,2>{0.07297194f, 0.648058355f},
-std::array<float,2>{0.74089551f, 0.163044468f},
-std::array<float,2>{0.544493198f, 0.50137645f},
-std::array<float,2>{0.223974571f, 0.0327610709f},
-std::array<float,2>{0.431388259f, 0.7630229f},
-std::array<float,2>{0.922470927f, 0.459268034f},
-std::array<float,2>{0.588017702f, 0.908707619f},
-std::array<float,2>{0.176973626f, 0.320498526f},
-std::array<float,2>{0.472375244f, 0.71284467f},
-std::array<float,2>{0.940706015f, 0.234437272f},
-std::array<float,2>{0.874626458f, 0.612168074f},
-std::array<float,2>{0.286488652f, 0.121664546f},
-std::array<float,2>{0.0389809497f, 0.81820029f},
-std::array<float,2>{0.632071555f, 0.414977729f},
-std::array<float,2>{0.892375588f, 0.799449742f},
-std::array<float,2>{0.387180746f, 0.47828567f},
-std::array<float,2>{0.216991708f, 0.559737265f},
-std::array<float,2>{0.50303632f, 0.0253195781f},
-std::array<float,2>{0.70205611f, 0.670816779f},
-std::array<float,2>{0.113677539f, 0.144949332f},
-std::array<float,2>{0.370299965f, 0.93771106f},
-std::array<float,2>{0.791503012f, 0.302373141f},
-std::array<float,2>{0.523790181f, 0.772107303f},
-std::array<float,2>{0.192447782f, 0.44907704f},
-std::array<float,2>{0.401455075f, 0.527292669f},
-std::array<float,2>{0.889420331f, 0.0601064041f},
-std::array<float,2>{0.799903631f, 0.639884353f},
-std::array<float,2>{0.346263975f, 0.172537461f},
-std::array<float,2>{0.105204336f, 0.971361816f},
-std::array<float,2>{0.708570361f, 0.25306806f},
-std::array<float,2>{0.959269106f, 0.89670378f},
-std::array<float,2>{0.486482501f, 0.351699471f},
-std::array<float,2>{0.169318467f, 0.729305208f},
-std::array<float,2>{0.574227989f, 0.190008655f},
-std::array<float,2>{0.651034832f, 0.588100731f},
-std::array<float,2>{0.047832001f, 0.0933774561f},
-std::array<float,2>{0.298318028f, 0.844816804f},
-std::array<float,2>{0.8570804f, 0.393414199f},
-std::array<float,2>{0.732375085f, 0.961956322f},
-std::array<float,2>{0.0791268721f, 0.290641278f},
-std::array<float,2>{0.326756179f, 0.677228749f},
-std::array<float,2>{0.77046144f, 0.136419937f},
-std::array<float,2>{0.921183348f, 0.545535088f},
-std::array<float,2>{0.420865268f, 0.00377424853f},
-std::array<float,2>{0.24019675f, 0.784689486f},
-std::array<float,2>{0.554956198f, 0.499892473f},
-std::array<float,2>{0.841722667f, 0.838554084f},
-std::array<float,2>{0.272645235f, 0.428186834f},
-std::array<float,2>{0.00996856485f, 0.602373719f},
-std::array<float,2>{0.660914063f, 0.100493878f},
-std::array<float,2>{0.622267425f, 0.69678396f},
-std::array<float,2>{0.153272837f, 0.231071234f},
-std::array<float,2>{0.466469496f, 0.924403906f},
-std::array<float,2>{0.995506525f, 0.342289418f},
-std::array<float,2>{0.717969f, 0.789370298f},
-std::array<float,2>{0.096543029f, 0.487239867f},
-std::array<float,2>{0.352175802f, 0.532673955f},
-std::array<float,2>{0.806277573f, 0.00861823745f},
-std::array<float,2>{0.876128256f, 0.685566306f},
-std::array<float,2>{0.3908557f, 0.130589962f},
-std::array<float,2>{0.196901023f, 0.959812105f},
-std::array<float,2>{0.516608536f, 0.288652301f},
-std::array<float,2>{0.846384287f, 0.929971814f},
-std::array<float,2>{0.307804465f, 0.3295165f},
-std::array<float,2>{0.0594196729f, 0.690645695f},
-std::array<float,2>{0.64596051f, 0.219208688f},
-std::array<float,2>{0.563522696f, 0.598453939f},
-std::array<float,2>{0.161257222f, 0.101772062f},
-std::array<float,2>{0.49827525f, 0.832961977f},
-std::array<float,2>{0.968487561f, 0.437027156f},
-std::array<float,2>{0.552529693f, 0.984328032f},
-std::array<float,2>{0.245959327f, 0.259950846f},
-std::array<float,2>{0.412269831f, 0.62613219f},
-std::array<float,2>{0.91247189f, 0.186915338f},
-std::array<float,2>{0.778126895f, 0.520487964f},
-std::array<float,2>{0.315002084f, 0.0478576198f},
-std::array<float,2>{0.0881046653f, 0.777625799f},
-std::array<float,2>{0.722350419f, 0.443687856f},
-std::array<float,2>{0.988068104f, 0.857434392f},
-std::array<float,2>{0.460013062f, 0.401651949f},
-std::array<float,2>{0.144268185f, 0.581818163f},
-std::array<float,2>{0.615624666f, 0.0833853036f},
-std::array<float,2>{0.667823732f, 0.726095915f},
-std::array<float,2>{0.00524750119f, 0.200979888f},
-std::array<float,2>{0.278112054f, 0.90593785f},
-std::array<float,2>{0.831952572f, 0.350088805f},
-std::array<float,2>{0.603711426f, 0.827633619f},
-std::array<float,2>{0.14038451f, 0.408315986f},
-std::array<float,2>{0.449283719f, 0.620561659f},
-std::array<float,2>{0.9734025f, 0.11301136f},
-std::array<float,2>{0.817822039f, 0.705366433f},
-std::array<float,2>{0.262069106f, 0.242456138f},
-std::array<float,2>{0.0250268914f, 0.92067039f},
-std::array<float,2>{0.683010697f, 0.317660153f},
-std::array<float,2>{0.937381327f, 0.950842321f},
-std::array<float,2>{0.425636381f, 0.309156239f},
-std::array<float,2>{0.228048787f, 0.656349421f},
-std::array<float,2>{0.53675431f, 0.153389156f},
-std::array<float,2>{0.743399382f, 0.547546446f},
-std::array<float,2>{0.0639812276f, 0.0188676547f},
-std::array<float,2>{0.341744125f, 0.804742396f},
-std::array<float,2>{0.765201032f, 0.47045064f},
-std::array<float,2>{0.634750962f, 0.878949523f},
-std::array<float,2>{0.0405119285f, 0.371849477f},
-std::array<float,2>{0.292748779f, 0.740143061f},
-std::array<float,2>{0.860964656f, 0.20656611f},
-std::array<float,2>{0.952198088f, 0.571609437f},
-std::array<float,2>{0.478418827f, 0.0708700791f},
-std::array<float,2>{0.181750908f, 0.864067078f},
-std::array<float,2>{0.585318387f, 0.378342927f},
-std::array<float,2>{0.781628966f, 0.755233407f},
-std::array<float,2>{0.366920561f, 0.464055896f},
-std::array<float,2>{0.122085206f, 0.515239894f},
-std::array<float,2>{0.687646091f, 0.0412371345f},
-std::array<float,2>{0.509734035f, 0.651030004f},
-std::array<float,2>{0.207144022f, 0.168428943f},
-std::array<float,2>{0.380990416f, 0.993964911f},
-std::array<float,2>{0.90313822f, 0.270026803f},
-std::array<float,2>{0.749719203f, 0.851222098f},
-std::array<float,2>{0.0666207373f, 0.394728392f},
-std::array<float,2>{0.338054419f, 0.589969575f},
-std::array<float,2>{0.759556234f, 0.0895569921f},
-std::array<float,2>{0.932775736f, 0.733447015f},
-std::array<float,2>{0.427163869f, 0.194750264f},
-std::array<float,2>{0.23192513f, 0.890891552f},
-std::array<float,2>{0.531436384f, 0.356162637f},
-std::array<float,2>{0.815654993f, 0.974789143f},
-std::array<float,2>{0.261635572f, 0.255072862f},
-std::array<float,2>{0.0301910732f, 0.635607481f},
-std::array<float,2>{0.687354565f, 0.177887112f},
-std::array<float,2>{0.60744524f, 0.53021121f},
-std::array<float,2>{0.136443287f, 0.0577642284f},
-std::array<float,2>{0.448423654f, 0.766412735f},
-std::array<float,2>{0.970947206f, 0.449319124f},
-std::array<float,2>{0.515375257f, 0.926603138f},
-std::array<float,2>{0.205711529f, 0.339239568f},
-std::array<float,2>{0.375589848f, 0.700530529f},
-std::array<float,2>{0.898711205f, 0.230234817f},
-std::array<float,2>{0.786318421f, 0.60885483f},
-std::array<float,2>{0.363196611f, 0.0973215923f},
-std::array<float,2>{0.119919941f, 0.84099102f},
-std::array<float,2>{0.692465246f, 0.425756007f},
-std::array<float,2>{0.948715746f, 0.785352349f},
-std::array<float,2>{0.482379675f, 0.493316442f},
-std::array<float,2>{0.185918048f, 0.540269554f},
-std::array<float,2>{0.578986824f, 0.00516165327f},
-std::array<float,2>{0.639558315f, 0.675437927f},
-std::array<float,2>{0.0451579913f, 0.138973802f},
-std::array<float,2>{0.295081288f, 0.965742528f},
-std::array<float,2>{0.867116511f, 0.294630975f},
-std::array<float,2>{0.568762124f, 0.758758843f},
-std::array<float,2>{0.156395614f, 0.455686033f},
-std::array<float,2>{0.492403358f, 0.504274189f},
-std::array<float,2>{0.961293221f, 0.0362500101f},
-std::array<float,2>{0.850218594f, 0.641323388f},
-std::array<float,2>{0.308742136f, 0.15789403f},
-std::array<float,2>{0.0582884401f, 0.989551842f},
-std::array<float,2>{0.644492209f, 0.280154288f},
-std::array<float,2>{0.880344868f, 0.88857913f},
-std::array<float,2>{0.394671023f, 0.362235039f},
-std::array<float,2>{0.203089297f, 0.743647099f},
-std::array<float,2>{0.523147166f, 0.214783579f},
-std::array<float,2>{0.714191556f, 0.569698155f},
-std::array<float,2>{0.0989900753f, 0.0628602803f},
-std::array<float,2>{0.355537683f, 0.867891371f},
-std::array<float,2>{0.808594823f, 0.387770146f},
-std::array<float,2>{0.66834408f, 0.943890035f},
-std::array<float,2>{0.00282911072f, 0.300510108f},
-std::array<float,2>{0.275188506f, 0.667399645f},
-std::array<float,2>{0.834977925f, 0.143700376f},
-std::array<float,2>{0.990798235f, 0.557899356f},
-std::array<float,2>{0.454749882f, 0.0299076568f},
-std::array<float,2>{0.144795537f, 0.803460062f},
-std::array<float,2>{0.611389697f, 0.48108986f},
-std::array<float,2>{0.77727139f, 0.814697266f},
-std::array<float,2>{0.319958746f, 0.419741452f},
-std::array<float,2>{0.0935427025f, 0.615519762f},
-std::array<float,2>{0.722857177f, 0.120466448f},
-std::array<float,2>{0.547290027f, 0.715487599f},
-std::array<float,2>{0.246960893f, 0.240772203f},
-std::array<float,2>{0.408591539f, 0.910618067f},
-std::array<float,2>{0.907349169f, 0.324325949f},
-std::array<float,2>{0.654631495f, 0.810213685f},
-std::array<float,2>{0.0534324273f, 0.476516038f},
-std::array<float,2>{0.302799076f, 0.552533984f},
-std::array<float,2>{0.854077518f, 0.0226263069f},
-std::array<float,2>{0.956701636f, 0.663340986f},
-std::array<float,2>{0.491017669f, 0.150681272f},
-std::array<float,2>{0.16678305f, 0.948736608f},
-std::array<float,2>{0.570603967f, 0.306199312f},
-std::array<float,2>{0.801314712f, 0.917110085f},
-std::array<float,2>{0.351160437f, 0.315229177f},
-std::array<float,2>{0.10894832f, 0.709937513f},
-std::array<float,2>{0.706064582f, 0.246408224f},
-std::array<float,2>{0.529560924f, 0.622991145f},
-std::array<float,2>{0.189066559f, 0.11423748f},
-std::array<float,2>{0.402717501f, 0.823428094f},
-std::array<float,2>{0.882924199f, 0.412721395f},
-std::array<float,2>{0.620071054f, 0.996750951f},
-std::array<float,2>{0.150448233f, 0.269428015f},
-std::array<float,2>{0.464100987f, 0.653752089f},
-std::array<float,2>{0.999906182f, 0.165511474f},
-std::array<float,2>{0.838021517f, 0.509445846f},
-std::array<float,2>{0.268355638f, 0.0434187688f},
-std::array<float,2>{0.0152651677f, 0.75273174f},
-std::array<float,2>{0.659393609f, 0.466567218f},
-std::array<float,2>{0.91661638f, 0.862190485f},
-std::array<float,2>{0.416266173f, 0.381609261f},
-std::array<float,2>{0.234940782f, 0.576420426f},
-std::array<float,2>{0.561819613f, 0.0757879913f},
-std::array<float,2>{0.727912545f, 0.737567902f},
-std::array<float,2>{0.0858198032f, 0.208537221f},
-std::array<float,2>{0.322835654f, 0.875693738f},
-std::array<float,2>{0.766788363f, 0.369244337f},
-std::array<float,2>{0.539629877f, 0.829064667f},
-std::array<float,2>{0.21876727f, 0.430896848f},
-std::array<float,2>{0.434592605f, 0.595189273f},
-std::array<float,2>{0.926078379f, 0.107184753f},
-std::array<float,2>{0.754309177f, 0.694047809f},
-std::array<float,2>{0.328342676f, 0.224845663f},
-std::array<float,2>{0.0754231513f, 0.93690145f},
-std::array<float,2>{0.735570133f, 0.33277607f},
-std::array<float,2>{0.982077122f, 0.954040587f},
-std::array<float,2>{0.44247961f, 0.282518923f},
-std::array<float,2>{0.127971515f, 0.681090355f},
-std::array<float,2>{0.601362586f, 0.127496421f},
-std::array<float,2>{0.674800992f, 0.538663924f},
-std::array<float,2>{0.0203146804f, 0.0131235532f},
-std::array<float,2>{0.256940126f, 0.794728577f},
-std::array<float,2>{0.824122071f, 0.48895815f},
-std::array<float,2>{0.696114182f, 0.900844336f},
-std::array<float,2>{0.110302769f, 0.345441312f},
-std::array<float,2>{0.3720752f, 0.719703794f},
-std::array<float,2>{0.794060886f, 0.197603837f},
-std::array<float,2>{0.895184755f, 0.58263433f},
-std::array<float,2>{0.385981083f, 0.0798597857f},
-std::array<float,2>{0.21385403f, 0.854574382f},
-std::array<float,2>{0.504125953f, 0.40338546f},
-std::array<float,2>{0.868725181f, 0.775194287f},
-std::array<float,2>{0.282093555f, 0.438961715f},
-std::array<float,2>{0.0322029479f, 0.517107427f},
-std::array<float,2>{0.625993073f, 0.0529745072f},
-std::array<float,2>{0.590384781f, 0.630929589f},
-std::array<float,2>{0.172394231f, 0.180297703f},
-std::array<float,2>{0.474792451f, 0.976776361f},
-std::array<float,2>{0.942889094f, 0.264079064f},
-std::array<float,2>{0.683302581f, 0.824973762f},
-std::array<float,2>{0.0245383941f, 0.406401426f},
-std::array<float,2>{0.262328416f, 0.61751622f},
-std::array<float,2>{0.818203568f, 0.111059196f},
-std::array<float,2>{0.972716212f, 0.703920841f},
-std::array<float,2>{0.449747056f, 0.244723931f},
-std::array<float,2>{0.14004983f, 0.918704152f},
-std::array<float,2>{0.604366124f, 0.318380535f},
-std::array<float,2>{0.764654756f, 0.951722264f},
-std::array<float,2>{0.341296822f, 0.312115997f},
-std::array<float,2>{0.0637619123f, 0.660069406f},
-std::array<float,2>{0.743672729f, 0.154571176f},
-std::array<float,2>{0.536396027f, 0.550659239f},
-std::array<float,2>{0.22791861f, 0.0167052075f},
-std::array<float,2>{0.424965173f, 0.807938397f},
-std::array<float,2>{0.93678695f, 0.471755743f},
-std::array<float,2>{0.585702538f, 0.88141644f},
-std::array<float,2>{0.182578295f, 0.373696953f},
-std::array<float,2>{0.477594823f, 0.740345955f},
-std::array<float,2>{0.952809274f, 0.203910455f},
-std::array<float,2>{0.860513508f, 0.574175358f},
-std::array<float,2>{0.292125463f, 0.0735430196f},
-std::array<float,2>{0.0406400003f, 0.866671741f},
-std::array<float,2>{0.633949339f, 0.375217915f},
-std::array<float,2>{0.902480006f, 0.757229447f},
-std::array<float,2>{0.381426215f, 0.462259889f},
-std::array<float,2>{0.207621083f, 0.512282491f},
-std::array<float,2>{0.509271801f, 0.0405611172f},
-std::array<float,2>{0.68809104f, 0.648975551f},
-std::array<float,2>{0.122742712f, 0.170648769f},
-std::array<float,2>{0.36667639f, 0.994903922f},
-std::array<float,2>{0.781764209f, 0.273354709f},
-std::array<float,2>{0.517426133f, 0.792777061f},
-std::array<float,2>{0.196529299f, 0.486178935f},
-std::array<float,2>{0.391348273f, 0.534955621f},
-std::array<float,2>{0.876951039f, 0.0105849421f},
-std::array<float,2>{0.806038439f, 0.684525967f},
-std::array<float,2>{0.351701945f, 0.132718608f},
-std::array<float,2>{0.0961674079f, 0.958159745f},
-std::array<float,2>{0.718266368f, 0.285653323f},
-std::array<float,2>{0.967901707f, 0.932599664f},
-std::array<float,2>{0.498753935f, 0.331905842f},
-std::array<float,2>{0.161782265f, 0.687880039f},
-std::array<float,2>{0.564110398f, 0.220806301f},
-std::array<float,2>{0.646376252f, 0.600768864f},
-std::array<float,2>{0.059009023f, 0.10468474f},
-std::array<float,2>{0.308408499f, 0.835058928f},
-std::array<float,2>{0.845990539f, 0.435184032f},
-std::array<float,2>{0.721818447f, 0.980965674f},
-std::array<float,2>{0.0887009054f, 0.258656681f},
-std::array<float,2>{0.314727038f, 0.627580941f},
-std::array<float,2>{0.777493834f, 0.184830636f},
-std::array<float,2>{0.912942588f, 0.522062361f},
-std::array<float,2>{0.412670523f, 0.0491231158f},
-std::array<float,2>{0.245484367f, 0.780221283f},
-std::array<float,2>{0.552078724f, 0.441889226f},
-std::array<float,2>{0.83118397f, 0.856808305f},
-std::array<float,2>{0.277406037f, 0.398939043f},
-std::array<float,2>{0.00554368924f, 0.580048978f},
-std::array<float,2>{0.667207479f, 0.0840893909f},
-std::array<float,2>{0.616153717f, 0.722729445f},
-std::array<float,2>{0.143861428f, 0.201845959f},
-std::array<float,2>{0.460460812f, 0.903064787f},
-std::array<float,2>{0.987594128f, 0.348725945f},
-std::array<float,2>{0.708181679f, 0.770703673f},
-std::array<float,2>{0.104962207f, 0.446851611f},
-std::array<float,2>{0.345790863f, 0.524799764f},
-std::array<float,2>{0.800603569f, 0.0611510724f},
-std::array<float,2>{0.888831198f, 0.637418091f},
-std::array<float,2>{0.402339488f, 0.175327182f},
-std::array<float,2>{0.192913696f, 0.969710767f},
-std::array<float,2>{0.52422595f, 0.250270754f},
-std::array<float,2>{0.85682559f, 0.894970775f},
-std::array<float,2>{0.298576355f, 0.353613555f},
-std::array<float,2>{0.046964474f, 0.728108108f},
-std::array<float,2>{0.650502026f, 0.188415796f},
-std::array<float,2>{0.575072408f, 0.586373091f},
-std::array<float,2>{0.169528335f, 0.0907322243f},
-std::array<float,2>{0.48726508f, 0.847136438f},
-std::array<float,2>{0.959614217f, 0.391880155f},
-std::array<float,2>{0.555642664f, 0.963007212f},
-std::array<float,2>{0.239631176f, 0.291871607f},
-std::array<float,2>{0.420407921f, 0.678777814f},
-std::array<float,2>{0.921461165f, 0.13420926f},
-std::array<float,2>{0.769817948f, 0.543469727f},
-std::array<float,2>{0.326616257f, 0.00142118672f},
-std::array<float,2>{0.0796380714f, 0.782996595f},
-std::array<float,2>{0.731633186f, 0.496096641f},
-std::array<float,2>{0.996037602f, 0.837646365f},
-std::array<float,2>{0.466170967f, 0.427625388f},
-std::array<float,2>{0.152359053f, 0.605338216f},
-std::array<float,2>{0.622989714f, 0.0985027328f},
-std::array<float,2>{0.660518587f, 0.698638141f},
-std::array<float,2>{0.010534049f, 0.23317422f},
-std::array<float,2>{0.2733531f, 0.922105968f},
-std::array<float,2>{0.841134787f, 0.341178626f},
-std::array<float,2>{0.597628951f, 0.872821867f},
-std::array<float,2>{0.131750137f, 0.386673689f},
-std::array<float,2>{0.4402982f, 0.562629998f},
-std::array<float,2>{0.978212774f, 0.0697892904f},
-std::array<float,2>{0.827264309f, 0.747555733f},
-std::array<float,2>{0.251866907f, 0.215191439f},
-std::array<float,2>{0.0188593138f, 0.885653138f},
-std::array<float,2>{0.677528203f, 0.365849763f},
-std::array<float,2>{0.922312081f, 0.986186862f},
-std::array<float,2>{0.430942297f, 0.275847226f},
-std::array<float,2>{0.224514097f, 0.644863188f},
-std::array<float,2>{0.544349074f, 0.161277413f},
-std::array<float,2>{0.740691245f, 0.503029048f},
-std::array<float,2>{0.0722841993f, 0.0344291739f},
-std::array<float,2>{0.334298342f, 0.764678478f},
-std::array<float,2>{0.750222206f, 0.457292885f},
-std::array<float,2>{0.632581234f, 0.906324804f},
-std::array<float,2>{0.0382378101f, 0.322471797f},
-std::array<float,2>{0.287013799f, 0.71331501f},
-std::array<float,2>{0.874416232f, 0.237169564f},
-std::array<float,2>{0.94121623f, 0.61008817f},
-std::array<float,2>{0.47197476f, 0.123673975f},
-std::array<float,2>{0.177329049f, 0.819158494f},
-std::array<float,2>{0.588735521f, 0.416676134f},
-std::array<float,2>{0.791690588f, 0.797872543f},
-std::array<float,2>{0.370857626f, 0.480117559f},
-std::array<float,2>{0.113860421f, 0.561294079f},
-std::array<float,2>{0.701458097f, 0.0263342839f},
-std::array<float,2>{0.503706634f, 0.668358624f},
-std::array<float,2>{0.217675075f, 0.147308111f},
-std::array<float,2>{0.387454361f, 0.939876616f},
-std::array<float,2>{0.89173311f, 0.304534823f},
-std::array<float,2>{0.693636179f, 0.8428635f},
-std::array<float,2>{0.119029306f, 0.42279166f},
-std::array<float,2>{0.360367626f, 0.607401371f},
-std::array<float,2>{0.788370788f, 0.0947868973f},
-std::array<float,2>{0.901373982f, 0.70183146f},
-std::array<float,2>{0.377624154f, 0.226985916f},
-std::array<float,2>{0.203550473f, 0.928579867f},
-std::array<float,2>{0.513314486f, 0.336550862f},
-std::array<float,2>{0.8643381f, 0.968652904f},
-std::array<float,2>{0.294159353f, 0.29492715f},
-std::array<float,2>{0.0439040586f, 0.672377765f},
-std::array<float,2>{0.6381073f, 0.138343632f},
-std::array<float,2>{0.580310881f, 0.54292649f},
-std::array<float,2>{0.184390903f, 0.00736708427f},
-std::array<float,2>{0.483856529f, 0.788535774f},
-std::array<float,2>{0.94588238f, 0.495028853f},
-std::array<float,2>{0.534968793f, 0.894096375f},
-std::array<float,2>{0.233811662f, 0.358331591f},
-std::array<float,2>{0.42857641f, 0.731593132f},
-std::array<float,2>{0.930151761f, 0.193159506f},
-std::array<float,2>{0.760336161f, 0.592734337f},
-std::array<float,2>{0.337344825f, 0.0869093463f},
-std::array<float,2>{0.0686303005f, 0.849336207f},
-std::array<float,2>{0.746669114f, 0.396942556f},
-std::array<float,2>{0.96985054f, 0.768875182f},
-std::array<float,2>{0.445322573f, 0.451242417f},
-std::array<float,2>{0.134639874f, 0.528491437f},
-std::array<float,2>{0.607122898f, 0.0555784516f},
-std::array<float,2>{0.684047759f, 0.633140326f},
-std::array<float,2>{0.028289469f, 0.177527636f},
-std::array<float,2>{0.258794099f, 0.974247813f},
-std::array<float,2>{0.813928068f, 0.257718354f},
-std::array<float,2>{0.611198664f, 0.801696956f},
-std::array<float,2>{0.147774875f, 0.483030021f},
-std::array<float,2>{0.455947399f, 0.556487322f},
-std::array<float,2>{0.989554405f, 0.0275021289f},
-std::array<float,2>{0.832796693f, 0.66584909f},
-std::array<float,2>{0.2759552f, 0.140657917f},
-std::array<float,2>{0.000649529975f, 0.941914618f},
-std::array<float,2>{0.670979321f, 0.298540503f},
-std::array<float,2>{0.90970403f, 0.913118184f},
-std::array<float,2>{0.406528622f, 0.326821893f},
-std::array<float,2>{0.249579459f, 0.717922032f},
-std::array<float,2>{0.549000323f, 0.239356995f},
-std::array<float,2>{0.725692451f, 0.614660323f},
-std::array<float,2>{0.0900706127f, 0.118304215f},
-std::array<float,2>{0.317985415f, 0.813904464f},
-std::array<float,2>{0.774798512f, 0.421542883f},
-std::array<float,2>{0.642290533f, 0.991345882f},
-std::array<float,2>{0.056189537f, 0.278008103f},
-std::array<float,2>{0.312092066f, 0.642969072f},
-std::array<float,2>{0.849594235f, 0.158239409f},
-std::array<float,2>{0.964227378f, 0.507443964f},
-std::array<float,2>{0.496067911f, 0.0376357324f},
-std::array<float,2>{0.15984568f, 0.761005282f},
-std::array<float,2>{0.567712009f, 0.454784781f},
-std::array<float,2>{0.811603963f, 0.870232701f},
-std::array<float,2>{0.358496457f, 0.390301198f},
-std::array<float,2>{0.0999462306f, 0.566703796f},
-std::array<float,2>{0.712288678f, 0.0658429116f},
-std::array<float,2>{0.521009445f, 0.745550275f},
-std::array<float,2>{0.200742051f, 0.211419746f},
-std::array<float,2>{0.396634877f, 0.889705479f},
-std::array<float,2>{0.882321298f, 0.361234486f},
-std::array<float,2>{0.657552719f, 0.751230597f},
-std::array<float,2>{0.0123361805f, 0.467140615f},
-std::array<float,2>{0.266455889f, 0.510476053f},
-std::array<float,2>{0.837465942f, 0.0468209051f},
-std::array<float,2>{0.997612298f, 0.655857623f},
-std::array<float,2>{0.461037815f, 0.166175723f},
-std::array<float,2>{0.149884418f, 0.998099029f},
-std::array<float,2>{0.617903113f, 0.265707254f},
-std::array<float,2>{0.767623544f, 0.877707779f},
-std::array<float,2>{0.320489973f, 0.367558688f},
-std::array<float,2>{0.0829417557f, 0.734623194f},
-std::array<float,2>{0.729566216f, 0.210508987f},
-std::array<float,2>{0.558737874f, 0.574294865f},
-std::array<float,2>{0.237891942f, 0.0780812055f},
-std::array<float,2>{0.414961129f, 0.860477865f},
-std::array<float,2>{0.915073514f, 0.379888147f},
-std::array<float,2>{0.572583079f, 0.946097493f},
-std::array<float,2>{0.16536133f, 0.307471931f},
-std::array<float,2>{0.48894763f, 0.66087538f},
-std::array<float,2>{0.953946829f, 0.148656771f},
-std::array<float,2>{0.852192819f, 0.553107917f},
-std::array<float,2>{0.301719427f, 0.0201100316f},
-std::array<float,2>{0.0516640171f, 0.812492251f},
-std::array<float,2>{0.653472126f, 0.473919362f},
-std::array<float,2>{0.886545956f, 0.82082361f},
-std::array<float,2>{0.40584144f, 0.411413908f},
-std::array<float,2>{0.190265447f, 0.624597728f},
-std::array<float,2>{0.528952539f, 0.115380853f},
-std::array<float,2>{0.703684449f, 0.707267225f},
-std::array<float,2>{0.105615877f, 0.248425633f},
-std::array<float,2>{0.348684669f, 0.914565742f},
-std::array<float,2>{0.804654598f, 0.314422727f},
-std::array<float,2>{0.506346941f, 0.851843178f},
-std::array<float,2>{0.21273905f, 0.405305922f},
-std::array<float,2>{0.38474825f, 0.585396767f},
-std::array<float,2>{0.897576988f, 0.081338577f},
-std::array<float,2>{0.796679199f, 0.721299171f},
-std::array<float,2>{0.373638839f, 0.195788667f},
-std::array<float,2>{0.112757906f, 0.898857892f},
-std::array<float,2>{0.698471427f, 0.346094579f},
-std::array<float,2>{0.944912851f, 0.979685247f},
-std::array<float,2>{0.473857194f, 0.262933969f},
-std::array<float,2>{0.1750395f, 0.629548788f},
-std::array<float,2>{0.592642784f, 0.181664154f},
-std::array<float,2>{0.627173901f, 0.518372118f},
-std::array<float,2>{0.0336630084f, 0.0518663824f},
-std::array<float,2>{0.283363611f, 0.77582854f},
-std::array<float,2>{0.870156884f, 0.440908134f},
-std::array<float,2>{0.73778826f, 0.934551597f},
-std::array<float,2>{0.0776612759f, 0.334844887f},
-std::array<float,2>{0.331731409f, 0.692688942f},
-std::array<float,2>{0.755936801f, 0.223762691f},
-std::array<float,2>{0.928891599f, 0.597494364f},
-std::array<float,2>{0.437130481f, 0.108063765f},
-std::array<float,2>{0.222149655f, 0.831701458f},
-std::array<float,2>{0.542517424f, 0.432133555f},
-std::array<float,2>{0.820534408f, 0.796347916f},
-std::array<float,2>{0.254330397f, 0.490987062f},
-std::array<float,2>{0.021875916f, 0.535663903f},
-std::array<float,2>{0.6721223f, 0.0144156106f},
-std::array<float,2>{0.598547518f, 0.682760894f},
-std::array<float,2>{0.126335129f, 0.125786379f},
-std::array<float,2>{0.44440794f, 0.95695287f},
-std::array<float,2>{0.982984543f, 0.284239501f},
-std::array<float,2>{0.635871172f, 0.863699317f},
-std::array<float,2>{0.0425012894f, 0.37889275f},
-std::array<float,2>{0.290536135f, 0.57184118f},
-std::array<float,2>{0.86228174f, 0.0703127161f},
-std::array<float,2>{0.950760126f, 0.739318013f},
-std::array<float,2>{0.479272693f, 0.206526369f},
-std::array<float,2>{0.181424007f, 0.879435718f},
-std::array<float,2>{0.583519816f, 0.371241212f},
-std::array<float,2>{0.784383357f, 0.993558764f},
-std::array<float,2>{0.364387721f, 0.269698441f},
-std::array<float,2>{0.124627769f, 0.65058738f},
-std::array<float,2>{0.691190124f, 0.168532327f},
-std::array<float,2>{0.510088503f, 0.515077353f},
-std::array<float,2>{0.209155455f, 0.0416283049f},
-std::array<float,2>{0.379959792f, 0.755543649f},
-std::array<float,2>{0.905943274f, 0.464556545f},
-std::array<float,2>{0.603413165f, 0.920063555f},
-std::array<float,2>{0.138595328f, 0.317946076f},
-std::array<float,2>{0.451441199f, 0.705964804f},
-std::array<float,2>{0.976005673f, 0.242786512f},
-std::array<float,2>{0.819863379f, 0.620716035f},
-std::array<float,2>{0.265069872f, 0.112476483f},
-std::array<float,2>{0.0264762584f, 0.82779038f},
-std::array<float,2>{0.680197775f, 0.409047097f},
-std::array<float,2>{0.934858859f, 0.805653811f},
-std::array<float,2>{0.423278362f, 0.469746083f},
-std::array<float,2>{0.230053023f, 0.547236383f},
-std::array<float,2>{0.538695335f, 0.0193972569f},
-std::array<float,2>{0.745933294f, 0.657126904f},
-std::array<float,2>{0.0658929646f, 0.154269904f},
-std::array<float,2>{0.342577875f, 0.950337887f},
-std::array<float,2>{0.763290465f, 0.308733672f},
-std::array<float,2>{0.553596199f, 0.778089702f},
-std::array<float,2>{0.242731616f, 0.444290817f},
-std::array<float,2>{0.411879957f, 0.519648373f},
-std::array<float,2>{0.910382032f, 0.0485016741f},
-std::array<float,2>{0.779588938f, 0.626933038f},
-std::array<float,2>{0.312655896f, 0.187258944f},
-std::array<float,2>{0.0867385715f, 0.983454883f},
-std::array<float,2>{0.7207008f, 0.260551065f},
-std::array<float,2>{0.98601371f, 0.905606985f},
-std::array<float,2>{0.457141101f, 0.350239754f},
-std::array<float,2>{0.140863106f, 0.725702345f},
-std::array<float,2>{0.613458991f, 0.200529054f},
-std::array<float,2>{0.665435731f, 0.581521869f},
-std::array<float,2>{0.00778023433f, 0.0836379826f},
-std::array<float,2>{0.280779064f, 0.857925892f},
-std::array<float,2>{0.828799605f, 0.402101785f},
-std::array<float,2>{0.716737509f, 0.959385097f},
-std::array<float,2>{0.0951211303f, 0.288241863f},
-std::array<float,2>{0.355371892f, 0.686433733f},
-std::array<float,2>{0.807413876f, 0.129900143f},
-std::array<float,2>{0.878671288f, 0.532977283f},
-std::array<float,2>{0.393891066f, 0.00784364622f},
-std::array<float,2>{0.197639063f, 0.79001087f},
-std::array<float,2>{0.51927048f, 0.486498028f},
-std::array<float,2>{0.84527266f, 0.832307577f},
-std::array<float,2>{0.304965377f, 0.436673135f},
-std::array<float,2>{0.061234355f, 0.598067582f},
-std::array<float,2>{0.646528482f, 0.102494843f},
-std::array<float,2>{0.564456582f, 0.691305995f},
-std::array<float,2>{0.163066566f, 0.219668821f},
-std::array<float,2>{0.497818738f, 0.930231929f},
-std::array<float,2>{0.965427279f, 0.329746783f},
-std::array<float,2>{0.733941495f, 0.784405529f},
-std::array<float,2>{0.080865927f, 0.499477088f},
-std::array<float,2>{0.324960619f, 0.545232415f},
-std::array<float,2>{0.773370683f, 0.00319292722f},
-std::array<float,2>{0.919013381f, 0.677517772f},
-std::array<float,2>{0.419619679f, 0.135752037f},
-std::array<float,2>{0.241832107f, 0.962581158f},
-std::array<float,2>{0.558593154f, 0.29004854f},
-std::array<float,2>{0.842602491f, 0.923940539f},
-std::array<float,2>{0.271386176f, 0.342263192f},
-std::array<float,2>{0.00943086669f, 0.696598649f},
-std::array<float,2>{0.66397506f, 0.230528757f},
-std::array<float,2>{0.623736322f, 0.601810873f},
-std::array<float,2>{0.15505968f, 0.0998880938f},
-std::array<float,2>{0.467229158f, 0.838220596f},
-std::array<float,2>{0.992254674f, 0.428457379f},
-std::array<float,2>{0.527274966f, 0.970831096f},
-std::array<float,2>{0.194998905f, 0.253690898f},
-std::array<float,2>{0.399851799f, 0.640187562f},
-std::array<float,2>{0.888597548f, 0.172194362f},
-std::array<float,2>{0.797539234f, 0.526382089f},
-std::array<float,2>{0.344868928f, 0.0597493164f},
-std::array<float,2>{0.101926655f, 0.771903217f},
-std::array<float,2>{0.710135162f, 0.448279142f},
-std::array<float,2>{0.957357645f, 0.845564902f},
-std::array<float,2>{0.486070603f, 0.392649442f},
-std::array<float,2>{0.170745119f, 0.58879751f},
-std::array<float,2>{0.576327741f, 0.0931315646f},
-std::array<float,2>{0.648442566f, 0.728613317f},
-std::array<float,2>{0.0489575677f, 0.189924642f},
-std::array<float,2>{0.299196571f, 0.89738822f},
-std::array<float,2>{0.857655585f, 0.352188736f},
-std::array<float,2>{0.587829351f, 0.817459524f},
-std::array<float,2>{0.178194255f, 0.41415447f},
-std::array<float,2>{0.470192254f, 0.61136353f},
-std::array<float,2>{0.93855691f, 0.121578202f},
-std::array<float,2>{0.87237376f, 0.711982012f},
-std::array<float,2>{0.287372768f, 0.235077262f},
-std::array<float,2>{0.0353094451f, 0.908493221f},
-std::array<float,2>{0.630712867f, 0.321042329f},
-std::array<float,2>{0.893064737f, 0.938092649f},
-std::array<float,2>{0.390235484f, 0.301934004f},
-std::array<float,2>{0.21569851f, 0.670346916f},
-std::array<float,2>{0.500817716f, 0.145219401f},
-std::array<float,2>{0.700427473f, 0.560378551f},
-std::array<float,2>{0.116853617f, 0.0246480703f},
-std::array<float,2>{0.368543237f, 0.79907757f},
-std::array<float,2>{0.78997016f, 0.477905959f},
-std::array<float,2>{0.679640889f, 0.883036792f},
-std::array<float,2>{0.0156582538f, 0.364152551f},
-std::array<float,2>{0.253322035f, 0.749529481f},
-std::array<float,2>{0.826046765f, 0.218712196f},
-std::array<float,2>{0.979778469f, 0.565969586f},
-std::array<float,2>{0.439138621f, 0.0682080463f},
-std::array<float,2>{0.13052085f, 0.874917865f},
-std::array<float,2>{0.594990671f, 0.384737521f},
-std::array<float,2>{0.753316224f, 0.763293743f},
-std::array<float,2>{0.333236009f, 0.459936321f},
-std::array<float,2>{0.0713072494f, 0.501730502f},
-std::array<float,2>{0.738307059f, 0.0322547108f},
-std::array<float,2>{0.546753883f, 0.647812009f},
-std::array<float,2>{0.226519361f, 0.162490204f},
-std::array<float,2>{0.432477832f, 0.986668944f},
-std::array<float,2>{0.924083471f, 0.274580896f},
-std::array<float,2>{0.711476982f, 0.868197262f},
-std::array<float,2>{0.100851998f, 0.387088448f},
-std::array<float,2>{0.357787132f, 0.56922698f},
-std::array<float,2>{0.811078966f, 0.0635557696f},
-std::array<float,2>{0.881346524f, 0.742761612f},
-std::array<float,2>{0.397480756f, 0.213324219f},
-std::array<float,2>{0.20007284f, 0.886765718f},
-std::array<float,2>{0.519868314f, 0.362944782f},
-std::array<float,2>{0.848094225f, 0.988578439f},
-std::array<float,2>{0.310712457f, 0.280529529f},
-std::array<float,2>{0.0552396066f, 0.642380893f},
-std::array<float,2>{0.64149791f, 0.157051608f},
-std::array<float,2>{0.566941082f, 0.505462229f},
-std::array<float,2>{0.158335552f, 0.0353073962f},
-std::array<float,2>{0.494267195f, 0.759572625f},
-std::array<float,2>{0.963576853f, 0.45673731f},
-std::array<float,2>{0.549910724f, 0.911367059f},
-std::array<float,2>{0.248335332f, 0.325231254f},
-std::array<float,2>{0.40748021f, 0.71666497f},
-std::array<float,2>{0.908982873f, 0.241903856f},
-std::array<float,2>{0.774314642f, 0.616430342f},
-std::array<float,2>{0.316868871f, 0.119202346f},
-std::array<float,2>{0.0911996067f, 0.81635195f},
-std::array<float,2>{0.725396574f, 0.418630153f},
-std::array<float,2>{0.988609076f, 0.804367125f},
-std::array<float,2>{0.456559777f, 0.481799215f},
-std::array<float,2>{0.146612957f, 0.556779027f},
-std::array<float,2>{0.609742343f, 0.0303849932f},
-std::array<float,2>{0.670790195f, 0.666411459f},
-std::array<float,2>{0.00166255655f, 0.14285253f},
-std::array<float,2>{0.277193397f, 0.944562674f},
-std::array<float,2>{0.833394766f, 0.298985749f},
-std::array<float,2>{0.606290638f, 0.766921282f},
-std::array<float,2>{0.133122355f, 0.451082617f},
-std::array<float,2>{0.44685781f, 0.530714512f},
-std::array<float,2>{0.968798459f, 0.057020057f},
-std::array<float,2>{0.813242376f, 0.636274636f},
-std::array<float,2>{0.258670807f, 0.17957139f},
-std::array<float,2>{0.0285069458f, 0.975946784f},
-std::array<float,2>{0.68511343f, 0.254645139f},
-std::array<float,2>{0.930946171f, 0.891893566f},
-std::array<float,2>{0.429074168f, 0.356795669f},
-std::array<float,2>{0.232623681f, 0.733194828f},
-std::array<float,2>{0.533450782f, 0.193504885f},
-std::array<float,2>{0.747643709f, 0.590952754f},
-std::array<float,2>{0.0694873482f, 0.0888082907f},
-std::array<float,2>{0.336879581f, 0.849951327f},
-std::array<float,2>{0.761116922f, 0.395775139f},
-std::array<float,2>{0.63690275f, 0.966097534f},
-std::array<float,2>{0.0444847457f, 0.293551534f},
-std::array<float,2>{0.293648094f, 0.674290836f},
-std::array<float,2>{0.86404556f, 0.140063643f},
-std::array<float,2>{0.947177947f, 0.539686799f},
-std::array<float,2>{0.483326286f, 0.00485050073f},
-std::array<float,2>{0.184980825f, 0.786722064f},
-std::array<float,2>{0.581377625f, 0.49237749f},
-std::array<float,2>{0.787169278f, 0.840297818f},
-std::array<float,2>{0.359901011f, 0.423843175f},
-std::array<float,2>{0.117281146f, 0.60823673f},
-std::array<float,2>{0.694669306f, 0.096449025f},
-std::array<float,2>{0.512215197f, 0.699886918f},
-std::array<float,2>{0.204868123f, 0.229233116f},
-std::array<float,2>{0.378567278f, 0.927453101f},
-std::array<float,2>{0.901195109f, 0.338495165f},
-std::array<float,2>{0.672923505f, 0.793717027f},
-std::array<float,2>{0.0231413897f, 0.489282072f},
-std::array<float,2>{0.254905194f, 0.537216842f},
-std::array<float,2>{0.821983218f, 0.0121046854f},
-std::array<float,2>{0.983678818f, 0.679845631f},
-std::array<float,2>{0.444271833f, 0.128669322f},
-std::array<float,2>{0.12564671f, 0.955016494f},
-std::array<float,2>{0.598959446f, 0.281435728f},
-std::array<float,2>{0.757057488f, 0.935938954f},
-std::array<float,2>{0.330340326f, 0.333499253f},
-std::array<float,2>{0.0768551379f, 0.694521487f},
-std::array<float,2>{0.736361563f, 0.226100072f},
-std::array<float,2>{0.541498303f, 0.594659448f},
-std::array<float,2>{0.221193761f, 0.106347978f},
-std::array<float,2>{0.436358303f, 0.829184651f},
-std::array<float,2>{0.928548396f, 0.430050433f},
-std::array<float,2>{0.592930198f, 0.978121102f},
-std::array<float,2>{0.174446538f, 0.265186191f},
-std::array<float,2>{0.473632693f, 0.632415056f},
-std::array<float,2>{0.943554163f, 0.181460336f},
-std::array<float,2>{0.869843304f, 0.516500711f},
-std::array<float,2>{0.284571916f, 0.0543504581f},
-std::array<float,2>{0.0346803963f, 0.774068475f},
-std::array<float,2>{0.628536344f, 0.437729627f},
-std::array<float,2>{0.896932364f, 0.854082108f},
-std::array<float,2>{0.382894486f, 0.403166622f},
-std::array<float,2>{0.211836055f, 0.583916128f},
-std::array<float,2>{0.506900907f, 0.0789894983f},
-std::array<float,2>{0.697914958f, 0.720528424f},
-std::array<float,2>{0.112098388f, 0.198937446f},
-std::array<float,2>{0.374987155f, 0.901909292f},
-std::array<float,2>{0.795460463f, 0.344382197f},
-std::array<float,2>{0.527407408f, 0.822922587f},
-std::array<float,2>{0.191213325f, 0.413866669f},
-std::array<float,2>{0.405054629f, 0.621289968f},
-std::array<float,2>{0.885462523f, 0.114427581f},
-std::array<float,2>{0.802998602f, 0.710274816f},
-std::array<float,2>{0.347720563f, 0.247755945f},
-std::array<float,2>{0.10671141f, 0.916357338f},
-std::array<float,2>{0.704919815f, 0.316003889f},
-std::array<float,2>{0.954242408f, 0.947283566f},
-std::array<float,2>{0.490128249f, 0.304838002f},
-std::array<float,2>{0.164404169f, 0.662748337f},
-std::array<float,2>{0.573609769f, 0.152076215f},
-std::array<float,2>{0.652750015f, 0.551404417f},
-std::array<float,2>{0.0518102385f, 0.0215879101f},
-std::array<float,2>{0.301860601f, 0.808659077f},
-std::array<float,2>{0.853451908f, 0.475129962f},
-std::array<float,2>{0.72891587f, 0.876924813f},
-std::array<float,2>{0.0830434486f, 0.370954067f},
-std::array<float,2>{0.321293205f, 0.73712188f},
-std::array<float,2>{0.768687725f, 0.207997292f},
-std::array<float,2>{0.914859176f, 0.577683806f},
-std::array<float,2>{0.415641069f, 0.0745611116f},
-std::array<float,2>{0.236733913f, 0.863229632f},
-std::array<float,2>{0.560470104f, 0.38226077f},
-std::array<float,2>{0.836398244f, 0.753614604f},
-std::array<float,2>{0.267354071f, 0.465342402f},
-std::array<float,2>{0.0135069583f, 0.50830555f},
-std::array<float,2>{0.65682584f, 0.0444020368f},
-std::array<float,2>{0.618429124f, 0.652809024f},
-std::array<float,2>{0.148860171f, 0.164348677f},
-std::array<float,2>{0.462643772f, 0.997638881f},
-std::array<float,2>{0.996219814f, 0.267873317f},
-std::array<float,2>{0.64797163f, 0.834831893f},
-std::array<float,2>{0.0618059374f, 0.433977008f},
-std::array<float,2>{0.306064516f, 0.599808335f},
-std::array<float,2>{0.844544947f, 0.104340151f},
-std::array<float,2>{0.966272354f, 0.688735604f},
-std::array<float,2>{0.49687615f, 0.221739382f},
-std::array<float,2>{0.163382232f, 0.933150232f},
-std::array<float,2>{0.565783799f, 0.330322623f},
-std::array<float,2>{0.808535457f, 0.957607687f},
-std::array<float,2>{0.353565067f, 0.286543041f},
-std::array<float,2>{0.0940212756f, 0.68501246f},
-std::array<float,2>{0.715380609f, 0.131106198f},
-std::array<float,2>{0.518150091f, 0.533412218f},
-std::array<float,2>{0.198679373f, 0.0117158387f},
-std::array<float,2>{0.39320448f, 0.791643202f},
-std::array<float,2>{0.877641678f, 0.48514834f},
-std::array<float,2>{0.614509642f, 0.903694093f},
-std::array<float,2>{0.142133608f, 0.347756922f},
-std::array<float,2>{0.458807319f, 0.724376738f},
-std::array<float,2>{0.985334337f, 0.202529714f},
-std::array<float,2>{0.83007741f, 0.579082072f},
-std::array<float,2>{0.280106962f, 0.0857020617f},
-std::array<float,2>{0.0066935434f, 0.856160283f},
-std::array<float,2>{0.664654732f, 0.400314897f},
-std::array<float,2>{0.911312401f, 0.780989349f},
-std::array<float,2>{0.411052495f, 0.442672461f},
-std::array<float,2>{0.244024575f, 0.523412824f},
-std::array<float,2>{0.554131687f, 0.0506660379f},
-std::array<float,2>{0.71951139f, 0.628007233f},
-std::array<float,2>{0.0878291652f, 0.183692858f},
-std::array<float,2>{0.314171642f, 0.982339561f},
-std::array<float,2>{0.780764222f, 0.258954912f},
-std::array<float,2>{0.537817836f, 0.807469964f},
-std::array<float,2>{0.22889547f, 0.471002162f},
-std::array<float,2>{0.422510535f, 0.548974156f},
-std::array<float,2>{0.93413496f, 0.0165322684f},
-std::array<float,2>{0.761859477f, 0.658914506f},
-std::array<float,2>{0.343640029f, 0.156093806f},
-std::array<float,2>{0.065086402f, 0.952892005f},
-std::array<float,2>{0.744494498f, 0.310956627f},
-std::array<float,2>{0.975287974f, 0.919845462f},
-std::array<float,2>{0.45224601f, 0.319603175f},
-std::array<float,2>{0.137690589f, 0.704623103f},
-std::array<float,2>{0.602345407f, 0.245629668f},
-std::array<float,2>{0.680695951f, 0.619088531f},
-std::array<float,2>{0.0257882196f, 0.110328108f},
-std::array<float,2>{0.264022976f, 0.825690448f},
-std::array<float,2>{0.819188118f, 0.407845855f},
-std::array<float,2>{0.690088451f, 0.995227098f},
-std::array<float,2>{0.123168722f, 0.272205919f},
-std::array<float,2>{0.363295913f, 0.649576843f},
-std::array<float,2>{0.783261895f, 0.171747074f},
-std::array<float,2>{0.904474556f, 0.512766838f},
-std::array<float,2>{0.379538119f, 0.039230451f},
-std::array<float,2>{0.210122108f, 0.756566405f},
-std::array<float,2>{0.511406124f, 0.461841524f},
-std::array<float,2>{0.862767816f, 0.86607486f},
-std::array<float,2>{0.289560556f, 0.376872569f},
-std::array<float,2>{0.0419516712f, 0.572557986f},
-std::array<float,2>{0.635075867f, 0.0727849379f},
-std::array<float,2>{0.582977712f, 0.741584122f},
-std::array<float,2>{0.179851219f, 0.204507455f},
-std::array<float,2>{0.47967875f, 0.882375181f},
-std::array<float,2>{0.949283719f, 0.374888062f},
-std::array<float,2>{0.740059912f, 0.764220536f},
-std::array<float,2>{0.0707962885f, 0.458747983f},
-std::array<float,2>{0.33210355f, 0.502090812f},
-std::array<float,2>{0.752373517f, 0.0336998478f},
-std::array<float,2>{0.925021648f, 0.645606935f},
-std::array<float,2>{0.43346855f, 0.160258144f},
-std::array<float,2>{0.224728093f, 0.984410703f},
-std::array<float,2>{0.545073688f, 0.277000844f},
-std::array<float,2>{0.82508558f, 0.886072099f},
-std::array<float,2>{0.252295017f, 0.366926312f},
-std::array<float,2>{0.0173822455f, 0.746637702f},
-std::array<float,2>{0.6779989f, 0.215868428f},
-std::array<float,2>{0.594097316f, 0.563551307f},
-std::array<float,2>{0.129072919f, 0.0687047839f},
-std::array<float,2>{0.438323975f, 0.871485233f},
-std::array<float,2>{0.979342937f, 0.38547349f},
-std::array<float,2>{0.501797676f, 0.940531671f},
-std::array<float,2>{0.216190428f, 0.303313464f},
-std::array<float,2>{0.388929516f, 0.669336736f},
-std::array<float,2>{0.893666089f, 0.147871107f},
-std::array<float,2>{0.79073596f, 0.562269986f},
-std::array<float,2>{0.367323548f, 0.0264902208f},
-std::array<float,2>{0.116189137f, 0.797147691f},
-std::array<float,2>{0.699795008f, 0.478539348f},
-std::array<float,2>{0.938314915f, 0.819866061f},
-std::array<float,2>{0.468923986f, 0.417551875f},
-std::array<float,2>{0.179634005f, 0.611193657f},
-std::array<float,2>{0.586510897f, 0.124193579f},
-std::array<float,2>{0.629856288f, 0.71418041f},
-std::array<float,2>{0.0361647084f, 0.238015145f},
-std::array<float,2>{0.288159192f, 0.907231569f},
-std::array<float,2>{0.872038364f, 0.32374543f},
-std::array<float,2>{0.577704549f, 0.84627074f},
-std::array<float,2>{0.171316251f, 0.390937805f},
-std::array<float,2>{0.485251188f, 0.587846696f},
-std::array<float,2>{0.958398283f, 0.0908901915f},
-std::array<float,2>{0.859215558f, 0.727078259f},
-std::array<float,2>{0.300505847f, 0.189190254f},
-std::array<float,2>{0.0502615906f, 0.895651579f},
-std::array<float,2>{0.649703801f, 0.355201185f},
-std::array<float,2>{0.887259245f, 0.970680594f},
-std::array<float,2>{0.39909023f, 0.251181483f},
-std::array<float,2>{0.194159806f, 0.638097346f},
-std::array<float,2>{0.525656223f, 0.174716756f},
-std::array<float,2>{0.70942992f, 0.524033487f},
-std::array<float,2>{0.102795891f, 0.0622175038f},
-std::array<float,2>{0.34453544f, 0.770410776f},
-std::array<float,2>{0.798332691f, 0.446191192f},
-std::array<float,2>{0.662285686f, 0.923105478f},
-std::array<float,2>{0.00861349236f, 0.340668231f},
-std::array<float,2>{0.270196706f, 0.697655261f},
-std::array<float,2>{0.843228757f, 0.234198913f},
-std::array<float,2>{0.993350923f, 0.603972018f},
-std::array<float,2>{0.468443513f, 0.099320896f},
-std::array<float,2>{0.155307174f, 0.835978925f},
-std::array<float,2>{0.624517143f, 0.426100343f},
-std::array<float,2>{0.772353053f, 0.781860292f},
-std::array<float,2>{0.326049894f, 0.497750193f},
-std::array<float,2>{0.0816797316f, 0.544336736f},
-std::array<float,2>{0.733190596f, 0.000248887431f},
-std::array<float,2>{0.557612777f, 0.678446054f},
-std::array<float,2>{0.240578711f, 0.133385181f},
-std::array<float,2>{0.41875267f, 0.964836657f},
-std::array<float,2>{0.918014765f, 0.292102516f},
-std::array<float,2>{0.724232793f, 0.812961996f},
-std::array<float,2>{0.0927450806f, 0.420797557f},
-std::array<float,2>{0.319092602f, 0.613574803f},
-std::array<float,2>{0.776181281f, 0.117619731f},
-std::array<float,2>{0.906459391f, 0.717095137f},
-std::array<float,2>{0.409262776f, 0.238730192f},
-std::array<float,2>{0.247369498f, 0.912717819f},
-std::array<float,2>{0.54859972f, 0.327379495f},
-std::array<float,2>{0.834109366f, 0.942749083f},
-std::array<float,2>{0.273901582f, 0.297336072f},
-std::array<float,2>{0.00326180761f, 0.664788604f},
-std::array<float,2>{0.669769585f, 0.142094985f},
-std::array<float,2>{0.612496972f, 0.555430412f},
-std::array<float,2>{0.146127f, 0.0284616053f},
-std::array<float,2>{0.453363359f, 0.802033365f},
-std::array<float,2>{0.991432905f, 0.483776718f},
-std::array<float,2>{0.522376418f, 0.889252901f},
-std::array<float,2>{0.202050194f, 0.359548599f},
-std::array<float,2>{0.395520538f, 0.744715154f},
-std::array<float,2>{0.879311264f, 0.212219179f},
-std::array<float,2>{0.809704781f, 0.567406237f},
-std::array<float,2>{0.356655985f, 0.0651322007f},
-std::array<float,2>{0.097957924f, 0.869899273f},
-std::array<float,2>{0.712980628f, 0.389442652f},
-std::array<float,2>{0.962594986f, 0.760733664f},
-std::array<float,2>{0.493926257f, 0.453595608f},
-std::array<float,2>{0.157993704f, 0.506722987f},
-std::array<float,2>{0.569506824f, 0.0384932756f},
-std::array<float,2>{0.642788172f, 0.643751323f},
-std::array<float,2>{0.0575075708f, 0.159918129f},
-std::array<float,2>{0.309691042f, 0.990771353f},
-std::array<float,2>{0.851453245f, 0.279123634f},
-std::array<float,2>{0.579978108f, 0.787984312f},
-std::array<float,2>{0.187254593f, 0.495709807f},
-std::array<float,2>{0.481385827f, 0.541220546f},
-std::array<float,2>{0.948215485f, 0.0064181285f},
-std::array<float,2>{0.865390539f, 0.67322284f},
-std::array<float,2>{0.296177328f, 0.137007236f},
-std::array<float,2>{0.0460213199f, 0.96692872f},
-std::array<float,2>{0.639946759f, 0.29590863f},
-std::array<float,2>{0.900317967f, 0.928729236f},
-std::array<float,2>{0.376493603f, 0.337134063f},
-std::array<float,2>{0.206556559f, 0.702940047f},
-std::array<float,2>{0.514563739f, 0.227561429f},
-std::array<float,2>{0.691469371f, 0.606399298f},
-std::array<float,2>{0.121042475f, 0.0943905637f},
-std::array<float,2>{0.361570001f, 0.842142642f},
-std::array<float,2>{0.785168707f, 0.423584312f},
-std::array<float,2>{0.686163127f, 0.972794056f},
-std::array<float,2>{0.0304290876f, 0.256640643f},
-std::array<float,2>{0.260616571f, 0.634153426f},
-std::array<float,2>{0.814877808f, 0.176260307f},
-std::array<float,2>{0.972617865f, 0.528257668f},
-std::array<float,2>{0.44774124f, 0.0557934791f},
-std::array<float,2>{0.135642469f, 0.768374324f},
-std::array<float,2>{0.608823597f, 0.45243299f},
-std::array<float,2>{0.758484602f, 0.84815532f},
-std::array<float,2>{0.339560002f, 0.397827089f},
-std::array<float,2>{0.0674445331f, 0.593693018f},
-std::array<float,2>{0.748238087f, 0.0871720016f},
-std::array<float,2>{0.532641232f, 0.730623245f},
-std::array<float,2>{0.231136337f, 0.191852376f},
-std::array<float,2>{0.426373124f, 0.892744124f},
-std::array<float,2>{0.931676745f, 0.358605325f},
-std::array<float,2>{0.625268996f, 0.776516974f},
-std::array<float,2>{0.0325024948f, 0.440076143f},
-std::array<float,2>{0.282965183f, 0.518862486f},
-std::array<float,2>{0.867296994f, 0.0514769554f},
-std::array<float,2>{0.941810369f, 0.630682051f},
-std::array<float,2>{0.476199985f, 0.182780027f},
-std::array<float,2>{0.173092231f, 0.978858173f},
-std::array<float,2>{0.590878189f, 0.26221329f},
-std::array<float,2>{0.793507457f, 0.899571478f},
-std::array<float,2>{0.371368647f, 0.346851528f},
-std::array<float,2>{0.110408112f, 0.722091377f},
-std::array<float,2>{0.696408451f, 0.197045013f},
-std::array<float,2>{0.505464077f, 0.584706843f},
-std::array<float,2>{0.214155465f, 0.0805550292f},
-std::array<float,2>{0.385616869f, 0.853130698f},
-std::array<float,2>{0.896208107f, 0.404813349f},
-std::array<float,2>{0.599654138f, 0.955281317f},
-std::array<float,2>{0.127051964f, 0.284082979f},
-std::array<float,2>{0.441665947f, 0.682272911f},
-std::array<float,2>{0.981073141f, 0.126881421f},
-std::array<float,2>{0.822605193f, 0.536471248f},
-std::array<float,2>{0.256763875f, 0.0149852894f},
-std::array<float,2>{0.0209018812f, 0.795600712f},
-std::array<float,2>{0.675238371f, 0.492049158f},
-std::array<float,2>{0.92700851f, 0.830419242f},
-std::array<float,2>{0.433811128f, 0.433382332f},
-std::array<float,2>{0.220382184f, 0.596137404f},
-std::array<float,2>{0.54067868f, 0.108719416f},
-std::array<float,2>{0.734711111f, 0.691515267f},
-std::array<float,2>{0.0748514086f, 0.222866535f},
-std::array<float,2>{0.329852521f, 0.934632421f},
-std::array<float,2>{0.754929304f, 0.335571736f},
-std::array<float,2>{0.561254799f, 0.85978961f},
-std::array<float,2>{0.236022353f, 0.378992736f},
-std::array<float,2>{0.417636812f, 0.575964153f},
-std::array<float,2>{0.91774112f, 0.0770761073f},
-std::array<float,2>{0.766138971f, 0.736323655f},
-std::array<float,2>{0.32410273f, 0.209115922f},
-std::array<float,2>{0.0846897811f, 0.878035486f},
-std::array<float,2>{0.726648986f, 0.368487269f},
-std::array<float,2>{0.998106837f, 0.999377906f},
-std::array<float,2>{0.463415414f, 0.266885072f},
-std::array<float,2>{0.151445478f, 0.654703259f},
-std::array<float,2>{0.620466471f, 0.167009965f},
-std::array<float,2>{0.659148335f, 0.511463046f},
-std::array<float,2>{0.0145284999f, 0.0452751517f},
-std::array<float,2>{0.268991351f, 0.750497699f},
-std::array<float,2>{0.839835703f, 0.468139201f},
-std::array<float,2>{0.705949664f, 0.915949047f},
-std::array<float,2>{0.107631966f, 0.313357592f},
-std::array<float,2>{0.349921137f, 0.708854079f},
-std::array<float,2>{0.802381933f, 0.249497056f},
-std::array<float,2>{0.883948445f, 0.62379235f},
-std::array<float,2>{0.403707832f, 0.116511211f},
-std::array<float,2>{0.188097775f, 0.821358025f},
-std::array<float,2>{0.530523121f, 0.411056191f},
-std::array<float,2>{0.855043411f, 0.811439455f},
-std::array<float,2>{0.304442555f, 0.473385662f},
-std::array<float,2>{0.0541951209f, 0.55418396f},
-std::array<float,2>{0.655919373f, 0.021376526f},
-std::array<float,2>{0.571550131f, 0.66165632f},
-std::array<float,2>{0.167932689f, 0.149718761f},
-std::array<float,2>{0.491383791f, 0.946291924f},
-std::array<float,2>{0.955208719f, 0.308273256f},
-std::array<float,2>{0.666401505f, 0.859186471f},
-std::array<float,2>{0.00458693365f, 0.400760382f},
-std::array<float,2>{0.278385729f, 0.580997109f},
-std::array<float,2>{0.830695033f, 0.0828322321f},
-std::array<float,2>{0.986828625f, 0.724910378f},
-std::array<float,2>{0.459548652f, 0.19954057f},
-std::array<float,2>{0.143142238f, 0.90465492f},
-std::array<float,2>{0.617060184f, 0.350682646f},
-std::array<float,2>{0.778546453f, 0.982849836f},
-std::array<float,2>{0.316133261f, 0.260909677f},
-std::array<float,2>{0.089300625f, 0.625737607f},
-std::array<float,2>{0.721071482f, 0.186453894f},
-std::array<float,2>{0.550794482f, 0.520595789f},
-std::array<float,2>{0.244343832f, 0.0473882109f},
-std::array<float,2>{0.413241655f, 0.77867198f},
-std::array<float,2>{0.913122535f, 0.444975972f},
-std::array<float,2>{0.56336683f, 0.931242228f},
-std::array<float,2>{0.160348505f, 0.328969747f},
-std::array<float,2>{0.499856412f, 0.689651012f},
-std::array<float,2>{0.967667401f, 0.220389724f},
-std::array<float,2>{0.847284555f, 0.599564254f},
-std::array<float,2>{0.307063043f, 0.103257254f},
-std::array<float,2>{0.0600573793f, 0.833095789f},
-std::array<float,2>{0.644927859f, 0.435932696f},
-std::array<float,2>{0.87516439f, 0.79074049f},
-std::array<float,2>{0.391857117f, 0.487445474f},
-std::array<float,2>{0.195327014f, 0.531279385f},
-std::array<float,2>{0.516225278f, 0.00958888792f},
-std::array<float,2>{0.717152536f, 0.686935544f},
-std::array<float,2>{0.0968137085f, 0.129668638f},
-std::array<float,2>{0.352664173f, 0.960668802f},
-std::array<float,2>{0.805518508f, 0.287194848f},
-std::array<float,2>{0.508136272f, 0.753965318f},
-std::array<float,2>{0.208604708f, 0.463860154f},
-std::array<float,2>{0.38253051f, 0.513794541f},
-std::array<float,2>{0.904207289f, 0.0428125896f},
-std::array<float,2>{0.78245914f, 0.652170479f},
-std::array<float,2>{0.365755081f, 0.169134378f},
-std::array<float,2>{0.121289395f, 0.992583692f},
-std::array<float,2>{0.68898195f, 0.270514786f},
-std::array<float,2>{0.951229692f, 0.880165815f},
-std::array<float,2>{0.476893634f, 0.37270388f},
-std::array<float,2>{0.183429956f, 0.738575697f},
-std::array<float,2>{0.584254026f, 0.205305472f},
-std::array<float,2>{0.633591533f, 0.570880592f},
-std::array<float,2>{0.0397321358f, 0.0716746002f},
-std::array<float,2>{0.291828632f, 0.864337146f},
-std::array<float,2>{0.85966301f, 0.377034426f},
-std::array<float,2>{0.742740929f, 0.949821472f},
-std::array<float,2>{0.0632412732f, 0.310530514f},
-std::array<float,2>{0.340346694f, 0.657930315f},
-std::array<float,2>{0.764404535f, 0.153311238f},
-std::array<float,2>{0.936152816f, 0.548073292f},
-std::array<float,2>{0.42461279f, 0.0183894895f},
-std::array<float,2>{0.226628721f, 0.80576098f},
-std::array<float,2>{0.535878778f, 0.468857467f},
-std::array<float,2>{0.816816688f, 0.826286256f},
-std::array<float,2>{0.262853563f, 0.40969342f},
-std::array<float,2>{0.0238388199f, 0.62007159f},
-std::array<float,2>{0.68217063f, 0.111893155f},
-std::array<float,2>{0.604617596f, 0.706697941f},
-std::array<float,2>{0.139234066f, 0.243605122f},
-std::array<float,2>{0.451135814f, 0.921185553f},
-std::array<float,2>{0.974326372f, 0.316432714f},
-std::array<float,2>{0.702711463f, 0.80019784f},
-std::array<float,2>{0.114314727f, 0.477426112f},
-std::array<float,2>{0.369325876f, 0.558981657f},
-std::array<float,2>{0.792477429f, 0.0235049427f},
-std::array<float,2>{0.890678525f, 0.671070457f},
-std::array<float,2>{0.387886077f, 0.146392912f},
-std::array<float,2>{0.218066484f, 0.939308524f},
-std::array<float,2>{0.502387702f, 0.301507473f},
-std::array<float,2>{0.873864591f, 0.90982753f},
-std::array<float,2>{0.285948455f, 0.321900636f},
-std::array<float,2>{0.0374377519f, 0.711387932f},
-std::array<float,2>{0.630926907f, 0.236234635f},
-std::array<float,2>{0.589532912f, 0.61278224f},
-std::array<float,2>{0.176051602f, 0.123033769f},
-std::array<float,2>{0.471068174f, 0.817133844f},
-std::array<float,2>{0.940014184f, 0.415850878f},
-std::array<float,2>{0.543112338f, 0.987905622f},
-std::array<float,2>{0.22300531f, 0.273445904f},
-std::array<float,2>{0.429955363f, 0.647291541f},
-std::array<float,2>{0.923278809f, 0.16324231f},
-std::array<float,2>{0.75126797f, 0.500483215f},
-std::array<float,2>{0.335089743f, 0.0319417156f},
-std::array<float,2>{0.0739412233f, 0.762496054f},
-std::array<float,2>{0.741606832f, 0.460090458f},
-std::array<float,2>{0.976891637f, 0.873951793f},
-std::array<float,2>{0.440865904f, 0.38373819f},
-std::array<float,2>{0.132245511f, 0.565312445f},
-std::array<float,2>{0.596296489f, 0.0668421984f},
-std::array<float,2>{0.67578274f, 0.748841465f},
-std::array<float,2>{0.0181043595f, 0.216861397f},
-std::array<float,2>{0.250605524f, 0.88448137f},
-std::array<float,2>{0.826891005f, 0.364904523f},
-std::array<float,2>{0.621557891f, 0.839282274f},
-std::array<float,2>{0.153378233f, 0.429088086f},
-std::array<float,2>{0.465067148f, 0.603249073f},
-std::array<float,2>{0.994585574f, 0.100924507f},
-std::array<float,2>{0.840251923f, 0.695600033f},
-std::array<float,2>{0.272173911f, 0.231655434f},
-std::array<float,2>{0.0110482741f, 0.925712109f},
-std::array<float,2>{0.661358714f, 0.343112499f},
-std::array<float,2>{0.920674324f, 0.961226463f},
-std::array<float,2>{0.421723247f, 0.289312154f},
-std::array<float,2>{0.239110664f, 0.676538527f},
-std::array<float,2>{0.556574464f, 0.13555713f},
-std::array<float,2>{0.730605185f, 0.546232581f},
-std::array<float,2>{0.0782758296f, 0.00240111887f},
-std::array<float,2>{0.32744661f, 0.783237398f},
-std::array<float,2>{0.771088958f, 0.498825043f},
-std::array<float,2>{0.652280867f, 0.898190022f},
-std::array<float,2>{0.0487129018f, 0.352652907f},
-std::array<float,2>{0.297252148f, 0.729945064f},
-std::array<float,2>{0.855890274f, 0.191025108f},
-std::array<float,2>{0.96035552f, 0.589390635f},
-std::array<float,2>{0.487846136f, 0.0918459743f},
-std::array<float,2>{0.168851122f, 0.844017684f},
-std::array<float,2>{0.575290442f, 0.394014716f},
-std::array<float,2>{0.799727738f, 0.772742689f},
-std::array<float,2>{0.346918672f, 0.448067158f},
-std::array<float,2>{0.10379447f, 0.525678396f},
-std::array<float,2>{0.707263231f, 0.0591463894f},
-std::array<float,2>{0.525092065f, 0.638697982f},
-std::array<float,2>{0.191819936f, 0.173560441f},
-std::array<float,2>{0.40062207f, 0.972327828f},
-std::array<float,2>{0.890018165f, 0.252027243f}}
\ No newline at end of file
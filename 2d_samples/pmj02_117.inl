@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.657660306f, 0.246995062f},
-std::array<float,2>{0.479876041f, 0.705988348f},
-std::array<float,2>{0.0720629394f, 0.366698563f},
-std::array<float,2>{0.840905011f, 0.945025027f},
-std::array<float,2>{0.904274344f, 0.407065868f},
-std::array<float,2>{0.142893568f, 0.869973063f},
-std::array<float,2>{0.357981354f, 0.0203733742f},
-std::array<float,2>{0.545684934f, 0.596301794f},
-std::array<float,2>{0.601756632f, 0.294689059f},
-std::array<float,2>{0.307555318f, 0.922330201f},
-std::array<float,2>{0.193555117f, 0.130770668f},
-std::array<float,2>{0.990319788f, 0.672884405f},
-std::array<float,2>{0.752564192f, 0.12394806f},
-std::array<float,2>{0.0130783981f, 0.546200871f},
-std::array<float,2>{0.43380928f, 0.445563376f},
-std::array<float,2>{0.715369642f, 0.786139607f},
-std::array<float,2>{0.513978481f, 0.0332589149f},
-std::array<float,2>{0.342441827f, 0.580083728f},
-std::array<float,2>{0.156678319f, 0.392813116f},
-std::array<float,2>{0.912513196f, 0.8331815f},
-std::array<float,2>{0.857107341f, 0.317522705f},
-std::array<float,2>{0.118201621f, 0.988360882f},
-std::array<float,2>{0.451461583f, 0.216626644f},
-std::array<float,2>{0.644188464f, 0.740175247f},
-std::array<float,2>{0.748973608f, 0.485974908f},
-std::array<float,2>{0.383963764f, 0.775249898f},
-std::array<float,2>{0.0340134539f, 0.0706775486f},
-std::array<float,2>{0.785406828f, 0.529042959f},
-std::array<float,2>{0.947628856f, 0.159406126f},
-std::array<float,2>{0.233020842f, 0.636971235f},
-std::array<float,2>{0.263240397f, 0.264079362f},
-std::array<float,2>{0.574394882f, 0.893718302f},
-std::array<float,2>{0.580942571f, 0.149719223f},
-std::array<float,2>{0.273124337f, 0.668577075f},
-std::array<float,2>{0.243033513f, 0.297715425f},
-std::array<float,2>{0.956207037f, 0.908462346f},
-std::array<float,2>{0.80860883f, 0.465702176f},
-std::array<float,2>{0.0526974685f, 0.801561952f},
-std::array<float,2>{0.401902288f, 0.106219724f},
-std::array<float,2>{0.720993161f, 0.561882436f},
-std::array<float,2>{0.627507806f, 0.346620411f},
-std::array<float,2>{0.461692065f, 0.957145989f},
-std::array<float,2>{0.10126543f, 0.232541457f},
-std::array<float,2>{0.86727798f, 0.703036904f},
-std::array<float,2>{0.935759425f, 0.00169126922f},
-std::array<float,2>{0.173552543f, 0.61014694f},
-std::array<float,2>{0.321616858f, 0.432297587f},
-std::array<float,2>{0.523602128f, 0.853625894f},
-std::array<float,2>{0.701439321f, 0.0784246027f},
-std::array<float,2>{0.412485063f, 0.511434019f},
-std::array<float,2>{0.030177908f, 0.482954651f},
-std::array<float,2>{0.772972465f, 0.753205538f},
-std::array<float,2>{0.968900681f, 0.275878549f},
-std::array<float,2>{0.210112438f, 0.878929317f},
-std::array<float,2>{0.282235771f, 0.183291778f},
-std::array<float,2>{0.61851722f, 0.647208631f},
-std::array<float,2>{0.548130095f, 0.383386165f},
-std::array<float,2>{0.364136517f, 0.827349663f},
-std::array<float,2>{0.129975513f, 0.0528359413f},
-std::array<float,2>{0.884764314f, 0.566353023f},
-std::array<float,2>{0.812638938f, 0.201663554f},
-std::array<float,2>{0.0920564085f, 0.72869283f},
-std::array<float,2>{0.494503081f, 0.339836448f},
-std::array<float,2>{0.684859872f, 0.978729069f},
-std::array<float,2>{0.734362245f, 0.178727105f},
-std::array<float,2>{0.39585042f, 0.649886966f},
-std::array<float,2>{0.0567111671f, 0.266515672f},
-std::array<float,2>{0.800470233f, 0.887371361f},
-std::array<float,2>{0.962939441f, 0.470908314f},
-std::array<float,2>{0.237738326f, 0.760852158f},
-std::array<float,2>{0.280457139f, 0.0866594166f},
-std::array<float,2>{0.58917743f, 0.501175404f},
-std::array<float,2>{0.516313732f, 0.331772655f},
-std::array<float,2>{0.32010287f, 0.973454714f},
-std::array<float,2>{0.179921314f, 0.192344964f},
-std::array<float,2>{0.926162481f, 0.726112366f},
-std::array<float,2>{0.863659441f, 0.058083605f},
-std::array<float,2>{0.109048449f, 0.574437022f},
-std::array<float,2>{0.459058821f, 0.378068805f},
-std::array<float,2>{0.638533831f, 0.816535175f},
-std::array<float,2>{0.614774168f, 0.0999301448f},
-std::array<float,2>{0.296557933f, 0.551247716f},
-std::array<float,2>{0.212393805f, 0.45640704f},
-std::array<float,2>{0.983257651f, 0.809482515f},
-std::array<float,2>{0.778414547f, 0.309916437f},
-std::array<float,2>{0.018838061f, 0.918900311f},
-std::array<float,2>{0.41734907f, 0.142604128f},
-std::array<float,2>{0.692016423f, 0.658104897f},
-std::array<float,2>{0.673529923f, 0.422388941f},
-std::array<float,2>{0.491942346f, 0.846867025f},
-std::array<float,2>{0.0801828206f, 0.011448754f},
-std::array<float,2>{0.826019585f, 0.622294426f},
-std::array<float,2>{0.881075263f, 0.225340798f},
-std::array<float,2>{0.137439862f, 0.691655159f},
-std::array<float,2>{0.368473887f, 0.355526716f},
-std::array<float,2>{0.561988294f, 0.967097998f},
-std::array<float,2>{0.538840353f, 0.207784265f},
-std::array<float,2>{0.344712406f, 0.742606461f},
-std::array<float,2>{0.155174181f, 0.323941976f},
-std::array<float,2>{0.892857969f, 0.99273473f},
-std::array<float,2>{0.830456972f, 0.400329351f},
-std::array<float,2>{0.0696942434f, 0.840722144f},
-std::array<float,2>{0.469303429f, 0.0450458303f},
-std::array<float,2>{0.664400876f, 0.586691618f},
-std::array<float,2>{0.706065774f, 0.252245277f},
-std::array<float,2>{0.425929755f, 0.899387002f},
-std::array<float,2>{0.0018198071f, 0.169034243f},
-std::array<float,2>{0.762888491f, 0.630834281f},
-std::array<float,2>{0.996696711f, 0.0681708232f},
-std::array<float,2>{0.198106289f, 0.517870545f},
-std::array<float,2>{0.298444539f, 0.498688012f},
-std::array<float,2>{0.597824216f, 0.767471313f},
-std::array<float,2>{0.650921285f, 0.0277573708f},
-std::array<float,2>{0.438218296f, 0.605490506f},
-std::array<float,2>{0.116770521f, 0.414761633f},
-std::array<float,2>{0.84756279f, 0.86353606f},
-std::array<float,2>{0.916192353f, 0.370643616f},
-std::array<float,2>{0.165508851f, 0.950439394f},
-std::array<float,2>{0.329563826f, 0.238383934f},
-std::array<float,2>{0.506114841f, 0.71344769f},
-std::array<float,2>{0.56638974f, 0.443392605f},
-std::array<float,2>{0.251610816f, 0.794918776f},
-std::array<float,2>{0.224347532f, 0.113272719f},
-std::array<float,2>{0.943948627f, 0.531865835f},
-std::array<float,2>{0.792063951f, 0.136028618f},
-std::array<float,2>{0.044759728f, 0.686893284f},
-std::array<float,2>{0.382026643f, 0.285879612f},
-std::array<float,2>{0.73589474f, 0.937355816f},
-std::array<float,2>{0.636474729f, 0.125375718f},
-std::array<float,2>{0.453760773f, 0.679172039f},
-std::array<float,2>{0.103999235f, 0.291167378f},
-std::array<float,2>{0.859712899f, 0.926987469f},
-std::array<float,2>{0.92269963f, 0.450897336f},
-std::array<float,2>{0.183964297f, 0.783316314f},
-std::array<float,2>{0.313064277f, 0.120234273f},
-std::array<float,2>{0.520996213f, 0.540903151f},
-std::array<float,2>{0.590091467f, 0.360258698f},
-std::array<float,2>{0.276651263f, 0.940149248f},
-std::array<float,2>{0.239841059f, 0.243376434f},
-std::array<float,2>{0.965773821f, 0.707196653f},
-std::array<float,2>{0.802954137f, 0.0192318801f},
-std::array<float,2>{0.059650369f, 0.601547718f},
-std::array<float,2>{0.393554777f, 0.410707742f},
-std::array<float,2>{0.728533804f, 0.871189713f},
-std::array<float,2>{0.55597955f, 0.0753768533f},
-std::array<float,2>{0.374768108f, 0.523505509f},
-std::array<float,2>{0.134733573f, 0.488408238f},
-std::array<float,2>{0.875334024f, 0.77865833f},
-std::array<float,2>{0.822497189f, 0.261651874f},
-std::array<float,2>{0.0839561746f, 0.895368338f},
-std::array<float,2>{0.485664546f, 0.16324161f},
-std::array<float,2>{0.676066577f, 0.636641204f},
-std::array<float,2>{0.689915836f, 0.396036088f},
-std::array<float,2>{0.421795577f, 0.829104125f},
-std::array<float,2>{0.0199152995f, 0.0377391092f},
-std::array<float,2>{0.773738384f, 0.584081531f},
-std::array<float,2>{0.977034569f, 0.213485256f},
-std::array<float,2>{0.218719691f, 0.737762749f},
-std::array<float,2>{0.291572928f, 0.314597815f},
-std::array<float,2>{0.613205194f, 0.985239148f},
-std::array<float,2>{0.597637892f, 0.227523208f},
-std::array<float,2>{0.302089512f, 0.696502864f},
-std::array<float,2>{0.201836795f, 0.349787444f},
-std::array<float,2>{0.994406521f, 0.95361048f},
-std::array<float,2>{0.758345425f, 0.434644043f},
-std::array<float,2>{0.00530778803f, 0.856097639f},
-std::array<float,2>{0.424617767f, 0.0061150468f},
-std::array<float,2>{0.709949195f, 0.61388725f},
-std::array<float,2>{0.670484841f, 0.301848799f},
-std::array<float,2>{0.475045562f, 0.912747204f},
-std::array<float,2>{0.0657450408f, 0.154476658f},
-std::array<float,2>{0.835596442f, 0.665878534f},
-std::array<float,2>{0.896136761f, 0.102813944f},
-std::array<float,2>{0.151260376f, 0.557097554f},
-std::array<float,2>{0.347952306f, 0.46412465f},
-std::array<float,2>{0.534584582f, 0.797021687f},
-std::array<float,2>{0.74006629f, 0.0480158627f},
-std::array<float,2>{0.377208203f, 0.568365335f},
-std::array<float,2>{0.03991789f, 0.388981432f},
-std::array<float,2>{0.793458879f, 0.823538899f},
-std::array<float,2>{0.93914187f, 0.34185037f},
-std::array<float,2>{0.220660031f, 0.981178463f},
-std::array<float,2>{0.255342931f, 0.19751136f},
-std::array<float,2>{0.570271015f, 0.732281268f},
-std::array<float,2>{0.50154525f, 0.480195761f},
-std::array<float,2>{0.333842754f, 0.754971385f},
-std::array<float,2>{0.1711317f, 0.0824363902f},
-std::array<float,2>{0.918705046f, 0.512987077f},
-std::array<float,2>{0.847861469f, 0.185559064f},
-std::array<float,2>{0.113221765f, 0.641624212f},
-std::array<float,2>{0.442334414f, 0.279482365f},
-std::array<float,2>{0.653640509f, 0.876778543f},
-std::array<float,2>{0.712751031f, 0.191391781f},
-std::array<float,2>{0.431106895f, 0.720973909f},
-std::array<float,2>{0.0112927714f, 0.335838825f},
-std::array<float,2>{0.756136715f, 0.969424129f},
-std::array<float,2>{0.986569524f, 0.380856216f},
-std::array<float,2>{0.190914527f, 0.813807428f},
-std::array<float,2>{0.31160301f, 0.0599689893f},
-std::array<float,2>{0.608624756f, 0.57311964f},
-std::array<float,2>{0.539205015f, 0.272541851f},
-std::array<float,2>{0.35352385f, 0.88664335f},
-std::array<float,2>{0.144711196f, 0.172310606f},
-std::array<float,2>{0.898479044f, 0.654900193f},
-std::array<float,2>{0.836346328f, 0.0925451145f},
-std::array<float,2>{0.0747511238f, 0.504518688f},
-std::array<float,2>{0.480879575f, 0.474696606f},
-std::array<float,2>{0.663224339f, 0.764443159f},
-std::array<float,2>{0.570993364f, 0.0141330678f},
-std::array<float,2>{0.261385322f, 0.618332624f},
-std::array<float,2>{0.22682099f, 0.427192003f},
-std::array<float,2>{0.949881673f, 0.850217521f},
-std::array<float,2>{0.783699334f, 0.354351014f},
-std::array<float,2>{0.0362277478f, 0.96168083f},
-std::array<float,2>{0.389684498f, 0.221831307f},
-std::array<float,2>{0.742590427f, 0.68780458f},
-std::array<float,2>{0.648349345f, 0.459497869f},
-std::array<float,2>{0.445982486f, 0.807082415f},
-std::array<float,2>{0.122733615f, 0.0970473662f},
-std::array<float,2>{0.853098094f, 0.547260702f},
-std::array<float,2>{0.90757072f, 0.145710737f},
-std::array<float,2>{0.162176654f, 0.662263572f},
-std::array<float,2>{0.336434215f, 0.308153629f},
-std::array<float,2>{0.509145379f, 0.917453647f},
-std::array<float,2>{0.529641449f, 0.166371018f},
-std::array<float,2>{0.32450971f, 0.628531396f},
-std::array<float,2>{0.176634938f, 0.254388154f},
-std::array<float,2>{0.932871401f, 0.904934287f},
-std::array<float,2>{0.874139905f, 0.495645314f},
-std::array<float,2>{0.0956858397f, 0.770001531f},
-std::array<float,2>{0.466942459f, 0.062596269f},
-std::array<float,2>{0.629608452f, 0.521071911f},
-std::array<float,2>{0.723115504f, 0.325759768f},
-std::array<float,2>{0.404855013f, 0.997107983f},
-std::array<float,2>{0.0472867377f, 0.205727533f},
-std::array<float,2>{0.805327058f, 0.749717414f},
-std::array<float,2>{0.957185566f, 0.0413472168f},
-std::array<float,2>{0.249809936f, 0.590577364f},
-std::array<float,2>{0.267493248f, 0.404223263f},
-std::array<float,2>{0.583908558f, 0.83774972f},
-std::array<float,2>{0.683344364f, 0.117073283f},
-std::array<float,2>{0.498735279f, 0.536962628f},
-std::array<float,2>{0.0860665068f, 0.440742105f},
-std::array<float,2>{0.81953603f, 0.791977465f},
-std::array<float,2>{0.889802396f, 0.282360166f},
-std::array<float,2>{0.125422344f, 0.931592584f},
-std::array<float,2>{0.363249928f, 0.140527427f},
-std::array<float,2>{0.553664088f, 0.681967735f},
-std::array<float,2>{0.624553442f, 0.418709993f},
-std::array<float,2>{0.288601965f, 0.861302674f},
-std::array<float,2>{0.206143439f, 0.0258461609f},
-std::array<float,2>{0.974847317f, 0.603573263f},
-std::array<float,2>{0.765977979f, 0.237721071f},
-std::array<float,2>{0.0252513178f, 0.717415571f},
-std::array<float,2>{0.409257472f, 0.374788195f},
-std::array<float,2>{0.695452154f, 0.94686532f},
-std::array<float,2>{0.641313314f, 0.218305781f},
-std::array<float,2>{0.449234605f, 0.741929114f},
-std::array<float,2>{0.119722061f, 0.318443f},
-std::array<float,2>{0.859054208f, 0.990742922f},
-std::array<float,2>{0.911247015f, 0.391859323f},
-std::array<float,2>{0.160040319f, 0.835596383f},
-std::array<float,2>{0.340196073f, 0.0317896083f},
-std::array<float,2>{0.51334095f, 0.579500139f},
-std::array<float,2>{0.577541411f, 0.262222707f},
-std::array<float,2>{0.263907045f, 0.890715957f},
-std::array<float,2>{0.231441602f, 0.157617524f},
-std::array<float,2>{0.945983589f, 0.640390873f},
-std::array<float,2>{0.788329303f, 0.0732437f},
-std::array<float,2>{0.03289162f, 0.531173468f},
-std::array<float,2>{0.385874957f, 0.486779004f},
-std::array<float,2>{0.747887671f, 0.776461124f},
-std::array<float,2>{0.543951154f, 0.0217930544f},
-std::array<float,2>{0.35664922f, 0.595094085f},
-std::array<float,2>{0.141741261f, 0.410154939f},
-std::array<float,2>{0.904875338f, 0.869084835f},
-std::array<float,2>{0.842976511f, 0.363604277f},
-std::array<float,2>{0.0740057975f, 0.942211747f},
-std::array<float,2>{0.478195935f, 0.249707013f},
-std::array<float,2>{0.658481658f, 0.703739047f},
-std::array<float,2>{0.718150318f, 0.447708964f},
-std::array<float,2>{0.437274039f, 0.787316203f},
-std::array<float,2>{0.0142711867f, 0.12300577f},
-std::array<float,2>{0.751007915f, 0.544617712f},
-std::array<float,2>{0.988982677f, 0.131523594f},
-std::array<float,2>{0.191734269f, 0.675044775f},
-std::array<float,2>{0.306253225f, 0.295426339f},
-std::array<float,2>{0.604745269f, 0.924475133f},
-std::array<float,2>{0.620599151f, 0.180213034f},
-std::array<float,2>{0.284131378f, 0.645857751f},
-std::array<float,2>{0.208968312f, 0.274346828f},
-std::array<float,2>{0.971781671f, 0.88179183f},
-std::array<float,2>{0.769734561f, 0.482359588f},
-std::array<float,2>{0.0281978101f, 0.751428783f},
-std::array<float,2>{0.410759777f, 0.0815084949f},
-std::array<float,2>{0.701082587f, 0.509107709f},
-std::array<float,2>{0.686670601f, 0.336583078f},
-std::array<float,2>{0.493150771f, 0.977468848f},
-std::array<float,2>{0.0912665948f, 0.20040457f},
-std::array<float,2>{0.815337181f, 0.727411866f},
-std::array<float,2>{0.886508346f, 0.0513268821f},
-std::array<float,2>{0.132026061f, 0.563744903f},
-std::array<float,2>{0.365643322f, 0.386658698f},
-std::array<float,2>{0.550605953f, 0.825487673f},
-std::array<float,2>{0.718882978f, 0.108021468f},
-std::array<float,2>{0.398442835f, 0.55921936f},
-std::array<float,2>{0.0539504364f, 0.467570066f},
-std::array<float,2>{0.812030256f, 0.802743077f},
-std::array<float,2>{0.954339325f, 0.299969196f},
-std::array<float,2>{0.245766774f, 0.907941818f},
-std::array<float,2>{0.269875556f, 0.150554955f},
-std::array<float,2>{0.579541266f, 0.67127645f},
-std::array<float,2>{0.527026951f, 0.430044055f},
-std::array<float,2>{0.323823363f, 0.852523625f},
-std::array<float,2>{0.173899278f, 0.0028286227f},
-std::array<float,2>{0.93525213f, 0.612231374f},
-std::array<float,2>{0.869556785f, 0.231393203f},
-std::array<float,2>{0.0994441062f, 0.700335503f},
-std::array<float,2>{0.463332832f, 0.344765663f},
-std::array<float,2>{0.625419438f, 0.959094524f},
-std::array<float,2>{0.694296479f, 0.140718684f},
-std::array<float,2>{0.414823443f, 0.659199357f},
-std::array<float,2>{0.0166034028f, 0.311876833f},
-std::array<float,2>{0.780074418f, 0.921764016f},
-std::array<float,2>{0.981241286f, 0.454163462f},
-std::array<float,2>{0.214134023f, 0.81121397f},
-std::array<float,2>{0.294096202f, 0.0988916457f},
-std::array<float,2>{0.616291106f, 0.55380255f},
-std::array<float,2>{0.559987903f, 0.358967513f},
-std::array<float,2>{0.370303601f, 0.966130376f},
-std::array<float,2>{0.140616536f, 0.222992659f},
-std::array<float,2>{0.879233778f, 0.694518983f},
-std::array<float,2>{0.826998055f, 0.00811692327f},
-std::array<float,2>{0.0800127462f, 0.624099493f},
-std::array<float,2>{0.488459796f, 0.424593687f},
-std::array<float,2>{0.674811661f, 0.843798816f},
-std::array<float,2>{0.587043643f, 0.088122867f},
-std::array<float,2>{0.279143274f, 0.502414882f},
-std::array<float,2>{0.234489501f, 0.469364464f},
-std::array<float,2>{0.962518394f, 0.759037554f},
-std::array<float,2>{0.798561513f, 0.268548012f},
-std::array<float,2>{0.0557012223f, 0.888892651f},
-std::array<float,2>{0.396867096f, 0.177423194f},
-std::array<float,2>{0.731519461f, 0.652122498f},
-std::array<float,2>{0.639492869f, 0.376725852f},
-std::array<float,2>{0.457272559f, 0.818904161f},
-std::array<float,2>{0.105831072f, 0.0560599566f},
-std::array<float,2>{0.866496384f, 0.576747477f},
-std::array<float,2>{0.928108513f, 0.193818003f},
-std::array<float,2>{0.181647241f, 0.724354625f},
-std::array<float,2>{0.317321032f, 0.329093665f},
-std::array<float,2>{0.51891309f, 0.975140572f},
-std::array<float,2>{0.504250526f, 0.241652146f},
-std::array<float,2>{0.331329942f, 0.712812364f},
-std::array<float,2>{0.16714634f, 0.368657857f},
-std::array<float,2>{0.914643884f, 0.952528775f},
-std::array<float,2>{0.845361352f, 0.417721778f},
-std::array<float,2>{0.114555597f, 0.865356088f},
-std::array<float,2>{0.440413088f, 0.0295149386f},
-std::array<float,2>{0.648543417f, 0.607657373f},
-std::array<float,2>{0.73751837f, 0.28724128f},
-std::array<float,2>{0.379706889f, 0.934761226f},
-std::array<float,2>{0.0458702184f, 0.134525031f},
-std::array<float,2>{0.789452493f, 0.685262024f},
-std::array<float,2>{0.942433298f, 0.111021675f},
-std::array<float,2>{0.225802317f, 0.534020543f},
-std::array<float,2>{0.253740281f, 0.442615777f},
-std::array<float,2>{0.563636065f, 0.795355678f},
-std::array<float,2>{0.6664415f, 0.0445965715f},
-std::array<float,2>{0.472079039f, 0.588137507f},
-std::array<float,2>{0.0666676834f, 0.401677907f},
-std::array<float,2>{0.828292191f, 0.84304893f},
-std::array<float,2>{0.891978085f, 0.320535123f},
-std::array<float,2>{0.153376088f, 0.994535744f},
-std::array<float,2>{0.347306788f, 0.209472224f},
-std::array<float,2>{0.536266685f, 0.745999038f},
-std::array<float,2>{0.600432932f, 0.497911543f},
-std::array<float,2>{0.299856514f, 0.768340826f},
-std::array<float,2>{0.197027624f, 0.0702732876f},
-std::array<float,2>{0.999978662f, 0.517237306f},
-std::array<float,2>{0.764569104f, 0.171239361f},
-std::array<float,2>{0.00195947685f, 0.632229745f},
-std::array<float,2>{0.428263813f, 0.250499606f},
-std::array<float,2>{0.703240275f, 0.902006567f},
-std::array<float,2>{0.67808336f, 0.161304459f},
-std::array<float,2>{0.486448824f, 0.634266078f},
-std::array<float,2>{0.0846069232f, 0.25914523f},
-std::array<float,2>{0.821884155f, 0.897211611f},
-std::array<float,2>{0.877137125f, 0.491546214f},
-std::array<float,2>{0.13651213f, 0.781006932f},
-std::array<float,2>{0.371136963f, 0.0767319202f},
-std::array<float,2>{0.557865202f, 0.527195394f},
-std::array<float,2>{0.609632373f, 0.312660635f},
-std::array<float,2>{0.289192647f, 0.987300217f},
-std::array<float,2>{0.216489762f, 0.211280778f},
-std::array<float,2>{0.980379403f, 0.734390259f},
-std::array<float,2>{0.776702344f, 0.0361451432f},
-std::array<float,2>{0.0220540985f, 0.582724631f},
-std::array<float,2>{0.419353724f, 0.397957474f},
-std::array<float,2>{0.688708782f, 0.830356002f},
-std::array<float,2>{0.523270071f, 0.118566476f},
-std::array<float,2>{0.315975577f, 0.541546047f},
-std::array<float,2>{0.186124012f, 0.452148497f},
-std::array<float,2>{0.925342083f, 0.781337857f},
-std::array<float,2>{0.862070918f, 0.289998353f},
-std::array<float,2>{0.102341764f, 0.927814245f},
-std::array<float,2>{0.456139803f, 0.12740168f},
-std::array<float,2>{0.633914351f, 0.675856292f},
-std::array<float,2>{0.72767818f, 0.413197249f},
-std::array<float,2>{0.392071158f, 0.874418318f},
-std::array<float,2>{0.0618367195f, 0.0175181776f},
-std::array<float,2>{0.802351773f, 0.597843468f},
-std::array<float,2>{0.966809332f, 0.245898828f},
-std::array<float,2>{0.241929337f, 0.709574461f},
-std::array<float,2>{0.275150388f, 0.362300783f},
-std::array<float,2>{0.592591703f, 0.937692285f},
-std::array<float,2>{0.56720829f, 0.195782527f},
-std::array<float,2>{0.256562144f, 0.734358311f},
-std::array<float,2>{0.221072868f, 0.340624422f},
-std::array<float,2>{0.939734876f, 0.98364532f},
-std::array<float,2>{0.796304464f, 0.387956798f},
-std::array<float,2>{0.0424608067f, 0.822203219f},
-std::array<float,2>{0.376303613f, 0.0500136726f},
-std::array<float,2>{0.742071986f, 0.568231344f},
-std::array<float,2>{0.656207621f, 0.278240979f},
-std::array<float,2>{0.44522655f, 0.877894402f},
-std::array<float,2>{0.110989355f, 0.184368834f},
-std::array<float,2>{0.850394905f, 0.643121183f},
-std::array<float,2>{0.921085715f, 0.0853740424f},
-std::array<float,2>{0.169775248f, 0.514756739f},
-std::array<float,2>{0.334835172f, 0.476674199f},
-std::array<float,2>{0.5022282f, 0.756565928f},
-std::array<float,2>{0.708159804f, 0.00513433851f},
-std::array<float,2>{0.42211163f, 0.615427077f},
-std::array<float,2>{0.00767536601f, 0.436365873f},
-std::array<float,2>{0.760050118f, 0.85795784f},
-std::array<float,2>{0.993291974f, 0.348694623f},
-std::array<float,2>{0.200309649f, 0.956477344f},
-std::array<float,2>{0.304132462f, 0.22887376f},
-std::array<float,2>{0.595453084f, 0.697317779f},
-std::array<float,2>{0.531885862f, 0.462550044f},
-std::array<float,2>{0.350013793f, 0.800512016f},
-std::array<float,2>{0.150344953f, 0.103814602f},
-std::array<float,2>{0.898227215f, 0.556044042f},
-std::array<float,2>{0.833108008f, 0.153905794f},
-std::array<float,2>{0.0643439665f, 0.666849136f},
-std::array<float,2>{0.474386245f, 0.303991348f},
-std::array<float,2>{0.668778837f, 0.91189307f},
-std::array<float,2>{0.745258749f, 0.218875706f},
-std::array<float,2>{0.387660623f, 0.69087249f},
-std::array<float,2>{0.0388109535f, 0.352354974f},
-std::array<float,2>{0.781637311f, 0.963318884f},
-std::array<float,2>{0.952444077f, 0.427794188f},
-std::array<float,2>{0.230225593f, 0.849053204f},
-std::array<float,2>{0.259468049f, 0.0125623597f},
-std::array<float,2>{0.572915554f, 0.620855153f},
-std::array<float,2>{0.510381103f, 0.305766314f},
-std::array<float,2>{0.339604974f, 0.915375233f},
-std::array<float,2>{0.160978034f, 0.147936344f},
-std::array<float,2>{0.908445179f, 0.660941303f},
-std::array<float,2>{0.854054391f, 0.0938232318f},
-std::array<float,2>{0.124268368f, 0.550239146f},
-std::array<float,2>{0.447797328f, 0.458830327f},
-std::array<float,2>{0.646052539f, 0.806445122f},
-std::array<float,2>{0.607176006f, 0.0613387153f},
-std::array<float,2>{0.310207307f, 0.572089374f},
-std::array<float,2>{0.188779458f, 0.381277531f},
-std::array<float,2>{0.9856143f, 0.816084564f},
-std::array<float,2>{0.754623532f, 0.333135515f},
-std::array<float,2>{0.00937596057f, 0.972173631f},
-std::array<float,2>{0.433308899f, 0.188588127f},
-std::array<float,2>{0.71438545f, 0.719807148f},
-std::array<float,2>{0.660585582f, 0.472791135f},
-std::array<float,2>{0.482927382f, 0.763591528f},
-std::array<float,2>{0.076789245f, 0.0912682563f},
-std::array<float,2>{0.83931011f, 0.506187677f},
-std::array<float,2>{0.900720835f, 0.174547166f},
-std::array<float,2>{0.148321807f, 0.653147459f},
-std::array<float,2>{0.35310033f, 0.269793689f},
-std::array<float,2>{0.542931795f, 0.884172499f},
-std::array<float,2>{0.551018894f, 0.138258174f},
-std::array<float,2>{0.360339761f, 0.680846035f},
-std::array<float,2>{0.12846823f, 0.28477633f},
-std::array<float,2>{0.888234138f, 0.93310231f},
-std::array<float,2>{0.818245709f, 0.438083172f},
-std::array<float,2>{0.0879135132f, 0.79006201f},
-std::array<float,2>{0.49767521f, 0.114551596f},
-std::array<float,2>{0.681279182f, 0.53820926f},
-std::array<float,2>{0.698344827f, 0.371145606f},
-std::array<float,2>{0.406614929f, 0.94839102f},
-std::array<float,2>{0.0271160211f, 0.236104965f},
-std::array<float,2>{0.769426584f, 0.716361642f},
-std::array<float,2>{0.974034071f, 0.024002241f},
-std::array<float,2>{0.203208968f, 0.603055656f},
-std::array<float,2>{0.285693884f, 0.420897454f},
-std::array<float,2>{0.622004807f, 0.862780571f},
-std::array<float,2>{0.63119489f, 0.0647774637f},
-std::array<float,2>{0.46566692f, 0.521972835f},
-std::array<float,2>{0.0969345123f, 0.492894232f},
-std::array<float,2>{0.872496665f, 0.772514045f},
-std::array<float,2>{0.931270778f, 0.256605148f},
-std::array<float,2>{0.179387927f, 0.902742803f},
-std::array<float,2>{0.327122003f, 0.165873662f},
-std::array<float,2>{0.527465582f, 0.625239015f},
-std::array<float,2>{0.583984852f, 0.405424118f},
-std::array<float,2>{0.268381417f, 0.838503718f},
-std::array<float,2>{0.246938035f, 0.0395010002f},
-std::array<float,2>{0.959773958f, 0.593365192f},
-std::array<float,2>{0.807604373f, 0.20312883f},
-std::array<float,2>{0.0499833636f, 0.746695936f},
-std::array<float,2>{0.402920634f, 0.326861113f},
-std::array<float,2>{0.726214945f, 0.998614848f},
-std::array<float,2>{0.683713019f, 0.199597716f},
-std::array<float,2>{0.495277911f, 0.728079915f},
-std::array<float,2>{0.0929315537f, 0.337156802f},
-std::array<float,2>{0.814001143f, 0.977747083f},
-std::array<float,2>{0.88303113f, 0.385079205f},
-std::array<float,2>{0.129627004f, 0.82507652f},
-std::array<float,2>{0.364824355f, 0.0520327389f},
-std::array<float,2>{0.547840655f, 0.563043475f},
-std::array<float,2>{0.617474735f, 0.274681538f},
-std::array<float,2>{0.28186053f, 0.881906986f},
-std::array<float,2>{0.209403723f, 0.181344837f},
-std::array<float,2>{0.970415711f, 0.645463765f},
-std::array<float,2>{0.772261977f, 0.0804286152f},
-std::array<float,2>{0.0308481436f, 0.508557916f},
-std::array<float,2>{0.413535476f, 0.480789512f},
-std::array<float,2>{0.702996612f, 0.750658214f},
-std::array<float,2>{0.524654269f, 0.00374856824f},
-std::array<float,2>{0.321064949f, 0.612334967f},
-std::array<float,2>{0.172251448f, 0.431271017f},
-std::array<float,2>{0.936879933f, 0.853217542f},
-std::array<float,2>{0.869036794f, 0.344131678f},
-std::array<float,2>{0.100490212f, 0.960589349f},
-std::array<float,2>{0.462774247f, 0.231498316f},
-std::array<float,2>{0.628718019f, 0.700184822f},
-std::array<float,2>{0.722108066f, 0.468242198f},
-std::array<float,2>{0.401084989f, 0.803836226f},
-std::array<float,2>{0.050842572f, 0.108578764f},
-std::array<float,2>{0.810015857f, 0.560397446f},
-std::array<float,2>{0.955123186f, 0.151447728f},
-std::array<float,2>{0.24402307f, 0.670708001f},
-std::array<float,2>{0.272036999f, 0.29919675f},
-std::array<float,2>{0.581926167f, 0.906912982f},
-std::array<float,2>{0.575430095f, 0.156766936f},
-std::array<float,2>{0.262664765f, 0.639579237f},
-std::array<float,2>{0.23369664f, 0.263033211f},
-std::array<float,2>{0.948271871f, 0.891909778f},
-std::array<float,2>{0.786815047f, 0.487346858f},
-std::array<float,2>{0.0343580991f, 0.77555263f},
-std::array<float,2>{0.382961243f, 0.0730492771f},
-std::array<float,2>{0.749522984f, 0.529299676f},
-std::array<float,2>{0.643211484f, 0.319684237f},
-std::array<float,2>{0.452811033f, 0.991346657f},
-std::array<float,2>{0.117468685f, 0.216969341f},
-std::array<float,2>{0.856012881f, 0.741191208f},
-std::array<float,2>{0.9138183f, 0.0327687077f},
-std::array<float,2>{0.157840967f, 0.578524351f},
-std::array<float,2>{0.343324542f, 0.390644968f},
-std::array<float,2>{0.515525222f, 0.834857404f},
-std::array<float,2>{0.716517329f, 0.121716835f},
-std::array<float,2>{0.435288101f, 0.543674648f},
-std::array<float,2>{0.0118537992f, 0.448709786f},
-std::array<float,2>{0.75385505f, 0.788638651f},
-std::array<float,2>{0.991838694f, 0.296089292f},
-std::array<float,2>{0.194560856f, 0.925312817f},
-std::array<float,2>{0.308047026f, 0.132369265f},
-std::array<float,2>{0.603283823f, 0.674342096f},
-std::array<float,2>{0.545967042f, 0.408655256f},
-std::array<float,2>{0.358710498f, 0.867923677f},
-std::array<float,2>{0.144440472f, 0.0229602754f},
-std::array<float,2>{0.90265733f, 0.594322264f},
-std::array<float,2>{0.8404634f, 0.248769671f},
-std::array<float,2>{0.0704057813f, 0.704183638f},
-std::array<float,2>{0.479478151f, 0.365033954f},
-std::array<float,2>{0.656797767f, 0.942889392f},
-std::array<float,2>{0.735158741f, 0.133533925f},
-std::array<float,2>{0.381589264f, 0.683678865f},
-std::array<float,2>{0.0431418046f, 0.289034039f},
-std::array<float,2>{0.791753054f, 0.933929205f},
-std::array<float,2>{0.944838047f, 0.44237116f},
-std::array<float,2>{0.223005682f, 0.795944214f},
-std::array<float,2>{0.250301272f, 0.109790228f},
-std::array<float,2>{0.564920664f, 0.534920216f},
-std::array<float,2>{0.507115901f, 0.367693424f},
-std::array<float,2>{0.328714967f, 0.951759636f},
-std::array<float,2>{0.164519995f, 0.240652159f},
-std::array<float,2>{0.917237282f, 0.711221933f},
-std::array<float,2>{0.846470356f, 0.0307193045f},
-std::array<float,2>{0.116021402f, 0.609174609f},
-std::array<float,2>{0.439280003f, 0.416212231f},
-std::array<float,2>{0.651633739f, 0.867149889f},
-std::array<float,2>{0.599385083f, 0.0684783757f},
-std::array<float,2>{0.297225147f, 0.515675962f},
-std::array<float,2>{0.199133977f, 0.496664405f},
-std::array<float,2>{0.997510314f, 0.769252717f},
-std::array<float,2>{0.762491405f, 0.251016378f},
-std::array<float,2>{0.000362936291f, 0.900542736f},
-std::array<float,2>{0.427310646f, 0.170397684f},
-std::array<float,2>{0.705507457f, 0.631355941f},
-std::array<float,2>{0.66543746f, 0.401072741f},
-std::array<float,2>{0.469742775f, 0.842077434f},
-std::array<float,2>{0.068619296f, 0.0431421213f},
-std::array<float,2>{0.831759453f, 0.58957392f},
-std::array<float,2>{0.894050539f, 0.210469231f},
-std::array<float,2>{0.155645981f, 0.744864106f},
-std::array<float,2>{0.344848692f, 0.321584404f},
-std::array<float,2>{0.537422657f, 0.99597621f},
-std::array<float,2>{0.561240911f, 0.224176243f},
-std::array<float,2>{0.368059605f, 0.693870902f},
-std::array<float,2>{0.137791455f, 0.357523292f},
-std::array<float,2>{0.882720411f, 0.964978993f},
-std::array<float,2>{0.824574292f, 0.425353825f},
-std::array<float,2>{0.082007505f, 0.84510833f},
-std::array<float,2>{0.490683049f, 0.00888942461f},
-std::array<float,2>{0.672246873f, 0.623452187f},
-std::array<float,2>{0.692435563f, 0.311140954f},
-std::array<float,2>{0.41623807f, 0.920818925f},
-std::array<float,2>{0.0184137803f, 0.142400965f},
-std::array<float,2>{0.777815759f, 0.658566713f},
-std::array<float,2>{0.983940005f, 0.0981528684f},
-std::array<float,2>{0.211582989f, 0.553579628f},
-std::array<float,2>{0.295075566f, 0.45378387f},
-std::array<float,2>{0.613873959f, 0.81156981f},
-std::array<float,2>{0.636746287f, 0.0551038384f},
-std::array<float,2>{0.460931718f, 0.577725947f},
-std::array<float,2>{0.107483685f, 0.375323147f},
-std::array<float,2>{0.865199804f, 0.81989938f},
-std::array<float,2>{0.927329898f, 0.32972309f},
-std::array<float,2>{0.180836558f, 0.975622952f},
-std::array<float,2>{0.319117248f, 0.19527784f},
-std::array<float,2>{0.516702831f, 0.722963154f},
-std::array<float,2>{0.588007569f, 0.469745219f},
-std::array<float,2>{0.279461056f, 0.75811404f},
-std::array<float,2>{0.237125054f, 0.0890060067f},
-std::array<float,2>{0.964200914f, 0.50304842f},
-std::array<float,2>{0.799686849f, 0.176116496f},
-std::array<float,2>{0.0582845323f, 0.650493085f},
-std::array<float,2>{0.394747972f, 0.268647611f},
-std::array<float,2>{0.732943296f, 0.890243232f},
-std::array<float,2>{0.652608037f, 0.184612125f},
-std::array<float,2>{0.442860425f, 0.644527853f},
-std::array<float,2>{0.111977704f, 0.2788046f},
-std::array<float,2>{0.849088907f, 0.878187418f},
-std::array<float,2>{0.919793427f, 0.478500336f},
-std::array<float,2>{0.170592949f, 0.756886065f},
-std::array<float,2>{0.332687765f, 0.0845061839f},
-std::array<float,2>{0.500684917f, 0.514640808f},
-std::array<float,2>{0.5683617f, 0.341573209f},
-std::array<float,2>{0.254622608f, 0.983175814f},
-std::array<float,2>{0.219277874f, 0.196629852f},
-std::array<float,2>{0.937805831f, 0.732561886f},
-std::array<float,2>{0.794124782f, 0.0490058288f},
-std::array<float,2>{0.0408815257f, 0.56670022f},
-std::array<float,2>{0.378764719f, 0.387564898f},
-std::array<float,2>{0.738815904f, 0.820575535f},
-std::array<float,2>{0.533864439f, 0.105412312f},
-std::array<float,2>{0.349605769f, 0.555241048f},
-std::array<float,2>{0.151442558f, 0.461312681f},
-std::array<float,2>{0.895453215f, 0.799520195f},
-std::array<float,2>{0.834632099f, 0.302811205f},
-std::array<float,2>{0.0646774396f, 0.911075234f},
-std::array<float,2>{0.476244152f, 0.152719125f},
-std::array<float,2>{0.670926034f, 0.667853773f},
-std::array<float,2>{0.710743487f, 0.437182724f},
-std::array<float,2>{0.425043553f, 0.858768284f},
-std::array<float,2>{0.00481527159f, 0.00409872318f},
-std::array<float,2>{0.759399831f, 0.617181897f},
-std::array<float,2>{0.995352268f, 0.229528844f},
-std::array<float,2>{0.20254384f, 0.698761344f},
-std::array<float,2>{0.301575273f, 0.348232448f},
-std::array<float,2>{0.595715404f, 0.955946803f},
-std::array<float,2>{0.61189425f, 0.21207419f},
-std::array<float,2>{0.292232484f, 0.735363066f},
-std::array<float,2>{0.216971338f, 0.313912332f},
-std::array<float,2>{0.977907479f, 0.98757565f},
-std::array<float,2>{0.775014699f, 0.396773964f},
-std::array<float,2>{0.0210451409f, 0.831789732f},
-std::array<float,2>{0.420420766f, 0.0358622f},
-std::array<float,2>{0.690604687f, 0.583163857f},
-std::array<float,2>{0.677074671f, 0.258408844f},
-std::array<float,2>{0.484555453f, 0.897815168f},
-std::array<float,2>{0.082526803f, 0.160934553f},
-std::array<float,2>{0.824094176f, 0.633257985f},
-std::array<float,2>{0.876755297f, 0.0773738921f},
-std::array<float,2>{0.133152723f, 0.525831759f},
-std::array<float,2>{0.373355389f, 0.491169244f},
-std::array<float,2>{0.554883182f, 0.779781699f},
-std::array<float,2>{0.730020165f, 0.0160594117f},
-std::array<float,2>{0.392887771f, 0.599228799f},
-std::array<float,2>{0.0588943549f, 0.412603676f},
-std::array<float,2>{0.80404073f, 0.873400688f},
-std::array<float,2>{0.96591562f, 0.362632602f},
-std::array<float,2>{0.238842234f, 0.93903029f},
-std::array<float,2>{0.276261687f, 0.244315132f},
-std::array<float,2>{0.591013134f, 0.710280657f},
-std::array<float,2>{0.520143211f, 0.451376021f},
-std::array<float,2>{0.314318687f, 0.782987833f},
-std::array<float,2>{0.185455993f, 0.117307112f},
-std::array<float,2>{0.923465371f, 0.542090178f},
-std::array<float,2>{0.861267209f, 0.128010601f},
-std::array<float,2>{0.105450734f, 0.676964521f},
-std::array<float,2>{0.454716355f, 0.290590674f},
-std::array<float,2>{0.635256231f, 0.92939651f},
-std::array<float,2>{0.697113454f, 0.235324115f},
-std::array<float,2>{0.40863654f, 0.714960754f},
-std::array<float,2>{0.023978563f, 0.372703195f},
-std::array<float,2>{0.76689744f, 0.947901845f},
-std::array<float,2>{0.975745201f, 0.4212659f},
-std::array<float,2>{0.205700323f, 0.861545086f},
-std::array<float,2>{0.287163645f, 0.0251870528f},
-std::array<float,2>{0.624009609f, 0.601698399f},
-std::array<float,2>{0.554206848f, 0.283236146f},
-std::array<float,2>{0.361832887f, 0.931760848f},
-std::array<float,2>{0.126372203f, 0.137600645f},
-std::array<float,2>{0.889179468f, 0.679899693f},
-std::array<float,2>{0.818962097f, 0.113545164f},
-std::array<float,2>{0.0873086303f, 0.537667274f},
-std::array<float,2>{0.499056369f, 0.43910867f},
-std::array<float,2>{0.682411194f, 0.78953582f},
-std::array<float,2>{0.582385898f, 0.0409651585f},
-std::array<float,2>{0.265778452f, 0.592252672f},
-std::array<float,2>{0.248951733f, 0.404319078f},
-std::array<float,2>{0.958446085f, 0.839329004f},
-std::array<float,2>{0.806385636f, 0.327274054f},
-std::array<float,2>{0.0484600961f, 0.999282718f},
-std::array<float,2>{0.405958176f, 0.20456481f},
-std::array<float,2>{0.72432977f, 0.747361004f},
-std::array<float,2>{0.630156696f, 0.4934012f},
-std::array<float,2>{0.468669802f, 0.772130609f},
-std::array<float,2>{0.0940967202f, 0.0654965565f},
-std::array<float,2>{0.873511851f, 0.52275002f},
-std::array<float,2>{0.932132721f, 0.164184362f},
-std::array<float,2>{0.177524507f, 0.626622379f},
-std::array<float,2>{0.325287461f, 0.257330626f},
-std::array<float,2>{0.530961037f, 0.903510392f},
-std::array<float,2>{0.508575797f, 0.147335708f},
-std::array<float,2>{0.337031364f, 0.661977112f},
-std::array<float,2>{0.163937196f, 0.305364519f},
-std::array<float,2>{0.906610131f, 0.914450109f},
-std::array<float,2>{0.851651728f, 0.457410157f},
-std::array<float,2>{0.121956944f, 0.805139303f},
-std::array<float,2>{0.446385026f, 0.0952772573f},
-std::array<float,2>{0.647277653f, 0.548871636f},
-std::array<float,2>{0.743966162f, 0.35308516f},
-std::array<float,2>{0.388948262f, 0.964419305f},
-std::array<float,2>{0.0356895663f, 0.219826475f},
-std::array<float,2>{0.784362197f, 0.689771175f},
-std::array<float,2>{0.950445712f, 0.0127418702f},
-std::array<float,2>{0.227939621f, 0.619727135f},
-std::array<float,2>{0.260293961f, 0.429160863f},
-std::array<float,2>{0.571989417f, 0.847893178f},
-std::array<float,2>{0.662141383f, 0.0900007412f},
-std::array<float,2>{0.481455326f, 0.506975472f},
-std::array<float,2>{0.0760219544f, 0.473826021f},
-std::array<float,2>{0.837242246f, 0.761824071f},
-std::array<float,2>{0.900344431f, 0.2707178f},
-std::array<float,2>{0.14592427f, 0.883123994f},
-std::array<float,2>{0.355026484f, 0.175503835f},
-std::array<float,2>{0.540831566f, 0.653718889f},
-std::array<float,2>{0.607744455f, 0.381877571f},
-std::array<float,2>{0.31100896f, 0.815400422f},
-std::array<float,2>{0.190283403f, 0.0623391159f},
-std::array<float,2>{0.987517536f, 0.570933521f},
-std::array<float,2>{0.756850004f, 0.187711239f},
-std::array<float,2>{0.010365882f, 0.718840778f},
-std::array<float,2>{0.429804087f, 0.332990736f},
-std::array<float,2>{0.711599767f, 0.971047044f},
-std::array<float,2>{0.626089931f, 0.234255269f},
-std::array<float,2>{0.464176029f, 0.701514006f},
-std::array<float,2>{0.0978306383f, 0.346778691f},
-std::array<float,2>{0.870335281f, 0.958973944f},
-std::array<float,2>{0.933750749f, 0.433247775f},
-std::array<float,2>{0.174821213f, 0.855285883f},
-std::array<float,2>{0.322697073f, 4.16613548e-05f},
-std::array<float,2>{0.525661409f, 0.611285627f},
-std::array<float,2>{0.578281522f, 0.297951698f},
-std::array<float,2>{0.270572126f, 0.91000843f},
-std::array<float,2>{0.244199932f, 0.149407908f},
-std::array<float,2>{0.953262389f, 0.669006169f},
-std::array<float,2>{0.811160743f, 0.107347786f},
-std::array<float,2>{0.0529271439f, 0.561421573f},
-std::array<float,2>{0.399818361f, 0.466477513f},
-std::array<float,2>{0.720220566f, 0.802188218f},
-std::array<float,2>{0.549376249f, 0.0544399135f},
-std::array<float,2>{0.366946399f, 0.56472981f},
-std::array<float,2>{0.13087523f, 0.384161919f},
-std::array<float,2>{0.885319769f, 0.826668024f},
-std::array<float,2>{0.816040456f, 0.33812356f},
-std::array<float,2>{0.0905705765f, 0.980166495f},
-std::array<float,2>{0.49392581f, 0.202432245f},
-std::array<float,2>{0.686469674f, 0.730037034f},
-std::array<float,2>{0.699684143f, 0.483567506f},
-std::array<float,2>{0.411551535f, 0.752099693f},
-std::array<float,2>{0.0288606156f, 0.0798168853f},
-std::array<float,2>{0.770840287f, 0.510360241f},
-std::array<float,2>{0.971242309f, 0.181883931f},
-std::array<float,2>{0.20771496f, 0.647514343f},
-std::array<float,2>{0.28455478f, 0.27722919f},
-std::array<float,2>{0.61955452f, 0.880482614f},
-std::array<float,2>{0.604094148f, 0.129616126f},
-std::array<float,2>{0.305399984f, 0.672283828f},
-std::array<float,2>{0.192986161f, 0.293689817f},
-std::array<float,2>{0.990175486f, 0.923688173f},
-std::array<float,2>{0.750566185f, 0.446929246f},
-std::array<float,2>{0.0154613992f, 0.785602391f},
-std::array<float,2>{0.436460674f, 0.124279089f},
-std::array<float,2>{0.717443466f, 0.545397818f},
-std::array<float,2>{0.659329951f, 0.365983784f},
-std::array<float,2>{0.477208555f, 0.944040358f},
-std::array<float,2>{0.0724174157f, 0.248009548f},
-std::array<float,2>{0.842756629f, 0.706402004f},
-std::array<float,2>{0.905679286f, 0.0209785793f},
-std::array<float,2>{0.141249731f, 0.597385168f},
-std::array<float,2>{0.356120795f, 0.407980263f},
-std::array<float,2>{0.543777168f, 0.870779991f},
-std::array<float,2>{0.746977746f, 0.0722204968f},
-std::array<float,2>{0.385565341f, 0.527916551f},
-std::array<float,2>{0.0322069414f, 0.485261708f},
-std::array<float,2>{0.78808552f, 0.773534775f},
-std::array<float,2>{0.947176218f, 0.265308738f},
-std::array<float,2>{0.231986731f, 0.892637849f},
-std::array<float,2>{0.265057713f, 0.158933565f},
-std::array<float,2>{0.576877356f, 0.637991548f},
-std::array<float,2>{0.512021363f, 0.394061089f},
-std::array<float,2>{0.341692805f, 0.832238436f},
-std::array<float,2>{0.15840596f, 0.0345647223f},
-std::array<float,2>{0.910585761f, 0.581385195f},
-std::array<float,2>{0.858151734f, 0.215124026f},
-std::array<float,2>{0.120724551f, 0.73897922f},
-std::array<float,2>{0.450348645f, 0.317350894f},
-std::array<float,2>{0.641622484f, 0.989320934f},
-std::array<float,2>{0.704317927f, 0.168803632f},
-std::array<float,2>{0.429633141f, 0.62915343f},
-std::array<float,2>{0.00375799183f, 0.253341645f},
-std::array<float,2>{0.765466511f, 0.899676859f},
-std::array<float,2>{0.998538554f, 0.49914214f},
-std::array<float,2>{0.195714504f, 0.766275764f},
-std::array<float,2>{0.29903239f, 0.0671505481f},
-std::array<float,2>{0.601064861f, 0.519317329f},
-std::array<float,2>{0.535578549f, 0.322789073f},
-std::array<float,2>{0.346134424f, 0.993290484f},
-std::array<float,2>{0.152473584f, 0.20813714f},
-std::array<float,2>{0.890930593f, 0.744033992f},
-std::array<float,2>{0.829114079f, 0.0460224114f},
-std::array<float,2>{0.0683031082f, 0.587024927f},
-std::array<float,2>{0.471186876f, 0.399161786f},
-std::array<float,2>{0.667965949f, 0.841199636f},
-std::array<float,2>{0.563160598f, 0.111548923f},
-std::array<float,2>{0.252033174f, 0.532461047f},
-std::array<float,2>{0.224954098f, 0.445272923f},
-std::array<float,2>{0.941449225f, 0.793491066f},
-std::array<float,2>{0.790728033f, 0.286334932f},
-std::array<float,2>{0.0461059399f, 0.935918748f},
-std::array<float,2>{0.380795747f, 0.135278448f},
-std::array<float,2>{0.7366907f, 0.686178207f},
-std::array<float,2>{0.650116384f, 0.415328622f},
-std::array<float,2>{0.440934956f, 0.864695609f},
-std::array<float,2>{0.114141338f, 0.0285416096f},
-std::array<float,2>{0.844531357f, 0.60664165f},
-std::array<float,2>{0.915889323f, 0.239660636f},
-std::array<float,2>{0.166423604f, 0.714394152f},
-std::array<float,2>{0.330981046f, 0.369751155f},
-std::array<float,2>{0.505812943f, 0.949929535f},
-std::array<float,2>{0.517785907f, 0.193287507f},
-std::array<float,2>{0.317440331f, 0.725221634f},
-std::array<float,2>{0.182644904f, 0.330670953f},
-std::array<float,2>{0.929302752f, 0.973809242f},
-std::array<float,2>{0.8661201f, 0.377278358f},
-std::array<float,2>{0.107307598f, 0.818267524f},
-std::array<float,2>{0.458450675f, 0.0573990457f},
-std::array<float,2>{0.640093267f, 0.575234234f},
-std::array<float,2>{0.730993152f, 0.266663432f},
-std::array<float,2>{0.398214012f, 0.88835305f},
-std::array<float,2>{0.0554397292f, 0.178225204f},
-std::array<float,2>{0.797198474f, 0.648810208f},
-std::array<float,2>{0.961405754f, 0.0875102729f},
-std::array<float,2>{0.235924169f, 0.500533283f},
-std::array<float,2>{0.277638406f, 0.471846789f},
-std::array<float,2>{0.586725116f, 0.760321677f},
-std::array<float,2>{0.674718201f, 0.0101363789f},
-std::array<float,2>{0.489879638f, 0.621713102f},
-std::array<float,2>{0.078513898f, 0.423515111f},
-std::array<float,2>{0.828053415f, 0.846522033f},
-std::array<float,2>{0.880526185f, 0.356851518f},
-std::array<float,2>{0.138681993f, 0.967905104f},
-std::array<float,2>{0.36999622f, 0.226285636f},
-std::array<float,2>{0.559286177f, 0.692719877f},
-std::array<float,2>{0.615840852f, 0.455148399f},
-std::array<float,2>{0.293102473f, 0.809577405f},
-std::array<float,2>{0.213129669f, 0.100894228f},
-std::array<float,2>{0.981471121f, 0.551815748f},
-std::array<float,2>{0.780317128f, 0.144181997f},
-std::array<float,2>{0.0161725543f, 0.657046914f},
-std::array<float,2>{0.416007459f, 0.308811516f},
-std::array<float,2>{0.694586575f, 0.91913873f},
-std::array<float,2>{0.669556379f, 0.155968532f},
-std::array<float,2>{0.473169118f, 0.664524019f},
-std::array<float,2>{0.0626555085f, 0.301328719f},
-std::array<float,2>{0.832736671f, 0.913463533f},
-std::array<float,2>{0.897387922f, 0.463378191f},
-std::array<float,2>{0.148789287f, 0.79818511f},
-std::array<float,2>{0.351342916f, 0.101921149f},
-std::array<float,2>{0.533041835f, 0.558145046f},
-std::array<float,2>{0.594363034f, 0.35125649f},
-std::array<float,2>{0.303487957f, 0.954538226f},
-std::array<float,2>{0.200172916f, 0.227684453f},
-std::array<float,2>{0.992781639f, 0.695427954f},
-std::array<float,2>{0.761072934f, 0.006998647f},
-std::array<float,2>{0.00612355117f, 0.615091324f},
-std::array<float,2>{0.423491359f, 0.434542865f},
-std::array<float,2>{0.707109153f, 0.857310712f},
-std::array<float,2>{0.503706336f, 0.0834241062f},
-std::array<float,2>{0.335744649f, 0.512162566f},
-std::array<float,2>{0.168088153f, 0.479113996f},
-std::array<float,2>{0.920870483f, 0.754808664f},
-std::array<float,2>{0.851123333f, 0.280395329f},
-std::array<float,2>{0.110211298f, 0.875238717f},
-std::array<float,2>{0.444229841f, 0.18740797f},
-std::array<float,2>{0.654789269f, 0.641516387f},
-std::array<float,2>{0.740438342f, 0.390402287f},
-std::array<float,2>{0.375665843f, 0.82281965f},
-std::array<float,2>{0.0412472486f, 0.0478347167f},
-std::array<float,2>{0.795898199f, 0.569856286f},
-std::array<float,2>{0.940876186f, 0.199106067f},
-std::array<float,2>{0.221844122f, 0.730485737f},
-std::array<float,2>{0.257379323f, 0.342774779f},
-std::array<float,2>{0.56790489f, 0.98178041f},
-std::array<float,2>{0.593353868f, 0.243056834f},
-std::array<float,2>{0.274188757f, 0.708114207f},
-std::array<float,2>{0.241080537f, 0.360952556f},
-std::array<float,2>{0.967915535f, 0.941270232f},
-std::array<float,2>{0.801418126f, 0.411767364f},
-std::array<float,2>{0.0610516407f, 0.872170627f},
-std::array<float,2>{0.390984714f, 0.0176522899f},
-std::array<float,2>{0.726616502f, 0.600058258f},
-std::array<float,2>{0.633612096f, 0.292753935f},
-std::array<float,2>{0.455952704f, 0.92598474f},
-std::array<float,2>{0.102963559f, 0.126532957f},
-std::array<float,2>{0.863199711f, 0.677953362f},
-std::array<float,2>{0.924304128f, 0.120066665f},
-std::array<float,2>{0.186532676f, 0.539845169f},
-std::array<float,2>{0.314493448f, 0.449637115f},
-std::array<float,2>{0.521519244f, 0.784984708f},
-std::array<float,2>{0.687544823f, 0.0387379676f},
-std::array<float,2>{0.418343365f, 0.585572898f},
-std::array<float,2>{0.0232038945f, 0.394903839f},
-std::array<float,2>{0.775790989f, 0.828670382f},
-std::array<float,2>{0.979340553f, 0.316351801f},
-std::array<float,2>{0.215620264f, 0.986009657f},
-std::array<float,2>{0.290774524f, 0.214080408f},
-std::array<float,2>{0.611026824f, 0.737022161f},
-std::array<float,2>{0.557439685f, 0.489602208f},
-std::array<float,2>{0.372386485f, 0.777926326f},
-std::array<float,2>{0.135029048f, 0.0743923858f},
-std::array<float,2>{0.878350496f, 0.524612188f},
-std::array<float,2>{0.820361733f, 0.162340567f},
-std::array<float,2>{0.0849886462f, 0.635450482f},
-std::array<float,2>{0.487726778f, 0.260611594f},
-std::array<float,2>{0.678855598f, 0.895860493f},
-std::array<float,2>{0.725474238f, 0.206060588f},
-std::array<float,2>{0.403810233f, 0.74843353f},
-std::array<float,2>{0.0496487431f, 0.32492733f},
-std::array<float,2>{0.807901144f, 0.996679783f},
-std::array<float,2>{0.960907042f, 0.403151274f},
-std::array<float,2>{0.247459665f, 0.836242735f},
-std::array<float,2>{0.269454122f, 0.0425413474f},
-std::array<float,2>{0.585020721f, 0.590940416f},
-std::array<float,2>{0.528499007f, 0.255624771f},
-std::array<float,2>{0.327259064f, 0.905533969f},
-std::array<float,2>{0.178695992f, 0.167944297f},
-std::array<float,2>{0.930262089f, 0.627187669f},
-std::array<float,2>{0.871726632f, 0.064089261f},
-std::array<float,2>{0.0964362919f, 0.519662797f},
-std::array<float,2>{0.466275841f, 0.494629145f},
-std::array<float,2>{0.632742941f, 0.771161258f},
-std::array<float,2>{0.623037159f, 0.027024962f},
-std::array<float,2>{0.286320984f, 0.605142415f},
-std::array<float,2>{0.204301551f, 0.418989807f},
-std::array<float,2>{0.973416507f, 0.859750569f},
-std::array<float,2>{0.768361926f, 0.37340343f},
-std::array<float,2>{0.0257134885f, 0.946100652f},
-std::array<float,2>{0.407289773f, 0.236436456f},
-std::array<float,2>{0.698179603f, 0.718515277f},
-std::array<float,2>{0.679745734f, 0.440381408f},
-std::array<float,2>{0.496550709f, 0.792251229f},
-std::array<float,2>{0.0891978145f, 0.115456946f},
-std::array<float,2>{0.816924393f, 0.536016941f},
-std::array<float,2>{0.887525499f, 0.139467746f},
-std::array<float,2>{0.127013609f, 0.682944715f},
-std::array<float,2>{0.361254871f, 0.281569541f},
-std::array<float,2>{0.55218482f, 0.930080175f},
-std::array<float,2>{0.541887999f, 0.17309472f},
-std::array<float,2>{0.351718068f, 0.655447841f},
-std::array<float,2>{0.147293046f, 0.272309661f},
-std::array<float,2>{0.90208602f, 0.885673106f},
-std::array<float,2>{0.838058472f, 0.475788265f},
-std::array<float,2>{0.0775766075f, 0.765059412f},
-std::array<float,2>{0.483908266f, 0.0935846418f},
-std::array<float,2>{0.661943913f, 0.505838215f},
-std::array<float,2>{0.713271081f, 0.33398506f},
-std::array<float,2>{0.432099491f, 0.970333993f},
-std::array<float,2>{0.00803956669f, 0.18970947f},
-std::array<float,2>{0.755663931f, 0.722351849f},
-std::array<float,2>{0.984391749f, 0.0591568463f},
-std::array<float,2>{0.187760144f, 0.574209452f},
-std::array<float,2>{0.309467405f, 0.379297793f},
-std::array<float,2>{0.605541587f, 0.812845707f},
-std::array<float,2>{0.645176172f, 0.0957158208f},
-std::array<float,2>{0.448705673f, 0.548277199f},
-std::array<float,2>{0.123406678f, 0.460743874f},
-std::array<float,2>{0.85497123f, 0.808008373f},
-std::array<float,2>{0.909848392f, 0.307042927f},
-std::array<float,2>{0.161850423f, 0.916525364f},
-std::array<float,2>{0.338028908f, 0.145426288f},
-std::array<float,2>{0.511220157f, 0.663896501f},
-std::array<float,2>{0.57325393f, 0.426270574f},
-std::array<float,2>{0.258484483f, 0.850886106f},
-std::array<float,2>{0.229287222f, 0.0154505866f},
-std::array<float,2>{0.951376498f, 0.617561042f},
-std::array<float,2>{0.783103704f, 0.221140027f},
-std::array<float,2>{0.0373698175f, 0.688593149f},
-std::array<float,2>{0.387796432f, 0.354929984f},
-std::array<float,2>{0.744958878f, 0.962603152f},
-std::array<float,2>{0.672478199f, 0.22573173f},
-std::array<float,2>{0.49108839f, 0.693156779f},
-std::array<float,2>{0.0812682286f, 0.357019275f},
-std::array<float,2>{0.825032771f, 0.96831876f},
-std::array<float,2>{0.882318854f, 0.423157156f},
-std::array<float,2>{0.138386384f, 0.846039116f},
-std::array<float,2>{0.367465079f, 0.0106655415f},
-std::array<float,2>{0.561019659f, 0.621536732f},
-std::array<float,2>{0.613292992f, 0.309274852f},
-std::array<float,2>{0.2957699f, 0.919769228f},
-std::array<float,2>{0.211366564f, 0.14365913f},
-std::array<float,2>{0.983719885f, 0.656283379f},
-std::array<float,2>{0.778061628f, 0.101453967f},
-std::array<float,2>{0.0178161245f, 0.552600682f},
-std::array<float,2>{0.416745901f, 0.455766052f},
-std::array<float,2>{0.693059444f, 0.810493529f},
-std::array<float,2>{0.517368317f, 0.0569634661f},
-std::array<float,2>{0.318604141f, 0.576020896f},
-std::array<float,2>{0.181294695f, 0.377515227f},
-std::array<float,2>{0.927225113f, 0.81768316f},
-std::array<float,2>{0.864430189f, 0.330419302f},
-std::array<float,2>{0.108368337f, 0.974598348f},
-std::array<float,2>{0.460304677f, 0.19262585f},
-std::array<float,2>{0.637595057f, 0.724828243f},
-std::array<float,2>{0.732536912f, 0.47229141f},
-std::array<float,2>{0.395106882f, 0.759930372f},
-std::array<float,2>{0.0580039881f, 0.0869823471f},
-std::array<float,2>{0.799050152f, 0.50043112f},
-std::array<float,2>{0.964399755f, 0.178209364f},
-std::array<float,2>{0.236697644f, 0.649382234f},
-std::array<float,2>{0.280241549f, 0.267260611f},
-std::array<float,2>{0.588600993f, 0.888180315f},
-std::array<float,2>{0.565375566f, 0.13519074f},
-std::array<float,2>{0.250657082f, 0.685979187f},
-std::array<float,2>{0.223212987f, 0.286829114f},
-std::array<float,2>{0.944601417f, 0.93630451f},
-std::array<float,2>{0.791448474f, 0.444384724f},
-std::array<float,2>{0.043676164f, 0.793320954f},
-std::array<float,2>{0.381048054f, 0.112199649f},
-std::array<float,2>{0.734691918f, 0.532984436f},
-std::array<float,2>{0.652207136f, 0.369256884f},
-std::array<float,2>{0.438675284f, 0.949642181f},
-std::array<float,2>{0.115632497f, 0.24018544f},
-std::array<float,2>{0.846034825f, 0.714107633f},
-std::array<float,2>{0.917844236f, 0.0292146001f},
-std::array<float,2>{0.164580256f, 0.607023776f},
-std::array<float,2>{0.328312695f, 0.415954769f},
-std::array<float,2>{0.507705271f, 0.865110278f},
-std::array<float,2>{0.705645621f, 0.0667274073f},
-std::array<float,2>{0.426941901f, 0.518690407f},
-std::array<float,2>{0.000644426967f, 0.499883801f},
-std::array<float,2>{0.761824965f, 0.765901089f},
-std::array<float,2>{0.99799186f, 0.253760099f},
-std::array<float,2>{0.198572233f, 0.899958789f},
-std::array<float,2>{0.297838897f, 0.168089613f},
-std::array<float,2>{0.59889257f, 0.629847169f},
-std::array<float,2>{0.537666142f, 0.398740917f},
-std::array<float,2>{0.345667988f, 0.841508806f},
-std::array<float,2>{0.156066239f, 0.0467443317f},
-std::array<float,2>{0.893600881f, 0.587855995f},
-std::array<float,2>{0.831279874f, 0.208873853f},
-std::array<float,2>{0.069043532f, 0.743608534f},
-std::array<float,2>{0.470488071f, 0.322684407f},
-std::array<float,2>{0.665820658f, 0.993983567f},
-std::array<float,2>{0.749225855f, 0.158269614f},
-std::array<float,2>{0.383411735f, 0.638466299f},
-std::array<float,2>{0.0347925834f, 0.264875382f},
-std::array<float,2>{0.786139846f, 0.893493474f},
-std::array<float,2>{0.949053407f, 0.484531254f},
-std::array<float,2>{0.23428455f, 0.774112761f},
-std::array<float,2>{0.261836201f, 0.0714921802f},
-std::array<float,2>{0.575972378f, 0.527723551f},
-std::array<float,2>{0.514845133f, 0.316485077f},
-std::array<float,2>{0.342806578f, 0.990045249f},
-std::array<float,2>{0.157607138f, 0.215787351f},
-std::array<float,2>{0.913305521f, 0.738368809f},
-std::array<float,2>{0.855898499f, 0.035143055f},
-std::array<float,2>{0.118132792f, 0.581590533f},
-std::array<float,2>{0.45227167f, 0.393953472f},
-std::array<float,2>{0.642751932f, 0.832557261f},
-std::array<float,2>{0.60271126f, 0.124951117f},
-std::array<float,2>{0.308230221f, 0.545477152f},
-std::array<float,2>{0.194926098f, 0.446376711f},
-std::array<float,2>{0.991606534f, 0.785788f},
-std::array<float,2>{0.753068268f, 0.293103933f},
-std::array<float,2>{0.0126798144f, 0.923057795f},
-std::array<float,2>{0.434999347f, 0.129228637f},
-std::array<float,2>{0.716218352f, 0.672647357f},
-std::array<float,2>{0.656283736f, 0.407379448f},
-std::array<float,2>{0.478589088f, 0.870164037f},
-std::array<float,2>{0.071201995f, 0.0210581329f},
-std::array<float,2>{0.839899957f, 0.596796215f},
-std::array<float,2>{0.902844727f, 0.24747026f},
-std::array<float,2>{0.143609017f, 0.706967711f},
-std::array<float,2>{0.359101713f, 0.365264982f},
-std::array<float,2>{0.546465099f, 0.943489015f},
-std::array<float,2>{0.547171712f, 0.202987552f},
-std::array<float,2>{0.364697784f, 0.729752541f},
-std::array<float,2>{0.129364982f, 0.338566035f},
-std::array<float,2>{0.883693099f, 0.979730725f},
-std::array<float,2>{0.813768804f, 0.384323329f},
-std::array<float,2>{0.0933381617f, 0.826526165f},
-std::array<float,2>{0.49593398f, 0.0537681319f},
-std::array<float,2>{0.684083462f, 0.565358996f},
-std::array<float,2>{0.702291906f, 0.276749909f},
-std::array<float,2>{0.413711697f, 0.879984736f},
-std::array<float,2>{0.0306290556f, 0.182372153f},
-std::array<float,2>{0.771672964f, 0.648190558f},
-std::array<float,2>{0.969800234f, 0.0792078599f},
-std::array<float,2>{0.209887534f, 0.510207653f},
-std::array<float,2>{0.281505436f, 0.484321266f},
-std::array<float,2>{0.618036926f, 0.752504885f},
-std::array<float,2>{0.628172874f, 0.000974546303f},
-std::array<float,2>{0.462384611f, 0.610797584f},
-std::array<float,2>{0.100003019f, 0.433081746f},
-std::array<float,2>{0.868236661f, 0.854768693f},
-std::array<float,2>{0.937078714f, 0.34727031f},
-std::array<float,2>{0.172479644f, 0.958373547f},
-std::array<float,2>{0.320404977f, 0.233490095f},
-std::array<float,2>{0.525041759f, 0.70179522f},
-std::array<float,2>{0.581060469f, 0.465870321f},
-std::array<float,2>{0.271541029f, 0.802400708f},
-std::array<float,2>{0.243261382f, 0.106635317f},
-std::array<float,2>{0.956012607f, 0.561034739f},
-std::array<float,2>{0.810284555f, 0.148878723f},
-std::array<float,2>{0.0514338538f, 0.669823647f},
-std::array<float,2>{0.40082413f, 0.298471063f},
-std::array<float,2>{0.722399056f, 0.909463584f},
-std::array<float,2>{0.64662832f, 0.144946471f},
-std::array<float,2>{0.447124422f, 0.663296342f},
-std::array<float,2>{0.12145742f, 0.30733332f},
-std::array<float,2>{0.852501452f, 0.916356385f},
-std::array<float,2>{0.907050788f, 0.459999621f},
-std::array<float,2>{0.163394883f, 0.8084023f},
-std::array<float,2>{0.337522537f, 0.0965328142f},
-std::array<float,2>{0.507819057f, 0.548768401f},
-std::array<float,2>{0.571435571f, 0.355462193f},
-std::array<float,2>{0.260141402f, 0.962355018f},
-std::array<float,2>{0.228498161f, 0.221310243f},
-std::array<float,2>{0.950732529f, 0.689038813f},
-std::array<float,2>{0.785025895f, 0.0149823278f},
-std::array<float,2>{0.0355991237f, 0.617860198f},
-std::array<float,2>{0.389579207f, 0.426121682f},
-std::array<float,2>{0.743379295f, 0.851257622f},
-std::array<float,2>{0.540065587f, 0.0927755162f},
-std::array<float,2>{0.35483247f, 0.504918098f},
-std::array<float,2>{0.146085039f, 0.476382136f},
-std::array<float,2>{0.899796903f, 0.76537782f},
-std::array<float,2>{0.837437153f, 0.271549225f},
-std::array<float,2>{0.0755106732f, 0.884975016f},
-std::array<float,2>{0.482093781f, 0.173449874f},
-std::array<float,2>{0.662824154f, 0.656109989f},
-std::array<float,2>{0.711235642f, 0.379643977f},
-std::array<float,2>{0.430560499f, 0.813469708f},
-std::array<float,2>{0.0101925954f, 0.0589467436f},
-std::array<float,2>{0.757367432f, 0.573716581f},
-std::array<float,2>{0.988066971f, 0.190161437f},
-std::array<float,2>{0.189786702f, 0.722019792f},
-std::array<float,2>{0.311204821f, 0.334804744f},
-std::array<float,2>{0.608159482f, 0.970039308f},
-std::array<float,2>{0.623332858f, 0.236955136f},
-std::array<float,2>{0.287844807f, 0.718028784f},
-std::array<float,2>{0.205162317f, 0.37361753f},
-std::array<float,2>{0.976561368f, 0.945536971f},
-std::array<float,2>{0.767106175f, 0.419638515f},
-std::array<float,2>{0.0235630833f, 0.859926701f},
-std::array<float,2>{0.40877977f, 0.0266460553f},
-std::array<float,2>{0.696406305f, 0.604564905f},
-std::array<float,2>{0.682053566f, 0.281806171f},
-std::array<float,2>{0.499905676f, 0.930277824f},
-std::array<float,2>{0.0875584707f, 0.138759524f},
-std::array<float,2>{0.818811595f, 0.68337971f},
-std::array<float,2>{0.88891834f, 0.115828067f},
-std::array<float,2>{0.126558825f, 0.535413861f},
-std::array<float,2>{0.361411095f, 0.439880848f},
-std::array<float,2>{0.553869665f, 0.792565465f},
-std::array<float,2>{0.724054933f, 0.0423419923f},
-std::array<float,2>{0.405371517f, 0.591656327f},
-std::array<float,2>{0.0482916199f, 0.402805537f},
-std::array<float,2>{0.805903733f, 0.836712539f},
-std::array<float,2>{0.95862174f, 0.324564666f},
-std::array<float,2>{0.248379484f, 0.996186614f},
-std::array<float,2>{0.266356915f, 0.206824258f},
-std::array<float,2>{0.582956135f, 0.748568177f},
-std::array<float,2>{0.530718088f, 0.494201064f},
-std::array<float,2>{0.325851202f, 0.770896077f},
-std::array<float,2>{0.177139848f, 0.0639368519f},
-std::array<float,2>{0.932114661f, 0.520043671f},
-std::array<float,2>{0.87401557f, 0.167364582f},
-std::array<float,2>{0.0945739672f, 0.627878845f},
-std::array<float,2>{0.467898488f, 0.254935205f},
-std::array<float,2>{0.630497456f, 0.905906737f},
-std::array<float,2>{0.691099823f, 0.214764565f},
-std::array<float,2>{0.420092851f, 0.736414909f},
-std::array<float,2>{0.0205776282f, 0.315713674f},
-std::array<float,2>{0.774748743f, 0.985521138f},
-std::array<float,2>{0.978133857f, 0.395219505f},
-std::array<float,2>{0.217743322f, 0.828377128f},
-std::array<float,2>{0.292927265f, 0.0381708294f},
-std::array<float,2>{0.611600399f, 0.585181475f},
-std::array<float,2>{0.555613041f, 0.259975284f},
-std::array<float,2>{0.373743981f, 0.896243989f},
-std::array<float,2>{0.133748189f, 0.163077757f},
-std::array<float,2>{0.876027703f, 0.635027528f},
-std::array<float,2>{0.823513985f, 0.0748719424f},
-std::array<float,2>{0.082250677f, 0.525163591f},
-std::array<float,2>{0.485143542f, 0.490189523f},
-std::array<float,2>{0.677640855f, 0.777511656f},
-std::array<float,2>{0.591473639f, 0.0185413398f},
-std::array<float,2>{0.275743395f, 0.600364447f},
-std::array<float,2>{0.238662958f, 0.411178201f},
-std::array<float,2>{0.966506124f, 0.872785568f},
-std::array<float,2>{0.804679692f, 0.360538095f},
-std::array<float,2>{0.0592849292f, 0.940591216f},
-std::array<float,2>{0.393245429f, 0.242444932f},
-std::array<float,2>{0.729731083f, 0.708729088f},
-std::array<float,2>{0.635037601f, 0.449827403f},
-std::array<float,2>{0.454194278f, 0.784640074f},
-std::array<float,2>{0.10485933f, 0.119169787f},
-std::array<float,2>{0.860392749f, 0.539362311f},
-std::array<float,2>{0.923320651f, 0.126113087f},
-std::array<float,2>{0.184810787f, 0.678238034f},
-std::array<float,2>{0.313875824f, 0.292246819f},
-std::array<float,2>{0.519804537f, 0.926619589f},
-std::array<float,2>{0.500284374f, 0.186829045f},
-std::array<float,2>{0.332256019f, 0.640951574f},
-std::array<float,2>{0.169987082f, 0.281200796f},
-std::array<float,2>{0.919282794f, 0.875488639f},
-std::array<float,2>{0.849496245f, 0.47879377f},
-std::array<float,2>{0.111390904f, 0.753996015f},
-std::array<float,2>{0.442890763f, 0.0837420374f},
-std::array<float,2>{0.653139591f, 0.512687802f},
-std::array<float,2>{0.738570511f, 0.343405545f},
-std::array<float,2>{0.377938956f, 0.982096076f},
-std::array<float,2>{0.0400889851f, 0.198372483f},
-std::array<float,2>{0.794703662f, 0.731278419f},
-std::array<float,2>{0.938003182f, 0.0469497293f},
-std::array<float,2>{0.218921646f, 0.56971997f},
-std::array<float,2>{0.253997982f, 0.390057862f},
-std::array<float,2>{0.569214165f, 0.822436094f},
-std::array<float,2>{0.671828032f, 0.102170952f},
-std::array<float,2>{0.475930929f, 0.55803138f},
-std::array<float,2>{0.0653471202f, 0.463858873f},
-std::array<float,2>{0.834271252f, 0.798473001f},
-std::array<float,2>{0.894539893f, 0.300844282f},
-std::array<float,2>{0.151954234f, 0.913991034f},
-std::array<float,2>{0.348649293f, 0.155612141f},
-std::array<float,2>{0.533280134f, 0.664636195f},
-std::array<float,2>{0.596469939f, 0.434014171f},
-std::array<float,2>{0.301189601f, 0.856666982f},
-std::array<float,2>{0.202707738f, 0.00775195099f},
-std::array<float,2>{0.995813072f, 0.614581048f},
-std::array<float,2>{0.758952796f, 0.228214324f},
-std::array<float,2>{0.00434568478f, 0.696079493f},
-std::array<float,2>{0.425755143f, 0.350987732f},
-std::array<float,2>{0.710409939f, 0.955058753f},
-std::array<float,2>{0.640183508f, 0.194635436f},
-std::array<float,2>{0.458900988f, 0.723265052f},
-std::array<float,2>{0.106795952f, 0.329426467f},
-std::array<float,2>{0.865517735f, 0.976441324f},
-std::array<float,2>{0.92907691f, 0.375902325f},
-std::array<float,2>{0.183109567f, 0.819498479f},
-std::array<float,2>{0.318313092f, 0.0553083941f},
-std::array<float,2>{0.518475831f, 0.577572227f},
-std::array<float,2>{0.58600527f, 0.269121081f},
-std::array<float,2>{0.277917534f, 0.890050232f},
-std::array<float,2>{0.235422209f, 0.176391125f},
-std::array<float,2>{0.961614311f, 0.651005268f},
-std::array<float,2>{0.79760927f, 0.089505665f},
-std::array<float,2>{0.0550000481f, 0.503754377f},
-std::array<float,2>{0.397571176f, 0.470562339f},
-std::array<float,2>{0.730531216f, 0.758418798f},
-std::array<float,2>{0.558811724f, 0.00952393934f},
-std::array<float,2>{0.369492799f, 0.623809636f},
-std::array<float,2>{0.139453545f, 0.425133198f},
-std::array<float,2>{0.880092025f, 0.845365822f},
-std::array<float,2>{0.827386558f, 0.358007818f},
-std::array<float,2>{0.078909725f, 0.965648293f},
-std::array<float,2>{0.489609599f, 0.223942697f},
-std::array<float,2>{0.674217284f, 0.693598568f},
-std::array<float,2>{0.695234179f, 0.453420788f},
-std::array<float,2>{0.415150583f, 0.812158585f},
-std::array<float,2>{0.015822107f, 0.0980259627f},
-std::array<float,2>{0.780906141f, 0.552841842f},
-std::array<float,2>{0.982365727f, 0.141776174f},
-std::array<float,2>{0.213844776f, 0.658939004f},
-std::array<float,2>{0.293656528f, 0.310839772f},
-std::array<float,2>{0.615687847f, 0.920013249f},
-std::array<float,2>{0.601261675f, 0.170660332f},
-std::array<float,2>{0.299340039f, 0.63095057f},
-std::array<float,2>{0.196224764f, 0.251694292f},
-std::array<float,2>{0.998124361f, 0.901185274f},
-std::array<float,2>{0.764845669f, 0.496194482f},
-std::array<float,2>{0.00339946221f, 0.768847883f},
-std::array<float,2>{0.429170161f, 0.0690313801f},
-std::array<float,2>{0.704886198f, 0.516162872f},
-std::array<float,2>{0.66713053f, 0.322081387f},
-std::array<float,2>{0.471489578f, 0.995187581f},
-std::array<float,2>{0.0676309913f, 0.210237086f},
-std::array<float,2>{0.829652905f, 0.744195223f},
-std::array<float,2>{0.891168237f, 0.0436600409f},
-std::array<float,2>{0.153014272f, 0.589108706f},
-std::array<float,2>{0.346557707f, 0.400443524f},
-std::array<float,2>{0.536010683f, 0.842716515f},
-std::array<float,2>{0.737242162f, 0.110148229f},
-std::array<float,2>{0.380299568f, 0.534522772f},
-std::array<float,2>{0.0467338711f, 0.441738039f},
-std::array<float,2>{0.790351331f, 0.796602607f},
-std::array<float,2>{0.942079961f, 0.288280874f},
-std::array<float,2>{0.225491479f, 0.934372425f},
-std::array<float,2>{0.252759933f, 0.133050501f},
-std::array<float,2>{0.562847733f, 0.684433281f},
-std::array<float,2>{0.505212724f, 0.416930348f},
-std::array<float,2>{0.330420166f, 0.866260529f},
-std::array<float,2>{0.166583806f, 0.0308542643f},
-std::array<float,2>{0.91528672f, 0.608798921f},
-std::array<float,2>{0.844013929f, 0.240864664f},
-std::array<float,2>{0.113359801f, 0.711633384f},
-std::array<float,2>{0.440749139f, 0.367408603f},
-std::array<float,2>{0.649616182f, 0.951354921f},
-std::array<float,2>{0.716800332f, 0.131838053f},
-std::array<float,2>{0.43583411f, 0.674300432f},
-std::array<float,2>{0.0146807721f, 0.296746314f},
-std::array<float,2>{0.750319362f, 0.925220013f},
-std::array<float,2>{0.989443898f, 0.44917354f},
-std::array<float,2>{0.192511171f, 0.788114369f},
-std::array<float,2>{0.305051804f, 0.121191993f},
-std::array<float,2>{0.603653967f, 0.542979419f},
-std::array<float,2>{0.543174028f, 0.364446342f},
-std::array<float,2>{0.355735481f, 0.942643762f},
-std::array<float,2>{0.14077726f, 0.248053938f},
-std::array<float,2>{0.905847132f, 0.704593003f},
-std::array<float,2>{0.84228313f, 0.0226585064f},
-std::array<float,2>{0.0728990808f, 0.593850791f},
-std::array<float,2>{0.476920664f, 0.409022629f},
-std::array<float,2>{0.659926593f, 0.867617667f},
-std::array<float,2>{0.576500893f, 0.07273148f},
-std::array<float,2>{0.265197635f, 0.529972792f},
-std::array<float,2>{0.231813431f, 0.488019466f},
-std::array<float,2>{0.946362019f, 0.776114464f},
-std::array<float,2>{0.787592709f, 0.263302296f},
-std::array<float,2>{0.0316600464f, 0.892333984f},
-std::array<float,2>{0.384943098f, 0.15656583f},
-std::array<float,2>{0.746190727f, 0.639098525f},
-std::array<float,2>{0.642173707f, 0.391497403f},
-std::array<float,2>{0.450832188f, 0.834258497f},
-std::array<float,2>{0.12017934f, 0.0324374773f},
-std::array<float,2>{0.857721686f, 0.579060555f},
-std::array<float,2>{0.911067367f, 0.217717499f},
-std::array<float,2>{0.158791021f, 0.740323186f},
-std::array<float,2>{0.341125309f, 0.319893658f},
-std::array<float,2>{0.512244999f, 0.992004156f},
-std::array<float,2>{0.525978386f, 0.232105017f},
-std::array<float,2>{0.322780937f, 0.699646354f},
-std::array<float,2>{0.17540814f, 0.344377309f},
-std::array<float,2>{0.93438977f, 0.96029526f},
-std::array<float,2>{0.870949984f, 0.430832922f},
-std::array<float,2>{0.098319225f, 0.852672935f},
-std::array<float,2>{0.464776009f, 0.00306864339f},
-std::array<float,2>{0.62653935f, 0.613252461f},
-std::array<float,2>{0.71992898f, 0.299331039f},
-std::array<float,2>{0.400382102f, 0.906578243f},
-std::array<float,2>{0.0535032339f, 0.15215902f},
-std::array<float,2>{0.81098485f, 0.670364857f},
-std::array<float,2>{0.953881562f, 0.109050281f},
-std::array<float,2>{0.24475497f, 0.559721887f},
-std::array<float,2>{0.271233618f, 0.468391478f},
-std::array<float,2>{0.578957438f, 0.804450035f},
-std::array<float,2>{0.685993135f, 0.0523256958f},
-std::array<float,2>{0.493383884f, 0.562777936f},
-std::array<float,2>{0.0902102441f, 0.385384917f},
-std::array<float,2>{0.815906823f, 0.82447654f},
-std::array<float,2>{0.885040402f, 0.337562978f},
-std::array<float,2>{0.131730199f, 0.978195786f},
-std::array<float,2>{0.366592377f, 0.200163439f},
-std::array<float,2>{0.548962414f, 0.727698982f},
-std::array<float,2>{0.620092154f, 0.481043339f},
-std::array<float,2>{0.284864426f, 0.750351727f},
-std::array<float,2>{0.207494423f, 0.0810101256f},
-std::array<float,2>{0.97076124f, 0.508228362f},
-std::array<float,2>{0.771316946f, 0.180769548f},
-std::array<float,2>{0.0283428002f, 0.644675076f},
-std::array<float,2>{0.411712766f, 0.27530399f},
-std::array<float,2>{0.699734271f, 0.882371306f},
-std::array<float,2>{0.661133289f, 0.175266102f},
-std::array<float,2>{0.483592987f, 0.65399003f},
-std::array<float,2>{0.0777521655f, 0.271296769f},
-std::array<float,2>{0.838809073f, 0.883393586f},
-std::array<float,2>{0.901740909f, 0.474211246f},
-std::array<float,2>{0.146577001f, 0.762418509f},
-std::array<float,2>{0.35237661f, 0.0906337202f},
-std::array<float,2>{0.541364729f, 0.507332683f},
-std::array<float,2>{0.606223881f, 0.332172066f},
-std::array<float,2>{0.308910668f, 0.971630037f},
-std::array<float,2>{0.188344613f, 0.18806985f},
-std::array<float,2>{0.985314667f, 0.719538212f},
-std::array<float,2>{0.755068421f, 0.0615526475f},
-std::array<float,2>{0.0084541766f, 0.570706367f},
-std::array<float,2>{0.432343334f, 0.382532209f},
-std::array<float,2>{0.713724613f, 0.814843774f},
-std::array<float,2>{0.51157999f, 0.0947350785f},
-std::array<float,2>{0.338584423f, 0.549464881f},
-std::array<float,2>{0.161351576f, 0.457599938f},
-std::array<float,2>{0.909542024f, 0.80560708f},
-std::array<float,2>{0.855461657f, 0.304985791f},
-std::array<float,2>{0.123876944f, 0.914741039f},
-std::array<float,2>{0.44906041f, 0.146643832f},
-std::array<float,2>{0.644881427f, 0.661384404f},
-std::array<float,2>{0.744474947f, 0.429371268f},
-std::array<float,2>{0.388241529f, 0.848495305f},
-std::array<float,2>{0.0379331037f, 0.0134368949f},
-std::array<float,2>{0.782686114f, 0.619387448f},
-std::array<float,2>{0.951848269f, 0.220535442f},
-std::array<float,2>{0.228660837f, 0.690228939f},
-std::array<float,2>{0.258190334f, 0.352989584f},
-std::array<float,2>{0.5740906f, 0.963984787f},
-std::array<float,2>{0.585927248f, 0.204623774f},
-std::array<float,2>{0.268636495f, 0.747992933f},
-std::array<float,2>{0.247792497f, 0.32765612f},
-std::array<float,2>{0.960433483f, 0.999966919f},
-std::array<float,2>{0.808405101f, 0.404986918f},
-std::array<float,2>{0.0489558317f, 0.839818478f},
-std::array<float,2>{0.403570861f, 0.0404489152f},
-std::array<float,2>{0.72495383f, 0.592340946f},
-std::array<float,2>{0.632044375f, 0.257312357f},
-std::array<float,2>{0.466497421f, 0.90397507f},
-std::array<float,2>{0.0961897895f, 0.164762154f},
-std::array<float,2>{0.871191919f, 0.62631464f},
-std::array<float,2>{0.929782987f, 0.0661431029f},
-std::array<float,2>{0.178063989f, 0.52312839f},
-std::array<float,2>{0.327720821f, 0.49407503f},
-std::array<float,2>{0.529220223f, 0.77185905f},
-std::array<float,2>{0.697550237f, 0.024742106f},
-std::array<float,2>{0.407767296f, 0.602108657f},
-std::array<float,2>{0.0261884257f, 0.421405017f},
-std::array<float,2>{0.76783061f, 0.862041533f},
-std::array<float,2>{0.973081887f, 0.372502446f},
-std::array<float,2>{0.204635799f, 0.947690606f},
-std::array<float,2>{0.286648422f, 0.234591886f},
-std::array<float,2>{0.62240088f, 0.71540314f},
-std::array<float,2>{0.552684069f, 0.438781053f},
-std::array<float,2>{0.360596746f, 0.789884984f},
-std::array<float,2>{0.12765564f, 0.113843888f},
-std::array<float,2>{0.887147605f, 0.537499428f},
-std::array<float,2>{0.816534698f, 0.137045279f},
-std::array<float,2>{0.0895429701f, 0.68034339f},
-std::array<float,2>{0.496958792f, 0.284047425f},
-std::array<float,2>{0.680634558f, 0.932238102f},
-std::array<float,2>{0.727076828f, 0.245076954f},
-std::array<float,2>{0.391131222f, 0.710523963f},
-std::array<float,2>{0.0609280653f, 0.362983525f},
-std::array<float,2>{0.801199198f, 0.938744366f},
-std::array<float,2>{0.968354821f, 0.412409842f},
-std::array<float,2>{0.240445346f, 0.873917341f},
-std::array<float,2>{0.273905933f, 0.0161832534f},
-std::array<float,2>{0.593123138f, 0.598837018f},
-std::array<float,2>{0.522271395f, 0.290178239f},
-std::array<float,2>{0.315337718f, 0.928902745f},
-std::array<float,2>{0.187268838f, 0.128687665f},
-std::array<float,2>{0.924779058f, 0.677451074f},
-std::array<float,2>{0.862454653f, 0.118137293f},
-std::array<float,2>{0.103235468f, 0.542802513f},
-std::array<float,2>{0.455205619f, 0.452013254f},
-std::array<float,2>{0.632986963f, 0.782565594f},
-std::array<float,2>{0.610619545f, 0.0354240276f},
-std::array<float,2>{0.290100366f, 0.583889425f},
-std::array<float,2>{0.214886934f, 0.397060752f},
-std::array<float,2>{0.978590488f, 0.831403315f},
-std::array<float,2>{0.776205957f, 0.314320922f},
-std::array<float,2>{0.022878278f, 0.987912476f},
-std::array<float,2>{0.418541998f, 0.212449029f},
-std::array<float,2>{0.688251257f, 0.735986352f},
-std::array<float,2>{0.679687381f, 0.490405679f},
-std::array<float,2>{0.487863451f, 0.780127883f},
-std::array<float,2>{0.0858777314f, 0.0778613165f},
-std::array<float,2>{0.821023285f, 0.526059985f},
-std::array<float,2>{0.878879607f, 0.160492346f},
-std::array<float,2>{0.135653809f, 0.633645773f},
-std::array<float,2>{0.3727507f, 0.257950604f},
-std::array<float,2>{0.556796134f, 0.898137331f},
-std::array<float,2>{0.532425582f, 0.152985916f},
-std::array<float,2>{0.351072729f, 0.667329133f},
-std::array<float,2>{0.149081111f, 0.303240687f},
-std::array<float,2>{0.896527052f, 0.91056329f},
-std::array<float,2>{0.832450628f, 0.461444587f},
-std::array<float,2>{0.0630716234f, 0.799065471f},
-std::array<float,2>{0.472789377f, 0.104706638f},
-std::array<float,2>{0.668967903f, 0.555167437f},
-std::array<float,2>{0.707588971f, 0.347688287f},
-std::array<float,2>{0.423327088f, 0.955447018f},
-std::array<float,2>{0.00660894252f, 0.230347201f},
-std::array<float,2>{0.76132834f, 0.698523462f},
-std::array<float,2>{0.992499113f, 0.0045267567f},
-std::array<float,2>{0.19953762f, 0.616435289f},
-std::array<float,2>{0.303027809f, 0.436852634f},
-std::array<float,2>{0.594140589f, 0.858923197f},
-std::array<float,2>{0.654588699f, 0.084470138f},
-std::array<float,2>{0.443558782f, 0.513775826f},
-std::array<float,2>{0.109383352f, 0.477747262f},
-std::array<float,2>{0.850875556f, 0.757691741f},
-std::array<float,2>{0.920025706f, 0.2790595f},
-std::array<float,2>{0.168788806f, 0.878482044f},
-std::array<float,2>{0.335411817f, 0.185524106f},
-std::array<float,2>{0.502985001f, 0.643652141f},
-std::array<float,2>{0.567777455f, 0.386980027f},
-std::array<float,2>{0.257322371f, 0.820920885f},
-std::array<float,2>{0.222416475f, 0.0495320745f},
-std::array<float,2>{0.941155076f, 0.567104161f},
-std::array<float,2>{0.795155346f, 0.197010025f},
-std::array<float,2>{0.0416421294f, 0.732948065f},
-std::array<float,2>{0.375039846f, 0.341077715f},
-std::array<float,2>{0.741196573f, 0.982675195f},
-std::array<float,2>{0.664833844f, 0.209558532f},
-std::array<float,2>{0.468915194f, 0.745294452f},
-std::array<float,2>{0.0699933395f, 0.320907027f},
-std::array<float,2>{0.8307212f, 0.994999349f},
-std::array<float,2>{0.893247843f, 0.402266383f},
-std::array<float,2>{0.154672474f, 0.843678951f},
-std::array<float,2>{0.34401387f, 0.0443489328f},
-std::array<float,2>{0.538382411f, 0.588592112f},
-std::array<float,2>{0.598187029f, 0.250169754f},
-std::array<float,2>{0.29794541f, 0.901837647f},
-std::array<float,2>{0.197705165f, 0.171649635f},
-std::array<float,2>{0.996265054f, 0.632478476f},
-std::array<float,2>{0.763554871f, 0.0694426894f},
-std::array<float,2>{0.0010410652f, 0.517007291f},
-std::array<float,2>{0.426501483f, 0.497451752f},
-std::array<float,2>{0.706845939f, 0.767897308f},
-std::array<float,2>{0.506603241f, 0.0300516915f},
-std::array<float,2>{0.329874367f, 0.608272076f},
-std::array<float,2>{0.165629953f, 0.417096972f},
-std::array<float,2>{0.916877151f, 0.866011739f},
-std::array<float,2>{0.846935093f, 0.368424058f},
-std::array<float,2>{0.116430148f, 0.952801764f},
-std::array<float,2>{0.437970102f, 0.241929874f},
-std::array<float,2>{0.65071702f, 0.712367892f},
-std::array<float,2>{0.735681355f, 0.44300282f},
-std::array<float,2>{0.38272059f, 0.795462668f},
-std::array<float,2>{0.04426907f, 0.110392414f},
-std::array<float,2>{0.792660832f, 0.533294201f},
-std::array<float,2>{0.943560183f, 0.134077623f},
-std::array<float,2>{0.223856106f, 0.684743345f},
-std::array<float,2>{0.251208395f, 0.28767994f},
-std::array<float,2>{0.565478384f, 0.935243726f},
-std::array<float,2>{0.589742005f, 0.17708306f},
-std::array<float,2>{0.28122589f, 0.6515221f},
-std::array<float,2>{0.237905964f, 0.267907351f},
-std::array<float,2>{0.963413119f, 0.889643312f},
-std::array<float,2>{0.799925804f, 0.468789428f},
-std::array<float,2>{0.0575204678f, 0.759491503f},
-std::array<float,2>{0.396309733f, 0.0887237713f},
-std::array<float,2>{0.733407736f, 0.502692163f},
-std::array<float,2>{0.63785255f, 0.328327596f},
-std::array<float,2>{0.459748715f, 0.974691987f},
-std::array<float,2>{0.108766019f, 0.193853959f},
-std::array<float,2>{0.864087701f, 0.7240839f},
-std::array<float,2>{0.926478684f, 0.0564699881f},
-std::array<float,2>{0.180455267f, 0.576284051f},
-std::array<float,2>{0.319500923f, 0.376015067f},
-std::array<float,2>{0.516082048f, 0.818403006f},
-std::array<float,2>{0.69143641f, 0.0994152725f},
-std::array<float,2>{0.41760087f, 0.554389477f},
-std::array<float,2>{0.019245537f, 0.454786479f},
-std::array<float,2>{0.779121995f, 0.8109743f},
-std::array<float,2>{0.982520819f, 0.312441319f},
-std::array<float,2>{0.212426379f, 0.921220899f},
-std::array<float,2>{0.296310753f, 0.141479939f},
-std::array<float,2>{0.614295244f, 0.659752488f},
-std::array<float,2>{0.56242305f, 0.424096733f},
-std::array<float,2>{0.369022697f, 0.844280005f},
-std::array<float,2>{0.136722997f, 0.00853169896f},
-std::array<float,2>{0.881633222f, 0.624724984f},
-std::array<float,2>{0.825388134f, 0.223462328f},
-std::array<float,2>{0.0805853605f, 0.694935739f},
-std::array<float,2>{0.491391093f, 0.358728856f},
-std::array<float,2>{0.673294663f, 0.966344535f},
-std::array<float,2>{0.721341789f, 0.151258156f},
-std::array<float,2>{0.40152505f, 0.671538353f},
-std::array<float,2>{0.0520929173f, 0.300724357f},
-std::array<float,2>{0.809295893f, 0.907547832f},
-std::array<float,2>{0.956763268f, 0.466853559f},
-std::array<float,2>{0.242646039f, 0.803396165f},
-std::array<float,2>{0.272789091f, 0.107706249f},
-std::array<float,2>{0.580144882f, 0.558996975f},
-std::array<float,2>{0.524152696f, 0.34564954f},
-std::array<float,2>{0.321803719f, 0.959838152f},
-std::array<float,2>{0.173208252f, 0.230895817f},
-std::array<float,2>{0.936144829f, 0.700715065f},
-std::array<float,2>{0.867935181f, 0.00214146893f},
-std::array<float,2>{0.10071525f, 0.611329436f},
-std::array<float,2>{0.461245596f, 0.43061775f},
-std::array<float,2>{0.627148807f, 0.851920784f},
-std::array<float,2>{0.618933499f, 0.0816147402f},
-std::array<float,2>{0.282891035f, 0.509524047f},
-std::array<float,2>{0.210748851f, 0.481571227f},
-std::array<float,2>{0.969657242f, 0.751741648f},
-std::array<float,2>{0.772782385f, 0.273565471f},
-std::array<float,2>{0.029696323f, 0.880900919f},
-std::array<float,2>{0.413077861f, 0.179862648f},
-std::array<float,2>{0.701781034f, 0.646179259f},
-std::array<float,2>{0.68535614f, 0.385971218f},
-std::array<float,2>{0.494805872f, 0.825871646f},
-std::array<float,2>{0.0926687717f, 0.0510501266f},
-std::array<float,2>{0.813176394f, 0.564452648f},
-std::array<float,2>{0.883948326f, 0.20111239f},
-std::array<float,2>{0.130562603f, 0.72702986f},
-std::array<float,2>{0.363414437f, 0.336319566f},
-std::array<float,2>{0.548579097f, 0.97685051f},
-std::array<float,2>{0.545228064f, 0.249394566f},
-std::array<float,2>{0.357806802f, 0.703535259f},
-std::array<float,2>{0.143095836f, 0.364180416f},
-std::array<float,2>{0.903366685f, 0.941616237f},
-std::array<float,2>{0.841415167f, 0.409437925f},
-std::array<float,2>{0.0717445612f, 0.868576229f},
-std::array<float,2>{0.480427504f, 0.0224392898f},
-std::array<float,2>{0.657736003f, 0.595655501f},
-std::array<float,2>{0.715158701f, 0.295353293f},
-std::array<float,2>{0.434467196f, 0.924193919f},
-std::array<float,2>{0.013192039f, 0.130927011f},
-std::array<float,2>{0.752439797f, 0.675647557f},
-std::array<float,2>{0.991030335f, 0.122146256f},
-std::array<float,2>{0.194326892f, 0.544359326f},
-std::array<float,2>{0.307111382f, 0.447993696f},
-std::array<float,2>{0.602501512f, 0.787842929f},
-std::array<float,2>{0.643864632f, 0.0316067226f},
-std::array<float,2>{0.451877952f, 0.57972914f},
-std::array<float,2>{0.119037963f, 0.392289698f},
-std::array<float,2>{0.856828988f, 0.835235953f},
-std::array<float,2>{0.91291517f, 0.31923905f},
-std::array<float,2>{0.157113269f, 0.990657032f},
-std::array<float,2>{0.342151403f, 0.217856243f},
-std::array<float,2>{0.514627457f, 0.74164784f},
-std::array<float,2>{0.575034678f, 0.487210065f},
-std::array<float,2>{0.2630575f, 0.777188301f},
-std::array<float,2>{0.232501999f, 0.0740933418f},
-std::array<float,2>{0.947811425f, 0.530475497f},
-std::array<float,2>{0.785920322f, 0.15809381f},
-std::array<float,2>{0.0334048718f, 0.639865637f},
-std::array<float,2>{0.384689808f, 0.261796027f},
-std::array<float,2>{0.748242199f, 0.891377509f},
-std::array<float,2>{0.629001975f, 0.165299535f},
-std::array<float,2>{0.4676992f, 0.625742853f},
-std::array<float,2>{0.0951534882f, 0.255978525f},
-std::array<float,2>{0.874716163f, 0.902977288f},
-std::array<float,2>{0.933302104f, 0.492472053f},
-std::array<float,2>{0.17605184f, 0.773035347f},
-std::array<float,2>{0.324973792f, 0.0650685802f},
-std::array<float,2>{0.529848874f, 0.521509707f},
-std::array<float,2>{0.583142161f, 0.32635662f},
-std::array<float,2>{0.266747445f, 0.998168826f},
-std::array<float,2>{0.249235213f, 0.204099372f},
-std::array<float,2>{0.957744896f, 0.746157467f},
-std::array<float,2>{0.804758787f, 0.0395573899f},
-std::array<float,2>{0.0476052314f, 0.593238831f},
-std::array<float,2>{0.404347092f, 0.405882865f},
-std::array<float,2>{0.72342366f, 0.838176727f},
-std::array<float,2>{0.552887321f, 0.115075506f},
-std::array<float,2>{0.362423778f, 0.53873235f},
-std::array<float,2>{0.125513852f, 0.437609553f},
-std::array<float,2>{0.89055717f, 0.790941119f},
-std::array<float,2>{0.819885194f, 0.28443101f},
-std::array<float,2>{0.0865629464f, 0.933472335f},
-std::array<float,2>{0.498071611f, 0.137841433f},
-std::array<float,2>{0.682659984f, 0.681599021f},
-std::array<float,2>{0.695844948f, 0.42003727f},
-std::array<float,2>{0.409863889f, 0.862880826f},
-std::array<float,2>{0.0244239122f, 0.0237411205f},
-std::array<float,2>{0.766153216f, 0.602833807f},
-std::array<float,2>{0.975437462f, 0.235355005f},
-std::array<float,2>{0.206596836f, 0.716050386f},
-std::array<float,2>{0.288188457f, 0.371611208f},
-std::array<float,2>{0.624414623f, 0.94904691f},
-std::array<float,2>{0.608970523f, 0.189125001f},
-std::array<float,2>{0.312036067f, 0.720380068f},
-std::array<float,2>{0.191059768f, 0.333773464f},
-std::array<float,2>{0.98691839f, 0.971756041f},
-std::array<float,2>{0.756660044f, 0.381421715f},
-std::array<float,2>{0.0111561185f, 0.815736771f},
-std::array<float,2>{0.431232095f, 0.0606811643f},
-std::array<float,2>{0.712183118f, 0.571662486f},
-std::array<float,2>{0.663876116f, 0.270231575f},
-std::array<float,2>{0.481003076f, 0.884487331f},
-std::array<float,2>{0.0745073631f, 0.174258024f},
-std::array<float,2>{0.836701572f, 0.652828395f},
-std::array<float,2>{0.898950517f, 0.0917925686f},
-std::array<float,2>{0.145170212f, 0.506453037f},
-std::array<float,2>{0.354129076f, 0.473592222f},
-std::array<float,2>{0.539710999f, 0.762887776f},
-std::array<float,2>{0.743041933f, 0.0119146733f},
-std::array<float,2>{0.390541911f, 0.620396376f},
-std::array<float,2>{0.0370554924f, 0.428359777f},
-std::array<float,2>{0.783281446f, 0.849457026f},
-std::array<float,2>{0.949624479f, 0.351924032f},
-std::array<float,2>{0.227223709f, 0.963730931f},
-std::array<float,2>{0.260908395f, 0.219501942f},
-std::array<float,2>{0.570723176f, 0.691250026f},
-std::array<float,2>{0.509397566f, 0.458227873f},
-std::array<float,2>{0.336223692f, 0.806130052f},
-std::array<float,2>{0.162967086f, 0.0945434347f},
-std::array<float,2>{0.907888949f, 0.55053395f},
-std::array<float,2>{0.852829576f, 0.148253947f},
-std::array<float,2>{0.122201689f, 0.660348654f},
-std::array<float,2>{0.445775211f, 0.306219637f},
-std::array<float,2>{0.647788525f, 0.915888846f},
-std::array<float,2>{0.709107935f, 0.229445219f},
-std::array<float,2>{0.424188524f, 0.697813928f},
-std::array<float,2>{0.00544650247f, 0.349598765f},
-std::array<float,2>{0.757959366f, 0.956668317f},
-std::array<float,2>{0.995110035f, 0.435833037f},
-std::array<float,2>{0.201519772f, 0.857743084f},
-std::array<float,2>{0.302292168f, 0.00560380146f},
-std::array<float,2>{0.596726775f, 0.615813315f},
-std::array<float,2>{0.534799159f, 0.304342806f},
-std::array<float,2>{0.348295957f, 0.911330879f},
-std::array<float,2>{0.150591418f, 0.153590202f},
-std::array<float,2>{0.895573378f, 0.66640842f},
-std::array<float,2>{0.835437775f, 0.104427285f},
-std::array<float,2>{0.0660692081f, 0.556236207f},
-std::array<float,2>{0.475559086f, 0.462100536f},
-std::array<float,2>{0.670348108f, 0.800098121f},
-std::array<float,2>{0.569510579f, 0.0502930507f},
-std::array<float,2>{0.255375952f, 0.567400217f},
-std::array<float,2>{0.219864801f, 0.38825044f},
-std::array<float,2>{0.938653648f, 0.821415484f},
-std::array<float,2>{0.793127179f, 0.340105176f},
-std::array<float,2>{0.0393948145f, 0.983988225f},
-std::array<float,2>{0.377742231f, 0.196124434f},
-std::array<float,2>{0.739722252f, 0.733739555f},
-std::array<float,2>{0.65393281f, 0.477260113f},
-std::array<float,2>{0.441784561f, 0.755964279f},
-std::array<float,2>{0.112791158f, 0.0857957453f},
-std::array<float,2>{0.848349035f, 0.515153766f},
-std::array<float,2>{0.918020844f, 0.183690608f},
-std::array<float,2>{0.171426818f, 0.642604113f},
-std::array<float,2>{0.333453894f, 0.277569681f},
-std::array<float,2>{0.501121581f, 0.877418041f},
-std::array<float,2>{0.520596802f, 0.127761602f},
-std::array<float,2>{0.312827289f, 0.676543534f},
-std::array<float,2>{0.184199408f, 0.289237231f},
-std::array<float,2>{0.921990216f, 0.928704858f},
-std::array<float,2>{0.85992372f, 0.452896714f},
-std::array<float,2>{0.104371928f, 0.781996489f},
-std::array<float,2>{0.453128248f, 0.118678428f},
-std::array<float,2>{0.636145353f, 0.541044295f},
-std::array<float,2>{0.72919333f, 0.361345738f},
-std::array<float,2>{0.394134551f, 0.938427389f},
-std::array<float,2>{0.0605043508f, 0.245458409f},
-std::array<float,2>{0.803315163f, 0.709305763f},
-std::array<float,2>{0.965130925f, 0.0168728698f},
-std::array<float,2>{0.239421368f, 0.59825331f},
-std::array<float,2>{0.276942879f, 0.414044559f},
-std::array<float,2>{0.590713024f, 0.874694824f},
-std::array<float,2>{0.676378369f, 0.0762252212f},
-std::array<float,2>{0.486295938f, 0.52658242f},
-std::array<float,2>{0.0833432004f, 0.491731137f},
-std::array<float,2>{0.822787821f, 0.780354381f},
-std::array<float,2>{0.875617445f, 0.259555757f},
-std::array<float,2>{0.134147719f, 0.896683633f},
-std::array<float,2>{0.374447614f, 0.161810383f},
-std::array<float,2>{0.556183875f, 0.634759367f},
-std::array<float,2>{0.612444401f, 0.397909671f},
-std::array<float,2>{0.291263074f, 0.830981433f},
-std::array<float,2>{0.217931375f, 0.0370927602f},
-std::array<float,2>{0.977093875f, 0.582170844f},
-std::array<float,2>{0.774052858f, 0.211609796f},
-std::array<float,2>{0.0201345477f, 0.735092878f},
-std::array<float,2>{0.421056509f, 0.313242823f},
-std::array<float,2>{0.69039917f, 0.986685157f},
-std::array<float,2>{0.649359643f, 0.239079565f},
-std::array<float,2>{0.439804226f, 0.713180721f},
-std::array<float,2>{0.115102038f, 0.370581895f},
-std::array<float,2>{0.844820917f, 0.951132774f},
-std::array<float,2>{0.914449096f, 0.414085507f},
-std::array<float,2>{0.167570129f, 0.864231169f},
-std::array<float,2>{0.331791818f, 0.027976837f},
-std::array<float,2>{0.504570246f, 0.60601759f},
-std::array<float,2>{0.564358175f, 0.285571098f},
-std::array<float,2>{0.252980411f, 0.936636806f},
-std::array<float,2>{0.226557612f, 0.136425719f},
-std::array<float,2>{0.94311744f, 0.687392831f},
-std::array<float,2>{0.789593279f, 0.112332255f},
-std::array<float,2>{0.0452071168f, 0.531636238f},
-std::array<float,2>{0.379028261f, 0.444199383f},
-std::array<float,2>{0.738226473f, 0.794111431f},
-std::array<float,2>{0.53706038f, 0.0454890355f},
-std::array<float,2>{0.346839279f, 0.58617717f},
-std::array<float,2>{0.153958023f, 0.399631053f},
-std::array<float,2>{0.892198443f, 0.839980662f},
-std::array<float,2>{0.829026401f, 0.323622018f},
-std::array<float,2>{0.0672532991f, 0.992190301f},
-std::array<float,2>{0.472595841f, 0.207061961f},
-std::array<float,2>{0.666990459f, 0.742734075f},
-std::array<float,2>{0.703748345f, 0.498292923f},
-std::array<float,2>{0.428154588f, 0.766755044f},
-std::array<float,2>{0.00249341084f, 0.0676528066f},
-std::array<float,2>{0.763820469f, 0.518227458f},
-std::array<float,2>{0.999341011f, 0.16963692f},
-std::array<float,2>{0.196327493f, 0.629915595f},
-std::array<float,2>{0.300387204f, 0.252580285f},
-std::array<float,2>{0.599677622f, 0.898644805f},
-std::array<float,2>{0.617118537f, 0.143536031f},
-std::array<float,2>{0.294478774f, 0.657411754f},
-std::array<float,2>{0.214460477f, 0.310387671f},
-std::array<float,2>{0.98082149f, 0.918041885f},
-std::array<float,2>{0.779374242f, 0.456936508f},
-std::array<float,2>{0.0173910502f, 0.808912337f},
-std::array<float,2>{0.414463937f, 0.100423895f},
-std::array<float,2>{0.693707108f, 0.551331222f},
-std::array<float,2>{0.675532937f, 0.356238067f},
-std::array<float,2>{0.48921448f, 0.967321336f},
-std::array<float,2>{0.0795662552f, 0.224887908f},
-std::array<float,2>{0.826659918f, 0.692208409f},
-std::array<float,2>{0.879675865f, 0.0109415678f},
-std::array<float,2>{0.139778033f, 0.622749507f},
-std::array<float,2>{0.371030569f, 0.42231822f},
-std::array<float,2>{0.560061812f, 0.847607613f},
-std::array<float,2>{0.732157648f, 0.085979417f},
-std::array<float,2>{0.396975547f, 0.501486897f},
-std::array<float,2>{0.0565108247f, 0.471230596f},
-std::array<float,2>{0.797961056f, 0.761550665f},
-std::array<float,2>{0.962382913f, 0.26608187f},
-std::array<float,2>{0.234871387f, 0.886929631f},
-std::array<float,2>{0.278473616f, 0.179580092f},
-std::array<float,2>{0.587598503f, 0.650061429f},
-std::array<float,2>{0.519487977f, 0.378762305f},
-std::array<float,2>{0.316860586f, 0.817015469f},
-std::array<float,2>{0.182447508f, 0.0581813306f},
-std::array<float,2>{0.928254783f, 0.575188398f},
-std::array<float,2>{0.867162526f, 0.191756532f},
-std::array<float,2>{0.10627456f, 0.725992799f},
-std::array<float,2>{0.45783487f, 0.331531078f},
-std::array<float,2>{0.639129341f, 0.97310406f},
-std::array<float,2>{0.700457871f, 0.182689458f},
-std::array<float,2>{0.410550714f, 0.646966517f},
-std::array<float,2>{0.0274676364f, 0.275898278f},
-std::array<float,2>{0.77039665f, 0.879760087f},
-std::array<float,2>{0.972350597f, 0.482864708f},
-std::array<float,2>{0.208175093f, 0.753749013f},
-std::array<float,2>{0.283340544f, 0.0787981078f},
-std::array<float,2>{0.620973885f, 0.511036217f},
-std::array<float,2>{0.549979031f, 0.338931501f},
-std::array<float,2>{0.365810007f, 0.979075611f},
-std::array<float,2>{0.132761672f, 0.201444656f},
-std::array<float,2>{0.885887682f, 0.729246497f},
-std::array<float,2>{0.814478517f, 0.0535936058f},
-std::array<float,2>{0.0914561078f, 0.565674126f},
-std::array<float,2>{0.492425501f, 0.383228689f},
-std::array<float,2>{0.687137187f, 0.827847242f},
-std::array<float,2>{0.579980612f, 0.105645902f},
-std::array<float,2>{0.270235479f, 0.562089801f},
-std::array<float,2>{0.245511979f, 0.464898884f},
-std::array<float,2>{0.954780579f, 0.80115056f},
-std::array<float,2>{0.811738312f, 0.296986014f},
-std::array<float,2>{0.0545357578f, 0.908693671f},
-std::array<float,2>{0.39915812f, 0.150248364f},
-std::array<float,2>{0.719621778f, 0.66841507f},
-std::array<float,2>{0.625753522f, 0.431839287f},
-std::array<float,2>{0.463751256f, 0.854036629f},
-std::array<float,2>{0.0987793803f, 0.00104667293f},
-std::array<float,2>{0.87006706f, 0.609701395f},
-std::array<float,2>{0.934792995f, 0.232951865f},
-std::array<float,2>{0.17443414f, 0.7025792f},
-std::array<float,2>{0.32324326f, 0.34615317f},
-std::array<float,2>{0.526535571f, 0.957587779f},
-std::array<float,2>{0.513014317f, 0.2158961f},
-std::array<float,2>{0.340672612f, 0.739379644f},
-std::array<float,2>{0.159405351f, 0.318103671f},
-std::array<float,2>{0.911871791f, 0.988813639f},
-std::array<float,2>{0.858808577f, 0.393368244f},
-std::array<float,2>{0.119192429f, 0.833575785f},
-std::array<float,2>{0.45012331f, 0.0338009074f},
-std::array<float,2>{0.640964746f, 0.581007481f},
-std::array<float,2>{0.74718833f, 0.264538199f},
-std::array<float,2>{0.386501431f, 0.894056618f},
-std::array<float,2>{0.0323727019f, 0.160072431f},
-std::array<float,2>{0.788985491f, 0.637239337f},
-std::array<float,2>{0.945455015f, 0.0711967349f},
-std::array<float,2>{0.230675921f, 0.528517485f},
-std::array<float,2>{0.264491469f, 0.485537022f},
-std::array<float,2>{0.578049958f, 0.774482667f},
-std::array<float,2>{0.658748865f, 0.0199170094f},
-std::array<float,2>{0.477735311f, 0.595977128f},
-std::array<float,2>{0.0733558089f, 0.406558186f},
-std::array<float,2>{0.84353596f, 0.869376898f},
-std::array<float,2>{0.904315829f, 0.366989702f},
-std::array<float,2>{0.1421635f, 0.944533527f},
-std::array<float,2>{0.357287824f, 0.246161327f},
-std::array<float,2>{0.544815958f, 0.705311894f},
-std::array<float,2>{0.605342269f, 0.44616428f},
-std::array<float,2>{0.305668712f, 0.786675453f},
-std::array<float,2>{0.192364648f, 0.123445012f},
-std::array<float,2>{0.988720775f, 0.546514869f},
-std::array<float,2>{0.751748919f, 0.130237758f},
-std::array<float,2>{0.0139103318f, 0.673402429f},
-std::array<float,2>{0.436631709f, 0.29415682f},
-std::array<float,2>{0.718635738f, 0.922494888f},
-std::array<float,2>{0.680664897f, 0.13984324f},
-std::array<float,2>{0.497325689f, 0.682286441f},
-std::array<float,2>{0.088648282f, 0.283075035f},
-std::array<float,2>{0.817703903f, 0.930995464f},
-std::array<float,2>{0.88814503f, 0.441333681f},
-std::array<float,2>{0.128359035f, 0.791195571f},
-std::array<float,2>{0.359422892f, 0.116378315f},
-std::array<float,2>{0.551282048f, 0.53619951f},
-std::array<float,2>{0.621404469f, 0.374226958f},
-std::array<float,2>{0.285516202f, 0.946525931f},
-std::array<float,2>{0.203633383f, 0.238029867f},
-std::array<float,2>{0.974214435f, 0.71712476f},
-std::array<float,2>{0.768979788f, 0.02588108f},
-std::array<float,2>{0.0264757611f, 0.604303181f},
-std::array<float,2>{0.407080024f, 0.418051869f},
-std::array<float,2>{0.699167371f, 0.86059165f},
-std::array<float,2>{0.527864337f, 0.0630384386f},
-std::array<float,2>{0.326182306f, 0.520565569f},
-std::array<float,2>{0.17898652f, 0.495555937f},
-std::array<float,2>{0.931151807f, 0.770110369f},
-std::array<float,2>{0.872584522f, 0.254506081f},
-std::array<float,2>{0.0972272232f, 0.90472424f},
-std::array<float,2>{0.465300441f, 0.166585043f},
-std::array<float,2>{0.631604254f, 0.627981663f},
-std::array<float,2>{0.725841701f, 0.403525949f},
-std::array<float,2>{0.402644753f, 0.836999595f},
-std::array<float,2>{0.050698705f, 0.0417117663f},
-std::array<float,2>{0.806850255f, 0.590243042f},
-std::array<float,2>{0.95924896f, 0.205185831f},
-std::array<float,2>{0.246187657f, 0.74947685f},
-std::array<float,2>{0.267856985f, 0.325482428f},
-std::array<float,2>{0.584713876f, 0.997746825f},
-std::array<float,2>{0.572622359f, 0.22258772f},
-std::array<float,2>{0.25879243f, 0.688406765f},
-std::array<float,2>{0.229636669f, 0.353716671f},
-std::array<float,2>{0.95302093f, 0.9610129f},
-std::array<float,2>{0.781939864f, 0.427264065f},
-std::array<float,2>{0.0384715386f, 0.849946439f},
-std::array<float,2>{0.386928946f, 0.0142848119f},
-std::array<float,2>{0.745697677f, 0.619004965f},
-std::array<float,2>{0.645743787f, 0.30782944f},
-std::array<float,2>{0.447345495f, 0.917618573f},
-std::array<float,2>{0.124579445f, 0.146445811f},
-std::array<float,2>{0.853709817f, 0.662882805f},
-std::array<float,2>{0.908930838f, 0.0973322093f},
-std::array<float,2>{0.160162255f, 0.547584116f},
-std::array<float,2>{0.338900119f, 0.459461272f},
-std::array<float,2>{0.509993196f, 0.807308674f},
-std::array<float,2>{0.714234591f, 0.060435012f},
-std::array<float,2>{0.433027595f, 0.572449744f},
-std::array<float,2>{0.00885490514f, 0.380020499f},
-std::array<float,2>{0.754116535f, 0.814255118f},
-std::array<float,2>{0.986016035f, 0.335406601f},
-std::array<float,2>{0.189282209f, 0.969018698f},
-std::array<float,2>{0.309952617f, 0.190454453f},
-std::array<float,2>{0.606734633f, 0.721662998f},
-std::array<float,2>{0.542254925f, 0.475108057f},
-std::array<float,2>{0.352867484f, 0.764152646f},
-std::array<float,2>{0.1477485f, 0.0921415463f},
-std::array<float,2>{0.901219308f, 0.504370511f},
-std::array<float,2>{0.839519858f, 0.172512501f},
-std::array<float,2>{0.0763316229f, 0.654296935f},
-std::array<float,2>{0.482556701f, 0.273160636f},
-std::array<float,2>{0.660970151f, 0.885978699f},
-std::array<float,2>{0.741544425f, 0.197987407f},
-std::array<float,2>{0.376627833f, 0.731882632f},
-std::array<float,2>{0.0427537486f, 0.342428893f},
-std::array<float,2>{0.796577036f, 0.980508804f},
-std::array<float,2>{0.940290272f, 0.389526963f},
-std::array<float,2>{0.221554726f, 0.823797703f},
-std::array<float,2>{0.256129891f, 0.0485460497f},
-std::array<float,2>{0.566783786f, 0.569104493f},
-std::array<float,2>{0.502810597f, 0.280248374f},
-std::array<float,2>{0.334049076f, 0.876344204f},
-std::array<float,2>{0.168958589f, 0.186255783f},
-std::array<float,2>{0.921497107f, 0.642259598f},
-std::array<float,2>{0.849831223f, 0.0828796178f},
-std::array<float,2>{0.110558905f, 0.513229907f},
-std::array<float,2>{0.444710702f, 0.47983858f},
-std::array<float,2>{0.655333281f, 0.755769908f},
-std::array<float,2>{0.594817579f, 0.00661532162f},
-std::array<float,2>{0.304484516f, 0.613281608f},
-std::array<float,2>{0.200970516f, 0.435442597f},
-std::array<float,2>{0.993729413f, 0.855949163f},
-std::array<float,2>{0.760673523f, 0.350560516f},
-std::array<float,2>{0.00721244095f, 0.953756154f},
-std::array<float,2>{0.422571868f, 0.226566419f},
-std::array<float,2>{0.708892465f, 0.697166443f},
-std::array<float,2>{0.668401659f, 0.464745581f},
-std::array<float,2>{0.473811954f, 0.797510803f},
-std::array<float,2>{0.0637929142f, 0.103480384f},
-std::array<float,2>{0.833726048f, 0.557487071f},
-std::array<float,2>{0.897875488f, 0.155053645f},
-std::array<float,2>{0.14960067f, 0.665256381f},
-std::array<float,2>{0.350239515f, 0.302640945f},
-std::array<float,2>{0.531680644f, 0.912403286f},
-std::array<float,2>{0.558391929f, 0.163980335f},
-std::array<float,2>{0.371973127f, 0.63603735f},
-std::array<float,2>{0.136175931f, 0.261195421f},
-std::array<float,2>{0.877773762f, 0.89499867f},
-std::array<float,2>{0.821582794f, 0.489257246f},
-std::array<float,2>{0.0843402222f, 0.779266655f},
-std::array<float,2>{0.487252027f, 0.0758904442f},
-std::array<float,2>{0.678389013f, 0.524241209f},
-std::array<float,2>{0.689207017f, 0.315166175f},
-std::array<float,2>{0.419862181f, 0.984832585f},
-std::array<float,2>{0.0215666536f, 0.213321432f},
-std::array<float,2>{0.777049243f, 0.737914324f},
-std::array<float,2>{0.979660988f, 0.0372398049f},
-std::array<float,2>{0.215871543f, 0.584547877f},
-std::array<float,2>{0.289764553f, 0.395740449f},
-std::array<float,2>{0.609909236f, 0.829887629f},
-std::array<float,2>{0.634524047f, 0.120998934f},
-std::array<float,2>{0.456818998f, 0.540370643f},
-std::array<float,2>{0.101693749f, 0.450532317f},
-std::array<float,2>{0.861667633f, 0.783962786f},
-std::array<float,2>{0.924833238f, 0.291877449f},
-std::array<float,2>{0.185617745f, 0.927417755f},
-std::array<float,2>{0.315562636f, 0.125817105f},
-std::array<float,2>{0.522858799f, 0.679354906f},
-std::array<float,2>{0.591958284f, 0.410186797f},
-std::array<float,2>{0.274760067f, 0.871719897f},
-std::array<float,2>{0.24139671f, 0.0185852032f},
-std::array<float,2>{0.967581749f, 0.600913107f},
-std::array<float,2>{0.80218029f, 0.244056702f},
-std::array<float,2>{0.0624149926f, 0.707673728f},
-std::array<float,2>{0.392392218f, 0.359851837f},
-std::array<float,2>{0.728404582f, 0.939491272f},
-std::array<float,2>{0.670090973f, 0.227848753f},
-std::array<float,2>{0.475185156f, 0.695676088f},
-std::array<float,2>{0.0663431361f, 0.351509362f},
-std::array<float,2>{0.835105836f, 0.954314947f},
-std::array<float,2>{0.895832002f, 0.43414396f},
-std::array<float,2>{0.150837913f, 0.856957793f},
-std::array<float,2>{0.348421127f, 0.00712616416f},
-std::array<float,2>{0.535116851f, 0.61475724f},
-std::array<float,2>{0.597060323f, 0.301620126f},
-std::array<float,2>{0.302660674f, 0.913113117f},
-std::array<float,2>{0.201230422f, 0.156123191f},
-std::array<float,2>{0.99481231f, 0.664194882f},
-std::array<float,2>{0.758209765f, 0.101622999f},
-std::array<float,2>{0.00572651904f, 0.55846858f},
-std::array<float,2>{0.423834503f, 0.463024437f},
-std::array<float,2>{0.709384024f, 0.797963738f},
-std::array<float,2>{0.501273155f, 0.0475545265f},
-std::array<float,2>{0.333201259f, 0.570289493f},
-std::array<float,2>{0.171678945f, 0.390178412f},
-std::array<float,2>{0.918239951f, 0.823169827f},
-std::array<float,2>{0.848517954f, 0.343216091f},
-std::array<float,2>{0.112446338f, 0.981662333f},
-std::array<float,2>{0.441551149f, 0.198797956f},
-std::array<float,2>{0.65425694f, 0.730856657f},
-std::array<float,2>{0.739414155f, 0.479426026f},
-std::array<float,2>{0.377484441f, 0.754540145f},
-std::array<float,2>{0.0393057205f, 0.0830298588f},
-std::array<float,2>{0.79332459f, 0.511947215f},
-std::array<float,2>{0.938777506f, 0.187175795f},
-std::array<float,2>{0.220029026f, 0.641349494f},
-std::array<float,2>{0.255782336f, 0.280706823f},
-std::array<float,2>{0.569779634f, 0.875310242f},
-std::array<float,2>{0.590453088f, 0.126771659f},
-std::array<float,2>{0.277304679f, 0.678071201f},
-std::array<float,2>{0.239637151f, 0.292512149f},
-std::array<float,2>{0.964857876f, 0.926203668f},
-std::array<float,2>{0.803580642f, 0.449392617f},
-std::array<float,2>{0.0601788051f, 0.784793198f},
-std::array<float,2>{0.39448607f, 0.119749747f},
-std::array<float,2>{0.729471922f, 0.539788544f},
-std::array<float,2>{0.635753572f, 0.361183375f},
-std::array<float,2>{0.453413814f, 0.941055417f},
-std::array<float,2>{0.104068726f, 0.242726743f},
-std::array<float,2>{0.860111296f, 0.708431959f},
-std::array<float,2>{0.922145247f, 0.0178910159f},
-std::array<float,2>{0.184466586f, 0.599611223f},
-std::array<float,2>{0.312559754f, 0.412005693f},
-std::array<float,2>{0.520772159f, 0.872556567f},
-std::array<float,2>{0.690125942f, 0.0746476054f},
-std::array<float,2>{0.421293467f, 0.524883926f},
-std::array<float,2>{0.0202692356f, 0.489482313f},
-std::array<float,2>{0.774292648f, 0.778189719f},
-std::array<float,2>{0.977333307f, 0.260388851f},
-std::array<float,2>{0.218244076f, 0.89555341f},
-std::array<float,2>{0.291053891f, 0.162567928f},
-std::array<float,2>{0.612725198f, 0.635608017f},
-std::array<float,2>{0.55649507f, 0.394681931f},
-std::array<float,2>{0.374162257f, 0.829053164f},
-std::array<float,2>{0.133931085f, 0.0389020741f},
-std::array<float,2>{0.875870585f, 0.585814059f},
-std::array<float,2>{0.823167861f, 0.214245811f},
-std::array<float,2>{0.0830449313f, 0.737105429f},
-std::array<float,2>{0.485881686f, 0.315979302f},
-std::array<float,2>{0.676624954f, 0.986110091f},
-std::array<float,2>{0.72318995f, 0.16750592f},
-std::array<float,2>{0.404569149f, 0.627436101f},
-std::array<float,2>{0.04783329f, 0.255550355f},
-std::array<float,2>{0.805050492f, 0.905433178f},
-std::array<float,2>{0.957900584f, 0.494968593f},
-std::array<float,2>{0.249468789f, 0.771267712f},
-std::array<float,2>{0.266881257f, 0.0642816871f},
-std::array<float,2>{0.583273709f, 0.519818842f},
-std::array<float,2>{0.530081749f, 0.325170368f},
-std::array<float,2>{0.324764907f, 0.996854126f},
-std::array<float,2>{0.175905585f, 0.206323892f},
-std::array<float,2>{0.933521152f, 0.748223126f},
-std::array<float,2>{0.874774754f, 0.0427576229f},
-std::array<float,2>{0.0948861465f, 0.591169119f},
-std::array<float,2>{0.46730417f, 0.402974367f},
-std::array<float,2>{0.629179955f, 0.836093128f},
-std::array<float,2>{0.624039471f, 0.115585081f},
-std::array<float,2>{0.28853187f, 0.535749316f},
-std::array<float,2>{0.206950188f, 0.439958841f},
-std::array<float,2>{0.975274563f, 0.792145789f},
-std::array<float,2>{0.766416848f, 0.281482935f},
-std::array<float,2>{0.0248008575f, 0.929797053f},
-std::array<float,2>{0.410122186f, 0.139218599f},
-std::array<float,2>{0.696174741f, 0.682668865f},
-std::array<float,2>{0.683034182f, 0.419394732f},
-std::array<float,2>{0.498464316f, 0.859444141f},
-std::array<float,2>{0.0868691131f, 0.0271306038f},
-std::array<float,2>{0.82025224f, 0.605435371f},
-std::array<float,2>{0.890380263f, 0.236754671f},
-std::array<float,2>{0.125850648f, 0.71841532f},
-std::array<float,2>{0.362674385f, 0.373232871f},
-std::array<float,2>{0.552984893f, 0.945927918f},
-std::array<float,2>{0.539861798f, 0.189551666f},
-std::array<float,2>{0.354321569f, 0.722457409f},
-std::array<float,2>{0.145463869f, 0.334247082f},
-std::array<float,2>{0.899360061f, 0.970639765f},
-std::array<float,2>{0.836470008f, 0.378921151f},
-std::array<float,2>{0.0742741376f, 0.812662363f},
-std::array<float,2>{0.481339812f, 0.0593320914f},
-std::array<float,2>{0.663803697f, 0.57394731f},
-std::array<float,2>{0.712098956f, 0.2721892f},
-std::array<float,2>{0.431411058f, 0.885454535f},
-std::array<float,2>{0.0108432937f, 0.173132569f},
-std::array<float,2>{0.756563604f, 0.65563494f},
-std::array<float,2>{0.987077355f, 0.0933012143f},
-std::array<float,2>{0.191205218f, 0.505404353f},
-std::array<float,2>{0.312491804f, 0.475924402f},
-std::array<float,2>{0.609247565f, 0.76484251f},
-std::array<float,2>{0.64761126f, 0.015202431f},
-std::array<float,2>{0.445500404f, 0.617227614f},
-std::array<float,2>{0.122458614f, 0.426610857f},
-std::array<float,2>{0.852667391f, 0.850598872f},
-std::array<float,2>{0.908071041f, 0.354546577f},
-std::array<float,2>{0.162768587f, 0.962872803f},
-std::array<float,2>{0.336129099f, 0.220890164f},
-std::array<float,2>{0.509612441f, 0.688753545f},
-std::array<float,2>{0.570481896f, 0.460657209f},
-std::array<float,2>{0.260995239f, 0.807775199f},
-std::array<float,2>{0.227403089f, 0.095956549f},
-std::array<float,2>{0.949445546f, 0.547972322f},
-std::array<float,2>{0.783674181f, 0.145187885f},
-std::array<float,2>{0.0368377194f, 0.663772821f},
-std::array<float,2>{0.390329242f, 0.306733757f},
-std::array<float,2>{0.742793202f, 0.91684711f},
-std::array<float,2>{0.627213478f, 0.149099857f},
-std::array<float,2>{0.461042523f, 0.669268906f},
-std::array<float,2>{0.101011045f, 0.298179537f},
-std::array<float,2>{0.867831886f, 0.909854293f},
-std::array<float,2>{0.936326742f, 0.466781616f},
-std::array<float,2>{0.172927096f, 0.80179733f},
-std::array<float,2>{0.322133005f, 0.107067004f},
-std::array<float,2>{0.524273396f, 0.561081588f},
-std::array<float,2>{0.580528319f, 0.347085834f},
-std::array<float,2>{0.2726897f, 0.958501518f},
-std::array<float,2>{0.242210597f, 0.233982608f},
-std::array<float,2>{0.956865788f, 0.701283336f},
-std::array<float,2>{0.809373856f, 0.000306883157f},
-std::array<float,2>{0.0519734696f, 0.610973597f},
-std::array<float,2>{0.401701689f, 0.43354845f},
-std::array<float,2>{0.721577942f, 0.855160415f},
-std::array<float,2>{0.548721969f, 0.079970926f},
-std::array<float,2>{0.363554925f, 0.510693669f},
-std::array<float,2>{0.13084203f, 0.483772635f},
-std::array<float,2>{0.884114206f, 0.752350569f},
-std::array<float,2>{0.813456953f, 0.277052552f},
-std::array<float,2>{0.092497617f, 0.880827785f},
-std::array<float,2>{0.494894773f, 0.182019532f},
-std::array<float,2>{0.685264468f, 0.647843301f},
-std::array<float,2>{0.701961577f, 0.383825272f},
-std::array<float,2>{0.412647039f, 0.82692945f},
-std::array<float,2>{0.0293806009f, 0.0544797555f},
-std::array<float,2>{0.772653282f, 0.56456852f},
-std::array<float,2>{0.969421923f, 0.202214882f},
-std::array<float,2>{0.210471064f, 0.730359435f},
-std::array<float,2>{0.283049017f, 0.33829695f},
-std::array<float,2>{0.618773758f, 0.980300605f},
-std::array<float,2>{0.60223937f, 0.247717127f},
-std::array<float,2>{0.306805849f, 0.70623374f},
-std::array<float,2>{0.194086939f, 0.365900159f},
-std::array<float,2>{0.990837872f, 0.94418937f},
-std::array<float,2>{0.752059877f, 0.407797188f},
-std::array<float,2>{0.0134740984f, 0.871082485f},
-std::array<float,2>{0.434217036f, 0.0206974875f},
-std::array<float,2>{0.714990497f, 0.597639859f},
-std::array<float,2>{0.658006608f, 0.29372403f},
-std::array<float,2>{0.480077654f, 0.923379242f},
-std::array<float,2>{0.0714275464f, 0.129717156f},
-std::array<float,2>{0.841618419f, 0.672105849f},
-std::array<float,2>{0.903766692f, 0.12404868f},
-std::array<float,2>{0.143382475f, 0.545004904f},
-std::array<float,2>{0.357467145f, 0.447184056f},
-std::array<float,2>{0.544965506f, 0.785250366f},
-std::array<float,2>{0.748475671f, 0.034186922f},
-std::array<float,2>{0.384337157f, 0.581270099f},
-std::array<float,2>{0.0334930532f, 0.39449358f},
-std::array<float,2>{0.785741746f, 0.832506597f},
-std::array<float,2>{0.948189974f, 0.316933393f},
-std::array<float,2>{0.232859686f, 0.989656746f},
-std::array<float,2>{0.262892514f, 0.214981437f},
-std::array<float,2>{0.574807763f, 0.739167035f},
-std::array<float,2>{0.514331877f, 0.484863579f},
-std::array<float,2>{0.341999173f, 0.77369374f},
-std::array<float,2>{0.156827658f, 0.0719969273f},
-std::array<float,2>{0.912728012f, 0.528129935f},
-std::array<float,2>{0.856487513f, 0.158980608f},
-std::array<float,2>{0.118818305f, 0.637858093f},
-std::array<float,2>{0.451989383f, 0.265528083f},
-std::array<float,2>{0.643755555f, 0.892993808f},
-std::array<float,2>{0.706746936f, 0.208486542f},
-std::array<float,2>{0.426681697f, 0.743757308f},
-std::array<float,2>{0.00143007503f, 0.32305941f},
-std::array<float,2>{0.763352573f, 0.993448317f},
-std::array<float,2>{0.996379793f, 0.399262965f},
-std::array<float,2>{0.197441086f, 0.840916634f},
-std::array<float,2>{0.29818967f, 0.0463765226f},
-std::array<float,2>{0.598400593f, 0.587251067f},
-std::array<float,2>{0.538165808f, 0.253031045f},
-std::array<float,2>{0.343818963f, 0.899499357f},
-std::array<float,2>{0.154537857f, 0.168492317f},
-std::array<float,2>{0.893410385f, 0.628993213f},
-std::array<float,2>{0.830917895f, 0.0671338364f},
-std::array<float,2>{0.0702151805f, 0.519216716f},
-std::array<float,2>{0.469056487f, 0.499433905f},
-std::array<float,2>{0.664641201f, 0.766536117f},
-std::array<float,2>{0.565729558f, 0.0287872236f},
-std::array<float,2>{0.251230985f, 0.606839359f},
-std::array<float,2>{0.223937392f, 0.41506353f},
-std::array<float,2>{0.943721771f, 0.864290178f},
-std::array<float,2>{0.792790115f, 0.369926065f},
-std::array<float,2>{0.0439533815f, 0.950184643f},
-std::array<float,2>{0.382337928f, 0.239436403f},
-std::array<float,2>{0.735517383f, 0.714711607f},
-std::array<float,2>{0.650572956f, 0.444871873f},
-std::array<float,2>{0.437595397f, 0.793777943f},
-std::array<float,2>{0.116539046f, 0.111690693f},
-std::array<float,2>{0.846789181f, 0.532598674f},
-std::array<float,2>{0.916732967f, 0.135706872f},
-std::array<float,2>{0.165778548f, 0.686368763f},
-std::array<float,2>{0.329681456f, 0.286558568f},
-std::array<float,2>{0.506518066f, 0.935731709f},
-std::array<float,2>{0.515673399f, 0.178522572f},
-std::array<float,2>{0.31970191f, 0.648542225f},
-std::array<float,2>{0.180284142f, 0.266969413f},
-std::array<float,2>{0.926745594f, 0.888497055f},
-std::array<float,2>{0.863780975f, 0.472097814f},
-std::array<float,2>{0.108454376f, 0.760669947f},
-std::array<float,2>{0.459495872f, 0.0877448767f},
-std::array<float,2>{0.638009489f, 0.50087744f},
-std::array<float,2>{0.733737051f, 0.330894798f},
-std::array<float,2>{0.396099389f, 0.974095881f},
-std::array<float,2>{0.0571619123f, 0.193069369f},
-std::array<float,2>{0.80010736f, 0.725511849f},
-std::array<float,2>{0.963767231f, 0.0572587438f},
-std::array<float,2>{0.238091365f, 0.575559556f},
-std::array<float,2>{0.280788422f, 0.377137989f},
-std::array<float,2>{0.589506388f, 0.818007767f},
-std::array<float,2>{0.673070967f, 0.10061492f},
-std::array<float,2>{0.491471857f, 0.552039564f},
-std::array<float,2>{0.0809694082f, 0.455522895f},
-std::array<float,2>{0.825511396f, 0.810019612f},
-std::array<float,2>{0.881437719f, 0.308917612f},
-std::array<float,2>{0.137152344f, 0.919256508f},
-std::array<float,2>{0.368713349f, 0.14429222f},
-std::array<float,2>{0.562048435f, 0.656936586f},
-std::array<float,2>{0.614644647f, 0.423666f},
-std::array<float,2>{0.296100408f, 0.8462798f},
-std::array<float,2>{0.212782979f, 0.00994770229f},
-std::array<float,2>{0.982779622f, 0.621908367f},
-std::array<float,2>{0.77885288f, 0.226426065f},
-std::array<float,2>{0.0194584969f, 0.692463458f},
-std::array<float,2>{0.417887777f, 0.356684864f},
-std::array<float,2>{0.691723287f, 0.968150496f},
-std::array<float,2>{0.655609012f, 0.196455821f},
-std::array<float,2>{0.444485515f, 0.732783496f},
-std::array<float,2>{0.110665701f, 0.341339767f},
-std::array<float,2>{0.849932849f, 0.982939124f},
-std::array<float,2>{0.921635151f, 0.387212306f},
-std::array<float,2>{0.169431597f, 0.820419788f},
-std::array<float,2>{0.334240437f, 0.0492655747f},
-std::array<float,2>{0.502613664f, 0.566482008f},
-std::array<float,2>{0.566462576f, 0.27850756f},
-std::array<float,2>{0.255892485f, 0.878061652f},
-std::array<float,2>{0.221415997f, 0.184930697f},
-std::array<float,2>{0.940124333f, 0.644093513f},
-std::array<float,2>{0.796670675f, 0.0847368017f},
-std::array<float,2>{0.042636551f, 0.514200509f},
-std::array<float,2>{0.376751393f, 0.478108108f},
-std::array<float,2>{0.741234481f, 0.757287204f},
-std::array<float,2>{0.531362236f, 0.00425053108f},
-std::array<float,2>{0.350427121f, 0.616796196f},
-std::array<float,2>{0.149688676f, 0.437270463f},
-std::array<float,2>{0.897612214f, 0.858481944f},
-std::array<float,2>{0.833844364f, 0.348526388f},
-std::array<float,2>{0.0636021122f, 0.95571214f},
-std::array<float,2>{0.474091768f, 0.229797229f},
-std::array<float,2>{0.667974055f, 0.699082077f},
-std::array<float,2>{0.708694398f, 0.460955232f},
-std::array<float,2>{0.422651619f, 0.799714088f},
-std::array<float,2>{0.0069994363f, 0.105217107f},
-std::array<float,2>{0.760397553f, 0.555640399f},
-std::array<float,2>{0.994045496f, 0.152506351f},
-std::array<float,2>{0.200857043f, 0.66759032f},
-std::array<float,2>{0.304404676f, 0.303153217f},
-std::array<float,2>{0.595203042f, 0.910814464f},
-std::array<float,2>{0.610315681f, 0.160675675f},
-std::array<float,2>{0.289935023f, 0.632853448f},
-std::array<float,2>{0.216283083f, 0.258729041f},
-std::array<float,2>{0.979920983f, 0.897548079f},
-std::array<float,2>{0.777292788f, 0.490734905f},
-std::array<float,2>{0.0219026785f, 0.779395223f},
-std::array<float,2>{0.419507593f, 0.0774035007f},
-std::array<float,2>{0.689348757f, 0.525443494f},
-std::array<float,2>{0.678709507f, 0.313672334f},
-std::array<float,2>{0.48684451f, 0.987536669f},
-std::array<float,2>{0.084087953f, 0.21226427f},
-std::array<float,2>{0.821401f, 0.735828698f},
-std::array<float,2>{0.877670884f, 0.0361012407f},
-std::array<float,2>{0.135756254f, 0.583333194f},
-std::array<float,2>{0.371584356f, 0.396708429f},
-std::array<float,2>{0.558288991f, 0.831573009f},
-std::array<float,2>{0.728247225f, 0.117436208f},
-std::array<float,2>{0.39218998f, 0.542282224f},
-std::array<float,2>{0.0620479807f, 0.451424211f},
-std::array<float,2>{0.801838696f, 0.782814324f},
-std::array<float,2>{0.967415392f, 0.290924907f},
-std::array<float,2>{0.241501689f, 0.929447353f},
-std::array<float,2>{0.274419844f, 0.128301054f},
-std::array<float,2>{0.592111826f, 0.677035332f},
-std::array<float,2>{0.522633076f, 0.413040847f},
-std::array<float,2>{0.315772116f, 0.873161495f},
-std::array<float,2>{0.185940608f, 0.0158387981f},
-std::array<float,2>{0.925161958f, 0.599369764f},
-std::array<float,2>{0.861421406f, 0.244571462f},
-std::array<float,2>{0.101939611f, 0.710012734f},
-std::array<float,2>{0.456590027f, 0.36249578f},
-std::array<float,2>{0.634340644f, 0.939212441f},
-std::array<float,2>{0.698870361f, 0.137279704f},
-std::array<float,2>{0.406954765f, 0.679952204f},
-std::array<float,2>{0.0267300606f, 0.283565104f},
-std::array<float,2>{0.768616736f, 0.931964576f},
-std::array<float,2>{0.974425435f, 0.439398706f},
-std::array<float,2>{0.203926399f, 0.789239645f},
-std::array<float,2>{0.285396218f, 0.113453716f},
-std::array<float,2>{0.62116611f, 0.538068235f},
-std::array<float,2>{0.551694334f, 0.373015016f},
-std::array<float,2>{0.359805465f, 0.948117495f},
-std::array<float,2>{0.128078297f, 0.235065013f},
-std::array<float,2>{0.887722015f, 0.715245724f},
-std::array<float,2>{0.817612052f, 0.0250876024f},
-std::array<float,2>{0.0885843486f, 0.60203743f},
-std::array<float,2>{0.497110009f, 0.420981407f},
-std::array<float,2>{0.680943012f, 0.861731052f},
-std::array<float,2>{0.584768116f, 0.06582506f},
-std::array<float,2>{0.267813027f, 0.522479355f},
-std::array<float,2>{0.246422768f, 0.493612289f},
-std::array<float,2>{0.959051847f, 0.772394538f},
-std::array<float,2>{0.807004333f, 0.257747144f},
-std::array<float,2>{0.0503863022f, 0.903623581f},
-std::array<float,2>{0.402579904f, 0.164475113f},
-std::array<float,2>{0.725622594f, 0.626739919f},
-std::array<float,2>{0.631451309f, 0.404661238f},
-std::array<float,2>{0.464848965f, 0.838972628f},
-std::array<float,2>{0.0974398926f, 0.0406022295f},
-std::array<float,2>{0.872860193f, 0.592008471f},
-std::array<float,2>{0.930704713f, 0.204289466f},
-std::array<float,2>{0.178911373f, 0.747153699f},
-std::array<float,2>{0.326447368f, 0.327492207f},
-std::array<float,2>{0.528121412f, 0.999034762f},
-std::array<float,2>{0.510242343f, 0.220061645f},
-std::array<float,2>{0.339117467f, 0.689697206f},
-std::array<float,2>{0.160461307f, 0.353320539f},
-std::array<float,2>{0.909045935f, 0.964737236f},
-std::array<float,2>{0.853825927f, 0.428858966f},
-std::array<float,2>{0.124815233f, 0.847958446f},
-std::array<float,2>{0.447522968f, 0.0129718371f},
-std::array<float,2>{0.645880163f, 0.619896352f},
-std::array<float,2>{0.745869994f, 0.305638582f},
-std::array<float,2>{0.387167305f, 0.914294541f},
-std::array<float,2>{0.0381477475f, 0.147068039f},
-std::array<float,2>{0.782136142f, 0.661712646f},
-std::array<float,2>{0.952837646f, 0.0956707522f},
-std::array<float,2>{0.229893312f, 0.549149573f},
-std::array<float,2>{0.259053022f, 0.457087904f},
-std::array<float,2>{0.572370291f, 0.80470556f},
-std::array<float,2>{0.660665035f, 0.062210314f},
-std::array<float,2>{0.482683063f, 0.571061015f},
-std::array<float,2>{0.0764405206f, 0.382131487f},
-std::array<float,2>{0.839749396f, 0.8151021f},
-std::array<float,2>{0.900950611f, 0.332673103f},
-std::array<float,2>{0.147645175f, 0.970703423f},
-std::array<float,2>{0.352756292f, 0.18781735f},
-std::array<float,2>{0.542105794f, 0.719130337f},
-std::array<float,2>{0.606554627f, 0.474025667f},
-std::array<float,2>{0.309739918f, 0.762174547f},
-std::array<float,2>{0.189073786f, 0.0901913792f},
-std::array<float,2>{0.986233711f, 0.50709182f},
-std::array<float,2>{0.754293382f, 0.175582603f},
-std::array<float,2>{0.00909538101f, 0.653320909f},
-std::array<float,2>{0.432767421f, 0.270931214f},
-std::array<float,2>{0.713871837f, 0.882907212f},
-std::array<float,2>{0.687386334f, 0.181518897f},
-std::array<float,2>{0.492462754f, 0.645228803f},
-std::array<float,2>{0.0915878266f, 0.274592936f},
-std::array<float,2>{0.814703643f, 0.882240415f},
-std::array<float,2>{0.886164427f, 0.480567783f},
-std::array<float,2>{0.13239412f, 0.750884116f},
-std::array<float,2>{0.365970016f, 0.0802665725f},
-std::array<float,2>{0.550151527f, 0.508482397f},
-std::array<float,2>{0.620655179f, 0.337316334f},
-std::array<float,2>{0.283457428f, 0.977860391f},
-std::array<float,2>{0.208363563f, 0.199456304f},
-std::array<float,2>{0.972640932f, 0.728502572f},
-std::array<float,2>{0.770124018f, 0.0519154668f},
-std::array<float,2>{0.0276039653f, 0.563387334f},
-std::array<float,2>{0.41038686f, 0.384916216f},
-std::array<float,2>{0.700389683f, 0.824940443f},
-std::array<float,2>{0.526782334f, 0.108657457f},
-std::array<float,2>{0.323698699f, 0.560254514f},
-std::array<float,2>{0.174583912f, 0.467866182f},
-std::array<float,2>{0.934896886f, 0.80418855f},
-std::array<float,2>{0.869829059f, 0.299011022f},
-std::array<float,2>{0.0990606397f, 0.907079697f},
-std::array<float,2>{0.463548034f, 0.151750311f},
-std::array<float,2>{0.625513136f, 0.670624673f},
-std::array<float,2>{0.719314933f, 0.431528658f},
-std::array<float,2>{0.399198711f, 0.853283703f},
-std::array<float,2>{0.0543780476f, 0.00353882741f},
-std::array<float,2>{0.811846554f, 0.612707496f},
-std::array<float,2>{0.954909086f, 0.231870577f},
-std::array<float,2>{0.245214507f, 0.699941695f},
-std::array<float,2>{0.270399243f, 0.343871742f},
-std::array<float,2>{0.57961005f, 0.960699379f},
-std::array<float,2>{0.577649653f, 0.217229277f},
-std::array<float,2>{0.264252692f, 0.740908742f},
-std::array<float,2>{0.230751187f, 0.319416434f},
-std::array<float,2>{0.945614278f, 0.991695404f},
-std::array<float,2>{0.788612545f, 0.391007662f},
-std::array<float,2>{0.0324855372f, 0.834630728f},
-std::array<float,2>{0.386422783f, 0.0331061035f},
-std::array<float,2>{0.747340441f, 0.578151405f},
-std::array<float,2>{0.640799999f, 0.262732685f},
-std::array<float,2>{0.449724734f, 0.891749203f},
-std::array<float,2>{0.119584978f, 0.157099694f},
-std::array<float,2>{0.858605564f, 0.639176726f},
-std::array<float,2>{0.911722004f, 0.0729159042f},
-std::array<float,2>{0.159653872f, 0.529765129f},
-std::array<float,2>{0.34047088f, 0.487551242f},
-std::array<float,2>{0.512929142f, 0.775788844f},
-std::array<float,2>{0.718501866f, 0.0234187394f},
-std::array<float,2>{0.43678093f, 0.594503224f},
-std::array<float,2>{0.0139275417f, 0.408320576f},
-std::array<float,2>{0.751526177f, 0.86768508f},
-std::array<float,2>{0.988419652f, 0.364817142f},
-std::array<float,2>{0.192115963f, 0.943307936f},
-std::array<float,2>{0.306014359f, 0.248819232f},
-std::array<float,2>{0.605053663f, 0.704521954f},
-std::array<float,2>{0.544630349f, 0.448393106f},
-std::array<float,2>{0.357151538f, 0.789038539f},
-std::array<float,2>{0.142504498f, 0.121870488f},
-std::array<float,2>{0.904666007f, 0.543718278f},
-std::array<float,2>{0.843283772f, 0.132713884f},
-std::array<float,2>{0.0736868083f, 0.674731493f},
-std::array<float,2>{0.477989078f, 0.296290398f},
-std::array<float,2>{0.65896219f, 0.925691128f},
-std::array<float,2>{0.737808466f, 0.240345031f},
-std::array<float,2>{0.379392684f, 0.711017311f},
-std::array<float,2>{0.0450518169f, 0.368117839f},
-std::array<float,2>{0.789835513f, 0.952067912f},
-std::array<float,2>{0.942940891f, 0.416480154f},
-std::array<float,2>{0.226293772f, 0.866835654f},
-std::array<float,2>{0.25321418f, 0.0305130389f},
-std::array<float,2>{0.564032257f, 0.609065831f},
-std::array<float,2>{0.504639685f, 0.288752377f},
-std::array<float,2>{0.331727654f, 0.933700621f},
-std::array<float,2>{0.167755768f, 0.133729532f},
-std::array<float,2>{0.914090514f, 0.683960438f},
-std::array<float,2>{0.84510535f, 0.109618105f},
-std::array<float,2>{0.114776984f, 0.534873545f},
-std::array<float,2>{0.439573169f, 0.441916406f},
-std::array<float,2>{0.648990095f, 0.79619211f},
-std::array<float,2>{0.599899232f, 0.0434331223f},
-std::array<float,2>{0.300750643f, 0.589674234f},
-std::array<float,2>{0.196731478f, 0.401362866f},
-std::array<float,2>{0.99902457f, 0.841820717f},
-std::array<float,2>{0.764138341f, 0.321460634f},
-std::array<float,2>{0.00279350649f, 0.995786786f},
-std::array<float,2>{0.427958816f, 0.210708976f},
-std::array<float,2>{0.704059303f, 0.745098591f},
-std::array<float,2>{0.666650712f, 0.497012407f},
-std::array<float,2>{0.472195208f, 0.769473374f},
-std::array<float,2>{0.0670079887f, 0.068805553f},
-std::array<float,2>{0.828674495f, 0.515929401f},
-std::array<float,2>{0.892358541f, 0.170085579f},
-std::array<float,2>{0.154260561f, 0.631820083f},
-std::array<float,2>{0.347134084f, 0.251377076f},
-std::array<float,2>{0.536742985f, 0.900757253f},
-std::array<float,2>{0.560430586f, 0.142194152f},
-std::array<float,2>{0.370772004f, 0.658263683f},
-std::array<float,2>{0.139974684f, 0.311299652f},
-std::array<float,2>{0.879616499f, 0.920626283f},
-std::array<float,2>{0.826294184f, 0.453976065f},
-std::array<float,2>{0.079273887f, 0.811890781f},
-std::array<float,2>{0.488949716f, 0.0985337272f},
-std::array<float,2>{0.675689638f, 0.55327338f},
-std::array<float,2>{0.693373859f, 0.357817918f},
-std::array<float,2>{0.414106458f, 0.965093732f},
-std::array<float,2>{0.017329419f, 0.224585876f},
-std::array<float,2>{0.779762506f, 0.694142282f},
-std::array<float,2>{0.980697632f, 0.00903697312f},
-std::array<float,2>{0.214793861f, 0.623213887f},
-std::array<float,2>{0.2948035f, 0.425578505f},
-std::array<float,2>{0.6169011f, 0.844961584f},
-std::array<float,2>{0.63885659f, 0.0891580284f},
-std::array<float,2>{0.457750171f, 0.503400505f},
-std::array<float,2>{0.106186293f, 0.470100999f},
-std::array<float,2>{0.866805673f, 0.757872701f},
-std::array<float,2>{0.928685606f, 0.268986672f},
-std::array<float,2>{0.182132766f, 0.890545189f},
-std::array<float,2>{0.316413403f, 0.176013038f},
-std::array<float,2>{0.519237161f, 0.650827587f},
-std::array<float,2>{0.587735951f, 0.37500155f},
-std::array<float,2>{0.27857852f, 0.820215106f},
-std::array<float,2>{0.235256344f, 0.0547914803f},
-std::array<float,2>{0.961919963f, 0.577891767f},
-std::array<float,2>{0.798132837f, 0.194916263f},
-std::array<float,2>{0.0562177747f, 0.722775936f},
-std::array<float,2>{0.397346318f, 0.330067873f},
-std::array<float,2>{0.732368231f, 0.975916088f},
-std::array<float,2>{0.677297533f, 0.211140081f},
-std::array<float,2>{0.484963655f, 0.734774649f},
-std::array<float,2>{0.0823919177f, 0.312782109f},
-std::array<float,2>{0.823390424f, 0.986927569f},
-std::array<float,2>{0.876235545f, 0.398407012f},
-std::array<float,2>{0.133339927f, 0.830150127f},
-std::array<float,2>{0.373908073f, 0.0363860019f},
-std::array<float,2>{0.555367768f, 0.582827091f},
-std::array<float,2>{0.611535549f, 0.258889973f},
-std::array<float,2>{0.292574674f, 0.897279143f},
-std::array<float,2>{0.217418134f, 0.161600485f},
-std::array<float,2>{0.978309989f, 0.633894503f},
-std::array<float,2>{0.774465621f, 0.0771248862f},
-std::array<float,2>{0.0209926069f, 0.526891887f},
-std::array<float,2>{0.420240074f, 0.491341621f},
-std::array<float,2>{0.691340685f, 0.780834556f},
-std::array<float,2>{0.519603789f, 0.0172948409f},
-std::array<float,2>{0.31356889f, 0.598074496f},
-std::array<float,2>{0.184816644f, 0.413417429f},
-std::array<float,2>{0.923065484f, 0.874051273f},
-std::array<float,2>{0.860613644f, 0.362016529f},
-std::array<float,2>{0.104625687f, 0.937887669f},
-std::array<float,2>{0.454529554f, 0.245764256f},
-std::array<float,2>{0.634831429f, 0.709939182f},
-std::array<float,2>{0.72980696f, 0.452460766f},
-std::array<float,2>{0.393521547f, 0.7814973f},
-std::array<float,2>{0.0594760962f, 0.118359707f},
-std::array<float,2>{0.804226816f, 0.5418064f},
-std::array<float,2>{0.966733277f, 0.127040684f},
-std::array<float,2>{0.23831217f, 0.6760813f},
-std::array<float,2>{0.275435328f, 0.289579451f},
-std::array<float,2>{0.591692328f, 0.927987695f},
-std::array<float,2>{0.568949461f, 0.184135944f},
-std::array<float,2>{0.254330903f, 0.643480003f},
-std::array<float,2>{0.219078049f, 0.278016835f},
-std::array<float,2>{0.938310385f, 0.877641559f},
-std::array<float,2>{0.794655919f, 0.47696349f},
-std::array<float,2>{0.0403826758f, 0.756781697f},
-std::array<float,2>{0.378378808f, 0.0850160941f},
-std::array<float,2>{0.738410473f, 0.514906943f},
-std::array<float,2>{0.652847171f, 0.340355188f},
-std::array<float,2>{0.443325371f, 0.983450234f},
-std::array<float,2>{0.111583382f, 0.195399866f},
-std::array<float,2>{0.849187553f, 0.733910918f},
-std::array<float,2>{0.919049799f, 0.0501037762f},
-std::array<float,2>{0.170169756f, 0.568089068f},
-std::array<float,2>{0.332406223f, 0.387879491f},
-std::array<float,2>{0.50014782f, 0.821977675f},
-std::array<float,2>{0.710111618f, 0.10361629f},
-std::array<float,2>{0.425392121f, 0.55580163f},
-std::array<float,2>{0.0040068063f, 0.462725967f},
-std::array<float,2>{0.759151876f, 0.800672114f},
-std::array<float,2>{0.995877862f, 0.303749323f},
-std::array<float,2>{0.203110725f, 0.911651373f},
-std::array<float,2>{0.300963759f, 0.154191896f},
-std::array<float,2>{0.596206427f, 0.666707695f},
-std::array<float,2>{0.53351301f, 0.436058074f},
-std::array<float,2>{0.349011123f, 0.858320177f},
-std::array<float,2>{0.152125984f, 0.00510021765f},
-std::array<float,2>{0.894834101f, 0.615690649f},
-std::array<float,2>{0.834000528f, 0.228565395f},
-std::array<float,2>{0.0650183335f, 0.69757396f},
-std::array<float,2>{0.475804776f, 0.348892331f},
-std::array<float,2>{0.671570778f, 0.956139028f},
-std::array<float,2>{0.74349463f, 0.147547528f},
-std::array<float,2>{0.389286786f, 0.660669804f},
-std::array<float,2>{0.0351624303f, 0.306037724f},
-std::array<float,2>{0.784854352f, 0.915226638f},
-std::array<float,2>{0.951012969f, 0.458739161f},
-std::array<float,2>{0.228081003f, 0.806280673f},
-std::array<float,2>{0.259781837f, 0.0942138582f},
-std::array<float,2>{0.571711242f, 0.549893439f},
-std::array<float,2>{0.508113563f, 0.352235585f},
-std::array<float,2>{0.337673903f, 0.963107765f},
-std::array<float,2>{0.163319007f, 0.218999058f},
-std::array<float,2>{0.906903565f, 0.690620542f},
-std::array<float,2>{0.852150381f, 0.0124202361f},
-std::array<float,2>{0.121195562f, 0.620839417f},
-std::array<float,2>{0.44697693f, 0.42805627f},
-std::array<float,2>{0.646870971f, 0.848870277f},
-std::array<float,2>{0.608060002f, 0.0910644233f},
-std::array<float,2>{0.311446339f, 0.506081522f},
-std::array<float,2>{0.189687192f, 0.473079562f},
-std::array<float,2>{0.987874389f, 0.763328671f},
-std::array<float,2>{0.757695436f, 0.269691348f},
-std::array<float,2>{0.0097707836f, 0.884024203f},
-std::array<float,2>{0.430294484f, 0.174710855f},
-std::array<float,2>{0.710944593f, 0.6529603f},
-std::array<float,2>{0.663040221f, 0.380930305f},
-std::array<float,2>{0.482281238f, 0.81625402f},
-std::array<float,2>{0.0752914026f, 0.0610486083f},
-std::array<float,2>{0.837740898f, 0.571788192f},
-std::array<float,2>{0.899571478f, 0.188793898f},
-std::array<float,2>{0.146338761f, 0.720200002f},
-std::array<float,2>{0.354728907f, 0.333369195f},
-std::array<float,2>{0.540431321f, 0.972429872f},
-std::array<float,2>{0.554193258f, 0.23597756f},
-std::array<float,2>{0.361788183f, 0.71662432f},
-std::array<float,2>{0.126809627f, 0.371345878f},
-std::array<float,2>{0.888862491f, 0.948671639f},
-std::array<float,2>{0.81848222f, 0.42062071f},
-std::array<float,2>{0.087848112f, 0.86249119f},
-std::array<float,2>{0.499515444f, 0.0242254306f},
-std::array<float,2>{0.681803882f, 0.603381276f},
-std::array<float,2>{0.69660455f, 0.285110831f},
-std::array<float,2>{0.40914312f, 0.9326545f},
-std::array<float,2>{0.0237180609f, 0.13850753f},
-std::array<float,2>{0.767531812f, 0.681015193f},
-std::array<float,2>{0.976129413f, 0.114411145f},
-std::array<float,2>{0.205457106f, 0.538566768f},
-std::array<float,2>{0.287836283f, 0.438344836f},
-std::array<float,2>{0.623086333f, 0.790422201f},
-std::array<float,2>{0.630621374f, 0.0393055752f},
-std::array<float,2>{0.468203545f, 0.593696535f},
-std::array<float,2>{0.0942635462f, 0.405738235f},
-std::array<float,2>{0.873584986f, 0.838764727f},
-std::array<float,2>{0.931769192f, 0.327110976f},
-std::array<float,2>{0.176928446f, 0.99899435f},
-std::array<float,2>{0.32596305f, 0.203397989f},
-std::array<float,2>{0.53044343f, 0.746946633f},
-std::array<float,2>{0.58265233f, 0.493100405f},
-std::array<float,2>{0.266589075f, 0.772824049f},
-std::array<float,2>{0.248205647f, 0.0646568835f},
-std::array<float,2>{0.958817482f, 0.522455275f},
-std::array<float,2>{0.805998564f, 0.165592253f},
-std::array<float,2>{0.0480890423f, 0.625415444f},
-std::array<float,2>{0.405617565f, 0.256406277f},
-std::array<float,2>{0.723822117f, 0.90237391f},
-std::array<float,2>{0.642868936f, 0.157296449f},
-std::array<float,2>{0.452448547f, 0.64022094f},
-std::array<float,2>{0.117707379f, 0.262456805f},
-std::array<float,2>{0.855623722f, 0.890940368f},
-std::array<float,2>{0.913423419f, 0.486375391f},
-std::array<float,2>{0.157253012f, 0.776658714f},
-std::array<float,2>{0.343072265f, 0.0736318976f},
-std::array<float,2>{0.514915168f, 0.530770361f},
-std::array<float,2>{0.575849354f, 0.31879285f},
-std::array<float,2>{0.262178719f, 0.990981162f},
-std::array<float,2>{0.234074637f, 0.218644232f},
-std::array<float,2>{0.948849261f, 0.742079914f},
-std::array<float,2>{0.786381841f, 0.0320475362f},
-std::array<float,2>{0.035083022f, 0.579298615f},
-std::array<float,2>{0.383780777f, 0.391606122f},
-std::array<float,2>{0.749497354f, 0.835736454f},
-std::array<float,2>{0.546873033f, 0.122605562f},
-std::array<float,2>{0.359205484f, 0.544845402f},
-std::array<float,2>{0.143937901f, 0.447398037f},
-std::array<float,2>{0.903203964f, 0.787380338f},
-std::array<float,2>{0.840300083f, 0.295862764f},
-std::array<float,2>{0.0708554834f, 0.924568951f},
-std::array<float,2>{0.478844017f, 0.131747738f},
-std::array<float,2>{0.656545579f, 0.675291896f},
-std::array<float,2>{0.71587801f, 0.409757912f},
-std::array<float,2>{0.434586585f, 0.868690312f},
-std::array<float,2>{0.0124510145f, 0.0215849336f},
-std::array<float,2>{0.753334761f, 0.594918072f},
-std::array<float,2>{0.991454303f, 0.249823838f},
-std::array<float,2>{0.195196643f, 0.703995883f},
-std::array<float,2>{0.308397919f, 0.363380373f},
-std::array<float,2>{0.602840662f, 0.942069232f},
-std::array<float,2>{0.617756248f, 0.20051533f},
-std::array<float,2>{0.281287968f, 0.727063715f},
-std::array<float,2>{0.209554598f, 0.336679459f},
-std::array<float,2>{0.970077932f, 0.977131665f},
-std::array<float,2>{0.771774948f, 0.386372149f},
-std::array<float,2>{0.0302949846f, 0.825282693f},
-std::array<float,2>{0.413830161f, 0.0517035015f},
-std::array<float,2>{0.702544808f, 0.563700676f},
-std::array<float,2>{0.68448329f, 0.274066776f},
-std::array<float,2>{0.495846152f, 0.8813833f},
-std::array<float,2>{0.0935418233f, 0.180469006f},
-std::array<float,2>{0.813710093f, 0.645709395f},
-std::array<float,2>{0.883483291f, 0.0810735822f},
-std::array<float,2>{0.128910169f, 0.508978724f},
-std::array<float,2>{0.364493251f, 0.481958836f},
-std::array<float,2>{0.547046721f, 0.751057744f},
-std::array<float,2>{0.722449601f, 0.00257728901f},
-std::array<float,2>{0.400495112f, 0.611913145f},
-std::array<float,2>{0.0515457094f, 0.429705471f},
-std::array<float,2>{0.810478449f, 0.852226913f},
-std::array<float,2>{0.955763102f, 0.345012277f},
-std::array<float,2>{0.243612081f, 0.959394753f},
-std::array<float,2>{0.271964937f, 0.231178686f},
-std::array<float,2>{0.581300557f, 0.700583816f},
-std::array<float,2>{0.525204003f, 0.467345804f},
-std::array<float,2>{0.320722163f, 0.803219259f},
-std::array<float,2>{0.172647104f, 0.108227178f},
-std::array<float,2>{0.937348902f, 0.559400797f},
-std::array<float,2>{0.868567765f, 0.150696546f},
-std::array<float,2>{0.0997230485f, 0.671061099f},
-std::array<float,2>{0.46202457f, 0.300228596f},
-std::array<float,2>{0.628366649f, 0.908154786f},
-std::array<float,2>{0.693269253f, 0.222753122f},
-std::array<float,2>{0.416893333f, 0.694760144f},
-std::array<float,2>{0.0179446954f, 0.359245926f},
-std::array<float,2>{0.778185964f, 0.965880394f},
-std::array<float,2>{0.983541191f, 0.424493641f},
-std::array<float,2>{0.211164773f, 0.84407264f},
-std::array<float,2>{0.295498967f, 0.00788151752f},
-std::array<float,2>{0.613620222f, 0.624451756f},
-std::array<float,2>{0.560706437f, 0.311764598f},
-std::array<float,2>{0.367375553f, 0.921455443f},
-std::array<float,2>{0.138614565f, 0.140891686f},
-std::array<float,2>{0.881950736f, 0.659535289f},
-std::array<float,2>{0.824929357f, 0.0987469479f},
-std::array<float,2>{0.0815189108f, 0.554163933f},
-std::array<float,2>{0.490769595f, 0.454352975f},
-std::array<float,2>{0.672695935f, 0.811383069f},
-std::array<float,2>{0.588806987f, 0.0556875616f},
-std::array<float,2>{0.280026019f, 0.577117383f},
-std::array<float,2>{0.236347184f, 0.376588196f},
-std::array<float,2>{0.964673579f, 0.819091916f},
-std::array<float,2>{0.799304128f, 0.328651905f},
-std::array<float,2>{0.0578223839f, 0.97549057f},
-std::array<float,2>{0.395435661f, 0.193475291f},
-std::array<float,2>{0.732669115f, 0.724585772f},
-std::array<float,2>{0.637419939f, 0.469559491f},
-std::array<float,2>{0.459985316f, 0.758950591f},
-std::array<float,2>{0.107942864f, 0.0883773714f},
-std::array<float,2>{0.864714563f, 0.501971781f},
-std::array<float,2>{0.926983178f, 0.177537754f},
-std::array<float,2>{0.181423709f, 0.652030051f},
-std::array<float,2>{0.318403006f, 0.268226236f},
-std::array<float,2>{0.517302871f, 0.889070868f},
-std::array<float,2>{0.507349372f, 0.134283513f},
-std::array<float,2>{0.328487545f, 0.685515225f},
-std::array<float,2>{0.164821729f, 0.287407041f},
-std::array<float,2>{0.91758889f, 0.934899628f},
-std::array<float,2>{0.845832944f, 0.442787111f},
-std::array<float,2>{0.115305327f, 0.795054972f},
-std::array<float,2>{0.438943058f, 0.111230746f},
-std::array<float,2>{0.651986361f, 0.533801854f},
-std::array<float,2>{0.73455441f, 0.369130999f},
-std::array<float,2>{0.381346107f, 0.952299774f},
-std::array<float,2>{0.0437709205f, 0.241423666f},
-std::array<float,2>{0.791186512f, 0.71241492f},
-std::array<float,2>{0.944350541f, 0.0297079775f},
-std::array<float,2>{0.223402992f, 0.6077528f},
-std::array<float,2>{0.250957787f, 0.417931467f},
-std::array<float,2>{0.564946771f, 0.865645289f},
-std::array<float,2>{0.665689409f, 0.0698345825f},
-std::array<float,2>{0.470443308f, 0.517396212f},
-std::array<float,2>{0.0693113804f, 0.497686088f},
-std::array<float,2>{0.831345677f, 0.768291295f},
-std::array<float,2>{0.893801153f, 0.250804335f},
-std::array<float,2>{0.155829236f, 0.90224576f},
-std::array<float,2>{0.345299751f, 0.170912117f},
-std::array<float,2>{0.537848353f, 0.632066011f},
-std::array<float,2>{0.598795235f, 0.401479751f},
-std::array<float,2>{0.297503501f, 0.842785597f},
-std::array<float,2>{0.198370248f, 0.0446924157f},
-std::array<float,2>{0.997591674f, 0.588075101f},
-std::array<float,2>{0.762088954f, 0.209193408f},
-std::array<float,2>{0.000934279873f, 0.74569273f},
-std::array<float,2>{0.427033067f, 0.320782155f},
-std::array<float,2>{0.705923021f, 0.994301677f},
-std::array<float,2>{0.633138418f, 0.243480742f},
-std::array<float,2>{0.455479205f, 0.707445085f},
-std::array<float,2>{0.103322841f, 0.359924704f},
-std::array<float,2>{0.862562537f, 0.94041729f},
-std::array<float,2>{0.924524069f, 0.410984159f},
-std::array<float,2>{0.18704769f, 0.871389806f},
-std::array<float,2>{0.314966261f, 0.019486485f},
-std::array<float,2>{0.522019982f, 0.601102293f},
-std::array<float,2>{0.593010306f, 0.291452527f},
-std::array<float,2>{0.273501128f, 0.9271245f},
-std::array<float,2>{0.240496114f, 0.125078738f},
-std::array<float,2>{0.968518078f, 0.678889811f},
-std::array<float,2>{0.800915718f, 0.120502122f},
-std::array<float,2>{0.0606083944f, 0.540610075f},
-std::array<float,2>{0.39140445f, 0.450993448f},
-std::array<float,2>{0.72741431f, 0.783554375f},
-std::array<float,2>{0.556927681f, 0.038012322f},
-std::array<float,2>{0.37288636f, 0.584428251f},
-std::array<float,2>{0.135289356f, 0.396340817f},
-std::array<float,2>{0.878553271f, 0.829347074f},
-std::array<float,2>{0.821124375f, 0.31483683f},
-std::array<float,2>{0.0856385976f, 0.985029161f},
-std::array<float,2>{0.48817727f, 0.213686585f},
-std::array<float,2>{0.679336548f, 0.737543106f},
-std::array<float,2>{0.688214719f, 0.488599777f},
-std::array<float,2>{0.418909758f, 0.778400362f},
-std::array<float,2>{0.0225362312f, 0.0754782781f},
-std::array<float,2>{0.775907636f, 0.523887932f},
-std::array<float,2>{0.978892326f, 0.163334727f},
-std::array<float,2>{0.215182573f, 0.636465788f},
-std::array<float,2>{0.290407598f, 0.261319607f},
-std::array<float,2>{0.610538602f, 0.895071626f},
-std::array<float,2>{0.59379214f, 0.154609144f},
-std::array<float,2>{0.302783638f, 0.665677667f},
-std::array<float,2>{0.199323252f, 0.302027911f},
-std::array<float,2>{0.992414415f, 0.913055241f},
-std::array<float,2>{0.761557281f, 0.464065462f},
-std::array<float,2>{0.00656482857f, 0.797314465f},
-std::array<float,2>{0.423059165f, 0.102693699f},
-std::array<float,2>{0.707938194f, 0.556691289f},
-std::array<float,2>{0.66925329f, 0.349871486f},
-std::array<float,2>{0.473128527f, 0.953202486f},
-std::array<float,2>{0.063389197f, 0.227224454f},
-std::array<float,2>{0.832107663f, 0.696757972f},
-std::array<float,2>{0.896968246f, 0.00588354329f},
-std::array<float,2>{0.149311408f, 0.614236414f},
-std::array<float,2>{0.350705564f, 0.434881449f},
-std::array<float,2>{0.532501161f, 0.856425464f},
-std::array<float,2>{0.740795076f, 0.0822011009f},
-std::array<float,2>{0.375263393f, 0.512935936f},
-std::array<float,2>{0.0419884026f, 0.480229467f},
-std::array<float,2>{0.795377731f, 0.755335391f},
-std::array<float,2>{0.941318929f, 0.279592395f},
-std::array<float,2>{0.222230867f, 0.876636088f},
-std::array<float,2>{0.256961346f, 0.185971245f},
-std::array<float,2>{0.567411602f, 0.641875148f},
-std::array<float,2>{0.503247976f, 0.388743103f},
-std::array<float,2>{0.335088909f, 0.823432684f},
-std::array<float,2>{0.16855748f, 0.0482187681f},
-std::array<float,2>{0.920218289f, 0.568689585f},
-std::array<float,2>{0.850741208f, 0.19746007f},
-std::array<float,2>{0.109852269f, 0.732159197f},
-std::array<float,2>{0.443799257f, 0.342162937f},
-std::array<float,2>{0.654379427f, 0.981378734f},
-std::array<float,2>{0.713568807f, 0.17204906f},
-std::array<float,2>{0.432611853f, 0.655105293f},
-std::array<float,2>{0.0087842308f, 0.27291289f},
-std::array<float,2>{0.755142748f, 0.886443138f},
-std::array<float,2>{0.984926641f, 0.474933565f},
-std::array<float,2>{0.188131303f, 0.764178813f},
-std::array<float,2>{0.308736503f, 0.0923488215f},
-std::array<float,2>{0.606108129f, 0.504756987f},
-std::array<float,2>{0.541241586f, 0.335558772f},
-std::array<float,2>{0.352288008f, 0.96953547f},
-std::array<float,2>{0.146930158f, 0.190966263f},
-std::array<float,2>{0.901393116f, 0.72077167f},
-std::array<float,2>{0.838409007f, 0.0595834143f},
-std::array<float,2>{0.0780645981f, 0.572872043f},
-std::array<float,2>{0.483822733f, 0.380412847f},
-std::array<float,2>{0.661440313f, 0.813528478f},
-std::array<float,2>{0.573740125f, 0.0967989638f},
-std::array<float,2>{0.257909328f, 0.5470047f},
-std::array<float,2>{0.228983492f, 0.459901899f},
-std::array<float,2>{0.952136278f, 0.806652486f},
-std::array<float,2>{0.782343745f, 0.308584571f},
-std::array<float,2>{0.0378271751f, 0.91706717f},
-std::array<float,2>{0.388578475f, 0.14594762f},
-std::array<float,2>{0.744384289f, 0.662419498f},
-std::array<float,2>{0.644626439f, 0.42686069f},
-std::array<float,2>{0.448933989f, 0.850415528f},
-std::array<float,2>{0.123689458f, 0.0139129041f},
-std::array<float,2>{0.855019271f, 0.618569016f},
-std::array<float,2>{0.909347475f, 0.222098961f},
-std::array<float,2>{0.161559269f, 0.687621534f},
-std::array<float,2>{0.338732362f, 0.354084164f},
-std::array<float,2>{0.511452436f, 0.961621583f},
-std::array<float,2>{0.528930068f, 0.206004292f},
-std::array<float,2>{0.328090727f, 0.749933541f},
-std::array<float,2>{0.177907407f, 0.326122344f},
-std::array<float,2>{0.930014849f, 0.997462749f},
-std::array<float,2>{0.871397316f, 0.403832227f},
-std::array<float,2>{0.0957237333f, 0.83764416f},
-std::array<float,2>{0.46664983f, 0.0410279222f},
-std::array<float,2>{0.632146001f, 0.590357006f},
-std::array<float,2>{0.724642158f, 0.254085749f},
-std::array<float,2>{0.403333455f, 0.905251384f},
-std::array<float,2>{0.0493092351f, 0.166111782f},
-std::array<float,2>{0.808172226f, 0.62867111f},
-std::array<float,2>{0.959965765f, 0.062798366f},
-std::array<float,2>{0.247876346f, 0.521291733f},
-std::array<float,2>{0.268981159f, 0.495994866f},
-std::array<float,2>{0.585661829f, 0.769702196f},
-std::array<float,2>{0.680318177f, 0.0254434273f},
-std::array<float,2>{0.496710479f, 0.603762627f},
-std::array<float,2>{0.0897701755f, 0.418587744f},
-std::array<float,2>{0.816704929f, 0.861023247f},
-std::array<float,2>{0.88673836f, 0.374584764f},
-std::array<float,2>{0.12788558f, 0.947043121f},
-std::array<float,2>{0.360410213f, 0.237444162f},
-std::array<float,2>{0.552431822f, 0.717705905f},
-std::array<float,2>{0.622096598f, 0.440553069f},
-std::array<float,2>{0.287064075f, 0.791611671f},
-std::array<float,2>{0.204984635f, 0.116837926f},
-std::array<float,2>{0.972801208f, 0.536816061f},
-std::array<float,2>{0.767692387f, 0.140236333f},
-std::array<float,2>{0.0258890875f, 0.681846142f},
-std::array<float,2>{0.408158541f, 0.282615244f},
-std::array<float,2>{0.697370529f, 0.931363165f},
-std::array<float,2>{0.65976882f, 0.130431339f},
-std::array<float,2>{0.476790458f, 0.673284233f},
-std::array<float,2>{0.0731136054f, 0.294531316f},
-std::array<float,2>{0.841996968f, 0.922095835f},
-std::array<float,2>{0.906207323f, 0.445384443f},
-std::array<float,2>{0.140901044f, 0.786424696f},
-std::array<float,2>{0.355667979f, 0.123591088f},
-std::array<float,2>{0.543454766f, 0.545991659f},
-std::array<float,2>{0.603887677f, 0.366321146f},
-std::array<float,2>{0.304759473f, 0.945123971f},
-std::array<float,2>{0.192695484f, 0.246812657f},
-std::array<float,2>{0.98969692f, 0.705717981f},
-std::array<float,2>{0.750152767f, 0.0201812908f},
-std::array<float,2>{0.0149518345f, 0.596512318f},
-std::array<float,2>{0.435734749f, 0.406889409f},
-std::array<float,2>{0.717133462f, 0.869738519f},
-std::array<float,2>{0.512556314f, 0.0704864189f},
-std::array<float,2>{0.341018587f, 0.529239893f},
-std::array<float,2>{0.158982292f, 0.486321062f},
-std::array<float,2>{0.91085875f, 0.775102913f},
-std::array<float,2>{0.857617676f, 0.263812423f},
-std::array<float,2>{0.120548919f, 0.893972039f},
-std::array<float,2>{0.451034516f, 0.159496635f},
-std::array<float,2>{0.642565966f, 0.636880994f},
-std::array<float,2>{0.746535361f, 0.392926097f},
-std::array<float,2>{0.385082215f, 0.833418846f},
-std::array<float,2>{0.0314661041f, 0.033474762f},
-std::array<float,2>{0.787151575f, 0.580331385f},
-std::array<float,2>{0.946620286f, 0.216463163f},
-std::array<float,2>{0.231533676f, 0.739929438f},
-std::array<float,2>{0.265520036f, 0.317747444f},
-std::array<float,2>{0.576255739f, 0.988557279f},
-std::array<float,2>{0.578662932f, 0.232742727f},
-std::array<float,2>{0.27129963f, 0.702826798f},
-std::array<float,2>{0.245047897f, 0.346391648f},
-std::array<float,2>{0.953653276f, 0.957317472f},
-std::array<float,2>{0.810638785f, 0.432589799f},
-std::array<float,2>{0.053234335f, 0.853988707f},
-std::array<float,2>{0.400103152f, 0.00176824175f},
-std::array<float,2>{0.720176876f, 0.609903693f},
-std::array<float,2>{0.626918554f, 0.297551244f},
-std::array<float,2>{0.464598715f, 0.90841186f},
-std::array<float,2>{0.0985361412f, 0.14965713f},
-std::array<float,2>{0.870656312f, 0.668906033f},
-std::array<float,2>{0.934294462f, 0.106025726f},
-std::array<float,2>{0.175544545f, 0.56175971f},
-std::array<float,2>{0.323084325f, 0.465412021f},
-std::array<float,2>{0.526147723f, 0.801480711f},
-std::array<float,2>{0.699965775f, 0.0530792139f},
-std::array<float,2>{0.412041128f, 0.566117465f},
-std::array<float,2>{0.0286301058f, 0.383619815f},
-std::array<float,2>{0.771101117f, 0.827425361f},
-std::array<float,2>{0.971057773f, 0.339468688f},
-std::array<float,2>{0.207133681f, 0.978832841f},
-std::array<float,2>{0.28501451f, 0.201974243f},
-std::array<float,2>{0.619722545f, 0.728896797f},
-std::array<float,2>{0.549077511f, 0.483215362f},
-std::array<float,2>{0.366217285f, 0.753010154f},
-std::array<float,2>{0.131543949f, 0.0783027261f},
-std::array<float,2>{0.884816885f, 0.511658847f},
-std::array<float,2>{0.81565398f, 0.183534235f},
-std::array<float,2>{0.0900359005f, 0.647219777f},
-std::array<float,2>{0.493628025f, 0.275465488f},
-std::array<float,2>{0.685765743f, 0.879235327f},
-std::array<float,2>{0.730832458f, 0.191999361f},
-std::array<float,2>{0.397882372f, 0.726321697f},
-std::array<float,2>{0.054890316f, 0.331937402f},
-std::array<float,2>{0.797370434f, 0.973208964f},
-std::array<float,2>{0.961720943f, 0.378218591f},
-std::array<float,2>{0.235660002f, 0.816780925f},
-std::array<float,2>{0.278304398f, 0.0576904304f},
-std::array<float,2>{0.586184978f, 0.57448405f},
-std::array<float,2>{0.51828444f, 0.266118497f},
-std::array<float,2>{0.317905962f, 0.88746649f},
-std::array<float,2>{0.183593631f, 0.178980201f},
-std::array<float,2>{0.928790212f, 0.649489522f},
-std::array<float,2>{0.865244448f, 0.0867016688f},
-std::array<float,2>{0.106475271f, 0.501419306f},
-std::array<float,2>{0.458528191f, 0.471161723f},
-std::array<float,2>{0.64043498f, 0.7610237f},
-std::array<float,2>{0.615251124f, 0.0116686877f},
-std::array<float,2>{0.293802738f, 0.62250942f},
-std::array<float,2>{0.213460296f, 0.422653973f},
-std::array<float,2>{0.9820503f, 0.847151935f},
-std::array<float,2>{0.781073272f, 0.355803996f},
-std::array<float,2>{0.0160127431f, 0.966816783f},
-std::array<float,2>{0.415320694f, 0.225515515f},
-std::array<float,2>{0.694896042f, 0.691505194f},
-std::array<float,2>{0.673955679f, 0.456176013f},
-std::array<float,2>{0.489458591f, 0.809227407f},
-std::array<float,2>{0.0787442774f, 0.0998359546f},
-std::array<float,2>{0.827607155f, 0.550786376f},
-std::array<float,2>{0.880155623f, 0.142949194f},
-std::array<float,2>{0.139324233f, 0.657787204f},
-std::array<float,2>{0.369192064f, 0.309758842f},
-std::array<float,2>{0.559046328f, 0.918555558f},
-std::array<float,2>{0.535660923f, 0.169272497f},
-std::array<float,2>{0.346312463f, 0.630487621f},
-std::array<float,2>{0.153278351f, 0.252159417f},
-std::array<float,2>{0.891400516f, 0.899022222f},
-std::array<float,2>{0.829867363f, 0.498793244f},
-std::array<float,2>{0.0675416738f, 0.767121375f},
-std::array<float,2>{0.471232951f, 0.0680495948f},
-std::array<float,2>{0.667294443f, 0.517767906f},
-std::array<float,2>{0.704673231f, 0.324113786f},
-std::array<float,2>{0.428900748f, 0.993133128f},
-std::array<float,2>{0.00297622452f, 0.207630143f},
-std::array<float,2>{0.764930487f, 0.742354512f},
-std::array<float,2>{0.998341799f, 0.0453353636f},
-std::array<float,2>{0.195949629f, 0.58658731f},
-std::array<float,2>{0.299767315f, 0.400019139f},
-std::array<float,2>{0.601320267f, 0.840444982f},
-std::array<float,2>{0.649878263f, 0.112817988f},
-std::array<float,2>{0.440529048f, 0.53221786f},
-std::array<float,2>{0.113736317f, 0.443695486f},
-std::array<float,2>{0.843981504f, 0.794556737f},
-std::array<float,2>{0.91518122f, 0.285992265f},
-std::array<float,2>{0.166872963f, 0.937078595f},
-std::array<float,2>{0.33021903f, 0.135970622f},
-std::array<float,2>{0.505013764f, 0.686664224f},
-std::array<float,2>{0.562598407f, 0.414817125f},
-std::array<float,2>{0.252660602f, 0.863393307f},
-std::array<float,2>{0.225156024f, 0.0274977274f},
-std::array<float,2>{0.942337513f, 0.605906427f},
-std::array<float,2>{0.790203631f, 0.238600716f},
-std::array<float,2>{0.0465641618f, 0.713853061f},
-std::array<float,2>{0.37998724f, 0.371058196f},
-std::array<float,2>{0.736974776f, 0.950637221f},
-std::array<float,2>{0.682228744f, 0.238097772f},
-std::array<float,2>{0.499454796f, 0.717032969f},
-std::array<float,2>{0.0870462805f, 0.374375194f},
-std::array<float,2>{0.819167972f, 0.94669205f},
-std::array<float,2>{0.889555693f, 0.418380082f},
-std::array<float,2>{0.126062259f, 0.860652089f},
-std::array<float,2>{0.362220466f, 0.0261937622f},
-std::array<float,2>{0.55448693f, 0.604167521f},
-std::array<float,2>{0.623729229f, 0.282789826f},
-std::array<float,2>{0.287354887f, 0.930862308f},
-std::array<float,2>{0.205893412f, 0.140062585f},
-std::array<float,2>{0.976031423f, 0.682383657f},
-std::array<float,2>{0.766773641f, 0.116462208f},
-std::array<float,2>{0.0241758525f, 0.536404252f},
-std::array<float,2>{0.408226401f, 0.440955192f},
-std::array<float,2>{0.696800947f, 0.791352093f},
-std::array<float,2>{0.531019747f, 0.0418061875f},
-std::array<float,2>{0.325439662f, 0.590033889f},
-std::array<float,2>{0.177382633f, 0.403793275f},
-std::array<float,2>{0.932612181f, 0.837233305f},
-std::array<float,2>{0.87327981f, 0.325289816f},
-std::array<float,2>{0.0939661413f, 0.997862339f},
-std::array<float,2>{0.468276799f, 0.205322877f},
-std::array<float,2>{0.630089283f, 0.749229431f},
-std::array<float,2>{0.724542081f, 0.495223135f},
-std::array<float,2>{0.406077892f, 0.770494699f},
-std::array<float,2>{0.0487467833f, 0.0634176955f},
-std::array<float,2>{0.80650115f, 0.520861208f},
-std::array<float,2>{0.958165467f, 0.166788921f},
-std::array<float,2>{0.248677433f, 0.628174365f},
-std::array<float,2>{0.266105533f, 0.254763633f},
-std::array<float,2>{0.582106769f, 0.904391706f},
-std::array<float,2>{0.572092533f, 0.146054059f},
-std::array<float,2>{0.260684282f, 0.662659109f},
-std::array<float,2>{0.227553859f, 0.307947099f},
-std::array<float,2>{0.950326383f, 0.917750359f},
-std::array<float,2>{0.784487247f, 0.459107131f},
-std::array<float,2>{0.0360833816f, 0.807437539f},
-std::array<float,2>{0.388854355f, 0.0976254493f},
-std::array<float,2>{0.743753433f, 0.547624469f},
-std::array<float,2>{0.647013962f, 0.35383141f},
-std::array<float,2>{0.446674436f, 0.961237788f},
-std::array<float,2>{0.121695027f, 0.222398967f},
-std::array<float,2>{0.851914644f, 0.688055336f},
-std::array<float,2>{0.906397939f, 0.0146338344f},
-std::array<float,2>{0.163630337f, 0.618690968f},
-std::array<float,2>{0.337276399f, 0.427583516f},
-std::array<float,2>{0.508487821f, 0.849647462f},
-std::array<float,2>{0.711682558f, 0.0919877961f},
-std::array<float,2>{0.430005968f, 0.504103184f},
-std::array<float,2>{0.0106920833f, 0.475388587f},
-std::array<float,2>{0.75724268f, 0.763706028f},
-std::array<float,2>{0.98770982f, 0.273351312f},
-std::array<float,2>{0.19005312f, 0.886101604f},
-std::array<float,2>{0.310681731f, 0.172827005f},
-std::array<float,2>{0.607573867f, 0.654669046f},
-std::array<float,2>{0.540581822f, 0.380152941f},
-std::array<float,2>{0.355306f, 0.814187348f},
-std::array<float,2>{0.145628706f, 0.0602780282f},
-std::array<float,2>{0.900042355f, 0.572522044f},
-std::array<float,2>{0.837054551f, 0.190705225f},
-std::array<float,2>{0.0757274181f, 0.721262336f},
-std::array<float,2>{0.481872737f, 0.334990084f},
-std::array<float,2>{0.662443161f, 0.968900919f},
-std::array<float,2>{0.739218414f, 0.186363608f},
-std::array<float,2>{0.37848717f, 0.642527461f},
-std::array<float,2>{0.0407700613f, 0.279902816f},
-std::array<float,2>{0.794226408f, 0.876118243f},
-std::array<float,2>{0.937648296f, 0.479606897f},
-std::array<float,2>{0.219518349f, 0.75557965f},
-std::array<float,2>{0.254743904f, 0.0827427953f},
-std::array<float,2>{0.568835795f, 0.513438821f},
-std::array<float,2>{0.500766933f, 0.342603266f},
-std::array<float,2>{0.332933366f, 0.980827153f},
-std::array<float,2>{0.170667872f, 0.1980609f},
-std::array<float,2>{0.919520319f, 0.731459975f},
-std::array<float,2>{0.848667085f, 0.0486207195f},
-std::array<float,2>{0.112246655f, 0.569036722f},
-std::array<float,2>{0.442445934f, 0.389276862f},
-std::array<float,2>{0.652425766f, 0.82406944f},
-std::array<float,2>{0.596103728f, 0.10313946f},
-std::array<float,2>{0.301445693f, 0.557154477f},
-std::array<float,2>{0.202329189f, 0.464419663f},
-std::array<float,2>{0.995597303f, 0.797680557f},
-std::array<float,2>{0.75955832f, 0.302438825f},
-std::array<float,2>{0.00441835634f, 0.912181973f},
-std::array<float,2>{0.425130606f, 0.154818103f},
-std::array<float,2>{0.710541904f, 0.665384173f},
-std::array<float,2>{0.671248376f, 0.435070038f},
-std::array<float,2>{0.476372153f, 0.855564296f},
-std::array<float,2>{0.0648405477f, 0.00641221181f},
-std::array<float,2>{0.834950507f, 0.613650978f},
-std::array<float,2>{0.89512676f, 0.227003649f},
-std::array<float,2>{0.151631311f, 0.696965992f},
-std::array<float,2>{0.349351197f, 0.350310624f},
-std::array<float,2>{0.533941686f, 0.953982115f},
-std::array<float,2>{0.555070281f, 0.212895945f},
-std::array<float,2>{0.373058707f, 0.738144398f},
-std::array<float,2>{0.132904813f, 0.315293074f},
-std::array<float,2>{0.876693964f, 0.984613419f},
-std::array<float,2>{0.823896825f, 0.395903617f},
-std::array<float,2>{0.0829491317f, 0.829658091f},
-std::array<float,2>{0.484656334f, 0.0373972021f},
-std::array<float,2>{0.676936626f, 0.58490485f},
-std::array<float,2>{0.690770388f, 0.260826766f},
-std::array<float,2>{0.420684367f, 0.894688368f},
-std::array<float,2>{0.0212736353f, 0.163580045f},
-std::array<float,2>{0.775230646f, 0.63596499f},
-std::array<float,2>{0.977680683f, 0.0760634467f},
-std::array<float,2>{0.217244029f, 0.524038315f},
-std::array<float,2>{0.292374581f, 0.488849312f},
-std::array<float,2>{0.612291217f, 0.779029846f},
-std::array<float,2>{0.635729849f, 0.0188655797f},
-std::array<float,2>{0.455008864f, 0.600592077f},
-std::array<float,2>{0.105036542f, 0.410635918f},
-std::array<float,2>{0.860863388f, 0.871915638f},
-std::array<float,2>{0.923650503f, 0.35948211f},
-std::array<float,2>{0.185129866f, 0.939901233f},
-std::array<float,2>{0.31402871f, 0.243824095f},
-std::array<float,2>{0.520456314f, 0.707909226f},
-std::array<float,2>{0.591214895f, 0.450401336f},
-std::array<float,2>{0.275915235f, 0.783858597f},
-std::array<float,2>{0.239183381f, 0.120835848f},
-std::array<float,2>{0.966185093f, 0.540268123f},
-std::array<float,2>{0.803871334f, 0.125636384f},
-std::array<float,2>{0.0586333685f, 0.67950964f},
-std::array<float,2>{0.392607093f, 0.291503966f},
-std::array<float,2>{0.730468154f, 0.927670777f},
-std::array<float,2>{0.65149802f, 0.136543244f},
-std::array<float,2>{0.439208329f, 0.6871382f},
-std::array<float,2>{0.115960345f, 0.285360217f},
-std::array<float,2>{0.846373737f, 0.936802864f},
-std::array<float,2>{0.917179704f, 0.444031864f},
-std::array<float,2>{0.164122239f, 0.79420954f},
-std::array<float,2>{0.328998774f, 0.112564445f},
-std::array<float,2>{0.507038057f, 0.53130883f},
-std::array<float,2>{0.564456761f, 0.370131016f},
-std::array<float,2>{0.250082165f, 0.950741529f},
-std::array<float,2>{0.222806722f, 0.238839954f},
-std::array<float,2>{0.945081532f, 0.712992013f},
-std::array<float,2>{0.791603744f, 0.0282043032f},
-std::array<float,2>{0.0434373394f, 0.606360435f},
-std::array<float,2>{0.381603479f, 0.414372861f},
-std::array<float,2>{0.73503077f, 0.863911152f},
-std::array<float,2>{0.537294567f, 0.067538783f},
-std::array<float,2>{0.345001191f, 0.518391669f},
-std::array<float,2>{0.155455858f, 0.498069495f},
-std::array<float,2>{0.894373119f, 0.766886473f},
-std::array<float,2>{0.831927896f, 0.252762169f},
-std::array<float,2>{0.0684797242f, 0.898710132f},
-std::array<float,2>{0.470042676f, 0.169744328f},
-std::array<float,2>{0.665172458f, 0.630279958f},
-std::array<float,2>{0.705203056f, 0.399663717f},
-std::array<float,2>{0.42752099f, 0.840253413f},
-std::array<float,2>{0.000139017167f, 0.045708932f},
-std::array<float,2>{0.762212515f, 0.586194754f},
-std::array<float,2>{0.997214556f, 0.207380608f},
-std::array<float,2>{0.198848709f, 0.742929101f},
-std::array<float,2>{0.296888143f, 0.323477149f},
-std::array<float,2>{0.599165201f, 0.992601216f},
-std::array<float,2>{0.614026248f, 0.224814117f},
-std::array<float,2>{0.295370758f, 0.691962361f},
-std::array<float,2>{0.211786285f, 0.356146157f},
-std::array<float,2>{0.984235883f, 0.967626095f},
-std::array<float,2>{0.777506113f, 0.422060221f},
-std::array<float,2>{0.0181560423f, 0.84725672f},
-std::array<float,2>{0.416442961f, 0.0111904377f},
-std::array<float,2>{0.692786574f, 0.622896075f},
-std::array<float,2>{0.671884775f, 0.310150832f},
-std::array<float,2>{0.49031508f, 0.918377876f},
-std::array<float,2>{0.08167959f, 0.143097639f},
-std::array<float,2>{0.824310124f, 0.657556772f},
-std::array<float,2>{0.882427931f, 0.100206681f},
-std::array<float,2>{0.138172135f, 0.551661611f},
-std::array<float,2>{0.367882818f, 0.456704408f},
-std::array<float,2>{0.561342299f, 0.808625877f},
-std::array<float,2>{0.733329415f, 0.0584090091f},
-std::array<float,2>{0.394989014f, 0.574710131f},
-std::array<float,2>{0.058486484f, 0.378533065f},
-std::array<float,2>{0.79939729f, 0.817357838f},
-std::array<float,2>{0.963935018f, 0.331115663f},
-std::array<float,2>{0.23702617f, 0.972895622f},
-std::array<float,2>{0.279674709f, 0.191579536f},
-std::array<float,2>{0.588321328f, 0.725745499f},
-std::array<float,2>{0.51700145f, 0.471582174f},
-std::array<float,2>{0.318976134f, 0.761240542f},
-std::array<float,2>{0.181062564f, 0.0863175765f},
-std::array<float,2>{0.927679718f, 0.501900911f},
-std::array<float,2>{0.864874303f, 0.179242074f},
-std::array<float,2>{0.107832894f, 0.650362909f},
-std::array<float,2>{0.460565835f, 0.26583001f},
-std::array<float,2>{0.637105823f, 0.887127399f},
-std::array<float,2>{0.702691674f, 0.201349825f},
-std::array<float,2>{0.413247824f, 0.729437292f},
-std::array<float,2>{0.0311681982f, 0.339209855f},
-std::array<float,2>{0.772151887f, 0.979362845f},
-std::array<float,2>{0.970492542f, 0.382956326f},
-std::array<float,2>{0.209131613f, 0.828049481f},
-std::array<float,2>{0.282181859f, 0.0533681326f},
-std::array<float,2>{0.617383122f, 0.565499783f},
-std::array<float,2>{0.547378778f, 0.276186526f},
-std::array<float,2>{0.36507991f, 0.879618526f},
-std::array<float,2>{0.129839614f, 0.182896286f},
-std::array<float,2>{0.883071184f, 0.646526575f},
-std::array<float,2>{0.814335823f, 0.079081066f},
-std::array<float,2>{0.0930544361f, 0.510982156f},
-std::array<float,2>{0.495372266f, 0.482628733f},
-std::array<float,2>{0.684048831f, 0.753418505f},
-std::array<float,2>{0.581769347f, 0.00137980853f},
-std::array<float,2>{0.272418946f, 0.609435916f},
-std::array<float,2>{0.243852168f, 0.431930661f},
-std::array<float,2>{0.955489457f, 0.854489982f},
-std::array<float,2>{0.809609473f, 0.34575811f},
-std::array<float,2>{0.0510848276f, 0.957799077f},
-std::array<float,2>{0.401314616f, 0.233334482f},
-std::array<float,2>{0.721854806f, 0.702312768f},
-std::array<float,2>{0.628599286f, 0.465252578f},
-std::array<float,2>{0.462605119f, 0.800990045f},
-std::array<float,2>{0.100247271f, 0.105832547f},
-std::array<float,2>{0.868694961f, 0.562285185f},
-std::array<float,2>{0.936666071f, 0.149916604f},
-std::array<float,2>{0.171970636f, 0.668091118f},
-std::array<float,2>{0.320875436f, 0.297155887f},
-std::array<float,2>{0.5248667f, 0.908942938f},
-std::array<float,2>{0.515270889f, 0.159736663f},
-std::array<float,2>{0.343668073f, 0.637464821f},
-std::array<float,2>{0.158018127f, 0.264193803f},
-std::array<float,2>{0.914033771f, 0.894520938f},
-std::array<float,2>{0.856300235f, 0.485838264f},
-std::array<float,2>{0.11734914f, 0.774734437f},
-std::array<float,2>{0.453028262f, 0.0709350184f},
-std::array<float,2>{0.643391788f, 0.528805256f},
-std::array<float,2>{0.749928415f, 0.318294436f},
-std::array<float,2>{0.383123159f, 0.989029288f},
-std::array<float,2>{0.0344910398f, 0.216210455f},
-std::array<float,2>{0.787024558f, 0.739608407f},
-std::array<float,2>{0.948509336f, 0.0341315642f},
-std::array<float,2>{0.233443171f, 0.580775142f},
-std::array<float,2>{0.262342095f, 0.393215984f},
-std::array<float,2>{0.575534642f, 0.83391577f},
-std::array<float,2>{0.65698278f, 0.123143546f},
-std::array<float,2>{0.479237378f, 0.546686769f},
-std::array<float,2>{0.0705890059f, 0.445937008f},
-std::array<float,2>{0.840668738f, 0.786940575f},
-std::array<float,2>{0.902404785f, 0.294415325f},
-std::array<float,2>{0.144219831f, 0.922655702f},
-std::array<float,2>{0.358473718f, 0.129974976f},
-std::array<float,2>{0.546306849f, 0.6737625f},
-std::array<float,2>{0.60312736f, 0.406338632f},
-std::array<float,2>{0.307642251f, 0.86962074f},
-std::array<float,2>{0.194749162f, 0.0196778942f},
-std::array<float,2>{0.992039263f, 0.595931232f},
-std::array<float,2>{0.753624916f, 0.246480867f},
-std::array<float,2>{0.0119886454f, 0.705558181f},
-std::array<float,2>{0.435482055f, 0.366910577f},
-std::array<float,2>{0.716635227f, 0.944611311f},
-std::array<float,2>{0.632344186f, 0.203767717f},
-std::array<float,2>{0.466053486f, 0.746375799f},
-std::array<float,2>{0.0961938128f, 0.326635748f},
-std::array<float,2>{0.87183249f, 0.998463392f},
-std::array<float,2>{0.930490375f, 0.406189442f},
-std::array<float,2>{0.178401947f, 0.837904632f},
-std::array<float,2>{0.327569216f, 0.0400181264f},
-std::array<float,2>{0.528759897f, 0.59287113f},
-std::array<float,2>{0.585278928f, 0.256165355f},
-std::array<float,2>{0.269043028f, 0.903188288f},
-std::array<float,2>{0.247106731f, 0.16524148f},
-std::array<float,2>{0.960686684f, 0.625584722f},
-std::array<float,2>{0.80777353f, 0.0652694628f},
-std::array<float,2>{0.0495427474f, 0.521820784f},
-std::array<float,2>{0.404232115f, 0.492429614f},
-std::array<float,2>{0.725241303f, 0.773321867f},
-std::array<float,2>{0.551828086f, 0.0235295072f},
-std::array<float,2>{0.360917836f, 0.602599859f},
-std::array<float,2>{0.127398983f, 0.420281112f},
-std::array<float,2>{0.887348413f, 0.863265157f},
-std::array<float,2>{0.817284465f, 0.371847808f},
-std::array<float,2>{0.089014411f, 0.948892415f},
-std::array<float,2>{0.496144176f, 0.235637873f},
-std::array<float,2>{0.680043101f, 0.716131449f},
-std::array<float,2>{0.697984338f, 0.437909782f},
-std::array<float,2>{0.407622784f, 0.790570557f},
-std::array<float,2>{0.0256256089f, 0.114779674f},
-std::array<float,2>{0.76827544f, 0.539028287f},
-std::array<float,2>{0.973265767f, 0.138110191f},
-std::array<float,2>{0.20451355f, 0.681200445f},
-std::array<float,2>{0.286450952f, 0.284257591f},
-std::array<float,2>{0.622763216f, 0.933115244f},
-std::array<float,2>{0.605909407f, 0.173978537f},
-std::array<float,2>{0.309238791f, 0.652502f},
-std::array<float,2>{0.187600672f, 0.270416677f},
-std::array<float,2>{0.984658182f, 0.88465023f},
-std::array<float,2>{0.755461335f, 0.473312616f},
-std::array<float,2>{0.00829465408f, 0.762992978f},
-std::array<float,2>{0.431883216f, 0.0914003477f},
-std::array<float,2>{0.712900877f, 0.506745934f},
-std::array<float,2>{0.661704957f, 0.333697528f},
-std::array<float,2>{0.484330535f, 0.972014546f},
-std::array<float,2>{0.0773586407f, 0.189296708f},
-std::array<float,2>{0.838199079f, 0.720465302f},
-std::array<float,2>{0.902308643f, 0.0610252805f},
-std::array<float,2>{0.14712882f, 0.571459234f},
-std::array<float,2>{0.351827443f, 0.381727308f},
-std::array<float,2>{0.54153496f, 0.815653026f},
-std::array<float,2>{0.744860113f, 0.0944033414f},
-std::array<float,2>{0.388131708f, 0.550707102f},
-std::array<float,2>{0.0371572338f, 0.4582991f},
-std::array<float,2>{0.782837749f, 0.805885673f},
-std::array<float,2>{0.951634526f, 0.306491584f},
-std::array<float,2>{0.229035452f, 0.915643811f},
-std::array<float,2>{0.258764178f, 0.147987902f},
-std::array<float,2>{0.573530197f, 0.660456657f},
-std::array<float,2>{0.510956824f, 0.428593248f},
-std::array<float,2>{0.338144332f, 0.84926635f},
-std::array<float,2>{0.161962524f, 0.0121234497f},
-std::array<float,2>{0.910119534f, 0.620267749f},
-std::array<float,2>{0.854539692f, 0.219452634f},
-std::array<float,2>{0.123253889f, 0.691016972f},
-std::array<float,2>{0.448393136f, 0.351730883f},
-std::array<float,2>{0.645440578f, 0.963570416f},
-std::array<float,2>{0.707290351f, 0.153549403f},
-std::array<float,2>{0.423789561f, 0.666140914f},
-std::array<float,2>{0.00609053997f, 0.304656774f},
-std::array<float,2>{0.760786712f, 0.911394477f},
-std::array<float,2>{0.993013322f, 0.462297857f},
-std::array<float,2>{0.199913636f, 0.799937546f},
-std::array<float,2>{0.303321898f, 0.104030065f},
-std::array<float,2>{0.594529152f, 0.556503594f},
-std::array<float,2>{0.532897949f, 0.349272966f},
-std::array<float,2>{0.351123631f, 0.957008064f},
-std::array<float,2>{0.148470014f, 0.229104772f},
-std::array<float,2>{0.897029102f, 0.698203444f},
-std::array<float,2>{0.832765102f, 0.00568900304f},
-std::array<float,2>{0.06287653f, 0.616019487f},
-std::array<float,2>{0.473529637f, 0.435549289f},
-std::array<float,2>{0.669851005f, 0.857523799f},
-std::array<float,2>{0.568141401f, 0.0854894668f},
-std::array<float,2>{0.257770926f, 0.515441418f},
-std::array<float,2>{0.222165257f, 0.4774611f},
-std::array<float,2>{0.940535367f, 0.756216407f},
-std::array<float,2>{0.795534194f, 0.277824342f},
-std::array<float,2>{0.0413433649f, 0.877175927f},
-std::array<float,2>{0.375876009f, 0.184047475f},
-std::array<float,2>{0.740672112f, 0.64303714f},
-std::array<float,2>{0.655128062f, 0.388454318f},
-std::array<float,2>{0.443920404f, 0.821538091f},
-std::array<float,2>{0.110047296f, 0.050710097f},
-std::array<float,2>{0.851436853f, 0.567630351f},
-std::array<float,2>{0.920580983f, 0.196012244f},
-std::array<float,2>{0.168373048f, 0.733634472f},
-std::array<float,2>{0.33548978f, 0.340001434f},
-std::array<float,2>{0.503604889f, 0.984190106f},
-std::array<float,2>{0.521916449f, 0.245256692f},
-std::array<float,2>{0.314837426f, 0.709003687f},
-std::array<float,2>{0.186922207f, 0.361754835f},
-std::array<float,2>{0.923853219f, 0.938006222f},
-std::array<float,2>{0.862977862f, 0.413622469f},
-std::array<float,2>{0.102551803f, 0.874782681f},
-std::array<float,2>{0.455675542f, 0.0166300423f},
-std::array<float,2>{0.63342768f, 0.598596931f},
-std::array<float,2>{0.726977646f, 0.289337933f},
-std::array<float,2>{0.390723467f, 0.928366721f},
-std::array<float,2>{0.0614420809f, 0.127609327f},
-std::array<float,2>{0.801675558f, 0.676494956f},
-std::array<float,2>{0.968089044f, 0.119113363f},
-std::array<float,2>{0.240807131f, 0.541264594f},
-std::array<float,2>{0.274015218f, 0.452798873f},
-std::array<float,2>{0.593614995f, 0.781888604f},
-std::array<float,2>{0.679049075f, 0.0366809815f},
-std::array<float,2>{0.487475157f, 0.582293689f},
-std::array<float,2>{0.0853637531f, 0.397587091f},
-std::array<float,2>{0.820732117f, 0.830772221f},
-std::array<float,2>{0.878018379f, 0.313146532f},
-std::array<float,2>{0.134881988f, 0.986461937f},
-std::array<float,2>{0.372089893f, 0.211811706f},
-std::array<float,2>{0.557197094f, 0.735351205f},
-std::array<float,2>{0.611176908f, 0.492024064f},
-std::array<float,2>{0.290629804f, 0.780662775f},
-std::array<float,2>{0.215450346f, 0.0765138492f},
-std::array<float,2>{0.979168773f, 0.526799142f},
-std::array<float,2>{0.77552247f, 0.162074313f},
-std::array<float,2>{0.0231208019f, 0.634317517f},
-std::array<float,2>{0.418044865f, 0.259279072f},
-std::array<float,2>{0.687915683f, 0.896746814f},
-std::array<float,2>{0.667609394f, 0.171575829f},
-std::array<float,2>{0.470704734f, 0.632784665f},
-std::array<float,2>{0.0678998753f, 0.250256866f},
-std::array<float,2>{0.829537809f, 0.901477098f},
-std::array<float,2>{0.890679359f, 0.497149646f},
-std::array<float,2>{0.152770132f, 0.767772436f},
-std::array<float,2>{0.345784515f, 0.0697801858f},
-std::array<float,2>{0.535200596f, 0.516610861f},
-std::array<float,2>{0.600794494f, 0.321099162f},
-std::array<float,2>{0.299259961f, 0.994776249f},
-std::array<float,2>{0.195507243f, 0.209931165f},
-std::array<float,2>{0.99879545f, 0.745526612f},
-std::array<float,2>{0.765271783f, 0.0440151393f},
-std::array<float,2>{0.00348636648f, 0.588658392f},
-std::array<float,2>{0.429252982f, 0.40196079f},
-std::array<float,2>{0.70436269f, 0.843301594f},
-std::array<float,2>{0.505424559f, 0.110830016f},
-std::array<float,2>{0.330672026f, 0.533565462f},
-std::array<float,2>{0.166055232f, 0.443181455f},
-std::array<float,2>{0.91559279f, 0.795822561f},
-std::array<float,2>{0.844370902f, 0.288018376f},
-std::array<float,2>{0.1139118f, 0.935373783f},
-std::array<float,2>{0.441332519f, 0.133829802f},
-std::array<float,2>{0.65035677f, 0.685044348f},
-std::array<float,2>{0.73648417f, 0.41746071f},
-std::array<float,2>{0.380520314f, 0.865748942f},
-std::array<float,2>{0.0463078581f, 0.0299089029f},
-std::array<float,2>{0.790988982f, 0.607933521f},
-std::array<float,2>{0.941770375f, 0.242016405f},
-std::array<float,2>{0.224821508f, 0.71197629f},
-std::array<float,2>{0.252364904f, 0.368335575f},
-std::array<float,2>{0.563459098f, 0.952976167f},
-std::array<float,2>{0.5864501f, 0.194318712f},
-std::array<float,2>{0.277549654f, 0.723813355f},
-std::array<float,2>{0.236271113f, 0.328429461f},
-std::array<float,2>{0.961037457f, 0.975089431f},
-std::array<float,2>{0.79691571f, 0.376373708f},
-std::array<float,2>{0.0553240888f, 0.818845093f},
-std::array<float,2>{0.39802894f, 0.0561604314f},
-std::array<float,2>{0.731283784f, 0.576474667f},
-std::array<float,2>{0.639866054f, 0.267812908f},
-std::array<float,2>{0.458043993f, 0.88925612f},
-std::array<float,2>{0.107153364f, 0.176936314f},
-std::array<float,2>{0.865773678f, 0.651741266f},
-std::array<float,2>{0.929443657f, 0.0884780511f},
-std::array<float,2>{0.182937354f, 0.502506077f},
-std::array<float,2>{0.317720294f, 0.46920979f},
-std::array<float,2>{0.51783663f, 0.759652555f},
-std::array<float,2>{0.694448352f, 0.00867202505f},
-std::array<float,2>{0.415700376f, 0.624874651f},
-std::array<float,2>{0.0165597536f, 0.423913807f},
-std::array<float,2>{0.780616462f, 0.844641685f},
-std::array<float,2>{0.981740534f, 0.358465731f},
-std::array<float,2>{0.213168219f, 0.966717005f},
-std::array<float,2>{0.293362826f, 0.223371059f},
-std::array<float,2>{0.61606741f, 0.695195198f},
-std::array<float,2>{0.559402049f, 0.454845726f},
-std::array<float,2>{0.36964047f, 0.810676396f},
-std::array<float,2>{0.139156118f, 0.0993041694f},
-std::array<float,2>{0.880723596f, 0.554561436f},
-std::array<float,2>{0.827880681f, 0.141354725f},
-std::array<float,2>{0.078222625f, 0.66013819f},
-std::array<float,2>{0.490177304f, 0.312076032f},
-std::array<float,2>{0.674392283f, 0.920924425f},
-std::array<float,2>{0.720487356f, 0.230500698f},
-std::array<float,2>{0.399542749f, 0.701157928f},
-std::array<float,2>{0.0531901568f, 0.345332712f},
-std::array<float,2>{0.811378658f, 0.959566474f},
-std::array<float,2>{0.953505099f, 0.430182397f},
-std::array<float,2>{0.244495407f, 0.851660907f},
-std::array<float,2>{0.270942956f, 0.002236865f},
-std::array<float,2>{0.578540802f, 0.611810029f},
-std::array<float,2>{0.525587916f, 0.30047676f},
-std::array<float,2>{0.322282851f, 0.907285988f},
-std::array<float,2>{0.175280586f, 0.151044473f},
-std::array<float,2>{0.934057653f, 0.671827555f},
-std::array<float,2>{0.870455742f, 0.107656218f},
-std::array<float,2>{0.097995393f, 0.558815956f},
-std::array<float,2>{0.463993549f, 0.467204005f},
-std::array<float,2>{0.626395166f, 0.803638041f},
-std::array<float,2>{0.619318843f, 0.0509960204f},
-std::array<float,2>{0.284313589f, 0.564008355f},
-std::array<float,2>{0.207888633f, 0.386038303f},
-std::array<float,2>{0.971621692f, 0.826134324f},
-std::array<float,2>{0.770680547f, 0.335956365f},
-std::array<float,2>{0.0290945619f, 0.97671169f},
-std::array<float,2>{0.411323041f, 0.200824678f},
-std::array<float,2>{0.699399948f, 0.72665292f},
-std::array<float,2>{0.686062098f, 0.481818199f},
-std::array<float,2>{0.49368453f, 0.7515589f},
-std::array<float,2>{0.090730153f, 0.0818584263f},
-std::array<float,2>{0.8163715f, 0.509384751f},
-std::array<float,2>{0.885508001f, 0.180098832f},
-std::array<float,2>{0.131148845f, 0.646478534f},
-std::array<float,2>{0.36672169f, 0.273758233f},
-std::array<float,2>{0.549735546f, 0.881293952f},
-std::array<float,2>{0.543533325f, 0.131262541f},
-std::array<float,2>{0.356429368f, 0.675326645f},
-std::array<float,2>{0.141516924f, 0.295134306f},
-std::array<float,2>{0.905311465f, 0.923836768f},
-std::array<float,2>{0.842287719f, 0.448090672f},
-std::array<float,2>{0.0727036744f, 0.787800252f},
-std::array<float,2>{0.477470428f, 0.122357853f},
-std::array<float,2>{0.659543931f, 0.544095278f},
-std::array<float,2>{0.717702985f, 0.363939822f},
-std::array<float,2>{0.436176509f, 0.941815495f},
-std::array<float,2>{0.015220589f, 0.249061853f},
-std::array<float,2>{0.750897527f, 0.703217566f},
-std::array<float,2>{0.989786685f, 0.0221563987f},
-std::array<float,2>{0.193225458f, 0.595302284f},
-std::array<float,2>{0.305503011f, 0.409402907f},
-std::array<float,2>{0.6044209f, 0.868254662f},
-std::array<float,2>{0.641864657f, 0.0737665966f},
-std::array<float,2>{0.450608939f, 0.530705333f},
-std::array<float,2>{0.120992474f, 0.487012088f},
-std::array<float,2>{0.858182251f, 0.777063131f},
-std::array<float,2>{0.91033864f, 0.262205541f},
-std::array<float,2>{0.158496335f, 0.891279817f},
-std::array<float,2>{0.341507196f, 0.157907963f},
-std::array<float,2>{0.511835158f, 0.640027344f},
-std::array<float,2>{0.577136517f, 0.392392516f},
-std::array<float,2>{0.264802337f, 0.835159183f},
-std::array<float,2>{0.232268378f, 0.0314744525f},
-std::array<float,2>{0.946938992f, 0.579898655f},
-std::array<float,2>{0.787608624f, 0.218234867f},
-std::array<float,2>{0.0319547541f, 0.741270959f},
-std::array<float,2>{0.385340005f, 0.319055289f},
-std::array<float,2>{0.746782899f, 0.990367889f},
-std::array<float,2>{0.663415074f, 0.188379958f},
-std::array<float,2>{0.480619073f, 0.719416559f},
-std::array<float,2>{0.0750498772f, 0.332355112f},
-std::array<float,2>{0.836158395f, 0.971415341f},
-std::array<float,2>{0.898750126f, 0.382716149f},
-std::array<float,2>{0.144811139f, 0.814522564f},
-std::array<float,2>{0.353993624f, 0.0617893785f},
-std::array<float,2>{0.539337695f, 0.570443511f},
-std::array<float,2>{0.608819664f, 0.271078289f},
-std::array<float,2>{0.311851859f, 0.883776248f},
-std::array<float,2>{0.19046171f, 0.174995646f},
-std::array<float,2>{0.986802697f, 0.654191971f},
-std::array<float,2>{0.755922437f, 0.0904857814f},
-std::array<float,2>{0.0116006751f, 0.507625818f},
-std::array<float,2>{0.430796593f, 0.474463582f},
-std::array<float,2>{0.712639213f, 0.762457252f},
-std::array<float,2>{0.508812606f, 0.0134021947f},
-std::array<float,2>{0.336833566f, 0.619156897f},
-std::array<float,2>{0.162454575f, 0.429583728f},
-std::array<float,2>{0.907232642f, 0.84816885f},
-std::array<float,2>{0.853515506f, 0.352779776f},
-std::array<float,2>{0.122956991f, 0.964185476f},
-std::array<float,2>{0.446135461f, 0.220321789f},
-std::array<float,2>{0.648003697f, 0.689982474f},
-std::array<float,2>{0.742344439f, 0.457908332f},
-std::array<float,2>{0.389994621f, 0.805374503f},
-std::array<float,2>{0.0365331955f, 0.0949712396f},
-std::array<float,2>{0.783996701f, 0.549754143f},
-std::array<float,2>{0.950070441f, 0.14694491f},
-std::array<float,2>{0.226688847f, 0.661326885f},
-std::array<float,2>{0.26163289f, 0.304723293f},
-std::array<float,2>{0.571278512f, 0.914817035f},
-std::array<float,2>{0.583518147f, 0.164973006f},
-std::array<float,2>{0.267302215f, 0.625980079f},
-std::array<float,2>{0.249535069f, 0.257070273f},
-std::array<float,2>{0.957440257f, 0.904244065f},
-std::array<float,2>{0.805425346f, 0.493681729f},
-std::array<float,2>{0.0470126048f, 0.771497965f},
-std::array<float,2>{0.405127436f, 0.0662798509f},
-std::array<float,2>{0.722784042f, 0.523284733f},
-std::array<float,2>{0.629842997f, 0.328092843f},
-std::array<float,2>{0.467223555f, 0.999565363f},
-std::array<float,2>{0.0953323022f, 0.204895943f},
-std::array<float,2>{0.874294579f, 0.747610867f},
-std::array<float,2>{0.932655275f, 0.0400913469f},
-std::array<float,2>{0.176293194f, 0.592546344f},
-std::array<float,2>{0.324235052f, 0.405038267f},
-std::array<float,2>{0.529534876f, 0.839440703f},
-std::array<float,2>{0.695770621f, 0.114107013f},
-std::array<float,2>{0.409498036f, 0.537121236f},
-std::array<float,2>{0.025038952f, 0.438480079f},
-std::array<float,2>{0.765823126f, 0.789715767f},
-std::array<float,2>{0.974902093f, 0.283801496f},
-std::array<float,2>{0.206330553f, 0.932516873f},
-std::array<float,2>{0.288863301f, 0.136918485f},
-std::array<float,2>{0.624896646f, 0.680571973f},
-std::array<float,2>{0.553349495f, 0.421640635f},
-std::array<float,2>{0.362986237f, 0.862205386f},
-std::array<float,2>{0.125074968f, 0.0244465675f},
-std::array<float,2>{0.889895499f, 0.602469862f},
-std::array<float,2>{0.819643259f, 0.234785631f},
-std::array<float,2>{0.0863128528f, 0.715623856f},
-std::array<float,2>{0.498950362f, 0.372092336f},
-std::array<float,2>{0.683394074f, 0.94737494f},
-std::array<float,2>{0.728883207f, 0.128579378f},
-std::array<float,2>{0.393971652f, 0.677515388f},
-std::array<float,2>{0.0599976964f, 0.290495574f},
-std::array<float,2>{0.803079724f, 0.929107606f},
-std::array<float,2>{0.965452671f, 0.451732844f},
-std::array<float,2>{0.239996135f, 0.782352388f},
-std::array<float,2>{0.276408255f, 0.117789596f},
-std::array<float,2>{0.590052664f, 0.542523086f},
-std::array<float,2>{0.521411717f, 0.363164067f},
-std::array<float,2>{0.313475639f, 0.938685179f},
-std::array<float,2>{0.183606625f, 0.244853586f},
-std::array<float,2>{0.922382116f, 0.710785329f},
-std::array<float,2>{0.859509468f, 0.0164257325f},
-std::array<float,2>{0.103524446f, 0.598895907f},
-std::array<float,2>{0.454093397f, 0.412171602f},
-std::array<float,2>{0.636240065f, 0.873600781f},
-std::array<float,2>{0.612867951f, 0.0779719502f},
-std::array<float,2>{0.291850567f, 0.526218414f},
-std::array<float,2>{0.21829018f, 0.490544975f},
-std::array<float,2>{0.976757407f, 0.779933214f},
-std::array<float,2>{0.773441374f, 0.258297265f},
-std::array<float,2>{0.01970567f, 0.898284197f},
-std::array<float,2>{0.421477407f, 0.160308346f},
-std::array<float,2>{0.689627886f, 0.63339597f},
-std::array<float,2>{0.675794244f, 0.397429883f},
-std::array<float,2>{0.485382676f, 0.831282496f},
-std::array<float,2>{0.083582297f, 0.0352145545f},
-std::array<float,2>{0.822577655f, 0.583658993f},
-std::array<float,2>{0.875071108f, 0.212839007f},
-std::array<float,2>{0.134303391f, 0.736262381f},
-std::array<float,2>{0.374734879f, 0.31417498f},
-std::array<float,2>{0.555895686f, 0.988124967f},
-std::array<float,2>{0.534367323f, 0.230043352f},
-std::array<float,2>{0.34789592f, 0.698463142f},
-std::array<float,2>{0.150955662f, 0.34813267f},
-std::array<float,2>{0.896385074f, 0.955090642f},
-std::array<float,2>{0.83590591f, 0.436666131f},
-std::array<float,2>{0.0656621754f, 0.859346092f},
-std::array<float,2>{0.474788487f, 0.00464662956f},
-std::array<float,2>{0.670874536f, 0.616605997f},
-std::array<float,2>{0.709556401f, 0.303471327f},
-std::array<float,2>{0.424433917f, 0.910352528f},
-std::array<float,2>{0.00488929357f, 0.153184533f},
-std::array<float,2>{0.758755326f, 0.667207599f},
-std::array<float,2>{0.994195044f, 0.104792371f},
-std::array<float,2>{0.20210956f, 0.554905474f},
-std::array<float,2>{0.301950186f, 0.461911619f},
-std::array<float,2>{0.597185373f, 0.799161613f},
-std::array<float,2>{0.653324723f, 0.0497473814f},
-std::array<float,2>{0.442007512f, 0.567328632f},
-std::array<float,2>{0.112903394f, 0.386922836f},
-std::array<float,2>{0.847945035f, 0.821103334f},
-std::array<float,2>{0.918660104f, 0.34102121f},
-std::array<float,2>{0.17126672f, 0.982614279f},
-std::array<float,2>{0.333562911f, 0.197257847f},
-std::array<float,2>{0.501814723f, 0.733180702f},
-std::array<float,2>{0.569934011f, 0.478013009f},
-std::array<float,2>{0.25489518f, 0.757528663f},
-std::array<float,2>{0.220441416f, 0.0841231495f},
-std::array<float,2>{0.939372182f, 0.513939142f},
-std::array<float,2>{0.793716788f, 0.185158089f},
-std::array<float,2>{0.039711047f, 0.643924534f},
-std::array<float,2>{0.376962185f, 0.27881065f},
-std::array<float,2>{0.73976922f, 0.878817558f},
-std::array<float,2>{0.638426125f, 0.176570043f},
-std::array<float,2>{0.459286094f, 0.651160181f},
-std::array<float,2>{0.109211639f, 0.269291222f},
-std::array<float,2>{0.863402188f, 0.889741838f},
-std::array<float,2>{0.925955594f, 0.470297992f},
-std::array<float,2>{0.180073619f, 0.75859803f},
-std::array<float,2>{0.319866896f, 0.0897482559f},
-std::array<float,2>{0.516546071f, 0.503457129f},
-std::array<float,2>{0.588870406f, 0.329342425f},
-std::array<float,2>{0.280687481f, 0.976258576f},
-std::array<float,2>{0.237511724f, 0.194512993f},
-std::array<float,2>{0.963157475f, 0.723562479f},
-std::array<float,2>{0.800588727f, 0.05565276f},
-std::array<float,2>{0.057032235f, 0.577178299f},
-std::array<float,2>{0.395683318f, 0.375612289f},
-std::array<float,2>{0.73396647f, 0.819615364f},
-std::array<float,2>{0.561724842f, 0.0978237018f},
-std::array<float,2>{0.368246973f, 0.553063929f},
-std::array<float,2>{0.137644917f, 0.453336626f},
-std::array<float,2>{0.881291687f, 0.812457681f},
-std::array<float,2>{0.825792074f, 0.310581446f},
-std::array<float,2>{0.0804391652f, 0.920199454f},
-std::array<float,2>{0.492019296f, 0.141852915f},
-std::array<float,2>{0.673598766f, 0.65870887f},
-std::array<float,2>{0.692317963f, 0.424862564f},
-std::array<float,2>{0.417189956f, 0.845564842f},
-std::array<float,2>{0.0187605303f, 0.00945224613f},
-std::array<float,2>{0.778655887f, 0.623709679f},
-std::array<float,2>{0.98301053f, 0.223682359f},
-std::array<float,2>{0.212149292f, 0.69364816f},
-std::array<float,2>{0.296780735f, 0.358176291f},
-std::array<float,2>{0.615086198f, 0.965415239f},
-std::array<float,2>{0.598096788f, 0.210122243f},
-std::array<float,2>{0.298761278f, 0.744543135f},
-std::array<float,2>{0.197890878f, 0.322020918f},
-std::array<float,2>{0.996892035f, 0.995416641f},
-std::array<float,2>{0.763146937f, 0.400663763f},
-std::array<float,2>{0.00163693319f, 0.842524588f},
-std::array<float,2>{0.426126033f, 0.043724969f},
-std::array<float,2>{0.706520259f, 0.589348972f},
-std::array<float,2>{0.66422075f, 0.251715183f},
-std::array<float,2>{0.46954599f, 0.901010871f},
-std::array<float,2>{0.0693419129f, 0.170575917f},
-std::array<float,2>{0.830110729f, 0.631347239f},
-std::array<float,2>{0.892617106f, 0.0691223517f},
-std::array<float,2>{0.154910311f, 0.516435921f},
-std::array<float,2>{0.344317228f, 0.49647209f},
-std::array<float,2>{0.538762748f, 0.768663466f},
-std::array<float,2>{0.736312926f, 0.031134177f},
-std::array<float,2>{0.382323056f, 0.608511925f},
-std::array<float,2>{0.0445563309f, 0.416558236f},
-std::array<float,2>{0.792256415f, 0.866672873f},
-std::array<float,2>{0.944244444f, 0.367655963f},
-std::array<float,2>{0.224393249f, 0.95156759f},
-std::array<float,2>{0.251874357f, 0.241108462f},
-std::array<float,2>{0.566053033f, 0.711781085f},
-std::array<float,2>{0.506043792f, 0.441420674f},
-std::array<float,2>{0.329285443f, 0.796794474f},
-std::array<float,2>{0.165049329f, 0.110043548f},
-std::array<float,2>{0.916272342f, 0.534197807f},
-std::array<float,2>{0.847289681f, 0.133113652f},
-std::array<float,2>{0.117010236f, 0.684108615f},
-std::array<float,2>{0.438347191f, 0.288446933f},
-std::array<float,2>{0.651175976f, 0.93423444f},
-std::array<float,2>{0.715741515f, 0.248451158f},
-std::array<float,2>{0.433894843f, 0.704838753f},
-std::array<float,2>{0.0129360948f, 0.364532739f},
-std::array<float,2>{0.752752602f, 0.942507088f},
-std::array<float,2>{0.990632415f, 0.40869382f},
-std::array<float,2>{0.193685219f, 0.867202044f},
-std::array<float,2>{0.307171434f, 0.0228536185f},
-std::array<float,2>{0.601848602f, 0.594092548f},
-std::array<float,2>{0.545573413f, 0.29662475f},
-std::array<float,2>{0.358293027f, 0.924944341f},
-std::array<float,2>{0.142683461f, 0.132295802f},
-std::array<float,2>{0.903882861f, 0.673922062f},
-std::array<float,2>{0.841199636f, 0.121483095f},
-std::array<float,2>{0.0718567222f, 0.543307185f},
-std::array<float,2>{0.479621559f, 0.448966712f},
-std::array<float,2>{0.657315195f, 0.788527429f},
-std::array<float,2>{0.574575245f, 0.0326271169f},
-std::array<float,2>{0.263583302f, 0.578665674f},
-std::array<float,2>{0.233351558f, 0.391164064f},
-std::array<float,2>{0.947301209f, 0.834067762f},
-std::array<float,2>{0.78535682f, 0.320156217f},
-std::array<float,2>{0.0338585638f, 0.991797626f},
-std::array<float,2>{0.384068996f, 0.217444062f},
-std::array<float,2>{0.748754561f, 0.740623534f},
-std::array<float,2>{0.644290328f, 0.488277882f},
-std::array<float,2>{0.451363206f, 0.776270092f},
-std::array<float,2>{0.118478008f, 0.0722913295f},
-std::array<float,2>{0.857385993f, 0.530098557f},
-std::array<float,2>{0.91219008f, 0.156256109f},
-std::array<float,2>{0.156374291f, 0.638766527f},
-std::array<float,2>{0.342684597f, 0.263547659f},
-std::array<float,2>{0.513834774f, 0.892250896f},
-std::array<float,2>{0.523756027f, 0.151980236f},
-std::array<float,2>{0.321529776f, 0.670086682f},
-std::array<float,2>{0.173607379f, 0.299599916f},
-std::array<float,2>{0.935860515f, 0.906342149f},
-std::array<float,2>{0.867437959f, 0.468715549f},
-std::array<float,2>{0.101449378f, 0.804331601f},
-std::array<float,2>{0.461606294f, 0.109329022f},
-std::array<float,2>{0.627896845f, 0.560009122f},
-std::array<float,2>{0.720841289f, 0.344627798f},
-std::array<float,2>{0.40210557f, 0.960153461f},
-std::array<float,2>{0.052328255f, 0.232306063f},
-std::array<float,2>{0.809066415f, 0.699242771f},
-std::array<float,2>{0.956327319f, 0.0033696692f},
-std::array<float,2>{0.242679775f, 0.613018751f},
-std::array<float,2>{0.273221821f, 0.43092224f},
-std::array<float,2>{0.580800653f, 0.852864206f},
-std::array<float,2>{0.684786201f, 0.0807896107f},
-std::array<float,2>{0.494175076f, 0.507822216f},
-std::array<float,2>{0.0919400901f, 0.481430203f},
-std::array<float,2>{0.812830508f, 0.750231624f},
-std::array<float,2>{0.884453356f, 0.275064141f},
-std::array<float,2>{0.130298913f, 0.882768452f},
-std::array<float,2>{0.363784254f, 0.18094942f},
-std::array<float,2>{0.548057616f, 0.6449669f},
-std::array<float,2>{0.618359447f, 0.385723174f},
-std::array<float,2>{0.282577932f, 0.824329138f},
-std::array<float,2>{0.210411683f, 0.0526559837f},
-std::array<float,2>{0.969050646f, 0.562664509f},
-std::array<float,2>{0.773430824f, 0.199755162f},
-std::array<float,2>{0.0297988486f, 0.727957308f},
-std::array<float,2>{0.412345052f, 0.337730497f},
-std::array<float,2>{0.701366544f, 0.978368223f},
-std::array<float,2>{0.646399796f, 0.221550688f},
-std::array<float,2>{0.448040694f, 0.689411223f},
-std::array<float,2>{0.124157377f, 0.355101138f},
-std::array<float,2>{0.85444963f, 0.962018609f},
-std::array<float,2>{0.908470988f, 0.42579326f},
-std::array<float,2>{0.160684139f, 0.851376414f},
-std::array<float,2>{0.339434326f, 0.0147827445f},
-std::array<float,2>{0.510591805f, 0.618092179f},
-std::array<float,2>{0.57302165f, 0.307470977f},
-std::array<float,2>{0.259719104f, 0.916250527f},
-std::array<float,2>{0.230160356f, 0.144686639f},
-std::array<float,2>{0.952250719f, 0.663369179f},
-std::array<float,2>{0.781269312f, 0.0964097232f},
-std::array<float,2>{0.0390425399f, 0.548468351f},
-std::array<float,2>{0.387348413f, 0.460312635f},
-std::array<float,2>{0.745601296f, 0.808212221f},
-std::array<float,2>{0.542529821f, 0.0587399639f},
-std::array<float,2>{0.353457063f, 0.57340306f},
-std::array<float,2>{0.147999227f, 0.379627347f},
-std::array<float,2>{0.900575161f, 0.813096464f},
-std::array<float,2>{0.838933289f, 0.334672123f},
-std::array<float,2>{0.0769407302f, 0.969729424f},
-std::array<float,2>{0.48333171f, 0.190377608f},
-std::array<float,2>{0.6603567f, 0.721777618f},
-std::array<float,2>{0.714610398f, 0.476155519f},
-std::array<float,2>{0.433509827f, 0.76539588f},
-std::array<float,2>{0.00961881876f, 0.0930988714f},
-std::array<float,2>{0.754818738f, 0.50528723f},
-std::array<float,2>{0.985362113f, 0.173817307f},
-std::array<float,2>{0.188568175f, 0.655980408f},
-std::array<float,2>{0.310375422f, 0.271894395f},
-std::array<float,2>{0.607392609f, 0.885047138f},
-std::array<float,2>{0.621700466f, 0.138968736f},
-std::array<float,2>{0.285979003f, 0.683227956f},
-std::array<float,2>{0.203593597f, 0.282154471f},
-std::array<float,2>{0.973675311f, 0.930565596f},
-std::array<float,2>{0.769103169f, 0.439516395f},
-std::array<float,2>{0.0268582627f, 0.792919636f},
-std::array<float,2>{0.406483412f, 0.116031714f},
-std::array<float,2>{0.698651969f, 0.535176754f},
-std::array<float,2>{0.681631267f, 0.373798609f},
-std::array<float,2>{0.497991234f, 0.945776224f},
-std::array<float,2>{0.0881849527f, 0.23706238f},
-std::array<float,2>{0.818100035f, 0.717873335f},
-std::array<float,2>{0.888494074f, 0.0265719686f},
-std::array<float,2>{0.128749236f, 0.604943037f},
-std::array<float,2>{0.360036969f, 0.419878036f},
-std::array<float,2>{0.551059484f, 0.860152185f},
-std::array<float,2>{0.726466894f, 0.0636177137f},
-std::array<float,2>{0.403186649f, 0.520477116f},
-std::array<float,2>{0.0502756871f, 0.494529784f},
-std::array<float,2>{0.807266116f, 0.770739555f},
-std::array<float,2>{0.959660649f, 0.255250812f},
-std::array<float,2>{0.246672139f, 0.906059444f},
-std::array<float,2>{0.268281102f, 0.167124584f},
-std::array<float,2>{0.584272623f, 0.627595484f},
-std::array<float,2>{0.527751625f, 0.402441114f},
-std::array<float,2>{0.326786011f, 0.836486459f},
-std::array<float,2>{0.179631501f, 0.0421242565f},
-std::array<float,2>{0.931475759f, 0.591333926f},
-std::array<float,2>{0.872226715f, 0.206579953f},
-std::array<float,2>{0.0969226584f, 0.748783469f},
-std::array<float,2>{0.46550867f, 0.324397594f},
-std::array<float,2>{0.630904257f, 0.996427417f},
-std::array<float,2>{0.688853323f, 0.162654936f},
-std::array<float,2>{0.419010609f, 0.634899318f},
-std::array<float,2>{0.0224110205f, 0.260194689f},
-std::array<float,2>{0.776535988f, 0.896023214f},
-std::array<float,2>{0.980069458f, 0.489786863f},
-std::array<float,2>{0.21663931f, 0.777676165f},
-std::array<float,2>{0.289528459f, 0.0751262605f},
-std::array<float,2>{0.609461725f, 0.524958134f},
-std::array<float,2>{0.557685614f, 0.315462798f},
-std::array<float,2>{0.371572942f, 0.98560679f},
-std::array<float,2>{0.136289924f, 0.214548796f},
-std::array<float,2>{0.877420843f, 0.736766279f},
-std::array<float,2>{0.822258532f, 0.0384184755f},
-std::array<float,2>{0.084837243f, 0.585359693f},
-std::array<float,2>{0.486610323f, 0.395357102f},
-std::array<float,2>{0.677867532f, 0.828217328f},
-std::array<float,2>{0.592312634f, 0.119448915f},
-std::array<float,2>{0.274934083f, 0.539112628f},
-std::array<float,2>{0.242085859f, 0.450030476f},
-std::array<float,2>{0.967253447f, 0.784409225f},
-std::array<float,2>{0.802574813f, 0.292162001f},
-std::array<float,2>{0.0616674162f, 0.92643106f},
-std::array<float,2>{0.391623497f, 0.126254439f},
-std::array<float,2>{0.727935493f, 0.678631723f},
-std::array<float,2>{0.634157062f, 0.411611497f},
-std::array<float,2>{0.456364453f, 0.872885287f},
-std::array<float,2>{0.102070928f, 0.0181038231f},
-std::array<float,2>{0.861843407f, 0.600275636f},
-std::array<float,2>{0.925681591f, 0.242258251f},
-std::array<float,2>{0.186300963f, 0.708751678f},
-std::array<float,2>{0.31635347f, 0.360819459f},
-std::array<float,2>{0.523114622f, 0.940763056f},
-std::array<float,2>{0.502109349f, 0.198557884f},
-std::array<float,2>{0.334699363f, 0.731022f},
-std::array<float,2>{0.16947031f, 0.343748987f},
-std::array<float,2>{0.921322167f, 0.982299447f},
-std::array<float,2>{0.85020709f, 0.389890254f},
-std::array<float,2>{0.11131607f, 0.822607398f},
-std::array<float,2>{0.444878191f, 0.0472881161f},
-std::array<float,2>{0.655935109f, 0.569564223f},
-std::array<float,2>{0.741813183f, 0.280935138f},
-std::array<float,2>{0.376142859f, 0.875780165f},
-std::array<float,2>{0.0422106422f, 0.18661885f},
-std::array<float,2>{0.796116054f, 0.640631497f},
-std::array<float,2>{0.939638555f, 0.08355809f},
-std::array<float,2>{0.220797077f, 0.512285769f},
-std::array<float,2>{0.256689876f, 0.478578806f},
-std::array<float,2>{0.56709981f, 0.754248619f},
-std::array<float,2>{0.668488204f, 0.00741507858f},
-std::array<float,2>{0.474141181f, 0.61425823f},
-std::array<float,2>{0.0641562268f, 0.433630586f},
-std::array<float,2>{0.833303094f, 0.856708765f},
-std::array<float,2>{0.898193181f, 0.350699902f},
-std::array<float,2>{0.150108516f, 0.954721034f},
-std::array<float,2>{0.349812895f, 0.228302315f},
-std::array<float,2>{0.532166839f, 0.695811152f},
-std::array<float,2>{0.595538735f, 0.463456422f},
-std::array<float,2>{0.3038387f, 0.798616886f},
-std::array<float,2>{0.200641006f, 0.102349132f},
-std::array<float,2>{0.993507028f, 0.557751656f},
-std::array<float,2>{0.759934187f, 0.155499399f},
-std::array<float,2>{0.00755506847f, 0.664816797f},
-std::array<float,2>{0.422293633f, 0.301062763f},
-std::array<float,2>{0.708355546f, 0.913653314f},
-std::array<float,2>{0.675165892f, 0.143806651f},
-std::array<float,2>{0.488736898f, 0.656513631f},
-std::array<float,2>{0.0796517953f, 0.309541613f},
-std::array<float,2>{0.826761663f, 0.919661641f},
-std::array<float,2>{0.878970742f, 0.456021935f},
-std::array<float,2>{0.140280053f, 0.810140193f},
-std::array<float,2>{0.370465606f, 0.101273842f},
-std::array<float,2>{0.559682012f, 0.552295744f},
-std::array<float,2>{0.616537809f, 0.357293487f},
-std::array<float,2>{0.294216573f, 0.96863693f},
-std::array<float,2>{0.213956341f, 0.225905433f},
-std::array<float,2>{0.981176674f, 0.692905545f},
-std::array<float,2>{0.779966712f, 0.0102687767f},
-std::array<float,2>{0.016867036f, 0.621269047f},
-std::array<float,2>{0.41470775f, 0.422863752f},
-std::array<float,2>{0.694020092f, 0.845860362f},
-std::array<float,2>{0.518671691f, 0.0873398036f},
-std::array<float,2>{0.316908449f, 0.500001967f},
-std::array<float,2>{0.182057157f, 0.472451121f},
-std::array<float,2>{0.927747071f, 0.760081053f},
-std::array<float,2>{0.866400659f, 0.267568409f},
-std::array<float,2>{0.10560146f, 0.887801647f},
-std::array<float,2>{0.457407743f, 0.177967563f},
-std::array<float,2>{0.639255822f, 0.648969293f},
-std::array<float,2>{0.731806874f, 0.377918065f},
-std::array<float,2>{0.396517009f, 0.817456782f},
-std::array<float,2>{0.0560518317f, 0.0568267554f},
-std::array<float,2>{0.798686445f, 0.575688362f},
-std::array<float,2>{0.962820768f, 0.192713141f},
-std::array<float,2>{0.234837383f, 0.724920273f},
-std::array<float,2>{0.278897345f, 0.330280274f},
-std::array<float,2>{0.5873034f, 0.974198461f},
-std::array<float,2>{0.563773632f, 0.239817873f},
-std::array<float,2>{0.253635466f, 0.714147985f},
-std::array<float,2>{0.225891918f, 0.369479984f},
-std::array<float,2>{0.942685962f, 0.94938761f},
-std::array<float,2>{0.789283454f, 0.415697575f},
-std::array<float,2>{0.0456311256f, 0.864787936f},
-std::array<float,2>{0.379411459f, 0.0288138781f},
-std::array<float,2>{0.73760283f, 0.607313097f},
-std::array<float,2>{0.648861885f, 0.286922872f},
-std::array<float,2>{0.440121919f, 0.936234534f},
-std::array<float,2>{0.114281729f, 0.134826288f},
-std::array<float,2>{0.84565711f, 0.685727358f},
-std::array<float,2>{0.914798796f, 0.111997403f},
-std::array<float,2>{0.167302907f, 0.532851815f},
-std::array<float,2>{0.331080109f, 0.444694251f},
-std::array<float,2>{0.50411886f, 0.793178737f},
-std::array<float,2>{0.703410864f, 0.0464274213f},
-std::array<float,2>{0.428530574f, 0.587594628f},
-std::array<float,2>{0.00220241654f, 0.398513019f},
-std::array<float,2>{0.764311254f, 0.84163636f},
-std::array<float,2>{0.999528468f, 0.322367251f},
-std::array<float,2>{0.196945131f, 0.993818104f},
-std::array<float,2>{0.300156593f, 0.208616808f},
-std::array<float,2>{0.600189388f, 0.743192375f},
-std::array<float,2>{0.536407173f, 0.499618739f},
-std::array<float,2>{0.347614974f, 0.765818834f},
-std::array<float,2>{0.153686166f, 0.0664813742f},
-std::array<float,2>{0.891794562f, 0.51891613f},
-std::array<float,2>{0.828412771f, 0.168364614f},
-std::array<float,2>{0.0664220005f, 0.629637659f},
-std::array<float,2>{0.471712321f, 0.253530234f},
-std::array<float,2>{0.666221499f, 0.900159955f},
-std::array<float,2>{0.74777478f, 0.215539381f},
-std::array<float,2>{0.386205733f, 0.7387591f},
-std::array<float,2>{0.0330137722f, 0.316874921f},
-std::array<float,2>{0.788376987f, 0.989775598f},
-std::array<float,2>{0.946160257f, 0.393669605f},
-std::array<float,2>{0.231151849f, 0.832855105f},
-std::array<float,2>{0.263946235f, 0.0348203108f},
-std::array<float,2>{0.577356219f, 0.581881404f},
-std::array<float,2>{0.513597488f, 0.265087932f},
-std::array<float,2>{0.340029418f, 0.89327997f},
-std::array<float,2>{0.159698367f, 0.158472404f},
-std::array<float,2>{0.911443174f, 0.638307273f},
-std::array<float,2>{0.859312534f, 0.0716952011f},
-std::array<float,2>{0.119888671f, 0.527487278f},
-std::array<float,2>{0.449473381f, 0.4846223f},
-std::array<float,2>{0.641437471f, 0.774298906f},
-std::array<float,2>{0.604639828f, 0.0214118175f},
-std::array<float,2>{0.306492537f, 0.597155869f},
-std::array<float,2>{0.191504627f, 0.407507598f},
-std::array<float,2>{0.989047766f, 0.870416403f},
-std::array<float,2>{0.751347721f, 0.365530372f},
-std::array<float,2>{0.0145780407f, 0.94371593f},
-std::array<float,2>{0.437211126f, 0.247216329f},
-std::array<float,2>{0.71795541f, 0.7066347f},
-std::array<float,2>{0.658379257f, 0.446770638f},
-std::array<float,2>{0.4783943f, 0.785960555f},
-std::array<float,2>{0.0737538412f, 0.124640264f},
-std::array<float,2>{0.843099177f, 0.545718372f},
-std::array<float,2>{0.905103266f, 0.129143372f},
-std::array<float,2>{0.141916469f, 0.672424912f},
-std::array<float,2>{0.356927216f, 0.293314308f},
-std::array<float,2>{0.544356525f, 0.923120201f},
-std::array<float,2>{0.550463021f, 0.182476565f},
-std::array<float,2>{0.365262568f, 0.648354232f},
-std::array<float,2>{0.132138655f, 0.276599765f},
-std::array<float,2>{0.886409521f, 0.880132914f},
-std::array<float,2>{0.814993262f, 0.483899981f},
-std::array<float,2>{0.0908755511f, 0.752830565f},
-std::array<float,2>{0.492736936f, 0.0794703811f},
-std::array<float,2>{0.686841011f, 0.509913623f},
-std::array<float,2>{0.700735629f, 0.338763863f},
-std::array<float,2>{0.411085397f, 0.979869366f},
-std::array<float,2>{0.0280175004f, 0.202754959f},
-std::array<float,2>{0.769886613f, 0.729581296f},
-std::array<float,2>{0.972086906f, 0.054003641f},
-std::array<float,2>{0.208732173f, 0.565038562f},
-std::array<float,2>{0.283768535f, 0.38455075f},
-std::array<float,2>{0.620189607f, 0.826304257f},
-std::array<float,2>{0.6250844f, 0.106830351f},
-std::array<float,2>{0.462915361f, 0.560623586f},
-std::array<float,2>{0.0992897823f, 0.46623525f},
-std::array<float,2>{0.86936605f, 0.802650988f},
-std::array<float,2>{0.935525417f, 0.298636109f},
-std::array<float,2>{0.174302995f, 0.909323275f},
-std::array<float,2>{0.324145854f, 0.148639798f},
-std::array<float,2>{0.527254045f, 0.669589281f},
-std::array<float,2>{0.579273343f, 0.432684541f},
-std::array<float,2>{0.26954484f, 0.854692817f},
-std::array<float,2>{0.24591285f, 0.000688316766f},
-std::array<float,2>{0.954552054f, 0.610566437f},
-std::array<float,2>{0.812422752f, 0.233863682f},
-std::array<float,2>{0.0540040843f, 0.701907635f},
-std::array<float,2>{0.398827106f, 0.347508878f},
-std::array<float,2>{0.719183326f, 0.958116889f}}
\ No newline at end of file
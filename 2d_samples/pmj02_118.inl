@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.360402793f, 0.889569163f},
-std::array<float,2>{0.692682028f, 0.272659004f},
-std::array<float,2>{0.818737209f, 0.506803095f},
-std::array<float,2>{0.0988847092f, 0.196328834f},
-std::array<float,2>{0.191274568f, 0.65825671f},
-std::array<float,2>{0.977860987f, 0.0384837985f},
-std::array<float,2>{0.602768064f, 0.807764292f},
-std::array<float,2>{0.480547041f, 0.384506553f},
-std::array<float,2>{0.432300121f, 0.592381835f},
-std::array<float,2>{0.531308234f, 0.169543028f},
-std::array<float,2>{0.919493198f, 0.993990123f},
-std::array<float,2>{0.151621953f, 0.326369196f},
-std::array<float,2>{0.026956562f, 0.81316191f},
-std::array<float,2>{0.806427836f, 0.48489061f},
-std::array<float,2>{0.667499065f, 0.71402961f},
-std::array<float,2>{0.276230693f, 0.102814138f},
-std::array<float,2>{0.454339415f, 0.757016361f},
-std::array<float,2>{0.590948284f, 0.427644134f},
-std::array<float,2>{0.948413789f, 0.628704369f},
-std::array<float,2>{0.231855363f, 0.0298554488f},
-std::array<float,2>{0.0906326398f, 0.536349118f},
-std::array<float,2>{0.862025857f, 0.232249886f},
-std::array<float,2>{0.722169757f, 0.923747778f},
-std::array<float,2>{0.328580707f, 0.306822717f},
-std::array<float,2>{0.29259941f, 0.724761426f},
-std::array<float,2>{0.638483942f, 0.0682752728f},
-std::array<float,2>{0.780945837f, 0.859975696f},
-std::array<float,2>{0.0531919524f, 0.443134695f},
-std::array<float,2>{0.182408392f, 0.960564017f},
-std::array<float,2>{0.904227197f, 0.356238872f},
-std::array<float,2>{0.528881252f, 0.599734187f},
-std::array<float,2>{0.403556854f, 0.13750416f},
-std::array<float,2>{0.250749975f, 0.853487313f},
-std::array<float,2>{0.674414158f, 0.457083881f},
-std::array<float,2>{0.795363963f, 0.739836812f},
-std::array<float,2>{0.0056555979f, 0.0877194032f},
-std::array<float,2>{0.137930915f, 0.618544519f},
-std::array<float,2>{0.92436713f, 0.141969696f},
-std::array<float,2>{0.54748112f, 0.946816623f},
-std::array<float,2>{0.412957579f, 0.374448299f},
-std::array<float,2>{0.489487588f, 0.656186879f},
-std::array<float,2>{0.609719574f, 0.00880079065f},
-std::array<float,2>{0.996483386f, 0.781161606f},
-std::array<float,2>{0.21082437f, 0.406333029f},
-std::array<float,2>{0.1162889f, 0.908353388f},
-std::array<float,2>{0.836280525f, 0.28396666f},
-std::array<float,2>{0.717931509f, 0.559838653f},
-std::array<float,2>{0.357960671f, 0.243562728f},
-std::array<float,2>{0.388207018f, 0.979267597f},
-std::array<float,2>{0.510465086f, 0.330952644f},
-std::array<float,2>{0.876001f, 0.563159347f},
-std::array<float,2>{0.168209597f, 0.18001537f},
-std::array<float,2>{0.0333550349f, 0.690895379f},
-std::array<float,2>{0.760325551f, 0.122537769f},
-std::array<float,2>{0.648460388f, 0.828125119f},
-std::array<float,2>{0.299029231f, 0.482930511f},
-std::array<float,2>{0.315639436f, 0.526276708f},
-std::array<float,2>{0.735241175f, 0.215624034f},
-std::array<float,2>{0.856834412f, 0.897023022f},
-std::array<float,2>{0.0671305656f, 0.251293868f},
-std::array<float,2>{0.24708046f, 0.791429341f},
-std::array<float,2>{0.967100322f, 0.393423289f},
-std::array<float,2>{0.571669936f, 0.684754074f},
-std::array<float,2>{0.446357131f, 0.0599709079f},
-std::array<float,2>{0.304862887f, 0.940433025f},
-std::array<float,2>{0.642694652f, 0.363141716f},
-std::array<float,2>{0.752113163f, 0.616863966f},
-std::array<float,2>{0.0397178531f, 0.155608371f},
-std::array<float,2>{0.158074021f, 0.744067073f},
-std::array<float,2>{0.884102166f, 0.0818373188f},
-std::array<float,2>{0.502272964f, 0.844864368f},
-std::array<float,2>{0.377908647f, 0.465307385f},
-std::array<float,2>{0.440681964f, 0.552183688f},
-std::array<float,2>{0.564127147f, 0.237910613f},
-std::array<float,2>{0.957006037f, 0.919254661f},
-std::array<float,2>{0.235077247f, 0.292883217f},
-std::array<float,2>{0.0768000558f, 0.766444504f},
-std::array<float,2>{0.845203042f, 0.414749116f},
-std::array<float,2>{0.744338334f, 0.646830559f},
-std::array<float,2>{0.323360145f, 0.00601803139f},
-std::array<float,2>{0.418671668f, 0.839778125f},
-std::array<float,2>{0.561105072f, 0.470061362f},
-std::array<float,2>{0.930160522f, 0.699953377f},
-std::array<float,2>{0.129642501f, 0.111091234f},
-std::array<float,2>{0.00887662079f, 0.575639844f},
-std::array<float,2>{0.787770987f, 0.177169099f},
-std::array<float,2>{0.684473038f, 0.972340584f},
-std::array<float,2>{0.262095422f, 0.343247503f},
-std::array<float,2>{0.343958855f, 0.677176952f},
-std::array<float,2>{0.707099855f, 0.0541793592f},
-std::array<float,2>{0.829692185f, 0.787965f},
-std::array<float,2>{0.121859379f, 0.399237245f},
-std::array<float,2>{0.214812934f, 0.90402174f},
-std::array<float,2>{0.985727489f, 0.259749413f},
-std::array<float,2>{0.62499696f, 0.515907884f},
-std::array<float,2>{0.499613285f, 0.204339683f},
-std::array<float,2>{0.341952622f, 0.803072393f},
-std::array<float,2>{0.733754277f, 0.377958208f},
-std::array<float,2>{0.867852986f, 0.668957591f},
-std::array<float,2>{0.085752964f, 0.0422988236f},
-std::array<float,2>{0.222794771f, 0.508420289f},
-std::array<float,2>{0.942110598f, 0.191986173f},
-std::array<float,2>{0.579233289f, 0.88024056f},
-std::array<float,2>{0.461856812f, 0.2772699f},
-std::array<float,2>{0.398328602f, 0.707249224f},
-std::array<float,2>{0.521735132f, 0.095433265f},
-std::array<float,2>{0.897034287f, 0.827550471f},
-std::array<float,2>{0.174295709f, 0.493777573f},
-std::array<float,2>{0.0614617132f, 0.99052459f},
-std::array<float,2>{0.771603584f, 0.319246531f},
-std::array<float,2>{0.626721621f, 0.584745944f},
-std::array<float,2>{0.28553468f, 0.160232574f},
-std::array<float,2>{0.469228894f, 0.929997504f},
-std::array<float,2>{0.601487935f, 0.302329957f},
-std::array<float,2>{0.970196366f, 0.546083093f},
-std::array<float,2>{0.200192809f, 0.225518808f},
-std::array<float,2>{0.106730372f, 0.637922406f},
-std::array<float,2>{0.823895574f, 0.0213324204f},
-std::array<float,2>{0.69997859f, 0.762611091f},
-std::array<float,2>{0.367623091f, 0.434391975f},
-std::array<float,2>{0.269639075f, 0.609089136f},
-std::array<float,2>{0.662030458f, 0.130536139f},
-std::array<float,2>{0.799170196f, 0.960990608f},
-std::array<float,2>{0.021773342f, 0.344641566f},
-std::array<float,2>{0.140768304f, 0.873991787f},
-std::array<float,2>{0.911400974f, 0.450692058f},
-std::array<float,2>{0.542663515f, 0.732792199f},
-std::array<float,2>{0.421938866f, 0.0753608644f},
-std::array<float,2>{0.324602097f, 0.997570992f},
-std::array<float,2>{0.749443948f, 0.32085067f},
-std::array<float,2>{0.84957391f, 0.587698042f},
-std::array<float,2>{0.0705867633f, 0.166431934f},
-std::array<float,2>{0.238594607f, 0.716608226f},
-std::array<float,2>{0.958547115f, 0.107440516f},
-std::array<float,2>{0.569348931f, 0.819330513f},
-std::array<float,2>{0.441450596f, 0.489986449f},
-std::array<float,2>{0.379907638f, 0.502732158f},
-std::array<float,2>{0.505482614f, 0.202903003f},
-std::array<float,2>{0.887058556f, 0.885683179f},
-std::array<float,2>{0.160164759f, 0.266304523f},
-std::array<float,2>{0.0452554934f, 0.810975432f},
-std::array<float,2>{0.757390499f, 0.388947457f},
-std::array<float,2>{0.646673322f, 0.661933124f},
-std::array<float,2>{0.309261829f, 0.0343466699f},
-std::array<float,2>{0.492285073f, 0.865470648f},
-std::array<float,2>{0.620526671f, 0.440495312f},
-std::array<float,2>{0.98875773f, 0.721918821f},
-std::array<float,2>{0.218734279f, 0.0663748235f},
-std::array<float,2>{0.117247507f, 0.59582603f},
-std::array<float,2>{0.833133101f, 0.136208221f},
-std::array<float,2>{0.705458522f, 0.955754638f},
-std::array<float,2>{0.348816961f, 0.354116738f},
-std::array<float,2>{0.259107232f, 0.630360782f},
-std::array<float,2>{0.68186295f, 0.0251525939f},
-std::array<float,2>{0.783708155f, 0.75378722f},
-std::array<float,2>{0.0152580626f, 0.423163056f},
-std::array<float,2>{0.128087148f, 0.929017663f},
-std::array<float,2>{0.933900833f, 0.310040504f},
-std::array<float,2>{0.55602622f, 0.533109069f},
-std::array<float,2>{0.416998595f, 0.227349997f},
-std::array<float,2>{0.284165114f, 0.773567379f},
-std::array<float,2>{0.630467176f, 0.412522882f},
-std::array<float,2>{0.767499804f, 0.651825309f},
-std::array<float,2>{0.0585199408f, 0.0151507724f},
-std::array<float,2>{0.176172018f, 0.557195723f},
-std::array<float,2>{0.893004298f, 0.247731656f},
-std::array<float,2>{0.516535819f, 0.913123846f},
-std::array<float,2>{0.393360406f, 0.286614031f},
-std::array<float,2>{0.467026085f, 0.734643817f},
-std::array<float,2>{0.583712757f, 0.0937244818f},
-std::array<float,2>{0.938113749f, 0.856787026f},
-std::array<float,2>{0.221537739f, 0.454196393f},
-std::array<float,2>{0.0808400065f, 0.952166259f},
-std::array<float,2>{0.871694505f, 0.370612085f},
-std::array<float,2>{0.728699088f, 0.623825669f},
-std::array<float,2>{0.336942494f, 0.147041306f},
-std::array<float,2>{0.426344424f, 0.892139494f},
-std::array<float,2>{0.546638548f, 0.256238312f},
-std::array<float,2>{0.909823f, 0.52887857f},
-std::array<float,2>{0.146742612f, 0.213698357f},
-std::array<float,2>{0.0177590661f, 0.680966794f},
-std::array<float,2>{0.803271115f, 0.0550434105f},
-std::array<float,2>{0.658558369f, 0.793984532f},
-std::array<float,2>{0.266980767f, 0.396354437f},
-std::array<float,2>{0.373769194f, 0.566899419f},
-std::array<float,2>{0.697286904f, 0.185560003f},
-std::array<float,2>{0.827170193f, 0.98059392f},
-std::array<float,2>{0.102088407f, 0.335109591f},
-std::array<float,2>{0.198412284f, 0.832179964f},
-std::array<float,2>{0.974466145f, 0.477353334f},
-std::array<float,2>{0.595298648f, 0.692515552f},
-std::array<float,2>{0.473467231f, 0.12099541f},
-std::array<float,2>{0.278437853f, 0.915355325f},
-std::array<float,2>{0.668961644f, 0.295696259f},
-std::array<float,2>{0.810438991f, 0.548777521f},
-std::array<float,2>{0.0312476866f, 0.240318999f},
-std::array<float,2>{0.155402556f, 0.643785179f},
-std::array<float,2>{0.917705178f, 0.00243294891f},
-std::array<float,2>{0.53555423f, 0.771146119f},
-std::array<float,2>{0.437147856f, 0.419024825f},
-std::array<float,2>{0.478742033f, 0.610959768f},
-std::array<float,2>{0.606568635f, 0.151453987f},
-std::array<float,2>{0.983571529f, 0.941486597f},
-std::array<float,2>{0.194085583f, 0.366416961f},
-std::array<float,2>{0.0960370004f, 0.851334214f},
-std::array<float,2>{0.813709199f, 0.461933166f},
-std::array<float,2>{0.690066516f, 0.747702599f},
-std::array<float,2>{0.36565119f, 0.0837813988f},
-std::array<float,2>{0.402178019f, 0.783013344f},
-std::array<float,2>{0.525647759f, 0.402472496f},
-std::array<float,2>{0.901959777f, 0.674821913f},
-std::array<float,2>{0.185694873f, 0.0495841093f},
-std::array<float,2>{0.048019439f, 0.520182014f},
-std::array<float,2>{0.774772406f, 0.207647756f},
-std::array<float,2>{0.635077178f, 0.898669243f},
-std::array<float,2>{0.295508623f, 0.264961392f},
-std::array<float,2>{0.332238317f, 0.6953879f},
-std::array<float,2>{0.726389885f, 0.114745207f},
-std::array<float,2>{0.864242136f, 0.842480719f},
-std::array<float,2>{0.0886556283f, 0.474233925f},
-std::array<float,2>{0.227448419f, 0.975919664f},
-std::array<float,2>{0.952264547f, 0.337933868f},
-std::array<float,2>{0.587756634f, 0.573918581f},
-std::array<float,2>{0.457757324f, 0.172260493f},
-std::array<float,2>{0.354508787f, 0.821761847f},
-std::array<float,2>{0.711277843f, 0.499567509f},
-std::array<float,2>{0.841341555f, 0.705330193f},
-std::array<float,2>{0.109759726f, 0.0979755223f},
-std::array<float,2>{0.206875801f, 0.578802109f},
-std::array<float,2>{0.993460774f, 0.15959321f},
-std::array<float,2>{0.615590751f, 0.98507911f},
-std::array<float,2>{0.488053709f, 0.312847495f},
-std::array<float,2>{0.409726918f, 0.665816784f},
-std::array<float,2>{0.553008318f, 0.0433121659f},
-std::array<float,2>{0.928622067f, 0.798772871f},
-std::array<float,2>{0.135756209f, 0.381134361f},
-std::array<float,2>{0.00260383729f, 0.878311872f},
-std::array<float,2>{0.790143967f, 0.280221462f},
-std::array<float,2>{0.678085208f, 0.511824548f},
-std::array<float,2>{0.256569028f, 0.19100225f},
-std::array<float,2>{0.45001176f, 0.968408585f},
-std::array<float,2>{0.575420141f, 0.350649893f},
-std::array<float,2>{0.962717772f, 0.601984382f},
-std::array<float,2>{0.243964925f, 0.127252027f},
-std::array<float,2>{0.0632606521f, 0.728260934f},
-std::array<float,2>{0.854014277f, 0.0713475943f},
-std::array<float,2>{0.741009474f, 0.870425999f},
-std::array<float,2>{0.318489105f, 0.445772022f},
-std::array<float,2>{0.302088082f, 0.542612791f},
-std::array<float,2>{0.655503631f, 0.222463831f},
-std::array<float,2>{0.763321161f, 0.936801076f},
-std::array<float,2>{0.0376552418f, 0.299524486f},
-std::array<float,2>{0.16513446f, 0.759898067f},
-std::array<float,2>{0.88155812f, 0.432859957f},
-std::array<float,2>{0.514207721f, 0.634321094f},
-std::array<float,2>{0.384975731f, 0.0159413256f},
-std::array<float,2>{0.331266075f, 0.924485147f},
-std::array<float,2>{0.718954563f, 0.306050986f},
-std::array<float,2>{0.859564781f, 0.538518369f},
-std::array<float,2>{0.0926554799f, 0.233935103f},
-std::array<float,2>{0.233915061f, 0.626946688f},
-std::array<float,2>{0.946513474f, 0.0290604346f},
-std::array<float,2>{0.592742682f, 0.754927516f},
-std::array<float,2>{0.455510229f, 0.429356396f},
-std::array<float,2>{0.404711276f, 0.598279238f},
-std::array<float,2>{0.529570818f, 0.139056846f},
-std::array<float,2>{0.904509306f, 0.957622647f},
-std::array<float,2>{0.181434274f, 0.358192682f},
-std::array<float,2>{0.0508049056f, 0.861795306f},
-std::array<float,2>{0.777774334f, 0.443500161f},
-std::array<float,2>{0.639064252f, 0.724059343f},
-std::array<float,2>{0.290091693f, 0.0692157522f},
-std::array<float,2>{0.483837038f, 0.805583f},
-std::array<float,2>{0.605056584f, 0.386162549f},
-std::array<float,2>{0.980024934f, 0.658020318f},
-std::array<float,2>{0.188052058f, 0.0362663008f},
-std::array<float,2>{0.101504497f, 0.504508495f},
-std::array<float,2>{0.818133533f, 0.197302163f},
-std::array<float,2>{0.693680286f, 0.888194859f},
-std::array<float,2>{0.362101883f, 0.269596934f},
-std::array<float,2>{0.275353312f, 0.710953951f},
-std::array<float,2>{0.664097071f, 0.105187617f},
-std::array<float,2>{0.806699574f, 0.816309392f},
-std::array<float,2>{0.0238178838f, 0.488260686f},
-std::array<float,2>{0.148971081f, 0.995888948f},
-std::array<float,2>{0.921195686f, 0.325268537f},
-std::array<float,2>{0.533881307f, 0.590757191f},
-std::array<float,2>{0.429943144f, 0.171499401f},
-std::array<float,2>{0.298383653f, 0.831048667f},
-std::array<float,2>{0.650996506f, 0.481675357f},
-std::array<float,2>{0.759433329f, 0.688129902f},
-std::array<float,2>{0.0323413014f, 0.124119893f},
-std::array<float,2>{0.171195686f, 0.565347016f},
-std::array<float,2>{0.878731191f, 0.183281988f},
-std::array<float,2>{0.508285642f, 0.977994978f},
-std::array<float,2>{0.389253199f, 0.328889281f},
-std::array<float,2>{0.448867559f, 0.687023401f},
-std::array<float,2>{0.573126912f, 0.0612533838f},
-std::array<float,2>{0.966118395f, 0.790542185f},
-std::array<float,2>{0.249977425f, 0.391771346f},
-std::array<float,2>{0.0692418665f, 0.895900309f},
-std::array<float,2>{0.857791901f, 0.253754437f},
-std::array<float,2>{0.737825632f, 0.523857832f},
-std::array<float,2>{0.314098954f, 0.218617097f},
-std::array<float,2>{0.410907418f, 0.948005259f},
-std::array<float,2>{0.549183667f, 0.372008473f},
-std::array<float,2>{0.922529936f, 0.620482087f},
-std::array<float,2>{0.140568286f, 0.142806545f},
-std::array<float,2>{0.00771380728f, 0.741322935f},
-std::array<float,2>{0.793592751f, 0.0886057913f},
-std::array<float,2>{0.672510862f, 0.854477704f},
-std::array<float,2>{0.251996577f, 0.459233195f},
-std::array<float,2>{0.355796576f, 0.560800314f},
-std::array<float,2>{0.716775835f, 0.244154915f},
-std::array<float,2>{0.839562833f, 0.907931328f},
-std::array<float,2>{0.115182221f, 0.282927364f},
-std::array<float,2>{0.208323628f, 0.778243482f},
-std::array<float,2>{0.999744534f, 0.408789158f},
-std::array<float,2>{0.612175524f, 0.652710378f},
-std::array<float,2>{0.490669399f, 0.0106255012f},
-std::array<float,2>{0.26540637f, 0.970501959f},
-std::array<float,2>{0.68574667f, 0.341679871f},
-std::array<float,2>{0.787003219f, 0.576936483f},
-std::array<float,2>{0.0103944642f, 0.178988621f},
-std::array<float,2>{0.132741824f, 0.702865005f},
-std::array<float,2>{0.932624817f, 0.112730816f},
-std::array<float,2>{0.558973312f, 0.836258888f},
-std::array<float,2>{0.421373248f, 0.472564071f},
-std::array<float,2>{0.496211767f, 0.518416286f},
-std::array<float,2>{0.623000562f, 0.205309942f},
-std::array<float,2>{0.987340868f, 0.905341387f},
-std::array<float,2>{0.212613598f, 0.261355013f},
-std::array<float,2>{0.124305248f, 0.785444438f},
-std::array<float,2>{0.83144784f, 0.402026564f},
-std::array<float,2>{0.71008569f, 0.678034663f},
-std::array<float,2>{0.346206993f, 0.0519603379f},
-std::array<float,2>{0.375358701f, 0.846876442f},
-std::array<float,2>{0.500807464f, 0.46703279f},
-std::array<float,2>{0.885861993f, 0.744595706f},
-std::array<float,2>{0.159814268f, 0.0794971734f},
-std::array<float,2>{0.0428469554f, 0.614306211f},
-std::array<float,2>{0.7518906f, 0.154244557f},
-std::array<float,2>{0.641254723f, 0.937785864f},
-std::array<float,2>{0.306642532f, 0.36040172f},
-std::array<float,2>{0.321717292f, 0.645304084f},
-std::array<float,2>{0.744018853f, 0.00497688865f},
-std::array<float,2>{0.846663237f, 0.768788397f},
-std::array<float,2>{0.0761303678f, 0.416655749f},
-std::array<float,2>{0.23734805f, 0.920814157f},
-std::array<float,2>{0.953821361f, 0.28998366f},
-std::array<float,2>{0.565067649f, 0.553602397f},
-std::array<float,2>{0.43820703f, 0.2361186f},
-std::array<float,2>{0.370421439f, 0.764850438f},
-std::array<float,2>{0.702554107f, 0.436221212f},
-std::array<float,2>{0.822121561f, 0.639276087f},
-std::array<float,2>{0.108273573f, 0.0223714206f},
-std::array<float,2>{0.201763183f, 0.544293761f},
-std::array<float,2>{0.97247839f, 0.224190637f},
-std::array<float,2>{0.599335611f, 0.933418274f},
-std::array<float,2>{0.472045869f, 0.303782642f},
-std::array<float,2>{0.424119502f, 0.73143971f},
-std::array<float,2>{0.54094708f, 0.0775361881f},
-std::array<float,2>{0.913651168f, 0.872981668f},
-std::array<float,2>{0.143930182f, 0.451241702f},
-std::array<float,2>{0.0206049588f, 0.963648498f},
-std::array<float,2>{0.798110008f, 0.347160667f},
-std::array<float,2>{0.662896454f, 0.605487108f},
-std::array<float,2>{0.273260087f, 0.13094075f},
-std::array<float,2>{0.464366674f, 0.882658958f},
-std::array<float,2>{0.581914186f, 0.27489844f},
-std::array<float,2>{0.944106877f, 0.51021415f},
-std::array<float,2>{0.224710092f, 0.194708258f},
-std::array<float,2>{0.0838635191f, 0.670519531f},
-std::array<float,2>{0.870697021f, 0.0392529555f},
-std::array<float,2>{0.732118964f, 0.800943494f},
-std::array<float,2>{0.341284811f, 0.375744075f},
-std::array<float,2>{0.28832683f, 0.582307637f},
-std::array<float,2>{0.628655195f, 0.163076103f},
-std::array<float,2>{0.770252883f, 0.989102304f},
-std::array<float,2>{0.0601595603f, 0.316830248f},
-std::array<float,2>{0.173717484f, 0.825479746f},
-std::array<float,2>{0.895062745f, 0.495607913f},
-std::array<float,2>{0.520578504f, 0.710755229f},
-std::array<float,2>{0.394881874f, 0.096920453f},
-std::array<float,2>{0.350902736f, 0.954343796f},
-std::array<float,2>{0.703482389f, 0.353249818f},
-std::array<float,2>{0.835119367f, 0.594097733f},
-std::array<float,2>{0.119552918f, 0.134305328f},
-std::array<float,2>{0.215159848f, 0.720025718f},
-std::array<float,2>{0.990764856f, 0.0631363839f},
-std::array<float,2>{0.618333876f, 0.863532662f},
-std::array<float,2>{0.495207131f, 0.439077318f},
-std::array<float,2>{0.414327145f, 0.534933567f},
-std::array<float,2>{0.556974113f, 0.229826018f},
-std::array<float,2>{0.936918557f, 0.926097393f},
-std::array<float,2>{0.12552534f, 0.31146273f},
-std::array<float,2>{0.0132281175f, 0.75157088f},
-std::array<float,2>{0.782741427f, 0.42453298f},
-std::array<float,2>{0.680755973f, 0.631130695f},
-std::array<float,2>{0.260634392f, 0.0259280987f},
-std::array<float,2>{0.44389233f, 0.817180812f},
-std::array<float,2>{0.567607403f, 0.491032362f},
-std::array<float,2>{0.960037112f, 0.717729509f},
-std::array<float,2>{0.241348341f, 0.105639502f},
-std::array<float,2>{0.0734368563f, 0.588088214f},
-std::array<float,2>{0.85067898f, 0.166008458f},
-std::array<float,2>{0.746255219f, 0.998057783f},
-std::array<float,2>{0.326781124f, 0.322587669f},
-std::array<float,2>{0.311033726f, 0.663842618f},
-std::array<float,2>{0.645191848f, 0.0314851962f},
-std::array<float,2>{0.754220486f, 0.810165405f},
-std::array<float,2>{0.0431248583f, 0.387626529f},
-std::array<float,2>{0.163598642f, 0.883319795f},
-std::array<float,2>{0.889221668f, 0.26788643f},
-std::array<float,2>{0.507149041f, 0.501952767f},
-std::array<float,2>{0.382705122f, 0.200679243f},
-std::array<float,2>{0.268615186f, 0.796460986f},
-std::array<float,2>{0.657672644f, 0.397014111f},
-std::array<float,2>{0.801506281f, 0.683384836f},
-std::array<float,2>{0.0168633219f, 0.0571336225f},
-std::array<float,2>{0.146036282f, 0.529680014f},
-std::array<float,2>{0.907495797f, 0.210996002f},
-std::array<float,2>{0.543762863f, 0.8940956f},
-std::array<float,2>{0.42959258f, 0.25495261f},
-std::array<float,2>{0.475633323f, 0.695236683f},
-std::array<float,2>{0.596170068f, 0.117599651f},
-std::array<float,2>{0.975380659f, 0.834711373f},
-std::array<float,2>{0.195629492f, 0.47888115f},
-std::array<float,2>{0.104857937f, 0.982536495f},
-std::array<float,2>{0.824226201f, 0.332268387f},
-std::array<float,2>{0.69574368f, 0.569120288f},
-std::array<float,2>{0.373005182f, 0.183631212f},
-std::array<float,2>{0.392161459f, 0.910761774f},
-std::array<float,2>{0.518122852f, 0.28714326f},
-std::array<float,2>{0.89203012f, 0.555930674f},
-std::array<float,2>{0.179314747f, 0.248926714f},
-std::array<float,2>{0.0547709204f, 0.649008155f},
-std::array<float,2>{0.769138932f, 0.0120480033f},
-std::array<float,2>{0.632250965f, 0.775724828f},
-std::array<float,2>{0.281973749f, 0.410553277f},
-std::array<float,2>{0.338525206f, 0.621130705f},
-std::array<float,2>{0.728090107f, 0.145906284f},
-std::array<float,2>{0.874568701f, 0.94962436f},
-std::array<float,2>{0.0799348801f, 0.36789602f},
-std::array<float,2>{0.218973964f, 0.858366847f},
-std::array<float,2>{0.940649927f, 0.456119418f},
-std::array<float,2>{0.585057318f, 0.736739933f},
-std::array<float,2>{0.465136975f, 0.0910157412f},
-std::array<float,2>{0.293575585f, 0.901640832f},
-std::array<float,2>{0.634381294f, 0.263073146f},
-std::array<float,2>{0.777210951f, 0.523188651f},
-std::array<float,2>{0.0490351319f, 0.20968917f},
-std::array<float,2>{0.185530454f, 0.673664808f},
-std::array<float,2>{0.899053872f, 0.0480340198f},
-std::array<float,2>{0.524274468f, 0.783984244f},
-std::array<float,2>{0.399372637f, 0.404419929f},
-std::array<float,2>{0.459521085f, 0.571659207f},
-std::array<float,2>{0.588957369f, 0.174706891f},
-std::array<float,2>{0.950481951f, 0.973677576f},
-std::array<float,2>{0.229930773f, 0.336364269f},
-std::array<float,2>{0.0875076279f, 0.841719031f},
-std::array<float,2>{0.8661201f, 0.474760592f},
-std::array<float,2>{0.723103881f, 0.697307765f},
-std::array<float,2>{0.334225327f, 0.115290992f},
-std::array<float,2>{0.433677793f, 0.772650898f},
-std::array<float,2>{0.537685096f, 0.419933408f},
-std::array<float,2>{0.915620148f, 0.640683711f},
-std::array<float,2>{0.15400441f, 0.000690068293f},
-std::array<float,2>{0.0276792031f, 0.550575495f},
-std::array<float,2>{0.811715961f, 0.240138128f},
-std::array<float,2>{0.67056632f, 0.916907072f},
-std::array<float,2>{0.280531377f, 0.29428938f},
-std::array<float,2>{0.364354849f, 0.749237537f},
-std::array<float,2>{0.688782632f, 0.085752584f},
-std::array<float,2>{0.814521611f, 0.849000752f},
-std::array<float,2>{0.0944179296f, 0.464142978f},
-std::array<float,2>{0.193139926f, 0.944502831f},
-std::array<float,2>{0.981695592f, 0.365217865f},
-std::array<float,2>{0.60761708f, 0.611701906f},
-std::array<float,2>{0.47823903f, 0.149119139f},
-std::array<float,2>{0.317375809f, 0.868058145f},
-std::array<float,2>{0.739065111f, 0.449112564f},
-std::array<float,2>{0.852603137f, 0.728689492f},
-std::array<float,2>{0.0646425188f, 0.0722818598f},
-std::array<float,2>{0.24477756f, 0.605424523f},
-std::array<float,2>{0.96408093f, 0.126923874f},
-std::array<float,2>{0.576433837f, 0.965382338f},
-std::array<float,2>{0.452740669f, 0.348747611f},
-std::array<float,2>{0.383503795f, 0.636303604f},
-std::array<float,2>{0.511840284f, 0.0194409415f},
-std::array<float,2>{0.880017519f, 0.759628057f},
-std::array<float,2>{0.166207671f, 0.429908365f},
-std::array<float,2>{0.0351910815f, 0.934696853f},
-std::array<float,2>{0.763860047f, 0.298425376f},
-std::array<float,2>{0.654230595f, 0.539435923f},
-std::array<float,2>{0.304490656f, 0.219103098f},
-std::array<float,2>{0.48489216f, 0.986349523f},
-std::array<float,2>{0.613802493f, 0.314565867f},
-std::array<float,2>{0.995804965f, 0.581572473f},
-std::array<float,2>{0.203640938f, 0.157448694f},
-std::array<float,2>{0.113252893f, 0.704661906f},
-std::array<float,2>{0.843276381f, 0.100087389f},
-std::array<float,2>{0.714230359f, 0.823381603f},
-std::array<float,2>{0.353014439f, 0.496326566f},
-std::array<float,2>{0.255647093f, 0.514462173f},
-std::array<float,2>{0.676424384f, 0.188943997f},
-std::array<float,2>{0.792923927f, 0.875093043f},
-std::array<float,2>{0.000743418292f, 0.278407872f},
-std::array<float,2>{0.133918807f, 0.799706519f},
-std::array<float,2>{0.92682904f, 0.380424082f},
-std::array<float,2>{0.551981747f, 0.666069925f},
-std::array<float,2>{0.40775013f, 0.0460211411f},
-std::array<float,2>{0.359150887f, 0.907189667f},
-std::array<float,2>{0.717270732f, 0.281917304f},
-std::array<float,2>{0.837723851f, 0.562011063f},
-std::array<float,2>{0.115981475f, 0.245264724f},
-std::array<float,2>{0.209562302f, 0.653973043f},
-std::array<float,2>{0.997335434f, 0.0111810463f},
-std::array<float,2>{0.61095202f, 0.779011309f},
-std::array<float,2>{0.488537848f, 0.409268528f},
-std::array<float,2>{0.41400522f, 0.61992985f},
-std::array<float,2>{0.548542023f, 0.14412567f},
-std::array<float,2>{0.925507605f, 0.948641837f},
-std::array<float,2>{0.137671083f, 0.372839719f},
-std::array<float,2>{0.00406767009f, 0.855183363f},
-std::array<float,2>{0.796197593f, 0.460116684f},
-std::array<float,2>{0.675771117f, 0.74050343f},
-std::array<float,2>{0.251887858f, 0.0895502344f},
-std::array<float,2>{0.445751846f, 0.789975464f},
-std::array<float,2>{0.570960164f, 0.391122967f},
-std::array<float,2>{0.968062758f, 0.686303079f},
-std::array<float,2>{0.246105149f, 0.06243499f},
-std::array<float,2>{0.0676338673f, 0.524684846f},
-std::array<float,2>{0.856416702f, 0.217708319f},
-std::array<float,2>{0.736087501f, 0.894739985f},
-std::array<float,2>{0.314769268f, 0.252108574f},
-std::array<float,2>{0.300183505f, 0.689059496f},
-std::array<float,2>{0.649496377f, 0.12317156f},
-std::array<float,2>{0.761421144f, 0.831910193f},
-std::array<float,2>{0.034515541f, 0.480849326f},
-std::array<float,2>{0.16903156f, 0.97700423f},
-std::array<float,2>{0.875742495f, 0.329948515f},
-std::array<float,2>{0.510909796f, 0.565566242f},
-std::array<float,2>{0.387313545f, 0.181987718f},
-std::array<float,2>{0.277044177f, 0.815122724f},
-std::array<float,2>{0.666091204f, 0.48669225f},
-std::array<float,2>{0.805399716f, 0.712209642f},
-std::array<float,2>{0.0262679886f, 0.104309872f},
-std::array<float,2>{0.151156545f, 0.591648042f},
-std::array<float,2>{0.918182731f, 0.170459256f},
-std::array<float,2>{0.532371819f, 0.99427551f},
-std::array<float,2>{0.433402628f, 0.324879974f},
-std::array<float,2>{0.482256025f, 0.657202125f},
-std::array<float,2>{0.602115929f, 0.0354863405f},
-std::array<float,2>{0.977334738f, 0.806337953f},
-std::array<float,2>{0.189974785f, 0.384994328f},
-std::array<float,2>{0.0983992293f, 0.887429833f},
-std::array<float,2>{0.819431722f, 0.270595819f},
-std::array<float,2>{0.691862762f, 0.505020857f},
-std::array<float,2>{0.360081315f, 0.19893457f},
-std::array<float,2>{0.402777016f, 0.958819449f},
-std::array<float,2>{0.527503133f, 0.359285682f},
-std::array<float,2>{0.902939677f, 0.598886609f},
-std::array<float,2>{0.183332413f, 0.140610039f},
-std::array<float,2>{0.0537460297f, 0.722816765f},
-std::array<float,2>{0.779931962f, 0.0700415596f},
-std::array<float,2>{0.637542009f, 0.862784147f},
-std::array<float,2>{0.291664213f, 0.444859773f},
-std::array<float,2>{0.329158127f, 0.537556589f},
-std::array<float,2>{0.72083652f, 0.233067378f},
-std::array<float,2>{0.862503648f, 0.924938679f},
-std::array<float,2>{0.0912258178f, 0.305581212f},
-std::array<float,2>{0.231387123f, 0.754679859f},
-std::array<float,2>{0.947718859f, 0.427916259f},
-std::array<float,2>{0.590126574f, 0.625864685f},
-std::array<float,2>{0.453935355f, 0.0283018854f},
-std::array<float,2>{0.28693071f, 0.989418685f},
-std::array<float,2>{0.625227332f, 0.317413956f},
-std::array<float,2>{0.772799313f, 0.583321095f},
-std::array<float,2>{0.0624057017f, 0.163108945f},
-std::array<float,2>{0.175004527f, 0.709724844f},
-std::array<float,2>{0.898279309f, 0.0965950787f},
-std::array<float,2>{0.522520125f, 0.824606717f},
-std::array<float,2>{0.397196144f, 0.494741231f},
-std::array<float,2>{0.462637842f, 0.511089444f},
-std::array<float,2>{0.578465343f, 0.194214046f},
-std::array<float,2>{0.942734063f, 0.881401539f},
-std::array<float,2>{0.223950818f, 0.273515791f},
-std::array<float,2>{0.0846556947f, 0.802551389f},
-std::array<float,2>{0.868591487f, 0.376029849f},
-std::array<float,2>{0.732463419f, 0.671159983f},
-std::array<float,2>{0.343691051f, 0.0407296158f},
-std::array<float,2>{0.422881246f, 0.87202996f},
-std::array<float,2>{0.541599393f, 0.452503383f},
-std::array<float,2>{0.910795331f, 0.732308269f},
-std::array<float,2>{0.142570153f, 0.0769005418f},
-std::array<float,2>{0.0231522154f, 0.607247829f},
-std::array<float,2>{0.800109982f, 0.131927267f},
-std::array<float,2>{0.660531282f, 0.964242578f},
-std::array<float,2>{0.270619512f, 0.346566439f},
-std::array<float,2>{0.368564039f, 0.640305281f},
-std::array<float,2>{0.700270116f, 0.0225659143f},
-std::array<float,2>{0.822404683f, 0.763907611f},
-std::array<float,2>{0.106131881f, 0.437380642f},
-std::array<float,2>{0.200890332f, 0.932216287f},
-std::array<float,2>{0.968787491f, 0.303409338f},
-std::array<float,2>{0.59970355f, 0.543794096f},
-std::array<float,2>{0.469764531f, 0.222814545f},
-std::array<float,2>{0.322966248f, 0.767989218f},
-std::array<float,2>{0.745530307f, 0.417677611f},
-std::array<float,2>{0.844483554f, 0.646299899f},
-std::array<float,2>{0.0778655782f, 0.00454134215f},
-std::array<float,2>{0.235825032f, 0.553996921f},
-std::array<float,2>{0.955127954f, 0.235025868f},
-std::array<float,2>{0.562799811f, 0.920906186f},
-std::array<float,2>{0.439491838f, 0.290059179f},
-std::array<float,2>{0.37834239f, 0.745321155f},
-std::array<float,2>{0.503781199f, 0.0783373192f},
-std::array<float,2>{0.882826805f, 0.846294284f},
-std::array<float,2>{0.156408489f, 0.468266308f},
-std::array<float,2>{0.0404451825f, 0.939026713f},
-std::array<float,2>{0.753655732f, 0.359870285f},
-std::array<float,2>{0.643780112f, 0.613685966f},
-std::array<float,2>{0.30592528f, 0.152676135f},
-std::array<float,2>{0.498143226f, 0.905092716f},
-std::array<float,2>{0.623343885f, 0.260529459f},
-std::array<float,2>{0.984543681f, 0.518675745f},
-std::array<float,2>{0.213085264f, 0.206911728f},
-std::array<float,2>{0.122298449f, 0.67906028f},
-std::array<float,2>{0.828623533f, 0.0509965308f},
-std::array<float,2>{0.708500683f, 0.787033141f},
-std::array<float,2>{0.345333904f, 0.401344508f},
-std::array<float,2>{0.263193756f, 0.577740908f},
-std::array<float,2>{0.68546623f, 0.178087264f},
-std::array<float,2>{0.788932562f, 0.969215631f},
-std::array<float,2>{0.0085714329f, 0.340002179f},
-std::array<float,2>{0.130733579f, 0.837218761f},
-std::array<float,2>{0.930847049f, 0.471436858f},
-std::array<float,2>{0.56153518f, 0.701993465f},
-std::array<float,2>{0.419742614f, 0.112224124f},
-std::array<float,2>{0.336659044f, 0.95077616f},
-std::array<float,2>{0.730104506f, 0.368646324f},
-std::array<float,2>{0.872810125f, 0.622584105f},
-std::array<float,2>{0.0810941011f, 0.144755796f},
-std::array<float,2>{0.222449124f, 0.738108814f},
-std::array<float,2>{0.938716114f, 0.0907143503f},
-std::array<float,2>{0.582522988f, 0.858511209f},
-std::array<float,2>{0.468033671f, 0.455278516f},
-std::array<float,2>{0.393720537f, 0.555089891f},
-std::array<float,2>{0.517303646f, 0.249444798f},
-std::array<float,2>{0.894249856f, 0.911531806f},
-std::array<float,2>{0.176981255f, 0.288492739f},
-std::array<float,2>{0.0566749386f, 0.777321875f},
-std::array<float,2>{0.766388118f, 0.411389381f},
-std::array<float,2>{0.629829705f, 0.650314629f},
-std::array<float,2>{0.284780383f, 0.0132724904f},
-std::array<float,2>{0.474301904f, 0.835263908f},
-std::array<float,2>{0.594318867f, 0.480113178f},
-std::array<float,2>{0.973547697f, 0.693872452f},
-std::array<float,2>{0.197301611f, 0.118231542f},
-std::array<float,2>{0.103448547f, 0.569338024f},
-std::array<float,2>{0.826856136f, 0.185217649f},
-std::array<float,2>{0.698443711f, 0.983516276f},
-std::array<float,2>{0.374324471f, 0.333776534f},
-std::array<float,2>{0.266417742f, 0.681643903f},
-std::array<float,2>{0.659538209f, 0.0584772155f},
-std::array<float,2>{0.804191351f, 0.795862675f},
-std::array<float,2>{0.0189723335f, 0.39774707f},
-std::array<float,2>{0.147536531f, 0.893270016f},
-std::array<float,2>{0.909153581f, 0.254360408f},
-std::array<float,2>{0.545882165f, 0.530278683f},
-std::array<float,2>{0.427406758f, 0.212744266f},
-std::array<float,2>{0.30977723f, 0.809049785f},
-std::array<float,2>{0.647926033f, 0.387825906f},
-std::array<float,2>{0.756752789f, 0.66294837f},
-std::array<float,2>{0.0463179909f, 0.0326917954f},
-std::array<float,2>{0.161472201f, 0.500205219f},
-std::array<float,2>{0.888587475f, 0.199803203f},
-std::array<float,2>{0.5042153f, 0.883890271f},
-std::array<float,2>{0.379245847f, 0.268700242f},
-std::array<float,2>{0.443016976f, 0.718594968f},
-std::array<float,2>{0.569036603f, 0.106852256f},
-std::array<float,2>{0.95764786f, 0.817436278f},
-std::array<float,2>{0.240078986f, 0.491538733f},
-std::array<float,2>{0.0722225383f, 0.999418795f},
-std::array<float,2>{0.848503113f, 0.323731601f},
-std::array<float,2>{0.748225689f, 0.589088321f},
-std::array<float,2>{0.325495511f, 0.164544061f},
-std::array<float,2>{0.416739583f, 0.927081525f},
-std::array<float,2>{0.554993987f, 0.312253445f},
-std::array<float,2>{0.934827387f, 0.533261478f},
-std::array<float,2>{0.127692208f, 0.229272604f},
-std::array<float,2>{0.0143122412f, 0.632541597f},
-std::array<float,2>{0.784731567f, 0.0265353788f},
-std::array<float,2>{0.683336854f, 0.750623941f},
-std::array<float,2>{0.257888168f, 0.425615579f},
-std::array<float,2>{0.348035187f, 0.595017374f},
-std::array<float,2>{0.706729352f, 0.132923394f},
-std::array<float,2>{0.83207804f, 0.953166783f},
-std::array<float,2>{0.118306383f, 0.352477968f},
-std::array<float,2>{0.217677981f, 0.864711702f},
-std::array<float,2>{0.990159571f, 0.437923998f},
-std::array<float,2>{0.619416177f, 0.718773425f},
-std::array<float,2>{0.493440121f, 0.0642303377f},
-std::array<float,2>{0.257334381f, 0.876146019f},
-std::array<float,2>{0.679269254f, 0.277563393f},
-std::array<float,2>{0.789064884f, 0.515058935f},
-std::array<float,2>{0.00342304027f, 0.187564984f},
-std::array<float,2>{0.135726273f, 0.667274654f},
-std::array<float,2>{0.92926532f, 0.045115415f},
-std::array<float,2>{0.553728044f, 0.80046463f},
-std::array<float,2>{0.408753783f, 0.379080266f},
-std::array<float,2>{0.486988842f, 0.580775023f},
-std::array<float,2>{0.616413653f, 0.157128602f},
-std::array<float,2>{0.992880821f, 0.98789537f},
-std::array<float,2>{0.205862418f, 0.315543532f},
-std::array<float,2>{0.110869221f, 0.822896898f},
-std::array<float,2>{0.840035141f, 0.497595102f},
-std::array<float,2>{0.712034941f, 0.703776538f},
-std::array<float,2>{0.35414502f, 0.101236977f},
-std::array<float,2>{0.386081904f, 0.758065701f},
-std::array<float,2>{0.514797568f, 0.430891544f},
-std::array<float,2>{0.882237613f, 0.635407448f},
-std::array<float,2>{0.164977863f, 0.0183472093f},
-std::array<float,2>{0.0383824259f, 0.540075839f},
-std::array<float,2>{0.762041688f, 0.220583186f},
-std::array<float,2>{0.655192971f, 0.934204042f},
-std::array<float,2>{0.301264733f, 0.297687978f},
-std::array<float,2>{0.319840103f, 0.730015755f},
-std::array<float,2>{0.741489649f, 0.0732625052f},
-std::array<float,2>{0.854644537f, 0.868805647f},
-std::array<float,2>{0.0635673627f, 0.448023885f},
-std::array<float,2>{0.242689118f, 0.966411769f},
-std::array<float,2>{0.961474597f, 0.348335326f},
-std::array<float,2>{0.574684978f, 0.603559315f},
-std::array<float,2>{0.450447559f, 0.125247553f},
-std::array<float,2>{0.366921127f, 0.848231614f},
-std::array<float,2>{0.690589309f, 0.463390529f},
-std::array<float,2>{0.812505305f, 0.74833107f},
-std::array<float,2>{0.0974194929f, 0.0843633339f},
-std::array<float,2>{0.194733381f, 0.612880111f},
-std::array<float,2>{0.983093917f, 0.149907246f},
-std::array<float,2>{0.605507493f, 0.943618834f},
-std::array<float,2>{0.48023814f, 0.363377571f},
-std::array<float,2>{0.436183751f, 0.641989887f},
-std::array<float,2>{0.536751151f, 0.00193428469f},
-std::array<float,2>{0.916121662f, 0.772435904f},
-std::array<float,2>{0.154678553f, 0.420933247f},
-std::array<float,2>{0.0296070967f, 0.917868555f},
-std::array<float,2>{0.809559822f, 0.293296844f},
-std::array<float,2>{0.66840589f, 0.549730957f},
-std::array<float,2>{0.277673304f, 0.238444373f},
-std::array<float,2>{0.458196223f, 0.973376453f},
-std::array<float,2>{0.586567521f, 0.337235004f},
-std::array<float,2>{0.951638877f, 0.57063812f},
-std::array<float,2>{0.228449672f, 0.175024331f},
-std::array<float,2>{0.0889551118f, 0.698925734f},
-std::array<float,2>{0.864530504f, 0.11683394f},
-std::array<float,2>{0.725443423f, 0.840752184f},
-std::array<float,2>{0.333869368f, 0.476408869f},
-std::array<float,2>{0.295980543f, 0.522192597f},
-std::array<float,2>{0.636367381f, 0.210876971f},
-std::array<float,2>{0.774200678f, 0.90116328f},
-std::array<float,2>{0.0471326597f, 0.262016028f},
-std::array<float,2>{0.187472001f, 0.784230232f},
-std::array<float,2>{0.900992811f, 0.405718505f},
-std::array<float,2>{0.526492f, 0.671875238f},
-std::array<float,2>{0.400663584f, 0.047108613f},
-std::array<float,2>{0.312565595f, 0.898040295f},
-std::array<float,2>{0.736660957f, 0.250507593f},
-std::array<float,2>{0.859090328f, 0.526928842f},
-std::array<float,2>{0.0702161491f, 0.215920329f},
-std::array<float,2>{0.248323604f, 0.683867931f},
-std::array<float,2>{0.96547699f, 0.0587590598f},
-std::array<float,2>{0.573608041f, 0.792605877f},
-std::array<float,2>{0.447674841f, 0.393817693f},
-std::array<float,2>{0.39018175f, 0.564054906f},
-std::array<float,2>{0.509401083f, 0.18100898f},
-std::array<float,2>{0.877471864f, 0.980371833f},
-std::array<float,2>{0.170408249f, 0.33192578f},
-std::array<float,2>{0.0318033397f, 0.829146445f},
-std::array<float,2>{0.758316934f, 0.483499318f},
-std::array<float,2>{0.651498497f, 0.689938962f},
-std::array<float,2>{0.297008842f, 0.121887319f},
-std::array<float,2>{0.491423875f, 0.779832363f},
-std::array<float,2>{0.612493455f, 0.407607913f},
-std::array<float,2>{0.998427153f, 0.655109644f},
-std::array<float,2>{0.207400277f, 0.00857007597f},
-std::array<float,2>{0.113742404f, 0.558873713f},
-std::array<float,2>{0.838444412f, 0.243130997f},
-std::array<float,2>{0.715563595f, 0.909879625f},
-std::array<float,2>{0.357058376f, 0.284649819f},
-std::array<float,2>{0.253197789f, 0.738690734f},
-std::array<float,2>{0.673420548f, 0.0865576938f},
-std::array<float,2>{0.794109404f, 0.852045f},
-std::array<float,2>{0.00599610247f, 0.458579272f},
-std::array<float,2>{0.13867867f, 0.945386052f},
-std::array<float,2>{0.923321366f, 0.373065144f},
-std::array<float,2>{0.550188899f, 0.617190719f},
-std::array<float,2>{0.412045568f, 0.141314924f},
-std::array<float,2>{0.289105892f, 0.860511184f},
-std::array<float,2>{0.640152156f, 0.441759437f},
-std::array<float,2>{0.779037774f, 0.726454258f},
-std::array<float,2>{0.0524144359f, 0.0668019727f},
-std::array<float,2>{0.180328354f, 0.600803256f},
-std::array<float,2>{0.905415654f, 0.138452142f},
-std::array<float,2>{0.530277491f, 0.959951222f},
-std::array<float,2>{0.405301958f, 0.356670707f},
-std::array<float,2>{0.456153393f, 0.627478421f},
-std::array<float,2>{0.593344033f, 0.030554954f},
-std::array<float,2>{0.945440829f, 0.756056011f},
-std::array<float,2>{0.233323455f, 0.426321477f},
-std::array<float,2>{0.0930340812f, 0.92224443f},
-std::array<float,2>{0.860417604f, 0.30770421f},
-std::array<float,2>{0.719917595f, 0.535569549f},
-std::array<float,2>{0.330779642f, 0.230715498f},
-std::array<float,2>{0.430835098f, 0.992459893f},
-std::array<float,2>{0.534937382f, 0.32802248f},
-std::array<float,2>{0.92067039f, 0.59364903f},
-std::array<float,2>{0.149556577f, 0.168132499f},
-std::array<float,2>{0.025153609f, 0.713271081f},
-std::array<float,2>{0.808449566f, 0.101910733f},
-std::array<float,2>{0.665820658f, 0.814411998f},
-std::array<float,2>{0.274029642f, 0.48586455f},
-std::array<float,2>{0.363087356f, 0.506927729f},
-std::array<float,2>{0.69434756f, 0.195398122f},
-std::array<float,2>{0.816758633f, 0.890340149f},
-std::array<float,2>{0.0996472985f, 0.272250026f},
-std::array<float,2>{0.189381912f, 0.806950152f},
-std::array<float,2>{0.979155362f, 0.383777678f},
-std::array<float,2>{0.604396582f, 0.659690917f},
-std::array<float,2>{0.483304769f, 0.0374037959f},
-std::array<float,2>{0.272162646f, 0.962669253f},
-std::array<float,2>{0.663751602f, 0.345265329f},
-std::array<float,2>{0.796892941f, 0.607564867f},
-std::array<float,2>{0.0196738727f, 0.129731908f},
-std::array<float,2>{0.143467814f, 0.734153092f},
-std::array<float,2>{0.91258347f, 0.0744952783f},
-std::array<float,2>{0.539687753f, 0.874920607f},
-std::array<float,2>{0.425201535f, 0.449964106f},
-std::array<float,2>{0.471097171f, 0.545466721f},
-std::array<float,2>{0.597983897f, 0.225789934f},
-std::array<float,2>{0.971355498f, 0.931271136f},
-std::array<float,2>{0.202360556f, 0.300834119f},
-std::array<float,2>{0.109099142f, 0.763474047f},
-std::array<float,2>{0.820545614f, 0.434664667f},
-std::array<float,2>{0.701548576f, 0.636844099f},
-std::array<float,2>{0.370094061f, 0.0196625534f},
-std::array<float,2>{0.395552248f, 0.826961577f},
-std::array<float,2>{0.520375013f, 0.492570877f},
-std::array<float,2>{0.895602167f, 0.708158433f},
-std::array<float,2>{0.172588795f, 0.0944890678f},
-std::array<float,2>{0.0586314648f, 0.584970832f},
-std::array<float,2>{0.771035433f, 0.161652252f},
-std::array<float,2>{0.627525866f, 0.99167484f},
-std::array<float,2>{0.287801385f, 0.319571286f},
-std::array<float,2>{0.340327889f, 0.668867171f},
-std::array<float,2>{0.730984986f, 0.0411716513f},
-std::array<float,2>{0.869198263f, 0.803896904f},
-std::array<float,2>{0.0825667307f, 0.377355874f},
-std::array<float,2>{0.22641103f, 0.879476547f},
-std::array<float,2>{0.945141017f, 0.276332051f},
-std::array<float,2>{0.580558717f, 0.509605348f},
-std::array<float,2>{0.463484913f, 0.192704394f},
-std::array<float,2>{0.346911073f, 0.788444757f},
-std::array<float,2>{0.70969969f, 0.40027675f},
-std::array<float,2>{0.830807388f, 0.676401258f},
-std::array<float,2>{0.123499632f, 0.053188961f},
-std::array<float,2>{0.211021617f, 0.51721102f},
-std::array<float,2>{0.987131536f, 0.203482479f},
-std::array<float,2>{0.621524513f, 0.902840793f},
-std::array<float,2>{0.497950017f, 0.257830024f},
-std::array<float,2>{0.420494497f, 0.700833976f},
-std::array<float,2>{0.55997169f, 0.110274144f},
-std::array<float,2>{0.932010949f, 0.838717163f},
-std::array<float,2>{0.131184459f, 0.469212353f},
-std::array<float,2>{0.0110901389f, 0.971657455f},
-std::array<float,2>{0.785722911f, 0.341890305f},
-std::array<float,2>{0.686789513f, 0.575014591f},
-std::array<float,2>{0.26422435f, 0.176018178f},
-std::array<float,2>{0.438757151f, 0.918905675f},
-std::array<float,2>{0.56567198f, 0.291633278f},
-std::array<float,2>{0.954106271f, 0.551313102f},
-std::array<float,2>{0.236411899f, 0.236822218f},
-std::array<float,2>{0.074601911f, 0.647477269f},
-std::array<float,2>{0.847061753f, 0.00770869013f},
-std::array<float,2>{0.742204249f, 0.767032444f},
-std::array<float,2>{0.320971251f, 0.415264457f},
-std::array<float,2>{0.308246881f, 0.615393162f},
-std::array<float,2>{0.642423093f, 0.154491812f},
-std::array<float,2>{0.750037491f, 0.940126359f},
-std::array<float,2>{0.041504357f, 0.362070173f},
-std::array<float,2>{0.158947915f, 0.843761802f},
-std::array<float,2>{0.884800553f, 0.466687351f},
-std::array<float,2>{0.501191318f, 0.742374837f},
-std::array<float,2>{0.376170456f, 0.0810309798f},
-std::array<float,2>{0.371221989f, 0.981894493f},
-std::array<float,2>{0.696965277f, 0.334551632f},
-std::array<float,2>{0.825956166f, 0.568245888f},
-std::array<float,2>{0.10366565f, 0.186694935f},
-std::array<float,2>{0.196342394f, 0.691708386f},
-std::array<float,2>{0.976169705f, 0.119416185f},
-std::array<float,2>{0.597050369f, 0.833166182f},
-std::array<float,2>{0.475064784f, 0.478187829f},
-std::array<float,2>{0.427935869f, 0.527675748f},
-std::array<float,2>{0.544371784f, 0.214728788f},
-std::array<float,2>{0.907147884f, 0.890945852f},
-std::array<float,2>{0.145195737f, 0.25717032f},
-std::array<float,2>{0.0160464793f, 0.793107212f},
-std::array<float,2>{0.80196321f, 0.394585818f},
-std::array<float,2>{0.656273365f, 0.680630982f},
-std::array<float,2>{0.268276781f, 0.0562292114f},
-std::array<float,2>{0.465966433f, 0.855981648f},
-std::array<float,2>{0.584835768f, 0.453264058f},
-std::array<float,2>{0.939762473f, 0.735806823f},
-std::array<float,2>{0.219769299f, 0.0926482752f},
-std::array<float,2>{0.0782868192f, 0.62422049f},
-std::array<float,2>{0.873142719f, 0.148206308f},
-std::array<float,2>{0.727053881f, 0.951686323f},
-std::array<float,2>{0.338902175f, 0.370004296f},
-std::array<float,2>{0.28307569f, 0.650517702f},
-std::array<float,2>{0.631124437f, 0.0140179573f},
-std::array<float,2>{0.768016338f, 0.774880409f},
-std::array<float,2>{0.0561951511f, 0.41326952f},
-std::array<float,2>{0.178664997f, 0.912260115f},
-std::array<float,2>{0.891549647f, 0.285450578f},
-std::array<float,2>{0.519354224f, 0.558200896f},
-std::array<float,2>{0.390651673f, 0.246309504f},
-std::array<float,2>{0.261289805f, 0.752642691f},
-std::array<float,2>{0.680431724f, 0.422799885f},
-std::array<float,2>{0.781469822f, 0.629686117f},
-std::array<float,2>{0.0124457479f, 0.0239071548f},
-std::array<float,2>{0.126572773f, 0.531336963f},
-std::array<float,2>{0.935805857f, 0.228222772f},
-std::array<float,2>{0.558238924f, 0.928226709f},
-std::array<float,2>{0.415361315f, 0.308737874f},
-std::array<float,2>{0.494474173f, 0.721299112f},
-std::array<float,2>{0.617756069f, 0.0653444007f},
-std::array<float,2>{0.991476536f, 0.866306841f},
-std::array<float,2>{0.216396227f, 0.439553201f},
-std::array<float,2>{0.121012598f, 0.956453323f},
-std::array<float,2>{0.834751129f, 0.355175227f},
-std::array<float,2>{0.704436004f, 0.596956313f},
-std::array<float,2>{0.350403965f, 0.135460004f},
-std::array<float,2>{0.381131023f, 0.885829985f},
-std::array<float,2>{0.50650841f, 0.266838551f},
-std::array<float,2>{0.88967824f, 0.503468752f},
-std::array<float,2>{0.162271351f, 0.201800331f},
-std::array<float,2>{0.0443077423f, 0.66085422f},
-std::array<float,2>{0.755792439f, 0.0337346792f},
-std::array<float,2>{0.645923436f, 0.812297523f},
-std::array<float,2>{0.311630487f, 0.389685124f},
-std::array<float,2>{0.327375263f, 0.586721003f},
-std::array<float,2>{0.747257471f, 0.167232737f},
-std::array<float,2>{0.850094259f, 0.996100187f},
-std::array<float,2>{0.0723288357f, 0.321786791f},
-std::array<float,2>{0.240773171f, 0.819492102f},
-std::array<float,2>{0.959608078f, 0.489095986f},
-std::array<float,2>{0.567169607f, 0.715425014f},
-std::array<float,2>{0.444721699f, 0.109095119f},
-std::array<float,2>{0.302782565f, 0.936065912f},
-std::array<float,2>{0.652539432f, 0.300414473f},
-std::array<float,2>{0.765508175f, 0.541021347f},
-std::array<float,2>{0.0367006771f, 0.22084336f},
-std::array<float,2>{0.167828709f, 0.633490384f},
-std::array<float,2>{0.879558682f, 0.0166112464f},
-std::array<float,2>{0.512727261f, 0.761211216f},
-std::array<float,2>{0.384477407f, 0.431652546f},
-std::array<float,2>{0.451291263f, 0.602762401f},
-std::array<float,2>{0.577364087f, 0.128904849f},
-std::array<float,2>{0.963254869f, 0.967586637f},
-std::array<float,2>{0.245930061f, 0.349876732f},
-std::array<float,2>{0.0657272041f, 0.869932353f},
-std::array<float,2>{0.852316201f, 0.447253525f},
-std::array<float,2>{0.740045249f, 0.726632893f},
-std::array<float,2>{0.317596704f, 0.0705739483f},
-std::array<float,2>{0.406917274f, 0.796887398f},
-std::array<float,2>{0.551134527f, 0.382591963f},
-std::array<float,2>{0.926590681f, 0.664283335f},
-std::array<float,2>{0.132951856f, 0.0447349958f},
-std::array<float,2>{0.00153544534f, 0.513329804f},
-std::array<float,2>{0.791381121f, 0.189707115f},
-std::array<float,2>{0.677192926f, 0.877008915f},
-std::array<float,2>{0.254079849f, 0.281174779f},
-std::array<float,2>{0.351703674f, 0.706878603f},
-std::array<float,2>{0.713513136f, 0.0992048234f},
-std::array<float,2>{0.842032552f, 0.82090354f},
-std::array<float,2>{0.112067714f, 0.498969495f},
-std::array<float,2>{0.2045753f, 0.98624289f},
-std::array<float,2>{0.994828999f, 0.313546211f},
-std::array<float,2>{0.615189314f, 0.579387367f},
-std::array<float,2>{0.486114055f, 0.159011349f},
-std::array<float,2>{0.33592689f, 0.842994213f},
-std::array<float,2>{0.72404325f, 0.473583162f},
-std::array<float,2>{0.866864085f, 0.696816683f},
-std::array<float,2>{0.0865712389f, 0.113642037f},
-std::array<float,2>{0.228607431f, 0.572519124f},
-std::array<float,2>{0.950091541f, 0.173692524f},
-std::array<float,2>{0.587896526f, 0.975064158f},
-std::array<float,2>{0.460546613f, 0.339045048f},
-std::array<float,2>{0.399417073f, 0.674580753f},
-std::array<float,2>{0.524955451f, 0.0501999781f},
-std::array<float,2>{0.899546623f, 0.78193289f},
-std::array<float,2>{0.184088841f, 0.404015452f},
-std::array<float,2>{0.0498250537f, 0.900205433f},
-std::array<float,2>{0.775786579f, 0.264568835f},
-std::array<float,2>{0.633034945f, 0.520927489f},
-std::array<float,2>{0.294201702f, 0.208232343f},
-std::array<float,2>{0.476994812f, 0.942654312f},
-std::array<float,2>{0.608618915f, 0.365752786f},
-std::array<float,2>{0.980624437f, 0.609560847f},
-std::array<float,2>{0.191715911f, 0.150637358f},
-std::array<float,2>{0.0955863968f, 0.746190608f},
-std::array<float,2>{0.815728486f, 0.0824707374f},
-std::array<float,2>{0.687716842f, 0.850512266f},
-std::array<float,2>{0.363828063f, 0.461329848f},
-std::array<float,2>{0.279935032f, 0.5468961f},
-std::array<float,2>{0.671554089f, 0.242170677f},
-std::array<float,2>{0.811010361f, 0.914239645f},
-std::array<float,2>{0.0285295881f, 0.296602726f},
-std::array<float,2>{0.152637839f, 0.770061255f},
-std::array<float,2>{0.914755464f, 0.418188334f},
-std::array<float,2>{0.538724422f, 0.643003225f},
-std::array<float,2>{0.434578151f, 0.0035835437f},
-std::array<float,2>{0.345091879f, 0.902646422f},
-std::array<float,2>{0.708024025f, 0.258467048f},
-std::array<float,2>{0.828303993f, 0.516639173f},
-std::array<float,2>{0.122844227f, 0.20409587f},
-std::array<float,2>{0.213780537f, 0.67583251f},
-std::array<float,2>{0.984916985f, 0.0536427498f},
-std::array<float,2>{0.623704374f, 0.788977802f},
-std::array<float,2>{0.498906314f, 0.399637938f},
-std::array<float,2>{0.419064462f, 0.574329913f},
-std::array<float,2>{0.562048435f, 0.176530465f},
-std::array<float,2>{0.931373894f, 0.970911443f},
-std::array<float,2>{0.130200729f, 0.342716008f},
-std::array<float,2>{0.00787946582f, 0.838124156f},
-std::array<float,2>{0.788233042f, 0.469656438f},
-std::array<float,2>{0.684832454f, 0.700428843f},
-std::array<float,2>{0.2627092f, 0.109766044f},
-std::array<float,2>{0.440078199f, 0.767264545f},
-std::array<float,2>{0.563317716f, 0.415531814f},
-std::array<float,2>{0.955961883f, 0.648075402f},
-std::array<float,2>{0.236320481f, 0.00692165969f},
-std::array<float,2>{0.0772462487f, 0.550805032f},
-std::array<float,2>{0.844136775f, 0.236539498f},
-std::array<float,2>{0.745666862f, 0.91814214f},
-std::array<float,2>{0.322381526f, 0.291121662f},
-std::array<float,2>{0.306343228f, 0.74311626f},
-std::array<float,2>{0.644466937f, 0.080481343f},
-std::array<float,2>{0.753305554f, 0.844343901f},
-std::array<float,2>{0.0408579372f, 0.465841591f},
-std::array<float,2>{0.157006785f, 0.939513862f},
-std::array<float,2>{0.883509696f, 0.361367792f},
-std::array<float,2>{0.50321734f, 0.61597842f},
-std::array<float,2>{0.378530502f, 0.155025497f},
-std::array<float,2>{0.271394789f, 0.874186635f},
-std::array<float,2>{0.661086559f, 0.449582964f},
-std::array<float,2>{0.800490141f, 0.733574867f},
-std::array<float,2>{0.0229253173f, 0.0749616772f},
-std::array<float,2>{0.141680002f, 0.608339846f},
-std::array<float,2>{0.910525024f, 0.129177943f},
-std::array<float,2>{0.541316509f, 0.962320805f},
-std::array<float,2>{0.423469037f, 0.34508574f},
-std::array<float,2>{0.470647335f, 0.637281299f},
-std::array<float,2>{0.600340843f, 0.0204320662f},
-std::array<float,2>{0.969283044f, 0.762871742f},
-std::array<float,2>{0.200336039f, 0.435295671f},
-std::array<float,2>{0.105637848f, 0.930912852f},
-std::array<float,2>{0.822769225f, 0.301721424f},
-std::array<float,2>{0.700704515f, 0.545099974f},
-std::array<float,2>{0.368818939f, 0.226479918f},
-std::array<float,2>{0.396624953f, 0.992147267f},
-std::array<float,2>{0.523247659f, 0.320200861f},
-std::array<float,2>{0.8977108f, 0.585932493f},
-std::array<float,2>{0.175495565f, 0.161594823f},
-std::array<float,2>{0.0615716763f, 0.708966017f},
-std::array<float,2>{0.773414791f, 0.0940847769f},
-std::array<float,2>{0.625698745f, 0.826181471f},
-std::array<float,2>{0.286438942f, 0.49290666f},
-std::array<float,2>{0.342789471f, 0.508793294f},
-std::array<float,2>{0.733373165f, 0.193174407f},
-std::array<float,2>{0.868696153f, 0.879347801f},
-std::array<float,2>{0.084403716f, 0.275466204f},
-std::array<float,2>{0.224421948f, 0.804329574f},
-std::array<float,2>{0.943007946f, 0.377504915f},
-std::array<float,2>{0.578739405f, 0.668411851f},
-std::array<float,2>{0.462109804f, 0.0419326462f},
-std::array<float,2>{0.291453451f, 0.959044039f},
-std::array<float,2>{0.637110353f, 0.357079357f},
-std::array<float,2>{0.779608309f, 0.601234555f},
-std::array<float,2>{0.0543314777f, 0.13812378f},
-std::array<float,2>{0.182636261f, 0.726026714f},
-std::array<float,2>{0.902541995f, 0.0671622604f},
-std::array<float,2>{0.527866304f, 0.861107767f},
-std::array<float,2>{0.402999043f, 0.442044944f},
-std::array<float,2>{0.453515559f, 0.536028206f},
-std::array<float,2>{0.590712726f, 0.231322929f},
-std::array<float,2>{0.947994769f, 0.922670841f},
-std::array<float,2>{0.230519891f, 0.308377236f},
-std::array<float,2>{0.0917682797f, 0.75649941f},
-std::array<float,2>{0.862824142f, 0.425912529f},
-std::array<float,2>{0.721331239f, 0.627086639f},
-std::array<float,2>{0.32982567f, 0.0309651308f},
-std::array<float,2>{0.432963461f, 0.81381613f},
-std::array<float,2>{0.532966137f, 0.485640317f},
-std::array<float,2>{0.918596864f, 0.713744819f},
-std::array<float,2>{0.150784582f, 0.102351487f},
-std::array<float,2>{0.0256954692f, 0.592955172f},
-std::array<float,2>{0.804802358f, 0.16881974f},
-std::array<float,2>{0.666758418f, 0.992941499f},
-std::array<float,2>{0.276569039f, 0.327220827f},
-std::array<float,2>{0.359854549f, 0.659375608f},
-std::array<float,2>{0.692087054f, 0.037627086f},
-std::array<float,2>{0.82005012f, 0.807200909f},
-std::array<float,2>{0.0977972671f, 0.382996261f},
-std::array<float,2>{0.189517483f, 0.889924526f},
-std::array<float,2>{0.976702034f, 0.271751821f},
-std::array<float,2>{0.601935744f, 0.507443249f},
-std::array<float,2>{0.481529832f, 0.195968896f},
-std::array<float,2>{0.315424949f, 0.792257488f},
-std::array<float,2>{0.735513687f, 0.394443929f},
-std::array<float,2>{0.855719924f, 0.684386909f},
-std::array<float,2>{0.0681472048f, 0.0592439212f},
-std::array<float,2>{0.246800914f, 0.526514292f},
-std::array<float,2>{0.968500793f, 0.216450632f},
-std::array<float,2>{0.570316434f, 0.897766769f},
-std::array<float,2>{0.445862651f, 0.250023216f},
-std::array<float,2>{0.387075067f, 0.690159976f},
-std::array<float,2>{0.511505961f, 0.121500917f},
-std::array<float,2>{0.875264525f, 0.829827487f},
-std::array<float,2>{0.169673428f, 0.483942598f},
-std::array<float,2>{0.0349187739f, 0.979697168f},
-std::array<float,2>{0.760820031f, 0.33151269f},
-std::array<float,2>{0.650062203f, 0.563961744f},
-std::array<float,2>{0.300698936f, 0.181581497f},
-std::array<float,2>{0.488804996f, 0.909665048f},
-std::array<float,2>{0.610711753f, 0.284751683f},
-std::array<float,2>{0.997756183f, 0.559152246f},
-std::array<float,2>{0.20931232f, 0.242261395f},
-std::array<float,2>{0.115715489f, 0.654403031f},
-std::array<float,2>{0.836943984f, 0.00811251998f},
-std::array<float,2>{0.717288673f, 0.779533327f},
-std::array<float,2>{0.358778834f, 0.407761753f},
-std::array<float,2>{0.251406491f, 0.617862761f},
-std::array<float,2>{0.675112903f, 0.141086817f},
-std::array<float,2>{0.796474457f, 0.946175575f},
-std::array<float,2>{0.00455416832f, 0.373542845f},
-std::array<float,2>{0.136876047f, 0.852436304f},
-std::array<float,2>{0.925188005f, 0.458241493f},
-std::array<float,2>{0.547905862f, 0.738857448f},
-std::array<float,2>{0.413189411f, 0.0863646641f},
-std::array<float,2>{0.333391547f, 0.975418091f},
-std::array<float,2>{0.725015998f, 0.339414269f},
-std::array<float,2>{0.865002215f, 0.572770834f},
-std::array<float,2>{0.089763172f, 0.17290704f},
-std::array<float,2>{0.227737248f, 0.696592331f},
-std::array<float,2>{0.95203203f, 0.11419519f},
-std::array<float,2>{0.585938334f, 0.843535721f},
-std::array<float,2>{0.458673537f, 0.472990692f},
-std::array<float,2>{0.401264697f, 0.521084547f},
-std::array<float,2>{0.526995122f, 0.208677724f},
-std::array<float,2>{0.900740564f, 0.899590909f},
-std::array<float,2>{0.186708212f, 0.263947278f},
-std::array<float,2>{0.0477365926f, 0.781318665f},
-std::array<float,2>{0.773793161f, 0.40341568f},
-std::array<float,2>{0.635982513f, 0.674309671f},
-std::array<float,2>{0.296438336f, 0.0503561832f},
-std::array<float,2>{0.479549795f, 0.85002172f},
-std::array<float,2>{0.606349409f, 0.46159476f},
-std::array<float,2>{0.982695937f, 0.746600211f},
-std::array<float,2>{0.195013404f, 0.0826889575f},
-std::array<float,2>{0.0970166102f, 0.609882712f},
-std::array<float,2>{0.813363075f, 0.151008382f},
-std::array<float,2>{0.691310644f, 0.942939758f},
-std::array<float,2>{0.366283894f, 0.365561634f},
-std::array<float,2>{0.278199285f, 0.643370807f},
-std::array<float,2>{0.668618917f, 0.00338494149f},
-std::array<float,2>{0.808658063f, 0.769802392f},
-std::array<float,2>{0.0298112426f, 0.418664098f},
-std::array<float,2>{0.154952914f, 0.915038526f},
-std::array<float,2>{0.91676712f, 0.29623878f},
-std::array<float,2>{0.536319315f, 0.547558784f},
-std::array<float,2>{0.436014622f, 0.241593629f},
-std::array<float,2>{0.301378131f, 0.761535943f},
-std::array<float,2>{0.654559255f, 0.432343006f},
-std::array<float,2>{0.762525678f, 0.633208215f},
-std::array<float,2>{0.0386691131f, 0.0171670765f},
-std::array<float,2>{0.164442435f, 0.541825593f},
-std::array<float,2>{0.882458031f, 0.221353933f},
-std::array<float,2>{0.515265167f, 0.93563199f},
-std::array<float,2>{0.386425346f, 0.30013147f},
-std::array<float,2>{0.450774252f, 0.727304578f},
-std::array<float,2>{0.574949265f, 0.0711723194f},
-std::array<float,2>{0.961029768f, 0.86929673f},
-std::array<float,2>{0.242519528f, 0.446522951f},
-std::array<float,2>{0.0640514717f, 0.966799974f},
-std::array<float,2>{0.855204999f, 0.350496769f},
-std::array<float,2>{0.741891861f, 0.603044093f},
-std::array<float,2>{0.319651872f, 0.128073633f},
-std::array<float,2>{0.408342868f, 0.877921581f},
-std::array<float,2>{0.554338276f, 0.28030318f},
-std::array<float,2>{0.928753316f, 0.512971878f},
-std::array<float,2>{0.134799123f, 0.190048233f},
-std::array<float,2>{0.00302725076f, 0.665017188f},
-std::array<float,2>{0.790028512f, 0.0443186387f},
-std::array<float,2>{0.678716183f, 0.797835827f},
-std::array<float,2>{0.256959677f, 0.382003069f},
-std::array<float,2>{0.353713691f, 0.57962513f},
-std::array<float,2>{0.712409198f, 0.158366963f},
-std::array<float,2>{0.840652466f, 0.98573637f},
-std::array<float,2>{0.110436268f, 0.314420223f},
-std::array<float,2>{0.205267593f, 0.820361257f},
-std::array<float,2>{0.992482543f, 0.498132557f},
-std::array<float,2>{0.616705835f, 0.706325829f},
-std::array<float,2>{0.486674428f, 0.0987284631f},
-std::array<float,2>{0.258660942f, 0.928189516f},
-std::array<float,2>{0.682822227f, 0.309202194f},
-std::array<float,2>{0.784464896f, 0.532181978f},
-std::array<float,2>{0.0139023159f, 0.227851242f},
-std::array<float,2>{0.127010688f, 0.629149675f},
-std::array<float,2>{0.935115099f, 0.0242538154f},
-std::array<float,2>{0.555258989f, 0.752161384f},
-std::array<float,2>{0.416503638f, 0.422012001f},
-std::array<float,2>{0.494093269f, 0.597456276f},
-std::array<float,2>{0.61974889f, 0.13509585f},
-std::array<float,2>{0.989391148f, 0.956696153f},
-std::array<float,2>{0.217020705f, 0.354581714f},
-std::array<float,2>{0.118841998f, 0.867156565f},
-std::array<float,2>{0.832531273f, 0.44007951f},
-std::array<float,2>{0.706404746f, 0.720995486f},
-std::array<float,2>{0.348348975f, 0.0647049621f},
-std::array<float,2>{0.379864424f, 0.811564565f},
-std::array<float,2>{0.504670858f, 0.390345544f},
-std::array<float,2>{0.887821972f, 0.660427451f},
-std::array<float,2>{0.161998525f, 0.0333219506f},
-std::array<float,2>{0.0467198864f, 0.503114522f},
-std::array<float,2>{0.756263733f, 0.201307431f},
-std::array<float,2>{0.648416936f, 0.886486709f},
-std::array<float,2>{0.310346246f, 0.267319292f},
-std::array<float,2>{0.325974911f, 0.715171814f},
-std::array<float,2>{0.748702526f, 0.108659707f},
-std::array<float,2>{0.847917438f, 0.819941878f},
-std::array<float,2>{0.0713734329f, 0.488527089f},
-std::array<float,2>{0.239745885f, 0.996964872f},
-std::array<float,2>{0.957513392f, 0.321604013f},
-std::array<float,2>{0.568836033f, 0.586425424f},
-std::array<float,2>{0.442853749f, 0.167808995f},
-std::array<float,2>{0.374913365f, 0.833926737f},
-std::array<float,2>{0.698911488f, 0.477736801f},
-std::array<float,2>{0.826464772f, 0.692033112f},
-std::array<float,2>{0.102837026f, 0.119976178f},
-std::array<float,2>{0.197807059f, 0.567391515f},
-std::array<float,2>{0.972948849f, 0.187335059f},
-std::array<float,2>{0.593895555f, 0.982174575f},
-std::array<float,2>{0.473820657f, 0.334431589f},
-std::array<float,2>{0.427063286f, 0.679803073f},
-std::array<float,2>{0.545003057f, 0.0556823872f},
-std::array<float,2>{0.908507526f, 0.793600023f},
-std::array<float,2>{0.148209065f, 0.39527154f},
-std::array<float,2>{0.0191572346f, 0.891259193f},
-std::array<float,2>{0.804331243f, 0.257727504f},
-std::array<float,2>{0.660042465f, 0.528175533f},
-std::array<float,2>{0.265916497f, 0.213959321f},
-std::array<float,2>{0.468514025f, 0.951512575f},
-std::array<float,2>{0.582437158f, 0.369526923f},
-std::array<float,2>{0.939295948f, 0.624966323f},
-std::array<float,2>{0.222075075f, 0.147681832f},
-std::array<float,2>{0.0817093477f, 0.736230016f},
-std::array<float,2>{0.872476578f, 0.0922632962f},
-std::array<float,2>{0.729761958f, 0.855790019f},
-std::array<float,2>{0.336235583f, 0.45376274f},
-std::array<float,2>{0.284270018f, 0.55794847f},
-std::array<float,2>{0.629356682f, 0.246912509f},
-std::array<float,2>{0.765927434f, 0.912736416f},
-std::array<float,2>{0.0572670065f, 0.285723686f},
-std::array<float,2>{0.177304879f, 0.774971604f},
-std::array<float,2>{0.893769264f, 0.413858473f},
-std::array<float,2>{0.516813874f, 0.651343167f},
-std::array<float,2>{0.394047201f, 0.0144081581f},
-std::array<float,2>{0.320711553f, 0.921551764f},
-std::array<float,2>{0.743156612f, 0.290949017f},
-std::array<float,2>{0.847185612f, 0.554252505f},
-std::array<float,2>{0.0748697519f, 0.234792665f},
-std::array<float,2>{0.236986548f, 0.645617843f},
-std::array<float,2>{0.954646587f, 0.00418641744f},
-std::array<float,2>{0.566057265f, 0.768247068f},
-std::array<float,2>{0.439162672f, 0.417010754f},
-std::array<float,2>{0.376646101f, 0.614029527f},
-std::array<float,2>{0.501784146f, 0.153054118f},
-std::array<float,2>{0.885735989f, 0.938678086f},
-std::array<float,2>{0.15821214f, 0.359421283f},
-std::array<float,2>{0.0410170443f, 0.846053004f},
-std::array<float,2>{0.75090301f, 0.468093216f},
-std::array<float,2>{0.641617179f, 0.746042669f},
-std::array<float,2>{0.307770163f, 0.0787183195f},
-std::array<float,2>{0.497258723f, 0.786279202f},
-std::array<float,2>{0.622050941f, 0.400474906f},
-std::array<float,2>{0.986381829f, 0.679629266f},
-std::array<float,2>{0.211436659f, 0.0515509024f},
-std::array<float,2>{0.123922721f, 0.519071579f},
-std::array<float,2>{0.83013761f, 0.206196934f},
-std::array<float,2>{0.709324777f, 0.904716253f},
-std::array<float,2>{0.347336262f, 0.260176808f},
-std::array<float,2>{0.263917327f, 0.701524496f},
-std::array<float,2>{0.687063575f, 0.111344144f},
-std::array<float,2>{0.785268247f, 0.837779939f},
-std::array<float,2>{0.0113382889f, 0.470914245f},
-std::array<float,2>{0.131531015f, 0.969370961f},
-std::array<float,2>{0.932580054f, 0.340745956f},
-std::array<float,2>{0.560156703f, 0.57729125f},
-std::array<float,2>{0.420339942f, 0.178427681f},
-std::array<float,2>{0.287296921f, 0.825130999f},
-std::array<float,2>{0.62715286f, 0.494360536f},
-std::array<float,2>{0.770822763f, 0.709070086f},
-std::array<float,2>{0.059273921f, 0.0957272872f},
-std::array<float,2>{0.172093451f, 0.583837509f},
-std::array<float,2>{0.896125793f, 0.163586706f},
-std::array<float,2>{0.519880652f, 0.990122736f},
-std::array<float,2>{0.396305501f, 0.31822893f},
-std::array<float,2>{0.463086337f, 0.67187053f},
-std::array<float,2>{0.580844164f, 0.0404893719f},
-std::array<float,2>{0.944503844f, 0.802054107f},
-std::array<float,2>{0.226054594f, 0.376663148f},
-std::array<float,2>{0.0824768916f, 0.881191969f},
-std::array<float,2>{0.869846106f, 0.27394399f},
-std::array<float,2>{0.730698168f, 0.511235178f},
-std::array<float,2>{0.340753078f, 0.193508729f},
-std::array<float,2>{0.425406337f, 0.964602411f},
-std::array<float,2>{0.5393067f, 0.345911205f},
-std::array<float,2>{0.912818909f, 0.606916428f},
-std::array<float,2>{0.142770097f, 0.132785052f},
-std::array<float,2>{0.0203490984f, 0.73162353f},
-std::array<float,2>{0.797790766f, 0.076179646f},
-std::array<float,2>{0.663520455f, 0.871177316f},
-std::array<float,2>{0.271745622f, 0.452698857f},
-std::array<float,2>{0.369242847f, 0.543002605f},
-std::array<float,2>{0.702054083f, 0.223155886f},
-std::array<float,2>{0.821269453f, 0.93208015f},
-std::array<float,2>{0.108634464f, 0.303115487f},
-std::array<float,2>{0.20268032f, 0.76427567f},
-std::array<float,2>{0.970917165f, 0.436789811f},
-std::array<float,2>{0.598338246f, 0.64006269f},
-std::array<float,2>{0.471572936f, 0.0229592193f},
-std::array<float,2>{0.273903579f, 0.99474448f},
-std::array<float,2>{0.665297985f, 0.324436426f},
-std::array<float,2>{0.80771929f, 0.5912835f},
-std::array<float,2>{0.0248443782f, 0.170115083f},
-std::array<float,2>{0.150299922f, 0.712487042f},
-std::array<float,2>{0.920121372f, 0.103746474f},
-std::array<float,2>{0.534517169f, 0.814888179f},
-std::array<float,2>{0.431488544f, 0.487226665f},
-std::array<float,2>{0.482848853f, 0.505544186f},
-std::array<float,2>{0.603879869f, 0.198364973f},
-std::array<float,2>{0.97867161f, 0.886920512f},
-std::array<float,2>{0.188738286f, 0.271068901f},
-std::array<float,2>{0.100139961f, 0.805813074f},
-std::array<float,2>{0.816927671f, 0.385336667f},
-std::array<float,2>{0.695004523f, 0.656567991f},
-std::array<float,2>{0.362334669f, 0.0359376669f},
-std::array<float,2>{0.406166941f, 0.863134742f},
-std::array<float,2>{0.530764163f, 0.444521248f},
-std::array<float,2>{0.90600121f, 0.723365486f},
-std::array<float,2>{0.179706782f, 0.0697896406f},
-std::array<float,2>{0.0520906858f, 0.599518359f},
-std::array<float,2>{0.778549254f, 0.140000403f},
-std::array<float,2>{0.63964957f, 0.958458662f},
-std::array<float,2>{0.289967209f, 0.358652532f},
-std::array<float,2>{0.330204964f, 0.625165403f},
-std::array<float,2>{0.720253468f, 0.0274618603f},
-std::array<float,2>{0.861153603f, 0.754273236f},
-std::array<float,2>{0.0933648124f, 0.42824775f},
-std::array<float,2>{0.232551202f, 0.925656736f},
-std::array<float,2>{0.9462111f, 0.304911524f},
-std::array<float,2>{0.592891693f, 0.538028359f},
-std::array<float,2>{0.456685007f, 0.232685685f},
-std::array<float,2>{0.356712252f, 0.778756499f},
-std::array<float,2>{0.71526593f, 0.409900904f},
-std::array<float,2>{0.838362098f, 0.653559208f},
-std::array<float,2>{0.113924496f, 0.0115095396f},
-std::array<float,2>{0.207824185f, 0.5624547f},
-std::array<float,2>{0.998959959f, 0.245791197f},
-std::array<float,2>{0.612847149f, 0.906435847f},
-std::array<float,2>{0.492049932f, 0.281461f},
-std::array<float,2>{0.411540061f, 0.740921199f},
-std::array<float,2>{0.550733864f, 0.0893341079f},
-std::array<float,2>{0.923385143f, 0.854605675f},
-std::array<float,2>{0.139514521f, 0.460535228f},
-std::array<float,2>{0.00642108778f, 0.948902428f},
-std::array<float,2>{0.794620275f, 0.372088879f},
-std::array<float,2>{0.673244894f, 0.619429469f},
-std::array<float,2>{0.253461003f, 0.143838093f},
-std::array<float,2>{0.448228449f, 0.895082772f},
-std::array<float,2>{0.573767245f, 0.252714068f},
-std::array<float,2>{0.965129852f, 0.525085449f},
-std::array<float,2>{0.248730987f, 0.21690549f},
-std::array<float,2>{0.0694660395f, 0.685818553f},
-std::array<float,2>{0.858425319f, 0.0617403053f},
-std::array<float,2>{0.737061977f, 0.789066732f},
-std::array<float,2>{0.313028127f, 0.390986264f},
-std::array<float,2>{0.297652364f, 0.566080213f},
-std::array<float,2>{0.651998103f, 0.182296619f},
-std::array<float,2>{0.757888377f, 0.97726202f},
-std::array<float,2>{0.0317356735f, 0.329450876f},
-std::array<float,2>{0.170679346f, 0.831212163f},
-std::array<float,2>{0.876990914f, 0.48126924f},
-std::array<float,2>{0.508889079f, 0.688803375f},
-std::array<float,2>{0.389925271f, 0.123879403f},
-std::array<float,2>{0.363563418f, 0.944226742f},
-std::array<float,2>{0.688194573f, 0.364187598f},
-std::array<float,2>{0.815936625f, 0.61247015f},
-std::array<float,2>{0.0950484872f, 0.149899691f},
-std::array<float,2>{0.191991538f, 0.748765945f},
-std::array<float,2>{0.981066465f, 0.0847030729f},
-std::array<float,2>{0.609072864f, 0.847842455f},
-std::array<float,2>{0.477285147f, 0.463158399f},
-std::array<float,2>{0.435144871f, 0.548828244f},
-std::array<float,2>{0.538483799f, 0.238884315f},
-std::array<float,2>{0.914531946f, 0.917392671f},
-std::array<float,2>{0.15285863f, 0.293874204f},
-std::array<float,2>{0.029244259f, 0.771766424f},
-std::array<float,2>{0.811071277f, 0.421832025f},
-std::array<float,2>{0.671196759f, 0.642457247f},
-std::array<float,2>{0.279586971f, 0.00100591988f},
-std::array<float,2>{0.460347116f, 0.840135634f},
-std::array<float,2>{0.588716805f, 0.475754648f},
-std::array<float,2>{0.949304342f, 0.698485076f},
-std::array<float,2>{0.229120597f, 0.116380498f},
-std::array<float,2>{0.0861871466f, 0.571010888f},
-std::array<float,2>{0.866614521f, 0.175773636f},
-std::array<float,2>{0.72423774f, 0.973039925f},
-std::array<float,2>{0.335215509f, 0.337470204f},
-std::array<float,2>{0.294582099f, 0.672501743f},
-std::array<float,2>{0.633780301f, 0.0476586185f},
-std::array<float,2>{0.776296377f, 0.78493017f},
-std::array<float,2>{0.0505937636f, 0.406084597f},
-std::array<float,2>{0.184001595f, 0.900761306f},
-std::array<float,2>{0.900136352f, 0.262566566f},
-std::array<float,2>{0.524701774f, 0.521822095f},
-std::array<float,2>{0.400089622f, 0.210174397f},
-std::array<float,2>{0.254765362f, 0.799933493f},
-std::array<float,2>{0.677549243f, 0.379536062f},
-std::array<float,2>{0.791787744f, 0.667619169f},
-std::array<float,2>{0.00143798883f, 0.0454332381f},
-std::array<float,2>{0.133610383f, 0.51551199f},
-std::array<float,2>{0.926211715f, 0.188421935f},
-std::array<float,2>{0.551371157f, 0.876593292f},
-std::array<float,2>{0.406521887f, 0.278077602f},
-std::array<float,2>{0.485700786f, 0.703496397f},
-std::array<float,2>{0.614545763f, 0.100700796f},
-std::array<float,2>{0.994207442f, 0.822601318f},
-std::array<float,2>{0.204815134f, 0.49754405f},
-std::array<float,2>{0.111667179f, 0.987761259f},
-std::array<float,2>{0.842447162f, 0.316365272f},
-std::array<float,2>{0.713162363f, 0.580217361f},
-std::array<float,2>{0.352234185f, 0.156720534f},
-std::array<float,2>{0.384081513f, 0.933804572f},
-std::array<float,2>{0.513333023f, 0.2969082f},
-std::array<float,2>{0.879036129f, 0.540791571f},
-std::array<float,2>{0.167120636f, 0.219837934f},
-std::array<float,2>{0.03621988f, 0.63498497f},
-std::array<float,2>{0.765016139f, 0.0178021751f},
-std::array<float,2>{0.652919471f, 0.758608758f},
-std::array<float,2>{0.303438425f, 0.431260586f},
-std::array<float,2>{0.318074435f, 0.60413003f},
-std::array<float,2>{0.739379883f, 0.125536397f},
-std::array<float,2>{0.851861477f, 0.966246605f},
-std::array<float,2>{0.0659706667f, 0.347865015f},
-std::array<float,2>{0.245192811f, 0.86850363f},
-std::array<float,2>{0.96380657f, 0.447564036f},
-std::array<float,2>{0.578089416f, 0.729929149f},
-std::array<float,2>{0.451780796f, 0.0738203675f},
-std::array<float,2>{0.312036544f, 0.884362578f},
-std::array<float,2>{0.646214247f, 0.269261271f},
-std::array<float,2>{0.755173981f, 0.500666022f},
-std::array<float,2>{0.0447817855f, 0.199461386f},
-std::array<float,2>{0.162980974f, 0.662318408f},
-std::array<float,2>{0.89034307f, 0.0327387042f},
-std::array<float,2>{0.506129324f, 0.809094012f},
-std::array<float,2>{0.381784916f, 0.388238847f},
-std::array<float,2>{0.445049882f, 0.589513659f},
-std::array<float,2>{0.566613674f, 0.164951175f},
-std::array<float,2>{0.959388614f, 0.999950409f},
-std::array<float,2>{0.240406051f, 0.323466748f},
-std::array<float,2>{0.0728976056f, 0.818001807f},
-std::array<float,2>{0.850585878f, 0.49192664f},
-std::array<float,2>{0.747992635f, 0.718207717f},
-std::array<float,2>{0.32785064f, 0.10722439f},
-std::array<float,2>{0.415764302f, 0.750485301f},
-std::array<float,2>{0.557852745f, 0.425286204f},
-std::array<float,2>{0.936154902f, 0.632271349f},
-std::array<float,2>{0.125998765f, 0.026905816f},
-std::array<float,2>{0.0121461619f, 0.533821523f},
-std::array<float,2>{0.782203496f, 0.228935465f},
-std::array<float,2>{0.680122495f, 0.927366436f},
-std::array<float,2>{0.261029214f, 0.311676562f},
-std::array<float,2>{0.349766254f, 0.719477415f},
-std::array<float,2>{0.704994798f, 0.0638468936f},
-std::array<float,2>{0.834002554f, 0.86485815f},
-std::array<float,2>{0.120166838f, 0.438123733f},
-std::array<float,2>{0.216142952f, 0.953758955f},
-std::array<float,2>{0.991888523f, 0.351848811f},
-std::array<float,2>{0.617265582f, 0.595500112f},
-std::array<float,2>{0.494724005f, 0.133757934f},
-std::array<float,2>{0.339392573f, 0.859213173f},
-std::array<float,2>{0.72701329f, 0.455727965f},
-std::array<float,2>{0.874020994f, 0.737790346f},
-std::array<float,2>{0.078990601f, 0.0900434852f},
-std::array<float,2>{0.220251635f, 0.622120678f},
-std::array<float,2>{0.940115511f, 0.145075798f},
-std::array<float,2>{0.584280372f, 0.950226188f},
-std::array<float,2>{0.466746539f, 0.368988276f},
-std::array<float,2>{0.391226292f, 0.649895012f},
-std::array<float,2>{0.518737972f, 0.0128566297f},
-std::array<float,2>{0.890907466f, 0.77677983f},
-std::array<float,2>{0.177901179f, 0.412108481f},
-std::array<float,2>{0.0557031967f, 0.912018359f},
-std::array<float,2>{0.768351972f, 0.288584262f},
-std::array<float,2>{0.631362617f, 0.555559576f},
-std::array<float,2>{0.282511175f, 0.24952063f},
-std::array<float,2>{0.475152552f, 0.984097779f},
-std::array<float,2>{0.597170889f, 0.333436131f},
-std::array<float,2>{0.975626826f, 0.569984674f},
-std::array<float,2>{0.196800381f, 0.184689134f},
-std::array<float,2>{0.104007699f, 0.693449914f},
-std::array<float,2>{0.825610042f, 0.118817545f},
-std::array<float,2>{0.696478486f, 0.835502505f},
-std::array<float,2>{0.371931851f, 0.479786038f},
-std::array<float,2>{0.267942309f, 0.531145871f},
-std::array<float,2>{0.657079875f, 0.212400481f},
-std::array<float,2>{0.802332699f, 0.892583072f},
-std::array<float,2>{0.0162616484f, 0.254805654f},
-std::array<float,2>{0.144920424f, 0.795096695f},
-std::array<float,2>{0.906297028f, 0.398186475f},
-std::array<float,2>{0.544690609f, 0.682272255f},
-std::array<float,2>{0.428524345f, 0.0576593764f},
-std::array<float,2>{0.367858052f, 0.93269664f},
-std::array<float,2>{0.699230671f, 0.304680884f},
-std::array<float,2>{0.823480964f, 0.544450641f},
-std::array<float,2>{0.107192412f, 0.223649144f},
-std::array<float,2>{0.199499115f, 0.638977885f},
-std::array<float,2>{0.970430374f, 0.0217966773f},
-std::array<float,2>{0.600930572f, 0.765210271f},
-std::array<float,2>{0.469543874f, 0.435622871f},
-std::array<float,2>{0.422689229f, 0.606318057f},
-std::array<float,2>{0.542410493f, 0.131594568f},
-std::array<float,2>{0.912087083f, 0.963223934f},
-std::array<float,2>{0.141179621f, 0.347599566f},
-std::array<float,2>{0.0223031156f, 0.872080863f},
-std::array<float,2>{0.799426198f, 0.452033103f},
-std::array<float,2>{0.6612041f, 0.730469465f},
-std::array<float,2>{0.270386338f, 0.0780018866f},
-std::array<float,2>{0.460979015f, 0.801490724f},
-std::array<float,2>{0.579856336f, 0.375478446f},
-std::array<float,2>{0.941759109f, 0.670331776f},
-std::array<float,2>{0.22353372f, 0.0399742872f},
-std::array<float,2>{0.0854210854f, 0.510695875f},
-std::array<float,2>{0.867217779f, 0.194934934f},
-std::array<float,2>{0.734187961f, 0.881964564f},
-std::array<float,2>{0.342299104f, 0.275169134f},
-std::array<float,2>{0.285676092f, 0.710117817f},
-std::array<float,2>{0.626011133f, 0.097466372f},
-std::array<float,2>{0.772369146f, 0.825820684f},
-std::array<float,2>{0.0605968311f, 0.495538414f},
-std::array<float,2>{0.174688295f, 0.98836726f},
-std::array<float,2>{0.896941721f, 0.317009479f},
-std::array<float,2>{0.522360802f, 0.582851827f},
-std::array<float,2>{0.397663027f, 0.162488237f},
-std::array<float,2>{0.262361407f, 0.836563587f},
-std::array<float,2>{0.683904052f, 0.471859604f},
-std::array<float,2>{0.787547946f, 0.70248729f},
-std::array<float,2>{0.00964778289f, 0.112869188f},
-std::array<float,2>{0.129305705f, 0.576384187f},
-std::array<float,2>{0.930365026f, 0.179513931f},
-std::array<float,2>{0.560729265f, 0.969852805f},
-std::array<float,2>{0.41803652f, 0.340920687f},
-std::array<float,2>{0.499290824f, 0.678410709f},
-std::array<float,2>{0.624302804f, 0.052450791f},
-std::array<float,2>{0.985966504f, 0.786094904f},
-std::array<float,2>{0.2141103f, 0.401661187f},
-std::array<float,2>{0.12146952f, 0.905924499f},
-std::array<float,2>{0.829372346f, 0.261134267f},
-std::array<float,2>{0.707596183f, 0.517822504f},
-std::array<float,2>{0.344560504f, 0.205930308f},
-std::array<float,2>{0.377080679f, 0.938398242f},
-std::array<float,2>{0.502747655f, 0.361290663f},
-std::array<float,2>{0.88449651f, 0.615182042f},
-std::array<float,2>{0.157362089f, 0.153621808f},
-std::array<float,2>{0.0391627178f, 0.744964302f},
-std::array<float,2>{0.752595842f, 0.0800493807f},
-std::array<float,2>{0.643477261f, 0.847280145f},
-std::array<float,2>{0.305611968f, 0.467317164f},
-std::array<float,2>{0.323947459f, 0.553101718f},
-std::array<float,2>{0.744980514f, 0.235460311f},
-std::array<float,2>{0.845616519f, 0.920087099f},
-std::array<float,2>{0.076360099f, 0.289134502f},
-std::array<float,2>{0.234479651f, 0.769366026f},
-std::array<float,2>{0.956404328f, 0.416065872f},
-std::array<float,2>{0.563796639f, 0.64460969f},
-std::array<float,2>{0.441103935f, 0.00544605078f},
-std::array<float,2>{0.299346834f, 0.978412807f},
-std::array<float,2>{0.649261594f, 0.32833463f},
-std::array<float,2>{0.760222197f, 0.56457001f},
-std::array<float,2>{0.0337994546f, 0.18262516f},
-std::array<float,2>{0.168880463f, 0.687551022f},
-std::array<float,2>{0.876686633f, 0.124847762f},
-std::array<float,2>{0.509972572f, 0.830383599f},
-std::array<float,2>{0.387829423f, 0.482047379f},
-std::array<float,2>{0.446976513f, 0.523937404f},
-std::array<float,2>{0.572176158f, 0.21823132f},
-std::array<float,2>{0.96730715f, 0.896460414f},
-std::array<float,2>{0.247604519f, 0.253253073f},
-std::array<float,2>{0.0667511523f, 0.790480733f},
-std::array<float,2>{0.857184827f, 0.39215976f},
-std::array<float,2>{0.73477298f, 0.686933339f},
-std::array<float,2>{0.316322595f, 0.0607400611f},
-std::array<float,2>{0.412553012f, 0.853815436f},
-std::array<float,2>{0.547280848f, 0.459810078f},
-std::array<float,2>{0.923949301f, 0.742131889f},
-std::array<float,2>{0.138400808f, 0.0879257545f},
-std::array<float,2>{0.00492458465f, 0.620678663f},
-std::array<float,2>{0.795632124f, 0.143394664f},
-std::array<float,2>{0.673902929f, 0.94772917f},
-std::array<float,2>{0.250483543f, 0.371525228f},
-std::array<float,2>{0.357470363f, 0.653004825f},
-std::array<float,2>{0.718277454f, 0.00988294464f},
-std::array<float,2>{0.836456239f, 0.777351797f},
-std::array<float,2>{0.116904818f, 0.408369929f},
-std::array<float,2>{0.21023196f, 0.907587647f},
-std::array<float,2>{0.996909857f, 0.282510161f},
-std::array<float,2>{0.610169649f, 0.561419904f},
-std::array<float,2>{0.490126163f, 0.24488093f},
-std::array<float,2>{0.32904312f, 0.755768418f},
-std::array<float,2>{0.721781373f, 0.42897734f},
-std::array<float,2>{0.861569285f, 0.626200199f},
-std::array<float,2>{0.090099223f, 0.0287339427f},
-std::array<float,2>{0.231972039f, 0.538933158f},
-std::array<float,2>{0.949165046f, 0.233438343f},
-std::array<float,2>{0.591512501f, 0.923992872f},
-std::array<float,2>{0.454943508f, 0.306287169f},
-std::array<float,2>{0.403945982f, 0.724570036f},
-std::array<float,2>{0.528631091f, 0.0684261993f},
-std::array<float,2>{0.903703511f, 0.861850679f},
-std::array<float,2>{0.182038039f, 0.444260687f},
-std::array<float,2>{0.0535399914f, 0.95710206f},
-std::array<float,2>{0.780709743f, 0.357438058f},
-std::array<float,2>{0.637881696f, 0.59767133f},
-std::array<float,2>{0.292158604f, 0.139260128f},
-std::array<float,2>{0.481137395f, 0.887742877f},
-std::array<float,2>{0.603106201f, 0.270396948f},
-std::array<float,2>{0.978105247f, 0.504200399f},
-std::array<float,2>{0.190743834f, 0.197876573f},
-std::array<float,2>{0.0993529931f, 0.657666147f},
-std::array<float,2>{0.818966925f, 0.0370755158f},
-std::array<float,2>{0.693299532f, 0.805032015f},
-std::array<float,2>{0.361009449f, 0.38650611f},
-std::array<float,2>{0.275620222f, 0.58994329f},
-std::array<float,2>{0.667103946f, 0.171283513f},
-std::array<float,2>{0.80604142f, 0.995576322f},
-std::array<float,2>{0.0265258811f, 0.325927705f},
-std::array<float,2>{0.152012408f, 0.815768301f},
-std::array<float,2>{0.919046342f, 0.487306178f},
-std::array<float,2>{0.532176733f, 0.711557865f},
-std::array<float,2>{0.432073414f, 0.104678087f},
-std::array<float,2>{0.319017828f, 0.965016544f},
-std::array<float,2>{0.74051106f, 0.349484563f},
-std::array<float,2>{0.853865266f, 0.604743958f},
-std::array<float,2>{0.0625298321f, 0.126230121f},
-std::array<float,2>{0.243187413f, 0.729086876f},
-std::array<float,2>{0.962191522f, 0.0731802583f},
-std::array<float,2>{0.575794697f, 0.867619395f},
-std::array<float,2>{0.449557543f, 0.448697686f},
-std::array<float,2>{0.385433942f, 0.539855301f},
-std::array<float,2>{0.513863564f, 0.219381526f},
-std::array<float,2>{0.88107568f, 0.935449421f},
-std::array<float,2>{0.165920153f, 0.298198342f},
-std::array<float,2>{0.0372470841f, 0.758807063f},
-std::array<float,2>{0.763156116f, 0.43052572f},
-std::array<float,2>{0.656139672f, 0.635751367f},
-std::array<float,2>{0.302300692f, 0.0189808737f},
-std::array<float,2>{0.487332106f, 0.824195445f},
-std::array<float,2>{0.615771294f, 0.497036606f},
-std::array<float,2>{0.99386251f, 0.704405665f},
-std::array<float,2>{0.206159025f, 0.100126736f},
-std::array<float,2>{0.11026305f, 0.581344366f},
-std::array<float,2>{0.84098047f, 0.157916427f},
-std::array<float,2>{0.711585402f, 0.987242401f},
-std::array<float,2>{0.355381519f, 0.315187812f},
-std::array<float,2>{0.25601694f, 0.666512549f},
-std::array<float,2>{0.678500473f, 0.0467154272f},
-std::array<float,2>{0.790576875f, 0.799055576f},
-std::array<float,2>{0.00235085841f, 0.379983246f},
-std::array<float,2>{0.136502028f, 0.875961542f},
-std::array<float,2>{0.927800834f, 0.279119015f},
-std::array<float,2>{0.553691208f, 0.514135897f},
-std::array<float,2>{0.409609675f, 0.189086601f},
-std::array<float,2>{0.295232326f, 0.783279836f},
-std::array<float,2>{0.635693073f, 0.405147851f},
-std::array<float,2>{0.774921536f, 0.672872007f},
-std::array<float,2>{0.0486737527f, 0.0484996513f},
-std::array<float,2>{0.186055228f, 0.522877514f},
-std::array<float,2>{0.901840568f, 0.209172264f},
-std::array<float,2>{0.526220798f, 0.902049839f},
-std::array<float,2>{0.401388407f, 0.263480157f},
-std::array<float,2>{0.457151294f, 0.697913229f},
-std::array<float,2>{0.586921275f, 0.11614906f},
-std::array<float,2>{0.952695012f, 0.841066122f},
-std::array<float,2>{0.226775214f, 0.475201368f},
-std::array<float,2>{0.0882038176f, 0.974452198f},
-std::array<float,2>{0.863473117f, 0.336907804f},
-std::array<float,2>{0.72573483f, 0.571901143f},
-std::array<float,2>{0.332673192f, 0.173917383f},
-std::array<float,2>{0.436865568f, 0.916344285f},
-std::array<float,2>{0.536054373f, 0.294434398f},
-std::array<float,2>{0.917332172f, 0.550193965f},
-std::array<float,2>{0.156079233f, 0.239442721f},
-std::array<float,2>{0.0306661576f, 0.641308188f},
-std::array<float,2>{0.809599578f, 0.000453192071f},
-std::array<float,2>{0.669875979f, 0.773156762f},
-std::array<float,2>{0.279294968f, 0.420770824f},
-std::array<float,2>{0.365885615f, 0.612246573f},
-std::array<float,2>{0.689753413f, 0.148648083f},
-std::array<float,2>{0.814186573f, 0.945225596f},
-std::array<float,2>{0.0962563604f, 0.364311576f},
-std::array<float,2>{0.193609774f, 0.849553406f},
-std::array<float,2>{0.983920097f, 0.464629114f},
-std::array<float,2>{0.607358694f, 0.749642432f},
-std::array<float,2>{0.479491979f, 0.0853378773f},
-std::array<float,2>{0.26723212f, 0.893781424f},
-std::array<float,2>{0.658736229f, 0.255645961f},
-std::array<float,2>{0.803200603f, 0.529934525f},
-std::array<float,2>{0.0182190016f, 0.211886913f},
-std::array<float,2>{0.147115752f, 0.682889342f},
-std::array<float,2>{0.90942508f, 0.0567947887f},
-std::array<float,2>{0.54633075f, 0.796296597f},
-std::array<float,2>{0.425848603f, 0.39683333f},
-std::array<float,2>{0.473032326f, 0.568847477f},
-std::array<float,2>{0.594969988f, 0.184219286f},
-std::array<float,2>{0.974054575f, 0.982974827f},
-std::array<float,2>{0.198885083f, 0.332789361f},
-std::array<float,2>{0.101975739f, 0.834253192f},
-std::array<float,2>{0.828031182f, 0.479071051f},
-std::array<float,2>{0.697993457f, 0.694600224f},
-std::array<float,2>{0.373506546f, 0.117983229f},
-std::array<float,2>{0.392720252f, 0.775911331f},
-std::array<float,2>{0.515678823f, 0.41086024f},
-std::array<float,2>{0.893231511f, 0.648867249f},
-std::array<float,2>{0.176443368f, 0.012312864f},
-std::array<float,2>{0.0576238222f, 0.556586742f},
-std::array<float,2>{0.766976178f, 0.248104542f},
-std::array<float,2>{0.629900277f, 0.910224795f},
-std::array<float,2>{0.283378601f, 0.288084626f},
-std::array<float,2>{0.337414563f, 0.737190485f},
-std::array<float,2>{0.729468524f, 0.0917454064f},
-std::array<float,2>{0.87147516f, 0.857493222f},
-std::array<float,2>{0.0804550722f, 0.456961334f},
-std::array<float,2>{0.220844135f, 0.950146854f},
-std::array<float,2>{0.937647223f, 0.367348194f},
-std::array<float,2>{0.583420873f, 0.621862054f},
-std::array<float,2>{0.467680901f, 0.146143034f},
-std::array<float,2>{0.349135607f, 0.863997459f},
-std::array<float,2>{0.706001282f, 0.438626498f},
-std::array<float,2>{0.833522439f, 0.720465839f},
-std::array<float,2>{0.11771258f, 0.0626772642f},
-std::array<float,2>{0.217940837f, 0.594602942f},
-std::array<float,2>{0.988918781f, 0.134221718f},
-std::array<float,2>{0.620702684f, 0.954623282f},
-std::array<float,2>{0.492833704f, 0.352975994f},
-std::array<float,2>{0.417691827f, 0.631654382f},
-std::array<float,2>{0.556224823f, 0.0254200511f},
-std::array<float,2>{0.934229434f, 0.751057088f},
-std::array<float,2>{0.128605396f, 0.423900753f},
-std::array<float,2>{0.0148570128f, 0.926468849f},
-std::array<float,2>{0.783676982f, 0.310930252f},
-std::array<float,2>{0.682241857f, 0.534658313f},
-std::array<float,2>{0.259671777f, 0.230305061f},
-std::array<float,2>{0.442121118f, 0.99897778f},
-std::array<float,2>{0.570040464f, 0.323106319f},
-std::array<float,2>{0.95834887f, 0.588572741f},
-std::array<float,2>{0.239053026f, 0.165050209f},
-std::array<float,2>{0.0710245594f, 0.717079997f},
-std::array<float,2>{0.848670542f, 0.106400952f},
-std::array<float,2>{0.749842823f, 0.816640198f},
-std::array<float,2>{0.325017422f, 0.490599692f},
-std::array<float,2>{0.308887601f, 0.501245677f},
-std::array<float,2>{0.647092521f, 0.201037973f},
-std::array<float,2>{0.756958663f, 0.883171618f},
-std::array<float,2>{0.045745343f, 0.268359452f},
-std::array<float,2>{0.161052749f, 0.810032129f},
-std::array<float,2>{0.887682498f, 0.386866003f},
-std::array<float,2>{0.504922569f, 0.663504899f},
-std::array<float,2>{0.380488962f, 0.0321080312f},
-std::array<float,2>{0.341672122f, 0.880709589f},
-std::array<float,2>{0.731861889f, 0.276572824f},
-std::array<float,2>{0.870551109f, 0.507829607f},
-std::array<float,2>{0.0834903792f, 0.191569656f},
-std::array<float,2>{0.225101665f, 0.669511199f},
-std::array<float,2>{0.943457663f, 0.0427769236f},
-std::array<float,2>{0.581079364f, 0.803638697f},
-std::array<float,2>{0.463957548f, 0.37871021f},
-std::array<float,2>{0.395121157f, 0.584028304f},
-std::array<float,2>{0.521135628f, 0.1609319f},
-std::array<float,2>{0.894977152f, 0.990994632f},
-std::array<float,2>{0.172941461f, 0.318705171f},
-std::array<float,2>{0.0596409142f, 0.827715099f},
-std::array<float,2>{0.769742072f, 0.493556798f},
-std::array<float,2>{0.628080547f, 0.707935631f},
-std::array<float,2>{0.288695484f, 0.0947675034f},
-std::array<float,2>{0.472231805f, 0.761842072f},
-std::array<float,2>{0.598707378f, 0.434019625f},
-std::array<float,2>{0.972014964f, 0.638518453f},
-std::array<float,2>{0.201410636f, 0.0205598008f},
-std::array<float,2>{0.107568331f, 0.546457231f},
-std::array<float,2>{0.821587384f, 0.224773437f},
-std::array<float,2>{0.703101754f, 0.930290878f},
-std::array<float,2>{0.371040076f, 0.30213201f},
-std::array<float,2>{0.272724956f, 0.733203888f},
-std::array<float,2>{0.662513494f, 0.0760396272f},
-std::array<float,2>{0.798392951f, 0.873260915f},
-std::array<float,2>{0.0210635737f, 0.450199425f},
-std::array<float,2>{0.144097671f, 0.961670578f},
-std::array<float,2>{0.913349509f, 0.343921572f},
-std::array<float,2>{0.540359795f, 0.608560622f},
-std::array<float,2>{0.424672335f, 0.130111933f},
-std::array<float,2>{0.307329476f, 0.845441222f},
-std::array<float,2>{0.640925169f, 0.46561113f},
-std::array<float,2>{0.751456499f, 0.743476987f},
-std::array<float,2>{0.0420233794f, 0.0814056471f},
-std::array<float,2>{0.159459919f, 0.616211653f},
-std::array<float,2>{0.886337757f, 0.156109273f},
-std::array<float,2>{0.500347972f, 0.941084385f},
-std::array<float,2>{0.375705987f, 0.362355202f},
-std::array<float,2>{0.437898338f, 0.647042096f},
-std::array<float,2>{0.564626157f, 0.00642931834f},
-std::array<float,2>{0.953353047f, 0.765850186f},
-std::array<float,2>{0.238000944f, 0.414066821f},
-std::array<float,2>{0.0752743483f, 0.919468999f},
-std::array<float,2>{0.846090019f, 0.292192727f},
-std::array<float,2>{0.743413568f, 0.55267334f},
-std::array<float,2>{0.322078228f, 0.237530142f},
-std::array<float,2>{0.421474457f, 0.971860409f},
-std::array<float,2>{0.559139311f, 0.343549103f},
-std::array<float,2>{0.933111489f, 0.576081336f},
-std::array<float,2>{0.131844789f, 0.177614316f},
-std::array<float,2>{0.0102200722f, 0.69956255f},
-std::array<float,2>{0.78625232f, 0.110773668f},
-std::array<float,2>{0.686442852f, 0.839192331f},
-std::array<float,2>{0.264702797f, 0.470650434f},
-std::array<float,2>{0.345951855f, 0.516460657f},
-std::array<float,2>{0.710651398f, 0.204677403f},
-std::array<float,2>{0.831819296f, 0.903713405f},
-std::array<float,2>{0.124795884f, 0.259131819f},
-std::array<float,2>{0.212107286f, 0.787124395f},
-std::array<float,2>{0.987909079f, 0.398726314f},
-std::array<float,2>{0.622121274f, 0.677345157f},
-std::array<float,2>{0.496661901f, 0.0542835221f},
-std::array<float,2>{0.252842188f, 0.946315765f},
-std::array<float,2>{0.67187655f, 0.374587178f},
-std::array<float,2>{0.792990744f, 0.619100273f},
-std::array<float,2>{0.00697967177f, 0.14232558f},
-std::array<float,2>{0.139961407f, 0.739270866f},
-std::array<float,2>{0.922041655f, 0.0872158706f},
-std::array<float,2>{0.549779534f, 0.852870524f},
-std::array<float,2>{0.410395026f, 0.457584172f},
-std::array<float,2>{0.491009563f, 0.560406387f},
-std::array<float,2>{0.611656368f, 0.244128957f},
-std::array<float,2>{0.999292552f, 0.908759117f},
-std::array<float,2>{0.20859316f, 0.283673704f},
-std::array<float,2>{0.114576086f, 0.780355692f},
-std::array<float,2>{0.839126885f, 0.406879485f},
-std::array<float,2>{0.7162624f, 0.655699909f},
-std::array<float,2>{0.355990946f, 0.00973383244f},
-std::array<float,2>{0.388796568f, 0.828863323f},
-std::array<float,2>{0.508468926f, 0.482658863f},
-std::array<float,2>{0.878168643f, 0.691338539f},
-std::array<float,2>{0.171657369f, 0.122877687f},
-std::array<float,2>{0.0327660628f, 0.562797964f},
-std::array<float,2>{0.759110987f, 0.18024157f},
-std::array<float,2>{0.650496483f, 0.978841662f},
-std::array<float,2>{0.298313767f, 0.330250412f},
-std::array<float,2>{0.313933045f, 0.685103655f},
-std::array<float,2>{0.737373292f, 0.0604731739f},
-std::array<float,2>{0.858141124f, 0.791843891f},
-std::array<float,2>{0.0684017539f, 0.392720193f},
-std::array<float,2>{0.249032348f, 0.89687413f},
-std::array<float,2>{0.966436803f, 0.25194627f},
-std::array<float,2>{0.572743773f, 0.525483787f},
-std::array<float,2>{0.448281348f, 0.21506004f},
-std::array<float,2>{0.361609101f, 0.808189154f},
-std::array<float,2>{0.694128871f, 0.384110034f},
-std::array<float,2>{0.817477942f, 0.658981204f},
-std::array<float,2>{0.100598209f, 0.0386942476f},
-std::array<float,2>{0.187595099f, 0.506238997f},
-std::array<float,2>{0.979580462f, 0.197263315f},
-std::array<float,2>{0.60473609f, 0.889080167f},
-std::array<float,2>{0.484300077f, 0.273077756f},
-std::array<float,2>{0.430584729f, 0.71482408f},
-std::array<float,2>{0.533412099f, 0.10323745f},
-std::array<float,2>{0.921804845f, 0.812664628f},
-std::array<float,2>{0.14874424f, 0.484570563f},
-std::array<float,2>{0.0240359288f, 0.993493497f},
-std::array<float,2>{0.807276964f, 0.326708466f},
-std::array<float,2>{0.664716303f, 0.592247367f},
-std::array<float,2>{0.274664223f, 0.16901657f},
-std::array<float,2>{0.455728352f, 0.922967494f},
-std::array<float,2>{0.592216909f, 0.307212502f},
-std::array<float,2>{0.946879208f, 0.536780238f},
-std::array<float,2>{0.233482406f, 0.231644034f},
-std::array<float,2>{0.0921141952f, 0.628174007f},
-std::array<float,2>{0.859941661f, 0.0294668451f},
-std::array<float,2>{0.719592333f, 0.757397175f},
-std::array<float,2>{0.331644893f, 0.427016556f},
-std::array<float,2>{0.290754855f, 0.600358248f},
-std::array<float,2>{0.639416277f, 0.136721268f},
-std::array<float,2>{0.778280973f, 0.960217059f},
-std::array<float,2>{0.0517444052f, 0.355829239f},
-std::array<float,2>{0.180949956f, 0.859612703f},
-std::array<float,2>{0.904833019f, 0.44257769f},
-std::array<float,2>{0.530039132f, 0.725550652f},
-std::array<float,2>{0.405167013f, 0.0675743371f},
-std::array<float,2>{0.353133529f, 0.984589934f},
-std::array<float,2>{0.71440649f, 0.31311509f},
-std::array<float,2>{0.843073785f, 0.578270197f},
-std::array<float,2>{0.112745747f, 0.159779564f},
-std::array<float,2>{0.203256622f, 0.705946863f},
-std::array<float,2>{0.995200932f, 0.0982738584f},
-std::array<float,2>{0.613650918f, 0.82207191f},
-std::array<float,2>{0.484686047f, 0.499270171f},
-std::array<float,2>{0.407618642f, 0.51243329f},
-std::array<float,2>{0.552518129f, 0.190475404f},
-std::array<float,2>{0.927577198f, 0.878855467f},
-std::array<float,2>{0.134750739f, 0.279781431f},
-std::array<float,2>{0.000284315494f, 0.797889411f},
-std::array<float,2>{0.792007208f, 0.381613135f},
-std::array<float,2>{0.675857365f, 0.665274501f},
-std::array<float,2>{0.254984319f, 0.0436251871f},
-std::array<float,2>{0.452302694f, 0.870654166f},
-std::array<float,2>{0.576754808f, 0.445871055f},
-std::array<float,2>{0.964512467f, 0.727720678f},
-std::array<float,2>{0.244278252f, 0.0721391514f},
-std::array<float,2>{0.0653916448f, 0.602126241f},
-std::array<float,2>{0.85314393f, 0.127771422f},
-std::array<float,2>{0.738316f, 0.967892826f},
-std::array<float,2>{0.316453546f, 0.351511478f},
-std::array<float,2>{0.30382356f, 0.633970916f},
-std::array<float,2>{0.653728306f, 0.0165292826f},
-std::array<float,2>{0.764326453f, 0.760588944f},
-std::array<float,2>{0.0360901579f, 0.433490217f},
-std::array<float,2>{0.166786939f, 0.937468231f},
-std::array<float,2>{0.880439937f, 0.299060822f},
-std::array<float,2>{0.512312889f, 0.542268038f},
-std::array<float,2>{0.383098483f, 0.221767128f},
-std::array<float,2>{0.281081349f, 0.770829022f},
-std::array<float,2>{0.6701563f, 0.419459492f},
-std::array<float,2>{0.812216997f, 0.644309759f},
-std::array<float,2>{0.0278695393f, 0.00249783066f},
-std::array<float,2>{0.153474718f, 0.548183799f},
-std::array<float,2>{0.915404677f, 0.241017461f},
-std::array<float,2>{0.537193775f, 0.915789902f},
-std::array<float,2>{0.434098274f, 0.295103043f},
-std::array<float,2>{0.477901012f, 0.747206569f},
-std::array<float,2>{0.608186662f, 0.0830302909f},
-std::array<float,2>{0.982207f, 0.850892127f},
-std::array<float,2>{0.192592472f, 0.462834716f},
-std::array<float,2>{0.0941850767f, 0.941949129f},
-std::array<float,2>{0.814969957f, 0.366767019f},
-std::array<float,2>{0.689015746f, 0.610598087f},
-std::array<float,2>{0.365081489f, 0.152176842f},
-std::array<float,2>{0.398770034f, 0.899413049f},
-std::array<float,2>{0.523797691f, 0.265266776f},
-std::array<float,2>{0.898511767f, 0.519621193f},
-std::array<float,2>{0.184718698f, 0.207098082f},
-std::array<float,2>{0.0495607555f, 0.675611258f},
-std::array<float,2>{0.776382864f, 0.049260959f},
-std::array<float,2>{0.633945405f, 0.782645106f},
-std::array<float,2>{0.293322206f, 0.403011888f},
-std::array<float,2>{0.334739029f, 0.573708832f},
-std::array<float,2>{0.72332716f, 0.172364175f},
-std::array<float,2>{0.865392268f, 0.97626102f},
-std::array<float,2>{0.0872446746f, 0.338608623f},
-std::array<float,2>{0.230411291f, 0.842256904f},
-std::array<float,2>{0.950865448f, 0.473966122f},
-std::array<float,2>{0.589419723f, 0.696013689f},
-std::array<float,2>{0.459432662f, 0.115113214f},
-std::array<float,2>{0.281442672f, 0.91405493f},
-std::array<float,2>{0.632684946f, 0.286705941f},
-std::array<float,2>{0.768588781f, 0.557059526f},
-std::array<float,2>{0.055465024f, 0.247451067f},
-std::array<float,2>{0.17874819f, 0.652018726f},
-std::array<float,2>{0.892525673f, 0.0151019283f},
-std::array<float,2>{0.517743528f, 0.774091601f},
-std::array<float,2>{0.391913384f, 0.41294089f},
-std::array<float,2>{0.46553582f, 0.623513997f},
-std::array<float,2>{0.585830986f, 0.146747515f},
-std::array<float,2>{0.941273928f, 0.952685416f},
-std::array<float,2>{0.219359398f, 0.370143235f},
-std::array<float,2>{0.0792940557f, 0.85703212f},
-std::array<float,2>{0.874196291f, 0.454848588f},
-std::array<float,2>{0.727783501f, 0.735079229f},
-std::array<float,2>{0.338243037f, 0.0929396451f},
-std::array<float,2>{0.429048836f, 0.79480803f},
-std::array<float,2>{0.543246806f, 0.395814002f},
-std::array<float,2>{0.90814656f, 0.681574702f},
-std::array<float,2>{0.145584896f, 0.0552329719f},
-std::array<float,2>{0.0173437558f, 0.52858907f},
-std::array<float,2>{0.801095724f, 0.213378742f},
-std::array<float,2>{0.657974303f, 0.891766012f},
-std::array<float,2>{0.269473433f, 0.256379753f},
-std::array<float,2>{0.372325361f, 0.693067431f},
-std::array<float,2>{0.6959427f, 0.120445684f},
-std::array<float,2>{0.824824929f, 0.832988381f},
-std::array<float,2>{0.105454899f, 0.47687903f},
-std::array<float,2>{0.195806295f, 0.981075287f},
-std::array<float,2>{0.974747241f, 0.335714608f},
-std::array<float,2>{0.596380651f, 0.566437185f},
-std::array<float,2>{0.47642684f, 0.186414912f},
-std::array<float,2>{0.326407313f, 0.818749726f},
-std::array<float,2>{0.746820211f, 0.489724368f},
-std::array<float,2>{0.851303279f, 0.716155946f},
-std::array<float,2>{0.0741803944f, 0.10836941f},
-std::array<float,2>{0.241984308f, 0.587031722f},
-std::array<float,2>{0.960801542f, 0.166658461f},
-std::array<float,2>{0.568294942f, 0.997195303f},
-std::array<float,2>{0.443833828f, 0.320399612f},
-std::array<float,2>{0.382158726f, 0.661465645f},
-std::array<float,2>{0.507690847f, 0.0350167453f},
-std::array<float,2>{0.88872683f, 0.811422706f},
-std::array<float,2>{0.163449645f, 0.389359832f},
-std::array<float,2>{0.0436676964f, 0.885207236f},
-std::array<float,2>{0.754455864f, 0.266089648f},
-std::array<float,2>{0.644976974f, 0.502402902f},
-std::array<float,2>{0.311062366f, 0.202531025f},
-std::array<float,2>{0.495643198f, 0.955322087f},
-std::array<float,2>{0.619135082f, 0.353942782f},
-std::array<float,2>{0.990464866f, 0.596395493f},
-std::array<float,2>{0.215672463f, 0.136312917f},
-std::array<float,2>{0.119726673f, 0.722489178f},
-std::array<float,2>{0.835843444f, 0.0657776743f},
-std::array<float,2>{0.70391655f, 0.865727067f},
-std::array<float,2>{0.35111022f, 0.440963238f},
-std::array<float,2>{0.260056704f, 0.532509267f},
-std::array<float,2>{0.681524932f, 0.226696387f},
-std::array<float,2>{0.782279491f, 0.929496944f},
-std::array<float,2>{0.0129910372f, 0.310131997f},
-std::array<float,2>{0.125362813f, 0.753294826f},
-std::array<float,2>{0.937207162f, 0.423776895f},
-std::array<float,2>{0.557159126f, 0.630554795f},
-std::array<float,2>{0.414922208f, 0.024756806f},
-std::array<float,2>{0.354468673f, 0.878514767f},
-std::array<float,2>{0.712165892f, 0.279310167f},
-std::array<float,2>{0.840251386f, 0.512653887f},
-std::array<float,2>{0.111280419f, 0.190911353f},
-std::array<float,2>{0.205763683f, 0.665314376f},
-std::array<float,2>{0.992947698f, 0.0437571853f},
-std::array<float,2>{0.616653681f, 0.798186481f},
-std::array<float,2>{0.487273544f, 0.381432921f},
-std::array<float,2>{0.40894562f, 0.578602791f},
-std::array<float,2>{0.554085553f, 0.159968525f},
-std::array<float,2>{0.929659843f, 0.984855592f},
-std::array<float,2>{0.135476902f, 0.313268065f},
-std::array<float,2>{0.00386007968f, 0.821819127f},
-std::array<float,2>{0.789371789f, 0.499096751f},
-std::array<float,2>{0.679464221f, 0.705643773f},
-std::array<float,2>{0.257798225f, 0.0984382033f},
-std::array<float,2>{0.450279951f, 0.760488391f},
-std::array<float,2>{0.574351847f, 0.433224559f},
-std::array<float,2>{0.961732805f, 0.634226561f},
-std::array<float,2>{0.243055969f, 0.016200019f},
-std::array<float,2>{0.0638112798f, 0.542081356f},
-std::array<float,2>{0.854951084f, 0.222165823f},
-std::array<float,2>{0.741243482f, 0.937088788f},
-std::array<float,2>{0.320255965f, 0.299265116f},
-std::array<float,2>{0.300975472f, 0.727851629f},
-std::array<float,2>{0.654841304f, 0.0719473138f},
-std::array<float,2>{0.761913121f, 0.871060848f},
-std::array<float,2>{0.0382591411f, 0.446093261f},
-std::array<float,2>{0.164600134f, 0.968203247f},
-std::array<float,2>{0.88190186f, 0.351212054f},
-std::array<float,2>{0.515011668f, 0.602520347f},
-std::array<float,2>{0.385970414f, 0.12747471f},
-std::array<float,2>{0.277386934f, 0.850766361f},
-std::array<float,2>{0.668125749f, 0.46246314f},
-std::array<float,2>{0.809123158f, 0.747333288f},
-std::array<float,2>{0.0293153226f, 0.0834643543f},
-std::array<float,2>{0.154303953f, 0.610585868f},
-std::array<float,2>{0.916466355f, 0.151877195f},
-std::array<float,2>{0.536976218f, 0.942335665f},
-std::array<float,2>{0.436484694f, 0.367163301f},
-std::array<float,2>{0.480047673f, 0.644104779f},
-std::array<float,2>{0.605914295f, 0.00268989825f},
-std::array<float,2>{0.983376861f, 0.770555615f},
-std::array<float,2>{0.194537342f, 0.419751287f},
-std::array<float,2>{0.0973611996f, 0.915711224f},
-std::array<float,2>{0.812851727f, 0.295361489f},
-std::array<float,2>{0.69087106f, 0.547948658f},
-std::array<float,2>{0.36696735f, 0.240856647f},
-std::array<float,2>{0.400581986f, 0.976368725f},
-std::array<float,2>{0.526774406f, 0.338666171f},
-std::array<float,2>{0.901156187f, 0.573249161f},
-std::array<float,2>{0.187248766f, 0.172661096f},
-std::array<float,2>{0.0471067652f, 0.696204543f},
-std::array<float,2>{0.773967028f, 0.114903092f},
-std::array<float,2>{0.636490583f, 0.842007339f},
-std::array<float,2>{0.296188533f, 0.473691106f},
-std::array<float,2>{0.333610743f, 0.519932389f},
-std::array<float,2>{0.725261271f, 0.207447365f},
-std::array<float,2>{0.864370942f, 0.89912051f},
-std::array<float,2>{0.0892480835f, 0.265567273f},
-std::array<float,2>{0.228151187f, 0.782444417f},
-std::array<float,2>{0.951327503f, 0.403079778f},
-std::array<float,2>{0.586766183f, 0.675495088f},
-std::array<float,2>{0.458287179f, 0.0488406532f},
-std::array<float,2>{0.285056055f, 0.952960432f},
-std::array<float,2>{0.629517078f, 0.370497882f},
-std::array<float,2>{0.766318619f, 0.623132586f},
-std::array<float,2>{0.05699398f, 0.146662146f},
-std::array<float,2>{0.177194521f, 0.73518461f},
-std::array<float,2>{0.894308031f, 0.0931583568f},
-std::array<float,2>{0.517351925f, 0.857343733f},
-std::array<float,2>{0.394002259f, 0.454830736f},
-std::array<float,2>{0.467876941f, 0.556855619f},
-std::array<float,2>{0.582800806f, 0.247094035f},
-std::array<float,2>{0.938739598f, 0.913796425f},
-std::array<float,2>{0.222339183f, 0.286924183f},
-std::array<float,2>{0.0813876987f, 0.774409294f},
-std::array<float,2>{0.872790277f, 0.412664175f},
-std::array<float,2>{0.730340004f, 0.652256906f},
-std::array<float,2>{0.336749405f, 0.0148300668f},
-std::array<float,2>{0.427704871f, 0.832676649f},
-std::array<float,2>{0.545639813f, 0.476615906f},
-std::array<float,2>{0.908895612f, 0.693289161f},
-std::array<float,2>{0.147761717f, 0.120256729f},
-std::array<float,2>{0.0186474863f, 0.566863656f},
-std::array<float,2>{0.803790033f, 0.186266914f},
-std::array<float,2>{0.659185648f, 0.981336355f},
-std::array<float,2>{0.26634413f, 0.335494339f},
-std::array<float,2>{0.37426427f, 0.681307256f},
-std::array<float,2>{0.698544741f, 0.055488769f},
-std::array<float,2>{0.827092946f, 0.79445076f},
-std::array<float,2>{0.103229776f, 0.395723253f},
-std::array<float,2>{0.197687045f, 0.892056704f},
-std::array<float,2>{0.973266006f, 0.256816924f},
-std::array<float,2>{0.594683826f, 0.528381765f},
-std::array<float,2>{0.474560469f, 0.213016182f},
-std::array<float,2>{0.325253516f, 0.811069071f},
-std::array<float,2>{0.748312891f, 0.38945058f},
-std::array<float,2>{0.848302603f, 0.661340356f},
-std::array<float,2>{0.0719740018f, 0.034842547f},
-std::array<float,2>{0.239961609f, 0.502073944f},
-std::array<float,2>{0.957989514f, 0.202223271f},
-std::array<float,2>{0.569157302f, 0.884906054f},
-std::array<float,2>{0.443134189f, 0.265627414f},
-std::array<float,2>{0.379096389f, 0.715955496f},
-std::array<float,2>{0.50412482f, 0.108143188f},
-std::array<float,2>{0.888187468f, 0.818465054f},
-std::array<float,2>{0.161157638f, 0.489367515f},
-std::array<float,2>{0.0461181998f, 0.997347236f},
-std::array<float,2>{0.756427169f, 0.320625931f},
-std::array<float,2>{0.647512197f, 0.587190211f},
-std::array<float,2>{0.309985042f, 0.166790053f},
-std::array<float,2>{0.493377894f, 0.929220855f},
-std::array<float,2>{0.619352698f, 0.310413957f},
-std::array<float,2>{0.989823401f, 0.532456875f},
-std::array<float,2>{0.217332065f, 0.226891637f},
-std::array<float,2>{0.118589714f, 0.630771756f},
-std::array<float,2>{0.83241576f, 0.0244365577f},
-std::array<float,2>{0.706939161f, 0.753171682f},
-std::array<float,2>{0.347681761f, 0.42340821f},
-std::array<float,2>{0.258250147f, 0.596550047f},
-std::array<float,2>{0.683426797f, 0.13652803f},
-std::array<float,2>{0.78500551f, 0.955405712f},
-std::array<float,2>{0.0144635094f, 0.353690416f},
-std::array<float,2>{0.127529427f, 0.866075039f},
-std::array<float,2>{0.934705734f, 0.441382259f},
-std::array<float,2>{0.554792881f, 0.72235918f},
-std::array<float,2>{0.416978836f, 0.0655302778f},
-std::array<float,2>{0.343405038f, 0.990877151f},
-std::array<float,2>{0.732752264f, 0.318544924f},
-std::array<float,2>{0.868323445f, 0.584271014f},
-std::array<float,2>{0.0848406777f, 0.160766408f},
-std::array<float,2>{0.223760679f, 0.707629919f},
-std::array<float,2>{0.942454875f, 0.09499152f},
-std::array<float,2>{0.57825011f, 0.828010499f},
-std::array<float,2>{0.462729156f, 0.493308008f},
-std::array<float,2>{0.39734602f, 0.508258283f},
-std::array<float,2>{0.522752047f, 0.19187583f},
-std::array<float,2>{0.89795661f, 0.880541861f},
-std::array<float,2>{0.175072357f, 0.276696831f},
-std::array<float,2>{0.0622151047f, 0.803225636f},
-std::array<float,2>{0.772637725f, 0.378573418f},
-std::array<float,2>{0.625383139f, 0.669743359f},
-std::array<float,2>{0.286835581f, 0.0426631533f},
-std::array<float,2>{0.469982028f, 0.873352706f},
-std::array<float,2>{0.600044847f, 0.450620115f},
-std::array<float,2>{0.969148636f, 0.73305285f},
-std::array<float,2>{0.20109345f, 0.0758406445f},
-std::array<float,2>{0.106291227f, 0.608702362f},
-std::array<float,2>{0.822695494f, 0.130153507f},
-std::array<float,2>{0.700564265f, 0.961641967f},
-std::array<float,2>{0.368407875f, 0.343998432f},
-std::array<float,2>{0.270769358f, 0.638244271f},
-std::array<float,2>{0.660303295f, 0.0209623892f},
-std::array<float,2>{0.799806058f, 0.761992455f},
-std::array<float,2>{0.0234149024f, 0.433769941f},
-std::array<float,2>{0.142147735f, 0.930508256f},
-std::array<float,2>{0.911128998f, 0.301839828f},
-std::array<float,2>{0.541971624f, 0.546696663f},
-std::array<float,2>{0.423199832f, 0.225060165f},
-std::array<float,2>{0.305736363f, 0.766020238f},
-std::array<float,2>{0.643891215f, 0.414485216f},
-std::array<float,2>{0.753759146f, 0.647308111f},
-std::array<float,2>{0.0402687266f, 0.00683501502f},
-std::array<float,2>{0.15653412f, 0.552385569f},
-std::array<float,2>{0.88329345f, 0.237579659f},
-std::array<float,2>{0.503431499f, 0.919879258f},
-std::array<float,2>{0.377962232f, 0.292342842f},
-std::array<float,2>{0.439761132f, 0.743264318f},
-std::array<float,2>{0.562714875f, 0.0812608823f},
-std::array<float,2>{0.955459177f, 0.845601976f},
-std::array<float,2>{0.235572204f, 0.4654589f},
-std::array<float,2>{0.0779437348f, 0.941218972f},
-std::array<float,2>{0.844423532f, 0.362675726f},
-std::array<float,2>{0.745346069f, 0.616648316f},
-std::array<float,2>{0.32321927f, 0.155990988f},
-std::array<float,2>{0.419449657f, 0.903419673f},
-std::array<float,2>{0.561837375f, 0.258940518f},
-std::array<float,2>{0.930989504f, 0.516273081f},
-std::array<float,2>{0.130372018f, 0.204960212f},
-std::array<float,2>{0.00842484832f, 0.677700579f},
-std::array<float,2>{0.788755f, 0.0546387918f},
-std::array<float,2>{0.685228705f, 0.787381649f},
-std::array<float,2>{0.263659418f, 0.398477197f},
-std::array<float,2>{0.345503241f, 0.575812161f},
-std::array<float,2>{0.708785713f, 0.177426934f},
-std::array<float,2>{0.829030991f, 0.97216177f},
-std::array<float,2>{0.122422941f, 0.343324631f},
-std::array<float,2>{0.213369027f, 0.83886987f},
-std::array<float,2>{0.984660923f, 0.47043404f},
-std::array<float,2>{0.623115778f, 0.699385703f},
-std::array<float,2>{0.498377174f, 0.110502578f},
-std::array<float,2>{0.251505345f, 0.909031391f},
-std::array<float,2>{0.675298214f, 0.28344208f},
-std::array<float,2>{0.796046972f, 0.560156882f},
-std::array<float,2>{0.0043007494f, 0.243773222f},
-std::array<float,2>{0.137286738f, 0.655499041f},
-std::array<float,2>{0.925768077f, 0.00935436971f},
-std::array<float,2>{0.548723519f, 0.780742168f},
-std::array<float,2>{0.413693756f, 0.407207549f},
-std::array<float,2>{0.488449037f, 0.618696868f},
-std::array<float,2>{0.611270308f, 0.142564148f},
-std::array<float,2>{0.997148812f, 0.946628213f},
-std::array<float,2>{0.209756389f, 0.374840856f},
-std::array<float,2>{0.115946881f, 0.852630854f},
-std::array<float,2>{0.837456942f, 0.457948327f},
-std::array<float,2>{0.716903567f, 0.739579976f},
-std::array<float,2>{0.359124422f, 0.0870369747f},
-std::array<float,2>{0.3874681f, 0.79151547f},
-std::array<float,2>{0.511142731f, 0.392886937f},
-std::array<float,2>{0.875712633f, 0.685491025f},
-std::array<float,2>{0.169282258f, 0.060274832f},
-std::array<float,2>{0.0344061255f, 0.525832534f},
-std::array<float,2>{0.761497498f, 0.215116262f},
-std::array<float,2>{0.649818599f, 0.896659791f},
-std::array<float,2>{0.299808204f, 0.251557946f},
-std::array<float,2>{0.314619541f, 0.691156268f},
-std::array<float,2>{0.736044347f, 0.122620516f},
-std::array<float,2>{0.856170714f, 0.828657985f},
-std::array<float,2>{0.0676253811f, 0.482778966f},
-std::array<float,2>{0.246515185f, 0.978756011f},
-std::array<float,2>{0.967978656f, 0.330349267f},
-std::array<float,2>{0.571152091f, 0.562544525f},
-std::array<float,2>{0.445380777f, 0.180609807f},
-std::array<float,2>{0.360342085f, 0.812897921f},
-std::array<float,2>{0.691436172f, 0.484690964f},
-std::array<float,2>{0.819626391f, 0.714587569f},
-std::array<float,2>{0.0983304754f, 0.10336028f},
-std::array<float,2>{0.190189391f, 0.591894031f},
-std::array<float,2>{0.977059603f, 0.169373885f},
-std::array<float,2>{0.602495313f, 0.993290246f},
-std::array<float,2>{0.482093751f, 0.327045441f},
-std::array<float,2>{0.433166325f, 0.658861816f},
-std::array<float,2>{0.532503486f, 0.0390176848f},
-std::array<float,2>{0.918289959f, 0.808520436f},
-std::array<float,2>{0.150931433f, 0.383860916f},
-std::array<float,2>{0.0260664672f, 0.888908029f},
-std::array<float,2>{0.805462718f, 0.27321893f},
-std::array<float,2>{0.666462421f, 0.50592041f},
-std::array<float,2>{0.277118981f, 0.196899503f},
-std::array<float,2>{0.453752697f, 0.960068822f},
-std::array<float,2>{0.589962065f, 0.355470002f},
-std::array<float,2>{0.947314024f, 0.600108027f},
-std::array<float,2>{0.230957747f, 0.137065485f},
-std::array<float,2>{0.0908686146f, 0.725195408f},
-std::array<float,2>{0.862602055f, 0.0677550808f},
-std::array<float,2>{0.720993578f, 0.859765172f},
-std::array<float,2>{0.329402328f, 0.44267413f},
-std::array<float,2>{0.291836083f, 0.537069023f},
-std::array<float,2>{0.637266755f, 0.231927052f},
-std::array<float,2>{0.780101776f, 0.923097074f},
-std::array<float,2>{0.0541380532f, 0.307412535f},
-std::array<float,2>{0.183510557f, 0.757632554f},
-std::array<float,2>{0.90326798f, 0.426797777f},
-std::array<float,2>{0.527715445f, 0.627965987f},
-std::array<float,2>{0.402432173f, 0.0296730418f},
-std::array<float,2>{0.317831218f, 0.935100317f},
-std::array<float,2>{0.739976823f, 0.298020691f},
-std::array<float,2>{0.852124393f, 0.539731383f},
-std::array<float,2>{0.0654810145f, 0.219704211f},
-std::array<float,2>{0.245815247f, 0.636187434f},
-std::array<float,2>{0.962915897f, 0.0185663849f},
-std::array<float,2>{0.577445388f, 0.759089947f},
-std::array<float,2>{0.451445907f, 0.430343002f},
-std::array<float,2>{0.384656429f, 0.604592025f},
-std::array<float,2>{0.513044477f, 0.126194477f},
-std::array<float,2>{0.87984395f, 0.965123355f},
-std::array<float,2>{0.167509004f, 0.349133372f},
-std::array<float,2>{0.0370295309f, 0.867385566f},
-std::array<float,2>{0.765242398f, 0.44828096f},
-std::array<float,2>{0.652825892f, 0.729414165f},
-std::array<float,2>{0.303099692f, 0.0728504807f},
-std::array<float,2>{0.48589769f, 0.799134612f},
-std::array<float,2>{0.614759862f, 0.380178541f},
-std::array<float,2>{0.995113432f, 0.666764915f},
-std::array<float,2>{0.204332888f, 0.0465604104f},
-std::array<float,2>{0.11197976f, 0.513764441f},
-std::array<float,2>{0.842105448f, 0.189398512f},
-std::array<float,2>{0.713780463f, 0.87553972f},
-std::array<float,2>{0.351893663f, 0.278883636f},
-std::array<float,2>{0.254328132f, 0.704239428f},
-std::array<float,2>{0.676849782f, 0.100504287f},
-std::array<float,2>{0.791136444f, 0.823913813f},
-std::array<float,2>{0.00178811501f, 0.496621341f},
-std::array<float,2>{0.133144364f, 0.986901402f},
-std::array<float,2>{0.926306665f, 0.315138459f},
-std::array<float,2>{0.550804734f, 0.581135094f},
-std::array<float,2>{0.407103509f, 0.158037245f},
-std::array<float,2>{0.294022948f, 0.840969682f},
-std::array<float,2>{0.633073449f, 0.475470304f},
-std::array<float,2>{0.775537193f, 0.698012352f},
-std::array<float,2>{0.0501506031f, 0.115799516f},
-std::array<float,2>{0.184541613f, 0.572061002f},
-std::array<float,2>{0.899739802f, 0.174176693f},
-std::array<float,2>{0.525381029f, 0.974304736f},
-std::array<float,2>{0.399766535f, 0.33642754f},
-std::array<float,2>{0.46075055f, 0.673237503f},
-std::array<float,2>{0.588279963f, 0.0487669893f},
-std::array<float,2>{0.949714184f, 0.783639491f},
-std::array<float,2>{0.228941336f, 0.405004025f},
-std::array<float,2>{0.0867858082f, 0.90233773f},
-std::array<float,2>{0.866966665f, 0.263295889f},
-std::array<float,2>{0.723762691f, 0.522629142f},
-std::array<float,2>{0.335609019f, 0.209448814f},
-std::array<float,2>{0.434965342f, 0.944827497f},
-std::array<float,2>{0.538871944f, 0.364560664f},
-std::array<float,2>{0.914865732f, 0.611905396f},
-std::array<float,2>{0.152449757f, 0.14891839f},
-std::array<float,2>{0.0285911039f, 0.749914229f},
-std::array<float,2>{0.810694516f, 0.0849893615f},
-std::array<float,2>{0.671793938f, 0.849343181f},
-std::array<float,2>{0.280243039f, 0.464580655f},
-std::array<float,2>{0.364113241f, 0.549990118f},
-std::array<float,2>{0.687798738f, 0.239701629f},
-std::array<float,2>{0.815655887f, 0.916056693f},
-std::array<float,2>{0.0952512994f, 0.294841945f},
-std::array<float,2>{0.191453636f, 0.773292124f},
-std::array<float,2>{0.980936706f, 0.420456856f},
-std::array<float,2>{0.608830154f, 0.641549349f},
-std::array<float,2>{0.476586044f, 8.0441132e-05f},
-std::array<float,2>{0.268366158f, 0.98326385f},
-std::array<float,2>{0.6565907f, 0.332615137f},
-std::array<float,2>{0.802175462f, 0.568501115f},
-std::array<float,2>{0.0158633906f, 0.184463337f},
-std::array<float,2>{0.145268962f, 0.694341242f},
-std::array<float,2>{0.906922579f, 0.117756359f},
-std::array<float,2>{0.544008017f, 0.834204376f},
-std::array<float,2>{0.428196996f, 0.479271799f},
-std::array<float,2>{0.474765331f, 0.530245781f},
-std::array<float,2>{0.59679389f, 0.211508945f},
-std::array<float,2>{0.976485312f, 0.893946767f},
-std::array<float,2>{0.196619615f, 0.255525053f},
-std::array<float,2>{0.103799835f, 0.795900643f},
-std::array<float,2>{0.825703561f, 0.396585345f},
-std::array<float,2>{0.697045922f, 0.682688057f},
-std::array<float,2>{0.371556431f, 0.0569707789f},
-std::array<float,2>{0.391082287f, 0.857690156f},
-std::array<float,2>{0.519071341f, 0.456674993f},
-std::array<float,2>{0.891297579f, 0.736985147f},
-std::array<float,2>{0.17843768f, 0.0913315341f},
-std::array<float,2>{0.0565489233f, 0.62163496f},
-std::array<float,2>{0.767791986f, 0.146400556f},
-std::array<float,2>{0.630944312f, 0.949824691f},
-std::array<float,2>{0.282912135f, 0.367605746f},
-std::array<float,2>{0.339340895f, 0.648456395f},
-std::array<float,2>{0.727422178f, 0.0126072308f},
-std::array<float,2>{0.873314202f, 0.776273787f},
-std::array<float,2>{0.0783824772f, 0.411118001f},
-std::array<float,2>{0.22018759f, 0.910500884f},
-std::array<float,2>{0.939495385f, 0.287655592f},
-std::array<float,2>{0.58459866f, 0.556358457f},
-std::array<float,2>{0.466090858f, 0.248322546f},
-std::array<float,2>{0.350336492f, 0.75132513f},
-std::array<float,2>{0.704146504f, 0.424196512f},
-std::array<float,2>{0.83457154f, 0.631535113f},
-std::array<float,2>{0.120700791f, 0.025648633f},
-std::array<float,2>{0.216660708f, 0.534277558f},
-std::array<float,2>{0.991372526f, 0.230122775f},
-std::array<float,2>{0.61812067f, 0.926581204f},
-std::array<float,2>{0.494382709f, 0.310687721f},
-std::array<float,2>{0.415263414f, 0.720235109f},
-std::array<float,2>{0.558372974f, 0.0629709661f},
-std::array<float,2>{0.93578589f, 0.864093542f},
-std::array<float,2>{0.126932248f, 0.438946873f},
-std::array<float,2>{0.0126097323f, 0.954941392f},
-std::array<float,2>{0.781551421f, 0.352683663f},
-std::array<float,2>{0.680372715f, 0.594258606f},
-std::array<float,2>{0.261577636f, 0.133886606f},
-std::array<float,2>{0.444396257f, 0.882882595f},
-std::array<float,2>{0.567039192f, 0.268129528f},
-std::array<float,2>{0.959937751f, 0.501168311f},
-std::array<float,2>{0.240995869f, 0.20072788f},
-std::array<float,2>{0.072522223f, 0.663189292f},
-std::array<float,2>{0.849844456f, 0.0319449715f},
-std::array<float,2>{0.747362316f, 0.809770286f},
-std::array<float,2>{0.327625543f, 0.387144059f},
-std::array<float,2>{0.311947793f, 0.588863432f},
-std::array<float,2>{0.645621061f, 0.165310293f},
-std::array<float,2>{0.755429327f, 0.998594224f},
-std::array<float,2>{0.0440651961f, 0.322952837f},
-std::array<float,2>{0.162561178f, 0.816655099f},
-std::array<float,2>{0.889960408f, 0.490260631f},
-std::array<float,2>{0.506698906f, 0.716963947f},
-std::array<float,2>{0.381048858f, 0.106000386f},
-std::array<float,2>{0.369838327f, 0.962893844f},
-std::array<float,2>{0.701385915f, 0.347346604f},
-std::array<float,2>{0.820759594f, 0.605996251f},
-std::array<float,2>{0.109294258f, 0.131474331f},
-std::array<float,2>{0.202484041f, 0.730790913f},
-std::array<float,2>{0.971592724f, 0.0777447522f},
-std::array<float,2>{0.59788388f, 0.872443914f},
-std::array<float,2>{0.470885664f, 0.451719642f},
-std::array<float,2>{0.424813509f, 0.544707358f},
-std::array<float,2>{0.539892375f, 0.223953947f},
-std::array<float,2>{0.912229657f, 0.932899594f},
-std::array<float,2>{0.14314425f, 0.304266006f},
-std::array<float,2>{0.01995207f, 0.765397906f},
-std::array<float,2>{0.797125041f, 0.435913116f},
-std::array<float,2>{0.663964272f, 0.638828158f},
-std::array<float,2>{0.272239596f, 0.0216627568f},
-std::array<float,2>{0.463811517f, 0.826058447f},
-std::array<float,2>{0.580138922f, 0.495155543f},
-std::array<float,2>{0.945053518f, 0.710288882f},
-std::array<float,2>{0.226293236f, 0.0973874629f},
-std::array<float,2>{0.0828641877f, 0.5827052f},
-std::array<float,2>{0.869489133f, 0.162326396f},
-std::array<float,2>{0.73133862f, 0.988598704f},
-std::array<float,2>{0.339997828f, 0.317164361f},
-std::array<float,2>{0.287855834f, 0.670105398f},
-std::array<float,2>{0.627821326f, 0.0395527594f},
-std::array<float,2>{0.771241665f, 0.801671326f},
-std::array<float,2>{0.0589462556f, 0.375196993f},
-std::array<float,2>{0.172849566f, 0.88212055f},
-std::array<float,2>{0.895756185f, 0.274994075f},
-std::array<float,2>{0.520161927f, 0.510315537f},
-std::array<float,2>{0.395781368f, 0.195212573f},
-std::array<float,2>{0.264618218f, 0.785679162f},
-std::array<float,2>{0.686641991f, 0.401524276f},
-std::array<float,2>{0.786015391f, 0.678514302f},
-std::array<float,2>{0.0108754085f, 0.0525721237f},
-std::array<float,2>{0.130969778f, 0.517762125f},
-std::array<float,2>{0.931693196f, 0.205653012f},
-std::array<float,2>{0.559643924f, 0.906102598f},
-std::array<float,2>{0.420793205f, 0.2608926f},
-std::array<float,2>{0.49759686f, 0.702212811f},
-std::array<float,2>{0.621325672f, 0.113133028f},
-std::array<float,2>{0.987008572f, 0.836861193f},
-std::array<float,2>{0.211352244f, 0.472100139f},
-std::array<float,2>{0.123209901f, 0.97015357f},
-std::array<float,2>{0.830973148f, 0.341272652f},
-std::array<float,2>{0.709864438f, 0.576557577f},
-std::array<float,2>{0.346929282f, 0.179369643f},
-std::array<float,2>{0.376443684f, 0.920260072f},
-std::array<float,2>{0.501454651f, 0.289474964f},
-std::array<float,2>{0.885053933f, 0.552907228f},
-std::array<float,2>{0.15885067f, 0.235707089f},
-std::array<float,2>{0.0418227836f, 0.644847691f},
-std::array<float,2>{0.75025928f, 0.00583392149f},
-std::array<float,2>{0.642125905f, 0.769181669f},
-std::array<float,2>{0.308412969f, 0.416268706f},
-std::array<float,2>{0.321211576f, 0.614843249f},
-std::array<float,2>{0.742447078f, 0.153499171f},
-std::array<float,2>{0.846742272f, 0.938028693f},
-std::array<float,2>{0.0743258223f, 0.360970527f},
-std::array<float,2>{0.23670505f, 0.847441494f},
-std::array<float,2>{0.954493225f, 0.467565656f},
-std::array<float,2>{0.565862775f, 0.744666636f},
-std::array<float,2>{0.438610762f, 0.0796699822f},
-std::array<float,2>{0.297269285f, 0.896069229f},
-std::array<float,2>{0.651681662f, 0.25312084f},
-std::array<float,2>{0.758762777f, 0.524253368f},
-std::array<float,2>{0.0321092568f, 0.217858911f},
-std::array<float,2>{0.170087352f, 0.686739981f},
-std::array<float,2>{0.87776345f, 0.0608871505f},
-std::array<float,2>{0.509652913f, 0.79006052f},
-std::array<float,2>{0.390381724f, 0.392484009f},
-std::array<float,2>{0.44740364f, 0.564857125f},
-std::array<float,2>{0.573277652f, 0.182882413f},
-std::array<float,2>{0.965708613f, 0.978263378f},
-std::array<float,2>{0.248208359f, 0.32852158f},
-std::array<float,2>{0.0699535012f, 0.83015728f},
-std::array<float,2>{0.859177172f, 0.482296526f},
-std::array<float,2>{0.736476839f, 0.687748611f},
-std::array<float,2>{0.312770754f, 0.12454138f},
-std::array<float,2>{0.411690176f, 0.777763546f},
-std::array<float,2>{0.549883604f, 0.408637136f},
-std::array<float,2>{0.922922373f, 0.65309304f},
-std::array<float,2>{0.139157921f, 0.0100383908f},
-std::array<float,2>{0.00626308518f, 0.561098099f},
-std::array<float,2>{0.794293165f, 0.244845524f},
-std::array<float,2>{0.673756182f, 0.907251656f},
-std::array<float,2>{0.253081203f, 0.282446355f},
-std::array<float,2>{0.357372969f, 0.741812706f},
-std::array<float,2>{0.715810537f, 0.0883081481f},
-std::array<float,2>{0.838660121f, 0.853538036f},
-std::array<float,2>{0.113290533f, 0.459608793f},
-std::array<float,2>{0.207272872f, 0.947395682f},
-std::array<float,2>{0.998153687f, 0.371334046f},
-std::array<float,2>{0.612630546f, 0.621051669f},
-std::array<float,2>{0.491645724f, 0.143239915f},
-std::array<float,2>{0.330962509f, 0.86208266f},
-std::array<float,2>{0.719975948f, 0.443921089f},
-std::array<float,2>{0.860826254f, 0.724189758f},
-std::array<float,2>{0.0928876251f, 0.0688242987f},
-std::array<float,2>{0.232969508f, 0.597950578f},
-std::array<float,2>{0.945663035f, 0.139545441f},
-std::array<float,2>{0.593530595f, 0.957347155f},
-std::array<float,2>{0.456506997f, 0.357746422f},
-std::array<float,2>{0.405532986f, 0.626438797f},
-std::array<float,2>{0.53075707f, 0.028463982f},
-std::array<float,2>{0.905737758f, 0.75544101f},
-std::array<float,2>{0.180660829f, 0.428781807f},
-std::array<float,2>{0.0526824109f, 0.924166799f},
-std::array<float,2>{0.77920258f, 0.306537867f},
-std::array<float,2>{0.640559137f, 0.538627326f},
-std::array<float,2>{0.289506078f, 0.233786389f},
-std::array<float,2>{0.482952952f, 0.99534595f},
-std::array<float,2>{0.604149878f, 0.326123625f},
-std::array<float,2>{0.979320228f, 0.590317845f},
-std::array<float,2>{0.189166978f, 0.170962781f},
-std::array<float,2>{0.0999331549f, 0.711809516f},
-std::array<float,2>{0.816450834f, 0.104881592f},
-std::array<float,2>{0.694692314f, 0.815475285f},
-std::array<float,2>{0.362993479f, 0.487692118f},
-std::array<float,2>{0.274252504f, 0.503916264f},
-std::array<float,2>{0.66565901f, 0.198094502f},
-std::array<float,2>{0.808299124f, 0.887995422f},
-std::array<float,2>{0.0249588098f, 0.270130962f},
-std::array<float,2>{0.14983663f, 0.804706633f},
-std::array<float,2>{0.920642197f, 0.386313677f},
-std::array<float,2>{0.534725368f, 0.657340467f},
-std::array<float,2>{0.430963755f, 0.0367745347f},
-std::array<float,2>{0.365299165f, 0.916997492f},
-std::array<float,2>{0.690192759f, 0.293640643f},
-std::array<float,2>{0.813943505f, 0.549235046f},
-std::array<float,2>{0.0957047716f, 0.239030406f},
-std::array<float,2>{0.194162741f, 0.642244518f},
-std::array<float,2>{0.98365581f, 0.00132441579f},
-std::array<float,2>{0.606887937f, 0.771606266f},
-std::array<float,2>{0.478871435f, 0.421600848f},
-std::array<float,2>{0.437434494f, 0.612564623f},
-std::array<float,2>{0.535311103f, 0.149563551f},
-std::array<float,2>{0.917850971f, 0.943934977f},
-std::array<float,2>{0.15554668f, 0.363814503f},
-std::array<float,2>{0.030795211f, 0.848018885f},
-std::array<float,2>{0.81010437f, 0.463013947f},
-std::array<float,2>{0.669363856f, 0.748909175f},
-std::array<float,2>{0.278626502f, 0.0847362131f},
-std::array<float,2>{0.45784232f, 0.78488183f},
-std::array<float,2>{0.587469578f, 0.406003505f},
-std::array<float,2>{0.952428997f, 0.672700346f},
-std::array<float,2>{0.227286145f, 0.0473908372f},
-std::array<float,2>{0.0884274021f, 0.521721065f},
-std::array<float,2>{0.863873661f, 0.210318491f},
-std::array<float,2>{0.726225078f, 0.900410354f},
-std::array<float,2>{0.332329065f, 0.262266278f},
-std::array<float,2>{0.295674115f, 0.698717952f},
-std::array<float,2>{0.634826481f, 0.1165516f},
-std::array<float,2>{0.774524391f, 0.840013862f},
-std::array<float,2>{0.0481336936f, 0.476021826f},
-std::array<float,2>{0.185878232f, 0.972814977f},
-std::array<float,2>{0.902156889f, 0.337845027f},
-std::array<float,2>{0.525590181f, 0.571183562f},
-std::array<float,2>{0.402062505f, 0.175353333f},
-std::array<float,2>{0.256803989f, 0.82244122f},
-std::array<float,2>{0.677812457f, 0.497089684f},
-std::array<float,2>{0.790290475f, 0.703170896f},
-std::array<float,2>{0.00283519644f, 0.100982107f},
-std::array<float,2>{0.13616012f, 0.580338717f},
-std::array<float,2>{0.928394318f, 0.156258628f},
-std::array<float,2>{0.552892148f, 0.987459242f},
-std::array<float,2>{0.409933954f, 0.316028386f},
-std::array<float,2>{0.487854511f, 0.667860806f},
-std::array<float,2>{0.615264416f, 0.0458479486f},
-std::array<float,2>{0.993331492f, 0.800252676f},
-std::array<float,2>{0.206759289f, 0.379868746f},
-std::array<float,2>{0.10952086f, 0.87677896f},
-std::array<float,2>{0.841728806f, 0.278039753f},
-std::array<float,2>{0.711019218f, 0.515150726f},
-std::array<float,2>{0.354841948f, 0.188160673f},
-std::array<float,2>{0.385148942f, 0.965948939f},
-std::array<float,2>{0.514437079f, 0.347926825f},
-std::array<float,2>{0.881699145f, 0.604456663f},
-std::array<float,2>{0.165318385f, 0.125829428f},
-std::array<float,2>{0.0379738919f, 0.729554892f},
-std::array<float,2>{0.763591409f, 0.0740925446f},
-std::array<float,2>{0.655661404f, 0.868181348f},
-std::array<float,2>{0.301855177f, 0.447440982f},
-std::array<float,2>{0.318829447f, 0.540751696f},
-std::array<float,2>{0.740940034f, 0.220096231f},
-std::array<float,2>{0.854302108f, 0.933963537f},
-std::array<float,2>{0.0630960613f, 0.297301859f},
-std::array<float,2>{0.243773013f, 0.758360803f},
-std::array<float,2>{0.962458253f, 0.431526482f},
-std::array<float,2>{0.575502038f, 0.63508898f},
-std::array<float,2>{0.449784219f, 0.0179838724f},
-std::array<float,2>{0.309458345f, 0.999640226f},
-std::array<float,2>{0.646911085f, 0.323495209f},
-std::array<float,2>{0.757697582f, 0.589677632f},
-std::array<float,2>{0.0450391807f, 0.164722905f},
-std::array<float,2>{0.160439357f, 0.717949212f},
-std::array<float,2>{0.886808515f, 0.107050255f},
-std::array<float,2>{0.505805075f, 0.818240285f},
-std::array<float,2>{0.38036117f, 0.492086709f},
-std::array<float,2>{0.441882461f, 0.500761509f},
-std::array<float,2>{0.56968528f, 0.19947274f},
-std::array<float,2>{0.958759248f, 0.884734988f},
-std::array<float,2>{0.23838836f, 0.269476652f},
-std::array<float,2>{0.0703666285f, 0.80933553f},
-std::array<float,2>{0.849347711f, 0.388506502f},
-std::array<float,2>{0.749088228f, 0.662449121f},
-std::array<float,2>{0.324374408f, 0.0329835825f},
-std::array<float,2>{0.417352289f, 0.865083098f},
-std::array<float,2>{0.555758357f, 0.438268811f},
-std::array<float,2>{0.933804929f, 0.719709396f},
-std::array<float,2>{0.128184617f, 0.0636653006f},
-std::array<float,2>{0.0154803973f, 0.595413864f},
-std::array<float,2>{0.783995688f, 0.133525893f},
-std::array<float,2>{0.682000756f, 0.953948617f},
-std::array<float,2>{0.258935988f, 0.35178414f},
-std::array<float,2>{0.348882973f, 0.631872773f},
-std::array<float,2>{0.705237627f, 0.027314784f},
-std::array<float,2>{0.833415568f, 0.750137389f},
-std::array<float,2>{0.117624946f, 0.424868703f},
-std::array<float,2>{0.218295276f, 0.927626729f},
-std::array<float,2>{0.98834455f, 0.311968774f},
-std::array<float,2>{0.620306313f, 0.534031868f},
-std::array<float,2>{0.492581874f, 0.228547111f},
-std::array<float,2>{0.337292016f, 0.776369989f},
-std::array<float,2>{0.728863597f, 0.411756307f},
-std::array<float,2>{0.872031868f, 0.649545133f},
-std::array<float,2>{0.0805891305f, 0.0130746718f},
-std::array<float,2>{0.221206382f, 0.555224001f},
-std::array<float,2>{0.938420534f, 0.249798611f},
-std::array<float,2>{0.583925486f, 0.911706746f},
-std::array<float,2>{0.467136651f, 0.288987011f},
-std::array<float,2>{0.393229514f, 0.737389028f},
-std::array<float,2>{0.516131341f, 0.0901993066f},
-std::array<float,2>{0.892757237f, 0.858976543f},
-std::array<float,2>{0.17587918f, 0.455986559f},
-std::array<float,2>{0.0581224337f, 0.950500369f},
-std::array<float,2>{0.767263949f, 0.368701398f},
-std::array<float,2>{0.63084048f, 0.622443497f},
-std::array<float,2>{0.283849746f, 0.145301342f},
-std::array<float,2>{0.473232329f, 0.892970502f},
-std::array<float,2>{0.595517516f, 0.254426658f},
-std::array<float,2>{0.97428453f, 0.530823827f},
-std::array<float,2>{0.198621258f, 0.211950824f},
-std::array<float,2>{0.102516428f, 0.682485521f},
-std::array<float,2>{0.827483654f, 0.0580877848f},
-std::array<float,2>{0.697668493f, 0.795268714f},
-std::array<float,2>{0.373920679f, 0.398323387f},
-std::array<float,2>{0.266633123f, 0.570083559f},
-std::array<float,2>{0.658434868f, 0.184900969f},
-std::array<float,2>{0.803592563f, 0.984211504f},
-std::array<float,2>{0.0179946367f, 0.333113462f},
-std::array<float,2>{0.146688491f, 0.835811377f},
-std::array<float,2>{0.909969866f, 0.47949636f},
-std::array<float,2>{0.546622634f, 0.693821132f},
-std::array<float,2>{0.426653206f, 0.119111456f},
-std::array<float,2>{0.323717147f, 0.93873018f},
-std::array<float,2>{0.744518936f, 0.359794855f},
-std::array<float,2>{0.844732165f, 0.613963902f},
-std::array<float,2>{0.077041775f, 0.153192535f},
-std::array<float,2>{0.235303611f, 0.745678544f},
-std::array<float,2>{0.956710458f, 0.0789679214f},
-std::array<float,2>{0.564312458f, 0.845837474f},
-std::array<float,2>{0.440487653f, 0.467844874f},
-std::array<float,2>{0.377621263f, 0.554483831f},
-std::array<float,2>{0.502047122f, 0.234530911f},
-std::array<float,2>{0.88387984f, 0.921644926f},
-std::array<float,2>{0.157831445f, 0.290642798f},
-std::array<float,2>{0.0398931988f, 0.768384457f},
-std::array<float,2>{0.752379596f, 0.417440265f},
-std::array<float,2>{0.642997921f, 0.645922244f},
-std::array<float,2>{0.305087358f, 0.00396554265f},
-std::array<float,2>{0.499887526f, 0.837426722f},
-std::array<float,2>{0.624649763f, 0.471067995f},
-std::array<float,2>{0.9853791f, 0.7011922f},
-std::array<float,2>{0.214394242f, 0.111794613f},
-std::array<float,2>{0.121790163f, 0.577521563f},
-std::array<float,2>{0.830054581f, 0.178482547f},
-std::array<float,2>{0.70745635f, 0.969701529f},
-std::array<float,2>{0.344124794f, 0.340542257f},
-std::array<float,2>{0.261819512f, 0.679245889f},
-std::array<float,2>{0.684310734f, 0.0514270253f},
-std::array<float,2>{0.788035512f, 0.786497533f},
-std::array<float,2>{0.00906159543f, 0.400665164f},
-std::array<float,2>{0.129554451f, 0.904505432f},
-std::array<float,2>{0.929831207f, 0.259844691f},
-std::array<float,2>{0.561341822f, 0.519511878f},
-std::array<float,2>{0.418872118f, 0.206470564f},
-std::array<float,2>{0.285179108f, 0.801874518f},
-std::array<float,2>{0.62659359f, 0.376797944f},
-std::array<float,2>{0.771733403f, 0.671478271f},
-std::array<float,2>{0.0610542297f, 0.0400809422f},
-std::array<float,2>{0.173922479f, 0.511515081f},
-std::array<float,2>{0.897345006f, 0.193806708f},
-std::array<float,2>{0.521489143f, 0.88099283f},
-std::array<float,2>{0.398073822f, 0.274223685f},
-std::array<float,2>{0.461466074f, 0.709285855f},
-std::array<float,2>{0.579437494f, 0.0961152911f},
-std::array<float,2>{0.942154467f, 0.824712336f},
-std::array<float,2>{0.222927004f, 0.494594932f},
-std::array<float,2>{0.0855225846f, 0.989980459f},
-std::array<float,2>{0.868125975f, 0.31792295f},
-std::array<float,2>{0.733442843f, 0.583585203f},
-std::array<float,2>{0.342205584f, 0.163976714f},
-std::array<float,2>{0.422302037f, 0.931742013f},
-std::array<float,2>{0.542867959f, 0.30285868f},
-std::array<float,2>{0.911254168f, 0.54343003f},
-std::array<float,2>{0.140938744f, 0.223500177f},
-std::array<float,2>{0.0215555429f, 0.639817357f},
-std::array<float,2>{0.798884571f, 0.0233376119f},
-std::array<float,2>{0.661770582f, 0.764435649f},
-std::array<float,2>{0.269963235f, 0.436558992f},
-std::array<float,2>{0.367193758f, 0.606466532f},
-std::array<float,2>{0.699811637f, 0.132366821f},
-std::array<float,2>{0.824097753f, 0.964536667f},
-std::array<float,2>{0.10655541f, 0.346085966f},
-std::array<float,2>{0.199730262f, 0.871491015f},
-std::array<float,2>{0.96979773f, 0.453046411f},
-std::array<float,2>{0.601185143f, 0.73182714f},
-std::array<float,2>{0.468946636f, 0.0764592513f},
-std::array<float,2>{0.276021451f, 0.887193143f},
-std::array<float,2>{0.667788744f, 0.271349102f},
-std::array<float,2>{0.806182742f, 0.505651355f},
-std::array<float,2>{0.0273028985f, 0.198628083f},
-std::array<float,2>{0.151372507f, 0.656454802f},
-std::array<float,2>{0.919855416f, 0.0357895829f},
-std::array<float,2>{0.531683683f, 0.805939913f},
-std::array<float,2>{0.43258819f, 0.385726362f},
-std::array<float,2>{0.480891228f, 0.590869367f},
-std::array<float,2>{0.602913082f, 0.17025207f},
-std::array<float,2>{0.977781117f, 0.995042205f},
-std::array<float,2>{0.190970376f, 0.324540406f},
-std::array<float,2>{0.0987123623f, 0.814465284f},
-std::array<float,2>{0.818506896f, 0.486883074f},
-std::array<float,2>{0.692521691f, 0.712872684f},
-std::array<float,2>{0.360775054f, 0.103782132f},
-std::array<float,2>{0.403649479f, 0.753975809f},
-std::array<float,2>{0.529219508f, 0.428608716f},
-std::array<float,2>{0.903862238f, 0.625312984f},
-std::array<float,2>{0.182228804f, 0.027790159f},
-std::array<float,2>{0.0528213792f, 0.537787318f},
-std::array<float,2>{0.781084061f, 0.232454613f},
-std::array<float,2>{0.638249218f, 0.925378978f},
-std::array<float,2>{0.292752653f, 0.305142492f},
-std::array<float,2>{0.328243196f, 0.723478794f},
-std::array<float,2>{0.722639918f, 0.0694587082f},
-std::array<float,2>{0.862167776f, 0.862883449f},
-std::array<float,2>{0.0903746113f, 0.444590747f},
-std::array<float,2>{0.231566757f, 0.958156049f},
-std::array<float,2>{0.948666215f, 0.358638883f},
-std::array<float,2>{0.591125369f, 0.599213839f},
-std::array<float,2>{0.454524428f, 0.139699712f},
-std::array<float,2>{0.358229786f, 0.854940176f},
-std::array<float,2>{0.71804297f, 0.460774988f},
-std::array<float,2>{0.836099565f, 0.741126657f},
-std::array<float,2>{0.116587847f, 0.088987045f},
-std::array<float,2>{0.210540965f, 0.619316041f},
-std::array<float,2>{0.996171832f, 0.143620491f},
-std::array<float,2>{0.609454811f, 0.949110091f},
-std::array<float,2>{0.489550352f, 0.372375786f},
-std::array<float,2>{0.412763417f, 0.65373224f},
-std::array<float,2>{0.547818303f, 0.0112385089f},
-std::array<float,2>{0.924564242f, 0.778482378f},
-std::array<float,2>{0.137957498f, 0.410124809f},
-std::array<float,2>{0.00553336507f, 0.906646848f},
-std::array<float,2>{0.79507798f, 0.281624138f},
-std::array<float,2>{0.674618602f, 0.562131584f},
-std::array<float,2>{0.250668079f, 0.245856479f},
-std::array<float,2>{0.446623027f, 0.977508068f},
-std::array<float,2>{0.571429789f, 0.329229057f},
-std::array<float,2>{0.966817498f, 0.566317618f},
-std::array<float,2>{0.247401446f, 0.182533115f},
-std::array<float,2>{0.0671996102f, 0.688616991f},
-std::array<float,2>{0.856565177f, 0.123770244f},
-std::array<float,2>{0.73497349f, 0.831511199f},
-std::array<float,2>{0.315903604f, 0.48099789f},
-std::array<float,2>{0.299103081f, 0.525234818f},
-std::array<float,2>{0.6488325f, 0.217222407f},
-std::array<float,2>{0.760546505f, 0.89531225f},
-std::array<float,2>{0.0336544737f, 0.252597481f},
-std::array<float,2>{0.168349847f, 0.789353251f},
-std::array<float,2>{0.876267076f, 0.39065969f},
-std::array<float,2>{0.51060307f, 0.685668051f},
-std::array<float,2>{0.388601333f, 0.0619680882f},
-std::array<float,2>{0.334424943f, 0.8998878f},
-std::array<float,2>{0.72272408f, 0.263746619f},
-std::array<float,2>{0.865923107f, 0.521453083f},
-std::array<float,2>{0.0877946019f, 0.208746329f},
-std::array<float,2>{0.229735851f, 0.674002588f},
-std::array<float,2>{0.950281143f, 0.050692223f},
-std::array<float,2>{0.589254141f, 0.781721115f},
-std::array<float,2>{0.45984906f, 0.40362075f},
-std::array<float,2>{0.399166942f, 0.57310307f},
-std::array<float,2>{0.524117589f, 0.173282042f},
-std::array<float,2>{0.899264157f, 0.975176275f},
-std::array<float,2>{0.185202405f, 0.339686424f},
-std::array<float,2>{0.0491696149f, 0.843492329f},
-std::array<float,2>{0.777042985f, 0.472889274f},
-std::array<float,2>{0.634723246f, 0.696368873f},
-std::array<float,2>{0.293742836f, 0.113803715f},
-std::array<float,2>{0.478315324f, 0.769627035f},
-std::array<float,2>{0.607798576f, 0.418871939f},
-std::array<float,2>{0.981579959f, 0.643305361f},
-std::array<float,2>{0.193090498f, 0.00316763599f},
-std::array<float,2>{0.0944918841f, 0.547840714f},
-std::array<float,2>{0.814850748f, 0.241429359f},
-std::array<float,2>{0.688583016f, 0.914665103f},
-std::array<float,2>{0.36472249f, 0.295963794f},
-std::array<float,2>{0.280496806f, 0.746905982f},
-std::array<float,2>{0.670830429f, 0.0828497261f},
-std::array<float,2>{0.811896503f, 0.849736452f},
-std::array<float,2>{0.0273475852f, 0.461711168f},
-std::array<float,2>{0.154218808f, 0.943117499f},
-std::array<float,2>{0.915934861f, 0.365341902f},
-std::array<float,2>{0.537902057f, 0.610285699f},
-std::array<float,2>{0.433853567f, 0.151244119f},
-std::array<float,2>{0.304372042f, 0.869605601f},
-std::array<float,2>{0.653855503f, 0.446593016f},
-std::array<float,2>{0.764107168f, 0.727140486f},
-std::array<float,2>{0.0354076959f, 0.0710050017f},
-std::array<float,2>{0.166412786f, 0.603504539f},
-std::array<float,2>{0.880365491f, 0.128257394f},
-std::array<float,2>{0.511969447f, 0.967190444f},
-std::array<float,2>{0.383676678f, 0.350135237f},
-std::array<float,2>{0.452891022f, 0.632860184f},
-std::array<float,2>{0.576317966f, 0.017501995f},
-std::array<float,2>{0.964291513f, 0.761424422f},
-std::array<float,2>{0.245093331f, 0.432547837f},
-std::array<float,2>{0.0648167133f, 0.935833395f},
-std::array<float,2>{0.852938414f, 0.299864948f},
-std::array<float,2>{0.73900497f, 0.541693985f},
-std::array<float,2>{0.317123741f, 0.221589983f},
-std::array<float,2>{0.408071011f, 0.985485077f},
-std::array<float,2>{0.552149713f, 0.313992709f},
-std::array<float,2>{0.927049816f, 0.579936981f},
-std::array<float,2>{0.134269923f, 0.158574298f},
-std::array<float,2>{0.000558555068f, 0.706159294f},
-std::array<float,2>{0.792685866f, 0.0988774076f},
-std::array<float,2>{0.676695585f, 0.820760667f},
-std::array<float,2>{0.255604953f, 0.498435616f},
-std::array<float,2>{0.352780938f, 0.512723446f},
-std::array<float,2>{0.713878989f, 0.190206245f},
-std::array<float,2>{0.843658745f, 0.877523482f},
-std::array<float,2>{0.112911887f, 0.280521452f},
-std::array<float,2>{0.204002723f, 0.797440171f},
-std::array<float,2>{0.996029377f, 0.38219282f},
-std::array<float,2>{0.614108324f, 0.664794207f},
-std::array<float,2>{0.485205323f, 0.0439749397f},
-std::array<float,2>{0.260430008f, 0.956864059f},
-std::array<float,2>{0.681113303f, 0.354741484f},
-std::array<float,2>{0.783170462f, 0.597278416f},
-std::array<float,2>{0.0136170881f, 0.134936303f},
-std::array<float,2>{0.125771672f, 0.720868289f},
-std::array<float,2>{0.936598659f, 0.0646720827f},
-std::array<float,2>{0.556747377f, 0.866836965f},
-std::array<float,2>{0.414303899f, 0.440320224f},
-std::array<float,2>{0.495370954f, 0.531899691f},
-std::array<float,2>{0.618605494f, 0.227766797f},
-std::array<float,2>{0.991073012f, 0.92788285f},
-std::array<float,2>{0.214875534f, 0.309491992f},
-std::array<float,2>{0.119172633f, 0.752298415f},
-std::array<float,2>{0.835211039f, 0.422272146f},
-std::array<float,2>{0.703317165f, 0.629379869f},
-std::array<float,2>{0.350614458f, 0.0240530111f},
-std::array<float,2>{0.38248381f, 0.820265472f},
-std::array<float,2>{0.506877005f, 0.488443762f},
-std::array<float,2>{0.889437795f, 0.714979172f},
-std::array<float,2>{0.163904399f, 0.10847871f},
-std::array<float,2>{0.0433705896f, 0.5861215f},
-std::array<float,2>{0.754104257f, 0.167538151f},
-std::array<float,2>{0.645327568f, 0.996644974f},
-std::array<float,2>{0.310743243f, 0.321447343f},
-std::array<float,2>{0.327050298f, 0.660268784f},
-std::array<float,2>{0.746488214f, 0.0335446745f},
-std::array<float,2>{0.850956142f, 0.811875343f},
-std::array<float,2>{0.0734983385f, 0.390500486f},
-std::array<float,2>{0.241558939f, 0.88634342f},
-std::array<float,2>{0.960290372f, 0.267430305f},
-std::array<float,2>{0.567825735f, 0.503304601f},
-std::array<float,2>{0.444204211f, 0.201639324f},
-std::array<float,2>{0.372697264f, 0.793909192f},
-std::array<float,2>{0.695364118f, 0.39519155f},
-std::array<float,2>{0.824582338f, 0.680027902f},
-std::array<float,2>{0.104551047f, 0.0559957847f},
-std::array<float,2>{0.195380375f, 0.528064847f},
-std::array<float,2>{0.975185096f, 0.214122072f},
-std::array<float,2>{0.595922291f, 0.891366303f},
-std::array<float,2>{0.476014525f, 0.257399946f},
-std::array<float,2>{0.429357767f, 0.692140818f},
-std::array<float,2>{0.543486178f, 0.119836092f},
-std::array<float,2>{0.907383382f, 0.833523452f},
-std::array<float,2>{0.146463111f, 0.477811992f},
-std::array<float,2>{0.0166544579f, 0.982368171f},
-std::array<float,2>{0.801522672f, 0.334130734f},
-std::array<float,2>{0.657382429f, 0.567790091f},
-std::array<float,2>{0.268830985f, 0.187141106f},
-std::array<float,2>{0.464897454f, 0.913085103f},
-std::array<float,2>{0.585315704f, 0.285898447f},
-std::array<float,2>{0.940909028f, 0.557780743f},
-std::array<float,2>{0.219024912f, 0.246813163f},
-std::array<float,2>{0.079789497f, 0.651087999f},
-std::array<float,2>{0.874925137f, 0.0141981058f},
-std::array<float,2>{0.72831893f, 0.775212169f},
-std::array<float,2>{0.338744462f, 0.413580447f},
-std::array<float,2>{0.282119334f, 0.624555051f},
-std::array<float,2>{0.632010996f, 0.147933975f},
-std::array<float,2>{0.769440949f, 0.951301038f},
-std::array<float,2>{0.0550374798f, 0.369194627f},
-std::array<float,2>{0.179670185f, 0.855597794f},
-std::array<float,2>{0.891785145f, 0.454046369f},
-std::array<float,2>{0.518420219f, 0.735922158f},
-std::array<float,2>{0.392521739f, 0.0919577852f},
-std::array<float,2>{0.34659937f, 0.971025765f},
-std::array<float,2>{0.710334599f, 0.342376888f},
-std::array<float,2>{0.831221402f, 0.574509323f},
-std::array<float,2>{0.124093525f, 0.17637451f},
-std::array<float,2>{0.212840974f, 0.700591207f},
-std::array<float,2>{0.987714589f, 0.10959208f},
-std::array<float,2>{0.622681677f, 0.838369668f},
-std::array<float,2>{0.496571749f, 0.469301462f},
-std::array<float,2>{0.421044528f, 0.517021894f},
-std::array<float,2>{0.558790565f, 0.203791857f},
-std::array<float,2>{0.933003783f, 0.902557969f},
-std::array<float,2>{0.132393777f, 0.258616179f},
-std::array<float,2>{0.0107194455f, 0.788636565f},
-std::array<float,2>{0.786713123f, 0.399792522f},
-std::array<float,2>{0.685851693f, 0.676066935f},
-std::array<float,2>{0.265343219f, 0.0532501005f},
-std::array<float,2>{0.438432246f, 0.844703376f},
-std::array<float,2>{0.565196097f, 0.466203719f},
-std::array<float,2>{0.954024673f, 0.742755353f},
-std::array<float,2>{0.237641111f, 0.0802410394f},
-std::array<float,2>{0.0758141205f, 0.615817368f},
-std::array<float,2>{0.846218646f, 0.155192643f},
-std::array<float,2>{0.743741572f, 0.93988508f},
-std::array<float,2>{0.32134968f, 0.361579001f},
-std::array<float,2>{0.307001323f, 0.648360491f},
-std::array<float,2>{0.641586721f, 0.00720506953f},
-std::array<float,2>{0.751616955f, 0.767374754f},
-std::array<float,2>{0.0427008159f, 0.4159199f},
-std::array<float,2>{0.160028681f, 0.918272614f},
-std::array<float,2>{0.886161268f, 0.291458607f},
-std::array<float,2>{0.500513494f, 0.551137149f},
-std::array<float,2>{0.375229836f, 0.236764491f},
-std::array<float,2>{0.273039639f, 0.763129592f},
-std::array<float,2>{0.662599385f, 0.435412079f},
-std::array<float,2>{0.798031986f, 0.63762033f},
-std::array<float,2>{0.0209149551f, 0.0201096702f},
-std::array<float,2>{0.143641219f, 0.545272648f},
-std::array<float,2>{0.914050162f, 0.226196617f},
-std::array<float,2>{0.540719032f, 0.930875659f},
-std::array<float,2>{0.42387259f, 0.301375091f},
-std::array<float,2>{0.471810102f, 0.733689487f},
-std::array<float,2>{0.599434853f, 0.0749097392f},
-std::array<float,2>{0.972253859f, 0.874392033f},
-std::array<float,2>{0.201918453f, 0.449267715f},
-std::array<float,2>{0.108034454f, 0.962055266f},
-std::array<float,2>{0.821971893f, 0.34475112f},
-std::array<float,2>{0.702389598f, 0.608028769f},
-std::array<float,2>{0.370173752f, 0.129070386f},
-std::array<float,2>{0.394571841f, 0.87899226f},
-std::array<float,2>{0.520877182f, 0.275659859f},
-std::array<float,2>{0.895380378f, 0.509193897f},
-std::array<float,2>{0.173553005f, 0.192959592f},
-std::array<float,2>{0.0604456961f, 0.667997956f},
-std::array<float,2>{0.770367682f, 0.0416699648f},
-std::array<float,2>{0.628835857f, 0.804501712f},
-std::array<float,2>{0.288347155f, 0.377782851f},
-std::array<float,2>{0.340956628f, 0.585526884f},
-std::array<float,2>{0.732222497f, 0.161345854f},
-std::array<float,2>{0.871049166f, 0.991748571f},
-std::array<float,2>{0.0835726708f, 0.320005834f},
-std::array<float,2>{0.225027815f, 0.826576054f},
-std::array<float,2>{0.943977594f, 0.492943823f},
-std::array<float,2>{0.581748545f, 0.708551645f},
-std::array<float,2>{0.464641243f, 0.0938396081f},
-std::array<float,2>{0.290368378f, 0.92240119f},
-std::array<float,2>{0.638911724f, 0.308140188f},
-std::array<float,2>{0.777396441f, 0.535878658f},
-std::array<float,2>{0.0512323305f, 0.23110418f},
-std::array<float,2>{0.181394026f, 0.627271235f},
-std::array<float,2>{0.90458566f, 0.0312331412f},
-std::array<float,2>{0.529310763f, 0.756800175f},
-std::array<float,2>{0.40432772f, 0.426101655f},
-std::array<float,2>{0.455306321f, 0.60152036f},
-std::array<float,2>{0.592490673f, 0.137815475f},
-std::array<float,2>{0.946606636f, 0.959466219f},
-std::array<float,2>{0.234188855f, 0.357184708f},
-std::array<float,2>{0.0923945233f, 0.860996068f},
-std::array<float,2>{0.859780252f, 0.442374736f},
-std::array<float,2>{0.719204843f, 0.725821555f},
-std::array<float,2>{0.331399858f, 0.0671153441f},
-std::array<float,2>{0.429916561f, 0.807440281f},
-std::array<float,2>{0.534111798f, 0.383060753f},
-std::array<float,2>{0.921113312f, 0.659580767f},
-std::array<float,2>{0.149389222f, 0.0379626155f},
-std::array<float,2>{0.0235325918f, 0.507795095f},
-std::array<float,2>{0.807062984f, 0.196104974f},
-std::array<float,2>{0.664545417f, 0.889690757f},
-std::array<float,2>{0.27502349f, 0.271697074f},
-std::array<float,2>{0.361828417f, 0.71339339f},
-std::array<float,2>{0.693451345f, 0.10205891f},
-std::array<float,2>{0.818034589f, 0.81360364f},
-std::array<float,2>{0.10110604f, 0.485584259f},
-std::array<float,2>{0.188323885f, 0.992701232f},
-std::array<float,2>{0.980401695f, 0.327617675f},
-std::array<float,2>{0.605233192f, 0.593061566f},
-std::array<float,2>{0.483482063f, 0.168618366f},
-std::array<float,2>{0.314352095f, 0.829934359f},
-std::array<float,2>{0.738131881f, 0.484162182f},
-std::array<float,2>{0.857658386f, 0.690360725f},
-std::array<float,2>{0.0690374225f, 0.121204324f},
-std::array<float,2>{0.249582469f, 0.563539565f},
-std::array<float,2>{0.965948224f, 0.181247979f},
-std::array<float,2>{0.572901428f, 0.979867399f},
-std::array<float,2>{0.449006498f, 0.331256181f},
-std::array<float,2>{0.389458209f, 0.684315085f},
-std::array<float,2>{0.507929027f, 0.0593904369f},
-std::array<float,2>{0.8785671f, 0.792225003f},
-std::array<float,2>{0.171029672f, 0.394066632f},
-std::array<float,2>{0.0325383246f, 0.897461951f},
-std::array<float,2>{0.759532332f, 0.250454307f},
-std::array<float,2>{0.651219964f, 0.526734769f},
-std::array<float,2>{0.298599064f, 0.216789201f},
-std::array<float,2>{0.49031651f, 0.945971131f},
-std::array<float,2>{0.611853838f, 0.373967916f},
-std::array<float,2>{0.999873817f, 0.618042827f},
-std::array<float,2>{0.208023295f, 0.140706852f},
-std::array<float,2>{0.114985652f, 0.739026606f},
-std::array<float,2>{0.839663684f, 0.085980542f},
-std::array<float,2>{0.716313481f, 0.852285206f},
-std::array<float,2>{0.355699211f, 0.45845753f},
-std::array<float,2>{0.25229463f, 0.559437096f},
-std::array<float,2>{0.672727346f, 0.242537409f},
-std::array<float,2>{0.793718696f, 0.90935117f},
-std::array<float,2>{0.00742192846f, 0.284926087f},
-std::array<float,2>{0.140223593f, 0.779574156f},
-std::array<float,2>{0.922667205f, 0.408002138f},
-std::array<float,2>{0.548902571f, 0.654750168f},
-std::array<float,2>{0.410655171f, 0.00800078269f},
-std::array<float,2>{0.373172581f, 0.890791237f},
-std::array<float,2>{0.698077559f, 0.257033199f},
-std::array<float,2>{0.827841222f, 0.527565241f},
-std::array<float,2>{0.101721227f, 0.214388803f},
-std::array<float,2>{0.199008539f, 0.680346191f},
-std::array<float,2>{0.973767936f, 0.0565827712f},
-std::array<float,2>{0.595053971f, 0.793408692f},
-std::array<float,2>{0.47285682f, 0.395011693f},
-std::array<float,2>{0.426149964f, 0.568017304f},
-std::array<float,2>{0.545921981f, 0.186899588f},
-std::array<float,2>{0.909258842f, 0.981499195f},
-std::array<float,2>{0.147404373f, 0.33480233f},
-std::array<float,2>{0.0184095073f, 0.833364606f},
-std::array<float,2>{0.802745342f, 0.478479266f},
-std::array<float,2>{0.659062326f, 0.69153893f},
-std::array<float,2>{0.26756373f, 0.11924991f},
-std::array<float,2>{0.467336595f, 0.774603665f},
-std::array<float,2>{0.583055735f, 0.41354093f},
-std::array<float,2>{0.937822759f, 0.650844753f},
-std::array<float,2>{0.221008345f, 0.0137056392f},
-std::array<float,2>{0.0802057385f, 0.558396459f},
-std::array<float,2>{0.871276081f, 0.246485606f},
-std::array<float,2>{0.729154825f, 0.912396729f},
-std::array<float,2>{0.337808698f, 0.285164237f},
-std::array<float,2>{0.283545375f, 0.735524714f},
-std::array<float,2>{0.630243301f, 0.0923177898f},
-std::array<float,2>{0.766661644f, 0.856257319f},
-std::array<float,2>{0.0579931326f, 0.453488976f},
-std::array<float,2>{0.176705271f, 0.952035248f},
-std::array<float,2>{0.89342308f, 0.36980623f},
-std::array<float,2>{0.516046703f, 0.624483168f},
-std::array<float,2>{0.392830491f, 0.147994131f},
-std::array<float,2>{0.2594437f, 0.86649847f},
-std::array<float,2>{0.682388425f, 0.439901531f},
-std::array<float,2>{0.783322752f, 0.721592069f},
-std::array<float,2>{0.0150182983f, 0.0649636909f},
-std::array<float,2>{0.128900528f, 0.596760929f},
-std::array<float,2>{0.934478045f, 0.135709479f},
-std::array<float,2>{0.556546628f, 0.956250548f},
-std::array<float,2>{0.417927176f, 0.355250686f},
-std::array<float,2>{0.492941618f, 0.629627347f},
-std::array<float,2>{0.621001899f, 0.0235950276f},
-std::array<float,2>{0.989059031f, 0.752748013f},
-std::array<float,2>{0.218212396f, 0.422395736f},
-std::array<float,2>{0.118139572f, 0.928498924f},
-std::array<float,2>{0.833797514f, 0.309013903f},
-std::array<float,2>{0.705602229f, 0.531616628f},
-std::array<float,2>{0.349589407f, 0.228398234f},
-std::array<float,2>{0.38069725f, 0.996446252f},
-std::array<float,2>{0.505328774f, 0.322038502f},
-std::array<float,2>{0.887399912f, 0.586557329f},
-std::array<float,2>{0.16076912f, 0.167408928f},
-std::array<float,2>{0.0456540324f, 0.715667605f},
-std::array<float,2>{0.757174969f, 0.109330453f},
-std::array<float,2>{0.647425354f, 0.81965059f},
-std::array<float,2>{0.308667481f, 0.488899887f},
-std::array<float,2>{0.324740469f, 0.503808498f},
-std::array<float,2>{0.74971962f, 0.202069163f},
-std::array<float,2>{0.848906875f, 0.886050224f},
-std::array<float,2>{0.0712705106f, 0.266884059f},
-std::array<float,2>{0.238924056f, 0.812120616f},
-std::array<float,2>{0.958178043f, 0.39013654f},
-std::array<float,2>{0.570285022f, 0.660977542f},
-std::array<float,2>{0.442163348f, 0.0340915918f},
-std::array<float,2>{0.302661598f, 0.967528105f},
-std::array<float,2>{0.655923426f, 0.349842727f},
-std::array<float,2>{0.762781799f, 0.603015721f},
-std::array<float,2>{0.0375110731f, 0.128624827f},
-std::array<float,2>{0.165534049f, 0.727041662f},
-std::array<float,2>{0.881183922f, 0.0705411732f},
-std::array<float,2>{0.514015317f, 0.869789839f},
-std::array<float,2>{0.385543913f, 0.44690302f},
-std::array<float,2>{0.449311197f, 0.541456342f},
-std::array<float,2>{0.576050818f, 0.221167088f},
-std::array<float,2>{0.961953163f, 0.936516762f},
-std::array<float,2>{0.24347426f, 0.300698489f},
-std::array<float,2>{0.0629334152f, 0.760859251f},
-std::array<float,2>{0.853750169f, 0.432071805f},
-std::array<float,2>{0.740448475f, 0.633667827f},
-std::array<float,2>{0.319100708f, 0.0169587974f},
-std::array<float,2>{0.409390777f, 0.821135104f},
-std::array<float,2>{0.553243518f, 0.498699844f},
-std::array<float,2>{0.927992225f, 0.706678987f},
-std::array<float,2>{0.136250257f, 0.0993832722f},
-std::array<float,2>{0.00207916833f, 0.57927531f},
-std::array<float,2>{0.79088521f, 0.158890709f},
-std::array<float,2>{0.678334177f, 0.98595196f},
-std::array<float,2>{0.256320506f, 0.313876987f},
-std::array<float,2>{0.355029136f, 0.664379418f},
-std::array<float,2>{0.711694002f, 0.0445736945f},
-std::array<float,2>{0.841209948f, 0.79718554f},
-std::array<float,2>{0.110067107f, 0.382505745f},
-std::array<float,2>{0.206533313f, 0.877415299f},
-std::array<float,2>{0.993902802f, 0.280840665f},
-std::array<float,2>{0.616131723f, 0.513437986f},
-std::array<float,2>{0.487600207f, 0.189542502f},
-std::array<float,2>{0.332916021f, 0.782215774f},
-std::array<float,2>{0.725997388f, 0.404166698f},
-std::array<float,2>{0.863537312f, 0.674428582f},
-std::array<float,2>{0.0878985077f, 0.0500348024f},
-std::array<float,2>{0.226942211f, 0.520537376f},
-std::array<float,2>{0.953013718f, 0.208465502f},
-std::array<float,2>{0.587255836f, 0.900122702f},
-std::array<float,2>{0.45750773f, 0.264365315f},
-std::array<float,2>{0.401668787f, 0.697035849f},
-std::array<float,2>{0.525983751f, 0.113403633f},
-std::array<float,2>{0.901597261f, 0.843167782f},
-std::array<float,2>{0.186516166f, 0.473362744f},
-std::array<float,2>{0.0484563373f, 0.974686623f},
-std::array<float,2>{0.775247931f, 0.339319646f},
-std::array<float,2>{0.635435045f, 0.572448432f},
-std::array<float,2>{0.294963151f, 0.173427865f},
-std::array<float,2>{0.479017138f, 0.914527655f},
-std::array<float,2>{0.607025921f, 0.296751529f},
-std::array<float,2>{0.984183431f, 0.547228754f},
-std::array<float,2>{0.193402365f, 0.241725236f},
-std::array<float,2>{0.0966659114f, 0.64257884f},
-std::array<float,2>{0.81425184f, 0.00380932167f},
-std::array<float,2>{0.689472318f, 0.770485818f},
-std::array<float,2>{0.366098881f, 0.418231934f},
-std::array<float,2>{0.2789222f, 0.609768033f},
-std::array<float,2>{0.669663012f, 0.150543749f},
-std::array<float,2>{0.810017407f, 0.942531943f},
-std::array<float,2>{0.0304242708f, 0.366040766f},
-std::array<float,2>{0.155954719f, 0.850335956f},
-std::array<float,2>{0.916993618f, 0.460966587f},
-std::array<float,2>{0.535825014f, 0.746351659f},
-std::array<float,2>{0.43660599f, 0.082261689f},
-std::array<float,2>{0.316106528f, 0.980128706f},
-std::array<float,2>{0.734477758f, 0.331709623f},
-std::array<float,2>{0.856939197f, 0.564211011f},
-std::array<float,2>{0.0665050298f, 0.180704489f},
-std::array<float,2>{0.247989893f, 0.68964982f},
-std::array<float,2>{0.967668235f, 0.121803619f},
-std::array<float,2>{0.571897566f, 0.829549551f},
-std::array<float,2>{0.447076589f, 0.48367843f},
-std::array<float,2>{0.387977928f, 0.527140677f},
-std::array<float,2>{0.51007247f, 0.21622996f},
-std::array<float,2>{0.876946986f, 0.898371994f},
-std::array<float,2>{0.168631375f, 0.250839949f},
-std::array<float,2>{0.0340467803f, 0.792864263f},
-std::array<float,2>{0.759829938f, 0.393705964f},
-std::array<float,2>{0.649099171f, 0.683719575f},
-std::array<float,2>{0.29978931f, 0.0589412674f},
-std::array<float,2>{0.489972651f, 0.851589799f},
-std::array<float,2>{0.609998107f, 0.45894295f},
-std::array<float,2>{0.996778667f, 0.738481045f},
-std::array<float,2>{0.210200176f, 0.0867636129f},
-std::array<float,2>{0.117179334f, 0.617663801f},
-std::array<float,2>{0.836876154f, 0.141366974f},
-std::array<float,2>{0.718527496f, 0.945661902f},
-std::array<float,2>{0.357774943f, 0.373317629f},
-std::array<float,2>{0.250176668f, 0.654843271f},
-std::array<float,2>{0.674228489f, 0.00831160601f},
-std::array<float,2>{0.79580456f, 0.780258477f},
-std::array<float,2>{0.00520024262f, 0.407334119f},
-std::array<float,2>{0.138515607f, 0.910012484f},
-std::array<float,2>{0.924174726f, 0.284289777f},
-std::array<float,2>{0.54701519f, 0.558631957f},
-std::array<float,2>{0.41221112f, 0.242726028f},
-std::array<float,2>{0.292363495f, 0.756278098f},
-std::array<float,2>{0.638115644f, 0.42667383f},
-std::array<float,2>{0.78034997f, 0.627850771f},
-std::array<float,2>{0.0532547161f, 0.0302909184f},
-std::array<float,2>{0.181748301f, 0.535230517f},
-std::array<float,2>{0.903557658f, 0.230646074f},
-std::array<float,2>{0.528333962f, 0.922028244f},
-std::array<float,2>{0.404060245f, 0.307982087f},
-std::array<float,2>{0.454730034f, 0.726095796f},
-std::array<float,2>{0.591673613f, 0.0666135103f},
-std::array<float,2>{0.94881314f, 0.860638082f},
-std::array<float,2>{0.232273981f, 0.441624999f},
-std::array<float,2>{0.0898554772f, 0.959710896f},
-std::array<float,2>{0.861731529f, 0.356864125f},
-std::array<float,2>{0.72206074f, 0.601032197f},
-std::array<float,2>{0.328648865f, 0.13828516f},
-std::array<float,2>{0.431770533f, 0.890520811f},
-std::array<float,2>{0.531946421f, 0.272126675f},
-std::array<float,2>{0.919400215f, 0.507225394f},
-std::array<float,2>{0.15218775f, 0.195679486f},
-std::array<float,2>{0.0267888419f, 0.659980893f},
-std::array<float,2>{0.805873036f, 0.0372593254f},
-std::array<float,2>{0.667254686f, 0.806806147f},
-std::array<float,2>{0.2757442f, 0.383465469f},
-std::array<float,2>{0.361227751f, 0.593272865f},
-std::array<float,2>{0.692979991f, 0.168260217f},
-std::array<float,2>{0.819214642f, 0.992232144f},
-std::array<float,2>{0.0993689373f, 0.327691644f},
-std::array<float,2>{0.190523624f, 0.814129412f},
-std::array<float,2>{0.978366315f, 0.486282438f},
-std::array<float,2>{0.603337109f, 0.712937236f},
-std::array<float,2>{0.481217772f, 0.101670653f},
-std::array<float,2>{0.270256191f, 0.931599617f},
-std::array<float,2>{0.661501288f, 0.301177502f},
-std::array<float,2>{0.799737334f, 0.545838118f},
-std::array<float,2>{0.0221032742f, 0.226022854f},
-std::array<float,2>{0.141376555f, 0.636973917f},
-std::array<float,2>{0.911627531f, 0.0199743491f},
-std::array<float,2>{0.542048991f, 0.763346255f},
-std::array<float,2>{0.422446311f, 0.434839368f},
-std::array<float,2>{0.469406635f, 0.607840061f},
-std::array<float,2>{0.60074836f, 0.129486889f},
-std::array<float,2>{0.970590949f, 0.962582231f},
-std::array<float,2>{0.199268281f, 0.345605373f},
-std::array<float,2>{0.107088573f, 0.874641597f},
-std::array<float,2>{0.823543847f, 0.449903876f},
-std::array<float,2>{0.699538112f, 0.733918011f},
-std::array<float,2>{0.367977411f, 0.0744572803f},
-std::array<float,2>{0.39780733f, 0.804187119f},
-std::array<float,2>{0.522057891f, 0.377047598f},
-std::array<float,2>{0.896683812f, 0.668552637f},
-std::array<float,2>{0.174419776f, 0.0413049422f},
-std::array<float,2>{0.0610280931f, 0.509431779f},
-std::array<float,2>{0.771983027f, 0.192589194f},
-std::array<float,2>{0.626277268f, 0.879864335f},
-std::array<float,2>{0.286115944f, 0.275978029f},
-std::array<float,2>{0.342700809f, 0.708472729f},
-std::array<float,2>{0.73402518f, 0.0943600386f},
-std::array<float,2>{0.867595315f, 0.826671422f},
-std::array<float,2>{0.0850358456f, 0.492331475f},
-std::array<float,2>{0.223221883f, 0.991324246f},
-std::array<float,2>{0.941627383f, 0.319775134f},
-std::array<float,2>{0.579658329f, 0.585446894f},
-std::array<float,2>{0.461336315f, 0.162056237f},
-std::array<float,2>{0.344269574f, 0.83842814f},
-std::array<float,2>{0.707911909f, 0.468785137f},
-std::array<float,2>{0.829144061f, 0.701139331f},
-std::array<float,2>{0.121260963f, 0.110073619f},
-std::array<float,2>{0.214336172f, 0.574884772f},
-std::array<float,2>{0.986141205f, 0.176025495f},
-std::array<float,2>{0.624248624f, 0.971371055f},
-std::array<float,2>{0.499125838f, 0.342065096f},
-std::array<float,2>{0.418395758f, 0.67665869f},
-std::array<float,2>{0.560839117f, 0.0529465415f},
-std::array<float,2>{0.930558026f, 0.788315892f},
-std::array<float,2>{0.129099399f, 0.400131166f},
-std::array<float,2>{0.00930339098f, 0.903146505f},
-std::array<float,2>{0.787262619f, 0.258086056f},
-std::array<float,2>{0.683595598f, 0.517474234f},
-std::array<float,2>{0.262654334f, 0.203327447f},
-std::array<float,2>{0.441190779f, 0.940308988f},
-std::array<float,2>{0.563590765f, 0.362030685f},
-std::array<float,2>{0.956173837f, 0.615616679f},
-std::array<float,2>{0.234844372f, 0.154559433f},
-std::array<float,2>{0.0765315071f, 0.74266696f},
-std::array<float,2>{0.845402956f, 0.0805809498f},
-std::array<float,2>{0.744639933f, 0.844157636f},
-std::array<float,2>{0.32421872f, 0.466382414f},
-std::array<float,2>{0.305267036f, 0.551708102f},
-std::array<float,2>{0.643143177f, 0.237294793f},
-std::array<float,2>{0.752853453f, 0.918481886f},
-std::array<float,2>{0.0394058526f, 0.291898936f},
-std::array<float,2>{0.157500416f, 0.766735375f},
-std::array<float,2>{0.884757578f, 0.415490836f},
-std::array<float,2>{0.502648354f, 0.647928536f},
-std::array<float,2>{0.377426624f, 0.00750824809f},
-std::array<float,2>{0.338115931f, 0.911182642f},
-std::array<float,2>{0.727610946f, 0.288131177f},
-std::array<float,2>{0.874474525f, 0.5548895f},
-std::array<float,2>{0.0794487596f, 0.249213547f},
-std::array<float,2>{0.219522968f, 0.650001168f},
-std::array<float,2>{0.940963089f, 0.0134911034f},
-std::array<float,2>{0.585548401f, 0.776899099f},
-std::array<float,2>{0.465668708f, 0.411369145f},
-std::array<float,2>{0.391720444f, 0.622832477f},
-std::array<float,2>{0.517983079f, 0.144879326f},
-std::array<float,2>{0.89222306f, 0.951010168f},
-std::array<float,2>{0.179047555f, 0.368236244f},
-std::array<float,2>{0.0552849062f, 0.858881474f},
-std::array<float,2>{0.768904448f, 0.455549151f},
-std::array<float,2>{0.632485747f, 0.737967491f},
-std::array<float,2>{0.281668633f, 0.090346016f},
-std::array<float,2>{0.476264119f, 0.79543227f},
-std::array<float,2>{0.596442282f, 0.39748171f},
-std::array<float,2>{0.975059032f, 0.681994021f},
-std::array<float,2>{0.196288973f, 0.0581538603f},
-std::array<float,2>{0.105144493f, 0.53062731f},
-std::array<float,2>{0.825180233f, 0.212631047f},
-std::array<float,2>{0.696282566f, 0.893429816f},
-std::array<float,2>{0.372113526f, 0.254135311f},
-std::array<float,2>{0.269113868f, 0.694142461f},
-std::array<float,2>{0.657736301f, 0.118411705f},
-std::array<float,2>{0.80100292f, 0.834994018f},
-std::array<float,2>{0.0173129551f, 0.480376303f},
-std::array<float,2>{0.145800084f, 0.983673453f},
-std::array<float,2>{0.907823384f, 0.333525717f},
-std::array<float,2>{0.542988539f, 0.569636822f},
-std::array<float,2>{0.428812414f, 0.185330629f},
-std::array<float,2>{0.311362684f, 0.817664802f},
-std::array<float,2>{0.6446141f, 0.491414964f},
-std::array<float,2>{0.754761398f, 0.718431175f},
-std::array<float,2>{0.043932993f, 0.106453918f},
-std::array<float,2>{0.163230509f, 0.589177072f},
-std::array<float,2>{0.888926744f, 0.164255187f},
-std::array<float,2>{0.507538319f, 0.999254942f},
-std::array<float,2>{0.381868839f, 0.324039012f},
-std::array<float,2>{0.443518251f, 0.662819505f},
-std::array<float,2>{0.568078995f, 0.0323892646f},
-std::array<float,2>{0.960666895f, 0.808746219f},
-std::array<float,2>{0.241785467f, 0.38799122f},
-std::array<float,2>{0.0738786906f, 0.884040773f},
-std::array<float,2>{0.851429999f, 0.269015044f},
-std::array<float,2>{0.747013748f, 0.500482142f},
-std::array<float,2>{0.32642892f, 0.200050995f},
-std::array<float,2>{0.414650977f, 0.953504026f},
-std::array<float,2>{0.557512879f, 0.352256209f},
-std::array<float,2>{0.93737179f, 0.594824076f},
-std::array<float,2>{0.125049278f, 0.13321358f},
-std::array<float,2>{0.0128637971f, 0.719122589f},
-std::array<float,2>{0.782688558f, 0.0640439987f},
-std::array<float,2>{0.681153417f, 0.864392042f},
-std::array<float,2>{0.259903401f, 0.43766284f},
-std::array<float,2>{0.351559818f, 0.533541203f},
-std::array<float,2>{0.703793406f, 0.229164019f},
-std::array<float,2>{0.83567816f, 0.926936686f},
-std::array<float,2>{0.12005391f, 0.312333465f},
-std::array<float,2>{0.21550703f, 0.750970125f},
-std::array<float,2>{0.990613878f, 0.425493568f},
-std::array<float,2>{0.618808985f, 0.632727444f},
-std::array<float,2>{0.496053815f, 0.0268077049f},
-std::array<float,2>{0.255223632f, 0.988218606f},
-std::array<float,2>{0.676160514f, 0.315849066f},
-std::array<float,2>{0.792256773f, 0.580923975f},
-std::array<float,2>{0.000172269894f, 0.156815767f},
-std::array<float,2>{0.134458587f, 0.703984678f},
-std::array<float,2>{0.927467763f, 0.101365216f},
-std::array<float,2>{0.552479088f, 0.823029637f},
-std::array<float,2>{0.407325089f, 0.497804433f},
-std::array<float,2>{0.484482884f, 0.514689744f},
-std::array<float,2>{0.613524199f, 0.18784833f},
-std::array<float,2>{0.995561123f, 0.876393914f},
-std::array<float,2>{0.203481406f, 0.277678102f},
-std::array<float,2>{0.112463504f, 0.800692737f},
-std::array<float,2>{0.842920184f, 0.379381597f},
-std::array<float,2>{0.714651823f, 0.667233109f},
-std::array<float,2>{0.353466153f, 0.045301903f},
-std::array<float,2>{0.382968247f, 0.868978441f},
-std::array<float,2>{0.512480021f, 0.447897792f},
-std::array<float,2>{0.880763054f, 0.730468452f},
-std::array<float,2>{0.16654101f, 0.0735208988f},
-std::array<float,2>{0.0358530618f, 0.603819489f},
-std::array<float,2>{0.76442486f, 0.125207037f},
-std::array<float,2>{0.653343678f, 0.966572165f},
-std::array<float,2>{0.304112196f, 0.348442465f},
-std::array<float,2>{0.316894352f, 0.635513246f},
-std::array<float,2>{0.738601625f, 0.0182434469f},
-std::array<float,2>{0.853474975f, 0.757834792f},
-std::array<float,2>{0.0650109053f, 0.431146502f},
-std::array<float,2>{0.244417697f, 0.934332907f},
-std::array<float,2>{0.964758575f, 0.297463f},
-std::array<float,2>{0.577045083f, 0.540394843f},
-std::array<float,2>{0.452603996f, 0.220456183f},
-std::array<float,2>{0.364767969f, 0.772139251f},
-std::array<float,2>{0.6893996f, 0.421292186f},
-std::array<float,2>{0.815376043f, 0.641765594f},
-std::array<float,2>{0.0937570632f, 0.0015582788f},
-std::array<float,2>{0.192847267f, 0.549530089f},
-std::array<float,2>{0.982162058f, 0.238750517f},
-std::array<float,2>{0.607956707f, 0.917530239f},
-std::array<float,2>{0.477644593f, 0.293093622f},
-std::array<float,2>{0.434538186f, 0.748284221f},
-std::array<float,2>{0.537473857f, 0.0840557888f},
-std::array<float,2>{0.915079892f, 0.848507822f},
-std::array<float,2>{0.153790712f, 0.463653326f},
-std::array<float,2>{0.0283060204f, 0.9435938f},
-std::array<float,2>{0.812345803f, 0.363610595f},
-std::array<float,2>{0.670290351f, 0.613265991f},
-std::array<float,2>{0.280822247f, 0.150149643f},
-std::array<float,2>{0.459148705f, 0.900947332f},
-std::array<float,2>{0.589662731f, 0.261821538f},
-std::array<float,2>{0.950950205f, 0.522448897f},
-std::array<float,2>{0.23009111f, 0.210471809f},
-std::array<float,2>{0.0869918689f, 0.672346234f},
-std::array<float,2>{0.865722179f, 0.0473360047f},
-std::array<float,2>{0.723620415f, 0.784491479f},
-std::array<float,2>{0.334690005f, 0.405459821f},
-std::array<float,2>{0.293130517f, 0.570339978f},
-std::array<float,2>{0.634079814f, 0.175278634f},
-std::array<float,2>{0.776786625f, 0.973589599f},
-std::array<float,2>{0.0493171252f, 0.337156981f},
-std::array<float,2>{0.184973389f, 0.840557337f},
-std::array<float,2>{0.898760974f, 0.476252049f},
-std::array<float,2>{0.523662925f, 0.699018061f},
-std::array<float,2>{0.398479253f, 0.11713399f},
-std::array<float,2>{0.356295466f, 0.948390245f},
-std::array<float,2>{0.716048062f, 0.37256515f},
-std::array<float,2>{0.838965058f, 0.619772851f},
-std::array<float,2>{0.11440628f, 0.144452155f},
-std::array<float,2>{0.208774388f, 0.740294278f},
-std::array<float,2>{0.999098122f, 0.0898367092f},
-std::array<float,2>{0.611512363f, 0.855331242f},
-std::array<float,2>{0.490834385f, 0.460295439f},
-std::array<float,2>{0.410431117f, 0.561526299f},
-std::array<float,2>{0.549319923f, 0.245417193f},
-std::array<float,2>{0.922139108f, 0.906786144f},
-std::array<float,2>{0.139874026f, 0.282163739f},
-std::array<float,2>{0.00716536026f, 0.779157102f},
-std::array<float,2>{0.793252885f, 0.409498096f},
-std::array<float,2>{0.672316134f, 0.654285908f},
-std::array<float,2>{0.252551883f, 0.0107778888f},
-std::array<float,2>{0.448658198f, 0.831720233f},
-std::array<float,2>{0.572500169f, 0.480488807f},
-std::array<float,2>{0.966645539f, 0.689230442f},
-std::array<float,2>{0.249378204f, 0.123353906f},
-std::array<float,2>{0.0687622204f, 0.565879226f},
-std::array<float,2>{0.858369172f, 0.181786954f},
-std::array<float,2>{0.737557232f, 0.976576269f},
-std::array<float,2>{0.313597053f, 0.329734325f},
-std::array<float,2>{0.297861934f, 0.686081827f},
-std::array<float,2>{0.650841892f, 0.0621750392f},
-std::array<float,2>{0.758957982f, 0.789553702f},
-std::array<float,2>{0.0330242328f, 0.391596437f},
-std::array<float,2>{0.17161867f, 0.894847512f},
-std::array<float,2>{0.878344417f, 0.252350211f},
-std::array<float,2>{0.508763075f, 0.524439096f},
-std::array<float,2>{0.38904947f, 0.217493787f},
-std::array<float,2>{0.274480551f, 0.806500614f},
-std::array<float,2>{0.665021062f, 0.385071814f},
-std::array<float,2>{0.807397664f, 0.656776011f},
-std::array<float,2>{0.024338048f, 0.0352198444f},
-std::array<float,2>{0.148459986f, 0.505207956f},
-std::array<float,2>{0.921417654f, 0.199020132f},
-std::array<float,2>{0.533584416f, 0.88754946f},
-std::array<float,2>{0.430297852f, 0.270930439f},
-std::array<float,2>{0.483924478f, 0.71214509f},
-std::array<float,2>{0.604882777f, 0.10409078f},
-std::array<float,2>{0.97997123f, 0.815277219f},
-std::array<float,2>{0.187984377f, 0.486440331f},
-std::array<float,2>{0.100937776f, 0.994544744f},
-std::array<float,2>{0.817719042f, 0.32510075f},
-std::array<float,2>{0.693930387f, 0.591491044f},
-std::array<float,2>{0.36154896f, 0.170853525f},
-std::array<float,2>{0.404869884f, 0.925235987f},
-std::array<float,2>{0.529994786f, 0.305212557f},
-std::array<float,2>{0.905174673f, 0.537124395f},
-std::array<float,2>{0.180701107f, 0.233336523f},
-std::array<float,2>{0.0514357463f, 0.625571311f},
-std::array<float,2>{0.777967334f, 0.0279286802f},
-std::array<float,2>{0.639281929f, 0.754618585f},
-std::array<float,2>{0.290878236f, 0.42821461f},
-std::array<float,2>{0.331851661f, 0.598652363f},
-std::array<float,2>{0.71931541f, 0.14032492f},
-std::array<float,2>{0.860297561f, 0.95859462f},
-std::array<float,2>{0.0919071436f, 0.359017879f},
-std::array<float,2>{0.23372528f, 0.862517536f},
-std::array<float,2>{0.947228789f, 0.445101172f},
-std::array<float,2>{0.591872454f, 0.722924829f},
-std::array<float,2>{0.455854207f, 0.0700963512f},
-std::array<float,2>{0.288963586f, 0.881755888f},
-std::array<float,2>{0.628251195f, 0.27377969f},
-std::array<float,2>{0.769952118f, 0.510906577f},
-std::array<float,2>{0.0600081831f, 0.193979517f},
-std::array<float,2>{0.173177436f, 0.670991838f},
-std::array<float,2>{0.894626856f, 0.0408040546f},
-std::array<float,2>{0.521342039f, 0.802413344f},
-std::array<float,2>{0.395285666f, 0.376369745f},
-std::array<float,2>{0.464150727f, 0.583242774f},
-std::array<float,2>{0.581463814f, 0.163348004f},
-std::array<float,2>{0.943626165f, 0.989524245f},
-std::array<float,2>{0.225581065f, 0.317776054f},
-std::array<float,2>{0.0830722675f, 0.824221849f},
-std::array<float,2>{0.870274663f, 0.495018691f},
-std::array<float,2>{0.731524587f, 0.709614217f},
-std::array<float,2>{0.341312915f, 0.0963984281f},
-std::array<float,2>{0.424419165f, 0.764049411f},
-std::array<float,2>{0.540282905f, 0.437105566f},
-std::array<float,2>{0.913296402f, 0.64042449f},
-std::array<float,2>{0.144347966f, 0.0227695964f},
-std::array<float,2>{0.0214240905f, 0.54363513f},
-std::array<float,2>{0.79867357f, 0.223115131f},
-std::array<float,2>{0.662205458f, 0.932505429f},
-std::array<float,2>{0.272611648f, 0.303518593f},
-std::array<float,2>{0.370647639f, 0.732019126f},
-std::array<float,2>{0.702798665f, 0.076974906f},
-std::array<float,2>{0.821365416f, 0.871807694f},
-std::array<float,2>{0.107796431f, 0.452288926f},
-std::array<float,2>{0.20145905f, 0.963926494f},
-std::array<float,2>{0.971739709f, 0.346306711f},
-std::array<float,2>{0.599086046f, 0.607000709f},
-std::array<float,2>{0.472596377f, 0.132226124f},
-std::array<float,2>{0.321919888f, 0.846479297f},
-std::array<float,2>{0.74320668f, 0.468564808f},
-std::array<float,2>{0.845881283f, 0.745456696f},
-std::array<float,2>{0.0755757466f, 0.0785341337f},
-std::array<float,2>{0.238101259f, 0.613313913f},
-std::array<float,2>{0.953539848f, 0.152377471f},
-std::array<float,2>{0.56476444f, 0.939277351f},
-std::array<float,2>{0.437637299f, 0.360134482f},
-std::array<float,2>{0.375976205f, 0.646144927f},
-std::array<float,2>{0.500109494f, 0.00483095553f},
-std::array<float,2>{0.886643946f, 0.767758369f},
-std::array<float,2>{0.159360901f, 0.417902321f},
-std::array<float,2>{0.0424397588f, 0.92122221f},
-std::array<float,2>{0.751154304f, 0.290300548f},
-std::array<float,2>{0.640788555f, 0.553880453f},
-std::array<float,2>{0.307441115f, 0.235305861f},
-std::array<float,2>{0.496967643f, 0.968948722f},
-std::array<float,2>{0.62246716f, 0.340292186f},
-std::array<float,2>{0.988117397f, 0.577982962f},
-std::array<float,2>{0.21233198f, 0.177779391f},
-std::array<float,2>{0.124512702f, 0.701806545f},
-std::array<float,2>{0.831661403f, 0.112019964f},
-std::array<float,2>{0.710886955f, 0.837067425f},
-std::array<float,2>{0.345745355f, 0.471396685f},
-std::array<float,2>{0.26510945f, 0.519028842f},
-std::array<float,2>{0.686077952f, 0.206642941f},
-std::array<float,2>{0.786576748f, 0.904888034f},
-std::array<float,2>{0.00977084599f, 0.260338992f},
-std::array<float,2>{0.132263035f, 0.786752164f},
-std::array<float,2>{0.933583558f, 0.401106536f},
-std::array<float,2>{0.559379041f, 0.678844273f},
-std::array<float,2>{0.421789676f, 0.0511969738f},
-std::array<float,2>{0.348536193f, 0.925835133f},
-std::array<float,2>{0.706071436f, 0.311179757f},
-std::array<float,2>{0.832876563f, 0.534685969f},
-std::array<float,2>{0.118937545f, 0.229528084f},
-std::array<float,2>{0.217100799f, 0.630927861f},
-std::array<float,2>{0.98965925f, 0.02627239f},
-std::array<float,2>{0.62003845f, 0.751918852f},
-std::array<float,2>{0.493890733f, 0.424794108f},
-std::array<float,2>{0.41611892f, 0.593806684f},
-std::array<float,2>{0.555658698f, 0.134602383f},
-std::array<float,2>{0.935464919f, 0.954360306f},
-std::array<float,2>{0.127197832f, 0.353310257f},
-std::array<float,2>{0.0140638659f, 0.863447666f},
-std::array<float,2>{0.784317672f, 0.439357966f},
-std::array<float,2>{0.683027685f, 0.719923019f},
-std::array<float,2>{0.258412331f, 0.0632712692f},
-std::array<float,2>{0.442586452f, 0.81047672f},
-std::array<float,2>{0.568515897f, 0.387333304f},
-std::array<float,2>{0.957031727f, 0.663603902f},
-std::array<float,2>{0.239411786f, 0.0315202065f},
-std::array<float,2>{0.0717742071f, 0.501561105f},
-std::array<float,2>{0.847807944f, 0.200381458f},
-std::array<float,2>{0.748975277f, 0.883681715f},
-std::array<float,2>{0.325866848f, 0.267735451f},
-std::array<float,2>{0.310143471f, 0.717525482f},
-std::array<float,2>{0.648158073f, 0.105786756f},
-std::array<float,2>{0.75592649f, 0.817104399f},
-std::array<float,2>{0.0464674793f, 0.490827829f},
-std::array<float,2>{0.161853075f, 0.998380482f},
-std::array<float,2>{0.888103366f, 0.322498053f},
-std::array<float,2>{0.504503906f, 0.588165343f},
-std::array<float,2>{0.379488021f, 0.165683523f},
-std::array<float,2>{0.265741646f, 0.834935486f},
-std::array<float,2>{0.659803748f, 0.478737682f},
-std::array<float,2>{0.804658532f, 0.695018351f},
-std::array<float,2>{0.0194407329f, 0.117376395f},
-std::array<float,2>{0.148075417f, 0.569091499f},
-std::array<float,2>{0.90836823f, 0.184009373f},
-std::array<float,2>{0.545384407f, 0.982886076f},
-std::array<float,2>{0.426978767f, 0.332365185f},
-std::array<float,2>{0.473942667f, 0.683338642f},
-std::array<float,2>{0.594187498f, 0.0575224832f},
-std::array<float,2>{0.972868085f, 0.796805382f},
-std::array<float,2>{0.198158473f, 0.397400171f},
-std::array<float,2>{0.102656014f, 0.894413412f},
-std::array<float,2>{0.82619822f, 0.255358815f},
-std::array<float,2>{0.699044764f, 0.529337168f},
-std::array<float,2>{0.374577641f, 0.211422622f},
-std::array<float,2>{0.394354284f, 0.949241817f},
-std::array<float,2>{0.516984463f, 0.368013054f},
-std::array<float,2>{0.893887639f, 0.621455073f},
-std::array<float,2>{0.177610323f, 0.145628899f},
-std::array<float,2>{0.0574192107f, 0.736551285f},
-std::array<float,2>{0.76572448f, 0.0911256522f},
-std::array<float,2>{0.629010141f, 0.858006597f},
-std::array<float,2>{0.284439206f, 0.456327319f},
-std::array<float,2>{0.336045504f, 0.555677712f},
-std::array<float,2>{0.729673386f, 0.248713523f},
-std::array<float,2>{0.872196734f, 0.91109848f},
-std::array<float,2>{0.0819333717f, 0.28755793f},
-std::array<float,2>{0.221790954f, 0.775484443f},
-std::array<float,2>{0.939010918f, 0.410173893f},
-std::array<float,2>{0.582181215f, 0.649254858f},
-std::array<float,2>{0.468390733f, 0.0119567961f},
-std::array<float,2>{0.296642482f, 0.974065363f},
-std::array<float,2>{0.636161864f, 0.336127996f},
-std::array<float,2>{0.773540914f, 0.571390927f},
-std::array<float,2>{0.0473738872f, 0.174320966f},
-std::array<float,2>{0.186862946f, 0.697673678f},
-std::array<float,2>{0.900514185f, 0.115508027f},
-std::array<float,2>{0.527195096f, 0.841393173f},
-std::array<float,2>{0.40090856f, 0.475024939f},
-std::array<float,2>{0.458894908f, 0.523382246f},
-std::array<float,2>{0.586185634f, 0.209871277f},
-std::array<float,2>{0.951686203f, 0.90148896f},
-std::array<float,2>{0.227959886f, 0.262703866f},
-std::array<float,2>{0.0893917754f, 0.783922613f},
-std::array<float,2>{0.864987016f, 0.404721975f},
-std::array<float,2>{0.724678338f, 0.673493981f},
-std::array<float,2>{0.333011597f, 0.0482887141f},
-std::array<float,2>{0.435647815f, 0.848780096f},
-std::array<float,2>{0.536415756f, 0.463879287f},
-std::array<float,2>{0.916594684f, 0.749372661f},
-std::array<float,2>{0.15516156f, 0.0854889899f},
-std::array<float,2>{0.0301390626f, 0.61136955f},
-std::array<float,2>{0.809042394f, 0.14940469f},
-std::array<float,2>{0.668828666f, 0.944602966f},
-std::array<float,2>{0.278015912f, 0.364769787f},
-std::array<float,2>{0.366473347f, 0.640975296f},
-std::array<float,2>{0.691157103f, 0.000746601785f},
-std::array<float,2>{0.81302321f, 0.772829533f},
-std::array<float,2>{0.096893549f, 0.420301825f},
-std::array<float,2>{0.19522585f, 0.916526496f},
-std::array<float,2>{0.982456923f, 0.294096351f},
-std::array<float,2>{0.606149554f, 0.550346911f},
-std::array<float,2>{0.479774654f, 0.23992683f},
-std::array<float,2>{0.319475114f, 0.759454846f},
-std::array<float,2>{0.741990149f, 0.43014735f},
-std::array<float,2>{0.855319142f, 0.636591971f},
-std::array<float,2>{0.0644515604f, 0.0191079192f},
-std::array<float,2>{0.242236346f, 0.539106786f},
-std::array<float,2>{0.961425304f, 0.21875228f},
-std::array<float,2>{0.574984014f, 0.934891999f},
-std::array<float,2>{0.450941056f, 0.298589528f},
-std::array<float,2>{0.386627764f, 0.728778303f},
-std::array<float,2>{0.515589714f, 0.0726499185f},
-std::array<float,2>{0.882728815f, 0.867844999f},
-std::array<float,2>{0.164225206f, 0.448849171f},
-std::array<float,2>{0.0390195772f, 0.965700448f},
-std::array<float,2>{0.762276411f, 0.349078059f},
-std::array<float,2>{0.654353142f, 0.605133176f},
-std::array<float,2>{0.301729113f, 0.126540348f},
-std::array<float,2>{0.486545563f, 0.875274777f},
-std::array<float,2>{0.617116868f, 0.278737962f},
-std::array<float,2>{0.992262959f, 0.514189899f},
-std::array<float,2>{0.205510437f, 0.188644975f},
-std::array<float,2>{0.110771365f, 0.66645056f},
-std::array<float,2>{0.840508044f, 0.0461867824f},
-std::array<float,2>{0.712683439f, 0.799354374f},
-std::array<float,2>{0.353863895f, 0.380747616f},
-std::array<float,2>{0.257095188f, 0.581960201f},
-std::array<float,2>{0.679107368f, 0.157515138f},
-std::array<float,2>{0.789584935f, 0.986765325f},
-std::array<float,2>{0.0033216658f, 0.314849854f},
-std::array<float,2>{0.135136604f, 0.823667943f},
-std::array<float,2>{0.929053843f, 0.496427476f},
-std::array<float,2>{0.554603815f, 0.704883397f},
-std::array<float,2>{0.408636838f, 0.0996210426f},
-std::array<float,2>{0.33003673f, 0.957963526f},
-std::array<float,2>{0.721657157f, 0.357983768f},
-std::array<float,2>{0.863239944f, 0.598608673f},
-std::array<float,2>{0.0913610682f, 0.138885021f},
-std::array<float,2>{0.230861053f, 0.723783255f},
-std::array<float,2>{0.948144555f, 0.0690014437f},
-std::array<float,2>{0.590461969f, 0.861528635f},
-std::array<float,2>{0.453283638f, 0.44381395f},
-std::array<float,2>{0.403107435f, 0.538312733f},
-std::array<float,2>{0.528244853f, 0.234356508f},
-std::array<float,2>{0.902808011f, 0.924768329f},
-std::array<float,2>{0.183094785f, 0.305808693f},
-std::array<float,2>{0.0545874424f, 0.755148232f},
-std::array<float,2>{0.779500008f, 0.429471344f},
-std::array<float,2>{0.636732399f, 0.626647353f},
-std::array<float,2>{0.291121721f, 0.0290273391f},
-std::array<float,2>{0.481854856f, 0.816139996f},
-std::array<float,2>{0.601609766f, 0.487862974f},
-std::array<float,2>{0.976850152f, 0.711273432f},
-std::array<float,2>{0.189722851f, 0.105420455f},
-std::array<float,2>{0.0980426297f, 0.590375781f},
-std::array<float,2>{0.82009089f, 0.171790242f},
-std::array<float,2>{0.692222357f, 0.995667398f},
-std::array<float,2>{0.359477133f, 0.325649858f},
-std::array<float,2>{0.276620358f, 0.657913327f},
-std::array<float,2>{0.666566551f, 0.0364978723f},
-std::array<float,2>{0.805009067f, 0.805298746f},
-std::array<float,2>{0.025416756f, 0.385751277f},
-std::array<float,2>{0.150416717f, 0.888537049f},
-std::array<float,2>{0.918877482f, 0.270017982f},
-std::array<float,2>{0.532949328f, 0.50481236f},
-std::array<float,2>{0.432776332f, 0.197520018f},
-std::array<float,2>{0.300342321f, 0.790901065f},
-std::array<float,2>{0.650299549f, 0.392068803f},
-std::array<float,2>{0.761019886f, 0.687313974f},
-std::array<float,2>{0.0348033383f, 0.0613443665f},
-std::array<float,2>{0.169877842f, 0.523614883f},
-std::array<float,2>{0.875207484f, 0.218286023f},
-std::array<float,2>{0.511405706f, 0.895670056f},
-std::array<float,2>{0.386946112f, 0.253661692f},
-std::array<float,2>{0.446223885f, 0.688465476f},
-std::array<float,2>{0.570700288f, 0.124411486f},
-std::array<float,2>{0.968575478f, 0.83074224f},
-std::array<float,2>{0.24692589f, 0.481820822f},
-std::array<float,2>{0.0678878352f, 0.977581441f},
-std::array<float,2>{0.855530977f, 0.328804851f},
-std::array<float,2>{0.735709608f, 0.565148771f},
-std::array<float,2>{0.315157026f, 0.183454558f},
-std::array<float,2>{0.413352162f, 0.908150196f},
-std::array<float,2>{0.548265934f, 0.283158928f},
-std::array<float,2>{0.924999177f, 0.560609818f},
-std::array<float,2>{0.137054354f, 0.244602725f},
-std::array<float,2>{0.00472549489f, 0.65256834f},
-std::array<float,2>{0.796794236f, 0.0103622861f},
-std::array<float,2>{0.674923658f, 0.778057992f},
-std::array<float,2>{0.251159698f, 0.408973336f},
-std::array<float,2>{0.358419776f, 0.620168388f},
-std::array<float,2>{0.717694998f, 0.142861992f},
-std::array<float,2>{0.837221026f, 0.947911918f},
-std::array<float,2>{0.115295105f, 0.371720791f},
-std::array<float,2>{0.209054127f, 0.854029119f},
-std::array<float,2>{0.99781692f, 0.459193349f},
-std::array<float,2>{0.610536337f, 0.741655052f},
-std::array<float,2>{0.489183664f, 0.0887065232f},
-std::array<float,2>{0.26298514f, 0.905656457f},
-std::array<float,2>{0.684705257f, 0.261491746f},
-std::array<float,2>{0.788528681f, 0.518190145f},
-std::array<float,2>{0.00811944623f, 0.205404252f},
-std::array<float,2>{0.130017355f, 0.677961171f},
-std::array<float,2>{0.93161428f, 0.0520657636f},
-std::array<float,2>{0.562446833f, 0.78536582f},
-std::array<float,2>{0.4193964f, 0.402232796f},
-std::array<float,2>{0.498569906f, 0.576668978f},
-std::array<float,2>{0.623847306f, 0.178930476f},
-std::array<float,2>{0.985250056f, 0.970408499f},
-std::array<float,2>{0.21353282f, 0.341441721f},
-std::array<float,2>{0.122572914f, 0.835951865f},
-std::array<float,2>{0.828494489f, 0.472314864f},
-std::array<float,2>{0.708390832f, 0.702922344f},
-std::array<float,2>{0.344942659f, 0.112370282f},
-std::array<float,2>{0.378897607f, 0.769039989f},
-std::array<float,2>{0.503130555f, 0.416856468f},
-std::array<float,2>{0.883606255f, 0.645159423f},
-std::array<float,2>{0.156935066f, 0.0052910354f},
-std::array<float,2>{0.0406172052f, 0.55342561f},
-std::array<float,2>{0.753124356f, 0.236000821f},
-std::array<float,2>{0.644180417f, 0.920571029f},
-std::array<float,2>{0.306537807f, 0.2895706f},
-std::array<float,2>{0.322522372f, 0.744233131f},
-std::array<float,2>{0.745853484f, 0.0791862607f},
-std::array<float,2>{0.843807876f, 0.84714365f},
-std::array<float,2>{0.0775607228f, 0.467069745f},
-std::array<float,2>{0.23606503f, 0.93759501f},
-std::array<float,2>{0.955642819f, 0.360659897f},
-std::array<float,2>{0.563167214f, 0.614634514f},
-std::array<float,2>{0.44020012f, 0.15387255f},
-std::array<float,2>{0.369107991f, 0.87272197f},
-std::array<float,2>{0.701027572f, 0.45154199f},
-std::array<float,2>{0.823040187f, 0.731174409f},
-std::array<float,2>{0.105817914f, 0.0773016363f},
-std::array<float,2>{0.200656846f, 0.605913103f},
-std::array<float,2>{0.969674766f, 0.131193206f},
-std::array<float,2>{0.600342214f, 0.96339637f},
-std::array<float,2>{0.470412433f, 0.346694708f},
-std::array<float,2>{0.423784703f, 0.639531672f},
-std::array<float,2>{0.541054904f, 0.0221578069f},
-std::array<float,2>{0.910241783f, 0.765062809f},
-std::array<float,2>{0.141876042f, 0.43632555f},
-std::array<float,2>{0.0226273704f, 0.933287144f},
-std::array<float,2>{0.800672591f, 0.303981483f},
-std::array<float,2>{0.660708129f, 0.54416424f},
-std::array<float,2>{0.271219105f, 0.224392831f},
-std::array<float,2>{0.462291241f, 0.988896608f},
-std::array<float,2>{0.579078674f, 0.316600621f},
-std::array<float,2>{0.943170607f, 0.582263052f},
-std::array<float,2>{0.224338189f, 0.162755847f},
-std::array<float,2>{0.0841497332f, 0.710564911f},
-std::array<float,2>{0.868977129f, 0.0971251428f},
-std::array<float,2>{0.733142853f, 0.825231552f},
-std::array<float,2>{0.343109041f, 0.495896399f},
-std::array<float,2>{0.286325395f, 0.509922504f},
-std::array<float,2>{0.625809133f, 0.194424301f},
-std::array<float,2>{0.773118436f, 0.882411659f},
-std::array<float,2>{0.0619520135f, 0.274576962f},
-std::array<float,2>{0.175570771f, 0.801150978f},
-std::array<float,2>{0.897542417f, 0.375662774f},
-std::array<float,2>{0.522949338f, 0.670738518f},
-std::array<float,2>{0.39692989f, 0.039391119f},
-std::array<float,2>{0.328078747f, 0.885486782f},
-std::array<float,2>{0.74766022f, 0.266565204f},
-std::array<float,2>{0.850201368f, 0.502516747f},
-std::array<float,2>{0.0732126981f, 0.20275867f},
-std::array<float,2>{0.240669772f, 0.661741436f},
-std::array<float,2>{0.959189475f, 0.034618549f},
-std::array<float,2>{0.566730857f, 0.810626447f},
-std::array<float,2>{0.445276678f, 0.388771087f},
-std::array<float,2>{0.381365269f, 0.587517262f},
-std::array<float,2>{0.505960286f, 0.166061863f},
-std::array<float,2>{0.890624702f, 0.997970283f},
-std::array<float,2>{0.162742332f, 0.321158588f},
-std::array<float,2>{0.0445095077f, 0.819079876f},
-std::array<float,2>{0.754904091f, 0.490147471f},
-std::array<float,2>{0.646259129f, 0.71649611f},
-std::array<float,2>{0.312297553f, 0.10768529f},
-std::array<float,2>{0.494958818f, 0.753536582f},
-std::array<float,2>{0.617612183f, 0.423084766f},
-std::array<float,2>{0.9919554f, 0.629956067f},
-std::array<float,2>{0.215888396f, 0.0250033289f},
-std::array<float,2>{0.120587923f, 0.532827914f},
-std::array<float,2>{0.834463418f, 0.227096975f},
-std::array<float,2>{0.70470345f, 0.928816319f},
-std::array<float,2>{0.349949181f, 0.309806257f},
-std::array<float,2>{0.260767192f, 0.722106516f},
-std::array<float,2>{0.67991668f, 0.0659739077f},
-std::array<float,2>{0.781850696f, 0.86550802f},
-std::array<float,2>{0.0118510285f, 0.440683395f},
-std::array<float,2>{0.126362324f, 0.955928206f},
-std::array<float,2>{0.936400294f, 0.354492068f},
-std::array<float,2>{0.55787003f, 0.595968664f},
-std::array<float,2>{0.416005701f, 0.135877937f},
-std::array<float,2>{0.282416582f, 0.856505394f},
-std::array<float,2>{0.631658733f, 0.454402477f},
-std::array<float,2>{0.768164515f, 0.734593272f},
-std::array<float,2>{0.0559960529f, 0.0933236182f},
-std::array<float,2>{0.178152993f, 0.623717606f},
-std::array<float,2>{0.89072001f, 0.147336245f},
-std::array<float,2>{0.519029081f, 0.952483118f},
-std::array<float,2>{0.39155674f, 0.371076614f},
-std::array<float,2>{0.466314703f, 0.651559532f},
-std::array<float,2>{0.584046304f, 0.0154663781f},
-std::array<float,2>{0.94032383f, 0.773823261f},
-std::array<float,2>{0.220654979f, 0.41232425f},
-std::array<float,2>{0.078640312f, 0.913375258f},
-std::array<float,2>{0.873644471f, 0.286202133f},
-std::array<float,2>{0.726586163f, 0.55749929f},
-std::array<float,2>{0.339607f, 0.247906074f},
-std::array<float,2>{0.42836383f, 0.980950236f},
-std::array<float,2>{0.544616878f, 0.335233599f},
-std::array<float,2>{0.906599402f, 0.567379951f},
-std::array<float,2>{0.144551918f, 0.185869247f},
-std::array<float,2>{0.0165078193f, 0.69279927f},
-std::array<float,2>{0.802509546f, 0.12068063f},
-std::array<float,2>{0.656758428f, 0.832426548f},
-std::array<float,2>{0.267775983f, 0.477111638f},
-std::array<float,2>{0.371813476f, 0.529124498f},
-std::array<float,2>{0.696592629f, 0.21355696f},
-std::array<float,2>{0.825347483f, 0.8925578f},
-std::array<float,2>{0.104382165f, 0.256075621f},
-std::array<float,2>{0.197174683f, 0.794411421f},
-std::array<float,2>{0.976068556f, 0.396115243f},
-std::array<float,2>{0.597491622f, 0.680726171f},
-std::array<float,2>{0.475385666f, 0.0547022484f},
-std::array<float,2>{0.279511452f, 0.941752791f},
-std::array<float,2>{0.670995712f, 0.366634279f},
-std::array<float,2>{0.811485291f, 0.611294568f},
-std::array<float,2>{0.028891854f, 0.151722923f},
-std::array<float,2>{0.153159633f, 0.747972548f},
-std::array<float,2>{0.914179087f, 0.0837324113f},
-std::array<float,2>{0.538245142f, 0.851284683f},
-std::array<float,2>{0.435480565f, 0.462175548f},
-std::array<float,2>{0.477439284f, 0.548358738f},
-std::array<float,2>{0.609162927f, 0.240538925f},
-std::array<float,2>{0.981400371f, 0.915241003f},
-std::array<float,2>{0.192242444f, 0.2955755f},
-std::array<float,2>{0.0949670002f, 0.771413982f},
-std::array<float,2>{0.816284895f, 0.419346571f},
-std::array<float,2>{0.688453197f, 0.643906713f},
-std::array<float,2>{0.363439351f, 0.00199429737f},
-std::array<float,2>{0.4002029f, 0.842556655f},
-std::array<float,2>{0.524433374f, 0.474382162f},
-std::array<float,2>{0.90017271f, 0.695719361f},
-std::array<float,2>{0.183710203f, 0.114500508f},
-std::array<float,2>{0.0504177585f, 0.574032784f},
-std::array<float,2>{0.775885224f, 0.172083005f},
-std::array<float,2>{0.63334775f, 0.975801051f},
-std::array<float,2>{0.294719428f, 0.338334769f},
-std::array<float,2>{0.335064113f, 0.675284803f},
-std::array<float,2>{0.724535108f, 0.0495342389f},
-std::array<float,2>{0.866284132f, 0.78288883f},
-std::array<float,2>{0.0859594047f, 0.402704269f},
-std::array<float,2>{0.229431272f, 0.898911595f},
-std::array<float,2>{0.949554265f, 0.264855474f},
-std::array<float,2>{0.588510215f, 0.52032429f},
-std::array<float,2>{0.460124493f, 0.207773253f},
-std::array<float,2>{0.352460831f, 0.79848206f},
-std::array<float,2>{0.713078976f, 0.381058604f},
-std::array<float,2>{0.842539549f, 0.665742457f},
-std::array<float,2>{0.111558512f, 0.0429826938f},
-std::array<float,2>{0.205045685f, 0.512093663f},
-std::array<float,2>{0.994435549f, 0.191276565f},
-std::array<float,2>{0.614371121f, 0.878021479f},
-std::array<float,2>{0.485497832f, 0.279892743f},
-std::array<float,2>{0.406438261f, 0.705112576f},
-std::array<float,2>{0.551754594f, 0.0978319645f},
-std::array<float,2>{0.925886154f, 0.821494997f},
-std::array<float,2>{0.133306667f, 0.499888748f},
-std::array<float,2>{0.00118832628f, 0.985154927f},
-std::array<float,2>{0.791510463f, 0.312595159f},
-std::array<float,2>{0.677359939f, 0.578912854f},
-std::array<float,2>{0.254480243f, 0.159303635f},
-std::array<float,2>{0.451988608f, 0.93658042f},
-std::array<float,2>{0.577842176f, 0.299735844f},
-std::array<float,2>{0.963432074f, 0.542734206f},
-std::array<float,2>{0.245516941f, 0.222406358f},
-std::array<float,2>{0.0663785189f, 0.634677351f},
-std::array<float,2>{0.851566434f, 0.0156255607f},
-std::array<float,2>{0.739551544f, 0.760120153f},
-std::array<float,2>{0.318284005f, 0.433079571f},
-std::array<float,2>{0.303587079f, 0.60164243f},
-std::array<float,2>{0.653200448f, 0.127071366f},
-std::array<float,2>{0.764739096f, 0.96854794f},
-std::array<float,2>{0.0365512297f, 0.350884527f},
-std::array<float,2>{0.167342171f, 0.870190501f},
-std::array<float,2>{0.879381597f, 0.445339024f},
-std::array<float,2>{0.513506353f, 0.728355587f},
-std::array<float,2>{0.384011388f, 0.0715953484f},
-std::array<float,2>{0.362687021f, 0.993736863f},
-std::array<float,2>{0.695195794f, 0.326473325f},
-std::array<float,2>{0.817180812f, 0.592722833f},
-std::array<float,2>{0.100510128f, 0.169856161f},
-std::array<float,2>{0.188608825f, 0.714138985f},
-std::array<float,2>{0.978837073f, 0.102710128f},
-std::array<float,2>{0.603758216f, 0.813233376f},
-std::array<float,2>{0.48247689f, 0.485147953f},
-std::array<float,2>{0.43138653f, 0.506581783f},
-std::array<float,2>{0.534280896f, 0.196769044f},
-std::array<float,2>{0.920236409f, 0.889266729f},
-std::array<float,2>{0.149909437f, 0.272740215f},
-std::array<float,2>{0.0245318376f, 0.808073699f},
-std::array<float,2>{0.808094144f, 0.384615898f},
-std::array<float,2>{0.66510433f, 0.658648968f},
-std::array<float,2>{0.273677826f, 0.0383216888f},
-std::array<float,2>{0.457025707f, 0.86022079f},
-std::array<float,2>{0.593239367f, 0.443031996f},
-std::array<float,2>{0.945914865f, 0.724984944f},
-std::array<float,2>{0.23288931f, 0.0680777431f},
-std::array<float,2>{0.0936040431f, 0.599870026f},
-std::array<float,2>{0.860869408f, 0.137249261f},
-std::array<float,2>{0.720685184f, 0.960922062f},
-std::array<float,2>{0.33040908f, 0.356170624f},
-std::array<float,2>{0.289772779f, 0.62864089f},
-std::array<float,2>{0.640040338f, 0.030214319f},
-std::array<float,2>{0.778617918f, 0.75714922f},
-std::array<float,2>{0.0519747473f, 0.427253872f},
-std::array<float,2>{0.179990515f, 0.923392713f},
-std::array<float,2>{0.90603137f, 0.30691874f},
-std::array<float,2>{0.531085074f, 0.536587656f},
-std::array<float,2>{0.405975282f, 0.232055783f},
-std::array<float,2>{0.253793955f, 0.780859351f},
-std::array<float,2>{0.672902346f, 0.406561583f},
-std::array<float,2>{0.794725597f, 0.655803621f},
-std::array<float,2>{0.0066163647f, 0.00919759087f},
-std::array<float,2>{0.139255598f, 0.559666574f},
-std::array<float,2>{0.923664987f, 0.243244708f},
-std::array<float,2>{0.550350666f, 0.908563077f},
-std::array<float,2>{0.411179781f, 0.283934027f},
-std::array<float,2>{0.491848081f, 0.740223408f},
-std::array<float,2>{0.613086224f, 0.0874434561f},
-std::array<float,2>{0.99863404f, 0.853043079f},
-std::array<float,2>{0.207738534f, 0.457333326f},
-std::array<float,2>{0.114222579f, 0.947191179f},
-std::array<float,2>{0.838070571f, 0.374141216f},
-std::array<float,2>{0.71502316f, 0.618332624f},
-std::array<float,2>{0.356563509f, 0.141623035f},
-std::array<float,2>{0.389830589f, 0.897445679f},
-std::array<float,2>{0.509179294f, 0.251055956f},
-std::array<float,2>{0.877297878f, 0.525971532f},
-std::array<float,2>{0.170436382f, 0.215412021f},
-std::array<float,2>{0.0312503986f, 0.685019135f},
-std::array<float,2>{0.758195639f, 0.0597473159f},
-std::array<float,2>{0.652109027f, 0.791125596f},
-std::array<float,2>{0.297547519f, 0.393254519f},
-std::array<float,2>{0.313281804f, 0.563353658f},
-std::array<float,2>{0.73686558f, 0.179875851f},
-std::array<float,2>{0.858702481f, 0.979047f},
-std::array<float,2>{0.0695879757f, 0.330663592f},
-std::array<float,2>{0.248886019f, 0.828398585f},
-std::array<float,2>{0.965059161f, 0.483183891f},
-std::array<float,2>{0.574003756f, 0.690562308f},
-std::array<float,2>{0.447849095f, 0.122300006f},
-std::array<float,2>{0.307926863f, 0.919020295f},
-std::array<float,2>{0.642059088f, 0.292581916f},
-std::array<float,2>{0.750662744f, 0.551908433f},
-std::array<float,2>{0.0413520522f, 0.238116845f},
-std::array<float,2>{0.158468932f, 0.646546006f},
-std::array<float,2>{0.885373116f, 0.00625077542f},
-std::array<float,2>{0.501588225f, 0.766164362f},
-std::array<float,2>{0.376762658f, 0.414963067f},
-std::array<float,2>{0.439363867f, 0.617097855f},
-std::array<float,2>{0.566194236f, 0.155338317f},
-std::array<float,2>{0.954845011f, 0.940717936f},
-std::array<float,2>{0.237238318f, 0.362820089f},
-std::array<float,2>{0.0750067979f, 0.845032275f},
-std::array<float,2>{0.847564101f, 0.464869797f},
-std::array<float,2>{0.74270767f, 0.743683636f},
-std::array<float,2>{0.320505023f, 0.0816876441f},
-std::array<float,2>{0.419983119f, 0.787672818f},
-std::array<float,2>{0.560343623f, 0.399079144f},
-std::array<float,2>{0.932360828f, 0.676958025f},
-std::array<float,2>{0.131714478f, 0.0539091527f},
-std::array<float,2>{0.0115195932f, 0.515869141f},
-std::array<float,2>{0.785500467f, 0.204478845f},
-std::array<float,2>{0.687256455f, 0.904102385f},
-std::array<float,2>{0.263833076f, 0.259487629f},
-std::array<float,2>{0.347433239f, 0.699927151f},
-std::array<float,2>{0.709123969f, 0.110852286f},
-std::array<float,2>{0.830414653f, 0.8393628f},
-std::array<float,2>{0.123765744f, 0.469923496f},
-std::array<float,2>{0.211812913f, 0.972572505f},
-std::array<float,2>{0.986607134f, 0.342939109f},
-std::array<float,2>{0.621712804f, 0.575284958f},
-std::array<float,2>{0.497530013f, 0.176862538f},
-std::array<float,2>{0.34055382f, 0.827207983f},
-std::array<float,2>{0.730932891f, 0.493945777f},
-std::array<float,2>{0.870084465f, 0.707512915f},
-std::array<float,2>{0.0821837038f, 0.095520094f},
-std::array<float,2>{0.225801453f, 0.584628344f},
-std::array<float,2>{0.944730163f, 0.160425603f},
-std::array<float,2>{0.580708206f, 0.990244389f},
-std::array<float,2>{0.463234961f, 0.319057524f},
-std::array<float,2>{0.396149576f, 0.669381142f},
-std::array<float,2>{0.51960212f, 0.0420330949f},
-std::array<float,2>{0.896262109f, 0.802976251f},
-std::array<float,2>{0.172265515f, 0.378415942f},
-std::array<float,2>{0.059362933f, 0.880029023f},
-std::array<float,2>{0.770602047f, 0.276970237f},
-std::array<float,2>{0.627225339f, 0.508650601f},
-std::array<float,2>{0.287517905f, 0.192192227f},
-std::array<float,2>{0.471231014f, 0.96133852f},
-std::array<float,2>{0.598478079f, 0.344479054f},
-std::array<float,2>{0.971091926f, 0.609245181f},
-std::array<float,2>{0.202899173f, 0.130828276f},
-std::array<float,2>{0.108762726f, 0.732446969f},
-std::array<float,2>{0.82083863f, 0.0756200552f},
-std::array<float,2>{0.701865792f, 0.873584092f},
-std::array<float,2>{0.369405627f, 0.450965911f},
-std::array<float,2>{0.271624386f, 0.546201706f},
-std::array<float,2>{0.663127184f, 0.225209847f},
-std::array<float,2>{0.797369301f, 0.929797769f},
-std::array<float,2>{0.0201420374f, 0.302645594f},
-std::array<float,2>{0.142979786f, 0.762283564f},
-std::array<float,2>{0.912928998f, 0.434124827f},
-std::array<float,2>{0.539297879f, 0.638175905f},
-std::array<float,2>{0.425694436f, 0.0210766681f}}
\ No newline at end of file
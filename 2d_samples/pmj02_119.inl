@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.589093983f, 0.551055014f},
-std::array<float,2>{0.211017892f, 0.362806678f},
-std::array<float,2>{0.857345164f, 0.0839167312f},
-std::array<float,2>{0.277025074f, 0.913337708f},
-std::array<float,2>{0.886289299f, 0.759898186f},
-std::array<float,2>{0.386071712f, 0.221850485f},
-std::array<float,2>{0.737300694f, 0.379029036f},
-std::array<float,2>{0.0430355892f, 0.650812984f},
-std::array<float,2>{0.774245083f, 0.711584866f},
-std::array<float,2>{0.337617129f, 0.442058325f},
-std::array<float,2>{0.501996577f, 0.146311104f},
-std::array<float,2>{0.161510959f, 0.841693521f},
-std::array<float,2>{0.652884901f, 0.940946698f},
-std::array<float,2>{0.0700339824f, 0.0559815764f},
-std::array<float,2>{0.992083311f, 0.282207429f},
-std::array<float,2>{0.453537285f, 0.614311934f},
-std::array<float,2>{0.717802227f, 0.662370443f},
-std::array<float,2>{0.0019063371f, 0.437081903f},
-std::array<float,2>{0.91573745f, 0.194053322f},
-std::array<float,2>{0.436599076f, 0.792381883f},
-std::array<float,2>{0.828623593f, 0.879720271f},
-std::array<float,2>{0.281674922f, 0.117339745f},
-std::array<float,2>{0.61342752f, 0.328085214f},
-std::array<float,2>{0.248651728f, 0.518227577f},
-std::array<float,2>{0.942155063f, 0.58496213f},
-std::array<float,2>{0.482996404f, 0.255819529f},
-std::array<float,2>{0.685885549f, 0.0268223137f},
-std::array<float,2>{0.104703873f, 0.982698262f},
-std::array<float,2>{0.5553388f, 0.86280638f},
-std::array<float,2>{0.14374797f, 0.181943282f},
-std::array<float,2>{0.789843798f, 0.494153529f},
-std::array<float,2>{0.361846983f, 0.735304058f},
-std::array<float,2>{0.527767837f, 0.733837306f},
-std::array<float,2>{0.17313531f, 0.476259381f},
-std::array<float,2>{0.752828836f, 0.159533054f},
-std::array<float,2>{0.32530129f, 0.844190419f},
-std::array<float,2>{0.982277036f, 0.998737633f},
-std::array<float,2>{0.44429794f, 0.00932540838f},
-std::array<float,2>{0.630693674f, 0.266487747f},
-std::array<float,2>{0.0854197219f, 0.566764057f},
-std::array<float,2>{0.871870458f, 0.507819116f},
-std::array<float,2>{0.253772914f, 0.33404845f},
-std::array<float,2>{0.575004697f, 0.0986450016f},
-std::array<float,2>{0.200871035f, 0.895212889f},
-std::array<float,2>{0.729977906f, 0.79880923f},
-std::array<float,2>{0.0605462901f, 0.212014973f},
-std::array<float,2>{0.894960284f, 0.419689775f},
-std::array<float,2>{0.401334196f, 0.683127642f},
-std::array<float,2>{0.667675793f, 0.60752368f},
-std::array<float,2>{0.110718586f, 0.304806203f},
-std::array<float,2>{0.956666172f, 0.0354256593f},
-std::array<float,2>{0.488584638f, 0.955014586f},
-std::array<float,2>{0.805840254f, 0.825309873f},
-std::array<float,2>{0.346285224f, 0.130106926f},
-std::array<float,2>{0.535864115f, 0.459510028f},
-std::array<float,2>{0.128701493f, 0.700564086f},
-std::array<float,2>{0.922397494f, 0.637794435f},
-std::array<float,2>{0.421686947f, 0.404204667f},
-std::array<float,2>{0.693410397f, 0.248610184f},
-std::array<float,2>{0.0218007024f, 0.772143602f},
-std::array<float,2>{0.608236134f, 0.925296307f},
-std::array<float,2>{0.225120544f, 0.0655817017f},
-std::array<float,2>{0.824953973f, 0.358325988f},
-std::array<float,2>{0.307180882f, 0.544917822f},
-std::array<float,2>{0.54589355f, 0.573903739f},
-std::array<float,2>{0.13792783f, 0.276119202f},
-std::array<float,2>{0.80448693f, 0.00176023925f},
-std::array<float,2>{0.354702562f, 0.985999167f},
-std::array<float,2>{0.962229788f, 0.853366435f},
-std::array<float,2>{0.493836641f, 0.165471613f},
-std::array<float,2>{0.663456142f, 0.481942266f},
-std::array<float,2>{0.117272705f, 0.725554168f},
-std::array<float,2>{0.818544447f, 0.675682664f},
-std::array<float,2>{0.302296579f, 0.411027402f},
-std::array<float,2>{0.59766382f, 0.20772022f},
-std::array<float,2>{0.229525f, 0.811513484f},
-std::array<float,2>{0.695968866f, 0.900320888f},
-std::array<float,2>{0.0285103172f, 0.103300191f},
-std::array<float,2>{0.929800451f, 0.34179312f},
-std::array<float,2>{0.410776407f, 0.505027056f},
-std::array<float,2>{0.63617754f, 0.6875844f},
-std::array<float,2>{0.0901248679f, 0.464128762f},
-std::array<float,2>{0.968937159f, 0.134133041f},
-std::array<float,2>{0.45085007f, 0.820185125f},
-std::array<float,2>{0.764461458f, 0.962315977f},
-std::array<float,2>{0.315537035f, 0.0398272052f},
-std::array<float,2>{0.522585213f, 0.301287025f},
-std::array<float,2>{0.183127284f, 0.596556962f},
-std::array<float,2>{0.902407825f, 0.536478043f},
-std::array<float,2>{0.398071587f, 0.348655373f},
-std::array<float,2>{0.721818924f, 0.0771016702f},
-std::array<float,2>{0.0494455062f, 0.930256963f},
-std::array<float,2>{0.569510162f, 0.779108822f},
-std::array<float,2>{0.191905767f, 0.239461243f},
-std::array<float,2>{0.866073787f, 0.39460972f},
-std::array<float,2>{0.262725383f, 0.62722683f},
-std::array<float,2>{0.624122202f, 0.644886315f},
-std::array<float,2>{0.237472147f, 0.385184467f},
-std::array<float,2>{0.836156368f, 0.233914942f},
-std::array<float,2>{0.292830944f, 0.753289938f},
-std::array<float,2>{0.911254287f, 0.91805172f},
-std::array<float,2>{0.425250262f, 0.0886011347f},
-std::array<float,2>{0.703498423f, 0.368398219f},
-std::array<float,2>{0.0110313362f, 0.5595451f},
-std::array<float,2>{0.784427106f, 0.620708227f},
-std::array<float,2>{0.369052202f, 0.295899689f},
-std::array<float,2>{0.55430913f, 0.0545431748f},
-std::array<float,2>{0.149113908f, 0.952153146f},
-std::array<float,2>{0.675092518f, 0.835125566f},
-std::array<float,2>{0.101441443f, 0.151884049f},
-std::array<float,2>{0.950419068f, 0.448629767f},
-std::array<float,2>{0.469678879f, 0.704838574f},
-std::array<float,2>{0.742970467f, 0.530136347f},
-std::array<float,2>{0.0373038501f, 0.314898908f},
-std::array<float,2>{0.87938571f, 0.113473043f},
-std::array<float,2>{0.376974672f, 0.888342798f},
-std::array<float,2>{0.8463673f, 0.781945825f},
-std::array<float,2>{0.268536896f, 0.199560225f},
-std::array<float,2>{0.582671404f, 0.429230869f},
-std::array<float,2>{0.205201954f, 0.667553782f},
-std::array<float,2>{0.999521375f, 0.749720991f},
-std::array<float,2>{0.46340999f, 0.490713626f},
-std::array<float,2>{0.648324609f, 0.178574905f},
-std::array<float,2>{0.0748435482f, 0.868266582f},
-std::array<float,2>{0.513825595f, 0.976253808f},
-std::array<float,2>{0.169755459f, 0.0177988242f},
-std::array<float,2>{0.771186531f, 0.263363093f},
-std::array<float,2>{0.331593335f, 0.589566588f},
-std::array<float,2>{0.593864858f, 0.612450898f},
-std::array<float,2>{0.232342616f, 0.288102001f},
-std::array<float,2>{0.812515676f, 0.0609334782f},
-std::array<float,2>{0.298716426f, 0.942028165f},
-std::array<float,2>{0.935886621f, 0.839050412f},
-std::array<float,2>{0.407664835f, 0.143255129f},
-std::array<float,2>{0.701107681f, 0.437886178f},
-std::array<float,2>{0.0258274954f, 0.717064857f},
-std::array<float,2>{0.799198925f, 0.655863285f},
-std::array<float,2>{0.358888179f, 0.376304954f},
-std::array<float,2>{0.542701125f, 0.224945113f},
-std::array<float,2>{0.135952681f, 0.765227079f},
-std::array<float,2>{0.658843279f, 0.907227755f},
-std::array<float,2>{0.124239251f, 0.0806589872f},
-std::array<float,2>{0.967034101f, 0.363543361f},
-std::array<float,2>{0.499131799f, 0.549590826f},
-std::array<float,2>{0.723018169f, 0.739632249f},
-std::array<float,2>{0.0543497391f, 0.496377289f},
-std::array<float,2>{0.899522066f, 0.18703869f},
-std::array<float,2>{0.393555135f, 0.866336346f},
-std::array<float,2>{0.860551298f, 0.977988839f},
-std::array<float,2>{0.260819912f, 0.0311732758f},
-std::array<float,2>{0.563770175f, 0.252609164f},
-std::array<float,2>{0.190128967f, 0.578497291f},
-std::array<float,2>{0.975601792f, 0.52314508f},
-std::array<float,2>{0.447189927f, 0.32296747f},
-std::array<float,2>{0.638785899f, 0.122517601f},
-std::array<float,2>{0.0868235528f, 0.876635671f},
-std::array<float,2>{0.515887558f, 0.795480013f},
-std::array<float,2>{0.186047211f, 0.188087925f},
-std::array<float,2>{0.759669006f, 0.42972821f},
-std::array<float,2>{0.319465637f, 0.657427073f},
-std::array<float,2>{0.547425687f, 0.684324265f},
-std::array<float,2>{0.155964419f, 0.416533262f},
-std::array<float,2>{0.785443068f, 0.21807076f},
-std::array<float,2>{0.373884529f, 0.801047862f},
-std::array<float,2>{0.947639048f, 0.892902017f},
-std::array<float,2>{0.474937946f, 0.095178023f},
-std::array<float,2>{0.677940786f, 0.33129108f},
-std::array<float,2>{0.095796518f, 0.515274048f},
-std::array<float,2>{0.842900932f, 0.562950134f},
-std::array<float,2>{0.296410084f, 0.273105055f},
-std::array<float,2>{0.620376706f, 0.0128355632f},
-std::array<float,2>{0.241783172f, 0.994825006f},
-std::array<float,2>{0.707963943f, 0.850717366f},
-std::array<float,2>{0.0129225357f, 0.161746517f},
-std::array<float,2>{0.907566547f, 0.469623655f},
-std::array<float,2>{0.429531187f, 0.730418622f},
-std::array<float,2>{0.64217639f, 0.542791247f},
-std::array<float,2>{0.0726211965f, 0.354875535f},
-std::array<float,2>{0.992976844f, 0.067438148f},
-std::array<float,2>{0.468600482f, 0.926923037f},
-std::array<float,2>{0.768334329f, 0.768326223f},
-std::array<float,2>{0.332680345f, 0.243667483f},
-std::array<float,2>{0.508565247f, 0.398763657f},
-std::array<float,2>{0.16761449f, 0.63403213f},
-std::array<float,2>{0.878687263f, 0.695531011f},
-std::array<float,2>{0.381191254f, 0.45364058f},
-std::array<float,2>{0.749404848f, 0.128245771f},
-std::array<float,2>{0.0341989361f, 0.821460009f},
-std::array<float,2>{0.580730259f, 0.960692823f},
-std::array<float,2>{0.210400879f, 0.032805074f},
-std::array<float,2>{0.849120498f, 0.30971539f},
-std::array<float,2>{0.271439999f, 0.603130043f},
-std::array<float,2>{0.506789327f, 0.502494395f},
-std::array<float,2>{0.160141379f, 0.336599916f},
-std::array<float,2>{0.778632879f, 0.107641511f},
-std::array<float,2>{0.342613876f, 0.902744591f},
-std::array<float,2>{0.985889316f, 0.806719422f},
-std::array<float,2>{0.458826631f, 0.204758376f},
-std::array<float,2>{0.651888847f, 0.406805366f},
-std::array<float,2>{0.0634331331f, 0.678970098f},
-std::array<float,2>{0.85341084f, 0.720397651f},
-std::array<float,2>{0.28026101f, 0.478827983f},
-std::array<float,2>{0.591843605f, 0.168994129f},
-std::array<float,2>{0.217602387f, 0.859164774f},
-std::array<float,2>{0.740115523f, 0.990014553f},
-std::array<float,2>{0.0395992287f, 0.0047949804f},
-std::array<float,2>{0.890352249f, 0.280195892f},
-std::array<float,2>{0.386831611f, 0.576045275f},
-std::array<float,2>{0.682592928f, 0.631491423f},
-std::array<float,2>{0.107104845f, 0.393384516f},
-std::array<float,2>{0.938463509f, 0.235848248f},
-std::array<float,2>{0.476961195f, 0.775238991f},
-std::array<float,2>{0.795937419f, 0.935908735f},
-std::array<float,2>{0.363736421f, 0.0706084371f},
-std::array<float,2>{0.558847964f, 0.343756586f},
-std::array<float,2>{0.148327693f, 0.531799674f},
-std::array<float,2>{0.921134233f, 0.60040772f},
-std::array<float,2>{0.431808472f, 0.297836989f},
-std::array<float,2>{0.713337481f, 0.0466932096f},
-std::array<float,2>{0.00746721216f, 0.966813326f},
-std::array<float,2>{0.612183332f, 0.813824892f},
-std::array<float,2>{0.243139803f, 0.13878414f},
-std::array<float,2>{0.833418548f, 0.466893613f},
-std::array<float,2>{0.285559505f, 0.692236602f},
-std::array<float,2>{0.572001159f, 0.710620046f},
-std::array<float,2>{0.198019877f, 0.452641875f},
-std::array<float,2>{0.869268656f, 0.154697299f},
-std::array<float,2>{0.254796058f, 0.83115375f},
-std::array<float,2>{0.892425418f, 0.947932124f},
-std::array<float,2>{0.405508786f, 0.0469927453f},
-std::array<float,2>{0.732739151f, 0.289193869f},
-std::array<float,2>{0.056772314f, 0.62237078f},
-std::array<float,2>{0.755605519f, 0.557068765f},
-std::array<float,2>{0.321582407f, 0.371567756f},
-std::array<float,2>{0.526355088f, 0.0927170217f},
-std::array<float,2>{0.176709428f, 0.917126238f},
-std::array<float,2>{0.626487374f, 0.75673157f},
-std::array<float,2>{0.0812414214f, 0.227398545f},
-std::array<float,2>{0.977380276f, 0.386955231f},
-std::array<float,2>{0.441090733f, 0.64420563f},
-std::array<float,2>{0.689038157f, 0.589936972f},
-std::array<float,2>{0.0170835014f, 0.261516422f},
-std::array<float,2>{0.927952886f, 0.0229563266f},
-std::array<float,2>{0.415276498f, 0.970790029f},
-std::array<float,2>{0.821928859f, 0.873755217f},
-std::array<float,2>{0.31054008f, 0.172091767f},
-std::array<float,2>{0.602727652f, 0.484484643f},
-std::array<float,2>{0.220171377f, 0.745640695f},
-std::array<float,2>{0.957297087f, 0.67088306f},
-std::array<float,2>{0.486871064f, 0.425303042f},
-std::array<float,2>{0.670391202f, 0.198993772f},
-std::array<float,2>{0.113732755f, 0.788337648f},
-std::array<float,2>{0.532233357f, 0.885853827f},
-std::array<float,2>{0.130664244f, 0.110055223f},
-std::array<float,2>{0.80924952f, 0.317428976f},
-std::array<float,2>{0.351104051f, 0.525622666f},
-std::array<float,2>{0.61529094f, 0.516604722f},
-std::array<float,2>{0.247285336f, 0.324522793f},
-std::array<float,2>{0.831970751f, 0.12047179f},
-std::array<float,2>{0.28368178f, 0.882034004f},
-std::array<float,2>{0.917799354f, 0.789684892f},
-std::array<float,2>{0.435181022f, 0.192548811f},
-std::array<float,2>{0.715874612f, 0.434707582f},
-std::array<float,2>{0.00207950291f, 0.66139549f},
-std::array<float,2>{0.792666137f, 0.737045646f},
-std::array<float,2>{0.360695541f, 0.493738025f},
-std::array<float,2>{0.558242023f, 0.17978625f},
-std::array<float,2>{0.14110297f, 0.860446215f},
-std::array<float,2>{0.684792995f, 0.98175019f},
-std::array<float,2>{0.10211888f, 0.0246609449f},
-std::array<float,2>{0.944564283f, 0.255921066f},
-std::array<float,2>{0.481494308f, 0.583559036f},
-std::array<float,2>{0.734910131f, 0.648527622f},
-std::array<float,2>{0.0451574922f, 0.381367087f},
-std::array<float,2>{0.883839786f, 0.219755903f},
-std::array<float,2>{0.384349048f, 0.758659482f},
-std::array<float,2>{0.858813465f, 0.911825299f},
-std::array<float,2>{0.273909777f, 0.0852655321f},
-std::array<float,2>{0.586097002f, 0.359454453f},
-std::array<float,2>{0.214155868f, 0.554469943f},
-std::array<float,2>{0.989196599f, 0.616870701f},
-std::array<float,2>{0.455703735f, 0.283493131f},
-std::array<float,2>{0.655126572f, 0.058098428f},
-std::array<float,2>{0.067781359f, 0.938888967f},
-std::array<float,2>{0.500779867f, 0.84269166f},
-std::array<float,2>{0.162981912f, 0.148401469f},
-std::array<float,2>{0.776943982f, 0.443709642f},
-std::array<float,2>{0.339735746f, 0.714585543f},
-std::array<float,2>{0.538280904f, 0.703075945f},
-std::array<float,2>{0.126880467f, 0.457612187f},
-std::array<float,2>{0.806957901f, 0.130873263f},
-std::array<float,2>{0.343804896f, 0.826315761f},
-std::array<float,2>{0.954384804f, 0.956003606f},
-std::array<float,2>{0.490926415f, 0.0372755118f},
-std::array<float,2>{0.665029824f, 0.308295459f},
-std::array<float,2>{0.112194888f, 0.606910944f},
-std::array<float,2>{0.827125311f, 0.545421124f},
-std::array<float,2>{0.306634098f, 0.355667263f},
-std::array<float,2>{0.607275248f, 0.062686719f},
-std::array<float,2>{0.224531963f, 0.922629952f},
-std::array<float,2>{0.692105412f, 0.770312786f},
-std::array<float,2>{0.0204811171f, 0.247221887f},
-std::array<float,2>{0.92531991f, 0.404468358f},
-std::array<float,2>{0.419863641f, 0.640134573f},
-std::array<float,2>{0.631223977f, 0.570238173f},
-std::array<float,2>{0.082909666f, 0.26903066f},
-std::array<float,2>{0.982791185f, 0.00997031294f},
-std::array<float,2>{0.442877263f, 0.997069597f},
-std::array<float,2>{0.750734866f, 0.847594917f},
-std::array<float,2>{0.327317208f, 0.158094421f},
-std::array<float,2>{0.530443251f, 0.472880155f},
-std::array<float,2>{0.174668148f, 0.732381463f},
-std::array<float,2>{0.897999823f, 0.681073487f},
-std::array<float,2>{0.40000692f, 0.420958906f},
-std::array<float,2>{0.72834295f, 0.213616207f},
-std::array<float,2>{0.0606956258f, 0.799102843f},
-std::array<float,2>{0.576228321f, 0.897454441f},
-std::array<float,2>{0.20272617f, 0.0996261239f},
-std::array<float,2>{0.873275161f, 0.332796097f},
-std::array<float,2>{0.250904202f, 0.510196567f},
-std::array<float,2>{0.521456778f, 0.595592618f},
-std::array<float,2>{0.180771515f, 0.303592205f},
-std::array<float,2>{0.763507068f, 0.0410216376f},
-std::array<float,2>{0.313865364f, 0.963862062f},
-std::array<float,2>{0.970803499f, 0.817197323f},
-std::array<float,2>{0.452029943f, 0.136246875f},
-std::array<float,2>{0.63361007f, 0.462504357f},
-std::array<float,2>{0.0924602896f, 0.689751863f},
-std::array<float,2>{0.864362597f, 0.625717998f},
-std::array<float,2>{0.265567273f, 0.396675706f},
-std::array<float,2>{0.567904353f, 0.241628602f},
-std::array<float,2>{0.194996536f, 0.780301332f},
-std::array<float,2>{0.720247209f, 0.932187736f},
-std::array<float,2>{0.0483159535f, 0.0748920515f},
-std::array<float,2>{0.904937804f, 0.351168036f},
-std::array<float,2>{0.39456445f, 0.537973285f},
-std::array<float,2>{0.66160357f, 0.723665595f},
-std::array<float,2>{0.120445438f, 0.483950853f},
-std::array<float,2>{0.964731276f, 0.166445494f},
-std::array<float,2>{0.494347513f, 0.853903055f},
-std::array<float,2>{0.801729798f, 0.988052368f},
-std::array<float,2>{0.352056235f, 0.0036742941f},
-std::array<float,2>{0.543834925f, 0.274185479f},
-std::array<float,2>{0.139351636f, 0.571449697f},
-std::array<float,2>{0.933465183f, 0.50763154f},
-std::array<float,2>{0.413743794f, 0.343743145f},
-std::array<float,2>{0.697547972f, 0.10352999f},
-std::array<float,2>{0.0306796767f, 0.901334882f},
-std::array<float,2>{0.601461053f, 0.809663057f},
-std::array<float,2>{0.227751002f, 0.209928498f},
-std::array<float,2>{0.816863835f, 0.413624495f},
-std::array<float,2>{0.303355724f, 0.67295295f},
-std::array<float,2>{0.584154844f, 0.664176941f},
-std::array<float,2>{0.203185767f, 0.425923735f},
-std::array<float,2>{0.845065832f, 0.203027502f},
-std::array<float,2>{0.267161518f, 0.784200966f},
-std::array<float,2>{0.881216228f, 0.889402449f},
-std::array<float,2>{0.37630716f, 0.116084412f},
-std::array<float,2>{0.745854735f, 0.313797235f},
-std::array<float,2>{0.0357856229f, 0.529225111f},
-std::array<float,2>{0.771750391f, 0.586961985f},
-std::array<float,2>{0.328852028f, 0.265089959f},
-std::array<float,2>{0.513111949f, 0.0162107237f},
-std::array<float,2>{0.17035909f, 0.973749876f},
-std::array<float,2>{0.644900739f, 0.869623661f},
-std::array<float,2>{0.0780521631f, 0.17607525f},
-std::array<float,2>{0.996460199f, 0.490189165f},
-std::array<float,2>{0.461763978f, 0.747625232f},
-std::array<float,2>{0.706731439f, 0.560759008f},
-std::array<float,2>{0.00963280536f, 0.369390935f},
-std::array<float,2>{0.913539529f, 0.0878626779f},
-std::array<float,2>{0.421894342f, 0.920176744f},
-std::array<float,2>{0.839567661f, 0.750916004f},
-std::array<float,2>{0.290324092f, 0.231793493f},
-std::array<float,2>{0.621581256f, 0.384481996f},
-std::array<float,2>{0.235171482f, 0.6473189f},
-std::array<float,2>{0.952332854f, 0.70653373f},
-std::array<float,2>{0.472524941f, 0.445385367f},
-std::array<float,2>{0.673515379f, 0.149610698f},
-std::array<float,2>{0.0978039652f, 0.832273126f},
-std::array<float,2>{0.551534116f, 0.949939907f},
-std::array<float,2>{0.152070403f, 0.0511654504f},
-std::array<float,2>{0.782209039f, 0.294014722f},
-std::array<float,2>{0.369458854f, 0.618144274f},
-std::array<float,2>{0.565324724f, 0.581044137f},
-std::array<float,2>{0.188136131f, 0.250146329f},
-std::array<float,2>{0.862164617f, 0.0285408441f},
-std::array<float,2>{0.259642452f, 0.979461789f},
-std::array<float,2>{0.901902199f, 0.864384711f},
-std::array<float,2>{0.392151922f, 0.184889361f},
-std::array<float,2>{0.725219905f, 0.498712569f},
-std::array<float,2>{0.0523040034f, 0.740682185f},
-std::array<float,2>{0.761315882f, 0.659647107f},
-std::array<float,2>{0.317318201f, 0.431839883f},
-std::array<float,2>{0.5194484f, 0.190303877f},
-std::array<float,2>{0.185046405f, 0.793462813f},
-std::array<float,2>{0.636766911f, 0.877862394f},
-std::array<float,2>{0.088253811f, 0.123717569f},
-std::array<float,2>{0.973900676f, 0.321076304f},
-std::array<float,2>{0.447743088f, 0.520594656f},
-std::array<float,2>{0.701650083f, 0.715662062f},
-std::array<float,2>{0.0240491219f, 0.439849585f},
-std::array<float,2>{0.935276151f, 0.142464176f},
-std::array<float,2>{0.409632295f, 0.836404204f},
-std::array<float,2>{0.815285623f, 0.945276201f},
-std::array<float,2>{0.300732911f, 0.0592579357f},
-std::array<float,2>{0.596431613f, 0.28571552f},
-std::array<float,2>{0.232669532f, 0.610259473f},
-std::array<float,2>{0.966603875f, 0.546952903f},
-std::array<float,2>{0.496807277f, 0.365815461f},
-std::array<float,2>{0.657484353f, 0.0783112124f},
-std::array<float,2>{0.122460984f, 0.909237087f},
-std::array<float,2>{0.54028827f, 0.761900485f},
-std::array<float,2>{0.134078443f, 0.223363817f},
-std::array<float,2>{0.798197687f, 0.376975894f},
-std::array<float,2>{0.35667029f, 0.653659105f},
-std::array<float,2>{0.511616945f, 0.636134386f},
-std::array<float,2>{0.165984079f, 0.401899517f},
-std::array<float,2>{0.767093718f, 0.244220123f},
-std::array<float,2>{0.335507691f, 0.766855121f},
-std::array<float,2>{0.994213104f, 0.92866087f},
-std::array<float,2>{0.465656161f, 0.0694001541f},
-std::array<float,2>{0.643539965f, 0.35349372f},
-std::array<float,2>{0.0712207034f, 0.540164292f},
-std::array<float,2>{0.84981221f, 0.604871452f},
-std::array<float,2>{0.273325026f, 0.312392116f},
-std::array<float,2>{0.579541385f, 0.033551719f},
-std::array<float,2>{0.208642215f, 0.957082212f},
-std::array<float,2>{0.746766388f, 0.822805226f},
-std::array<float,2>{0.0322789438f, 0.125845432f},
-std::array<float,2>{0.87620014f, 0.45519954f},
-std::array<float,2>{0.379180878f, 0.697393298f},
-std::array<float,2>{0.676341653f, 0.512824178f},
-std::array<float,2>{0.0938376859f, 0.32973069f},
-std::array<float,2>{0.946216166f, 0.0968388319f},
-std::array<float,2>{0.472847074f, 0.892295182f},
-std::array<float,2>{0.789055109f, 0.803985596f},
-std::array<float,2>{0.372759968f, 0.215674907f},
-std::array<float,2>{0.550286055f, 0.415496588f},
-std::array<float,2>{0.153509468f, 0.686503351f},
-std::array<float,2>{0.90872705f, 0.727573514f},
-std::array<float,2>{0.427433848f, 0.47218886f},
-std::array<float,2>{0.710833907f, 0.163512588f},
-std::array<float,2>{0.0150291324f, 0.849053264f},
-std::array<float,2>{0.617792904f, 0.993890822f},
-std::array<float,2>{0.239048734f, 0.0148814451f},
-std::array<float,2>{0.841053128f, 0.271211118f},
-std::array<float,2>{0.293554991f, 0.565747917f},
-std::array<float,2>{0.560894191f, 0.534202933f},
-std::array<float,2>{0.146045804f, 0.345773786f},
-std::array<float,2>{0.793382049f, 0.073377572f},
-std::array<float,2>{0.366463453f, 0.935083807f},
-std::array<float,2>{0.939587235f, 0.777148664f},
-std::array<float,2>{0.479856163f, 0.237995073f},
-std::array<float,2>{0.679907024f, 0.391062051f},
-std::array<float,2>{0.108453996f, 0.629037261f},
-std::array<float,2>{0.834027529f, 0.694704354f},
-std::array<float,2>{0.287338406f, 0.466737419f},
-std::array<float,2>{0.610524952f, 0.138620198f},
-std::array<float,2>{0.244728595f, 0.815322816f},
-std::array<float,2>{0.711203635f, 0.965666473f},
-std::array<float,2>{0.00490001217f, 0.0437252633f},
-std::array<float,2>{0.918219924f, 0.300440162f},
-std::array<float,2>{0.430711508f, 0.598923624f},
-std::array<float,2>{0.648444057f, 0.676672041f},
-std::array<float,2>{0.0656497851f, 0.409622014f},
-std::array<float,2>{0.986909389f, 0.205894858f},
-std::array<float,2>{0.459729493f, 0.805490971f},
-std::array<float,2>{0.780716836f, 0.905011117f},
-std::array<float,2>{0.341703206f, 0.106413715f},
-std::array<float,2>{0.505797327f, 0.339677542f},
-std::array<float,2>{0.156866938f, 0.500534296f},
-std::array<float,2>{0.887223423f, 0.57812494f},
-std::array<float,2>{0.39032647f, 0.278284878f},
-std::array<float,2>{0.741976798f, 0.00601842348f},
-std::array<float,2>{0.0429589562f, 0.991356611f},
-std::array<float,2>{0.59009403f, 0.856998503f},
-std::array<float,2>{0.21621874f, 0.171021625f},
-std::array<float,2>{0.853852689f, 0.477766544f},
-std::array<float,2>{0.278311104f, 0.721212327f},
-std::array<float,2>{0.603584051f, 0.743124604f},
-std::array<float,2>{0.222090021f, 0.487635642f},
-std::array<float,2>{0.824029803f, 0.174742103f},
-std::array<float,2>{0.310767829f, 0.871966064f},
-std::array<float,2>{0.926986873f, 0.969162881f},
-std::array<float,2>{0.417367011f, 0.020432638f},
-std::array<float,2>{0.689916492f, 0.258167505f},
-std::array<float,2>{0.0176023953f, 0.592379212f},
-std::array<float,2>{0.811053991f, 0.525045395f},
-std::array<float,2>{0.348936796f, 0.319051862f},
-std::array<float,2>{0.533216119f, 0.11192593f},
-std::array<float,2>{0.132219866f, 0.883020997f},
-std::array<float,2>{0.669137657f, 0.78621608f},
-std::array<float,2>{0.115987249f, 0.196759149f},
-std::array<float,2>{0.960150421f, 0.422688037f},
-std::array<float,2>{0.484588951f, 0.668208718f},
-std::array<float,2>{0.731903553f, 0.624306619f},
-std::array<float,2>{0.0553785861f, 0.291781187f},
-std::array<float,2>{0.894357502f, 0.0492403917f},
-std::array<float,2>{0.403535664f, 0.946237266f},
-std::array<float,2>{0.868172586f, 0.828296244f},
-std::array<float,2>{0.256739914f, 0.153421745f},
-std::array<float,2>{0.573942363f, 0.449974537f},
-std::array<float,2>{0.196835473f, 0.707647741f},
-std::array<float,2>{0.979225397f, 0.641873956f},
-std::array<float,2>{0.437576056f, 0.390615046f},
-std::array<float,2>{0.626955807f, 0.230381757f},
-std::array<float,2>{0.0799179971f, 0.754742622f},
-std::array<float,2>{0.524058223f, 0.915911317f},
-std::array<float,2>{0.1781452f, 0.090894714f},
-std::array<float,2>{0.756685376f, 0.373683363f},
-std::array<float,2>{0.323551208f, 0.555301189f},
-std::array<float,2>{0.575486422f, 0.511199117f},
-std::array<float,2>{0.19949013f, 0.33325994f},
-std::array<float,2>{0.872795165f, 0.101074502f},
-std::array<float,2>{0.25237301f, 0.897613168f},
-std::array<float,2>{0.896093726f, 0.800656259f},
-std::array<float,2>{0.401942223f, 0.214054927f},
-std::array<float,2>{0.729102671f, 0.420303941f},
-std::array<float,2>{0.0589464195f, 0.680396736f},
-std::array<float,2>{0.753781199f, 0.731440783f},
-std::array<float,2>{0.324617475f, 0.474504799f},
-std::array<float,2>{0.528995931f, 0.156341136f},
-std::array<float,2>{0.172511935f, 0.846256852f},
-std::array<float,2>{0.629606247f, 0.997402072f},
-std::array<float,2>{0.0844759792f, 0.0115091112f},
-std::array<float,2>{0.980890036f, 0.268348634f},
-std::array<float,2>{0.444690555f, 0.568711102f},
-std::array<float,2>{0.69501394f, 0.638779759f},
-std::array<float,2>{0.0229308344f, 0.405613154f},
-std::array<float,2>{0.923297584f, 0.246829972f},
-std::array<float,2>{0.420796871f, 0.77127409f},
-std::array<float,2>{0.825784624f, 0.923007786f},
-std::array<float,2>{0.30812946f, 0.0638852492f},
-std::array<float,2>{0.608853936f, 0.357393265f},
-std::array<float,2>{0.2260869f, 0.54652065f},
-std::array<float,2>{0.955283284f, 0.605721712f},
-std::array<float,2>{0.490121663f, 0.307087064f},
-std::array<float,2>{0.666905105f, 0.0382889286f},
-std::array<float,2>{0.109469168f, 0.956074059f},
-std::array<float,2>{0.536488295f, 0.827318549f},
-std::array<float,2>{0.127135515f, 0.132532567f},
-std::array<float,2>{0.805397809f, 0.458314657f},
-std::array<float,2>{0.347436041f, 0.70120424f},
-std::array<float,2>{0.503359973f, 0.713619709f},
-std::array<float,2>{0.160528153f, 0.444817334f},
-std::array<float,2>{0.774543703f, 0.146904141f},
-std::array<float,2>{0.336668819f, 0.843609869f},
-std::array<float,2>{0.990488052f, 0.938075304f},
-std::array<float,2>{0.454369396f, 0.0575769395f},
-std::array<float,2>{0.654112458f, 0.284989685f},
-std::array<float,2>{0.0692340434f, 0.615340889f},
-std::array<float,2>{0.855547667f, 0.553639531f},
-std::array<float,2>{0.275936157f, 0.360685766f},
-std::array<float,2>{0.588470578f, 0.0845234692f},
-std::array<float,2>{0.212303624f, 0.910439909f},
-std::array<float,2>{0.738150179f, 0.759391129f},
-std::array<float,2>{0.0444093198f, 0.219255447f},
-std::array<float,2>{0.885507286f, 0.382343233f},
-std::array<float,2>{0.385463029f, 0.649540126f},
-std::array<float,2>{0.687323987f, 0.582787514f},
-std::array<float,2>{0.10447026f, 0.257208347f},
-std::array<float,2>{0.94308722f, 0.0243709348f},
-std::array<float,2>{0.483993709f, 0.981179118f},
-std::array<float,2>{0.790387571f, 0.860006452f},
-std::array<float,2>{0.362909019f, 0.181593731f},
-std::array<float,2>{0.555995762f, 0.492558181f},
-std::array<float,2>{0.143309802f, 0.737325907f},
-std::array<float,2>{0.914485872f, 0.660527945f},
-std::array<float,2>{0.435711324f, 0.434058189f},
-std::array<float,2>{0.716899693f, 0.192370504f},
-std::array<float,2>{0.000310184609f, 0.790300012f},
-std::array<float,2>{0.614350617f, 0.881227553f},
-std::array<float,2>{0.24993892f, 0.119320676f},
-std::array<float,2>{0.829314351f, 0.325294256f},
-std::array<float,2>{0.282751501f, 0.5161677f},
-std::array<float,2>{0.552973509f, 0.618200421f},
-std::array<float,2>{0.149556458f, 0.29325068f},
-std::array<float,2>{0.784092844f, 0.0519341119f},
-std::array<float,2>{0.368088752f, 0.950408936f},
-std::array<float,2>{0.949439108f, 0.833233595f},
-std::array<float,2>{0.470516741f, 0.149260268f},
-std::array<float,2>{0.674543858f, 0.446504891f},
-std::array<float,2>{0.100484565f, 0.706032515f},
-std::array<float,2>{0.836969495f, 0.648329616f},
-std::array<float,2>{0.291353792f, 0.383786052f},
-std::array<float,2>{0.623737454f, 0.230499506f},
-std::array<float,2>{0.237219378f, 0.751717806f},
-std::array<float,2>{0.704444885f, 0.921045423f},
-std::array<float,2>{0.0103926221f, 0.0863099396f},
-std::array<float,2>{0.910816848f, 0.37105602f},
-std::array<float,2>{0.424589366f, 0.561562121f},
-std::array<float,2>{0.646896541f, 0.746539593f},
-std::array<float,2>{0.0759029463f, 0.48854959f},
-std::array<float,2>{0.998278379f, 0.177534357f},
-std::array<float,2>{0.464047521f, 0.870617867f},
-std::array<float,2>{0.770201802f, 0.972838044f},
-std::array<float,2>{0.330454826f, 0.0171653293f},
-std::array<float,2>{0.51480639f, 0.264255375f},
-std::array<float,2>{0.168177009f, 0.586174548f},
-std::array<float,2>{0.880364001f, 0.528010011f},
-std::array<float,2>{0.378730386f, 0.312731504f},
-std::array<float,2>{0.743324637f, 0.116425209f},
-std::array<float,2>{0.0384020396f, 0.889817894f},
-std::array<float,2>{0.58303529f, 0.784049034f},
-std::array<float,2>{0.206666484f, 0.201441988f},
-std::array<float,2>{0.847500622f, 0.427363217f},
-std::array<float,2>{0.268678337f, 0.66573298f},
-std::array<float,2>{0.599063039f, 0.672255456f},
-std::array<float,2>{0.229141623f, 0.412979096f},
-std::array<float,2>{0.819370449f, 0.210258976f},
-std::array<float,2>{0.301278323f, 0.808815122f},
-std::array<float,2>{0.930998743f, 0.901803195f},
-std::array<float,2>{0.411764175f, 0.104841433f},
-std::array<float,2>{0.696814179f, 0.342280835f},
-std::array<float,2>{0.0279578231f, 0.506115198f},
-std::array<float,2>{0.802883506f, 0.570671976f},
-std::array<float,2>{0.353600264f, 0.274936289f},
-std::array<float,2>{0.546067476f, 0.00250206143f},
-std::array<float,2>{0.137268335f, 0.986444235f},
-std::array<float,2>{0.662493169f, 0.855143964f},
-std::array<float,2>{0.118841745f, 0.167482495f},
-std::array<float,2>{0.960961819f, 0.483093917f},
-std::array<float,2>{0.493009508f, 0.723348975f},
-std::array<float,2>{0.721542418f, 0.538940072f},
-std::array<float,2>{0.0498949997f, 0.349651933f},
-std::array<float,2>{0.904117942f, 0.0755370483f},
-std::array<float,2>{0.397182375f, 0.933086157f},
-std::array<float,2>{0.866887808f, 0.779816747f},
-std::array<float,2>{0.26226601f, 0.241179422f},
-std::array<float,2>{0.569215357f, 0.398123175f},
-std::array<float,2>{0.192962974f, 0.626336098f},
-std::array<float,2>{0.970420659f, 0.691055775f},
-std::array<float,2>{0.449682176f, 0.461813986f},
-std::array<float,2>{0.635315299f, 0.135112837f},
-std::array<float,2>{0.0908904374f, 0.818023503f},
-std::array<float,2>{0.522233963f, 0.964086592f},
-std::array<float,2>{0.182302579f, 0.0428189524f},
-std::array<float,2>{0.765568018f, 0.3045789f},
-std::array<float,2>{0.314590693f, 0.593858778f},
-std::array<float,2>{0.619897246f, 0.564797878f},
-std::array<float,2>{0.240999967f, 0.270031273f},
-std::array<float,2>{0.842227817f, 0.0144832162f},
-std::array<float,2>{0.295798242f, 0.992280543f},
-std::array<float,2>{0.907114744f, 0.848474801f},
-std::array<float,2>{0.42787692f, 0.16236788f},
-std::array<float,2>{0.708829224f, 0.471640289f},
-std::array<float,2>{0.0126698567f, 0.727095604f},
-std::array<float,2>{0.78676486f, 0.686756313f},
-std::array<float,2>{0.374431193f, 0.414241672f},
-std::array<float,2>{0.548268855f, 0.216549307f},
-std::array<float,2>{0.154960245f, 0.803353012f},
-std::array<float,2>{0.679099739f, 0.89070034f},
-std::array<float,2>{0.0968083665f, 0.0963384286f},
-std::array<float,2>{0.949046195f, 0.328597248f},
-std::array<float,2>{0.476346761f, 0.512272298f},
-std::array<float,2>{0.748630106f, 0.698473215f},
-std::array<float,2>{0.0340778157f, 0.456129074f},
-std::array<float,2>{0.877654016f, 0.126309678f},
-std::array<float,2>{0.382068276f, 0.823297858f},
-std::array<float,2>{0.848084748f, 0.958065391f},
-std::array<float,2>{0.269926906f, 0.0347549245f},
-std::array<float,2>{0.581816971f, 0.311227441f},
-std::array<float,2>{0.209349349f, 0.603855729f},
-std::array<float,2>{0.993316352f, 0.539162517f},
-std::array<float,2>{0.46680367f, 0.352227032f},
-std::array<float,2>{0.641206086f, 0.0684054866f},
-std::array<float,2>{0.0737536252f, 0.929333031f},
-std::array<float,2>{0.508821249f, 0.76586473f},
-std::array<float,2>{0.166882142f, 0.246004358f},
-std::array<float,2>{0.769409537f, 0.40060848f},
-std::array<float,2>{0.33365798f, 0.635367513f},
-std::array<float,2>{0.541760743f, 0.65242672f},
-std::array<float,2>{0.135184363f, 0.37865898f},
-std::array<float,2>{0.800725579f, 0.223650426f},
-std::array<float,2>{0.358062893f, 0.762872398f},
-std::array<float,2>{0.968162119f, 0.908333302f},
-std::array<float,2>{0.49815926f, 0.0800117925f},
-std::array<float,2>{0.659245431f, 0.366863102f},
-std::array<float,2>{0.123523273f, 0.548309922f},
-std::array<float,2>{0.813856542f, 0.611141801f},
-std::array<float,2>{0.296968848f, 0.286240101f},
-std::array<float,2>{0.595424831f, 0.0600446239f},
-std::array<float,2>{0.231120095f, 0.943554044f},
-std::array<float,2>{0.699614823f, 0.837199569f},
-std::array<float,2>{0.0264122039f, 0.140858129f},
-std::array<float,2>{0.937235057f, 0.441388726f},
-std::array<float,2>{0.407221138f, 0.716684401f},
-std::array<float,2>{0.639717162f, 0.520162463f},
-std::array<float,2>{0.0874985531f, 0.321610868f},
-std::array<float,2>{0.974800229f, 0.124210015f},
-std::array<float,2>{0.445332527f, 0.878672957f},
-std::array<float,2>{0.758039296f, 0.794780552f},
-std::array<float,2>{0.319035798f, 0.190745801f},
-std::array<float,2>{0.517279267f, 0.433275819f},
-std::array<float,2>{0.186571166f, 0.658460677f},
-std::array<float,2>{0.899095953f, 0.742163479f},
-std::array<float,2>{0.393400043f, 0.499344349f},
-std::array<float,2>{0.724253297f, 0.18403171f},
-std::array<float,2>{0.0533625223f, 0.864022255f},
-std::array<float,2>{0.563280702f, 0.979611099f},
-std::array<float,2>{0.190624103f, 0.0277688541f},
-std::array<float,2>{0.859594107f, 0.251651645f},
-std::array<float,2>{0.260079145f, 0.582024395f},
-std::array<float,2>{0.526561499f, 0.556001663f},
-std::array<float,2>{0.177171201f, 0.374802649f},
-std::array<float,2>{0.754777491f, 0.0906043127f},
-std::array<float,2>{0.320359498f, 0.914479256f},
-std::array<float,2>{0.978324413f, 0.755301595f},
-std::array<float,2>{0.44038856f, 0.229463518f},
-std::array<float,2>{0.625891745f, 0.388885826f},
-std::array<float,2>{0.0802415907f, 0.640898168f},
-std::array<float,2>{0.870173275f, 0.708748579f},
-std::array<float,2>{0.255607098f, 0.451066822f},
-std::array<float,2>{0.570807159f, 0.152591288f},
-std::array<float,2>{0.198538408f, 0.829173863f},
-std::array<float,2>{0.733729362f, 0.946430683f},
-std::array<float,2>{0.0579524636f, 0.049978599f},
-std::array<float,2>{0.891570628f, 0.291996121f},
-std::array<float,2>{0.404789299f, 0.623179257f},
-std::array<float,2>{0.67103678f, 0.669152021f},
-std::array<float,2>{0.114898212f, 0.423446f},
-std::array<float,2>{0.958706975f, 0.195638686f},
-std::array<float,2>{0.48753643f, 0.785824597f},
-std::array<float,2>{0.809655428f, 0.884187162f},
-std::array<float,2>{0.349839896f, 0.112459786f},
-std::array<float,2>{0.531514108f, 0.319522649f},
-std::array<float,2>{0.129536018f, 0.524185598f},
-std::array<float,2>{0.928924203f, 0.593553066f},
-std::array<float,2>{0.414984435f, 0.25970754f},
-std::array<float,2>{0.688088536f, 0.0211849865f},
-std::array<float,2>{0.0164452605f, 0.969881654f},
-std::array<float,2>{0.60238111f, 0.872218132f},
-std::array<float,2>{0.219241142f, 0.175383419f},
-std::array<float,2>{0.821038961f, 0.486937135f},
-std::array<float,2>{0.308975965f, 0.74369961f},
-std::array<float,2>{0.593078911f, 0.722509027f},
-std::array<float,2>{0.218237981f, 0.476801425f},
-std::array<float,2>{0.851875126f, 0.170425743f},
-std::array<float,2>{0.280604571f, 0.855792582f},
-std::array<float,2>{0.888774395f, 0.99105829f},
-std::array<float,2>{0.388668537f, 0.00709341839f},
-std::array<float,2>{0.738469005f, 0.278424382f},
-std::array<float,2>{0.0402240306f, 0.576596856f},
-std::array<float,2>{0.778249979f, 0.501565337f},
-std::array<float,2>{0.343192309f, 0.338192344f},
-std::array<float,2>{0.50689137f, 0.10727571f},
-std::array<float,2>{0.158814505f, 0.905933499f},
-std::array<float,2>{0.651141226f, 0.805819154f},
-std::array<float,2>{0.0643049404f, 0.206887156f},
-std::array<float,2>{0.985029995f, 0.408770233f},
-std::array<float,2>{0.45785737f, 0.677712798f},
-std::array<float,2>{0.714343429f, 0.597838998f},
-std::array<float,2>{0.00627960451f, 0.2993927f},
-std::array<float,2>{0.92032218f, 0.0440340154f},
-std::array<float,2>{0.433092862f, 0.966305554f},
-std::array<float,2>{0.832084954f, 0.816324234f},
-std::array<float,2>{0.286748052f, 0.137270331f},
-std::array<float,2>{0.612370431f, 0.465452045f},
-std::array<float,2>{0.243565559f, 0.693511963f},
-std::array<float,2>{0.939216614f, 0.630858302f},
-std::array<float,2>{0.478443891f, 0.391998023f},
-std::array<float,2>{0.682647765f, 0.236877143f},
-std::array<float,2>{0.106237754f, 0.775523484f},
-std::array<float,2>{0.559815705f, 0.934372485f},
-std::array<float,2>{0.147284672f, 0.0732012317f},
-std::array<float,2>{0.795180261f, 0.347058177f},
-std::array<float,2>{0.364699364f, 0.534029365f},
-std::array<float,2>{0.605520844f, 0.543470681f},
-std::array<float,2>{0.223081186f, 0.359163284f},
-std::array<float,2>{0.827826023f, 0.0651502982f},
-std::array<float,2>{0.305111527f, 0.924189687f},
-std::array<float,2>{0.924554527f, 0.772512972f},
-std::array<float,2>{0.418944001f, 0.249913529f},
-std::array<float,2>{0.693233132f, 0.402965844f},
-std::array<float,2>{0.0210968684f, 0.637240052f},
-std::array<float,2>{0.807783306f, 0.699948967f},
-std::array<float,2>{0.344919026f, 0.459989876f},
-std::array<float,2>{0.538033962f, 0.129720747f},
-std::array<float,2>{0.125243947f, 0.824823737f},
-std::array<float,2>{0.665657938f, 0.953980088f},
-std::array<float,2>{0.112406202f, 0.0367234051f},
-std::array<float,2>{0.953960598f, 0.306282222f},
-std::array<float,2>{0.492136151f, 0.609038353f},
-std::array<float,2>{0.726866066f, 0.681950629f},
-std::array<float,2>{0.0624232925f, 0.418091893f},
-std::array<float,2>{0.89695394f, 0.210972056f},
-std::array<float,2>{0.398824424f, 0.797524571f},
-std::array<float,2>{0.874539196f, 0.8959198f},
-std::array<float,2>{0.251498818f, 0.098492384f},
-std::array<float,2>{0.57771486f, 0.335669875f},
-std::array<float,2>{0.201437384f, 0.5089252f},
-std::array<float,2>{0.983865798f, 0.568334401f},
-std::array<float,2>{0.44184351f, 0.267345965f},
-std::array<float,2>{0.632153869f, 0.00877166539f},
-std::array<float,2>{0.0832996443f, 0.999796152f},
-std::array<float,2>{0.52997154f, 0.844890416f},
-std::array<float,2>{0.175019085f, 0.158321604f},
-std::array<float,2>{0.751734734f, 0.475541025f},
-std::array<float,2>{0.326485753f, 0.733176291f},
-std::array<float,2>{0.55727303f, 0.735842168f},
-std::array<float,2>{0.141608164f, 0.495705336f},
-std::array<float,2>{0.791557848f, 0.182776004f},
-std::array<float,2>{0.359974384f, 0.86196959f},
-std::array<float,2>{0.943465471f, 0.983555019f},
-std::array<float,2>{0.480814904f, 0.0255316515f},
-std::array<float,2>{0.68405962f, 0.254241645f},
-std::array<float,2>{0.103002466f, 0.584180713f},
-std::array<float,2>{0.831010997f, 0.51884675f},
-std::array<float,2>{0.285126388f, 0.327090323f},
-std::array<float,2>{0.616996408f, 0.118901759f},
-std::array<float,2>{0.246925682f, 0.880299985f},
-std::array<float,2>{0.715192497f, 0.79117769f},
-std::array<float,2>{0.00336550595f, 0.194613189f},
-std::array<float,2>{0.916119635f, 0.435900867f},
-std::array<float,2>{0.434340745f, 0.663180232f},
-std::array<float,2>{0.655734956f, 0.613617182f},
-std::array<float,2>{0.0666273087f, 0.282847136f},
-std::array<float,2>{0.990181744f, 0.0549648814f},
-std::array<float,2>{0.456345528f, 0.939965844f},
-std::array<float,2>{0.776063204f, 0.84072566f},
-std::array<float,2>{0.338320732f, 0.144982755f},
-std::array<float,2>{0.501133323f, 0.442876339f},
-std::array<float,2>{0.163423806f, 0.712882936f},
-std::array<float,2>{0.883283854f, 0.651377857f},
-std::array<float,2>{0.38291952f, 0.380689144f},
-std::array<float,2>{0.735453725f, 0.221493393f},
-std::array<float,2>{0.0460804962f, 0.761101127f},
-std::array<float,2>{0.587877214f, 0.912221134f},
-std::array<float,2>{0.21329248f, 0.0821217746f},
-std::array<float,2>{0.8581779f, 0.361817509f},
-std::array<float,2>{0.274681062f, 0.552576959f},
-std::array<float,2>{0.512483954f, 0.588610947f},
-std::array<float,2>{0.17137669f, 0.261868417f},
-std::array<float,2>{0.773167372f, 0.0194089562f},
-std::array<float,2>{0.329201102f, 0.974956334f},
-std::array<float,2>{0.997306824f, 0.867493272f},
-std::array<float,2>{0.462573022f, 0.178751484f},
-std::array<float,2>{0.645827234f, 0.491355926f},
-std::array<float,2>{0.0771445483f, 0.748390555f},
-std::array<float,2>{0.844141066f, 0.666840076f},
-std::array<float,2>{0.266548812f, 0.428456068f},
-std::array<float,2>{0.585819662f, 0.200839996f},
-std::array<float,2>{0.204185024f, 0.783088207f},
-std::array<float,2>{0.744588017f, 0.887549698f},
-std::array<float,2>{0.0369422957f, 0.114530273f},
-std::array<float,2>{0.882176399f, 0.315800667f},
-std::array<float,2>{0.3758775f, 0.530866683f},
-std::array<float,2>{0.672323048f, 0.703779995f},
-std::array<float,2>{0.0995525867f, 0.447281539f},
-std::array<float,2>{0.951912344f, 0.151035443f},
-std::array<float,2>{0.47162661f, 0.834946096f},
-std::array<float,2>{0.783155739f, 0.952029586f},
-std::array<float,2>{0.370209962f, 0.052966889f},
-std::array<float,2>{0.552213252f, 0.295221508f},
-std::array<float,2>{0.151086971f, 0.619493842f},
-std::array<float,2>{0.91293484f, 0.560080588f},
-std::array<float,2>{0.422873855f, 0.368002266f},
-std::array<float,2>{0.705474198f, 0.0898388773f},
-std::array<float,2>{0.0079174526f, 0.919023097f},
-std::array<float,2>{0.622769415f, 0.751955807f},
-std::array<float,2>{0.236229897f, 0.232661963f},
-std::array<float,2>{0.838617444f, 0.386454493f},
-std::array<float,2>{0.289679796f, 0.646244228f},
-std::array<float,2>{0.566409111f, 0.628247738f},
-std::array<float,2>{0.193928674f, 0.395747781f},
-std::array<float,2>{0.863896847f, 0.23836346f},
-std::array<float,2>{0.264180303f, 0.778267562f},
-std::array<float,2>{0.905728579f, 0.931445539f},
-std::array<float,2>{0.396334291f, 0.0772421136f},
-std::array<float,2>{0.719100058f, 0.347658455f},
-std::array<float,2>{0.0473096259f, 0.535198569f},
-std::array<float,2>{0.762212694f, 0.597046733f},
-std::array<float,2>{0.312545896f, 0.302559108f},
-std::array<float,2>{0.519754589f, 0.0405009761f},
-std::array<float,2>{0.179804578f, 0.961700141f},
-std::array<float,2>{0.634442747f, 0.819002211f},
-std::array<float,2>{0.0929932371f, 0.13336347f},
-std::array<float,2>{0.972588718f, 0.462967038f},
-std::array<float,2>{0.452494204f, 0.688916147f},
-std::array<float,2>{0.698945701f, 0.504183829f},
-std::array<float,2>{0.0301059429f, 0.340036392f},
-std::array<float,2>{0.931934953f, 0.101639308f},
-std::array<float,2>{0.4124735f, 0.898448527f},
-std::array<float,2>{0.81787467f, 0.812049091f},
-std::array<float,2>{0.30389294f, 0.208263785f},
-std::array<float,2>{0.600437284f, 0.411330074f},
-std::array<float,2>{0.227296814f, 0.674760342f},
-std::array<float,2>{0.963638365f, 0.726107836f},
-std::array<float,2>{0.495164275f, 0.48133561f},
-std::array<float,2>{0.660572052f, 0.164706677f},
-std::array<float,2>{0.120108694f, 0.851863682f},
-std::array<float,2>{0.544591308f, 0.984589875f},
-std::array<float,2>{0.139779672f, 1.24840817e-05f},
-std::array<float,2>{0.802128136f, 0.277249962f},
-std::array<float,2>{0.353498697f, 0.572291672f},
-std::array<float,2>{0.578692853f, 0.602213204f},
-std::array<float,2>{0.207997888f, 0.309479296f},
-std::array<float,2>{0.851550043f, 0.0312848538f},
-std::array<float,2>{0.271664917f, 0.959273517f},
-std::array<float,2>{0.875693619f, 0.821019769f},
-std::array<float,2>{0.379943848f, 0.1273029f},
-std::array<float,2>{0.74744904f, 0.455011427f},
-std::array<float,2>{0.0320644118f, 0.69685936f},
-std::array<float,2>{0.7659958f, 0.633511543f},
-std::array<float,2>{0.334622324f, 0.399968117f},
-std::array<float,2>{0.510063887f, 0.243102521f},
-std::array<float,2>{0.164993659f, 0.769279897f},
-std::array<float,2>{0.643633366f, 0.926480055f},
-std::array<float,2>{0.0718948767f, 0.0669683889f},
-std::array<float,2>{0.995998383f, 0.354346693f},
-std::array<float,2>{0.466561943f, 0.54167825f},
-std::array<float,2>{0.709725678f, 0.728856266f},
-std::array<float,2>{0.0136922989f, 0.470546156f},
-std::array<float,2>{0.909875929f, 0.160245493f},
-std::array<float,2>{0.426035911f, 0.849821627f},
-std::array<float,2>{0.839936078f, 0.99522984f},
-std::array<float,2>{0.293955505f, 0.011991689f},
-std::array<float,2>{0.618318021f, 0.272333056f},
-std::array<float,2>{0.240083784f, 0.563591003f},
-std::array<float,2>{0.947169304f, 0.514462531f},
-std::array<float,2>{0.474131972f, 0.330218971f},
-std::array<float,2>{0.676845312f, 0.0940428972f},
-std::array<float,2>{0.0954198167f, 0.8944242f},
-std::array<float,2>{0.549672961f, 0.80179894f},
-std::array<float,2>{0.153039455f, 0.217648476f},
-std::array<float,2>{0.788046002f, 0.417731255f},
-std::array<float,2>{0.371638715f, 0.684602976f},
-std::array<float,2>{0.517885864f, 0.656992555f},
-std::array<float,2>{0.184211478f, 0.431234747f},
-std::array<float,2>{0.76044488f, 0.188885167f},
-std::array<float,2>{0.317781776f, 0.796100199f},
-std::array<float,2>{0.972888231f, 0.875642359f},
-std::array<float,2>{0.448369116f, 0.12155021f},
-std::array<float,2>{0.638046801f, 0.324104846f},
-std::array<float,2>{0.0891648903f, 0.522459149f},
-std::array<float,2>{0.862499297f, 0.579279125f},
-std::array<float,2>{0.25868234f, 0.253112048f},
-std::array<float,2>{0.566214681f, 0.0298156068f},
-std::array<float,2>{0.189423531f, 0.976923466f},
-std::array<float,2>{0.726001203f, 0.866175771f},
-std::array<float,2>{0.05160705f, 0.186461926f},
-std::array<float,2>{0.900858581f, 0.497395158f},
-std::array<float,2>{0.391283631f, 0.738655567f},
-std::array<float,2>{0.656548858f, 0.550682187f},
-std::array<float,2>{0.121259093f, 0.364502668f},
-std::array<float,2>{0.965417266f, 0.0812848806f},
-std::array<float,2>{0.497198403f, 0.906391144f},
-std::array<float,2>{0.797838986f, 0.764323711f},
-std::array<float,2>{0.355994165f, 0.22640577f},
-std::array<float,2>{0.539362192f, 0.37515831f},
-std::array<float,2>{0.132831439f, 0.65515846f},
-std::array<float,2>{0.93416208f, 0.718543589f},
-std::array<float,2>{0.4084059f, 0.439255148f},
-std::array<float,2>{0.702541232f, 0.144461215f},
-std::array<float,2>{0.0244465936f, 0.838412702f},
-std::array<float,2>{0.59709394f, 0.94272536f},
-std::array<float,2>{0.233971536f, 0.0619184114f},
-std::array<float,2>{0.815637887f, 0.288075179f},
-std::array<float,2>{0.29889676f, 0.61201328f},
-std::array<float,2>{0.534420311f, 0.527032971f},
-std::array<float,2>{0.130963847f, 0.316804439f},
-std::array<float,2>{0.812247753f, 0.110744543f},
-std::array<float,2>{0.348409712f, 0.885468602f},
-std::array<float,2>{0.959138095f, 0.787608325f},
-std::array<float,2>{0.485694736f, 0.197763771f},
-std::array<float,2>{0.668644071f, 0.424547404f},
-std::array<float,2>{0.116744518f, 0.671275735f},
-std::array<float,2>{0.822607398f, 0.744225264f},
-std::array<float,2>{0.311602265f, 0.486122131f},
-std::array<float,2>{0.604870856f, 0.173145249f},
-std::array<float,2>{0.221258804f, 0.874611855f},
-std::array<float,2>{0.691098213f, 0.972490907f},
-std::array<float,2>{0.0190786272f, 0.0220240783f},
-std::array<float,2>{0.925817907f, 0.260232598f},
-std::array<float,2>{0.416391045f, 0.590832651f},
-std::array<float,2>{0.628415108f, 0.643209994f},
-std::array<float,2>{0.0781407058f, 0.388599604f},
-std::array<float,2>{0.979558945f, 0.228380769f},
-std::array<float,2>{0.43905884f, 0.756916165f},
-std::array<float,2>{0.757504106f, 0.916958153f},
-std::array<float,2>{0.32235074f, 0.0928884074f},
-std::array<float,2>{0.524843216f, 0.372394532f},
-std::array<float,2>{0.178712666f, 0.558549166f},
-std::array<float,2>{0.893487692f, 0.621500373f},
-std::array<float,2>{0.40285334f, 0.29011941f},
-std::array<float,2>{0.731118023f, 0.0482879728f},
-std::array<float,2>{0.0565405712f, 0.948271632f},
-std::array<float,2>{0.572314441f, 0.830608666f},
-std::array<float,2>{0.19549647f, 0.155646101f},
-std::array<float,2>{0.867218733f, 0.452063054f},
-std::array<float,2>{0.256844282f, 0.709162652f},
-std::array<float,2>{0.610109627f, 0.693138361f},
-std::array<float,2>{0.245457679f, 0.468346417f},
-std::array<float,2>{0.835460544f, 0.140209749f},
-std::array<float,2>{0.288699567f, 0.81335634f},
-std::array<float,2>{0.919499755f, 0.967933297f},
-std::array<float,2>{0.43024379f, 0.0454240739f},
-std::array<float,2>{0.712762296f, 0.298373193f},
-std::array<float,2>{0.00450326176f, 0.601308584f},
-std::array<float,2>{0.794220865f, 0.533095777f},
-std::array<float,2>{0.36552301f, 0.345158279f},
-std::array<float,2>{0.561654329f, 0.0721058324f},
-std::array<float,2>{0.145265982f, 0.937051952f},
-std::array<float,2>{0.681368887f, 0.773600876f},
-std::array<float,2>{0.108366206f, 0.234931126f},
-std::array<float,2>{0.941238642f, 0.393875539f},
-std::array<float,2>{0.479487926f, 0.632256627f},
-std::array<float,2>{0.740250349f, 0.574228346f},
-std::array<float,2>{0.0414738096f, 0.280618906f},
-std::array<float,2>{0.888031423f, 0.00576881832f},
-std::array<float,2>{0.389367104f, 0.988418102f},
-std::array<float,2>{0.854572594f, 0.857608736f},
-std::array<float,2>{0.279005527f, 0.168116003f},
-std::array<float,2>{0.59083271f, 0.480284721f},
-std::array<float,2>{0.215075225f, 0.718945444f},
-std::array<float,2>{0.987553f, 0.678415418f},
-std::array<float,2>{0.460107863f, 0.407592714f},
-std::array<float,2>{0.650040269f, 0.203905284f},
-std::array<float,2>{0.0645177141f, 0.808346272f},
-std::array<float,2>{0.504083097f, 0.903900981f},
-std::array<float,2>{0.158183455f, 0.109178536f},
-std::array<float,2>{0.779816866f, 0.337306231f},
-std::array<float,2>{0.340039045f, 0.503759086f},
-std::array<float,2>{0.568653464f, 0.535938025f},
-std::array<float,2>{0.19282423f, 0.348287642f},
-std::array<float,2>{0.866385698f, 0.0780548453f},
-std::array<float,2>{0.261988997f, 0.930700302f},
-std::array<float,2>{0.903790891f, 0.777670026f},
-std::array<float,2>{0.396887898f, 0.238781616f},
-std::array<float,2>{0.72094363f, 0.396292537f},
-std::array<float,2>{0.0506363809f, 0.628861427f},
-std::array<float,2>{0.765116811f, 0.689291537f},
-std::array<float,2>{0.315234482f, 0.463668257f},
-std::array<float,2>{0.521774113f, 0.132866681f},
-std::array<float,2>{0.181792349f, 0.818823397f},
-std::array<float,2>{0.635061502f, 0.961362004f},
-std::array<float,2>{0.0917763487f, 0.0408188365f},
-std::array<float,2>{0.970022678f, 0.302151084f},
-std::array<float,2>{0.449851632f, 0.59735465f},
-std::array<float,2>{0.696553349f, 0.674244046f},
-std::array<float,2>{0.0278072041f, 0.411782235f},
-std::array<float,2>{0.931625247f, 0.208946079f},
-std::array<float,2>{0.411289722f, 0.811532795f},
-std::array<float,2>{0.820296705f, 0.89933151f},
-std::array<float,2>{0.300963044f, 0.10206183f},
-std::array<float,2>{0.599372566f, 0.340813726f},
-std::array<float,2>{0.228763893f, 0.504670024f},
-std::array<float,2>{0.961505771f, 0.572993279f},
-std::array<float,2>{0.492432386f, 0.276572496f},
-std::array<float,2>{0.662745416f, 0.000607892522f},
-std::array<float,2>{0.118311971f, 0.985034406f},
-std::array<float,2>{0.546525061f, 0.852176547f},
-std::array<float,2>{0.136846453f, 0.164129823f},
-std::array<float,2>{0.80332756f, 0.480876833f},
-std::array<float,2>{0.354237348f, 0.725959659f},
-std::array<float,2>{0.515523732f, 0.749023378f},
-std::array<float,2>{0.168530911f, 0.491775036f},
-std::array<float,2>{0.769879222f, 0.179612473f},
-std::array<float,2>{0.330617219f, 0.867715597f},
-std::array<float,2>{0.998657703f, 0.975399971f},
-std::array<float,2>{0.464709163f, 0.0190054066f},
-std::array<float,2>{0.647165477f, 0.262416691f},
-std::array<float,2>{0.0754218027f, 0.588250518f},
-std::array<float,2>{0.846938848f, 0.530363917f},
-std::array<float,2>{0.269511402f, 0.315961272f},
-std::array<float,2>{0.583918929f, 0.115105987f},
-std::array<float,2>{0.206482351f, 0.88711834f},
-std::array<float,2>{0.743666589f, 0.782329142f},
-std::array<float,2>{0.038938839f, 0.200285882f},
-std::array<float,2>{0.880588531f, 0.427850664f},
-std::array<float,2>{0.378364414f, 0.666143835f},
-std::array<float,2>{0.67394805f, 0.620083094f},
-std::array<float,2>{0.0999016017f, 0.295585632f},
-std::array<float,2>{0.949742019f, 0.0536901914f},
-std::array<float,2>{0.469799519f, 0.951475859f},
-std::array<float,2>{0.783527613f, 0.834427476f},
-std::array<float,2>{0.367459774f, 0.150543019f},
-std::array<float,2>{0.553223252f, 0.448132455f},
-std::array<float,2>{0.149976775f, 0.703330278f},
-std::array<float,2>{0.910388887f, 0.645564854f},
-std::array<float,2>{0.42407763f, 0.386012733f},
-std::array<float,2>{0.704675615f, 0.233365372f},
-std::array<float,2>{0.00995542016f, 0.752510726f},
-std::array<float,2>{0.623164058f, 0.91968137f},
-std::array<float,2>{0.23677133f, 0.0892142951f},
-std::array<float,2>{0.837643623f, 0.367501318f},
-std::array<float,2>{0.291902661f, 0.55998069f},
-std::array<float,2>{0.55639565f, 0.584910095f},
-std::array<float,2>{0.142677888f, 0.25441435f},
-std::array<float,2>{0.790578187f, 0.0262746662f},
-std::array<float,2>{0.362554848f, 0.983974993f},
-std::array<float,2>{0.942546368f, 0.861427605f},
-std::array<float,2>{0.483466119f, 0.18316476f},
-std::array<float,2>{0.686683297f, 0.495579183f},
-std::array<float,2>{0.10389182f, 0.73579663f},
-std::array<float,2>{0.82986033f, 0.663964868f},
-std::array<float,2>{0.282658458f, 0.436104298f},
-std::array<float,2>{0.615100265f, 0.194896802f},
-std::array<float,2>{0.24919641f, 0.791756809f},
-std::array<float,2>{0.717295527f, 0.880444765f},
-std::array<float,2>{0.000762298994f, 0.118187852f},
-std::array<float,2>{0.914950371f, 0.326541245f},
-std::array<float,2>{0.436272144f, 0.519231617f},
-std::array<float,2>{0.653361797f, 0.711947143f},
-std::array<float,2>{0.0688009858f, 0.442539215f},
-std::array<float,2>{0.991030157f, 0.145141408f},
-std::array<float,2>{0.454947233f, 0.840326607f},
-std::array<float,2>{0.775112271f, 0.939749539f},
-std::array<float,2>{0.335988373f, 0.0553311519f},
-std::array<float,2>{0.503818214f, 0.282588542f},
-std::array<float,2>{0.160916403f, 0.614103138f},
-std::array<float,2>{0.885129273f, 0.552202523f},
-std::array<float,2>{0.385205954f, 0.361543655f},
-std::array<float,2>{0.737529457f, 0.0829942897f},
-std::array<float,2>{0.0447527841f, 0.912722528f},
-std::array<float,2>{0.588015735f, 0.76139468f},
-std::array<float,2>{0.212457463f, 0.221006498f},
-std::array<float,2>{0.856027663f, 0.380138695f},
-std::array<float,2>{0.275646567f, 0.652112603f},
-std::array<float,2>{0.609315872f, 0.637039542f},
-std::array<float,2>{0.225780904f, 0.402751297f},
-std::array<float,2>{0.82532984f, 0.249173701f},
-std::array<float,2>{0.307964295f, 0.773280263f},
-std::array<float,2>{0.923434198f, 0.924757481f},
-std::array<float,2>{0.420352072f, 0.0648531839f},
-std::array<float,2>{0.694683492f, 0.358418107f},
-std::array<float,2>{0.0229753666f, 0.543354273f},
-std::array<float,2>{0.80517441f, 0.608690917f},
-std::array<float,2>{0.346790045f, 0.305926681f},
-std::array<float,2>{0.536850095f, 0.0364472419f},
-std::array<float,2>{0.127796143f, 0.953189075f},
-std::array<float,2>{0.666297674f, 0.824653149f},
-std::array<float,2>{0.110154681f, 0.129363f},
-std::array<float,2>{0.955659747f, 0.460753739f},
-std::array<float,2>{0.489627182f, 0.699482322f},
-std::array<float,2>{0.72860992f, 0.509553909f},
-std::array<float,2>{0.0592247173f, 0.335273415f},
-std::array<float,2>{0.895884812f, 0.0978904217f},
-std::array<float,2>{0.401684225f, 0.896470726f},
-std::array<float,2>{0.872524142f, 0.797313988f},
-std::array<float,2>{0.252759755f, 0.211683661f},
-std::array<float,2>{0.575707674f, 0.41876474f},
-std::array<float,2>{0.199893594f, 0.682471514f},
-std::array<float,2>{0.981278062f, 0.732780933f},
-std::array<float,2>{0.444992721f, 0.474832058f},
-std::array<float,2>{0.629062474f, 0.159174353f},
-std::array<float,2>{0.084257409f, 0.845665216f},
-std::array<float,2>{0.528500617f, 0.999400973f},
-std::array<float,2>{0.171969771f, 0.00823162589f},
-std::array<float,2>{0.75339222f, 0.266737998f},
-std::array<float,2>{0.324948937f, 0.567763686f},
-std::array<float,2>{0.613046229f, 0.600778937f},
-std::array<float,2>{0.244032696f, 0.298105478f},
-std::array<float,2>{0.832880437f, 0.0450746007f},
-std::array<float,2>{0.286457479f, 0.968410552f},
-std::array<float,2>{0.920413077f, 0.81288588f},
-std::array<float,2>{0.433401525f, 0.140083477f},
-std::array<float,2>{0.71438396f, 0.468084902f},
-std::array<float,2>{0.00670027081f, 0.692641616f},
-std::array<float,2>{0.795534015f, 0.632417083f},
-std::array<float,2>{0.365127116f, 0.394127309f},
-std::array<float,2>{0.560284913f, 0.234429538f},
-std::array<float,2>{0.146934137f, 0.774192274f},
-std::array<float,2>{0.683391988f, 0.936831832f},
-std::array<float,2>{0.105578162f, 0.0717093572f},
-std::array<float,2>{0.938542604f, 0.345616698f},
-std::array<float,2>{0.477827787f, 0.532590747f},
-std::array<float,2>{0.738922596f, 0.719562054f},
-std::array<float,2>{0.0410018899f, 0.479829699f},
-std::array<float,2>{0.889318883f, 0.168585286f},
-std::array<float,2>{0.387757331f, 0.858207285f},
-std::array<float,2>{0.852318287f, 0.98879838f},
-std::array<float,2>{0.280858994f, 0.00510044675f},
-std::array<float,2>{0.593717098f, 0.28087464f},
-std::array<float,2>{0.218647972f, 0.575122893f},
-std::array<float,2>{0.984665513f, 0.503104389f},
-std::array<float,2>{0.457491785f, 0.337682515f},
-std::array<float,2>{0.650418222f, 0.108796991f},
-std::array<float,2>{0.0637032315f, 0.903706133f},
-std::array<float,2>{0.507643521f, 0.807817459f},
-std::array<float,2>{0.158538207f, 0.203436166f},
-std::array<float,2>{0.777564824f, 0.407966644f},
-std::array<float,2>{0.343502462f, 0.677740932f},
-std::array<float,2>{0.531817734f, 0.671472907f},
-std::array<float,2>{0.129075125f, 0.424252182f},
-std::array<float,2>{0.810151279f, 0.197518647f},
-std::array<float,2>{0.350359201f, 0.787128329f},
-std::array<float,2>{0.958079398f, 0.884907901f},
-std::array<float,2>{0.487863213f, 0.111259446f},
-std::array<float,2>{0.671543539f, 0.316995978f},
-std::array<float,2>{0.114672236f, 0.526489913f},
-std::array<float,2>{0.820543408f, 0.591444254f},
-std::array<float,2>{0.309147835f, 0.260644376f},
-std::array<float,2>{0.601655304f, 0.0215458013f},
-std::array<float,2>{0.219137087f, 0.971923113f},
-std::array<float,2>{0.687613428f, 0.874362111f},
-std::array<float,2>{0.0158735868f, 0.173480451f},
-std::array<float,2>{0.929532528f, 0.485716999f},
-std::array<float,2>{0.414084345f, 0.745096028f},
-std::array<float,2>{0.625036895f, 0.558044016f},
-std::array<float,2>{0.0807132199f, 0.372742265f},
-std::array<float,2>{0.97761935f, 0.0935877711f},
-std::array<float,2>{0.439770341f, 0.916076005f},
-std::array<float,2>{0.754351854f, 0.757786334f},
-std::array<float,2>{0.320815206f, 0.227866158f},
-std::array<float,2>{0.526964247f, 0.38800177f},
-std::array<float,2>{0.177546278f, 0.642737687f},
-std::array<float,2>{0.890873969f, 0.709769845f},
-std::array<float,2>{0.404377043f, 0.451486081f},
-std::array<float,2>{0.734332681f, 0.155986369f},
-std::array<float,2>{0.0584730096f, 0.830506802f},
-std::array<float,2>{0.570589066f, 0.948759019f},
-std::array<float,2>{0.199186966f, 0.0484844111f},
-std::array<float,2>{0.870660305f, 0.290935248f},
-std::array<float,2>{0.255140603f, 0.621582627f},
-std::array<float,2>{0.516799212f, 0.521839023f},
-std::array<float,2>{0.187322855f, 0.323325723f},
-std::array<float,2>{0.758686304f, 0.121934615f},
-std::array<float,2>{0.318668813f, 0.875226438f},
-std::array<float,2>{0.975236714f, 0.796575367f},
-std::array<float,2>{0.446147889f, 0.1893453f},
-std::array<float,2>{0.640159428f, 0.430948317f},
-std::array<float,2>{0.0870352164f, 0.656315327f},
-std::array<float,2>{0.859987617f, 0.73900944f},
-std::array<float,2>{0.260598779f, 0.497566074f},
-std::array<float,2>{0.562981963f, 0.185560793f},
-std::array<float,2>{0.191095755f, 0.865396857f},
-std::array<float,2>{0.723827779f, 0.977077425f},
-std::array<float,2>{0.0530242994f, 0.0295483638f},
-std::array<float,2>{0.898840606f, 0.253537297f},
-std::array<float,2>{0.392891288f, 0.579732716f},
-std::array<float,2>{0.65974015f, 0.654540122f},
-std::array<float,2>{0.123777069f, 0.375975937f},
-std::array<float,2>{0.968349516f, 0.225790307f},
-std::array<float,2>{0.498747408f, 0.764151633f},
-std::array<float,2>{0.799815834f, 0.906907856f},
-std::array<float,2>{0.357827753f, 0.0817435533f},
-std::array<float,2>{0.541446149f, 0.36518392f},
-std::array<float,2>{0.135388762f, 0.550011039f},
-std::array<float,2>{0.936557174f, 0.611668289f},
-std::array<float,2>{0.406322032f, 0.287424594f},
-std::array<float,2>{0.699953556f, 0.0621133186f},
-std::array<float,2>{0.0270910263f, 0.943039477f},
-std::array<float,2>{0.594851017f, 0.838237047f},
-std::array<float,2>{0.230540708f, 0.14371784f},
-std::array<float,2>{0.81426847f, 0.438497692f},
-std::array<float,2>{0.297737122f, 0.718111277f},
-std::array<float,2>{0.581112564f, 0.696483433f},
-std::array<float,2>{0.209713653f, 0.45426181f},
-std::array<float,2>{0.848202944f, 0.12754637f},
-std::array<float,2>{0.270474315f, 0.820629179f},
-std::array<float,2>{0.877266645f, 0.959769189f},
-std::array<float,2>{0.382545441f, 0.0320157856f},
-std::array<float,2>{0.748498142f, 0.308993399f},
-std::array<float,2>{0.0335986428f, 0.601577222f},
-std::array<float,2>{0.76870054f, 0.541295528f},
-std::array<float,2>{0.333130002f, 0.353874385f},
-std::array<float,2>{0.509413064f, 0.0664892867f},
-std::array<float,2>{0.166327566f, 0.925899625f},
-std::array<float,2>{0.64081192f, 0.768935621f},
-std::array<float,2>{0.0734499097f, 0.242629111f},
-std::array<float,2>{0.993932486f, 0.399626762f},
-std::array<float,2>{0.467488199f, 0.632876337f},
-std::array<float,2>{0.708286107f, 0.564422071f},
-std::array<float,2>{0.012181188f, 0.271733642f},
-std::array<float,2>{0.906311274f, 0.0123673994f},
-std::array<float,2>{0.428397655f, 0.995609462f},
-std::array<float,2>{0.842758238f, 0.85016042f},
-std::array<float,2>{0.295118302f, 0.161119267f},
-std::array<float,2>{0.619503856f, 0.469941586f},
-std::array<float,2>{0.240242094f, 0.729454815f},
-std::array<float,2>{0.948612034f, 0.68527925f},
-std::array<float,2>{0.475949138f, 0.417280883f},
-std::array<float,2>{0.6794734f, 0.217092574f},
-std::array<float,2>{0.0971697941f, 0.802672923f},
-std::array<float,2>{0.548521101f, 0.893682539f},
-std::array<float,2>{0.154472724f, 0.0942719802f},
-std::array<float,2>{0.786253154f, 0.331041753f},
-std::array<float,2>{0.374633133f, 0.513725042f},
-std::array<float,2>{0.599656701f, 0.506637752f},
-std::array<float,2>{0.226830646f, 0.342701733f},
-std::array<float,2>{0.817789316f, 0.105065316f},
-std::array<float,2>{0.304602981f, 0.902161539f},
-std::array<float,2>{0.932600915f, 0.809234321f},
-std::array<float,2>{0.412987769f, 0.210855097f},
-std::array<float,2>{0.698506713f, 0.412323415f},
-std::array<float,2>{0.0295861699f, 0.672807693f},
-std::array<float,2>{0.802534103f, 0.723049104f},
-std::array<float,2>{0.352939248f, 0.482666343f},
-std::array<float,2>{0.544026256f, 0.167388886f},
-std::array<float,2>{0.140326217f, 0.854862988f},
-std::array<float,2>{0.661055446f, 0.986942351f},
-std::array<float,2>{0.119453616f, 0.00236661616f},
-std::array<float,2>{0.962993443f, 0.27480641f},
-std::array<float,2>{0.495714962f, 0.571214676f},
-std::array<float,2>{0.719304144f, 0.626502395f},
-std::array<float,2>{0.0477417186f, 0.397790819f},
-std::array<float,2>{0.906050622f, 0.240272284f},
-std::array<float,2>{0.395942539f, 0.779301763f},
-std::array<float,2>{0.863692284f, 0.933152616f},
-std::array<float,2>{0.263968766f, 0.0757466033f},
-std::array<float,2>{0.567071915f, 0.350378245f},
-std::array<float,2>{0.193523005f, 0.538483441f},
-std::array<float,2>{0.972022295f, 0.594477654f},
-std::array<float,2>{0.452845186f, 0.304134995f},
-std::array<float,2>{0.634275436f, 0.0423631333f},
-std::array<float,2>{0.0936322436f, 0.964490831f},
-std::array<float,2>{0.520356774f, 0.817589164f},
-std::array<float,2>{0.180300027f, 0.135305196f},
-std::array<float,2>{0.761930645f, 0.460954398f},
-std::array<float,2>{0.313475162f, 0.690770268f},
-std::array<float,2>{0.552318275f, 0.70517683f},
-std::array<float,2>{0.150501668f, 0.447187901f},
-std::array<float,2>{0.782519579f, 0.148822233f},
-std::array<float,2>{0.37098375f, 0.833934247f},
-std::array<float,2>{0.951317549f, 0.951017082f},
-std::array<float,2>{0.470891804f, 0.0526949763f},
-std::array<float,2>{0.672416031f, 0.293734759f},
-std::array<float,2>{0.0989715829f, 0.618820846f},
-std::array<float,2>{0.838014722f, 0.562143862f},
-std::array<float,2>{0.289223075f, 0.370205581f},
-std::array<float,2>{0.622512162f, 0.0868776068f},
-std::array<float,2>{0.235366777f, 0.921503663f},
-std::array<float,2>{0.706046999f, 0.751067221f},
-std::array<float,2>{0.00876344461f, 0.231213689f},
-std::array<float,2>{0.912535787f, 0.382934242f},
-std::array<float,2>{0.423340559f, 0.647486627f},
-std::array<float,2>{0.646003604f, 0.58682394f},
-std::array<float,2>{0.0763738379f, 0.263857782f},
-std::array<float,2>{0.997718692f, 0.0166100916f},
-std::array<float,2>{0.462273061f, 0.973468721f},
-std::array<float,2>{0.77289927f, 0.870214164f},
-std::array<float,2>{0.329842031f, 0.176896513f},
-std::array<float,2>{0.511891544f, 0.48914057f},
-std::array<float,2>{0.171609387f, 0.746708989f},
-std::array<float,2>{0.882654488f, 0.665410519f},
-std::array<float,2>{0.375348032f, 0.426844031f},
-std::array<float,2>{0.745093882f, 0.201869711f},
-std::array<float,2>{0.0362981744f, 0.783619344f},
-std::array<float,2>{0.58532989f, 0.890525103f},
-std::array<float,2>{0.204758853f, 0.117098995f},
-std::array<float,2>{0.844322264f, 0.313191622f},
-std::array<float,2>{0.266001642f, 0.527350783f},
-std::array<float,2>{0.5016675f, 0.61620146f},
-std::array<float,2>{0.163697243f, 0.284425527f},
-std::array<float,2>{0.77562052f, 0.0569741838f},
-std::array<float,2>{0.338799179f, 0.937645197f},
-std::array<float,2>{0.989602923f, 0.843250692f},
-std::array<float,2>{0.456788242f, 0.147280052f},
-std::array<float,2>{0.65596956f, 0.445309192f},
-std::array<float,2>{0.0669354945f, 0.713174164f},
-std::array<float,2>{0.857855022f, 0.650369108f},
-std::array<float,2>{0.275038749f, 0.382243931f},
-std::array<float,2>{0.587156177f, 0.219148293f},
-std::array<float,2>{0.213509738f, 0.758813441f},
-std::array<float,2>{0.735856473f, 0.910715163f},
-std::array<float,2>{0.0466671735f, 0.0843760744f},
-std::array<float,2>{0.88370353f, 0.361087501f},
-std::array<float,2>{0.383669883f, 0.553150713f},
-std::array<float,2>{0.684222221f, 0.737879395f},
-std::array<float,2>{0.103163026f, 0.492895007f},
-std::array<float,2>{0.943881989f, 0.180763006f},
-std::array<float,2>{0.481422991f, 0.859687924f},
-std::array<float,2>{0.791073561f, 0.980886638f},
-std::array<float,2>{0.359645218f, 0.0239093713f},
-std::array<float,2>{0.556920171f, 0.257492155f},
-std::array<float,2>{0.14241381f, 0.58213824f},
-std::array<float,2>{0.916590869f, 0.515977144f},
-std::array<float,2>{0.433631897f, 0.325701892f},
-std::array<float,2>{0.715376318f, 0.119879246f},
-std::array<float,2>{0.00356605346f, 0.881611466f},
-std::array<float,2>{0.6162256f, 0.790683925f},
-std::array<float,2>{0.246143684f, 0.191616729f},
-std::array<float,2>{0.83026886f, 0.434447736f},
-std::array<float,2>{0.284280032f, 0.660925448f},
-std::array<float,2>{0.577211976f, 0.679877102f},
-std::array<float,2>{0.202048838f, 0.420696348f},
-std::array<float,2>{0.874352455f, 0.214610621f},
-std::array<float,2>{0.251084328f, 0.799888372f},
-std::array<float,2>{0.897091269f, 0.89798826f},
-std::array<float,2>{0.399401337f, 0.100902699f},
-std::array<float,2>{0.727168858f, 0.333965957f},
-std::array<float,2>{0.0615989156f, 0.511615157f},
-std::array<float,2>{0.751447499f, 0.568894267f},
-std::array<float,2>{0.326932162f, 0.267780006f},
-std::array<float,2>{0.529651105f, 0.0109296218f},
-std::array<float,2>{0.175670028f, 0.997799397f},
-std::array<float,2>{0.632773101f, 0.845754206f},
-std::array<float,2>{0.0839745775f, 0.157210216f},
-std::array<float,2>{0.983918071f, 0.474106699f},
-std::array<float,2>{0.441894591f, 0.730481088f},
-std::array<float,2>{0.692501605f, 0.546101272f},
-std::array<float,2>{0.0205800962f, 0.356708378f},
-std::array<float,2>{0.92420733f, 0.0641309321f},
-std::array<float,2>{0.417970479f, 0.923701644f},
-std::array<float,2>{0.827585518f, 0.770709574f},
-std::array<float,2>{0.305382758f, 0.246116176f},
-std::array<float,2>{0.606188834f, 0.406085759f},
-std::array<float,2>{0.223321468f, 0.639584959f},
-std::array<float,2>{0.953151524f, 0.701700747f},
-std::array<float,2>{0.491615742f, 0.458617359f},
-std::array<float,2>{0.665256619f, 0.131839573f},
-std::array<float,2>{0.112930976f, 0.827994823f},
-std::array<float,2>{0.537211537f, 0.956982255f},
-std::array<float,2>{0.125952944f, 0.0389921889f},
-std::array<float,2>{0.808570027f, 0.307471603f},
-std::array<float,2>{0.345467418f, 0.606284916f},
-std::array<float,2>{0.591662824f, 0.577115834f},
-std::array<float,2>{0.215645909f, 0.279198676f},
-std::array<float,2>{0.855139375f, 0.0075900224f},
-std::array<float,2>{0.278689265f, 0.990365505f},
-std::array<float,2>{0.888658166f, 0.856283069f},
-std::array<float,2>{0.388789982f, 0.169961914f},
-std::array<float,2>{0.740935326f, 0.477186084f},
-std::array<float,2>{0.0416205376f, 0.722087979f},
-std::array<float,2>{0.779399395f, 0.676889777f},
-std::array<float,2>{0.340802312f, 0.408268481f},
-std::array<float,2>{0.504820585f, 0.206126943f},
-std::array<float,2>{0.157336682f, 0.806315184f},
-std::array<float,2>{0.649763584f, 0.90570116f},
-std::array<float,2>{0.0653526857f, 0.106921032f},
-std::array<float,2>{0.988053501f, 0.33881712f},
-std::array<float,2>{0.460476816f, 0.501120925f},
-std::array<float,2>{0.712102234f, 0.694107711f},
-std::array<float,2>{0.00402048137f, 0.464872777f},
-std::array<float,2>{0.919420362f, 0.137146249f},
-std::array<float,2>{0.429874033f, 0.815752983f},
-std::array<float,2>{0.835048437f, 0.966515303f},
-std::array<float,2>{0.288460553f, 0.0446488895f},
-std::array<float,2>{0.609668314f, 0.299280077f},
-std::array<float,2>{0.245635316f, 0.59823823f},
-std::array<float,2>{0.940476716f, 0.533510447f},
-std::array<float,2>{0.478969753f, 0.347482234f},
-std::array<float,2>{0.680722654f, 0.0726397038f},
-std::array<float,2>{0.107724167f, 0.933859348f},
-std::array<float,2>{0.562106192f, 0.7760005f},
-std::array<float,2>{0.144553021f, 0.2363538f},
-std::array<float,2>{0.794882894f, 0.392421126f},
-std::array<float,2>{0.366046578f, 0.630005836f},
-std::array<float,2>{0.525289118f, 0.641366184f},
-std::array<float,2>{0.179486558f, 0.389412969f},
-std::array<float,2>{0.757257462f, 0.228884369f},
-std::array<float,2>{0.323008597f, 0.755764186f},
-std::array<float,2>{0.980210721f, 0.914771736f},
-std::array<float,2>{0.438592136f, 0.090272814f},
-std::array<float,2>{0.6285761f, 0.37404719f},
-std::array<float,2>{0.0789271295f, 0.556262016f},
-std::array<float,2>{0.867903948f, 0.623782575f},
-std::array<float,2>{0.257699311f, 0.292958438f},
-std::array<float,2>{0.573034883f, 0.0503106266f},
-std::array<float,2>{0.196249127f, 0.946936727f},
-std::array<float,2>{0.730656862f, 0.830033064f},
-std::array<float,2>{0.05604041f, 0.152836144f},
-std::array<float,2>{0.892730653f, 0.450327963f},
-std::array<float,2>{0.402402818f, 0.708210111f},
-std::array<float,2>{0.668420553f, 0.523602486f},
-std::array<float,2>{0.116415694f, 0.319852471f},
-std::array<float,2>{0.959496856f, 0.113256179f},
-std::array<float,2>{0.48631832f, 0.884615541f},
-std::array<float,2>{0.811960936f, 0.785614967f},
-std::array<float,2>{0.347842425f, 0.196083263f},
-std::array<float,2>{0.534937859f, 0.423247993f},
-std::array<float,2>{0.131350085f, 0.669754148f},
-std::array<float,2>{0.926484644f, 0.743559122f},
-std::array<float,2>{0.41685611f, 0.486577004f},
-std::array<float,2>{0.690915287f, 0.174903095f},
-std::array<float,2>{0.0187338423f, 0.872642815f},
-std::array<float,2>{0.605341196f, 0.970229566f},
-std::array<float,2>{0.220793724f, 0.0207404327f},
-std::array<float,2>{0.823191345f, 0.259071767f},
-std::array<float,2>{0.312046081f, 0.592917919f},
-std::array<float,2>{0.539722919f, 0.548377633f},
-std::array<float,2>{0.133404478f, 0.36623174f},
-std::array<float,2>{0.797006965f, 0.0795762017f},
-std::array<float,2>{0.355901361f, 0.908722937f},
-std::array<float,2>{0.965174437f, 0.763625383f},
-std::array<float,2>{0.497831911f, 0.224201247f},
-std::array<float,2>{0.657134175f, 0.378381968f},
-std::array<float,2>{0.122031733f, 0.653220356f},
-std::array<float,2>{0.81599611f, 0.71593231f},
-std::array<float,2>{0.299474984f, 0.440690905f},
-std::array<float,2>{0.597627461f, 0.141374454f},
-std::array<float,2>{0.233783975f, 0.83776176f},
-std::array<float,2>{0.703041553f, 0.944179893f},
-std::array<float,2>{0.0249894243f, 0.0601831526f},
-std::array<float,2>{0.933774292f, 0.286719233f},
-std::array<float,2>{0.408983797f, 0.610466063f},
-std::array<float,2>{0.638252079f, 0.658983827f},
-std::array<float,2>{0.0898092762f, 0.433079898f},
-std::array<float,2>{0.973181129f, 0.191002667f},
-std::array<float,2>{0.448806494f, 0.794051766f},
-std::array<float,2>{0.760009766f, 0.878292441f},
-std::array<float,2>{0.318267107f, 0.124730006f},
-std::array<float,2>{0.518529236f, 0.321867466f},
-std::array<float,2>{0.183929622f, 0.519746542f},
-std::array<float,2>{0.901148319f, 0.581084013f},
-std::array<float,2>{0.390641183f, 0.251092494f},
-std::array<float,2>{0.726225138f, 0.0282559842f},
-std::array<float,2>{0.0508202016f, 0.980445087f},
-std::array<float,2>{0.565688491f, 0.863741457f},
-std::array<float,2>{0.188496664f, 0.184460998f},
-std::array<float,2>{0.862873435f, 0.499773681f},
-std::array<float,2>{0.257859886f, 0.741644263f},
-std::array<float,2>{0.618947327f, 0.726712704f},
-std::array<float,2>{0.239700481f, 0.470811367f},
-std::array<float,2>{0.84042418f, 0.162975177f},
-std::array<float,2>{0.294487476f, 0.847940147f},
-std::array<float,2>{0.909641862f, 0.992732286f},
-std::array<float,2>{0.426407427f, 0.0141576864f},
-std::array<float,2>{0.709028482f, 0.27000311f},
-std::array<float,2>{0.0144322226f, 0.565097272f},
-std::array<float,2>{0.787258267f, 0.512185812f},
-std::array<float,2>{0.371258169f, 0.32871148f},
-std::array<float,2>{0.549015284f, 0.0960315093f},
-std::array<float,2>{0.152344033f, 0.891127884f},
-std::array<float,2>{0.67740792f, 0.803079426f},
-std::array<float,2>{0.0947987884f, 0.215892032f},
-std::array<float,2>{0.946634412f, 0.414991021f},
-std::array<float,2>{0.473806649f, 0.687315643f},
-std::array<float,2>{0.747735023f, 0.60438329f},
-std::array<float,2>{0.0315434784f, 0.310829163f},
-std::array<float,2>{0.875483453f, 0.0344130248f},
-std::array<float,2>{0.380563557f, 0.958609819f},
-std::array<float,2>{0.850842893f, 0.823927224f},
-std::array<float,2>{0.272293717f, 0.126586944f},
-std::array<float,2>{0.578319252f, 0.456699669f},
-std::array<float,2>{0.207407653f, 0.698871911f},
-std::array<float,2>{0.99515456f, 0.635213852f},
-std::array<float,2>{0.466026932f, 0.401219904f},
-std::array<float,2>{0.644277394f, 0.245184496f},
-std::array<float,2>{0.0714556724f, 0.766465545f},
-std::array<float,2>{0.510299742f, 0.929000139f},
-std::array<float,2>{0.16438669f, 0.0689138696f},
-std::array<float,2>{0.766201258f, 0.351765364f},
-std::array<float,2>{0.334357291f, 0.539694846f},
-std::array<float,2>{0.582318187f, 0.528468251f},
-std::array<float,2>{0.205585927f, 0.314256996f},
-std::array<float,2>{0.845874012f, 0.1154809f},
-std::array<float,2>{0.267862737f, 0.889026761f},
-std::array<float,2>{0.879750371f, 0.78502059f},
-std::array<float,2>{0.377583086f, 0.202552676f},
-std::array<float,2>{0.742656767f, 0.42644152f},
-std::array<float,2>{0.0376900882f, 0.664912641f},
-std::array<float,2>{0.770512283f, 0.747465312f},
-std::array<float,2>{0.331371814f, 0.489357203f},
-std::array<float,2>{0.514459729f, 0.176619187f},
-std::array<float,2>{0.169135183f, 0.869687796f},
-std::array<float,2>{0.647618055f, 0.974137664f},
-std::array<float,2>{0.0742431059f, 0.0156643279f},
-std::array<float,2>{0.999116719f, 0.265526563f},
-std::array<float,2>{0.462990612f, 0.587573171f},
-std::array<float,2>{0.703703463f, 0.646485686f},
-std::array<float,2>{0.0116729755f, 0.384023815f},
-std::array<float,2>{0.911708057f, 0.232180357f},
-std::array<float,2>{0.425607175f, 0.750261128f},
-std::array<float,2>{0.836872458f, 0.920838714f},
-std::array<float,2>{0.292279482f, 0.0872282833f},
-std::array<float,2>{0.624973476f, 0.36977008f},
-std::array<float,2>{0.237860054f, 0.561407924f},
-std::array<float,2>{0.951033294f, 0.617396832f},
-std::array<float,2>{0.469095558f, 0.294751436f},
-std::array<float,2>{0.675765514f, 0.0516774207f},
-std::array<float,2>{0.10064473f, 0.94958061f},
-std::array<float,2>{0.553991973f, 0.832637966f},
-std::array<float,2>{0.148793697f, 0.150338486f},
-std::array<float,2>{0.785120726f, 0.446054667f},
-std::array<float,2>{0.368517458f, 0.70656848f},
-std::array<float,2>{0.523283958f, 0.689952791f},
-std::array<float,2>{0.183094949f, 0.462350458f},
-std::array<float,2>{0.763843477f, 0.135805294f},
-std::array<float,2>{0.316247374f, 0.816460848f},
-std::array<float,2>{0.969384074f, 0.963303328f},
-std::array<float,2>{0.450650454f, 0.0418267921f},
-std::array<float,2>{0.636312783f, 0.302912951f},
-std::array<float,2>{0.0906673074f, 0.594893754f},
-std::array<float,2>{0.865334034f, 0.53724432f},
-std::array<float,2>{0.263614774f, 0.350993514f},
-std::array<float,2>{0.570009708f, 0.0746166706f},
-std::array<float,2>{0.191870272f, 0.932065129f},
-std::array<float,2>{0.722360373f, 0.780852616f},
-std::array<float,2>{0.0492297187f, 0.242012143f},
-std::array<float,2>{0.903002679f, 0.397439539f},
-std::array<float,2>{0.397593379f, 0.625020146f},
-std::array<float,2>{0.663673341f, 0.572212756f},
-std::array<float,2>{0.117829233f, 0.273677409f},
-std::array<float,2>{0.962767422f, 0.00303489552f},
-std::array<float,2>{0.493229747f, 0.98733604f},
-std::array<float,2>{0.80390805f, 0.854419053f},
-std::array<float,2>{0.355306357f, 0.16694729f},
-std::array<float,2>{0.545275152f, 0.483456135f},
-std::array<float,2>{0.138375804f, 0.724493444f},
-std::array<float,2>{0.930420101f, 0.673492193f},
-std::array<float,2>{0.410348058f, 0.413390666f},
-std::array<float,2>{0.695655107f, 0.209413558f},
-std::array<float,2>{0.0288451649f, 0.810143173f},
-std::array<float,2>{0.598299921f, 0.900800049f},
-std::array<float,2>{0.230140001f, 0.104447283f},
-std::array<float,2>{0.819269776f, 0.342777491f},
-std::array<float,2>{0.301938057f, 0.506915033f},
-std::array<float,2>{0.535406113f, 0.607208848f},
-std::array<float,2>{0.128196135f, 0.307847053f},
-std::array<float,2>{0.806227624f, 0.0377830714f},
-std::array<float,2>{0.346048027f, 0.955349386f},
-std::array<float,2>{0.956463873f, 0.826771379f},
-std::array<float,2>{0.489185989f, 0.131550223f},
-std::array<float,2>{0.667227924f, 0.457221448f},
-std::array<float,2>{0.11110533f, 0.702307045f},
-std::array<float,2>{0.824618518f, 0.640556097f},
-std::array<float,2>{0.30695954f, 0.405024379f},
-std::array<float,2>{0.607564867f, 0.247824267f},
-std::array<float,2>{0.224718705f, 0.769940734f},
-std::array<float,2>{0.693963706f, 0.922361732f},
-std::array<float,2>{0.0224577002f, 0.0631517172f},
-std::array<float,2>{0.922207594f, 0.355978578f},
-std::array<float,2>{0.421266586f, 0.54503119f},
-std::array<float,2>{0.63013953f, 0.731782436f},
-std::array<float,2>{0.0858373195f, 0.473454684f},
-std::array<float,2>{0.981919408f, 0.157239825f},
-std::array<float,2>{0.44344905f, 0.847049415f},
-std::array<float,2>{0.752315938f, 0.996254563f},
-std::array<float,2>{0.325773567f, 0.0103815682f},
-std::array<float,2>{0.52820462f, 0.269202799f},
-std::array<float,2>{0.173665375f, 0.569782138f},
-std::array<float,2>{0.895393312f, 0.51050514f},
-std::array<float,2>{0.400398374f, 0.332347333f},
-std::array<float,2>{0.73029542f, 0.100259848f},
-std::array<float,2>{0.0597984083f, 0.896695316f},
-std::array<float,2>{0.574577808f, 0.799621642f},
-std::array<float,2>{0.200482413f, 0.213187724f},
-std::array<float,2>{0.871465147f, 0.421699762f},
-std::array<float,2>{0.253073454f, 0.68153441f},
-std::array<float,2>{0.613870621f, 0.661861479f},
-std::array<float,2>{0.248175099f, 0.435384482f},
-std::array<float,2>{0.828388989f, 0.193292171f},
-std::array<float,2>{0.282032669f, 0.789398074f},
-std::array<float,2>{0.91522783f, 0.882451177f},
-std::array<float,2>{0.437327534f, 0.121049702f},
-std::array<float,2>{0.718664646f, 0.324877113f},
-std::array<float,2>{0.00130691857f, 0.517241836f},
-std::array<float,2>{0.789365232f, 0.583037972f},
-std::array<float,2>{0.361357898f, 0.256516635f},
-std::array<float,2>{0.555045009f, 0.0249387547f},
-std::array<float,2>{0.144234136f, 0.981978059f},
-std::array<float,2>{0.686169863f, 0.860896468f},
-std::array<float,2>{0.105234079f, 0.18054767f},
-std::array<float,2>{0.94159919f, 0.493504822f},
-std::array<float,2>{0.482483655f, 0.736803114f},
-std::array<float,2>{0.736623287f, 0.554088891f},
-std::array<float,2>{0.0438290201f, 0.360123247f},
-std::array<float,2>{0.885784149f, 0.0859219506f},
-std::array<float,2>{0.386678845f, 0.911522806f},
-std::array<float,2>{0.856598914f, 0.758178711f},
-std::array<float,2>{0.276404947f, 0.220482826f},
-std::array<float,2>{0.589388907f, 0.381272793f},
-std::array<float,2>{0.211819127f, 0.649181306f},
-std::array<float,2>{0.991425514f, 0.714158356f},
-std::array<float,2>{0.453882217f, 0.444228053f},
-std::array<float,2>{0.652523577f, 0.147795036f},
-std::array<float,2>{0.069426015f, 0.842030227f},
-std::array<float,2>{0.502820075f, 0.939284146f},
-std::array<float,2>{0.161732912f, 0.0583190173f},
-std::array<float,2>{0.77347517f, 0.283770978f},
-std::array<float,2>{0.337068468f, 0.616492987f},
-std::array<float,2>{0.603294134f, 0.591953635f},
-std::array<float,2>{0.220345303f, 0.258508056f},
-std::array<float,2>{0.821627021f, 0.0197710991f},
-std::array<float,2>{0.309780866f, 0.969483316f},
-std::array<float,2>{0.928358078f, 0.87154752f},
-std::array<float,2>{0.415946573f, 0.173829451f},
-std::array<float,2>{0.688753307f, 0.488179177f},
-std::array<float,2>{0.0171441454f, 0.742653549f},
-std::array<float,2>{0.808849454f, 0.668876112f},
-std::array<float,2>{0.350587994f, 0.422318041f},
-std::array<float,2>{0.532719195f, 0.197136194f},
-std::array<float,2>{0.130250812f, 0.78677845f},
-std::array<float,2>{0.670583129f, 0.883429408f},
-std::array<float,2>{0.11394126f, 0.111734025f},
-std::array<float,2>{0.957528412f, 0.318630785f},
-std::array<float,2>{0.486492902f, 0.524839699f},
-std::array<float,2>{0.733131826f, 0.707272053f},
-std::array<float,2>{0.0574341491f, 0.449298978f},
-std::array<float,2>{0.891667306f, 0.153863937f},
-std::array<float,2>{0.406036615f, 0.828716099f},
-std::array<float,2>{0.869890094f, 0.945657134f},
-std::array<float,2>{0.254276097f, 0.0497203916f},
-std::array<float,2>{0.571536005f, 0.29137975f},
-std::array<float,2>{0.197637007f, 0.624716997f},
-std::array<float,2>{0.976995647f, 0.554805517f},
-std::array<float,2>{0.440822393f, 0.373167008f},
-std::array<float,2>{0.626194477f, 0.0915399119f},
-std::array<float,2>{0.0819269419f, 0.915079534f},
-std::array<float,2>{0.52571255f, 0.75430429f},
-std::array<float,2>{0.175829753f, 0.229921505f},
-std::array<float,2>{0.754947364f, 0.389922202f},
-std::array<float,2>{0.322188824f, 0.642254472f},
-std::array<float,2>{0.559205115f, 0.62970674f},
-std::array<float,2>{0.147644579f, 0.391229808f},
-std::array<float,2>{0.79654932f, 0.23778528f},
-std::array<float,2>{0.364086241f, 0.776823878f},
-std::array<float,2>{0.937800109f, 0.934867501f},
-std::array<float,2>{0.477229685f, 0.0739972666f},
-std::array<float,2>{0.68204093f, 0.346349716f},
-std::array<float,2>{0.106466077f, 0.534870327f},
-std::array<float,2>{0.833632648f, 0.599386811f},
-std::array<float,2>{0.285897583f, 0.299926579f},
-std::array<float,2>{0.61135304f, 0.0433594957f},
-std::array<float,2>{0.24250102f, 0.965079904f},
-std::array<float,2>{0.713655233f, 0.814616203f},
-std::array<float,2>{0.00691207731f, 0.138070136f},
-std::array<float,2>{0.921542287f, 0.465908349f},
-std::array<float,2>{0.432287604f, 0.695189297f},
-std::array<float,2>{0.651482999f, 0.500122011f},
-std::array<float,2>{0.0628012046f, 0.33934918f},
-std::array<float,2>{0.985839486f, 0.105790414f},
-std::array<float,2>{0.458047152f, 0.90460676f},
-std::array<float,2>{0.778811753f, 0.805131912f},
-std::array<float,2>{0.341824174f, 0.205141857f},
-std::array<float,2>{0.506160319f, 0.409779251f},
-std::array<float,2>{0.159550264f, 0.675855339f},
-std::array<float,2>{0.889949858f, 0.720747411f},
-std::array<float,2>{0.387435377f, 0.478263736f},
-std::array<float,2>{0.739483297f, 0.171857774f},
-std::array<float,2>{0.0393398106f, 0.85676235f},
-std::array<float,2>{0.592449784f, 0.991878927f},
-std::array<float,2>{0.217215836f, 0.00636875397f},
-std::array<float,2>{0.852685392f, 0.277825505f},
-std::array<float,2>{0.279495925f, 0.577174902f},
-std::array<float,2>{0.507884145f, 0.540995479f},
-std::array<float,2>{0.167310327f, 0.352749079f},
-std::array<float,2>{0.767717421f, 0.0702845976f},
-std::array<float,2>{0.332443148f, 0.927873731f},
-std::array<float,2>{0.992243707f, 0.767416298f},
-std::array<float,2>{0.467887133f, 0.244766667f},
-std::array<float,2>{0.642057538f, 0.401600987f},
-std::array<float,2>{0.0731950402f, 0.63651979f},
-std::array<float,2>{0.849162698f, 0.697893143f},
-std::array<float,2>{0.270616025f, 0.455614328f},
-std::array<float,2>{0.580477238f, 0.125229806f},
-std::array<float,2>{0.21045883f, 0.822511375f},
-std::array<float,2>{0.749552011f, 0.957828283f},
-std::array<float,2>{0.0347112529f, 0.0341019221f},
-std::array<float,2>{0.878370345f, 0.311547399f},
-std::array<float,2>{0.381408155f, 0.605205953f},
-std::array<float,2>{0.678677559f, 0.685801327f},
-std::array<float,2>{0.0964922979f, 0.415882736f},
-std::array<float,2>{0.947804868f, 0.215110913f},
-std::array<float,2>{0.475267559f, 0.804238975f},
-std::array<float,2>{0.786010981f, 0.891791642f},
-std::array<float,2>{0.37305069f, 0.0974223614f},
-std::array<float,2>{0.546929181f, 0.329124659f},
-std::array<float,2>{0.155712426f, 0.513373971f},
-std::array<float,2>{0.908008516f, 0.566136837f},
-std::array<float,2>{0.429159462f, 0.270990223f},
-std::array<float,2>{0.707394361f, 0.0152772684f},
-std::array<float,2>{0.0133025404f, 0.993432403f},
-std::array<float,2>{0.620996833f, 0.849273086f},
-std::array<float,2>{0.241388619f, 0.163609847f},
-std::array<float,2>{0.843607247f, 0.471700817f},
-std::array<float,2>{0.295933664f, 0.728192747f},
-std::array<float,2>{0.564042449f, 0.740996063f},
-std::array<float,2>{0.189645991f, 0.498480409f},
-std::array<float,2>{0.86085701f, 0.18542102f},
-std::array<float,2>{0.26128763f, 0.865083873f},
-std::array<float,2>{0.899903834f, 0.97884798f},
-std::array<float,2>{0.39432472f, 0.0289142244f},
-std::array<float,2>{0.723473668f, 0.250726908f},
-std::array<float,2>{0.0539511442f, 0.580109417f},
-std::array<float,2>{0.759070218f, 0.521299124f},
-std::array<float,2>{0.319865197f, 0.320384085f},
-std::array<float,2>{0.516540825f, 0.123188898f},
-std::array<float,2>{0.185722038f, 0.877404332f},
-std::array<float,2>{0.639319897f, 0.793177545f},
-std::array<float,2>{0.0860067233f, 0.189889535f},
-std::array<float,2>{0.9763785f, 0.432322204f},
-std::array<float,2>{0.446423888f, 0.660107732f},
-std::array<float,2>{0.700222254f, 0.609575093f},
-std::array<float,2>{0.0259425696f, 0.285403401f},
-std::array<float,2>{0.936263859f, 0.0590548925f},
-std::array<float,2>{0.407756031f, 0.944821954f},
-std::array<float,2>{0.813207746f, 0.836714447f},
-std::array<float,2>{0.29801634f, 0.141768813f},
-std::array<float,2>{0.594366848f, 0.440266877f},
-std::array<float,2>{0.231789365f, 0.714926004f},
-std::array<float,2>{0.967759252f, 0.65406251f},
-std::array<float,2>{0.499978542f, 0.377657413f},
-std::array<float,2>{0.658343196f, 0.222719103f},
-std::array<float,2>{0.124711849f, 0.762559891f},
-std::array<float,2>{0.542409062f, 0.910086691f},
-std::array<float,2>{0.136536077f, 0.0789056569f},
-std::array<float,2>{0.799735129f, 0.365374893f},
-std::array<float,2>{0.358770818f, 0.547441244f},
-std::array<float,2>{0.621776581f, 0.558887422f},
-std::array<float,2>{0.234737694f, 0.368970484f},
-std::array<float,2>{0.839226067f, 0.0881281048f},
-std::array<float,2>{0.290803462f, 0.91876328f},
-std::array<float,2>{0.913898051f, 0.753887713f},
-std::array<float,2>{0.422636122f, 0.233432129f},
-std::array<float,2>{0.706110179f, 0.385357082f},
-std::array<float,2>{0.0089881504f, 0.645358801f},
-std::array<float,2>{0.781286657f, 0.704317331f},
-std::array<float,2>{0.369731516f, 0.448734909f},
-std::array<float,2>{0.551128805f, 0.151737988f},
-std::array<float,2>{0.151633561f, 0.835797131f},
-std::array<float,2>{0.67331785f, 0.952669561f},
-std::array<float,2>{0.0981889591f, 0.053904321f},
-std::array<float,2>{0.953083634f, 0.296393722f},
-std::array<float,2>{0.471897662f, 0.620509386f},
-std::array<float,2>{0.745558023f, 0.667153656f},
-std::array<float,2>{0.0352203138f, 0.429075152f},
-std::array<float,2>{0.881451607f, 0.199890703f},
-std::array<float,2>{0.376750141f, 0.781559825f},
-std::array<float,2>{0.845543861f, 0.888142586f},
-std::array<float,2>{0.266709208f, 0.113781281f},
-std::array<float,2>{0.584639788f, 0.314980388f},
-std::array<float,2>{0.204019859f, 0.529538274f},
-std::array<float,2>{0.997037411f, 0.589340925f},
-std::array<float,2>{0.461108506f, 0.262803882f},
-std::array<float,2>{0.645260155f, 0.0181969572f},
-std::array<float,2>{0.0771864951f, 0.975756228f},
-std::array<float,2>{0.513187587f, 0.869140267f},
-std::array<float,2>{0.170647442f, 0.177853346f},
-std::array<float,2>{0.772289038f, 0.490734786f},
-std::array<float,2>{0.328395873f, 0.749171674f},
-std::array<float,2>{0.543442667f, 0.724970281f},
-std::array<float,2>{0.138783708f, 0.481799632f},
-std::array<float,2>{0.800830901f, 0.165755287f},
-std::array<float,2>{0.351810426f, 0.852663279f},
-std::array<float,2>{0.963991284f, 0.98553592f},
-std::array<float,2>{0.495038182f, 0.00145180011f},
-std::array<float,2>{0.662100196f, 0.275778681f},
-std::array<float,2>{0.12088716f, 0.573302686f},
-std::array<float,2>{0.817248821f, 0.505652964f},
-std::array<float,2>{0.302941352f, 0.341138273f},
-std::array<float,2>{0.601017475f, 0.10263589f},
-std::array<float,2>{0.228204995f, 0.89951849f},
-std::array<float,2>{0.697779417f, 0.811018348f},
-std::array<float,2>{0.030907277f, 0.207446143f},
-std::array<float,2>{0.932825983f, 0.410461843f},
-std::array<float,2>{0.413215995f, 0.674889028f},
-std::array<float,2>{0.632926762f, 0.595865309f},
-std::array<float,2>{0.0920999199f, 0.300946146f},
-std::array<float,2>{0.971210182f, 0.0392547436f},
-std::array<float,2>{0.45131132f, 0.962450743f},
-std::array<float,2>{0.763033926f, 0.8194502f},
-std::array<float,2>{0.314419091f, 0.134425268f},
-std::array<float,2>{0.520966232f, 0.464621335f},
-std::array<float,2>{0.181568921f, 0.688467503f},
-std::array<float,2>{0.904533923f, 0.627580464f},
-std::array<float,2>{0.395274609f, 0.395170003f},
-std::array<float,2>{0.720080435f, 0.239885628f},
-std::array<float,2>{0.0486876406f, 0.778578222f},
-std::array<float,2>{0.567442894f, 0.930103183f},
-std::array<float,2>{0.19434081f, 0.0762995332f},
-std::array<float,2>{0.865119457f, 0.349237204f},
-std::array<float,2>{0.264959067f, 0.536781132f},
-std::array<float,2>{0.531158626f, 0.567268312f},
-std::array<float,2>{0.174135029f, 0.265942365f},
-std::array<float,2>{0.750003278f, 0.00920186844f},
-std::array<float,2>{0.328121036f, 0.99836123f},
-std::array<float,2>{0.983043134f, 0.84459579f},
-std::array<float,2>{0.442810208f, 0.159892738f},
-std::array<float,2>{0.631821454f, 0.475863189f},
-std::array<float,2>{0.0823551044f, 0.734370828f},
-std::array<float,2>{0.873745382f, 0.682738602f},
-std::array<float,2>{0.25027284f, 0.419259071f},
-std::array<float,2>{0.576936424f, 0.212467387f},
-std::array<float,2>{0.202323109f, 0.798174918f},
-std::array<float,2>{0.727765977f, 0.894744515f},
-std::array<float,2>{0.0613092706f, 0.0995695889f},
-std::array<float,2>{0.897539198f, 0.334520519f},
-std::array<float,2>{0.399829656f, 0.508692145f},
-std::array<float,2>{0.664293587f, 0.700939894f},
-std::array<float,2>{0.111667104f, 0.459434688f},
-std::array<float,2>{0.95496875f, 0.130535528f},
-std::array<float,2>{0.490574032f, 0.825894296f},
-std::array<float,2>{0.807556808f, 0.954127371f},
-std::array<float,2>{0.344710559f, 0.0356776379f},
-std::array<float,2>{0.538869739f, 0.305253327f},
-std::array<float,2>{0.126021445f, 0.608312905f},
-std::array<float,2>{0.925011158f, 0.54415375f},
-std::array<float,2>{0.419235855f, 0.357476026f},
-std::array<float,2>{0.691523254f, 0.0659906194f},
-std::array<float,2>{0.0197542962f, 0.925124943f},
-std::array<float,2>{0.60646522f, 0.771696627f},
-std::array<float,2>{0.223793849f, 0.248076424f},
-std::array<float,2>{0.826404333f, 0.40354538f},
-std::array<float,2>{0.30576852f, 0.638505816f},
-std::array<float,2>{0.586681843f, 0.651180983f},
-std::array<float,2>{0.214406803f, 0.37966612f},
-std::array<float,2>{0.859069228f, 0.222336948f},
-std::array<float,2>{0.274212033f, 0.760697424f},
-std::array<float,2>{0.884645641f, 0.913755059f},
-std::array<float,2>{0.384106696f, 0.0831521302f},
-std::array<float,2>{0.734686911f, 0.362779319f},
-std::array<float,2>{0.0454493724f, 0.55129385f},
-std::array<float,2>{0.776409805f, 0.615094781f},
-std::array<float,2>{0.338902116f, 0.281500101f},
-std::array<float,2>{0.500181496f, 0.0563710295f},
-std::array<float,2>{0.162298039f, 0.940815926f},
-std::array<float,2>{0.6547364f, 0.840893686f},
-std::array<float,2>{0.0681390762f, 0.145852968f},
-std::array<float,2>{0.98864615f, 0.441527694f},
-std::array<float,2>{0.455331624f, 0.711375833f},
-std::array<float,2>{0.716377497f, 0.517866611f},
-std::array<float,2>{0.0028503642f, 0.327251643f},
-std::array<float,2>{0.917333484f, 0.117930137f},
-std::array<float,2>{0.434848845f, 0.879119277f},
-std::array<float,2>{0.831518769f, 0.792496324f},
-std::array<float,2>{0.28414619f, 0.193574652f},
-std::array<float,2>{0.61597538f, 0.436656743f},
-std::array<float,2>{0.247631893f, 0.663078427f},
-std::array<float,2>{0.945305943f, 0.734692276f},
-std::array<float,2>{0.482335716f, 0.49502483f},
-std::array<float,2>{0.685157537f, 0.182530612f},
-std::array<float,2>{0.101706117f, 0.862652957f},
-std::array<float,2>{0.557985842f, 0.983199716f},
-std::array<float,2>{0.141553879f, 0.0273174513f},
-std::array<float,2>{0.792396724f, 0.255358189f},
-std::array<float,2>{0.361092657f, 0.585679054f},
-std::array<float,2>{0.573590279f, 0.622737944f},
-std::array<float,2>{0.196548656f, 0.289662212f},
-std::array<float,2>{0.869016588f, 0.0476542562f},
-std::array<float,2>{0.25593549f, 0.947351635f},
-std::array<float,2>{0.893708885f, 0.831790745f},
-std::array<float,2>{0.40389514f, 0.155174091f},
-std::array<float,2>{0.732406139f, 0.452436328f},
-std::array<float,2>{0.0547860041f, 0.71040678f},
-std::array<float,2>{0.755909324f, 0.643670559f},
-std::array<float,2>{0.324110478f, 0.387408942f},
-std::array<float,2>{0.523703873f, 0.226808041f},
-std::array<float,2>{0.178461879f, 0.75609076f},
-std::array<float,2>{0.627854884f, 0.917853832f},
-std::array<float,2>{0.0795467496f, 0.0919699594f},
-std::array<float,2>{0.978974998f, 0.37187165f},
-std::array<float,2>{0.438179165f, 0.557244301f},
-std::array<float,2>{0.690165699f, 0.745377719f},
-std::array<float,2>{0.0184803698f, 0.484935731f},
-std::array<float,2>{0.927308142f, 0.172527462f},
-std::array<float,2>{0.417539537f, 0.873082459f},
-std::array<float,2>{0.82370621f, 0.97133249f},
-std::array<float,2>{0.31115064f, 0.0227176473f},
-std::array<float,2>{0.604430139f, 0.260997802f},
-std::array<float,2>{0.222459242f, 0.590675771f},
-std::array<float,2>{0.96052897f, 0.526069403f},
-std::array<float,2>{0.485020369f, 0.318269044f},
-std::array<float,2>{0.669795334f, 0.109830365f},
-std::array<float,2>{0.115301371f, 0.886306584f},
-std::array<float,2>{0.533969343f, 0.788982153f},
-std::array<float,2>{0.132745713f, 0.198345304f},
-std::array<float,2>{0.810989022f, 0.424845606f},
-std::array<float,2>{0.34932664f, 0.670251727f},
-std::array<float,2>{0.505239964f, 0.679681182f},
-std::array<float,2>{0.156306028f, 0.406464487f},
-std::array<float,2>{0.780926883f, 0.204348803f},
-std::array<float,2>{0.340936959f, 0.807157218f},
-std::array<float,2>{0.986776114f, 0.903147995f},
-std::array<float,2>{0.459397376f, 0.107993267f},
-std::array<float,2>{0.649251342f, 0.336384326f},
-std::array<float,2>{0.0663440004f, 0.502076209f},
-std::array<float,2>{0.854473591f, 0.575196385f},
-std::array<float,2>{0.277616262f, 0.279760301f},
-std::array<float,2>{0.590350628f, 0.00438502897f},
-std::array<float,2>{0.21658282f, 0.989474475f},
-std::array<float,2>{0.74168241f, 0.858788133f},
-std::array<float,2>{0.0422136672f, 0.169665888f},
-std::array<float,2>{0.887045264f, 0.479065776f},
-std::array<float,2>{0.389975429f, 0.720174015f},
-std::array<float,2>{0.680416346f, 0.531346858f},
-std::array<float,2>{0.10914319f, 0.344565779f},
-std::array<float,2>{0.940394998f, 0.0711506382f},
-std::array<float,2>{0.479984015f, 0.936148226f},
-std::array<float,2>{0.793810129f, 0.77461344f},
-std::array<float,2>{0.366718709f, 0.23541446f},
-std::array<float,2>{0.561443746f, 0.392792016f},
-std::array<float,2>{0.145767286f, 0.631186008f},
-std::array<float,2>{0.91852355f, 0.69152528f},
-std::array<float,2>{0.431206554f, 0.467348844f},
-std::array<float,2>{0.711625397f, 0.13921842f},
-std::array<float,2>{0.00584581308f, 0.814219952f},
-std::array<float,2>{0.610928297f, 0.967566609f},
-std::array<float,2>{0.244597688f, 0.0463724099f},
-std::array<float,2>{0.834742486f, 0.297255278f},
-std::array<float,2>{0.287996829f, 0.599913359f},
-std::array<float,2>{0.550404072f, 0.515073419f},
-std::array<float,2>{0.154114366f, 0.33160606f},
-std::array<float,2>{0.788155556f, 0.0956084505f},
-std::array<float,2>{0.372090608f, 0.893258095f},
-std::array<float,2>{0.945670247f, 0.801712751f},
-std::array<float,2>{0.473623425f, 0.218745545f},
-std::array<float,2>{0.676050246f, 0.416054875f},
-std::array<float,2>{0.0942627862f, 0.683637321f},
-std::array<float,2>{0.84173876f, 0.729599416f},
-std::array<float,2>{0.293238878f, 0.468926102f},
-std::array<float,2>{0.617654085f, 0.16126205f},
-std::array<float,2>{0.238542721f, 0.851309538f},
-std::array<float,2>{0.710340142f, 0.994345605f},
-std::array<float,2>{0.015293627f, 0.0133299939f},
-std::array<float,2>{0.908551514f, 0.27255249f},
-std::array<float,2>{0.426915616f, 0.563265681f},
-std::array<float,2>{0.6427055f, 0.634436727f},
-std::array<float,2>{0.0705889761f, 0.399135023f},
-std::array<float,2>{0.995050848f, 0.243170753f},
-std::array<float,2>{0.46489647f, 0.767881691f},
-std::array<float,2>{0.767002106f, 0.927503884f},
-std::array<float,2>{0.334983587f, 0.0681328401f},
-std::array<float,2>{0.510801613f, 0.355131745f},
-std::array<float,2>{0.165351436f, 0.542003155f},
-std::array<float,2>{0.876910329f, 0.602949202f},
-std::array<float,2>{0.379811764f, 0.310145527f},
-std::array<float,2>{0.746513963f, 0.0322325975f},
-std::array<float,2>{0.03319747f, 0.960175753f},
-std::array<float,2>{0.579861522f, 0.821806192f},
-std::array<float,2>{0.208065659f, 0.128576726f},
-std::array<float,2>{0.850224555f, 0.453189343f},
-std::array<float,2>{0.272538036f, 0.69620949f},
-std::array<float,2>{0.595859826f, 0.717604518f},
-std::array<float,2>{0.233241722f, 0.437992752f},
-std::array<float,2>{0.814505219f, 0.142922863f},
-std::array<float,2>{0.299979866f, 0.839421749f},
-std::array<float,2>{0.934779406f, 0.941734433f},
-std::array<float,2>{0.410103381f, 0.0612042323f},
-std::array<float,2>{0.702078164f, 0.288836867f},
-std::array<float,2>{0.0237830207f, 0.612943947f},
-std::array<float,2>{0.798478067f, 0.549228489f},
-std::array<float,2>{0.357144386f, 0.363977194f},
-std::array<float,2>{0.540898621f, 0.0805174336f},
-std::array<float,2>{0.134574845f, 0.908028066f},
-std::array<float,2>{0.657757223f, 0.765058279f},
-std::array<float,2>{0.122852407f, 0.225194991f},
-std::array<float,2>{0.966049671f, 0.376863748f},
-std::array<float,2>{0.496476322f, 0.655503333f},
-std::array<float,2>{0.725007653f, 0.578774273f},
-std::array<float,2>{0.0519778505f, 0.252436817f},
-std::array<float,2>{0.901582599f, 0.0305475108f},
-std::array<float,2>{0.391881585f, 0.978489339f},
-std::array<float,2>{0.861768067f, 0.866846502f},
-std::array<float,2>{0.259006321f, 0.186924353f},
-std::array<float,2>{0.564864159f, 0.496851087f},
-std::array<float,2>{0.187949583f, 0.740063131f},
-std::array<float,2>{0.974566579f, 0.658048689f},
-std::array<float,2>{0.44784686f, 0.430488616f},
-std::array<float,2>{0.63723731f, 0.187623337f},
-std::array<float,2>{0.0885776132f, 0.794989705f},
-std::array<float,2>{0.518634021f, 0.876289129f},
-std::array<float,2>{0.185137898f, 0.122739479f},
-std::array<float,2>{0.761039734f, 0.322405487f},
-std::array<float,2>{0.316559255f, 0.522698939f},
-std::array<float,2>{0.571236134f, 0.557411015f},
-std::array<float,2>{0.198413208f, 0.371686667f},
-std::array<float,2>{0.870593727f, 0.0921304822f},
-std::array<float,2>{0.255711347f, 0.917537808f},
-std::array<float,2>{0.891306341f, 0.75616008f},
-std::array<float,2>{0.405061096f, 0.226641133f},
-std::array<float,2>{0.733490765f, 0.387666136f},
-std::array<float,2>{0.05777492f, 0.643877089f},
-std::array<float,2>{0.754526496f, 0.710146189f},
-std::array<float,2>{0.320673615f, 0.452160597f},
-std::array<float,2>{0.526633263f, 0.154831395f},
-std::array<float,2>{0.176951468f, 0.831712782f},
-std::array<float,2>{0.625632942f, 0.947733998f},
-std::array<float,2>{0.0804344341f, 0.0474871248f},
-std::array<float,2>{0.978204966f, 0.289966285f},
-std::array<float,2>{0.440119863f, 0.623005867f},
-std::array<float,2>{0.688436985f, 0.670085728f},
-std::array<float,2>{0.0161872059f, 0.425140649f},
-std::array<float,2>{0.929054558f, 0.19862698f},
-std::array<float,2>{0.41476509f, 0.788793802f},
-std::array<float,2>{0.821213841f, 0.88669771f},
-std::array<float,2>{0.308813691f, 0.109404176f},
-std::array<float,2>{0.602239907f, 0.317969918f},
-std::array<float,2>{0.219696969f, 0.526273489f},
-std::array<float,2>{0.958830476f, 0.590476036f},
-std::array<float,2>{0.487630546f, 0.260801733f},
-std::array<float,2>{0.671174824f, 0.0226182006f},
-std::array<float,2>{0.115184903f, 0.971464634f},
-std::array<float,2>{0.53131628f, 0.873533666f},
-std::array<float,2>{0.129669234f, 0.17264384f},
-std::array<float,2>{0.809998989f, 0.485189378f},
-std::array<float,2>{0.349955499f, 0.745272636f},
-std::array<float,2>{0.507284284f, 0.719845474f},
-std::array<float,2>{0.159112558f, 0.479333729f},
-std::array<float,2>{0.777946711f, 0.169700176f},
-std::array<float,2>{0.342926383f, 0.858455241f},
-std::array<float,2>{0.985185444f, 0.989738524f},
-std::array<float,2>{0.457595289f, 0.00409981329f},
-std::array<float,2>{0.651090026f, 0.279370368f},
-std::array<float,2>{0.0640951991f, 0.57559216f},
-std::array<float,2>{0.851707816f, 0.502438426f},
-std::array<float,2>{0.280437142f, 0.336016953f},
-std::array<float,2>{0.592787206f, 0.108388923f},
-std::array<float,2>{0.217835963f, 0.902998269f},
-std::array<float,2>{0.738600016f, 0.807579696f},
-std::array<float,2>{0.0403344855f, 0.204133943f},
-std::array<float,2>{0.889047146f, 0.406531245f},
-std::array<float,2>{0.3882339f, 0.6792382f},
-std::array<float,2>{0.68290025f, 0.599726379f},
-std::array<float,2>{0.106074989f, 0.297032237f},
-std::array<float,2>{0.939195693f, 0.0460591763f},
-std::array<float,2>{0.478059649f, 0.96733278f},
-std::array<float,2>{0.794931591f, 0.81398344f},
-std::array<float,2>{0.364375234f, 0.139475569f},
-std::array<float,2>{0.559806168f, 0.467691362f},
-std::array<float,2>{0.147153512f, 0.691693306f},
-std::array<float,2>{0.919954419f, 0.630901217f},
-std::array<float,2>{0.432681382f, 0.392837107f},
-std::array<float,2>{0.713969171f, 0.235791713f},
-std::array<float,2>{0.00607258687f, 0.774806321f},
-std::array<float,2>{0.612597585f, 0.936407387f},
-std::array<float,2>{0.243343666f, 0.0709143579f},
-std::array<float,2>{0.832375646f, 0.344368041f},
-std::array<float,2>{0.287103653f, 0.531618297f},
-std::array<float,2>{0.547958195f, 0.563224852f},
-std::array<float,2>{0.155112207f, 0.272836804f},
-std::array<float,2>{0.78703779f, 0.0134891383f},
-std::array<float,2>{0.374128073f, 0.99454385f},
-std::array<float,2>{0.948897421f, 0.851460516f},
-std::array<float,2>{0.476179004f, 0.161460221f},
-std::array<float,2>{0.678917825f, 0.469238013f},
-std::array<float,2>{0.0969463363f, 0.729762435f},
-std::array<float,2>{0.842005193f, 0.683956921f},
-std::array<float,2>{0.295568019f, 0.416336328f},
-std::array<float,2>{0.619862139f, 0.218478665f},
-std::array<float,2>{0.240819812f, 0.801465809f},
-std::array<float,2>{0.708631337f, 0.893429935f},
-std::array<float,2>{0.0122506358f, 0.0952254236f},
-std::array<float,2>{0.906842768f, 0.331938237f},
-std::array<float,2>{0.428127468f, 0.514704645f},
-std::array<float,2>{0.64154166f, 0.69596386f},
-std::array<float,2>{0.0741702989f, 0.453519136f},
-std::array<float,2>{0.993633628f, 0.128723681f},
-std::array<float,2>{0.467181921f, 0.822119176f},
-std::array<float,2>{0.769082129f, 0.960381627f},
-std::array<float,2>{0.333792388f, 0.0324887186f},
-std::array<float,2>{0.509134471f, 0.310441226f},
-std::array<float,2>{0.166549981f, 0.602550507f},
-std::array<float,2>{0.877731979f, 0.542241752f},
-std::array<float,2>{0.38212949f, 0.355354637f},
-std::array<float,2>{0.748879075f, 0.0679712594f},
-std::array<float,2>{0.0337964073f, 0.927310228f},
-std::array<float,2>{0.581631005f, 0.767763913f},
-std::array<float,2>{0.209118187f, 0.24348639f},
-std::array<float,2>{0.847663224f, 0.399334103f},
-std::array<float,2>{0.269557506f, 0.634529412f},
-std::array<float,2>{0.595552325f, 0.65565145f},
-std::array<float,2>{0.23127754f, 0.376690477f},
-std::array<float,2>{0.813607097f, 0.22545439f},
-std::array<float,2>{0.297331423f, 0.764723241f},
-std::array<float,2>{0.937380314f, 0.90774405f},
-std::array<float,2>{0.40689379f, 0.0802309662f},
-std::array<float,2>{0.69932431f, 0.364212245f},
-std::array<float,2>{0.0267199576f, 0.549068153f},
-std::array<float,2>{0.800372362f, 0.613175154f},
-std::array<float,2>{0.358198315f, 0.288764417f},
-std::array<float,2>{0.541590393f, 0.0614247061f},
-std::array<float,2>{0.134955615f, 0.941581428f},
-std::array<float,2>{0.65965718f, 0.839807212f},
-std::array<float,2>{0.123057999f, 0.142683908f},
-std::array<float,2>{0.967878044f, 0.438258797f},
-std::array<float,2>{0.498332351f, 0.717378676f},
-std::array<float,2>{0.724370778f, 0.522894382f},
-std::array<float,2>{0.0536896549f, 0.322716475f},
-std::array<float,2>{0.899269223f, 0.122903354f},
-std::array<float,2>{0.393070638f, 0.876190305f},
-std::array<float,2>{0.859755576f, 0.795255959f},
-std::array<float,2>{0.259909958f, 0.187765226f},
-std::array<float,2>{0.563224137f, 0.430350155f},
-std::array<float,2>{0.190699026f, 0.657821596f},
-std::array<float,2>{0.974980652f, 0.73998487f},
-std::array<float,2>{0.445795506f, 0.496635199f},
-std::array<float,2>{0.640009999f, 0.186713517f},
-std::array<float,2>{0.0876514465f, 0.86707437f},
-std::array<float,2>{0.517391562f, 0.978083551f},
-std::array<float,2>{0.186896741f, 0.0304669291f},
-std::array<float,2>{0.758247077f, 0.252120137f},
-std::array<float,2>{0.319325626f, 0.578940928f},
-std::array<float,2>{0.623988509f, 0.620203674f},
-std::array<float,2>{0.2368882f, 0.296764433f},
-std::array<float,2>{0.837393701f, 0.0539719239f},
-std::array<float,2>{0.2911309f, 0.952895522f},
-std::array<float,2>{0.910933077f, 0.835463166f},
-std::array<float,2>{0.424438179f, 0.151557416f},
-std::array<float,2>{0.70425576f, 0.449160337f},
-std::array<float,2>{0.010640597f, 0.704494417f},
-std::array<float,2>{0.783930779f, 0.645034492f},
-std::array<float,2>{0.367893547f, 0.38553974f},
-std::array<float,2>{0.55311352f, 0.233845264f},
-std::array<float,2>{0.149799332f, 0.753522098f},
-std::array<float,2>{0.674668372f, 0.918548644f},
-std::array<float,2>{0.100132838f, 0.0882031843f},
-std::array<float,2>{0.949609697f, 0.368840307f},
-std::array<float,2>{0.470278889f, 0.558701158f},
-std::array<float,2>{0.743605018f, 0.749346018f},
-std::array<float,2>{0.038174931f, 0.49108246f},
-std::array<float,2>{0.880094767f, 0.178083971f},
-std::array<float,2>{0.378520936f, 0.86874032f},
-std::array<float,2>{0.847215831f, 0.975947559f},
-std::array<float,2>{0.268856704f, 0.0184167232f},
-std::array<float,2>{0.583414912f, 0.262988299f},
-std::array<float,2>{0.206951052f, 0.589071035f},
-std::array<float,2>{0.998418391f, 0.529652238f},
-std::array<float,2>{0.464343041f, 0.315390944f},
-std::array<float,2>{0.646720111f, 0.114097938f},
-std::array<float,2>{0.0759333596f, 0.887779534f},
-std::array<float,2>{0.514999509f, 0.781381905f},
-std::array<float,2>{0.168242961f, 0.199965835f},
-std::array<float,2>{0.770488203f, 0.4287301f},
-std::array<float,2>{0.330294728f, 0.667246103f},
-std::array<float,2>{0.546218276f, 0.675053656f},
-std::array<float,2>{0.137578696f, 0.410319477f},
-std::array<float,2>{0.803070962f, 0.207083359f},
-std::array<float,2>{0.353814423f, 0.810612321f},
-std::array<float,2>{0.961320162f, 0.899755955f},
-std::array<float,2>{0.492701739f, 0.102905557f},
-std::array<float,2>{0.662332475f, 0.341023833f},
-std::array<float,2>{0.118934989f, 0.505586863f},
-std::array<float,2>{0.819696724f, 0.573712766f},
-std::array<float,2>{0.301645428f, 0.275456756f},
-std::array<float,2>{0.598678768f, 0.00112255209f},
-std::array<float,2>{0.229373723f, 0.985696197f},
-std::array<float,2>{0.697230577f, 0.852953911f},
-std::array<float,2>{0.0282615907f, 0.165827826f},
-std::array<float,2>{0.930819452f, 0.481525391f},
-std::array<float,2>{0.411893964f, 0.724669218f},
-std::array<float,2>{0.635672688f, 0.537066519f},
-std::array<float,2>{0.0912370235f, 0.349460483f},
-std::array<float,2>{0.970512927f, 0.0766422376f},
-std::array<float,2>{0.449239105f, 0.929900348f},
-std::array<float,2>{0.765321851f, 0.778442204f},
-std::array<float,2>{0.314700603f, 0.240210727f},
-std::array<float,2>{0.521986067f, 0.395458311f},
-std::array<float,2>{0.182498172f, 0.627757967f},
-std::array<float,2>{0.903998137f, 0.688057482f},
-std::array<float,2>{0.397254825f, 0.464464277f},
-std::array<float,2>{0.721320629f, 0.13474229f},
-std::array<float,2>{0.05010432f, 0.819655061f},
-std::array<float,2>{0.568872511f, 0.962819517f},
-std::array<float,2>{0.193300411f, 0.0394275896f},
-std::array<float,2>{0.866974115f, 0.301139891f},
-std::array<float,2>{0.262613326f, 0.59595263f},
-std::array<float,2>{0.529063761f, 0.508339584f},
-std::array<float,2>{0.172830865f, 0.334724486f},
-std::array<float,2>{0.75347513f, 0.0991431996f},
-std::array<float,2>{0.324239314f, 0.894940972f},
-std::array<float,2>{0.980668366f, 0.798094034f},
-std::array<float,2>{0.444359511f, 0.212710142f},
-std::array<float,2>{0.629840255f, 0.418966979f},
-std::array<float,2>{0.0848340392f, 0.683058083f},
-std::array<float,2>{0.872887433f, 0.734092295f},
-std::array<float,2>{0.252006143f, 0.475698262f},
-std::array<float,2>{0.575366139f, 0.160154343f},
-std::array<float,2>{0.199339926f, 0.844358325f},
-std::array<float,2>{0.729350924f, 0.998229206f},
-std::array<float,2>{0.0587561429f, 0.0088807838f},
-std::array<float,2>{0.89625442f, 0.265748113f},
-std::array<float,2>{0.402269244f, 0.56704253f},
-std::array<float,2>{0.666549385f, 0.638355672f},
-std::array<float,2>{0.109787382f, 0.403774738f},
-std::array<float,2>{0.955464542f, 0.248530895f},
-std::array<float,2>{0.489866138f, 0.771963358f},
-std::array<float,2>{0.805616438f, 0.92490983f},
-std::array<float,2>{0.347188592f, 0.0663220435f},
-std::array<float,2>{0.536203742f, 0.357788831f},
-std::array<float,2>{0.127363652f, 0.544262469f},
-std::array<float,2>{0.923055291f, 0.607949197f},
-std::array<float,2>{0.420640826f, 0.30553627f},
-std::array<float,2>{0.695201337f, 0.0359122641f},
-std::array<float,2>{0.0225133374f, 0.954363704f},
-std::array<float,2>{0.608570218f, 0.825973094f},
-std::array<float,2>{0.226413712f, 0.130810633f},
-std::array<float,2>{0.826025784f, 0.459068358f},
-std::array<float,2>{0.308464468f, 0.700872183f},
-std::array<float,2>{0.588687479f, 0.711060941f},
-std::array<float,2>{0.212046057f, 0.441669852f},
-std::array<float,2>{0.855808318f, 0.14563553f},
-std::array<float,2>{0.276258051f, 0.841195703f},
-std::array<float,2>{0.885472238f, 0.940644622f},
-std::array<float,2>{0.385558039f, 0.0565273054f},
-std::array<float,2>{0.737803578f, 0.281428307f},
-std::array<float,2>{0.0441530049f, 0.614777505f},
-std::array<float,2>{0.774892807f, 0.551711202f},
-std::array<float,2>{0.336713314f, 0.362449318f},
-std::array<float,2>{0.503076196f, 0.0833366215f},
-std::array<float,2>{0.160160691f, 0.914017022f},
-std::array<float,2>{0.65401417f, 0.760257304f},
-std::array<float,2>{0.0689869449f, 0.222649485f},
-std::array<float,2>{0.990303457f, 0.379476041f},
-std::array<float,2>{0.454190493f, 0.651023626f},
-std::array<float,2>{0.717168629f, 0.585739017f},
-std::array<float,2>{0.000117927746f, 0.255075723f},
-std::array<float,2>{0.914299846f, 0.0270262696f},
-std::array<float,2>{0.435888112f, 0.982919276f},
-std::array<float,2>{0.829537213f, 0.862477899f},
-std::array<float,2>{0.28319782f, 0.182186633f},
-std::array<float,2>{0.614642024f, 0.49472034f},
-std::array<float,2>{0.249526054f, 0.734416008f},
-std::array<float,2>{0.943222344f, 0.662673891f},
-std::array<float,2>{0.484294057f, 0.436995983f},
-std::array<float,2>{0.687025011f, 0.193672121f},
-std::array<float,2>{0.104079045f, 0.792877793f},
-std::array<float,2>{0.555740058f, 0.879391134f},
-std::array<float,2>{0.143533975f, 0.117906272f},
-std::array<float,2>{0.790268898f, 0.327498823f},
-std::array<float,2>{0.3631576f, 0.517635286f},
-std::array<float,2>{0.604635894f, 0.524422705f},
-std::array<float,2>{0.221572608f, 0.31844005f},
-std::array<float,2>{0.822397232f, 0.111535802f},
-std::array<float,2>{0.311775148f, 0.883741558f},
-std::array<float,2>{0.926064909f, 0.787082434f},
-std::array<float,2>{0.416042209f, 0.196827516f},
-std::array<float,2>{0.691170752f, 0.42191714f},
-std::array<float,2>{0.0194136389f, 0.668672442f},
-std::array<float,2>{0.812494636f, 0.74229449f},
-std::array<float,2>{0.348186821f, 0.488028884f},
-std::array<float,2>{0.534517884f, 0.174307793f},
-std::array<float,2>{0.131320149f, 0.871318042f},
-std::array<float,2>{0.66882956f, 0.969397128f},
-std::array<float,2>{0.117060542f, 0.0199499894f},
-std::array<float,2>{0.959376514f, 0.258619189f},
-std::array<float,2>{0.485362768f, 0.592175245f},
-std::array<float,2>{0.731256723f, 0.642402053f},
-std::array<float,2>{0.056174431f, 0.389812201f},
-std::array<float,2>{0.893118918f, 0.229524225f},
-std::array<float,2>{0.403140038f, 0.753952801f},
-std::array<float,2>{0.867477417f, 0.91546452f},
-std::array<float,2>{0.257090062f, 0.0917033404f},
-std::array<float,2>{0.572574317f, 0.373414308f},
-std::array<float,2>{0.195703864f, 0.555135667f},
-std::array<float,2>{0.97989583f, 0.624918818f},
-std::array<float,2>{0.439411074f, 0.291089296f},
-std::array<float,2>{0.627962232f, 0.0495597832f},
-std::array<float,2>{0.0785239339f, 0.945360839f},
-std::array<float,2>{0.524531245f, 0.828869462f},
-std::array<float,2>{0.179183841f, 0.154226899f},
-std::array<float,2>{0.757668912f, 0.449679136f},
-std::array<float,2>{0.322637558f, 0.707340896f},
-std::array<float,2>{0.561917663f, 0.695063651f},
-std::array<float,2>{0.145232007f, 0.46629858f},
-std::array<float,2>{0.794166684f, 0.137790889f},
-std::array<float,2>{0.365366578f, 0.814851761f},
-std::array<float,2>{0.940929234f, 0.965167522f},
-std::array<float,2>{0.479104877f, 0.0429879352f},
-std::array<float,2>{0.68149817f, 0.30024907f},
-std::array<float,2>{0.108031146f, 0.599138975f},
-std::array<float,2>{0.835864604f, 0.534976244f},
-std::array<float,2>{0.288945436f, 0.346586704f},
-std::array<float,2>{0.609963059f, 0.0739697367f},
-std::array<float,2>{0.245276034f, 0.934651852f},
-std::array<float,2>{0.712456524f, 0.776567519f},
-std::array<float,2>{0.0047096191f, 0.237535968f},
-std::array<float,2>{0.919685364f, 0.391412288f},
-std::array<float,2>{0.430655539f, 0.629500747f},
-std::array<float,2>{0.650223732f, 0.577525377f},
-std::array<float,2>{0.0647613406f, 0.277408779f},
-std::array<float,2>{0.987365425f, 0.00665168697f},
-std::array<float,2>{0.460275531f, 0.992019355f},
-std::array<float,2>{0.780101418f, 0.856567144f},
-std::array<float,2>{0.340317756f, 0.171517968f},
-std::array<float,2>{0.504254699f, 0.478491634f},
-std::array<float,2>{0.157872677f, 0.721015275f},
-std::array<float,2>{0.887875974f, 0.676183641f},
-std::array<float,2>{0.389536381f, 0.410062611f},
-std::array<float,2>{0.740551114f, 0.205518737f},
-std::array<float,2>{0.0411654413f, 0.804882288f},
-std::array<float,2>{0.591070771f, 0.904430747f},
-std::array<float,2>{0.215306759f, 0.10570965f},
-std::array<float,2>{0.854868174f, 0.338928819f},
-std::array<float,2>{0.279154867f, 0.5004673f},
-std::array<float,2>{0.50993228f, 0.605250716f},
-std::array<float,2>{0.164702773f, 0.31192705f},
-std::array<float,2>{0.765822709f, 0.0336929485f},
-std::array<float,2>{0.334855288f, 0.957612813f},
-std::array<float,2>{0.995719552f, 0.822304666f},
-std::array<float,2>{0.466394812f, 0.125444323f},
-std::array<float,2>{0.643973112f, 0.455817908f},
-std::array<float,2>{0.0721705705f, 0.69804126f},
-std::array<float,2>{0.851210594f, 0.636254549f},
-std::array<float,2>{0.271765709f, 0.401757389f},
-std::array<float,2>{0.578946114f, 0.245049194f},
-std::array<float,2>{0.207656458f, 0.767103314f},
-std::array<float,2>{0.747191489f, 0.928216517f},
-std::array<float,2>{0.0319440924f, 0.0700642318f},
-std::array<float,2>{0.875889421f, 0.35285154f},
-std::array<float,2>{0.380341351f, 0.540613055f},
-std::array<float,2>{0.677040398f, 0.728346884f},
-std::array<float,2>{0.0955111757f, 0.472112864f},
-std::array<float,2>{0.94690299f, 0.163979188f},
-std::array<float,2>{0.474556893f, 0.849445701f},
-std::array<float,2>{0.787651062f, 0.993361771f},
-std::array<float,2>{0.371876061f, 0.0154538481f},
-std::array<float,2>{0.549347878f, 0.270669997f},
-std::array<float,2>{0.15316394f, 0.566354632f},
-std::array<float,2>{0.90992105f, 0.513508856f},
-std::array<float,2>{0.425947636f, 0.32947433f},
-std::array<float,2>{0.70955658f, 0.097282052f},
-std::array<float,2>{0.0141264973f, 0.892039597f},
-std::array<float,2>{0.618455708f, 0.804597318f},
-std::array<float,2>{0.239959866f, 0.214933038f},
-std::array<float,2>{0.840129614f, 0.415688276f},
-std::array<float,2>{0.294223338f, 0.685758471f},
-std::array<float,2>{0.566022754f, 0.659808934f},
-std::array<float,2>{0.189113602f, 0.432426661f},
-std::array<float,2>{0.862660766f, 0.189526916f},
-std::array<float,2>{0.258366227f, 0.793438852f},
-std::array<float,2>{0.900489807f, 0.87710166f},
-std::array<float,2>{0.391445607f, 0.123318195f},
-std::array<float,2>{0.725620925f, 0.320648313f},
-std::array<float,2>{0.0513284504f, 0.521237195f},
-std::array<float,2>{0.760635734f, 0.580478251f},
-std::array<float,2>{0.31744051f, 0.250757486f},
-std::array<float,2>{0.517610669f, 0.0292074587f},
-std::array<float,2>{0.184368029f, 0.978556573f},
-std::array<float,2>{0.637741327f, 0.864812553f},
-std::array<float,2>{0.0890793651f, 0.185290784f},
-std::array<float,2>{0.973013163f, 0.498261809f},
-std::array<float,2>{0.448656291f, 0.740781724f},
-std::array<float,2>{0.702240884f, 0.547827125f},
-std::array<float,2>{0.0247389227f, 0.365586758f},
-std::array<float,2>{0.934480727f, 0.0787566453f},
-std::array<float,2>{0.408645809f, 0.909846187f},
-std::array<float,2>{0.815851331f, 0.762271047f},
-std::array<float,2>{0.299144357f, 0.222915247f},
-std::array<float,2>{0.596897364f, 0.377714962f},
-std::array<float,2>{0.234363228f, 0.653935015f},
-std::array<float,2>{0.965794802f, 0.715204835f},
-std::array<float,2>{0.497457802f, 0.440118492f},
-std::array<float,2>{0.656253815f, 0.141935378f},
-std::array<float,2>{0.121503599f, 0.836478114f},
-std::array<float,2>{0.539202213f, 0.944454193f},
-std::array<float,2>{0.133217633f, 0.0586553849f},
-std::array<float,2>{0.797443628f, 0.285304219f},
-std::array<float,2>{0.356354654f, 0.609768569f},
-std::array<float,2>{0.585476518f, 0.587786376f},
-std::array<float,2>{0.204370737f, 0.265298069f},
-std::array<float,2>{0.843870163f, 0.0159418527f},
-std::array<float,2>{0.266269624f, 0.974429369f},
-std::array<float,2>{0.882077992f, 0.869984806f},
-std::array<float,2>{0.375674278f, 0.176302448f},
-std::array<float,2>{0.74420619f, 0.489741743f},
-std::array<float,2>{0.0367284827f, 0.747147202f},
-std::array<float,2>{0.773374915f, 0.66467154f},
-std::array<float,2>{0.329459101f, 0.426532149f},
-std::array<float,2>{0.512241125f, 0.20215486f},
-std::array<float,2>{0.171092227f, 0.784851372f},
-std::array<float,2>{0.645740092f, 0.888890266f},
-std::array<float,2>{0.0768937245f, 0.115404814f},
-std::array<float,2>{0.997529209f, 0.314014494f},
-std::array<float,2>{0.462731659f, 0.528567731f},
-std::array<float,2>{0.705186367f, 0.706942141f},
-std::array<float,2>{0.00820454769f, 0.445974857f},
-std::array<float,2>{0.912818789f, 0.14998728f},
-std::array<float,2>{0.423200309f, 0.832860947f},
-std::array<float,2>{0.838684738f, 0.949281514f},
-std::array<float,2>{0.289858043f, 0.0512779802f},
-std::array<float,2>{0.622816801f, 0.294494539f},
-std::array<float,2>{0.235930666f, 0.617620945f},
-std::array<float,2>{0.951834321f, 0.561278701f},
-std::array<float,2>{0.471271992f, 0.370095044f},
-std::array<float,2>{0.671966732f, 0.0870960578f},
-std::array<float,2>{0.0993093476f, 0.920424461f},
-std::array<float,2>{0.551848531f, 0.750145614f},
-std::array<float,2>{0.151170567f, 0.232006922f},
-std::array<float,2>{0.78295821f, 0.384165049f},
-std::array<float,2>{0.370453089f, 0.646766543f},
-std::array<float,2>{0.519798875f, 0.62539041f},
-std::array<float,2>{0.180072621f, 0.397113055f},
-std::array<float,2>{0.762511849f, 0.241754726f},
-std::array<float,2>{0.31278339f, 0.781122923f},
-std::array<float,2>{0.972323298f, 0.931708097f},
-std::array<float,2>{0.452214181f, 0.0743985772f},
-std::array<float,2>{0.634724498f, 0.350672156f},
-std::array<float,2>{0.0932345912f, 0.537524045f},
-std::array<float,2>{0.864194274f, 0.595148444f},
-std::array<float,2>{0.264406204f, 0.303210527f},
-std::array<float,2>{0.56677413f, 0.0415093005f},
-std::array<float,2>{0.194231391f, 0.962891579f},
-std::array<float,2>{0.718958795f, 0.816728711f},
-std::array<float,2>{0.0470172539f, 0.136188984f},
-std::array<float,2>{0.905464172f, 0.462019026f},
-std::array<float,2>{0.396229684f, 0.690403759f},
-std::array<float,2>{0.660398245f, 0.507220387f},
-std::array<float,2>{0.119633317f, 0.343144089f},
-std::array<float,2>{0.96355778f, 0.10415148f},
-std::array<float,2>{0.495507151f, 0.900451481f},
-std::array<float,2>{0.801875532f, 0.810335338f},
-std::array<float,2>{0.353097141f, 0.209097847f},
-std::array<float,2>{0.544860482f, 0.41317457f},
-std::array<float,2>{0.140129626f, 0.673592806f},
-std::array<float,2>{0.931825817f, 0.7243191f},
-std::array<float,2>{0.412112236f, 0.483741939f},
-std::array<float,2>{0.699069798f, 0.166725203f},
-std::array<float,2>{0.0299048442f, 0.854137242f},
-std::array<float,2>{0.600208759f, 0.987764657f},
-std::array<float,2>{0.227231488f, 0.00332324184f},
-std::array<float,2>{0.818229139f, 0.273899347f},
-std::array<float,2>{0.304106146f, 0.571958184f},
-std::array<float,2>{0.537806511f, 0.545384765f},
-std::array<float,2>{0.125487521f, 0.356302619f},
-std::array<float,2>{0.80792892f, 0.0633974001f},
-std::array<float,2>{0.345022202f, 0.922067404f},
-std::array<float,2>{0.953777373f, 0.76961422f},
-std::array<float,2>{0.491744488f, 0.247765794f},
-std::array<float,2>{0.665863693f, 0.405231893f},
-std::array<float,2>{0.112691835f, 0.640226364f},
-std::array<float,2>{0.828088045f, 0.7024315f},
-std::array<float,2>{0.30477041f, 0.457417995f},
-std::array<float,2>{0.605876088f, 0.131646872f},
-std::array<float,2>{0.22276406f, 0.826905727f},
-std::array<float,2>{0.692874014f, 0.955163062f},
-std::array<float,2>{0.0212617163f, 0.0380054042f},
-std::array<float,2>{0.924717963f, 0.308038116f},
-std::array<float,2>{0.418492049f, 0.607094228f},
-std::array<float,2>{0.631876171f, 0.681182981f},
-std::array<float,2>{0.0831048861f, 0.42150405f},
-std::array<float,2>{0.983509421f, 0.212989166f},
-std::array<float,2>{0.441500336f, 0.799401402f},
-std::array<float,2>{0.751590312f, 0.896802545f},
-std::array<float,2>{0.32623437f, 0.100384057f},
-std::array<float,2>{0.530124545f, 0.332236618f},
-std::array<float,2>{0.175079659f, 0.510273635f},
-std::array<float,2>{0.896695077f, 0.569380939f},
-std::array<float,2>{0.398539722f, 0.269364238f},
-std::array<float,2>{0.726765215f, 0.0105940318f},
-std::array<float,2>{0.0621243864f, 0.996484995f},
-std::array<float,2>{0.578041136f, 0.846842349f},
-std::array<float,2>{0.201346532f, 0.15761137f},
-std::array<float,2>{0.874849975f, 0.473291934f},
-std::array<float,2>{0.251822978f, 0.731612206f},
-std::array<float,2>{0.616757631f, 0.736448824f},
-std::array<float,2>{0.246672928f, 0.493347257f},
-std::array<float,2>{0.830671787f, 0.180305451f},
-std::array<float,2>{0.284732461f, 0.861200273f},
-std::array<float,2>{0.916353405f, 0.982267439f},
-std::array<float,2>{0.434152842f, 0.0253531057f},
-std::array<float,2>{0.714915991f, 0.256825447f},
-std::array<float,2>{0.00307332678f, 0.583308101f},
-std::array<float,2>{0.791884005f, 0.517513216f},
-std::array<float,2>{0.360344648f, 0.324996561f},
-std::array<float,2>{0.557473361f, 0.120745294f},
-std::array<float,2>{0.142007709f, 0.882804096f},
-std::array<float,2>{0.683666527f, 0.789212346f},
-std::array<float,2>{0.102736019f, 0.193019286f},
-std::array<float,2>{0.943623126f, 0.435252994f},
-std::array<float,2>{0.480633259f, 0.66209358f},
-std::array<float,2>{0.735675573f, 0.616282821f},
-std::array<float,2>{0.0462858081f, 0.284067988f},
-std::array<float,2>{0.88301909f, 0.0585312322f},
-std::array<float,2>{0.383173019f, 0.939198375f},
-std::array<float,2>{0.857956052f, 0.842202187f},
-std::array<float,2>{0.274430186f, 0.147478849f},
-std::array<float,2>{0.587567985f, 0.444090545f},
-std::array<float,2>{0.212999791f, 0.713951945f},
-std::array<float,2>{0.989896774f, 0.649083018f},
-std::array<float,2>{0.456108868f, 0.380980104f},
-std::array<float,2>{0.655470371f, 0.22029686f},
-std::array<float,2>{0.0666691363f, 0.757920921f},
-std::array<float,2>{0.501325011f, 0.911306798f},
-std::array<float,2>{0.1633102f, 0.0855446458f},
-std::array<float,2>{0.776353478f, 0.359901667f},
-std::array<float,2>{0.337997615f, 0.553908885f},
-std::array<float,2>{0.592093468f, 0.501256168f},
-std::array<float,2>{0.217357844f, 0.33856076f},
-std::array<float,2>{0.853105426f, 0.106485136f},
-std::array<float,2>{0.279993296f, 0.905475497f},
-std::array<float,2>{0.890506089f, 0.806416512f},
-std::array<float,2>{0.387065172f, 0.206497028f},
-std::array<float,2>{0.739893854f, 0.408452749f},
-std::array<float,2>{0.0398545116f, 0.677129924f},
-std::array<float,2>{0.778411746f, 0.721902668f},
-std::array<float,2>{0.342447698f, 0.477533489f},
-std::array<float,2>{0.506378591f, 0.170405045f},
-std::array<float,2>{0.159776911f, 0.856023014f},
-std::array<float,2>{0.652105987f, 0.99059689f},
-std::array<float,2>{0.0631078035f, 0.00749121886f},
-std::array<float,2>{0.986243904f, 0.27901867f},
-std::array<float,2>{0.458666772f, 0.576801181f},
-std::array<float,2>{0.712923884f, 0.630165279f},
-std::array<float,2>{0.00774562592f, 0.392092913f},
-std::array<float,2>{0.921199977f, 0.236666903f},
-std::array<float,2>{0.432125211f, 0.776293993f},
-std::array<float,2>{0.833024323f, 0.933744848f},
-std::array<float,2>{0.285391569f, 0.0723115131f},
-std::array<float,2>{0.611897469f, 0.34718594f},
-std::array<float,2>{0.242839709f, 0.533441544f},
-std::array<float,2>{0.938188016f, 0.598440111f},
-std::array<float,2>{0.476629227f, 0.298969686f},
-std::array<float,2>{0.682313979f, 0.0447120853f},
-std::array<float,2>{0.107352912f, 0.966771364f},
-std::array<float,2>{0.558646858f, 0.815461457f},
-std::array<float,2>{0.148162812f, 0.136824995f},
-std::array<float,2>{0.796288669f, 0.465324193f},
-std::array<float,2>{0.363393843f, 0.693914652f},
-std::array<float,2>{0.526078641f, 0.708274543f},
-std::array<float,2>{0.17630665f, 0.450546771f},
-std::array<float,2>{0.755675554f, 0.153208956f},
-std::array<float,2>{0.321354538f, 0.829714f},
-std::array<float,2>{0.977102935f, 0.947166622f},
-std::array<float,2>{0.441167623f, 0.0507522114f},
-std::array<float,2>{0.626937628f, 0.292548209f},
-std::array<float,2>{0.0814648271f, 0.623701274f},
-std::array<float,2>{0.869561672f, 0.556609511f},
-std::array<float,2>{0.254556268f, 0.374484539f},
-std::array<float,2>{0.572220862f, 0.0899500176f},
-std::array<float,2>{0.197905838f, 0.914964736f},
-std::array<float,2>{0.732658148f, 0.755456686f},
-std::array<float,2>{0.0569281206f, 0.228562683f},
-std::array<float,2>{0.892263234f, 0.3893978f},
-std::array<float,2>{0.405644804f, 0.641236007f},
-std::array<float,2>{0.670059443f, 0.593069613f},
-std::array<float,2>{0.113296494f, 0.258790284f},
-std::array<float,2>{0.95711267f, 0.0208649635f},
-std::array<float,2>{0.487247169f, 0.970571756f},
-std::array<float,2>{0.809392035f, 0.87289083f},
-std::array<float,2>{0.351375461f, 0.175137267f},
-std::array<float,2>{0.532541454f, 0.486402035f},
-std::array<float,2>{0.13060689f, 0.743288994f},
-std::array<float,2>{0.928007424f, 0.66951865f},
-std::array<float,2>{0.415516347f, 0.42299822f},
-std::array<float,2>{0.689323723f, 0.195928007f},
-std::array<float,2>{0.0166425686f, 0.785169125f},
-std::array<float,2>{0.602973461f, 0.88446933f},
-std::array<float,2>{0.21976091f, 0.112958416f},
-std::array<float,2>{0.822102368f, 0.320199817f},
-std::array<float,2>{0.310066938f, 0.523687661f},
-std::array<float,2>{0.542741418f, 0.610838175f},
-std::array<float,2>{0.136080146f, 0.286965668f},
-std::array<float,2>{0.798882484f, 0.0603095554f},
-std::array<float,2>{0.359165788f, 0.944020689f},
-std::array<float,2>{0.967143834f, 0.837456405f},
-std::array<float,2>{0.499397993f, 0.141282111f},
-std::array<float,2>{0.659149706f, 0.440637171f},
-std::array<float,2>{0.124411218f, 0.716129303f},
-std::array<float,2>{0.812911153f, 0.652890921f},
-std::array<float,2>{0.298510104f, 0.378156692f},
-std::array<float,2>{0.594151258f, 0.224374413f},
-std::array<float,2>{0.232013881f, 0.763376117f},
-std::array<float,2>{0.700712264f, 0.908985376f},
-std::array<float,2>{0.0255717933f, 0.079117015f},
-std::array<float,2>{0.935743034f, 0.366546065f},
-std::array<float,2>{0.407257497f, 0.548687041f},
-std::array<float,2>{0.638946652f, 0.741258502f},
-std::array<float,2>{0.086602442f, 0.499612093f},
-std::array<float,2>{0.975934148f, 0.184130311f},
-std::array<float,2>{0.446965605f, 0.863471091f},
-std::array<float,2>{0.759329021f, 0.980142891f},
-std::array<float,2>{0.319653898f, 0.0280138589f},
-std::array<float,2>{0.515814364f, 0.251287431f},
-std::array<float,2>{0.186520547f, 0.581356466f},
-std::array<float,2>{0.899801791f, 0.519999146f},
-std::array<float,2>{0.393999547f, 0.322216898f},
-std::array<float,2>{0.722756803f, 0.124925323f},
-std::array<float,2>{0.054550074f, 0.878104866f},
-std::array<float,2>{0.563530087f, 0.794376671f},
-std::array<float,2>{0.190223798f, 0.191369519f},
-std::array<float,2>{0.860649765f, 0.432688802f},
-std::array<float,2>{0.261021376f, 0.658772171f},
-std::array<float,2>{0.620216727f, 0.687087953f},
-std::array<float,2>{0.242165923f, 0.414648354f},
-std::array<float,2>{0.843134761f, 0.21618785f},
-std::array<float,2>{0.296654552f, 0.802835822f},
-std::array<float,2>{0.907255888f, 0.891455948f},
-std::array<float,2>{0.429429173f, 0.0957092121f},
-std::array<float,2>{0.707564294f, 0.32889837f},
-std::array<float,2>{0.0130461063f, 0.511838913f},
-std::array<float,2>{0.785295427f, 0.565318525f},
-std::array<float,2>{0.373588353f, 0.269688666f},
-std::array<float,2>{0.547709286f, 0.0138090681f},
-std::array<float,2>{0.156136319f, 0.993067443f},
-std::array<float,2>{0.678157985f, 0.84778136f},
-std::array<float,2>{0.0959867537f, 0.162724227f},
-std::array<float,2>{0.947404742f, 0.471083283f},
-std::array<float,2>{0.474689364f, 0.726932168f},
-std::array<float,2>{0.749157667f, 0.540025592f},
-std::array<float,2>{0.0346081667f, 0.351867825f},
-std::array<float,2>{0.878611922f, 0.0691294372f},
-std::array<float,2>{0.380949557f, 0.928786635f},
-std::array<float,2>{0.848865926f, 0.766185224f},
-std::array<float,2>{0.271050036f, 0.245443419f},
-std::array<float,2>{0.580822825f, 0.400985301f},
-std::array<float,2>{0.210050493f, 0.634875655f},
-std::array<float,2>{0.992874265f, 0.699166298f},
-std::array<float,2>{0.468395114f, 0.456893802f},
-std::array<float,2>{0.642544568f, 0.126899466f},
-std::array<float,2>{0.0724948123f, 0.824030578f},
-std::array<float,2>{0.508533716f, 0.958760679f},
-std::array<float,2>{0.167728812f, 0.0346049145f},
-std::array<float,2>{0.768151104f, 0.310715497f},
-std::array<float,2>{0.332907021f, 0.604227781f},
-std::array<float,2>{0.598032832f, 0.57089448f},
-std::array<float,2>{0.229745865f, 0.274481952f},
-std::array<float,2>{0.818725169f, 0.00202687713f},
-std::array<float,2>{0.302732646f, 0.98712182f},
-std::array<float,2>{0.929964483f, 0.854664743f},
-std::array<float,2>{0.410942137f, 0.167039856f},
-std::array<float,2>{0.69626987f, 0.48254472f},
-std::array<float,2>{0.0288078953f, 0.722696841f},
-std::array<float,2>{0.8042593f, 0.672595561f},
-std::array<float,2>{0.35483703f, 0.412411809f},
-std::array<float,2>{0.545633137f, 0.210625783f},
-std::array<float,2>{0.138168871f, 0.809332192f},
-std::array<float,2>{0.663187385f, 0.902083158f},
-std::array<float,2>{0.117512882f, 0.105390713f},
-std::array<float,2>{0.96209687f, 0.342364728f},
-std::array<float,2>{0.494036645f, 0.506424189f},
-std::array<float,2>{0.721930742f, 0.690664232f},
-std::array<float,2>{0.0496270731f, 0.461375773f},
-std::array<float,2>{0.902790248f, 0.135594279f},
-std::array<float,2>{0.398210704f, 0.817725956f},
-std::array<float,2>{0.865939319f, 0.964782f},
-std::array<float,2>{0.263057977f, 0.0420306101f},
-std::array<float,2>{0.569785058f, 0.303728938f},
-std::array<float,2>{0.192306504f, 0.594548345f},
-std::array<float,2>{0.969186485f, 0.538263261f},
-std::array<float,2>{0.451169312f, 0.350247353f},
-std::array<float,2>{0.635750234f, 0.0760156289f},
-std::array<float,2>{0.0900463089f, 0.933547258f},
-std::array<float,2>{0.522733152f, 0.7797122f},
-std::array<float,2>{0.183534786f, 0.24059777f},
-std::array<float,2>{0.764180005f, 0.397687793f},
-std::array<float,2>{0.315701157f, 0.626866937f},
-std::array<float,2>{0.554565489f, 0.647940397f},
-std::array<float,2>{0.149201825f, 0.383090973f},
-std::array<float,2>{0.78440249f, 0.230969414f},
-std::array<float,2>{0.368834019f, 0.751236022f},
-std::array<float,2>{0.95048511f, 0.921818435f},
-std::array<float,2>{0.469255775f, 0.0866318569f},
-std::array<float,2>{0.674970508f, 0.370426208f},
-std::array<float,2>{0.101136185f, 0.562447667f},
-std::array<float,2>{0.836189628f, 0.618927836f},
-std::array<float,2>{0.292680502f, 0.293486983f},
-std::array<float,2>{0.624293566f, 0.052261997f},
-std::array<float,2>{0.237624735f, 0.950854123f},
-std::array<float,2>{0.703150928f, 0.833674192f},
-std::array<float,2>{0.0108949309f, 0.148510471f},
-std::array<float,2>{0.911540449f, 0.446914196f},
-std::array<float,2>{0.424805939f, 0.705393851f},
-std::array<float,2>{0.648063362f, 0.527597845f},
-std::array<float,2>{0.0751745254f, 0.313249141f},
-std::array<float,2>{0.999922633f, 0.116865613f},
-std::array<float,2>{0.463795543f, 0.890299737f},
-std::array<float,2>{0.771250784f, 0.783408642f},
-std::array<float,2>{0.331942439f, 0.2021299f},
-std::array<float,2>{0.513925612f, 0.4271698f},
-std::array<float,2>{0.169480652f, 0.665138543f},
-std::array<float,2>{0.879149199f, 0.746960938f},
-std::array<float,2>{0.377270848f, 0.488776654f},
-std::array<float,2>{0.742798924f, 0.17714119f},
-std::array<float,2>{0.037554577f, 0.870366335f},
-std::array<float,2>{0.582953572f, 0.973213494f},
-std::array<float,2>{0.205512598f, 0.0169206783f},
-std::array<float,2>{0.846450567f, 0.26414305f},
-std::array<float,2>{0.268083483f, 0.586579919f},
-std::array<float,2>{0.502366304f, 0.552860737f},
-std::array<float,2>{0.16117619f, 0.361041337f},
-std::array<float,2>{0.774085641f, 0.0840229318f},
-std::array<float,2>{0.33776328f, 0.910906732f},
-std::array<float,2>{0.991793871f, 0.759201169f},
-std::array<float,2>{0.453362733f, 0.218857542f},
-std::array<float,2>{0.653138995f, 0.381891936f},
-std::array<float,2>{0.0702819899f, 0.65009445f},
-std::array<float,2>{0.857064784f, 0.712984145f},
-std::array<float,2>{0.277209222f, 0.445011646f},
-std::array<float,2>{0.589112878f, 0.14711225f},
-std::array<float,2>{0.211362123f, 0.842950046f},
-std::array<float,2>{0.736885011f, 0.937896013f},
-std::array<float,2>{0.04336695f, 0.0567956716f},
-std::array<float,2>{0.886676192f, 0.284305751f},
-std::array<float,2>{0.385783643f, 0.615925074f},
-std::array<float,2>{0.685669482f, 0.660728395f},
-std::array<float,2>{0.104855031f, 0.434111923f},
-std::array<float,2>{0.942016304f, 0.191857681f},
-std::array<float,2>{0.483307987f, 0.7908566f},
-std::array<float,2>{0.789683461f, 0.881532788f},
-std::array<float,2>{0.362179101f, 0.119717851f},
-std::array<float,2>{0.555652022f, 0.326078892f},
-std::array<float,2>{0.143915445f, 0.515645981f},
-std::array<float,2>{0.915815115f, 0.582366943f},
-std::array<float,2>{0.436853498f, 0.257651478f},
-std::array<float,2>{0.718077004f, 0.0235558599f},
-std::array<float,2>{0.0015682386f, 0.980496705f},
-std::array<float,2>{0.61368227f, 0.859518528f},
-std::array<float,2>{0.24881044f, 0.180962458f},
-std::array<float,2>{0.828925073f, 0.493071616f},
-std::array<float,2>{0.281489879f, 0.738127172f},
-std::array<float,2>{0.57489562f, 0.730881453f},
-std::array<float,2>{0.201108798f, 0.473643303f},
-std::array<float,2>{0.871658146f, 0.156858206f},
-std::array<float,2>{0.253500134f, 0.846055329f},
-std::array<float,2>{0.894608438f, 0.997925401f},
-std::array<float,2>{0.401002109f, 0.0111731952f},
-std::array<float,2>{0.729602218f, 0.267983228f},
-std::array<float,2>{0.0601225942f, 0.56931144f},
-std::array<float,2>{0.752514303f, 0.511389852f},
-std::array<float,2>{0.325654387f, 0.333608538f},
-std::array<float,2>{0.527514756f, 0.100751847f},
-std::array<float,2>{0.172895133f, 0.898267686f},
-std::array<float,2>{0.630418599f, 0.800105572f},
-std::array<float,2>{0.0850319117f, 0.214428917f},
-std::array<float,2>{0.982063174f, 0.420564413f},
-std::array<float,2>{0.443939596f, 0.680151582f},
-std::array<float,2>{0.693646669f, 0.606169105f},
-std::array<float,2>{0.0216535404f, 0.307248831f},
-std::array<float,2>{0.922705591f, 0.0387125947f},
-std::array<float,2>{0.421470523f, 0.95676595f},
-std::array<float,2>{0.824927568f, 0.827684879f},
-std::array<float,2>{0.3075656f, 0.132222354f},
-std::array<float,2>{0.607951462f, 0.458862841f},
-std::array<float,2>{0.225564137f, 0.701923907f},
-std::array<float,2>{0.956892252f, 0.639269114f},
-std::array<float,2>{0.488295823f, 0.405806541f},
-std::array<float,2>{0.667725384f, 0.246364236f},
-std::array<float,2>{0.110594057f, 0.770754218f},
-std::array<float,2>{0.536092877f, 0.923391759f},
-std::array<float,2>{0.128564537f, 0.0644218624f},
-std::array<float,2>{0.806056499f, 0.356569916f},
-std::array<float,2>{0.346536607f, 0.546290755f},
-std::array<float,2>{0.610813975f, 0.532437742f},
-std::array<float,2>{0.245022729f, 0.345454663f},
-std::array<float,2>{0.834345758f, 0.0714402497f},
-std::array<float,2>{0.287443727f, 0.936537743f},
-std::array<float,2>{0.918176711f, 0.773970425f},
-std::array<float,2>{0.431006789f, 0.234853402f},
-std::array<float,2>{0.711080074f, 0.394353956f},
-std::array<float,2>{0.00518209813f, 0.632600725f},
-std::array<float,2>{0.793171525f, 0.692587256f},
-std::array<float,2>{0.366383135f, 0.467868984f},
-std::array<float,2>{0.560790539f, 0.13984926f},
-std::array<float,2>{0.14636673f, 0.81264931f},
-std::array<float,2>{0.679960966f, 0.968726337f},
-std::array<float,2>{0.108704083f, 0.0452807173f},
-std::array<float,2>{0.939899802f, 0.297947913f},
-std::array<float,2>{0.479533702f, 0.601010978f},
-std::array<float,2>{0.741907418f, 0.678068459f},
-std::array<float,2>{0.0425727889f, 0.407920301f},
-std::array<float,2>{0.887648225f, 0.203317538f},
-std::array<float,2>{0.390567303f, 0.807903409f},
-std::array<float,2>{0.853608251f, 0.903449357f},
-std::array<float,2>{0.277980685f, 0.108541004f},
-std::array<float,2>{0.590029776f, 0.337524116f},
-std::array<float,2>{0.215959072f, 0.50326252f},
-std::array<float,2>{0.987168729f, 0.574816823f},
-std::array<float,2>{0.459481001f, 0.281010032f},
-std::array<float,2>{0.648710012f, 0.0053505539f},
-std::array<float,2>{0.0657752231f, 0.989092708f},
-std::array<float,2>{0.505477488f, 0.858080447f},
-std::array<float,2>{0.157211185f, 0.168907464f},
-std::array<float,2>{0.780465126f, 0.479669511f},
-std::array<float,2>{0.34154433f, 0.719428837f},
-std::array<float,2>{0.53349793f, 0.74470669f},
-std::array<float,2>{0.132046983f, 0.485413581f},
-std::array<float,2>{0.811334491f, 0.173620149f},
-std::array<float,2>{0.348847002f, 0.874259114f},
-std::array<float,2>{0.960256338f, 0.972048938f},
-std::array<float,2>{0.484852105f, 0.0219285525f},
-std::array<float,2>{0.669423223f, 0.260325491f},
-std::array<float,2>{0.115893945f, 0.591722429f},
-std::array<float,2>{0.823832273f, 0.5266397f},
-std::array<float,2>{0.311020732f, 0.317218304f},
-std::array<float,2>{0.603799284f, 0.110960402f},
-std::array<float,2>{0.221752122f, 0.885109067f},
-std::array<float,2>{0.689550161f, 0.78744024f},
-std::array<float,2>{0.0179604124f, 0.197467193f},
-std::array<float,2>{0.927132607f, 0.423928529f},
-std::array<float,2>{0.417205632f, 0.671692431f},
-std::array<float,2>{0.627199769f, 0.621863961f},
-std::array<float,2>{0.0796319619f, 0.290551543f},
-std::array<float,2>{0.979482532f, 0.0485959649f},
-std::array<float,2>{0.437931955f, 0.949035466f},
-std::array<float,2>{0.756349623f, 0.830198765f},
-std::array<float,2>{0.323262572f, 0.156237558f},
-std::array<float,2>{0.52436024f, 0.451229662f},
-std::array<float,2>{0.177817523f, 0.709608972f},
-std::array<float,2>{0.894196808f, 0.642933011f},
-std::array<float,2>{0.403632253f, 0.387719244f},
-std::array<float,2>{0.731660366f, 0.227645025f},
-std::array<float,2>{0.0554220267f, 0.757455766f},
-std::array<float,2>{0.574182808f, 0.916405261f},
-std::array<float,2>{0.197179005f, 0.0933307111f},
-std::array<float,2>{0.868440449f, 0.372964442f},
-std::array<float,2>{0.256476671f, 0.557835579f},
-std::array<float,2>{0.519275844f, 0.58003366f},
-std::array<float,2>{0.184717596f, 0.253708124f},
-std::array<float,2>{0.761553824f, 0.0295228269f},
-std::array<float,2>{0.316981554f, 0.977477372f},
-std::array<float,2>{0.973643482f, 0.865592659f},
-std::array<float,2>{0.44736439f, 0.18586719f},
-std::array<float,2>{0.636967361f, 0.49781549f},
-std::array<float,2>{0.0880600512f, 0.739054859f},
-std::array<float,2>{0.861909628f, 0.656514585f},
-std::array<float,2>{0.25937745f, 0.430703342f},
-std::array<float,2>{0.564990044f, 0.18912755f},
-std::array<float,2>{0.188394949f, 0.796815515f},
-std::array<float,2>{0.725530326f, 0.875263214f},
-std::array<float,2>{0.0525689162f, 0.121652879f},
-std::array<float,2>{0.902154326f, 0.323687196f},
-std::array<float,2>{0.392401159f, 0.521669447f},
-std::array<float,2>{0.657436788f, 0.717987478f},
-std::array<float,2>{0.122138381f, 0.438786387f},
-std::array<float,2>{0.966385782f, 0.143972486f},
-std::array<float,2>{0.496850997f, 0.838019967f},
-std::array<float,2>{0.797918916f, 0.943277061f},
-std::array<float,2>{0.356697172f, 0.0623545386f},
-std::array<float,2>{0.540088356f, 0.287210673f},
-std::array<float,2>{0.133860201f, 0.611565173f},
-std::array<float,2>{0.935524762f, 0.550056756f},
-std::array<float,2>{0.409404665f, 0.364829183f},
-std::array<float,2>{0.701256335f, 0.0818362683f},
-std::array<float,2>{0.0243044775f, 0.907123148f},
-std::array<float,2>{0.596640289f, 0.763802648f},
-std::array<float,2>{0.232577577f, 0.225924343f},
-std::array<float,2>{0.815073729f, 0.375685245f},
-std::array<float,2>{0.300392359f, 0.654625356f},
-std::array<float,2>{0.579318881f, 0.633078396f},
-std::array<float,2>{0.208915636f, 0.39976722f},
-std::array<float,2>{0.849984467f, 0.242285997f},
-std::array<float,2>{0.27300933f, 0.768743277f},
-std::array<float,2>{0.876413345f, 0.926040471f},
-std::array<float,2>{0.3791188f, 0.0667543411f},
-std::array<float,2>{0.746865988f, 0.353599936f},
-std::array<float,2>{0.0324949324f, 0.541175902f},
-std::array<float,2>{0.767412722f, 0.602030993f},
-std::array<float,2>{0.335788816f, 0.308701098f},
-std::array<float,2>{0.511250734f, 0.0318644084f},
-std::array<float,2>{0.16565457f, 0.959690154f},
-std::array<float,2>{0.643308342f, 0.820538998f},
-std::array<float,2>{0.0709644407f, 0.127825305f},
-std::array<float,2>{0.994569182f, 0.454533905f},
-std::array<float,2>{0.465505511f, 0.696761191f},
-std::array<float,2>{0.710627675f, 0.514138043f},
-std::array<float,2>{0.0146667017f, 0.330694914f},
-std::array<float,2>{0.909171581f, 0.0944943875f},
-std::array<float,2>{0.427634418f, 0.893870652f},
-std::array<float,2>{0.841188371f, 0.802415848f},
-std::array<float,2>{0.293876886f, 0.216963962f},
-std::array<float,2>{0.618133664f, 0.4171817f},
-std::array<float,2>{0.238923758f, 0.685313344f},
-std::array<float,2>{0.945911765f, 0.729030073f},
-std::array<float,2>{0.473031104f, 0.470126182f},
-std::array<float,2>{0.676537097f, 0.160874054f},
-std::array<float,2>{0.0940588787f, 0.850510478f},
-std::array<float,2>{0.549992919f, 0.996014059f},
-std::array<float,2>{0.153721228f, 0.0125009334f},
-std::array<float,2>{0.788811147f, 0.271549553f},
-std::array<float,2>{0.373024315f, 0.564072788f},
-std::array<float,2>{0.568350554f, 0.597518384f},
-std::array<float,2>{0.19520402f, 0.301809132f},
-std::array<float,2>{0.86450243f, 0.0405922048f},
-std::array<float,2>{0.265206456f, 0.96106565f},
-std::array<float,2>{0.905251622f, 0.81856817f},
-std::array<float,2>{0.39478147f, 0.13326703f},
-std::array<float,2>{0.720483363f, 0.463513106f},
-std::array<float,2>{0.0480010323f, 0.689082861f},
-std::array<float,2>{0.763191342f, 0.628659189f},
-std::array<float,2>{0.313718766f, 0.396169871f},
-std::array<float,2>{0.521181166f, 0.239071876f},
-std::array<float,2>{0.180966303f, 0.777358234f},
-std::array<float,2>{0.633321226f, 0.931130826f},
-std::array<float,2>{0.0927099362f, 0.0778192729f},
-std::array<float,2>{0.971016228f, 0.348409504f},
-std::array<float,2>{0.451743513f, 0.535710573f},
-std::array<float,2>{0.697437763f, 0.725676477f},
-std::array<float,2>{0.0304552391f, 0.480494678f},
-std::array<float,2>{0.933185995f, 0.164479807f},
-std::array<float,2>{0.413863689f, 0.852308631f},
-std::array<float,2>{0.816483796f, 0.985207558f},
-std::array<float,2>{0.303699225f, 0.000797563873f},
-std::array<float,2>{0.601184964f, 0.276686788f},
-std::array<float,2>{0.227817982f, 0.573186874f},
-std::array<float,2>{0.964397371f, 0.50461036f},
-std::array<float,2>{0.494432151f, 0.340395868f},
-std::array<float,2>{0.661212981f, 0.102309324f},
-std::array<float,2>{0.120329104f, 0.899156511f},
-std::array<float,2>{0.543650925f, 0.811828792f},
-std::array<float,2>{0.13964799f, 0.20873253f},
-std::array<float,2>{0.801396251f, 0.41203019f},
-std::array<float,2>{0.352421075f, 0.673937023f},
-std::array<float,2>{0.512755752f, 0.666417897f},
-std::array<float,2>{0.170084596f, 0.427986622f},
-std::array<float,2>{0.77162677f, 0.200594023f},
-std::array<float,2>{0.32905978f, 0.782688498f},
-std::array<float,2>{0.996161759f, 0.886896491f},
-std::array<float,2>{0.461604774f, 0.114874624f},
-std::array<float,2>{0.644605398f, 0.316182017f},
-std::array<float,2>{0.0776392967f, 0.530592024f},
-std::array<float,2>{0.844922364f, 0.588117063f},
-std::array<float,2>{0.267493725f, 0.262569517f},
-std::array<float,2>{0.584264278f, 0.0186829343f},
-std::array<float,2>{0.203399435f, 0.975247085f},
-std::array<float,2>{0.745814502f, 0.868128836f},
-std::array<float,2>{0.035932906f, 0.179412469f},
-std::array<float,2>{0.880952418f, 0.491984069f},
-std::array<float,2>{0.375998557f, 0.748548746f},
-std::array<float,2>{0.673619568f, 0.559583247f},
-std::array<float,2>{0.0980132148f, 0.367399871f},
-std::array<float,2>{0.952413499f, 0.0889669284f},
-std::array<float,2>{0.472230315f, 0.919665396f},
-std::array<float,2>{0.781923652f, 0.752893507f},
-std::array<float,2>{0.369290978f, 0.233071372f},
-std::array<float,2>{0.551372051f, 0.385877848f},
-std::array<float,2>{0.15232411f, 0.645755112f},
-std::array<float,2>{0.913097143f, 0.703491509f},
-std::array<float,2>{0.422262877f, 0.447879851f},
-std::array<float,2>{0.706945062f, 0.150650725f},
-std::array<float,2>{0.00939675048f, 0.833991289f},
-std::array<float,2>{0.621153176f, 0.95129019f},
-std::array<float,2>{0.23502475f, 0.0533188768f},
-std::array<float,2>{0.839734197f, 0.295801163f},
-std::array<float,2>{0.290219337f, 0.619731486f},
-std::array<float,2>{0.558540344f, 0.519496083f},
-std::array<float,2>{0.140723333f, 0.326309651f},
-std::array<float,2>{0.792896509f, 0.118489392f},
-std::array<float,2>{0.360545337f, 0.880648553f},
-std::array<float,2>{0.944598854f, 0.791608691f},
-std::array<float,2>{0.481690109f, 0.19521226f},
-std::array<float,2>{0.68485719f, 0.436459154f},
-std::array<float,2>{0.102326758f, 0.66361171f},
-std::array<float,2>{0.831639946f, 0.735515654f},
-std::array<float,2>{0.283328503f, 0.495223224f},
-std::array<float,2>{0.615512431f, 0.18335171f},
-std::array<float,2>{0.247417554f, 0.86166203f},
-std::array<float,2>{0.716103137f, 0.984267652f},
-std::array<float,2>{0.00241288892f, 0.0259922426f},
-std::array<float,2>{0.917719424f, 0.254738867f},
-std::array<float,2>{0.435390025f, 0.584549069f},
-std::array<float,2>{0.654803216f, 0.652084887f},
-std::array<float,2>{0.0676142871f, 0.380078822f},
-std::array<float,2>{0.988812864f, 0.220918357f},
-std::array<float,2>{0.455881387f, 0.761546254f},
-std::array<float,2>{0.777239382f, 0.91291064f},
-std::array<float,2>{0.339400023f, 0.0826941729f},
-std::array<float,2>{0.50063467f, 0.361646295f},
-std::array<float,2>{0.162765056f, 0.551908672f},
-std::array<float,2>{0.88426578f, 0.613805413f},
-std::array<float,2>{0.384603858f, 0.282438725f},
-std::array<float,2>{0.735146761f, 0.0555457659f},
-std::array<float,2>{0.0453838557f, 0.939654708f},
-std::array<float,2>{0.586250186f, 0.839903593f},
-std::array<float,2>{0.21397464f, 0.145410806f},
-std::array<float,2>{0.858608603f, 0.442662805f},
-std::array<float,2>{0.27366516f, 0.712183475f},
-std::array<float,2>{0.607145905f, 0.699363947f},
-std::array<float,2>{0.224297836f, 0.46061483f},
-std::array<float,2>{0.826807559f, 0.129140079f},
-std::array<float,2>{0.306331754f, 0.824421048f},
-std::array<float,2>{0.925644398f, 0.953581333f},
-std::array<float,2>{0.419596076f, 0.0362440385f},
-std::array<float,2>{0.692198455f, 0.305833042f},
-std::array<float,2>{0.0202100407f, 0.608547926f},
-std::array<float,2>{0.806780159f, 0.543055654f},
-std::array<float,2>{0.344120085f, 0.358853072f},
-std::array<float,2>{0.538567066f, 0.0644925088f},
-std::array<float,2>{0.126486048f, 0.924336731f},
-std::array<float,2>{0.664658248f, 0.77296555f},
-std::array<float,2>{0.111990675f, 0.249358118f},
-std::array<float,2>{0.95430243f, 0.402529895f},
-std::array<float,2>{0.491143823f, 0.636961579f},
-std::array<float,2>{0.728060484f, 0.567530572f},
-std::array<float,2>{0.0609293319f, 0.266950756f},
-std::array<float,2>{0.898214459f, 0.00805076677f},
-std::array<float,2>{0.400235742f, 0.999144614f},
-std::array<float,2>{0.873495817f, 0.84539324f},
-std::array<float,2>{0.250591546f, 0.158698797f},
-std::array<float,2>{0.576588809f, 0.475019932f},
-std::array<float,2>{0.203120455f, 0.73265624f},
-std::array<float,2>{0.982585669f, 0.682285428f},
-std::array<float,2>{0.443211019f, 0.418539584f},
-std::array<float,2>{0.630899012f, 0.211640596f},
-std::array<float,2>{0.0827059448f, 0.796909988f},
-std::array<float,2>{0.530517876f, 0.896072268f},
-std::array<float,2>{0.174472436f, 0.0981091633f},
-std::array<float,2>{0.750578761f, 0.335026652f},
-std::array<float,2>{0.327484697f, 0.509292066f},
-std::array<float,2>{0.580247879f, 0.541825712f},
-std::array<float,2>{0.210757911f, 0.354145527f},
-std::array<float,2>{0.849419296f, 0.0672818199f},
-std::array<float,2>{0.270810038f, 0.926662087f},
-std::array<float,2>{0.878121674f, 0.769380271f},
-std::array<float,2>{0.381595999f, 0.242890328f},
-std::array<float,2>{0.749917567f, 0.400378108f},
-std::array<float,2>{0.0351027027f, 0.633631945f},
-std::array<float,2>{0.768009126f, 0.697166085f},
-std::array<float,2>{0.332203627f, 0.454802573f},
-std::array<float,2>{0.50807941f, 0.127089664f},
-std::array<float,2>{0.167027667f, 0.821223378f},
-std::array<float,2>{0.641810775f, 0.959097207f},
-std::array<float,2>{0.072810404f, 0.0316378139f},
-std::array<float,2>{0.992477655f, 0.309272408f},
-std::array<float,2>{0.468091726f, 0.602304399f},
-std::array<float,2>{0.707191885f, 0.68489933f},
-std::array<float,2>{0.0135122398f, 0.417701364f},
-std::array<float,2>{0.90771836f, 0.217481345f},
-std::array<float,2>{0.428811342f, 0.802010477f},
-std::array<float,2>{0.843460798f, 0.894223332f},
-std::array<float,2>{0.296266973f, 0.0937820449f},
-std::array<float,2>{0.620834887f, 0.330502123f},
-std::array<float,2>{0.241666749f, 0.514171183f},
-std::array<float,2>{0.948044538f, 0.563871443f},
-std::array<float,2>{0.475537807f, 0.272127509f},
-std::array<float,2>{0.678445935f, 0.0118157892f},
-std::array<float,2>{0.0963206664f, 0.995521784f},
-std::array<float,2>{0.547180355f, 0.849984765f},
-std::array<float,2>{0.155322835f, 0.160604089f},
-std::array<float,2>{0.785751581f, 0.470442593f},
-std::array<float,2>{0.373489976f, 0.72863853f},
-std::array<float,2>{0.516193509f, 0.738443375f},
-std::array<float,2>{0.185928628f, 0.497233808f},
-std::array<float,2>{0.758918703f, 0.186042592f},
-std::array<float,2>{0.320284992f, 0.865951061f},
-std::array<float,2>{0.976160407f, 0.976748228f},
-std::array<float,2>{0.446768999f, 0.0300498195f},
-std::array<float,2>{0.639413238f, 0.253389716f},
-std::array<float,2>{0.0864180252f, 0.579494178f},
-std::array<float,2>{0.861085176f, 0.522067785f},
-std::array<float,2>{0.261670232f, 0.323777586f},
-std::array<float,2>{0.56435734f, 0.121274285f},
-std::array<float,2>{0.189716637f, 0.875841796f},
-std::array<float,2>{0.723212302f, 0.7961483f},
-std::array<float,2>{0.0541309603f, 0.188639477f},
-std::array<float,2>{0.900232852f, 0.431411117f},
-std::array<float,2>{0.394137561f, 0.65683341f},
-std::array<float,2>{0.658621192f, 0.612157702f},
-std::array<float,2>{0.124877878f, 0.287695408f},
-std::array<float,2>{0.96741575f, 0.0617164373f},
-std::array<float,2>{0.499731064f, 0.942562342f},
-std::array<float,2>{0.799317658f, 0.838659048f},
-std::array<float,2>{0.35857287f, 0.144099057f},
-std::array<float,2>{0.542149067f, 0.438965738f},
-std::array<float,2>{0.136254624f, 0.718482137f},
-std::array<float,2>{0.936517715f, 0.654953718f},
-std::array<float,2>{0.408017308f, 0.375373006f},
-std::array<float,2>{0.70054251f, 0.226164386f},
-std::array<float,2>{0.026196301f, 0.764520705f},
-std::array<float,2>{0.594611049f, 0.906605422f},
-std::array<float,2>{0.231668323f, 0.0813937783f},
-std::array<float,2>{0.81338644f, 0.364475489f},
-std::array<float,2>{0.298322201f, 0.550422192f},
-std::array<float,2>{0.533148408f, 0.591108322f},
-std::array<float,2>{0.129903138f, 0.259986609f},
-std::array<float,2>{0.808773935f, 0.0224233083f},
-std::array<float,2>{0.35091114f, 0.972176433f},
-std::array<float,2>{0.957833588f, 0.874933481f},
-std::array<float,2>{0.486811608f, 0.173027128f},
-std::array<float,2>{0.670814574f, 0.48607561f},
-std::array<float,2>{0.114117756f, 0.744412959f},
-std::array<float,2>{0.821461737f, 0.671076536f},
-std::array<float,2>{0.309840739f, 0.42470327f},
-std::array<float,2>{0.603172481f, 0.198179215f},
-std::array<float,2>{0.220526993f, 0.787872314f},
-std::array<float,2>{0.688585043f, 0.885624528f},
-std::array<float,2>{0.0175198019f, 0.110561617f},
-std::array<float,2>{0.928582132f, 0.316542834f},
-std::array<float,2>{0.415656239f, 0.527189136f},
-std::array<float,2>{0.626314521f, 0.709304333f},
-std::array<float,2>{0.0817633197f, 0.45190236f},
-std::array<float,2>{0.976754785f, 0.155445412f},
-std::array<float,2>{0.440656483f, 0.830879092f},
-std::array<float,2>{0.755350351f, 0.948662162f},
-std::array<float,2>{0.321992189f, 0.0480912924f},
-std::array<float,2>{0.525560379f, 0.290504187f},
-std::array<float,2>{0.176137134f, 0.621234953f},
-std::array<float,2>{0.892063975f, 0.558286428f},
-std::array<float,2>{0.405826032f, 0.372106612f},
-std::array<float,2>{0.733309805f, 0.0930663049f},
-std::array<float,2>{0.0572233573f, 0.916514337f},
-std::array<float,2>{0.571403205f, 0.757178783f},
-std::array<float,2>{0.197317883f, 0.22819984f},
-std::array<float,2>{0.869814754f, 0.388224214f},
-std::array<float,2>{0.253953367f, 0.643450677f},
-std::array<float,2>{0.611574948f, 0.631876767f},
-std::array<float,2>{0.242256925f, 0.393651694f},
-std::array<float,2>{0.833876789f, 0.235290408f},
-std::array<float,2>{0.285720259f, 0.773714066f},
-std::array<float,2>{0.921867847f, 0.937473655f},
-std::array<float,2>{0.432538927f, 0.0719766617f},
-std::array<float,2>{0.713493586f, 0.344969243f},
-std::array<float,2>{0.00732103502f, 0.532714903f},
-std::array<float,2>{0.796724379f, 0.601534963f},
-std::array<float,2>{0.363981873f, 0.298802942f},
-std::array<float,2>{0.55944258f, 0.0458946638f},
-std::array<float,2>{0.147819489f, 0.96807301f},
-std::array<float,2>{0.681790054f, 0.813195407f},
-std::array<float,2>{0.106858656f, 0.140420243f},
-std::array<float,2>{0.937717199f, 0.468549013f},
-std::array<float,2>{0.477307022f, 0.692901552f},
-std::array<float,2>{0.739644408f, 0.50348264f},
-std::array<float,2>{0.0392986126f, 0.336935878f},
-std::array<float,2>{0.88987416f, 0.108953945f},
-std::array<float,2>{0.387600124f, 0.904122055f},
-std::array<float,2>{0.852830708f, 0.808507502f},
-std::array<float,2>{0.279740304f, 0.203693449f},
-std::array<float,2>{0.592633009f, 0.407271594f},
-std::array<float,2>{0.216992736f, 0.678504109f},
-std::array<float,2>{0.985353529f, 0.719043195f},
-std::array<float,2>{0.458304197f, 0.479985356f},
-std::array<float,2>{0.651618302f, 0.168457001f},
-std::array<float,2>{0.0627048984f, 0.85784322f},
-std::array<float,2>{0.505915821f, 0.988749146f},
-std::array<float,2>{0.159198821f, 0.00545309158f},
-std::array<float,2>{0.779068828f, 0.280334771f},
-std::array<float,2>{0.342045605f, 0.574706256f},
-std::array<float,2>{0.607847393f, 0.609345615f},
-std::array<float,2>{0.224891752f, 0.306627542f},
-std::array<float,2>{0.824229717f, 0.0370031148f},
-std::array<float,2>{0.306775659f, 0.953838885f},
-std::array<float,2>{0.921899557f, 0.825021923f},
-std::array<float,2>{0.421063453f, 0.129496887f},
-std::array<float,2>{0.69415009f, 0.460395008f},
-std::array<float,2>{0.0221587289f, 0.699990273f},
-std::array<float,2>{0.806608677f, 0.63760525f},
-std::array<float,2>{0.345766634f, 0.403132558f},
-std::array<float,2>{0.535393238f, 0.249576122f},
-std::array<float,2>{0.128041118f, 0.772852004f},
-std::array<float,2>{0.667313874f, 0.923889756f},
-std::array<float,2>{0.110865854f, 0.0652110428f},
-std::array<float,2>{0.956057966f, 0.359002173f},
-std::array<float,2>{0.48892051f, 0.54382658f},
-std::array<float,2>{0.730147779f, 0.732998431f},
-std::array<float,2>{0.0598561168f, 0.475304157f},
-std::array<float,2>{0.895040214f, 0.158545062f},
-std::array<float,2>{0.400805861f, 0.845082462f},
-std::array<float,2>{0.871183038f, 0.999648929f},
-std::array<float,2>{0.253395796f, 0.00835071132f},
-std::array<float,2>{0.574329972f, 0.267284334f},
-std::array<float,2>{0.200308055f, 0.568004191f},
-std::array<float,2>{0.981503129f, 0.509233236f},
-std::array<float,2>{0.443649471f, 0.335760891f},
-std::array<float,2>{0.629976213f, 0.0982294828f},
-std::array<float,2>{0.085615024f, 0.895712793f},
-std::array<float,2>{0.527957141f, 0.797783971f},
-std::array<float,2>{0.17352432f, 0.211327404f},
-std::array<float,2>{0.752168f, 0.418338269f},
-std::array<float,2>{0.326014519f, 0.681648612f},
-std::array<float,2>{0.55483526f, 0.663424373f},
-std::array<float,2>{0.14440912f, 0.435695857f},
-std::array<float,2>{0.789232492f, 0.194466114f},
-std::array<float,2>{0.361736894f, 0.791480839f},
-std::array<float,2>{0.941742361f, 0.88001132f},
-std::array<float,2>{0.482777268f, 0.118657954f},
-std::array<float,2>{0.686437607f, 0.326903641f},
-std::array<float,2>{0.105193079f, 0.51874131f},
-std::array<float,2>{0.828202426f, 0.584260762f},
-std::array<float,2>{0.281886697f, 0.253929973f},
-std::array<float,2>{0.614110589f, 0.0258481894f},
-std::array<float,2>{0.248476878f, 0.983651519f},
-std::array<float,2>{0.718397677f, 0.862072468f},
-std::array<float,2>{0.00109540427f, 0.182886064f},
-std::array<float,2>{0.915515542f, 0.495925844f},
-std::array<float,2>{0.437038928f, 0.73618263f},
-std::array<float,2>{0.652642965f, 0.552292287f},
-std::array<float,2>{0.06961523f, 0.36222896f},
-std::array<float,2>{0.991506696f, 0.0825160816f},
-std::array<float,2>{0.453831047f, 0.91237247f},
-std::array<float,2>{0.773783982f, 0.760845125f},
-std::array<float,2>{0.337316453f, 0.221357346f},
-std::array<float,2>{0.502591074f, 0.380448669f},
-std::array<float,2>{0.162001058f, 0.651807308f},
-std::array<float,2>{0.886122406f, 0.712531328f},
-std::array<float,2>{0.38644439f, 0.443289876f},
-std::array<float,2>{0.736531198f, 0.144635811f},
-std::array<float,2>{0.0436229669f, 0.840342581f},
-std::array<float,2>{0.589689076f, 0.940258384f},
-std::array<float,2>{0.211626023f, 0.054880999f},
-std::array<float,2>{0.856790721f, 0.283034146f},
-std::array<float,2>{0.276760846f, 0.613344789f},
-std::array<float,2>{0.514399469f, 0.531095088f},
-std::array<float,2>{0.169345975f, 0.315535605f},
-std::array<float,2>{0.770988286f, 0.11449004f},
-std::array<float,2>{0.331073552f, 0.887221634f},
-std::array<float,2>{0.999498606f, 0.782764137f},
-std::array<float,2>{0.463241458f, 0.201061785f},
-std::array<float,2>{0.647786736f, 0.428643107f},
-std::array<float,2>{0.0746088475f, 0.666654646f},
-std::array<float,2>{0.846090853f, 0.748138189f},
-std::array<float,2>{0.267692149f, 0.491477698f},
-std::array<float,2>{0.582162321f, 0.179122552f},
-std::array<float,2>{0.205851093f, 0.867203772f},
-std::array<float,2>{0.742398441f, 0.974639416f},
-std::array<float,2>{0.0379928835f, 0.0192209948f},
-std::array<float,2>{0.879520714f, 0.262159735f},
-std::array<float,2>{0.37768957f, 0.58885324f},
-std::array<float,2>{0.675355911f, 0.64616859f},
-std::array<float,2>{0.100974821f, 0.386669725f},
-std::array<float,2>{0.950885534f, 0.23288919f},
-std::array<float,2>{0.468808085f, 0.752262771f},
-std::array<float,2>{0.784901857f, 0.919372559f},
-std::array<float,2>{0.3682414f, 0.0894309357f},
-std::array<float,2>{0.553877652f, 0.367783695f},
-std::array<float,2>{0.148659781f, 0.560364604f},
-std::array<float,2>{0.911949337f, 0.619171619f},
-std::array<float,2>{0.425339222f, 0.294924319f},
-std::array<float,2>{0.70409137f, 0.0530288406f},
-std::array<float,2>{0.0114738997f, 0.95184356f},
-std::array<float,2>{0.624654114f, 0.83461076f},
-std::array<float,2>{0.238060772f, 0.151281133f},
-std::array<float,2>{0.836450994f, 0.447614193f},
-std::array<float,2>{0.292124122f, 0.704026878f},
-std::array<float,2>{0.570157588f, 0.688691735f},
-std::array<float,2>{0.191536278f, 0.463169992f},
-std::array<float,2>{0.865503252f, 0.13374579f},
-std::array<float,2>{0.263311356f, 0.819200277f},
-std::array<float,2>{0.903137922f, 0.96161139f},
-std::array<float,2>{0.397729635f, 0.0400934778f},
-std::array<float,2>{0.722459853f, 0.302277505f},
-std::array<float,2>{0.0488716289f, 0.596758425f},
-std::array<float,2>{0.76415801f, 0.535569668f},
-std::array<float,2>{0.316122949f, 0.348024637f},
-std::array<float,2>{0.523136199f, 0.0774186328f},
-std::array<float,2>{0.182720944f, 0.931230843f},
-std::array<float,2>{0.636602402f, 0.777995408f},
-std::array<float,2>{0.0903338194f, 0.238617301f},
-std::array<float,2>{0.969703019f, 0.395970821f},
-std::array<float,2>{0.450381964f, 0.627997041f},
-std::array<float,2>{0.6953336f, 0.57260865f},
-std::array<float,2>{0.0291223917f, 0.27686882f},
-std::array<float,2>{0.930288672f, 0.000422578305f},
-std::array<float,2>{0.410623729f, 0.984750509f},
-std::array<float,2>{0.818960011f, 0.851779997f},
-std::array<float,2>{0.302057773f, 0.164819837f},
-std::array<float,2>{0.598452151f, 0.481108606f},
-std::array<float,2>{0.230410263f, 0.726443708f},
-std::array<float,2>{0.962618113f, 0.674352884f},
-std::array<float,2>{0.493541092f, 0.411508918f},
-std::array<float,2>{0.663923502f, 0.208119258f},
-std::array<float,2>{0.118093222f, 0.812432945f},
-std::array<float,2>{0.544952154f, 0.898716629f},
-std::array<float,2>{0.138567507f, 0.101948507f},
-std::array<float,2>{0.804119349f, 0.340250105f},
-std::array<float,2>{0.355031073f, 0.504130304f},
-std::array<float,2>{0.617231548f, 0.512498975f},
-std::array<float,2>{0.23830086f, 0.328193575f},
-std::array<float,2>{0.841452658f, 0.0966150239f},
-std::array<float,2>{0.293197542f, 0.890902698f},
-std::array<float,2>{0.908329546f, 0.803511441f},
-std::array<float,2>{0.427243203f, 0.216563031f},
-std::array<float,2>{0.710104585f, 0.414490998f},
-std::array<float,2>{0.0154970856f, 0.686802804f},
-std::array<float,2>{0.788470209f, 0.727442145f},
-std::array<float,2>{0.372407109f, 0.471398741f},
-std::array<float,2>{0.550585747f, 0.1622774f},
-std::array<float,2>{0.154001921f, 0.848333538f},
-std::array<float,2>{0.675965965f, 0.992456496f},
-std::array<float,2>{0.0944894999f, 0.0142952753f},
-std::array<float,2>{0.94534266f, 0.270373464f},
-std::array<float,2>{0.473384738f, 0.564540565f},
-std::array<float,2>{0.746131778f, 0.635734737f},
-std::array<float,2>{0.0329465792f, 0.400667965f},
-std::array<float,2>{0.876477599f, 0.245819837f},
-std::array<float,2>{0.379629195f, 0.766088665f},
-std::array<float,2>{0.850379765f, 0.92960614f},
-std::array<float,2>{0.272889435f, 0.0687550977f},
-std::array<float,2>{0.579662383f, 0.352321506f},
-std::array<float,2>{0.208268479f, 0.539442122f},
-std::array<float,2>{0.994767964f, 0.603749812f},
-std::array<float,2>{0.465209007f, 0.311346859f},
-std::array<float,2>{0.642924488f, 0.03496648f},
-std::array<float,2>{0.0703341514f, 0.958355904f},
-std::array<float,2>{0.51107496f, 0.823571026f},
-std::array<float,2>{0.165044889f, 0.125995591f},
-std::array<float,2>{0.766771317f, 0.456323624f},
-std::array<float,2>{0.335297883f, 0.698621154f},
-std::array<float,2>{0.540532231f, 0.716351926f},
-std::array<float,2>{0.134398982f, 0.440949202f},
-std::array<float,2>{0.798610449f, 0.14100638f},
-std::array<float,2>{0.357388169f, 0.837121785f},
-std::array<float,2>{0.966227293f, 0.943666995f},
-std::array<float,2>{0.496203542f, 0.0596545599f},
-std::array<float,2>{0.658117235f, 0.286493599f},
-std::array<float,2>{0.122696012f, 0.610937715f},
-std::array<float,2>{0.814784169f, 0.548004866f},
-std::array<float,2>{0.300251991f, 0.367032468f},
-std::array<float,2>{0.596188247f, 0.0796684623f},
-std::array<float,2>{0.232942507f, 0.908593118f},
-std::array<float,2>{0.701840281f, 0.763102114f},
-std::array<float,2>{0.0234532319f, 0.224017754f},
-std::array<float,2>{0.934961975f, 0.37866953f},
-std::array<float,2>{0.409746587f, 0.652724028f},
-std::array<float,2>{0.637471437f, 0.581605852f},
-std::array<float,2>{0.0887979344f, 0.251931787f},
-std::array<float,2>{0.974217415f, 0.0275045f},
-std::array<float,2>{0.448006511f, 0.979938805f},
-std::array<float,2>{0.760896683f, 0.863806725f},
-std::array<float,2>{0.316759825f, 0.183765441f},
-std::array<float,2>{0.518885374f, 0.499079823f},
-std::array<float,2>{0.185515195f, 0.741923869f},
-std::array<float,2>{0.901746154f, 0.65835458f},
-std::array<float,2>{0.391701907f, 0.433450043f},
-std::array<float,2>{0.724716961f, 0.190455869f},
-std::array<float,2>{0.0522417687f, 0.794596314f},
-std::array<float,2>{0.56446749f, 0.878654063f},
-std::array<float,2>{0.187608123f, 0.124394856f},
-std::array<float,2>{0.861473858f, 0.321368784f},
-std::array<float,2>{0.259265542f, 0.520478904f},
-std::array<float,2>{0.523517251f, 0.623319626f},
-std::array<float,2>{0.178470835f, 0.292405188f},
-std::array<float,2>{0.756124079f, 0.0501484871f},
-std::array<float,2>{0.323747724f, 0.946549714f},
-std::array<float,2>{0.978599012f, 0.829437673f},
-std::array<float,2>{0.438324511f, 0.15254198f},
-std::array<float,2>{0.62746805f, 0.450834453f},
-std::array<float,2>{0.0792609826f, 0.708699584f},
-std::array<float,2>{0.868707299f, 0.640774667f},
-std::array<float,2>{0.256187886f, 0.388980627f},
-std::array<float,2>{0.573378086f, 0.229089409f},
-std::array<float,2>{0.196379393f, 0.754891455f},
-std::array<float,2>{0.732086062f, 0.914233327f},
-std::array<float,2>{0.0551021621f, 0.0904977322f},
-std::array<float,2>{0.893983006f, 0.374665171f},
-std::array<float,2>{0.404188633f, 0.555900037f},
-std::array<float,2>{0.669460177f, 0.743980348f},
-std::array<float,2>{0.115593411f, 0.487119675f},
-std::array<float,2>{0.960865974f, 0.175603434f},
-std::array<float,2>{0.485249132f, 0.872521043f},
-std::array<float,2>{0.810602605f, 0.97003746f},
-std::array<float,2>{0.34955883f, 0.0213496834f},
-std::array<float,2>{0.533754349f, 0.25931251f},
-std::array<float,2>{0.132446602f, 0.59329313f},
-std::array<float,2>{0.927595019f, 0.524027228f},
-std::array<float,2>{0.4179371f, 0.319672614f},
-std::array<float,2>{0.690396488f, 0.112565935f},
-std::array<float,2>{0.0181177557f, 0.884026289f},
-std::array<float,2>{0.604036748f, 0.785891652f},
-std::array<float,2>{0.222248688f, 0.195317864f},
-std::array<float,2>{0.823392928f, 0.423603892f},
-std::array<float,2>{0.311285436f, 0.669301391f},
-std::array<float,2>{0.590577602f, 0.677452564f},
-std::array<float,2>{0.216471761f, 0.409135193f},
-std::array<float,2>{0.85422641f, 0.206754059f},
-std::array<float,2>{0.277567983f, 0.805932164f},
-std::array<float,2>{0.886748791f, 0.906032741f},
-std::array<float,2>{0.389661282f, 0.10706035f},
-std::array<float,2>{0.741276801f, 0.338017762f},
-std::array<float,2>{0.0424518585f, 0.501774609f},
-std::array<float,2>{0.781113088f, 0.576322973f},
-std::array<float,2>{0.341140419f, 0.27858305f},
-std::array<float,2>{0.504959702f, 0.00687645841f},
-std::array<float,2>{0.156554803f, 0.99080652f},
-std::array<float,2>{0.649036109f, 0.85549283f},
-std::array<float,2>{0.0660940409f, 0.170773894f},
-std::array<float,2>{0.986546934f, 0.476901859f},
-std::array<float,2>{0.458990812f, 0.722265005f},
-std::array<float,2>{0.711717188f, 0.533708692f},
-std::array<float,2>{0.00561500015f, 0.346850455f},
-std::array<float,2>{0.918765604f, 0.0728197321f},
-std::array<float,2>{0.431514502f, 0.934161246f},
-std::array<float,2>{0.834641576f, 0.775669098f},
-std::array<float,2>{0.287723333f, 0.237079486f},
-std::array<float,2>{0.611238122f, 0.391733706f},
-std::array<float,2>{0.244260103f, 0.630603015f},
-std::array<float,2>{0.940098941f, 0.693780065f},
-std::array<float,2>{0.48041898f, 0.465687126f},
-std::array<float,2>{0.680574059f, 0.137491971f},
-std::array<float,2>{0.108934455f, 0.81606698f},
-std::array<float,2>{0.561236143f, 0.965923011f},
-std::array<float,2>{0.145690069f, 0.0442212634f},
-std::array<float,2>{0.793617129f, 0.29974851f},
-std::array<float,2>{0.367100537f, 0.598067939f},
-std::array<float,2>{0.576826632f, 0.568584383f},
-std::array<float,2>{0.202620953f, 0.268238306f},
-std::array<float,2>{0.873839676f, 0.0113714477f},
-std::array<float,2>{0.250176966f, 0.997080803f},
-std::array<float,2>{0.897941351f, 0.846549511f},
-std::array<float,2>{0.399546891f, 0.156609118f},
-std::array<float,2>{0.727997363f, 0.474129736f},
-std::array<float,2>{0.0612074174f, 0.731150627f},
-std::array<float,2>{0.750449538f, 0.680545628f},
-std::array<float,2>{0.327871978f, 0.420031726f},
-std::array<float,2>{0.530891299f, 0.214273825f},
-std::array<float,2>{0.174060419f, 0.800471723f},
-std::array<float,2>{0.631497681f, 0.897928178f},
-std::array<float,2>{0.0820951834f, 0.101408601f},
-std::array<float,2>{0.983272791f, 0.333208323f},
-std::array<float,2>{0.442431301f, 0.510985732f},
-std::array<float,2>{0.691746593f, 0.701438725f},
-std::array<float,2>{0.0198176969f, 0.458250344f},
-std::array<float,2>{0.925064981f, 0.132708564f},
-std::array<float,2>{0.419174045f, 0.827462435f},
-std::array<float,2>{0.826578319f, 0.956447184f},
-std::array<float,2>{0.306138694f, 0.0384749658f},
-std::array<float,2>{0.606770754f, 0.306761265f},
-std::array<float,2>{0.223894551f, 0.605540216f},
-std::array<float,2>{0.954795718f, 0.546720445f},
-std::array<float,2>{0.490404844f, 0.357135653f},
-std::array<float,2>{0.664528906f, 0.0635389164f},
-std::array<float,2>{0.111411512f, 0.923304558f},
-std::array<float,2>{0.538604975f, 0.771237493f},
-std::array<float,2>{0.126247168f, 0.246610045f},
-std::array<float,2>{0.807326555f, 0.405514687f},
-std::array<float,2>{0.344240069f, 0.639048696f},
-std::array<float,2>{0.50042659f, 0.649847448f},
-std::array<float,2>{0.162582263f, 0.382715017f},
-std::array<float,2>{0.776813388f, 0.219675392f},
-std::array<float,2>{0.339270324f, 0.759747684f},
-std::array<float,2>{0.98842597f, 0.910264552f},
-std::array<float,2>{0.455139458f, 0.0848120376f},
-std::array<float,2>{0.654383719f, 0.3603836f},
-std::array<float,2>{0.0680311918f, 0.553280056f},
-std::array<float,2>{0.859207094f, 0.61571908f},
-std::array<float,2>{0.274024844f, 0.284669399f},
-std::array<float,2>{0.586492777f, 0.0572204962f},
-std::array<float,2>{0.214722186f, 0.938342273f},
-std::array<float,2>{0.734452307f, 0.843365788f},
-std::array<float,2>{0.0458438434f, 0.146534413f},
-std::array<float,2>{0.884411156f, 0.444509417f},
-std::array<float,2>{0.383898556f, 0.713745177f},
-std::array<float,2>{0.685426474f, 0.516521335f},
-std::array<float,2>{0.102039993f, 0.325554788f},
-std::array<float,2>{0.944973648f, 0.119550101f},
-std::array<float,2>{0.482089698f, 0.881032288f},
-std::array<float,2>{0.792115927f, 0.790253103f},
-std::array<float,2>{0.360937536f, 0.192104578f},
-std::array<float,2>{0.557794869f, 0.433819562f},
-std::array<float,2>{0.141129225f, 0.660351753f},
-std::array<float,2>{0.917032599f, 0.737696469f},
-std::array<float,2>{0.43469581f, 0.492370665f},
-std::array<float,2>{0.716561258f, 0.181349054f},
-std::array<float,2>{0.00245530996f, 0.860297859f},
-std::array<float,2>{0.615885735f, 0.981395602f},
-std::array<float,2>{0.247999698f, 0.0239488091f},
-std::array<float,2>{0.831140339f, 0.25696528f},
-std::array<float,2>{0.283796698f, 0.582679987f},
-std::array<float,2>{0.550814152f, 0.561912477f},
-std::array<float,2>{0.151526511f, 0.370770216f},
-std::array<float,2>{0.781722903f, 0.0861150548f},
-std::array<float,2>{0.370044887f, 0.921179652f},
-std::array<float,2>{0.952803731f, 0.75167352f},
-std::array<float,2>{0.471998513f, 0.230927914f},
-std::array<float,2>{0.672994018f, 0.383400053f},
-std::array<float,2>{0.0985197797f, 0.647967398f},
-std::array<float,2>{0.838926256f, 0.705759585f},
-std::array<float,2>{0.290664881f, 0.446761221f},
-std::array<float,2>{0.621986449f, 0.148965925f},
-std::array<float,2>{0.234472394f, 0.833328903f},
-std::array<float,2>{0.706367254f, 0.950682878f},
-std::array<float,2>{0.00904469844f, 0.0522394255f},
-std::array<float,2>{0.913652778f, 0.29305625f},
-std::array<float,2>{0.422430933f, 0.618507802f},
-std::array<float,2>{0.645366728f, 0.665931165f},
-std::array<float,2>{0.07745184f, 0.427606612f},
-std::array<float,2>{0.996681452f, 0.201365992f},
-std::array<float,2>{0.461318612f, 0.783705115f},
-std::array<float,2>{0.772084415f, 0.890111148f},
-std::array<float,2>{0.328238189f, 0.116604418f},
-std::array<float,2>{0.513599455f, 0.312881678f},
-std::array<float,2>{0.170782149f, 0.528245091f},
-std::array<float,2>{0.881652594f, 0.586297989f},
-std::array<float,2>{0.376570106f, 0.264410734f},
-std::array<float,2>{0.745145679f, 0.0173568502f},
-std::array<float,2>{0.0355701037f, 0.972934842f},
-std::array<float,2>{0.584888577f, 0.871049047f},
-std::array<float,2>{0.203852966f, 0.177405193f},
-std::array<float,2>{0.845304787f, 0.488347858f},
-std::array<float,2>{0.267031789f, 0.746136069f},
-std::array<float,2>{0.600790799f, 0.723580301f},
-std::array<float,2>{0.228286728f, 0.483177394f},
-std::array<float,2>{0.817125261f, 0.167749375f},
-std::array<float,2>{0.303080589f, 0.855229795f},
-std::array<float,2>{0.933062971f, 0.986650586f},
-std::array<float,2>{0.413434923f, 0.00278178463f},
-std::array<float,2>{0.698040247f, 0.275274485f},
-std::array<float,2>{0.0310502835f, 0.570417047f},
-std::array<float,2>{0.801215172f, 0.505890846f},
-std::array<float,2>{0.351715654f, 0.341997802f},
-std::array<float,2>{0.543066025f, 0.104551584f},
-std::array<float,2>{0.138954177f, 0.901516199f},
-std::array<float,2>{0.66171962f, 0.808985114f},
-std::array<float,2>{0.120743774f, 0.210127831f},
-std::array<float,2>{0.964165509f, 0.412819684f},
-std::array<float,2>{0.494866192f, 0.671882153f},
-std::array<float,2>{0.71984005f, 0.594113529f},
-std::array<float,2>{0.0485196114f, 0.304236889f},
-std::array<float,2>{0.904674709f, 0.0425291434f},
-std::array<float,2>{0.395113349f, 0.964318395f},
-std::array<float,2>{0.864786506f, 0.818287969f},
-std::array<float,2>{0.264812589f, 0.13494575f},
-std::array<float,2>{0.567690194f, 0.461524397f},
-std::array<float,2>{0.194608405f, 0.691178203f},
-std::array<float,2>{0.971576273f, 0.626045048f},
-std::array<float,2>{0.451618522f, 0.39835605f},
-std::array<float,2>{0.633064568f, 0.240898505f},
-std::array<float,2>{0.091965206f, 0.780244529f},
-std::array<float,2>{0.520690501f, 0.932859898f},
-std::array<float,2>{0.181154847f, 0.0754145235f},
-std::array<float,2>{0.762802541f, 0.350033402f},
-std::array<float,2>{0.314208031f, 0.538691401f},
-std::array<float,2>{0.562576473f, 0.520936668f},
-std::array<float,2>{0.191215768f, 0.320963681f},
-std::array<float,2>{0.860226214f, 0.123861976f},
-std::array<float,2>{0.260319561f, 0.877516925f},
-std::array<float,2>{0.898583829f, 0.793805778f},
-std::array<float,2>{0.392814934f, 0.190086663f},
-std::array<float,2>{0.72404778f, 0.431955993f},
-std::array<float,2>{0.0528269485f, 0.65936017f},
-std::array<float,2>{0.758323252f, 0.740341485f},
-std::array<float,2>{0.318578094f, 0.498874903f},
-std::array<float,2>{0.51700604f, 0.18476674f},
-std::array<float,2>{0.187240168f, 0.864568174f},
-std::array<float,2>{0.640420496f, 0.979156613f},
-std::array<float,2>{0.0872230381f, 0.028722221f},
-std::array<float,2>{0.975369573f, 0.2503227f},
-std::array<float,2>{0.445918977f, 0.580673337f},
-std::array<float,2>{0.699902892f, 0.653339207f},
-std::array<float,2>{0.0272398535f, 0.377254009f},
-std::array<float,2>{0.936774313f, 0.223447457f},
-std::array<float,2>{0.406525016f, 0.76211375f},
-std::array<float,2>{0.813968778f, 0.909438908f},
-std::array<float,2>{0.297491163f, 0.0785800591f},
-std::array<float,2>{0.595112622f, 0.366093278f},
-std::array<float,2>{0.230927095f, 0.54728055f},
-std::array<float,2>{0.968683839f, 0.609892845f},
-std::array<float,2>{0.498892039f, 0.286112964f},
-std::array<float,2>{0.660111427f, 0.0594740361f},
-std::array<float,2>{0.123979658f, 0.944913387f},
-std::array<float,2>{0.541142404f, 0.835971832f},
-std::array<float,2>{0.135579959f, 0.142140076f},
-std::array<float,2>{0.800269485f, 0.43965888f},
-std::array<float,2>{0.357563585f, 0.715334237f},
-std::array<float,2>{0.509545863f, 0.697718978f},
-std::array<float,2>{0.166177645f, 0.455520451f},
-std::array<float,2>{0.768970191f, 0.125695482f},
-std::array<float,2>{0.333467185f, 0.823185325f},
-std::array<float,2>{0.993703187f, 0.957458019f},
-std::array<float,2>{0.467704058f, 0.0332164913f},
-std::array<float,2>{0.641018331f, 0.312038809f},
-std::array<float,2>{0.0736499205f, 0.604573965f},
-std::array<float,2>{0.848424256f, 0.540366173f},
-std::array<float,2>{0.270196199f, 0.353235543f},
-std::array<float,2>{0.581305921f, 0.0697907284f},
-std::array<float,2>{0.209772915f, 0.928373754f},
-std::array<float,2>{0.748107076f, 0.766835272f},
-std::array<float,2>{0.0333857425f, 0.244562075f},
-std::array<float,2>{0.87698108f, 0.402308404f},
-std::array<float,2>{0.382771969f, 0.635895491f},
-std::array<float,2>{0.679228723f, 0.565454006f},
-std::array<float,2>{0.0976445451f, 0.27134037f},
-std::array<float,2>{0.948361158f, 0.0149852727f},
-std::array<float,2>{0.475679845f, 0.994130373f},
-std::array<float,2>{0.78643173f, 0.848860443f},
-std::array<float,2>{0.374862015f, 0.163271874f},
-std::array<float,2>{0.54866761f, 0.472524911f},
-std::array<float,2>{0.154572472f, 0.727893233f},
-std::array<float,2>{0.906535327f, 0.686156213f},
-std::array<float,2>{0.42859742f, 0.415045679f},
-std::array<float,2>{0.708007872f, 0.21548903f},
-std::array<float,2>{0.0118695134f, 0.803865075f},
-std::array<float,2>{0.619280934f, 0.892395675f},
-std::array<float,2>{0.240529925f, 0.0971189067f},
-std::array<float,2>{0.842302561f, 0.329990834f},
-std::array<float,2>{0.295325965f, 0.51299113f},
-std::array<float,2>{0.560452998f, 0.598870456f},
-std::array<float,2>{0.146562651f, 0.30055365f},
-std::array<float,2>{0.795744956f, 0.0435514227f},
-std::array<float,2>{0.364814281f, 0.965397358f},
-std::array<float,2>{0.938860357f, 0.815086484f},
-std::array<float,2>{0.47762686f, 0.138326764f},
-std::array<float,2>{0.683188379f, 0.466323763f},
-std::array<float,2>{0.105827548f, 0.694408953f},
-std::array<float,2>{0.832713485f, 0.629179418f},
-std::array<float,2>{0.286225349f, 0.390727043f},
-std::array<float,2>{0.612970173f, 0.238266453f},
-std::array<float,2>{0.243791163f, 0.776928365f},
-std::array<float,2>{0.714665234f, 0.935326278f},
-std::array<float,2>{0.00645728316f, 0.0736227557f},
-std::array<float,2>{0.920881271f, 0.346080929f},
-std::array<float,2>{0.433131397f, 0.534503341f},
-std::array<float,2>{0.650703013f, 0.721619904f},
-std::array<float,2>{0.0639447942f, 0.478024065f},
-std::array<float,2>{0.984423578f, 0.171180859f},
-std::array<float,2>{0.457203299f, 0.857421398f},
-std::array<float,2>{0.77773881f, 0.991623223f},
-std::array<float,2>{0.343623489f, 0.00614621257f},
-std::array<float,2>{0.507457018f, 0.278038234f},
-std::array<float,2>{0.158240423f, 0.577657521f},
-std::array<float,2>{0.889447331f, 0.500819504f},
-std::array<float,2>{0.38795945f, 0.339448005f},
-std::array<float,2>{0.739031971f, 0.105968736f},
-std::array<float,2>{0.0407076403f, 0.905143917f},
-std::array<float,2>{0.593265474f, 0.805417359f},
-std::array<float,2>{0.218422621f, 0.205602318f},
-std::array<float,2>{0.85205847f, 0.409187287f},
-std::array<float,2>{0.281056613f, 0.67627579f},
-std::array<float,2>{0.601869166f, 0.668309391f},
-std::array<float,2>{0.218890056f, 0.422518164f},
-std::array<float,2>{0.820570827f, 0.196467519f},
-std::array<float,2>{0.309428513f, 0.786454201f},
-std::array<float,2>{0.929437816f, 0.883268416f},
-std::array<float,2>{0.414518267f, 0.112187371f},
-std::array<float,2>{0.687817693f, 0.319321811f},
-std::array<float,2>{0.0158649161f, 0.525350928f},
-std::array<float,2>{0.810340166f, 0.592749f},
-std::array<float,2>{0.350148946f, 0.257820576f},
-std::array<float,2>{0.532173395f, 0.0202309638f},
-std::array<float,2>{0.129196227f, 0.968859613f},
-std::array<float,2>{0.671825528f, 0.871754766f},
-std::array<float,2>{0.114322066f, 0.174415603f},
-std::array<float,2>{0.958471298f, 0.487476557f},
-std::array<float,2>{0.48816511f, 0.742908001f},
-std::array<float,2>{0.734060585f, 0.555533946f},
-std::array<float,2>{0.0582998432f, 0.373896688f},
-std::array<float,2>{0.890842974f, 0.0912704617f},
-std::array<float,2>{0.404597998f, 0.915627599f},
-std::array<float,2>{0.8710168f, 0.754526913f},
-std::array<float,2>{0.255062789f, 0.230098292f},
-std::array<float,2>{0.57035327f, 0.39030695f},
-std::array<float,2>{0.198863536f, 0.641662657f},
-std::array<float,2>{0.97790283f, 0.707850456f},
-std::array<float,2>{0.439670116f, 0.449711025f},
-std::array<float,2>{0.625393987f, 0.153576612f},
-std::array<float,2>{0.0808283463f, 0.82838434f},
-std::array<float,2>{0.527189851f, 0.945893705f},
-std::array<float,2>{0.177438006f, 0.0489581563f},
-std::array<float,2>{0.75412643f, 0.291620255f},
-std::array<float,2>{0.321232438f, 0.624153435f},
-std::array<float,2>{0.614825606f, 0.583817661f},
-std::array<float,2>{0.2494656f, 0.256311953f},
-std::array<float,2>{0.829628885f, 0.0244280621f},
-std::array<float,2>{0.282270998f, 0.981628001f},
-std::array<float,2>{0.914616704f, 0.860731244f},
-std::array<float,2>{0.436467767f, 0.1800946f},
-std::array<float,2>{0.71764797f, 0.493955046f},
-std::array<float,2>{0.000516758359f, 0.737073481f},
-std::array<float,2>{0.790881276f, 0.661322892f},
-std::array<float,2>{0.362408608f, 0.434993982f},
-std::array<float,2>{0.556590557f, 0.192762747f},
-std::array<float,2>{0.142848581f, 0.789915621f},
-std::array<float,2>{0.686823606f, 0.88225776f},
-std::array<float,2>{0.103547551f, 0.120197877f},
-std::array<float,2>{0.942683458f, 0.324388117f},
-std::array<float,2>{0.483693302f, 0.516997993f},
-std::array<float,2>{0.737766862f, 0.714813709f},
-std::array<float,2>{0.0444557779f, 0.443537802f},
-std::array<float,2>{0.8849774f, 0.1481096f},
-std::array<float,2>{0.384811282f, 0.84240216f},
-std::array<float,2>{0.856399775f, 0.938481092f},
-std::array<float,2>{0.275510848f, 0.0578359999f},
-std::array<float,2>{0.588230789f, 0.283411831f},
-std::array<float,2>{0.212771863f, 0.616976917f},
-std::array<float,2>{0.990952313f, 0.554270983f},
-std::array<float,2>{0.454741836f, 0.359727055f},
-std::array<float,2>{0.653738678f, 0.085018158f},
-std::array<float,2>{0.0684068277f, 0.911968589f},
-std::array<float,2>{0.503606617f, 0.758368909f},
-std::array<float,2>{0.160714015f, 0.220100284f},
-std::array<float,2>{0.775199294f, 0.381715894f},
-std::array<float,2>{0.336285263f, 0.648696184f},
-std::array<float,2>{0.537012875f, 0.639702916f},
-std::array<float,2>{0.127649188f, 0.404744118f},
-std::array<float,2>{0.804853559f, 0.247497097f},
-std::array<float,2>{0.347113907f, 0.770082414f},
-std::array<float,2>{0.955971062f, 0.922458231f},
-std::array<float,2>{0.489367723f, 0.0627462715f},
-std::array<float,2>{0.666061759f, 0.35574019f},
-std::array<float,2>{0.109935448f, 0.545832992f},
-std::array<float,2>{0.825648367f, 0.606662571f},
-std::array<float,2>{0.307771564f, 0.308592021f},
-std::array<float,2>{0.608921349f, 0.0374823324f},
-std::array<float,2>{0.225918308f, 0.955659032f},
-std::array<float,2>{0.694382012f, 0.826651514f},
-std::array<float,2>{0.0233457312f, 0.131266266f},
-std::array<float,2>{0.923590302f, 0.458007365f},
-std::array<float,2>{0.419971108f, 0.702700496f},
-std::array<float,2>{0.629322052f, 0.509921014f},
-std::array<float,2>{0.0840885341f, 0.332617998f},
-std::array<float,2>{0.981150866f, 0.100074098f},
-std::array<float,2>{0.445280403f, 0.897056222f},
-std::array<float,2>{0.753006101f, 0.799051583f},
-std::array<float,2>{0.325026423f, 0.213730231f},
-std::array<float,2>{0.528672874f, 0.421208143f},
-std::array<float,2>{0.172236875f, 0.680907547f},
-std::array<float,2>{0.895716906f, 0.732047915f},
-std::array<float,2>{0.401390076f, 0.473072141f},
-std::array<float,2>{0.728821039f, 0.157830611f},
-std::array<float,2>{0.0594858788f, 0.84724158f},
-std::array<float,2>{0.576150298f, 0.996641815f},
-std::array<float,2>{0.200077444f, 0.0101189511f},
-std::array<float,2>{0.872177482f, 0.268621743f},
-std::array<float,2>{0.252681911f, 0.569836736f},
-std::array<float,2>{0.521496654f, 0.537712872f},
-std::array<float,2>{0.181982741f, 0.351467222f},
-std::array<float,2>{0.764712453f, 0.074994646f},
-std::array<float,2>{0.315126181f, 0.932468235f},
-std::array<float,2>{0.969767749f, 0.780572414f},
-std::array<float,2>{0.450047582f, 0.241225556f},
-std::array<float,2>{0.634828329f, 0.396736205f},
-std::array<float,2>{0.0914620906f, 0.625805795f},
-std::array<float,2>{0.86646688f, 0.689546764f},
-std::array<float,2>{0.261938751f, 0.462687403f},
-std::array<float,2>{0.568544328f, 0.136624172f},
-std::array<float,2>{0.192500457f, 0.817097485f},
-std::array<float,2>{0.721191227f, 0.963525772f},
-std::array<float,2>{0.0504680723f, 0.0413190834f},
-std::array<float,2>{0.903333783f, 0.303266585f},
-std::array<float,2>{0.396683007f, 0.595391929f},
-std::array<float,2>{0.662936926f, 0.673169672f},
-std::array<float,2>{0.118622795f, 0.413943291f},
-std::array<float,2>{0.961767495f, 0.209570169f},
-std::array<float,2>{0.492308885f, 0.809931159f},
-std::array<float,2>{0.803658068f, 0.90106535f},
-std::array<float,2>{0.354448527f, 0.103791669f},
-std::array<float,2>{0.546819568f, 0.343497634f},
-std::array<float,2>{0.137138352f, 0.507374227f},
-std::array<float,2>{0.931194305f, 0.571643591f},
-std::array<float,2>{0.411468387f, 0.274154782f},
-std::array<float,2>{0.696335435f, 0.00350057404f},
-std::array<float,2>{0.0274039283f, 0.987874329f},
-std::array<float,2>{0.599132717f, 0.85354954f},
-std::array<float,2>{0.228630483f, 0.166232318f},
-std::array<float,2>{0.820011258f, 0.484325737f},
-std::array<float,2>{0.301036924f, 0.723948777f},
-std::array<float,2>{0.58369416f, 0.747962832f},
-std::array<float,2>{0.206085607f, 0.489903539f},
-std::array<float,2>{0.846708894f, 0.175925434f},
-std::array<float,2>{0.269070297f, 0.869382977f},
-std::array<float,2>{0.880841732f, 0.973959863f},
-std::array<float,2>{0.378127366f, 0.0163953267f},
-std::array<float,2>{0.743932307f, 0.264847159f},
-std::array<float,2>{0.0386924483f, 0.587371469f},
-std::array<float,2>{0.769736767f, 0.529047132f},
-std::array<float,2>{0.330957144f, 0.313688934f},
-std::array<float,2>{0.515156686f, 0.115871944f},
-std::array<float,2>{0.168906927f, 0.889602482f},
-std::array<float,2>{0.647273302f, 0.784596562f},
-std::array<float,2>{0.075471133f, 0.202785715f},
-std::array<float,2>{0.998973072f, 0.426261783f},
-std::array<float,2>{0.464499295f, 0.664379418f},
-std::array<float,2>{0.704993248f, 0.617759287f},
-std::array<float,2>{0.0100771608f, 0.294323176f},
-std::array<float,2>{0.910494268f, 0.0507904068f},
-std::array<float,2>{0.423900157f, 0.949981451f},
-std::array<float,2>{0.837847233f, 0.832304955f},
-std::array<float,2>{0.291526973f, 0.149714962f},
-std::array<float,2>{0.623434722f, 0.44575277f},
-std::array<float,2>{0.23643592f, 0.706223428f},
-std::array<float,2>{0.950059593f, 0.647166193f},
-std::array<float,2>{0.470036238f, 0.384683698f},
-std::array<float,2>{0.67411679f, 0.231629401f},
-std::array<float,2>{0.0997744426f, 0.75054419f},
-std::array<float,2>{0.553632319f, 0.919959605f},
-std::array<float,2>{0.150244012f, 0.0874557346f},
-std::array<float,2>{0.783335388f, 0.369228035f},
-std::array<float,2>{0.367415786f, 0.560960114f},
-std::array<float,2>{0.59740895f, 0.549369872f},
-std::array<float,2>{0.233446926f, 0.363298863f},
-std::array<float,2>{0.816271544f, 0.0810148865f},
-std::array<float,2>{0.299644947f, 0.907541573f},
-std::array<float,2>{0.93400842f, 0.765405536f},
-std::array<float,2>{0.408717245f, 0.224841118f},
-std::array<float,2>{0.702727139f, 0.376042247f},
-std::array<float,2>{0.0251664389f, 0.656169057f},
-std::array<float,2>{0.797151089f, 0.716929853f},
-std::array<float,2>{0.355493367f, 0.437643826f},
-std::array<float,2>{0.539993823f, 0.143403023f},
-std::array<float,2>{0.133773863f, 0.839266539f},
-std::array<float,2>{0.656951308f, 0.94234997f},
-std::array<float,2>{0.121809669f, 0.0607426651f},
-std::array<float,2>{0.964920759f, 0.288477242f},
-std::array<float,2>{0.497728258f, 0.612789989f},
-std::array<float,2>{0.726351023f, 0.657659173f},
-std::array<float,2>{0.0512329824f, 0.430117428f},
-std::array<float,2>{0.900891006f, 0.188304693f},
-std::array<float,2>{0.39090547f, 0.795681953f},
-std::array<float,2>{0.863267839f, 0.876768529f},
-std::array<float,2>{0.258205473f, 0.122128829f},
-std::array<float,2>{0.565556109f, 0.32304123f},
-std::array<float,2>{0.188964188f, 0.523374677f},
-std::array<float,2>{0.973503828f, 0.578340471f},
-std::array<float,2>{0.44904533f, 0.25270164f},
-std::array<float,2>{0.638651609f, 0.0308211967f},
-std::array<float,2>{0.0895470753f, 0.977571011f},
-std::array<float,2>{0.51809299f, 0.866481841f},
-std::array<float,2>{0.18370156f, 0.187397271f},
-std::array<float,2>{0.759849906f, 0.496142924f},
-std::array<float,2>{0.318107367f, 0.739340186f},
-std::array<float,2>{0.549184322f, 0.730013549f},
-std::array<float,2>{0.15278098f, 0.469328195f},
-std::array<float,2>{0.787458062f, 0.161880344f},
-std::array<float,2>{0.371486098f, 0.851003051f},
-std::array<float,2>{0.94643265f, 0.994961917f},
-std::array<float,2>{0.474097848f, 0.0130018145f},
-std::array<float,2>{0.677511156f, 0.27334401f},
-std::array<float,2>{0.095187217f, 0.562508643f},
-std::array<float,2>{0.84058845f, 0.515601993f},
-std::array<float,2>{0.294889361f, 0.331434995f},
-std::array<float,2>{0.618682146f, 0.0947715864f},
-std::array<float,2>{0.239357516f, 0.892745435f},
-std::array<float,2>{0.709336936f, 0.801015913f},
-std::array<float,2>{0.0143620763f, 0.217978358f},
-std::array<float,2>{0.909294307f, 0.41697818f},
-std::array<float,2>{0.426546484f, 0.684512258f},
-std::array<float,2>{0.644298673f, 0.603411138f},
-std::array<float,2>{0.0716107413f, 0.309951216f},
-std::array<float,2>{0.995438635f, 0.0330032669f},
-std::array<float,2>{0.466135293f, 0.960752249f},
-std::array<float,2>{0.766447127f, 0.821644008f},
-std::array<float,2>{0.33417511f, 0.128029153f},
-std::array<float,2>{0.51057601f, 0.453981638f},
-std::array<float,2>{0.164275765f, 0.69559896f},
-std::array<float,2>{0.875244081f, 0.634090245f},
-std::array<float,2>{0.380775928f, 0.398586959f},
-std::array<float,2>{0.747977376f, 0.244005889f},
-std::array<float,2>{0.0314676687f, 0.768281519f},
-std::array<float,2>{0.578437448f, 0.927166224f},
-std::array<float,2>{0.207056984f, 0.0676355585f},
-std::array<float,2>{0.850824773f, 0.354573905f},
-std::array<float,2>{0.272187114f, 0.542576194f},
-std::array<float,2>{0.504425347f, 0.575794637f},
-std::array<float,2>{0.157707989f, 0.280001044f},
-std::array<float,2>{0.779690146f, 0.00460712425f},
-std::array<float,2>{0.340401232f, 0.989758551f},
-std::array<float,2>{0.987908423f, 0.859037757f},
-std::array<float,2>{0.460922271f, 0.16925855f},
-std::array<float,2>{0.64960748f, 0.478639007f},
-std::array<float,2>{0.065146327f, 0.720664024f},
-std::array<float,2>{0.855338991f, 0.678824782f},
-std::array<float,2>{0.278554052f, 0.407211363f},
-std::array<float,2>{0.591435075f, 0.204955578f},
-std::array<float,2>{0.215346575f, 0.807015121f},
-std::array<float,2>{0.740990937f, 0.902570248f},
-std::array<float,2>{0.0418714844f, 0.107793972f},
-std::array<float,2>{0.888363242f, 0.336761624f},
-std::array<float,2>{0.389053166f, 0.502807438f},
-std::array<float,2>{0.680934429f, 0.692138433f},
-std::array<float,2>{0.107552193f, 0.467152923f},
-std::array<float,2>{0.940776527f, 0.139068395f},
-std::array<float,2>{0.478535414f, 0.813488662f},
-std::array<float,2>{0.794468224f, 0.967260003f},
-std::array<float,2>{0.365752786f, 0.0463946275f},
-std::array<float,2>{0.562363803f, 0.297502279f},
-std::array<float,2>{0.144787267f, 0.600109756f},
-std::array<float,2>{0.919130921f, 0.532201946f},
-std::array<float,2>{0.430141598f, 0.344237059f},
-std::array<float,2>{0.712169111f, 0.0704218969f},
-std::array<float,2>{0.00431620376f, 0.935786128f},
-std::array<float,2>{0.609568059f, 0.774955273f},
-std::array<float,2>{0.245896012f, 0.236102089f},
-std::array<float,2>{0.835348606f, 0.393195271f},
-std::array<float,2>{0.288101286f, 0.631829143f},
-std::array<float,2>{0.572941601f, 0.644400001f},
-std::array<float,2>{0.195989758f, 0.387076974f},
-std::array<float,2>{0.867930055f, 0.22721006f},
-std::array<float,2>{0.257484674f, 0.756517947f},
-std::array<float,2>{0.892962039f, 0.917287588f},
-std::array<float,2>{0.402726144f, 0.0922907591f},
-std::array<float,2>{0.730849743f, 0.371196687f},
-std::array<float,2>{0.0558973849f, 0.556805849f},
-std::array<float,2>{0.756872058f, 0.622261882f},
-std::array<float,2>{0.322854787f, 0.28945151f},
-std::array<float,2>{0.525118828f, 0.047172267f},
-std::array<float,2>{0.17943196f, 0.948022664f},
-std::array<float,2>{0.628881812f, 0.831429541f},
-std::array<float,2>{0.0786186531f, 0.154419407f},
-std::array<float,2>{0.980285645f, 0.452893734f},
-std::array<float,2>{0.438834131f, 0.710854173f},
-std::array<float,2>{0.690504909f, 0.525656641f},
-std::array<float,2>{0.0190151203f, 0.317792594f},
-std::array<float,2>{0.926676095f, 0.110161804f},
-std::array<float,2>{0.41657272f, 0.886091173f},
-std::array<float,2>{0.822936654f, 0.788110077f},
-std::array<float,2>{0.3124502f, 0.198784217f},
-std::array<float,2>{0.604988635f, 0.425752491f},
-std::array<float,2>{0.221014708f, 0.670651615f},
-std::array<float,2>{0.959933221f, 0.745865822f},
-std::array<float,2>{0.486035883f, 0.484818786f},
-std::array<float,2>{0.668103158f, 0.172197536f},
-std::array<float,2>{0.116649613f, 0.873938143f},
-std::array<float,2>{0.534701347f, 0.971067965f},
-std::array<float,2>{0.131593704f, 0.0232869331f},
-std::array<float,2>{0.8116799f, 0.261418521f},
-std::array<float,2>{0.348034918f, 0.590304315f},
-std::array<float,2>{0.587220073f, 0.614746094f},
-std::array<float,2>{0.213692456f, 0.281851351f},
-std::array<float,2>{0.857563615f, 0.0557683706f},
-std::array<float,2>{0.275347352f, 0.94126302f},
-std::array<float,2>{0.883344829f, 0.841362715f},
-std::array<float,2>{0.383372337f, 0.146014556f},
-std::array<float,2>{0.736148119f, 0.442282766f},
-std::array<float,2>{0.0464458913f, 0.711682379f},
-std::array<float,2>{0.775762796f, 0.650506377f},
-std::array<float,2>{0.338422984f, 0.379333884f},
-std::array<float,2>{0.501761734f, 0.222140566f},
-std::array<float,2>{0.163938567f, 0.760242224f},
-std::array<float,2>{0.656149387f, 0.913248837f},
-std::array<float,2>{0.0672390163f, 0.0837180391f},
-std::array<float,2>{0.98949784f, 0.363194436f},
-std::array<float,2>{0.45671308f, 0.55084008f},
-std::array<float,2>{0.715767682f, 0.734915793f},
-std::array<float,2>{0.00367659912f, 0.494417429f},
-std::array<float,2>{0.91688174f, 0.181790203f},
-std::array<float,2>{0.43399322f, 0.863229513f},
-std::array<float,2>{0.830526054f, 0.982640684f},
-std::array<float,2>{0.284520835f, 0.0264078472f},
-std::array<float,2>{0.616557479f, 0.255518973f},
-std::array<float,2>{0.246553749f, 0.585348904f},
-std::array<float,2>{0.94429642f, 0.518358409f},
-std::array<float,2>{0.480967253f, 0.32779479f},
-std::array<float,2>{0.684379458f, 0.117484488f},
-std::array<float,2>{0.10339652f, 0.879504263f},
-std::array<float,2>{0.55676353f, 0.792129457f},
-std::array<float,2>{0.142231956f, 0.19420585f},
-std::array<float,2>{0.791351378f, 0.437464595f},
-std::array<float,2>{0.359433919f, 0.662276864f},
-std::array<float,2>{0.529463828f, 0.683511436f},
-std::array<float,2>{0.17544651f, 0.419539064f},
-std::array<float,2>{0.751160264f, 0.212331355f},
-std::array<float,2>{0.326845735f, 0.798493803f},
-std::array<float,2>{0.984258652f, 0.895417273f},
-std::array<float,2>{0.442197919f, 0.099097386f},
-std::array<float,2>{0.632336855f, 0.334453732f},
-std::array<float,2>{0.0837104321f, 0.508253515f},
-std::array<float,2>{0.874047935f, 0.566498697f},
-std::array<float,2>{0.251287401f, 0.266234756f},
-std::array<float,2>{0.57763505f, 0.00962952711f},
-std::array<float,2>{0.201719612f, 0.998853803f},
-std::array<float,2>{0.727509618f, 0.843864381f},
-std::array<float,2>{0.0619878136f, 0.1592765f},
-std::array<float,2>{0.897241831f, 0.476527363f},
-std::array<float,2>{0.399125695f, 0.733409166f},
-std::array<float,2>{0.665459394f, 0.544466615f},
-std::array<float,2>{0.113057792f, 0.358123183f},
-std::array<float,2>{0.953597128f, 0.0657106414f},
-std::array<float,2>{0.4912453f, 0.925674736f},
-std::array<float,2>{0.808178008f, 0.772231579f},
-std::array<float,2>{0.345435679f, 0.248858035f},
-std::array<float,2>{0.537471175f, 0.40402934f},
-std::array<float,2>{0.125553742f, 0.63815701f},
-std::array<float,2>{0.923957884f, 0.70039022f},
-std::array<float,2>{0.418377787f, 0.459927291f},
-std::array<float,2>{0.692660272f, 0.130344823f},
-std::array<float,2>{0.0207932107f, 0.825624347f},
-std::array<float,2>{0.606288016f, 0.954811811f},
-std::array<float,2>{0.223529741f, 0.0353254788f},
-std::array<float,2>{0.827264726f, 0.305026948f},
-std::array<float,2>{0.305457622f, 0.607729137f},
-std::array<float,2>{0.544413745f, 0.505210638f},
-std::array<float,2>{0.140389875f, 0.341429204f},
-std::array<float,2>{0.802395105f, 0.103151359f},
-std::array<float,2>{0.352638334f, 0.900004387f},
-std::array<float,2>{0.963324845f, 0.811121643f},
-std::array<float,2>{0.496013343f, 0.2079871f},
-std::array<float,2>{0.660799563f, 0.410707235f},
-std::array<float,2>{0.119256981f, 0.675304711f},
-std::array<float,2>{0.81750083f, 0.725119293f},
-std::array<float,2>{0.304361731f, 0.482360631f},
-std::array<float,2>{0.599906325f, 0.165046051f},
-std::array<float,2>{0.226774529f, 0.853057623f},
-std::array<float,2>{0.698463798f, 0.986224473f},
-std::array<float,2>{0.0293503888f, 0.00162724266f},
-std::array<float,2>{0.932206094f, 0.276182801f},
-std::array<float,2>{0.412818223f, 0.57411474f},
-std::array<float,2>{0.633805513f, 0.627066016f},
-std::array<float,2>{0.0934013575f, 0.394836873f},
-std::array<float,2>{0.971901357f, 0.239594236f},
-std::array<float,2>{0.452925414f, 0.778873622f},
-std::array<float,2>{0.762140393f, 0.930637956f},
-std::array<float,2>{0.313187331f, 0.07690005f},
-std::array<float,2>{0.520075321f, 0.348887831f},
-std::array<float,2>{0.180522516f, 0.536359131f},
-std::array<float,2>{0.905777991f, 0.596217275f},
-std::array<float,2>{0.395658076f, 0.301692337f},
-std::array<float,2>{0.719635069f, 0.0397049561f},
-std::array<float,2>{0.0473834574f, 0.962060869f},
-std::array<float,2>{0.567262471f, 0.820035577f},
-std::array<float,2>{0.193647757f, 0.133966044f},
-std::array<float,2>{0.863406003f, 0.464066327f},
-std::array<float,2>{0.263888121f, 0.68775934f},
-std::array<float,2>{0.622078121f, 0.704630375f},
-std::array<float,2>{0.235725522f, 0.448472172f},
-std::array<float,2>{0.838145673f, 0.152316988f},
-std::array<float,2>{0.289348811f, 0.835332453f},
-std::array<float,2>{0.912337244f, 0.95257467f},
-std::array<float,2>{0.423761249f, 0.0542737544f},
-std::array<float,2>{0.705579996f, 0.296276569f},
-std::array<float,2>{0.0084661115f, 0.621076286f},
-std::array<float,2>{0.78240931f, 0.559227586f},
-std::array<float,2>{0.3707515f, 0.368484586f},
-std::array<float,2>{0.552620828f, 0.0887213647f},
-std::array<float,2>{0.150720656f, 0.918438494f},
-std::array<float,2>{0.67281878f, 0.753125668f},
-std::array<float,2>{0.0988753214f, 0.234291911f},
-std::array<float,2>{0.951444209f, 0.384800941f},
-std::array<float,2>{0.471124262f, 0.64461571f},
-std::array<float,2>{0.744736135f, 0.589829445f},
-std::array<float,2>{0.0365585685f, 0.263638049f},
-std::array<float,2>{0.882486701f, 0.0180369075f},
-std::array<float,2>{0.375180066f, 0.976335943f},
-std::array<float,2>{0.844483912f, 0.868486345f},
-std::array<float,2>{0.265854239f, 0.178391322f},
-std::array<float,2>{0.585094154f, 0.490375906f},
-std::array<float,2>{0.20489952f, 0.749867976f},
-std::array<float,2>{0.998019516f, 0.667947412f},
-std::array<float,2>{0.461996555f, 0.429578006f},
-std::array<float,2>{0.646445096f, 0.199228659f},
-std::array<float,2>{0.0765002146f, 0.782056391f},
-std::array<float,2>{0.512027681f, 0.888472438f},
-std::array<float,2>{0.171821609f, 0.113688149f},
-std::array<float,2>{0.772596717f, 0.314573735f},
-std::array<float,2>{0.329719454f, 0.529932857f}}
\ No newline at end of file
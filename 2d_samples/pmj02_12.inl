@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.730391622f, 0.0882871747f},
-std::array<float,2>{0.31755513f, 0.602192581f},
-std::array<float,2>{0.138057873f, 0.29512161f},
-std::array<float,2>{0.898284078f, 0.800196648f},
-std::array<float,2>{0.792512596f, 0.375893205f},
-std::array<float,2>{0.119963475f, 0.902382791f},
-std::array<float,2>{0.432415575f, 0.185181826f},
-std::array<float,2>{0.503773808f, 0.643278241f},
-std::array<float,2>{0.600759387f, 0.360195398f},
-std::array<float,2>{0.465945244f, 0.834171414f},
-std::array<float,2>{0.0557116605f, 0.0294438154f},
-std::array<float,2>{0.845196724f, 0.554275453f},
-std::array<float,2>{0.985230327f, 0.221511781f},
-std::array<float,2>{0.249028638f, 0.725355864f},
-std::array<float,2>{0.256745696f, 0.45476374f},
-std::array<float,2>{0.643222153f, 0.967995465f},
-std::array<float,2>{0.561098874f, 0.153013498f},
-std::array<float,2>{0.401784897f, 0.68049407f},
-std::array<float,2>{0.0712311342f, 0.42064175f},
-std::array<float,2>{0.773086548f, 0.910431683f},
-std::array<float,2>{0.920185983f, 0.27277559f},
-std::array<float,2>{0.177781805f, 0.751198411f},
-std::array<float,2>{0.359507769f, 0.12304116f},
-std::array<float,2>{0.702156425f, 0.593461931f},
-std::array<float,2>{0.666595399f, 0.485779434f},
-std::array<float,2>{0.287951201f, 0.985956311f},
-std::array<float,2>{0.203095987f, 0.188864499f},
-std::array<float,2>{0.951294124f, 0.711557388f},
-std::array<float,2>{0.825813532f, 0.0480176769f},
-std::array<float,2>{0.00190932362f, 0.512738943f},
-std::array<float,2>{0.494691342f, 0.323987573f},
-std::array<float,2>{0.575910151f, 0.869764626f},
-std::array<float,2>{0.588302374f, 0.00677826907f},
-std::array<float,2>{0.469318718f, 0.543154955f},
-std::array<float,2>{0.0271530915f, 0.354249299f},
-std::array<float,2>{0.828159213f, 0.818423092f},
-std::array<float,2>{0.956410825f, 0.438290089f},
-std::array<float,2>{0.218029469f, 0.939618289f},
-std::array<float,2>{0.30150947f, 0.243749753f},
-std::array<float,2>{0.6751827f, 0.736465812f},
-std::array<float,2>{0.708702385f, 0.298194945f},
-std::array<float,2>{0.358945698f, 0.78468442f},
-std::array<float,2>{0.160679296f, 0.0660113022f},
-std::array<float,2>{0.92394042f, 0.610970795f},
-std::array<float,2>{0.755481124f, 0.167506486f},
-std::array<float,2>{0.0812463909f, 0.637895584f},
-std::array<float,2>{0.384750277f, 0.405133247f},
-std::array<float,2>{0.537241757f, 0.880734086f},
-std::array<float,2>{0.633588791f, 0.209404036f},
-std::array<float,2>{0.266918004f, 0.701614141f},
-std::array<float,2>{0.233409941f, 0.483079344f},
-std::array<float,2>{0.983120859f, 0.982154906f},
-std::array<float,2>{0.862677097f, 0.339714646f},
-std::array<float,2>{0.0358026102f, 0.851400435f},
-std::array<float,2>{0.438807905f, 0.0450250842f},
-std::array<float,2>{0.61281091f, 0.524782538f},
-std::array<float,2>{0.518867612f, 0.435745329f},
-std::array<float,2>{0.410803765f, 0.927870393f},
-std::array<float,2>{0.0994330421f, 0.129712015f},
-std::array<float,2>{0.803362906f, 0.668422937f},
-std::array<float,2>{0.877065897f, 0.0964322165f},
-std::array<float,2>{0.155500948f, 0.566881537f},
-std::array<float,2>{0.338190943f, 0.250831425f},
-std::array<float,2>{0.744671822f, 0.767945409f},
-std::array<float,2>{0.681970596f, 0.0315976925f},
-std::array<float,2>{0.307682693f, 0.521832228f},
-std::array<float,2>{0.206954688f, 0.333092481f},
-std::array<float,2>{0.964279056f, 0.856248856f},
-std::array<float,2>{0.84238112f, 0.471319288f},
-std::array<float,2>{0.0229942929f, 0.970923066f},
-std::array<float,2>{0.482037812f, 0.217273757f},
-std::array<float,2>{0.581614017f, 0.693589747f},
-std::array<float,2>{0.540890574f, 0.263694555f},
-std::array<float,2>{0.381583393f, 0.780482352f},
-std::array<float,2>{0.0867414325f, 0.107491165f},
-std::array<float,2>{0.764079392f, 0.575798512f},
-std::array<float,2>{0.931561053f, 0.13737461f},
-std::array<float,2>{0.164460689f, 0.661073267f},
-std::array<float,2>{0.349412978f, 0.427566111f},
-std::array<float,2>{0.715886414f, 0.933294058f},
-std::array<float,2>{0.618603408f, 0.23933737f},
-std::array<float,2>{0.447591364f, 0.74701786f},
-std::array<float,2>{0.0395583622f, 0.453078926f},
-std::array<float,2>{0.872435689f, 0.950587332f},
-std::array<float,2>{0.975811362f, 0.350881487f},
-std::array<float,2>{0.220312864f, 0.827021718f},
-std::array<float,2>{0.280435175f, 0.0142448163f},
-std::array<float,2>{0.628965318f, 0.535092235f},
-std::array<float,2>{0.738083482f, 0.393167049f},
-std::array<float,2>{0.328587562f, 0.885000348f},
-std::array<float,2>{0.146040663f, 0.161892891f},
-std::array<float,2>{0.890404344f, 0.632269919f},
-std::array<float,2>{0.805899084f, 0.0711951181f},
-std::array<float,2>{0.106238015f, 0.619610548f},
-std::array<float,2>{0.41571936f, 0.310300797f},
-std::array<float,2>{0.525767863f, 0.792518139f},
-std::array<float,2>{0.511940777f, 0.115891986f},
-std::array<float,2>{0.426024616f, 0.579227746f},
-std::array<float,2>{0.110500567f, 0.278930783f},
-std::array<float,2>{0.785663843f, 0.759658277f},
-std::array<float,2>{0.905691206f, 0.411572456f},
-std::array<float,2>{0.131696418f, 0.92024219f},
-std::array<float,2>{0.320620298f, 0.144854367f},
-std::array<float,2>{0.720908463f, 0.673692346f},
-std::array<float,2>{0.656023026f, 0.317752153f},
-std::array<float,2>{0.264528871f, 0.859945118f},
-std::array<float,2>{0.239601284f, 0.0554758199f},
-std::array<float,2>{0.996623695f, 0.505934238f},
-std::array<float,2>{0.855061352f, 0.198694125f},
-std::array<float,2>{0.0472743548f, 0.708820641f},
-std::array<float,2>{0.454262435f, 0.496897042f},
-std::array<float,2>{0.605641544f, 0.995329082f},
-std::array<float,2>{0.693793416f, 0.172078386f},
-std::array<float,2>{0.374232978f, 0.652591467f},
-std::array<float,2>{0.181354001f, 0.388268918f},
-std::array<float,2>{0.907663405f, 0.896074474f},
-std::array<float,2>{0.780710757f, 0.288943976f},
-std::array<float,2>{0.0668369979f, 0.806688905f},
-std::array<float,2>{0.395777434f, 0.0807208791f},
-std::array<float,2>{0.553962708f, 0.597371697f},
-std::array<float,2>{0.563742876f, 0.468612939f},
-std::array<float,2>{0.485665202f, 0.956237018f},
-std::array<float,2>{0.0151225366f, 0.234079018f},
-std::array<float,2>{0.8168993f, 0.728408396f},
-std::array<float,2>{0.941036403f, 0.023393143f},
-std::array<float,2>{0.191865936f, 0.562283933f},
-std::array<float,2>{0.296182781f, 0.369655371f},
-std::array<float,2>{0.657351673f, 0.842620254f},
-std::array<float,2>{0.711695731f, 0.0248080846f},
-std::array<float,2>{0.346353471f, 0.548700988f},
-std::array<float,2>{0.170034289f, 0.366120696f},
-std::array<float,2>{0.934334815f, 0.829515934f},
-std::array<float,2>{0.759477675f, 0.457161039f},
-std::array<float,2>{0.0921832621f, 0.962892771f},
-std::array<float,2>{0.37745738f, 0.226270929f},
-std::array<float,2>{0.544298589f, 0.7206949f},
-std::array<float,2>{0.584371686f, 0.290360481f},
-std::array<float,2>{0.480299443f, 0.800938725f},
-std::array<float,2>{0.0158335324f, 0.0920567065f},
-std::array<float,2>{0.837373734f, 0.605954468f},
-std::array<float,2>{0.964949906f, 0.183180481f},
-std::array<float,2>{0.208430216f, 0.64814955f},
-std::array<float,2>{0.310440272f, 0.379083037f},
-std::array<float,2>{0.686624944f, 0.899422228f},
-std::array<float,2>{0.529562771f, 0.192737445f},
-std::array<float,2>{0.419340104f, 0.718343854f},
-std::array<float,2>{0.102671959f, 0.49006775f},
-std::array<float,2>{0.809964955f, 0.988581002f},
-std::array<float,2>{0.884417593f, 0.32578069f},
-std::array<float,2>{0.143965006f, 0.873634458f},
-std::array<float,2>{0.334261507f, 0.0538245067f},
-std::array<float,2>{0.741767168f, 0.508773148f},
-std::array<float,2>{0.626946986f, 0.41493094f},
-std::array<float,2>{0.276643932f, 0.90835017f},
-std::array<float,2>{0.223059416f, 0.148969039f},
-std::array<float,2>{0.972251773f, 0.686270833f},
-std::array<float,2>{0.870850325f, 0.118108913f},
-std::array<float,2>{0.0439682417f, 0.589315295f},
-std::array<float,2>{0.449986517f, 0.268289059f},
-std::array<float,2>{0.623662174f, 0.756593168f},
-std::array<float,2>{0.601760864f, 0.0696262494f},
-std::array<float,2>{0.45717898f, 0.615971506f},
-std::array<float,2>{0.051145602f, 0.304636508f},
-std::array<float,2>{0.857989609f, 0.787106037f},
-std::array<float,2>{0.993112981f, 0.399643689f},
-std::array<float,2>{0.237912968f, 0.876140535f},
-std::array<float,2>{0.260014832f, 0.16913873f},
-std::array<float,2>{0.649944246f, 0.634020925f},
-std::array<float,2>{0.726020396f, 0.355734527f},
-std::array<float,2>{0.324956387f, 0.814550042f},
-std::array<float,2>{0.127652287f, 0.00362767628f},
-std::array<float,2>{0.902153134f, 0.542618454f},
-std::array<float,2>{0.781778395f, 0.249766871f},
-std::array<float,2>{0.113446467f, 0.741181254f},
-std::array<float,2>{0.424309313f, 0.443349689f},
-std::array<float,2>{0.509868503f, 0.94333297f},
-std::array<float,2>{0.662620187f, 0.127769843f},
-std::array<float,2>{0.290654361f, 0.666748703f},
-std::array<float,2>{0.187702119f, 0.430829436f},
-std::array<float,2>{0.944698691f, 0.923840165f},
-std::array<float,2>{0.815007031f, 0.2554923f},
-std::array<float,2>{0.0110904416f, 0.770935357f},
-std::array<float,2>{0.491309345f, 0.0983304307f},
-std::array<float,2>{0.569682837f, 0.563481331f},
-std::array<float,2>{0.548835337f, 0.477687001f},
-std::array<float,2>{0.391124129f, 0.976688623f},
-std::array<float,2>{0.0652138889f, 0.205944225f},
-std::array<float,2>{0.776334226f, 0.69724524f},
-std::array<float,2>{0.912914872f, 0.0426887274f},
-std::array<float,2>{0.18577303f, 0.529747903f},
-std::array<float,2>{0.369174868f, 0.340180308f},
-std::array<float,2>{0.688007176f, 0.846243083f},
-std::array<float,2>{0.644837737f, 0.102596037f},
-std::array<float,2>{0.252293199f, 0.573894262f},
-std::array<float,2>{0.24375461f, 0.258412659f},
-std::array<float,2>{0.989833295f, 0.777273417f},
-std::array<float,2>{0.85124892f, 0.424149662f},
-std::array<float,2>{0.0611317903f, 0.936764121f},
-std::array<float,2>{0.462705195f, 0.135660857f},
-std::array<float,2>{0.594972432f, 0.657247305f},
-std::array<float,2>{0.503975987f, 0.331482083f},
-std::array<float,2>{0.434789687f, 0.852049112f},
-std::array<float,2>{0.122759514f, 0.0386299081f},
-std::array<float,2>{0.796587288f, 0.5177176f},
-std::array<float,2>{0.891716003f, 0.212404281f},
-std::array<float,2>{0.136453956f, 0.689666629f},
-std::array<float,2>{0.312976807f, 0.472884506f},
-std::array<float,2>{0.731947303f, 0.976192832f},
-std::array<float,2>{0.57192868f, 0.157052308f},
-std::array<float,2>{0.497393787f, 0.627919257f},
-std::array<float,2>{0.00686647743f, 0.397158802f},
-std::array<float,2>{0.824072182f, 0.889252841f},
-std::array<float,2>{0.947561085f, 0.305952907f},
-std::array<float,2>{0.19825545f, 0.794546068f},
-std::array<float,2>{0.282277673f, 0.0758074299f},
-std::array<float,2>{0.670342803f, 0.624158859f},
-std::array<float,2>{0.696628571f, 0.447934359f},
-std::array<float,2>{0.363620192f, 0.948192775f},
-std::array<float,2>{0.174813762f, 0.235908329f},
-std::array<float,2>{0.915323496f, 0.745156407f},
-std::array<float,2>{0.767323434f, 0.0105316043f},
-std::array<float,2>{0.0778831765f, 0.537286043f},
-std::array<float,2>{0.404741645f, 0.343814075f},
-std::array<float,2>{0.554825723f, 0.822669387f},
-std::array<float,2>{0.532794774f, 0.0605041087f},
-std::array<float,2>{0.386726111f, 0.503162086f},
-std::array<float,2>{0.0841063857f, 0.312816918f},
-std::array<float,2>{0.750031769f, 0.863569081f},
-std::array<float,2>{0.926066518f, 0.495208055f},
-std::array<float,2>{0.158594459f, 0.996271014f},
-std::array<float,2>{0.354288042f, 0.200671464f},
-std::array<float,2>{0.704178751f, 0.705051899f},
-std::array<float,2>{0.679599166f, 0.274763584f},
-std::array<float,2>{0.297748059f, 0.76521951f},
-std::array<float,2>{0.212077275f, 0.109965272f},
-std::array<float,2>{0.960720181f, 0.584255397f},
-std::array<float,2>{0.835020959f, 0.142894089f},
-std::array<float,2>{0.0281085167f, 0.676068485f},
-std::array<float,2>{0.475640833f, 0.408282638f},
-std::array<float,2>{0.591938674f, 0.916588247f},
-std::array<float,2>{0.749980986f, 0.228205293f},
-std::array<float,2>{0.340045959f, 0.73387599f},
-std::array<float,2>{0.149522141f, 0.461975187f},
-std::array<float,2>{0.882048547f, 0.959212363f},
-std::array<float,2>{0.800573707f, 0.371650428f},
-std::array<float,2>{0.0954133496f, 0.836844027f},
-std::array<float,2>{0.408891618f, 0.016327668f},
-std::array<float,2>{0.523091376f, 0.555160165f},
-std::array<float,2>{0.613502383f, 0.3866238f},
-std::array<float,2>{0.44518733f, 0.893614829f},
-std::array<float,2>{0.0319192335f, 0.176029399f},
-std::array<float,2>{0.865010858f, 0.650451779f},
-std::array<float,2>{0.97853303f, 0.0838938579f},
-std::array<float,2>{0.229412124f, 0.598907828f},
-std::array<float,2>{0.272834986f, 0.283673912f},
-std::array<float,2>{0.640463769f, 0.809491873f},
-std::array<float,2>{0.699791133f, 0.124955885f},
-std::array<float,2>{0.36179626f, 0.590354323f},
-std::array<float,2>{0.175921351f, 0.26997903f},
-std::array<float,2>{0.919180036f, 0.752044201f},
-std::array<float,2>{0.770240605f, 0.419907808f},
-std::array<float,2>{0.0742103457f, 0.913365126f},
-std::array<float,2>{0.399252743f, 0.154751882f},
-std::array<float,2>{0.559506536f, 0.681660175f},
-std::array<float,2>{0.57620132f, 0.321589798f},
-std::array<float,2>{0.492446482f, 0.868211448f},
-std::array<float,2>{0.00324806967f, 0.0493102036f},
-std::array<float,2>{0.826505184f, 0.514811814f},
-std::array<float,2>{0.950345635f, 0.190624118f},
-std::array<float,2>{0.200941473f, 0.71422559f},
-std::array<float,2>{0.285420567f, 0.487634897f},
-std::array<float,2>{0.664087296f, 0.987357974f},
-std::array<float,2>{0.501590848f, 0.1873281f},
-std::array<float,2>{0.429891855f, 0.641575933f},
-std::array<float,2>{0.118255682f, 0.37825489f},
-std::array<float,2>{0.789311588f, 0.905705273f},
-std::array<float,2>{0.895677507f, 0.293376654f},
-std::array<float,2>{0.139447436f, 0.796893418f},
-std::array<float,2>{0.320245177f, 0.0878326446f},
-std::array<float,2>{0.726798117f, 0.604889393f},
-std::array<float,2>{0.641645133f, 0.455232561f},
-std::array<float,2>{0.25481531f, 0.965993941f},
-std::array<float,2>{0.247710466f, 0.21908094f},
-std::array<float,2>{0.987785935f, 0.723597288f},
-std::array<float,2>{0.847628593f, 0.0290130042f},
-std::array<float,2>{0.056789767f, 0.551843107f},
-std::array<float,2>{0.467848033f, 0.362451255f},
-std::array<float,2>{0.598689735f, 0.832594395f},
-std::array<float,2>{0.611258507f, 0.0437801108f},
-std::array<float,2>{0.440048367f, 0.526913941f},
-std::array<float,2>{0.0381089896f, 0.336459458f},
-std::array<float,2>{0.85978806f, 0.849383295f},
-std::array<float,2>{0.981997967f, 0.481865704f},
-std::array<float,2>{0.231416538f, 0.983239353f},
-std::array<float,2>{0.269432843f, 0.207456961f},
-std::array<float,2>{0.635493577f, 0.700018287f},
-std::array<float,2>{0.743124723f, 0.252485871f},
-std::array<float,2>{0.336467236f, 0.766901493f},
-std::array<float,2>{0.152886793f, 0.0944184735f},
-std::array<float,2>{0.87502104f, 0.570241988f},
-std::array<float,2>{0.801494479f, 0.130903259f},
-std::array<float,2>{0.100237496f, 0.67037797f},
-std::array<float,2>{0.412661374f, 0.43466869f},
-std::array<float,2>{0.515653193f, 0.926142335f},
-std::array<float,2>{0.672996521f, 0.2448484f},
-std::array<float,2>{0.302894413f, 0.734511316f},
-std::array<float,2>{0.214929849f, 0.44050321f},
-std::array<float,2>{0.954214692f, 0.938903987f},
-std::array<float,2>{0.831993103f, 0.353260696f},
-std::array<float,2>{0.0245633647f, 0.817744315f},
-std::array<float,2>{0.472355515f, 0.00459744921f},
-std::array<float,2>{0.587862909f, 0.545032382f},
-std::array<float,2>{0.535918832f, 0.40352127f},
-std::array<float,2>{0.385174274f, 0.881106138f},
-std::array<float,2>{0.0798411369f, 0.165532336f},
-std::array<float,2>{0.757419169f, 0.640040398f},
-std::array<float,2>{0.922453761f, 0.0641404539f},
-std::array<float,2>{0.163257927f, 0.612419069f},
-std::array<float,2>{0.355705142f, 0.299370348f},
-std::array<float,2>{0.710339785f, 0.783087671f},
-std::array<float,2>{0.631126702f, 0.0132899191f},
-std::array<float,2>{0.278626233f, 0.53180325f},
-std::array<float,2>{0.221557423f, 0.347813845f},
-std::array<float,2>{0.974083006f, 0.825600445f},
-std::array<float,2>{0.873583555f, 0.449314296f},
-std::array<float,2>{0.042127993f, 0.953012168f},
-std::array<float,2>{0.447177202f, 0.241377264f},
-std::array<float,2>{0.619691014f, 0.748364866f},
-std::array<float,2>{0.523479462f, 0.311787993f},
-std::array<float,2>{0.416493297f, 0.789198995f},
-std::array<float,2>{0.108121634f, 0.0733526424f},
-std::array<float,2>{0.806772888f, 0.618688703f},
-std::array<float,2>{0.888599634f, 0.162965491f},
-std::array<float,2>{0.146589667f, 0.629722655f},
-std::array<float,2>{0.331448227f, 0.39182958f},
-std::array<float,2>{0.736247897f, 0.884624124f},
-std::array<float,2>{0.579370379f, 0.215804741f},
-std::array<float,2>{0.482477039f, 0.69304055f},
-std::array<float,2>{0.0210060067f, 0.470669299f},
-std::array<float,2>{0.84001714f, 0.969242454f},
-std::array<float,2>{0.961391807f, 0.33578065f},
-std::array<float,2>{0.204958156f, 0.858438432f},
-std::array<float,2>{0.304812491f, 0.0345275179f},
-std::array<float,2>{0.679778993f, 0.521386802f},
-std::array<float,2>{0.716884553f, 0.428056896f},
-std::array<float,2>{0.351361305f, 0.929884195f},
-std::array<float,2>{0.166133344f, 0.138961986f},
-std::array<float,2>{0.932176113f, 0.662444472f},
-std::array<float,2>{0.762804449f, 0.10632959f},
-std::array<float,2>{0.0881450251f, 0.576993227f},
-std::array<float,2>{0.379311651f, 0.262158096f},
-std::array<float,2>{0.542167008f, 0.77860105f},
-std::array<float,2>{0.551007748f, 0.0792624578f},
-std::array<float,2>{0.39686352f, 0.59544313f},
-std::array<float,2>{0.0686643496f, 0.286686301f},
-std::array<float,2>{0.779211223f, 0.805090487f},
-std::array<float,2>{0.908721447f, 0.389360279f},
-std::array<float,2>{0.18214187f, 0.897619307f},
-std::array<float,2>{0.371267855f, 0.175259098f},
-std::array<float,2>{0.692389607f, 0.654648483f},
-std::array<float,2>{0.65861696f, 0.368182033f},
-std::array<float,2>{0.293236077f, 0.841154814f},
-std::array<float,2>{0.193927899f, 0.0198962744f},
-std::array<float,2>{0.938350916f, 0.558757067f},
-std::array<float,2>{0.819386363f, 0.23187907f},
-std::array<float,2>{0.0133420536f, 0.729758501f},
-std::array<float,2>{0.487414837f, 0.465031356f},
-std::array<float,2>{0.564616382f, 0.954934835f},
-std::array<float,2>{0.719965637f, 0.148209587f},
-std::array<float,2>{0.32308048f, 0.6751526f},
-std::array<float,2>{0.129632771f, 0.41372332f},
-std::array<float,2>{0.903465152f, 0.919325233f},
-std::array<float,2>{0.788222373f, 0.281078488f},
-std::array<float,2>{0.112101957f, 0.760492861f},
-std::array<float,2>{0.428298593f, 0.113419801f},
-std::array<float,2>{0.515148044f, 0.581466019f},
-std::array<float,2>{0.608253419f, 0.499080926f},
-std::array<float,2>{0.456734717f, 0.992193878f},
-std::array<float,2>{0.0501712225f, 0.195716217f},
-std::array<float,2>{0.853055358f, 0.710000336f},
-std::array<float,2>{0.998708308f, 0.0585180037f},
-std::array<float,2>{0.241752923f, 0.504990518f},
-std::array<float,2>{0.263110697f, 0.318949074f},
-std::array<float,2>{0.65307337f, 0.863099754f},
-std::array<float,2>{0.738819122f, 0.0516591631f},
-std::array<float,2>{0.333284825f, 0.511211872f},
-std::array<float,2>{0.142463624f, 0.327298522f},
-std::array<float,2>{0.886239886f, 0.872843504f},
-std::array<float,2>{0.810664713f, 0.491399407f},
-std::array<float,2>{0.104188249f, 0.991090357f},
-std::array<float,2>{0.421628177f, 0.194984823f},
-std::array<float,2>{0.528081059f, 0.716412485f},
-std::array<float,2>{0.621098161f, 0.266699076f},
-std::array<float,2>{0.453107506f, 0.754217446f},
-std::array<float,2>{0.0449944064f, 0.120549873f},
-std::array<float,2>{0.867284f, 0.587221086f},
-std::array<float,2>{0.968907237f, 0.152066007f},
-std::array<float,2>{0.224869654f, 0.683967829f},
-std::array<float,2>{0.274392247f, 0.416517586f},
-std::array<float,2>{0.628836095f, 0.906546652f},
-std::array<float,2>{0.544926584f, 0.223453924f},
-std::array<float,2>{0.375685722f, 0.722409129f},
-std::array<float,2>{0.0912270248f, 0.460769892f},
-std::array<float,2>{0.760431707f, 0.961482525f},
-std::array<float,2>{0.936873794f, 0.364361823f},
-std::array<float,2>{0.168675974f, 0.830538332f},
-std::array<float,2>{0.345062077f, 0.026989555f},
-std::array<float,2>{0.713431478f, 0.550360858f},
-std::array<float,2>{0.685536981f, 0.381383598f},
-std::array<float,2>{0.31080094f, 0.901971281f},
-std::array<float,2>{0.210500181f, 0.179963365f},
-std::array<float,2>{0.967534423f, 0.644590139f},
-std::array<float,2>{0.838656664f, 0.0916629434f},
-std::array<float,2>{0.0187625308f, 0.608575344f},
-std::array<float,2>{0.477678716f, 0.292389482f},
-std::array<float,2>{0.582232475f, 0.803880394f},
-std::array<float,2>{0.567212939f, 0.100234054f},
-std::array<float,2>{0.489305526f, 0.565071225f},
-std::array<float,2>{0.0086211171f, 0.256038785f},
-std::array<float,2>{0.813704252f, 0.77281338f},
-std::array<float,2>{0.943351507f, 0.432278454f},
-std::array<float,2>{0.189613953f, 0.923155546f},
-std::array<float,2>{0.291814893f, 0.125810862f},
-std::array<float,2>{0.661736906f, 0.664708376f},
-std::array<float,2>{0.690976143f, 0.342256337f},
-std::array<float,2>{0.368445754f, 0.844883025f},
-std::array<float,2>{0.184235081f, 0.0406359695f},
-std::array<float,2>{0.910338879f, 0.527517617f},
-std::array<float,2>{0.774646044f, 0.204834566f},
-std::array<float,2>{0.0630715117f, 0.698508978f},
-std::array<float,2>{0.392758191f, 0.479668111f},
-std::array<float,2>{0.547627151f, 0.979668498f},
-std::array<float,2>{0.65208143f, 0.170274049f},
-std::array<float,2>{0.257965833f, 0.635571122f},
-std::array<float,2>{0.235396087f, 0.402308404f},
-std::array<float,2>{0.995963752f, 0.876969278f},
-std::array<float,2>{0.857406616f, 0.302701443f},
-std::array<float,2>{0.0531385317f, 0.788142562f},
-std::array<float,2>{0.460598856f, 0.0676284879f},
-std::array<float,2>{0.60398978f, 0.614814758f},
-std::array<float,2>{0.508581519f, 0.443657905f},
-std::array<float,2>{0.42349273f, 0.944737494f},
-std::array<float,2>{0.116543703f, 0.246977881f},
-std::array<float,2>{0.783673823f, 0.739486873f},
-std::array<float,2>{0.899751425f, 0.000169592735f},
-std::array<float,2>{0.125908807f, 0.539349675f},
-std::array<float,2>{0.327719927f, 0.35839355f},
-std::array<float,2>{0.723099113f, 0.813433528f},
-std::array<float,2>{0.668373048f, 0.0764539242f},
-std::array<float,2>{0.283867657f, 0.622794926f},
-std::array<float,2>{0.197260991f, 0.307270795f},
-std::array<float,2>{0.94671452f, 0.795237601f},
-std::array<float,2>{0.820436895f, 0.395879537f},
-std::array<float,2>{0.00577755366f, 0.887427092f},
-std::array<float,2>{0.49916622f, 0.159288317f},
-std::array<float,2>{0.57275492f, 0.626722395f},
-std::array<float,2>{0.557918668f, 0.347127318f},
-std::array<float,2>{0.403510749f, 0.821140945f},
-std::array<float,2>{0.0760035217f, 0.00814132113f},
-std::array<float,2>{0.768042505f, 0.536990941f},
-std::array<float,2>{0.917745948f, 0.237607092f},
-std::array<float,2>{0.173355773f, 0.743124545f},
-std::array<float,2>{0.365998775f, 0.44630459f},
-std::array<float,2>{0.698756933f, 0.94655472f},
-std::array<float,2>{0.597127557f, 0.134183481f},
-std::array<float,2>{0.463870019f, 0.658475578f},
-std::array<float,2>{0.0592072569f, 0.422141284f},
-std::array<float,2>{0.84778583f, 0.934175014f},
-std::array<float,2>{0.990992665f, 0.260661036f},
-std::array<float,2>{0.244798437f, 0.775233328f},
-std::array<float,2>{0.250710636f, 0.103961922f},
-std::array<float,2>{0.648095667f, 0.570547879f},
-std::array<float,2>{0.734150052f, 0.475670934f},
-std::array<float,2>{0.315271735f, 0.972953022f},
-std::array<float,2>{0.133308589f, 0.213618204f},
-std::array<float,2>{0.893330038f, 0.689264774f},
-std::array<float,2>{0.794062555f, 0.0364499688f},
-std::array<float,2>{0.12444409f, 0.515956223f},
-std::array<float,2>{0.436884195f, 0.328594804f},
-std::array<float,2>{0.507567167f, 0.853842556f},
-std::array<float,2>{0.52010268f, 0.0176792946f},
-std::array<float,2>{0.408017397f, 0.55766058f},
-std::array<float,2>{0.0966369212f, 0.374514967f},
-std::array<float,2>{0.797388077f, 0.838778198f},
-std::array<float,2>{0.879066527f, 0.463974983f},
-std::array<float,2>{0.151192293f, 0.958492696f},
-std::array<float,2>{0.343529224f, 0.229295284f},
-std::array<float,2>{0.746485114f, 0.731915295f},
-std::array<float,2>{0.636899471f, 0.281489074f},
-std::array<float,2>{0.271143943f, 0.811968982f},
-std::array<float,2>{0.227452978f, 0.0853773132f},
-std::array<float,2>{0.978285372f, 0.600670934f},
-std::array<float,2>{0.865851045f, 0.179552421f},
-std::array<float,2>{0.0349500217f, 0.649685144f},
-std::array<float,2>{0.441656351f, 0.382941723f},
-std::array<float,2>{0.617010653f, 0.891107976f},
-std::array<float,2>{0.705341697f, 0.202167198f},
-std::array<float,2>{0.353286415f, 0.706396759f},
-std::array<float,2>{0.156866655f, 0.493230522f},
-std::array<float,2>{0.927756369f, 0.999880672f},
-std::array<float,2>{0.752581477f, 0.315861702f},
-std::array<float,2>{0.0837063566f, 0.866948605f},
-std::array<float,2>{0.388994753f, 0.0605815798f},
-std::array<float,2>{0.534800828f, 0.501091242f},
-std::array<float,2>{0.591008604f, 0.406511068f},
-std::array<float,2>{0.473180205f, 0.914932847f},
-std::array<float,2>{0.0308730826f, 0.140916228f},
-std::array<float,2>{0.832752407f, 0.677881777f},
-std::array<float,2>{0.958510697f, 0.113104805f},
-std::array<float,2>{0.212962896f, 0.58377701f},
-std::array<float,2>{0.300347358f, 0.277033031f},
-std::array<float,2>{0.676462054f, 0.762402952f},
-std::array<float,2>{0.745756447f, 0.0956183895f},
-std::array<float,2>{0.339310855f, 0.569163859f},
-std::array<float,2>{0.154871717f, 0.253649086f},
-std::array<float,2>{0.878451049f, 0.766470969f},
-std::array<float,2>{0.804394186f, 0.434246749f},
-std::array<float,2>{0.0979411826f, 0.926797628f},
-std::array<float,2>{0.411352903f, 0.131894469f},
-std::array<float,2>{0.518271863f, 0.671213567f},
-std::array<float,2>{0.611603439f, 0.337186575f},
-std::array<float,2>{0.437926441f, 0.848460972f},
-std::array<float,2>{0.0363654867f, 0.0444864966f},
-std::array<float,2>{0.862131774f, 0.526106775f},
-std::array<float,2>{0.98360008f, 0.208319515f},
-std::array<float,2>{0.233311415f, 0.700886071f},
-std::array<float,2>{0.265746862f, 0.481226325f},
-std::array<float,2>{0.633899868f, 0.984312534f},
-std::array<float,2>{0.538370132f, 0.164860681f},
-std::array<float,2>{0.383676678f, 0.639610946f},
-std::array<float,2>{0.0809822753f, 0.403032124f},
-std::array<float,2>{0.754629195f, 0.882520795f},
-std::array<float,2>{0.924906552f, 0.300216228f},
-std::array<float,2>{0.161421791f, 0.781386554f},
-std::array<float,2>{0.357567042f, 0.0631224513f},
-std::array<float,2>{0.707529843f, 0.61161381f},
-std::array<float,2>{0.674570262f, 0.439977497f},
-std::array<float,2>{0.301982522f, 0.93818444f},
-std::array<float,2>{0.217109188f, 0.245235756f},
-std::array<float,2>{0.955894172f, 0.736020684f},
-std::array<float,2>{0.829182506f, 0.00497111026f},
-std::array<float,2>{0.0254204478f, 0.545936882f},
-std::array<float,2>{0.47060883f, 0.352140009f},
-std::array<float,2>{0.589207649f, 0.817102253f},
-std::array<float,2>{0.574442089f, 0.0500995182f},
-std::array<float,2>{0.495470017f, 0.514486253f},
-std::array<float,2>{0.000153948349f, 0.320379287f},
-std::array<float,2>{0.824682891f, 0.867815793f},
-std::array<float,2>{0.952833414f, 0.486908853f},
-std::array<float,2>{0.20124492f, 0.987225056f},
-std::array<float,2>{0.288099557f, 0.18977125f},
-std::array<float,2>{0.667643189f, 0.713297427f},
-std::array<float,2>{0.701209307f, 0.270698369f},
-std::array<float,2>{0.361233562f, 0.753820181f},
-std::array<float,2>{0.179553628f, 0.123424374f},
-std::array<float,2>{0.92167002f, 0.591407955f},
-std::array<float,2>{0.77193737f, 0.155899227f},
-std::array<float,2>{0.0713863671f, 0.682824552f},
-std::array<float,2>{0.400989205f, 0.418528378f},
-std::array<float,2>{0.562411368f, 0.912302315f},
-std::array<float,2>{0.644123852f, 0.220668986f},
-std::array<float,2>{0.257088482f, 0.724351943f},
-std::array<float,2>{0.248321936f, 0.456776798f},
-std::array<float,2>{0.985983729f, 0.965271711f},
-std::array<float,2>{0.844136417f, 0.361912757f},
-std::array<float,2>{0.0549827404f, 0.833161652f},
-std::array<float,2>{0.465782285f, 0.0282217022f},
-std::array<float,2>{0.599777997f, 0.551101089f},
-std::array<float,2>{0.502429724f, 0.37758407f},
-std::array<float,2>{0.432654291f, 0.904595077f},
-std::array<float,2>{0.120573282f, 0.186023593f},
-std::array<float,2>{0.791609943f, 0.641640842f},
-std::array<float,2>{0.897061288f, 0.0867482424f},
-std::array<float,2>{0.136881217f, 0.604361892f},
-std::array<float,2>{0.316820592f, 0.294804752f},
-std::array<float,2>{0.728569865f, 0.797926009f},
-std::array<float,2>{0.656515598f, 0.0211617798f},
-std::array<float,2>{0.295305461f, 0.56000185f},
-std::array<float,2>{0.192461103f, 0.367551744f},
-std::array<float,2>{0.940369785f, 0.840489089f},
-std::array<float,2>{0.817428946f, 0.466470391f},
-std::array<float,2>{0.0142677054f, 0.953825235f},
-std::array<float,2>{0.485207915f, 0.231285021f},
-std::array<float,2>{0.563455284f, 0.728694975f},
-std::array<float,2>{0.553321421f, 0.285612822f},
-std::array<float,2>{0.395015508f, 0.805973172f},
-std::array<float,2>{0.0683270544f, 0.0789131597f},
-std::array<float,2>{0.779508531f, 0.593999207f},
-std::array<float,2>{0.906360984f, 0.174277216f},
-std::array<float,2>{0.180257872f, 0.655671179f},
-std::array<float,2>{0.373465687f, 0.390242577f},
-std::array<float,2>{0.694341362f, 0.89713794f},
-std::array<float,2>{0.607281744f, 0.197085306f},
-std::array<float,2>{0.453144878f, 0.709236085f},
-std::array<float,2>{0.0485424027f, 0.498373926f},
-std::array<float,2>{0.854489565f, 0.993311286f},
-std::array<float,2>{0.997842133f, 0.319928735f},
-std::array<float,2>{0.238316998f, 0.86197722f},
-std::array<float,2>{0.264926165f, 0.0573322736f},
-std::array<float,2>{0.654603541f, 0.504646659f},
-std::array<float,2>{0.722103953f, 0.412192047f},
-std::array<float,2>{0.322260737f, 0.918033421f},
-std::array<float,2>{0.132624075f, 0.147019625f},
-std::array<float,2>{0.904566467f, 0.67407459f},
-std::array<float,2>{0.786870778f, 0.114901967f},
-std::array<float,2>{0.109879084f, 0.580978692f},
-std::array<float,2>{0.427521199f, 0.27986142f},
-std::array<float,2>{0.513073206f, 0.761419177f},
-std::array<float,2>{0.52674371f, 0.0725184083f},
-std::array<float,2>{0.41494894f, 0.617209911f},
-std::array<float,2>{0.107102171f, 0.310713887f},
-std::array<float,2>{0.805308938f, 0.790810406f},
-std::array<float,2>{0.888744414f, 0.391132265f},
-std::array<float,2>{0.144910052f, 0.88287729f},
-std::array<float,2>{0.329276085f, 0.163090616f},
-std::array<float,2>{0.73697269f, 0.629898965f},
-std::array<float,2>{0.630335093f, 0.349266291f},
-std::array<float,2>{0.279763758f, 0.824353993f},
-std::array<float,2>{0.219457462f, 0.0123648504f},
-std::array<float,2>{0.974985957f, 0.532288969f},
-std::array<float,2>{0.871579587f, 0.240389749f},
-std::array<float,2>{0.0406301841f, 0.749767721f},
-std::array<float,2>{0.448747426f, 0.450632989f},
-std::array<float,2>{0.617638707f, 0.951207876f},
-std::array<float,2>{0.715540469f, 0.13992542f},
-std::array<float,2>{0.348044336f, 0.663274527f},
-std::array<float,2>{0.165652737f, 0.429226846f},
-std::array<float,2>{0.93001616f, 0.930846274f},
-std::array<float,2>{0.765575588f, 0.263118416f},
-std::array<float,2>{0.0871808901f, 0.777829647f},
-std::array<float,2>{0.382087439f, 0.106904916f},
-std::array<float,2>{0.539460421f, 0.577876091f},
-std::array<float,2>{0.580827594f, 0.46915704f},
-std::array<float,2>{0.481081814f, 0.970351279f},
-std::array<float,2>{0.021555094f, 0.216113448f},
-std::array<float,2>{0.843568683f, 0.692150712f},
-std::array<float,2>{0.963359356f, 0.0333310924f},
-std::array<float,2>{0.205302894f, 0.520238876f},
-std::array<float,2>{0.306922585f, 0.334674031f},
-std::array<float,2>{0.683431566f, 0.857627213f},
-std::array<float,2>{0.688822925f, 0.0400303975f},
-std::array<float,2>{0.37078017f, 0.528452218f},
-std::array<float,2>{0.186931834f, 0.342944175f},
-std::array<float,2>{0.913365245f, 0.844098389f},
-std::array<float,2>{0.776905715f, 0.479403079f},
-std::array<float,2>{0.0661411285f, 0.979289711f},
-std::array<float,2>{0.391637594f, 0.203297421f},
-std::array<float,2>{0.550067842f, 0.698075414f},
-std::array<float,2>{0.568704188f, 0.257437468f},
-std::array<float,2>{0.491178066f, 0.771978676f},
-std::array<float,2>{0.0102442075f, 0.101211846f},
-std::array<float,2>{0.815996945f, 0.566076696f},
-std::array<float,2>{0.943883121f, 0.126738608f},
-std::array<float,2>{0.189104483f, 0.665965855f},
-std::array<float,2>{0.289917439f, 0.433578461f},
-std::array<float,2>{0.663979888f, 0.921886563f},
-std::array<float,2>{0.510798156f, 0.247716859f},
-std::array<float,2>{0.425386995f, 0.738611221f},
-std::array<float,2>{0.114754856f, 0.444381684f},
-std::array<float,2>{0.782919645f, 0.943676054f},
-std::array<float,2>{0.901220381f, 0.358469516f},
-std::array<float,2>{0.128598124f, 0.81376344f},
-std::array<float,2>{0.325768113f, 0.00170635094f},
-std::array<float,2>{0.725275338f, 0.540849566f},
-std::array<float,2>{0.648924589f, 0.400434971f},
-std::array<float,2>{0.26074791f, 0.878521085f},
-std::array<float,2>{0.236922294f, 0.171181127f},
-std::array<float,2>{0.993362606f, 0.635986924f},
-std::array<float,2>{0.858956575f, 0.0669551417f},
-std::array<float,2>{0.052708853f, 0.61418432f},
-std::array<float,2>{0.458293438f, 0.301015824f},
-std::array<float,2>{0.602855027f, 0.78744477f},
-std::array<float,2>{0.624515355f, 0.11976365f},
-std::array<float,2>{0.450577348f, 0.586036742f},
-std::array<float,2>{0.0433137231f, 0.265784919f},
-std::array<float,2>{0.869983137f, 0.75584805f},
-std::array<float,2>{0.971148551f, 0.417722523f},
-std::array<float,2>{0.22364603f, 0.908016205f},
-std::array<float,2>{0.276323169f, 0.15136306f},
-std::array<float,2>{0.62557143f, 0.684987783f},
-std::array<float,2>{0.740575314f, 0.32683742f},
-std::array<float,2>{0.335507363f, 0.87158972f},
-std::array<float,2>{0.143226191f, 0.052350454f},
-std::array<float,2>{0.883309305f, 0.510282218f},
-std::array<float,2>{0.808776617f, 0.193653286f},
-std::array<float,2>{0.102480337f, 0.71520865f},
-std::array<float,2>{0.418149441f, 0.490286708f},
-std::array<float,2>{0.531057775f, 0.991252244f},
-std::array<float,2>{0.68618834f, 0.181457683f},
-std::array<float,2>{0.308790624f, 0.645648777f},
-std::array<float,2>{0.207376644f, 0.3819938f},
-std::array<float,2>{0.966563404f, 0.901152492f},
-std::array<float,2>{0.836728632f, 0.291836917f},
-std::array<float,2>{0.0166861247f, 0.803525686f},
-std::array<float,2>{0.47900486f, 0.0907638445f},
-std::array<float,2>{0.585883677f, 0.608114719f},
-std::array<float,2>{0.543249011f, 0.459707797f},
-std::array<float,2>{0.377998799f, 0.962498665f},
-std::array<float,2>{0.0933680236f, 0.223945305f},
-std::array<float,2>{0.758562803f, 0.721170843f},
-std::array<float,2>{0.935268164f, 0.0257828776f},
-std::array<float,2>{0.17171286f, 0.549512327f},
-std::array<float,2>{0.347262383f, 0.363579005f},
-std::array<float,2>{0.712182105f, 0.831685126f},
-std::array<float,2>{0.639104545f, 0.0841965526f},
-std::array<float,2>{0.272002429f, 0.599995673f},
-std::array<float,2>{0.229583889f, 0.28227973f},
-std::array<float,2>{0.980395496f, 0.81055057f},
-std::array<float,2>{0.863521695f, 0.384539396f},
-std::array<float,2>{0.0328824855f, 0.892389655f},
-std::array<float,2>{0.443823427f, 0.178051218f},
-std::array<float,2>{0.61479795f, 0.648730218f},
-std::array<float,2>{0.521573842f, 0.373417079f},
-std::array<float,2>{0.40936169f, 0.83935219f},
-std::array<float,2>{0.0937506557f, 0.0189511869f},
-std::array<float,2>{0.799376011f, 0.557439983f},
-std::array<float,2>{0.881339967f, 0.230359226f},
-std::array<float,2>{0.149301037f, 0.730804563f},
-std::array<float,2>{0.34115538f, 0.462920159f},
-std::array<float,2>{0.748078287f, 0.957083344f},
-std::array<float,2>{0.593045592f, 0.141813874f},
-std::array<float,2>{0.474885553f, 0.67926079f},
-std::array<float,2>{0.0288944915f, 0.407530069f},
-std::array<float,2>{0.834825635f, 0.915336609f},
-std::array<float,2>{0.959556639f, 0.276195765f},
-std::array<float,2>{0.211773172f, 0.762877107f},
-std::array<float,2>{0.298803896f, 0.112230577f},
-std::array<float,2>{0.677841961f, 0.58295244f},
-std::array<float,2>{0.7034325f, 0.492630929f},
-std::array<float,2>{0.354702502f, 0.99856931f},
-std::array<float,2>{0.160144255f, 0.201187164f},
-std::array<float,2>{0.927613556f, 0.705813944f},
-std::array<float,2>{0.751527786f, 0.0624667481f},
-std::array<float,2>{0.0853863731f, 0.500902832f},
-std::array<float,2>{0.388044208f, 0.315252692f},
-std::array<float,2>{0.531654775f, 0.865589976f},
-std::array<float,2>{0.555905581f, 0.00928724278f},
-std::array<float,2>{0.40564543f, 0.535654426f},
-std::array<float,2>{0.0763397142f, 0.346497834f},
-std::array<float,2>{0.766419172f, 0.821740985f},
-std::array<float,2>{0.914870977f, 0.445540279f},
-std::array<float,2>{0.173987418f, 0.94605273f},
-std::array<float,2>{0.364342302f, 0.237022594f},
-std::array<float,2>{0.695894599f, 0.743243515f},
-std::array<float,2>{0.671570003f, 0.308546364f},
-std::array<float,2>{0.281849682f, 0.796202838f},
-std::array<float,2>{0.197626457f, 0.0775008574f},
-std::array<float,2>{0.949215233f, 0.621137083f},
-std::array<float,2>{0.82266295f, 0.158844233f},
-std::array<float,2>{0.00624326104f, 0.625112593f},
-std::array<float,2>{0.496353924f, 0.394605786f},
-std::array<float,2>{0.57071805f, 0.888216138f},
-std::array<float,2>{0.731043041f, 0.214099824f},
-std::array<float,2>{0.314339697f, 0.688161671f},
-std::array<float,2>{0.135629162f, 0.474803537f},
-std::array<float,2>{0.891274452f, 0.974462628f},
-std::array<float,2>{0.795293212f, 0.329453021f},
-std::array<float,2>{0.121609434f, 0.854879618f},
-std::array<float,2>{0.434334546f, 0.0357961208f},
-std::array<float,2>{0.505519629f, 0.517054081f},
-std::array<float,2>{0.594711721f, 0.423103273f},
-std::array<float,2>{0.461274236f, 0.934709311f},
-std::array<float,2>{0.0620213151f, 0.133199736f},
-std::array<float,2>{0.850505352f, 0.659748018f},
-std::array<float,2>{0.989099503f, 0.10476689f},
-std::array<float,2>{0.242838815f, 0.571681976f},
-std::array<float,2>{0.253134191f, 0.261174291f},
-std::array<float,2>{0.646457374f, 0.773667037f},
-std::array<float,2>{0.709619999f, 0.0654088482f},
-std::array<float,2>{0.356586903f, 0.610006094f},
-std::array<float,2>{0.162515357f, 0.297409415f},
-std::array<float,2>{0.922873199f, 0.783697128f},
-std::array<float,2>{0.755930364f, 0.405944377f},
-std::array<float,2>{0.0787911415f, 0.879017115f},
-std::array<float,2>{0.386018068f, 0.166444615f},
-std::array<float,2>{0.536179662f, 0.63715905f},
-std::array<float,2>{0.586773932f, 0.35459289f},
-std::array<float,2>{0.471172452f, 0.819877744f},
-std::array<float,2>{0.0239128768f, 0.00719527854f},
-std::array<float,2>{0.83044827f, 0.544584215f},
-std::array<float,2>{0.953756392f, 0.243102491f},
-std::array<float,2>{0.215823174f, 0.738162875f},
-std::array<float,2>{0.303971589f, 0.438572317f},
-std::array<float,2>{0.6725896f, 0.940993845f},
-std::array<float,2>{0.517318547f, 0.129925728f},
-std::array<float,2>{0.413782567f, 0.669135392f},
-std::array<float,2>{0.101336479f, 0.437368542f},
-std::array<float,2>{0.802519739f, 0.929166615f},
-std::array<float,2>{0.876284838f, 0.251319766f},
-std::array<float,2>{0.153786629f, 0.768828332f},
-std::array<float,2>{0.337522864f, 0.0972547755f},
-std::array<float,2>{0.743502557f, 0.567653179f},
-std::array<float,2>{0.63629669f, 0.48427546f},
-std::array<float,2>{0.268272966f, 0.98110503f},
-std::array<float,2>{0.231565148f, 0.210096344f},
-std::array<float,2>{0.981150687f, 0.702992737f},
-std::array<float,2>{0.860583067f, 0.0466992147f},
-std::array<float,2>{0.0379182696f, 0.524246156f},
-std::array<float,2>{0.440986365f, 0.338773191f},
-std::array<float,2>{0.610182285f, 0.850270271f},
-std::array<float,2>{0.597744644f, 0.0308111403f},
-std::array<float,2>{0.467141092f, 0.553685844f},
-std::array<float,2>{0.0584395565f, 0.361114383f},
-std::array<float,2>{0.846159756f, 0.835094273f},
-std::array<float,2>{0.987001121f, 0.453823f},
-std::array<float,2>{0.246877328f, 0.967460632f},
-std::array<float,2>{0.25492087f, 0.222481519f},
-std::array<float,2>{0.640761137f, 0.725864887f},
-std::array<float,2>{0.727977157f, 0.296049416f},
-std::array<float,2>{0.318661004f, 0.798941791f},
-std::array<float,2>{0.139923394f, 0.0896325782f},
-std::array<float,2>{0.895039797f, 0.603341699f},
-std::array<float,2>{0.790083706f, 0.184494942f},
-std::array<float,2>{0.11725238f, 0.644272447f},
-std::array<float,2>{0.431461453f, 0.376603633f},
-std::array<float,2>{0.500427306f, 0.904261053f},
-std::array<float,2>{0.665527523f, 0.187821791f},
-std::array<float,2>{0.28627032f, 0.712112308f},
-std::array<float,2>{0.200083226f, 0.484513491f},
-std::array<float,2>{0.949954748f, 0.984804869f},
-std::array<float,2>{0.827522099f, 0.322459191f},
-std::array<float,2>{0.00229937048f, 0.870596468f},
-std::array<float,2>{0.494048148f, 0.0473263189f},
-std::array<float,2>{0.577225208f, 0.512564063f},
-std::array<float,2>{0.560540438f, 0.421561033f},
-std::array<float,2>{0.399798512f, 0.91139257f},
-std::array<float,2>{0.0723501593f, 0.15409027f},
-std::array<float,2>{0.770998657f, 0.680993378f},
-std::array<float,2>{0.918582082f, 0.121813372f},
-std::array<float,2>{0.177625135f, 0.592771947f},
-std::array<float,2>{0.362317622f, 0.272198558f},
-std::array<float,2>{0.701141119f, 0.750454843f},
-std::array<float,2>{0.653728008f, 0.0565294288f},
-std::array<float,2>{0.262225956f, 0.506899893f},
-std::array<float,2>{0.240599275f, 0.317308813f},
-std::array<float,2>{0.99933058f, 0.861165464f},
-std::array<float,2>{0.852252126f, 0.497408897f},
-std::array<float,2>{0.0493256636f, 0.994356453f},
-std::array<float,2>{0.455706716f, 0.197944418f},
-std::array<float,2>{0.608726263f, 0.707498252f},
-std::array<float,2>{0.513715625f, 0.277744681f},
-std::array<float,2>{0.429180175f, 0.75864923f},
-std::array<float,2>{0.112727493f, 0.116965495f},
-std::array<float,2>{0.787869036f, 0.578475356f},
-std::array<float,2>{0.902918458f, 0.146399602f},
-std::array<float,2>{0.130447432f, 0.672618687f},
-std::array<float,2>{0.324186891f, 0.410405219f},
-std::array<float,2>{0.719323695f, 0.921303391f},
-std::array<float,2>{0.566244543f, 0.233003676f},
-std::array<float,2>{0.486579269f, 0.727266431f},
-std::array<float,2>{0.0125687197f, 0.467234462f},
-std::array<float,2>{0.818520904f, 0.955714285f},
-std::array<float,2>{0.938873589f, 0.371089667f},
-std::array<float,2>{0.195050403f, 0.843386233f},
-std::array<float,2>{0.294189692f, 0.0221912358f},
-std::array<float,2>{0.659275711f, 0.561356366f},
-std::array<float,2>{0.691664994f, 0.387380183f},
-std::array<float,2>{0.372288108f, 0.895210743f},
-std::array<float,2>{0.183059916f, 0.173292503f},
-std::array<float,2>{0.9095698f, 0.653981984f},
-std::array<float,2>{0.778056562f, 0.0811758041f},
-std::array<float,2>{0.0698427632f, 0.59574759f},
-std::array<float,2>{0.397565544f, 0.287351668f},
-std::array<float,2>{0.552132547f, 0.807883382f},
-std::array<float,2>{0.541055858f, 0.108661987f},
-std::array<float,2>{0.38083744f, 0.574848473f},
-std::array<float,2>{0.0889670104f, 0.265570611f},
-std::array<float,2>{0.762614906f, 0.779967308f},
-std::array<float,2>{0.933226287f, 0.42637068f},
-std::array<float,2>{0.167247161f, 0.932175457f},
-std::array<float,2>{0.350087494f, 0.138624504f},
-std::array<float,2>{0.718306184f, 0.661664903f},
-std::array<float,2>{0.680892646f, 0.332157433f},
-std::array<float,2>{0.305868119f, 0.8570593f},
-std::array<float,2>{0.204046488f, 0.0330943167f},
-std::array<float,2>{0.962460399f, 0.523019254f},
-std::array<float,2>{0.840928316f, 0.218237638f},
-std::array<float,2>{0.0201399494f, 0.694914103f},
-std::array<float,2>{0.483842164f, 0.472252399f},
-std::array<float,2>{0.578329325f, 0.97169143f},
-std::array<float,2>{0.734614134f, 0.160326838f},
-std::array<float,2>{0.330473036f, 0.631032705f},
-std::array<float,2>{0.147826016f, 0.394052833f},
-std::array<float,2>{0.887106657f, 0.885986805f},
-std::array<float,2>{0.808275461f, 0.308951527f},
-std::array<float,2>{0.108546682f, 0.791159391f},
-std::array<float,2>{0.417016804f, 0.0719835684f},
-std::array<float,2>{0.524857283f, 0.621068895f},
-std::array<float,2>{0.620449483f, 0.451721787f},
-std::array<float,2>{0.446193099f, 0.950040579f},
-std::array<float,2>{0.0411468558f, 0.238476217f},
-std::array<float,2>{0.874367237f, 0.747140706f},
-std::array<float,2>{0.972854376f, 0.0150357634f},
-std::array<float,2>{0.222538352f, 0.533600092f},
-std::array<float,2>{0.277776182f, 0.349774152f},
-std::array<float,2>{0.632228673f, 0.827510417f},
-std::array<float,2>{0.723794281f, 0.0020636532f},
-std::array<float,2>{0.326604068f, 0.541658759f},
-std::array<float,2>{0.126892775f, 0.356993854f},
-std::array<float,2>{0.898450971f, 0.816035509f},
-std::array<float,2>{0.784471512f, 0.442168742f},
-std::array<float,2>{0.115570381f, 0.941983342f},
-std::array<float,2>{0.42272824f, 0.248519287f},
-std::array<float,2>{0.509340823f, 0.741226375f},
-std::array<float,2>{0.604949892f, 0.303111672f},
-std::array<float,2>{0.459832996f, 0.785490334f},
-std::array<float,2>{0.054172568f, 0.0688119978f},
-std::array<float,2>{0.856213689f, 0.617139459f},
-std::array<float,2>{0.994683087f, 0.168092921f},
-std::array<float,2>{0.234928221f, 0.633226275f},
-std::array<float,2>{0.25938502f, 0.398605764f},
-std::array<float,2>{0.651052296f, 0.875594497f},
-std::array<float,2>{0.548197269f, 0.206771284f},
-std::array<float,2>{0.39358604f, 0.696252763f},
-std::array<float,2>{0.0642694011f, 0.477339268f},
-std::array<float,2>{0.774216533f, 0.978021324f},
-std::array<float,2>{0.911660492f, 0.340917438f},
-std::array<float,2>{0.184573844f, 0.847463131f},
-std::array<float,2>{0.368027836f, 0.0418170653f},
-std::array<float,2>{0.689860344f, 0.530510247f},
-std::array<float,2>{0.66095829f, 0.43009463f},
-std::array<float,2>{0.29262355f, 0.925064325f},
-std::array<float,2>{0.191156372f, 0.128407165f},
-std::array<float,2>{0.941805184f, 0.667945683f},
-std::array<float,2>{0.813329995f, 0.099446401f},
-std::array<float,2>{0.00890082587f, 0.563363969f},
-std::array<float,2>{0.488862574f, 0.253960371f},
-std::array<float,2>{0.567999601f, 0.770024359f},
-std::array<float,2>{0.583538115f, 0.0932850987f},
-std::array<float,2>{0.476882219f, 0.607200861f},
-std::array<float,2>{0.0181736294f, 0.289766461f},
-std::array<float,2>{0.839086831f, 0.801899612f},
-std::array<float,2>{0.968087912f, 0.380137086f},
-std::array<float,2>{0.209276125f, 0.898691595f},
-std::array<float,2>{0.312134981f, 0.18204172f},
-std::array<float,2>{0.6844576f, 0.646768153f},
-std::array<float,2>{0.714621305f, 0.366875559f},
-std::array<float,2>{0.344027877f, 0.828682899f},
-std::array<float,2>{0.169202447f, 0.0238417722f},
-std::array<float,2>{0.935642719f, 0.547020078f},
-std::array<float,2>{0.76164484f, 0.225052178f},
-std::array<float,2>{0.0904749185f, 0.719286382f},
-std::array<float,2>{0.376297385f, 0.458646953f},
-std::array<float,2>{0.546347439f, 0.964552939f},
-std::array<float,2>{0.627639413f, 0.14988929f},
-std::array<float,2>{0.274770737f, 0.686938822f},
-std::array<float,2>{0.225850523f, 0.415910065f},
-std::array<float,2>{0.97000742f, 0.909781814f},
-std::array<float,2>{0.868955195f, 0.268817931f},
-std::array<float,2>{0.0461753346f, 0.757295787f},
-std::array<float,2>{0.451501667f, 0.119118519f},
-std::array<float,2>{0.622843146f, 0.588621199f},
-std::array<float,2>{0.528888881f, 0.488631189f},
-std::array<float,2>{0.420189768f, 0.989836574f},
-std::array<float,2>{0.104525484f, 0.191966802f},
-std::array<float,2>{0.811967492f, 0.71732223f},
-std::array<float,2>{0.884906232f, 0.0532090925f},
-std::array<float,2>{0.141117141f, 0.508816063f},
-std::array<float,2>{0.332032144f, 0.324426293f},
-std::array<float,2>{0.740223885f, 0.874936223f},
-std::array<float,2>{0.677495122f, 0.110888734f},
-std::array<float,2>{0.298882842f, 0.58498615f},
-std::array<float,2>{0.214743465f, 0.273680031f},
-std::array<float,2>{0.95713973f, 0.764239132f},
-std::array<float,2>{0.833873272f, 0.410116732f},
-std::array<float,2>{0.0299961176f, 0.917049706f},
-std::array<float,2>{0.473944813f, 0.143700629f},
-std::array<float,2>{0.59003365f, 0.677718043f},
-std::array<float,2>{0.533284187f, 0.313835233f},
-std::array<float,2>{0.390180439f, 0.86479038f},
-std::array<float,2>{0.0827789456f, 0.0588176139f},
-std::array<float,2>{0.753366649f, 0.502621889f},
-std::array<float,2>{0.929627001f, 0.200008824f},
-std::array<float,2>{0.157686293f, 0.703536391f},
-std::array<float,2>{0.351945966f, 0.494312793f},
-std::array<float,2>{0.706468999f, 0.99786216f},
-std::array<float,2>{0.615777075f, 0.176795006f},
-std::array<float,2>{0.442843258f, 0.652004957f},
-std::array<float,2>{0.0341098793f, 0.385704517f},
-std::array<float,2>{0.866889894f, 0.893173873f},
-std::array<float,2>{0.977122545f, 0.284545213f},
-std::array<float,2>{0.228301153f, 0.809997022f},
-std::array<float,2>{0.270124257f, 0.0825818405f},
-std::array<float,2>{0.637935162f, 0.597793996f},
-std::array<float,2>{0.747116089f, 0.460944057f},
-std::array<float,2>{0.341842294f, 0.960680068f},
-std::array<float,2>{0.151847929f, 0.226585478f},
-std::array<float,2>{0.880447209f, 0.732921004f},
-std::array<float,2>{0.798759937f, 0.0171322189f},
-std::array<float,2>{0.0967775956f, 0.556244791f},
-std::array<float,2>{0.406450301f, 0.372858256f},
-std::array<float,2>{0.520901442f, 0.837461293f},
-std::array<float,2>{0.50605011f, 0.0375079848f},
-std::array<float,2>{0.4364779f, 0.519209921f},
-std::array<float,2>{0.123827212f, 0.330282509f},
-std::array<float,2>{0.793934226f, 0.852550387f},
-std::array<float,2>{0.893902123f, 0.474174678f},
-std::array<float,2>{0.134299874f, 0.975107014f},
-std::array<float,2>{0.316350788f, 0.211030811f},
-std::array<float,2>{0.733363748f, 0.69137311f},
-std::array<float,2>{0.647160232f, 0.25958097f},
-std::array<float,2>{0.251095355f, 0.776017368f},
-std::array<float,2>{0.245215908f, 0.101676084f},
-std::array<float,2>{0.991219878f, 0.572508156f},
-std::array<float,2>{0.848933756f, 0.136503875f},
-std::array<float,2>{0.059974879f, 0.657075226f},
-std::array<float,2>{0.463171899f, 0.424839586f},
-std::array<float,2>{0.596186221f, 0.9361642f},
-std::array<float,2>{0.697377145f, 0.234934464f},
-std::array<float,2>{0.366458386f, 0.74427259f},
-std::array<float,2>{0.172459602f, 0.448499352f},
-std::array<float,2>{0.916392088f, 0.948285401f},
-std::array<float,2>{0.768712282f, 0.344793022f},
-std::array<float,2>{0.0745665431f, 0.824192822f},
-std::array<float,2>{0.40269652f, 0.0110261152f},
-std::array<float,2>{0.557394028f, 0.538110495f},
-std::array<float,2>{0.573887825f, 0.398221463f},
-std::array<float,2>{0.498905122f, 0.890214443f},
-std::array<float,2>{0.00480040815f, 0.157712862f},
-std::array<float,2>{0.822142363f, 0.628206611f},
-std::array<float,2>{0.945941687f, 0.0750543103f},
-std::array<float,2>{0.19532977f, 0.623192191f},
-std::array<float,2>{0.284765452f, 0.305567086f},
-std::array<float,2>{0.669626355f, 0.792990744f},
-std::array<float,2>{0.736492515f, 0.0713490695f},
-std::array<float,2>{0.329620093f, 0.620165527f},
-std::array<float,2>{0.145114139f, 0.309367448f},
-std::array<float,2>{0.889540136f, 0.791736722f},
-std::array<float,2>{0.804926753f, 0.393655449f},
-std::array<float,2>{0.106591865f, 0.88647306f},
-std::array<float,2>{0.414098978f, 0.161101162f},
-std::array<float,2>{0.526878834f, 0.631519258f},
-std::array<float,2>{0.617998362f, 0.350324988f},
-std::array<float,2>{0.448634833f, 0.828091085f},
-std::array<float,2>{0.0403556861f, 0.0152541474f},
-std::array<float,2>{0.871938646f, 0.533771873f},
-std::array<float,2>{0.97534883f, 0.239242449f},
-std::array<float,2>{0.219034195f, 0.747686267f},
-std::array<float,2>{0.280020028f, 0.451617926f},
-std::array<float,2>{0.630682826f, 0.949310243f},
-std::array<float,2>{0.539799452f, 0.137845889f},
-std::array<float,2>{0.382568181f, 0.661488473f},
-std::array<float,2>{0.0877539665f, 0.426197648f},
-std::array<float,2>{0.764908135f, 0.931961715f},
-std::array<float,2>{0.930305541f, 0.264716834f},
-std::array<float,2>{0.165399119f, 0.779326618f},
-std::array<float,2>{0.348343402f, 0.109327823f},
-std::array<float,2>{0.715227127f, 0.574289441f},
-std::array<float,2>{0.682933927f, 0.471986562f},
-std::array<float,2>{0.307483613f, 0.972482324f},
-std::array<float,2>{0.205785125f, 0.218506217f},
-std::array<float,2>{0.963763595f, 0.694553792f},
-std::array<float,2>{0.843114197f, 0.0324203596f},
-std::array<float,2>{0.0220962446f, 0.522702992f},
-std::array<float,2>{0.480520874f, 0.332688302f},
-std::array<float,2>{0.580131888f, 0.856728852f},
-std::array<float,2>{0.562514186f, 0.0217796713f},
-std::array<float,2>{0.484692395f, 0.560946226f},
-std::array<float,2>{0.0136952968f, 0.370424598f},
-std::array<float,2>{0.818131208f, 0.843222678f},
-std::array<float,2>{0.939844787f, 0.467342973f},
-std::array<float,2>{0.193006769f, 0.95536077f},
-std::array<float,2>{0.295525014f, 0.232804596f},
-std::array<float,2>{0.65713203f, 0.72684896f},
-std::array<float,2>{0.694935381f, 0.288006544f},
-std::array<float,2>{0.3737562f, 0.808495283f},
-std::array<float,2>{0.179979041f, 0.081628792f},
-std::array<float,2>{0.906973243f, 0.596610546f},
-std::array<float,2>{0.77986449f, 0.173605174f},
-std::array<float,2>{0.0678450689f, 0.653641522f},
-std::array<float,2>{0.395199388f, 0.386817425f},
-std::array<float,2>{0.55294162f, 0.894551158f},
-std::array<float,2>{0.654981315f, 0.197637141f},
-std::array<float,2>{0.265415758f, 0.707635701f},
-std::array<float,2>{0.238854617f, 0.498041511f},
-std::array<float,2>{0.997547448f, 0.994941175f},
-std::array<float,2>{0.853530943f, 0.316573381f},
-std::array<float,2>{0.0479063876f, 0.860635161f},
-std::array<float,2>{0.45369029f, 0.056111943f},
-std::array<float,2>{0.606535614f, 0.507708609f},
-std::array<float,2>{0.513569355f, 0.410778731f},
-std::array<float,2>{0.426788658f, 0.92152822f},
-std::array<float,2>{0.109814115f, 0.145694137f},
-std::array<float,2>{0.786406577f, 0.67226994f},
-std::array<float,2>{0.90480864f, 0.116380662f},
-std::array<float,2>{0.131892905f, 0.57883203f},
-std::array<float,2>{0.321343422f, 0.27797249f},
-std::array<float,2>{0.72234422f, 0.757974982f},
-std::array<float,2>{0.667166233f, 0.0473720618f},
-std::array<float,2>{0.28870216f, 0.5118137f},
-std::array<float,2>{0.201691091f, 0.323194623f},
-std::array<float,2>{0.952261031f, 0.870801449f},
-std::array<float,2>{0.824959576f, 0.484879702f},
-std::array<float,2>{0.00053002045f, 0.985260129f},
-std::array<float,2>{0.495933533f, 0.188306257f},
-std::array<float,2>{0.575075448f, 0.712550581f},
-std::array<float,2>{0.561873615f, 0.271725357f},
-std::array<float,2>{0.400403142f, 0.750756204f},
-std::array<float,2>{0.0719504133f, 0.121567756f},
-std::array<float,2>{0.772202015f, 0.592145503f},
-std::array<float,2>{0.921343446f, 0.153704837f},
-std::array<float,2>{0.179020345f, 0.681203127f},
-std::array<float,2>{0.360360712f, 0.420967788f},
-std::array<float,2>{0.701717377f, 0.911723375f},
-std::array<float,2>{0.600263715f, 0.221766874f},
-std::array<float,2>{0.46492362f, 0.726125181f},
-std::array<float,2>{0.0553286076f, 0.453327656f},
-std::array<float,2>{0.844497323f, 0.966814756f},
-std::array<float,2>{0.985670149f, 0.360407978f},
-std::array<float,2>{0.248757526f, 0.835778296f},
-std::array<float,2>{0.257333905f, 0.0303812642f},
-std::array<float,2>{0.643725038f, 0.553044438f},
-std::array<float,2>{0.729357183f, 0.376326919f},
-std::array<float,2>{0.317159593f, 0.903493345f},
-std::array<float,2>{0.13724415f, 0.183806553f},
-std::array<float,2>{0.896639645f, 0.64364624f},
-std::array<float,2>{0.791176081f, 0.0893173292f},
-std::array<float,2>{0.120953001f, 0.60270977f},
-std::array<float,2>{0.433282197f, 0.296513379f},
-std::array<float,2>{0.50274545f, 0.799790561f},
-std::array<float,2>{0.517654121f, 0.0967566371f},
-std::array<float,2>{0.412108332f, 0.568202019f},
-std::array<float,2>{0.0985438898f, 0.251596332f},
-std::array<float,2>{0.804148734f, 0.769147217f},
-std::array<float,2>{0.878172994f, 0.436773807f},
-std::array<float,2>{0.154622093f, 0.929319561f},
-std::array<float,2>{0.339715391f, 0.130526394f},
-std::array<float,2>{0.745198369f, 0.669552147f},
-std::array<float,2>{0.634579241f, 0.337897003f},
-std::array<float,2>{0.266530246f, 0.849890769f},
-std::array<float,2>{0.232507467f, 0.0462776832f},
-std::array<float,2>{0.984003603f, 0.52389133f},
-std::array<float,2>{0.861640751f, 0.210860357f},
-std::array<float,2>{0.0370331816f, 0.702529907f},
-std::array<float,2>{0.438180089f, 0.483638316f},
-std::array<float,2>{0.612197936f, 0.980820775f},
-std::array<float,2>{0.707233906f, 0.166757718f},
-std::array<float,2>{0.358332098f, 0.637608767f},
-std::array<float,2>{0.162057683f, 0.405525029f},
-std::array<float,2>{0.925775945f, 0.87980926f},
-std::array<float,2>{0.7541821f, 0.297301948f},
-std::array<float,2>{0.0803212821f, 0.783503652f},
-std::array<float,2>{0.382872611f, 0.0647381693f},
-std::array<float,2>{0.538862824f, 0.609573543f},
-std::array<float,2>{0.589645982f, 0.439389497f},
-std::array<float,2>{0.469751477f, 0.940726042f},
-std::array<float,2>{0.0263303276f, 0.242555857f},
-std::array<float,2>{0.829610229f, 0.73769176f},
-std::array<float,2>{0.955444813f, 0.00753776031f},
-std::array<float,2>{0.217319503f, 0.543946803f},
-std::array<float,2>{0.302705735f, 0.35498935f},
-std::array<float,2>{0.673869312f, 0.819497466f},
-std::array<float,2>{0.695569396f, 0.0115529886f},
-std::array<float,2>{0.364852875f, 0.539001822f},
-std::array<float,2>{0.174585819f, 0.345628202f},
-std::array<float,2>{0.914508402f, 0.823724806f},
-std::array<float,2>{0.76598841f, 0.448976785f},
-std::array<float,2>{0.0771277621f, 0.948931694f},
-std::array<float,2>{0.405970365f, 0.234574199f},
-std::array<float,2>{0.556430578f, 0.744642496f},
-std::array<float,2>{0.570929825f, 0.304792494f},
-std::array<float,2>{0.496876657f, 0.793914437f},
-std::array<float,2>{0.00665781554f, 0.0744779706f},
-std::array<float,2>{0.82287544f, 0.623923063f},
-std::array<float,2>{0.948492289f, 0.157843649f},
-std::array<float,2>{0.198090807f, 0.62885046f},
-std::array<float,2>{0.281686246f, 0.397780627f},
-std::array<float,2>{0.671260178f, 0.889949203f},
-std::array<float,2>{0.504940689f, 0.211657703f},
-std::array<float,2>{0.433870703f, 0.690829933f},
-std::array<float,2>{0.121109344f, 0.473668396f},
-std::array<float,2>{0.795535684f, 0.974701703f},
-std::array<float,2>{0.890706301f, 0.331011236f},
-std::array<float,2>{0.134780064f, 0.853218734f},
-std::array<float,2>{0.313858867f, 0.0376856066f},
-std::array<float,2>{0.730799675f, 0.518701792f},
-std::array<float,2>{0.64581269f, 0.425629109f},
-std::array<float,2>{0.253881752f, 0.935896277f},
-std::array<float,2>{0.242589414f, 0.135992363f},
-std::array<float,2>{0.988316715f, 0.656267941f},
-std::array<float,2>{0.850079417f, 0.102400281f},
-std::array<float,2>{0.0616176911f, 0.572810233f},
-std::array<float,2>{0.461427599f, 0.258941144f},
-std::array<float,2>{0.594178915f, 0.775853574f},
-std::array<float,2>{0.614405096f, 0.0823934451f},
-std::array<float,2>{0.444048047f, 0.598490655f},
-std::array<float,2>{0.0324928686f, 0.285010815f},
-std::array<float,2>{0.863827646f, 0.810114384f},
-std::array<float,2>{0.979957759f, 0.38500303f},
-std::array<float,2>{0.230083674f, 0.892813146f},
-std::array<float,2>{0.271525651f, 0.177376837f},
-std::array<float,2>{0.639487326f, 0.651634455f},
-std::array<float,2>{0.748911858f, 0.372501314f},
-std::array<float,2>{0.341742158f, 0.837336063f},
-std::array<float,2>{0.14872089f, 0.0168835297f},
-std::array<float,2>{0.881619632f, 0.556016326f},
-std::array<float,2>{0.799113035f, 0.22733663f},
-std::array<float,2>{0.0944565386f, 0.732637405f},
-std::array<float,2>{0.409677744f, 0.461682022f},
-std::array<float,2>{0.522085547f, 0.960301697f},
-std::array<float,2>{0.678387582f, 0.144494191f},
-std::array<float,2>{0.298279405f, 0.676804781f},
-std::array<float,2>{0.211153999f, 0.409511924f},
-std::array<float,2>{0.959382355f, 0.917925656f},
-std::array<float,2>{0.834268391f, 0.274269074f},
-std::array<float,2>{0.0285371859f, 0.764103711f},
-std::array<float,2>{0.475166738f, 0.11038062f},
-std::array<float,2>{0.593719065f, 0.585806668f},
-std::array<float,2>{0.531870365f, 0.494651318f},
-std::array<float,2>{0.38838467f, 0.997395754f},
-std::array<float,2>{0.0857795998f, 0.199639782f},
-std::array<float,2>{0.751173735f, 0.70367223f},
-std::array<float,2>{0.92684859f, 0.0593954846f},
-std::array<float,2>{0.159224644f, 0.502143383f},
-std::array<float,2>{0.355355352f, 0.314157754f},
-std::array<float,2>{0.703705966f, 0.86442405f},
-std::array<float,2>{0.625086546f, 0.118459277f},
-std::array<float,2>{0.275747687f, 0.5881868f},
-std::array<float,2>{0.224284932f, 0.269075066f},
-std::array<float,2>{0.971453905f, 0.757569194f},
-std::array<float,2>{0.869486332f, 0.41511324f},
-std::array<float,2>{0.0437657908f, 0.909311891f},
-std::array<float,2>{0.451092362f, 0.150293574f},
-std::array<float,2>{0.624332666f, 0.687259495f},
-std::array<float,2>{0.530610323f, 0.32515958f},
-std::array<float,2>{0.418712109f, 0.874078989f},
-std::array<float,2>{0.101686038f, 0.0534362718f},
-std::array<float,2>{0.809457541f, 0.509327173f},
-std::array<float,2>{0.882938147f, 0.191425994f},
-std::array<float,2>{0.142929539f, 0.716974974f},
-std::array<float,2>{0.334988862f, 0.488878548f},
-std::array<float,2>{0.740791261f, 0.989650965f},
-std::array<float,2>{0.585447311f, 0.182295173f},
-std::array<float,2>{0.478980422f, 0.64740634f},
-std::array<float,2>{0.0174435638f, 0.38051942f},
-std::array<float,2>{0.836209536f, 0.898932517f},
-std::array<float,2>{0.966213524f, 0.289266676f},
-std::array<float,2>{0.2076471f, 0.802722394f},
-std::array<float,2>{0.309518278f, 0.0930449963f},
-std::array<float,2>{0.685718715f, 0.606805325f},
-std::array<float,2>{0.71247071f, 0.458008736f},
-std::array<float,2>{0.346779346f, 0.964211166f},
-std::array<float,2>{0.171369657f, 0.22517398f},
-std::array<float,2>{0.934862435f, 0.718942344f},
-std::array<float,2>{0.758279026f, 0.0243992321f},
-std::array<float,2>{0.093097806f, 0.547465503f},
-std::array<float,2>{0.378878832f, 0.366355896f},
-std::array<float,2>{0.543785036f, 0.828254998f},
-std::array<float,2>{0.550313771f, 0.0412390456f},
-std::array<float,2>{0.392538667f, 0.531029701f},
-std::array<float,2>{0.0658892989f, 0.341452509f},
-std::array<float,2>{0.776426852f, 0.846940756f},
-std::array<float,2>{0.913889587f, 0.476865768f},
-std::array<float,2>{0.18715404f, 0.978435338f},
-std::array<float,2>{0.370394975f, 0.206235141f},
-std::array<float,2>{0.689235687f, 0.695488572f},
-std::array<float,2>{0.663571417f, 0.254611224f},
-std::array<float,2>{0.289518714f, 0.769612968f},
-std::array<float,2>{0.188915253f, 0.0987729877f},
-std::array<float,2>{0.943811595f, 0.562831402f},
-std::array<float,2>{0.815706849f, 0.128662452f},
-std::array<float,2>{0.0103138536f, 0.667341173f},
-std::array<float,2>{0.490362555f, 0.430592716f},
-std::array<float,2>{0.569209933f, 0.925401509f},
-std::array<float,2>{0.724711657f, 0.248862222f},
-std::array<float,2>{0.325565845f, 0.742013931f},
-std::array<float,2>{0.128311232f, 0.441568017f},
-std::array<float,2>{0.9004637f, 0.941753447f},
-std::array<float,2>{0.782528996f, 0.35656625f},
-std::array<float,2>{0.114475451f, 0.815835476f},
-std::array<float,2>{0.42512551f, 0.00245500403f},
-std::array<float,2>{0.511244178f, 0.541128337f},
-std::array<float,2>{0.603090465f, 0.399268299f},
-std::array<float,2>{0.458560437f, 0.875086606f},
-std::array<float,2>{0.0520305708f, 0.16880466f},
-std::array<float,2>{0.858466804f, 0.633329511f},
-std::array<float,2>{0.994069159f, 0.0690431297f},
-std::array<float,2>{0.236796126f, 0.616337419f},
-std::array<float,2>{0.261458904f, 0.303338051f},
-std::array<float,2>{0.649300098f, 0.785657704f},
-std::array<float,2>{0.717936337f, 0.107252814f},
-std::array<float,2>{0.350149393f, 0.577627599f},
-std::array<float,2>{0.16785571f, 0.26322788f},
-std::array<float,2>{0.932628512f, 0.778098106f},
-std::array<float,2>{0.762087584f, 0.429080427f},
-std::array<float,2>{0.0896244496f, 0.931492269f},
-std::array<float,2>{0.380069911f, 0.140274197f},
-std::array<float,2>{0.541840613f, 0.663788974f},
-std::array<float,2>{0.578884304f, 0.334139109f},
-std::array<float,2>{0.484281838f, 0.858220816f},
-std::array<float,2>{0.0198267661f, 0.0340614282f},
-std::array<float,2>{0.841454148f, 0.519914985f},
-std::array<float,2>{0.962270141f, 0.216631219f},
-std::array<float,2>{0.203256235f, 0.691821814f},
-std::array<float,2>{0.306194007f, 0.469555587f},
-std::array<float,2>{0.681321323f, 0.970109761f},
-std::array<float,2>{0.525363564f, 0.163986921f},
-std::array<float,2>{0.417866349f, 0.630801618f},
-std::array<float,2>{0.109128945f, 0.390786082f},
-std::array<float,2>{0.807887793f, 0.883597434f},
-std::array<float,2>{0.887553692f, 0.311049223f},
-std::array<float,2>{0.148158431f, 0.790225625f},
-std::array<float,2>{0.330957234f, 0.0731928945f},
-std::array<float,2>{0.735063255f, 0.617995381f},
-std::array<float,2>{0.632499337f, 0.45081228f},
-std::array<float,2>{0.278193831f, 0.951952517f},
-std::array<float,2>{0.221781045f, 0.240913004f},
-std::array<float,2>{0.973566234f, 0.749183714f},
-std::array<float,2>{0.874529183f, 0.012010308f},
-std::array<float,2>{0.0419877097f, 0.532959342f},
-std::array<float,2>{0.445623606f, 0.349116325f},
-std::array<float,2>{0.620670795f, 0.825060248f},
-std::array<float,2>{0.609278262f, 0.0566455945f},
-std::array<float,2>{0.455248207f, 0.503960311f},
-std::array<float,2>{0.0489365794f, 0.319676399f},
-std::array<float,2>{0.85164994f, 0.861450493f},
-std::array<float,2>{0.999672174f, 0.498732954f},
-std::array<float,2>{0.240787819f, 0.993938446f},
-std::array<float,2>{0.26188466f, 0.196368963f},
-std::array<float,2>{0.65402478f, 0.709872007f},
-std::array<float,2>{0.719051957f, 0.279716969f},
-std::array<float,2>{0.323254585f, 0.761107087f},
-std::array<float,2>{0.130197018f, 0.114290394f},
-std::array<float,2>{0.90239197f, 0.58035183f},
-std::array<float,2>{0.787219405f, 0.146660447f},
-std::array<float,2>{0.112824894f, 0.674372375f},
-std::array<float,2>{0.429580867f, 0.412757456f},
-std::array<float,2>{0.514275074f, 0.91871506f},
-std::array<float,2>{0.660143256f, 0.230491281f},
-std::array<float,2>{0.294775933f, 0.729464412f},
-std::array<float,2>{0.194616288f, 0.466194987f},
-std::array<float,2>{0.939236701f, 0.953431189f},
-std::array<float,2>{0.819150507f, 0.367870599f},
-std::array<float,2>{0.0117265806f, 0.840313017f},
-std::array<float,2>{0.486900926f, 0.0206787232f},
-std::array<float,2>{0.565682948f, 0.560177565f},
-std::array<float,2>{0.552428603f, 0.389807105f},
-std::array<float,2>{0.3980515f, 0.896746457f},
-std::array<float,2>{0.0697324201f, 0.174676687f},
-std::array<float,2>{0.777766764f, 0.655884564f},
-std::array<float,2>{0.909872174f, 0.0785864964f},
-std::array<float,2>{0.183576688f, 0.59465158f},
-std::array<float,2>{0.372568697f, 0.2858513f},
-std::array<float,2>{0.692279756f, 0.806476533f},
-std::array<float,2>{0.641263783f, 0.0275293496f},
-std::array<float,2>{0.255530417f, 0.551709235f},
-std::array<float,2>{0.24652347f, 0.361716658f},
-std::array<float,2>{0.98662746f, 0.833795786f},
-std::array<float,2>{0.846641302f, 0.456492066f},
-std::array<float,2>{0.0576647408f, 0.965791106f},
-std::array<float,2>{0.46769172f, 0.220178872f},
-std::array<float,2>{0.598387539f, 0.723749518f},
-std::array<float,2>{0.500752091f, 0.294417769f},
-std::array<float,2>{0.430677086f, 0.798404455f},
-std::array<float,2>{0.118018426f, 0.0862517804f},
-std::array<float,2>{0.7908957f, 0.603524745f},
-std::array<float,2>{0.894567192f, 0.186391294f},
-std::array<float,2>{0.140365452f, 0.642462611f},
-std::array<float,2>{0.319014013f, 0.377095699f},
-std::array<float,2>{0.728490174f, 0.904868722f},
-std::array<float,2>{0.577686012f, 0.190198332f},
-std::array<float,2>{0.493531168f, 0.713549793f},
-std::array<float,2>{0.00292107067f, 0.486798167f},
-std::array<float,2>{0.82806319f, 0.986683488f},
-std::array<float,2>{0.949598014f, 0.320859671f},
-std::array<float,2>{0.199237347f, 0.867261767f},
-std::array<float,2>{0.286771178f, 0.0504476093f},
-std::array<float,2>{0.665248096f, 0.514059067f},
-std::array<float,2>{0.700555146f, 0.418366194f},
-std::array<float,2>{0.362832606f, 0.912814975f},
-std::array<float,2>{0.17722787f, 0.155293077f},
-std::array<float,2>{0.918143809f, 0.683398902f},
-std::array<float,2>{0.770569801f, 0.123810284f},
-std::array<float,2>{0.0730613098f, 0.591131389f},
-std::array<float,2>{0.400362611f, 0.271463245f},
-std::array<float,2>{0.559610486f, 0.753146291f},
-std::array<float,2>{0.537036002f, 0.0626469329f},
-std::array<float,2>{0.386443555f, 0.611988842f},
-std::array<float,2>{0.0785105601f, 0.300572425f},
-std::array<float,2>{0.756582558f, 0.782140255f},
-std::array<float,2>{0.923352897f, 0.40268141f},
-std::array<float,2>{0.162902236f, 0.88191539f},
-std::array<float,2>{0.357130557f, 0.164452955f},
-std::array<float,2>{0.709287584f, 0.638992846f},
-std::array<float,2>{0.672216356f, 0.351966351f},
-std::array<float,2>{0.304584354f, 0.816476107f},
-std::array<float,2>{0.21648474f, 0.00555627979f},
-std::array<float,2>{0.953287303f, 0.546572924f},
-std::array<float,2>{0.831027687f, 0.245875254f},
-std::array<float,2>{0.0240637101f, 0.735729098f},
-std::array<float,2>{0.471240819f, 0.439892828f},
-std::array<float,2>{0.586317182f, 0.937899292f},
-std::array<float,2>{0.744082928f, 0.132346064f},
-std::array<float,2>{0.337189794f, 0.671438515f},
-std::array<float,2>{0.153871268f, 0.433604091f},
-std::array<float,2>{0.876559913f, 0.927628458f},
-std::array<float,2>{0.801914632f, 0.253410101f},
-std::array<float,2>{0.100664914f, 0.765963197f},
-std::array<float,2>{0.413124889f, 0.0948981866f},
-std::array<float,2>{0.51669687f, 0.56883198f},
-std::array<float,2>{0.609819591f, 0.480593204f},
-std::array<float,2>{0.44083938f, 0.983735621f},
-std::array<float,2>{0.037510585f, 0.208959326f},
-std::array<float,2>{0.86087364f, 0.700683475f},
-std::array<float,2>{0.980799019f, 0.0441146195f},
-std::array<float,2>{0.232259408f, 0.52553463f},
-std::array<float,2>{0.267851263f, 0.337565482f},
-std::array<float,2>{0.635941923f, 0.847954214f},
-std::array<float,2>{0.732673168f, 0.0354983732f},
-std::array<float,2>{0.315780401f, 0.517262757f},
-std::array<float,2>{0.134112701f, 0.329719365f},
-std::array<float,2>{0.894319773f, 0.855051041f},
-std::array<float,2>{0.793159425f, 0.47540465f},
-std::array<float,2>{0.123267926f, 0.97382766f},
-std::array<float,2>{0.435673088f, 0.214784026f},
-std::array<float,2>{0.506403923f, 0.687504709f},
-std::array<float,2>{0.596290767f, 0.261593908f},
-std::array<float,2>{0.463590294f, 0.77420938f},
-std::array<float,2>{0.0604520477f, 0.105177671f},
-std::array<float,2>{0.849553823f, 0.572024286f},
-std::array<float,2>{0.992139518f, 0.133776471f},
-std::array<float,2>{0.245909587f, 0.659295201f},
-std::array<float,2>{0.251779407f, 0.423645824f},
-std::array<float,2>{0.646570861f, 0.935371935f},
-std::array<float,2>{0.557032228f, 0.236552432f},
-std::array<float,2>{0.403219759f, 0.744078338f},
-std::array<float,2>{0.0747567639f, 0.446155965f},
-std::array<float,2>{0.769512594f, 0.945724368f},
-std::array<float,2>{0.916552186f, 0.345764875f},
-std::array<float,2>{0.172086924f, 0.821986556f},
-std::array<float,2>{0.367005467f, 0.0088516539f},
-std::array<float,2>{0.697860837f, 0.53529948f},
-std::array<float,2>{0.669156849f, 0.395176977f},
-std::array<float,2>{0.284309626f, 0.887791395f},
-std::array<float,2>{0.195985749f, 0.158362463f},
-std::array<float,2>{0.945780396f, 0.625876784f},
-std::array<float,2>{0.821733534f, 0.0778202116f},
-std::array<float,2>{0.00438442128f, 0.6219064f},
-std::array<float,2>{0.498495072f, 0.307893544f},
-std::array<float,2>{0.573351502f, 0.796422958f},
-std::array<float,2>{0.590516567f, 0.111808643f},
-std::array<float,2>{0.474602073f, 0.582124054f},
-std::array<float,2>{0.0295318421f, 0.275773227f},
-std::array<float,2>{0.833338201f, 0.763514757f},
-std::array<float,2>{0.957718074f, 0.407842934f},
-std::array<float,2>{0.213992164f, 0.915969014f},
-std::array<float,2>{0.299680442f, 0.142108321f},
-std::array<float,2>{0.676841855f, 0.679025531f},
-std::array<float,2>{0.706703782f, 0.314566433f},
-std::array<float,2>{0.352128536f, 0.866074502f},
-std::array<float,2>{0.157803789f, 0.0619746335f},
-std::array<float,2>{0.929195702f, 0.500109375f},
-std::array<float,2>{0.753600955f, 0.201950505f},
-std::array<float,2>{0.0821917877f, 0.705175221f},
-std::array<float,2>{0.390017003f, 0.493120998f},
-std::array<float,2>{0.533960938f, 0.998426318f},
-std::array<float,2>{0.638426661f, 0.178632617f},
-std::array<float,2>{0.269685715f, 0.648999572f},
-std::array<float,2>{0.227562144f, 0.383863956f},
-std::array<float,2>{0.976583958f, 0.891999066f},
-std::array<float,2>{0.866387725f, 0.282896787f},
-std::array<float,2>{0.0335173346f, 0.811357498f},
-std::array<float,2>{0.443248272f, 0.084517546f},
-std::array<float,2>{0.615252912f, 0.600218177f},
-std::array<float,2>{0.52114743f, 0.463524133f},
-std::array<float,2>{0.407081038f, 0.957918644f},
-std::array<float,2>{0.0974627361f, 0.229806066f},
-std::array<float,2>{0.798318028f, 0.731389225f},
-std::array<float,2>{0.880241632f, 0.0193797071f},
-std::array<float,2>{0.152016371f, 0.556674302f},
-std::array<float,2>{0.34257403f, 0.373961717f},
-std::array<float,2>{0.747789621f, 0.839397132f},
-std::array<float,2>{0.683810949f, 0.0900624245f},
-std::array<float,2>{0.31178686f, 0.607775509f},
-std::array<float,2>{0.209830686f, 0.291104525f},
-std::array<float,2>{0.968589067f, 0.802925169f},
-std::array<float,2>{0.839834094f, 0.382737488f},
-std::array<float,2>{0.0178597141f, 0.900680602f},
-std::array<float,2>{0.477382332f, 0.180703893f},
-std::array<float,2>{0.583485723f, 0.646036088f},
-std::array<float,2>{0.546857715f, 0.364114374f},
-std::array<float,2>{0.376618177f, 0.831359327f},
-std::array<float,2>{0.0899824351f, 0.0260699447f},
-std::array<float,2>{0.7611655f, 0.549274445f},
-std::array<float,2>{0.936098695f, 0.224456519f},
-std::array<float,2>{0.169868127f, 0.721439123f},
-std::array<float,2>{0.34461242f, 0.459089637f},
-std::array<float,2>{0.713986814f, 0.962239504f},
-std::array<float,2>{0.622177958f, 0.150607005f},
-std::array<float,2>{0.451726407f, 0.685376823f},
-std::array<float,2>{0.0467893742f, 0.417172045f},
-std::array<float,2>{0.868339479f, 0.907647789f},
-std::array<float,2>{0.970448077f, 0.266190916f},
-std::array<float,2>{0.226374522f, 0.755252719f},
-std::array<float,2>{0.275082946f, 0.119411424f},
-std::array<float,2>{0.627175391f, 0.586908996f},
-std::array<float,2>{0.739516914f, 0.49090746f},
-std::array<float,2>{0.33299619f, 0.991725385f},
-std::array<float,2>{0.140973255f, 0.194253996f},
-std::array<float,2>{0.885700464f, 0.715399027f},
-std::array<float,2>{0.812296152f, 0.0521720052f},
-std::array<float,2>{0.105398342f, 0.510125041f},
-std::array<float,2>{0.420724541f, 0.326555997f},
-std::array<float,2>{0.528508365f, 0.871189773f},
-std::array<float,2>{0.508932292f, 0.00139748747f},
-std::array<float,2>{0.422198743f, 0.5400787f},
-std::array<float,2>{0.116147324f, 0.359029889f},
-std::array<float,2>{0.784751058f, 0.81424427f},
-std::array<float,2>{0.899056613f, 0.444985718f},
-std::array<float,2>{0.126234889f, 0.943989396f},
-std::array<float,2>{0.326824009f, 0.247144848f},
-std::array<float,2>{0.724586546f, 0.738817215f},
-std::array<float,2>{0.650678277f, 0.301344573f},
-std::array<float,2>{0.259097219f, 0.787836015f},
-std::array<float,2>{0.234790668f, 0.0665878132f},
-std::array<float,2>{0.994266689f, 0.613575697f},
-std::array<float,2>{0.855941236f, 0.171692222f},
-std::array<float,2>{0.0546115637f, 0.636482835f},
-std::array<float,2>{0.459186196f, 0.40097785f},
-std::array<float,2>{0.605008125f, 0.878195703f},
-std::array<float,2>{0.689972937f, 0.203757674f},
-std::array<float,2>{0.367473334f, 0.697426498f},
-std::array<float,2>{0.185093507f, 0.47866118f},
-std::array<float,2>{0.911347926f, 0.978862643f},
-std::array<float,2>{0.773765504f, 0.343472809f},
-std::array<float,2>{0.0637542233f, 0.844703853f},
-std::array<float,2>{0.394133508f, 0.0395482481f},
-std::array<float,2>{0.548681498f, 0.528936923f},
-std::array<float,2>{0.567585707f, 0.433097154f},
-std::array<float,2>{0.488650888f, 0.922745883f},
-std::array<float,2>{0.00939634908f, 0.126336053f},
-std::array<float,2>{0.812781394f, 0.665482581f},
-std::array<float,2>{0.942223191f, 0.100836895f},
-std::array<float,2>{0.190626115f, 0.565705895f},
-std::array<float,2>{0.292402536f, 0.257270932f},
-std::array<float,2>{0.660335481f, 0.771763146f},
-std::array<float,2>{0.721293628f, 0.11401321f},
-std::array<float,2>{0.320865422f, 0.58188349f},
-std::array<float,2>{0.131162539f, 0.280382216f},
-std::array<float,2>{0.906241179f, 0.760217309f},
-std::array<float,2>{0.785553813f, 0.413228422f},
-std::array<float,2>{0.110980235f, 0.919784367f},
-std::array<float,2>{0.426341951f, 0.147737682f},
-std::array<float,2>{0.512465239f, 0.675652623f},
-std::array<float,2>{0.606403768f, 0.318700939f},
-std::array<float,2>{0.454783916f, 0.862466156f},
-std::array<float,2>{0.0474587791f, 0.0579786859f},
-std::array<float,2>{0.854807019f, 0.505601108f},
-std::array<float,2>{0.996383786f, 0.195804343f},
-std::array<float,2>{0.240160644f, 0.710531652f},
-std::array<float,2>{0.264080286f, 0.499884874f},
-std::array<float,2>{0.655622482f, 0.992865026f},
-std::array<float,2>{0.554535031f, 0.175429717f},
-std::array<float,2>{0.396105051f, 0.65523535f},
-std::array<float,2>{0.0669726059f, 0.389041901f},
-std::array<float,2>{0.781021714f, 0.898029804f},
-std::array<float,2>{0.907891989f, 0.286606252f},
-std::array<float,2>{0.180739239f, 0.805447817f},
-std::array<float,2>{0.374966711f, 0.0796965063f},
-std::array<float,2>{0.694099367f, 0.594875038f},
-std::array<float,2>{0.657983899f, 0.465712309f},
-std::array<float,2>{0.296523809f, 0.9545241f},
-std::array<float,2>{0.191996127f, 0.232214361f},
-std::array<float,2>{0.940790772f, 0.730351925f},
-std::array<float,2>{0.816888154f, 0.0202899761f},
-std::array<float,2>{0.0155761549f, 0.55932802f},
-std::array<float,2>{0.486327738f, 0.368807584f},
-std::array<float,2>{0.564276755f, 0.841420233f},
-std::array<float,2>{0.581462562f, 0.0350039713f},
-std::array<float,2>{0.481899381f, 0.520613134f},
-std::array<float,2>{0.0225911494f, 0.335201979f},
-std::array<float,2>{0.841806054f, 0.858966768f},
-std::array<float,2>{0.964747488f, 0.470098495f},
-std::array<float,2>{0.206230253f, 0.968922079f},
-std::array<float,2>{0.308426797f, 0.21516569f},
-std::array<float,2>{0.682404459f, 0.692451894f},
-std::array<float,2>{0.71671474f, 0.262616098f},
-std::array<float,2>{0.34911871f, 0.779120445f},
-std::array<float,2>{0.164950296f, 0.105610095f},
-std::array<float,2>{0.931053519f, 0.576268077f},
-std::array<float,2>{0.764576614f, 0.139164403f},
-std::array<float,2>{0.0861387774f, 0.662892759f},
-std::array<float,2>{0.381310105f, 0.428662032f},
-std::array<float,2>{0.540145993f, 0.930201292f},
-std::array<float,2>{0.62947315f, 0.242022812f},
-std::array<float,2>{0.281126887f, 0.748905838f},
-std::array<float,2>{0.219899416f, 0.450076878f},
-std::array<float,2>{0.976532817f, 0.952493072f},
-std::array<float,2>{0.872901559f, 0.34849453f},
-std::array<float,2>{0.0394446515f, 0.826150656f},
-std::array<float,2>{0.44805035f, 0.012996912f},
-std::array<float,2>{0.618913889f, 0.531516075f},
-std::array<float,2>{0.526280582f, 0.392418683f},
-std::array<float,2>{0.415154815f, 0.883794606f},
-std::array<float,2>{0.105584018f, 0.162488371f},
-std::array<float,2>{0.806572318f, 0.629232168f},
-std::array<float,2>{0.889734924f, 0.0741753578f},
-std::array<float,2>{0.14585948f, 0.618335068f},
-std::array<float,2>{0.32908833f, 0.31234026f},
-std::array<float,2>{0.737468839f, 0.789796412f},
-std::array<float,2>{0.675728679f, 0.00418428611f},
-std::array<float,2>{0.301025361f, 0.545703709f},
-std::array<float,2>{0.218392238f, 0.352697641f},
-std::array<float,2>{0.956637025f, 0.817886412f},
-std::array<float,2>{0.828978419f, 0.441354275f},
-std::array<float,2>{0.0266264398f, 0.939062238f},
-std::array<float,2>{0.468907505f, 0.244279385f},
-std::array<float,2>{0.58869946f, 0.735023499f},
-std::array<float,2>{0.537788332f, 0.299174875f},
-std::array<float,2>{0.383860499f, 0.782378078f},
-std::array<float,2>{0.081968084f, 0.0639047548f},
-std::array<float,2>{0.754926801f, 0.613139987f},
-std::array<float,2>{0.924740553f, 0.165511161f},
-std::array<float,2>{0.160393372f, 0.640173435f},
-std::array<float,2>{0.358516991f, 0.403925836f},
-std::array<float,2>{0.708400249f, 0.881574929f},
-std::array<float,2>{0.612582684f, 0.207608476f},
-std::array<float,2>{0.439141691f, 0.6994012f},
-std::array<float,2>{0.0353742167f, 0.4822703f},
-std::array<float,2>{0.862801969f, 0.982616782f},
-std::array<float,2>{0.982802272f, 0.336237282f},
-std::array<float,2>{0.233990684f, 0.848762512f},
-std::array<float,2>{0.267125219f, 0.0434211381f},
-std::array<float,2>{0.633213043f, 0.526563168f},
-std::array<float,2>{0.74458307f, 0.435074389f},
-std::array<float,2>{0.338680863f, 0.926272035f},
-std::array<float,2>{0.155909345f, 0.131486654f},
-std::array<float,2>{0.87775147f, 0.67086494f},
-std::array<float,2>{0.802920401f, 0.0937528238f},
-std::array<float,2>{0.0987012163f, 0.569600403f},
-std::array<float,2>{0.41021958f, 0.252353311f},
-std::array<float,2>{0.51934123f, 0.767303228f},
-std::array<float,2>{0.503142178f, 0.087280035f},
-std::array<float,2>{0.431789041f, 0.605235398f},
-std::array<float,2>{0.119446509f, 0.293492377f},
-std::array<float,2>{0.792368829f, 0.797774017f},
-std::array<float,2>{0.897890449f, 0.378436565f},
-std::array<float,2>{0.138323247f, 0.906181574f},
-std::array<float,2>{0.31795752f, 0.186624929f},
-std::array<float,2>{0.729561925f, 0.640882373f},
-std::array<float,2>{0.642923415f, 0.362972319f},
-std::array<float,2>{0.255918652f, 0.832435668f},
-std::array<float,2>{0.249796882f, 0.0284009613f},
-std::array<float,2>{0.98462534f, 0.552586019f},
-std::array<float,2>{0.845365882f, 0.219389185f},
-std::array<float,2>{0.0564814061f, 0.722872555f},
-std::array<float,2>{0.466611952f, 0.456017405f},
-std::array<float,2>{0.60133183f, 0.966719031f},
-std::array<float,2>{0.702854335f, 0.155264586f},
-std::array<float,2>{0.360024691f, 0.682188988f},
-std::array<float,2>{0.178682551f, 0.419289172f},
-std::array<float,2>{0.920441628f, 0.914010227f},
-std::array<float,2>{0.772838056f, 0.270215034f},
-std::array<float,2>{0.0707371682f, 0.752713442f},
-std::array<float,2>{0.402324796f, 0.124221586f},
-std::array<float,2>{0.560578883f, 0.590066493f},
-std::array<float,2>{0.575457394f, 0.488051325f},
-std::array<float,2>{0.494447738f, 0.987890184f},
-std::array<float,2>{0.00137103477f, 0.191291288f},
-std::array<float,2>{0.82545954f, 0.714518011f},
-std::array<float,2>{0.951797307f, 0.0496251509f},
-std::array<float,2>{0.202393278f, 0.515580952f},
-std::array<float,2>{0.287318885f, 0.32201007f},
-std::array<float,2>{0.666189075f, 0.869020939f},
-std::array<float,2>{0.704913437f, 0.0613991655f},
-std::array<float,2>{0.353904694f, 0.501497865f},
-std::array<float,2>{0.158714682f, 0.316318005f},
-std::array<float,2>{0.926489055f, 0.866283357f},
-std::array<float,2>{0.750595033f, 0.49400574f},
-std::array<float,2>{0.0849547982f, 0.999031901f},
-std::array<float,2>{0.38724795f, 0.202754542f},
-std::array<float,2>{0.532601535f, 0.706740797f},
-std::array<float,2>{0.592476249f, 0.276848644f},
-std::array<float,2>{0.476509213f, 0.762001634f},
-std::array<float,2>{0.027516555f, 0.112723947f},
-std::array<float,2>{0.835470378f, 0.583298624f},
-std::array<float,2>{0.960087478f, 0.141223788f},
-std::array<float,2>{0.21286279f, 0.678299367f},
-std::array<float,2>{0.297111541f, 0.406936914f},
-std::array<float,2>{0.679141462f, 0.914153636f},
-std::array<float,2>{0.522946179f, 0.228880242f},
-std::array<float,2>{0.408445865f, 0.732082307f},
-std::array<float,2>{0.0951334909f, 0.46453163f},
-std::array<float,2>{0.799912393f, 0.958697975f},
-std::array<float,2>{0.882685542f, 0.374471068f},
-std::array<float,2>{0.150336996f, 0.837904274f},
-std::array<float,2>{0.340667546f, 0.0182948373f},
-std::array<float,2>{0.749503732f, 0.558476269f},
-std::array<float,2>{0.640077412f, 0.383757859f},
-std::array<float,2>{0.273068637f, 0.891349494f},
-std::array<float,2>{0.228562087f, 0.178767085f},
-std::array<float,2>{0.979304254f, 0.6503461f},
-std::array<float,2>{0.864610553f, 0.0855167061f},
-std::array<float,2>{0.0313318372f, 0.601551056f},
-std::array<float,2>{0.444381416f, 0.281783432f},
-std::array<float,2>{0.613990724f, 0.812464118f},
-std::array<float,2>{0.595448971f, 0.104246035f},
-std::array<float,2>{0.462275892f, 0.571083963f},
-std::array<float,2>{0.0605577603f, 0.259997129f},
-std::array<float,2>{0.850590944f, 0.774815917f},
-std::array<float,2>{0.989518881f, 0.422696263f},
-std::array<float,2>{0.243344426f, 0.933675349f},
-std::array<float,2>{0.25279665f, 0.134394392f},
-std::array<float,2>{0.645386457f, 0.659010231f},
-std::array<float,2>{0.731771827f, 0.328995824f},
-std::array<float,2>{0.312999904f, 0.854008198f},
-std::array<float,2>{0.136057049f, 0.0369780995f},
-std::array<float,2>{0.892272234f, 0.516466379f},
-std::array<float,2>{0.795918107f, 0.213042781f},
-std::array<float,2>{0.122462466f, 0.688959658f},
-std::array<float,2>{0.435539037f, 0.476087421f},
-std::array<float,2>{0.504714429f, 0.973589003f},
-std::array<float,2>{0.670790851f, 0.159810826f},
-std::array<float,2>{0.282907605f, 0.626421928f},
-std::array<float,2>{0.198863506f, 0.396023542f},
-std::array<float,2>{0.947885573f, 0.886730194f},
-std::array<float,2>{0.823326766f, 0.306882769f},
-std::array<float,2>{0.0076918113f, 0.795884788f},
-std::array<float,2>{0.497819245f, 0.077135928f},
-std::array<float,2>{0.571688414f, 0.622373164f},
-std::array<float,2>{0.555514395f, 0.447097272f},
-std::array<float,2>{0.405234039f, 0.946806669f},
-std::array<float,2>{0.0773787722f, 0.237983227f},
-std::array<float,2>{0.76674664f, 0.742503822f},
-std::array<float,2>{0.915962279f, 0.00855435245f},
-std::array<float,2>{0.175758362f, 0.536286771f},
-std::array<float,2>{0.364108503f, 0.347475171f},
-std::array<float,2>{0.697157562f, 0.820798218f},
-std::array<float,2>{0.649549484f, 0.0679411665f},
-std::array<float,2>{0.260286689f, 0.614599347f},
-std::array<float,2>{0.237659335f, 0.302134305f},
-std::array<float,2>{0.992352307f, 0.788892031f},
-std::array<float,2>{0.857584596f, 0.401436597f},
-std::array<float,2>{0.0517372452f, 0.877614319f},
-std::array<float,2>{0.457621813f, 0.170412242f},
-std::array<float,2>{0.602135658f, 0.635212243f},
-std::array<float,2>{0.510282457f, 0.357838541f},
-std::array<float,2>{0.424450964f, 0.81261903f},
-std::array<float,2>{0.113900401f, 0.000751422194f},
-std::array<float,2>{0.781509101f, 0.539884806f},
-std::array<float,2>{0.90153712f, 0.246181101f},
-std::array<float,2>{0.127012327f, 0.739749312f},
-std::array<float,2>{0.324265897f, 0.444205403f},
-std::array<float,2>{0.726264238f, 0.945010364f},
-std::array<float,2>{0.570302188f, 0.125339404f},
-std::array<float,2>{0.492013693f, 0.664418578f},
-std::array<float,2>{0.0115489429f, 0.431841463f},
-std::array<float,2>{0.814831793f, 0.923681736f},
-std::array<float,2>{0.945064306f, 0.256831348f},
-std::array<float,2>{0.188230097f, 0.773416519f},
-std::array<float,2>{0.290247321f, 0.0998695344f},
-std::array<float,2>{0.662491202f, 0.564601481f},
-std::array<float,2>{0.687985659f, 0.48009187f},
-std::array<float,2>{0.369772375f, 0.980234623f},
-std::array<float,2>{0.18632859f, 0.204149902f},
-std::array<float,2>{0.912306547f, 0.699180484f},
-std::array<float,2>{0.775498807f, 0.0404791459f},
-std::array<float,2>{0.0646597147f, 0.528227448f},
-std::array<float,2>{0.390769899f, 0.342430204f},
-std::array<float,2>{0.549716771f, 0.845670581f},
-std::array<float,2>{0.544621289f, 0.0265868753f},
-std::array<float,2>{0.377314419f, 0.549953759f},
-std::array<float,2>{0.0926726535f, 0.364823639f},
-std::array<float,2>{0.758957088f, 0.830883324f},
-std::array<float,2>{0.933675408f, 0.460171968f},
-std::array<float,2>{0.170769677f, 0.960957527f},
-std::array<float,2>{0.345945328f, 0.222672001f},
-std::array<float,2>{0.710966885f, 0.721993983f},
-std::array<float,2>{0.687067389f, 0.292843401f},
-std::array<float,2>{0.309706956f, 0.804246366f},
-std::array<float,2>{0.208887324f, 0.0910582021f},
-std::array<float,2>{0.965797603f, 0.609346747f},
-std::array<float,2>{0.837456584f, 0.180607826f},
-std::array<float,2>{0.0161527451f, 0.645111978f},
-std::array<float,2>{0.479948491f, 0.380859762f},
-std::array<float,2>{0.584615827f, 0.901577711f},
-std::array<float,2>{0.741497755f, 0.194344476f},
-std::array<float,2>{0.334590584f, 0.716274142f},
-std::array<float,2>{0.144504383f, 0.491988391f},
-std::array<float,2>{0.88387686f, 0.990312874f},
-std::array<float,2>{0.810282707f, 0.328074515f},
-std::array<float,2>{0.10314171f, 0.87243557f},
-std::array<float,2>{0.419897377f, 0.0508484915f},
-std::array<float,2>{0.529835641f, 0.511671662f},
-std::array<float,2>{0.623172104f, 0.416178972f},
-std::array<float,2>{0.449273497f, 0.906762302f},
-std::array<float,2>{0.0446529686f, 0.151740715f},
-std::array<float,2>{0.87055856f, 0.684385002f},
-std::array<float,2>{0.971761823f, 0.120686844f},
-std::array<float,2>{0.22341305f, 0.587406099f},
-std::array<float,2>{0.277096152f, 0.267122477f},
-std::array<float,2>{0.626249075f, 0.754870236f},
-std::array<float,2>{0.693352461f, 0.080080092f},
-std::array<float,2>{0.371652931f, 0.596781731f},
-std::array<float,2>{0.181923091f, 0.288157851f},
-std::array<float,2>{0.908227682f, 0.807133377f},
-std::array<float,2>{0.778449059f, 0.387972593f},
-std::array<float,2>{0.068935506f, 0.895725667f},
-std::array<float,2>{0.397403538f, 0.172746688f},
-std::array<float,2>{0.55153358f, 0.652927101f},
-std::array<float,2>{0.565379679f, 0.369351119f},
-std::array<float,2>{0.487892985f, 0.842118919f},
-std::array<float,2>{0.0128480997f, 0.0226100422f},
-std::array<float,2>{0.819960356f, 0.561815858f},
-std::array<float,2>{0.93752414f, 0.233749971f},
-std::array<float,2>{0.19363825f, 0.727688849f},
-std::array<float,2>{0.293684483f, 0.468064874f},
-std::array<float,2>{0.659159064f, 0.956640184f},
-std::array<float,2>{0.515052676f, 0.145388827f},
-std::array<float,2>{0.427943796f, 0.673269629f},
-std::array<float,2>{0.111547925f, 0.411758691f},
-std::array<float,2>{0.788864434f, 0.920741856f},
-std::array<float,2>{0.904247105f, 0.278585166f},
-std::array<float,2>{0.129078627f, 0.758825839f},
-std::array<float,2>{0.322556257f, 0.115525082f},
-std::array<float,2>{0.720346987f, 0.579799891f},
-std::array<float,2>{0.652565122f, 0.496273756f},
-std::array<float,2>{0.263316959f, 0.995627284f},
-std::array<float,2>{0.241500616f, 0.199116096f},
-std::array<float,2>{0.998398483f, 0.708490551f},
-std::array<float,2>{0.852707148f, 0.054691188f},
-std::array<float,2>{0.0504051447f, 0.506782115f},
-std::array<float,2>{0.456111789f, 0.31813392f},
-std::array<float,2>{0.607547343f, 0.859541357f},
-std::array<float,2>{0.619342208f, 0.013832638f},
-std::array<float,2>{0.446528912f, 0.534562051f},
-std::array<float,2>{0.042506136f, 0.351163775f},
-std::array<float,2>{0.873190582f, 0.826228499f},
-std::array<float,2>{0.974323153f, 0.45232445f},
-std::array<float,2>{0.220791683f, 0.950785935f},
-std::array<float,2>{0.279161543f, 0.23974964f},
-std::array<float,2>{0.631377101f, 0.746425152f},
-std::array<float,2>{0.735413373f, 0.30995962f},
-std::array<float,2>{0.331582308f, 0.792210817f},
-std::array<float,2>{0.147195563f, 0.070635356f},
-std::array<float,2>{0.88787812f, 0.619883716f},
-std::array<float,2>{0.807385743f, 0.161304772f},
-std::array<float,2>{0.107799865f, 0.632571101f},
-std::array<float,2>{0.416940093f, 0.392704338f},
-std::array<float,2>{0.524161816f, 0.88568306f},
-std::array<float,2>{0.680243552f, 0.21743843f},
-std::array<float,2>{0.305597782f, 0.694235146f},
-std::array<float,2>{0.20438385f, 0.47071588f},
-std::array<float,2>{0.961826384f, 0.971576035f},
-std::array<float,2>{0.840685785f, 0.333852589f},
-std::array<float,2>{0.020834513f, 0.855586529f},
-std::array<float,2>{0.48292762f, 0.0319864117f},
-std::array<float,2>{0.579910934f, 0.522248447f},
-std::array<float,2>{0.542653024f, 0.427100658f},
-std::array<float,2>{0.379529566f, 0.93304646f},
-std::array<float,2>{0.0887386277f, 0.13675034f},
-std::array<float,2>{0.763671279f, 0.660241306f},
-std::array<float,2>{0.931750417f, 0.107919693f},
-std::array<float,2>{0.166711077f, 0.575429857f},
-std::array<float,2>{0.350888461f, 0.264641494f},
-std::array<float,2>{0.717633843f, 0.78098315f},
-std::array<float,2>{0.635057211f, 0.0456779152f},
-std::array<float,2>{0.268906921f, 0.52538377f},
-std::array<float,2>{0.230473876f, 0.33926788f},
-std::array<float,2>{0.981621921f, 0.850851655f},
-std::array<float,2>{0.859908879f, 0.482546628f},
-std::array<float,2>{0.0390513912f, 0.981567264f},
-std::array<float,2>{0.439889461f, 0.209934875f},
-std::array<float,2>{0.61061281f, 0.701687992f},
-std::array<float,2>{0.516121686f, 0.250368178f},
-std::array<float,2>{0.412448674f, 0.768420577f},
-std::array<float,2>{0.0997664034f, 0.0958872363f},
-std::array<float,2>{0.801092803f, 0.567322135f},
-std::array<float,2>{0.875675321f, 0.129153222f},
-std::array<float,2>{0.152736232f, 0.668703377f},
-std::array<float,2>{0.336020768f, 0.436247438f},
-std::array<float,2>{0.742300034f, 0.928684711f},
-std::array<float,2>{0.587370753f, 0.243170291f},
-std::array<float,2>{0.472165734f, 0.737192333f},
-std::array<float,2>{0.0250928327f, 0.437800407f},
-std::array<float,2>{0.831203878f, 0.940028667f},
-std::array<float,2>{0.954607844f, 0.3539505f},
-std::array<float,2>{0.215697601f, 0.818920016f},
-std::array<float,2>{0.303639919f, 0.00625086622f},
-std::array<float,2>{0.673428714f, 0.543514848f},
-std::array<float,2>{0.710714638f, 0.404577643f},
-std::array<float,2>{0.356034577f, 0.880200028f},
-std::array<float,2>{0.163682699f, 0.167306706f},
-std::array<float,2>{0.921887696f, 0.63833946f},
-std::array<float,2>{0.756973207f, 0.0657780394f},
-std::array<float,2>{0.0791324675f, 0.610696733f},
-std::array<float,2>{0.385441065f, 0.298368156f},
-std::array<float,2>{0.535162091f, 0.78465271f},
-std::array<float,2>{0.558927894f, 0.122456834f},
-std::array<float,2>{0.398635775f, 0.592948318f},
-std::array<float,2>{0.073314473f, 0.273418993f},
-std::array<float,2>{0.76994884f, 0.751535892f},
-std::array<float,2>{0.919574201f, 0.420136034f},
-std::array<float,2>{0.176654026f, 0.911045551f},
-std::array<float,2>{0.361876845f, 0.152689442f},
-std::array<float,2>{0.699689865f, 0.680079281f},
-std::array<float,2>{0.664557874f, 0.32330364f},
-std::array<float,2>{0.285953581f, 0.869295776f},
-std::array<float,2>{0.200670898f, 0.0485067107f},
-std::array<float,2>{0.950873494f, 0.51322782f},
-std::array<float,2>{0.826703429f, 0.18941386f},
-std::array<float,2>{0.00387796434f, 0.711379528f},
-std::array<float,2>{0.492955238f, 0.486310959f},
-std::array<float,2>{0.576724648f, 0.985804498f},
-std::array<float,2>{0.72718364f, 0.184718773f},
-std::array<float,2>{0.319714278f, 0.642978847f},
-std::array<float,2>{0.139130369f, 0.375377476f},
-std::array<float,2>{0.896057248f, 0.903199434f},
-std::array<float,2>{0.789755464f, 0.295526624f},
-std::array<float,2>{0.118830845f, 0.800420046f},
-std::array<float,2>{0.430452079f, 0.0887977332f},
-std::array<float,2>{0.50116539f, 0.601870179f},
-std::array<float,2>{0.599151134f, 0.454179645f},
-std::array<float,2>{0.468678623f, 0.968567669f},
-std::array<float,2>{0.0576129109f, 0.22091566f},
-std::array<float,2>{0.847105742f, 0.724984109f},
-std::array<float,2>{0.988073468f, 0.0299114585f},
-std::array<float,2>{0.247205034f, 0.554192424f},
-std::array<float,2>{0.254337579f, 0.359490544f},
-std::array<float,2>{0.642515123f, 0.834781229f},
-std::array<float,2>{0.74696964f, 0.0160584189f},
-std::array<float,2>{0.34284988f, 0.555385053f},
-std::array<float,2>{0.150721282f, 0.371381253f},
-std::array<float,2>{0.879521191f, 0.836311519f},
-std::array<float,2>{0.797094882f, 0.462875098f},
-std::array<float,2>{0.0960628986f, 0.959879696f},
-std::array<float,2>{0.407475322f, 0.22801283f},
-std::array<float,2>{0.51969409f, 0.734198809f},
-std::array<float,2>{0.61647892f, 0.284152418f},
-std::array<float,2>{0.442147911f, 0.808796167f},
-std::array<float,2>{0.0344919823f, 0.0830470771f},
-std::array<float,2>{0.865543187f, 0.599390268f},
-std::array<float,2>{0.977696836f, 0.176633254f},
-std::array<float,2>{0.226838633f, 0.651132941f},
-std::array<float,2>{0.270774394f, 0.386040479f},
-std::array<float,2>{0.637360275f, 0.894380271f},
-std::array<float,2>{0.534552693f, 0.20107232f},
-std::array<float,2>{0.389274478f, 0.704250991f},
-std::array<float,2>{0.0833189264f, 0.495852649f},
-std::array<float,2>{0.752020895f, 0.99671793f},
-std::array<float,2>{0.928507268f, 0.313049167f},
-std::array<float,2>{0.156703964f, 0.864162445f},
-std::array<float,2>{0.352540404f, 0.0595955476f},
-std::array<float,2>{0.706052542f, 0.503485918f},
-std::array<float,2>{0.67589432f, 0.40901199f},
-std::array<float,2>{0.299850047f, 0.916247904f},
-std::array<float,2>{0.213746592f, 0.143337578f},
-std::array<float,2>{0.95812726f, 0.67671442f},
-std::array<float,2>{0.832134843f, 0.10970331f},
-std::array<float,2>{0.0304952916f, 0.584511161f},
-std::array<float,2>{0.472752452f, 0.275369883f},
-std::array<float,2>{0.591745198f, 0.764846325f},
-std::array<float,2>{0.572606325f, 0.0755525604f},
-std::array<float,2>{0.49971956f, 0.624937117f},
-std::array<float,2>{0.0050438703f, 0.306614578f},
-std::array<float,2>{0.821106851f, 0.794249356f},
-std::array<float,2>{0.94712615f, 0.3968288f},
-std::array<float,2>{0.196549878f, 0.88876754f},
-std::array<float,2>{0.283668548f, 0.156453729f},
-std::array<float,2>{0.668922544f, 0.627160013f},
-std::array<float,2>{0.698331654f, 0.344546676f},
-std::array<float,2>{0.365638107f, 0.822866857f},
-std::array<float,2>{0.17318961f, 0.0101422425f},
-std::array<float,2>{0.917147458f, 0.537710607f},
-std::array<float,2>{0.76837796f, 0.23544167f},
-std::array<float,2>{0.0755092353f, 0.745651186f},
-std::array<float,2>{0.403839886f, 0.447720379f},
-std::array<float,2>{0.558371007f, 0.947678983f},
-std::array<float,2>{0.647839546f, 0.135214403f},
-std::array<float,2>{0.250345588f, 0.658170402f},
-std::array<float,2>{0.244160563f, 0.424639791f},
-std::array<float,2>{0.990478396f, 0.937288344f},
-std::array<float,2>{0.848555088f, 0.258082777f},
-std::array<float,2>{0.0589268915f, 0.776492357f},
-std::array<float,2>{0.464432418f, 0.103399135f},
-std::array<float,2>{0.597501814f, 0.57359755f},
-std::array<float,2>{0.506860316f, 0.473274708f},
-std::array<float,2>{0.437048465f, 0.975839257f},
-std::array<float,2>{0.12491709f, 0.211964563f},
-std::array<float,2>{0.794618309f, 0.690227509f},
-std::array<float,2>{0.892896652f, 0.0385709628f},
-std::array<float,2>{0.132866576f, 0.518135726f},
-std::array<float,2>{0.314611316f, 0.33174026f},
-std::array<float,2>{0.733750343f, 0.852133989f},
-std::array<float,2>{0.661488652f, 0.0976727977f},
-std::array<float,2>{0.291164726f, 0.564449489f},
-std::array<float,2>{0.189955592f, 0.255120426f},
-std::array<float,2>{0.942826033f, 0.771087527f},
-std::array<float,2>{0.814007461f, 0.431319624f},
-std::array<float,2>{0.00794568658f, 0.924536526f},
-std::array<float,2>{0.490061224f, 0.127078548f},
-std::array<float,2>{0.56666398f, 0.666112304f},
-std::array<float,2>{0.547075689f, 0.340661824f},
-std::array<float,2>{0.39354527f, 0.846059561f},
-std::array<float,2>{0.0627881661f, 0.0422836356f},
-std::array<float,2>{0.775121629f, 0.530008018f},
-std::array<float,2>{0.910894394f, 0.205080286f},
-std::array<float,2>{0.183640257f, 0.696670532f},
-std::array<float,2>{0.369077414f, 0.47840938f},
-std::array<float,2>{0.690745473f, 0.977235615f},
-std::array<float,2>{0.604461253f, 0.169447705f},
-std::array<float,2>{0.460030556f, 0.634712219f},
-std::array<float,2>{0.0536815934f, 0.400170118f},
-std::array<float,2>{0.856907487f, 0.876856446f},
-std::array<float,2>{0.995500684f, 0.303877383f},
-std::array<float,2>{0.236054346f, 0.786371231f},
-std::array<float,2>{0.258395642f, 0.070147559f},
-std::array<float,2>{0.651545227f, 0.61571902f},
-std::array<float,2>{0.723445117f, 0.442691565f},
-std::array<float,2>{0.327504665f, 0.942383289f},
-std::array<float,2>{0.12505661f, 0.249344721f},
-std::array<float,2>{0.900307834f, 0.740244925f},
-std::array<float,2>{0.783886075f, 0.0031244799f},
-std::array<float,2>{0.116923615f, 0.542040408f},
-std::array<float,2>{0.422965199f, 0.356290191f},
-std::array<float,2>{0.508276999f, 0.815057099f},
-std::array<float,2>{0.527639866f, 0.0544324704f},
-std::array<float,2>{0.421361148f, 0.508265615f},
-std::array<float,2>{0.103854798f, 0.325506479f},
-std::array<float,2>{0.811087489f, 0.873281837f},
-std::array<float,2>{0.886212409f, 0.489458233f},
-std::array<float,2>{0.14178583f, 0.989046037f},
-std::array<float,2>{0.333772182f, 0.193149537f},
-std::array<float,2>{0.738417029f, 0.717917144f},
-std::array<float,2>{0.628285766f, 0.267776459f},
-std::array<float,2>{0.273502082f, 0.756014228f},
-std::array<float,2>{0.225254983f, 0.117617562f},
-std::array<float,2>{0.969421744f, 0.589571059f},
-std::array<float,2>{0.867697001f, 0.148458526f},
-std::array<float,2>{0.0455924235f, 0.68600136f},
-std::array<float,2>{0.452495337f, 0.414295495f},
-std::array<float,2>{0.621813297f, 0.908893943f},
-std::array<float,2>{0.71297586f, 0.225898996f},
-std::array<float,2>{0.345562398f, 0.719823241f},
-std::array<float,2>{0.168055162f, 0.457908779f},
-std::array<float,2>{0.937292695f, 0.963437557f},
-std::array<float,2>{0.760209382f, 0.365695715f},
-std::array<float,2>{0.0913975909f, 0.829633474f},
-std::array<float,2>{0.37516287f, 0.0250111762f},
-std::array<float,2>{0.545790672f, 0.548196673f},
-std::array<float,2>{0.582983732f, 0.379654229f},
-std::array<float,2>{0.478115439f, 0.900300503f},
-std::array<float,2>{0.0192591567f, 0.182628572f},
-std::array<float,2>{0.837951422f, 0.647504926f},
-std::array<float,2>{0.966918349f, 0.09257745f},
-std::array<float,2>{0.210134909f, 0.606248617f},
-std::array<float,2>{0.311200798f, 0.290950209f},
-std::array<float,2>{0.68472755f, 0.801314116f},
-std::array<float,2>{0.748483121f, 0.0833490491f},
-std::array<float,2>{0.340855628f, 0.599126995f},
-std::array<float,2>{0.149003774f, 0.283807546f},
-std::array<float,2>{0.880882978f, 0.809057295f},
-std::array<float,2>{0.799665749f, 0.385742635f},
-std::array<float,2>{0.0940654278f, 0.894247949f},
-std::array<float,2>{0.409465879f, 0.176279902f},
-std::array<float,2>{0.52189368f, 0.650883138f},
-std::array<float,2>{0.615207672f, 0.371272981f},
-std::array<float,2>{0.443440795f, 0.83610642f},
-std::array<float,2>{0.0331399478f, 0.015795473f},
-std::array<float,2>{0.863738f, 0.555451035f},
-std::array<float,2>{0.980091214f, 0.227610394f},
-std::array<float,2>{0.229889542f, 0.734089494f},
-std::array<float,2>{0.272287577f, 0.462463468f},
-std::array<float,2>{0.638770521f, 0.959526658f},
-std::array<float,2>{0.531355381f, 0.143259361f},
-std::array<float,2>{0.387878925f, 0.676433682f},
-std::array<float,2>{0.0850172266f, 0.408934087f},
-std::array<float,2>{0.751779139f, 0.91644454f},
-std::array<float,2>{0.927473962f, 0.275105029f},
-std::array<float,2>{0.159767747f, 0.764976442f},
-std::array<float,2>{0.354963899f, 0.109478883f},
-std::array<float,2>{0.703338385f, 0.584769726f},
-std::array<float,2>{0.678167045f, 0.495607823f},
-std::array<float,2>{0.298539788f, 0.996891022f},
-std::array<float,2>{0.211644709f, 0.200833052f},
-std::array<float,2>{0.95993185f, 0.70440644f},
-std::array<float,2>{0.834590256f, 0.0598202758f},
-std::array<float,2>{0.0291597061f, 0.503843367f},
-std::array<float,2>{0.474652857f, 0.313342154f},
-std::array<float,2>{0.592894852f, 0.863951921f},
-std::array<float,2>{0.570349336f, 0.00987910572f},
-std::array<float,2>{0.49623099f, 0.537971735f},
-std::array<float,2>{0.0060917642f, 0.344332963f},
-std::array<float,2>{0.82237196f, 0.823093712f},
-std::array<float,2>{0.94894141f, 0.447282583f},
-std::array<float,2>{0.197267339f, 0.947275937f},
-std::array<float,2>{0.282019824f, 0.235724151f},
-std::array<float,2>{0.671856761f, 0.746068239f},
-std::array<float,2>{0.696237564f, 0.306372344f},
-std::array<float,2>{0.364602178f, 0.793952882f},
-std::array<float,2>{0.174283117f, 0.0752036721f},
-std::array<float,2>{0.914683759f, 0.624617875f},
-std::array<float,2>{0.76632452f, 0.156719685f},
-std::array<float,2>{0.0765432566f, 0.627309442f},
-std::array<float,2>{0.405492634f, 0.396568805f},
-std::array<float,2>{0.555927098f, 0.889061809f},
-std::array<float,2>{0.64605695f, 0.212310955f},
-std::array<float,2>{0.253251851f, 0.690104306f},
-std::array<float,2>{0.243084058f, 0.473590255f},
-std::array<float,2>{0.988920391f, 0.975705087f},
-std::array<float,2>{0.85021925f, 0.331919938f},
-std::array<float,2>{0.0623453967f, 0.852365732f},
-std::array<float,2>{0.461066544f, 0.0383159779f},
-std::array<float,2>{0.594324887f, 0.518425882f},
-std::array<float,2>{0.505705059f, 0.42448023f},
-std::array<float,2>{0.434234202f, 0.937143624f},
-std::array<float,2>{0.122032277f, 0.134824976f},
-std::array<float,2>{0.795148313f, 0.657865703f},
-std::array<float,2>{0.891431153f, 0.103107534f},
-std::array<float,2>{0.135304585f, 0.573380113f},
-std::array<float,2>{0.314061582f, 0.258056432f},
-std::array<float,2>{0.731430233f, 0.776664913f},
-std::array<float,2>{0.663680375f, 0.0422081463f},
-std::array<float,2>{0.2895917f, 0.530272782f},
-std::array<float,2>{0.189345106f, 0.340408027f},
-std::array<float,2>{0.944295228f, 0.845932364f},
-std::array<float,2>{0.816167891f, 0.478054643f},
-std::array<float,2>{0.00978530664f, 0.977460504f},
-std::array<float,2>{0.490733057f, 0.205552429f},
-std::array<float,2>{0.568602085f, 0.696312726f},
-std::array<float,2>{0.549843192f, 0.25513801f},
-std::array<float,2>{0.392068535f, 0.771254897f},
-std::array<float,2>{0.0662680417f, 0.098011598f},
-std::array<float,2>{0.77711761f, 0.564038575f},
-std::array<float,2>{0.913114905f, 0.127301618f},
-std::array<float,2>{0.186628744f, 0.666279078f},
-std::array<float,2>{0.370880008f, 0.431419373f},
-std::array<float,2>{0.688503504f, 0.924602032f},
-std::array<float,2>{0.602584243f, 0.249025807f},
-std::array<float,2>{0.458201498f, 0.740698457f},
-std::array<float,2>{0.052427277f, 0.442550331f},
-std::array<float,2>{0.859227836f, 0.942653418f},
-std::array<float,2>{0.993534684f, 0.355981052f},
-std::array<float,2>{0.237193421f, 0.815198958f},
-std::array<float,2>{0.260988027f, 0.0031785199f},
-std::array<float,2>{0.648539662f, 0.542321503f},
-std::array<float,2>{0.72549206f, 0.399933249f},
-std::array<float,2>{0.326155812f, 0.876592338f},
-std::array<float,2>{0.128781974f, 0.169855669f},
-std::array<float,2>{0.901029348f, 0.634324014f},
-std::array<float,2>{0.783155859f, 0.0699696913f},
-std::array<float,2>{0.115195908f, 0.615345955f},
-std::array<float,2>{0.425769269f, 0.304088622f},
-std::array<float,2>{0.51107192f, 0.786564887f},
-std::array<float,2>{0.530989051f, 0.117374398f},
-std::array<float,2>{0.418240815f, 0.589842319f},
-std::array<float,2>{0.102282159f, 0.267888635f},
-std::array<float,2>{0.809070706f, 0.756216288f},
-std::array<float,2>{0.883592248f, 0.414310187f},
-std::array<float,2>{0.143486589f, 0.909130275f},
-std::array<float,2>{0.335898906f, 0.14878878f},
-std::array<float,2>{0.74026835f, 0.68572408f},
-std::array<float,2>{0.625745654f, 0.325210661f},
-std::array<float,2>{0.275969088f, 0.873413563f},
-std::array<float,2>{0.223984957f, 0.0545626283f},
-std::array<float,2>{0.970770717f, 0.507904947f},
-std::array<float,2>{0.86968565f, 0.193095893f},
-std::array<float,2>{0.0431302786f, 0.718084872f},
-std::array<float,2>{0.450215489f, 0.489557981f},
-std::array<float,2>{0.624812543f, 0.988864243f},
-std::array<float,2>{0.712013125f, 0.183085978f},
-std::array<float,2>{0.347629517f, 0.647914529f},
-std::array<float,2>{0.171505138f, 0.379627556f},
-std::array<float,2>{0.935467124f, 0.899948478f},
-std::array<float,2>{0.758361936f, 0.290753305f},
-std::array<float,2>{0.0935432017f, 0.801601768f},
-std::array<float,2>{0.378322899f, 0.0924705788f},
-std::array<float,2>{0.543199837f, 0.605994105f},
-std::array<float,2>{0.58564502f, 0.457715034f},
-std::array<float,2>{0.479462683f, 0.963815391f},
-std::array<float,2>{0.0169741008f, 0.225640148f},
-std::array<float,2>{0.836533546f, 0.720201552f},
-std::array<float,2>{0.96634382f, 0.025290601f},
-std::array<float,2>{0.20715788f, 0.54795593f},
-std::array<float,2>{0.309002608f, 0.36524269f},
-std::array<float,2>{0.686427712f, 0.830013514f},
-std::array<float,2>{0.694773078f, 0.022795571f},
-std::array<float,2>{0.373102129f, 0.561625838f},
-std::array<float,2>{0.180611476f, 0.369422376f},
-std::array<float,2>{0.906709731f, 0.841816664f},
-std::array<float,2>{0.779686093f, 0.467991263f},
-std::array<float,2>{0.0679247826f, 0.956844389f},
-std::array<float,2>{0.394543201f, 0.233551145f},
-std::array<float,2>{0.553592384f, 0.727790296f},
-std::array<float,2>{0.563191712f, 0.288358331f},
-std::array<float,2>{0.48493275f, 0.807591856f},
-std::array<float,2>{0.0144219035f, 0.0804221407f},
-std::array<float,2>{0.817742765f, 0.597088158f},
-std::array<float,2>{0.939948499f, 0.172443762f},
-std::array<float,2>{0.192866966f, 0.653196752f},
-std::array<float,2>{0.295006096f, 0.387793064f},
-std::array<float,2>{0.656493485f, 0.895966291f},
-std::array<float,2>{0.512768805f, 0.198739231f},
-std::array<float,2>{0.427430391f, 0.708069921f},
-std::array<float,2>{0.110228837f, 0.496569484f},
-std::array<float,2>{0.786652863f, 0.995932102f},
-std::array<float,2>{0.904498458f, 0.318058103f},
-std::array<float,2>{0.132353008f, 0.859669685f},
-std::array<float,2>{0.321948558f, 0.0550497212f},
-std::array<float,2>{0.721862137f, 0.506373823f},
-std::array<float,2>{0.654508114f, 0.412087142f},
-std::array<float,2>{0.264683753f, 0.920526147f},
-std::array<float,2>{0.238670528f, 0.145260498f},
-std::array<float,2>{0.997562528f, 0.672896802f},
-std::array<float,2>{0.854127944f, 0.115242518f},
-std::array<float,2>{0.0486596338f, 0.579919457f},
-std::array<float,2>{0.453531533f, 0.278475732f},
-std::array<float,2>{0.60709089f, 0.759055972f},
-std::array<float,2>{0.617404938f, 0.070516713f},
-std::array<float,2>{0.44906351f, 0.619700849f},
-std::array<float,2>{0.0409568846f, 0.309746683f},
-std::array<float,2>{0.87117821f, 0.792375743f},
-std::array<float,2>{0.974706292f, 0.392872214f},
-std::array<float,2>{0.21955806f, 0.8853181f},
-std::array<float,2>{0.279450238f, 0.161539227f},
-std::array<float,2>{0.630034268f, 0.632406652f},
-std::array<float,2>{0.737260103f, 0.351535499f},
-std::array<float,2>{0.329447389f, 0.826427519f},
-std::array<float,2>{0.144667804f, 0.0140588172f},
-std::array<float,2>{0.888926983f, 0.534338415f},
-std::array<float,2>{0.805634737f, 0.240042686f},
-std::array<float,2>{0.107215606f, 0.746115446f},
-std::array<float,2>{0.414558202f, 0.45251736f},
-std::array<float,2>{0.526524067f, 0.951034129f},
-std::array<float,2>{0.683338583f, 0.137194425f},
-std::array<float,2>{0.306783676f, 0.660474062f},
-std::array<float,2>{0.205551311f, 0.426780075f},
-std::array<float,2>{0.963133097f, 0.932840824f},
-std::array<float,2>{0.843399882f, 0.26420635f},
-std::array<float,2>{0.0217710137f, 0.781185627f},
-std::array<float,2>{0.481249601f, 0.108160555f},
-std::array<float,2>{0.58079648f, 0.575597167f},
-std::array<float,2>{0.539294064f, 0.471173137f},
-std::array<float,2>{0.381878674f, 0.971200943f},
-std::array<float,2>{0.0869684145f, 0.217593044f},
-std::array<float,2>{0.765335679f, 0.693888307f},
-std::array<float,2>{0.929827213f, 0.0318338946f},
-std::array<float,2>{0.165874094f, 0.522082567f},
-std::array<float,2>{0.347786903f, 0.333591431f},
-std::array<float,2>{0.715584815f, 0.855746806f},
-std::array<float,2>{0.634088159f, 0.0961278677f},
-std::array<float,2>{0.265975863f, 0.567103982f},
-std::array<float,2>{0.232967079f, 0.250056773f},
-std::array<float,2>{0.983746886f, 0.76828289f},
-std::array<float,2>{0.86182636f, 0.436367005f},
-std::array<float,2>{0.0364075378f, 0.928229213f},
-std::array<float,2>{0.437646776f, 0.129136771f},
-std::array<float,2>{0.611374617f, 0.668588459f},
-std::array<float,2>{0.518326938f, 0.339020699f},
-std::array<float,2>{0.41160512f, 0.850672781f},
-std::array<float,2>{0.0978908688f, 0.0455400012f},
-std::array<float,2>{0.804531097f, 0.524994731f},
-std::array<float,2>{0.878671348f, 0.209634125f},
-std::array<float,2>{0.155211762f, 0.702048779f},
-std::array<float,2>{0.338980645f, 0.482892215f},
-std::array<float,2>{0.745850921f, 0.981854379f},
-std::array<float,2>{0.589083731f, 0.16718626f},
-std::array<float,2>{0.470379204f, 0.638607919f},
-std::array<float,2>{0.0256781373f, 0.404471368f},
-std::array<float,2>{0.829491317f, 0.880089641f},
-std::array<float,2>{0.955779016f, 0.298728228f},
-std::array<float,2>{0.216868222f, 0.784413099f},
-std::array<float,2>{0.302152961f, 0.0655749142f},
-std::array<float,2>{0.674333632f, 0.61055547f},
-std::array<float,2>{0.707917631f, 0.437732816f},
-std::array<float,2>{0.357703447f, 0.940236032f},
-std::array<float,2>{0.161137521f, 0.243529111f},
-std::array<float,2>{0.925258756f, 0.736885428f},
-std::array<float,2>{0.754685581f, 0.00602842914f},
-std::array<float,2>{0.0806057453f, 0.543753505f},
-std::array<float,2>{0.383366227f, 0.353645772f},
-std::array<float,2>{0.538144529f, 0.819156051f},
-std::array<float,2>{0.56206423f, 0.0487521552f},
-std::array<float,2>{0.401132107f, 0.513499081f},
-std::array<float,2>{0.0716196448f, 0.323623329f},
-std::array<float,2>{0.771579921f, 0.869537711f},
-std::array<float,2>{0.921626389f, 0.486006588f},
-std::array<float,2>{0.179379672f, 0.985498726f},
-std::array<float,2>{0.360967606f, 0.189202502f},
-std::array<float,2>{0.701509356f, 0.711091518f},
-std::array<float,2>{0.667872727f, 0.27311489f},
-std::array<float,2>{0.288412213f, 0.751936376f},
-std::array<float,2>{0.201656282f, 0.122281365f},
-std::array<float,2>{0.953108907f, 0.593174994f},
-std::array<float,2>{0.824236572f, 0.152496636f},
-std::array<float,2>{0.000260209606f, 0.679804921f},
-std::array<float,2>{0.495131254f, 0.420393646f},
-std::array<float,2>{0.574629724f, 0.910848737f},
-std::array<float,2>{0.728809357f, 0.221016362f},
-std::array<float,2>{0.316618145f, 0.724812865f},
-std::array<float,2>{0.137160599f, 0.454373181f},
-std::array<float,2>{0.897368789f, 0.968270063f},
-std::array<float,2>{0.791839063f, 0.359704107f},
-std::array<float,2>{0.120331034f, 0.834674895f},
-std::array<float,2>{0.432959557f, 0.0301948525f},
-std::array<float,2>{0.501981437f, 0.553872764f},
-std::array<float,2>{0.599949658f, 0.375233829f},
-std::array<float,2>{0.465346962f, 0.902952611f},
-std::array<float,2>{0.0548398793f, 0.184992701f},
-std::array<float,2>{0.843978405f, 0.642698765f},
-std::array<float,2>{0.986292183f, 0.0884205177f},
-std::array<float,2>{0.248092175f, 0.601749659f},
-std::array<float,2>{0.257076025f, 0.295698851f},
-std::array<float,2>{0.644472241f, 0.800634503f},
-std::array<float,2>{0.706111193f, 0.112335309f},
-std::array<float,2>{0.351771563f, 0.583010375f},
-std::array<float,2>{0.157243431f, 0.276405871f},
-std::array<float,2>{0.929358065f, 0.761846364f},
-std::array<float,2>{0.753157139f, 0.407084584f},
-std::array<float,2>{0.0826990828f, 0.914477527f},
-std::array<float,2>{0.390460253f, 0.141496643f},
-std::array<float,2>{0.533492088f, 0.678538859f},
-std::array<float,2>{0.590158284f, 0.316034406f},
-std::array<float,2>{0.47385034f, 0.866555154f},
-std::array<float,2>{0.0301577672f, 0.061086785f},
-std::array<float,2>{0.833661318f, 0.501941025f},
-std::array<float,2>{0.957299411f, 0.202920482f},
-std::array<float,2>{0.214443877f, 0.706924975f},
-std::array<float,2>{0.299217254f, 0.493735105f},
-std::array<float,2>{0.677391708f, 0.99940598f},
-std::array<float,2>{0.520745933f, 0.179088175f},
-std::array<float,2>{0.406688392f, 0.650006533f},
-std::array<float,2>{0.0971254408f, 0.383360624f},
-std::array<float,2>{0.798416018f, 0.8914361f},
-std::array<float,2>{0.880625606f, 0.282061547f},
-std::array<float,2>{0.151526958f, 0.812068164f},
-std::array<float,2>{0.342201769f, 0.0859031007f},
-std::array<float,2>{0.747481465f, 0.60123843f},
-std::array<float,2>{0.637949646f, 0.464748144f},
-std::array<float,2>{0.270292819f, 0.958806515f},
-std::array<float,2>{0.228202268f, 0.22859633f},
-std::array<float,2>{0.97742033f, 0.73227185f},
-std::array<float,2>{0.867147148f, 0.0184507724f},
-std::array<float,2>{0.0337290876f, 0.55822593f},
-std::array<float,2>{0.44240135f, 0.374056071f},
-std::array<float,2>{0.616096139f, 0.838327169f},
-std::array<float,2>{0.595852315f, 0.0367370993f},
-std::array<float,2>{0.463092029f, 0.516270041f},
-std::array<float,2>{0.0597530715f, 0.328710496f},
-std::array<float,2>{0.848868549f, 0.854408622f},
-std::array<float,2>{0.991562426f, 0.476320833f},
-std::array<float,2>{0.245458543f, 0.973166406f},
-std::array<float,2>{0.251428276f, 0.213342384f},
-std::array<float,2>{0.647341549f, 0.688599229f},
-std::array<float,2>{0.732991159f, 0.260019273f},
-std::array<float,2>{0.316076696f, 0.774555147f},
-std::array<float,2>{0.134624079f, 0.104274467f},
-std::array<float,2>{0.893770933f, 0.570915103f},
-std::array<float,2>{0.793505609f, 0.134521604f},
-std::array<float,2>{0.123637527f, 0.658712089f},
-std::array<float,2>{0.43620038f, 0.422406077f},
-std::array<float,2>{0.506305099f, 0.933873057f},
-std::array<float,2>{0.669730604f, 0.238219887f},
-std::array<float,2>{0.285063833f, 0.742209136f},
-std::array<float,2>{0.195679307f, 0.446848035f},
-std::array<float,2>{0.946055233f, 0.947129548f},
-std::array<float,2>{0.821897805f, 0.347355574f},
-std::array<float,2>{0.00442331377f, 0.820422411f},
-std::array<float,2>{0.49866128f, 0.00844453834f},
-std::array<float,2>{0.574038804f, 0.536481619f},
-std::array<float,2>{0.557264984f, 0.396357238f},
-std::array<float,2>{0.402545661f, 0.887016952f},
-std::array<float,2>{0.0742688924f, 0.160056904f},
-std::array<float,2>{0.769030452f, 0.625979245f},
-std::array<float,2>{0.916239381f, 0.0768530816f},
-std::array<float,2>{0.172830045f, 0.622102976f},
-std::array<float,2>{0.366432726f, 0.307088047f},
-std::array<float,2>{0.697530925f, 0.795521498f},
-std::array<float,2>{0.651147008f, 0.000637861667f},
-std::array<float,2>{0.25958541f, 0.539657831f},
-std::array<float,2>{0.235152096f, 0.357561827f},
-std::array<float,2>{0.995038629f, 0.812831283f},
-std::array<float,2>{0.856181979f, 0.444048464f},
-std::array<float,2>{0.053793788f, 0.945142269f},
-std::array<float,2>{0.459640682f, 0.246478468f},
-std::array<float,2>{0.604518771f, 0.740146637f},
-std::array<float,2>{0.509664357f, 0.301962644f},
-std::array<float,2>{0.422490448f, 0.788735628f},
-std::array<float,2>{0.115478396f, 0.0681751072f},
-std::array<float,2>{0.784296036f, 0.61446476f},
-std::array<float,2>{0.898729682f, 0.170746699f},
-std::array<float,2>{0.126564145f, 0.634975672f},
-std::array<float,2>{0.326291054f, 0.401830941f},
-std::array<float,2>{0.724082947f, 0.877813756f},
-std::array<float,2>{0.568125725f, 0.204393819f},
-std::array<float,2>{0.489157617f, 0.698831737f},
-std::array<float,2>{0.00920377392f, 0.480439484f},
-std::array<float,2>{0.813141644f, 0.980041564f},
-std::array<float,2>{0.941583097f, 0.342564732f},
-std::array<float,2>{0.191398963f, 0.845404804f},
-std::array<float,2>{0.292854935f, 0.0402380005f},
-std::array<float,2>{0.66064918f, 0.527865946f},
-std::array<float,2>{0.689527571f, 0.431955993f},
-std::array<float,2>{0.367740035f, 0.923544466f},
-std::array<float,2>{0.185008258f, 0.125139683f},
-std::array<float,2>{0.911972165f, 0.664205015f},
-std::array<float,2>{0.77396363f, 0.0996980444f},
-std::array<float,2>{0.0640639737f, 0.56474638f},
-std::array<float,2>{0.393968403f, 0.256399542f},
-std::array<float,2>{0.548043191f, 0.773028135f},
-std::array<float,2>{0.545956075f, 0.0913010761f},
-std::array<float,2>{0.376218677f, 0.608914554f},
-std::array<float,2>{0.090676479f, 0.29269436f},
-std::array<float,2>{0.761245131f, 0.804599285f},
-std::array<float,2>{0.935949147f, 0.381284684f},
-std::array<float,2>{0.169086337f, 0.901802421f},
-std::array<float,2>{0.343977809f, 0.180415407f},
-std::array<float,2>{0.714402378f, 0.645331264f},
-std::array<float,2>{0.684234798f, 0.365084052f},
-std::array<float,2>{0.312350631f, 0.830665708f},
-std::array<float,2>{0.209032655f, 0.026738273f},
-std::array<float,2>{0.967957556f, 0.550281823f},
-std::array<float,2>{0.839137137f, 0.222992629f},
-std::array<float,2>{0.0183683168f, 0.721788228f},
-std::array<float,2>{0.476684928f, 0.460388839f},
-std::array<float,2>{0.583936512f, 0.961402476f},
-std::array<float,2>{0.739899755f, 0.151472196f},
-std::array<float,2>{0.332344949f, 0.684279442f},
-std::array<float,2>{0.141488776f, 0.416420609f},
-std::array<float,2>{0.885175228f, 0.907205105f},
-std::array<float,2>{0.81163156f, 0.26754272f},
-std::array<float,2>{0.104961626f, 0.754458785f},
-std::array<float,2>{0.420151502f, 0.121026322f},
-std::array<float,2>{0.529073358f, 0.587852895f},
-std::array<float,2>{0.622601986f, 0.4919146f},
-std::array<float,2>{0.45117411f, 0.990563393f},
-std::array<float,2>{0.046045091f, 0.194694027f},
-std::array<float,2>{0.868739665f, 0.71586591f},
-std::array<float,2>{0.969765306f, 0.0511819944f},
-std::array<float,2>{0.22566022f, 0.511454344f},
-std::array<float,2>{0.274654418f, 0.327822059f},
-std::array<float,2>{0.627856374f, 0.872181296f},
-std::array<float,2>{0.719612539f, 0.0578363165f},
-std::array<float,2>{0.323865473f, 0.505695999f},
-std::array<float,2>{0.130672082f, 0.318576276f},
-std::array<float,2>{0.903306365f, 0.862785876f},
-std::array<float,2>{0.787695646f, 0.499595672f},
-std::array<float,2>{0.112538777f, 0.993011951f},
-std::array<float,2>{0.428874254f, 0.196203813f},
-std::array<float,2>{0.514039338f, 0.710786045f},
-std::array<float,2>{0.608481109f, 0.280754387f},
-std::array<float,2>{0.455969721f, 0.759943902f},
-std::array<float,2>{0.0498041436f, 0.114257045f},
-std::array<float,2>{0.852411389f, 0.581588864f},
-std::array<float,2>{0.999044955f, 0.147578269f},
-std::array<float,2>{0.240437835f, 0.675475359f},
-std::array<float,2>{0.262652069f, 0.413356364f},
-std::array<float,2>{0.653505921f, 0.919451118f},
-std::array<float,2>{0.551941335f, 0.23206602f},
-std::array<float,2>{0.397720814f, 0.730164945f},
-std::array<float,2>{0.0701551065f, 0.465483516f},
-std::array<float,2>{0.77808404f, 0.954322815f},
-std::array<float,2>{0.909220576f, 0.369008273f},
-std::array<float,2>{0.182830721f, 0.841784239f},
-std::array<float,2>{0.372429967f, 0.0200599954f},
-std::array<float,2>{0.691488266f, 0.559134662f},
-std::array<float,2>{0.659570098f, 0.388788998f},
-std::array<float,2>{0.294001698f, 0.898233294f},
-std::array<float,2>{0.195120424f, 0.175780341f},
-std::array<float,2>{0.938559592f, 0.654894233f},
-std::array<float,2>{0.81876415f, 0.0799500793f},
-std::array<float,2>{0.0124014569f, 0.59502393f},
-std::array<float,2>{0.48638019f, 0.286221415f},
-std::array<float,2>{0.566046655f, 0.805309415f},
-std::array<float,2>{0.578512788f, 0.105764851f},
-std::array<float,2>{0.48351419f, 0.576645672f},
-std::array<float,2>{0.0204880629f, 0.262238324f},
-std::array<float,2>{0.841265798f, 0.779048324f},
-std::array<float,2>{0.962684035f, 0.428277522f},
-std::array<float,2>{0.203719258f, 0.93051821f},
-std::array<float,2>{0.306139588f, 0.139405489f},
-std::array<float,2>{0.680912971f, 0.662652731f},
-std::array<float,2>{0.718726158f, 0.33535102f},
-std::array<float,2>{0.349650949f, 0.859215796f},
-std::array<float,2>{0.167213604f, 0.034859512f},
-std::array<float,2>{0.933392525f, 0.520952463f},
-std::array<float,2>{0.762214601f, 0.21502398f},
-std::array<float,2>{0.0891302377f, 0.692842782f},
-std::array<float,2>{0.38052696f, 0.469731838f},
-std::array<float,2>{0.541486919f, 0.969036281f},
-std::array<float,2>{0.632068992f, 0.162113324f},
-std::array<float,2>{0.277575016f, 0.628992438f},
-std::array<float,2>{0.222338557f, 0.392176718f},
-std::array<float,2>{0.972901583f, 0.884055018f},
-std::array<float,2>{0.874247611f, 0.312033206f},
-std::array<float,2>{0.0414319411f, 0.789663374f},
-std::array<float,2>{0.445876092f, 0.0738435686f},
-std::array<float,2>{0.620306432f, 0.618544817f},
-std::array<float,2>{0.524543405f, 0.449803054f},
-std::array<float,2>{0.417264849f, 0.952162862f},
-std::array<float,2>{0.108665384f, 0.241870984f},
-std::array<float,2>{0.808539748f, 0.748720407f},
-std::array<float,2>{0.886864126f, 0.0127085736f},
-std::array<float,2>{0.147499979f, 0.531456649f},
-std::array<float,2>{0.330177575f, 0.348200977f},
-std::array<float,2>{0.734624863f, 0.825862467f},
-std::array<float,2>{0.67266947f, 0.0636915118f},
-std::array<float,2>{0.303775698f, 0.612992048f},
-std::array<float,2>{0.216257647f, 0.298959166f},
-std::array<float,2>{0.953950167f, 0.782580435f},
-std::array<float,2>{0.830105484f, 0.4041785f},
-std::array<float,2>{0.0236256011f, 0.881753206f},
-std::array<float,2>{0.470801502f, 0.165131435f},
-std::array<float,2>{0.586522818f, 0.640522182f},
-std::array<float,2>{0.53645581f, 0.352950454f},
-std::array<float,2>{0.385971665f, 0.818268776f},
-std::array<float,2>{0.0789963529f, 0.00410452345f},
-std::array<float,2>{0.756159425f, 0.545608521f},
-std::array<float,2>{0.923172534f, 0.244598731f},
-std::array<float,2>{0.162190586f, 0.735209942f},
-std::array<float,2>{0.356848538f, 0.440938652f},
-std::array<float,2>{0.70988971f, 0.939423382f},
-std::array<float,2>{0.610014379f, 0.131661862f},
-std::array<float,2>{0.441365808f, 0.670628786f},
-std::array<float,2>{0.0377910286f, 0.435503542f},
-std::array<float,2>{0.86069119f, 0.926553667f},
-std::array<float,2>{0.981318891f, 0.252146542f},
-std::array<float,2>{0.231894359f, 0.767477095f},
-std::array<float,2>{0.268359482f, 0.0941521749f},
-std::array<float,2>{0.636549473f, 0.569545865f},
-std::array<float,2>{0.743175268f, 0.482167363f},
-std::array<float,2>{0.337778628f, 0.982795596f},
-std::array<float,2>{0.153432697f, 0.20795311f},
-std::array<float,2>{0.875987291f, 0.699544609f},
-std::array<float,2>{0.802350581f, 0.0431393608f},
-std::array<float,2>{0.101265267f, 0.526813865f},
-std::array<float,2>{0.413935363f, 0.33601132f},
-std::array<float,2>{0.517428756f, 0.849065363f},
-std::array<float,2>{0.500167906f, 0.0287770461f},
-std::array<float,2>{0.431395531f, 0.552469909f},
-std::array<float,2>{0.117449f, 0.36323157f},
-std::array<float,2>{0.79031229f, 0.832262874f},
-std::array<float,2>{0.895441353f, 0.455775082f},
-std::array<float,2>{0.139864892f, 0.966382444f},
-std::array<float,2>{0.3183662f, 0.219617128f},
-std::array<float,2>{0.727574825f, 0.723004401f},
-std::array<float,2>{0.641037822f, 0.293842942f},
-std::array<float,2>{0.255362391f, 0.797431946f},
-std::array<float,2>{0.246825188f, 0.086961776f},
-std::array<float,2>{0.987062752f, 0.605174243f},
-std::array<float,2>{0.845755696f, 0.18679367f},
-std::array<float,2>{0.0582652241f, 0.640770853f},
-std::array<float,2>{0.46698603f, 0.378885716f},
-std::array<float,2>{0.598065853f, 0.90587616f},
-std::array<float,2>{0.700722694f, 0.191158876f},
-std::array<float,2>{0.362598121f, 0.714779139f},
-std::array<float,2>{0.177294493f, 0.488030225f},
-std::array<float,2>{0.91894418f, 0.988253713f},
-std::array<float,2>{0.77135843f, 0.322085887f},
-std::array<float,2>{0.0726651102f, 0.868823111f},
-std::array<float,2>{0.399512917f, 0.049538862f},
-std::array<float,2>{0.560265303f, 0.515175998f},
-std::array<float,2>{0.57752192f, 0.419014454f},
-std::array<float,2>{0.493813038f, 0.913781345f},
-std::array<float,2>{0.00213633152f, 0.154795304f},
-std::array<float,2>{0.827153087f, 0.682438374f},
-std::array<float,2>{0.949783921f, 0.124510877f},
-std::array<float,2>{0.199884996f, 0.590120554f},
-std::array<float,2>{0.286434948f, 0.270347923f},
-std::array<float,2>{0.665885389f, 0.752519727f},
-std::array<float,2>{0.732339382f, 0.105464511f},
-std::array<float,2>{0.312669545f, 0.571802616f},
-std::array<float,2>{0.136489838f, 0.261425585f},
-std::array<float,2>{0.891892731f, 0.773935497f},
-std::array<float,2>{0.796734333f, 0.423489243f},
-std::array<float,2>{0.122854449f, 0.935278773f},
-std::array<float,2>{0.434950888f, 0.133471668f},
-std::array<float,2>{0.504151344f, 0.659496605f},
-std::array<float,2>{0.594896913f, 0.329877317f},
-std::array<float,2>{0.462402493f, 0.855427563f},
-std::array<float,2>{0.0613013431f, 0.0353392474f},
-std::array<float,2>{0.851552486f, 0.51747936f},
-std::array<float,2>{0.990025759f, 0.214580119f},
-std::array<float,2>{0.243951216f, 0.687782764f},
-std::array<float,2>{0.252023906f, 0.47533825f},
-std::array<float,2>{0.644686162f, 0.974073827f},
-std::array<float,2>{0.555000126f, 0.158449978f},
-std::array<float,2>{0.404527158f, 0.625721157f},
-std::array<float,2>{0.0778545663f, 0.395428061f},
-std::array<float,2>{0.767407775f, 0.888144851f},
-std::array<float,2>{0.915202498f, 0.307823598f},
-std::array<float,2>{0.175148785f, 0.796660304f},
-std::array<float,2>{0.363290101f, 0.0780327097f},
-std::array<float,2>{0.696417391f, 0.621730208f},
-std::array<float,2>{0.670009553f, 0.446029276f},
-std::array<float,2>{0.28248626f, 0.945334017f},
-std::array<float,2>{0.198586524f, 0.236704558f},
-std::array<float,2>{0.947306812f, 0.743661642f},
-std::array<float,2>{0.823771179f, 0.00904922187f},
-std::array<float,2>{0.00725142006f, 0.535536885f},
-std::array<float,2>{0.497244924f, 0.346073806f},
-std::array<float,2>{0.572243989f, 0.822168589f},
-std::array<float,2>{0.59212631f, 0.0616067052f},
-std::array<float,2>{0.476047307f, 0.500438452f},
-std::array<float,2>{0.028027175f, 0.314901292f},
-std::array<float,2>{0.835344791f, 0.865873337f},
-std::array<float,2>{0.960677862f, 0.492860943f},
-std::array<float,2>{0.212394491f, 0.998186827f},
-std::array<float,2>{0.297429025f, 0.201760083f},
-std::array<float,2>{0.679382861f, 0.705419838f},
-std::array<float,2>{0.704488099f, 0.275492579f},
-std::array<float,2>{0.354083031f, 0.76320529f},
-std::array<float,2>{0.158225343f, 0.111523867f},
-std::array<float,2>{0.925845444f, 0.582495511f},
-std::array<float,2>{0.750312567f, 0.142398268f},
-std::array<float,2>{0.0844377875f, 0.678874075f},
-std::array<float,2>{0.387003422f, 0.408198595f},
-std::array<float,2>{0.533133328f, 0.915530503f},
-std::array<float,2>{0.640207589f, 0.229733869f},
-std::array<float,2>{0.272531897f, 0.730979204f},
-std::array<float,2>{0.229057461f, 0.463734597f},
-std::array<float,2>{0.978791535f, 0.957543254f},
-std::array<float,2>{0.864979088f, 0.373746008f},
-std::array<float,2>{0.0321208052f, 0.839730144f},
-std::array<float,2>{0.445039302f, 0.0191999096f},
-std::array<float,2>{0.613661349f, 0.556980669f},
-std::array<float,2>{0.523401201f, 0.384076476f},
-std::array<float,2>{0.408968359f, 0.891821444f},
-std::array<float,2>{0.0955015421f, 0.178265542f},
-std::array<float,2>{0.800510943f, 0.649311781f},
-std::array<float,2>{0.88215065f, 0.0847206637f},
-std::array<float,2>{0.149687842f, 0.600384653f},
-std::array<float,2>{0.34020716f, 0.283095121f},
-std::array<float,2>{0.749608815f, 0.811172068f},
-std::array<float,2>{0.686926126f, 0.0261284187f},
-std::array<float,2>{0.310281575f, 0.548965991f},
-std::array<float,2>{0.20816496f, 0.363907635f},
-std::array<float,2>{0.965225399f, 0.831102431f},
-std::array<float,2>{0.836976528f, 0.459360898f},
-std::array<float,2>{0.0158954151f, 0.961990535f},
-std::array<float,2>{0.479981661f, 0.224147215f},
-std::array<float,2>{0.584165394f, 0.721270978f},
-std::array<float,2>{0.54418236f, 0.291399568f},
-std::array<float,2>{0.377818555f, 0.803068101f},
-std::array<float,2>{0.0920220464f, 0.090131022f},
-std::array<float,2>{0.759559095f, 0.607433796f},
-std::array<float,2>{0.934105337f, 0.181089923f},
-std::array<float,2>{0.170345202f, 0.646327734f},
-std::array<float,2>{0.346588969f, 0.382354587f},
-std::array<float,2>{0.711511552f, 0.900566459f},
-std::array<float,2>{0.623932719f, 0.193851784f},
-std::array<float,2>{0.449801713f, 0.715768456f},
-std::array<float,2>{0.0442825221f, 0.491080642f},
-std::array<float,2>{0.870805442f, 0.991950035f},
-std::array<float,2>{0.972555459f, 0.326252639f},
-std::array<float,2>{0.222747013f, 0.871401906f},
-std::array<float,2>{0.276465207f, 0.0518290997f},
-std::array<float,2>{0.626600564f, 0.509969532f},
-std::array<float,2>{0.742087066f, 0.417236388f},
-std::array<float,2>{0.334023833f, 0.907308638f},
-std::array<float,2>{0.143736675f, 0.150873795f},
-std::array<float,2>{0.884629369f, 0.685083508f},
-std::array<float,2>{0.809671223f, 0.119290605f},
-std::array<float,2>{0.102810971f, 0.586436212f},
-std::array<float,2>{0.418974131f, 0.266397268f},
-std::array<float,2>{0.529320598f, 0.75502944f},
-std::array<float,2>{0.510165572f, 0.0668253377f},
-std::array<float,2>{0.42395696f, 0.613413334f},
-std::array<float,2>{0.113617644f, 0.301536739f},
-std::array<float,2>{0.781989694f, 0.78800869f},
-std::array<float,2>{0.901883423f, 0.401128381f},
-std::array<float,2>{0.127807975f, 0.877981305f},
-std::array<float,2>{0.324770689f, 0.171491235f},
-std::array<float,2>{0.725788355f, 0.6362468f},
-std::array<float,2>{0.65015316f, 0.359236062f},
-std::array<float,2>{0.259796798f, 0.814137459f},
-std::array<float,2>{0.238121003f, 0.00118487899f},
-std::array<float,2>{0.992691219f, 0.540489614f},
-std::array<float,2>{0.858289659f, 0.247548059f},
-std::array<float,2>{0.0508468151f, 0.739136875f},
-std::array<float,2>{0.45750457f, 0.445122093f},
-std::array<float,2>{0.601962626f, 0.944234729f},
-std::array<float,2>{0.688363135f, 0.126125604f},
-std::array<float,2>{0.36950466f, 0.665217936f},
-std::array<float,2>{0.18584539f, 0.432817847f},
-std::array<float,2>{0.912840247f, 0.922599971f},
-std::array<float,2>{0.776109576f, 0.25685975f},
-std::array<float,2>{0.0650555789f, 0.771722078f},
-std::array<float,2>{0.391587138f, 0.100784883f},
-std::array<float,2>{0.549108207f, 0.565557539f},
-std::array<float,2>{0.569377124f, 0.479002029f},
-std::array<float,2>{0.491680264f, 0.978711426f},
-std::array<float,2>{0.0108972294f, 0.203980401f},
-std::array<float,2>{0.815286577f, 0.697515428f},
-std::array<float,2>{0.944467723f, 0.0391647555f},
-std::array<float,2>{0.187979952f, 0.529213309f},
-std::array<float,2>{0.290860742f, 0.343507886f},
-std::array<float,2>{0.662938476f, 0.844343662f},
-std::array<float,2>{0.716085136f, 0.0337294787f},
-std::array<float,2>{0.349309087f, 0.519604206f},
-std::array<float,2>{0.164250076f, 0.334377825f},
-std::array<float,2>{0.931224525f, 0.858095288f},
-std::array<float,2>{0.763901651f, 0.469269782f},
-std::array<float,2>{0.0866379812f, 0.969820082f},
-std::array<float,2>{0.381757617f, 0.216525644f},
-std::array<float,2>{0.540632248f, 0.691424429f},
-std::array<float,2>{0.581851184f, 0.263558894f},
-std::array<float,2>{0.482316643f, 0.777924716f},
-std::array<float,2>{0.0232628658f, 0.10697671f},
-std::array<float,2>{0.842612922f, 0.577205837f},
-std::array<float,2>{0.963884115f, 0.140544042f},
-std::array<float,2>{0.206610605f, 0.664050817f},
-std::array<float,2>{0.308083475f, 0.428729624f},
-std::array<float,2>{0.681868315f, 0.931186259f},
-std::array<float,2>{0.525473773f, 0.241093367f},
-std::array<float,2>{0.415807515f, 0.749403f},
-std::array<float,2>{0.105960965f, 0.451087087f},
-std::array<float,2>{0.806124866f, 0.951844931f},
-std::array<float,2>{0.890363336f, 0.348642677f},
-std::array<float,2>{0.146368966f, 0.82489723f},
-std::array<float,2>{0.328156024f, 0.0117358901f},
-std::array<float,2>{0.737821579f, 0.532810807f},
-std::array<float,2>{0.629364967f, 0.39090997f},
-std::array<float,2>{0.280632496f, 0.883378088f},
-std::array<float,2>{0.220679298f, 0.163634256f},
-std::array<float,2>{0.975926399f, 0.630478263f},
-std::array<float,2>{0.872177541f, 0.0728808567f},
-std::array<float,2>{0.0398693942f, 0.617810249f},
-std::array<float,2>{0.44742322f, 0.311470449f},
-std::array<float,2>{0.6182971f, 0.790318251f},
-std::array<float,2>{0.60574472f, 0.11452876f},
-std::array<float,2>{0.454489738f, 0.580253184f},
-std::array<float,2>{0.0470349193f, 0.279332042f},
-std::array<float,2>{0.855453134f, 0.760860085f},
-std::array<float,2>{0.997004569f, 0.413078606f},
-std::array<float,2>{0.239484608f, 0.918564081f},
-std::array<float,2>{0.264184654f, 0.146867603f},
-std::array<float,2>{0.655899882f, 0.674586594f},
-std::array<float,2>{0.721109629f, 0.319519073f},
-std::array<float,2>{0.320496231f, 0.861719072f},
-std::array<float,2>{0.131465808f, 0.0570492484f},
-std::array<float,2>{0.905380964f, 0.504335225f},
-std::array<float,2>{0.786009133f, 0.196687996f},
-std::array<float,2>{0.110675916f, 0.709676266f},
-std::array<float,2>{0.426225454f, 0.498924375f},
-std::array<float,2>{0.51208657f, 0.993894994f},
-std::array<float,2>{0.657484829f, 0.17450504f},
-std::array<float,2>{0.296031684f, 0.656113148f},
-std::array<float,2>{0.191639468f, 0.390077651f},
-std::array<float,2>{0.941233933f, 0.896562874f},
-std::array<float,2>{0.817354679f, 0.286010027f},
-std::array<float,2>{0.0147832865f, 0.806368053f},
-std::array<float,2>{0.485455573f, 0.0783325136f},
-std::array<float,2>{0.563706279f, 0.594339609f},
-std::array<float,2>{0.553903878f, 0.466048777f},
-std::array<float,2>{0.395618051f, 0.953223884f},
-std::array<float,2>{0.0664439276f, 0.230845451f},
-std::array<float,2>{0.780336201f, 0.72915709f},
-std::array<float,2>{0.907350421f, 0.0207775291f},
-std::array<float,2>{0.181622103f, 0.560459495f},
-std::array<float,2>{0.374438316f, 0.368085414f},
-std::array<float,2>{0.693549335f, 0.839959919f},
-std::array<float,2>{0.643473983f, 0.0860913992f},
-std::array<float,2>{0.256500959f, 0.603784382f},
-std::array<float,2>{0.249347851f, 0.2941221f},
-std::array<float,2>{0.985098839f, 0.798608065f},
-std::array<float,2>{0.844866574f, 0.377212018f},
-std::array<float,2>{0.0560624525f, 0.905228138f},
-std::array<float,2>{0.466259629f, 0.186065778f},
-std::array<float,2>{0.60084492f, 0.642091453f},
-std::array<float,2>{0.503430903f, 0.361353487f},
-std::array<float,2>{0.432318151f, 0.833502948f},
-std::array<float,2>{0.119780049f, 0.027817497f},
-std::array<float,2>{0.792840064f, 0.551298738f},
-std::array<float,2>{0.897982001f, 0.219905406f},
-std::array<float,2>{0.137915567f, 0.72391659f},
-std::array<float,2>{0.317841679f, 0.456140459f},
-std::array<float,2>{0.730224133f, 0.965548933f},
-std::array<float,2>{0.575986385f, 0.155530691f},
-std::array<float,2>{0.494948626f, 0.683259189f},
-std::array<float,2>{0.00166698778f, 0.418166727f},
-std::array<float,2>{0.82596153f, 0.912888885f},
-std::array<float,2>{0.951474011f, 0.271122038f},
-std::array<float,2>{0.202651948f, 0.753366649f},
-std::array<float,2>{0.287625819f, 0.123735607f},
-std::array<float,2>{0.666955769f, 0.590941012f},
-std::array<float,2>{0.702628672f, 0.486362785f},
-std::array<float,2>{0.35978964f, 0.986533105f},
-std::array<float,2>{0.178192258f, 0.189960778f},
-std::array<float,2>{0.920052528f, 0.713779092f},
-std::array<float,2>{0.773198724f, 0.0506827161f},
-std::array<float,2>{0.070996955f, 0.513733268f},
-std::array<float,2>{0.401522905f, 0.321181446f},
-std::array<float,2>{0.561512291f, 0.86766392f},
-std::array<float,2>{0.537561238f, 0.00582160987f},
-std::array<float,2>{0.384490818f, 0.546712875f},
-std::array<float,2>{0.0813119635f, 0.351663321f},
-std::array<float,2>{0.755675852f, 0.816783965f},
-std::array<float,2>{0.924203515f, 0.439647257f},
-std::array<float,2>{0.161078155f, 0.937631309f},
-std::array<float,2>{0.35937193f, 0.245727539f},
-std::array<float,2>{0.708790421f, 0.735473335f},
-std::array<float,2>{0.674926162f, 0.300318748f},
-std::array<float,2>{0.301702559f, 0.781793952f},
-std::array<float,2>{0.217862427f, 0.0628189743f},
-std::array<float,2>{0.956061661f, 0.612129569f},
-std::array<float,2>{0.828540385f, 0.164277196f},
-std::array<float,2>{0.0269016083f, 0.638852715f},
-std::array<float,2>{0.469616681f, 0.402384698f},
-std::array<float,2>{0.588046849f, 0.882214725f},
-std::array<float,2>{0.744953215f, 0.208715886f},
-std::array<float,2>{0.33791405f, 0.700212359f},
-std::array<float,2>{0.155735523f, 0.480932564f},
-std::array<float,2>{0.877236187f, 0.983512104f},
-std::array<float,2>{0.803702712f, 0.337653816f},
-std::array<float,2>{0.0991594866f, 0.847714782f},
-std::array<float,2>{0.411092937f, 0.0443477258f},
-std::array<float,2>{0.518687308f, 0.525811136f},
-std::array<float,2>{0.613126576f, 0.433942914f},
-std::array<float,2>{0.438582957f, 0.927368045f},
-std::array<float,2>{0.0359983779f, 0.132632762f},
-std::array<float,2>{0.862326741f, 0.671730995f},
-std::array<float,2>{0.983169079f, 0.0951326713f},
-std::array<float,2>{0.233748376f, 0.568373799f},
-std::array<float,2>{0.26672104f, 0.253155142f},
-std::array<float,2>{0.633418143f, 0.765648365f},
-std::array<float,2>{0.698980808f, 0.0743095353f},
-std::array<float,2>{0.365918517f, 0.623663068f},
-std::array<float,2>{0.173673287f, 0.304944664f},
-std::array<float,2>{0.917492747f, 0.79363066f},
-std::array<float,2>{0.767790735f, 0.397526473f},
-std::array<float,2>{0.0759267882f, 0.889840245f},
-std::array<float,2>{0.403751105f, 0.158024997f},
-std::array<float,2>{0.557656705f, 0.628548324f},
-std::array<float,2>{0.573232472f, 0.345267564f},
-std::array<float,2>{0.499471933f, 0.823414147f},
-std::array<float,2>{0.00547406264f, 0.0113584632f},
-std::array<float,2>{0.820776582f, 0.538741767f},
-std::array<float,2>{0.946378827f, 0.23469536f},
-std::array<float,2>{0.196923792f, 0.744877875f},
-std::array<float,2>{0.283953786f, 0.448902279f},
-std::array<float,2>{0.668126523f, 0.949217498f},
-std::array<float,2>{0.507618964f, 0.135855794f},
-std::array<float,2>{0.436691552f, 0.656730056f},
-std::array<float,2>{0.124186255f, 0.425473779f},
-std::array<float,2>{0.794326365f, 0.935560822f},
-std::array<float,2>{0.89318037f, 0.259266287f},
-std::array<float,2>{0.133672938f, 0.775521398f},
-std::array<float,2>{0.315067351f, 0.102157801f},
-std::array<float,2>{0.734001219f, 0.573139489f},
-std::array<float,2>{0.648201168f, 0.473886251f},
-std::array<float,2>{0.250927806f, 0.975055039f},
-std::array<float,2>{0.245029837f, 0.211896837f},
-std::array<float,2>{0.990891576f, 0.690554678f},
-std::array<float,2>{0.84809953f, 0.0379508212f},
-std::array<float,2>{0.059431199f, 0.518844247f},
-std::array<float,2>{0.464318126f, 0.3307347f},
-std::array<float,2>{0.596768618f, 0.85343647f},
-std::array<float,2>{0.616883457f, 0.016618913f},
-std::array<float,2>{0.441580981f, 0.555707932f},
-std::array<float,2>{0.0346864872f, 0.372104734f},
-std::array<float,2>{0.866055489f, 0.837108672f},
-std::array<float,2>{0.978151858f, 0.461489916f},
-std::array<float,2>{0.227059647f, 0.960055947f},
-std::array<float,2>{0.271301448f, 0.227066115f},
-std::array<float,2>{0.637064576f, 0.7328493f},
-std::array<float,2>{0.746316373f, 0.284682602f},
-std::array<float,2>{0.343428493f, 0.810332894f},
-std::array<float,2>{0.150998622f, 0.082090579f},
-std::array<float,2>{0.87931639f, 0.598287821f},
-std::array<float,2>{0.797737658f, 0.1775482f},
-std::array<float,2>{0.0963794515f, 0.651475966f},
-std::array<float,2>{0.407885581f, 0.385066509f},
-std::array<float,2>{0.520486414f, 0.89296788f},
-std::array<float,2>{0.676689863f, 0.199352443f},
-std::array<float,2>{0.300700784f, 0.703954697f},
-std::array<float,2>{0.213343188f, 0.494975835f},
-std::array<float,2>{0.958912373f, 0.997083187f},
-std::array<float,2>{0.832870662f, 0.314398825f},
-std::array<float,2>{0.0310556106f, 0.864608109f},
-std::array<float,2>{0.473529994f, 0.0591503046f},
-std::array<float,2>{0.591262877f, 0.502243698f},
-std::array<float,2>{0.53508389f, 0.409287244f},
-std::array<float,2>{0.388745785f, 0.917693317f},
-std::array<float,2>{0.083796449f, 0.144127026f},
-std::array<float,2>{0.752710104f, 0.677030385f},
-std::array<float,2>{0.928018093f, 0.110779487f},
-std::array<float,2>{0.157019302f, 0.58546555f},
-std::array<float,2>{0.353077948f, 0.27396822f},
-std::array<float,2>{0.705080509f, 0.76385498f},
-std::array<float,2>{0.628437459f, 0.0537063442f},
-std::array<float,2>{0.274057269f, 0.509701431f},
-std::array<float,2>{0.224849313f, 0.324852586f},
-std::array<float,2>{0.969214678f, 0.874365747f},
-std::array<float,2>{0.867495954f, 0.489158064f},
-std::array<float,2>{0.0453516506f, 0.98936367f},
-std::array<float,2>{0.45283398f, 0.191796735f},
-std::array<float,2>{0.62135905f, 0.717193305f},
-std::array<float,2>{0.528046012f, 0.269476891f},
-std::array<float,2>{0.421656847f, 0.757544458f},
-std::array<float,2>{0.104356274f, 0.118370228f},
-std::array<float,2>{0.810958862f, 0.587941885f},
-std::array<float,2>{0.886698186f, 0.149960756f},
-std::array<float,2>{0.142326236f, 0.687140286f},
-std::array<float,2>{0.3330881f, 0.415289283f},
-std::array<float,2>{0.739163935f, 0.909492791f},
-std::array<float,2>{0.582431078f, 0.225557178f},
-std::array<float,2>{0.477928221f, 0.719118595f},
-std::array<float,2>{0.0190286487f, 0.458453357f},
-std::array<float,2>{0.838437259f, 0.963913202f},
-std::array<float,2>{0.967366815f, 0.366471708f},
-std::array<float,2>{0.210816875f, 0.828375101f},
-std::array<float,2>{0.310659528f, 0.0241478775f},
-std::array<float,2>{0.685171187f, 0.547732711f},
-std::array<float,2>{0.713781238f, 0.380636126f},
-std::array<float,2>{0.344822198f, 0.899305403f},
-std::array<float,2>{0.168791786f, 0.182430327f},
-std::array<float,2>{0.936636627f, 0.647056103f},
-std::array<float,2>{0.760707915f, 0.0929170847f},
-std::array<float,2>{0.0909428149f, 0.606467366f},
-std::array<float,2>{0.375919938f, 0.289482802f},
-std::array<float,2>{0.54538554f, 0.802256584f},
-std::array<float,2>{0.547530413f, 0.0990887359f},
-std::array<float,2>{0.392987698f, 0.562644482f},
-std::array<float,2>{0.0632814988f, 0.254794836f},
-std::array<float,2>{0.774894476f, 0.769925237f},
-std::array<float,2>{0.910515249f, 0.43029213f},
-std::array<float,2>{0.184411302f, 0.925772965f},
-std::array<float,2>{0.368283182f, 0.128642321f},
-std::array<float,2>{0.691206813f, 0.667132378f},
-std::array<float,2>{0.661952496f, 0.341724277f},
-std::array<float,2>{0.291736275f, 0.846904874f},
-std::array<float,2>{0.189820975f, 0.0414536223f},
-std::array<float,2>{0.942975581f, 0.530856729f},
-std::array<float,2>{0.813846171f, 0.206315443f},
-std::array<float,2>{0.00850867014f, 0.695560336f},
-std::array<float,2>{0.489615798f, 0.476594806f},
-std::array<float,2>{0.567133367f, 0.978115678f},
-std::array<float,2>{0.722685099f, 0.168615773f},
-std::array<float,2>{0.328007221f, 0.63376683f},
-std::array<float,2>{0.125643209f, 0.399044335f},
-std::array<float,2>{0.899571836f, 0.875365555f},
-std::array<float,2>{0.783428967f, 0.303522199f},
-std::array<float,2>{0.116378456f, 0.786129951f},
-std::array<float,2>{0.42360723f, 0.0692860708f},
-std::array<float,2>{0.508542776f, 0.616475403f},
-std::array<float,2>{0.603609204f, 0.441662252f},
-std::array<float,2>{0.460898966f, 0.941511273f},
-std::array<float,2>{0.0528067015f, 0.248730525f},
-std::array<float,2>{0.857144296f, 0.74188596f},
-std::array<float,2>{0.995802104f, 0.00290801469f},
-std::array<float,2>{0.235617995f, 0.541448474f},
-std::array<float,2>{0.25807935f, 0.356717616f},
-std::array<float,2>{0.652131379f, 0.815671742f},
-std::array<float,2>{0.735872447f, 0.015504119f},
-std::array<float,2>{0.331065238f, 0.533976078f},
-std::array<float,2>{0.146738052f, 0.350537956f},
-std::array<float,2>{0.888275862f, 0.827853918f},
-std::array<float,2>{0.806955755f, 0.451329798f},
-std::array<float,2>{0.108242057f, 0.949621737f},
-std::array<float,2>{0.416190445f, 0.238951221f},
-std::array<float,2>{0.523896277f, 0.747804523f},
-std::array<float,2>{0.619883418f, 0.309089065f},
-std::array<float,2>{0.44700405f, 0.79197222f},
-std::array<float,2>{0.0424607992f, 0.0717471018f},
-std::array<float,2>{0.873864055f, 0.620362282f},
-std::array<float,2>{0.973728716f, 0.160869792f},
-std::array<float,2>{0.221313566f, 0.631663561f},
-std::array<float,2>{0.278392613f, 0.393836945f},
-std::array<float,2>{0.630967557f, 0.886716306f},
-std::array<float,2>{0.54240185f, 0.218363002f},
-std::array<float,2>{0.379004806f, 0.694642186f},
-std::array<float,2>{0.0881101862f, 0.471888661f},
-std::array<float,2>{0.763130426f, 0.972384214f},
-std::array<float,2>{0.932412684f, 0.332904488f},
-std::array<float,2>{0.166484967f, 0.856512487f},
-std::array<float,2>{0.351131499f, 0.0325902998f},
-std::array<float,2>{0.717266083f, 0.52278465f},
-std::array<float,2>{0.679978251f, 0.425922573f},
-std::array<float,2>{0.305016756f, 0.931849599f},
-std::array<float,2>{0.204700097f, 0.138120517f},
-std::array<float,2>{0.96110487f, 0.661281705f},
-std::array<float,2>{0.840219975f, 0.108991273f},
-std::array<float,2>{0.0213278588f, 0.574494481f},
-std::array<float,2>{0.482687771f, 0.26498273f},
-std::array<float,2>{0.579197645f, 0.77976346f},
-std::array<float,2>{0.564749897f, 0.0819374323f},
-std::array<float,2>{0.487788349f, 0.596210122f},
-std::array<float,2>{0.01366367f, 0.287804514f},
-std::array<float,2>{0.819619358f, 0.808345139f},
-std::array<float,2>{0.938003778f, 0.386998802f},
-std::array<float,2>{0.194223836f, 0.895008683f},
-std::array<float,2>{0.293056279f, 0.173427105f},
-std::array<float,2>{0.658240378f, 0.653521478f},
-std::array<float,2>{0.692825675f, 0.37020126f},
-std::array<float,2>{0.371368945f, 0.842981935f},
-std::array<float,2>{0.182610676f, 0.021682078f},
-std::array<float,2>{0.909152925f, 0.56074512f},
-std::array<float,2>{0.778901637f, 0.232458428f},
-std::array<float,2>{0.0685697794f, 0.72663635f},
-std::array<float,2>{0.396728396f, 0.467738092f},
-std::array<float,2>{0.551162899f, 0.955301344f},
-std::array<float,2>{0.653211415f, 0.145904168f},
-std::array<float,2>{0.26284337f, 0.672044992f},
-std::array<float,2>{0.241943583f, 0.410984486f},
-std::array<float,2>{0.998823702f, 0.921775162f},
-std::array<float,2>{0.853414774f, 0.278316617f},
-std::array<float,2>{0.0499748588f, 0.75818342f},
-std::array<float,2>{0.456858277f, 0.116665669f},
-std::array<float,2>{0.607952714f, 0.578935564f},
-std::array<float,2>{0.515508354f, 0.497773319f},
-std::array<float,2>{0.428607345f, 0.994815469f},
-std::array<float,2>{0.11189349f, 0.197458088f},
-std::array<float,2>{0.788337111f, 0.707862377f},
-std::array<float,2>{0.903568029f, 0.0557105131f},
-std::array<float,2>{0.129700318f, 0.507479846f},
-std::array<float,2>{0.322842449f, 0.316801965f},
-std::array<float,2>{0.719982922f, 0.860377789f},
-std::array<float,2>{0.664376438f, 0.121124305f},
-std::array<float,2>{0.285391599f, 0.591831326f},
-std::array<float,2>{0.20074673f, 0.271952599f},
-std::array<float,2>{0.950634003f, 0.750549555f},
-std::array<float,2>{0.82635802f, 0.42120254f},
-std::array<float,2>{0.00306584011f, 0.912053406f},
-std::array<float,2>{0.492219746f, 0.153397143f},
-std::array<float,2>{0.576604962f, 0.68141526f},
-std::array<float,2>{0.559157193f, 0.322754025f},
-std::array<float,2>{0.399065912f, 0.870882034f},
-std::array<float,2>{0.0738687664f, 0.0478036404f},
-std::array<float,2>{0.770483315f, 0.51206702f},
-std::array<float,2>{0.91937536f, 0.188157037f},
-std::array<float,2>{0.176168993f, 0.71275115f},
-std::array<float,2>{0.361358404f, 0.485272288f},
-std::array<float,2>{0.700131536f, 0.9850384f},
-std::array<float,2>{0.599092662f, 0.183909386f},
-std::array<float,2>{0.468096226f, 0.644018412f},
-std::array<float,2>{0.0570421368f, 0.376092553f},
-std::array<float,2>{0.847383499f, 0.903585076f},
-std::array<float,2>{0.98752445f, 0.296819538f},
-std::array<float,2>{0.247991264f, 0.799384117f},
-std::array<float,2>{0.254439801f, 0.0889566392f},
-std::array<float,2>{0.641963124f, 0.602973044f},
-std::array<float,2>{0.726981342f, 0.453389972f},
-std::array<float,2>{0.31997332f, 0.967171073f},
-std::array<float,2>{0.139295146f, 0.222150043f},
-std::array<float,2>{0.89585644f, 0.726462185f},
-std::array<float,2>{0.789276063f, 0.0307149235f},
-std::array<float,2>{0.118548371f, 0.552743912f},
-std::array<float,2>{0.430098563f, 0.360750616f},
-std::array<float,2>{0.501860559f, 0.835535169f},
-std::array<float,2>{0.515936077f, 0.045913551f},
-std::array<float,2>{0.412866682f, 0.523609042f},
-std::array<float,2>{0.100381903f, 0.338196337f},
-std::array<float,2>{0.801754415f, 0.849852264f},
-std::array<float,2>{0.875408232f, 0.483814776f},
-std::array<float,2>{0.153177574f, 0.980653882f},
-std::array<float,2>{0.336703956f, 0.210640222f},
-std::array<float,2>{0.742904603f, 0.702258646f},
-std::array<float,2>{0.635641515f, 0.251754969f},
-std::array<float,2>{0.269201308f, 0.769510508f},
-std::array<float,2>{0.230959386f, 0.0971442163f},
-std::array<float,2>{0.982243538f, 0.568087757f},
-std::array<float,2>{0.859497368f, 0.130762875f},
-std::array<float,2>{0.0383408107f, 0.66977334f},
-std::array<float,2>{0.440235525f, 0.436748534f},
-std::array<float,2>{0.611023009f, 0.92966795f},
-std::array<float,2>{0.710056782f, 0.242191941f},
-std::array<float,2>{0.355776548f, 0.737362683f},
-std::array<float,2>{0.163512662f, 0.439171374f},
-std::array<float,2>{0.922666192f, 0.940502226f},
-std::array<float,2>{0.757688582f, 0.355426669f},
-std::array<float,2>{0.0798156261f, 0.819589317f},
-std::array<float,2>{0.384849936f, 0.00757831521f},
-std::array<float,2>{0.535715818f, 0.544390857f},
-std::array<float,2>{0.587603092f, 0.405470401f},
-std::array<float,2>{0.472565502f, 0.879415214f},
-std::array<float,2>{0.0246841982f, 0.166521609f},
-std::array<float,2>{0.831741691f, 0.637233436f},
-std::array<float,2>{0.954414368f, 0.0646068603f},
-std::array<float,2>{0.215314388f, 0.609622717f},
-std::array<float,2>{0.303023905f, 0.297070265f},
-std::array<float,2>{0.673193455f, 0.783212125f},
-std::array<float,2>{0.726556659f, 0.0685213953f},
-std::array<float,2>{0.324577421f, 0.616800249f},
-std::array<float,2>{0.127405927f, 0.302839667f},
-std::array<float,2>{0.901760042f, 0.785157621f},
-std::array<float,2>{0.781396925f, 0.398792118f},
-std::array<float,2>{0.114074409f, 0.875802815f},
-std::array<float,2>{0.424585998f, 0.168396845f},
-std::array<float,2>{0.510624826f, 0.633045435f},
-std::array<float,2>{0.602377176f, 0.357185572f},
-std::array<float,2>{0.45784992f, 0.816332161f},
-std::array<float,2>{0.0514671765f, 0.00223020068f},
-std::array<float,2>{0.857692719f, 0.541772723f},
-std::array<float,2>{0.992511332f, 0.248059645f},
-std::array<float,2>{0.237494946f, 0.741660058f},
-std::array<float,2>{0.260574073f, 0.441932559f},
-std::array<float,2>{0.649854779f, 0.942216516f},
-std::array<float,2>{0.54934305f, 0.128112167f},
-std::array<float,2>{0.390919238f, 0.667574048f},
-std::array<float,2>{0.0648270622f, 0.429823369f},
-std::array<float,2>{0.775662184f, 0.924915552f},
-std::array<float,2>{0.912514806f, 0.254166424f},
-std::array<float,2>{0.186206713f, 0.770304918f},
-std::array<float,2>{0.369938046f, 0.0993055627f},
-std::array<float,2>{0.687641144f, 0.563219607f},
-std::array<float,2>{0.662309706f, 0.477200091f},
-std::array<float,2>{0.290481538f, 0.977742851f},
-std::array<float,2>{0.188416153f, 0.206820399f},
-std::array<float,2>{0.945147038f, 0.695866466f},
-std::array<float,2>{0.814568579f, 0.0416398123f},
-std::array<float,2>{0.0114569701f, 0.530694127f},
-std::array<float,2>{0.491915464f, 0.341115117f},
-std::array<float,2>{0.569987953f, 0.84729588f},
-std::array<float,2>{0.584931433f, 0.023587428f},
-std::array<float,2>{0.479504794f, 0.547211468f},
-std::array<float,2>{0.0165181197f, 0.367005825f},
-std::array<float,2>{0.837727845f, 0.829086125f},
-std::array<float,2>{0.965502501f, 0.458916038f},
-std::array<float,2>{0.208503515f, 0.964707196f},
-std::array<float,2>{0.309834063f, 0.224814713f},
-std::array<float,2>{0.687398255f, 0.71952033f},
-std::array<float,2>{0.711365879f, 0.28990379f},
-std::array<float,2>{0.345987439f, 0.802105427f},
-std::array<float,2>{0.170592204f, 0.0936451927f},
-std::array<float,2>{0.934033692f, 0.60693568f},
-std::array<float,2>{0.759090185f, 0.181870773f},
-std::array<float,2>{0.0924886763f, 0.646516562f},
-std::array<float,2>{0.37708047f, 0.379888237f},
-std::array<float,2>{0.544745386f, 0.898641348f},
-std::array<float,2>{0.626179039f, 0.1921985f},
-std::array<float,2>{0.277240247f, 0.717739999f},
-std::array<float,2>{0.223203912f, 0.488451332f},
-std::array<float,2>{0.972058296f, 0.990044415f},
-std::array<float,2>{0.870350242f, 0.324561328f},
-std::array<float,2>{0.0447689854f, 0.874625742f},
-std::array<float,2>{0.449499458f, 0.0529021136f},
-std::array<float,2>{0.623311162f, 0.509231567f},
-std::array<float,2>{0.530096829f, 0.415742666f},
-std::array<float,2>{0.41957742f, 0.910052896f},
-std::array<float,2>{0.103458665f, 0.149575874f},
-std::array<float,2>{0.810514271f, 0.686567247f},
-std::array<float,2>{0.884252727f, 0.118698187f},
-std::array<float,2>{0.144259334f, 0.588805139f},
-std::array<float,2>{0.334860146f, 0.268703133f},
-std::array<float,2>{0.741436958f, 0.756945312f},
-std::array<float,2>{0.678906202f, 0.0589691103f},
-std::array<float,2>{0.297348261f, 0.502712131f},
-std::array<float,2>{0.212460995f, 0.313682735f},
-std::array<float,2>{0.960389853f, 0.865036368f},
-std::array<float,2>{0.835728943f, 0.494579971f},
-std::array<float,2>{0.0276794117f, 0.997793257f},
-std::array<float,2>{0.476223856f, 0.199764267f},
-std::array<float,2>{0.592686892f, 0.703230023f},
-std::array<float,2>{0.532355011f, 0.273834348f},
-std::array<float,2>{0.387486607f, 0.76458776f},
-std::array<float,2>{0.0844799504f, 0.111088537f},
-std::array<float,2>{0.750854254f, 0.585368991f},
-std::array<float,2>{0.926587641f, 0.143810973f},
-std::array<float,2>{0.159159005f, 0.677376509f},
-std::array<float,2>{0.353633016f, 0.409889728f},
-std::array<float,2>{0.70468986f, 0.917377949f},
-std::array<float,2>{0.614019156f, 0.227037311f},
-std::array<float,2>{0.444818944f, 0.733343065f},
-std::array<float,2>{0.0316606797f, 0.461198956f},
-std::array<float,2>{0.864450455f, 0.960726917f},
-std::array<float,2>{0.979161024f, 0.372606337f},
-std::array<float,2>{0.228980005f, 0.837731838f},
-std::array<float,2>{0.273238033f, 0.017572308f},
-std::array<float,2>{0.639690816f, 0.556575239f},
-std::array<float,2>{0.749264479f, 0.385447711f},
-std::array<float,2>{0.340491235f, 0.893427789f},
-std::array<float,2>{0.149962962f, 0.17702736f},
-std::array<float,2>{0.882408082f, 0.652225912f},
-std::array<float,2>{0.800150931f, 0.0827734098f},
-std::array<float,2>{0.0949241072f, 0.598128915f},
-std::array<float,2>{0.408671856f, 0.284210593f},
-std::array<float,2>{0.522543073f, 0.809711099f},
-std::array<float,2>{0.504501939f, 0.101915859f},
-std::array<float,2>{0.435150743f, 0.57262969f},
-std::array<float,2>{0.122277923f, 0.259465396f},
-std::array<float,2>{0.796246707f, 0.776278377f},
-std::array<float,2>{0.892514229f, 0.425255895f},
-std::array<float,2>{0.135763571f, 0.936435521f},
-std::array<float,2>{0.313368082f, 0.136453167f},
-std::array<float,2>{0.731457412f, 0.656843781f},
-std::array<float,2>{0.645035803f, 0.330496699f},
-std::array<float,2>{0.252442628f, 0.852795124f},
-std::array<float,2>{0.243479982f, 0.0371341631f},
-std::array<float,2>{0.989396989f, 0.519319654f},
-std::array<float,2>{0.850878f, 0.211205423f},
-std::array<float,2>{0.060900405f, 0.691029847f},
-std::array<float,2>{0.462053776f, 0.474606842f},
-std::array<float,2>{0.595564425f, 0.975543559f},
-std::array<float,2>{0.696889043f, 0.157443687f},
-std::array<float,2>{0.363778323f, 0.62809819f},
-std::array<float,2>{0.175385877f, 0.398100823f},
-std::array<float,2>{0.91567266f, 0.890601337f},
-std::array<float,2>{0.767051339f, 0.30529058f},
-std::array<float,2>{0.0776011199f, 0.793300331f},
-std::array<float,2>{0.404835612f, 0.0747214183f},
-std::array<float,2>{0.555262804f, 0.623346031f},
-std::array<float,2>{0.571351171f, 0.448371291f},
-std::array<float,2>{0.497562289f, 0.94848752f},
-std::array<float,2>{0.00746728433f, 0.235213682f},
-std::array<float,2>{0.8235057f, 0.744561851f},
-std::array<float,2>{0.948012829f, 0.0107773971f},
-std::array<float,2>{0.199079663f, 0.538372874f},
-std::array<float,2>{0.283109099f, 0.345115751f},
-std::array<float,2>{0.670508981f, 0.823952198f},
-std::array<float,2>{0.708213985f, 0.00686095748f},
-std::array<float,2>{0.358882904f, 0.544732511f},
-std::array<float,2>{0.16050528f, 0.354909599f},
-std::array<float,2>{0.924480319f, 0.820195794f},
-std::array<float,2>{0.755350292f, 0.43891415f},
-std::array<float,2>{0.0816134363f, 0.941403091f},
-std::array<float,2>{0.384238183f, 0.242914975f},
-std::array<float,2>{0.537920952f, 0.737809896f},
-std::array<float,2>{0.588455737f, 0.29763931f},
-std::array<float,2>{0.469175369f, 0.784015238f},
-std::array<float,2>{0.0264101215f, 0.064952381f},
-std::array<float,2>{0.828686297f, 0.610133588f},
-std::array<float,2>{0.956880808f, 0.166233614f},
-std::array<float,2>{0.218531415f, 0.636873543f},
-std::array<float,2>{0.30112806f, 0.406013757f},
-std::array<float,2>{0.67537117f, 0.879244566f},
-std::array<float,2>{0.519129574f, 0.210401192f},
-std::array<float,2>{0.410448998f, 0.70268923f},
-std::array<float,2>{0.0989281908f, 0.483968437f},
-std::array<float,2>{0.803143263f, 0.981417894f},
-std::array<float,2>{0.877534866f, 0.338436842f},
-std::array<float,2>{0.156230688f, 0.850472629f},
-std::array<float,2>{0.338528901f, 0.0466115437f},
-std::array<float,2>{0.744341314f, 0.523962021f},
-std::array<float,2>{0.632907987f, 0.437214702f},
-std::array<float,2>{0.267394841f, 0.928928256f},
-std::array<float,2>{0.234162316f, 0.130319938f},
-std::array<float,2>{0.982622325f, 0.669357836f},
-std::array<float,2>{0.863143206f, 0.0974577069f},
-std::array<float,2>{0.0355604701f, 0.567477942f},
-std::array<float,2>{0.439346999f, 0.250995398f},
-std::array<float,2>{0.612440944f, 0.76864332f},
-std::array<float,2>{0.601262391f, 0.0895531029f},
-std::array<float,2>{0.46646902f, 0.603208005f},
-std::array<float,2>{0.0563942194f, 0.296350807f},
-std::array<float,2>{0.845675886f, 0.79917717f},
-std::array<float,2>{0.984608769f, 0.376840383f},
-std::array<float,2>{0.249553367f, 0.904052258f},
-std::array<float,2>{0.256314635f, 0.184166893f},
-std::array<float,2>{0.6427899f, 0.644341409f},
-std::array<float,2>{0.729968309f, 0.361016363f},
-std::array<float,2>{0.318198264f, 0.835357606f},
-std::array<float,2>{0.138651192f, 0.0310657434f},
-std::array<float,2>{0.897656143f, 0.553290486f},
-std::array<float,2>{0.792234123f, 0.222262144f},
-std::array<float,2>{0.119309179f, 0.725708544f},
-std::array<float,2>{0.431936115f, 0.454056412f},
-std::array<float,2>{0.503279984f, 0.967657268f},
-std::array<float,2>{0.666369081f, 0.153930277f},
-std::array<float,2>{0.287472218f, 0.680694342f},
-std::array<float,2>{0.202238232f, 0.421705842f},
-std::array<float,2>{0.952067137f, 0.911301255f},
-std::array<float,2>{0.825401783f, 0.27226007f},
-std::array<float,2>{0.00111148204f, 0.750165582f},
-std::array<float,2>{0.494227707f, 0.121885315f},
-std::array<float,2>{0.575420797f, 0.59243983f},
-std::array<float,2>{0.560991108f, 0.484647483f},
-std::array<float,2>{0.402090102f, 0.984557271f},
-std::array<float,2>{0.0703222305f, 0.187686041f},
-std::array<float,2>{0.772654951f, 0.712258637f},
-std::array<float,2>{0.920654655f, 0.0468769595f},
-std::array<float,2>{0.17834647f, 0.512265265f},
-std::array<float,2>{0.360265255f, 0.322523922f},
-std::array<float,2>{0.702934206f, 0.870242059f},
-std::array<float,2>{0.655382097f, 0.116836898f},
-std::array<float,2>{0.263780236f, 0.578195572f},
-std::array<float,2>{0.239872694f, 0.2775729f},
-std::array<float,2>{0.996246994f, 0.758340418f},
-std::array<float,2>{0.85464555f, 0.410289615f},
-std::array<float,2>{0.0478463881f, 0.921017051f},
-std::array<float,2>{0.454974502f, 0.146036088f},
-std::array<float,2>{0.606182396f, 0.672534525f},
-std::array<float,2>{0.512266159f, 0.316924632f},
-std::array<float,2>{0.426546901f, 0.860974431f},
-std::array<float,2>{0.111102134f, 0.0563295707f},
-std::array<float,2>{0.785387635f, 0.50721103f},
-std::array<float,2>{0.905966222f, 0.198085576f},
-std::array<float,2>{0.131037965f, 0.707193255f},
-std::array<float,2>{0.321247846f, 0.497188896f},
-std::array<float,2>{0.721509159f, 0.994431317f},
-std::array<float,2>{0.564027488f, 0.172942042f},
-std::array<float,2>{0.485879034f, 0.654275179f},
-std::array<float,2>{0.0152749112f, 0.387565047f},
-std::array<float,2>{0.816564679f, 0.895366132f},
-std::array<float,2>{0.940614283f, 0.287510306f},
-std::array<float,2>{0.192211285f, 0.807686806f},
-std::array<float,2>{0.296782047f, 0.0813619792f},
-std::array<float,2>{0.657897592f, 0.596184134f},
-std::array<float,2>{0.69398272f, 0.466976762f},
-std::array<float,2>{0.374633163f, 0.955943286f},
-std::array<float,2>{0.181026325f, 0.233388215f},
-std::array<float,2>{0.908104002f, 0.727393031f},
-std::array<float,2>{0.780843258f, 0.0223381892f},
-std::array<float,2>{0.0671498328f, 0.561108828f},
-std::array<float,2>{0.396276385f, 0.370720983f},
-std::array<float,2>{0.554256678f, 0.84370321f},
-std::array<float,2>{0.540525436f, 0.0329389796f},
-std::array<float,2>{0.380903661f, 0.523216188f},
-std::array<float,2>{0.0862794295f, 0.332281321f},
-std::array<float,2>{0.764300525f, 0.857209921f},
-std::array<float,2>{0.93071878f, 0.472436816f},
-std::array<float,2>{0.164600715f, 0.972030997f},
-std::array<float,2>{0.348833412f, 0.21795921f},
-std::array<float,2>{0.716356635f, 0.69525218f},
-std::array<float,2>{0.682359219f, 0.265369117f},
-std::array<float,2>{0.308250964f, 0.780202448f},
-std::array<float,2>{0.206309199f, 0.108473793f},
-std::array<float,2>{0.964571655f, 0.575182676f},
-std::array<float,2>{0.842112303f, 0.138286814f},
-std::array<float,2>{0.0229215641f, 0.662066162f},
-std::array<float,2>{0.481647789f, 0.426721156f},
-std::array<float,2>{0.581084371f, 0.932410955f},
-std::array<float,2>{0.737673223f, 0.238731176f},
-std::array<float,2>{0.328757048f, 0.747451901f},
-std::array<float,2>{0.145606399f, 0.451983571f},
-std::array<float,2>{0.88996768f, 0.949749708f},
-std::array<float,2>{0.806378067f, 0.349918157f},
-std::array<float,2>{0.105877124f, 0.827345967f},
-std::array<float,2>{0.415384024f, 0.0147767346f},
-std::array<float,2>{0.526011169f, 0.533216774f},
-std::array<float,2>{0.618783951f, 0.3944664f},
-std::array<float,2>{0.447778553f, 0.885806501f},
-std::array<float,2>{0.0391864926f, 0.16060397f},
-std::array<float,2>{0.872656882f, 0.631342411f},
-std::array<float,2>{0.976251662f, 0.0720621943f},
-std::array<float,2>{0.22019574f, 0.62064743f},
-std::array<float,2>{0.280942261f, 0.308810443f},
-std::array<float,2>{0.629839778f, 0.791282356f},
-std::array<float,2>{0.69058305f, 0.101418644f},
-std::array<float,2>{0.368888825f, 0.566265166f},
-std::array<float,2>{0.184065521f, 0.257585824f},
-std::array<float,2>{0.910761833f, 0.772454858f},
-std::array<float,2>{0.775295794f, 0.433139563f},
-std::array<float,2>{0.0625614002f, 0.922278285f},
-std::array<float,2>{0.393146127f, 0.126573622f},
-std::array<float,2>{0.54729104f, 0.665751696f},
-std::array<float,2>{0.566411614f, 0.343108028f},
-std::array<float,2>{0.489836514f, 0.843792737f},
-std::array<float,2>{0.00817817356f, 0.0397581086f},
-std::array<float,2>{0.814326644f, 0.528798938f},
-std::array<float,2>{0.9426229f, 0.203442603f},
-std::array<float,2>{0.190393761f, 0.697939992f},
-std::array<float,2>{0.291266054f, 0.47920382f},
-std::array<float,2>{0.661207139f, 0.979240358f},
-std::array<float,2>{0.508050323f, 0.171020001f},
-std::array<float,2>{0.423150718f, 0.635796368f},
-std::array<float,2>{0.117170282f, 0.400710225f},
-std::array<float,2>{0.784027696f, 0.878898621f},
-std::array<float,2>{0.90014416f, 0.301217675f},
-std::array<float,2>{0.125268653f, 0.787204087f},
-std::array<float,2>{0.327330768f, 0.0673552081f},
-std::array<float,2>{0.723351955f, 0.613988042f},
-std::array<float,2>{0.65171349f, 0.444623888f},
-std::array<float,2>{0.258785695f, 0.943587959f},
-std::array<float,2>{0.236125946f, 0.248015016f},
-std::array<float,2>{0.995165348f, 0.738410652f},
-std::array<float,2>{0.856567502f, 0.00187008106f},
-std::array<float,2>{0.0534180291f, 0.540543735f},
-std::array<float,2>{0.460347712f, 0.358849406f},
-std::array<float,2>{0.604179263f, 0.813634932f},
-std::array<float,2>{0.621941268f, 0.0527228825f},
-std::array<float,2>{0.452237993f, 0.510501444f},
-std::array<float,2>{0.0458860174f, 0.327052772f},
-std::array<float,2>{0.868129373f, 0.871835172f},
-std::array<float,2>{0.969495177f, 0.4905352f},
-std::array<float,2>{0.22542426f, 0.991544366f},
-std::array<float,2>{0.273749143f, 0.193499744f},
-std::array<float,2>{0.628136218f, 0.71501112f},
-std::array<float,2>{0.738586128f, 0.266038448f},
-std::array<float,2>{0.333711684f, 0.755375683f},
-std::array<float,2>{0.142039984f, 0.120083757f},
-std::array<float,2>{0.885978281f, 0.586309612f},
-std::array<float,2>{0.811331511f, 0.1510638f},
-std::array<float,2>{0.103566274f, 0.68466872f},
-std::array<float,2>{0.421093255f, 0.417847455f},
-std::array<float,2>{0.527415097f, 0.907768548f},
-std::array<float,2>{0.684983313f, 0.223633572f},
-std::array<float,2>{0.311391205f, 0.720822573f},
-std::array<float,2>{0.210334808f, 0.459957153f},
-std::array<float,2>{0.967127025f, 0.96283716f},
-std::array<float,2>{0.838271618f, 0.363501579f},
-std::array<float,2>{0.0194734074f, 0.831918418f},
-std::array<float,2>{0.478393137f, 0.0255859941f},
-std::array<float,2>{0.582700849f, 0.549669683f},
-std::array<float,2>{0.545479059f, 0.382229269f},
-std::array<float,2>{0.375264734f, 0.900931358f},
-std::array<float,2>{0.0915637091f, 0.18137224f},
-std::array<float,2>{0.759928048f, 0.645982385f},
-std::array<float,2>{0.937027872f, 0.090475291f},
-std::array<float,2>{0.168338403f, 0.608216763f},
-std::array<float,2>{0.345388383f, 0.291584581f},
-std::array<float,2>{0.713358998f, 0.803307056f},
-std::array<float,2>{0.637461603f, 0.0186513811f},
-std::array<float,2>{0.270731091f, 0.557213664f},
-std::array<float,2>{0.22658819f, 0.373182148f},
-std::array<float,2>{0.977967739f, 0.838898301f},
-std::array<float,2>{0.865283191f, 0.463193208f},
-std::array<float,2>{0.0343734212f, 0.957368076f},
-std::array<float,2>{0.442061812f, 0.230159402f},
-std::array<float,2>{0.616288304f, 0.730509639f},
-std::array<float,2>{0.519840717f, 0.282593817f},
-std::array<float,2>{0.407277644f, 0.810858965f},
-std::array<float,2>{0.0957618132f, 0.0843250826f},
-std::array<float,2>{0.797258735f, 0.599758685f},
-std::array<float,2>{0.879802585f, 0.1778391f},
-std::array<float,2>{0.150393113f, 0.648515344f},
-std::array<float,2>{0.343181223f, 0.3844001f},
-std::array<float,2>{0.746799231f, 0.892134488f},
-std::array<float,2>{0.591333568f, 0.20148097f},
-std::array<float,2>{0.473097622f, 0.705747366f},
-std::array<float,2>{0.0306250844f, 0.492335349f},
-std::array<float,2>{0.832315207f, 0.998831093f},
-std::array<float,2>{0.958297789f, 0.315147251f},
-std::array<float,2>{0.21344237f, 0.865238428f},
-std::array<float,2>{0.300212204f, 0.0620999634f},
-std::array<float,2>{0.676217914f, 0.500655353f},
-std::array<float,2>{0.70569557f, 0.40724498f},
-std::array<float,2>{0.352791548f, 0.915107131f},
-std::array<float,2>{0.15643236f, 0.142006204f},
-std::array<float,2>{0.928350687f, 0.679603338f},
-std::array<float,2>{0.75230366f, 0.112023987f},
-std::array<float,2>{0.0830841139f, 0.582559228f},
-std::array<float,2>{0.389590919f, 0.275993258f},
-std::array<float,2>{0.534216642f, 0.763070583f},
-std::array<float,2>{0.558113873f, 0.0773736015f},
-std::array<float,2>{0.404291302f, 0.621416032f},
-std::array<float,2>{0.0753527656f, 0.308327764f},
-std::array<float,2>{0.768307805f, 0.796006203f},
-std::array<float,2>{0.917280078f, 0.395000339f},
-std::array<float,2>{0.172878772f, 0.888520181f},
-std::array<float,2>{0.365464509f, 0.15895845f},
-std::array<float,2>{0.698598564f, 0.625376821f},
-std::array<float,2>{0.668493867f, 0.346275419f},
-std::array<float,2>{0.283434123f, 0.821533084f},
-std::array<float,2>{0.196298406f, 0.00970291346f},
-std::array<float,2>{0.946791768f, 0.53611356f},
-std::array<float,2>{0.820838451f, 0.237295553f},
-std::array<float,2>{0.00533414725f, 0.743592799f},
-std::array<float,2>{0.499845743f, 0.445750087f},
-std::array<float,2>{0.572400808f, 0.945957124f},
-std::array<float,2>{0.733488023f, 0.132925659f},
-std::array<float,2>{0.314829201f, 0.659957707f},
-std::array<float,2>{0.133072034f, 0.423045248f},
-std::array<float,2>{0.892746031f, 0.934853196f},
-std::array<float,2>{0.7946859f, 0.26081413f},
-std::array<float,2>{0.124587849f, 0.77369833f},
-std::array<float,2>{0.437327504f, 0.104635686f},
-std::array<float,2>{0.50710839f, 0.571427882f},
-std::array<float,2>{0.597207546f, 0.474856883f},
-std::array<float,2>{0.464603096f, 0.974299252f},
-std::array<float,2>{0.0586315542f, 0.2143462f},
-std::array<float,2>{0.848344386f, 0.688279331f},
-std::array<float,2>{0.990677655f, 0.0359040275f},
-std::array<float,2>{0.244514197f, 0.516741037f},
-std::array<float,2>{0.250030279f, 0.329196632f},
-std::array<float,2>{0.647532582f, 0.854661942f},
-std::array<float,2>{0.742545664f, 0.0447576232f},
-std::array<float,2>{0.336204916f, 0.526159227f},
-std::array<float,2>{0.152534381f, 0.337076783f},
-std::array<float,2>{0.875746369f, 0.848179758f},
-std::array<float,2>{0.800909102f, 0.481168956f},
-std::array<float,2>{0.0998746008f, 0.984032869f},
-std::array<float,2>{0.412343502f, 0.208092332f},
-std::array<float,2>{0.516488492f, 0.701011598f},
-std::array<float,2>{0.610492587f, 0.253721446f},
-std::array<float,2>{0.439504534f, 0.766342402f},
-std::array<float,2>{0.0386464559f, 0.0954335481f},
-std::array<float,2>{0.860267103f, 0.568893194f},
-std::array<float,2>{0.981924891f, 0.132292747f},
-std::array<float,2>{0.230932727f, 0.671014488f},
-std::array<float,2>{0.268751919f, 0.434360653f},
-std::array<float,2>{0.634839833f, 0.927023411f},
-std::array<float,2>{0.53555584f, 0.245528176f},
-std::array<float,2>{0.385676026f, 0.736294508f},
-std::array<float,2>{0.0794555396f, 0.440219462f},
-std::array<float,2>{0.757084608f, 0.938377142f},
-std::array<float,2>{0.922262073f, 0.352494955f},
-std::array<float,2>{0.164012045f, 0.817358494f},
-std::array<float,2>{0.356275767f, 0.00514950976f},
-std::array<float,2>{0.710608542f, 0.546268523f},
-std::array<float,2>{0.673706055f, 0.403092384f},
-std::array<float,2>{0.303386569f, 0.882713795f},
-std::array<float,2>{0.215515763f, 0.164715722f},
-std::array<float,2>{0.954882503f, 0.639310658f},
-std::array<float,2>{0.831313491f, 0.0634347573f},
-std::array<float,2>{0.0253770333f, 0.611382663f},
-std::array<float,2>{0.471794367f, 0.299889594f},
-std::array<float,2>{0.587069392f, 0.781727016f},
-std::array<float,2>{0.577043951f, 0.123272248f},
-std::array<float,2>{0.492753178f, 0.591601551f},
-std::array<float,2>{0.00354286749f, 0.270757228f},
-std::array<float,2>{0.827016532f, 0.753482342f},
-std::array<float,2>{0.951127946f, 0.418775707f},
-std::array<float,2>{0.200405702f, 0.912381351f},
-std::array<float,2>{0.285784066f, 0.156236902f},
-std::array<float,2>{0.664798677f, 0.683014393f},
-std::array<float,2>{0.699435771f, 0.320659786f},
-std::array<float,2>{0.362185776f, 0.867922962f},
-std::array<float,2>{0.17627877f, 0.0500450991f},
-std::array<float,2>{0.919834793f, 0.514335811f},
-std::array<float,2>{0.76973027f, 0.189613879f},
-std::array<float,2>{0.0736791715f, 0.712936044f},
-std::array<float,2>{0.398812443f, 0.487178683f},
-std::array<float,2>{0.558763444f, 0.986946106f},
-std::array<float,2>{0.642116845f, 0.18572098f},
-std::array<float,2>{0.253930688f, 0.641872346f},
-std::array<float,2>{0.247542813f, 0.377843142f},
-std::array<float,2>{0.987876236f, 0.904442787f},
-std::array<float,2>{0.846681595f, 0.294437319f},
-std::array<float,2>{0.0572749451f, 0.798102736f},
-std::array<float,2>{0.468397856f, 0.0864387006f},
-std::array<float,2>{0.599498034f, 0.604017854f},
-std::array<float,2>{0.501223803f, 0.456802696f},
-std::array<float,2>{0.430295587f, 0.964990616f},
-std::array<float,2>{0.119085446f, 0.220286652f},
-std::array<float,2>{0.789796829f, 0.724397421f},
-std::array<float,2>{0.89625746f, 0.0279404484f},
-std::array<float,2>{0.138797298f, 0.550838292f},
-std::array<float,2>{0.319408536f, 0.362153172f},
-std::array<float,2>{0.727361679f, 0.833309591f},
-std::array<float,2>{0.658847868f, 0.0787187517f},
-std::array<float,2>{0.293936968f, 0.593926251f},
-std::array<float,2>{0.193433121f, 0.285183191f},
-std::array<float,2>{0.937874496f, 0.80575031f},
-std::array<float,2>{0.820162237f, 0.390382081f},
-std::array<float,2>{0.0130498242f, 0.897277772f},
-std::array<float,2>{0.488093793f, 0.174063623f},
-std::array<float,2>{0.565181494f, 0.655443907f},
-std::array<float,2>{0.551491261f, 0.367194295f},
-std::array<float,2>{0.397073448f, 0.840653419f},
-std::array<float,2>{0.0692105219f, 0.0213432088f},
-std::array<float,2>{0.778586686f, 0.559620559f},
-std::array<float,2>{0.908587515f, 0.231015131f},
-std::array<float,2>{0.181853727f, 0.728936374f},
-std::array<float,2>{0.372050196f, 0.466739297f},
-std::array<float,2>{0.692956448f, 0.954054356f},
-std::array<float,2>{0.607728362f, 0.147220626f},
-std::array<float,2>{0.456406593f, 0.673971117f},
-std::array<float,2>{0.0507342517f, 0.412427276f},
-std::array<float,2>{0.853024483f, 0.918436646f},
-std::array<float,2>{0.998146713f, 0.280099183f},
-std::array<float,2>{0.24143067f, 0.761573374f},
-std::array<float,2>{0.263435781f, 0.115112551f},
-std::array<float,2>{0.652823985f, 0.58079356f},
-std::array<float,2>{0.720493078f, 0.498161286f},
-std::array<float,2>{0.322370023f, 0.993591726f},
-std::array<float,2>{0.12923561f, 0.196921974f},
-std::array<float,2>{0.903941214f, 0.709070861f},
-std::array<float,2>{0.788605809f, 0.0576077588f},
-std::array<float,2>{0.111643068f, 0.504520774f},
-std::array<float,2>{0.428126723f, 0.320093006f},
-std::array<float,2>{0.514656305f, 0.862195909f},
-std::array<float,2>{0.524216115f, 0.0125397397f},
-std::array<float,2>{0.416589528f, 0.532677591f},
-std::array<float,2>{0.107422113f, 0.349459231f},
-std::array<float,2>{0.80732578f, 0.824608028f},
-std::array<float,2>{0.887958825f, 0.450228512f},
-std::array<float,2>{0.147388369f, 0.95149523f},
-std::array<float,2>{0.33193782f, 0.240571991f},
-std::array<float,2>{0.735802591f, 0.749590397f},
-std::array<float,2>{0.631825566f, 0.310975701f},
-std::array<float,2>{0.27892983f, 0.790759146f},
-std::array<float,2>{0.221049741f, 0.0723703578f},
-std::array<float,2>{0.974537015f, 0.617667079f},
-std::array<float,2>{0.873478353f, 0.163399518f},
-std::array<float,2>{0.0428295583f, 0.630247533f},
-std::array<float,2>{0.446656764f, 0.391491294f},
-std::array<float,2>{0.619565785f, 0.883195341f},
-std::array<float,2>{0.717461944f, 0.216059223f},
-std::array<float,2>{0.35076195f, 0.692016244f},
-std::array<float,2>{0.166940287f, 0.468833089f},
-std::array<float,2>{0.931970477f, 0.970472217f},
-std::array<float,2>{0.763372481f, 0.334936678f},
-std::array<float,2>{0.0884840265f, 0.85774231f},
-std::array<float,2>{0.379838049f, 0.0334819257f},
-std::array<float,2>{0.5428707f, 0.520411372f},
-std::array<float,2>{0.579661667f, 0.429598689f},
-std::array<float,2>{0.483176559f, 0.930929959f},
-std::array<float,2>{0.0205682833f, 0.139811561f},
-std::array<float,2>{0.840503812f, 0.66351223f},
-std::array<float,2>{0.961606681f, 0.106556214f},
-std::array<float,2>{0.204319149f, 0.577888131f},
-std::array<float,2>{0.305314392f, 0.262803286f},
-std::array<float,2>{0.680422306f, 0.777543724f},
-std::array<float,2>{0.740975916f, 0.120152831f},
-std::array<float,2>{0.335214078f, 0.587067604f},
-std::array<float,2>{0.142675802f, 0.267085314f},
-std::array<float,2>{0.883138597f, 0.754150093f},
-std::array<float,2>{0.80910033f, 0.41693306f},
-std::array<float,2>{0.101824649f, 0.906441689f},
-std::array<float,2>{0.418668479f, 0.15225777f},
-std::array<float,2>{0.530514538f, 0.68382895f},
-std::array<float,2>{0.624232352f, 0.327558428f},
-std::array<float,2>{0.450708002f, 0.8726421f},
-std::array<float,2>{0.0435760953f, 0.0513059162f},
-std::array<float,2>{0.869318545f, 0.510840893f},
-std::array<float,2>{0.971204698f, 0.19520095f},
-std::array<float,2>{0.224553645f, 0.716557384f},
-std::array<float,2>{0.275425255f, 0.491530478f},
-std::array<float,2>{0.625275314f, 0.990940034f},
-std::array<float,2>{0.54351002f, 0.179729164f},
-std::array<float,2>{0.378551275f, 0.644968033f},
-std::array<float,2>{0.0929656327f, 0.381705076f},
-std::array<float,2>{0.758007169f, 0.902328372f},
-std::array<float,2>{0.934786081f, 0.292001456f},
-std::array<float,2>{0.171007246f, 0.804152012f},
-std::array<float,2>{0.347012132f, 0.0914833471f},
-std::array<float,2>{0.712774992f, 0.608661056f},
-std::array<float,2>{0.685825765f, 0.460558057f},
-std::array<float,2>{0.30914858f, 0.961693704f},
-std::array<float,2>{0.207798183f, 0.223201796f},
-std::array<float,2>{0.96605742f, 0.722613513f},
-std::array<float,2>{0.836072385f, 0.0271138716f},
-std::array<float,2>{0.0171120279f, 0.55067116f},
-std::array<float,2>{0.478675812f, 0.36474514f},
-std::array<float,2>{0.585092843f, 0.83011061f},
-std::array<float,2>{0.568916857f, 0.0408026204f},
-std::array<float,2>{0.490582764f, 0.527625978f},
-std::array<float,2>{0.0105191348f, 0.341986686f},
-std::array<float,2>{0.815497637f, 0.845169723f},
-std::array<float,2>{0.943574071f, 0.479881197f},
-std::array<float,2>{0.188521072f, 0.979900539f},
-std::array<float,2>{0.289272189f, 0.204744682f},
-std::array<float,2>{0.66329354f, 0.698473573f},
-std::array<float,2>{0.689172566f, 0.256260157f},
-std::array<float,2>{0.370291352f, 0.77270031f},
-std::array<float,2>{0.187479705f, 0.100467913f},
-std::array<float,2>{0.913720608f, 0.565380931f},
-std::array<float,2>{0.776678681f, 0.125594839f},
-std::array<float,2>{0.065643467f, 0.664899945f},
-std::array<float,2>{0.392157018f, 0.432553709f},
-std::array<float,2>{0.550579548f, 0.922976255f},
-std::array<float,2>{0.649068475f, 0.246800914f},
-std::array<float,2>{0.261683643f, 0.739652991f},
-std::array<float,2>{0.23636575f, 0.443574607f},
-std::array<float,2>{0.993878365f, 0.94455117f},
-std::array<float,2>{0.858882606f, 0.35792318f},
-std::array<float,2>{0.0519961603f, 0.812988341f},
-std::array<float,2>{0.458852232f, 0.000336649449f},
-std::array<float,2>{0.603325903f, 0.53911972f},
-std::array<float,2>{0.511704504f, 0.401911587f},
-std::array<float,2>{0.424896359f, 0.877372026f},
-std::array<float,2>{0.114683725f, 0.170124859f},
-std::array<float,2>{0.78230238f, 0.635406256f},
-std::array<float,2>{0.900680542f, 0.0676131397f},
-std::array<float,2>{0.128142059f, 0.61503917f},
-std::array<float,2>{0.325396866f, 0.302372694f},
-std::array<float,2>{0.724945843f, 0.788344741f},
-std::array<float,2>{0.671052456f, 0.00791808497f},
-std::array<float,2>{0.281310081f, 0.536816478f},
-std::array<float,2>{0.197928831f, 0.346710056f},
-std::array<float,2>{0.94829011f, 0.820963681f},
-std::array<float,2>{0.8231107f, 0.446710944f},
-std::array<float,2>{0.00640432676f, 0.946363688f},
-std::array<float,2>{0.49672237f, 0.237463564f},
-std::array<float,2>{0.571254134f, 0.742875934f},
-std::array<float,2>{0.55618304f, 0.307424277f},
-std::array<float,2>{0.406113356f, 0.795158267f},
-std::array<float,2>{0.0768234357f, 0.0763937086f},
-std::array<float,2>{0.765757382f, 0.622905672f},
-std::array<float,2>{0.914194763f, 0.159450531f},
-std::array<float,2>{0.174452186f, 0.626658678f},
-std::array<float,2>{0.36513111f, 0.395560592f},
-std::array<float,2>{0.695508242f, 0.887671351f},
-std::array<float,2>{0.593788922f, 0.213651195f},
-std::array<float,2>{0.461885661f, 0.688999414f},
-std::array<float,2>{0.061993625f, 0.476051331f},
-std::array<float,2>{0.849839866f, 0.972665191f},
-std::array<float,2>{0.988599181f, 0.328228474f},
-std::array<float,2>{0.242383361f, 0.853749573f},
-std::array<float,2>{0.253519863f, 0.0362021811f},
-std::array<float,2>{0.645556748f, 0.515696764f},
-std::array<float,2>{0.730612159f, 0.422022849f},
-std::array<float,2>{0.313682914f, 0.934480011f},
-std::array<float,2>{0.135092482f, 0.133911043f},
-std::array<float,2>{0.890987873f, 0.658435583f},
-std::array<float,2>{0.795865357f, 0.103595905f},
-std::array<float,2>{0.12140096f, 0.570707023f},
-std::array<float,2>{0.433635622f, 0.260334373f},
-std::array<float,2>{0.505152225f, 0.775036693f},
-std::array<float,2>{0.522281349f, 0.0851057768f},
-std::array<float,2>{0.410118043f, 0.600975156f},
-std::array<float,2>{0.0946997851f, 0.281615108f},
-std::array<float,2>{0.799034834f, 0.81160742f},
-std::array<float,2>{0.88154614f, 0.383200258f},
-std::array<float,2>{0.148534805f, 0.890715778f},
-std::array<float,2>{0.341353506f, 0.179409608f},
-std::array<float,2>{0.748607337f, 0.649655104f},
-std::array<float,2>{0.639163792f, 0.374829203f},
-std::array<float,2>{0.271833599f, 0.838606179f},
-std::array<float,2>{0.230272293f, 0.0180529132f},
-std::array<float,2>{0.979665279f, 0.558044136f},
-std::array<float,2>{0.864014268f, 0.229176983f},
-std::array<float,2>{0.0324075483f, 0.731630504f},
-std::array<float,2>{0.444106549f, 0.464145452f},
-std::array<float,2>{0.614538372f, 0.958171666f},
-std::array<float,2>{0.704046488f, 0.140774965f},
-std::array<float,2>{0.355144858f, 0.677987695f},
-std::array<float,2>{0.159655958f, 0.40648967f},
-std::array<float,2>{0.927177548f, 0.914707065f},
-std::array<float,2>{0.751235962f, 0.277240515f},
-std::array<float,2>{0.0854515582f, 0.762483478f},
-std::array<float,2>{0.388472974f, 0.112799145f},
-std::array<float,2>{0.532206953f, 0.583598018f},
-std::array<float,2>{0.593452334f, 0.493530214f},
-std::array<float,2>{0.475499302f, 0.999606192f},
-std::array<float,2>{0.0287399609f, 0.202549323f},
-std::array<float,2>{0.834185779f, 0.706294894f},
-std::array<float,2>{0.959009528f, 0.0609898008f},
-std::array<float,2>{0.211408824f, 0.501241684f},
-std::array<float,2>{0.297935963f, 0.315508246f},
-std::array<float,2>{0.678596735f, 0.866922855f},
-std::array<float,2>{0.702059329f, 0.0488725118f},
-std::array<float,2>{0.36075905f, 0.515119195f},
-std::array<float,2>{0.17891039f, 0.321424991f},
-std::array<float,2>{0.920990348f, 0.868495584f},
-std::array<float,2>{0.77238512f, 0.487343967f},
-std::array<float,2>{0.0721353963f, 0.987549245f},
-std::array<float,2>{0.400768816f, 0.190864488f},
-std::array<float,2>{0.561661065f, 0.714048207f},
-std::array<float,2>{0.574766695f, 0.269691855f},
-std::array<float,2>{0.495821923f, 0.752343357f},
-std::array<float,2>{0.000825089111f, 0.124713749f},
-std::array<float,2>{0.824880898f, 0.590720892f},
-std::array<float,2>{0.952484548f, 0.154441625f},
-std::array<float,2>{0.201935828f, 0.681985378f},
-std::array<float,2>{0.288877666f, 0.419650406f},
-std::array<float,2>{0.667408884f, 0.913131773f},
-std::array<float,2>{0.502604604f, 0.218956247f},
-std::array<float,2>{0.433490872f, 0.723304927f},
-std::array<float,2>{0.120848075f, 0.455376178f},
-std::array<float,2>{0.79150176f, 0.966276467f},
-std::array<float,2>{0.89673233f, 0.362724036f},
-std::array<float,2>{0.137544632f, 0.832880557f},
-std::array<float,2>{0.317125618f, 0.0291922558f},
-std::array<float,2>{0.729156911f, 0.552146912f},
-std::array<float,2>{0.643921733f, 0.378071725f},
-std::array<float,2>{0.257755876f, 0.905304193f},
-std::array<float,2>{0.248816788f, 0.187014177f},
-std::array<float,2>{0.985484958f, 0.641166389f},
-std::array<float,2>{0.844479859f, 0.0875271484f},
-std::array<float,2>{0.055460453f, 0.604493797f},
-std::array<float,2>{0.465150535f, 0.293130845f},
-std::array<float,2>{0.600527704f, 0.797139287f},
-std::array<float,2>{0.611987531f, 0.0945848152f},
-std::array<float,2>{0.438361317f, 0.569985092f},
-std::array<float,2>{0.0368043296f, 0.25276649f},
-std::array<float,2>{0.861431599f, 0.76673317f},
-std::array<float,2>{0.984239638f, 0.435011148f},
-std::array<float,2>{0.232790634f, 0.925942838f},
-std::array<float,2>{0.266149163f, 0.131203517f},
-std::array<float,2>{0.63437134f, 0.670126855f},
-std::array<float,2>{0.7454319f, 0.336726457f},
-std::array<float,2>{0.339453548f, 0.849247217f},
-std::array<float,2>{0.154477954f, 0.0436316282f},
-std::array<float,2>{0.878302574f, 0.527145088f},
-std::array<float,2>{0.803874552f, 0.207100943f},
-std::array<float,2>{0.0982080251f, 0.699765146f},
-std::array<float,2>{0.411696911f, 0.481520921f},
-std::array<float,2>{0.518037081f, 0.983077824f},
-std::array<float,2>{0.674258351f, 0.165964559f},
-std::array<float,2>{0.302372366f, 0.639856398f},
-std::array<float,2>{0.217763096f, 0.403630286f},
-std::array<float,2>{0.955080807f, 0.881064773f},
-std::array<float,2>{0.829895079f, 0.299643397f},
-std::array<float,2>{0.0259013716f, 0.782768548f},
-std::array<float,2>{0.47009787f, 0.064373143f},
-std::array<float,2>{0.589366019f, 0.612723291f},
-std::array<float,2>{0.538642347f, 0.440838337f},
-std::array<float,2>{0.383198351f, 0.938635707f},
-std::array<float,2>{0.0803660303f, 0.244957089f},
-std::array<float,2>{0.754001021f, 0.734810412f},
-std::array<float,2>{0.925439358f, 0.00468689715f},
-std::array<float,2>{0.161786884f, 0.545373023f},
-std::array<float,2>{0.358010888f, 0.353492141f},
-std::array<float,2>{0.70736593f, 0.817399502f},
-std::array<float,2>{0.630482614f, 0.0737130269f},
-std::array<float,2>{0.280201614f, 0.619032621f},
-std::array<float,2>{0.21892558f, 0.311722994f},
-std::array<float,2>{0.975176573f, 0.789388001f},
-std::array<float,2>{0.871713758f, 0.391939968f},
-std::array<float,2>{0.0402570739f, 0.884296119f},
-std::array<float,2>{0.448261112f, 0.162710518f},
-std::array<float,2>{0.617890179f, 0.629478037f},
-std::array<float,2>{0.527216136f, 0.347901285f},
-std::array<float,2>{0.414513946f, 0.825351954f},
-std::array<float,2>{0.106690489f, 0.0135813486f},
-std::array<float,2>{0.805140436f, 0.532126844f},
-std::array<float,2>{0.889369845f, 0.241618484f},
-std::array<float,2>{0.145287082f, 0.748237431f},
-std::array<float,2>{0.330010206f, 0.449471623f},
-std::array<float,2>{0.736747384f, 0.952737451f},
-std::array<float,2>{0.580469191f, 0.138677701f},
-std::array<float,2>{0.480951309f, 0.662345886f},
-std::array<float,2>{0.0222620703f, 0.427946717f},
-std::array<float,2>{0.84280163f, 0.929999709f},
-std::array<float,2>{0.963613033f, 0.261757135f},
-std::array<float,2>{0.205945641f, 0.778474033f},
-std::array<float,2>{0.307237953f, 0.106115602f},
-std::array<float,2>{0.682737291f, 0.576682329f},
-std::array<float,2>{0.714972973f, 0.470389932f},
-std::array<float,2>{0.348437816f, 0.969639122f},
-std::array<float,2>{0.165129647f, 0.215450749f},
-std::array<float,2>{0.930641174f, 0.693177462f},
-std::array<float,2>{0.764704466f, 0.0342261083f},
-std::array<float,2>{0.0874389261f, 0.521042407f},
-std::array<float,2>{0.382797092f, 0.335495383f},
-std::array<float,2>{0.539738894f, 0.858713984f},
-std::array<float,2>{0.553124487f, 0.0195456669f},
-std::array<float,2>{0.395283401f, 0.558880031f},
-std::array<float,2>{0.0675499216f, 0.36864543f},
-std::array<float,2>{0.780094922f, 0.840893805f},
-std::array<float,2>{0.907214284f, 0.465227783f},
-std::array<float,2>{0.179895267f, 0.954652131f},
-std::array<float,2>{0.373895675f, 0.231684268f},
-std::array<float,2>{0.695183814f, 0.729596317f},
-std::array<float,2>{0.656898677f, 0.286866426f},
-std::array<float,2>{0.295713991f, 0.804722428f},
-std::array<float,2>{0.193357587f, 0.0794702917f},
-std::array<float,2>{0.939696431f, 0.595681548f},
-std::array<float,2>{0.818061054f, 0.174843967f},
-std::array<float,2>{0.0141225029f, 0.654392481f},
-std::array<float,2>{0.484434009f, 0.389503509f},
-std::array<float,2>{0.56291765f, 0.897886574f},
-std::array<float,2>{0.722634315f, 0.195553496f},
-std::array<float,2>{0.321533233f, 0.710446477f},
-std::array<float,2>{0.132198617f, 0.499382973f},
-std::array<float,2>{0.905082703f, 0.992460251f},
-std::array<float,2>{0.786293149f, 0.319157869f},
-std::array<float,2>{0.109487183f, 0.862879336f},
-std::array<float,2>{0.427177131f, 0.0581590682f},
-std::array<float,2>{0.513207078f, 0.505265772f},
-std::array<float,2>{0.606697023f, 0.413980663f},
-std::array<float,2>{0.454081625f, 0.919092655f},
-std::array<float,2>{0.048299212f, 0.148154885f},
-std::array<float,2>{0.853777647f, 0.674853206f},
-std::array<float,2>{0.997165561f, 0.11356464f},
-std::array<float,2>{0.239152819f, 0.58123517f},
-std::array<float,2>{0.265368432f, 0.280766666f},
-std::array<float,2>{0.655196786f, 0.760609686f},
-std::array<float,2>{0.714117706f, 0.0919002593f},
-std::array<float,2>{0.344363064f, 0.605553031f},
-std::array<float,2>{0.169526607f, 0.290156901f},
-std::array<float,2>{0.936363757f, 0.801092029f},
-std::array<float,2>{0.760774255f, 0.37925598f},
-std::array<float,2>{0.0901123509f, 0.899802268f},
-std::array<float,2>{0.376844257f, 0.183355317f},
-std::array<float,2>{0.546460629f, 0.648214221f},
-std::array<float,2>{0.583073914f, 0.365772665f},
-std::array<float,2>{0.477082878f, 0.829293907f},
-std::array<float,2>{0.0178204756f, 0.0244166218f},
-std::array<float,2>{0.839475632f, 0.548520386f},
-std::array<float,2>{0.968500793f, 0.226510078f},
-std::array<float,2>{0.20971182f, 0.720440149f},
-std::array<float,2>{0.311565578f, 0.457306176f},
-std::array<float,2>{0.684025645f, 0.963152289f},
-std::array<float,2>{0.528683186f, 0.14933297f},
-std::array<float,2>{0.42052123f, 0.686516643f},
-std::array<float,2>{0.105075598f, 0.414694071f},
-std::array<float,2>{0.812151968f, 0.908489406f},
-std::array<float,2>{0.885329664f, 0.26850611f},
-std::array<float,2>{0.140801087f, 0.756365299f},
-std::array<float,2>{0.332558841f, 0.117833324f},
-std::array<float,2>{0.739295363f, 0.588978529f},
-std::array<float,2>{0.627294898f, 0.489967912f},
-std::array<float,2>{0.275288463f, 0.988296509f},
-std::array<float,2>{0.226299077f, 0.192571759f},
-std::array<float,2>{0.970628738f, 0.718543231f},
-std::array<float,2>{0.868582249f, 0.0541836023f},
-std::array<float,2>{0.0465958975f, 0.508532763f},
-std::array<float,2>{0.452037692f, 0.326043576f},
-std::array<float,2>{0.622524202f, 0.873926461f},
-std::array<float,2>{0.605452538f, 0.00388203957f},
-std::array<float,2>{0.459235579f, 0.542953193f},
-std::array<float,2>{0.0543586388f, 0.355478972f},
-std::array<float,2>{0.855596185f, 0.814822495f},
-std::array<float,2>{0.994440734f, 0.442871332f},
-std::array<float,2>{0.234527364f, 0.943018258f},
-std::array<float,2>{0.258912027f, 0.249626637f},
-std::array<float,2>{0.650391877f, 0.74080801f},
-std::array<float,2>{0.724335611f, 0.304373562f},
-std::array<float,2>{0.326922506f, 0.786745012f},
-std::array<float,2>{0.12601015f, 0.0695092157f},
-std::array<float,2>{0.899250388f, 0.615960836f},
-std::array<float,2>{0.785074472f, 0.169254541f},
-std::array<float,2>{0.115904488f, 0.63405323f},
-std::array<float,2>{0.421927661f, 0.39970538f},
-std::array<float,2>{0.509168744f, 0.876432717f},
-std::array<float,2>{0.660511971f, 0.205767393f},
-std::array<float,2>{0.29203096f, 0.696854174f},
-std::array<float,2>{0.19088912f, 0.477853984f},
-std::array<float,2>{0.942115724f, 0.977049768f},
-std::array<float,2>{0.812721848f, 0.339892924f},
-std::array<float,2>{0.0097200172f, 0.84647423f},
-std::array<float,2>{0.488346547f, 0.0428353399f},
-std::array<float,2>{0.567660332f, 0.529337108f},
-std::array<float,2>{0.548499525f, 0.431089282f},
-std::array<float,2>{0.394519925f, 0.924289405f},
-std::array<float,2>{0.0634986907f, 0.127646238f},
-std::array<float,2>{0.773456514f, 0.666514337f},
-std::array<float,2>{0.911550403f, 0.0986093804f},
-std::array<float,2>{0.185434967f, 0.563770592f},
-std::array<float,2>{0.367420703f, 0.255811185f},
-std::array<float,2>{0.690274954f, 0.77054739f},
-std::array<float,2>{0.646762431f, 0.0390169993f},
-std::array<float,2>{0.251509666f, 0.517901897f},
-std::array<float,2>{0.245787799f, 0.331214398f},
-std::array<float,2>{0.991721213f, 0.851706564f},
-std::array<float,2>{0.849323571f, 0.473053992f},
-std::array<float,2>{0.0601416267f, 0.976466238f},
-std::array<float,2>{0.463719428f, 0.212709397f},
-std::array<float,2>{0.596641958f, 0.689792812f},
-std::array<float,2>{0.506602168f, 0.258588403f},
-std::array<float,2>{0.43596676f, 0.777007818f},
-std::array<float,2>{0.123416707f, 0.102985121f},
-std::array<float,2>{0.793450594f, 0.574029565f},
-std::array<float,2>{0.894102991f, 0.135376781f},
-std::array<float,2>{0.133903697f, 0.657592654f},
-std::array<float,2>{0.315568805f, 0.423906118f},
-std::array<float,2>{0.732601643f, 0.936893463f},
-std::array<float,2>{0.573652864f, 0.236087888f},
-std::array<float,2>{0.498125494f, 0.745531142f},
-std::array<float,2>{0.00412844634f, 0.448213518f},
-std::array<float,2>{0.821299613f, 0.947932065f},
-std::array<float,2>{0.945539296f, 0.344210982f},
-std::array<float,2>{0.196258962f, 0.822458029f},
-std::array<float,2>{0.284521788f, 0.0104029886f},
-std::array<float,2>{0.669408441f, 0.53743726f},
-std::array<float,2>{0.698098719f, 0.397439301f},
-std::array<float,2>{0.36689207f, 0.889520109f},
-std::array<float,2>{0.172351688f, 0.156794161f},
-std::array<float,2>{0.916923344f, 0.627612114f},
-std::array<float,2>{0.769046485f, 0.0759860277f},
-std::array<float,2>{0.0750094652f, 0.624428868f},
-std::array<float,2>{0.402896196f, 0.305698007f},
-std::array<float,2>{0.556744576f, 0.794784665f},
-std::array<float,2>{0.53385973f, 0.110153764f},
-std::array<float,2>{0.389791131f, 0.584208906f},
-std::array<float,2>{0.0824723616f, 0.274637133f},
-std::array<float,2>{0.753857672f, 0.765543938f},
-std::array<float,2>{0.928805828f, 0.408525944f},
-std::array<float,2>{0.158146307f, 0.91683346f},
-std::array<float,2>{0.352330834f, 0.142691255f},
-std::array<float,2>{0.706864893f, 0.675971985f},
-std::array<float,2>{0.677192211f, 0.312658221f},
-std::array<float,2>{0.299479961f, 0.863441765f},
-std::array<float,2>{0.214125559f, 0.0601526424f},
-std::array<float,2>{0.957979023f, 0.503408194f},
-std::array<float,2>{0.833190978f, 0.200428158f},
-std::array<float,2>{0.0296859872f, 0.704767227f},
-std::array<float,2>{0.474287063f, 0.495363146f},
-std::array<float,2>{0.590735734f, 0.996434033f},
-std::array<float,2>{0.747924209f, 0.175912082f},
-std::array<float,2>{0.342378229f, 0.650744259f},
-std::array<float,2>{0.15213725f, 0.386396646f},
-std::array<float,2>{0.880052805f, 0.893930852f},
-std::array<float,2>{0.797962606f, 0.28327015f},
-std::array<float,2>{0.0974113271f, 0.809093654f},
-std::array<float,2>{0.406897604f, 0.0835542902f},
-std::array<float,2>{0.521389365f, 0.598830223f},
-std::array<float,2>{0.615520537f, 0.462394804f},
-std::array<float,2>{0.44309631f, 0.959255219f},
-std::array<float,2>{0.0332514979f, 0.228327021f},
-std::array<float,2>{0.866620839f, 0.733578742f},
-std::array<float,2>{0.976920187f, 0.0163999684f},
-std::array<float,2>{0.227897465f, 0.554863393f},
-std::array<float,2>{0.269957155f, 0.372024208f},
-std::array<float,2>{0.638627887f, 0.836551309f},
-std::array<float,2>{0.728218675f, 0.0295632109f},
-std::array<float,2>{0.319235474f, 0.554639399f},
-std::array<float,2>{0.140421823f, 0.360003769f},
-std::array<float,2>{0.894960403f, 0.834460855f},
-std::array<float,2>{0.790733337f, 0.454873651f},
-std::array<float,2>{0.117830656f, 0.968123913f},
-std::array<float,2>{0.430955887f, 0.221342102f},
-std::array<float,2>{0.500662446f, 0.725320578f},
-std::array<float,2>{0.598555326f, 0.295401454f},
-std::array<float,2>{0.467371017f, 0.799815953f},
-std::array<float,2>{0.0580039024f, 0.0880024135f},
-std::array<float,2>{0.8463642f, 0.602478504f},
-std::array<float,2>{0.986427426f, 0.185532138f},
-std::array<float,2>{0.246227086f, 0.643321633f},
-std::array<float,2>{0.255772293f, 0.375675499f},
-std::array<float,2>{0.641370177f, 0.902603388f},
-std::array<float,2>{0.559841216f, 0.188669473f},
-std::array<float,2>{0.400076419f, 0.711736798f},
-std::array<float,2>{0.0728263631f, 0.485396385f},
-std::array<float,2>{0.770963252f, 0.986255229f},
-std::array<float,2>{0.918217897f, 0.323736966f},
-std::array<float,2>{0.176998243f, 0.869987011f},
-std::array<float,2>{0.363120735f, 0.0482578203f},
-std::array<float,2>{0.700269103f, 0.512979805f},
-std::array<float,2>{0.66550082f, 0.420853168f},
-std::array<float,2>{0.287004411f, 0.910258532f},
-std::array<float,2>{0.199529275f, 0.153281286f},
-std::array<float,2>{0.949366391f, 0.680402517f},
-std::array<float,2>{0.827784657f, 0.122658178f},
-std::array<float,2>{0.0025310663f, 0.593718886f},
-std::array<float,2>{0.493345171f, 0.272513419f},
-std::array<float,2>{0.577950001f, 0.751331866f},
-std::array<float,2>{0.58602339f, 0.0663866252f},
-std::array<float,2>{0.471437454f, 0.611109257f},
-std::array<float,2>{0.0242638551f, 0.297974765f},
-std::array<float,2>{0.830775261f, 0.785104036f},
-std::array<float,2>{0.953388691f, 0.404832125f},
-std::array<float,2>{0.216685265f, 0.880389392f},
-std::array<float,2>{0.30425635f, 0.167906418f},
-std::array<float,2>{0.672012627f, 0.637963176f},
-std::array<float,2>{0.709138274f, 0.354013979f},
-std::array<float,2>{0.357251048f, 0.818607628f},
-std::array<float,2>{0.162798569f, 0.00652736193f},
-std::array<float,2>{0.923709095f, 0.543268621f},
-std::array<float,2>{0.756817579f, 0.243951991f},
-std::array<float,2>{0.0783655345f, 0.736619949f},
-std::array<float,2>{0.38670823f, 0.438201278f},
-std::array<float,2>{0.536841094f, 0.939793229f},
-std::array<float,2>{0.636184394f, 0.129473075f},
-std::array<float,2>{0.267783135f, 0.668126285f},
-std::array<float,2>{0.232114717f, 0.435963392f},
-std::array<float,2>{0.980672359f, 0.928210378f},
-std::array<float,2>{0.861090004f, 0.250725448f},
-std::array<float,2>{0.0372907631f, 0.767738521f},
-std::array<float,2>{0.440590858f, 0.0964948758f},
-std::array<float,2>{0.609517574f, 0.566535532f},
-std::array<float,2>{0.516980588f, 0.483309597f},
-std::array<float,2>{0.4135333f, 0.982283711f},
-std::array<float,2>{0.100915663f, 0.209138408f},
-std::array<float,2>{0.802033663f, 0.701242328f},
-std::array<float,2>{0.87692529f, 0.04525562f},
-std::array<float,2>{0.154137269f, 0.524464667f},
-std::array<float,2>{0.337096065f, 0.339559019f},
-std::array<float,2>{0.743749499f, 0.851164937f},
-std::array<float,2>{0.6816293f, 0.107731842f},
-std::array<float,2>{0.30661726f, 0.576058209f},
-std::array<float,2>{0.203453213f, 0.263939857f},
-std::array<float,2>{0.962090552f, 0.78056711f},
-std::array<float,2>{0.841705441f, 0.427355319f},
-std::array<float,2>{0.0195414256f, 0.933431029f},
-std::array<float,2>{0.484030455f, 0.137616396f},
-std::array<float,2>{0.578812659f, 0.660748661f},
-std::array<float,2>{0.541575789f, 0.333281994f},
-std::array<float,2>{0.380233586f, 0.85610944f},
-std::array<float,2>{0.0895642862f, 0.0314092115f},
-std::array<float,2>{0.761847854f, 0.52165848f},
-std::array<float,2>{0.933102071f, 0.216963023f},
-std::array<float,2>{0.167633966f, 0.693719923f},
-std::array<float,2>{0.350456953f, 0.4716281f},
-std::array<float,2>{0.718193173f, 0.970962822f},
-std::array<float,2>{0.620908856f, 0.161841869f},
-std::array<float,2>{0.445541501f, 0.631846011f},
-std::array<float,2>{0.0416621789f, 0.393352747f},
-std::array<float,2>{0.874790847f, 0.885252476f},
-std::array<float,2>{0.973325074f, 0.310484529f},
-std::array<float,2>{0.222030744f, 0.792760372f},
-std::array<float,2>{0.278023452f, 0.0708999336f},
-std::array<float,2>{0.632633746f, 0.619349003f},
-std::array<float,2>{0.73531419f, 0.452699453f},
-std::array<float,2>{0.330710769f, 0.950405896f},
-std::array<float,2>{0.148300275f, 0.239729583f},
-std::array<float,2>{0.887396991f, 0.746800721f},
-std::array<float,2>{0.807657301f, 0.014577576f},
-std::array<float,2>{0.109185033f, 0.534685254f},
-std::array<float,2>{0.41770649f, 0.350645572f},
-std::array<float,2>{0.52501744f, 0.826681852f},
-std::array<float,2>{0.514550269f, 0.0553109273f},
-std::array<float,2>{0.42944333f, 0.50617069f},
-std::array<float,2>{0.113210611f, 0.317561895f},
-std::array<float,2>{0.787522256f, 0.8602736f},
-std::array<float,2>{0.902723014f, 0.49682343f},
-std::array<float,2>{0.12991263f, 0.995367229f},
-std::array<float,2>{0.323513567f, 0.198401883f},
-std::array<float,2>{0.718968868f, 0.708609641f},
-std::array<float,2>{0.654084444f, 0.279246837f},
-std::array<float,2>{0.26199165f, 0.759384692f},
-std::array<float,2>{0.241141573f, 0.116144776f},
-std::array<float,2>{0.999994636f, 0.579515696f},
-std::array<float,2>{0.852017343f, 0.144686028f},
-std::array<float,2>{0.0492736958f, 0.673402071f},
-std::array<float,2>{0.455421299f, 0.411230952f},
-std::array<float,2>{0.609008908f, 0.920132518f},
-std::array<float,2>{0.691989243f, 0.234183088f},
-std::array<float,2>{0.372919917f, 0.728213429f},
-std::array<float,2>{0.183293089f, 0.468490243f},
-std::array<float,2>{0.910150588f, 0.956388891f},
-std::array<float,2>{0.77737093f, 0.369892448f},
-std::array<float,2>{0.0694311559f, 0.842386961f},
-std::array<float,2>{0.398205847f, 0.0230131391f},
-std::array<float,2>{0.552515984f, 0.562177896f},
-std::array<float,2>{0.565541148f, 0.388656437f},
-std::array<float,2>{0.487091094f, 0.896440685f},
-std::array<float,2>{0.0120719625f, 0.172291026f},
-std::array<float,2>{0.819061399f, 0.652451992f},
-std::array<float,2>{0.939145088f, 0.0810476169f},
-std::array<float,2>{0.19452107f, 0.597415388f},
-std::array<float,2>{0.294448644f, 0.28864634f},
-std::array<float,2>{0.65969938f, 0.807032287f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.819847524f, 0.82409972f},
-std::array<float,2>{0.00694636907f, 0.400587171f},
-std::array<float,2>{0.549003243f, 0.210187748f},
-std::array<float,2>{0.294227928f, 0.702336073f},
-std::array<float,2>{0.748681068f, 0.590757072f},
-std::array<float,2>{0.400368929f, 0.106557354f},
-std::array<float,2>{0.912366927f, 0.333028823f},
-std::array<float,2>{0.242246643f, 0.954089761f},
-std::array<float,2>{0.988383353f, 0.625829816f},
-std::array<float,2>{0.1515048f, 0.163040385f},
-std::array<float,2>{0.671723664f, 0.445634454f},
-std::array<float,2>{0.476985186f, 0.77098608f},
-std::array<float,2>{0.596764982f, 0.915066242f},
-std::array<float,2>{0.374303192f, 0.253507435f},
-std::array<float,2>{0.774836421f, 0.0501926541f},
-std::array<float,2>{0.110211253f, 0.538726568f},
-std::array<float,2>{0.900847137f, 0.993450463f},
-std::array<float,2>{0.192667693f, 0.359636426f},
-std::array<float,2>{0.714575171f, 0.0902559906f},
-std::array<float,2>{0.436400086f, 0.5982939f},
-std::array<float,2>{0.530132115f, 0.746377528f},
-std::array<float,2>{0.279659867f, 0.226442829f},
-std::array<float,2>{0.867426753f, 0.42407304f},
-std::array<float,2>{0.0325596333f, 0.872262359f},
-std::array<float,2>{0.806208909f, 0.508196175f},
-std::array<float,2>{0.0806664899f, 0.0199170373f},
-std::array<float,2>{0.593174934f, 0.311545968f},
-std::array<float,2>{0.3211689f, 0.900062025f},
-std::array<float,2>{0.655831277f, 0.793724477f},
-std::array<float,2>{0.451485276f, 0.474491447f},
-std::array<float,2>{0.964251518f, 0.151286066f},
-std::array<float,2>{0.179601446f, 0.6760692f},
-std::array<float,2>{0.947413445f, 0.750241876f},
-std::array<float,2>{0.169057399f, 0.463041931f},
-std::array<float,2>{0.635173857f, 0.183130652f},
-std::array<float,2>{0.459142447f, 0.651661277f},
-std::array<float,2>{0.569153428f, 0.553793907f},
-std::array<float,2>{0.335509598f, 0.04645532f},
-std::array<float,2>{0.781814277f, 0.279313505f},
-std::array<float,2>{0.0673980862f, 0.925808072f},
-std::array<float,2>{0.844490051f, 0.704358459f},
-std::array<float,2>{0.0518133044f, 0.202188373f},
-std::array<float,2>{0.507208526f, 0.376867801f},
-std::array<float,2>{0.252907068f, 0.836242557f},
-std::array<float,2>{0.701731026f, 0.941399634f},
-std::array<float,2>{0.410705924f, 0.32610029f},
-std::array<float,2>{0.877235115f, 0.120813161f},
-std::array<float,2>{0.205703586f, 0.57188791f},
-std::array<float,2>{0.760514021f, 0.887466908f},
-std::array<float,2>{0.093821153f, 0.283362508f},
-std::array<float,2>{0.61796397f, 0.00455823587f},
-std::array<float,2>{0.355700701f, 0.516203165f},
-std::array<float,2>{0.680370092f, 0.663869083f},
-std::array<float,2>{0.491786808f, 0.131858349f},
-std::array<float,2>{0.976459205f, 0.496440887f},
-std::array<float,2>{0.138513595f, 0.805307865f},
-std::array<float,2>{0.936858177f, 0.611430228f},
-std::array<float,2>{0.225247666f, 0.0702193975f},
-std::array<float,2>{0.732125819f, 0.353797227f},
-std::array<float,2>{0.38662824f, 0.981468976f},
-std::array<float,2>{0.54070878f, 0.854425251f},
-std::array<float,2>{0.306335539f, 0.406328559f},
-std::array<float,2>{0.838766634f, 0.243516445f},
-std::array<float,2>{0.0284521114f, 0.724971235f},
-std::array<float,2>{0.793621421f, 0.799816608f},
-std::array<float,2>{0.0705186427f, 0.48437959f},
-std::array<float,2>{0.575696051f, 0.140584141f},
-std::array<float,2>{0.336326927f, 0.668755949f},
-std::array<float,2>{0.626073539f, 0.52476877f},
-std::array<float,2>{0.465471208f, 0.00902806409f},
-std::array<float,2>{0.93790555f, 0.296736062f},
-std::array<float,2>{0.162281632f, 0.878557682f},
-std::array<float,2>{0.888228238f, 0.730166793f},
-std::array<float,2>{0.218596488f, 0.24194546f},
-std::array<float,2>{0.69411546f, 0.415703744f},
-std::array<float,2>{0.415764809f, 0.849216163f},
-std::array<float,2>{0.514481127f, 0.972858787f},
-std::array<float,2>{0.262192756f, 0.348806262f},
-std::array<float,2>{0.856113493f, 0.0760716721f},
-std::array<float,2>{0.0587124005f, 0.624947727f},
-std::array<float,2>{0.978236616f, 0.931159616f},
-std::array<float,2>{0.131692156f, 0.271123528f},
-std::array<float,2>{0.67288202f, 0.0337913148f},
-std::array<float,2>{0.498749524f, 0.557326853f},
-std::array<float,2>{0.61260426f, 0.642998338f},
-std::array<float,2>{0.346970439f, 0.176025361f},
-std::array<float,2>{0.753940344f, 0.453623503f},
-std::array<float,2>{0.106463261f, 0.765053153f},
-std::array<float,2>{0.835577667f, 0.562514246f},
-std::array<float,2>{0.0220365357f, 0.115467042f},
-std::array<float,2>{0.53700757f, 0.317092925f},
-std::array<float,2>{0.29929015f, 0.948854148f},
-std::array<float,2>{0.726275563f, 0.829442978f},
-std::array<float,2>{0.382567883f, 0.385311365f},
-std::array<float,2>{0.921970487f, 0.189226151f},
-std::array<float,2>{0.229663193f, 0.7185691f},
-std::array<float,2>{0.919558465f, 0.859535992f},
-std::array<float,2>{0.240239233f, 0.434108883f},
-std::array<float,2>{0.73963958f, 0.231859609f},
-std::array<float,2>{0.392303944f, 0.73789686f},
-std::array<float,2>{0.558854461f, 0.602663159f},
-std::array<float,2>{0.288472831f, 0.0782211795f},
-std::array<float,2>{0.825923979f, 0.372212201f},
-std::array<float,2>{0.00950371195f, 0.988145947f},
-std::array<float,2>{0.768109441f, 0.681934237f},
-std::array<float,2>{0.120427139f, 0.144924417f},
-std::array<float,2>{0.604521334f, 0.481232166f},
-std::array<float,2>{0.362791628f, 0.78655082f},
-std::array<float,2>{0.660256863f, 0.891787946f},
-std::array<float,2>{0.475669473f, 0.299103618f},
-std::array<float,2>{0.99759084f, 0.0252578277f},
-std::array<float,2>{0.146441296f, 0.506189108f},
-std::array<float,2>{0.866429329f, 0.963717699f},
-std::array<float,2>{0.0433308557f, 0.342730492f},
-std::array<float,2>{0.521170676f, 0.0975086913f},
-std::array<float,2>{0.273053139f, 0.578825355f},
-std::array<float,2>{0.710320652f, 0.693043292f},
-std::array<float,2>{0.42539233f, 0.216623589f},
-std::array<float,2>{0.896322906f, 0.391088963f},
-std::array<float,2>{0.198335096f, 0.816866219f},
-std::array<float,2>{0.958882749f, 0.546775639f},
-std::array<float,2>{0.180929482f, 0.056726519f},
-std::array<float,2>{0.642427981f, 0.264130175f},
-std::array<float,2>{0.442963302f, 0.907589912f},
-std::array<float,2>{0.584355056f, 0.777343333f},
-std::array<float,2>{0.313928425f, 0.440369487f},
-std::array<float,2>{0.799039245f, 0.169024855f},
-std::array<float,2>{0.0927253515f, 0.635753453f},
-std::array<float,2>{0.85367465f, 0.76578629f},
-std::array<float,2>{0.0557616651f, 0.452244818f},
-std::array<float,2>{0.508812964f, 0.160077378f},
-std::array<float,2>{0.260561347f, 0.630764365f},
-std::array<float,2>{0.687510312f, 0.534661055f},
-std::array<float,2>{0.420834154f, 0.0542844199f},
-std::array<float,2>{0.886138618f, 0.25430873f},
-std::array<float,2>{0.213972345f, 0.918717384f},
-std::array<float,2>{0.942292273f, 0.697192132f},
-std::array<float,2>{0.159735695f, 0.204767928f},
-std::array<float,2>{0.629438579f, 0.40346548f},
-std::array<float,2>{0.463232785f, 0.826674998f},
-std::array<float,2>{0.571531057f, 0.960686624f},
-std::array<float,2>{0.34267953f, 0.328313321f},
-std::array<float,2>{0.79290247f, 0.103067204f},
-std::array<float,2>{0.0748442486f, 0.586462498f},
-std::array<float,2>{0.926213622f, 0.902992308f},
-std::array<float,2>{0.233523175f, 0.306002378f},
-std::array<float,2>{0.71894151f, 0.0175416116f},
-std::array<float,2>{0.378004223f, 0.515042067f},
-std::array<float,2>{0.533538461f, 0.67206949f},
-std::array<float,2>{0.30183658f, 0.152683109f},
-std::array<float,2>{0.82840091f, 0.472000122f},
-std::array<float,2>{0.017614929f, 0.792292356f},
-std::array<float,2>{0.75210017f, 0.597062886f},
-std::array<float,2>{0.102403536f, 0.0889581963f},
-std::array<float,2>{0.613582492f, 0.365484893f},
-std::array<float,2>{0.351183146f, 0.999277413f},
-std::array<float,2>{0.675931692f, 0.868529856f},
-std::array<float,2>{0.496069938f, 0.429224938f},
-std::array<float,2>{0.981417835f, 0.220189497f},
-std::array<float,2>{0.128024057f, 0.744102538f},
-std::array<float,2>{0.994136453f, 0.843243062f},
-std::array<float,2>{0.142664284f, 0.382207245f},
-std::array<float,2>{0.658330619f, 0.195661828f},
-std::array<float,2>{0.468904525f, 0.709973931f},
-std::array<float,2>{0.608992577f, 0.577358842f},
-std::array<float,2>{0.365612596f, 0.121722162f},
-std::array<float,2>{0.770058155f, 0.322134137f},
-std::array<float,2>{0.124504305f, 0.942934275f},
-std::array<float,2>{0.822784245f, 0.65622586f},
-std::array<float,2>{0.0146367811f, 0.186998636f},
-std::array<float,2>{0.556209624f, 0.468052089f},
-std::array<float,2>{0.283557683f, 0.75688076f},
-std::array<float,2>{0.736808777f, 0.922954261f},
-std::array<float,2>{0.397919506f, 0.277337372f},
-std::array<float,2>{0.914505184f, 0.0414761454f},
-std::array<float,2>{0.235037312f, 0.547376573f},
-std::array<float,2>{0.802299917f, 0.978260934f},
-std::array<float,2>{0.0895141512f, 0.357791811f},
-std::array<float,2>{0.578904688f, 0.06586954f},
-std::array<float,2>{0.316900343f, 0.616806507f},
-std::array<float,2>{0.645350158f, 0.719814241f},
-std::array<float,2>{0.439819455f, 0.247649446f},
-std::array<float,2>{0.956431329f, 0.41380772f},
-std::array<float,2>{0.187221944f, 0.856359959f},
-std::array<float,2>{0.893051207f, 0.521156073f},
-std::array<float,2>{0.200868994f, 0.00226775231f},
-std::array<float,2>{0.705416918f, 0.28623122f},
-std::array<float,2>{0.426022202f, 0.883580446f},
-std::array<float,2>{0.518480361f, 0.810638487f},
-std::array<float,2>{0.268297225f, 0.493048191f},
-std::array<float,2>{0.862624168f, 0.125265196f},
-std::array<float,2>{0.0414176993f, 0.657016695f},
-std::array<float,2>{0.778578937f, 0.846863866f},
-std::array<float,2>{0.113939077f, 0.419449776f},
-std::array<float,2>{0.60097748f, 0.236141294f},
-std::array<float,2>{0.370203793f, 0.731100082f},
-std::array<float,2>{0.66586858f, 0.619521976f},
-std::array<float,2>{0.482682914f, 0.0741729066f},
-std::array<float,2>{0.987831235f, 0.347587526f},
-std::array<float,2>{0.152456343f, 0.97250241f},
-std::array<float,2>{0.910141706f, 0.665987551f},
-std::array<float,2>{0.247905567f, 0.136575654f},
-std::array<float,2>{0.74597007f, 0.491594821f},
-std::array<float,2>{0.405402899f, 0.801675379f},
-std::array<float,2>{0.553173423f, 0.880241752f},
-std::array<float,2>{0.29033488f, 0.289573848f},
-std::array<float,2>{0.812903881f, 0.0135034407f},
-std::array<float,2>{0.000112363698f, 0.530379832f},
-std::array<float,2>{0.967095673f, 0.951455593f},
-std::array<float,2>{0.172761545f, 0.312699437f},
-std::array<float,2>{0.65216583f, 0.111721925f},
-std::array<float,2>{0.44774577f, 0.566505969f},
-std::array<float,2>{0.58597976f, 0.712264359f},
-std::array<float,2>{0.326454461f, 0.191856444f},
-std::array<float,2>{0.811963022f, 0.388250232f},
-std::array<float,2>{0.0856113881f, 0.835497975f},
-std::array<float,2>{0.872885168f, 0.559331477f},
-std::array<float,2>{0.0382741131f, 0.0369308554f},
-std::array<float,2>{0.526128292f, 0.267773718f},
-std::array<float,2>{0.273829907f, 0.935840368f},
-std::array<float,2>{0.717742383f, 0.758102417f},
-std::array<float,2>{0.43309781f, 0.460341632f},
-std::array<float,2>{0.903357148f, 0.171971321f},
-std::array<float,2>{0.191336378f, 0.64688319f},
-std::array<float,2>{0.879037559f, 0.782769144f},
-std::array<float,2>{0.20800221f, 0.478539735f},
-std::array<float,2>{0.697144985f, 0.143132269f},
-std::array<float,2>{0.408928245f, 0.687473774f},
-std::array<float,2>{0.502550066f, 0.501794994f},
-std::array<float,2>{0.255580604f, 0.0276570991f},
-std::array<float,2>{0.850615799f, 0.302519828f},
-std::array<float,2>{0.049780339f, 0.895438969f},
-std::array<float,2>{0.786656916f, 0.741441488f},
-std::array<float,2>{0.0625188574f, 0.230159208f},
-std::array<float,2>{0.565503597f, 0.429746449f},
-std::array<float,2>{0.331962705f, 0.866363406f},
-std::array<float,2>{0.639793158f, 0.990607858f},
-std::array<float,2>{0.454581589f, 0.367492646f},
-std::array<float,2>{0.951909542f, 0.0832920074f},
-std::array<float,2>{0.165530324f, 0.605498016f},
-std::array<float,2>{0.842653394f, 0.911426961f},
-std::array<float,2>{0.0240439158f, 0.258674026f},
-std::array<float,2>{0.545458555f, 0.0621159934f},
-std::array<float,2>{0.310708314f, 0.53952229f},
-std::array<float,2>{0.728220701f, 0.639997363f},
-std::array<float,2>{0.38830173f, 0.164948985f},
-std::array<float,2>{0.931933045f, 0.445230991f},
-std::array<float,2>{0.219794646f, 0.78114593f},
-std::array<float,2>{0.969968677f, 0.584431171f},
-std::array<float,2>{0.133238852f, 0.0985300317f},
-std::array<float,2>{0.684216261f, 0.336565077f},
-std::array<float,2>{0.486010492f, 0.966111004f},
-std::array<float,2>{0.621797144f, 0.81344372f},
-std::array<float,2>{0.354963541f, 0.395552754f},
-std::array<float,2>{0.764522314f, 0.213655308f},
-std::array<float,2>{0.100607768f, 0.690333903f},
-std::array<float,2>{0.870586038f, 0.87458241f},
-std::array<float,2>{0.0338876694f, 0.423232168f},
-std::array<float,2>{0.527730644f, 0.223697588f},
-std::array<float,2>{0.277623743f, 0.748405814f},
-std::array<float,2>{0.712281168f, 0.600043893f},
-std::array<float,2>{0.435445935f, 0.0920879468f},
-std::array<float,2>{0.89850229f, 0.362372398f},
-std::array<float,2>{0.194488451f, 0.995364547f},
-std::array<float,2>{0.962531805f, 0.679332852f},
-std::array<float,2>{0.176824793f, 0.149634138f},
-std::array<float,2>{0.653033912f, 0.474840671f},
-std::array<float,2>{0.449583709f, 0.795822442f},
-std::array<float,2>{0.590338826f, 0.900742054f},
-std::array<float,2>{0.323774159f, 0.309592634f},
-std::array<float,2>{0.808548868f, 0.0227258857f},
-std::array<float,2>{0.0793503076f, 0.511518896f},
-std::array<float,2>{0.912072957f, 0.955163002f},
-std::array<float,2>{0.245423064f, 0.335521519f},
-std::array<float,2>{0.747680306f, 0.10747309f},
-std::array<float,2>{0.400755614f, 0.593424022f},
-std::array<float,2>{0.548569381f, 0.700115263f},
-std::array<float,2>{0.295118123f, 0.208088353f},
-std::array<float,2>{0.817927957f, 0.39947474f},
-std::array<float,2>{0.00401545921f, 0.820614696f},
-std::array<float,2>{0.775837123f, 0.535785437f},
-std::array<float,2>{0.111347735f, 0.0487292111f},
-std::array<float,2>{0.594224036f, 0.250349015f},
-std::array<float,2>{0.372679293f, 0.916620016f},
-std::array<float,2>{0.668595731f, 0.772576928f},
-std::array<float,2>{0.4799577f, 0.448965341f},
-std::array<float,2>{0.99207139f, 0.16071339f},
-std::array<float,2>{0.14995864f, 0.628407836f},
-std::array<float,2>{0.972921193f, 0.808221757f},
-std::array<float,2>{0.138871804f, 0.49909696f},
-std::array<float,2>{0.68332094f, 0.130588204f},
-std::array<float,2>{0.489737511f, 0.661791146f},
-std::array<float,2>{0.619906187f, 0.519474864f},
-std::array<float,2>{0.358584046f, 0.0071108113f},
-std::array<float,2>{0.759110212f, 0.281997561f},
-std::array<float,2>{0.0958316475f, 0.88946861f},
-std::array<float,2>{0.837150991f, 0.723729849f},
-std::array<float,2>{0.0305967014f, 0.2453558f},
-std::array<float,2>{0.542951822f, 0.409723163f},
-std::array<float,2>{0.308126539f, 0.85267514f},
-std::array<float,2>{0.733352005f, 0.983685434f},
-std::array<float,2>{0.382884264f, 0.352390945f},
-std::array<float,2>{0.935030103f, 0.0680315197f},
-std::array<float,2>{0.223195136f, 0.610056639f},
-std::array<float,2>{0.783826053f, 0.928969502f},
-std::array<float,2>{0.0687769428f, 0.279139131f},
-std::array<float,2>{0.567032337f, 0.0434615687f},
-std::array<float,2>{0.332235068f, 0.550926328f},
-std::array<float,2>{0.633353889f, 0.648733318f},
-std::array<float,2>{0.458145469f, 0.181575015f},
-std::array<float,2>{0.945572615f, 0.461440384f},
-std::array<float,2>{0.170272902f, 0.75260818f},
-std::array<float,2>{0.876470685f, 0.573329926f},
-std::array<float,2>{0.203716844f, 0.118568026f},
-std::array<float,2>{0.701130331f, 0.327553451f},
-std::array<float,2>{0.412979782f, 0.937814832f},
-std::array<float,2>{0.505141675f, 0.839653909f},
-std::array<float,2>{0.250175714f, 0.377835363f},
-std::array<float,2>{0.846102178f, 0.20009248f},
-std::array<float,2>{0.0530162714f, 0.706982493f},
-std::array<float,2>{0.757143557f, 0.763519585f},
-std::array<float,2>{0.108326666f, 0.456218481f},
-std::array<float,2>{0.610612988f, 0.178708866f},
-std::array<float,2>{0.344081312f, 0.640678346f},
-std::array<float,2>{0.675476789f, 0.554842234f},
-std::array<float,2>{0.496863216f, 0.0317094065f},
-std::array<float,2>{0.980130851f, 0.273347288f},
-std::array<float,2>{0.130080223f, 0.932056427f},
-std::array<float,2>{0.924718738f, 0.716468453f},
-std::array<float,2>{0.227481902f, 0.190928876f},
-std::array<float,2>{0.723200738f, 0.383574694f},
-std::array<float,2>{0.379635543f, 0.830962837f},
-std::array<float,2>{0.538877428f, 0.946629405f},
-std::array<float,2>{0.298181146f, 0.319253683f},
-std::array<float,2>{0.832174778f, 0.115090124f},
-std::array<float,2>{0.0203032009f, 0.565086186f},
-std::array<float,2>{0.939746499f, 0.875309467f},
-std::array<float,2>{0.161048517f, 0.29446125f},
-std::array<float,2>{0.627255559f, 0.0110485116f},
-std::array<float,2>{0.467342883f, 0.527013898f},
-std::array<float,2>{0.577023149f, 0.671515584f},
-std::array<float,2>{0.338469684f, 0.136957332f},
-std::array<float,2>{0.795774937f, 0.488131225f},
-std::array<float,2>{0.0733710974f, 0.797527671f},
-std::array<float,2>{0.858630538f, 0.621587098f},
-std::array<float,2>{0.0607164502f, 0.0773685202f},
-std::array<float,2>{0.511875689f, 0.350705266f},
-std::array<float,2>{0.264508218f, 0.975691736f},
-std::array<float,2>{0.692326546f, 0.851504683f},
-std::array<float,2>{0.416058332f, 0.416771829f},
-std::array<float,2>{0.889891565f, 0.240104884f},
-std::array<float,2>{0.216746584f, 0.728170335f},
-std::array<float,2>{0.898152292f, 0.818457007f},
-std::array<float,2>{0.195415333f, 0.393710464f},
-std::array<float,2>{0.707859397f, 0.217656091f},
-std::array<float,2>{0.423293114f, 0.694277942f},
-std::array<float,2>{0.522610247f, 0.581474304f},
-std::array<float,2>{0.270184845f, 0.0943249837f},
-std::array<float,2>{0.864118278f, 0.3404966f},
-std::array<float,2>{0.0461424254f, 0.961871803f},
-std::array<float,2>{0.798761547f, 0.632945001f},
-std::array<float,2>{0.0916564614f, 0.171763256f},
-std::array<float,2>{0.583627522f, 0.438203901f},
-std::array<float,2>{0.315401703f, 0.774674833f},
-std::array<float,2>{0.643862247f, 0.908440828f},
-std::array<float,2>{0.444865823f, 0.263110667f},
-std::array<float,2>{0.960037589f, 0.0561210588f},
-std::array<float,2>{0.181829199f, 0.544290364f},
-std::array<float,2>{0.827781498f, 0.98516345f},
-std::array<float,2>{0.0100160707f, 0.373759329f},
-std::array<float,2>{0.560829222f, 0.0808568001f},
-std::array<float,2>{0.286853701f, 0.604489684f},
-std::array<float,2>{0.741182566f, 0.736113131f},
-std::array<float,2>{0.393821031f, 0.233079419f},
-std::array<float,2>{0.921591878f, 0.437342823f},
-std::array<float,2>{0.239864498f, 0.861459434f},
-std::array<float,2>{0.999933422f, 0.505070984f},
-std::array<float,2>{0.147206098f, 0.0256306194f},
-std::array<float,2>{0.663468182f, 0.298759699f},
-std::array<float,2>{0.474075764f, 0.892592728f},
-std::array<float,2>{0.602705836f, 0.787675321f},
-std::array<float,2>{0.360206783f, 0.484165996f},
-std::array<float,2>{0.766912103f, 0.146556005f},
-std::array<float,2>{0.117892019f, 0.680754483f},
-std::array<float,2>{0.830637455f, 0.789309263f},
-std::array<float,2>{0.0163249299f, 0.470390379f},
-std::array<float,2>{0.531888187f, 0.155929223f},
-std::array<float,2>{0.302986652f, 0.674311459f},
-std::array<float,2>{0.721210539f, 0.513633251f},
-std::array<float,2>{0.375402719f, 0.0176546462f},
-std::array<float,2>{0.927806854f, 0.308416724f},
-std::array<float,2>{0.230556533f, 0.905667722f},
-std::array<float,2>{0.983077645f, 0.744915009f},
-std::array<float,2>{0.126004338f, 0.220713973f},
-std::array<float,2>{0.678492725f, 0.425949633f},
-std::array<float,2>{0.493702352f, 0.869687974f},
-std::array<float,2>{0.615848601f, 0.997001648f},
-std::array<float,2>{0.347729117f, 0.364759237f},
-std::array<float,2>{0.751945496f, 0.0862109065f},
-std::array<float,2>{0.104143567f, 0.595237374f},
-std::array<float,2>{0.884311616f, 0.920473754f},
-std::array<float,2>{0.212205678f, 0.257137835f},
-std::array<float,2>{0.690025926f, 0.0521762185f},
-std::array<float,2>{0.419389278f, 0.53128159f},
-std::array<float,2>{0.510424733f, 0.631715953f},
-std::array<float,2>{0.258936226f, 0.157365352f},
-std::array<float,2>{0.853478074f, 0.449968904f},
-std::array<float,2>{0.0573284291f, 0.768508077f},
-std::array<float,2>{0.790127575f, 0.588079393f},
-std::array<float,2>{0.0778759271f, 0.103906445f},
-std::array<float,2>{0.573786557f, 0.330678731f},
-std::array<float,2>{0.340365022f, 0.957343936f},
-std::array<float,2>{0.630931079f, 0.82547617f},
-std::array<float,2>{0.46193704f, 0.404398143f},
-std::array<float,2>{0.944886088f, 0.206746355f},
-std::array<float,2>{0.158172041f, 0.69838661f},
-std::array<float,2>{0.953727782f, 0.85895133f},
-std::array<float,2>{0.184039429f, 0.410753399f},
-std::array<float,2>{0.646754146f, 0.249277577f},
-std::array<float,2>{0.439297974f, 0.722176075f},
-std::array<float,2>{0.580295861f, 0.614861548f},
-std::array<float,2>{0.319022149f, 0.0638067871f},
-std::array<float,2>{0.803299308f, 0.356237471f},
-std::array<float,2>{0.0874002799f, 0.98008132f},
-std::array<float,2>{0.859761715f, 0.659218073f},
-std::array<float,2>{0.0403381363f, 0.127574921f},
-std::array<float,2>{0.515927672f, 0.494589895f},
-std::array<float,2>{0.267441332f, 0.809282243f},
-std::array<float,2>{0.704605997f, 0.885135531f},
-std::array<float,2>{0.427760184f, 0.28713572f},
-std::array<float,2>{0.891308129f, 0.00142631994f},
-std::array<float,2>{0.203025386f, 0.522661984f},
-std::array<float,2>{0.772833407f, 0.943889141f},
-std::array<float,2>{0.122408591f, 0.323188066f},
-std::array<float,2>{0.605670691f, 0.124704339f},
-std::array<float,2>{0.364883095f, 0.57494241f},
-std::array<float,2>{0.656417549f, 0.707043588f},
-std::array<float,2>{0.471878618f, 0.198320836f},
-std::array<float,2>{0.995215714f, 0.379190594f},
-std::array<float,2>{0.141648144f, 0.840889275f},
-std::array<float,2>{0.916056693f, 0.550426126f},
-std::array<float,2>{0.238112763f, 0.0404030941f},
-std::array<float,2>{0.73529917f, 0.275170058f},
-std::array<float,2>{0.395247996f, 0.925496876f},
-std::array<float,2>{0.556840599f, 0.755835712f},
-std::array<float,2>{0.281306803f, 0.465582192f},
-std::array<float,2>{0.821570218f, 0.184411317f},
-std::array<float,2>{0.012422001f, 0.652347386f},
-std::array<float,2>{0.810011864f, 0.832260072f},
-std::array<float,2>{0.0839034766f, 0.390590578f},
-std::array<float,2>{0.589410126f, 0.193707824f},
-std::array<float,2>{0.325775027f, 0.712973773f},
-std::array<float,2>{0.648779035f, 0.569470763f},
-std::array<float,2>{0.445810139f, 0.109703526f},
-std::array<float,2>{0.966599882f, 0.315163702f},
-std::array<float,2>{0.17518127f, 0.949980497f},
-std::array<float,2>{0.905093133f, 0.645815849f},
-std::array<float,2>{0.188153058f, 0.174419329f},
-std::array<float,2>{0.716371059f, 0.457082808f},
-std::array<float,2>{0.431235909f, 0.761557698f},
-std::array<float,2>{0.524408698f, 0.933779359f},
-std::array<float,2>{0.27708298f, 0.266299844f},
-std::array<float,2>{0.874212861f, 0.0378748141f},
-std::array<float,2>{0.0361355878f, 0.562027514f},
-std::array<float,2>{0.986202121f, 0.970099926f},
-std::array<float,2>{0.155200377f, 0.345603526f},
-std::array<float,2>{0.666495502f, 0.0722468942f},
-std::array<float,2>{0.482136518f, 0.619029343f},
-std::array<float,2>{0.598295212f, 0.733953238f},
-std::array<float,2>{0.36780709f, 0.237283885f},
-std::array<float,2>{0.77989912f, 0.421634465f},
-std::array<float,2>{0.115605347f, 0.845659316f},
-std::array<float,2>{0.81495589f, 0.527995288f},
-std::array<float,2>{0.00280342228f, 0.0137067782f},
-std::array<float,2>{0.551911354f, 0.291105717f},
-std::array<float,2>{0.29164198f, 0.880886495f},
-std::array<float,2>{0.742406249f, 0.803634405f},
-std::array<float,2>{0.402755469f, 0.489982486f},
-std::array<float,2>{0.90701735f, 0.134207845f},
-std::array<float,2>{0.249055445f, 0.666888475f},
-std::array<float,2>{0.931073964f, 0.777770698f},
-std::array<float,2>{0.2212497f, 0.443212837f},
-std::array<float,2>{0.729200304f, 0.16625075f},
-std::array<float,2>{0.389379263f, 0.638002634f},
-std::array<float,2>{0.544389486f, 0.542754114f},
-std::array<float,2>{0.309168994f, 0.0600142106f},
-std::array<float,2>{0.84035939f, 0.261003673f},
-std::array<float,2>{0.0263279732f, 0.91355598f},
-std::array<float,2>{0.763515353f, 0.689214051f},
-std::array<float,2>{0.0985105187f, 0.212824881f},
-std::array<float,2>{0.623631477f, 0.397101223f},
-std::array<float,2>{0.353392094f, 0.815160096f},
-std::array<float,2>{0.686031997f, 0.967036486f},
-std::array<float,2>{0.488101512f, 0.339732111f},
-std::array<float,2>{0.972308636f, 0.10127911f},
-std::array<float,2>{0.135741413f, 0.583533287f},
-std::array<float,2>{0.848414958f, 0.896746993f},
-std::array<float,2>{0.0475556701f, 0.303711623f},
-std::array<float,2>{0.501288831f, 0.0294920467f},
-std::array<float,2>{0.256769776f, 0.502842426f},
-std::array<float,2>{0.69849807f, 0.685257256f},
-std::array<float,2>{0.407206535f, 0.142209485f},
-std::array<float,2>{0.882595599f, 0.477173626f},
-std::array<float,2>{0.210226133f, 0.784119844f},
-std::array<float,2>{0.950859308f, 0.609358609f},
-std::array<float,2>{0.167871654f, 0.0858937651f},
-std::array<float,2>{0.637986243f, 0.370610923f},
-std::array<float,2>{0.456485689f, 0.989539206f},
-std::array<float,2>{0.563718319f, 0.864030361f},
-std::array<float,2>{0.32991457f, 0.432796389f},
-std::array<float,2>{0.787343144f, 0.228435159f},
-std::array<float,2>{0.0660551116f, 0.739072859f},
-std::array<float,2>{0.847111166f, 0.837694108f},
-std::array<float,2>{0.0541226864f, 0.375418156f},
-std::array<float,2>{0.504085183f, 0.201683089f},
-std::array<float,2>{0.251255691f, 0.703477085f},
-std::array<float,2>{0.699953079f, 0.570698798f},
-std::array<float,2>{0.413492829f, 0.119498774f},
-std::array<float,2>{0.875399053f, 0.324708641f},
-std::array<float,2>{0.205016404f, 0.939670026f},
-std::array<float,2>{0.946888447f, 0.650414169f},
-std::array<float,2>{0.171308249f, 0.182423726f},
-std::array<float,2>{0.634503961f, 0.464526832f},
-std::array<float,2>{0.45729354f, 0.751865864f},
-std::array<float,2>{0.567624152f, 0.927035928f},
-std::array<float,2>{0.333172113f, 0.280297041f},
-std::array<float,2>{0.784908235f, 0.0455225855f},
-std::array<float,2>{0.0698117465f, 0.553510368f},
-std::array<float,2>{0.933777332f, 0.981252432f},
-std::array<float,2>{0.224409267f, 0.3551687f},
-std::array<float,2>{0.733686864f, 0.0688300654f},
-std::array<float,2>{0.38430056f, 0.612821937f},
-std::array<float,2>{0.541509509f, 0.725634038f},
-std::array<float,2>{0.306790024f, 0.242542937f},
-std::array<float,2>{0.836703837f, 0.407740325f},
-std::array<float,2>{0.0301181562f, 0.855250716f},
-std::array<float,2>{0.758418322f, 0.516654611f},
-std::array<float,2>{0.0968767926f, 0.00523439655f},
-std::array<float,2>{0.621059358f, 0.285144269f},
-std::array<float,2>{0.357842803f, 0.888563156f},
-std::array<float,2>{0.681751132f, 0.805805922f},
-std::array<float,2>{0.489134759f, 0.497900724f},
-std::array<float,2>{0.974200189f, 0.131034777f},
-std::array<float,2>{0.140074879f, 0.662777841f},
-std::array<float,2>{0.990707874f, 0.769770086f},
-std::array<float,2>{0.148922056f, 0.447147161f},
-std::array<float,2>{0.669024527f, 0.163598746f},
-std::array<float,2>{0.479374677f, 0.626770794f},
-std::array<float,2>{0.595457256f, 0.537239134f},
-std::array<float,2>{0.371189326f, 0.0494911224f},
-std::array<float,2>{0.777060509f, 0.252672285f},
-std::array<float,2>{0.112524115f, 0.915021241f},
-std::array<float,2>{0.816509485f, 0.701677024f},
-std::array<float,2>{0.00566897541f, 0.209096193f},
-std::array<float,2>{0.547068715f, 0.402206838f},
-std::array<float,2>{0.296223521f, 0.822297096f},
-std::array<float,2>{0.746773779f, 0.955022395f},
-std::array<float,2>{0.401748866f, 0.332172006f},
-std::array<float,2>{0.910633802f, 0.10580682f},
-std::array<float,2>{0.245021001f, 0.591604412f},
-std::array<float,2>{0.807320356f, 0.898852527f},
-std::array<float,2>{0.0786544681f, 0.31079191f},
-std::array<float,2>{0.591120601f, 0.0210970901f},
-std::array<float,2>{0.322487354f, 0.508961499f},
-std::array<float,2>{0.653911531f, 0.677636027f},
-std::array<float,2>{0.450746447f, 0.152293652f},
-std::array<float,2>{0.960976183f, 0.472844362f},
-std::array<float,2>{0.176087901f, 0.79482305f},
-std::array<float,2>{0.900058508f, 0.599549413f},
-std::array<float,2>{0.193506554f, 0.0910909325f},
-std::array<float,2>{0.71142602f, 0.360381484f},
-std::array<float,2>{0.434026957f, 0.99251771f},
-std::array<float,2>{0.529071748f, 0.871921241f},
-std::array<float,2>{0.27922219f, 0.425494999f},
-std::array<float,2>{0.869562685f, 0.225384548f},
-std::array<float,2>{0.0341911465f, 0.748005033f},
-std::array<float,2>{0.76573813f, 0.786128521f},
-std::array<float,2>{0.118874714f, 0.48192957f},
-std::array<float,2>{0.602267861f, 0.145934939f},
-std::array<float,2>{0.360654354f, 0.683378696f},
-std::array<float,2>{0.662647247f, 0.507549465f},
-std::array<float,2>{0.472689122f, 0.0240521021f},
-std::array<float,2>{0.998477578f, 0.300703198f},
-std::array<float,2>{0.147677347f, 0.891407073f},
-std::array<float,2>{0.920780003f, 0.736632407f},
-std::array<float,2>{0.238287926f, 0.230980396f},
-std::array<float,2>{0.742175281f, 0.435540378f},
-std::array<float,2>{0.393322796f, 0.861253679f},
-std::array<float,2>{0.562437534f, 0.986790657f},
-std::array<float,2>{0.286065817f, 0.371676207f},
-std::array<float,2>{0.826654434f, 0.0791071877f},
-std::array<float,2>{0.0107562011f, 0.602496803f},
-std::array<float,2>{0.959894896f, 0.906415522f},
-std::array<float,2>{0.182734445f, 0.264850825f},
-std::array<float,2>{0.643113256f, 0.0578334406f},
-std::array<float,2>{0.444035202f, 0.545456886f},
-std::array<float,2>{0.582728922f, 0.635509849f},
-std::array<float,2>{0.316181123f, 0.168278575f},
-std::array<float,2>{0.796880066f, 0.440927655f},
-std::array<float,2>{0.0901834071f, 0.775721908f},
-std::array<float,2>{0.864906669f, 0.579720199f},
-std::array<float,2>{0.0455943868f, 0.0962075666f},
-std::array<float,2>{0.522173405f, 0.343635201f},
-std::array<float,2>{0.270601332f, 0.96465385f},
-std::array<float,2>{0.708631217f, 0.818062007f},
-std::array<float,2>{0.422754288f, 0.392425954f},
-std::array<float,2>{0.897401631f, 0.21516642f},
-std::array<float,2>{0.197160348f, 0.691931367f},
-std::array<float,2>{0.889111459f, 0.848420799f},
-std::array<float,2>{0.215534717f, 0.414073229f},
-std::array<float,2>{0.692404389f, 0.24088189f},
-std::array<float,2>{0.417350948f, 0.729159951f},
-std::array<float,2>{0.5133636f, 0.623584867f},
-std::array<float,2>{0.265381962f, 0.0745557249f},
-std::array<float,2>{0.857735038f, 0.348080307f},
-std::array<float,2>{0.0616902374f, 0.974278569f},
-std::array<float,2>{0.796409726f, 0.669356644f},
-std::array<float,2>{0.0723163337f, 0.138808638f},
-std::array<float,2>{0.578083277f, 0.485649258f},
-std::array<float,2>{0.339237571f, 0.799400449f},
-std::array<float,2>{0.628857434f, 0.877747953f},
-std::array<float,2>{0.46791175f, 0.295149416f},
-std::array<float,2>{0.941218495f, 0.00842986815f},
-std::array<float,2>{0.16116257f, 0.523568571f},
-std::array<float,2>{0.83341521f, 0.947345376f},
-std::array<float,2>{0.0210197214f, 0.31789884f},
-std::array<float,2>{0.537956119f, 0.116390005f},
-std::array<float,2>{0.297370046f, 0.56394124f},
-std::array<float,2>{0.72378242f, 0.717099607f},
-std::array<float,2>{0.380353183f, 0.187686369f},
-std::array<float,2>{0.925570548f, 0.386649042f},
-std::array<float,2>{0.227952331f, 0.828347683f},
-std::array<float,2>{0.979235828f, 0.557889402f},
-std::array<float,2>{0.129635274f, 0.0349752195f},
-std::array<float,2>{0.673908889f, 0.270395279f},
-std::array<float,2>{0.497280687f, 0.93027395f},
-std::array<float,2>{0.609512925f, 0.764376581f},
-std::array<float,2>{0.344923437f, 0.455070823f},
-std::array<float,2>{0.755937815f, 0.176864326f},
-std::array<float,2>{0.108740941f, 0.644432843f},
-std::array<float,2>{0.821288288f, 0.756289124f},
-std::array<float,2>{0.0131520787f, 0.467417955f},
-std::array<float,2>{0.558090031f, 0.186334342f},
-std::array<float,2>{0.282996505f, 0.654624164f},
-std::array<float,2>{0.735869646f, 0.547870636f},
-std::array<float,2>{0.395754248f, 0.0426310524f},
-std::array<float,2>{0.917929888f, 0.276279449f},
-std::array<float,2>{0.23684679f, 0.922021687f},
-std::array<float,2>{0.99470067f, 0.70976305f},
-std::array<float,2>{0.141347587f, 0.196458846f},
-std::array<float,2>{0.658028722f, 0.381798267f},
-std::array<float,2>{0.471252382f, 0.842739999f},
-std::array<float,2>{0.606487274f, 0.941864908f},
-std::array<float,2>{0.363624632f, 0.320774257f},
-std::array<float,2>{0.771531522f, 0.122478627f},
-std::array<float,2>{0.121847436f, 0.576414347f},
-std::array<float,2>{0.892569721f, 0.883806586f},
-std::array<float,2>{0.201908708f, 0.285809934f},
-std::array<float,2>{0.703508496f, 0.00315147778f},
-std::array<float,2>{0.429514229f, 0.520418465f},
-std::array<float,2>{0.517305195f, 0.657882869f},
-std::array<float,2>{0.265625596f, 0.126087889f},
-std::array<float,2>{0.86038661f, 0.493184417f},
-std::array<float,2>{0.0399440974f, 0.812457144f},
-std::array<float,2>{0.804338813f, 0.615897357f},
-std::array<float,2>{0.0861704573f, 0.0653565824f},
-std::array<float,2>{0.581446946f, 0.358486503f},
-std::array<float,2>{0.320226371f, 0.976623416f},
-std::array<float,2>{0.648327351f, 0.857055664f},
-std::array<float,2>{0.437663019f, 0.412586123f},
-std::array<float,2>{0.954790711f, 0.246698901f},
-std::array<float,2>{0.184641048f, 0.719636798f},
-std::array<float,2>{0.943588138f, 0.827831984f},
-std::array<float,2>{0.156859502f, 0.402621895f},
-std::array<float,2>{0.632020473f, 0.203792199f},
-std::array<float,2>{0.461889684f, 0.695691109f},
-std::array<float,2>{0.57305032f, 0.587546289f},
-std::array<float,2>{0.341027468f, 0.101639114f},
-std::array<float,2>{0.789729834f, 0.329838961f},
-std::array<float,2>{0.0763596967f, 0.959671736f},
-std::array<float,2>{0.852356553f, 0.62903136f},
-std::array<float,2>{0.0585277341f, 0.159112871f},
-std::array<float,2>{0.511417627f, 0.451869935f},
-std::array<float,2>{0.258008271f, 0.767110527f},
-std::array<float,2>{0.690992653f, 0.919141948f},
-std::array<float,2>{0.417999893f, 0.255682707f},
-std::array<float,2>{0.88373512f, 0.0528074168f},
-std::array<float,2>{0.211752132f, 0.533513904f},
-std::array<float,2>{0.750268757f, 0.998298168f},
-std::array<float,2>{0.10533493f, 0.367074341f},
-std::array<float,2>{0.61696583f, 0.0884810984f},
-std::array<float,2>{0.348772705f, 0.595766664f},
-std::array<float,2>{0.678747594f, 0.742352128f},
-std::array<float,2>{0.493044466f, 0.218833923f},
-std::array<float,2>{0.983659506f, 0.428010285f},
-std::array<float,2>{0.125214145f, 0.867618203f},
-std::array<float,2>{0.928783417f, 0.514420927f},
-std::array<float,2>{0.232051283f, 0.0160204098f},
-std::array<float,2>{0.722009897f, 0.30530414f},
-std::array<float,2>{0.376367122f, 0.903551936f},
-std::array<float,2>{0.532365501f, 0.791648567f},
-std::array<float,2>{0.304275364f, 0.471496165f},
-std::array<float,2>{0.831264794f, 0.153354168f},
-std::array<float,2>{0.0171760321f, 0.673194826f},
-std::array<float,2>{0.788328648f, 0.865999162f},
-std::array<float,2>{0.0646475032f, 0.430923402f},
-std::array<float,2>{0.563364267f, 0.229149207f},
-std::array<float,2>{0.328476071f, 0.74071604f},
-std::array<float,2>{0.636721313f, 0.607013345f},
-std::array<float,2>{0.455849946f, 0.0826684237f},
-std::array<float,2>{0.949316919f, 0.369046599f},
-std::array<float,2>{0.166861787f, 0.992112815f},
-std::array<float,2>{0.880876005f, 0.686405718f},
-std::array<float,2>{0.209278509f, 0.144377902f},
-std::array<float,2>{0.698133051f, 0.480197012f},
-std::array<float,2>{0.40734449f, 0.781725705f},
-std::array<float,2>{0.500920415f, 0.896137834f},
-std::array<float,2>{0.25747788f, 0.301065564f},
-std::array<float,2>{0.849144638f, 0.0288931765f},
-std::array<float,2>{0.0483565591f, 0.500580072f},
-std::array<float,2>{0.971644402f, 0.965577483f},
-std::array<float,2>{0.135842666f, 0.33700183f},
-std::array<float,2>{0.68662107f, 0.099194333f},
-std::array<float,2>{0.486673027f, 0.585538149f},
-std::array<float,2>{0.624127924f, 0.690501094f},
-std::array<float,2>{0.351825684f, 0.214751616f},
-std::array<float,2>{0.762238324f, 0.395020932f},
-std::array<float,2>{0.0993582308f, 0.814289927f},
-std::array<float,2>{0.841387272f, 0.540622354f},
-std::array<float,2>{0.0267620571f, 0.0608613938f},
-std::array<float,2>{0.543685913f, 0.258950531f},
-std::array<float,2>{0.309936166f, 0.91079247f},
-std::array<float,2>{0.730451167f, 0.780017972f},
-std::array<float,2>{0.390143484f, 0.444135636f},
-std::array<float,2>{0.930558324f, 0.16564177f},
-std::array<float,2>{0.221881986f, 0.638818681f},
-std::array<float,2>{0.907627881f, 0.802192092f},
-std::array<float,2>{0.248380393f, 0.491163313f},
-std::array<float,2>{0.743613183f, 0.134930924f},
-std::array<float,2>{0.40357694f, 0.664319217f},
-std::array<float,2>{0.551689267f, 0.529719889f},
-std::array<float,2>{0.292436808f, 0.0118036894f},
-std::array<float,2>{0.815578401f, 0.290240943f},
-std::array<float,2>{0.00317835296f, 0.879355788f},
-std::array<float,2>{0.780868053f, 0.732339323f},
-std::array<float,2>{0.116424665f, 0.234380662f},
-std::array<float,2>{0.599591315f, 0.418302327f},
-std::array<float,2>{0.36877197f, 0.846130669f},
-std::array<float,2>{0.666997552f, 0.970782876f},
-std::array<float,2>{0.480823487f, 0.346521884f},
-std::array<float,2>{0.984472156f, 0.073143661f},
-std::array<float,2>{0.155511707f, 0.620302141f},
-std::array<float,2>{0.873200655f, 0.936872125f},
-std::array<float,2>{0.0352225341f, 0.269333661f},
-std::array<float,2>{0.52447629f, 0.0358354375f},
-std::array<float,2>{0.275955796f, 0.560083449f},
-std::array<float,2>{0.715037107f, 0.647799611f},
-std::array<float,2>{0.430374771f, 0.173494786f},
-std::array<float,2>{0.905741632f, 0.459143221f},
-std::array<float,2>{0.189161256f, 0.759686649f},
-std::array<float,2>{0.965443313f, 0.567897677f},
-std::array<float,2>{0.173980251f, 0.113137871f},
-std::array<float,2>{0.649493039f, 0.313902229f},
-std::array<float,2>{0.446783066f, 0.952564359f},
-std::array<float,2>{0.588419616f, 0.834091902f},
-std::array<float,2>{0.324637383f, 0.386951387f},
-std::array<float,2>{0.808731794f, 0.193116575f},
-std::array<float,2>{0.0820645094f, 0.711278856f},
-std::array<float,2>{0.839083016f, 0.852069438f},
-std::array<float,2>{0.0280908346f, 0.408207774f},
-std::array<float,2>{0.539299905f, 0.244615957f},
-std::array<float,2>{0.304869592f, 0.723053932f},
-std::array<float,2>{0.730887949f, 0.610677004f},
-std::array<float,2>{0.384899288f, 0.0673148558f},
-std::array<float,2>{0.936019421f, 0.353395373f},
-std::array<float,2>{0.225987852f, 0.982422113f},
-std::array<float,2>{0.975218177f, 0.660438657f},
-std::array<float,2>{0.137541443f, 0.129544094f},
-std::array<float,2>{0.681400597f, 0.498488724f},
-std::array<float,2>{0.490631014f, 0.807525396f},
-std::array<float,2>{0.618740678f, 0.889805973f},
-std::array<float,2>{0.357306719f, 0.282380462f},
-std::array<float,2>{0.760974348f, 0.00652105594f},
-std::array<float,2>{0.0947820321f, 0.518023849f},
-std::array<float,2>{0.877973378f, 0.938628614f},
-std::array<float,2>{0.206566542f, 0.326650411f},
-std::array<float,2>{0.703049541f, 0.117438883f},
-std::array<float,2>{0.411978275f, 0.57267648f},
-std::array<float,2>{0.506141186f, 0.705442309f},
-std::array<float,2>{0.253614783f, 0.200419515f},
-std::array<float,2>{0.844854832f, 0.378096133f},
-std::array<float,2>{0.0512950569f, 0.838214874f},
-std::array<float,2>{0.782697558f, 0.552478731f},
-std::array<float,2>{0.067174986f, 0.0443964154f},
-std::array<float,2>{0.569661438f, 0.27831471f},
-std::array<float,2>{0.334694356f, 0.928498983f},
-std::array<float,2>{0.636529326f, 0.75335896f},
-std::array<float,2>{0.460624367f, 0.46247071f},
-std::array<float,2>{0.948383868f, 0.179736659f},
-std::array<float,2>{0.168433726f, 0.650070906f},
-std::array<float,2>{0.963305831f, 0.796651185f},
-std::array<float,2>{0.17823793f, 0.475618839f},
-std::array<float,2>{0.654923022f, 0.148803964f},
-std::array<float,2>{0.45260486f, 0.677958667f},
-std::array<float,2>{0.59195894f, 0.510515809f},
-std::array<float,2>{0.32133159f, 0.02190613f},
-std::array<float,2>{0.805194736f, 0.30938834f},
-std::array<float,2>{0.0816926137f, 0.901529133f},
-std::array<float,2>{0.868951619f, 0.749557436f},
-std::array<float,2>{0.0321282074f, 0.222754061f},
-std::array<float,2>{0.5303846f, 0.422685951f},
-std::array<float,2>{0.280457646f, 0.87379849f},
-std::array<float,2>{0.713344157f, 0.994265556f},
-std::array<float,2>{0.43696779f, 0.362032115f},
-std::array<float,2>{0.901793182f, 0.0927945375f},
-std::array<float,2>{0.19192858f, 0.600943267f},
-std::array<float,2>{0.773858249f, 0.917595446f},
-std::array<float,2>{0.110531777f, 0.251529515f},
-std::array<float,2>{0.595718741f, 0.0472779498f},
-std::array<float,2>{0.373501927f, 0.536391914f},
-std::array<float,2>{0.670015693f, 0.627153575f},
-std::array<float,2>{0.478511453f, 0.161297888f},
-std::array<float,2>{0.989561379f, 0.447749048f},
-std::array<float,2>{0.151339129f, 0.77171582f},
-std::array<float,2>{0.913135409f, 0.592544138f},
-std::array<float,2>{0.243197545f, 0.109293453f},
-std::array<float,2>{0.749203444f, 0.334562212f},
-std::array<float,2>{0.398866475f, 0.956998765f},
-std::array<float,2>{0.550200582f, 0.82185626f},
-std::array<float,2>{0.29317081f, 0.398703009f},
-std::array<float,2>{0.819065869f, 0.207992271f},
-std::array<float,2>{0.00587742263f, 0.700899482f},
-std::array<float,2>{0.800531805f, 0.773757339f},
-std::array<float,2>{0.0928823948f, 0.438590109f},
-std::array<float,2>{0.585480511f, 0.17014432f},
-std::array<float,2>{0.313087106f, 0.634326518f},
-std::array<float,2>{0.640836895f, 0.543532073f},
-std::array<float,2>{0.44237417f, 0.0551453047f},
-std::array<float,2>{0.957825184f, 0.262003392f},
-std::array<float,2>{0.180262059f, 0.909539998f},
-std::array<float,2>{0.895277023f, 0.694905698f},
-std::array<float,2>{0.197570831f, 0.218247592f},
-std::array<float,2>{0.709194362f, 0.393220454f},
-std::array<float,2>{0.423984289f, 0.820239604f},
-std::array<float,2>{0.519598007f, 0.962366581f},
-std::array<float,2>{0.272084802f, 0.341786474f},
-std::array<float,2>{0.865751028f, 0.0947426707f},
-std::array<float,2>{0.0447798967f, 0.580145299f},
-std::array<float,2>{0.99612993f, 0.894386888f},
-std::array<float,2>{0.145502269f, 0.297229379f},
-std::array<float,2>{0.661798716f, 0.0268213004f},
-std::array<float,2>{0.474781454f, 0.504675448f},
-std::array<float,2>{0.604460597f, 0.679982543f},
-std::array<float,2>{0.361557335f, 0.148137972f},
-std::array<float,2>{0.768657207f, 0.483245313f},
-std::array<float,2>{0.120018817f, 0.788546145f},
-std::array<float,2>{0.824219048f, 0.60521394f},
-std::array<float,2>{0.00815709401f, 0.0813874155f},
-std::array<float,2>{0.559651315f, 0.37430954f},
-std::array<float,2>{0.287171185f, 0.985612333f},
-std::array<float,2>{0.7391693f, 0.862562358f},
-std::array<float,2>{0.391220033f, 0.435547888f},
-std::array<float,2>{0.918790579f, 0.233959109f},
-std::array<float,2>{0.241497815f, 0.735329866f},
-std::array<float,2>{0.923246682f, 0.831218779f},
-std::array<float,2>{0.22909826f, 0.38408035f},
-std::array<float,2>{0.725130737f, 0.190247908f},
-std::array<float,2>{0.381436557f, 0.715712726f},
-std::array<float,2>{0.53531009f, 0.56586957f},
-std::array<float,2>{0.300759137f, 0.1140076f},
-std::array<float,2>{0.834042132f, 0.319993615f},
-std::array<float,2>{0.0225264486f, 0.945882499f},
-std::array<float,2>{0.755647421f, 0.641864598f},
-std::array<float,2>{0.10638769f, 0.179625466f},
-std::array<float,2>{0.612203479f, 0.455747187f},
-std::array<float,2>{0.345753849f, 0.762531042f},
-std::array<float,2>{0.672801793f, 0.933272541f},
-std::array<float,2>{0.499251723f, 0.271488428f},
-std::array<float,2>{0.977537453f, 0.0329761915f},
-std::array<float,2>{0.132329613f, 0.555994391f},
-std::array<float,2>{0.85646385f, 0.975340188f},
-std::array<float,2>{0.0597070418f, 0.350004315f},
-std::array<float,2>{0.515142143f, 0.0764045492f},
-std::array<float,2>{0.263253808f, 0.622111857f},
-std::array<float,2>{0.694377065f, 0.72753787f},
-std::array<float,2>{0.414560139f, 0.238664702f},
-std::array<float,2>{0.88749522f, 0.417799145f},
-std::array<float,2>{0.217386603f, 0.849813581f},
-std::array<float,2>{0.939252734f, 0.525797606f},
-std::array<float,2>{0.164025202f, 0.0106034102f},
-std::array<float,2>{0.625369191f, 0.293279648f},
-std::array<float,2>{0.46635288f, 0.876386523f},
-std::array<float,2>{0.575050771f, 0.798286736f},
-std::array<float,2>{0.337026536f, 0.486890346f},
-std::array<float,2>{0.794020772f, 0.138278961f},
-std::array<float,2>{0.0714119449f, 0.670702577f},
-std::array<float,2>{0.86165607f, 0.809615374f},
-std::array<float,2>{0.0426158831f, 0.496014178f},
-std::array<float,2>{0.518904686f, 0.128414437f},
-std::array<float,2>{0.269025773f, 0.658663452f},
-std::array<float,2>{0.706716001f, 0.522253752f},
-std::array<float,2>{0.426993102f, 0.000163549397f},
-std::array<float,2>{0.894386947f, 0.288645715f},
-std::array<float,2>{0.200145155f, 0.885867238f},
-std::array<float,2>{0.955350161f, 0.721006453f},
-std::array<float,2>{0.185708284f, 0.248901203f},
-std::array<float,2>{0.646127701f, 0.411913097f},
-std::array<float,2>{0.44121924f, 0.858364582f},
-std::array<float,2>{0.57926631f, 0.978893876f},
-std::array<float,2>{0.318228155f, 0.356445521f},
-std::array<float,2>{0.801237524f, 0.0630530193f},
-std::array<float,2>{0.0884806365f, 0.613896132f},
-std::array<float,2>{0.915839076f, 0.924116611f},
-std::array<float,2>{0.23614125f, 0.273786753f},
-std::array<float,2>{0.737847209f, 0.0394053981f},
-std::array<float,2>{0.39666754f, 0.549229681f},
-std::array<float,2>{0.555120707f, 0.653956175f},
-std::array<float,2>{0.284761846f, 0.184919551f},
-std::array<float,2>{0.823606551f, 0.466232985f},
-std::array<float,2>{0.0155275185f, 0.754751861f},
-std::array<float,2>{0.770755887f, 0.576007605f},
-std::array<float,2>{0.123305827f, 0.123134196f},
-std::array<float,2>{0.607640147f, 0.323935747f},
-std::array<float,2>{0.366669357f, 0.944602132f},
-std::array<float,2>{0.659596384f, 0.840253353f},
-std::array<float,2>{0.470565051f, 0.380308151f},
-std::array<float,2>{0.992218018f, 0.197400823f},
-std::array<float,2>{0.144349754f, 0.708715439f},
-std::array<float,2>{0.982256889f, 0.870672464f},
-std::array<float,2>{0.127628848f, 0.427700996f},
-std::array<float,2>{0.677601397f, 0.221759111f},
-std::array<float,2>{0.494710505f, 0.745379627f},
-std::array<float,2>{0.614525437f, 0.5943349f},
-std::array<float,2>{0.349702448f, 0.0869449154f},
-std::array<float,2>{0.75372541f, 0.363562852f},
-std::array<float,2>{0.103150032f, 0.99732542f},
-std::array<float,2>{0.829105079f, 0.675134003f},
-std::array<float,2>{0.019271424f, 0.154794142f},
-std::array<float,2>{0.534474552f, 0.468964428f},
-std::array<float,2>{0.301040202f, 0.790228188f},
-std::array<float,2>{0.720276952f, 0.904500365f},
-std::array<float,2>{0.376980811f, 0.306651086f},
-std::array<float,2>{0.927433908f, 0.0188588407f},
-std::array<float,2>{0.233047038f, 0.512084305f},
-std::array<float,2>{0.791795909f, 0.958385408f},
-std::array<float,2>{0.0761231482f, 0.331574351f},
-std::array<float,2>{0.570861936f, 0.10474097f},
-std::array<float,2>{0.34335649f, 0.589426577f},
-std::array<float,2>{0.630660236f, 0.697929084f},
-std::array<float,2>{0.464195788f, 0.206042171f},
-std::array<float,2>{0.942849994f, 0.406052917f},
-std::array<float,2>{0.159031123f, 0.824251831f},
-std::array<float,2>{0.88477844f, 0.532824755f},
-std::array<float,2>{0.213110954f, 0.0508711375f},
-std::array<float,2>{0.688995838f, 0.256786406f},
-std::array<float,2>{0.421343058f, 0.921855628f},
-std::array<float,2>{0.508332789f, 0.769089878f},
-std::array<float,2>{0.261657327f, 0.450808972f},
-std::array<float,2>{0.855234444f, 0.156595737f},
-std::array<float,2>{0.0554839596f, 0.631971657f},
-std::array<float,2>{0.764798105f, 0.816178024f},
-std::array<float,2>{0.100218832f, 0.397799253f},
-std::array<float,2>{0.622134984f, 0.211286724f},
-std::array<float,2>{0.354332894f, 0.687637329f},
-std::array<float,2>{0.684693515f, 0.582208216f},
-std::array<float,2>{0.484957546f, 0.0996599123f},
-std::array<float,2>{0.969521999f, 0.338555127f},
-std::array<float,2>{0.134759322f, 0.968402982f},
-std::array<float,2>{0.933326423f, 0.636830747f},
-std::array<float,2>{0.219564348f, 0.167841077f},
-std::array<float,2>{0.727182984f, 0.442017198f},
-std::array<float,2>{0.386780024f, 0.778605223f},
-std::array<float,2>{0.546286523f, 0.91285193f},
-std::array<float,2>{0.312002063f, 0.259815127f},
-std::array<float,2>{0.843657494f, 0.0590430722f},
-std::array<float,2>{0.025211988f, 0.541122139f},
-std::array<float,2>{0.953020334f, 0.988534927f},
-std::array<float,2>{0.164409533f, 0.369540185f},
-std::array<float,2>{0.639207363f, 0.08428552f},
-std::array<float,2>{0.453230977f, 0.608315647f},
-std::array<float,2>{0.565412164f, 0.740127802f},
-std::array<float,2>{0.330367506f, 0.227372676f},
-std::array<float,2>{0.785723209f, 0.432405293f},
-std::array<float,2>{0.0637967736f, 0.865102589f},
-std::array<float,2>{0.850258052f, 0.503847897f},
-std::array<float,2>{0.0501093753f, 0.0308276992f},
-std::array<float,2>{0.503678501f, 0.303149074f},
-std::array<float,2>{0.254858911f, 0.897546709f},
-std::array<float,2>{0.695778012f, 0.784295559f},
-std::array<float,2>{0.409452468f, 0.477766961f},
-std::array<float,2>{0.880365431f, 0.141320288f},
-std::array<float,2>{0.20891045f, 0.684020996f},
-std::array<float,2>{0.902800143f, 0.760177076f},
-std::array<float,2>{0.189914614f, 0.458058506f},
-std::array<float,2>{0.718673289f, 0.175361946f},
-std::array<float,2>{0.432460129f, 0.644802034f},
-std::array<float,2>{0.527014315f, 0.560756087f},
-std::array<float,2>{0.27530098f, 0.0388165936f},
-std::array<float,2>{0.871595383f, 0.26699084f},
-std::array<float,2>{0.0378609039f, 0.935190439f},
-std::array<float,2>{0.81064862f, 0.714042664f},
-std::array<float,2>{0.0840240866f, 0.19461289f},
-std::array<float,2>{0.58704257f, 0.389295429f},
-std::array<float,2>{0.327818751f, 0.83393693f},
-std::array<float,2>{0.650621653f, 0.950407207f},
-std::array<float,2>{0.448350877f, 0.315931499f},
-std::array<float,2>{0.968707919f, 0.1112177f},
-std::array<float,2>{0.173393428f, 0.568827629f},
-std::array<float,2>{0.813796639f, 0.882534683f},
-std::array<float,2>{0.00122627057f, 0.29256627f},
-std::array<float,2>{0.553736091f, 0.0153386639f},
-std::array<float,2>{0.289843708f, 0.528436363f},
-std::array<float,2>{0.744988084f, 0.667416811f},
-std::array<float,2>{0.404331148f, 0.13372612f},
-std::array<float,2>{0.909155726f, 0.489028841f},
-std::array<float,2>{0.246558294f, 0.804154754f},
-std::array<float,2>{0.986617565f, 0.617791951f},
-std::array<float,2>{0.153793886f, 0.0710490197f},
-std::array<float,2>{0.66492188f, 0.344293088f},
-std::array<float,2>{0.484153926f, 0.969409823f},
-std::array<float,2>{0.600515246f, 0.844524443f},
-std::array<float,2>{0.370016277f, 0.420631796f},
-std::array<float,2>{0.778233588f, 0.238139167f},
-std::array<float,2>{0.114639677f, 0.732879341f},
-std::array<float,2>{0.834878385f, 0.828689098f},
-std::array<float,2>{0.0232026298f, 0.386000216f},
-std::array<float,2>{0.535661757f, 0.188242882f},
-std::array<float,2>{0.300237387f, 0.71751678f},
-std::array<float,2>{0.724655569f, 0.564408183f},
-std::array<float,2>{0.381029695f, 0.116909273f},
-std::array<float,2>{0.923643947f, 0.317733258f},
-std::array<float,2>{0.228839636f, 0.948125958f},
-std::array<float,2>{0.976614237f, 0.64399153f},
-std::array<float,2>{0.13196744f, 0.177430168f},
-std::array<float,2>{0.671951234f, 0.4541049f},
-std::array<float,2>{0.499868572f, 0.763970852f},
-std::array<float,2>{0.611375213f, 0.930009246f},
-std::array<float,2>{0.346658319f, 0.27001214f},
-std::array<float,2>{0.755120993f, 0.034509223f},
-std::array<float,2>{0.105645634f, 0.558229208f},
-std::array<float,2>{0.886982262f, 0.973748744f},
-std::array<float,2>{0.217244789f, 0.348376304f},
-std::array<float,2>{0.695203722f, 0.0749090314f},
-std::array<float,2>{0.414286852f, 0.623081326f},
-std::array<float,2>{0.514816523f, 0.728787363f},
-std::array<float,2>{0.262810916f, 0.240699768f},
-std::array<float,2>{0.857318223f, 0.414931834f},
-std::array<float,2>{0.0600941442f, 0.847705722f},
-std::array<float,2>{0.7945804f, 0.524095058f},
-std::array<float,2>{0.0721117035f, 0.00826623384f},
-std::array<float,2>{0.574236274f, 0.295499772f},
-std::array<float,2>{0.337866485f, 0.87743032f},
-std::array<float,2>{0.625641882f, 0.79904902f},
-std::array<float,2>{0.465823501f, 0.486030221f},
-std::array<float,2>{0.938820481f, 0.139348611f},
-std::array<float,2>{0.163148642f, 0.669799566f},
-std::array<float,2>{0.957367718f, 0.775952935f},
-std::array<float,2>{0.179913715f, 0.440812796f},
-std::array<float,2>{0.641590893f, 0.168613985f},
-std::array<float,2>{0.441447437f, 0.635095716f},
-std::array<float,2>{0.585021913f, 0.544922471f},
-std::array<float,2>{0.312657028f, 0.0584993996f},
-std::array<float,2>{0.800083756f, 0.265189767f},
-std::array<float,2>{0.0933655798f, 0.906902969f},
-std::array<float,2>{0.865286291f, 0.691494048f},
-std::array<float,2>{0.0441053621f, 0.215569913f},
-std::array<float,2>{0.520039678f, 0.392055333f},
-std::array<float,2>{0.271849483f, 0.817633212f},
-std::array<float,2>{0.709721446f, 0.96433574f},
-std::array<float,2>{0.424770266f, 0.343181491f},
-std::array<float,2>{0.894648671f, 0.0960011035f},
-std::array<float,2>{0.197763145f, 0.579263151f},
-std::array<float,2>{0.769367516f, 0.890660465f},
-std::array<float,2>{0.119458772f, 0.300209701f},
-std::array<float,2>{0.603841841f, 0.0236992892f},
-std::array<float,2>{0.362251431f, 0.507152915f},
-std::array<float,2>{0.661306798f, 0.682647347f},
-std::array<float,2>{0.475170046f, 0.146314561f},
-std::array<float,2>{0.996954381f, 0.482334852f},
-std::array<float,2>{0.144756436f, 0.785430372f},
-std::array<float,2>{0.918061376f, 0.602022409f},
-std::array<float,2>{0.241863579f, 0.0800079629f},
-std::array<float,2>{0.738537371f, 0.371528566f},
-std::array<float,2>{0.390828848f, 0.986859918f},
-std::array<float,2>{0.560399294f, 0.860405326f},
-std::array<float,2>{0.287941933f, 0.434728026f},
-std::array<float,2>{0.824916005f, 0.230691075f},
-std::array<float,2>{0.00842014235f, 0.737219989f},
-std::array<float,2>{0.804773748f, 0.793953001f},
-std::array<float,2>{0.0810794905f, 0.47350207f},
-std::array<float,2>{0.592552722f, 0.151627362f},
-std::array<float,2>{0.321944028f, 0.676837206f},
-std::array<float,2>{0.654772699f, 0.509397089f},
-std::array<float,2>{0.452650905f, 0.0205447376f},
-std::array<float,2>{0.963786006f, 0.311467677f},
-std::array<float,2>{0.177994445f, 0.898943484f},
-std::array<float,2>{0.902129054f, 0.747535169f},
-std::array<float,2>{0.191690862f, 0.224642858f},
-std::array<float,2>{0.713550627f, 0.425242066f},
-std::array<float,2>{0.437437057f, 0.871357441f},
-std::array<float,2>{0.531000733f, 0.992801368f},
-std::array<float,2>{0.281117141f, 0.361042649f},
-std::array<float,2>{0.868587375f, 0.0916253552f},
-std::array<float,2>{0.031638816f, 0.598762333f},
-std::array<float,2>{0.989905596f, 0.914103746f},
-std::array<float,2>{0.150698885f, 0.252414107f},
-std::array<float,2>{0.670503855f, 0.0488900878f},
-std::array<float,2>{0.477984667f, 0.537811577f},
-std::array<float,2>{0.596537352f, 0.626188874f},
-std::array<float,2>{0.373923272f, 0.163240686f},
-std::array<float,2>{0.7740224f, 0.446469694f},
-std::array<float,2>{0.111098997f, 0.770151436f},
-std::array<float,2>{0.818804145f, 0.59118253f},
-std::array<float,2>{0.00663586473f, 0.106193297f},
-std::array<float,2>{0.550407708f, 0.332846075f},
-std::array<float,2>{0.293633312f, 0.954411566f},
-std::array<float,2>{0.749995232f, 0.822878778f},
-std::array<float,2>{0.398953497f, 0.401447147f},
-std::array<float,2>{0.913752437f, 0.209638149f},
-std::array<float,2>{0.244033337f, 0.701413274f},
-std::array<float,2>{0.936306775f, 0.854664326f},
-std::array<float,2>{0.226461887f, 0.407414079f},
-std::array<float,2>{0.731001079f, 0.243069515f},
-std::array<float,2>{0.385286272f, 0.726278365f},
-std::array<float,2>{0.539959371f, 0.612743258f},
-std::array<float,2>{0.30519858f, 0.0692897215f},
-std::array<float,2>{0.839428067f, 0.354920208f},
-std::array<float,2>{0.0277101491f, 0.980532527f},
-std::array<float,2>{0.761469245f, 0.662509024f},
-std::array<float,2>{0.0952613279f, 0.131676465f},
-std::array<float,2>{0.618245363f, 0.49726826f},
-std::array<float,2>{0.356536329f, 0.806530356f},
-std::array<float,2>{0.681014538f, 0.888161957f},
-std::array<float,2>{0.491069943f, 0.284608901f},
-std::array<float,2>{0.974966943f, 0.00553659117f},
-std::array<float,2>{0.137031868f, 0.517421961f},
-std::array<float,2>{0.845405042f, 0.940346599f},
-std::array<float,2>{0.0510489829f, 0.324301153f},
-std::array<float,2>{0.506445706f, 0.119845681f},
-std::array<float,2>{0.253287405f, 0.571073592f},
-std::array<float,2>{0.70243448f, 0.703986526f},
-std::array<float,2>{0.41136995f, 0.201230898f},
-std::array<float,2>{0.878580689f, 0.375599474f},
-std::array<float,2>{0.206367716f, 0.836966336f},
-std::array<float,2>{0.948998868f, 0.552760541f},
-std::array<float,2>{0.168677077f, 0.0449904539f},
-std::array<float,2>{0.636176467f, 0.281051606f},
-std::array<float,2>{0.460154295f, 0.927448511f},
-std::array<float,2>{0.569898307f, 0.751420438f},
-std::array<float,2>{0.334226042f, 0.46426326f},
-std::array<float,2>{0.783090353f, 0.182128653f},
-std::array<float,2>{0.0665966719f, 0.651284039f},
-std::array<float,2>{0.871540427f, 0.759098053f},
-std::array<float,2>{0.037189234f, 0.459783137f},
-std::array<float,2>{0.526454806f, 0.173131183f},
-std::array<float,2>{0.274654806f, 0.648174405f},
-std::array<float,2>{0.71793437f, 0.559810758f},
-std::array<float,2>{0.432094991f, 0.0356335863f},
-std::array<float,2>{0.903061271f, 0.26873979f},
-std::array<float,2>{0.19018127f, 0.937089384f},
-std::array<float,2>{0.96791321f, 0.711437881f},
-std::array<float,2>{0.172895759f, 0.192724958f},
-std::array<float,2>{0.651037574f, 0.387425661f},
-std::array<float,2>{0.449144155f, 0.834581077f},
-std::array<float,2>{0.587644756f, 0.952806532f},
-std::array<float,2>{0.32750544f, 0.314079762f},
-std::array<float,2>{0.811469316f, 0.112664603f},
-std::array<float,2>{0.0847876072f, 0.56773299f},
-std::array<float,2>{0.908221543f, 0.879417837f},
-std::array<float,2>{0.247017369f, 0.290661037f},
-std::array<float,2>{0.744186461f, 0.0122767128f},
-std::array<float,2>{0.405102432f, 0.530096531f},
-std::array<float,2>{0.554412246f, 0.664989114f},
-std::array<float,2>{0.289512128f, 0.135500103f},
-std::array<float,2>{0.814171791f, 0.49060455f},
-std::array<float,2>{0.00161801989f, 0.802540123f},
-std::array<float,2>{0.777786195f, 0.620796323f},
-std::array<float,2>{0.114895649f, 0.0725430548f},
-std::array<float,2>{0.599745035f, 0.345888376f},
-std::array<float,2>{0.369240552f, 0.971491456f},
-std::array<float,2>{0.66423142f, 0.846666515f},
-std::array<float,2>{0.483493894f, 0.418792784f},
-std::array<float,2>{0.98726511f, 0.234885573f},
-std::array<float,2>{0.154183999f, 0.73169291f},
-std::array<float,2>{0.968877196f, 0.813851655f},
-std::array<float,2>{0.134243384f, 0.394552052f},
-std::array<float,2>{0.685072064f, 0.214216068f},
-std::array<float,2>{0.484376907f, 0.691123486f},
-std::array<float,2>{0.622656584f, 0.585240364f},
-std::array<float,2>{0.353813291f, 0.0988731533f},
-std::array<float,2>{0.765289962f, 0.337622881f},
-std::array<float,2>{0.100009359f, 0.965070367f},
-std::array<float,2>{0.842957139f, 0.639518797f},
-std::array<float,2>{0.0247420222f, 0.165467381f},
-std::array<float,2>{0.546835124f, 0.44377479f},
-std::array<float,2>{0.312429041f, 0.779683948f},
-std::array<float,2>{0.726732135f, 0.91047442f},
-std::array<float,2>{0.387332141f, 0.259748459f},
-std::array<float,2>{0.932648063f, 0.0612055808f},
-std::array<float,2>{0.218861639f, 0.540106416f},
-std::array<float,2>{0.785179734f, 0.991300881f},
-std::array<float,2>{0.0640455112f, 0.368466169f},
-std::array<float,2>{0.564684987f, 0.0823464096f},
-std::array<float,2>{0.33060804f, 0.60662967f},
-std::array<float,2>{0.638823748f, 0.74089551f},
-std::array<float,2>{0.454020441f, 0.228572324f},
-std::array<float,2>{0.952161252f, 0.431639612f},
-std::array<float,2>{0.164729044f, 0.865553379f},
-std::array<float,2>{0.880818605f, 0.500453353f},
-std::array<float,2>{0.208011791f, 0.0284470022f},
-std::array<float,2>{0.696179867f, 0.301554382f},
-std::array<float,2>{0.409691215f, 0.895944953f},
-std::array<float,2>{0.502943814f, 0.782194257f},
-std::array<float,2>{0.254262924f, 0.479604155f},
-std::array<float,2>{0.849971831f, 0.143912584f},
-std::array<float,2>{0.0506994799f, 0.685602009f},
-std::array<float,2>{0.753032327f, 0.86772877f},
-std::array<float,2>{0.102562763f, 0.428584665f},
-std::array<float,2>{0.614829302f, 0.219516248f},
-std::array<float,2>{0.350150287f, 0.742806196f},
-std::array<float,2>{0.676905394f, 0.596666873f},
-std::array<float,2>{0.494165927f, 0.0882545412f},
-std::array<float,2>{0.981890798f, 0.366482675f},
-std::array<float,2>{0.127168745f, 0.998942852f},
-std::array<float,2>{0.926984906f, 0.673725247f},
-std::array<float,2>{0.232647195f, 0.153932631f},
-std::array<float,2>{0.720101893f, 0.470810473f},
-std::array<float,2>{0.377490133f, 0.791290998f},
-std::array<float,2>{0.535012722f, 0.903881729f},
-std::array<float,2>{0.301669776f, 0.304769665f},
-std::array<float,2>{0.82976377f, 0.016462557f},
-std::array<float,2>{0.0189988017f, 0.514056802f},
-std::array<float,2>{0.94332701f, 0.959380925f},
-std::array<float,2>{0.158211812f, 0.329170346f},
-std::array<float,2>{0.62997508f, 0.10251639f},
-std::array<float,2>{0.464406997f, 0.587114215f},
-std::array<float,2>{0.570699573f, 0.695933402f},
-std::array<float,2>{0.342834145f, 0.203558028f},
-std::array<float,2>{0.791251898f, 0.403020203f},
-std::array<float,2>{0.0752154589f, 0.827421188f},
-std::array<float,2>{0.854930103f, 0.533962309f},
-std::array<float,2>{0.0548972376f, 0.0532970205f},
-std::array<float,2>{0.508232772f, 0.255042553f},
-std::array<float,2>{0.261179537f, 0.919822514f},
-std::array<float,2>{0.688929975f, 0.766743064f},
-std::array<float,2>{0.42175898f, 0.451285511f},
-std::array<float,2>{0.885622561f, 0.158549771f},
-std::array<float,2>{0.213639393f, 0.629448175f},
-std::array<float,2>{0.89374572f, 0.811553657f},
-std::array<float,2>{0.199282467f, 0.493983299f},
-std::array<float,2>{0.7063573f, 0.126501784f},
-std::array<float,2>{0.427418232f, 0.65758121f},
-std::array<float,2>{0.519140363f, 0.519822955f},
-std::array<float,2>{0.269442767f, 0.0035857521f},
-std::array<float,2>{0.861918151f, 0.285259902f},
-std::array<float,2>{0.0422226973f, 0.8843894f},
-std::array<float,2>{0.801383972f, 0.71877563f},
-std::array<float,2>{0.0881313831f, 0.246219024f},
-std::array<float,2>{0.579783618f, 0.412827849f},
-std::array<float,2>{0.317845821f, 0.856497824f},
-std::array<float,2>{0.645681262f, 0.977201104f},
-std::array<float,2>{0.440433294f, 0.359275639f},
-std::array<float,2>{0.955735147f, 0.0646172166f},
-std::array<float,2>{0.186074033f, 0.615712762f},
-std::array<float,2>{0.824057162f, 0.922555387f},
-std::array<float,2>{0.0147715416f, 0.275484145f},
-std::array<float,2>{0.55534035f, 0.0421561338f},
-std::array<float,2>{0.284382731f, 0.548792183f},
-std::array<float,2>{0.737635136f, 0.655075848f},
-std::array<float,2>{0.397217304f, 0.185667992f},
-std::array<float,2>{0.915183127f, 0.467069715f},
-std::array<float,2>{0.235750377f, 0.756827474f},
-std::array<float,2>{0.992926717f, 0.577004492f},
-std::array<float,2>{0.143826529f, 0.123029187f},
-std::array<float,2>{0.659703076f, 0.32083866f},
-std::array<float,2>{0.470100552f, 0.941928446f},
-std::array<float,2>{0.608268082f, 0.841842175f},
-std::array<float,2>{0.367149472f, 0.380912513f},
-std::array<float,2>{0.77117604f, 0.196982995f},
-std::array<float,2>{0.123884909f, 0.709242165f},
-std::array<float,2>{0.858263016f, 0.850282311f},
-std::array<float,2>{0.0622393712f, 0.417263597f},
-std::array<float,2>{0.5127424f, 0.239183232f},
-std::array<float,2>{0.265106916f, 0.727029026f},
-std::array<float,2>{0.693209887f, 0.62286061f},
-std::array<float,2>{0.417615563f, 0.0768968537f},
-std::array<float,2>{0.889463961f, 0.350537837f},
-std::array<float,2>{0.21520637f, 0.974704683f},
-std::array<float,2>{0.940551162f, 0.670368314f},
-std::array<float,2>{0.161907002f, 0.137727469f},
-std::array<float,2>{0.627963722f, 0.486728191f},
-std::array<float,2>{0.468595147f, 0.798369765f},
-std::array<float,2>{0.577438653f, 0.87665683f},
-std::array<float,2>{0.339733154f, 0.293472648f},
-std::array<float,2>{0.795965791f, 0.0100566903f},
-std::array<float,2>{0.0731157735f, 0.526036024f},
-std::array<float,2>{0.92508328f, 0.945786953f},
-std::array<float,2>{0.22811158f, 0.319633782f},
-std::array<float,2>{0.724556327f, 0.113302745f},
-std::array<float,2>{0.380702883f, 0.566182196f},
-std::array<float,2>{0.537557364f, 0.714917779f},
-std::array<float,2>{0.297202349f, 0.189766064f},
-std::array<float,2>{0.833568752f, 0.384675115f},
-std::array<float,2>{0.0207470879f, 0.831662834f},
-std::array<float,2>{0.756389797f, 0.556342304f},
-std::array<float,2>{0.109166473f, 0.032351274f},
-std::array<float,2>{0.60992837f, 0.272139162f},
-std::array<float,2>{0.345508724f, 0.932723403f},
-std::array<float,2>{0.674651325f, 0.761835515f},
-std::array<float,2>{0.497951984f, 0.455431283f},
-std::array<float,2>{0.978541017f, 0.178866655f},
-std::array<float,2>{0.129321098f, 0.642150939f},
-std::array<float,2>{0.998892248f, 0.788686931f},
-std::array<float,2>{0.148248553f, 0.482780248f},
-std::array<float,2>{0.662423372f, 0.147806719f},
-std::array<float,2>{0.47342211f, 0.680233002f},
-std::array<float,2>{0.601678669f, 0.50413096f},
-std::array<float,2>{0.360979944f, 0.0268812943f},
-std::array<float,2>{0.766600549f, 0.297378063f},
-std::array<float,2>{0.118430473f, 0.893559933f},
-std::array<float,2>{0.826886117f, 0.734719515f},
-std::array<float,2>{0.0116665177f, 0.233648822f},
-std::array<float,2>{0.561950445f, 0.436263412f},
-std::array<float,2>{0.285571456f, 0.862821519f},
-std::array<float,2>{0.74166131f, 0.986271381f},
-std::array<float,2>{0.392872065f, 0.37482667f},
-std::array<float,2>{0.919931114f, 0.0819335729f},
-std::array<float,2>{0.239099279f, 0.604968011f},
-std::array<float,2>{0.79755795f, 0.910081685f},
-std::array<float,2>{0.0904401541f, 0.262646228f},
-std::array<float,2>{0.582488656f, 0.0555201173f},
-std::array<float,2>{0.315707237f, 0.542991221f},
-std::array<float,2>{0.642664731f, 0.63399899f},
-std::array<float,2>{0.443390012f, 0.17044127f},
-std::array<float,2>{0.959405065f, 0.439308822f},
-std::array<float,2>{0.1832605f, 0.774075568f},
-std::array<float,2>{0.896961927f, 0.580652297f},
-std::array<float,2>{0.196745321f, 0.09560965f},
-std::array<float,2>{0.708435416f, 0.34108296f},
-std::array<float,2>{0.422140241f, 0.962532401f},
-std::array<float,2>{0.521882117f, 0.819420218f},
-std::array<float,2>{0.271283865f, 0.392848641f},
-std::array<float,2>{0.864306092f, 0.218596458f},
-std::array<float,2>{0.0452806354f, 0.694615006f},
-std::array<float,2>{0.776432276f, 0.772048533f},
-std::array<float,2>{0.113130756f, 0.447993994f},
-std::array<float,2>{0.595083117f, 0.161967322f},
-std::array<float,2>{0.371649861f, 0.627444327f},
-std::array<float,2>{0.669808745f, 0.536773682f},
-std::array<float,2>{0.479001313f, 0.0473945811f},
-std::array<float,2>{0.990775764f, 0.251059324f},
-std::array<float,2>{0.149399057f, 0.917365253f},
-std::array<float,2>{0.911120713f, 0.700240314f},
-std::array<float,2>{0.244251966f, 0.20741947f},
-std::array<float,2>{0.746291697f, 0.399026513f},
-std::array<float,2>{0.402305335f, 0.821480036f},
-std::array<float,2>{0.547756493f, 0.956235051f},
-std::array<float,2>{0.296600163f, 0.33431983f},
-std::array<float,2>{0.816956341f, 0.108466625f},
-std::array<float,2>{0.00525660766f, 0.591953397f},
-std::array<float,2>{0.96160984f, 0.902130544f},
-std::array<float,2>{0.176625863f, 0.309000731f},
-std::array<float,2>{0.653588772f, 0.0223473217f},
-std::array<float,2>{0.450470924f, 0.510153949f},
-std::array<float,2>{0.591443479f, 0.678316295f},
-std::array<float,2>{0.322957456f, 0.149407476f},
-std::array<float,2>{0.807000101f, 0.47609207f},
-std::array<float,2>{0.078277342f, 0.796124578f},
-std::array<float,2>{0.869716763f, 0.601291478f},
-std::array<float,2>{0.0349994637f, 0.09374924f},
-std::array<float,2>{0.528480291f, 0.361387819f},
-std::array<float,2>{0.278785169f, 0.994792879f},
-std::array<float,2>{0.711168408f, 0.873201013f},
-std::array<float,2>{0.434447497f, 0.422006309f},
-std::array<float,2>{0.899841666f, 0.223489806f},
-std::array<float,2>{0.193949252f, 0.749236166f},
-std::array<float,2>{0.875548184f, 0.838411212f},
-std::array<float,2>{0.204178035f, 0.378460944f},
-std::array<float,2>{0.69939208f, 0.2007505f},
-std::array<float,2>{0.41399008f, 0.706009507f},
-std::array<float,2>{0.504474521f, 0.572892666f},
-std::array<float,2>{0.251890391f, 0.117993027f},
-std::array<float,2>{0.847476542f, 0.326953083f},
-std::array<float,2>{0.0544317961f, 0.939441144f},
-std::array<float,2>{0.784656346f, 0.64972353f},
-std::array<float,2>{0.0699460357f, 0.180232704f},
-std::array<float,2>{0.568223238f, 0.46215865f},
-std::array<float,2>{0.333623499f, 0.753599048f},
-std::array<float,2>{0.633803844f, 0.928081155f},
-std::array<float,2>{0.457983315f, 0.277744859f},
-std::array<float,2>{0.946745753f, 0.0446941182f},
-std::array<float,2>{0.171732783f, 0.551921368f},
-std::array<float,2>{0.836051762f, 0.983350098f},
-std::array<float,2>{0.0293457434f, 0.352647185f},
-std::array<float,2>{0.541387498f, 0.0667723641f},
-std::array<float,2>{0.307409108f, 0.611229002f},
-std::array<float,2>{0.734069765f, 0.723337591f},
-std::array<float,2>{0.383984417f, 0.244842365f},
-std::array<float,2>{0.934390426f, 0.408971161f},
-std::array<float,2>{0.223805979f, 0.851569533f},
-std::array<float,2>{0.973763883f, 0.518238664f},
-std::array<float,2>{0.14044641f, 0.00625183666f},
-std::array<float,2>{0.682533324f, 0.282895952f},
-std::array<float,2>{0.488500535f, 0.890218198f},
-std::array<float,2>{0.620210528f, 0.806930661f},
-std::array<float,2>{0.35833776f, 0.498612404f},
-std::array<float,2>{0.758261204f, 0.129295692f},
-std::array<float,2>{0.0975887328f, 0.660788715f},
-std::array<float,2>{0.816136599f, 0.804460585f},
-std::array<float,2>{0.00369213428f, 0.488570273f},
-std::array<float,2>{0.551255643f, 0.132822797f},
-std::array<float,2>{0.292592436f, 0.667582095f},
-std::array<float,2>{0.743925214f, 0.529211283f},
-std::array<float,2>{0.404199034f, 0.0150455199f},
-std::array<float,2>{0.908109307f, 0.292280644f},
-std::array<float,2>{0.248797819f, 0.882047296f},
-std::array<float,2>{0.984946132f, 0.732940733f},
-std::array<float,2>{0.156208009f, 0.237480402f},
-std::array<float,2>{0.66755718f, 0.420059979f},
-std::array<float,2>{0.481333464f, 0.843883455f},
-std::array<float,2>{0.598703206f, 0.968952239f},
-std::array<float,2>{0.368199766f, 0.344170243f},
-std::array<float,2>{0.780412614f, 0.0703817904f},
-std::array<float,2>{0.116757713f, 0.617337584f},
-std::array<float,2>{0.906101048f, 0.935019612f},
-std::array<float,2>{0.188515723f, 0.267222941f},
-std::array<float,2>{0.715599895f, 0.0382442623f},
-std::array<float,2>{0.430019587f, 0.561215818f},
-std::array<float,2>{0.525079489f, 0.645043015f},
-std::array<float,2>{0.27553454f, 0.174842671f},
-std::array<float,2>{0.87392211f, 0.458665252f},
-std::array<float,2>{0.0360090323f, 0.760488927f},
-std::array<float,2>{0.809485912f, 0.568899512f},
-std::array<float,2>{0.0827489719f, 0.110662118f},
-std::array<float,2>{0.588222086f, 0.315766662f},
-std::array<float,2>{0.325138241f, 0.951050878f},
-std::array<float,2>{0.650045693f, 0.833372951f},
-std::array<float,2>{0.446310163f, 0.388772547f},
-std::array<float,2>{0.964913607f, 0.194862485f},
-std::array<float,2>{0.174698427f, 0.714398742f},
-std::array<float,2>{0.949882269f, 0.864284098f},
-std::array<float,2>{0.166197926f, 0.43204397f},
-std::array<float,2>{0.637508273f, 0.226856977f},
-std::array<float,2>{0.455283523f, 0.739473403f},
-std::array<float,2>{0.562623143f, 0.607853889f},
-std::array<float,2>{0.328892767f, 0.0844992772f},
-std::array<float,2>{0.78892231f, 0.369671911f},
-std::array<float,2>{0.065048106f, 0.98905921f},
-std::array<float,2>{0.848788857f, 0.684270203f},
-std::array<float,2>{0.0479658432f, 0.140718713f},
-std::array<float,2>{0.500173688f, 0.478350163f},
-std::array<float,2>{0.257118285f, 0.784746826f},
-std::array<float,2>{0.697679996f, 0.8980878f},
-std::array<float,2>{0.407952756f, 0.30369854f},
-std::array<float,2>{0.881533444f, 0.0304974895f},
-std::array<float,2>{0.20977883f, 0.502991974f},
-std::array<float,2>{0.762175918f, 0.968249738f},
-std::array<float,2>{0.0990810171f, 0.337960869f},
-std::array<float,2>{0.624789596f, 0.100482687f},
-std::array<float,2>{0.352436036f, 0.582658172f},
-std::array<float,2>{0.687326372f, 0.688101232f},
-std::array<float,2>{0.487225205f, 0.21162872f},
-std::array<float,2>{0.970925093f, 0.398181349f},
-std::array<float,2>{0.136295632f, 0.815519035f},
-std::array<float,2>{0.930015862f, 0.541542947f},
-std::array<float,2>{0.222181648f, 0.0592188984f},
-std::array<float,2>{0.72984165f, 0.260531127f},
-std::array<float,2>{0.38975668f, 0.912190676f},
-std::array<float,2>{0.54300499f, 0.779247761f},
-std::array<float,2>{0.310206383f, 0.4416143f},
-std::array<float,2>{0.841238976f, 0.16732654f},
-std::array<float,2>{0.0271987505f, 0.637249112f},
-std::array<float,2>{0.789144218f, 0.82502085f},
-std::array<float,2>{0.0767008141f, 0.405354768f},
-std::array<float,2>{0.572669327f, 0.205370992f},
-std::array<float,2>{0.341715008f, 0.697414577f},
-std::array<float,2>{0.632570088f, 0.589078307f},
-std::array<float,2>{0.461027294f, 0.105088688f},
-std::array<float,2>{0.944218576f, 0.331446677f},
-std::array<float,2>{0.156503722f, 0.958886266f},
-std::array<float,2>{0.883173823f, 0.63259387f},
-std::array<float,2>{0.211408481f, 0.157072231f},
-std::array<float,2>{0.690848291f, 0.450268149f},
-std::array<float,2>{0.418625116f, 0.768990993f},
-std::array<float,2>{0.511089325f, 0.921216249f},
-std::array<float,2>{0.258467287f, 0.256089449f},
-std::array<float,2>{0.851648331f, 0.0517329872f},
-std::array<float,2>{0.0577377789f, 0.532527149f},
-std::array<float,2>{0.98394841f, 0.997661054f},
-std::array<float,2>{0.125787809f, 0.363932461f},
-std::array<float,2>{0.679246902f, 0.0877272189f},
-std::array<float,2>{0.492638767f, 0.593983948f},
-std::array<float,2>{0.616273046f, 0.74571079f},
-std::array<float,2>{0.349572122f, 0.22252433f},
-std::array<float,2>{0.750548542f, 0.427032053f},
-std::array<float,2>{0.104654923f, 0.870251238f},
-std::array<float,2>{0.832008183f, 0.512416005f},
-std::array<float,2>{0.0166143756f, 0.0194611158f},
-std::array<float,2>{0.532900989f, 0.307593256f},
-std::array<float,2>{0.304145336f, 0.905267954f},
-std::array<float,2>{0.722226501f, 0.790845335f},
-std::array<float,2>{0.376898438f, 0.469323069f},
-std::array<float,2>{0.929495692f, 0.154471844f},
-std::array<float,2>{0.231584743f, 0.675599754f},
-std::array<float,2>{0.917423964f, 0.753935814f},
-std::array<float,2>{0.236743554f, 0.466454476f},
-std::array<float,2>{0.73540163f, 0.185125887f},
-std::array<float,2>{0.396220744f, 0.653686345f},
-std::array<float,2>{0.558463633f, 0.549737215f},
-std::array<float,2>{0.282651365f, 0.0397523381f},
-std::array<float,2>{0.82049644f, 0.274010718f},
-std::array<float,2>{0.0135971559f, 0.924487233f},
-std::array<float,2>{0.772047162f, 0.708401024f},
-std::array<float,2>{0.121118963f, 0.19792372f},
-std::array<float,2>{0.607330263f, 0.380424827f},
-std::array<float,2>{0.36410144f, 0.840702653f},
-std::array<float,2>{0.657586515f, 0.944870293f},
-std::array<float,2>{0.470782429f, 0.323682606f},
-std::array<float,2>{0.994372904f, 0.12375199f},
-std::array<float,2>{0.140759677f, 0.575640619f},
-std::array<float,2>{0.861040413f, 0.88630873f},
-std::array<float,2>{0.0394744575f, 0.288087934f},
-std::array<float,2>{0.516712964f, 0.000542085734f},
-std::array<float,2>{0.266162962f, 0.521932483f},
-std::array<float,2>{0.703776062f, 0.658739209f},
-std::array<float,2>{0.428896278f, 0.12865065f},
-std::array<float,2>{0.891811848f, 0.495307684f},
-std::array<float,2>{0.201322868f, 0.810390949f},
-std::array<float,2>{0.954506457f, 0.6137532f},
-std::array<float,2>{0.185367778f, 0.0626781583f},
-std::array<float,2>{0.647611558f, 0.357210755f},
-std::array<float,2>{0.438165069f, 0.97926724f},
-std::array<float,2>{0.581946433f, 0.857657552f},
-std::array<float,2>{0.319465756f, 0.411159903f},
-std::array<float,2>{0.803916395f, 0.248340368f},
-std::array<float,2>{0.0868164748f, 0.721267164f},
-std::array<float,2>{0.863657832f, 0.817003369f},
-std::array<float,2>{0.04675363f, 0.391386986f},
-std::array<float,2>{0.523277283f, 0.216234088f},
-std::array<float,2>{0.269932747f, 0.692498624f},
-std::array<float,2>{0.707488596f, 0.578159034f},
-std::array<float,2>{0.423619658f, 0.0971155986f},
-std::array<float,2>{0.897874892f, 0.341981173f},
-std::array<float,2>{0.196157113f, 0.963165939f},
-std::array<float,2>{0.960454166f, 0.636474848f},
-std::array<float,2>{0.182247415f, 0.169551298f},
-std::array<float,2>{0.644515276f, 0.439788312f},
-std::array<float,2>{0.444605887f, 0.776652098f},
-std::array<float,2>{0.583378851f, 0.9079687f},
-std::array<float,2>{0.31467548f, 0.264328629f},
-std::array<float,2>{0.798056364f, 0.057595294f},
-std::array<float,2>{0.0908963457f, 0.546381474f},
-std::array<float,2>{0.921347558f, 0.987565637f},
-std::array<float,2>{0.239611894f, 0.372852474f},
-std::array<float,2>{0.740331292f, 0.0787781104f},
-std::array<float,2>{0.394287109f, 0.603361309f},
-std::array<float,2>{0.561190784f, 0.73739475f},
-std::array<float,2>{0.286592066f, 0.232217059f},
-std::array<float,2>{0.827272117f, 0.434063017f},
-std::array<float,2>{0.010738153f, 0.860123992f},
-std::array<float,2>{0.767362177f, 0.506742954f},
-std::array<float,2>{0.117433645f, 0.0247228239f},
-std::array<float,2>{0.603188813f, 0.299505442f},
-std::array<float,2>{0.359823376f, 0.892120719f},
-std::array<float,2>{0.663664639f, 0.787026107f},
-std::array<float,2>{0.474433899f, 0.480934083f},
-std::array<float,2>{0.999466777f, 0.145183608f},
-std::array<float,2>{0.14685747f, 0.682419479f},
-std::array<float,2>{0.979952753f, 0.765141129f},
-std::array<float,2>{0.130710185f, 0.453216404f},
-std::array<float,2>{0.674871325f, 0.176530972f},
-std::array<float,2>{0.49657014f, 0.643436432f},
-std::array<float,2>{0.610845923f, 0.557008445f},
-std::array<float,2>{0.344296426f, 0.0335955359f},
-std::array<float,2>{0.757417321f, 0.270516932f},
-std::array<float,2>{0.107511319f, 0.931075037f},
-std::array<float,2>{0.832808495f, 0.718165755f},
-std::array<float,2>{0.0196214579f, 0.188772663f},
-std::array<float,2>{0.538456738f, 0.385007769f},
-std::array<float,2>{0.298404723f, 0.829770625f},
-std::array<float,2>{0.722904146f, 0.948648989f},
-std::array<float,2>{0.379347473f, 0.316727191f},
-std::array<float,2>{0.923916578f, 0.116165556f},
-std::array<float,2>{0.226734713f, 0.563014925f},
-std::array<float,2>{0.795168161f, 0.878173649f},
-std::array<float,2>{0.0741743222f, 0.296236813f},
-std::array<float,2>{0.576451361f, 0.00931796245f},
-std::array<float,2>{0.338261724f, 0.525372207f},
-std::array<float,2>{0.627704859f, 0.668351948f},
-std::array<float,2>{0.467283994f, 0.140120924f},
-std::array<float,2>{0.940310001f, 0.485134184f},
-std::array<float,2>{0.160361573f, 0.800595403f},
-std::array<float,2>{0.89026475f, 0.624163687f},
-std::array<float,2>{0.215890869f, 0.0755369067f},
-std::array<float,2>{0.691573799f, 0.349296451f},
-std::array<float,2>{0.416530967f, 0.97326082f},
-std::array<float,2>{0.512212157f, 0.84893769f},
-std::array<float,2>{0.263815403f, 0.415337205f},
-std::array<float,2>{0.859313369f, 0.241542622f},
-std::array<float,2>{0.0612450428f, 0.729934454f},
-std::array<float,2>{0.759472787f, 0.804951131f},
-std::array<float,2>{0.0963256732f, 0.496683151f},
-std::array<float,2>{0.61958909f, 0.132344261f},
-std::array<float,2>{0.358928621f, 0.663373232f},
-std::array<float,2>{0.682799339f, 0.516031563f},
-std::array<float,2>{0.489844918f, 0.00415121065f},
-std::array<float,2>{0.973614931f, 0.283771724f},
-std::array<float,2>{0.139410153f, 0.886847556f},
-std::array<float,2>{0.935089886f, 0.725534499f},
-std::array<float,2>{0.222951815f, 0.24413754f},
-std::array<float,2>{0.732748091f, 0.407028258f},
-std::array<float,2>{0.383655131f, 0.853926778f},
-std::array<float,2>{0.542095423f, 0.98217696f},
-std::array<float,2>{0.307692558f, 0.354067266f},
-std::array<float,2>{0.837617934f, 0.0695428327f},
-std::array<float,2>{0.0309331063f, 0.61226666f},
-std::array<float,2>{0.946131468f, 0.926404536f},
-std::array<float,2>{0.17065835f, 0.280162096f},
-std::array<float,2>{0.632966042f, 0.046234075f},
-std::array<float,2>{0.458675027f, 0.55437845f},
-std::array<float,2>{0.566529989f, 0.652107596f},
-std::array<float,2>{0.332876205f, 0.182728052f},
-std::array<float,2>{0.78332597f, 0.463399202f},
-std::array<float,2>{0.0690529868f, 0.750699103f},
-std::array<float,2>{0.846334636f, 0.571773052f},
-std::array<float,2>{0.053293217f, 0.120403878f},
-std::array<float,2>{0.505487978f, 0.325339496f},
-std::array<float,2>{0.250672668f, 0.940633535f},
-std::array<float,2>{0.700560868f, 0.836789429f},
-std::array<float,2>{0.412131727f, 0.37628442f},
-std::array<float,2>{0.876412988f, 0.202977732f},
-std::array<float,2>{0.203380033f, 0.70487988f},
-std::array<float,2>{0.89897871f, 0.872786164f},
-std::array<float,2>{0.194834486f, 0.424751043f},
-std::array<float,2>{0.7124331f, 0.225666225f},
-std::array<float,2>{0.434712946f, 0.746822536f},
-std::array<float,2>{0.528128624f, 0.597820878f},
-std::array<float,2>{0.27785027f, 0.090547502f},
-std::array<float,2>{0.871091843f, 0.360159278f},
-std::array<float,2>{0.0336438268f, 0.993686855f},
-std::array<float,2>{0.807756484f, 0.676549315f},
-std::array<float,2>{0.0799650922f, 0.15074335f},
-std::array<float,2>{0.590006113f, 0.473964274f},
-std::array<float,2>{0.323419839f, 0.793331623f},
-std::array<float,2>{0.652582884f, 0.899547696f},
-std::array<float,2>{0.450173974f, 0.312107801f},
-std::array<float,2>{0.962145805f, 0.0201774854f},
-std::array<float,2>{0.177450702f, 0.508740008f},
-std::array<float,2>{0.81774193f, 0.953152955f},
-std::array<float,2>{0.00439846283f, 0.333888382f},
-std::array<float,2>{0.54812026f, 0.10708493f},
-std::array<float,2>{0.295790851f, 0.590297878f},
-std::array<float,2>{0.747358143f, 0.702682793f},
-std::array<float,2>{0.401319087f, 0.210869208f},
-std::array<float,2>{0.911176801f, 0.401022822f},
-std::array<float,2>{0.245703444f, 0.823364854f},
-std::array<float,2>{0.991485f, 0.538283169f},
-std::array<float,2>{0.149587065f, 0.0506419241f},
-std::array<float,2>{0.668036103f, 0.253345788f},
-std::array<float,2>{0.480390251f, 0.915836692f},
-std::array<float,2>{0.594329119f, 0.771462798f},
-std::array<float,2>{0.372433275f, 0.445901036f},
-std::array<float,2>{0.77604568f, 0.162280574f},
-std::array<float,2>{0.111883692f, 0.62513119f},
-std::array<float,2>{0.839932263f, 0.780437827f},
-std::array<float,2>{0.0254250448f, 0.444418848f},
-std::array<float,2>{0.544920325f, 0.16421552f},
-std::array<float,2>{0.308888465f, 0.640286446f},
-std::array<float,2>{0.728937984f, 0.539619744f},
-std::array<float,2>{0.388988078f, 0.0616822056f},
-std::array<float,2>{0.931264818f, 0.258164734f},
-std::array<float,2>{0.221180841f, 0.911723793f},
-std::array<float,2>{0.971746266f, 0.689580083f},
-std::array<float,2>{0.134873018f, 0.213358253f},
-std::array<float,2>{0.686158717f, 0.396206319f},
-std::array<float,2>{0.487673551f, 0.812952101f},
-std::array<float,2>{0.623098433f, 0.966796398f},
-std::array<float,2>{0.352758855f, 0.336041331f},
-std::array<float,2>{0.763161004f, 0.0978011116f},
-std::array<float,2>{0.0977290645f, 0.584615827f},
-std::array<float,2>{0.882116318f, 0.894786358f},
-std::array<float,2>{0.210765496f, 0.302121192f},
-std::array<float,2>{0.699170411f, 0.0280181114f},
-std::array<float,2>{0.406319052f, 0.50097847f},
-std::array<float,2>{0.501717448f, 0.686802506f},
-std::array<float,2>{0.256223351f, 0.142793879f},
-std::array<float,2>{0.848029852f, 0.479330778f},
-std::array<float,2>{0.0472748801f, 0.782303333f},
-std::array<float,2>{0.788012028f, 0.606426418f},
-std::array<float,2>{0.0656693429f, 0.083948046f},
-std::array<float,2>{0.564229906f, 0.368042886f},
-std::array<float,2>{0.329402357f, 0.990948379f},
-std::array<float,2>{0.638355196f, 0.866723597f},
-std::array<float,2>{0.456545293f, 0.430506647f},
-std::array<float,2>{0.950624168f, 0.22961472f},
-std::array<float,2>{0.167180032f, 0.742001414f},
-std::array<float,2>{0.966082752f, 0.835150659f},
-std::array<float,2>{0.17558974f, 0.387731642f},
-std::array<float,2>{0.649160922f, 0.192208976f},
-std::array<float,2>{0.445559263f, 0.712866426f},
-std::array<float,2>{0.589052618f, 0.567195952f},
-std::array<float,2>{0.325285822f, 0.111907229f},
-std::array<float,2>{0.810295999f, 0.313395977f},
-std::array<float,2>{0.0832826123f, 0.95214504f},
-std::array<float,2>{0.874527752f, 0.647113383f},
-std::array<float,2>{0.0370800383f, 0.1727826f},
-std::array<float,2>{0.523740947f, 0.460725039f},
-std::array<float,2>{0.276437461f, 0.758307636f},
-std::array<float,2>{0.716128886f, 0.936236262f},
-std::array<float,2>{0.430984795f, 0.268246323f},
-std::array<float,2>{0.904551685f, 0.0363794453f},
-std::array<float,2>{0.187594041f, 0.558624327f},
-std::array<float,2>{0.779660225f, 0.971840322f},
-std::array<float,2>{0.116155714f, 0.346971303f},
-std::array<float,2>{0.597985625f, 0.0734885931f},
-std::array<float,2>{0.367584467f, 0.619723499f},
-std::array<float,2>{0.666728556f, 0.730784357f},
-std::array<float,2>{0.481801182f, 0.235494554f},
-std::array<float,2>{0.985665798f, 0.419258863f},
-std::array<float,2>{0.15434505f, 0.847433209f},
-std::array<float,2>{0.90640527f, 0.530819893f},
-std::array<float,2>{0.249570549f, 0.0128923412f},
-std::array<float,2>{0.742800534f, 0.28947711f},
-std::array<float,2>{0.403255492f, 0.880416751f},
-std::array<float,2>{0.552670538f, 0.801257074f},
-std::array<float,2>{0.291473389f, 0.491888672f},
-std::array<float,2>{0.814898551f, 0.135804728f},
-std::array<float,2>{0.00202519656f, 0.665155947f},
-std::array<float,2>{0.803060591f, 0.855943799f},
-std::array<float,2>{0.0875578672f, 0.413129747f},
-std::array<float,2>{0.580826163f, 0.247292861f},
-std::array<float,2>{0.318593979f, 0.72028178f},
-std::array<float,2>{0.647165179f, 0.616401136f},
-std::array<float,2>{0.438883871f, 0.0660818294f},
-std::array<float,2>{0.953321457f, 0.358079076f},
-std::array<float,2>{0.184373543f, 0.977762103f},
-std::array<float,2>{0.890938103f, 0.656635463f},
-std::array<float,2>{0.20217517f, 0.125536621f},
-std::array<float,2>{0.704183459f, 0.492638946f},
-std::array<float,2>{0.428591818f, 0.811094642f},
-std::array<float,2>{0.516568542f, 0.883165777f},
-std::array<float,2>{0.266678244f, 0.28688255f},
-std::array<float,2>{0.86006254f, 0.00281796209f},
-std::array<float,2>{0.0409658104f, 0.520874441f},
-std::array<float,2>{0.995797992f, 0.94245559f},
-std::array<float,2>{0.142160133f, 0.321401f},
-std::array<float,2>{0.657091022f, 0.121406578f},
-std::array<float,2>{0.472608894f, 0.577775776f},
-std::array<float,2>{0.606209397f, 0.710548341f},
-std::array<float,2>{0.364690512f, 0.196203887f},
-std::array<float,2>{0.772993147f, 0.382718027f},
-std::array<float,2>{0.122741215f, 0.843735278f},
-std::array<float,2>{0.821921706f, 0.547229528f},
-std::array<float,2>{0.0120551037f, 0.0415784903f},
-std::array<float,2>{0.557477891f, 0.276713997f},
-std::array<float,2>{0.282046527f, 0.923676372f},
-std::array<float,2>{0.734756887f, 0.757501423f},
-std::array<float,2>{0.394607693f, 0.468697011f},
-std::array<float,2>{0.916785896f, 0.187127441f},
-std::array<float,2>{0.237366363f, 0.655540824f},
-std::array<float,2>{0.928700089f, 0.792491376f},
-std::array<float,2>{0.231270194f, 0.472646505f},
-std::array<float,2>{0.720832109f, 0.153134108f},
-std::array<float,2>{0.375642151f, 0.672447741f},
-std::array<float,2>{0.53172034f, 0.515219569f},
-std::array<float,2>{0.303698123f, 0.016918838f},
-std::array<float,2>{0.830381334f, 0.306299329f},
-std::array<float,2>{0.0158570595f, 0.90244472f},
-std::array<float,2>{0.751450181f, 0.74331218f},
-std::array<float,2>{0.103725925f, 0.220245719f},
-std::array<float,2>{0.615258694f, 0.428984314f},
-std::array<float,2>{0.348276675f, 0.868863225f},
-std::array<float,2>{0.677812219f, 0.999668181f},
-std::array<float,2>{0.493550092f, 0.365799397f},
-std::array<float,2>{0.982704103f, 0.0898437202f},
-std::array<float,2>{0.126750574f, 0.597643495f},
-std::array<float,2>{0.852660477f, 0.918111622f},
-std::array<float,2>{0.0570413806f, 0.254503161f},
-std::array<float,2>{0.51000303f, 0.0541079454f},
-std::array<float,2>{0.259286314f, 0.534995615f},
-std::array<float,2>{0.689772964f, 0.630083263f},
-std::array<float,2>{0.419445276f, 0.159191206f},
-std::array<float,2>{0.884137273f, 0.452772409f},
-std::array<float,2>{0.212658554f, 0.766206324f},
-std::array<float,2>{0.944431365f, 0.586342096f},
-std::array<float,2>{0.157323048f, 0.102732792f},
-std::array<float,2>{0.631560087f, 0.328891844f},
-std::array<float,2>{0.462650508f, 0.960327685f},
-std::array<float,2>{0.573506534f, 0.826242805f},
-std::array<float,2>{0.339912504f, 0.40400365f},
-std::array<float,2>{0.790790558f, 0.204276472f},
-std::array<float,2>{0.0772771016f, 0.696578443f},
-std::array<float,2>{0.82568115f, 0.862101614f},
-std::array<float,2>{0.00899489503f, 0.43652612f},
-std::array<float,2>{0.559232175f, 0.232793838f},
-std::array<float,2>{0.288715512f, 0.735393345f},
-std::array<float,2>{0.739746571f, 0.603743434f},
-std::array<float,2>{0.391974837f, 0.0803387985f},
-std::array<float,2>{0.919363022f, 0.373327762f},
-std::array<float,2>{0.240998894f, 0.984850526f},
-std::array<float,2>{0.997074366f, 0.681566715f},
-std::array<float,2>{0.145932689f, 0.147100002f},
-std::array<float,2>{0.660834908f, 0.483550429f},
-std::array<float,2>{0.476158321f, 0.787551224f},
-std::array<float,2>{0.605094135f, 0.893305123f},
-std::array<float,2>{0.363182515f, 0.298172385f},
-std::array<float,2>{0.767706394f, 0.0263641775f},
-std::array<float,2>{0.120765947f, 0.505459905f},
-std::array<float,2>{0.895633578f, 0.96118921f},
-std::array<float,2>{0.198777631f, 0.339957148f},
-std::array<float,2>{0.710797191f, 0.0940641016f},
-std::array<float,2>{0.425097406f, 0.581624508f},
-std::array<float,2>{0.520824134f, 0.693445683f},
-std::array<float,2>{0.272673815f, 0.217243657f},
-std::array<float,2>{0.86696744f, 0.394105911f},
-std::array<float,2>{0.0438690931f, 0.819168627f},
-std::array<float,2>{0.799391091f, 0.544745266f},
-std::array<float,2>{0.0920342579f, 0.0562501103f},
-std::array<float,2>{0.584702849f, 0.263444126f},
-std::array<float,2>{0.314141303f, 0.908773482f},
-std::array<float,2>{0.641786456f, 0.775144935f},
-std::array<float,2>{0.442526042f, 0.43753922f},
-std::array<float,2>{0.958475769f, 0.171169221f},
-std::array<float,2>{0.181502715f, 0.633351803f},
-std::array<float,2>{0.938474119f, 0.797323704f},
-std::array<float,2>{0.162687853f, 0.487440914f},
-std::array<float,2>{0.626936674f, 0.137620315f},
-std::array<float,2>{0.465268224f, 0.671124041f},
-std::array<float,2>{0.575546503f, 0.526675284f},
-std::array<float,2>{0.336704731f, 0.0115435012f},
-std::array<float,2>{0.793323696f, 0.294233918f},
-std::array<float,2>{0.0708034337f, 0.875638306f},
-std::array<float,2>{0.85577774f, 0.727863908f},
-std::array<float,2>{0.059469983f, 0.239614546f},
-std::array<float,2>{0.513962209f, 0.416189224f},
-std::array<float,2>{0.262274861f, 0.850614369f},
-std::array<float,2>{0.693828404f, 0.976176381f},
-std::array<float,2>{0.41509515f, 0.351167321f},
-std::array<float,2>{0.887882113f, 0.0778381526f},
-std::array<float,2>{0.217803165f, 0.62152344f},
-std::array<float,2>{0.754879057f, 0.932611585f},
-std::array<float,2>{0.107327051f, 0.272663921f},
-std::array<float,2>{0.613072932f, 0.0319748223f},
-std::array<float,2>{0.347635269f, 0.555211425f},
-std::array<float,2>{0.673515618f, 0.641453683f},
-std::array<float,2>{0.498101801f, 0.178144664f},
-std::array<float,2>{0.977744937f, 0.45680505f},
-std::array<float,2>{0.131245568f, 0.763041317f},
-std::array<float,2>{0.922710419f, 0.564860165f},
-std::array<float,2>{0.230214089f, 0.114726231f},
-std::array<float,2>{0.725874364f, 0.318723857f},
-std::array<float,2>{0.382240146f, 0.946827292f},
-std::array<float,2>{0.536365926f, 0.830430746f},
-std::array<float,2>{0.299598992f, 0.383294284f},
-std::array<float,2>{0.835272968f, 0.190685913f},
-std::array<float,2>{0.0218705982f, 0.716151893f},
-std::array<float,2>{0.781692147f, 0.752007306f},
-std::array<float,2>{0.0680108964f, 0.460956573f},
-std::array<float,2>{0.568709791f, 0.180682883f},
-std::array<float,2>{0.335247159f, 0.649128556f},
-std::array<float,2>{0.635735333f, 0.551472008f},
-std::array<float,2>{0.459745437f, 0.0431348085f},
-std::array<float,2>{0.947825849f, 0.278396398f},
-std::array<float,2>{0.169759959f, 0.929259896f},
-std::array<float,2>{0.877554178f, 0.706100225f},
-std::array<float,2>{0.205553114f, 0.199539214f},
-std::array<float,2>{0.701218128f, 0.377338946f},
-std::array<float,2>{0.410157979f, 0.839215457f},
-std::array<float,2>{0.507749319f, 0.938191175f},
-std::array<float,2>{0.252020478f, 0.327648073f},
-std::array<float,2>{0.84417963f, 0.118728161f},
-std::array<float,2>{0.0523867235f, 0.573766768f},
-std::array<float,2>{0.975774467f, 0.889120281f},
-std::array<float,2>{0.137928024f, 0.281426728f},
-std::array<float,2>{0.679738104f, 0.0075881551f},
-std::array<float,2>{0.49162057f, 0.518735886f},
-std::array<float,2>{0.617621481f, 0.661579192f},
-std::array<float,2>{0.356050521f, 0.13031818f},
-std::array<float,2>{0.760213196f, 0.499809831f},
-std::array<float,2>{0.0947082043f, 0.807673454f},
-std::array<float,2>{0.837917745f, 0.609847963f},
-std::array<float,2>{0.0292279851f, 0.0674166605f},
-std::array<float,2>{0.540210783f, 0.351906121f},
-std::array<float,2>{0.305677116f, 0.984374106f},
-std::array<float,2>{0.73166734f, 0.853467286f},
-std::array<float,2>{0.385917634f, 0.409252435f},
-std::array<float,2>{0.937189639f, 0.245795861f},
-std::array<float,2>{0.225059301f, 0.724229991f},
-std::array<float,2>{0.912896991f, 0.82110846f},
-std::array<float,2>{0.242993757f, 0.400006473f},
-std::array<float,2>{0.748237908f, 0.208955854f},
-std::array<float,2>{0.399622262f, 0.699419916f},
-std::array<float,2>{0.549597144f, 0.59325552f},
-std::array<float,2>{0.29489845f, 0.107927889f},
-std::array<float,2>{0.819624066f, 0.334994167f},
-std::array<float,2>{0.00736218132f, 0.955848157f},
-std::array<float,2>{0.775217295f, 0.62875545f},
-std::array<float,2>{0.109672502f, 0.160222337f},
-std::array<float,2>{0.597598553f, 0.448438048f},
-std::array<float,2>{0.374599934f, 0.773030996f},
-std::array<float,2>{0.671278536f, 0.916187525f},
-std::array<float,2>{0.477207392f, 0.250765741f},
-std::array<float,2>{0.988853216f, 0.0482461788f},
-std::array<float,2>{0.152282327f, 0.5351578f},
-std::array<float,2>{0.867745101f, 0.995616496f},
-std::array<float,2>{0.0330757499f, 0.362909019f},
-std::array<float,2>{0.529556215f, 0.0924389735f},
-std::array<float,2>{0.279818267f, 0.600202501f},
-std::array<float,2>{0.713936567f, 0.748590589f},
-std::array<float,2>{0.435656369f, 0.224584669f},
-std::array<float,2>{0.901058376f, 0.423399806f},
-std::array<float,2>{0.193322435f, 0.874456108f},
-std::array<float,2>{0.96477735f, 0.510944963f},
-std::array<float,2>{0.178854376f, 0.0229850505f},
-std::array<float,2>{0.655704975f, 0.310209066f},
-std::array<float,2>{0.45207262f, 0.901165247f},
-std::array<float,2>{0.593733728f, 0.795226455f},
-std::array<float,2>{0.320342273f, 0.47533074f},
-std::array<float,2>{0.805833697f, 0.150353521f},
-std::array<float,2>{0.0801730081f, 0.678935826f},
-std::array<float,2>{0.851178586f, 0.783348143f},
-std::array<float,2>{0.0491681136f, 0.477000028f},
-std::array<float,2>{0.502069116f, 0.141950309f},
-std::array<float,2>{0.255071819f, 0.684992552f},
-std::array<float,2>{0.696430743f, 0.502396762f},
-std::array<float,2>{0.408417106f, 0.0299817622f},
-std::array<float,2>{0.879657805f, 0.304234803f},
-std::array<float,2>{0.207310498f, 0.897379041f},
-std::array<float,2>{0.951545894f, 0.73872906f},
-std::array<float,2>{0.165095463f, 0.227913246f},
-std::array<float,2>{0.640420973f, 0.43335408f},
-std::array<float,2>{0.454998881f, 0.86368233f},
-std::array<float,2>{0.56626302f, 0.989787579f},
-std::array<float,2>{0.331097096f, 0.370142788f},
-std::array<float,2>{0.786192656f, 0.085075222f},
-std::array<float,2>{0.0632144511f, 0.608605027f},
-std::array<float,2>{0.932536125f, 0.913777888f},
-std::array<float,2>{0.220519662f, 0.261439294f},
-std::array<float,2>{0.72795105f, 0.0601916276f},
-std::array<float,2>{0.387757957f, 0.542353332f},
-std::array<float,2>{0.545112729f, 0.638406634f},
-std::array<float,2>{0.311270863f, 0.166548923f},
-std::array<float,2>{0.841954589f, 0.442671448f},
-std::array<float,2>{0.0235427916f, 0.778003335f},
-std::array<float,2>{0.763996661f, 0.583036542f},
-std::array<float,2>{0.101104081f, 0.100634478f},
-std::array<float,2>{0.621372581f, 0.339122504f},
-std::array<float,2>{0.355026335f, 0.967312217f},
-std::array<float,2>{0.684032917f, 0.814870954f},
-std::array<float,2>{0.485423714f, 0.396766752f},
-std::array<float,2>{0.970575511f, 0.212227404f},
-std::array<float,2>{0.133711532f, 0.688961923f},
-std::array<float,2>{0.987588227f, 0.844963014f},
-std::array<float,2>{0.153032467f, 0.421028972f},
-std::array<float,2>{0.665071309f, 0.236680046f},
-std::array<float,2>{0.48333779f, 0.733632863f},
-std::array<float,2>{0.601314604f, 0.618198216f},
-std::array<float,2>{0.37105906f, 0.0716087595f},
-std::array<float,2>{0.77915591f, 0.344905943f},
-std::array<float,2>{0.113659494f, 0.970575213f},
-std::array<float,2>{0.813107431f, 0.666199028f},
-std::array<float,2>{0.000811993901f, 0.134498745f},
-std::array<float,2>{0.553630948f, 0.489406735f},
-std::array<float,2>{0.290689439f, 0.802738488f},
-std::array<float,2>{0.745243311f, 0.88169682f},
-std::array<float,2>{0.406106442f, 0.291516274f},
-std::array<float,2>{0.909378707f, 0.0145262452f},
-std::array<float,2>{0.247304842f, 0.527364314f},
-std::array<float,2>{0.812419891f, 0.949569523f},
-std::array<float,2>{0.0850995257f, 0.314912796f},
-std::array<float,2>{0.586532176f, 0.109972164f},
-std::array<float,2>{0.326791584f, 0.569907546f},
-std::array<float,2>{0.651709855f, 0.713763654f},
-std::array<float,2>{0.447835833f, 0.19400087f},
-std::array<float,2>{0.967446208f, 0.389842033f},
-std::array<float,2>{0.172261149f, 0.832845271f},
-std::array<float,2>{0.903923631f, 0.561910748f},
-std::array<float,2>{0.19090037f, 0.0375807881f},
-std::array<float,2>{0.717149079f, 0.266003102f},
-std::array<float,2>{0.433358014f, 0.934147954f},
-std::array<float,2>{0.525771618f, 0.761035383f},
-std::array<float,2>{0.27425012f, 0.457834154f},
-std::array<float,2>{0.872547865f, 0.174237505f},
-std::array<float,2>{0.038880568f, 0.646165311f},
-std::array<float,2>{0.769675076f, 0.841757596f},
-std::array<float,2>{0.124751881f, 0.379527479f},
-std::array<float,2>{0.608764112f, 0.199139103f},
-std::array<float,2>{0.36608988f, 0.707849383f},
-std::array<float,2>{0.65887177f, 0.574544609f},
-std::array<float,2>{0.469399005f, 0.124123253f},
-std::array<float,2>{0.993526459f, 0.322458982f},
-std::array<float,2>{0.143247798f, 0.943528652f},
-std::array<float,2>{0.915008783f, 0.653124511f},
-std::array<float,2>{0.234839931f, 0.183810979f},
-std::array<float,2>{0.737277627f, 0.465150833f},
-std::array<float,2>{0.398243278f, 0.754884362f},
-std::array<float,2>{0.556067407f, 0.925029218f},
-std::array<float,2>{0.283780545f, 0.274827361f},
-std::array<float,2>{0.822396338f, 0.0409143195f},
-std::array<float,2>{0.0140464976f, 0.549928486f},
-std::array<float,2>{0.956984878f, 0.979911923f},
-std::array<float,2>{0.186549842f, 0.355887204f},
-std::array<float,2>{0.644606054f, 0.0641699657f},
-std::array<float,2>{0.439951062f, 0.614643574f},
-std::array<float,2>{0.578447878f, 0.721817911f},
-std::array<float,2>{0.316638023f, 0.24951227f},
-std::array<float,2>{0.802138448f, 0.410253167f},
-std::array<float,2>{0.0892952979f, 0.858722627f},
-std::array<float,2>{0.862882555f, 0.523398221f},
-std::array<float,2>{0.0415885039f, 0.001864383f},
-std::array<float,2>{0.517808497f, 0.287627727f},
-std::array<float,2>{0.268030554f, 0.885283232f},
-std::array<float,2>{0.706022501f, 0.808977485f},
-std::array<float,2>{0.426675826f, 0.494633257f},
-std::array<float,2>{0.893518806f, 0.126985073f},
-std::array<float,2>{0.200227305f, 0.659947574f},
-std::array<float,2>{0.886555374f, 0.767835855f},
-std::array<float,2>{0.21478869f, 0.449339539f},
-std::array<float,2>{0.688174486f, 0.158133164f},
-std::array<float,2>{0.420075595f, 0.63105458f},
-std::array<float,2>{0.509649277f, 0.532168806f},
-std::array<float,2>{0.260140091f, 0.0524757802f},
-std::array<float,2>{0.854279339f, 0.257643372f},
-std::array<float,2>{0.0566087216f, 0.920102537f},
-std::array<float,2>{0.792004168f, 0.699026406f},
-std::array<float,2>{0.0742839575f, 0.206226587f},
-std::array<float,2>{0.572097003f, 0.405232966f},
-std::array<float,2>{0.342177182f, 0.826113284f},
-std::array<float,2>{0.628996849f, 0.957803547f},
-std::array<float,2>{0.463741839f, 0.33042708f},
-std::array<float,2>{0.941558003f, 0.10428112f},
-std::array<float,2>{0.159275219f, 0.588547707f},
-std::array<float,2>{0.828852594f, 0.906124055f},
-std::array<float,2>{0.0181193072f, 0.30779162f},
-std::array<float,2>{0.533850074f, 0.0181223694f},
-std::array<float,2>{0.302380294f, 0.51301825f},
-std::array<float,2>{0.719239056f, 0.674678087f},
-std::array<float,2>{0.378725648f, 0.155454814f},
-std::array<float,2>{0.926311374f, 0.470093369f},
-std::array<float,2>{0.23409f, 0.789667308f},
-std::array<float,2>{0.98082459f, 0.594906151f},
-std::array<float,2>{0.128775939f, 0.0865902081f},
-std::array<float,2>{0.67644304f, 0.364552587f},
-std::array<float,2>{0.495361418f, 0.99624145f},
-std::array<float,2>{0.61403954f, 0.869530737f},
-std::array<float,2>{0.350753874f, 0.426616997f},
-std::array<float,2>{0.752527833f, 0.221662015f},
-std::array<float,2>{0.101650961f, 0.744561434f},
-std::array<float,2>{0.822673261f, 0.842316747f},
-std::array<float,2>{0.013747097f, 0.381556034f},
-std::array<float,2>{0.555834115f, 0.196758643f},
-std::array<float,2>{0.284085691f, 0.709560275f},
-std::array<float,2>{0.736977935f, 0.576619744f},
-std::array<float,2>{0.39796415f, 0.122126967f},
-std::array<float,2>{0.914775074f, 0.320365071f},
-std::array<float,2>{0.234481856f, 0.941498399f},
-std::array<float,2>{0.993300557f, 0.654303789f},
-std::array<float,2>{0.143434554f, 0.186167702f},
-std::array<float,2>{0.658956409f, 0.467671573f},
-std::array<float,2>{0.469603479f, 0.755911827f},
-std::array<float,2>{0.608550847f, 0.922337592f},
-std::array<float,2>{0.365924358f, 0.275898963f},
-std::array<float,2>{0.769906819f, 0.0428332947f},
-std::array<float,2>{0.124882467f, 0.548307836f},
-std::array<float,2>{0.89307493f, 0.977037847f},
-std::array<float,2>{0.200630099f, 0.358659565f},
-std::array<float,2>{0.705731511f, 0.0649910718f},
-std::array<float,2>{0.426466048f, 0.615978241f},
-std::array<float,2>{0.51805979f, 0.719397485f},
-std::array<float,2>{0.26774469f, 0.246833339f},
-std::array<float,2>{0.863216996f, 0.412329555f},
-std::array<float,2>{0.0418362059f, 0.857184172f},
-std::array<float,2>{0.801880896f, 0.520236671f},
-std::array<float,2>{0.0888967663f, 0.00341213262f},
-std::array<float,2>{0.578331351f, 0.2859689f},
-std::array<float,2>{0.316877455f, 0.884147286f},
-std::array<float,2>{0.644909978f, 0.812109709f},
-std::array<float,2>{0.440358192f, 0.493532181f},
-std::array<float,2>{0.956639588f, 0.126365349f},
-std::array<float,2>{0.186905891f, 0.658153892f},
-std::array<float,2>{0.941769063f, 0.767349899f},
-std::array<float,2>{0.159506351f, 0.452061445f},
-std::array<float,2>{0.629329681f, 0.158802435f},
-std::array<float,2>{0.463599235f, 0.629361153f},
-std::array<float,2>{0.571875751f, 0.533228755f},
-std::array<float,2>{0.341811031f, 0.0531207286f},
-std::array<float,2>{0.792304754f, 0.255449712f},
-std::array<float,2>{0.0745761096f, 0.91931802f},
-std::array<float,2>{0.854215443f, 0.695408165f},
-std::array<float,2>{0.0561977178f, 0.204056412f},
-std::array<float,2>{0.509324014f, 0.402489215f},
-std::array<float,2>{0.259819537f, 0.827888787f},
-std::array<float,2>{0.688233793f, 0.959900498f},
-std::array<float,2>{0.420392066f, 0.329609126f},
-std::array<float,2>{0.886334538f, 0.101924315f},
-std::array<float,2>{0.214540467f, 0.587698996f},
-std::array<float,2>{0.75281775f, 0.903792262f},
-std::array<float,2>{0.101975553f, 0.305429041f},
-std::array<float,2>{0.613794088f, 0.0157242808f},
-std::array<float,2>{0.351035267f, 0.514222264f},
-std::array<float,2>{0.676580727f, 0.673011124f},
-std::array<float,2>{0.495153666f, 0.153700262f},
-std::array<float,2>{0.980636418f, 0.47138226f},
-std::array<float,2>{0.128613636f, 0.791966975f},
-std::array<float,2>{0.926579416f, 0.59605068f},
-std::array<float,2>{0.234193414f, 0.0888524279f},
-std::array<float,2>{0.7195611f, 0.366758108f},
-std::array<float,2>{0.378455371f, 0.99805975f},
-std::array<float,2>{0.534123659f, 0.867429256f},
-std::array<float,2>{0.302585781f, 0.427821219f},
-std::array<float,2>{0.829094231f, 0.219207004f},
-std::array<float,2>{0.0184542183f, 0.74260062f},
-std::array<float,2>{0.786534786f, 0.781440377f},
-std::array<float,2>{0.0633256957f, 0.480233431f},
-std::array<float,2>{0.566160381f, 0.144193619f},
-std::array<float,2>{0.331320345f, 0.686104894f},
-std::array<float,2>{0.640174389f, 0.500791013f},
-std::array<float,2>{0.454698801f, 0.0291385632f},
-std::array<float,2>{0.951356173f, 0.300900698f},
-std::array<float,2>{0.165516168f, 0.896450341f},
-std::array<float,2>{0.879550636f, 0.740295291f},
-std::array<float,2>{0.207208067f, 0.229338154f},
-std::array<float,2>{0.696685016f, 0.430723518f},
-std::array<float,2>{0.408465415f, 0.865860283f},
-std::array<float,2>{0.502428949f, 0.991768301f},
-std::array<float,2>{0.255181789f, 0.368797272f},
-std::array<float,2>{0.85150969f, 0.0827768743f},
-std::array<float,2>{0.0488996804f, 0.607324779f},
-std::array<float,2>{0.970234752f, 0.911117256f},
-std::array<float,2>{0.133444652f, 0.259052575f},
-std::array<float,2>{0.683790684f, 0.0606847703f},
-std::array<float,2>{0.485762596f, 0.540869415f},
-std::array<float,2>{0.621281326f, 0.639156282f},
-std::array<float,2>{0.355455369f, 0.166012704f},
-std::array<float,2>{0.763758183f, 0.444072902f},
-std::array<float,2>{0.101372309f, 0.780257583f},
-std::array<float,2>{0.842131674f, 0.585907876f},
-std::array<float,2>{0.0236962177f, 0.0995005816f},
-std::array<float,2>{0.545358419f, 0.337278992f},
-std::array<float,2>{0.311404675f, 0.965422153f},
-std::array<float,2>{0.727754951f, 0.81412065f},
-std::array<float,2>{0.388106644f, 0.395386606f},
-std::array<float,2>{0.932278335f, 0.214513287f},
-std::array<float,2>{0.220299765f, 0.690854073f},
-std::array<float,2>{0.909623563f, 0.845774412f},
-std::array<float,2>{0.247418106f, 0.41811958f},
-std::array<float,2>{0.745377958f, 0.234622836f},
-std::array<float,2>{0.405919284f, 0.732056022f},
-std::array<float,2>{0.55344975f, 0.620406866f},
-std::array<float,2>{0.290862769f, 0.0729515329f},
-std::array<float,2>{0.813252449f, 0.346417725f},
-std::array<float,2>{0.000594204699f, 0.970978856f},
-std::array<float,2>{0.778998911f, 0.664293289f},
-std::array<float,2>{0.113510564f, 0.135083407f},
-std::array<float,2>{0.601437509f, 0.490799695f},
-std::array<float,2>{0.370642155f, 0.801825583f},
-std::array<float,2>{0.665489018f, 0.879064262f},
-std::array<float,2>{0.482981801f, 0.29049471f},
-std::array<float,2>{0.987474918f, 0.0119882245f},
-std::array<float,2>{0.153313607f, 0.529521942f},
-std::array<float,2>{0.872074783f, 0.95223105f},
-std::array<float,2>{0.0387245789f, 0.313596874f},
-std::array<float,2>{0.525522649f, 0.112970352f},
-std::array<float,2>{0.274087608f, 0.568340898f},
-std::array<float,2>{0.716981232f, 0.711049616f},
-std::array<float,2>{0.433339685f, 0.193093643f},
-std::array<float,2>{0.904085398f, 0.386999846f},
-std::array<float,2>{0.19066906f, 0.834321558f},
-std::array<float,2>{0.967732847f, 0.560402155f},
-std::array<float,2>{0.171938404f, 0.0359560102f},
-std::array<float,2>{0.65151614f, 0.269059807f},
-std::array<float,2>{0.448044002f, 0.936591506f},
-std::array<float,2>{0.586787403f, 0.759423375f},
-std::array<float,2>{0.326967716f, 0.459235758f},
-std::array<float,2>{0.812068641f, 0.173674628f},
-std::array<float,2>{0.0852275267f, 0.647643685f},
-std::array<float,2>{0.843938649f, 0.751610756f},
-std::array<float,2>{0.052525986f, 0.464761764f},
-std::array<float,2>{0.50755018f, 0.182150602f},
-std::array<float,2>{0.252217948f, 0.650752604f},
-std::array<float,2>{0.701607108f, 0.553451657f},
-std::array<float,2>{0.410544246f, 0.0458483957f},
-std::array<float,2>{0.877901852f, 0.280688107f},
-std::array<float,2>{0.205301106f, 0.926899612f},
-std::array<float,2>{0.948095679f, 0.703314066f},
-std::array<float,2>{0.169648573f, 0.201913297f},
-std::array<float,2>{0.635397196f, 0.375197589f},
-std::array<float,2>{0.459595472f, 0.837623656f},
-std::array<float,2>{0.568363428f, 0.939896345f},
-std::array<float,2>{0.334987313f, 0.325014085f},
-std::array<float,2>{0.781331897f, 0.119264424f},
-std::array<float,2>{0.0682161227f, 0.570472121f},
-std::array<float,2>{0.937313139f, 0.888213158f},
-std::array<float,2>{0.224615172f, 0.284863561f},
-std::array<float,2>{0.7317788f, 0.00494024856f},
-std::array<float,2>{0.386022419f, 0.517007291f},
-std::array<float,2>{0.540409565f, 0.663054645f},
-std::array<float,2>{0.306092054f, 0.131104007f},
-std::array<float,2>{0.838200629f, 0.497627467f},
-std::array<float,2>{0.0289774295f, 0.805984557f},
-std::array<float,2>{0.759784043f, 0.613106072f},
-std::array<float,2>{0.0942388475f, 0.0684354156f},
-std::array<float,2>{0.617297888f, 0.355454862f},
-std::array<float,2>{0.356254071f, 0.981072366f},
-std::array<float,2>{0.679953754f, 0.855142772f},
-std::array<float,2>{0.49141416f, 0.408026427f},
-std::array<float,2>{0.975831747f, 0.242404878f},
-std::array<float,2>{0.137956306f, 0.726035774f},
-std::array<float,2>{0.989159405f, 0.822657704f},
-std::array<float,2>{0.151930884f, 0.402053624f},
-std::array<float,2>{0.671004534f, 0.209434211f},
-std::array<float,2>{0.477348745f, 0.70197022f},
-std::array<float,2>{0.597276807f, 0.591442287f},
-std::array<float,2>{0.374984384f, 0.105529115f},
-std::array<float,2>{0.775019586f, 0.332303762f},
-std::array<float,2>{0.10954494f, 0.954741359f},
-std::array<float,2>{0.819579422f, 0.626502216f},
-std::array<float,2>{0.00780795328f, 0.163861603f},
-std::array<float,2>{0.549421906f, 0.446955204f},
-std::array<float,2>{0.294507682f, 0.769821644f},
-std::array<float,2>{0.748323381f, 0.914575219f},
-std::array<float,2>{0.399893165f, 0.252764255f},
-std::array<float,2>{0.912797451f, 0.0496783257f},
-std::array<float,2>{0.242872536f, 0.537559986f},
-std::array<float,2>{0.806046009f, 0.992390096f},
-std::array<float,2>{0.0804302841f, 0.360757887f},
-std::array<float,2>{0.59331429f, 0.0908606872f},
-std::array<float,2>{0.320598751f, 0.599332392f},
-std::array<float,2>{0.655300856f, 0.747630954f},
-std::array<float,2>{0.451803088f, 0.225117832f},
-std::array<float,2>{0.964418411f, 0.425538749f},
-std::array<float,2>{0.179101467f, 0.871725559f},
-std::array<float,2>{0.901353836f, 0.509130776f},
-std::array<float,2>{0.193013296f, 0.0212716628f},
-std::array<float,2>{0.714263558f, 0.310636908f},
-std::array<float,2>{0.4359065f, 0.898502111f},
-std::array<float,2>{0.529509306f, 0.794439793f},
-std::array<float,2>{0.280080527f, 0.473050684f},
-std::array<float,2>{0.867964566f, 0.152091041f},
-std::array<float,2>{0.0328186043f, 0.677433908f},
-std::array<float,2>{0.767835915f, 0.861005306f},
-std::array<float,2>{0.12089067f, 0.435193002f},
-std::array<float,2>{0.605249524f, 0.231317475f},
-std::array<float,2>{0.362809092f, 0.736423433f},
-std::array<float,2>{0.661063194f, 0.602070212f},
-std::array<float,2>{0.476344526f, 0.0793549865f},
-std::array<float,2>{0.997556984f, 0.371971428f},
-std::array<float,2>{0.145740703f, 0.986532509f},
-std::array<float,2>{0.919122934f, 0.68310684f},
-std::array<float,2>{0.24096562f, 0.145624235f},
-std::array<float,2>{0.740081728f, 0.481650591f},
-std::array<float,2>{0.39178896f, 0.785824835f},
-std::array<float,2>{0.559560239f, 0.891124487f},
-std::array<float,2>{0.288951963f, 0.300345629f},
-std::array<float,2>{0.825242341f, 0.0243609846f},
-std::array<float,2>{0.00918133929f, 0.507635355f},
-std::array<float,2>{0.958015084f, 0.964406848f},
-std::array<float,2>{0.181283385f, 0.343337834f},
-std::array<float,2>{0.642058551f, 0.0966409221f},
-std::array<float,2>{0.442712098f, 0.580018818f},
-std::array<float,2>{0.584791303f, 0.692323625f},
-std::array<float,2>{0.314394742f, 0.214857876f},
-std::array<float,2>{0.799752712f, 0.392286032f},
-std::array<float,2>{0.092103377f, 0.818213701f},
-std::array<float,2>{0.866853297f, 0.545666277f},
-std::array<float,2>{0.0436934158f, 0.0579426475f},
-std::array<float,2>{0.520635486f, 0.265064746f},
-std::array<float,2>{0.272882879f, 0.906667829f},
-std::array<float,2>{0.710612476f, 0.775479436f},
-std::array<float,2>{0.424937099f, 0.44134438f},
-std::array<float,2>{0.895758092f, 0.16797024f},
-std::array<float,2>{0.198986128f, 0.635352015f},
-std::array<float,2>{0.887947977f, 0.799560845f},
-std::array<float,2>{0.218113422f, 0.485529333f},
-std::array<float,2>{0.693500578f, 0.138917595f},
-std::array<float,2>{0.415325284f, 0.66904676f},
-std::array<float,2>{0.513809681f, 0.523747504f},
-std::array<float,2>{0.26248455f, 0.0085916305f},
-std::array<float,2>{0.855493248f, 0.295180202f},
-std::array<float,2>{0.0592337437f, 0.877548158f},
-std::array<float,2>{0.793102741f, 0.729401112f},
-std::array<float,2>{0.0710528791f, 0.241156295f},
-std::array<float,2>{0.575315535f, 0.414340466f},
-std::array<float,2>{0.336549699f, 0.848227084f},
-std::array<float,2>{0.626494288f, 0.974469364f},
-std::array<float,2>{0.465021104f, 0.347872108f},
-std::array<float,2>{0.938160717f, 0.0743373707f},
-std::array<float,2>{0.16286622f, 0.623792171f},
-std::array<float,2>{0.83518362f, 0.930614769f},
-std::array<float,2>{0.0216961671f, 0.270200759f},
-std::array<float,2>{0.536560357f, 0.0347079523f},
-std::array<float,2>{0.299336761f, 0.557804644f},
-std::array<float,2>{0.725633264f, 0.644174516f},
-std::array<float,2>{0.381962985f, 0.177098677f},
-std::array<float,2>{0.922472894f, 0.454811037f},
-std::array<float,2>{0.23040238f, 0.764600337f},
-std::array<float,2>{0.977832496f, 0.563494086f},
-std::array<float,2>{0.130871758f, 0.116561547f},
-std::array<float,2>{0.673626482f, 0.318173319f},
-std::array<float,2>{0.498528421f, 0.947610676f},
-std::array<float,2>{0.612975001f, 0.828400373f},
-std::array<float,2>{0.347246438f, 0.386362523f},
-std::array<float,2>{0.754428685f, 0.187746301f},
-std::array<float,2>{0.107120156f, 0.716914892f},
-std::array<float,2>{0.860320032f, 0.857950807f},
-std::array<float,2>{0.0406857952f, 0.41169104f},
-std::array<float,2>{0.516281784f, 0.248698026f},
-std::array<float,2>{0.266921908f, 0.720924199f},
-std::array<float,2>{0.704421937f, 0.614235699f},
-std::array<float,2>{0.428317994f, 0.0633226931f},
-std::array<float,2>{0.890855253f, 0.356915772f},
-std::array<float,2>{0.202522755f, 0.978593349f},
-std::array<float,2>{0.953461707f, 0.658352077f},
-std::array<float,2>{0.184254691f, 0.128169447f},
-std::array<float,2>{0.647410452f, 0.495631605f},
-std::array<float,2>{0.438594192f, 0.809921265f},
-std::array<float,2>{0.580716789f, 0.886145592f},
-std::array<float,2>{0.318697184f, 0.288941175f},
-std::array<float,2>{0.802913308f, 0.000440100324f},
-std::array<float,2>{0.0878157392f, 0.522039831f},
-std::array<float,2>{0.916513383f, 0.944341302f},
-std::array<float,2>{0.237612039f, 0.324160188f},
-std::array<float,2>{0.734554589f, 0.123528063f},
-std::array<float,2>{0.395015925f, 0.575779259f},
-std::array<float,2>{0.557232857f, 0.708849907f},
-std::array<float,2>{0.281928957f, 0.197704583f},
-std::array<float,2>{0.822223425f, 0.379892886f},
-std::array<float,2>{0.0119488565f, 0.840033829f},
-std::array<float,2>{0.773406565f, 0.548998654f},
-std::array<float,2>{0.123042032f, 0.0392089635f},
-std::array<float,2>{0.606121838f, 0.273576528f},
-std::array<float,2>{0.364430368f, 0.923953891f},
-std::array<float,2>{0.656794012f, 0.754597127f},
-std::array<float,2>{0.472187161f, 0.465932369f},
-std::array<float,2>{0.995890975f, 0.18469663f},
-std::array<float,2>{0.142402098f, 0.654200613f},
-std::array<float,2>{0.982624531f, 0.790311873f},
-std::array<float,2>{0.126624182f, 0.469068676f},
-std::array<float,2>{0.678072929f, 0.155149162f},
-std::array<float,2>{0.493358701f, 0.674853027f},
-std::array<float,2>{0.615687788f, 0.511857212f},
-std::array<float,2>{0.348543555f, 0.0186907593f},
-std::array<float,2>{0.751092136f, 0.307088614f},
-std::array<float,2>{0.103985429f, 0.904695451f},
-std::array<float,2>{0.830196738f, 0.745295346f},
-std::array<float,2>{0.0159672238f, 0.221931905f},
-std::array<float,2>{0.531276464f, 0.427268207f},
-std::array<float,2>{0.30338487f, 0.870876014f},
-std::array<float,2>{0.721185625f, 0.997075737f},
-std::array<float,2>{0.375881702f, 0.363316774f},
-std::array<float,2>{0.928335607f, 0.0873252824f},
-std::array<float,2>{0.231183007f, 0.594541788f},
-std::array<float,2>{0.79064858f, 0.92147249f},
-std::array<float,2>{0.0773933008f, 0.256513685f},
-std::array<float,2>{0.573405504f, 0.0512190089f},
-std::array<float,2>{0.340225577f, 0.53313297f},
-std::array<float,2>{0.63183254f, 0.632148683f},
-std::array<float,2>{0.462493569f, 0.156322405f},
-std::array<float,2>{0.944602489f, 0.451043993f},
-std::array<float,2>{0.1576626f, 0.769333839f},
-std::array<float,2>{0.883830369f, 0.589671373f},
-std::array<float,2>{0.212445721f, 0.104600638f},
-std::array<float,2>{0.68946147f, 0.33195895f},
-std::array<float,2>{0.419803232f, 0.958219707f},
-std::array<float,2>{0.510229528f, 0.824554861f},
-std::array<float,2>{0.259596705f, 0.405914217f},
-std::array<float,2>{0.852953494f, 0.205694631f},
-std::array<float,2>{0.056748651f, 0.698143601f},
-std::array<float,2>{0.762802482f, 0.778507829f},
-std::array<float,2>{0.0979208946f, 0.442251921f},
-std::array<float,2>{0.623314798f, 0.167700469f},
-std::array<float,2>{0.352866709f, 0.637066901f},
-std::array<float,2>{0.686416984f, 0.541428804f},
-std::array<float,2>{0.487455696f, 0.0588303022f},
-std::array<float,2>{0.972043991f, 0.260153294f},
-std::array<float,2>{0.135039106f, 0.912672639f},
-std::array<float,2>{0.931521177f, 0.687756836f},
-std::array<float,2>{0.220907435f, 0.211096689f},
-std::array<float,2>{0.728632867f, 0.397693545f},
-std::array<float,2>{0.388739526f, 0.816086769f},
-std::array<float,2>{0.544542789f, 0.968547642f},
-std::array<float,2>{0.308826208f, 0.338651359f},
-std::array<float,2>{0.840267658f, 0.100049898f},
-std::array<float,2>{0.0256934743f, 0.582482576f},
-std::array<float,2>{0.950248659f, 0.89788717f},
-std::array<float,2>{0.167463988f, 0.302757978f},
-std::array<float,2>{0.6385324f, 0.0312217362f},
-std::array<float,2>{0.457004011f, 0.503654361f},
-std::array<float,2>{0.563996196f, 0.68375212f},
-std::array<float,2>{0.329273432f, 0.141438037f},
-std::array<float,2>{0.787836134f, 0.477923602f},
-std::array<float,2>{0.0657698363f, 0.784595788f},
-std::array<float,2>{0.847878635f, 0.607931137f},
-std::array<float,2>{0.0471102819f, 0.0841703564f},
-std::array<float,2>{0.501525044f, 0.369285822f},
-std::array<float,2>{0.256029367f, 0.988357604f},
-std::array<float,2>{0.698901176f, 0.864836812f},
-std::array<float,2>{0.406502694f, 0.43223691f},
-std::array<float,2>{0.881929517f, 0.227111205f},
-std::array<float,2>{0.210494325f, 0.739968002f},
-std::array<float,2>{0.904328406f, 0.833633542f},
-std::array<float,2>{0.187987164f, 0.38952294f},
-std::array<float,2>{0.715932906f, 0.194406748f},
-std::array<float,2>{0.43081817f, 0.714275062f},
-std::array<float,2>{0.523486316f, 0.568454802f},
-std::array<float,2>{0.276691049f, 0.111080989f},
-std::array<float,2>{0.874971271f, 0.316298872f},
-std::array<float,2>{0.0367377438f, 0.9505018f},
-std::array<float,2>{0.810363591f, 0.64472717f},
-std::array<float,2>{0.0831215158f, 0.175773934f},
-std::array<float,2>{0.589179039f, 0.458419621f},
-std::array<float,2>{0.325622171f, 0.759826362f},
-std::array<float,2>{0.649270415f, 0.935387135f},
-std::array<float,2>{0.445327073f, 0.266603857f},
-std::array<float,2>{0.96584928f, 0.0389206521f},
-std::array<float,2>{0.175468892f, 0.560828447f},
-std::array<float,2>{0.814522564f, 0.969550133f},
-std::array<float,2>{0.00222867401f, 0.344656676f},
-std::array<float,2>{0.552309155f, 0.0710014477f},
-std::array<float,2>{0.291194022f, 0.61793375f},
-std::array<float,2>{0.743124366f, 0.732483923f},
-std::array<float,2>{0.40296185f, 0.237945333f},
-std::array<float,2>{0.906622887f, 0.420878083f},
-std::array<float,2>{0.249776959f, 0.84441489f},
-std::array<float,2>{0.985414267f, 0.52860564f},
-std::array<float,2>{0.154716671f, 0.0154322237f},
-std::array<float,2>{0.666897953f, 0.292966515f},
-std::array<float,2>{0.481572181f, 0.882746458f},
-std::array<float,2>{0.597812772f, 0.803784132f},
-std::array<float,2>{0.36733222f, 0.488991618f},
-std::array<float,2>{0.779375374f, 0.133319199f},
-std::array<float,2>{0.115885057f, 0.667161644f},
-std::array<float,2>{0.837711751f, 0.807348132f},
-std::array<float,2>{0.0312159769f, 0.498071134f},
-std::array<float,2>{0.542357564f, 0.129725516f},
-std::array<float,2>{0.307922959f, 0.660384417f},
-std::array<float,2>{0.732523322f, 0.517669857f},
-std::array<float,2>{0.383485377f, 0.0068098167f},
-std::array<float,2>{0.935404778f, 0.282491773f},
-std::array<float,2>{0.222810283f, 0.889926195f},
-std::array<float,2>{0.973310471f, 0.722658038f},
-std::array<float,2>{0.1393971f, 0.244183615f},
-std::array<float,2>{0.682921588f, 0.408490837f},
-std::array<float,2>{0.489995062f, 0.852363527f},
-std::array<float,2>{0.61929667f, 0.982770026f},
-std::array<float,2>{0.359164596f, 0.353187978f},
-std::array<float,2>{0.759632885f, 0.0669583604f},
-std::array<float,2>{0.0965085626f, 0.610503674f},
-std::array<float,2>{0.87614888f, 0.928278804f},
-std::array<float,2>{0.203280047f, 0.277927518f},
-std::array<float,2>{0.700351655f, 0.0440817177f},
-std::array<float,2>{0.412496537f, 0.552608788f},
-std::array<float,2>{0.505764961f, 0.650344014f},
-std::array<float,2>{0.250757694f, 0.180042371f},
-std::array<float,2>{0.846550703f, 0.462841749f},
-std::array<float,2>{0.0535012707f, 0.752995908f},
-std::array<float,2>{0.783498287f, 0.572488606f},
-std::array<float,2>{0.0693317652f, 0.117416397f},
-std::array<float,2>{0.566822946f, 0.326325327f},
-std::array<float,2>{0.332712531f, 0.938872278f},
-std::array<float,2>{0.633205831f, 0.837986112f},
-std::array<float,2>{0.458918065f, 0.378390342f},
-std::array<float,2>{0.945840418f, 0.200463325f},
-std::array<float,2>{0.170613721f, 0.705178499f},
-std::array<float,2>{0.962399781f, 0.873707175f},
-std::array<float,2>{0.177568242f, 0.422506481f},
-std::array<float,2>{0.652734458f, 0.222936481f},
-std::array<float,2>{0.449799925f, 0.749958217f},
-std::array<float,2>{0.590121567f, 0.600718081f},
-std::array<float,2>{0.323617816f, 0.0932392329f},
-std::array<float,2>{0.807861567f, 0.362084657f},
-std::array<float,2>{0.0796391219f, 0.994613826f},
-std::array<float,2>{0.870694101f, 0.678027153f},
-std::array<float,2>{0.0332892016f, 0.148447514f},
-std::array<float,2>{0.527911842f, 0.475997776f},
-std::array<float,2>{0.278240591f, 0.79650861f},
-std::array<float,2>{0.712758422f, 0.90172708f},
-std::array<float,2>{0.434885561f, 0.309267044f},
-std::array<float,2>{0.899246514f, 0.0215392206f},
-std::array<float,2>{0.195200041f, 0.510485649f},
-std::array<float,2>{0.776123524f, 0.956607878f},
-std::array<float,2>{0.112168059f, 0.33485654f},
-std::array<float,2>{0.594610989f, 0.108983472f},
-std::array<float,2>{0.372283697f, 0.592475653f},
-std::array<float,2>{0.668443441f, 0.701091051f},
-std::array<float,2>{0.480202138f, 0.207688674f},
-std::array<float,2>{0.9914307f, 0.398527354f},
-std::array<float,2>{0.149737298f, 0.822135925f},
-std::array<float,2>{0.911588013f, 0.536360204f},
-std::array<float,2>{0.245922863f, 0.0469447188f},
-std::array<float,2>{0.747252107f, 0.251858681f},
-std::array<float,2>{0.400932163f, 0.917778969f},
-std::array<float,2>{0.547873318f, 0.771736324f},
-std::array<float,2>{0.295632422f, 0.447268397f},
-std::array<float,2>{0.817586303f, 0.161520347f},
-std::array<float,2>{0.00478654169f, 0.627275944f},
-std::array<float,2>{0.798334539f, 0.820032775f},
-std::array<float,2>{0.091280818f, 0.393493325f},
-std::array<float,2>{0.583100021f, 0.217841327f},
-std::array<float,2>{0.314840317f, 0.69514966f},
-std::array<float,2>{0.644080698f, 0.580385625f},
-std::array<float,2>{0.444538981f, 0.0950289816f},
-std::array<float,2>{0.960821331f, 0.341495067f},
-std::array<float,2>{0.182532862f, 0.962048888f},
-std::array<float,2>{0.897698164f, 0.63473177f},
-std::array<float,2>{0.19592309f, 0.170388952f},
-std::array<float,2>{0.707244933f, 0.438919932f},
-std::array<float,2>{0.42337957f, 0.773673534f},
-std::array<float,2>{0.523156643f, 0.909402192f},
-std::array<float,2>{0.269664347f, 0.261853814f},
-std::array<float,2>{0.863343954f, 0.0547695942f},
-std::array<float,2>{0.0466210619f, 0.543729722f},
-std::array<float,2>{0.999097109f, 0.985409439f},
-std::array<float,2>{0.146662876f, 0.374071747f},
-std::array<float,2>{0.663856685f, 0.0812848061f},
-std::array<float,2>{0.474319845f, 0.605343163f},
-std::array<float,2>{0.603479266f, 0.734898329f},
-std::array<float,2>{0.359614611f, 0.234183803f},
-std::array<float,2>{0.767306805f, 0.435977668f},
-std::array<float,2>{0.117188267f, 0.862371147f},
-std::array<float,2>{0.827420115f, 0.504559278f},
-std::array<float,2>{0.0104008038f, 0.0264071245f},
-std::array<float,2>{0.561345637f, 0.296939909f},
-std::array<float,2>{0.286162376f, 0.894234776f},
-std::array<float,2>{0.740484297f, 0.788213015f},
-std::array<float,2>{0.394326687f, 0.483121663f},
-std::array<float,2>{0.921095192f, 0.148236752f},
-std::array<float,2>{0.239393234f, 0.679926693f},
-std::array<float,2>{0.924283981f, 0.762439609f},
-std::array<float,2>{0.226915359f, 0.455972582f},
-std::array<float,2>{0.722699583f, 0.179244295f},
-std::array<float,2>{0.37899217f, 0.641792059f},
-std::array<float,2>{0.538211584f, 0.555686653f},
-std::array<float,2>{0.298771948f, 0.0327749252f},
-std::array<float,2>{0.83273536f, 0.271800548f},
-std::array<float,2>{0.019798765f, 0.933578372f},
-std::array<float,2>{0.757576525f, 0.715530276f},
-std::array<float,2>{0.107719913f, 0.190011904f},
-std::array<float,2>{0.611150146f, 0.383827478f},
-std::array<float,2>{0.344664305f, 0.831475079f},
-std::array<float,2>{0.675192595f, 0.946264625f},
-std::array<float,2>{0.496335983f, 0.320219308f},
-std::array<float,2>{0.97962743f, 0.114177711f},
-std::array<float,2>{0.130386889f, 0.565535843f},
-std::array<float,2>{0.859121084f, 0.876015067f},
-std::array<float,2>{0.0613548234f, 0.293046892f},
-std::array<float,2>{0.512475669f, 0.0103187608f},
-std::array<float,2>{0.264094949f, 0.525595665f},
-std::array<float,2>{0.691789746f, 0.670417309f},
-std::array<float,2>{0.416983277f, 0.138523802f},
-std::array<float,2>{0.890565991f, 0.487067699f},
-std::array<float,2>{0.216227457f, 0.797869146f},
-std::array<float,2>{0.940179527f, 0.622512639f},
-std::array<float,2>{0.160637602f, 0.0765800849f},
-std::array<float,2>{0.627558053f, 0.349736184f},
-std::array<float,2>{0.466847658f, 0.975491941f},
-std::array<float,2>{0.576210976f, 0.850053191f},
-std::array<float,2>{0.337924987f, 0.417577028f},
-std::array<float,2>{0.795069993f, 0.238462687f},
-std::array<float,2>{0.0738520473f, 0.727109134f},
-std::array<float,2>{0.852046311f, 0.826954305f},
-std::array<float,2>{0.0579536408f, 0.403591126f},
-std::array<float,2>{0.510850132f, 0.204991907f},
-std::array<float,2>{0.258780211f, 0.696929097f},
-std::array<float,2>{0.690633893f, 0.58690393f},
-std::array<float,2>{0.418735951f, 0.103501141f},
-std::array<float,2>{0.883044302f, 0.328415841f},
-std::array<float,2>{0.211134478f, 0.960727274f},
-std::array<float,2>{0.943859518f, 0.630459368f},
-std::array<float,2>{0.156487703f, 0.159822956f},
-std::array<float,2>{0.63252902f, 0.452406824f},
-std::array<float,2>{0.461271048f, 0.765896499f},
-std::array<float,2>{0.572373569f, 0.918511569f},
-std::array<float,2>{0.341460139f, 0.254098684f},
-std::array<float,2>{0.789401352f, 0.0546437725f},
-std::array<float,2>{0.0769926533f, 0.534322381f},
-std::array<float,2>{0.92932713f, 0.999093294f},
-std::array<float,2>{0.231774092f, 0.365370095f},
-std::array<float,2>{0.72250998f, 0.0892058536f},
-std::array<float,2>{0.376620293f, 0.596778452f},
-std::array<float,2>{0.533092856f, 0.743679941f},
-std::array<float,2>{0.303727537f, 0.219842121f},
-std::array<float,2>{0.831773162f, 0.429538757f},
-std::array<float,2>{0.0170484073f, 0.868372083f},
-std::array<float,2>{0.750974834f, 0.514868021f},
-std::array<float,2>{0.104796149f, 0.0171113089f},
-std::array<float,2>{0.616638482f, 0.305709928f},
-std::array<float,2>{0.349188805f, 0.903212428f},
-std::array<float,2>{0.679455936f, 0.792109966f},
-std::array<float,2>{0.492416143f, 0.4719024f},
-std::array<float,2>{0.984322369f, 0.15236114f},
-std::array<float,2>{0.12565355f, 0.672161639f},
-std::array<float,2>{0.994441032f, 0.757275879f},
-std::array<float,2>{0.141080394f, 0.467834085f},
-std::array<float,2>{0.657408178f, 0.186565354f},
-std::array<float,2>{0.471187383f, 0.655833542f},
-std::array<float,2>{0.606962204f, 0.547712743f},
-std::array<float,2>{0.363772541f, 0.0411284752f},
-std::array<float,2>{0.772264123f, 0.277090639f},
-std::array<float,2>{0.121361732f, 0.923216403f},
-std::array<float,2>{0.820756257f, 0.710299373f},
-std::array<float,2>{0.0132972626f, 0.195471093f},
-std::array<float,2>{0.558168948f, 0.382063925f},
-std::array<float,2>{0.282404274f, 0.842863321f},
-std::array<float,2>{0.735664546f, 0.943139076f},
-std::array<float,2>{0.396320015f, 0.321944594f},
-std::array<float,2>{0.917049646f, 0.12192855f},
-std::array<float,2>{0.236538962f, 0.577534616f},
-std::array<float,2>{0.804117382f, 0.883421242f},
-std::array<float,2>{0.0864434838f, 0.286556661f},
-std::array<float,2>{0.5815503f, 0.00218682643f},
-std::array<float,2>{0.319711596f, 0.521426976f},
-std::array<float,2>{0.647741318f, 0.656939447f},
-std::array<float,2>{0.438435286f, 0.125175998f},
-std::array<float,2>{0.954208195f, 0.492875874f},
-std::array<float,2>{0.185102016f, 0.810954273f},
-std::array<float,2>{0.891884327f, 0.617124498f},
-std::array<float,2>{0.201500267f, 0.0655396134f},
-std::array<float,2>{0.703887165f, 0.357638687f},
-std::array<float,2>{0.429013938f, 0.978346229f},
-std::array<float,2>{0.516988099f, 0.856174827f},
-std::array<float,2>{0.26658535f, 0.414032578f},
-std::array<float,2>{0.861226737f, 0.247968331f},
-std::array<float,2>{0.0391920544f, 0.720105708f},
-std::array<float,2>{0.780588984f, 0.801480412f},
-std::array<float,2>{0.117029674f, 0.491403073f},
-std::array<float,2>{0.59910804f, 0.136436343f},
-std::array<float,2>{0.36854592f, 0.665611923f},
-std::array<float,2>{0.667902589f, 0.530732393f},
-std::array<float,2>{0.481062412f, 0.0132489931f},
-std::array<float,2>{0.985268295f, 0.289801151f},
-std::array<float,2>{0.155796126f, 0.880038917f},
-std::array<float,2>{0.907881558f, 0.73141849f},
-std::array<float,2>{0.248694032f, 0.236036733f},
-std::array<float,2>{0.743806601f, 0.41984731f},
-std::array<float,2>{0.404001832f, 0.846925974f},
-std::array<float,2>{0.550914884f, 0.972279549f},
-std::array<float,2>{0.292729646f, 0.347200394f},
-std::array<float,2>{0.816260099f, 0.0737504289f},
-std::array<float,2>{0.0035088216f, 0.619158506f},
-std::array<float,2>{0.965090215f, 0.935607374f},
-std::array<float,2>{0.174376696f, 0.268030345f},
-std::array<float,2>{0.650259137f, 0.0368120149f},
-std::array<float,2>{0.446774691f, 0.559307575f},
-std::array<float,2>{0.588029981f, 0.646629333f},
-std::array<float,2>{0.324838102f, 0.172254249f},
-std::array<float,2>{0.809262574f, 0.460173696f},
-std::array<float,2>{0.0829296038f, 0.757854521f},
-std::array<float,2>{0.873762548f, 0.566875517f},
-std::array<float,2>{0.0356874727f, 0.111408919f},
-std::array<float,2>{0.525304675f, 0.312763661f},
-std::array<float,2>{0.275765002f, 0.951206267f},
-std::array<float,2>{0.715405047f, 0.835914731f},
-std::array<float,2>{0.42971763f, 0.38843888f},
-std::array<float,2>{0.905861259f, 0.19143261f},
-std::array<float,2>{0.188893005f, 0.711915493f},
-std::array<float,2>{0.881771624f, 0.866563499f},
-std::array<float,2>{0.20956108f, 0.430043578f},
-std::array<float,2>{0.697454214f, 0.230282515f},
-std::array<float,2>{0.407995075f, 0.74158901f},
-std::array<float,2>{0.500324547f, 0.605734766f},
-std::array<float,2>{0.257063597f, 0.0831076205f},
-std::array<float,2>{0.8490327f, 0.367404938f},
-std::array<float,2>{0.0481971018f, 0.990280211f},
-std::array<float,2>{0.78874898f, 0.687174678f},
-std::array<float,2>{0.0653779283f, 0.143547133f},
-std::array<float,2>{0.562915981f, 0.478779852f},
-std::array<float,2>{0.328759283f, 0.78308928f},
-std::array<float,2>{0.637259543f, 0.895089805f},
-std::array<float,2>{0.455335498f, 0.302461982f},
-std::array<float,2>{0.950092435f, 0.0273934416f},
-std::array<float,2>{0.166439071f, 0.501478314f},
-std::array<float,2>{0.840865374f, 0.965868711f},
-std::array<float,2>{0.0269177053f, 0.336757869f},
-std::array<float,2>{0.543303072f, 0.0983634964f},
-std::array<float,2>{0.310306579f, 0.584083796f},
-std::array<float,2>{0.729699492f, 0.690172434f},
-std::array<float,2>{0.389948696f, 0.213426366f},
-std::array<float,2>{0.929690599f, 0.395847142f},
-std::array<float,2>{0.222505867f, 0.813065171f},
-std::array<float,2>{0.971018791f, 0.539206803f},
-std::array<float,2>{0.136592448f, 0.0623827502f},
-std::array<float,2>{0.687118053f, 0.258430988f},
-std::array<float,2>{0.487038463f, 0.911282599f},
-std::array<float,2>{0.624546289f, 0.78090471f},
-std::array<float,2>{0.352130949f, 0.444963932f},
-std::array<float,2>{0.76181519f, 0.164766297f},
-std::array<float,2>{0.0986846611f, 0.639716506f},
-std::array<float,2>{0.817170203f, 0.770538986f},
-std::array<float,2>{0.00493470533f, 0.445322514f},
-std::array<float,2>{0.547458112f, 0.162712008f},
-std::array<float,2>{0.296694547f, 0.625636101f},
-std::array<float,2>{0.746492326f, 0.538960457f},
-std::array<float,2>{0.401990443f, 0.0500178114f},
-std::array<float,2>{0.910680294f, 0.253784567f},
-std::array<float,2>{0.244442046f, 0.91538465f},
-std::array<float,2>{0.991062522f, 0.702398181f},
-std::array<float,2>{0.148974881f, 0.210267246f},
-std::array<float,2>{0.669554293f, 0.400862575f},
-std::array<float,2>{0.47858268f, 0.823879182f},
-std::array<float,2>{0.594760597f, 0.953749418f},
-std::array<float,2>{0.371958077f, 0.333268762f},
-std::array<float,2>{0.776722908f, 0.106907219f},
-std::array<float,2>{0.112922415f, 0.590380073f},
-std::array<float,2>{0.899435997f, 0.900294304f},
-std::array<float,2>{0.194154844f, 0.311850369f},
-std::array<float,2>{0.711368978f, 0.0196997207f},
-std::array<float,2>{0.43419984f, 0.508026123f},
-std::array<float,2>{0.528678894f, 0.675854087f},
-std::array<float,2>{0.278514713f, 0.151016176f},
-std::array<float,2>{0.869905472f, 0.474208474f},
-std::array<float,2>{0.0348143689f, 0.793549418f},
-std::array<float,2>{0.806748271f, 0.598628819f},
-std::array<float,2>{0.078377381f, 0.0899599865f},
-std::array<float,2>{0.591766655f, 0.359466821f},
-std::array<float,2>{0.323224783f, 0.993379116f},
-std::array<float,2>{0.653521061f, 0.872381508f},
-std::array<float,2>{0.450349957f, 0.424016356f},
-std::array<float,2>{0.961804569f, 0.22630538f},
-std::array<float,2>{0.176275626f, 0.746238768f},
-std::array<float,2>{0.946357429f, 0.835950136f},
-std::array<float,2>{0.171577692f, 0.37653479f},
-std::array<float,2>{0.634271979f, 0.202610284f},
-std::array<float,2>{0.457640201f, 0.704339325f},
-std::array<float,2>{0.567944288f, 0.572079778f},
-std::array<float,2>{0.333968461f, 0.121023938f},
-std::array<float,2>{0.784209192f, 0.325881392f},
-std::array<float,2>{0.0701644495f, 0.941093802f},
-std::array<float,2>{0.847255647f, 0.651548564f},
-std::array<float,2>{0.0546440817f, 0.183538869f},
-std::array<float,2>{0.504867077f, 0.463284791f},
-std::array<float,2>{0.251593173f, 0.750261843f},
-std::array<float,2>{0.699665487f, 0.926152647f},
-std::array<float,2>{0.413600713f, 0.279743582f},
-std::array<float,2>{0.87590003f, 0.046866186f},
-std::array<float,2>{0.204502508f, 0.554043949f},
-std::array<float,2>{0.757934928f, 0.981868625f},
-std::array<float,2>{0.0973157361f, 0.353557527f},
-std::array<float,2>{0.62055707f, 0.06999024f},
-std::array<float,2>{0.358035475f, 0.611741841f},
-std::array<float,2>{0.682230294f, 0.72476697f},
-std::array<float,2>{0.488563091f, 0.243391022f},
-std::array<float,2>{0.973900855f, 0.406578213f},
-std::array<float,2>{0.140224934f, 0.854229331f},
-std::array<float,2>{0.934131026f, 0.51659441f},
-std::array<float,2>{0.223941609f, 0.00481325621f},
-std::array<float,2>{0.73417902f, 0.283534348f},
-std::array<float,2>{0.384247243f, 0.887238026f},
-std::array<float,2>{0.541130722f, 0.805516005f},
-std::array<float,2>{0.30730623f, 0.496138602f},
-std::array<float,2>{0.836229742f, 0.13215147f},
-std::array<float,2>{0.0297703575f, 0.663636088f},
-std::array<float,2>{0.796373725f, 0.849449456f},
-std::array<float,2>{0.072973296f, 0.4157812f},
-std::array<float,2>{0.577381313f, 0.241855189f},
-std::array<float,2>{0.339384824f, 0.730339408f},
-std::array<float,2>{0.628304899f, 0.624706328f},
-std::array<float,2>{0.468415588f, 0.0758039504f},
-std::array<float,2>{0.940798163f, 0.349103659f},
-std::array<float,2>{0.161797136f, 0.972924292f},
-std::array<float,2>{0.889366329f, 0.668578625f},
-std::array<float,2>{0.215040326f, 0.140226498f},
-std::array<float,2>{0.693033397f, 0.48468709f},
-std::array<float,2>{0.417811543f, 0.800174832f},
-std::array<float,2>{0.51306051f, 0.878754854f},
-std::array<float,2>{0.264763415f, 0.296397656f},
-std::array<float,2>{0.857925296f, 0.00913775899f},
-std::array<float,2>{0.0622874275f, 0.524639189f},
-std::array<float,2>{0.978777349f, 0.949097574f},
-std::array<float,2>{0.12908721f, 0.317305177f},
-std::array<float,2>{0.67443037f, 0.11567238f},
-std::array<float,2>{0.497738779f, 0.562810302f},
-std::array<float,2>{0.610338092f, 0.718282104f},
-std::array<float,2>{0.345395327f, 0.189202011f},
-std::array<float,2>{0.756657124f, 0.385552347f},
-std::array<float,2>{0.109125435f, 0.829238355f},
-std::array<float,2>{0.833858967f, 0.557433784f},
-std::array<float,2>{0.0209930092f, 0.0340294018f},
-std::array<float,2>{0.537347674f, 0.271409452f},
-std::array<float,2>{0.296889395f, 0.931401074f},
-std::array<float,2>{0.724294364f, 0.764729977f},
-std::array<float,2>{0.380584508f, 0.454016566f},
-std::array<float,2>{0.925043643f, 0.17606084f},
-std::array<float,2>{0.228470936f, 0.642816305f},
-std::array<float,2>{0.920166671f, 0.786337078f},
-std::array<float,2>{0.238886163f, 0.481048822f},
-std::array<float,2>{0.741284549f, 0.144548744f},
-std::array<float,2>{0.39279595f, 0.6817922f},
-std::array<float,2>{0.561555624f, 0.505913258f},
-std::array<float,2>{0.285260588f, 0.0250613838f},
-std::array<float,2>{0.827117801f, 0.298917592f},
-std::array<float,2>{0.0114266099f, 0.891942203f},
-std::array<float,2>{0.76619339f, 0.738054395f},
-std::array<float,2>{0.118342355f, 0.231589347f},
-std::array<float,2>{0.601871073f, 0.434480578f},
-std::array<float,2>{0.361213714f, 0.859837472f},
-std::array<float,2>{0.662194431f, 0.987999022f},
-std::array<float,2>{0.473350465f, 0.372379303f},
-std::array<float,2>{0.998650074f, 0.0784033239f},
-std::array<float,2>{0.148152217f, 0.602930188f},
-std::array<float,2>{0.864714742f, 0.907330692f},
-std::array<float,2>{0.0451333486f, 0.263768524f},
-std::array<float,2>{0.521600187f, 0.05688636f},
-std::array<float,2>{0.271130145f, 0.546419978f},
-std::array<float,2>{0.708225727f, 0.636205614f},
-std::array<float,2>{0.422044814f, 0.169282243f},
-std::array<float,2>{0.896494448f, 0.440029651f},
-std::array<float,2>{0.196303144f, 0.777060866f},
-std::array<float,2>{0.958998501f, 0.579020023f},
-std::array<float,2>{0.183376864f, 0.097242713f},
-std::array<float,2>{0.64305687f, 0.342465132f},
-std::array<float,2>{0.4436782f, 0.963396966f},
-std::array<float,2>{0.582086444f, 0.816494823f},
-std::array<float,2>{0.315593868f, 0.390827805f},
-std::array<float,2>{0.79769367f, 0.216340899f},
-std::array<float,2>{0.0907005742f, 0.693165302f},
-std::array<float,2>{0.829863608f, 0.869881928f},
-std::array<float,2>{0.0186706726f, 0.426222354f},
-std::array<float,2>{0.534812152f, 0.221117288f},
-std::array<float,2>{0.301491767f, 0.744847059f},
-std::array<float,2>{0.719906926f, 0.595506728f},
-std::array<float,2>{0.37777096f, 0.0859745666f},
-std::array<float,2>{0.927198768f, 0.365043342f},
-std::array<float,2>{0.232691437f, 0.996636093f},
-std::array<float,2>{0.981463671f, 0.67406559f},
-std::array<float,2>{0.127438456f, 0.15618138f},
-std::array<float,2>{0.677021384f, 0.470597595f},
-std::array<float,2>{0.494413674f, 0.78929019f},
-std::array<float,2>{0.615166783f, 0.905425191f},
-std::array<float,2>{0.350356072f, 0.308314443f},
-std::array<float,2>{0.753358781f, 0.0179664344f},
-std::array<float,2>{0.102803424f, 0.513298094f},
-std::array<float,2>{0.885428488f, 0.957242131f},
-std::array<float,2>{0.213406712f, 0.330999166f},
-std::array<float,2>{0.688517809f, 0.103744395f},
-std::array<float,2>{0.421625823f, 0.588365138f},
-std::array<float,2>{0.50802058f, 0.698627174f},
-std::array<float,2>{0.260935813f, 0.206796497f},
-std::array<float,2>{0.854583561f, 0.404711425f},
-std::array<float,2>{0.055146154f, 0.825369477f},
-std::array<float,2>{0.791419804f, 0.531606555f},
-std::array<float,2>{0.0756394416f, 0.0518080927f},
-std::array<float,2>{0.570389688f, 0.257028192f},
-std::array<float,2>{0.343254894f, 0.920676708f},
-std::array<float,2>{0.630177498f, 0.76807487f},
-std::array<float,2>{0.464832008f, 0.449906796f},
-std::array<float,2>{0.943090379f, 0.157602131f},
-std::array<float,2>{0.158509091f, 0.631437302f},
-std::array<float,2>{0.955963373f, 0.809468448f},
-std::array<float,2>{0.186441764f, 0.494196385f},
-std::array<float,2>{0.64590472f, 0.127777278f},
-std::array<float,2>{0.440882206f, 0.659648061f},
-std::array<float,2>{0.579872727f, 0.522732794f},
-std::array<float,2>{0.317406356f, 0.00103966659f},
-std::array<float,2>{0.801538408f, 0.287560374f},
-std::array<float,2>{0.0882840529f, 0.884998739f},
-std::array<float,2>{0.862195611f, 0.722454011f},
-std::array<float,2>{0.0423554555f, 0.249188408f},
-std::array<float,2>{0.519397318f, 0.411031961f},
-std::array<float,2>{0.269245058f, 0.859354794f},
-std::array<float,2>{0.706124425f, 0.980292737f},
-std::array<float,2>{0.427554846f, 0.356082588f},
-std::array<float,2>{0.893950045f, 0.0637168214f},
-std::array<float,2>{0.199586242f, 0.615065515f},
-std::array<float,2>{0.771316826f, 0.925761402f},
-std::array<float,2>{0.12377283f, 0.275142103f},
-std::array<float,2>{0.607943118f, 0.0400405861f},
-std::array<float,2>{0.366794258f, 0.550635815f},
-std::array<float,2>{0.660086453f, 0.652773023f},
-std::array<float,2>{0.469884545f, 0.184219152f},
-std::array<float,2>{0.992864072f, 0.465438902f},
-std::array<float,2>{0.143670812f, 0.755457461f},
-std::array<float,2>{0.915384948f, 0.574963093f},
-std::array<float,2>{0.2353746f, 0.124902315f},
-std::array<float,2>{0.737451196f, 0.322832912f},
-std::array<float,2>{0.397168636f, 0.944239497f},
-std::array<float,2>{0.555502415f, 0.841241181f},
-std::array<float,2>{0.284657091f, 0.379134744f},
-std::array<float,2>{0.823972762f, 0.198594436f},
-std::array<float,2>{0.015025856f, 0.707390189f},
-std::array<float,2>{0.81123203f, 0.761294484f},
-std::array<float,2>{0.0844770446f, 0.457289189f},
-std::array<float,2>{0.587804675f, 0.174568206f},
-std::array<float,2>{0.327286124f, 0.645725787f},
-std::array<float,2>{0.651230097f, 0.562341392f},
-std::array<float,2>{0.448785245f, 0.0376621187f},
-std::array<float,2>{0.96816963f, 0.266510099f},
-std::array<float,2>{0.173204705f, 0.9338606f},
-std::array<float,2>{0.903179169f, 0.713183105f},
-std::array<float,2>{0.19041869f, 0.193447605f},
-std::array<float,2>{0.718025267f, 0.390191942f},
-std::array<float,2>{0.431844383f, 0.832465529f},
-std::array<float,2>{0.526622832f, 0.949938655f},
-std::array<float,2>{0.274860501f, 0.315266758f},
-std::array<float,2>{0.871117234f, 0.109597258f},
-std::array<float,2>{0.0374443755f, 0.569616556f},
-std::array<float,2>{0.986963451f, 0.881311119f},
-std::array<float,2>{0.153987572f, 0.2914069f},
-std::array<float,2>{0.664425492f, 0.0140860593f},
-std::array<float,2>{0.483700931f, 0.528192222f},
-std::array<float,2>{0.600006521f, 0.66663307f},
-std::array<float,2>{0.369422972f, 0.1339719f},
-std::array<float,2>{0.777452946f, 0.490228146f},
-std::array<float,2>{0.115197495f, 0.803279221f},
-std::array<float,2>{0.814314604f, 0.618765712f},
-std::array<float,2>{0.00174398709f, 0.0719843879f},
-std::array<float,2>{0.554556072f, 0.345362961f},
-std::array<float,2>{0.289133221f, 0.969737709f},
-std::array<float,2>{0.74442327f, 0.845306635f},
-std::array<float,2>{0.404971987f, 0.421629518f},
-std::array<float,2>{0.908497393f, 0.236845434f},
-std::array<float,2>{0.246674657f, 0.734323263f},
-std::array<float,2>{0.933020532f, 0.8153283f},
-std::array<float,2>{0.219041049f, 0.397322178f},
-std::array<float,2>{0.726957798f, 0.212627083f},
-std::array<float,2>{0.387635171f, 0.68916446f},
-std::array<float,2>{0.546470761f, 0.583805501f},
-std::array<float,2>{0.312145114f, 0.101347819f},
-std::array<float,2>{0.843149424f, 0.339416146f},
-std::array<float,2>{0.0245283954f, 0.967224717f},
-std::array<float,2>{0.765500724f, 0.637857497f},
-std::array<float,2>{0.0997569188f, 0.166364774f},
-std::array<float,2>{0.622945905f, 0.443072647f},
-std::array<float,2>{0.35375616f, 0.777580857f},
-std::array<float,2>{0.685348153f, 0.913168609f},
-std::array<float,2>{0.484690011f, 0.2608262f},
-std::array<float,2>{0.969068766f, 0.0597153939f},
-std::array<float,2>{0.133841857f, 0.542515635f},
-std::array<float,2>{0.849618196f, 0.98927927f},
-std::array<float,2>{0.0503512062f, 0.370863885f},
-std::array<float,2>{0.503417075f, 0.0854788646f},
-std::array<float,2>{0.253961176f, 0.608965337f},
-std::array<float,2>{0.69603771f, 0.738982141f},
-std::array<float,2>{0.410150498f, 0.228167713f},
-std::array<float,2>{0.8804335f, 0.432938933f},
-std::array<float,2>{0.208258733f, 0.863908768f},
-std::array<float,2>{0.952601373f, 0.502451062f},
-std::array<float,2>{0.164990649f, 0.0296407826f},
-std::array<float,2>{0.639023304f, 0.30400005f},
-std::array<float,2>{0.453839153f, 0.896617413f},
-std::array<float,2>{0.564807296f, 0.783771753f},
-std::array<float,2>{0.330960095f, 0.477297068f},
-std::array<float,2>{0.785599411f, 0.142434567f},
-std::array<float,2>{0.0643838421f, 0.68541342f},
-std::array<float,2>{0.868216455f, 0.795495927f},
-std::array<float,2>{0.0313365944f, 0.4748936f},
-std::array<float,2>{0.531245351f, 0.149759114f},
-std::array<float,2>{0.280913264f, 0.679617226f},
-std::array<float,2>{0.713859141f, 0.511456668f},
-std::array<float,2>{0.437066585f, 0.0225586258f},
-std::array<float,2>{0.901877046f, 0.309933245f},
-std::array<float,2>{0.191489369f, 0.900404572f},
-std::array<float,2>{0.963544846f, 0.748228133f},
-std::array<float,2>{0.177973717f, 0.223911747f},
-std::array<float,2>{0.654521465f, 0.422951847f},
-std::array<float,2>{0.452964038f, 0.874892771f},
-std::array<float,2>{0.592333078f, 0.995313466f},
-std::array<float,2>{0.322209895f, 0.362702101f},
-std::array<float,2>{0.805018365f, 0.0918427929f},
-std::array<float,2>{0.0815418437f, 0.599841416f},
-std::array<float,2>{0.913911223f, 0.91697818f},
-std::array<float,2>{0.243728757f, 0.250088781f},
-std::array<float,2>{0.74966222f, 0.0485455431f},
-std::array<float,2>{0.399390221f, 0.53595221f},
-std::array<float,2>{0.550752044f, 0.628063142f},
-std::array<float,2>{0.293715477f, 0.160935402f},
-std::array<float,2>{0.818570614f, 0.448980361f},
-std::array<float,2>{0.00643665623f, 0.772787035f},
-std::array<float,2>{0.77423805f, 0.593526959f},
-std::array<float,2>{0.110840715f, 0.107801996f},
-std::array<float,2>{0.596257925f, 0.335803092f},
-std::array<float,2>{0.37375465f, 0.955495834f},
-std::array<float,2>{0.67073226f, 0.820541322f},
-std::array<float,2>{0.477576762f, 0.399862677f},
-std::array<float,2>{0.990116119f, 0.208464012f},
-std::array<float,2>{0.150584593f, 0.699761987f},
-std::array<float,2>{0.97466588f, 0.852998912f},
-std::array<float,2>{0.136859104f, 0.409983248f},
-std::array<float,2>{0.680783689f, 0.245555878f},
-std::array<float,2>{0.490921199f, 0.723896205f},
-std::array<float,2>{0.618644357f, 0.610215187f},
-std::array<float,2>{0.356871247f, 0.0682322681f},
-std::array<float,2>{0.761660039f, 0.352066249f},
-std::array<float,2>{0.0955437869f, 0.98352325f},
-std::array<float,2>{0.839746892f, 0.662006021f},
-std::array<float,2>{0.0273983292f, 0.130729854f},
-std::array<float,2>{0.539631307f, 0.499389261f},
-std::array<float,2>{0.305652589f, 0.808478177f},
-std::array<float,2>{0.731367171f, 0.889318585f},
-std::array<float,2>{0.385551035f, 0.281964749f},
-std::array<float,2>{0.93613404f, 0.00700677047f},
-std::array<float,2>{0.226243436f, 0.519082606f},
-std::array<float,2>{0.782762289f, 0.937653303f},
-std::array<float,2>{0.066815123f, 0.327349156f},
-std::array<float,2>{0.570204973f, 0.118195988f},
-std::array<float,2>{0.334306449f, 0.57353133f},
-std::array<float,2>{0.635744095f, 0.706740499f},
-std::array<float,2>{0.460423082f, 0.199853301f},
-std::array<float,2>{0.948926985f, 0.37757796f},
-std::array<float,2>{0.168740228f, 0.839366555f},
-std::array<float,2>{0.878814101f, 0.551070035f},
-std::array<float,2>{0.206270069f, 0.0438250825f},
-std::array<float,2>{0.702232063f, 0.278986275f},
-std::array<float,2>{0.411586821f, 0.928902805f},
-std::array<float,2>{0.506821394f, 0.752906144f},
-std::array<float,2>{0.253028393f, 0.461677015f},
-std::array<float,2>{0.845699191f, 0.18122676f},
-std::array<float,2>{0.0509506837f, 0.648611963f},
-std::array<float,2>{0.755140662f, 0.830685854f},
-std::array<float,2>{0.105911076f, 0.383412302f},
-std::array<float,2>{0.611786485f, 0.191224918f},
-std::array<float,2>{0.346310645f, 0.716755033f},
-std::array<float,2>{0.672315896f, 0.565283179f},
-std::array<float,2>{0.499588698f, 0.114954546f},
-std::array<float,2>{0.976870239f, 0.319053113f},
-std::array<float,2>{0.132273942f, 0.946516395f},
-std::array<float,2>{0.92340523f, 0.640898466f},
-std::array<float,2>{0.228685901f, 0.178321257f},
-std::array<float,2>{0.724941015f, 0.456352562f},
-std::array<float,2>{0.381271183f, 0.763216257f},
-std::array<float,2>{0.535925269f, 0.931706846f},
-std::array<float,2>{0.299817711f, 0.272953987f},
-std::array<float,2>{0.834697604f, 0.0312629491f},
-std::array<float,2>{0.0231396668f, 0.555084169f},
-std::array<float,2>{0.938528895f, 0.97583276f},
-std::array<float,2>{0.163434595f, 0.351066619f},
-std::array<float,2>{0.625903785f, 0.0774778202f},
-std::array<float,2>{0.466131955f, 0.62202543f},
-std::array<float,2>{0.574631512f, 0.728469491f},
-std::array<float,2>{0.337422609f, 0.239859045f},
-std::array<float,2>{0.794849217f, 0.416609079f},
-std::array<float,2>{0.0719939768f, 0.851167262f},
-std::array<float,2>{0.857105315f, 0.52719754f},
-std::array<float,2>{0.0604394749f, 0.0108720204f},
-std::array<float,2>{0.515011847f, 0.294894814f},
-std::array<float,2>{0.263059855f, 0.87502557f},
-std::array<float,2>{0.695053339f, 0.79779762f},
-std::array<float,2>{0.41452834f, 0.487909913f},
-std::array<float,2>{0.886950135f, 0.137021631f},
-std::array<float,2>{0.216900483f, 0.671689689f},
-std::array<float,2>{0.894789577f, 0.774632096f},
-std::array<float,2>{0.198207647f, 0.438241094f},
-std::array<float,2>{0.709608197f, 0.171504438f},
-std::array<float,2>{0.424322933f, 0.633261025f},
-std::array<float,2>{0.520382702f, 0.544122577f},
-std::array<float,2>{0.271633357f, 0.055881463f},
-std::array<float,2>{0.865667045f, 0.262881011f},
-std::array<float,2>{0.0444022454f, 0.908601284f},
-std::array<float,2>{0.799956739f, 0.693877399f},
-std::array<float,2>{0.0936093479f, 0.217500061f},
-std::array<float,2>{0.585400224f, 0.393915683f},
-std::array<float,2>{0.312878519f, 0.818710983f},
-std::array<float,2>{0.641174078f, 0.961451411f},
-std::array<float,2>{0.441854239f, 0.340613097f},
-std::array<float,2>{0.957140267f, 0.0946628228f},
-std::array<float,2>{0.180038556f, 0.581068873f},
-std::array<float,2>{0.825038731f, 0.892824173f},
-std::array<float,2>{0.00864278525f, 0.298407733f},
-std::array<float,2>{0.560115099f, 0.0257686079f},
-std::array<float,2>{0.287829041f, 0.505344212f},
-std::array<float,2>{0.738379598f, 0.681018353f},
-std::array<float,2>{0.390871435f, 0.146853849f},
-std::array<float,2>{0.918322384f, 0.483946711f},
-std::array<float,2>{0.241995081f, 0.787901938f},
-std::array<float,2>{0.996781766f, 0.604097188f},
-std::array<float,2>{0.144854128f, 0.0806684047f},
-std::array<float,2>{0.66162008f, 0.373909503f},
-std::array<float,2>{0.47543183f, 0.985074997f},
-std::array<float,2>{0.603665471f, 0.861697793f},
-std::array<float,2>{0.362059623f, 0.437120229f},
-std::array<float,2>{0.769165874f, 0.233378246f},
-std::array<float,2>{0.119369335f, 0.735993505f},
-std::array<float,2>{0.843299925f, 0.812586308f},
-std::array<float,2>{0.025114553f, 0.39638263f},
-std::array<float,2>{0.546118081f, 0.212932274f},
-std::array<float,2>{0.311742455f, 0.689924181f},
-std::array<float,2>{0.727399766f, 0.584866822f},
-std::array<float,2>{0.387067854f, 0.0980549082f},
-std::array<float,2>{0.933377445f, 0.336191624f},
-std::array<float,2>{0.219419613f, 0.966478646f},
-std::array<float,2>{0.969481587f, 0.640488088f},
-std::array<float,2>{0.13447918f, 0.164351821f},
-std::array<float,2>{0.684919238f, 0.44466123f},
-std::array<float,2>{0.485157877f, 0.780608833f},
-std::array<float,2>{0.622378886f, 0.912007272f},
-std::array<float,2>{0.354156911f, 0.25799793f},
-std::array<float,2>{0.765053451f, 0.0619903691f},
-std::array<float,2>{0.100361608f, 0.5397982f},
-std::array<float,2>{0.879993856f, 0.991210461f},
-std::array<float,2>{0.208528042f, 0.367810577f},
-std::array<float,2>{0.695527792f, 0.0837021396f},
-std::array<float,2>{0.40921092f, 0.606192291f},
-std::array<float,2>{0.503515303f, 0.741820991f},
-std::array<float,2>{0.254544824f, 0.229743123f},
-std::array<float,2>{0.850564301f, 0.430229932f},
-std::array<float,2>{0.0499955714f, 0.867037117f},
-std::array<float,2>{0.785995066f, 0.501328647f},
-std::array<float,2>{0.0636880323f, 0.0280822534f},
-std::array<float,2>{0.565026879f, 0.301957607f},
-std::array<float,2>{0.330194354f, 0.894665897f},
-std::array<float,2>{0.639566183f, 0.782601357f},
-std::array<float,2>{0.453511536f, 0.479150206f},
-std::array<float,2>{0.952672839f, 0.143047765f},
-std::array<float,2>{0.164075121f, 0.686661124f},
-std::array<float,2>{0.968407035f, 0.758695304f},
-std::array<float,2>{0.17364192f, 0.46068275f},
-std::array<float,2>{0.650856018f, 0.172567129f},
-std::array<float,2>{0.448563576f, 0.647413731f},
-std::array<float,2>{0.5871979f, 0.558927238f},
-std::array<float,2>{0.327912748f, 0.0361564942f},
-std::array<float,2>{0.810853302f, 0.268467307f},
-std::array<float,2>{0.0843904093f, 0.936362922f},
-std::array<float,2>{0.871965528f, 0.712456346f},
-std::array<float,2>{0.0378379822f, 0.191957697f},
-std::array<float,2>{0.527169764f, 0.388149172f},
-std::array<float,2>{0.275054753f, 0.83538717f},
-std::array<float,2>{0.718305886f, 0.951679468f},
-std::array<float,2>{0.432363689f, 0.313057631f},
-std::array<float,2>{0.902345955f, 0.112214006f},
-std::array<float,2>{0.189669937f, 0.567120433f},
-std::array<float,2>{0.777886748f, 0.880793512f},
-std::array<float,2>{0.114361241f, 0.289253324f},
-std::array<float,2>{0.600281596f, 0.0129992692f},
-std::array<float,2>{0.369844526f, 0.531243265f},
-std::array<float,2>{0.664682031f, 0.665509045f},
-std::array<float,2>{0.484056205f, 0.136141956f},
-std::array<float,2>{0.98635298f, 0.491966456f},
-std::array<float,2>{0.153425589f, 0.800873101f},
-std::array<float,2>{0.908899188f, 0.620112002f},
-std::array<float,2>{0.246226758f, 0.0734648183f},
-std::array<float,2>{0.744663656f, 0.346822441f},
-std::array<float,2>{0.404578358f, 0.971942663f},
-std::array<float,2>{0.554006457f, 0.847287714f},
-std::array<float,2>{0.289697319f, 0.419073164f},
-std::array<float,2>{0.813657582f, 0.235643908f},
-std::array<float,2>{0.00119833765f, 0.730496526f},
-std::array<float,2>{0.800901711f, 0.81149137f},
-std::array<float,2>{0.0888008326f, 0.492314339f},
-std::array<float,2>{0.57943511f, 0.125930056f},
-std::array<float,2>{0.317899525f, 0.656360269f},
-std::array<float,2>{0.646347582f, 0.520553589f},
-std::array<float,2>{0.441092908f, 0.0026753163f},
-std::array<float,2>{0.955086887f, 0.286832035f},
-std::array<float,2>{0.185979337f, 0.882897198f},
-std::array<float,2>{0.894138813f, 0.720472813f},
-std::array<float,2>{0.19986023f, 0.247362509f},
-std::array<float,2>{0.70684433f, 0.413476288f},
-std::array<float,2>{0.427013874f, 0.855578899f},
-std::array<float,2>{0.518789053f, 0.977796316f},
-std::array<float,2>{0.26869899f, 0.358174711f},
-std::array<float,2>{0.861420333f, 0.0662462637f},
-std::array<float,2>{0.0429213606f, 0.616534412f},
-std::array<float,2>{0.992554486f, 0.923368871f},
-std::array<float,2>{0.144152507f, 0.276465416f},
-std::array<float,2>{0.659303367f, 0.0418084711f},
-std::array<float,2>{0.470283628f, 0.54694736f},
-std::array<float,2>{0.607791781f, 0.655273974f},
-std::array<float,2>{0.366246462f, 0.187427863f},
-std::array<float,2>{0.770608127f, 0.468269438f},
-std::array<float,2>{0.123109601f, 0.757593811f},
-std::array<float,2>{0.823484957f, 0.578036964f},
-std::array<float,2>{0.0151683409f, 0.121254057f},
-std::array<float,2>{0.554822683f, 0.321613312f},
-std::array<float,2>{0.284970999f, 0.942767322f},
-std::array<float,2>{0.738281131f, 0.843384683f},
-std::array<float,2>{0.396850914f, 0.382495463f},
-std::array<float,2>{0.915538073f, 0.196041599f},
-std::array<float,2>{0.235866338f, 0.710934758f},
-std::array<float,2>{0.927497804f, 0.868970931f},
-std::array<float,2>{0.233364224f, 0.428722233f},
-std::array<float,2>{0.720491827f, 0.220478475f},
-std::array<float,2>{0.377253503f, 0.743468106f},
-std::array<float,2>{0.534348071f, 0.59719342f},
-std::array<float,2>{0.300799221f, 0.0895412043f},
-std::array<float,2>{0.829469919f, 0.366087407f},
-std::array<float,2>{0.0193794239f, 0.999805808f},
-std::array<float,2>{0.753560066f, 0.672848046f},
-std::array<float,2>{0.103432409f, 0.152999207f},
-std::array<float,2>{0.614279211f, 0.472370803f},
-std::array<float,2>{0.349996209f, 0.792817116f},
-std::array<float,2>{0.677307308f, 0.902676523f},
-std::array<float,2>{0.495105386f, 0.306569755f},
-std::array<float,2>{0.982095838f, 0.0166899376f},
-std::array<float,2>{0.127817377f, 0.515437722f},
-std::array<float,2>{0.85518229f, 0.960204303f},
-std::array<float,2>{0.0551998392f, 0.328665972f},
-std::array<float,2>{0.508752644f, 0.102894001f},
-std::array<float,2>{0.261336774f, 0.58605355f},
-std::array<float,2>{0.689301312f, 0.696383238f},
-std::array<float,2>{0.420913488f, 0.204479173f},
-std::array<float,2>{0.885178268f, 0.404230535f},
-std::array<float,2>{0.213305652f, 0.826500595f},
-std::array<float,2>{0.942419648f, 0.534864187f},
-std::array<float,2>{0.158857569f, 0.053793937f},
-std::array<float,2>{0.630594432f, 0.25478211f},
-std::array<float,2>{0.463924885f, 0.918215811f},
-std::array<float,2>{0.57106781f, 0.766539574f},
-std::array<float,2>{0.34359628f, 0.453068167f},
-std::array<float,2>{0.791588545f, 0.159476995f},
-std::array<float,2>{0.0759128034f, 0.63013196f},
-std::array<float,2>{0.86601752f, 0.776528001f},
-std::array<float,2>{0.0444599241f, 0.43950966f},
-std::array<float,2>{0.519837499f, 0.16988644f},
-std::array<float,2>{0.272426784f, 0.636399865f},
-std::array<float,2>{0.709465683f, 0.545989633f},
-std::array<float,2>{0.424203575f, 0.057342317f},
-std::array<float,2>{0.895103753f, 0.264486313f},
-std::array<float,2>{0.197377205f, 0.907945931f},
-std::array<float,2>{0.957628489f, 0.692736626f},
-std::array<float,2>{0.180514023f, 0.215947151f},
-std::array<float,2>{0.640884221f, 0.391260982f},
-std::array<float,2>{0.442091703f, 0.817197025f},
-std::array<float,2>{0.585710526f, 0.963125408f},
-std::array<float,2>{0.313440919f, 0.342209339f},
-std::array<float,2>{0.800768852f, 0.0969199911f},
-std::array<float,2>{0.0930465087f, 0.578494251f},
-std::array<float,2>{0.91865164f, 0.892408848f},
-std::array<float,2>{0.241403863f, 0.299768239f},
-std::array<float,2>{0.739000142f, 0.0246452857f},
-std::array<float,2>{0.391564161f, 0.506467283f},
-std::array<float,2>{0.560020626f, 0.682160735f},
-std::array<float,2>{0.287476182f, 0.145308852f},
-std::array<float,2>{0.824509501f, 0.480574936f},
-std::array<float,2>{0.00782054383f, 0.786679447f},
-std::array<float,2>{0.768818557f, 0.603150785f},
-std::array<float,2>{0.119742103f, 0.0789668262f},
-std::array<float,2>{0.604070246f, 0.372702211f},
-std::array<float,2>{0.36166653f, 0.987449288f},
-std::array<float,2>{0.661981761f, 0.859988153f},
-std::array<float,2>{0.475047708f, 0.433624238f},
-std::array<float,2>{0.996532023f, 0.232165784f},
-std::array<float,2>{0.145151541f, 0.737781823f},
-std::array<float,2>{0.977184236f, 0.82986474f},
-std::array<float,2>{0.132587314f, 0.385053545f},
-std::array<float,2>{0.672558725f, 0.188493863f},
-std::array<float,2>{0.499312103f, 0.717812955f},
-std::array<float,2>{0.61200434f, 0.563415051f},
-std::array<float,2>{0.34608534f, 0.115804344f},
-std::array<float,2>{0.755523026f, 0.31642282f},
-std::array<float,2>{0.106050774f, 0.948465765f},
-std::array<float,2>{0.834430277f, 0.643281221f},
-std::array<float,2>{0.0228147842f, 0.176420838f},
-std::array<float,2>{0.535441518f, 0.453421205f},
-std::array<float,2>{0.300428182f, 0.765570521f},
-std::array<float,2>{0.72546649f, 0.930674195f},
-std::array<float,2>{0.381798476f, 0.270883143f},
-std::array<float,2>{0.922954082f, 0.0333411656f},
-std::array<float,2>{0.229489297f, 0.556857228f},
-std::array<float,2>{0.794194758f, 0.973600447f},
-std::array<float,2>{0.0715579242f, 0.349447817f},
-std::array<float,2>{0.574797153f, 0.0752844363f},
-std::array<float,2>{0.337337464f, 0.624488175f},
-std::array<float,2>{0.625136375f, 0.729586065f},
-std::array<float,2>{0.466686904f, 0.241356373f},
-std::array<float,2>{0.939122617f, 0.415119231f},
-std::array<float,2>{0.163762555f, 0.848771274f},
-std::array<float,2>{0.887275279f, 0.525118589f},
-std::array<float,2>{0.217602432f, 0.00959822256f},
-std::array<float,2>{0.694581687f, 0.296101958f},
-std::array<float,2>{0.414914519f, 0.878248274f},
-std::array<float,2>{0.515587628f, 0.800385952f},
-std::array<float,2>{0.263607085f, 0.485025913f},
-std::array<float,2>{0.856803238f, 0.139827982f},
-std::array<float,2>{0.0599827506f, 0.668067276f},
-std::array<float,2>{0.761109948f, 0.853654563f},
-std::array<float,2>{0.0952146426f, 0.40695101f},
-std::array<float,2>{0.619042039f, 0.243728295f},
-std::array<float,2>{0.357160538f, 0.725331843f},
-std::array<float,2>{0.681226611f, 0.611857474f},
-std::array<float,2>{0.490303069f, 0.0697888806f},
-std::array<float,2>{0.975523472f, 0.354328632f},
-std::array<float,2>{0.137287185f, 0.98233974f},
-std::array<float,2>{0.935741305f, 0.663230181f},
-std::array<float,2>{0.225676134f, 0.132687241f},
-std::array<float,2>{0.730638623f, 0.496881068f},
-std::array<float,2>{0.38518396f, 0.80481565f},
-std::array<float,2>{0.539545476f, 0.887005866f},
-std::array<float,2>{0.305173844f, 0.284160376f},
-std::array<float,2>{0.839241087f, 0.00397894299f},
-std::array<float,2>{0.027855441f, 0.515639484f},
-std::array<float,2>{0.948661447f, 0.940709352f},
-std::array<float,2>{0.16808331f, 0.325520158f},
-std::array<float,2>{0.636250198f, 0.120253779f},
-std::array<float,2>{0.460880756f, 0.571424544f},
-std::array<float,2>{0.56951052f, 0.704727411f},
-std::array<float,2>{0.334743977f, 0.202810884f},
-std::array<float,2>{0.782349348f, 0.376048625f},
-std::array<float,2>{0.0669846088f, 0.836603582f},
-std::array<float,2>{0.845182061f, 0.554580808f},
-std::array<float,2>{0.0516942628f, 0.0459343381f},
-std::array<float,2>{0.505903363f, 0.279792935f},
-std::array<float,2>{0.25367409f, 0.926563919f},
-std::array<float,2>{0.702682555f, 0.750931203f},
-std::array<float,2>{0.41182366f, 0.463850498f},
-std::array<float,2>{0.878370941f, 0.182981804f},
-std::array<float,2>{0.207009494f, 0.651908696f},
-std::array<float,2>{0.901454926f, 0.793120444f},
-std::array<float,2>{0.192258805f, 0.473801076f},
-std::array<float,2>{0.713093817f, 0.150575176f},
-std::array<float,2>{0.436581105f, 0.676286697f},
-std::array<float,2>{0.530713141f, 0.508394361f},
-std::array<float,2>{0.280710399f, 0.0204441007f},
-std::array<float,2>{0.868795156f, 0.312290788f},
-std::array<float,2>{0.0319041423f, 0.899664581f},
-std::array<float,2>{0.805658937f, 0.747041643f},
-std::array<float,2>{0.0820099339f, 0.225865886f},
-std::array<float,2>{0.592204273f, 0.424350858f},
-std::array<float,2>{0.321722895f, 0.872900367f},
-std::array<float,2>{0.655091524f, 0.994048715f},
-std::array<float,2>{0.452187538f, 0.360076427f},
-std::array<float,2>{0.963032603f, 0.0908072069f},
-std::array<float,2>{0.178544119f, 0.5979532f},
-std::array<float,2>{0.819243073f, 0.915546238f},
-std::array<float,2>{0.00632749731f, 0.253039002f},
-std::array<float,2>{0.549823046f, 0.0503940061f},
-std::array<float,2>{0.293267816f, 0.538533688f},
-std::array<float,2>{0.749445856f, 0.625429213f},
-std::array<float,2>{0.398607045f, 0.162484601f},
-std::array<float,2>{0.91355449f, 0.446153611f},
-std::array<float,2>{0.243642285f, 0.771212757f},
-std::array<float,2>{0.989371896f, 0.590029359f},
-std::array<float,2>{0.150969431f, 0.107208662f},
-std::array<float,2>{0.670264125f, 0.333702475f},
-std::array<float,2>{0.478035629f, 0.953501761f},
-std::array<float,2>{0.596086025f, 0.823715985f},
-std::array<float,2>{0.373185486f, 0.401263118f},
-std::array<float,2>{0.773615956f, 0.210645884f},
-std::array<float,2>{0.110749371f, 0.703035712f},
-std::array<float,2>{0.849497974f, 0.863486826f},
-std::array<float,2>{0.0487207584f, 0.433346242f},
-std::array<float,2>{0.50059253f, 0.227636874f},
-std::array<float,2>{0.257649004f, 0.738494813f},
-std::array<float,2>{0.697965443f, 0.608795881f},
-std::array<float,2>{0.407632172f, 0.0854185224f},
-std::array<float,2>{0.881172717f, 0.37056452f},
-std::array<float,2>{0.209098697f, 0.99000597f},
-std::array<float,2>{0.949530542f, 0.684753835f},
-std::array<float,2>{0.166648597f, 0.141818434f},
-std::array<float,2>{0.637198865f, 0.476801753f},
-std::array<float,2>{0.455713183f, 0.783689976f},
-std::array<float,2>{0.563042521f, 0.897056341f},
-std::array<float,2>{0.328246802f, 0.304678112f},
-std::array<float,2>{0.788379073f, 0.0301544629f},
-std::array<float,2>{0.064730145f, 0.502177417f},
-std::array<float,2>{0.93029809f, 0.96761477f},
-std::array<float,2>{0.222131193f, 0.339077026f},
-std::array<float,2>{0.730003059f, 0.100910529f},
-std::array<float,2>{0.39061597f, 0.583285272f},
-std::array<float,2>{0.543898463f, 0.688694358f},
-std::array<float,2>{0.309640169f, 0.21198605f},
-std::array<float,2>{0.841581821f, 0.396561354f},
-std::array<float,2>{0.026605662f, 0.814647734f},
-std::array<float,2>{0.762676954f, 0.542149305f},
-std::array<float,2>{0.0996075645f, 0.0604766347f},
-std::array<float,2>{0.624373496f, 0.261662304f},
-std::array<float,2>{0.351799607f, 0.914027333f},
-std::array<float,2>{0.686890841f, 0.778096735f},
-std::array<float,2>{0.486440092f, 0.44250375f},
-std::array<float,2>{0.971433163f, 0.16681394f},
-std::array<float,2>{0.136004806f, 0.638441622f},
-std::array<float,2>{0.984805763f, 0.803157747f},
-std::array<float,2>{0.155725345f, 0.489626139f},
-std::array<float,2>{0.667335331f, 0.134764761f},
-std::array<float,2>{0.480608135f, 0.666327953f},
-std::array<float,2>{0.599352419f, 0.527736306f},
-std::array<float,2>{0.369075924f, 0.0144035025f},
-std::array<float,2>{0.781187117f, 0.291836083f},
-std::array<float,2>{0.116549321f, 0.881580889f},
-std::array<float,2>{0.815807462f, 0.733694971f},
-std::array<float,2>{0.00306691858f, 0.236412898f},
-std::array<float,2>{0.551367939f, 0.421288282f},
-std::array<float,2>{0.292026997f, 0.845118582f},
-std::array<float,2>{0.743324697f, 0.970397294f},
-std::array<float,2>{0.403445691f, 0.345028758f},
-std::array<float,2>{0.907460034f, 0.0714687556f},
-std::array<float,2>{0.248189583f, 0.61849004f},
-std::array<float,2>{0.809025824f, 0.934394062f},
-std::array<float,2>{0.0823644549f, 0.26573807f},
-std::array<float,2>{0.588778436f, 0.0371636823f},
-std::array<float,2>{0.324256778f, 0.561683655f},
-std::array<float,2>{0.649792492f, 0.646279275f},
-std::array<float,2>{0.44709143f, 0.174031004f},
-std::array<float,2>{0.96574682f, 0.457759738f},
-std::array<float,2>{0.174277514f, 0.760830998f},
-std::array<float,2>{0.905292273f, 0.570143878f},
-std::array<float,2>{0.189368129f, 0.110309526f},
-std::array<float,2>{0.715173423f, 0.31449753f},
-std::array<float,2>{0.430528849f, 0.949279189f},
-std::array<float,2>{0.524681985f, 0.832598448f},
-std::array<float,2>{0.276355624f, 0.389994264f},
-std::array<float,2>{0.873406053f, 0.194306046f},
-std::array<float,2>{0.0355657153f, 0.713460326f},
-std::array<float,2>{0.771907866f, 0.75528878f},
-std::array<float,2>{0.121600576f, 0.465079427f},
-std::array<float,2>{0.606876075f, 0.184008181f},
-std::array<float,2>{0.363480449f, 0.652980089f},
-std::array<float,2>{0.657722473f, 0.550281644f},
-std::array<float,2>{0.471571386f, 0.0407007299f},
-std::array<float,2>{0.995106757f, 0.274572432f},
-std::array<float,2>{0.141516432f, 0.925132334f},
-std::array<float,2>{0.917558014f, 0.707648575f},
-std::array<float,2>{0.237281799f, 0.198772326f},
-std::array<float,2>{0.736326396f, 0.379842132f},
-std::array<float,2>{0.395639688f, 0.841383457f},
-std::array<float,2>{0.55768919f, 0.943722248f},
-std::array<float,2>{0.282822788f, 0.322610706f},
-std::array<float,2>{0.820835471f, 0.124418333f},
-std::array<float,2>{0.0129169421f, 0.574272037f},
-std::array<float,2>{0.95499742f, 0.885547698f},
-std::array<float,2>{0.184982255f, 0.288046509f},
-std::array<float,2>{0.648076713f, 0.00159923232f},
-std::array<float,2>{0.437830657f, 0.522951186f},
-std::array<float,2>{0.581219018f, 0.659778416f},
-std::array<float,2>{0.319925398f, 0.127231225f},
-std::array<float,2>{0.804454088f, 0.494900376f},
-std::array<float,2>{0.0862981975f, 0.808767676f},
-std::array<float,2>{0.860689044f, 0.61442858f},
-std::array<float,2>{0.0397938676f, 0.0642351508f},
-std::array<float,2>{0.517570972f, 0.355550706f},
-std::array<float,2>{0.265952438f, 0.979504824f},
-std::array<float,2>{0.703362465f, 0.858500481f},
-std::array<float,2>{0.429311246f, 0.410556376f},
-std::array<float,2>{0.892144263f, 0.249922618f},
-std::array<float,2>{0.201810405f, 0.721996486f},
-std::array<float,2>{0.883532286f, 0.825755656f},
-std::array<float,2>{0.211508214f, 0.404887974f},
-std::array<float,2>{0.69140178f, 0.206336379f},
-std::array<float,2>{0.418388635f, 0.698876619f},
-std::array<float,2>{0.511537731f, 0.588740289f},
-std::array<float,2>{0.258189589f, 0.104127206f},
-std::array<float,2>{0.852163732f, 0.330227494f},
-std::array<float,2>{0.0582874604f, 0.957624495f},
-std::array<float,2>{0.789975286f, 0.631320655f},
-std::array<float,2>{0.0764675215f, 0.157918319f},
-std::array<float,2>{0.572980881f, 0.449600369f},
-std::array<float,2>{0.341307312f, 0.767715514f},
-std::array<float,2>{0.632180035f, 0.920301497f},
-std::array<float,2>{0.461561233f, 0.25734061f},
-std::array<float,2>{0.943822265f, 0.0526039302f},
-std::array<float,2>{0.157120436f, 0.531916857f},
-std::array<float,2>{0.831489921f, 0.996543348f},
-std::array<float,2>{0.017563954f, 0.364457667f},
-std::array<float,2>{0.532594979f, 0.0866947547f},
-std::array<float,2>{0.304464012f, 0.595051825f},
-std::array<float,2>{0.72179234f, 0.744281113f},
-std::array<float,2>{0.376100838f, 0.221369132f},
-std::array<float,2>{0.928988993f, 0.426512688f},
-std::array<float,2>{0.232182905f, 0.869344652f},
-std::array<float,2>{0.983621478f, 0.512755752f},
-std::array<float,2>{0.125301033f, 0.0184257869f},
-std::array<float,2>{0.679001808f, 0.3079018f},
-std::array<float,2>{0.492908329f, 0.905911505f},
-std::array<float,2>{0.616886854f, 0.789942205f},
-std::array<float,2>{0.348984361f, 0.469911784f},
-std::array<float,2>{0.750171065f, 0.155575231f},
-std::array<float,2>{0.105185241f, 0.674367607f},
-std::array<float,2>{0.826296687f, 0.787111402f},
-std::array<float,2>{0.0110497223f, 0.483741045f},
-std::array<float,2>{0.562089741f, 0.147229493f},
-std::array<float,2>{0.285761893f, 0.681328356f},
-std::array<float,2>{0.741865933f, 0.505651891f},
-std::array<float,2>{0.393216521f, 0.0259463619f},
-std::array<float,2>{0.920595646f, 0.297978848f},
-std::array<float,2>{0.238547549f, 0.893372297f},
-std::array<float,2>{0.998046875f, 0.735626578f},
-std::array<float,2>{0.147846952f, 0.23263067f},
-std::array<float,2>{0.662881255f, 0.436820835f},
-std::array<float,2>{0.473099053f, 0.861839235f},
-std::array<float,2>{0.602467299f, 0.984414101f},
-std::array<float,2>{0.360487968f, 0.373092353f},
-std::array<float,2>{0.765999377f, 0.0802841932f},
-std::array<float,2>{0.118973859f, 0.603807569f},
-std::array<float,2>{0.897059143f, 0.908984661f},
-std::array<float,2>{0.196981147f, 0.263303488f},
-std::array<float,2>{0.708901882f, 0.0564723201f},
-std::array<float,2>{0.422395349f, 0.544469774f},
-std::array<float,2>{0.522283196f, 0.633555591f},
-std::array<float,2>{0.270898134f, 0.170917198f},
-std::array<float,2>{0.865046978f, 0.437917233f},
-std::array<float,2>{0.0458223261f, 0.775254965f},
-std::array<float,2>{0.797119141f, 0.581989288f},
-std::array<float,2>{0.0899187177f, 0.0939372256f},
-std::array<float,2>{0.58296293f, 0.340154111f},
-std::array<float,2>{0.316096455f, 0.960984707f},
-std::array<float,2>{0.64334166f, 0.81897831f},
-std::array<float,2>{0.44430092f, 0.394473732f},
-std::array<float,2>{0.959472954f, 0.216960385f},
-std::array<float,2>{0.182884037f, 0.693606138f},
-std::array<float,2>{0.941078484f, 0.850978434f},
-std::array<float,2>{0.16150637f, 0.416313916f},
-std::array<float,2>{0.62864536f, 0.239377901f},
-std::array<float,2>{0.468030423f, 0.727779746f},
-std::array<float,2>{0.577834845f, 0.621095538f},
-std::array<float,2>{0.338890642f, 0.0780121908f},
-std::array<float,2>{0.79682976f, 0.351404756f},
-std::array<float,2>{0.0725858659f, 0.976530075f},
-std::array<float,2>{0.857523322f, 0.671200335f},
-std::array<float,2>{0.0618887357f, 0.137340426f},
-std::array<float,2>{0.513566077f, 0.487776875f},
-std::array<float,2>{0.265203208f, 0.797009826f},
-std::array<float,2>{0.692807615f, 0.875739872f},
-std::array<float,2>{0.417016804f, 0.294147789f},
-std::array<float,2>{0.888747811f, 0.0113875549f},
-std::array<float,2>{0.2156149f, 0.526429713f},
-std::array<float,2>{0.756273866f, 0.947134972f},
-std::array<float,2>{0.108410835f, 0.318428516f},
-std::array<float,2>{0.609711945f, 0.114408299f},
-std::array<float,2>{0.345117152f, 0.564652681f},
-std::array<float,2>{0.674157858f, 0.716015458f},
-std::array<float,2>{0.497433037f, 0.190497383f},
-std::array<float,2>{0.979276597f, 0.382988095f},
-std::array<float,2>{0.129688278f, 0.830134332f},
-std::array<float,2>{0.925529957f, 0.555562854f},
-std::array<float,2>{0.22761938f, 0.0320092142f},
-std::array<float,2>{0.724049807f, 0.27274555f},
-std::array<float,2>{0.379883736f, 0.932354748f},
-std::array<float,2>{0.537727475f, 0.762714863f},
-std::array<float,2>{0.297757894f, 0.456711262f},
-std::array<float,2>{0.833047986f, 0.177792087f},
-std::array<float,2>{0.0214482509f, 0.641341209f},
-std::array<float,2>{0.785127938f, 0.839048982f},
-std::array<float,2>{0.0695036799f, 0.37707901f},
-std::array<float,2>{0.567685187f, 0.199357539f},
-std::array<float,2>{0.333460987f, 0.706351399f},
-std::array<float,2>{0.634757459f, 0.57399565f},
-std::array<float,2>{0.457221776f, 0.118949056f},
-std::array<float,2>{0.947030365f, 0.328076661f},
-std::array<float,2>{0.171108246f, 0.938352883f},
-std::array<float,2>{0.875203371f, 0.649332702f},
-std::array<float,2>{0.204659f, 0.180981785f},
-std::array<float,2>{0.699743092f, 0.461327046f},
-std::array<float,2>{0.413309097f, 0.752381563f},
-std::array<float,2>{0.504323423f, 0.929669321f},
-std::array<float,2>{0.25109008f, 0.278786182f},
-std::array<float,2>{0.846777916f, 0.0432614423f},
-std::array<float,2>{0.0538489632f, 0.551534593f},
-std::array<float,2>{0.974552512f, 0.984098434f},
-std::array<float,2>{0.139704987f, 0.351620078f},
-std::array<float,2>{0.681983352f, 0.0677971989f},
-std::array<float,2>{0.488883883f, 0.60959816f},
-std::array<float,2>{0.620663702f, 0.724572659f},
-std::array<float,2>{0.357616216f, 0.24595055f},
-std::array<float,2>{0.758636832f, 0.409598857f},
-std::array<float,2>{0.0970203206f, 0.853058577f},
-std::array<float,2>{0.836450219f, 0.518987179f},
-std::array<float,2>{0.0299471654f, 0.00739176525f},
-std::array<float,2>{0.541897535f, 0.281532407f},
-std::array<float,2>{0.307120621f, 0.888844967f},
-std::array<float,2>{0.733616292f, 0.807925344f},
-std::array<float,2>{0.384558946f, 0.499698877f},
-std::array<float,2>{0.934015095f, 0.130066901f},
-std::array<float,2>{0.224219605f, 0.661287189f},
-std::array<float,2>{0.910320222f, 0.773322165f},
-std::array<float,2>{0.244734034f, 0.448595464f},
-std::array<float,2>{0.747007489f, 0.160491467f},
-std::array<float,2>{0.401560575f, 0.628659248f},
-std::array<float,2>{0.547273159f, 0.535522044f},
-std::array<float,2>{0.296014279f, 0.0479197651f},
-std::array<float,2>{0.816755533f, 0.250524551f},
-std::array<float,2>{0.00537248282f, 0.91645503f},
-std::array<float,2>{0.77726531f, 0.699611545f},
-std::array<float,2>{0.112742394f, 0.208687648f},
-std::array<float,2>{0.595631063f, 0.400231928f},
-std::array<float,2>{0.371551305f, 0.820982277f},
-std::array<float,2>{0.669299483f, 0.955785394f},
-std::array<float,2>{0.479226261f, 0.335235566f},
-std::array<float,2>{0.990265727f, 0.108222164f},
-std::array<float,2>{0.148584485f, 0.592812777f},
-std::array<float,2>{0.86931324f, 0.901018739f},
-std::array<float,2>{0.0345964134f, 0.310411721f},
-std::array<float,2>{0.528891981f, 0.0233664345f},
-std::array<float,2>{0.278934836f, 0.511110425f},
-std::array<float,2>{0.711745918f, 0.679071426f},
-std::array<float,2>{0.433708489f, 0.149978176f},
-std::array<float,2>{0.900350213f, 0.475523531f},
-std::array<float,2>{0.193706736f, 0.795035124f},
-std::array<float,2>{0.961337686f, 0.600394309f},
-std::array<float,2>{0.175889388f, 0.0926584974f},
-std::array<float,2>{0.65423429f, 0.363069177f},
-std::array<float,2>{0.450945526f, 0.995878339f},
-std::array<float,2>{0.590880513f, 0.874186456f},
-std::array<float,2>{0.322511971f, 0.423586875f},
-std::array<float,2>{0.807495534f, 0.224213451f},
-std::array<float,2>{0.0790217668f, 0.748796701f},
-std::array<float,2>{0.874347448f, 0.83480382f},
-std::array<float,2>{0.0365119055f, 0.387620389f},
-std::array<float,2>{0.524112403f, 0.192526937f},
-std::array<float,2>{0.277252793f, 0.711749494f},
-std::array<float,2>{0.716590881f, 0.567522109f},
-std::array<float,2>{0.431490064f, 0.112378731f},
-std::array<float,2>{0.904877841f, 0.314357221f},
-std::array<float,2>{0.188408151f, 0.952978075f},
-std::array<float,2>{0.966382265f, 0.648311436f},
-std::array<float,2>{0.174881846f, 0.17295903f},
-std::array<float,2>{0.648530245f, 0.459684193f},
-std::array<float,2>{0.446271002f, 0.759010077f},
-std::array<float,2>{0.589661121f, 0.937413394f},
-std::array<float,2>{0.326094776f, 0.268849134f},
-std::array<float,2>{0.809788167f, 0.0352937132f},
-std::array<float,2>{0.0836761594f, 0.559934914f},
-std::array<float,2>{0.906869411f, 0.971207201f},
-std::array<float,2>{0.249287277f, 0.346093088f},
-std::array<float,2>{0.74262023f, 0.072434999f},
-std::array<float,2>{0.40255022f, 0.620973825f},
-std::array<float,2>{0.552049458f, 0.731646657f},
-std::array<float,2>{0.291845649f, 0.235343769f},
-std::array<float,2>{0.815356314f, 0.418527335f},
-std::array<float,2>{0.0026257264f, 0.846328557f},
-std::array<float,2>{0.780146182f, 0.530023515f},
-std::array<float,2>{0.115426928f, 0.0126726581f},
-std::array<float,2>{0.598623097f, 0.290794253f},
-std::array<float,2>{0.368073434f, 0.879865706f},
-std::array<float,2>{0.666257501f, 0.802370548f},
-std::array<float,2>{0.482254148f, 0.490400434f},
-std::array<float,2>{0.985926092f, 0.13548553f},
-std::array<float,2>{0.154861853f, 0.664733231f},
-std::array<float,2>{0.972612023f, 0.779514849f},
-std::array<float,2>{0.135449573f, 0.443495721f},
-std::array<float,2>{0.685652673f, 0.16505076f},
-std::array<float,2>{0.487821102f, 0.639368892f},
-std::array<float,2>{0.624012291f, 0.540376484f},
-std::array<float,2>{0.353206187f, 0.0612957291f},
-std::array<float,2>{0.763194263f, 0.259427369f},
-std::array<float,2>{0.0982446447f, 0.910356522f},
-std::array<float,2>{0.840656877f, 0.691311479f},
-std::array<float,2>{0.0260019321f, 0.214094028f},
-std::array<float,2>{0.544117332f, 0.394934982f},
-std::array<float,2>{0.309527755f, 0.813558459f},
-std::array<float,2>{0.729416549f, 0.965153337f},
-std::array<float,2>{0.389519364f, 0.337719709f},
-std::array<float,2>{0.930877388f, 0.0990251154f},
-std::array<float,2>{0.221663177f, 0.58506453f},
-std::array<float,2>{0.787402272f, 0.89559859f},
-std::array<float,2>{0.0663038045f, 0.301484525f},
-std::array<float,2>{0.563943803f, 0.0287388638f},
-std::array<float,2>{0.329686731f, 0.500025868f},
-std::array<float,2>{0.63792336f, 0.685868084f},
-std::array<float,2>{0.4562819f, 0.143645748f},
-std::array<float,2>{0.950992107f, 0.479925245f},
-std::array<float,2>{0.167595461f, 0.781811893f},
-std::array<float,2>{0.882493615f, 0.606755078f},
-std::array<float,2>{0.210070729f, 0.0820995495f},
-std::array<float,2>{0.698475957f, 0.368226767f},
-std::array<float,2>{0.406739682f, 0.991600156f},
-std::array<float,2>{0.501121938f, 0.865307212f},
-std::array<float,2>{0.256374031f, 0.431321889f},
-std::array<float,2>{0.848193228f, 0.228926763f},
-std::array<float,2>{0.0476322882f, 0.74097997f},
-std::array<float,2>{0.751475811f, 0.791179001f},
-std::array<float,2>{0.10440056f, 0.471109569f},
-std::array<float,2>{0.615977466f, 0.154234409f},
-std::array<float,2>{0.347978324f, 0.673515141f},
-std::array<float,2>{0.678372979f, 0.513884008f},
-std::array<float,2>{0.494008094f, 0.0163330119f},
-std::array<float,2>{0.98315829f, 0.30512765f},
-std::array<float,2>{0.126407146f, 0.904069006f},
-std::array<float,2>{0.928066313f, 0.743121922f},
-std::array<float,2>{0.230905205f, 0.219277233f},
-std::array<float,2>{0.721628129f, 0.428258508f},
-std::array<float,2>{0.375035018f, 0.868029237f},
-std::array<float,2>{0.532060683f, 0.998575449f},
-std::array<float,2>{0.302825004f, 0.366443634f},
-std::array<float,2>{0.830986738f, 0.0880999118f},
-std::array<float,2>{0.0163889285f, 0.59626472f},
-std::array<float,2>{0.945300281f, 0.919537783f},
-std::array<float,2>{0.157833382f, 0.25519982f},
-std::array<float,2>{0.631189466f, 0.0537048094f},
-std::array<float,2>{0.462356061f, 0.533814251f},
-std::array<float,2>{0.574197352f, 0.629702687f},
-std::array<float,2>{0.340680122f, 0.15828757f},
-std::array<float,2>{0.790396392f, 0.45145905f},
-std::array<float,2>{0.0779549032f, 0.766960919f},
-std::array<float,2>{0.853212893f, 0.587392688f},
-std::array<float,2>{0.0575044714f, 0.102130584f},
-std::array<float,2>{0.510646701f, 0.329381138f},
-std::array<float,2>{0.259245753f, 0.958984673f},
-std::array<float,2>{0.690412402f, 0.827338338f},
-std::array<float,2>{0.419124812f, 0.403136045f},
-std::array<float,2>{0.884643793f, 0.203284845f},
-std::array<float,2>{0.211923748f, 0.696125865f},
-std::array<float,2>{0.891454458f, 0.856921494f},
-std::array<float,2>{0.202753574f, 0.412864834f},
-std::array<float,2>{0.704991519f, 0.246370524f},
-std::array<float,2>{0.428128421f, 0.719039679f},
-std::array<float,2>{0.51585108f, 0.615410447f},
-std::array<float,2>{0.267209023f, 0.064807415f},
-std::array<float,2>{0.859501362f, 0.359027117f},
-std::array<float,2>{0.0400777608f, 0.977323413f},
-std::array<float,2>{0.803512335f, 0.657231808f},
-std::array<float,2>{0.0869913176f, 0.126921996f},
-std::array<float,2>{0.580356479f, 0.493807167f},
-std::array<float,2>{0.319251716f, 0.811993659f},
-std::array<float,2>{0.646593511f, 0.884527624f},
-std::array<float,2>{0.439124942f, 0.285561502f},
-std::array<float,2>{0.954046667f, 0.00378118642f},
-std::array<float,2>{0.183613583f, 0.519697189f},
-std::array<float,2>{0.821527064f, 0.942358315f},
-std::array<float,2>{0.0125046782f, 0.321101636f},
-std::array<float,2>{0.557016373f, 0.122764781f},
-std::array<float,2>{0.281714618f, 0.576661408f},
-std::array<float,2>{0.735072136f, 0.709122241f},
-std::array<float,2>{0.395282745f, 0.197034299f},
-std::array<float,2>{0.916434109f, 0.381342411f},
-std::array<float,2>{0.237877026f, 0.84210211f},
-std::array<float,2>{0.99559927f, 0.548544168f},
-std::array<float,2>{0.141940728f, 0.042476099f},
-std::array<float,2>{0.656653762f, 0.275687069f},
-std::array<float,2>{0.471985459f, 0.922638059f},
-std::array<float,2>{0.60594821f, 0.756545663f},
-std::array<float,2>{0.365176469f, 0.466870844f},
-std::array<float,2>{0.772593439f, 0.185894579f},
-std::array<float,2>{0.122294806f, 0.65499562f},
-std::array<float,2>{0.832362056f, 0.763881683f},
-std::array<float,2>{0.0200802721f, 0.454578549f},
-std::array<float,2>{0.538746774f, 0.177497551f},
-std::array<float,2>{0.29801479f, 0.643681824f},
-std::array<float,2>{0.723441362f, 0.558433473f},
-std::array<float,2>{0.379854649f, 0.0343480818f},
-std::array<float,2>{0.924424112f, 0.269672364f},
-std::array<float,2>{0.22714211f, 0.929762602f},
-std::array<float,2>{0.980256736f, 0.717588961f},
-std::array<float,2>{0.130272955f, 0.188147217f},
-std::array<float,2>{0.675669551f, 0.385888875f},
-std::array<float,2>{0.496618271f, 0.828982234f},
-std::array<float,2>{0.610488117f, 0.947785556f},
-std::array<float,2>{0.3439641f, 0.317467421f},
-std::array<float,2>{0.756957889f, 0.117088817f},
-std::array<float,2>{0.108107515f, 0.563967526f},
-std::array<float,2>{0.889894485f, 0.877021074f},
-std::array<float,2>{0.216508791f, 0.295747846f},
-std::array<float,2>{0.692032695f, 0.00782248564f},
-std::array<float,2>{0.416427612f, 0.524287581f},
-std::array<float,2>{0.512018621f, 0.669622123f},
-std::array<float,2>{0.264231503f, 0.139475271f},
-std::array<float,2>{0.858751893f, 0.486191303f},
-std::array<float,2>{0.0608615875f, 0.799161971f},
-std::array<float,2>{0.795466721f, 0.623391867f},
-std::array<float,2>{0.0735185444f, 0.0750863105f},
-std::array<float,2>{0.57688278f, 0.34851256f},
-std::array<float,2>{0.338793904f, 0.973878741f},
-std::array<float,2>{0.627100646f, 0.848075807f},
-std::array<float,2>{0.467555851f, 0.41475144f},
-std::array<float,2>{0.939478576f, 0.240281805f},
-std::array<float,2>{0.160740897f, 0.728576362f},
-std::array<float,2>{0.960359275f, 0.81748414f},
-std::array<float,2>{0.181934729f, 0.391664594f},
-std::array<float,2>{0.643660843f, 0.215675175f},
-std::array<float,2>{0.445232958f, 0.691808283f},
-std::array<float,2>{0.583958328f, 0.579569578f},
-std::array<float,2>{0.315012783f, 0.0959049091f},
-std::array<float,2>{0.798565805f, 0.342944473f},
-std::array<float,2>{0.0915077403f, 0.96402818f},
-std::array<float,2>{0.863903701f, 0.634934545f},
-std::array<float,2>{0.0462614223f, 0.168799624f},
-std::array<float,2>{0.522871614f, 0.440575987f},
-std::array<float,2>{0.270305961f, 0.77614522f},
-std::array<float,2>{0.707656145f, 0.907007754f},
-std::array<float,2>{0.423060209f, 0.265522033f},
-std::array<float,2>{0.898434758f, 0.0582330711f},
-std::array<float,2>{0.195709452f, 0.545251727f},
-std::array<float,2>{0.766842246f, 0.987067044f},
-std::array<float,2>{0.117928252f, 0.371262372f},
-std::array<float,2>{0.602924585f, 0.0797869265f},
-std::array<float,2>{0.360095292f, 0.601731062f},
-std::array<float,2>{0.663169742f, 0.736932337f},
-std::array<float,2>{0.473656207f, 0.230877638f},
-std::array<float,2>{0.999601364f, 0.434843719f},
-std::array<float,2>{0.147223458f, 0.86064291f},
-std::array<float,2>{0.921806931f, 0.506920934f},
-std::array<float,2>{0.240016133f, 0.0236015469f},
-std::array<float,2>{0.740778029f, 0.300038218f},
-std::array<float,2>{0.39370954f, 0.890885353f},
-std::array<float,2>{0.56059891f, 0.785212755f},
-std::array<float,2>{0.287103862f, 0.482027203f},
-std::array<float,2>{0.828040063f, 0.146051586f},
-std::array<float,2>{0.00983720273f, 0.682908952f},
-std::array<float,2>{0.808159649f, 0.871295094f},
-std::array<float,2>{0.0791968703f, 0.424964726f},
-std::array<float,2>{0.590576291f, 0.224911451f},
-std::array<float,2>{0.324113816f, 0.747225761f},
-std::array<float,2>{0.653111339f, 0.599008083f},
-std::array<float,2>{0.449385256f, 0.0914044008f},
-std::array<float,2>{0.962813318f, 0.361308962f},
-std::array<float,2>{0.177224681f, 0.992930055f},
-std::array<float,2>{0.898813069f, 0.677162886f},
-std::array<float,2>{0.194716752f, 0.151482522f},
-std::array<float,2>{0.712155998f, 0.473210037f},
-std::array<float,2>{0.435160041f, 0.794419765f},
-std::array<float,2>{0.527515054f, 0.899265289f},
-std::array<float,2>{0.277393669f, 0.311152905f},
-std::array<float,2>{0.870132923f, 0.0209251028f},
-std::array<float,2>{0.0340925902f, 0.509618998f},
-std::array<float,2>{0.99189949f, 0.954327345f},
-std::array<float,2>{0.150286287f, 0.332736343f},
-std::array<float,2>{0.668932915f, 0.106284432f},
-std::array<float,2>{0.47961551f, 0.590969384f},
-std::array<float,2>{0.593914568f, 0.701635242f},
-std::array<float,2>{0.372879326f, 0.209886894f},
-std::array<float,2>{0.775525451f, 0.401833326f},
-std::array<float,2>{0.111644179f, 0.823081672f},
-std::array<float,2>{0.818169475f, 0.537859917f},
-std::array<float,2>{0.00430948148f, 0.0493095629f},
-std::array<float,2>{0.548630476f, 0.252011657f},
-std::array<float,2>{0.295410097f, 0.914417982f},
-std::array<float,2>{0.747826517f, 0.770285368f},
-std::array<float,2>{0.400442839f, 0.446725339f},
-std::array<float,2>{0.911768436f, 0.16333586f},
-std::array<float,2>{0.245221138f, 0.626442134f},
-std::array<float,2>{0.934626102f, 0.806216359f},
-std::array<float,2>{0.223624557f, 0.497498542f},
-std::array<float,2>{0.733123183f, 0.13147606f},
-std::array<float,2>{0.383183032f, 0.662319183f},
-std::array<float,2>{0.542691171f, 0.517329037f},
-std::array<float,2>{0.308575779f, 0.00580094475f},
-std::array<float,2>{0.837356687f, 0.284270763f},
-std::array<float,2>{0.0304100085f, 0.887753844f},
-std::array<float,2>{0.758989453f, 0.726368189f},
-std::array<float,2>{0.0959917307f, 0.24284333f},
-std::array<float,2>{0.619708657f, 0.407581091f},
-std::array<float,2>{0.358671546f, 0.854951322f},
-std::array<float,2>{0.683496654f, 0.980872631f},
-std::array<float,2>{0.489396542f, 0.354671419f},
-std::array<float,2>{0.972731233f, 0.068930462f},
-std::array<float,2>{0.139012486f, 0.612306118f},
-std::array<float,2>{0.845749915f, 0.927728474f},
-std::array<float,2>{0.0528517254f, 0.280875504f},
-std::array<float,2>{0.504995644f, 0.0453504324f},
-std::array<float,2>{0.250473827f, 0.553056896f},
-std::array<float,2>{0.70091784f, 0.651033938f},
-std::array<float,2>{0.412613571f, 0.181755245f},
-std::array<float,2>{0.876746476f, 0.463903904f},
-std::array<float,2>{0.204040423f, 0.750989318f},
-std::array<float,2>{0.945396006f, 0.570834875f},
-std::array<float,2>{0.169999063f, 0.119966805f},
-std::array<float,2>{0.633760035f, 0.324547321f},
-std::array<float,2>{0.458332151f, 0.939962387f},
-std::array<float,2>{0.567147851f, 0.83716923f},
-std::array<float,2>{0.332505405f, 0.375934303f},
-std::array<float,2>{0.784024835f, 0.201629132f},
-std::array<float,2>{0.06853313f, 0.703699231f},
-std::array<float,2>{0.812504888f, 0.844004869f},
-std::array<float,2>{0.000302338507f, 0.420241982f},
-std::array<float,2>{0.552896559f, 0.237572595f},
-std::array<float,2>{0.290206552f, 0.733381033f},
-std::array<float,2>{0.745679438f, 0.617567003f},
-std::array<float,2>{0.405697227f, 0.0706238821f},
-std::array<float,2>{0.909792721f, 0.343985349f},
-std::array<float,2>{0.247630104f, 0.969220817f},
-std::array<float,2>{0.988151371f, 0.667902112f},
-std::array<float,2>{0.152805254f, 0.133060396f},
-std::array<float,2>{0.665718794f, 0.488406748f},
-std::array<float,2>{0.482509613f, 0.804213047f},
-std::array<float,2>{0.600828469f, 0.882188737f},
-std::array<float,2>{0.370363295f, 0.292019635f},
-std::array<float,2>{0.778558969f, 0.0148903364f},
-std::array<float,2>{0.114073142f, 0.528812468f},
-std::array<float,2>{0.903699815f, 0.950763822f},
-std::array<float,2>{0.190974265f, 0.315656662f},
-std::array<float,2>{0.717386901f, 0.110406771f},
-std::array<float,2>{0.432703853f, 0.5691787f},
-std::array<float,2>{0.525910676f, 0.714740574f},
-std::array<float,2>{0.273562133f, 0.195228666f},
-std::array<float,2>{0.872679591f, 0.389103711f},
-std::array<float,2>{0.0383429974f, 0.833197832f},
-std::array<float,2>{0.811724722f, 0.56129384f},
-std::array<float,2>{0.0858584419f, 0.0384448096f},
-std::array<float,2>{0.586422265f, 0.267555505f},
-std::array<float,2>{0.326359898f, 0.934773862f},
-std::array<float,2>{0.651996136f, 0.760648072f},
-std::array<float,2>{0.447342306f, 0.458826035f},
-std::array<float,2>{0.966950178f, 0.175163627f},
-std::array<float,2>{0.172438115f, 0.64538449f},
-std::array<float,2>{0.951795757f, 0.785088122f},
-std::array<float,2>{0.165919438f, 0.478150636f},
-std::array<float,2>{0.639948964f, 0.141042426f},
-std::array<float,2>{0.454194576f, 0.684443176f},
-std::array<float,2>{0.56580174f, 0.50326705f},
-std::array<float,2>{0.3317478f, 0.03067079f},
-std::array<float,2>{0.787092268f, 0.303431809f},
-std::array<float,2>{0.0627627522f, 0.89838028f},
-std::array<float,2>{0.851010442f, 0.739509046f},
-std::array<float,2>{0.0493637584f, 0.22679776f},
-std::array<float,2>{0.502749324f, 0.431822211f},
-std::array<float,2>{0.255679369f, 0.864566565f},
-std::array<float,2>{0.696920693f, 0.988885403f},
-std::array<float,2>{0.40897119f, 0.370062798f},
-std::array<float,2>{0.879359543f, 0.0848462731f},
-std::array<float,2>{0.207582697f, 0.607469857f},
-std::array<float,2>{0.764274061f, 0.912445426f},
-std::array<float,2>{0.101058617f, 0.260298699f},
-std::array<float,2>{0.621856868f, 0.0594647489f},
-std::array<float,2>{0.354588985f, 0.541853368f},
-std::array<float,2>{0.684333086f, 0.637622237f},
-std::array<float,2>{0.48613137f, 0.167170256f},
-std::array<float,2>{0.96997261f, 0.441836208f},
-std::array<float,2>{0.13299185f, 0.779013515f},
-std::array<float,2>{0.931663632f, 0.583007276f},
-std::array<float,2>{0.220085517f, 0.10032253f},
-std::array<float,2>{0.728295505f, 0.338349044f},
-std::array<float,2>{0.388476372f, 0.96797663f},
-std::array<float,2>{0.545710742f, 0.815692067f},
-std::array<float,2>{0.31087473f, 0.398326516f},
-std::array<float,2>{0.842486441f, 0.211814255f},
-std::array<float,2>{0.0243056938f, 0.688341022f},
-std::array<float,2>{0.792705655f, 0.768695533f},
-std::array<float,2>{0.0751264468f, 0.45053947f},
-std::array<float,2>{0.571668088f, 0.156884298f},
-std::array<float,2>{0.342377305f, 0.632505298f},
-std::array<float,2>{0.629817605f, 0.532332599f},
-std::array<float,2>{0.462963313f, 0.0514929742f},
-std::array<float,2>{0.942021132f, 0.256278932f},
-std::array<float,2>{0.159935877f, 0.921064734f},
-std::array<float,2>{0.885970473f, 0.697691023f},
-std::array<float,2>{0.214207247f, 0.205086052f},
-std::array<float,2>{0.687827706f, 0.405699223f},
-std::array<float,2>{0.420566767f, 0.824944317f},
-std::array<float,2>{0.509064078f, 0.958506882f},
-std::array<float,2>{0.260372162f, 0.331238151f},
-std::array<float,2>{0.853769481f, 0.105274461f},
-std::array<float,2>{0.0561279431f, 0.589170277f},
-std::array<float,2>{0.981143713f, 0.905002356f},
-std::array<float,2>{0.128315732f, 0.307286531f},
-std::array<float,2>{0.676080406f, 0.0192092042f},
-std::array<float,2>{0.495824546f, 0.512534738f},
-std::array<float,2>{0.613398194f, 0.675389826f},
-std::array<float,2>{0.351441532f, 0.154653952f},
-std::array<float,2>{0.752431989f, 0.469638199f},
-std::array<float,2>{0.102206074f, 0.790629983f},
-std::array<float,2>{0.828248441f, 0.594229758f},
-std::array<float,2>{0.0179854427f, 0.0876213163f},
-std::array<float,2>{0.533403099f, 0.364154875f},
-std::array<float,2>{0.302062362f, 0.997975111f},
-std::array<float,2>{0.719062805f, 0.87044692f},
-std::array<float,2>{0.378219634f, 0.426936328f},
-std::array<float,2>{0.925968945f, 0.222408265f},
-std::array<float,2>{0.233773693f, 0.74598223f},
-std::array<float,2>{0.914274633f, 0.840477705f},
-std::array<float,2>{0.235126048f, 0.380666941f},
-std::array<float,2>{0.736510277f, 0.198241249f},
-std::array<float,2>{0.397464693f, 0.708234608f},
-std::array<float,2>{0.556478858f, 0.575228214f},
-std::array<float,2>{0.283443481f, 0.123820968f},
-std::array<float,2>{0.823114991f, 0.323268354f},
-std::array<float,2>{0.0142695978f, 0.945087969f},
-std::array<float,2>{0.770484865f, 0.653431416f},
-std::array<float,2>{0.124163255f, 0.185396433f},
-std::array<float,2>{0.609239817f, 0.466583282f},
-std::array<float,2>{0.365270883f, 0.754357278f},
-std::array<float,2>{0.658504248f, 0.92480427f},
-std::array<float,2>{0.46900326f, 0.274212569f},
-std::array<float,2>{0.993825555f, 0.0399435163f},
-std::array<float,2>{0.142899394f, 0.549504519f},
-std::array<float,2>{0.862505436f, 0.979237258f},
-std::array<float,2>{0.0410664268f, 0.357031822f},
-std::array<float,2>{0.518265784f, 0.0629515573f},
-std::array<float,2>{0.268448889f, 0.613504112f},
-std::array<float,2>{0.705309689f, 0.721635878f},
-std::array<float,2>{0.426044077f, 0.248209029f},
-std::array<float,2>{0.892658949f, 0.41145435f},
-std::array<float,2>{0.201081619f, 0.857780755f},
-std::array<float,2>{0.956101775f, 0.521714091f},
-std::array<float,2>{0.187377438f, 0.000792606676f},
-std::array<float,2>{0.645132542f, 0.28841269f},
-std::array<float,2>{0.439617902f, 0.886493385f},
-std::array<float,2>{0.578614533f, 0.810271919f},
-std::array<float,2>{0.317290306f, 0.495598584f},
-std::array<float,2>{0.802590907f, 0.128745601f},
-std::array<float,2>{0.0897709876f, 0.659006f},
-std::array<float,2>{0.856234312f, 0.798758328f},
-std::array<float,2>{0.0590384975f, 0.486536711f},
-std::array<float,2>{0.514213026f, 0.138077512f},
-std::array<float,2>{0.261762679f, 0.67013973f},
-std::array<float,2>{0.693942249f, 0.526231587f},
-std::array<float,2>{0.415842146f, 0.0099380631f},
-std::array<float,2>{0.888543606f, 0.293866187f},
-std::array<float,2>{0.21843186f, 0.876730382f},
-std::array<float,2>{0.937698841f, 0.726635337f},
-std::array<float,2>{0.162513196f, 0.23890169f},
-std::array<float,2>{0.626291096f, 0.417127758f},
-std::array<float,2>{0.465814114f, 0.850513637f},
-std::array<float,2>{0.576031327f, 0.975010514f},
-std::array<float,2>{0.336088657f, 0.350337476f},
-std::array<float,2>{0.793762743f, 0.0771162361f},
-std::array<float,2>{0.070641838f, 0.62274754f},
-std::array<float,2>{0.922349513f, 0.932955086f},
-std::array<float,2>{0.229945809f, 0.272436261f},
-std::array<float,2>{0.726355195f, 0.0326464027f},
-std::array<float,2>{0.382645369f, 0.556598425f},
-std::array<float,2>{0.53679508f, 0.642334819f},
-std::array<float,2>{0.298945874f, 0.178997114f},
-std::array<float,2>{0.835751772f, 0.455222845f},
-std::array<float,2>{0.0222702175f, 0.762147367f},
-std::array<float,2>{0.754176736f, 0.566132665f},
-std::array<float,2>{0.106831133f, 0.113646552f},
-std::array<float,2>{0.612426221f, 0.319364667f},
-std::array<float,2>{0.346776187f, 0.945439756f},
-std::array<float,2>{0.673230827f, 0.831792295f},
-std::array<float,2>{0.498781443f, 0.384352505f},
-std::array<float,2>{0.978439867f, 0.189517096f},
-std::array<float,2>{0.1313539f, 0.715318799f},
-std::array<float,2>{0.997908115f, 0.86316222f},
-std::array<float,2>{0.146175548f, 0.436314464f},
-std::array<float,2>{0.660603583f, 0.233576611f},
-std::array<float,2>{0.475978822f, 0.734546185f},
-std::array<float,2>{0.604782045f, 0.604618728f},
-std::array<float,2>{0.362306982f, 0.0817623362f},
-std::array<float,2>{0.768371165f, 0.374706149f},
-std::array<float,2>{0.120283075f, 0.985878289f},
-std::array<float,2>{0.825977147f, 0.680463076f},
-std::array<float,2>{0.00966244284f, 0.147482559f},
-std::array<float,2>{0.558758438f, 0.482544065f},
-std::array<float,2>{0.288126647f, 0.78903389f},
-std::array<float,2>{0.73943764f, 0.893961191f},
-std::array<float,2>{0.39241761f, 0.297693074f},
-std::array<float,2>{0.919722795f, 0.0273140408f},
-std::array<float,2>{0.240484029f, 0.504207194f},
-std::array<float,2>{0.799300969f, 0.962804794f},
-std::array<float,2>{0.0923052207f, 0.340994567f},
-std::array<float,2>{0.58421278f, 0.0952495486f},
-std::array<float,2>{0.31348896f, 0.580907881f},
-std::array<float,2>{0.642127872f, 0.694369912f},
-std::array<float,2>{0.443139493f, 0.218459308f},
-std::array<float,2>{0.958723545f, 0.392770141f},
-std::array<float,2>{0.180865943f, 0.819665909f},
-std::array<float,2>{0.896031618f, 0.543414593f},
-std::array<float,2>{0.198528618f, 0.0552061796f},
-std::array<float,2>{0.710063756f, 0.262237579f},
-std::array<float,2>{0.425543875f, 0.909682512f},
-std::array<float,2>{0.521349788f, 0.774288476f},
-std::array<float,2>{0.273211449f, 0.438986659f},
-std::array<float,2>{0.866530359f, 0.170686185f},
-std::array<float,2>{0.0430493951f, 0.634126842f},
-std::array<float,2>{0.774472833f, 0.82162112f},
-std::array<float,2>{0.110009722f, 0.399179071f},
-std::array<float,2>{0.596986055f, 0.207101926f},
-std::array<float,2>{0.374240905f, 0.700541973f},
-std::array<float,2>{0.671540499f, 0.592077792f},
-std::array<float,2>{0.476573139f, 0.10864678f},
-std::array<float,2>{0.988744259f, 0.334226996f},
-std::array<float,2>{0.15174982f, 0.95635879f},
-std::array<float,2>{0.912242234f, 0.627734482f},
-std::array<float,2>{0.242486045f, 0.161732882f},
-std::array<float,2>{0.748834729f, 0.448061436f},
-std::array<float,2>{0.400003612f, 0.772399902f},
-std::array<float,2>{0.549304605f, 0.91714853f},
-std::array<float,2>{0.293994129f, 0.251322508f},
-std::array<float,2>{0.820212901f, 0.0477035791f},
-std::array<float,2>{0.00717089977f, 0.536915064f},
-std::array<float,2>{0.963885128f, 0.994878352f},
-std::array<float,2>{0.179423481f, 0.361757696f},
-std::array<float,2>{0.65602535f, 0.0934964642f},
-std::array<float,2>{0.451213807f, 0.601359427f},
-std::array<float,2>{0.592779875f, 0.749398768f},
-std::array<float,2>{0.3209804f, 0.223351911f},
-std::array<float,2>{0.806560636f, 0.422355115f},
-std::array<float,2>{0.080824092f, 0.873441398f},
-std::array<float,2>{0.867488384f, 0.510007858f},
-std::array<float,2>{0.032274846f, 0.0221769009f},
-std::array<float,2>{0.529946923f, 0.308781475f},
-std::array<float,2>{0.279508412f, 0.901960731f},
-std::array<float,2>{0.714786351f, 0.796363711f},
-std::array<float,2>{0.436154276f, 0.47636044f},
-std::array<float,2>{0.90056318f, 0.148979336f},
-std::array<float,2>{0.192466617f, 0.678682327f},
-std::array<float,2>{0.876962841f, 0.753785372f},
-std::array<float,2>{0.205983639f, 0.46199128f},
-std::array<float,2>{0.701953948f, 0.180427894f},
-std::array<float,2>{0.411099315f, 0.649476826f},
-std::array<float,2>{0.5068627f, 0.552185833f},
-std::array<float,2>{0.252635896f, 0.0445758663f},
-std::array<float,2>{0.844424069f, 0.277552366f},
-std::array<float,2>{0.0522183552f, 0.927916706f},
-std::array<float,2>{0.782185197f, 0.705591559f},
-std::array<float,2>{0.0676602647f, 0.201075539f},
-std::array<float,2>{0.569031537f, 0.378811747f},
-std::array<float,2>{0.335812896f, 0.838861704f},
-std::array<float,2>{0.634770095f, 0.939148545f},
-std::array<float,2>{0.459454447f, 0.326786339f},
-std::array<float,2>{0.947608471f, 0.117724136f},
-std::array<float,2>{0.169242322f, 0.57311213f},
-std::array<float,2>{0.838608682f, 0.890489697f},
-std::array<float,2>{0.02877919f, 0.283106714f},
-std::array<float,2>{0.540961266f, 0.00591238635f},
-std::array<float,2>{0.306589991f, 0.518535852f},
-std::array<float,2>{0.732312858f, 0.660943031f},
-std::array<float,2>{0.386381298f, 0.128910124f},
-std::array<float,2>{0.936523497f, 0.49900806f},
-std::array<float,2>{0.225521132f, 0.806832254f},
-std::array<float,2>{0.976315558f, 0.610959589f},
-std::array<float,2>{0.138281092f, 0.0664921924f},
-std::array<float,2>{0.680590868f, 0.352942616f},
-std::array<float,2>{0.492122889f, 0.983141124f},
-std::array<float,2>{0.617820323f, 0.85190469f},
-std::array<float,2>{0.355722338f, 0.408902138f},
-std::array<float,2>{0.760423243f, 0.245068476f},
-std::array<float,2>{0.0940777138f, 0.723461986f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.117356345f, 0.859582782f},
-std::array<float,2>{0.532060921f, 0.0957579538f},
-std::array<float,2>{0.333925933f, 0.41812253f},
-std::array<float,2>{0.961726844f, 0.714542627f},
-std::array<float,2>{0.393429965f, 0.521310687f},
-std::array<float,2>{0.775985658f, 0.326849401f},
-std::array<float,2>{0.131785661f, 0.210094467f},
-std::array<float,2>{0.668943644f, 0.909607828f},
-std::array<float,2>{0.231947646f, 0.675938129f},
-std::array<float,2>{0.710528016f, 0.481411159f},
-std::array<float,2>{0.488709509f, 0.00561251165f},
-std::array<float,2>{0.867765725f, 0.801489174f},
-std::array<float,2>{0.308667481f, 0.977866471f},
-std::array<float,2>{0.891594291f, 0.144301757f},
-std::array<float,2>{0.0121497298f, 0.292854726f},
-std::array<float,2>{0.599309802f, 0.587716222f},
-std::array<float,2>{0.185899585f, 0.88312f},
-std::array<float,2>{0.644282043f, 0.248239025f},
-std::array<float,2>{0.420256972f, 0.352279335f},
-std::array<float,2>{0.796313345f, 0.534271598f},
-std::array<float,2>{0.35072884f, 0.720079839f},
-std::array<float,2>{0.99164176f, 0.398965091f},
-std::array<float,2>{0.0672223419f, 0.0756809115f},
-std::array<float,2>{0.530788898f, 0.816905797f},
-std::array<float,2>{0.0319728367f, 0.596045554f},
-std::array<float,2>{0.568100333f, 0.262193054f},
-std::array<float,2>{0.25009504f, 0.162874982f},
-std::array<float,2>{0.925610065f, 0.962863684f},
-std::array<float,2>{0.451172948f, 0.760104358f},
-std::array<float,2>{0.827909231f, 0.0375356078f},
-std::array<float,2>{0.21791552f, 0.455671996f},
-std::array<float,2>{0.749098063f, 0.645613194f},
-std::array<float,2>{0.0260284226f, 0.940337777f},
-std::array<float,2>{0.616981447f, 0.180226028f},
-std::array<float,2>{0.283007085f, 0.278265357f},
-std::array<float,2>{0.880406439f, 0.62051487f},
-std::array<float,2>{0.482827723f, 0.634663522f},
-std::array<float,2>{0.844801426f, 0.442677885f},
-std::array<float,2>{0.243131772f, 0.0504962392f},
-std::array<float,2>{0.700341105f, 0.776146352f},
-std::array<float,2>{0.14553684f, 0.562047601f},
-std::array<float,2>{0.676618874f, 0.361735314f},
-std::array<float,2>{0.387994468f, 0.22987619f},
-std::array<float,2>{0.750555873f, 0.890889406f},
-std::array<float,2>{0.312989384f, 0.834552884f},
-std::array<float,2>{0.946853399f, 0.0906533748f},
-std::array<float,2>{0.109123655f, 0.385764927f},
-std::array<float,2>{0.552790701f, 0.735452175f},
-std::array<float,2>{0.198028401f, 0.786843061f},
-std::array<float,2>{0.7314803f, 0.0210074224f},
-std::array<float,2>{0.456307918f, 0.487034321f},
-std::array<float,2>{0.830237806f, 0.669513762f},
-std::array<float,2>{0.269375682f, 0.568611741f},
-std::array<float,2>{0.918838382f, 0.304074377f},
-std::array<float,2>{0.0545496196f, 0.125323176f},
-std::array<float,2>{0.58625561f, 0.992164135f},
-std::array<float,2>{0.0929107293f, 0.70058465f},
-std::array<float,2>{0.50426811f, 0.422496378f},
-std::array<float,2>{0.373477995f, 0.114473119f},
-std::array<float,2>{0.970053911f, 0.85790813f},
-std::array<float,2>{0.423996627f, 0.929729402f},
-std::array<float,2>{0.804148734f, 0.197960317f},
-std::array<float,2>{0.169138134f, 0.329282224f},
-std::array<float,2>{0.634299874f, 0.50556165f},
-std::array<float,2>{0.055097755f, 0.772407234f},
-std::array<float,2>{0.582831562f, 0.054841172f},
-std::array<float,2>{0.274586052f, 0.449695706f},
-std::array<float,2>{0.910978854f, 0.628085732f},
-std::array<float,2>{0.462412119f, 0.611406565f},
-std::array<float,2>{0.841079235f, 0.268883526f},
-std::array<float,2>{0.194665134f, 0.17869173f},
-std::array<float,2>{0.722225189f, 0.951757014f},
-std::array<float,2>{0.161710024f, 0.746149123f},
-std::array<float,2>{0.629720688f, 0.376206964f},
-std::array<float,2>{0.432564557f, 0.0814548731f},
-std::array<float,2>{0.805867791f, 0.838121533f},
-std::array<float,2>{0.361961752f, 0.900741041f},
-std::array<float,2>{0.982772648f, 0.22165136f},
-std::array<float,2>{0.0812192038f, 0.36872679f},
-std::array<float,2>{0.511067212f, 0.552444756f},
-std::array<float,2>{0.239119262f, 0.998435318f},
-std::array<float,2>{0.691688418f, 0.137192056f},
-std::array<float,2>{0.472728878f, 0.308559597f},
-std::array<float,2>{0.857011497f, 0.571108997f},
-std::array<float,2>{0.295310825f, 0.661260962f},
-std::array<float,2>{0.890422463f, 0.492290258f},
-std::array<float,2>{0.0187944956f, 0.0271215439f},
-std::array<float,2>{0.621768296f, 0.790497541f},
-std::array<float,2>{0.0974907577f, 0.514115334f},
-std::array<float,2>{0.554760277f, 0.338161469f},
-std::array<float,2>{0.325992137f, 0.193804994f},
-std::array<float,2>{0.941282988f, 0.922695756f},
-std::array<float,2>{0.37882942f, 0.850118816f},
-std::array<float,2>{0.763996005f, 0.118917011f},
-std::array<float,2>{0.149067551f, 0.43500033f},
-std::array<float,2>{0.682578385f, 0.689613163f},
-std::array<float,2>{0.0754253641f, 0.921587467f},
-std::array<float,2>{0.517321467f, 0.218634099f},
-std::array<float,2>{0.357119471f, 0.318142205f},
-std::array<float,2>{0.999325275f, 0.529551029f},
-std::array<float,2>{0.411626518f, 0.709816694f},
-std::array<float,2>{0.786585152f, 0.408507079f},
-std::array<float,2>{0.173337191f, 0.107955411f},
-std::array<float,2>{0.653725445f, 0.874108315f},
-std::array<float,2>{0.209481746f, 0.578570247f},
-std::array<float,2>{0.740956187f, 0.281879008f},
-std::array<float,2>{0.444063276f, 0.153485f},
-std::array<float,2>{0.819100261f, 0.974550605f},
-std::array<float,2>{0.26398173f, 0.812015235f},
-std::array<float,2>{0.936933756f, 0.0126715554f},
-std::array<float,2>{0.043064028f, 0.474912167f},
-std::array<float,2>{0.571182132f, 0.684402823f},
-std::array<float,2>{0.13725321f, 0.824417531f},
-std::array<float,2>{0.657879472f, 0.0628029108f},
-std::array<float,2>{0.405343175f, 0.395902514f},
-std::array<float,2>{0.769150376f, 0.731404781f},
-std::array<float,2>{0.343037397f, 0.546315253f},
-std::array<float,2>{0.953250647f, 0.34402746f},
-std::array<float,2>{0.113490902f, 0.236057147f},
-std::array<float,2>{0.544589698f, 0.876233041f},
-std::array<float,2>{0.00706242491f, 0.652247846f},
-std::array<float,2>{0.605187953f, 0.461031765f},
-std::array<float,2>{0.304067165f, 0.0424647778f},
-std::array<float,2>{0.905552745f, 0.75593847f},
-std::array<float,2>{0.49820888f, 0.960367501f},
-std::array<float,2>{0.864932239f, 0.169377208f},
-std::array<float,2>{0.221279502f, 0.252256215f},
-std::array<float,2>{0.712880731f, 0.605234206f},
-std::array<float,2>{0.00791385211f, 0.842208564f},
-std::array<float,2>{0.596124351f, 0.0840797126f},
-std::array<float,2>{0.307192653f, 0.382651955f},
-std::array<float,2>{0.89677614f, 0.742946744f},
-std::array<float,2>{0.484669745f, 0.549772322f},
-std::array<float,2>{0.872166753f, 0.374759614f},
-std::array<float,2>{0.230262294f, 0.22453931f},
-std::array<float,2>{0.703776181f, 0.902517974f},
-std::array<float,2>{0.126563877f, 0.632213295f},
-std::array<float,2>{0.667402267f, 0.448181242f},
-std::array<float,2>{0.397205979f, 0.059356641f},
-std::array<float,2>{0.778170288f, 0.767857492f},
-std::array<float,2>{0.3295739f, 0.947911084f},
-std::array<float,2>{0.967462361f, 0.174907908f},
-std::array<float,2>{0.12195611f, 0.272344351f},
-std::array<float,2>{0.536097586f, 0.616958499f},
-std::array<float,2>{0.214124054f, 0.927942693f},
-std::array<float,2>{0.745254993f, 0.190689757f},
-std::array<float,2>{0.445314884f, 0.340161204f},
-std::array<float,2>{0.821581423f, 0.508941829f},
-std::array<float,2>{0.255594283f, 0.694119751f},
-std::array<float,2>{0.928022921f, 0.4309012f},
-std::array<float,2>{0.0354639031f, 0.123100944f},
-std::array<float,2>{0.564626098f, 0.845802069f},
-std::array<float,2>{0.0659798384f, 0.574642718f},
-std::array<float,2>{0.525995195f, 0.310748547f},
-std::array<float,2>{0.344551235f, 0.134976313f},
-std::array<float,2>{0.987210512f, 0.994127631f},
-std::array<float,2>{0.414890438f, 0.794532537f},
-std::array<float,2>{0.789391935f, 0.0290372819f},
-std::array<float,2>{0.18053636f, 0.497787535f},
-std::array<float,2>{0.645401061f, 0.657022536f},
-std::array<float,2>{0.102036409f, 0.97138226f},
-std::array<float,2>{0.550593019f, 0.150639355f},
-std::array<float,2>{0.319569886f, 0.285269618f},
-std::array<float,2>{0.951654673f, 0.585768998f},
-std::array<float,2>{0.385436714f, 0.681557298f},
-std::array<float,2>{0.757206202f, 0.470015109f},
-std::array<float,2>{0.142881975f, 0.00794437528f},
-std::array<float,2>{0.67219007f, 0.806316018f},
-std::array<float,2>{0.246688873f, 0.525959551f},
-std::array<float,2>{0.695695519f, 0.315699399f},
-std::array<float,2>{0.479718268f, 0.211740762f},
-std::array<float,2>{0.84833777f, 0.916478813f},
-std::array<float,2>{0.285996079f, 0.867803037f},
-std::array<float,2>{0.875029981f, 0.104017235f},
-std::array<float,2>{0.0307484232f, 0.413702548f},
-std::array<float,2>{0.610924959f, 0.703284204f},
-std::array<float,2>{0.165253028f, 0.750198126f},
-std::array<float,2>{0.639796674f, 0.0433846302f},
-std::array<float,2>{0.427836269f, 0.46576041f},
-std::array<float,2>{0.799015403f, 0.65569222f},
-std::array<float,2>{0.368012965f, 0.606470287f},
-std::array<float,2>{0.974739313f, 0.256732821f},
-std::array<float,2>{0.08834593f, 0.167084336f},
-std::array<float,2>{0.500265598f, 0.956614077f},
-std::array<float,2>{0.0504077636f, 0.729682744f},
-std::array<float,2>{0.593558669f, 0.390760392f},
-std::array<float,2>{0.27271682f, 0.0673071593f},
-std::array<float,2>{0.917347074f, 0.822796583f},
-std::array<float,2>{0.457246572f, 0.880911529f},
-std::array<float,2>{0.835156798f, 0.241642907f},
-std::array<float,2>{0.202444851f, 0.351250798f},
-std::array<float,2>{0.728339911f, 0.540243864f},
-std::array<float,2>{0.0841129571f, 0.798596501f},
-std::array<float,2>{0.513802528f, 0.000452283217f},
-std::array<float,2>{0.364223629f, 0.476628572f},
-std::array<float,2>{0.977729023f, 0.673116803f},
-std::array<float,2>{0.43551439f, 0.590162754f},
-std::array<float,2>{0.810339689f, 0.296864808f},
-std::array<float,2>{0.159334898f, 0.146692723f},
-std::array<float,2>{0.628374934f, 0.983540416f},
-std::array<float,2>{0.19064723f, 0.715185583f},
-std::array<float,2>{0.725167394f, 0.415925056f},
-std::array<float,2>{0.465906233f, 0.0981489271f},
-std::array<float,2>{0.836668968f, 0.86504513f},
-std::array<float,2>{0.27817291f, 0.913381934f},
-std::array<float,2>{0.907962441f, 0.205852836f},
-std::array<float,2>{0.0596479774f, 0.32366538f},
-std::array<float,2>{0.580812395f, 0.516831756f},
-std::array<float,2>{0.154848322f, 0.968152583f},
-std::array<float,2>{0.684091389f, 0.158482105f},
-std::array<float,2>{0.382545084f, 0.259277195f},
-std::array<float,2>{0.759270012f, 0.600771189f},
-std::array<float,2>{0.320762962f, 0.642813146f},
-std::array<float,2>{0.943231106f, 0.457389325f},
-std::array<float,2>{0.100887865f, 0.0341715552f},
-std::array<float,2>{0.559069157f, 0.764687657f},
-std::array<float,2>{0.0232394654f, 0.538609087f},
-std::array<float,2>{0.620152771f, 0.358023554f},
-std::array<float,2>{0.289597899f, 0.243285626f},
-std::array<float,2>{0.8849774f, 0.888972759f},
-std::array<float,2>{0.469871134f, 0.815633416f},
-std::array<float,2>{0.852787733f, 0.0740843862f},
-std::array<float,2>{0.23455815f, 0.402882248f},
-std::array<float,2>{0.687537909f, 0.72551471f},
-std::array<float,2>{0.0408007614f, 0.895973921f},
-std::array<float,2>{0.575897753f, 0.232684761f},
-std::array<float,2>{0.258879393f, 0.364795506f},
-std::array<float,2>{0.932479858f, 0.5556885f},
-std::array<float,2>{0.439004809f, 0.740169287f},
-std::array<float,2>{0.815303743f, 0.388090521f},
-std::array<float,2>{0.203618675f, 0.08892221f},
-std::array<float,2>{0.735006511f, 0.828794777f},
-std::array<float,2>{0.179138169f, 0.621118307f},
-std::array<float,2>{0.651959598f, 0.276307404f},
-std::array<float,2>{0.406556755f, 0.186736777f},
-std::array<float,2>{0.783287525f, 0.942320406f},
-std::array<float,2>{0.354984224f, 0.780359089f},
-std::array<float,2>{0.994166732f, 0.0517339222f},
-std::array<float,2>{0.0715234131f, 0.440854669f},
-std::array<float,2>{0.521269739f, 0.639168859f},
-std::array<float,2>{0.224173263f, 0.855439246f},
-std::array<float,2>{0.716127992f, 0.113131568f},
-std::array<float,2>{0.495529324f, 0.427081704f},
-std::array<float,2>{0.86236012f, 0.697434366f},
-std::array<float,2>{0.299603909f, 0.501399577f},
-std::array<float,2>{0.9023f, 0.335382849f},
-std::array<float,2>{0.000438687333f, 0.200813219f},
-std::array<float,2>{0.605956256f, 0.934139431f},
-std::array<float,2>{0.111419708f, 0.664779961f},
-std::array<float,2>{0.541153908f, 0.491853803f},
-std::array<float,2>{0.337806791f, 0.0162539072f},
-std::array<float,2>{0.957967579f, 0.781328797f},
-std::array<float,2>{0.399874061f, 0.986126542f},
-std::array<float,2>{0.772399485f, 0.130898833f},
-std::array<float,2>{0.136165947f, 0.299426556f},
-std::array<float,2>{0.661979139f, 0.563332856f},
-std::array<float,2>{0.0696979836f, 0.818591118f},
-std::array<float,2>{0.527668417f, 0.0768974721f},
-std::array<float,2>{0.348607481f, 0.401342988f},
-std::array<float,2>{0.989605546f, 0.721827865f},
-std::array<float,2>{0.418047845f, 0.532870829f},
-std::array<float,2>{0.79477483f, 0.353958845f},
-std::array<float,2>{0.18450208f, 0.247038677f},
-std::array<float,2>{0.641066909f, 0.88621825f},
-std::array<float,2>{0.216517836f, 0.64733237f},
-std::array<float,2>{0.747066557f, 0.453898132f},
-std::array<float,2>{0.450748265f, 0.0353523493f},
-std::array<float,2>{0.82538718f, 0.759585261f},
-std::array<float,2>{0.25274989f, 0.964826941f},
-std::array<float,2>{0.92368269f, 0.160232201f},
-std::array<float,2>{0.033831019f, 0.264522702f},
-std::array<float,2>{0.570247471f, 0.595486224f},
-std::array<float,2>{0.130752698f, 0.906701803f},
-std::array<float,2>{0.670149922f, 0.207342595f},
-std::array<float,2>{0.392274499f, 0.324448258f},
-std::array<float,2>{0.774564445f, 0.521898687f},
-std::array<float,2>{0.335475475f, 0.71122992f},
-std::array<float,2>{0.964071572f, 0.421177506f},
-std::array<float,2>{0.119729139f, 0.0951764286f},
-std::array<float,2>{0.534959376f, 0.861600697f},
-std::array<float,2>{0.0152919823f, 0.588937938f},
-std::array<float,2>{0.601527154f, 0.290497988f},
-std::array<float,2>{0.311583221f, 0.142074272f},
-std::array<float,2>{0.893899322f, 0.979169488f},
-std::array<float,2>{0.491116732f, 0.803019106f},
-std::array<float,2>{0.870838761f, 0.00667750789f},
-std::array<float,2>{0.232733563f, 0.484180808f},
-std::array<float,2>{0.707764745f, 0.678421736f},
-std::array<float,2>{0.0511940941f, 0.989816248f},
-std::array<float,2>{0.588952839f, 0.127701193f},
-std::array<float,2>{0.266180009f, 0.301788211f},
-std::array<float,2>{0.920260608f, 0.566565096f},
-std::array<float,2>{0.45490256f, 0.670517623f},
-std::array<float,2>{0.829411507f, 0.484751463f},
-std::array<float,2>{0.195729524f, 0.0225919392f},
-std::array<float,2>{0.733346879f, 0.787917972f},
-std::array<float,2>{0.169934556f, 0.507431567f},
-std::array<float,2>{0.635904312f, 0.331815124f},
-std::array<float,2>{0.42340067f, 0.196012691f},
-std::array<float,2>{0.800990403f, 0.932634234f},
-std::array<float,2>{0.372514158f, 0.855682611f},
-std::array<float,2>{0.9725613f, 0.117173456f},
-std::array<float,2>{0.0898559764f, 0.425342739f},
-std::array<float,2>{0.506456137f, 0.702053487f},
-std::array<float,2>{0.24517639f, 0.773810804f},
-std::array<float,2>{0.702113986f, 0.0476608872f},
-std::array<float,2>{0.481202781f, 0.44376266f},
-std::array<float,2>{0.845790386f, 0.635045588f},
-std::array<float,2>{0.28370139f, 0.61905849f},
-std::array<float,2>{0.880916059f, 0.280129254f},
-std::array<float,2>{0.02499553f, 0.182740703f},
-std::array<float,2>{0.61508888f, 0.938781261f},
-std::array<float,2>{0.10628438f, 0.738181531f},
-std::array<float,2>{0.550827146f, 0.383460075f},
-std::array<float,2>{0.315782219f, 0.0929187909f},
-std::array<float,2>{0.947371364f, 0.833934247f},
-std::array<float,2>{0.388810933f, 0.89381057f},
-std::array<float,2>{0.753026664f, 0.228321701f},
-std::array<float,2>{0.147861704f, 0.360436648f},
-std::array<float,2>{0.679004371f, 0.559289992f},
-std::array<float,2>{0.0156586189f, 0.791650712f},
-std::array<float,2>{0.623821259f, 0.024498051f},
-std::array<float,2>{0.294611096f, 0.494395643f},
-std::array<float,2>{0.887150168f, 0.662299931f},
-std::array<float,2>{0.475710988f, 0.574167252f},
-std::array<float,2>{0.857679307f, 0.305477113f},
-std::array<float,2>{0.241415456f, 0.13999401f},
-std::array<float,2>{0.69347167f, 0.996792495f},
-std::array<float,2>{0.150797188f, 0.687797189f},
-std::array<float,2>{0.680712581f, 0.435709804f},
-std::array<float,2>{0.375256002f, 0.119369797f},
-std::array<float,2>{0.762170792f, 0.848212242f},
-std::array<float,2>{0.326366693f, 0.925169826f},
-std::array<float,2>{0.939207971f, 0.19182764f},
-std::array<float,2>{0.0942443013f, 0.336128712f},
-std::array<float,2>{0.558469653f, 0.513166249f},
-std::array<float,2>{0.191610888f, 0.950443268f},
-std::array<float,2>{0.718761504f, 0.176197469f},
-std::array<float,2>{0.463883191f, 0.266631871f},
-std::array<float,2>{0.843001544f, 0.609913349f},
-std::array<float,2>{0.276340425f, 0.626097322f},
-std::array<float,2>{0.91278702f, 0.452500701f},
-std::array<float,2>{0.0570420809f, 0.0568995923f},
-std::array<float,2>{0.584057391f, 0.770766318f},
-std::array<float,2>{0.0782854185f, 0.553319573f},
-std::array<float,2>{0.507941842f, 0.370504171f},
-std::array<float,2>{0.360271156f, 0.220144048f},
-std::array<float,2>{0.981543541f, 0.899720967f},
-std::array<float,2>{0.431212425f, 0.836663663f},
-std::array<float,2>{0.80808866f, 0.0794464499f},
-std::array<float,2>{0.162644699f, 0.37705344f},
-std::array<float,2>{0.631817043f, 0.748460591f},
-std::array<float,2>{0.117111795f, 0.877170205f},
-std::array<float,2>{0.546137571f, 0.237228587f},
-std::array<float,2>{0.340455085f, 0.347118497f},
-std::array<float,2>{0.957010031f, 0.54480207f},
-std::array<float,2>{0.40380618f, 0.732658565f},
-std::array<float,2>{0.766085982f, 0.398280799f},
-std::array<float,2>{0.140495211f, 0.0652697235f},
-std::array<float,2>{0.660069346f, 0.827545583f},
-std::array<float,2>{0.218860984f, 0.60292995f},
-std::array<float,2>{0.713195026f, 0.250996262f},
-std::array<float,2>{0.497726768f, 0.170256838f},
-std::array<float,2>{0.865856469f, 0.958569169f},
-std::array<float,2>{0.302457958f, 0.754957139f},
-std::array<float,2>{0.902635694f, 0.0401565284f},
-std::array<float,2>{0.00548583968f, 0.464163452f},
-std::array<float,2>{0.602230847f, 0.650205791f},
-std::array<float,2>{0.175542042f, 0.872581303f},
-std::array<float,2>{0.655709386f, 0.10580644f},
-std::array<float,2>{0.41257599f, 0.408091396f},
-std::array<float,2>{0.787886202f, 0.708608925f},
-std::array<float,2>{0.359205067f, 0.529037058f},
-std::array<float,2>{0.996565342f, 0.320192784f},
-std::array<float,2>{0.0764040947f, 0.216524065f},
-std::array<float,2>{0.517616987f, 0.919913888f},
-std::array<float,2>{0.0463598147f, 0.685810208f},
-std::array<float,2>{0.572764754f, 0.473444402f},
-std::array<float,2>{0.263313562f, 0.014793748f},
-std::array<float,2>{0.934163034f, 0.808875263f},
-std::array<float,2>{0.442155242f, 0.974646568f},
-std::array<float,2>{0.817330062f, 0.155163646f},
-std::array<float,2>{0.208236381f, 0.284933835f},
-std::array<float,2>{0.739195466f, 0.580313206f},
-std::array<float,2>{0.0381507352f, 0.844765782f},
-std::array<float,2>{0.564266682f, 0.121484749f},
-std::array<float,2>{0.255921245f, 0.43187657f},
-std::array<float,2>{0.926711619f, 0.691443741f},
-std::array<float,2>{0.448434293f, 0.511619449f},
-std::array<float,2>{0.823199332f, 0.343084574f},
-std::array<float,2>{0.211577401f, 0.188203543f},
-std::array<float,2>{0.744117737f, 0.926537454f},
-std::array<float,2>{0.183572382f, 0.659228086f},
-std::array<float,2>{0.647789121f, 0.4983325f},
-std::array<float,2>{0.417950481f, 0.0305610709f},
-std::array<float,2>{0.792957783f, 0.795875311f},
-std::array<float,2>{0.346395671f, 0.994217873f},
-std::array<float,2>{0.986320138f, 0.134069115f},
-std::array<float,2>{0.0639362782f, 0.309851527f},
-std::array<float,2>{0.525068521f, 0.576886714f},
-std::array<float,2>{0.227972239f, 0.905761719f},
-std::array<float,2>{0.705238879f, 0.224874347f},
-std::array<float,2>{0.487128943f, 0.371881545f},
-std::array<float,2>{0.873349667f, 0.547380328f},
-std::array<float,2>{0.306441694f, 0.745554805f},
-std::array<float,2>{0.894997299f, 0.380374938f},
-std::array<float,2>{0.0110617159f, 0.0839089081f},
-std::array<float,2>{0.595487654f, 0.840981364f},
-std::array<float,2>{0.12498454f, 0.614530146f},
-std::array<float,2>{0.537704885f, 0.269633293f},
-std::array<float,2>{0.331482112f, 0.172668502f},
-std::array<float,2>{0.966154754f, 0.945663095f},
-std::array<float,2>{0.394798785f, 0.767019629f},
-std::array<float,2>{0.780976355f, 0.0608353466f},
-std::array<float,2>{0.128753856f, 0.445678681f},
-std::array<float,2>{0.664136171f, 0.629125535f},
-std::array<float,2>{0.0863506123f, 0.954047501f},
-std::array<float,2>{0.502863348f, 0.165633619f},
-std::array<float,2>{0.369947493f, 0.253942221f},
-std::array<float,2>{0.973726273f, 0.607990444f},
-std::array<float,2>{0.426835328f, 0.653717995f},
-std::array<float,2>{0.797272027f, 0.467339247f},
-std::array<float,2>{0.166843355f, 0.046863541f},
-std::array<float,2>{0.638045132f, 0.753505707f},
-std::array<float,2>{0.200697869f, 0.542314112f},
-std::array<float,2>{0.729005337f, 0.349459141f},
-std::array<float,2>{0.460717708f, 0.240045607f},
-std::array<float,2>{0.833046019f, 0.88080883f},
-std::array<float,2>{0.271285266f, 0.820954323f},
-std::array<float,2>{0.914964795f, 0.0701246709f},
-std::array<float,2>{0.0470899567f, 0.394351095f},
-std::array<float,2>{0.590794861f, 0.726918638f},
-std::array<float,2>{0.14221254f, 0.807314277f},
-std::array<float,2>{0.674587607f, 0.0108189303f},
-std::array<float,2>{0.383820355f, 0.471467882f},
-std::array<float,2>{0.754825175f, 0.682025135f},
-std::array<float,2>{0.317472875f, 0.582221985f},
-std::array<float,2>{0.949293196f, 0.288769156f},
-std::array<float,2>{0.103962258f, 0.148489058f},
-std::array<float,2>{0.548798263f, 0.969811499f},
-std::array<float,2>{0.0291967876f, 0.705186486f},
-std::array<float,2>{0.611916065f, 0.411491126f},
-std::array<float,2>{0.28801468f, 0.102049224f},
-std::array<float,2>{0.877820492f, 0.870044172f},
-std::array<float,2>{0.476979613f, 0.914845884f},
-std::array<float,2>{0.850754976f, 0.214532673f},
-std::array<float,2>{0.248651072f, 0.312893301f},
-std::array<float,2>{0.699031174f, 0.524403751f},
-std::array<float,2>{0.0988305733f, 0.763421357f},
-std::array<float,2>{0.561108887f, 0.0325865485f},
-std::array<float,2>{0.323738277f, 0.460523844f},
-std::array<float,2>{0.943432271f, 0.640641809f},
-std::array<float,2>{0.380211383f, 0.599362791f},
-std::array<float,2>{0.761125147f, 0.261111975f},
-std::array<float,2>{0.153433993f, 0.156816334f},
-std::array<float,2>{0.687430739f, 0.965131879f},
-std::array<float,2>{0.237068757f, 0.722716331f},
-std::array<float,2>{0.690597355f, 0.404326797f},
-std::array<float,2>{0.472369164f, 0.0711003914f},
-std::array<float,2>{0.853676915f, 0.813394666f},
-std::array<float,2>{0.291905493f, 0.887203991f},
-std::array<float,2>{0.883813918f, 0.245022699f},
-std::array<float,2>{0.0204169136f, 0.357272208f},
-std::array<float,2>{0.618095934f, 0.535698414f},
-std::array<float,2>{0.156838208f, 0.981380522f},
-std::array<float,2>{0.625615716f, 0.144685641f},
-std::array<float,2>{0.437054455f, 0.294291586f},
-std::array<float,2>{0.812206507f, 0.593008339f},
-std::array<float,2>{0.367116481f, 0.674080849f},
-std::array<float,2>{0.980198622f, 0.480360121f},
-std::array<float,2>{0.0835432187f, 0.00369420811f},
-std::array<float,2>{0.513013124f, 0.799196243f},
-std::array<float,2>{0.0614757463f, 0.517785847f},
-std::array<float,2>{0.578226447f, 0.321644694f},
-std::array<float,2>{0.279535592f, 0.20315364f},
-std::array<float,2>{0.909285426f, 0.9107216f},
-std::array<float,2>{0.468402803f, 0.866972446f},
-std::array<float,2>{0.838650465f, 0.0996585712f},
-std::array<float,2>{0.18880266f, 0.416683286f},
-std::array<float,2>{0.724011958f, 0.717667818f},
-std::array<float,2>{0.00331674935f, 0.937257588f},
-std::array<float,2>{0.608580232f, 0.202062935f},
-std::array<float,2>{0.297333807f, 0.332792014f},
-std::array<float,2>{0.899597526f, 0.503353477f},
-std::array<float,2>{0.493407637f, 0.697168589f},
-std::array<float,2>{0.860648572f, 0.428266436f},
-std::array<float,2>{0.225108668f, 0.111156799f},
-std::array<float,2>{0.717109501f, 0.853181005f},
-std::array<float,2>{0.133833379f, 0.564525843f},
-std::array<float,2>{0.662780166f, 0.29703325f},
-std::array<float,2>{0.402334005f, 0.129269794f},
-std::array<float,2>{0.770150781f, 0.98822701f},
-std::array<float,2>{0.339574069f, 0.783702374f},
-std::array<float,2>{0.959545374f, 0.0190954749f},
-std::array<float,2>{0.109608583f, 0.488957763f},
-std::array<float,2>{0.539880693f, 0.666181445f},
-std::array<float,2>{0.206596509f, 0.831885993f},
-std::array<float,2>{0.736490428f, 0.0863837078f},
-std::array<float,2>{0.439959198f, 0.389049292f},
-std::array<float,2>{0.813640714f, 0.740821719f},
-std::array<float,2>{0.260968119f, 0.558526158f},
-std::array<float,2>{0.93058753f, 0.365895659f},
-std::array<float,2>{0.0423414633f, 0.231738165f},
-std::array<float,2>{0.577177227f, 0.897361636f},
-std::array<float,2>{0.0736819655f, 0.636931241f},
-std::array<float,2>{0.52165401f, 0.439162195f},
-std::array<float,2>{0.352350503f, 0.0540227257f},
-std::array<float,2>{0.993967831f, 0.778878152f},
-std::array<float,2>{0.409808576f, 0.945119262f},
-std::array<float,2>{0.782041669f, 0.185496777f},
-std::array<float,2>{0.177397653f, 0.274638236f},
-std::array<float,2>{0.648969412f, 0.624363601f},
-std::array<float,2>{0.108055577f, 0.832372963f},
-std::array<float,2>{0.554356635f, 0.0919133127f},
-std::array<float,2>{0.313845307f, 0.384135574f},
-std::array<float,2>{0.946110904f, 0.737138689f},
-std::array<float,2>{0.387449563f, 0.559936702f},
-std::array<float,2>{0.751184165f, 0.359421879f},
-std::array<float,2>{0.144541338f, 0.226649448f},
-std::array<float,2>{0.677025855f, 0.892792284f},
-std::array<float,2>{0.244111419f, 0.636633217f},
-std::array<float,2>{0.70006758f, 0.444480419f},
-std::array<float,2>{0.484157264f, 0.0478892624f},
-std::array<float,2>{0.844314814f, 0.775214195f},
-std::array<float,2>{0.281849086f, 0.938441873f},
-std::array<float,2>{0.878958941f, 0.1819565f},
-std::array<float,2>{0.0271229185f, 0.280673116f},
-std::array<float,2>{0.615306377f, 0.617859483f},
-std::array<float,2>{0.168031529f, 0.932277799f},
-std::array<float,2>{0.633258045f, 0.196584806f},
-std::array<float,2>{0.425685287f, 0.330264449f},
-std::array<float,2>{0.802924216f, 0.506066024f},
-std::array<float,2>{0.374558926f, 0.702379644f},
-std::array<float,2>{0.9687621f, 0.424740583f},
-std::array<float,2>{0.0924547166f, 0.115369052f},
-std::array<float,2>{0.505478799f, 0.857272744f},
-std::array<float,2>{0.0528212525f, 0.567721248f},
-std::array<float,2>{0.587363601f, 0.300912321f},
-std::array<float,2>{0.268099099f, 0.128360137f},
-std::array<float,2>{0.919725716f, 0.989063561f},
-std::array<float,2>{0.455551833f, 0.788718164f},
-std::array<float,2>{0.832010627f, 0.0216879547f},
-std::array<float,2>{0.198788285f, 0.48572129f},
-std::array<float,2>{0.730908036f, 0.670983315f},
-std::array<float,2>{0.0130550293f, 0.980159819f},
-std::array<float,2>{0.59772861f, 0.141361445f},
-std::array<float,2>{0.309865713f, 0.289165139f},
-std::array<float,2>{0.891978383f, 0.588663638f},
-std::array<float,2>{0.489757389f, 0.67922312f},
-std::array<float,2>{0.868178308f, 0.482928604f},
-std::array<float,2>{0.230759293f, 0.0069320607f},
-std::array<float,2>{0.709934235f, 0.804648876f},
-std::array<float,2>{0.13261731f, 0.523089647f},
-std::array<float,2>{0.669365585f, 0.325569153f},
-std::array<float,2>{0.393898249f, 0.208107769f},
-std::array<float,2>{0.776388347f, 0.90811336f},
-std::array<float,2>{0.332601726f, 0.862396955f},
-std::array<float,2>{0.962756395f, 0.0941374451f},
-std::array<float,2>{0.118425682f, 0.420458645f},
-std::array<float,2>{0.532756388f, 0.711959362f},
-std::array<float,2>{0.217602506f, 0.7578336f},
-std::array<float,2>{0.748462141f, 0.036739286f},
-std::array<float,2>{0.452640444f, 0.454821885f},
-std::array<float,2>{0.826495707f, 0.648352563f},
-std::array<float,2>{0.251655042f, 0.594419479f},
-std::array<float,2>{0.923911452f, 0.264720649f},
-std::array<float,2>{0.0326375626f, 0.161834061f},
-std::array<float,2>{0.566414893f, 0.963169336f},
-std::array<float,2>{0.0678599179f, 0.721302211f},
-std::array<float,2>{0.52970773f, 0.40190497f},
-std::array<float,2>{0.350479752f, 0.0774326324f},
-std::array<float,2>{0.990849435f, 0.819773018f},
-std::array<float,2>{0.421147346f, 0.885413289f},
-std::array<float,2>{0.795876205f, 0.24716869f},
-std::array<float,2>{0.186541751f, 0.354612291f},
-std::array<float,2>{0.643509388f, 0.531806469f},
-std::array<float,2>{0.0443017073f, 0.810162008f},
-std::array<float,2>{0.571681142f, 0.0143341161f},
-std::array<float,2>{0.265185803f, 0.474580646f},
-std::array<float,2>{0.935976863f, 0.687154651f},
-std::array<float,2>{0.444549888f, 0.581367016f},
-std::array<float,2>{0.820010185f, 0.283466488f},
-std::array<float,2>{0.210792959f, 0.15542303f},
-std::array<float,2>{0.741705298f, 0.976369858f},
-std::array<float,2>{0.17213881f, 0.707561851f},
-std::array<float,2>{0.652654946f, 0.406483293f},
-std::array<float,2>{0.411022842f, 0.106749006f},
-std::array<float,2>{0.78540647f, 0.871235609f},
-std::array<float,2>{0.356256425f, 0.918159187f},
-std::array<float,2>{0.998533666f, 0.215792611f},
-std::array<float,2>{0.0749457553f, 0.318390429f},
-std::array<float,2>{0.516379952f, 0.52809763f},
-std::array<float,2>{0.221921235f, 0.95726788f},
-std::array<float,2>{0.711837888f, 0.170985907f},
-std::array<float,2>{0.499778062f, 0.250756413f},
-std::array<float,2>{0.863945544f, 0.602336884f},
-std::array<float,2>{0.302946001f, 0.648958802f},
-std::array<float,2>{0.90470016f, 0.463301033f},
-std::array<float,2>{0.00664491998f, 0.0398306288f},
-std::array<float,2>{0.604042947f, 0.754321337f},
-std::array<float,2>{0.114805587f, 0.543625295f},
-std::array<float,2>{0.543839931f, 0.346298337f},
-std::array<float,2>{0.34269163f, 0.237346798f},
-std::array<float,2>{0.954370975f, 0.87818265f},
-std::array<float,2>{0.405176878f, 0.827127099f},
-std::array<float,2>{0.768346965f, 0.0662682354f},
-std::array<float,2>{0.137786403f, 0.397359669f},
-std::array<float,2>{0.656260908f, 0.734359443f},
-std::array<float,2>{0.0806134418f, 0.899004638f},
-std::array<float,2>{0.510025799f, 0.219002068f},
-std::array<float,2>{0.363204867f, 0.369824529f},
-std::array<float,2>{0.98350203f, 0.55399847f},
-std::array<float,2>{0.432923347f, 0.74991411f},
-std::array<float,2>{0.80524987f, 0.378706455f},
-std::array<float,2>{0.160736769f, 0.0787931085f},
-std::array<float,2>{0.630535305f, 0.837299168f},
-std::array<float,2>{0.193870738f, 0.611181915f},
-std::array<float,2>{0.720796168f, 0.265998125f},
-std::array<float,2>{0.461715192f, 0.177258208f},
-std::array<float,2>{0.840278089f, 0.950165749f},
-std::array<float,2>{0.274282932f, 0.769705117f},
-std::array<float,2>{0.911478996f, 0.0576725602f},
-std::array<float,2>{0.0560032651f, 0.451361656f},
-std::array<float,2>{0.583402157f, 0.625962377f},
-std::array<float,2>{0.14945659f, 0.84916997f},
-std::array<float,2>{0.683238447f, 0.12044806f},
-std::array<float,2>{0.376971781f, 0.437358677f},
-std::array<float,2>{0.764900088f, 0.689102829f},
-std::array<float,2>{0.324652076f, 0.512382805f},
-std::array<float,2>{0.939634442f, 0.337016791f},
-std::array<float,2>{0.0966760889f, 0.193104371f},
-std::array<float,2>{0.556274593f, 0.924358785f},
-std::array<float,2>{0.0182885136f, 0.663438499f},
-std::array<float,2>{0.622933149f, 0.4952811f},
-std::array<float,2>{0.29673928f, 0.0241338369f},
-std::array<float,2>{0.889365375f, 0.792766809f},
-std::array<float,2>{0.474598527f, 0.997225821f},
-std::array<float,2>{0.855942965f, 0.139150262f},
-std::array<float,2>{0.240210757f, 0.306568831f},
-std::array<float,2>{0.692510724f, 0.57260561f},
-std::array<float,2>{0.0294283554f, 0.870318115f},
-std::array<float,2>{0.610059261f, 0.103018589f},
-std::array<float,2>{0.286801726f, 0.410849661f},
-std::array<float,2>{0.876738429f, 0.706602693f},
-std::array<float,2>{0.479364008f, 0.525062859f},
-std::array<float,2>{0.84956789f, 0.313590974f},
-std::array<float,2>{0.247075707f, 0.213674977f},
-std::array<float,2>{0.696807563f, 0.915129304f},
-std::array<float,2>{0.143651679f, 0.683394611f},
-std::array<float,2>{0.673459351f, 0.472491443f},
-std::array<float,2>{0.386202991f, 0.0100223878f},
-std::array<float,2>{0.756825626f, 0.807667017f},
-std::array<float,2>{0.318538755f, 0.96929276f},
-std::array<float,2>{0.952171862f, 0.150151357f},
-std::array<float,2>{0.103156865f, 0.287718683f},
-std::array<float,2>{0.549561501f, 0.583800077f},
-std::array<float,2>{0.201609135f, 0.879355907f},
-std::array<float,2>{0.727294326f, 0.23911801f},
-std::array<float,2>{0.458163947f, 0.348224491f},
-std::array<float,2>{0.834904253f, 0.541527689f},
-std::array<float,2>{0.272043586f, 0.727540076f},
-std::array<float,2>{0.916618347f, 0.392980099f},
-std::array<float,2>{0.0494091846f, 0.0684327334f},
-std::array<float,2>{0.592052758f, 0.821611941f},
-std::array<float,2>{0.0891374946f, 0.609273136f},
-std::array<float,2>{0.501811504f, 0.255839527f},
-std::array<float,2>{0.368520766f, 0.164928138f},
-std::array<float,2>{0.976117671f, 0.955055416f},
-std::array<float,2>{0.428878009f, 0.752908349f},
-std::array<float,2>{0.800434053f, 0.045307979f},
-std::array<float,2>{0.164145038f, 0.468255967f},
-std::array<float,2>{0.639538407f, 0.652810097f},
-std::array<float,2>{0.122180492f, 0.946384668f},
-std::array<float,2>{0.536160409f, 0.172963753f},
-std::array<float,2>{0.328814656f, 0.271425545f},
-std::array<float,2>{0.96867913f, 0.613348484f},
-std::array<float,2>{0.398329705f, 0.630754411f},
-std::array<float,2>{0.778734744f, 0.44692409f},
-std::array<float,2>{0.125368804f, 0.0617363416f},
-std::array<float,2>{0.666760027f, 0.766475201f},
-std::array<float,2>{0.228776187f, 0.548370838f},
-std::array<float,2>{0.704241872f, 0.372209698f},
-std::array<float,2>{0.485732615f, 0.225717068f},
-std::array<float,2>{0.871627331f, 0.904630899f},
-std::array<float,2>{0.308417946f, 0.840072036f},
-std::array<float,2>{0.897886038f, 0.0825525075f},
-std::array<float,2>{0.00931585021f, 0.379204959f},
-std::array<float,2>{0.597090006f, 0.744739652f},
-std::array<float,2>{0.181065753f, 0.796446025f},
-std::array<float,2>{0.646083772f, 0.0302074961f},
-std::array<float,2>{0.415960133f, 0.4990803f},
-std::array<float,2>{0.790429473f, 0.658461511f},
-std::array<float,2>{0.344789952f, 0.577381134f},
-std::array<float,2>{0.987819016f, 0.309140593f},
-std::array<float,2>{0.0654054955f, 0.132964954f},
-std::array<float,2>{0.526716948f, 0.995977879f},
-std::array<float,2>{0.0368853025f, 0.692994833f},
-std::array<float,2>{0.565966666f, 0.433441639f},
-std::array<float,2>{0.25448218f, 0.122326344f},
-std::array<float,2>{0.928764701f, 0.844424665f},
-std::array<float,2>{0.446998388f, 0.927038968f},
-std::array<float,2>{0.820488513f, 0.188908845f},
-std::array<float,2>{0.213397846f, 0.342458844f},
-std::array<float,2>{0.744165897f, 0.510210514f},
-std::array<float,2>{0.0707738101f, 0.777875721f},
-std::array<float,2>{0.519644737f, 0.0530168712f},
-std::array<float,2>{0.353738666f, 0.438256204f},
-std::array<float,2>{0.995929301f, 0.638566852f},
-std::array<float,2>{0.407896936f, 0.623577237f},
-std::array<float,2>{0.784654498f, 0.273800075f},
-std::array<float,2>{0.178707749f, 0.184390843f},
-std::array<float,2>{0.650497735f, 0.943995655f},
-std::array<float,2>{0.204605222f, 0.74171108f},
-std::array<float,2>{0.735818565f, 0.389926821f},
-std::array<float,2>{0.438083827f, 0.0870801061f},
-std::array<float,2>{0.815768182f, 0.830216885f},
-std::array<float,2>{0.258520842f, 0.898227394f},
-std::array<float,2>{0.933109164f, 0.231254384f},
-std::array<float,2>{0.0398553684f, 0.366409779f},
-std::array<float,2>{0.574956357f, 0.556778312f},
-std::array<float,2>{0.135601938f, 0.986856163f},
-std::array<float,2>{0.660596073f, 0.130703479f},
-std::array<float,2>{0.398928821f, 0.298251569f},
-std::array<float,2>{0.772494376f, 0.565972269f},
-std::array<float,2>{0.336282879f, 0.667464077f},
-std::array<float,2>{0.958204746f, 0.489420891f},
-std::array<float,2>{0.113118015f, 0.0182182901f},
-std::array<float,2>{0.542484343f, 0.785019755f},
-std::array<float,2>{0.00147382077f, 0.502157569f},
-std::array<float,2>{0.606854141f, 0.333427608f},
-std::array<float,2>{0.3004511f, 0.202817142f},
-std::array<float,2>{0.900913f, 0.936004341f},
-std::array<float,2>{0.494767576f, 0.851801813f},
-std::array<float,2>{0.861999393f, 0.109795511f},
-std::array<float,2>{0.222743616f, 0.428935587f},
-std::array<float,2>{0.715736568f, 0.695901334f},
-std::array<float,2>{0.058855895f, 0.911782801f},
-std::array<float,2>{0.581586361f, 0.204523355f},
-std::array<float,2>{0.278577954f, 0.320920765f},
-std::array<float,2>{0.907170773f, 0.518716633f},
-std::array<float,2>{0.46569705f, 0.718686759f},
-std::array<float,2>{0.837721884f, 0.417434663f},
-std::array<float,2>{0.18978405f, 0.100661986f},
-std::array<float,2>{0.726054251f, 0.866006792f},
-std::array<float,2>{0.158860922f, 0.592586517f},
-std::array<float,2>{0.627216339f, 0.293102711f},
-std::array<float,2>{0.434260458f, 0.146139726f},
-std::array<float,2>{0.808600128f, 0.982068419f},
-std::array<float,2>{0.364334464f, 0.800597787f},
-std::array<float,2>{0.976720035f, 0.00220573135f},
-std::array<float,2>{0.085495621f, 0.478574961f},
-std::array<float,2>{0.515028417f, 0.675182581f},
-std::array<float,2>{0.236044779f, 0.814044654f},
-std::array<float,2>{0.689201176f, 0.0713567659f},
-std::array<float,2>{0.469676405f, 0.406087816f},
-std::array<float,2>{0.851724684f, 0.72438693f},
-std::array<float,2>{0.290914983f, 0.536664307f},
-std::array<float,2>{0.88617599f, 0.355994672f},
-std::array<float,2>{0.02210843f, 0.246006519f},
-std::array<float,2>{0.619989216f, 0.888605773f},
-std::array<float,2>{0.100335062f, 0.641888022f},
-std::array<float,2>{0.559931278f, 0.459911644f},
-std::array<float,2>{0.321389645f, 0.0320271626f},
-std::array<float,2>{0.942185938f, 0.762370586f},
-std::array<float,2>{0.380862206f, 0.966473699f},
-std::array<float,2>{0.758384526f, 0.157715991f},
-std::array<float,2>{0.155719802f, 0.260610491f},
-std::array<float,2>{0.68540895f, 0.598315418f},
-std::array<float,2>{0.0913696289f, 0.859022379f},
-std::array<float,2>{0.50747633f, 0.114195183f},
-std::array<float,2>{0.371216387f, 0.423717737f},
-std::array<float,2>{0.970963538f, 0.700051427f},
-std::array<float,2>{0.422277182f, 0.503982604f},
-std::array<float,2>{0.801893473f, 0.328840584f},
-std::array<float,2>{0.171454817f, 0.198887452f},
-std::array<float,2>{0.635644913f, 0.931575835f},
-std::array<float,2>{0.197213873f, 0.668105006f},
-std::array<float,2>{0.734208286f, 0.487726599f},
-std::array<float,2>{0.454039544f, 0.0203683209f},
-std::array<float,2>{0.828271031f, 0.785791457f},
-std::array<float,2>{0.266646862f, 0.990369916f},
-std::array<float,2>{0.921402156f, 0.126671925f},
-std::array<float,2>{0.0518032834f, 0.3034302f},
-std::array<float,2>{0.588100791f, 0.56933713f},
-std::array<float,2>{0.146901891f, 0.89169395f},
-std::array<float,2>{0.678469002f, 0.229245946f},
-std::array<float,2>{0.389751136f, 0.362611324f},
-std::array<float,2>{0.752081811f, 0.560985982f},
-std::array<float,2>{0.314757496f, 0.734929681f},
-std::array<float,2>{0.948887348f, 0.385018855f},
-std::array<float,2>{0.107153088f, 0.0913008004f},
-std::array<float,2>{0.551937342f, 0.835359275f},
-std::array<float,2>{0.0238467231f, 0.619311631f},
-std::array<float,2>{0.613786459f, 0.279023737f},
-std::array<float,2>{0.284501314f, 0.181141436f},
-std::array<float,2>{0.882741451f, 0.940713286f},
-std::array<float,2>{0.481743902f, 0.776959896f},
-std::array<float,2>{0.846869707f, 0.0495672673f},
-std::array<float,2>{0.244865686f, 0.442030549f},
-std::array<float,2>{0.702813685f, 0.632994413f},
-std::array<float,2>{0.0344879292f, 0.961670041f},
-std::array<float,2>{0.569276392f, 0.163592562f},
-std::array<float,2>{0.253202856f, 0.263667136f},
-std::array<float,2>{0.921948493f, 0.597007453f},
-std::array<float,2>{0.449766219f, 0.645132303f},
-std::array<float,2>{0.824816585f, 0.456354767f},
-std::array<float,2>{0.215321705f, 0.0384491757f},
-std::array<float,2>{0.74739784f, 0.760841787f},
-std::array<float,2>{0.184802383f, 0.533527374f},
-std::array<float,2>{0.642560184f, 0.353333592f},
-std::array<float,2>{0.419140041f, 0.249558017f},
-std::array<float,2>{0.793435931f, 0.883999705f},
-std::array<float,2>{0.349542052f, 0.818285644f},
-std::array<float,2>{0.988316119f, 0.0747365281f},
-std::array<float,2>{0.0692708865f, 0.399540305f},
-std::array<float,2>{0.528432846f, 0.719039142f},
-std::array<float,2>{0.233955264f, 0.801876009f},
-std::array<float,2>{0.708242655f, 0.00439830031f},
-std::array<float,2>{0.491743207f, 0.481923103f},
-std::array<float,2>{0.869797468f, 0.677702129f},
-std::array<float,2>{0.311186999f, 0.586524963f},
-std::array<float,2>{0.892763972f, 0.291871965f},
-std::array<float,2>{0.0144506209f, 0.143285871f},
-std::array<float,2>{0.60011524f, 0.977449238f},
-std::array<float,2>{0.120410144f, 0.713210762f},
-std::array<float,2>{0.533887088f, 0.419586778f},
-std::array<float,2>{0.334439039f, 0.0969341546f},
-std::array<float,2>{0.963862062f, 0.861311078f},
-std::array<float,2>{0.39132309f, 0.908573806f},
-std::array<float,2>{0.77380228f, 0.209357619f},
-std::array<float,2>{0.129783422f, 0.327174723f},
-std::array<float,2>{0.671531618f, 0.519906938f},
-std::array<float,2>{0.00464423141f, 0.757566571f},
-std::array<float,2>{0.602921009f, 0.0419807695f},
-std::array<float,2>{0.301213384f, 0.462247193f},
-std::array<float,2>{0.903796017f, 0.650406778f},
-std::array<float,2>{0.496795923f, 0.604351521f},
-std::array<float,2>{0.866390169f, 0.253179282f},
-std::array<float,2>{0.220216304f, 0.168790609f},
-std::array<float,2>{0.714323938f, 0.959413826f},
-std::array<float,2>{0.139293641f, 0.732036829f},
-std::array<float,2>{0.658253312f, 0.39519918f},
-std::array<float,2>{0.402919143f, 0.0635055527f},
-std::array<float,2>{0.766682625f, 0.825388432f},
-std::array<float,2>{0.341214776f, 0.875937223f},
-std::array<float,2>{0.95547688f, 0.235079989f},
-std::array<float,2>{0.115349829f, 0.345494151f},
-std::array<float,2>{0.545674264f, 0.545629561f},
-std::array<float,2>{0.207581535f, 0.972739518f},
-std::array<float,2>{0.73949033f, 0.153010696f},
-std::array<float,2>{0.442795694f, 0.282777965f},
-std::array<float,2>{0.81808722f, 0.58005029f},
-std::array<float,2>{0.262587637f, 0.685077906f},
-std::array<float,2>{0.935180724f, 0.476439595f},
-std::array<float,2>{0.0451053008f, 0.0135295941f},
-std::array<float,2>{0.574046433f, 0.810878992f},
-std::array<float,2>{0.0780962184f, 0.530986369f},
-std::array<float,2>{0.519214869f, 0.317331851f},
-std::array<float,2>{0.358116478f, 0.217111185f},
-std::array<float,2>{0.997110426f, 0.920017898f},
-std::array<float,2>{0.413462549f, 0.873093545f},
-std::array<float,2>{0.788934708f, 0.108753309f},
-std::array<float,2>{0.174761191f, 0.410128951f},
-std::array<float,2>{0.654779613f, 0.71064651f},
-std::array<float,2>{0.0956138f, 0.923049867f},
-std::array<float,2>{0.557392776f, 0.194649488f},
-std::array<float,2>{0.328100115f, 0.339610487f},
-std::array<float,2>{0.938221633f, 0.514769971f},
-std::array<float,2>{0.376702756f, 0.690713108f},
-std::array<float,2>{0.762904704f, 0.433971435f},
-std::array<float,2>{0.152065143f, 0.11762704f},
-std::array<float,2>{0.680446148f, 0.850781381f},
-std::array<float,2>{0.240431637f, 0.571713984f},
-std::array<float,2>{0.695211291f, 0.30730173f},
-std::array<float,2>{0.474615514f, 0.138370544f},
-std::array<float,2>{0.858632863f, 0.99908185f},
-std::array<float,2>{0.293305248f, 0.789281607f},
-std::array<float,2>{0.888306737f, 0.0255845618f},
-std::array<float,2>{0.0171940885f, 0.494009107f},
-std::array<float,2>{0.624312699f, 0.660320461f},
-std::array<float,2>{0.163987637f, 0.838918984f},
-std::array<float,2>{0.632055879f, 0.0808921456f},
-std::array<float,2>{0.430473983f, 0.375546455f},
-std::array<float,2>{0.807172596f, 0.747850716f},
-std::array<float,2>{0.361266315f, 0.550891876f},
-std::array<float,2>{0.980603516f, 0.368145972f},
-std::array<float,2>{0.0792128369f, 0.221898288f},
-std::array<float,2>{0.508835554f, 0.901638448f},
-std::array<float,2>{0.0582180806f, 0.627827406f},
-std::array<float,2>{0.585936785f, 0.450677931f},
-std::array<float,2>{0.276918441f, 0.0565832704f},
-std::array<float,2>{0.913794994f, 0.772497952f},
-std::array<float,2>{0.463783354f, 0.952786744f},
-std::array<float,2>{0.842727065f, 0.178888351f},
-std::array<float,2>{0.192439601f, 0.267944217f},
-std::array<float,2>{0.719878972f, 0.61315769f},
-std::array<float,2>{0.0486856215f, 0.823248386f},
-std::array<float,2>{0.591008782f, 0.0682330281f},
-std::array<float,2>{0.270488292f, 0.392526358f},
-std::array<float,2>{0.915793657f, 0.728574634f},
-std::array<float,2>{0.459107131f, 0.539858401f},
-std::array<float,2>{0.832649589f, 0.35009709f},
-std::array<float,2>{0.199843541f, 0.240401655f},
-std::array<float,2>{0.73014468f, 0.882417142f},
-std::array<float,2>{0.167349234f, 0.65465349f},
-std::array<float,2>{0.637634158f, 0.466383874f},
-std::array<float,2>{0.426345706f, 0.0442267284f},
-std::array<float,2>{0.797990918f, 0.751038432f},
-std::array<float,2>{0.370332062f, 0.955755055f},
-std::array<float,2>{0.972694337f, 0.166816801f},
-std::array<float,2>{0.0870971233f, 0.257278264f},
-std::array<float,2>{0.503271818f, 0.606374085f},
-std::array<float,2>{0.249790013f, 0.917369902f},
-std::array<float,2>{0.697713315f, 0.212419882f},
-std::array<float,2>{0.478457093f, 0.315255702f},
-std::array<float,2>{0.850388288f, 0.526556253f},
-std::array<float,2>{0.288499087f, 0.704647064f},
-std::array<float,2>{0.878858507f, 0.412393123f},
-std::array<float,2>{0.0282703675f, 0.105112903f},
-std::array<float,2>{0.612606287f, 0.868942797f},
-std::array<float,2>{0.105112843f, 0.584762156f},
-std::array<float,2>{0.547470927f, 0.286851734f},
-std::array<float,2>{0.317106664f, 0.151601538f},
-std::array<float,2>{0.95081073f, 0.971877337f},
-std::array<float,2>{0.383524865f, 0.805571556f},
-std::array<float,2>{0.755814075f, 0.00908199791f},
-std::array<float,2>{0.140948966f, 0.469117314f},
-std::array<float,2>{0.675394893f, 0.68009907f},
-std::array<float,2>{0.0629634559f, 0.992438138f},
-std::array<float,2>{0.52391088f, 0.136060551f},
-std::array<float,2>{0.347398221f, 0.312018543f},
-std::array<float,2>{0.985111415f, 0.57561475f},
-std::array<float,2>{0.416378498f, 0.657819688f},
-std::array<float,2>{0.791273654f, 0.496850669f},
-std::array<float,2>{0.181766987f, 0.0274830181f},
-std::array<float,2>{0.646711528f, 0.793518662f},
-std::array<float,2>{0.212310731f, 0.508375943f},
-std::array<float,2>{0.74257797f, 0.341683f},
-std::array<float,2>{0.448190004f, 0.189542696f},
-std::array<float,2>{0.823862195f, 0.929499507f},
-std::array<float,2>{0.257799506f, 0.847647667f},
-std::array<float,2>{0.927658379f, 0.124554165f},
-std::array<float,2>{0.0376962461f, 0.430236518f},
-std::array<float,2>{0.562543392f, 0.694349885f},
-std::array<float,2>{0.127247706f, 0.769274116f},
-std::array<float,2>{0.665625632f, 0.0597431473f},
-std::array<float,2>{0.396326691f, 0.448554277f},
-std::array<float,2>{0.779624045f, 0.630884707f},
-std::array<float,2>{0.33055228f, 0.615299642f},
-std::array<float,2>{0.965560794f, 0.273061395f},
-std::array<float,2>{0.123365805f, 0.174240053f},
-std::array<float,2>{0.538989067f, 0.948817313f},
-std::array<float,2>{0.0105458358f, 0.743652701f},
-std::array<float,2>{0.594427049f, 0.381087244f},
-std::array<float,2>{0.304954112f, 0.0850494206f},
-std::array<float,2>{0.895525873f, 0.843714356f},
-std::array<float,2>{0.488246888f, 0.904245973f},
-std::array<float,2>{0.874519467f, 0.223168015f},
-std::array<float,2>{0.227428362f, 0.37387687f},
-std::array<float,2>{0.706707239f, 0.550258517f},
-std::array<float,2>{0.111184083f, 0.782988906f},
-std::array<float,2>{0.540726185f, 0.0166686364f},
-std::array<float,2>{0.337905198f, 0.490686297f},
-std::array<float,2>{0.960130692f, 0.665388823f},
-std::array<float,2>{0.400853038f, 0.56406945f},
-std::array<float,2>{0.770547807f, 0.300113708f},
-std::array<float,2>{0.133648977f, 0.131907403f},
-std::array<float,2>{0.663891196f, 0.984884024f},
-std::array<float,2>{0.226406589f, 0.698663533f},
-std::array<float,2>{0.718313336f, 0.426715106f},
-std::array<float,2>{0.492290646f, 0.112205833f},
-std::array<float,2>{0.859764993f, 0.854177117f},
-std::array<float,2>{0.29798758f, 0.934791028f},
-std::array<float,2>{0.89851892f, 0.19976747f},
-std::array<float,2>{0.00199603196f, 0.334876686f},
-std::array<float,2>{0.607764423f, 0.500203788f},
-std::array<float,2>{0.175896958f, 0.94291091f},
-std::array<float,2>{0.649425089f, 0.185953736f},
-std::array<float,2>{0.408284336f, 0.276479155f},
-std::array<float,2>{0.782885075f, 0.622444451f},
-std::array<float,2>{0.352781594f, 0.640416205f},
-std::array<float,2>{0.992689013f, 0.439932495f},
-std::array<float,2>{0.0722993836f, 0.0521902665f},
-std::array<float,2>{0.522683978f, 0.779464543f},
-std::array<float,2>{0.0411203206f, 0.555557489f},
-std::array<float,2>{0.576714814f, 0.364224195f},
-std::array<float,2>{0.260033309f, 0.233573034f},
-std::array<float,2>{0.931091428f, 0.894994438f},
-std::array<float,2>{0.440588355f, 0.82965523f},
-std::array<float,2>{0.812924862f, 0.0880967826f},
-std::array<float,2>{0.205246255f, 0.386919975f},
-std::array<float,2>{0.738218784f, 0.738558829f},
-std::array<float,2>{0.0211710762f, 0.889909983f},
-std::array<float,2>{0.618667305f, 0.242716864f},
-std::array<float,2>{0.292122424f, 0.358932763f},
-std::array<float,2>{0.883650124f, 0.53806591f},
-std::array<float,2>{0.471332729f, 0.726118386f},
-std::array<float,2>{0.855180681f, 0.403438002f},
-std::array<float,2>{0.238039151f, 0.0728277639f},
-std::array<float,2>{0.689665496f, 0.814909875f},
-std::array<float,2>{0.152443811f, 0.600106239f},
-std::array<float,2>{0.686177492f, 0.25868541f},
-std::array<float,2>{0.379121959f, 0.160143316f},
-std::array<float,2>{0.759885013f, 0.967349946f},
-std::array<float,2>{0.322548807f, 0.763848722f},
-std::array<float,2>{0.944380403f, 0.0345833227f},
-std::array<float,2>{0.0979226679f, 0.45807603f},
-std::array<float,2>{0.562369466f, 0.644445002f},
-std::array<float,2>{0.187684327f, 0.863936067f},
-std::array<float,2>{0.723246217f, 0.0990703776f},
-std::array<float,2>{0.467356026f, 0.414591163f},
-std::array<float,2>{0.839169264f, 0.71663481f},
-std::array<float,2>{0.280288905f, 0.516379237f},
-std::array<float,2>{0.908947527f, 0.322365195f},
-std::array<float,2>{0.0622106157f, 0.207013205f},
-std::array<float,2>{0.579540551f, 0.912422299f},
-std::array<float,2>{0.0825344622f, 0.672642827f},
-std::array<float,2>{0.512585759f, 0.47794044f},
-std::array<float,2>{0.365646988f, 0.00188830274f},
-std::array<float,2>{0.978900552f, 0.79713136f},
-std::array<float,2>{0.435931206f, 0.983366668f},
-std::array<float,2>{0.811481893f, 0.148216829f},
-std::array<float,2>{0.157771215f, 0.295377702f},
-std::array<float,2>{0.626556695f, 0.591361463f},
-std::array<float,2>{0.0959720388f, 0.851106584f},
-std::array<float,2>{0.555868387f, 0.117742285f},
-std::array<float,2>{0.324938685f, 0.434250385f},
-std::array<float,2>{0.940144658f, 0.691345513f},
-std::array<float,2>{0.377653331f, 0.515291274f},
-std::array<float,2>{0.765302122f, 0.339004904f},
-std::array<float,2>{0.149972215f, 0.194976255f},
-std::array<float,2>{0.682673275f, 0.923703611f},
-std::array<float,2>{0.239725277f, 0.661132276f},
-std::array<float,2>{0.692909122f, 0.493480057f},
-std::array<float,2>{0.473753422f, 0.0263644233f},
-std::array<float,2>{0.856434941f, 0.789557159f},
-std::array<float,2>{0.296250433f, 0.99962759f},
-std::array<float,2>{0.88904959f, 0.137870908f},
-std::array<float,2>{0.0176951177f, 0.306918383f},
-std::array<float,2>{0.622485399f, 0.571867704f},
-std::array<float,2>{0.160414636f, 0.902205169f},
-std::array<float,2>{0.630191505f, 0.222247273f},
-std::array<float,2>{0.433389574f, 0.36735785f},
-std::array<float,2>{0.804707944f, 0.551484704f},
-std::array<float,2>{0.362378776f, 0.747486293f},
-std::array<float,2>{0.983933985f, 0.375103503f},
-std::array<float,2>{0.0803997219f, 0.080153957f},
-std::array<float,2>{0.510450184f, 0.839543045f},
-std::array<float,2>{0.056205418f, 0.612544f},
-std::array<float,2>{0.583754003f, 0.268368572f},
-std::array<float,2>{0.273882508f, 0.179673076f},
-std::array<float,2>{0.912049174f, 0.952560246f},
-std::array<float,2>{0.461196095f, 0.773434818f},
-std::array<float,2>{0.840333462f, 0.0557034723f},
-std::array<float,2>{0.19379577f, 0.450786144f},
-std::array<float,2>{0.721533298f, 0.62740612f},
-std::array<float,2>{0.00634184852f, 0.959812284f},
-std::array<float,2>{0.603688359f, 0.16827184f},
-std::array<float,2>{0.303271085f, 0.2538957f},
-std::array<float,2>{0.905207396f, 0.603919685f},
-std::array<float,2>{0.499051601f, 0.651106179f},
-std::array<float,2>{0.86331594f, 0.462551773f},
-std::array<float,2>{0.222193927f, 0.0410510711f},
-std::array<float,2>{0.711393178f, 0.757204235f},
-std::array<float,2>{0.138274342f, 0.54493171f},
-std::array<float,2>{0.657082975f, 0.344809681f},
-std::array<float,2>{0.404317141f, 0.234685093f},
-std::array<float,2>{0.767798185f, 0.875107706f},
-std::array<float,2>{0.341945559f, 0.826144993f},
-std::array<float,2>{0.954788268f, 0.0642364621f},
-std::array<float,2>{0.114691161f, 0.394787908f},
-std::array<float,2>{0.543030381f, 0.731828034f},
-std::array<float,2>{0.210126251f, 0.811328113f},
-std::array<float,2>{0.741380513f, 0.0128645841f},
-std::array<float,2>{0.444926977f, 0.475918472f},
-std::array<float,2>{0.81956315f, 0.684932172f},
-std::array<float,2>{0.264891446f, 0.579223633f},
-std::array<float,2>{0.936363161f, 0.282365292f},
-std::array<float,2>{0.0445639901f, 0.152509063f},
-std::array<float,2>{0.572190046f, 0.973383248f},
-std::array<float,2>{0.0745341778f, 0.710241199f},
-std::array<float,2>{0.516054094f, 0.409608662f},
-std::array<float,2>{0.355537921f, 0.109091319f},
-std::array<float,2>{0.998690128f, 0.873758793f},
-std::array<float,2>{0.410278678f, 0.920647144f},
-std::array<float,2>{0.785849392f, 0.217304513f},
-std::array<float,2>{0.172794238f, 0.316563785f},
-std::array<float,2>{0.653065383f, 0.530725598f},
-std::array<float,2>{0.0328144133f, 0.76146692f},
-std::array<float,2>{0.567199171f, 0.0385957435f},
-std::array<float,2>{0.251458555f, 0.456631631f},
-std::array<float,2>{0.924658298f, 0.644935369f},
-std::array<float,2>{0.452184558f, 0.597546577f},
-std::array<float,2>{0.82667762f, 0.263153732f},
-std::array<float,2>{0.217096552f, 0.163415194f},
-std::array<float,2>{0.74864167f, 0.961280465f},
-std::array<float,2>{0.187335089f, 0.719545066f},
-std::array<float,2>{0.642744362f, 0.400236517f},
-std::array<float,2>{0.421487361f, 0.0746828541f},
-std::array<float,2>{0.795102f, 0.817753375f},
-std::array<float,2>{0.350045055f, 0.884579539f},
-std::array<float,2>{0.990513265f, 0.249135017f},
-std::array<float,2>{0.0678728595f, 0.352870524f},
-std::array<float,2>{0.52988404f, 0.533945858f},
-std::array<float,2>{0.231425881f, 0.976784289f},
-std::array<float,2>{0.70908618f, 0.14298217f},
-std::array<float,2>{0.489276648f, 0.291071534f},
-std::array<float,2>{0.868783176f, 0.586355507f},
-std::array<float,2>{0.31046465f, 0.677146971f},
-std::array<float,2>{0.892173886f, 0.482084811f},
-std::array<float,2>{0.0133718662f, 0.00434851134f},
-std::array<float,2>{0.598415196f, 0.802401662f},
-std::array<float,2>{0.118789017f, 0.520261228f},
-std::array<float,2>{0.532662511f, 0.327854693f},
-std::array<float,2>{0.332202107f, 0.209889323f},
-std::array<float,2>{0.962229848f, 0.908989668f},
-std::array<float,2>{0.394113898f, 0.860422015f},
-std::array<float,2>{0.776998937f, 0.0971884578f},
-std::array<float,2>{0.132095039f, 0.419201583f},
-std::array<float,2>{0.669682562f, 0.713806093f},
-std::array<float,2>{0.092005983f, 0.930967689f},
-std::array<float,2>{0.505222976f, 0.198329091f},
-std::array<float,2>{0.374351829f, 0.328315467f},
-std::array<float,2>{0.96952343f, 0.504870474f},
-std::array<float,2>{0.424806625f, 0.699678183f},
-std::array<float,2>{0.803632259f, 0.423098981f},
-std::array<float,2>{0.168863773f, 0.113479778f},
-std::array<float,2>{0.633435011f, 0.85866034f},
-std::array<float,2>{0.198407337f, 0.569948137f},
-std::array<float,2>{0.731119514f, 0.303182036f},
-std::array<float,2>{0.455983639f, 0.126446828f},
-std::array<float,2>{0.83136636f, 0.9910357f},
-std::array<float,2>{0.267882228f, 0.785463214f},
-std::array<float,2>{0.91919893f, 0.019626556f},
-std::array<float,2>{0.0536641255f, 0.487889618f},
-std::array<float,2>{0.587765038f, 0.668869257f},
-std::array<float,2>{0.145377904f, 0.835472286f},
-std::array<float,2>{0.677614629f, 0.0913316682f},
-std::array<float,2>{0.386795372f, 0.38548255f},
-std::array<float,2>{0.751478791f, 0.7345016f},
-std::array<float,2>{0.314236492f, 0.561453581f},
-std::array<float,2>{0.945502818f, 0.36318633f},
-std::array<float,2>{0.107887752f, 0.228763133f},
-std::array<float,2>{0.553744733f, 0.892479718f},
-std::array<float,2>{0.0265507847f, 0.633770525f},
-std::array<float,2>{0.615821421f, 0.441686928f},
-std::array<float,2>{0.281260043f, 0.0488463975f},
-std::array<float,2>{0.879872799f, 0.776449323f},
-std::array<float,2>{0.483440667f, 0.941153109f},
-std::array<float,2>{0.844172537f, 0.181437165f},
-std::array<float,2>{0.243603155f, 0.278753072f},
-std::array<float,2>{0.699450076f, 0.620053649f},
-std::array<float,2>{0.0219204985f, 0.815076709f},
-std::array<float,2>{0.619286299f, 0.0725730285f},
-std::array<float,2>{0.290058106f, 0.40393579f},
-std::array<float,2>{0.886673927f, 0.725941658f},
-std::array<float,2>{0.468989581f, 0.537229538f},
-std::array<float,2>{0.852300346f, 0.358744442f},
-std::array<float,2>{0.235408455f, 0.242605984f},
-std::array<float,2>{0.688934028f, 0.890509725f},
-std::array<float,2>{0.155808598f, 0.643750906f},
-std::array<float,2>{0.684588432f, 0.458599299f},
-std::array<float,2>{0.381595165f, 0.0347809233f},
-std::array<float,2>{0.758194089f, 0.764550567f},
-std::array<float,2>{0.321887672f, 0.966956496f},
-std::array<float,2>{0.941745281f, 0.159241572f},
-std::array<float,2>{0.0998437479f, 0.25796321f},
-std::array<float,2>{0.56008774f, 0.599659503f},
-std::array<float,2>{0.190125063f, 0.912847161f},
-std::array<float,2>{0.726496994f, 0.206107154f},
-std::array<float,2>{0.465179086f, 0.322856784f},
-std::array<float,2>{0.837343574f, 0.515794039f},
-std::array<float,2>{0.278939307f, 0.71618408f},
-std::array<float,2>{0.906282842f, 0.414240003f},
-std::array<float,2>{0.0594810732f, 0.0995230377f},
-std::array<float,2>{0.581114054f, 0.863405049f},
-std::array<float,2>{0.08513695f, 0.591046572f},
-std::array<float,2>{0.515337169f, 0.295809865f},
-std::array<float,2>{0.365096718f, 0.147772059f},
-std::array<float,2>{0.977481127f, 0.982851982f},
-std::array<float,2>{0.433989346f, 0.797470212f},
-std::array<float,2>{0.809465051f, 0.00126684783f},
-std::array<float,2>{0.15842478f, 0.478409141f},
-std::array<float,2>{0.627683401f, 0.671954989f},
-std::array<float,2>{0.112614833f, 0.984813988f},
-std::array<float,2>{0.542102396f, 0.1327952f},
-std::array<float,2>{0.336887658f, 0.300610304f},
-std::array<float,2>{0.958680749f, 0.563840568f},
-std::array<float,2>{0.39887929f, 0.66595304f},
-std::array<float,2>{0.773313046f, 0.490984738f},
-std::array<float,2>{0.134862781f, 0.0175222531f},
-std::array<float,2>{0.661019146f, 0.78233254f},
-std::array<float,2>{0.223599255f, 0.500934303f},
-std::array<float,2>{0.714889765f, 0.334157348f},
-std::array<float,2>{0.494219482f, 0.199531943f},
-std::array<float,2>{0.861733615f, 0.935086489f},
-std::array<float,2>{0.300235718f, 0.853639722f},
-std::array<float,2>{0.900470793f, 0.111404493f},
-std::array<float,2>{0.00129480264f, 0.426234663f},
-std::array<float,2>{0.607336104f, 0.69897151f},
-std::array<float,2>{0.177749574f, 0.78011024f},
-std::array<float,2>{0.651323617f, 0.0526795387f},
-std::array<float,2>{0.407643884f, 0.44033426f},
-std::array<float,2>{0.784867704f, 0.639904678f},
-std::array<float,2>{0.354353875f, 0.622786224f},
-std::array<float,2>{0.995601356f, 0.27706784f},
-std::array<float,2>{0.0708421171f, 0.186069265f},
-std::array<float,2>{0.520319581f, 0.942857981f},
-std::array<float,2>{0.0391297154f, 0.739125371f},
-std::array<float,2>{0.574573696f, 0.387287766f},
-std::array<float,2>{0.257859796f, 0.0883833542f},
-std::array<float,2>{0.932804525f, 0.829131544f},
-std::array<float,2>{0.437892437f, 0.895150244f},
-std::array<float,2>{0.81638813f, 0.234077111f},
-std::array<float,2>{0.204506338f, 0.363449126f},
-std::array<float,2>{0.736086905f, 0.555155218f},
-std::array<float,2>{0.0646699592f, 0.793019533f},
-std::array<float,2>{0.526937842f, 0.0280713569f},
-std::array<float,2>{0.345523506f, 0.49630481f},
-std::array<float,2>{0.987574816f, 0.657586336f},
-std::array<float,2>{0.415396094f, 0.575729311f},
-std::array<float,2>{0.790986598f, 0.311585933f},
-std::array<float,2>{0.181382164f, 0.136696711f},
-std::array<float,2>{0.645585537f, 0.992737949f},
-std::array<float,2>{0.213067934f, 0.695035696f},
-std::array<float,2>{0.744671106f, 0.429784149f},
-std::array<float,2>{0.446688294f, 0.124046423f},
-std::array<float,2>{0.82098949f, 0.847004175f},
-std::array<float,2>{0.254199952f, 0.929079831f},
-std::array<float,2>{0.929526746f, 0.189980924f},
-std::array<float,2>{0.036177095f, 0.341110677f},
-std::array<float,2>{0.56567353f, 0.508113503f},
-std::array<float,2>{0.125950485f, 0.948417962f},
-std::array<float,2>{0.666072428f, 0.174437121f},
-std::array<float,2>{0.397553265f, 0.272760183f},
-std::array<float,2>{0.779100716f, 0.615878105f},
-std::array<float,2>{0.328493655f, 0.631672621f},
-std::array<float,2>{0.967891276f, 0.448992372f},
-std::array<float,2>{0.122878164f, 0.0604591183f},
-std::array<float,2>{0.537057161f, 0.768984854f},
-std::array<float,2>{0.00926511176f, 0.550449848f},
-std::array<float,2>{0.597411931f, 0.373365164f},
-std::array<float,2>{0.307707161f, 0.222958684f},
-std::array<float,2>{0.898328364f, 0.903328717f},
-std::array<float,2>{0.486322671f, 0.842969835f},
-std::array<float,2>{0.871438563f, 0.0859216899f},
-std::array<float,2>{0.229298785f, 0.381797165f},
-std::array<float,2>{0.704602361f, 0.743622541f},
-std::array<float,2>{0.0488795042f, 0.881974399f},
-std::array<float,2>{0.59242481f, 0.240871012f},
-std::array<float,2>{0.271805793f, 0.350288212f},
-std::array<float,2>{0.916357279f, 0.539371908f},
-std::array<float,2>{0.458914429f, 0.729469419f},
-std::array<float,2>{0.834267259f, 0.391606897f},
-std::array<float,2>{0.201714694f, 0.0678377524f},
-std::array<float,2>{0.726647198f, 0.823942721f},
-std::array<float,2>{0.164554939f, 0.605502486f},
-std::array<float,2>{0.638871968f, 0.257729411f},
-std::array<float,2>{0.429494828f, 0.166267619f},
-std::array<float,2>{0.799948573f, 0.955523491f},
-std::array<float,2>{0.36879319f, 0.751945317f},
-std::array<float,2>{0.975874126f, 0.0447041914f},
-std::array<float,2>{0.0895252749f, 0.466111183f},
-std::array<float,2>{0.501434982f, 0.654902518f},
-std::array<float,2>{0.247723073f, 0.868406713f},
-std::array<float,2>{0.696357727f, 0.104593068f},
-std::array<float,2>{0.478697211f, 0.413053125f},
-std::array<float,2>{0.848869085f, 0.70429045f},
-std::array<float,2>{0.286319107f, 0.527324438f},
-std::array<float,2>{0.876272619f, 0.314460963f},
-std::array<float,2>{0.030251652f, 0.212243527f},
-std::array<float,2>{0.609607518f, 0.917555928f},
-std::array<float,2>{0.102715664f, 0.68043524f},
-std::array<float,2>{0.549015403f, 0.469433725f},
-std::array<float,2>{0.319280714f, 0.00975691993f},
-std::array<float,2>{0.952672482f, 0.804888725f},
-std::array<float,2>{0.38653332f, 0.972302794f},
-std::array<float,2>{0.756042957f, 0.151887476f},
-std::array<float,2>{0.144225731f, 0.286248446f},
-std::array<float,2>{0.673071682f, 0.584212363f},
-std::array<float,2>{0.0800045431f, 0.837705791f},
-std::array<float,2>{0.509472489f, 0.0785200149f},
-std::array<float,2>{0.36057207f, 0.378416121f},
-std::array<float,2>{0.981349766f, 0.749315083f},
-std::array<float,2>{0.430116177f, 0.554252267f},
-std::array<float,2>{0.806799054f, 0.369447619f},
-std::array<float,2>{0.163481578f, 0.219671324f},
-std::array<float,2>{0.632370055f, 0.898713768f},
-std::array<float,2>{0.192893371f, 0.625054181f},
-std::array<float,2>{0.720294654f, 0.45180738f},
-std::array<float,2>{0.463240117f, 0.0582969449f},
-std::array<float,2>{0.841986895f, 0.770271897f},
-std::array<float,2>{0.276818097f, 0.949254513f},
-std::array<float,2>{0.913291395f, 0.176971436f},
-std::array<float,2>{0.057782162f, 0.266456068f},
-std::array<float,2>{0.585413277f, 0.61076808f},
-std::array<float,2>{0.151839972f, 0.923925877f},
-std::array<float,2>{0.679753721f, 0.192545295f},
-std::array<float,2>{0.376390755f, 0.337784022f},
-std::array<float,2>{0.763537645f, 0.512153029f},
-std::array<float,2>{0.32726565f, 0.688693821f},
-std::array<float,2>{0.937594116f, 0.436913878f},
-std::array<float,2>{0.0948374942f, 0.120834254f},
-std::array<float,2>{0.556644201f, 0.84907186f},
-std::array<float,2>{0.0169099346f, 0.573113561f},
-std::array<float,2>{0.624985933f, 0.305971235f},
-std::array<float,2>{0.293474615f, 0.139257893f},
-std::array<float,2>{0.887696564f, 0.997771144f},
-std::array<float,2>{0.47530672f, 0.79231137f},
-std::array<float,2>{0.858906806f, 0.0237386208f},
-std::array<float,2>{0.240922943f, 0.495776534f},
-std::array<float,2>{0.694526374f, 0.663593292f},
-std::array<float,2>{0.0455224887f, 0.975917876f},
-std::array<float,2>{0.573549986f, 0.156102121f},
-std::array<float,2>{0.26200977f, 0.283815384f},
-std::array<float,2>{0.934762836f, 0.581962466f},
-std::array<float,2>{0.442873001f, 0.686949074f},
-std::array<float,2>{0.817602098f, 0.473796397f},
-std::array<float,2>{0.207164913f, 0.0138439946f},
-std::array<float,2>{0.739801586f, 0.809928179f},
-std::array<float,2>{0.174128577f, 0.527815402f},
-std::array<float,2>{0.654941142f, 0.318886727f},
-std::array<float,2>{0.413855255f, 0.215271831f},
-std::array<float,2>{0.78818959f, 0.918481767f},
-std::array<float,2>{0.357668459f, 0.871817112f},
-std::array<float,2>{0.997889102f, 0.107064068f},
-std::array<float,2>{0.0775865167f, 0.407224625f},
-std::array<float,2>{0.518835425f, 0.707382321f},
-std::array<float,2>{0.219767109f, 0.754770815f},
-std::array<float,2>{0.714698017f, 0.0394836925f},
-std::array<float,2>{0.49619326f, 0.463684291f},
-std::array<float,2>{0.866886079f, 0.648701668f},
-std::array<float,2>{0.301344961f, 0.601905584f},
-std::array<float,2>{0.904025435f, 0.250400633f},
-std::array<float,2>{0.00404068595f, 0.171443149f},
-std::array<float,2>{0.603047907f, 0.957855463f},
-std::array<float,2>{0.115852609f, 0.733834743f},
-std::array<float,2>{0.545201421f, 0.396809369f},
-std::array<float,2>{0.341480017f, 0.0654724017f},
-std::array<float,2>{0.956024706f, 0.826604962f},
-std::array<float,2>{0.402528733f, 0.878511548f},
-std::array<float,2>{0.767404616f, 0.238153607f},
-std::array<float,2>{0.138686746f, 0.345902681f},
-std::array<float,2>{0.658908606f, 0.543274283f},
-std::array<float,2>{0.0138800489f, 0.803871512f},
-std::array<float,2>{0.599991739f, 0.00765782921f},
-std::array<float,2>{0.311030775f, 0.482633471f},
-std::array<float,2>{0.893278599f, 0.679046631f},
-std::array<float,2>{0.491689295f, 0.588069558f},
-std::array<float,2>{0.869457781f, 0.289903194f},
-std::array<float,2>{0.233711988f, 0.140990272f},
-std::array<float,2>{0.708672702f, 0.979804695f},
-std::array<float,2>{0.12906763f, 0.712591171f},
-std::array<float,2>{0.671320677f, 0.420254052f},
-std::array<float,2>{0.391104192f, 0.0946842879f},
-std::array<float,2>{0.774327219f, 0.863186121f},
-std::array<float,2>{0.334806591f, 0.907699168f},
-std::array<float,2>{0.963372588f, 0.20892714f},
-std::array<float,2>{0.121071443f, 0.325709194f},
-std::array<float,2>{0.533267319f, 0.522489548f},
-std::array<float,2>{0.215783879f, 0.963534653f},
-std::array<float,2>{0.747950315f, 0.161143064f},
-std::array<float,2>{0.449623317f, 0.265305012f},
-std::array<float,2>{0.824706554f, 0.593753278f},
-std::array<float,2>{0.253791332f, 0.647590756f},
-std::array<float,2>{0.922825933f, 0.454283535f},
-std::array<float,2>{0.0347002037f, 0.0365286209f},
-std::array<float,2>{0.568679035f, 0.758404136f},
-std::array<float,2>{0.0685301349f, 0.531390667f},
-std::array<float,2>{0.528846085f, 0.355193973f},
-std::array<float,2>{0.348970234f, 0.247800812f},
-std::array<float,2>{0.988872945f, 0.885239601f},
-std::array<float,2>{0.4197115f, 0.820070624f},
-std::array<float,2>{0.793838382f, 0.0778594241f},
-std::array<float,2>{0.185121775f, 0.401413262f},
-std::array<float,2>{0.642076552f, 0.720840573f},
-std::array<float,2>{0.106470458f, 0.893459082f},
-std::array<float,2>{0.552314162f, 0.227060348f},
-std::array<float,2>{0.315380067f, 0.360289097f},
-std::array<float,2>{0.948478222f, 0.56007129f},
-std::array<float,2>{0.39049542f, 0.736735582f},
-std::array<float,2>{0.75289005f, 0.384654939f},
-std::array<float,2>{0.14706409f, 0.0925163776f},
-std::array<float,2>{0.677927554f, 0.832553923f},
-std::array<float,2>{0.244328707f, 0.617391825f},
-std::array<float,2>{0.702277958f, 0.280892104f},
-std::array<float,2>{0.482280105f, 0.182401106f},
-std::array<float,2>{0.847437561f, 0.937504172f},
-std::array<float,2>{0.284933031f, 0.774772465f},
-std::array<float,2>{0.88207233f, 0.0487798676f},
-std::array<float,2>{0.0240431409f, 0.445304513f},
-std::array<float,2>{0.613573372f, 0.635855258f},
-std::array<float,2>{0.171193272f, 0.856492996f},
-std::array<float,2>{0.635021567f, 0.116198532f},
-std::array<float,2>{0.42262885f, 0.42409718f},
-std::array<float,2>{0.802541316f, 0.702907026f},
-std::array<float,2>{0.371738344f, 0.506674707f},
-std::array<float,2>{0.971297562f, 0.330894291f},
-std::array<float,2>{0.0911232382f, 0.196880952f},
-std::array<float,2>{0.507207811f, 0.931691408f},
-std::array<float,2>{0.0522734337f, 0.671638131f},
-std::array<float,2>{0.588667929f, 0.486015081f},
-std::array<float,2>{0.267478377f, 0.0224055145f},
-std::array<float,2>{0.921282053f, 0.788416386f},
-std::array<float,2>{0.453487009f, 0.988597989f},
-std::array<float,2>{0.828920066f, 0.128748849f},
-std::array<float,2>{0.196319088f, 0.301482141f},
-std::array<float,2>{0.733540893f, 0.568297446f},
-std::array<float,2>{0.0618235283f, 0.865716934f},
-std::array<float,2>{0.579623818f, 0.101327091f},
-std::array<float,2>{0.281061202f, 0.417885929f},
-std::array<float,2>{0.908306539f, 0.717806458f},
-std::array<float,2>{0.467186481f, 0.519115508f},
-std::array<float,2>{0.839503407f, 0.320664942f},
-std::array<float,2>{0.188000441f, 0.20463492f},
-std::array<float,2>{0.722668588f, 0.911441684f},
-std::array<float,2>{0.157609701f, 0.675431371f},
-std::array<float,2>{0.626389205f, 0.479306012f},
-std::array<float,2>{0.436112523f, 0.00264423131f},
-std::array<float,2>{0.810638428f, 0.80016458f},
-std::array<float,2>{0.36616239f, 0.981752098f},
-std::array<float,2>{0.979297876f, 0.145824462f},
-std::array<float,2>{0.0822118297f, 0.293821961f},
-std::array<float,2>{0.511863172f, 0.592118859f},
-std::array<float,2>{0.237473264f, 0.887928307f},
-std::array<float,2>{0.690014958f, 0.245431438f},
-std::array<float,2>{0.470918238f, 0.355785996f},
-std::array<float,2>{0.854802847f, 0.536486447f},
-std::array<float,2>{0.292755783f, 0.723860145f},
-std::array<float,2>{0.882853329f, 0.405524164f},
-std::array<float,2>{0.0207404438f, 0.0718165264f},
-std::array<float,2>{0.618426383f, 0.813773453f},
-std::array<float,2>{0.098249957f, 0.597865999f},
-std::array<float,2>{0.561717272f, 0.259943008f},
-std::array<float,2>{0.322778672f, 0.157604754f},
-std::array<float,2>{0.94488734f, 0.966153264f},
-std::array<float,2>{0.379484177f, 0.762108386f},
-std::array<float,2>{0.760590255f, 0.031528607f},
-std::array<float,2>{0.153049722f, 0.459338635f},
-std::array<float,2>{0.685572267f, 0.642474055f},
-std::array<float,2>{0.0731648803f, 0.943789065f},
-std::array<float,2>{0.523386359f, 0.184044808f},
-std::array<float,2>{0.353426456f, 0.274252176f},
-std::array<float,2>{0.992637336f, 0.623438299f},
-std::array<float,2>{0.408929139f, 0.637877047f},
-std::array<float,2>{0.782679975f, 0.437947214f},
-std::array<float,2>{0.176319793f, 0.0533205979f},
-std::array<float,2>{0.650076568f, 0.77751106f},
-std::array<float,2>{0.205842301f, 0.55716145f},
-std::array<float,2>{0.737338722f, 0.367026538f},
-std::array<float,2>{0.440961927f, 0.230865404f},
-std::array<float,2>{0.813282788f, 0.89767319f},
-std::array<float,2>{0.26026088f, 0.830896497f},
-std::array<float,2>{0.931518614f, 0.0874397233f},
-std::array<float,2>{0.0418243632f, 0.390456825f},
-std::array<float,2>{0.576330066f, 0.741610527f},
-std::array<float,2>{0.133137181f, 0.784368992f},
-std::array<float,2>{0.66343236f, 0.0178242084f},
-std::array<float,2>{0.400978684f, 0.489972651f},
-std::array<float,2>{0.771313369f, 0.66788584f},
-std::array<float,2>{0.338387161f, 0.565505207f},
-std::array<float,2>{0.960799158f, 0.298374176f},
-std::array<float,2>{0.110697418f, 0.130220905f},
-std::array<float,2>{0.540417373f, 0.986392796f},
-std::array<float,2>{0.00265549007f, 0.695709467f},
-std::array<float,2>{0.607981622f, 0.429291129f},
-std::array<float,2>{0.298519492f, 0.110029079f},
-std::array<float,2>{0.899273872f, 0.852361381f},
-std::array<float,2>{0.492766231f, 0.93614918f},
-std::array<float,2>{0.860121608f, 0.202329144f},
-std::array<float,2>{0.226055652f, 0.333513081f},
-std::array<float,2>{0.718074739f, 0.502845109f},
-std::array<float,2>{0.123856761f, 0.765731514f},
-std::array<float,2>{0.538351893f, 0.0623472109f},
-std::array<float,2>{0.330708653f, 0.446737885f},
-std::array<float,2>{0.964884341f, 0.630217671f},
-std::array<float,2>{0.395805299f, 0.61419189f},
-std::array<float,2>{0.780044436f, 0.27082327f},
-std::array<float,2>{0.127787635f, 0.173641741f},
-std::array<float,2>{0.66516608f, 0.94686991f},
-std::array<float,2>{0.226658255f, 0.744622886f},
-std::array<float,2>{0.706356823f, 0.379420877f},
-std::array<float,2>{0.487702429f, 0.0821737498f},
-std::array<float,2>{0.874263167f, 0.840662181f},
-std::array<float,2>{0.305464387f, 0.90504396f},
-std::array<float,2>{0.896317482f, 0.226338759f},
-std::array<float,2>{0.0100684762f, 0.372591674f},
-std::array<float,2>{0.594111323f, 0.548029482f},
-std::array<float,2>{0.182586879f, 0.995251715f},
-std::array<float,2>{0.647071064f, 0.133435979f},
-std::array<float,2>{0.416839778f, 0.308611751f},
-std::array<float,2>{0.791567564f, 0.578055322f},
-std::array<float,2>{0.346776962f, 0.659089327f},
-std::array<float,2>{0.984836698f, 0.499558151f},
-std::array<float,2>{0.063102603f, 0.0296149403f},
-std::array<float,2>{0.524236858f, 0.79613775f},
-std::array<float,2>{0.037549872f, 0.510272503f},
-std::array<float,2>{0.563023031f, 0.342169046f},
-std::array<float,2>{0.257245451f, 0.189394653f},
-std::array<float,2>{0.926873207f, 0.927670658f},
-std::array<float,2>{0.447467357f, 0.84382391f},
-std::array<float,2>{0.823675215f, 0.12287055f},
-std::array<float,2>{0.212542072f, 0.432751179f},
-std::array<float,2>{0.742739618f, 0.692633212f},
-std::array<float,2>{0.0276590604f, 0.915721774f},
-std::array<float,2>{0.612862587f, 0.213082254f},
-std::array<float,2>{0.28884986f, 0.314085454f},
-std::array<float,2>{0.878029287f, 0.52456069f},
-std::array<float,2>{0.477593452f, 0.706516922f},
-std::array<float,2>{0.849952877f, 0.410551339f},
-std::array<float,2>{0.249437496f, 0.103407376f},
-std::array<float,2>{0.698011756f, 0.870711863f},
-std::array<float,2>{0.141527861f, 0.583092809f},
-std::array<float,2>{0.675081611f, 0.287496805f},
-std::array<float,2>{0.383096188f, 0.149483055f},
-std::array<float,2>{0.755099654f, 0.969108343f},
-std::array<float,2>{0.31675303f, 0.808511019f},
-std::array<float,2>{0.95049578f, 0.0105969226f},
-std::array<float,2>{0.104599878f, 0.47200498f},
-std::array<float,2>{0.547293782f, 0.682835042f},
-std::array<float,2>{0.199628145f, 0.822209835f},
-std::array<float,2>{0.729867399f, 0.0690495744f},
-std::array<float,2>{0.459576935f, 0.393279076f},
-std::array<float,2>{0.832056642f, 0.728295326f},
-std::array<float,2>{0.269741625f, 0.54147172f},
-std::array<float,2>{0.915514648f, 0.347808719f},
-std::array<float,2>{0.0481965765f, 0.238362223f},
-std::array<float,2>{0.591513038f, 0.879464447f},
-std::array<float,2>{0.0875872672f, 0.653039992f},
-std::array<float,2>{0.503766239f, 0.468301564f},
-std::array<float,2>{0.371058881f, 0.0454524085f},
-std::array<float,2>{0.973311186f, 0.752166033f},
-std::array<float,2>{0.425848573f, 0.954493999f},
-std::array<float,2>{0.798472106f, 0.164076477f},
-std::array<float,2>{0.167961881f, 0.254994154f},
-std::array<float,2>{0.636871457f, 0.608788669f},
-std::array<float,2>{0.113850579f, 0.827927113f},
-std::array<float,2>{0.544311583f, 0.0646964312f},
-std::array<float,2>{0.343708068f, 0.397474408f},
-std::array<float,2>{0.95395726f, 0.733170748f},
-std::array<float,2>{0.40589419f, 0.544246078f},
-std::array<float,2>{0.768761098f, 0.34753409f},
-std::array<float,2>{0.13703987f, 0.236615494f},
-std::array<float,2>{0.657650769f, 0.877875865f},
-std::array<float,2>{0.220717251f, 0.649596155f},
-std::array<float,2>{0.712299585f, 0.464700073f},
-std::array<float,2>{0.498671114f, 0.0405472554f},
-std::array<float,2>{0.86445123f, 0.755755544f},
-std::array<float,2>{0.30434978f, 0.958456457f},
-std::array<float,2>{0.905936003f, 0.170679748f},
-std::array<float,2>{0.00740148919f, 0.251933038f},
-std::array<float,2>{0.604821622f, 0.603230655f},
-std::array<float,2>{0.173664749f, 0.919258118f},
-std::array<float,2>{0.654165685f, 0.21618928f},
-std::array<float,2>{0.411265731f, 0.319692969f},
-std::array<float,2>{0.78673178f, 0.528609633f},
-std::array<float,2>{0.356761277f, 0.708368182f},
-std::array<float,2>{0.999759436f, 0.407663792f},
-std::array<float,2>{0.0759722814f, 0.105980709f},
-std::array<float,2>{0.516995311f, 0.872328103f},
-std::array<float,2>{0.0436311737f, 0.581030667f},
-std::array<float,2>{0.570599735f, 0.284642547f},
-std::array<float,2>{0.264275938f, 0.154504672f},
-std::array<float,2>{0.937429011f, 0.975102186f},
-std::array<float,2>{0.443487495f, 0.809158921f},
-std::array<float,2>{0.81843996f, 0.0154510811f},
-std::array<float,2>{0.209381983f, 0.472765774f},
-std::array<float,2>{0.740628421f, 0.686313689f},
-std::array<float,2>{0.0194609184f, 0.99635011f},
-std::array<float,2>{0.621200025f, 0.140283749f},
-std::array<float,2>{0.295889586f, 0.30488959f},
-std::array<float,2>{0.890114009f, 0.573533952f},
-std::array<float,2>{0.473334491f, 0.662948191f},
-std::array<float,2>{0.856930733f, 0.494940102f},
-std::array<float,2>{0.238711461f, 0.0253083687f},
-std::array<float,2>{0.692252934f, 0.791059971f},
-std::array<float,2>{0.148539826f, 0.513315201f},
-std::array<float,2>{0.681729376f, 0.336597741f},
-std::array<float,2>{0.377950847f, 0.192039117f},
-std::array<float,2>{0.764404058f, 0.925672114f},
-std::array<float,2>{0.32558322f, 0.847953618f},
-std::array<float,2>{0.940704763f, 0.119931318f},
-std::array<float,2>{0.0970046744f, 0.436372072f},
-std::array<float,2>{0.555195689f, 0.688255966f},
-std::array<float,2>{0.195122331f, 0.771075428f},
-std::array<float,2>{0.721734166f, 0.0575819798f},
-std::array<float,2>{0.461984396f, 0.453068644f},
-std::array<float,2>{0.841446638f, 0.626920938f},
-std::array<float,2>{0.2749511f, 0.609533668f},
-std::array<float,2>{0.91045922f, 0.267320961f},
-std::array<float,2>{0.0551822744f, 0.176447362f},
-std::array<float,2>{0.582068503f, 0.950690389f},
-std::array<float,2>{0.0816047415f, 0.748668194f},
-std::array<float,2>{0.511328697f, 0.377791822f},
-std::array<float,2>{0.36151877f, 0.0800057575f},
-std::array<float,2>{0.983246863f, 0.836204529f},
-std::array<float,2>{0.432096004f, 0.900374353f},
-std::array<float,2>{0.806526423f, 0.220513001f},
-std::array<float,2>{0.16118601f, 0.370837957f},
-std::array<float,2>{0.629159451f, 0.553131521f},
-std::array<float,2>{0.0537277013f, 0.787586093f},
-std::array<float,2>{0.586592972f, 0.0231362022f},
-std::array<float,2>{0.268800169f, 0.485071182f},
-std::array<float,2>{0.918328464f, 0.670094252f},
-std::array<float,2>{0.45654574f, 0.567349315f},
-std::array<float,2>{0.83104986f, 0.302542776f},
-std::array<float,2>{0.197327763f, 0.127291471f},
-std::array<float,2>{0.731938839f, 0.989379942f},
-std::array<float,2>{0.16957356f, 0.701396942f},
-std::array<float,2>{0.634173453f, 0.425201625f},
-std::array<float,2>{0.424448907f, 0.116536237f},
-std::array<float,2>{0.804584861f, 0.856262863f},
-std::array<float,2>{0.37362805f, 0.933253169f},
-std::array<float,2>{0.970499218f, 0.195478126f},
-std::array<float,2>{0.0935310796f, 0.331203371f},
-std::array<float,2>{0.504744709f, 0.507282615f},
-std::array<float,2>{0.242269993f, 0.93919313f},
-std::array<float,2>{0.701079071f, 0.183248714f},
-std::array<float,2>{0.483153731f, 0.279614955f},
-std::array<float,2>{0.845400572f, 0.618549883f},
-std::array<float,2>{0.282559812f, 0.635305524f},
-std::array<float,2>{0.880369008f, 0.443877697f},
-std::array<float,2>{0.0255687796f, 0.046928253f},
-std::array<float,2>{0.616284311f, 0.774304271f},
-std::array<float,2>{0.108636111f, 0.559008241f},
-std::array<float,2>{0.553427815f, 0.360871851f},
-std::array<float,2>{0.312721461f, 0.227598876f},
-std::array<float,2>{0.946391225f, 0.894182324f},
-std::array<float,2>{0.388421714f, 0.833067238f},
-std::array<float,2>{0.750087976f, 0.0936635211f},
-std::array<float,2>{0.146395341f, 0.382878006f},
-std::array<float,2>{0.676239669f, 0.737732172f},
-std::array<float,2>{0.0668843016f, 0.886301756f},
-std::array<float,2>{0.530395448f, 0.24644807f},
-std::array<float,2>{0.351556927f, 0.354320735f},
-std::array<float,2>{0.991711795f, 0.532426953f},
-std::array<float,2>{0.420545012f, 0.72230345f},
-std::array<float,2>{0.796738982f, 0.400446981f},
-std::array<float,2>{0.186142236f, 0.0765818432f},
-std::array<float,2>{0.643878639f, 0.8190521f},
-std::array<float,2>{0.21872279f, 0.595147669f},
-std::array<float,2>{0.749694645f, 0.263774991f},
-std::array<float,2>{0.451774746f, 0.160993278f},
-std::array<float,2>{0.827202797f, 0.963891447f},
-std::array<float,2>{0.250922024f, 0.759055257f},
-std::array<float,2>{0.924964547f, 0.03603651f},
-std::array<float,2>{0.0316720791f, 0.453248978f},
-std::array<float,2>{0.567860961f, 0.646809876f},
-std::array<float,2>{0.130927548f, 0.862116277f},
-std::array<float,2>{0.668128252f, 0.0954141319f},
-std::array<float,2>{0.392777562f, 0.421806961f},
-std::array<float,2>{0.775734365f, 0.711496651f},
-std::array<float,2>{0.333330929f, 0.522135794f},
-std::array<float,2>{0.961209476f, 0.324750066f},
-std::array<float,2>{0.117959738f, 0.20767425f},
-std::array<float,2>{0.531394243f, 0.907025099f},
-std::array<float,2>{0.0123862764f, 0.678191364f},
-std::array<float,2>{0.5987764f, 0.483631492f},
-std::array<float,2>{0.309209913f, 0.00634139171f},
-std::array<float,2>{0.890812337f, 0.803525865f},
-std::array<float,2>{0.489050895f, 0.978563309f},
-std::array<float,2>{0.867219806f, 0.142181188f},
-std::array<float,2>{0.2316062f, 0.290655255f},
-std::array<float,2>{0.709978461f, 0.589537501f},
-std::array<float,2>{0.000490394246f, 0.852953613f},
-std::array<float,2>{0.606293559f, 0.110802561f},
-std::array<float,2>{0.298838079f, 0.428190559f},
-std::array<float,2>{0.901520371f, 0.696540475f},
-std::array<float,2>{0.495956749f, 0.503843963f},
-std::array<float,2>{0.863039494f, 0.332149684f},
-std::array<float,2>{0.223934337f, 0.201393381f},
-std::array<float,2>{0.7166273f, 0.936794281f},
-std::array<float,2>{0.13638097f, 0.666562676f},
-std::array<float,2>{0.661494672f, 0.488726586f},
-std::array<float,2>{0.40031299f, 0.0189460758f},
-std::array<float,2>{0.771864891f, 0.783500373f},
-std::array<float,2>{0.337128341f, 0.987652659f},
-std::array<float,2>{0.957476258f, 0.129777744f},
-std::array<float,2>{0.111967809f, 0.297679871f},
-std::array<float,2>{0.541786432f, 0.565201819f},
-std::array<float,2>{0.203248009f, 0.896946311f},
-std::array<float,2>{0.734529674f, 0.232401162f},
-std::array<float,2>{0.438885212f, 0.365347952f},
-std::array<float,2>{0.814663529f, 0.557957768f},
-std::array<float,2>{0.259628147f, 0.740297139f},
-std::array<float,2>{0.932062924f, 0.389291018f},
-std::array<float,2>{0.0401548967f, 0.0866682678f},
-std::array<float,2>{0.575452924f, 0.831158996f},
-std::array<float,2>{0.0721681863f, 0.624786496f},
-std::array<float,2>{0.520558357f, 0.275289536f},
-std::array<float,2>{0.354948312f, 0.185000688f},
-std::array<float,2>{0.994645417f, 0.944428504f},
-std::array<float,2>{0.407094568f, 0.778677821f},
-std::array<float,2>{0.783986151f, 0.0546303056f},
-std::array<float,2>{0.179535672f, 0.438741952f},
-std::array<float,2>{0.651450753f, 0.637333989f},
-std::array<float,2>{0.101319052f, 0.965438902f},
-std::array<float,2>{0.559293687f, 0.156366378f},
-std::array<float,2>{0.320937753f, 0.261269242f},
-std::array<float,2>{0.942588091f, 0.598689198f},
-std::array<float,2>{0.382157087f, 0.641367733f},
-std::array<float,2>{0.759611011f, 0.460081965f},
-std::array<float,2>{0.154593647f, 0.0327349305f},
-std::array<float,2>{0.683778346f, 0.762995005f},
-std::array<float,2>{0.23533766f, 0.53545481f},
-std::array<float,2>{0.68826884f, 0.356841385f},
-std::array<float,2>{0.470485538f, 0.244437724f},
-std::array<float,2>{0.853340149f, 0.887437105f},
-std::array<float,2>{0.289229393f, 0.812861621f},
-std::array<float,2>{0.885668635f, 0.0706968606f},
-std::array<float,2>{0.0225364175f, 0.404971868f},
-std::array<float,2>{0.620994866f, 0.723202348f},
-std::array<float,2>{0.16010803f, 0.79973495f},
-std::array<float,2>{0.628727317f, 0.00296275201f},
-std::array<float,2>{0.434581429f, 0.479508847f},
-std::array<float,2>{0.809856355f, 0.674663484f},
-std::array<float,2>{0.363449901f, 0.593390405f},
-std::array<float,2>{0.978190899f, 0.294497609f},
-std::array<float,2>{0.0844909474f, 0.145415366f},
-std::array<float,2>{0.514360428f, 0.980524004f},
-std::array<float,2>{0.0600615516f, 0.71713829f},
-std::array<float,2>{0.580466688f, 0.416055113f},
-std::array<float,2>{0.277508229f, 0.10054367f},
-std::array<float,2>{0.907333314f, 0.866585612f},
-std::array<float,2>{0.466692209f, 0.910532415f},
-std::array<float,2>{0.835992873f, 0.203708038f},
-std::array<float,2>{0.191259041f, 0.321789324f},
-std::array<float,2>{0.724629462f, 0.51838851f},
-std::array<float,2>{0.0885191187f, 0.753295243f},
-std::array<float,2>{0.500502169f, 0.0459151939f},
-std::array<float,2>{0.367503971f, 0.46726796f},
-std::array<float,2>{0.975272179f, 0.654159188f},
-std::array<float,2>{0.428254008f, 0.607781231f},
-std::array<float,2>{0.799745083f, 0.254540652f},
-std::array<float,2>{0.165596351f, 0.165440172f},
-std::array<float,2>{0.640348136f, 0.953408539f},
-std::array<float,2>{0.20304738f, 0.727293491f},
-std::array<float,2>{0.72789979f, 0.393888295f},
-std::array<float,2>{0.45796451f, 0.069659166f},
-std::array<float,2>{0.835929096f, 0.820705831f},
-std::array<float,2>{0.272986948f, 0.879989684f},
-std::array<float,2>{0.917523623f, 0.239431918f},
-std::array<float,2>{0.0500968881f, 0.348825693f},
-std::array<float,2>{0.592952251f, 0.542752862f},
-std::array<float,2>{0.143104881f, 0.970227242f},
-std::array<float,2>{0.672601998f, 0.14902091f},
-std::array<float,2>{0.384769082f, 0.288199067f},
-std::array<float,2>{0.757507205f, 0.582703471f},
-std::array<float,2>{0.319920272f, 0.682172418f},
-std::array<float,2>{0.951981783f, 0.47115013f},
-std::array<float,2>{0.10233631f, 0.0115272664f},
-std::array<float,2>{0.550139844f, 0.806827843f},
-std::array<float,2>{0.0309230536f, 0.523702145f},
-std::array<float,2>{0.610658824f, 0.313056171f},
-std::array<float,2>{0.285286695f, 0.214183733f},
-std::array<float,2>{0.875795901f, 0.914189875f},
-std::array<float,2>{0.479987264f, 0.869444966f},
-std::array<float,2>{0.848063707f, 0.102300055f},
-std::array<float,2>{0.246270835f, 0.411834478f},
-std::array<float,2>{0.696228921f, 0.705962539f},
-std::array<float,2>{0.0359154418f, 0.926258683f},
-std::array<float,2>{0.565084636f, 0.187514246f},
-std::array<float,2>{0.255244434f, 0.343510628f},
-std::array<float,2>{0.92846626f, 0.511126935f},
-std::array<float,2>{0.446185619f, 0.692143857f},
-std::array<float,2>{0.822001576f, 0.432535499f},
-std::array<float,2>{0.21483241f, 0.121647663f},
-std::array<float,2>{0.745903552f, 0.845571041f},
-std::array<float,2>{0.179897934f, 0.576453567f},
-std::array<float,2>{0.64473176f, 0.310074866f},
-std::array<float,2>{0.414113015f, 0.134528667f},
-std::array<float,2>{0.789925277f, 0.995078564f},
-std::array<float,2>{0.343830407f, 0.79506433f},
-std::array<float,2>{0.986426115f, 0.0307862889f},
-std::array<float,2>{0.0656604096f, 0.498734146f},
-std::array<float,2>{0.525768816f, 0.659750164f},
-std::array<float,2>{0.229723111f, 0.841783226f},
-std::array<float,2>{0.703415811f, 0.0832916349f},
-std::array<float,2>{0.485145688f, 0.380025655f},
-std::array<float,2>{0.872567832f, 0.745644808f},
-std::array<float,2>{0.306953818f, 0.546906233f},
-std::array<float,2>{0.897378862f, 0.371248931f},
-std::array<float,2>{0.00858080201f, 0.225387439f},
-std::array<float,2>{0.596346974f, 0.905527234f},
-std::array<float,2>{0.121568628f, 0.629623473f},
-std::array<float,2>{0.535527229f, 0.446247965f},
-std::array<float,2>{0.329948306f, 0.0612658225f},
-std::array<float,2>{0.967082083f, 0.767570913f},
-std::array<float,2>{0.396647274f, 0.946219206f},
-std::array<float,2>{0.777564287f, 0.171933144f},
-std::array<float,2>{0.126124799f, 0.270091951f},
-std::array<float,2>{0.66783607f, 0.61522913f},
-std::array<float,2>{0.0766982064f, 0.87467438f},
-std::array<float,2>{0.518443465f, 0.107667014f},
-std::array<float,2>{0.358837545f, 0.408950716f},
-std::array<float,2>{0.996758282f, 0.709334254f},
-std::array<float,2>{0.412828386f, 0.530095696f},
-std::array<float,2>{0.787116945f, 0.317663848f},
-std::array<float,2>{0.174807683f, 0.218062624f},
-std::array<float,2>{0.65584141f, 0.921138048f},
-std::array<float,2>{0.208856627f, 0.684033275f},
-std::array<float,2>{0.738458633f, 0.475417227f},
-std::array<float,2>{0.441729426f, 0.0119994869f},
-std::array<float,2>{0.816576719f, 0.811817408f},
-std::array<float,2>{0.262987643f, 0.973777831f},
-std::array<float,2>{0.933996141f, 0.153880075f},
-std::array<float,2>{0.0467753187f, 0.281634867f},
-std::array<float,2>{0.572562873f, 0.578648448f},
-std::array<float,2>{0.139815092f, 0.876666486f},
-std::array<float,2>{0.659376442f, 0.235657424f},
-std::array<float,2>{0.404277891f, 0.34436512f},
-std::array<float,2>{0.766177237f, 0.546801269f},
-std::array<float,2>{0.340035707f, 0.73071146f},
-std::array<float,2>{0.956503153f, 0.39636308f},
-std::array<float,2>{0.116216786f, 0.0633102655f},
-std::array<float,2>{0.546821892f, 0.824980855f},
-std::array<float,2>{0.00494834315f, 0.604795516f},
-std::array<float,2>{0.601916075f, 0.252460927f},
-std::array<float,2>{0.301892847f, 0.169881955f},
-std::array<float,2>{0.903087318f, 0.96091646f},
-std::array<float,2>{0.497312963f, 0.756589055f},
-std::array<float,2>{0.86538589f, 0.0424849279f},
-std::array<float,2>{0.219416752f, 0.461539209f},
-std::array<float,2>{0.713623703f, 0.651510894f},
-std::array<float,2>{0.0575543307f, 0.951629043f},
-std::array<float,2>{0.5849213f, 0.178077385f},
-std::array<float,2>{0.275418252f, 0.269112587f},
-std::array<float,2>{0.912187397f, 0.612202108f},
-std::array<float,2>{0.46459654f, 0.628596008f},
-std::array<float,2>{0.843309581f, 0.450086057f},
-std::array<float,2>{0.191912338f, 0.0552043654f},
-std::array<float,2>{0.719546854f, 0.771815658f},
-std::array<float,2>{0.16215907f, 0.55188334f},
-std::array<float,2>{0.63109529f, 0.368225932f},
-std::array<float,2>{0.431140035f, 0.220994204f},
-std::array<float,2>{0.808128417f, 0.900889516f},
-std::array<float,2>{0.359435439f, 0.838615775f},
-std::array<float,2>{0.982164323f, 0.0819474906f},
-std::array<float,2>{0.0786159784f, 0.376921117f},
-std::array<float,2>{0.508479714f, 0.746911526f},
-std::array<float,2>{0.241886988f, 0.79057163f},
-std::array<float,2>{0.693928897f, 0.0265461374f},
-std::array<float,2>{0.476549238f, 0.492845505f},
-std::array<float,2>{0.858171701f, 0.662093163f},
-std::array<float,2>{0.294150472f, 0.570670187f},
-std::array<float,2>{0.887628675f, 0.307624578f},
-std::array<float,2>{0.0162539501f, 0.137494862f},
-std::array<float,2>{0.623233378f, 0.998737276f},
-std::array<float,2>{0.093846105f, 0.690211177f},
-std::array<float,2>{0.558043182f, 0.435234129f},
-std::array<float,2>{0.326989353f, 0.118573308f},
-std::array<float,2>{0.938926935f, 0.849727154f},
-std::array<float,2>{0.375842422f, 0.922042906f},
-std::array<float,2>{0.762378216f, 0.194172174f},
-std::array<float,2>{0.151063904f, 0.338445276f},
-std::array<float,2>{0.681516171f, 0.514371216f},
-std::array<float,2>{0.0244161226f, 0.775560081f},
-std::array<float,2>{0.614405274f, 0.0501068309f},
-std::array<float,2>{0.283680826f, 0.443059713f},
-std::array<float,2>{0.881511033f, 0.634013474f},
-std::array<float,2>{0.480555981f, 0.6208179f},
-std::array<float,2>{0.846481383f, 0.277395934f},
-std::array<float,2>{0.245861605f, 0.179719955f},
-std::array<float,2>{0.701328456f, 0.93983525f},
-std::array<float,2>{0.148332655f, 0.736268282f},
-std::array<float,2>{0.679270625f, 0.386550695f},
-std::array<float,2>{0.389438897f, 0.0902048349f},
-std::array<float,2>{0.753826678f, 0.834400892f},
-std::array<float,2>{0.316142201f, 0.891586125f},
-std::array<float,2>{0.947904766f, 0.230145782f},
-std::array<float,2>{0.10550455f, 0.361826956f},
-std::array<float,2>{0.551423073f, 0.561545074f},
-std::array<float,2>{0.196127877f, 0.991324723f},
-std::array<float,2>{0.732831001f, 0.125798285f},
-std::array<float,2>{0.454341918f, 0.304586738f},
-std::array<float,2>{0.829687178f, 0.569281459f},
-std::array<float,2>{0.265988111f, 0.669090927f},
-std::array<float,2>{0.920707047f, 0.486656755f},
-std::array<float,2>{0.0515496172f, 0.0205261484f},
-std::array<float,2>{0.58963871f, 0.786550283f},
-std::array<float,2>{0.0906934887f, 0.50523144f},
-std::array<float,2>{0.506136358f, 0.329978079f},
-std::array<float,2>{0.372875273f, 0.197293043f},
-std::array<float,2>{0.97172153f, 0.930208743f},
-std::array<float,2>{0.423281044f, 0.857966185f},
-std::array<float,2>{0.801341653f, 0.114783876f},
-std::array<float,2>{0.170659587f, 0.422279507f},
-std::array<float,2>{0.636391938f, 0.700685322f},
-std::array<float,2>{0.119270034f, 0.910122097f},
-std::array<float,2>{0.53427732f, 0.210879281f},
-std::array<float,2>{0.33518222f, 0.326209366f},
-std::array<float,2>{0.96443665f, 0.520776808f},
-std::array<float,2>{0.391795546f, 0.714214802f},
-std::array<float,2>{0.775238276f, 0.41889438f},
-std::array<float,2>{0.130004108f, 0.0964660719f},
-std::array<float,2>{0.670659006f, 0.859936535f},
-std::array<float,2>{0.233345747f, 0.587340772f},
-std::array<float,2>{0.707348764f, 0.292239964f},
-std::array<float,2>{0.490401715f, 0.143688694f},
-std::array<float,2>{0.870195448f, 0.978047013f},
-std::array<float,2>{0.312432647f, 0.800999463f},
-std::array<float,2>{0.894382536f, 0.0051810341f},
-std::array<float,2>{0.0146987243f, 0.480553508f},
-std::array<float,2>{0.60060221f, 0.67674154f},
-std::array<float,2>{0.183685392f, 0.816443563f},
-std::array<float,2>{0.641299427f, 0.0757529959f},
-std::array<float,2>{0.418756962f, 0.398788631f},
-std::array<float,2>{0.794023156f, 0.720242977f},
-std::array<float,2>{0.34808445f, 0.53478533f},
-std::array<float,2>{0.990098536f, 0.352003604f},
-std::array<float,2>{0.0699941143f, 0.248752013f},
-std::array<float,2>{0.528017461f, 0.88367641f},
-std::array<float,2>{0.0334852561f, 0.646145999f},
-std::array<float,2>{0.569807887f, 0.455085903f},
-std::array<float,2>{0.252416611f, 0.0380748622f},
-std::array<float,2>{0.923025131f, 0.760576963f},
-std::array<float,2>{0.450264513f, 0.962107837f},
-std::array<float,2>{0.826110423f, 0.162500218f},
-std::array<float,2>{0.215959579f, 0.262320608f},
-std::array<float,2>{0.74635458f, 0.596667588f},
-std::array<float,2>{0.0427707918f, 0.828509152f},
-std::array<float,2>{0.577821016f, 0.0896483213f},
-std::array<float,2>{0.261546463f, 0.388342023f},
-std::array<float,2>{0.930143356f, 0.739599943f},
-std::array<float,2>{0.439841568f, 0.556505561f},
-std::array<float,2>{0.814406514f, 0.364260495f},
-std::array<float,2>{0.206224784f, 0.233341917f},
-std::array<float,2>{0.737132728f, 0.896200776f},
-std::array<float,2>{0.177177176f, 0.639024258f},
-std::array<float,2>{0.648438394f, 0.441100091f},
-std::array<float,2>{0.409570247f, 0.0511669032f},
-std::array<float,2>{0.781427741f, 0.780868411f},
-std::array<float,2>{0.351615667f, 0.941409886f},
-std::array<float,2>{0.993263781f, 0.187041357f},
-std::array<float,2>{0.0741302967f, 0.275633395f},
-std::array<float,2>{0.522049367f, 0.621942639f},
-std::array<float,2>{0.224947482f, 0.934059024f},
-std::array<float,2>{0.717294276f, 0.200326324f},
-std::array<float,2>{0.493689716f, 0.335841298f},
-std::array<float,2>{0.861164808f, 0.501747787f},
-std::array<float,2>{0.297675103f, 0.698154747f},
-std::array<float,2>{0.900051236f, 0.427513152f},
-std::array<float,2>{0.00382631319f, 0.112776287f},
-std::array<float,2>{0.609034002f, 0.854948103f},
-std::array<float,2>{0.110071614f, 0.562968254f},
-std::array<float,2>{0.539516211f, 0.299133092f},
-std::array<float,2>{0.338905007f, 0.131589651f},
-std::array<float,2>{0.959326029f, 0.985741019f},
-std::array<float,2>{0.401572675f, 0.782135725f},
-std::array<float,2>{0.769903004f, 0.0159451421f},
-std::array<float,2>{0.134633601f, 0.491542488f},
-std::array<float,2>{0.662116289f, 0.664167523f},
-std::array<float,2>{0.0830706209f, 0.98429966f},
-std::array<float,2>{0.513487756f, 0.147127852f},
-std::array<float,2>{0.366492003f, 0.29629758f},
-std::array<float,2>{0.979833007f, 0.590651691f},
-std::array<float,2>{0.436712742f, 0.673514903f},
-std::array<float,2>{0.811993837f, 0.477211773f},
-std::array<float,2>{0.156530678f, 0.00069208385f},
-std::array<float,2>{0.62516135f, 0.79800874f},
-std::array<float,2>{0.188998222f, 0.517177582f},
-std::array<float,2>{0.724544346f, 0.324010968f},
-std::array<float,2>{0.467789441f, 0.205279395f},
-std::array<float,2>{0.838320374f, 0.913862467f},
-std::array<float,2>{0.280224711f, 0.864486456f},
-std::array<float,2>{0.909760594f, 0.0978341252f},
-std::array<float,2>{0.0605708435f, 0.415163279f},
-std::array<float,2>{0.57898891f, 0.715503216f},
-std::array<float,2>{0.153960377f, 0.765547216f},
-std::array<float,2>{0.686642826f, 0.0334233232f},
-std::array<float,2>{0.38076511f, 0.457667202f},
-std::array<float,2>{0.761564076f, 0.643265903f},
-std::array<float,2>{0.32366246f, 0.601383984f},
-std::array<float,2>{0.944080055f, 0.259365827f},
-std::array<float,2>{0.0995735824f, 0.158706263f},
-std::array<float,2>{0.560755968f, 0.968351841f},
-std::array<float,2>{0.0198517703f, 0.724954128f},
-std::array<float,2>{0.617651999f, 0.402828872f},
-std::array<float,2>{0.291459709f, 0.0735829324f},
-std::array<float,2>{0.884559095f, 0.816043258f},
-std::array<float,2>{0.472057581f, 0.889176846f},
-std::array<float,2>{0.854220927f, 0.243857086f},
-std::array<float,2>{0.236772344f, 0.357608646f},
-std::array<float,2>{0.691122532f, 0.538436294f},
-std::array<float,2>{0.104332805f, 0.805705845f},
-std::array<float,2>{0.548294425f, 0.00851612259f},
-std::array<float,2>{0.317903847f, 0.470424235f},
-std::array<float,2>{0.949909627f, 0.681073546f},
-std::array<float,2>{0.384360552f, 0.585020959f},
-std::array<float,2>{0.75417906f, 0.285797089f},
-std::array<float,2>{0.142027318f, 0.151341408f},
-std::array<float,2>{0.673922241f, 0.971145749f},
-std::array<float,2>{0.248055965f, 0.704021215f},
-std::array<float,2>{0.698571205f, 0.413231075f},
-std::array<float,2>{0.477085084f, 0.103717312f},
-std::array<float,2>{0.851376057f, 0.867455304f},
-std::array<float,2>{0.287206471f, 0.916536152f},
-std::array<float,2>{0.877423882f, 0.21116221f},
-std::array<float,2>{0.0285385605f, 0.316298097f},
-std::array<float,2>{0.611332774f, 0.52561599f},
-std::array<float,2>{0.166083008f, 0.956066251f},
-std::array<float,2>{0.638645709f, 0.167709783f},
-std::array<float,2>{0.427623421f, 0.255943239f},
-std::array<float,2>{0.797466457f, 0.607235074f},
-std::array<float,2>{0.369346261f, 0.655790389f},
-std::array<float,2>{0.974519849f, 0.464975417f},
-std::array<float,2>{0.0868794993f, 0.0439276882f},
-std::array<float,2>{0.502309322f, 0.750894547f},
-std::array<float,2>{0.0475427285f, 0.540708423f},
-std::array<float,2>{0.590105653f, 0.350874901f},
-std::array<float,2>{0.270901173f, 0.242157251f},
-std::array<float,2>{0.914435148f, 0.881435871f},
-std::array<float,2>{0.460114062f, 0.822336555f},
-std::array<float,2>{0.833982766f, 0.0664268509f},
-std::array<float,2>{0.200466767f, 0.391435146f},
-std::array<float,2>{0.728973031f, 0.730177522f},
-std::array<float,2>{0.0116977664f, 0.903236091f},
-std::array<float,2>{0.59481734f, 0.223653853f},
-std::array<float,2>{0.305812597f, 0.374381095f},
-std::array<float,2>{0.895436883f, 0.548835516f},
-std::array<float,2>{0.486682266f, 0.742271602f},
-std::array<float,2>{0.873701334f, 0.382208794f},
-std::array<float,2>{0.228394717f, 0.0848149955f},
-std::array<float,2>{0.705846548f, 0.842356384f},
-std::array<float,2>{0.128352553f, 0.616594434f},
-std::array<float,2>{0.664569795f, 0.271509171f},
-std::array<float,2>{0.395076632f, 0.17542246f},
-std::array<float,2>{0.780749381f, 0.947544456f},
-std::array<float,2>{0.331705362f, 0.76838994f},
-std::array<float,2>{0.966456831f, 0.0589971915f},
-std::array<float,2>{0.124254026f, 0.447453499f},
-std::array<float,2>{0.537330747f, 0.632656157f},
-std::array<float,2>{0.211138308f, 0.846264541f},
-std::array<float,2>{0.74362874f, 0.123770349f},
-std::array<float,2>{0.448832095f, 0.431491464f},
-std::array<float,2>{0.822705746f, 0.693448007f},
-std::array<float,2>{0.256440967f, 0.509762943f},
-std::array<float,2>{0.926258504f, 0.340711564f},
-std::array<float,2>{0.0388344713f, 0.191342205f},
-std::array<float,2>{0.563747108f, 0.928457677f},
-std::array<float,2>{0.0639869496f, 0.656277239f},
-std::array<float,2>{0.524551272f, 0.4973768f},
-std::array<float,2>{0.346172333f, 0.0287492964f},
-std::array<float,2>{0.98548007f, 0.793958843f},
-std::array<float,2>{0.417479366f, 0.993591845f},
-std::array<float,2>{0.792130589f, 0.135590166f},
-std::array<float,2>{0.182626918f, 0.311295718f},
-std::array<float,2>{0.648144662f, 0.574947953f},
-std::array<float,2>{0.103336327f, 0.86737746f},
-std::array<float,2>{0.549334288f, 0.103868425f},
-std::array<float,2>{0.318656385f, 0.413458556f},
-std::array<float,2>{0.952504933f, 0.703724861f},
-std::array<float,2>{0.385776877f, 0.525789917f},
-std::array<float,2>{0.756467044f, 0.316027135f},
-std::array<float,2>{0.143939048f, 0.21129328f},
-std::array<float,2>{0.673725188f, 0.916967571f},
-std::array<float,2>{0.247433275f, 0.680744171f},
-std::array<float,2>{0.697132707f, 0.47055757f},
-std::array<float,2>{0.479181319f, 0.00868606474f},
-std::array<float,2>{0.84925127f, 0.806114674f},
-std::array<float,2>{0.287050247f, 0.970788062f},
-std::array<float,2>{0.876543224f, 0.151061207f},
-std::array<float,2>{0.0296394639f, 0.28600055f},
-std::array<float,2>{0.610166132f, 0.585290551f},
-std::array<float,2>{0.164480105f, 0.881728232f},
-std::array<float,2>{0.639195681f, 0.241711423f},
-std::array<float,2>{0.429176867f, 0.350758761f},
-std::array<float,2>{0.800768435f, 0.54087162f},
-std::array<float,2>{0.36840418f, 0.730256498f},
-std::array<float,2>{0.97651583f, 0.391175359f},
-std::array<float,2>{0.0889641047f, 0.0667739958f},
-std::array<float,2>{0.501643479f, 0.822565079f},
-std::array<float,2>{0.0497667156f, 0.607030451f},
-std::array<float,2>{0.591988325f, 0.256276876f},
-std::array<float,2>{0.272314608f, 0.167783588f},
-std::array<float,2>{0.916981816f, 0.956444085f},
-std::array<float,2>{0.458319873f, 0.750660717f},
-std::array<float,2>{0.834533513f, 0.0435520113f},
-std::array<float,2>{0.201404765f, 0.465238541f},
-std::array<float,2>{0.727438807f, 0.656241536f},
-std::array<float,2>{0.00955406856f, 0.947305739f},
-std::array<float,2>{0.596920133f, 0.175746247f},
-std::array<float,2>{0.308130383f, 0.271806985f},
-std::array<float,2>{0.897635639f, 0.616334558f},
-std::array<float,2>{0.485442042f, 0.632410884f},
-std::array<float,2>{0.872015238f, 0.447634071f},
-std::array<float,2>{0.228758126f, 0.058836665f},
-std::array<float,2>{0.704568863f, 0.768156409f},
-std::array<float,2>{0.125114247f, 0.549119711f},
-std::array<float,2>{0.666642785f, 0.37426132f},
-std::array<float,2>{0.398126364f, 0.2240621f},
-std::array<float,2>{0.778529108f, 0.902877808f},
-std::array<float,2>{0.329048157f, 0.842744887f},
-std::array<float,2>{0.968496084f, 0.0845923498f},
-std::array<float,2>{0.122445822f, 0.38195622f},
-std::array<float,2>{0.536464572f, 0.742484748f},
-std::array<float,2>{0.21371533f, 0.794226706f},
-std::array<float,2>{0.744571269f, 0.0283441916f},
-std::array<float,2>{0.447082728f, 0.49728933f},
-std::array<float,2>{0.820737541f, 0.656632245f},
-std::array<float,2>{0.25466308f, 0.575105011f},
-std::array<float,2>{0.929169416f, 0.311070651f},
-std::array<float,2>{0.03674227f, 0.135289535f},
-std::array<float,2>{0.566328347f, 0.993241847f},
-std::array<float,2>{0.0651095584f, 0.693740785f},
-std::array<float,2>{0.526591718f, 0.431287527f},
-std::array<float,2>{0.345006973f, 0.123939075f},
-std::array<float,2>{0.988084078f, 0.84654367f},
-std::array<float,2>{0.415564477f, 0.928653777f},
-std::array<float,2>{0.79012394f, 0.19114165f},
-std::array<float,2>{0.180717841f, 0.340365142f},
-std::array<float,2>{0.646442413f, 0.509461403f},
-std::array<float,2>{0.039769154f, 0.781190276f},
-std::array<float,2>{0.574719191f, 0.050817661f},
-std::array<float,2>{0.258705944f, 0.441312373f},
-std::array<float,2>{0.933440685f, 0.638780892f},
-std::array<float,2>{0.438435882f, 0.621697187f},
-std::array<float,2>{0.815602183f, 0.275663078f},
-std::array<float,2>{0.204898268f, 0.187415749f},
-std::array<float,2>{0.735530138f, 0.941866636f},
-std::array<float,2>{0.178435907f, 0.739269733f},
-std::array<float,2>{0.650779247f, 0.388560683f},
-std::array<float,2>{0.408016175f, 0.0895465761f},
-std::array<float,2>{0.784271479f, 0.828130662f},
-std::array<float,2>{0.353984475f, 0.896390378f},
-std::array<float,2>{0.995747745f, 0.23311016f},
-std::array<float,2>{0.0703561381f, 0.364543378f},
-std::array<float,2>{0.519786179f, 0.556290865f},
-std::array<float,2>{0.22305277f, 0.985504389f},
-std::array<float,2>{0.715473115f, 0.131701514f},
-std::array<float,2>{0.495084852f, 0.298912019f},
-std::array<float,2>{0.862283945f, 0.56250751f},
-std::array<float,2>{0.300542474f, 0.664540827f},
-std::array<float,2>{0.901189923f, 0.491419584f},
-std::array<float,2>{0.00174312887f, 0.0158594809f},
-std::array<float,2>{0.606500626f, 0.781825304f},
-std::array<float,2>{0.112885237f, 0.501637876f},
-std::array<float,2>{0.542780697f, 0.335516512f},
-std::array<float,2>{0.336038858f, 0.200567484f},
-std::array<float,2>{0.958392799f, 0.933703125f},
-std::array<float,2>{0.399194896f, 0.854637206f},
-std::array<float,2>{0.772754014f, 0.112424463f},
-std::array<float,2>{0.135490358f, 0.427327901f},
-std::array<float,2>{0.660226345f, 0.697913826f},
-std::array<float,2>{0.0858385563f, 0.913732231f},
-std::array<float,2>{0.514763236f, 0.205325738f},
-std::array<float,2>{0.364524156f, 0.323744118f},
-std::array<float,2>{0.976925611f, 0.517403066f},
-std::array<float,2>{0.434443653f, 0.715676844f},
-std::array<float,2>{0.808981359f, 0.415425599f},
-std::array<float,2>{0.158981025f, 0.0981091186f},
-std::array<float,2>{0.626961946f, 0.864557922f},
-std::array<float,2>{0.189695597f, 0.590533674f},
-std::array<float,2>{0.725759685f, 0.296093404f},
-std::array<float,2>{0.465389311f, 0.147380292f},
-std::array<float,2>{0.837522686f, 0.984034777f},
-std::array<float,2>{0.278535128f, 0.798159182f},
-std::array<float,2>{0.906961679f, 0.000883737346f},
-std::array<float,2>{0.0588164777f, 0.477460653f},
-std::array<float,2>{0.581829488f, 0.673659027f},
-std::array<float,2>{0.155310974f, 0.816192985f},
-std::array<float,2>{0.685064316f, 0.0733027011f},
-std::array<float,2>{0.381125748f, 0.40249005f},
-std::array<float,2>{0.758768916f, 0.724761069f},
-std::array<float,2>{0.321771681f, 0.538279295f},
-std::array<float,2>{0.94206351f, 0.357713014f},
-std::array<float,2>{0.100524187f, 0.244035259f},
-std::array<float,2>{0.559678376f, 0.889603555f},
-std::array<float,2>{0.0222253576f, 0.643510938f},
-std::array<float,2>{0.619711161f, 0.457938254f},
-std::array<float,2>{0.290699333f, 0.0335540883f},
-std::array<float,2>{0.885946214f, 0.765143514f},
-std::array<float,2>{0.469465613f, 0.96858567f},
-std::array<float,2>{0.851978183f, 0.159120247f},
-std::array<float,2>{0.236112401f, 0.259541124f},
-std::array<float,2>{0.689325631f, 0.601225555f},
-std::array<float,2>{0.0269702878f, 0.834115803f},
-std::array<float,2>{0.615688443f, 0.0898589417f},
-std::array<float,2>{0.282002032f, 0.386363149f},
-std::array<float,2>{0.879229188f, 0.736020923f},
-std::array<float,2>{0.484036952f, 0.561848223f},
-std::array<float,2>{0.844700336f, 0.362229317f},
-std::array<float,2>{0.243791923f, 0.230417222f},
-std::array<float,2>{0.699869037f, 0.891217649f},
-std::array<float,2>{0.145001039f, 0.634103715f},
-std::array<float,2>{0.676942289f, 0.443349928f},
-std::array<float,2>{0.387608141f, 0.0498973988f},
-std::array<float,2>{0.751251638f, 0.775781214f},
-std::array<float,2>{0.313635558f, 0.939629436f},
-std::array<float,2>{0.945884407f, 0.180115893f},
-std::array<float,2>{0.108356006f, 0.277786613f},
-std::array<float,2>{0.554526091f, 0.62099123f},
-std::array<float,2>{0.199195892f, 0.930609345f},
-std::array<float,2>{0.730530262f, 0.197745174f},
-std::array<float,2>{0.455208123f, 0.329710454f},
-std::array<float,2>{0.83158344f, 0.50498575f},
-std::array<float,2>{0.268409014f, 0.700937271f},
-std::array<float,2>{0.919515848f, 0.422097623f},
-std::array<float,2>{0.0530950464f, 0.115166597f},
-std::array<float,2>{0.587015569f, 0.858271599f},
-std::array<float,2>{0.0925583541f, 0.568919957f},
-std::array<float,2>{0.505730867f, 0.304314047f},
-std::array<float,2>{0.37492764f, 0.125679284f},
-std::array<float,2>{0.96918577f, 0.991626263f},
-std::array<float,2>{0.425503612f, 0.786333919f},
-std::array<float,2>{0.803055286f, 0.0209836401f},
-std::array<float,2>{0.168246657f, 0.486410826f},
-std::array<float,2>{0.632813573f, 0.66922462f},
-std::array<float,2>{0.118239507f, 0.978295803f},
-std::array<float,2>{0.533195853f, 0.143993795f},
-std::array<float,2>{0.332783639f, 0.292029172f},
-std::array<float,2>{0.96249634f, 0.587081969f},
-std::array<float,2>{0.393768281f, 0.67647326f},
-std::array<float,2>{0.776621878f, 0.480811268f},
-std::array<float,2>{0.132474676f, 0.00494186627f},
-std::array<float,2>{0.669029772f, 0.801250935f},
-std::array<float,2>{0.230627209f, 0.520602286f},
-std::array<float,2>{0.709486961f, 0.326593667f},
-std::array<float,2>{0.490185827f, 0.210514814f},
-std::array<float,2>{0.868608594f, 0.909689784f},
-std::array<float,2>{0.309592277f, 0.860165715f},
-std::array<float,2>{0.891677082f, 0.0962899998f},
-std::array<float,2>{0.0128024882f, 0.418464333f},
-std::array<float,2>{0.59806633f, 0.714110792f},
-std::array<float,2>{0.186779171f, 0.760282934f},
-std::array<float,2>{0.64321202f, 0.0377290957f},
-std::array<float,2>{0.420986354f, 0.455515653f},
-std::array<float,2>{0.795615792f, 0.646321774f},
-std::array<float,2>{0.3502509f, 0.596297264f},
-std::array<float,2>{0.991040349f, 0.262524217f},
-std::array<float,2>{0.0675053373f, 0.162309855f},
-std::array<float,2>{0.529315174f, 0.962167025f},
-std::array<float,2>{0.0323681273f, 0.720620453f},
-std::array<float,2>{0.566795528f, 0.398610175f},
-std::array<float,2>{0.251814991f, 0.076156117f},
-std::array<float,2>{0.924129367f, 0.816882968f},
-std::array<float,2>{0.452935934f, 0.883497f},
-std::array<float,2>{0.826268792f, 0.24896948f},
-std::array<float,2>{0.217290655f, 0.351645708f},
-std::array<float,2>{0.74817431f, 0.53511095f},
-std::array<float,2>{0.0751230568f, 0.811671019f},
-std::array<float,2>{0.516142368f, 0.0118654212f},
-std::array<float,2>{0.356123507f, 0.47518912f},
-std::array<float,2>{0.998078167f, 0.683729351f},
-std::array<float,2>{0.410783499f, 0.578894138f},
-std::array<float,2>{0.785317481f, 0.281421214f},
-std::array<float,2>{0.171883926f, 0.154138669f},
-std::array<float,2>{0.652529716f, 0.974098146f},
-std::array<float,2>{0.210587054f, 0.709006369f},
-std::array<float,2>{0.741977155f, 0.408755451f},
-std::array<float,2>{0.444682777f, 0.107610315f},
-std::array<float,2>{0.820096076f, 0.874795854f},
-std::array<float,2>{0.265610605f, 0.921257138f},
-std::array<float,2>{0.935730159f, 0.217898384f},
-std::array<float,2>{0.0441626646f, 0.317458779f},
-std::array<float,2>{0.571524322f, 0.529805064f},
-std::array<float,2>{0.13808009f, 0.960609674f},
-std::array<float,2>{0.656515896f, 0.169517145f},
-std::array<float,2>{0.405012012f, 0.252732098f},
-std::array<float,2>{0.768283665f, 0.604588091f},
-std::array<float,2>{0.342523962f, 0.651727557f},
-std::array<float,2>{0.95432812f, 0.461832464f},
-std::array<float,2>{0.115164258f, 0.0429302193f},
-std::array<float,2>{0.543672144f, 0.756732285f},
-std::array<float,2>{0.00653309235f, 0.54649967f},
-std::array<float,2>{0.604445696f, 0.344602764f},
-std::array<float,2>{0.303023607f, 0.235506043f},
-std::array<float,2>{0.90448153f, 0.87674427f},
-std::array<float,2>{0.499513358f, 0.824885368f},
-std::array<float,2>{0.864131093f, 0.0629898608f},
-std::array<float,2>{0.221964985f, 0.396183223f},
-std::array<float,2>{0.711602151f, 0.730808139f},
-std::array<float,2>{0.0557271577f, 0.901342809f},
-std::array<float,2>{0.583143175f, 0.220932052f},
-std::array<float,2>{0.27410081f, 0.368445605f},
-std::array<float,2>{0.911275446f, 0.552002013f},
-std::array<float,2>{0.461527109f, 0.746663809f},
-std::array<float,2>{0.840059519f, 0.3766523f},
-std::array<float,2>{0.194205403f, 0.0815958753f},
-std::array<float,2>{0.72115314f, 0.838800132f},
-std::array<float,2>{0.161002219f, 0.6120345f},
-std::array<float,2>{0.630792618f, 0.269526124f},
-std::array<float,2>{0.432846397f, 0.17777659f},
-std::array<float,2>{0.805437505f, 0.951285839f},
-std::array<float,2>{0.362838238f, 0.7715289f},
-std::array<float,2>{0.983805835f, 0.055556383f},
-std::array<float,2>{0.080911994f, 0.449730337f},
-std::array<float,2>{0.509975731f, 0.628868997f},
-std::array<float,2>{0.239971057f, 0.849989474f},
-std::array<float,2>{0.692831576f, 0.118356451f},
-std::array<float,2>{0.474346012f, 0.435423374f},
-std::array<float,2>{0.855562091f, 0.690074861f},
-std::array<float,2>{0.296569318f, 0.514453769f},
-std::array<float,2>{0.88956517f, 0.338780463f},
-std::array<float,2>{0.018423669f, 0.194046885f},
-std::array<float,2>{0.622799754f, 0.922259271f},
-std::array<float,2>{0.0962926224f, 0.661698878f},
-std::array<float,2>{0.556578994f, 0.493022591f},
-std::array<float,2>{0.324457824f, 0.0266973153f},
-std::array<float,2>{0.939759493f, 0.790839016f},
-std::array<float,2>{0.377382249f, 0.998964787f},
-std::array<float,2>{0.764723539f, 0.137221232f},
-std::array<float,2>{0.149841726f, 0.308098346f},
-std::array<float,2>{0.683528543f, 0.570372522f},
-std::array<float,2>{0.0872943029f, 0.820517421f},
-std::array<float,2>{0.503019154f, 0.0695058331f},
-std::array<float,2>{0.370554686f, 0.393784225f},
-std::array<float,2>{0.973099589f, 0.727360606f},
-std::array<float,2>{0.426701277f, 0.542672575f},
-std::array<float,2>{0.79825604f, 0.3490251f},
-std::array<float,2>{0.167038083f, 0.23956266f},
-std::array<float,2>{0.637448072f, 0.880200028f},
-std::array<float,2>{0.200133458f, 0.653856158f},
-std::array<float,2>{0.730272532f, 0.466940224f},
-std::array<float,2>{0.459275305f, 0.0462247245f},
-std::array<float,2>{0.832840681f, 0.753003895f},
-std::array<float,2>{0.270056546f, 0.953222394f},
-std::array<float,2>{0.915587783f, 0.165256694f},
-std::array<float,2>{0.0484231599f, 0.254797667f},
-std::array<float,2>{0.591157794f, 0.607497156f},
-std::array<float,2>{0.140807256f, 0.914394259f},
-std::array<float,2>{0.67561084f, 0.214001372f},
-std::array<float,2>{0.383615583f, 0.313471437f},
-std::array<float,2>{0.755481482f, 0.523645401f},
-std::array<float,2>{0.317232341f, 0.705723405f},
-std::array<float,2>{0.951065898f, 0.411952645f},
-std::array<float,2>{0.105416454f, 0.102150507f},
-std::array<float,2>{0.547850609f, 0.869156897f},
-std::array<float,2>{0.0280652381f, 0.582929552f},
-std::array<float,2>{0.612490535f, 0.288417906f},
-std::array<float,2>{0.288132966f, 0.149384245f},
-std::array<float,2>{0.878448546f, 0.97051686f},
-std::array<float,2>{0.478169501f, 0.807011664f},
-std::array<float,2>{0.850271821f, 0.0113414302f},
-std::array<float,2>{0.249604568f, 0.470850199f},
-std::array<float,2>{0.697283804f, 0.682589591f},
-std::array<float,2>{0.0379459523f, 0.994654953f},
-std::array<float,2>{0.562788486f, 0.134392515f},
-std::array<float,2>{0.257411897f, 0.310545117f},
-std::array<float,2>{0.927473903f, 0.576325953f},
-std::array<float,2>{0.447801024f, 0.66003567f},
-std::array<float,2>{0.824067414f, 0.498922646f},
-std::array<float,2>{0.212041333f, 0.0311821084f},
-std::array<float,2>{0.742284477f, 0.795333982f},
-std::array<float,2>{0.182127014f, 0.510909081f},
-std::array<float,2>{0.646731257f, 0.343317538f},
-std::array<float,2>{0.416225195f, 0.187777117f},
-std::array<float,2>{0.791041911f, 0.925923288f},
-std::array<float,2>{0.347653508f, 0.845388591f},
-std::array<float,2>{0.984923899f, 0.122067258f},
-std::array<float,2>{0.0626675114f, 0.432241827f},
-std::array<float,2>{0.523640633f, 0.691921771f},
-std::array<float,2>{0.227162912f, 0.767321169f},
-std::array<float,2>{0.706956744f, 0.0614192523f},
-std::array<float,2>{0.488016516f, 0.445907921f},
-std::array<float,2>{0.874800622f, 0.629748523f},
-std::array<float,2>{0.304864764f, 0.614824891f},
-std::array<float,2>{0.895991206f, 0.270373821f},
-std::array<float,2>{0.0103405872f, 0.172281444f},
-std::array<float,2>{0.594486177f, 0.945866883f},
-std::array<float,2>{0.123136118f, 0.746015847f},
-std::array<float,2>{0.538739681f, 0.380262524f},
-std::array<float,2>{0.330129415f, 0.0830157995f},
-std::array<float,2>{0.965643346f, 0.841329575f},
-std::array<float,2>{0.396176308f, 0.905395865f},
-std::array<float,2>{0.779482424f, 0.225170895f},
-std::array<float,2>{0.127116829f, 0.37153542f},
-std::array<float,2>{0.665961385f, 0.547162116f},
-std::array<float,2>{0.00231498107f, 0.783395708f},
-std::array<float,2>{0.607559502f, 0.0186274033f},
-std::array<float,2>{0.298257321f, 0.488479257f},
-std::array<float,2>{0.898905635f, 0.666959643f},
-std::array<float,2>{0.492480308f, 0.565056324f},
-std::array<float,2>{0.859529793f, 0.297524184f},
-std::array<float,2>{0.226154834f, 0.129474893f},
-std::array<float,2>{0.718649566f, 0.987365782f},
-std::array<float,2>{0.133489937f, 0.696411073f},
-std::array<float,2>{0.663592696f, 0.42781359f},
-std::array<float,2>{0.400584877f, 0.110537834f},
-std::array<float,2>{0.770833611f, 0.852610588f},
-std::array<float,2>{0.338328302f, 0.936655402f},
-std::array<float,2>{0.96029079f, 0.201475486f},
-std::array<float,2>{0.110907339f, 0.332410753f},
-std::array<float,2>{0.540992618f, 0.503639579f},
-std::array<float,2>{0.205334738f, 0.94473964f},
-std::array<float,2>{0.737821579f, 0.184572011f},
-std::array<float,2>{0.440783232f, 0.274974465f},
-std::array<float,2>{0.812525928f, 0.624673963f},
-std::array<float,2>{0.259855181f, 0.63749975f},
-std::array<float,2>{0.930781305f, 0.438684732f},
-std::array<float,2>{0.0414366424f, 0.0543784723f},
-std::array<float,2>{0.576966166f, 0.778493762f},
-std::array<float,2>{0.0726687908f, 0.557833433f},
-std::array<float,2>{0.522889912f, 0.365495354f},
-std::array<float,2>{0.352839559f, 0.232150525f},
-std::array<float,2>{0.993010223f, 0.89656955f},
-std::array<float,2>{0.408482134f, 0.831480503f},
-std::array<float,2>{0.783089459f, 0.0866762325f},
-std::array<float,2>{0.176169977f, 0.389435321f},
-std::array<float,2>{0.649798632f, 0.740592897f},
-std::array<float,2>{0.0978935137f, 0.887465179f},
-std::array<float,2>{0.562063515f, 0.244234502f},
-std::array<float,2>{0.322463185f, 0.356480002f},
-std::array<float,2>{0.944772363f, 0.535199463f},
-std::array<float,2>{0.379373997f, 0.723446131f},
-std::array<float,2>{0.760223985f, 0.405034304f},
-std::array<float,2>{0.15263395f, 0.070397906f},
-std::array<float,2>{0.686348319f, 0.812740982f},
-std::array<float,2>{0.238000929f, 0.59902668f},
-std::array<float,2>{0.689699113f, 0.261556715f},
-std::array<float,2>{0.471585691f, 0.156705976f},
-std::array<float,2>{0.855327964f, 0.965672076f},
-std::array<float,2>{0.292403758f, 0.762934327f},
-std::array<float,2>{0.883322239f, 0.0331663117f},
-std::array<float,2>{0.0214766674f, 0.460395485f},
-std::array<float,2>{0.61893791f, 0.641195774f},
-std::array<float,2>{0.157969669f, 0.866252184f},
-std::array<float,2>{0.626862407f, 0.100328244f},
-std::array<float,2>{0.435561955f, 0.416291207f},
-std::array<float,2>{0.811239302f, 0.716992438f},
-std::array<float,2>{0.365344316f, 0.518107533f},
-std::array<float,2>{0.978526771f, 0.322193742f},
-std::array<float,2>{0.082846649f, 0.204066202f},
-std::array<float,2>{0.512222826f, 0.910377145f},
-std::array<float,2>{0.0623078607f, 0.674507618f},
-std::array<float,2>{0.579316556f, 0.479826212f},
-std::array<float,2>{0.28053686f, 0.00327381375f},
-std::array<float,2>{0.908879101f, 0.799331605f},
-std::array<float,2>{0.467579484f, 0.980832815f},
-std::array<float,2>{0.838974416f, 0.145237118f},
-std::array<float,2>{0.187747911f, 0.294683069f},
-std::array<float,2>{0.723390818f, 0.593736351f},
-std::array<float,2>{0.0522068776f, 0.856090963f},
-std::array<float,2>{0.588334024f, 0.116454758f},
-std::array<float,2>{0.26699844f, 0.424952298f},
-std::array<float,2>{0.921819627f, 0.701642632f},
-std::array<float,2>{0.45380792f, 0.50688082f},
-std::array<float,2>{0.828375816f, 0.331309319f},
-std::array<float,2>{0.19685474f, 0.19574061f},
-std::array<float,2>{0.734065771f, 0.933381855f},
-std::array<float,2>{0.171806157f, 0.670403957f},
-std::array<float,2>{0.635273993f, 0.485157698f},
-std::array<float,2>{0.422022015f, 0.023368828f},
-std::array<float,2>{0.802067101f, 0.787245274f},
-std::array<float,2>{0.371468842f, 0.989562273f},
-std::array<float,2>{0.970723629f, 0.127113476f},
-std::array<float,2>{0.0916430205f, 0.302415073f},
-std::array<float,2>{0.507696331f, 0.567046762f},
-std::array<float,2>{0.244926319f, 0.894300103f},
-std::array<float,2>{0.703089774f, 0.227814063f},
-std::array<float,2>{0.481625497f, 0.361237854f},
-std::array<float,2>{0.846974134f, 0.558802605f},
-std::array<float,2>{0.284413069f, 0.737316251f},
-std::array<float,2>{0.882430613f, 0.38314569f},
-std::array<float,2>{0.0236082431f, 0.093376562f},
-std::array<float,2>{0.614184022f, 0.833358586f},
-std::array<float,2>{0.107189469f, 0.618301153f},
-std::array<float,2>{0.552239358f, 0.279425353f},
-std::array<float,2>{0.31463477f, 0.183544397f},
-std::array<float,2>{0.949007571f, 0.939426959f},
-std::array<float,2>{0.390048116f, 0.774041176f},
-std::array<float,2>{0.752371371f, 0.0471454188f},
-std::array<float,2>{0.146540359f, 0.444234848f},
-std::array<float,2>{0.678389549f, 0.63556093f},
-std::array<float,2>{0.0690291002f, 0.96417433f},
-std::array<float,2>{0.528637767f, 0.160779938f},
-std::array<float,2>{0.34912917f, 0.264114201f},
-std::array<float,2>{0.988554299f, 0.594969571f},
-std::array<float,2>{0.419248164f, 0.646684349f},
-std::array<float,2>{0.793126523f, 0.453536987f},
-std::array<float,2>{0.184937447f, 0.0357135721f},
-std::array<float,2>{0.642130971f, 0.75880903f},
-std::array<float,2>{0.215012535f, 0.532607496f},
-std::array<float,2>{0.747137904f, 0.35406673f},
-std::array<float,2>{0.450137019f, 0.246241331f},
-std::array<float,2>{0.825174987f, 0.886504173f},
-std::array<float,2>{0.25298208f, 0.819215715f},
-std::array<float,2>{0.922329187f, 0.0763697624f},
-std::array<float,2>{0.0342785455f, 0.400842726f},
-std::array<float,2>{0.569063187f, 0.722435772f},
-std::array<float,2>{0.129545555f, 0.803460121f},
-std::array<float,2>{0.671743155f, 0.00593168288f},
-std::array<float,2>{0.391537637f, 0.48384729f},
-std::array<float,2>{0.773567855f, 0.677763402f},
-std::array<float,2>{0.334042996f, 0.58962822f},
-std::array<float,2>{0.963568985f, 0.290932596f},
-std::array<float,2>{0.1202427f, 0.1425464f},
-std::array<float,2>{0.534035265f, 0.97890985f},
-std::array<float,2>{0.0141958855f, 0.711766243f},
-std::array<float,2>{0.600492954f, 0.421505451f},
-std::array<float,2>{0.311407834f, 0.0954675078f},
-std::array<float,2>{0.892843366f, 0.861898959f},
-std::array<float,2>{0.492131293f, 0.906902075f},
-std::array<float,2>{0.870007157f, 0.207787603f},
-std::array<float,2>{0.234163597f, 0.325044811f},
-std::array<float,2>{0.708269238f, 0.522265494f},
-std::array<float,2>{0.11555209f, 0.755465269f},
-std::array<float,2>{0.545606196f, 0.0410067812f},
-std::array<float,2>{0.340827882f, 0.464513004f},
-std::array<float,2>{0.955078423f, 0.649801731f},
-std::array<float,2>{0.403165132f, 0.603279948f},
-std::array<float,2>{0.767005503f, 0.251686543f},
-std::array<float,2>{0.139470115f, 0.170535058f},
-std::array<float,2>{0.658638537f, 0.958224654f},
-std::array<float,2>{0.220530927f, 0.733033538f},
-std::array<float,2>{0.713882625f, 0.397748977f},
-std::array<float,2>{0.497025192f, 0.0647132173f},
-std::array<float,2>{0.86660713f, 0.827770829f},
-std::array<float,2>{0.300898314f, 0.877559006f},
-std::array<float,2>{0.90337497f, 0.236354634f},
-std::array<float,2>{0.00439508585f, 0.347282469f},
-std::array<float,2>{0.60258168f, 0.544020414f},
-std::array<float,2>{0.174349248f, 0.97538203f},
-std::array<float,2>{0.654371321f, 0.154711023f},
-std::array<float,2>{0.413314521f, 0.284422606f},
-std::array<float,2>{0.788755476f, 0.580771387f},
-std::array<float,2>{0.358208805f, 0.686211526f},
-std::array<float,2>{0.99753648f, 0.47308138f},
-std::array<float,2>{0.0777057633f, 0.0153051363f},
-std::array<float,2>{0.519528449f, 0.809353769f},
-std::array<float,2>{0.0451847538f, 0.5283705f},
-std::array<float,2>{0.573749363f, 0.319547236f},
-std::array<float,2>{0.26225096f, 0.215999305f},
-std::array<float,2>{0.935379863f, 0.919061601f},
-std::array<float,2>{0.442586184f, 0.872122884f},
-std::array<float,2>{0.818228006f, 0.106253818f},
-std::array<float,2>{0.207992122f, 0.407426178f},
-std::array<float,2>{0.73969233f, 0.708169401f},
-std::array<float,2>{0.0175626408f, 0.925496101f},
-std::array<float,2>{0.624034047f, 0.19231832f},
-std::array<float,2>{0.292990267f, 0.336682677f},
-std::array<float,2>{0.888570189f, 0.513536751f},
-std::array<float,2>{0.47502622f, 0.688185155f},
-std::array<float,2>{0.858862162f, 0.436157584f},
-std::array<float,2>{0.240702286f, 0.119646311f},
-std::array<float,2>{0.694997847f, 0.847869456f},
-std::array<float,2>{0.152115017f, 0.573314011f},
-std::array<float,2>{0.680334747f, 0.305162042f},
-std::array<float,2>{0.376801759f, 0.140587211f},
-std::array<float,2>{0.763119936f, 0.996258378f},
-std::array<float,2>{0.327826738f, 0.791438282f},
-std::array<float,2>{0.938417673f, 0.0250899717f},
-std::array<float,2>{0.0954287052f, 0.494683713f},
-std::array<float,2>{0.557214618f, 0.662620068f},
-std::array<float,2>{0.192688063f, 0.836149693f},
-std::array<float,2>{0.720196903f, 0.0796976611f},
-std::array<float,2>{0.463473529f, 0.377442479f},
-std::array<float,2>{0.842486501f, 0.748814106f},
-std::array<float,2>{0.277188092f, 0.552861989f},
-std::array<float,2>{0.914026022f, 0.370960712f},
-std::array<float,2>{0.0585011952f, 0.220417425f},
-std::array<float,2>{0.585564375f, 0.899977028f},
-std::array<float,2>{0.0795259476f, 0.62650162f},
-std::array<float,2>{0.509145856f, 0.452743262f},
-std::array<float,2>{0.361052305f, 0.057341706f},
-std::array<float,2>{0.980892837f, 0.77137059f},
-std::array<float,2>{0.430291295f, 0.951008916f},
-std::array<float,2>{0.807403982f, 0.176659375f},
-std::array<float,2>{0.163637951f, 0.267566413f},
-std::array<float,2>{0.632182062f, 0.609631002f},
-std::array<float,2>{0.121615194f, 0.840539873f},
-std::array<float,2>{0.535735071f, 0.0824371055f},
-std::array<float,2>{0.329313159f, 0.379681379f},
-std::array<float,2>{0.967597544f, 0.744300246f},
-std::array<float,2>{0.397431552f, 0.548258781f},
-std::array<float,2>{0.777881384f, 0.372825891f},
-std::array<float,2>{0.126847029f, 0.226289198f},
-std::array<float,2>{0.666992545f, 0.904805124f},
-std::array<float,2>{0.230034485f, 0.629989803f},
-std::array<float,2>{0.70394069f, 0.446406215f},
-std::array<float,2>{0.484586239f, 0.0621300451f},
-std::array<float,2>{0.872534692f, 0.766006589f},
-std::array<float,2>{0.307527661f, 0.947222769f},
-std::array<float,2>{0.896597207f, 0.173579976f},
-std::array<float,2>{0.00806115847f, 0.270596832f},
-std::array<float,2>{0.595884025f, 0.613876998f},
-std::array<float,2>{0.180365056f, 0.927295268f},
-std::array<float,2>{0.645070314f, 0.189029768f},
-std::array<float,2>{0.414707661f, 0.341962695f},
-std::array<float,2>{0.789122701f, 0.510584891f},
-std::array<float,2>{0.344444364f, 0.692456245f},
-std::array<float,2>{0.986976624f, 0.433025837f},
-std::array<float,2>{0.0662518963f, 0.122716427f},
-std::array<float,2>{0.526280463f, 0.843996704f},
-std::array<float,2>{0.0351786837f, 0.577815115f},
-std::array<float,2>{0.564838648f, 0.308885425f},
-std::array<float,2>{0.255841702f, 0.133787632f},
-std::array<float,2>{0.927791059f, 0.995411336f},
-std::array<float,2>{0.44561246f, 0.79632616f},
-std::array<float,2>{0.821518421f, 0.0294074416f},
-std::array<float,2>{0.214018643f, 0.49979645f},
-std::array<float,2>{0.745454133f, 0.658774316f},
-std::array<float,2>{0.0304686204f, 0.968751729f},
-std::array<float,2>{0.611192942f, 0.14985083f},
-std::array<float,2>{0.285830051f, 0.287321299f},
-std::array<float,2>{0.875445068f, 0.583271444f},
-std::array<float,2>{0.479810625f, 0.68306607f},
-std::array<float,2>{0.848581851f, 0.471797943f},
-std::array<float,2>{0.246888116f, 0.0102841649f},
-std::array<float,2>{0.695447206f, 0.808309615f},
-std::array<float,2>{0.142704502f, 0.524780571f},
-std::array<float,2>{0.672014594f, 0.314317524f},
-std::array<float,2>{0.385611832f, 0.213278159f},
-std::array<float,2>{0.757010162f, 0.915960193f},
-std::array<float,2>{0.319761842f, 0.870860219f},
-std::array<float,2>{0.951380968f, 0.103252247f},
-std::array<float,2>{0.101705581f, 0.410321325f},
-std::array<float,2>{0.550436854f, 0.706216931f},
-std::array<float,2>{0.202267453f, 0.752342701f},
-std::array<float,2>{0.728043497f, 0.0458843261f},
-std::array<float,2>{0.457309097f, 0.468730122f},
-std::array<float,2>{0.835213125f, 0.653262377f},
-std::array<float,2>{0.272698402f, 0.608508885f},
-std::array<float,2>{0.917076945f, 0.255191952f},
-std::array<float,2>{0.0507526845f, 0.164349884f},
-std::array<float,2>{0.593479693f, 0.954340696f},
-std::array<float,2>{0.0880180225f, 0.728077471f},
-std::array<float,2>{0.500038981f, 0.393404007f},
-std::array<float,2>{0.367822915f, 0.0690926313f},
-std::array<float,2>{0.975050092f, 0.822010577f},
-std::array<float,2>{0.428147197f, 0.879648626f},
-std::array<float,2>{0.799086154f, 0.238671497f},
-std::array<float,2>{0.165397882f, 0.347916722f},
-std::array<float,2>{0.640000224f, 0.541242599f},
-std::array<float,2>{0.0600164384f, 0.79985112f},
-std::array<float,2>{0.580587506f, 0.00274549914f},
-std::array<float,2>{0.278018534f, 0.479133993f},
-std::array<float,2>{0.907841504f, 0.675778508f},
-std::array<float,2>{0.466101915f, 0.591996014f},
-std::array<float,2>{0.836725712f, 0.293614537f},
-std::array<float,2>{0.190741137f, 0.145629629f},
-std::array<float,2>{0.725493491f, 0.981645346f},
-std::array<float,2>{0.159484699f, 0.71806252f},
-std::array<float,2>{0.628172517f, 0.417687356f},
-std::array<float,2>{0.435144484f, 0.10123755f},
-std::array<float,2>{0.810239732f, 0.86531812f},
-std::array<float,2>{0.363837749f, 0.911251366f},
-std::array<float,2>{0.977932513f, 0.204927757f},
-std::array<float,2>{0.0843849629f, 0.320485592f},
-std::array<float,2>{0.513918102f, 0.519384325f},
-std::array<float,2>{0.234814182f, 0.965958178f},
-std::array<float,2>{0.687779546f, 0.157366797f},
-std::array<float,2>{0.470157385f, 0.260167807f},
-std::array<float,2>{0.852740228f, 0.598024964f},
-std::array<float,2>{0.289940715f, 0.642262101f},
-std::array<float,2>{0.885082543f, 0.459114611f},
-std::array<float,2>{0.0230964161f, 0.0314420536f},
-std::array<float,2>{0.620537937f, 0.761777818f},
-std::array<float,2>{0.10065227f, 0.536319971f},
-std::array<float,2>{0.558832526f, 0.355602562f},
-std::array<float,2>{0.320529252f, 0.245334223f},
-std::array<float,2>{0.943055809f, 0.888132989f},
-std::array<float,2>{0.382697016f, 0.813500822f},
-std::array<float,2>{0.758855224f, 0.0721628293f},
-std::array<float,2>{0.155206382f, 0.40530625f},
-std::array<float,2>{0.684454203f, 0.724119604f},
-std::array<float,2>{0.0717050135f, 0.897789776f},
-std::array<float,2>{0.521196544f, 0.23055321f},
-std::array<float,2>{0.355374038f, 0.366723269f},
-std::array<float,2>{0.994404733f, 0.55758363f},
-std::array<float,2>{0.406319678f, 0.741394877f},
-std::array<float,2>{0.783462644f, 0.390328705f},
-std::array<float,2>{0.17883344f, 0.0877413377f},
-std::array<float,2>{0.65230459f, 0.830718637f},
-std::array<float,2>{0.203903407f, 0.623084426f},
-std::array<float,2>{0.735147893f, 0.273988605f},
-std::array<float,2>{0.439236403f, 0.183728322f},
-std::array<float,2>{0.815165043f, 0.943471253f},
-std::array<float,2>{0.259150386f, 0.777798057f},
-std::array<float,2>{0.932236075f, 0.0535897762f},
-std::array<float,2>{0.0407354161f, 0.437574983f},
-std::array<float,2>{0.575952947f, 0.638022304f},
-std::array<float,2>{0.135884255f, 0.852175355f},
-std::array<float,2>{0.66179657f, 0.110249519f},
-std::array<float,2>{0.399513334f, 0.429661661f},
-std::array<float,2>{0.772052586f, 0.695497811f},
-std::array<float,2>{0.337511063f, 0.502443969f},
-std::array<float,2>{0.957641602f, 0.333746016f},
-std::array<float,2>{0.111669555f, 0.202615365f},
-std::array<float,2>{0.541387677f, 0.936379075f},
-std::array<float,2>{2.79571286e-05f, 0.667691529f},
-std::array<float,2>{0.605680466f, 0.490124911f},
-std::array<float,2>{0.299319476f, 0.0177495591f},
-std::array<float,2>{0.902078807f, 0.784564435f},
-std::array<float,2>{0.495348215f, 0.986803472f},
-std::array<float,2>{0.862609148f, 0.130037159f},
-std::array<float,2>{0.224454939f, 0.298593014f},
-std::array<float,2>{0.716017783f, 0.565704644f},
-std::array<float,2>{0.0118317697f, 0.862842679f},
-std::array<float,2>{0.599431872f, 0.0943431109f},
-std::array<float,2>{0.309024006f, 0.420135885f},
-std::array<float,2>{0.891240835f, 0.712828398f},
-std::array<float,2>{0.48830995f, 0.522831738f},
-std::array<float,2>{0.868097842f, 0.326125056f},
-std::array<float,2>{0.23235099f, 0.20856832f},
-std::array<float,2>{0.710708559f, 0.907375872f},
-std::array<float,2>{0.131440952f, 0.678865969f},
-std::array<float,2>{0.668651998f, 0.482866406f},
-std::array<float,2>{0.393170744f, 0.00750838453f},
-std::array<float,2>{0.776275277f, 0.80401659f},
-std::array<float,2>{0.333609164f, 0.979608655f},
-std::array<float,2>{0.961535692f, 0.140793666f},
-std::array<float,2>{0.117595635f, 0.289584488f},
-std::array<float,2>{0.531789422f, 0.588362694f},
-std::array<float,2>{0.218061373f, 0.884842038f},
-std::array<float,2>{0.749420345f, 0.24802199f},
-std::array<float,2>{0.451586992f, 0.355461329f},
-std::array<float,2>{0.827686489f, 0.531538188f},
-std::array<float,2>{0.250263989f, 0.721110463f},
-std::array<float,2>{0.925444007f, 0.401675671f},
-std::array<float,2>{0.032180801f, 0.0780446529f},
-std::array<float,2>{0.568241f, 0.819831848f},
-std::array<float,2>{0.0669201761f, 0.594172716f},
-std::array<float,2>{0.531077623f, 0.265586674f},
-std::array<float,2>{0.350872785f, 0.161404923f},
-std::array<float,2>{0.991307616f, 0.963850319f},
-std::array<float,2>{0.419992477f, 0.758630276f},
-std::array<float,2>{0.795976639f, 0.0362476967f},
-std::array<float,2>{0.185594872f, 0.454461843f},
-std::array<float,2>{0.644378781f, 0.647720456f},
-std::array<float,2>{0.109260246f, 0.937782109f},
-std::array<float,2>{0.553009093f, 0.182174981f},
-std::array<float,2>{0.31346488f, 0.281023681f},
-std::array<float,2>{0.947120488f, 0.617461681f},
-std::array<float,2>{0.387857139f, 0.63617146f},
-std::array<float,2>{0.750809908f, 0.444959402f},
-std::array<float,2>{0.145765662f, 0.0484608077f},
-std::array<float,2>{0.67649883f, 0.774504721f},
-std::array<float,2>{0.242795527f, 0.560429394f},
-std::array<float,2>{0.70050174f, 0.35994491f},
-std::array<float,2>{0.482506484f, 0.227354199f},
-std::array<float,2>{0.845168889f, 0.893132508f},
-std::array<float,2>{0.282813132f, 0.832919657f},
-std::array<float,2>{0.880719543f, 0.0926736966f},
-std::array<float,2>{0.0262571052f, 0.384395063f},
-std::array<float,2>{0.616830111f, 0.736395836f},
-std::array<float,2>{0.169288337f, 0.788202107f},
-std::array<float,2>{0.634557426f, 0.0221762154f},
-std::array<float,2>{0.424180418f, 0.486327589f},
-std::array<float,2>{0.803787529f, 0.671560049f},
-std::array<float,2>{0.373199046f, 0.568041801f},
-std::array<float,2>{0.969738185f, 0.301600069f},
-std::array<float,2>{0.0931404456f, 0.128418952f},
-std::array<float,2>{0.503993273f, 0.988514304f},
-std::array<float,2>{0.0543187335f, 0.702685356f},
-std::array<float,2>{0.586084485f, 0.423936963f},
-std::array<float,2>{0.269187629f, 0.115807086f},
-std::array<float,2>{0.91860956f, 0.856711268f},
-std::array<float,2>{0.456225663f, 0.931941092f},
-std::array<float,2>{0.830376446f, 0.197238922f},
-std::array<float,2>{0.197911352f, 0.330809951f},
-std::array<float,2>{0.731756985f, 0.506500065f},
-std::array<float,2>{0.0813947171f, 0.770232379f},
-std::array<float,2>{0.510938108f, 0.0583679341f},
-std::array<float,2>{0.362088591f, 0.452125192f},
-std::array<float,2>{0.982425809f, 0.625462174f},
-std::array<float,2>{0.432247341f, 0.610484183f},
-std::array<float,2>{0.806101859f, 0.266326159f},
-std::array<float,2>{0.16209057f, 0.177030742f},
-std::array<float,2>{0.629582345f, 0.949576676f},
-std::array<float,2>{0.194494739f, 0.749148667f},
-std::array<float,2>{0.722637773f, 0.378051847f},
-std::array<float,2>{0.462688982f, 0.0783383027f},
-std::array<float,2>{0.841024339f, 0.837533772f},
-std::array<float,2>{0.274722248f, 0.898491681f},
-std::array<float,2>{0.910729587f, 0.219293773f},
-std::array<float,2>{0.0548559614f, 0.36926204f},
-std::array<float,2>{0.582761228f, 0.554571271f},
-std::array<float,2>{0.149190381f, 0.99790889f},
-std::array<float,2>{0.682357192f, 0.139600143f},
-std::array<float,2>{0.37859118f, 0.305838585f},
-std::array<float,2>{0.763862431f, 0.572881937f},
-std::array<float,2>{0.325754911f, 0.66397959f},
-std::array<float,2>{0.941080987f, 0.495868295f},
-std::array<float,2>{0.0972832218f, 0.023543369f},
-std::array<float,2>{0.554968119f, 0.792155623f},
-std::array<float,2>{0.0189983789f, 0.511829019f},
-std::array<float,2>{0.622062087f, 0.337580562f},
-std::array<float,2>{0.295006961f, 0.192632362f},
-std::array<float,2>{0.890290439f, 0.924094617f},
-std::array<float,2>{0.473096132f, 0.848652303f},
-std::array<float,2>{0.85727185f, 0.12097688f},
-std::array<float,2>{0.238888234f, 0.436735302f},
-std::array<float,2>{0.691510797f, 0.688937128f},
-std::array<float,2>{0.0433169231f, 0.918707788f},
-std::array<float,2>{0.570945859f, 0.214965358f},
-std::array<float,2>{0.263878167f, 0.319273502f},
-std::array<float,2>{0.936674654f, 0.527483702f},
-std::array<float,2>{0.444253027f, 0.707261205f},
-std::array<float,2>{0.818864882f, 0.406951874f},
-std::array<float,2>{0.209750876f, 0.107359305f},
-std::array<float,2>{0.741073847f, 0.871946335f},
-std::array<float,2>{0.173034668f, 0.581775904f},
-std::array<float,2>{0.653383434f, 0.284088463f},
-std::array<float,2>{0.411893964f, 0.155798107f},
-std::array<float,2>{0.786250532f, 0.975689173f},
-std::array<float,2>{0.357243985f, 0.809766471f},
-std::array<float,2>{0.999235213f, 0.0140636936f},
-std::array<float,2>{0.0755554289f, 0.474054784f},
-std::array<float,2>{0.51738143f, 0.686608791f},
-std::array<float,2>{0.221610025f, 0.826333761f},
-std::array<float,2>{0.712620139f, 0.0659122318f},
-std::array<float,2>{0.498386174f, 0.396558881f},
-std::array<float,2>{0.865107477f, 0.73363167f},
-std::array<float,2>{0.303893089f, 0.542994797f},
-std::array<float,2>{0.905512989f, 0.346171826f},
-std::array<float,2>{0.00711183948f, 0.237974674f},
-std::array<float,2>{0.605415463f, 0.878679097f},
-std::array<float,2>{0.113611348f, 0.648623586f},
-std::array<float,2>{0.544921815f, 0.463457197f},
-std::array<float,2>{0.342802227f, 0.0391853675f},
-std::array<float,2>{0.95343703f, 0.754630089f},
-std::array<float,2>{0.405559659f, 0.95768863f},
-std::array<float,2>{0.769456923f, 0.171761841f},
-std::array<float,2>{0.137694448f, 0.250164926f},
-std::array<float,2>{0.658026218f, 0.601676583f},
-std::array<float,2>{0.0636730567f, 0.84684217f},
-std::array<float,2>{0.525257051f, 0.124506056f},
-std::array<float,2>{0.34654218f, 0.430025548f},
-std::array<float,2>{0.985843718f, 0.695242703f},
-std::array<float,2>{0.417611092f, 0.507961571f},
-std::array<float,2>{0.792672217f, 0.340934396f},
-std::array<float,2>{0.183278143f, 0.190284416f},
-std::array<float,2>{0.647550046f, 0.928715348f},
-std::array<float,2>{0.211672321f, 0.657287955f},
-std::array<float,2>{0.743831754f, 0.496411234f},
-std::array<float,2>{0.448552608f, 0.0283005629f},
-std::array<float,2>{0.822944343f, 0.793366313f},
-std::array<float,2>{0.25614363f, 0.992962062f},
-std::array<float,2>{0.926420867f, 0.136330903f},
-std::array<float,2>{0.0385058932f, 0.311907291f},
-std::array<float,2>{0.564086854f, 0.5761711f},
-std::array<float,2>{0.128484547f, 0.903618634f},
-std::array<float,2>{0.664395571f, 0.22272557f},
-std::array<float,2>{0.394718051f, 0.373268217f},
-std::array<float,2>{0.781077981f, 0.550736547f},
-std::array<float,2>{0.331078559f, 0.74327004f},
-std::array<float,2>{0.965840459f, 0.381480098f},
-std::array<float,2>{0.124609932f, 0.0855539516f},
-std::array<float,2>{0.538051784f, 0.843189657f},
-std::array<float,2>{0.0108091589f, 0.616091907f},
-std::array<float,2>{0.595320821f, 0.272603303f},
-std::array<float,2>{0.306351155f, 0.174718931f},
-std::array<float,2>{0.894729376f, 0.948535919f},
-std::array<float,2>{0.487038195f, 0.768719196f},
-std::array<float,2>{0.873086095f, 0.0601330101f},
-std::array<float,2>{0.227775231f, 0.448937476f},
-std::array<float,2>{0.70534718f, 0.631423771f},
-std::array<float,2>{0.047203932f, 0.955202818f},
-std::array<float,2>{0.590424359f, 0.166106239f},
-std::array<float,2>{0.271084994f, 0.257336617f},
-std::array<float,2>{0.914596021f, 0.605928481f},
-std::array<float,2>{0.460514158f, 0.655140877f},
-std::array<float,2>{0.833311975f, 0.466030538f},
-std::array<float,2>{0.200958505f, 0.0446389876f},
-std::array<float,2>{0.729470968f, 0.751585484f},
-std::array<float,2>{0.166623637f, 0.539108217f},
-std::array<float,2>{0.637710571f, 0.350550652f},
-std::array<float,2>{0.427025735f, 0.241138786f},
-std::array<float,2>{0.797002017f, 0.882136405f},
-std::array<float,2>{0.369667232f, 0.824174225f},
-std::array<float,2>{0.97391367f, 0.0674104169f},
-std::array<float,2>{0.0861475617f, 0.391998351f},
-std::array<float,2>{0.502560079f, 0.729194641f},
-std::array<float,2>{0.248859882f, 0.80513078f},
-std::array<float,2>{0.698784053f, 0.00935494341f},
-std::array<float,2>{0.476571769f, 0.469660461f},
-std::array<float,2>{0.851074159f, 0.680281699f},
-std::array<float,2>{0.287613273f, 0.584330857f},
-std::array<float,2>{0.877564967f, 0.286404818f},
-std::array<float,2>{0.0290329754f, 0.152166098f},
-std::array<float,2>{0.612276733f, 0.972572863f},
-std::array<float,2>{0.103731185f, 0.7044487f},
-std::array<float,2>{0.548414111f, 0.412639141f},
-std::array<float,2>{0.317703545f, 0.104901582f},
-std::array<float,2>{0.949593067f, 0.868526936f},
-std::array<float,2>{0.384152353f, 0.917788029f},
-std::array<float,2>{0.754631042f, 0.21201092f},
-std::array<float,2>{0.142389327f, 0.314711183f},
-std::array<float,2>{0.674379289f, 0.52687192f},
-std::array<float,2>{0.0201034285f, 0.76431483f},
-std::array<float,2>{0.617880285f, 0.0351459756f},
-std::array<float,2>{0.291566104f, 0.458804727f},
-std::array<float,2>{0.884062171f, 0.644030392f},
-std::array<float,2>{0.47244972f, 0.60003221f},
-std::array<float,2>{0.853879571f, 0.258247226f},
-std::array<float,2>{0.236924201f, 0.159610927f},
-std::array<float,2>{0.690852582f, 0.967271507f},
-std::array<float,2>{0.153596029f, 0.725761116f},
-std::array<float,2>{0.687068284f, 0.404248685f},
-std::array<float,2>{0.380022913f, 0.0724330172f},
-std::array<float,2>{0.760901093f, 0.815321326f},
-std::array<float,2>{0.324154377f, 0.890160859f},
-std::array<float,2>{0.94375962f, 0.242321402f},
-std::array<float,2>{0.0990626812f, 0.35840705f},
-std::array<float,2>{0.561350167f, 0.53753984f},
-std::array<float,2>{0.188497588f, 0.982479155f},
-std::array<float,2>{0.723859191f, 0.147665218f},
-std::array<float,2>{0.468617231f, 0.295514911f},
-std::array<float,2>{0.838536501f, 0.591227174f},
-std::array<float,2>{0.2795856f, 0.672264397f},
-std::array<float,2>{0.909525275f, 0.47824502f},
-std::array<float,2>{0.0610692687f, 0.000994128059f},
-std::array<float,2>{0.57838285f, 0.797716558f},
-std::array<float,2>{0.0837738439f, 0.515894055f},
-std::array<float,2>{0.512823939f, 0.323165178f},
-std::array<float,2>{0.366750896f, 0.206304371f},
-std::array<float,2>{0.980255485f, 0.912648439f},
-std::array<float,2>{0.437447309f, 0.863667965f},
-std::array<float,2>{0.812270045f, 0.099220939f},
-std::array<float,2>{0.157136187f, 0.414316535f},
-std::array<float,2>{0.625947177f, 0.715924501f},
-std::array<float,2>{0.109797694f, 0.93554157f},
-std::array<float,2>{0.539658904f, 0.199328706f},
-std::array<float,2>{0.339626312f, 0.334386647f},
-std::array<float,2>{0.959896684f, 0.500558436f},
-std::array<float,2>{0.401916236f, 0.699043393f},
-std::array<float,2>{0.770420253f, 0.425968528f},
-std::array<float,2>{0.134229884f, 0.111648314f},
-std::array<float,2>{0.662871778f, 0.853816926f},
-std::array<float,2>{0.225454986f, 0.563551962f},
-std::array<float,2>{0.716925621f, 0.3004103f},
-std::array<float,2>{0.493625075f, 0.132342547f},
-std::array<float,2>{0.860503972f, 0.98452729f},
-std::array<float,2>{0.297071755f, 0.782703817f},
-std::array<float,2>{0.899719715f, 0.0171534885f},
-std::array<float,2>{0.00308431662f, 0.490824252f},
-std::array<float,2>{0.608831406f, 0.665766537f},
-std::array<float,2>{0.17749308f, 0.829411805f},
-std::array<float,2>{0.649214029f, 0.0887799785f},
-std::array<float,2>{0.409989685f, 0.387649328f},
-std::array<float,2>{0.781821609f, 0.738934636f},
-std::array<float,2>{0.352285147f, 0.554700315f},
-std::array<float,2>{0.99366945f, 0.363678962f},
-std::array<float,2>{0.0734184384f, 0.234269068f},
-std::array<float,2>{0.521962345f, 0.895446777f},
-std::array<float,2>{0.0421156846f, 0.639814019f},
-std::array<float,2>{0.57757926f, 0.439949572f},
-std::array<float,2>{0.261045188f, 0.0523839965f},
-std::array<float,2>{0.930416822f, 0.779812694f},
-std::array<float,2>{0.440322995f, 0.942475975f},
-std::array<float,2>{0.813724637f, 0.186448544f},
-std::array<float,2>{0.206988335f, 0.277293921f},
-std::array<float,2>{0.736660361f, 0.622843504f},
-std::array<float,2>{0.0340683125f, 0.817463934f},
-std::array<float,2>{0.569887757f, 0.074295029f},
-std::array<float,2>{0.252542406f, 0.400109828f},
-std::array<float,2>{0.923479557f, 0.719352901f},
-std::array<float,2>{0.451157004f, 0.533899307f},
-std::array<float,2>{0.825519502f, 0.352567106f},
-std::array<float,2>{0.216647357f, 0.249504447f},
-std::array<float,2>{0.74679774f, 0.884491086f},
-std::array<float,2>{0.18418543f, 0.644717455f},
-std::array<float,2>{0.640761375f, 0.456846088f},
-std::array<float,2>{0.418336809f, 0.0388345271f},
-std::array<float,2>{0.794555724f, 0.761585951f},
-std::array<float,2>{0.348205656f, 0.96099329f},
-std::array<float,2>{0.989424169f, 0.163129002f},
-std::array<float,2>{0.0693553835f, 0.262886435f},
-std::array<float,2>{0.52752918f, 0.597288489f},
-std::array<float,2>{0.232464731f, 0.908776939f},
-std::array<float,2>{0.70765841f, 0.209701955f},
-std::array<float,2>{0.490908533f, 0.328058839f},
-std::array<float,2>{0.870895505f, 0.520311296f},
-std::array<float,2>{0.311802268f, 0.713610411f},
-std::array<float,2>{0.893705964f, 0.419142634f},
-std::array<float,2>{0.0155010587f, 0.0975669548f},
-std::array<float,2>{0.60123986f, 0.860657334f},
-std::array<float,2>{0.119993493f, 0.586088777f},
-std::array<float,2>{0.534695029f, 0.291405797f},
-std::array<float,2>{0.335723281f, 0.142613068f},
-std::array<float,2>{0.964185715f, 0.976920664f},
-std::array<float,2>{0.392569005f, 0.802665174f},
-std::array<float,2>{0.774708688f, 0.00409908639f},
-std::array<float,2>{0.130422309f, 0.482212573f},
-std::array<float,2>{0.67033428f, 0.676786065f},
-std::array<float,2>{0.0902603269f, 0.990865469f},
-std::array<float,2>{0.50682956f, 0.126110777f},
-std::array<float,2>{0.372257978f, 0.302788734f},
-std::array<float,2>{0.97223264f, 0.570099771f},
-std::array<float,2>{0.423772305f, 0.668563783f},
-std::array<float,2>{0.801114678f, 0.488162965f},
-std::array<float,2>{0.170321569f, 0.0199129749f},
-std::array<float,2>{0.636112094f, 0.785303116f},
-std::array<float,2>{0.19551149f, 0.504403412f},
-std::array<float,2>{0.732953787f, 0.328555018f},
-std::array<float,2>{0.454821795f, 0.198560849f},
-std::array<float,2>{0.829299688f, 0.930858374f},
-std::array<float,2>{0.26649189f, 0.858638644f},
-std::array<float,2>{0.920005143f, 0.113591567f},
-std::array<float,2>{0.0508780032f, 0.422856241f},
-std::array<float,2>{0.589218199f, 0.699383318f},
-std::array<float,2>{0.147567317f, 0.776730537f},
-std::array<float,2>{0.678755164f, 0.0491533764f},
-std::array<float,2>{0.389002323f, 0.44160524f},
-std::array<float,2>{0.753256023f, 0.633396208f},
-std::array<float,2>{0.315590322f, 0.619633853f},
-std::array<float,2>{0.947700858f, 0.27833885f},
-std::array<float,2>{0.106141485f, 0.181206375f},
-std::array<float,2>{0.551212311f, 0.94134295f},
-std::array<float,2>{0.0253001601f, 0.734801769f},
-std::array<float,2>{0.614811957f, 0.385713488f},
-std::array<float,2>{0.284066826f, 0.0917472914f},
-std::array<float,2>{0.881129801f, 0.835838616f},
-std::array<float,2>{0.48098138f, 0.892141104f},
-std::array<float,2>{0.846191168f, 0.228536084f},
-std::array<float,2>{0.245599359f, 0.362883896f},
-std::array<float,2>{0.701747119f, 0.561186373f},
-std::array<float,2>{0.0947197303f, 0.789984941f},
-std::array<float,2>{0.558120787f, 0.0261228029f},
-std::array<float,2>{0.326618105f, 0.493361831f},
-std::array<float,2>{0.939450085f, 0.660648823f},
-std::array<float,2>{0.375205517f, 0.572078228f},
-std::array<float,2>{0.761818171f, 0.306774318f},
-std::array<float,2>{0.150401935f, 0.137974352f},
-std::array<float,2>{0.681081057f, 0.999936521f},
-std::array<float,2>{0.241657898f, 0.691064179f},
-std::array<float,2>{0.693632483f, 0.434334993f},
-std::array<float,2>{0.476010084f, 0.117987834f},
-std::array<float,2>{0.857618928f, 0.851325095f},
-std::array<float,2>{0.294817418f, 0.923529088f},
-std::array<float,2>{0.886824727f, 0.195257545f},
-std::array<float,2>{0.0159321427f, 0.339217097f},
-std::array<float,2>{0.623749852f, 0.515574753f},
-std::array<float,2>{0.162859529f, 0.952200234f},
-std::array<float,2>{0.631551385f, 0.179245129f},
-std::array<float,2>{0.431554765f, 0.268301427f},
-std::array<float,2>{0.807770848f, 0.612703323f},
-std::array<float,2>{0.359969914f, 0.626978636f},
-std::array<float,2>{0.981839418f, 0.451081872f},
-std::array<float,2>{0.0784946084f, 0.0560995415f},
-std::array<float,2>{0.508242011f, 0.773028851f},
-std::array<float,2>{0.0566504709f, 0.551711261f},
-std::array<float,2>{0.584297776f, 0.367598802f},
-std::array<float,2>{0.27602312f, 0.222655684f},
-std::array<float,2>{0.912864745f, 0.902031302f},
-std::array<float,2>{0.464310169f, 0.839679539f},
-std::array<float,2>{0.843106091f, 0.0804095119f},
-std::array<float,2>{0.191890091f, 0.375286043f},
-std::array<float,2>{0.719061315f, 0.74730587f},
-std::array<float,2>{0.00576209323f, 0.875334799f},
-std::array<float,2>{0.602398098f, 0.23448804f},
-std::array<float,2>{0.302730948f, 0.345149457f},
-std::array<float,2>{0.902581692f, 0.545359373f},
-std::array<float,2>{0.49794668f, 0.731626689f},
-std::array<float,2>{0.866155803f, 0.394766033f},
-std::array<float,2>{0.21916838f, 0.0640316457f},
-std::array<float,2>{0.713121533f, 0.825709999f},
-std::array<float,2>{0.140163988f, 0.603634119f},
-std::array<float,2>{0.659820437f, 0.253535151f},
-std::array<float,2>{0.403461486f, 0.167979121f},
-std::array<float,2>{0.765759468f, 0.959714592f},
-std::array<float,2>{0.340749919f, 0.75703001f},
-std::array<float,2>{0.956671596f, 0.0413511619f},
-std::array<float,2>{0.116917402f, 0.46279487f},
-std::array<float,2>{0.546324909f, 0.651330233f},
-std::array<float,2>{0.208441883f, 0.873887181f},
-std::array<float,2>{0.738965631f, 0.109164186f},
-std::array<float,2>{0.441913515f, 0.409210384f},
-std::array<float,2>{0.816975176f, 0.710083008f},
-std::array<float,2>{0.263465255f, 0.530332327f},
-std::array<float,2>{0.934453309f, 0.31666702f},
-std::array<float,2>{0.0459522791f, 0.217607424f},
-std::array<float,2>{0.573193312f, 0.920774579f},
-std::array<float,2>{0.0764618069f, 0.68476069f},
-std::array<float,2>{0.517867982f, 0.475589454f},
-std::array<float,2>{0.359008342f, 0.0129940668f},
-std::array<float,2>{0.996335149f, 0.811119497f},
-std::array<float,2>{0.412297487f, 0.973624885f},
-std::array<float,2>{0.787736416f, 0.152696609f},
-std::array<float,2>{0.175422132f, 0.282631695f},
-std::array<float,2>{0.655446649f, 0.579368591f},
-std::array<float,2>{0.11226251f, 0.854261458f},
-std::array<float,2>{0.541638613f, 0.111990355f},
-std::array<float,2>{0.337274581f, 0.426511437f},
-std::array<float,2>{0.957171381f, 0.698481381f},
-std::array<float,2>{0.400061905f, 0.500271916f},
-std::array<float,2>{0.771595895f, 0.334602177f},
-std::array<float,2>{0.136667714f, 0.20014143f},
-std::array<float,2>{0.661144733f, 0.935050309f},
-std::array<float,2>{0.22385639f, 0.66527915f},
-std::array<float,2>{0.716328561f, 0.490381628f},
-std::array<float,2>{0.495751619f, 0.0168981086f},
-std::array<float,2>{0.863017142f, 0.782740176f},
-std::array<float,2>{0.299163431f, 0.985343099f},
-std::array<float,2>{0.90184474f, 0.132162631f},
-std::array<float,2>{0.00092920271f, 0.299874514f},
-std::array<float,2>{0.60617739f, 0.564392567f},
-std::array<float,2>{0.179266036f, 0.894749284f},
-std::array<float,2>{0.651680112f, 0.233782157f},
-std::array<float,2>{0.406759113f, 0.363837153f},
-std::array<float,2>{0.783833385f, 0.555228531f},
-std::array<float,2>{0.354715347f, 0.738426626f},
-std::array<float,2>{0.99501884f, 0.387058467f},
-std::array<float,2>{0.0719675422f, 0.0883168876f},
-std::array<float,2>{0.52095753f, 0.830026746f},
-std::array<float,2>{0.0403030552f, 0.622101367f},
-std::array<float,2>{0.575334251f, 0.276794434f},
-std::array<float,2>{0.259396434f, 0.185549334f},
-std::array<float,2>{0.931646526f, 0.943325758f},
-std::array<float,2>{0.438668519f, 0.779711187f},
-std::array<float,2>{0.81481123f, 0.0517774262f},
-std::array<float,2>{0.203582823f, 0.439655036f},
-std::array<float,2>{0.73480165f, 0.640302896f},
-std::array<float,2>{0.0227870997f, 0.967565656f},
-std::array<float,2>{0.620827019f, 0.159828663f},
-std::array<float,2>{0.289432853f, 0.258330226f},
-std::array<float,2>{0.88528043f, 0.600361764f},
-std::array<float,2>{0.470221728f, 0.644066989f},
-std::array<float,2>{0.853098929f, 0.458350688f},
-std::array<float,2>{0.234956786f, 0.0343530364f},
-std::array<float,2>{0.688216388f, 0.763974428f},
-std::array<float,2>{0.154499993f, 0.537755728f},
-std::array<float,2>{0.68393749f, 0.359195948f},
-std::array<float,2>{0.381884843f, 0.243144959f},
-std::array<float,2>{0.759324491f, 0.889690816f},
-std::array<float,2>{0.321119696f, 0.814565897f},
-std::array<float,2>{0.94284153f, 0.0730739608f},
-std::array<float,2>{0.101221032f, 0.403636217f},
-std::array<float,2>{0.55948323f, 0.72649765f},
-std::array<float,2>{0.190922812f, 0.797103167f},
-std::array<float,2>{0.72503525f, 0.00170380564f},
-std::array<float,2>{0.466310352f, 0.477729678f},
-std::array<float,2>{0.836228669f, 0.672380626f},
-std::array<float,2>{0.277779698f, 0.591733336f},
-std::array<float,2>{0.90750587f, 0.295010895f},
-std::array<float,2>{0.060505271f, 0.148105323f},
-std::array<float,2>{0.580201745f, 0.98294878f},
-std::array<float,2>{0.0847792849f, 0.716322005f},
-std::array<float,2>{0.514516234f, 0.415028244f},
-std::array<float,2>{0.363620698f, 0.098666735f},
-std::array<float,2>{0.978273511f, 0.864198327f},
-std::array<float,2>{0.435019165f, 0.912137985f},
-std::array<float,2>{0.809577465f, 0.206646875f},
-std::array<float,2>{0.15984337f, 0.322559386f},
-std::array<float,2>{0.628626227f, 0.516220868f},
-std::array<float,2>{0.0500121824f, 0.751305163f},
-std::array<float,2>{0.593051493f, 0.0441058092f},
-std::array<float,2>{0.273366451f, 0.466563404f},
-std::array<float,2>{0.917901218f, 0.654430985f},
-std::array<float,2>{0.457544744f, 0.60601759f},
-std::array<float,2>{0.835658967f, 0.256969571f},
-std::array<float,2>{0.202742964f, 0.166561931f},
-std::array<float,2>{0.727700949f, 0.955982268f},
-std::array<float,2>{0.16601041f, 0.728859961f},
-std::array<float,2>{0.640547693f, 0.392162412f},
-std::array<float,2>{0.42862606f, 0.0680956617f},
-std::array<float,2>{0.799526155f, 0.823618531f},
-std::array<float,2>{0.36735943f, 0.882654071f},
-std::array<float,2>{0.975479782f, 0.240567222f},
-std::array<float,2>{0.0887896046f, 0.349850535f},
-std::array<float,2>{0.500803888f, 0.539605737f},
-std::array<float,2>{0.246398225f, 0.972013235f},
-std::array<float,2>{0.696022987f, 0.151845723f},
-std::array<float,2>{0.480344653f, 0.287102818f},
-std::array<float,2>{0.847773015f, 0.584652066f},
-std::array<float,2>{0.285628349f, 0.679912746f},
-std::array<float,2>{0.87554121f, 0.468944371f},
-std::array<float,2>{0.0311877634f, 0.00895247702f},
-std::array<float,2>{0.610477388f, 0.805228055f},
-std::array<float,2>{0.102224216f, 0.526661456f},
-std::array<float,2>{0.549881756f, 0.314952016f},
-std::array<float,2>{0.320257157f, 0.212733045f},
-std::array<float,2>{0.951703608f, 0.917005479f},
-std::array<float,2>{0.385148197f, 0.868769586f},
-std::array<float,2>{0.757714748f, 0.105367094f},
-std::array<float,2>{0.143402934f, 0.412225902f},
-std::array<float,2>{0.672703385f, 0.705039024f},
-std::array<float,2>{0.0658029243f, 0.929372191f},
-std::array<float,2>{0.525579929f, 0.189785853f},
-std::array<float,2>{0.344114572f, 0.341516554f},
-std::array<float,2>{0.986757636f, 0.508616626f},
-std::array<float,2>{0.414439797f, 0.694599867f},
-std::array<float,2>{0.789756775f, 0.430543065f},
-std::array<float,2>{0.180027708f, 0.124838516f},
-std::array<float,2>{0.644916892f, 0.847327769f},
-std::array<float,2>{0.214491695f, 0.575341284f},
-std::array<float,2>{0.745684683f, 0.312444061f},
-std::array<float,2>{0.445906579f, 0.135832325f},
-std::array<float,2>{0.822246492f, 0.992415607f},
-std::array<float,2>{0.255017906f, 0.793765008f},
-std::array<float,2>{0.928483605f, 0.027792044f},
-std::array<float,2>{0.0357416496f, 0.496795923f},
-std::array<float,2>{0.565276504f, 0.658076644f},
-std::array<float,2>{0.126362458f, 0.843432069f},
-std::array<float,2>{0.667601347f, 0.0853083655f},
-std::array<float,2>{0.396918565f, 0.381324977f},
-std::array<float,2>{0.77782917f, 0.743977487f},
-std::array<float,2>{0.329647273f, 0.54981333f},
-std::array<float,2>{0.967033029f, 0.373733133f},
-std::array<float,2>{0.121264786f, 0.22362645f},
-std::array<float,2>{0.535271466f, 0.903992474f},
-std::array<float,2>{0.00845724065f, 0.63121748f},
-std::array<float,2>{0.59651947f, 0.448384434f},
-std::array<float,2>{0.306881249f, 0.0599274971f},
-std::array<float,2>{0.89717871f, 0.76943332f},
-std::array<float,2>{0.484953791f, 0.949030221f},
-std::array<float,2>{0.872968256f, 0.173936367f},
-std::array<float,2>{0.229965732f, 0.273344457f},
-std::array<float,2>{0.703202784f, 0.615541041f},
-std::array<float,2>{0.00773649057f, 0.8255409f},
-std::array<float,2>{0.604592741f, 0.0639008284f},
-std::array<float,2>{0.304629833f, 0.395420194f},
-std::array<float,2>{0.906221509f, 0.732308626f},
-std::array<float,2>{0.498925656f, 0.545829594f},
-std::array<float,2>{0.864634275f, 0.345239758f},
-std::array<float,2>{0.221143112f, 0.235149756f},
-std::array<float,2>{0.711965919f, 0.875517845f},
-std::array<float,2>{0.136934131f, 0.650741339f},
-std::array<float,2>{0.657328784f, 0.461990386f},
-std::array<float,2>{0.406038076f, 0.0415492058f},
-std::array<float,2>{0.768892705f, 0.757569611f},
-std::array<float,2>{0.343276352f, 0.959181786f},
-std::array<float,2>{0.953711092f, 0.16857262f},
-std::array<float,2>{0.114205882f, 0.252985626f},
-std::array<float,2>{0.544028461f, 0.604009986f},
-std::array<float,2>{0.209075809f, 0.920196891f},
-std::array<float,2>{0.740367949f, 0.216846555f},
-std::array<float,2>{0.443812907f, 0.317060381f},
-std::array<float,2>{0.818640947f, 0.531248927f},
-std::array<float,2>{0.264633954f, 0.710759282f},
-std::array<float,2>{0.9372347f, 0.40976873f},
-std::array<float,2>{0.0438237749f, 0.108558491f},
-std::array<float,2>{0.570379019f, 0.873342216f},
-std::array<float,2>{0.0758024976f, 0.579664886f},
-std::array<float,2>{0.516603887f, 0.2830818f},
-std::array<float,2>{0.356484234f, 0.153266907f},
-std::array<float,2>{0.999639094f, 0.972990394f},
-std::array<float,2>{0.411415845f, 0.810604632f},
-std::array<float,2>{0.786956191f, 0.013184675f},
-std::array<float,2>{0.173363551f, 0.476110756f},
-std::array<float,2>{0.654007971f, 0.685449839f},
-std::array<float,2>{0.0968882218f, 0.999337316f},
-std::array<float,2>{0.555546761f, 0.138506517f},
-std::array<float,2>{0.325288236f, 0.307471275f},
-std::array<float,2>{0.940665305f, 0.571348488f},
-std::array<float,2>{0.378317118f, 0.660483718f},
-std::array<float,2>{0.764610827f, 0.493741781f},
-std::array<float,2>{0.148857772f, 0.0258587096f},
-std::array<float,2>{0.682082772f, 0.789464593f},
-std::array<float,2>{0.238403991f, 0.515086651f},
-std::array<float,2>{0.691975355f, 0.339362115f},
-std::array<float,2>{0.473477066f, 0.194534585f},
-std::array<float,2>{0.856581748f, 0.92322278f},
-std::array<float,2>{0.295482635f, 0.850865722f},
-std::array<float,2>{0.889755189f, 0.117372431f},
-std::array<float,2>{0.0192036275f, 0.433656335f},
-std::array<float,2>{0.621442914f, 0.690635622f},
-std::array<float,2>{0.161425024f, 0.772710919f},
-std::array<float,2>{0.629053473f, 0.0563690588f},
-std::array<float,2>{0.431675971f, 0.450390577f},
-std::array<float,2>{0.806218565f, 0.627681196f},
-std::array<float,2>{0.361582279f, 0.612848759f},
-std::array<float,2>{0.982917607f, 0.26776728f},
-std::array<float,2>{0.0818413869f, 0.179142296f},
-std::array<float,2>{0.511611462f, 0.953116059f},
-std::array<float,2>{0.0556601435f, 0.747746944f},
-std::array<float,2>{0.582477152f, 0.375756651f},
-std::array<float,2>{0.275318623f, 0.0806255341f},
-std::array<float,2>{0.910217404f, 0.839239776f},
-std::array<float,2>{0.462380618f, 0.901394546f},
-std::array<float,2>{0.841677666f, 0.222077236f},
-std::array<float,2>{0.194829091f, 0.367878646f},
-std::array<float,2>{0.722033441f, 0.55115205f},
-std::array<float,2>{0.0932751074f, 0.785939336f},
-std::array<float,2>{0.50439775f, 0.0201145504f},
-std::array<float,2>{0.373801231f, 0.487453282f},
-std::array<float,2>{0.970280707f, 0.668331385f},
-std::array<float,2>{0.424764425f, 0.569616675f},
-std::array<float,2>{0.804259658f, 0.303605318f},
-std::array<float,2>{0.16976811f, 0.126927018f},
-std::array<float,2>{0.633889437f, 0.990528584f},
-std::array<float,2>{0.197541118f, 0.69992435f},
-std::array<float,2>{0.73228699f, 0.423532993f},
-std::array<float,2>{0.456884503f, 0.113945134f},
-std::array<float,2>{0.830610812f, 0.8592152f},
-std::array<float,2>{0.268647969f, 0.931360543f},
-std::array<float,2>{0.918013036f, 0.19900915f},
-std::array<float,2>{0.054129187f, 0.32908833f},
-std::array<float,2>{0.586720765f, 0.504192054f},
-std::array<float,2>{0.146117926f, 0.940550923f},
-std::array<float,2>{0.675974727f, 0.180789128f},
-std::array<float,2>{0.388457686f, 0.279157907f},
-std::array<float,2>{0.750321269f, 0.619624555f},
-std::array<float,2>{0.312900752f, 0.633209348f},
-std::array<float,2>{0.946623027f, 0.442218304f},
-std::array<float,2>{0.108680837f, 0.049365107f},
-std::array<float,2>{0.553489387f, 0.777293324f},
-std::array<float,2>{0.025754327f, 0.560666621f},
-std::array<float,2>{0.616559267f, 0.362428576f},
-std::array<float,2>{0.282462537f, 0.229323387f},
-std::array<float,2>{0.87993741f, 0.891948581f},
-std::array<float,2>{0.483395249f, 0.835201323f},
-std::array<float,2>{0.845533609f, 0.0908889398f},
-std::array<float,2>{0.24259223f, 0.384889066f},
-std::array<float,2>{0.700807929f, 0.735252082f},
-std::array<float,2>{0.0312814638f, 0.884260774f},
-std::array<float,2>{0.56747508f, 0.249937356f},
-std::array<float,2>{0.250603259f, 0.353154629f},
-std::array<float,2>{0.925195873f, 0.533322334f},
-std::array<float,2>{0.45197919f, 0.718815029f},
-std::array<float,2>{0.827442586f, 0.399739534f},
-std::array<float,2>{0.218389869f, 0.075191848f},
-std::array<float,2>{0.749908209f, 0.818059266f},
-std::array<float,2>{0.186362177f, 0.596862257f},
-std::array<float,2>{0.643678069f, 0.263323545f},
-std::array<float,2>{0.420823127f, 0.164008349f},
-std::array<float,2>{0.796627581f, 0.961507261f},
-std::array<float,2>{0.351077139f, 0.761206806f},
-std::array<float,2>{0.992172956f, 0.0381038561f},
-std::array<float,2>{0.0664888695f, 0.456225336f},
-std::array<float,2>{0.530720949f, 0.645295918f},
-std::array<float,2>{0.231857359f, 0.860951662f},
-std::array<float,2>{0.710302949f, 0.0967537463f},
-std::array<float,2>{0.488923103f, 0.419708312f},
-std::array<float,2>{0.867436171f, 0.713111818f},
-std::array<float,2>{0.309512794f, 0.519546509f},
-std::array<float,2>{0.890887856f, 0.327398062f},
-std::array<float,2>{0.0126859667f, 0.209143892f},
-std::array<float,2>{0.599034011f, 0.908415139f},
-std::array<float,2>{0.117791504f, 0.677362978f},
-std::array<float,2>{0.531577349f, 0.481589884f},
-std::array<float,2>{0.333084971f, 0.00486400165f},
-std::array<float,2>{0.961021304f, 0.802058816f},
-std::array<float,2>{0.392890871f, 0.977120221f},
-std::array<float,2>{0.775467515f, 0.143547624f},
-std::array<float,2>{0.131204933f, 0.291640729f},
-std::array<float,2>{0.668419421f, 0.586896658f},
-std::array<float,2>{0.0738268495f, 0.830391526f},
-std::array<float,2>{0.522415936f, 0.0872293636f},
-std::array<float,2>{0.35196802f, 0.389675796f},
-std::array<float,2>{0.993509769f, 0.741954863f},
-std::array<float,2>{0.409315914f, 0.557111263f},
-std::array<float,2>{0.781729758f, 0.366567314f},
-std::array<float,2>{0.17677924f, 0.23102355f},
-std::array<float,2>{0.648880184f, 0.897957802f},
-std::array<float,2>{0.206542358f, 0.638394952f},
-std::array<float,2>{0.73683089f, 0.437994123f},
-std::array<float,2>{0.43957594f, 0.0529727601f},
-std::array<float,2>{0.814022124f, 0.778109431f},
-std::array<float,2>{0.261364758f, 0.9441728f},
-std::array<float,2>{0.929796576f, 0.184122115f},
-std::array<float,2>{0.0426748283f, 0.273450285f},
-std::array<float,2>{0.578091562f, 0.623846769f},
-std::array<float,2>{0.134423912f, 0.93555522f},
-std::array<float,2>{0.662458539f, 0.202960461f},
-std::array<float,2>{0.401666552f, 0.333242625f},
-std::array<float,2>{0.769657612f, 0.502371669f},
-std::array<float,2>{0.339167178f, 0.696095824f},
-std::array<float,2>{0.95904851f, 0.429081708f},
-std::array<float,2>{0.110127039f, 0.109496824f},
-std::array<float,2>{0.539222717f, 0.851873457f},
-std::array<float,2>{0.0035335673f, 0.566329658f},
-std::array<float,2>{0.609244168f, 0.297917277f},
-std::array<float,2>{0.297494918f, 0.130448297f},
-std::array<float,2>{0.900265813f, 0.987172663f},
-std::array<float,2>{0.494122475f, 0.78477782f},
-std::array<float,2>{0.860932171f, 0.0183291417f},
-std::array<float,2>{0.224801853f, 0.489543498f},
-std::array<float,2>{0.717753172f, 0.667122483f},
-std::array<float,2>{0.0609814264f, 0.982278943f},
-std::array<float,2>{0.578853011f, 0.146322951f},
-std::array<float,2>{0.27979058f, 0.293406755f},
-std::array<float,2>{0.910035908f, 0.592524052f},
-std::array<float,2>{0.468049645f, 0.674895048f},
-std::array<float,2>{0.837937295f, 0.478957236f},
-std::array<float,2>{0.189298496f, 0.0020231891f},
-std::array<float,2>{0.724340975f, 0.800510883f},
-std::array<float,2>{0.156377226f, 0.51898253f},
-std::array<float,2>{0.625260413f, 0.321169525f},
-std::array<float,2>{0.436804533f, 0.204196244f},
-std::array<float,2>{0.811617255f, 0.911974311f},
-std::array<float,2>{0.36621666f, 0.865885079f},
-std::array<float,2>{0.979637921f, 0.100929938f},
-std::array<float,2>{0.0833688378f, 0.417065471f},
-std::array<float,2>{0.513401389f, 0.718431056f},
-std::array<float,2>{0.236509725f, 0.76248908f},
-std::array<float,2>{0.691297114f, 0.0317900702f},
-std::array<float,2>{0.47171545f, 0.459712863f},
-std::array<float,2>{0.854260802f, 0.64183718f},
-std::array<float,2>{0.291118503f, 0.598553717f},
-std::array<float,2>{0.884377778f, 0.260314167f},
-std::array<float,2>{0.0196044818f, 0.157978475f},
-std::array<float,2>{0.617308021f, 0.96663177f},
-std::array<float,2>{0.0992764607f, 0.724221289f},
-std::array<float,2>{0.560968757f, 0.405980438f},
-std::array<float,2>{0.323382139f, 0.071746558f},
-std::array<float,2>{0.944139659f, 0.814241469f},
-std::array<float,2>{0.380456448f, 0.888390124f},
-std::array<float,2>{0.761299729f, 0.24579449f},
-std::array<float,2>{0.154182628f, 0.356286556f},
-std::array<float,2>{0.686957538f, 0.536890507f},
-std::array<float,2>{0.0285683125f, 0.808025241f},
-std::array<float,2>{0.611758709f, 0.00987876579f},
-std::array<float,2>{0.287412792f, 0.472296685f},
-std::array<float,2>{0.877098143f, 0.683228612f},
-std::array<float,2>{0.477500141f, 0.583622158f},
-std::array<float,2>{0.851101816f, 0.288071215f},
-std::array<float,2>{0.248385042f, 0.149971053f},
-std::array<float,2>{0.698264301f, 0.969568729f},
-std::array<float,2>{0.141715005f, 0.706872702f},
-std::array<float,2>{0.674229443f, 0.411101669f},
-std::array<float,2>{0.384628505f, 0.102594957f},
-std::array<float,2>{0.754124343f, 0.87046057f},
-std::array<float,2>{0.318147689f, 0.915439427f},
-std::array<float,2>{0.950104713f, 0.213573247f},
-std::array<float,2>{0.104207024f, 0.313807994f},
-std::array<float,2>{0.547920167f, 0.525351644f},
-std::array<float,2>{0.200246081f, 0.954784513f},
-std::array<float,2>{0.728654861f, 0.164744347f},
-std::array<float,2>{0.460357308f, 0.255449325f},
-std::array<float,2>{0.833628893f, 0.60900104f},
-std::array<float,2>{0.270735413f, 0.65239346f},
-std::array<float,2>{0.914092422f, 0.46787852f},
-std::array<float,2>{0.0478274785f, 0.0450492688f},
-std::array<float,2>{0.589845419f, 0.752576172f},
-std::array<float,2>{0.0865792856f, 0.541931629f},
-std::array<float,2>{0.50196439f, 0.348582238f},
-std::array<float,2>{0.369533032f, 0.238871872f},
-std::array<float,2>{0.974238217f, 0.878933907f},
-std::array<float,2>{0.427479744f, 0.821516871f},
-std::array<float,2>{0.797738254f, 0.068687439f},
-std::array<float,2>{0.166467026f, 0.392588973f},
-std::array<float,2>{0.63836354f, 0.727880478f},
-std::array<float,2>{0.124300867f, 0.904422164f},
-std::array<float,2>{0.537480116f, 0.2259271f},
-std::array<float,2>{0.331879735f, 0.372361362f},
-std::array<float,2>{0.966723382f, 0.548802018f},
-std::array<float,2>{0.395415246f, 0.744983315f},
-std::array<float,2>{0.780466676f, 0.378922939f},
-std::array<float,2>{0.127981335f, 0.0828612149f},
-std::array<float,2>{0.665018439f, 0.840289533f},
-std::array<float,2>{0.228198722f, 0.613768995f},
-std::array<float,2>{0.705639362f, 0.271109432f},
-std::array<float,2>{0.486350507f, 0.17318359f},
-std::array<float,2>{0.873880625f, 0.94660598f},
-std::array<float,2>{0.306117415f, 0.766192496f},
-std::array<float,2>{0.89526248f, 0.0619779043f},
-std::array<float,2>{0.011303002f, 0.447130442f},
-std::array<float,2>{0.595173895f, 0.630406141f},
-std::array<float,2>{0.183068559f, 0.844592988f},
-std::array<float,2>{0.648315549f, 0.122113168f},
-std::array<float,2>{0.417122036f, 0.433201194f},
-std::array<float,2>{0.792327225f, 0.693160176f},
-std::array<float,2>{0.34573707f, 0.509884775f},
-std::array<float,2>{0.985714018f, 0.342612356f},
-std::array<float,2>{0.0643017963f, 0.188600034f},
-std::array<float,2>{0.524840891f, 0.926860929f},
-std::array<float,2>{0.0386355259f, 0.658446372f},
-std::array<float,2>{0.563653767f, 0.499438614f},
-std::array<float,2>{0.25673449f, 0.029820323f},
-std::array<float,2>{0.925807238f, 0.796753824f},
-std::array<float,2>{0.449155211f, 0.995751202f},
-std::array<float,2>{0.822429299f, 0.133287638f},
-std::array<float,2>{0.211387247f, 0.309408545f},
-std::array<float,2>{0.743357599f, 0.577629328f},
-std::array<float,2>{0.0466076881f, 0.871364594f},
-std::array<float,2>{0.57234472f, 0.106564879f},
-std::array<float,2>{0.262812197f, 0.406664222f},
-std::array<float,2>{0.933705509f, 0.707975686f},
-std::array<float,2>{0.441620052f, 0.527882755f},
-std::array<float,2>{0.816689968f, 0.318636f},
-std::array<float,2>{0.2087273f, 0.215384662f},
-std::array<float,2>{0.738537014f, 0.918247104f},
-std::array<float,2>{0.17505309f, 0.687305927f},
-std::array<float,2>{0.656246066f, 0.474350482f},
-std::array<float,2>{0.413063616f, 0.0146415979f},
-std::array<float,2>{0.787414491f, 0.810486674f},
-std::array<float,2>{0.358565122f, 0.976085722f},
-std::array<float,2>{0.996969759f, 0.15565078f},
-std::array<float,2>{0.0771391243f, 0.283387363f},
-std::array<float,2>{0.518264115f, 0.581173301f},
-std::array<float,2>{0.219685495f, 0.878089666f},
-std::array<float,2>{0.713391602f, 0.237763196f},
-std::array<float,2>{0.497450083f, 0.346591979f},
-std::array<float,2>{0.865563929f, 0.543928385f},
-std::array<float,2>{0.302072376f, 0.734119356f},
-std::array<float,2>{0.902887821f, 0.397076726f},
-std::array<float,2>{0.0052284305f, 0.0659504533f},
-std::array<float,2>{0.601725578f, 0.826733589f},
-std::array<float,2>{0.116658792f, 0.60220629f},
-std::array<float,2>{0.546528876f, 0.250568628f},
-std::array<float,2>{0.34031105f, 0.171339929f},
-std::array<float,2>{0.95609957f, 0.957518876f},
-std::array<float,2>{0.403889716f, 0.754101455f},
-std::array<float,2>{0.766580403f, 0.0397507139f},
-std::array<float,2>{0.13992928f, 0.462990075f},
-std::array<float,2>{0.659435511f, 0.649398625f},
-std::array<float,2>{0.0788924024f, 0.949926019f},
-std::array<float,2>{0.508743703f, 0.177506253f},
-std::array<float,2>{0.359787852f, 0.265693009f},
-std::array<float,2>{0.982240379f, 0.610850036f},
-std::array<float,2>{0.43071267f, 0.625626981f},
-std::array<float,2>{0.808579564f, 0.451577902f},
-std::array<float,2>{0.162579268f, 0.0580591112f},
-std::array<float,2>{0.631116152f, 0.769983172f},
-std::array<float,2>{0.192312449f, 0.553839087f},
-std::array<float,2>{0.719428778f, 0.369954705f},
-std::array<float,2>{0.464802742f, 0.218942165f},
-std::array<float,2>{0.843643129f, 0.899223447f},
-std::array<float,2>{0.275680542f, 0.837061763f},
-std::array<float,2>{0.912545621f, 0.078941226f},
-std::array<float,2>{0.0573600791f, 0.378438175f},
-std::array<float,2>{0.584503651f, 0.749535263f},
-std::array<float,2>{0.151285246f, 0.792599678f},
-std::array<float,2>{0.681217194f, 0.0242373999f},
-std::array<float,2>{0.375658035f, 0.495416969f},
-std::array<float,2>{0.762621284f, 0.663178563f},
-std::array<float,2>{0.326664418f, 0.572498918f},
-std::array<float,2>{0.938580036f, 0.306219071f},
-std::array<float,2>{0.0940158293f, 0.138788849f},
-std::array<float,2>{0.557727218f, 0.997459233f},
-std::array<float,2>{0.0164074656f, 0.6893031f},
-std::array<float,2>{0.623293102f, 0.437144756f},
-std::array<float,2>{0.294398636f, 0.120319083f},
-std::array<float,2>{0.887217462f, 0.849447429f},
-std::array<float,2>{0.476153553f, 0.924631834f},
-std::array<float,2>{0.858131349f, 0.193257466f},
-std::array<float,2>{0.242061704f, 0.337293237f},
-std::array<float,2>{0.69428587f, 0.512549639f},
-std::array<float,2>{0.105945438f, 0.775124431f},
-std::array<float,2>{0.551692545f, 0.0483180061f},
-std::array<float,2>{0.316296667f, 0.444806665f},
-std::array<float,2>{0.948175967f, 0.636240304f},
-std::array<float,2>{0.389355183f, 0.618031502f},
-std::array<float,2>{0.75352782f, 0.280370921f},
-std::array<float,2>{0.147981763f, 0.181733534f},
-std::array<float,2>{0.679657578f, 0.938072085f},
-std::array<float,2>{0.245656133f, 0.736918449f},
-std::array<float,2>{0.7016415f, 0.383856565f},
-std::array<float,2>{0.480812013f, 0.0921346694f},
-std::array<float,2>{0.846224427f, 0.832193732f},
-std::array<float,2>{0.283441156f, 0.892948806f},
-std::array<float,2>{0.881636918f, 0.226828471f},
-std::array<float,2>{0.0247378983f, 0.35978803f},
-std::array<float,2>{0.614551842f, 0.559671521f},
-std::array<float,2>{0.170566514f, 0.988780439f},
-std::array<float,2>{0.63656944f, 0.128028363f},
-std::array<float,2>{0.423094153f, 0.301029891f},
-std::array<float,2>{0.801532626f, 0.567555964f},
-std::array<float,2>{0.372578114f, 0.671226859f},
-std::array<float,2>{0.972094178f, 0.485540509f},
-std::array<float,2>{0.0903411955f, 0.021850178f},
-std::array<float,2>{0.506074071f, 0.78902638f},
-std::array<float,2>{0.0513556376f, 0.50618732f},
-std::array<float,2>{0.589363158f, 0.330558687f},
-std::array<float,2>{0.265723854f, 0.196389109f},
-std::array<float,2>{0.920488119f, 0.932435215f},
-std::array<float,2>{0.454459071f, 0.856970787f},
-std::array<float,2>{0.829875171f, 0.11556077f},
-std::array<float,2>{0.195881665f, 0.424323887f},
-std::array<float,2>{0.732600331f, 0.702439785f},
-std::array<float,2>{0.0149655389f, 0.907802165f},
-std::array<float,2>{0.600955129f, 0.208317161f},
-std::array<float,2>{0.312091559f, 0.32522884f},
-std::array<float,2>{0.894178689f, 0.523367226f},
-std::array<float,2>{0.490555316f, 0.712324977f},
-std::array<float,2>{0.870515704f, 0.420740098f},
-std::array<float,2>{0.233120203f, 0.0938888416f},
-std::array<float,2>{0.707042038f, 0.862730563f},
-std::array<float,2>{0.130314916f, 0.588389397f},
-std::array<float,2>{0.670529664f, 0.289366931f},
-std::array<float,2>{0.392024875f, 0.141224846f},
-std::array<float,2>{0.774914086f, 0.980342031f},
-std::array<float,2>{0.335214168f, 0.804312348f},
-std::array<float,2>{0.964600325f, 0.0072088372f},
-std::array<float,2>{0.119471475f, 0.483231783f},
-std::array<float,2>{0.534592927f, 0.679583549f},
-std::array<float,2>{0.216085747f, 0.819570899f},
-std::array<float,2>{0.746125102f, 0.077214472f},
-std::array<float,2>{0.450674295f, 0.402160853f},
-std::array<float,2>{0.825767159f, 0.72148937f},
-std::array<float,2>{0.252089947f, 0.53214258f},
-std::array<float,2>{0.923134983f, 0.3548913f},
-std::array<float,2>{0.0333355814f, 0.247522265f},
-std::array<float,2>{0.569553256f, 0.885700941f},
-std::array<float,2>{0.0701860338f, 0.647992194f},
-std::array<float,2>{0.528159797f, 0.45486927f},
-std::array<float,2>{0.347887367f, 0.0369991884f},
-std::array<float,2>{0.989790857f, 0.758075893f},
-std::array<float,2>{0.418531775f, 0.963071942f},
-std::array<float,2>{0.794273078f, 0.161887899f},
-std::array<float,2>{0.184072748f, 0.264968455f},
-std::array<float,2>{0.641478598f, 0.594551325f},
-std::array<float,2>{0.0998954922f, 0.813054442f},
-std::array<float,2>{0.560487807f, 0.0709868073f},
-std::array<float,2>{0.322183222f, 0.404762208f},
-std::array<float,2>{0.941419423f, 0.722995698f},
-std::array<float,2>{0.381493539f, 0.535944998f},
-std::array<float,2>{0.757846415f, 0.35698545f},
-std::array<float,2>{0.156189248f, 0.24480024f},
-std::array<float,2>{0.684861422f, 0.88676244f},
-std::array<float,2>{0.23569034f, 0.641035378f},
-std::array<float,2>{0.688673198f, 0.460746348f},
-std::array<float,2>{0.469113708f, 0.0323845148f},
-std::array<float,2>{0.852235436f, 0.763602555f},
-std::array<float,2>{0.290427148f, 0.964926064f},
-std::array<float,2>{0.886269987f, 0.156993717f},
-std::array<float,2>{0.0216591693f, 0.260833412f},
-std::array<float,2>{0.619409978f, 0.599566042f},
-std::array<float,2>{0.158533007f, 0.910890281f},
-std::array<float,2>{0.627722979f, 0.20346655f},
-std::array<float,2>{0.43380779f, 0.321525514f},
-std::array<float,2>{0.809124947f, 0.518022537f},
-std::array<float,2>{0.364884585f, 0.71740973f},
-std::array<float,2>{0.977144599f, 0.416943789f},
-std::array<float,2>{0.0852243453f, 0.099998042f},
-std::array<float,2>{0.51539433f, 0.866785586f},
-std::array<float,2>{0.0591974817f, 0.59306854f},
-std::array<float,2>{0.581494808f, 0.294126064f},
-std::array<float,2>{0.27912271f, 0.144978404f},
-std::array<float,2>{0.906539142f, 0.981076181f},
-std::array<float,2>{0.464944363f, 0.798920572f},
-std::array<float,2>{0.837005794f, 0.00347357616f},
-std::array<float,2>{0.190279737f, 0.480111301f},
-std::array<float,2>{0.726233304f, 0.673913479f},
-std::array<float,2>{0.00110829063f, 0.98782593f},
-std::array<float,2>{0.607147872f, 0.12906979f},
-std::array<float,2>{0.300031751f, 0.297131836f},
-std::array<float,2>{0.900808573f, 0.564873219f},
-std::array<float,2>{0.494472414f, 0.666484416f},
-std::array<float,2>{0.861504257f, 0.489152402f},
-std::array<float,2>{0.223227844f, 0.0194451045f},
-std::array<float,2>{0.715099812f, 0.783947825f},
-std::array<float,2>{0.135088027f, 0.502972722f},
-std::array<float,2>{0.660844743f, 0.332713604f},
-std::array<float,2>{0.398592889f, 0.20174706f},
-std::array<float,2>{0.77312386f, 0.937156796f},
-std::array<float,2>{0.336428374f, 0.853330612f},
-std::array<float,2>{0.958828151f, 0.110934816f},
-std::array<float,2>{0.112340935f, 0.428589284f},
-std::array<float,2>{0.542470157f, 0.696892023f},
-std::array<float,2>{0.204131171f, 0.779115319f},
-std::array<float,2>{0.735956192f, 0.0537675507f},
-std::array<float,2>{0.437733382f, 0.43936041f},
-std::array<float,2>{0.816093683f, 0.637072861f},
-std::array<float,2>{0.258183748f, 0.624054909f},
-std::array<float,2>{0.933030128f, 0.274900645f},
-std::array<float,2>{0.0395339206f, 0.185268462f},
-std::array<float,2>{0.574277163f, 0.944831431f},
-std::array<float,2>{0.0712448135f, 0.741159737f},
-std::array<float,2>{0.520099103f, 0.388892353f},
-std::array<float,2>{0.354191035f, 0.0861190334f},
-std::array<float,2>{0.995154679f, 0.831564784f},
-std::array<float,2>{0.407417119f, 0.897168219f},
-std::array<float,2>{0.785056233f, 0.231485069f},
-std::array<float,2>{0.178100437f, 0.366121382f},
-std::array<float,2>{0.651049554f, 0.558275521f},
-std::array<float,2>{0.0364290513f, 0.79561305f},
-std::array<float,2>{0.5657534f, 0.0303231571f},
-std::array<float,2>{0.253959596f, 0.498161763f},
-std::array<float,2>{0.929349005f, 0.65964812f},
-std::array<float,2>{0.446502835f, 0.577058375f},
-std::array<float,2>{0.82111007f, 0.309765935f},
-std::array<float,2>{0.213328466f, 0.133856446f},
-std::array<float,2>{0.745105743f, 0.994543672f},
-std::array<float,2>{0.181435168f, 0.691778421f},
-std::array<float,2>{0.645836413f, 0.431912065f},
-std::array<float,2>{0.415225476f, 0.121215865f},
-std::array<float,2>{0.790621102f, 0.845108986f},
-std::array<float,2>{0.345399797f, 0.926432133f},
-std::array<float,2>{0.987408221f, 0.188261122f},
-std::array<float,2>{0.0647183955f, 0.342961252f},
-std::array<float,2>{0.527274847f, 0.511308968f},
-std::array<float,2>{0.22912842f, 0.945412755f},
-std::array<float,2>{0.704846561f, 0.172568992f},
-std::array<float,2>{0.48591724f, 0.269924283f},
-std::array<float,2>{0.871167719f, 0.614266038f},
-std::array<float,2>{0.308095872f, 0.629362464f},
-std::array<float,2>{0.898085773f, 0.445330709f},
-std::array<float,2>{0.00884069316f, 0.0606561713f},
-std::array<float,2>{0.597451568f, 0.766672432f},
-std::array<float,2>{0.12257871f, 0.54773581f},
-std::array<float,2>{0.536691546f, 0.371613562f},
-std::array<float,2>{0.328280926f, 0.224829048f},
-std::array<float,2>{0.968250215f, 0.906212807f},
-std::array<float,2>{0.397740871f, 0.841074526f},
-std::array<float,2>{0.778947771f, 0.0836226717f},
-std::array<float,2>{0.125560403f, 0.380830973f},
-std::array<float,2>{0.666318059f, 0.745342612f},
-std::array<float,2>{0.0897437483f, 0.880559802f},
-std::array<float,2>{0.501218677f, 0.239980027f},
-std::array<float,2>{0.369106859f, 0.349286556f},
-std::array<float,2>{0.975800753f, 0.542073965f},
-std::array<float,2>{0.429420769f, 0.726655126f},
-std::array<float,2>{0.80009979f, 0.394276917f},
-std::array<float,2>{0.164809376f, 0.0699133053f},
-std::array<float,2>{0.639073431f, 0.821136594f},
-std::array<float,2>{0.20207423f, 0.60831964f},
-std::array<float,2>{0.726932168f, 0.254385591f},
-std::array<float,2>{0.458723217f, 0.165950924f},
-std::array<float,2>{0.834095597f, 0.953805864f},
-std::array<float,2>{0.271706492f, 0.753751934f},
-std::array<float,2>{0.9160164f, 0.046609018f},
-std::array<float,2>{0.0490883254f, 0.467701524f},
-std::array<float,2>{0.592554152f, 0.653490305f},
-std::array<float,2>{0.144357234f, 0.869790733f},
-std::array<float,2>{0.673307955f, 0.101773687f},
-std::array<float,2>{0.38629365f, 0.411206454f},
-std::array<float,2>{0.7561813f, 0.705353379f},
-std::array<float,2>{0.318926215f, 0.524014354f},
-std::array<float,2>{0.953116953f, 0.312531352f},
-std::array<float,2>{0.102815829f, 0.214620799f},
-std::array<float,2>{0.549230218f, 0.91463995f},
-std::array<float,2>{0.029904129f, 0.681762874f},
-std::array<float,2>{0.609674215f, 0.471361399f},
-std::array<float,2>{0.286620468f, 0.0112294434f},
-std::array<float,2>{0.876209915f, 0.807579994f},
-std::array<float,2>{0.478940219f, 0.970126569f},
-std::array<float,2>{0.849053025f, 0.148809686f},
-std::array<float,2>{0.247813687f, 0.288895488f},
-std::array<float,2>{0.696630538f, 0.582394481f},
-std::array<float,2>{0.0179748684f, 0.848402321f},
-std::array<float,2>{0.622221529f, 0.119445324f},
-std::array<float,2>{0.296131045f, 0.435940236f},
-std::array<float,2>{0.888697922f, 0.687738061f},
-std::array<float,2>{0.473892927f, 0.512851119f},
-std::array<float,2>{0.856133282f, 0.336254567f},
-std::array<float,2>{0.239319414f, 0.191578448f},
-std::array<float,2>{0.693261921f, 0.925018072f},
-std::array<float,2>{0.150216892f, 0.662409186f},
-std::array<float,2>{0.683102489f, 0.494157732f},
-std::array<float,2>{0.377913475f, 0.0247158427f},
-std::array<float,2>{0.765503407f, 0.791791081f},
-std::array<float,2>{0.325150788f, 0.997048378f},
-std::array<float,2>{0.940366387f, 0.13984552f},
-std::array<float,2>{0.0958701968f, 0.305280387f},
-std::array<float,2>{0.556039751f, 0.573935866f},
-std::array<float,2>{0.193466201f, 0.89955467f},
-std::array<float,2>{0.721398592f, 0.219729021f},
-std::array<float,2>{0.461140186f, 0.370227784f},
-std::array<float,2>{0.840738118f, 0.553662956f},
-std::array<float,2>{0.273610383f, 0.748187661f},
-std::array<float,2>{0.911636889f, 0.377269298f},
-std::array<float,2>{0.0565931052f, 0.079151608f},
-std::array<float,2>{0.583574772f, 0.836825371f},
-std::array<float,2>{0.0802018046f, 0.610130906f},
-std::array<float,2>{0.510520577f, 0.266899198f},
-std::array<float,2>{0.362627596f, 0.175840795f},
-std::array<float,2>{0.984350741f, 0.95024395f},
-std::array<float,2>{0.433138639f, 0.770626783f},
-std::array<float,2>{0.805173874f, 0.056830693f},
-std::array<float,2>{0.160161808f, 0.452248842f},
-std::array<float,2>{0.630117536f, 0.626342058f},
-std::array<float,2>{0.114318088f, 0.958817661f},
-std::array<float,2>{0.543433785f, 0.170135662f},
-std::array<float,2>{0.342249393f, 0.251364619f},
-std::array<float,2>{0.955020845f, 0.602697611f},
-std::array<float,2>{0.404566586f, 0.649989367f},
-std::array<float,2>{0.768041313f, 0.463981181f},
-std::array<float,2>{0.138524726f, 0.0404843614f},
-std::array<float,2>{0.656846583f, 0.755360425f},
-std::array<float,2>{0.222545043f, 0.544633925f},
-std::array<float,2>{0.711014986f, 0.346725076f},
-std::array<float,2>{0.499284834f, 0.237055838f},
-std::array<float,2>{0.86374718f, 0.877254426f},
-std::array<float,2>{0.303483844f, 0.827324569f},
-std::array<float,2>{0.904810905f, 0.0650772974f},
-std::array<float,2>{0.00597141171f, 0.398188114f},
-std::array<float,2>{0.603975534f, 0.732720077f},
-std::array<float,2>{0.172390684f, 0.808644593f},
-std::array<float,2>{0.653158247f, 0.0151316784f},
-std::array<float,2>{0.410503805f, 0.473248899f},
-std::array<float,2>{0.786095798f, 0.685695291f},
-std::array<float,2>{0.355744034f, 0.580382764f},
-std::array<float,2>{0.999007463f, 0.284817189f},
-std::array<float,2>{0.074236311f, 0.155009195f},
-std::array<float,2>{0.515630901f, 0.975087285f},
-std::array<float,2>{0.0446960852f, 0.708945155f},
-std::array<float,2>{0.57178092f, 0.407730401f},
-std::array<float,2>{0.265114576f, 0.105483845f},
-std::array<float,2>{0.936061978f, 0.87290442f},
-std::array<float,2>{0.445275217f, 0.919485271f},
-std::array<float,2>{0.819600523f, 0.216601491f},
-std::array<float,2>{0.210406631f, 0.319860905f},
-std::array<float,2>{0.741615415f, 0.529227495f},
-std::array<float,2>{0.068245098f, 0.759313703f},
-std::array<float,2>{0.530071676f, 0.0356402434f},
-std::array<float,2>{0.349704385f, 0.453717411f},
-std::array<float,2>{0.990314662f, 0.64703083f},
-std::array<float,2>{0.421696365f, 0.59529227f},
-std::array<float,2>{0.795405865f, 0.264396906f},
-std::array<float,2>{0.187067062f, 0.160544649f},
-std::array<float,2>{0.642864823f, 0.964465499f},
-std::array<float,2>{0.216980785f, 0.722140968f},
-std::array<float,2>{0.748832822f, 0.401060522f},
-std::array<float,2>{0.452633262f, 0.0771048889f},
-std::array<float,2>{0.826926768f, 0.818745553f},
-std::array<float,2>{0.250994772f, 0.885873079f},
-std::array<float,2>{0.924389541f, 0.24659805f},
-std::array<float,2>{0.0329680406f, 0.353524655f},
-std::array<float,2>{0.567051828f, 0.533158779f},
-std::array<float,2>{0.131930441f, 0.979461908f},
-std::array<float,2>{0.669534385f, 0.141816527f},
-std::array<float,2>{0.394306988f, 0.290248483f},
-std::array<float,2>{0.77733165f, 0.5893507f},
-std::array<float,2>{0.332354814f, 0.678668678f},
-std::array<float,2>{0.962081969f, 0.484063178f},
-std::array<float,2>{0.11912629f, 0.00653891452f},
-std::array<float,2>{0.532340944f, 0.802891076f},
-std::array<float,2>{0.0136593701f, 0.521573305f},
-std::array<float,2>{0.598324418f, 0.324635983f},
-std::array<float,2>{0.310186684f, 0.207052276f},
-std::array<float,2>{0.892368555f, 0.906404912f},
-std::array<float,2>{0.489668161f, 0.861335695f},
-std::array<float,2>{0.869090974f, 0.0947548002f},
-std::array<float,2>{0.231032982f, 0.421129078f},
-std::array<float,2>{0.709365964f, 0.711108744f},
-std::array<float,2>{0.0534543954f, 0.9330042f},
-std::array<float,2>{0.587630332f, 0.196164638f},
-std::array<float,2>{0.267739385f, 0.331755847f},
-std::array<float,2>{0.918982446f, 0.507733226f},
-std::array<float,2>{0.45574072f, 0.701730192f},
-std::array<float,2>{0.831109583f, 0.425652117f},
-std::array<float,2>{0.198596865f, 0.116788954f},
-std::array<float,2>{0.731209219f, 0.855836749f},
-std::array<float,2>{0.168566376f, 0.566735685f},
-std::array<float,2>{0.633782446f, 0.302066267f},
-std::array<float,2>{0.425271153f, 0.12745142f},
-std::array<float,2>{0.803271294f, 0.990140557f},
-std::array<float,2>{0.374077022f, 0.787724555f},
-std::array<float,2>{0.96927911f, 0.0227414016f},
-std::array<float,2>{0.0920510143f, 0.484432995f},
-std::array<float,2>{0.50508225f, 0.670707285f},
-std::array<float,2>{0.243255898f, 0.833500564f},
-std::array<float,2>{0.699619114f, 0.0930236876f},
-std::array<float,2>{0.483861566f, 0.383637697f},
-std::array<float,2>{0.843856275f, 0.737945616f},
-std::array<float,2>{0.281691492f, 0.559566855f},
-std::array<float,2>{0.879581213f, 0.360806376f},
-std::array<float,2>{0.0267753787f, 0.228233486f},
-std::array<float,2>{0.616159499f, 0.893725753f},
-std::array<float,2>{0.10758885f, 0.634946465f},
-std::array<float,2>{0.554036379f, 0.443446994f},
-std::array<float,2>{0.314176828f, 0.0474230349f},
-std::array<float,2>{0.945794165f, 0.773626924f},
-std::array<float,2>{0.38718912f, 0.938597977f},
-std::array<float,2>{0.751752317f, 0.182941884f},
-std::array<float,2>{0.145093486f, 0.279859662f},
-std::array<float,2>{0.677359939f, 0.618774414f},
-std::array<float,2>{0.0823772326f, 0.86481297f},
-std::array<float,2>{0.512059331f, 0.0985885859f},
-std::array<float,2>{0.365761012f, 0.41576314f},
-std::array<float,2>{0.979041219f, 0.714963973f},
-std::array<float,2>{0.436493516f, 0.516986609f},
-std::array<float,2>{0.811012268f, 0.323359787f},
-std::array<float,2>{0.157363728f, 0.205678523f},
-std::array<float,2>{0.626003265f, 0.913296163f},
-std::array<float,2>{0.188456684f, 0.67294383f},
-std::array<float,2>{0.723125339f, 0.476867497f},
-std::array<float,2>{0.466809183f, 0.000181764437f},
-std::array<float,2>{0.839719236f, 0.798443258f},
-std::array<float,2>{0.280902565f, 0.983843565f},
-std::array<float,2>{0.908530116f, 0.146831438f},
-std::array<float,2>{0.0616512857f, 0.296452492f},
-std::array<float,2>{0.580031633f, 0.589953899f},
-std::array<float,2>{0.153307527f, 0.888856828f},
-std::array<float,2>{0.685997009f, 0.243463829f},
-std::array<float,2>{0.379641652f, 0.358301729f},
-std::array<float,2>{0.760365009f, 0.538971007f},
-std::array<float,2>{0.323137075f, 0.725111187f},
-std::array<float,2>{0.945214987f, 0.403196782f},
-std::array<float,2>{0.0985840261f, 0.0738845691f},
-std::array<float,2>{0.561915636f, 0.815901279f},
-std::array<float,2>{0.0208906829f, 0.600837052f},
-std::array<float,2>{0.618204117f, 0.258801639f},
-std::array<float,2>{0.292560697f, 0.158260226f},
-std::array<float,2>{0.883243799f, 0.967820883f},
-std::array<float,2>{0.471183151f, 0.764892936f},
-std::array<float,2>{0.854644775f, 0.0338668786f},
-std::array<float,2>{0.237591803f, 0.457038164f},
-std::array<float,2>{0.690211654f, 0.642868757f},
-std::array<float,2>{0.0415076055f, 0.942022085f},
-std::array<float,2>{0.576420784f, 0.187007427f},
-std::array<float,2>{0.260725796f, 0.2759597f},
-std::array<float,2>{0.931331038f, 0.621471882f},
-std::array<float,2>{0.44131586f, 0.63963455f},
-std::array<float,2>{0.813093245f, 0.440504581f},
-std::array<float,2>{0.205762178f, 0.0513031483f},
-std::array<float,2>{0.737582326f, 0.780635297f},
-std::array<float,2>{0.176525548f, 0.556111276f},
-std::array<float,2>{0.650310636f, 0.365010858f},
-std::array<float,2>{0.409044266f, 0.232547298f},
-std::array<float,2>{0.782314301f, 0.895720899f},
-std::array<float,2>{0.353093147f, 0.829056859f},
-std::array<float,2>{0.992204845f, 0.0891485587f},
-std::array<float,2>{0.0729471818f, 0.387815803f},
-std::array<float,2>{0.523050666f, 0.739802778f},
-std::array<float,2>{0.225707337f, 0.781644762f},
-std::array<float,2>{0.717850685f, 0.0164753348f},
-std::array<float,2>{0.49302581f, 0.492059052f},
-std::array<float,2>{0.860046864f, 0.664901733f},
-std::array<float,2>{0.298711509f, 0.563228846f},
-std::array<float,2>{0.899144292f, 0.299703807f},
-std::array<float,2>{0.00272296905f, 0.131306186f},
-std::array<float,2>{0.60837394f, 0.985935628f},
-std::array<float,2>{0.11047978f, 0.697733879f},
-std::array<float,2>{0.540229023f, 0.42699182f},
-std::array<float,2>{0.338850707f, 0.112821825f},
-std::array<float,2>{0.960693181f, 0.855004251f},
-std::array<float,2>{0.401193738f, 0.934493661f},
-std::array<float,2>{0.771186948f, 0.200992495f},
-std::array<float,2>{0.133039638f, 0.335073799f},
-std::array<float,2>{0.66313374f, 0.50098592f},
-std::array<float,2>{0.00992011651f, 0.767647386f},
-std::array<float,2>{0.593837559f, 0.0590963848f},
-std::array<float,2>{0.305182695f, 0.447829723f},
-std::array<float,2>{0.896168888f, 0.631944537f},
-std::array<float,2>{0.487391472f, 0.616848409f},
-std::array<float,2>{0.87448144f, 0.272017777f},
-std::array<float,2>{0.226990685f, 0.175222516f},
-std::array<float,2>{0.706201732f, 0.94813329f},
-std::array<float,2>{0.127595633f, 0.742869794f},
-std::array<float,2>{0.665328562f, 0.382342488f},
-std::array<float,2>{0.395597309f, 0.0843741521f},
-std::array<float,2>{0.779785693f, 0.841905951f},
-std::array<float,2>{0.330966413f, 0.902696371f},
-std::array<float,2>{0.965249181f, 0.224359065f},
-std::array<float,2>{0.123744473f, 0.374548644f},
-std::array<float,2>{0.538180053f, 0.549540341f},
-std::array<float,2>{0.212726817f, 0.99368763f},
-std::array<float,2>{0.74310869f, 0.135247529f},
-std::array<float,2>{0.447604954f, 0.31090796f},
-std::array<float,2>{0.82347101f, 0.574252486f},
-std::array<float,2>{0.257030368f, 0.656926572f},
-std::array<float,2>{0.92701453f, 0.497894734f},
-std::array<float,2>{0.0372439623f, 0.0291792899f},
-std::array<float,2>{0.563326955f, 0.794819832f},
-std::array<float,2>{0.0634240881f, 0.509058356f},
-std::array<float,2>{0.524037957f, 0.340061545f},
-std::array<float,2>{0.346985847f, 0.190435171f},
-std::array<float,2>{0.984425187f, 0.928214312f},
-std::array<float,2>{0.416518986f, 0.846096516f},
-std::array<float,2>{0.791940987f, 0.123310477f},
-std::array<float,2>{0.182198003f, 0.430943996f},
-std::array<float,2>{0.647356451f, 0.693964243f},
-std::array<float,2>{0.104797043f, 0.916048408f},
-std::array<float,2>{0.546998918f, 0.21145083f},
-std::array<float,2>{0.316626191f, 0.315442085f},
-std::array<float,2>{0.950244308f, 0.526205182f},
-std::array<float,2>{0.382962555f, 0.703482568f},
-std::array<float,2>{0.755228519f, 0.413998127f},
-std::array<float,2>{0.141194284f, 0.104269899f},
-std::array<float,2>{0.674920797f, 0.867999077f},
-std::array<float,2>{0.249163985f, 0.585533977f},
-std::array<float,2>{0.697840929f, 0.28550747f},
-std::array<float,2>{0.477893889f, 0.150459111f},
-std::array<float,2>{0.849712074f, 0.971679091f},
-std::array<float,2>{0.288753837f, 0.806545198f},
-std::array<float,2>{0.878213644f, 0.00824475475f},
-std::array<float,2>{0.0274789091f, 0.469925374f},
-std::array<float,2>{0.613134921f, 0.681357801f},
-std::array<float,2>{0.167568073f, 0.823004544f},
-std::array<float,2>{0.637124479f, 0.0670748278f},
-std::array<float,2>{0.426235378f, 0.391104847f},
-std::array<float,2>{0.798649967f, 0.729758084f},
-std::array<float,2>{0.370822161f, 0.540379226f},
-std::array<float,2>{0.973435819f, 0.351453066f},
-std::array<float,2>{0.0878001824f, 0.241296768f},
-std::array<float,2>{0.503522098f, 0.881286204f},
-std::array<float,2>{0.0480861478f, 0.655303478f},
-std::array<float,2>{0.591700137f, 0.465374589f},
-std::array<float,2>{0.269983619f, 0.0430679992f},
-std::array<float,2>{0.915062964f, 0.750353456f},
-std::array<float,2>{0.45978564f, 0.956906378f},
-std::array<float,2>{0.83245796f, 0.167270884f},
-std::array<float,2>{0.19928053f, 0.256536037f},
-std::array<float,2>{0.729615569f, 0.606877327f},
-std::array<float,2>{0.0579660572f, 0.838162243f},
-std::array<float,2>{0.585078716f, 0.0810601413f},
-std::array<float,2>{0.276525915f, 0.376273394f},
-std::array<float,2>{0.913439393f, 0.746351242f},
-std::array<float,2>{0.463023156f, 0.552538991f},
-std::array<float,2>{0.842277288f, 0.368998528f},
-std::array<float,2>{0.193253443f, 0.221412748f},
-std::array<float,2>{0.720674038f, 0.900440633f},
-std::array<float,2>{0.16328077f, 0.62835753f},
-std::array<float,2>{0.632762492f, 0.449379772f},
-std::array<float,2>{0.429821491f, 0.0551268719f},
-std::array<float,2>{0.807121336f, 0.772095799f},
-std::array<float,2>{0.360812247f, 0.951910317f},
-std::array<float,2>{0.98113519f, 0.17827642f},
-std::array<float,2>{0.0797227696f, 0.268740267f},
-std::array<float,2>{0.509679675f, 0.611579001f},
-std::array<float,2>{0.241180122f, 0.922398448f},
-std::array<float,2>{0.694644868f, 0.193466932f},
-std::array<float,2>{0.475365251f, 0.338060707f},
-std::array<float,2>{0.859293401f, 0.51385057f},
-std::array<float,2>{0.293714345f, 0.689904034f},
-std::array<float,2>{0.888008296f, 0.434661597f},
-std::array<float,2>{0.0166088454f, 0.118823908f},
-std::array<float,2>{0.624743104f, 0.850356996f},
-std::array<float,2>{0.0951545313f, 0.57101965f},
-std::array<float,2>{0.556912482f, 0.308306426f},
-std::array<float,2>{0.327540457f, 0.136739716f},
-std::array<float,2>{0.93775928f, 0.998162091f},
-std::array<float,2>{0.376122355f, 0.79005754f},
-std::array<float,2>{0.763275862f, 0.0269943941f},
-std::array<float,2>{0.151553363f, 0.492497593f},
-std::array<float,2>{0.679963529f, 0.661387265f},
-std::array<float,2>{0.0771676674f, 0.974143326f},
-std::array<float,2>{0.518714726f, 0.15376763f},
-std::array<float,2>{0.357571632f, 0.282141626f},
-std::array<float,2>{0.997777641f, 0.578142405f},
-std::array<float,2>{0.413777441f, 0.684177816f},
-std::array<float,2>{0.788387835f, 0.474744529f},
-std::array<float,2>{0.174008653f, 0.0123329777f},
-std::array<float,2>{0.655078411f, 0.8123703f},
-std::array<float,2>{0.207446992f, 0.529450655f},
-std::array<float,2>{0.740096271f, 0.31801495f},
-std::array<float,2>{0.443204492f, 0.218323722f},
-std::array<float,2>{0.817712367f, 0.921716988f},
-std::array<float,2>{0.261819005f, 0.87435025f},
-std::array<float,2>{0.93499285f, 0.108268104f},
-std::array<float,2>{0.0457787737f, 0.408251405f},
-std::array<float,2>{0.573477149f, 0.709699452f},
-std::array<float,2>{0.139084771f, 0.75612855f},
-std::array<float,2>{0.659114361f, 0.0422016792f},
-std::array<float,2>{0.402749509f, 0.461208642f},
-std::array<float,2>{0.767258346f, 0.651916027f},
-std::array<float,2>{0.341706246f, 0.605029345f},
-std::array<float,2>{0.955703497f, 0.252196729f},
-std::array<float,2>{0.116031975f, 0.168982998f},
-std::array<float,2>{0.545038462f, 0.960074544f},
-std::array<float,2>{0.00433662347f, 0.731024921f},
-std::array<float,2>{0.603289843f, 0.395641237f},
-std::array<float,2>{0.301718026f, 0.0626353845f},
-std::array<float,2>{0.904110849f, 0.824589849f},
-std::array<float,2>{0.496397078f, 0.876137197f},
-std::array<float,2>{0.866944611f, 0.236243427f},
-std::array<float,2>{0.220037982f, 0.343816608f},
-std::array<float,2>{0.714384139f, 0.546069205f},
-std::array<float,2>{0.120647587f, 0.801643789f},
-std::array<float,2>{0.533682406f, 0.00574026303f},
-std::array<float,2>{0.334682852f, 0.481157988f},
-std::array<float,2>{0.963111401f, 0.67626363f},
-std::array<float,2>{0.390666008f, 0.587495446f},
-std::array<float,2>{0.774012983f, 0.292488515f},
-std::array<float,2>{0.129279926f, 0.144223884f},
-std::array<float,2>{0.671042979f, 0.977689564f},
-std::array<float,2>{0.233473867f, 0.714690745f},
-std::array<float,2>{0.708862185f, 0.418434352f},
-std::array<float,2>{0.491243035f, 0.0961317942f},
-std::array<float,2>{0.869383812f, 0.859794378f},
-std::array<float,2>{0.31076771f, 0.909364104f},
-std::array<float,2>{0.893331826f, 0.210350603f},
-std::array<float,2>{0.0141405147f, 0.327122539f},
-std::array<float,2>{0.599646807f, 0.521137953f},
-std::array<float,2>{0.18552871f, 0.96240449f},
-std::array<float,2>{0.64184469f, 0.162597999f},
-std::array<float,2>{0.419444323f, 0.26192382f},
-std::array<float,2>{0.793463945f, 0.595840931f},
-std::array<float,2>{0.348769993f, 0.645885408f},
-std::array<float,2>{0.989086092f, 0.455875307f},
-std::array<float,2>{0.0687044114f, 0.0372966677f},
-std::array<float,2>{0.529259205f, 0.759966433f},
-std::array<float,2>{0.0350055993f, 0.534461796f},
-std::array<float,2>{0.568409503f, 0.352414846f},
-std::array<float,2>{0.253635794f, 0.248389333f},
-std::array<float,2>{0.922501981f, 0.883054137f},
-std::array<float,2>{0.44945401f, 0.817274511f},
-std::array<float,2>{0.824323118f, 0.0752994269f},
-std::array<float,2>{0.21544975f, 0.399316192f},
-std::array<float,2>{0.747758269f, 0.719728112f},
-std::array<float,2>{0.0242206603f, 0.890782416f},
-std::array<float,2>{0.613347113f, 0.229552865f},
-std::array<float,2>{0.284676045f, 0.361416847f},
-std::array<float,2>{0.882239163f, 0.562426984f},
-std::array<float,2>{0.482033104f, 0.735719264f},
-std::array<float,2>{0.847394705f, 0.386040509f},
-std::array<float,2>{0.24452126f, 0.0903776586f},
-std::array<float,2>{0.702557564f, 0.834888458f},
-std::array<float,2>{0.147357672f, 0.620167255f},
-std::array<float,2>{0.677978694f, 0.277877092f},
-std::array<float,2>{0.390293628f, 0.180614382f},
-std::array<float,2>{0.752599955f, 0.940021396f},
-std::array<float,2>{0.314946383f, 0.776068449f},
-std::array<float,2>{0.948533773f, 0.0505948812f},
-std::array<float,2>{0.106834248f, 0.442430496f},
-std::array<float,2>{0.552626014f, 0.634394705f},
-std::array<float,2>{0.196675554f, 0.857571483f},
-std::array<float,2>{0.733678818f, 0.114630662f},
-std::array<float,2>{0.453149348f, 0.422661304f},
-std::array<float,2>{0.828822553f, 0.700236857f},
-std::array<float,2>{0.267144144f, 0.505810857f},
-std::array<float,2>{0.920981228f, 0.329494655f},
-std::array<float,2>{0.0525137149f, 0.198087528f},
-std::array<float,2>{0.588394701f, 0.930115104f},
-std::array<float,2>{0.0909172818f, 0.669684649f},
-std::array<float,2>{0.506933093f, 0.487122387f},
-std::array<float,2>{0.371925056f, 0.0213924143f},
-std::array<float,2>{0.971477211f, 0.787047386f},
-std::array<float,2>{0.422464162f, 0.991755962f},
-std::array<float,2>{0.802409291f, 0.125069126f},
-std::array<float,2>{0.17090565f, 0.303886056f},
-std::array<float,2>{0.634797275f, 0.568465173f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.463472039f, 0.0167457238f},
-std::array<float,2>{0.994335592f, 0.932864308f},
-std::array<float,2>{0.724617481f, 0.360055119f},
-std::array<float,2>{0.189984038f, 0.716514647f},
-std::array<float,2>{0.0212252289f, 0.470985264f},
-std::array<float,2>{0.508206487f, 0.624025226f},
-std::array<float,2>{0.85262233f, 0.225731269f},
-std::array<float,2>{0.366055489f, 0.87403518f},
-std::array<float,2>{0.152457729f, 0.173908636f},
-std::array<float,2>{0.640052736f, 0.789333999f},
-std::array<float,2>{0.879575968f, 0.429727048f},
-std::array<float,2>{0.424073547f, 0.550613046f},
-std::array<float,2>{0.289914519f, 0.304595053f},
-std::array<float,2>{0.770624518f, 0.637997031f},
-std::array<float,2>{0.624035776f, 0.0637446269f},
-std::array<float,2>{0.0952391624f, 0.957689703f},
-std::array<float,2>{0.332425475f, 0.191925228f},
-std::array<float,2>{0.82318151f, 0.816213787f},
-std::array<float,2>{0.556471705f, 0.468257993f},
-std::array<float,2>{0.0351947099f, 0.58608675f},
-std::array<float,2>{0.226195097f, 0.319641322f},
-std::array<float,2>{0.703616798f, 0.728209078f},
-std::array<float,2>{0.968060195f, 0.0499507748f},
-std::array<float,2>{0.484409899f, 0.886288404f},
-std::array<float,2>{0.0729225278f, 0.118577473f},
-std::array<float,2>{0.589370966f, 0.968928218f},
-std::array<float,2>{0.798712969f, 0.253688693f},
-std::array<float,2>{0.257146657f, 0.664887965f},
-std::array<float,2>{0.393555671f, 0.405549586f},
-std::array<float,2>{0.932093263f, 0.517407f},
-std::array<float,2>{0.685016632f, 0.146852151f},
-std::array<float,2>{0.178307891f, 0.760098636f},
-std::array<float,2>{0.42025435f, 0.125887856f},
-std::array<float,2>{0.899439394f, 0.776613474f},
-std::array<float,2>{0.65531081f, 0.381656826f},
-std::array<float,2>{0.1281427f, 0.508009493f},
-std::array<float,2>{0.111288242f, 0.277482241f},
-std::array<float,2>{0.603228331f, 0.676494181f},
-std::array<float,2>{0.755793631f, 0.103171639f},
-std::array<float,2>{0.311455995f, 0.995365441f},
-std::array<float,2>{0.20909813f, 0.0398428179f},
-std::array<float,2>{0.741073668f, 0.904120147f},
-std::array<float,2>{0.973589003f, 0.33052519f},
-std::array<float,2>{0.438361168f, 0.747338474f},
-std::array<float,2>{0.345665008f, 0.443628252f},
-std::array<float,2>{0.864005029f, 0.568706095f},
-std::array<float,2>{0.529972315f, 0.214402899f},
-std::array<float,2>{0.0147778969f, 0.839880586f},
-std::array<float,2>{0.270216137f, 0.0934511945f},
-std::array<float,2>{0.794424295f, 0.952542126f},
-std::array<float,2>{0.572733939f, 0.286925256f},
-std::array<float,2>{0.0818818808f, 0.640869856f},
-std::array<float,2>{0.166240707f, 0.417269111f},
-std::array<float,2>{0.665099084f, 0.541566968f},
-std::array<float,2>{0.921287835f, 0.162582591f},
-std::array<float,2>{0.387284279f, 0.800378919f},
-std::array<float,2>{0.0557478517f, 0.247790828f},
-std::array<float,2>{0.531939745f, 0.85891211f},
-std::array<float,2>{0.835358024f, 0.492689341f},
-std::array<float,2>{0.322629571f, 0.601399899f},
-std::array<float,2>{0.470250964f, 0.345370561f},
-std::array<float,2>{0.940341055f, 0.6923877f},
-std::array<float,2>{0.691378415f, 0.00315442006f},
-std::array<float,2>{0.237065896f, 0.908105671f},
-std::array<float,2>{0.378410995f, 0.0993212312f},
-std::array<float,2>{0.910784066f, 0.985495567f},
-std::array<float,2>{0.663677156f, 0.26897642f},
-std::array<float,2>{0.162307218f, 0.682394445f},
-std::array<float,2>{0.0896947905f, 0.383389562f},
-std::array<float,2>{0.563922584f, 0.505468965f},
-std::array<float,2>{0.787458003f, 0.134029388f},
-std::array<float,2>{0.27406323f, 0.77247709f},
-std::array<float,2>{0.247012854f, 0.205581725f},
-std::array<float,2>{0.696904838f, 0.834679306f},
-std::array<float,2>{0.948241413f, 0.448256969f},
-std::array<float,2>{0.476967245f, 0.570430994f},
-std::array<float,2>{0.314517975f, 0.34249258f},
-std::array<float,2>{0.840126038f, 0.741331637f},
-std::array<float,2>{0.542540073f, 0.036644984f},
-std::array<float,2>{0.0486180447f, 0.896212935f},
-std::array<float,2>{0.301492482f, 0.164732248f},
-std::array<float,2>{0.758159339f, 0.808389008f},
-std::array<float,2>{0.593897402f, 0.409502089f},
-std::array<float,2>{0.123001359f, 0.53903234f},
-std::array<float,2>{0.134961784f, 0.290733069f},
-std::array<float,2>{0.647462368f, 0.655282915f},
-std::array<float,2>{0.898189664f, 0.085914053f},
-std::array<float,2>{0.411077887f, 0.941303015f},
-std::array<float,2>{0.00753292674f, 0.00904614199f},
-std::array<float,2>{0.518984795f, 0.916640818f},
-std::array<float,2>{0.872452319f, 0.357936084f},
-std::array<float,2>{0.356536895f, 0.70080632f},
-std::array<float,2>{0.451155365f, 0.486605048f},
-std::array<float,2>{0.978565574f, 0.603293002f},
-std::array<float,2>{0.744313359f, 0.236487135f},
-std::array<float,2>{0.211018845f, 0.849487185f},
-std::array<float,2>{0.497860134f, 0.227131069f},
-std::array<float,2>{0.960637331f, 0.86652416f},
-std::array<float,2>{0.718066037f, 0.481616139f},
-std::array<float,2>{0.230148464f, 0.613978326f},
-std::array<float,2>{0.0402829088f, 0.372429341f},
-std::array<float,2>{0.547065377f, 0.709771633f},
-std::array<float,2>{0.819817185f, 0.0242024809f},
-std::array<float,2>{0.34050557f, 0.928253055f},
-std::array<float,2>{0.180348426f, 0.0766027123f},
-std::array<float,2>{0.678578794f, 0.964762807f},
-std::array<float,2>{0.923965156f, 0.305710793f},
-std::array<float,2>{0.405660987f, 0.632798254f},
-std::array<float,2>{0.261555612f, 0.422007978f},
-std::array<float,2>{0.807302117f, 0.555956841f},
-std::array<float,2>{0.583133757f, 0.186868608f},
-std::array<float,2>{0.0643857867f, 0.788720608f},
-std::array<float,2>{0.374203235f, 0.0609608181f},
-std::array<float,2>{0.848468959f, 0.879627764f},
-std::array<float,2>{0.505393803f, 0.323785424f},
-std::array<float,2>{0.0234457962f, 0.724434376f},
-std::array<float,2>{0.196676433f, 0.458477587f},
-std::array<float,2>{0.728518903f, 0.581215382f},
-std::array<float,2>{0.987653077f, 0.201591209f},
-std::array<float,2>{0.454344928f, 0.820722759f},
-std::array<float,2>{0.103092454f, 0.152300686f},
-std::array<float,2>{0.612022579f, 0.755491316f},
-std::array<float,2>{0.774435341f, 0.394387841f},
-std::array<float,2>{0.288781196f, 0.524687409f},
-std::array<float,2>{0.430680275f, 0.258214086f},
-std::array<float,2>{0.88985002f, 0.657137811f},
-std::array<float,2>{0.62988323f, 0.111940399f},
-std::array<float,2>{0.146048456f, 0.979365945f},
-std::array<float,2>{0.429484069f, 0.0327350497f},
-std::array<float,2>{0.87562722f, 0.894100308f},
-std::array<float,2>{0.635359049f, 0.338759363f},
-std::array<float,2>{0.149387106f, 0.736848533f},
-std::array<float,2>{0.0983873457f, 0.450949132f},
-std::array<float,2>{0.618610919f, 0.575778067f},
-std::array<float,2>{0.767220855f, 0.208709568f},
-std::array<float,2>{0.294702053f, 0.829404533f},
-std::array<float,2>{0.19178468f, 0.137837112f},
-std::array<float,2>{0.722653568f, 0.76597327f},
-std::array<float,2>{0.997304142f, 0.387175351f},
-std::array<float,2>{0.467313826f, 0.50039655f},
-std::array<float,2>{0.3596178f, 0.272521496f},
-std::array<float,2>{0.855796754f, 0.686138093f},
-std::array<float,2>{0.514920592f, 0.0965458155f},
-std::array<float,2>{0.017985519f, 0.989012301f},
-std::array<float,2>{0.253063262f, 0.240827486f},
-std::array<float,2>{0.803712964f, 0.84699589f},
-std::array<float,2>{0.591799259f, 0.489529639f},
-std::array<float,2>{0.0755019113f, 0.609087229f},
-std::array<float,2>{0.174339488f, 0.351581603f},
-std::array<float,2>{0.681191325f, 0.699041486f},
-std::array<float,2>{0.937130928f, 0.0121884467f},
-std::array<float,2>{0.396880776f, 0.920067906f},
-std::array<float,2>{0.0320290662f, 0.078788355f},
-std::array<float,2>{0.56032002f, 0.942864418f},
-std::array<float,2>{0.825587809f, 0.294959337f},
-std::array<float,2>{0.328544736f, 0.651384592f},
-std::array<float,2>{0.489224792f, 0.411470294f},
-std::array<float,2>{0.96366781f, 0.533017933f},
-std::array<float,2>{0.708136201f, 0.170037121f},
-std::array<float,2>{0.222500801f, 0.811873138f},
-std::array<float,2>{0.441972643f, 0.183567047f},
-std::array<float,2>{0.968760371f, 0.782868803f},
-std::array<float,2>{0.735283971f, 0.426086128f},
-std::array<float,2>{0.206914827f, 0.5623101f},
-std::array<float,2>{0.0107515641f, 0.312403142f},
-std::array<float,2>{0.524357498f, 0.625546694f},
-std::array<float,2>{0.86312598f, 0.0739633888f},
-std::array<float,2>{0.349594384f, 0.968214512f},
-std::array<float,2>{0.130279407f, 0.0275974441f},
-std::array<float,2>{0.651631236f, 0.923430622f},
-std::array<float,2>{0.905056894f, 0.369593382f},
-std::array<float,2>{0.417672306f, 0.703492105f},
-std::array<float,2>{0.305656284f, 0.477643251f},
-std::array<float,2>{0.753601968f, 0.609868228f},
-std::array<float,2>{0.607216001f, 0.23236379f},
-std::array<float,2>{0.114519008f, 0.862272501f},
-std::array<float,2>{0.32646355f, 0.114546567f},
-std::array<float,2>{0.829286397f, 0.983172476f},
-std::array<float,2>{0.538505793f, 0.265602738f},
-std::array<float,2>{0.0617371537f, 0.662657499f},
-std::array<float,2>{0.23939307f, 0.395838588f},
-std::array<float,2>{0.694052398f, 0.529808342f},
-std::array<float,2>{0.943487465f, 0.153762698f},
-std::array<float,2>{0.47591272f, 0.753029823f},
-std::array<float,2>{0.0851916149f, 0.19887349f},
-std::array<float,2>{0.575625241f, 0.827290952f},
-std::array<float,2>{0.791682959f, 0.456959337f},
-std::array<float,2>{0.267831564f, 0.58298254f},
-std::array<float,2>{0.385908484f, 0.324875951f},
-std::array<float,2>{0.915871501f, 0.722065151f},
-std::array<float,2>{0.668992639f, 0.057357993f},
-std::array<float,2>{0.170621037f, 0.876993835f},
-std::array<float,2>{0.48075974f, 0.0667110458f},
-std::array<float,2>{0.950738668f, 0.953579903f},
-std::array<float,2>{0.699726224f, 0.300358415f},
-std::array<float,2>{0.245933488f, 0.633818984f},
-std::array<float,2>{0.0529363453f, 0.435198873f},
-std::array<float,2>{0.545608044f, 0.552802682f},
-std::array<float,2>{0.839091241f, 0.17944558f},
-std::array<float,2>{0.317579478f, 0.79618603f},
-std::array<float,2>{0.156353027f, 0.220719188f},
-std::array<float,2>{0.656826437f, 0.867414713f},
-std::array<float,2>{0.908172667f, 0.473682314f},
-std::array<float,2>{0.381859273f, 0.619169414f},
-std::array<float,2>{0.279498369f, 0.364145517f},
-std::array<float,2>{0.78390038f, 0.711442292f},
-std::array<float,2>{0.568243086f, 0.0215363335f},
-std::array<float,2>{0.0928556919f, 0.936752021f},
-std::array<float,2>{0.354902387f, 0.142508447f},
-std::array<float,2>{0.867700815f, 0.764346123f},
-std::array<float,2>{0.522169828f, 0.39983362f},
-std::array<float,2>{0.00240494218f, 0.52059561f},
-std::array<float,2>{0.215450585f, 0.255152851f},
-std::array<float,2>{0.747539401f, 0.668737829f},
-std::array<float,2>{0.981319666f, 0.123918638f},
-std::array<float,2>{0.449091494f, 0.973377466f},
-std::array<float,2>{0.120934956f, 0.0517527089f},
-std::array<float,2>{0.601183236f, 0.888106525f},
-std::array<float,2>{0.76330018f, 0.315554351f},
-std::array<float,2>{0.30014196f, 0.732807279f},
-std::array<float,2>{0.409500808f, 0.462504417f},
-std::array<float,2>{0.893259168f, 0.590260327f},
-std::array<float,2>{0.643821716f, 0.188051388f},
-std::array<float,2>{0.138915509f, 0.816559136f},
-std::array<float,2>{0.401428699f, 0.214897737f},
-std::array<float,2>{0.928295016f, 0.838460505f},
-std::array<float,2>{0.673544288f, 0.438784331f},
-std::array<float,2>{0.185027078f, 0.565656006f},
-std::array<float,2>{0.066656664f, 0.335535109f},
-std::array<float,2>{0.580255568f, 0.743565798f},
-std::array<float,2>{0.812007666f, 0.0447757393f},
-std::array<float,2>{0.262215853f, 0.900679469f},
-std::array<float,2>{0.23361446f, 0.106551364f},
-std::array<float,2>{0.712211013f, 0.996699691f},
-std::array<float,2>{0.954030633f, 0.275631249f},
-std::array<float,2>{0.49226588f, 0.673191309f},
-std::array<float,2>{0.336858064f, 0.377551436f},
-std::array<float,2>{0.812822461f, 0.513224304f},
-std::array<float,2>{0.552715778f, 0.130008474f},
-std::array<float,2>{0.0450934879f, 0.780668795f},
-std::array<float,2>{0.281263858f, 0.00696637668f},
-std::array<float,2>{0.778396606f, 0.912682176f},
-std::array<float,2>{0.616241992f, 0.347660989f},
-std::array<float,2>{0.108803101f, 0.690756679f},
-std::array<float,2>{0.144360259f, 0.497068614f},
-std::array<float,2>{0.625712574f, 0.594986677f},
-std::array<float,2>{0.883299351f, 0.243154347f},
-std::array<float,2>{0.433809072f, 0.855338693f},
-std::array<float,2>{0.0310682226f, 0.159723654f},
-std::array<float,2>{0.503294647f, 0.802624166f},
-std::array<float,2>{0.846276641f, 0.420421332f},
-std::array<float,2>{0.369387001f, 0.543563366f},
-std::array<float,2>{0.457872123f, 0.284744084f},
-std::array<float,2>{0.988375545f, 0.646247566f},
-std::array<float,2>{0.732285976f, 0.0898323581f},
-std::array<float,2>{0.199719995f, 0.947115779f},
-std::array<float,2>{0.487058163f, 0.0486883335f},
-std::array<float,2>{0.965008497f, 0.884429574f},
-std::array<float,2>{0.706337929f, 0.317451805f},
-std::array<float,2>{0.223573163f, 0.72859174f},
-std::array<float,2>{0.037628606f, 0.466042817f},
-std::array<float,2>{0.557377577f, 0.588809133f},
-std::array<float,2>{0.821047962f, 0.194264933f},
-std::array<float,2>{0.335008025f, 0.812934637f},
-std::array<float,2>{0.177065879f, 0.145856529f},
-std::array<float,2>{0.687354684f, 0.758723795f},
-std::array<float,2>{0.929735482f, 0.402882516f},
-std::array<float,2>{0.390813053f, 0.518818915f},
-std::array<float,2>{0.254853576f, 0.250180691f},
-std::array<float,2>{0.799642444f, 0.667375267f},
-std::array<float,2>{0.587092578f, 0.119543776f},
-std::array<float,2>{0.0716047809f, 0.971999586f},
-std::array<float,2>{0.36330536f, 0.223147467f},
-std::array<float,2>{0.85529834f, 0.871892691f},
-std::array<float,2>{0.510403395f, 0.46948123f},
-std::array<float,2>{0.021614166f, 0.622671425f},
-std::array<float,2>{0.188157082f, 0.361606717f},
-std::array<float,2>{0.723518491f, 0.718190968f},
-std::array<float,2>{0.993628621f, 0.019064784f},
-std::array<float,2>{0.462281793f, 0.931510687f},
-std::array<float,2>{0.095744051f, 0.0660323575f},
-std::array<float,2>{0.621608198f, 0.95921123f},
-std::array<float,2>{0.773224056f, 0.301512927f},
-std::array<float,2>{0.291140169f, 0.639851451f},
-std::array<float,2>{0.422634512f, 0.432320833f},
-std::array<float,2>{0.882215559f, 0.548293412f},
-std::array<float,2>{0.637638211f, 0.171893418f},
-std::array<float,2>{0.154806092f, 0.792783499f},
-std::array<float,2>{0.390589893f, 0.16046536f},
-std::array<float,2>{0.919434488f, 0.798393786f},
-std::array<float,2>{0.667192638f, 0.414704144f},
-std::array<float,2>{0.165864483f, 0.539596915f},
-std::array<float,2>{0.0799071267f, 0.288125783f},
-std::array<float,2>{0.570960581f, 0.642611265f},
-std::array<float,2>{0.796745777f, 0.090913415f},
-std::array<float,2>{0.27283901f, 0.950516164f},
-std::array<float,2>{0.23511681f, 0.00101181981f},
-std::array<float,2>{0.687592149f, 0.909493864f},
-std::array<float,2>{0.93840915f, 0.347598851f},
-std::array<float,2>{0.471244395f, 0.694645345f},
-std::array<float,2>{0.320872843f, 0.495647699f},
-std::array<float,2>{0.833374381f, 0.59895891f},
-std::array<float,2>{0.533559799f, 0.249651507f},
-std::array<float,2>{0.0574039407f, 0.85705632f},
-std::array<float,2>{0.30882892f, 0.104354694f},
-std::array<float,2>{0.757522225f, 0.993856668f},
-std::array<float,2>{0.60367322f, 0.280517608f},
-std::array<float,2>{0.112058975f, 0.67924273f},
-std::array<float,2>{0.126158237f, 0.380410731f},
-std::array<float,2>{0.653480411f, 0.510681152f},
-std::array<float,2>{0.900402248f, 0.127241775f},
-std::array<float,2>{0.419290543f, 0.775293052f},
-std::array<float,2>{0.0119358795f, 0.211399153f},
-std::array<float,2>{0.528147101f, 0.842108965f},
-std::array<float,2>{0.865352273f, 0.4432064f},
-std::array<float,2>{0.346510708f, 0.567835927f},
-std::array<float,2>{0.441331416f, 0.329986185f},
-std::array<float,2>{0.975852072f, 0.749965906f},
-std::array<float,2>{0.73903507f, 0.0412754864f},
-std::array<float,2>{0.20873943f, 0.904853761f},
-std::array<float,2>{0.413236052f, 0.0833952725f},
-std::array<float,2>{0.896359324f, 0.938179016f},
-std::array<float,2>{0.645009696f, 0.291694015f},
-std::array<float,2>{0.133727357f, 0.65296644f},
-std::array<float,2>{0.123898216f, 0.407123625f},
-std::array<float,2>{0.597514212f, 0.536432624f},
-std::array<float,2>{0.76160121f, 0.166913226f},
-std::array<float,2>{0.30301097f, 0.804758966f},
-std::array<float,2>{0.213156819f, 0.23607263f},
-std::array<float,2>{0.742371798f, 0.851353586f},
-std::array<float,2>{0.978124917f, 0.486038864f},
-std::array<float,2>{0.451713413f, 0.604939818f},
-std::array<float,2>{0.35888344f, 0.356616467f},
-std::array<float,2>{0.873711944f, 0.702926695f},
-std::array<float,2>{0.516108036f, 0.0108479401f},
-std::array<float,2>{0.00454062922f, 0.914219141f},
-std::array<float,2>{0.276419699f, 0.135728151f},
-std::array<float,2>{0.786321342f, 0.770343184f},
-std::array<float,2>{0.565240502f, 0.384989053f},
-std::array<float,2>{0.0865119994f, 0.506988645f},
-std::array<float,2>{0.161955535f, 0.2672351f},
-std::array<float,2>{0.660726249f, 0.681348205f},
-std::array<float,2>{0.912597835f, 0.101515785f},
-std::array<float,2>{0.376392603f, 0.986928999f},
-std::array<float,2>{0.0492490903f, 0.0379523449f},
-std::array<float,2>{0.539064646f, 0.898201287f},
-std::array<float,2>{0.843299508f, 0.34010756f},
-std::array<float,2>{0.313584477f, 0.739895463f},
-std::array<float,2>{0.48020947f, 0.445956111f},
-std::array<float,2>{0.946717441f, 0.57407856f},
-std::array<float,2>{0.698115349f, 0.203177556f},
-std::array<float,2>{0.248732448f, 0.833565176f},
-std::array<float,2>{0.45665428f, 0.201087579f},
-std::array<float,2>{0.985657692f, 0.823586166f},
-std::array<float,2>{0.72820729f, 0.459860325f},
-std::array<float,2>{0.198653236f, 0.57967478f},
-std::array<float,2>{0.0269454196f, 0.322160929f},
-std::array<float,2>{0.507119119f, 0.724840105f},
-std::array<float,2>{0.849951148f, 0.0597996265f},
-std::array<float,2>{0.372245789f, 0.881071925f},
-std::array<float,2>{0.147140369f, 0.111299179f},
-std::array<float,2>{0.631856859f, 0.978301883f},
-std::array<float,2>{0.887770712f, 0.26002872f},
-std::array<float,2>{0.431801438f, 0.658509552f},
-std::array<float,2>{0.287054241f, 0.391434729f},
-std::array<float,2>{0.776811004f, 0.526638329f},
-std::array<float,2>{0.609919608f, 0.149285927f},
-std::array<float,2>{0.104342297f, 0.756172001f},
-std::array<float,2>{0.341893584f, 0.0263123903f},
-std::array<float,2>{0.816447198f, 0.926646233f},
-std::array<float,2>{0.550062418f, 0.374370605f},
-std::array<float,2>{0.0425298326f, 0.708066046f},
-std::array<float,2>{0.228476003f, 0.48339203f},
-std::array<float,2>{0.715350926f, 0.61570555f},
-std::array<float,2>{0.958664298f, 0.228589073f},
-std::array<float,2>{0.498479009f, 0.864435911f},
-std::array<float,2>{0.0649236068f, 0.184059426f},
-std::array<float,2>{0.584037244f, 0.785545647f},
-std::array<float,2>{0.806378961f, 0.42563194f},
-std::array<float,2>{0.258695573f, 0.558512807f},
-std::array<float,2>{0.403777778f, 0.307926953f},
-std::array<float,2>{0.922996581f, 0.630552053f},
-std::array<float,2>{0.677242696f, 0.0756429732f},
-std::array<float,2>{0.18205896f, 0.962371826f},
-std::array<float,2>{0.394595593f, 0.0147096924f},
-std::array<float,2>{0.935370982f, 0.917990863f},
-std::array<float,2>{0.683111727f, 0.354350507f},
-std::array<float,2>{0.173213094f, 0.696294844f},
-std::array<float,2>{0.0764816105f, 0.490776539f},
-std::array<float,2>{0.59094435f, 0.605828404f},
-std::array<float,2>{0.801412463f, 0.23966974f},
-std::array<float,2>{0.251822174f, 0.844875932f},
-std::array<float,2>{0.219633743f, 0.169542342f},
-std::array<float,2>{0.709359765f, 0.808631778f},
-std::array<float,2>{0.962456822f, 0.413220137f},
-std::array<float,2>{0.491208702f, 0.53407222f},
-std::array<float,2>{0.330399036f, 0.294407368f},
-std::array<float,2>{0.82758081f, 0.650164783f},
-std::array<float,2>{0.560750246f, 0.0813370124f},
-std::array<float,2>{0.0341485776f, 0.944096208f},
-std::array<float,2>{0.296867222f, 0.209578231f},
-std::array<float,2>{0.76929903f, 0.830091894f},
-std::array<float,2>{0.620711684f, 0.451210827f},
-std::array<float,2>{0.10013482f, 0.576385498f},
-std::array<float,2>{0.151708156f, 0.33698979f},
-std::array<float,2>{0.632943213f, 0.735378027f},
-std::array<float,2>{0.878313243f, 0.0336040519f},
-std::array<float,2>{0.427588075f, 0.891980052f},
-std::array<float,2>{0.0167246088f, 0.0948175639f},
-std::array<float,2>{0.512518048f, 0.991105735f},
-std::array<float,2>{0.859012127f, 0.269747436f},
-std::array<float,2>{0.362759709f, 0.684344113f},
-std::array<float,2>{0.466266811f, 0.390113562f},
-std::array<float,2>{0.999263704f, 0.502405703f},
-std::array<float,2>{0.718840718f, 0.139392138f},
-std::array<float,2>{0.193454579f, 0.768547595f},
-std::array<float,2>{0.472960591f, 0.155146748f},
-std::array<float,2>{0.94197762f, 0.750378847f},
-std::array<float,2>{0.69164592f, 0.397718728f},
-std::array<float,2>{0.240612164f, 0.528217971f},
-std::array<float,2>{0.0597026832f, 0.26286003f},
-std::array<float,2>{0.536521852f, 0.661637604f},
-std::array<float,2>{0.830308795f, 0.115284227f},
-std::array<float,2>{0.325839192f, 0.981464565f},
-std::array<float,2>{0.168645337f, 0.0547841229f},
-std::array<float,2>{0.671447098f, 0.87617749f},
-std::array<float,2>{0.917749405f, 0.326631695f},
-std::array<float,2>{0.384480536f, 0.719582736f},
-std::array<float,2>{0.2670196f, 0.4547126f},
-std::array<float,2>{0.78932786f, 0.584530652f},
-std::array<float,2>{0.576919794f, 0.196647048f},
-std::array<float,2>{0.082174696f, 0.825122178f},
-std::array<float,2>{0.350643575f, 0.0703633651f},
-std::array<float,2>{0.85978651f, 0.966610074f},
-std::array<float,2>{0.525654078f, 0.310120225f},
-std::array<float,2>{0.0096211154f, 0.628056228f},
-std::array<float,2>{0.203770414f, 0.429591388f},
-std::array<float,2>{0.736804068f, 0.558814108f},
-std::array<float,2>{0.972285748f, 0.180873111f},
-std::array<float,2>{0.444728732f, 0.784541249f},
-std::array<float,2>{0.116901368f, 0.233636156f},
-std::array<float,2>{0.608222306f, 0.859505355f},
-std::array<float,2>{0.750176847f, 0.479532003f},
-std::array<float,2>{0.306916177f, 0.611593723f},
-std::array<float,2>{0.415258825f, 0.368239135f},
-std::array<float,2>{0.903491855f, 0.706624806f},
-std::array<float,2>{0.649365544f, 0.0296517275f},
-std::array<float,2>{0.132244468f, 0.924494922f},
-std::array<float,2>{0.446985185f, 0.121944822f},
-std::array<float,2>{0.982946157f, 0.975343466f},
-std::array<float,2>{0.748216987f, 0.25665316f},
-std::array<float,2>{0.217866868f, 0.671115339f},
-std::array<float,2>{0.0008027656f, 0.40186277f},
-std::array<float,2>{0.519931734f, 0.522204041f},
-std::array<float,2>{0.869993687f, 0.143088132f},
-std::array<float,2>{0.352941245f, 0.762813509f},
-std::array<float,2>{0.137164414f, 0.191012591f},
-std::array<float,2>{0.640794039f, 0.81983012f},
-std::array<float,2>{0.891143322f, 0.464772463f},
-std::array<float,2>{0.407541245f, 0.59185636f},
-std::array<float,2>{0.297563434f, 0.314172834f},
-std::array<float,2>{0.765011668f, 0.731315076f},
-std::array<float,2>{0.599213421f, 0.0535659753f},
-std::array<float,2>{0.118152693f, 0.889233351f},
-std::array<float,2>{0.318787634f, 0.177590221f},
-std::array<float,2>{0.836779714f, 0.794706821f},
-std::array<float,2>{0.543803215f, 0.436883211f},
-std::array<float,2>{0.0508233234f, 0.552634478f},
-std::array<float,2>{0.242370382f, 0.298045576f},
-std::array<float,2>{0.702365577f, 0.636434913f},
-std::array<float,2>{0.951325774f, 0.0702067539f},
-std::array<float,2>{0.483883262f, 0.956478119f},
-std::array<float,2>{0.0911133662f, 0.0208910163f},
-std::array<float,2>{0.568882883f, 0.935527503f},
-std::array<float,2>{0.783090532f, 0.366817206f},
-std::array<float,2>{0.278835803f, 0.714558959f},
-std::array<float,2>{0.380427033f, 0.475518256f},
-std::array<float,2>{0.910152674f, 0.618606567f},
-std::array<float,2>{0.659733653f, 0.220065743f},
-std::array<float,2>{0.160153419f, 0.871073425f},
-std::array<float,2>{0.437357992f, 0.244720191f},
-std::array<float,2>{0.885845304f, 0.852491617f},
-std::array<float,2>{0.628068686f, 0.498792678f},
-std::array<float,2>{0.141306028f, 0.596436918f},
-std::array<float,2>{0.106848225f, 0.350741267f},
-std::array<float,2>{0.61459887f, 0.689031839f},
-std::array<float,2>{0.779371977f, 0.005822971f},
-std::array<float,2>{0.284079075f, 0.911087394f},
-std::array<float,2>{0.202911511f, 0.0873146206f},
-std::array<float,2>{0.733368218f, 0.94808054f},
-std::array<float,2>{0.991782546f, 0.283032954f},
-std::array<float,2>{0.459999979f, 0.647347033f},
-std::array<float,2>{0.368153155f, 0.419583827f},
-std::array<float,2>{0.844721437f, 0.54648912f},
-std::array<float,2>{0.500726879f, 0.156355858f},
-std::array<float,2>{0.0276881661f, 0.803139448f},
-std::array<float,2>{0.265616179f, 0.0452482365f},
-std::array<float,2>{0.809782147f, 0.899193347f},
-std::array<float,2>{0.578540087f, 0.333798498f},
-std::array<float,2>{0.0694064423f, 0.745220006f},
-std::array<float,2>{0.185678437f, 0.439813912f},
-std::array<float,2>{0.675205231f, 0.562804043f},
-std::array<float,2>{0.927696049f, 0.218256563f},
-std::array<float,2>{0.399131566f, 0.837571561f},
-std::array<float,2>{0.0436829589f, 0.13231343f},
-std::array<float,2>{0.55455327f, 0.778257608f},
-std::array<float,2>{0.815544844f, 0.375144929f},
-std::array<float,2>{0.339721233f, 0.514543176f},
-std::array<float,2>{0.495668262f, 0.274191141f},
-std::array<float,2>{0.955847085f, 0.674563289f},
-std::array<float,2>{0.71476537f, 0.108319372f},
-std::array<float,2>{0.231406853f, 0.998189151f},
-std::array<float,2>{0.472463369f, 0.00265336968f},
-std::array<float,2>{0.938928604f, 0.906423926f},
-std::array<float,2>{0.689275563f, 0.344361067f},
-std::array<float,2>{0.2360636f, 0.691566467f},
-std::array<float,2>{0.0584689416f, 0.49412927f},
-std::array<float,2>{0.535086036f, 0.599988461f},
-std::array<float,2>{0.832044244f, 0.246913224f},
-std::array<float,2>{0.321442574f, 0.858011484f},
-std::array<float,2>{0.164574385f, 0.163921341f},
-std::array<float,2>{0.666242659f, 0.799258888f},
-std::array<float,2>{0.918803453f, 0.416141778f},
-std::array<float,2>{0.388863117f, 0.542369604f},
-std::array<float,2>{0.272444189f, 0.285616994f},
-std::array<float,2>{0.795720041f, 0.642435014f},
-std::array<float,2>{0.571932733f, 0.0927361697f},
-std::array<float,2>{0.078966558f, 0.951903999f},
-std::array<float,2>{0.347134143f, 0.213427156f},
-std::array<float,2>{0.866444707f, 0.841788054f},
-std::array<float,2>{0.529225886f, 0.444828302f},
-std::array<float,2>{0.0136362156f, 0.569447339f},
-std::array<float,2>{0.207926065f, 0.331384897f},
-std::array<float,2>{0.740149796f, 0.747052312f},
-std::array<float,2>{0.97488004f, 0.0409484245f},
-std::array<float,2>{0.440000147f, 0.902675092f},
-std::array<float,2>{0.113221593f, 0.102535263f},
-std::array<float,2>{0.604587615f, 0.994992316f},
-std::array<float,2>{0.756766975f, 0.279187053f},
-std::array<float,2>{0.309695482f, 0.677649498f},
-std::array<float,2>{0.41869694f, 0.382174194f},
-std::array<float,2>{0.901857853f, 0.509197712f},
-std::array<float,2>{0.652631462f, 0.125990048f},
-std::array<float,2>{0.125538826f, 0.775886655f},
-std::array<float,2>{0.392037868f, 0.147494972f},
-std::array<float,2>{0.931280732f, 0.761063099f},
-std::array<float,2>{0.685783982f, 0.405192226f},
-std::array<float,2>{0.175811931f, 0.515645921f},
-std::array<float,2>{0.0707366765f, 0.252595305f},
-std::array<float,2>{0.58608532f, 0.665760636f},
-std::array<float,2>{0.800742984f, 0.117339373f},
-std::array<float,2>{0.255822271f, 0.97000742f},
-std::array<float,2>{0.224410728f, 0.0490215383f},
-std::array<float,2>{0.705776036f, 0.885429382f},
-std::array<float,2>{0.96671176f, 0.318428457f},
-std::array<float,2>{0.487405092f, 0.7267313f},
-std::array<float,2>{0.334218144f, 0.466932952f},
-std::array<float,2>{0.82204181f, 0.587018251f},
-std::array<float,2>{0.558508337f, 0.193048134f},
-std::array<float,2>{0.0388212577f, 0.814916849f},
-std::array<float,2>{0.292599678f, 0.063379921f},
-std::array<float,2>{0.772234857f, 0.958203793f},
-std::array<float,2>{0.622635663f, 0.303408861f},
-std::array<float,2>{0.0967369676f, 0.636913896f},
-std::array<float,2>{0.155866385f, 0.430969894f},
-std::array<float,2>{0.638286293f, 0.549302578f},
-std::array<float,2>{0.881383181f, 0.175376192f},
-std::array<float,2>{0.423448682f, 0.790731549f},
-std::array<float,2>{0.0231106356f, 0.225411907f},
-std::array<float,2>{0.511447072f, 0.873965323f},
-std::array<float,2>{0.854015172f, 0.472170383f},
-std::array<float,2>{0.364596248f, 0.62354809f},
-std::array<float,2>{0.461625308f, 0.360364586f},
-std::array<float,2>{0.992659152f, 0.715087235f},
-std::array<float,2>{0.724344373f, 0.0158221032f},
-std::array<float,2>{0.189302415f, 0.932497799f},
-std::array<float,2>{0.433559448f, 0.113219336f},
-std::array<float,2>{0.887262821f, 0.979746461f},
-std::array<float,2>{0.631437898f, 0.259727538f},
-std::array<float,2>{0.148288041f, 0.657882869f},
-std::array<float,2>{0.104826845f, 0.393397003f},
-std::array<float,2>{0.610465288f, 0.523978114f},
-std::array<float,2>{0.775539398f, 0.150761038f},
-std::array<float,2>{0.285514623f, 0.754517853f},
-std::array<float,2>{0.198051184f, 0.202354982f},
-std::array<float,2>{0.727309704f, 0.821921766f},
-std::array<float,2>{0.984695017f, 0.457355887f},
-std::array<float,2>{0.456036538f, 0.580992281f},
-std::array<float,2>{0.371220052f, 0.322842568f},
-std::array<float,2>{0.850662112f, 0.723126709f},
-std::array<float,2>{0.505953372f, 0.0616563447f},
-std::array<float,2>{0.0254323948f, 0.88048768f},
-std::array<float,2>{0.259724438f, 0.186045513f},
-std::array<float,2>{0.805226743f, 0.78725028f},
-std::array<float,2>{0.585036814f, 0.422973067f},
-std::array<float,2>{0.0654328167f, 0.554716289f},
-std::array<float,2>{0.183325335f, 0.305626273f},
-std::array<float,2>{0.675782859f, 0.630954087f},
-std::array<float,2>{0.922192872f, 0.0779504329f},
-std::array<float,2>{0.402607262f, 0.963647068f},
-std::array<float,2>{0.0418301448f, 0.0247125104f},
-std::array<float,2>{0.549160779f, 0.928763747f},
-std::array<float,2>{0.817524314f, 0.37185958f},
-std::array<float,2>{0.343113601f, 0.710374534f},
-std::array<float,2>{0.499458045f, 0.480838031f},
-std::array<float,2>{0.957921982f, 0.614552081f},
-std::array<float,2>{0.716530085f, 0.228116617f},
-std::array<float,2>{0.22717014f, 0.865300834f},
-std::array<float,2>{0.452764034f, 0.237804309f},
-std::array<float,2>{0.977412999f, 0.847820044f},
-std::array<float,2>{0.743231118f, 0.487379551f},
-std::array<float,2>{0.214779004f, 0.602364063f},
-std::array<float,2>{0.00500940857f, 0.35909164f},
-std::array<float,2>{0.517274857f, 0.699803412f},
-std::array<float,2>{0.874566257f, 0.00804826245f},
-std::array<float,2>{0.357743025f, 0.917173982f},
-std::array<float,2>{0.133846238f, 0.0848376527f},
-std::array<float,2>{0.645933509f, 0.940189898f},
-std::array<float,2>{0.895457029f, 0.289554626f},
-std::array<float,2>{0.412990987f, 0.65434587f},
-std::array<float,2>{0.30373022f, 0.408883572f},
-std::array<float,2>{0.760435402f, 0.537857115f},
-std::array<float,2>{0.596601188f, 0.165601194f},
-std::array<float,2>{0.124287248f, 0.806696534f},
-std::array<float,2>{0.312530696f, 0.0357024446f},
-std::array<float,2>{0.8426373f, 0.895250678f},
-std::array<float,2>{0.540808439f, 0.343346894f},
-std::array<float,2>{0.0499496907f, 0.74067992f},
-std::array<float,2>{0.24928546f, 0.447387993f},
-std::array<float,2>{0.69916445f, 0.571722269f},
-std::array<float,2>{0.946254551f, 0.206773341f},
-std::array<float,2>{0.478981316f, 0.835527599f},
-std::array<float,2>{0.0870589539f, 0.133485124f},
-std::array<float,2>{0.565615594f, 0.771534026f},
-std::array<float,2>{0.785507977f, 0.383944303f},
-std::array<float,2>{0.276039302f, 0.504519284f},
-std::array<float,2>{0.375659347f, 0.267743647f},
-std::array<float,2>{0.913402498f, 0.683545113f},
-std::array<float,2>{0.661760092f, 0.0985775068f},
-std::array<float,2>{0.160704583f, 0.985102057f},
-std::array<float,2>{0.382940412f, 0.0579444915f},
-std::array<float,2>{0.916189492f, 0.878778338f},
-std::array<float,2>{0.670774043f, 0.326047093f},
-std::array<float,2>{0.169903532f, 0.720772684f},
-std::array<float,2>{0.0833199546f, 0.455880463f},
-std::array<float,2>{0.578099728f, 0.58381623f},
-std::array<float,2>{0.790622175f, 0.197526902f},
-std::array<float,2>{0.265893281f, 0.827016592f},
-std::array<float,2>{0.241584763f, 0.1531533f},
-std::array<float,2>{0.692626476f, 0.752141476f},
-std::array<float,2>{0.942715406f, 0.39536342f},
-std::array<float,2>{0.473635048f, 0.530808091f},
-std::array<float,2>{0.324543923f, 0.264037967f},
-std::array<float,2>{0.831466198f, 0.663458467f},
-std::array<float,2>{0.535684407f, 0.113981858f},
-std::array<float,2>{0.0589768179f, 0.983991027f},
-std::array<float,2>{0.308250129f, 0.231353894f},
-std::array<float,2>{0.751611054f, 0.862495184f},
-std::array<float,2>{0.609327614f, 0.477246732f},
-std::array<float,2>{0.1156011f, 0.611061037f},
-std::array<float,2>{0.131465033f, 0.370570779f},
-std::array<float,2>{0.650375128f, 0.704239845f},
-std::array<float,2>{0.902514815f, 0.029080119f},
-std::array<float,2>{0.414232373f, 0.921946228f},
-std::array<float,2>{0.0083438009f, 0.072819531f},
-std::array<float,2>{0.527249157f, 0.967417657f},
-std::array<float,2>{0.861269116f, 0.311167926f},
-std::array<float,2>{0.350190699f, 0.626009643f},
-std::array<float,2>{0.444305092f, 0.427706897f},
-std::array<float,2>{0.971022308f, 0.561457574f},
-std::array<float,2>{0.737671852f, 0.181956857f},
-std::array<float,2>{0.204981744f, 0.781638861f},
-std::array<float,2>{0.491572767f, 0.171414509f},
-std::array<float,2>{0.960986495f, 0.81142205f},
-std::array<float,2>{0.710129201f, 0.410832375f},
-std::array<float,2>{0.220564544f, 0.531403303f},
-std::array<float,2>{0.0349835195f, 0.296719402f},
-std::array<float,2>{0.561844647f, 0.65041852f},
-std::array<float,2>{0.826392651f, 0.0797293037f},
-std::array<float,2>{0.331325024f, 0.941503584f},
-std::array<float,2>{0.172295526f, 0.0134720886f},
-std::array<float,2>{0.681774318f, 0.92173475f},
-std::array<float,2>{0.934504211f, 0.352829903f},
-std::array<float,2>{0.396038651f, 0.697991669f},
-std::array<float,2>{0.250029415f, 0.489138037f},
-std::array<float,2>{0.802545607f, 0.608038545f},
-std::array<float,2>{0.590223372f, 0.241249785f},
-std::array<float,2>{0.0775942802f, 0.845968604f},
-std::array<float,2>{0.361641139f, 0.0967787728f},
-std::array<float,2>{0.857584417f, 0.990186512f},
-std::array<float,2>{0.5128901f, 0.271716863f},
-std::array<float,2>{0.016354613f, 0.687330723f},
-std::array<float,2>{0.195084885f, 0.388467997f},
-std::array<float,2>{0.720604122f, 0.501021504f},
-std::array<float,2>{0.998961329f, 0.137187019f},
-std::array<float,2>{0.465168864f, 0.767241418f},
-std::array<float,2>{0.100834921f, 0.207602873f},
-std::array<float,2>{0.620048463f, 0.828752935f},
-std::array<float,2>{0.768455267f, 0.449725211f},
-std::array<float,2>{0.295727551f, 0.575041056f},
-std::array<float,2>{0.426030397f, 0.339827925f},
-std::array<float,2>{0.877417147f, 0.738169134f},
-std::array<float,2>{0.634017289f, 0.0317623541f},
-std::array<float,2>{0.151214361f, 0.893042147f},
-std::array<float,2>{0.459442198f, 0.0883975402f},
-std::array<float,2>{0.991069913f, 0.94624722f},
-std::array<float,2>{0.73377496f, 0.283816308f},
-std::array<float,2>{0.201662093f, 0.645211995f},
-std::array<float,2>{0.0283486713f, 0.420950502f},
-std::array<float,2>{0.501176894f, 0.54463166f},
-std::array<float,2>{0.844964683f, 0.159152731f},
-std::array<float,2>{0.368959367f, 0.801341534f},
-std::array<float,2>{0.142138794f, 0.243945554f},
-std::array<float,2>{0.627248883f, 0.85356158f},
-std::array<float,2>{0.885145187f, 0.497076631f},
-std::array<float,2>{0.435831308f, 0.59414041f},
-std::array<float,2>{0.28484273f, 0.348787904f},
-std::array<float,2>{0.780346036f, 0.690143466f},
-std::array<float,2>{0.614244998f, 0.00594046386f},
-std::array<float,2>{0.106366009f, 0.913693488f},
-std::array<float,2>{0.338447988f, 0.129636288f},
-std::array<float,2>{0.814660728f, 0.779987276f},
-std::array<float,2>{0.552928329f, 0.378323913f},
-std::array<float,2>{0.0447688848f, 0.512209117f},
-std::array<float,2>{0.2320811f, 0.277016342f},
-std::array<float,2>{0.713467956f, 0.672511041f},
-std::array<float,2>{0.956538618f, 0.105894841f},
-std::array<float,2>{0.494760394f, 0.99741292f},
-std::array<float,2>{0.0691315606f, 0.0434108488f},
-std::array<float,2>{0.579527736f, 0.901561022f},
-std::array<float,2>{0.808953822f, 0.334474355f},
-std::array<float,2>{0.264093518f, 0.742913663f},
-std::array<float,2>{0.400072873f, 0.438268721f},
-std::array<float,2>{0.926663995f, 0.564867854f},
-std::array<float,2>{0.674313903f, 0.215963647f},
-std::array<float,2>{0.187049702f, 0.83927381f},
-std::array<float,2>{0.406913906f, 0.188919172f},
-std::array<float,2>{0.892573535f, 0.818056345f},
-std::array<float,2>{0.642084479f, 0.461164474f},
-std::array<float,2>{0.137793615f, 0.591324091f},
-std::array<float,2>{0.118692257f, 0.315055311f},
-std::array<float,2>{0.598385215f, 0.733971477f},
-std::array<float,2>{0.764369369f, 0.0526581407f},
-std::array<float,2>{0.298092276f, 0.887222171f},
-std::array<float,2>{0.217583761f, 0.124277271f},
-std::array<float,2>{0.749124169f, 0.974403024f},
-std::array<float,2>{0.984001398f, 0.25429526f},
-std::array<float,2>{0.445944846f, 0.669891357f},
-std::array<float,2>{0.352270007f, 0.39895162f},
-std::array<float,2>{0.870673299f, 0.520353377f},
-std::array<float,2>{0.520813763f, 0.140773386f},
-std::array<float,2>{0.00100748055f, 0.765242755f},
-std::array<float,2>{0.278215349f, 0.0230172798f},
-std::array<float,2>{0.781915247f, 0.935934782f},
-std::array<float,2>{0.56947124f, 0.364542931f},
-std::array<float,2>{0.0901552886f, 0.712597787f},
-std::array<float,2>{0.158997893f, 0.472677112f},
-std::array<float,2>{0.658570707f, 0.620759428f},
-std::array<float,2>{0.908452153f, 0.222402945f},
-std::array<float,2>{0.37958461f, 0.869128406f},
-std::array<float,2>{0.0526144467f, 0.178043947f},
-std::array<float,2>{0.544821322f, 0.795844853f},
-std::array<float,2>{0.837271214f, 0.434561014f},
-std::array<float,2>{0.319336057f, 0.554421961f},
-std::array<float,2>{0.482913166f, 0.299524546f},
-std::array<float,2>{0.952870488f, 0.633351445f},
-std::array<float,2>{0.701707721f, 0.0679359436f},
-std::array<float,2>{0.243303478f, 0.954965889f},
-std::array<float,2>{0.439270556f, 0.0423603095f},
-std::array<float,2>{0.973885238f, 0.905459464f},
-std::array<float,2>{0.742014527f, 0.328565866f},
-std::array<float,2>{0.210530087f, 0.748203099f},
-std::array<float,2>{0.0139896497f, 0.44147411f},
-std::array<float,2>{0.530609667f, 0.566483796f},
-std::array<float,2>{0.865088403f, 0.212106749f},
-std::array<float,2>{0.344044268f, 0.843093038f},
-std::array<float,2>{0.127915159f, 0.128490582f},
-std::array<float,2>{0.654958069f, 0.774069786f},
-std::array<float,2>{0.898628771f, 0.3792364f},
-std::array<float,2>{0.421075374f, 0.510939956f},
-std::array<float,2>{0.312357157f, 0.279315799f},
-std::array<float,2>{0.754507601f, 0.678369343f},
-std::array<float,2>{0.602189124f, 0.105190463f},
-std::array<float,2>{0.109802596f, 0.993030131f},
-std::array<float,2>{0.324116051f, 0.248790026f},
-std::array<float,2>{0.834111094f, 0.856399596f},
-std::array<float,2>{0.532513618f, 0.494197965f},
-std::array<float,2>{0.0547963083f, 0.597694397f},
-std::array<float,2>{0.238233685f, 0.346636772f},
-std::array<float,2>{0.689686716f, 0.694087029f},
-std::array<float,2>{0.941263556f, 0.00061406591f},
-std::array<float,2>{0.469603598f, 0.908757627f},
-std::array<float,2>{0.0801913589f, 0.0907615945f},
-std::array<float,2>{0.573913515f, 0.950044036f},
-std::array<float,2>{0.793698847f, 0.287249178f},
-std::array<float,2>{0.271340579f, 0.64423883f},
-std::array<float,2>{0.388222903f, 0.415722489f},
-std::array<float,2>{0.920489013f, 0.540667176f},
-std::array<float,2>{0.66463244f, 0.161900207f},
-std::array<float,2>{0.16760546f, 0.797754228f},
-std::array<float,2>{0.424983442f, 0.173201665f},
-std::array<float,2>{0.880521834f, 0.791447639f},
-std::array<float,2>{0.638828099f, 0.432620704f},
-std::array<float,2>{0.153485835f, 0.54717195f},
-std::array<float,2>{0.0946671963f, 0.302255601f},
-std::array<float,2>{0.62351191f, 0.639543116f},
-std::array<float,2>{0.769715309f, 0.0645108223f},
-std::array<float,2>{0.290762156f, 0.960310042f},
-std::array<float,2>{0.190722406f, 0.0183256306f},
-std::array<float,2>{0.726407886f, 0.930434465f},
-std::array<float,2>{0.995251536f, 0.363090724f},
-std::array<float,2>{0.464820176f, 0.717140138f},
-std::array<float,2>{0.367075205f, 0.47033903f},
-std::array<float,2>{0.851786375f, 0.621822059f},
-std::array<float,2>{0.509342134f, 0.224330112f},
-std::array<float,2>{0.0198725183f, 0.872797012f},
-std::array<float,2>{0.256369352f, 0.120773546f},
-std::array<float,2>{0.796928585f, 0.970956326f},
-std::array<float,2>{0.58860296f, 0.25182572f},
-std::array<float,2>{0.0733993798f, 0.666134238f},
-std::array<float,2>{0.179474309f, 0.403675288f},
-std::array<float,2>{0.683608532f, 0.518196166f},
-std::array<float,2>{0.933080316f, 0.144984141f},
-std::array<float,2>{0.393382698f, 0.758934677f},
-std::array<float,2>{0.0368726142f, 0.194721729f},
-std::array<float,2>{0.554913521f, 0.813863456f},
-std::array<float,2>{0.823982358f, 0.465776443f},
-std::array<float,2>{0.333963424f, 0.588971138f},
-std::array<float,2>{0.48557061f, 0.316444665f},
-std::array<float,2>{0.967060506f, 0.730017602f},
-std::array<float,2>{0.705075443f, 0.0471793488f},
-std::array<float,2>{0.225181252f, 0.882884443f},
-std::array<float,2>{0.404723346f, 0.0745674074f},
-std::array<float,2>{0.925084472f, 0.961154819f},
-std::array<float,2>{0.678828359f, 0.306931496f},
-std::array<float,2>{0.180752054f, 0.629201591f},
-std::array<float,2>{0.0627530441f, 0.424282849f},
-std::array<float,2>{0.58234328f, 0.557236493f},
-std::array<float,2>{0.808310568f, 0.184645593f},
-std::array<float,2>{0.260085106f, 0.786705434f},
-std::array<float,2>{0.229222879f, 0.229994401f},
-std::array<float,2>{0.717528701f, 0.863370955f},
-std::array<float,2>{0.959492385f, 0.483832717f},
-std::array<float,2>{0.496273726f, 0.616912365f},
-std::array<float,2>{0.341248721f, 0.373169869f},
-std::array<float,2>{0.819297194f, 0.707668841f},
-std::array<float,2>{0.548076034f, 0.0272826161f},
-std::array<float,2>{0.0394904763f, 0.927543283f},
-std::array<float,2>{0.287585557f, 0.14954178f},
-std::array<float,2>{0.773847699f, 0.757482708f},
-std::array<float,2>{0.612516999f, 0.392008632f},
-std::array<float,2>{0.101794019f, 0.52558279f},
-std::array<float,2>{0.144785926f, 0.261702776f},
-std::array<float,2>{0.62910372f, 0.659245431f},
-std::array<float,2>{0.888813555f, 0.109958991f},
-std::array<float,2>{0.429809839f, 0.977331579f},
-std::array<float,2>{0.0253517926f, 0.0590458885f},
-std::array<float,2>{0.504688382f, 0.882253885f},
-std::array<float,2>{0.849349082f, 0.320586681f},
-std::array<float,2>{0.373514086f, 0.725922763f},
-std::array<float,2>{0.453846425f, 0.460254282f},
-std::array<float,2>{0.986989379f, 0.578687489f},
-std::array<float,2>{0.729800642f, 0.199570969f},
-std::array<float,2>{0.19619453f, 0.822783947f},
-std::array<float,2>{0.477577835f, 0.204830229f},
-std::array<float,2>{0.948993623f, 0.832577527f},
-std::array<float,2>{0.695678651f, 0.447089255f},
-std::array<float,2>{0.24735336f, 0.572979271f},
-std::array<float,2>{0.0469393618f, 0.341079593f},
-std::array<float,2>{0.541461289f, 0.738359094f},
-std::array<float,2>{0.84104389f, 0.0382738113f},
-std::array<float,2>{0.316113919f, 0.896660149f},
-std::array<float,2>{0.16375342f, 0.0998241454f},
-std::array<float,2>{0.663006067f, 0.987556577f},
-std::array<float,2>{0.912071288f, 0.266001791f},
-std::array<float,2>{0.377230555f, 0.680104256f},
-std::array<float,2>{0.275337607f, 0.386129618f},
-std::array<float,2>{0.788791358f, 0.505929768f},
-std::array<float,2>{0.562603831f, 0.136458099f},
-std::array<float,2>{0.0882334188f, 0.77064532f},
-std::array<float,2>{0.356147796f, 0.0103982482f},
-std::array<float,2>{0.871233344f, 0.915574551f},
-std::array<float,2>{0.518344343f, 0.35596025f},
-std::array<float,2>{0.00658251299f, 0.702057481f},
-std::array<float,2>{0.212631285f, 0.484590381f},
-std::array<float,2>{0.745535314f, 0.603771508f},
-std::array<float,2>{0.980175018f, 0.235049978f},
-std::array<float,2>{0.449897259f, 0.84971112f},
-std::array<float,2>{0.12158186f, 0.167152748f},
-std::array<float,2>{0.595042884f, 0.806405663f},
-std::array<float,2>{0.759736359f, 0.408143342f},
-std::array<float,2>{0.302388608f, 0.535218418f},
-std::array<float,2>{0.411297321f, 0.292454928f},
-std::array<float,2>{0.897407889f, 0.653943777f},
-std::array<float,2>{0.647025704f, 0.0821517333f},
-std::array<float,2>{0.136612728f, 0.939362466f},
-std::array<float,2>{0.416702807f, 0.0312208179f},
-std::array<float,2>{0.906220615f, 0.924805284f},
-std::array<float,2>{0.651262879f, 0.367204517f},
-std::array<float,2>{0.129189685f, 0.705783129f},
-std::array<float,2>{0.113731742f, 0.479008853f},
-std::array<float,2>{0.606315494f, 0.613143682f},
-std::array<float,2>{0.752480447f, 0.232858449f},
-std::array<float,2>{0.306283355f, 0.860400856f},
-std::array<float,2>{0.205661833f, 0.180046052f},
-std::array<float,2>{0.73594588f, 0.783959687f},
-std::array<float,2>{0.970347226f, 0.427766085f},
-std::array<float,2>{0.442832291f, 0.560244083f},
-std::array<float,2>{0.347865999f, 0.309452057f},
-std::array<float,2>{0.861395419f, 0.627792656f},
-std::array<float,2>{0.524793804f, 0.0718971267f},
-std::array<float,2>{0.0106858024f, 0.96484679f},
-std::array<float,2>{0.269389987f, 0.19603017f},
-std::array<float,2>{0.792756736f, 0.825936675f},
-std::array<float,2>{0.574990392f, 0.453189462f},
-std::array<float,2>{0.0847026557f, 0.585014224f},
-std::array<float,2>{0.170973256f, 0.327918768f},
-std::array<float,2>{0.66888833f, 0.719914436f},
-std::array<float,2>{0.914170325f, 0.0557966232f},
-std::array<float,2>{0.384896249f, 0.875855625f},
-std::array<float,2>{0.0611457452f, 0.116385072f},
-std::array<float,2>{0.537253141f, 0.981245577f},
-std::array<float,2>{0.828732312f, 0.262568027f},
-std::array<float,2>{0.327338547f, 0.660936296f},
-std::array<float,2>{0.474676102f, 0.397451818f},
-std::array<float,2>{0.944970727f, 0.52851212f},
-std::array<float,2>{0.694470942f, 0.155969039f},
-std::array<float,2>{0.238817275f, 0.751794219f},
-std::array<float,2>{0.467860341f, 0.139658883f},
-std::array<float,2>{0.99618876f, 0.769436896f},
-std::array<float,2>{0.721072555f, 0.38959831f},
-std::array<float,2>{0.192718193f, 0.503139853f},
-std::array<float,2>{0.0193246976f, 0.271026969f},
-std::array<float,2>{0.514127314f, 0.685361922f},
-std::array<float,2>{0.85678947f, 0.0940774903f},
-std::array<float,2>{0.360806227f, 0.991297007f},
-std::array<float,2>{0.149906009f, 0.0343678035f},
-std::array<float,2>{0.636388898f, 0.891442597f},
-std::array<float,2>{0.876857281f, 0.336396217f},
-std::array<float,2>{0.4282085f, 0.735071421f},
-std::array<float,2>{0.293813229f, 0.453055054f},
-std::array<float,2>{0.766264856f, 0.577598512f},
-std::array<float,2>{0.618038535f, 0.210870773f},
-std::array<float,2>{0.0990626514f, 0.831555665f},
-std::array<float,2>{0.330076635f, 0.0803685039f},
-std::array<float,2>{0.824305773f, 0.944676816f},
-std::array<float,2>{0.559273422f, 0.293833256f},
-std::array<float,2>{0.0325232893f, 0.648518622f},
-std::array<float,2>{0.221058905f, 0.412620991f},
-std::array<float,2>{0.707505643f, 0.534798503f},
-std::array<float,2>{0.964307368f, 0.168169886f},
-std::array<float,2>{0.489514768f, 0.809602082f},
-std::array<float,2>{0.0744177327f, 0.238846332f},
-std::array<float,2>{0.593040645f, 0.844146788f},
-std::array<float,2>{0.80345124f, 0.491929829f},
-std::array<float,2>{0.252065182f, 0.606953323f},
-std::array<float,2>{0.397870302f, 0.354869336f},
-std::array<float,2>{0.935845137f, 0.695365906f},
-std::array<float,2>{0.680224717f, 0.0142150512f},
-std::array<float,2>{0.175503701f, 0.919215143f},
-std::array<float,2>{0.493190974f, 0.109092966f},
-std::array<float,2>{0.954231977f, 0.999516606f},
-std::array<float,2>{0.711694002f, 0.274813026f},
-std::array<float,2>{0.232835114f, 0.675312161f},
-std::array<float,2>{0.0466363132f, 0.376265943f},
-std::array<float,2>{0.551646709f, 0.515428722f},
-std::array<float,2>{0.813756466f, 0.130998239f},
-std::array<float,2>{0.337624341f, 0.77842617f},
-std::array<float,2>{0.184229687f, 0.216949955f},
-std::array<float,2>{0.672388971f, 0.836899817f},
-std::array<float,2>{0.929030836f, 0.441287041f},
-std::array<float,2>{0.401013285f, 0.563527405f},
-std::array<float,2>{0.262870848f, 0.332175881f},
-std::array<float,2>{0.811471939f, 0.744738758f},
-std::array<float,2>{0.581108153f, 0.0462982319f},
-std::array<float,2>{0.0680982023f, 0.900215805f},
-std::array<float,2>{0.370970041f, 0.158039585f},
-std::array<float,2>{0.847482383f, 0.804658234f},
-std::array<float,2>{0.502888262f, 0.418717384f},
-std::array<float,2>{0.0295053869f, 0.545736313f},
-std::array<float,2>{0.200670898f, 0.281287909f},
-std::array<float,2>{0.731281161f, 0.648353636f},
-std::array<float,2>{0.989673257f, 0.0865437984f},
-std::array<float,2>{0.458474278f, 0.949096441f},
-std::array<float,2>{0.108173482f, 0.0044436208f},
-std::array<float,2>{0.61589992f, 0.911701977f},
-std::array<float,2>{0.777972877f, 0.350016326f},
-std::array<float,2>{0.282762498f, 0.688168526f},
-std::array<float,2>{0.435357422f, 0.499036133f},
-std::array<float,2>{0.884700239f, 0.59671396f},
-std::array<float,2>{0.626455903f, 0.245141834f},
-std::array<float,2>{0.143553346f, 0.853322506f},
-std::array<float,2>{0.38116321f, 0.219354659f},
-std::array<float,2>{0.906327903f, 0.869954288f},
-std::array<float,2>{0.658124745f, 0.476029664f},
-std::array<float,2>{0.157421798f, 0.617562652f},
-std::array<float,2>{0.0927215815f, 0.365462273f},
-std::array<float,2>{0.566856563f, 0.713271737f},
-std::array<float,2>{0.784204543f, 0.0202506408f},
-std::array<float,2>{0.280292183f, 0.934111655f},
-std::array<float,2>{0.244441465f, 0.0686540008f},
-std::array<float,2>{0.70031172f, 0.955979347f},
-std::array<float,2>{0.949967206f, 0.297028005f},
-std::array<float,2>{0.481540054f, 0.635455132f},
-std::array<float,2>{0.316996396f, 0.435581028f},
-std::array<float,2>{0.838032186f, 0.550829411f},
-std::array<float,2>{0.546418369f, 0.17607297f},
-std::array<float,2>{0.0539363511f, 0.793194294f},
-std::array<float,2>{0.299277425f, 0.054291226f},
-std::array<float,2>{0.761890292f, 0.889959753f},
-std::array<float,2>{0.599699616f, 0.312849641f},
-std::array<float,2>{0.12002366f, 0.732298493f},
-std::array<float,2>{0.139980331f, 0.463832796f},
-std::array<float,2>{0.642964184f, 0.593598723f},
-std::array<float,2>{0.894196033f, 0.190241978f},
-std::array<float,2>{0.408977091f, 0.81872052f},
-std::array<float,2>{0.00352925691f, 0.144086182f},
-std::array<float,2>{0.522638083f, 0.76212889f},
-std::array<float,2>{0.868331015f, 0.401169151f},
-std::array<float,2>{0.354300141f, 0.523311794f},
-std::array<float,2>{0.448173225f, 0.257060021f},
-std::array<float,2>{0.981533587f, 0.670789123f},
-std::array<float,2>{0.746952474f, 0.122347184f},
-std::array<float,2>{0.216027856f, 0.975840747f},
-std::array<float,2>{0.449639171f, 0.00870963745f},
-std::array<float,2>{0.979637861f, 0.917797565f},
-std::array<float,2>{0.745930552f, 0.358516842f},
-std::array<float,2>{0.212345362f, 0.699374974f},
-std::array<float,2>{0.00612702314f, 0.488014877f},
-std::array<float,2>{0.517758012f, 0.60186559f},
-std::array<float,2>{0.871587336f, 0.237714618f},
-std::array<float,2>{0.355787992f, 0.848324418f},
-std::array<float,2>{0.135802016f, 0.165042177f},
-std::array<float,2>{0.646765232f, 0.807369053f},
-std::array<float,2>{0.896513462f, 0.408619732f},
-std::array<float,2>{0.411644965f, 0.537413716f},
-std::array<float,2>{0.301814616f, 0.289383501f},
-std::array<float,2>{0.758904457f, 0.654935658f},
-std::array<float,2>{0.595539987f, 0.0842832774f},
-std::array<float,2>{0.1218995f, 0.939670622f},
-std::array<float,2>{0.315516889f, 0.206324607f},
-std::array<float,2>{0.841470301f, 0.83509028f},
-std::array<float,2>{0.541556716f, 0.448173702f},
-std::array<float,2>{0.0473839752f, 0.572260976f},
-std::array<float,2>{0.247841313f, 0.34307602f},
-std::array<float,2>{0.695881784f, 0.740795135f},
-std::array<float,2>{0.948378921f, 0.0351788811f},
-std::array<float,2>{0.478185833f, 0.89483887f},
-std::array<float,2>{0.0888051987f, 0.0978169739f},
-std::array<float,2>{0.56316334f, 0.984573126f},
-std::array<float,2>{0.788416386f, 0.268131763f},
-std::array<float,2>{0.274576515f, 0.682889223f},
-std::array<float,2>{0.377576023f, 0.384602547f},
-std::array<float,2>{0.911497653f, 0.504039407f},
-std::array<float,2>{0.662115216f, 0.132830918f},
-std::array<float,2>{0.163392931f, 0.771984875f},
-std::array<float,2>{0.430480182f, 0.150912389f},
-std::array<float,2>{0.889432967f, 0.754294872f},
-std::array<float,2>{0.629671395f, 0.392780066f},
-std::array<float,2>{0.145099387f, 0.523724735f},
-std::array<float,2>{0.102538757f, 0.259051174f},
-std::array<float,2>{0.613234401f, 0.65769881f},
-std::array<float,2>{0.774365664f, 0.112733997f},
-std::array<float,2>{0.287864983f, 0.980362952f},
-std::array<float,2>{0.195784718f, 0.0621794164f},
-std::array<float,2>{0.730190873f, 0.879995763f},
-std::array<float,2>{0.986524105f, 0.32273522f},
-std::array<float,2>{0.453524321f, 0.723317385f},
-std::array<float,2>{0.373897552f, 0.457875758f},
-std::array<float,2>{0.848844409f, 0.580146909f},
-std::array<float,2>{0.504129052f, 0.202668384f},
-std::array<float,2>{0.0244559143f, 0.821715057f},
-std::array<float,2>{0.260332406f, 0.0776013359f},
-std::array<float,2>{0.807731867f, 0.963239074f},
-std::array<float,2>{0.582627714f, 0.305148661f},
-std::array<float,2>{0.0632768869f, 0.631828547f},
-std::array<float,2>{0.181325376f, 0.42341727f},
-std::array<float,2>{0.679396212f, 0.555623472f},
-std::array<float,2>{0.925321758f, 0.18589966f},
-std::array<float,2>{0.405140519f, 0.787832081f},
-std::array<float,2>{0.0397151299f, 0.227731317f},
-std::array<float,2>{0.54880172f, 0.865965366f},
-std::array<float,2>{0.818689942f, 0.481173724f},
-std::array<float,2>{0.341478109f, 0.614819169f},
-std::array<float,2>{0.496898621f, 0.371113956f},
-std::array<float,2>{0.959397197f, 0.710845947f},
-std::array<float,2>{0.716982126f, 0.0249419529f},
-std::array<float,2>{0.228712231f, 0.929416656f},
-std::array<float,2>{0.393004268f, 0.117855683f},
-std::array<float,2>{0.933371544f, 0.970297635f},
-std::array<float,2>{0.684301138f, 0.252029181f},
-std::array<float,2>{0.178886011f, 0.665345371f},
-std::array<float,2>{0.0738599375f, 0.404512823f},
-std::array<float,2>{0.587961495f, 0.516256511f},
-std::array<float,2>{0.79760474f, 0.148364156f},
-std::array<float,2>{0.256196469f, 0.761714935f},
-std::array<float,2>{0.224645048f, 0.19275476f},
-std::array<float,2>{0.704222798f, 0.815009058f},
-std::array<float,2>{0.967648029f, 0.467604637f},
-std::array<float,2>{0.48631838f, 0.587561071f},
-std::array<float,2>{0.333426833f, 0.319175065f},
-std::array<float,2>{0.823615611f, 0.727167308f},
-std::array<float,2>{0.555362225f, 0.0493801124f},
-std::array<float,2>{0.036179807f, 0.884949446f},
-std::array<float,2>{0.29007858f, 0.175230294f},
-std::array<float,2>{0.7704041f, 0.79013288f},
-std::array<float,2>{0.623613358f, 0.431245834f},
-std::array<float,2>{0.093929708f, 0.549521863f},
-std::array<float,2>{0.154269502f, 0.303197354f},
-std::array<float,2>{0.639512956f, 0.637628853f},
-std::array<float,2>{0.879888952f, 0.0629420131f},
-std::array<float,2>{0.425398827f, 0.958644688f},
-std::array<float,2>{0.0202603191f, 0.0163833424f},
-std::array<float,2>{0.509245157f, 0.931704104f},
-std::array<float,2>{0.852084398f, 0.361167848f},
-std::array<float,2>{0.366426587f, 0.715626299f},
-std::array<float,2>{0.46426782f, 0.472081661f},
-std::array<float,2>{0.99584502f, 0.623125017f},
-std::array<float,2>{0.726056576f, 0.22501348f},
-std::array<float,2>{0.191087767f, 0.873313785f},
-std::array<float,2>{0.468962997f, 0.246264264f},
-std::array<float,2>{0.940656543f, 0.857729673f},
-std::array<float,2>{0.690034628f, 0.49361074f},
-std::array<float,2>{0.237574816f, 0.600193202f},
-std::array<float,2>{0.0552890934f, 0.344195515f},
-std::array<float,2>{0.533116162f, 0.692031085f},
-std::array<float,2>{0.834714472f, 0.00203676894f},
-std::array<float,2>{0.32331565f, 0.906967044f},
-std::array<float,2>{0.167136326f, 0.092245616f},
-std::array<float,2>{0.664417267f, 0.95147568f},
-std::array<float,2>{0.919948101f, 0.285942823f},
-std::array<float,2>{0.38812542f, 0.641700268f},
-std::array<float,2>{0.270816833f, 0.416595608f},
-std::array<float,2>{0.793325067f, 0.542662203f},
-std::array<float,2>{0.573243558f, 0.163306832f},
-std::array<float,2>{0.0809023306f, 0.799636841f},
-std::array<float,2>{0.34437561f, 0.0401422903f},
-std::array<float,2>{0.864672065f, 0.903318405f},
-std::array<float,2>{0.530948997f, 0.331611186f},
-std::array<float,2>{0.0145931616f, 0.746423841f},
-std::array<float,2>{0.210042834f, 0.444706082f},
-std::array<float,2>{0.741458654f, 0.57017976f},
-std::array<float,2>{0.974550426f, 0.213043183f},
-std::array<float,2>{0.438844383f, 0.840868235f},
-std::array<float,2>{0.110184312f, 0.12682192f},
-std::array<float,2>{0.601925313f, 0.775605679f},
-std::array<float,2>{0.754042029f, 0.382579505f},
-std::array<float,2>{0.311745584f, 0.509557784f},
-std::array<float,2>{0.421539009f, 0.278467894f},
-std::array<float,2>{0.899113417f, 0.676802993f},
-std::array<float,2>{0.654582798f, 0.101680964f},
-std::array<float,2>{0.126983166f, 0.994609654f},
-std::array<float,2>{0.408381432f, 0.0519750677f},
-std::array<float,2>{0.893622875f, 0.887149811f},
-std::array<float,2>{0.643370748f, 0.314485133f},
-std::array<float,2>{0.140240565f, 0.733555198f},
-std::array<float,2>{0.119298652f, 0.461534381f},
-std::array<float,2>{0.60046643f, 0.590927541f},
-std::array<float,2>{0.762418509f, 0.18941015f},
-std::array<float,2>{0.299380183f, 0.817827642f},
-std::array<float,2>{0.216771573f, 0.141114563f},
-std::array<float,2>{0.746337414f, 0.765052497f},
-std::array<float,2>{0.982016504f, 0.398815155f},
-std::array<float,2>{0.447641641f, 0.519594848f},
-std::array<float,2>{0.353839666f, 0.25474593f},
-std::array<float,2>{0.869115055f, 0.66926986f},
-std::array<float,2>{0.523420751f, 0.12475726f},
-std::array<float,2>{0.00324666477f, 0.973899364f},
-std::array<float,2>{0.281143665f, 0.221962094f},
-std::array<float,2>{0.784945846f, 0.868291378f},
-std::array<float,2>{0.567208707f, 0.473316938f},
-std::array<float,2>{0.0920713767f, 0.620598912f},
-std::array<float,2>{0.157861233f, 0.36474672f},
-std::array<float,2>{0.657635272f, 0.712245286f},
-std::array<float,2>{0.907094181f, 0.0227459799f},
-std::array<float,2>{0.381702781f, 0.936217606f},
-std::array<float,2>{0.0544757433f, 0.067572616f},
-std::array<float,2>{0.545899808f, 0.954341233f},
-std::array<float,2>{0.838861942f, 0.299282253f},
-std::array<float,2>{0.316846341f, 0.63309586f},
-std::array<float,2>{0.482372791f, 0.433942676f},
-std::array<float,2>{0.949400127f, 0.553972065f},
-std::array<float,2>{0.700754404f, 0.178238273f},
-std::array<float,2>{0.244674131f, 0.794998705f},
-std::array<float,2>{0.458593428f, 0.158622801f},
-std::array<float,2>{0.990081787f, 0.800889671f},
-std::array<float,2>{0.730692387f, 0.421457052f},
-std::array<float,2>{0.200987875f, 0.544213355f},
-std::array<float,2>{0.029793676f, 0.283578187f},
-std::array<float,2>{0.502364457f, 0.644923449f},
-std::array<float,2>{0.847058117f, 0.0883547366f},
-std::array<float,2>{0.370383173f, 0.945657134f},
-std::array<float,2>{0.142888427f, 0.0066463612f},
-std::array<float,2>{0.626467049f, 0.913367093f},
-std::array<float,2>{0.884127736f, 0.349289f},
-std::array<float,2>{0.434900194f, 0.689796686f},
-std::array<float,2>{0.282235026f, 0.497872353f},
-std::array<float,2>{0.777589917f, 0.594510436f},
-std::array<float,2>{0.615298331f, 0.243567437f},
-std::array<float,2>{0.107627138f, 0.854023516f},
-std::array<float,2>{0.337255836f, 0.106430195f},
-std::array<float,2>{0.814231515f, 0.997598827f},
-std::array<float,2>{0.551009595f, 0.27637884f},
-std::array<float,2>{0.046126157f, 0.672159433f},
-std::array<float,2>{0.232936725f, 0.378690898f},
-std::array<float,2>{0.711035967f, 0.511893511f},
-std::array<float,2>{0.954681396f, 0.12895824f},
-std::array<float,2>{0.493790805f, 0.779673576f},
-std::array<float,2>{0.0675317869f, 0.216769218f},
-std::array<float,2>{0.581838369f, 0.83945924f},
-std::array<float,2>{0.810636222f, 0.43793264f},
-std::array<float,2>{0.263623595f, 0.564959824f},
-std::array<float,2>{0.400710166f, 0.334410757f},
-std::array<float,2>{0.92955935f, 0.742426336f},
-std::array<float,2>{0.671961427f, 0.0434853323f},
-std::array<float,2>{0.183788821f, 0.902338147f},
-std::array<float,2>{0.48975265f, 0.0791937783f},
-std::array<float,2>{0.964829624f, 0.94232291f},
-std::array<float,2>{0.707962811f, 0.296054065f},
-std::array<float,2>{0.221661523f, 0.651118517f},
-std::array<float,2>{0.0330993831f, 0.410359651f},
-std::array<float,2>{0.558953762f, 0.532100141f},
-std::array<float,2>{0.825074077f, 0.171372533f},
-std::array<float,2>{0.329160422f, 0.810581863f},
-std::array<float,2>{0.174923629f, 0.241905823f},
-std::array<float,2>{0.679962993f, 0.84661746f},
-std::array<float,2>{0.936474741f, 0.488763273f},
-std::array<float,2>{0.39798522f, 0.607509613f},
-std::array<float,2>{0.252858073f, 0.353165895f},
-std::array<float,2>{0.802865982f, 0.697731793f},
-std::array<float,2>{0.593646467f, 0.0131401485f},
-std::array<float,2>{0.0751354173f, 0.92106843f},
-std::array<float,2>{0.361155689f, 0.13759023f},
-std::array<float,2>{0.85726428f, 0.766650617f},
-std::array<float,2>{0.514517963f, 0.38793537f},
-std::array<float,2>{0.0189914163f, 0.501939118f},
-std::array<float,2>{0.192984939f, 0.272243708f},
-std::array<float,2>{0.721656501f, 0.687007725f},
-std::array<float,2>{0.996682763f, 0.097630024f},
-std::array<float,2>{0.468707353f, 0.989545226f},
-std::array<float,2>{0.0994323492f, 0.0314238779f},
-std::array<float,2>{0.617208779f, 0.893502355f},
-std::array<float,2>{0.765990615f, 0.339161783f},
-std::array<float,2>{0.29338634f, 0.737310767f},
-std::array<float,2>{0.428397834f, 0.449257135f},
-std::array<float,2>{0.876122355f, 0.57462424f},
-std::array<float,2>{0.635936141f, 0.207414985f},
-std::array<float,2>{0.149653569f, 0.828459799f},
-std::array<float,2>{0.385403335f, 0.197760895f},
-std::array<float,2>{0.914902568f, 0.826323867f},
-std::array<float,2>{0.668043137f, 0.455302209f},
-std::array<float,2>{0.171568379f, 0.583072484f},
-std::array<float,2>{0.0841432586f, 0.325286597f},
-std::array<float,2>{0.574589849f, 0.721671283f},
-std::array<float,2>{0.792142451f, 0.0585226156f},
-std::array<float,2>{0.268967867f, 0.878145278f},
-std::array<float,2>{0.238735825f, 0.113501839f},
-std::array<float,2>{0.69508034f, 0.983464062f},
-std::array<float,2>{0.944720924f, 0.264578342f},
-std::array<float,2>{0.475111514f, 0.663732529f},
-std::array<float,2>{0.3281205f, 0.394779623f},
-std::array<float,2>{0.828460455f, 0.530693352f},
-std::array<float,2>{0.537741601f, 0.152430907f},
-std::array<float,2>{0.0607544892f, 0.752653837f},
-std::array<float,2>{0.305859089f, 0.028459169f},
-std::array<float,2>{0.75206238f, 0.922477722f},
-std::array<float,2>{0.605905771f, 0.370970756f},
-std::array<float,2>{0.113776937f, 0.704888225f},
-std::array<float,2>{0.129777566f, 0.4766514f},
-std::array<float,2>{0.650562704f, 0.610415757f},
-std::array<float,2>{0.905531704f, 0.230563983f},
-std::array<float,2>{0.416162729f, 0.862824738f},
-std::array<float,2>{0.00993837696f, 0.182172701f},
-std::array<float,2>{0.525216222f, 0.782063425f},
-std::array<float,2>{0.862007678f, 0.427035719f},
-std::array<float,2>{0.348203868f, 0.560727715f},
-std::array<float,2>{0.442991763f, 0.310768157f},
-std::array<float,2>{0.969877005f, 0.626469433f},
-std::array<float,2>{0.735813737f, 0.0726983622f},
-std::array<float,2>{0.205308706f, 0.966849864f},
-std::array<float,2>{0.479378849f, 0.0386761501f},
-std::array<float,2>{0.945373595f, 0.897263467f},
-std::array<float,2>{0.69827497f, 0.341313839f},
-std::array<float,2>{0.249970376f, 0.739086628f},
-std::array<float,2>{0.0503343083f, 0.446351469f},
-std::array<float,2>{0.54009515f, 0.572674453f},
-std::array<float,2>{0.842195868f, 0.204313561f},
-std::array<float,2>{0.313032061f, 0.8325032f},
-std::array<float,2>{0.160210401f, 0.136025921f},
-std::array<float,2>{0.66118896f, 0.771000326f},
-std::array<float,2>{0.913737416f, 0.386356413f},
-std::array<float,2>{0.375456065f, 0.506719947f},
-std::array<float,2>{0.27577132f, 0.266262829f},
-std::array<float,2>{0.78610462f, 0.680177808f},
-std::array<float,2>{0.566292942f, 0.100461416f},
-std::array<float,2>{0.0876839459f, 0.988264382f},
-std::array<float,2>{0.358188629f, 0.234600976f},
-std::array<float,2>{0.874277353f, 0.850169301f},
-std::array<float,2>{0.51666081f, 0.484927982f},
-std::array<float,2>{0.00551039632f, 0.604145169f},
-std::array<float,2>{0.214105219f, 0.35572356f},
-std::array<float,2>{0.743679881f, 0.701343179f},
-std::array<float,2>{0.976991653f, 0.010118749f},
-std::array<float,2>{0.452257186f, 0.915429056f},
-std::array<float,2>{0.124564908f, 0.0826394856f},
-std::array<float,2>{0.596121907f, 0.938846946f},
-std::array<float,2>{0.759778261f, 0.292781293f},
-std::array<float,2>{0.304402888f, 0.653662324f},
-std::array<float,2>{0.412139654f, 0.407697946f},
-std::array<float,2>{0.894666672f, 0.535790324f},
-std::array<float,2>{0.646161437f, 0.167519987f},
-std::array<float,2>{0.134389624f, 0.806087375f},
-std::array<float,2>{0.40314588f, 0.185324848f},
-std::array<float,2>{0.92253536f, 0.786245823f},
-std::array<float,2>{0.67674607f, 0.424756259f},
-std::array<float,2>{0.18281208f, 0.556870461f},
-std::array<float,2>{0.066088751f, 0.307585597f},
-std::array<float,2>{0.58565408f, 0.629825294f},
-std::array<float,2>{0.805092752f, 0.0748822317f},
-std::array<float,2>{0.259197414f, 0.96159482f},
-std::array<float,2>{0.22660175f, 0.0265730433f},
-std::array<float,2>{0.716081083f, 0.927197337f},
-std::array<float,2>{0.957126915f, 0.373966396f},
-std::array<float,2>{0.499795914f, 0.707285523f},
-std::array<float,2>{0.343276739f, 0.484351277f},
-std::array<float,2>{0.818160772f, 0.616414905f},
-std::array<float,2>{0.549703777f, 0.229812935f},
-std::array<float,2>{0.0413665473f, 0.863856912f},
-std::array<float,2>{0.285900027f, 0.109769024f},
-std::array<float,2>{0.776309729f, 0.976631045f},
-std::array<float,2>{0.611167312f, 0.260746539f},
-std::array<float,2>{0.105005451f, 0.659715474f},
-std::array<float,2>{0.147572443f, 0.392534167f},
-std::array<float,2>{0.631223202f, 0.526321709f},
-std::array<float,2>{0.886749387f, 0.150350437f},
-std::array<float,2>{0.433054864f, 0.757138371f},
-std::array<float,2>{0.0261067394f, 0.199709296f},
-std::array<float,2>{0.506472707f, 0.822428286f},
-std::array<float,2>{0.851190448f, 0.460493296f},
-std::array<float,2>{0.371861964f, 0.578346193f},
-std::array<float,2>{0.455243886f, 0.320928514f},
-std::array<float,2>{0.985283792f, 0.726340652f},
-std::array<float,2>{0.726897418f, 0.0595166832f},
-std::array<float,2>{0.197427601f, 0.882809639f},
-std::array<float,2>{0.422922879f, 0.0652980953f},
-std::array<float,2>{0.880910695f, 0.960756481f},
-std::array<float,2>{0.637944579f, 0.302054405f},
-std::array<float,2>{0.155560434f, 0.638918519f},
-std::array<float,2>{0.0972013324f, 0.433222264f},
-std::array<float,2>{0.622398496f, 0.547728121f},
-std::array<float,2>{0.771762311f, 0.173535824f},
-std::array<float,2>{0.292362899f, 0.791614413f},
-std::array<float,2>{0.188559562f, 0.223778591f},
-std::array<float,2>{0.724098623f, 0.872292101f},
-std::array<float,2>{0.992735922f, 0.470039159f},
-std::array<float,2>{0.460970908f, 0.621355891f},
-std::array<float,2>{0.364749849f, 0.362705052f},
-std::array<float,2>{0.853901625f, 0.717463672f},
-std::array<float,2>{0.511029541f, 0.0178689826f},
-std::array<float,2>{0.022669293f, 0.929852366f},
-std::array<float,2>{0.255219281f, 0.145072237f},
-std::array<float,2>{0.799985349f, 0.759533882f},
-std::array<float,2>{0.586463571f, 0.404130191f},
-std::array<float,2>{0.0709249005f, 0.517926335f},
-std::array<float,2>{0.176684037f, 0.251206696f},
-std::array<float,2>{0.686182976f, 0.666933835f},
-std::array<float,2>{0.931076348f, 0.120225027f},
-std::array<float,2>{0.392418802f, 0.971296489f},
-std::array<float,2>{0.0381404273f, 0.047720015f},
-std::array<float,2>{0.558064938f, 0.883525133f},
-std::array<float,2>{0.8215487f, 0.317285359f},
-std::array<float,2>{0.334906727f, 0.729726434f},
-std::array<float,2>{0.488182068f, 0.464851469f},
-std::array<float,2>{0.966042519f, 0.589366496f},
-std::array<float,2>{0.705368221f, 0.195235819f},
-std::array<float,2>{0.223769754f, 0.814317107f},
-std::array<float,2>{0.439927042f, 0.212738901f},
-std::array<float,2>{0.975499332f, 0.843274653f},
-std::array<float,2>{0.739387035f, 0.442251742f},
-std::array<float,2>{0.207055852f, 0.567125022f},
-std::array<float,2>{0.0130335595f, 0.3287462f},
-std::array<float,2>{0.528503299f, 0.748587787f},
-std::array<float,2>{0.866790175f, 0.0428397581f},
-std::array<float,2>{0.347605795f, 0.906165838f},
-std::array<float,2>{0.125289187f, 0.104964718f},
-std::array<float,2>{0.652918637f, 0.992495298f},
-std::array<float,2>{0.901486218f, 0.280040324f},
-std::array<float,2>{0.417980731f, 0.677997172f},
-std::array<float,2>{0.310420245f, 0.379419625f},
-std::array<float,2>{0.756250143f, 0.511355162f},
-std::array<float,2>{0.605091631f, 0.127937719f},
-std::array<float,2>{0.112486139f, 0.773616791f},
-std::array<float,2>{0.321877122f, 0.000120492856f},
-std::array<float,2>{0.832725286f, 0.908461213f},
-std::array<float,2>{0.534612119f, 0.345716327f},
-std::array<float,2>{0.0577427335f, 0.693550527f},
-std::array<float,2>{0.235663921f, 0.494924039f},
-std::array<float,2>{0.688476741f, 0.59859103f},
-std::array<float,2>{0.939089775f, 0.248133183f},
-std::array<float,2>{0.472138017f, 0.855700195f},
-std::array<float,2>{0.0785958618f, 0.161440969f},
-std::array<float,2>{0.571361661f, 0.797062814f},
-std::array<float,2>{0.795044959f, 0.415243477f},
-std::array<float,2>{0.271905869f, 0.540257096f},
-std::array<float,2>{0.389567554f, 0.287931085f},
-std::array<float,2>{0.918226302f, 0.643729031f},
-std::array<float,2>{0.666825056f, 0.0899950862f},
-std::array<float,2>{0.164478272f, 0.949464858f},
-std::array<float,2>{0.379100978f, 0.0197862741f},
-std::array<float,2>{0.908970475f, 0.933926344f},
-std::array<float,2>{0.65899837f, 0.365998745f},
-std::array<float,2>{0.158226073f, 0.713737071f},
-std::array<float,2>{0.090509586f, 0.476176441f},
-std::array<float,2>{0.570041478f, 0.617964685f},
-std::array<float,2>{0.781340778f, 0.219153419f},
-std::array<float,2>{0.277598172f, 0.869320869f},
-std::array<float,2>{0.243684292f, 0.176382452f},
-std::array<float,2>{0.701179802f, 0.793683112f},
-std::array<float,2>{0.952286541f, 0.436374694f},
-std::array<float,2>{0.48247841f, 0.55135268f},
-std::array<float,2>{0.320047885f, 0.297793239f},
-std::array<float,2>{0.837550819f, 0.634962082f},
-std::array<float,2>{0.544344246f, 0.0690491572f},
-std::array<float,2>{0.052178897f, 0.955216885f},
-std::array<float,2>{0.29868865f, 0.189908355f},
-std::array<float,2>{0.763856292f, 0.81932354f},
-std::array<float,2>{0.598053932f, 0.463320225f},
-std::array<float,2>{0.118509077f, 0.593098283f},
-std::array<float,2>{0.138479233f, 0.313374132f},
-std::array<float,2>{0.642335415f, 0.731693864f},
-std::array<float,2>{0.891668379f, 0.0537606478f},
-std::array<float,2>{0.406654567f, 0.890188813f},
-std::array<float,2>{0.00156917784f, 0.122639835f},
-std::array<float,2>{0.521210074f, 0.976197243f},
-std::array<float,2>{0.870432377f, 0.257443726f},
-std::array<float,2>{0.351648301f, 0.67013371f},
-std::array<float,2>{0.445422173f, 0.400572002f},
-std::array<float,2>{0.983472109f, 0.522750497f},
-std::array<float,2>{0.749788761f, 0.143927991f},
-std::array<float,2>{0.216816723f, 0.762299716f},
-std::array<float,2>{0.494307101f, 0.131788805f},
-std::array<float,2>{0.956801534f, 0.779144108f},
-std::array<float,2>{0.713273287f, 0.376842499f},
-std::array<float,2>{0.23160477f, 0.514954567f},
-std::array<float,2>{0.0444115959f, 0.275098801f},
-std::array<float,2>{0.553697884f, 0.675164998f},
-std::array<float,2>{0.81525594f, 0.108593263f},
-std::array<float,2>{0.338184506f, 0.999396026f},
-std::array<float,2>{0.18668206f, 0.0467256904f},
-std::array<float,2>{0.674376488f, 0.899538755f},
-std::array<float,2>{0.925869405f, 0.332643181f},
-std::array<float,2>{0.399613678f, 0.744367778f},
-std::array<float,2>{0.264346749f, 0.440601289f},
-std::array<float,2>{0.809293926f, 0.564210117f},
-std::array<float,2>{0.579670548f, 0.217719749f},
-std::array<float,2>{0.0684144273f, 0.836086512f},
-std::array<float,2>{0.368533105f, 0.0861989409f},
-std::array<float,2>{0.845605791f, 0.948505223f},
-std::array<float,2>{0.501528621f, 0.281985909f},
-std::array<float,2>{0.0292702354f, 0.647944152f},
-std::array<float,2>{0.20153898f, 0.418126225f},
-std::array<float,2>{0.734023213f, 0.545029104f},
-std::array<float,2>{0.990582943f, 0.157637373f},
-std::array<float,2>{0.459647804f, 0.804055572f},
-std::array<float,2>{0.105865039f, 0.245713517f},
-std::array<float,2>{0.613677502f, 0.852615952f},
-std::array<float,2>{0.780855536f, 0.499851078f},
-std::array<float,2>{0.284196913f, 0.597169042f},
-std::array<float,2>{0.436481565f, 0.350563616f},
-std::array<float,2>{0.885556936f, 0.687945366f},
-std::array<float,2>{0.62770927f, 0.00404559216f},
-std::array<float,2>{0.141661674f, 0.911334336f},
-std::array<float,2>{0.465417951f, 0.094721891f},
-std::array<float,2>{0.99808979f, 0.99186945f},
-std::array<float,2>{0.71983254f, 0.270639002f},
-std::array<float,2>{0.194532067f, 0.684582412f},
-std::array<float,2>{0.0159932394f, 0.388978004f},
-std::array<float,2>{0.513237298f, 0.503682673f},
-std::array<float,2>{0.858357847f, 0.140478522f},
-std::array<float,2>{0.361871004f, 0.768574357f},
-std::array<float,2>{0.150550604f, 0.210069612f},
-std::array<float,2>{0.634369016f, 0.831304073f},
-std::array<float,2>{0.877889335f, 0.452213824f},
-std::array<float,2>{0.426470101f, 0.577962279f},
-std::array<float,2>{0.295102686f, 0.336766154f},
-std::array<float,2>{0.767956913f, 0.734510958f},
-std::array<float,2>{0.619614184f, 0.0349005014f},
-std::array<float,2>{0.1013887f, 0.891047537f},
-std::array<float,2>{0.331638664f, 0.168458849f},
-std::array<float,2>{0.826720476f, 0.810139656f},
-std::array<float,2>{0.562133253f, 0.412536412f},
-std::array<float,2>{0.034638837f, 0.534446537f},
-std::array<float,2>{0.220205739f, 0.293070734f},
-std::array<float,2>{0.710759699f, 0.649327517f},
-std::array<float,2>{0.961471021f, 0.081014283f},
-std::array<float,2>{0.492003947f, 0.94486922f},
-std::array<float,2>{0.077942349f, 0.0141469436f},
-std::array<float,2>{0.590627611f, 0.919878066f},
-std::array<float,2>{0.802013576f, 0.355252415f},
-std::array<float,2>{0.250942886f, 0.696207404f},
-std::array<float,2>{0.395931453f, 0.49151808f},
-std::array<float,2>{0.933744133f, 0.606660783f},
-std::array<float,2>{0.682432234f, 0.238347545f},
-std::array<float,2>{0.172465935f, 0.844605803f},
-std::array<float,2>{0.414717197f, 0.232960597f},
-std::array<float,2>{0.90313983f, 0.860846877f},
-std::array<float,2>{0.649652123f, 0.478644937f},
-std::array<float,2>{0.131178692f, 0.612535894f},
-std::array<float,2>{0.115884498f, 0.36772716f},
-std::array<float,2>{0.608857334f, 0.705559015f},
-std::array<float,2>{0.75101918f, 0.0303688329f},
-std::array<float,2>{0.308102489f, 0.925640881f},
-std::array<float,2>{0.204267696f, 0.0717381462f},
-std::array<float,2>{0.738065064f, 0.965616703f},
-std::array<float,2>{0.971348047f, 0.308661222f},
-std::array<float,2>{0.443731427f, 0.627030671f},
-std::array<float,2>{0.350095421f, 0.428495109f},
-std::array<float,2>{0.860389411f, 0.560050011f},
-std::array<float,2>{0.526694477f, 0.180445492f},
-std::array<float,2>{0.00826662499f, 0.78336525f},
-std::array<float,2>{0.266177386f, 0.0563232601f},
-std::array<float,2>{0.790432811f, 0.875408053f},
-std::array<float,2>{0.577515721f, 0.327418506f},
-std::array<float,2>{0.0835879594f, 0.720472336f},
-std::array<float,2>{0.169358686f, 0.45394519f},
-std::array<float,2>{0.670261443f, 0.585833788f},
-std::array<float,2>{0.916679323f, 0.195479929f},
-std::array<float,2>{0.383730263f, 0.825581193f},
-std::array<float,2>{0.0593853407f, 0.155524582f},
-std::array<float,2>{0.535623372f, 0.751181126f},
-std::array<float,2>{0.831864774f, 0.396918088f},
-std::array<float,2>{0.325067103f, 0.529138982f},
-std::array<float,2>{0.474521369f, 0.261955142f},
-std::array<float,2>{0.9429335f, 0.660184264f},
-std::array<float,2>{0.693331122f, 0.117122322f},
-std::array<float,2>{0.241866007f, 0.980897188f},
-std::array<float,2>{0.498641074f, 0.0238835607f},
-std::array<float,2>{0.958125114f, 0.928203642f},
-std::array<float,2>{0.715091169f, 0.372833788f},
-std::array<float,2>{0.227806106f, 0.709278047f},
-std::array<float,2>{0.0420034118f, 0.482315868f},
-std::array<float,2>{0.550449252f, 0.613758981f},
-std::array<float,2>{0.817237079f, 0.226914853f},
-std::array<float,2>{0.342683136f, 0.866898358f},
-std::array<float,2>{0.182360947f, 0.187263221f},
-std::array<float,2>{0.677540839f, 0.78810674f},
-std::array<float,2>{0.92342335f, 0.422481805f},
-std::array<float,2>{0.40420422f, 0.556631267f},
-std::array<float,2>{0.258065909f, 0.306449383f},
-std::array<float,2>{0.805969894f, 0.631987453f},
-std::array<float,2>{0.584813237f, 0.0766728967f},
-std::array<float,2>{0.0650168508f, 0.964006186f},
-std::array<float,2>{0.372999281f, 0.201689497f},
-std::array<float,2>{0.850405216f, 0.821129322f},
-std::array<float,2>{0.507606089f, 0.458559513f},
-std::array<float,2>{0.0268315338f, 0.581639826f},
-std::array<float,2>{0.198917851f, 0.323642939f},
-std::array<float,2>{0.727770984f, 0.723693609f},
-std::array<float,2>{0.986038685f, 0.0614774078f},
-std::array<float,2>{0.456210762f, 0.879026234f},
-std::array<float,2>{0.103539482f, 0.111699775f},
-std::array<float,2>{0.609697938f, 0.978861213f},
-std::array<float,2>{0.777330577f, 0.258592159f},
-std::array<float,2>{0.286282927f, 0.656274319f},
-std::array<float,2>{0.432415336f, 0.393982589f},
-std::array<float,2>{0.88831073f, 0.525034666f},
-std::array<float,2>{0.632728875f, 0.151771799f},
-std::array<float,2>{0.146733284f, 0.755164325f},
-std::array<float,2>{0.376479775f, 0.134692356f},
-std::array<float,2>{0.912175715f, 0.772960782f},
-std::array<float,2>{0.660164177f, 0.383112311f},
-std::array<float,2>{0.161543965f, 0.504977882f},
-std::array<float,2>{0.0861017331f, 0.269451857f},
-std::array<float,2>{0.564626932f, 0.682006776f},
-std::array<float,2>{0.786915898f, 0.0988992229f},
-std::array<float,2>{0.277184308f, 0.986203074f},
-std::array<float,2>{0.24838981f, 0.0364118218f},
-std::array<float,2>{0.697695076f, 0.895786464f},
-std::array<float,2>{0.946824074f, 0.342043728f},
-std::array<float,2>{0.479804963f, 0.741752386f},
-std::array<float,2>{0.314263374f, 0.449070364f},
-std::array<float,2>{0.843196869f, 0.570984483f},
-std::array<float,2>{0.539681852f, 0.205392078f},
-std::array<float,2>{0.049378451f, 0.834365189f},
-std::array<float,2>{0.303529561f, 0.0850324631f},
-std::array<float,2>{0.761001289f, 0.940544665f},
-std::array<float,2>{0.596739888f, 0.29047519f},
-std::array<float,2>{0.123363771f, 0.656030893f},
-std::array<float,2>{0.133166075f, 0.409721762f},
-std::array<float,2>{0.64532578f, 0.538146853f},
-std::array<float,2>{0.895512402f, 0.164343804f},
-std::array<float,2>{0.413796157f, 0.808073103f},
-std::array<float,2>{0.00434474088f, 0.236956418f},
-std::array<float,2>{0.516500354f, 0.848643422f},
-std::array<float,2>{0.873113573f, 0.487221092f},
-std::array<float,2>{0.359252214f, 0.602850378f},
-std::array<float,2>{0.451414227f, 0.357554913f},
-std::array<float,2>{0.977826178f, 0.700272381f},
-std::array<float,2>{0.742885113f, 0.00964870863f},
-std::array<float,2>{0.213693514f, 0.916204095f},
-std::array<float,2>{0.419619799f, 0.10267777f},
-std::array<float,2>{0.900891662f, 0.995946765f},
-std::array<float,2>{0.654196858f, 0.277986228f},
-std::array<float,2>{0.126843214f, 0.676084816f},
-std::array<float,2>{0.111436456f, 0.381054521f},
-std::array<float,2>{0.604437113f, 0.508587539f},
-std::array<float,2>{0.756882608f, 0.125435695f},
-std::array<float,2>{0.309239328f, 0.77693516f},
-std::array<float,2>{0.208351612f, 0.213899538f},
-std::array<float,2>{0.73842591f, 0.840573132f},
-std::array<float,2>{0.976333141f, 0.444143027f},
-std::array<float,2>{0.440659255f, 0.56893152f},
-std::array<float,2>{0.345758259f, 0.330830902f},
-std::array<float,2>{0.865928471f, 0.747847974f},
-std::array<float,2>{0.527633488f, 0.0391015112f},
-std::array<float,2>{0.0125864157f, 0.903376043f},
-std::array<float,2>{0.273107827f, 0.163008064f},
-std::array<float,2>{0.795945942f, 0.800069571f},
-std::array<float,2>{0.570732653f, 0.417916447f},
-std::array<float,2>{0.079298459f, 0.541120231f},
-std::array<float,2>{0.165097803f, 0.286520362f},
-std::array<float,2>{0.667758584f, 0.641376853f},
-std::array<float,2>{0.919178367f, 0.0930730924f},
-std::array<float,2>{0.390075207f, 0.953059852f},
-std::array<float,2>{0.0567644536f, 0.00355006079f},
-std::array<float,2>{0.534066439f, 0.907709777f},
-std::array<float,2>{0.833881795f, 0.345012099f},
-std::array<float,2>{0.320532858f, 0.692873776f},
-std::array<float,2>{0.470845014f, 0.492203295f},
-std::array<float,2>{0.937657297f, 0.600917518f},
-std::array<float,2>{0.688106477f, 0.24726896f},
-std::array<float,2>{0.234793544f, 0.858560503f},
-std::array<float,2>{0.462706119f, 0.226484597f},
-std::array<float,2>{0.99383837f, 0.87481308f},
-std::array<float,2>{0.723131001f, 0.471378297f},
-std::array<float,2>{0.18765074f, 0.624608576f},
-std::array<float,2>{0.0222358648f, 0.359773457f},
-std::array<float,2>{0.510181546f, 0.716016293f},
-std::array<float,2>{0.85453248f, 0.0173483752f},
-std::array<float,2>{0.364094704f, 0.933508396f},
-std::array<float,2>{0.154548034f, 0.0639701635f},
-std::array<float,2>{0.636805058f, 0.957142472f},
-std::array<float,2>{0.882469475f, 0.304098517f},
-std::array<float,2>{0.422179431f, 0.638531089f},
-std::array<float,2>{0.291712493f, 0.430487394f},
-std::array<float,2>{0.772622824f, 0.550225198f},
-std::array<float,2>{0.621577978f, 0.174383134f},
-std::array<float,2>{0.0963355675f, 0.789913356f},
-std::array<float,2>{0.335896283f, 0.0504839905f},
-std::array<float,2>{0.820580721f, 0.885806143f},
-std::array<float,2>{0.556737244f, 0.320182502f},
-std::array<float,2>{0.037142802f, 0.727993548f},
-std::array<float,2>{0.22305797f, 0.468696415f},
-std::array<float,2>{0.706783056f, 0.5865255f},
-std::array<float,2>{0.965522885f, 0.191769376f},
-std::array<float,2>{0.486355931f, 0.815492094f},
-std::array<float,2>{0.0720526502f, 0.147384852f},
-std::array<float,2>{0.587448478f, 0.760355353f},
-std::array<float,2>{0.7992962f, 0.405910701f},
-std::array<float,2>{0.254166216f, 0.516708255f},
-std::array<float,2>{0.391246974f, 0.253365278f},
-std::array<float,2>{0.930586338f, 0.664253533f},
-std::array<float,2>{0.68684417f, 0.118776523f},
-std::array<float,2>{0.177387297f, 0.969516754f},
-std::array<float,2>{0.398661494f, 0.0441250652f},
-std::array<float,2>{0.926899493f, 0.901061833f},
-std::array<float,2>{0.6754421f, 0.334968746f},
-std::array<float,2>{0.186083555f, 0.744011641f},
-std::array<float,2>{0.0699796081f, 0.439129502f},
-std::array<float,2>{0.578803539f, 0.565924823f},
-std::array<float,2>{0.81032294f, 0.215477392f},
-std::array<float,2>{0.264979899f, 0.838055432f},
-std::array<float,2>{0.230637178f, 0.130500719f},
-std::array<float,2>{0.714112639f, 0.78120631f},
-std::array<float,2>{0.955196857f, 0.37703374f},
-std::array<float,2>{0.495292038f, 0.512790263f},
-std::array<float,2>{0.339218944f, 0.276335388f},
-std::array<float,2>{0.816172719f, 0.673683524f},
-std::array<float,2>{0.553890347f, 0.107208364f},
-std::array<float,2>{0.0433007516f, 0.996274054f},
-std::array<float,2>{0.283282995f, 0.242601648f},
-std::array<float,2>{0.780158937f, 0.854704857f},
-std::array<float,2>{0.614805281f, 0.496516138f},
-std::array<float,2>{0.107225098f, 0.595656991f},
-std::array<float,2>{0.140779004f, 0.348507285f},
-std::array<float,2>{0.628574669f, 0.691280186f},
-std::array<float,2>{0.886242628f, 0.0074031814f},
-std::array<float,2>{0.436624944f, 0.912110746f},
-std::array<float,2>{0.0279015843f, 0.0891571715f},
-std::array<float,2>{0.500198603f, 0.946591437f},
-std::array<float,2>{0.84388566f, 0.284219533f},
-std::array<float,2>{0.367398977f, 0.645845294f},
-std::array<float,2>{0.460598141f, 0.419954181f},
-std::array<float,2>{0.991285205f, 0.543409407f},
-std::array<float,2>{0.732653081f, 0.159209952f},
-std::array<float,2>{0.202347055f, 0.801920831f},
-std::array<float,2>{0.484334052f, 0.178727925f},
-std::array<float,2>{0.951774597f, 0.796800852f},
-std::array<float,2>{0.702951193f, 0.43467322f},
-std::array<float,2>{0.242984489f, 0.553576112f},
-std::array<float,2>{0.0514647514f, 0.300259709f},
-std::array<float,2>{0.543073833f, 0.63455826f},
-std::array<float,2>{0.836337209f, 0.0673426911f},
-std::array<float,2>{0.319101363f, 0.953985035f},
-std::array<float,2>{0.159185603f, 0.0222104918f},
-std::array<float,2>{0.659465671f, 0.937156379f},
-std::array<float,2>{0.909377337f, 0.363715798f},
-std::array<float,2>{0.379937977f, 0.711152971f},
-std::array<float,2>{0.278617501f, 0.474285603f},
-std::array<float,2>{0.782562256f, 0.619640112f},
-std::array<float,2>{0.568516672f, 0.22147502f},
-std::array<float,2>{0.0914543495f, 0.867903531f},
-std::array<float,2>{0.35313502f, 0.123145774f},
-std::array<float,2>{0.869145274f, 0.97299546f},
-std::array<float,2>{0.520178318f, 0.25572288f},
-std::array<float,2>{0.000220338261f, 0.66810292f},
-std::array<float,2>{0.218342111f, 0.40020898f},
-std::array<float,2>{0.748935282f, 0.52146709f},
-std::array<float,2>{0.982516766f, 0.141888872f},
-std::array<float,2>{0.446477562f, 0.764045358f},
-std::array<float,2>{0.117557131f, 0.187876225f},
-std::array<float,2>{0.598727882f, 0.816933453f},
-std::array<float,2>{0.765592396f, 0.462117046f},
-std::array<float,2>{0.297202706f, 0.590352535f},
-std::array<float,2>{0.407939285f, 0.3162283f},
-std::array<float,2>{0.890776575f, 0.733349979f},
-std::array<float,2>{0.641589046f, 0.0512384623f},
-std::array<float,2>{0.13759762f, 0.888655186f},
-std::array<float,2>{0.444961309f, 0.0735981613f},
-std::array<float,2>{0.971763015f, 0.968271315f},
-std::array<float,2>{0.73726362f, 0.311812669f},
-std::array<float,2>{0.203351051f, 0.625225186f},
-std::array<float,2>{0.00896647666f, 0.426756352f},
-std::array<float,2>{0.52633667f, 0.561692238f},
-std::array<float,2>{0.860207617f, 0.183099493f},
-std::array<float,2>{0.351082653f, 0.782687008f},
-std::array<float,2>{0.132754341f, 0.231750682f},
-std::array<float,2>{0.648685992f, 0.861722112f},
-std::array<float,2>{0.904276371f, 0.478141367f},
-std::array<float,2>{0.415670812f, 0.609546006f},
-std::array<float,2>{0.307247907f, 0.369947523f},
-std::array<float,2>{0.750871181f, 0.703977942f},
-std::array<float,2>{0.607656419f, 0.0279905628f},
-std::array<float,2>{0.116555966f, 0.922957242f},
-std::array<float,2>{0.325604886f, 0.154060975f},
-std::array<float,2>{0.83077234f, 0.753902555f},
-std::array<float,2>{0.537100315f, 0.396011472f},
-std::array<float,2>{0.0604954436f, 0.529314041f},
-std::array<float,2>{0.240902483f, 0.264717937f},
-std::array<float,2>{0.691970825f, 0.662296474f},
-std::array<float,2>{0.941453695f, 0.11491178f},
-std::array<float,2>{0.473602086f, 0.982806921f},
-std::array<float,2>{0.0828679204f, 0.0570578054f},
-std::array<float,2>{0.576346993f, 0.877717912f},
-std::array<float,2>{0.790007114f, 0.324330091f},
-std::array<float,2>{0.267221302f, 0.72221458f},
-std::array<float,2>{0.384029835f, 0.456066906f},
-std::array<float,2>{0.917402804f, 0.582496703f},
-std::array<float,2>{0.671177804f, 0.198549688f},
-std::array<float,2>{0.16828838f, 0.827672124f},
-std::array<float,2>{0.427227616f, 0.208265841f},
-std::array<float,2>{0.878690422f, 0.829704046f},
-std::array<float,2>{0.633312762f, 0.4503856f},
-std::array<float,2>{0.152065501f, 0.575309813f},
-std::array<float,2>{0.0999175161f, 0.338091791f},
-std::array<float,2>{0.620557368f, 0.736533821f},
-std::array<float,2>{0.768941939f, 0.0324896537f},
-std::array<float,2>{0.29626748f, 0.894008696f},
-std::array<float,2>{0.194036543f, 0.0959626213f},
-std::array<float,2>{0.719605565f, 0.988608181f},
-std::array<float,2>{0.999711514f, 0.273362249f},
-std::array<float,2>{0.466757715f, 0.685840726f},
-std::array<float,2>{0.363069922f, 0.387555122f},
-std::array<float,2>{0.858698726f, 0.500781476f},
-std::array<float,2>{0.512204945f, 0.138278022f},
-std::array<float,2>{0.017538568f, 0.766533136f},
-std::array<float,2>{0.251352727f, 0.012300224f},
-std::array<float,2>{0.801241159f, 0.920511782f},
-std::array<float,2>{0.591650188f, 0.352117747f},
-std::array<float,2>{0.0771194696f, 0.698301852f},
-std::array<float,2>{0.173640862f, 0.489878118f},
-std::array<float,2>{0.682880402f, 0.608712614f},
-std::array<float,2>{0.934939981f, 0.240616202f},
-std::array<float,2>{0.395172477f, 0.847325265f},
-std::array<float,2>{0.0332638957f, 0.170423314f},
-std::array<float,2>{0.561205149f, 0.812160432f},
-std::array<float,2>{0.827897608f, 0.411633611f},
-std::array<float,2>{0.330629557f, 0.532540083f},
-std::array<float,2>{0.490628392f, 0.295427799f},
-std::array<float,2>{0.962019801f, 0.651974559f},
-std::array<float,2>{0.709483027f, 0.0781641901f},
-std::array<float,2>{0.219216228f, 0.942948639f},
-std::array<float,2>{0.454963416f, 0.0602775887f},
-std::array<float,2>{0.987974584f, 0.881804883f},
-std::array<float,2>{0.72944808f, 0.321341515f},
-std::array<float,2>{0.196968094f, 0.725307763f},
-std::array<float,2>{0.0243390556f, 0.459294528f},
-std::array<float,2>{0.504974008f, 0.57926023f},
-std::array<float,2>{0.848095119f, 0.200662419f},
-std::array<float,2>{0.374758869f, 0.824041486f},
-std::array<float,2>{0.1457766f, 0.148468316f},
-std::array<float,2>{0.630774021f, 0.756491244f},
-std::array<float,2>{0.890527368f, 0.390985787f},
-std::array<float,2>{0.431572527f, 0.527224243f},
-std::array<float,2>{0.288350284f, 0.26044032f},
-std::array<float,2>{0.77521199f, 0.659112632f},
-std::array<float,2>{0.611469448f, 0.110483289f},
-std::array<float,2>{0.102566354f, 0.977752566f},
-std::array<float,2>{0.340014756f, 0.229019091f},
-std::array<float,2>{0.820192695f, 0.865097582f},
-std::array<float,2>{0.547394633f, 0.482762456f},
-std::array<float,2>{0.0408928692f, 0.61608088f},
-std::array<float,2>{0.229917094f, 0.374520868f},
-std::array<float,2>{0.718736291f, 0.708973229f},
-std::array<float,2>{0.960008204f, 0.0254661143f},
-std::array<float,2>{0.497468352f, 0.926082909f},
-std::array<float,2>{0.0639402568f, 0.0757794157f},
-std::array<float,2>{0.583676875f, 0.962438941f},
-std::array<float,2>{0.806987822f, 0.308328301f},
-std::array<float,2>{0.26080966f, 0.63001281f},
-std::array<float,2>{0.406026214f, 0.425229639f},
-std::array<float,2>{0.92444706f, 0.55763936f},
-std::array<float,2>{0.677744687f, 0.184332207f},
-std::array<float,2>{0.180008069f, 0.785665393f},
-std::array<float,2>{0.410376787f, 0.166300043f},
-std::array<float,2>{0.897698343f, 0.805287361f},
-std::array<float,2>{0.648152947f, 0.406682611f},
-std::array<float,2>{0.135272667f, 0.536693454f},
-std::array<float,2>{0.122307599f, 0.291181445f},
-std::array<float,2>{0.594380081f, 0.652601898f},
-std::array<float,2>{0.758571565f, 0.0836946666f},
-std::array<float,2>{0.300908685f, 0.937854707f},
-std::array<float,2>{0.211818531f, 0.0116236666f},
-std::array<float,2>{0.74499166f, 0.914984047f},
-std::array<float,2>{0.979414344f, 0.357063591f},
-std::array<float,2>{0.450389624f, 0.702328384f},
-std::array<float,2>{0.357284009f, 0.485674411f},
-std::array<float,2>{0.872999072f, 0.605129719f},
-std::array<float,2>{0.519159675f, 0.235549852f},
-std::array<float,2>{0.00723564113f, 0.850611925f},
-std::array<float,2>{0.27353704f, 0.100996524f},
-std::array<float,2>{0.787635207f, 0.986620724f},
-std::array<float,2>{0.564022124f, 0.266740173f},
-std::array<float,2>{0.0891156495f, 0.680861413f},
-std::array<float,2>{0.162950411f, 0.385386229f},
-std::array<float,2>{0.663206398f, 0.507769287f},
-std::array<float,2>{0.910557091f, 0.134829432f},
-std::array<float,2>{0.37865746f, 0.769778252f},
-std::array<float,2>{0.0480640605f, 0.203912437f},
-std::array<float,2>{0.541999519f, 0.833014011f},
-std::array<float,2>{0.840668082f, 0.445341349f},
-std::array<float,2>{0.315344602f, 0.573429167f},
-std::array<float,2>{0.477262825f, 0.340553343f},
-std::array<float,2>{0.947383106f, 0.739673495f},
-std::array<float,2>{0.696332276f, 0.0375021175f},
-std::array<float,2>{0.246155635f, 0.897790074f},
-std::array<float,2>{0.386755407f, 0.0917422101f},
-std::array<float,2>{0.9216519f, 0.951152444f},
-std::array<float,2>{0.665581882f, 0.288918346f},
-std::array<float,2>{0.166763976f, 0.643477678f},
-std::array<float,2>{0.081154041f, 0.414278656f},
-std::array<float,2>{0.572879791f, 0.539110601f},
-std::array<float,2>{0.794593394f, 0.160655841f},
-std::array<float,2>{0.269827038f, 0.797967672f},
-std::array<float,2>{0.236750126f, 0.249306992f},
-std::array<float,2>{0.690593362f, 0.856853843f},
-std::array<float,2>{0.939924419f, 0.495540231f},
-std::array<float,2>{0.470133215f, 0.599575639f},
-std::array<float,2>{0.322796524f, 0.346712112f},
-std::array<float,2>{0.835559666f, 0.695264816f},
-std::array<float,2>{0.531703293f, 0.00173100783f},
-std::array<float,2>{0.056505233f, 0.909814715f},
-std::array<float,2>{0.310671717f, 0.127730414f},
-std::array<float,2>{0.755105376f, 0.774421036f},
-std::array<float,2>{0.602779686f, 0.379892081f},
-std::array<float,2>{0.110538147f, 0.510091722f},
-std::array<float,2>{0.128832445f, 0.280934483f},
-std::array<float,2>{0.655981779f, 0.678828537f},
-std::array<float,2>{0.900329232f, 0.103787936f},
-std::array<float,2>{0.420727909f, 0.99318248f},
-std::array<float,2>{0.0152326291f, 0.0417760611f},
-std::array<float,2>{0.529670358f, 0.904412985f},
-std::array<float,2>{0.863759995f, 0.329409152f},
-std::array<float,2>{0.344826192f, 0.749492884f},
-std::array<float,2>{0.437535346f, 0.442640334f},
-std::array<float,2>{0.972790301f, 0.568018496f},
-std::array<float,2>{0.740399837f, 0.211640626f},
-std::array<float,2>{0.209501848f, 0.84248209f},
-std::array<float,2>{0.484953642f, 0.193645492f},
-std::array<float,2>{0.968410492f, 0.81311059f},
-std::array<float,2>{0.703597784f, 0.466710061f},
-std::array<float,2>{0.225958988f, 0.58809495f},
-std::array<float,2>{0.0357260741f, 0.318352342f},
-std::array<float,2>{0.555834651f, 0.729404926f},
-std::array<float,2>{0.82236284f, 0.0479039848f},
-std::array<float,2>{0.333003163f, 0.884139955f},
-std::array<float,2>{0.178154722f, 0.119945496f},
-std::array<float,2>{0.685380042f, 0.972395718f},
-std::array<float,2>{0.93239224f, 0.250838757f},
-std::array<float,2>{0.394082308f, 0.667507291f},
-std::array<float,2>{0.257562578f, 0.402358264f},
-std::array<float,2>{0.798294604f, 0.519258738f},
-std::array<float,2>{0.589102924f, 0.146249011f},
-std::array<float,2>{0.0725917891f, 0.758117974f},
-std::array<float,2>{0.365711749f, 0.0190238841f},
-std::array<float,2>{0.85309279f, 0.930949688f},
-std::array<float,2>{0.508624136f, 0.361992598f},
-std::array<float,2>{0.0205984116f, 0.718736291f},
-std::array<float,2>{0.189700767f, 0.469218194f},
-std::array<float,2>{0.725296855f, 0.622235835f},
-std::array<float,2>{0.995092332f, 0.222900271f},
-std::array<float,2>{0.463025719f, 0.871386886f},
-std::array<float,2>{0.0951574072f, 0.172453746f},
-std::array<float,2>{0.624945581f, 0.792261839f},
-std::array<float,2>{0.771154404f, 0.431740105f},
-std::array<float,2>{0.289539248f, 0.548502743f},
-std::array<float,2>{0.424693346f, 0.300913006f},
-std::array<float,2>{0.879211068f, 0.640604854f},
-std::array<float,2>{0.6406039f, 0.0654561445f},
-std::array<float,2>{0.153123409f, 0.959926367f},
-std::array<float,2>{0.434282809f, 0.00535610411f},
-std::array<float,2>{0.883593738f, 0.910249531f},
-std::array<float,2>{0.625037313f, 0.351215094f},
-std::array<float,2>{0.143621579f, 0.688552558f},
-std::array<float,2>{0.109067544f, 0.498287559f},
-std::array<float,2>{0.616975427f, 0.595778942f},
-std::array<float,2>{0.779186726f, 0.244419515f},
-std::array<float,2>{0.281823754f, 0.851691008f},
-std::array<float,2>{0.199301511f, 0.156851918f},
-std::array<float,2>{0.731555939f, 0.803528011f},
-std::array<float,2>{0.988965809f, 0.419374615f},
-std::array<float,2>{0.457502991f, 0.546195507f},
-std::array<float,2>{0.369960129f, 0.282403976f},
-std::array<float,2>{0.845989823f, 0.646914542f},
-std::array<float,2>{0.503809869f, 0.0878150314f},
-std::array<float,2>{0.0306483172f, 0.947525203f},
-std::array<float,2>{0.262169629f, 0.218283758f},
-std::array<float,2>{0.812271655f, 0.837066293f},
-std::array<float,2>{0.580870748f, 0.440145612f},
-std::array<float,2>{0.0669471622f, 0.563064277f},
-std::array<float,2>{0.185104221f, 0.333190143f},
-std::array<float,2>{0.67321372f, 0.745626032f},
-std::array<float,2>{0.927942276f, 0.0455223173f},
-std::array<float,2>{0.402245104f, 0.898760974f},
-std::array<float,2>{0.0458072349f, 0.107839823f},
-std::array<float,2>{0.552217722f, 0.998868048f},
-std::array<float,2>{0.813454926f, 0.273712993f},
-std::array<float,2>{0.336417198f, 0.674257278f},
-std::array<float,2>{0.492982268f, 0.375570804f},
-std::array<float,2>{0.953290045f, 0.51411128f},
-std::array<float,2>{0.712462664f, 0.132589459f},
-std::array<float,2>{0.234344289f, 0.777692199f},
-std::array<float,2>{0.448310167f, 0.142772868f},
-std::array<float,2>{0.980691195f, 0.763252318f},
-std::array<float,2>{0.747684658f, 0.401729673f},
-std::array<float,2>{0.215228036f, 0.521731675f},
-std::array<float,2>{0.00279833144f, 0.256259233f},
-std::array<float,2>{0.521757662f, 0.671425641f},
-std::array<float,2>{0.867357552f, 0.121396959f},
-std::array<float,2>{0.355237693f, 0.975021303f},
-std::array<float,2>{0.139438182f, 0.0528784841f},
-std::array<float,2>{0.644348145f, 0.888706863f},
-std::array<float,2>{0.892785132f, 0.313711643f},
-std::array<float,2>{0.409865052f, 0.730864882f},
-std::array<float,2>{0.300514579f, 0.464102268f},
-std::array<float,2>{0.762959659f, 0.592348278f},
-std::array<float,2>{0.600636065f, 0.190730467f},
-std::array<float,2>{0.120425567f, 0.819818437f},
-std::array<float,2>{0.317890435f, 0.0695964098f},
-std::array<float,2>{0.839694321f, 0.956769049f},
-std::array<float,2>{0.545275092f, 0.29861179f},
-std::array<float,2>{0.0537059866f, 0.636110365f},
-std::array<float,2>{0.245248213f, 0.437103212f},
-std::array<float,2>{0.699316919f, 0.551994681f},
-std::array<float,2>{0.950492561f, 0.176945806f},
-std::array<float,2>{0.481215328f, 0.793945611f},
-std::array<float,2>{0.0934001282f, 0.22045885f},
-std::array<float,2>{0.56755352f, 0.870487511f},
-std::array<float,2>{0.783330023f, 0.474981517f},
-std::array<float,2>{0.279907525f, 0.618775785f},
-std::array<float,2>{0.382536739f, 0.366399705f},
-std::array<float,2>{0.907551646f, 0.714326203f},
-std::array<float,2>{0.656361043f, 0.0214593839f},
-std::array<float,2>{0.157052442f, 0.935042143f},
-std::array<float,2>{0.476458848f, 0.116077498f},
-std::array<float,2>{0.944188893f, 0.982272387f},
-std::array<float,2>{0.693772256f, 0.263222724f},
-std::array<float,2>{0.239845887f, 0.661171854f},
-std::array<float,2>{0.0620464832f, 0.398248523f},
-std::array<float,2>{0.538666308f, 0.527541339f},
-std::array<float,2>{0.829727888f, 0.154401705f},
-std::array<float,2>{0.326838493f, 0.750805616f},
-std::array<float,2>{0.170105919f, 0.197020382f},
-std::array<float,2>{0.669921458f, 0.824241579f},
-std::array<float,2>{0.915411651f, 0.454242915f},
-std::array<float,2>{0.386355489f, 0.584236622f},
-std::array<float,2>{0.26847133f, 0.327066869f},
-std::array<float,2>{0.791243076f, 0.719173789f},
-std::array<float,2>{0.576015234f, 0.0556526594f},
-std::array<float,2>{0.0856857747f, 0.876684785f},
-std::array<float,2>{0.349093974f, 0.181624889f},
-std::array<float,2>{0.862396121f, 0.784736037f},
-std::array<float,2>{0.523591697f, 0.429136813f},
-std::array<float,2>{0.0113324458f, 0.559217572f},
-std::array<float,2>{0.206341222f, 0.309583455f},
-std::array<float,2>{0.734575212f, 0.628813922f},
-std::array<float,2>{0.969361901f, 0.0709926859f},
-std::array<float,2>{0.441860765f, 0.966216564f},
-std::array<float,2>{0.114970572f, 0.0302215368f},
-std::array<float,2>{0.606916606f, 0.924060106f},
-std::array<float,2>{0.753203928f, 0.368676335f},
-std::array<float,2>{0.30483821f, 0.706426501f},
-std::array<float,2>{0.417429358f, 0.480162114f},
-std::array<float,2>{0.904612124f, 0.612268627f},
-std::array<float,2>{0.652284384f, 0.234050572f},
-std::array<float,2>{0.130561069f, 0.860308468f},
-std::array<float,2>{0.397236586f, 0.239942133f},
-std::array<float,2>{0.937002599f, 0.845437706f},
-std::array<float,2>{0.680836499f, 0.490684718f},
-std::array<float,2>{0.17426683f, 0.606400788f},
-std::array<float,2>{0.0761026591f, 0.353816032f},
-std::array<float,2>{0.592458427f, 0.696858346f},
-std::array<float,2>{0.804384291f, 0.0155895911f},
-std::array<float,2>{0.253899395f, 0.918912709f},
-std::array<float,2>{0.22170198f, 0.081661053f},
-std::array<float,2>{0.708858967f, 0.943457186f},
-std::array<float,2>{0.963102698f, 0.294920862f},
-std::array<float,2>{0.488660842f, 0.649434268f},
-std::array<float,2>{0.329021931f, 0.413806289f},
-std::array<float,2>{0.826113462f, 0.533326507f},
-std::array<float,2>{0.559778452f, 0.169335365f},
-std::array<float,2>{0.0312978849f, 0.809155583f},
-std::array<float,2>{0.294272482f, 0.0337330028f},
-std::array<float,2>{0.766943336f, 0.892221391f},
-std::array<float,2>{0.61894387f, 0.337483525f},
-std::array<float,2>{0.0977866948f, 0.735851765f},
-std::array<float,2>{0.148482889f, 0.451678276f},
-std::array<float,2>{0.634824991f, 0.576889932f},
-std::array<float,2>{0.875304759f, 0.209403455f},
-std::array<float,2>{0.42890349f, 0.830626786f},
-std::array<float,2>{0.0181578677f, 0.138673723f},
-std::array<float,2>{0.515287995f, 0.767840803f},
-std::array<float,2>{0.855965614f, 0.390150964f},
-std::array<float,2>{0.360292166f, 0.502903163f},
-std::array<float,2>{0.467020571f, 0.270230412f},
-std::array<float,2>{0.997788787f, 0.683866084f},
-std::array<float,2>{0.721765757f, 0.095433861f},
-std::array<float,2>{0.19222948f, 0.990298212f},
-std::array<float,2>{0.457196921f, 0.00618913025f},
-std::array<float,2>{0.989024818f, 0.914035738f},
-std::array<float,2>{0.731763303f, 0.348965675f},
-std::array<float,2>{0.199479282f, 0.690213501f},
-std::array<float,2>{0.0303598754f, 0.49732995f},
-std::array<float,2>{0.503613412f, 0.593765795f},
-std::array<float,2>{0.845735788f, 0.243835419f},
-std::array<float,2>{0.369872391f, 0.853788018f},
-std::array<float,2>{0.144000605f, 0.158804536f},
-std::array<float,2>{0.625259459f, 0.80169332f},
-std::array<float,2>{0.883522809f, 0.421245307f},
-std::array<float,2>{0.43451032f, 0.544782043f},
-std::array<float,2>{0.281998605f, 0.284043312f},
-std::array<float,2>{0.778851449f, 0.645484626f},
-std::array<float,2>{0.616717041f, 0.0887058526f},
-std::array<float,2>{0.109148763f, 0.945835292f},
-std::array<float,2>{0.336040884f, 0.216265962f},
-std::array<float,2>{0.813133657f, 0.838966668f},
-std::array<float,2>{0.551977754f, 0.438080251f},
-std::array<float,2>{0.0455288664f, 0.56457299f},
-std::array<float,2>{0.234122306f, 0.334778517f},
-std::array<float,2>{0.712667644f, 0.743064821f},
-std::array<float,2>{0.953433692f, 0.0430130884f},
-std::array<float,2>{0.492897868f, 0.90182966f},
-std::array<float,2>{0.0672263354f, 0.105657175f},
-std::array<float,2>{0.580723763f, 0.997143865f},
-std::array<float,2>{0.812165201f, 0.277337313f},
-std::array<float,2>{0.261865079f, 0.672609389f},
-std::array<float,2>{0.40199396f, 0.378168464f},
-std::array<float,2>{0.92814672f, 0.512599885f},
-std::array<float,2>{0.672983468f, 0.129659101f},
-std::array<float,2>{0.185342759f, 0.780145407f},
-std::array<float,2>{0.410048157f, 0.140977323f},
-std::array<float,2>{0.892836988f, 0.765392661f},
-std::array<float,2>{0.644283593f, 0.399257034f},
-std::array<float,2>{0.139363453f, 0.520106554f},
-std::array<float,2>{0.120227918f, 0.254026145f},
-std::array<float,2>{0.600872397f, 0.669526696f},
-std::array<float,2>{0.76290828f, 0.124246269f},
-std::array<float,2>{0.300635219f, 0.974145472f},
-std::array<float,2>{0.214846671f, 0.0522915274f},
-std::array<float,2>{0.748036325f, 0.887546003f},
-std::array<float,2>{0.980766296f, 0.315185726f},
-std::array<float,2>{0.448703527f, 0.734188199f},
-std::array<float,2>{0.355059922f, 0.461310178f},
-std::array<float,2>{0.867511868f, 0.591601908f},
-std::array<float,2>{0.521725953f, 0.188694179f},
-std::array<float,2>{0.00266988366f, 0.818186641f},
-std::array<float,2>{0.280159891f, 0.0681805462f},
-std::array<float,2>{0.783631802f, 0.954696f},
-std::array<float,2>{0.567666948f, 0.29973647f},
-std::array<float,2>{0.0935121551f, 0.633754909f},
-std::array<float,2>{0.156937182f, 0.434134871f},
-std::array<float,2>{0.656652331f, 0.554591238f},
-std::array<float,2>{0.907431722f, 0.17779161f},
-std::array<float,2>{0.382768393f, 0.795530796f},
-std::array<float,2>{0.0534252897f, 0.222526252f},
-std::array<float,2>{0.545155108f, 0.868662357f},
-std::array<float,2>{0.839454889f, 0.47306785f},
-std::array<float,2>{0.318123072f, 0.620975673f},
-std::array<float,2>{0.481113642f, 0.3643713f},
-std::array<float,2>{0.950250149f, 0.712820709f},
-std::array<float,2>{0.699611008f, 0.0233229864f},
-std::array<float,2>{0.245404392f, 0.935645521f},
-std::array<float,2>{0.386600941f, 0.114072509f},
-std::array<float,2>{0.915282905f, 0.984288216f},
-std::array<float,2>{0.669624746f, 0.263702333f},
-std::array<float,2>{0.170186117f, 0.663257599f},
-std::array<float,2>{0.0857661888f, 0.395184159f},
-std::array<float,2>{0.575922608f, 0.531239867f},
-std::array<float,2>{0.791270256f, 0.152868673f},
-std::array<float,2>{0.268085897f, 0.752324879f},
-std::array<float,2>{0.240066186f, 0.19730188f},
-std::array<float,2>{0.693382442f, 0.826714337f},
-std::array<float,2>{0.943857253f, 0.455576211f},
-std::array<float,2>{0.476083875f, 0.583549142f},
-std::array<float,2>{0.327058464f, 0.325767636f},
-std::array<float,2>{0.829900324f, 0.721096814f},
-std::array<float,2>{0.538920045f, 0.0578589849f},
-std::array<float,2>{0.0622855909f, 0.878457785f},
-std::array<float,2>{0.30508548f, 0.181832224f},
-std::array<float,2>{0.752965868f, 0.781356573f},
-std::array<float,2>{0.60652107f, 0.427434683f},
-std::array<float,2>{0.115199961f, 0.56123966f},
-std::array<float,2>{0.130729973f, 0.311328471f},
-std::array<float,2>{0.651873112f, 0.626352608f},
-std::array<float,2>{0.90450269f, 0.0732243285f},
-std::array<float,2>{0.417184442f, 0.967629731f},
-std::array<float,2>{0.0115482574f, 0.0288618132f},
-std::array<float,2>{0.523866355f, 0.922345519f},
-std::array<float,2>{0.862613261f, 0.370351881f},
-std::array<float,2>{0.348726243f, 0.704436243f},
-std::array<float,2>{0.441584796f, 0.477462113f},
-std::array<float,2>{0.969547093f, 0.611132383f},
-std::array<float,2>{0.73474443f, 0.231068343f},
-std::array<float,2>{0.206070632f, 0.86277163f},
-std::array<float,2>{0.48845765f, 0.241505966f},
-std::array<float,2>{0.963185012f, 0.845707059f},
-std::array<float,2>{0.708734274f, 0.48900789f},
-std::array<float,2>{0.222111866f, 0.608355939f},
-std::array<float,2>{0.0315043442f, 0.352779269f},
-std::array<float,2>{0.559938192f, 0.698127806f},
-std::array<float,2>{0.825808167f, 0.0133649791f},
-std::array<float,2>{0.328663498f, 0.921417892f},
-std::array<float,2>{0.174043f, 0.0800391212f},
-std::array<float,2>{0.681132495f, 0.941651464f},
-std::array<float,2>{0.936677814f, 0.29648003f},
-std::array<float,2>{0.397120476f, 0.65086323f},
-std::array<float,2>{0.253656894f, 0.410976708f},
-std::array<float,2>{0.804678798f, 0.531627297f},
-std::array<float,2>{0.592655778f, 0.17172505f},
-std::array<float,2>{0.0758050159f, 0.81117481f},
-std::array<float,2>{0.359945476f, 0.032008037f},
-std::array<float,2>{0.856387377f, 0.892686725f},
-std::array<float,2>{0.515595436f, 0.339565277f},
-std::array<float,2>{0.01850098f, 0.737843812f},
-std::array<float,2>{0.191999838f, 0.450184673f},
-std::array<float,2>{0.722140014f, 0.574912429f},
-std::array<float,2>{0.99804008f, 0.207979828f},
-std::array<float,2>{0.467184007f, 0.829005957f},
-std::array<float,2>{0.0981148332f, 0.136944428f},
-std::array<float,2>{0.618848622f, 0.767358601f},
-std::array<float,2>{0.766622126f, 0.388257802f},
-std::array<float,2>{0.294066727f, 0.501441658f},
-std::array<float,2>{0.428959757f, 0.271858424f},
-std::array<float,2>{0.875121772f, 0.687015235f},
-std::array<float,2>{0.635078847f, 0.0970215574f},
-std::array<float,2>{0.148741558f, 0.98990947f},
-std::array<float,2>{0.431155235f, 0.0619835667f},
-std::array<float,2>{0.890181243f, 0.88077724f},
-std::array<float,2>{0.630543828f, 0.323092103f},
-std::array<float,2>{0.14570646f, 0.722825944f},
-std::array<float,2>{0.102811716f, 0.457155406f},
-std::array<float,2>{0.611629605f, 0.580744326f},
-std::array<float,2>{0.775023699f, 0.2024571f},
-std::array<float,2>{0.288203657f, 0.82219696f},
-std::array<float,2>{0.197115496f, 0.150585845f},
-std::array<float,2>{0.729131937f, 0.754823744f},
-std::array<float,2>{0.988171339f, 0.393198848f},
-std::array<float,2>{0.454798609f, 0.524229944f},
-std::array<float,2>{0.374643892f, 0.259316444f},
-std::array<float,2>{0.847816944f, 0.658136785f},
-std::array<float,2>{0.505320013f, 0.113024808f},
-std::array<float,2>{0.0240818597f, 0.979510963f},
-std::array<float,2>{0.261059284f, 0.228336096f},
-std::array<float,2>{0.806747019f, 0.865499318f},
-std::array<float,2>{0.583828032f, 0.480489969f},
-std::array<float,2>{0.0634804741f, 0.614453137f},
-std::array<float,2>{0.179894775f, 0.371783972f},
-std::array<float,2>{0.678171575f, 0.71012485f},
-std::array<float,2>{0.924705863f, 0.0246372595f},
-std::array<float,2>{0.405994117f, 0.929079771f},
-std::array<float,2>{0.0405801684f, 0.0777909681f},
-std::array<float,2>{0.547756612f, 0.963480294f},
-std::array<float,2>{0.819919288f, 0.305393398f},
-std::array<float,2>{0.340146542f, 0.631181121f},
-std::array<float,2>{0.497250855f, 0.423189908f},
-std::array<float,2>{0.960252583f, 0.555121779f},
-std::array<float,2>{0.718316793f, 0.186280578f},
-std::array<float,2>{0.229649544f, 0.787481427f},
-std::array<float,2>{0.450490415f, 0.165965527f},
-std::array<float,2>{0.979015231f, 0.807026267f},
-std::array<float,2>{0.744773865f, 0.408982664f},
-std::array<float,2>{0.211522847f, 0.537825108f},
-std::array<float,2>{0.00699898601f, 0.289812773f},
-std::array<float,2>{0.51933521f, 0.654548585f},
-std::array<float,2>{0.872632861f, 0.0846915841f},
-std::array<float,2>{0.357102603f, 0.939967275f},
-std::array<float,2>{0.135717854f, 0.00820178166f},
-std::array<float,2>{0.648222387f, 0.917325556f},
-std::array<float,2>{0.897793114f, 0.359240413f},
-std::array<float,2>{0.410521716f, 0.700029135f},
-std::array<float,2>{0.301070035f, 0.487722367f},
-std::array<float,2>{0.758441269f, 0.602119744f},
-std::array<float,2>{0.594545901f, 0.238264397f},
-std::array<float,2>{0.122468032f, 0.847963989f},
-std::array<float,2>{0.315056026f, 0.0982229635f},
-std::array<float,2>{0.840348125f, 0.985124052f},
-std::array<float,2>{0.542479396f, 0.267847776f},
-std::array<float,2>{0.0481008738f, 0.68332243f},
-std::array<float,2>{0.246487558f, 0.384224087f},
-std::array<float,2>{0.696541667f, 0.504670978f},
-std::array<float,2>{0.947520196f, 0.133736581f},
-std::array<float,2>{0.477426857f, 0.771848142f},
-std::array<float,2>{0.0890761316f, 0.206942588f},
-std::array<float,2>{0.564287305f, 0.835845172f},
-std::array<float,2>{0.788021147f, 0.447652519f},
-std::array<float,2>{0.273782015f, 0.571499288f},
-std::array<float,2>{0.378894776f, 0.343550622f},
-std::array<float,2>{0.910240948f, 0.740428269f},
-std::array<float,2>{0.663492858f, 0.0359519273f},
-std::array<float,2>{0.162636131f, 0.895493031f},
-std::array<float,2>{0.469875634f, 0.0925044492f},
-std::array<float,2>{0.939533532f, 0.952011466f},
-std::array<float,2>{0.69090426f, 0.285280854f},
-std::array<float,2>{0.236329928f, 0.642244399f},
-std::array<float,2>{0.056382969f, 0.416464597f},
-std::array<float,2>{0.531408489f, 0.542028785f},
-std::array<float,2>{0.835915208f, 0.16377528f},
-std::array<float,2>{0.32312423f, 0.799048603f},
-std::array<float,2>{0.166667029f, 0.246705562f},
-std::array<float,2>{0.665849209f, 0.858333349f},
-std::array<float,2>{0.921556592f, 0.493813843f},
-std::array<float,2>{0.387047827f, 0.599824488f},
-std::array<float,2>{0.269692868f, 0.344543517f},
-std::array<float,2>{0.794838786f, 0.691787362f},
-std::array<float,2>{0.57323879f, 0.00271873455f},
-std::array<float,2>{0.0814352855f, 0.906616449f},
-std::array<float,2>{0.345201045f, 0.12631689f},
-std::array<float,2>{0.863392353f, 0.776353419f},
-std::array<float,2>{0.529482722f, 0.382056266f},
-std::array<float,2>{0.0154639203f, 0.509008408f},
-std::array<float,2>{0.209742591f, 0.278915584f},
-std::array<float,2>{0.740720153f, 0.677422047f},
-std::array<float,2>{0.973067462f, 0.102081448f},
-std::array<float,2>{0.437859565f, 0.994781494f},
-std::array<float,2>{0.110606298f, 0.0407523401f},
-std::array<float,2>{0.60291189f, 0.902547419f},
-std::array<float,2>{0.755338609f, 0.33126381f},
-std::array<float,2>{0.310827732f, 0.746684611f},
-std::array<float,2>{0.420565039f, 0.445311099f},
-std::array<float,2>{0.900076032f, 0.569585145f},
-std::array<float,2>{0.656085134f, 0.21371378f},
-std::array<float,2>{0.128472477f, 0.841371f},
-std::array<float,2>{0.394436002f, 0.193179637f},
-std::array<float,2>{0.93223393f, 0.814521015f},
-std::array<float,2>{0.685292542f, 0.467095017f},
-std::array<float,2>{0.177797601f, 0.587220192f},
-std::array<float,2>{0.0723877028f, 0.318616867f},
-std::array<float,2>{0.58932054f, 0.726828575f},
-std::array<float,2>{0.798028111f, 0.0492160805f},
-std::array<float,2>{0.257670343f, 0.88556695f},
-std::array<float,2>{0.225715429f, 0.117482126f},
-std::array<float,2>{0.703200459f, 0.969921291f},
-std::array<float,2>{0.968603075f, 0.252783865f},
-std::array<float,2>{0.485203803f, 0.665963352f},
-std::array<float,2>{0.332609951f, 0.40495345f},
-std::array<float,2>{0.822731137f, 0.515946984f},
-std::array<float,2>{0.556149125f, 0.147930875f},
-std::array<float,2>{0.0361042619f, 0.7608549f},
-std::array<float,2>{0.289167553f, 0.0160172395f},
-std::array<float,2>{0.771310985f, 0.932341814f},
-std::array<float,2>{0.6246593f, 0.360602915f},
-std::array<float,2>{0.0947610587f, 0.715252876f},
-std::array<float,2>{0.152921543f, 0.472615004f},
-std::array<float,2>{0.640277803f, 0.623918474f},
-std::array<float,2>{0.879146993f, 0.225114673f},
-std::array<float,2>{0.424461603f, 0.873582184f},
-std::array<float,2>{0.0207914002f, 0.175591663f},
-std::array<float,2>{0.508543432f, 0.790964484f},
-std::array<float,2>{0.853360891f, 0.430688828f},
-std::array<float,2>{0.36542961f, 0.548890352f},
-std::array<float,2>{0.463308215f, 0.303558856f},
-std::array<float,2>{0.994632125f, 0.637180626f},
-std::array<float,2>{0.725366771f, 0.0632301345f},
-std::array<float,2>{0.189561814f, 0.958289444f},
-std::array<float,2>{0.495580822f, 0.0461184345f},
-std::array<float,2>{0.955450118f, 0.899926424f},
-std::array<float,2>{0.713923693f, 0.332404464f},
-std::array<float,2>{0.230937645f, 0.744874954f},
-std::array<float,2>{0.0431377739f, 0.441084206f},
-std::array<float,2>{0.554025292f, 0.56385392f},
-std::array<float,2>{0.81608057f, 0.217070669f},
-std::array<float,2>{0.338885099f, 0.83665663f},
-std::array<float,2>{0.186322168f, 0.131280437f},
-std::array<float,2>{0.67556715f, 0.778705418f},
-std::array<float,2>{0.927074075f, 0.376129776f},
-std::array<float,2>{0.398777246f, 0.515337527f},
-std::array<float,2>{0.264688611f, 0.274654269f},
-std::array<float,2>{0.810067952f, 0.675564528f},
-std::array<float,2>{0.579012692f, 0.109358996f},
-std::array<float,2>{0.0702582598f, 0.999956012f},
-std::array<float,2>{0.367596835f, 0.245476723f},
-std::array<float,2>{0.844027936f, 0.853103518f},
-std::array<float,2>{0.500473917f, 0.49928391f},
-std::array<float,2>{0.0282333139f, 0.597096026f},
-std::array<float,2>{0.202498943f, 0.349749416f},
-std::array<float,2>{0.732825398f, 0.688402534f},
-std::array<float,2>{0.991652489f, 0.00480728503f},
-std::array<float,2>{0.460873991f, 0.91191411f},
-std::array<float,2>{0.107007578f, 0.0867604986f},
-std::array<float,2>{0.61501044f, 0.94889915f},
-std::array<float,2>{0.779909849f, 0.28172493f},
-std::array<float,2>{0.283609927f, 0.648138523f},
-std::array<float,2>{0.436831832f, 0.418516815f},
-std::array<float,2>{0.886633039f, 0.545433819f},
-std::array<float,2>{0.628894866f, 0.157855839f},
-std::array<float,2>{0.141036868f, 0.804217994f},
-std::array<float,2>{0.380355746f, 0.17582944f},
-std::array<float,2>{0.909488797f, 0.793453693f},
-std::array<float,2>{0.659373522f, 0.436015964f},
-std::array<float,2>{0.159599319f, 0.551077724f},
-std::array<float,2>{0.0916814432f, 0.297245204f},
-std::array<float,2>{0.568624437f, 0.635678828f},
-std::array<float,2>{0.782371461f, 0.0684192777f},
-std::array<float,2>{0.278401822f, 0.955594838f},
-std::array<float,2>{0.242861286f, 0.0202719178f},
-std::array<float,2>{0.702781022f, 0.934468925f},
-std::array<float,2>{0.952131629f, 0.365513206f},
-std::array<float,2>{0.48410517f, 0.712962806f},
-std::array<float,2>{0.319025844f, 0.475686431f},
-std::array<float,2>{0.835982919f, 0.617250562f},
-std::array<float,2>{0.543309271f, 0.219717115f},
-std::array<float,2>{0.0515383184f, 0.869856298f},
-std::array<float,2>{0.297050864f, 0.122282758f},
-std::array<float,2>{0.765145004f, 0.975714445f},
-std::array<float,2>{0.598900914f, 0.257123709f},
-std::array<float,2>{0.117202349f, 0.670536757f},
-std::array<float,2>{0.137325972f, 0.400880575f},
-std::array<float,2>{0.64133662f, 0.522951603f},
-std::array<float,2>{0.890959859f, 0.144367471f},
-std::array<float,2>{0.408173144f, 0.761954963f},
-std::array<float,2>{0.000359162223f, 0.190034971f},
-std::array<float,2>{0.520351946f, 0.818401992f},
-std::array<float,2>{0.869563401f, 0.463501602f},
-std::array<float,2>{0.353383601f, 0.593462884f},
-std::array<float,2>{0.446565777f, 0.312578857f},
-std::array<float,2>{0.98284322f, 0.732023478f},
-std::array<float,2>{0.74868238f, 0.0545260459f},
-std::array<float,2>{0.218573958f, 0.889884412f},
-std::array<float,2>{0.415830582f, 0.0720303133f},
-std::array<float,2>{0.904004812f, 0.965133667f},
-std::array<float,2>{0.648556113f, 0.309130102f},
-std::array<float,2>{0.132497758f, 0.627587497f},
-std::array<float,2>{0.116328932f, 0.428199053f},
-std::array<float,2>{0.607722461f, 0.560437977f},
-std::array<float,2>{0.750638783f, 0.179699436f},
-std::array<float,2>{0.307543844f, 0.783721685f},
-std::array<float,2>{0.203553453f, 0.232629538f},
-std::array<float,2>{0.736932874f, 0.860690653f},
-std::array<float,2>{0.972157419f, 0.479429722f},
-std::array<float,2>{0.445295572f, 0.612882853f},
-std::array<float,2>{0.351533622f, 0.367586344f},
-std::array<float,2>{0.86002928f, 0.705852985f},
-std::array<float,2>{0.526038945f, 0.0308364704f},
-std::array<float,2>{0.00923165306f, 0.925194263f},
-std::array<float,2>{0.267554104f, 0.156196654f},
-std::array<float,2>{0.78963846f, 0.75165081f},
-std::array<float,2>{0.576561928f, 0.397144318f},
-std::array<float,2>{0.0826492012f, 0.528696239f},
-std::array<float,2>{0.168170378f, 0.262371719f},
-std::array<float,2>{0.671070218f, 0.660783112f},
-std::array<float,2>{0.917056441f, 0.116478086f},
-std::array<float,2>{0.384075671f, 0.981069028f},
-std::array<float,2>{0.0602157675f, 0.0559317656f},
-std::array<float,2>{0.536772192f, 0.875671566f},
-std::array<float,2>{0.830996573f, 0.327645361f},
-std::array<float,2>{0.325400233f, 0.720136821f},
-std::array<float,2>{0.473144531f, 0.453511804f},
-std::array<float,2>{0.941721797f, 0.585317791f},
-std::array<float,2>{0.692326963f, 0.196119964f},
-std::array<float,2>{0.241056576f, 0.825718164f},
-std::array<float,2>{0.466380745f, 0.210501224f},
-std::array<float,2>{0.999935031f, 0.831981182f},
-std::array<float,2>{0.719462752f, 0.452868611f},
-std::array<float,2>{0.194099277f, 0.577325583f},
-std::array<float,2>{0.0171826966f, 0.335955679f},
-std::array<float,2>{0.51175189f, 0.73532027f},
-std::array<float,2>{0.858606577f, 0.0345561802f},
-std::array<float,2>{0.363032192f, 0.891165197f},
-std::array<float,2>{0.152237415f, 0.0938638002f},
-std::array<float,2>{0.63369596f, 0.991625845f},
-std::array<float,2>{0.878481746f, 0.271397561f},
-std::array<float,2>{0.42691502f, 0.685231447f},
-std::array<float,2>{0.295989275f, 0.389181882f},
-std::array<float,2>{0.768579125f, 0.503365517f},
-std::array<float,2>{0.620297849f, 0.13999632f},
-std::array<float,2>{0.0997157246f, 0.769220054f},
-std::array<float,2>{0.330822617f, 0.0145379221f},
-std::array<float,2>{0.827817619f, 0.919119954f},
-std::array<float,2>{0.561489403f, 0.354694724f},
-std::array<float,2>{0.0335216038f, 0.695641875f},
-std::array<float,2>{0.218844578f, 0.492014945f},
-std::array<float,2>{0.709901512f, 0.607201695f},
-std::array<float,2>{0.962225974f, 0.239220858f},
-std::array<float,2>{0.490365267f, 0.843994081f},
-std::array<float,2>{0.0768634826f, 0.168212935f},
-std::array<float,2>{0.59140569f, 0.810021877f},
-std::array<float,2>{0.800842643f, 0.412906259f},
-std::array<float,2>{0.25117138f, 0.534928381f},
-std::array<float,2>{0.395430684f, 0.293634385f},
-std::array<float,2>{0.93470937f, 0.648752868f},
-std::array<float,2>{0.682813466f, 0.0803105384f},
-std::array<float,2>{0.173466295f, 0.944532096f},
-std::array<float,2>{0.403994471f, 0.026946485f},
-std::array<float,2>{0.923715115f, 0.927472234f},
-std::array<float,2>{0.677327335f, 0.373413891f},
-std::array<float,2>{0.182555631f, 0.708003581f},
-std::array<float,2>{0.0652008653f, 0.483543009f},
-std::array<float,2>{0.584524035f, 0.617081225f},
-std::array<float,2>{0.805757046f, 0.230233788f},
-std::array<float,2>{0.258037329f, 0.86370039f},
-std::array<float,2>{0.227631897f, 0.18500635f},
-std::array<float,2>{0.715062261f, 0.7870031f},
-std::array<float,2>{0.958405912f, 0.424019575f},
-std::array<float,2>{0.498876959f, 0.557482243f},
-std::array<float,2>{0.342370152f, 0.306780219f},
-std::array<float,2>{0.817072392f, 0.629043162f},
-std::array<float,2>{0.550569534f, 0.0743786693f},
-std::array<float,2>{0.0423612595f, 0.961374283f},
-std::array<float,2>{0.286425382f, 0.199349791f},
-std::array<float,2>{0.77706337f, 0.823087096f},
-std::array<float,2>{0.609614372f, 0.460030407f},
-std::array<float,2>{0.103844091f, 0.578908145f},
-std::array<float,2>{0.146716505f, 0.320328087f},
-std::array<float,2>{0.632413268f, 0.725679696f},
-std::array<float,2>{0.888616443f, 0.0587900206f},
-std::array<float,2>{0.432253003f, 0.881973445f},
-std::array<float,2>{0.0265316516f, 0.110232823f},
-std::array<float,2>{0.507459223f, 0.977273405f},
-std::array<float,2>{0.850211442f, 0.261246383f},
-std::array<float,2>{0.3726089f, 0.659551561f},
-std::array<float,2>{0.45636034f, 0.391650766f},
-std::array<float,2>{0.986096919f, 0.525744379f},
-std::array<float,2>{0.727806747f, 0.149758101f},
-std::array<float,2>{0.199042261f, 0.757629395f},
-std::array<float,2>{0.479638159f, 0.136689946f},
-std::array<float,2>{0.947262585f, 0.770876348f},
-std::array<float,2>{0.697353065f, 0.385834157f},
-std::array<float,2>{0.248084158f, 0.506121039f},
-std::array<float,2>{0.0497011654f, 0.265777528f},
-std::array<float,2>{0.539870024f, 0.679791033f},
-std::array<float,2>{0.842957437f, 0.099993743f},
-std::array<float,2>{0.314160556f, 0.987463176f},
-std::array<float,2>{0.161156878f, 0.0385563299f},
-std::array<float,2>{0.660450339f, 0.896952271f},
-std::array<float,2>{0.912565708f, 0.34093225f},
-std::array<float,2>{0.376722574f, 0.738679409f},
-std::array<float,2>{0.277015001f, 0.446815789f},
-std::array<float,2>{0.786834955f, 0.573186994f},
-std::array<float,2>{0.564763188f, 0.204937071f},
-std::array<float,2>{0.0863744915f, 0.832926691f},
-std::array<float,2>{0.359062105f, 0.082515344f},
-std::array<float,2>{0.873382747f, 0.939111114f},
-std::array<float,2>{0.516219616f, 0.292189509f},
-std::array<float,2>{0.00404480565f, 0.654232323f},
-std::array<float,2>{0.213382721f, 0.407831401f},
-std::array<float,2>{0.743064284f, 0.535573244f},
-std::array<float,2>{0.977747679f, 0.167295218f},
-std::array<float,2>{0.451636255f, 0.80631125f},
-std::array<float,2>{0.123232141f, 0.235167027f},
-std::array<float,2>{0.596943557f, 0.84994024f},
-std::array<float,2>{0.76079005f, 0.484733552f},
-std::array<float,2>{0.303319216f, 0.603622377f},
-std::array<float,2>{0.413930088f, 0.356210321f},
-std::array<float,2>{0.895949483f, 0.701692998f},
-std::array<float,2>{0.645040572f, 0.0105738444f},
-std::array<float,2>{0.132845849f, 0.915855169f},
-std::array<float,2>{0.440846711f, 0.105331898f},
-std::array<float,2>{0.976124823f, 0.992687821f},
-std::array<float,2>{0.738526106f, 0.279712915f},
-std::array<float,2>{0.208085045f, 0.678706169f},
-std::array<float,2>{0.0123700211f, 0.379074156f},
-std::array<float,2>{0.527495384f, 0.511000216f},
-std::array<float,2>{0.865985751f, 0.128830791f},
-std::array<float,2>{0.346041054f, 0.774331808f},
-std::array<float,2>{0.126676679f, 0.212189302f},
-std::array<float,2>{0.653947532f, 0.84280926f},
-std::array<float,2>{0.901286781f, 0.441853344f},
-std::array<float,2>{0.419884533f, 0.566851735f},
-std::array<float,2>{0.30950582f, 0.328296542f},
-std::array<float,2>{0.757207513f, 0.748384893f},
-std::array<float,2>{0.604087591f, 0.0422313958f},
-std::array<float,2>{0.11166352f, 0.905643165f},
-std::array<float,2>{0.320711344f, 0.16176115f},
-std::array<float,2>{0.833530188f, 0.797550738f},
-std::array<float,2>{0.53377372f, 0.415960997f},
-std::array<float,2>{0.0570645966f, 0.54081732f},
-std::array<float,2>{0.234564215f, 0.287548572f},
-std::array<float,2>{0.688434303f, 0.644398928f},
-std::array<float,2>{0.937941551f, 0.0903410614f},
-std::array<float,2>{0.471007615f, 0.949907601f},
-std::array<float,2>{0.0795282796f, 0.000894636905f},
-std::array<float,2>{0.57034874f, 0.909107625f},
-std::array<float,2>{0.796366155f, 0.346382231f},
-std::array<float,2>{0.273430228f, 0.694270074f},
-std::array<float,2>{0.389888614f, 0.494506747f},
-std::array<float,2>{0.919230998f, 0.597936928f},
-std::array<float,2>{0.667647302f, 0.248619556f},
-std::array<float,2>{0.165515572f, 0.856172264f},
-std::array<float,2>{0.422058105f, 0.224590331f},
-std::array<float,2>{0.882629037f, 0.872928798f},
-std::array<float,2>{0.637098551f, 0.470683604f},
-std::array<float,2>{0.154374868f, 0.621834636f},
-std::array<float,2>{0.0966089293f, 0.362816036f},
-std::array<float,2>{0.62115097f, 0.716998994f},
-std::array<float,2>{0.772868454f, 0.0181214437f},
-std::array<float,2>{0.291815311f, 0.930314958f},
-std::array<float,2>{0.187960997f, 0.0649120212f},
-std::array<float,2>{0.722726643f, 0.960153818f},
-std::array<float,2>{0.993945897f, 0.302656531f},
-std::array<float,2>{0.462554246f, 0.639231503f},
-std::array<float,2>{0.363925546f, 0.432940692f},
-std::array<float,2>{0.854831636f, 0.546931267f},
-std::array<float,2>{0.509810805f, 0.172852099f},
-std::array<float,2>{0.0219875816f, 0.791151464f},
-std::array<float,2>{0.253968656f, 0.0470028035f},
-std::array<float,2>{0.798880994f, 0.883088887f},
-std::array<float,2>{0.587801814f, 0.316695511f},
-std::array<float,2>{0.0719267502f, 0.730336726f},
-std::array<float,2>{0.177591398f, 0.465427935f},
-std::array<float,2>{0.686743736f, 0.589341581f},
-std::array<float,2>{0.930388331f, 0.194387302f},
-std::array<float,2>{0.391517043f, 0.813702822f},
-std::array<float,2>{0.0375406221f, 0.144732133f},
-std::array<float,2>{0.557093322f, 0.759033561f},
-std::array<float,2>{0.82053417f, 0.403482765f},
-std::array<float,2>{0.335485607f, 0.518457174f},
-std::array<float,2>{0.486579806f, 0.251519412f},
-std::array<float,2>{0.965681255f, 0.666327477f},
-std::array<float,2>{0.707029581f, 0.120961197f},
-std::array<float,2>{0.222871006f, 0.970909417f},
-std::array<float,2>{0.482902706f, 0.0219174009f},
-std::array<float,2>{0.952469051f, 0.936888516f},
-std::array<float,2>{0.701466382f, 0.363909245f},
-std::array<float,2>{0.243913129f, 0.711893737f},
-std::array<float,2>{0.0519065671f, 0.473935843f},
-std::array<float,2>{0.544062138f, 0.619429529f},
-std::array<float,2>{0.837759554f, 0.221150041f},
-std::array<float,2>{0.320201188f, 0.867636621f},
-std::array<float,2>{0.158515021f, 0.179411083f},
-std::array<float,2>{0.65883863f, 0.796042502f},
-std::array<float,2>{0.90882349f, 0.435511529f},
-std::array<float,2>{0.379181445f, 0.553173244f},
-std::array<float,2>{0.277552098f, 0.300760061f},
-std::array<float,2>{0.781530738f, 0.634091556f},
-std::array<float,2>{0.57009083f, 0.0666064247f},
-std::array<float,2>{0.0906216279f, 0.953185141f},
-std::array<float,2>{0.352025777f, 0.188262507f},
-std::array<float,2>{0.870242715f, 0.816784918f},
-std::array<float,2>{0.521445751f, 0.462650359f},
-std::array<float,2>{0.00189692643f, 0.589844048f},
-std::array<float,2>{0.217183217f, 0.31569466f},
-std::array<float,2>{0.749719679f, 0.732510805f},
-std::array<float,2>{0.983813167f, 0.0514497645f},
-std::array<float,2>{0.44560954f, 0.887733459f},
-std::array<float,2>{0.118354924f, 0.123767197f},
-std::array<float,2>{0.597738326f, 0.97339946f},
-std::array<float,2>{0.764114857f, 0.255046338f},
-std::array<float,2>{0.298378259f, 0.66850853f},
-std::array<float,2>{0.406359911f, 0.399651557f},
-std::array<float,2>{0.892009139f, 0.520826697f},
-std::array<float,2>{0.642213583f, 0.142312109f},
-std::array<float,2>{0.138400167f, 0.764645278f},
-std::array<float,2>{0.39977926f, 0.130127892f},
-std::array<float,2>{0.926106989f, 0.780307233f},
-std::array<float,2>{0.674615741f, 0.377838045f},
-std::array<float,2>{0.186893225f, 0.513662219f},
-std::array<float,2>{0.0686884001f, 0.275790483f},
-std::array<float,2>{0.579927564f, 0.673040628f},
-std::array<float,2>{0.809492826f, 0.106870994f},
-std::array<float,2>{0.264471352f, 0.996851742f},
-std::array<float,2>{0.231910378f, 0.0444577932f},
-std::array<float,2>{0.713086069f, 0.900534511f},
-std::array<float,2>{0.956698895f, 0.335836291f},
-std::array<float,2>{0.49454546f, 0.743291676f},
-std::array<float,2>{0.337968737f, 0.438675046f},
-std::array<float,2>{0.815006912f, 0.565772176f},
-std::array<float,2>{0.553368032f, 0.215190917f},
-std::array<float,2>{0.0440808423f, 0.838708222f},
-std::array<float,2>{0.284593761f, 0.0895869955f},
-std::array<float,2>{0.781163335f, 0.946983159f},
-std::array<float,2>{0.613318145f, 0.285142928f},
-std::array<float,2>{0.105690405f, 0.646134257f},
-std::array<float,2>{0.141995579f, 0.420693755f},
-std::array<float,2>{0.627637148f, 0.543792546f},
-std::array<float,2>{0.885354102f, 0.159963965f},
-std::array<float,2>{0.436112463f, 0.802445889f},
-std::array<float,2>{0.0290182475f, 0.242816135f},
-std::array<float,2>{0.501825333f, 0.854983032f},
-std::array<float,2>{0.845456243f, 0.496749938f},
-std::array<float,2>{0.368176311f, 0.594840765f},
-std::array<float,2>{0.459808707f, 0.348065168f},
-std::array<float,2>{0.990400851f, 0.690661728f},
-std::array<float,2>{0.734239519f, 0.00712342234f},
-std::array<float,2>{0.201328889f, 0.912875414f},
-std::array<float,2>{0.426731974f, 0.0963845924f},
-std::array<float,2>{0.877660871f, 0.989204764f},
-std::array<float,2>{0.634713233f, 0.272753268f},
-std::array<float,2>{0.15081124f, 0.686300218f},
-std::array<float,2>{0.101170599f, 0.386763602f},
-std::array<float,2>{0.619192958f, 0.500103533f},
-std::array<float,2>{0.767734468f, 0.137995347f},
-std::array<float,2>{0.295369864f, 0.765852153f},
-std::array<float,2>{0.194755271f, 0.208970547f},
-std::array<float,2>{0.720192552f, 0.829266489f},
-std::array<float,2>{0.998380244f, 0.450859487f},
-std::array<float,2>{0.465771168f, 0.576082468f},
-std::array<float,2>{0.362088799f, 0.33854264f},
-std::array<float,2>{0.858042955f, 0.73723644f},
-std::array<float,2>{0.513488233f, 0.0330680758f},
-std::array<float,2>{0.0158081204f, 0.894441128f},
-std::array<float,2>{0.250499427f, 0.170340955f},
-std::array<float,2>{0.801762164f, 0.811712503f},
-std::array<float,2>{0.590346456f, 0.411152244f},
-std::array<float,2>{0.0776703283f, 0.532804906f},
-std::array<float,2>{0.172705963f, 0.295335561f},
-std::array<float,2>{0.682260931f, 0.651792765f},
-std::array<float,2>{0.933932722f, 0.0789825022f},
-std::array<float,2>{0.395653546f, 0.942533374f},
-std::array<float,2>{0.0343796313f, 0.0119023854f},
-std::array<float,2>{0.562385798f, 0.920238078f},
-std::array<float,2>{0.826974928f, 0.351900756f},
-std::array<float,2>{0.331885755f, 0.698834419f},
-std::array<float,2>{0.49173972f, 0.489344358f},
-std::array<float,2>{0.961701691f, 0.609265149f},
-std::array<float,2>{0.710565865f, 0.241015628f},
-std::array<float,2>{0.219801217f, 0.846693933f},
-std::array<float,2>{0.443601012f, 0.232172787f},
-std::array<float,2>{0.971531391f, 0.861829758f},
-std::array<float,2>{0.73798883f, 0.477826327f},
-std::array<float,2>{0.204503596f, 0.6101529f},
-std::array<float,2>{0.00793177541f, 0.36930117f},
-std::array<float,2>{0.526462674f, 0.703337252f},
-std::array<float,2>{0.860718131f, 0.0274405032f},
-std::array<float,2>{0.349777937f, 0.92362076f},
-std::array<float,2>{0.130872026f, 0.0741095766f},
-std::array<float,2>{0.649818838f, 0.967814803f},
-std::array<float,2>{0.903056026f, 0.312088013f},
-std::array<float,2>{0.414881736f, 0.625791311f},
-std::array<float,2>{0.307692319f, 0.425914168f},
-std::array<float,2>{0.751266897f, 0.562031865f},
-std::array<float,2>{0.608454704f, 0.183216229f},
-std::array<float,2>{0.116180845f, 0.782964706f},
-std::array<float,2>{0.324806988f, 0.0575190671f},
-std::array<float,2>{0.831674159f, 0.877372265f},
-std::array<float,2>{0.535310149f, 0.325077176f},
-std::array<float,2>{0.0591524057f, 0.721777618f},
-std::array<float,2>{0.242117271f, 0.456636161f},
-std::array<float,2>{0.693110704f, 0.582634568f},
-std::array<float,2>{0.94314611f, 0.19920969f},
-std::array<float,2>{0.474164665f, 0.827555239f},
-std::array<float,2>{0.0837680176f, 0.15351288f},
-std::array<float,2>{0.577178478f, 0.753348827f},
-std::array<float,2>{0.790089726f, 0.395682126f},
-std::array<float,2>{0.266549408f, 0.530044377f},
-std::array<float,2>{0.383513987f, 0.265220135f},
-std::array<float,2>{0.916892767f, 0.663020074f},
-std::array<float,2>{0.670022249f, 0.114465609f},
-std::array<float,2>{0.169105276f, 0.98300153f},
-std::array<float,2>{0.375014544f, 0.0369055681f},
-std::array<float,2>{0.913885653f, 0.896283269f},
-std::array<float,2>{0.66139394f, 0.342765063f},
-std::array<float,2>{0.160602659f, 0.741496801f},
-std::array<float,2>{0.0876293704f, 0.448617071f},
-std::array<float,2>{0.565940857f, 0.570617318f},
-std::array<float,2>{0.785727322f, 0.205991134f},
-std::array<float,2>{0.275520921f, 0.834822893f},
-std::array<float,2>{0.249752134f, 0.134234622f},
-std::array<float,2>{0.698696971f, 0.772765696f},
-std::array<float,2>{0.945649564f, 0.383676201f},
-std::array<float,2>{0.479151696f, 0.505622029f},
-std::array<float,2>{0.313469291f, 0.268783778f},
-std::array<float,2>{0.84182018f, 0.682314396f},
-std::array<float,2>{0.540386677f, 0.0993990526f},
-std::array<float,2>{0.0505747758f, 0.985823214f},
-std::array<float,2>{0.304472953f, 0.236800686f},
-std::array<float,2>{0.760219693f, 0.849185705f},
-std::array<float,2>{0.595791996f, 0.486567885f},
-std::array<float,2>{0.12488243f, 0.603176057f},
-std::array<float,2>{0.134641975f, 0.358244151f},
-std::array<float,2>{0.646418452f, 0.701056361f},
-std::array<float,2>{0.894985497f, 0.00882447604f},
-std::array<float,2>{0.412583858f, 0.916944683f},
-std::array<float,2>{0.00570689514f, 0.0856509879f},
-std::array<float,2>{0.516923368f, 0.941011012f},
-std::array<float,2>{0.874089777f, 0.290952712f},
-std::array<float,2>{0.358102709f, 0.655608654f},
-std::array<float,2>{0.452435374f, 0.409387827f},
-std::array<float,2>{0.976645172f, 0.538713157f},
-std::array<float,2>{0.74405539f, 0.165012196f},
-std::array<float,2>{0.214136392f, 0.80822438f},
-std::array<float,2>{0.499646276f, 0.186554044f},
-std::array<float,2>{0.957356036f, 0.788906276f},
-std::array<float,2>{0.716053486f, 0.422361642f},
-std::array<float,2>{0.227014691f, 0.555876434f},
-std::array<float,2>{0.0410997681f, 0.306044042f},
-std::array<float,2>{0.549501359f, 0.632465541f},
-std::array<float,2>{0.818035483f, 0.0762816891f},
-std::array<float,2>{0.34353143f, 0.964449763f},
-std::array<float,2>{0.182927608f, 0.0241239201f},
-std::array<float,2>{0.676305354f, 0.928538859f},
-std::array<float,2>{0.922763884f, 0.372194707f},
-std::array<float,2>{0.403066486f, 0.709639251f},
-std::array<float,2>{0.259011745f, 0.481899947f},
-std::array<float,2>{0.804713905f, 0.614155471f},
-std::array<float,2>{0.585705817f, 0.227443904f},
-std::array<float,2>{0.0662302375f, 0.866344094f},
-std::array<float,2>{0.37168479f, 0.112123504f},
-std::array<float,2>{0.851359308f, 0.979019701f},
-std::array<float,2>{0.506810963f, 0.257812649f},
-std::array<float,2>{0.0263355393f, 0.656936467f},
-std::array<float,2>{0.19757919f, 0.39407286f},
-std::array<float,2>{0.726619065f, 0.524469435f},
-std::array<float,2>{0.984902322f, 0.151886851f},
-std::array<float,2>{0.455472827f, 0.755807459f},
-std::array<float,2>{0.105274931f, 0.20138751f},
-std::array<float,2>{0.611043811f, 0.820549607f},
-std::array<float,2>{0.775957346f, 0.458083749f},
-std::array<float,2>{0.285704494f, 0.581362665f},
-std::array<float,2>{0.432746768f, 0.324106365f},
-std::array<float,2>{0.887111545f, 0.724340737f},
-std::array<float,2>{0.630929351f, 0.0606346056f},
-std::array<float,2>{0.147915825f, 0.879660726f},
-std::array<float,2>{0.461417854f, 0.0635767952f},
-std::array<float,2>{0.993087828f, 0.957966566f},
-std::array<float,2>{0.723855972f, 0.304388493f},
-std::array<float,2>{0.188910306f, 0.637723744f},
-std::array<float,2>{0.0227856543f, 0.430175632f},
-std::array<float,2>{0.510858476f, 0.550471604f},
-std::array<float,2>{0.853699923f, 0.174173072f},
-std::array<float,2>{0.365160227f, 0.789177895f},
-std::array<float,2>{0.155278891f, 0.225901812f},
-std::array<float,2>{0.637843311f, 0.874457598f},
-std::array<float,2>{0.881303132f, 0.470721006f},
-std::array<float,2>{0.423304349f, 0.624330342f},
-std::array<float,2>{0.292028189f, 0.360165f},
-std::array<float,2>{0.77169627f, 0.716640055f},
-std::array<float,2>{0.622291088f, 0.0168987662f},
-std::array<float,2>{0.0974366814f, 0.932668746f},
-std::array<float,2>{0.334682941f, 0.146671996f},
-std::array<float,2>{0.82144773f, 0.759934962f},
-std::array<float,2>{0.557789624f, 0.40536356f},
-std::array<float,2>{0.0385498703f, 0.517120242f},
-std::array<float,2>{0.22388275f, 0.253599912f},
-std::array<float,2>{0.705193043f, 0.664711535f},
-std::array<float,2>{0.966204464f, 0.118272491f},
-std::array<float,2>{0.487819582f, 0.969118655f},
-std::array<float,2>{0.0712851062f, 0.0502109528f},
-std::array<float,2>{0.586895525f, 0.886504591f},
-std::array<float,2>{0.800261796f, 0.319392502f},
-std::array<float,2>{0.255054802f, 0.728407323f},
-std::array<float,2>{0.392313927f, 0.467822999f},
-std::array<float,2>{0.930754304f, 0.586300969f},
-std::array<float,2>{0.686510861f, 0.19232896f},
-std::array<float,2>{0.176510036f, 0.816065907f},
-std::array<float,2>{0.418394536f, 0.214630529f},
-std::array<float,2>{0.901730597f, 0.840253174f},
-std::array<float,2>{0.653098762f, 0.443546683f},
-std::array<float,2>{0.125154674f, 0.568404913f},
-std::array<float,2>{0.112671211f, 0.33017084f},
-std::array<float,2>{0.605299711f, 0.747121036f},
-std::array<float,2>{0.755986631f, 0.039648585f},
-std::array<float,2>{0.310168475f, 0.903873086f},
-std::array<float,2>{0.207384005f, 0.103411026f},
-std::array<float,2>{0.739589989f, 0.99521178f},
-std::array<float,2>{0.975327551f, 0.277779609f},
-std::array<float,2>{0.439487487f, 0.676552176f},
-std::array<float,2>{0.347337306f, 0.381467223f},
-std::array<float,2>{0.867066443f, 0.508099079f},
-std::array<float,2>{0.528655231f, 0.125624016f},
-std::array<float,2>{0.0128529826f, 0.776604712f},
-std::array<float,2>{0.271714747f, 0.00318867317f},
-std::array<float,2>{0.795366526f, 0.907819033f},
-std::array<float,2>{0.571741164f, 0.345643342f},
-std::array<float,2>{0.0781778395f, 0.692686558f},
-std::array<float,2>{0.164184883f, 0.492975116f},
-std::array<float,2>{0.666615248f, 0.60122472f},
-std::array<float,2>{0.918032527f, 0.247914642f},
-std::array<float,2>{0.389395118f, 0.859173298f},
-std::array<float,2>{0.0580573454f, 0.162151292f},
-std::array<float,2>{0.534303665f, 0.800710976f},
-std::array<float,2>{0.832797348f, 0.417133301f},
-std::array<float,2>{0.322141141f, 0.541917026f},
-std::array<float,2>{0.471774727f, 0.286768883f},
-std::array<float,2>{0.939255536f, 0.64076674f},
-std::array<float,2>{0.688943624f, 0.0936747342f},
-std::array<float,2>{0.235506356f, 0.952269197f},
-std::array<float,2>{0.447467685f, 0.0533332266f},
-std::array<float,2>{0.982246697f, 0.889556348f},
-std::array<float,2>{0.746558487f, 0.314263105f},
-std::array<float,2>{0.216531485f, 0.73119092f},
-std::array<float,2>{0.0031026674f, 0.464408696f},
-std::array<float,2>{0.523153245f, 0.59216696f},
-std::array<float,2>{0.8688007f, 0.191205069f},
-std::array<float,2>{0.353637099f, 0.820263863f},
-std::array<float,2>{0.140608132f, 0.143314525f},
-std::array<float,2>{0.64319241f, 0.763085544f},
-std::array<float,2>{0.893838644f, 0.402234524f},
-std::array<float,2>{0.408508211f, 0.522460043f},
-std::array<float,2>{0.299793869f, 0.256415784f},
-std::array<float,2>{0.762646854f, 0.671323836f},
-std::array<float,2>{0.600245833f, 0.121638112f},
-std::array<float,2>{0.119516484f, 0.97511375f},
-std::array<float,2>{0.3166233f, 0.219761059f},
-std::array<float,2>{0.838386536f, 0.87080729f},
-std::array<float,2>{0.546147287f, 0.475169152f},
-std::array<float,2>{0.0542591549f, 0.618251741f},
-std::array<float,2>{0.245014548f, 0.367156714f},
-std::array<float,2>{0.700954497f, 0.714721143f},
-std::array<float,2>{0.949625015f, 0.0207326375f},
-std::array<float,2>{0.481986851f, 0.935142279f},
-std::array<float,2>{0.0918237492f, 0.0698437169f},
-std::array<float,2>{0.56706655f, 0.956235886f},
-std::array<float,2>{0.784880996f, 0.298122495f},
-std::array<float,2>{0.280932605f, 0.636620402f},
-std::array<float,2>{0.381387025f, 0.436703652f},
-std::array<float,2>{0.906848371f, 0.552308738f},
-std::array<float,2>{0.657359064f, 0.177477419f},
-std::array<float,2>{0.158201084f, 0.794671893f},
-std::array<float,2>{0.434690267f, 0.156721503f},
-std::array<float,2>{0.884013236f, 0.80296576f},
-std::array<float,2>{0.626907945f, 0.419843554f},
-std::array<float,2>{0.14264001f, 0.546785533f},
-std::array<float,2>{0.107795268f, 0.282805055f},
-std::array<float,2>{0.615652144f, 0.647180736f},
-std::array<float,2>{0.777560771f, 0.0869406387f},
-std::array<float,2>{0.282657474f, 0.947789907f},
-std::array<float,2>{0.200731739f, 0.00544715626f},
-std::array<float,2>{0.730874717f, 0.910720944f},
-std::array<float,2>{0.989904821f, 0.350862086f},
-std::array<float,2>{0.458914191f, 0.689307868f},
-std::array<float,2>{0.370324463f, 0.498665541f},
-std::array<float,2>{0.846797049f, 0.596258938f},
-std::array<float,2>{0.502167821f, 0.245075047f},
-std::array<float,2>{0.0300874785f, 0.852287591f},
-std::array<float,2>{0.26322493f, 0.107957572f},
-std::array<float,2>{0.810792089f, 0.998499572f},
-std::array<float,2>{0.581694961f, 0.273959756f},
-std::array<float,2>{0.067857109f, 0.674444377f},
-std::array<float,2>{0.184001803f, 0.375361085f},
-std::array<float,2>{0.672204733f, 0.514269233f},
-std::array<float,2>{0.929430544f, 0.132028952f},
-std::array<float,2>{0.400470197f, 0.778047383f},
-std::array<float,2>{0.0462410152f, 0.217819631f},
-std::array<float,2>{0.55107075f, 0.837817788f},
-std::array<float,2>{0.814029992f, 0.439686507f},
-std::array<float,2>{0.337126672f, 0.562699199f},
-std::array<float,2>{0.494140089f, 0.333657652f},
-std::array<float,2>{0.954979181f, 0.745567918f},
-std::array<float,2>{0.711269319f, 0.0449452959f},
-std::array<float,2>{0.233319804f, 0.899117947f},
-std::array<float,2>{0.3982912f, 0.0812363625f},
-std::array<float,2>{0.936222732f, 0.943984926f},
-std::array<float,2>{0.679878891f, 0.294107735f},
-std::array<float,2>{0.175107405f, 0.650128126f},
-std::array<float,2>{0.0748649985f, 0.413375258f},
-std::array<float,2>{0.593461633f, 0.533795893f},
-std::array<float,2>{0.803062618f, 0.169835851f},
-std::array<float,2>{0.252586573f, 0.808871448f},
-std::array<float,2>{0.221350089f, 0.23940441f},
-std::array<float,2>{0.707735717f, 0.845190227f},
-std::array<float,2>{0.964590132f, 0.491025388f},
-std::array<float,2>{0.490078986f, 0.605596304f},
-std::array<float,2>{0.329460353f, 0.354168236f},
-std::array<float,2>{0.824840426f, 0.69664818f},
-std::array<float,2>{0.558738291f, 0.0150534753f},
-std::array<float,2>{0.0329571404f, 0.91841203f},
-std::array<float,2>{0.293059617f, 0.139619336f},
-std::array<float,2>{0.76585561f, 0.768094659f},
-std::array<float,2>{0.617553234f, 0.389888853f},
-std::array<float,2>{0.0993521884f, 0.502000213f},
-std::array<float,2>{0.149721429f, 0.269910038f},
-std::array<float,2>{0.635996699f, 0.684092581f},
-std::array<float,2>{0.876363873f, 0.0951499194f},
-std::array<float,2>{0.428683579f, 0.990750432f},
-std::array<float,2>{0.0186761189f, 0.0333475918f},
-std::array<float,2>{0.514246941f, 0.891730487f},
-std::array<float,2>{0.857072532f, 0.337286949f},
-std::array<float,2>{0.360872179f, 0.735726774f},
-std::array<float,2>{0.468311757f, 0.451446086f},
-std::array<float,2>{0.996915042f, 0.576447487f},
-std::array<float,2>{0.721323609f, 0.209878922f},
-std::array<float,2>{0.193171874f, 0.830326259f},
-std::array<float,2>{0.475474805f, 0.1963211f},
-std::array<float,2>{0.944424629f, 0.824951053f},
-std::array<float,2>{0.694842696f, 0.454901367f},
-std::array<float,2>{0.238481954f, 0.584908545f},
-std::array<float,2>{0.0607963726f, 0.326389819f},
-std::array<float,2>{0.537880719f, 0.719266117f},
-std::array<float,2>{0.828341603f, 0.0549697913f},
-std::array<float,2>{0.327859938f, 0.876361668f},
-std::array<float,2>{0.171776846f, 0.11566022f},
-std::array<float,2>{0.668255389f, 0.981860757f},
-std::array<float,2>{0.914552152f, 0.26313585f},
-std::array<float,2>{0.385715038f, 0.661875188f},
-std::array<float,2>{0.268612087f, 0.397545427f},
-std::array<float,2>{0.7922737f, 0.527880251f},
-std::array<float,2>{0.574284017f, 0.154876664f},
-std::array<float,2>{0.0842705071f, 0.750019968f},
-std::array<float,2>{0.34853375f, 0.0293026734f},
-std::array<float,2>{0.862071931f, 0.924675822f},
-std::array<float,2>{0.52508229f, 0.36844945f},
-std::array<float,2>{0.0100893984f, 0.706940114f},
-std::array<float,2>{0.205370143f, 0.479892522f},
-std::array<float,2>{0.735582829f, 0.611442506f},
-std::array<float,2>{0.970083296f, 0.233873829f},
-std::array<float,2>{0.443169802f, 0.859838903f},
-std::array<float,2>{0.114133969f, 0.181036055f},
-std::array<float,2>{0.605548263f, 0.784230232f},
-std::array<float,2>{0.752295196f, 0.429334313f},
-std::array<float,2>{0.306065351f, 0.559037507f},
-std::array<float,2>{0.416431248f, 0.310337812f},
-std::array<float,2>{0.9054811f, 0.62835604f},
-std::array<float,2>{0.650729418f, 0.0707468465f},
-std::array<float,2>{0.129440904f, 0.96643281f},
-std::array<float,2>{0.412056774f, 0.0111547569f},
-std::array<float,2>{0.896934867f, 0.914359748f},
-std::array<float,2>{0.646502435f, 0.356808007f},
-std::array<float,2>{0.136173815f, 0.702677786f},
-std::array<float,2>{0.121746324f, 0.48616147f},
-std::array<float,2>{0.595283449f, 0.604553044f},
-std::array<float,2>{0.759135008f, 0.236181319f},
-std::array<float,2>{0.302002251f, 0.851093531f},
-std::array<float,2>{0.212034181f, 0.166680709f},
-std::array<float,2>{0.745628715f, 0.804964602f},
-std::array<float,2>{0.979866505f, 0.406873345f},
-std::array<float,2>{0.449416488f, 0.536293805f},
-std::array<float,2>{0.35562855f, 0.291877657f},
-std::array<float,2>{0.871991813f, 0.653224528f},
-std::array<float,2>{0.517955244f, 0.0832072422f},
-std::array<float,2>{0.0058879205f, 0.93840307f},
-std::array<float,2>{0.274751604f, 0.203468412f},
-std::array<float,2>{0.788216949f, 0.833962142f},
-std::array<float,2>{0.56333071f, 0.44612515f},
-std::array<float,2>{0.0885851756f, 0.573766708f},
-std::array<float,2>{0.163087308f, 0.340010434f},
-std::array<float,2>{0.662510216f, 0.740035892f},
-std::array<float,2>{0.911236465f, 0.037832085f},
-std::array<float,2>{0.377838224f, 0.89806515f},
-std::array<float,2>{0.0478267521f, 0.101160236f},
-std::array<float,2>{0.541986763f, 0.987299085f},
-std::array<float,2>{0.841688395f, 0.267447501f},
-std::array<float,2>{0.315870076f, 0.681511462f},
-std::array<float,2>{0.47848466f, 0.385147154f},
-std::array<float,2>{0.948544383f, 0.507207572f},
-std::array<float,2>{0.696108639f, 0.135408685f},
-std::array<float,2>{0.247646108f, 0.77004081f},
-std::array<float,2>{0.453232616f, 0.14916788f},
-std::array<float,2>{0.986794829f, 0.756015062f},
-std::array<float,2>{0.730392635f, 0.391177982f},
-std::array<float,2>{0.195547402f, 0.526413739f},
-std::array<float,2>{0.0248119179f, 0.259862274f},
-std::array<float,2>{0.504223764f, 0.658207417f},
-std::array<float,2>{0.848951221f, 0.110964537f},
-std::array<float,2>{0.373689443f, 0.978124797f},
-std::array<float,2>{0.14538306f, 0.0599367358f},
-std::array<float,2>{0.629404366f, 0.881176472f},
-std::array<float,2>{0.889198065f, 0.322015613f},
-std::array<float,2>{0.430176109f, 0.724942207f},
-std::array<float,2>{0.287627369f, 0.459671319f},
-std::array<float,2>{0.774034798f, 0.57985574f},
-std::array<float,2>{0.612972736f, 0.200699314f},
-std::array<float,2>{0.10227713f, 0.823329806f},
-std::array<float,2>{0.341772825f, 0.075427562f},
-std::array<float,2>{0.818441629f, 0.96211946f},
-std::array<float,2>{0.548446059f, 0.307856888f},
-std::array<float,2>{0.0399274565f, 0.630671322f},
-std::array<float,2>{0.228953034f, 0.425398022f},
-std::array<float,2>{0.717067778f, 0.558243513f},
-std::array<float,2>{0.959121823f, 0.183684781f},
-std::array<float,2>{0.496802688f, 0.785214484f},
-std::array<float,2>{0.0631422028f, 0.228781074f},
-std::array<float,2>{0.582921505f, 0.864669919f},
-std::array<float,2>{0.80791676f, 0.482926369f},
-std::array<float,2>{0.260656387f, 0.615261316f},
-std::array<float,2>{0.404931813f, 0.374188662f},
-std::array<float,2>{0.925662816f, 0.708300829f},
-std::array<float,2>{0.679561198f, 0.0261151716f},
-std::array<float,2>{0.181626365f, 0.926428378f},
-std::array<float,2>{0.485851288f, 0.119372003f},
-std::array<float,2>{0.96743238f, 0.971773446f},
-std::array<float,2>{0.704421818f, 0.250449657f},
-std::array<float,2>{0.224956945f, 0.667216241f},
-std::array<float,2>{0.036433395f, 0.403141171f},
-std::array<float,2>{0.555583894f, 0.518796563f},
-std::array<float,2>{0.823309064f, 0.145685047f},
-std::array<float,2>{0.333222389f, 0.758311689f},
-std::array<float,2>{0.179094478f, 0.194058999f},
-std::array<float,2>{0.684403479f, 0.812545538f},
-std::array<float,2>{0.933343947f, 0.466302544f},
-std::array<float,2>{0.392712891f, 0.588548005f},
-std::array<float,2>{0.255921751f, 0.31769219f},
-std::array<float,2>{0.797706187f, 0.728790164f},
-std::array<float,2>{0.588150084f, 0.0484798141f},
-std::array<float,2>{0.0741377622f, 0.884594977f},
-std::array<float,2>{0.36658904f, 0.172172517f},
-std::array<float,2>{0.852351904f, 0.792485356f},
-std::array<float,2>{0.50892359f, 0.432377577f},
-std::array<float,2>{0.0203564577f, 0.547904372f},
-std::array<float,2>{0.191215947f, 0.301565021f},
-std::array<float,2>{0.725788593f, 0.640046299f},
-std::array<float,2>{0.995892286f, 0.0663850084f},
-std::array<float,2>{0.46391505f, 0.959335744f},
-std::array<float,2>{0.0942016318f, 0.0193182249f},
-std::array<float,2>{0.623848677f, 0.931310952f},
-std::array<float,2>{0.770221233f, 0.361348242f},
-std::array<float,2>{0.290310264f, 0.717995822f},
-std::array<float,2>{0.425740898f, 0.469531298f},
-std::array<float,2>{0.88032943f, 0.622995615f},
-std::array<float,2>{0.639368474f, 0.223510176f},
-std::array<float,2>{0.153858572f, 0.871684909f},
-std::array<float,2>{0.387928367f, 0.24978359f},
-std::array<float,2>{0.920396268f, 0.857224107f},
-std::array<float,2>{0.664230704f, 0.495874405f},
-std::array<float,2>{0.167438418f, 0.598669589f},
-std::array<float,2>{0.0807689503f, 0.347246975f},
-std::array<float,2>{0.573669016f, 0.694490552f},
-std::array<float,2>{0.79301703f, 0.00127484405f},
-std::array<float,2>{0.270586252f, 0.909201503f},
-std::array<float,2>{0.237473711f, 0.0910757184f},
-std::array<float,2>{0.690324903f, 0.950434744f},
-std::array<float,2>{0.940771401f, 0.288428634f},
-std::array<float,2>{0.469165862f, 0.642873287f},
-std::array<float,2>{0.323543757f, 0.4150289f},
-std::array<float,2>{0.834780097f, 0.539797843f},
-std::array<float,2>{0.532803833f, 0.160200432f},
-std::array<float,2>{0.055435773f, 0.798811436f},
-std::array<float,2>{0.311880469f, 0.0410540625f},
-std::array<float,2>{0.754212856f, 0.905200303f},
-std::array<float,2>{0.601563036f, 0.32964924f},
-std::array<float,2>{0.109986216f, 0.749744117f},
-std::array<float,2>{0.127218217f, 0.44297877f},
-std::array<float,2>{0.654351056f, 0.567506671f},
-std::array<float,2>{0.899307787f, 0.210990176f},
-std::array<float,2>{0.421704262f, 0.841814041f},
-std::array<float,2>{0.0142245386f, 0.127071828f},
-std::array<float,2>{0.53122896f, 0.774919271f},
-std::array<float,2>{0.864490747f, 0.380726218f},
-std::array<float,2>{0.344670773f, 0.510412753f},
-std::array<float,2>{0.438515574f, 0.280463964f},
-std::array<float,2>{0.974273324f, 0.679674625f},
-std::array<float,2>{0.741388261f, 0.104102127f},
-std::array<float,2>{0.21030058f, 0.99392122f},
-std::array<float,2>{0.442474365f, 0.0281835478f},
-std::array<float,2>{0.970639884f, 0.923320532f},
-std::array<float,2>{0.736131608f, 0.369686723f},
-std::array<float,2>{0.206023499f, 0.703783631f},
-std::array<float,2>{0.0104429489f, 0.478358418f},
-std::array<float,2>{0.524544418f, 0.609790564f},
-std::array<float,2>{0.861747384f, 0.231568351f},
-std::array<float,2>{0.348075271f, 0.861460447f},
-std::array<float,2>{0.129003465f, 0.182798028f},
-std::array<float,2>{0.651089072f, 0.782441974f},
-std::array<float,2>{0.905823112f, 0.42633763f},
-std::array<float,2>{0.416767955f, 0.561973989f},
-std::array<float,2>{0.306513458f, 0.311559558f},
-std::array<float,2>{0.752702296f, 0.62529856f},
-std::array<float,2>{0.606025994f, 0.0732427835f},
-std::array<float,2>{0.113333665f, 0.968689442f},
-std::array<float,2>{0.327606231f, 0.198479742f},
-std::array<float,2>{0.829023838f, 0.827979028f},
-std::array<float,2>{0.537545502f, 0.456327498f},
-std::array<float,2>{0.0613657236f, 0.582143128f},
-std::array<float,2>{0.239143625f, 0.324676394f},
-std::array<float,2>{0.694599807f, 0.722568035f},
-std::array<float,2>{0.945144951f, 0.0567152053f},
-std::array<float,2>{0.475078106f, 0.877673388f},
-std::array<float,2>{0.0847375542f, 0.11520505f},
-std::array<float,2>{0.574944019f, 0.982450545f},
-std::array<float,2>{0.792598188f, 0.264969379f},
-std::array<float,2>{0.269198686f, 0.662503123f},
-std::array<float,2>{0.385037124f, 0.396326989f},
-std::array<float,2>{0.914373875f, 0.529548526f},
-std::array<float,2>{0.668574929f, 0.153924838f},
-std::array<float,2>{0.171233699f, 0.753573716f},
-std::array<float,2>{0.427834332f, 0.138497174f},
-std::array<float,2>{0.876608133f, 0.766275764f},
-std::array<float,2>{0.636653662f, 0.38720867f},
-std::array<float,2>{0.150318965f, 0.500606537f},
-std::array<float,2>{0.0987312719f, 0.272995293f},
-std::array<float,2>{0.617899656f, 0.685568035f},
-std::array<float,2>{0.766459763f, 0.095724076f},
-std::array<float,2>{0.293630004f, 0.988343239f},
-std::array<float,2>{0.192551211f, 0.0323853679f},
-std::array<float,2>{0.720842779f, 0.893732607f},
-std::array<float,2>{0.996364653f, 0.33822751f},
-std::array<float,2>{0.468196362f, 0.736580908f},
-std::array<float,2>{0.360469282f, 0.450537324f},
-std::array<float,2>{0.856507659f, 0.575598598f},
-std::array<float,2>{0.513702214f, 0.208140522f},
-std::array<float,2>{0.0190603919f, 0.829868674f},
-std::array<float,2>{0.252430886f, 0.0784174278f},
-std::array<float,2>{0.803554177f, 0.943240404f},
-std::array<float,2>{0.592916369f, 0.295660704f},
-std::array<float,2>{0.0745352283f, 0.652099907f},
-std::array<float,2>{0.175594196f, 0.41194728f},
-std::array<float,2>{0.680658042f, 0.532467306f},
-std::array<float,2>{0.935705364f, 0.170763001f},
-std::array<float,2>{0.397520125f, 0.812425613f},
-std::array<float,2>{0.0323302001f, 0.240330786f},
-std::array<float,2>{0.559523702f, 0.847584367f},
-std::array<float,2>{0.824560463f, 0.49009189f},
-std::array<float,2>{0.329657346f, 0.60850805f},
-std::array<float,2>{0.48946023f, 0.352499336f},
-std::array<float,2>{0.963989079f, 0.698515415f},
-std::array<float,2>{0.70712781f, 0.0125679253f},
-std::array<float,2>{0.220899552f, 0.920879304f},
-std::array<float,2>{0.401301533f, 0.107037924f},
-std::array<float,2>{0.928916872f, 0.996373415f},
-std::array<float,2>{0.67283231f, 0.275887668f},
-std::array<float,2>{0.184499368f, 0.673581839f},
-std::array<float,2>{0.0681289434f, 0.377199143f},
-std::array<float,2>{0.581377089f, 0.513094366f},
-std::array<float,2>{0.811120927f, 0.130672455f},
-std::array<float,2>{0.263181955f, 0.780808449f},
-std::array<float,2>{0.232473403f, 0.215634078f},
-std::array<float,2>{0.711669624f, 0.838142872f},
-std::array<float,2>{0.954588592f, 0.439350307f},
-std::array<float,2>{0.493550986f, 0.56636703f},
-std::array<float,2>{0.337805688f, 0.335422218f},
-std::array<float,2>{0.813711941f, 0.743798733f},
-std::array<float,2>{0.551399112f, 0.0443572924f},
-std::array<float,2>{0.0464013591f, 0.901172757f},
-std::array<float,2>{0.283001095f, 0.159631103f},
-std::array<float,2>{0.778311491f, 0.802194595f},
-std::array<float,2>{0.616016805f, 0.42020601f},
-std::array<float,2>{0.107956737f, 0.543042362f},
-std::array<float,2>{0.143245339f, 0.284626007f},
-std::array<float,2>{0.626207352f, 0.645725667f},
-std::array<float,2>{0.884281218f, 0.0890865102f},
-std::array<float,2>{0.435133755f, 0.946290672f},
-std::array<float,2>{0.0297316741f, 0.00767477788f},
-std::array<float,2>{0.502615631f, 0.912538469f},
-std::array<float,2>{0.847401857f, 0.348196775f},
-std::array<float,2>{0.370620996f, 0.691014707f},
-std::array<float,2>{0.458199173f, 0.496333599f},
-std::array<float,2>{0.989305913f, 0.595366538f},
-std::array<float,2>{0.731145799f, 0.242232278f},
-std::array<float,2>{0.20041585f, 0.854760051f},
-std::array<float,2>{0.481766373f, 0.221222743f},
-std::array<float,2>{0.94990629f, 0.868083537f},
-std::array<float,2>{0.700595081f, 0.47448355f},
-std::array<float,2>{0.244246155f, 0.619927168f},
-std::array<float,2>{0.0539725907f, 0.363316715f},
-std::array<float,2>{0.546685636f, 0.71119523f},
-std::array<float,2>{0.838245571f, 0.0222506151f},
-std::array<float,2>{0.317194879f, 0.937355459f},
-std::array<float,2>{0.157632381f, 0.0670084134f},
-std::array<float,2>{0.65787679f, 0.953780711f},
-std::array<float,2>{0.906669796f, 0.299883306f},
-std::array<float,2>{0.381005377f, 0.63433671f},
-std::array<float,2>{0.280566931f, 0.434960991f},
-std::array<float,2>{0.784551561f, 0.553461909f},
-std::array<float,2>{0.566516817f, 0.178998068f},
-std::array<float,2>{0.0924045518f, 0.796589375f},
-std::array<float,2>{0.354090482f, 0.0508448109f},
-std::array<float,2>{0.868482947f, 0.88824445f},
-std::array<float,2>{0.52274847f, 0.315944612f},
-std::array<float,2>{0.00374876847f, 0.733016133f},
-std::array<float,2>{0.216194957f, 0.462251723f},
-std::array<float,2>{0.746730924f, 0.590716481f},
-std::array<float,2>{0.9818874f, 0.187567875f},
-std::array<float,2>{0.447844356f, 0.817342341f},
-std::array<float,2>{0.119715847f, 0.141711488f},
-std::array<float,2>{0.599858522f, 0.763774216f},
-std::array<float,2>{0.76196754f, 0.40006578f},
-std::array<float,2>{0.298918307f, 0.521042824f},
-std::array<float,2>{0.408780843f, 0.25539124f},
-std::array<float,2>{0.894350052f, 0.668426991f},
-std::array<float,2>{0.6427176f, 0.123442784f},
-std::array<float,2>{0.139792398f, 0.972861946f},
-std::array<float,2>{0.421155721f, 0.0394468866f},
-std::array<float,2>{0.898830056f, 0.90356946f},
-std::array<float,2>{0.65511471f, 0.330598444f},
-std::array<float,2>{0.127466857f, 0.747706294f},
-std::array<float,2>{0.109499149f, 0.443910778f},
-std::array<float,2>{0.602339864f, 0.569288611f},
-std::array<float,2>{0.754864454f, 0.214291319f},
-std::array<float,2>{0.312089026f, 0.84060514f},
-std::array<float,2>{0.210708976f, 0.125200301f},
-std::array<float,2>{0.741747737f, 0.777218878f},
-std::array<float,2>{0.973681748f, 0.381204486f},
-std::array<float,2>{0.439009041f, 0.508336842f},
-std::array<float,2>{0.343851805f, 0.278117597f},
-std::array<float,2>{0.864964902f, 0.67591399f},
-std::array<float,2>{0.530402899f, 0.102988981f},
-std::array<float,2>{0.0137460483f, 0.995614409f},
-std::array<float,2>{0.271135956f, 0.247537717f},
-std::array<float,2>{0.793881774f, 0.858876884f},
-std::array<float,2>{0.574112356f, 0.492518127f},
-std::array<float,2>{0.0804629102f, 0.600723445f},
-std::array<float,2>{0.167855576f, 0.344943047f},
-std::array<float,2>{0.664961159f, 0.693344772f},
-std::array<float,2>{0.920665979f, 0.00369808078f},
-std::array<float,2>{0.388597995f, 0.907427728f},
-std::array<float,2>{0.0550162084f, 0.0928654149f},
-std::array<float,2>{0.532241881f, 0.952818036f},
-std::array<float,2>{0.834289432f, 0.286218882f},
-std::array<float,2>{0.323943079f, 0.641253889f},
-std::array<float,2>{0.469427466f, 0.417633593f},
-std::array<float,2>{0.941007495f, 0.5412606f},
-std::array<float,2>{0.6898669f, 0.162683383f},
-std::array<float,2>{0.237872794f, 0.799871325f},
-std::array<float,2>{0.464389443f, 0.174591586f},
-std::array<float,2>{0.995597482f, 0.789592326f},
-std::array<float,2>{0.726106763f, 0.430314511f},
-std::array<float,2>{0.190513715f, 0.54988569f},
-std::array<float,2>{0.0195641834f, 0.303729683f},
-std::array<float,2>{0.509650469f, 0.638230979f},
-std::array<float,2>{0.852015138f, 0.0643863231f},
-std::array<float,2>{0.366700917f, 0.957496464f},
-std::array<float,2>{0.153636724f, 0.0171234962f},
-std::array<float,2>{0.639002562f, 0.93334496f},
-std::array<float,2>{0.880694211f, 0.359427154f},
-std::array<float,2>{0.425164819f, 0.71625638f},
-std::array<float,2>{0.29085505f, 0.471552968f},
-std::array<float,2>{0.769912243f, 0.624990702f},
-std::array<float,2>{0.623063147f, 0.226144731f},
-std::array<float,2>{0.0943983048f, 0.874609172f},
-std::array<float,2>{0.333590508f, 0.119039096f},
-std::array<float,2>{0.823755622f, 0.969315112f},
-std::array<float,2>{0.55496484f, 0.253144562f},
-std::array<float,2>{0.0366340317f, 0.664484799f},
-std::array<float,2>{0.225416213f, 0.406094968f},
-std::array<float,2>{0.704663754f, 0.516885877f},
-std::array<float,2>{0.967000782f, 0.147067338f},
-std::array<float,2>{0.485706955f, 0.760577857f},
-std::array<float,2>{0.0735437572f, 0.191569403f},
-std::array<float,2>{0.588847816f, 0.815722048f},
-std::array<float,2>{0.797237992f, 0.468477249f},
-std::array<float,2>{0.256730586f, 0.586702645f},
-std::array<float,2>{0.393211424f, 0.319977134f},
-std::array<float,2>{0.932641745f, 0.727612734f},
-std::array<float,2>{0.683887839f, 0.0506608523f},
-std::array<float,2>{0.179423675f, 0.886121929f},
-std::array<float,2>{0.496381849f, 0.0770763159f},
-std::array<float,2>{0.959862053f, 0.964226544f},
-std::array<float,2>{0.717720628f, 0.306168795f},
-std::array<float,2>{0.229482159f, 0.632084846f},
-std::array<float,2>{0.0392388143f, 0.422674656f},
-std::array<float,2>{0.548258722f, 0.556393683f},
-std::array<float,2>{0.818902194f, 0.187064469f},
-std::array<float,2>{0.340822369f, 0.788367629f},
-std::array<float,2>{0.180988804f, 0.226591587f},
-std::array<float,2>{0.679181933f, 0.867170215f},
-std::array<float,2>{0.924897075f, 0.482109308f},
-std::array<float,2>{0.404526174f, 0.61338973f},
-std::array<float,2>{0.25988856f, 0.372582138f},
-std::array<float,2>{0.808359623f, 0.709161043f},
-std::array<float,2>{0.582052469f, 0.023495039f},
-std::array<float,2>{0.0626635849f, 0.927872896f},
-std::array<float,2>{0.37313661f, 0.151461586f},
-std::array<float,2>{0.849403262f, 0.754928112f},
-std::array<float,2>{0.504547477f, 0.393650055f},
-std::array<float,2>{0.0250277743f, 0.525151491f},
-std::array<float,2>{0.196002275f, 0.258363068f},
-std::array<float,2>{0.729518294f, 0.656506896f},
-std::array<float,2>{0.987273097f, 0.111419022f},
-std::array<float,2>{0.453861892f, 0.978728712f},
-std::array<float,2>{0.102039956f, 0.0611944757f},
-std::array<float,2>{0.612724781f, 0.879230976f},
-std::array<float,2>{0.773630857f, 0.323374838f},
-std::array<float,2>{0.287318796f, 0.724071264f},
-std::array<float,2>{0.430071622f, 0.458900571f},
-std::array<float,2>{0.888992012f, 0.581847608f},
-std::array<float,2>{0.629374087f, 0.202111989f},
-std::array<float,2>{0.144532189f, 0.820880234f},
-std::array<float,2>{0.377185225f, 0.205167726f},
-std::array<float,2>{0.911785424f, 0.834098279f},
-std::array<float,2>{0.662783086f, 0.448950738f},
-std::array<float,2>{0.163992941f, 0.57117939f},
-std::array<float,2>{0.0880671889f, 0.341824442f},
-std::array<float,2>{0.562875688f, 0.741983414f},
-std::array<float,2>{0.788995445f, 0.0362029783f},
-std::array<float,2>{0.27509734f, 0.895665765f},
-std::array<float,2>{0.247136414f, 0.0987461358f},
-std::array<float,2>{0.695550859f, 0.985920846f},
-std::array<float,2>{0.948930323f, 0.269275129f},
-std::array<float,2>{0.477948219f, 0.681745946f},
-std::array<float,2>{0.316363424f, 0.382835001f},
-std::array<float,2>{0.841163397f, 0.505281746f},
-std::array<float,2>{0.541156173f, 0.134355709f},
-std::array<float,2>{0.047145538f, 0.773362637f},
-std::array<float,2>{0.302660286f, 0.00943888258f},
-std::array<float,2>{0.759415448f, 0.916364133f},
-std::array<float,2>{0.594840229f, 0.357808948f},
-std::array<float,2>{0.121237271f, 0.700649381f},
-std::array<float,2>{0.136414498f, 0.487032831f},
-std::array<float,2>{0.647429287f, 0.602587104f},
-std::array<float,2>{0.897063076f, 0.237299114f},
-std::array<float,2>{0.411558002f, 0.849001586f},
-std::array<float,2>{0.00663363421f, 0.164150491f},
-std::array<float,2>{0.518177748f, 0.807761371f},
-std::array<float,2>{0.871502519f, 0.410071999f},
-std::array<float,2>{0.356342256f, 0.538569331f},
-std::array<float,2>{0.450090438f, 0.290107459f},
-std::array<float,2>{0.980442882f, 0.655774891f},
-std::array<float,2>{0.74519074f, 0.0852514505f},
-std::array<float,2>{0.212827161f, 0.940796554f},
-std::array<float,2>{0.473922968f, 0.0553131737f},
-std::array<float,2>{0.942625046f, 0.876832306f},
-std::array<float,2>{0.692684054f, 0.326842576f},
-std::array<float,2>{0.241241395f, 0.718981087f},
-std::array<float,2>{0.0586635657f, 0.454492241f},
-std::array<float,2>{0.536013782f, 0.584187269f},
-std::array<float,2>{0.831193805f, 0.197226703f},
-std::array<float,2>{0.324360758f, 0.82448256f},
-std::array<float,2>{0.169647783f, 0.154732212f},
-std::array<float,2>{0.670580745f, 0.750701427f},
-std::array<float,2>{0.91627425f, 0.398015022f},
-std::array<float,2>{0.383298218f, 0.527782619f},
-std::array<float,2>{0.265782952f, 0.263666809f},
-std::array<float,2>{0.790956378f, 0.661472976f},
-std::array<float,2>{0.577768087f, 0.11584232f},
-std::array<float,2>{0.0832099989f, 0.982168078f},
-std::array<float,2>{0.350521594f, 0.234326214f},
-std::array<float,2>{0.860912859f, 0.85987097f},
-std::array<float,2>{0.527007818f, 0.480237931f},
-std::array<float,2>{0.00870279316f, 0.612014472f},
-std::array<float,2>{0.204673693f, 0.368960947f},
-std::array<float,2>{0.737351f, 0.706274629f},
-std::array<float,2>{0.9708727f, 0.0298988931f},
-std::array<float,2>{0.444026232f, 0.924288988f},
-std::array<float,2>{0.115420029f, 0.0712672621f},
-std::array<float,2>{0.608956814f, 0.965957224f},
-std::array<float,2>{0.751728833f, 0.30981794f},
-std::array<float,2>{0.308478117f, 0.628609598f},
-std::array<float,2>{0.414548993f, 0.428745896f},
-std::array<float,2>{0.902647734f, 0.559522569f},
-std::array<float,2>{0.650008678f, 0.181342736f},
-std::array<float,2>{0.131797358f, 0.784940481f},
-std::array<float,2>{0.396440685f, 0.169048399f},
-std::array<float,2>{0.934104085f, 0.809379756f},
-std::array<float,2>{0.681929111f, 0.413999796f},
-std::array<float,2>{0.171877354f, 0.533617735f},
-std::array<float,2>{0.0771951526f, 0.294654995f},
-std::array<float,2>{0.589947581f, 0.6498034f},
-std::array<float,2>{0.802396715f, 0.0820203722f},
-std::array<float,2>{0.250414789f, 0.943729341f},
-std::array<float,2>{0.220220804f, 0.0151829468f},
-std::array<float,2>{0.710322857f, 0.918564439f},
-std::array<float,2>{0.961238146f, 0.353682786f},
-std::array<float,2>{0.49123317f, 0.697163641f},
-std::array<float,2>{0.331058472f, 0.49041459f},
-std::array<float,2>{0.82644099f, 0.606112778f},
-std::array<float,2>{0.56175983f, 0.240142331f},
-std::array<float,2>{0.0347955525f, 0.845606446f},
-std::array<float,2>{0.295592368f, 0.0956659988f},
-std::array<float,2>{0.768126845f, 0.990691185f},
-std::array<float,2>{0.619668841f, 0.270380795f},
-std::array<float,2>{0.100822583f, 0.683671415f},
-std::array<float,2>{0.151033595f, 0.39057529f},
-std::array<float,2>{0.634089589f, 0.502465427f},
-std::array<float,2>{0.877120554f, 0.138949931f},
-std::array<float,2>{0.425911784f, 0.767689228f},
-std::array<float,2>{0.016541766f, 0.209063306f},
-std::array<float,2>{0.512982845f, 0.830820203f},
-std::array<float,2>{0.857880116f, 0.452068329f},
-std::array<float,2>{0.361477613f, 0.576977313f},
-std::array<float,2>{0.465059727f, 0.33778885f},
-std::array<float,2>{0.998604655f, 0.73618269f},
-std::array<float,2>{0.720416188f, 0.034157224f},
-std::array<float,2>{0.194833517f, 0.892455161f},
-std::array<float,2>{0.43564105f, 0.0874239504f},
-std::array<float,2>{0.884904444f, 0.947267771f},
-std::array<float,2>{0.626995265f, 0.282506943f},
-std::array<float,2>{0.142374009f, 0.646656394f},
-std::array<float,2>{0.106034756f, 0.419082463f},
-std::array<float,2>{0.613848686f, 0.546093106f},
-std::array<float,2>{0.780663371f, 0.157037392f},
-std::array<float,2>{0.284986794f, 0.803439915f},
-std::array<float,2>{0.202112898f, 0.244289503f},
-std::array<float,2>{0.733480752f, 0.851975322f},
-std::array<float,2>{0.990921736f, 0.498328924f},
-std::array<float,2>{0.459112853f, 0.596126914f},
-std::array<float,2>{0.368881583f, 0.351326674f},
-std::array<float,2>{0.845086336f, 0.688735783f},
-std::array<float,2>{0.501393199f, 0.00499393744f},
-std::array<float,2>{0.0287921317f, 0.910559595f},
-std::array<float,2>{0.263704151f, 0.132442415f},
-std::array<float,2>{0.808771908f, 0.777349353f},
-std::array<float,2>{0.579110205f, 0.375918031f},
-std::array<float,2>{0.0689225197f, 0.513761044f},
-std::array<float,2>{0.187443838f, 0.273561239f},
-std::array<float,2>{0.673959017f, 0.673939288f},
-std::array<float,2>{0.926477373f, 0.107571967f},
-std::array<float,2>{0.400203198f, 0.998653531f},
-std::array<float,2>{0.0445682183f, 0.0457353629f},
-std::array<float,2>{0.553007782f, 0.898596406f},
-std::array<float,2>{0.814848304f, 0.333416253f},
-std::array<float,2>{0.3386392f, 0.745953262f},
-std::array<float,2>{0.495082796f, 0.440287799f},
-std::array<float,2>{0.956248939f, 0.563402832f},
-std::array<float,2>{0.713659823f, 0.218741775f},
-std::array<float,2>{0.232419923f, 0.837309003f},
-std::array<float,2>{0.446133733f, 0.190594226f},
-std::array<float,2>{0.984219849f, 0.819367707f},
-std::array<float,2>{0.74940455f, 0.464253575f},
-std::array<float,2>{0.217334375f, 0.592643619f},
-std::array<float,2>{0.00132368784f, 0.313929439f},
-std::array<float,2>{0.520676792f, 0.730630994f},
-std::array<float,2>{0.871026516f, 0.053084828f},
-std::array<float,2>{0.352510393f, 0.889090657f},
-std::array<float,2>{0.138136551f, 0.121248752f},
-std::array<float,2>{0.641626418f, 0.974785566f},
-std::array<float,2>{0.892233312f, 0.255933791f},
-std::array<float,2>{0.407221645f, 0.671655297f},
-std::array<float,2>{0.298174828f, 0.401559383f},
-std::array<float,2>{0.764512777f, 0.521604002f},
-std::array<float,2>{0.598491013f, 0.142904639f},
-std::array<float,2>{0.11902149f, 0.763487399f},
-std::array<float,2>{0.319699824f, 0.021096142f},
-std::array<float,2>{0.836948454f, 0.93463254f},
-std::array<float,2>{0.544473886f, 0.366671354f},
-std::array<float,2>{0.0523222163f, 0.714098334f},
-std::array<float,2>{0.243509874f, 0.474612594f},
-std::array<float,2>{0.702042282f, 0.619062006f},
-std::array<float,2>{0.95308286f, 0.220611304f},
-std::array<float,2>{0.483294338f, 0.870231807f},
-std::array<float,2>{0.0899662971f, 0.177117139f},
-std::array<float,2>{0.569802046f, 0.794378161f},
-std::array<float,2>{0.782052636f, 0.437363654f},
-std::array<float,2>{0.277949274f, 0.552193582f},
-std::array<float,2>{0.379745394f, 0.298507035f},
-std::array<float,2>{0.908324003f, 0.635767519f},
-std::array<float,2>{0.658302009f, 0.0694352463f},
-std::array<float,2>{0.15872696f, 0.956878364f},
-std::array<float,2>{0.388980269f, 0.00160913088f},
-std::array<float,2>{0.918606997f, 0.910090506f},
-std::array<float,2>{0.666452467f, 0.347121507f},
-std::array<float,2>{0.165031686f, 0.694981158f},
-std::array<float,2>{0.0786548629f, 0.495170563f},
-std::array<float,2>{0.57219094f, 0.599129915f},
-std::array<float,2>{0.795513213f, 0.249048576f},
-std::array<float,2>{0.272081494f, 0.856564045f},
-std::array<float,2>{0.236084297f, 0.160966277f},
-std::array<float,2>{0.689012349f, 0.798142016f},
-std::array<float,2>{0.938564658f, 0.414370775f},
-std::array<float,2>{0.472317785f, 0.539397061f},
-std::array<float,2>{0.321763694f, 0.288594753f},
-std::array<float,2>{0.832497537f, 0.643309116f},
-std::array<float,2>{0.534686327f, 0.0913381055f},
-std::array<float,2>{0.0581180826f, 0.950696826f},
-std::array<float,2>{0.309939235f, 0.211684555f},
-std::array<float,2>{0.756484687f, 0.842632651f},
-std::array<float,2>{0.604920924f, 0.442502737f},
-std::array<float,2>{0.112854868f, 0.568121314f},
-std::array<float,2>{0.125916094f, 0.329156876f},
-std::array<float,2>{0.652430773f, 0.749218345f},
-std::array<float,2>{0.90214932f, 0.0416015796f},
-std::array<float,2>{0.418937355f, 0.904753089f},
-std::array<float,2>{0.0133477645f, 0.103678629f},
-std::array<float,2>{0.528934777f, 0.993564963f},
-std::array<float,2>{0.866575003f, 0.281010509f},
-std::array<float,2>{0.346847385f, 0.678959846f},
-std::array<float,2>{0.440296561f, 0.380306929f},
-std::array<float,2>{0.974669099f, 0.509999037f},
-std::array<float,2>{0.739984393f, 0.127669126f},
-std::array<float,2>{0.207711965f, 0.774680257f},
-std::array<float,2>{0.48766166f, 0.146111846f},
-std::array<float,2>{0.966497004f, 0.757858396f},
-std::array<float,2>{0.705868721f, 0.402768999f},
-std::array<float,2>{0.224260658f, 0.519359469f},
-std::array<float,2>{0.0387509763f, 0.250611961f},
-std::array<float,2>{0.558205187f, 0.667826414f},
-std::array<float,2>{0.821894169f, 0.11978668f},
-std::array<float,2>{0.334392458f, 0.972635806f},
-std::array<float,2>{0.176162899f, 0.0482208878f},
-std::array<float,2>{0.685964644f, 0.8839885f},
-std::array<float,2>{0.931605041f, 0.318096042f},
-std::array<float,2>{0.391810149f, 0.729071617f},
-std::array<float,2>{0.255435258f, 0.466474563f},
-std::array<float,2>{0.800410092f, 0.588301003f},
-std::array<float,2>{0.586295485f, 0.19352892f},
-std::array<float,2>{0.0705101267f, 0.813411534f},
-std::array<float,2>{0.36445421f, 0.0658087507f},
-std::array<float,2>{0.854426563f, 0.959593475f},
-std::array<float,2>{0.511640966f, 0.301154077f},
-std::array<float,2>{0.0234095603f, 0.640247762f},
-std::array<float,2>{0.189079836f, 0.43209365f},
-std::array<float,2>{0.724603891f, 0.548603117f},
-std::array<float,2>{0.992199123f, 0.172651544f},
-std::array<float,2>{0.461681366f, 0.792129934f},
-std::array<float,2>{0.0969803035f, 0.223129869f},
-std::array<float,2>{0.622857273f, 0.87118125f},
-std::array<float,2>{0.772183895f, 0.468795478f},
-std::array<float,2>{0.292874664f, 0.622474968f},
-std::array<float,2>{0.423660547f, 0.362215012f},
-std::array<float,2>{0.881618381f, 0.718477666f},
-std::array<float,2>{0.638656914f, 0.018569259f},
-std::array<float,2>{0.156109676f, 0.930856049f},
-std::array<float,2>{0.455634892f, 0.11073903f},
-std::array<float,2>{0.98451066f, 0.978019476f},
-std::array<float,2>{0.727180362f, 0.260604084f},
-std::array<float,2>{0.197924718f, 0.658916533f},
-std::array<float,2>{0.0258639026f, 0.390743107f},
-std::array<float,2>{0.506282568f, 0.526949227f},
-std::array<float,2>{0.850856483f, 0.148714259f},
-std::array<float,2>{0.371549487f, 0.756739497f},
-std::array<float,2>{0.148071259f, 0.200423345f},
-std::array<float,2>{0.631756961f, 0.823857844f},
-std::array<float,2>{0.887679636f, 0.459185421f},
-std::array<float,2>{0.433347464f, 0.579487324f},
-std::array<float,2>{0.285212129f, 0.321702451f},
-std::array<float,2>{0.775659144f, 0.725540936f},
-std::array<float,2>{0.610803127f, 0.0604768246f},
-std::array<float,2>{0.104628831f, 0.881415904f},
-std::array<float,2>{0.34292838f, 0.184197694f},
-std::array<float,2>{0.817762196f, 0.785924375f},
-std::array<float,2>{0.549013019f, 0.42491591f},
-std::array<float,2>{0.0416861102f, 0.557985127f},
-std::array<float,2>{0.227377623f, 0.308410823f},
-std::array<float,2>{0.716741264f, 0.630366564f},
-std::array<float,2>{0.957605898f, 0.0761584044f},
-std::array<float,2>{0.499124557f, 0.962683856f},
-std::array<float,2>{0.0658041164f, 0.025650207f},
-std::array<float,2>{0.585413992f, 0.925821364f},
-std::array<float,2>{0.805520713f, 0.374797314f},
-std::array<float,2>{0.259426981f, 0.708719075f},
-std::array<float,2>{0.402375489f, 0.482453018f},
-std::array<float,2>{0.921959579f, 0.615872145f},
-std::array<float,2>{0.676263273f, 0.229414299f},
-std::array<float,2>{0.183501735f, 0.86474824f},
-std::array<float,2>{0.412611425f, 0.235767201f},
-std::array<float,2>{0.895046949f, 0.85101527f},
-std::array<float,2>{0.645602643f, 0.485580683f},
-std::array<float,2>{0.134260938f, 0.605327368f},
-std::array<float,2>{0.12409436f, 0.357311398f},
-std::array<float,2>{0.596192539f, 0.702450275f},
-std::array<float,2>{0.760735273f, 0.0114099532f},
-std::array<float,2>{0.304066807f, 0.914627969f},
-std::array<float,2>{0.214568034f, 0.0839393064f},
-std::array<float,2>{0.743505299f, 0.937665045f},
-std::array<float,2>{0.97720623f, 0.291494489f},
-std::array<float,2>{0.453066289f, 0.652394474f},
-std::array<float,2>{0.357622683f, 0.406408221f},
-std::array<float,2>{0.874992013f, 0.537072122f},
-std::array<float,2>{0.517537296f, 0.166213661f},
-std::array<float,2>{0.00532381097f, 0.805560827f},
-std::array<float,2>{0.276355416f, 0.0371488482f},
-std::array<float,2>{0.785223484f, 0.897628963f},
-std::array<float,2>{0.565792263f, 0.34071058f},
-std::array<float,2>{0.0871961266f, 0.739486575f},
-std::array<float,2>{0.160925195f, 0.445748389f},
-std::array<float,2>{0.662050068f, 0.573513091f},
-std::array<float,2>{0.913233399f, 0.203775406f},
-std::array<float,2>{0.375809401f, 0.833369493f},
-std::array<float,2>{0.0502044447f, 0.135097772f},
-std::array<float,2>{0.540682852f, 0.769668937f},
-std::array<float,2>{0.842332363f, 0.385575801f},
-std::array<float,2>{0.312799603f, 0.507427454f},
-std::array<float,2>{0.478583485f, 0.267087132f},
-std::array<float,2>{0.945855737f, 0.680969894f},
-std::array<float,2>{0.698953032f, 0.100630894f},
-std::array<float,2>{0.249227077f, 0.986443341f},
-std::array<float,2>{0.490788013f, 0.012742456f},
-std::array<float,2>{0.962663949f, 0.921156943f},
-std::array<float,2>{0.709124804f, 0.353458762f},
-std::array<float,2>{0.219323188f, 0.697400689f},
-std::array<float,2>{0.0339098647f, 0.488429248f},
-std::array<float,2>{0.560968399f, 0.607770801f},
-std::array<float,2>{0.827312231f, 0.241959915f},
-std::array<float,2>{0.330264688f, 0.846430302f},
-std::array<float,2>{0.172952011f, 0.171021119f},
-std::array<float,2>{0.683361769f, 0.810885847f},
-std::array<float,2>{0.935236216f, 0.410582334f},
-std::array<float,2>{0.394959271f, 0.531777799f},
-std::array<float,2>{0.251491368f, 0.296222955f},
-std::array<float,2>{0.801589251f, 0.651207805f},
-std::array<float,2>{0.591132641f, 0.0794563815f},
-std::array<float,2>{0.0762702823f, 0.942094088f},
-std::array<float,2>{0.362420559f, 0.20715028f},
-std::array<float,2>{0.859369755f, 0.828160405f},
-std::array<float,2>{0.51239562f, 0.449656904f},
-std::array<float,2>{0.016998969f, 0.574281812f},
-std::array<float,2>{0.193830967f, 0.33890003f},
-std::array<float,2>{0.719023228f, 0.737653196f},
-std::array<float,2>{0.999499142f, 0.031704355f},
-std::array<float,2>{0.465881646f, 0.893306375f},
-std::array<float,2>{0.100505933f, 0.0972796082f},
-std::array<float,2>{0.620912552f, 0.989311814f},
-std::array<float,2>{0.769245684f, 0.272074699f},
-std::array<float,2>{0.296439171f, 0.686742842f},
-std::array<float,2>{0.427267522f, 0.388008505f},
-std::array<float,2>{0.877977371f, 0.501637042f},
-std::array<float,2>{0.633104444f, 0.137373224f},
-std::array<float,2>{0.151435629f, 0.767004371f},
-std::array<float,2>{0.384696186f, 0.152815342f},
-std::array<float,2>{0.917589426f, 0.752902508f},
-std::array<float,2>{0.671873868f, 0.39457655f},
-std::array<float,2>{0.168709889f, 0.530349553f},
-std::array<float,2>{0.0823795274f, 0.264225483f},
-std::array<float,2>{0.576753497f, 0.663894296f},
-std::array<float,2>{0.789275289f, 0.113612726f},
-std::array<float,2>{0.266635239f, 0.983683109f},
-std::array<float,2>{0.240304559f, 0.0581975803f},
-std::array<float,2>{0.691652894f, 0.87817663f},
-std::array<float,2>{0.942340314f, 0.325677693f},
-std::array<float,2>{0.472759008f, 0.72120744f},
-std::array<float,2>{0.326126009f, 0.455325544f},
-std::array<float,2>{0.830556989f, 0.583460212f},
-std::array<float,2>{0.53631109f, 0.198118374f},
-std::array<float,2>{0.0599390566f, 0.826577544f},
-std::array<float,2>{0.306673229f, 0.0724102631f},
-std::array<float,2>{0.750344455f, 0.967186213f},
-std::array<float,2>{0.607914686f, 0.310799032f},
-std::array<float,2>{0.117163226f, 0.626913249f},
-std::array<float,2>{0.131867185f, 0.4268758f},
-std::array<float,2>{0.649063706f, 0.560973167f},
-std::array<float,2>{0.903623521f, 0.182415098f},
-std::array<float,2>{0.415489435f, 0.781881511f},
-std::array<float,2>{0.00929397997f, 0.23074843f},
-std::array<float,2>{0.525562704f, 0.863205254f},
-std::array<float,2>{0.859599173f, 0.476968646f},
-std::array<float,2>{0.351005405f, 0.610687315f},
-std::array<float,2>{0.444502503f, 0.370703906f},
-std::array<float,2>{0.972616434f, 0.704687476f},
-std::array<float,2>{0.736504912f, 0.0286239684f},
-std::array<float,2>{0.204024613f, 0.922763884f},
-std::array<float,2>{0.407248735f, 0.124577172f},
-std::array<float,2>{0.891428947f, 0.973875225f},
-std::array<float,2>{0.641088486f, 0.254559994f},
-std::array<float,2>{0.136766851f, 0.669116974f},
-std::array<float,2>{0.117703751f, 0.398491055f},
-std::array<float,2>{0.599588275f, 0.519842863f},
-std::array<float,2>{0.764805079f, 0.141432956f},
-std::array<float,2>{0.297762811f, 0.764789641f},
-std::array<float,2>{0.218216598f, 0.189030662f},
-std::array<float,2>{0.748524547f, 0.817469716f},
-std::array<float,2>{0.983371675f, 0.46181494f},
-std::array<float,2>{0.447086602f, 0.591207623f},
-std::array<float,2>{0.352585942f, 0.314793706f},
-std::array<float,2>{0.869637966f, 0.73377192f},
-std::array<float,2>{0.519758761f, 0.052183263f},
-std::array<float,2>{0.000557748659f, 0.886794567f},
-std::array<float,2>{0.279087931f, 0.178476408f},
-std::array<float,2>{0.782744706f, 0.795213521f},
-std::array<float,2>{0.569149375f, 0.433672369f},
-std::array<float,2>{0.090929158f, 0.553856671f},
-std::array<float,2>{0.159795538f, 0.298855841f},
-std::array<float,2>{0.660051346f, 0.632838249f},
-std::array<float,2>{0.909719646f, 0.0678242519f},
-std::array<float,2>{0.380654246f, 0.954472721f},
-std::array<float,2>{0.0512659214f, 0.0225736164f},
-std::array<float,2>{0.543500185f, 0.936414957f},
-std::array<float,2>{0.836426497f, 0.365135729f},
-std::array<float,2>{0.318469018f, 0.711972594f},
-std::array<float,2>{0.48350966f, 0.473454177f},
-std::array<float,2>{0.951548994f, 0.620314002f},
-std::array<float,2>{0.702524662f, 0.221725419f},
-std::array<float,2>{0.242608711f, 0.868531883f},
-std::array<float,2>{0.460314125f, 0.243337512f},
-std::array<float,2>{0.991988301f, 0.854313552f},
-std::array<float,2>{0.733039379f, 0.497591853f},
-std::array<float,2>{0.202731282f, 0.594370246f},
-std::array<float,2>{0.0275604744f, 0.349588603f},
-std::array<float,2>{0.500926018f, 0.689517558f},
-std::array<float,2>{0.844410479f, 0.00646504899f},
-std::array<float,2>{0.367917031f, 0.91310668f},
-std::array<float,2>{0.1413645f, 0.0879924744f},
-std::array<float,2>{0.628320694f, 0.945345044f},
-std::array<float,2>{0.886111796f, 0.283404469f},
-std::array<float,2>{0.437045246f, 0.64467144f},
-std::array<float,2>{0.283779979f, 0.421737224f},
-std::array<float,2>{0.779618323f, 0.544082582f},
-std::array<float,2>{0.614271522f, 0.158363044f},
-std::array<float,2>{0.106549181f, 0.801220715f},
-std::array<float,2>{0.339497447f, 0.0437215269f},
-std::array<float,2>{0.815675497f, 0.901945531f},
-std::array<float,2>{0.554252505f, 0.334208846f},
-std::array<float,2>{0.043782115f, 0.742500365f},
-std::array<float,2>{0.230988741f, 0.437677115f},
-std::array<float,2>{0.714390159f, 0.565426052f},
-std::array<float,2>{0.955777884f, 0.216332689f},
-std::array<float,2>{0.496033162f, 0.839807332f},
-std::array<float,2>{0.0697184205f, 0.12920852f},
-std::array<float,2>{0.578288436f, 0.779533327f},
-std::array<float,2>{0.809818029f, 0.378615409f},
-std::array<float,2>{0.265301704f, 0.512114584f},
-std::array<float,2>{0.399376929f, 0.276695162f},
-std::array<float,2>{0.927320421f, 0.671977937f},
-std::array<float,2>{0.674833536f, 0.106064178f},
-std::array<float,2>{0.185966939f, 0.997893691f},
-std::array<float,2>{0.391011924f, 0.0495802499f},
-std::array<float,2>{0.930074513f, 0.885157526f},
-std::array<float,2>{0.687051177f, 0.318944991f},
-std::array<float,2>{0.176980957f, 0.727365136f},
-std::array<float,2>{0.0715221688f, 0.467360258f},
-std::array<float,2>{0.587265968f, 0.587845564f},
-std::array<float,2>{0.799401641f, 0.192488059f},
-std::array<float,2>{0.254564136f, 0.815280855f},
-std::array<float,2>{0.223197922f, 0.148050919f},
-std::array<float,2>{0.70623374f, 0.761353135f},
-std::array<float,2>{0.965175152f, 0.404673904f},
-std::array<float,2>{0.487128198f, 0.516562343f},
-std::array<float,2>{0.335399717f, 0.252395183f},
-std::array<float,2>{0.820904732f, 0.665278494f},
-std::array<float,2>{0.55732578f, 0.118098728f},
-std::array<float,2>{0.0380511843f, 0.970666647f},
-std::array<float,2>{0.291309297f, 0.22478497f},
-std::array<float,2>{0.773162007f, 0.873224139f},
-std::array<float,2>{0.62202847f, 0.471687496f},
-std::array<float,2>{0.0961130485f, 0.623386443f},
-std::array<float,2>{0.155046731f, 0.360945821f},
-std::array<float,2>{0.637268782f, 0.715346813f},
-std::array<float,2>{0.881991148f, 0.0161577109f},
-std::array<float,2>{0.422594786f, 0.931989908f},
-std::array<float,2>{0.0217370726f, 0.0626054928f},
-std::array<float,2>{0.510577977f, 0.95884943f},
-std::array<float,2>{0.855043471f, 0.302767992f},
-std::array<float,2>{0.363545686f, 0.637285888f},
-std::array<float,2>{0.461936057f, 0.431482285f},
-std::array<float,2>{0.993213475f, 0.549761355f},
-std::array<float,2>{0.723182738f, 0.174884453f},
-std::array<float,2>{0.188445315f, 0.790302038f},
-std::array<float,2>{0.471629381f, 0.163384765f},
-std::array<float,2>{0.93808192f, 0.799508691f},
-std::array<float,2>{0.687807858f, 0.416831553f},
-std::array<float,2>{0.235092506f, 0.542856634f},
-std::array<float,2>{0.0573601834f, 0.285672605f},
-std::array<float,2>{0.533441186f, 0.641932905f},
-std::array<float,2>{0.833199739f, 0.0919626653f},
-std::array<float,2>{0.32126537f, 0.951269031f},
-std::array<float,2>{0.165624142f, 0.00235886057f},
-std::array<float,2>{0.667446613f, 0.907095671f},
-std::array<float,2>{0.919812381f, 0.343910098f},
-std::array<float,2>{0.390264392f, 0.692275047f},
-std::array<float,2>{0.272563219f, 0.493250072f},
-std::array<float,2>{0.79660356f, 0.600425482f},
-std::array<float,2>{0.571069479f, 0.246510029f},
-std::array<float,2>{0.0798188597f, 0.857426584f},
-std::array<float,2>{0.346222073f, 0.101837628f},
-std::array<float,2>{0.865635693f, 0.994152546f},
-std::array<float,2>{0.52796936f, 0.278661698f},
-std::array<float,2>{0.0120577179f, 0.677184761f},
-std::array<float,2>{0.20898056f, 0.382554442f},
-std::array<float,2>{0.738959968f, 0.509410441f},
-std::array<float,2>{0.975770414f, 0.126491129f},
-std::array<float,2>{0.441079408f, 0.775869668f},
-std::array<float,2>{0.112179726f, 0.213319004f},
-std::array<float,2>{0.603986263f, 0.841080368f},
-std::array<float,2>{0.757686138f, 0.444455564f},
-std::array<float,2>{0.308893561f, 0.569920897f},
-std::array<float,2>{0.419108987f, 0.331967175f},
-std::array<float,2>{0.900701165f, 0.746144414f},
-std::array<float,2>{0.65378809f, 0.0403945372f},
-std::array<float,2>{0.126385972f, 0.902832627f},
-std::array<float,2>{0.452007532f, 0.0840056762f},
-std::array<float,2>{0.978343487f, 0.939855933f},
-std::array<float,2>{0.742474079f, 0.28915906f},
-std::array<float,2>{0.213132203f, 0.655126512f},
-std::array<float,2>{0.00484408485f, 0.408317089f},
-std::array<float,2>{0.515666842f, 0.537174881f},
-std::array<float,2>{0.873801112f, 0.165339977f},
-std::array<float,2>{0.358506978f, 0.807610929f},
-std::array<float,2>{0.13335368f, 0.237537712f},
-std::array<float,2>{0.644713163f, 0.848596394f},
-std::array<float,2>{0.896022975f, 0.488065004f},
-std::array<float,2>{0.413417876f, 0.601734638f},
-std::array<float,2>{0.302922189f, 0.358764023f},
-std::array<float,2>{0.761319518f, 0.699554086f},
-std::array<float,2>{0.597336471f, 0.00839096867f},
-std::array<float,2>{0.123689726f, 0.9175542f},
-std::array<float,2>{0.313741803f, 0.133270562f},
-std::array<float,2>{0.843663454f, 0.77231878f},
-std::array<float,2>{0.539545834f, 0.384310037f},
-std::array<float,2>{0.049025014f, 0.504223347f},
-std::array<float,2>{0.248795673f, 0.268472075f},
-std::array<float,2>{0.697922289f, 0.682710588f},
-std::array<float,2>{0.946316659f, 0.0979756489f},
-std::array<float,2>{0.480398089f, 0.984702289f},
-std::array<float,2>{0.0868162215f, 0.035489656f},
-std::array<float,2>{0.565154076f, 0.894702494f},
-std::array<float,2>{0.786500335f, 0.342850119f},
-std::array<float,2>{0.276816934f, 0.741117895f},
-std::array<float,2>{0.375980288f, 0.447872519f},
-std::array<float,2>{0.913044453f, 0.572001636f},
-std::array<float,2>{0.661043942f, 0.206252575f},
-std::array<float,2>{0.161653385f, 0.835378051f},
-std::array<float,2>{0.432025343f, 0.202933565f},
-std::array<float,2>{0.888117194f, 0.821449637f},
-std::array<float,2>{0.63217032f, 0.45769763f},
-std::array<float,2>{0.147333041f, 0.580386996f},
-std::array<float,2>{0.104208566f, 0.322301298f},
-std::array<float,2>{0.610201299f, 0.723568678f},
-std::array<float,2>{0.776413977f, 0.0623257086f},
-std::array<float,2>{0.286727846f, 0.880351007f},
-std::array<float,2>{0.198417351f, 0.112522878f},
-std::array<float,2>{0.72845763f, 0.980075538f},
-std::array<float,2>{0.985485137f, 0.258915454f},
-std::array<float,2>{0.456843585f, 0.657350361f},
-std::array<float,2>{0.372514784f, 0.393030435f},
-std::array<float,2>{0.849675298f, 0.523442328f},
-std::array<float,2>{0.506980956f, 0.151217073f},
-std::array<float,2>{0.0271502808f, 0.753943264f},
-std::array<float,2>{0.258358568f, 0.025239002f},
-std::array<float,2>{0.806416988f, 0.929664195f},
-std::array<float,2>{0.584230483f, 0.371408433f},
-std::array<float,2>{0.0645725876f, 0.710689962f},
-std::array<float,2>{0.181744322f, 0.481431097f},
-std::array<float,2>{0.676905215f, 0.615187645f},
-std::array<float,2>{0.92321533f, 0.227960363f},
-std::array<float,2>{0.403466374f, 0.866183341f},
-std::array<float,2>{0.042924881f, 0.185784832f},
-std::array<float,2>{0.54981035f, 0.788057208f},
-std::array<float,2>{0.816764593f, 0.423728347f},
-std::array<float,2>{0.34210071f, 0.555416763f},
-std::array<float,2>{0.498202443f, 0.30475983f},
-std::array<float,2>{0.958750844f, 0.631373763f},
-std::array<float,2>{0.715665698f, 0.0772465989f},
-std::array<float,2>{0.228168756f, 0.963014841f},
-std::array<float,2>{0.467656702f, 0.0350196734f},
-std::array<float,2>{0.997332811f, 0.890637279f},
-std::array<float,2>{0.722272515f, 0.336548716f},
-std::array<float,2>{0.191583216f, 0.734796584f},
-std::array<float,2>{0.0177507605f, 0.45258227f},
-std::array<float,2>{0.514692724f, 0.577782631f},
-std::array<float,2>{0.855639875f, 0.210218251f},
-std::array<float,2>{0.359832585f, 0.831068993f},
-std::array<float,2>{0.148941308f, 0.140256509f},
-std::array<float,2>{0.635580301f, 0.76887095f},
-std::array<float,2>{0.875897706f, 0.388783753f},
-std::array<float,2>{0.429237098f, 0.503515065f},
-std::array<float,2>{0.294454992f, 0.270974755f},
-std::array<float,2>{0.767540634f, 0.68482089f},
-std::array<float,2>{0.618341565f, 0.0944457874f},
-std::array<float,2>{0.0986295566f, 0.992092013f},
-std::array<float,2>{0.328301638f, 0.238625005f},
-std::array<float,2>{0.825199783f, 0.844453394f},
-std::array<float,2>{0.560161114f, 0.491450846f},
-std::array<float,2>{0.0318643488f, 0.606899083f},
-std::array<float,2>{0.222205698f, 0.35511291f},
-std::array<float,2>{0.708256721f, 0.695892632f},
-std::array<float,2>{0.963393629f, 0.0138105974f},
-std::array<float,2>{0.488778591f, 0.919463575f},
-std::array<float,2>{0.0752129853f, 0.0807204545f},
-std::array<float,2>{0.592061937f, 0.945284784f},
-std::array<float,2>{0.804037631f, 0.293386698f},
-std::array<float,2>{0.253176033f, 0.649030805f},
-std::array<float,2>{0.396633714f, 0.412322968f},
-std::array<float,2>{0.937300503f, 0.534180045f},
-std::array<float,2>{0.681604564f, 0.168728635f},
-std::array<float,2>{0.174624413f, 0.810354412f},
-std::array<float,2>{0.417817086f, 0.180319533f},
-std::array<float,2>{0.904946268f, 0.783554256f},
-std::array<float,2>{0.651413083f, 0.428280056f},
-std::array<float,2>{0.129902035f, 0.559602082f},
-std::array<float,2>{0.114458084f, 0.308922946f},
-std::array<float,2>{0.607170105f, 0.627250671f},
-std::array<float,2>{0.753883779f, 0.0713699088f},
-std::array<float,2>{0.305380881f, 0.965446115f},
-std::array<float,2>{0.206675574f, 0.030717805f},
-std::array<float,2>{0.735076487f, 0.925482631f},
-std::array<float,2>{0.96907413f, 0.367928773f},
-std::array<float,2>{0.442149341f, 0.705170274f},
-std::array<float,2>{0.349187821f, 0.478966713f},
-std::array<float,2>{0.862872839f, 0.612653255f},
-std::array<float,2>{0.524013162f, 0.233373344f},
-std::array<float,2>{0.0111458944f, 0.861200452f},
-std::array<float,2>{0.267614275f, 0.116848089f},
-std::array<float,2>{0.791919053f, 0.980653167f},
-std::array<float,2>{0.575373828f, 0.262046248f},
-std::array<float,2>{0.0853152126f, 0.660476506f},
-std::array<float,2>{0.170841873f, 0.396549404f},
-std::array<float,2>{0.669203579f, 0.528929472f},
-std::array<float,2>{0.915593028f, 0.155360252f},
-std::array<float,2>{0.386174321f, 0.751354396f},
-std::array<float,2>{0.0618325919f, 0.195697933f},
-std::array<float,2>{0.538275301f, 0.825210273f},
-std::array<float,2>{0.829568684f, 0.453828812f},
-std::array<float,2>{0.32638225f, 0.585523427f},
-std::array<float,2>{0.475665599f, 0.327255845f},
-std::array<float,2>{0.943676412f, 0.720246732f},
-std::array<float,2>{0.694289327f, 0.0566277131f},
-std::array<float,2>{0.239677951f, 0.875205994f},
-std::array<float,2>{0.382288396f, 0.0693104044f},
-std::array<float,2>{0.907879472f, 0.955386102f},
-std::array<float,2>{0.657051504f, 0.297514945f},
-std::array<float,2>{0.156640604f, 0.635149002f},
-std::array<float,2>{0.0930507481f, 0.436246276f},
-std::array<float,2>{0.56811142f, 0.551593184f},
-std::array<float,2>{0.784160614f, 0.176589653f},
-std::array<float,2>{0.279689342f, 0.793866873f},
-std::array<float,2>{0.245736599f, 0.218949467f},
-std::array<float,2>{0.699964523f, 0.869427323f},
-std::array<float,2>{0.950957358f, 0.476500779f},
-std::array<float,2>{0.480576485f, 0.617784083f},
-std::array<float,2>{0.317709565f, 0.365746021f},
-std::array<float,2>{0.839206517f, 0.713613749f},
-std::array<float,2>{0.545708597f, 0.0197166614f},
-std::array<float,2>{0.0530463234f, 0.933663785f},
-std::array<float,2>{0.299875796f, 0.143749118f},
-std::array<float,2>{0.763459563f, 0.762631238f},
-std::array<float,2>{0.601443589f, 0.400867462f},
-std::array<float,2>{0.120741889f, 0.522627413f},
-std::array<float,2>{0.139008433f, 0.257757336f},
-std::array<float,2>{0.643581867f, 0.670265794f},
-std::array<float,2>{0.893512547f, 0.122845829f},
-std::array<float,2>{0.409356534f, 0.97648412f},
-std::array<float,2>{0.0020975878f, 0.0541150309f},
-std::array<float,2>{0.52223444f, 0.890468895f},
-std::array<float,2>{0.86804229f, 0.31313023f},
-std::array<float,2>{0.354592234f, 0.731687725f},
-std::array<float,2>{0.448880345f, 0.463065088f},
-std::array<float,2>{0.981118619f, 0.592935622f},
-std::array<float,2>{0.747146666f, 0.189481422f},
-std::array<float,2>{0.215784729f, 0.819012761f},
-std::array<float,2>{0.492438585f, 0.217438117f},
-std::array<float,2>{0.953817427f, 0.836214542f},
-std::array<float,2>{0.712003648f, 0.440674573f},
-std::array<float,2>{0.233757377f, 0.563972533f},
-std::array<float,2>{0.0452052653f, 0.332987756f},
-std::array<float,2>{0.552309275f, 0.744423628f},
-std::array<float,2>{0.812514842f, 0.0464970395f},
-std::array<float,2>{0.336517781f, 0.899901271f},
-std::array<float,2>{0.184598193f, 0.108654656f},
-std::array<float,2>{0.673777759f, 0.999071062f},
-std::array<float,2>{0.92865628f, 0.275294811f},
-std::array<float,2>{0.401737839f, 0.675017953f},
-std::array<float,2>{0.262681901f, 0.376555651f},
-std::array<float,2>{0.811648786f, 0.514880419f},
-std::array<float,2>{0.580557287f, 0.131535053f},
-std::array<float,2>{0.0664873123f, 0.7789343f},
-std::array<float,2>{0.369290382f, 0.00429334585f},
-std::array<float,2>{0.846581519f, 0.911545634f},
-std::array<float,2>{0.50316155f, 0.350302905f},
-std::array<float,2>{0.0308417957f, 0.687526405f},
-std::array<float,2>{0.200194165f, 0.499553263f},
-std::array<float,2>{0.732147098f, 0.597555578f},
-std::array<float,2>{0.988581181f, 0.245932639f},
-std::array<float,2>{0.457614452f, 0.853025377f},
-std::array<float,2>{0.108420774f, 0.157372147f},
-std::array<float,2>{0.616479874f, 0.803920865f},
-std::array<float,2>{0.778598964f, 0.418376774f},
-std::array<float,2>{0.28170222f, 0.545327783f},
-std::array<float,2>{0.434075683f, 0.281856388f},
-std::array<float,2>{0.882969201f, 0.647532642f},
-std::array<float,2>{0.625892699f, 0.0861310884f},
-std::array<float,2>{0.144105643f, 0.948418677f},
-std::array<float,2>{0.423962235f, 0.0177580863f},
-std::array<float,2>{0.87970525f, 0.93012625f},
-std::array<float,2>{0.639679193f, 0.362336338f},
-std::array<float,2>{0.152763039f, 0.717545211f},
-std::array<float,2>{0.0955076963f, 0.469955802f},
-std::array<float,2>{0.624307692f, 0.621229887f},
-std::array<float,2>{0.770836055f, 0.223950937f},
-std::array<float,2>{0.28957659f, 0.872469425f},
-std::array<float,2>{0.190265328f, 0.173621789f},
-std::array<float,2>{0.724962115f, 0.791903198f},
-std::array<float,2>{0.994493842f, 0.43339318f},
-std::array<float,2>{0.463775754f, 0.547531962f},
-std::array<float,2>{0.365841627f, 0.301761866f},
-std::array<float,2>{0.852801859f, 0.63869375f},
-std::array<float,2>{0.508021414f, 0.0650959015f},
-std::array<float,2>{0.0214726459f, 0.960515261f},
-std::array<float,2>{0.256947279f, 0.1948791f},
-std::array<float,2>{0.798564374f, 0.814067066f},
-std::array<float,2>{0.589829147f, 0.465329915f},
-std::array<float,2>{0.0730411857f, 0.58983022f},
-std::array<float,2>{0.178560153f, 0.316929489f},
-std::array<float,2>{0.684608221f, 0.729744852f},
-std::array<float,2>{0.931738555f, 0.047437977f},
-std::array<float,2>{0.39387551f, 0.883677721f},
-std::array<float,2>{0.0355426632f, 0.120540984f},
-std::array<float,2>{0.556351125f, 0.971533179f},
-std::array<float,2>{0.822941184f, 0.251375288f},
-std::array<float,2>{0.332195848f, 0.666602135f},
-std::array<float,2>{0.484718591f, 0.404006511f},
-std::array<float,2>{0.967857301f, 0.517616272f},
-std::array<float,2>{0.704052329f, 0.145404443f},
-std::array<float,2>{0.226448163f, 0.759438515f},
-std::array<float,2>{0.438090086f, 0.12817426f},
-std::array<float,2>{0.973177552f, 0.773691416f},
-std::array<float,2>{0.740824878f, 0.379737407f},
-std::array<float,2>{0.209419996f, 0.511709452f},
-std::array<float,2>{0.0151276859f, 0.280027986f},
-std::array<float,2>{0.530220747f, 0.677886665f},
-std::array<float,2>{0.864020944f, 0.104659177f},
-std::array<float,2>{0.345381618f, 0.992372572f},
-std::array<float,2>{0.128263086f, 0.0426511206f},
-std::array<float,2>{0.655595958f, 0.905914545f},
-std::array<float,2>{0.899712563f, 0.32907477f},
-std::array<float,2>{0.420032501f, 0.74892199f},
-std::array<float,2>{0.311104506f, 0.442103684f},
-std::array<float,2>{0.755577147f, 0.567269623f},
-std::array<float,2>{0.603442252f, 0.212579608f},
-std::array<float,2>{0.110937312f, 0.843681812f},
-std::array<float,2>{0.322301865f, 0.0902402997f},
-std::array<float,2>{0.834978759f, 0.949228168f},
-std::array<float,2>{0.53199321f, 0.287679076f},
-std::array<float,2>{0.0560308136f, 0.643983722f},
-std::array<float,2>{0.236989185f, 0.415391088f},
-std::array<float,2>{0.691087067f, 0.540369689f},
-std::array<float,2>{0.940156996f, 0.161218509f},
-std::array<float,2>{0.47063157f, 0.797243714f},
-std::array<float,2>{0.0816774964f, 0.248335853f},
-std::array<float,2>{0.572367251f, 0.855864584f},
-std::array<float,2>{0.794001818f, 0.494680494f},
-std::array<float,2>{0.270267546f, 0.598160505f},
-std::array<float,2>{0.387488216f, 0.346163362f},
-std::array<float,2>{0.921131194f, 0.693789244f},
-std::array<float,2>{0.665394247f, 0.000279057916f},
-std::array<float,2>{0.166338831f, 0.908224106f},
-std::array<float,2>{0.476609856f, 0.100124247f},
-std::array<float,2>{0.947783291f, 0.987996697f},
-std::array<float,2>{0.697044075f, 0.266567826f},
-std::array<float,2>{0.246630892f, 0.680497169f},
-std::array<float,2>{0.0485731289f, 0.386587292f},
-std::array<float,2>{0.542959094f, 0.506499231f},
-std::array<float,2>{0.839894235f, 0.135960951f},
-std::array<float,2>{0.314842582f, 0.771336436f},
-std::array<float,2>{0.16243121f, 0.204392433f},
-std::array<float,2>{0.663852096f, 0.832183778f},
-std::array<float,2>{0.911046982f, 0.446685314f},
-std::array<float,2>{0.378010184f, 0.572279692f},
-std::array<float,2>{0.274185568f, 0.341654003f},
-std::array<float,2>{0.78720969f, 0.738774717f},
-std::array<float,2>{0.563499808f, 0.0388591439f},
-std::array<float,2>{0.0894234553f, 0.897155583f},
-std::array<float,2>{0.3568151f, 0.167818561f},
-std::array<float,2>{0.872232676f, 0.805742979f},
-std::array<float,2>{0.51873374f, 0.407402813f},
-std::array<float,2>{0.00769777223f, 0.536116838f},
-std::array<float,2>{0.211197823f, 0.292646378f},
-std::array<float,2>{0.74448061f, 0.653531849f},
-std::array<float,2>{0.978947043f, 0.082874015f},
-std::array<float,2>{0.450892389f, 0.938486338f},
-std::array<float,2>{0.1227597f, 0.00989796501f},
-std::array<float,2>{0.594128311f, 0.915210724f},
-std::array<float,2>{0.757862389f, 0.355469376f},
-std::array<float,2>{0.301565677f, 0.701509237f},
-std::array<float,2>{0.410737723f, 0.485346198f},
-std::array<float,2>{0.898199439f, 0.604435325f},
-std::array<float,2>{0.647900879f, 0.234662384f},
-std::array<float,2>{0.135198697f, 0.850509107f},
-std::array<float,2>{0.405273736f, 0.229533255f},
-std::array<float,2>{0.924245834f, 0.864029348f},
-std::array<float,2>{0.678390086f, 0.48403731f},
-std::array<float,2>{0.180506185f, 0.616473436f},
-std::array<float,2>{0.0640952736f, 0.373663336f},
-std::array<float,2>{0.583386064f, 0.707264006f},
-std::array<float,2>{0.807542622f, 0.0266664084f},
-std::array<float,2>{0.261292189f, 0.926799238f},
-std::array<float,2>{0.23046039f, 0.0750437602f},
-std::array<float,2>{0.717887461f, 0.961866558f},
-std::array<float,2>{0.960728228f, 0.307328492f},
-std::array<float,2>{0.497602105f, 0.629410982f},
-std::array<float,2>{0.340586782f, 0.424480289f},
-std::array<float,2>{0.819562137f, 0.557066619f},
-std::array<float,2>{0.547262251f, 0.185084522f},
-std::array<float,2>{0.0403474756f, 0.7864604f},
-std::array<float,2>{0.288947821f, 0.0591994189f},
-std::array<float,2>{0.774662793f, 0.882551432f},
-std::array<float,2>{0.612288237f, 0.32125175f},
-std::array<float,2>{0.103418984f, 0.726120532f},
-std::array<float,2>{0.146461114f, 0.460702032f},
-std::array<float,2>{0.630234659f, 0.578500926f},
-std::array<float,2>{0.890014768f, 0.200055018f},
-std::array<float,2>{0.431012481f, 0.822541595f},
-std::array<float,2>{0.0237531047f, 0.149916559f},
-std::array<float,2>{0.50570941f, 0.757065654f},
-std::array<float,2>{0.848220587f, 0.392223269f},
-std::array<float,2>{0.374449641f, 0.526060522f},
-std::array<float,2>{0.454573333f, 0.261127561f},
-std::array<float,2>{0.987325907f, 0.66013521f},
-std::array<float,2>{0.728985548f, 0.109518208f},
-std::array<float,2>{0.196521312f, 0.976919174f}}
\ No newline at end of file
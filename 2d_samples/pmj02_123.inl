@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.809258342f, 0.366381258f},
-std::array<float,2>{0.270661205f, 0.524988174f},
-std::array<float,2>{0.064786911f, 0.150724351f},
-std::array<float,2>{0.637880206f, 0.937589586f},
-std::array<float,2>{0.614694357f, 0.122550629f},
-std::array<float,2>{0.190528169f, 0.858493388f},
-std::array<float,2>{0.493868738f, 0.45511654f},
-std::array<float,2>{0.942797124f, 0.643492579f},
-std::array<float,2>{0.928659856f, 0.213784575f},
-std::array<float,2>{0.425822794f, 0.877826631f},
-std::array<float,2>{0.180344328f, 0.292942882f},
-std::array<float,2>{0.505561888f, 0.567059457f},
-std::array<float,2>{0.730825603f, 0.421638906f},
-std::array<float,2>{0.0359415412f, 0.738924205f},
-std::array<float,2>{0.348573774f, 0.035819944f},
-std::array<float,2>{0.871964097f, 0.780741572f},
-std::array<float,2>{0.984826803f, 0.49437058f},
-std::array<float,2>{0.447635889f, 0.658889472f},
-std::array<float,2>{0.237205103f, 0.0730075538f},
-std::array<float,2>{0.572708666f, 0.816371024f},
-std::array<float,2>{0.670956075f, 0.166671634f},
-std::array<float,2>{0.100021824f, 0.978113294f},
-std::array<float,2>{0.298515618f, 0.341501027f},
-std::array<float,2>{0.752909303f, 0.537614048f},
-std::array<float,2>{0.836750269f, 0.00383417751f},
-std::array<float,2>{0.327590436f, 0.781418324f},
-std::array<float,2>{0.00827367138f, 0.382153928f},
-std::array<float,2>{0.687711477f, 0.710198581f},
-std::array<float,2>{0.534901261f, 0.258445501f},
-std::array<float,2>{0.126106322f, 0.603558362f},
-std::array<float,2>{0.382160187f, 0.226257488f},
-std::array<float,2>{0.897033989f, 0.926997304f},
-std::array<float,2>{0.849491298f, 0.395423502f},
-std::array<float,2>{0.371227592f, 0.691222847f},
-std::array<float,2>{0.0511573814f, 0.0300625544f},
-std::array<float,2>{0.739419162f, 0.800256789f},
-std::array<float,2>{0.519961953f, 0.245787174f},
-std::array<float,2>{0.159432173f, 0.91182524f},
-std::array<float,2>{0.408277899f, 0.270203978f},
-std::array<float,2>{0.911538243f, 0.620213032f},
-std::array<float,2>{0.966287673f, 0.0889039859f},
-std::array<float,2>{0.481295079f, 0.830809295f},
-std::array<float,2>{0.2149169f, 0.471777439f},
-std::array<float,2>{0.607431293f, 0.686395407f},
-std::array<float,2>{0.646461189f, 0.324946344f},
-std::array<float,2>{0.0927348658f, 0.555687964f},
-std::array<float,2>{0.256937444f, 0.183259517f},
-std::array<float,2>{0.796139181f, 0.985199153f},
-std::array<float,2>{0.882718384f, 0.305039674f},
-std::array<float,2>{0.39354679f, 0.585346162f},
-std::array<float,2>{0.142951116f, 0.195768043f},
-std::array<float,2>{0.559894502f, 0.90144527f},
-std::array<float,2>{0.703380764f, 0.0599375665f},
-std::array<float,2>{0.0158197824f, 0.750883281f},
-std::array<float,2>{0.343550146f, 0.426659048f},
-std::array<float,2>{0.826650202f, 0.723913968f},
-std::array<float,2>{0.772527516f, 0.137007415f},
-std::array<float,2>{0.293342084f, 0.966460943f},
-std::array<float,2>{0.116261803f, 0.348041445f},
-std::array<float,2>{0.686374426f, 0.514885724f},
-std::array<float,2>{0.587009788f, 0.446354926f},
-std::array<float,2>{0.219044015f, 0.629590094f},
-std::array<float,2>{0.457302362f, 0.101003617f},
-std::array<float,2>{0.972313464f, 0.873681784f},
-std::array<float,2>{0.817693949f, 0.275600523f},
-std::array<float,2>{0.332416207f, 0.615512908f},
-std::array<float,2>{0.0254641939f, 0.239890277f},
-std::array<float,2>{0.716559291f, 0.919619501f},
-std::array<float,2>{0.549666107f, 0.015962299f},
-std::array<float,2>{0.151435807f, 0.807460308f},
-std::array<float,2>{0.40204972f, 0.40274632f},
-std::array<float,2>{0.888699949f, 0.696115613f},
-std::array<float,2>{0.978598595f, 0.174811393f},
-std::array<float,2>{0.464087784f, 0.997031391f},
-std::array<float,2>{0.230081931f, 0.313550264f},
-std::array<float,2>{0.585758388f, 0.553993106f},
-std::array<float,2>{0.675209403f, 0.47740069f},
-std::array<float,2>{0.122881949f, 0.678262651f},
-std::array<float,2>{0.281549215f, 0.0829011202f},
-std::array<float,2>{0.777487218f, 0.843653381f},
-std::array<float,2>{0.918035269f, 0.435872942f},
-std::array<float,2>{0.419251084f, 0.731215596f},
-std::array<float,2>{0.168670878f, 0.0500046276f},
-std::array<float,2>{0.528751314f, 0.764630139f},
-std::array<float,2>{0.749391556f, 0.194676608f},
-std::array<float,2>{0.0618557781f, 0.896705568f},
-std::array<float,2>{0.366418153f, 0.300667495f},
-std::array<float,2>{0.854956806f, 0.58698976f},
-std::array<float,2>{0.781426966f, 0.10266728f},
-std::array<float,2>{0.263960391f, 0.859664798f},
-std::array<float,2>{0.0844377205f, 0.443471402f},
-std::array<float,2>{0.650394917f, 0.636265099f},
-std::array<float,2>{0.598085403f, 0.35804373f},
-std::array<float,2>{0.207812846f, 0.506709933f},
-std::array<float,2>{0.470799059f, 0.129501536f},
-std::array<float,2>{0.957134187f, 0.95529145f},
-std::array<float,2>{0.761440277f, 0.466833025f},
-std::array<float,2>{0.308461547f, 0.652292073f},
-std::array<float,2>{0.109158874f, 0.112826958f},
-std::array<float,2>{0.657829165f, 0.844563663f},
-std::array<float,2>{0.564115584f, 0.142568618f},
-std::array<float,2>{0.248084307f, 0.947317839f},
-std::array<float,2>{0.439468741f, 0.373299569f},
-std::array<float,2>{0.992288113f, 0.518715322f},
-std::array<float,2>{0.901302993f, 0.0404998362f},
-std::array<float,2>{0.390367597f, 0.767603815f},
-std::array<float,2>{0.140036523f, 0.413958222f},
-std::array<float,2>{0.543842793f, 0.748993874f},
-std::array<float,2>{0.69551903f, 0.287576616f},
-std::array<float,2>{0.00660693506f, 0.570729733f},
-std::array<float,2>{0.313842922f, 0.206880882f},
-std::array<float,2>{0.829008222f, 0.886632502f},
-std::array<float,2>{0.950511694f, 0.332616329f},
-std::array<float,2>{0.490267813f, 0.541977584f},
-std::array<float,2>{0.19875893f, 0.163794056f},
-std::array<float,2>{0.619523406f, 0.97544533f},
-std::array<float,2>{0.628398895f, 0.0685292408f},
-std::array<float,2>{0.077972658f, 0.826906323f},
-std::array<float,2>{0.276213974f, 0.487746149f},
-std::array<float,2>{0.798980415f, 0.670399845f},
-std::array<float,2>{0.861033082f, 0.233225152f},
-std::array<float,2>{0.3517676f, 0.930486739f},
-std::array<float,2>{0.045399759f, 0.252254218f},
-std::array<float,2>{0.720817506f, 0.599885404f},
-std::array<float,2>{0.514395714f, 0.384246111f},
-std::array<float,2>{0.176102579f, 0.714004993f},
-std::array<float,2>{0.430190653f, 0.0119453622f},
-std::array<float,2>{0.930935383f, 0.79661274f},
-std::array<float,2>{0.775873542f, 0.293025404f},
-std::array<float,2>{0.287875473f, 0.566118896f},
-std::array<float,2>{0.119043514f, 0.216466591f},
-std::array<float,2>{0.676479042f, 0.880742908f},
-std::array<float,2>{0.578840435f, 0.0326404907f},
-std::array<float,2>{0.230833381f, 0.775753677f},
-std::array<float,2>{0.466814488f, 0.415799528f},
-std::array<float,2>{0.984208405f, 0.736288965f},
-std::array<float,2>{0.883564234f, 0.153926775f},
-std::array<float,2>{0.403933227f, 0.941562295f},
-std::array<float,2>{0.153265104f, 0.361341f},
-std::array<float,2>{0.550886512f, 0.529999554f},
-std::array<float,2>{0.711708724f, 0.458470523f},
-std::array<float,2>{0.0302863494f, 0.64593935f},
-std::array<float,2>{0.329304129f, 0.117763199f},
-std::array<float,2>{0.812727571f, 0.853919029f},
-std::array<float,2>{0.953472257f, 0.378293306f},
-std::array<float,2>{0.473574787f, 0.705996633f},
-std::array<float,2>{0.206463054f, 0.00736420276f},
-std::array<float,2>{0.596848845f, 0.786600232f},
-std::array<float,2>{0.654524982f, 0.222111657f},
-std::array<float,2>{0.0820003673f, 0.925693929f},
-std::array<float,2>{0.261478156f, 0.262662351f},
-std::array<float,2>{0.788295209f, 0.608025849f},
-std::array<float,2>{0.85717845f, 0.0762833208f},
-std::array<float,2>{0.360990286f, 0.816538513f},
-std::array<float,2>{0.0570299774f, 0.499687821f},
-std::array<float,2>{0.745636642f, 0.663264215f},
-std::array<float,2>{0.525084972f, 0.336775213f},
-std::array<float,2>{0.164465189f, 0.535089552f},
-std::array<float,2>{0.416870177f, 0.168287262f},
-std::array<float,2>{0.916553259f, 0.98373574f},
-std::array<float,2>{0.83255142f, 0.474051297f},
-std::array<float,2>{0.316995382f, 0.682128251f},
-std::array<float,2>{0.00313175214f, 0.0911593661f},
-std::array<float,2>{0.701316595f, 0.832764208f},
-std::array<float,2>{0.542359233f, 0.184729293f},
-std::array<float,2>{0.133177906f, 0.991995454f},
-std::array<float,2>{0.383684605f, 0.322320729f},
-std::array<float,2>{0.902740538f, 0.559890389f},
-std::array<float,2>{0.99803704f, 0.024071563f},
-std::array<float,2>{0.441989869f, 0.803937972f},
-std::array<float,2>{0.244811177f, 0.392844826f},
-std::array<float,2>{0.568255723f, 0.693840861f},
-std::array<float,2>{0.663923621f, 0.268040091f},
-std::array<float,2>{0.103037387f, 0.623333395f},
-std::array<float,2>{0.311512649f, 0.248479962f},
-std::array<float,2>{0.761796892f, 0.90672487f},
-std::array<float,2>{0.934057057f, 0.3463898f},
-std::array<float,2>{0.435863703f, 0.507980049f},
-std::array<float,2>{0.172746047f, 0.136070549f},
-std::array<float,2>{0.510268152f, 0.961249352f},
-std::array<float,2>{0.723078251f, 0.0939734504f},
-std::array<float,2>{0.0418691672f, 0.86795944f},
-std::array<float,2>{0.357150942f, 0.452646166f},
-std::array<float,2>{0.865614891f, 0.628752768f},
-std::array<float,2>{0.800831378f, 0.202254161f},
-std::array<float,2>{0.27908498f, 0.904327571f},
-std::array<float,2>{0.0724779889f, 0.312439382f},
-std::array<float,2>{0.6295681f, 0.581323087f},
-std::array<float,2>{0.621129632f, 0.422013462f},
-std::array<float,2>{0.201797202f, 0.719601333f},
-std::array<float,2>{0.486119658f, 0.0556686483f},
-std::array<float,2>{0.946069062f, 0.754749775f},
-std::array<float,2>{0.869627655f, 0.316897988f},
-std::array<float,2>{0.345040083f, 0.549845278f},
-std::array<float,2>{0.0331393741f, 0.176800504f},
-std::array<float,2>{0.728346825f, 0.99432075f},
-std::array<float,2>{0.503822744f, 0.0791088119f},
-std::array<float,2>{0.185554549f, 0.837186873f},
-std::array<float,2>{0.422603577f, 0.480674207f},
-std::array<float,2>{0.922201216f, 0.673332095f},
-std::array<float,2>{0.938220918f, 0.237380281f},
-std::array<float,2>{0.496595532f, 0.917523563f},
-std::array<float,2>{0.192334577f, 0.278189689f},
-std::array<float,2>{0.610111117f, 0.612281919f},
-std::array<float,2>{0.63388133f, 0.400260448f},
-std::array<float,2>{0.0698922724f, 0.700721622f},
-std::array<float,2>{0.267226517f, 0.0217407942f},
-std::array<float,2>{0.805822492f, 0.809090674f},
-std::array<float,2>{0.890655279f, 0.440928221f},
-std::array<float,2>{0.377994448f, 0.639799595f},
-std::array<float,2>{0.129239902f, 0.106751762f},
-std::array<float,2>{0.535200536f, 0.865370989f},
-std::array<float,2>{0.694184124f, 0.12558344f},
-std::array<float,2>{0.0153977731f, 0.960405469f},
-std::array<float,2>{0.322152734f, 0.355207682f},
-std::array<float,2>{0.841130555f, 0.501065016f},
-std::array<float,2>{0.755194604f, 0.0519915f},
-std::array<float,2>{0.30106017f, 0.758673728f},
-std::array<float,2>{0.0972114503f, 0.430977225f},
-std::array<float,2>{0.665364265f, 0.728386521f},
-std::array<float,2>{0.577901304f, 0.303854972f},
-std::array<float,2>{0.239791065f, 0.593511224f},
-std::array<float,2>{0.451572657f, 0.189651996f},
-std::array<float,2>{0.989522159f, 0.892402947f},
-std::array<float,2>{0.791912079f, 0.407595009f},
-std::array<float,2>{0.252975762f, 0.744396448f},
-std::array<float,2>{0.0885868818f, 0.044878263f},
-std::array<float,2>{0.642775059f, 0.770884693f},
-std::array<float,2>{0.602922678f, 0.208998457f},
-std::array<float,2>{0.212644041f, 0.890329957f},
-std::array<float,2>{0.479260057f, 0.283665121f},
-std::array<float,2>{0.964809239f, 0.576938212f},
-std::array<float,2>{0.906268477f, 0.113568336f},
-std::array<float,2>{0.413403362f, 0.849195898f},
-std::array<float,2>{0.163949057f, 0.46355027f},
-std::array<float,2>{0.518767118f, 0.654365003f},
-std::array<float,2>{0.736769617f, 0.367928207f},
-std::array<float,2>{0.0499407388f, 0.520002484f},
-std::array<float,2>{0.370802373f, 0.148032457f},
-std::array<float,2>{0.847060621f, 0.952174306f},
-std::array<float,2>{0.976528883f, 0.255627811f},
-std::array<float,2>{0.453986198f, 0.595481694f},
-std::array<float,2>{0.223170072f, 0.23016499f},
-std::array<float,2>{0.591299474f, 0.93564266f},
-std::array<float,2>{0.682129383f, 0.00866248645f},
-std::array<float,2>{0.112495616f, 0.791227877f},
-std::array<float,2>{0.29106307f, 0.389427245f},
-std::array<float,2>{0.767096341f, 0.717333138f},
-std::array<float,2>{0.824161589f, 0.156777024f},
-std::array<float,2>{0.336562455f, 0.969480395f},
-std::array<float,2>{0.0223831069f, 0.330346525f},
-std::array<float,2>{0.707517684f, 0.545525908f},
-std::array<float,2>{0.557830334f, 0.489109069f},
-std::array<float,2>{0.148090631f, 0.665432334f},
-std::array<float,2>{0.395884573f, 0.0629774481f},
-std::array<float,2>{0.875383556f, 0.823894918f},
-std::array<float,2>{0.751631677f, 0.342089027f},
-std::array<float,2>{0.299785882f, 0.535835445f},
-std::array<float,2>{0.097885564f, 0.165776581f},
-std::array<float,2>{0.668524206f, 0.9791857f},
-std::array<float,2>{0.572016418f, 0.071156241f},
-std::array<float,2>{0.235011637f, 0.813439667f},
-std::array<float,2>{0.445401818f, 0.493919194f},
-std::array<float,2>{0.986337841f, 0.658089101f},
-std::array<float,2>{0.895349205f, 0.224139363f},
-std::array<float,2>{0.380245835f, 0.928931057f},
-std::array<float,2>{0.127327636f, 0.260791689f},
-std::array<float,2>{0.532143116f, 0.603337407f},
-std::array<float,2>{0.690737188f, 0.379519105f},
-std::array<float,2>{0.0103228875f, 0.708310902f},
-std::array<float,2>{0.325879633f, 0.000395926851f},
-std::array<float,2>{0.838976443f, 0.784983993f},
-std::array<float,2>{0.944024622f, 0.453588158f},
-std::array<float,2>{0.495991141f, 0.640737891f},
-std::array<float,2>{0.189246714f, 0.123878799f},
-std::array<float,2>{0.61546576f, 0.856525421f},
-std::array<float,2>{0.640268803f, 0.149281889f},
-std::array<float,2>{0.0641718209f, 0.940656066f},
-std::array<float,2>{0.2721591f, 0.364803046f},
-std::array<float,2>{0.810832024f, 0.527039826f},
-std::array<float,2>{0.873749018f, 0.0387501493f},
-std::array<float,2>{0.349848717f, 0.777801692f},
-std::array<float,2>{0.0386342555f, 0.419821113f},
-std::array<float,2>{0.733415008f, 0.741620243f},
-std::array<float,2>{0.505990088f, 0.290773928f},
-std::array<float,2>{0.181665793f, 0.569399595f},
-std::array<float,2>{0.428120494f, 0.212267622f},
-std::array<float,2>{0.926785469f, 0.875640392f},
-std::array<float,2>{0.825494647f, 0.42947799f},
-std::array<float,2>{0.340291351f, 0.725138843f},
-std::array<float,2>{0.0194294248f, 0.0619597919f},
-std::array<float,2>{0.705130219f, 0.752988458f},
-std::array<float,2>{0.562465131f, 0.197489485f},
-std::array<float,2>{0.140626818f, 0.900263548f},
-std::array<float,2>{0.39140597f, 0.308199406f},
-std::array<float,2>{0.879438102f, 0.583087504f},
-std::array<float,2>{0.968991637f, 0.0978431255f},
-std::array<float,2>{0.46090284f, 0.872405708f},
-std::array<float,2>{0.220962971f, 0.448295027f},
-std::array<float,2>{0.588503301f, 0.63153106f},
-std::array<float,2>{0.684119225f, 0.350318432f},
-std::array<float,2>{0.113565043f, 0.512781441f},
-std::array<float,2>{0.296433419f, 0.139507115f},
-std::array<float,2>{0.771035194f, 0.967297018f},
-std::array<float,2>{0.913256884f, 0.272192389f},
-std::array<float,2>{0.406618565f, 0.61777705f},
-std::array<float,2>{0.157990396f, 0.243286908f},
-std::array<float,2>{0.522222042f, 0.913955808f},
-std::array<float,2>{0.7416116f, 0.0279422663f},
-std::array<float,2>{0.0528243147f, 0.797429144f},
-std::array<float,2>{0.373243213f, 0.398049325f},
-std::array<float,2>{0.850579858f, 0.688291311f},
-std::array<float,2>{0.793241203f, 0.181042522f},
-std::array<float,2>{0.255680591f, 0.986541688f},
-std::array<float,2>{0.0912060812f, 0.326194018f},
-std::array<float,2>{0.646928549f, 0.558531523f},
-std::array<float,2>{0.606236458f, 0.470485896f},
-std::array<float,2>{0.216900826f, 0.685303986f},
-std::array<float,2>{0.483449042f, 0.0862538368f},
-std::array<float,2>{0.967152178f, 0.829360545f},
-std::array<float,2>{0.852415681f, 0.298671722f},
-std::array<float,2>{0.364485711f, 0.589679003f},
-std::array<float,2>{0.059281528f, 0.192304626f},
-std::array<float,2>{0.747798264f, 0.894542456f},
-std::array<float,2>{0.530353785f, 0.0486230813f},
-std::array<float,2>{0.170846894f, 0.763607979f},
-std::array<float,2>{0.420530796f, 0.433658838f},
-std::array<float,2>{0.921537638f, 0.732688546f},
-std::array<float,2>{0.959119737f, 0.131222785f},
-std::array<float,2>{0.469312221f, 0.954258084f},
-std::array<float,2>{0.209423393f, 0.35726735f},
-std::array<float,2>{0.600383759f, 0.505232513f},
-std::array<float,2>{0.648577988f, 0.442715347f},
-std::array<float,2>{0.0825616643f, 0.634305954f},
-std::array<float,2>{0.262532979f, 0.104824774f},
-std::array<float,2>{0.7847085f, 0.862993896f},
-std::array<float,2>{0.888321221f, 0.404882669f},
-std::array<float,2>{0.40020141f, 0.69884187f},
-std::array<float,2>{0.149362922f, 0.01781369f},
-std::array<float,2>{0.547212124f, 0.806357324f},
-std::array<float,2>{0.717535019f, 0.241979435f},
-std::array<float,2>{0.0245185122f, 0.921603978f},
-std::array<float,2>{0.335641891f, 0.275179327f},
-std::array<float,2>{0.819606662f, 0.613583326f},
-std::array<float,2>{0.781071782f, 0.0846266225f},
-std::array<float,2>{0.285084963f, 0.840806544f},
-std::array<float,2>{0.123472892f, 0.480095923f},
-std::array<float,2>{0.673466265f, 0.675923169f},
-std::array<float,2>{0.582886398f, 0.314922005f},
-std::array<float,2>{0.22766684f, 0.550885618f},
-std::array<float,2>{0.46269998f, 0.173275054f},
-std::array<float,2>{0.978053391f, 0.998333454f},
-std::array<float,2>{0.797956526f, 0.485691696f},
-std::array<float,2>{0.275252193f, 0.668455541f},
-std::array<float,2>{0.0749813691f, 0.0666296855f},
-std::array<float,2>{0.626737118f, 0.825718284f},
-std::array<float,2>{0.618810475f, 0.16100733f},
-std::array<float,2>{0.196543843f, 0.973784268f},
-std::array<float,2>{0.489379376f, 0.334241897f},
-std::array<float,2>{0.952247858f, 0.540103912f},
-std::array<float,2>{0.932613969f, 0.0151692266f},
-std::array<float,2>{0.432691157f, 0.794716656f},
-std::array<float,2>{0.177938536f, 0.384884477f},
-std::array<float,2>{0.513102293f, 0.712244332f},
-std::array<float,2>{0.720488429f, 0.250797987f},
-std::array<float,2>{0.043654725f, 0.598582089f},
-std::array<float,2>{0.354891658f, 0.232091054f},
-std::array<float,2>{0.86297673f, 0.932080328f},
-std::array<float,2>{0.995366633f, 0.371245891f},
-std::array<float,2>{0.438073844f, 0.516679227f},
-std::array<float,2>{0.247940183f, 0.143845528f},
-std::array<float,2>{0.565540791f, 0.946089804f},
-std::array<float,2>{0.659855545f, 0.110056385f},
-std::array<float,2>{0.106389031f, 0.845763266f},
-std::array<float,2>{0.305771053f, 0.466660798f},
-std::array<float,2>{0.758447051f, 0.649182737f},
-std::array<float,2>{0.830150127f, 0.203495204f},
-std::array<float,2>{0.316296875f, 0.88396728f},
-std::array<float,2>{0.00506048463f, 0.286535352f},
-std::array<float,2>{0.698783398f, 0.572954893f},
-std::array<float,2>{0.545009673f, 0.411821753f},
-std::array<float,2>{0.138259783f, 0.747575819f},
-std::array<float,2>{0.388565511f, 0.0420976579f},
-std::array<float,2>{0.899838567f, 0.767428815f},
-std::array<float,2>{0.785336137f, 0.26475206f},
-std::array<float,2>{0.259613007f, 0.60627073f},
-std::array<float,2>{0.0798485726f, 0.220349535f},
-std::array<float,2>{0.652449667f, 0.922011971f},
-std::array<float,2>{0.595548391f, 0.00573492516f},
-std::array<float,2>{0.204591691f, 0.788569212f},
-std::array<float,2>{0.475771695f, 0.375651717f},
-std::array<float,2>{0.956697464f, 0.703237772f},
-std::array<float,2>{0.9148947f, 0.171149194f},
-std::array<float,2>{0.415241688f, 0.980865896f},
-std::array<float,2>{0.167696759f, 0.33878535f},
-std::array<float,2>{0.525614023f, 0.532457113f},
-std::array<float,2>{0.742609918f, 0.497535229f},
-std::array<float,2>{0.0551367439f, 0.660802364f},
-std::array<float,2>{0.362855196f, 0.0743622035f},
-std::array<float,2>{0.857978284f, 0.818873107f},
-std::array<float,2>{0.981364369f, 0.417456985f},
-std::array<float,2>{0.465616047f, 0.73736316f},
-std::array<float,2>{0.232621104f, 0.0336178169f},
-std::array<float,2>{0.581475616f, 0.773481786f},
-std::array<float,2>{0.679457486f, 0.218367755f},
-std::array<float,2>{0.11974939f, 0.88185066f},
-std::array<float,2>{0.285835892f, 0.295798898f},
-std::array<float,2>{0.774427354f, 0.564392865f},
-std::array<float,2>{0.815873742f, 0.119913556f},
-std::array<float,2>{0.331353635f, 0.852703273f},
-std::array<float,2>{0.0286772382f, 0.459948033f},
-std::array<float,2>{0.71475035f, 0.648165047f},
-std::array<float,2>{0.554223001f, 0.359440655f},
-std::array<float,2>{0.154437974f, 0.528629363f},
-std::array<float,2>{0.405783981f, 0.156240523f},
-std::array<float,2>{0.885838032f, 0.943571329f},
-std::array<float,2>{0.865011156f, 0.450092226f},
-std::array<float,2>{0.359054327f, 0.625871241f},
-std::array<float,2>{0.0399439968f, 0.0970643535f},
-std::array<float,2>{0.724928319f, 0.869785488f},
-std::array<float,2>{0.508020222f, 0.134369403f},
-std::array<float,2>{0.175224379f, 0.964408576f},
-std::array<float,2>{0.434604019f, 0.344215095f},
-std::array<float,2>{0.936813056f, 0.510848403f},
-std::array<float,2>{0.948035657f, 0.0566918068f},
-std::array<float,2>{0.48764804f, 0.755941331f},
-std::array<float,2>{0.199751198f, 0.424011052f},
-std::array<float,2>{0.623877048f, 0.721919835f},
-std::array<float,2>{0.631320417f, 0.309672296f},
-std::array<float,2>{0.0711152405f, 0.57888335f},
-std::array<float,2>{0.280649781f, 0.20116891f},
-std::array<float,2>{0.803499103f, 0.90374285f},
-std::array<float,2>{0.904682398f, 0.320384115f},
-std::array<float,2>{0.386333495f, 0.562286139f},
-std::array<float,2>{0.13557294f, 0.186458275f},
-std::array<float,2>{0.539281428f, 0.989075184f},
-std::array<float,2>{0.699269772f, 0.0934786797f},
-std::array<float,2>{0.000940062862f, 0.834993124f},
-std::array<float,2>{0.318536371f, 0.47575736f},
-std::array<float,2>{0.83450222f, 0.681292474f},
-std::array<float,2>{0.764881313f, 0.246738255f},
-std::array<float,2>{0.310501128f, 0.908385575f},
-std::array<float,2>{0.105431713f, 0.266376555f},
-std::array<float,2>{0.660596728f, 0.622445226f},
-std::array<float,2>{0.569328487f, 0.39210704f},
-std::array<float,2>{0.243423358f, 0.693247616f},
-std::array<float,2>{0.444143623f, 0.0261988137f},
-std::array<float,2>{0.999030352f, 0.801667035f},
-std::array<float,2>{0.84194535f, 0.353187889f},
-std::array<float,2>{0.322374046f, 0.502090633f},
-std::array<float,2>{0.0132997846f, 0.128008932f},
-std::array<float,2>{0.693185151f, 0.957784474f},
-std::array<float,2>{0.537902534f, 0.108483717f},
-std::array<float,2>{0.13271977f, 0.864134073f},
-std::array<float,2>{0.376396149f, 0.438711703f},
-std::array<float,2>{0.893847346f, 0.638225257f},
-std::array<float,2>{0.991930544f, 0.188102499f},
-std::array<float,2>{0.450014353f, 0.893747389f},
-std::array<float,2>{0.241120309f, 0.301645726f},
-std::array<float,2>{0.575589657f, 0.591233432f},
-std::array<float,2>{0.667250693f, 0.433527589f},
-std::array<float,2>{0.0942728966f, 0.730116248f},
-std::array<float,2>{0.304253817f, 0.0538608469f},
-std::array<float,2>{0.757783175f, 0.759865344f},
-std::array<float,2>{0.925465226f, 0.482808232f},
-std::array<float,2>{0.425435215f, 0.6745556f},
-std::array<float,2>{0.183836848f, 0.0803008601f},
-std::array<float,2>{0.501543581f, 0.839158297f},
-std::array<float,2>{0.729825497f, 0.178620383f},
-std::array<float,2>{0.0339948311f, 0.99337846f},
-std::array<float,2>{0.34578675f, 0.319560945f},
-std::array<float,2>{0.867951214f, 0.548023641f},
-std::array<float,2>{0.807349265f, 0.0212020818f},
-std::array<float,2>{0.269498199f, 0.811453521f},
-std::array<float,2>{0.0670033991f, 0.400639892f},
-std::array<float,2>{0.635446012f, 0.70271039f},
-std::array<float,2>{0.612404704f, 0.280810654f},
-std::array<float,2>{0.194703281f, 0.611205757f},
-std::array<float,2>{0.499391615f, 0.235370651f},
-std::array<float,2>{0.939788461f, 0.915950119f},
-std::array<float,2>{0.769046724f, 0.387027711f},
-std::array<float,2>{0.290236115f, 0.716612756f},
-std::array<float,2>{0.110560037f, 0.0113357743f},
-std::array<float,2>{0.680006742f, 0.79036653f},
-std::array<float,2>{0.593215883f, 0.226948515f},
-std::array<float,2>{0.225169659f, 0.93409729f},
-std::array<float,2>{0.456517607f, 0.255990326f},
-std::array<float,2>{0.973243594f, 0.596449554f},
-std::array<float,2>{0.877437949f, 0.0647907555f},
-std::array<float,2>{0.397020519f, 0.822135985f},
-std::array<float,2>{0.145822793f, 0.491221517f},
-std::array<float,2>{0.556541383f, 0.667131007f},
-std::array<float,2>{0.709239364f, 0.329521179f},
-std::array<float,2>{0.0206999741f, 0.543934226f},
-std::array<float,2>{0.339237064f, 0.159614623f},
-std::array<float,2>{0.821737111f, 0.971947908f},
-std::array<float,2>{0.961662233f, 0.281632423f},
-std::array<float,2>{0.47796315f, 0.574471772f},
-std::array<float,2>{0.21464394f, 0.208741769f},
-std::array<float,2>{0.604883254f, 0.88750428f},
-std::array<float,2>{0.642127156f, 0.0455208682f},
-std::array<float,2>{0.0869203582f, 0.773437381f},
-std::array<float,2>{0.251352906f, 0.408392936f},
-std::array<float,2>{0.789726436f, 0.742439985f},
-std::array<float,2>{0.844162226f, 0.145819902f},
-std::array<float,2>{0.369049996f, 0.949799716f},
-std::array<float,2>{0.0485002063f, 0.370083451f},
-std::array<float,2>{0.735084713f, 0.522270918f},
-std::array<float,2>{0.516182125f, 0.461392701f},
-std::array<float,2>{0.161208972f, 0.653218329f},
-std::array<float,2>{0.412053943f, 0.115782194f},
-std::array<float,2>{0.909991622f, 0.851291001f},
-std::array<float,2>{0.769964635f, 0.348725915f},
-std::array<float,2>{0.29549709f, 0.514585316f},
-std::array<float,2>{0.11477045f, 0.138070196f},
-std::array<float,2>{0.684653699f, 0.964992106f},
-std::array<float,2>{0.589613259f, 0.100163743f},
-std::array<float,2>{0.222357333f, 0.874671221f},
-std::array<float,2>{0.459746867f, 0.445636898f},
-std::array<float,2>{0.970641971f, 0.630254269f},
-std::array<float,2>{0.879997849f, 0.196343824f},
-std::array<float,2>{0.392441452f, 0.900790632f},
-std::array<float,2>{0.142516121f, 0.30655399f},
-std::array<float,2>{0.560619533f, 0.584226012f},
-std::array<float,2>{0.706971943f, 0.427543074f},
-std::array<float,2>{0.0176285133f, 0.72355026f},
-std::array<float,2>{0.341040015f, 0.0593965501f},
-std::array<float,2>{0.824889004f, 0.751397848f},
-std::array<float,2>{0.968418181f, 0.470824569f},
-std::array<float,2>{0.483394206f, 0.686721861f},
-std::array<float,2>{0.218049541f, 0.0881251618f},
-std::array<float,2>{0.607048213f, 0.831315696f},
-std::array<float,2>{0.647806585f, 0.182005912f},
-std::array<float,2>{0.0898907334f, 0.985637903f},
-std::array<float,2>{0.254695684f, 0.325932086f},
-std::array<float,2>{0.794906497f, 0.555549145f},
-std::array<float,2>{0.850938916f, 0.0308572259f},
-std::array<float,2>{0.374754399f, 0.799283326f},
-std::array<float,2>{0.054331921f, 0.396404207f},
-std::array<float,2>{0.740956008f, 0.689739406f},
-std::array<float,2>{0.52328527f, 0.27094996f},
-std::array<float,2>{0.156357825f, 0.619762301f},
-std::array<float,2>{0.40816009f, 0.244561657f},
-std::array<float,2>{0.912420034f, 0.910578847f},
-std::array<float,2>{0.838863373f, 0.38152498f},
-std::array<float,2>{0.324964523f, 0.70954448f},
-std::array<float,2>{0.0108940704f, 0.00197354378f},
-std::array<float,2>{0.690308809f, 0.782481849f},
-std::array<float,2>{0.532307982f, 0.225502744f},
-std::array<float,2>{0.128459722f, 0.926345468f},
-std::array<float,2>{0.379723817f, 0.258813143f},
-std::array<float,2>{0.895678461f, 0.604735434f},
-std::array<float,2>{0.9880445f, 0.0733660832f},
-std::array<float,2>{0.446884036f, 0.815050781f},
-std::array<float,2>{0.23594439f, 0.495215684f},
-std::array<float,2>{0.57127732f, 0.659432828f},
-std::array<float,2>{0.669441104f, 0.340671688f},
-std::array<float,2>{0.0986998081f, 0.538333356f},
-std::array<float,2>{0.300389975f, 0.167082101f},
-std::array<float,2>{0.750527561f, 0.976611137f},
-std::array<float,2>{0.925839603f, 0.291701406f},
-std::array<float,2>{0.42880699f, 0.56782645f},
-std::array<float,2>{0.183057532f, 0.214478672f},
-std::array<float,2>{0.507490575f, 0.878188133f},
-std::array<float,2>{0.732773185f, 0.0362973735f},
-std::array<float,2>{0.0372174792f, 0.779643059f},
-std::array<float,2>{0.35070467f, 0.420561671f},
-std::array<float,2>{0.874251902f, 0.739988327f},
-std::array<float,2>{0.812372983f, 0.152210504f},
-std::array<float,2>{0.273316503f, 0.938620746f},
-std::array<float,2>{0.0631843433f, 0.36563012f},
-std::array<float,2>{0.639228463f, 0.524253845f},
-std::array<float,2>{0.616281569f, 0.456457973f},
-std::array<float,2>{0.187609345f, 0.644206822f},
-std::array<float,2>{0.49474287f, 0.121129744f},
-std::array<float,2>{0.944688439f, 0.857594728f},
-std::array<float,2>{0.861858189f, 0.253702641f},
-std::array<float,2>{0.3544119f, 0.601026297f},
-std::array<float,2>{0.0443701856f, 0.23397617f},
-std::array<float,2>{0.71888274f, 0.930989802f},
-std::array<float,2>{0.512376308f, 0.0136453761f},
-std::array<float,2>{0.179240718f, 0.795110166f},
-std::array<float,2>{0.43260166f, 0.383738726f},
-std::array<float,2>{0.933335006f, 0.712898731f},
-std::array<float,2>{0.951264381f, 0.162258863f},
-std::array<float,2>{0.48831436f, 0.976305127f},
-std::array<float,2>{0.195411175f, 0.333037376f},
-std::array<float,2>{0.617638648f, 0.542350948f},
-std::array<float,2>{0.625526786f, 0.486786604f},
-std::array<float,2>{0.0760874748f, 0.67131865f},
-std::array<float,2>{0.274078786f, 0.0695940107f},
-std::array<float,2>{0.79750818f, 0.827476084f},
-std::array<float,2>{0.89859426f, 0.412634015f},
-std::array<float,2>{0.3874062f, 0.749265611f},
-std::array<float,2>{0.13690874f, 0.0392735377f},
-std::array<float,2>{0.54608041f, 0.768641412f},
-std::array<float,2>{0.698077977f, 0.205300733f},
-std::array<float,2>{0.00448397454f, 0.885536969f},
-std::array<float,2>{0.315148145f, 0.288478374f},
-std::array<float,2>{0.831991553f, 0.571805298f},
-std::array<float,2>{0.759624302f, 0.112080276f},
-std::array<float,2>{0.305304796f, 0.845137894f},
-std::array<float,2>{0.106814124f, 0.467895627f},
-std::array<float,2>{0.658993483f, 0.650754333f},
-std::array<float,2>{0.564956069f, 0.374695927f},
-std::array<float,2>{0.246267006f, 0.517682254f},
-std::array<float,2>{0.438562274f, 0.141048253f},
-std::array<float,2>{0.994795263f, 0.948577762f},
-std::array<float,2>{0.783696592f, 0.44449389f},
-std::array<float,2>{0.263035506f, 0.635718882f},
-std::array<float,2>{0.083877787f, 0.101653904f},
-std::array<float,2>{0.650266647f, 0.860541761f},
-std::array<float,2>{0.601356804f, 0.130393133f},
-std::array<float,2>{0.21041204f, 0.956117451f},
-std::array<float,2>{0.46990481f, 0.358863831f},
-std::array<float,2>{0.960058808f, 0.507724285f},
-std::array<float,2>{0.920087576f, 0.0492090285f},
-std::array<float,2>{0.421618938f, 0.765124381f},
-std::array<float,2>{0.171023354f, 0.43697384f},
-std::array<float,2>{0.529854238f, 0.732295573f},
-std::array<float,2>{0.746461868f, 0.298870623f},
-std::array<float,2>{0.0597460791f, 0.58641547f},
-std::array<float,2>{0.363954484f, 0.194221571f},
-std::array<float,2>{0.852702618f, 0.898338556f},
-std::array<float,2>{0.977109849f, 0.31346488f},
-std::array<float,2>{0.461906999f, 0.553607106f},
-std::array<float,2>{0.227141201f, 0.174627185f},
-std::array<float,2>{0.583789885f, 0.997473776f},
-std::array<float,2>{0.672602117f, 0.0831273794f},
-std::array<float,2>{0.124864474f, 0.842353463f},
-std::array<float,2>{0.284057885f, 0.47760275f},
-std::array<float,2>{0.779340029f, 0.678740799f},
-std::array<float,2>{0.818910182f, 0.23921299f},
-std::array<float,2>{0.33494243f, 0.918787777f},
-std::array<float,2>{0.0241003707f, 0.277050108f},
-std::array<float,2>{0.718517542f, 0.616713047f},
-std::array<float,2>{0.548107862f, 0.404172778f},
-std::array<float,2>{0.149825037f, 0.696387649f},
-std::array<float,2>{0.398963094f, 0.017458519f},
-std::array<float,2>{0.886744738f, 0.80836755f},
-std::array<float,2>{0.804193735f, 0.311115503f},
-std::array<float,2>{0.279849797f, 0.580818117f},
-std::array<float,2>{0.071368508f, 0.201211154f},
-std::array<float,2>{0.632127643f, 0.9053846f},
-std::array<float,2>{0.624707401f, 0.0548322462f},
-std::array<float,2>{0.200525567f, 0.754892349f},
-std::array<float,2>{0.487103522f, 0.423018217f},
-std::array<float,2>{0.948854327f, 0.71975261f},
-std::array<float,2>{0.936032057f, 0.135727957f},
-std::array<float,2>{0.434373945f, 0.962671936f},
-std::array<float,2>{0.174059853f, 0.347282112f},
-std::array<float,2>{0.509458601f, 0.509533525f},
-std::array<float,2>{0.726351976f, 0.451900333f},
-std::array<float,2>{0.0410028435f, 0.627334058f},
-std::array<float,2>{0.358098388f, 0.0956944153f},
-std::array<float,2>{0.864058554f, 0.86912787f},
-std::array<float,2>{0.998249352f, 0.393811315f},
-std::array<float,2>{0.444533557f, 0.694669425f},
-std::array<float,2>{0.242592901f, 0.0244498961f},
-std::array<float,2>{0.56941539f, 0.803231537f},
-std::array<float,2>{0.661606848f, 0.249466211f},
-std::array<float,2>{0.103758201f, 0.907789171f},
-std::array<float,2>{0.308804274f, 0.268684715f},
-std::array<float,2>{0.764416277f, 0.624886692f},
-std::array<float,2>{0.835230947f, 0.0902008042f},
-std::array<float,2>{0.319806904f, 0.833607495f},
-std::array<float,2>{0.00160979596f, 0.472923338f},
-std::array<float,2>{0.700635076f, 0.682713389f},
-std::array<float,2>{0.54083401f, 0.323796391f},
-std::array<float,2>{0.13664411f, 0.559117258f},
-std::array<float,2>{0.385432184f, 0.183641389f},
-std::array<float,2>{0.905594707f, 0.99092263f},
-std::array<float,2>{0.859021962f, 0.49900496f},
-std::array<float,2>{0.361855447f, 0.662828386f},
-std::array<float,2>{0.0559337996f, 0.0779866055f},
-std::array<float,2>{0.743859291f, 0.817910314f},
-std::array<float,2>{0.526559412f, 0.169809073f},
-std::array<float,2>{0.166371956f, 0.983219802f},
-std::array<float,2>{0.414230049f, 0.337480634f},
-std::array<float,2>{0.915675282f, 0.534068108f},
-std::array<float,2>{0.956015646f, 0.00599703006f},
-std::array<float,2>{0.475566745f, 0.785926104f},
-std::array<float,2>{0.203354731f, 0.377447844f},
-std::array<float,2>{0.593815923f, 0.706797898f},
-std::array<float,2>{0.653514862f, 0.263519853f},
-std::array<float,2>{0.0785874724f, 0.609236598f},
-std::array<float,2>{0.258770823f, 0.221631199f},
-std::array<float,2>{0.786733687f, 0.924510181f},
-std::array<float,2>{0.885446787f, 0.362454295f},
-std::array<float,2>{0.404937983f, 0.530867994f},
-std::array<float,2>{0.156017408f, 0.152511895f},
-std::array<float,2>{0.553410113f, 0.942825556f},
-std::array<float,2>{0.71330601f, 0.118741691f},
-std::array<float,2>{0.02808607f, 0.855328858f},
-std::array<float,2>{0.330319554f, 0.457613707f},
-std::array<float,2>{0.814559162f, 0.644937098f},
-std::array<float,2>{0.773852825f, 0.215785623f},
-std::array<float,2>{0.287023664f, 0.879151762f},
-std::array<float,2>{0.121058583f, 0.294365257f},
-std::array<float,2>{0.678222239f, 0.56453371f},
-std::array<float,2>{0.580322862f, 0.414643884f},
-std::array<float,2>{0.234260127f, 0.735331893f},
-std::array<float,2>{0.466481984f, 0.0320591107f},
-std::array<float,2>{0.982394457f, 0.776428163f},
-std::array<float,2>{0.820471823f, 0.331197917f},
-std::array<float,2>{0.338044673f, 0.546699941f},
-std::array<float,2>{0.0196778588f, 0.158188418f},
-std::array<float,2>{0.710670948f, 0.969818592f},
-std::array<float,2>{0.554723322f, 0.0643208995f},
-std::array<float,2>{0.145364001f, 0.822398126f},
-std::array<float,2>{0.398370504f, 0.489833355f},
-std::array<float,2>{0.878432989f, 0.664098799f},
-std::array<float,2>{0.973654211f, 0.228544161f},
-std::array<float,2>{0.455476969f, 0.936579704f},
-std::array<float,2>{0.226167917f, 0.254393011f},
-std::array<float,2>{0.592101634f, 0.593834579f},
-std::array<float,2>{0.680976987f, 0.390274197f},
-std::array<float,2>{0.109429777f, 0.717997789f},
-std::array<float,2>{0.289128602f, 0.00946437754f},
-std::array<float,2>{0.768330395f, 0.792849898f},
-std::array<float,2>{0.908272803f, 0.464121133f},
-std::array<float,2>{0.410937786f, 0.655754745f},
-std::array<float,2>{0.160869867f, 0.114672586f},
-std::array<float,2>{0.517457128f, 0.847916186f},
-std::array<float,2>{0.735423088f, 0.147083834f},
-std::array<float,2>{0.0473657437f, 0.951381087f},
-std::array<float,2>{0.367850929f, 0.368669987f},
-std::array<float,2>{0.844964743f, 0.521416366f},
-std::array<float,2>{0.790795982f, 0.0433713235f},
-std::array<float,2>{0.250309348f, 0.769752085f},
-std::array<float,2>{0.086300239f, 0.406415522f},
-std::array<float,2>{0.640765488f, 0.745284736f},
-std::array<float,2>{0.604442418f, 0.284574062f},
-std::array<float,2>{0.213342145f, 0.577527583f},
-std::array<float,2>{0.477083564f, 0.210464835f},
-std::array<float,2>{0.961922109f, 0.889111161f},
-std::array<float,2>{0.756352782f, 0.429757297f},
-std::array<float,2>{0.302734971f, 0.727170527f},
-std::array<float,2>{0.095191434f, 0.0510980561f},
-std::array<float,2>{0.666407168f, 0.759342551f},
-std::array<float,2>{0.574839234f, 0.190643713f},
-std::array<float,2>{0.242110774f, 0.891076922f},
-std::array<float,2>{0.451015651f, 0.303119272f},
-std::array<float,2>{0.99055773f, 0.592675567f},
-std::array<float,2>{0.893349409f, 0.105792448f},
-std::array<float,2>{0.375445426f, 0.866729259f},
-std::array<float,2>{0.131776795f, 0.440106004f},
-std::array<float,2>{0.538814783f, 0.639009416f},
-std::array<float,2>{0.692100227f, 0.353534937f},
-std::array<float,2>{0.0120548476f, 0.500353098f},
-std::array<float,2>{0.323636025f, 0.126254246f},
-std::array<float,2>{0.843250513f, 0.959518313f},
-std::array<float,2>{0.940900743f, 0.278562218f},
-std::array<float,2>{0.498476148f, 0.613180518f},
-std::array<float,2>{0.193986073f, 0.236746714f},
-std::array<float,2>{0.611716151f, 0.916363299f},
-std::array<float,2>{0.636092722f, 0.0233218279f},
-std::array<float,2>{0.067935057f, 0.809818327f},
-std::array<float,2>{0.268373877f, 0.398845851f},
-std::array<float,2>{0.807920337f, 0.699899077f},
-std::array<float,2>{0.868510306f, 0.176587343f},
-std::array<float,2>{0.347018391f, 0.995586812f},
-std::array<float,2>{0.0347762741f, 0.31817764f},
-std::array<float,2>{0.728902876f, 0.549766898f},
-std::array<float,2>{0.50025785f, 0.481997699f},
-std::array<float,2>{0.185274586f, 0.672744215f},
-std::array<float,2>{0.424079627f, 0.0786763728f},
-std::array<float,2>{0.924245477f, 0.836342812f},
-std::array<float,2>{0.795152187f, 0.328069955f},
-std::array<float,2>{0.256796181f, 0.556976318f},
-std::array<float,2>{0.0929911733f, 0.180528566f},
-std::array<float,2>{0.644876182f, 0.987401247f},
-std::array<float,2>{0.608540833f, 0.0877696872f},
-std::array<float,2>{0.216675267f, 0.828223944f},
-std::array<float,2>{0.481949061f, 0.469431102f},
-std::array<float,2>{0.965735078f, 0.684062779f},
-std::array<float,2>{0.91034919f, 0.24233377f},
-std::array<float,2>{0.409683019f, 0.912248075f},
-std::array<float,2>{0.159060583f, 0.272958547f},
-std::array<float,2>{0.520748079f, 0.6182428f},
-std::array<float,2>{0.73844862f, 0.397172153f},
-std::array<float,2>{0.0524687842f, 0.688815117f},
-std::array<float,2>{0.372111261f, 0.0286811572f},
-std::array<float,2>{0.847990692f, 0.798748434f},
-std::array<float,2>{0.971440911f, 0.447735757f},
-std::array<float,2>{0.458402216f, 0.632056952f},
-std::array<float,2>{0.219901413f, 0.0992135704f},
-std::array<float,2>{0.586579978f, 0.871472418f},
-std::array<float,2>{0.686976194f, 0.14062196f},
-std::array<float,2>{0.115618221f, 0.968015134f},
-std::array<float,2>{0.294677824f, 0.351211578f},
-std::array<float,2>{0.771807015f, 0.512299061f},
-std::array<float,2>{0.827171922f, 0.0607636906f},
-std::array<float,2>{0.342230022f, 0.752549946f},
-std::array<float,2>{0.0170949381f, 0.427748203f},
-std::array<float,2>{0.704345345f, 0.725981355f},
-std::array<float,2>{0.559412718f, 0.306650698f},
-std::array<float,2>{0.14449288f, 0.58299309f},
-std::array<float,2>{0.393847972f, 0.198483661f},
-std::array<float,2>{0.881624579f, 0.899328232f},
-std::array<float,2>{0.872595072f, 0.418169796f},
-std::array<float,2>{0.349363089f, 0.740767419f},
-std::array<float,2>{0.0366323479f, 0.0375664271f},
-std::array<float,2>{0.732245386f, 0.779261112f},
-std::array<float,2>{0.504370153f, 0.211598516f},
-std::array<float,2>{0.180787221f, 0.876947165f},
-std::array<float,2>{0.426798582f, 0.289384991f},
-std::array<float,2>{0.929425716f, 0.568923891f},
-std::array<float,2>{0.941762626f, 0.124519236f},
-std::array<float,2>{0.492557138f, 0.855809927f},
-std::array<float,2>{0.189823866f, 0.454246849f},
-std::array<float,2>{0.613804758f, 0.641815305f},
-std::array<float,2>{0.637111068f, 0.363829136f},
-std::array<float,2>{0.0658887997f, 0.525414944f},
-std::array<float,2>{0.270290077f, 0.149837971f},
-std::array<float,2>{0.809947014f, 0.939595222f},
-std::array<float,2>{0.898314655f, 0.260047048f},
-std::array<float,2>{0.381316483f, 0.601678491f},
-std::array<float,2>{0.125833616f, 0.222965762f},
-std::array<float,2>{0.533830404f, 0.928236246f},
-std::array<float,2>{0.688793182f, 0.00162188231f},
-std::array<float,2>{0.00960248336f, 0.78324461f},
-std::array<float,2>{0.326409757f, 0.380774081f},
-std::array<float,2>{0.837842762f, 0.7074247f},
-std::array<float,2>{0.753578663f, 0.165027082f},
-std::array<float,2>{0.297467917f, 0.980440259f},
-std::array<float,2>{0.101011246f, 0.343605518f},
-std::array<float,2>{0.670868635f, 0.536443472f},
-std::array<float,2>{0.573986113f, 0.492280394f},
-std::array<float,2>{0.237882584f, 0.656458259f},
-std::array<float,2>{0.448493928f, 0.0715891942f},
-std::array<float,2>{0.985505104f, 0.814029336f},
-std::array<float,2>{0.829590917f, 0.285433799f},
-std::array<float,2>{0.313459367f, 0.573577523f},
-std::array<float,2>{0.00732680364f, 0.204615697f},
-std::array<float,2>{0.696619451f, 0.882888556f},
-std::array<float,2>{0.544197321f, 0.041407086f},
-std::array<float,2>{0.138780534f, 0.76630187f},
-std::array<float,2>{0.389522731f, 0.410977215f},
-std::array<float,2>{0.901383638f, 0.746721804f},
-std::array<float,2>{0.993427575f, 0.142669171f},
-std::array<float,2>{0.440936953f, 0.946401954f},
-std::array<float,2>{0.249566048f, 0.372227609f},
-std::array<float,2>{0.562712014f, 0.516406119f},
-std::array<float,2>{0.657053947f, 0.464970499f},
-std::array<float,2>{0.107488297f, 0.650167406f},
-std::array<float,2>{0.306934088f, 0.110934503f},
-std::array<float,2>{0.759923398f, 0.847006917f},
-std::array<float,2>{0.929786563f, 0.386451662f},
-std::array<float,2>{0.430921912f, 0.711112916f},
-std::array<float,2>{0.177007407f, 0.0144636985f},
-std::array<float,2>{0.515365005f, 0.793748438f},
-std::array<float,2>{0.721822441f, 0.230788976f},
-std::array<float,2>{0.0466232933f, 0.932753384f},
-std::array<float,2>{0.353016794f, 0.25115329f},
-std::array<float,2>{0.859493315f, 0.598740041f},
-std::array<float,2>{0.800501168f, 0.0679588914f},
-std::array<float,2>{0.276597798f, 0.824711442f},
-std::array<float,2>{0.0769482702f, 0.48486504f},
-std::array<float,2>{0.627230585f, 0.669493973f},
-std::array<float,2>{0.620848477f, 0.335632145f},
-std::array<float,2>{0.197876558f, 0.539939344f},
-std::array<float,2>{0.491868496f, 0.16146028f},
-std::array<float,2>{0.949468076f, 0.973330796f},
-std::array<float,2>{0.778847754f, 0.478780001f},
-std::array<float,2>{0.28282854f, 0.677640438f},
-std::array<float,2>{0.121665262f, 0.0851632208f},
-std::array<float,2>{0.674404383f, 0.840967774f},
-std::array<float,2>{0.584226787f, 0.172368273f},
-std::array<float,2>{0.22896795f, 0.999551237f},
-std::array<float,2>{0.463564694f, 0.316197485f},
-std::array<float,2>{0.979537487f, 0.552670538f},
-std::array<float,2>{0.890235245f, 0.0186474603f},
-std::array<float,2>{0.401095986f, 0.805192888f},
-std::array<float,2>{0.151021242f, 0.405998647f},
-std::array<float,2>{0.549831271f, 0.697441339f},
-std::array<float,2>{0.715310395f, 0.274379075f},
-std::array<float,2>{0.0266706999f, 0.614287853f},
-std::array<float,2>{0.333097428f, 0.240492567f},
-std::array<float,2>{0.817290187f, 0.920585871f},
-std::array<float,2>{0.958888292f, 0.356217146f},
-std::array<float,2>{0.47221753f, 0.504547238f},
-std::array<float,2>{0.20891279f, 0.132075727f},
-std::array<float,2>{0.59959954f, 0.953473806f},
-std::array<float,2>{0.651928425f, 0.104240581f},
-std::array<float,2>{0.0851268545f, 0.862104475f},
-std::array<float,2>{0.264796555f, 0.442357749f},
-std::array<float,2>{0.783186436f, 0.633638561f},
-std::array<float,2>{0.853779316f, 0.19332996f},
-std::array<float,2>{0.365770668f, 0.896141648f},
-std::array<float,2>{0.061029993f, 0.2974976f},
-std::array<float,2>{0.748988271f, 0.588545501f},
-std::array<float,2>{0.527529061f, 0.434754729f},
-std::array<float,2>{0.169853956f, 0.73369199f},
-std::array<float,2>{0.418531597f, 0.0470233522f},
-std::array<float,2>{0.919728398f, 0.762124002f},
-std::array<float,2>{0.762832522f, 0.266929567f},
-std::array<float,2>{0.311758757f, 0.621352255f},
-std::array<float,2>{0.102089636f, 0.248020247f},
-std::array<float,2>{0.662877738f, 0.910139024f},
-std::array<float,2>{0.566596925f, 0.0268329363f},
-std::array<float,2>{0.245830089f, 0.802661657f},
-std::array<float,2>{0.442499399f, 0.390817732f},
-std::array<float,2>{0.996624589f, 0.691772938f},
-std::array<float,2>{0.903811276f, 0.186889619f},
-std::array<float,2>{0.383951992f, 0.989680588f},
-std::array<float,2>{0.133969873f, 0.322065175f},
-std::array<float,2>{0.54114753f, 0.561210096f},
-std::array<float,2>{0.70269227f, 0.475519687f},
-std::array<float,2>{0.00209588651f, 0.680496693f},
-std::array<float,2>{0.317495108f, 0.091822885f},
-std::array<float,2>{0.833398581f, 0.834226429f},
-std::array<float,2>{0.946763098f, 0.425177038f},
-std::array<float,2>{0.484536231f, 0.72135675f},
-std::array<float,2>{0.203082368f, 0.058569558f},
-std::array<float,2>{0.622600377f, 0.757308841f},
-std::array<float,2>{0.630470634f, 0.199310914f},
-std::array<float,2>{0.0738290474f, 0.902627885f},
-std::array<float,2>{0.277693599f, 0.308915943f},
-std::array<float,2>{0.802243769f, 0.579316437f},
-std::array<float,2>{0.866303444f, 0.096438691f},
-std::array<float,2>{0.355919242f, 0.870147407f},
-std::array<float,2>{0.0420377813f, 0.450610638f},
-std::array<float,2>{0.723716795f, 0.626022041f},
-std::array<float,2>{0.511032104f, 0.345311433f},
-std::array<float,2>{0.172933444f, 0.510636449f},
-std::array<float,2>{0.437421113f, 0.133714899f},
-std::array<float,2>{0.935398936f, 0.963289857f},
-std::array<float,2>{0.813881814f, 0.460438967f},
-std::array<float,2>{0.328947127f, 0.646829605f},
-std::array<float,2>{0.0300258584f, 0.120960891f},
-std::array<float,2>{0.712343812f, 0.852359533f},
-std::array<float,2>{0.552728415f, 0.154616386f},
-std::array<float,2>{0.154080361f, 0.944969296f},
-std::array<float,2>{0.403318733f, 0.361021042f},
-std::array<float,2>{0.884323478f, 0.527872562f},
-std::array<float,2>{0.982432723f, 0.0348855481f},
-std::array<float,2>{0.468493104f, 0.775181949f},
-std::array<float,2>{0.231651366f, 0.41661042f},
-std::array<float,2>{0.57968694f, 0.736811519f},
-std::array<float,2>{0.677098393f, 0.296253651f},
-std::array<float,2>{0.117301047f, 0.563023329f},
-std::array<float,2>{0.288651884f, 0.217252553f},
-std::array<float,2>{0.776950896f, 0.881490648f},
-std::array<float,2>{0.917892277f, 0.339267254f},
-std::array<float,2>{0.417052686f, 0.531487286f},
-std::array<float,2>{0.165412188f, 0.170580208f},
-std::array<float,2>{0.523608267f, 0.982153535f},
-std::array<float,2>{0.744792938f, 0.0756783858f},
-std::array<float,2>{0.0581133477f, 0.820242703f},
-std::array<float,2>{0.360016346f, 0.49701336f},
-std::array<float,2>{0.856032312f, 0.661634088f},
-std::array<float,2>{0.788021624f, 0.218794048f},
-std::array<float,2>{0.260155708f, 0.923431039f},
-std::array<float,2>{0.0803784505f, 0.264047354f},
-std::array<float,2>{0.655619442f, 0.607192338f},
-std::array<float,2>{0.595766068f, 0.37623331f},
-std::array<float,2>{0.205475479f, 0.704587519f},
-std::array<float,2>{0.47430414f, 0.00458684564f},
-std::array<float,2>{0.954705f, 0.787340343f},
-std::array<float,2>{0.846544445f, 0.370860189f},
-std::array<float,2>{0.36921528f, 0.522583961f},
-std::array<float,2>{0.0491090193f, 0.145108715f},
-std::array<float,2>{0.737600446f, 0.950890481f},
-std::array<float,2>{0.518227398f, 0.116753578f},
-std::array<float,2>{0.163024411f, 0.849937916f},
-std::array<float,2>{0.412932366f, 0.462026536f},
-std::array<float,2>{0.907612085f, 0.654019594f},
-std::array<float,2>{0.963589787f, 0.20764862f},
-std::array<float,2>{0.480421722f, 0.887928188f},
-std::array<float,2>{0.211325556f, 0.282426268f},
-std::array<float,2>{0.602080941f, 0.575944602f},
-std::array<float,2>{0.644040287f, 0.409879595f},
-std::array<float,2>{0.089603968f, 0.74412775f},
-std::array<float,2>{0.252639264f, 0.0464277901f},
-std::array<float,2>{0.792456627f, 0.771852374f},
-std::array<float,2>{0.876227856f, 0.490700692f},
-std::array<float,2>{0.395019591f, 0.666429579f},
-std::array<float,2>{0.147226378f, 0.0655148029f},
-std::array<float,2>{0.557543874f, 0.820728779f},
-std::array<float,2>{0.708160877f, 0.158923343f},
-std::array<float,2>{0.0232688822f, 0.970894456f},
-std::array<float,2>{0.337862968f, 0.328411937f},
-std::array<float,2>{0.823031843f, 0.544287503f},
-std::array<float,2>{0.766015887f, 0.0104321493f},
-std::array<float,2>{0.292585641f, 0.789703012f},
-std::array<float,2>{0.111574233f, 0.387883961f},
-std::array<float,2>{0.682843983f, 0.715484977f},
-std::array<float,2>{0.589858532f, 0.257451445f},
-std::array<float,2>{0.224601746f, 0.59679395f},
-std::array<float,2>{0.454110444f, 0.227753013f},
-std::array<float,2>{0.975169003f, 0.934780598f},
-std::array<float,2>{0.805142224f, 0.40215084f},
-std::array<float,2>{0.266318619f, 0.701195955f},
-std::array<float,2>{0.0684529319f, 0.0204056688f},
-std::array<float,2>{0.63355571f, 0.812347233f},
-std::array<float,2>{0.61079663f, 0.234565124f},
-std::array<float,2>{0.192643493f, 0.914397418f},
-std::array<float,2>{0.497421086f, 0.280050367f},
-std::array<float,2>{0.939020157f, 0.609957695f},
-std::array<float,2>{0.92378813f, 0.0810616687f},
-std::array<float,2>{0.423143804f, 0.838347077f},
-std::array<float,2>{0.18705526f, 0.484124362f},
-std::array<float,2>{0.502767742f, 0.675522387f},
-std::array<float,2>{0.726916254f, 0.318378955f},
-std::array<float,2>{0.031353265f, 0.546932876f},
-std::array<float,2>{0.344409049f, 0.179021686f},
-std::array<float,2>{0.870607436f, 0.993020654f},
-std::array<float,2>{0.988579631f, 0.302504629f},
-std::array<float,2>{0.45245856f, 0.590701938f},
-std::array<float,2>{0.238894045f, 0.18857111f},
-std::array<float,2>{0.576269567f, 0.893501699f},
-std::array<float,2>{0.664304972f, 0.053558901f},
-std::array<float,2>{0.0965512469f, 0.761128306f},
-std::array<float,2>{0.302363634f, 0.431648672f},
-std::array<float,2>{0.754178226f, 0.729109466f},
-std::array<float,2>{0.839940786f, 0.127362013f},
-std::array<float,2>{0.320803106f, 0.95885843f},
-std::array<float,2>{0.0145559805f, 0.351866961f},
-std::array<float,2>{0.694370508f, 0.503269911f},
-std::array<float,2>{0.536183119f, 0.437789351f},
-std::array<float,2>{0.13066946f, 0.637412488f},
-std::array<float,2>{0.377364486f, 0.108365603f},
-std::array<float,2>{0.892187476f, 0.864732921f},
-std::array<float,2>{0.782684803f, 0.359048188f},
-std::array<float,2>{0.265468359f, 0.507062435f},
-std::array<float,2>{0.0854607224f, 0.130342498f},
-std::array<float,2>{0.651522338f, 0.957018256f},
-std::array<float,2>{0.598934233f, 0.102066323f},
-std::array<float,2>{0.208391711f, 0.861256063f},
-std::array<float,2>{0.471861571f, 0.445199847f},
-std::array<float,2>{0.958399773f, 0.635184586f},
-std::array<float,2>{0.919010818f, 0.193777367f},
-std::array<float,2>{0.417973191f, 0.897580028f},
-std::array<float,2>{0.169158652f, 0.299445122f},
-std::array<float,2>{0.528237998f, 0.5866431f},
-std::array<float,2>{0.748416662f, 0.43724525f},
-std::array<float,2>{0.0612053983f, 0.731835306f},
-std::array<float,2>{0.365529299f, 0.0495481677f},
-std::array<float,2>{0.854385316f, 0.765419066f},
-std::array<float,2>{0.980013907f, 0.478207082f},
-std::array<float,2>{0.463312f, 0.679376066f},
-std::array<float,2>{0.229107931f, 0.0837894306f},
-std::array<float,2>{0.584504545f, 0.841806889f},
-std::array<float,2>{0.674064398f, 0.174224645f},
-std::array<float,2>{0.121400736f, 0.997713268f},
-std::array<float,2>{0.282462418f, 0.312595248f},
-std::array<float,2>{0.778478384f, 0.552958488f},
-std::array<float,2>{0.816626787f, 0.0169701222f},
-std::array<float,2>{0.333951652f, 0.807970345f},
-std::array<float,2>{0.0272404067f, 0.403766274f},
-std::array<float,2>{0.715443373f, 0.697005153f},
-std::array<float,2>{0.550535679f, 0.27654317f},
-std::array<float,2>{0.150785029f, 0.616425931f},
-std::array<float,2>{0.400700927f, 0.238408267f},
-std::array<float,2>{0.889734507f, 0.918414533f},
-std::array<float,2>{0.860175967f, 0.383240551f},
-std::array<float,2>{0.353053898f, 0.713646948f},
-std::array<float,2>{0.0463245697f, 0.0127856852f},
-std::array<float,2>{0.722411931f, 0.79548043f},
-std::array<float,2>{0.514949739f, 0.233713821f},
-std::array<float,2>{0.177507758f, 0.931154847f},
-std::array<float,2>{0.431392908f, 0.253397107f},
-std::array<float,2>{0.930598378f, 0.601164579f},
-std::array<float,2>{0.950060844f, 0.0701635554f},
-std::array<float,2>{0.491594046f, 0.827874005f},
-std::array<float,2>{0.19755654f, 0.486949027f},
-std::array<float,2>{0.620397508f, 0.671659768f},
-std::array<float,2>{0.627712488f, 0.333610028f},
-std::array<float,2>{0.0764686242f, 0.542662501f},
-std::array<float,2>{0.277269572f, 0.162623107f},
-std::array<float,2>{0.800129712f, 0.9759624f},
-std::array<float,2>{0.902226865f, 0.288745433f},
-std::array<float,2>{0.388792068f, 0.571289897f},
-std::array<float,2>{0.139562294f, 0.205766842f},
-std::array<float,2>{0.544495821f, 0.885230541f},
-std::array<float,2>{0.697234094f, 0.0395840965f},
-std::array<float,2>{0.00700192014f, 0.76911974f},
-std::array<float,2>{0.312757105f, 0.412321359f},
-std::array<float,2>{0.829423249f, 0.749602735f},
-std::array<float,2>{0.760543168f, 0.141449958f},
-std::array<float,2>{0.307316959f, 0.948950231f},
-std::array<float,2>{0.108141147f, 0.374067724f},
-std::array<float,2>{0.656714261f, 0.518129408f},
-std::array<float,2>{0.563368142f, 0.468576938f},
-std::array<float,2>{0.249455675f, 0.651361942f},
-std::array<float,2>{0.440612316f, 0.111520134f},
-std::array<float,2>{0.994116902f, 0.845513821f},
-std::array<float,2>{0.837126315f, 0.259320855f},
-std::array<float,2>{0.326855302f, 0.605104446f},
-std::array<float,2>{0.00921046268f, 0.224968418f},
-std::array<float,2>{0.689248681f, 0.926268935f},
-std::array<float,2>{0.533599854f, 0.00289811031f},
-std::array<float,2>{0.125364631f, 0.782806695f},
-std::array<float,2>{0.381396115f, 0.381002545f},
-std::array<float,2>{0.897487342f, 0.709354877f},
-std::array<float,2>{0.985849619f, 0.167590261f},
-std::array<float,2>{0.4490273f, 0.977053583f},
-std::array<float,2>{0.237526342f, 0.339930892f},
-std::array<float,2>{0.573728204f, 0.538948834f},
-std::array<float,2>{0.670023143f, 0.495851547f},
-std::array<float,2>{0.101471603f, 0.66005981f},
-std::array<float,2>{0.297112346f, 0.0740719885f},
-std::array<float,2>{0.753070235f, 0.814460695f},
-std::array<float,2>{0.928970873f, 0.420260012f},
-std::array<float,2>{0.427414596f, 0.739519894f},
-std::array<float,2>{0.18138887f, 0.0371029153f},
-std::array<float,2>{0.50469321f, 0.780007482f},
-std::array<float,2>{0.731458783f, 0.214164615f},
-std::array<float,2>{0.0363790989f, 0.878628433f},
-std::array<float,2>{0.348686635f, 0.291150689f},
-std::array<float,2>{0.872402608f, 0.567919493f},
-std::array<float,2>{0.810157299f, 0.121807627f},
-std::array<float,2>{0.269899011f, 0.858263791f},
-std::array<float,2>{0.0663363114f, 0.45677194f},
-std::array<float,2>{0.637550354f, 0.643934071f},
-std::array<float,2>{0.613638282f, 0.366093695f},
-std::array<float,2>{0.190327302f, 0.523800433f},
-std::array<float,2>{0.492963552f, 0.151591361f},
-std::array<float,2>{0.942119896f, 0.939214647f},
-std::array<float,2>{0.772140503f, 0.446068585f},
-std::array<float,2>{0.294395149f, 0.630565464f},
-std::array<float,2>{0.115909658f, 0.0999486372f},
-std::array<float,2>{0.687387288f, 0.874407172f},
-std::array<float,2>{0.58602643f, 0.138611346f},
-std::array<float,2>{0.220546991f, 0.965479791f},
-std::array<float,2>{0.458858103f, 0.349392414f},
-std::array<float,2>{0.97072947f, 0.514064193f},
-std::array<float,2>{0.880940855f, 0.0590032302f},
-std::array<float,2>{0.394165486f, 0.751517296f},
-std::array<float,2>{0.143739596f, 0.427055866f},
-std::array<float,2>{0.558895648f, 0.722889423f},
-std::array<float,2>{0.704724312f, 0.305926025f},
-std::array<float,2>{0.0170555264f, 0.584923506f},
-std::array<float,2>{0.342360824f, 0.197034866f},
-std::array<float,2>{0.827854335f, 0.901168168f},
-std::array<float,2>{0.964957297f, 0.325394273f},
-std::array<float,2>{0.481885135f, 0.555072248f},
-std::array<float,2>{0.21592173f, 0.182144195f},
-std::array<float,2>{0.608996332f, 0.986169696f},
-std::array<float,2>{0.645452619f, 0.0888304263f},
-std::array<float,2>{0.0936041996f, 0.831886828f},
-std::array<float,2>{0.256119758f, 0.471324176f},
-std::array<float,2>{0.795471251f, 0.687207758f},
-std::array<float,2>{0.848577321f, 0.245087475f},
-std::array<float,2>{0.372761339f, 0.910688221f},
-std::array<float,2>{0.051945474f, 0.271003574f},
-std::array<float,2>{0.739146411f, 0.619234502f},
-std::array<float,2>{0.521303415f, 0.395562708f},
-std::array<float,2>{0.158522159f, 0.690057993f},
-std::array<float,2>{0.409550101f, 0.0302999243f},
-std::array<float,2>{0.911115289f, 0.799322724f},
-std::array<float,2>{0.754441142f, 0.303554803f},
-std::array<float,2>{0.301770836f, 0.591890275f},
-std::array<float,2>{0.0960946754f, 0.191145092f},
-std::array<float,2>{0.665005028f, 0.891177535f},
-std::array<float,2>{0.576812565f, 0.0516308695f},
-std::array<float,2>{0.238506272f, 0.758929014f},
-std::array<float,2>{0.45301643f, 0.430434525f},
-std::array<float,2>{0.989166856f, 0.726654708f},
-std::array<float,2>{0.891902685f, 0.126740307f},
-std::array<float,2>{0.377901673f, 0.959466219f},
-std::array<float,2>{0.130325258f, 0.35422653f},
-std::array<float,2>{0.53681308f, 0.500956893f},
-std::array<float,2>{0.694882035f, 0.439707547f},
-std::array<float,2>{0.0141090639f, 0.639188707f},
-std::array<float,2>{0.320466995f, 0.106079556f},
-std::array<float,2>{0.840392768f, 0.86649406f},
-std::array<float,2>{0.938907206f, 0.399279624f},
-std::array<float,2>{0.497639149f, 0.699651122f},
-std::array<float,2>{0.193111315f, 0.0225165915f},
-std::array<float,2>{0.611166716f, 0.810189009f},
-std::array<float,2>{0.633116961f, 0.236856997f},
-std::array<float,2>{0.0690569207f, 0.916936457f},
-std::array<float,2>{0.265680641f, 0.279242456f},
-std::array<float,2>{0.805396259f, 0.61242187f},
-std::array<float,2>{0.87057054f, 0.0785562024f},
-std::array<float,2>{0.343979925f, 0.836900175f},
-std::array<float,2>{0.0320931971f, 0.481792033f},
-std::array<float,2>{0.727306426f, 0.672037542f},
-std::array<float,2>{0.50238812f, 0.317758679f},
-std::array<float,2>{0.186647609f, 0.548910797f},
-std::array<float,2>{0.423658222f, 0.176184371f},
-std::array<float,2>{0.922867239f, 0.995646715f},
-std::array<float,2>{0.822302938f, 0.489353478f},
-std::array<float,2>{0.336930931f, 0.665023625f},
-std::array<float,2>{0.0224964954f, 0.0638017729f},
-std::array<float,2>{0.708765924f, 0.822807252f},
-std::array<float,2>{0.557017207f, 0.157334715f},
-std::array<float,2>{0.146685153f, 0.97029233f},
-std::array<float,2>{0.395001173f, 0.331731528f},
-std::array<float,2>{0.876609564f, 0.546247423f},
-std::array<float,2>{0.974766135f, 0.00890737772f},
-std::array<float,2>{0.454642117f, 0.792069316f},
-std::array<float,2>{0.223824665f, 0.389778793f},
-std::array<float,2>{0.590627611f, 0.718659401f},
-std::array<float,2>{0.683443308f, 0.254784316f},
-std::array<float,2>{0.111892566f, 0.594274759f},
-std::array<float,2>{0.292471915f, 0.229337305f},
-std::array<float,2>{0.7662642f, 0.937023699f},
-std::array<float,2>{0.908168375f, 0.368226886f},
-std::array<float,2>{0.41257745f, 0.520727456f},
-std::array<float,2>{0.162216395f, 0.146847457f},
-std::array<float,2>{0.517833471f, 0.951824546f},
-std::array<float,2>{0.7379511f, 0.114819065f},
-std::array<float,2>{0.0494723059f, 0.848497391f},
-std::array<float,2>{0.369681865f, 0.464727193f},
-std::array<float,2>{0.845792353f, 0.655787945f},
-std::array<float,2>{0.792783976f, 0.210004896f},
-std::array<float,2>{0.252364814f, 0.889441907f},
-std::array<float,2>{0.0890845284f, 0.285140365f},
-std::array<float,2>{0.644181371f, 0.57809484f},
-std::array<float,2>{0.601813495f, 0.407045275f},
-std::array<float,2>{0.211748183f, 0.745868504f},
-std::array<float,2>{0.479774863f, 0.0436245501f},
-std::array<float,2>{0.963297129f, 0.770289421f},
-std::array<float,2>{0.855759621f, 0.337066501f},
-std::array<float,2>{0.359418035f, 0.533534765f},
-std::array<float,2>{0.0578364655f, 0.169237599f},
-std::array<float,2>{0.744344175f, 0.982451916f},
-std::array<float,2>{0.524176359f, 0.0774796829f},
-std::array<float,2>{0.165659785f, 0.817736804f},
-std::array<float,2>{0.417703956f, 0.498262167f},
-std::array<float,2>{0.917141199f, 0.662232935f},
-std::array<float,2>{0.954139173f, 0.221158043f},
-std::array<float,2>{0.473756582f, 0.923894823f},
-std::array<float,2>{0.206031442f, 0.26293084f},
-std::array<float,2>{0.596225262f, 0.608764827f},
-std::array<float,2>{0.656229436f, 0.377338529f},
-std::array<float,2>{0.0807972997f, 0.706289411f},
-std::array<float,2>{0.260469198f, 0.00647334196f},
-std::array<float,2>{0.787201643f, 0.785437405f},
-std::array<float,2>{0.883893549f, 0.457344443f},
-std::array<float,2>{0.402642816f, 0.645475149f},
-std::array<float,2>{0.153439805f, 0.118568599f},
-std::array<float,2>{0.551774144f, 0.854631543f},
-std::array<float,2>{0.712759912f, 0.153096646f},
-std::array<float,2>{0.0296131484f, 0.94287914f},
-std::array<float,2>{0.328306645f, 0.363116443f},
-std::array<float,2>{0.813999891f, 0.530603349f},
-std::array<float,2>{0.776609123f, 0.0316753574f},
-std::array<float,2>{0.288117737f, 0.776886225f},
-std::array<float,2>{0.117690325f, 0.414486319f},
-std::array<float,2>{0.677548051f, 0.734753251f},
-std::array<float,2>{0.579193294f, 0.294840187f},
-std::array<float,2>{0.232119441f, 0.565205038f},
-std::array<float,2>{0.467889071f, 0.214874819f},
-std::array<float,2>{0.983071625f, 0.879810631f},
-std::array<float,2>{0.802405655f, 0.423803419f},
-std::array<float,2>{0.278266817f, 0.72040087f},
-std::array<float,2>{0.0732859969f, 0.0556485914f},
-std::array<float,2>{0.630320549f, 0.75582093f},
-std::array<float,2>{0.622151554f, 0.202057421f},
-std::array<float,2>{0.202446565f, 0.90612793f},
-std::array<float,2>{0.485137045f, 0.310844541f},
-std::array<float,2>{0.946964562f, 0.580433726f},
-std::array<float,2>{0.934796929f, 0.0949636549f},
-std::array<float,2>{0.436786175f, 0.868567228f},
-std::array<float,2>{0.173377305f, 0.451532215f},
-std::array<float,2>{0.511702418f, 0.627880692f},
-std::array<float,2>{0.724207759f, 0.34683913f},
-std::array<float,2>{0.0425176322f, 0.50924176f},
-std::array<float,2>{0.356325507f, 0.134807661f},
-std::array<float,2>{0.86684972f, 0.96199578f},
-std::array<float,2>{0.996293783f, 0.269326627f},
-std::array<float,2>{0.443015873f, 0.624471724f},
-std::array<float,2>{0.245554864f, 0.249609694f},
-std::array<float,2>{0.567210376f, 0.907491028f},
-std::array<float,2>{0.662226856f, 0.0252047349f},
-std::array<float,2>{0.10159874f, 0.802937686f},
-std::array<float,2>{0.312074095f, 0.394370735f},
-std::array<float,2>{0.763485014f, 0.694888532f},
-std::array<float,2>{0.833870232f, 0.184249908f},
-std::array<float,2>{0.317993283f, 0.990673184f},
-std::array<float,2>{0.00259237131f, 0.323361874f},
-std::array<float,2>{0.702168524f, 0.558673501f},
-std::array<float,2>{0.541743219f, 0.473625988f},
-std::array<float,2>{0.134343699f, 0.683395386f},
-std::array<float,2>{0.384595215f, 0.0904589146f},
-std::array<float,2>{0.903635144f, 0.833136916f},
-std::array<float,2>{0.780055642f, 0.31562078f},
-std::array<float,2>{0.283539474f, 0.551932395f},
-std::array<float,2>{0.124154732f, 0.171927407f},
-std::array<float,2>{0.67224437f, 0.999176264f},
-std::array<float,2>{0.583481908f, 0.0855291709f},
-std::array<float,2>{0.226842701f, 0.841763198f},
-std::array<float,2>{0.460983157f, 0.479476392f},
-std::array<float,2>{0.97664088f, 0.676997304f},
-std::array<float,2>{0.887611628f, 0.241046548f},
-std::array<float,2>{0.398550212f, 0.920126736f},
-std::array<float,2>{0.150260642f, 0.273604244f},
-std::array<float,2>{0.54873091f, 0.614808917f},
-std::array<float,2>{0.71785754f, 0.405413985f},
-std::array<float,2>{0.0238936022f, 0.69813931f},
-std::array<float,2>{0.334318757f, 0.0192276109f},
-std::array<float,2>{0.818811655f, 0.804756105f},
-std::array<float,2>{0.960569918f, 0.441748649f},
-std::array<float,2>{0.470236212f, 0.633007109f},
-std::array<float,2>{0.210499808f, 0.103816614f},
-std::array<float,2>{0.600837529f, 0.861372828f},
-std::array<float,2>{0.649590254f, 0.132422268f},
-std::array<float,2>{0.0831263363f, 0.953971207f},
-std::array<float,2>{0.263479888f, 0.355775744f},
-std::array<float,2>{0.783603728f, 0.504029095f},
-std::array<float,2>{0.853319943f, 0.0474756733f},
-std::array<float,2>{0.363494933f, 0.762613714f},
-std::array<float,2>{0.0603662804f, 0.435252488f},
-std::array<float,2>{0.747035205f, 0.734072685f},
-std::array<float,2>{0.529363155f, 0.297136247f},
-std::array<float,2>{0.17166844f, 0.588037729f},
-std::array<float,2>{0.420913488f, 0.192633957f},
-std::array<float,2>{0.920570612f, 0.895743847f},
-std::array<float,2>{0.831121862f, 0.410396278f},
-std::array<float,2>{0.314796865f, 0.746534586f},
-std::array<float,2>{0.00395189738f, 0.0417811424f},
-std::array<float,2>{0.69727087f, 0.7659688f},
-std::array<float,2>{0.546539545f, 0.204501763f},
-std::array<float,2>{0.137237489f, 0.883771062f},
-std::array<float,2>{0.387187213f, 0.28568694f},
-std::array<float,2>{0.899249077f, 0.573775828f},
-std::array<float,2>{0.994351089f, 0.110429473f},
-std::array<float,2>{0.439230263f, 0.847239316f},
-std::array<float,2>{0.246636391f, 0.465663195f},
-std::array<float,2>{0.564907789f, 0.649703503f},
-std::array<float,2>{0.658313692f, 0.372700423f},
-std::array<float,2>{0.107268855f, 0.515988588f},
-std::array<float,2>{0.305052519f, 0.143466339f},
-std::array<float,2>{0.759204388f, 0.94705981f},
-std::array<float,2>{0.932699561f, 0.251593202f},
-std::array<float,2>{0.431976199f, 0.599185407f},
-std::array<float,2>{0.178734392f, 0.230987757f},
-std::array<float,2>{0.511917651f, 0.933160424f},
-std::array<float,2>{0.71972388f, 0.0136986207f},
-std::array<float,2>{0.0445928425f, 0.793247581f},
-std::array<float,2>{0.353795946f, 0.385885268f},
-std::array<float,2>{0.86150682f, 0.71143955f},
-std::array<float,2>{0.79697907f, 0.161835894f},
-std::array<float,2>{0.273545742f, 0.972914696f},
-std::array<float,2>{0.0756593123f, 0.335332483f},
-std::array<float,2>{0.625298023f, 0.539337575f},
-std::array<float,2>{0.61796701f, 0.484744996f},
-std::array<float,2>{0.195946753f, 0.669254065f},
-std::array<float,2>{0.488854855f, 0.0673848987f},
-std::array<float,2>{0.951829255f, 0.824675977f},
-std::array<float,2>{0.874910772f, 0.289619356f},
-std::array<float,2>{0.351188153f, 0.568846405f},
-std::array<float,2>{0.0376477242f, 0.210938856f},
-std::array<float,2>{0.733078241f, 0.876174986f},
-std::array<float,2>{0.507096112f, 0.0377134904f},
-std::array<float,2>{0.183300078f, 0.778624594f},
-std::array<float,2>{0.429524571f, 0.418693006f},
-std::array<float,2>{0.926593363f, 0.740563452f},
-std::array<float,2>{0.945151806f, 0.150087982f},
-std::array<float,2>{0.494345009f, 0.940392196f},
-std::array<float,2>{0.188125134f, 0.363313317f},
-std::array<float,2>{0.616888583f, 0.526062846f},
-std::array<float,2>{0.639073491f, 0.454787046f},
-std::array<float,2>{0.0628017634f, 0.64226371f},
-std::array<float,2>{0.272646666f, 0.124282032f},
-std::array<float,2>{0.811650157f, 0.8563869f},
-std::array<float,2>{0.896265388f, 0.38019833f},
-std::array<float,2>{0.378927976f, 0.707859635f},
-std::array<float,2>{0.128020227f, 0.00117482035f},
-std::array<float,2>{0.532800198f, 0.783792675f},
-std::array<float,2>{0.689761043f, 0.223202184f},
-std::array<float,2>{0.0116884513f, 0.928055584f},
-std::array<float,2>{0.324665844f, 0.260571927f},
-std::array<float,2>{0.838195324f, 0.602223158f},
-std::array<float,2>{0.750127137f, 0.0720637441f},
-std::array<float,2>{0.30026111f, 0.813720405f},
-std::array<float,2>{0.0994716659f, 0.492864281f},
-std::array<float,2>{0.668985248f, 0.657027066f},
-std::array<float,2>{0.570800722f, 0.343176931f},
-std::array<float,2>{0.23546192f, 0.536638141f},
-std::array<float,2>{0.446386874f, 0.164400771f},
-std::array<float,2>{0.987446845f, 0.979839087f},
-std::array<float,2>{0.793991148f, 0.468984574f},
-std::array<float,2>{0.254371405f, 0.684262812f},
-std::array<float,2>{0.0906081945f, 0.0872423053f},
-std::array<float,2>{0.648065448f, 0.829029918f},
-std::array<float,2>{0.606841147f, 0.179926336f},
-std::array<float,2>{0.218285203f, 0.98799628f},
-std::array<float,2>{0.482735544f, 0.327388495f},
-std::array<float,2>{0.967891634f, 0.557168305f},
-std::array<float,2>{0.91274333f, 0.0292711426f},
-std::array<float,2>{0.407362729f, 0.797985733f},
-std::array<float,2>{0.157006606f, 0.396926522f},
-std::array<float,2>{0.522593856f, 0.689122796f},
-std::array<float,2>{0.740269244f, 0.272574067f},
-std::array<float,2>{0.0540292636f, 0.619118214f},
-std::array<float,2>{0.374510497f, 0.242972806f},
-std::array<float,2>{0.851155996f, 0.913043559f},
-std::array<float,2>{0.970181704f, 0.350829959f},
-std::array<float,2>{0.459433138f, 0.512089252f},
-std::array<float,2>{0.221736148f, 0.140121505f},
-std::array<float,2>{0.588954628f, 0.968694448f},
-std::array<float,2>{0.685070276f, 0.098902002f},
-std::array<float,2>{0.114625603f, 0.87204957f},
-std::array<float,2>{0.29517135f, 0.447939485f},
-std::array<float,2>{0.770228505f, 0.632743359f},
-std::array<float,2>{0.824517846f, 0.199059874f},
-std::array<float,2>{0.341439605f, 0.898925483f},
-std::array<float,2>{0.0182225257f, 0.307146639f},
-std::array<float,2>{0.706077516f, 0.582349896f},
-std::array<float,2>{0.561125636f, 0.428471059f},
-std::array<float,2>{0.14195548f, 0.726440549f},
-std::array<float,2>{0.392086357f, 0.0611054488f},
-std::array<float,2>{0.880824685f, 0.752326846f},
-std::array<float,2>{0.808403909f, 0.279681176f},
-std::array<float,2>{0.26758182f, 0.609814405f},
-std::array<float,2>{0.0673927069f, 0.234956741f},
-std::array<float,2>{0.636365116f, 0.915003061f},
-std::array<float,2>{0.611963868f, 0.0198439807f},
-std::array<float,2>{0.193640426f, 0.81169343f},
-std::array<float,2>{0.499019086f, 0.401661843f},
-std::array<float,2>{0.940971196f, 0.702051699f},
-std::array<float,2>{0.924336851f, 0.179320022f},
-std::array<float,2>{0.424459636f, 0.99256748f},
-std::array<float,2>{0.184875071f, 0.319061607f},
-std::array<float,2>{0.500946879f, 0.547730803f},
-std::array<float,2>{0.729292572f, 0.483456343f},
-std::array<float,2>{0.0345315523f, 0.675292015f},
-std::array<float,2>{0.347329229f, 0.0818182528f},
-std::array<float,2>{0.868685424f, 0.838537097f},
-std::array<float,2>{0.991140425f, 0.432327807f},
-std::array<float,2>{0.450672418f, 0.728546858f},
-std::array<float,2>{0.241669416f, 0.0527538359f},
-std::array<float,2>{0.574318647f, 0.761693597f},
-std::array<float,2>{0.666896641f, 0.189353138f},
-std::array<float,2>{0.0953266472f, 0.892614663f},
-std::array<float,2>{0.303477913f, 0.302029371f},
-std::array<float,2>{0.755925298f, 0.590125322f},
-std::array<float,2>{0.843742311f, 0.107588746f},
-std::array<float,2>{0.323983967f, 0.865108967f},
-std::array<float,2>{0.0126254456f, 0.438054353f},
-std::array<float,2>{0.691545248f, 0.636972904f},
-std::array<float,2>{0.538538694f, 0.352072179f},
-std::array<float,2>{0.131217942f, 0.50350672f},
-std::array<float,2>{0.375950217f, 0.127479449f},
-std::array<float,2>{0.893018126f, 0.958212197f},
-std::array<float,2>{0.845596373f, 0.462580264f},
-std::array<float,2>{0.367298126f, 0.653805077f},
-std::array<float,2>{0.0473134294f, 0.116289265f},
-std::array<float,2>{0.73631525f, 0.850530744f},
-std::array<float,2>{0.516633987f, 0.144822717f},
-std::array<float,2>{0.160314426f, 0.950364232f},
-std::array<float,2>{0.410296023f, 0.370545685f},
-std::array<float,2>{0.908988774f, 0.523328125f},
-std::array<float,2>{0.962872863f, 0.0460323915f},
-std::array<float,2>{0.476696938f, 0.772019923f},
-std::array<float,2>{0.213506877f, 0.409250438f},
-std::array<float,2>{0.603772044f, 0.743193805f},
-std::array<float,2>{0.641247094f, 0.283091277f},
-std::array<float,2>{0.0864344835f, 0.575236976f},
-std::array<float,2>{0.25048992f, 0.207198799f},
-std::array<float,2>{0.790057182f, 0.888660014f},
-std::array<float,2>{0.877940774f, 0.329017341f},
-std::array<float,2>{0.39750582f, 0.544830024f},
-std::array<float,2>{0.144651413f, 0.158377603f},
-std::array<float,2>{0.55531472f, 0.971468329f},
-std::array<float,2>{0.710414946f, 0.0659940466f},
-std::array<float,2>{0.0203477666f, 0.821272492f},
-std::array<float,2>{0.338594913f, 0.491063833f},
-std::array<float,2>{0.821285844f, 0.666956186f},
-std::array<float,2>{0.76786691f, 0.228221223f},
-std::array<float,2>{0.28959313f, 0.935205638f},
-std::array<float,2>{0.110105917f, 0.257088661f},
-std::array<float,2>{0.681507766f, 0.597421169f},
-std::array<float,2>{0.592398703f, 0.388327658f},
-std::array<float,2>{0.225807443f, 0.714938223f},
-std::array<float,2>{0.455822915f, 0.00983481854f},
-std::array<float,2>{0.974143982f, 0.789166629f},
-std::array<float,2>{0.815396607f, 0.360444635f},
-std::array<float,2>{0.330922723f, 0.527518272f},
-std::array<float,2>{0.0276173633f, 0.155223072f},
-std::array<float,2>{0.713781714f, 0.944750905f},
-std::array<float,2>{0.552831471f, 0.120467067f},
-std::array<float,2>{0.155686945f, 0.851670742f},
-std::array<float,2>{0.404437572f, 0.460897207f},
-std::array<float,2>{0.885210574f, 0.647352695f},
-std::array<float,2>{0.981553435f, 0.217612654f},
-std::array<float,2>{0.466101915f, 0.880971491f},
-std::array<float,2>{0.233869627f, 0.296448141f},
-std::array<float,2>{0.580583096f, 0.562957585f},
-std::array<float,2>{0.678319812f, 0.416141123f},
-std::array<float,2>{0.120279424f, 0.737172008f},
-std::array<float,2>{0.286230862f, 0.034636043f},
-std::array<float,2>{0.773962915f, 0.774606645f},
-std::array<float,2>{0.915442109f, 0.496331155f},
-std::array<float,2>{0.414590418f, 0.661573648f},
-std::array<float,2>{0.166553482f, 0.0757720321f},
-std::array<float,2>{0.527173877f, 0.819511175f},
-std::array<float,2>{0.743597031f, 0.170297116f},
-std::array<float,2>{0.0562239066f, 0.981573105f},
-std::array<float,2>{0.361615866f, 0.339525193f},
-std::array<float,2>{0.858554065f, 0.531973898f},
-std::array<float,2>{0.786422491f, 0.00404923037f},
-std::array<float,2>{0.258035034f, 0.787672937f},
-std::array<float,2>{0.0791014209f, 0.376808822f},
-std::array<float,2>{0.653907716f, 0.70495975f},
-std::array<float,2>{0.594546318f, 0.264166176f},
-std::array<float,2>{0.204023302f, 0.606611133f},
-std::array<float,2>{0.475071847f, 0.219561294f},
-std::array<float,2>{0.955511451f, 0.922858417f},
-std::array<float,2>{0.763981998f, 0.391363055f},
-std::array<float,2>{0.309310645f, 0.692142665f},
-std::array<float,2>{0.104417048f, 0.0272369497f},
-std::array<float,2>{0.661907911f, 0.801940918f},
-std::array<float,2>{0.570252001f, 0.247137651f},
-std::array<float,2>{0.242762774f, 0.909300804f},
-std::array<float,2>{0.445144027f, 0.26727283f},
-std::array<float,2>{0.998572767f, 0.621915758f},
-std::array<float,2>{0.90587908f, 0.0926698223f},
-std::array<float,2>{0.38493669f, 0.834536552f},
-std::array<float,2>{0.135806352f, 0.474740058f},
-std::array<float,2>{0.540487587f, 0.67979759f},
-std::array<float,2>{0.700902998f, 0.321719944f},
-std::array<float,2>{0.00136927108f, 0.560685933f},
-std::array<float,2>{0.319956958f, 0.187103823f},
-std::array<float,2>{0.835736871f, 0.989953279f},
-std::array<float,2>{0.948480725f, 0.309149235f},
-std::array<float,2>{0.486366808f, 0.579982817f},
-std::array<float,2>{0.200952083f, 0.199963659f},
-std::array<float,2>{0.624465048f, 0.903052807f},
-std::array<float,2>{0.632734418f, 0.0579022728f},
-std::array<float,2>{0.0720967352f, 0.757457137f},
-std::array<float,2>{0.279641271f, 0.425652534f},
-std::array<float,2>{0.804636896f, 0.720842063f},
-std::array<float,2>{0.863592505f, 0.132890612f},
-std::array<float,2>{0.357440263f, 0.963770032f},
-std::array<float,2>{0.0403501168f, 0.34503457f},
-std::array<float,2>{0.725876331f, 0.509817541f},
-std::array<float,2>{0.509007335f, 0.450805366f},
-std::array<float,2>{0.174326852f, 0.626865864f},
-std::array<float,2>{0.433727384f, 0.0961250737f},
-std::array<float,2>{0.936222732f, 0.870794237f},
-std::array<float,2>{0.757963836f, 0.373568982f},
-std::array<float,2>{0.306616426f, 0.519357324f},
-std::array<float,2>{0.105514586f, 0.142031878f},
-std::array<float,2>{0.659384847f, 0.94801724f},
-std::array<float,2>{0.56640017f, 0.112497449f},
-std::array<float,2>{0.247260377f, 0.844104946f},
-std::array<float,2>{0.43782115f, 0.467366874f},
-std::array<float,2>{0.995706081f, 0.651368439f},
-std::array<float,2>{0.900277257f, 0.206333682f},
-std::array<float,2>{0.387949556f, 0.885950029f},
-std::array<float,2>{0.137783408f, 0.287903756f},
-std::array<float,2>{0.545858443f, 0.570832551f},
-std::array<float,2>{0.698393345f, 0.413127512f},
-std::array<float,2>{0.00564034469f, 0.748495817f},
-std::array<float,2>{0.315479428f, 0.0405850299f},
-std::array<float,2>{0.8308779f, 0.768183768f},
-std::array<float,2>{0.953006864f, 0.488045692f},
-std::array<float,2>{0.489954829f, 0.670415342f},
-std::array<float,2>{0.196921214f, 0.0692944899f},
-std::array<float,2>{0.618207037f, 0.826589882f},
-std::array<float,2>{0.626015365f, 0.163465172f},
-std::array<float,2>{0.0746947974f, 0.97471875f},
-std::array<float,2>{0.274840742f, 0.332077235f},
-std::array<float,2>{0.798561454f, 0.541195691f},
-std::array<float,2>{0.862376273f, 0.0123480428f},
-std::array<float,2>{0.35498324f, 0.796352088f},
-std::array<float,2>{0.0430685058f, 0.384477586f},
-std::array<float,2>{0.720138669f, 0.714502752f},
-std::array<float,2>{0.513278425f, 0.25282681f},
-std::array<float,2>{0.178592011f, 0.600317538f},
-std::array<float,2>{0.433219582f, 0.232803687f},
-std::array<float,2>{0.931879222f, 0.929738522f},
-std::array<float,2>{0.819971681f, 0.403146714f},
-std::array<float,2>{0.335101426f, 0.695424914f},
-std::array<float,2>{0.0250362232f, 0.0161290336f},
-std::array<float,2>{0.717049003f, 0.807044446f},
-std::array<float,2>{0.547735035f, 0.239352241f},
-std::array<float,2>{0.148659706f, 0.919430494f},
-std::array<float,2>{0.399889588f, 0.276180327f},
-std::array<float,2>{0.888159215f, 0.615788579f},
-std::array<float,2>{0.977653384f, 0.0823322833f},
-std::array<float,2>{0.462133199f, 0.843205154f},
-std::array<float,2>{0.228512585f, 0.476728648f},
-std::array<float,2>{0.582204998f, 0.677966595f},
-std::array<float,2>{0.672986329f, 0.314450473f},
-std::array<float,2>{0.123565219f, 0.554327428f},
-std::array<float,2>{0.284484595f, 0.175677791f},
-std::array<float,2>{0.780531824f, 0.996313274f},
-std::array<float,2>{0.921256721f, 0.300232708f},
-std::array<float,2>{0.420104831f, 0.58774215f},
-std::array<float,2>{0.169941798f, 0.195140392f},
-std::array<float,2>{0.530996203f, 0.897426844f},
-std::array<float,2>{0.74732244f, 0.0505412407f},
-std::array<float,2>{0.0589879826f, 0.763977468f},
-std::array<float,2>{0.365050852f, 0.436329544f},
-std::array<float,2>{0.851698875f, 0.730472863f},
-std::array<float,2>{0.784214199f, 0.129189879f},
-std::array<float,2>{0.261981606f, 0.955915451f},
-std::array<float,2>{0.0820662528f, 0.357887089f},
-std::array<float,2>{0.649087369f, 0.506223679f},
-std::array<float,2>{0.599785388f, 0.444225401f},
-std::array<float,2>{0.209492847f, 0.63588196f},
-std::array<float,2>{0.46894291f, 0.103415713f},
-std::array<float,2>{0.959859312f, 0.85996604f},
-std::array<float,2>{0.850034714f, 0.269840002f},
-std::array<float,2>{0.373864979f, 0.620880067f},
-std::array<float,2>{0.0532282107f, 0.245497286f},
-std::array<float,2>{0.742141485f, 0.911436319f},
-std::array<float,2>{0.521601439f, 0.0293366835f},
-std::array<float,2>{0.157662436f, 0.800483406f},
-std::array<float,2>{0.407110602f, 0.394949526f},
-std::array<float,2>{0.914058983f, 0.690770566f},
-std::array<float,2>{0.967335284f, 0.182963178f},
-std::array<float,2>{0.484359235f, 0.98472929f},
-std::array<float,2>{0.217672765f, 0.324477643f},
-std::array<float,2>{0.605753839f, 0.556182623f},
-std::array<float,2>{0.647242069f, 0.472430021f},
-std::array<float,2>{0.0913433209f, 0.686030209f},
-std::array<float,2>{0.255084902f, 0.0897259787f},
-std::array<float,2>{0.793805361f, 0.83038801f},
-std::array<float,2>{0.878947318f, 0.426156461f},
-std::array<float,2>{0.391019613f, 0.724176288f},
-std::array<float,2>{0.141523018f, 0.0603772961f},
-std::array<float,2>{0.561937213f, 0.750140548f},
-std::array<float,2>{0.705881774f, 0.195959136f},
-std::array<float,2>{0.0188498367f, 0.902163386f},
-std::array<float,2>{0.340659589f, 0.30529061f},
-std::array<float,2>{0.826113939f, 0.585491836f},
-std::array<float,2>{0.770789444f, 0.10136956f},
-std::array<float,2>{0.296363115f, 0.87335366f},
-std::array<float,2>{0.114189878f, 0.447062641f},
-std::array<float,2>{0.683929026f, 0.629038692f},
-std::array<float,2>{0.588158607f, 0.348446608f},
-std::array<float,2>{0.221567988f, 0.515389681f},
-std::array<float,2>{0.460178792f, 0.137455896f},
-std::array<float,2>{0.969243348f, 0.966062903f},
-std::array<float,2>{0.811466694f, 0.455987871f},
-std::array<float,2>{0.271925986f, 0.642964423f},
-std::array<float,2>{0.0638973936f, 0.122725703f},
-std::array<float,2>{0.639819384f, 0.859255016f},
-std::array<float,2>{0.615953982f, 0.151307732f},
-std::array<float,2>{0.188947946f, 0.938069344f},
-std::array<float,2>{0.495245397f, 0.367024928f},
-std::array<float,2>{0.94345969f, 0.524800062f},
-std::array<float,2>{0.927491307f, 0.0353056863f},
-std::array<float,2>{0.428681225f, 0.781234145f},
-std::array<float,2>{0.182274297f, 0.421076715f},
-std::array<float,2>{0.506366849f, 0.738335371f},
-std::array<float,2>{0.734178483f, 0.29203254f},
-std::array<float,2>{0.0383550785f, 0.56654954f},
-std::array<float,2>{0.350277722f, 0.213292673f},
-std::array<float,2>{0.873296618f, 0.876979053f},
-std::array<float,2>{0.986946523f, 0.341037154f},
-std::array<float,2>{0.445996463f, 0.537132859f},
-std::array<float,2>{0.234677285f, 0.166198969f},
-std::array<float,2>{0.571437716f, 0.977770865f},
-std::array<float,2>{0.66798526f, 0.0727424473f},
-std::array<float,2>{0.0984144062f, 0.815485358f},
-std::array<float,2>{0.298978537f, 0.494828641f},
-std::array<float,2>{0.751376152f, 0.658607066f},
-std::array<float,2>{0.839770377f, 0.225716472f},
-std::array<float,2>{0.325574994f, 0.927499056f},
-std::array<float,2>{0.0100940857f, 0.258265227f},
-std::array<float,2>{0.691221833f, 0.604184806f},
-std::array<float,2>{0.5316028f, 0.382626504f},
-std::array<float,2>{0.127582312f, 0.710772514f},
-std::array<float,2>{0.380433321f, 0.00294625596f},
-std::array<float,2>{0.894636273f, 0.781866372f},
-std::array<float,2>{0.789180875f, 0.284049183f},
-std::array<float,2>{0.251741379f, 0.576258421f},
-std::array<float,2>{0.0878406391f, 0.209725067f},
-std::array<float,2>{0.641985953f, 0.889957845f},
-std::array<float,2>{0.605436623f, 0.0443326533f},
-std::array<float,2>{0.214252502f, 0.771338582f},
-std::array<float,2>{0.478047222f, 0.407744348f},
-std::array<float,2>{0.961352766f, 0.744724393f},
-std::array<float,2>{0.909341216f, 0.147630587f},
-std::array<float,2>{0.411281109f, 0.952647388f},
-std::array<float,2>{0.162013739f, 0.367426306f},
-std::array<float,2>{0.515920401f, 0.520073056f},
-std::array<float,2>{0.734524786f, 0.463121712f},
-std::array<float,2>{0.0479820408f, 0.655257881f},
-std::array<float,2>{0.368402511f, 0.113954857f},
-std::array<float,2>{0.844597042f, 0.848892927f},
-std::array<float,2>{0.973066807f, 0.388782293f},
-std::array<float,2>{0.456869602f, 0.717223644f},
-std::array<float,2>{0.224810362f, 0.0082656974f},
-std::array<float,2>{0.593402922f, 0.791587651f},
-std::array<float,2>{0.680367947f, 0.22963874f},
-std::array<float,2>{0.111287691f, 0.936183274f},
-std::array<float,2>{0.290774912f, 0.254917681f},
-std::array<float,2>{0.768726945f, 0.595032215f},
-std::array<float,2>{0.822050214f, 0.0634451583f},
-std::array<float,2>{0.339821905f, 0.82368964f},
-std::array<float,2>{0.0212927051f, 0.48849678f},
-std::array<float,2>{0.709702134f, 0.665653944f},
-std::array<float,2>{0.555844724f, 0.33067292f},
-std::array<float,2>{0.146223843f, 0.545310497f},
-std::array<float,2>{0.396752387f, 0.156592995f},
-std::array<float,2>{0.87752521f, 0.968810678f},
-std::array<float,2>{0.867432058f, 0.481089503f},
-std::array<float,2>{0.346569359f, 0.673351705f},
-std::array<float,2>{0.0332511365f, 0.0798757523f},
-std::array<float,2>{0.730219245f, 0.837595105f},
-std::array<float,2>{0.500982285f, 0.177439213f},
-std::array<float,2>{0.184328645f, 0.994733393f},
-std::array<float,2>{0.4251737f, 0.31645745f},
-std::array<float,2>{0.925124466f, 0.550378084f},
-std::array<float,2>{0.940181017f, 0.0223886762f},
-std::array<float,2>{0.499982923f, 0.808731258f},
-std::array<float,2>{0.195178002f, 0.399592638f},
-std::array<float,2>{0.612803221f, 0.700613618f},
-std::array<float,2>{0.635083437f, 0.277739674f},
-std::array<float,2>{0.0668519959f, 0.611425102f},
-std::array<float,2>{0.268863291f, 0.238275737f},
-std::array<float,2>{0.806776881f, 0.917152107f},
-std::array<float,2>{0.894489408f, 0.354615986f},
-std::array<float,2>{0.376790285f, 0.501790047f},
-std::array<float,2>{0.132196903f, 0.125100553f},
-std::array<float,2>{0.537437141f, 0.960760415f},
-std::array<float,2>{0.69285965f, 0.107236028f},
-std::array<float,2>{0.0131007368f, 0.865894377f},
-std::array<float,2>{0.322777301f, 0.440626949f},
-std::array<float,2>{0.842407107f, 0.640271485f},
-std::array<float,2>{0.756900787f, 0.189961925f},
-std::array<float,2>{0.304031551f, 0.891706049f},
-std::array<float,2>{0.0941174701f, 0.304395914f},
-std::array<float,2>{0.667626977f, 0.593234003f},
-std::array<float,2>{0.575788081f, 0.431592792f},
-std::array<float,2>{0.240342006f, 0.727928758f},
-std::array<float,2>{0.449374437f, 0.0527301729f},
-std::array<float,2>{0.99167496f, 0.75799036f},
-std::array<float,2>{0.834307253f, 0.32289657f},
-std::array<float,2>{0.31896013f, 0.560529888f},
-std::array<float,2>{0.000110424175f, 0.185146362f},
-std::array<float,2>{0.700168312f, 0.991372228f},
-std::array<float,2>{0.539646506f, 0.0917553529f},
-std::array<float,2>{0.134828895f, 0.832046628f},
-std::array<float,2>{0.38599503f, 0.474517345f},
-std::array<float,2>{0.904914439f, 0.682441294f},
-std::array<float,2>{0.999972701f, 0.24873668f},
-std::array<float,2>{0.443444848f, 0.906830013f},
-std::array<float,2>{0.243734166f, 0.268254608f},
-std::array<float,2>{0.568558514f, 0.623996556f},
-std::array<float,2>{0.661122918f, 0.393197179f},
-std::array<float,2>{0.104810938f, 0.693986416f},
-std::array<float,2>{0.309812009f, 0.0238115937f},
-std::array<float,2>{0.765231788f, 0.804684579f},
-std::array<float,2>{0.937417626f, 0.452379405f},
-std::array<float,2>{0.435177892f, 0.627966404f},
-std::array<float,2>{0.175639406f, 0.0943312198f},
-std::array<float,2>{0.508637786f, 0.867260277f},
-std::array<float,2>{0.725227475f, 0.13639012f},
-std::array<float,2>{0.039508421f, 0.961572826f},
-std::array<float,2>{0.358582526f, 0.345787644f},
-std::array<float,2>{0.864720881f, 0.508321643f},
-std::array<float,2>{0.80274725f, 0.0565953963f},
-std::array<float,2>{0.281155378f, 0.754295528f},
-std::array<float,2>{0.0704637319f, 0.422387213f},
-std::array<float,2>{0.631799936f, 0.719171047f},
-std::array<float,2>{0.623152852f, 0.311641365f},
-std::array<float,2>{0.19939667f, 0.582008302f},
-std::array<float,2>{0.487997532f, 0.202641234f},
-std::array<float,2>{0.947289348f, 0.905005395f},
-std::array<float,2>{0.774914801f, 0.415399969f},
-std::array<float,2>{0.285379618f, 0.735579908f},
-std::array<float,2>{0.119206361f, 0.0330958329f},
-std::array<float,2>{0.678850412f, 0.775955021f},
-std::array<float,2>{0.581987917f, 0.216215163f},
-std::array<float,2>{0.233181655f, 0.880032659f},
-std::array<float,2>{0.465004146f, 0.293757886f},
-std::array<float,2>{0.98054415f, 0.565770924f},
-std::array<float,2>{0.886538446f, 0.11732123f},
-std::array<float,2>{0.405556649f, 0.854034066f},
-std::array<float,2>{0.155080199f, 0.458931744f},
-std::array<float,2>{0.554163337f, 0.646091998f},
-std::array<float,2>{0.714302778f, 0.36228171f},
-std::array<float,2>{0.0288679861f, 0.529533625f},
-std::array<float,2>{0.331620514f, 0.153748184f},
-std::array<float,2>{0.816328406f, 0.942000687f},
-std::array<float,2>{0.956068277f, 0.261896044f},
-std::array<float,2>{0.476508766f, 0.607587695f},
-std::array<float,2>{0.204491466f, 0.222556666f},
-std::array<float,2>{0.595031917f, 0.925072193f},
-std::array<float,2>{0.653010428f, 0.00693995319f},
-std::array<float,2>{0.0794447958f, 0.786846399f},
-std::array<float,2>{0.25916943f, 0.378596187f},
-std::array<float,2>{0.786040783f, 0.705247939f},
-std::array<float,2>{0.857841432f, 0.168623671f},
-std::array<float,2>{0.362734646f, 0.983948171f},
-std::array<float,2>{0.0552121326f, 0.336380303f},
-std::array<float,2>{0.743022203f, 0.534507871f},
-std::array<float,2>{0.52610296f, 0.499477893f},
-std::array<float,2>{0.167107806f, 0.664048433f},
-std::array<float,2>{0.415675372f, 0.0768740624f},
-std::array<float,2>{0.914266646f, 0.817337692f},
-std::array<float,2>{0.799399793f, 0.334631026f},
-std::array<float,2>{0.275580436f, 0.540783584f},
-std::array<float,2>{0.0771735311f, 0.160485461f},
-std::array<float,2>{0.628435493f, 0.974313736f},
-std::array<float,2>{0.619853914f, 0.0671222657f},
-std::array<float,2>{0.198436126f, 0.825603008f},
-std::array<float,2>{0.491033345f, 0.485951543f},
-std::array<float,2>{0.950780928f, 0.668733954f},
-std::array<float,2>{0.931388557f, 0.231846511f},
-std::array<float,2>{0.430060178f, 0.932501078f},
-std::array<float,2>{0.176278621f, 0.250004381f},
-std::array<float,2>{0.514090419f, 0.59783417f},
-std::array<float,2>{0.72140348f, 0.38536945f},
-std::array<float,2>{0.0455389582f, 0.712648273f},
-std::array<float,2>{0.352085918f, 0.014903171f},
-std::array<float,2>{0.860394895f, 0.794121504f},
-std::array<float,2>{0.993122637f, 0.466249049f},
-std::array<float,2>{0.440308809f, 0.648817718f},
-std::array<float,2>{0.248576149f, 0.109487861f},
-std::array<float,2>{0.563731968f, 0.846306562f},
-std::array<float,2>{0.657413483f, 0.14434731f},
-std::array<float,2>{0.10864953f, 0.945326269f},
-std::array<float,2>{0.308010578f, 0.37194252f},
-std::array<float,2>{0.760942817f, 0.517459273f},
-std::array<float,2>{0.828479826f, 0.0426734686f},
-std::array<float,2>{0.314349502f, 0.766991615f},
-std::array<float,2>{0.00594447786f, 0.411153197f},
-std::array<float,2>{0.696257949f, 0.747426391f},
-std::array<float,2>{0.543271422f, 0.287084371f},
-std::array<float,2>{0.140289783f, 0.572698772f},
-std::array<float,2>{0.389701307f, 0.204061389f},
-std::array<float,2>{0.900640607f, 0.884461224f},
-std::array<float,2>{0.855249643f, 0.434108853f},
-std::array<float,2>{0.366951764f, 0.733180881f},
-std::array<float,2>{0.0622038879f, 0.047854092f},
-std::array<float,2>{0.749708652f, 0.762824416f},
-std::array<float,2>{0.528977752f, 0.191565305f},
-std::array<float,2>{0.168043777f, 0.895029902f},
-std::array<float,2>{0.419861525f, 0.298335373f},
-std::array<float,2>{0.918864369f, 0.589213848f},
-std::array<float,2>{0.957605779f, 0.105330609f},
-std::array<float,2>{0.471490949f, 0.86244154f},
-std::array<float,2>{0.207251459f, 0.443247527f},
-std::array<float,2>{0.598340452f, 0.633830547f},
-std::array<float,2>{0.651020646f, 0.356507838f},
-std::array<float,2>{0.08490026f, 0.505716205f},
-std::array<float,2>{0.264250785f, 0.131551027f},
-std::array<float,2>{0.781894267f, 0.954826057f},
-std::array<float,2>{0.889459729f, 0.274893969f},
-std::array<float,2>{0.401763678f, 0.614127517f},
-std::array<float,2>{0.152053148f, 0.241563976f},
-std::array<float,2>{0.548873603f, 0.920959532f},
-std::array<float,2>{0.716130495f, 0.0183603615f},
-std::array<float,2>{0.0261827484f, 0.806092501f},
-std::array<float,2>{0.332536012f, 0.404322118f},
-std::array<float,2>{0.818227887f, 0.698436975f},
-std::array<float,2>{0.778285027f, 0.173583776f},
-std::array<float,2>{0.282013983f, 0.998632193f},
-std::array<float,2>{0.122112028f, 0.315062881f},
-std::array<float,2>{0.675487518f, 0.551499009f},
-std::array<float,2>{0.584971488f, 0.479816943f},
-std::array<float,2>{0.229561999f, 0.676756918f},
-std::array<float,2>{0.464384109f, 0.0841865838f},
-std::array<float,2>{0.979249537f, 0.84031111f},
-std::array<float,2>{0.826888323f, 0.307942927f},
-std::array<float,2>{0.343192518f, 0.583542109f},
-std::array<float,2>{0.0164135471f, 0.198170021f},
-std::array<float,2>{0.703749955f, 0.899519265f},
-std::array<float,2>{0.560504973f, 0.0620802082f},
-std::array<float,2>{0.143114835f, 0.753600657f},
-std::array<float,2>{0.392757952f, 0.428858876f},
-std::array<float,2>{0.882250965f, 0.724769533f},
-std::array<float,2>{0.972096324f, 0.139072418f},
-std::array<float,2>{0.457699478f, 0.96707195f},
-std::array<float,2>{0.219724566f, 0.349843502f},
-std::array<float,2>{0.587668836f, 0.513514578f},
-std::array<float,2>{0.685575247f, 0.448790878f},
-std::array<float,2>{0.116843313f, 0.631166041f},
-std::array<float,2>{0.293764323f, 0.098180443f},
-std::array<float,2>{0.773247957f, 0.872812748f},
-std::array<float,2>{0.912072957f, 0.397769332f},
-std::array<float,2>{0.408819824f, 0.687979162f},
-std::array<float,2>{0.159897581f, 0.0275434963f},
-std::array<float,2>{0.520023465f, 0.797065973f},
-std::array<float,2>{0.740115941f, 0.244132206f},
-std::array<float,2>{0.0515909903f, 0.91353327f},
-std::array<float,2>{0.371789932f, 0.271876305f},
-std::array<float,2>{0.848709464f, 0.617442131f},
-std::array<float,2>{0.796398044f, 0.0865720958f},
-std::array<float,2>{0.257436126f, 0.829700768f},
-std::array<float,2>{0.0918655619f, 0.470101744f},
-std::array<float,2>{0.645589888f, 0.684687376f},
-std::array<float,2>{0.608290613f, 0.326947719f},
-std::array<float,2>{0.215483114f, 0.557879567f},
-std::array<float,2>{0.480551958f, 0.181482539f},
-std::array<float,2>{0.966547608f, 0.987131953f},
-std::array<float,2>{0.752300322f, 0.493550748f},
-std::array<float,2>{0.297993004f, 0.65727967f},
-std::array<float,2>{0.100493968f, 0.0704045817f},
-std::array<float,2>{0.671801507f, 0.812604845f},
-std::array<float,2>{0.573013604f, 0.1651555f},
-std::array<float,2>{0.236498371f, 0.97894758f},
-std::array<float,2>{0.44801265f, 0.342763484f},
-std::array<float,2>{0.985062003f, 0.535222173f},
-std::array<float,2>{0.896725833f, 0.000514264277f},
-std::array<float,2>{0.382598072f, 0.784402668f},
-std::array<float,2>{0.126701206f, 0.379323959f},
-std::array<float,2>{0.534665823f, 0.708903491f},
-std::array<float,2>{0.688397586f, 0.261285424f},
-std::array<float,2>{0.00831955019f, 0.603005409f},
-std::array<float,2>{0.327818394f, 0.223847523f},
-std::array<float,2>{0.836173236f, 0.929517806f},
-std::array<float,2>{0.942978263f, 0.364727587f},
-std::array<float,2>{0.493538171f, 0.526827037f},
-std::array<float,2>{0.191054419f, 0.148838684f},
-std::array<float,2>{0.615067303f, 0.941324532f},
-std::array<float,2>{0.638206303f, 0.123319574f},
-std::array<float,2>{0.0653445721f, 0.857007682f},
-std::array<float,2>{0.27100122f, 0.454069793f},
-std::array<float,2>{0.808699071f, 0.641530752f},
-std::array<float,2>{0.871567369f, 0.21274595f},
-std::array<float,2>{0.347903252f, 0.875455916f},
-std::array<float,2>{0.0353557393f, 0.290139109f},
-std::array<float,2>{0.731291831f, 0.570247889f},
-std::array<float,2>{0.505144179f, 0.419351757f},
-std::array<float,2>{0.18015641f, 0.74216032f},
-std::array<float,2>{0.426515341f, 0.0384673253f},
-std::array<float,2>{0.928180099f, 0.778267145f},
-std::array<float,2>{0.766751587f, 0.256557673f},
-std::array<float,2>{0.291804612f, 0.596039712f},
-std::array<float,2>{0.113214917f, 0.227218553f},
-std::array<float,2>{0.681859851f, 0.933686137f},
-std::array<float,2>{0.59153235f, 0.0111395633f},
-std::array<float,2>{0.22267592f, 0.790527821f},
-std::array<float,2>{0.453359514f, 0.387256771f},
-std::array<float,2>{0.975696921f, 0.715905249f},
-std::array<float,2>{0.875542343f, 0.159915462f},
-std::array<float,2>{0.39607513f, 0.972607791f},
-std::array<float,2>{0.147515863f, 0.329643071f},
-std::array<float,2>{0.558402479f, 0.543128788f},
-std::array<float,2>{0.707692325f, 0.49180007f},
-std::array<float,2>{0.0214978307f, 0.667594671f},
-std::array<float,2>{0.336381793f, 0.0651219264f},
-std::array<float,2>{0.823298275f, 0.821347952f},
-std::array<float,2>{0.964057088f, 0.408961922f},
-std::array<float,2>{0.478785753f, 0.74295634f},
-std::array<float,2>{0.212022051f, 0.0450833365f},
-std::array<float,2>{0.603235245f, 0.772740185f},
-std::array<float,2>{0.643433332f, 0.208150804f},
-std::array<float,2>{0.0880613327f, 0.886739194f},
-std::array<float,2>{0.253867f, 0.282024741f},
-std::array<float,2>{0.791203082f, 0.575110912f},
-std::array<float,2>{0.84758085f, 0.115564875f},
-std::array<float,2>{0.370605111f, 0.850946307f},
-std::array<float,2>{0.0505368859f, 0.461844712f},
-std::array<float,2>{0.736932158f, 0.652494788f},
-std::array<float,2>{0.519524336f, 0.369347423f},
-std::array<float,2>{0.163097098f, 0.521797717f},
-std::array<float,2>{0.413809329f, 0.146097347f},
-std::array<float,2>{0.906888127f, 0.94943589f},
-std::array<float,2>{0.841560364f, 0.43920204f},
-std::array<float,2>{0.321646363f, 0.638164878f},
-std::array<float,2>{0.014756023f, 0.109346367f},
-std::array<float,2>{0.693714201f, 0.863315821f},
-std::array<float,2>{0.536086142f, 0.128851473f},
-std::array<float,2>{0.129707634f, 0.957186759f},
-std::array<float,2>{0.378456116f, 0.352945536f},
-std::array<float,2>{0.891545177f, 0.502569139f},
-std::array<float,2>{0.989906251f, 0.0546350777f},
-std::array<float,2>{0.452028841f, 0.760446727f},
-std::array<float,2>{0.239673331f, 0.432666659f},
-std::array<float,2>{0.577464223f, 0.729816139f},
-std::array<float,2>{0.66557169f, 0.3009848f},
-std::array<float,2>{0.0971230865f, 0.591505706f},
-std::array<float,2>{0.301494718f, 0.187808737f},
-std::array<float,2>{0.755839467f, 0.894138455f},
-std::array<float,2>{0.922432423f, 0.320302367f},
-std::array<float,2>{0.422116905f, 0.548592746f},
-std::array<float,2>{0.186376065f, 0.177998751f},
-std::array<float,2>{0.503253341f, 0.994114757f},
-std::array<float,2>{0.727834105f, 0.080679886f},
-std::array<float,2>{0.0326964483f, 0.839593112f},
-std::array<float,2>{0.34522745f, 0.483326435f},
-std::array<float,2>{0.869746506f, 0.674200654f},
-std::array<float,2>{0.806414127f, 0.236213088f},
-std::array<float,2>{0.267079562f, 0.915124178f},
-std::array<float,2>{0.0696678907f, 0.28073892f},
-std::array<float,2>{0.63457942f, 0.610805869f},
-std::array<float,2>{0.609552383f, 0.401322275f},
-std::array<float,2>{0.191671073f, 0.702425778f},
-std::array<float,2>{0.496246964f, 0.0205546822f},
-std::array<float,2>{0.937926352f, 0.810869515f},
-std::array<float,2>{0.865836978f, 0.344288319f},
-std::array<float,2>{0.356531471f, 0.511244893f},
-std::array<float,2>{0.0414968058f, 0.134162381f},
-std::array<float,2>{0.723162293f, 0.964229465f},
-std::array<float,2>{0.510049939f, 0.0974774286f},
-std::array<float,2>{0.172216415f, 0.869583845f},
-std::array<float,2>{0.436218977f, 0.449680507f},
-std::array<float,2>{0.934397042f, 0.625359893f},
-std::array<float,2>{0.945538223f, 0.200551361f},
-std::array<float,2>{0.485597521f, 0.903853714f},
-std::array<float,2>{0.201569349f, 0.310297012f},
-std::array<float,2>{0.621652126f, 0.578239918f},
-std::array<float,2>{0.628916562f, 0.424556643f},
-std::array<float,2>{0.072987549f, 0.722649097f},
-std::array<float,2>{0.278488964f, 0.0573870838f},
-std::array<float,2>{0.801322877f, 0.756356716f},
-std::array<float,2>{0.90310818f, 0.476115018f},
-std::array<float,2>{0.383182257f, 0.680709481f},
-std::array<float,2>{0.133646131f, 0.0928414017f},
-std::array<float,2>{0.542730033f, 0.835881233f},
-std::array<float,2>{0.702009737f, 0.185888544f},
-std::array<float,2>{0.00368945953f, 0.988315463f},
-std::array<float,2>{0.316848248f, 0.321022302f},
-std::array<float,2>{0.832234263f, 0.561561882f},
-std::array<float,2>{0.762496829f, 0.0254674628f},
-std::array<float,2>{0.310626984f, 0.800977349f},
-std::array<float,2>{0.102763489f, 0.391673356f},
-std::array<float,2>{0.663150132f, 0.692815721f},
-std::array<float,2>{0.567810118f, 0.2660411f},
-std::array<float,2>{0.244602665f, 0.62300539f},
-std::array<float,2>{0.441459566f, 0.246147081f},
-std::array<float,2>{0.997137666f, 0.909060955f},
-std::array<float,2>{0.788739383f, 0.375106126f},
-std::array<float,2>{0.260771364f, 0.70397222f},
-std::array<float,2>{0.0813337564f, 0.00532544916f},
-std::array<float,2>{0.654791415f, 0.789000928f},
-std::array<float,2>{0.597230732f, 0.219938874f},
-std::array<float,2>{0.206550539f, 0.922531784f},
-std::array<float,2>{0.472923726f, 0.265490115f},
-std::array<float,2>{0.953716278f, 0.605940819f},
-std::array<float,2>{0.916217983f, 0.0750624761f},
-std::array<float,2>{0.416048169f, 0.81877923f},
-std::array<float,2>{0.164643407f, 0.497619003f},
-std::array<float,2>{0.524756968f, 0.660487711f},
-std::array<float,2>{0.745163143f, 0.338239312f},
-std::array<float,2>{0.0573889874f, 0.53283757f},
-std::array<float,2>{0.360755295f, 0.171688706f},
-std::array<float,2>{0.856752932f, 0.981149852f},
-std::array<float,2>{0.983725965f, 0.295094609f},
-std::array<float,2>{0.467523009f, 0.563945413f},
-std::array<float,2>{0.231090248f, 0.217817128f},
-std::array<float,2>{0.578208685f, 0.882636189f},
-std::array<float,2>{0.675799489f, 0.0337527581f},
-std::array<float,2>{0.118400775f, 0.774200618f},
-std::array<float,2>{0.28739354f, 0.417767912f},
-std::array<float,2>{0.775894284f, 0.738188922f},
-std::array<float,2>{0.813289165f, 0.155560687f},
-std::array<float,2>{0.329662323f, 0.94387269f},
-std::array<float,2>{0.0312328935f, 0.360053986f},
-std::array<float,2>{0.710949183f, 0.528850079f},
-std::array<float,2>{0.551676035f, 0.459453732f},
-std::array<float,2>{0.15270862f, 0.647852063f},
-std::array<float,2>{0.403741777f, 0.119240992f},
-std::array<float,2>{0.883185923f, 0.853129625f},
-std::array<float,2>{0.792176664f, 0.367483079f},
-std::array<float,2>{0.25274691f, 0.520280957f},
-std::array<float,2>{0.0893749818f, 0.147815347f},
-std::array<float,2>{0.643668592f, 0.952910602f},
-std::array<float,2>{0.602514803f, 0.114090331f},
-std::array<float,2>{0.2111267f, 0.848736227f},
-std::array<float,2>{0.480091959f, 0.463344455f},
-std::array<float,2>{0.963805556f, 0.654943824f},
-std::array<float,2>{0.907298803f, 0.209539965f},
-std::array<float,2>{0.412622511f, 0.88972944f},
-std::array<float,2>{0.162700936f, 0.283758491f},
-std::array<float,2>{0.518421352f, 0.576437175f},
-std::array<float,2>{0.737461507f, 0.408014268f},
-std::array<float,2>{0.049060531f, 0.744889736f},
-std::array<float,2>{0.369561344f, 0.0441835597f},
-std::array<float,2>{0.846230924f, 0.771228015f},
-std::array<float,2>{0.975370467f, 0.488600492f},
-std::array<float,2>{0.454480737f, 0.665929675f},
-std::array<float,2>{0.224317074f, 0.0631456599f},
-std::array<float,2>{0.590106428f, 0.8233518f},
-std::array<float,2>{0.682996094f, 0.156368107f},
-std::array<float,2>{0.111475013f, 0.969033718f},
-std::array<float,2>{0.292800367f, 0.330929697f},
-std::array<float,2>{0.765690625f, 0.545061231f},
-std::array<float,2>{0.822857261f, 0.0078780558f},
-std::array<float,2>{0.337552011f, 0.791836381f},
-std::array<float,2>{0.0231358912f, 0.389013916f},
-std::array<float,2>{0.708270609f, 0.716954947f},
-std::array<float,2>{0.557262599f, 0.255277485f},
-std::array<float,2>{0.147005036f, 0.594861507f},
-std::array<float,2>{0.395454258f, 0.2298114f},
-std::array<float,2>{0.876024604f, 0.936311007f},
-std::array<float,2>{0.870916545f, 0.399794281f},
-std::array<float,2>{0.344512373f, 0.700240314f},
-std::array<float,2>{0.0315103084f, 0.0221708193f},
-std::array<float,2>{0.726689279f, 0.808858097f},
-std::array<float,2>{0.502613127f, 0.237841576f},
-std::array<float,2>{0.18728143f, 0.917295516f},
-std::array<float,2>{0.422894448f, 0.277353942f},
-std::array<float,2>{0.923477829f, 0.611797035f},
-std::array<float,2>{0.939394772f, 0.0796031281f},
-std::array<float,2>{0.497127563f, 0.83775425f},
-std::array<float,2>{0.192618504f, 0.481203437f},
-std::array<float,2>{0.610500813f, 0.673633695f},
-std::array<float,2>{0.633412123f, 0.316803157f},
-std::array<float,2>{0.068698056f, 0.550680578f},
-std::array<float,2>{0.266445845f, 0.177664503f},
-std::array<float,2>{0.804767549f, 0.995072782f},
-std::array<float,2>{0.892390013f, 0.304643899f},
-std::array<float,2>{0.377029598f, 0.592925012f},
-std::array<float,2>{0.130499646f, 0.190279707f},
-std::array<float,2>{0.536521673f, 0.892062724f},
-std::array<float,2>{0.694693565f, 0.052347526f},
-std::array<float,2>{0.0142708961f, 0.758103073f},
-std::array<float,2>{0.321173638f, 0.431350768f},
-std::array<float,2>{0.840320647f, 0.727782786f},
-std::array<float,2>{0.754013181f, 0.125414342f},
-std::array<float,2>{0.302570671f, 0.960557222f},
-std::array<float,2>{0.096327886f, 0.354854941f},
-std::array<float,2>{0.664499938f, 0.501649857f},
-std::array<float,2>{0.576606333f, 0.440775663f},
-std::array<float,2>{0.239087939f, 0.640414357f},
-std::array<float,2>{0.452241808f, 0.106985413f},
-std::array<float,2>{0.98842293f, 0.866039991f},
-std::array<float,2>{0.833206236f, 0.268441767f},
-std::array<float,2>{0.317745328f, 0.623543739f},
-std::array<float,2>{0.00235974952f, 0.248924002f},
-std::array<float,2>{0.702944517f, 0.90718478f},
-std::array<float,2>{0.541493475f, 0.0235435665f},
-std::array<float,2>{0.134252116f, 0.804425895f},
-std::array<float,2>{0.384056956f, 0.393467605f},
-std::array<float,2>{0.904092491f, 0.694185078f},
-std::array<float,2>{0.996907353f, 0.185334429f},
-std::array<float,2>{0.442775309f, 0.991672516f},
-std::array<float,2>{0.24585171f, 0.32305336f},
-std::array<float,2>{0.566835463f, 0.560103893f},
-std::array<float,2>{0.662795782f, 0.474333346f},
-std::array<float,2>{0.102436952f, 0.682364643f},
-std::array<float,2>{0.311959267f, 0.0913905129f},
-std::array<float,2>{0.763105869f, 0.832476735f},
-std::array<float,2>{0.935151279f, 0.422709644f},
-std::array<float,2>{0.43702808f, 0.718784451f},
-std::array<float,2>{0.173126519f, 0.0562412217f},
-std::array<float,2>{0.510753572f, 0.75405091f},
-std::array<float,2>{0.723999739f, 0.202948362f},
-std::array<float,2>{0.0423532128f, 0.905107081f},
-std::array<float,2>{0.355684429f, 0.311955005f},
-std::array<float,2>{0.866488814f, 0.581683457f},
-std::array<float,2>{0.801802993f, 0.0946178287f},
-std::array<float,2>{0.277529776f, 0.867483497f},
-std::array<float,2>{0.0741841272f, 0.45250386f},
-std::array<float,2>{0.630769253f, 0.628285587f},
-std::array<float,2>{0.6228953f, 0.3460325f},
-std::array<float,2>{0.202788889f, 0.508715987f},
-std::array<float,2>{0.484782696f, 0.136555284f},
-std::array<float,2>{0.946485102f, 0.961912572f},
-std::array<float,2>{0.777288914f, 0.458561838f},
-std::array<float,2>{0.288820982f, 0.646375597f},
-std::array<float,2>{0.117615879f, 0.117656432f},
-std::array<float,2>{0.677001595f, 0.854377985f},
-std::array<float,2>{0.579933047f, 0.153516218f},
-std::array<float,2>{0.23192142f, 0.942291915f},
-std::array<float,2>{0.468542933f, 0.361880213f},
-std::array<float,2>{0.982687116f, 0.529742062f},
-std::array<float,2>{0.884651363f, 0.0327554606f},
-std::array<float,2>{0.402946383f, 0.776135206f},
-std::array<float,2>{0.153813511f, 0.415215194f},
-std::array<float,2>{0.552258968f, 0.735813737f},
-std::array<float,2>{0.712095857f, 0.293652087f},
-std::array<float,2>{0.0301133692f, 0.565662086f},
-std::array<float,2>{0.328631639f, 0.215977311f},
-std::array<float,2>{0.813586175f, 0.880233824f},
-std::array<float,2>{0.95502013f, 0.336166829f},
-std::array<float,2>{0.474380255f, 0.534233093f},
-std::array<float,2>{0.205220595f, 0.168770269f},
-std::array<float,2>{0.595999479f, 0.984372437f},
-std::array<float,2>{0.655433118f, 0.0770990998f},
-std::array<float,2>{0.0802875832f, 0.817057669f},
-std::array<float,2>{0.259886205f, 0.499119729f},
-std::array<float,2>{0.787782967f, 0.663650095f},
-std::array<float,2>{0.856328487f, 0.22240378f},
-std::array<float,2>{0.360283285f, 0.924881935f},
-std::array<float,2>{0.0585651062f, 0.262109965f},
-std::array<float,2>{0.745006084f, 0.607866824f},
-std::array<float,2>{0.523881257f, 0.378904641f},
-std::array<float,2>{0.165152952f, 0.705454111f},
-std::array<float,2>{0.41725722f, 0.0072226231f},
-std::array<float,2>{0.917644858f, 0.78689909f},
-std::array<float,2>{0.76007694f, 0.287745208f},
-std::array<float,2>{0.306825817f, 0.571063161f},
-std::array<float,2>{0.107868411f, 0.206086859f},
-std::array<float,2>{0.65678978f, 0.886199176f},
-std::array<float,2>{0.56280154f, 0.0409097783f},
-std::array<float,2>{0.249772161f, 0.768499851f},
-std::array<float,2>{0.441209644f, 0.413554341f},
-std::array<float,2>{0.993218124f, 0.748063207f},
-std::array<float,2>{0.901674092f, 0.141817838f},
-std::array<float,2>{0.389278173f, 0.947765648f},
-std::array<float,2>{0.139146611f, 0.373981357f},
-std::array<float,2>{0.543974817f, 0.519267499f},
-std::array<float,2>{0.696401358f, 0.467683703f},
-std::array<float,2>{0.00772437174f, 0.651691258f},
-std::array<float,2>{0.313194811f, 0.112751119f},
-std::array<float,2>{0.830015779f, 0.843873501f},
-std::array<float,2>{0.949455202f, 0.384762228f},
-std::array<float,2>{0.492138594f, 0.714626133f},
-std::array<float,2>{0.198172495f, 0.0126498798f},
-std::array<float,2>{0.620960653f, 0.79597646f},
-std::array<float,2>{0.627043247f, 0.232605621f},
-std::array<float,2>{0.07686726f, 0.930132389f},
-std::array<float,2>{0.276841789f, 0.252564281f},
-std::array<float,2>{0.800601244f, 0.600366235f},
-std::array<float,2>{0.859644115f, 0.0688830242f},
-std::array<float,2>{0.352604032f, 0.826230109f},
-std::array<float,2>{0.0468726605f, 0.487816423f},
-std::array<float,2>{0.721991181f, 0.670682311f},
-std::array<float,2>{0.515404284f, 0.332306564f},
-std::array<float,2>{0.176853761f, 0.541446269f},
-std::array<float,2>{0.430868864f, 0.163127646f},
-std::array<float,2>{0.930011988f, 0.975056469f},
-std::array<float,2>{0.816936374f, 0.477004796f},
-std::array<float,2>{0.333390623f, 0.678123951f},
-std::array<float,2>{0.0263851769f, 0.0822052658f},
-std::array<float,2>{0.714926124f, 0.842969418f},
-std::array<float,2>{0.550143182f, 0.175405726f},
-std::array<float,2>{0.151339263f, 0.996413589f},
-std::array<float,2>{0.401224196f, 0.313977301f},
-std::array<float,2>{0.890495241f, 0.554477215f},
-std::array<float,2>{0.979827046f, 0.0163793229f},
-std::array<float,2>{0.463734388f, 0.806721985f},
-std::array<float,2>{0.228728205f, 0.402864873f},
-std::array<float,2>{0.584318876f, 0.695686817f},
-std::array<float,2>{0.67476052f, 0.275901079f},
-std::array<float,2>{0.121890388f, 0.616034389f},
-std::array<float,2>{0.283097178f, 0.239502281f},
-std::array<float,2>{0.779054463f, 0.919157505f},
-std::array<float,2>{0.919503748f, 0.357662171f},
-std::array<float,2>{0.41875869f, 0.505948305f},
-std::array<float,2>{0.16957669f, 0.129002601f},
-std::array<float,2>{0.527760386f, 0.955770373f},
-std::array<float,2>{0.748732507f, 0.103045657f},
-std::array<float,2>{0.0605956353f, 0.860157788f},
-std::array<float,2>{0.366038322f, 0.443947077f},
-std::array<float,2>{0.853633165f, 0.636213839f},
-std::array<float,2>{0.782727897f, 0.195056677f},
-std::array<float,2>{0.265094936f, 0.897123218f},
-std::array<float,2>{0.0854167938f, 0.299860895f},
-std::array<float,2>{0.652188718f, 0.587499917f},
-std::array<float,2>{0.599214852f, 0.436055034f},
-std::array<float,2>{0.208543316f, 0.73089397f},
-std::array<float,2>{0.472513646f, 0.050316073f},
-std::array<float,2>{0.958692312f, 0.763830364f},
-std::array<float,2>{0.847758889f, 0.324301213f},
-std::array<float,2>{0.37238121f, 0.556474924f},
-std::array<float,2>{0.0526553094f, 0.18263191f},
-std::array<float,2>{0.73874706f, 0.984519362f},
-std::array<float,2>{0.520807385f, 0.0895645395f},
-std::array<float,2>{0.158742622f, 0.830177784f},
-std::array<float,2>{0.410004884f, 0.472384125f},
-std::array<float,2>{0.910461068f, 0.685625434f},
-std::array<float,2>{0.965404093f, 0.245264322f},
-std::array<float,2>{0.482184976f, 0.911180675f},
-std::array<float,2>{0.216352075f, 0.269709826f},
-std::array<float,2>{0.608697832f, 0.620643914f},
-std::array<float,2>{0.644734442f, 0.394569784f},
-std::array<float,2>{0.0931756496f, 0.690579414f},
-std::array<float,2>{0.25644958f, 0.0296986736f},
-std::array<float,2>{0.795409322f, 0.800549865f},
-std::array<float,2>{0.881566763f, 0.446991652f},
-std::array<float,2>{0.393606514f, 0.629268527f},
-std::array<float,2>{0.144132346f, 0.101283439f},
-std::array<float,2>{0.559300542f, 0.873280942f},
-std::array<float,2>{0.70451045f, 0.137399748f},
-std::array<float,2>{0.0174347404f, 0.966198325f},
-std::array<float,2>{0.341803968f, 0.348383844f},
-std::array<float,2>{0.827569485f, 0.515142798f},
-std::array<float,2>{0.771617293f, 0.0601179786f},
-std::array<float,2>{0.294511825f, 0.750360072f},
-std::array<float,2>{0.115244463f, 0.425840676f},
-std::array<float,2>{0.686695099f, 0.724374175f},
-std::array<float,2>{0.586861193f, 0.305654973f},
-std::array<float,2>{0.219982788f, 0.585696697f},
-std::array<float,2>{0.458230615f, 0.196270168f},
-std::array<float,2>{0.971390128f, 0.902002811f},
-std::array<float,2>{0.809689164f, 0.421326011f},
-std::array<float,2>{0.270131737f, 0.73860395f},
-std::array<float,2>{0.0655067712f, 0.0355356969f},
-std::array<float,2>{0.636815429f, 0.780984342f},
-std::array<float,2>{0.614242196f, 0.213001713f},
-std::array<float,2>{0.189592302f, 0.877256572f},
-std::array<float,2>{0.49239254f, 0.292258441f},
-std::array<float,2>{0.941452444f, 0.566719115f},
-std::array<float,2>{0.92953819f, 0.122846343f},
-std::array<float,2>{0.427190661f, 0.858911633f},
-std::array<float,2>{0.180959314f, 0.45563966f},
-std::array<float,2>{0.503908575f, 0.642594159f},
-std::array<float,2>{0.732074499f, 0.366777748f},
-std::array<float,2>{0.0369120203f, 0.524636447f},
-std::array<float,2>{0.349536598f, 0.151003897f},
-std::array<float,2>{0.872991621f, 0.938355744f},
-std::array<float,2>{0.98563385f, 0.25800097f},
-std::array<float,2>{0.448324144f, 0.604380369f},
-std::array<float,2>{0.238206744f, 0.225915775f},
-std::array<float,2>{0.573814571f, 0.927446187f},
-std::array<float,2>{0.670548201f, 0.0032265333f},
-std::array<float,2>{0.100823238f, 0.781985879f},
-std::array<float,2>{0.297683895f, 0.382532418f},
-std::array<float,2>{0.753676951f, 0.710602522f},
-std::array<float,2>{0.837424457f, 0.166365772f},
-std::array<float,2>{0.326520145f, 0.977822721f},
-std::array<float,2>{0.00943360943f, 0.341203392f},
-std::array<float,2>{0.6885975f, 0.537488937f},
-std::array<float,2>{0.53395009f, 0.494949579f},
-std::array<float,2>{0.125563651f, 0.65821135f},
-std::array<float,2>{0.38105318f, 0.072311461f},
-std::array<float,2>{0.898012698f, 0.815738916f},
-std::array<float,2>{0.768081605f, 0.330027372f},
-std::array<float,2>{0.289462f, 0.543238461f},
-std::array<float,2>{0.109686695f, 0.159761265f},
-std::array<float,2>{0.6808182f, 0.972169697f},
-std::array<float,2>{0.591973186f, 0.0652480125f},
-std::array<float,2>{0.226509124f, 0.821643293f},
-std::array<float,2>{0.455190748f, 0.492109001f},
-std::array<float,2>{0.9740237f, 0.667787731f},
-std::array<float,2>{0.878688991f, 0.227315217f},
-std::array<float,2>{0.398143351f, 0.933933318f},
-std::array<float,2>{0.145210192f, 0.256640255f},
-std::array<float,2>{0.555051863f, 0.595928669f},
-std::array<float,2>{0.710704029f, 0.387657166f},
-std::array<float,2>{0.0197967943f, 0.716264904f},
-std::array<float,2>{0.3382833f, 0.0109434919f},
-std::array<float,2>{0.820578575f, 0.790984035f},
-std::array<float,2>{0.962338269f, 0.461601704f},
-std::array<float,2>{0.477398515f, 0.652649641f},
-std::array<float,2>{0.213117704f, 0.115359217f},
-std::array<float,2>{0.604136646f, 0.850801229f},
-std::array<float,2>{0.641086161f, 0.146388963f},
-std::array<float,2>{0.0860496089f, 0.949568391f},
-std::array<float,2>{0.250000685f, 0.369611412f},
-std::array<float,2>{0.790689409f, 0.521657586f},
-std::array<float,2>{0.844982028f, 0.0453886539f},
-std::array<float,2>{0.368079871f, 0.772527456f},
-std::array<float,2>{0.0477178656f, 0.408746272f},
-std::array<float,2>{0.735771775f, 0.742813289f},
-std::array<float,2>{0.517237782f, 0.281738937f},
-std::array<float,2>{0.160897791f, 0.574802041f},
-std::array<float,2>{0.410782725f, 0.208356932f},
-std::array<float,2>{0.908660531f, 0.887190044f},
-std::array<float,2>{0.842871189f, 0.432893544f},
-std::array<float,2>{0.323284388f, 0.729582965f},
-std::array<float,2>{0.0119373221f, 0.0543424971f},
-std::array<float,2>{0.692347288f, 0.760615289f},
-std::array<float,2>{0.538884223f, 0.187720209f},
-std::array<float,2>{0.13138561f, 0.894427955f},
-std::array<float,2>{0.375061959f, 0.301232606f},
-std::array<float,2>{0.893282413f, 0.591677785f},
-std::array<float,2>{0.990433276f, 0.108953118f},
-std::array<float,2>{0.450692415f, 0.863623619f},
-std::array<float,2>{0.241934806f, 0.439332247f},
-std::array<float,2>{0.574997723f, 0.637804806f},
-std::array<float,2>{0.666017234f, 0.352589905f},
-std::array<float,2>{0.0947705656f, 0.502849698f},
-std::array<float,2>{0.303023487f, 0.128565595f},
-std::array<float,2>{0.756653965f, 0.957293272f},
-std::array<float,2>{0.923972607f, 0.280494034f},
-std::array<float,2>{0.423909217f, 0.610398173f},
-std::array<float,2>{0.185508013f, 0.235909209f},
-std::array<float,2>{0.500056386f, 0.915424764f},
-std::array<float,2>{0.728564203f, 0.0208098609f},
-std::array<float,2>{0.0351413153f, 0.81064713f},
-std::array<float,2>{0.346921176f, 0.400988668f},
-std::array<float,2>{0.8683182f, 0.702170789f},
-std::array<float,2>{0.807620287f, 0.177942604f},
-std::array<float,2>{0.268268228f, 0.993856549f},
-std::array<float,2>{0.0682280213f, 0.319945693f},
-std::array<float,2>{0.635756135f, 0.54850322f},
-std::array<float,2>{0.611399531f, 0.483116716f},
-std::array<float,2>{0.194145009f, 0.673921406f},
-std::array<float,2>{0.498065591f, 0.0810538605f},
-std::array<float,2>{0.940597534f, 0.839819968f},
-std::array<float,2>{0.863905311f, 0.310418278f},
-std::array<float,2>{0.358189911f, 0.578558207f},
-std::array<float,2>{0.0406575128f, 0.200213537f},
-std::array<float,2>{0.726274073f, 0.904196262f},
-std::array<float,2>{0.509668291f, 0.0571564995f},
-std::array<float,2>{0.174295098f, 0.756826758f},
-std::array<float,2>{0.434277147f, 0.42473042f},
-std::array<float,2>{0.935672462f, 0.722342253f},
-std::array<float,2>{0.949027419f, 0.133982599f},
-std::array<float,2>{0.486915648f, 0.964082479f},
-std::array<float,2>{0.200388059f, 0.344624937f},
-std::array<float,2>{0.624815047f, 0.511677742f},
-std::array<float,2>{0.631969154f, 0.449444711f},
-std::array<float,2>{0.0717407987f, 0.625243306f},
-std::array<float,2>{0.280148834f, 0.0972667634f},
-std::array<float,2>{0.803749263f, 0.869283676f},
-std::array<float,2>{0.905430377f, 0.39199695f},
-std::array<float,2>{0.385648876f, 0.692506433f},
-std::array<float,2>{0.136426225f, 0.0258264299f},
-std::array<float,2>{0.540616512f, 0.801134109f},
-std::array<float,2>{0.700390875f, 0.24653922f},
-std::array<float,2>{0.00195207843f, 0.908811152f},
-std::array<float,2>{0.319539845f, 0.265869081f},
-std::array<float,2>{0.835200191f, 0.622702122f},
-std::array<float,2>{0.764280736f, 0.0931987315f},
-std::array<float,2>{0.308955759f, 0.835608006f},
-std::array<float,2>{0.103872128f, 0.476443648f},
-std::array<float,2>{0.661313057f, 0.681146681f},
-std::array<float,2>{0.569760799f, 0.321072042f},
-std::array<float,2>{0.242272764f, 0.561970353f},
-std::array<float,2>{0.444590509f, 0.185736358f},
-std::array<float,2>{0.998317122f, 0.988688052f},
-std::array<float,2>{0.786921144f, 0.498011559f},
-std::array<float,2>{0.258470118f, 0.660326302f},
-std::array<float,2>{0.078210555f, 0.0749036446f},
-std::array<float,2>{0.65363884f, 0.818571448f},
-std::array<float,2>{0.594210088f, 0.171393022f},
-std::array<float,2>{0.203564376f, 0.981248438f},
-std::array<float,2>{0.475191385f, 0.33810848f},
-std::array<float,2>{0.955710232f, 0.533090234f},
-std::array<float,2>{0.915975392f, 0.00508078746f},
-std::array<float,2>{0.414373636f, 0.788749814f},
-std::array<float,2>{0.166137934f, 0.375447601f},
-std::array<float,2>{0.526836693f, 0.703845143f},
-std::array<float,2>{0.744121194f, 0.265199602f},
-std::array<float,2>{0.0558762662f, 0.605495155f},
-std::array<float,2>{0.362086147f, 0.22018674f},
-std::array<float,2>{0.859263062f, 0.922782958f},
-std::array<float,2>{0.981939733f, 0.36018756f},
-std::array<float,2>{0.466686994f, 0.529171824f},
-std::array<float,2>{0.233983666f, 0.155274838f},
-std::array<float,2>{0.580233634f, 0.944136918f},
-std::array<float,2>{0.677751899f, 0.119388327f},
-std::array<float,2>{0.120746747f, 0.853414476f},
-std::array<float,2>{0.286663949f, 0.459005177f},
-std::array<float,2>{0.77363795f, 0.647656322f},
-std::array<float,2>{0.814816535f, 0.218232989f},
-std::array<float,2>{0.330351084f, 0.882559955f},
-std::array<float,2>{0.0279938038f, 0.295292139f},
-std::array<float,2>{0.71300143f, 0.563538313f},
-std::array<float,2>{0.55351007f, 0.417706132f},
-std::array<float,2>{0.155773237f, 0.738000989f},
-std::array<float,2>{0.405213416f, 0.0341431424f},
-std::array<float,2>{0.885619402f, 0.773955584f},
-std::array<float,2>{0.797622502f, 0.250347316f},
-std::array<float,2>{0.274319708f, 0.597965658f},
-std::array<float,2>{0.0758344755f, 0.231474087f},
-std::array<float,2>{0.625924945f, 0.932293355f},
-std::array<float,2>{0.61722666f, 0.0147375846f},
-std::array<float,2>{0.195697844f, 0.794219315f},
-std::array<float,2>{0.488588005f, 0.385561913f},
-std::array<float,2>{0.951638043f, 0.712455213f},
-std::array<float,2>{0.933566391f, 0.160332188f},
-std::array<float,2>{0.432267785f, 0.974528491f},
-std::array<float,2>{0.179659739f, 0.334846914f},
-std::array<float,2>{0.512581468f, 0.540691733f},
-std::array<float,2>{0.719200611f, 0.48612836f},
-std::array<float,2>{0.0440680943f, 0.668627262f},
-std::array<float,2>{0.354194403f, 0.0672048554f},
-std::array<float,2>{0.862178206f, 0.825396776f},
-std::array<float,2>{0.995104134f, 0.411489308f},
-std::array<float,2>{0.438841045f, 0.747257471f},
-std::array<float,2>{0.246479988f, 0.0428866297f},
-std::array<float,2>{0.565325916f, 0.766794086f},
-std::array<float,2>{0.658889651f, 0.203794852f},
-std::array<float,2>{0.106643915f, 0.884556055f},
-std::array<float,2>{0.305553377f, 0.286710531f},
-std::array<float,2>{0.759309888f, 0.572504401f},
-std::array<float,2>{0.831556797f, 0.109824479f},
-std::array<float,2>{0.315379679f, 0.846448421f},
-std::array<float,2>{0.00469725206f, 0.46590063f},
-std::array<float,2>{0.697808325f, 0.64857161f},
-std::array<float,2>{0.546283066f, 0.37166208f},
-std::array<float,2>{0.137034476f, 0.517258763f},
-std::array<float,2>{0.387574196f, 0.144093215f},
-std::array<float,2>{0.89872098f, 0.945568204f},
-std::array<float,2>{0.852791011f, 0.442923188f},
-std::array<float,2>{0.364071339f, 0.634142399f},
-std::array<float,2>{0.0598822758f, 0.105184123f},
-std::array<float,2>{0.746119022f, 0.862650752f},
-std::array<float,2>{0.530074537f, 0.131752536f},
-std::array<float,2>{0.171170846f, 0.954969764f},
-std::array<float,2>{0.421839088f, 0.35691309f},
-std::array<float,2>{0.920383573f, 0.505426586f},
-std::array<float,2>{0.960336626f, 0.0481336825f},
-std::array<float,2>{0.470149577f, 0.763131559f},
-std::array<float,2>{0.210050896f, 0.434399843f},
-std::array<float,2>{0.601170897f, 0.732962906f},
-std::array<float,2>{0.649937451f, 0.298002005f},
-std::array<float,2>{0.0835130587f, 0.588956594f},
-std::array<float,2>{0.262895525f, 0.191875875f},
-std::array<float,2>{0.784009457f, 0.895420969f},
-std::array<float,2>{0.887080848f, 0.3153705f},
-std::array<float,2>{0.399236947f, 0.551705301f},
-std::array<float,2>{0.149634108f, 0.173589051f},
-std::array<float,2>{0.548092306f, 0.998911142f},
-std::array<float,2>{0.718339741f, 0.0843518153f},
-std::array<float,2>{0.0242504943f, 0.839853883f},
-std::array<float,2>{0.334472716f, 0.479651928f},
-std::array<float,2>{0.819246769f, 0.676355481f},
-std::array<float,2>{0.779570818f, 0.241370246f},
-std::array<float,2>{0.283768773f, 0.921221256f},
-std::array<float,2>{0.124663606f, 0.274442852f},
-std::array<float,2>{0.672608793f, 0.6139763f},
-std::array<float,2>{0.583571136f, 0.404680043f},
-std::array<float,2>{0.227356106f, 0.698685586f},
-std::array<float,2>{0.461624503f, 0.0183011983f},
-std::array<float,2>{0.977359116f, 0.805675626f},
-std::array<float,2>{0.825089455f, 0.350063473f},
-std::array<float,2>{0.34128648f, 0.513295114f},
-std::array<float,2>{0.0178859122f, 0.138745531f},
-std::array<float,2>{0.706683159f, 0.966816783f},
-std::array<float,2>{0.560824633f, 0.0984512642f},
-std::array<float,2>{0.142209232f, 0.872802675f},
-std::array<float,2>{0.392320514f, 0.449100047f},
-std::array<float,2>{0.880238593f, 0.631089866f},
-std::array<float,2>{0.970456958f, 0.197905883f},
-std::array<float,2>{0.459524542f, 0.899693072f},
-std::array<float,2>{0.222578734f, 0.307732016f},
-std::array<float,2>{0.589556813f, 0.583827198f},
-std::array<float,2>{0.685040951f, 0.429128438f},
-std::array<float,2>{0.115175121f, 0.724893212f},
-std::array<float,2>{0.295774788f, 0.0623385906f},
-std::array<float,2>{0.769674182f, 0.753872156f},
-std::array<float,2>{0.912194192f, 0.469869643f},
-std::array<float,2>{0.407819569f, 0.684845924f},
-std::array<float,2>{0.15649648f, 0.0867074206f},
-std::array<float,2>{0.523165941f, 0.829927027f},
-std::array<float,2>{0.741074264f, 0.181159705f},
-std::array<float,2>{0.0545595735f, 0.986885369f},
-std::array<float,2>{0.374851644f, 0.326875806f},
-std::array<float,2>{0.850612581f, 0.557840645f},
-std::array<float,2>{0.794433951f, 0.0278272517f},
-std::array<float,2>{0.254515558f, 0.797161222f},
-std::array<float,2>{0.0902445018f, 0.397513837f},
-std::array<float,2>{0.647614837f, 0.687635362f},
-std::array<float,2>{0.607200027f, 0.271508008f},
-std::array<float,2>{0.217947215f, 0.617221892f},
-std::array<float,2>{0.482975483f, 0.243820414f},
-std::array<float,2>{0.968643427f, 0.913204253f},
-std::array<float,2>{0.7507689f, 0.379015297f},
-std::array<float,2>{0.30056268f, 0.708677948f},
-std::array<float,2>{0.0989928618f, 0.000882233144f},
-std::array<float,2>{0.669793904f, 0.784429967f},
-std::array<float,2>{0.570975602f, 0.224094301f},
-std::array<float,2>{0.236297742f, 0.92931056f},
-std::array<float,2>{0.447093219f, 0.261636853f},
-std::array<float,2>{0.988019049f, 0.602735281f},
-std::array<float,2>{0.895824432f, 0.0706930608f},
-std::array<float,2>{0.379633754f, 0.812894762f},
-std::array<float,2>{0.128787786f, 0.493341058f},
-std::array<float,2>{0.5326612f, 0.65747118f},
-std::array<float,2>{0.690039337f, 0.342361808f},
-std::array<float,2>{0.0112160556f, 0.53552115f},
-std::array<float,2>{0.324757099f, 0.165388107f},
-std::array<float,2>{0.838435113f, 0.97875005f},
-std::array<float,2>{0.944421411f, 0.290329784f},
-std::array<float,2>{0.495113492f, 0.569930851f},
-std::array<float,2>{0.187775165f, 0.212425843f},
-std::array<float,2>{0.616606593f, 0.875019252f},
-std::array<float,2>{0.639472008f, 0.0382873341f},
-std::array<float,2>{0.0633977801f, 0.777900696f},
-std::array<float,2>{0.272967726f, 0.419052154f},
-std::array<float,2>{0.812116444f, 0.741852045f},
-std::array<float,2>{0.874332309f, 0.148594588f},
-std::array<float,2>{0.35098511f, 0.941145718f},
-std::array<float,2>{0.0375328809f, 0.364312679f},
-std::array<float,2>{0.732623041f, 0.526427686f},
-std::array<float,2>{0.507794499f, 0.453745335f},
-std::array<float,2>{0.182794809f, 0.641343832f},
-std::array<float,2>{0.429080784f, 0.123221725f},
-std::array<float,2>{0.926201522f, 0.857195497f},
-std::array<float,2>{0.757368028f, 0.354476333f},
-std::array<float,2>{0.304566681f, 0.500535846f},
-std::array<float,2>{0.0945333764f, 0.126554847f},
-std::array<float,2>{0.667100966f, 0.95919472f},
-std::array<float,2>{0.575259984f, 0.106419474f},
-std::array<float,2>{0.240911335f, 0.866307318f},
-std::array<float,2>{0.449824035f, 0.439484626f},
-std::array<float,2>{0.992064416f, 0.639521778f},
-std::array<float,2>{0.893736064f, 0.191385105f},
-std::array<float,2>{0.376102507f, 0.891518593f},
-std::array<float,2>{0.132359713f, 0.303367317f},
-std::array<float,2>{0.537723184f, 0.592221916f},
-std::array<float,2>{0.692948997f, 0.430310041f},
-std::array<float,2>{0.0135761872f, 0.72702235f},
-std::array<float,2>{0.322658151f, 0.0512964614f},
-std::array<float,2>{0.842190802f, 0.759185493f},
-std::array<float,2>{0.9396016f, 0.481491208f},
-std::array<float,2>{0.499060214f, 0.672203004f},
-std::array<float,2>{0.194388092f, 0.0781562999f},
-std::array<float,2>{0.61255759f, 0.836502314f},
-std::array<float,2>{0.635647774f, 0.175842494f},
-std::array<float,2>{0.0671616346f, 0.99608022f},
-std::array<float,2>{0.26919347f, 0.317437798f},
-std::array<float,2>{0.807464361f, 0.549252927f},
-std::array<float,2>{0.867861986f, 0.0229349993f},
-std::array<float,2>{0.346088767f, 0.810407758f},
-std::array<float,2>{0.0338470265f, 0.399052113f},
-std::array<float,2>{0.729720712f, 0.699255824f},
-std::array<float,2>{0.501792192f, 0.27897048f},
-std::array<float,2>{0.184007302f, 0.612700462f},
-std::array<float,2>{0.425539553f, 0.237287164f},
-std::array<float,2>{0.925615191f, 0.9165259f},
-std::array<float,2>{0.821486473f, 0.390080988f},
-std::array<float,2>{0.338872015f, 0.718364894f},
-std::array<float,2>{0.020914821f, 0.00913664233f},
-std::array<float,2>{0.709191024f, 0.792263865f},
-std::array<float,2>{0.556305289f, 0.22911711f},
-std::array<float,2>{0.145651624f, 0.937335372f},
-std::array<float,2>{0.397317469f, 0.254470617f},
-std::array<float,2>{0.87705034f, 0.59451431f},
-std::array<float,2>{0.973410904f, 0.0636224821f},
-std::array<float,2>{0.456211835f, 0.823163211f},
-std::array<float,2>{0.225468844f, 0.48970747f},
-std::array<float,2>{0.592883646f, 0.664648533f},
-std::array<float,2>{0.67972964f, 0.331854105f},
-std::array<float,2>{0.110776328f, 0.545947611f},
-std::array<float,2>{0.29038319f, 0.157525092f},
-std::array<float,2>{0.769369006f, 0.970698774f},
-std::array<float,2>{0.90970695f, 0.284891307f},
-std::array<float,2>{0.411732584f, 0.577874184f},
-std::array<float,2>{0.161477491f, 0.210412189f},
-std::array<float,2>{0.516397834f, 0.889277995f},
-std::array<float,2>{0.735228419f, 0.0437226929f},
-std::array<float,2>{0.0487331115f, 0.770027459f},
-std::array<float,2>{0.368799746f, 0.406909585f},
-std::array<float,2>{0.843989432f, 0.745833337f},
-std::array<float,2>{0.789922357f, 0.146488637f},
-std::array<float,2>{0.251043588f, 0.951926351f},
-std::array<float,2>{0.0872270241f, 0.368528008f},
-std::array<float,2>{0.642575979f, 0.520865679f},
-std::array<float,2>{0.604549348f, 0.464364767f},
-std::array<float,2>{0.214422569f, 0.656038821f},
-std::array<float,2>{0.477540672f, 0.115223818f},
-std::array<float,2>{0.961787641f, 0.84837234f},
-std::array<float,2>{0.85827136f, 0.263159305f},
-std::array<float,2>{0.363279015f, 0.608625948f},
-std::array<float,2>{0.0548679195f, 0.22092694f},
-std::array<float,2>{0.742266595f, 0.924182117f},
-std::array<float,2>{0.5256446f, 0.00661448482f},
-std::array<float,2>{0.167938858f, 0.785385251f},
-std::array<float,2>{0.415323287f, 0.376983523f},
-std::array<float,2>{0.914668798f, 0.706525266f},
-std::array<float,2>{0.957003832f, 0.169175625f},
-std::array<float,2>{0.475964129f, 0.98275429f},
-std::array<float,2>{0.204982206f, 0.337355018f},
-std::array<float,2>{0.595337093f, 0.533439696f},
-std::array<float,2>{0.652734935f, 0.49842003f},
-std::array<float,2>{0.0796256587f, 0.66245091f},
-std::array<float,2>{0.259311169f, 0.0771864504f},
-std::array<float,2>{0.785636961f, 0.817405283f},
-std::array<float,2>{0.886155486f, 0.414075732f},
-std::array<float,2>{0.406237304f, 0.734467208f},
-std::array<float,2>{0.154763743f, 0.0312726945f},
-std::array<float,2>{0.554515123f, 0.777334511f},
-std::array<float,2>{0.714583814f, 0.21508947f},
-std::array<float,2>{0.028380502f, 0.879511535f},
-std::array<float,2>{0.331209511f, 0.294580102f},
-std::array<float,2>{0.815542996f, 0.565171719f},
-std::array<float,2>{0.774795592f, 0.11825455f},
-std::array<float,2>{0.286053985f, 0.854904652f},
-std::array<float,2>{0.120041281f, 0.457222283f},
-std::array<float,2>{0.679285586f, 0.64523232f},
-std::array<float,2>{0.581120133f, 0.362989277f},
-std::array<float,2>{0.232668415f, 0.530289412f},
-std::array<float,2>{0.465333253f, 0.153013125f},
-std::array<float,2>{0.98109591f, 0.943272173f},
-std::array<float,2>{0.803264558f, 0.451249123f},
-std::array<float,2>{0.280391067f, 0.627545953f},
-std::array<float,2>{0.0708753243f, 0.0951585099f},
-std::array<float,2>{0.630870879f, 0.868232191f},
-std::array<float,2>{0.623748839f, 0.135043249f},
-std::array<float,2>{0.200143605f, 0.962191403f},
-std::array<float,2>{0.487370759f, 0.347140372f},
-std::array<float,2>{0.947758496f, 0.508862495f},
-std::array<float,2>{0.93660289f, 0.0553762764f},
-std::array<float,2>{0.434998661f, 0.755501866f},
-std::array<float,2>{0.174921989f, 0.423503548f},
-std::array<float,2>{0.508260489f, 0.720546007f},
-std::array<float,2>{0.72465688f, 0.310785562f},
-std::array<float,2>{0.0395561643f, 0.580265403f},
-std::array<float,2>{0.359232545f, 0.201753259f},
-std::array<float,2>{0.864947259f, 0.905864954f},
-std::array<float,2>{0.99947542f, 0.323617846f},
-std::array<float,2>{0.443885446f, 0.558867514f},
-std::array<float,2>{0.243266329f, 0.184379071f},
-std::array<float,2>{0.568994164f, 0.990340292f},
-std::array<float,2>{0.660234153f, 0.0908027366f},
-std::array<float,2>{0.105062649f, 0.833287537f},
-std::array<float,2>{0.31012404f, 0.473198295f},
-std::array<float,2>{0.764935434f, 0.683221042f},
-std::array<float,2>{0.83492595f, 0.249990091f},
-std::array<float,2>{0.318837464f, 0.907231987f},
-std::array<float,2>{0.000636654964f, 0.269153267f},
-std::array<float,2>{0.69966352f, 0.624105752f},
-std::array<float,2>{0.539442003f, 0.39424476f},
-std::array<float,2>{0.135483399f, 0.695232928f},
-std::array<float,2>{0.38663125f, 0.0249989647f},
-std::array<float,2>{0.904396594f, 0.803168714f},
-std::array<float,2>{0.785095215f, 0.299788892f},
-std::array<float,2>{0.262289464f, 0.586850286f},
-std::array<float,2>{0.0828682184f, 0.193379834f},
-std::array<float,2>{0.648893893f, 0.89781636f},
-std::array<float,2>{0.600189388f, 0.0497346185f},
-std::array<float,2>{0.209210888f, 0.765209615f},
-std::array<float,2>{0.469503969f, 0.43734777f},
-std::array<float,2>{0.959428608f, 0.73147428f},
-std::array<float,2>{0.921761632f, 0.129983693f},
-std::array<float,2>{0.420817763f, 0.956681132f},
-std::array<float,2>{0.170477867f, 0.359234452f},
-std::array<float,2>{0.530578434f, 0.507273495f},
-std::array<float,2>{0.747849166f, 0.444902986f},
-std::array<float,2>{0.0594632626f, 0.634778798f},
-std::array<float,2>{0.36458993f, 0.102368727f},
-std::array<float,2>{0.852285862f, 0.860989273f},
-std::array<float,2>{0.97846061f, 0.403529674f},
-std::array<float,2>{0.462531537f, 0.697166562f},
-std::array<float,2>{0.227878258f, 0.0166108273f},
-std::array<float,2>{0.582574069f, 0.807814181f},
-std::array<float,2>{0.673644602f, 0.238614023f},
-std::array<float,2>{0.123159543f, 0.918074727f},
-std::array<float,2>{0.28466928f, 0.276653171f},
-std::array<float,2>{0.780911446f, 0.616580546f},
-std::array<float,2>{0.819489539f, 0.0835540295f},
-std::array<float,2>{0.335843623f, 0.842059433f},
-std::array<float,2>{0.0248256382f, 0.478515446f},
-std::array<float,2>{0.717423141f, 0.679478049f},
-std::array<float,2>{0.546972096f, 0.312838733f},
-std::array<float,2>{0.148969829f, 0.553109467f},
-std::array<float,2>{0.399951279f, 0.17393364f},
-std::array<float,2>{0.888582766f, 0.998003125f},
-std::array<float,2>{0.863253474f, 0.487294585f},
-std::array<float,2>{0.354496956f, 0.671399474f},
-std::array<float,2>{0.0438369438f, 0.0698301569f},
-std::array<float,2>{0.72028476f, 0.827953041f},
-std::array<float,2>{0.512925744f, 0.162993342f},
-std::array<float,2>{0.178003147f, 0.975594938f},
-std::array<float,2>{0.432960153f, 0.333862215f},
-std::array<float,2>{0.932313085f, 0.542863727f},
-std::array<float,2>{0.952544868f, 0.0129976124f},
-std::array<float,2>{0.489535332f, 0.795871437f},
-std::array<float,2>{0.196490183f, 0.382825702f},
-std::array<float,2>{0.619018257f, 0.713585258f},
-std::array<float,2>{0.626635134f, 0.253080904f},
-std::array<float,2>{0.0748220906f, 0.601432621f},
-std::array<float,2>{0.275082082f, 0.233552858f},
-std::array<float,2>{0.798263669f, 0.931414604f},
-std::array<float,2>{0.899484813f, 0.374313027f},
-std::array<float,2>{0.388357937f, 0.518485129f},
-std::array<float,2>{0.138510242f, 0.141151458f},
-std::array<float,2>{0.545183539f, 0.949042976f},
-std::array<float,2>{0.699051201f, 0.11173106f},
-std::array<float,2>{0.0052244151f, 0.845297098f},
-std::array<float,2>{0.316021591f, 0.468370944f},
-std::array<float,2>{0.830359101f, 0.650915205f},
-std::array<float,2>{0.75861752f, 0.205838144f},
-std::array<float,2>{0.305941701f, 0.884929359f},
-std::array<float,2>{0.106085196f, 0.28900519f},
-std::array<float,2>{0.659998536f, 0.5717116f},
-std::array<float,2>{0.565704703f, 0.412586361f},
-std::array<float,2>{0.247688815f, 0.749866784f},
-std::array<float,2>{0.438379318f, 0.0399984159f},
-std::array<float,2>{0.99526906f, 0.769378662f},
-std::array<float,2>{0.839267015f, 0.340220928f},
-std::array<float,2>{0.326137602f, 0.538699567f},
-std::array<float,2>{0.0106631275f, 0.167855963f},
-std::array<float,2>{0.690669477f, 0.977304041f},
-std::array<float,2>{0.531821609f, 0.0737696663f},
-std::array<float,2>{0.127001271f, 0.814786136f},
-std::array<float,2>{0.380098045f, 0.495839447f},
-std::array<float,2>{0.89502579f, 0.659834921f},
-std::array<float,2>{0.986636579f, 0.224706635f},
-std::array<float,2>{0.445596248f, 0.925942004f},
-std::array<float,2>{0.235118985f, 0.259624451f},
-std::array<float,2>{0.57214874f, 0.60535264f},
-std::array<float,2>{0.66872865f, 0.381140232f},
-std::array<float,2>{0.0980433151f, 0.709177256f},
-std::array<float,2>{0.299376905f, 0.00258558989f},
-std::array<float,2>{0.75174123f, 0.783131063f},
-std::array<float,2>{0.927165449f, 0.456900328f},
-std::array<float,2>{0.427862436f, 0.643717468f},
-std::array<float,2>{0.181974962f, 0.121936776f},
-std::array<float,2>{0.506316841f, 0.857916534f},
-std::array<float,2>{0.73384887f, 0.151627108f},
-std::array<float,2>{0.0388822779f, 0.93909812f},
-std::array<float,2>{0.349995732f, 0.365809679f},
-std::array<float,2>{0.87396121f, 0.523645043f},
-std::array<float,2>{0.810718775f, 0.0368648767f},
-std::array<float,2>{0.272295445f, 0.780122757f},
-std::array<float,2>{0.0643951446f, 0.420132011f},
-std::array<float,2>{0.640476644f, 0.739386618f},
-std::array<float,2>{0.615500093f, 0.291342437f},
-std::array<float,2>{0.189079747f, 0.568252742f},
-std::array<float,2>{0.495778084f, 0.213949054f},
-std::array<float,2>{0.944191039f, 0.878716886f},
-std::array<float,2>{0.771458268f, 0.426915586f},
-std::array<float,2>{0.296691775f, 0.723059475f},
-std::array<float,2>{0.113372646f, 0.058705207f},
-std::array<float,2>{0.684488118f, 0.75181222f},
-std::array<float,2>{0.588834941f, 0.196809769f},
-std::array<float,2>{0.220835671f, 0.901077569f},
-std::array<float,2>{0.460575134f, 0.30570212f},
-std::array<float,2>{0.968998194f, 0.584566712f},
-std::array<float,2>{0.879851162f, 0.0996866599f},
-std::array<float,2>{0.391309977f, 0.8741768f},
-std::array<float,2>{0.14109832f, 0.445978671f},
-std::array<float,2>{0.562111676f, 0.630734444f},
-std::array<float,2>{0.705507159f, 0.349147618f},
-std::array<float,2>{0.0191388372f, 0.513746142f},
-std::array<float,2>{0.340061426f, 0.138375223f},
-std::array<float,2>{0.825314343f, 0.965728164f},
-std::array<float,2>{0.966876984f, 0.271328628f},
-std::array<float,2>{0.483667195f, 0.619474769f},
-std::array<float,2>{0.217211604f, 0.244751066f},
-std::array<float,2>{0.606115103f, 0.910966635f},
-std::array<float,2>{0.646602988f, 0.030521879f},
-std::array<float,2>{0.0910415426f, 0.799713194f},
-std::array<float,2>{0.255510092f, 0.395907879f},
-std::array<float,2>{0.793048859f, 0.690235794f},
-std::array<float,2>{0.850154817f, 0.182530522f},
-std::array<float,2>{0.373497069f, 0.986060619f},
-std::array<float,2>{0.0530919693f, 0.325563461f},
-std::array<float,2>{0.741442323f, 0.554915249f},
-std::array<float,2>{0.522207737f, 0.471451998f},
-std::array<float,2>{0.157934204f, 0.687467277f},
-std::array<float,2>{0.406305671f, 0.0885494053f},
-std::array<float,2>{0.913440943f, 0.831670344f},
-std::array<float,2>{0.806114316f, 0.319274127f},
-std::array<float,2>{0.267530411f, 0.547575951f},
-std::array<float,2>{0.0702712163f, 0.179664984f},
-std::array<float,2>{0.634106278f, 0.992217124f},
-std::array<float,2>{0.609901547f, 0.0815615579f},
-std::array<float,2>{0.191931874f, 0.838819623f},
-std::array<float,2>{0.496859372f, 0.483700454f},
-std::array<float,2>{0.938277602f, 0.674993515f},
-std::array<float,2>{0.921932042f, 0.235346884f},
-std::array<float,2>{0.422787786f, 0.914615095f},
-std::array<float,2>{0.185869098f, 0.279427081f},
-std::array<float,2>{0.503447711f, 0.609403789f},
-std::array<float,2>{0.728136659f, 0.40142101f},
-std::array<float,2>{0.0328176022f, 0.701799572f},
-std::array<float,2>{0.344930649f, 0.0196982492f},
-std::array<float,2>{0.86937809f, 0.811864018f},
-std::array<float,2>{0.989262462f, 0.438468665f},
-std::array<float,2>{0.451363325f, 0.636871159f},
-std::array<float,2>{0.24015139f, 0.107729979f},
-std::array<float,2>{0.577796638f, 0.864953458f},
-std::array<float,2>{0.665213048f, 0.127767324f},
-std::array<float,2>{0.0974844173f, 0.958258569f},
-std::array<float,2>{0.300935358f, 0.352510929f},
-std::array<float,2>{0.755025566f, 0.503790319f},
-std::array<float,2>{0.840890408f, 0.0530707613f},
-std::array<float,2>{0.321882963f, 0.761234522f},
-std::array<float,2>{0.0151879489f, 0.432420999f},
-std::array<float,2>{0.694003999f, 0.728907228f},
-std::array<float,2>{0.535552442f, 0.301779866f},
-std::array<float,2>{0.128966495f, 0.589974284f},
-std::array<float,2>{0.378238589f, 0.189008102f},
-std::array<float,2>{0.890951157f, 0.892870724f},
-std::array<float,2>{0.84687674f, 0.409536868f},
-std::array<float,2>{0.370995522f, 0.743645489f},
-std::array<float,2>{0.0502423234f, 0.0461679548f},
-std::array<float,2>{0.736517966f, 0.772450566f},
-std::array<float,2>{0.51887542f, 0.207509041f},
-std::array<float,2>{0.163817585f, 0.888283849f},
-std::array<float,2>{0.413236558f, 0.282883376f},
-std::array<float,2>{0.906562865f, 0.575677693f},
-std::array<float,2>{0.964471519f, 0.116511278f},
-std::array<float,2>{0.479082435f, 0.850156605f},
-std::array<float,2>{0.212826669f, 0.462812126f},
-std::array<float,2>{0.602778614f, 0.653412104f},
-std::array<float,2>{0.64298445f, 0.37022832f},
-std::array<float,2>{0.0886723176f, 0.523175359f},
-std::array<float,2>{0.253344178f, 0.144652486f},
-std::array<float,2>{0.791546762f, 0.950653017f},
-std::array<float,2>{0.875080228f, 0.257010549f},
-std::array<float,2>{0.395523399f, 0.597210646f},
-std::array<float,2>{0.148201466f, 0.228500783f},
-std::array<float,2>{0.557922661f, 0.935494006f},
-std::array<float,2>{0.707217991f, 0.0100307278f},
-std::array<float,2>{0.0220506527f, 0.789490104f},
-std::array<float,2>{0.336696237f, 0.38854897f},
-std::array<float,2>{0.823746026f, 0.715319812f},
-std::array<float,2>{0.767467618f, 0.158466935f},
-std::array<float,2>{0.291275442f, 0.971287489f},
-std::array<float,2>{0.112748638f, 0.32874316f},
-std::array<float,2>{0.682572186f, 0.544559777f},
-std::array<float,2>{0.591036737f, 0.490879804f},
-std::array<float,2>{0.223493546f, 0.666592658f},
-std::array<float,2>{0.453766257f, 0.0662841201f},
-std::array<float,2>{0.976207256f, 0.821012676f},
-std::array<float,2>{0.812918484f, 0.296664864f},
-std::array<float,2>{0.329551965f, 0.562523544f},
-std::array<float,2>{0.0305656586f, 0.217500642f},
-std::array<float,2>{0.711610317f, 0.8812989f},
-std::array<float,2>{0.551175416f, 0.0342404246f},
-std::array<float,2>{0.153067201f, 0.774853826f},
-std::array<float,2>{0.404061615f, 0.416333556f},
-std::array<float,2>{0.883420825f, 0.73704499f},
-std::array<float,2>{0.984016299f, 0.15495117f},
-std::array<float,2>{0.46728453f, 0.944399357f},
-std::array<float,2>{0.230703697f, 0.360790759f},
-std::array<float,2>{0.579070807f, 0.527778685f},
-std::array<float,2>{0.676595926f, 0.460650623f},
-std::array<float,2>{0.118701883f, 0.647059739f},
-std::array<float,2>{0.287640721f, 0.120306335f},
-std::array<float,2>{0.775561213f, 0.852001548f},
-std::array<float,2>{0.916943967f, 0.376547664f},
-std::array<float,2>{0.416689664f, 0.704752088f},
-std::array<float,2>{0.164163381f, 0.00438040635f},
-std::array<float,2>{0.525254905f, 0.787857592f},
-std::array<float,2>{0.746055961f, 0.219293326f},
-std::array<float,2>{0.0568042733f, 0.923329592f},
-std::array<float,2>{0.361250758f, 0.264548808f},
-std::array<float,2>{0.856952488f, 0.606807292f},
-std::array<float,2>{0.788565278f, 0.0759750381f},
-std::array<float,2>{0.261248827f, 0.819609404f},
-std::array<float,2>{0.0817050263f, 0.49642846f},
-std::array<float,2>{0.654685855f, 0.661350012f},
-std::array<float,2>{0.597124815f, 0.339667469f},
-std::array<float,2>{0.206236362f, 0.532050967f},
-std::array<float,2>{0.473155737f, 0.170045242f},
-std::array<float,2>{0.953224242f, 0.981847942f},
-std::array<float,2>{0.761969209f, 0.474987626f},
-std::array<float,2>{0.3110843f, 0.680038571f},
-std::array<float,2>{0.103311867f, 0.092517063f},
-std::array<float,2>{0.66367054f, 0.834907234f},
-std::array<float,2>{0.567879558f, 0.187305138f},
-std::array<float,2>{0.245045334f, 0.990035832f},
-std::array<float,2>{0.442161262f, 0.321367562f},
-std::array<float,2>{0.997601986f, 0.560862958f},
-std::array<float,2>{0.902541757f, 0.0270695426f},
-std::array<float,2>{0.383435309f, 0.802201688f},
-std::array<float,2>{0.133006305f, 0.391207248f},
-std::array<float,2>{0.542222917f, 0.692066431f},
-std::array<float,2>{0.701465905f, 0.267545044f},
-std::array<float,2>{0.00318951719f, 0.621704578f},
-std::array<float,2>{0.317365319f, 0.247320473f},
-std::array<float,2>{0.832840204f, 0.90953213f},
-std::array<float,2>{0.94582814f, 0.3448129f},
-std::array<float,2>{0.486043274f, 0.510063767f},
-std::array<float,2>{0.202010751f, 0.133237317f},
-std::array<float,2>{0.62134099f, 0.963556767f},
-std::array<float,2>{0.62975812f, 0.0957498029f},
-std::array<float,2>{0.0727477521f, 0.870998383f},
-std::array<float,2>{0.278876215f, 0.451071411f},
-std::array<float,2>{0.801256061f, 0.626680017f},
-std::array<float,2>{0.865316629f, 0.199785605f},
-std::array<float,2>{0.357234746f, 0.903232694f},
-std::array<float,2>{0.0415195748f, 0.309547842f},
-std::array<float,2>{0.722863436f, 0.579682052f},
-std::array<float,2>{0.510611176f, 0.425350368f},
-std::array<float,2>{0.172573417f, 0.721077681f},
-std::array<float,2>{0.435776502f, 0.0578332581f},
-std::array<float,2>{0.933707476f, 0.757713556f},
-std::array<float,2>{0.777799845f, 0.273718476f},
-std::array<float,2>{0.281268626f, 0.615210891f},
-std::array<float,2>{0.122797981f, 0.240750596f},
-std::array<float,2>{0.674842656f, 0.920374572f},
-std::array<float,2>{0.585579813f, 0.0194208585f},
-std::array<float,2>{0.230277166f, 0.805085421f},
-std::array<float,2>{0.464316577f, 0.405592591f},
-std::array<float,2>{0.978907347f, 0.6979478f},
-std::array<float,2>{0.889009893f, 0.172310784f},
-std::array<float,2>{0.402248323f, 0.999442339f},
-std::array<float,2>{0.151670307f, 0.315762222f},
-std::array<float,2>{0.549436748f, 0.55201602f},
-std::array<float,2>{0.716520727f, 0.47911796f},
-std::array<float,2>{0.0258281678f, 0.677132249f},
-std::array<float,2>{0.332119673f, 0.0857600421f},
-std::array<float,2>{0.81753099f, 0.841475904f},
-std::array<float,2>{0.957484722f, 0.435526371f},
-std::array<float,2>{0.47095874f, 0.734211504f},
-std::array<float,2>{0.207755104f, 0.0478230417f},
-std::array<float,2>{0.597813964f, 0.762289524f},
-std::array<float,2>{0.650855839f, 0.192413792f},
-std::array<float,2>{0.0840141326f, 0.895907283f},
-std::array<float,2>{0.263810784f, 0.297014713f},
-std::array<float,2>{0.781545103f, 0.588370204f},
-std::array<float,2>{0.854527116f, 0.103728026f},
-std::array<float,2>{0.366520882f, 0.861617506f},
-std::array<float,2>{0.0616320148f, 0.441463947f},
-std::array<float,2>{0.749129355f, 0.633267701f},
-std::array<float,2>{0.528524876f, 0.355669469f},
-std::array<float,2>{0.168808401f, 0.504383862f},
-std::array<float,2>{0.418967128f, 0.132686034f},
-std::array<float,2>{0.91835165f, 0.953834057f},
-std::array<float,2>{0.828741074f, 0.465439737f},
-std::array<float,2>{0.313492745f, 0.649645507f},
-std::array<float,2>{0.00649865856f, 0.110712908f},
-std::array<float,2>{0.695711553f, 0.847649217f},
-std::array<float,2>{0.543680549f, 0.143255129f},
-std::array<float,2>{0.139720187f, 0.946808159f},
-std::array<float,2>{0.390529692f, 0.372981846f},
-std::array<float,2>{0.901042461f, 0.51564616f},
-std::array<float,2>{0.992567182f, 0.0415098816f},
-std::array<float,2>{0.43993333f, 0.765673578f},
-std::array<float,2>{0.248299479f, 0.410546154f},
-std::array<float,2>{0.564423382f, 0.746171832f},
-std::array<float,2>{0.658016682f, 0.286046565f},
-std::array<float,2>{0.108946912f, 0.574014068f},
-std::array<float,2>{0.30821684f, 0.20420596f},
-std::array<float,2>{0.761701822f, 0.883391142f},
-std::array<float,2>{0.930680633f, 0.335139453f},
-std::array<float,2>{0.430590421f, 0.539244115f},
-std::array<float,2>{0.175814554f, 0.161993712f},
-std::array<float,2>{0.514469802f, 0.972856045f},
-std::array<float,2>{0.721117973f, 0.0676588863f},
-std::array<float,2>{0.044938311f, 0.82431066f},
-std::array<float,2>{0.351869732f, 0.484599829f},
-std::array<float,2>{0.861229479f, 0.669003248f},
-std::array<float,2>{0.799208641f, 0.231299952f},
-std::array<float,2>{0.276103705f, 0.933533072f},
-std::array<float,2>{0.0777066499f, 0.251908511f},
-std::array<float,2>{0.627981722f, 0.599544346f},
-std::array<float,2>{0.619251192f, 0.386054367f},
-std::array<float,2>{0.198988542f, 0.711866498f},
-std::array<float,2>{0.490682721f, 0.0140230628f},
-std::array<float,2>{0.950333536f, 0.793175817f},
-std::array<float,2>{0.871785641f, 0.363740385f},
-std::array<float,2>{0.348176926f, 0.52624315f},
-std::array<float,2>{0.0356716551f, 0.150182933f},
-std::array<float,2>{0.730712831f, 0.940013051f},
-std::array<float,2>{0.505769372f, 0.124209896f},
-std::array<float,2>{0.180456266f, 0.855996013f},
-std::array<float,2>{0.426178306f, 0.455074936f},
-std::array<float,2>{0.928250551f, 0.642566204f},
-std::array<float,2>{0.942407548f, 0.211267456f},
-std::array<float,2>{0.493901938f, 0.87640059f},
-std::array<float,2>{0.190866023f, 0.28982538f},
-std::array<float,2>{0.614476204f, 0.568454504f},
-std::array<float,2>{0.63794589f, 0.418766975f},
-std::array<float,2>{0.064627111f, 0.740302622f},
-std::array<float,2>{0.270774633f, 0.0380542055f},
-std::array<float,2>{0.809359491f, 0.778408647f},
-std::array<float,2>{0.897414505f, 0.492977858f},
-std::array<float,2>{0.381854147f, 0.656742752f},
-std::array<float,2>{0.126337454f, 0.0719463974f},
-std::array<float,2>{0.535033584f, 0.813927591f},
-std::array<float,2>{0.687933385f, 0.164120406f},
-std::array<float,2>{0.00783186499f, 0.979507148f},
-std::array<float,2>{0.327231467f, 0.342836231f},
-std::array<float,2>{0.836572111f, 0.536897242f},
-std::array<float,2>{0.752452314f, 0.00128249067f},
-std::array<float,2>{0.298745394f, 0.784071624f},
-std::array<float,2>{0.0997448266f, 0.379955858f},
-std::array<float,2>{0.671207786f, 0.707568765f},
-std::array<float,2>{0.572398245f, 0.260265648f},
-std::array<float,2>{0.236920595f, 0.602387547f},
-std::array<float,2>{0.447491825f, 0.223600805f},
-std::array<float,2>{0.98461324f, 0.927857816f},
-std::array<float,2>{0.796224594f, 0.396590024f},
-std::array<float,2>{0.25709492f, 0.689317822f},
-std::array<float,2>{0.0923158452f, 0.0289056264f},
-std::array<float,2>{0.646065831f, 0.798237443f},
-std::array<float,2>{0.607776701f, 0.242874444f},
-std::array<float,2>{0.215105519f, 0.912746489f},
-std::array<float,2>{0.4809708f, 0.272894323f},
-std::array<float,2>{0.966028452f, 0.618894517f},
-std::array<float,2>{0.911346376f, 0.0870639309f},
-std::array<float,2>{0.408636868f, 0.828663707f},
-std::array<float,2>{0.15921925f, 0.469049871f},
-std::array<float,2>{0.519737363f, 0.684522092f},
-std::array<float,2>{0.739613593f, 0.327562451f},
-std::array<float,2>{0.0508104153f, 0.557523966f},
-std::array<float,2>{0.371474355f, 0.179937452f},
-std::array<float,2>{0.849135518f, 0.988051772f},
-std::array<float,2>{0.972497046f, 0.307588041f},
-std::array<float,2>{0.457253069f, 0.582244694f},
-std::array<float,2>{0.218790457f, 0.198810056f},
-std::array<float,2>{0.58723861f, 0.89850378f},
-std::array<float,2>{0.68608427f, 0.0613516308f},
-std::array<float,2>{0.116515405f, 0.752180934f},
-std::array<float,2>{0.293025881f, 0.428277403f},
-std::array<float,2>{0.772925675f, 0.726081371f},
-std::array<float,2>{0.826244414f, 0.139796868f},
-std::array<float,2>{0.343276411f, 0.96837759f},
-std::array<float,2>{0.0160013679f, 0.351048291f},
-std::array<float,2>{0.703317046f, 0.511737466f},
-std::array<float,2>{0.559700251f, 0.448190033f},
-std::array<float,2>{0.142621964f, 0.632490575f},
-std::array<float,2>{0.393220097f, 0.0988043323f},
-std::array<float,2>{0.882344365f, 0.871788442f},
-std::array<float,2>{0.80161947f, 0.347518981f},
-std::array<float,2>{0.278587639f, 0.509337187f},
-std::array<float,2>{0.0732056499f, 0.135412112f},
-std::array<float,2>{0.629350066f, 0.962637126f},
-std::array<float,2>{0.621965766f, 0.0953747407f},
-std::array<float,2>{0.201375782f, 0.868865848f},
-std::array<float,2>{0.485501915f, 0.451986462f},
-std::array<float,2>{0.945683479f, 0.627158523f},
-std::array<float,2>{0.934298158f, 0.201623708f},
-std::array<float,2>{0.436520308f, 0.905609548f},
-std::array<float,2>{0.171962321f, 0.311293662f},
-std::array<float,2>{0.509905338f, 0.580712616f},
-std::array<float,2>{0.723462462f, 0.423103601f},
-std::array<float,2>{0.0411504842f, 0.720084667f},
-std::array<float,2>{0.356890529f, 0.0551387295f},
-std::array<float,2>{0.866050899f, 0.755274653f},
-std::array<float,2>{0.997407854f, 0.47278434f},
-std::array<float,2>{0.4416852f, 0.683059156f},
-std::array<float,2>{0.244277358f, 0.0899146423f},
-std::array<float,2>{0.567575336f, 0.833944798f},
-std::array<float,2>{0.663344502f, 0.183938473f},
-std::array<float,2>{0.102824196f, 0.99098748f},
-std::array<float,2>{0.310805142f, 0.32413426f},
-std::array<float,2>{0.762284815f, 0.559372663f},
-std::array<float,2>{0.832303822f, 0.024785094f},
-std::array<float,2>{0.316650361f, 0.803608716f},
-std::array<float,2>{0.00360708754f, 0.393622726f},
-std::array<float,2>{0.701703846f, 0.694470227f},
-std::array<float,2>{0.54257071f, 0.268959492f},
-std::array<float,2>{0.133419335f, 0.624642491f},
-std::array<float,2>{0.382965297f, 0.249132887f},
-std::array<float,2>{0.902832866f, 0.907993078f},
-std::array<float,2>{0.856665671f, 0.377775609f},
-std::array<float,2>{0.360385984f, 0.70663023f},
-std::array<float,2>{0.0573047958f, 0.00630257325f},
-std::array<float,2>{0.745411575f, 0.78564626f},
-std::array<float,2>{0.52464205f, 0.22136429f},
-std::array<float,2>{0.164863616f, 0.924675822f},
-std::array<float,2>{0.416344404f, 0.263398528f},
-std::array<float,2>{0.916481853f, 0.608985245f},
-std::array<float,2>{0.954044104f, 0.0778137818f},
-std::array<float,2>{0.472708821f, 0.818209112f},
-std::array<float,2>{0.206888586f, 0.49864313f},
-std::array<float,2>{0.597560167f, 0.662961721f},
-std::array<float,2>{0.655078113f, 0.337771952f},
-std::array<float,2>{0.0811325535f, 0.533841789f},
-std::array<float,2>{0.261111975f, 0.169453055f},
-std::array<float,2>{0.788997531f, 0.983037353f},
-std::array<float,2>{0.882939935f, 0.294185519f},
-std::array<float,2>{0.40334481f, 0.564701259f},
-std::array<float,2>{0.152541831f, 0.215383425f},
-std::array<float,2>{0.551422536f, 0.878983259f},
-std::array<float,2>{0.711420834f, 0.03177711f},
-std::array<float,2>{0.0309114605f, 0.776850045f},
-std::array<float,2>{0.330005407f, 0.414842337f},
-std::array<float,2>{0.813229561f, 0.735024273f},
-std::array<float,2>{0.776159048f, 0.152771831f},
-std::array<float,2>{0.287182868f, 0.942387521f},
-std::array<float,2>{0.118423931f, 0.362734258f},
-std::array<float,2>{0.676149428f, 0.531242311f},
-std::array<float,2>{0.578437567f, 0.457808852f},
-std::array<float,2>{0.231393337f, 0.64457792f},
-std::array<float,2>{0.467588425f, 0.119090512f},
-std::array<float,2>{0.983408809f, 0.855024457f},
-std::array<float,2>{0.823641956f, 0.254141599f},
-std::array<float,2>{0.336161494f, 0.594021797f},
-std::array<float,2>{0.0219316632f, 0.228967771f},
-std::array<float,2>{0.707836151f, 0.936981976f},
-std::array<float,2>{0.558152914f, 0.00960458722f},
-std::array<float,2>{0.147775739f, 0.792553306f},
-std::array<float,2>{0.396281511f, 0.39059636f},
-std::array<float,2>{0.875788808f, 0.718181193f},
-std::array<float,2>{0.975940824f, 0.15780887f},
-std::array<float,2>{0.453575522f, 0.97002995f},
-std::array<float,2>{0.22311987f, 0.331444561f},
-std::array<float,2>{0.591680348f, 0.546594977f},
-std::array<float,2>{0.681943417f, 0.490011156f},
-std::array<float,2>{0.112860292f, 0.664387226f},
-std::array<float,2>{0.291601986f, 0.0641085133f},
-std::array<float,2>{0.766914785f, 0.822664618f},
-std::array<float,2>{0.907025814f, 0.406563222f},
-std::array<float,2>{0.413844436f, 0.745419264f},
-std::array<float,2>{0.163516298f, 0.0431382246f},
-std::array<float,2>{0.519120097f, 0.769953072f},
-std::array<float,2>{0.737079442f, 0.210829407f},
-std::array<float,2>{0.0507619232f, 0.888888776f},
-std::array<float,2>{0.370356619f, 0.284350425f},
-std::array<float,2>{0.847232401f, 0.577250838f},
-std::array<float,2>{0.791406572f, 0.114442758f},
-std::array<float,2>{0.253610998f, 0.847832382f},
-std::array<float,2>{0.0883438066f, 0.464026779f},
-std::array<float,2>{0.643236101f, 0.655299306f},
-std::array<float,2>{0.60335964f, 0.368908525f},
-std::array<float,2>{0.212194979f, 0.521112382f},
-std::array<float,2>{0.478532195f, 0.147391364f},
-std::array<float,2>{0.964144528f, 0.951542854f},
-std::array<float,2>{0.755382419f, 0.44023037f},
-std::array<float,2>{0.301578671f, 0.638709784f},
-std::array<float,2>{0.0967788473f, 0.105585732f},
-std::array<float,2>{0.665822685f, 0.867021203f},
-std::array<float,2>{0.577344716f, 0.126024753f},
-std::array<float,2>{0.239423588f, 0.959845245f},
-std::array<float,2>{0.451730639f, 0.353832811f},
-std::array<float,2>{0.990014076f, 0.500218868f},
-std::array<float,2>{0.891278803f, 0.0509548523f},
-std::array<float,2>{0.378706664f, 0.759530306f},
-std::array<float,2>{0.129562348f, 0.429983944f},
-std::array<float,2>{0.535876393f, 0.727386773f},
-std::array<float,2>{0.693451583f, 0.302756757f},
-std::array<float,2>{0.0151154809f, 0.592320204f},
-std::array<float,2>{0.321333647f, 0.190696597f},
-std::array<float,2>{0.84154582f, 0.890650213f},
-std::array<float,2>{0.937514722f, 0.31798768f},
-std::array<float,2>{0.496482551f, 0.549526989f},
-std::array<float,2>{0.191445038f, 0.176405713f},
-std::array<float,2>{0.609629154f, 0.995315313f},
-std::array<float,2>{0.63430655f, 0.0789672285f},
-std::array<float,2>{0.0695264861f, 0.835937917f},
-std::array<float,2>{0.266841501f, 0.482180178f},
-std::array<float,2>{0.806286037f, 0.672519684f},
-std::array<float,2>{0.870116174f, 0.236537546f},
-std::array<float,2>{0.345513046f, 0.916088939f},
-std::array<float,2>{0.0323338881f, 0.278800637f},
-std::array<float,2>{0.727744818f, 0.613023937f},
-std::array<float,2>{0.50301224f, 0.398679525f},
-std::array<float,2>{0.18610099f, 0.700027108f},
-std::array<float,2>{0.422229648f, 0.0231647398f},
-std::array<float,2>{0.922693908f, 0.809595108f},
-std::array<float,2>{0.772962213f, 0.306263804f},
-std::array<float,2>{0.293551922f, 0.584270895f},
-std::array<float,2>{0.117063478f, 0.196686104f},
-std::array<float,2>{0.685993731f, 0.900585294f},
-std::array<float,2>{0.587402821f, 0.05929536f},
-std::array<float,2>{0.219375148f, 0.751071453f},
-std::array<float,2>{0.457923442f, 0.427473813f},
-std::array<float,2>{0.971907973f, 0.723169684f},
-std::array<float,2>{0.881968975f, 0.137826726f},
-std::array<float,2>{0.392938137f, 0.965110779f},
-std::array<float,2>{0.143518269f, 0.348882318f},
-std::array<float,2>{0.560247481f, 0.514198542f},
-std::array<float,2>{0.70408231f, 0.445537806f},
-std::array<float,2>{0.0162342023f, 0.629932523f},
-std::array<float,2>{0.342994481f, 0.100497589f},
-std::array<float,2>{0.826956928f, 0.874782503f},
-std::array<float,2>{0.966683984f, 0.396146417f},
-std::array<float,2>{0.480886608f, 0.689490199f},
-std::array<float,2>{0.215589523f, 0.0311774164f},
-std::array<float,2>{0.608010888f, 0.798949003f},
-std::array<float,2>{0.645959198f, 0.244241804f},
-std::array<float,2>{0.0922188833f, 0.910362184f},
-std::array<float,2>{0.257796139f, 0.270743817f},
-std::array<float,2>{0.796719134f, 0.619875371f},
-std::array<float,2>{0.848970473f, 0.0883619711f},
-std::array<float,2>{0.372032225f, 0.831076086f},
-std::array<float,2>{0.0513445623f, 0.471032053f},
-std::array<float,2>{0.739922702f, 0.686915636f},
-std::array<float,2>{0.520308673f, 0.325727344f},
-std::array<float,2>{0.160040736f, 0.555343091f},
-std::array<float,2>{0.409062654f, 0.181690276f},
-std::array<float,2>{0.911670804f, 0.985534489f},
-std::array<float,2>{0.83630234f, 0.495384544f},
-std::array<float,2>{0.327902555f, 0.659206212f},
-std::array<float,2>{0.00874408893f, 0.0736421645f},
-std::array<float,2>{0.688026249f, 0.815346539f},
-std::array<float,2>{0.534377813f, 0.167418331f},
-std::array<float,2>{0.126747385f, 0.976894259f},
-std::array<float,2>{0.382459313f, 0.34036395f},
-std::array<float,2>{0.896827519f, 0.53828603f},
-std::array<float,2>{0.985276699f, 0.0023764777f},
-std::array<float,2>{0.447987914f, 0.782234013f},
-std::array<float,2>{0.236627653f, 0.381794244f},
-std::array<float,2>{0.572810888f, 0.709816098f},
-std::array<float,2>{0.671573699f, 0.259214908f},
-std::array<float,2>{0.100328594f, 0.604827583f},
-std::array<float,2>{0.298199266f, 0.225223824f},
-std::array<float,2>{0.751953781f, 0.926521957f},
-std::array<float,2>{0.927792549f, 0.36534974f},
-std::array<float,2>{0.42639786f, 0.524168134f},
-std::array<float,2>{0.179901779f, 0.152015373f},
-std::array<float,2>{0.50509429f, 0.938750088f},
-std::array<float,2>{0.731129408f, 0.121377118f},
-std::array<float,2>{0.0354497135f, 0.857835889f},
-std::array<float,2>{0.347848237f, 0.456083179f},
-std::array<float,2>{0.871257484f, 0.644380629f},
-std::array<float,2>{0.80885005f, 0.214826852f},
-std::array<float,2>{0.271283984f, 0.878052354f},
-std::array<float,2>{0.0651599616f, 0.29196474f},
-std::array<float,2>{0.638528347f, 0.56749475f},
-std::array<float,2>{0.614947677f, 0.420846313f},
-std::array<float,2>{0.191297695f, 0.740183473f},
-std::array<float,2>{0.493196517f, 0.0363785438f},
-std::array<float,2>{0.943298399f, 0.779376328f},
-std::array<float,2>{0.860645175f, 0.333409995f},
-std::array<float,2>{0.352523834f, 0.54210937f},
-std::array<float,2>{0.045813825f, 0.162446454f},
-std::array<float,2>{0.72162658f, 0.976397038f},
-std::array<float,2>{0.513725698f, 0.0694882199f},
-std::array<float,2>{0.176643431f, 0.827206433f},
-std::array<float,2>{0.429843217f, 0.486398757f},
-std::array<float,2>{0.931495547f, 0.671016276f},
-std::array<float,2>{0.95109868f, 0.234363675f},
-std::array<float,2>{0.490794182f, 0.930889726f},
-std::array<float,2>{0.198522463f, 0.253487796f},
-std::array<float,2>{0.619980156f, 0.600604951f},
-std::array<float,2>{0.628801942f, 0.3835347f},
-std::array<float,2>{0.0774432793f, 0.713162422f},
-std::array<float,2>{0.275847167f, 0.0132860271f},
-std::array<float,2>{0.799706399f, 0.79520303f},
-std::array<float,2>{0.900439501f, 0.46805051f},
-std::array<float,2>{0.389897853f, 0.650576234f},
-std::array<float,2>{0.140566051f, 0.112035148f},
-std::array<float,2>{0.543108284f, 0.844849765f},
-std::array<float,2>{0.696039081f, 0.140680075f},
-std::array<float,2>{0.00632748473f, 0.948382556f},
-std::array<float,2>{0.314208984f, 0.374916315f},
-std::array<float,2>{0.828277111f, 0.51799494f},
-std::array<float,2>{0.761230469f, 0.0394050106f},
-std::array<float,2>{0.30761981f, 0.768948853f},
-std::array<float,2>{0.108500831f, 0.412989855f},
-std::array<float,2>{0.657670498f, 0.749481261f},
-std::array<float,2>{0.563601136f, 0.288167655f},
-std::array<float,2>{0.248916239f, 0.572151661f},
-std::array<float,2>{0.440151721f, 0.205370545f},
-std::array<float,2>{0.992767632f, 0.885291398f},
-std::array<float,2>{0.782176733f, 0.436751485f},
-std::array<float,2>{0.264484197f, 0.732098579f},
-std::array<float,2>{0.0845836177f, 0.0489169583f},
-std::array<float,2>{0.651181996f, 0.764737487f},
-std::array<float,2>{0.598415971f, 0.19385238f},
-std::array<float,2>{0.207319349f, 0.898141086f},
-std::array<float,2>{0.471327394f, 0.299106628f},
-std::array<float,2>{0.957766533f, 0.586023033f},
-std::array<float,2>{0.918592811f, 0.1018833f},
-std::array<float,2>{0.419626951f, 0.860680103f},
-std::array<float,2>{0.168406561f, 0.444822103f},
-std::array<float,2>{0.529211164f, 0.635421932f},
-std::array<float,2>{0.74979341f, 0.358633816f},
-std::array<float,2>{0.062381316f, 0.507414699f},
-std::array<float,2>{0.366765022f, 0.130641282f},
-std::array<float,2>{0.85509336f, 0.956446946f},
-std::array<float,2>{0.979235351f, 0.277113736f},
-std::array<float,2>{0.464825749f, 0.61708039f},
-std::array<float,2>{0.229957417f, 0.238769934f},
-std::array<float,2>{0.585356712f, 0.918645024f},
-std::array<float,2>{0.67556113f, 0.0171588734f},
-std::array<float,2>{0.122322008f, 0.808285475f},
-std::array<float,2>{0.281930238f, 0.403869599f},
-std::array<float,2>{0.778073072f, 0.696672142f},
-std::array<float,2>{0.81792599f, 0.174439833f},
-std::array<float,2>{0.332788974f, 0.997217059f},
-std::array<float,2>{0.02599556f, 0.313000798f},
-std::array<float,2>{0.7159127f, 0.553340018f},
-std::array<float,2>{0.549273193f, 0.477853984f},
-std::array<float,2>{0.152341291f, 0.678960502f},
-std::array<float,2>{0.401550233f, 0.0834050551f},
-std::array<float,2>{0.889258623f, 0.842555344f},
-std::array<float,2>{0.765450418f, 0.321816385f},
-std::array<float,2>{0.309981227f, 0.561304688f},
-std::array<float,2>{0.104609475f, 0.186528772f},
-std::array<float,2>{0.660816014f, 0.989463389f},
-std::array<float,2>{0.568738401f, 0.0921548232f},
-std::array<float,2>{0.243990973f, 0.834290624f},
-std::array<float,2>{0.443749934f, 0.475100696f},
-std::array<float,2>{0.999600708f, 0.680296063f},
-std::array<float,2>{0.90509516f, 0.24764432f},
-std::array<float,2>{0.385816813f, 0.909899116f},
-std::array<float,2>{0.135148689f, 0.266627282f},
-std::array<float,2>{0.539917946f, 0.621121585f},
-std::array<float,2>{0.699750483f, 0.391060978f},
-std::array<float,2>{0.000253071048f, 0.691472888f},
-std::array<float,2>{0.319174498f, 0.0265999306f},
-std::array<float,2>{0.834199727f, 0.802452862f},
-std::array<float,2>{0.947625577f, 0.450274497f},
-std::array<float,2>{0.488118976f, 0.626404643f},
-std::array<float,2>{0.199533209f, 0.0962021276f},
-std::array<float,2>{0.623354077f, 0.870409608f},
-std::array<float,2>{0.631404519f, 0.133460805f},
-std::array<float,2>{0.0706175864f, 0.962920606f},
-std::array<float,2>{0.280777633f, 0.345533371f},
-std::array<float,2>{0.803124428f, 0.510443568f},
-std::array<float,2>{0.864485562f, 0.0582451932f},
-std::array<float,2>{0.358866304f, 0.756924152f},
-std::array<float,2>{0.0392358601f, 0.424804866f},
-std::array<float,2>{0.725511372f, 0.721509695f},
-std::array<float,2>{0.508472145f, 0.308631897f},
-std::array<float,2>{0.175400406f, 0.579559505f},
-std::array<float,2>{0.435382813f, 0.199598655f},
-std::array<float,2>{0.937168598f, 0.902470112f},
-std::array<float,2>{0.81607759f, 0.416801244f},
-std::array<float,2>{0.331852645f, 0.736537695f},
-std::array<float,2>{0.0292273648f, 0.0350832604f},
-std::array<float,2>{0.714062989f, 0.775051057f},
-std::array<float,2>{0.553717434f, 0.21698904f},
-std::array<float,2>{0.154928505f, 0.881635308f},
-std::array<float,2>{0.405421048f, 0.295993447f},
-std::array<float,2>{0.886299849f, 0.563262284f},
-std::array<float,2>{0.980819821f, 0.120668173f},
-std::array<float,2>{0.465325862f, 0.852232695f},
-std::array<float,2>{0.233078167f, 0.460033029f},
-std::array<float,2>{0.581603587f, 0.646680295f},
-std::array<float,2>{0.679015636f, 0.361187398f},
-std::array<float,2>{0.119500406f, 0.528162003f},
-std::array<float,2>{0.285600662f, 0.154528782f},
-std::array<float,2>{0.775303721f, 0.945213675f},
-std::array<float,2>{0.914489329f, 0.263748437f},
-std::array<float,2>{0.415940374f, 0.60713762f},
-std::array<float,2>{0.167342305f, 0.219137281f},
-std::array<float,2>{0.526336491f, 0.923784018f},
-std::array<float,2>{0.74267894f, 0.00464396924f},
-std::array<float,2>{0.055588305f, 0.787501276f},
-std::array<float,2>{0.362339497f, 0.376171201f},
-std::array<float,2>{0.857654154f, 0.704125881f},
-std::array<float,2>{0.785671473f, 0.170701951f},
-std::array<float,2>{0.258854836f, 0.982335985f},
-std::array<float,2>{0.0793147981f, 0.338880599f},
-std::array<float,2>{0.653304517f, 0.531607091f},
-std::array<float,2>{0.594940841f, 0.496612638f},
-std::array<float,2>{0.204105109f, 0.661923289f},
-std::array<float,2>{0.476100177f, 0.0753914863f},
-std::array<float,2>{0.956464827f, 0.819841623f},
-std::array<float,2>{0.844312429f, 0.282552361f},
-std::array<float,2>{0.368496478f, 0.575805366f},
-std::array<float,2>{0.0482211113f, 0.207981378f},
-std::array<float,2>{0.734704196f, 0.888021469f},
-std::array<float,2>{0.515727758f, 0.0467481166f},
-std::array<float,2>{0.161849946f, 0.771518767f},
-std::array<float,2>{0.411406249f, 0.409967512f},
-std::array<float,2>{0.909543812f, 0.743892968f},
-std::array<float,2>{0.961039186f, 0.145454556f},
-std::array<float,2>{0.47837168f, 0.951123774f},
-std::array<float,2>{0.213894457f, 0.37084347f},
-std::array<float,2>{0.605063856f, 0.522853911f},
-std::array<float,2>{0.641617715f, 0.462385386f},
-std::array<float,2>{0.0876448378f, 0.654251277f},
-std::array<float,2>{0.25153318f, 0.117135905f},
-std::array<float,2>{0.789375603f, 0.849630594f},
-std::array<float,2>{0.87788856f, 0.387992889f},
-std::array<float,2>{0.396531254f, 0.715674341f},
-std::array<float,2>{0.146449566f, 0.0106463218f},
-std::array<float,2>{0.556042433f, 0.789880097f},
-std::array<float,2>{0.709836245f, 0.227906764f},
-std::array<float,2>{0.0212221257f, 0.934906125f},
-std::array<float,2>{0.339511067f, 0.257634431f},
-std::array<float,2>{0.821925461f, 0.597103417f},
-std::array<float,2>{0.768909454f, 0.0658793226f},
-std::array<float,2>{0.290575594f, 0.820371926f},
-std::array<float,2>{0.110911384f, 0.490465254f},
-std::array<float,2>{0.680603981f, 0.666160285f},
-std::array<float,2>{0.593674898f, 0.328362525f},
-std::array<float,2>{0.224911034f, 0.544009387f},
-std::array<float,2>{0.456736803f, 0.159134388f},
-std::array<float,2>{0.972783744f, 0.971063197f},
-std::array<float,2>{0.807067454f, 0.484239668f},
-std::array<float,2>{0.268663168f, 0.675547719f},
-std::array<float,2>{0.0665669963f, 0.0815416276f},
-std::array<float,2>{0.634813607f, 0.837901354f},
-std::array<float,2>{0.613222063f, 0.178748623f},
-std::array<float,2>{0.19483915f, 0.992710948f},
-std::array<float,2>{0.499652565f, 0.318796933f},
-std::array<float,2>{0.94037807f, 0.547344863f},
-std::array<float,2>{0.924929082f, 0.0200721007f},
-std::array<float,2>{0.42485553f, 0.812060654f},
-std::array<float,2>{0.184277877f, 0.402078032f},
-std::array<float,2>{0.501443386f, 0.701654971f},
-std::array<float,2>{0.730345845f, 0.280027419f},
-std::array<float,2>{0.0335273072f, 0.610154092f},
-std::array<float,2>{0.346372694f, 0.234690756f},
-std::array<float,2>{0.867300034f, 0.914211929f},
-std::array<float,2>{0.99141556f, 0.351679474f},
-std::array<float,2>{0.449537247f, 0.503066003f},
-std::array<float,2>{0.240513459f, 0.127149895f},
-std::array<float,2>{0.57597369f, 0.958498418f},
-std::array<float,2>{0.667945862f, 0.107968308f},
-std::array<float,2>{0.093770884f, 0.86433059f},
-std::array<float,2>{0.303934246f, 0.437543511f},
-std::array<float,2>{0.757292032f, 0.637640774f},
-std::array<float,2>{0.842617989f, 0.188840032f},
-std::array<float,2>{0.323090464f, 0.8932693f},
-std::array<float,2>{0.0127852987f, 0.302408069f},
-std::array<float,2>{0.69262439f, 0.590524435f},
-std::array<float,2>{0.537206471f, 0.431897491f},
-std::array<float,2>{0.13203986f, 0.729421318f},
-std::array<float,2>{0.376636535f, 0.0533728413f},
-std::array<float,2>{0.894219756f, 0.76075381f},
-std::array<float,2>{0.793523729f, 0.273264349f},
-std::array<float,2>{0.255169272f, 0.618544817f},
-std::array<float,2>{0.0916908756f, 0.242533892f},
-std::array<float,2>{0.64719677f, 0.912393987f},
-std::array<float,2>{0.605534136f, 0.0283867642f},
-std::array<float,2>{0.217306986f, 0.798495889f},
-std::array<float,2>{0.483922243f, 0.39729923f},
-std::array<float,2>{0.967726827f, 0.68859148f},
-std::array<float,2>{0.913743138f, 0.180247396f},
-std::array<float,2>{0.406879276f, 0.987632394f},
-std::array<float,2>{0.157302991f, 0.327755034f},
-std::array<float,2>{0.521916687f, 0.556767404f},
-std::array<float,2>{0.74186182f, 0.469527781f},
-std::array<float,2>{0.0536059104f, 0.683707893f},
-std::array<float,2>{0.373545408f, 0.0876122788f},
-std::array<float,2>{0.849725187f, 0.828458428f},
-std::array<float,2>{0.969509244f, 0.427985698f},
-std::array<float,2>{0.460235745f, 0.72573036f},
-std::array<float,2>{0.221377313f, 0.0608296879f},
-std::array<float,2>{0.588097811f, 0.752705991f},
-std::array<float,2>{0.683757842f, 0.198502347f},
-std::array<float,2>{0.113775752f, 0.898993254f},
-std::array<float,2>{0.296060234f, 0.306902051f},
-std::array<float,2>{0.770596564f, 0.582532644f},
-std::array<float,2>{0.825698972f, 0.0994839668f},
-std::array<float,2>{0.340383142f, 0.871138036f},
-std::array<float,2>{0.0186456665f, 0.447467983f},
-std::array<float,2>{0.705683768f, 0.632202983f},
-std::array<float,2>{0.56169349f, 0.351527721f},
-std::array<float,2>{0.141319409f, 0.512452722f},
-std::array<float,2>{0.390782535f, 0.140304089f},
-std::array<float,2>{0.879200399f, 0.968018651f},
-std::array<float,2>{0.873229682f, 0.454386771f},
-std::array<float,2>{0.350420713f, 0.642035723f},
-std::array<float,2>{0.0382020846f, 0.12486621f},
-std::array<float,2>{0.734019995f, 0.855594397f},
-std::array<float,2>{0.506605029f, 0.149545982f},
-std::array<float,2>{0.182390913f, 0.939888477f},
-std::array<float,2>{0.428369939f, 0.364070833f},
-std::array<float,2>{0.927443147f, 0.525721252f},
-std::array<float,2>{0.943609655f, 0.037324246f},
-std::array<float,2>{0.495415002f, 0.779005945f},
-std::array<float,2>{0.188491374f, 0.418232828f},
-std::array<float,2>{0.616088748f, 0.7410025f},
-std::array<float,2>{0.639895201f, 0.289160699f},
-std::array<float,2>{0.0637176931f, 0.569312811f},
-std::array<float,2>{0.271511972f, 0.21190156f},
-std::array<float,2>{0.811237335f, 0.876511931f},
-std::array<float,2>{0.894833922f, 0.343392581f},
-std::array<float,2>{0.380768627f, 0.536335289f},
-std::array<float,2>{0.12789312f, 0.164728269f},
-std::array<float,2>{0.53126359f, 0.980075479f},
-std::array<float,2>{0.691145301f, 0.0713102743f},
-std::array<float,2>{0.00992155541f, 0.814330757f},
-std::array<float,2>{0.325428814f, 0.492583632f},
-std::array<float,2>{0.839452326f, 0.65660125f},
-std::array<float,2>{0.751133382f, 0.222838953f},
-std::array<float,2>{0.299315661f, 0.928642333f},
-std::array<float,2>{0.098178938f, 0.259875208f},
-std::array<float,2>{0.668328583f, 0.601869166f},
-std::array<float,2>{0.571581185f, 0.380522847f},
-std::array<float,2>{0.23454313f, 0.707103074f},
-std::array<float,2>{0.446174502f, 0.00181489496f},
-std::array<float,2>{0.987246394f, 0.783668578f},
-std::array<float,2>{0.830765247f, 0.372436792f},
-std::array<float,2>{0.315791041f, 0.516321599f},
-std::array<float,2>{0.0055630235f, 0.142955974f},
-std::array<float,2>{0.698705971f, 0.946737528f},
-std::array<float,2>{0.545462489f, 0.111241445f},
-std::array<float,2>{0.138052121f, 0.846791625f},
-std::array<float,2>{0.387813926f, 0.465117961f},
-std::array<float,2>{0.900084198f, 0.650004029f},
-std::array<float,2>{0.995901465f, 0.204872876f},
-std::array<float,2>{0.437607139f, 0.883187652f},
-std::array<float,2>{0.247405708f, 0.285347641f},
-std::array<float,2>{0.566112995f, 0.573473155f},
-std::array<float,2>{0.659437597f, 0.410869002f},
-std::array<float,2>{0.105823964f, 0.746986389f},
-std::array<float,2>{0.306204319f, 0.0412285998f},
-std::array<float,2>{0.758161545f, 0.766460419f},
-std::array<float,2>{0.932055652f, 0.485282063f},
-std::array<float,2>{0.433406711f, 0.669914067f},
-std::array<float,2>{0.178255707f, 0.0682204738f},
-std::array<float,2>{0.513601542f, 0.825060546f},
-std::array<float,2>{0.719759405f, 0.161197007f},
-std::array<float,2>{0.0432853773f, 0.973550141f},
-std::array<float,2>{0.355397046f, 0.335811317f},
-std::array<float,2>{0.862639487f, 0.539605558f},
-std::array<float,2>{0.798671782f, 0.0142863598f},
-std::array<float,2>{0.274609268f, 0.793568909f},
-std::array<float,2>{0.0743260831f, 0.386623859f},
-std::array<float,2>{0.626411676f, 0.711349964f},
-std::array<float,2>{0.618474424f, 0.251456708f},
-std::array<float,2>{0.197069615f, 0.598919034f},
-std::array<float,2>{0.490057468f, 0.230603859f},
-std::array<float,2>{0.952668786f, 0.933087826f},
-std::array<float,2>{0.780284643f, 0.406078815f},
-std::array<float,2>{0.284196109f, 0.697704554f},
-std::array<float,2>{0.123911761f, 0.0188437682f},
-std::array<float,2>{0.673339844f, 0.805613399f},
-std::array<float,2>{0.58249563f, 0.240335539f},
-std::array<float,2>{0.228259847f, 0.920859993f},
-std::array<float,2>{0.462241143f, 0.27406776f},
-std::array<float,2>{0.977840662f, 0.614694595f},
-std::array<float,2>{0.887806058f, 0.0853266865f},
-std::array<float,2>{0.399440378f, 0.841077864f},
-std::array<float,2>{0.148726374f, 0.478595048f},
-std::array<float,2>{0.547520459f, 0.677396894f},
-std::array<float,2>{0.716829717f, 0.316064924f},
-std::array<float,2>{0.0253726952f, 0.552484989f},
-std::array<float,2>{0.335344464f, 0.172723144f},
-std::array<float,2>{0.820298731f, 0.999974906f},
-std::array<float,2>{0.959682822f, 0.297703981f},
-std::array<float,2>{0.469088465f, 0.588812351f},
-std::array<float,2>{0.209879965f, 0.192964479f},
-std::array<float,2>{0.599954605f, 0.896444857f},
-std::array<float,2>{0.649217427f, 0.0472620875f},
-std::array<float,2>{0.0823036507f, 0.761922538f},
-std::array<float,2>{0.261789292f, 0.434934437f},
-std::array<float,2>{0.784572244f, 0.733641446f},
-std::array<float,2>{0.851862848f, 0.132177606f},
-std::array<float,2>{0.364788026f, 0.953191757f},
-std::array<float,2>{0.0586683713f, 0.356150955f},
-std::array<float,2>{0.747154236f, 0.504692376f},
-std::array<float,2>{0.531248868f, 0.441895902f},
-std::array<float,2>{0.170371875f, 0.63346076f},
-std::array<float,2>{0.420311183f, 0.104451351f},
-std::array<float,2>{0.921079397f, 0.862015963f},
-std::array<float,2>{0.774286509f, 0.361753792f},
-std::array<float,2>{0.286395162f, 0.530133486f},
-std::array<float,2>{0.120520376f, 0.154164389f},
-std::array<float,2>{0.678503573f, 0.941725194f},
-std::array<float,2>{0.581013143f, 0.118002184f},
-std::array<float,2>{0.233541653f, 0.853672981f},
-std::array<float,2>{0.466035306f, 0.458054304f},
-std::array<float,2>{0.981751382f, 0.6456936f},
-std::array<float,2>{0.884798169f, 0.216577455f},
-std::array<float,2>{0.404762626f, 0.880429506f},
-std::array<float,2>{0.15546529f, 0.293280363f},
-std::array<float,2>{0.55320251f, 0.566375732f},
-std::array<float,2>{0.713416159f, 0.415598452f},
-std::array<float,2>{0.027472645f, 0.735936642f},
-std::array<float,2>{0.330791295f, 0.0322938822f},
-std::array<float,2>{0.815058291f, 0.775544107f},
-std::array<float,2>{0.955087483f, 0.499955833f},
-std::array<float,2>{0.474796414f, 0.663359284f},
-std::array<float,2>{0.203694746f, 0.0765428171f},
-std::array<float,2>{0.594460785f, 0.816892743f},
-std::array<float,2>{0.654286861f, 0.168072164f},
-std::array<float,2>{0.0786289573f, 0.983420312f},
-std::array<float,2>{0.258292884f, 0.336601228f},
-std::array<float,2>{0.786204875f, 0.534840703f},
-std::array<float,2>{0.858665168f, 0.0077129039f},
-std::array<float,2>{0.361456037f, 0.786238909f},
-std::array<float,2>{0.0564300157f, 0.378056318f},
-std::array<float,2>{0.743181467f, 0.705734432f},
-std::array<float,2>{0.526967525f, 0.262209356f},
-std::array<float,2>{0.166923165f, 0.608197987f},
-std::array<float,2>{0.414894968f, 0.221888334f},
-std::array<float,2>{0.915062189f, 0.925456464f},
-std::array<float,2>{0.835511565f, 0.392615288f},
-std::array<float,2>{0.320103586f, 0.69355768f},
-std::array<float,2>{0.00108773669f, 0.0243503898f},
-std::array<float,2>{0.701139867f, 0.804036379f},
-std::array<float,2>{0.540107608f, 0.248233154f},
-std::array<float,2>{0.136182442f, 0.9064852f},
-std::array<float,2>{0.38501206f, 0.267675191f},
-std::array<float,2>{0.906148612f, 0.62307924f},
-std::array<float,2>{0.998864591f, 0.0908750966f},
-std::array<float,2>{0.444988459f, 0.832570016f},
-std::array<float,2>{0.242963389f, 0.473817736f},
-std::array<float,2>{0.569930315f, 0.681722879f},
-std::array<float,2>{0.661708891f, 0.322535515f},
-std::array<float,2>{0.104236946f, 0.559627533f},
-std::array<float,2>{0.30956167f, 0.185053989f},
-std::array<float,2>{0.763771594f, 0.991816938f},
-std::array<float,2>{0.93644309f, 0.312082291f},
-std::array<float,2>{0.433986336f, 0.581082284f},
-std::array<float,2>{0.174696967f, 0.202475891f},
-std::array<float,2>{0.509249091f, 0.904690921f},
-std::array<float,2>{0.725672483f, 0.0561484359f},
-std::array<float,2>{0.0402712524f, 0.75448668f},
-std::array<float,2>{0.357816249f, 0.422227144f},
-std::array<float,2>{0.863373935f, 0.719481051f},
-std::array<float,2>{0.804260731f, 0.135928541f},
-std::array<float,2>{0.27950412f, 0.961149931f},
-std::array<float,2>{0.0719478428f, 0.3465693f},
-std::array<float,2>{0.632553935f, 0.50810051f},
-std::array<float,2>{0.62411654f, 0.45292747f},
-std::array<float,2>{0.200889647f, 0.628482878f},
-std::array<float,2>{0.48675096f, 0.0940454453f},
-std::array<float,2>{0.948713422f, 0.867755175f},
-std::array<float,2>{0.869031668f, 0.277838022f},
-std::array<float,2>{0.347527921f, 0.611996293f},
-std::array<float,2>{0.0343497805f, 0.237748221f},
-std::array<float,2>{0.729070663f, 0.917857766f},
-std::array<float,2>{0.500606f, 0.0216522086f},
-std::array<float,2>{0.184660941f, 0.809525788f},
-std::array<float,2>{0.424741745f, 0.399968654f},
-std::array<float,2>{0.924607694f, 0.7010445f},
-std::array<float,2>{0.941288769f, 0.177025303f},
-std::array<float,2>{0.498719543f, 0.994611323f},
-std::array<float,2>{0.193388656f, 0.317233473f},
-std::array<float,2>{0.612089753f, 0.550101697f},
-std::array<float,2>{0.636680841f, 0.48081097f},
-std::array<float,2>{0.0677150786f, 0.672964692f},
-std::array<float,2>{0.267831385f, 0.0794876218f},
-std::array<float,2>{0.808201373f, 0.837017894f},
-std::array<float,2>{0.892695844f, 0.430712402f},
-std::array<float,2>{0.375674874f, 0.728162706f},
-std::array<float,2>{0.130980358f, 0.0520864353f},
-std::array<float,2>{0.538098991f, 0.758382082f},
-std::array<float,2>{0.691799939f, 0.189838171f},
-std::array<float,2>{0.0122928601f, 0.892252207f},
-std::array<float,2>{0.323772013f, 0.304179549f},
-std::array<float,2>{0.843323112f, 0.593316853f},
-std::array<float,2>{0.756165683f, 0.106636688f},
-std::array<float,2>{0.303394377f, 0.865600586f},
-std::array<float,2>{0.0955013633f, 0.441340387f},
-std::array<float,2>{0.666658521f, 0.640067756f},
-std::array<float,2>{0.574642718f, 0.355270475f},
-std::array<float,2>{0.241433531f, 0.501321793f},
-std::array<float,2>{0.450274229f, 0.125939146f},
-std::array<float,2>{0.990817547f, 0.960074306f},
-std::array<float,2>{0.790315151f, 0.463697553f},
-std::array<float,2>{0.25089097f, 0.654629588f},
-std::array<float,2>{0.0867188349f, 0.11350669f},
-std::array<float,2>{0.641406f, 0.849425495f},
-std::array<float,2>{0.603720725f, 0.148240194f},
-std::array<float,2>{0.213808909f, 0.952430964f},
-std::array<float,2>{0.476941407f, 0.367698103f},
-std::array<float,2>{0.962634504f, 0.519544899f},
-std::array<float,2>{0.908817768f, 0.0446046405f},
-std::array<float,2>{0.410563529f, 0.770552993f},
-std::array<float,2>{0.160519108f, 0.407384902f},
-std::array<float,2>{0.517032862f, 0.744141996f},
-std::array<float,2>{0.735971332f, 0.283441931f},
-std::array<float,2>{0.0470630676f, 0.576780975f},
-std::array<float,2>{0.367620856f, 0.209344447f},
-std::array<float,2>{0.845408678f, 0.89059031f},
-std::array<float,2>{0.974543393f, 0.330158681f},
-std::array<float,2>{0.455649942f, 0.545877635f},
-std::array<float,2>{0.225906193f, 0.157062605f},
-std::array<float,2>{0.592596471f, 0.969629943f},
-std::array<float,2>{0.681315958f, 0.0626182109f},
-std::array<float,2>{0.110221192f, 0.823999465f},
-std::array<float,2>{0.289952844f, 0.488936424f},
-std::array<float,2>{0.767683566f, 0.665278435f},
-std::array<float,2>{0.820931196f, 0.230392098f},
-std::array<float,2>{0.338661015f, 0.935803473f},
-std::array<float,2>{0.0200226419f, 0.255450815f},
-std::array<float,2>{0.710186601f, 0.595305741f},
-std::array<float,2>{0.555451453f, 0.389387965f},
-std::array<float,2>{0.144958273f, 0.717688382f},
-std::array<float,2>{0.397790313f, 0.00847896934f},
-std::array<float,2>{0.87838465f, 0.791280448f},
-std::array<float,2>{0.811938405f, 0.29269889f},
-std::array<float,2>{0.272717565f, 0.567379594f},
-std::array<float,2>{0.0626555383f, 0.213577539f},
-std::array<float,2>{0.638759196f, 0.877612293f},
-std::array<float,2>{0.61705488f, 0.0360459462f},
-std::array<float,2>{0.188332751f, 0.780440092f},
-std::array<float,2>{0.494442612f, 0.421547383f},
-std::array<float,2>{0.944830954f, 0.739049256f},
-std::array<float,2>{0.926481426f, 0.150407195f},
-std::array<float,2>{0.429316938f, 0.937813759f},
-std::array<float,2>{0.183407515f, 0.366547108f},
-std::array<float,2>{0.506918728f, 0.525157273f},
-std::array<float,2>{0.733237565f, 0.455492169f},
-std::array<float,2>{0.0380246118f, 0.64325422f},
-std::array<float,2>{0.35136196f, 0.122148931f},
-std::array<float,2>{0.874650598f, 0.858810604f},
-std::array<float,2>{0.98766011f, 0.381906331f},
-std::array<float,2>{0.446666598f, 0.710343838f},
-std::array<float,2>{0.235745713f, 0.00347770704f},
-std::array<float,2>{0.570370615f, 0.781735301f},
-std::array<float,2>{0.669304788f, 0.226487339f},
-std::array<float,2>{0.0991400927f, 0.927089751f},
-std::array<float,2>{0.29982686f, 0.258643895f},
-std::array<float,2>{0.750463784f, 0.603766501f},
-std::array<float,2>{0.838015437f, 0.072994031f},
-std::array<float,2>{0.324361652f, 0.816066861f},
-std::array<float,2>{0.0114084454f, 0.494400471f},
-std::array<float,2>{0.689460039f, 0.6589908f},
-std::array<float,2>{0.533167362f, 0.341695309f},
-std::array<float,2>{0.128374785f, 0.537898421f},
-std::array<float,2>{0.379236668f, 0.166852742f},
-std::array<float,2>{0.896061301f, 0.978417099f},
-std::array<float,2>{0.851495206f, 0.472052157f},
-std::array<float,2>{0.374064356f, 0.686146379f},
-std::array<float,2>{0.0538886264f, 0.0892757252f},
-std::array<float,2>{0.740663826f, 0.830961168f},
-std::array<float,2>{0.522851288f, 0.183429748f},
-std::array<float,2>{0.156782776f, 0.984968424f},
-std::array<float,2>{0.407707334f, 0.32506606f},
-std::array<float,2>{0.912941754f, 0.555911601f},
-std::array<float,2>{0.968248427f, 0.0297899116f},
-std::array<float,2>{0.482552737f, 0.799964547f},
-std::array<float,2>{0.218575865f, 0.395085663f},
-std::array<float,2>{0.606472611f, 0.691090763f},
-std::array<float,2>{0.648320854f, 0.270472378f},
-std::array<float,2>{0.0903713927f, 0.620454967f},
-std::array<float,2>{0.254087836f, 0.245930955f},
-std::array<float,2>{0.794303298f, 0.912003279f},
-std::array<float,2>{0.880481362f, 0.347878754f},
-std::array<float,2>{0.391760319f, 0.515077591f},
-std::array<float,2>{0.14162536f, 0.136847064f},
-std::array<float,2>{0.561368167f, 0.96661818f},
-std::array<float,2>{0.706380486f, 0.100780353f},
-std::array<float,2>{0.0185212921f, 0.873997152f},
-std::array<float,2>{0.341653764f, 0.446596235f},
-std::array<float,2>{0.824324489f, 0.629655123f},
-std::array<float,2>{0.770504892f, 0.195452958f},
-std::array<float,2>{0.295103073f, 0.901776075f},
-std::array<float,2>{0.11447005f, 0.304874003f},
-std::array<float,2>{0.68548888f, 0.585197926f},
-std::array<float,2>{0.589338481f, 0.426300466f},
-std::array<float,2>{0.222159505f, 0.72380203f},
-std::array<float,2>{0.45911184f, 0.0596524477f},
-std::array<float,2>{0.96990943f, 0.750550568f},
-std::array<float,2>{0.818490386f, 0.313738704f},
-std::array<float,2>{0.334227026f, 0.553877175f},
-std::array<float,2>{0.0234881137f, 0.175261065f},
-std::array<float,2>{0.718189657f, 0.996776462f},
-std::array<float,2>{0.548434675f, 0.0826392844f},
-std::array<float,2>{0.15007855f, 0.843459368f},
-std::array<float,2>{0.398687571f, 0.477276236f},
-std::array<float,2>{0.887315214f, 0.678657532f},
-std::array<float,2>{0.976956606f, 0.240068838f},
-std::array<float,2>{0.461194247f, 0.919687033f},
-std::array<float,2>{0.226783305f, 0.275766671f},
-std::array<float,2>{0.583200574f, 0.615372539f},
-std::array<float,2>{0.671990216f, 0.402400881f},
-std::array<float,2>{0.124403998f, 0.695820391f},
-std::array<float,2>{0.283356577f, 0.0157774296f},
-std::array<float,2>{0.780000567f, 0.807285428f},
-std::array<float,2>{0.920820892f, 0.4438034f},
-std::array<float,2>{0.421272278f, 0.636476219f},
-std::array<float,2>{0.171550781f, 0.10296753f},
-std::array<float,2>{0.529616833f, 0.859606385f},
-std::array<float,2>{0.74660027f, 0.129816025f},
-std::array<float,2>{0.0602107197f, 0.955366492f},
-std::array<float,2>{0.363739669f, 0.358176678f},
-std::array<float,2>{0.853244305f, 0.506393671f},
-std::array<float,2>{0.783390939f, 0.0502641946f},
-std::array<float,2>{0.263264537f, 0.764199197f},
-std::array<float,2>{0.0832836255f, 0.435633063f},
-std::array<float,2>{0.649675071f, 0.731189072f},
-std::array<float,2>{0.600640118f, 0.300410241f},
-std::array<float,2>{0.210920051f, 0.587350368f},
-std::array<float,2>{0.470611781f, 0.194404647f},
-std::array<float,2>{0.960857153f, 0.896916687f},
-std::array<float,2>{0.758943319f, 0.413778126f},
-std::array<float,2>{0.304729342f, 0.748541117f},
-std::array<float,2>{0.107086405f, 0.0400745571f},
-std::array<float,2>{0.658520281f, 0.76803869f},
-std::array<float,2>{0.56460762f, 0.206771374f},
-std::array<float,2>{0.246827155f, 0.886292815f},
-std::array<float,2>{0.439068466f, 0.28725794f},
-std::array<float,2>{0.994404018f, 0.570434809f},
-std::array<float,2>{0.89910692f, 0.113122627f},
-std::array<float,2>{0.386959344f, 0.844474435f},
-std::array<float,2>{0.137582064f, 0.467085928f},
-std::array<float,2>{0.54682821f, 0.651997685f},
-std::array<float,2>{0.697619498f, 0.373206675f},
-std::array<float,2>{0.00436012447f, 0.518829823f},
-std::array<float,2>{0.314583689f, 0.14231649f},
-std::array<float,2>{0.831475854f, 0.947625637f},
-std::array<float,2>{0.952060282f, 0.252173096f},
-std::array<float,2>{0.489254117f, 0.59980762f},
-std::array<float,2>{0.196216777f, 0.233059332f},
-std::array<float,2>{0.617722094f, 0.930211425f},
-std::array<float,2>{0.625137746f, 0.0120913312f},
-std::array<float,2>{0.0752310157f, 0.796846747f},
-std::array<float,2>{0.273899227f, 0.383919686f},
-std::array<float,2>{0.797339916f, 0.71415174f},
-std::array<float,2>{0.86165005f, 0.163857356f},
-std::array<float,2>{0.353571922f, 0.975294948f},
-std::array<float,2>{0.0447062775f, 0.332942486f},
-std::array<float,2>{0.719303191f, 0.541675806f},
-std::array<float,2>{0.512106419f, 0.487383544f},
-std::array<float,2>{0.179101959f, 0.670112431f},
-std::array<float,2>{0.431677699f, 0.0687929168f},
-std::array<float,2>{0.932897329f, 0.826696098f},
-std::array<float,2>{0.787570059f, 0.338416666f},
-std::array<float,2>{0.260608912f, 0.53255266f},
-std::array<float,2>{0.0809159279f, 0.171107411f},
-std::array<float,2>{0.655894697f, 0.980542243f},
-std::array<float,2>{0.596466064f, 0.0744813308f},
-std::array<float,2>{0.205781862f, 0.81920743f},
-std::array<float,2>{0.474111766f, 0.497257441f},
-std::array<float,2>{0.954429328f, 0.660962582f},
-std::array<float,2>{0.917471766f, 0.220526531f},
-std::array<float,2>{0.417774439f, 0.922135651f},
-std::array<float,2>{0.166005895f, 0.264913648f},
-std::array<float,2>{0.52416414f, 0.606159985f},
-std::array<float,2>{0.744450629f, 0.375885248f},
-std::array<float,2>{0.0580966808f, 0.703602195f},
-std::array<float,2>{0.35965243f, 0.00538589386f},
-std::array<float,2>{0.85547632f, 0.788305044f},
-std::array<float,2>{0.98325634f, 0.459593624f},
-std::array<float,2>{0.468116224f, 0.648403347f},
-std::array<float,2>{0.232380226f, 0.119842187f},
-std::array<float,2>{0.579565644f, 0.852901697f},
-std::array<float,2>{0.677424908f, 0.155935794f},
-std::array<float,2>{0.117984846f, 0.943726778f},
-std::array<float,2>{0.28848353f, 0.359639466f},
-std::array<float,2>{0.776799619f, 0.528362215f},
-std::array<float,2>{0.814439237f, 0.0333539359f},
-std::array<float,2>{0.328373432f, 0.773693144f},
-std::array<float,2>{0.0294316858f, 0.417112887f},
-std::array<float,2>{0.712445796f, 0.737685442f},
-std::array<float,2>{0.552163303f, 0.295520425f},
-std::array<float,2>{0.153716475f, 0.564066589f},
-std::array<float,2>{0.402446866f, 0.218671903f},
-std::array<float,2>{0.884181201f, 0.882223964f},
-std::array<float,2>{0.867002904f, 0.424157053f},
-std::array<float,2>{0.356196582f, 0.721983254f},
-std::array<float,2>{0.0428783596f, 0.0570559837f},
-std::array<float,2>{0.72457248f, 0.75621742f},
-std::array<float,2>{0.511280835f, 0.200722337f},
-std::array<float,2>{0.173682138f, 0.903418481f},
-std::array<float,2>{0.43676725f, 0.309824795f},
-std::array<float,2>{0.934882462f, 0.578815341f},
-std::array<float,2>{0.947258949f, 0.0968196839f},
-std::array<float,2>{0.485099703f, 0.869911432f},
-std::array<float,2>{0.202360094f, 0.449799567f},
-std::array<float,2>{0.622331977f, 0.62557584f},
-std::array<float,2>{0.629974365f, 0.343941092f},
-std::array<float,2>{0.0736635327f, 0.511174917f},
-std::array<float,2>{0.277920842f, 0.134605154f},
-std::array<float,2>{0.802652717f, 0.964749515f},
-std::array<float,2>{0.903512537f, 0.266295612f},
-std::array<float,2>{0.384442657f, 0.622225881f},
-std::array<float,2>{0.134586856f, 0.247058332f},
-std::array<float,2>{0.541973174f, 0.908565044f},
-std::array<float,2>{0.702420831f, 0.0259522907f},
-std::array<float,2>{0.00282042008f, 0.801336765f},
-std::array<float,2>{0.318225384f, 0.392576486f},
-std::array<float,2>{0.833717525f, 0.692875683f},
-std::array<float,2>{0.763193846f, 0.186273932f},
-std::array<float,2>{0.312468946f, 0.988911092f},
-std::array<float,2>{0.10189762f, 0.320601553f},
-std::array<float,2>{0.662403762f, 0.562214553f},
-std::array<float,2>{0.566999733f, 0.476053387f},
-std::array<float,2>{0.245344058f, 0.681612194f},
-std::array<float,2>{0.443254381f, 0.093580775f},
-std::array<float,2>{0.99650687f, 0.835286021f},
-std::array<float,2>{0.840677798f, 0.301273704f},
-std::array<float,2>{0.320766181f, 0.590938628f},
-std::array<float,2>{0.0137525592f, 0.188249946f},
-std::array<float,2>{0.695127845f, 0.893952131f},
-std::array<float,2>{0.53702426f, 0.0539685674f},
-std::array<float,2>{0.130079418f, 0.760091484f},
-std::array<float,2>{0.377630174f, 0.433232933f},
-std::array<float,2>{0.891699433f, 0.730325818f},
-std::array<float,2>{0.98897177f, 0.128329545f},
-std::array<float,2>{0.452833563f, 0.957570374f},
-std::array<float,2>{0.238699824f, 0.353475451f},
-std::array<float,2>{0.577123523f, 0.502226472f},
-std::array<float,2>{0.664575875f, 0.438823014f},
-std::array<float,2>{0.095750384f, 0.638651848f},
-std::array<float,2>{0.302082151f, 0.108856395f},
-std::array<float,2>{0.754739583f, 0.863969088f},
-std::array<float,2>{0.923192918f, 0.400445402f},
-std::array<float,2>{0.423398137f, 0.703047037f},
-std::array<float,2>{0.186957881f, 0.0213023778f},
-std::array<float,2>{0.501992106f, 0.811051488f},
-std::array<float,2>{0.727159142f, 0.23577176f},
-std::array<float,2>{0.0319286585f, 0.915614426f},
-std::array<float,2>{0.344079405f, 0.281114846f},
-std::array<float,2>{0.870246589f, 0.610871613f},
-std::array<float,2>{0.805624545f, 0.0804111138f},
-std::array<float,2>{0.26606831f, 0.838887393f},
-std::array<float,2>{0.0692409351f, 0.482626051f},
-std::array<float,2>{0.632821858f, 0.674579024f},
-std::array<float,2>{0.611043394f, 0.319778055f},
-std::array<float,2>{0.193230882f, 0.548295796f},
-std::array<float,2>{0.497805387f, 0.1782621f},
-std::array<float,2>{0.938577175f, 0.993476689f},
-std::array<float,2>{0.766557574f, 0.491482764f},
-std::array<float,2>{0.292098463f, 0.667478085f},
-std::array<float,2>{0.112118371f, 0.0645460263f},
-std::array<float,2>{0.68325001f, 0.821846962f},
-std::array<float,2>{0.590482056f, 0.159295067f},
-std::array<float,2>{0.224089578f, 0.971918583f},
-std::array<float,2>{0.454981744f, 0.329154581f},
-std::array<float,2>{0.974927127f, 0.543644905f},
-std::array<float,2>{0.876932383f, 0.0116827143f},
-std::array<float,2>{0.394612432f, 0.790083587f},
-std::array<float,2>{0.146779761f, 0.386873156f},
-std::array<float,2>{0.556791544f, 0.716435373f},
-std::array<float,2>{0.708684742f, 0.256276965f},
-std::array<float,2>{0.0228403825f, 0.59629786f},
-std::array<float,2>{0.337232292f, 0.22679618f},
-std::array<float,2>{0.822636366f, 0.93447566f},
-std::array<float,2>{0.963061213f, 0.369750589f},
-std::array<float,2>{0.479498267f, 0.52209115f},
-std::array<float,2>{0.211658776f, 0.145615563f},
-std::array<float,2>{0.601793766f, 0.950034678f},
-std::array<float,2>{0.644322395f, 0.115996115f},
-std::array<float,2>{0.0891664773f, 0.851348102f},
-std::array<float,2>{0.252091616f, 0.461029857f},
-std::array<float,2>{0.792564809f, 0.652902842f},
-std::array<float,2>{0.84614563f, 0.20869416f},
-std::array<float,2>{0.369898856f, 0.88737601f},
-std::array<float,2>{0.0495956168f, 0.281480402f},
-std::array<float,2>{0.73819381f, 0.574315667f},
-std::array<float,2>{0.517799795f, 0.40865317f},
-std::array<float,2>{0.162407443f, 0.742393732f},
-std::array<float,2>{0.412282914f, 0.0457695983f},
-std::array<float,2>{0.907799661f, 0.773190022f},
-std::array<float,2>{0.753274322f, 0.261152208f},
-std::array<float,2>{0.297254235f, 0.603253126f},
-std::array<float,2>{0.101075359f, 0.224605367f},
-std::array<float,2>{0.670247555f, 0.929040909f},
-std::array<float,2>{0.57324475f, 0.000223611394f},
-std::array<float,2>{0.237618521f, 0.784882724f},
-std::array<float,2>{0.448915601f, 0.379696637f},
-std::array<float,2>{0.986171007f, 0.708108664f},
-std::array<float,2>{0.89787364f, 0.16553694f},
-std::array<float,2>{0.381649226f, 0.97934413f},
-std::array<float,2>{0.12504375f, 0.342030644f},
-std::array<float,2>{0.53335619f, 0.535999715f},
-std::array<float,2>{0.689033091f, 0.493669778f},
-std::array<float,2>{0.00895855948f, 0.657910407f},
-std::array<float,2>{0.327052891f, 0.0709786713f},
-std::array<float,2>{0.837317109f, 0.813067496f},
-std::array<float,2>{0.94218272f, 0.419575363f},
-std::array<float,2>{0.492740065f, 0.741228223f},
-std::array<float,2>{0.189956084f, 0.039013654f},
-std::array<float,2>{0.613341093f, 0.777464628f},
-std::array<float,2>{0.637279928f, 0.211946413f},
-std::array<float,2>{0.0661309063f, 0.875792682f},
-std::array<float,2>{0.269584298f, 0.290593266f},
-std::array<float,2>{0.810308695f, 0.569796622f},
-std::array<float,2>{0.872252703f, 0.123701267f},
-std::array<float,2>{0.349070489f, 0.856812537f},
-std::array<float,2>{0.0361862145f, 0.453224212f},
-std::array<float,2>{0.731919408f, 0.641047478f},
-std::array<float,2>{0.504539728f, 0.36504221f},
-std::array<float,2>{0.181425616f, 0.527233362f},
-std::array<float,2>{0.427641034f, 0.149150237f},
-std::array<float,2>{0.928744376f, 0.940907538f},
-std::array<float,2>{0.82796073f, 0.448512435f},
-std::array<float,2>{0.342599571f, 0.631721914f},
-std::array<float,2>{0.0168007351f, 0.098097533f},
-std::array<float,2>{0.705011666f, 0.872194529f},
-std::array<float,2>{0.558668137f, 0.139346987f},
-std::array<float,2>{0.143902898f, 0.96754384f},
-std::array<float,2>{0.394367009f, 0.350437403f},
-std::array<float,2>{0.881320059f, 0.51293987f},
-std::array<float,2>{0.971116066f, 0.0615424551f},
-std::array<float,2>{0.458608299f, 0.753318727f},
-std::array<float,2>{0.220318615f, 0.429202914f},
-std::array<float,2>{0.586418569f, 0.72553134f},
-std::array<float,2>{0.687058032f, 0.308523417f},
-std::array<float,2>{0.116044685f, 0.583327889f},
-std::array<float,2>{0.294133037f, 0.197705805f},
-std::array<float,2>{0.772423327f, 0.900047362f},
-std::array<float,2>{0.910877168f, 0.326508611f},
-std::array<float,2>{0.409323782f, 0.558173716f},
-std::array<float,2>{0.158445761f, 0.180708453f},
-std::array<float,2>{0.521182895f, 0.986669004f},
-std::array<float,2>{0.738829553f, 0.0860866532f},
-std::array<float,2>{0.0520872027f, 0.829206169f},
-std::array<float,2>{0.372836381f, 0.470280826f},
-std::array<float,2>{0.848148227f, 0.685229838f},
-std::array<float,2>{0.795716643f, 0.243489623f},
-std::array<float,2>{0.255930036f, 0.913585067f},
-std::array<float,2>{0.0933375657f, 0.272229344f},
-std::array<float,2>{0.645224094f, 0.617961943f},
-std::array<float,2>{0.609175324f, 0.398231864f},
-std::array<float,2>{0.216082692f, 0.688116908f},
-std::array<float,2>{0.481449068f, 0.0283034705f},
-std::array<float,2>{0.965321243f, 0.797665834f},
-std::array<float,2>{0.854019523f, 0.357154071f},
-std::array<float,2>{0.365406185f, 0.505064785f},
-std::array<float,2>{0.0613267273f, 0.13110207f},
-std::array<float,2>{0.748267889f, 0.954461634f},
-std::array<float,2>{0.527892172f, 0.104671188f},
-std::array<float,2>{0.169305399f, 0.863253117f},
-std::array<float,2>{0.418318123f, 0.442468911f},
-std::array<float,2>{0.91939193f, 0.634705603f},
-std::array<float,2>{0.958073199f, 0.191923991f},
-std::array<float,2>{0.472132832f, 0.894812584f},
-std::array<float,2>{0.208243355f, 0.298371047f},
-std::array<float,2>{0.598766148f, 0.589360058f},
-std::array<float,2>{0.651805639f, 0.434034973f},
-std::array<float,2>{0.0858701319f, 0.732589602f},
-std::array<float,2>{0.265181392f, 0.0484928712f},
-std::array<float,2>{0.782262921f, 0.763382196f},
-std::array<float,2>{0.890049636f, 0.480421543f},
-std::array<float,2>{0.400598675f, 0.67617929f},
-std::array<float,2>{0.150589317f, 0.0849466845f},
-std::array<float,2>{0.550685823f, 0.840437233f},
-std::array<float,2>{0.715733111f, 0.173041716f},
-std::array<float,2>{0.0269313138f, 0.998254538f},
-std::array<float,2>{0.333594024f, 0.314460427f},
-std::array<float,2>{0.816760838f, 0.551180482f},
-std::array<float,2>{0.778685451f, 0.018010661f},
-std::array<float,2>{0.282618582f, 0.806437731f},
-std::array<float,2>{0.121234372f, 0.40525654f},
-std::array<float,2>{0.674174786f, 0.69921726f},
-std::array<float,2>{0.58480829f, 0.275098264f},
-std::array<float,2>{0.229402781f, 0.613417387f},
-std::array<float,2>{0.463023067f, 0.24178119f},
-std::array<float,2>{0.980246067f, 0.921708941f},
-std::array<float,2>{0.800046146f, 0.385127991f},
-std::array<float,2>{0.277075857f, 0.712141037f},
-std::array<float,2>{0.0762240663f, 0.0153865702f},
-std::array<float,2>{0.627515554f, 0.794531882f},
-std::array<float,2>{0.620284259f, 0.232299492f},
-std::array<float,2>{0.197352633f, 0.931704581f},
-std::array<float,2>{0.491246164f, 0.250603378f},
-std::array<float,2>{0.949779212f, 0.598366201f},
-std::array<float,2>{0.930246055f, 0.0668065324f},
-std::array<float,2>{0.431408137f, 0.826084018f},
-std::array<float,2>{0.177333802f, 0.485536367f},
-std::array<float,2>{0.51488179f, 0.668005407f},
-std::array<float,2>{0.722588181f, 0.334199101f},
-std::array<float,2>{0.0461175926f, 0.540296972f},
-std::array<float,2>{0.353466928f, 0.160790071f},
-std::array<float,2>{0.859867632f, 0.973987818f},
-std::array<float,2>{0.993746579f, 0.286286384f},
-std::array<float,2>{0.440797925f, 0.573165119f},
-std::array<float,2>{0.24919866f, 0.20320408f},
-std::array<float,2>{0.563006759f, 0.884246886f},
-std::array<float,2>{0.65645808f, 0.0423117317f},
-std::array<float,2>{0.10828305f, 0.767264783f},
-std::array<float,2>{0.307497352f, 0.411888182f},
-std::array<float,2>{0.760451794f, 0.747802734f},
-std::array<float,2>{0.829190969f, 0.143640518f},
-std::array<float,2>{0.312633157f, 0.945874989f},
-std::array<float,2>{0.00710085593f, 0.371403158f},
-std::array<float,2>{0.696829319f, 0.516927481f},
-std::array<float,2>{0.544733524f, 0.466442436f},
-std::array<float,2>{0.139385477f, 0.648995519f},
-std::array<float,2>{0.388962537f, 0.110176466f},
-std::array<float,2>{0.901981473f, 0.846109092f}}
\ No newline at end of file
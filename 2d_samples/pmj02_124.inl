@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.61690712f, 0.396542877f},
-std::array<float,2>{0.0251324512f, 0.613133669f},
-std::array<float,2>{0.296483815f, 0.103355408f},
-std::array<float,2>{0.841605067f, 0.805372238f},
-std::array<float,2>{0.948519766f, 0.176239878f},
-std::array<float,2>{0.390972733f, 0.891080499f},
-std::array<float,2>{0.24593161f, 0.350443989f},
-std::array<float,2>{0.714159131f, 0.711139739f},
-std::array<float,2>{0.659474611f, 0.0485959426f},
-std::array<float,2>{0.131004646f, 0.830148339f},
-std::array<float,2>{0.468821615f, 0.486360312f},
-std::array<float,2>{0.911925495f, 0.528233171f},
-std::array<float,2>{0.79855299f, 0.284268141f},
-std::array<float,2>{0.3178128f, 0.650554597f},
-std::array<float,2>{0.0709310621f, 0.199713543f},
-std::array<float,2>{0.509221613f, 0.992761672f},
-std::array<float,2>{0.73513329f, 0.326746166f},
-std::array<float,2>{0.203041762f, 0.722345889f},
-std::array<float,2>{0.436679542f, 0.136220649f},
-std::array<float,2>{0.992702186f, 0.922013402f},
-std::array<float,2>{0.853720188f, 0.0819938853f},
-std::array<float,2>{0.255116999f, 0.756002963f},
-std::array<float,2>{0.0602434576f, 0.41283989f},
-std::array<float,2>{0.59190321f, 0.583771467f},
-std::array<float,2>{0.541330338f, 0.244199052f},
-std::array<float,2>{0.113095686f, 0.963134289f},
-std::array<float,2>{0.348637074f, 0.27123937f},
-std::array<float,2>{0.774237573f, 0.663377583f},
-std::array<float,2>{0.896859229f, 0.457780629f},
-std::array<float,2>{0.449326515f, 0.558403134f},
-std::array<float,2>{0.172338352f, 0.00101589842f},
-std::array<float,2>{0.648804367f, 0.844677866f},
-std::array<float,2>{0.529426634f, 0.256055862f},
-std::array<float,2>{0.0909681544f, 0.682604671f},
-std::array<float,2>{0.330508709f, 0.234100282f},
-std::array<float,2>{0.796664238f, 0.939370453f},
-std::array<float,2>{0.933812439f, 0.0216203667f},
-std::array<float,2>{0.491820037f, 0.860500515f},
-std::array<float,2>{0.146380454f, 0.447965354f},
-std::array<float,2>{0.687260985f, 0.54178828f},
-std::array<float,2>{0.690595925f, 0.146172047f},
-std::array<float,2>{0.223373204f, 0.912527621f},
-std::array<float,2>{0.389727205f, 0.339727521f},
-std::array<float,2>{0.958929181f, 0.741238177f},
-std::array<float,2>{0.822149038f, 0.435424238f},
-std::array<float,2>{0.307984829f, 0.570476234f},
-std::array<float,2>{0.0117233759f, 0.0751640201f},
-std::array<float,2>{0.595893621f, 0.777138054f},
-std::array<float,2>{0.639046907f, 0.469711393f},
-std::array<float,2>{0.162397429f, 0.507516623f},
-std::array<float,2>{0.4654468f, 0.0378089845f},
-std::array<float,2>{0.885563791f, 0.82097888f},
-std::array<float,2>{0.764017701f, 0.218175843f},
-std::array<float,2>{0.373628795f, 0.968936682f},
-std::array<float,2>{0.105404682f, 0.310437739f},
-std::array<float,2>{0.557010353f, 0.636461377f},
-std::array<float,2>{0.56444484f, 0.111121245f},
-std::array<float,2>{0.0452249721f, 0.790391803f},
-std::array<float,2>{0.267909914f, 0.376560509f},
-std::array<float,2>{0.863841176f, 0.601124346f},
-std::array<float,2>{0.982040286f, 0.361398309f},
-std::array<float,2>{0.413837463f, 0.689178526f},
-std::array<float,2>{0.212376416f, 0.158615276f},
-std::array<float,2>{0.733100414f, 0.889366806f},
-std::array<float,2>{0.55401355f, 0.44146648f},
-std::array<float,2>{0.101181574f, 0.533061266f},
-std::array<float,2>{0.366938949f, 0.0294397883f},
-std::array<float,2>{0.757003427f, 0.867563248f},
-std::array<float,2>{0.87684828f, 0.21887973f},
-std::array<float,2>{0.453923553f, 0.951275408f},
-std::array<float,2>{0.165178955f, 0.262651682f},
-std::array<float,2>{0.630637467f, 0.678515136f},
-std::array<float,2>{0.724602997f, 0.0678798705f},
-std::array<float,2>{0.205445752f, 0.770863235f},
-std::array<float,2>{0.417914778f, 0.428211421f},
-std::array<float,2>{0.970456183f, 0.566713214f},
-std::array<float,2>{0.872679234f, 0.329890132f},
-std::array<float,2>{0.277291417f, 0.745453238f},
-std::array<float,2>{0.0369229726f, 0.151191875f},
-std::array<float,2>{0.576144934f, 0.915913641f},
-std::array<float,2>{0.679187477f, 0.301775813f},
-std::array<float,2>{0.151629731f, 0.627290308f},
-std::array<float,2>{0.49491477f, 0.20738703f},
-std::array<float,2>{0.92430383f, 0.979856253f},
-std::array<float,2>{0.782708406f, 0.0457113162f},
-std::array<float,2>{0.341023803f, 0.820222437f},
-std::array<float,2>{0.0810027868f, 0.480999023f},
-std::array<float,2>{0.515684068f, 0.511364043f},
-std::array<float,2>{0.604560673f, 0.165991113f},
-std::array<float,2>{0.00499438308f, 0.875828624f},
-std::array<float,2>{0.298617482f, 0.368737489f},
-std::array<float,2>{0.816142797f, 0.70093137f},
-std::array<float,2>{0.963032067f, 0.386011004f},
-std::array<float,2>{0.375452042f, 0.605646074f},
-std::array<float,2>{0.231059507f, 0.124437258f},
-std::array<float,2>{0.700360537f, 0.782023013f},
-std::array<float,2>{0.584016442f, 0.358431667f},
-std::array<float,2>{0.0527793653f, 0.706129789f},
-std::array<float,2>{0.259906322f, 0.185842976f},
-std::array<float,2>{0.845041692f, 0.900517642f},
-std::array<float,2>{0.986911893f, 0.10055057f},
-std::array<float,2>{0.427139074f, 0.798341215f},
-std::array<float,2>{0.195100531f, 0.39950791f},
-std::array<float,2>{0.749513865f, 0.622112513f},
-std::array<float,2>{0.647653699f, 0.195077255f},
-std::array<float,2>{0.183389187f, 0.989096463f},
-std::array<float,2>{0.442765623f, 0.291695416f},
-std::array<float,2>{0.899387062f, 0.641222596f},
-std::array<float,2>{0.767229378f, 0.499676257f},
-std::array<float,2>{0.359191716f, 0.520468593f},
-std::array<float,2>{0.119650252f, 0.0622658096f},
-std::array<float,2>{0.538485169f, 0.838713229f},
-std::array<float,2>{0.705344737f, 0.418336749f},
-std::array<float,2>{0.235047877f, 0.58905369f},
-std::array<float,2>{0.400625765f, 0.0872384906f},
-std::array<float,2>{0.945194423f, 0.761611819f},
-std::array<float,2>{0.835388064f, 0.132546917f},
-std::array<float,2>{0.287038952f, 0.930852175f},
-std::array<float,2>{0.0208202619f, 0.318136454f},
-std::array<float,2>{0.620977879f, 0.734328985f},
-std::array<float,2>{0.505316496f, 0.0121660586f},
-std::array<float,2>{0.063720502f, 0.857973576f},
-std::array<float,2>{0.32537964f, 0.463444352f},
-std::array<float,2>{0.809062898f, 0.554502606f},
-std::array<float,2>{0.915308475f, 0.274873734f},
-std::array<float,2>{0.477007598f, 0.667597532f},
-std::array<float,2>{0.13455382f, 0.236662641f},
-std::array<float,2>{0.669477701f, 0.954392552f},
-std::array<float,2>{0.512510598f, 0.423545539f},
-std::array<float,2>{0.0755891129f, 0.564512253f},
-std::array<float,2>{0.316104889f, 0.0645718798f},
-std::array<float,2>{0.803562522f, 0.766951978f},
-std::array<float,2>{0.90839541f, 0.152722612f},
-std::array<float,2>{0.47529313f, 0.920979083f},
-std::array<float,2>{0.127042696f, 0.332127154f},
-std::array<float,2>{0.663047254f, 0.74706471f},
-std::array<float,2>{0.716356158f, 0.0238309465f},
-std::array<float,2>{0.247381866f, 0.871551633f},
-std::array<float,2>{0.397308618f, 0.440220654f},
-std::array<float,2>{0.951455772f, 0.537847817f},
-std::array<float,2>{0.838495553f, 0.261276484f},
-std::array<float,2>{0.292209983f, 0.67268306f},
-std::array<float,2>{0.029523287f, 0.224281847f},
-std::array<float,2>{0.612259746f, 0.946154416f},
-std::array<float,2>{0.653833389f, 0.373518139f},
-std::array<float,2>{0.176563784f, 0.69694531f},
-std::array<float,2>{0.445703954f, 0.171104923f},
-std::array<float,2>{0.892343819f, 0.88228476f},
-std::array<float,2>{0.778043151f, 0.119894437f},
-std::array<float,2>{0.347562641f, 0.786026061f},
-std::array<float,2>{0.115255527f, 0.38878423f},
-std::array<float,2>{0.54373771f, 0.6016348f},
-std::array<float,2>{0.586693764f, 0.204124078f},
-std::array<float,2>{0.05536424f, 0.982796848f},
-std::array<float,2>{0.250592142f, 0.299426794f},
-std::array<float,2>{0.85741502f, 0.62898916f},
-std::array<float,2>{0.999209285f, 0.477448225f},
-std::array<float,2>{0.431210369f, 0.515522778f},
-std::array<float,2>{0.19917354f, 0.0400030874f},
-std::array<float,2>{0.738960028f, 0.812556505f},
-std::array<float,2>{0.597875535f, 0.296450675f},
-std::array<float,2>{0.0100763338f, 0.646335423f},
-std::array<float,2>{0.311637878f, 0.190507457f},
-std::array<float,2>{0.826631188f, 0.985452652f},
-std::array<float,2>{0.955256522f, 0.0555357225f},
-std::array<float,2>{0.385843337f, 0.842555642f},
-std::array<float,2>{0.221931085f, 0.49420023f},
-std::array<float,2>{0.691650867f, 0.515664697f},
-std::array<float,2>{0.682314813f, 0.183346584f},
-std::array<float,2>{0.142548501f, 0.905421376f},
-std::array<float,2>{0.48474291f, 0.355441481f},
-std::array<float,2>{0.933335423f, 0.709450126f},
-std::array<float,2>{0.790564179f, 0.403408438f},
-std::array<float,2>{0.334280699f, 0.619525194f},
-std::array<float,2>{0.0880100057f, 0.0961821303f},
-std::array<float,2>{0.52605021f, 0.801076591f},
-std::array<float,2>{0.727227747f, 0.465556979f},
-std::array<float,2>{0.216316774f, 0.548502326f},
-std::array<float,2>{0.408943087f, 0.00827244483f},
-std::array<float,2>{0.976868629f, 0.851928711f},
-std::array<float,2>{0.859409809f, 0.242165819f},
-std::array<float,2>{0.270992696f, 0.958609223f},
-std::array<float,2>{0.0400227793f, 0.279043138f},
-std::array<float,2>{0.567168057f, 0.670015812f},
-std::array<float,2>{0.561955631f, 0.0910464749f},
-std::array<float,2>{0.109205112f, 0.764137566f},
-std::array<float,2>{0.370655864f, 0.415960908f},
-std::array<float,2>{0.759143054f, 0.592990935f},
-std::array<float,2>{0.890605927f, 0.315704614f},
-std::array<float,2>{0.461913437f, 0.729231358f},
-std::array<float,2>{0.159870535f, 0.12682879f},
-std::array<float,2>{0.636676252f, 0.934585392f},
-std::array<float,2>{0.573444068f, 0.489432722f},
-std::array<float,2>{0.0348972641f, 0.526862264f},
-std::array<float,2>{0.279024303f, 0.0533564687f},
-std::array<float,2>{0.868656874f, 0.833941638f},
-std::array<float,2>{0.973309219f, 0.197749168f},
-std::array<float,2>{0.419477791f, 0.999435604f},
-std::array<float,2>{0.208509937f, 0.286093265f},
-std::array<float,2>{0.719905138f, 0.655038655f},
-std::array<float,2>{0.628242195f, 0.1076001f},
-std::array<float,2>{0.16942662f, 0.811186612f},
-std::array<float,2>{0.458910018f, 0.393940926f},
-std::array<float,2>{0.881319284f, 0.614157975f},
-std::array<float,2>{0.751797676f, 0.344533473f},
-std::array<float,2>{0.360820264f, 0.716157019f},
-std::array<float,2>{0.0973185375f, 0.175470367f},
-std::array<float,2>{0.549368858f, 0.895622611f},
-std::array<float,2>{0.697390676f, 0.266601145f},
-std::array<float,2>{0.226684928f, 0.657330036f},
-std::array<float,2>{0.382427722f, 0.248625919f},
-std::array<float,2>{0.96824187f, 0.968679011f},
-std::array<float,2>{0.817892432f, 0.00585437799f},
-std::array<float,2>{0.303721756f, 0.850306749f},
-std::array<float,2>{0.000855474151f, 0.453543276f},
-std::array<float,2>{0.608300984f, 0.55874902f},
-std::array<float,2>{0.521256506f, 0.140051603f},
-std::array<float,2>{0.0840206146f, 0.927746594f},
-std::array<float,2>{0.336463273f, 0.323985577f},
-std::array<float,2>{0.786777914f, 0.723023355f},
-std::array<float,2>{0.926778078f, 0.408773243f},
-std::array<float,2>{0.498677522f, 0.58019042f},
-std::array<float,2>{0.155844018f, 0.0821189135f},
-std::array<float,2>{0.671948433f, 0.752816379f},
-std::array<float,2>{0.533558905f, 0.343505323f},
-std::array<float,2>{0.123341516f, 0.737366498f},
-std::array<float,2>{0.353417844f, 0.141607523f},
-std::array<float,2>{0.769916892f, 0.90814358f},
-std::array<float,2>{0.906070888f, 0.070362024f},
-std::array<float,2>{0.440256625f, 0.77929908f},
-std::array<float,2>{0.187238157f, 0.431665748f},
-std::array<float,2>{0.643880129f, 0.577506661f},
-std::array<float,2>{0.742538035f, 0.227017611f},
-std::array<float,2>{0.188273594f, 0.943500459f},
-std::array<float,2>{0.423853844f, 0.251248091f},
-std::array<float,2>{0.990876138f, 0.68530792f},
-std::array<float,2>{0.848036826f, 0.452008128f},
-std::array<float,2>{0.265620232f, 0.543330967f},
-std::array<float,2>{0.0484002754f, 0.0186086129f},
-std::array<float,2>{0.581498742f, 0.86425209f},
-std::array<float,2>{0.665352762f, 0.379735529f},
-std::array<float,2>{0.138618305f, 0.594307184f},
-std::array<float,2>{0.482578307f, 0.114419408f},
-std::array<float,2>{0.91890347f, 0.793022394f},
-std::array<float,2>{0.806016028f, 0.162269756f},
-std::array<float,2>{0.322084129f, 0.88548094f},
-std::array<float,2>{0.0676965714f, 0.367093891f},
-std::array<float,2>{0.500798643f, 0.691670775f},
-std::array<float,2>{0.623729885f, 0.0334126055f},
-std::array<float,2>{0.0168776307f, 0.826506734f},
-std::array<float,2>{0.281917155f, 0.474545807f},
-std::array<float,2>{0.831799924f, 0.502049327f},
-std::array<float,2>{0.940243065f, 0.307368904f},
-std::array<float,2>{0.405502677f, 0.638718724f},
-std::array<float,2>{0.240597382f, 0.212207779f},
-std::array<float,2>{0.70704186f, 0.975589275f},
-std::array<float,2>{0.590492249f, 0.410202891f},
-std::array<float,2>{0.0622782484f, 0.58526057f},
-std::array<float,2>{0.256101668f, 0.078572385f},
-std::array<float,2>{0.853301883f, 0.75493592f},
-std::array<float,2>{0.994394958f, 0.13420397f},
-std::array<float,2>{0.435213566f, 0.923968613f},
-std::array<float,2>{0.200089544f, 0.324791253f},
-std::array<float,2>{0.737089217f, 0.72016716f},
-std::array<float,2>{0.651288211f, 0.00345163816f},
-std::array<float,2>{0.174853221f, 0.847586691f},
-std::array<float,2>{0.45185259f, 0.459108591f},
-std::array<float,2>{0.896112204f, 0.556133151f},
-std::array<float,2>{0.776858985f, 0.272070467f},
-std::array<float,2>{0.349787831f, 0.66113764f},
-std::array<float,2>{0.110136628f, 0.243413076f},
-std::array<float,2>{0.540673852f, 0.961007655f},
-std::array<float,2>{0.711771369f, 0.349323064f},
-std::array<float,2>{0.242519945f, 0.713100851f},
-std::array<float,2>{0.393870324f, 0.179161772f},
-std::array<float,2>{0.945595026f, 0.893351853f},
-std::array<float,2>{0.843405068f, 0.10525056f},
-std::array<float,2>{0.293327361f, 0.80852741f},
-std::array<float,2>{0.027206894f, 0.394961327f},
-std::array<float,2>{0.613395572f, 0.610589087f},
-std::array<float,2>{0.509897649f, 0.20287393f},
-std::array<float,2>{0.0723473728f, 0.994213641f},
-std::array<float,2>{0.319812566f, 0.281882435f},
-std::array<float,2>{0.79974395f, 0.649649799f},
-std::array<float,2>{0.912316084f, 0.485448629f},
-std::array<float,2>{0.472580254f, 0.531107783f},
-std::array<float,2>{0.130427957f, 0.0505440757f},
-std::array<float,2>{0.657446146f, 0.828908622f},
-std::array<float,2>{0.556569695f, 0.310958147f},
-std::array<float,2>{0.102414459f, 0.634350002f},
-std::array<float,2>{0.371711075f, 0.215997368f},
-std::array<float,2>{0.761839926f, 0.971301258f},
-std::array<float,2>{0.883666158f, 0.0354098082f},
-std::array<float,2>{0.468592972f, 0.823777914f},
-std::array<float,2>{0.161060527f, 0.472636133f},
-std::array<float,2>{0.636888266f, 0.50537461f},
-std::array<float,2>{0.731261849f, 0.157185495f},
-std::array<float,2>{0.214529917f, 0.887019217f},
-std::array<float,2>{0.411817968f, 0.360622644f},
-std::array<float,2>{0.98285538f, 0.690519452f},
-std::array<float,2>{0.866366804f, 0.377315432f},
-std::array<float,2>{0.267340928f, 0.597786784f},
-std::array<float,2>{0.0443117023f, 0.112827256f},
-std::array<float,2>{0.565072715f, 0.791664124f},
-std::array<float,2>{0.684420049f, 0.445324361f},
-std::array<float,2>{0.147953272f, 0.539173067f},
-std::array<float,2>{0.48969847f, 0.0197137408f},
-std::array<float,2>{0.935800076f, 0.863223791f},
-std::array<float,2>{0.793635905f, 0.231950998f},
-std::array<float,2>{0.328733355f, 0.941248596f},
-std::array<float,2>{0.0928277522f, 0.255584121f},
-std::array<float,2>{0.528103888f, 0.68147856f},
-std::array<float,2>{0.594306231f, 0.0766560435f},
-std::array<float,2>{0.0152768437f, 0.774326205f},
-std::array<float,2>{0.305429906f, 0.436669916f},
-std::array<float,2>{0.823997438f, 0.573236942f},
-std::array<float,2>{0.960795701f, 0.337483972f},
-std::array<float,2>{0.3867293f, 0.738490582f},
-std::array<float,2>{0.225199759f, 0.147494704f},
-std::array<float,2>{0.687667668f, 0.91193974f},
-std::array<float,2>{0.517821491f, 0.483595818f},
-std::array<float,2>{0.0793281347f, 0.508456886f},
-std::array<float,2>{0.343319178f, 0.0447172895f},
-std::array<float,2>{0.784622252f, 0.817552269f},
-std::array<float,2>{0.923590362f, 0.209138691f},
-std::array<float,2>{0.492229909f, 0.976756573f},
-std::array<float,2>{0.149187654f, 0.303679258f},
-std::array<float,2>{0.677703202f, 0.626272738f},
-std::array<float,2>{0.702762365f, 0.121588275f},
-std::array<float,2>{0.233867005f, 0.784860909f},
-std::array<float,2>{0.377898037f, 0.384590089f},
-std::array<float,2>{0.962614179f, 0.608518064f},
-std::array<float,2>{0.812816143f, 0.370501965f},
-std::array<float,2>{0.299928606f, 0.701253653f},
-std::array<float,2>{0.00603881991f, 0.167546794f},
-std::array<float,2>{0.602037787f, 0.87819469f},
-std::array<float,2>{0.632571816f, 0.264603436f},
-std::array<float,2>{0.166160047f, 0.676047564f},
-std::array<float,2>{0.45596993f, 0.220819488f},
-std::array<float,2>{0.878112674f, 0.950965106f},
-std::array<float,2>{0.755058348f, 0.0279581212f},
-std::array<float,2>{0.364487499f, 0.870610654f},
-std::array<float,2>{0.0992182717f, 0.445259929f},
-std::array<float,2>{0.552560806f, 0.534503818f},
-std::array<float,2>{0.57679677f, 0.150209814f},
-std::array<float,2>{0.0376208797f, 0.916370451f},
-std::array<float,2>{0.273516506f, 0.330290854f},
-std::array<float,2>{0.873338819f, 0.742717683f},
-std::array<float,2>{0.971735239f, 0.427078843f},
-std::array<float,2>{0.415203094f, 0.569413662f},
-std::array<float,2>{0.203152254f, 0.0697159171f},
-std::array<float,2>{0.72571218f, 0.773323119f},
-std::array<float,2>{0.618873417f, 0.319411457f},
-std::array<float,2>{0.0216873214f, 0.730675519f},
-std::array<float,2>{0.288665742f, 0.129407004f},
-std::array<float,2>{0.83344233f, 0.932050228f},
-std::array<float,2>{0.942842364f, 0.0894276649f},
-std::array<float,2>{0.399935544f, 0.757869184f},
-std::array<float,2>{0.237552181f, 0.421210527f},
-std::array<float,2>{0.703711569f, 0.587494433f},
-std::array<float,2>{0.670598209f, 0.235620439f},
-std::array<float,2>{0.134810716f, 0.955743253f},
-std::array<float,2>{0.478822976f, 0.277191013f},
-std::array<float,2>{0.917921841f, 0.664343238f},
-std::array<float,2>{0.811430275f, 0.462608159f},
-std::array<float,2>{0.327683926f, 0.551309764f},
-std::array<float,2>{0.0658644065f, 0.0149424151f},
-std::array<float,2>{0.505891144f, 0.856132627f},
-std::array<float,2>{0.747788072f, 0.400679439f},
-std::array<float,2>{0.193251401f, 0.624784112f},
-std::array<float,2>{0.429676682f, 0.0991219431f},
-std::array<float,2>{0.985474706f, 0.800009847f},
-std::array<float,2>{0.846663117f, 0.185280576f},
-std::array<float,2>{0.258461177f, 0.899508715f},
-std::array<float,2>{0.051614441f, 0.356605917f},
-std::array<float,2>{0.583276331f, 0.704713762f},
-std::array<float,2>{0.53592521f, 0.0596964955f},
-std::array<float,2>{0.118546471f, 0.83779031f},
-std::array<float,2>{0.35732156f, 0.497393131f},
-std::array<float,2>{0.767886877f, 0.523299873f},
-std::array<float,2>{0.901984155f, 0.289390981f},
-std::array<float,2>{0.444338351f, 0.643341184f},
-std::array<float,2>{0.180820093f, 0.193102866f},
-std::array<float,2>{0.64591831f, 0.99187398f},
-std::array<float,2>{0.54669553f, 0.387073606f},
-std::array<float,2>{0.115037151f, 0.603935719f},
-std::array<float,2>{0.344082594f, 0.117771678f},
-std::array<float,2>{0.780585945f, 0.78823626f},
-std::array<float,2>{0.894278109f, 0.169225559f},
-std::array<float,2>{0.447728515f, 0.879798949f},
-std::array<float,2>{0.179387242f, 0.372713864f},
-std::array<float,2>{0.655220866f, 0.698530912f},
-std::array<float,2>{0.741247773f, 0.0421323292f},
-std::array<float,2>{0.196311295f, 0.814714849f},
-std::array<float,2>{0.431828141f, 0.47895956f},
-std::array<float,2>{0.997235f, 0.513254344f},
-std::array<float,2>{0.858144701f, 0.29860884f},
-std::array<float,2>{0.252283782f, 0.632160664f},
-std::array<float,2>{0.0573449358f, 0.205752373f},
-std::array<float,2>{0.589686871f, 0.981024742f},
-std::array<float,2>{0.661406934f, 0.335173368f},
-std::array<float,2>{0.12598227f, 0.749626219f},
-std::array<float,2>{0.473942637f, 0.154828325f},
-std::array<float,2>{0.906383634f, 0.919220686f},
-std::array<float,2>{0.801804364f, 0.0639762059f},
-std::array<float,2>{0.312793821f, 0.76858151f},
-std::array<float,2>{0.076519981f, 0.424312085f},
-std::array<float,2>{0.513927102f, 0.564323664f},
-std::array<float,2>{0.611121833f, 0.225997776f},
-std::array<float,2>{0.0282466114f, 0.947624743f},
-std::array<float,2>{0.289762437f, 0.258984923f},
-std::array<float,2>{0.837835908f, 0.675114632f},
-std::array<float,2>{0.950745642f, 0.438495576f},
-std::array<float,2>{0.395612031f, 0.535291791f},
-std::array<float,2>{0.248700172f, 0.025704693f},
-std::array<float,2>{0.717976987f, 0.873988986f},
-std::array<float,2>{0.568958998f, 0.28104049f},
-std::array<float,2>{0.0424610935f, 0.669754148f},
-std::array<float,2>{0.27338326f, 0.239903495f},
-std::array<float,2>{0.861431062f, 0.960146785f},
-std::array<float,2>{0.979658425f, 0.0100856889f},
-std::array<float,2>{0.40805468f, 0.854292631f},
-std::array<float,2>{0.217910022f, 0.466862828f},
-std::array<float,2>{0.728739738f, 0.548937142f},
-std::array<float,2>{0.633720338f, 0.128203765f},
-std::array<float,2>{0.157756135f, 0.935906887f},
-std::array<float,2>{0.463132769f, 0.313313961f},
-std::array<float,2>{0.888242364f, 0.727411807f},
-std::array<float,2>{0.760930121f, 0.416274369f},
-std::array<float,2>{0.36844027f, 0.591511607f},
-std::array<float,2>{0.1061759f, 0.0922887698f},
-std::array<float,2>{0.560453534f, 0.762633622f},
-std::array<float,2>{0.694876671f, 0.493356735f},
-std::array<float,2>{0.218953118f, 0.517850518f},
-std::array<float,2>{0.383823335f, 0.058463335f},
-std::array<float,2>{0.954974949f, 0.840739369f},
-std::array<float,2>{0.825939357f, 0.188823551f},
-std::array<float,2>{0.309868574f, 0.98765415f},
-std::array<float,2>{0.00965760555f, 0.292971224f},
-std::array<float,2>{0.600686431f, 0.647175968f},
-std::array<float,2>{0.523935378f, 0.0954507291f},
-std::array<float,2>{0.0867814645f, 0.80280143f},
-std::array<float,2>{0.332119852f, 0.405457497f},
-std::array<float,2>{0.792578816f, 0.618690908f},
-std::array<float,2>{0.930346608f, 0.352051854f},
-std::array<float,2>{0.487408698f, 0.708550394f},
-std::array<float,2>{0.143496662f, 0.18050611f},
-std::array<float,2>{0.68104285f, 0.904124916f},
-std::array<float,2>{0.606297195f, 0.45558396f},
-std::array<float,2>{0.00295164669f, 0.562154531f},
-std::array<float,2>{0.301567852f, 0.00620063301f},
-std::array<float,2>{0.820067406f, 0.848387659f},
-std::array<float,2>{0.965563536f, 0.24707818f},
-std::array<float,2>{0.380551964f, 0.965157866f},
-std::array<float,2>{0.230194047f, 0.268969685f},
-std::array<float,2>{0.695830345f, 0.659399748f},
-std::array<float,2>{0.675506473f, 0.084155865f},
-std::array<float,2>{0.152525291f, 0.750660837f},
-std::array<float,2>{0.497300923f, 0.406933963f},
-std::array<float,2>{0.929682255f, 0.579665899f},
-std::array<float,2>{0.787717819f, 0.321321338f},
-std::array<float,2>{0.338220954f, 0.724802077f},
-std::array<float,2>{0.0836325809f, 0.137371913f},
-std::array<float,2>{0.5225631f, 0.926753163f},
-std::array<float,2>{0.720987141f, 0.287910938f},
-std::array<float,2>{0.20907627f, 0.653118193f},
-std::array<float,2>{0.420128137f, 0.196318492f},
-std::array<float,2>{0.976410508f, 0.998011649f},
-std::array<float,2>{0.871005654f, 0.0521238334f},
-std::array<float,2>{0.279726535f, 0.83485502f},
-std::array<float,2>{0.0316888355f, 0.491769224f},
-std::array<float,2>{0.57113564f, 0.524766028f},
-std::array<float,2>{0.548475981f, 0.172418535f},
-std::array<float,2>{0.0939738676f, 0.896576941f},
-std::array<float,2>{0.36185348f, 0.345835537f},
-std::array<float,2>{0.753108203f, 0.718631744f},
-std::array<float,2>{0.879655898f, 0.390646219f},
-std::array<float,2>{0.459029227f, 0.616606176f},
-std::array<float,2>{0.170277745f, 0.106893227f},
-std::array<float,2>{0.626766205f, 0.809794724f},
-std::array<float,2>{0.502800643f, 0.363910317f},
-std::array<float,2>{0.0691145062f, 0.695216477f},
-std::array<float,2>{0.324200064f, 0.160730526f},
-std::array<float,2>{0.806737959f, 0.882812619f},
-std::array<float,2>{0.921548724f, 0.116828948f},
-std::array<float,2>{0.482275575f, 0.795543134f},
-std::array<float,2>{0.139057457f, 0.381958455f},
-std::array<float,2>{0.666979671f, 0.597590387f},
-std::array<float,2>{0.71066612f, 0.214565173f},
-std::array<float,2>{0.239348337f, 0.972670794f},
-std::array<float,2>{0.403874397f, 0.305835128f},
-std::array<float,2>{0.9375301f, 0.637222648f},
-std::array<float,2>{0.828786969f, 0.47469458f},
-std::array<float,2>{0.284839898f, 0.501260102f},
-std::array<float,2>{0.0190451518f, 0.0325504355f},
-std::array<float,2>{0.622803509f, 0.825311661f},
-std::array<float,2>{0.641904235f, 0.431046337f},
-std::array<float,2>{0.18444933f, 0.575829089f},
-std::array<float,2>{0.438471466f, 0.0728975907f},
-std::array<float,2>{0.904171824f, 0.77916044f},
-std::array<float,2>{0.772411168f, 0.143573076f},
-std::array<float,2>{0.354967296f, 0.908593655f},
-std::array<float,2>{0.122329101f, 0.341010571f},
-std::array<float,2>{0.531542718f, 0.735249043f},
-std::array<float,2>{0.578445256f, 0.0163510293f},
-std::array<float,2>{0.0496917218f, 0.865528047f},
-std::array<float,2>{0.262423456f, 0.450642556f},
-std::array<float,2>{0.851297498f, 0.545078576f},
-std::array<float,2>{0.989722967f, 0.252904564f},
-std::array<float,2>{0.422109008f, 0.685606837f},
-std::array<float,2>{0.189703703f, 0.229804993f},
-std::array<float,2>{0.74537611f, 0.942250192f},
-std::array<float,2>{0.597136676f, 0.436362147f},
-std::array<float,2>{0.01304748f, 0.574064791f},
-std::array<float,2>{0.307409853f, 0.0780747682f},
-std::array<float,2>{0.820997536f, 0.774977386f},
-std::array<float,2>{0.957616687f, 0.147291556f},
-std::array<float,2>{0.389549047f, 0.910342336f},
-std::array<float,2>{0.223969102f, 0.336316317f},
-std::array<float,2>{0.689509034f, 0.739538968f},
-std::array<float,2>{0.685596764f, 0.0213883258f},
-std::array<float,2>{0.145316377f, 0.861802578f},
-std::array<float,2>{0.490994602f, 0.446878195f},
-std::array<float,2>{0.935418904f, 0.540782273f},
-std::array<float,2>{0.795018315f, 0.254826397f},
-std::array<float,2>{0.331592858f, 0.679849565f},
-std::array<float,2>{0.0902249962f, 0.230661243f},
-std::array<float,2>{0.531161845f, 0.939710617f},
-std::array<float,2>{0.733572602f, 0.360011101f},
-std::array<float,2>{0.211777806f, 0.690041363f},
-std::array<float,2>{0.41244331f, 0.157716751f},
-std::array<float,2>{0.980913997f, 0.888213456f},
-std::array<float,2>{0.864675581f, 0.11159496f},
-std::array<float,2>{0.268702567f, 0.792471647f},
-std::array<float,2>{0.0465576574f, 0.378241956f},
-std::array<float,2>{0.562785268f, 0.599422336f},
-std::array<float,2>{0.558107615f, 0.215309575f},
-std::array<float,2>{0.104093887f, 0.972327411f},
-std::array<float,2>{0.374720246f, 0.312402219f},
-std::array<float,2>{0.7651214f, 0.633444428f},
-std::array<float,2>{0.886351943f, 0.47074905f},
-std::array<float,2>{0.466073334f, 0.504545569f},
-std::array<float,2>{0.164005339f, 0.0364851505f},
-std::array<float,2>{0.640348554f, 0.822704613f},
-std::array<float,2>{0.508653402f, 0.28257814f},
-std::array<float,2>{0.0720934495f, 0.648733616f},
-std::array<float,2>{0.317203403f, 0.201913506f},
-std::array<float,2>{0.79710108f, 0.995707929f},
-std::array<float,2>{0.910274684f, 0.0489934571f},
-std::array<float,2>{0.470065445f, 0.830019653f},
-std::array<float,2>{0.131950185f, 0.485342741f},
-std::array<float,2>{0.65854311f, 0.529951334f},
-std::array<float,2>{0.712979376f, 0.178408965f},
-std::array<float,2>{0.244976625f, 0.894240081f},
-std::array<float,2>{0.392185122f, 0.347806662f},
-std::array<float,2>{0.947308183f, 0.714301586f},
-std::array<float,2>{0.840781868f, 0.396397799f},
-std::array<float,2>{0.295046568f, 0.609521091f},
-std::array<float,2>{0.0234418921f, 0.103992231f},
-std::array<float,2>{0.615634322f, 0.80667299f},
-std::array<float,2>{0.650080264f, 0.459971219f},
-std::array<float,2>{0.173359886f, 0.555295289f},
-std::array<float,2>{0.450300008f, 0.00213637156f},
-std::array<float,2>{0.898171544f, 0.846612871f},
-std::array<float,2>{0.77521348f, 0.242849737f},
-std::array<float,2>{0.348247319f, 0.961962938f},
-std::array<float,2>{0.111942969f, 0.273046225f},
-std::array<float,2>{0.542081535f, 0.660247803f},
-std::array<float,2>{0.592950404f, 0.0799922124f},
-std::array<float,2>{0.0586792491f, 0.754700422f},
-std::array<float,2>{0.254709542f, 0.411227673f},
-std::array<float,2>{0.8548823f, 0.584757745f},
-std::array<float,2>{0.993884981f, 0.325777769f},
-std::array<float,2>{0.435857803f, 0.719698429f},
-std::array<float,2>{0.20138754f, 0.133010969f},
-std::array<float,2>{0.736291349f, 0.925096631f},
-std::array<float,2>{0.537900448f, 0.496166974f},
-std::array<float,2>{0.120608583f, 0.521776676f},
-std::array<float,2>{0.357957989f, 0.0591760166f},
-std::array<float,2>{0.766362727f, 0.836323142f},
-std::array<float,2>{0.899574757f, 0.192310065f},
-std::array<float,2>{0.441729188f, 0.990809858f},
-std::array<float,2>{0.18215169f, 0.290917128f},
-std::array<float,2>{0.646753371f, 0.643795848f},
-std::array<float,2>{0.748198748f, 0.0977691785f},
-std::array<float,2>{0.194032818f, 0.79968065f},
-std::array<float,2>{0.426050127f, 0.401706904f},
-std::array<float,2>{0.987381697f, 0.623139858f},
-std::array<float,2>{0.843816817f, 0.355936319f},
-std::array<float,2>{0.261302054f, 0.703639686f},
-std::array<float,2>{0.0543660074f, 0.183698967f},
-std::array<float,2>{0.585201919f, 0.899294376f},
-std::array<float,2>{0.66862601f, 0.276316255f},
-std::array<float,2>{0.132854864f, 0.665103137f},
-std::array<float,2>{0.47832796f, 0.234613031f},
-std::array<float,2>{0.91413939f, 0.957010508f},
-std::array<float,2>{0.810182273f, 0.0142007899f},
-std::array<float,2>{0.324535519f, 0.857047319f},
-std::array<float,2>{0.0634070933f, 0.461114049f},
-std::array<float,2>{0.504771829f, 0.55206877f},
-std::array<float,2>{0.619311988f, 0.130302921f},
-std::array<float,2>{0.0204185415f, 0.933233857f},
-std::array<float,2>{0.285829782f, 0.318380982f},
-std::array<float,2>{0.834342122f, 0.731616199f},
-std::array<float,2>{0.944033861f, 0.420569807f},
-std::array<float,2>{0.401945889f, 0.586265624f},
-std::array<float,2>{0.235851496f, 0.0887889415f},
-std::array<float,2>{0.706096649f, 0.759130299f},
-std::array<float,2>{0.574636042f, 0.331517696f},
-std::array<float,2>{0.0356650203f, 0.74355942f},
-std::array<float,2>{0.276137829f, 0.148636892f},
-std::array<float,2>{0.871150374f, 0.9175179f},
-std::array<float,2>{0.969052494f, 0.0683626086f},
-std::array<float,2>{0.416849077f, 0.771895885f},
-std::array<float,2>{0.206841782f, 0.426453799f},
-std::array<float,2>{0.723036051f, 0.569263101f},
-std::array<float,2>{0.629404724f, 0.222194314f},
-std::array<float,2>{0.164377093f, 0.95004195f},
-std::array<float,2>{0.454691023f, 0.264727771f},
-std::array<float,2>{0.875960052f, 0.676894963f},
-std::array<float,2>{0.756483078f, 0.443435043f},
-std::array<float,2>{0.365310103f, 0.533917904f},
-std::array<float,2>{0.0997120589f, 0.028863376f},
-std::array<float,2>{0.553224146f, 0.869881928f},
-std::array<float,2>{0.699466527f, 0.383749574f},
-std::array<float,2>{0.23150596f, 0.608292341f},
-std::array<float,2>{0.376457512f, 0.12212421f},
-std::array<float,2>{0.964557767f, 0.783904135f},
-std::array<float,2>{0.81447649f, 0.166552305f},
-std::array<float,2>{0.297424287f, 0.87719214f},
-std::array<float,2>{0.00424525002f, 0.370022058f},
-std::array<float,2>{0.604442358f, 0.702486157f},
-std::array<float,2>{0.517282844f, 0.0434531309f},
-std::array<float,2>{0.0817286372f, 0.816768229f},
-std::array<float,2>{0.340583265f, 0.483105838f},
-std::array<float,2>{0.781997502f, 0.509039402f},
-std::array<float,2>{0.925096989f, 0.30393666f},
-std::array<float,2>{0.496044934f, 0.625601292f},
-std::array<float,2>{0.151046455f, 0.210154712f},
-std::array<float,2>{0.678260982f, 0.977934301f},
-std::array<float,2>{0.526494443f, 0.405137777f},
-std::array<float,2>{0.0896709263f, 0.617291629f},
-std::array<float,2>{0.33580631f, 0.0942323655f},
-std::array<float,2>{0.789138019f, 0.804187834f},
-std::array<float,2>{0.932180822f, 0.181494296f},
-std::array<float,2>{0.48587051f, 0.902504027f},
-std::array<float,2>{0.140997738f, 0.352611154f},
-std::array<float,2>{0.683242857f, 0.707541287f},
-std::array<float,2>{0.692916512f, 0.0574745871f},
-std::array<float,2>{0.221471712f, 0.841721058f},
-std::array<float,2>{0.385112166f, 0.49242124f},
-std::array<float,2>{0.956838369f, 0.518785238f},
-std::array<float,2>{0.828080773f, 0.294484735f},
-std::array<float,2>{0.311319321f, 0.647621036f},
-std::array<float,2>{0.0107747149f, 0.187792003f},
-std::array<float,2>{0.59939611f, 0.986382663f},
-std::array<float,2>{0.6352759f, 0.313569814f},
-std::array<float,2>{0.159095779f, 0.727639854f},
-std::array<float,2>{0.462810516f, 0.127704293f},
-std::array<float,2>{0.889624238f, 0.936982691f},
-std::array<float,2>{0.758514404f, 0.0935329869f},
-std::array<float,2>{0.369293809f, 0.762990654f},
-std::array<float,2>{0.108273968f, 0.41703397f},
-std::array<float,2>{0.561083972f, 0.590728521f},
-std::array<float,2>{0.568187892f, 0.238447502f},
-std::array<float,2>{0.0406143852f, 0.959786177f},
-std::array<float,2>{0.270018965f, 0.279541612f},
-std::array<float,2>{0.86089164f, 0.668165028f},
-std::array<float,2>{0.978427291f, 0.468179792f},
-std::array<float,2>{0.40987888f, 0.550491869f},
-std::array<float,2>{0.215794012f, 0.0111778276f},
-std::array<float,2>{0.727848709f, 0.854660511f},
-std::array<float,2>{0.613206506f, 0.258554965f},
-std::array<float,2>{0.0309440363f, 0.674069345f},
-std::array<float,2>{0.29170239f, 0.225449324f},
-std::array<float,2>{0.839606166f, 0.94884187f},
-std::array<float,2>{0.95235157f, 0.0268712081f},
-std::array<float,2>{0.398068041f, 0.874406815f},
-std::array<float,2>{0.246469498f, 0.437844038f},
-std::array<float,2>{0.715485036f, 0.536766887f},
-std::array<float,2>{0.663893402f, 0.155771643f},
-std::array<float,2>{0.128403589f, 0.91864711f},
-std::array<float,2>{0.475599378f, 0.334290087f},
-std::array<float,2>{0.909683526f, 0.748251796f},
-std::array<float,2>{0.80399394f, 0.424818426f},
-std::array<float,2>{0.315045446f, 0.5625211f},
-std::array<float,2>{0.0747260153f, 0.0628457367f},
-std::array<float,2>{0.512757599f, 0.76845634f},
-std::array<float,2>{0.739580452f, 0.480252832f},
-std::array<float,2>{0.198018149f, 0.512428582f},
-std::array<float,2>{0.430093408f, 0.0417380817f},
-std::array<float,2>{0.99880302f, 0.816001236f},
-std::array<float,2>{0.855980754f, 0.206792802f},
-std::array<float,2>{0.251262218f, 0.981948674f},
-std::array<float,2>{0.0558657721f, 0.297530174f},
-std::array<float,2>{0.587145746f, 0.631785512f},
-std::array<float,2>{0.544725299f, 0.118996896f},
-std::array<float,2>{0.116698846f, 0.787687302f},
-std::array<float,2>{0.346666545f, 0.387839973f},
-std::array<float,2>{0.778492928f, 0.605420411f},
-std::array<float,2>{0.8909899f, 0.371414483f},
-std::array<float,2>{0.447231591f, 0.698213875f},
-std::array<float,2>{0.177589372f, 0.16799973f},
-std::array<float,2>{0.653077722f, 0.880131423f},
-std::array<float,2>{0.580913186f, 0.449872524f},
-std::array<float,2>{0.0476226732f, 0.546662629f},
-std::array<float,2>{0.263933629f, 0.0167501681f},
-std::array<float,2>{0.849156201f, 0.86688602f},
-std::array<float,2>{0.991469383f, 0.229439884f},
-std::array<float,2>{0.425316066f, 0.942435801f},
-std::array<float,2>{0.188718781f, 0.253201783f},
-std::array<float,2>{0.743192673f, 0.687227666f},
-std::array<float,2>{0.643188596f, 0.0736585483f},
-std::array<float,2>{0.186298892f, 0.777663529f},
-std::array<float,2>{0.440477729f, 0.429722548f},
-std::array<float,2>{0.90436846f, 0.574335694f},
-std::array<float,2>{0.7709921f, 0.340101749f},
-std::array<float,2>{0.351772696f, 0.735718906f},
-std::array<float,2>{0.1240834f, 0.143533826f},
-std::array<float,2>{0.53423053f, 0.910083115f},
-std::array<float,2>{0.708145082f, 0.304874867f},
-std::array<float,2>{0.24201107f, 0.638194144f},
-std::array<float,2>{0.404667646f, 0.213494092f},
-std::array<float,2>{0.941402435f, 0.974402845f},
-std::array<float,2>{0.830998719f, 0.0319984704f},
-std::array<float,2>{0.282722831f, 0.824221492f},
-std::array<float,2>{0.0161257666f, 0.475697815f},
-std::array<float,2>{0.624842286f, 0.500860512f},
-std::array<float,2>{0.501917481f, 0.161478668f},
-std::array<float,2>{0.0672692508f, 0.884322882f},
-std::array<float,2>{0.321099997f, 0.364962727f},
-std::array<float,2>{0.805005729f, 0.693978608f},
-std::array<float,2>{0.919167101f, 0.381185681f},
-std::array<float,2>{0.483460665f, 0.595821738f},
-std::array<float,2>{0.13673009f, 0.115492731f},
-std::array<float,2>{0.664677501f, 0.796800077f},
-std::array<float,2>{0.550266385f, 0.347388148f},
-std::array<float,2>{0.0958038494f, 0.717440248f},
-std::array<float,2>{0.359541506f, 0.173088342f},
-std::array<float,2>{0.75020045f, 0.897943616f},
-std::array<float,2>{0.882541537f, 0.106203929f},
-std::array<float,2>{0.457777828f, 0.809064686f},
-std::array<float,2>{0.168556824f, 0.392167836f},
-std::array<float,2>{0.627209783f, 0.616106868f},
-std::array<float,2>{0.71899581f, 0.196077958f},
-std::array<float,2>{0.207891732f, 0.996173918f},
-std::array<float,2>{0.417985946f, 0.288474739f},
-std::array<float,2>{0.974356592f, 0.653688788f},
-std::array<float,2>{0.867607832f, 0.490818352f},
-std::array<float,2>{0.277990758f, 0.523500025f},
-std::array<float,2>{0.0339358486f, 0.0515130386f},
-std::array<float,2>{0.572446585f, 0.835104048f},
-std::array<float,2>{0.673711121f, 0.407333851f},
-std::array<float,2>{0.154606894f, 0.579029918f},
-std::array<float,2>{0.499028921f, 0.0856482387f},
-std::array<float,2>{0.926367104f, 0.751336634f},
-std::array<float,2>{0.785429776f, 0.138354808f},
-std::array<float,2>{0.337828368f, 0.927050233f},
-std::array<float,2>{0.0852827057f, 0.320671797f},
-std::array<float,2>{0.520024359f, 0.726310432f},
-std::array<float,2>{0.609003246f, 0.00728611927f},
-std::array<float,2>{0.00112007407f, 0.849502206f},
-std::array<float,2>{0.302866399f, 0.456517786f},
-std::array<float,2>{0.817067325f, 0.561084867f},
-std::array<float,2>{0.967229128f, 0.267797559f},
-std::array<float,2>{0.380874097f, 0.65867877f},
-std::array<float,2>{0.227984533f, 0.246815234f},
-std::array<float,2>{0.698920131f, 0.96638751f},
-std::array<float,2>{0.56545037f, 0.375020176f},
-std::array<float,2>{0.043940641f, 0.600414455f},
-std::array<float,2>{0.265923679f, 0.110333867f},
-std::array<float,2>{0.866120934f, 0.78909111f},
-std::array<float,2>{0.983961165f, 0.15967676f},
-std::array<float,2>{0.410164356f, 0.889986336f},
-std::array<float,2>{0.213637426f, 0.362962186f},
-std::array<float,2>{0.732135057f, 0.688189089f},
-std::array<float,2>{0.638228595f, 0.0387432426f},
-std::array<float,2>{0.161810666f, 0.821695209f},
-std::array<float,2>{0.467405736f, 0.470363855f},
-std::array<float,2>{0.884628892f, 0.506447554f},
-std::array<float,2>{0.763608813f, 0.309054852f},
-std::array<float,2>{0.372327805f, 0.635417461f},
-std::array<float,2>{0.102961965f, 0.21709995f},
-std::array<float,2>{0.555196702f, 0.969829857f},
-std::array<float,2>{0.689128637f, 0.338347316f},
-std::array<float,2>{0.226238698f, 0.740763783f},
-std::array<float,2>{0.38822189f, 0.144716188f},
-std::array<float,2>{0.959819138f, 0.914055288f},
-std::array<float,2>{0.823190331f, 0.0756277591f},
-std::array<float,2>{0.305931777f, 0.775517225f},
-std::array<float,2>{0.0140816066f, 0.43392992f},
-std::array<float,2>{0.595641255f, 0.571352839f},
-std::array<float,2>{0.529277027f, 0.232638329f},
-std::array<float,2>{0.0921906531f, 0.93814683f},
-std::array<float,2>{0.329451054f, 0.256985784f},
-std::array<float,2>{0.794034183f, 0.683193505f},
-std::array<float,2>{0.936832249f, 0.449041843f},
-std::array<float,2>{0.488723576f, 0.542273641f},
-std::array<float,2>{0.146688744f, 0.0232395325f},
-std::array<float,2>{0.685349762f, 0.859708071f},
-std::array<float,2>{0.539164364f, 0.270114571f},
-std::array<float,2>{0.111324735f, 0.662741125f},
-std::array<float,2>{0.350761712f, 0.245672315f},
-std::array<float,2>{0.775732756f, 0.963979602f},
-std::array<float,2>{0.895272195f, 0.000151772605f},
-std::array<float,2>{0.452964306f, 0.844847739f},
-std::array<float,2>{0.17439653f, 0.458151281f},
-std::array<float,2>{0.652185857f, 0.556771159f},
-std::array<float,2>{0.737710178f, 0.135084629f},
-std::array<float,2>{0.200502276f, 0.922922134f},
-std::array<float,2>{0.433854491f, 0.327828497f},
-std::array<float,2>{0.995546877f, 0.721668959f},
-std::array<float,2>{0.85242331f, 0.413227618f},
-std::array<float,2>{0.257173926f, 0.582140863f},
-std::array<float,2>{0.0614651851f, 0.0807431489f},
-std::array<float,2>{0.59092772f, 0.757447481f},
-std::array<float,2>{0.657114983f, 0.487346023f},
-std::array<float,2>{0.128936142f, 0.528603017f},
-std::array<float,2>{0.470851064f, 0.0478008762f},
-std::array<float,2>{0.913863301f, 0.83111006f},
-std::array<float,2>{0.800710618f, 0.20106566f},
-std::array<float,2>{0.31905961f, 0.994013131f},
-std::array<float,2>{0.0732672065f, 0.284023494f},
-std::array<float,2>{0.511419833f, 0.651743829f},
-std::array<float,2>{0.614750147f, 0.101805009f},
-std::array<float,2>{0.0261250753f, 0.805829942f},
-std::array<float,2>{0.29403311f, 0.397766888f},
-std::array<float,2>{0.84253037f, 0.612279117f},
-std::array<float,2>{0.946579635f, 0.35147512f},
-std::array<float,2>{0.393076271f, 0.712599039f},
-std::array<float,2>{0.243481189f, 0.177567273f},
-std::array<float,2>{0.712460876f, 0.891709268f},
-std::array<float,2>{0.507404864f, 0.464222878f},
-std::array<float,2>{0.0647001565f, 0.553449452f},
-std::array<float,2>{0.326422155f, 0.0130784409f},
-std::array<float,2>{0.811682165f, 0.858749807f},
-std::array<float,2>{0.916642189f, 0.237518862f},
-std::array<float,2>{0.479997993f, 0.953280866f},
-std::array<float,2>{0.136437312f, 0.274182558f},
-std::array<float,2>{0.671252906f, 0.666980982f},
-std::array<float,2>{0.7042014f, 0.0868797079f},
-std::array<float,2>{0.236585021f, 0.760582983f},
-std::array<float,2>{0.399349302f, 0.419254065f},
-std::array<float,2>{0.941630602f, 0.588457167f},
-std::array<float,2>{0.832153738f, 0.3172369f},
-std::array<float,2>{0.287481278f, 0.733018756f},
-std::array<float,2>{0.0225798376f, 0.131388605f},
-std::array<float,2>{0.617624283f, 0.930170655f},
-std::array<float,2>{0.644924939f, 0.292150974f},
-std::array<float,2>{0.180641353f, 0.642362297f},
-std::array<float,2>{0.444154859f, 0.193709403f},
-std::array<float,2>{0.901132524f, 0.989822745f},
-std::array<float,2>{0.769303143f, 0.061339546f},
-std::array<float,2>{0.356011212f, 0.839445293f},
-std::array<float,2>{0.117640503f, 0.498828441f},
-std::array<float,2>{0.536536932f, 0.521418631f},
-std::array<float,2>{0.58237803f, 0.18708159f},
-std::array<float,2>{0.0518271886f, 0.901481509f},
-std::array<float,2>{0.258995086f, 0.357997149f},
-std::array<float,2>{0.847113132f, 0.705524206f},
-std::array<float,2>{0.984419703f, 0.39930898f},
-std::array<float,2>{0.428010195f, 0.621514678f},
-std::array<float,2>{0.191670746f, 0.100652397f},
-std::array<float,2>{0.746839285f, 0.797632456f},
-std::array<float,2>{0.602747798f, 0.367547154f},
-std::array<float,2>{0.00734280143f, 0.69985038f},
-std::array<float,2>{0.299368262f, 0.164736018f},
-std::array<float,2>{0.814367652f, 0.876945853f},
-std::array<float,2>{0.960951447f, 0.123415887f},
-std::array<float,2>{0.378420591f, 0.78294611f},
-std::array<float,2>{0.232974842f, 0.384897411f},
-std::array<float,2>{0.701678336f, 0.607098043f},
-std::array<float,2>{0.676081955f, 0.208760858f},
-std::array<float,2>{0.149958059f, 0.978838563f},
-std::array<float,2>{0.493882686f, 0.301138669f},
-std::array<float,2>{0.922003925f, 0.62846446f},
-std::array<float,2>{0.783887386f, 0.481909245f},
-std::array<float,2>{0.341895252f, 0.509970248f},
-std::array<float,2>{0.0789177716f, 0.0461777225f},
-std::array<float,2>{0.51867944f, 0.818859637f},
-std::array<float,2>{0.725396156f, 0.429273784f},
-std::array<float,2>{0.204422399f, 0.567759097f},
-std::array<float,2>{0.414187133f, 0.0664982498f},
-std::array<float,2>{0.971498311f, 0.76978755f},
-std::array<float,2>{0.874214709f, 0.152042598f},
-std::array<float,2>{0.275306642f, 0.914330065f},
-std::array<float,2>{0.0381139293f, 0.328702718f},
-std::array<float,2>{0.577235222f, 0.745000243f},
-std::array<float,2>{0.550895214f, 0.0304870959f},
-std::array<float,2>{0.0978819653f, 0.868262231f},
-std::array<float,2>{0.363307446f, 0.442660034f},
-std::array<float,2>{0.754071474f, 0.531803012f},
-std::array<float,2>{0.877036154f, 0.2631464f},
-std::array<float,2>{0.456520975f, 0.679083705f},
-std::array<float,2>{0.167939723f, 0.219951883f},
-std::array<float,2>{0.63104409f, 0.952435315f},
-std::array<float,2>{0.559450567f, 0.414607257f},
-std::array<float,2>{0.106890403f, 0.592572987f},
-std::array<float,2>{0.367792428f, 0.090687722f},
-std::array<float,2>{0.760660291f, 0.765021026f},
-std::array<float,2>{0.887585223f, 0.125279859f},
-std::array<float,2>{0.464271843f, 0.933818817f},
-std::array<float,2>{0.156787828f, 0.314522743f},
-std::array<float,2>{0.634502411f, 0.730445027f},
-std::array<float,2>{0.729740143f, 0.00896586012f},
-std::array<float,2>{0.21747978f, 0.852646649f},
-std::array<float,2>{0.406378627f, 0.466029108f},
-std::array<float,2>{0.978716969f, 0.547644675f},
-std::array<float,2>{0.863113463f, 0.277849525f},
-std::array<float,2>{0.272138953f, 0.671672702f},
-std::array<float,2>{0.0418364182f, 0.240401611f},
-std::array<float,2>{0.569622636f, 0.95798856f},
-std::array<float,2>{0.679791451f, 0.353869081f},
-std::array<float,2>{0.143750548f, 0.710048616f},
-std::array<float,2>{0.486387163f, 0.182324484f},
-std::array<float,2>{0.931543291f, 0.90437746f},
-std::array<float,2>{0.791241467f, 0.0967433453f},
-std::array<float,2>{0.333959967f, 0.802183151f},
-std::array<float,2>{0.0874272585f, 0.402998924f},
-std::array<float,2>{0.524814367f, 0.620736122f},
-std::array<float,2>{0.600483418f, 0.190250158f},
-std::array<float,2>{0.00854232162f, 0.985071421f},
-std::array<float,2>{0.30878076f, 0.294989079f},
-std::array<float,2>{0.824301958f, 0.645441949f},
-std::array<float,2>{0.953487039f, 0.495662838f},
-std::array<float,2>{0.383524418f, 0.517416656f},
-std::array<float,2>{0.220034465f, 0.0559324063f},
-std::array<float,2>{0.693839252f, 0.843366742f},
-std::array<float,2>{0.588562071f, 0.300423741f},
-std::array<float,2>{0.0576728247f, 0.630497575f},
-std::array<float,2>{0.253208488f, 0.2035916f},
-std::array<float,2>{0.858703315f, 0.983874142f},
-std::array<float,2>{0.996661127f, 0.04007487f},
-std::array<float,2>{0.433337986f, 0.81414628f},
-std::array<float,2>{0.195647806f, 0.477969885f},
-std::array<float,2>{0.741104364f, 0.51379174f},
-std::array<float,2>{0.65545845f, 0.170478165f},
-std::array<float,2>{0.178370491f, 0.881491899f},
-std::array<float,2>{0.448795319f, 0.374859363f},
-std::array<float,2>{0.893351614f, 0.695509791f},
-std::array<float,2>{0.78014183f, 0.38984412f},
-std::array<float,2>{0.345668226f, 0.60257405f},
-std::array<float,2>{0.113408178f, 0.121073164f},
-std::array<float,2>{0.545266449f, 0.786696792f},
-std::array<float,2>{0.717338443f, 0.440898567f},
-std::array<float,2>{0.249936983f, 0.538326204f},
-std::array<float,2>{0.395471454f, 0.0250190608f},
-std::array<float,2>{0.949322045f, 0.872616112f},
-std::array<float,2>{0.836284399f, 0.223562703f},
-std::array<float,2>{0.290138245f, 0.946912825f},
-std::array<float,2>{0.0288044829f, 0.260735959f},
-std::array<float,2>{0.609676838f, 0.673648715f},
-std::array<float,2>{0.514654994f, 0.0655501187f},
-std::array<float,2>{0.0776172876f, 0.765738249f},
-std::array<float,2>{0.313811392f, 0.421988726f},
-std::array<float,2>{0.801540077f, 0.566034853f},
-std::array<float,2>{0.907485425f, 0.333391905f},
-std::array<float,2>{0.472775966f, 0.747605562f},
-std::array<float,2>{0.125120521f, 0.153750822f},
-std::array<float,2>{0.660387456f, 0.920615435f},
-std::array<float,2>{0.621918678f, 0.472912282f},
-std::array<float,2>{0.0184468906f, 0.503641069f},
-std::array<float,2>{0.283496767f, 0.0344290622f},
-std::array<float,2>{0.829258204f, 0.827561796f},
-std::array<float,2>{0.938824832f, 0.211749628f},
-std::array<float,2>{0.402416259f, 0.975245833f},
-std::array<float,2>{0.238702208f, 0.307778209f},
-std::array<float,2>{0.70911032f, 0.63985908f},
-std::array<float,2>{0.667855263f, 0.113566428f},
-std::array<float,2>{0.14001441f, 0.794611096f},
-std::array<float,2>{0.4811441f, 0.380034119f},
-std::array<float,2>{0.920270681f, 0.595358789f},
-std::array<float,2>{0.808140993f, 0.365686506f},
-std::array<float,2>{0.323214918f, 0.692926466f},
-std::array<float,2>{0.0701089576f, 0.163435996f},
-std::array<float,2>{0.503376961f, 0.886503816f},
-std::array<float,2>{0.744796157f, 0.250306368f},
-std::array<float,2>{0.190590024f, 0.684189081f},
-std::array<float,2>{0.423306435f, 0.227691367f},
-std::array<float,2>{0.988563657f, 0.945136905f},
-std::array<float,2>{0.849649727f, 0.0176304951f},
-std::array<float,2>{0.263586998f, 0.864697158f},
-std::array<float,2>{0.0504372418f, 0.452423424f},
-std::array<float,2>{0.579218507f, 0.544727862f},
-std::array<float,2>{0.53256315f, 0.141135052f},
-std::array<float,2>{0.121645898f, 0.906348407f},
-std::array<float,2>{0.354047507f, 0.342279822f},
-std::array<float,2>{0.772651732f, 0.736741483f},
-std::array<float,2>{0.903255463f, 0.433090478f},
-std::array<float,2>{0.439276397f, 0.576399505f},
-std::array<float,2>{0.184687287f, 0.071591042f},
-std::array<float,2>{0.641455591f, 0.780800521f},
-std::array<float,2>{0.521866739f, 0.322824836f},
-std::array<float,2>{0.082048811f, 0.723778367f},
-std::array<float,2>{0.339096755f, 0.139628544f},
-std::array<float,2>{0.788581848f, 0.928793609f},
-std::array<float,2>{0.928658128f, 0.0836902335f},
-std::array<float,2>{0.496364444f, 0.753717899f},
-std::array<float,2>{0.153379232f, 0.409251422f},
-std::array<float,2>{0.674438536f, 0.5819754f},
-std::array<float,2>{0.696546972f, 0.249248236f},
-std::array<float,2>{0.228672206f, 0.96772027f},
-std::array<float,2>{0.379319578f, 0.267314374f},
-std::array<float,2>{0.966707587f, 0.656816542f},
-std::array<float,2>{0.819099724f, 0.454376429f},
-std::array<float,2>{0.301943213f, 0.559795797f},
-std::array<float,2>{0.00206146995f, 0.00458236365f},
-std::array<float,2>{0.606886208f, 0.850607514f},
-std::array<float,2>{0.62530452f, 0.392590165f},
-std::array<float,2>{0.171609789f, 0.61485374f},
-std::array<float,2>{0.460220009f, 0.108631223f},
-std::array<float,2>{0.880529761f, 0.812190652f},
-std::array<float,2>{0.752178848f, 0.174626037f},
-std::array<float,2>{0.363149285f, 0.894679427f},
-std::array<float,2>{0.0956672505f, 0.345252186f},
-std::array<float,2>{0.547046483f, 0.714868546f},
-std::array<float,2>{0.57218188f, 0.0538142323f},
-std::array<float,2>{0.0325272717f, 0.832697153f},
-std::array<float,2>{0.280926108f, 0.488857478f},
-std::array<float,2>{0.869989276f, 0.526144266f},
-std::array<float,2>{0.974825382f, 0.286188245f},
-std::array<float,2>{0.421838343f, 0.655307353f},
-std::array<float,2>{0.210216269f, 0.198375076f},
-std::array<float,2>{0.722421467f, 0.99813962f},
-std::array<float,2>{0.603589058f, 0.38566798f},
-std::array<float,2>{0.00460223947f, 0.606708527f},
-std::array<float,2>{0.297124386f, 0.123893276f},
-std::array<float,2>{0.815021753f, 0.782604277f},
-std::array<float,2>{0.964133859f, 0.164075747f},
-std::array<float,2>{0.376568109f, 0.876087368f},
-std::array<float,2>{0.232271954f, 0.368063211f},
-std::array<float,2>{0.699836552f, 0.699579775f},
-std::array<float,2>{0.677953839f, 0.0464575179f},
-std::array<float,2>{0.150431395f, 0.818795919f},
-std::array<float,2>{0.495461047f, 0.48210454f},
-std::array<float,2>{0.925656796f, 0.510582566f},
-std::array<float,2>{0.781593442f, 0.301589519f},
-std::array<float,2>{0.340239674f, 0.628252745f},
-std::array<float,2>{0.0815159902f, 0.208234698f},
-std::array<float,2>{0.516846061f, 0.979379892f},
-std::array<float,2>{0.723232627f, 0.328447789f},
-std::array<float,2>{0.206435487f, 0.744601488f},
-std::array<float,2>{0.416364521f, 0.151441872f},
-std::array<float,2>{0.969507635f, 0.914966404f},
-std::array<float,2>{0.871803582f, 0.0669041649f},
-std::array<float,2>{0.275835037f, 0.770485044f},
-std::array<float,2>{0.0353101231f, 0.428852946f},
-std::array<float,2>{0.575100899f, 0.568098068f},
-std::array<float,2>{0.552903652f, 0.220489129f},
-std::array<float,2>{0.100542784f, 0.952900827f},
-std::array<float,2>{0.365845829f, 0.26358375f},
-std::array<float,2>{0.755975902f, 0.679287791f},
-std::array<float,2>{0.875065744f, 0.443161696f},
-std::array<float,2>{0.454416215f, 0.531271994f},
-std::array<float,2>{0.164943025f, 0.0308343656f},
-std::array<float,2>{0.628931522f, 0.868726373f},
-std::array<float,2>{0.504078567f, 0.273740768f},
-std::array<float,2>{0.0626572892f, 0.666384339f},
-std::array<float,2>{0.324832886f, 0.238246426f},
-std::array<float,2>{0.810000956f, 0.954025209f},
-std::array<float,2>{0.914968252f, 0.0134860184f},
-std::array<float,2>{0.477587402f, 0.859269857f},
-std::array<float,2>{0.133651882f, 0.464756221f},
-std::array<float,2>{0.668420196f, 0.553030193f},
-std::array<float,2>{0.706863463f, 0.130958289f},
-std::array<float,2>{0.235445842f, 0.930570722f},
-std::array<float,2>{0.401587248f, 0.316610605f},
-std::array<float,2>{0.943388999f, 0.732560396f},
-std::array<float,2>{0.834822774f, 0.419509888f},
-std::array<float,2>{0.285358787f, 0.588005841f},
-std::array<float,2>{0.0196800604f, 0.0863726512f},
-std::array<float,2>{0.620012939f, 0.759979904f},
-std::array<float,2>{0.647012353f, 0.498063922f},
-std::array<float,2>{0.181782469f, 0.520568907f},
-std::array<float,2>{0.44208461f, 0.0609244034f},
-std::array<float,2>{0.900237858f, 0.838894665f},
-std::array<float,2>{0.766045272f, 0.194184676f},
-std::array<float,2>{0.357551426f, 0.989561081f},
-std::array<float,2>{0.120464712f, 0.292543739f},
-std::array<float,2>{0.537240267f, 0.641852736f},
-std::array<float,2>{0.585665226f, 0.101158924f},
-std::array<float,2>{0.0537342876f, 0.797249734f},
-std::array<float,2>{0.261100531f, 0.398707896f},
-std::array<float,2>{0.844648838f, 0.621716022f},
-std::array<float,2>{0.988154054f, 0.357805908f},
-std::array<float,2>{0.426603705f, 0.705619872f},
-std::array<float,2>{0.193466276f, 0.186876863f},
-std::array<float,2>{0.748925149f, 0.902116179f},
-std::array<float,2>{0.542819917f, 0.458844453f},
-std::array<float,2>{0.111670561f, 0.557490766f},
-std::array<float,2>{0.347914577f, 0.000659871963f},
-std::array<float,2>{0.774509251f, 0.845421433f},
-std::array<float,2>{0.897537649f, 0.245202884f},
-std::array<float,2>{0.450862736f, 0.964782655f},
-std::array<float,2>{0.173306644f, 0.269537866f},
-std::array<float,2>{0.649556696f, 0.662300825f},
-std::array<float,2>{0.735763133f, 0.0801298916f},
-std::array<float,2>{0.201789573f, 0.757198811f},
-std::array<float,2>{0.436307341f, 0.413726568f},
-std::array<float,2>{0.993631184f, 0.582809746f},
-std::array<float,2>{0.85536021f, 0.327559561f},
-std::array<float,2>{0.254360527f, 0.72113055f},
-std::array<float,2>{0.0592425428f, 0.135698184f},
-std::array<float,2>{0.593374908f, 0.923424065f},
-std::array<float,2>{0.658939481f, 0.283644617f},
-std::array<float,2>{0.132561013f, 0.652008414f},
-std::array<float,2>{0.470356852f, 0.200471491f},
-std::array<float,2>{0.910898924f, 0.993488967f},
-std::array<float,2>{0.797706723f, 0.0472014286f},
-std::array<float,2>{0.316824108f, 0.831830442f},
-std::array<float,2>{0.0713553801f, 0.487848341f},
-std::array<float,2>{0.508187771f, 0.52910012f},
-std::array<float,2>{0.615939558f, 0.177239537f},
-std::array<float,2>{0.0240268409f, 0.892514527f},
-std::array<float,2>{0.295465857f, 0.351010799f},
-std::array<float,2>{0.840083599f, 0.712172747f},
-std::array<float,2>{0.948210239f, 0.398338169f},
-std::array<float,2>{0.391657352f, 0.611656129f},
-std::array<float,2>{0.244527549f, 0.102268562f},
-std::array<float,2>{0.713402331f, 0.806333065f},
-std::array<float,2>{0.563281f, 0.362688273f},
-std::array<float,2>{0.0461978018f, 0.6875723f},
-std::array<float,2>{0.269301832f, 0.159520894f},
-std::array<float,2>{0.865032554f, 0.890571773f},
-std::array<float,2>{0.981371224f, 0.109758861f},
-std::array<float,2>{0.412981212f, 0.789929152f},
-std::array<float,2>{0.21137929f, 0.375701278f},
-std::array<float,2>{0.733913124f, 0.59993583f},
-std::array<float,2>{0.639656305f, 0.217425704f},
-std::array<float,2>{0.163521022f, 0.970394969f},
-std::array<float,2>{0.46638754f, 0.309463143f},
-std::array<float,2>{0.885902643f, 0.635043502f},
-std::array<float,2>{0.76530081f, 0.469962627f},
-std::array<float,2>{0.374217629f, 0.506146133f},
-std::array<float,2>{0.1039434f, 0.0383257978f},
-std::array<float,2>{0.558003843f, 0.821899951f},
-std::array<float,2>{0.690312326f, 0.434397876f},
-std::array<float,2>{0.224596962f, 0.571938515f},
-std::array<float,2>{0.388677567f, 0.0757287443f},
-std::array<float,2>{0.957499325f, 0.776350677f},
-std::array<float,2>{0.820394158f, 0.145473287f},
-std::array<float,2>{0.306920528f, 0.913252532f},
-std::array<float,2>{0.0132600581f, 0.338704467f},
-std::array<float,2>{0.597598255f, 0.740536571f},
-std::array<float,2>{0.530601799f, 0.0228014421f},
-std::array<float,2>{0.0904421806f, 0.8600173f},
-std::array<float,2>{0.331258059f, 0.44835043f},
-std::array<float,2>{0.795667708f, 0.542602122f},
-std::array<float,2>{0.934831738f, 0.257631302f},
-std::array<float,2>{0.490721583f, 0.682639539f},
-std::array<float,2>{0.145005226f, 0.233338431f},
-std::array<float,2>{0.686099291f, 0.937504709f},
-std::array<float,2>{0.519780576f, 0.40973267f},
-std::array<float,2>{0.0857420713f, 0.581113696f},
-std::array<float,2>{0.337001413f, 0.0832976103f},
-std::array<float,2>{0.785743654f, 0.753175974f},
-std::array<float,2>{0.92596072f, 0.138996974f},
-std::array<float,2>{0.499788076f, 0.929568112f},
-std::array<float,2>{0.154791549f, 0.322452277f},
-std::array<float,2>{0.673209012f, 0.724184752f},
-std::array<float,2>{0.698597133f, 0.00402730843f},
-std::array<float,2>{0.22808677f, 0.851132929f},
-std::array<float,2>{0.381775528f, 0.454679847f},
-std::array<float,2>{0.967300713f, 0.560344279f},
-std::array<float,2>{0.816504836f, 0.266951114f},
-std::array<float,2>{0.30347386f, 0.65655297f},
-std::array<float,2>{0.00160627952f, 0.249602407f},
-std::array<float,2>{0.608729541f, 0.967225909f},
-std::array<float,2>{0.627715051f, 0.344887227f},
-std::array<float,2>{0.168094754f, 0.71580869f},
-std::array<float,2>{0.457162887f, 0.174104854f},
-std::array<float,2>{0.88200134f, 0.89546901f},
-std::array<float,2>{0.750679314f, 0.109300867f},
-std::array<float,2>{0.360100716f, 0.812005818f},
-std::array<float,2>{0.0966173559f, 0.393427402f},
-std::array<float,2>{0.550513804f, 0.614542425f},
-std::array<float,2>{0.572804987f, 0.19899042f},
-std::array<float,2>{0.0332949013f, 0.999016762f},
-std::array<float,2>{0.277427226f, 0.286706597f},
-std::array<float,2>{0.867716074f, 0.65598911f},
-std::array<float,2>{0.974021316f, 0.488355368f},
-std::array<float,2>{0.418538988f, 0.525450706f},
-std::array<float,2>{0.207245171f, 0.0544093996f},
-std::array<float,2>{0.719618857f, 0.83212316f},
-std::array<float,2>{0.624118686f, 0.308531553f},
-std::array<float,2>{0.0160979964f, 0.640374541f},
-std::array<float,2>{0.282253176f, 0.211209148f},
-std::array<float,2>{0.830162883f, 0.974753022f},
-std::array<float,2>{0.940581977f, 0.0348004401f},
-std::array<float,2>{0.405069292f, 0.827880323f},
-std::array<float,2>{0.241547123f, 0.473598599f},
-std::array<float,2>{0.70877856f, 0.503082395f},
-std::array<float,2>{0.664167285f, 0.163908467f},
-std::array<float,2>{0.137291953f, 0.885842979f},
-std::array<float,2>{0.483991027f, 0.365904152f},
-std::array<float,2>{0.919728994f, 0.692715049f},
-std::array<float,2>{0.805330217f, 0.380796432f},
-std::array<float,2>{0.32065767f, 0.594739616f},
-std::array<float,2>{0.0666197389f, 0.114027113f},
-std::array<float,2>{0.5011518f, 0.793956101f},
-std::array<float,2>{0.744031966f, 0.452778667f},
-std::array<float,2>{0.189451322f, 0.544132888f},
-std::array<float,2>{0.425162584f, 0.0185451005f},
-std::array<float,2>{0.991709471f, 0.864859045f},
-std::array<float,2>{0.848997533f, 0.228240579f},
-std::array<float,2>{0.264187396f, 0.944413304f},
-std::array<float,2>{0.0471770763f, 0.250519454f},
-std::array<float,2>{0.580309272f, 0.683680832f},
-std::array<float,2>{0.534770072f, 0.0720032603f},
-std::array<float,2>{0.12495248f, 0.78029269f},
-std::array<float,2>{0.352359802f, 0.433376044f},
-std::array<float,2>{0.771050036f, 0.576883316f},
-std::array<float,2>{0.904863477f, 0.342621326f},
-std::array<float,2>{0.441257119f, 0.737296283f},
-std::array<float,2>{0.185590565f, 0.14107348f},
-std::array<float,2>{0.642724693f, 0.906778038f},
-std::array<float,2>{0.587822676f, 0.478203088f},
-std::array<float,2>{0.0562961102f, 0.514336586f},
-std::array<float,2>{0.251853079f, 0.0409257784f},
-std::array<float,2>{0.855562091f, 0.813506365f},
-std::array<float,2>{0.998481095f, 0.203775212f},
-std::array<float,2>{0.430531949f, 0.984295249f},
-std::array<float,2>{0.197394982f, 0.300170928f},
-std::array<float,2>{0.740078688f, 0.630055904f},
-std::array<float,2>{0.652514398f, 0.12040931f},
-std::array<float,2>{0.176928833f, 0.786460578f},
-std::array<float,2>{0.446628809f, 0.390271991f},
-std::array<float,2>{0.891441405f, 0.603452861f},
-std::array<float,2>{0.779121935f, 0.374088287f},
-std::array<float,2>{0.345893145f, 0.696099102f},
-std::array<float,2>{0.117088847f, 0.170304462f},
-std::array<float,2>{0.544333756f, 0.881261885f},
-std::array<float,2>{0.715017915f, 0.259785771f},
-std::array<float,2>{0.246608913f, 0.673032224f},
-std::array<float,2>{0.397813559f, 0.222897843f},
-std::array<float,2>{0.953077257f, 0.946396768f},
-std::array<float,2>{0.838925898f, 0.0247362945f},
-std::array<float,2>{0.291450471f, 0.872386515f},
-std::array<float,2>{0.0303969868f, 0.440999985f},
-std::array<float,2>{0.612773836f, 0.538612127f},
-std::array<float,2>{0.513339639f, 0.153907448f},
-std::array<float,2>{0.0746037066f, 0.920051873f},
-std::array<float,2>{0.314838231f, 0.333970904f},
-std::array<float,2>{0.804243743f, 0.747451186f},
-std::array<float,2>{0.909253359f, 0.422649711f},
-std::array<float,2>{0.476544619f, 0.565697193f},
-std::array<float,2>{0.1287525f, 0.0660405904f},
-std::array<float,2>{0.663353622f, 0.766301572f},
-std::array<float,2>{0.560691714f, 0.315361351f},
-std::array<float,2>{0.107821949f, 0.729561269f},
-std::array<float,2>{0.369726241f, 0.125811055f},
-std::array<float,2>{0.757983088f, 0.934243143f},
-std::array<float,2>{0.888822734f, 0.0902400315f},
-std::array<float,2>{0.462287605f, 0.765352488f},
-std::array<float,2>{0.158664107f, 0.41413936f},
-std::array<float,2>{0.634939015f, 0.592079461f},
-std::array<float,2>{0.728477597f, 0.241051078f},
-std::array<float,2>{0.215105444f, 0.957258523f},
-std::array<float,2>{0.40950194f, 0.277367055f},
-std::array<float,2>{0.977894485f, 0.671309352f},
-std::array<float,2>{0.860571265f, 0.466708988f},
-std::array<float,2>{0.270360738f, 0.5471071f},
-std::array<float,2>{0.0405012704f, 0.00965689309f},
-std::array<float,2>{0.56769526f, 0.853322089f},
-std::array<float,2>{0.682703376f, 0.402529538f},
-std::array<float,2>{0.141366348f, 0.62014842f},
-std::array<float,2>{0.485833347f, 0.097613655f},
-std::array<float,2>{0.932013571f, 0.802478611f},
-std::array<float,2>{0.789704144f, 0.181809321f},
-std::array<float,2>{0.335355759f, 0.9052701f},
-std::array<float,2>{0.0892800838f, 0.354064852f},
-std::array<float,2>{0.527194798f, 0.710503042f},
-std::array<float,2>{0.598834038f, 0.0565659255f},
-std::array<float,2>{0.0113735935f, 0.842805982f},
-std::array<float,2>{0.310738683f, 0.49513191f},
-std::array<float,2>{0.827198505f, 0.516730249f},
-std::array<float,2>{0.95625937f, 0.295647323f},
-std::array<float,2>{0.385657758f, 0.644861519f},
-std::array<float,2>{0.221096173f, 0.189531535f},
-std::array<float,2>{0.692609906f, 0.984444559f},
-std::array<float,2>{0.577735782f, 0.42610845f},
-std::array<float,2>{0.0388382897f, 0.568624616f},
-std::array<float,2>{0.274563104f, 0.0692048818f},
-std::array<float,2>{0.874667585f, 0.772077203f},
-std::array<float,2>{0.970945477f, 0.149291739f},
-std::array<float,2>{0.414714664f, 0.917420328f},
-std::array<float,2>{0.204609036f, 0.331755251f},
-std::array<float,2>{0.725056946f, 0.744134188f},
-std::array<float,2>{0.631675839f, 0.0285024308f},
-std::array<float,2>{0.167432055f, 0.869222283f},
-std::array<float,2>{0.456802726f, 0.444102257f},
-std::array<float,2>{0.877895057f, 0.533373594f},
-std::array<float,2>{0.754682958f, 0.265302122f},
-std::array<float,2>{0.363891393f, 0.677647531f},
-std::array<float,2>{0.0986052528f, 0.221766129f},
-std::array<float,2>{0.551690161f, 0.949626505f},
-std::array<float,2>{0.701536655f, 0.36951828f},
-std::array<float,2>{0.232532158f, 0.702709019f},
-std::array<float,2>{0.37816f, 0.16636087f},
-std::array<float,2>{0.961623192f, 0.877820551f},
-std::array<float,2>{0.813714623f, 0.122632496f},
-std::array<float,2>{0.299262017f, 0.783501267f},
-std::array<float,2>{0.00686012628f, 0.382945955f},
-std::array<float,2>{0.603278995f, 0.607645392f},
-std::array<float,2>{0.519179285f, 0.210784405f},
-std::array<float,2>{0.0782838836f, 0.97832042f},
-std::array<float,2>{0.342344791f, 0.304584593f},
-std::array<float,2>{0.783309698f, 0.625002742f},
-std::array<float,2>{0.92279017f, 0.482689142f},
-std::array<float,2>{0.493531913f, 0.509340107f},
-std::array<float,2>{0.14972876f, 0.0435094349f},
-std::array<float,2>{0.676288188f, 0.81734091f},
-std::array<float,2>{0.537020326f, 0.290463001f},
-std::array<float,2>{0.118001021f, 0.644312739f},
-std::array<float,2>{0.355760992f, 0.191736788f},
-std::array<float,2>{0.768846512f, 0.990369081f},
-std::array<float,2>{0.900797307f, 0.0586777776f},
-std::array<float,2>{0.443395168f, 0.836631835f},
-std::array<float,2>{0.180030435f, 0.497054487f},
-std::array<float,2>{0.645178735f, 0.522303104f},
-std::array<float,2>{0.74617058f, 0.184208021f},
-std::array<float,2>{0.192223728f, 0.898655474f},
-std::array<float,2>{0.428568423f, 0.356312841f},
-std::array<float,2>{0.985194027f, 0.703197718f},
-std::array<float,2>{0.847543061f, 0.402007312f},
-std::array<float,2>{0.259431005f, 0.624011338f},
-std::array<float,2>{0.052320946f, 0.0983494744f},
-std::array<float,2>{0.58300674f, 0.799148738f},
-std::array<float,2>{0.671655893f, 0.461798906f},
-std::array<float,2>{0.135837719f, 0.552511454f},
-std::array<float,2>{0.479500592f, 0.0137431249f},
-std::array<float,2>{0.916068137f, 0.856784523f},
-std::array<float,2>{0.812487185f, 0.235138893f},
-std::array<float,2>{0.326702923f, 0.956100881f},
-std::array<float,2>{0.0653869882f, 0.275745898f},
-std::array<float,2>{0.506972671f, 0.665554762f},
-std::array<float,2>{0.61777544f, 0.0879565775f},
-std::array<float,2>{0.0233237091f, 0.759328187f},
-std::array<float,2>{0.287861466f, 0.420369476f},
-std::array<float,2>{0.832888663f, 0.586644351f},
-std::array<float,2>{0.941994309f, 0.318877399f},
-std::array<float,2>{0.398697793f, 0.731972039f},
-std::array<float,2>{0.237211064f, 0.130580842f},
-std::array<float,2>{0.704750657f, 0.932696819f},
-std::array<float,2>{0.510847092f, 0.484612882f},
-std::array<float,2>{0.0742015764f, 0.529401183f},
-std::array<float,2>{0.31864363f, 0.0495069362f},
-std::array<float,2>{0.8001284f, 0.829261005f},
-std::array<float,2>{0.91330725f, 0.20119594f},
-std::array<float,2>{0.471456498f, 0.995213032f},
-std::array<float,2>{0.129771352f, 0.282967746f},
-std::array<float,2>{0.656524241f, 0.649298251f},
-std::array<float,2>{0.712296605f, 0.104244933f},
-std::array<float,2>{0.244000524f, 0.807191253f},
-std::array<float,2>{0.392864794f, 0.395959288f},
-std::array<float,2>{0.946947992f, 0.610108197f},
-std::array<float,2>{0.842243314f, 0.34825477f},
-std::array<float,2>{0.294908375f, 0.714486182f},
-std::array<float,2>{0.0254770219f, 0.177768901f},
-std::array<float,2>{0.61473912f, 0.893632889f},
-std::array<float,2>{0.651800931f, 0.272582531f},
-std::array<float,2>{0.17393446f, 0.660906255f},
-std::array<float,2>{0.452470422f, 0.242648736f},
-std::array<float,2>{0.894842982f, 0.962645292f},
-std::array<float,2>{0.775955915f, 0.00259894738f},
-std::array<float,2>{0.351368576f, 0.846179366f},
-std::array<float,2>{0.110661872f, 0.460462034f},
-std::array<float,2>{0.539928079f, 0.554861009f},
-std::array<float,2>{0.591735005f, 0.133498028f},
-std::array<float,2>{0.0606691726f, 0.925495565f},
-std::array<float,2>{0.257673681f, 0.325355947f},
-std::array<float,2>{0.851648331f, 0.718833029f},
-std::array<float,2>{0.995998085f, 0.411964327f},
-std::array<float,2>{0.434231699f, 0.58399719f},
-std::array<float,2>{0.20069173f, 0.0793486312f},
-std::array<float,2>{0.738015711f, 0.754031777f},
-std::array<float,2>{0.595070958f, 0.336458087f},
-std::array<float,2>{0.0144374128f, 0.739966512f},
-std::array<float,2>{0.306640208f, 0.146647111f},
-std::array<float,2>{0.822724938f, 0.910789609f},
-std::array<float,2>{0.959463716f, 0.0775626153f},
-std::array<float,2>{0.387811452f, 0.774710417f},
-std::array<float,2>{0.225883439f, 0.435714513f},
-std::array<float,2>{0.68850559f, 0.573355734f},
-std::array<float,2>{0.685055733f, 0.231251806f},
-std::array<float,2>{0.14710474f, 0.939951718f},
-std::array<float,2>{0.48913601f, 0.254299074f},
-std::array<float,2>{0.93719089f, 0.68020308f},
-std::array<float,2>{0.794901431f, 0.446375668f},
-std::array<float,2>{0.329627544f, 0.540236473f},
-std::array<float,2>{0.0924005508f, 0.0206845272f},
-std::array<float,2>{0.528546274f, 0.862274766f},
-std::array<float,2>{0.731759667f, 0.378649026f},
-std::array<float,2>{0.213313684f, 0.598762929f},
-std::array<float,2>{0.411017627f, 0.112036824f},
-std::array<float,2>{0.98367244f, 0.7929371f},
-std::array<float,2>{0.865268826f, 0.157441437f},
-std::array<float,2>{0.266420752f, 0.888009369f},
-std::array<float,2>{0.0432936288f, 0.359562725f},
-std::array<float,2>{0.566052914f, 0.689499974f},
-std::array<float,2>{0.555018485f, 0.0368327163f},
-std::array<float,2>{0.103256583f, 0.822859287f},
-std::array<float,2>{0.3730416f, 0.471678495f},
-std::array<float,2>{0.762911975f, 0.504184604f},
-std::array<float,2>{0.883935332f, 0.311699241f},
-std::array<float,2>{0.467270225f, 0.633011818f},
-std::array<float,2>{0.161454916f, 0.215769112f},
-std::array<float,2>{0.63794893f, 0.972036839f},
-std::array<float,2>{0.547842383f, 0.391930282f},
-std::array<float,2>{0.095137082f, 0.6156708f},
-std::array<float,2>{0.362364918f, 0.10591758f},
-std::array<float,2>{0.752638519f, 0.809244931f},
-std::array<float,2>{0.879885554f, 0.173352778f},
-std::array<float,2>{0.460798532f, 0.898186624f},
-std::array<float,2>{0.170990229f, 0.347012907f},
-std::array<float,2>{0.625743568f, 0.7170645f},
-std::array<float,2>{0.721981525f, 0.0510217249f},
-std::array<float,2>{0.210743725f, 0.835747302f},
-std::array<float,2>{0.421096832f, 0.4906542f},
-std::array<float,2>{0.975554705f, 0.52395153f},
-std::array<float,2>{0.869299769f, 0.289031178f},
-std::array<float,2>{0.280368865f, 0.654248357f},
-std::array<float,2>{0.0327314883f, 0.195713893f},
-std::array<float,2>{0.571756124f, 0.99676621f},
-std::array<float,2>{0.67424041f, 0.320823461f},
-std::array<float,2>{0.154135883f, 0.725809455f},
-std::array<float,2>{0.496957362f, 0.137975827f},
-std::array<float,2>{0.928119838f, 0.927705467f},
-std::array<float,2>{0.788259864f, 0.0851773322f},
-std::array<float,2>{0.339528799f, 0.751654863f},
-std::array<float,2>{0.0825280249f, 0.408009857f},
-std::array<float,2>{0.521979392f, 0.578571498f},
-std::array<float,2>{0.607143044f, 0.246516511f},
-std::array<float,2>{0.00246028951f, 0.965825319f},
-std::array<float,2>{0.30227983f, 0.268353552f},
-std::array<float,2>{0.818805873f, 0.658864737f},
-std::array<float,2>{0.966057122f, 0.456610084f},
-std::array<float,2>{0.379857004f, 0.560745299f},
-std::array<float,2>{0.229232699f, 0.00734768854f},
-std::array<float,2>{0.696801782f, 0.84893918f},
-std::array<float,2>{0.579621434f, 0.25361526f},
-std::array<float,2>{0.0498709939f, 0.686664045f},
-std::array<float,2>{0.262956142f, 0.228552192f},
-std::array<float,2>{0.850526571f, 0.942934036f},
-std::array<float,2>{0.989122868f, 0.0171828195f},
-std::array<float,2>{0.423723429f, 0.866695642f},
-std::array<float,2>{0.191213384f, 0.449426204f},
-std::array<float,2>{0.744522691f, 0.546174824f},
-std::array<float,2>{0.640870869f, 0.142913282f},
-std::array<float,2>{0.18515256f, 0.909416556f},
-std::array<float,2>{0.438781023f, 0.340788245f},
-std::array<float,2>{0.90265727f, 0.73615849f},
-std::array<float,2>{0.773386538f, 0.430386394f},
-std::array<float,2>{0.353693068f, 0.574843764f},
-std::array<float,2>{0.121307835f, 0.0739364251f},
-std::array<float,2>{0.532828152f, 0.778151572f},
-std::array<float,2>{0.709750116f, 0.476244301f},
-std::array<float,2>{0.239047065f, 0.500433207f},
-std::array<float,2>{0.402885854f, 0.0312736481f},
-std::array<float,2>{0.939106464f, 0.824708402f},
-std::array<float,2>{0.829649985f, 0.213309601f},
-std::array<float,2>{0.283759117f, 0.974025786f},
-std::array<float,2>{0.0180644672f, 0.305279583f},
-std::array<float,2>{0.621323705f, 0.637742639f},
-std::array<float,2>{0.503817499f, 0.115954272f},
-std::array<float,2>{0.0695458502f, 0.795950174f},
-std::array<float,2>{0.322329998f, 0.381509304f},
-std::array<float,2>{0.807931662f, 0.596608043f},
-std::array<float,2>{0.920828581f, 0.364341319f},
-std::array<float,2>{0.480575264f, 0.693380594f},
-std::array<float,2>{0.140344575f, 0.161762238f},
-std::array<float,2>{0.667303741f, 0.883809924f},
-std::array<float,2>{0.610111773f, 0.438456565f},
-std::array<float,2>{0.0290851947f, 0.536307633f},
-std::array<float,2>{0.290920258f, 0.0266661663f},
-std::array<float,2>{0.836670935f, 0.874680638f},
-std::array<float,2>{0.950074255f, 0.224836811f},
-std::array<float,2>{0.394669443f, 0.948583007f},
-std::array<float,2>{0.249483436f, 0.258212566f},
-std::array<float,2>{0.717121124f, 0.674319565f},
-std::array<float,2>{0.661099792f, 0.0632126555f},
-std::array<float,2>{0.125903681f, 0.767804086f},
-std::array<float,2>{0.473269999f, 0.425298214f},
-std::array<float,2>{0.907902598f, 0.563385963f},
-std::array<float,2>{0.800854802f, 0.334617198f},
-std::array<float,2>{0.314435095f, 0.748977482f},
-std::array<float,2>{0.0779989809f, 0.155500323f},
-std::array<float,2>{0.515217423f, 0.918096721f},
-std::array<float,2>{0.740718365f, 0.297173977f},
-std::array<float,2>{0.195921808f, 0.630861938f},
-std::array<float,2>{0.432856917f, 0.206241354f},
-std::array<float,2>{0.996232867f, 0.981448889f},
-std::array<float,2>{0.858966112f, 0.0413635075f},
-std::array<float,2>{0.253467172f, 0.815528989f},
-std::array<float,2>{0.0583340488f, 0.479671866f},
-std::array<float,2>{0.588127017f, 0.5118016f},
-std::array<float,2>{0.545491695f, 0.168633625f},
-std::array<float,2>{0.113839164f, 0.880467176f},
-std::array<float,2>{0.344741434f, 0.371993244f},
-std::array<float,2>{0.779633462f, 0.697313309f},
-std::array<float,2>{0.893007159f, 0.388554871f},
-std::array<float,2>{0.448254138f, 0.604496181f},
-std::array<float,2>{0.177860469f, 0.118508317f},
-std::array<float,2>{0.656023204f, 0.787472427f},
-std::array<float,2>{0.524948478f, 0.353080362f},
-std::array<float,2>{0.0869790614f, 0.707437873f},
-std::array<float,2>{0.333402932f, 0.180738702f},
-std::array<float,2>{0.791939735f, 0.903195739f},
-std::array<float,2>{0.931104004f, 0.0942458138f},
-std::array<float,2>{0.487179548f, 0.804255664f},
-std::array<float,2>{0.144462198f, 0.404734671f},
-std::array<float,2>{0.680438519f, 0.618109167f},
-std::array<float,2>{0.694072783f, 0.188082278f},
-std::array<float,2>{0.220350653f, 0.987109363f},
-std::array<float,2>{0.383074969f, 0.294076115f},
-std::array<float,2>{0.953639269f, 0.648192227f},
-std::array<float,2>{0.825186729f, 0.492939174f},
-std::array<float,2>{0.30915609f, 0.519174933f},
-std::array<float,2>{0.00804256741f, 0.0570003353f},
-std::array<float,2>{0.599771559f, 0.84107691f},
-std::array<float,2>{0.634187162f, 0.417523682f},
-std::array<float,2>{0.156515241f, 0.589966774f},
-std::array<float,2>{0.464410394f, 0.0928034633f},
-std::array<float,2>{0.887177467f, 0.763574898f},
-std::array<float,2>{0.760091126f, 0.127199084f},
-std::array<float,2>{0.36736837f, 0.937340379f},
-std::array<float,2>{0.107323386f, 0.314149112f},
-std::array<float,2>{0.559001863f, 0.728357971f},
-std::array<float,2>{0.5700019f, 0.0115750646f},
-std::array<float,2>{0.0411555246f, 0.855241835f},
-std::array<float,2>{0.271705717f, 0.468674421f},
-std::array<float,2>{0.862336099f, 0.549958825f},
-std::array<float,2>{0.979472816f, 0.279945821f},
-std::array<float,2>{0.406967938f, 0.668734074f},
-std::array<float,2>{0.216968969f, 0.239196673f},
-std::array<float,2>{0.730343401f, 0.95902276f},
-std::array<float,2>{0.620484114f, 0.421529979f},
-std::array<float,2>{0.0210679993f, 0.587262213f},
-std::array<float,2>{0.286179274f, 0.0890316144f},
-std::array<float,2>{0.835606754f, 0.758440256f},
-std::array<float,2>{0.944631398f, 0.128991485f},
-std::array<float,2>{0.401348561f, 0.932492018f},
-std::array<float,2>{0.234736383f, 0.319829613f},
-std::array<float,2>{0.705907762f, 0.73098278f},
-std::array<float,2>{0.66904068f, 0.0153665571f},
-std::array<float,2>{0.133908957f, 0.855792463f},
-std::array<float,2>{0.477308303f, 0.462217867f},
-std::array<float,2>{0.915815651f, 0.550824463f},
-std::array<float,2>{0.809450328f, 0.276415139f},
-std::array<float,2>{0.325715452f, 0.664755046f},
-std::array<float,2>{0.0639722496f, 0.236081034f},
-std::array<float,2>{0.505402803f, 0.955287099f},
-std::array<float,2>{0.749231815f, 0.356940061f},
-std::array<float,2>{0.194507867f, 0.704492092f},
-std::array<float,2>{0.42753467f, 0.184946671f},
-std::array<float,2>{0.986328363f, 0.900147557f},
-std::array<float,2>{0.845288157f, 0.0990218893f},
-std::array<float,2>{0.260507792f, 0.800615847f},
-std::array<float,2>{0.0536602661f, 0.400953174f},
-std::array<float,2>{0.584764659f, 0.624465406f},
-std::array<float,2>{0.538987339f, 0.192563698f},
-std::array<float,2>{0.119571999f, 0.991383255f},
-std::array<float,2>{0.358682275f, 0.289710283f},
-std::array<float,2>{0.766923189f, 0.642618179f},
-std::array<float,2>{0.898691773f, 0.498021901f},
-std::array<float,2>{0.443086982f, 0.522947133f},
-std::array<float,2>{0.18302235f, 0.0604452901f},
-std::array<float,2>{0.648229361f, 0.836932659f},
-std::array<float,2>{0.516153812f, 0.303176612f},
-std::array<float,2>{0.0804384574f, 0.626864016f},
-std::array<float,2>{0.341733634f, 0.209744915f},
-std::array<float,2>{0.782989502f, 0.977074564f},
-std::array<float,2>{0.924366891f, 0.0442047454f},
-std::array<float,2>{0.494594038f, 0.818046689f},
-std::array<float,2>{0.152258873f, 0.484078079f},
-std::array<float,2>{0.67933315f, 0.507962286f},
-std::array<float,2>{0.7007128f, 0.167234272f},
-std::array<float,2>{0.230815604f, 0.878756046f},
-std::array<float,2>{0.375557065f, 0.371014953f},
-std::array<float,2>{0.963471115f, 0.702017903f},
-std::array<float,2>{0.815544605f, 0.383976609f},
-std::array<float,2>{0.298155189f, 0.609176219f},
-std::array<float,2>{0.00564097008f, 0.121523306f},
-std::array<float,2>{0.605243504f, 0.784326971f},
-std::array<float,2>{0.630001664f, 0.444679379f},
-std::array<float,2>{0.165813938f, 0.534885526f},
-std::array<float,2>{0.453306168f, 0.0275899302f},
-std::array<float,2>{0.876421094f, 0.870313942f},
-std::array<float,2>{0.757652938f, 0.221291631f},
-std::array<float,2>{0.366332233f, 0.9502514f},
-std::array<float,2>{0.100766309f, 0.263956368f},
-std::array<float,2>{0.554473937f, 0.676362813f},
-std::array<float,2>{0.575511634f, 0.0700179413f},
-std::array<float,2>{0.0364301093f, 0.77254039f},
-std::array<float,2>{0.276645631f, 0.427517295f},
-std::array<float,2>{0.872548521f, 0.57015717f},
-std::array<float,2>{0.969920814f, 0.330699772f},
-std::array<float,2>{0.417228937f, 0.742244542f},
-std::array<float,2>{0.205907419f, 0.149563134f},
-std::array<float,2>{0.723840594f, 0.916529834f},
-std::array<float,2>{0.557184517f, 0.471715391f},
-std::array<float,2>{0.104780167f, 0.50502944f},
-std::array<float,2>{0.373065799f, 0.0358591005f},
-std::array<float,2>{0.76448828f, 0.823420107f},
-std::array<float,2>{0.885150671f, 0.216656521f},
-std::array<float,2>{0.465008885f, 0.971099973f},
-std::array<float,2>{0.162702516f, 0.311460018f},
-std::array<float,2>{0.639293909f, 0.633824646f},
-std::array<float,2>{0.732733309f, 0.112607487f},
-std::array<float,2>{0.212466076f, 0.791017592f},
-std::array<float,2>{0.413478553f, 0.377717674f},
-std::array<float,2>{0.981587231f, 0.59857887f},
-std::array<float,2>{0.863691211f, 0.361173749f},
-std::array<float,2>{0.268130392f, 0.691252232f},
-std::array<float,2>{0.0454706252f, 0.156389207f},
-std::array<float,2>{0.563660026f, 0.887319624f},
-std::array<float,2>{0.686891377f, 0.255022854f},
-std::array<float,2>{0.145885333f, 0.68089515f},
-std::array<float,2>{0.491546303f, 0.231929913f},
-std::array<float,2>{0.934229851f, 0.940519452f},
-std::array<float,2>{0.796153784f, 0.0202482957f},
-std::array<float,2>{0.330865979f, 0.862730503f},
-std::array<float,2>{0.0916872323f, 0.446141839f},
-std::array<float,2>{0.530114949f, 0.539634943f},
-std::array<float,2>{0.596551061f, 0.148379907f},
-std::array<float,2>{0.0122747766f, 0.911448002f},
-std::array<float,2>{0.308229923f, 0.33732596f},
-std::array<float,2>{0.821649551f, 0.739010394f},
-std::array<float,2>{0.958356857f, 0.437033862f},
-std::array<float,2>{0.390456438f, 0.572393239f},
-std::array<float,2>{0.222730845f, 0.0766814649f},
-std::array<float,2>{0.691352785f, 0.773716331f},
-std::array<float,2>{0.592452466f, 0.3242383f},
-std::array<float,2>{0.0599610768f, 0.720231831f},
-std::array<float,2>{0.255786866f, 0.134687185f},
-std::array<float,2>{0.85418427f, 0.924538374f},
-std::array<float,2>{0.992511451f, 0.0786600485f},
-std::array<float,2>{0.437181771f, 0.755719423f},
-std::array<float,2>{0.202281415f, 0.410978019f},
-std::array<float,2>{0.734808564f, 0.585843861f},
-std::array<float,2>{0.649146318f, 0.243816555f},
-std::array<float,2>{0.172470346f, 0.961619735f},
-std::array<float,2>{0.449981511f, 0.271639705f},
-std::array<float,2>{0.897281826f, 0.662023783f},
-std::array<float,2>{0.773454428f, 0.459692001f},
-std::array<float,2>{0.34928447f, 0.556492209f},
-std::array<float,2>{0.112566091f, 0.00306799589f},
-std::array<float,2>{0.541917861f, 0.846987128f},
-std::array<float,2>{0.714715183f, 0.395255744f},
-std::array<float,2>{0.245503977f, 0.611204088f},
-std::array<float,2>{0.391219139f, 0.104928471f},
-std::array<float,2>{0.949145973f, 0.80779922f},
-std::array<float,2>{0.841185093f, 0.179649621f},
-std::array<float,2>{0.296306789f, 0.893038869f},
-std::array<float,2>{0.0248481855f, 0.34900111f},
-std::array<float,2>{0.616293132f, 0.713855624f},
-std::array<float,2>{0.509304285f, 0.0502711982f},
-std::array<float,2>{0.0706493855f, 0.828404725f},
-std::array<float,2>{0.317994058f, 0.486222714f},
-std::array<float,2>{0.798301339f, 0.530589759f},
-std::array<float,2>{0.911253452f, 0.281283826f},
-std::array<float,2>{0.469379425f, 0.650061667f},
-std::array<float,2>{0.131422505f, 0.20228824f},
-std::array<float,2>{0.660071254f, 0.994894803f},
-std::array<float,2>{0.500379264f, 0.382454008f},
-std::array<float,2>{0.0680272728f, 0.596758842f},
-std::array<float,2>{0.321619093f, 0.116540581f},
-std::array<float,2>{0.806273699f, 0.795165718f},
-std::array<float,2>{0.917975903f, 0.160212055f},
-std::array<float,2>{0.48333779f, 0.883319497f},
-std::array<float,2>{0.138138175f, 0.363745898f},
-std::array<float,2>{0.66596508f, 0.694776356f},
-std::array<float,2>{0.707852125f, 0.0331636779f},
-std::array<float,2>{0.240971178f, 0.825703621f},
-std::array<float,2>{0.406065315f, 0.475141466f},
-std::array<float,2>{0.939830482f, 0.501669407f},
-std::array<float,2>{0.831153154f, 0.306196153f},
-std::array<float,2>{0.28173247f, 0.636836648f},
-std::array<float,2>{0.0174176451f, 0.214198485f},
-std::array<float,2>{0.623301744f, 0.97361356f},
-std::array<float,2>{0.644217014f, 0.341619581f},
-std::array<float,2>{0.186851829f, 0.734425843f},
-std::array<float,2>{0.439696997f, 0.144057646f},
-std::array<float,2>{0.905282438f, 0.908756256f},
-std::array<float,2>{0.770279586f, 0.0723545775f},
-std::array<float,2>{0.352956951f, 0.778631091f},
-std::array<float,2>{0.123612031f, 0.431278408f},
-std::array<float,2>{0.534171283f, 0.575571179f},
-std::array<float,2>{0.581813276f, 0.23031427f},
-std::array<float,2>{0.0482654162f, 0.941743791f},
-std::array<float,2>{0.265085727f, 0.252366781f},
-std::array<float,2>{0.848413527f, 0.686505914f},
-std::array<float,2>{0.99031657f, 0.450962901f},
-std::array<float,2>{0.424492389f, 0.545665324f},
-std::array<float,2>{0.187921435f, 0.0158070643f},
-std::array<float,2>{0.743031085f, 0.86579901f},
-std::array<float,2>{0.607572317f, 0.269228756f},
-std::array<float,2>{0.000269017619f, 0.659775496f},
-std::array<float,2>{0.304221809f, 0.247632265f},
-std::array<float,2>{0.817623734f, 0.965616047f},
-std::array<float,2>{0.968665898f, 0.00664748112f},
-std::array<float,2>{0.382252812f, 0.847906649f},
-std::array<float,2>{0.227081358f, 0.455179989f},
-std::array<float,2>{0.698163509f, 0.561582327f},
-std::array<float,2>{0.672506094f, 0.13698931f},
-std::array<float,2>{0.155450404f, 0.926262259f},
-std::array<float,2>{0.498419732f, 0.321863949f},
-std::array<float,2>{0.927508354f, 0.725198448f},
-std::array<float,2>{0.786360145f, 0.406710327f},
-std::array<float,2>{0.336162031f, 0.579327226f},
-std::array<float,2>{0.0845714733f, 0.0847131535f},
-std::array<float,2>{0.52084589f, 0.750469387f},
-std::array<float,2>{0.720562398f, 0.49152711f},
-std::array<float,2>{0.208247259f, 0.525161445f},
-std::array<float,2>{0.419259012f, 0.0523396879f},
-std::array<float,2>{0.972844481f, 0.834338009f},
-std::array<float,2>{0.868481994f, 0.196823865f},
-std::array<float,2>{0.278703749f, 0.997089982f},
-std::array<float,2>{0.0343109816f, 0.287329227f},
-std::array<float,2>{0.574038684f, 0.652489305f},
-std::array<float,2>{0.549266815f, 0.107083559f},
-std::array<float,2>{0.0967109576f, 0.810141742f},
-std::array<float,2>{0.361056834f, 0.39154458f},
-std::array<float,2>{0.7514413f, 0.617175579f},
-std::array<float,2>{0.881538689f, 0.346664041f},
-std::array<float,2>{0.458427578f, 0.718162596f},
-std::array<float,2>{0.169903189f, 0.172047734f},
-std::array<float,2>{0.628615022f, 0.897105873f},
-std::array<float,2>{0.56680876f, 0.467516094f},
-std::array<float,2>{0.0395134725f, 0.549704492f},
-std::array<float,2>{0.271244884f, 0.0103461044f},
-std::array<float,2>{0.860105932f, 0.853989303f},
-std::array<float,2>{0.977186143f, 0.239677951f},
-std::array<float,2>{0.408350468f, 0.960739911f},
-std::array<float,2>{0.215837672f, 0.280597836f},
-std::array<float,2>{0.727001131f, 0.66909045f},
-std::array<float,2>{0.636191487f, 0.092107974f},
-std::array<float,2>{0.159368441f, 0.762045085f},
-std::array<float,2>{0.461368084f, 0.416756094f},
-std::array<float,2>{0.889934659f, 0.591020942f},
-std::array<float,2>{0.759286165f, 0.31291455f},
-std::array<float,2>{0.370463312f, 0.726671159f},
-std::array<float,2>{0.108683713f, 0.12847662f},
-std::array<float,2>{0.562188208f, 0.936277151f},
-std::array<float,2>{0.692374349f, 0.293836534f},
-std::array<float,2>{0.222399876f, 0.646678329f},
-std::array<float,2>{0.386433601f, 0.189182267f},
-std::array<float,2>{0.955765069f, 0.987858832f},
-std::array<float,2>{0.826697171f, 0.0580388047f},
-std::array<float,2>{0.312243253f, 0.840107024f},
-std::array<float,2>{0.0102591738f, 0.493962944f},
-std::array<float,2>{0.598245203f, 0.51846832f},
-std::array<float,2>{0.525512755f, 0.180016577f},
-std::array<float,2>{0.0883961841f, 0.903642833f},
-std::array<float,2>{0.334683865f, 0.351567805f},
-std::array<float,2>{0.790371776f, 0.708250046f},
-std::array<float,2>{0.932909489f, 0.405810654f},
-std::array<float,2>{0.485316217f, 0.618250966f},
-std::array<float,2>{0.141601697f, 0.0947892219f},
-std::array<float,2>{0.682054281f, 0.803333461f},
-std::array<float,2>{0.543167651f, 0.37233603f},
-std::array<float,2>{0.116137788f, 0.698849082f},
-std::array<float,2>{0.347023278f, 0.169724673f},
-std::array<float,2>{0.777701795f, 0.879339695f},
-std::array<float,2>{0.891618013f, 0.11738836f},
-std::array<float,2>{0.446059197f, 0.788839459f},
-std::array<float,2>{0.176078096f, 0.387563229f},
-std::array<float,2>{0.653573036f, 0.604246318f},
-std::array<float,2>{0.738534927f, 0.205086902f},
-std::array<float,2>{0.198586553f, 0.980607271f},
-std::array<float,2>{0.430820554f, 0.297946334f},
-std::array<float,2>{0.999664605f, 0.632535875f},
-std::array<float,2>{0.856532454f, 0.479287058f},
-std::array<float,2>{0.250020653f, 0.512923241f},
-std::array<float,2>{0.0547713414f, 0.0426923074f},
-std::array<float,2>{0.586390972f, 0.815280914f},
-std::array<float,2>{0.662189007f, 0.424687445f},
-std::array<float,2>{0.127864987f, 0.56368953f},
-std::array<float,2>{0.474854618f, 0.0639545545f},
-std::array<float,2>{0.909162998f, 0.7691167f},
-std::array<float,2>{0.803115904f, 0.154395983f},
-std::array<float,2>{0.315523803f, 0.919679463f},
-std::array<float,2>{0.0760078356f, 0.335842043f},
-std::array<float,2>{0.511990488f, 0.749296129f},
-std::array<float,2>{0.611363292f, 0.0260292161f},
-std::array<float,2>{0.0300881714f, 0.873099864f},
-std::array<float,2>{0.292953432f, 0.439429551f},
-std::array<float,2>{0.837976694f, 0.535837531f},
-std::array<float,2>{0.952105284f, 0.259679377f},
-std::array<float,2>{0.396645367f, 0.675406873f},
-std::array<float,2>{0.247705966f, 0.226287603f},
-std::array<float,2>{0.716149449f, 0.948007762f},
-std::array<float,2>{0.583583772f, 0.399988383f},
-std::array<float,2>{0.0508233793f, 0.622589588f},
-std::array<float,2>{0.25794223f, 0.100012101f},
-std::array<float,2>{0.846144855f, 0.798154414f},
-std::array<float,2>{0.985933602f, 0.186460644f},
-std::array<float,2>{0.42914775f, 0.901004791f},
-std::array<float,2>{0.19265236f, 0.359273911f},
-std::array<float,2>{0.747226477f, 0.706845522f},
-std::array<float,2>{0.646090508f, 0.061738275f},
-std::array<float,2>{0.181347266f, 0.838136494f},
-std::array<float,2>{0.445165902f, 0.499311358f},
-std::array<float,2>{0.90159148f, 0.520012677f},
-std::array<float,2>{0.768544137f, 0.291162372f},
-std::array<float,2>{0.356498808f, 0.640976131f},
-std::array<float,2>{0.11876446f, 0.194494352f},
-std::array<float,2>{0.535416961f, 0.988492787f},
-std::array<float,2>{0.70337975f, 0.317632347f},
-std::array<float,2>{0.237951308f, 0.733743489f},
-std::array<float,2>{0.399809152f, 0.132047951f},
-std::array<float,2>{0.943060398f, 0.931517541f},
-std::array<float,2>{0.833932638f, 0.0878672898f},
-std::array<float,2>{0.288287193f, 0.761071622f},
-std::array<float,2>{0.0222633686f, 0.418633312f},
-std::array<float,2>{0.618570328f, 0.589749873f},
-std::array<float,2>{0.506491899f, 0.236911952f},
-std::array<float,2>{0.0660075992f, 0.955030024f},
-std::array<float,2>{0.32761398f, 0.275172085f},
-std::array<float,2>{0.810884237f, 0.667006254f},
-std::array<float,2>{0.917099655f, 0.462926418f},
-std::array<float,2>{0.479314893f, 0.553905249f},
-std::array<float,2>{0.135310948f, 0.012446437f},
-std::array<float,2>{0.670290411f, 0.857502103f},
-std::array<float,2>{0.551759839f, 0.262028992f},
-std::array<float,2>{0.0989363566f, 0.677943707f},
-std::array<float,2>{0.364766121f, 0.219615787f},
-std::array<float,2>{0.755831063f, 0.952079833f},
-std::array<float,2>{0.878601491f, 0.0301954243f},
-std::array<float,2>{0.455324948f, 0.867757499f},
-std::array<float,2>{0.16685687f, 0.442090124f},
-std::array<float,2>{0.63217926f, 0.532316148f},
-std::array<float,2>{0.726194859f, 0.150626659f},
-std::array<float,2>{0.203980878f, 0.915289044f},
-std::array<float,2>{0.415986091f, 0.32921645f},
-std::array<float,2>{0.972639024f, 0.745780587f},
-std::array<float,2>{0.87354809f, 0.428232759f},
-std::array<float,2>{0.274344802f, 0.567309618f},
-std::array<float,2>{0.0372690856f, 0.0675375834f},
-std::array<float,2>{0.576290011f, 0.771227598f},
-std::array<float,2>{0.676948309f, 0.480583012f},
-std::array<float,2>{0.148681581f, 0.510783613f},
-std::array<float,2>{0.492891818f, 0.0453793481f},
-std::array<float,2>{0.92317605f, 0.819419265f},
-std::array<float,2>{0.784777701f, 0.207814798f},
-std::array<float,2>{0.342945099f, 0.980032682f},
-std::array<float,2>{0.0796125084f, 0.302643865f},
-std::array<float,2>{0.518409729f, 0.62785393f},
-std::array<float,2>{0.602270663f, 0.124966048f},
-std::array<float,2>{0.00679510692f, 0.781469047f},
-std::array<float,2>{0.300447047f, 0.386576563f},
-std::array<float,2>{0.813272834f, 0.606224f},
-std::array<float,2>{0.962321997f, 0.368311197f},
-std::array<float,2>{0.377334654f, 0.700657666f},
-std::array<float,2>{0.234352455f, 0.165452763f},
-std::array<float,2>{0.702197313f, 0.875287056f},
-std::array<float,2>{0.527671516f, 0.44770062f},
-std::array<float,2>{0.0932906643f, 0.541461408f},
-std::array<float,2>{0.328202069f, 0.0222746134f},
-std::array<float,2>{0.793290854f, 0.861147761f},
-std::array<float,2>{0.936046541f, 0.233665302f},
-std::array<float,2>{0.490147948f, 0.938804448f},
-std::array<float,2>{0.147554919f, 0.25636217f},
-std::array<float,2>{0.683863521f, 0.681916833f},
-std::array<float,2>{0.688096642f, 0.074616529f},
-std::array<float,2>{0.225022137f, 0.776601136f},
-std::array<float,2>{0.387344867f, 0.434664875f},
-std::array<float,2>{0.959976494f, 0.571192443f},
-std::array<float,2>{0.823598444f, 0.338990808f},
-std::array<float,2>{0.305160612f, 0.741846681f},
-std::array<float,2>{0.0148354573f, 0.145924374f},
-std::array<float,2>{0.593775272f, 0.912806511f},
-std::array<float,2>{0.637236416f, 0.30975011f},
-std::array<float,2>{0.160393775f, 0.635860324f},
-std::array<float,2>{0.468203753f, 0.218695566f},
-std::array<float,2>{0.88281709f, 0.969618082f},
-std::array<float,2>{0.762446821f, 0.0371256657f},
-std::array<float,2>{0.371154368f, 0.820418298f},
-std::array<float,2>{0.101683311f, 0.469231606f},
-std::array<float,2>{0.555920243f, 0.507100701f},
-std::array<float,2>{0.564860404f, 0.15880695f},
-std::array<float,2>{0.0446658395f, 0.888773978f},
-std::array<float,2>{0.266826928f, 0.362190545f},
-std::array<float,2>{0.866811156f, 0.68890208f},
-std::array<float,2>{0.983151734f, 0.376451194f},
-std::array<float,2>{0.411492109f, 0.600726902f},
-std::array<float,2>{0.214084834f, 0.110363595f},
-std::array<float,2>{0.730587304f, 0.790827453f},
-std::array<float,2>{0.613980889f, 0.350037575f},
-std::array<float,2>{0.0266074743f, 0.711848497f},
-std::array<float,2>{0.293876618f, 0.176753074f},
-std::array<float,2>{0.8431499f, 0.891421556f},
-std::array<float,2>{0.945974648f, 0.102812909f},
-std::array<float,2>{0.394530982f, 0.804854274f},
-std::array<float,2>{0.242721081f, 0.397197366f},
-std::array<float,2>{0.711022079f, 0.61261797f},
-std::array<float,2>{0.658183575f, 0.199251056f},
-std::array<float,2>{0.130246773f, 0.992252946f},
-std::array<float,2>{0.472111762f, 0.284817427f},
-std::array<float,2>{0.912877262f, 0.650982857f},
-std::array<float,2>{0.799191833f, 0.487014025f},
-std::array<float,2>{0.320117295f, 0.527809501f},
-std::array<float,2>{0.0731310025f, 0.047960341f},
-std::array<float,2>{0.510708034f, 0.830719054f},
-std::array<float,2>{0.736636996f, 0.412421137f},
-std::array<float,2>{0.199575454f, 0.583438396f},
-std::array<float,2>{0.434835285f, 0.0814621076f},
-std::array<float,2>{0.994666219f, 0.756610453f},
-std::array<float,2>{0.853012919f, 0.13625589f},
-std::array<float,2>{0.256437004f, 0.922735989f},
-std::array<float,2>{0.0617800318f, 0.326254994f},
-std::array<float,2>{0.589853287f, 0.72177732f},
-std::array<float,2>{0.540311396f, 0.00178737845f},
-std::array<float,2>{0.109559715f, 0.844041884f},
-std::array<float,2>{0.350370944f, 0.457375437f},
-std::array<float,2>{0.776683867f, 0.557698071f},
-std::array<float,2>{0.895833671f, 0.270614654f},
-std::array<float,2>{0.451422364f, 0.663737416f},
-std::array<float,2>{0.175623581f, 0.245033398f},
-std::array<float,2>{0.65052259f, 0.963635981f},
-std::array<float,2>{0.531786978f, 0.432408959f},
-std::array<float,2>{0.122687221f, 0.577887893f},
-std::array<float,2>{0.355416954f, 0.0711637884f},
-std::array<float,2>{0.77153182f, 0.780022025f},
-std::array<float,2>{0.903496265f, 0.142522529f},
-std::array<float,2>{0.437966555f, 0.907273054f},
-std::array<float,2>{0.183739066f, 0.343242764f},
-std::array<float,2>{0.642313957f, 0.737857103f},
-std::array<float,2>{0.745945156f, 0.0191774089f},
-std::array<float,2>{0.190236509f, 0.863748372f},
-std::array<float,2>{0.422363311f, 0.451562107f},
-std::array<float,2>{0.989853442f, 0.543616652f},
-std::array<float,2>{0.850715637f, 0.2516644f},
-std::array<float,2>{0.261965424f, 0.684893668f},
-std::array<float,2>{0.0492595956f, 0.227287054f},
-std::array<float,2>{0.578920126f, 0.944006681f},
-std::array<float,2>{0.666157544f, 0.366224378f},
-std::array<float,2>{0.13948366f, 0.692177415f},
-std::array<float,2>{0.481448233f, 0.162918881f},
-std::array<float,2>{0.921349704f, 0.885190308f},
-std::array<float,2>{0.807392061f, 0.115031518f},
-std::array<float,2>{0.32344681f, 0.793789566f},
-std::array<float,2>{0.0684710145f, 0.379001766f},
-std::array<float,2>{0.502087414f, 0.59414953f},
-std::array<float,2>{0.622486234f, 0.212669224f},
-std::array<float,2>{0.0188852735f, 0.976363361f},
-std::array<float,2>{0.284341723f, 0.307120293f},
-std::array<float,2>{0.828241765f, 0.639601886f},
-std::array<float,2>{0.938115537f, 0.473959476f},
-std::array<float,2>{0.403530866f, 0.502656281f},
-std::array<float,2>{0.240027368f, 0.0340295695f},
-std::array<float,2>{0.710350394f, 0.826982319f},
-std::array<float,2>{0.57058996f, 0.285164654f},
-std::array<float,2>{0.0320552774f, 0.654608607f},
-std::array<float,2>{0.28020215f, 0.19789435f},
-std::array<float,2>{0.870195031f, 0.999910891f},
-std::array<float,2>{0.975900948f, 0.0527362563f},
-std::array<float,2>{0.420734763f, 0.83336091f},
-std::array<float,2>{0.20967339f, 0.490133286f},
-std::array<float,2>{0.721673369f, 0.526626587f},
-std::array<float,2>{0.626212418f, 0.175164804f},
-std::array<float,2>{0.170438066f, 0.896438003f},
-std::array<float,2>{0.459712207f, 0.344211787f},
-std::array<float,2>{0.879328787f, 0.716795564f},
-std::array<float,2>{0.753627658f, 0.394301265f},
-std::array<float,2>{0.361578584f, 0.613442361f},
-std::array<float,2>{0.0943930894f, 0.108311348f},
-std::array<float,2>{0.548139215f, 0.810994983f},
-std::array<float,2>{0.695478797f, 0.453646809f},
-std::array<float,2>{0.229682058f, 0.559513152f},
-std::array<float,2>{0.380179286f, 0.0049987305f},
-std::array<float,2>{0.965166092f, 0.84961319f},
-std::array<float,2>{0.819554865f, 0.248054072f},
-std::array<float,2>{0.301239163f, 0.967907429f},
-std::array<float,2>{0.00369658205f, 0.266091675f},
-std::array<float,2>{0.605854928f, 0.657859266f},
-std::array<float,2>{0.523427308f, 0.0828150213f},
-std::array<float,2>{0.0832713991f, 0.752392232f},
-std::array<float,2>{0.33882311f, 0.408338159f},
-std::array<float,2>{0.787588179f, 0.58096993f},
-std::array<float,2>{0.929084897f, 0.323605329f},
-std::array<float,2>{0.497783482f, 0.723569155f},
-std::array<float,2>{0.153248414f, 0.140381843f},
-std::array<float,2>{0.675148606f, 0.928278983f},
-std::array<float,2>{0.601320446f, 0.495002151f},
-std::array<float,2>{0.00889870059f, 0.516516089f},
-std::array<float,2>{0.310441554f, 0.0550622679f},
-std::array<float,2>{0.825237334f, 0.842174649f},
-std::array<float,2>{0.954457283f, 0.191174373f},
-std::array<float,2>{0.38474679f, 0.986256123f},
-std::array<float,2>{0.219289318f, 0.296157241f},
-std::array<float,2>{0.694669783f, 0.645741105f},
-std::array<float,2>{0.681535482f, 0.0963129923f},
-std::array<float,2>{0.143015116f, 0.801342547f},
-std::array<float,2>{0.487983644f, 0.403963715f},
-std::array<float,2>{0.929991782f, 0.619930267f},
-std::array<float,2>{0.792356193f, 0.354560882f},
-std::array<float,2>{0.332908899f, 0.709885776f},
-std::array<float,2>{0.0863152519f, 0.182669207f},
-std::array<float,2>{0.523783088f, 0.905988693f},
-std::array<float,2>{0.729472876f, 0.278475165f},
-std::array<float,2>{0.218736723f, 0.670822084f},
-std::array<float,2>{0.407261878f, 0.241421327f},
-std::array<float,2>{0.980273843f, 0.958289504f},
-std::array<float,2>{0.862161458f, 0.0085043693f},
-std::array<float,2>{0.272926688f, 0.852248311f},
-std::array<float,2>{0.0424927063f, 0.465028584f},
-std::array<float,2>{0.568546653f, 0.548189938f},
-std::array<float,2>{0.559793234f, 0.126431867f},
-std::array<float,2>{0.105749965f, 0.935275972f},
-std::array<float,2>{0.36898616f, 0.316164017f},
-std::array<float,2>{0.761614144f, 0.728821814f},
-std::array<float,2>{0.887803137f, 0.415211767f},
-std::array<float,2>{0.463426799f, 0.593328118f},
-std::array<float,2>{0.157503366f, 0.0914702043f},
-std::array<float,2>{0.633002758f, 0.764496148f},
-std::array<float,2>{0.514500201f, 0.332816839f},
-std::array<float,2>{0.0768034309f, 0.746288717f},
-std::array<float,2>{0.3134211f, 0.152888954f},
-std::array<float,2>{0.802352667f, 0.921737731f},
-std::array<float,2>{0.90684396f, 0.0651337579f},
-std::array<float,2>{0.474378228f, 0.767255545f},
-std::array<float,2>{0.126826093f, 0.423009545f},
-std::array<float,2>{0.661769748f, 0.565039694f},
-std::array<float,2>{0.718527436f, 0.223900422f},
-std::array<float,2>{0.248066023f, 0.94536978f},
-std::array<float,2>{0.396475047f, 0.261074573f},
-std::array<float,2>{0.950552225f, 0.671993971f},
-std::array<float,2>{0.837056279f, 0.439618945f},
-std::array<float,2>{0.289374828f, 0.537391901f},
-std::array<float,2>{0.0277584791f, 0.024395274f},
-std::array<float,2>{0.610688984f, 0.872033894f},
-std::array<float,2>{0.654746234f, 0.389647603f},
-std::array<float,2>{0.178974256f, 0.60249871f},
-std::array<float,2>{0.448212475f, 0.119392589f},
-std::array<float,2>{0.893847466f, 0.78519398f},
-std::array<float,2>{0.780932426f, 0.171619475f},
-std::array<float,2>{0.344615698f, 0.882430673f},
-std::array<float,2>{0.114336722f, 0.373536974f},
-std::array<float,2>{0.546013236f, 0.696346462f},
-std::array<float,2>{0.589007139f, 0.039396964f},
-std::array<float,2>{0.05670866f, 0.813064992f},
-std::array<float,2>{0.25282985f, 0.476952016f},
-std::array<float,2>{0.857823253f, 0.514714122f},
-std::array<float,2>{0.997570455f, 0.299214959f},
-std::array<float,2>{0.432470709f, 0.629647851f},
-std::array<float,2>{0.196847707f, 0.205029845f},
-std::array<float,2>{0.742092729f, 0.983074188f},
-std::array<float,2>{0.623204648f, 0.380327493f},
-std::array<float,2>{0.0172860548f, 0.595621407f},
-std::array<float,2>{0.281455606f, 0.113334417f},
-std::array<float,2>{0.831400156f, 0.794783056f},
-std::array<float,2>{0.939541936f, 0.163244903f},
-std::array<float,2>{0.405917615f, 0.886268198f},
-std::array<float,2>{0.240742251f, 0.36527133f},
-std::array<float,2>{0.707670689f, 0.693358302f},
-std::array<float,2>{0.665660143f, 0.0342472382f},
-std::array<float,2>{0.137763113f, 0.827337384f},
-std::array<float,2>{0.482933313f, 0.472733259f},
-std::array<float,2>{0.91837585f, 0.503706813f},
-std::array<float,2>{0.806599438f, 0.308055103f},
-std::array<float,2>{0.32147336f, 0.640113592f},
-std::array<float,2>{0.0682402775f, 0.211599097f},
-std::array<float,2>{0.500078738f, 0.975575745f},
-std::array<float,2>{0.74275136f, 0.341849983f},
-std::array<float,2>{0.187652767f, 0.736421347f},
-std::array<float,2>{0.424671054f, 0.141519204f},
-std::array<float,2>{0.990512013f, 0.906630516f},
-std::array<float,2>{0.848230183f, 0.0714148134f},
-std::array<float,2>{0.264885545f, 0.781141341f},
-std::array<float,2>{0.0480579808f, 0.432787716f},
-std::array<float,2>{0.581681013f, 0.576498091f},
-std::array<float,2>{0.533875823f, 0.227946356f},
-std::array<float,2>{0.123997077f, 0.944978893f},
-std::array<float,2>{0.352722853f, 0.250146419f},
-std::array<float,2>{0.770132184f, 0.684527695f},
-std::array<float,2>{0.905729234f, 0.452164412f},
-std::array<float,2>{0.439730048f, 0.544491887f},
-std::array<float,2>{0.186708763f, 0.0179332532f},
-std::array<float,2>{0.644323885f, 0.864357173f},
-std::array<float,2>{0.520697057f, 0.26745075f},
-std::array<float,2>{0.0848478824f, 0.657042623f},
-std::array<float,2>{0.336225957f, 0.249391094f},
-std::array<float,2>{0.786495328f, 0.967288554f},
-std::array<float,2>{0.927443504f, 0.00465706969f},
-std::array<float,2>{0.498246431f, 0.851010442f},
-std::array<float,2>{0.155682892f, 0.454194486f},
-std::array<float,2>{0.672628403f, 0.559976578f},
-std::array<float,2>{0.697775602f, 0.139251888f},
-std::array<float,2>{0.227533922f, 0.929152727f},
-std::array<float,2>{0.382021099f, 0.323080748f},
-std::array<float,2>{0.968320549f, 0.723988175f},
-std::array<float,2>{0.817738771f, 0.409591645f},
-std::array<float,2>{0.304456413f, 0.581759632f},
-std::array<float,2>{0.000125259248f, 0.0837762877f},
-std::array<float,2>{0.607897222f, 0.753518641f},
-std::array<float,2>{0.628744125f, 0.489175767f},
-std::array<float,2>{0.169665813f, 0.525950372f},
-std::array<float,2>{0.458173186f, 0.054103151f},
-std::array<float,2>{0.881745517f, 0.832883894f},
-std::array<float,2>{0.751016438f, 0.198513612f},
-std::array<float,2>{0.361088425f, 0.998321593f},
-std::array<float,2>{0.0969405547f, 0.286550164f},
-std::array<float,2>{0.548899412f, 0.655687034f},
-std::array<float,2>{0.573812246f, 0.108698189f},
-std::array<float,2>{0.0346007682f, 0.812341988f},
-std::array<float,2>{0.278324336f, 0.392915308f},
-std::array<float,2>{0.868257463f, 0.615209162f},
-std::array<float,2>{0.973011971f, 0.345695347f},
-std::array<float,2>{0.419158131f, 0.715259492f},
-std::array<float,2>{0.208421126f, 0.174340144f},
-std::array<float,2>{0.720313013f, 0.894984543f},
-std::array<float,2>{0.56225884f, 0.466144294f},
-std::array<float,2>{0.108521603f, 0.547456741f},
-std::array<float,2>{0.370164633f, 0.00913365558f},
-std::array<float,2>{0.759527266f, 0.8528952f},
-std::array<float,2>{0.889678121f, 0.240680724f},
-std::array<float,2>{0.460984439f, 0.957668424f},
-std::array<float,2>{0.159515262f, 0.278141707f},
-std::array<float,2>{0.635834336f, 0.67150569f},
-std::array<float,2>{0.726779044f, 0.0905252472f},
-std::array<float,2>{0.216128066f, 0.764880061f},
-std::array<float,2>{0.408556998f, 0.414898992f},
-std::array<float,2>{0.977383554f, 0.592475414f},
-std::array<float,2>{0.860195279f, 0.31476301f},
-std::array<float,2>{0.271192789f, 0.730022132f},
-std::array<float,2>{0.039203003f, 0.125030622f},
-std::array<float,2>{0.566450536f, 0.934072673f},
-std::array<float,2>{0.681801081f, 0.295386821f},
-std::array<float,2>{0.142058805f, 0.64504993f},
-std::array<float,2>{0.484970301f, 0.190046474f},
-std::array<float,2>{0.932686031f, 0.985200584f},
-std::array<float,2>{0.790273666f, 0.055759225f},
-std::array<float,2>{0.334895462f, 0.843574405f},
-std::array<float,2>{0.0886388719f, 0.495943725f},
-std::array<float,2>{0.525693715f, 0.517126203f},
-std::array<float,2>{0.59841311f, 0.182479471f},
-std::array<float,2>{0.0106305638f, 0.904763699f},
-std::array<float,2>{0.312267959f, 0.353542119f},
-std::array<float,2>{0.827000856f, 0.710433304f},
-std::array<float,2>{0.95587945f, 0.40311259f},
-std::array<float,2>{0.386502385f, 0.620907605f},
-std::array<float,2>{0.222584173f, 0.0970094055f},
-std::array<float,2>{0.692055345f, 0.80187571f},
-std::array<float,2>{0.586021781f, 0.374625444f},
-std::array<float,2>{0.0551374443f, 0.695564449f},
-std::array<float,2>{0.250285029f, 0.170763448f},
-std::array<float,2>{0.856842935f, 0.881628454f},
-std::array<float,2>{0.999962449f, 0.120627351f},
-std::array<float,2>{0.43112579f, 0.786963046f},
-std::array<float,2>{0.198385254f, 0.390013039f},
-std::array<float,2>{0.738352895f, 0.602852821f},
-std::array<float,2>{0.653490722f, 0.203241467f},
-std::array<float,2>{0.175821766f, 0.983530104f},
-std::array<float,2>{0.445811659f, 0.300545335f},
-std::array<float,2>{0.891930401f, 0.630627692f},
-std::array<float,2>{0.777448893f, 0.477563351f},
-std::array<float,2>{0.346882135f, 0.514106095f},
-std::array<float,2>{0.115741737f, 0.0404750966f},
-std::array<float,2>{0.543217301f, 0.814423561f},
-std::array<float,2>{0.715867519f, 0.422224998f},
-std::array<float,2>{0.247943118f, 0.566297352f},
-std::array<float,2>{0.39693892f, 0.06585107f},
-std::array<float,2>{0.951674938f, 0.765896976f},
-std::array<float,2>{0.838237703f, 0.15344806f},
-std::array<float,2>{0.292588264f, 0.920700133f},
-std::array<float,2>{0.0298160203f, 0.333025843f},
-std::array<float,2>{0.611761391f, 0.747860134f},
-std::array<float,2>{0.511933208f, 0.0252659712f},
-std::array<float,2>{0.0757488683f, 0.872864187f},
-std::array<float,2>{0.315687478f, 0.440617681f},
-std::array<float,2>{0.802916586f, 0.538402557f},
-std::array<float,2>{0.908744335f, 0.260334641f},
-std::array<float,2>{0.474682868f, 0.673543096f},
-std::array<float,2>{0.127618656f, 0.223363966f},
-std::array<float,2>{0.662527263f, 0.94715178f},
-std::array<float,2>{0.505630791f, 0.419122517f},
-std::array<float,2>{0.0644502416f, 0.588851273f},
-std::array<float,2>{0.326010376f, 0.0865523517f},
-std::array<float,2>{0.809127629f, 0.760307848f},
-std::array<float,2>{0.915619671f, 0.131690815f},
-std::array<float,2>{0.477051049f, 0.929829478f},
-std::array<float,2>{0.134268209f, 0.316923469f},
-std::array<float,2>{0.669351041f, 0.733335495f},
-std::array<float,2>{0.705765188f, 0.012904441f},
-std::array<float,2>{0.234598145f, 0.858490109f},
-std::array<float,2>{0.40103513f, 0.463931024f},
-std::array<float,2>{0.944359183f, 0.553549111f},
-std::array<float,2>{0.83577013f, 0.274127632f},
-std::array<float,2>{0.286548108f, 0.666622758f},
-std::array<float,2>{0.0213607289f, 0.237659559f},
-std::array<float,2>{0.620210588f, 0.953564882f},
-std::array<float,2>{0.64806968f, 0.35837996f},
-std::array<float,2>{0.182668209f, 0.705233395f},
-std::array<float,2>{0.443189919f, 0.18748869f},
-std::array<float,2>{0.898629427f, 0.901669741f},
-std::array<float,2>{0.766625524f, 0.100859083f},
-std::array<float,2>{0.358539283f, 0.797544718f},
-std::array<float,2>{0.119346999f, 0.399064362f},
-std::array<float,2>{0.53873843f, 0.621215522f},
-std::array<float,2>{0.584483922f, 0.193408251f},
-std::array<float,2>{0.0533045456f, 0.99005717f},
-std::array<float,2>{0.260315597f, 0.292408586f},
-std::array<float,2>{0.845699489f, 0.642271042f},
-std::array<float,2>{0.986794233f, 0.498558372f},
-std::array<float,2>{0.427485228f, 0.521214962f},
-std::array<float,2>{0.194805741f, 0.0611281395f},
-std::array<float,2>{0.749270558f, 0.839710176f},
-std::array<float,2>{0.605134606f, 0.300805122f},
-std::array<float,2>{0.00541623635f, 0.628893673f},
-std::array<float,2>{0.298050404f, 0.208661228f},
-std::array<float,2>{0.815862954f, 0.978575349f},
-std::array<float,2>{0.963813484f, 0.0459365994f},
-std::array<float,2>{0.375911325f, 0.81909734f},
-std::array<float,2>{0.23052752f, 0.481547207f},
-std::array<float,2>{0.701041281f, 0.510217547f},
-std::array<float,2>{0.679586291f, 0.164894998f},
-std::array<float,2>{0.151945367f, 0.876543939f},
-std::array<float,2>{0.49421528f, 0.367236853f},
-std::array<float,2>{0.924715877f, 0.699971139f},
-std::array<float,2>{0.782758892f, 0.385068774f},
-std::array<float,2>{0.341356754f, 0.607181907f},
-std::array<float,2>{0.0802447945f, 0.1232429f},
-std::array<float,2>{0.516404927f, 0.783144295f},
-std::array<float,2>{0.724079072f, 0.442616731f},
-std::array<float,2>{0.205805883f, 0.532030046f},
-std::array<float,2>{0.41724363f, 0.0307243261f},
-std::array<float,2>{0.970106184f, 0.86849159f},
-std::array<float,2>{0.87212801f, 0.219985947f},
-std::array<float,2>{0.276553929f, 0.952229202f},
-std::array<float,2>{0.0362800397f, 0.262824416f},
-std::array<float,2>{0.575251997f, 0.678934813f},
-std::array<float,2>{0.554230809f, 0.0667803511f},
-std::array<float,2>{0.100974351f, 0.769672215f},
-std::array<float,2>{0.36649394f, 0.429465145f},
-std::array<float,2>{0.757424474f, 0.567394614f},
-std::array<float,2>{0.876108706f, 0.328968525f},
-std::array<float,2>{0.453487486f, 0.744829059f},
-std::array<float,2>{0.165588096f, 0.152220219f},
-std::array<float,2>{0.63030833f, 0.914274633f},
-std::array<float,2>{0.563912928f, 0.470544517f},
-std::array<float,2>{0.0458729975f, 0.506675959f},
-std::array<float,2>{0.268505543f, 0.0390333943f},
-std::array<float,2>{0.863453388f, 0.821411073f},
-std::array<float,2>{0.981799424f, 0.216815084f},
-std::array<float,2>{0.413240731f, 0.970087945f},
-std::array<float,2>{0.212825537f, 0.308813632f},
-std::array<float,2>{0.732617438f, 0.635590553f},
-std::array<float,2>{0.639471531f, 0.110002592f},
-std::array<float,2>{0.163081303f, 0.789320529f},
-std::array<float,2>{0.465169698f, 0.375305206f},
-std::array<float,2>{0.884775579f, 0.600215614f},
-std::array<float,2>{0.764162064f, 0.363194853f},
-std::array<float,2>{0.373345733f, 0.68825382f},
-std::array<float,2>{0.104659088f, 0.159935445f},
-std::array<float,2>{0.557514966f, 0.889770091f},
-std::array<float,2>{0.690958738f, 0.257217079f},
-std::array<float,2>{0.223087877f, 0.6835922f},
-std::array<float,2>{0.390229136f, 0.232857257f},
-std::array<float,2>{0.958134472f, 0.938287795f},
-std::array<float,2>{0.821319401f, 0.0229935441f},
-std::array<float,2>{0.308564037f, 0.859489799f},
-std::array<float,2>{0.0125581743f, 0.448960155f},
-std::array<float,2>{0.596253991f, 0.542218924f},
-std::array<float,2>{0.5299384f, 0.14490889f},
-std::array<float,2>{0.091337651f, 0.913797915f},
-std::array<float,2>{0.330656558f, 0.338099539f},
-std::array<float,2>{0.795959413f, 0.741076052f},
-std::array<float,2>{0.934362113f, 0.433757931f},
-std::array<float,2>{0.491390377f, 0.571653485f},
-std::array<float,2>{0.145668507f, 0.0752769336f},
-std::array<float,2>{0.686551988f, 0.775661528f},
-std::array<float,2>{0.541645467f, 0.328011304f},
-std::array<float,2>{0.112322994f, 0.721395612f},
-std::array<float,2>{0.349401504f, 0.134944975f},
-std::array<float,2>{0.77372241f, 0.923175871f},
-std::array<float,2>{0.897020876f, 0.080824621f},
-std::array<float,2>{0.44991976f, 0.757769644f},
-std::array<float,2>{0.172657087f, 0.413380802f},
-std::array<float,2>{0.649411619f, 0.582411051f},
-std::array<float,2>{0.734594703f, 0.246021241f},
-std::array<float,2>{0.202401847f, 0.964342296f},
-std::array<float,2>{0.437256634f, 0.270393074f},
-std::array<float,2>{0.992269456f, 0.66287303f},
-std::array<float,2>{0.854448557f, 0.458295316f},
-std::array<float,2>{0.255444497f, 0.556955755f},
-std::array<float,2>{0.0596254282f, 0.000265803596f},
-std::array<float,2>{0.592767239f, 0.845207989f},
-std::array<float,2>{0.659672856f, 0.397626638f},
-std::array<float,2>{0.131717458f, 0.611916542f},
-std::array<float,2>{0.469718158f, 0.102042273f},
-std::array<float,2>{0.911582947f, 0.806141853f},
-std::array<float,2>{0.797996879f, 0.177348688f},
-std::array<float,2>{0.318162113f, 0.891856015f},
-std::array<float,2>{0.0704321191f, 0.351279587f},
-std::array<float,2>{0.509597659f, 0.712785125f},
-std::array<float,2>{0.616506875f, 0.0474519059f},
-std::array<float,2>{0.0244915634f, 0.83140415f},
-std::array<float,2>{0.2959539f, 0.487570345f},
-std::array<float,2>{0.840891182f, 0.528382123f},
-std::array<float,2>{0.948884726f, 0.28378886f},
-std::array<float,2>{0.391599417f, 0.651564538f},
-std::array<float,2>{0.24514477f, 0.20086731f},
-std::array<float,2>{0.714515209f, 0.993682206f},
-std::array<float,2>{0.578669667f, 0.430136979f},
-std::array<float,2>{0.0489531085f, 0.574573576f},
-std::array<float,2>{0.261809945f, 0.0733520165f},
-std::array<float,2>{0.850963533f, 0.777381301f},
-std::array<float,2>{0.990194738f, 0.14310275f},
-std::array<float,2>{0.422832668f, 0.90982753f},
-std::array<float,2>{0.190158457f, 0.340020001f},
-std::array<float,2>{0.745634377f, 0.735424936f},
-std::array<float,2>{0.642398357f, 0.0168592054f},
-std::array<float,2>{0.18407698f, 0.867000937f},
-std::array<float,2>{0.437736273f, 0.450045645f},
-std::array<float,2>{0.903594911f, 0.546482027f},
-std::array<float,2>{0.771829784f, 0.252941847f},
-std::array<float,2>{0.355037987f, 0.687385559f},
-std::array<float,2>{0.122932404f, 0.229232818f},
-std::array<float,2>{0.53205353f, 0.942818642f},
-std::array<float,2>{0.710102618f, 0.36504671f},
-std::array<float,2>{0.239791498f, 0.694294274f},
-std::array<float,2>{0.403794438f, 0.161283508f},
-std::array<float,2>{0.938402712f, 0.884572148f},
-std::array<float,2>{0.828544438f, 0.115434796f},
-std::array<float,2>{0.284460753f, 0.796441972f},
-std::array<float,2>{0.0187519714f, 0.380879909f},
-std::array<float,2>{0.622189343f, 0.595992327f},
-std::array<float,2>{0.502229691f, 0.213863596f},
-std::array<float,2>{0.0687333494f, 0.974327326f},
-std::array<float,2>{0.32364139f, 0.305013716f},
-std::array<float,2>{0.807244301f, 0.638513744f},
-std::array<float,2>{0.920941234f, 0.476007462f},
-std::array<float,2>{0.481784225f, 0.500531673f},
-std::array<float,2>{0.139197901f, 0.0319400765f},
-std::array<float,2>{0.666479528f, 0.824628115f},
-std::array<float,2>{0.547998309f, 0.288261086f},
-std::array<float,2>{0.0946918353f, 0.653413892f},
-std::array<float,2>{0.361429244f, 0.196019009f},
-std::array<float,2>{0.753830314f, 0.99646467f},
-std::array<float,2>{0.878913462f, 0.0515683331f},
-std::array<float,2>{0.459772736f, 0.835321724f},
-std::array<float,2>{0.170841709f, 0.491114855f},
-std::array<float,2>{0.626392663f, 0.523783326f},
-std::array<float,2>{0.721421778f, 0.173197597f},
-std::array<float,2>{0.209871888f, 0.897475421f},
-std::array<float,2>{0.420510948f, 0.347415775f},
-std::array<float,2>{0.975816786f, 0.717589617f},
-std::array<float,2>{0.870370209f, 0.392519563f},
-std::array<float,2>{0.279876739f, 0.61578393f},
-std::array<float,2>{0.0318577625f, 0.106038921f},
-std::array<float,2>{0.570347011f, 0.808697045f},
-std::array<float,2>{0.674998879f, 0.456275463f},
-std::array<float,2>{0.15292573f, 0.561445534f},
-std::array<float,2>{0.497970223f, 0.00704695005f},
-std::array<float,2>{0.928954124f, 0.849191248f},
-std::array<float,2>{0.787266731f, 0.247020289f},
-std::array<float,2>{0.338563025f, 0.966585636f},
-std::array<float,2>{0.083228007f, 0.268033117f},
-std::array<float,2>{0.523140907f, 0.658336043f},
-std::array<float,2>{0.605520606f, 0.0857255831f},
-std::array<float,2>{0.0036503335f, 0.751199067f},
-std::array<float,2>{0.300915867f, 0.407694131f},
-std::array<float,2>{0.819821417f, 0.578758001f},
-std::array<float,2>{0.965013325f, 0.320552468f},
-std::array<float,2>{0.380098224f, 0.72634691f},
-std::array<float,2>{0.229760423f, 0.138510212f},
-std::array<float,2>{0.695620418f, 0.92689383f},
-std::array<float,2>{0.523606181f, 0.492612243f},
-std::array<float,2>{0.0859441906f, 0.519026697f},
-std::array<float,2>{0.332596838f, 0.0572296157f},
-std::array<float,2>{0.791995406f, 0.841551542f},
-std::array<float,2>{0.929862142f, 0.187501013f},
-std::array<float,2>{0.488167375f, 0.986693501f},
-std::array<float,2>{0.142637953f, 0.294851124f},
-std::array<float,2>{0.681217134f, 0.647870541f},
-std::array<float,2>{0.694556355f, 0.0939833149f},
-std::array<float,2>{0.219638318f, 0.803733408f},
-std::array<float,2>{0.384412795f, 0.404906005f},
-std::array<float,2>{0.954132676f, 0.617547929f},
-std::array<float,2>{0.82551986f, 0.352855057f},
-std::array<float,2>{0.310262352f, 0.70799607f},
-std::array<float,2>{0.00925607607f, 0.181272119f},
-std::array<float,2>{0.601200759f, 0.902798772f},
-std::array<float,2>{0.633129716f, 0.27939865f},
-std::array<float,2>{0.157245159f, 0.668297112f},
-std::array<float,2>{0.463783592f, 0.238723055f},
-std::array<float,2>{0.887958467f, 0.95967555f},
-std::array<float,2>{0.761244893f, 0.0107941981f},
-std::array<float,2>{0.368720412f, 0.854737043f},
-std::array<float,2>{0.10558372f, 0.467998683f},
-std::array<float,2>{0.559913337f, 0.550715148f},
-std::array<float,2>{0.568805993f, 0.127531737f},
-std::array<float,2>{0.0429207683f, 0.936645329f},
-std::array<float,2>{0.27263695f, 0.313771665f},
-std::array<float,2>{0.861955047f, 0.727928281f},
-std::array<float,2>{0.980113268f, 0.417250037f},
-std::array<float,2>{0.407678902f, 0.59049964f},
-std::array<float,2>{0.218326628f, 0.0935010985f},
-std::array<float,2>{0.729210556f, 0.762730837f},
-std::array<float,2>{0.61057061f, 0.334162503f},
-std::array<float,2>{0.0273668971f, 0.748471022f},
-std::array<float,2>{0.289128244f, 0.156243071f},
-std::array<float,2>{0.83738029f, 0.918857753f},
-std::array<float,2>{0.950327396f, 0.0625887811f},
-std::array<float,2>{0.39617011f, 0.768081307f},
-std::array<float,2>{0.24839972f, 0.425210893f},
-std::array<float,2>{0.718372822f, 0.562779307f},
-std::array<float,2>{0.662059784f, 0.225195721f},
-std::array<float,2>{0.126564816f, 0.94911921f},
-std::array<float,2>{0.474173874f, 0.258500457f},
-std::array<float,2>{0.907175303f, 0.674256802f},
-std::array<float,2>{0.802537262f, 0.437571198f},
-std::array<float,2>{0.313005209f, 0.537011027f},
-std::array<float,2>{0.0769851431f, 0.0271981191f},
-std::array<float,2>{0.514177799f, 0.874257147f},
-std::array<float,2>{0.741723061f, 0.388130516f},
-std::array<float,2>{0.197078601f, 0.605040371f},
-std::array<float,2>{0.432323039f, 0.11883644f},
-std::array<float,2>{0.998022377f, 0.788040042f},
-std::array<float,2>{0.857442856f, 0.16835171f},
-std::array<float,2>{0.252668887f, 0.879974604f},
-std::array<float,2>{0.0570191778f, 0.371269852f},
-std::array<float,2>{0.589298427f, 0.697819829f},
-std::array<float,2>{0.546240091f, 0.0417685844f},
-std::array<float,2>{0.114530772f, 0.816268206f},
-std::array<float,2>{0.344437033f, 0.480166763f},
-std::array<float,2>{0.781042337f, 0.512574077f},
-std::array<float,2>{0.893565655f, 0.297695309f},
-std::array<float,2>{0.447913975f, 0.631590903f},
-std::array<float,2>{0.17894794f, 0.206688747f},
-std::array<float,2>{0.65443635f, 0.982186496f},
-std::array<float,2>{0.535184264f, 0.401607513f},
-std::array<float,2>{0.118958615f, 0.623306572f},
-std::array<float,2>{0.356877327f, 0.098052986f},
-std::array<float,2>{0.768164217f, 0.799343824f},
-std::array<float,2>{0.901842713f, 0.184062168f},
-std::array<float,2>{0.444891095f, 0.899142504f},
-std::array<float,2>{0.181525752f, 0.355540723f},
-std::array<float,2>{0.646436155f, 0.703873992f},
-std::array<float,2>{0.747512281f, 0.0595586002f},
-std::array<float,2>{0.192491516f, 0.836178124f},
-std::array<float,2>{0.428723186f, 0.496506989f},
-std::array<float,2>{0.986265182f, 0.521653712f},
-std::array<float,2>{0.845803678f, 0.290750325f},
-std::array<float,2>{0.258126974f, 0.644007146f},
-std::array<float,2>{0.051240705f, 0.192009464f},
-std::array<float,2>{0.583880663f, 0.991164982f},
-std::array<float,2>{0.670096397f, 0.318823218f},
-std::array<float,2>{0.135502979f, 0.731843948f},
-std::array<float,2>{0.47906673f, 0.129935384f},
-std::array<float,2>{0.917387187f, 0.93352741f},
-std::array<float,2>{0.810677707f, 0.0886012092f},
-std::array<float,2>{0.327271283f, 0.759010732f},
-std::array<float,2>{0.0663751364f, 0.420737773f},
-std::array<float,2>{0.506802857f, 0.586039424f},
-std::array<float,2>{0.618318141f, 0.234710604f},
-std::array<float,2>{0.0221581254f, 0.956698954f},
-std::array<float,2>{0.288502097f, 0.276056498f},
-std::array<float,2>{0.833585978f, 0.665457129f},
-std::array<float,2>{0.943293273f, 0.461227357f},
-std::array<float,2>{0.39960745f, 0.551954448f},
-std::array<float,2>{0.238248989f, 0.0146251488f},
-std::array<float,2>{0.703238487f, 0.857393682f},
-std::array<float,2>{0.576426029f, 0.264962703f},
-std::array<float,2>{0.0373638682f, 0.677003384f},
-std::array<float,2>{0.273934394f, 0.222619578f},
-std::array<float,2>{0.873836637f, 0.949898899f},
-std::array<float,2>{0.972210228f, 0.0292257722f},
-std::array<float,2>{0.41570577f, 0.869689405f},
-std::array<float,2>{0.20374313f, 0.44369927f},
-std::array<float,2>{0.726454437f, 0.534136653f},
-std::array<float,2>{0.632023692f, 0.148739159f},
-std::array<float,2>{0.166523725f, 0.917726219f},
-std::array<float,2>{0.455162197f, 0.331271231f},
-std::array<float,2>{0.878666759f, 0.743342161f},
-std::array<float,2>{0.755448163f, 0.426651865f},
-std::array<float,2>{0.36501053f, 0.569065094f},
-std::array<float,2>{0.098874867f, 0.0687387362f},
-std::array<float,2>{0.552076995f, 0.771656156f},
-std::array<float,2>{0.702467799f, 0.483228534f},
-std::array<float,2>{0.233992636f, 0.508832157f},
-std::array<float,2>{0.377045304f, 0.0430732109f},
-std::array<float,2>{0.962082446f, 0.816421688f},
-std::array<float,2>{0.813131332f, 0.210334957f},
-std::array<float,2>{0.300692976f, 0.977775514f},
-std::array<float,2>{0.00642241118f, 0.304027706f},
-std::array<float,2>{0.602352262f, 0.625782371f},
-std::array<float,2>{0.518225968f, 0.122404903f},
-std::array<float,2>{0.0798812583f, 0.784115374f},
-std::array<float,2>{0.343143076f, 0.383332193f},
-std::array<float,2>{0.78515017f, 0.608021557f},
-std::array<float,2>{0.922998607f, 0.369644463f},
-std::array<float,2>{0.492945313f, 0.702163696f},
-std::array<float,2>{0.148740545f, 0.166810393f},
-std::array<float,2>{0.677240908f, 0.877383888f},
-std::array<float,2>{0.594227016f, 0.447174519f},
-std::array<float,2>{0.0151328612f, 0.540700555f},
-std::array<float,2>{0.304780513f, 0.0211363081f},
-std::array<float,2>{0.823406339f, 0.861344039f},
-std::array<float,2>{0.960237205f, 0.23082076f},
-std::array<float,2>{0.387674183f, 0.939615846f},
-std::array<float,2>{0.224769652f, 0.254581183f},
-std::array<float,2>{0.688457847f, 0.680064619f},
-std::array<float,2>{0.683639169f, 0.0776789859f},
-std::array<float,2>{0.147941306f, 0.775336325f},
-std::array<float,2>{0.48975116f, 0.436190039f},
-std::array<float,2>{0.936490059f, 0.573804319f},
-std::array<float,2>{0.793108165f, 0.336137712f},
-std::array<float,2>{0.328550279f, 0.739336789f},
-std::array<float,2>{0.0935513452f, 0.146980539f},
-std::array<float,2>{0.527427077f, 0.910440981f},
-std::array<float,2>{0.730932117f, 0.312172413f},
-std::array<float,2>{0.214347064f, 0.633567333f},
-std::array<float,2>{0.411273122f, 0.214931339f},
-std::array<float,2>{0.983284712f, 0.972463012f},
-std::array<float,2>{0.86708802f, 0.036160741f},
-std::array<float,2>{0.267041087f, 0.822464228f},
-std::array<float,2>{0.0448506661f, 0.471061826f},
-std::array<float,2>{0.564672589f, 0.504653811f},
-std::array<float,2>{0.555711746f, 0.158174217f},
-std::array<float,2>{0.101908237f, 0.888431072f},
-std::array<float,2>{0.371423095f, 0.360265166f},
-std::array<float,2>{0.762533069f, 0.690201581f},
-std::array<float,2>{0.883295357f, 0.377949655f},
-std::array<float,2>{0.468012601f, 0.599350214f},
-std::array<float,2>{0.16054213f, 0.111409076f},
-std::array<float,2>{0.637623191f, 0.79207772f},
-std::array<float,2>{0.510342598f, 0.347922653f},
-std::array<float,2>{0.0729445443f, 0.714036167f},
-std::array<float,2>{0.319990069f, 0.178476825f},
-std::array<float,2>{0.799013853f, 0.894345582f},
-std::array<float,2>{0.912677824f, 0.103559084f},
-std::array<float,2>{0.471907377f, 0.807024777f},
-std::array<float,2>{0.130079672f, 0.39607513f},
-std::array<float,2>{0.657773197f, 0.609655142f},
-std::array<float,2>{0.711232364f, 0.201883957f},
-std::array<float,2>{0.242936134f, 0.996009946f},
-std::array<float,2>{0.394118696f, 0.282331288f},
-std::array<float,2>{0.946045101f, 0.648625612f},
-std::array<float,2>{0.84285897f, 0.484969079f},
-std::array<float,2>{0.293583691f, 0.53024447f},
-std::array<float,2>{0.0266619623f, 0.0491771996f},
-std::array<float,2>{0.614113212f, 0.829634547f},
-std::array<float,2>{0.650808513f, 0.4115192f},
-std::array<float,2>{0.175294727f, 0.584709108f},
-std::array<float,2>{0.451298475f, 0.079764396f},
-std::array<float,2>{0.895694494f, 0.754435062f},
-std::array<float,2>{0.776473165f, 0.133107886f},
-std::array<float,2>{0.350272238f, 0.92502296f},
-std::array<float,2>{0.109710358f, 0.326082915f},
-std::array<float,2>{0.540168941f, 0.719369769f},
-std::array<float,2>{0.590301573f, 0.00232604076f},
-std::array<float,2>{0.0615592785f, 0.846193254f},
-std::array<float,2>{0.256654143f, 0.460445732f},
-std::array<float,2>{0.85267818f, 0.555525959f},
-std::array<float,2>{0.995074213f, 0.273278326f},
-std::array<float,2>{0.434705585f, 0.660438716f},
-std::array<float,2>{0.199219584f, 0.242981851f},
-std::array<float,2>{0.736419261f, 0.962300539f},
-std::array<float,2>{0.608589709f, 0.406998426f},
-std::array<float,2>{0.00190072577f, 0.580070257f},
-std::array<float,2>{0.303293765f, 0.0844294652f},
-std::array<float,2>{0.816877306f, 0.750896573f},
-std::array<float,2>{0.967702091f, 0.13768816f},
-std::array<float,2>{0.381462187f, 0.92641753f},
-std::array<float,2>{0.228482008f, 0.321615428f},
-std::array<float,2>{0.698338747f, 0.724896669f},
-std::array<float,2>{0.673053682f, 0.00607821438f},
-std::array<float,2>{0.155238479f, 0.848398209f},
-std::array<float,2>{0.499616772f, 0.455991864f},
-std::array<float,2>{0.926110566f, 0.56242758f},
-std::array<float,2>{0.785963416f, 0.268586546f},
-std::array<float,2>{0.337256908f, 0.659486651f},
-std::array<float,2>{0.0856352448f, 0.247369871f},
-std::array<float,2>{0.519643307f, 0.965064049f},
-std::array<float,2>{0.719450355f, 0.346090168f},
-std::array<float,2>{0.207466006f, 0.718447328f},
-std::array<float,2>{0.418790847f, 0.172814429f},
-std::array<float,2>{0.973751545f, 0.896877766f},
-std::array<float,2>{0.86811012f, 0.106539309f},
-std::array<float,2>{0.277678907f, 0.80997175f},
-std::array<float,2>{0.0336835682f, 0.391003102f},
-std::array<float,2>{0.573042274f, 0.616430342f},
-std::array<float,2>{0.550647438f, 0.196774453f},
-std::array<float,2>{0.0962392241f, 0.997794151f},
-std::array<float,2>{0.360124141f, 0.287751615f},
-std::array<float,2>{0.750840187f, 0.652882576f},
-std::array<float,2>{0.88231653f, 0.492020547f},
-std::array<float,2>{0.457484156f, 0.524477005f},
-std::array<float,2>{0.168213785f, 0.0519508645f},
-std::array<float,2>{0.627462327f, 0.834715486f},
-std::array<float,2>{0.501446247f, 0.306094617f},
-std::array<float,2>{0.0667295232f, 0.63754499f},
-std::array<float,2>{0.320326924f, 0.214839101f},
-std::array<float,2>{0.805565059f, 0.972980618f},
-std::array<float,2>{0.919556201f, 0.032408163f},
-std::array<float,2>{0.48427549f, 0.825526536f},
-std::array<float,2>{0.137514159f, 0.475055575f},
-std::array<float,2>{0.664384782f, 0.501178503f},
-std::array<float,2>{0.708642662f, 0.160945967f},
-std::array<float,2>{0.241451576f, 0.88322252f},
-std::array<float,2>{0.40497908f, 0.364061981f},
-std::array<float,2>{0.940706074f, 0.694844782f},
-std::array<float,2>{0.830429375f, 0.382081658f},
-std::array<float,2>{0.282685012f, 0.597319424f},
-std::array<float,2>{0.0157616343f, 0.116989538f},
-std::array<float,2>{0.624426842f, 0.795852721f},
-std::array<float,2>{0.642996907f, 0.450303197f},
-std::array<float,2>{0.18584083f, 0.54529947f},
-std::array<float,2>{0.441147029f, 0.0164057482f},
-std::array<float,2>{0.905099332f, 0.865378559f},
-std::array<float,2>{0.771314681f, 0.229502186f},
-std::array<float,2>{0.35207811f, 0.942031026f},
-std::array<float,2>{0.124530017f, 0.252544671f},
-std::array<float,2>{0.535033107f, 0.685827971f},
-std::array<float,2>{0.58052671f, 0.0730739161f},
-std::array<float,2>{0.0468760058f, 0.778870463f},
-std::array<float,2>{0.264429092f, 0.430882812f},
-std::array<float,2>{0.84877044f, 0.576060057f},
-std::array<float,2>{0.992109597f, 0.341236085f},
-std::array<float,2>{0.424962461f, 0.734926999f},
-std::array<float,2>{0.189169168f, 0.143832102f},
-std::array<float,2>{0.743664086f, 0.908386052f},
-std::array<float,2>{0.544068754f, 0.478752851f},
-std::array<float,2>{0.116924897f, 0.513663948f},
-std::array<float,2>{0.345953286f, 0.0423683785f},
-std::array<float,2>{0.77883935f, 0.8145383f},
-std::array<float,2>{0.891198277f, 0.205924764f},
-std::array<float,2>{0.446381778f, 0.98137641f},
-std::array<float,2>{0.177240372f, 0.298380286f},
-std::array<float,2>{0.652713299f, 0.632070184f},
-std::array<float,2>{0.739814103f, 0.117929056f},
-std::array<float,2>{0.197558686f, 0.788518846f},
-std::array<float,2>{0.430419236f, 0.386923462f},
-std::array<float,2>{0.998174667f, 0.603634834f},
-std::array<float,2>{0.855921388f, 0.372970045f},
-std::array<float,2>{0.25150007f, 0.698461056f},
-std::array<float,2>{0.0564763583f, 0.168981075f},
-std::array<float,2>{0.587604344f, 0.879590094f},
-std::array<float,2>{0.663283229f, 0.259121776f},
-std::array<float,2>{0.128532708f, 0.67489326f},
-std::array<float,2>{0.476221621f, 0.225762188f},
-std::array<float,2>{0.909424901f, 0.947468042f},
-std::array<float,2>{0.804615617f, 0.0255355742f},
-std::array<float,2>{0.314469337f, 0.873542249f},
-std::array<float,2>{0.0742357969f, 0.438848883f},
-std::array<float,2>{0.513587475f, 0.535528958f},
-std::array<float,2>{0.612305939f, 0.155190989f},
-std::array<float,2>{0.0307306591f, 0.919029772f},
-std::array<float,2>{0.291061848f, 0.335292816f},
-std::array<float,2>{0.839336216f, 0.749824941f},
-std::array<float,2>{0.952693641f, 0.423861027f},
-std::array<float,2>{0.397484452f, 0.56420356f},
-std::array<float,2>{0.247058049f, 0.064265728f},
-std::array<float,2>{0.715296626f, 0.768963218f},
-std::array<float,2>{0.567465961f, 0.313028306f},
-std::array<float,2>{0.0401272848f, 0.727082193f},
-std::array<float,2>{0.270043671f, 0.128086343f},
-std::array<float,2>{0.860673785f, 0.935560942f},
-std::array<float,2>{0.977564991f, 0.0926162824f},
-std::array<float,2>{0.409346879f, 0.762313247f},
-std::array<float,2>{0.214991808f, 0.416092366f},
-std::array<float,2>{0.728258729f, 0.591570854f},
-std::array<float,2>{0.635235488f, 0.240145579f},
-std::array<float,2>{0.158402175f, 0.960275114f},
-std::array<float,2>{0.462118477f, 0.280968964f},
-std::array<float,2>{0.889057636f, 0.66964817f},
-std::array<float,2>{0.758182466f, 0.467117786f},
-std::array<float,2>{0.369955659f, 0.549272835f},
-std::array<float,2>{0.107566275f, 0.00985177699f},
-std::array<float,2>{0.560945213f, 0.854057968f},
-std::array<float,2>{0.692685604f, 0.405529141f},
-std::array<float,2>{0.22074537f, 0.619021714f},
-std::array<float,2>{0.385348111f, 0.0955107361f},
-std::array<float,2>{0.956323028f, 0.803169191f},
-std::array<float,2>{0.827552557f, 0.180407465f},
-std::array<float,2>{0.310969949f, 0.903911233f},
-std::array<float,2>{0.0116857784f, 0.352369338f},
-std::array<float,2>{0.59897691f, 0.708959877f},
-std::array<float,2>{0.52687782f, 0.0582784936f},
-std::array<float,2>{0.0890281498f, 0.840382457f},
-std::array<float,2>{0.33514604f, 0.493551493f},
-std::array<float,2>{0.789940655f, 0.517687857f},
-std::array<float,2>{0.931731284f, 0.293223679f},
-std::array<float,2>{0.485508561f, 0.647291303f},
-std::array<float,2>{0.141230062f, 0.188504472f},
-std::array<float,2>{0.682930768f, 0.987344086f},
-std::array<float,2>{0.516644716f, 0.384496063f},
-std::array<float,2>{0.0812319517f, 0.608846068f},
-std::array<float,2>{0.339913428f, 0.121909343f},
-std::array<float,2>{0.781413674f, 0.784999788f},
-std::array<float,2>{0.925321221f, 0.167859733f},
-std::array<float,2>{0.495200247f, 0.87795198f},
-std::array<float,2>{0.150724858f, 0.370123804f},
-std::array<float,2>{0.67806226f, 0.701557755f},
-std::array<float,2>{0.699967384f, 0.0445752107f},
-std::array<float,2>{0.232096747f, 0.817641258f},
-std::array<float,2>{0.376820356f, 0.48364535f},
-std::array<float,2>{0.96399039f, 0.508706927f},
-std::array<float,2>{0.81530863f, 0.303446651f},
-std::array<float,2>{0.296912849f, 0.625991583f},
-std::array<float,2>{0.00479819113f, 0.209412187f},
-std::array<float,2>{0.603774726f, 0.976935923f},
-std::array<float,2>{0.629259765f, 0.330388755f},
-std::array<float,2>{0.164767131f, 0.743125081f},
-std::array<float,2>{0.454276711f, 0.149902761f},
-std::array<float,2>{0.875455797f, 0.916143477f},
-std::array<float,2>{0.756341457f, 0.0695525706f},
-std::array<float,2>{0.366126597f, 0.773024499f},
-std::array<float,2>{0.100117378f, 0.426816344f},
-std::array<float,2>{0.553142428f, 0.569618344f},
-std::array<float,2>{0.574727952f, 0.221103579f},
-std::array<float,2>{0.0355210006f, 0.950878859f},
-std::array<float,2>{0.275559694f, 0.264312387f},
-std::array<float,2>{0.871927202f, 0.675882757f},
-std::array<float,2>{0.969287038f, 0.445001721f},
-std::array<float,2>{0.416159064f, 0.53437072f},
-std::array<float,2>{0.206112936f, 0.0281494819f},
-std::array<float,2>{0.723480165f, 0.871038914f},
-std::array<float,2>{0.619815469f, 0.276968926f},
-std::array<float,2>{0.0198008474f, 0.664170027f},
-std::array<float,2>{0.285615802f, 0.235522136f},
-std::array<float,2>{0.834634364f, 0.956047654f},
-std::array<float,2>{0.943720698f, 0.0147908311f},
-std::array<float,2>{0.401853234f, 0.856347024f},
-std::array<float,2>{0.23559846f, 0.462791473f},
-std::array<float,2>{0.706725955f, 0.551545203f},
-std::array<float,2>{0.667971194f, 0.129729733f},
-std::array<float,2>{0.133404002f, 0.931764126f},
-std::array<float,2>{0.477963924f, 0.319633394f},
-std::array<float,2>{0.914742172f, 0.730885506f},
-std::array<float,2>{0.809805214f, 0.421007544f},
-std::array<float,2>{0.325170696f, 0.587775886f},
-std::array<float,2>{0.06288369f, 0.0897227526f},
-std::array<float,2>{0.504199445f, 0.758196712f},
-std::array<float,2>{0.748668253f, 0.497169733f},
-std::array<float,2>{0.193751037f, 0.523023427f},
-std::array<float,2>{0.426368743f, 0.0599642359f},
-std::array<float,2>{0.987911165f, 0.837544382f},
-std::array<float,2>{0.84444356f, 0.193266705f},
-std::array<float,2>{0.260789484f, 0.992165685f},
-std::array<float,2>{0.0541061163f, 0.289196879f},
-std::array<float,2>{0.585871637f, 0.643124342f},
-std::array<float,2>{0.537539184f, 0.0994514674f},
-std::array<float,2>{0.120336846f, 0.800090551f},
-std::array<float,2>{0.357737809f, 0.400596499f},
-std::array<float,2>{0.765780747f, 0.624658048f},
-std::array<float,2>{0.899942458f, 0.356778145f},
-std::array<float,2>{0.44214955f, 0.7048738f},
-std::array<float,2>{0.182009622f, 0.185491905f},
-std::array<float,2>{0.647229254f, 0.89977026f},
-std::array<float,2>{0.593603075f, 0.459421724f},
-std::array<float,2>{0.0593442097f, 0.555775046f},
-std::array<float,2>{0.253928959f, 0.00368696218f},
-std::array<float,2>{0.855163634f, 0.847410262f},
-std::array<float,2>{0.993369579f, 0.243280008f},
-std::array<float,2>{0.436115205f, 0.961193025f},
-std::array<float,2>{0.202008352f, 0.272444665f},
-std::array<float,2>{0.735391796f, 0.661554217f},
-std::array<float,2>{0.649856508f, 0.0782961622f},
-std::array<float,2>{0.172937274f, 0.755176663f},
-std::array<float,2>{0.451060265f, 0.41050896f},
-std::array<float,2>{0.897816002f, 0.585026205f},
-std::array<float,2>{0.774765611f, 0.325006545f},
-std::array<float,2>{0.347854525f, 0.719957292f},
-std::array<float,2>{0.111515194f, 0.133854046f},
-std::array<float,2>{0.54261595f, 0.924114704f},
-std::array<float,2>{0.713628471f, 0.281993926f},
-std::array<float,2>{0.244165212f, 0.649883926f},
-std::array<float,2>{0.391877115f, 0.203086376f},
-std::array<float,2>{0.947762311f, 0.994413912f},
-std::array<float,2>{0.840211928f, 0.0504384823f},
-std::array<float,2>{0.295865327f, 0.828736663f},
-std::array<float,2>{0.0243729204f, 0.485734254f},
-std::array<float,2>{0.616154075f, 0.53095603f},
-std::array<float,2>{0.507855356f, 0.178911299f},
-std::array<float,2>{0.071612522f, 0.89321667f},
-std::array<float,2>{0.316486895f, 0.349580228f},
-std::array<float,2>{0.797477961f, 0.713159502f},
-std::array<float,2>{0.910666943f, 0.394571066f},
-std::array<float,2>{0.470525414f, 0.610774875f},
-std::array<float,2>{0.132572502f, 0.105072491f},
-std::array<float,2>{0.658841312f, 0.808242023f},
-std::array<float,2>{0.557763159f, 0.360588372f},
-std::array<float,2>{0.10368745f, 0.690875769f},
-std::array<float,2>{0.37436831f, 0.15679495f},
-std::array<float,2>{0.765476882f, 0.886843264f},
-std::array<float,2>{0.886050642f, 0.113204524f},
-std::array<float,2>{0.466775566f, 0.791989505f},
-std::array<float,2>{0.163164273f, 0.377116978f},
-std::array<float,2>{0.63995707f, 0.597927272f},
-std::array<float,2>{0.734187484f, 0.216117531f},
-std::array<float,2>{0.211045891f, 0.971648633f},
-std::array<float,2>{0.412638634f, 0.310764402f},
-std::array<float,2>{0.980992675f, 0.634569645f},
-std::array<float,2>{0.864902854f, 0.472290188f},
-std::array<float,2>{0.269184202f, 0.505851865f},
-std::array<float,2>{0.046134036f, 0.0353876017f},
-std::array<float,2>{0.563137114f, 0.823992729f},
-std::array<float,2>{0.68652153f, 0.436899006f},
-std::array<float,2>{0.144766316f, 0.572969496f},
-std::array<float,2>{0.490296245f, 0.076387465f},
-std::array<float,2>{0.934790015f, 0.774116457f},
-std::array<float,2>{0.795594633f, 0.14787358f},
-std::array<float,2>{0.331321627f, 0.911696911f},
-std::array<float,2>{0.0907761753f, 0.33776173f},
-std::array<float,2>{0.530450583f, 0.738702536f},
-std::array<float,2>{0.597375274f, 0.0200072508f},
-std::array<float,2>{0.0135350153f, 0.863015532f},
-std::array<float,2>{0.30688265f, 0.44574672f},
-std::array<float,2>{0.820740283f, 0.539361596f},
-std::array<float,2>{0.957245827f, 0.255833924f},
-std::array<float,2>{0.388990343f, 0.681271136f},
-std::array<float,2>{0.224266902f, 0.232244045f},
-std::array<float,2>{0.690037251f, 0.94091928f},
-std::array<float,2>{0.571404159f, 0.393797308f},
-std::array<float,2>{0.0329891294f, 0.613985837f},
-std::array<float,2>{0.28054902f, 0.107783407f},
-std::array<float,2>{0.869584024f, 0.811324418f},
-std::array<float,2>{0.97524029f, 0.17558898f},
-std::array<float,2>{0.421165526f, 0.89585048f},
-std::array<float,2>{0.210454166f, 0.344264895f},
-std::array<float,2>{0.72175169f, 0.715847254f},
-std::array<float,2>{0.625608087f, 0.053474728f},
-std::array<float,2>{0.171296254f, 0.833648622f},
-std::array<float,2>{0.46048674f, 0.489641219f},
-std::array<float,2>{0.880295336f, 0.527116656f},
-std::array<float,2>{0.752753377f, 0.285755217f},
-std::array<float,2>{0.362710863f, 0.654998481f},
-std::array<float,2>{0.0948239565f, 0.197352529f},
-std::array<float,2>{0.547483027f, 0.999088466f},
-std::array<float,2>{0.697136879f, 0.323944509f},
-std::array<float,2>{0.229369879f, 0.722843289f},
-std::array<float,2>{0.379437953f, 0.139799178f},
-std::array<float,2>{0.966191828f, 0.928102374f},
-std::array<float,2>{0.818369091f, 0.0823281854f},
-std::array<float,2>{0.302598089f, 0.752505004f},
-std::array<float,2>{0.00286283554f, 0.409142703f},
-std::array<float,2>{0.607179165f, 0.580503285f},
-std::array<float,2>{0.522380769f, 0.2489869f},
-std::array<float,2>{0.0828508288f, 0.968309402f},
-std::array<float,2>{0.339738429f, 0.266305834f},
-std::array<float,2>{0.78834182f, 0.657696605f},
-std::array<float,2>{0.927801847f, 0.453280479f},
-std::array<float,2>{0.496630639f, 0.559027433f},
-std::array<float,2>{0.153847575f, 0.00538580306f},
-std::array<float,2>{0.674064338f, 0.850565791f},
-std::array<float,2>{0.532981396f, 0.251091123f},
-std::array<float,2>{0.121548943f, 0.685168326f},
-std::array<float,2>{0.35379374f, 0.226577803f},
-std::array<float,2>{0.773179293f, 0.943720162f},
-std::array<float,2>{0.902498126f, 0.0189493671f},
-std::array<float,2>{0.438593835f, 0.863841414f},
-std::array<float,2>{0.185461313f, 0.451791912f},
-std::array<float,2>{0.640754879f, 0.543152273f},
-std::array<float,2>{0.744171679f, 0.14207004f},
-std::array<float,2>{0.191120863f, 0.907779932f},
-std::array<float,2>{0.423442274f, 0.3436746f},
-std::array<float,2>{0.988816738f, 0.737630188f},
-std::array<float,2>{0.850211561f, 0.432106048f},
-std::array<float,2>{0.262790889f, 0.577367067f},
-std::array<float,2>{0.050156761f, 0.0707006231f},
-std::array<float,2>{0.580075264f, 0.779770911f},
-std::array<float,2>{0.667056799f, 0.474334866f},
-std::array<float,2>{0.140469208f, 0.502285063f},
-std::array<float,2>{0.4808622f, 0.0336094983f},
-std::array<float,2>{0.92062068f, 0.826324344f},
-std::array<float,2>{0.807806849f, 0.21215117f},
-std::array<float,2>{0.322696924f, 0.975903451f},
-std::array<float,2>{0.0696315616f, 0.307594776f},
-std::array<float,2>{0.503492594f, 0.639053166f},
-std::array<float,2>{0.621409535f, 0.114745058f},
-std::array<float,2>{0.0176315494f, 0.793255746f},
-std::array<float,2>{0.284075141f, 0.379539788f},
-std::array<float,2>{0.830022871f, 0.594514787f},
-std::array<float,2>{0.939409018f, 0.366844505f},
-std::array<float,2>{0.403130084f, 0.691539824f},
-std::array<float,2>{0.238829941f, 0.162594348f},
-std::array<float,2>{0.709584653f, 0.885735095f},
-std::array<float,2>{0.515447855f, 0.440134048f},
-std::array<float,2>{0.07774771f, 0.537628412f},
-std::array<float,2>{0.314013958f, 0.0235800985f},
-std::array<float,2>{0.801060438f, 0.871329725f},
-std::array<float,2>{0.908087492f, 0.224429563f},
-std::array<float,2>{0.473575026f, 0.945946276f},
-std::array<float,2>{0.125518218f, 0.261531681f},
-std::array<float,2>{0.660725355f, 0.672466636f},
-std::array<float,2>{0.716914773f, 0.0649257079f},
-std::array<float,2>{0.249033734f, 0.766673088f},
-std::array<float,2>{0.394877791f, 0.423765808f},
-std::array<float,2>{0.949708819f, 0.564775527f},
-std::array<float,2>{0.836472929f, 0.332509607f},
-std::array<float,2>{0.290727586f, 0.746778727f},
-std::array<float,2>{0.0288755614f, 0.152516976f},
-std::array<float,2>{0.609980524f, 0.92116648f},
-std::array<float,2>{0.655856311f, 0.299775064f},
-std::array<float,2>{0.178017616f, 0.629156947f},
-std::array<float,2>{0.448595405f, 0.204432309f},
-std::array<float,2>{0.892712653f, 0.982520342f},
-std::array<float,2>{0.779389203f, 0.0396402329f},
-std::array<float,2>{0.344985485f, 0.812872946f},
-std::array<float,2>{0.114145905f, 0.477129102f},
-std::array<float,2>{0.545896292f, 0.515254259f},
-std::array<float,2>{0.588332355f, 0.171224743f},
-std::array<float,2>{0.0584507249f, 0.88185364f},
-std::array<float,2>{0.25377813f, 0.373096317f},
-std::array<float,2>{0.85927546f, 0.69720459f},
-std::array<float,2>{0.996416807f, 0.389005333f},
-std::array<float,2>{0.432931125f, 0.601858199f},
-std::array<float,2>{0.196097672f, 0.119754858f},
-std::array<float,2>{0.740272522f, 0.785771072f},
-std::array<float,2>{0.599950671f, 0.355059147f},
-std::array<float,2>{0.00824407022f, 0.709023595f},
-std::array<float,2>{0.309516966f, 0.183425382f},
-std::array<float,2>{0.824715137f, 0.905673385f},
-std::array<float,2>{0.953952432f, 0.0957547054f},
-std::array<float,2>{0.383011609f, 0.800803304f},
-std::array<float,2>{0.220577016f, 0.403720587f},
-std::array<float,2>{0.694282234f, 0.619240105f},
-std::array<float,2>{0.680191636f, 0.190725595f},
-std::array<float,2>{0.144076556f, 0.985710502f},
-std::array<float,2>{0.486882299f, 0.296705246f},
-std::array<float,2>{0.930710137f, 0.646054447f},
-std::array<float,2>{0.791732907f, 0.494510442f},
-std::array<float,2>{0.333244681f, 0.515910923f},
-std::array<float,2>{0.0873400569f, 0.05522421f},
-std::array<float,2>{0.525334895f, 0.84246248f},
-std::array<float,2>{0.730101883f, 0.415670246f},
-std::array<float,2>{0.217098698f, 0.593035221f},
-std::array<float,2>{0.407192379f, 0.0912972614f},
-std::array<float,2>{0.979207575f, 0.763750374f},
-std::array<float,2>{0.862554193f, 0.126584381f},
-std::array<float,2>{0.271746457f, 0.935019672f},
-std::array<float,2>{0.0413539559f, 0.315600902f},
-std::array<float,2>{0.570199788f, 0.729264021f},
-std::array<float,2>{0.558594942f, 0.00784964766f},
-std::array<float,2>{0.106937662f, 0.851585865f},
-std::array<float,2>{0.367482036f, 0.465667814f},
-std::array<float,2>{0.759907603f, 0.548812509f},
-std::array<float,2>{0.886736155f, 0.279092103f},
-std::array<float,2>{0.464823693f, 0.670324981f},
-std::array<float,2>{0.156317577f, 0.241760045f},
-std::array<float,2>{0.633971274f, 0.958970249f},
-std::array<float,2>{0.55149287f, 0.427924782f},
-std::array<float,2>{0.0982267782f, 0.566436291f},
-std::array<float,2>{0.364108562f, 0.0683238879f},
-std::array<float,2>{0.754433274f, 0.770676672f},
-std::array<float,2>{0.877494454f, 0.151003525f},
-std::array<float,2>{0.456684053f, 0.915619731f},
-std::array<float,2>{0.167219371f, 0.329833239f},
-std::array<float,2>{0.631568968f, 0.745177925f},
-std::array<float,2>{0.724721491f, 0.0296653397f},
-std::array<float,2>{0.204885006f, 0.867262125f},
-std::array<float,2>{0.414946467f, 0.441677809f},
-std::array<float,2>{0.971000552f, 0.532772124f},
-std::array<float,2>{0.874849737f, 0.262318164f},
-std::array<float,2>{0.274860263f, 0.678389251f},
-std::array<float,2>{0.0387301445f, 0.219049379f},
-std::array<float,2>{0.577950895f, 0.951631904f},
-std::array<float,2>{0.676724136f, 0.36908558f},
-std::array<float,2>{0.149608672f, 0.700826049f},
-std::array<float,2>{0.493215799f, 0.165536329f},
-std::array<float,2>{0.922605455f, 0.87566191f},
-std::array<float,2>{0.783605337f, 0.124176964f},
-std::array<float,2>{0.342546791f, 0.781847417f},
-std::array<float,2>{0.0786075592f, 0.385893255f},
-std::array<float,2>{0.519383252f, 0.605897963f},
-std::array<float,2>{0.603101373f, 0.207229361f},
-std::array<float,2>{0.00713661313f, 0.979551733f},
-std::array<float,2>{0.298891574f, 0.302144229f},
-std::array<float,2>{0.813818872f, 0.627165616f},
-std::array<float,2>{0.961800039f, 0.481364846f},
-std::array<float,2>{0.378355652f, 0.511632144f},
-std::array<float,2>{0.232720718f, 0.0455574282f},
-std::array<float,2>{0.701220512f, 0.819926023f},
-std::array<float,2>{0.582602262f, 0.291932195f},
-std::array<float,2>{0.0526650101f, 0.641526282f},
-std::array<float,2>{0.259554654f, 0.194832817f},
-std::array<float,2>{0.847361088f, 0.988876939f},
-std::array<float,2>{0.984945118f, 0.062176168f},
-std::array<float,2>{0.428426147f, 0.838591337f},
-std::array<float,2>{0.192124858f, 0.499764353f},
-std::array<float,2>{0.746521831f, 0.520191908f},
-std::array<float,2>{0.645405173f, 0.185785279f},
-std::array<float,2>{0.179921836f, 0.900646448f},
-std::array<float,2>{0.443783194f, 0.358795822f},
-std::array<float,2>{0.900481164f, 0.70647794f},
-std::array<float,2>{0.768718719f, 0.399750739f},
-std::array<float,2>{0.355509967f, 0.622446418f},
-std::array<float,2>{0.117773496f, 0.100330062f},
-std::array<float,2>{0.536803246f, 0.798652232f},
-std::array<float,2>{0.705056965f, 0.463847309f},
-std::array<float,2>{0.236834154f, 0.554391205f},
-std::array<float,2>{0.398503363f, 0.0117935687f},
-std::array<float,2>{0.942162395f, 0.858274221f},
-std::array<float,2>{0.832719326f, 0.236425787f},
-std::array<float,2>{0.287669003f, 0.954161167f},
-std::array<float,2>{0.0231868848f, 0.274535656f},
-std::array<float,2>{0.618160605f, 0.667822182f},
-std::array<float,2>{0.507140517f, 0.0869241431f},
-std::array<float,2>{0.0651148558f, 0.761274695f},
-std::array<float,2>{0.326993167f, 0.41800487f},
-std::array<float,2>{0.812248409f, 0.589192331f},
-std::array<float,2>{0.916350365f, 0.317878157f},
-std::array<float,2>{0.479783922f, 0.73401016f},
-std::array<float,2>{0.136194244f, 0.132736146f},
-std::array<float,2>{0.671419859f, 0.930935144f},
-std::array<float,2>{0.614319086f, 0.48664543f},
-std::array<float,2>{0.0257678572f, 0.527903497f},
-std::array<float,2>{0.294549018f, 0.0483480394f},
-std::array<float,2>{0.841817558f, 0.830455065f},
-std::array<float,2>{0.947036326f, 0.200048372f},
-std::array<float,2>{0.39279291f, 0.993112862f},
-std::array<float,2>{0.243685782f, 0.284579873f},
-std::array<float,2>{0.711914957f, 0.650663435f},
-std::array<float,2>{0.656354666f, 0.103084303f},
-std::array<float,2>{0.129508868f, 0.805623651f},
-std::array<float,2>{0.471392512f, 0.39681536f},
-std::array<float,2>{0.91333431f, 0.613002479f},
-std::array<float,2>{0.799848795f, 0.350114495f},
-std::array<float,2>{0.318522334f, 0.711259425f},
-std::array<float,2>{0.0738477483f, 0.175971672f},
-std::array<float,2>{0.511222422f, 0.89083004f},
-std::array<float,2>{0.738045454f, 0.271242589f},
-std::array<float,2>{0.200944036f, 0.663306534f},
-std::array<float,2>{0.434444845f, 0.244495839f},
-std::array<float,2>{0.995691538f, 0.963193715f},
-std::array<float,2>{0.851999402f, 0.00142449036f},
-std::array<float,2>{0.257503241f, 0.844433129f},
-std::array<float,2>{0.0609156527f, 0.457608223f},
-std::array<float,2>{0.591366827f, 0.558108866f},
-std::array<float,2>{0.539701164f, 0.135975987f},
-std::array<float,2>{0.110382155f, 0.922131479f},
-std::array<float,2>{0.351115465f, 0.327120572f},
-std::array<float,2>{0.776252031f, 0.722469389f},
-std::array<float,2>{0.894743741f, 0.412879378f},
-std::array<float,2>{0.452386111f, 0.583673f},
-std::array<float,2>{0.174219787f, 0.0817804709f},
-std::array<float,2>{0.651428044f, 0.756124318f},
-std::array<float,2>{0.528642416f, 0.339552552f},
-std::array<float,2>{0.0925535411f, 0.741512954f},
-std::array<float,2>{0.329885632f, 0.146440849f},
-std::array<float,2>{0.7946105f, 0.912176073f},
-std::array<float,2>{0.937308013f, 0.074749887f},
-std::array<float,2>{0.488824368f, 0.777024925f},
-std::array<float,2>{0.147411957f, 0.43517971f},
-std::array<float,2>{0.684632599f, 0.570677578f},
-std::array<float,2>{0.68875432f, 0.234370112f},
-std::array<float,2>{0.225771427f, 0.938993931f},
-std::array<float,2>{0.388103157f, 0.256227583f},
-std::array<float,2>{0.959119797f, 0.682257473f},
-std::array<float,2>{0.82229048f, 0.448153257f},
-std::array<float,2>{0.306349397f, 0.541689336f},
-std::array<float,2>{0.0142694432f, 0.0218953397f},
-std::array<float,2>{0.594778001f, 0.860709727f},
-std::array<float,2>{0.637882888f, 0.376816332f},
-std::array<float,2>{0.161360592f, 0.601348758f},
-std::array<float,2>{0.466914296f, 0.110910095f},
-std::array<float,2>{0.884157598f, 0.790187478f},
-std::array<float,2>{0.763132989f, 0.158410534f},
-std::array<float,2>{0.37264204f, 0.889450192f},
-std::array<float,2>{0.103327028f, 0.361727059f},
-std::array<float,2>{0.554783404f, 0.689228237f},
-std::array<float,2>{0.566262424f, 0.0379460864f},
-std::array<float,2>{0.0430027172f, 0.821094632f},
-std::array<float,2>{0.266270459f, 0.46942091f},
-std::array<float,2>{0.8656829f, 0.507676125f},
-std::array<float,2>{0.983626842f, 0.310093224f},
-std::array<float,2>{0.410822421f, 0.636537671f},
-std::array<float,2>{0.212972671f, 0.218002781f},
-std::array<float,2>{0.731606066f, 0.96901077f},
-std::array<float,2>{0.599195123f, 0.404192001f},
-std::array<float,2>{0.0112248557f, 0.619660854f},
-std::array<float,2>{0.311076164f, 0.0964926258f},
-std::array<float,2>{0.82773f, 0.801549137f},
-std::array<float,2>{0.956712365f, 0.183072537f},
-std::array<float,2>{0.384827465f, 0.906074822f},
-std::array<float,2>{0.221431419f, 0.354798079f},
-std::array<float,2>{0.693307281f, 0.709579229f},
-std::array<float,2>{0.683456242f, 0.0547040105f},
-std::array<float,2>{0.140783459f, 0.841804147f},
-std::array<float,2>{0.486120939f, 0.494636774f},
-std::array<float,2>{0.932495117f, 0.516231716f},
-std::array<float,2>{0.789548159f, 0.296053946f},
-std::array<float,2>{0.335544109f, 0.645995915f},
-std::array<float,2>{0.0893865973f, 0.191111207f},
-std::array<float,2>{0.526625156f, 0.985957921f},
-std::array<float,2>{0.727771938f, 0.316144675f},
-std::array<float,2>{0.215453759f, 0.728758037f},
-std::array<float,2>{0.410012752f, 0.126020521f},
-std::array<float,2>{0.978060186f, 0.935368836f},
-std::array<float,2>{0.861132085f, 0.0917931199f},
-std::array<float,2>{0.269553185f, 0.76425004f},
-std::array<float,2>{0.040871013f, 0.415446937f},
-std::array<float,2>{0.568067968f, 0.593720317f},
-std::array<float,2>{0.561514556f, 0.241523504f},
-std::array<float,2>{0.1079107f, 0.958069801f},
-std::array<float,2>{0.369606465f, 0.278720975f},
-std::array<float,2>{0.75856626f, 0.670614839f},
-std::array<float,2>{0.88940084f, 0.465146065f},
-std::array<float,2>{0.462480515f, 0.547991872f},
-std::array<float,2>{0.158925563f, 0.00854670815f},
-std::array<float,2>{0.635688424f, 0.852416754f},
-std::array<float,2>{0.513119876f, 0.260806739f},
-std::array<float,2>{0.0750962719f, 0.672214925f},
-std::array<float,2>{0.31536454f, 0.223781452f},
-std::array<float,2>{0.803876102f, 0.945639312f},
-std::array<float,2>{0.910071552f, 0.0240244325f},
-std::array<float,2>{0.476060599f, 0.871611297f},
-std::array<float,2>{0.127944186f, 0.439824343f},
-std::array<float,2>{0.663721681f, 0.537218571f},
-std::array<float,2>{0.715778172f, 0.153228596f},
-std::array<float,2>{0.246269345f, 0.921456695f},
-std::array<float,2>{0.39839536f, 0.3325679f},
-std::array<float,2>{0.952578604f, 0.746363878f},
-std::array<float,2>{0.839407504f, 0.423254162f},
-std::array<float,2>{0.291800499f, 0.565291941f},
-std::array<float,2>{0.0311516896f, 0.065337494f},
-std::array<float,2>{0.61293608f, 0.767456889f},
-std::array<float,2>{0.653044224f, 0.476791888f},
-std::array<float,2>{0.177276224f, 0.515085638f},
-std::array<float,2>{0.446952105f, 0.0392503105f},
-std::array<float,2>{0.890712738f, 0.813459635f},
-std::array<float,2>{0.778738439f, 0.204700768f},
-std::array<float,2>{0.34638378f, 0.983193696f},
-std::array<float,2>{0.116422303f, 0.298864603f},
-std::array<float,2>{0.544508636f, 0.629439056f},
-std::array<float,2>{0.58716464f, 0.119141318f},
-std::array<float,2>{0.0560854077f, 0.785498857f},
-std::array<float,2>{0.251104176f, 0.389205843f},
-std::array<float,2>{0.856340647f, 0.602143705f},
-std::array<float,2>{0.998616934f, 0.373957396f},
-std::array<float,2>{0.429922312f, 0.696588218f},
-std::array<float,2>{0.197897419f, 0.171702996f},
-std::array<float,2>{0.739382505f, 0.882647932f},
-std::array<float,2>{0.534573436f, 0.451230973f},
-std::array<float,2>{0.124332897f, 0.543922901f},
-std::array<float,2>{0.351994991f, 0.0194886662f},
-std::array<float,2>{0.770513356f, 0.863293588f},
-std::array<float,2>{0.904601991f, 0.227406502f},
-std::array<float,2>{0.440693229f, 0.944291353f},
-std::array<float,2>{0.186256766f, 0.25183931f},
-std::array<float,2>{0.643519163f, 0.684662342f},
-std::array<float,2>{0.743587971f, 0.0708683804f},
-std::array<float,2>{0.18886745f, 0.780255437f},
-std::array<float,2>{0.425585777f, 0.432207406f},
-std::array<float,2>{0.991431713f, 0.577830791f},
-std::array<float,2>{0.84957093f, 0.343013167f},
-std::array<float,2>{0.263732672f, 0.738151073f},
-std::array<float,2>{0.0474861711f, 0.14221108f},
-std::array<float,2>{0.580588222f, 0.907705069f},
-std::array<float,2>{0.664916277f, 0.306736052f},
-std::array<float,2>{0.137095675f, 0.639307976f},
-std::array<float,2>{0.483823478f, 0.212533906f},
-std::array<float,2>{0.919213414f, 0.976198494f},
-std::array<float,2>{0.804840565f, 0.0337625705f},
-std::array<float,2>{0.321041167f, 0.826833844f},
-std::array<float,2>{0.0669075027f, 0.473654807f},
-std::array<float,2>{0.501566708f, 0.502732098f},
-std::array<float,2>{0.624731183f, 0.162818983f},
-std::array<float,2>{0.0165431034f, 0.884798944f},
-std::array<float,2>{0.282998234f, 0.366480172f},
-std::array<float,2>{0.830611885f, 0.692034721f},
-std::array<float,2>{0.940969467f, 0.379268616f},
-std::array<float,2>{0.404420972f, 0.593893588f},
-std::array<float,2>{0.241863817f, 0.114789292f},
-std::array<float,2>{0.708353341f, 0.793687344f},
-std::array<float,2>{0.572532535f, 0.343980968f},
-std::array<float,2>{0.0337750539f, 0.71653074f},
-std::array<float,2>{0.278319448f, 0.174934313f},
-std::array<float,2>{0.867292583f, 0.896008551f},
-std::array<float,2>{0.974409401f, 0.108129762f},
-std::array<float,2>{0.418371767f, 0.810620666f},
-std::array<float,2>{0.20752731f, 0.394175678f},
-std::array<float,2>{0.71886611f, 0.613638818f},
-std::array<float,2>{0.627150953f, 0.198103398f},
-std::array<float,2>{0.168897137f, 0.999625087f},
-std::array<float,2>{0.45755446f, 0.285485357f},
-std::array<float,2>{0.882692158f, 0.654539824f},
-std::array<float,2>{0.750319958f, 0.489832908f},
-std::array<float,2>{0.359687209f, 0.526610792f},
-std::array<float,2>{0.0960559249f, 0.0530730635f},
-std::array<float,2>{0.549967706f, 0.833072603f},
-std::array<float,2>{0.699016929f, 0.408587068f},
-std::array<float,2>{0.227707565f, 0.580745697f},
-std::array<float,2>{0.381260484f, 0.0826433226f},
-std::array<float,2>{0.966998816f, 0.752046108f},
-std::array<float,2>{0.817166686f, 0.140338525f},
-std::array<float,2>{0.303044885f, 0.928564548f},
-std::array<float,2>{0.00125479f, 0.323324353f},
-std::array<float,2>{0.609138787f, 0.723334372f},
-std::array<float,2>{0.520458221f, 0.00526402192f},
-std::array<float,2>{0.0851248205f, 0.849989891f},
-std::array<float,2>{0.33749339f, 0.454007268f},
-std::array<float,2>{0.785205424f, 0.55927521f},
-std::array<float,2>{0.926528692f, 0.265725911f},
-std::array<float,2>{0.499458641f, 0.658116281f},
-std::array<float,2>{0.15431869f, 0.248361334f},
-std::array<float,2>{0.673379719f, 0.968107998f},
-std::array<float,2>{0.530777574f, 0.434841901f},
-std::array<float,2>{0.0898500085f, 0.571004927f},
-std::array<float,2>{0.331853688f, 0.0742871612f},
-std::array<float,2>{0.795322359f, 0.776778758f},
-std::array<float,2>{0.935183167f, 0.145713672f},
-std::array<float,2>{0.490800261f, 0.912992895f},
-std::array<float,2>{0.14504616f, 0.339221448f},
-std::array<float,2>{0.685792804f, 0.742071807f},
-std::array<float,2>{0.689932525f, 0.0220256858f},
-std::array<float,2>{0.223683476f, 0.860863507f},
-std::array<float,2>{0.389373839f, 0.44731158f},
-std::array<float,2>{0.957872629f, 0.541173518f},
-std::array<float,2>{0.821155787f, 0.25660488f},
-std::array<float,2>{0.307235837f, 0.681742549f},
-std::array<float,2>{0.0128660183f, 0.233439445f},
-std::array<float,2>{0.596716642f, 0.938487887f},
-std::array<float,2>{0.6405496f, 0.362053812f},
-std::array<float,2>{0.163679406f, 0.688638151f},
-std::array<float,2>{0.465896815f, 0.159125f},
-std::array<float,2>{0.886474848f, 0.889120877f},
-std::array<float,2>{0.764854908f, 0.110811688f},
-std::array<float,2>{0.37491101f, 0.790641487f},
-std::array<float,2>{0.104345076f, 0.376048952f},
-std::array<float,2>{0.558400929f, 0.60087353f},
-std::array<float,2>{0.56250596f, 0.218309551f},
-std::array<float,2>{0.0466357507f, 0.969287038f},
-std::array<float,2>{0.268880367f, 0.309841871f},
-std::array<float,2>{0.864403963f, 0.63607657f},
-std::array<float,2>{0.980519354f, 0.468757778f},
-std::array<float,2>{0.412183434f, 0.506872535f},
-std::array<float,2>{0.211490765f, 0.0373721793f},
-std::array<float,2>{0.73364383f, 0.820717752f},
-std::array<float,2>{0.615389943f, 0.285057336f},
-std::array<float,2>{0.0237839315f, 0.651298106f},
-std::array<float,2>{0.295252949f, 0.199599668f},
-std::array<float,2>{0.840388775f, 0.99246788f},
-std::array<float,2>{0.947662234f, 0.048335012f},
-std::array<float,2>{0.392394006f, 0.83095175f},
-std::array<float,2>{0.244653583f, 0.487104893f},
-std::array<float,2>{0.713241041f, 0.527451456f},
-std::array<float,2>{0.658374369f, 0.176305339f},
-std::array<float,2>{0.132150054f, 0.891168594f},
-std::array<float,2>{0.469796479f, 0.349722415f},
-std::array<float,2>{0.910476625f, 0.711627424f},
-std::array<float,2>{0.797155619f, 0.397313923f},
-std::array<float,2>{0.316940457f, 0.612338006f},
-std::array<float,2>{0.0719953403f, 0.102618001f},
-std::array<float,2>{0.508445144f, 0.805120885f},
-std::array<float,2>{0.735954821f, 0.457094997f},
-std::array<float,2>{0.201602995f, 0.557966709f},
-std::array<float,2>{0.435753465f, 0.00158464874f},
-std::array<float,2>{0.993948579f, 0.843898892f},
-std::array<float,2>{0.854715407f, 0.244647458f},
-std::array<float,2>{0.254426777f, 0.9635728f},
-std::array<float,2>{0.0589655824f, 0.270779103f},
-std::array<float,2>{0.593149185f, 0.663838744f},
-std::array<float,2>{0.54230243f, 0.0811172202f},
-std::array<float,2>{0.112122096f, 0.756566763f},
-std::array<float,2>{0.348449975f, 0.412242681f},
-std::array<float,2>{0.775000632f, 0.583013177f},
-std::array<float,2>{0.898379743f, 0.326436788f},
-std::array<float,2>{0.450574517f, 0.721973121f},
-std::array<float,2>{0.173717052f, 0.136560649f},
-std::array<float,2>{0.650331616f, 0.922449231f},
-std::array<float,2>{0.58523494f, 0.499265313f},
-std::array<float,2>{0.0545497797f, 0.519541979f},
-std::array<float,2>{0.261655241f, 0.0619771034f},
-std::array<float,2>{0.844188094f, 0.83808428f},
-std::array<float,2>{0.987596393f, 0.194771767f},
-std::array<float,2>{0.425785989f, 0.988613904f},
-std::array<float,2>{0.194206178f, 0.291303933f},
-std::array<float,2>{0.748501003f, 0.640849352f},
-std::array<float,2>{0.646602392f, 0.0996325612f},
-std::array<float,2>{0.182443082f, 0.798004568f},
-std::array<float,2>{0.441480637f, 0.400388807f},
-std::array<float,2>{0.899756312f, 0.623007357f},
-std::array<float,2>{0.766245067f, 0.358968675f},
-std::array<float,2>{0.358208597f, 0.706635296f},
-std::array<float,2>{0.120980971f, 0.186221734f},
-std::array<float,2>{0.537660301f, 0.901193917f},
-std::array<float,2>{0.706315219f, 0.275108159f},
-std::array<float,2>{0.236119032f, 0.667465389f},
-std::array<float,2>{0.402298301f, 0.237201035f},
-std::array<float,2>{0.944299281f, 0.954766154f},
-std::array<float,2>{0.834137738f, 0.0125235599f},
-std::array<float,2>{0.285981119f, 0.857727945f},
-std::array<float,2>{0.0201480333f, 0.463378847f},
-std::array<float,2>{0.619525433f, 0.55409956f},
-std::array<float,2>{0.504404724f, 0.132268876f},
-std::array<float,2>{0.0630842522f, 0.93116951f},
-std::array<float,2>{0.324448973f, 0.317451596f},
-std::array<float,2>{0.810314059f, 0.733489215f},
-std::array<float,2>{0.914437294f, 0.418806136f},
-std::array<float,2>{0.478187084f, 0.589549661f},
-std::array<float,2>{0.133240059f, 0.0876434296f},
-std::array<float,2>{0.668816149f, 0.760984838f},
-std::array<float,2>{0.553538501f, 0.32935822f},
-std::array<float,2>{0.100025527f, 0.746043205f},
-std::array<float,2>{0.365563929f, 0.150808126f},
-std::array<float,2>{0.756764054f, 0.91524905f},
-std::array<float,2>{0.875663579f, 0.0678304434f},
-std::array<float,2>{0.454965651f, 0.771442056f},
-std::array<float,2>{0.164250985f, 0.428519368f},
-std::array<float,2>{0.62967068f, 0.567047238f},
-std::array<float,2>{0.722705007f, 0.219458327f},
-std::array<float,2>{0.206543148f, 0.951789021f},
-std::array<float,2>{0.416708767f, 0.261727601f},
-std::array<float,2>{0.968921661f, 0.678126752f},
-std::array<float,2>{0.871505678f, 0.442165345f},
-std::array<float,2>{0.2759749f, 0.532474875f},
-std::array<float,2>{0.0360245593f, 0.0299526453f},
-std::array<float,2>{0.574276209f, 0.868059993f},
-std::array<float,2>{0.678674877f, 0.386388063f},
-std::array<float,2>{0.151282534f, 0.606057346f},
-std::array<float,2>{0.495771646f, 0.124565974f},
-std::array<float,2>{0.924916863f, 0.781495154f},
-std::array<float,2>{0.781797588f, 0.165221512f},
-std::array<float,2>{0.340396762f, 0.875080645f},
-std::array<float,2>{0.081904836f, 0.368543148f},
-std::array<float,2>{0.517337263f, 0.700308919f},
-std::array<float,2>{0.604048073f, 0.0451146178f},
-std::array<float,2>{0.00399818784f, 0.819786489f},
-std::array<float,2>{0.297760129f, 0.480850965f},
-std::array<float,2>{0.814709067f, 0.511228561f},
-std::array<float,2>{0.964773774f, 0.30234468f},
-std::array<float,2>{0.37621212f, 0.62764746f},
-std::array<float,2>{0.231732607f, 0.207575157f},
-std::array<float,2>{0.699257016f, 0.980334282f},
-std::array<float,2>{0.569500744f, 0.416620851f},
-std::array<float,2>{0.0415314212f, 0.591202617f},
-std::array<float,2>{0.272404522f, 0.0919855982f},
-std::array<float,2>{0.86303401f, 0.761810064f},
-std::array<float,2>{0.97882086f, 0.128810182f},
-std::array<float,2>{0.406533867f, 0.936296701f},
-std::array<float,2>{0.217604697f, 0.312616676f},
-std::array<float,2>{0.729534745f, 0.726951003f},
-std::array<float,2>{0.634545386f, 0.0106962081f},
-std::array<float,2>{0.157091111f, 0.853577852f},
-std::array<float,2>{0.463929325f, 0.46774599f},
-std::array<float,2>{0.887442231f, 0.549528003f},
-std::array<float,2>{0.760320663f, 0.280304223f},
-std::array<float,2>{0.368115962f, 0.669363141f},
-std::array<float,2>{0.106463f, 0.239440918f},
-std::array<float,2>{0.55916816f, 0.960620403f},
-std::array<float,2>{0.693458617f, 0.351958334f},
-std::array<float,2>{0.219934374f, 0.7082811f},
-std::array<float,2>{0.383653462f, 0.179878324f},
-std::array<float,2>{0.953300714f, 0.903519392f},
-std::array<float,2>{0.824691236f, 0.0951711088f},
-std::array<float,2>{0.309045762f, 0.803492844f},
-std::array<float,2>{0.0086276615f, 0.4061625f},
-std::array<float,2>{0.600107193f, 0.618475676f},
-std::array<float,2>{0.524523616f, 0.189409077f},
-std::array<float,2>{0.0877614245f, 0.988054156f},
-std::array<float,2>{0.333553255f, 0.293680191f},
-std::array<float,2>{0.791417778f, 0.646839857f},
-std::array<float,2>{0.931158543f, 0.493860424f},
-std::array<float,2>{0.486655474f, 0.518254459f},
-std::array<float,2>{0.144010842f, 0.0576657355f},
-std::array<float,2>{0.679984748f, 0.839844406f},
-std::array<float,2>{0.545155823f, 0.298254579f},
-std::array<float,2>{0.113550901f, 0.632759333f},
-std::array<float,2>{0.345375955f, 0.205546796f},
-std::array<float,2>{0.779994965f, 0.980767667f},
-std::array<float,2>{0.893275797f, 0.0428239219f},
-std::array<float,2>{0.449065834f, 0.815036833f},
-std::array<float,2>{0.17850703f, 0.479160964f},
-std::array<float,2>{0.655704319f, 0.513078809f},
-std::array<float,2>{0.740736127f, 0.169555247f},
-std::array<float,2>{0.19550088f, 0.878911674f},
-std::array<float,2>{0.43351379f, 0.372201562f},
-std::array<float,2>{0.996901274f, 0.69916153f},
-std::array<float,2>{0.858632267f, 0.387343317f},
-std::array<float,2>{0.253001928f, 0.604356408f},
-std::array<float,2>{0.0578988604f, 0.117581137f},
-std::array<float,2>{0.588855922f, 0.78871572f},
-std::array<float,2>{0.660434306f, 0.439174742f},
-std::array<float,2>{0.125292838f, 0.535985827f},
-std::array<float,2>{0.473004669f, 0.0261467211f},
-std::array<float,2>{0.907303929f, 0.873398662f},
-std::array<float,2>{0.80139631f, 0.226477847f},
-std::array<float,2>{0.313675314f, 0.947817683f},
-std::array<float,2>{0.0773819908f, 0.259503394f},
-std::array<float,2>{0.514930487f, 0.675771594f},
-std::array<float,2>{0.609572649f, 0.063515909f},
-std::array<float,2>{0.0283731744f, 0.769437551f},
-std::array<float,2>{0.290390998f, 0.424407959f},
-std::array<float,2>{0.83595109f, 0.563889146f},
-std::array<float,2>{0.949521065f, 0.33562988f},
-std::array<float,2>{0.395190001f, 0.74908489f},
-std::array<float,2>{0.249512419f, 0.15472053f},
-std::array<float,2>{0.71773243f, 0.919527411f},
-std::array<float,2>{0.503132105f, 0.475479573f},
-std::array<float,2>{0.0698762164f, 0.50186038f},
-std::array<float,2>{0.322964668f, 0.0329510979f},
-std::array<float,2>{0.80856514f, 0.826005816f},
-std::array<float,2>{0.920037091f, 0.213873044f},
-std::array<float,2>{0.481420845f, 0.973302066f},
-std::array<float,2>{0.139874339f, 0.306618124f},
-std::array<float,2>{0.667482853f, 0.637062609f},
-std::array<float,2>{0.709270239f, 0.11633385f},
-std::array<float,2>{0.238504753f, 0.795325339f},
-std::array<float,2>{0.402789861f, 0.382630378f},
-std::array<float,2>{0.938667059f, 0.597069204f},
-std::array<float,2>{0.829496145f, 0.363512486f},
-std::array<float,2>{0.283366501f, 0.694428384f},
-std::array<float,2>{0.0183028616f, 0.160501167f},
-std::array<float,2>{0.621714354f, 0.883768141f},
-std::array<float,2>{0.641337097f, 0.252196074f},
-std::array<float,2>{0.184862867f, 0.686168194f},
-std::array<float,2>{0.439161211f, 0.230053619f},
-std::array<float,2>{0.902876318f, 0.941640258f},
-std::array<float,2>{0.772869229f, 0.0159929004f},
-std::array<float,2>{0.354262769f, 0.865989029f},
-std::array<float,2>{0.122058257f, 0.450802803f},
-std::array<float,2>{0.532373607f, 0.545604289f},
-std::array<float,2>{0.579564393f, 0.144530177f},
-std::array<float,2>{0.0507324412f, 0.909136951f},
-std::array<float,2>{0.263408959f, 0.341522276f},
-std::array<float,2>{0.850015581f, 0.73469907f},
-std::array<float,2>{0.988437653f, 0.431634516f},
-std::array<float,2>{0.423064232f, 0.575402319f},
-std::array<float,2>{0.190729603f, 0.0726050511f},
-std::array<float,2>{0.744954228f, 0.778335869f},
-std::array<float,2>{0.606541038f, 0.322140008f},
-std::array<float,2>{0.00228119106f, 0.725536466f},
-std::array<float,2>{0.302103311f, 0.13687396f},
-std::array<float,2>{0.81894803f, 0.925818801f},
-std::array<float,2>{0.966310382f, 0.0849352032f},
-std::array<float,2>{0.379027307f, 0.750046909f},
-std::array<float,2>{0.228814557f, 0.406442672f},
-std::array<float,2>{0.696439743f, 0.579515278f},
-std::array<float,2>{0.674592495f, 0.247890294f},
-std::array<float,2>{0.153795913f, 0.965359211f},
-std::array<float,2>{0.496233732f, 0.269370437f},
-std::array<float,2>{0.928252399f, 0.660024226f},
-std::array<float,2>{0.78899467f, 0.455445558f},
-std::array<float,2>{0.339337617f, 0.561927974f},
-std::array<float,2>{0.082433179f, 0.00637150649f},
-std::array<float,2>{0.521645784f, 0.847862482f},
-std::array<float,2>{0.722284496f, 0.391195834f},
-std::array<float,2>{0.210178122f, 0.616703451f},
-std::array<float,2>{0.42160061f, 0.107360549f},
-std::array<float,2>{0.975046337f, 0.810424507f},
-std::array<float,2>{0.869658172f, 0.172178268f},
-std::array<float,2>{0.281215578f, 0.897397339f},
-std::array<float,2>{0.0323313773f, 0.346271008f},
-std::array<float,2>{0.571893394f, 0.717927158f},
-std::array<float,2>{0.547347188f, 0.0526502542f},
-std::array<float,2>{0.0954077542f, 0.834074259f},
-std::array<float,2>{0.362882048f, 0.491376251f},
-std::array<float,2>{0.75237453f, 0.525110066f},
-std::array<float,2>{0.880675077f, 0.287435591f},
-std::array<float,2>{0.460009962f, 0.652654529f},
-std::array<float,2>{0.171726629f, 0.197245061f},
-std::array<float,2>{0.625114143f, 0.997321367f},
-std::array<float,2>{0.555650651f, 0.377629876f},
-std::array<float,2>{0.10256654f, 0.598243237f},
-std::array<float,2>{0.372136772f, 0.112499706f},
-std::array<float,2>{0.763424098f, 0.791402757f},
-std::array<float,2>{0.884296298f, 0.156607568f},
-std::array<float,2>{0.467767894f, 0.887567878f},
-std::array<float,2>{0.162048623f, 0.360902637f},
-std::array<float,2>{0.638631344f, 0.691146791f},
-std::array<float,2>{0.732207298f, 0.0359208696f},
-std::array<float,2>{0.213482767f, 0.823703766f},
-std::array<float,2>{0.410525113f, 0.471949369f},
-std::array<float,2>{0.984269202f, 0.505323946f},
-std::array<float,2>{0.86590755f, 0.311107606f},
-std::array<float,2>{0.265771419f, 0.63421315f},
-std::array<float,2>{0.0434648693f, 0.216430038f},
-std::array<float,2>{0.565855026f, 0.970911443f},
-std::array<float,2>{0.685159504f, 0.337055892f},
-std::array<float,2>{0.146907419f, 0.739026606f},
-std::array<float,2>{0.488315284f, 0.147998765f},
-std::array<float,2>{0.936620414f, 0.911204815f},
-std::array<float,2>{0.794326425f, 0.0770427734f},
-std::array<float,2>{0.329291046f, 0.77361238f},
-std::array<float,2>{0.0918115079f, 0.43737486f},
-std::array<float,2>{0.529006481f, 0.572606802f},
-std::array<float,2>{0.59526825f, 0.2315505f},
-std::array<float,2>{0.0138858194f, 0.940909445f},
-std::array<float,2>{0.305826545f, 0.255178332f},
-std::array<float,2>{0.822799206f, 0.681000233f},
-std::array<float,2>{0.95961678f, 0.446035326f},
-std::array<float,2>{0.388634264f, 0.539983571f},
-std::array<float,2>{0.226434365f, 0.0204883534f},
-std::array<float,2>{0.689375579f, 0.862409472f},
-std::array<float,2>{0.591177702f, 0.27191627f},
-std::array<float,2>{0.0611177161f, 0.661647677f},
-std::array<float,2>{0.256949514f, 0.24401401f},
-std::array<float,2>{0.852155149f, 0.961820006f},
-std::array<float,2>{0.995188713f, 0.00338416151f},
-std::array<float,2>{0.433758557f, 0.846773386f},
-std::array<float,2>{0.20032528f, 0.459902644f},
-std::array<float,2>{0.737331212f, 0.556362271f},
-std::array<float,2>{0.651983321f, 0.134471059f},
-std::array<float,2>{0.174599618f, 0.924625933f},
-std::array<float,2>{0.452747583f, 0.324487448f},
-std::array<float,2>{0.895071328f, 0.720541418f},
-std::array<float,2>{0.775451839f, 0.410727441f},
-std::array<float,2>{0.35097006f, 0.585454822f},
-std::array<float,2>{0.110864729f, 0.0789356753f},
-std::array<float,2>{0.539387584f, 0.755533874f},
-std::array<float,2>{0.712698102f, 0.486075461f},
-std::array<float,2>{0.243287727f, 0.530361652f},
-std::array<float,2>{0.393525302f, 0.0498139709f},
-std::array<float,2>{0.946321249f, 0.828295469f},
-std::array<float,2>{0.842347264f, 0.2025709f},
-std::array<float,2>{0.29432562f, 0.994691372f},
-std::array<float,2>{0.0260359906f, 0.28164044f},
-std::array<float,2>{0.61511308f, 0.650350034f},
-std::array<float,2>{0.511615336f, 0.104635991f},
-std::array<float,2>{0.0735672191f, 0.807925582f},
-std::array<float,2>{0.319251329f, 0.395264804f},
-std::array<float,2>{0.800392568f, 0.610873163f},
-std::array<float,2>{0.913690388f, 0.348829687f},
-std::array<float,2>{0.47102195f, 0.71339792f},
-std::array<float,2>{0.129250363f, 0.179245278f},
-std::array<float,2>{0.656891525f, 0.892670751f},
-std::array<float,2>{0.617427766f, 0.46197778f},
-std::array<float,2>{0.0228949059f, 0.551187634f},
-std::array<float,2>{0.28719312f, 0.0154696265f},
-std::array<float,2>{0.83247894f, 0.855602741f},
-std::array<float,2>{0.941671133f, 0.236105248f},
-std::array<float,2>{0.398989826f, 0.955490112f},
-std::array<float,2>{0.236512974f, 0.276848346f},
-std::array<float,2>{0.704498768f, 0.664950013f},
-std::array<float,2>{0.671137512f, 0.089235343f},
-std::array<float,2>{0.136712864f, 0.758589685f},
-std::array<float,2>{0.480294675f, 0.42178458f},
-std::array<float,2>{0.916903734f, 0.587044895f},
-std::array<float,2>{0.811856508f, 0.320275396f},
-std::array<float,2>{0.32640174f, 0.731238484f},
-std::array<float,2>{0.0644697547f, 0.129315019f},
-std::array<float,2>{0.507660031f, 0.932325125f},
-std::array<float,2>{0.746608377f, 0.289924473f},
-std::array<float,2>{0.191610798f, 0.64282459f},
-std::array<float,2>{0.427972645f, 0.192686871f},
-std::array<float,2>{0.984626055f, 0.991560578f},
-std::array<float,2>{0.846906304f, 0.0601928793f},
-std::array<float,2>{0.259255528f, 0.837297559f},
-std::array<float,2>{0.0520328023f, 0.497596979f},
-std::array<float,2>{0.582251251f, 0.522638023f},
-std::array<float,2>{0.536193073f, 0.184670419f},
-std::array<float,2>{0.117335536f, 0.899969995f},
-std::array<float,2>{0.356377542f, 0.357220203f},
-std::array<float,2>{0.769250512f, 0.704172015f},
-std::array<float,2>{0.900977015f, 0.401157856f},
-std::array<float,2>{0.444028139f, 0.624032736f},
-std::array<float,2>{0.180375457f, 0.0988314599f},
-std::array<float,2>{0.644543469f, 0.800367951f},
-std::array<float,2>{0.518801868f, 0.3707138f},
-std::array<float,2>{0.0788466856f, 0.701731801f},
-std::array<float,2>{0.342201859f, 0.167428359f},
-std::array<float,2>{0.78407377f, 0.878561258f},
-std::array<float,2>{0.922139883f, 0.12129242f},
-std::array<float,2>{0.494110912f, 0.784548402f},
-std::array<float,2>{0.150229409f, 0.384040356f},
-std::array<float,2>{0.675928891f, 0.608957887f},
-std::array<float,2>{0.701927364f, 0.209580928f},
-std::array<float,2>{0.233395711f, 0.977398932f},
-std::array<float,2>{0.378731161f, 0.302761525f},
-std::array<float,2>{0.961369812f, 0.626697898f},
-std::array<float,2>{0.81398958f, 0.484221309f},
-std::array<float,2>{0.299605936f, 0.508148551f},
-std::array<float,2>{0.0077544814f, 0.0441155657f},
-std::array<float,2>{0.60294348f, 0.818314433f},
-std::array<float,2>{0.631296158f, 0.427420408f},
-std::array<float,2>{0.167676494f, 0.569987714f},
-std::array<float,2>{0.456183195f, 0.0702308938f},
-std::array<float,2>{0.877417386f, 0.772892118f},
-std::array<float,2>{0.754389107f, 0.149732664f},
-std::array<float,2>{0.363749355f, 0.916955709f},
-std::array<float,2>{0.0981278121f, 0.331022143f},
-std::array<float,2>{0.551201582f, 0.742666721f},
-std::array<float,2>{0.577627838f, 0.0274321306f},
-std::array<float,2>{0.0383645222f, 0.8703866f},
-std::array<float,2>{0.275112808f, 0.444576174f},
-std::array<float,2>{0.874466002f, 0.535036445f},
-std::array<float,2>{0.971353114f, 0.263789237f},
-std::array<float,2>{0.414431334f, 0.676698327f},
-std::array<float,2>{0.204214618f, 0.221487924f},
-std::array<float,2>{0.725181401f, 0.950632274f},
-std::array<float,2>{0.611960053f, 0.425669611f},
-std::array<float,2>{0.0296980552f, 0.563183546f},
-std::array<float,2>{0.292287141f, 0.0634394288f},
-std::array<float,2>{0.838678896f, 0.767903268f},
-std::array<float,2>{0.95123744f, 0.155752972f},
-std::array<float,2>{0.397140384f, 0.918277204f},
-std::array<float,2>{0.247114986f, 0.334897012f},
-std::array<float,2>{0.716613173f, 0.74866879f},
-std::array<float,2>{0.662771583f, 0.0265008006f},
-std::array<float,2>{0.127205968f, 0.874824226f},
-std::array<float,2>{0.475535989f, 0.438144296f},
-std::array<float,2>{0.908669233f, 0.536600232f},
-std::array<float,2>{0.803265214f, 0.257863492f},
-std::array<float,2>{0.316295594f, 0.674790919f},
-std::array<float,2>{0.0752023757f, 0.22489436f},
-std::array<float,2>{0.512314916f, 0.948331773f},
-std::array<float,2>{0.739118576f, 0.371706724f},
-std::array<float,2>{0.198731095f, 0.697552025f},
-std::array<float,2>{0.431594312f, 0.16894193f},
-std::array<float,2>{0.999507129f, 0.880830109f},
-std::array<float,2>{0.857147634f, 0.118354551f},
-std::array<float,2>{0.250935435f, 0.787325859f},
-std::array<float,2>{0.0554778054f, 0.388267934f},
-std::array<float,2>{0.586495399f, 0.604857504f},
-std::array<float,2>{0.543537438f, 0.206430241f},
-std::array<float,2>{0.115684599f, 0.981874049f},
-std::array<float,2>{0.347197115f, 0.296993077f},
-std::array<float,2>{0.778227389f, 0.631341696f},
-std::array<float,2>{0.892307401f, 0.479841769f},
-std::array<float,2>{0.44549334f, 0.512163043f},
-std::array<float,2>{0.176275417f, 0.0410166755f},
-std::array<float,2>{0.654142857f, 0.815823674f},
-std::array<float,2>{0.526138902f, 0.294379324f},
-std::array<float,2>{0.0883386359f, 0.648200333f},
-std::array<float,2>{0.334211439f, 0.188361079f},
-std::array<float,2>{0.79098016f, 0.9868536f},
-std::array<float,2>{0.93356061f, 0.0566667132f},
-std::array<float,2>{0.484384656f, 0.840998411f},
-std::array<float,2>{0.142184362f, 0.492798358f},
-std::array<float,2>{0.682504356f, 0.519465506f},
-std::array<float,2>{0.69149071f, 0.181023628f},
-std::array<float,2>{0.221771002f, 0.903045833f},
-std::array<float,2>{0.386020303f, 0.35337919f},
-std::array<float,2>{0.955499053f, 0.707089126f},
-std::array<float,2>{0.826367915f, 0.404438227f},
-std::array<float,2>{0.311913341f, 0.617833138f},
-std::array<float,2>{0.00984902401f, 0.0945625082f},
-std::array<float,2>{0.5980075f, 0.804669857f},
-std::array<float,2>{0.636388958f, 0.468358189f},
-std::array<float,2>{0.159919262f, 0.550071955f},
-std::array<float,2>{0.461455405f, 0.0112536252f},
-std::array<float,2>{0.890238404f, 0.855195284f},
-std::array<float,2>{0.758828163f, 0.238989651f},
-std::array<float,2>{0.370920271f, 0.959233224f},
-std::array<float,2>{0.108907491f, 0.280073911f},
-std::array<float,2>{0.56155175f, 0.668633342f},
-std::array<float,2>{0.566994727f, 0.0931790546f},
-std::array<float,2>{0.0396120846f, 0.76320076f},
-std::array<float,2>{0.270712107f, 0.417923301f},
-std::array<float,2>{0.859738171f, 0.590222359f},
-std::array<float,2>{0.97668153f, 0.314259589f},
-std::array<float,2>{0.40872249f, 0.728202701f},
-std::array<float,2>{0.216706172f, 0.127089828f},
-std::array<float,2>{0.727499962f, 0.937109888f},
-std::array<float,2>{0.549744904f, 0.490424395f},
-std::array<float,2>{0.0975738838f, 0.524200559f},
-std::array<float,2>{0.360353202f, 0.051253289f},
-std::array<float,2>{0.751610756f, 0.8355003f},
-std::array<float,2>{0.8809551f, 0.195449591f},
-std::array<float,2>{0.458630115f, 0.996966362f},
-std::array<float,2>{0.168997839f, 0.288770109f},
-std::array<float,2>{0.627987981f, 0.65402627f},
-std::array<float,2>{0.720007062f, 0.105566204f},
-std::array<float,2>{0.208811969f, 0.809379101f},
-std::array<float,2>{0.419863075f, 0.391720623f},
-std::array<float,2>{0.973562539f, 0.615344167f},
-std::array<float,2>{0.86906743f, 0.346864253f},
-std::array<float,2>{0.279189259f, 0.716944516f},
-std::array<float,2>{0.035068512f, 0.173649535f},
-std::array<float,2>{0.573597252f, 0.898308754f},
-std::array<float,2>{0.672347963f, 0.268128574f},
-std::array<float,2>{0.1560563f, 0.659047604f},
-std::array<float,2>{0.498829752f, 0.246311113f},
-std::array<float,2>{0.927185953f, 0.96624881f},
-std::array<float,2>{0.786935031f, 0.00776986126f},
-std::array<float,2>{0.336737007f, 0.848847091f},
-std::array<float,2>{0.0844275057f, 0.456964046f},
-std::array<float,2>{0.521214604f, 0.560995877f},
-std::array<float,2>{0.607975125f, 0.137911871f},
-std::array<float,2>{0.000603224733f, 0.927430809f},
-std::array<float,2>{0.303971708f, 0.321191996f},
-std::array<float,2>{0.81827271f, 0.725955904f},
-std::array<float,2>{0.967865169f, 0.407920569f},
-std::array<float,2>{0.382585615f, 0.578307211f},
-std::array<float,2>{0.227009356f, 0.0854012072f},
-std::array<float,2>{0.697668314f, 0.751865864f},
-std::array<float,2>{0.581218898f, 0.34037903f},
-std::array<float,2>{0.0488098152f, 0.73594445f},
-std::array<float,2>{0.265352845f, 0.142751068f},
-std::array<float,2>{0.84769237f, 0.909641325f},
-std::array<float,2>{0.991088748f, 0.074123323f},
-std::array<float,2>{0.424119294f, 0.778012574f},
-std::array<float,2>{0.188171759f, 0.430457026f},
-std::array<float,2>{0.742253304f, 0.574987233f},
-std::array<float,2>{0.643764079f, 0.228885666f},
-std::array<float,2>{0.187256679f, 0.943288445f},
-std::array<float,2>{0.440112293f, 0.253817201f},
-std::array<float,2>{0.905949831f, 0.686912179f},
-std::array<float,2>{0.769773304f, 0.449690074f},
-std::array<float,2>{0.353261709f, 0.546042979f},
-std::array<float,2>{0.12315008f, 0.0174298566f},
-std::array<float,2>{0.533290625f, 0.866321266f},
-std::array<float,2>{0.707455158f, 0.381741941f},
-std::array<float,2>{0.240234703f, 0.596301615f},
-std::array<float,2>{0.405644685f, 0.116079964f},
-std::array<float,2>{0.939955592f, 0.796200812f},
-std::array<float,2>{0.831561148f, 0.161870822f},
-std::array<float,2>{0.282067657f, 0.88411206f},
-std::array<float,2>{0.0166960414f, 0.364546835f},
-std::array<float,2>{0.623789489f, 0.693639457f},
-std::array<float,2>{0.500596881f, 0.0316268355f},
-std::array<float,2>{0.0674249381f, 0.824985445f},
-std::array<float,2>{0.321828812f, 0.476534218f},
-std::array<float,2>{0.805767655f, 0.500201285f},
-std::array<float,2>{0.918636024f, 0.305627644f},
-std::array<float,2>{0.482838631f, 0.638146162f},
-std::array<float,2>{0.138193965f, 0.213029936f},
-std::array<float,2>{0.665079117f, 0.973831654f},
-std::array<float,2>{0.508984208f, 0.395735949f},
-std::array<float,2>{0.0711031854f, 0.609974504f},
-std::array<float,2>{0.317470729f, 0.104456268f},
-std::array<float,2>{0.798639119f, 0.807418942f},
-std::array<float,2>{0.911812127f, 0.178197682f},
-std::array<float,2>{0.469071537f, 0.893958867f},
-std::array<float,2>{0.131321087f, 0.348562896f},
-std::array<float,2>{0.659356773f, 0.714613378f},
-std::array<float,2>{0.713877082f, 0.0497557968f},
-std::array<float,2>{0.24562262f, 0.82952553f},
-std::array<float,2>{0.390677333f, 0.484754592f},
-std::array<float,2>{0.948372304f, 0.529585063f},
-std::array<float,2>{0.841516316f, 0.282796621f},
-std::array<float,2>{0.296633333f, 0.64908576f},
-std::array<float,2>{0.0252998956f, 0.201469347f},
-std::array<float,2>{0.616983414f, 0.995505035f},
-std::array<float,2>{0.64865607f, 0.325634778f},
-std::array<float,2>{0.171904236f, 0.719162345f},
-std::array<float,2>{0.449689507f, 0.133643985f},
-std::array<float,2>{0.896628499f, 0.92565459f},
-std::array<float,2>{0.774018168f, 0.0792059228f},
-std::array<float,2>{0.348911405f, 0.754224181f},
-std::array<float,2>{0.112942994f, 0.411731124f},
-std::array<float,2>{0.541236162f, 0.584436476f},
-std::array<float,2>{0.592284083f, 0.242313147f},
-std::array<float,2>{0.0605258904f, 0.96274966f},
-std::array<float,2>{0.255311996f, 0.27285111f},
-std::array<float,2>{0.853843927f, 0.660801053f},
-std::array<float,2>{0.993143618f, 0.460701495f},
-std::array<float,2>{0.436913818f, 0.555161178f},
-std::array<float,2>{0.202652201f, 0.00269517954f},
-std::array<float,2>{0.734913766f, 0.845912576f},
-std::array<float,2>{0.59598583f, 0.253966838f},
-std::array<float,2>{0.011993831f, 0.680440307f},
-std::array<float,2>{0.307693124f, 0.230980277f},
-std::array<float,2>{0.821889877f, 0.940248787f},
-std::array<float,2>{0.958690763f, 0.0209539644f},
-std::array<float,2>{0.389943659f, 0.861982703f},
-std::array<float,2>{0.22346288f, 0.446691841f},
-std::array<float,2>{0.690739751f, 0.540401399f},
-std::array<float,2>{0.687134802f, 0.146932572f},
-std::array<float,2>{0.146010831f, 0.911012471f},
-std::array<float,2>{0.492036343f, 0.336895585f},
-std::array<float,2>{0.93398875f, 0.740100801f},
-std::array<float,2>{0.796428978f, 0.435869873f},
-std::array<float,2>{0.330312967f, 0.573535979f},
-std::array<float,2>{0.0911213309f, 0.0772041827f},
-std::array<float,2>{0.529762745f, 0.774439216f},
-std::array<float,2>{0.733225465f, 0.471280694f},
-std::array<float,2>{0.212105185f, 0.504140258f},
-std::array<float,2>{0.413623899f, 0.0370089598f},
-std::array<float,2>{0.982301056f, 0.823183179f},
-std::array<float,2>{0.864201248f, 0.215540528f},
-std::array<float,2>{0.267632008f, 0.971892715f},
-std::array<float,2>{0.0450357161f, 0.311969399f},
-std::array<float,2>{0.564043999f, 0.633218229f},
-std::array<float,2>{0.55666995f, 0.112291776f},
-std::array<float,2>{0.105088525f, 0.792607784f},
-std::array<float,2>{0.374004483f, 0.378765851f},
-std::array<float,2>{0.76387614f, 0.599071801f},
-std::array<float,2>{0.88549161f, 0.359670013f},
-std::array<float,2>{0.465762347f, 0.689894974f},
-std::array<float,2>{0.162275791f, 0.157534882f},
-std::array<float,2>{0.638749838f, 0.887932003f},
-std::array<float,2>{0.575757146f, 0.443984985f},
-std::array<float,2>{0.0367612727f, 0.533565998f},
-std::array<float,2>{0.276986718f, 0.0285743177f},
-std::array<float,2>{0.872967899f, 0.869403303f},
-std::array<float,2>{0.970485687f, 0.222111017f},
-std::array<float,2>{0.417565405f, 0.94934535f},
-std::array<float,2>{0.20508182f, 0.265459865f},
-std::array<float,2>{0.724283099f, 0.677413642f},
-std::array<float,2>{0.63040179f, 0.0689266175f},
-std::array<float,2>{0.165363476f, 0.772370398f},
-std::array<float,2>{0.453728735f, 0.425997168f},
-std::array<float,2>{0.876532316f, 0.568402648f},
-std::array<float,2>{0.757258892f, 0.331890136f},
-std::array<float,2>{0.367068499f, 0.7437433f},
-std::array<float,2>{0.101534322f, 0.148956358f},
-std::array<float,2>{0.553954005f, 0.917195082f},
-std::array<float,2>{0.700454175f, 0.304325312f},
-std::array<float,2>{0.231305525f, 0.625406504f},
-std::array<float,2>{0.375118136f, 0.210522547f},
-std::array<float,2>{0.963234067f, 0.97819525f},
-std::array<float,2>{0.816387177f, 0.0438111797f},
-std::array<float,2>{0.298512936f, 0.816927314f},
-std::array<float,2>{0.00513031567f, 0.482580036f},
-std::array<float,2>{0.604759336f, 0.509727418f},
-std::array<float,2>{0.515946925f, 0.166101351f},
-std::array<float,2>{0.0807104483f, 0.877620041f},
-std::array<float,2>{0.34113124f, 0.369174153f},
-std::array<float,2>{0.782373011f, 0.703051567f},
-std::array<float,2>{0.923861623f, 0.383111566f},
-std::array<float,2>{0.494837135f, 0.607878447f},
-std::array<float,2>{0.151521772f, 0.122838527f},
-std::array<float,2>{0.678832471f, 0.78341192f},
-std::array<float,2>{0.538125157f, 0.355979711f},
-std::array<float,2>{0.119994096f, 0.703476131f},
-std::array<float,2>{0.358984083f, 0.184399575f},
-std::array<float,2>{0.76749444f, 0.898776531f},
-std::array<float,2>{0.898983836f, 0.0985959396f},
-std::array<float,2>{0.442606747f, 0.799026132f},
-std::array<float,2>{0.183323666f, 0.402104586f},
-std::array<float,2>{0.647731602f, 0.623729944f},
-std::array<float,2>{0.74986732f, 0.191407919f},
-std::array<float,2>{0.194895297f, 0.990545332f},
-std::array<float,2>{0.427001148f, 0.290195107f},
-std::array<float,2>{0.987182796f, 0.64425385f},
-std::array<float,2>{0.844761372f, 0.496635407f},
-std::array<float,2>{0.260154396f, 0.522146165f},
-std::array<float,2>{0.0530989617f, 0.0588535406f},
-std::array<float,2>{0.584423661f, 0.83677721f},
-std::array<float,2>{0.669705272f, 0.420063406f},
-std::array<float,2>{0.134422347f, 0.586871266f},
-std::array<float,2>{0.476788968f, 0.0883018151f},
-std::array<float,2>{0.915149391f, 0.759533226f},
-std::array<float,2>{0.80859524f, 0.130764171f},
-std::array<float,2>{0.325679183f, 0.932889044f},
-std::array<float,2>{0.063930355f, 0.319117248f},
-std::array<float,2>{0.505029619f, 0.732242644f},
-std::array<float,2>{0.620690823f, 0.013973658f},
-std::array<float,2>{0.0205548983f, 0.856684089f},
-std::array<float,2>{0.286797613f, 0.461489499f},
-std::array<float,2>{0.83516705f, 0.552398086f},
-std::array<float,2>{0.945025444f, 0.275530666f},
-std::array<float,2>{0.400713533f, 0.665852845f},
-std::array<float,2>{0.235279709f, 0.23506397f},
-std::array<float,2>{0.705082238f, 0.956431985f},
-std::array<float,2>{0.589569628f, 0.390464485f},
-std::array<float,2>{0.0574513376f, 0.60312134f},
-std::array<float,2>{0.252196878f, 0.120207392f},
-std::array<float,2>{0.85824585f, 0.786240757f},
-std::array<float,2>{0.997317255f, 0.170136586f},
-std::array<float,2>{0.431915194f, 0.881101787f},
-std::array<float,2>{0.196577892f, 0.374380082f},
-std::array<float,2>{0.741541564f, 0.695937514f},
-std::array<float,2>{0.654971004f, 0.0405460894f},
-std::array<float,2>{0.179558441f, 0.813737512f},
-std::array<float,2>{0.447293967f, 0.478429079f},
-std::array<float,2>{0.894390881f, 0.514589906f},
-std::array<float,2>{0.780444801f, 0.299863875f},
-std::array<float,2>{0.343768358f, 0.630239606f},
-std::array<float,2>{0.11493323f, 0.204060793f},
-std::array<float,2>{0.546494961f, 0.984002233f},
-std::array<float,2>{0.71809274f, 0.333550811f},
-std::array<float,2>{0.249016002f, 0.747077465f},
-std::array<float,2>{0.395958751f, 0.154248133f},
-std::array<float,2>{0.951027751f, 0.920388818f},
-std::array<float,2>{0.837478757f, 0.066396296f},
-std::array<float,2>{0.289879054f, 0.766437709f},
-std::array<float,2>{0.0279819537f, 0.422563821f},
-std::array<float,2>{0.610977471f, 0.565620959f},
-std::array<float,2>{0.513894916f, 0.223032236f},
-std::array<float,2>{0.0763818547f, 0.946698546f},
-std::array<float,2>{0.312528789f, 0.260100663f},
-std::array<float,2>{0.802008927f, 0.673258126f},
-std::array<float,2>{0.906537473f, 0.441399992f},
-std::array<float,2>{0.473685682f, 0.538828909f},
-std::array<float,2>{0.126237571f, 0.0245846938f},
-std::array<float,2>{0.661345601f, 0.872070611f},
-std::array<float,2>{0.560224712f, 0.277830958f},
-std::array<float,2>{0.106204107f, 0.670988202f},
-std::array<float,2>{0.368213743f, 0.24075745f},
-std::array<float,2>{0.761161685f, 0.957403421f},
-std::array<float,2>{0.888532579f, 0.00947601628f},
-std::array<float,2>{0.46331805f, 0.85323137f},
-std::array<float,2>{0.157975718f, 0.466521233f},
-std::array<float,2>{0.633334041f, 0.547345817f},
-std::array<float,2>{0.72895354f, 0.125715032f},
-std::array<float,2>{0.218151182f, 0.934502542f},
-std::array<float,2>{0.407858253f, 0.315022737f},
-std::array<float,2>{0.979744852f, 0.729870021f},
-std::array<float,2>{0.86178118f, 0.414453834f},
-std::array<float,2>{0.27302897f, 0.591971397f},
-std::array<float,2>{0.0421183817f, 0.0899800733f},
-std::array<float,2>{0.569117427f, 0.765409172f},
-std::array<float,2>{0.680737257f, 0.495499551f},
-std::array<float,2>{0.143121511f, 0.516859353f},
-std::array<float,2>{0.487624943f, 0.0562169887f},
-std::array<float,2>{0.930586636f, 0.843207061f},
-std::array<float,2>{0.792837381f, 0.189765915f},
-std::array<float,2>{0.332491755f, 0.98472935f},
-std::array<float,2>{0.086512588f, 0.295654565f},
-std::array<float,2>{0.524313271f, 0.644730866f},
-std::array<float,2>{0.600838304f, 0.097337313f},
-std::array<float,2>{0.00929326285f, 0.80269897f},
-std::array<float,2>{0.309754759f, 0.402828932f},
-std::array<float,2>{0.825814962f, 0.620512903f},
-std::array<float,2>{0.95475179f, 0.354415387f},
-std::array<float,2>{0.384226054f, 0.710817456f},
-std::array<float,2>{0.219068125f, 0.182030767f},
-std::array<float,2>{0.695122361f, 0.905023396f},
-std::array<float,2>{0.522764385f, 0.454862773f},
-std::array<float,2>{0.0838181376f, 0.56014657f},
-std::array<float,2>{0.33796671f, 0.00421381928f},
-std::array<float,2>{0.788073123f, 0.851350486f},
-std::array<float,2>{0.929309189f, 0.249907255f},
-std::array<float,2>{0.49734661f, 0.966969013f},
-std::array<float,2>{0.152687773f, 0.266634941f},
-std::array<float,2>{0.675622821f, 0.656394899f},
-std::array<float,2>{0.696164906f, 0.083122842f},
-std::array<float,2>{0.230456501f, 0.752978444f},
-std::array<float,2>{0.38067624f, 0.409931302f},
-std::array<float,2>{0.965737104f, 0.581303954f},
-std::array<float,2>{0.820278585f, 0.322703242f},
-std::array<float,2>{0.301494718f, 0.724389851f},
-std::array<float,2>{0.00334748998f, 0.138886303f},
-std::array<float,2>{0.605976582f, 0.929352403f},
-std::array<float,2>{0.626601398f, 0.286882311f},
-std::array<float,2>{0.170108274f, 0.656185627f},
-std::array<float,2>{0.459426463f, 0.198905081f},
-std::array<float,2>{0.879400194f, 0.998652399f},
-std::array<float,2>{0.753269374f, 0.0545075573f},
-std::array<float,2>{0.362181932f, 0.832402229f},
-std::array<float,2>{0.0940766111f, 0.488600284f},
-std::array<float,2>{0.548627019f, 0.525818706f},
-std::array<float,2>{0.570964336f, 0.173967972f},
-std::array<float,2>{0.031252481f, 0.895186245f},
-std::array<float,2>{0.279514343f, 0.345091701f},
-std::array<float,2>{0.870693028f, 0.715484619f},
-std::array<float,2>{0.976098895f, 0.393190056f},
-std::array<float,2>{0.420336455f, 0.614433408f},
-std::array<float,2>{0.209232584f, 0.109073758f},
-std::array<float,2>{0.720916569f, 0.811525822f},
-std::array<float,2>{0.622747183f, 0.366207957f},
-std::array<float,2>{0.0193725359f, 0.692529917f},
-std::array<float,2>{0.285058856f, 0.16371657f},
-std::array<float,2>{0.828984976f, 0.885998607f},
-std::array<float,2>{0.937904298f, 0.114012249f},
-std::array<float,2>{0.404154152f, 0.794431567f},
-std::array<float,2>{0.239667803f, 0.380394936f},
-std::array<float,2>{0.71092993f, 0.595148087f},
-std::array<float,2>{0.666609347f, 0.21112816f},
-std::array<float,2>{0.138863713f, 0.974875867f},
-std::array<float,2>{0.482003242f, 0.308341295f},
-std::array<float,2>{0.921844125f, 0.64061743f},
-std::array<float,2>{0.806957066f, 0.473180532f},
-std::array<float,2>{0.32397151f, 0.503174961f},
-std::array<float,2>{0.0689647496f, 0.0350677148f},
-std::array<float,2>{0.502630234f, 0.827927887f},
-std::array<float,2>{0.745331049f, 0.433309615f},
-std::array<float,2>{0.189496756f, 0.576981902f},
-std::array<float,2>{0.422188491f, 0.0721046254f},
-std::array<float,2>{0.989466906f, 0.780646503f},
-std::array<float,2>{0.851402521f, 0.140795976f},
-std::array<float,2>{0.26265201f, 0.907194972f},
-std::array<float,2>{0.0494501293f, 0.342420489f},
-std::array<float,2>{0.578362584f, 0.736925304f},
-std::array<float,2>{0.531273663f, 0.0181737058f},
-std::array<float,2>{0.122177981f, 0.865194142f},
-std::array<float,2>{0.354511857f, 0.453098834f},
-std::array<float,2>{0.772065222f, 0.5444116f},
-std::array<float,2>{0.903821528f, 0.250906885f},
-std::array<float,2>{0.438044935f, 0.683894396f},
-std::array<float,2>{0.184196264f, 0.228336662f},
-std::array<float,2>{0.641700625f, 0.944642842f},
-std::array<float,2>{0.540888429f, 0.413855314f},
-std::array<float,2>{0.110041857f, 0.5826298f},
-std::array<float,2>{0.350052148f, 0.0804099217f},
-std::array<float,2>{0.777230859f, 0.756902874f},
-std::array<float,2>{0.896252275f, 0.135291874f},
-std::array<float,2>{0.451945633f, 0.923820615f},
-std::array<float,2>{0.175083101f, 0.327211261f},
-std::array<float,2>{0.650945246f, 0.720841467f},
-std::array<float,2>{0.736898184f, 0.000817239576f},
-std::array<float,2>{0.199922279f, 0.845525563f},
-std::array<float,2>{0.435396045f, 0.458703846f},
-std::array<float,2>{0.994188905f, 0.557185113f},
-std::array<float,2>{0.853210628f, 0.269827127f},
-std::array<float,2>{0.256183803f, 0.662466049f},
-std::array<float,2>{0.0620575324f, 0.245590717f},
-std::array<float,2>{0.590815961f, 0.964542568f},
-std::array<float,2>{0.657576859f, 0.350767404f},
-std::array<float,2>{0.130837575f, 0.712139249f},
-std::array<float,2>{0.472355843f, 0.176801875f},
-std::array<float,2>{0.91243273f, 0.892198503f},
-std::array<float,2>{0.799382687f, 0.102514222f},
-std::array<float,2>{0.319528043f, 0.806482792f},
-std::array<float,2>{0.0726211518f, 0.398017615f},
-std::array<float,2>{0.510082841f, 0.611547649f},
-std::array<float,2>{0.613752246f, 0.200436443f},
-std::array<float,2>{0.0269872062f, 0.993320286f},
-std::array<float,2>{0.293041438f, 0.283327907f},
-std::array<float,2>{0.843560755f, 0.652326405f},
-std::array<float,2>{0.945539773f, 0.488112748f},
-std::array<float,2>{0.393769354f, 0.52892828f},
-std::array<float,2>{0.242282525f, 0.0469950922f},
-std::array<float,2>{0.711552143f, 0.831552088f},
-std::array<float,2>{0.565294445f, 0.309261113f},
-std::array<float,2>{0.0440693013f, 0.634961069f},
-std::array<float,2>{0.267212301f, 0.217562154f},
-std::array<float,2>{0.866515934f, 0.970621109f},
-std::array<float,2>{0.982597113f, 0.0385439619f},
-std::array<float,2>{0.411926895f, 0.822259724f},
-std::array<float,2>{0.214835316f, 0.470051795f},
-std::array<float,2>{0.731061399f, 0.505880296f},
-std::array<float,2>{0.636972845f, 0.159198955f},
-std::array<float,2>{0.160727546f, 0.890343666f},
-std::array<float,2>{0.468346149f, 0.362396836f},
-std::array<float,2>{0.883471847f, 0.687955439f},
-std::array<float,2>{0.762199879f, 0.375876635f},
-std::array<float,2>{0.371996641f, 0.59965229f},
-std::array<float,2>{0.102160662f, 0.109545507f},
-std::array<float,2>{0.556292832f, 0.789625227f},
-std::array<float,2>{0.687829971f, 0.448632538f},
-std::array<float,2>{0.225509271f, 0.542909384f},
-std::array<float,2>{0.387199879f, 0.0225861687f},
-std::array<float,2>{0.96051991f, 0.860263884f},
-std::array<float,2>{0.823949873f, 0.233138785f},
-std::array<float,2>{0.305304259f, 0.937780917f},
-std::array<float,2>{0.0154675674f, 0.257553309f},
-std::array<float,2>{0.594494998f, 0.682935059f},
-std::array<float,2>{0.527986586f, 0.0760855228f},
-std::array<float,2>{0.0932094976f, 0.775884807f},
-std::array<float,2>{0.329084158f, 0.434176594f},
-std::array<float,2>{0.793820798f, 0.572069824f},
-std::array<float,2>{0.935747743f, 0.338436365f},
-std::array<float,2>{0.489501476f, 0.74028933f},
-std::array<float,2>{0.148359075f, 0.145215064f},
-std::array<float,2>{0.68427211f, 0.913465977f},
-std::array<float,2>{0.601655602f, 0.482178301f},
-std::array<float,2>{0.00630400609f, 0.510432005f},
-std::array<float,2>{0.300121188f, 0.046776209f},
-std::array<float,2>{0.812614202f, 0.818394721f},
-std::array<float,2>{0.962829173f, 0.208416075f},
-std::array<float,2>{0.37755999f, 0.979134738f},
-std::array<float,2>{0.233446971f, 0.301464766f},
-std::array<float,2>{0.702883959f, 0.628060222f},
-std::array<float,2>{0.677480757f, 0.123744972f},
-std::array<float,2>{0.149168476f, 0.782259941f},
-std::array<float,2>{0.49265787f, 0.385314524f},
-std::array<float,2>{0.923392713f, 0.606659651f},
-std::array<float,2>{0.784193039f, 0.367814928f},
-std::array<float,2>{0.343686193f, 0.699446499f},
-std::array<float,2>{0.0794027224f, 0.164318562f},
-std::array<float,2>{0.518040478f, 0.876290202f},
-std::array<float,2>{0.725894928f, 0.26322785f},
-std::array<float,2>{0.20338431f, 0.679634631f},
-std::array<float,2>{0.415468216f, 0.220263705f},
-std::array<float,2>{0.972055554f, 0.952842593f},
-std::array<float,2>{0.87324065f, 0.0310256463f},
-std::array<float,2>{0.273737937f, 0.86904788f},
-std::array<float,2>{0.0379606895f, 0.442963928f},
-std::array<float,2>{0.577047527f, 0.531550348f},
-std::array<float,2>{0.55227679f, 0.151666999f},
-std::array<float,2>{0.0993769839f, 0.91478169f},
-std::array<float,2>{0.364704341f, 0.328268737f},
-std::array<float,2>{0.755300403f, 0.744197428f},
-std::array<float,2>{0.87835151f, 0.429173708f},
-std::array<float,2>{0.455616951f, 0.568222225f},
-std::array<float,2>{0.166429371f, 0.067240797f},
-std::array<float,2>{0.632477224f, 0.770144224f},
-std::array<float,2>{0.506165385f, 0.316715151f},
-std::array<float,2>{0.0655312389f, 0.73280865f},
-std::array<float,2>{0.328071535f, 0.13112241f},
-std::array<float,2>{0.811186612f, 0.93037647f},
-std::array<float,2>{0.9176929f, 0.086046569f},
-std::array<float,2>{0.478586763f, 0.760178804f},
-std::array<float,2>{0.135139316f, 0.419844687f},
-std::array<float,2>{0.670695126f, 0.588200331f},
-std::array<float,2>{0.704087734f, 0.237818092f},
-std::array<float,2>{0.237361863f, 0.953786969f},
-std::array<float,2>{0.400171816f, 0.273585111f},
-std::array<float,2>{0.942580819f, 0.666126013f},
-std::array<float,2>{0.833147585f, 0.464374214f},
-std::array<float,2>{0.289005071f, 0.552752912f},
-std::array<float,2>{0.0219089836f, 0.0133012366f},
-std::array<float,2>{0.619027555f, 0.858954012f},
-std::array<float,2>{0.645633698f, 0.398541838f},
-std::array<float,2>{0.181096941f, 0.621881783f},
-std::array<float,2>{0.444804192f, 0.101491936f},
-std::array<float,2>{0.902247727f, 0.797057748f},
-std::array<float,2>{0.767616868f, 0.186759636f},
-std::array<float,2>{0.35713771f, 0.902018368f},
-std::array<float,2>{0.118256651f, 0.357625753f},
-std::array<float,2>{0.535886228f, 0.705998182f},
-std::array<float,2>{0.583064139f, 0.0606926605f},
-std::array<float,2>{0.0514069721f, 0.839314878f},
-std::array<float,2>{0.258592516f, 0.498503417f},
-std::array<float,2>{0.846420944f, 0.520883203f},
-std::array<float,2>{0.985714257f, 0.292885184f},
-std::array<float,2>{0.429249972f, 0.641692877f},
-std::array<float,2>{0.193094403f, 0.194069013f},
-std::array<float,2>{0.748017013f, 0.989351571f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.14851591f, 0.125730187f},
-std::array<float,2>{0.533897817f, 0.522460163f},
-std::array<float,2>{0.950994372f, 0.384060919f},
-std::array<float,2>{0.343656331f, 0.853671908f},
-std::array<float,2>{0.46412167f, 0.342195362f},
-std::array<float,2>{0.836367011f, 0.956521988f},
-std::array<float,2>{0.679948986f, 0.0964742824f},
-std::array<float,2>{0.106852606f, 0.657274723f},
-std::array<float,2>{0.293371379f, 0.0104422979f},
-std::array<float,2>{0.888595343f, 0.69497031f},
-std::array<float,2>{0.593843102f, 0.25685811f},
-std::array<float,2>{0.24983868f, 0.931505799f},
-std::array<float,2>{0.0607857145f, 0.474132001f},
-std::array<float,2>{0.733979821f, 0.793624699f},
-std::array<float,2>{0.801482916f, 0.189412966f},
-std::array<float,2>{0.415565461f, 0.583049476f},
-std::array<float,2>{0.0865478367f, 0.0748250633f},
-std::array<float,2>{0.649219632f, 0.629711151f},
-std::array<float,2>{0.868490517f, 0.366746664f},
-std::array<float,2>{0.47994414f, 0.996655166f},
-std::array<float,2>{0.357770979f, 0.418856591f},
-std::array<float,2>{0.993005395f, 0.831422508f},
-std::array<float,2>{0.501703262f, 0.181765527f},
-std::array<float,2>{0.171299323f, 0.536889493f},
-std::array<float,2>{0.379305303f, 0.225951701f},
-std::array<float,2>{0.751904428f, 0.62415719f},
-std::array<float,2>{0.70713681f, 0.459518611f},
-std::array<float,2>{0.0252570622f, 0.76925683f},
-std::array<float,2>{0.215658426f, 0.302754313f},
-std::array<float,2>{0.586704791f, 0.875887394f},
-std::array<float,2>{0.931066632f, 0.0493222252f},
-std::array<float,2>{0.26330331f, 0.747667551f},
-std::array<float,2>{0.00810991973f, 0.206733048f},
-std::array<float,2>{0.702019334f, 0.566707611f},
-std::array<float,2>{0.776088119f, 0.497440428f},
-std::array<float,2>{0.396997929f, 0.803851068f},
-std::array<float,2>{0.269351572f, 0.272132814f},
-std::array<float,2>{0.907848895f, 0.908298194f},
-std::array<float,2>{0.568157613f, 0.0263162609f},
-std::array<float,2>{0.190770403f, 0.70557934f},
-std::array<float,2>{0.485102594f, 0.109981596f},
-std::array<float,2>{0.847996354f, 0.673098028f},
-std::array<float,2>{0.635908842f, 0.315728903f},
-std::array<float,2>{0.0638217255f, 0.942395389f},
-std::array<float,2>{0.180866465f, 0.404614747f},
-std::array<float,2>{0.53091985f, 0.871510386f},
-std::array<float,2>{0.972995281f, 0.14170745f},
-std::array<float,2>{0.370385647f, 0.515047312f},
-std::array<float,2>{0.230144709f, 0.0362241082f},
-std::array<float,2>{0.623383522f, 0.719234347f},
-std::array<float,2>{0.897848189f, 0.289788961f},
-std::array<float,2>{0.31086114f, 0.900945425f},
-std::array<float,2>{0.433234453f, 0.446420908f},
-std::array<float,2>{0.786547899f, 0.760080993f},
-std::array<float,2>{0.736272633f, 0.241659597f},
-std::array<float,2>{0.0383308902f, 0.597197354f},
-std::array<float,2>{0.32492286f, 0.157910913f},
-std::array<float,2>{0.964982033f, 0.559536397f},
-std::array<float,2>{0.548097432f, 0.435817003f},
-std::array<float,2>{0.12663196f, 0.826478422f},
-std::array<float,2>{0.117175497f, 0.358677894f},
-std::array<float,2>{0.662081599f, 0.978205502f},
-std::array<float,2>{0.816114366f, 0.0834107995f},
-std::array<float,2>{0.451502234f, 0.642622173f},
-std::array<float,2>{0.196678683f, 0.243593767f},
-std::array<float,2>{0.575600743f, 0.602845073f},
-std::array<float,2>{0.918661952f, 0.442002863f},
-std::array<float,2>{0.280313283f, 0.753806233f},
-std::array<float,2>{0.399789453f, 0.287959307f},
-std::array<float,2>{0.768814206f, 0.892304718f},
-std::array<float,2>{0.692701638f, 0.0400245935f},
-std::array<float,2>{0.00536394678f, 0.731966019f},
-std::array<float,2>{0.360818356f, 0.0929677933f},
-std::array<float,2>{0.980823159f, 0.650835931f},
-std::array<float,2>{0.522638679f, 0.344303608f},
-std::array<float,2>{0.179555669f, 0.974521458f},
-std::array<float,2>{0.0770488083f, 0.427561164f},
-std::array<float,2>{0.629518569f, 0.816157162f},
-std::array<float,2>{0.853465676f, 0.165401325f},
-std::array<float,2>{0.497059315f, 0.549853742f},
-std::array<float,2>{0.046170257f, 0.0216843355f},
-std::array<float,2>{0.74734962f, 0.715461135f},
-std::array<float,2>{0.790106297f, 0.280804366f},
-std::array<float,2>{0.422740102f, 0.915076315f},
-std::array<float,2>{0.304224223f, 0.486532032f},
-std::array<float,2>{0.89948231f, 0.808850527f},
-std::array<float,2>{0.614246309f, 0.2176117f},
-std::array<float,2>{0.223449007f, 0.571842611f},
-std::array<float,2>{0.439768583f, 0.153844357f},
-std::array<float,2>{0.82670939f, 0.502255261f},
-std::array<float,2>{0.665585101f, 0.391933382f},
-std::array<float,2>{0.124878176f, 0.866780221f},
-std::array<float,2>{0.137456357f, 0.325719982f},
-std::array<float,2>{0.559436023f, 0.948419034f},
-std::array<float,2>{0.956588984f, 0.119866058f},
-std::array<float,2>{0.315746576f, 0.680702031f},
-std::array<float,2>{0.0951981544f, 0.173523203f},
-std::array<float,2>{0.67261368f, 0.539508939f},
-std::array<float,2>{0.832763255f, 0.41041562f},
-std::array<float,2>{0.45675087f, 0.841405869f},
-std::array<float,2>{0.332100213f, 0.369084895f},
-std::array<float,2>{0.940059423f, 0.989877701f},
-std::array<float,2>{0.543609202f, 0.065609172f},
-std::array<float,2>{0.144399703f, 0.635747731f},
-std::array<float,2>{0.411011457f, 0.0560807697f},
-std::array<float,2>{0.804872155f, 0.739947617f},
-std::array<float,2>{0.724033892f, 0.309892058f},
-std::array<float,2>{0.0495997779f, 0.884631217f},
-std::array<float,2>{0.238704368f, 0.462372005f},
-std::array<float,2>{0.603806615f, 0.780855775f},
-std::array<float,2>{0.876674294f, 0.234107286f},
-std::array<float,2>{0.282720119f, 0.611657798f},
-std::array<float,2>{0.158741459f, 0.107217655f},
-std::array<float,2>{0.509760559f, 0.671365559f},
-std::array<float,2>{0.991417885f, 0.331214428f},
-std::array<float,2>{0.349626869f, 0.964471638f},
-std::array<float,2>{0.472126484f, 0.380006999f},
-std::array<float,2>{0.864620984f, 0.849475265f},
-std::array<float,2>{0.648352623f, 0.136179149f},
-std::array<float,2>{0.0824340954f, 0.526773751f},
-std::array<float,2>{0.251994789f, 0.198459536f},
-std::array<float,2>{0.926800311f, 0.58832705f},
-std::array<float,2>{0.578462243f, 0.481900126f},
-std::array<float,2>{0.208740696f, 0.781945467f},
-std::array<float,2>{0.0159692112f, 0.259348929f},
-std::array<float,2>{0.71126008f, 0.926090717f},
-std::array<float,2>{0.761097848f, 0.00673731929f},
-std::array<float,2>{0.384038925f, 0.701413095f},
-std::array<float,2>{0.244974852f, 0.171626315f},
-std::array<float,2>{0.598481536f, 0.551217675f},
-std::array<float,2>{0.886119187f, 0.422650248f},
-std::array<float,2>{0.29049778f, 0.817691386f},
-std::array<float,2>{0.420253932f, 0.348183453f},
-std::array<float,2>{0.79782021f, 0.970040679f},
-std::array<float,2>{0.727077246f, 0.0892332718f},
-std::array<float,2>{0.0550448708f, 0.654473066f},
-std::array<float,2>{0.337927103f, 0.0465645529f},
-std::array<float,2>{0.947333753f, 0.730282247f},
-std::array<float,2>{0.536930263f, 0.283707023f},
-std::array<float,2>{0.155705988f, 0.895778f},
-std::array<float,2>{0.102853805f, 0.44018665f},
-std::array<float,2>{0.685211062f, 0.754686236f},
-std::array<float,2>{0.84231776f, 0.246524304f},
-std::array<float,2>{0.467787921f, 0.608319163f},
-std::array<float,2>{0.0281467214f, 0.124672897f},
-std::array<float,2>{0.705651224f, 0.685810626f},
-std::array<float,2>{0.755296767f, 0.322629809f},
-std::array<float,2>{0.375364333f, 0.950885773f},
-std::array<float,2>{0.261220783f, 0.397702247f},
-std::array<float,2>{0.937116623f, 0.862989426f},
-std::array<float,2>{0.593223035f, 0.150019884f},
-std::array<float,2>{0.211446717f, 0.506723464f},
-std::array<float,2>{0.483889431f, 0.214669436f},
-std::array<float,2>{0.8714059f, 0.57638371f},
-std::array<float,2>{0.652667999f, 0.48875609f},
-std::array<float,2>{0.0918593332f, 0.808011472f},
-std::array<float,2>{0.164261878f, 0.274458677f},
-std::array<float,2>{0.504660845f, 0.920031428f},
-std::array<float,2>{0.999587357f, 0.0168625414f},
-std::array<float,2>{0.355019838f, 0.712472916f},
-std::array<float,2>{0.0686167032f, 0.229591131f},
-std::array<float,2>{0.639768064f, 0.616049707f},
-std::array<float,2>{0.846310854f, 0.468571723f},
-std::array<float,2>{0.488667518f, 0.775502622f},
-std::array<float,2>{0.373209089f, 0.305158496f},
-std::array<float,2>{0.971777678f, 0.89034903f},
-std::array<float,2>{0.52653861f, 0.0598649643f},
-std::array<float,2>{0.187427282f, 0.736876011f},
-std::array<float,2>{0.391769946f, 0.068570517f},
-std::array<float,2>{0.780726433f, 0.640429378f},
-std::array<float,2>{0.698891103f, 0.374302983f},
-std::array<float,2>{0.0149541032f, 0.985527635f},
-std::array<float,2>{0.191551253f, 0.408103257f},
-std::array<float,2>{0.565949202f, 0.838856459f},
-std::array<float,2>{0.912939847f, 0.176816493f},
-std::array<float,2>{0.273259729f, 0.543057084f},
-std::array<float,2>{0.132709593f, 0.00235590967f},
-std::array<float,2>{0.554295301f, 0.69918853f},
-std::array<float,2>{0.963832021f, 0.264938295f},
-std::array<float,2>{0.323588133f, 0.922577202f},
-std::array<float,2>{0.447979778f, 0.478050053f},
-std::array<float,2>{0.818636537f, 0.788426459f},
-std::array<float,2>{0.658748031f, 0.201529488f},
-std::array<float,2>{0.112951674f, 0.590933263f},
-std::array<float,2>{0.304949194f, 0.138450041f},
-std::array<float,2>{0.893215001f, 0.529948175f},
-std::array<float,2>{0.620629787f, 0.378049701f},
-std::array<float,2>{0.232453302f, 0.846043527f},
-std::array<float,2>{0.0315897912f, 0.333067477f},
-std::array<float,2>{0.740260243f, 0.967397332f},
-std::array<float,2>{0.785000682f, 0.104064569f},
-std::array<float,2>{0.434782207f, 0.667719185f},
-std::array<float,2>{0.174020216f, 0.191570148f},
-std::array<float,2>{0.516934991f, 0.581468523f},
-std::array<float,2>{0.979545176f, 0.471481562f},
-std::array<float,2>{0.366894901f, 0.79102391f},
-std::array<float,2>{0.492947698f, 0.251644939f},
-std::array<float,2>{0.857123435f, 0.936342537f},
-std::array<float,2>{0.625810921f, 0.0125356819f},
-std::array<float,2>{0.0708671063f, 0.690462053f},
-std::array<float,2>{0.275953531f, 0.100374945f},
-std::array<float,2>{0.914193094f, 0.66071105f},
-std::array<float,2>{0.573781431f, 0.338774145f},
-std::array<float,2>{0.199924737f, 0.958932996f},
-std::array<float,2>{0.00357013545f, 0.388956785f},
-std::array<float,2>{0.688494861f, 0.857471168f},
-std::array<float,2>{0.771611273f, 0.129119724f},
-std::array<float,2>{0.405168563f, 0.518939674f},
-std::array<float,2>{0.119660065f, 0.0546537377f},
-std::array<float,2>{0.669178128f, 0.744944572f},
-std::array<float,2>{0.824022114f, 0.298710078f},
-std::array<float,2>{0.445126295f, 0.882122219f},
-std::array<float,2>{0.316560388f, 0.454401493f},
-std::array<float,2>{0.960014224f, 0.772764742f},
-std::array<float,2>{0.555121779f, 0.221267954f},
-std::array<float,2>{0.134614706f, 0.617682874f},
-std::array<float,2>{0.426528841f, 0.184518397f},
-std::array<float,2>{0.793587863f, 0.533606827f},
-std::array<float,2>{0.742524981f, 0.416923761f},
-std::array<float,2>{0.042534668f, 0.833786428f},
-std::array<float,2>{0.222463474f, 0.363219798f},
-std::array<float,2>{0.609798431f, 0.995239437f},
-std::array<float,2>{0.903785348f, 0.0725385621f},
-std::array<float,2>{0.29934305f, 0.628247797f},
-std::array<float,2>{0.0534702763f, 0.144832656f},
-std::array<float,2>{0.721305907f, 0.51163727f},
-std::array<float,2>{0.811602533f, 0.398913652f},
-std::array<float,2>{0.407340318f, 0.869780242f},
-std::array<float,2>{0.286637515f, 0.31989038f},
-std::array<float,2>{0.879527092f, 0.939191341f},
-std::array<float,2>{0.605584741f, 0.113979623f},
-std::array<float,2>{0.23700133f, 0.675855041f},
-std::array<float,2>{0.459512651f, 0.0286661051f},
-std::array<float,2>{0.828276277f, 0.709775925f},
-std::array<float,2>{0.678396225f, 0.266626149f},
-std::array<float,2>{0.101025499f, 0.913795769f},
-std::array<float,2>{0.145083398f, 0.493117809f},
-std::array<float,2>{0.540732503f, 0.796966791f},
-std::array<float,2>{0.942456365f, 0.210150048f},
-std::array<float,2>{0.32946229f, 0.564701438f},
-std::array<float,2>{0.206203207f, 0.0791382641f},
-std::array<float,2>{0.584435165f, 0.645500243f},
-std::array<float,2>{0.923769474f, 0.352448434f},
-std::array<float,2>{0.256913781f, 0.98271817f},
-std::array<float,2>{0.389748842f, 0.430448502f},
-std::array<float,2>{0.765390158f, 0.820450127f},
-std::array<float,2>{0.716963232f, 0.16274336f},
-std::array<float,2>{0.0230055992f, 0.556470454f},
-std::array<float,2>{0.346163869f, 0.236552119f},
-std::array<float,2>{0.987825394f, 0.598049104f},
-std::array<float,2>{0.514768481f, 0.450924754f},
-std::array<float,2>{0.16285792f, 0.76348877f},
-std::array<float,2>{0.0805396661f, 0.29611057f},
-std::array<float,2>{0.642971635f, 0.90323627f},
-std::array<float,2>{0.859562635f, 0.0347870961f},
-std::array<float,2>{0.475194275f, 0.725214422f},
-std::array<float,2>{0.168406397f, 0.180048868f},
-std::array<float,2>{0.502152741f, 0.538773119f},
-std::array<float,2>{0.994356155f, 0.419932395f},
-std::array<float,2>{0.355854273f, 0.829075694f},
-std::array<float,2>{0.476850688f, 0.364931881f},
-std::array<float,2>{0.869360626f, 0.998941779f},
-std::array<float,2>{0.651180148f, 0.0765572414f},
-std::array<float,2>{0.0880460516f, 0.632802248f},
-std::array<float,2>{0.264087856f, 0.0477945581f},
-std::array<float,2>{0.93312335f, 0.748455405f},
-std::array<float,2>{0.589824259f, 0.301894784f},
-std::array<float,2>{0.218635187f, 0.878155112f},
-std::array<float,2>{0.0258606188f, 0.458835363f},
-std::array<float,2>{0.710189581f, 0.766893446f},
-std::array<float,2>{0.753374815f, 0.222999394f},
-std::array<float,2>{0.380947411f, 0.621596277f},
-std::array<float,2>{0.107868686f, 0.0942407399f},
-std::array<float,2>{0.681895971f, 0.659599781f},
-std::array<float,2>{0.839628518f, 0.340149909f},
-std::array<float,2>{0.462503642f, 0.954399228f},
-std::array<float,2>{0.340154022f, 0.386685908f},
-std::array<float,2>{0.951365352f, 0.853122532f},
-std::array<float,2>{0.533036053f, 0.127026245f},
-std::array<float,2>{0.151988581f, 0.520458102f},
-std::array<float,2>{0.416631311f, 0.190672591f},
-std::array<float,2>{0.804190159f, 0.58488512f},
-std::array<float,2>{0.731138289f, 0.476335317f},
-std::array<float,2>{0.0600302666f, 0.796367168f},
-std::array<float,2>{0.246261284f, 0.254520327f},
-std::array<float,2>{0.596842766f, 0.932471573f},
-std::array<float,2>{0.889532626f, 0.00840091053f},
-std::array<float,2>{0.295309156f, 0.693030059f},
-std::array<float,2>{0.0360067561f, 0.239657134f},
-std::array<float,2>{0.736626565f, 0.594378054f},
-std::array<float,2>{0.787694812f, 0.448321342f},
-std::array<float,2>{0.430805504f, 0.759366155f},
-std::array<float,2>{0.309910834f, 0.292108893f},
-std::array<float,2>{0.894854188f, 0.898738503f},
-std::array<float,2>{0.622670114f, 0.0372841023f},
-std::array<float,2>{0.227121919f, 0.722545326f},
-std::array<float,2>{0.450734437f, 0.0845686868f},
-std::array<float,2>{0.81301409f, 0.642106056f},
-std::array<float,2>{0.662230194f, 0.356325686f},
-std::array<float,2>{0.114606075f, 0.980077088f},
-std::array<float,2>{0.12847808f, 0.435379148f},
-std::array<float,2>{0.54939419f, 0.825161994f},
-std::array<float,2>{0.968131065f, 0.159169406f},
-std::array<float,2>{0.327785611f, 0.562147319f},
-std::array<float,2>{0.188746303f, 0.0241125468f},
-std::array<float,2>{0.569602847f, 0.703158379f},
-std::array<float,2>{0.908336699f, 0.270734549f},
-std::array<float,2>{0.266431957f, 0.906691551f},
-std::array<float,2>{0.394622862f, 0.49906227f},
-std::array<float,2>{0.77392149f, 0.802128553f},
-std::array<float,2>{0.699867308f, 0.203264996f},
-std::array<float,2>{0.0113241617f, 0.570179164f},
-std::array<float,2>{0.367377102f, 0.143436119f},
-std::array<float,2>{0.975970507f, 0.512787402f},
-std::array<float,2>{0.527556241f, 0.402458638f},
-std::array<float,2>{0.18214637f, 0.874217272f},
-std::array<float,2>{0.0654639229f, 0.31364283f},
-std::array<float,2>{0.632903397f, 0.945191741f},
-std::array<float,2>{0.850031555f, 0.111465812f},
-std::array<float,2>{0.487317652f, 0.675082624f},
-std::array<float,2>{0.22554794f, 0.215470091f},
-std::array<float,2>{0.616566718f, 0.572592318f},
-std::array<float,2>{0.902249217f, 0.485064149f},
-std::array<float,2>{0.301512003f, 0.811381638f},
-std::array<float,2>{0.424290001f, 0.277921617f},
-std::array<float,2>{0.791155279f, 0.917932928f},
-std::array<float,2>{0.749748707f, 0.0208936501f},
-std::array<float,2>{0.0438742116f, 0.717976749f},
-std::array<float,2>{0.312933713f, 0.118026875f},
-std::array<float,2>{0.953567982f, 0.68305558f},
-std::array<float,2>{0.561886549f, 0.32665962f},
-std::array<float,2>{0.140183181f, 0.94663316f},
-std::array<float,2>{0.122149788f, 0.393965214f},
-std::array<float,2>{0.666280448f, 0.864830017f},
-std::array<float,2>{0.825229406f, 0.154871136f},
-std::array<float,2>{0.439388514f, 0.501828432f},
-std::array<float,2>{0.00625091325f, 0.0411499627f},
-std::array<float,2>{0.694445252f, 0.734210253f},
-std::array<float,2>{0.766192615f, 0.285935104f},
-std::array<float,2>{0.400662541f, 0.893555284f},
-std::array<float,2>{0.279126048f, 0.444627076f},
-std::array<float,2>{0.920589566f, 0.751409709f},
-std::array<float,2>{0.576952457f, 0.245787799f},
-std::array<float,2>{0.197533742f, 0.604369581f},
-std::array<float,2>{0.498844326f, 0.166513696f},
-std::array<float,2>{0.854597867f, 0.547422528f},
-std::array<float,2>{0.632331789f, 0.429439545f},
-std::array<float,2>{0.0754784644f, 0.812978864f},
-std::array<float,2>{0.177137882f, 0.346656591f},
-std::array<float,2>{0.521241009f, 0.975214183f},
-std::array<float,2>{0.983208597f, 0.0910343304f},
-std::array<float,2>{0.362380356f, 0.649681032f},
-std::array<float,2>{0.0841099545f, 0.132986665f},
-std::array<float,2>{0.646291852f, 0.524003923f},
-std::array<float,2>{0.86621809f, 0.38217485f},
-std::array<float,2>{0.469787896f, 0.850664675f},
-std::array<float,2>{0.348359227f, 0.328299016f},
-std::array<float,2>{0.98848033f, 0.96094656f},
-std::array<float,2>{0.511409998f, 0.109178454f},
-std::array<float,2>{0.157751843f, 0.668780446f},
-std::array<float,2>{0.386702478f, 0.00407864992f},
-std::array<float,2>{0.758957207f, 0.700767756f},
-std::array<float,2>{0.714388609f, 0.260607243f},
-std::array<float,2>{0.0191489682f, 0.929008961f},
-std::array<float,2>{0.209882602f, 0.484159529f},
-std::array<float,2>{0.581399024f, 0.78398025f},
-std::array<float,2>{0.928731382f, 0.196181953f},
-std::array<float,2>{0.25072819f, 0.586422384f},
-std::array<float,2>{0.141454548f, 0.0632679835f},
-std::array<float,2>{0.546586812f, 0.633649647f},
-std::array<float,2>{0.93825376f, 0.369477093f},
-std::array<float,2>{0.33581686f, 0.990501761f},
-std::array<float,2>{0.454140693f, 0.413359255f},
-std::array<float,2>{0.835773766f, 0.843431354f},
-std::array<float,2>{0.675063372f, 0.175138861f},
-std::array<float,2>{0.0962033942f, 0.541187942f},
-std::array<float,2>{0.284550846f, 0.231024951f},
-std::array<float,2>{0.877509594f, 0.610532463f},
-std::array<float,2>{0.602315307f, 0.464318186f},
-std::array<float,2>{0.240414158f, 0.778917372f},
-std::array<float,2>{0.0480875149f, 0.312012374f},
-std::array<float,2>{0.726062655f, 0.886248767f},
-std::array<float,2>{0.807934046f, 0.0581962205f},
-std::array<float,2>{0.412814975f, 0.741408467f},
-std::array<float,2>{0.213547558f, 0.152190581f},
-std::array<float,2>{0.591364086f, 0.504862189f},
-std::array<float,2>{0.935094595f, 0.396144807f},
-std::array<float,2>{0.259211242f, 0.860799074f},
-std::array<float,2>{0.378279686f, 0.320989043f},
-std::array<float,2>{0.756314993f, 0.951452255f},
-std::array<float,2>{0.704014361f, 0.122878686f},
-std::array<float,2>{0.0310180802f, 0.684164643f},
-std::array<float,2>{0.352446586f, 0.018079374f},
-std::array<float,2>{0.996490657f, 0.713649273f},
-std::array<float,2>{0.506301999f, 0.276325762f},
-std::array<float,2>{0.167874619f, 0.918311894f},
-std::array<float,2>{0.0903067887f, 0.490927577f},
-std::array<float,2>{0.656097651f, 0.805174708f},
-std::array<float,2>{0.87487787f, 0.212511405f},
-std::array<float,2>{0.482180983f, 0.575796247f},
-std::array<float,2>{0.0572885051f, 0.0868034661f},
-std::array<float,2>{0.729180515f, 0.653116286f},
-std::array<float,2>{0.799027026f, 0.350392312f},
-std::array<float,2>{0.418772727f, 0.972272277f},
-std::array<float,2>{0.291704684f, 0.424437374f},
-std::array<float,2>{0.883466721f, 0.819637358f},
-std::array<float,2>{0.599737108f, 0.169198111f},
-std::array<float,2>{0.243877113f, 0.554043293f},
-std::array<float,2>{0.465612203f, 0.248240441f},
-std::array<float,2>{0.840824604f, 0.606322408f},
-std::array<float,2>{0.686827242f, 0.438440412f},
-std::array<float,2>{0.104517139f, 0.756561875f},
-std::array<float,2>{0.152359098f, 0.281372428f},
-std::array<float,2>{0.537880361f, 0.898375392f},
-std::array<float,2>{0.94709444f, 0.0445448272f},
-std::array<float,2>{0.336931735f, 0.726833701f},
-std::array<float,2>{0.111262076f, 0.200812206f},
-std::array<float,2>{0.657886922f, 0.593341351f},
-std::array<float,2>{0.817856669f, 0.479769915f},
-std::array<float,2>{0.446776927f, 0.78652662f},
-std::array<float,2>{0.320535332f, 0.262343615f},
-std::array<float,2>{0.961821437f, 0.924585581f},
-std::array<float,2>{0.551562011f, 9.40109167e-05f},
-std::array<float,2>{0.130747586f, 0.69713074f},
-std::array<float,2>{0.43636018f, 0.101830855f},
-std::array<float,2>{0.782469928f, 0.664996147f},
-std::array<float,2>{0.738625705f, 0.335600108f},
-std::array<float,2>{0.0335839093f, 0.965631306f},
-std::array<float,2>{0.23168534f, 0.37600264f},
-std::array<float,2>{0.617591321f, 0.844057202f},
-std::array<float,2>{0.890962422f, 0.13991861f},
-std::array<float,2>{0.308431476f, 0.528653502f},
-std::array<float,2>{0.184734061f, 0.0610881895f},
-std::array<float,2>{0.524571121f, 0.736178994f},
-std::array<float,2>{0.969159305f, 0.307231396f},
-std::array<float,2>{0.371332109f, 0.886755407f},
-std::array<float,2>{0.491846472f, 0.466445446f},
-std::array<float,2>{0.844623327f, 0.774228871f},
-std::array<float,2>{0.637343824f, 0.227918983f},
-std::array<float,2>{0.0682766289f, 0.613351822f},
-std::array<float,2>{0.271036595f, 0.178998873f},
-std::array<float,2>{0.910615146f, 0.546253383f},
-std::array<float,2>{0.562784493f, 0.408717364f},
-std::array<float,2>{0.194276065f, 0.836539686f},
-std::array<float,2>{0.0120519903f, 0.372436613f},
-std::array<float,2>{0.696449041f, 0.98637861f},
-std::array<float,2>{0.778008342f, 0.0664852709f},
-std::array<float,2>{0.394440383f, 0.63724339f},
-std::array<float,2>{0.135635152f, 0.220549673f},
-std::array<float,2>{0.558196068f, 0.620942771f},
-std::array<float,2>{0.957346857f, 0.455206692f},
-std::array<float,2>{0.318768948f, 0.7706725f},
-std::array<float,2>{0.442071199f, 0.300401181f},
-std::array<float,2>{0.820895493f, 0.880440176f},
-std::array<float,2>{0.669970632f, 0.0509393662f},
-std::array<float,2>{0.117763206f, 0.742386281f},
-std::array<float,2>{0.298775196f, 0.0709365234f},
-std::array<float,2>{0.905527234f, 0.625351906f},
-std::array<float,2>{0.613227844f, 0.360202134f},
-std::array<float,2>{0.21934396f, 0.992424667f},
-std::array<float,2>{0.0390897356f, 0.415682554f},
-std::array<float,2>{0.74599421f, 0.834066987f},
-std::array<float,2>{0.796249568f, 0.186419949f},
-std::array<float,2>{0.428120434f, 0.532204509f},
-std::array<float,2>{0.0740464404f, 0.0152245509f},
-std::array<float,2>{0.62886548f, 0.688269615f},
-std::array<float,2>{0.85782361f, 0.253609031f},
-std::array<float,2>{0.495367378f, 0.934187531f},
-std::array<float,2>{0.364599556f, 0.470210224f},
-std::array<float,2>{0.976939976f, 0.789491773f},
-std::array<float,2>{0.518638134f, 0.193656787f},
-std::array<float,2>{0.173310384f, 0.579574764f},
-std::array<float,2>{0.403707802f, 0.131145418f},
-std::array<float,2>{0.770386457f, 0.515742183f},
-std::array<float,2>{0.691162407f, 0.388095021f},
-std::array<float,2>{0.000279427419f, 0.85690558f},
-std::array<float,2>{0.202385634f, 0.337499022f},
-std::array<float,2>{0.571072757f, 0.960034907f},
-std::array<float,2>{0.916515708f, 0.097948499f},
-std::array<float,2>{0.27476868f, 0.663193464f},
-std::array<float,2>{0.0211718511f, 0.160452947f},
-std::array<float,2>{0.716299355f, 0.557786882f},
-std::array<float,2>{0.763314962f, 0.4333179f},
-std::array<float,2>{0.387075633f, 0.822635949f},
-std::array<float,2>{0.25493446f, 0.354999632f},
-std::array<float,2>{0.925043285f, 0.980860353f},
-std::array<float,2>{0.582271397f, 0.0806209445f},
-std::array<float,2>{0.204326317f, 0.64759016f},
-std::array<float,2>{0.474174023f, 0.0331382304f},
-std::array<float,2>{0.862373352f, 0.723590434f},
-std::array<float,2>{0.641765118f, 0.293901742f},
-std::array<float,2>{0.0788717642f, 0.906001508f},
-std::array<float,2>{0.161761954f, 0.452785879f},
-std::array<float,2>{0.512413681f, 0.765323341f},
-std::array<float,2>{0.98593843f, 0.23481515f},
-std::array<float,2>{0.344996244f, 0.600468457f},
-std::array<float,2>{0.236285508f, 0.117073722f},
-std::array<float,2>{0.608717144f, 0.678279757f},
-std::array<float,2>{0.882659197f, 0.316452682f},
-std::array<float,2>{0.287197948f, 0.941300333f},
-std::array<float,2>{0.410076022f, 0.400453061f},
-std::array<float,2>{0.808817208f, 0.868369639f},
-std::array<float,2>{0.718913376f, 0.148366496f},
-std::array<float,2>{0.0519550778f, 0.508402288f},
-std::array<float,2>{0.331550866f, 0.208348691f},
-std::array<float,2>{0.94512099f, 0.564191878f},
-std::array<float,2>{0.541262507f, 0.495208412f},
-std::array<float,2>{0.146637946f, 0.80044812f},
-std::array<float,2>{0.0992613584f, 0.267614514f},
-std::array<float,2>{0.677255273f, 0.9109779f},
-std::array<float,2>{0.830140293f, 0.0307826977f},
-std::array<float,2>{0.458070636f, 0.707144439f},
-std::array<float,2>{0.125969663f, 0.159571528f},
-std::array<float,2>{0.546902418f, 0.561208606f},
-std::array<float,2>{0.966194808f, 0.433600903f},
-std::array<float,2>{0.326096296f, 0.825273573f},
-std::array<float,2>{0.452205241f, 0.356617242f},
-std::array<float,2>{0.814757049f, 0.978600562f},
-std::array<float,2>{0.661082625f, 0.0857325047f},
-std::array<float,2>{0.11578273f, 0.640628397f},
-std::array<float,2>{0.311615795f, 0.0381740592f},
-std::array<float,2>{0.897307158f, 0.721213996f},
-std::array<float,2>{0.624112904f, 0.291190296f},
-std::array<float,2>{0.229127645f, 0.899818182f},
-std::array<float,2>{0.0380669422f, 0.447584003f},
-std::array<float,2>{0.734582484f, 0.758597314f},
-std::array<float,2>{0.785745502f, 0.238755256f},
-std::array<float,2>{0.431802988f, 0.59490031f},
-std::array<float,2>{0.0633502156f, 0.112717561f},
-std::array<float,2>{0.635318458f, 0.674472272f},
-std::array<float,2>{0.849283397f, 0.312763959f},
-std::array<float,2>{0.485641271f, 0.944141448f},
-std::array<float,2>{0.369726688f, 0.403565943f},
-std::array<float,2>{0.974563658f, 0.873289227f},
-std::array<float,2>{0.529819667f, 0.144273326f},
-std::array<float,2>{0.180285901f, 0.511805892f},
-std::array<float,2>{0.397600561f, 0.204884455f},
-std::array<float,2>{0.777326167f, 0.568631411f},
-std::array<float,2>{0.702592313f, 0.498089284f},
-std::array<float,2>{0.00942134857f, 0.80118829f},
-std::array<float,2>{0.189768672f, 0.270472258f},
-std::array<float,2>{0.56691581f, 0.90727514f},
-std::array<float,2>{0.906321168f, 0.02517928f},
-std::array<float,2>{0.268063635f, 0.704168677f},
-std::array<float,2>{0.0239808317f, 0.224373475f},
-std::array<float,2>{0.708723009f, 0.622235715f},
-std::array<float,2>{0.750351191f, 0.457763672f},
-std::array<float,2>{0.37996465f, 0.765712857f},
-std::array<float,2>{0.26260221f, 0.30097428f},
-std::array<float,2>{0.930147111f, 0.877218127f},
-std::array<float,2>{0.587715685f, 0.0483010374f},
-std::array<float,2>{0.216197491f, 0.749155343f},
-std::array<float,2>{0.479229778f, 0.0776902586f},
-std::array<float,2>{0.867439806f, 0.631355524f},
-std::array<float,2>{0.649448931f, 0.364093155f},
-std::array<float,2>{0.0871831775f, 0.99985075f},
-std::array<float,2>{0.17047435f, 0.421630144f},
-std::array<float,2>{0.500881135f, 0.82933867f},
-std::array<float,2>{0.993318975f, 0.181475237f},
-std::array<float,2>{0.358825177f, 0.537393868f},
-std::array<float,2>{0.248241976f, 0.00962821767f},
-std::array<float,2>{0.595450461f, 0.692024708f},
-std::array<float,2>{0.886839151f, 0.255407393f},
-std::array<float,2>{0.29410705f, 0.932983935f},
-std::array<float,2>{0.414178222f, 0.474925905f},
-std::array<float,2>{0.802096903f, 0.795040727f},
-std::array<float,2>{0.732777357f, 0.190069109f},
-std::array<float,2>{0.062051516f, 0.585212111f},
-std::array<float,2>{0.3426705f, 0.128825217f},
-std::array<float,2>{0.949279249f, 0.520861685f},
-std::array<float,2>{0.534194469f, 0.384803504f},
-std::array<float,2>{0.149464056f, 0.851841748f},
-std::array<float,2>{0.10641513f, 0.341671526f},
-std::array<float,2>{0.681240737f, 0.954094708f},
-std::array<float,2>{0.837531328f, 0.0950253755f},
-std::array<float,2>{0.463668019f, 0.658636689f},
-std::array<float,2>{0.207781985f, 0.196743652f},
-std::array<float,2>{0.579885542f, 0.587181926f},
-std::array<float,2>{0.926603734f, 0.482556075f},
-std::array<float,2>{0.253088832f, 0.78475225f},
-std::array<float,2>{0.383665293f, 0.261462986f},
-std::array<float,2>{0.759980619f, 0.928463578f},
-std::array<float,2>{0.712549627f, 0.00537825795f},
-std::array<float,2>{0.0171398167f, 0.699934721f},
-std::array<float,2>{0.351017237f, 0.108373418f},
-std::array<float,2>{0.990482092f, 0.669132888f},
-std::array<float,2>{0.50843823f, 0.329380959f},
-std::array<float,2>{0.160062134f, 0.962599277f},
-std::array<float,2>{0.0834872499f, 0.38088581f},
-std::array<float,2>{0.646987915f, 0.849985182f},
-std::array<float,2>{0.864010394f, 0.133926064f},
-std::array<float,2>{0.471419722f, 0.525128782f},
-std::array<float,2>{0.0499432459f, 0.0570836812f},
-std::array<float,2>{0.723369956f, 0.740525186f},
-std::array<float,2>{0.806132913f, 0.310624033f},
-std::array<float,2>{0.411135942f, 0.885371506f},
-std::array<float,2>{0.28125909f, 0.463345408f},
-std::array<float,2>{0.875795424f, 0.778248906f},
-std::array<float,2>{0.605159938f, 0.232087359f},
-std::array<float,2>{0.240143016f, 0.610216379f},
-std::array<float,2>{0.455849767f, 0.174456269f},
-std::array<float,2>{0.833468914f, 0.542448163f},
-std::array<float,2>{0.67323631f, 0.413017541f},
-std::array<float,2>{0.0947196335f, 0.841881514f},
-std::array<float,2>{0.142919883f, 0.37036711f},
-std::array<float,2>{0.544260442f, 0.991249204f},
-std::array<float,2>{0.940583289f, 0.0638994351f},
-std::array<float,2>{0.333914876f, 0.63405478f},
-std::array<float,2>{0.123508297f, 0.155924037f},
-std::array<float,2>{0.665002465f, 0.500376761f},
-std::array<float,2>{0.827218533f, 0.392963827f},
-std::array<float,2>{0.440580904f, 0.864147604f},
-std::array<float,2>{0.314674497f, 0.327333987f},
-std::array<float,2>{0.955553234f, 0.945848346f},
-std::array<float,2>{0.560399294f, 0.118400186f},
-std::array<float,2>{0.138146386f, 0.682144523f},
-std::array<float,2>{0.423647195f, 0.0197198875f},
-std::array<float,2>{0.789287388f, 0.716890931f},
-std::array<float,2>{0.747044206f, 0.27848798f},
-std::array<float,2>{0.0457685441f, 0.916596591f},
-std::array<float,2>{0.223804638f, 0.485607475f},
-std::array<float,2>{0.615065634f, 0.812041223f},
-std::array<float,2>{0.898956597f, 0.216443241f},
-std::array<float,2>{0.303185612f, 0.574168861f},
-std::array<float,2>{0.178295687f, 0.0907544196f},
-std::array<float,2>{0.521970391f, 0.649062514f},
-std::array<float,2>{0.981879115f, 0.347532183f},
-std::array<float,2>{0.360313952f, 0.976426721f},
-std::array<float,2>{0.497393608f, 0.428301364f},
-std::array<float,2>{0.852119863f, 0.814446032f},
-std::array<float,2>{0.630406439f, 0.167041153f},
-std::array<float,2>{0.0776880682f, 0.548335135f},
-std::array<float,2>{0.279743254f, 0.244173482f},
-std::array<float,2>{0.919352889f, 0.605322123f},
-std::array<float,2>{0.575048506f, 0.444167465f},
-std::array<float,2>{0.195423871f, 0.750458121f},
-std::array<float,2>{0.00438949699f, 0.28643021f},
-std::array<float,2>{0.691586733f, 0.892767668f},
-std::array<float,2>{0.767760456f, 0.0428726375f},
-std::array<float,2>{0.39891991f, 0.732696652f},
-std::array<float,2>{0.234326228f, 0.139546543f},
-std::array<float,2>{0.619612396f, 0.527606308f},
-std::array<float,2>{0.894353569f, 0.375792384f},
-std::array<float,2>{0.306012839f, 0.845034361f},
-std::array<float,2>{0.433825791f, 0.334950894f},
-std::array<float,2>{0.783888519f, 0.966126382f},
-std::array<float,2>{0.741593063f, 0.102849424f},
-std::array<float,2>{0.0325445682f, 0.665942013f},
-std::array<float,2>{0.322456568f, 0.00179769273f},
-std::array<float,2>{0.964081883f, 0.695749342f},
-std::array<float,2>{0.553311586f, 0.262744635f},
-std::array<float,2>{0.131536037f, 0.925297081f},
-std::array<float,2>{0.111678474f, 0.479397923f},
-std::array<float,2>{0.659346938f, 0.785675824f},
-std::array<float,2>{0.819928706f, 0.200035229f},
-std::array<float,2>{0.448485523f, 0.592111647f},
-std::array<float,2>{0.013734214f, 0.0677135661f},
-std::array<float,2>{0.697530389f, 0.638603508f},
-std::array<float,2>{0.779454648f, 0.371469229f},
-std::array<float,2>{0.390827954f, 0.987741232f},
-std::array<float,2>{0.272317261f, 0.409874171f},
-std::array<float,2>{0.913354576f, 0.8378793f},
-std::array<float,2>{0.564751983f, 0.178640708f},
-std::array<float,2>{0.192633614f, 0.545457125f},
-std::array<float,2>{0.489618719f, 0.22723113f},
-std::array<float,2>{0.847555816f, 0.614887238f},
-std::array<float,2>{0.638803124f, 0.465705216f},
-std::array<float,2>{0.0700350851f, 0.775280535f},
-std::array<float,2>{0.185818523f, 0.308481097f},
-std::array<float,2>{0.52555418f, 0.887905121f},
-std::array<float,2>{0.971324265f, 0.0615607165f},
-std::array<float,2>{0.374731928f, 0.734393954f},
-std::array<float,2>{0.0929418281f, 0.211067632f},
-std::array<float,2>{0.653972566f, 0.574966908f},
-std::array<float,2>{0.872315943f, 0.49203074f},
-std::array<float,2>{0.482835233f, 0.80581516f},
-std::array<float,2>{0.353878558f, 0.276447773f},
-std::array<float,2>{0.998470247f, 0.919878244f},
-std::array<float,2>{0.505752027f, 0.0192924868f},
-std::array<float,2>{0.165847704f, 0.714330792f},
-std::array<float,2>{0.376634598f, 0.12152373f},
-std::array<float,2>{0.754334509f, 0.68536371f},
-std::array<float,2>{0.706089795f, 0.321742624f},
-std::array<float,2>{0.0291942861f, 0.952920616f},
-std::array<float,2>{0.212763384f, 0.395498365f},
-std::array<float,2>{0.592401981f, 0.859956026f},
-std::array<float,2>{0.935768962f, 0.150694698f},
-std::array<float,2>{0.260462046f, 0.505675912f},
-std::array<float,2>{0.154611915f, 0.043322973f},
-std::array<float,2>{0.535904884f, 0.727901161f},
-std::array<float,2>{0.948773324f, 0.282781273f},
-std::array<float,2>{0.339224488f, 0.896574497f},
-std::array<float,2>{0.46703735f, 0.439053893f},
-std::array<float,2>{0.843385398f, 0.757000566f},
-std::array<float,2>{0.683869481f, 0.249109685f},
-std::array<float,2>{0.102005191f, 0.606747746f},
-std::array<float,2>{0.289842218f, 0.168289647f},
-std::array<float,2>{0.884777546f, 0.553002417f},
-std::array<float,2>{0.598916352f, 0.425149143f},
-std::array<float,2>{0.246058688f, 0.819107413f},
-std::array<float,2>{0.0561239123f, 0.351326108f},
-std::array<float,2>{0.727800429f, 0.971347451f},
-std::array<float,2>{0.798248112f, 0.0876406506f},
-std::array<float,2>{0.421471745f, 0.653606176f},
-std::array<float,2>{0.163206726f, 0.235825628f},
-std::array<float,2>{0.513956904f, 0.601343334f},
-std::array<float,2>{0.986386061f, 0.451774478f},
-std::array<float,2>{0.346722782f, 0.764279425f},
-std::array<float,2>{0.47558862f, 0.294411629f},
-std::array<float,2>{0.861277699f, 0.905012131f},
-std::array<float,2>{0.643713117f, 0.0320072249f},
-std::array<float,2>{0.0814118981f, 0.724153042f},
-std::array<float,2>{0.256627351f, 0.0818495527f},
-std::array<float,2>{0.922676563f, 0.646650612f},
-std::array<float,2>{0.585631073f, 0.353864759f},
-std::array<float,2>{0.205790609f, 0.981480122f},
-std::array<float,2>{0.022048112f, 0.432262361f},
-std::array<float,2>{0.718261719f, 0.82413137f},
-std::array<float,2>{0.764389217f, 0.161690801f},
-std::array<float,2>{0.389537215f, 0.5574103f},
-std::array<float,2>{0.0998640656f, 0.029372016f},
-std::array<float,2>{0.679280162f, 0.708942652f},
-std::array<float,2>{0.829895079f, 0.269234449f},
-std::array<float,2>{0.460778594f, 0.912059903f},
-std::array<float,2>{0.328216583f, 0.495018691f},
-std::array<float,2>{0.941502094f, 0.79962647f},
-std::array<float,2>{0.539218187f, 0.207388937f},
-std::array<float,2>{0.145813301f, 0.562759697f},
-std::array<float,2>{0.407014608f, 0.14720729f},
-std::array<float,2>{0.810591161f, 0.509390712f},
-std::array<float,2>{0.722506881f, 0.401757181f},
-std::array<float,2>{0.0544802994f, 0.86775583f},
-std::array<float,2>{0.238250315f, 0.318124264f},
-std::array<float,2>{0.607039332f, 0.939632893f},
-std::array<float,2>{0.880569696f, 0.115600683f},
-std::array<float,2>{0.285925537f, 0.678909063f},
-std::array<float,2>{0.0417780615f, 0.18738687f},
-std::array<float,2>{0.743554771f, 0.533104777f},
-std::array<float,2>{0.794511676f, 0.414441764f},
-std::array<float,2>{0.426878214f, 0.835516095f},
-std::array<float,2>{0.300070316f, 0.361013055f},
-std::array<float,2>{0.903042614f, 0.993832409f},
-std::array<float,2>{0.610353827f, 0.0713078454f},
-std::array<float,2>{0.220881402f, 0.62692523f},
-std::array<float,2>{0.444299012f, 0.0523858629f},
-std::array<float,2>{0.822719872f, 0.743204951f},
-std::array<float,2>{0.668370843f, 0.299502373f},
-std::array<float,2>{0.120618388f, 0.879315257f},
-std::array<float,2>{0.133388072f, 0.456725776f},
-std::array<float,2>{0.55581218f, 0.770243347f},
-std::array<float,2>{0.959413111f, 0.219501778f},
-std::array<float,2>{0.317806244f, 0.62007165f},
-std::array<float,2>{0.200516909f, 0.0993783474f},
-std::array<float,2>{0.572660446f, 0.662599802f},
-std::array<float,2>{0.915040791f, 0.336518496f},
-std::array<float,2>{0.276948541f, 0.959835351f},
-std::array<float,2>{0.406168401f, 0.386934787f},
-std::array<float,2>{0.772659421f, 0.855776608f},
-std::array<float,2>{0.68835336f, 0.132044911f},
-std::array<float,2>{0.00285137957f, 0.517087638f},
-std::array<float,2>{0.365284204f, 0.195094749f},
-std::array<float,2>{0.978764832f, 0.57856667f},
-std::array<float,2>{0.51602155f, 0.469278604f},
-std::array<float,2>{0.175014675f, 0.790296614f},
-std::array<float,2>{0.0718409196f, 0.252527267f},
-std::array<float,2>{0.626806259f, 0.935107172f},
-std::array<float,2>{0.855877578f, 0.0138628101f},
-std::array<float,2>{0.493381739f, 0.688649058f},
-std::array<float,2>{0.18328476f, 0.140851542f},
-std::array<float,2>{0.528601944f, 0.514115691f},
-std::array<float,2>{0.974870026f, 0.406095743f},
-std::array<float,2>{0.368537813f, 0.872124016f},
-std::array<float,2>{0.487235397f, 0.315297663f},
-std::array<float,2>{0.851098597f, 0.942236245f},
-std::array<float,2>{0.633880675f, 0.11132367f},
-std::array<float,2>{0.0653961301f, 0.672389448f},
-std::array<float,2>{0.266619861f, 0.0272344314f},
-std::array<float,2>{0.909909785f, 0.706902981f},
-std::array<float,2>{0.568403602f, 0.273329526f},
-std::array<float,2>{0.187617734f, 0.909984708f},
-std::array<float,2>{0.0100301132f, 0.496579558f},
-std::array<float,2>{0.700608909f, 0.803494632f},
-std::array<float,2>{0.774463296f, 0.205490455f},
-std::array<float,2>{0.396153241f, 0.567839444f},
-std::array<float,2>{0.114202052f, 0.0827880502f},
-std::array<float,2>{0.663984478f, 0.644119918f},
-std::array<float,2>{0.814182639f, 0.357852161f},
-std::array<float,2>{0.449658811f, 0.977535248f},
-std::array<float,2>{0.326529175f, 0.436945528f},
-std::array<float,2>{0.967674434f, 0.827915013f},
-std::array<float,2>{0.550318599f, 0.156570539f},
-std::array<float,2>{0.127869084f, 0.560385585f},
-std::array<float,2>{0.430079192f, 0.240972161f},
-std::array<float,2>{0.788849354f, 0.59613198f},
-std::array<float,2>{0.737863719f, 0.445590764f},
-std::array<float,2>{0.0369883478f, 0.76118201f},
-std::array<float,2>{0.227831692f, 0.290436625f},
-std::array<float,2>{0.621820271f, 0.90157634f},
-std::array<float,2>{0.896391094f, 0.0352834798f},
-std::array<float,2>{0.30879429f, 0.720073581f},
-std::array<float,2>{0.0587621368f, 0.187863886f},
-std::array<float,2>{0.731854498f, 0.582142353f},
-std::array<float,2>{0.80359596f, 0.473547101f},
-std::array<float,2>{0.417050689f, 0.794120908f},
-std::array<float,2>{0.296376765f, 0.256414443f},
-std::array<float,2>{0.889655948f, 0.930309057f},
-std::array<float,2>{0.596250355f, 0.0114260223f},
-std::array<float,2>{0.247194216f, 0.693689704f},
-std::array<float,2>{0.460944861f, 0.0967276469f},
-std::array<float,2>{0.838820696f, 0.656486034f},
-std::array<float,2>{0.683417499f, 0.342880666f},
-std::array<float,2>{0.108635604f, 0.955990255f},
-std::array<float,2>{0.15135853f, 0.38282907f},
-std::array<float,2>{0.532192111f, 0.855050206f},
-std::array<float,2>{0.952566206f, 0.126075387f},
-std::array<float,2>{0.340906352f, 0.522551477f},
-std::array<float,2>{0.21732232f, 0.0498363376f},
-std::array<float,2>{0.588443518f, 0.74611491f},
-std::array<float,2>{0.932539701f, 0.304588348f},
-std::array<float,2>{0.264872789f, 0.876560569f},
-std::array<float,2>{0.382543325f, 0.460572392f},
-std::array<float,2>{0.752648473f, 0.768509567f},
-std::array<float,2>{0.70900166f, 0.225045413f},
-std::array<float,2>{0.0269448869f, 0.623590767f},
-std::array<float,2>{0.356660903f, 0.183451548f},
-std::array<float,2>{0.99608022f, 0.535412312f},
-std::array<float,2>{0.503741682f, 0.418977469f},
-std::array<float,2>{0.169198766f, 0.830719888f},
-std::array<float,2>{0.0889634043f, 0.365717679f},
-std::array<float,2>{0.651699126f, 0.997584403f},
-std::array<float,2>{0.870764315f, 0.0752889588f},
-std::array<float,2>{0.47814849f, 0.63000977f},
-std::array<float,2>{0.242132917f, 0.232471004f},
-std::array<float,2>{0.603248656f, 0.613005936f},
-std::array<float,2>{0.878687024f, 0.461428851f},
-std::array<float,2>{0.283608109f, 0.780271113f},
-std::array<float,2>{0.413295835f, 0.30904001f},
-std::array<float,2>{0.806705654f, 0.883118927f},
-std::array<float,2>{0.724944592f, 0.0546970628f},
-std::array<float,2>{0.0478043184f, 0.739078879f},
-std::array<float,2>{0.334790975f, 0.0644612238f},
-std::array<float,2>{0.938932002f, 0.634888887f},
-std::array<float,2>{0.545369565f, 0.36719349f},
-std::array<float,2>{0.142259538f, 0.989157856f},
-std::array<float,2>{0.097221598f, 0.412045091f},
-std::array<float,2>{0.674342036f, 0.840468645f},
-std::array<float,2>{0.834093332f, 0.172744736f},
-std::array<float,2>{0.453949004f, 0.540245295f},
-std::array<float,2>{0.0183784217f, 0.00761859352f},
-std::array<float,2>{0.713274479f, 0.702335298f},
-std::array<float,2>{0.758027673f, 0.258551121f},
-std::array<float,2>{0.385090113f, 0.927188814f},
-std::array<float,2>{0.251498193f, 0.481034368f},
-std::array<float,2>{0.927754223f, 0.782487869f},
-std::array<float,2>{0.580711246f, 0.198043033f},
-std::array<float,2>{0.210259438f, 0.58932215f},
-std::array<float,2>{0.469721615f, 0.135652781f},
-std::array<float,2>{0.866129816f, 0.525590599f},
-std::array<float,2>{0.644981563f, 0.379724354f},
-std::array<float,2>{0.085630469f, 0.847810745f},
-std::array<float,2>{0.15707764f, 0.330816001f},
-std::array<float,2>{0.51056093f, 0.963283718f},
-std::array<float,2>{0.989514351f, 0.106247142f},
-std::array<float,2>{0.349085212f, 0.670485556f},
-std::array<float,2>{0.075061053f, 0.164247245f},
-std::array<float,2>{0.631455481f, 0.549247801f},
-std::array<float,2>{0.853964567f, 0.426502824f},
-std::array<float,2>{0.499391496f, 0.814757288f},
-std::array<float,2>{0.361629486f, 0.34502995f},
-std::array<float,2>{0.983754754f, 0.972690046f},
-std::array<float,2>{0.519913375f, 0.0923215225f},
-std::array<float,2>{0.175962448f, 0.651623189f},
-std::array<float,2>{0.402038336f, 0.0409006104f},
-std::array<float,2>{0.767490983f, 0.730777144f},
-std::array<float,2>{0.693482637f, 0.288458019f},
-std::array<float,2>{0.00722922292f, 0.891365945f},
-std::array<float,2>{0.198551357f, 0.44289583f},
-std::array<float,2>{0.577817798f, 0.752729714f},
-std::array<float,2>{0.921149611f, 0.242492616f},
-std::array<float,2>{0.278179258f, 0.60212332f},
-std::array<float,2>{0.139537975f, 0.120618947f},
-std::array<float,2>{0.561202288f, 0.680480719f},
-std::array<float,2>{0.9550457f, 0.324625939f},
-std::array<float,2>{0.313897192f, 0.948094964f},
-std::array<float,2>{0.437934488f, 0.391301364f},
-std::array<float,2>{0.825026989f, 0.865348458f},
-std::array<float,2>{0.666995108f, 0.152841568f},
-std::array<float,2>{0.121811002f, 0.503189206f},
-std::array<float,2>{0.302229583f, 0.218065485f},
-std::array<float,2>{0.900832295f, 0.570868075f},
-std::array<float,2>{0.615356803f, 0.48761636f},
-std::array<float,2>{0.225903153f, 0.809764385f},
-std::array<float,2>{0.0443203561f, 0.27974844f},
-std::array<float,2>{0.748218238f, 0.91421771f},
-std::array<float,2>{0.79248482f, 0.0229705665f},
-std::array<float,2>{0.425269395f, 0.715853631f},
-std::array<float,2>{0.195071653f, 0.176311851f},
-std::array<float,2>{0.563690543f, 0.544826746f},
-std::array<float,2>{0.912100315f, 0.40671441f},
-std::array<float,2>{0.269593358f, 0.839819849f},
-std::array<float,2>{0.392834097f, 0.37333703f},
-std::array<float,2>{0.778433681f, 0.984998822f},
-std::array<float,2>{0.695662796f, 0.0702581778f},
-std::array<float,2>{0.0129603567f, 0.639584839f},
-std::array<float,2>{0.372843057f, 0.0593531542f},
-std::array<float,2>{0.969846964f, 0.737356365f},
-std::array<float,2>{0.523732901f, 0.30573532f},
-std::array<float,2>{0.183612242f, 0.888997734f},
-std::array<float,2>{0.0673541501f, 0.467755586f},
-std::array<float,2>{0.638345122f, 0.776708484f},
-std::array<float,2>{0.845242739f, 0.229448989f},
-std::array<float,2>{0.490951508f, 0.616782844f},
-std::array<float,2>{0.0351234339f, 0.105114736f},
-std::array<float,2>{0.739330709f, 0.666027665f},
-std::array<float,2>{0.781910598f, 0.332775414f},
-std::array<float,2>{0.43697536f, 0.96832633f},
-std::array<float,2>{0.30753848f, 0.377412409f},
-std::array<float,2>{0.891665399f, 0.847351432f},
-std::array<float,2>{0.618280113f, 0.137607589f},
-std::array<float,2>{0.231022492f, 0.530312061f},
-std::array<float,2>{0.445821971f, 0.202248722f},
-std::array<float,2>{0.816433012f, 0.590095878f},
-std::array<float,2>{0.657168388f, 0.477312446f},
-std::array<float,2>{0.110116571f, 0.787863493f},
-std::array<float,2>{0.129124567f, 0.263880819f},
-std::array<float,2>{0.552642703f, 0.922910094f},
-std::array<float,2>{0.962881684f, 0.00307498826f},
-std::array<float,2>{0.322009981f, 0.697542548f},
-std::array<float,2>{0.103656039f, 0.247377872f},
-std::array<float,2>{0.68615365f, 0.608897746f},
-std::array<float,2>{0.840410531f, 0.440773189f},
-std::array<float,2>{0.4662126f, 0.755361795f},
-std::array<float,2>{0.336505592f, 0.284726828f},
-std::array<float,2>{0.945442975f, 0.89511472f},
-std::array<float,2>{0.53845644f, 0.0458041355f},
-std::array<float,2>{0.154095009f, 0.729297101f},
-std::array<float,2>{0.419206828f, 0.0883677676f},
-std::array<float,2>{0.799920976f, 0.655885339f},
-std::array<float,2>{0.729922593f, 0.349498451f},
-std::array<float,2>{0.058458548f, 0.969058216f},
-std::array<float,2>{0.242569938f, 0.423004717f},
-std::array<float,2>{0.601091564f, 0.81680882f},
-std::array<float,2>{0.883991897f, 0.169951811f},
-std::array<float,2>{0.29245615f, 0.551786244f},
-std::array<float,2>{0.166840717f, 0.0161459371f},
-std::array<float,2>{0.507596552f, 0.711410999f},
-std::array<float,2>{0.997904539f, 0.274093568f},
-std::array<float,2>{0.353058279f, 0.920903087f},
-std::array<float,2>{0.481111854f, 0.489391774f},
-std::array<float,2>{0.873073697f, 0.806709886f},
-std::array<float,2>{0.654992104f, 0.21378547f},
-std::array<float,2>{0.0917699933f, 0.577845216f},
-std::array<float,2>{0.258564413f, 0.14888981f},
-std::array<float,2>{0.934439123f, 0.506948531f},
-std::array<float,2>{0.5903216f, 0.397180885f},
-std::array<float,2>{0.214462519f, 0.861705601f},
-std::array<float,2>{0.0300230738f, 0.323650479f},
-std::array<float,2>{0.704874933f, 0.949440718f},
-std::array<float,2>{0.757702947f, 0.124020614f},
-std::array<float,2>{0.377867728f, 0.687095821f},
-std::array<float,2>{0.147496477f, 0.209294409f},
-std::array<float,2>{0.542237997f, 0.565446317f},
-std::array<float,2>{0.943426073f, 0.493924618f},
-std::array<float,2>{0.330588251f, 0.798050106f},
-std::array<float,2>{0.457161158f, 0.266438991f},
-std::array<float,2>{0.831092417f, 0.913032353f},
-std::array<float,2>{0.676206768f, 0.0279235542f},
-std::array<float,2>{0.097968474f, 0.710199833f},
-std::array<float,2>{0.288098723f, 0.115188651f},
-std::array<float,2>{0.881196558f, 0.677106977f},
-std::array<float,2>{0.608284354f, 0.319308102f},
-std::array<float,2>{0.234512135f, 0.937650323f},
-std::array<float,2>{0.0510292463f, 0.399478734f},
-std::array<float,2>{0.720534563f, 0.870503366f},
-std::array<float,2>{0.810153306f, 0.145596236f},
-std::array<float,2>{0.408332705f, 0.510050356f},
-std::array<float,2>{0.0793259293f, 0.0339958221f},
-std::array<float,2>{0.641458273f, 0.725661218f},
-std::array<float,2>{0.861431479f, 0.295561671f},
-std::array<float,2>{0.47305885f, 0.904191732f},
-std::array<float,2>{0.344468832f, 0.450015068f},
-std::array<float,2>{0.984888017f, 0.762260973f},
-std::array<float,2>{0.513666987f, 0.237600178f},
-std::array<float,2>{0.160286203f, 0.599529505f},
-std::array<float,2>{0.388498783f, 0.163579211f},
-std::array<float,2>{0.762652695f, 0.555353224f},
-std::array<float,2>{0.714928865f, 0.430930167f},
-std::array<float,2>{0.0200787969f, 0.82156378f},
-std::array<float,2>{0.203158841f, 0.352945924f},
-std::array<float,2>{0.583384454f, 0.984067142f},
-std::array<float,2>{0.923980534f, 0.0781329125f},
-std::array<float,2>{0.254070044f, 0.645569742f},
-std::array<float,2>{0.00104770379f, 0.130700931f},
-std::array<float,2>{0.689955533f, 0.518540621f},
-std::array<float,2>{0.770765841f, 0.38993901f},
-std::array<float,2>{0.402896911f, 0.858599603f},
-std::array<float,2>{0.27345714f, 0.338916153f},
-std::array<float,2>{0.917178035f, 0.957689226f},
-std::array<float,2>{0.571454763f, 0.10059794f},
-std::array<float,2>{0.201555386f, 0.661446989f},
-std::array<float,2>{0.494826049f, 0.0127845118f},
-std::array<float,2>{0.858859599f, 0.689992845f},
-std::array<float,2>{0.627497792f, 0.250697702f},
-std::array<float,2>{0.0727807432f, 0.937165141f},
-std::array<float,2>{0.172252923f, 0.471815497f},
-std::array<float,2>{0.518090427f, 0.792351902f},
-std::array<float,2>{0.978367746f, 0.193245351f},
-std::array<float,2>{0.364053488f, 0.580789149f},
-std::array<float,2>{0.220584884f, 0.0733009279f},
-std::array<float,2>{0.611462235f, 0.627892733f},
-std::array<float,2>{0.904909194f, 0.36209619f},
-std::array<float,2>{0.29704383f, 0.994448006f},
-std::array<float,2>{0.4293167f, 0.417759329f},
-std::array<float,2>{0.79518187f, 0.832792938f},
-std::array<float,2>{0.744718194f, 0.185239166f},
-std::array<float,2>{0.0407538749f, 0.534412026f},
-std::array<float,2>{0.320220917f, 0.221970916f},
-std::array<float,2>{0.958697379f, 0.618836403f},
-std::array<float,2>{0.556692362f, 0.45313105f},
-std::array<float,2>{0.136416629f, 0.772182405f},
-std::array<float,2>{0.118723117f, 0.296973944f},
-std::array<float,2>{0.671701074f, 0.881076932f},
-std::array<float,2>{0.821913004f, 0.0532809757f},
-std::array<float,2>{0.443016469f, 0.745786786f},
-std::array<float,2>{0.138227642f, 0.152793601f},
-std::array<float,2>{0.559615433f, 0.503561735f},
-std::array<float,2>{0.955710113f, 0.390868604f},
-std::array<float,2>{0.315285802f, 0.866051316f},
-std::array<float,2>{0.441313833f, 0.324878365f},
-std::array<float,2>{0.827727318f, 0.947676182f},
-std::array<float,2>{0.664175391f, 0.12056189f},
-std::array<float,2>{0.123612218f, 0.679782391f},
-std::array<float,2>{0.303316802f, 0.0225860476f},
-std::array<float,2>{0.898499846f, 0.716609001f},
-std::array<float,2>{0.614711285f, 0.280014962f},
-std::array<float,2>{0.224462971f, 0.91494441f},
-std::array<float,2>{0.0450083353f, 0.488130957f},
-std::array<float,2>{0.746270895f, 0.810145319f},
-std::array<float,2>{0.789934337f, 0.218589604f},
-std::array<float,2>{0.423185766f, 0.570678532f},
-std::array<float,2>{0.0773879066f, 0.092226699f},
-std::array<float,2>{0.629946351f, 0.652146161f},
-std::array<float,2>{0.851805389f, 0.345285088f},
-std::array<float,2>{0.497659355f, 0.973514974f},
-std::array<float,2>{0.35957554f, 0.426028788f},
-std::array<float,2>{0.982352376f, 0.815195262f},
-std::array<float,2>{0.522182286f, 0.16469115f},
-std::array<float,2>{0.178193778f, 0.549654067f},
-std::array<float,2>{0.399194628f, 0.242763758f},
-std::array<float,2>{0.768128157f, 0.60192585f},
-std::array<float,2>{0.692056775f, 0.442384362f},
-std::array<float,2>{0.00479887426f, 0.752235651f},
-std::array<float,2>{0.195919365f, 0.288582027f},
-std::array<float,2>{0.57425642f, 0.890735686f},
-std::array<float,2>{0.919746101f, 0.0403555594f},
-std::array<float,2>{0.279852897f, 0.731074333f},
-std::array<float,2>{0.016711235f, 0.19750075f},
-std::array<float,2>{0.712196767f, 0.589514554f},
-std::array<float,2>{0.760353088f, 0.480545163f},
-std::array<float,2>{0.383197784f, 0.782854438f},
-std::array<float,2>{0.253769964f, 0.257982492f},
-std::array<float,2>{0.925931573f, 0.927288473f},
-std::array<float,2>{0.579539239f, 0.00716105057f},
-std::array<float,2>{0.207376719f, 0.702774346f},
-std::array<float,2>{0.471091777f, 0.105563812f},
-std::array<float,2>{0.863578796f, 0.670193613f},
-std::array<float,2>{0.646948338f, 0.330345035f},
-std::array<float,2>{0.0836169273f, 0.963723123f},
-std::array<float,2>{0.159430698f, 0.379052818f},
-std::array<float,2>{0.508050561f, 0.848469138f},
-std::array<float,2>{0.99086988f, 0.135230601f},
-std::array<float,2>{0.35145241f, 0.526120722f},
-std::array<float,2>{0.239555269f, 0.0553197861f},
-std::array<float,2>{0.604800761f, 0.738755882f},
-std::array<float,2>{0.875362515f, 0.30913505f},
-std::array<float,2>{0.281813651f, 0.883636415f},
-std::array<float,2>{0.411688268f, 0.461004347f},
-std::array<float,2>{0.806632638f, 0.779320359f},
-std::array<float,2>{0.723015606f, 0.232912242f},
-std::array<float,2>{0.0505195893f, 0.612347662f},
-std::array<float,2>{0.333374649f, 0.172030091f},
-std::array<float,2>{0.941067159f, 0.540783346f},
-std::array<float,2>{0.544632375f, 0.411152124f},
-std::array<float,2>{0.14329356f, 0.840071559f},
-std::array<float,2>{0.0941405892f, 0.367880642f},
-std::array<float,2>{0.673730433f, 0.988431454f},
-std::array<float,2>{0.833982527f, 0.0650500357f},
-std::array<float,2>{0.45535478f, 0.635549545f},
-std::array<float,2>{0.216671214f, 0.225259036f},
-std::array<float,2>{0.587150216f, 0.623206079f},
-std::array<float,2>{0.930593967f, 0.46044454f},
-std::array<float,2>{0.261775672f, 0.767672002f},
-std::array<float,2>{0.380418479f, 0.304175347f},
-std::array<float,2>{0.750958562f, 0.876206696f},
-std::array<float,2>{0.708179414f, 0.0504483767f},
-std::array<float,2>{0.0235135611f, 0.746834934f},
-std::array<float,2>{0.359061062f, 0.0761645883f},
-std::array<float,2>{0.993726373f, 0.63054812f},
-std::array<float,2>{0.500344455f, 0.365755111f},
-std::array<float,2>{0.170287654f, 0.997191131f},
-std::array<float,2>{0.0878273621f, 0.41958034f},
-std::array<float,2>{0.649935126f, 0.830549777f},
-std::array<float,2>{0.867699027f, 0.183093771f},
-std::array<float,2>{0.478556305f, 0.535676301f},
-std::array<float,2>{0.0617879815f, 0.0111326976f},
-std::array<float,2>{0.73295778f, 0.694283128f},
-std::array<float,2>{0.802480876f, 0.255962193f},
-std::array<float,2>{0.414561152f, 0.930007815f},
-std::array<float,2>{0.294553548f, 0.473104507f},
-std::array<float,2>{0.887342274f, 0.794469357f},
-std::array<float,2>{0.595015883f, 0.18843928f},
-std::array<float,2>{0.248696774f, 0.582949698f},
-std::array<float,2>{0.463155389f, 0.12680088f},
-std::array<float,2>{0.837305546f, 0.523124218f},
-std::array<float,2>{0.681097448f, 0.383626938f},
-std::array<float,2>{0.105841167f, 0.854532897f},
-std::array<float,2>{0.149970978f, 0.343365878f},
-std::array<float,2>{0.534729302f, 0.955417931f},
-std::array<float,2>{0.950008273f, 0.0976052806f},
-std::array<float,2>{0.34216848f, 0.656961381f},
-std::array<float,2>{0.115450889f, 0.157058239f},
-std::array<float,2>{0.660526037f, 0.559580982f},
-std::array<float,2>{0.815310955f, 0.43748799f},
-std::array<float,2>{0.452894598f, 0.827567458f},
-std::array<float,2>{0.325626314f, 0.357935041f},
-std::array<float,2>{0.966791928f, 0.976973236f},
-std::array<float,2>{0.5477404f, 0.0822137073f},
-std::array<float,2>{0.125217333f, 0.643807054f},
-std::array<float,2>{0.43221271f, 0.0360305682f},
-std::array<float,2>{0.785325408f, 0.720291615f},
-std::array<float,2>{0.735078514f, 0.290861666f},
-std::array<float,2>{0.0374348238f, 0.902014077f},
-std::array<float,2>{0.228901759f, 0.446242929f},
-std::array<float,2>{0.62487489f, 0.761489928f},
-std::array<float,2>{0.896522105f, 0.240695536f},
-std::array<float,2>{0.312338173f, 0.596372783f},
-std::array<float,2>{0.180109799f, 0.110402033f},
-std::array<float,2>{0.529420972f, 0.672162533f},
-std::array<float,2>{0.973645985f, 0.314484894f},
-std::array<float,2>{0.369223237f, 0.941712558f},
-std::array<float,2>{0.486118108f, 0.405682534f},
-std::array<float,2>{0.848767638f, 0.872586489f},
-std::array<float,2>{0.635037482f, 0.141272783f},
-std::array<float,2>{0.0625499561f, 0.51420939f},
-std::array<float,2>{0.268552929f, 0.205900505f},
-std::array<float,2>{0.906766117f, 0.568084419f},
-std::array<float,2>{0.566690266f, 0.496788591f},
-std::array<float,2>{0.190426797f, 0.803113818f},
-std::array<float,2>{0.00927091762f, 0.272887647f},
-std::array<float,2>{0.703073502f, 0.909351468f},
-std::array<float,2>{0.776622653f, 0.0266369823f},
-std::array<float,2>{0.398418665f, 0.706408262f},
-std::array<float,2>{0.221310869f, 0.184696019f},
-std::array<float,2>{0.611176133f, 0.535066247f},
-std::array<float,2>{0.902437449f, 0.417042077f},
-std::array<float,2>{0.300415695f, 0.832312524f},
-std::array<float,2>{0.427440852f, 0.36163497f},
-std::array<float,2>{0.794115782f, 0.994811356f},
-std::array<float,2>{0.743695855f, 0.0737950653f},
-std::array<float,2>{0.0413452126f, 0.6270715f},
-std::array<float,2>{0.318166912f, 0.0528737642f},
-std::array<float,2>{0.959494293f, 0.745418251f},
-std::array<float,2>{0.556603611f, 0.29752475f},
-std::array<float,2>{0.133004814f, 0.881581843f},
-std::array<float,2>{0.120222598f, 0.453674376f},
-std::array<float,2>{0.668744981f, 0.771534204f},
-std::array<float,2>{0.822893858f, 0.222573325f},
-std::array<float,2>{0.443756491f, 0.618461013f},
-std::array<float,2>{0.00243917201f, 0.101390287f},
-std::array<float,2>{0.687909365f, 0.66177249f},
-std::array<float,2>{0.773373902f, 0.33940205f},
-std::array<float,2>{0.405533701f, 0.957178652f},
-std::array<float,2>{0.276380628f, 0.390151739f},
-std::array<float,2>{0.915809214f, 0.858966529f},
-std::array<float,2>{0.573174179f, 0.130002126f},
-std::array<float,2>{0.201020688f, 0.517900884f},
-std::array<float,2>{0.494116843f, 0.192542315f},
-std::array<float,2>{0.85641402f, 0.580342531f},
-std::array<float,2>{0.625981987f, 0.472636044f},
-std::array<float,2>{0.0714637712f, 0.792873621f},
-std::array<float,2>{0.175486863f, 0.250481188f},
-std::array<float,2>{0.516191185f, 0.936958909f},
-std::array<float,2>{0.979317546f, 0.0133822989f},
-std::array<float,2>{0.365999997f, 0.689642131f},
-std::array<float,2>{0.0815522224f, 0.238194257f},
-std::array<float,2>{0.644440651f, 0.59908396f},
-std::array<float,2>{0.860675752f, 0.44924438f},
-std::array<float,2>{0.476530641f, 0.762067437f},
-std::array<float,2>{0.347439855f, 0.295244515f},
-std::array<float,2>{0.986920536f, 0.903643966f},
-std::array<float,2>{0.51444006f, 0.0332806222f},
-std::array<float,2>{0.163579524f, 0.726425648f},
-std::array<float,2>{0.388946474f, 0.0786786973f},
-std::array<float,2>{0.763976216f, 0.646445632f},
-std::array<float,2>{0.718025863f, 0.35331735f},
-std::array<float,2>{0.0216042455f, 0.983613431f},
-std::array<float,2>{0.205566302f, 0.431423366f},
-std::array<float,2>{0.585316837f, 0.822128713f},
-std::array<float,2>{0.922108471f, 0.163460702f},
-std::array<float,2>{0.25591597f, 0.554979622f},
-std::array<float,2>{0.146171689f, 0.0274304878f},
-std::array<float,2>{0.539569259f, 0.710518122f},
-std::array<float,2>{0.942003846f, 0.265692919f},
-std::array<float,2>{0.328919858f, 0.912540019f},
-std::array<float,2>{0.460129678f, 0.493437678f},
-std::array<float,2>{0.829340518f, 0.798552871f},
-std::array<float,2>{0.679125488f, 0.209611729f},
-std::array<float,2>{0.100506358f, 0.566158414f},
-std::array<float,2>{0.285192311f, 0.146385878f},
-std::array<float,2>{0.880084634f, 0.510684848f},
-std::array<float,2>{0.606568038f, 0.39993453f},
-std::array<float,2>{0.237608671f, 0.870924056f},
-std::array<float,2>{0.0540007055f, 0.318430424f},
-std::array<float,2>{0.72182864f, 0.938337207f},
-std::array<float,2>{0.811062157f, 0.114493184f},
-std::array<float,2>{0.406642735f, 0.677397907f},
-std::array<float,2>{0.165118754f, 0.213176742f},
-std::array<float,2>{0.505062044f, 0.577504575f},
-std::array<float,2>{0.998611808f, 0.490198433f},
-std::array<float,2>{0.354073018f, 0.807321668f},
-std::array<float,2>{0.483163923f, 0.273846865f},
-std::array<float,2>{0.872888863f, 0.92181474f},
-std::array<float,2>{0.653776169f, 0.0159364138f},
-std::array<float,2>{0.0936492532f, 0.711799264f},
-std::array<float,2>{0.260092944f, 0.123441882f},
-std::array<float,2>{0.936087847f, 0.686957777f},
-std::array<float,2>{0.592047155f, 0.324029714f},
-std::array<float,2>{0.212016076f, 0.950039864f},
-std::array<float,2>{0.0287438817f, 0.396916568f},
-std::array<float,2>{0.706687272f, 0.861816823f},
-std::array<float,2>{0.754542112f, 0.148971602f},
-std::array<float,2>{0.376081049f, 0.507335722f},
-std::array<float,2>{0.102220863f, 0.0452068001f},
-std::array<float,2>{0.68411094f, 0.728553295f},
-std::array<float,2>{0.843214095f, 0.284425586f},
-std::array<float,2>{0.467444599f, 0.894587696f},
-std::array<float,2>{0.339472413f, 0.441244006f},
-std::array<float,2>{0.948324442f, 0.755799472f},
-std::array<float,2>{0.53554821f, 0.247966006f},
-std::array<float,2>{0.155261755f, 0.608838975f},
-std::array<float,2>{0.421352029f, 0.170472354f},
-std::array<float,2>{0.798747301f, 0.552271187f},
-std::array<float,2>{0.728291094f, 0.423517346f},
-std::array<float,2>{0.0565766841f, 0.817150056f},
-std::array<float,2>{0.245289788f, 0.34895879f},
-std::array<float,2>{0.599342883f, 0.969640195f},
-std::array<float,2>{0.885564566f, 0.0883877948f},
-std::array<float,2>{0.289424926f, 0.655554295f},
-std::array<float,2>{0.0331600234f, 0.136861145f},
-std::array<float,2>{0.742035151f, 0.530968606f},
-std::array<float,2>{0.783675313f, 0.37785387f},
-std::array<float,2>{0.434375614f, 0.84706521f},
-std::array<float,2>{0.306390584f, 0.332411468f},
-std::array<float,2>{0.893613696f, 0.967814445f},
-std::array<float,2>{0.620094478f, 0.104641937f},
-std::array<float,2>{0.233455151f, 0.666805327f},
-std::array<float,2>{0.448947549f, 0.00351581303f},
-std::array<float,2>{0.819758594f, 0.697826326f},
-std::array<float,2>{0.659776568f, 0.264442563f},
-std::array<float,2>{0.111909293f, 0.923421323f},
-std::array<float,2>{0.130904183f, 0.47668162f},
-std::array<float,2>{0.553083003f, 0.787446856f},
-std::array<float,2>{0.964606643f, 0.202896103f},
-std::array<float,2>{0.322835565f, 0.590769053f},
-std::array<float,2>{0.193044215f, 0.069391869f},
-std::array<float,2>{0.565318763f, 0.638811171f},
-std::array<float,2>{0.913913369f, 0.373977423f},
-std::array<float,2>{0.271539479f, 0.984551728f},
-std::array<float,2>{0.391283244f, 0.406740546f},
-std::array<float,2>{0.780191243f, 0.839328647f},
-std::array<float,2>{0.698101342f, 0.175880894f},
-std::array<float,2>{0.0144699523f, 0.544153035f},
-std::array<float,2>{0.374130338f, 0.228615969f},
-std::array<float,2>{0.970859706f, 0.616618276f},
-std::array<float,2>{0.526332259f, 0.466800004f},
-std::array<float,2>{0.186136648f, 0.777233243f},
-std::array<float,2>{0.0693478361f, 0.306214482f},
-std::array<float,2>{0.639240205f, 0.889431953f},
-std::array<float,2>{0.846913934f, 0.0588046238f},
-std::array<float,2>{0.490113318f, 0.738146424f},
-std::array<float,2>{0.176415443f, 0.167651236f},
-std::array<float,2>{0.520488381f, 0.548383653f},
-std::array<float,2>{0.983932316f, 0.427845985f},
-std::array<float,2>{0.362028092f, 0.813545406f},
-std::array<float,2>{0.499528259f, 0.346695006f},
-std::array<float,2>{0.854121268f, 0.975671232f},
-std::array<float,2>{0.630965471f, 0.0901907012f},
-std::array<float,2>{0.0744860172f, 0.648656666f},
-std::array<float,2>{0.277445465f, 0.0423128977f},
-std::array<float,2>{0.921609282f, 0.733191848f},
-std::array<float,2>{0.577195168f, 0.286718279f},
-std::array<float,2>{0.19906342f, 0.893533945f},
-std::array<float,2>{0.00780662242f, 0.443503678f},
-std::array<float,2>{0.694246054f, 0.750548184f},
-std::array<float,2>{0.766701162f, 0.244866878f},
-std::array<float,2>{0.401481628f, 0.604759276f},
-std::array<float,2>{0.121286333f, 0.119049154f},
-std::array<float,2>{0.667967141f, 0.681711197f},
-std::array<float,2>{0.824397445f, 0.327950865f},
-std::array<float,2>{0.438368738f, 0.945526958f},
-std::array<float,2>{0.314239264f, 0.393197954f},
-std::array<float,2>{0.954113662f, 0.863600552f},
-std::array<float,2>{0.560842276f, 0.155298024f},
-std::array<float,2>{0.138845742f, 0.500654757f},
-std::array<float,2>{0.425604016f, 0.21623002f},
-std::array<float,2>{0.792137027f, 0.573427141f},
-std::array<float,2>{0.748751521f, 0.486161232f},
-std::array<float,2>{0.0445759632f, 0.811569512f},
-std::array<float,2>{0.226413831f, 0.27911666f},
-std::array<float,2>{0.616083562f, 0.916134417f},
-std::array<float,2>{0.901138067f, 0.0204878747f},
-std::array<float,2>{0.302627772f, 0.71769464f},
-std::array<float,2>{0.0469047092f, 0.231508538f},
-std::array<float,2>{0.725107133f, 0.609799445f},
-std::array<float,2>{0.807541788f, 0.463469148f},
-std::array<float,2>{0.413995117f, 0.777394235f},
-std::array<float,2>{0.28384012f, 0.311349422f},
-std::array<float,2>{0.878367603f, 0.885129511f},
-std::array<float,2>{0.602652967f, 0.0573308766f},
-std::array<float,2>{0.241309762f, 0.741132617f},
-std::array<float,2>{0.453435659f, 0.0640509948f},
-std::array<float,2>{0.834912717f, 0.634537816f},
-std::array<float,2>{0.674108565f, 0.370886922f},
-std::array<float,2>{0.0971291736f, 0.991937101f},
-std::array<float,2>{0.142062396f, 0.412120432f},
-std::array<float,2>{0.545698822f, 0.842325389f},
-std::array<float,2>{0.939385653f, 0.174019009f},
-std::array<float,2>{0.334467173f, 0.542733073f},
-std::array<float,2>{0.210897133f, 0.00511898613f},
-std::array<float,2>{0.580415666f, 0.699350059f},
-std::array<float,2>{0.928359747f, 0.260924369f},
-std::array<float,2>{0.251333743f, 0.927802265f},
-std::array<float,2>{0.385738194f, 0.483067036f},
-std::array<float,2>{0.758527875f, 0.784205198f},
-std::array<float,2>{0.713437319f, 0.196945637f},
-std::array<float,2>{0.0177196972f, 0.587506831f},
-std::array<float,2>{0.349473298f, 0.134302661f},
-std::array<float,2>{0.990181148f, 0.524489164f},
-std::array<float,2>{0.510217667f, 0.381636769f},
-std::array<float,2>{0.156732738f, 0.850348055f},
-std::array<float,2>{0.0849748254f, 0.329795271f},
-std::array<float,2>{0.645352662f, 0.962295055f},
-std::array<float,2>{0.865598321f, 0.107896373f},
-std::array<float,2>{0.468948007f, 0.669443905f},
-std::array<float,2>{0.247932196f, 0.189905748f},
-std::array<float,2>{0.595721245f, 0.585516572f},
-std::array<float,2>{0.8904742f, 0.475332797f},
-std::array<float,2>{0.29686591f, 0.795746684f},
-std::array<float,2>{0.417619437f, 0.255339622f},
-std::array<float,2>{0.803142846f, 0.933117807f},
-std::array<float,2>{0.731979609f, 0.00881876145f},
-std::array<float,2>{0.0592653751f, 0.691811681f},
-std::array<float,2>{0.341340631f, 0.0953889564f},
-std::array<float,2>{0.95283556f, 0.658861578f},
-std::array<float,2>{0.531350374f, 0.340862244f},
-std::array<float,2>{0.15051493f, 0.95330447f},
-std::array<float,2>{0.109342486f, 0.385437876f},
-std::array<float,2>{0.683062494f, 0.852433622f},
-std::array<float,2>{0.838334978f, 0.128322795f},
-std::array<float,2>{0.461799949f, 0.521146834f},
-std::array<float,2>{0.0263845026f, 0.0486055389f},
-std::array<float,2>{0.709543705f, 0.749570847f},
-std::array<float,2>{0.751976788f, 0.301331311f},
-std::array<float,2>{0.382180572f, 0.877486229f},
-std::array<float,2>{0.265337646f, 0.457391709f},
-std::array<float,2>{0.932030499f, 0.766513765f},
-std::array<float,2>{0.588174284f, 0.223717228f},
-std::array<float,2>{0.217100173f, 0.622597456f},
-std::array<float,2>{0.477658272f, 0.18072854f},
-std::array<float,2>{0.87052232f, 0.538058758f},
-std::array<float,2>{0.652178884f, 0.421048999f},
-std::array<float,2>{0.0894018561f, 0.829895258f},
-std::array<float,2>{0.169674054f, 0.363535523f},
-std::array<float,2>{0.503139019f, 0.999274492f},
-std::array<float,2>{0.995243311f, 0.0773858726f},
-std::array<float,2>{0.357156277f, 0.631062567f},
-std::array<float,2>{0.0644752756f, 0.143941417f},
-std::array<float,2>{0.634589911f, 0.512317538f},
-std::array<float,2>{0.850895584f, 0.403997451f},
-std::array<float,2>{0.48638007f, 0.873737812f},
-std::array<float,2>{0.368695885f, 0.313473225f},
-std::array<float,2>{0.975558639f, 0.943824172f},
-std::array<float,2>{0.528848767f, 0.112799443f},
-std::array<float,2>{0.182842791f, 0.674281061f},
-std::array<float,2>{0.395720631f, 0.0248244479f},
-std::array<float,2>{0.775128961f, 0.704600155f},
-std::array<float,2>{0.700815916f, 0.269544452f},
-std::array<float,2>{0.0103735337f, 0.907748461f},
-std::array<float,2>{0.188298866f, 0.498814851f},
-std::array<float,2>{0.569060385f, 0.801437616f},
-std::array<float,2>{0.909328938f, 0.204245776f},
-std::array<float,2>{0.26721397f, 0.569026113f},
-std::array<float,2>{0.126983985f, 0.0851025134f},
-std::array<float,2>{0.549929798f, 0.641469479f},
-std::array<float,2>{0.967060387f, 0.356993437f},
-std::array<float,2>{0.326774687f, 0.979066908f},
-std::array<float,2>{0.44986546f, 0.434512615f},
-std::array<float,2>{0.813826501f, 0.826115906f},
-std::array<float,2>{0.663275778f, 0.160076261f},
-std::array<float,2>{0.113668576f, 0.560844123f},
-std::array<float,2>{0.309136212f, 0.239136413f},
-std::array<float,2>{0.895516932f, 0.595243156f},
-std::array<float,2>{0.621439397f, 0.447949916f},
-std::array<float,2>{0.228250206f, 0.757851243f},
-std::array<float,2>{0.0361950621f, 0.291831315f},
-std::array<float,2>{0.737332344f, 0.900375307f},
-std::array<float,2>{0.788141012f, 0.0388088003f},
-std::array<float,2>{0.430368334f, 0.720870793f},
-std::array<float,2>{0.201900631f, 0.132460773f},
-std::array<float,2>{0.571847439f, 0.517540514f},
-std::array<float,2>{0.917704642f, 0.387630463f},
-std::array<float,2>{0.274133116f, 0.856101513f},
-std::array<float,2>{0.40249303f, 0.33611992f},
-std::array<float,2>{0.771238387f, 0.959253192f},
-std::array<float,2>{0.689617217f, 0.0986537635f},
-std::array<float,2>{0.0017176955f, 0.662440181f},
-std::array<float,2>{0.363494128f, 0.0142583391f},
-std::array<float,2>{0.97799921f, 0.689158618f},
-std::array<float,2>{0.517907679f, 0.252158374f},
-std::array<float,2>{0.172670573f, 0.934816957f},
-std::array<float,2>{0.0725540295f, 0.468997329f},
-std::array<float,2>{0.627355993f, 0.790918231f},
-std::array<float,2>{0.859244108f, 0.194728717f},
-std::array<float,2>{0.494394749f, 0.578904331f},
-std::array<float,2>{0.0403379388f, 0.0722465217f},
-std::array<float,2>{0.74425447f, 0.626446068f},
-std::array<float,2>{0.795449376f, 0.360353351f},
-std::array<float,2>{0.429096401f, 0.993197083f},
-std::array<float,2>{0.297754377f, 0.4148148f},
-std::array<float,2>{0.904419839f, 0.835353971f},
-std::array<float,2>{0.612202585f, 0.186640263f},
-std::array<float,2>{0.220087737f, 0.532594919f},
-std::array<float,2>{0.442400306f, 0.219220087f},
-std::array<float,2>{0.821670473f, 0.619490206f},
-std::array<float,2>{0.6712991f, 0.456162035f},
-std::array<float,2>{0.118555255f, 0.769723773f},
-std::array<float,2>{0.135963917f, 0.299238861f},
-std::array<float,2>{0.557424426f, 0.879430234f},
-std::array<float,2>{0.958170593f, 0.0519594252f},
-std::array<float,2>{0.319336295f, 0.743910611f},
-std::array<float,2>{0.0985159427f, 0.207640782f},
-std::array<float,2>{0.676428735f, 0.563062072f},
-std::array<float,2>{0.831904233f, 0.494341969f},
-std::array<float,2>{0.457626671f, 0.799234986f},
-std::array<float,2>{0.330290288f, 0.269034296f},
-std::array<float,2>{0.94418323f, 0.911323071f},
-std::array<float,2>{0.542498648f, 0.0302568879f},
-std::array<float,2>{0.148032308f, 0.708474994f},
-std::array<float,2>{0.408762962f, 0.115979828f},
-std::array<float,2>{0.809866011f, 0.679318368f},
-std::array<float,2>{0.71982789f, 0.317682117f},
-std::array<float,2>{0.0514089428f, 0.939997911f},
-std::array<float,2>{0.235029191f, 0.402067214f},
-std::array<float,2>{0.607538164f, 0.867562592f},
-std::array<float,2>{0.881595135f, 0.146534815f},
-std::array<float,2>{0.288813531f, 0.50891757f},
-std::array<float,2>{0.160690919f, 0.0313243978f},
-std::array<float,2>{0.512774348f, 0.723719656f},
-std::array<float,2>{0.984487295f, 0.294706374f},
-std::array<float,2>{0.343991101f, 0.904573739f},
-std::array<float,2>{0.473270714f, 0.451375455f},
-std::array<float,2>{0.862163007f, 0.764053822f},
-std::array<float,2>{0.640722871f, 0.236077979f},
-std::array<float,2>{0.0798615962f, 0.600727022f},
-std::array<float,2>{0.254630893f, 0.161140814f},
-std::array<float,2>{0.924397171f, 0.556736112f},
-std::array<float,2>{0.58381027f, 0.431741863f},
-std::array<float,2>{0.20372647f, 0.823288441f},
-std::array<float,2>{0.0198076461f, 0.354344606f},
-std::array<float,2>{0.7155568f, 0.982306659f},
-std::array<float,2>{0.761946797f, 0.0811632648f},
-std::array<float,2>{0.387995005f, 0.647247314f},
-std::array<float,2>{0.153490439f, 0.24953416f},
-std::array<float,2>{0.538902819f, 0.607208908f},
-std::array<float,2>{0.946042717f, 0.438635916f},
-std::array<float,2>{0.336272806f, 0.757697225f},
-std::array<float,2>{0.466628939f, 0.282479674f},
-std::array<float,2>{0.839933634f, 0.897027493f},
-std::array<float,2>{0.685829639f, 0.0436009094f},
-std::array<float,2>{0.104270801f, 0.728226662f},
-std::array<float,2>{0.292812049f, 0.0870003253f},
-std::array<float,2>{0.884675086f, 0.654156566f},
-std::array<float,2>{0.601054609f, 0.35093835f},
-std::array<float,2>{0.242867798f, 0.970823467f},
-std::array<float,2>{0.0576455817f, 0.425414652f},
-std::array<float,2>{0.730328262f, 0.818543196f},
-std::array<float,2>{0.800348699f, 0.168860763f},
-std::array<float,2>{0.41980654f, 0.553623259f},
-std::array<float,2>{0.0912313759f, 0.0189380161f},
-std::array<float,2>{0.654659688f, 0.714549124f},
-std::array<float,2>{0.873909175f, 0.27689153f},
-std::array<float,2>{0.480697066f, 0.919430733f},
-std::array<float,2>{0.352543175f, 0.491269559f},
-std::array<float,2>{0.997226f, 0.806421578f},
-std::array<float,2>{0.507313788f, 0.211854368f},
-std::array<float,2>{0.166177377f, 0.57459867f},
-std::array<float,2>{0.377386063f, 0.151315451f},
-std::array<float,2>{0.757003665f, 0.505018234f},
-std::array<float,2>{0.704390407f, 0.39461714f},
-std::array<float,2>{0.0297190323f, 0.859584153f},
-std::array<float,2>{0.213957846f, 0.322019547f},
-std::array<float,2>{0.59044534f, 0.952475607f},
-std::array<float,2>{0.933749795f, 0.121623315f},
-std::array<float,2>{0.258060873f, 0.684684992f},
-std::array<float,2>{0.0136244455f, 0.177760899f},
-std::array<float,2>{0.695958257f, 0.54515475f},
-std::array<float,2>{0.779006124f, 0.409510791f},
-std::array<float,2>{0.393256873f, 0.837370634f},
-std::array<float,2>{0.270030528f, 0.371614814f},
-std::array<float,2>{0.911189377f, 0.988039017f},
-std::array<float,2>{0.564051032f, 0.0679414421f},
-std::array<float,2>{0.194735214f, 0.638085604f},
-std::array<float,2>{0.490251392f, 0.0621374957f},
-std::array<float,2>{0.844908118f, 0.735267997f},
-std::array<float,2>{0.637868822f, 0.307752371f},
-std::array<float,2>{0.0667518452f, 0.888377011f},
-std::array<float,2>{0.184186757f, 0.465107709f},
-std::array<float,2>{0.524101436f, 0.774475396f},
-std::array<float,2>{0.970473051f, 0.226788208f},
-std::array<float,2>{0.372243315f, 0.614438415f},
-std::array<float,2>{0.230818093f, 0.103421144f},
-std::array<float,2>{0.619027853f, 0.665380359f},
-std::array<float,2>{0.892104685f, 0.334190667f},
-std::array<float,2>{0.306772351f, 0.96663928f},
-std::array<float,2>{0.437190801f, 0.375312001f},
-std::array<float,2>{0.78173089f, 0.84527576f},
-std::array<float,2>{0.740153491f, 0.139146507f},
-std::array<float,2>{0.0342322588f, 0.527989745f},
-std::array<float,2>{0.321613371f, 0.199648067f},
-std::array<float,2>{0.961988747f, 0.592370987f},
-std::array<float,2>{0.552024662f, 0.478871763f},
-std::array<float,2>{0.129541025f, 0.785512984f},
-std::array<float,2>{0.109419033f, 0.263564974f},
-std::array<float,2>{0.65646261f, 0.924890995f},
-std::array<float,2>{0.816895843f, 0.00135524897f},
-std::array<float,2>{0.445347786f, 0.695990503f},
-std::array<float,2>{0.143572658f, 0.175336257f},
-std::array<float,2>{0.543260455f, 0.541897833f},
-std::array<float,2>{0.93993175f, 0.413708776f},
-std::array<float,2>{0.332523257f, 0.843096614f},
-std::array<float,2>{0.456154406f, 0.370055169f},
-std::array<float,2>{0.832149446f, 0.991036236f},
-std::array<float,2>{0.672357678f, 0.0625572801f},
-std::array<float,2>{0.0955980346f, 0.63298738f},
-std::array<float,2>{0.2826702f, 0.0578371137f},
-std::array<float,2>{0.876393139f, 0.741754472f},
-std::array<float,2>{0.604177952f, 0.311922699f},
-std::array<float,2>{0.239205047f, 0.885921121f},
-std::array<float,2>{0.049227763f, 0.464588612f},
-std::array<float,2>{0.72435385f, 0.778488934f},
-std::array<float,2>{0.805201173f, 0.230941549f},
-std::array<float,2>{0.410360664f, 0.610953808f},
-std::array<float,2>{0.0825772583f, 0.108561918f},
-std::array<float,2>{0.647590935f, 0.668104708f},
-std::array<float,2>{0.864908516f, 0.328875124f},
-std::array<float,2>{0.472305894f, 0.961616695f},
-std::array<float,2>{0.35011676f, 0.382509828f},
-std::array<float,2>{0.992036879f, 0.851330757f},
-std::array<float,2>{0.50919807f, 0.13351582f},
-std::array<float,2>{0.158526942f, 0.523784995f},
-std::array<float,2>{0.384562403f, 0.195354f},
-std::array<float,2>{0.761439204f, 0.586454332f},
-std::array<float,2>{0.711586595f, 0.483882487f},
-std::array<float,2>{0.0163980704f, 0.783305705f},
-std::array<float,2>{0.208103269f, 0.259777874f},
-std::array<float,2>{0.578777373f, 0.929381907f},
-std::array<float,2>{0.927534819f, 0.00443747034f},
-std::array<float,2>{0.252741665f, 0.70040983f},
-std::array<float,2>{0.00569246709f, 0.245533884f},
-std::array<float,2>{0.692976892f, 0.603536487f},
-std::array<float,2>{0.769395173f, 0.445108056f},
-std::array<float,2>{0.399991751f, 0.751710057f},
-std::array<float,2>{0.281001151f, 0.285546511f},
-std::array<float,2>{0.918321788f, 0.89445585f},
-std::array<float,2>{0.575761318f, 0.0415544212f},
-std::array<float,2>{0.196972057f, 0.733624756f},
-std::array<float,2>{0.496207744f, 0.0915918946f},
-std::array<float,2>{0.85280472f, 0.650116622f},
-std::array<float,2>{0.62900269f, 0.345959365f},
-std::array<float,2>{0.0765953362f, 0.974829793f},
-std::array<float,2>{0.178997859f, 0.428788155f},
-std::array<float,2>{0.523138881f, 0.813069522f},
-std::array<float,2>{0.981422484f, 0.16613169f},
-std::array<float,2>{0.360893309f, 0.547195494f},
-std::array<float,2>{0.222864375f, 0.0213978458f},
-std::array<float,2>{0.613722682f, 0.718373597f},
-std::array<float,2>{0.899974763f, 0.277530074f},
-std::array<float,2>{0.304030389f, 0.917461634f},
-std::array<float,2>{0.421896279f, 0.484830707f},
-std::array<float,2>{0.790664256f, 0.810678661f},
-std::array<float,2>{0.747644246f, 0.215071484f},
-std::array<float,2>{0.0464710295f, 0.573052347f},
-std::array<float,2>{0.315988094f, 0.15465878f},
-std::array<float,2>{0.956405938f, 0.500994086f},
-std::array<float,2>{0.558663666f, 0.394108087f},
-std::array<float,2>{0.136847317f, 0.864371836f},
-std::array<float,2>{0.124394529f, 0.32698983f},
-std::array<float,2>{0.665413499f, 0.946920097f},
-std::array<float,2>{0.826246381f, 0.117540129f},
-std::array<float,2>{0.439945728f, 0.683512092f},
-std::array<float,2>{0.191241086f, 0.203765646f},
-std::array<float,2>{0.567825496f, 0.56964314f},
-std::array<float,2>{0.90742898f, 0.499668211f},
-std::array<float,2>{0.268950462f, 0.802597761f},
-std::array<float,2>{0.396716595f, 0.271376193f},
-std::array<float,2>{0.775598586f, 0.906869292f},
-std::array<float,2>{0.701577485f, 0.0235248376f},
-std::array<float,2>{0.00869989861f, 0.704072773f},
-std::array<float,2>{0.370786399f, 0.11221043f},
-std::array<float,2>{0.973407745f, 0.675347388f},
-std::array<float,2>{0.530355394f, 0.314319581f},
-std::array<float,2>{0.181427687f, 0.944791257f},
-std::array<float,2>{0.0643564835f, 0.402920336f},
-std::array<float,2>{0.636433423f, 0.874711573f},
-std::array<float,2>{0.848164439f, 0.142929316f},
-std::array<float,2>{0.484776884f, 0.513375223f},
-std::array<float,2>{0.038848877f, 0.0378968045f},
-std::array<float,2>{0.735535562f, 0.7220276f},
-std::array<float,2>{0.786944091f, 0.292967796f},
-std::array<float,2>{0.432812661f, 0.899359047f},
-std::array<float,2>{0.311152965f, 0.448945969f},
-std::array<float,2>{0.898394108f, 0.759037793f},
-std::array<float,2>{0.623883188f, 0.240107074f},
-std::array<float,2>{0.229586914f, 0.594009697f},
-std::array<float,2>{0.451761484f, 0.158683851f},
-std::array<float,2>{0.815905392f, 0.561675131f},
-std::array<float,2>{0.661535561f, 0.434893638f},
-std::array<float,2>{0.116598442f, 0.824552774f},
-std::array<float,2>{0.126139641f, 0.355519056f},
-std::array<float,2>{0.548684776f, 0.979878128f},
-std::array<float,2>{0.965461075f, 0.0843075365f},
-std::array<float,2>{0.324538589f, 0.64162904f},
-std::array<float,2>{0.107114196f, 0.127733126f},
-std::array<float,2>{0.680247664f, 0.519896626f},
-std::array<float,2>{0.836689055f, 0.386047959f},
-std::array<float,2>{0.464744985f, 0.852867305f},
-std::array<float,2>{0.343005955f, 0.340562433f},
-std::array<float,2>{0.95025003f, 0.954742193f},
-std::array<float,2>{0.53320384f, 0.0941008776f},
-std::array<float,2>{0.149236277f, 0.659910142f},
-std::array<float,2>{0.415146887f, 0.00811644737f},
-std::array<float,2>{0.801148236f, 0.692451835f},
-std::array<float,2>{0.733569384f, 0.253957599f},
-std::array<float,2>{0.0611307025f, 0.931907594f},
-std::array<float,2>{0.249510571f, 0.476039171f},
-std::array<float,2>{0.594616592f, 0.79678756f},
-std::array<float,2>{0.887921512f, 0.1910225f},
-std::array<float,2>{0.293607354f, 0.584338367f},
-std::array<float,2>{0.171483085f, 0.0770715177f},
-std::array<float,2>{0.501151145f, 0.632222056f},
-std::array<float,2>{0.992541671f, 0.364485681f},
-std::array<float,2>{0.358165801f, 0.998215735f},
-std::array<float,2>{0.480448008f, 0.420885205f},
-std::array<float,2>{0.868810356f, 0.828491509f},
-std::array<float,2>{0.648759186f, 0.180244878f},
-std::array<float,2>{0.0860129967f, 0.538231969f},
-std::array<float,2>{0.262852997f, 0.223379984f},
-std::array<float,2>{0.931339324f, 0.62156266f},
-std::array<float,2>{0.586123288f, 0.458089381f},
-std::array<float,2>{0.214936644f, 0.767539203f},
-std::array<float,2>{0.0247607064f, 0.302282065f},
-std::array<float,2>{0.707637072f, 0.878743708f},
-std::array<float,2>{0.751107335f, 0.0470065363f},
-std::array<float,2>{0.379731923f, 0.748735428f},
-std::array<float,2>{0.236482725f, 0.147921786f},
-std::array<float,2>{0.606274664f, 0.507918894f},
-std::array<float,2>{0.879085124f, 0.400960088f},
-std::array<float,2>{0.286294937f, 0.868951678f},
-std::array<float,2>{0.407887876f, 0.317060351f},
-std::array<float,2>{0.812098742f, 0.940910161f},
-std::array<float,2>{0.721172392f, 0.116443433f},
-std::array<float,2>{0.052851405f, 0.677899957f},
-std::array<float,2>{0.3298482f, 0.0306028966f},
-std::array<float,2>{0.9433586f, 0.707632244f},
-std::array<float,2>{0.540377259f, 0.268082857f},
-std::array<float,2>{0.144947827f, 0.910425961f},
-std::array<float,2>{0.101122409f, 0.495855451f},
-std::array<float,2>{0.678065777f, 0.799820185f},
-std::array<float,2>{0.828976274f, 0.208652109f},
-std::array<float,2>{0.459028304f, 0.563676834f},
-std::array<float,2>{0.0229094364f, 0.0804012343f},
-std::array<float,2>{0.717482924f, 0.648259819f},
-std::array<float,2>{0.764835358f, 0.354935944f},
-std::array<float,2>{0.390418082f, 0.981422722f},
-std::array<float,2>{0.257806629f, 0.433087856f},
-std::array<float,2>{0.922936559f, 0.823230505f},
-std::array<float,2>{0.584551275f, 0.161016375f},
-std::array<float,2>{0.206766814f, 0.558541298f},
-std::array<float,2>{0.474833488f, 0.235042408f},
-std::array<float,2>{0.860097229f, 0.600055993f},
-std::array<float,2>{0.643367767f, 0.452391684f},
-std::array<float,2>{0.0808660462f, 0.765018225f},
-std::array<float,2>{0.162565753f, 0.293138444f},
-std::array<float,2>{0.515401006f, 0.905460298f},
-std::array<float,2>{0.987762928f, 0.0324356183f},
-std::array<float,2>{0.346299529f, 0.723097503f},
-std::array<float,2>{0.0706875101f, 0.194167867f},
-std::array<float,2>{0.625450075f, 0.579968154f},
-std::array<float,2>{0.856523514f, 0.470233589f},
-std::array<float,2>{0.492424756f, 0.789652765f},
-std::array<float,2>{0.366312653f, 0.253087014f},
-std::array<float,2>{0.980353236f, 0.933763266f},
-std::array<float,2>{0.517272294f, 0.0146756088f},
-std::array<float,2>{0.17463927f, 0.687951803f},
-std::array<float,2>{0.404732943f, 0.0983557031f},
-std::array<float,2>{0.772375524f, 0.663969159f},
-std::array<float,2>{0.689167976f, 0.337393373f},
-std::array<float,2>{0.00298109069f, 0.960930765f},
-std::array<float,2>{0.199373379f, 0.388509154f},
-std::array<float,2>{0.573700309f, 0.857002378f},
-std::array<float,2>{0.91484046f, 0.13164036f},
-std::array<float,2>{0.275698304f, 0.516319931f},
-std::array<float,2>{0.134257972f, 0.0513294227f},
-std::array<float,2>{0.555596709f, 0.742711246f},
-std::array<float,2>{0.960722625f, 0.299883932f},
-std::array<float,2>{0.317214668f, 0.879976809f},
-std::array<float,2>{0.444483846f, 0.455839247f},
-std::array<float,2>{0.823708296f, 0.771021485f},
-std::array<float,2>{0.669702351f, 0.219861642f},
-std::array<float,2>{0.119371861f, 0.620465577f},
-std::array<float,2>{0.299316138f, 0.185995638f},
-std::array<float,2>{0.904050291f, 0.531515479f},
-std::array<float,2>{0.610017061f, 0.415064186f},
-std::array<float,2>{0.221859321f, 0.834611416f},
-std::array<float,2>{0.042148456f, 0.359484494f},
-std::array<float,2>{0.743122756f, 0.992703021f},
-std::array<float,2>{0.793046653f, 0.0703726783f},
-std::array<float,2>{0.425940424f, 0.625653446f},
-std::array<float,2>{0.186822057f, 0.228474617f},
-std::array<float,2>{0.52686888f, 0.614051819f},
-std::array<float,2>{0.972510576f, 0.466284961f},
-std::array<float,2>{0.373789012f, 0.773877144f},
-std::array<float,2>{0.489225328f, 0.307033151f},
-std::array<float,2>{0.845835447f, 0.887378097f},
-std::array<float,2>{0.640190363f, 0.0609534644f},
-std::array<float,2>{0.0691338181f, 0.735825777f},
-std::array<float,2>{0.272922277f, 0.0672911406f},
-std::array<float,2>{0.91224283f, 0.636728525f},
-std::array<float,2>{0.565891564f, 0.372866541f},
-std::array<float,2>{0.191932619f, 0.987056017f},
-std::array<float,2>{0.0153482119f, 0.408647686f},
-std::array<float,2>{0.698438823f, 0.836271107f},
-std::array<float,2>{0.781031489f, 0.179666772f},
-std::array<float,2>{0.392468452f, 0.546449423f},
-std::array<float,2>{0.112522431f, 0.000927296118f},
-std::array<float,2>{0.658225715f, 0.696525812f},
-std::array<float,2>{0.818908095f, 0.261773527f},
-std::array<float,2>{0.447368294f, 0.924105167f},
-std::array<float,2>{0.323753685f, 0.480048001f},
-std::array<float,2>{0.963218927f, 0.786782622f},
-std::array<float,2>{0.554149032f, 0.200676113f},
-std::array<float,2>{0.132248253f, 0.592865348f},
-std::array<float,2>{0.435191065f, 0.140530631f},
-std::array<float,2>{0.784417212f, 0.52901566f},
-std::array<float,2>{0.740731478f, 0.376774192f},
-std::array<float,2>{0.0319820791f, 0.844690084f},
-std::array<float,2>{0.233040929f, 0.33540225f},
-std::array<float,2>{0.620503426f, 0.964948356f},
-std::array<float,2>{0.892863929f, 0.102448836f},
-std::array<float,2>{0.305636764f, 0.664315164f},
-std::array<float,2>{0.0555823594f, 0.169536799f},
-std::array<float,2>{0.726758301f, 0.554402351f},
-std::array<float,2>{0.796931744f, 0.42396757f},
-std::array<float,2>{0.420864463f, 0.820052147f},
-std::array<float,2>{0.290766567f, 0.349840701f},
-std::array<float,2>{0.886598766f, 0.971896887f},
-std::array<float,2>{0.597703516f, 0.0861722156f},
-std::array<float,2>{0.244454369f, 0.652714849f},
-std::array<float,2>{0.468705475f, 0.0439676531f},
-std::array<float,2>{0.842199206f, 0.727236331f},
-std::array<float,2>{0.684968472f, 0.281915784f},
-std::array<float,2>{0.103246279f, 0.897822857f},
-std::array<float,2>{0.155965582f, 0.437679678f},
-std::array<float,2>{0.536303639f, 0.756195784f},
-std::array<float,2>{0.947974801f, 0.248619214f},
-std::array<float,2>{0.338862926f, 0.605668128f},
-std::array<float,2>{0.21109806f, 0.122391947f},
-std::array<float,2>{0.593610704f, 0.683761418f},
-std::array<float,2>{0.937002599f, 0.320363134f},
-std::array<float,2>{0.261271268f, 0.951754451f},
-std::array<float,2>{0.375841528f, 0.395681351f},
-std::array<float,2>{0.75570339f, 0.860921562f},
-std::array<float,2>{0.705553889f, 0.151430562f},
-std::array<float,2>{0.0275340769f, 0.504043996f},
-std::array<float,2>{0.354559302f, 0.212021023f},
-std::array<float,2>{0.99915415f, 0.575600088f},
-std::array<float,2>{0.504063606f, 0.490239233f},
-std::array<float,2>{0.164930761f, 0.805392981f},
-std::array<float,2>{0.092564702f, 0.275593877f},
-std::array<float,2>{0.6531021f, 0.918526173f},
-std::array<float,2>{0.87168467f, 0.0177638587f},
-std::array<float,2>{0.48387146f, 0.713297427f},
-std::array<float,2>{0.15755026f, 0.136641696f},
-std::array<float,2>{0.510757089f, 0.52695924f},
-std::array<float,2>{0.988968849f, 0.380398363f},
-std::array<float,2>{0.347952813f, 0.848674953f},
-std::array<float,2>{0.470464438f, 0.331729472f},
-std::array<float,2>{0.86678648f, 0.964351118f},
-std::array<float,2>{0.645754278f, 0.106623836f},
-std::array<float,2>{0.0848628357f, 0.671606958f},
-std::array<float,2>{0.250179261f, 0.00618442381f},
-std::array<float,2>{0.92963624f, 0.702000797f},
-std::array<float,2>{0.581863701f, 0.258827746f},
-std::array<float,2>{0.209398985f, 0.926376581f},
-std::array<float,2>{0.0187359303f, 0.482236117f},
-std::array<float,2>{0.7139377f, 0.781652331f},
-std::array<float,2>{0.759402871f, 0.198827878f},
-std::array<float,2>{0.385893881f, 0.58852613f},
-std::array<float,2>{0.0958589762f, 0.0660123229f},
-std::array<float,2>{0.675484836f, 0.636527359f},
-std::array<float,2>{0.835149586f, 0.368174672f},
-std::array<float,2>{0.454792857f, 0.989377618f},
-std::array<float,2>{0.335187316f, 0.411097229f},
-std::array<float,2>{0.937675774f, 0.841096818f},
-std::array<float,2>{0.54635644f, 0.173004866f},
-std::array<float,2>{0.141023219f, 0.539845467f},
-std::array<float,2>{0.412404954f, 0.233498335f},
-std::array<float,2>{0.808147311f, 0.612189054f},
-std::array<float,2>{0.726559222f, 0.462573647f},
-std::array<float,2>{0.048604928f, 0.780519605f},
-std::array<float,2>{0.24080433f, 0.310117334f},
-std::array<float,2>{0.601641417f, 0.883956134f},
-std::array<float,2>{0.877144992f, 0.0565174967f},
-std::array<float,2>{0.284938425f, 0.739700139f},
-std::array<float,2>{0.0433027074f, 0.216850609f},
-std::array<float,2>{0.74905473f, 0.571605504f},
-std::array<float,2>{0.79185605f, 0.487068266f},
-std::array<float,2>{0.424376011f, 0.809138715f},
-std::array<float,2>{0.301259756f, 0.280485332f},
-std::array<float,2>{0.90161401f, 0.915788889f},
-std::array<float,2>{0.617053807f, 0.0221285783f},
-std::array<float,2>{0.224800855f, 0.715329945f},
-std::array<float,2>{0.438580334f, 0.119186155f},
-std::array<float,2>{0.826164961f, 0.681512535f},
-std::array<float,2>{0.666744888f, 0.325392902f},
-std::array<float,2>{0.122611828f, 0.94914335f},
-std::array<float,2>{0.140103847f, 0.392246246f},
-std::array<float,2>{0.562079012f, 0.866506219f},
-std::array<float,2>{0.954029799f, 0.153755248f},
-std::array<float,2>{0.313023001f, 0.502742589f},
-std::array<float,2>{0.198058009f, 0.0392781049f},
-std::array<float,2>{0.57638061f, 0.731913388f},
-std::array<float,2>{0.920221567f, 0.287367195f},
-std::array<float,2>{0.278744847f, 0.891855776f},
-std::array<float,2>{0.401160747f, 0.441692472f},
-std::array<float,2>{0.765700579f, 0.753081083f},
-std::array<float,2>{0.694863379f, 0.244038045f},
-std::array<float,2>{0.00679270411f, 0.603431463f},
-std::array<float,2>{0.363084406f, 0.165544182f},
-std::array<float,2>{0.982653677f, 0.550345957f},
-std::array<float,2>{0.520933032f, 0.4270235f},
-std::array<float,2>{0.177632555f, 0.815559506f},
-std::array<float,2>{0.0757129043f, 0.34384802f},
-std::array<float,2>{0.632231116f, 0.973981082f},
-std::array<float,2>{0.855462611f, 0.093541339f},
-std::array<float,2>{0.498074144f, 0.651171267f},
-std::array<float,2>{0.226672456f, 0.242062286f},
-std::array<float,2>{0.622519791f, 0.59701705f},
-std::array<float,2>{0.895458043f, 0.447003096f},
-std::array<float,2>{0.310166001f, 0.760399759f},
-std::array<float,2>{0.431237787f, 0.289542168f},
-std::array<float,2>{0.78731823f, 0.900686324f},
-std::array<float,2>{0.73717171f, 0.037072137f},
-std::array<float,2>{0.0353467576f, 0.719328344f},
-std::array<float,2>{0.327435136f, 0.083666347f},
-std::array<float,2>{0.968301177f, 0.643507838f},
-std::array<float,2>{0.549303651f, 0.359178275f},
-std::array<float,2>{0.128298268f, 0.977742612f},
-std::array<float,2>{0.114938945f, 0.436297625f},
-std::array<float,2>{0.662759304f, 0.826893449f},
-std::array<float,2>{0.812862694f, 0.157521784f},
-std::array<float,2>{0.450212777f, 0.558759451f},
-std::array<float,2>{0.010938826f, 0.0255081281f},
-std::array<float,2>{0.699479818f, 0.705554128f},
-std::array<float,2>{0.774145603f, 0.271790504f},
-std::array<float,2>{0.395083904f, 0.908722639f},
-std::array<float,2>{0.265911371f, 0.498014271f},
-std::array<float,2>{0.908862293f, 0.804466248f},
-std::array<float,2>{0.569869995f, 0.206405222f},
-std::array<float,2>{0.189124763f, 0.567128837f},
-std::array<float,2>{0.488139302f, 0.142312735f},
-std::array<float,2>{0.850358903f, 0.515162051f},
-std::array<float,2>{0.633432269f, 0.404816359f},
-std::array<float,2>{0.0659647286f, 0.872044206f},
-std::array<float,2>{0.182043225f, 0.316272825f},
-std::array<float,2>{0.528199077f, 0.942887604f},
-std::array<float,2>{0.976508141f, 0.109609447f},
-std::array<float,2>{0.367686063f, 0.673559487f},
-std::array<float,2>{0.0888320357f, 0.182282344f},
-std::array<float,2>{0.650493383f, 0.536212623f},
-std::array<float,2>{0.869827271f, 0.418011934f},
-std::array<float,2>{0.477074862f, 0.831565797f},
-std::array<float,2>{0.356050611f, 0.366457433f},
-std::array<float,2>{0.994851232f, 0.996234894f},
-std::array<float,2>{0.502613366f, 0.0745459199f},
-std::array<float,2>{0.168570548f, 0.629006505f},
-std::array<float,2>{0.381797433f, 0.0488562398f},
-std::array<float,2>{0.753765762f, 0.747173488f},
-std::array<float,2>{0.7107023f, 0.303656071f},
-std::array<float,2>{0.026229294f, 0.875326872f},
-std::array<float,2>{0.21819742f, 0.459012479f},
-std::array<float,2>{0.589069366f, 0.768713355f},
-std::array<float,2>{0.93282038f, 0.226343364f},
-std::array<float,2>{0.264557898f, 0.624779284f},
-std::array<float,2>{0.151502132f, 0.0961597785f},
-std::array<float,2>{0.532670498f, 0.658064127f},
-std::array<float,2>{0.951818645f, 0.34274891f},
-std::array<float,2>{0.340461075f, 0.956656992f},
-std::array<float,2>{0.46233356f, 0.384296328f},
-std::array<float,2>{0.83896172f, 0.85419482f},
-std::array<float,2>{0.682504475f, 0.125041559f},
-std::array<float,2>{0.108326845f, 0.521843493f},
-std::array<float,2>{0.295637578f, 0.188877285f},
-std::array<float,2>{0.888719916f, 0.583571792f},
-std::array<float,2>{0.597395957f, 0.47398147f},
-std::array<float,2>{0.246868834f, 0.79343152f},
-std::array<float,2>{0.0601066127f, 0.257510662f},
-std::array<float,2>{0.730904102f, 0.930812001f},
-std::array<float,2>{0.804375947f, 0.0100063179f},
-std::array<float,2>{0.41620034f, 0.694533229f},
-std::array<float,2>{0.204845965f, 0.162329257f},
-std::array<float,2>{0.582739234f, 0.555826187f},
-std::array<float,2>{0.925693214f, 0.429902285f},
-std::array<float,2>{0.255417764f, 0.821238697f},
-std::array<float,2>{0.387316465f, 0.35163942f},
-std::array<float,2>{0.763180733f, 0.983269691f},
-std::array<float,2>{0.716717958f, 0.0798078328f},
-std::array<float,2>{0.0207894221f, 0.644556403f},
-std::array<float,2>{0.345523864f, 0.0344642587f},
-std::array<float,2>{0.985665202f, 0.724654377f},
-std::array<float,2>{0.511781156f, 0.296506286f},
-std::array<float,2>{0.161556095f, 0.902767301f},
-std::array<float,2>{0.0784472972f, 0.450427175f},
-std::array<float,2>{0.642108679f, 0.762882471f},
-std::array<float,2>{0.863045096f, 0.237055093f},
-std::array<float,2>{0.473878086f, 0.598583341f},
-std::array<float,2>{0.0526247583f, 0.113353424f},
-std::array<float,2>{0.71943295f, 0.676705897f},
-std::array<float,2>{0.809111953f, 0.31959644f},
-std::array<float,2>{0.409578234f, 0.938836932f},
-std::array<float,2>{0.28782776f, 0.398992598f},
-std::array<float,2>{0.882297277f, 0.869529665f},
-std::array<float,2>{0.608935118f, 0.145197555f},
-std::array<float,2>{0.235579595f, 0.510996997f},
-std::array<float,2>{0.458534122f, 0.210752159f},
-std::array<float,2>{0.831021726f, 0.565342009f},
-std::array<float,2>{0.676967978f, 0.492363483f},
-std::array<float,2>{0.0987816676f, 0.797663748f},
-std::array<float,2>{0.147138461f, 0.267573416f},
-std::array<float,2>{0.541811049f, 0.91315639f},
-std::array<float,2>{0.944736779f, 0.0290372856f},
-std::array<float,2>{0.331205428f, 0.709217548f},
-std::array<float,2>{0.117635794f, 0.220713973f},
-std::array<float,2>{0.670819283f, 0.617216468f},
-std::array<float,2>{0.820324898f, 0.454881191f},
-std::array<float,2>{0.441839069f, 0.773366034f},
-std::array<float,2>{0.318944871f, 0.298120558f},
-std::array<float,2>{0.957648575f, 0.882442474f},
-std::array<float,2>{0.558097899f, 0.0539184511f},
-std::array<float,2>{0.13509196f, 0.744277835f},
-std::array<float,2>{0.428461969f, 0.0728102922f},
-std::array<float,2>{0.796821654f, 0.628579021f},
-std::array<float,2>{0.745123863f, 0.36232397f},
-std::array<float,2>{0.0395570472f, 0.996076286f},
-std::array<float,2>{0.219141632f, 0.416392833f},
-std::array<float,2>{0.612308919f, 0.833053887f},
-std::array<float,2>{0.906216264f, 0.183637917f},
-std::array<float,2>{0.298286945f, 0.53405261f},
-std::array<float,2>{0.173452154f, 0.0119137177f},
-std::array<float,2>{0.519296288f, 0.69123435f},
-std::array<float,2>{0.977084458f, 0.251290739f},
-std::array<float,2>{0.365102351f, 0.935937643f},
-std::array<float,2>{0.495898515f, 0.470709443f},
-std::array<float,2>{0.858037114f, 0.791928828f},
-std::array<float,2>{0.628316462f, 0.191899091f},
-std::array<float,2>{0.0732758343f, 0.581946194f},
-std::array<float,2>{0.275308192f, 0.129615277f},
-std::array<float,2>{0.916131616f, 0.519522905f},
-std::array<float,2>{0.570325792f, 0.389185995f},
-std::array<float,2>{0.202685073f, 0.858123958f},
-std::array<float,2>{0.000963716826f, 0.337921143f},
-std::array<float,2>{0.690595388f, 0.958355606f},
-std::array<float,2>{0.769745886f, 0.0996201262f},
-std::array<float,2>{0.403994322f, 0.660436749f},
-std::array<float,2>{0.130262062f, 0.201982051f},
-std::array<float,2>{0.550853372f, 0.591458201f},
-std::array<float,2>{0.961145639f, 0.4775922f},
-std::array<float,2>{0.321053356f, 0.788686514f},
-std::array<float,2>{0.447002858f, 0.265170693f},
-std::array<float,2>{0.818230867f, 0.921964049f},
-std::array<float,2>{0.657457113f, 0.00253409939f},
-std::array<float,2>{0.110516526f, 0.698455274f},
-std::array<float,2>{0.307871997f, 0.103704825f},
-std::array<float,2>{0.891341925f, 0.66740042f},
-std::array<float,2>{0.617891312f, 0.333846211f},
-std::array<float,2>{0.232017487f, 0.967256188f},
-std::array<float,2>{0.0339850411f, 0.378462434f},
-std::array<float,2>{0.739125669f, 0.846541941f},
-std::array<float,2>{0.783131063f, 0.138171718f},
-std::array<float,2>{0.435800314f, 0.529445827f},
-std::array<float,2>{0.0674778447f, 0.0603243038f},
-std::array<float,2>{0.636960685f, 0.736679912f},
-std::array<float,2>{0.843932629f, 0.305381417f},
-std::array<float,2>{0.491547734f, 0.889797747f},
-std::array<float,2>{0.371913314f, 0.468134433f},
-std::array<float,2>{0.969417632f, 0.776037693f},
-std::array<float,2>{0.525074661f, 0.230175108f},
-std::array<float,2>{0.185283214f, 0.615409791f},
-std::array<float,2>{0.393662393f, 0.17765063f},
-std::array<float,2>{0.777813673f, 0.543865561f},
-std::array<float,2>{0.696894944f, 0.407602191f},
-std::array<float,2>{0.0123461755f, 0.837917507f},
-std::array<float,2>{0.193718195f, 0.374604225f},
-std::array<float,2>{0.563242733f, 0.985931873f},
-std::array<float,2>{0.91068989f, 0.069067575f},
-std::array<float,2>{0.270720184f, 0.639827549f},
-std::array<float,2>{0.0306190643f, 0.14970082f},
-std::array<float,2>{0.70319438f, 0.506026804f},
-std::array<float,2>{0.756420255f, 0.39816004f},
-std::array<float,2>{0.378605038f, 0.862640023f},
-std::array<float,2>{0.259469539f, 0.323208958f},
-std::array<float,2>{0.934786499f, 0.950410545f},
-std::array<float,2>{0.59089154f, 0.124091305f},
-std::array<float,2>{0.212970525f, 0.686480761f},
-std::array<float,2>{0.481824815f, 0.0171857793f},
-std::array<float,2>{0.874190032f, 0.712224305f},
-std::array<float,2>{0.655495226f, 0.275093466f},
-std::array<float,2>{0.090371199f, 0.920874655f},
-std::array<float,2>{0.167178318f, 0.488851309f},
-std::array<float,2>{0.50666517f, 0.80826807f},
-std::array<float,2>{0.996633768f, 0.214283571f},
-std::array<float,2>{0.351588875f, 0.577039957f},
-std::array<float,2>{0.243223548f, 0.0893665701f},
-std::array<float,2>{0.600329757f, 0.655261099f},
-std::array<float,2>{0.883266211f, 0.34773767f},
-std::array<float,2>{0.291101784f, 0.97052449f},
-std::array<float,2>{0.41812247f, 0.421901077f},
-std::array<float,2>{0.799449265f, 0.81826514f},
-std::array<float,2>{0.728881061f, 0.171028167f},
-std::array<float,2>{0.0568863228f, 0.551505685f},
-std::array<float,2>{0.337748736f, 0.246981576f},
-std::array<float,2>{0.946502507f, 0.607884467f},
-std::array<float,2>{0.537289381f, 0.439675152f},
-std::array<float,2>{0.152847528f, 0.754312575f},
-std::array<float,2>{0.105388187f, 0.283669204f},
-std::array<float,2>{0.687211573f, 0.896204114f},
-std::array<float,2>{0.841647387f, 0.0459793583f},
-std::array<float,2>{0.464981675f, 0.729536295f},
-std::array<float,2>{0.131670177f, 0.13783288f},
-std::array<float,2>{0.553564966f, 0.529718697f},
-std::array<float,2>{0.964133322f, 0.378748834f},
-std::array<float,2>{0.32255125f, 0.846320987f},
-std::array<float,2>{0.448675454f, 0.333705544f},
-std::array<float,2>{0.82028687f, 0.966832101f},
-std::array<float,2>{0.659471989f, 0.103928037f},
-std::array<float,2>{0.111494668f, 0.667112947f},
-std::array<float,2>{0.305785626f, 0.00281270384f},
-std::array<float,2>{0.894262671f, 0.698726654f},
-std::array<float,2>{0.619175136f, 0.265476972f},
-std::array<float,2>{0.234096199f, 0.922128737f},
-std::array<float,2>{0.0322441943f, 0.477994502f},
-std::array<float,2>{0.741399169f, 0.789060175f},
-std::array<float,2>{0.783992648f, 0.201717794f},
-std::array<float,2>{0.434077621f, 0.591718137f},
-std::array<float,2>{0.0702630058f, 0.0691091195f},
-std::array<float,2>{0.639029622f, 0.639919281f},
-std::array<float,2>{0.847171962f, 0.374855399f},
-std::array<float,2>{0.489432216f, 0.98626256f},
-std::array<float,2>{0.374936104f, 0.407384276f},
-std::array<float,2>{0.971442521f, 0.838261962f},
-std::array<float,2>{0.525763273f, 0.177343696f},
-std::array<float,2>{0.185559481f, 0.543545485f},
-std::array<float,2>{0.390902311f, 0.230370402f},
-std::array<float,2>{0.77965641f, 0.615543306f},
-std::array<float,2>{0.69732517f, 0.467774868f},
-std::array<float,2>{0.0140283639f, 0.776239574f},
-std::array<float,2>{0.192477077f, 0.305484384f},
-std::array<float,2>{0.564490974f, 0.890124142f},
-std::array<float,2>{0.913323283f, 0.06024177f},
-std::array<float,2>{0.272141218f, 0.736543894f},
-std::array<float,2>{0.0290169511f, 0.213937581f},
-std::array<float,2>{0.7063483f, 0.57673651f},
-std::array<float,2>{0.754023075f, 0.489236981f},
-std::array<float,2>{0.376878619f, 0.808433473f},
-std::array<float,2>{0.26058948f, 0.275194257f},
-std::array<float,2>{0.93583256f, 0.920419812f},
-std::array<float,2>{0.592573345f, 0.0175390001f},
-std::array<float,2>{0.212628722f, 0.712086082f},
-std::array<float,2>{0.482594758f, 0.124471828f},
-std::array<float,2>{0.872208595f, 0.686075628f},
-std::array<float,2>{0.654262304f, 0.322915733f},
-std::array<float,2>{0.0930493325f, 0.950613976f},
-std::array<float,2>{0.165661335f, 0.398391724f},
-std::array<float,2>{0.505487323f, 0.862347007f},
-std::array<float,2>{0.998271763f, 0.149525359f},
-std::array<float,2>{0.353747278f, 0.50616318f},
-std::array<float,2>{0.245682403f, 0.0463562533f},
-std::array<float,2>{0.598706484f, 0.729763865f},
-std::array<float,2>{0.885052264f, 0.283375353f},
-std::array<float,2>{0.289765805f, 0.896287322f},
-std::array<float,2>{0.421799779f, 0.439867735f},
-std::array<float,2>{0.798085868f, 0.754047811f},
-std::array<float,2>{0.727557182f, 0.246697322f},
-std::array<float,2>{0.0558912642f, 0.607648492f},
-std::array<float,2>{0.338959128f, 0.171258733f},
-std::array<float,2>{0.94918865f, 0.551726639f},
-std::array<float,2>{0.535775721f, 0.422130376f},
-std::array<float,2>{0.154301614f, 0.817932367f},
-std::array<float,2>{0.101764642f, 0.348012567f},
-std::array<float,2>{0.683638275f, 0.970243394f},
-std::array<float,2>{0.843632042f, 0.0898431167f},
-std::array<float,2>{0.46707356f, 0.654813051f},
-std::array<float,2>{0.205841988f, 0.237207994f},
-std::array<float,2>{0.58588326f, 0.598226368f},
-std::array<float,2>{0.922487676f, 0.450552225f},
-std::array<float,2>{0.256430358f, 0.76300633f},
-std::array<float,2>{0.389256001f, 0.296796173f},
-std::array<float,2>{0.764471948f, 0.902549744f},
-std::array<float,2>{0.718742132f, 0.0343170352f},
-std::array<float,2>{0.0222978089f, 0.725081682f},
-std::array<float,2>{0.347160846f, 0.079901956f},
-std::array<float,2>{0.986647606f, 0.644810796f},
-std::array<float,2>{0.513778925f, 0.351962566f},
-std::array<float,2>{0.163425222f, 0.983132899f},
-std::array<float,2>{0.0812408999f, 0.430062175f},
-std::array<float,2>{0.643913269f, 0.820854962f},
-std::array<float,2>{0.860975444f, 0.162557364f},
-std::array<float,2>{0.475890756f, 0.556012571f},
-std::array<float,2>{0.0542535f, 0.0292930137f},
-std::array<float,2>{0.722176671f, 0.709410787f},
-std::array<float,2>{0.810999274f, 0.267150939f},
-std::array<float,2>{0.406779617f, 0.913545489f},
-std::array<float,2>{0.285722524f, 0.492502153f},
-std::array<float,2>{0.880683184f, 0.797581136f},
-std::array<float,2>{0.607210338f, 0.210475922f},
-std::array<float,2>{0.237934411f, 0.565031886f},
-std::array<float,2>{0.460640371f, 0.145397618f},
-std::array<float,2>{0.829804599f, 0.510907412f},
-std::array<float,2>{0.679667413f, 0.399290323f},
-std::array<float,2>{0.0998004228f, 0.869187176f},
-std::array<float,2>{0.145635113f, 0.319531024f},
-std::array<float,2>{0.539431393f, 0.938658535f},
-std::array<float,2>{0.941683114f, 0.113577306f},
-std::array<float,2>{0.328585178f, 0.676444829f},
-std::array<float,2>{0.120875418f, 0.18386893f},
-std::array<float,2>{0.668175638f, 0.533907712f},
-std::array<float,2>{0.82247901f, 0.41615963f},
-std::array<float,2>{0.44390884f, 0.833318889f},
-std::array<float,2>{0.317579955f, 0.362583727f},
-std::array<float,2>{0.959097326f, 0.995767891f},
-std::array<float,2>{0.555911481f, 0.0731690004f},
-std::array<float,2>{0.133643672f, 0.628671229f},
-std::array<float,2>{0.427031845f, 0.0541139394f},
-std::array<float,2>{0.794900239f, 0.744449019f},
-std::array<float,2>{0.74328804f, 0.298034608f},
-std::array<float,2>{0.0416129641f, 0.88270694f},
-std::array<float,2>{0.220969021f, 0.454614013f},
-std::array<float,2>{0.610621214f, 0.773192823f},
-std::array<float,2>{0.903284132f, 0.22111091f},
-std::array<float,2>{0.299987704f, 0.617517591f},
-std::array<float,2>{0.175152183f, 0.100059621f},
-std::array<float,2>{0.515769303f, 0.660172939f},
-std::array<float,2>{0.97875464f, 0.338190198f},
-std::array<float,2>{0.36557436f, 0.958117008f},
-std::array<float,2>{0.493447959f, 0.389465153f},
-std::array<float,2>{0.85569948f, 0.85833919f},
-std::array<float,2>{0.626642525f, 0.129873306f},
-std::array<float,2>{0.0720373467f, 0.51922667f},
-std::array<float,2>{0.277210832f, 0.192354456f},
-std::array<float,2>{0.915522218f, 0.581704855f},
-std::array<float,2>{0.572451591f, 0.470955163f},
-std::array<float,2>{0.200380296f, 0.791560948f},
-std::array<float,2>{0.00266615534f, 0.251179963f},
-std::array<float,2>{0.68817687f, 0.935556948f},
-std::array<float,2>{0.772932291f, 0.0121889189f},
-std::array<float,2>{0.405899465f, 0.691047251f},
-std::array<float,2>{0.229330629f, 0.157239959f},
-std::array<float,2>{0.62437588f, 0.559041798f},
-std::array<float,2>{0.897037983f, 0.436091751f},
-std::array<float,2>{0.311944515f, 0.826948225f},
-std::array<float,2>{0.431966722f, 0.359003633f},
-std::array<float,2>{0.785967529f, 0.97781086f},
-std::array<float,2>{0.734826803f, 0.0837714821f},
-std::array<float,2>{0.0376298465f, 0.643283308f},
-std::array<float,2>{0.325905353f, 0.0367298014f},
-std::array<float,2>{0.965850055f, 0.719530821f},
-std::array<float,2>{0.54731375f, 0.289062619f},
-std::array<float,2>{0.12570107f, 0.900455356f},
-std::array<float,2>{0.116101265f, 0.447074622f},
-std::array<float,2>{0.660728395f, 0.760543346f},
-std::array<float,2>{0.814575911f, 0.24186112f},
-std::array<float,2>{0.452581316f, 0.596785367f},
-std::array<float,2>{0.00976154488f, 0.109769918f},
-std::array<float,2>{0.702303112f, 0.673623919f},
-std::array<float,2>{0.776884556f, 0.316118389f},
-std::array<float,2>{0.397833228f, 0.943337083f},
-std::array<float,2>{0.267607093f, 0.405067861f},
-std::array<float,2>{0.906508684f, 0.87177515f},
-std::array<float,2>{0.567309499f, 0.14239794f},
-std::array<float,2>{0.189613596f, 0.515413702f},
-std::array<float,2>{0.485567838f, 0.206068039f},
-std::array<float,2>{0.849377155f, 0.567287743f},
-std::array<float,2>{0.635706902f, 0.497701228f},
-std::array<float,2>{0.0630484596f, 0.804239452f},
-std::array<float,2>{0.18043609f, 0.271495312f},
-std::array<float,2>{0.530186713f, 0.909164488f},
-std::array<float,2>{0.974145591f, 0.0257325694f},
-std::array<float,2>{0.369924247f, 0.705141783f},
-std::array<float,2>{0.0869634375f, 0.22627233f},
-std::array<float,2>{0.649744987f, 0.624660552f},
-std::array<float,2>{0.867274225f, 0.459413677f},
-std::array<float,2>{0.479384661f, 0.768898904f},
-std::array<float,2>{0.358515143f, 0.303383201f},
-std::array<float,2>{0.993533075f, 0.875132322f},
-std::array<float,2>{0.500544369f, 0.0491484776f},
-std::array<float,2>{0.170825511f, 0.747470081f},
-std::array<float,2>{0.380161345f, 0.0743862167f},
-std::array<float,2>{0.750179291f, 0.629373133f},
-std::array<float,2>{0.708841622f, 0.366214126f},
-std::array<float,2>{0.0242696367f, 0.996387184f},
-std::array<float,2>{0.216002181f, 0.418399751f},
-std::array<float,2>{0.587501049f, 0.831863701f},
-std::array<float,2>{0.929871738f, 0.182518616f},
-std::array<float,2>{0.262262046f, 0.536496043f},
-std::array<float,2>{0.149685994f, 0.0100199301f},
-std::array<float,2>{0.534520268f, 0.694679677f},
-std::array<float,2>{0.949482083f, 0.2575804f},
-std::array<float,2>{0.342395693f, 0.930976272f},
-std::array<float,2>{0.463419616f, 0.47382468f},
-std::array<float,2>{0.837740302f, 0.793051124f},
-std::array<float,2>{0.681544185f, 0.188690841f},
-std::array<float,2>{0.106131673f, 0.583741307f},
-std::array<float,2>{0.294386446f, 0.125421539f},
-std::array<float,2>{0.887021005f, 0.521603465f},
-std::array<float,2>{0.595562994f, 0.384651423f},
-std::array<float,2>{0.248454675f, 0.854473352f},
-std::array<float,2>{0.0623636991f, 0.342404485f},
-std::array<float,2>{0.732582629f, 0.95701474f},
-std::array<float,2>{0.801927149f, 0.0958024263f},
-std::array<float,2>{0.414323539f, 0.657767951f},
-std::array<float,2>{0.159763098f, 0.199039742f},
-std::array<float,2>{0.508710146f, 0.588714302f},
-std::array<float,2>{0.990247428f, 0.482002944f},
-std::array<float,2>{0.35069117f, 0.781263471f},
-std::array<float,2>{0.471658319f, 0.259245902f},
-std::array<float,2>{0.864046216f, 0.926531732f},
-std::array<float,2>{0.647338867f, 0.00585993519f},
-std::array<float,2>{0.083129257f, 0.701684594f},
-std::array<float,2>{0.253271282f, 0.106885657f},
-std::array<float,2>{0.926404357f, 0.671683788f},
-std::array<float,2>{0.579749644f, 0.332029819f},
-std::array<float,2>{0.207699671f, 0.964084446f},
-std::array<float,2>{0.0175076611f, 0.380754322f},
-std::array<float,2>{0.712833941f, 0.848946691f},
-std::array<float,2>{0.76018399f, 0.136337996f},
-std::array<float,2>{0.383456975f, 0.527207077f},
-std::array<float,2>{0.0943619907f, 0.0562109724f},
-std::array<float,2>{0.673041701f, 0.739474356f},
-std::array<float,2>{0.833090782f, 0.310327679f},
-std::array<float,2>{0.45577231f, 0.884274602f},
-std::array<float,2>{0.333714545f, 0.462839901f},
-std::array<float,2>{0.940884173f, 0.780361414f},
-std::array<float,2>{0.544063926f, 0.233646601f},
-std::array<float,2>{0.142718568f, 0.611892402f},
-std::array<float,2>{0.411470234f, 0.173236921f},
-std::array<float,2>{0.805746794f, 0.539608657f},
-std::array<float,2>{0.723496318f, 0.410862505f},
-std::array<float,2>{0.0502658151f, 0.840902627f},
-std::array<float,2>{0.239985123f, 0.368632883f},
-std::array<float,2>{0.605415523f, 0.989609838f},
-std::array<float,2>{0.875656545f, 0.0663634986f},
-std::array<float,2>{0.281691402f, 0.636322975f},
-std::array<float,2>{0.0456126481f, 0.153446108f},
-std::array<float,2>{0.746812582f, 0.502481639f},
-std::array<float,2>{0.789341092f, 0.392415643f},
-std::array<float,2>{0.423357904f, 0.866266668f},
-std::array<float,2>{0.302797645f, 0.325504929f},
-std::array<float,2>{0.899326921f, 0.948856771f},
-std::array<float,2>{0.614786386f, 0.119569302f},
-std::array<float,2>{0.22403115f, 0.681183279f},
-std::array<float,2>{0.440725297f, 0.0223223418f},
-std::array<float,2>{0.827624679f, 0.715087593f},
-std::array<float,2>{0.664789498f, 0.280758172f},
-std::array<float,2>{0.123101249f, 0.915766895f},
-std::array<float,2>{0.137855411f, 0.487020463f},
-std::array<float,2>{0.560262918f, 0.809343815f},
-std::array<float,2>{0.955210805f, 0.217228591f},
-std::array<float,2>{0.314876735f, 0.571325362f},
-std::array<float,2>{0.195582166f, 0.0934788287f},
-std::array<float,2>{0.574915171f, 0.651105881f},
-std::array<float,2>{0.918990791f, 0.34410429f},
-std::array<float,2>{0.279483616f, 0.97374481f},
-std::array<float,2>{0.39859131f, 0.426766872f},
-std::array<float,2>{0.767870903f, 0.815832913f},
-std::array<float,2>{0.691839337f, 0.165901601f},
-std::array<float,2>{0.00393437408f, 0.550557673f},
-std::array<float,2>{0.360047668f, 0.243696466f},
-std::array<float,2>{0.98157537f, 0.603130817f},
-std::array<float,2>{0.521713674f, 0.44159776f},
-std::array<float,2>{0.17866835f, 0.753342509f},
-std::array<float,2>{0.0779338479f, 0.287352502f},
-std::array<float,2>{0.630818665f, 0.891833723f},
-std::array<float,2>{0.852449179f, 0.0394501388f},
-std::array<float,2>{0.497142404f, 0.731481433f},
-std::array<float,2>{0.184021518f, 0.179386958f},
-std::array<float,2>{0.52355504f, 0.546826124f},
-std::array<float,2>{0.970063686f, 0.408207685f},
-std::array<float,2>{0.372761667f, 0.836172998f},
-std::array<float,2>{0.490991354f, 0.37278685f},
-std::array<float,2>{0.845498621f, 0.987177789f},
-std::array<float,2>{0.638522804f, 0.0671129376f},
-std::array<float,2>{0.0670290515f, 0.637133658f},
-std::array<float,2>{0.26980722f, 0.0606444217f},
-std::array<float,2>{0.911765933f, 0.735463798f},
-std::array<float,2>{0.563826144f, 0.306655526f},
-std::array<float,2>{0.195064679f, 0.887692332f},
-std::array<float,2>{0.0127564073f, 0.466053843f},
-std::array<float,2>{0.695385337f, 0.773583889f},
-std::array<float,2>{0.778764367f, 0.228046268f},
-std::array<float,2>{0.392598003f, 0.613948882f},
-std::array<float,2>{0.110077761f, 0.102286093f},
-std::array<float,2>{0.656777084f, 0.664212644f},
-std::array<float,2>{0.816684544f, 0.335003704f},
-std::array<float,2>{0.446266353f, 0.965268552f},
-std::array<float,2>{0.322054356f, 0.376576841f},
-std::array<float,2>{0.96252048f, 0.844407141f},
-std::array<float,2>{0.552357793f, 0.140340954f},
-std::array<float,2>{0.129203632f, 0.529255509f},
-std::array<float,2>{0.436629325f, 0.20027113f},
-std::array<float,2>{0.782219827f, 0.593094826f},
-std::array<float,2>{0.739559293f, 0.480446577f},
-std::array<float,2>{0.0347190537f, 0.787047505f},
-std::array<float,2>{0.231286988f, 0.262016296f},
-std::array<float,2>{0.618604958f, 0.923975706f},
-std::array<float,2>{0.891955853f, 0.000719456759f},
-std::array<float,2>{0.30737114f, 0.696682453f},
-std::array<float,2>{0.0582943708f, 0.248818398f},
-std::array<float,2>{0.729657352f, 0.605834901f},
-std::array<float,2>{0.800122797f, 0.437966585f},
-std::array<float,2>{0.419006497f, 0.756023526f},
-std::array<float,2>{0.292175025f, 0.282145977f},
-std::array<float,2>{0.884128034f, 0.897691131f},
-std::array<float,2>{0.601488769f, 0.0443848073f},
-std::array<float,2>{0.242208019f, 0.72749728f},
-std::array<float,2>{0.466056287f, 0.0863675997f},
-std::array<float,2>{0.840608954f, 0.65251416f},
-std::array<float,2>{0.686454773f, 0.349860549f},
-std::array<float,2>{0.103844769f, 0.97195977f},
-std::array<float,2>{0.154009014f, 0.424282968f},
-std::array<float,2>{0.538095832f, 0.820138514f},
-std::array<float,2>{0.94576782f, 0.169900149f},
-std::array<float,2>{0.336707622f, 0.554504216f},
-std::array<float,2>{0.214628622f, 0.0178426672f},
-std::array<float,2>{0.590065598f, 0.713134229f},
-std::array<float,2>{0.934145629f, 0.275695205f},
-std::array<float,2>{0.258543044f, 0.918732762f},
-std::array<float,2>{0.377577156f, 0.49062413f},
-std::array<float,2>{0.757471919f, 0.805598497f},
-std::array<float,2>{0.704758883f, 0.212355211f},
-std::array<float,2>{0.030102592f, 0.575357556f},
-std::array<float,2>{0.353506684f, 0.151819348f},
-std::array<float,2>{0.997760475f, 0.504355729f},
-std::array<float,2>{0.507443368f, 0.395766914f},
-std::array<float,2>{0.166566387f, 0.861232936f},
-std::array<float,2>{0.0914727598f, 0.320635289f},
-std::array<float,2>{0.65508014f, 0.951986074f},
-std::array<float,2>{0.873506486f, 0.122144632f},
-std::array<float,2>{0.481208116f, 0.684042871f},
-std::array<float,2>{0.234721288f, 0.208770856f},
-std::array<float,2>{0.608099341f, 0.563757181f},
-std::array<float,2>{0.880992055f, 0.495793015f},
-std::array<float,2>{0.288518161f, 0.800107896f},
-std::array<float,2>{0.408680916f, 0.268326819f},
-std::array<float,2>{0.810513198f, 0.91030699f},
-std::array<float,2>{0.720348179f, 0.0302783716f},
-std::array<float,2>{0.0508295745f, 0.707776129f},
-std::array<float,2>{0.33094269f, 0.116638675f},
-std::array<float,2>{0.943846583f, 0.678121865f},
-std::array<float,2>{0.542076647f, 0.317191988f},
-std::array<float,2>{0.147727579f, 0.940522969f},
-std::array<float,2>{0.0977251753f, 0.401252955f},
-std::array<float,2>{0.675888896f, 0.868781507f},
-std::array<float,2>{0.831513643f, 0.147639811f},
-std::array<float,2>{0.457371861f, 0.508215785f},
-std::array<float,2>{0.0204240028f, 0.032621596f},
-std::array<float,2>{0.715328336f, 0.722713947f},
-std::array<float,2>{0.762219727f, 0.293401957f},
-std::array<float,2>{0.388243854f, 0.905606389f},
-std::array<float,2>{0.254253685f, 0.452420026f},
-std::array<float,2>{0.924276948f, 0.76466608f},
-std::array<float,2>{0.583015501f, 0.235257626f},
-std::array<float,2>{0.203595668f, 0.59961468f},
-std::array<float,2>{0.472829849f, 0.16073516f},
-std::array<float,2>{0.861608148f, 0.558333278f},
-std::array<float,2>{0.641181946f, 0.432743132f},
-std::array<float,2>{0.0794981942f, 0.822972059f},
-std::array<float,2>{0.160582781f, 0.354675412f},
-std::array<float,2>{0.513409972f, 0.981129646f},
-std::array<float,2>{0.985272169f, 0.0803086832f},
-std::array<float,2>{0.344489157f, 0.648061693f},
-std::array<float,2>{0.0731292218f, 0.131383047f},
-std::array<float,2>{0.627916396f, 0.516479969f},
-std::array<float,2>{0.85846442f, 0.388204724f},
-std::array<float,2>{0.494953662f, 0.857272327f},
-std::array<float,2>{0.363841891f, 0.337102801f},
-std::array<float,2>{0.978244007f, 0.960579872f},
-std::array<float,2>{0.518451691f, 0.0986077115f},
-std::array<float,2>{0.171952337f, 0.663603485f},
-std::array<float,2>{0.403267413f, 0.0150712738f},
-std::array<float,2>{0.77061981f, 0.68756336f},
-std::array<float,2>{0.690409124f, 0.253382266f},
-std::array<float,2>{0.00137786672f, 0.933996379f},
-std::array<float,2>{0.201412439f, 0.470477939f},
-std::array<float,2>{0.571579278f, 0.789852619f},
-std::array<float,2>{0.91738534f, 0.193928137f},
-std::array<float,2>{0.273700714f, 0.57976526f},
-std::array<float,2>{0.136510119f, 0.0706273913f},
-std::array<float,2>{0.556901753f, 0.625952303f},
-std::array<float,2>{0.958756804f, 0.359777659f},
-std::array<float,2>{0.319912374f, 0.993026733f},
-std::array<float,2>{0.443256378f, 0.415329814f},
-std::array<float,2>{0.82218647f, 0.834785759f},
-std::array<float,2>{0.671522856f, 0.185748875f},
-std::array<float,2>{0.119138792f, 0.531410098f},
-std::array<float,2>{0.297296733f, 0.220142514f},
-std::array<float,2>{0.905089617f, 0.620274246f},
-std::array<float,2>{0.611788809f, 0.455582321f},
-std::array<float,2>{0.220319524f, 0.771479487f},
-std::array<float,2>{0.0407881625f, 0.300261945f},
-std::array<float,2>{0.7448861f, 0.880220413f},
-std::array<float,2>{0.795044661f, 0.0515506789f},
-std::array<float,2>{0.42947796f, 0.743091226f},
-std::array<float,2>{0.187953547f, 0.142665207f},
-std::array<float,2>{0.568623543f, 0.513470054f},
-std::array<float,2>{0.910086513f, 0.403266072f},
-std::array<float,2>{0.266994327f, 0.874940932f},
-std::array<float,2>{0.396390408f, 0.314166009f},
-std::array<float,2>{0.77476573f, 0.944552183f},
-std::array<float,2>{0.700371027f, 0.111899972f},
-std::array<float,2>{0.0099669965f, 0.675588608f},
-std::array<float,2>{0.368197054f, 0.0237002689f},
-std::array<float,2>{0.974653423f, 0.703631938f},
-std::array<float,2>{0.528360724f, 0.271051586f},
-std::array<float,2>{0.183549047f, 0.907155573f},
-std::array<float,2>{0.0649431273f, 0.499906212f},
-std::array<float,2>{0.634108961f, 0.802476048f},
-std::array<float,2>{0.851319313f, 0.203894719f},
-std::array<float,2>{0.486884564f, 0.569470823f},
-std::array<float,2>{0.0366542079f, 0.0840049088f},
-std::array<float,2>{0.738205433f, 0.641996086f},
-std::array<float,2>{0.788768947f, 0.355911046f},
-std::array<float,2>{0.429797202f, 0.979645669f},
-std::array<float,2>{0.308893561f, 0.434577197f},
-std::array<float,2>{0.896110594f, 0.824272335f},
-std::array<float,2>{0.621877611f, 0.158444569f},
-std::array<float,2>{0.227691278f, 0.56199944f},
-std::array<float,2>{0.449434131f, 0.239960745f},
-std::array<float,2>{0.814437091f, 0.59399116f},
-std::array<float,2>{0.663668096f, 0.449031591f},
-std::array<float,2>{0.113818236f, 0.758958459f},
-std::array<float,2>{0.127512202f, 0.29269588f},
-std::array<float,2>{0.550728559f, 0.899023235f},
-std::array<float,2>{0.967523634f, 0.0377729461f},
-std::array<float,2>{0.32623297f, 0.721824765f},
-std::array<float,2>{0.108746834f, 0.191213548f},
-std::array<float,2>{0.68332231f, 0.584090292f},
-std::array<float,2>{0.83859396f, 0.475811273f},
-std::array<float,2>{0.461339235f, 0.796517849f},
-std::array<float,2>{0.341279715f, 0.254185021f},
-std::array<float,2>{0.952390611f, 0.93169111f},
-std::array<float,2>{0.531800449f, 0.00788069237f},
-std::array<float,2>{0.151112616f, 0.692784727f},
-std::array<float,2>{0.417441159f, 0.0938466862f},
-std::array<float,2>{0.803412914f, 0.660085678f},
-std::array<float,2>{0.731643677f, 0.340810657f},
-std::array<float,2>{0.0588967092f, 0.955032825f},
-std::array<float,2>{0.247421131f, 0.385748804f},
-std::array<float,2>{0.596544981f, 0.852746189f},
-std::array<float,2>{0.889953136f, 0.127570599f},
-std::array<float,2>{0.296108246f, 0.519685388f},
-std::array<float,2>{0.169167697f, 0.0472418815f},
-std::array<float,2>{0.503613234f, 0.748855829f},
-std::array<float,2>{0.995678663f, 0.302630544f},
-std::array<float,2>{0.356928855f, 0.87848556f},
-std::array<float,2>{0.478474945f, 0.458397508f},
-std::array<float,2>{0.871080756f, 0.767291546f},
-std::array<float,2>{0.651560128f, 0.223574698f},
-std::array<float,2>{0.0891638473f, 0.621298969f},
-std::array<float,2>{0.264960885f, 0.180631548f},
-std::array<float,2>{0.932142794f, 0.53837204f},
-std::array<float,2>{0.588669658f, 0.420564473f},
-std::array<float,2>{0.217700228f, 0.828184605f},
-std::array<float,2>{0.0271248426f, 0.364605874f},
-std::array<float,2>{0.709380567f, 0.998377442f},
-std::array<float,2>{0.752920628f, 0.0768054202f},
-std::array<float,2>{0.382732928f, 0.631962299f},
-std::array<float,2>{0.142346278f, 0.230578095f},
-std::array<float,2>{0.545116782f, 0.611231267f},
-std::array<float,2>{0.938606799f, 0.464790404f},
-std::array<float,2>{0.334635705f, 0.778773367f},
-std::array<float,2>{0.453771204f, 0.311639279f},
-std::array<float,2>{0.834239841f, 0.886140823f},
-std::array<float,2>{0.674574196f, 0.0579427332f},
-std::array<float,2>{0.0976523012f, 0.7421f},
-std::array<float,2>{0.283245176f, 0.0627787709f},
-std::array<float,2>{0.87843293f, 0.633062482f},
-std::array<float,2>{0.603429914f, 0.369860798f},
-std::array<float,2>{0.2418219f, 0.990754604f},
-std::array<float,2>{0.0473713093f, 0.413860738f},
-std::array<float,2>{0.724701345f, 0.842887521f},
-std::array<float,2>{0.807112336f, 0.175633922f},
-std::array<float,2>{0.413388819f, 0.541518509f},
-std::array<float,2>{0.0857326314f, 0.00469772378f},
-std::array<float,2>{0.644549787f, 0.700596094f},
-std::array<float,2>{0.865918517f, 0.260044247f},
-std::array<float,2>{0.46940279f, 0.929648578f},
-std::array<float,2>{0.348800182f, 0.483493924f},
-std::array<float,2>{0.989439368f, 0.783612192f},
-std::array<float,2>{0.510473609f, 0.195640013f},
-std::array<float,2>{0.156857699f, 0.586805403f},
-std::array<float,2>{0.384795904f, 0.133709148f},
-std::array<float,2>{0.758084953f, 0.523443878f},
-std::array<float,2>{0.71292001f, 0.382600158f},
-std::array<float,2>{0.0182673745f, 0.851232231f},
-std::array<float,2>{0.21003814f, 0.328806937f},
-std::array<float,2>{0.581013381f, 0.961765528f},
-std::array<float,2>{0.928215921f, 0.108746544f},
-std::array<float,2>{0.251844764f, 0.668398857f},
-std::array<float,2>{0.00686784694f, 0.166350082f},
-std::array<float,2>{0.693781018f, 0.54703778f},
-std::array<float,2>{0.767216444f, 0.429117203f},
-std::array<float,2>{0.402185827f, 0.81326586f},
-std::array<float,2>{0.278073311f, 0.345799446f},
-std::array<float,2>{0.920942247f, 0.975068748f},
-std::array<float,2>{0.578014076f, 0.0913690329f},
-std::array<float,2>{0.198337004f, 0.6501894f},
-std::array<float,2>{0.499195397f, 0.0418912731f},
-std::array<float,2>{0.85361594f, 0.733820856f},
-std::array<float,2>{0.631712914f, 0.285204232f},
-std::array<float,2>{0.0748186484f, 0.894108534f},
-std::array<float,2>{0.176104531f, 0.444901258f},
-std::array<float,2>{0.51973784f, 0.751706541f},
-std::array<float,2>{0.983584285f, 0.245198816f},
-std::array<float,2>{0.361442685f, 0.603837073f},
-std::array<float,2>{0.225702181f, 0.117246285f},
-std::array<float,2>{0.615554094f, 0.683146894f},
-std::array<float,2>{0.900419772f, 0.326776356f},
-std::array<float,2>{0.301902354f, 0.947052002f},
-std::array<float,2>{0.424934924f, 0.394423634f},
-std::array<float,2>{0.79288584f, 0.864624083f},
-std::array<float,2>{0.74841696f, 0.15435411f},
-std::array<float,2>{0.044144135f, 0.50128442f},
-std::array<float,2>{0.313579023f, 0.215195119f},
-std::array<float,2>{0.954683781f, 0.572966337f},
-std::array<float,2>{0.561349809f, 0.484534502f},
-std::array<float,2>{0.13922964f, 0.81081742f},
-std::array<float,2>{0.121831968f, 0.277823359f},
-std::array<float,2>{0.667401969f, 0.917026818f},
-std::array<float,2>{0.824759603f, 0.0211088192f},
-std::array<float,2>{0.437674284f, 0.718567729f},
-std::array<float,2>{0.155440673f, 0.168629006f},
-std::array<float,2>{0.536720216f, 0.55322814f},
-std::array<float,2>{0.947692811f, 0.425692886f},
-std::array<float,2>{0.338341683f, 0.818719745f},
-std::array<float,2>{0.468218416f, 0.3506262f},
-std::array<float,2>{0.842707753f, 0.970980585f},
-std::array<float,2>{0.685346246f, 0.0873334855f},
-std::array<float,2>{0.102745786f, 0.653819382f},
-std::array<float,2>{0.290096134f, 0.0437478982f},
-std::array<float,2>{0.88579011f, 0.728305936f},
-std::array<float,2>{0.598287404f, 0.282257527f},
-std::array<float,2>{0.244741499f, 0.897242188f},
-std::array<float,2>{0.0547558591f, 0.438900381f},
-std::array<float,2>{0.727381468f, 0.757412374f},
-std::array<float,2>{0.797520339f, 0.249986798f},
-std::array<float,2>{0.419986874f, 0.606967449f},
-std::array<float,2>{0.0921845585f, 0.121965632f},
-std::array<float,2>{0.652478755f, 0.684884667f},
-std::array<float,2>{0.871251523f, 0.322149307f},
-std::array<float,2>{0.484325796f, 0.952195287f},
-std::array<float,2>{0.355308712f, 0.394809812f},
-std::array<float,2>{0.999876678f, 0.85964185f},
-std::array<float,2>{0.504417241f, 0.150888026f},
-std::array<float,2>{0.164540783f, 0.505334496f},
-std::array<float,2>{0.375194699f, 0.211594999f},
-std::array<float,2>{0.754966021f, 0.574356019f},
-std::array<float,2>{0.705997586f, 0.491461515f},
-std::array<float,2>{0.0279506836f, 0.806253672f},
-std::array<float,2>{0.211675718f, 0.277250588f},
-std::array<float,2>{0.592958331f, 0.919141412f},
-std::array<float,2>{0.937270701f, 0.0187364668f},
-std::array<float,2>{0.260916293f, 0.714668334f},
-std::array<float,2>{0.0148567883f, 0.22704497f},
-std::array<float,2>{0.699034274f, 0.614628255f},
-std::array<float,2>{0.780307889f, 0.465061098f},
-std::array<float,2>{0.392022699f, 0.774676323f},
-std::array<float,2>{0.273074955f, 0.307890683f},
-std::array<float,2>{0.912792802f, 0.888609529f},
-std::array<float,2>{0.566164196f, 0.0623263307f},
-std::array<float,2>{0.191883013f, 0.734957337f},
-std::array<float,2>{0.488366157f, 0.0683385879f},
-std::array<float,2>{0.846520245f, 0.637926817f},
-std::array<float,2>{0.63997525f, 0.37196508f},
-std::array<float,2>{0.0685688779f, 0.987961769f},
-std::array<float,2>{0.187085971f, 0.409236014f},
-std::array<float,2>{0.526648104f, 0.837140679f},
-std::array<float,2>{0.972151816f, 0.178218186f},
-std::array<float,2>{0.373467445f, 0.545379877f},
-std::array<float,2>{0.232843429f, 0.00110309012f},
-std::array<float,2>{0.620903492f, 0.696262896f},
-std::array<float,2>{0.893498957f, 0.263284028f},
-std::array<float,2>{0.304786295f, 0.925220549f},
-std::array<float,2>{0.434946477f, 0.478523105f},
-std::array<float,2>{0.784754753f, 0.785335004f},
-std::array<float,2>{0.740623593f, 0.199221402f},
-std::array<float,2>{0.031420406f, 0.592698812f},
-std::array<float,2>{0.323261112f, 0.138686255f},
-std::array<float,2>{0.963483036f, 0.528202772f},
-std::array<float,2>{0.554484367f, 0.375219107f},
-std::array<float,2>{0.132327706f, 0.845566869f},
-std::array<float,2>{0.113076575f, 0.334443182f},
-std::array<float,2>{0.658998847f, 0.966414869f},
-std::array<float,2>{0.818584859f, 0.10303171f},
-std::array<float,2>{0.448130816f, 0.665075779f},
-std::array<float,2>{0.199979216f, 0.194390342f},
-std::array<float,2>{0.57405436f, 0.578845501f},
-std::array<float,2>{0.914322078f, 0.468911469f},
-std::array<float,2>{0.27615577f, 0.790598989f},
-std::array<float,2>{0.404811174f, 0.252427369f},
-std::array<float,2>{0.77175796f, 0.934657335f},
-std::array<float,2>{0.688914657f, 0.0146160694f},
-std::array<float,2>{0.00373692671f, 0.689400434f},
-std::array<float,2>{0.367093712f, 0.0990802646f},
-std::array<float,2>{0.979764044f, 0.662239254f},
-std::array<float,2>{0.516608477f, 0.336277217f},
-std::array<float,2>{0.174101323f, 0.959209919f},
-std::array<float,2>{0.071080476f, 0.387327969f},
-std::array<float,2>{0.625590265f, 0.856231689f},
-std::array<float,2>{0.857326627f, 0.132627636f},
-std::array<float,2>{0.492680341f, 0.517260551f},
-std::array<float,2>{0.0429337658f, 0.0521178618f},
-std::array<float,2>{0.742365539f, 0.743693769f},
-std::array<float,2>{0.793872118f, 0.299025863f},
-std::array<float,2>{0.426510334f, 0.879763007f},
-std::array<float,2>{0.299708545f, 0.456393421f},
-std::array<float,2>{0.90343976f, 0.769976139f},
-std::array<float,2>{0.609459281f, 0.218955591f},
-std::array<float,2>{0.222184569f, 0.619269729f},
-std::array<float,2>{0.444913685f, 0.186836109f},
-std::array<float,2>{0.823927581f, 0.532299757f},
-std::array<float,2>{0.669280767f, 0.414682984f},
-std::array<float,2>{0.120063834f, 0.835058033f},
-std::array<float,2>{0.134377301f, 0.360696167f},
-std::array<float,2>{0.554923236f, 0.993455052f},
-std::array<float,2>{0.960222304f, 0.07201536f},
-std::array<float,2>{0.316762447f, 0.625985444f},
-std::array<float,2>{0.100798048f, 0.146935195f},
-std::array<float,2>{0.678573787f, 0.509101212f},
-std::array<float,2>{0.828416348f, 0.402119875f},
-std::array<float,2>{0.459835798f, 0.867234588f},
-std::array<float,2>{0.329163432f, 0.317602247f},
-std::array<float,2>{0.942780674f, 0.940244436f},
-std::array<float,2>{0.5409711f, 0.115748353f},
-std::array<float,2>{0.145299584f, 0.67964536f},
-std::array<float,2>{0.407713115f, 0.0297990646f},
-std::array<float,2>{0.811813354f, 0.708053052f},
-std::array<float,2>{0.721472561f, 0.268751264f},
-std::array<float,2>{0.0532465391f, 0.911607325f},
-std::array<float,2>{0.237177595f, 0.494421721f},
-std::array<float,2>{0.605804622f, 0.799013913f},
-std::array<float,2>{0.879861951f, 0.20782125f},
-std::array<float,2>{0.286900222f, 0.563338697f},
-std::array<float,2>{0.162642419f, 0.0814881399f},
-std::array<float,2>{0.515038311f, 0.646976769f},
-std::array<float,2>{0.988206923f, 0.354044378f},
-std::array<float,2>{0.345773131f, 0.982164979f},
-std::array<float,2>{0.475546211f, 0.432118177f},
-std::array<float,2>{0.859695911f, 0.823700368f},
-std::array<float,2>{0.642688274f, 0.161524057f},
-std::array<float,2>{0.0800850838f, 0.556963205f},
-std::array<float,2>{0.257084906f, 0.236282736f},
-std::array<float,2>{0.923472166f, 0.60086298f},
-std::array<float,2>{0.584067822f, 0.451436192f},
-std::array<float,2>{0.206305474f, 0.76388669f},
-std::array<float,2>{0.0233460423f, 0.294515908f},
-std::array<float,2>{0.717069209f, 0.904302359f},
-std::array<float,2>{0.765217841f, 0.0316589363f},
-std::array<float,2>{0.389966607f, 0.72407943f},
-std::array<float,2>{0.249600455f, 0.128126264f},
-std::array<float,2>{0.59408474f, 0.521398723f},
-std::array<float,2>{0.888381004f, 0.385575294f},
-std::array<float,2>{0.293165892f, 0.852251887f},
-std::array<float,2>{0.415919244f, 0.341135174f},
-std::array<float,2>{0.801566839f, 0.953476727f},
-std::array<float,2>{0.734180272f, 0.0956879482f},
-std::array<float,2>{0.0609131716f, 0.659113348f},
-std::array<float,2>{0.343262672f, 0.00927012693f},
-std::array<float,2>{0.950902164f, 0.691513777f},
-std::array<float,2>{0.533987999f, 0.255010247f},
-std::array<float,2>{0.148868516f, 0.9335922f},
-std::array<float,2>{0.106641695f, 0.47546488f},
-std::array<float,2>{0.679731548f, 0.795516729f},
-std::array<float,2>{0.83615911f, 0.189669937f},
-std::array<float,2>{0.463979423f, 0.585911274f},
-std::array<float,2>{0.0250184182f, 0.0774863809f},
-std::array<float,2>{0.707350194f, 0.631251037f},
-std::array<float,2>{0.751644552f, 0.363337189f},
-std::array<float,2>{0.379047632f, 0.999242127f},
-std::array<float,2>{0.263498992f, 0.42116341f},
-std::array<float,2>{0.930793703f, 0.829699814f},
-std::array<float,2>{0.586528659f, 0.181105763f},
-std::array<float,2>{0.215524897f, 0.537664711f},
-std::array<float,2>{0.479634434f, 0.223940015f},
-std::array<float,2>{0.868336141f, 0.623012781f},
-std::array<float,2>{0.649121225f, 0.457068235f},
-std::array<float,2>{0.0868352428f, 0.766298532f},
-std::array<float,2>{0.171031699f, 0.301554829f},
-std::array<float,2>{0.501741469f, 0.87773484f},
-std::array<float,2>{0.992900074f, 0.0483559519f},
-std::array<float,2>{0.357568979f, 0.749819875f},
-std::array<float,2>{0.0637147352f, 0.204498544f},
-std::array<float,2>{0.63619715f, 0.56918335f},
-std::array<float,2>{0.8478055f, 0.498549908f},
-std::array<float,2>{0.485336453f, 0.801679671f},
-std::array<float,2>{0.370164037f, 0.269800186f},
-std::array<float,2>{0.972675562f, 0.907961547f},
-std::array<float,2>{0.531205595f, 0.024530245f},
-std::array<float,2>{0.180961713f, 0.704904735f},
-std::array<float,2>{0.397446752f, 0.113260813f},
-std::array<float,2>{0.776218414f, 0.67391187f},
-std::array<float,2>{0.701753378f, 0.313054591f},
-std::array<float,2>{0.00787283853f, 0.943436146f},
-std::array<float,2>{0.190449148f, 0.404268533f},
-std::array<float,2>{0.568048716f, 0.873938978f},
-std::array<float,2>{0.90818584f, 0.143685177f},
-std::array<float,2>{0.26914376f, 0.512539029f},
-std::array<float,2>{0.126839712f, 0.0389125422f},
-std::array<float,2>{0.54792732f, 0.721033573f},
-std::array<float,2>{0.965117812f, 0.291652024f},
-std::array<float,2>{0.325133592f, 0.900136769f},
-std::array<float,2>{0.45133552f, 0.448033631f},
-std::array<float,2>{0.816176116f, 0.758120239f},
-std::array<float,2>{0.661667466f, 0.238834858f},
-std::array<float,2>{0.116765067f, 0.595526874f},
-std::array<float,2>{0.310556948f, 0.159734458f},
-std::array<float,2>{0.8976807f, 0.560658574f},
-std::array<float,2>{0.623262167f, 0.434258878f},
-std::array<float,2>{0.23030138f, 0.825823843f},
-std::array<float,2>{0.0380951315f, 0.357201606f},
-std::array<float,2>{0.736014724f, 0.979315639f},
-std::array<float,2>{0.786211967f, 0.0853837729f},
-std::array<float,2>{0.433426857f, 0.641355455f},
-std::array<float,2>{0.179200783f, 0.245034933f},
-std::array<float,2>{0.522777021f, 0.604637027f},
-std::array<float,2>{0.980556846f, 0.443678647f},
-std::array<float,2>{0.360542685f, 0.750733197f},
-std::array<float,2>{0.496677339f, 0.28705278f},
-std::array<float,2>{0.853119552f, 0.893196106f},
-std::array<float,2>{0.629697502f, 0.042049557f},
-std::array<float,2>{0.0767984688f, 0.732976377f},
-std::array<float,2>{0.280687898f, 0.0899266899f},
-std::array<float,2>{0.918815076f, 0.648754656f},
-std::array<float,2>{0.575420797f, 0.347116858f},
-std::array<float,2>{0.196385801f, 0.975992084f},
-std::array<float,2>{0.00501793995f, 0.428152502f},
-std::array<float,2>{0.692480803f, 0.813832998f},
-std::array<float,2>{0.768792212f, 0.167949826f},
-std::array<float,2>{0.399414629f, 0.548658788f},
-std::array<float,2>{0.124634102f, 0.0200637076f},
-std::array<float,2>{0.665983379f, 0.717478931f},
-std::array<float,2>{0.827082098f, 0.279017776f},
-std::array<float,2>{0.439458311f, 0.91636169f},
-std::array<float,2>{0.315636635f, 0.485851139f},
-std::array<float,2>{0.956885993f, 0.811781406f},
-std::array<float,2>{0.559313536f, 0.215821207f},
-std::array<float,2>{0.137364596f, 0.57358098f},
-std::array<float,2>{0.422465891f, 0.155554101f},
-std::array<float,2>{0.790387452f, 0.500751972f},
-std::array<float,2>{0.74713701f, 0.393418431f},
-std::array<float,2>{0.0459740572f, 0.863315344f},
-std::array<float,2>{0.223205015f, 0.327715993f},
-std::array<float,2>{0.613918066f, 0.945598364f},
-std::array<float,2>{0.899682462f, 0.118847542f},
-std::array<float,2>{0.304505587f, 0.681998909f},
-std::array<float,2>{0.0495579056f, 0.174173087f},
-std::array<float,2>{0.723770738f, 0.542681992f},
-std::array<float,2>{0.804989755f, 0.412469834f},
-std::array<float,2>{0.410775542f, 0.842584133f},
-std::array<float,2>{0.283152014f, 0.370745629f},
-std::array<float,2>{0.876866043f, 0.992062151f},
-std::array<float,2>{0.603747487f, 0.0642618239f},
-std::array<float,2>{0.238381729f, 0.634403646f},
-std::array<float,2>{0.45686543f, 0.0574026704f},
-std::array<float,2>{0.832991898f, 0.740734577f},
-std::array<float,2>{0.672487676f, 0.31108132f},
-std::array<float,2>{0.0948845595f, 0.884863853f},
-std::array<float,2>{0.144225568f, 0.463743687f},
-std::array<float,2>{0.543738425f, 0.777641952f},
-std::array<float,2>{0.940288186f, 0.231891558f},
-std::array<float,2>{0.332376361f, 0.609430552f},
-std::array<float,2>{0.208724231f, 0.107494131f},
-std::array<float,2>{0.578148901f, 0.669737995f},
-std::array<float,2>{0.927042723f, 0.329987645f},
-std::array<float,2>{0.252345234f, 0.961970866f},
-std::array<float,2>{0.383929402f, 0.381540209f},
-std::array<float,2>{0.760942519f, 0.850112319f},
-std::array<float,2>{0.711169243f, 0.134622976f},
-std::array<float,2>{0.0157605167f, 0.524810851f},
-std::array<float,2>{0.349949837f, 0.197107151f},
-std::array<float,2>{0.991506875f, 0.587787688f},
-std::array<float,2>{0.509287655f, 0.48339057f},
-std::array<float,2>{0.159154594f, 0.784653187f},
-std::array<float,2>{0.0821207538f, 0.261042982f},
-std::array<float,2>{0.648188353f, 0.928019464f},
-std::array<float,2>{0.864464939f, 0.00521110697f},
-std::array<float,2>{0.471856654f, 0.699702919f},
-std::array<float,2>{0.167663142f, 0.149345592f},
-std::array<float,2>{0.505875528f, 0.507683516f},
-std::array<float,2>{0.996221483f, 0.39659974f},
-std::array<float,2>{0.35207662f, 0.862282038f},
-std::array<float,2>{0.481999367f, 0.323795348f},
-std::array<float,2>{0.874692559f, 0.949826837f},
-std::array<float,2>{0.655984521f, 0.123102799f},
-std::array<float,2>{0.0899107382f, 0.686566591f},
-std::array<float,2>{0.2589086f, 0.0157573279f},
-std::array<float,2>{0.935484827f, 0.711443841f},
-std::array<float,2>{0.591755152f, 0.273641735f},
-std::array<float,2>{0.21362336f, 0.921525717f},
-std::array<float,2>{0.0308194105f, 0.489830464f},
-std::array<float,2>{0.703799725f, 0.807397306f},
-std::array<float,2>{0.755873322f, 0.213071734f},
-std::array<float,2>{0.377999038f, 0.577191412f},
-std::array<float,2>{0.104879707f, 0.0887002423f},
-std::array<float,2>{0.686719239f, 0.655317187f},
-std::array<float,2>{0.841202199f, 0.348754376f},
-std::array<float,2>{0.465436935f, 0.969352245f},
-std::array<float,2>{0.337286562f, 0.423783541f},
-std::array<float,2>{0.94694227f, 0.817036927f},
-std::array<float,2>{0.537765443f, 0.170748428f},
-std::array<float,2>{0.152629688f, 0.552687526f},
-std::array<float,2>{0.418617606f, 0.247586429f},
-std::array<float,2>{0.799174368f, 0.608612776f},
-std::array<float,2>{0.72939527f, 0.441133082f},
-std::array<float,2>{0.0573987514f, 0.755522013f},
-std::array<float,2>{0.244089186f, 0.284219831f},
-std::array<float,2>{0.599926353f, 0.895005405f},
-std::array<float,2>{0.883640051f, 0.0450084023f},
-std::array<float,2>{0.291823417f, 0.728962541f},
-std::array<float,2>{0.033251144f, 0.202869475f},
-std::array<float,2>{0.738486767f, 0.590564072f},
-std::array<float,2>{0.782586813f, 0.477038771f},
-std::array<float,2>{0.436110526f, 0.787259221f},
-std::array<float,2>{0.308110684f, 0.264196485f},
-std::array<float,2>{0.890679002f, 0.923748851f},
-std::array<float,2>{0.617326736f, 0.00385067449f},
-std::array<float,2>{0.231856316f, 0.698130548f},
-std::array<float,2>{0.446373641f, 0.104840845f},
-std::array<float,2>{0.817423403f, 0.666550696f},
-std::array<float,2>{0.65814817f, 0.332241893f},
-std::array<float,2>{0.110849731f, 0.968179226f},
-std::array<float,2>{0.130410075f, 0.377683997f},
-std::array<float,2>{0.551489651f, 0.846728861f},
-std::array<float,2>{0.961663246f, 0.136968732f},
-std::array<float,2>{0.32069543f, 0.531227946f},
-std::array<float,2>{0.193954989f, 0.0590810142f},
-std::array<float,2>{0.562562406f, 0.737918139f},
-std::array<float,2>{0.910213709f, 0.306456983f},
-std::array<float,2>{0.271451771f, 0.889309645f},
-std::array<float,2>{0.394120932f, 0.467099637f},
-std::array<float,2>{0.778297782f, 0.776855707f},
-std::array<float,2>{0.696682751f, 0.228936583f},
-std::array<float,2>{0.0117704403f, 0.616263092f},
-std::array<float,2>{0.371432751f, 0.176108196f},
-std::array<float,2>{0.968932807f, 0.544341207f},
-std::array<float,2>{0.524793863f, 0.40705806f},
-std::array<float,2>{0.184895992f, 0.839021623f},
-std::array<float,2>{0.0680579245f, 0.373650998f},
-std::array<float,2>{0.637467146f, 0.984805346f},
-std::array<float,2>{0.844427884f, 0.06969814f},
-std::array<float,2>{0.492054701f, 0.638916314f},
-std::array<float,2>{0.219537094f, 0.222293764f},
-std::array<float,2>{0.61302489f, 0.618240654f},
-std::array<float,2>{0.90539664f, 0.453900158f},
-std::array<float,2>{0.298575342f, 0.771902263f},
-std::array<float,2>{0.42781204f, 0.297823042f},
-std::array<float,2>{0.795933366f, 0.881816983f},
-std::array<float,2>{0.7457968f, 0.0530328341f},
-std::array<float,2>{0.0394005515f, 0.745254576f},
-std::array<float,2>{0.318395644f, 0.07418181f},
-std::array<float,2>{0.957167506f, 0.627234876f},
-std::array<float,2>{0.558424354f, 0.361346066f},
-std::array<float,2>{0.135411277f, 0.995042741f},
-std::array<float,2>{0.118048668f, 0.417275816f},
-std::array<float,2>{0.670235932f, 0.83212477f},
-std::array<float,2>{0.821141422f, 0.184827372f},
-std::array<float,2>{0.442324102f, 0.534879386f},
-std::array<float,2>{5.30437501e-05f, 0.0134328716f},
-std::array<float,2>{0.691116333f, 0.689751923f},
-std::array<float,2>{0.770094991f, 0.250183135f},
-std::array<float,2>{0.403429598f, 0.936569214f},
-std::array<float,2>{0.27461198f, 0.472318828f},
-std::array<float,2>{0.91676861f, 0.792720735f},
-std::array<float,2>{0.570964396f, 0.192663595f},
-std::array<float,2>{0.202563211f, 0.580311596f},
-std::array<float,2>{0.495304674f, 0.130210325f},
-std::array<float,2>{0.85758245f, 0.517804623f},
-std::array<float,2>{0.628427923f, 0.390400469f},
-std::array<float,2>{0.073778227f, 0.859250128f},
-std::array<float,2>{0.172951415f, 0.339715242f},
-std::array<float,2>{0.518977582f, 0.957296312f},
-std::array<float,2>{0.976693451f, 0.101129077f},
-std::array<float,2>{0.364377558f, 0.662003696f},
-std::array<float,2>{0.078841202f, 0.163282648f},
-std::array<float,2>{0.642038047f, 0.554915309f},
-std::array<float,2>{0.862681985f, 0.431238711f},
-std::array<float,2>{0.474423856f, 0.821989715f},
-std::array<float,2>{0.344767332f, 0.35322547f},
-std::array<float,2>{0.986280322f, 0.983870506f},
-std::array<float,2>{0.512568176f, 0.0789737105f},
-std::array<float,2>{0.16201663f, 0.646172106f},
-std::array<float,2>{0.386820555f, 0.0336034037f},
-std::array<float,2>{0.763476074f, 0.726093709f},
-std::array<float,2>{0.716046929f, 0.294998378f},
-std::array<float,2>{0.0213776026f, 0.903336704f},
-std::array<float,2>{0.204460368f, 0.449557036f},
-std::array<float,2>{0.582378268f, 0.761778712f},
-std::array<float,2>{0.925271869f, 0.237794712f},
-std::array<float,2>{0.255141169f, 0.598780453f},
-std::array<float,2>{0.14693971f, 0.114525266f},
-std::array<float,2>{0.541202188f, 0.677524149f},
-std::array<float,2>{0.944969356f, 0.318804562f},
-std::array<float,2>{0.331932992f, 0.938022852f},
-std::array<float,2>{0.458410978f, 0.400174528f},
-std::array<float,2>{0.830455244f, 0.870834053f},
-std::array<float,2>{0.67767334f, 0.146011651f},
-std::array<float,2>{0.0994284302f, 0.51049006f},
-std::array<float,2>{0.287558049f, 0.209786624f},
-std::array<float,2>{0.882442594f, 0.566258073f},
-std::array<float,2>{0.608598709f, 0.493289232f},
-std::array<float,2>{0.235894665f, 0.798733771f},
-std::array<float,2>{0.052118279f, 0.266017407f},
-std::array<float,2>{0.71919626f, 0.912265897f},
-std::array<float,2>{0.808876991f, 0.0276435073f},
-std::array<float,2>{0.409840584f, 0.710735738f},
-std::array<float,2>{0.218453765f, 0.18272762f},
-std::array<float,2>{0.589445531f, 0.536063015f},
-std::array<float,2>{0.933536947f, 0.419746399f},
-std::array<float,2>{0.263868749f, 0.830092609f},
-std::array<float,2>{0.381303191f, 0.366146445f},
-std::array<float,2>{0.753036678f, 0.99748534f},
-std::array<float,2>{0.710378826f, 0.0758745074f},
-std::array<float,2>{0.0254007485f, 0.630854845f},
-std::array<float,2>{0.355648845f, 0.0505637228f},
-std::array<float,2>{0.994449914f, 0.746658564f},
-std::array<float,2>{0.502408683f, 0.303763658f},
-std::array<float,2>{0.168205231f, 0.876321197f},
-std::array<float,2>{0.0883121043f, 0.460165799f},
-std::array<float,2>{0.650899231f, 0.767961442f},
-std::array<float,2>{0.869559228f, 0.225408629f},
-std::array<float,2>{0.476797193f, 0.623377442f},
-std::array<float,2>{0.0597051792f, 0.0971796438f},
-std::array<float,2>{0.731253743f, 0.657206059f},
-std::array<float,2>{0.803950787f, 0.343622684f},
-std::array<float,2>{0.416882962f, 0.955151021f},
-std::array<float,2>{0.295160949f, 0.383363008f},
-std::array<float,2>{0.889333129f, 0.854762554f},
-std::array<float,2>{0.597060859f, 0.126514077f},
-std::array<float,2>{0.246574581f, 0.523342669f},
-std::array<float,2>{0.462775916f, 0.188076079f},
-std::array<float,2>{0.839582622f, 0.582720995f},
-std::array<float,2>{0.681818485f, 0.472746342f},
-std::array<float,2>{0.107650355f, 0.794763684f},
-std::array<float,2>{0.152143985f, 0.256237596f},
-std::array<float,2>{0.532938898f, 0.929712594f},
-std::array<float,2>{0.951592684f, 0.010849691f},
-std::array<float,2>{0.339978784f, 0.693925261f},
-std::array<float,2>{0.114467271f, 0.240294844f},
-std::array<float,2>{0.662529588f, 0.59655714f},
-std::array<float,2>{0.813351631f, 0.445833266f},
-std::array<float,2>{0.451047271f, 0.761469126f},
-std::array<float,2>{0.32809177f, 0.290671587f},
-std::array<float,2>{0.967774093f, 0.902109206f},
-std::array<float,2>{0.54976052f, 0.0358708315f},
-std::array<float,2>{0.128699422f, 0.720629632f},
-std::array<float,2>{0.43098709f, 0.0823856145f},
-std::array<float,2>{0.788054705f, 0.64356178f},
-std::array<float,2>{0.73647362f, 0.358345747f},
-std::array<float,2>{0.0356778912f, 0.976713479f},
-std::array<float,2>{0.227365077f, 0.437235385f},
-std::array<float,2>{0.622918069f, 0.827367842f},
-std::array<float,2>{0.894721329f, 0.156780839f},
-std::array<float,2>{0.309740812f, 0.560056567f},
-std::array<float,2>{0.182442755f, 0.0265495479f},
-std::array<float,2>{0.527695715f, 0.706276536f},
-std::array<float,2>{0.975686848f, 0.27256459f},
-std::array<float,2>{0.367506385f, 0.909645796f},
-std::array<float,2>{0.487684608f, 0.496922195f},
-std::array<float,2>{0.849649072f, 0.802867293f},
-std::array<float,2>{0.633274019f, 0.205574155f},
-std::array<float,2>{0.0658112019f, 0.568296373f},
-std::array<float,2>{0.266230464f, 0.141474679f},
-std::array<float,2>{0.908659041f, 0.514603853f},
-std::array<float,2>{0.569566965f, 0.4053002f},
-std::array<float,2>{0.188583016f, 0.873018444f},
-std::array<float,2>{0.011640829f, 0.314723283f},
-std::array<float,2>{0.69998914f, 0.941482127f},
-std::array<float,2>{0.773464024f, 0.110824913f},
-std::array<float,2>{0.394817293f, 0.671898007f},
-std::array<float,2>{0.140495673f, 0.218345508f},
-std::array<float,2>{0.561699808f, 0.57047981f},
-std::array<float,2>{0.953144729f, 0.487856984f},
-std::array<float,2>{0.312636822f, 0.810458541f},
-std::array<float,2>{0.438985914f, 0.280102581f},
-std::array<float,2>{0.825535655f, 0.914668262f},
-std::array<float,2>{0.666204154f, 0.0228345674f},
-std::array<float,2>{0.122394949f, 0.71646595f},
-std::array<float,2>{0.301680773f, 0.120132253f},
-std::array<float,2>{0.901873589f, 0.680122375f},
-std::array<float,2>{0.616226137f, 0.32500422f},
-std::array<float,2>{0.225165069f, 0.947457969f},
-std::array<float,2>{0.0436225906f, 0.390897423f},
-std::array<float,2>{0.749868095f, 0.865944326f},
-std::array<float,2>{0.791270971f, 0.152395055f},
-std::array<float,2>{0.423844904f, 0.503673851f},
-std::array<float,2>{0.075357981f, 0.040091224f},
-std::array<float,2>{0.632647991f, 0.731346011f},
-std::array<float,2>{0.854835272f, 0.288980067f},
-std::array<float,2>{0.498708725f, 0.891095757f},
-std::array<float,2>{0.362685651f, 0.442707151f},
-std::array<float,2>{0.983007491f, 0.752066255f},
-std::array<float,2>{0.521236897f, 0.242971912f},
-std::array<float,2>{0.176785424f, 0.601568401f},
-std::array<float,2>{0.400402874f, 0.164983645f},
-std::array<float,2>{0.766489446f, 0.549350917f},
-std::array<float,2>{0.694740355f, 0.425975323f},
-std::array<float,2>{0.00597841106f, 0.814941764f},
-std::array<float,2>{0.197495773f, 0.34567523f},
-std::array<float,2>{0.576733291f, 0.973207653f},
-std::array<float,2>{0.92084074f, 0.0920401812f},
-std::array<float,2>{0.278920621f, 0.651898026f},
-std::array<float,2>{0.0194795802f, 0.134958833f},
-std::array<float,2>{0.71474123f, 0.526359737f},
-std::array<float,2>{0.759039581f, 0.379186004f},
-std::array<float,2>{0.386428624f, 0.848228037f},
-std::array<float,2>{0.250892848f, 0.330202848f},
-std::array<float,2>{0.928982079f, 0.963541448f},
-std::array<float,2>{0.58119005f, 0.105805837f},
-std::array<float,2>{0.209660709f, 0.669942975f},
-std::array<float,2>{0.470213264f, 0.00690072915f},
-std::array<float,2>{0.866523147f, 0.703082681f},
-std::array<float,2>{0.646144331f, 0.258069307f},
-std::array<float,2>{0.0843803659f, 0.927730262f},
-std::array<float,2>{0.157991201f, 0.480803221f},
-std::array<float,2>{0.511645317f, 0.783053875f},
-std::array<float,2>{0.988687575f, 0.197714478f},
-std::array<float,2>{0.348435044f, 0.589666426f},
-std::array<float,2>{0.240613282f, 0.0652441606f},
-std::array<float,2>{0.602116764f, 0.635272145f},
-std::array<float,2>{0.877811491f, 0.368135154f},
-std::array<float,2>{0.284244835f, 0.988692999f},
-std::array<float,2>{0.412867785f, 0.411426008f},
-std::array<float,2>{0.807628989f, 0.840155065f},
-std::array<float,2>{0.725752294f, 0.172288626f},
-std::array<float,2>{0.0482694693f, 0.54071945f},
-std::array<float,2>{0.335502267f, 0.233176678f},
-std::array<float,2>{0.938162625f, 0.612700224f},
-std::array<float,2>{0.546687901f, 0.461369157f},
-std::array<float,2>{0.141225725f, 0.779780507f},
-std::array<float,2>{0.0965849832f, 0.309432268f},
-std::array<float,2>{0.67485857f, 0.883454859f},
-std::array<float,2>{0.835572779f, 0.055536285f},
-std::array<float,2>{0.454389244f, 0.738372326f},
-std::array<float,2>{0.144578978f, 0.145983741f},
-std::array<float,2>{0.540172219f, 0.509779751f},
-std::array<float,2>{0.942975104f, 0.399901092f},
-std::array<float,2>{0.329718381f, 0.870184541f},
-std::array<float,2>{0.45938164f, 0.319032103f},
-std::array<float,2>{0.828833997f, 0.937839925f},
-std::array<float,2>{0.677782357f, 0.11480961f},
-std::array<float,2>{0.101454519f, 0.676836252f},
-std::array<float,2>{0.286462814f, 0.0281657279f},
-std::array<float,2>{0.879269242f, 0.710383117f},
-std::array<float,2>{0.606040478f, 0.266299456f},
-std::array<float,2>{0.236629725f, 0.912650883f},
-std::array<float,2>{0.0530169941f, 0.493881553f},
-std::array<float,2>{0.720799387f, 0.798104823f},
-std::array<float,2>{0.812272251f, 0.209172711f},
-std::array<float,2>{0.408088803f, 0.56587708f},
-std::array<float,2>{0.0806783512f, 0.0783993974f},
-std::array<float,2>{0.643162608f, 0.645848334f},
-std::array<float,2>{0.860206425f, 0.352710515f},
-std::array<float,2>{0.474977344f, 0.984289885f},
-std::array<float,2>{0.346559078f, 0.43083486f},
-std::array<float,2>{0.987505972f, 0.821441114f},
-std::array<float,2>{0.515242696f, 0.163953811f},
-std::array<float,2>{0.16214186f, 0.555499136f},
-std::array<float,2>{0.390209615f, 0.237466529f},
-std::array<float,2>{0.765060902f, 0.599311352f},
-std::array<float,2>{0.717746437f, 0.44973135f},
-std::array<float,2>{0.0225442015f, 0.762558579f},
-std::array<float,2>{0.206922382f, 0.295753986f},
-std::array<float,2>{0.584789097f, 0.903960049f},
-std::array<float,2>{0.923331439f, 0.0338414907f},
-std::array<float,2>{0.257530451f, 0.725875616f},
-std::array<float,2>{0.00325925462f, 0.193023205f},
-std::array<float,2>{0.689288378f, 0.580897808f},
-std::array<float,2>{0.77214098f, 0.471926063f},
-std::array<float,2>{0.404431194f, 0.792064726f},
-std::array<float,2>{0.275419384f, 0.250784606f},
-std::array<float,2>{0.91478008f, 0.937285662f},
-std::array<float,2>{0.573445618f, 0.0131634148f},
-std::array<float,2>{0.199578896f, 0.690200269f},
-std::array<float,2>{0.492492914f, 0.101063617f},
-std::array<float,2>{0.856785238f, 0.661245704f},
-std::array<float,2>{0.625099361f, 0.339161456f},
-std::array<float,2>{0.0704188943f, 0.957802176f},
-std::array<float,2>{0.174434334f, 0.389785022f},
-std::array<float,2>{0.517457247f, 0.858796179f},
-std::array<float,2>{0.98013097f, 0.130414039f},
-std::array<float,2>{0.366501004f, 0.518220484f},
-std::array<float,2>{0.222080067f, 0.0536420457f},
-std::array<float,2>{0.610172987f, 0.746086597f},
-std::array<float,2>{0.904126883f, 0.297247529f},
-std::array<float,2>{0.298858941f, 0.881297529f},
-std::array<float,2>{0.426216483f, 0.453605771f},
-std::array<float,2>{0.793428957f, 0.772302687f},
-std::array<float,2>{0.742738843f, 0.221853927f},
-std::array<float,2>{0.0422761515f, 0.619003236f},
-std::array<float,2>{0.317051232f, 0.185413137f},
-std::array<float,2>{0.960535467f, 0.534426093f},
-std::array<float,2>{0.555194378f, 0.417535454f},
-std::array<float,2>{0.133991852f, 0.832666814f},
-std::array<float,2>{0.119566076f, 0.361861646f},
-std::array<float,2>{0.669650674f, 0.994204938f},
-std::array<float,2>{0.823288679f, 0.0736897588f},
-std::array<float,2>{0.444675714f, 0.627514303f},
-std::array<float,2>{0.192141891f, 0.229128405f},
-std::array<float,2>{0.565632224f, 0.617144823f},
-std::array<float,2>{0.91245091f, 0.4673675f},
-std::array<float,2>{0.272652656f, 0.776488364f},
-std::array<float,2>{0.392119229f, 0.30611062f},
-std::array<float,2>{0.780882359f, 0.888882041f},
-std::array<float,2>{0.698522151f, 0.059209317f},
-std::array<float,2>{0.0155042214f, 0.737749279f},
-std::array<float,2>{0.373724312f, 0.0699286312f},
-std::array<float,2>{0.972314477f, 0.639398575f},
-std::array<float,2>{0.527271748f, 0.373074681f},
-std::array<float,2>{0.186747789f, 0.985210955f},
-std::array<float,2>{0.0689820573f, 0.406315058f},
-std::array<float,2>{0.640486121f, 0.839533806f},
-std::array<float,2>{0.845958769f, 0.176609516f},
-std::array<float,2>{0.488945246f, 0.544556379f},
-std::array<float,2>{0.0322047845f, 0.00331953983f},
-std::array<float,2>{0.741143227f, 0.697277486f},
-std::array<float,2>{0.78462106f, 0.263994247f},
-std::array<float,2>{0.435306579f, 0.923304498f},
-std::array<float,2>{0.305186152f, 0.477053404f},
-std::array<float,2>{0.892595172f, 0.787775815f},
-std::array<float,2>{0.620256245f, 0.202392802f},
-std::array<float,2>{0.233291328f, 0.589952052f},
-std::array<float,2>{0.447749585f, 0.137346968f},
-std::array<float,2>{0.819212198f, 0.53062439f},
-std::array<float,2>{0.65848279f, 0.377118081f},
-std::array<float,2>{0.112619236f, 0.847533762f},
-std::array<float,2>{0.132044405f, 0.332535207f},
-std::array<float,2>{0.553896189f, 0.968608439f},
-std::array<float,2>{0.963019013f, 0.105233483f},
-std::array<float,2>{0.324192494f, 0.666332304f},
-std::array<float,2>{0.103422746f, 0.170219198f},
-std::array<float,2>{0.684758902f, 0.552035332f},
-std::array<float,2>{0.841864645f, 0.423111856f},
-std::array<float,2>{0.468374312f, 0.816488385f},
-std::array<float,2>{0.33842504f, 0.349299312f},
-std::array<float,2>{0.948117495f, 0.968968511f},
-std::array<float,2>{0.536459088f, 0.0879605487f},
-std::array<float,2>{0.156187505f, 0.656103313f},
-std::array<float,2>{0.420612246f, 0.045609355f},
-std::array<float,2>{0.797339737f, 0.729136705f},
-std::array<float,2>{0.726945758f, 0.284990221f},
-std::array<float,2>{0.0552490763f, 0.895419061f},
-std::array<float,2>{0.244238555f, 0.440575242f},
-std::array<float,2>{0.597994149f, 0.7550295f},
-std::array<float,2>{0.886436641f, 0.247253463f},
-std::array<float,2>{0.290939569f, 0.609278321f},
-std::array<float,2>{0.164607227f, 0.123612404f},
-std::array<float,2>{0.504335105f, 0.687327325f},
-std::array<float,2>{0.999320388f, 0.323464692f},
-std::array<float,2>{0.354907125f, 0.949634314f},
-std::array<float,2>{0.483444363f, 0.3972826f},
-std::array<float,2>{0.871962309f, 0.861488104f},
-std::array<float,2>{0.653055668f, 0.148517102f},
-std::array<float,2>{0.0923607051f, 0.507137477f},
-std::array<float,2>{0.261600226f, 0.213453397f},
-std::array<float,2>{0.936666191f, 0.577919424f},
-std::array<float,2>{0.593293548f, 0.489721179f},
-std::array<float,2>{0.211420327f, 0.807119846f},
-std::array<float,2>{0.0275887288f, 0.274389744f},
-std::array<float,2>{0.705305517f, 0.921212971f},
-std::array<float,2>{0.755377889f, 0.0164452139f},
-std::array<float,2>{0.375604898f, 0.711043954f},
-std::array<float,2>{0.238955975f, 0.172502682f},
-std::array<float,2>{0.604408205f, 0.540314317f},
-std::array<float,2>{0.876131654f, 0.411680341f},
-std::array<float,2>{0.282444835f, 0.840793729f},
-std::array<float,2>{0.410546124f, 0.367602408f},
-std::array<float,2>{0.805437744f, 0.988964379f},
-std::array<float,2>{0.72444737f, 0.0648634285f},
-std::array<float,2>{0.0489248298f, 0.635244966f},
-std::array<float,2>{0.332765847f, 0.0550356284f},
-std::array<float,2>{0.939547896f, 0.738887489f},
-std::array<float,2>{0.543212414f, 0.308784544f},
-std::array<float,2>{0.143963248f, 0.882821023f},
-std::array<float,2>{0.0952809379f, 0.461685508f},
-std::array<float,2>{0.672117591f, 0.779975891f},
-std::array<float,2>{0.832342505f, 0.23270987f},
-std::array<float,2>{0.456435323f, 0.613239467f},
-std::array<float,2>{0.0163405556f, 0.106145225f},
-std::array<float,2>{0.711882532f, 0.670654416f},
-std::array<float,2>{0.761641264f, 0.33064568f},
-std::array<float,2>{0.38438943f, 0.962981224f},
-std::array<float,2>{0.252524763f, 0.37945047f},
-std::array<float,2>{0.927336633f, 0.848037243f},
-std::array<float,2>{0.57907027f, 0.135353625f},
-std::array<float,2>{0.20826146f, 0.525746346f},
-std::array<float,2>{0.472465396f, 0.197882921f},
-std::array<float,2>{0.865064085f, 0.588932157f},
-std::array<float,2>{0.64793545f, 0.481412202f},
-std::array<float,2>{0.0829336569f, 0.782291651f},
-std::array<float,2>{0.158366665f, 0.25841859f},
-std::array<float,2>{0.508881927f, 0.92694205f},
-std::array<float,2>{0.991915464f, 0.00737250317f},
-std::array<float,2>{0.350584388f, 0.702442646f},
-std::array<float,2>{0.0761819929f, 0.242352396f},
-std::array<float,2>{0.629265428f, 0.60238713f},
-std::array<float,2>{0.852715552f, 0.44326362f},
-std::array<float,2>{0.496447444f, 0.752450287f},
-std::array<float,2>{0.361196548f, 0.288143188f},
-std::array<float,2>{0.981011927f, 0.891221106f},
-std::array<float,2>{0.523426712f, 0.0407637171f},
-std::array<float,2>{0.178878501f, 0.730601072f},
-std::array<float,2>{0.400328398f, 0.0925741494f},
-std::array<float,2>{0.769252598f, 0.651394665f},
-std::array<float,2>{0.693275273f, 0.344902933f},
-std::array<float,2>{0.00541853206f, 0.972930014f},
-std::array<float,2>{0.197043568f, 0.426517755f},
-std::array<float,2>{0.576014757f, 0.814502597f},
-std::array<float,2>{0.918188095f, 0.164509982f},
-std::array<float,2>{0.281199783f, 0.548844934f},
-std::array<float,2>{0.137010887f, 0.0232654605f},
-std::array<float,2>{0.5588696f, 0.71628648f},
-std::array<float,2>{0.956100464f, 0.279508799f},
-std::array<float,2>{0.316389084f, 0.914354205f},
-std::array<float,2>{0.440213501f, 0.487412542f},
-std::array<float,2>{0.826475263f, 0.810030878f},
-std::array<float,2>{0.665258527f, 0.217940867f},
-std::array<float,2>{0.124034539f, 0.571055591f},
-std::array<float,2>{0.303783983f, 0.153083161f},
-std::array<float,2>{0.900324166f, 0.502962232f},
-std::array<float,2>{0.613498628f, 0.391570091f},
-std::array<float,2>{0.223067343f, 0.865516961f},
-std::array<float,2>{0.0466537923f, 0.324280202f},
-std::array<float,2>{0.748007655f, 0.947845757f},
-std::array<float,2>{0.790942311f, 0.120874822f},
-std::array<float,2>{0.422357947f, 0.680289268f},
-std::array<float,2>{0.181272611f, 0.205234647f},
-std::array<float,2>{0.530706108f, 0.56752646f},
-std::array<float,2>{0.973282635f, 0.496211052f},
-std::array<float,2>{0.370898426f, 0.803302526f},
-std::array<float,2>{0.484508961f, 0.273104042f},
-std::array<float,2>{0.848474264f, 0.909801304f},
-std::array<float,2>{0.636483729f, 0.0269265398f},
-std::array<float,2>{0.0640168786f, 0.706637621f},
-std::array<float,2>{0.268718898f, 0.110909335f},
-std::array<float,2>{0.907678485f, 0.672685683f},
-std::array<float,2>{0.567419469f, 0.315072984f},
-std::array<float,2>{0.190990478f, 0.941945314f},
-std::array<float,2>{0.00846597645f, 0.405795425f},
-std::array<float,2>{0.701310813f, 0.872529328f},
-std::array<float,2>{0.775815785f, 0.140885592f},
-std::array<float,2>{0.396956205f, 0.513891995f},
-std::array<float,2>{0.116387539f, 0.0355259404f},
-std::array<float,2>{0.661364734f, 0.719933927f},
-std::array<float,2>{0.81545651f, 0.290274292f},
-std::array<float,2>{0.452017933f, 0.901853323f},
-std::array<float,2>{0.324384719f, 0.445321143f},
-std::array<float,2>{0.965712726f, 0.760786295f},
-std::array<float,2>{0.548570573f, 0.240928933f},
-std::array<float,2>{0.126450345f, 0.595786691f},
-std::array<float,2>{0.432965904f, 0.156357586f},
-std::array<float,2>{0.786652625f, 0.560281336f},
-std::array<float,2>{0.735832989f, 0.436616212f},
-std::array<float,2>{0.0387381688f, 0.827860951f},
-std::array<float,2>{0.229837641f, 0.357490599f},
-std::array<float,2>{0.623670399f, 0.97721082f},
-std::array<float,2>{0.898118138f, 0.0826331005f},
-std::array<float,2>{0.311436743f, 0.644401848f},
-std::array<float,2>{0.0614995174f, 0.126371056f},
-std::array<float,2>{0.733698964f, 0.522937298f},
-std::array<float,2>{0.80100745f, 0.383146733f},
-std::array<float,2>{0.415291756f, 0.855370343f},
-std::array<float,2>{0.293707132f, 0.343030006f},
-std::array<float,2>{0.888114393f, 0.955789447f},
-std::array<float,2>{0.59425962f, 0.0971243605f},
-std::array<float,2>{0.249033034f, 0.656536698f},
-std::array<float,2>{0.464372784f, 0.0116802594f},
-std::array<float,2>{0.836594045f, 0.693407297f},
-std::array<float,2>{0.680510998f, 0.256809175f},
-std::array<float,2>{0.107201897f, 0.930550873f},
-std::array<float,2>{0.149151906f, 0.47319454f},
-std::array<float,2>{0.533643782f, 0.794233203f},
-std::array<float,2>{0.950518727f, 0.187518075f},
-std::array<float,2>{0.343134254f, 0.582323015f},
-std::array<float,2>{0.215119839f, 0.0756151527f},
-std::array<float,2>{0.586279333f, 0.630272388f},
-std::array<float,2>{0.93162936f, 0.365452826f},
-std::array<float,2>{0.263127178f, 0.997830629f},
-std::array<float,2>{0.379482061f, 0.419334382f},
-std::array<float,2>{0.751395583f, 0.83092618f},
-std::array<float,2>{0.707829475f, 0.18325457f},
-std::array<float,2>{0.0246432461f, 0.53517437f},
-std::array<float,2>{0.357921958f, 0.224705771f},
-std::array<float,2>{0.992209435f, 0.623952806f},
-std::array<float,2>{0.501455188f, 0.460819155f},
-std::array<float,2>{0.171854004f, 0.768267095f},
-std::array<float,2>{0.0861848071f, 0.304389268f},
-std::array<float,2>{0.648614407f, 0.8769418f},
-std::array<float,2>{0.869103849f, 0.0502699055f},
-std::array<float,2>{0.48014465f, 0.746472359f},
-std::array<float,2>{0.161333933f, 0.162020653f},
-std::array<float,2>{0.512163341f, 0.557208776f},
-std::array<float,2>{0.985543787f, 0.432464451f},
-std::array<float,2>{0.345450729f, 0.823840678f},
-std::array<float,2>{0.473740458f, 0.353666306f},
-std::array<float,2>{0.862926602f, 0.981723607f},
-std::array<float,2>{0.642485976f, 0.0815636814f},
-std::array<float,2>{0.078275688f, 0.64677f},
-std::array<float,2>{0.255813301f, 0.0317501128f},
-std::array<float,2>{0.92544198f, 0.72449106f},
-std::array<float,2>{0.582993269f, 0.294019908f},
-std::array<float,2>{0.204751194f, 0.905157328f},
-std::array<float,2>{0.0207480844f, 0.451910704f},
-std::array<float,2>{0.71632123f, 0.764431f},
-std::array<float,2>{0.762823343f, 0.235377133f},
-std::array<float,2>{0.387463123f, 0.601246357f},
-std::array<float,2>{0.0989736244f, 0.115442261f},
-std::array<float,2>{0.677035868f, 0.679170847f},
-std::array<float,2>{0.830738723f, 0.317957819f},
-std::array<float,2>{0.458957285f, 0.939886689f},
-std::array<float,2>{0.331390023f, 0.401488513f},
-std::array<float,2>{0.944550812f, 0.868068397f},
-std::array<float,2>{0.541607499f, 0.14733167f},
-std::array<float,2>{0.147249088f, 0.509746552f},
-std::array<float,2>{0.409338772f, 0.20707266f},
-std::array<float,2>{0.809475422f, 0.56262368f},
-std::array<float,2>{0.719533622f, 0.494793683f},
-std::array<float,2>{0.0522893704f, 0.799440145f},
-std::array<float,2>{0.235606313f, 0.269372493f},
-std::array<float,2>{0.609195709f, 0.911773682f},
-std::array<float,2>{0.881855667f, 0.0296305399f},
-std::array<float,2>{0.287900329f, 0.708725035f},
-std::array<float,2>{0.0398432501f, 0.219302595f},
-std::array<float,2>{0.745566666f, 0.619704783f},
-std::array<float,2>{0.796528697f, 0.456938118f},
-std::array<float,2>{0.42870757f, 0.770311117f},
-std::array<float,2>{0.298069477f, 0.299564242f},
-std::array<float,2>{0.905845761f, 0.878928304f},
-std::array<float,2>{0.612556219f, 0.0526216961f},
-std::array<float,2>{0.218914852f, 0.743626058f},
-std::array<float,2>{0.441441625f, 0.0716940314f},
-std::array<float,2>{0.820715129f, 0.626489341f},
-std::array<float,2>{0.670500517f, 0.361107469f},
-std::array<float,2>{0.117399193f, 0.993947566f},
-std::array<float,2>{0.134986505f, 0.414284736f},
-std::array<float,2>{0.557728469f, 0.835916162f},
-std::array<float,2>{0.957857251f, 0.18719992f},
-std::array<float,2>{0.319276124f, 0.53286159f},
-std::array<float,2>{0.203097209f, 0.013975746f},
-std::array<float,2>{0.570661545f, 0.688960254f},
-std::array<float,2>{0.916289091f, 0.252883911f},
-std::array<float,2>{0.275025278f, 0.935390353f},
-std::array<float,2>{0.404162019f, 0.469692469f},
-std::array<float,2>{0.769895852f, 0.790132999f},
-std::array<float,2>{0.690886199f, 0.194992557f},
-std::array<float,2>{0.000645443157f, 0.578201354f},
-std::array<float,2>{0.364814013f, 0.13221997f},
-std::array<float,2>{0.977320313f, 0.516607821f},
-std::array<float,2>{0.519149065f, 0.387095928f},
-std::array<float,2>{0.173825875f, 0.855550349f},
-std::array<float,2>{0.0734897107f, 0.336841285f},
-std::array<float,2>{0.628094614f, 0.959694803f},
-std::array<float,2>{0.858204782f, 0.0993524343f},
-std::array<float,2>{0.495656729f, 0.662927866f},
-std::array<float,2>{0.232359692f, 0.199827358f},
-std::array<float,2>{0.617939293f, 0.591983259f},
-std::array<float,2>{0.891431749f, 0.479050636f},
-std::array<float,2>{0.307638645f, 0.786095679f},
-std::array<float,2>{0.435638964f, 0.262980253f},
-std::array<float,2>{0.782780886f, 0.925703526f},
-std::array<float,2>{0.738989353f, 0.00168383203f},
-std::array<float,2>{0.0338838473f, 0.695447683f},
-std::array<float,2>{0.320859253f, 0.102583438f},
-std::array<float,2>{0.961266696f, 0.665627956f},
-std::array<float,2>{0.551268578f, 0.334603608f},
-std::array<float,2>{0.130126283f, 0.966016233f},
-std::array<float,2>{0.110630035f, 0.375560939f},
-std::array<float,2>{0.657607794f, 0.844788253f},
-std::array<float,2>{0.81805563f, 0.139262944f},
-std::array<float,2>{0.447039664f, 0.527500212f},
-std::array<float,2>{0.012676131f, 0.0617944635f},
-std::array<float,2>{0.697198391f, 0.734820962f},
-std::array<float,2>{0.777363002f, 0.308306605f},
-std::array<float,2>{0.393846989f, 0.887977242f},
-std::array<float,2>{0.270785958f, 0.465396196f},
-std::array<float,2>{0.911027431f, 0.774906635f},
-std::array<float,2>{0.563209295f, 0.227345616f},
-std::array<float,2>{0.19338721f, 0.61500001f},
-std::array<float,2>{0.49135235f, 0.178338766f},
-std::array<float,2>{0.843997359f, 0.545663536f},
-std::array<float,2>{0.637067616f, 0.409921587f},
-std::array<float,2>{0.0677295551f, 0.837567568f},
-std::array<float,2>{0.185499415f, 0.371293396f},
-std::array<float,2>{0.525363088f, 0.987355113f},
-std::array<float,2>{0.969707012f, 0.0675026327f},
-std::array<float,2>{0.371583581f, 0.638241529f},
-std::array<float,2>{0.0907478034f, 0.150409475f},
-std::array<float,2>{0.655727804f, 0.505455673f},
-std::array<float,2>{0.874372661f, 0.395110548f},
-std::array<float,2>{0.481504768f, 0.860241234f},
-std::array<float,2>{0.351931065f, 0.32151711f},
-std::array<float,2>{0.997018516f, 0.952873647f},
-std::array<float,2>{0.506395996f, 0.121279284f},
-std::array<float,2>{0.167367429f, 0.685158432f},
-std::array<float,2>{0.378677249f, 0.0191489384f},
-std::array<float,2>{0.756824434f, 0.71389854f},
-std::array<float,2>{0.703609586f, 0.276786536f},
-std::array<float,2>{0.0303554293f, 0.919662535f},
-std::array<float,2>{0.213217676f, 0.491713047f},
-std::array<float,2>{0.591254532f, 0.806147039f},
-std::array<float,2>{0.935040534f, 0.211291492f},
-std::array<float,2>{0.259675413f, 0.574937582f},
-std::array<float,2>{0.153090328f, 0.0877821594f},
-std::array<float,2>{0.537433267f, 0.653375387f},
-std::array<float,2>{0.946617723f, 0.351081908f},
-std::array<float,2>{0.337492943f, 0.971483529f},
-std::array<float,2>{0.465243757f, 0.424922913f},
-std::array<float,2>{0.841379106f, 0.819051087f},
-std::array<float,2>{0.687307775f, 0.168148577f},
-std::array<float,2>{0.105149351f, 0.552968621f},
-std::array<float,2>{0.291365087f, 0.24943535f},
-std::array<float,2>{0.883028269f, 0.606648624f},
-std::array<float,2>{0.600538909f, 0.439342946f},
-std::array<float,2>{0.243487671f, 0.757301271f},
-std::array<float,2>{0.0567645282f, 0.283137649f},
-std::array<float,2>{0.728662252f, 0.896832287f},
-std::array<float,2>{0.799640357f, 0.0430521518f},
-std::array<float,2>{0.418227822f, 0.72762239f},
-std::array<float,2>{0.209077448f, 0.134105995f},
-std::array<float,2>{0.581543207f, 0.525218964f},
-std::array<float,2>{0.929324508f, 0.381151378f},
-std::array<float,2>{0.250381738f, 0.849619627f},
-std::array<float,2>{0.386149764f, 0.329284787f},
-std::array<float,2>{0.75961864f, 0.962875485f},
-std::array<float,2>{0.714339197f, 0.107973628f},
-std::array<float,2>{0.0188931599f, 0.669402242f},
-std::array<float,2>{0.347764462f, 0.00580369309f},
-std::array<float,2>{0.989125609f, 0.700069845f},
-std::array<float,2>{0.511067152f, 0.261561304f},
-std::array<float,2>{0.157445312f, 0.928660512f},
-std::array<float,2>{0.0846505836f, 0.482799351f},
-std::array<float,2>{0.645751774f, 0.78498745f},
-std::array<float,2>{0.866989136f, 0.196289316f},
-std::array<float,2>{0.470349193f, 0.586970627f},
-std::array<float,2>{0.0485248826f, 0.0635932162f},
-std::array<float,2>{0.726269305f, 0.633854091f},
-std::array<float,2>{0.808409691f, 0.370182216f},
-std::array<float,2>{0.412235796f, 0.991495728f},
-std::array<float,2>{0.28471595f, 0.412813187f},
-std::array<float,2>{0.877242863f, 0.842077672f},
-std::array<float,2>{0.601952016f, 0.1746144f},
-std::array<float,2>{0.24119021f, 0.542059839f},
-std::array<float,2>{0.455074489f, 0.232407153f},
-std::array<float,2>{0.835366368f, 0.610097945f},
-std::array<float,2>{0.675760031f, 0.46289134f},
-std::array<float,2>{0.0961702615f, 0.778034627f},
-std::array<float,2>{0.14082709f, 0.310898662f},
-std::array<float,2>{0.545983672f, 0.885509849f},
-std::array<float,2>{0.937940419f, 0.0568445027f},
-std::array<float,2>{0.335340947f, 0.740244269f},
-std::array<float,2>{0.122918725f, 0.216649666f},
-std::array<float,2>{0.666751802f, 0.573898435f},
-std::array<float,2>{0.825790942f, 0.485441804f},
-std::array<float,2>{0.438933432f, 0.81228894f},
-std::array<float,2>{0.313389987f, 0.278604418f},
-std::array<float,2>{0.953812718f, 0.916921079f},
-std::array<float,2>{0.562260687f, 0.0199438147f},
-std::array<float,2>{0.139736205f, 0.717172086f},
-std::array<float,2>{0.424675435f, 0.118587747f},
-std::array<float,2>{0.79152739f, 0.682548285f},
-std::array<float,2>{0.749297321f, 0.327512681f},
-std::array<float,2>{0.0430981778f, 0.946086884f},
-std::array<float,2>{0.224940851f, 0.392748922f},
-std::array<float,2>{0.616702139f, 0.863913953f},
-std::array<float,2>{0.901553333f, 0.156104118f},
-std::array<float,2>{0.300964475f, 0.500082016f},
-std::array<float,2>{0.177440688f, 0.0425969735f},
-std::array<float,2>{0.520607352f, 0.73256731f},
-std::array<float,2>{0.982733428f, 0.28630811f},
-std::array<float,2>{0.362974137f, 0.892912507f},
-std::array<float,2>{0.498439401f, 0.44393611f},
-std::array<float,2>{0.855182469f, 0.750084281f},
-std::array<float,2>{0.63198036f, 0.244428009f},
-std::array<float,2>{0.0761045665f, 0.605175436f},
-std::array<float,2>{0.278491408f, 0.167342812f},
-std::array<float,2>{0.920165479f, 0.547982216f},
-std::array<float,2>{0.576553762f, 0.428545684f},
-std::array<float,2>{0.197852492f, 0.814133346f},
-std::array<float,2>{0.0064403126f, 0.347187251f},
-std::array<float,2>{0.695069551f, 0.976308465f},
-std::array<float,2>{0.766105711f, 0.0904844999f},
-std::array<float,2>{0.400925368f, 0.649300039f},
-std::array<float,2>{0.128126815f, 0.2384139f},
-std::array<float,2>{0.549008906f, 0.595147014f},
-std::array<float,2>{0.968610466f, 0.447309941f},
-std::array<float,2>{0.327251196f, 0.758540869f},
-std::array<float,2>{0.450596273f, 0.291462004f},
-std::array<float,2>{0.812516689f, 0.899573684f},
-std::array<float,2>{0.662952483f, 0.0384419374f},
-std::array<float,2>{0.114997551f, 0.721592486f},
-std::array<float,2>{0.310385913f, 0.0855685994f},
-std::array<float,2>{0.895163298f, 0.640945673f},
-std::array<float,2>{0.622207463f, 0.356709868f},
-std::array<float,2>{0.227025807f, 0.978797138f},
-std::array<float,2>{0.0354571193f, 0.433914095f},
-std::array<float,2>{0.736887038f, 0.82559073f},
-std::array<float,2>{0.787389398f, 0.159371257f},
-std::array<float,2>{0.431515038f, 0.561292052f},
-std::array<float,2>{0.066190362f, 0.0250541084f},
-std::array<float,2>{0.633706689f, 0.70439589f},
-std::array<float,2>{0.850224197f, 0.27010107f},
-std::array<float,2>{0.488006592f, 0.907487452f},
-std::array<float,2>{0.367959082f, 0.498451263f},
-std::array<float,2>{0.976157486f, 0.800864756f},
-std::array<float,2>{0.527959645f, 0.204741374f},
-std::array<float,2>{0.181694731f, 0.568386436f},
-std::array<float,2>{0.395408452f, 0.144506127f},
-std::array<float,2>{0.774333417f, 0.512016177f},
-std::array<float,2>{0.699444294f, 0.403381288f},
-std::array<float,2>{0.01105073f, 0.873487234f},
-std::array<float,2>{0.189362615f, 0.312656879f},
-std::array<float,2>{0.570169151f, 0.944008529f},
-std::array<float,2>{0.909124732f, 0.112334959f},
-std::array<float,2>{0.265802771f, 0.674749255f},
-std::array<float,2>{0.026122937f, 0.181258634f},
-std::array<float,2>{0.710607946f, 0.537239015f},
-std::array<float,2>{0.753556311f, 0.421826065f},
-std::array<float,2>{0.38154301f, 0.829493225f},
-std::array<float,2>{0.26427868f, 0.363950729f},
-std::array<float,2>{0.932921648f, 0.999725223f},
-std::array<float,2>{0.589130104f, 0.0778890476f},
-std::array<float,2>{0.218016818f, 0.631788671f},
-std::array<float,2>{0.47737062f, 0.0479542501f},
-std::array<float,2>{0.870080352f, 0.74938798f},
-std::array<float,2>{0.650842786f, 0.301197112f},
-std::array<float,2>{0.0883937106f, 0.876970053f},
-std::array<float,2>{0.168909162f, 0.458005458f},
-std::array<float,2>{0.502748966f, 0.765948415f},
-std::array<float,2>{0.995115757f, 0.22431089f},
-std::array<float,2>{0.356368035f, 0.622536361f},
-std::array<float,2>{0.246611178f, 0.0949594975f},
-std::array<float,2>{0.597450018f, 0.658427477f},
-std::array<float,2>{0.889154673f, 0.341469347f},
-std::array<float,2>{0.295755953f, 0.953704119f},
-std::array<float,2>{0.416418403f, 0.38507542f},
-std::array<float,2>{0.804521024f, 0.851718724f},
-std::array<float,2>{0.730618536f, 0.128475502f},
-std::array<float,2>{0.060453359f, 0.520559072f},
-std::array<float,2>{0.340589762f, 0.19037649f},
-std::array<float,2>{0.95197022f, 0.585176647f},
-std::array<float,2>{0.532240927f, 0.474642903f},
-std::array<float,2>{0.151722819f, 0.795272708f},
-std::array<float,2>{0.107961871f, 0.255720824f},
-std::array<float,2>{0.682318628f, 0.93283093f},
-std::array<float,2>{0.839193523f, 0.00951085798f},
-std::array<float,2>{0.462031931f, 0.69216454f},
-std::array<float,2>{0.133158445f, 0.186104983f},
-std::array<float,2>{0.55626595f, 0.531740308f},
-std::array<float,2>{0.959900737f, 0.415952414f},
-std::array<float,2>{0.317892969f, 0.8344329f},
-std::array<float,2>{0.443602204f, 0.360078603f},
-std::array<float,2>{0.82315141f, 0.992433608f},
-std::array<float,2>{0.668647826f, 0.0711631477f},
-std::array<float,2>{0.120365903f, 0.625242114f},
-std::array<float,2>{0.30055517f, 0.0511944108f},
-std::array<float,2>{0.902685106f, 0.742626071f},
-std::array<float,2>{0.610980332f, 0.300671101f},
-std::array<float,2>{0.221593663f, 0.880760014f},
-std::array<float,2>{0.0411689132f, 0.455367655f},
-std::array<float,2>{0.744131625f, 0.770925105f},
-std::array<float,2>{0.794249654f, 0.220248863f},
-std::array<float,2>{0.427497596f, 0.620710671f},
-std::array<float,2>{0.0717036352f, 0.097691074f},
-std::array<float,2>{0.626446128f, 0.66354084f},
-std::array<float,2>{0.85615474f, 0.337680966f},
-std::array<float,2>{0.493670613f, 0.960273683f},
-std::array<float,2>{0.365919471f, 0.387747079f},
-std::array<float,2>{0.979188621f, 0.856550574f},
-std::array<float,2>{0.516409039f, 0.130950317f},
-std::array<float,2>{0.175575003f, 0.51607126f},
-std::array<float,2>{0.405302346f, 0.193588376f},
-std::array<float,2>{0.773161173f, 0.579156578f},
-std::array<float,2>{0.687711418f, 0.469877869f},
-std::array<float,2>{0.00219457271f, 0.789299607f},
-std::array<float,2>{0.200903282f, 0.253767818f},
-std::array<float,2>{0.572992742f, 0.934562445f},
-std::array<float,2>{0.915759504f, 0.0155876856f},
-std::array<float,2>{0.276851267f, 0.688150346f},
-std::array<float,2>{0.0218857564f, 0.234582216f},
-std::array<float,2>{0.717838764f, 0.600153625f},
-std::array<float,2>{0.76372695f, 0.45292291f},
-std::array<float,2>{0.388864249f, 0.765508711f},
-std::array<float,2>{0.256200612f, 0.293636978f},
-std::array<float,2>{0.922286451f, 0.906152606f},
-std::array<float,2>{0.584972024f, 0.0329289697f},
-std::array<float,2>{0.205305412f, 0.723310709f},
-std::array<float,2>{0.476296663f, 0.0808980986f},
-std::array<float,2>{0.860509574f, 0.64775461f},
-std::array<float,2>{0.644152522f, 0.355363101f},
-std::array<float,2>{0.0818057433f, 0.980547786f},
-std::array<float,2>{0.164005369f, 0.433370292f},
-std::array<float,2>{0.514276206f, 0.82241869f},
-std::array<float,2>{0.987068713f, 0.160185292f},
-std::array<float,2>{0.34738493f, 0.557988465f},
-std::array<float,2>{0.237477303f, 0.0310737398f},
-std::array<float,2>{0.606731176f, 0.707335353f},
-std::array<float,2>{0.880275726f, 0.268058389f},
-std::array<float,2>{0.285477281f, 0.910831869f},
-std::array<float,2>{0.406491578f, 0.495432436f},
-std::array<float,2>{0.811487257f, 0.800666213f},
-std::array<float,2>{0.722068787f, 0.208237633f},
-std::array<float,2>{0.0537225492f, 0.564291596f},
-std::array<float,2>{0.328640878f, 0.148033485f},
-std::array<float,2>{0.9423455f, 0.508731604f},
-std::array<float,2>{0.539945662f, 0.400786102f},
-std::array<float,2>{0.146351621f, 0.868410647f},
-std::array<float,2>{0.100102387f, 0.316696227f},
-std::array<float,2>{0.678807199f, 0.941010714f},
-std::array<float,2>{0.829487443f, 0.116899826f},
-std::array<float,2>{0.460399538f, 0.678523421f},
-std::array<float,2>{0.212277353f, 0.212882817f},
-std::array<float,2>{0.592029989f, 0.575954258f},
-std::array<float,2>{0.936410844f, 0.491190553f},
-std::array<float,2>{0.259957969f, 0.804798603f},
-std::array<float,2>{0.376345336f, 0.276057184f},
-std::array<float,2>{0.754743755f, 0.91811204f},
-std::array<float,2>{0.707012534f, 0.0183566026f},
-std::array<float,2>{0.0284036398f, 0.713387251f},
-std::array<float,2>{0.354306102f, 0.122746699f},
-std::array<float,2>{0.998915076f, 0.684462249f},
-std::array<float,2>{0.505261421f, 0.321281105f},
-std::array<float,2>{0.165349498f, 0.951236904f},
-std::array<float,2>{0.0934708267f, 0.396418273f},
-std::array<float,2>{0.653417528f, 0.860498905f},
-std::array<float,2>{0.872692883f, 0.151913911f},
-std::array<float,2>{0.482959747f, 0.504576802f},
-std::array<float,2>{0.0563615374f, 0.044904653f},
-std::array<float,2>{0.728093624f, 0.726687133f},
-std::array<float,2>{0.798401892f, 0.281553984f},
-std::array<float,2>{0.421138704f, 0.898008764f},
-std::array<float,2>{0.289090067f, 0.438031077f},
-std::array<float,2>{0.885420859f, 0.756630838f},
-std::array<float,2>{0.599476755f, 0.248420432f},
-std::array<float,2>{0.245503888f, 0.605958521f},
-std::array<float,2>{0.467604697f, 0.16911611f},
-std::array<float,2>{0.842783272f, 0.553920746f},
-std::array<float,2>{0.684412897f, 0.424601883f},
-std::array<float,2>{0.102431335f, 0.819564998f},
-std::array<float,2>{0.154942378f, 0.350141317f},
-std::array<float,2>{0.535383403f, 0.972424686f},
-std::array<float,2>{0.948728025f, 0.0865708888f},
-std::array<float,2>{0.339833677f, 0.652852118f},
-std::array<float,2>{0.112208039f, 0.13974461f},
-std::array<float,2>{0.660020769f, 0.528505385f},
-std::array<float,2>{0.819423914f, 0.376301855f},
-std::array<float,2>{0.449189126f, 0.843764305f},
-std::array<float,2>{0.323105395f, 0.33577311f},
-std::array<float,2>{0.964415371f, 0.965563476f},
-std::array<float,2>{0.552782357f, 0.101651229f},
-std::array<float,2>{0.131107494f, 0.664593041f},
-std::array<float,2>{0.434208333f, 0.000300854445f},
-std::array<float,2>{0.783263564f, 0.696842551f},
-std::array<float,2>{0.741704106f, 0.262591213f},
-std::array<float,2>{0.0327853002f, 0.924475253f},
-std::array<float,2>{0.233854502f, 0.479601324f},
-std::array<float,2>{0.619647324f, 0.786234975f},
-std::array<float,2>{0.893860102f, 0.201024845f},
-std::array<float,2>{0.30662334f, 0.593676507f},
-std::array<float,2>{0.186297432f, 0.0666535571f},
-std::array<float,2>{0.526100993f, 0.637548327f},
-std::array<float,2>{0.971133947f, 0.372118026f},
-std::array<float,2>{0.374464899f, 0.986742437f},
-std::array<float,2>{0.489802957f, 0.409125715f},
-std::array<float,2>{0.846931338f, 0.836723685f},
-std::array<float,2>{0.639415085f, 0.178768754f},
-std::array<float,2>{0.0697070882f, 0.546043634f},
-std::array<float,2>{0.27195397f, 0.227667823f},
-std::array<float,2>{0.913740337f, 0.613637805f},
-std::array<float,2>{0.565033317f, 0.466786772f},
-std::array<float,2>{0.193170711f, 0.773969531f},
-std::array<float,2>{0.0143762734f, 0.307603896f},
-std::array<float,2>{0.6977579f, 0.886988759f},
-std::array<float,2>{0.78000164f, 0.0614036843f},
-std::array<float,2>{0.391532302f, 0.735883296f},
-std::array<float,2>{0.224218264f, 0.155146673f},
-std::array<float,2>{0.614471257f, 0.501553893f},
-std::array<float,2>{0.89889127f, 0.393650532f},
-std::array<float,2>{0.303592592f, 0.865189791f},
-std::array<float,2>{0.42299965f, 0.326388389f},
-std::array<float,2>{0.789632201f, 0.946462393f},
-std::array<float,2>{0.746545732f, 0.117915861f},
-std::array<float,2>{0.045191355f, 0.682680964f},
-std::array<float,2>{0.31497094f, 0.0205686856f},
-std::array<float,2>{0.955821097f, 0.718040645f},
-std::array<float,2>{0.559895277f, 0.278206617f},
-std::array<float,2>{0.138537332f, 0.917671859f},
-std::array<float,2>{0.123795554f, 0.485226721f},
-std::array<float,2>{0.664491415f, 0.811184645f},
-std::array<float,2>{0.82807225f, 0.215610132f},
-std::array<float,2>{0.441087514f, 0.572463095f},
-std::array<float,2>{0.00446607172f, 0.0912925303f},
-std::array<float,2>{0.692308903f, 0.649460912f},
-std::array<float,2>{0.768459201f, 0.346427083f},
-std::array<float,2>{0.399132192f, 0.975448728f},
-std::array<float,2>{0.28010276f, 0.429443806f},
-std::array<float,2>{0.919601083f, 0.81264019f},
-std::array<float,2>{0.574680388f, 0.166781545f},
-std::array<float,2>{0.196174428f, 0.547754705f},
-std::array<float,2>{0.498015255f, 0.245908871f},
-std::array<float,2>{0.851825714f, 0.604153156f},
-std::array<float,2>{0.630192816f, 0.444351047f},
-std::array<float,2>{0.0775127187f, 0.75105381f},
-std::array<float,2>{0.177929491f, 0.285749435f},
-std::array<float,2>{0.522360742f, 0.893929899f},
-std::array<float,2>{0.982174218f, 0.0413329713f},
-std::array<float,2>{0.359782279f, 0.733961761f},
-std::array<float,2>{0.0839355066f, 0.196000203f},
-std::array<float,2>{0.646499515f, 0.586056828f},
-std::array<float,2>{0.863498867f, 0.483984411f},
-std::array<float,2>{0.470723599f, 0.78374368f},
-std::array<float,2>{0.351240814f, 0.260329276f},
-std::array<float,2>{0.991192102f, 0.928713262f},
-std::array<float,2>{0.508255184f, 0.00421124138f},
-std::array<float,2>{0.159272984f, 0.700927794f},
-std::array<float,2>{0.382817358f, 0.108987808f},
-std::array<float,2>{0.7605111f, 0.66856271f},
-std::array<float,2>{0.712150037f, 0.328388035f},
-std::array<float,2>{0.0170754809f, 0.961214185f},
-std::array<float,2>{0.207178652f, 0.381905377f},
-std::array<float,2>{0.579288483f, 0.85104984f},
-std::array<float,2>{0.926118135f, 0.133106634f},
-std::array<float,2>{0.253546089f, 0.524386466f},
-std::array<float,2>{0.143353894f, 0.0585399494f},
-std::array<float,2>{0.544849873f, 0.741580784f},
-std::array<float,2>{0.941306055f, 0.312418222f},
-std::array<float,2>{0.333184063f, 0.88669163f},
-std::array<float,2>{0.45518747f, 0.464053214f},
-std::array<float,2>{0.833696008f, 0.779074192f},
-std::array<float,2>{0.673472285f, 0.231422707f},
-std::array<float,2>{0.0939740092f, 0.610695243f},
-std::array<float,2>{0.282081902f, 0.175018385f},
-std::array<float,2>{0.87508142f, 0.541416287f},
-std::array<float,2>{0.60452646f, 0.413187087f},
-std::array<float,2>{0.23941648f, 0.843666315f},
-std::array<float,2>{0.0506159775f, 0.369219005f},
-std::array<float,2>{0.722748101f, 0.990260124f},
-std::array<float,2>{0.80617559f, 0.0630617514f},
-std::array<float,2>{0.411941975f, 0.633542359f},
-std::array<float,2>{0.170097128f, 0.222691476f},
-std::array<float,2>{0.500186682f, 0.622044325f},
-std::array<float,2>{0.994110107f, 0.458550751f},
-std::array<float,2>{0.359158933f, 0.766664028f},
-std::array<float,2>{0.478783041f, 0.302196115f},
-std::array<float,2>{0.867966175f, 0.878340483f},
-std::array<float,2>{0.65033102f, 0.0474742763f},
-std::array<float,2>{0.0874436572f, 0.748126626f},
-std::array<float,2>{0.262172371f, 0.0763422623f},
-std::array<float,2>{0.93037051f, 0.632493913f},
-std::array<float,2>{0.587297797f, 0.365195513f},
-std::array<float,2>{0.216347516f, 0.998577893f},
-std::array<float,2>{0.0238068607f, 0.420380026f},
-std::array<float,2>{0.708413422f, 0.828731775f},
-std::array<float,2>{0.750610113f, 0.179910287f},
-std::array<float,2>{0.380773842f, 0.538964093f},
-std::array<float,2>{0.105500244f, 0.00871422142f},
-std::array<float,2>{0.680794716f, 0.693315208f},
-std::array<float,2>{0.837146044f, 0.254693538f},
-std::array<float,2>{0.463005751f, 0.932189047f},
-std::array<float,2>{0.341892242f, 0.47609973f},
-std::array<float,2>{0.949859083f, 0.795977175f},
-std::array<float,2>{0.535142601f, 0.190708116f},
-std::array<float,2>{0.150272191f, 0.584603846f},
-std::array<float,2>{0.41483283f, 0.127227128f},
-std::array<float,2>{0.802514434f, 0.52010107f},
-std::array<float,2>{0.733158469f, 0.386391819f},
-std::array<float,2>{0.0615269952f, 0.853445828f},
-std::array<float,2>{0.248934984f, 0.340005279f},
-std::array<float,2>{0.594733477f, 0.954120576f},
-std::array<float,2>{0.887491167f, 0.0945452675f},
-std::array<float,2>{0.294703007f, 0.65919888f},
-std::array<float,2>{0.0373139009f, 0.158914998f},
-std::array<float,2>{0.735312819f, 0.562278807f},
-std::array<float,2>{0.78544277f, 0.435067236f},
-std::array<float,2>{0.432445168f, 0.824921012f},
-std::array<float,2>{0.312167645f, 0.356098294f},
-std::array<float,2>{0.896839619f, 0.980247021f},
-std::array<float,2>{0.624607682f, 0.0847452879f},
-std::array<float,2>{0.228614271f, 0.642405212f},
-std::array<float,2>{0.452653468f, 0.0373921618f},
-std::array<float,2>{0.815066576f, 0.722229123f},
-std::array<float,2>{0.660242975f, 0.292441219f},
-std::array<float,2>{0.115567148f, 0.898518145f},
-std::array<float,2>{0.125268474f, 0.448494375f},
-std::array<float,2>{0.547424138f, 0.759753764f},
-std::array<float,2>{0.966468096f, 0.239464447f},
-std::array<float,2>{0.3252334f, 0.594719887f},
-std::array<float,2>{0.190015867f, 0.111714907f},
-std::array<float,2>{0.566531003f, 0.674934983f},
-std::array<float,2>{0.907023966f, 0.313835174f},
-std::array<float,2>{0.26814568f, 0.944999456f},
-std::array<float,2>{0.398124278f, 0.402602524f},
-std::array<float,2>{0.776386797f, 0.874343812f},
-std::array<float,2>{0.702691734f, 0.143089145f},
-std::array<float,2>{0.00899955444f, 0.513031662f},
-std::array<float,2>{0.369616508f, 0.203607619f},
-std::array<float,2>{0.973939955f, 0.570036471f},
-std::array<float,2>{0.529772878f, 0.499274731f},
-std::array<float,2>{0.179696679f, 0.801930189f},
-std::array<float,2>{0.0628516078f, 0.270977229f},
-std::array<float,2>{0.634806752f, 0.906477869f},
-std::array<float,2>{0.848986149f, 0.0242188293f},
-std::array<float,2>{0.48592791f, 0.703594923f},
-std::array<float,2>{0.172539085f, 0.129331008f},
-std::array<float,2>{0.517670691f, 0.51875633f},
-std::array<float,2>{0.977668345f, 0.388747722f},
-std::array<float,2>{0.363685369f, 0.857745588f},
-std::array<float,2>{0.494236946f, 0.338503659f},
-std::array<float,2>{0.859084129f, 0.95867455f},
-std::array<float,2>{0.627101183f, 0.100117505f},
-std::array<float,2>{0.0723857731f, 0.661040008f},
-std::array<float,2>{0.2743662f, 0.0123406444f},
-std::array<float,2>{0.917920172f, 0.690731764f},
-std::array<float,2>{0.572222769f, 0.251868635f},
-std::array<float,2>{0.202083498f, 0.936240435f},
-std::array<float,2>{0.00169858465f, 0.471236169f},
-std::array<float,2>{0.689766228f, 0.79129988f},
-std::array<float,2>{0.771389246f, 0.191665456f},
-std::array<float,2>{0.402701408f, 0.581088006f},
-std::array<float,2>{0.118365139f, 0.072454378f},
-std::array<float,2>{0.670984268f, 0.628163993f},
-std::array<float,2>{0.821385026f, 0.362837344f},
-std::array<float,2>{0.442869335f, 0.995387018f},
-std::array<float,2>{0.319650501f, 0.416672409f},
-std::array<float,2>{0.958359003f, 0.833543241f},
-std::array<float,2>{0.557318091f, 0.184141576f},
-std::array<float,2>{0.135987431f, 0.533361077f},
-std::array<float,2>{0.428742349f, 0.221501142f},
-std::array<float,2>{0.795728743f, 0.617943168f},
-std::array<float,2>{0.744468987f, 0.454246521f},
-std::array<float,2>{0.0400683619f, 0.772700131f},
-std::array<float,2>{0.219955459f, 0.298400789f},
-std::array<float,2>{0.611904919f, 0.881983697f},
-std::array<float,2>{0.904549301f, 0.054310862f},
-std::array<float,2>{0.297482491f, 0.744695842f},
-std::array<float,2>{0.0515183434f, 0.210336789f},
-std::array<float,2>{0.720146418f, 0.56466049f},
-std::array<float,2>{0.809782207f, 0.492864192f},
-std::array<float,2>{0.409095347f, 0.79726392f},
-std::array<float,2>{0.288970292f, 0.266991287f},
-std::array<float,2>{0.881565273f, 0.913981259f},
-std::array<float,2>{0.607730627f, 0.0285478737f},
-std::array<float,2>{0.235281125f, 0.709491372f},
-std::array<float,2>{0.457850784f, 0.114151254f},
-std::array<float,2>{0.831614733f, 0.676235914f},
-std::array<float,2>{0.676659882f, 0.320081264f},
-std::array<float,2>{0.0981648341f, 0.939233303f},
-std::array<float,2>{0.148243487f, 0.398456782f},
-std::array<float,2>{0.542756379f, 0.870008171f},
-std::array<float,2>{0.943885267f, 0.144591272f},
-std::array<float,2>{0.330520332f, 0.51139158f},
-std::array<float,2>{0.203999832f, 0.0350832269f},
-std::array<float,2>{0.583512664f, 0.725565672f},
-std::array<float,2>{0.924781144f, 0.296380818f},
-std::array<float,2>{0.254873842f, 0.90301913f},
-std::array<float,2>{0.387899071f, 0.451142371f},
-std::array<float,2>{0.762111604f, 0.763426125f},
-std::array<float,2>{0.71570915f, 0.236619756f},
-std::array<float,2>{0.0197591726f, 0.597825766f},
-std::array<float,2>{0.344036609f, 0.163076192f},
-std::array<float,2>{0.984649122f, 0.55639112f},
-std::array<float,2>{0.513073981f, 0.430303335f},
-std::array<float,2>{0.160946071f, 0.820631742f},
-std::array<float,2>{0.079633303f, 0.352244526f},
-std::array<float,2>{0.641093493f, 0.982433975f},
-std::array<float,2>{0.861888647f, 0.0795287043f},
-std::array<float,2>{0.473611742f, 0.645129263f},
-std::array<float,2>{0.243100882f, 0.24619171f},
-std::array<float,2>{0.60077703f, 0.607978344f},
-std::array<float,2>{0.884495854f, 0.440021753f},
-std::array<float,2>{0.292599052f, 0.754438877f},
-std::array<float,2>{0.419497848f, 0.284102678f},
-std::array<float,2>{0.800671399f, 0.895639598f},
-std::array<float,2>{0.730065107f, 0.0466675721f},
-std::array<float,2>{0.0579764023f, 0.730176747f},
-std::array<float,2>{0.335985452f, 0.0890620947f},
-std::array<float,2>{0.946241021f, 0.654625833f},
-std::array<float,2>{0.538584471f, 0.348607868f},
-std::array<float,2>{0.153650418f, 0.96996516f},
-std::array<float,2>{0.10406892f, 0.422604293f},
-std::array<float,2>{0.685587168f, 0.817585349f},
-std::array<float,2>{0.840233624f, 0.171734095f},
-std::array<float,2>{0.466501057f, 0.550808787f},
-std::array<float,2>{0.0294137839f, 0.0166915935f},
-std::array<float,2>{0.70420897f, 0.712866008f},
-std::array<float,2>{0.757188976f, 0.274888724f},
-std::array<float,2>{0.377073556f, 0.920401096f},
-std::array<float,2>{0.257985413f, 0.488398701f},
-std::array<float,2>{0.934042215f, 0.80767858f},
-std::array<float,2>{0.590683639f, 0.21439831f},
-std::array<float,2>{0.21429953f, 0.576470613f},
-std::array<float,2>{0.480723113f, 0.150249779f},
-std::array<float,2>{0.87376374f, 0.506389856f},
-std::array<float,2>{0.654540956f, 0.397853851f},
-std::array<float,2>{0.0908755735f, 0.863228083f},
-std::array<float,2>{0.166427538f, 0.322452217f},
-std::array<float,2>{0.506944835f, 0.95108515f},
-std::array<float,2>{0.997463524f, 0.124930501f},
-std::array<float,2>{0.352792352f, 0.685739517f},
-std::array<float,2>{0.0665542334f, 0.177059487f},
-std::array<float,2>{0.63814491f, 0.543426573f},
-std::array<float,2>{0.845100105f, 0.407851249f},
-std::array<float,2>{0.490494609f, 0.838501573f},
-std::array<float,2>{0.37240231f, 0.374118179f},
-std::array<float,2>{0.970329285f, 0.985661685f},
-std::array<float,2>{0.524227023f, 0.068678312f},
-std::array<float,2>{0.1844946f, 0.640165448f},
-std::array<float,2>{0.393543959f, 0.0595867559f},
-std::array<float,2>{0.77926594f, 0.737299204f},
-std::array<float,2>{0.696189582f, 0.304802358f},
-std::array<float,2>{0.0132872248f, 0.890462339f},
-std::array<float,2>{0.194399998f, 0.468380839f},
-std::array<float,2>{0.564329445f, 0.775668263f},
-std::array<float,2>{0.91147536f, 0.229959756f},
-std::array<float,2>{0.2703453f, 0.615833163f},
-std::array<float,2>{0.129735723f, 0.104285128f},
-std::array<float,2>{0.551957786f, 0.667735517f},
-std::array<float,2>{0.962241113f, 0.333380103f},
-std::array<float,2>{0.321460128f, 0.967634857f},
-std::array<float,2>{0.445575774f, 0.378381729f},
-std::array<float,2>{0.817158103f, 0.845739961f},
-std::array<float,2>{0.656591058f, 0.138394147f},
-std::array<float,2>{0.109632969f, 0.530154109f},
-std::array<float,2>{0.306903183f, 0.20138216f},
-std::array<float,2>{0.892515838f, 0.591259003f},
-std::array<float,2>{0.618726432f, 0.478470236f},
-std::array<float,2>{0.230505452f, 0.788137913f},
-std::array<float,2>{0.0344924107f, 0.264790654f},
-std::array<float,2>{0.739826381f, 0.92279315f},
-std::array<float,2>{0.781261921f, 0.00217559049f},
-std::array<float,2>{0.437444955f, 0.698858798f},
-std::array<float,2>{0.198956683f, 0.165105045f},
-std::array<float,2>{0.577551484f, 0.550130248f},
-std::array<float,2>{0.92167753f, 0.427364558f},
-std::array<float,2>{0.277673721f, 0.816184282f},
-std::array<float,2>{0.401728481f, 0.344692558f},
-std::array<float,2>{0.766885042f, 0.974281847f},
-std::array<float,2>{0.694022f, 0.0931694955f},
-std::array<float,2>{0.00755480723f, 0.650437593f},
-std::array<float,2>{0.362147242f, 0.0396941081f},
-std::array<float,2>{0.984163821f, 0.732398927f},
-std::array<float,2>{0.520129085f, 0.287777215f},
-std::array<float,2>{0.176548064f, 0.892492712f},
-std::array<float,2>{0.0744346753f, 0.44226253f},
-std::array<float,2>{0.631323934f, 0.753492236f},
-std::array<float,2>{0.854377568f, 0.243229464f},
-std::array<float,2>{0.499907792f, 0.602624714f},
-std::array<float,2>{0.0448098481f, 0.120013528f},
-std::array<float,2>{0.748939335f, 0.681009352f},
-std::array<float,2>{0.792436659f, 0.326121837f},
-std::array<float,2>{0.425383002f, 0.948576629f},
-std::array<float,2>{0.302364707f, 0.391708344f},
-std::array<float,2>{0.901102602f, 0.867173791f},
-std::array<float,2>{0.615848839f, 0.154112205f},
-std::array<float,2>{0.226179421f, 0.502056539f},
-std::array<float,2>{0.438156992f, 0.217393041f},
-std::array<float,2>{0.824510396f, 0.572034657f},
-std::array<float,2>{0.667690754f, 0.486807972f},
-std::array<float,2>{0.121569097f, 0.808696151f},
-std::array<float,2>{0.139030486f, 0.281199753f},
-std::array<float,2>{0.560758412f, 0.915453553f},
-std::array<float,2>{0.95453769f, 0.0219700988f},
-std::array<float,2>{0.314017922f, 0.715812802f},
-std::array<float,2>{0.0966839269f, 0.234189689f},
-std::array<float,2>{0.673925161f, 0.61147666f},
-std::array<float,2>{0.834694386f, 0.46207881f},
-std::array<float,2>{0.453283608f, 0.781158268f},
-std::array<float,2>{0.334188461f, 0.309610814f},
-std::array<float,2>{0.939000666f, 0.884411454f},
-std::array<float,2>{0.545435131f, 0.0557335205f},
-std::array<float,2>{0.141693547f, 0.740181088f},
-std::array<float,2>{0.413815767f, 0.0657538995f},
-std::array<float,2>{0.807336867f, 0.636068761f},
-std::array<float,2>{0.725370049f, 0.368849307f},
-std::array<float,2>{0.0471319519f, 0.990043879f},
-std::array<float,2>{0.241636574f, 0.410335749f},
-std::array<float,2>{0.602904737f, 0.841754675f},
-std::array<float,2>{0.877961636f, 0.173763901f},
-std::array<float,2>{0.283969611f, 0.53927207f},
-std::array<float,2>{0.156250417f, 0.00656337617f},
-std::array<float,2>{0.509872854f, 0.701445878f},
-std::array<float,2>{0.989785612f, 0.259663254f},
-std::array<float,2>{0.34926483f, 0.925859153f},
-std::array<float,2>{0.469009548f, 0.48148185f},
-std::array<float,2>{0.86547631f, 0.782023251f},
-std::array<float,2>{0.645113826f, 0.198688194f},
-std::array<float,2>{0.0853353366f, 0.588053286f},
-std::array<float,2>{0.251058996f, 0.135808393f},
-std::array<float,2>{0.928586245f, 0.52656889f},
-std::array<float,2>{0.580130816f, 0.380277187f},
-std::array<float,2>{0.210626408f, 0.849189162f},
-std::array<float,2>{0.0178449657f, 0.331353009f},
-std::array<float,2>{0.713688791f, 0.964750648f},
-std::array<float,2>{0.758607566f, 0.107132733f},
-std::array<float,2>{0.385286093f, 0.670915604f},
-std::array<float,2>{0.1506522f, 0.188984737f},
-std::array<float,2>{0.531649232f, 0.583297253f},
-std::array<float,2>{0.952956736f, 0.474524498f},
-std::array<float,2>{0.341761857f, 0.793727458f},
-std::array<float,2>{0.46154505f, 0.257247597f},
-std::array<float,2>{0.838028848f, 0.93119061f},
-std::array<float,2>{0.682736814f, 0.010654049f},
-std::array<float,2>{0.109051824f, 0.695130348f},
-std::array<float,2>{0.296487957f, 0.096356295f},
-std::array<float,2>{0.890329838f, 0.657683969f},
-std::array<float,2>{0.596080303f, 0.342025906f},
-std::array<float,2>{0.247589499f, 0.956100464f},
-std::array<float,2>{0.0594333932f, 0.383867055f},
-std::array<float,2>{0.7322855f, 0.853945255f},
-std::array<float,2>{0.802960277f, 0.125892445f},
-std::array<float,2>{0.41773054f, 0.522187233f},
-std::array<float,2>{0.0897396803f, 0.0495915599f},
-std::array<float,2>{0.651957095f, 0.748008192f},
-std::array<float,2>{0.870122492f, 0.303004295f},
-std::array<float,2>{0.477960885f, 0.87558639f},
-std::array<float,2>{0.357330948f, 0.459959537f},
-std::array<float,2>{0.995471895f, 0.769401312f},
-std::array<float,2>{0.503399849f, 0.225595042f},
-std::array<float,2>{0.169819579f, 0.624307156f},
-std::array<float,2>{0.382076025f, 0.182062015f},
-std::array<float,2>{0.75231421f, 0.536774457f},
-std::array<float,2>{0.709827363f, 0.418532163f},
-std::array<float,2>{0.0268218499f, 0.831218362f},
-std::array<float,2>{0.216991395f, 0.367131919f},
-std::array<float,2>{0.588110089f, 0.996969521f},
-std::array<float,2>{0.931682587f, 0.0750498399f},
-std::array<float,2>{0.265545458f, 0.629441082f},
-std::array<float,2>{0.01071053f, 0.142020404f},
-std::array<float,2>{0.701116681f, 0.514834225f},
-std::array<float,2>{0.775232255f, 0.404301465f},
-std::array<float,2>{0.395974487f, 0.871168733f},
-std::array<float,2>{0.267471224f, 0.315447271f},
-std::array<float,2>{0.909603596f, 0.942693532f},
-std::array<float,2>{0.569199085f, 0.110199325f},
-std::array<float,2>{0.188018158f, 0.67302376f},
-std::array<float,2>{0.486575305f, 0.0259168223f},
-std::array<float,2>{0.850691736f, 0.70591104f},
-std::array<float,2>{0.634484053f, 0.272338837f},
-std::array<float,2>{0.0647200942f, 0.908454359f},
-std::array<float,2>{0.183096424f, 0.497165918f},
-std::array<float,2>{0.529126406f, 0.804109156f},
-std::array<float,2>{0.975161135f, 0.207022473f},
-std::array<float,2>{0.369095713f, 0.566506028f},
-std::array<float,2>{0.228513002f, 0.0830557793f},
-std::array<float,2>{0.621312678f, 0.643017888f},
-std::array<float,2>{0.895768285f, 0.358434737f},
-std::array<float,2>{0.309489489f, 0.97838223f},
-std::array<float,2>{0.430604994f, 0.435571373f},
-std::array<float,2>{0.788351774f, 0.826243639f},
-std::array<float,2>{0.737777591f, 0.15817751f},
-std::array<float,2>{0.0365636051f, 0.559271693f},
-std::array<float,2>{0.327102542f, 0.241433263f},
-std::array<float,2>{0.966973424f, 0.597556531f},
-std::array<float,2>{0.550116897f, 0.446567088f},
-std::array<float,2>{0.127415925f, 0.759874642f},
-std::array<float,2>{0.113447979f, 0.290013433f},
-std::array<float,2>{0.66333276f, 0.901286781f},
-std::array<float,2>{0.81360954f, 0.036594145f},
-std::array<float,2>{0.449973345f, 0.718867779f}}
\ No newline at end of file
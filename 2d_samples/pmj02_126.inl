@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.97569865f, 0.963811338f},
-std::array<float,2>{0.191262662f, 0.0555629171f},
-std::array<float,2>{0.729028344f, 0.28951934f},
-std::array<float,2>{0.434507012f, 0.746509552f},
-std::array<float,2>{0.522271752f, 0.565193772f},
-std::array<float,2>{0.332491338f, 0.380276084f},
-std::array<float,2>{0.868010342f, 0.164394036f},
-std::array<float,2>{0.00916141365f, 0.776726305f},
-std::array<float,2>{0.782567799f, 0.649774551f},
-std::array<float,2>{0.115736134f, 0.318255424f},
-std::array<float,2>{0.572607338f, 0.117851093f},
-std::array<float,2>{0.295412868f, 0.877310932f},
-std::array<float,2>{0.67391181f, 0.847990215f},
-std::array<float,2>{0.484757692f, 0.202558294f},
-std::array<float,2>{0.904000223f, 0.472893387f},
-std::array<float,2>{0.149337068f, 0.555303395f},
-std::array<float,2>{0.81682837f, 0.794020772f},
-std::array<float,2>{0.045517616f, 0.153150007f},
-std::array<float,2>{0.559408903f, 0.4189744f},
-std::array<float,2>{0.350698441f, 0.614253581f},
-std::array<float,2>{0.689701974f, 0.704110444f},
-std::array<float,2>{0.375270545f, 0.255921185f},
-std::array<float,2>{0.945342064f, 0.0186390895f},
-std::array<float,2>{0.244999766f, 0.970519662f},
-std::array<float,2>{0.923108459f, 0.521149516f},
-std::array<float,2>{0.173816338f, 0.448380113f},
-std::array<float,2>{0.653452635f, 0.226070866f},
-std::array<float,2>{0.463249803f, 0.816856861f},
-std::array<float,2>{0.601105869f, 0.910112977f},
-std::array<float,2>{0.25030455f, 0.0937018692f},
-std::array<float,2>{0.750831187f, 0.371031106f},
-std::array<float,2>{0.0902377144f, 0.674302161f},
-std::array<float,2>{0.88044405f, 0.83560729f},
-std::array<float,2>{0.131759658f, 0.240897924f},
-std::array<float,2>{0.657337129f, 0.465727657f},
-std::array<float,2>{0.48271361f, 0.512776375f},
-std::array<float,2>{0.593280673f, 0.663018107f},
-std::array<float,2>{0.307210982f, 0.347119927f},
-std::array<float,2>{0.80408746f, 0.0773950517f},
-std::array<float,2>{0.100009531f, 0.929632127f},
-std::array<float,2>{0.848736644f, 0.598975539f},
-std::array<float,2>{0.0296997968f, 0.435843796f},
-std::array<float,2>{0.50568819f, 0.130432472f},
-std::array<float,2>{0.320969343f, 0.804511607f},
-std::array<float,2>{0.741256118f, 0.995374858f},
-std::array<float,2>{0.406407714f, 0.00161355012f},
-std::array<float,2>{0.993083656f, 0.269607902f},
-std::array<float,2>{0.216251612f, 0.698188901f},
-std::array<float,2>{0.774439096f, 0.897858977f},
-std::array<float,2>{0.0714274719f, 0.102725491f},
-std::array<float,2>{0.619495392f, 0.342869252f},
-std::array<float,2>{0.275082737f, 0.635632396f},
-std::array<float,2>{0.630159259f, 0.540218294f},
-std::array<float,2>{0.443350762f, 0.489611387f},
-std::array<float,2>{0.921435952f, 0.20896554f},
-std::array<float,2>{0.166259512f, 0.860205889f},
-std::array<float,2>{0.954200447f, 0.730276763f},
-std::array<float,2>{0.231559604f, 0.306691945f},
-std::array<float,2>{0.708000124f, 0.0377736613f},
-std::array<float,2>{0.404481769f, 0.941735685f},
-std::array<float,2>{0.543521404f, 0.758134961f},
-std::array<float,2>{0.371032596f, 0.183445781f},
-std::array<float,2>{0.839366198f, 0.404740244f},
-std::array<float,2>{0.0475434102f, 0.590753198f},
-std::array<float,2>{0.908988953f, 0.932236969f},
-std::array<float,2>{0.158184573f, 0.0644861907f},
-std::array<float,2>{0.638539672f, 0.356543779f},
-std::array<float,2>{0.451069176f, 0.665189624f},
-std::array<float,2>{0.611368299f, 0.50606972f},
-std::array<float,2>{0.270537376f, 0.455106109f},
-std::array<float,2>{0.767974615f, 0.243844301f},
-std::array<float,2>{0.0672253966f, 0.839236319f},
-std::array<float,2>{0.832912505f, 0.690517783f},
-std::array<float,2>{0.0569756813f, 0.277278394f},
-std::array<float,2>{0.536314607f, 0.0144167291f},
-std::array<float,2>{0.366275221f, 0.985392392f},
-std::array<float,2>{0.712936401f, 0.809063017f},
-std::array<float,2>{0.391875744f, 0.13660875f},
-std::array<float,2>{0.965484202f, 0.425632566f},
-std::array<float,2>{0.225439653f, 0.605391443f},
-std::array<float,2>{0.808467269f, 0.873936296f},
-std::array<float,2>{0.107077509f, 0.217769131f},
-std::array<float,2>{0.585820436f, 0.498948783f},
-std::array<float,2>{0.302783012f, 0.537216544f},
-std::array<float,2>{0.668111384f, 0.627158344f},
-std::array<float,2>{0.475529909f, 0.330326021f},
-std::array<float,2>{0.884867668f, 0.0983598307f},
-std::array<float,2>{0.136570871f, 0.899234831f},
-std::array<float,2>{0.990778565f, 0.582928658f},
-std::array<float,2>{0.205621153f, 0.39253512f},
-std::array<float,2>{0.744384408f, 0.178320065f},
-std::array<float,2>{0.416155547f, 0.754514575f},
-std::array<float,2>{0.509699285f, 0.952479124f},
-std::array<float,2>{0.318471134f, 0.0441449098f},
-std::array<float,2>{0.856634021f, 0.299683094f},
-std::array<float,2>{0.0230863523f, 0.720525563f},
-std::array<float,2>{0.942768931f, 0.770445704f},
-std::array<float,2>{0.235924557f, 0.163644597f},
-std::array<float,2>{0.695583522f, 0.390095502f},
-std::array<float,2>{0.387653291f, 0.572790802f},
-std::array<float,2>{0.547005653f, 0.740615368f},
-std::array<float,2>{0.352246642f, 0.281634033f},
-std::array<float,2>{0.822778881f, 0.0523668155f},
-std::array<float,2>{0.038422659f, 0.954039931f},
-std::array<float,2>{0.76555109f, 0.550564766f},
-std::array<float,2>{0.084140636f, 0.478552938f},
-std::array<float,2>{0.606282651f, 0.189911142f},
-std::array<float,2>{0.26139155f, 0.852768481f},
-std::array<float,2>{0.644934952f, 0.889233291f},
-std::array<float,2>{0.46070227f, 0.113685802f},
-std::array<float,2>{0.9362849f, 0.3216362f},
-std::array<float,2>{0.184523031f, 0.645911157f},
-std::array<float,2>{0.862600923f, 0.981583118f},
-std::array<float,2>{0.000215096981f, 0.0254675355f},
-std::array<float,2>{0.523500264f, 0.263146698f},
-std::array<float,2>{0.339070171f, 0.711763918f},
-std::array<float,2>{0.72181952f, 0.62107873f},
-std::array<float,2>{0.42530027f, 0.409646839f},
-std::array<float,2>{0.978758693f, 0.143054724f},
-std::array<float,2>{0.196963042f, 0.787819862f},
-std::array<float,2>{0.895081043f, 0.682494164f},
-std::array<float,2>{0.141037673f, 0.367020011f},
-std::array<float,2>{0.686093926f, 0.0858827829f},
-std::array<float,2>{0.496218234f, 0.917910635f},
-std::array<float,2>{0.566782236f, 0.822953701f},
-std::array<float,2>{0.287872165f, 0.227975726f},
-std::array<float,2>{0.796259403f, 0.439844549f},
-std::array<float,2>{0.124095917f, 0.529742539f},
-std::array<float,2>{0.964596093f, 0.881044745f},
-std::array<float,2>{0.218954831f, 0.123873062f},
-std::array<float,2>{0.715134084f, 0.313883632f},
-std::array<float,2>{0.398124367f, 0.654453814f},
-std::array<float,2>{0.534375072f, 0.562128782f},
-std::array<float,2>{0.363259315f, 0.471914053f},
-std::array<float,2>{0.831938326f, 0.196627498f},
-std::array<float,2>{0.0593617484f, 0.84516263f},
-std::array<float,2>{0.769590199f, 0.744981349f},
-std::array<float,2>{0.0630026534f, 0.294569284f},
-std::array<float,2>{0.614700556f, 0.0613806508f},
-std::array<float,2>{0.267690212f, 0.96770364f},
-std::array<float,2>{0.635787487f, 0.779720724f},
-std::array<float,2>{0.446189255f, 0.169539526f},
-std::array<float,2>{0.91317153f, 0.376526475f},
-std::array<float,2>{0.162472978f, 0.566835821f},
-std::array<float,2>{0.853114486f, 0.813159347f},
-std::array<float,2>{0.0172871295f, 0.220844015f},
-std::array<float,2>{0.514256954f, 0.452755094f},
-std::array<float,2>{0.313518852f, 0.515667319f},
-std::array<float,2>{0.749594152f, 0.678157568f},
-std::array<float,2>{0.419826537f, 0.371667445f},
-std::array<float,2>{0.985432982f, 0.0870936587f},
-std::array<float,2>{0.207597479f, 0.912773073f},
-std::array<float,2>{0.888529778f, 0.611854315f},
-std::array<float,2>{0.140082508f, 0.416640013f},
-std::array<float,2>{0.665515959f, 0.14930515f},
-std::array<float,2>{0.469966441f, 0.791875064f},
-std::array<float,2>{0.581323922f, 0.976345778f},
-std::array<float,2>{0.297090471f, 0.0212485045f},
-std::array<float,2>{0.810271323f, 0.25074923f},
-std::array<float,2>{0.102093264f, 0.709246814f},
-std::array<float,2>{0.932515979f, 0.800437212f},
-std::array<float,2>{0.182744443f, 0.125764012f},
-std::array<float,2>{0.641936481f, 0.433383435f},
-std::array<float,2>{0.454543322f, 0.593887627f},
-std::array<float,2>{0.605141282f, 0.701536715f},
-std::array<float,2>{0.264891803f, 0.265989721f},
-std::array<float,2>{0.759231925f, 0.00497241644f},
-std::array<float,2>{0.0799206421f, 0.997864068f},
-std::array<float,2>{0.825154662f, 0.510652184f},
-std::array<float,2>{0.031422846f, 0.461861223f},
-std::array<float,2>{0.550954103f, 0.235071927f},
-std::array<float,2>{0.358883977f, 0.831693769f},
-std::array<float,2>{0.702806532f, 0.922249019f},
-std::array<float,2>{0.384628385f, 0.07158494f},
-std::array<float,2>{0.939206541f, 0.348355979f},
-std::array<float,2>{0.241254523f, 0.658519387f},
-std::array<float,2>{0.789822519f, 0.93756938f},
-std::array<float,2>{0.120914467f, 0.0325535834f},
-std::array<float,2>{0.564343691f, 0.308649123f},
-std::array<float,2>{0.282430977f, 0.733260751f},
-std::array<float,2>{0.682115555f, 0.588521838f},
-std::array<float,2>{0.495004177f, 0.401131719f},
-std::array<float,2>{0.894519985f, 0.186395824f},
-std::array<float,2>{0.147384226f, 0.765191317f},
-std::array<float,2>{0.982503891f, 0.640301764f},
-std::array<float,2>{0.200685695f, 0.337508887f},
-std::array<float,2>{0.723556161f, 0.107486315f},
-std::array<float,2>{0.429400355f, 0.89109695f},
-std::array<float,2>{0.527671039f, 0.86363256f},
-std::array<float,2>{0.341914505f, 0.204309061f},
-std::array<float,2>{0.863537073f, 0.487769097f},
-std::array<float,2>{0.00636574812f, 0.546230316f},
-std::array<float,2>{0.902337909f, 0.989909112f},
-std::array<float,2>{0.153943181f, 0.0103943618f},
-std::array<float,2>{0.676854908f, 0.279871851f},
-std::array<float,2>{0.491017908f, 0.692471564f},
-std::array<float,2>{0.576721072f, 0.607217014f},
-std::array<float,2>{0.289539039f, 0.429472238f},
-std::array<float,2>{0.787740052f, 0.136980534f},
-std::array<float,2>{0.110411339f, 0.807547987f},
-std::array<float,2>{0.874705493f, 0.669763088f},
-std::array<float,2>{0.0118366936f, 0.351802319f},
-std::array<float,2>{0.518215239f, 0.0669740513f},
-std::array<float,2>{0.329571366f, 0.93572104f},
-std::array<float,2>{0.73237735f, 0.841997206f},
-std::array<float,2>{0.431068838f, 0.249078348f},
-std::array<float,2>{0.9688375f, 0.45819068f},
-std::array<float,2>{0.192079812f, 0.50385195f},
-std::array<float,2>{0.756028652f, 0.750739872f},
-std::array<float,2>{0.0893324018f, 0.175702348f},
-std::array<float,2>{0.59389776f, 0.397698581f},
-std::array<float,2>{0.25525409f, 0.579349279f},
-std::array<float,2>{0.651691079f, 0.724135339f},
-std::array<float,2>{0.466026843f, 0.301924735f},
-std::array<float,2>{0.928272307f, 0.040756952f},
-std::array<float,2>{0.177688718f, 0.946455419f},
-std::array<float,2>{0.951325536f, 0.533866048f},
-std::array<float,2>{0.247820809f, 0.49277091f},
-std::array<float,2>{0.692485511f, 0.210979134f},
-std::array<float,2>{0.381724685f, 0.868389726f},
-std::array<float,2>{0.556125522f, 0.906153619f},
-std::array<float,2>{0.344108403f, 0.0972107798f},
-std::array<float,2>{0.815425456f, 0.332132697f},
-std::array<float,2>{0.0403349176f, 0.630474746f},
-std::array<float,2>{0.997042418f, 0.858129144f},
-std::array<float,2>{0.214245692f, 0.19429265f},
-std::array<float,2>{0.737348318f, 0.481591135f},
-std::array<float,2>{0.410426855f, 0.552364528f},
-std::array<float,2>{0.502486467f, 0.642219186f},
-std::array<float,2>{0.327401876f, 0.324886978f},
-std::array<float,2>{0.844983935f, 0.111308299f},
-std::array<float,2>{0.0247485824f, 0.885932982f},
-std::array<float,2>{0.799835861f, 0.575886607f},
-std::array<float,2>{0.0950755626f, 0.383643031f},
-std::array<float,2>{0.588541865f, 0.156610101f},
-std::array<float,2>{0.312366486f, 0.769199371f},
-std::array<float,2>{0.661282003f, 0.959363937f},
-std::array<float,2>{0.479195774f, 0.0475715511f},
-std::array<float,2>{0.876608431f, 0.288783848f},
-std::array<float,2>{0.125409752f, 0.735448837f},
-std::array<float,2>{0.842533708f, 0.918759525f},
-std::array<float,2>{0.0512687303f, 0.079113856f},
-std::array<float,2>{0.539949298f, 0.360175192f},
-std::array<float,2>{0.373865485f, 0.68415159f},
-std::array<float,2>{0.705531657f, 0.524414659f},
-std::array<float,2>{0.400258452f, 0.445123345f},
-std::array<float,2>{0.957240105f, 0.233280823f},
-std::array<float,2>{0.230379537f, 0.827536404f},
-std::array<float,2>{0.916776836f, 0.716377139f},
-std::array<float,2>{0.171721607f, 0.258611739f},
-std::array<float,2>{0.625110745f, 0.0290716514f},
-std::array<float,2>{0.438108891f, 0.976790845f},
-std::array<float,2>{0.621821463f, 0.784797966f},
-std::array<float,2>{0.280321091f, 0.146531478f},
-std::array<float,2>{0.777539313f, 0.413720787f},
-std::array<float,2>{0.0775012523f, 0.621750355f},
-std::array<float,2>{0.947351933f, 0.971786618f},
-std::array<float,2>{0.242441475f, 0.0173601639f},
-std::array<float,2>{0.689110637f, 0.254295796f},
-std::array<float,2>{0.378232539f, 0.706778765f},
-std::array<float,2>{0.562236428f, 0.615711272f},
-std::array<float,2>{0.348249972f, 0.421661675f},
-std::array<float,2>{0.818506002f, 0.156112209f},
-std::array<float,2>{0.0445358083f, 0.796869636f},
-std::array<float,2>{0.753116548f, 0.67308104f},
-std::array<float,2>{0.0928322449f, 0.367393047f},
-std::array<float,2>{0.599353075f, 0.0899695233f},
-std::array<float,2>{0.252644658f, 0.907001913f},
-std::array<float,2>{0.65480262f, 0.820308864f},
-std::array<float,2>{0.46207574f, 0.223931879f},
-std::array<float,2>{0.924647391f, 0.445330918f},
-std::array<float,2>{0.173856661f, 0.52151382f},
-std::array<float,2>{0.869634688f, 0.774906695f},
-std::array<float,2>{0.01023426f, 0.167426273f},
-std::array<float,2>{0.51975888f, 0.381376892f},
-std::array<float,2>{0.335713893f, 0.562908471f},
-std::array<float,2>{0.727701187f, 0.749034345f},
-std::array<float,2>{0.435959905f, 0.291685969f},
-std::array<float,2>{0.972866714f, 0.0568287224f},
-std::array<float,2>{0.188604742f, 0.961250365f},
-std::array<float,2>{0.905566514f, 0.557957649f},
-std::array<float,2>{0.151253134f, 0.474791735f},
-std::array<float,2>{0.673778176f, 0.200007826f},
-std::array<float,2>{0.488193303f, 0.850052536f},
-std::array<float,2>{0.572196722f, 0.876270771f},
-std::array<float,2>{0.294321239f, 0.11945872f},
-std::array<float,2>{0.783976555f, 0.318387598f},
-std::array<float,2>{0.115005568f, 0.650496542f},
-std::array<float,2>{0.919744074f, 0.862631679f},
-std::array<float,2>{0.164111525f, 0.210858822f},
-std::array<float,2>{0.632640243f, 0.490968615f},
-std::array<float,2>{0.444513559f, 0.541396081f},
-std::array<float,2>{0.617824435f, 0.634074986f},
-std::array<float,2>{0.27617985f, 0.340687662f},
-std::array<float,2>{0.777022958f, 0.10379383f},
-std::array<float,2>{0.0723543391f, 0.896359861f},
-std::array<float,2>{0.836506605f, 0.59336108f},
-std::array<float,2>{0.0503886566f, 0.402475774f},
-std::array<float,2>{0.544999361f, 0.180696756f},
-std::array<float,2>{0.368140906f, 0.76118958f},
-std::array<float,2>{0.709727407f, 0.945198715f},
-std::array<float,2>{0.403582335f, 0.0369210467f},
-std::array<float,2>{0.955623925f, 0.306262016f},
-std::array<float,2>{0.234372944f, 0.727375627f},
-std::array<float,2>{0.802580595f, 0.925946593f},
-std::array<float,2>{0.0983033255f, 0.0761309862f},
-std::array<float,2>{0.590742409f, 0.345022321f},
-std::array<float,2>{0.3058002f, 0.660524487f},
-std::array<float,2>{0.659669697f, 0.514371812f},
-std::array<float,2>{0.480777383f, 0.468113512f},
-std::array<float,2>{0.881771743f, 0.2392634f},
-std::array<float,2>{0.130718455f, 0.833589673f},
-std::array<float,2>{0.995960176f, 0.696274757f},
-std::array<float,2>{0.21863091f, 0.271744072f},
-std::array<float,2>{0.738365829f, 0.00361484685f},
-std::array<float,2>{0.409888625f, 0.993812501f},
-std::array<float,2>{0.506168008f, 0.802321792f},
-std::array<float,2>{0.3232117f, 0.131205589f},
-std::array<float,2>{0.850695848f, 0.433713138f},
-std::array<float,2>{0.0279644039f, 0.600300968f},
-std::array<float,2>{0.883905053f, 0.902115822f},
-std::array<float,2>{0.13407284f, 0.10079778f},
-std::array<float,2>{0.670892358f, 0.32852605f},
-std::array<float,2>{0.473462343f, 0.625732839f},
-std::array<float,2>{0.583821118f, 0.537025154f},
-std::array<float,2>{0.301361918f, 0.496372312f},
-std::array<float,2>{0.805582106f, 0.216078892f},
-std::array<float,2>{0.107559986f, 0.871720016f},
-std::array<float,2>{0.858852744f, 0.720969081f},
-std::array<float,2>{0.0201531071f, 0.297748595f},
-std::array<float,2>{0.510451257f, 0.0457386449f},
-std::array<float,2>{0.317676395f, 0.950150251f},
-std::array<float,2>{0.742581666f, 0.75707525f},
-std::array<float,2>{0.415304124f, 0.176078945f},
-std::array<float,2>{0.98828423f, 0.393511415f},
-std::array<float,2>{0.203517914f, 0.58440572f},
-std::array<float,2>{0.767335773f, 0.835975826f},
-std::array<float,2>{0.0696745664f, 0.24416253f},
-std::array<float,2>{0.611151695f, 0.453199059f},
-std::array<float,2>{0.271804512f, 0.505400181f},
-std::array<float,2>{0.640248239f, 0.667597234f},
-std::array<float,2>{0.451841831f, 0.358848214f},
-std::array<float,2>{0.906987846f, 0.0644481033f},
-std::array<float,2>{0.160145178f, 0.92995733f},
-std::array<float,2>{0.967043936f, 0.60193634f},
-std::array<float,2>{0.223966435f, 0.422207057f},
-std::array<float,2>{0.711972594f, 0.134116292f},
-std::array<float,2>{0.39369601f, 0.810592175f},
-std::array<float,2>{0.537837386f, 0.986789405f},
-std::array<float,2>{0.363602817f, 0.0118420823f},
-std::array<float,2>{0.83552295f, 0.275263518f},
-std::array<float,2>{0.0558404922f, 0.687931895f},
-std::array<float,2>{0.977767408f, 0.785437346f},
-std::array<float,2>{0.197400928f, 0.14123407f},
-std::array<float,2>{0.720540226f, 0.407650113f},
-std::array<float,2>{0.423036575f, 0.618843734f},
-std::array<float,2>{0.526215315f, 0.71366328f},
-std::array<float,2>{0.336277813f, 0.26408869f},
-std::array<float,2>{0.860492051f, 0.0248745009f},
-std::array<float,2>{0.00359610352f, 0.984338284f},
-std::array<float,2>{0.793542385f, 0.528414428f},
-std::array<float,2>{0.122770987f, 0.438986331f},
-std::array<float,2>{0.569244444f, 0.228614628f},
-std::array<float,2>{0.28599447f, 0.820928156f},
-std::array<float,2>{0.684652448f, 0.915789664f},
-std::array<float,2>{0.499227792f, 0.0827697292f},
-std::array<float,2>{0.896972239f, 0.364727944f},
-std::array<float,2>{0.142886564f, 0.681311846f},
-std::array<float,2>{0.820561826f, 0.955128074f},
-std::array<float,2>{0.0365976654f, 0.0544659123f},
-std::array<float,2>{0.550506055f, 0.283371419f},
-std::array<float,2>{0.354416579f, 0.738816619f},
-std::array<float,2>{0.698820472f, 0.572185993f},
-std::array<float,2>{0.388753951f, 0.388516843f},
-std::array<float,2>{0.945249915f, 0.160324633f},
-std::array<float,2>{0.237316072f, 0.772374928f},
-std::array<float,2>{0.934461892f, 0.647705376f},
-std::array<float,2>{0.187134445f, 0.323292941f},
-std::array<float,2>{0.648146331f, 0.116315819f},
-std::array<float,2>{0.457267046f, 0.887395322f},
-std::array<float,2>{0.607574284f, 0.855212033f},
-std::array<float,2>{0.259633809f, 0.187964469f},
-std::array<float,2>{0.763186514f, 0.477598697f},
-std::array<float,2>{0.082492426f, 0.547942817f},
-std::array<float,2>{0.987613797f, 0.910596907f},
-std::array<float,2>{0.210383877f, 0.0893083364f},
-std::array<float,2>{0.746789396f, 0.374618739f},
-std::array<float,2>{0.421773434f, 0.675928712f},
-std::array<float,2>{0.512847781f, 0.519485474f},
-std::array<float,2>{0.315460026f, 0.450410903f},
-std::array<float,2>{0.854553699f, 0.2191526f},
-std::array<float,2>{0.0191062745f, 0.814840674f},
-std::array<float,2>{0.812496483f, 0.707651258f},
-std::array<float,2>{0.104809694f, 0.25352633f},
-std::array<float,2>{0.579490244f, 0.0217714608f},
-std::array<float,2>{0.298990041f, 0.972875834f},
-std::array<float,2>{0.667775691f, 0.789514244f},
-std::array<float,2>{0.471782923f, 0.151392102f},
-std::array<float,2>{0.889530599f, 0.415886849f},
-std::array<float,2>{0.137586519f, 0.610175014f},
-std::array<float,2>{0.82994765f, 0.847543657f},
-std::array<float,2>{0.0616501197f, 0.197580814f},
-std::array<float,2>{0.531631589f, 0.469626755f},
-std::array<float,2>{0.36110571f, 0.560509145f},
-std::array<float,2>{0.718319595f, 0.653304696f},
-std::array<float,2>{0.395060599f, 0.31624943f},
-std::array<float,2>{0.962519944f, 0.121469602f},
-std::array<float,2>{0.222103f, 0.880668163f},
-std::array<float,2>{0.911412716f, 0.569297791f},
-std::array<float,2>{0.162037089f, 0.378215492f},
-std::array<float,2>{0.634271324f, 0.170875862f},
-std::array<float,2>{0.448962033f, 0.778687656f},
-std::array<float,2>{0.617102861f, 0.965418398f},
-std::array<float,2>{0.2656596f, 0.0596383214f},
-std::array<float,2>{0.772558689f, 0.296368986f},
-std::array<float,2>{0.0661475658f, 0.742487669f},
-std::array<float,2>{0.890843868f, 0.762719572f},
-std::array<float,2>{0.145713463f, 0.183782503f},
-std::array<float,2>{0.680346727f, 0.398615032f},
-std::array<float,2>{0.493850499f, 0.586389601f},
-std::array<float,2>{0.564535141f, 0.732103109f},
-std::array<float,2>{0.283856004f, 0.312140226f},
-std::array<float,2>{0.792358875f, 0.0343515389f},
-std::array<float,2>{0.11732053f, 0.939828336f},
-std::array<float,2>{0.866315782f, 0.543993652f},
-std::array<float,2>{0.00513000693f, 0.484441131f},
-std::array<float,2>{0.531041861f, 0.205805242f},
-std::array<float,2>{0.340803653f, 0.866199136f},
-std::array<float,2>{0.725989223f, 0.893853962f},
-std::array<float,2>{0.426636487f, 0.106992133f},
-std::array<float,2>{0.98096323f, 0.339627057f},
-std::array<float,2>{0.202420846f, 0.638640344f},
-std::array<float,2>{0.761697888f, 0.998641193f},
-std::array<float,2>{0.0808559507f, 0.0077967369f},
-std::array<float,2>{0.602482438f, 0.269368738f},
-std::array<float,2>{0.262278169f, 0.699251235f},
-std::array<float,2>{0.642666578f, 0.596574426f},
-std::array<float,2>{0.455682069f, 0.431445301f},
-std::array<float,2>{0.930121243f, 0.127128407f},
-std::array<float,2>{0.181454703f, 0.797128975f},
-std::array<float,2>{0.940449178f, 0.658159316f},
-std::array<float,2>{0.23833479f, 0.351486057f},
-std::array<float,2>{0.700349569f, 0.0736126974f},
-std::array<float,2>{0.385171622f, 0.923889816f},
-std::array<float,2>{0.554533362f, 0.829512835f},
-std::array<float,2>{0.355687261f, 0.237357378f},
-std::array<float,2>{0.826823235f, 0.463028461f},
-std::array<float,2>{0.0342763104f, 0.508215308f},
-std::array<float,2>{0.926361144f, 0.94827354f},
-std::array<float,2>{0.179389477f, 0.0417820327f},
-std::array<float,2>{0.649494827f, 0.303959578f},
-std::array<float,2>{0.468254954f, 0.725927591f},
-std::array<float,2>{0.597636759f, 0.58158952f},
-std::array<float,2>{0.256515563f, 0.395548642f},
-std::array<float,2>{0.755535662f, 0.173808545f},
-std::array<float,2>{0.086215876f, 0.753807008f},
-std::array<float,2>{0.814091802f, 0.631180584f},
-std::array<float,2>{0.0415291749f, 0.334953547f},
-std::array<float,2>{0.558358431f, 0.0951877534f},
-std::array<float,2>{0.347157538f, 0.904183507f},
-std::array<float,2>{0.693744659f, 0.869360089f},
-std::array<float,2>{0.379178554f, 0.2146952f},
-std::array<float,2>{0.950467706f, 0.495048404f},
-std::array<float,2>{0.249448642f, 0.532544672f},
-std::array<float,2>{0.786929429f, 0.805427134f},
-std::array<float,2>{0.112837777f, 0.138937488f},
-std::array<float,2>{0.575588048f, 0.427537918f},
-std::array<float,2>{0.291317552f, 0.608668506f},
-std::array<float,2>{0.678485155f, 0.695157468f},
-std::array<float,2>{0.489482611f, 0.277441353f},
-std::array<float,2>{0.899282813f, 0.00900484994f},
-std::array<float,2>{0.154690415f, 0.990505457f},
-std::array<float,2>{0.972306132f, 0.501652658f},
-std::array<float,2>{0.194480285f, 0.459705174f},
-std::array<float,2>{0.732650101f, 0.247336239f},
-std::array<float,2>{0.432384133f, 0.840719044f},
-std::array<float,2>{0.516215622f, 0.934985399f},
-std::array<float,2>{0.330394536f, 0.0690116584f},
-std::array<float,2>{0.872479618f, 0.354183793f},
-std::array<float,2>{0.0143665606f, 0.671177268f},
-std::array<float,2>{0.959975481f, 0.825584114f},
-std::array<float,2>{0.228359759f, 0.230803192f},
-std::array<float,2>{0.704225659f, 0.442090362f},
-std::array<float,2>{0.40039739f, 0.526110232f},
-std::array<float,2>{0.541253746f, 0.686523378f},
-std::array<float,2>{0.372648507f, 0.361415982f},
-std::array<float,2>{0.840916395f, 0.080538772f},
-std::array<float,2>{0.0537249483f, 0.921338975f},
-std::array<float,2>{0.780192673f, 0.624847114f},
-std::array<float,2>{0.0749081746f, 0.411539644f},
-std::array<float,2>{0.624015152f, 0.145199418f},
-std::array<float,2>{0.278863639f, 0.781392395f},
-std::array<float,2>{0.627999246f, 0.9789415f},
-std::array<float,2>{0.440793693f, 0.0299816113f},
-std::array<float,2>{0.914454401f, 0.260977626f},
-std::array<float,2>{0.168109372f, 0.718672216f},
-std::array<float,2>{0.847118676f, 0.882931113f},
-std::array<float,2>{0.0267205164f, 0.112965323f},
-std::array<float,2>{0.501110256f, 0.327382624f},
-std::array<float,2>{0.325801551f, 0.64309001f},
-std::array<float,2>{0.734747469f, 0.554560125f},
-std::array<float,2>{0.412331223f, 0.483829439f},
-std::array<float,2>{0.999910414f, 0.193345323f},
-std::array<float,2>{0.212098256f, 0.856948376f},
-std::array<float,2>{0.87756151f, 0.737402499f},
-std::array<float,2>{0.127502993f, 0.285802543f},
-std::array<float,2>{0.662466168f, 0.048849456f},
-std::array<float,2>{0.477792919f, 0.957441449f},
-std::array<float,2>{0.58753556f, 0.767015457f},
-std::array<float,2>{0.310011268f, 0.159595355f},
-std::array<float,2>{0.797724307f, 0.385715544f},
-std::array<float,2>{0.097487323f, 0.576987445f},
-std::array<float,2>{0.9933936f, 0.993000329f},
-std::array<float,2>{0.215480268f, 0.00221235212f},
-std::array<float,2>{0.740409553f, 0.272580981f},
-std::array<float,2>{0.407728612f, 0.696344256f},
-std::array<float,2>{0.504334211f, 0.600734591f},
-std::array<float,2>{0.321384013f, 0.435424298f},
-std::array<float,2>{0.848306239f, 0.132229701f},
-std::array<float,2>{0.0304668341f, 0.801518619f},
-std::array<float,2>{0.803470552f, 0.66174382f},
-std::array<float,2>{0.101182036f, 0.344216496f},
-std::array<float,2>{0.592232525f, 0.0749906823f},
-std::array<float,2>{0.308338523f, 0.927057385f},
-std::array<float,2>{0.656648815f, 0.832343698f},
-std::array<float,2>{0.484028876f, 0.238561615f},
-std::array<float,2>{0.879628599f, 0.467697352f},
-std::array<float,2>{0.132162005f, 0.515607059f},
-std::array<float,2>{0.838012218f, 0.760470688f},
-std::array<float,2>{0.0484226346f, 0.180157423f},
-std::array<float,2>{0.544160128f, 0.403329939f},
-std::array<float,2>{0.369682968f, 0.59198606f},
-std::array<float,2>{0.708121955f, 0.727553725f},
-std::array<float,2>{0.405939937f, 0.305585057f},
-std::array<float,2>{0.95332396f, 0.0359410383f},
-std::array<float,2>{0.230783835f, 0.943987191f},
-std::array<float,2>{0.920619965f, 0.542047143f},
-std::array<float,2>{0.167303875f, 0.491565883f},
-std::array<float,2>{0.629075229f, 0.209935233f},
-std::array<float,2>{0.441938043f, 0.862263501f},
-std::array<float,2>{0.620473087f, 0.895201564f},
-std::array<float,2>{0.274070561f, 0.104625449f},
-std::array<float,2>{0.773934424f, 0.341649711f},
-std::array<float,2>{0.0706370994f, 0.633268476f},
-std::array<float,2>{0.902956903f, 0.850884199f},
-std::array<float,2>{0.150022119f, 0.200998589f},
-std::array<float,2>{0.675173879f, 0.475709319f},
-std::array<float,2>{0.485945791f, 0.55718565f},
-std::array<float,2>{0.573244333f, 0.651577711f},
-std::array<float,2>{0.296336293f, 0.319800943f},
-std::array<float,2>{0.78134042f, 0.120261975f},
-std::array<float,2>{0.116812162f, 0.87558949f},
-std::array<float,2>{0.868740082f, 0.564264596f},
-std::array<float,2>{0.00876946189f, 0.382414788f},
-std::array<float,2>{0.523295105f, 0.166607574f},
-std::array<float,2>{0.333394319f, 0.774263084f},
-std::array<float,2>{0.730233848f, 0.96287775f},
-std::array<float,2>{0.435074598f, 0.0583707616f},
-std::array<float,2>{0.975563228f, 0.292212993f},
-std::array<float,2>{0.189499095f, 0.74842602f},
-std::array<float,2>{0.751633167f, 0.907762468f},
-std::array<float,2>{0.0913349837f, 0.091588743f},
-std::array<float,2>{0.600456893f, 0.368877858f},
-std::array<float,2>{0.251698703f, 0.672685325f},
-std::array<float,2>{0.652410209f, 0.522853792f},
-std::array<float,2>{0.464466572f, 0.446877897f},
-std::array<float,2>{0.922841966f, 0.223221704f},
-std::array<float,2>{0.172103867f, 0.819316745f},
-std::array<float,2>{0.946887136f, 0.705601633f},
-std::array<float,2>{0.245306402f, 0.255029082f},
-std::array<float,2>{0.690752029f, 0.0158379711f},
-std::array<float,2>{0.37678194f, 0.971389055f},
-std::array<float,2>{0.559680939f, 0.794996798f},
-std::array<float,2>{0.349683225f, 0.154609114f},
-std::array<float,2>{0.817756295f, 0.420174807f},
-std::array<float,2>{0.0460378751f, 0.61702311f},
-std::array<float,2>{0.936991334f, 0.888218045f},
-std::array<float,2>{0.184602529f, 0.11581555f},
-std::array<float,2>{0.646377265f, 0.322803885f},
-std::array<float,2>{0.459317327f, 0.646755636f},
-std::array<float,2>{0.607155025f, 0.547829509f},
-std::array<float,2>{0.260096431f, 0.47691232f},
-std::array<float,2>{0.764007628f, 0.188938349f},
-std::array<float,2>{0.0857125148f, 0.853519797f},
-std::array<float,2>{0.824010551f, 0.739691615f},
-std::array<float,2>{0.0378516428f, 0.284370929f},
-std::array<float,2>{0.548109829f, 0.0534566753f},
-std::array<float,2>{0.353182882f, 0.957021773f},
-std::array<float,2>{0.696480036f, 0.773255706f},
-std::array<float,2>{0.388204932f, 0.161305562f},
-std::array<float,2>{0.942195892f, 0.387361139f},
-std::array<float,2>{0.235169128f, 0.570654988f},
-std::array<float,2>{0.795405507f, 0.821378827f},
-std::array<float,2>{0.123443052f, 0.229747161f},
-std::array<float,2>{0.567857623f, 0.438027024f},
-std::array<float,2>{0.288950861f, 0.527920365f},
-std::array<float,2>{0.686641097f, 0.680398047f},
-std::array<float,2>{0.497932822f, 0.363356084f},
-std::array<float,2>{0.896321833f, 0.0831328109f},
-std::array<float,2>{0.14215976f, 0.914902925f},
-std::array<float,2>{0.979575574f, 0.617570817f},
-std::array<float,2>{0.196104616f, 0.406271428f},
-std::array<float,2>{0.721047521f, 0.142267898f},
-std::array<float,2>{0.424473822f, 0.786411762f},
-std::array<float,2>{0.524677217f, 0.98281312f},
-std::array<float,2>{0.338761449f, 0.0243430734f},
-std::array<float,2>{0.86227113f, 0.264678746f},
-std::array<float,2>{0.00171426882f, 0.71450597f},
-std::array<float,2>{0.966367126f, 0.812306404f},
-std::array<float,2>{0.225940213f, 0.133146659f},
-std::array<float,2>{0.714084208f, 0.423805177f},
-std::array<float,2>{0.391045749f, 0.603446722f},
-std::array<float,2>{0.535488844f, 0.688550174f},
-std::array<float,2>{0.365266055f, 0.27419883f},
-std::array<float,2>{0.833495021f, 0.0134606753f},
-std::array<float,2>{0.0583366305f, 0.988112509f},
-std::array<float,2>{0.769163489f, 0.504080951f},
-std::array<float,2>{0.0677615628f, 0.45426935f},
-std::array<float,2>{0.613147676f, 0.245736569f},
-std::array<float,2>{0.269902796f, 0.836972415f},
-std::array<float,2>{0.637684345f, 0.931355655f},
-std::array<float,2>{0.449759781f, 0.0629973859f},
-std::array<float,2>{0.909239352f, 0.358114064f},
-std::array<float,2>{0.157196969f, 0.66689378f},
-std::array<float,2>{0.856272876f, 0.950634181f},
-std::array<float,2>{0.0216790754f, 0.0461551063f},
-std::array<float,2>{0.508576632f, 0.298532665f},
-std::array<float,2>{0.32010591f, 0.722594261f},
-std::array<float,2>{0.745382369f, 0.585905492f},
-std::array<float,2>{0.417629153f, 0.393636912f},
-std::array<float,2>{0.992024302f, 0.17711097f},
-std::array<float,2>{0.206721142f, 0.755955577f},
-std::array<float,2>{0.886386752f, 0.626704097f},
-std::array<float,2>{0.135149896f, 0.329949021f},
-std::array<float,2>{0.669374883f, 0.100470513f},
-std::array<float,2>{0.476323098f, 0.90108031f},
-std::array<float,2>{0.584549725f, 0.872395515f},
-std::array<float,2>{0.303763837f, 0.215539098f},
-std::array<float,2>{0.806752026f, 0.497228712f},
-std::array<float,2>{0.106383793f, 0.536073267f},
-std::array<float,2>{0.938466787f, 0.924839795f},
-std::array<float,2>{0.240296781f, 0.0723191798f},
-std::array<float,2>{0.701304138f, 0.350282341f},
-std::array<float,2>{0.383768678f, 0.656441748f},
-std::array<float,2>{0.551792502f, 0.509562433f},
-std::array<float,2>{0.358015418f, 0.464140892f},
-std::array<float,2>{0.825402975f, 0.236405477f},
-std::array<float,2>{0.0328010544f, 0.828340232f},
-std::array<float,2>{0.758043945f, 0.700940549f},
-std::array<float,2>{0.0782352164f, 0.268125921f},
-std::array<float,2>{0.603532135f, 0.00620455667f},
-std::array<float,2>{0.264586091f, 0.999757171f},
-std::array<float,2>{0.640643477f, 0.798155427f},
-std::array<float,2>{0.45370847f, 0.128539905f},
-std::array<float,2>{0.933312118f, 0.430066466f},
-std::array<float,2>{0.18202965f, 0.597284615f},
-std::array<float,2>{0.864634275f, 0.867027879f},
-std::array<float,2>{0.00688910577f, 0.206328526f},
-std::array<float,2>{0.528788507f, 0.485818744f},
-std::array<float,2>{0.343191892f, 0.543912053f},
-std::array<float,2>{0.724575222f, 0.636807024f},
-std::array<float,2>{0.428009331f, 0.338207364f},
-std::array<float,2>{0.984256268f, 0.106362835f},
-std::array<float,2>{0.199502826f, 0.893446028f},
-std::array<float,2>{0.893479824f, 0.587724686f},
-std::array<float,2>{0.1480259f, 0.400095701f},
-std::array<float,2>{0.683470309f, 0.185440138f},
-std::array<float,2>{0.495794028f, 0.762583017f},
-std::array<float,2>{0.562776923f, 0.940521538f},
-std::array<float,2>{0.281540424f, 0.033459872f},
-std::array<float,2>{0.791006446f, 0.310620785f},
-std::array<float,2>{0.119589716f, 0.73135376f},
-std::array<float,2>{0.912897706f, 0.777693868f},
-std::array<float,2>{0.163539767f, 0.171167284f},
-std::array<float,2>{0.635190487f, 0.377059966f},
-std::array<float,2>{0.44639793f, 0.570183933f},
-std::array<float,2>{0.613413811f, 0.743788898f},
-std::array<float,2>{0.269528091f, 0.294966012f},
-std::array<float,2>{0.77085501f, 0.0591125637f},
-std::array<float,2>{0.0638925806f, 0.966431677f},
-std::array<float,2>{0.830648661f, 0.559038818f},
-std::array<float,2>{0.0596883073f, 0.470602483f},
-std::array<float,2>{0.533614457f, 0.198832363f},
-std::array<float,2>{0.362168789f, 0.845798194f},
-std::array<float,2>{0.716170967f, 0.879070818f},
-std::array<float,2>{0.396543652f, 0.122838743f},
-std::array<float,2>{0.963100493f, 0.314494461f},
-std::array<float,2>{0.219884411f, 0.654217899f},
-std::array<float,2>{0.809245229f, 0.974180639f},
-std::array<float,2>{0.103316829f, 0.0231232066f},
-std::array<float,2>{0.580316305f, 0.252771795f},
-std::array<float,2>{0.298723787f, 0.708803892f},
-std::array<float,2>{0.664778769f, 0.611240864f},
-std::array<float,2>{0.469242722f, 0.414498389f},
-std::array<float,2>{0.887078464f, 0.151304275f},
-std::array<float,2>{0.139490932f, 0.79082787f},
-std::array<float,2>{0.984855533f, 0.677643239f},
-std::array<float,2>{0.208471477f, 0.3736642f},
-std::array<float,2>{0.748348475f, 0.0880937502f},
-std::array<float,2>{0.418687344f, 0.912098706f},
-std::array<float,2>{0.514832377f, 0.816291451f},
-std::array<float,2>{0.312662959f, 0.220234647f},
-std::array<float,2>{0.85157305f, 0.449448973f},
-std::array<float,2>{0.0161187518f, 0.518405378f},
-std::array<float,2>{0.875289619f, 0.958429098f},
-std::array<float,2>{0.126769066f, 0.0506347604f},
-std::array<float,2>{0.660590351f, 0.286344945f},
-std::array<float,2>{0.480306178f, 0.73691678f},
-std::array<float,2>{0.589508474f, 0.577324092f},
-std::array<float,2>{0.311459959f, 0.38654232f},
-std::array<float,2>{0.79939127f, 0.158584446f},
-std::array<float,2>{0.0942342058f, 0.766176164f},
-std::array<float,2>{0.844013929f, 0.6437397f},
-std::array<float,2>{0.023743052f, 0.326975673f},
-std::array<float,2>{0.503332794f, 0.111352354f},
-std::array<float,2>{0.327037632f, 0.884480655f},
-std::array<float,2>{0.736664712f, 0.855542302f},
-std::array<float,2>{0.411698937f, 0.191945732f},
-std::array<float,2>{0.997431338f, 0.483276844f},
-std::array<float,2>{0.213201299f, 0.553273916f},
-std::array<float,2>{0.778483391f, 0.782523811f},
-std::array<float,2>{0.0769500732f, 0.145851269f},
-std::array<float,2>{0.622563899f, 0.4103522f},
-std::array<float,2>{0.279738069f, 0.623570621f},
-std::array<float,2>{0.626788855f, 0.716913998f},
-std::array<float,2>{0.439317375f, 0.260414273f},
-std::array<float,2>{0.917964995f, 0.0306359753f},
-std::array<float,2>{0.170374259f, 0.98018086f},
-std::array<float,2>{0.958205283f, 0.527099788f},
-std::array<float,2>{0.229369938f, 0.443323314f},
-std::array<float,2>{0.706063032f, 0.232350454f},
-std::array<float,2>{0.399128228f, 0.825155377f},
-std::array<float,2>{0.540277064f, 0.920366406f},
-std::array<float,2>{0.374507099f, 0.081523262f},
-std::array<float,2>{0.843380451f, 0.362878203f},
-std::array<float,2>{0.0519618019f, 0.687434912f},
-std::array<float,2>{0.970149994f, 0.841290891f},
-std::array<float,2>{0.193243012f, 0.246884733f},
-std::array<float,2>{0.730980456f, 0.460028559f},
-std::array<float,2>{0.430220664f, 0.500630856f},
-std::array<float,2>{0.518735588f, 0.670424402f},
-std::array<float,2>{0.329026252f, 0.355323493f},
-std::array<float,2>{0.873350501f, 0.070078373f},
-std::array<float,2>{0.0133934468f, 0.934225082f},
-std::array<float,2>{0.788937092f, 0.60817188f},
-std::array<float,2>{0.109736368f, 0.426270574f},
-std::array<float,2>{0.578110397f, 0.140057236f},
-std::array<float,2>{0.290529281f, 0.806111157f},
-std::array<float,2>{0.676491618f, 0.991575658f},
-std::array<float,2>{0.491570562f, 0.00861094799f},
-std::array<float,2>{0.90048039f, 0.278869063f},
-std::array<float,2>{0.152720779f, 0.694055021f},
-std::array<float,2>{0.815641224f, 0.903193831f},
-std::array<float,2>{0.0397390239f, 0.0941314325f},
-std::array<float,2>{0.55488801f, 0.335282028f},
-std::array<float,2>{0.345224559f, 0.631887496f},
-std::array<float,2>{0.692110121f, 0.531723499f},
-std::array<float,2>{0.38237524f, 0.495522678f},
-std::array<float,2>{0.952597499f, 0.212988928f},
-std::array<float,2>{0.246198297f, 0.870604098f},
-std::array<float,2>{0.928768575f, 0.724741518f},
-std::array<float,2>{0.17647551f, 0.303520799f},
-std::array<float,2>{0.650545061f, 0.0426878817f},
-std::array<float,2>{0.465340316f, 0.947620928f},
-std::array<float,2>{0.595243394f, 0.752572477f},
-std::array<float,2>{0.25399673f, 0.172417432f},
-std::array<float,2>{0.757481098f, 0.394766331f},
-std::array<float,2>{0.0880000591f, 0.580119073f},
-std::array<float,2>{0.95668608f, 0.942611396f},
-std::array<float,2>{0.233117551f, 0.0381864905f},
-std::array<float,2>{0.710906565f, 0.308412969f},
-std::array<float,2>{0.403269738f, 0.729449391f},
-std::array<float,2>{0.546576679f, 0.591100335f},
-std::array<float,2>{0.368303567f, 0.406169981f},
-std::array<float,2>{0.837770402f, 0.18235077f},
-std::array<float,2>{0.0490781739f, 0.759689271f},
-std::array<float,2>{0.775726795f, 0.636675775f},
-std::array<float,2>{0.0735074133f, 0.342187941f},
-std::array<float,2>{0.618833244f, 0.101726472f},
-std::array<float,2>{0.276757747f, 0.897089183f},
-std::array<float,2>{0.630908251f, 0.860358238f},
-std::array<float,2>{0.444083393f, 0.207643509f},
-std::array<float,2>{0.918627024f, 0.488640517f},
-std::array<float,2>{0.165455192f, 0.540017366f},
-std::array<float,2>{0.849780262f, 0.803442299f},
-std::array<float,2>{0.0292565357f, 0.129310533f},
-std::array<float,2>{0.507515132f, 0.436726928f},
-std::array<float,2>{0.32351765f, 0.598311901f},
-std::array<float,2>{0.739864171f, 0.698829651f},
-std::array<float,2>{0.40869534f, 0.270633698f},
-std::array<float,2>{0.994333982f, 0.000300682761f},
-std::array<float,2>{0.216849893f, 0.994513154f},
-std::array<float,2>{0.882302344f, 0.511944532f},
-std::array<float,2>{0.129097685f, 0.466168731f},
-std::array<float,2>{0.658746541f, 0.241463721f},
-std::array<float,2>{0.481616795f, 0.834221661f},
-std::array<float,2>{0.591773033f, 0.927902102f},
-std::array<float,2>{0.305143803f, 0.0768915862f},
-std::array<float,2>{0.800855815f, 0.346108496f},
-std::array<float,2>{0.0986884683f, 0.663990676f},
-std::array<float,2>{0.925186753f, 0.818234921f},
-std::array<float,2>{0.175094709f, 0.225135669f},
-std::array<float,2>{0.655984044f, 0.447782636f},
-std::array<float,2>{0.46186021f, 0.520054758f},
-std::array<float,2>{0.598548949f, 0.675213635f},
-std::array<float,2>{0.253839374f, 0.369257957f},
-std::array<float,2>{0.752312958f, 0.0921933427f},
-std::array<float,2>{0.0922574624f, 0.908873141f},
-std::array<float,2>{0.819862127f, 0.615150809f},
-std::array<float,2>{0.0434052162f, 0.418271512f},
-std::array<float,2>{0.561402321f, 0.153924987f},
-std::array<float,2>{0.348730952f, 0.793406546f},
-std::array<float,2>{0.688108921f, 0.969576716f},
-std::array<float,2>{0.377195209f, 0.0180423371f},
-std::array<float,2>{0.948887706f, 0.257593513f},
-std::array<float,2>{0.243714362f, 0.703694105f},
-std::array<float,2>{0.78455025f, 0.878493071f},
-std::array<float,2>{0.113746926f, 0.118467003f},
-std::array<float,2>{0.571268022f, 0.317230403f},
-std::array<float,2>{0.293844491f, 0.648833394f},
-std::array<float,2>{0.672562659f, 0.555681407f},
-std::array<float,2>{0.487133801f, 0.474437296f},
-std::array<float,2>{0.904580414f, 0.201814786f},
-std::array<float,2>{0.151695296f, 0.849503279f},
-std::array<float,2>{0.974491119f, 0.747980833f},
-std::array<float,2>{0.187939137f, 0.290288299f},
-std::array<float,2>{0.726770222f, 0.0559345409f},
-std::array<float,2>{0.437216908f, 0.964112937f},
-std::array<float,2>{0.52062875f, 0.775808632f},
-std::array<float,2>{0.334530234f, 0.166006103f},
-std::array<float,2>{0.87064594f, 0.379350781f},
-std::array<float,2>{0.0115944827f, 0.565948784f},
-std::array<float,2>{0.898074448f, 0.916153669f},
-std::array<float,2>{0.143754601f, 0.0846611485f},
-std::array<float,2>{0.684254169f, 0.365965366f},
-std::array<float,2>{0.49885869f, 0.68307668f},
-std::array<float,2>{0.570063174f, 0.53045094f},
-std::array<float,2>{0.286590308f, 0.440597266f},
-std::array<float,2>{0.794434428f, 0.226685002f},
-std::array<float,2>{0.121406324f, 0.823680401f},
-std::array<float,2>{0.859520555f, 0.711986899f},
-std::array<float,2>{0.0024790871f, 0.262309194f},
-std::array<float,2>{0.526940286f, 0.0272257105f},
-std::array<float,2>{0.337330103f, 0.981173158f},
-std::array<float,2>{0.719323635f, 0.788261294f},
-std::array<float,2>{0.422187299f, 0.144112587f},
-std::array<float,2>{0.976652443f, 0.408251375f},
-std::array<float,2>{0.198651552f, 0.619191408f},
-std::array<float,2>{0.762459576f, 0.852189541f},
-std::array<float,2>{0.0831578225f, 0.190565526f},
-std::array<float,2>{0.608933449f, 0.480056286f},
-std::array<float,2>{0.258650512f, 0.548882544f},
-std::array<float,2>{0.647341192f, 0.645353496f},
-std::array<float,2>{0.458151221f, 0.321133196f},
-std::array<float,2>{0.934946299f, 0.114607938f},
-std::array<float,2>{0.185685515f, 0.890315711f},
-std::array<float,2>{0.944145918f, 0.573449552f},
-std::array<float,2>{0.23727192f, 0.388941973f},
-std::array<float,2>{0.69758147f, 0.162394792f},
-std::array<float,2>{0.390598476f, 0.771147192f},
-std::array<float,2>{0.549005747f, 0.955002666f},
-std::array<float,2>{0.355447233f, 0.0516803265f},
-std::array<float,2>{0.821826577f, 0.282275409f},
-std::array<float,2>{0.0355956107f, 0.741960645f},
-std::array<float,2>{0.990122378f, 0.7550807f},
-std::array<float,2>{0.204769075f, 0.179586962f},
-std::array<float,2>{0.743448734f, 0.391241163f},
-std::array<float,2>{0.414210439f, 0.583581567f},
-std::array<float,2>{0.51164645f, 0.718872607f},
-std::array<float,2>{0.316782802f, 0.299873263f},
-std::array<float,2>{0.857813179f, 0.0435657613f},
-std::array<float,2>{0.0207851287f, 0.951420665f},
-std::array<float,2>{0.80658567f, 0.539018154f},
-std::array<float,2>{0.109374829f, 0.499340743f},
-std::array<float,2>{0.582424939f, 0.218492955f},
-std::array<float,2>{0.302314848f, 0.87479347f},
-std::array<float,2>{0.671521544f, 0.899617374f},
-std::array<float,2>{0.473894507f, 0.0988885462f},
-std::array<float,2>{0.88316834f, 0.331371129f},
-std::array<float,2>{0.133433387f, 0.628434837f},
-std::array<float,2>{0.834898889f, 0.985263288f},
-std::array<float,2>{0.05522779f, 0.0155619131f},
-std::array<float,2>{0.538136542f, 0.27581948f},
-std::array<float,2>{0.364905655f, 0.689816117f},
-std::array<float,2>{0.711253941f, 0.603728592f},
-std::array<float,2>{0.392629474f, 0.424271047f},
-std::array<float,2>{0.96790415f, 0.135118559f},
-std::array<float,2>{0.223616928f, 0.809685886f},
-std::array<float,2>{0.90813297f, 0.66437465f},
-std::array<float,2>{0.158765599f, 0.3558456f},
-std::array<float,2>{0.639052272f, 0.0662507266f},
-std::array<float,2>{0.45229578f, 0.933036268f},
-std::array<float,2>{0.609485686f, 0.838642895f},
-std::array<float,2>{0.272558361f, 0.242683187f},
-std::array<float,2>{0.765650451f, 0.45686841f},
-std::array<float,2>{0.0687019899f, 0.507208765f},
-std::array<float,2>{0.981460333f, 0.892037511f},
-std::array<float,2>{0.201270908f, 0.108673193f},
-std::array<float,2>{0.725157857f, 0.33658579f},
-std::array<float,2>{0.426815867f, 0.639202178f},
-std::array<float,2>{0.529915869f, 0.545188844f},
-std::array<float,2>{0.341578633f, 0.486832887f},
-std::array<float,2>{0.866146088f, 0.203164414f},
-std::array<float,2>{0.00436488772f, 0.864446461f},
-std::array<float,2>{0.791682005f, 0.733493865f},
-std::array<float,2>{0.118889548f, 0.309687227f},
-std::array<float,2>{0.565873444f, 0.0319865122f},
-std::array<float,2>{0.284825742f, 0.938664556f},
-std::array<float,2>{0.681163073f, 0.764314651f},
-std::array<float,2>{0.492923498f, 0.187216759f},
-std::array<float,2>{0.892437816f, 0.402240038f},
-std::array<float,2>{0.144645065f, 0.589450657f},
-std::array<float,2>{0.827337146f, 0.830941796f},
-std::array<float,2>{0.0338693559f, 0.235435978f},
-std::array<float,2>{0.553597808f, 0.462197423f},
-std::array<float,2>{0.356720567f, 0.511401892f},
-std::array<float,2>{0.700072825f, 0.659751534f},
-std::array<float,2>{0.386428386f, 0.349175245f},
-std::array<float,2>{0.93957442f, 0.0704427212f},
-std::array<float,2>{0.239418954f, 0.923624277f},
-std::array<float,2>{0.931482136f, 0.594859958f},
-std::array<float,2>{0.180446446f, 0.432426929f},
-std::array<float,2>{0.643760562f, 0.126072347f},
-std::array<float,2>{0.456664056f, 0.799139738f},
-std::array<float,2>{0.602601349f, 0.996575534f},
-std::array<float,2>{0.263340741f, 0.00452816067f},
-std::array<float,2>{0.760556996f, 0.266729027f},
-std::array<float,2>{0.0813324824f, 0.702449858f},
-std::array<float,2>{0.890519142f, 0.792465687f},
-std::array<float,2>{0.138526186f, 0.149524719f},
-std::array<float,2>{0.66647464f, 0.417354971f},
-std::array<float,2>{0.471630275f, 0.61312592f},
-std::array<float,2>{0.579064012f, 0.710589945f},
-std::array<float,2>{0.299836516f, 0.251931876f},
-std::array<float,2>{0.810964644f, 0.02009161f},
-std::array<float,2>{0.103829518f, 0.975237548f},
-std::array<float,2>{0.854047656f, 0.517207444f},
-std::array<float,2>{0.0180607401f, 0.451998472f},
-std::array<float,2>{0.51198554f, 0.22225368f},
-std::array<float,2>{0.314648092f, 0.814029157f},
-std::array<float,2>{0.747086525f, 0.913845956f},
-std::array<float,2>{0.420676649f, 0.0863054544f},
-std::array<float,2>{0.987024367f, 0.372324675f},
-std::array<float,2>{0.209922731f, 0.679179549f},
-std::array<float,2>{0.771733582f, 0.96795541f},
-std::array<float,2>{0.0650266632f, 0.0620129257f},
-std::array<float,2>{0.615989864f, 0.293837458f},
-std::array<float,2>{0.266988099f, 0.745161414f},
-std::array<float,2>{0.633635879f, 0.568020821f},
-std::array<float,2>{0.447741568f, 0.375232309f},
-std::array<float,2>{0.91070646f, 0.168824434f},
-std::array<float,2>{0.160179913f, 0.780427575f},
-std::array<float,2>{0.961523473f, 0.655971408f},
-std::array<float,2>{0.221558064f, 0.312529027f},
-std::array<float,2>{0.717297137f, 0.124059036f},
-std::array<float,2>{0.395917237f, 0.882422984f},
-std::array<float,2>{0.533017397f, 0.843750656f},
-std::array<float,2>{0.359869063f, 0.196187705f},
-std::array<float,2>{0.828755677f, 0.471613586f},
-std::array<float,2>{0.0606909879f, 0.560904384f},
-std::array<float,2>{0.915368319f, 0.978059411f},
-std::array<float,2>{0.169091567f, 0.0276116151f},
-std::array<float,2>{0.627583683f, 0.258877039f},
-std::array<float,2>{0.43965742f, 0.715363204f},
-std::array<float,2>{0.624812245f, 0.622509897f},
-std::array<float,2>{0.277876675f, 0.412346959f},
-std::array<float,2>{0.781032622f, 0.148396522f},
-std::array<float,2>{0.076009281f, 0.783967614f},
-std::array<float,2>{0.839877129f, 0.68503511f},
-std::array<float,2>{0.0531219877f, 0.360353261f},
-std::array<float,2>{0.542787254f, 0.0786624625f},
-std::array<float,2>{0.371927887f, 0.919492006f},
-std::array<float,2>{0.703715146f, 0.826402307f},
-std::array<float,2>{0.40138039f, 0.233703941f},
-std::array<float,2>{0.959599376f, 0.444257796f},
-std::array<float,2>{0.226845413f, 0.524176657f},
-std::array<float,2>{0.798222363f, 0.768258095f},
-std::array<float,2>{0.0957809091f, 0.157307193f},
-std::array<float,2>{0.586758673f, 0.383982509f},
-std::array<float,2>{0.309033692f, 0.574252546f},
-std::array<float,2>{0.663736999f, 0.735176146f},
-std::array<float,2>{0.477368563f, 0.287197649f},
-std::array<float,2>{0.878235579f, 0.0482414775f},
-std::array<float,2>{0.128071517f, 0.960819066f},
-std::array<float,2>{0.999005556f, 0.551656544f},
-std::array<float,2>{0.211763278f, 0.480502456f},
-std::array<float,2>{0.735462785f, 0.194426119f},
-std::array<float,2>{0.413314313f, 0.859347105f},
-std::array<float,2>{0.500203431f, 0.885286331f},
-std::array<float,2>{0.324408382f, 0.109812409f},
-std::array<float,2>{0.846603751f, 0.325923622f},
-std::array<float,2>{0.026366502f, 0.641096056f},
-std::array<float,2>{0.949830532f, 0.867921531f},
-std::array<float,2>{0.248516679f, 0.212640613f},
-std::array<float,2>{0.694882214f, 0.493597239f},
-std::array<float,2>{0.38013643f, 0.534574926f},
-std::array<float,2>{0.557087183f, 0.629167497f},
-std::array<float,2>{0.345834047f, 0.333345622f},
-std::array<float,2>{0.813093126f, 0.0958617628f},
-std::array<float,2>{0.0420765318f, 0.904724598f},
-std::array<float,2>{0.754139245f, 0.578762472f},
-std::array<float,2>{0.0874271467f, 0.396910369f},
-std::array<float,2>{0.596551776f, 0.174529374f},
-std::array<float,2>{0.257525802f, 0.751274288f},
-std::array<float,2>{0.648983419f, 0.94583559f},
-std::array<float,2>{0.467252523f, 0.0392719246f},
-std::array<float,2>{0.926984727f, 0.301207215f},
-std::array<float,2>{0.178109273f, 0.723157108f},
-std::array<float,2>{0.871433914f, 0.936684966f},
-std::array<float,2>{0.0147622218f, 0.0680406541f},
-std::array<float,2>{0.517184138f, 0.352765828f},
-std::array<float,2>{0.331438601f, 0.668146431f},
-std::array<float,2>{0.733705997f, 0.502193093f},
-std::array<float,2>{0.432722837f, 0.457900345f},
-std::array<float,2>{0.97156179f, 0.248959228f},
-std::array<float,2>{0.193753347f, 0.843222558f},
-std::array<float,2>{0.900248468f, 0.692253649f},
-std::array<float,2>{0.155377209f, 0.28111434f},
-std::array<float,2>{0.678804636f, 0.0108148539f},
-std::array<float,2>{0.488351703f, 0.989114881f},
-std::array<float,2>{0.575092196f, 0.808356285f},
-std::array<float,2>{0.292385966f, 0.138166383f},
-std::array<float,2>{0.785791039f, 0.427986383f},
-std::array<float,2>{0.112212323f, 0.60597682f},
-std::array<float,2>{0.991293728f, 0.951966643f},
-std::array<float,2>{0.206107676f, 0.0433923118f},
-std::array<float,2>{0.746005714f, 0.300489068f},
-std::array<float,2>{0.417057425f, 0.719445467f},
-std::array<float,2>{0.507888973f, 0.583014488f},
-std::array<float,2>{0.319396853f, 0.391091466f},
-std::array<float,2>{0.855897605f, 0.178808928f},
-std::array<float,2>{0.0220738687f, 0.755858004f},
-std::array<float,2>{0.80750984f, 0.628090501f},
-std::array<float,2>{0.105707459f, 0.331828058f},
-std::array<float,2>{0.584171057f, 0.0991452336f},
-std::array<float,2>{0.304506361f, 0.900062442f},
-std::array<float,2>{0.669632852f, 0.874258578f},
-std::array<float,2>{0.475951791f, 0.217797205f},
-std::array<float,2>{0.885997891f, 0.49955672f},
-std::array<float,2>{0.135635898f, 0.538261473f},
-std::array<float,2>{0.833584487f, 0.810356498f},
-std::array<float,2>{0.0579828173f, 0.135293767f},
-std::array<float,2>{0.536083519f, 0.424725562f},
-std::array<float,2>{0.366209686f, 0.604345262f},
-std::array<float,2>{0.71475327f, 0.690117002f},
-std::array<float,2>{0.39155367f, 0.276078731f},
-std::array<float,2>{0.966096163f, 0.0148164071f},
-std::array<float,2>{0.226307705f, 0.984812796f},
-std::array<float,2>{0.90986073f, 0.507772386f},
-std::array<float,2>{0.156578675f, 0.456222385f},
-std::array<float,2>{0.637033165f, 0.242419943f},
-std::array<float,2>{0.449492395f, 0.838323891f},
-std::array<float,2>{0.612381518f, 0.933407605f},
-std::array<float,2>{0.27045092f, 0.0655170381f},
-std::array<float,2>{0.768946707f, 0.356335312f},
-std::array<float,2>{0.0679566935f, 0.664719045f},
-std::array<float,2>{0.895770371f, 0.823752701f},
-std::array<float,2>{0.142067209f, 0.227396503f},
-std::array<float,2>{0.687368035f, 0.441156775f},
-std::array<float,2>{0.497502595f, 0.53110975f},
-std::array<float,2>{0.567936301f, 0.683106959f},
-std::array<float,2>{0.288464606f, 0.365632534f},
-std::array<float,2>{0.795781493f, 0.0842866302f},
-std::array<float,2>{0.123651549f, 0.916535735f},
-std::array<float,2>{0.861442566f, 0.619999886f},
-std::array<float,2>{0.00112845062f, 0.408755958f},
-std::array<float,2>{0.525185704f, 0.143565521f},
-std::array<float,2>{0.337930977f, 0.788601756f},
-std::array<float,2>{0.721217632f, 0.980856121f},
-std::array<float,2>{0.424032599f, 0.0266553983f},
-std::array<float,2>{0.980362892f, 0.261798799f},
-std::array<float,2>{0.195788518f, 0.712704122f},
-std::array<float,2>{0.764296412f, 0.889734745f},
-std::array<float,2>{0.0853991061f, 0.115052521f},
-std::array<float,2>{0.60681057f, 0.320372909f},
-std::array<float,2>{0.260687619f, 0.644742131f},
-std::array<float,2>{0.645666063f, 0.549638808f},
-std::array<float,2>{0.459801674f, 0.479691535f},
-std::array<float,2>{0.937472582f, 0.191377684f},
-std::array<float,2>{0.185462683f, 0.851987541f},
-std::array<float,2>{0.941522419f, 0.741259933f},
-std::array<float,2>{0.234501347f, 0.282757849f},
-std::array<float,2>{0.69693011f, 0.0510128625f},
-std::array<float,2>{0.387915075f, 0.954494774f},
-std::array<float,2>{0.548770607f, 0.770952642f},
-std::array<float,2>{0.352720529f, 0.162906259f},
-std::array<float,2>{0.823549986f, 0.389224082f},
-std::array<float,2>{0.0373866558f, 0.573847115f},
-std::array<float,2>{0.922255218f, 0.908282697f},
-std::array<float,2>{0.172797248f, 0.0927530453f},
-std::array<float,2>{0.653141141f, 0.369704157f},
-std::array<float,2>{0.463964373f, 0.675701141f},
-std::array<float,2>{0.599729776f, 0.519981444f},
-std::array<float,2>{0.251172394f, 0.447447211f},
-std::array<float,2>{0.7512694f, 0.224731371f},
-std::array<float,2>{0.0909469128f, 0.817605615f},
-std::array<float,2>{0.818316519f, 0.703455925f},
-std::array<float,2>{0.0464387611f, 0.256902128f},
-std::array<float,2>{0.560272038f, 0.0182825364f},
-std::array<float,2>{0.350419074f, 0.969033182f},
-std::array<float,2>{0.691036582f, 0.793817878f},
-std::array<float,2>{0.376100928f, 0.153458595f},
-std::array<float,2>{0.946594596f, 0.418515086f},
-std::array<float,2>{0.245670795f, 0.614440084f},
-std::array<float,2>{0.781820595f, 0.849018276f},
-std::array<float,2>{0.1166557f, 0.20164296f},
-std::array<float,2>{0.574127972f, 0.473974735f},
-std::array<float,2>{0.296693414f, 0.556433797f},
-std::array<float,2>{0.675295532f, 0.649260044f},
-std::array<float,2>{0.485437125f, 0.316727996f},
-std::array<float,2>{0.902444541f, 0.118837662f},
-std::array<float,2>{0.149654344f, 0.878064036f},
-std::array<float,2>{0.97507745f, 0.565714061f},
-std::array<float,2>{0.190035298f, 0.379658908f},
-std::array<float,2>{0.729717493f, 0.165164173f},
-std::array<float,2>{0.434957206f, 0.776219189f},
-std::array<float,2>{0.522603393f, 0.96482861f},
-std::array<float,2>{0.333561212f, 0.0565471388f},
-std::array<float,2>{0.868580997f, 0.290729314f},
-std::array<float,2>{0.00797366537f, 0.747530162f},
-std::array<float,2>{0.953917921f, 0.759273529f},
-std::array<float,2>{0.231188253f, 0.182073981f},
-std::array<float,2>{0.708830774f, 0.405347258f},
-std::array<float,2>{0.405353248f, 0.591507494f},
-std::array<float,2>{0.544921756f, 0.728574991f},
-std::array<float,2>{0.369323373f, 0.307803333f},
-std::array<float,2>{0.838762045f, 0.0387566015f},
-std::array<float,2>{0.0481306128f, 0.943162203f},
-std::array<float,2>{0.773647666f, 0.539272904f},
-std::array<float,2>{0.0710864216f, 0.489079803f},
-std::array<float,2>{0.620664597f, 0.207155585f},
-std::array<float,2>{0.273714513f, 0.86094147f},
-std::array<float,2>{0.62973094f, 0.896781206f},
-std::array<float,2>{0.441830933f, 0.102091089f},
-std::array<float,2>{0.920278668f, 0.342347115f},
-std::array<float,2>{0.167540133f, 0.636176467f},
-std::array<float,2>{0.847880185f, 0.995017469f},
-std::array<float,2>{0.0309882462f, 0.000621539832f},
-std::array<float,2>{0.504596591f, 0.271395922f},
-std::array<float,2>{0.322069526f, 0.698268175f},
-std::array<float,2>{0.740911305f, 0.597674012f},
-std::array<float,2>{0.407479942f, 0.437499791f},
-std::array<float,2>{0.994030297f, 0.129642799f},
-std::array<float,2>{0.214971036f, 0.802794755f},
-std::array<float,2>{0.879351437f, 0.663544476f},
-std::array<float,2>{0.132335022f, 0.346447259f},
-std::array<float,2>{0.656986654f, 0.0766388178f},
-std::array<float,2>{0.483639359f, 0.928333759f},
-std::array<float,2>{0.592705548f, 0.834538639f},
-std::array<float,2>{0.30810076f, 0.241789252f},
-std::array<float,2>{0.802818716f, 0.466531694f},
-std::array<float,2>{0.100896023f, 0.512609005f},
-std::array<float,2>{0.952750027f, 0.90506649f},
-std::array<float,2>{0.246597245f, 0.0965122506f},
-std::array<float,2>{0.691613436f, 0.33370322f},
-std::array<float,2>{0.382299334f, 0.62976414f},
-std::array<float,2>{0.555550516f, 0.534701169f},
-std::array<float,2>{0.345113665f, 0.494059175f},
-std::array<float,2>{0.816277146f, 0.212184653f},
-std::array<float,2>{0.0391353332f, 0.86759764f},
-std::array<float,2>{0.75701791f, 0.722885311f},
-std::array<float,2>{0.0886214525f, 0.301676661f},
-std::array<float,2>{0.595064938f, 0.0399494767f},
-std::array<float,2>{0.254409581f, 0.945505261f},
-std::array<float,2>{0.651106656f, 0.751554668f},
-std::array<float,2>{0.465307504f, 0.174154446f},
-std::array<float,2>{0.929455221f, 0.397102267f},
-std::array<float,2>{0.17609632f, 0.578529835f},
-std::array<float,2>{0.873778582f, 0.843499959f},
-std::array<float,2>{0.0127000753f, 0.248479202f},
-std::array<float,2>{0.519172847f, 0.457266867f},
-std::array<float,2>{0.328604847f, 0.502558351f},
-std::array<float,2>{0.730834723f, 0.668497324f},
-std::array<float,2>{0.429910332f, 0.353048354f},
-std::array<float,2>{0.970500708f, 0.0677957013f},
-std::array<float,2>{0.192609638f, 0.937287509f},
-std::array<float,2>{0.90117234f, 0.60569948f},
-std::array<float,2>{0.153181136f, 0.428686738f},
-std::array<float,2>{0.675897539f, 0.138528347f},
-std::array<float,2>{0.492156953f, 0.807621598f},
-std::array<float,2>{0.577416301f, 0.988679349f},
-std::array<float,2>{0.290106684f, 0.0114964051f},
-std::array<float,2>{0.788193643f, 0.280383855f},
-std::array<float,2>{0.110220529f, 0.691795945f},
-std::array<float,2>{0.917278171f, 0.783639789f},
-std::array<float,2>{0.170820132f, 0.147495687f},
-std::array<float,2>{0.626107037f, 0.412971169f},
-std::array<float,2>{0.438515991f, 0.622753918f},
-std::array<float,2>{0.622115195f, 0.715269208f},
-std::array<float,2>{0.280199617f, 0.25944519f},
-std::array<float,2>{0.779182076f, 0.0281835906f},
-std::array<float,2>{0.0762731954f, 0.977676511f},
-std::array<float,2>{0.843163013f, 0.523501337f},
-std::array<float,2>{0.0523532443f, 0.443449855f},
-std::array<float,2>{0.540550411f, 0.234074593f},
-std::array<float,2>{0.374821812f, 0.826867938f},
-std::array<float,2>{0.706831336f, 0.918958902f},
-std::array<float,2>{0.398610204f, 0.0784098208f},
-std::array<float,2>{0.958582819f, 0.361293465f},
-std::array<float,2>{0.228641897f, 0.685518146f},
-std::array<float,2>{0.79896301f, 0.960255027f},
-std::array<float,2>{0.094598338f, 0.0487851612f},
-std::array<float,2>{0.589256287f, 0.287650317f},
-std::array<float,2>{0.310726434f, 0.734422684f},
-std::array<float,2>{0.661076486f, 0.574916303f},
-std::array<float,2>{0.479569703f, 0.384687394f},
-std::array<float,2>{0.875804007f, 0.15797773f},
-std::array<float,2>{0.126262486f, 0.768034875f},
-std::array<float,2>{0.997701228f, 0.641214252f},
-std::array<float,2>{0.213518143f, 0.325250447f},
-std::array<float,2>{0.736886263f, 0.110165782f},
-std::array<float,2>{0.411171347f, 0.884806454f},
-std::array<float,2>{0.503623724f, 0.858430624f},
-std::array<float,2>{0.326536864f, 0.194872737f},
-std::array<float,2>{0.844473362f, 0.481248111f},
-std::array<float,2>{0.0241705757f, 0.550953209f},
-std::array<float,2>{0.887495995f, 0.974869728f},
-std::array<float,2>{0.138711318f, 0.0196937677f},
-std::array<float,2>{0.664074957f, 0.251122057f},
-std::array<float,2>{0.468993098f, 0.710113347f},
-std::array<float,2>{0.581019938f, 0.612407863f},
-std::array<float,2>{0.298146695f, 0.417505443f},
-std::array<float,2>{0.808672547f, 0.150174186f},
-std::array<float,2>{0.102813333f, 0.792839944f},
-std::array<float,2>{0.852400243f, 0.679590464f},
-std::array<float,2>{0.0160656497f, 0.372961998f},
-std::array<float,2>{0.515163302f, 0.0866245478f},
-std::array<float,2>{0.313213497f, 0.913130343f},
-std::array<float,2>{0.748807192f, 0.813940108f},
-std::array<float,2>{0.418448806f, 0.222125009f},
-std::array<float,2>{0.985261917f, 0.451591849f},
-std::array<float,2>{0.20880419f, 0.516615808f},
-std::array<float,2>{0.771001339f, 0.781184554f},
-std::array<float,2>{0.0640287548f, 0.168048248f},
-std::array<float,2>{0.61401248f, 0.375890732f},
-std::array<float,2>{0.268576533f, 0.567712426f},
-std::array<float,2>{0.635700583f, 0.745703042f},
-std::array<float,2>{0.447013348f, 0.293052077f},
-std::array<float,2>{0.912177384f, 0.061906673f},
-std::array<float,2>{0.163856313f, 0.968598247f},
-std::array<float,2>{0.963758409f, 0.561249852f},
-std::array<float,2>{0.220289245f, 0.470708519f},
-std::array<float,2>{0.716561496f, 0.1957369f},
-std::array<float,2>{0.396991253f, 0.844666302f},
-std::array<float,2>{0.53387928f, 0.881986916f},
-std::array<float,2>{0.361405432f, 0.12493892f},
-std::array<float,2>{0.830100358f, 0.313359946f},
-std::array<float,2>{0.0605432466f, 0.655605435f},
-std::array<float,2>{0.983570874f, 0.865046442f},
-std::array<float,2>{0.199937731f, 0.20394817f},
-std::array<float,2>{0.724015117f, 0.486500055f},
-std::array<float,2>{0.428356469f, 0.545647025f},
-std::array<float,2>{0.529072881f, 0.63901341f},
-std::array<float,2>{0.343352705f, 0.335958928f},
-std::array<float,2>{0.865007281f, 0.108975582f},
-std::array<float,2>{0.00755754905f, 0.892116487f},
-std::array<float,2>{0.790496111f, 0.589035034f},
-std::array<float,2>{0.120093524f, 0.401686966f},
-std::array<float,2>{0.56312108f, 0.186917707f},
-std::array<float,2>{0.281983346f, 0.763985157f},
-std::array<float,2>{0.683104157f, 0.939315796f},
-std::array<float,2>{0.495295972f, 0.0315833241f},
-std::array<float,2>{0.89296627f, 0.310132831f},
-std::array<float,2>{0.147492677f, 0.734333813f},
-std::array<float,2>{0.825806975f, 0.923120856f},
-std::array<float,2>{0.0325647704f, 0.0712049454f},
-std::array<float,2>{0.552466989f, 0.348982662f},
-std::array<float,2>{0.35778293f, 0.659242868f},
-std::array<float,2>{0.70201695f, 0.511189997f},
-std::array<float,2>{0.383204132f, 0.462582976f},
-std::array<float,2>{0.937800169f, 0.235957414f},
-std::array<float,2>{0.240971237f, 0.830239475f},
-std::array<float,2>{0.932690203f, 0.702784002f},
-std::array<float,2>{0.182223529f, 0.267473459f},
-std::array<float,2>{0.641480803f, 0.00433464395f},
-std::array<float,2>{0.45330888f, 0.997044086f},
-std::array<float,2>{0.604457021f, 0.799343169f},
-std::array<float,2>{0.264149189f, 0.126908079f},
-std::array<float,2>{0.758398831f, 0.431885123f},
-std::array<float,2>{0.0788104683f, 0.595473945f},
-std::array<float,2>{0.968485117f, 0.987695158f},
-std::array<float,2>{0.222702205f, 0.0129161198f},
-std::array<float,2>{0.711427331f, 0.273522556f},
-std::array<float,2>{0.393129826f, 0.689410031f},
-std::array<float,2>{0.538896739f, 0.602545381f},
-std::array<float,2>{0.364704847f, 0.423236012f},
-std::array<float,2>{0.833997369f, 0.133650005f},
-std::array<float,2>{0.0551595688f, 0.811892748f},
-std::array<float,2>{0.766168714f, 0.666339695f},
-std::array<float,2>{0.0692480281f, 0.357683569f},
-std::array<float,2>{0.61032933f, 0.0626415312f},
-std::array<float,2>{0.273411959f, 0.93086195f},
-std::array<float,2>{0.639365494f, 0.837441504f},
-std::array<float,2>{0.453046679f, 0.245226011f},
-std::array<float,2>{0.907468975f, 0.454844892f},
-std::array<float,2>{0.158598363f, 0.50476855f},
-std::array<float,2>{0.858213246f, 0.75667882f},
-std::array<float,2>{0.021028325f, 0.177356035f},
-std::array<float,2>{0.510993838f, 0.394194871f},
-std::array<float,2>{0.317062706f, 0.585069358f},
-std::array<float,2>{0.744116187f, 0.722159088f},
-std::array<float,2>{0.414976299f, 0.298033714f},
-std::array<float,2>{0.989511132f, 0.0467466079f},
-std::array<float,2>{0.204235613f, 0.950764775f},
-std::array<float,2>{0.883469641f, 0.535174429f},
-std::array<float,2>{0.132885531f, 0.497722775f},
-std::array<float,2>{0.671134412f, 0.214871138f},
-std::array<float,2>{0.474156886f, 0.872656286f},
-std::array<float,2>{0.582579374f, 0.900392413f},
-std::array<float,2>{0.301811934f, 0.0999471024f},
-std::array<float,2>{0.805991709f, 0.329107344f},
-std::array<float,2>{0.108822852f, 0.626116931f},
-std::array<float,2>{0.935317576f, 0.854173958f},
-std::array<float,2>{0.18647714f, 0.189293921f},
-std::array<float,2>{0.646845102f, 0.477421165f},
-std::array<float,2>{0.458537698f, 0.546981215f},
-std::array<float,2>{0.60847187f, 0.646998167f},
-std::array<float,2>{0.257856131f, 0.322727174f},
-std::array<float,2>{0.76203388f, 0.115592465f},
-std::array<float,2>{0.0835529417f, 0.887833357f},
-std::array<float,2>{0.821641564f, 0.570985556f},
-std::array<float,2>{0.0357078314f, 0.387108594f},
-std::array<float,2>{0.549538255f, 0.162010923f},
-std::array<float,2>{0.354968458f, 0.772481441f},
-std::array<float,2>{0.697815418f, 0.956461132f},
-std::array<float,2>{0.390004903f, 0.0532205701f},
-std::array<float,2>{0.943535089f, 0.284930348f},
-std::array<float,2>{0.236713335f, 0.739761829f},
-std::array<float,2>{0.794022083f, 0.914129496f},
-std::array<float,2>{0.121627249f, 0.083611019f},
-std::array<float,2>{0.569463134f, 0.363835156f},
-std::array<float,2>{0.28700313f, 0.679722309f},
-std::array<float,2>{0.684012353f, 0.527378261f},
-std::array<float,2>{0.498161197f, 0.437915504f},
-std::array<float,2>{0.897733152f, 0.230367646f},
-std::array<float,2>{0.144102246f, 0.822113872f},
-std::array<float,2>{0.97744149f, 0.713981867f},
-std::array<float,2>{0.199077353f, 0.265213758f},
-std::array<float,2>{0.719097972f, 0.0234806892f},
-std::array<float,2>{0.42267859f, 0.982958615f},
-std::array<float,2>{0.526631832f, 0.786902785f},
-std::array<float,2>{0.337751836f, 0.141928777f},
-std::array<float,2>{0.860061646f, 0.406760335f},
-std::array<float,2>{0.00211026729f, 0.617840588f},
-std::array<float,2>{0.904833436f, 0.875240862f},
-std::array<float,2>{0.151896507f, 0.120612286f},
-std::array<float,2>{0.672034025f, 0.319969684f},
-std::array<float,2>{0.486646533f, 0.652260423f},
-std::array<float,2>{0.570473671f, 0.556832075f},
-std::array<float,2>{0.293172896f, 0.476374328f},
-std::array<float,2>{0.785140038f, 0.200227827f},
-std::array<float,2>{0.113995232f, 0.851346016f},
-std::array<float,2>{0.870559931f, 0.74861598f},
-std::array<float,2>{0.0112168565f, 0.292884439f},
-std::array<float,2>{0.52104634f, 0.0577592179f},
-std::array<float,2>{0.33428961f, 0.962064326f},
-std::array<float,2>{0.727268517f, 0.773507535f},
-std::array<float,2>{0.436645567f, 0.166023657f},
-std::array<float,2>{0.97386843f, 0.381959856f},
-std::array<float,2>{0.188205257f, 0.56391567f},
-std::array<float,2>{0.752649367f, 0.8186571f},
-std::array<float,2>{0.0923429504f, 0.222793251f},
-std::array<float,2>{0.597801566f, 0.446421862f},
-std::array<float,2>{0.253150165f, 0.52315402f},
-std::array<float,2>{0.655629218f, 0.67199266f},
-std::array<float,2>{0.461054534f, 0.368324637f},
-std::array<float,2>{0.925601423f, 0.0911941603f},
-std::array<float,2>{0.175510988f, 0.907607794f},
-std::array<float,2>{0.948713839f, 0.616557658f},
-std::array<float,2>{0.243501127f, 0.420796216f},
-std::array<float,2>{0.687773824f, 0.154835477f},
-std::array<float,2>{0.377541393f, 0.79549861f},
-std::array<float,2>{0.56057936f, 0.970846474f},
-std::array<float,2>{0.349406242f, 0.0161827132f},
-std::array<float,2>{0.819791019f, 0.25570333f},
-std::array<float,2>{0.0439073853f, 0.705086768f},
-std::array<float,2>{0.994826257f, 0.800944865f},
-std::array<float,2>{0.217658877f, 0.132514417f},
-std::array<float,2>{0.739696383f, 0.4350546f},
-std::array<float,2>{0.408552319f, 0.60142535f},
-std::array<float,2>{0.507074714f, 0.696820915f},
-std::array<float,2>{0.32374388f, 0.272996157f},
-std::array<float,2>{0.85048008f, 0.00274581276f},
-std::array<float,2>{0.0286970437f, 0.992522478f},
-std::array<float,2>{0.801736653f, 0.514984548f},
-std::array<float,2>{0.0994265601f, 0.467189282f},
-std::array<float,2>{0.590844631f, 0.239177719f},
-std::array<float,2>{0.305210114f, 0.832763135f},
-std::array<float,2>{0.658270895f, 0.927578568f},
-std::array<float,2>{0.482281417f, 0.0746827126f},
-std::array<float,2>{0.882415831f, 0.344299197f},
-std::array<float,2>{0.129812807f, 0.661397219f},
-std::array<float,2>{0.837063551f, 0.943608165f},
-std::array<float,2>{0.0493299589f, 0.0356362537f},
-std::array<float,2>{0.54628408f, 0.304909378f},
-std::array<float,2>{0.369041264f, 0.728176296f},
-std::array<float,2>{0.71031338f, 0.592365384f},
-std::array<float,2>{0.402791262f, 0.404046118f},
-std::array<float,2>{0.956127644f, 0.180620581f},
-std::array<float,2>{0.232788548f, 0.759791553f},
-std::array<float,2>{0.918387175f, 0.633590102f},
-std::array<float,2>{0.166013613f, 0.340951979f},
-std::array<float,2>{0.631496608f, 0.105247431f},
-std::array<float,2>{0.443724781f, 0.894658804f},
-std::array<float,2>{0.618472636f, 0.861800432f},
-std::array<float,2>{0.276917279f, 0.209188625f},
-std::array<float,2>{0.77632153f, 0.491889566f},
-std::array<float,2>{0.0738391727f, 0.542783856f},
-std::array<float,2>{0.970957816f, 0.933952093f},
-std::array<float,2>{0.194024742f, 0.0695300922f},
-std::array<float,2>{0.734315932f, 0.354751348f},
-std::array<float,2>{0.433189154f, 0.670158029f},
-std::array<float,2>{0.51676476f, 0.500304163f},
-std::array<float,2>{0.331842542f, 0.460628986f},
-std::array<float,2>{0.87197113f, 0.246544689f},
-std::array<float,2>{0.0153820422f, 0.841494977f},
-std::array<float,2>{0.78519237f, 0.693645597f},
-std::array<float,2>{0.111745246f, 0.278639644f},
-std::array<float,2>{0.574497879f, 0.0078866398f},
-std::array<float,2>{0.292918175f, 0.992010295f},
-std::array<float,2>{0.679302216f, 0.806513608f},
-std::array<float,2>{0.489102066f, 0.140535012f},
-std::array<float,2>{0.899632156f, 0.425956875f},
-std::array<float,2>{0.156122819f, 0.607694983f},
-std::array<float,2>{0.812959969f, 0.871091425f},
-std::array<float,2>{0.0428564027f, 0.213811606f},
-std::array<float,2>{0.5571661f, 0.495636284f},
-std::array<float,2>{0.346627533f, 0.53188765f},
-std::array<float,2>{0.694601536f, 0.632793307f},
-std::array<float,2>{0.380841941f, 0.335666209f},
-std::array<float,2>{0.949440122f, 0.0943242237f},
-std::array<float,2>{0.248767972f, 0.90267092f},
-std::array<float,2>{0.927470803f, 0.580667019f},
-std::array<float,2>{0.178626776f, 0.395504266f},
-std::array<float,2>{0.64844656f, 0.172110826f},
-std::array<float,2>{0.467663199f, 0.75236696f},
-std::array<float,2>{0.595778883f, 0.947927117f},
-std::array<float,2>{0.257145256f, 0.0422038399f},
-std::array<float,2>{0.754759133f, 0.303121269f},
-std::array<float,2>{0.0871661603f, 0.725307286f},
-std::array<float,2>{0.878773272f, 0.765724599f},
-std::array<float,2>{0.128879994f, 0.158900753f},
-std::array<float,2>{0.663345218f, 0.386061013f},
-std::array<float,2>{0.476900369f, 0.577791154f},
-std::array<float,2>{0.586281538f, 0.736797333f},
-std::array<float,2>{0.30930382f, 0.286984712f},
-std::array<float,2>{0.798741043f, 0.0499840975f},
-std::array<float,2>{0.0962662771f, 0.958735764f},
-std::array<float,2>{0.846120954f, 0.552978814f},
-std::array<float,2>{0.0257418137f, 0.482869655f},
-std::array<float,2>{0.500845015f, 0.191581547f},
-std::array<float,2>{0.324756444f, 0.856046975f},
-std::array<float,2>{0.736135304f, 0.884092331f},
-std::array<float,2>{0.414019555f, 0.111983135f},
-std::array<float,2>{0.998452544f, 0.326594859f},
-std::array<float,2>{0.210950539f, 0.644173384f},
-std::array<float,2>{0.780614495f, 0.979940712f},
-std::array<float,2>{0.0756273568f, 0.0309293214f},
-std::array<float,2>{0.624496877f, 0.260222435f},
-std::array<float,2>{0.277575731f, 0.71740967f},
-std::array<float,2>{0.627118886f, 0.623323083f},
-std::array<float,2>{0.440104157f, 0.411003441f},
-std::array<float,2>{0.915697873f, 0.14621745f},
-std::array<float,2>{0.169531345f, 0.783093452f},
-std::array<float,2>{0.959465444f, 0.686687768f},
-std::array<float,2>{0.227133602f, 0.362623215f},
-std::array<float,2>{0.703128755f, 0.0815473273f},
-std::array<float,2>{0.401874006f, 0.920518398f},
-std::array<float,2>{0.542085111f, 0.824494958f},
-std::array<float,2>{0.371469438f, 0.231682613f},
-std::array<float,2>{0.840527713f, 0.442470014f},
-std::array<float,2>{0.0532788038f, 0.526513219f},
-std::array<float,2>{0.910549462f, 0.96628809f},
-std::array<float,2>{0.161062539f, 0.0588894039f},
-std::array<float,2>{0.632872224f, 0.295842737f},
-std::array<float,2>{0.447761565f, 0.743366301f},
-std::array<float,2>{0.615586817f, 0.569715738f},
-std::array<float,2>{0.267301261f, 0.377442986f},
-std::array<float,2>{0.772445142f, 0.171616063f},
-std::array<float,2>{0.0649047345f, 0.777906895f},
-std::array<float,2>{0.828261614f, 0.65348655f},
-std::array<float,2>{0.0614548251f, 0.315039933f},
-std::array<float,2>{0.532708406f, 0.12224488f},
-std::array<float,2>{0.359615475f, 0.879825771f},
-std::array<float,2>{0.717057467f, 0.846412659f},
-std::array<float,2>{0.396311402f, 0.198388532f},
-std::array<float,2>{0.961197972f, 0.470107853f},
-std::array<float,2>{0.22075367f, 0.559496522f},
-std::array<float,2>{0.811149776f, 0.790444732f},
-std::array<float,2>{0.1043557f, 0.150429636f},
-std::array<float,2>{0.578291476f, 0.41460672f},
-std::array<float,2>{0.300615728f, 0.610621214f},
-std::array<float,2>{0.666508317f, 0.708451986f},
-std::array<float,2>{0.470718205f, 0.252048582f},
-std::array<float,2>{0.889835656f, 0.0225881673f},
-std::array<float,2>{0.138136655f, 0.974048793f},
-std::array<float,2>{0.986690283f, 0.517691135f},
-std::array<float,2>{0.209156379f, 0.449987382f},
-std::array<float,2>{0.747655451f, 0.219797879f},
-std::array<float,2>{0.420304298f, 0.815686941f},
-std::array<float,2>{0.512446225f, 0.91132921f},
-std::array<float,2>{0.315017521f, 0.0884552822f},
-std::array<float,2>{0.853865087f, 0.373180687f},
-std::array<float,2>{0.0182897691f, 0.677066088f},
-std::array<float,2>{0.940032959f, 0.828677416f},
-std::array<float,2>{0.240022525f, 0.236821026f},
-std::array<float,2>{0.699588656f, 0.464601278f},
-std::array<float,2>{0.385803342f, 0.509221435f},
-std::array<float,2>{0.552844346f, 0.657129228f},
-std::array<float,2>{0.357095808f, 0.349661797f},
-std::array<float,2>{0.828116596f, 0.0730231404f},
-std::array<float,2>{0.0334367864f, 0.925753474f},
-std::array<float,2>{0.760001063f, 0.597072721f},
-std::array<float,2>{0.0818734542f, 0.430593044f},
-std::array<float,2>{0.60349524f, 0.128401414f},
-std::array<float,2>{0.262907654f, 0.798786819f},
-std::array<float,2>{0.64443481f, 0.999266565f},
-std::array<float,2>{0.456177175f, 0.00681891432f},
-std::array<float,2>{0.931017816f, 0.26795131f},
-std::array<float,2>{0.179877937f, 0.700573921f},
-std::array<float,2>{0.865474701f, 0.892745793f},
-std::array<float,2>{0.00456214882f, 0.105675898f},
-std::array<float,2>{0.529366553f, 0.338630617f},
-std::array<float,2>{0.34108609f, 0.637612104f},
-std::array<float,2>{0.72473079f, 0.543311536f},
-std::array<float,2>{0.42755124f, 0.485990465f},
-std::array<float,2>{0.981951356f, 0.206549361f},
-std::array<float,2>{0.20176965f, 0.866222143f},
-std::array<float,2>{0.892002821f, 0.730912805f},
-std::array<float,2>{0.145312652f, 0.311413765f},
-std::array<float,2>{0.680967152f, 0.0340491422f},
-std::array<float,2>{0.492424041f, 0.941301346f},
-std::array<float,2>{0.566349447f, 0.762050271f},
-std::array<float,2>{0.284495592f, 0.184879929f},
-std::array<float,2>{0.791122973f, 0.399418324f},
-std::array<float,2>{0.118578866f, 0.586962581f},
-std::array<float,2>{0.979409754f, 0.983637154f},
-std::array<float,2>{0.196405217f, 0.0252332333f},
-std::array<float,2>{0.722286224f, 0.264639586f},
-std::array<float,2>{0.424984366f, 0.713362694f},
-std::array<float,2>{0.524113595f, 0.618556559f},
-std::array<float,2>{0.339681417f, 0.408198178f},
-std::array<float,2>{0.863190472f, 0.141085491f},
-std::array<float,2>{0.00059290661f, 0.786009133f},
-std::array<float,2>{0.796489f, 0.681027114f},
-std::array<float,2>{0.124994487f, 0.365219146f},
-std::array<float,2>{0.567149878f, 0.0822518095f},
-std::array<float,2>{0.287385792f, 0.915053368f},
-std::array<float,2>{0.685940981f, 0.82051003f},
-std::array<float,2>{0.496894032f, 0.22912018f},
-std::array<float,2>{0.894770563f, 0.438903093f},
-std::array<float,2>{0.141434401f, 0.529118896f},
-std::array<float,2>{0.822543025f, 0.771502256f},
-std::array<float,2>{0.0386678204f, 0.161015347f},
-std::array<float,2>{0.547811568f, 0.388033658f},
-std::array<float,2>{0.351751447f, 0.571524799f},
-std::array<float,2>{0.695985317f, 0.738737643f},
-std::array<float,2>{0.38678202f, 0.284023643f},
-std::array<float,2>{0.942911148f, 0.0539292693f},
-std::array<float,2>{0.235485658f, 0.955688536f},
-std::array<float,2>{0.935575664f, 0.548679709f},
-std::array<float,2>{0.183838695f, 0.47846514f},
-std::array<float,2>{0.645093381f, 0.188364729f},
-std::array<float,2>{0.460006833f, 0.854523122f},
-std::array<float,2>{0.60549134f, 0.887041211f},
-std::array<float,2>{0.260873526f, 0.117096923f},
-std::array<float,2>{0.764969945f, 0.323824346f},
-std::array<float,2>{0.084879756f, 0.648102641f},
-std::array<float,2>{0.885741293f, 0.871315598f},
-std::array<float,2>{0.135748506f, 0.216440916f},
-std::array<float,2>{0.668482304f, 0.496924073f},
-std::array<float,2>{0.474634439f, 0.536309183f},
-std::array<float,2>{0.58503294f, 0.625020683f},
-std::array<float,2>{0.30366379f, 0.328685045f},
-std::array<float,2>{0.807930827f, 0.101232849f},
-std::array<float,2>{0.106841981f, 0.901746392f},
-std::array<float,2>{0.856966436f, 0.584781528f},
-std::array<float,2>{0.0224671531f, 0.392976612f},
-std::array<float,2>{0.509039819f, 0.176313013f},
-std::array<float,2>{0.319311291f, 0.757700145f},
-std::array<float,2>{0.745060444f, 0.949684083f},
-std::array<float,2>{0.416540742f, 0.0453925095f},
-std::array<float,2>{0.990503252f, 0.296900183f},
-std::array<float,2>{0.205416977f, 0.721194327f},
-std::array<float,2>{0.768076718f, 0.93018055f},
-std::array<float,2>{0.0666215718f, 0.0637640134f},
-std::array<float,2>{0.61207366f, 0.358893722f},
-std::array<float,2>{0.27126801f, 0.667148232f},
-std::array<float,2>{0.637800992f, 0.505047739f},
-std::array<float,2>{0.450445414f, 0.453952163f},
-std::array<float,2>{0.908249676f, 0.245022312f},
-std::array<float,2>{0.157382935f, 0.836550832f},
-std::array<float,2>{0.9648785f, 0.687993705f},
-std::array<float,2>{0.224857718f, 0.274685383f},
-std::array<float,2>{0.713410854f, 0.012567631f},
-std::array<float,2>{0.392566055f, 0.986826301f},
-std::array<float,2>{0.536681175f, 0.811334074f},
-std::array<float,2>{0.366830021f, 0.134333879f},
-std::array<float,2>{0.832501411f, 0.422608674f},
-std::array<float,2>{0.0572617128f, 0.602152824f},
-std::array<float,2>{0.921258032f, 0.895509601f},
-std::array<float,2>{0.166937277f, 0.104453765f},
-std::array<float,2>{0.630588233f, 0.340146273f},
-std::array<float,2>{0.44262743f, 0.634626389f},
-std::array<float,2>{0.61988914f, 0.541598916f},
-std::array<float,2>{0.274688303f, 0.490620404f},
-std::array<float,2>{0.77502799f, 0.210038617f},
-std::array<float,2>{0.0721645281f, 0.862957954f},
-std::array<float,2>{0.839192688f, 0.726585746f},
-std::array<float,2>{0.0469305441f, 0.306114107f},
-std::array<float,2>{0.543370664f, 0.0362021737f},
-std::array<float,2>{0.370305151f, 0.944551945f},
-std::array<float,2>{0.707341015f, 0.761583745f},
-std::array<float,2>{0.405264527f, 0.181535274f},
-std::array<float,2>{0.954963028f, 0.403315365f},
-std::array<float,2>{0.232050508f, 0.593190432f},
-std::array<float,2>{0.80445075f, 0.833103955f},
-std::array<float,2>{0.10034328f, 0.240213335f},
-std::array<float,2>{0.593096197f, 0.468579799f},
-std::array<float,2>{0.306682348f, 0.513961434f},
-std::array<float,2>{0.658175707f, 0.660867274f},
-std::array<float,2>{0.483096778f, 0.345291615f},
-std::array<float,2>{0.879916072f, 0.0755815804f},
-std::array<float,2>{0.130864859f, 0.926553965f},
-std::array<float,2>{0.992585897f, 0.599866331f},
-std::array<float,2>{0.216527715f, 0.434330702f},
-std::array<float,2>{0.74186635f, 0.131791815f},
-std::array<float,2>{0.407045782f, 0.801860154f},
-std::array<float,2>{0.504997969f, 0.993297279f},
-std::array<float,2>{0.320407271f, 0.00337738637f},
-std::array<float,2>{0.849531233f, 0.272188514f},
-std::array<float,2>{0.029901417f, 0.695587397f},
-std::array<float,2>{0.946102321f, 0.796208203f},
-std::array<float,2>{0.244269669f, 0.155399516f},
-std::array<float,2>{0.690165341f, 0.420927256f},
-std::array<float,2>{0.37568137f, 0.616012514f},
-std::array<float,2>{0.559046924f, 0.706342995f},
-std::array<float,2>{0.351260036f, 0.25458768f},
-std::array<float,2>{0.817059934f, 0.0166052673f},
-std::array<float,2>{0.0451309457f, 0.972568393f},
-std::array<float,2>{0.750249088f, 0.522335589f},
-std::array<float,2>{0.0907938033f, 0.446135938f},
-std::array<float,2>{0.600781202f, 0.224526599f},
-std::array<float,2>{0.250637084f, 0.819663048f},
-std::array<float,2>{0.65404737f, 0.906692922f},
-std::array<float,2>{0.463714898f, 0.0904125199f},
-std::array<float,2>{0.923455656f, 0.367988139f},
-std::array<float,2>{0.173043713f, 0.673488915f},
-std::array<float,2>{0.867258608f, 0.961438f},
-std::array<float,2>{0.00942408666f, 0.057310272f},
-std::array<float,2>{0.521782219f, 0.291471481f},
-std::array<float,2>{0.332918078f, 0.749690592f},
-std::array<float,2>{0.728525639f, 0.563096404f},
-std::array<float,2>{0.433773667f, 0.38114354f},
-std::array<float,2>{0.976149738f, 0.167796209f},
-std::array<float,2>{0.190499946f, 0.774783611f},
-std::array<float,2>{0.903457999f, 0.651019871f},
-std::array<float,2>{0.148776785f, 0.319313049f},
-std::array<float,2>{0.674799442f, 0.11990989f},
-std::array<float,2>{0.485317439f, 0.876716137f},
-std::array<float,2>{0.572925925f, 0.85056448f},
-std::array<float,2>{0.295023054f, 0.199301392f},
-std::array<float,2>{0.782890081f, 0.475569636f},
-std::array<float,2>{0.115712635f, 0.558352649f},
-std::array<float,2>{0.957819343f, 0.92164737f},
-std::array<float,2>{0.229570717f, 0.0809145421f},
-std::array<float,2>{0.705613673f, 0.361915678f},
-std::array<float,2>{0.399788588f, 0.685702741f},
-std::array<float,2>{0.539249957f, 0.525714815f},
-std::array<float,2>{0.373176038f, 0.441412449f},
-std::array<float,2>{0.841951191f, 0.231276602f},
-std::array<float,2>{0.0516020246f, 0.826114714f},
-std::array<float,2>{0.778271794f, 0.718144059f},
-std::array<float,2>{0.0780159235f, 0.261315823f},
-std::array<float,2>{0.621570289f, 0.0296292026f},
-std::array<float,2>{0.28099671f, 0.979083717f},
-std::array<float,2>{0.625962138f, 0.782005727f},
-std::array<float,2>{0.437810481f, 0.144654348f},
-std::array<float,2>{0.916254103f, 0.412056655f},
-std::array<float,2>{0.171043366f, 0.62436825f},
-std::array<float,2>{0.845644355f, 0.856858134f},
-std::array<float,2>{0.0250339191f, 0.192750171f},
-std::array<float,2>{0.502227306f, 0.484228075f},
-std::array<float,2>{0.327951282f, 0.553797364f},
-std::array<float,2>{0.737820983f, 0.643013895f},
-std::array<float,2>{0.411114305f, 0.328069597f},
-std::array<float,2>{0.996409297f, 0.112645f},
-std::array<float,2>{0.214714557f, 0.883624673f},
-std::array<float,2>{0.876300871f, 0.576502383f},
-std::array<float,2>{0.125742823f, 0.38505438f},
-std::array<float,2>{0.661719263f, 0.1601004f},
-std::array<float,2>{0.47876361f, 0.767489135f},
-std::array<float,2>{0.587933004f, 0.957634568f},
-std::array<float,2>{0.311706305f, 0.0494020581f},
-std::array<float,2>{0.800685108f, 0.285455614f},
-std::array<float,2>{0.0956993103f, 0.737887979f},
-std::array<float,2>{0.927841604f, 0.753019094f},
-std::array<float,2>{0.176862106f, 0.172875181f},
-std::array<float,2>{0.652300656f, 0.39635694f},
-std::array<float,2>{0.466319323f, 0.581530929f},
-std::array<float,2>{0.594493985f, 0.726087093f},
-std::array<float,2>{0.255826443f, 0.304445446f},
-std::array<float,2>{0.756505907f, 0.0414219797f},
-std::array<float,2>{0.0897777826f, 0.948837698f},
-std::array<float,2>{0.814818501f, 0.532851577f},
-std::array<float,2>{0.0409479477f, 0.494227678f},
-std::array<float,2>{0.556475341f, 0.214081302f},
-std::array<float,2>{0.344574988f, 0.870067954f},
-std::array<float,2>{0.692991078f, 0.90344137f},
-std::array<float,2>{0.381199956f, 0.0952290893f},
-std::array<float,2>{0.95203346f, 0.334424734f},
-std::array<float,2>{0.247371361f, 0.631654143f},
-std::array<float,2>{0.78743279f, 0.990889788f},
-std::array<float,2>{0.110883109f, 0.00959308818f},
-std::array<float,2>{0.5761801f, 0.278068155f},
-std::array<float,2>{0.289780766f, 0.694634736f},
-std::array<float,2>{0.67730999f, 0.609253943f},
-std::array<float,2>{0.490673602f, 0.427216411f},
-std::array<float,2>{0.901630461f, 0.13963984f},
-std::array<float,2>{0.153791159f, 0.804719627f},
-std::array<float,2>{0.969400585f, 0.671687126f},
-std::array<float,2>{0.19177413f, 0.353751302f},
-std::array<float,2>{0.731524348f, 0.0688078329f},
-std::array<float,2>{0.431204945f, 0.935085535f},
-std::array<float,2>{0.517686903f, 0.839846313f},
-std::array<float,2>{0.329677761f, 0.247668624f},
-std::array<float,2>{0.874227703f, 0.459425539f},
-std::array<float,2>{0.0126312543f, 0.5011307f},
-std::array<float,2>{0.893582344f, 0.940302432f},
-std::array<float,2>{0.146537587f, 0.034965653f},
-std::array<float,2>{0.68254137f, 0.311565936f},
-std::array<float,2>{0.494497865f, 0.731910169f},
-std::array<float,2>{0.563868821f, 0.586443067f},
-std::array<float,2>{0.283158064f, 0.399250329f},
-std::array<float,2>{0.789166927f, 0.184347108f},
-std::array<float,2>{0.120591946f, 0.763651192f},
-std::array<float,2>{0.86395663f, 0.637742579f},
-std::array<float,2>{0.00624449737f, 0.339244783f},
-std::array<float,2>{0.528154433f, 0.106792368f},
-std::array<float,2>{0.342751473f, 0.894430697f},
-std::array<float,2>{0.722786546f, 0.865546286f},
-std::array<float,2>{0.428821355f, 0.205217943f},
-std::array<float,2>{0.983142495f, 0.48505792f},
-std::array<float,2>{0.20026882f, 0.544783652f},
-std::array<float,2>{0.759479642f, 0.79756093f},
-std::array<float,2>{0.0791591033f, 0.127486497f},
-std::array<float,2>{0.604765832f, 0.430725425f},
-std::array<float,2>{0.265577823f, 0.596013904f},
-std::array<float,2>{0.642531991f, 0.699790835f},
-std::array<float,2>{0.454766184f, 0.268832922f},
-std::array<float,2>{0.931653798f, 0.00710337795f},
-std::array<float,2>{0.183316275f, 0.998158872f},
-std::array<float,2>{0.93859762f, 0.508677185f},
-std::array<float,2>{0.242174283f, 0.463560283f},
-std::array<float,2>{0.702437937f, 0.237862304f},
-std::array<float,2>{0.384170622f, 0.829730213f},
-std::array<float,2>{0.551611006f, 0.924367189f},
-std::array<float,2>{0.359247923f, 0.0738628656f},
-std::array<float,2>{0.82442832f, 0.350628316f},
-std::array<float,2>{0.0318229124f, 0.657257855f},
-std::array<float,2>{0.986037076f, 0.815286458f},
-std::array<float,2>{0.207213968f, 0.219389796f},
-std::array<float,2>{0.749099553f, 0.45091036f},
-std::array<float,2>{0.419294417f, 0.518899322f},
-std::array<float,2>{0.514049768f, 0.676697135f},
-std::array<float,2>{0.314388067f, 0.374155939f},
-std::array<float,2>{0.852617443f, 0.089443475f},
-std::array<float,2>{0.0169498101f, 0.910856783f},
-std::array<float,2>{0.810013413f, 0.609812677f},
-std::array<float,2>{0.101723105f, 0.415385544f},
-std::array<float,2>{0.581879973f, 0.152110323f},
-std::array<float,2>{0.297659904f, 0.790027559f},
-std::array<float,2>{0.665725231f, 0.973530114f},
-std::array<float,2>{0.470391929f, 0.0223627444f},
-std::array<float,2>{0.887791574f, 0.252934903f},
-std::array<float,2>{0.140159965f, 0.70713985f},
-std::array<float,2>{0.831268847f, 0.880120516f},
-std::array<float,2>{0.0589647666f, 0.121776164f},
-std::array<float,2>{0.534700632f, 0.315626711f},
-std::array<float,2>{0.362663746f, 0.652679145f},
-std::array<float,2>{0.715580821f, 0.55985254f},
-std::array<float,2>{0.397609413f, 0.469193876f},
-std::array<float,2>{0.964306176f, 0.198198453f},
-std::array<float,2>{0.219723165f, 0.847050071f},
-std::array<float,2>{0.913884759f, 0.742742896f},
-std::array<float,2>{0.162774131f, 0.296502411f},
-std::array<float,2>{0.636289299f, 0.0603241958f},
-std::array<float,2>{0.445534408f, 0.965309799f},
-std::array<float,2>{0.615120947f, 0.77923739f},
-std::array<float,2>{0.268205702f, 0.170267016f},
-std::array<float,2>{0.77045089f, 0.378645122f},
-std::array<float,2>{0.0626837835f, 0.568392158f},
-std::array<float,2>{0.944575727f, 0.95358777f},
-std::array<float,2>{0.238092005f, 0.051897604f},
-std::array<float,2>{0.698517025f, 0.281952947f},
-std::array<float,2>{0.389440238f, 0.741105437f},
-std::array<float,2>{0.550032318f, 0.572362125f},
-std::array<float,2>{0.353521585f, 0.390192211f},
-std::array<float,2>{0.821132839f, 0.163342655f},
-std::array<float,2>{0.0367157944f, 0.76993221f},
-std::array<float,2>{0.762727201f, 0.646440446f},
-std::array<float,2>{0.082727313f, 0.32202211f},
-std::array<float,2>{0.607920468f, 0.114176542f},
-std::array<float,2>{0.258978307f, 0.888897955f},
-std::array<float,2>{0.647933841f, 0.853326857f},
-std::array<float,2>{0.457648844f, 0.190117538f},
-std::array<float,2>{0.93392998f, 0.479438543f},
-std::array<float,2>{0.186720908f, 0.55016464f},
-std::array<float,2>{0.861229718f, 0.787204146f},
-std::array<float,2>{0.00310086901f, 0.14310129f},
-std::array<float,2>{0.525517881f, 0.409867883f},
-std::array<float,2>{0.336677551f, 0.620533347f},
-std::array<float,2>{0.720123708f, 0.711333454f},
-std::array<float,2>{0.423366576f, 0.263488054f},
-std::array<float,2>{0.978075981f, 0.0260785166f},
-std::array<float,2>{0.197952926f, 0.98199898f},
-std::array<float,2>{0.897152126f, 0.530069649f},
-std::array<float,2>{0.143315285f, 0.440148056f},
-std::array<float,2>{0.685492277f, 0.228193045f},
-std::array<float,2>{0.4998478f, 0.822657049f},
-std::array<float,2>{0.56880039f, 0.917379975f},
-std::array<float,2>{0.285232514f, 0.0853059292f},
-std::array<float,2>{0.793414891f, 0.366249293f},
-std::array<float,2>{0.122438282f, 0.682044983f},
-std::array<float,2>{0.906350791f, 0.839396119f},
-std::array<float,2>{0.159299731f, 0.243356094f},
-std::array<float,2>{0.639774024f, 0.455998242f},
-std::array<float,2>{0.451304317f, 0.506809175f},
-std::array<float,2>{0.610642493f, 0.665762246f},
-std::array<float,2>{0.272054166f, 0.357209802f},
-std::array<float,2>{0.76682955f, 0.0653886199f},
-std::array<float,2>{0.0702729896f, 0.931910932f},
-std::array<float,2>{0.835056484f, 0.604502857f},
-std::array<float,2>{0.0562724397f, 0.425103098f},
-std::array<float,2>{0.537293077f, 0.135772809f},
-std::array<float,2>{0.363811702f, 0.809453189f},
-std::array<float,2>{0.712674022f, 0.985888243f},
-std::array<float,2>{0.394168794f, 0.0140103651f},
-std::array<float,2>{0.967537522f, 0.276615381f},
-std::array<float,2>{0.224236146f, 0.691372931f},
-std::array<float,2>{0.80502671f, 0.898632109f},
-std::array<float,2>{0.107916497f, 0.0978809595f},
-std::array<float,2>{0.583280981f, 0.330983996f},
-std::array<float,2>{0.300959498f, 0.627894163f},
-std::array<float,2>{0.670236409f, 0.537838817f},
-std::array<float,2>{0.472979516f, 0.498464942f},
-std::array<float,2>{0.884401619f, 0.217030525f},
-std::array<float,2>{0.134542271f, 0.873475194f},
-std::array<float,2>{0.98923707f, 0.720051765f},
-std::array<float,2>{0.203642994f, 0.299263269f},
-std::array<float,2>{0.742839456f, 0.0447721519f},
-std::array<float,2>{0.415982127f, 0.953025281f},
-std::array<float,2>{0.510053992f, 0.754270673f},
-std::array<float,2>{0.317887962f, 0.177743152f},
-std::array<float,2>{0.859367967f, 0.39179796f},
-std::array<float,2>{0.0199776404f, 0.58210057f},
-std::array<float,2>{0.881084919f, 0.929099202f},
-std::array<float,2>{0.130313009f, 0.0778059587f},
-std::array<float,2>{0.659628391f, 0.347634554f},
-std::array<float,2>{0.480962753f, 0.662134528f},
-std::array<float,2>{0.589981139f, 0.513419211f},
-std::array<float,2>{0.306407005f, 0.465209484f},
-std::array<float,2>{0.802200496f, 0.240466312f},
-std::array<float,2>{0.097844772f, 0.835228741f},
-std::array<float,2>{0.851476789f, 0.69761622f},
-std::array<float,2>{0.0277634859f, 0.270171881f},
-std::array<float,2>{0.506434262f, 0.00131665124f},
-std::array<float,2>{0.322711378f, 0.995764136f},
-std::array<float,2>{0.739226222f, 0.804198563f},
-std::array<float,2>{0.409327298f, 0.130303144f},
-std::array<float,2>{0.995395124f, 0.436132878f},
-std::array<float,2>{0.217844591f, 0.599562109f},
-std::array<float,2>{0.776715934f, 0.8597247f},
-std::array<float,2>{0.0728744194f, 0.208165407f},
-std::array<float,2>{0.617239714f, 0.490090877f},
-std::array<float,2>{0.275695115f, 0.540551543f},
-std::array<float,2>{0.631975353f, 0.634851336f},
-std::array<float,2>{0.444845676f, 0.343721658f},
-std::array<float,2>{0.919122279f, 0.103091963f},
-std::array<float,2>{0.164724246f, 0.898422122f},
-std::array<float,2>{0.955146313f, 0.590010941f},
-std::array<float,2>{0.23356472f, 0.405148983f},
-std::array<float,2>{0.709158301f, 0.182685658f},
-std::array<float,2>{0.404179782f, 0.758357763f},
-std::array<float,2>{0.54555434f, 0.941928625f},
-std::array<float,2>{0.367634684f, 0.03752058f},
-std::array<float,2>{0.835944533f, 0.307511181f},
-std::array<float,2>{0.0500907227f, 0.729852855f},
-std::array<float,2>{0.973146617f, 0.777133107f},
-std::array<float,2>{0.188986689f, 0.164594188f},
-std::array<float,2>{0.728375733f, 0.38066411f},
-std::array<float,2>{0.436102808f, 0.564899683f},
-std::array<float,2>{0.52011013f, 0.747032583f},
-std::array<float,2>{0.335094243f, 0.289953768f},
-std::array<float,2>{0.869214654f, 0.0550567359f},
-std::array<float,2>{0.0105574718f, 0.96328187f},
-std::array<float,2>{0.783624291f, 0.555034697f},
-std::array<float,2>{0.11460124f, 0.473251611f},
-std::array<float,2>{0.571444154f, 0.202884361f},
-std::array<float,2>{0.294648975f, 0.848246813f},
-std::array<float,2>{0.673187315f, 0.877524853f},
-std::array<float,2>{0.487398416f, 0.117223911f},
-std::array<float,2>{0.905894041f, 0.317809373f},
-std::array<float,2>{0.150778502f, 0.649961293f},
-std::array<float,2>{0.818865418f, 0.969950795f},
-std::array<float,2>{0.0441486351f, 0.0193503909f},
-std::array<float,2>{0.561656773f, 0.256651491f},
-std::array<float,2>{0.347789526f, 0.704996526f},
-std::array<float,2>{0.688626349f, 0.613290966f},
-std::array<float,2>{0.378733814f, 0.419787645f},
-std::array<float,2>{0.947876275f, 0.152613148f},
-std::array<float,2>{0.242701873f, 0.794799209f},
-std::array<float,2>{0.924287498f, 0.674612164f},
-std::array<float,2>{0.174331024f, 0.370140523f},
-std::array<float,2>{0.65459615f, 0.0931933448f},
-std::array<float,2>{0.462455511f, 0.909345031f},
-std::array<float,2>{0.598837137f, 0.817292809f},
-std::array<float,2>{0.25241515f, 0.226546884f},
-std::array<float,2>{0.753509462f, 0.448861033f},
-std::array<float,2>{0.0936507657f, 0.520831764f},
-std::array<float,2>{0.999079585f, 0.886282742f},
-std::array<float,2>{0.212751031f, 0.110807933f},
-std::array<float,2>{0.73490411f, 0.324657232f},
-std::array<float,2>{0.413022608f, 0.641853154f},
-std::array<float,2>{0.501937211f, 0.551853895f},
-std::array<float,2>{0.32548514f, 0.482220471f},
-std::array<float,2>{0.847499728f, 0.193451136f},
-std::array<float,2>{0.0269177929f, 0.857769012f},
-std::array<float,2>{0.797248423f, 0.736307979f},
-std::array<float,2>{0.0971324146f, 0.288285136f},
-std::array<float,2>{0.587302923f, 0.0470134392f},
-std::array<float,2>{0.310078382f, 0.959569812f},
-std::array<float,2>{0.662881255f, 0.768917382f},
-std::array<float,2>{0.478481084f, 0.15721181f},
-std::array<float,2>{0.87699312f, 0.382858723f},
-std::array<float,2>{0.12725015f, 0.575422168f},
-std::array<float,2>{0.841751635f, 0.828000009f},
-std::array<float,2>{0.054262571f, 0.232757375f},
-std::array<float,2>{0.541867018f, 0.444714934f},
-std::array<float,2>{0.372209936f, 0.525365531f},
-std::array<float,2>{0.704787254f, 0.683597028f},
-std::array<float,2>{0.401190072f, 0.359715104f},
-std::array<float,2>{0.960935295f, 0.0796774998f},
-std::array<float,2>{0.227638319f, 0.918409765f},
-std::array<float,2>{0.914885104f, 0.62144345f},
-std::array<float,2>{0.168708563f, 0.413158596f},
-std::array<float,2>{0.628885329f, 0.147153869f},
-std::array<float,2>{0.441046923f, 0.784426808f},
-std::array<float,2>{0.623143494f, 0.977193356f},
-std::array<float,2>{0.278472275f, 0.0283711571f},
-std::array<float,2>{0.779512346f, 0.25809142f},
-std::array<float,2>{0.0746443942f, 0.716133296f},
-std::array<float,2>{0.898867965f, 0.807125986f},
-std::array<float,2>{0.154833987f, 0.137476265f},
-std::array<float,2>{0.678081274f, 0.42913875f},
-std::array<float,2>{0.489931852f, 0.606734216f},
-std::array<float,2>{0.575767934f, 0.693062067f},
-std::array<float,2>{0.291597158f, 0.279407412f},
-std::array<float,2>{0.786221087f, 0.0100265443f},
-std::array<float,2>{0.112604447f, 0.989483893f},
-std::array<float,2>{0.872725844f, 0.503197789f},
-std::array<float,2>{0.0138989529f, 0.458817393f},
-std::array<float,2>{0.515876889f, 0.249904916f},
-std::array<float,2>{0.330684662f, 0.842755258f},
-std::array<float,2>{0.733033538f, 0.936206877f},
-std::array<float,2>{0.431905776f, 0.0666943416f},
-std::array<float,2>{0.972129703f, 0.352442741f},
-std::array<float,2>{0.194888562f, 0.669138789f},
-std::array<float,2>{0.755123615f, 0.947248697f},
-std::array<float,2>{0.0868109241f, 0.0401850492f},
-std::array<float,2>{0.596825182f, 0.302387387f},
-std::array<float,2>{0.256295025f, 0.723795056f},
-std::array<float,2>{0.649973989f, 0.579950869f},
-std::array<float,2>{0.468525529f, 0.398435503f},
-std::array<float,2>{0.926225901f, 0.175118595f},
-std::array<float,2>{0.178843275f, 0.750009835f},
-std::array<float,2>{0.950964272f, 0.630089641f},
-std::array<float,2>{0.249750525f, 0.332812607f},
-std::array<float,2>{0.693887651f, 0.0970579535f},
-std::array<float,2>{0.379838318f, 0.90533334f},
-std::array<float,2>{0.557741463f, 0.868759513f},
-std::array<float,2>{0.34751305f, 0.211687073f},
-std::array<float,2>{0.813945532f, 0.492218345f},
-std::array<float,2>{0.0410887189f, 0.533254623f},
-std::array<float,2>{0.930435419f, 0.997124195f},
-std::array<float,2>{0.18082954f, 0.0053892592f},
-std::array<float,2>{0.643210888f, 0.266245246f},
-std::array<float,2>{0.455323905f, 0.701821685f},
-std::array<float,2>{0.601742983f, 0.594472528f},
-std::array<float,2>{0.261720568f, 0.432835042f},
-std::array<float,2>{0.760965109f, 0.125016272f},
-std::array<float,2>{0.0802467614f, 0.799877346f},
-std::array<float,2>{0.826578617f, 0.659031093f},
-std::array<float,2>{0.0350403599f, 0.347745359f},
-std::array<float,2>{0.553969562f, 0.072240904f},
-std::array<float,2>{0.356121063f, 0.922732115f},
-std::array<float,2>{0.700937569f, 0.831533015f},
-std::array<float,2>{0.385611087f, 0.234637156f},
-std::array<float,2>{0.94094336f, 0.460966498f},
-std::array<float,2>{0.238881424f, 0.509786844f},
-std::array<float,2>{0.792890489f, 0.764677346f},
-std::array<float,2>{0.118051618f, 0.185566977f},
-std::array<float,2>{0.565332353f, 0.400857478f},
-std::array<float,2>{0.2836667f, 0.588071108f},
-std::array<float,2>{0.680080116f, 0.732650042f},
-std::array<float,2>{0.493443072f, 0.309282959f},
-std::array<float,2>{0.891180336f, 0.0328726843f},
-std::array<float,2>{0.146415412f, 0.938251019f},
-std::array<float,2>{0.98050338f, 0.546847284f},
-std::array<float,2>{0.202959642f, 0.487835109f},
-std::array<float,2>{0.726356745f, 0.205038294f},
-std::array<float,2>{0.426111907f, 0.864063561f},
-std::array<float,2>{0.53045857f, 0.891340971f},
-std::array<float,2>{0.339858443f, 0.108106449f},
-std::array<float,2>{0.866844773f, 0.337231398f},
-std::array<float,2>{0.00540789776f, 0.639747024f},
-std::array<float,2>{0.962245822f, 0.845421255f},
-std::array<float,2>{0.222180188f, 0.196820706f},
-std::array<float,2>{0.717890143f, 0.472519666f},
-std::array<float,2>{0.394549757f, 0.561874747f},
-std::array<float,2>{0.532201409f, 0.654892802f},
-std::array<float,2>{0.360752493f, 0.314002901f},
-std::array<float,2>{0.829460144f, 0.123285241f},
-std::array<float,2>{0.0623027906f, 0.881789982f},
-std::array<float,2>{0.773280799f, 0.567316473f},
-std::array<float,2>{0.0657531098f, 0.376013458f},
-std::array<float,2>{0.616290808f, 0.169244245f},
-std::array<float,2>{0.266383976f, 0.779982626f},
-std::array<float,2>{0.634371459f, 0.966830313f},
-std::array<float,2>{0.448358238f, 0.0609481484f},
-std::array<float,2>{0.911996782f, 0.294427276f},
-std::array<float,2>{0.161437526f, 0.744324565f},
-std::array<float,2>{0.855214953f, 0.912295997f},
-std::array<float,2>{0.0186145883f, 0.0875095651f},
-std::array<float,2>{0.513480127f, 0.371111393f},
-std::array<float,2>{0.316384107f, 0.678344965f},
-std::array<float,2>{0.746519029f, 0.516417027f},
-std::array<float,2>{0.420994341f, 0.452615827f},
-std::array<float,2>{0.988209367f, 0.221280426f},
-std::array<float,2>{0.210638866f, 0.812924802f},
-std::array<float,2>{0.888713717f, 0.709951103f},
-std::array<float,2>{0.136848226f, 0.250099897f},
-std::array<float,2>{0.667202413f, 0.0207503997f},
-std::array<float,2>{0.472219139f, 0.975965321f},
-std::array<float,2>{0.580052555f, 0.79111743f},
-std::array<float,2>{0.299710006f, 0.148772657f},
-std::array<float,2>{0.811833084f, 0.416060388f},
-std::array<float,2>{0.105287001f, 0.611557305f},
-std::array<float,2>{0.983258069f, 0.938821614f},
-std::array<float,2>{0.200448006f, 0.0317629725f},
-std::array<float,2>{0.723056018f, 0.309847027f},
-std::array<float,2>{0.429031581f, 0.733798683f},
-std::array<float,2>{0.528034925f, 0.589696825f},
-std::array<float,2>{0.342523873f, 0.401897311f},
-std::array<float,2>{0.864078462f, 0.187400579f},
-std::array<float,2>{0.00601949822f, 0.764626622f},
-std::array<float,2>{0.789392054f, 0.639543891f},
-std::array<float,2>{0.120125011f, 0.336829513f},
-std::array<float,2>{0.563571453f, 0.108604491f},
-std::array<float,2>{0.282906681f, 0.891663074f},
-std::array<float,2>{0.682204485f, 0.864626527f},
-std::array<float,2>{0.494226903f, 0.203451514f},
-std::array<float,2>{0.893954277f, 0.487293333f},
-std::array<float,2>{0.146790966f, 0.544935346f},
-std::array<float,2>{0.824639261f, 0.798852086f},
-std::array<float,2>{0.0321926288f, 0.126346529f},
-std::array<float,2>{0.551423967f, 0.432142854f},
-std::array<float,2>{0.35907802f, 0.594972968f},
-std::array<float,2>{0.702226937f, 0.702308238f},
-std::array<float,2>{0.383997291f, 0.266874433f},
-std::array<float,2>{0.938833177f, 0.00466616172f},
-std::array<float,2>{0.241832256f, 0.996291339f},
-std::array<float,2>{0.932055116f, 0.511546135f},
-std::array<float,2>{0.183566093f, 0.46194002f},
-std::array<float,2>{0.642217875f, 0.2357831f},
-std::array<float,2>{0.454860181f, 0.830787897f},
-std::array<float,2>{0.604719102f, 0.923540235f},
-std::array<float,2>{0.265205652f, 0.0707836822f},
-std::array<float,2>{0.759548068f, 0.349566907f},
-std::array<float,2>{0.0795440972f, 0.659968913f},
-std::array<float,2>{0.888163865f, 0.814428031f},
-std::array<float,2>{0.140519738f, 0.222520113f},
-std::array<float,2>{0.665777802f, 0.451892257f},
-std::array<float,2>{0.470500827f, 0.517522454f},
-std::array<float,2>{0.581760705f, 0.678884864f},
-std::array<float,2>{0.297506064f, 0.372257978f},
-std::array<float,2>{0.809574008f, 0.0860648081f},
-std::array<float,2>{0.101856366f, 0.913579524f},
-std::array<float,2>{0.852882326f, 0.612998605f},
-std::array<float,2>{0.01684184f, 0.417146057f},
-std::array<float,2>{0.513673365f, 0.149815977f},
-std::array<float,2>{0.313994944f, 0.792036355f},
-std::array<float,2>{0.749385655f, 0.975523174f},
-std::array<float,2>{0.419167161f, 0.0203968938f},
-std::array<float,2>{0.98613286f, 0.251526743f},
-std::array<float,2>{0.207337245f, 0.710845768f},
-std::array<float,2>{0.770200849f, 0.882578552f},
-std::array<float,2>{0.0629550889f, 0.124398775f},
-std::array<float,2>{0.61487931f, 0.312841773f},
-std::array<float,2>{0.268327981f, 0.656051695f},
-std::array<float,2>{0.636696935f, 0.560686111f},
-std::array<float,2>{0.445727229f, 0.471378297f},
-std::array<float,2>{0.913814783f, 0.195915639f},
-std::array<float,2>{0.162964121f, 0.84406358f},
-std::array<float,2>{0.964056432f, 0.74549365f},
-std::array<float,2>{0.219311818f, 0.293648154f},
-std::array<float,2>{0.715512395f, 0.0623230301f},
-std::array<float,2>{0.397864878f, 0.968207836f},
-std::array<float,2>{0.534995973f, 0.780715406f},
-std::array<float,2>{0.362548053f, 0.168503955f},
-std::array<float,2>{0.83133322f, 0.375319004f},
-std::array<float,2>{0.0586561896f, 0.568178892f},
-std::array<float,2>{0.916452169f, 0.919888198f},
-std::array<float,2>{0.171171769f, 0.0789835826f},
-std::array<float,2>{0.625520766f, 0.360810369f},
-std::array<float,2>{0.437591761f, 0.684671462f},
-std::array<float,2>{0.621096373f, 0.524068952f},
-std::array<float,2>{0.281050622f, 0.443901479f},
-std::array<float,2>{0.777990043f, 0.233564124f},
-std::array<float,2>{0.0776468962f, 0.826516092f},
-std::array<float,2>{0.842114449f, 0.715661108f},
-std::array<float,2>{0.0513605922f, 0.259149671f},
-std::array<float,2>{0.539525211f, 0.0274953544f},
-std::array<float,2>{0.373386323f, 0.978362978f},
-std::array<float,2>{0.705834031f, 0.783933043f},
-std::array<float,2>{0.399473786f, 0.148137197f},
-std::array<float,2>{0.957538784f, 0.412422091f},
-std::array<float,2>{0.22995162f, 0.622108221f},
-std::array<float,2>{0.800356925f, 0.858969569f},
-std::array<float,2>{0.0952893272f, 0.194664732f},
-std::array<float,2>{0.588225007f, 0.480734527f},
-std::array<float,2>{0.311960399f, 0.55146265f},
-std::array<float,2>{0.662021577f, 0.640728712f},
-std::array<float,2>{0.478589624f, 0.326114237f},
-std::array<float,2>{0.876140714f, 0.109545514f},
-std::array<float,2>{0.125517711f, 0.885688245f},
-std::array<float,2>{0.9962852f, 0.574545741f},
-std::array<float,2>{0.214429393f, 0.384229004f},
-std::array<float,2>{0.738071263f, 0.157577276f},
-std::array<float,2>{0.410724133f, 0.768333316f},
-std::array<float,2>{0.502040684f, 0.96059978f},
-std::array<float,2>{0.327785671f, 0.0479560234f},
-std::array<float,2>{0.845372856f, 0.287540138f},
-std::array<float,2>{0.0252385102f, 0.734867394f},
-std::array<float,2>{0.951780021f, 0.751079381f},
-std::array<float,2>{0.247249976f, 0.174762622f},
-std::array<float,2>{0.693252027f, 0.39664343f},
-std::array<float,2>{0.381039709f, 0.579077244f},
-std::array<float,2>{0.556167066f, 0.7235291f},
-std::array<float,2>{0.344379872f, 0.30084002f},
-std::array<float,2>{0.814512968f, 0.0394569971f},
-std::array<float,2>{0.0406239033f, 0.946187139f},
-std::array<float,2>{0.756756246f, 0.534295917f},
-std::array<float,2>{0.0895063281f, 0.493175149f},
-std::array<float,2>{0.594454467f, 0.212874487f},
-std::array<float,2>{0.255408674f, 0.867788374f},
-std::array<float,2>{0.651957333f, 0.904328048f},
-std::array<float,2>{0.466597438f, 0.0960088447f},
-std::array<float,2>{0.928117335f, 0.333084106f},
-std::array<float,2>{0.177135602f, 0.629039407f},
-std::array<float,2>{0.874422669f, 0.988989353f},
-std::array<float,2>{0.0122925527f, 0.0110470364f},
-std::array<float,2>{0.51789993f, 0.280784547f},
-std::array<float,2>{0.329906285f, 0.691944897f},
-std::array<float,2>{0.731849551f, 0.60637325f},
-std::array<float,2>{0.431466758f, 0.4278934f},
-std::array<float,2>{0.96961236f, 0.137800932f},
-std::array<float,2>{0.191493735f, 0.808110237f},
-std::array<float,2>{0.901389539f, 0.668237388f},
-std::array<float,2>{0.153331414f, 0.352887541f},
-std::array<float,2>{0.677528083f, 0.0682002082f},
-std::array<float,2>{0.490422189f, 0.936991751f},
-std::array<float,2>{0.576581836f, 0.84283632f},
-std::array<float,2>{0.28993398f, 0.248683676f},
-std::array<float,2>{0.78721875f, 0.457699776f},
-std::array<float,2>{0.111112021f, 0.502299011f},
-std::array<float,2>{0.954687834f, 0.897433043f},
-std::array<float,2>{0.232372552f, 0.101831719f},
-std::array<float,2>{0.70709604f, 0.341888189f},
-std::array<float,2>{0.404899001f, 0.636405528f},
-std::array<float,2>{0.542983294f, 0.539622247f},
-std::array<float,2>{0.370418966f, 0.488371611f},
-std::array<float,2>{0.839001894f, 0.207910836f},
-std::array<float,2>{0.0472772866f, 0.860711038f},
-std::array<float,2>{0.775270879f, 0.729088247f},
-std::array<float,2>{0.0720158145f, 0.308254629f},
-std::array<float,2>{0.619719446f, 0.038457647f},
-std::array<float,2>{0.274436235f, 0.942833543f},
-std::array<float,2>{0.630651712f, 0.759330273f},
-std::array<float,2>{0.442434371f, 0.182560742f},
-std::array<float,2>{0.921051741f, 0.405956298f},
-std::array<float,2>{0.16668506f, 0.590833306f},
-std::array<float,2>{0.849344492f, 0.834390998f},
-std::array<float,2>{0.0301278941f, 0.241286516f},
-std::array<float,2>{0.505290806f, 0.466010123f},
-std::array<float,2>{0.320703745f, 0.512054026f},
-std::array<float,2>{0.742119491f, 0.663755238f},
-std::array<float,2>{0.406837285f, 0.345860809f},
-std::array<float,2>{0.992271125f, 0.0770443976f},
-std::array<float,2>{0.216648132f, 0.928112328f},
-std::array<float,2>{0.880368531f, 0.598401248f},
-std::array<float,2>{0.131244168f, 0.436976165f},
-std::array<float,2>{0.657736123f, 0.129109502f},
-std::array<float,2>{0.48324433f, 0.803481877f},
-std::array<float,2>{0.592827678f, 0.994379282f},
-std::array<float,2>{0.30699119f, 6.33284944e-05f},
-std::array<float,2>{0.804431021f, 0.270789891f},
-std::array<float,2>{0.100124709f, 0.698976934f},
-std::array<float,2>{0.923770845f, 0.792984962f},
-std::array<float,2>{0.173197463f, 0.154131949f},
-std::array<float,2>{0.654296696f, 0.417983592f},
-std::array<float,2>{0.463487178f, 0.614783406f},
-std::array<float,2>{0.600949526f, 0.704056084f},
-std::array<float,2>{0.250792593f, 0.257374167f},
-std::array<float,2>{0.750207126f, 0.0175939929f},
-std::array<float,2>{0.090557307f, 0.9692384f},
-std::array<float,2>{0.817380786f, 0.520437956f},
-std::array<float,2>{0.0452577546f, 0.448137552f},
-std::array<float,2>{0.558821023f, 0.225504085f},
-std::array<float,2>{0.351508886f, 0.81793344f},
-std::array<float,2>{0.69041127f, 0.909169734f},
-std::array<float,2>{0.375958651f, 0.0919616297f},
-std::array<float,2>{0.945872366f, 0.369387716f},
-std::array<float,2>{0.244490355f, 0.674922526f},
-std::array<float,2>{0.782989621f, 0.964070916f},
-std::array<float,2>{0.11531584f, 0.0558168404f},
-std::array<float,2>{0.573092103f, 0.290242761f},
-std::array<float,2>{0.295398176f, 0.747687817f},
-std::array<float,2>{0.674331129f, 0.566239655f},
-std::array<float,2>{0.48497203f, 0.378998518f},
-std::array<float,2>{0.903659344f, 0.165681601f},
-std::array<float,2>{0.148664743f, 0.775572717f},
-std::array<float,2>{0.976409197f, 0.648622811f},
-std::array<float,2>{0.190722555f, 0.317061424f},
-std::array<float,2>{0.728776038f, 0.118405528f},
-std::array<float,2>{0.433997542f, 0.878898621f},
-std::array<float,2>{0.521567166f, 0.849281192f},
-std::array<float,2>{0.332656443f, 0.201992899f},
-std::array<float,2>{0.867581546f, 0.474299788f},
-std::array<float,2>{0.00959586911f, 0.556122482f},
-std::array<float,2>{0.894798279f, 0.981295705f},
-std::array<float,2>{0.141233444f, 0.0269058142f},
-std::array<float,2>{0.685710669f, 0.262650937f},
-std::array<float,2>{0.49681893f, 0.712344289f},
-std::array<float,2>{0.566927493f, 0.619589806f},
-std::array<float,2>{0.28720066f, 0.408612013f},
-std::array<float,2>{0.796734512f, 0.144397825f},
-std::array<float,2>{0.12472073f, 0.78833735f},
-std::array<float,2>{0.862808883f, 0.682782412f},
-std::array<float,2>{0.000966911437f, 0.366201013f},
-std::array<float,2>{0.524262249f, 0.0848006681f},
-std::array<float,2>{0.339559793f, 0.916469693f},
-std::array<float,2>{0.722444713f, 0.823325992f},
-std::array<float,2>{0.425270498f, 0.226844475f},
-std::array<float,2>{0.979043245f, 0.440731496f},
-std::array<float,2>{0.196628422f, 0.530718148f},
-std::array<float,2>{0.764837027f, 0.771348417f},
-std::array<float,2>{0.084518455f, 0.162184328f},
-std::array<float,2>{0.605775833f, 0.388748676f},
-std::array<float,2>{0.261220694f, 0.573509991f},
-std::array<float,2>{0.64543277f, 0.74189496f},
-std::array<float,2>{0.460249573f, 0.282640427f},
-std::array<float,2>{0.935816467f, 0.051410649f},
-std::array<float,2>{0.183627144f, 0.954799294f},
-std::array<float,2>{0.943279624f, 0.549183846f},
-std::array<float,2>{0.235649467f, 0.480461419f},
-std::array<float,2>{0.69623059f, 0.190705046f},
-std::array<float,2>{0.387024194f, 0.852498651f},
-std::array<float,2>{0.547375143f, 0.890552223f},
-std::array<float,2>{0.351830512f, 0.114383675f},
-std::array<float,2>{0.822347581f, 0.321041971f},
-std::array<float,2>{0.0388304628f, 0.645160675f},
-std::array<float,2>{0.990386367f, 0.874682009f},
-std::array<float,2>{0.205149293f, 0.218709618f},
-std::array<float,2>{0.744648218f, 0.499091476f},
-std::array<float,2>{0.416821152f, 0.538797736f},
-std::array<float,2>{0.508892f, 0.628884614f},
-std::array<float,2>{0.318998545f, 0.331223428f},
-std::array<float,2>{0.857310712f, 0.0987417474f},
-std::array<float,2>{0.0228463616f, 0.899851978f},
-std::array<float,2>{0.807763696f, 0.58383745f},
-std::array<float,2>{0.10653618f, 0.39150095f},
-std::array<float,2>{0.585415959f, 0.179359317f},
-std::array<float,2>{0.303245515f, 0.755166113f},
-std::array<float,2>{0.668728411f, 0.951394618f},
-std::array<float,2>{0.47499457f, 0.0438935719f},
-std::array<float,2>{0.885491312f, 0.300130397f},
-std::array<float,2>{0.13620697f, 0.719234705f},
-std::array<float,2>{0.832166076f, 0.932710052f},
-std::array<float,2>{0.0573736876f, 0.0661258325f},
-std::array<float,2>{0.537082374f, 0.355579466f},
-std::array<float,2>{0.367055029f, 0.664210916f},
-std::array<float,2>{0.713858187f, 0.507011831f},
-std::array<float,2>{0.392146707f, 0.45663622f},
-std::array<float,2>{0.965300322f, 0.243056834f},
-std::array<float,2>{0.224802971f, 0.838444948f},
-std::array<float,2>{0.908587337f, 0.68963027f},
-std::array<float,2>{0.157594621f, 0.275503844f},
-std::array<float,2>{0.638112724f, 0.0153523497f},
-std::array<float,2>{0.450332075f, 0.984912992f},
-std::array<float,2>{0.61192584f, 0.810034394f},
-std::array<float,2>{0.271059602f, 0.134828806f},
-std::array<float,2>{0.76848793f, 0.423951149f},
-std::array<float,2>{0.0666812658f, 0.603842914f},
-std::array<float,2>{0.941232979f, 0.999552608f},
-std::array<float,2>{0.239203215f, 0.00587213458f},
-std::array<float,2>{0.700832248f, 0.268342137f},
-std::array<float,2>{0.385493696f, 0.700870156f},
-std::array<float,2>{0.553906024f, 0.597650886f},
-std::array<float,2>{0.356225163f, 0.429727703f},
-std::array<float,2>{0.826368153f, 0.128746539f},
-std::array<float,2>{0.0347116999f, 0.797997534f},
-std::array<float,2>{0.761043251f, 0.656688869f},
-std::array<float,2>{0.0803267658f, 0.350451797f},
-std::array<float,2>{0.60197264f, 0.0727237761f},
-std::array<float,2>{0.262129426f, 0.925278246f},
-std::array<float,2>{0.643467009f, 0.828491807f},
-std::array<float,2>{0.455093026f, 0.23659721f},
-std::array<float,2>{0.930286527f, 0.464020282f},
-std::array<float,2>{0.181122035f, 0.509460628f},
-std::array<float,2>{0.867013752f, 0.762393415f},
-std::array<float,2>{0.00579649583f, 0.185192272f},
-std::array<float,2>{0.530756891f, 0.400268435f},
-std::array<float,2>{0.340310127f, 0.587484956f},
-std::array<float,2>{0.726302385f, 0.731156468f},
-std::array<float,2>{0.425974011f, 0.310921818f},
-std::array<float,2>{0.980745316f, 0.0334430113f},
-std::array<float,2>{0.202798277f, 0.940865815f},
-std::array<float,2>{0.891465068f, 0.543642282f},
-std::array<float,2>{0.146197841f, 0.485436618f},
-std::array<float,2>{0.679814637f, 0.206234038f},
-std::array<float,2>{0.493262947f, 0.866728902f},
-std::array<float,2>{0.565020978f, 0.893143177f},
-std::array<float,2>{0.283367515f, 0.106154606f},
-std::array<float,2>{0.792660236f, 0.337969542f},
-std::array<float,2>{0.117783524f, 0.637071848f},
-std::array<float,2>{0.911809564f, 0.846049309f},
-std::array<float,2>{0.161150217f, 0.199104801f},
-std::array<float,2>{0.634616852f, 0.47038576f},
-std::array<float,2>{0.448721468f, 0.558833718f},
-std::array<float,2>{0.616691828f, 0.653837383f},
-std::array<float,2>{0.266113371f, 0.314843118f},
-std::array<float,2>{0.773169458f, 0.122662105f},
-std::array<float,2>{0.0656337738f, 0.879169226f},
-std::array<float,2>{0.829268932f, 0.569873154f},
-std::array<float,2>{0.0620486327f, 0.377428025f},
-std::array<float,2>{0.531789958f, 0.171000138f},
-std::array<float,2>{0.360371649f, 0.777495801f},
-std::array<float,2>{0.718123496f, 0.966712713f},
-std::array<float,2>{0.394818038f, 0.0594798066f},
-std::array<float,2>{0.962114871f, 0.295390338f},
-std::array<float,2>{0.222597346f, 0.744122446f},
-std::array<float,2>{0.811645746f, 0.911815584f},
-std::array<float,2>{0.104999274f, 0.0882365033f},
-std::array<float,2>{0.579743207f, 0.373976111f},
-std::array<float,2>{0.299361646f, 0.677453697f},
-std::array<float,2>{0.667421281f, 0.51828897f},
-std::array<float,2>{0.472615123f, 0.449569315f},
-std::array<float,2>{0.88907671f, 0.220699057f},
-std::array<float,2>{0.137181982f, 0.816100717f},
-std::array<float,2>{0.987944424f, 0.708551228f},
-std::array<float,2>{0.210708469f, 0.252643764f},
-std::array<float,2>{0.746123195f, 0.0233859774f},
-std::array<float,2>{0.421326071f, 0.974499285f},
-std::array<float,2>{0.513395131f, 0.790660024f},
-std::array<float,2>{0.316069752f, 0.150998086f},
-std::array<float,2>{0.855329096f, 0.414219201f},
-std::array<float,2>{0.0188196134f, 0.611082673f},
-std::array<float,2>{0.877208412f, 0.88474226f},
-std::array<float,2>{0.127140254f, 0.111654706f},
-std::array<float,2>{0.662738442f, 0.326725364f},
-std::array<float,2>{0.478182435f, 0.643818021f},
-std::array<float,2>{0.587098956f, 0.553604722f},
-std::array<float,2>{0.310326844f, 0.483086765f},
-std::array<float,2>{0.79703629f, 0.192189395f},
-std::array<float,2>{0.0967830047f, 0.855828106f},
-std::array<float,2>{0.847350478f, 0.737297058f},
-std::array<float,2>{0.0272573903f, 0.286589652f},
-std::array<float,2>{0.501574159f, 0.0504501909f},
-std::array<float,2>{0.32533884f, 0.958243847f},
-std::array<float,2>{0.735225439f, 0.766457915f},
-std::array<float,2>{0.412702411f, 0.158445105f},
-std::array<float,2>{0.999395072f, 0.386283129f},
-std::array<float,2>{0.212599337f, 0.577600718f},
-std::array<float,2>{0.779626846f, 0.824801147f},
-std::array<float,2>{0.0743267536f, 0.232134834f},
-std::array<float,2>{0.623337507f, 0.443101019f},
-std::array<float,2>{0.278709412f, 0.526910484f},
-std::array<float,2>{0.628572404f, 0.687072039f},
-std::array<float,2>{0.441183925f, 0.363213092f},
-std::array<float,2>{0.914673865f, 0.0810630694f},
-std::array<float,2>{0.168591902f, 0.920086682f},
-std::array<float,2>{0.960634589f, 0.623943031f},
-std::array<float,2>{0.227977842f, 0.410445243f},
-std::array<float,2>{0.704963267f, 0.145593405f},
-std::array<float,2>{0.400974035f, 0.782277167f},
-std::array<float,2>{0.54156065f, 0.980292559f},
-std::array<float,2>{0.372545838f, 0.0303839073f},
-std::array<float,2>{0.841423988f, 0.260704488f},
-std::array<float,2>{0.054572586f, 0.717060387f},
-std::array<float,2>{0.971698523f, 0.805821776f},
-std::array<float,2>{0.195177481f, 0.139657512f},
-std::array<float,2>{0.733179927f, 0.42660135f},
-std::array<float,2>{0.431865692f, 0.608049989f},
-std::array<float,2>{0.515675664f, 0.694321871f},
-std::array<float,2>{0.331039816f, 0.279267222f},
-std::array<float,2>{0.872813344f, 0.0085282987f},
-std::array<float,2>{0.0140616037f, 0.991321206f},
-std::array<float,2>{0.786564469f, 0.500945508f},
-std::array<float,2>{0.112418704f, 0.460414708f},
-std::array<float,2>{0.575937688f, 0.246779442f},
-std::array<float,2>{0.291890651f, 0.840996087f},
-std::array<float,2>{0.677920401f, 0.9343642f},
-std::array<float,2>{0.490229428f, 0.0699908361f},
-std::array<float,2>{0.898573697f, 0.355146199f},
-std::array<float,2>{0.15507108f, 0.670706809f},
-std::array<float,2>{0.813561976f, 0.94729799f},
-std::array<float,2>{0.0413606949f, 0.0428815894f},
-std::array<float,2>{0.558060944f, 0.303316921f},
-std::array<float,2>{0.347274035f, 0.724923313f},
-std::array<float,2>{0.694301605f, 0.580468833f},
-std::array<float,2>{0.379504979f, 0.394854873f},
-std::array<float,2>{0.950830281f, 0.172639966f},
-std::array<float,2>{0.249999151f, 0.752723873f},
-std::array<float,2>{0.925858736f, 0.632231891f},
-std::array<float,2>{0.179086164f, 0.335083216f},
-std::array<float,2>{0.650259614f, 0.0939940289f},
-std::array<float,2>{0.468345135f, 0.903057337f},
-std::array<float,2>{0.596946239f, 0.870308459f},
-std::array<float,2>{0.256040126f, 0.213277578f},
-std::array<float,2>{0.755341589f, 0.495208353f},
-std::array<float,2>{0.0866139457f, 0.531341314f},
-std::array<float,2>{0.995249689f, 0.926774144f},
-std::array<float,2>{0.2181582f, 0.0748120993f},
-std::array<float,2>{0.738901556f, 0.343767017f},
-std::array<float,2>{0.409653097f, 0.661972225f},
-std::array<float,2>{0.506600678f, 0.515257537f},
-std::array<float,2>{0.32231009f, 0.467327565f},
-std::array<float,2>{0.851287723f, 0.23831667f},
-std::array<float,2>{0.0274221003f, 0.832085907f},
-std::array<float,2>{0.801832199f, 0.696643829f},
-std::array<float,2>{0.0979200304f, 0.272812068f},
-std::array<float,2>{0.590162098f, 0.00214438257f},
-std::array<float,2>{0.306327969f, 0.992811441f},
-std::array<float,2>{0.659356356f, 0.801502824f},
-std::array<float,2>{0.481404036f, 0.131930694f},
-std::array<float,2>{0.881144643f, 0.435294658f},
-std::array<float,2>{0.129976347f, 0.600856721f},
-std::array<float,2>{0.836237609f, 0.861847639f},
-std::array<float,2>{0.0498558693f, 0.209483564f},
-std::array<float,2>{0.545739472f, 0.491239995f},
-std::array<float,2>{0.367210209f, 0.542250276f},
-std::array<float,2>{0.709269285f, 0.63296932f},
-std::array<float,2>{0.403976053f, 0.341398209f},
-std::array<float,2>{0.955548108f, 0.104870953f},
-std::array<float,2>{0.233846188f, 0.89549005f},
-std::array<float,2>{0.91938287f, 0.592275143f},
-std::array<float,2>{0.164975002f, 0.40379107f},
-std::array<float,2>{0.632286251f, 0.179926515f},
-std::array<float,2>{0.445263088f, 0.76071012f},
-std::array<float,2>{0.617589116f, 0.94410193f},
-std::array<float,2>{0.275459528f, 0.0356533416f},
-std::array<float,2>{0.776576042f, 0.305213541f},
-std::array<float,2>{0.0732110664f, 0.727896988f},
-std::array<float,2>{0.906072199f, 0.774014533f},
-std::array<float,2>{0.150422335f, 0.166883335f},
-std::array<float,2>{0.672923565f, 0.382677674f},
-std::array<float,2>{0.487790912f, 0.564081728f},
-std::array<float,2>{0.571640134f, 0.748228014f},
-std::array<float,2>{0.29480809f, 0.292277485f},
-std::array<float,2>{0.783412516f, 0.0581902787f},
-std::array<float,2>{0.114323519f, 0.962642252f},
-std::array<float,2>{0.869459271f, 0.557397485f},
-std::array<float,2>{0.0103154574f, 0.476061136f},
-std::array<float,2>{0.520380974f, 0.200734124f},
-std::array<float,2>{0.335273921f, 0.850613058f},
-std::array<float,2>{0.728162229f, 0.875859976f},
-std::array<float,2>{0.436426878f, 0.120598592f},
-std::array<float,2>{0.973631322f, 0.319440931f},
-std::array<float,2>{0.189261243f, 0.651756704f},
-std::array<float,2>{0.753825068f, 0.971656501f},
-std::array<float,2>{0.0933840573f, 0.0159489494f},
-std::array<float,2>{0.598966241f, 0.255317092f},
-std::array<float,2>{0.252115667f, 0.70601058f},
-std::array<float,2>{0.654538512f, 0.616736889f},
-std::array<float,2>{0.462864667f, 0.420045018f},
-std::array<float,2>{0.923845828f, 0.154511496f},
-std::array<float,2>{0.174627721f, 0.795302451f},
-std::array<float,2>{0.948104084f, 0.672494352f},
-std::array<float,2>{0.243050531f, 0.368974686f},
-std::array<float,2>{0.68880713f, 0.0914177969f},
-std::array<float,2>{0.378496468f, 0.90800041f},
-std::array<float,2>{0.561842382f, 0.819028318f},
-std::array<float,2>{0.348114908f, 0.223432228f},
-std::array<float,2>{0.819156945f, 0.447151601f},
-std::array<float,2>{0.044331193f, 0.522605896f},
-std::array<float,2>{0.933683276f, 0.956619442f},
-std::array<float,2>{0.186793134f, 0.0535504818f},
-std::array<float,2>{0.647606552f, 0.284632921f},
-std::array<float,2>{0.457919806f, 0.739376545f},
-std::array<float,2>{0.608159125f, 0.570341468f},
-std::array<float,2>{0.259202421f, 0.387649536f},
-std::array<float,2>{0.763135672f, 0.16141586f},
-std::array<float,2>{0.0828913599f, 0.772994041f},
-std::array<float,2>{0.820874214f, 0.646629155f},
-std::array<float,2>{0.0370203219f, 0.323209018f},
-std::array<float,2>{0.550252676f, 0.116008863f},
-std::array<float,2>{0.353999346f, 0.888455987f},
-std::array<float,2>{0.698257208f, 0.85399133f},
-std::array<float,2>{0.389208496f, 0.188554794f},
-std::array<float,2>{0.944722474f, 0.476642191f},
-std::array<float,2>{0.237888187f, 0.547508538f},
-std::array<float,2>{0.793006361f, 0.786345184f},
-std::array<float,2>{0.122115687f, 0.142398223f},
-std::array<float,2>{0.568517804f, 0.406662226f},
-std::array<float,2>{0.285455257f, 0.617189407f},
-std::array<float,2>{0.685168624f, 0.714675725f},
-std::array<float,2>{0.499714077f, 0.265002668f},
-std::array<float,2>{0.897237718f, 0.0241475087f},
-std::array<float,2>{0.143252894f, 0.982629657f},
-std::array<float,2>{0.978273869f, 0.528093576f},
-std::array<float,2>{0.198050812f, 0.438421428f},
-std::array<float,2>{0.71976757f, 0.229599759f},
-std::array<float,2>{0.423819363f, 0.821716011f},
-std::array<float,2>{0.525747776f, 0.914730906f},
-std::array<float,2>{0.336573184f, 0.0833464786f},
-std::array<float,2>{0.86086756f, 0.3635602f},
-std::array<float,2>{0.00326643814f, 0.680531681f},
-std::array<float,2>{0.967328727f, 0.83719039f},
-std::array<float,2>{0.224489644f, 0.245996311f},
-std::array<float,2>{0.712592542f, 0.454510123f},
-std::array<float,2>{0.394333541f, 0.504186213f},
-std::array<float,2>{0.537587404f, 0.666621566f},
-std::array<float,2>{0.364084303f, 0.35819149f},
-std::array<float,2>{0.835307479f, 0.0634558871f},
-std::array<float,2>{0.0565715991f, 0.9314906f},
-std::array<float,2>{0.766928613f, 0.603174806f},
-std::array<float,2>{0.0698275492f, 0.423466474f},
-std::array<float,2>{0.610478461f, 0.132844746f},
-std::array<float,2>{0.272324383f, 0.812112212f},
-std::array<float,2>{0.64009285f, 0.987892032f},
-std::array<float,2>{0.451545447f, 0.0132279042f},
-std::array<float,2>{0.906682193f, 0.274167567f},
-std::array<float,2>{0.159591213f, 0.688742757f},
-std::array<float,2>{0.858997703f, 0.90123409f},
-std::array<float,2>{0.0197656248f, 0.100278527f},
-std::array<float,2>{0.509939313f, 0.329817742f},
-std::array<float,2>{0.318273753f, 0.626797557f},
-std::array<float,2>{0.742998898f, 0.535820603f},
-std::array<float,2>{0.415703386f, 0.497409821f},
-std::array<float,2>{0.988806069f, 0.215678766f},
-std::array<float,2>{0.203892544f, 0.872304916f},
-std::array<float,2>{0.884726524f, 0.722304165f},
-std::array<float,2>{0.134287164f, 0.298787683f},
-std::array<float,2>{0.670012772f, 0.045911286f},
-std::array<float,2>{0.472686201f, 0.950438321f},
-std::array<float,2>{0.583013058f, 0.756138146f},
-std::array<float,2>{0.301263124f, 0.17698954f},
-std::array<float,2>{0.804922342f, 0.3939358f},
-std::array<float,2>{0.108285435f, 0.585653663f},
-std::array<float,2>{0.984965265f, 0.97311312f},
-std::array<float,2>{0.208705455f, 0.0216182917f},
-std::array<float,2>{0.748636425f, 0.253740221f},
-std::array<float,2>{0.41800639f, 0.70783186f},
-std::array<float,2>{0.515610754f, 0.609942496f},
-std::array<float,2>{0.313248456f, 0.415656656f},
-std::array<float,2>{0.85215193f, 0.151640788f},
-std::array<float,2>{0.0157560762f, 0.789285421f},
-std::array<float,2>{0.808846712f, 0.676170349f},
-std::array<float,2>{0.102778457f, 0.37475875f},
-std::array<float,2>{0.580724955f, 0.0890432f},
-std::array<float,2>{0.297890842f, 0.910393894f},
-std::array<float,2>{0.664365768f, 0.814567626f},
-std::array<float,2>{0.46918121f, 0.218777657f},
-std::array<float,2>{0.88740468f, 0.450580299f},
-std::array<float,2>{0.139107212f, 0.519240677f},
-std::array<float,2>{0.830498517f, 0.77852416f},
-std::array<float,2>{0.0601497851f, 0.170526326f},
-std::array<float,2>{0.534028411f, 0.378036797f},
-std::array<float,2>{0.361806601f, 0.569017112f},
-std::array<float,2>{0.716317952f, 0.742346048f},
-std::array<float,2>{0.397228628f, 0.295981199f},
-std::array<float,2>{0.963429749f, 0.0600187555f},
-std::array<float,2>{0.220472082f, 0.965724051f},
-std::array<float,2>{0.912363291f, 0.560133398f},
-std::array<float,2>{0.163702518f, 0.469353408f},
-std::array<float,2>{0.635417581f, 0.197324514f},
-std::array<float,2>{0.447229922f, 0.847184718f},
-std::array<float,2>{0.614228666f, 0.88043499f},
-std::array<float,2>{0.268946558f, 0.12123239f},
-std::array<float,2>{0.771429837f, 0.31615153f},
-std::array<float,2>{0.0642601326f, 0.652896345f},
-std::array<float,2>{0.892812848f, 0.865779281f},
-std::array<float,2>{0.147930175f, 0.205834329f},
-std::array<float,2>{0.682658792f, 0.484812081f},
-std::array<float,2>{0.495603293f, 0.54424423f},
-std::array<float,2>{0.563416541f, 0.638387144f},
-std::array<float,2>{0.281892091f, 0.339429647f},
-std::array<float,2>{0.790180206f, 0.10741429f},
-std::array<float,2>{0.11967174f, 0.893727303f},
-std::array<float,2>{0.864960074f, 0.586068034f},
-std::array<float,2>{0.00776312407f, 0.398850411f},
-std::array<float,2>{0.528975546f, 0.183937192f},
-std::array<float,2>{0.343693525f, 0.763037026f},
-std::array<float,2>{0.723643959f, 0.939633548f},
-std::array<float,2>{0.428662181f, 0.0344808027f},
-std::array<float,2>{0.983783543f, 0.312391937f},
-std::array<float,2>{0.200001135f, 0.732268274f},
-std::array<float,2>{0.758720577f, 0.924164951f},
-std::array<float,2>{0.0789867938f, 0.0733327866f},
-std::array<float,2>{0.604008198f, 0.351273924f},
-std::array<float,2>{0.263873488f, 0.657857239f},
-std::array<float,2>{0.641131222f, 0.508038223f},
-std::array<float,2>{0.453563154f, 0.463287026f},
-std::array<float,2>{0.933039248f, 0.237573504f},
-std::array<float,2>{0.182562739f, 0.829330683f},
-std::array<float,2>{0.937620223f, 0.699509501f},
-std::array<float,2>{0.240953729f, 0.269217879f},
-std::array<float,2>{0.701899052f, 0.00754500227f},
-std::array<float,2>{0.383028239f, 0.998835802f},
-std::array<float,2>{0.552574158f, 0.797011852f},
-std::array<float,2>{0.357512325f, 0.127221003f},
-std::array<float,2>{0.826057017f, 0.431342751f},
-std::array<float,2>{0.0324451812f, 0.596203208f},
-std::array<float,2>{0.929234922f, 0.904017329f},
-std::array<float,2>{0.175904423f, 0.094727084f},
-std::array<float,2>{0.651318073f, 0.334512413f},
-std::array<float,2>{0.465068072f, 0.631023228f},
-std::array<float,2>{0.594916582f, 0.532258928f},
-std::array<float,2>{0.254690826f, 0.494839728f},
-std::array<float,2>{0.757140815f, 0.214441419f},
-std::array<float,2>{0.0886317939f, 0.869478285f},
-std::array<float,2>{0.815986395f, 0.725679219f},
-std::array<float,2>{0.039330624f, 0.303862303f},
-std::array<float,2>{0.555339932f, 0.0416328609f},
-std::array<float,2>{0.344859153f, 0.948632717f},
-std::array<float,2>{0.691816926f, 0.753476441f},
-std::array<float,2>{0.3820692f, 0.173552543f},
-std::array<float,2>{0.952905118f, 0.395969957f},
-std::array<float,2>{0.246866286f, 0.581888139f},
-std::array<float,2>{0.788570464f, 0.840427458f},
-std::array<float,2>{0.109876312f, 0.247286081f},
-std::array<float,2>{0.577349365f, 0.459814191f},
-std::array<float,2>{0.29047215f, 0.501831651f},
-std::array<float,2>{0.676076055f, 0.670922041f},
-std::array<float,2>{0.491941899f, 0.35434553f},
-std::array<float,2>{0.900948465f, 0.0691797584f},
-std::array<float,2>{0.152951553f, 0.93473345f},
-std::array<float,2>{0.970273018f, 0.608509064f},
-std::array<float,2>{0.19285509f, 0.427480757f},
-std::array<float,2>{0.730709672f, 0.13887386f},
-std::array<float,2>{0.43001917f, 0.8053146f},
-std::array<float,2>{0.519314468f, 0.990473866f},
-std::array<float,2>{0.328293592f, 0.00925644115f},
-std::array<float,2>{0.873838246f, 0.277662963f},
-std::array<float,2>{0.0129780686f, 0.694974482f},
-std::array<float,2>{0.958859026f, 0.781649292f},
-std::array<float,2>{0.228885606f, 0.145275533f},
-std::array<float,2>{0.706673026f, 0.411306858f},
-std::array<float,2>{0.398786873f, 0.62455076f},
-std::array<float,2>{0.540885985f, 0.718317926f},
-std::array<float,2>{0.374744713f, 0.261103392f},
-std::array<float,2>{0.84281683f, 0.0301689804f},
-std::array<float,2>{0.0526923425f, 0.978649378f},
-std::array<float,2>{0.778983772f, 0.526244164f},
-std::array<float,2>{0.0766434968f, 0.442253888f},
-std::array<float,2>{0.622506797f, 0.230676904f},
-std::array<float,2>{0.279944777f, 0.825366318f},
-std::array<float,2>{0.626339674f, 0.920910835f},
-std::array<float,2>{0.438819617f, 0.0801227242f},
-std::array<float,2>{0.917109549f, 0.361810744f},
-std::array<float,2>{0.170517981f, 0.686196446f},
-std::array<float,2>{0.844647884f, 0.957039893f},
-std::array<float,2>{0.0239621643f, 0.0491159931f},
-std::array<float,2>{0.503787398f, 0.285988837f},
-std::array<float,2>{0.326310933f, 0.737683654f},
-std::array<float,2>{0.737249255f, 0.576878488f},
-std::array<float,2>{0.411382556f, 0.385284185f},
-std::array<float,2>{0.997948945f, 0.159394085f},
-std::array<float,2>{0.21370919f, 0.766776145f},
-std::array<float,2>{0.875640512f, 0.643338382f},
-std::array<float,2>{0.126128674f, 0.327617347f},
-std::array<float,2>{0.660850167f, 0.113206141f},
-std::array<float,2>{0.479768217f, 0.883143783f},
-std::array<float,2>{0.58902508f, 0.857335508f},
-std::array<float,2>{0.310906976f, 0.193075657f},
-std::array<float,2>{0.799090743f, 0.48355034f},
-std::array<float,2>{0.0943272859f, 0.554321289f},
-std::array<float,2>{0.946366966f, 0.906827033f},
-std::array<float,2>{0.245906949f, 0.090286985f},
-std::array<float,2>{0.691321373f, 0.367568731f},
-std::array<float,2>{0.376379699f, 0.673126042f},
-std::array<float,2>{0.560358822f, 0.5219028f},
-std::array<float,2>{0.3502177f, 0.445725113f},
-std::array<float,2>{0.817946196f, 0.223695844f},
-std::array<float,2>{0.0466627292f, 0.819859266f},
-std::array<float,2>{0.751116991f, 0.706890166f},
-std::array<float,2>{0.0910751149f, 0.254109591f},
-std::array<float,2>{0.600090265f, 0.0171684101f},
-std::array<float,2>{0.251304239f, 0.972134531f},
-std::array<float,2>{0.65288502f, 0.796441436f},
-std::array<float,2>{0.464196056f, 0.15596804f},
-std::array<float,2>{0.921931863f, 0.421468645f},
-std::array<float,2>{0.172416851f, 0.615306616f},
-std::array<float,2>{0.868407071f, 0.849811792f},
-std::array<float,2>{0.00805700663f, 0.199938059f},
-std::array<float,2>{0.522798598f, 0.474873722f},
-std::array<float,2>{0.333751678f, 0.557850063f},
-std::array<float,2>{0.729739368f, 0.650847971f},
-std::array<float,2>{0.434696048f, 0.318757802f},
-std::array<float,2>{0.9746297f, 0.119193248f},
-std::array<float,2>{0.19035095f, 0.876132011f},
-std::array<float,2>{0.902796507f, 0.56253612f},
-std::array<float,2>{0.149747849f, 0.381738126f},
-std::array<float,2>{0.675578296f, 0.16715543f},
-std::array<float,2>{0.485787034f, 0.775371671f},
-std::array<float,2>{0.573974311f, 0.961002052f},
-std::array<float,2>{0.296503931f, 0.0568977632f},
-std::array<float,2>{0.781988323f, 0.291839778f},
-std::array<float,2>{0.116404645f, 0.749458134f},
-std::array<float,2>{0.92001611f, 0.760880411f},
-std::array<float,2>{0.167847246f, 0.181151435f},
-std::array<float,2>{0.62940222f, 0.402657121f},
-std::array<float,2>{0.441430897f, 0.593563318f},
-std::array<float,2>{0.620858908f, 0.727270007f},
-std::array<float,2>{0.273626596f, 0.306545943f},
-std::array<float,2>{0.773774803f, 0.0367892608f},
-std::array<float,2>{0.071004957f, 0.944911242f},
-std::array<float,2>{0.838606834f, 0.541024268f},
-std::array<float,2>{0.0479503013f, 0.490926564f},
-std::array<float,2>{0.544589996f, 0.210598797f},
-std::array<float,2>{0.36946857f, 0.862546265f},
-std::array<float,2>{0.708569944f, 0.896195233f},
-std::array<float,2>{0.405529201f, 0.103719354f},
-std::array<float,2>{0.953824639f, 0.340530425f},
-std::array<float,2>{0.231215388f, 0.633957565f},
-std::array<float,2>{0.803059697f, 0.994074881f},
-std::array<float,2>{0.100773253f, 0.00370379048f},
-std::array<float,2>{0.59234947f, 0.271725506f},
-std::array<float,2>{0.307754844f, 0.696017504f},
-std::array<float,2>{0.656945467f, 0.600504279f},
-std::array<float,2>{0.483717442f, 0.434019268f},
-std::array<float,2>{0.878950417f, 0.13091889f},
-std::array<float,2>{0.132695779f, 0.802556813f},
-std::array<float,2>{0.993889391f, 0.660160124f},
-std::array<float,2>{0.215164036f, 0.344969779f},
-std::array<float,2>{0.741037488f, 0.0757005364f},
-std::array<float,2>{0.40732193f, 0.926050603f},
-std::array<float,2>{0.504695833f, 0.833958983f},
-std::array<float,2>{0.32180205f, 0.239580169f},
-std::array<float,2>{0.848137915f, 0.467962831f},
-std::array<float,2>{0.0311179776f, 0.514501274f},
-std::array<float,2>{0.88580662f, 0.949948788f},
-std::array<float,2>{0.135388032f, 0.0454588011f},
-std::array<float,2>{0.669876933f, 0.297421843f},
-std::array<float,2>{0.475776941f, 0.720705867f},
-std::array<float,2>{0.584355056f, 0.584074497f},
-std::array<float,2>{0.304441571f, 0.393185586f},
-std::array<float,2>{0.807217717f, 0.176025227f},
-std::array<float,2>{0.105721988f, 0.757141888f},
-std::array<float,2>{0.855558038f, 0.625578225f},
-std::array<float,2>{0.0223462358f, 0.328255236f},
-std::array<float,2>{0.508193135f, 0.101032853f},
-std::array<float,2>{0.319686145f, 0.90198642f},
-std::array<float,2>{0.745686531f, 0.871893704f},
-std::array<float,2>{0.417252421f, 0.215826333f},
-std::array<float,2>{0.991499066f, 0.496262342f},
-std::array<float,2>{0.206361994f, 0.536843479f},
-std::array<float,2>{0.768784583f, 0.811026871f},
-std::array<float,2>{0.0683558583f, 0.133917347f},
-std::array<float,2>{0.612697124f, 0.422005564f},
-std::array<float,2>{0.270207793f, 0.601748228f},
-std::array<float,2>{0.636841655f, 0.68765229f},
-std::array<float,2>{0.449435264f, 0.275067359f},
-std::array<float,2>{0.910136938f, 0.0120304152f},
-std::array<float,2>{0.156437889f, 0.986420155f},
-std::array<float,2>{0.96606344f, 0.505666018f},
-std::array<float,2>{0.226369038f, 0.453403175f},
-std::array<float,2>{0.714454114f, 0.244527161f},
-std::array<float,2>{0.391284943f, 0.836201012f},
-std::array<float,2>{0.535746634f, 0.929808319f},
-std::array<float,2>{0.365745991f, 0.0641027987f},
-std::array<float,2>{0.833849013f, 0.358495086f},
-std::array<float,2>{0.0577281788f, 0.667876422f},
-std::array<float,2>{0.980098188f, 0.821133971f},
-std::array<float,2>{0.195497453f, 0.228789568f},
-std::array<float,2>{0.721487701f, 0.439368814f},
-std::array<float,2>{0.424277723f, 0.528742254f},
-std::array<float,2>{0.525068164f, 0.681420386f},
-std::array<float,2>{0.338225007f, 0.364375949f},
-std::array<float,2>{0.86166966f, 0.0826528668f},
-std::array<float,2>{0.00146245561f, 0.915727437f},
-std::array<float,2>{0.795437992f, 0.618979871f},
-std::array<float,2>{0.12379577f, 0.407445371f},
-std::array<float,2>{0.568233013f, 0.141425967f},
-std::array<float,2>{0.288300276f, 0.785190821f},
-std::array<float,2>{0.687022567f, 0.984024048f},
-std::array<float,2>{0.497097135f, 0.0245326776f},
-std::array<float,2>{0.895614147f, 0.263877034f},
-std::array<float,2>{0.141661912f, 0.713439047f},
-std::array<float,2>{0.823450685f, 0.887651086f},
-std::array<float,2>{0.0373156667f, 0.116470911f},
-std::array<float,2>{0.548444748f, 0.323614448f},
-std::array<float,2>{0.352900267f, 0.64748019f},
-std::array<float,2>{0.697168171f, 0.548173845f},
-std::array<float,2>{0.388005137f, 0.47789222f},
-std::array<float,2>{0.941785634f, 0.187648699f},
-std::array<float,2>{0.234797984f, 0.855438709f},
-std::array<float,2>{0.937012196f, 0.739031672f},
-std::array<float,2>{0.185097575f, 0.283519089f},
-std::array<float,2>{0.645990968f, 0.0542075075f},
-std::array<float,2>{0.459479332f, 0.955432296f},
-std::array<float,2>{0.606560647f, 0.772000611f},
-std::array<float,2>{0.260431767f, 0.160624027f},
-std::array<float,2>{0.764459908f, 0.38824749f},
-std::array<float,2>{0.0850845054f, 0.571860671f},
-std::array<float,2>{0.961053789f, 0.967467487f},
-std::array<float,2>{0.221119255f, 0.061217919f},
-std::array<float,2>{0.71679908f, 0.294732988f},
-std::array<float,2>{0.396030754f, 0.744676828f},
-std::array<float,2>{0.532275498f, 0.566442907f},
-std::array<float,2>{0.359627306f, 0.376910031f},
-std::array<float,2>{0.828582108f, 0.169755101f},
-std::array<float,2>{0.061094258f, 0.779417098f},
-std::array<float,2>{0.772200346f, 0.654669464f},
-std::array<float,2>{0.0646468922f, 0.313569576f},
-std::array<float,2>{0.615442872f, 0.123611383f},
-std::array<float,2>{0.267424524f, 0.881134272f},
-std::array<float,2>{0.633170784f, 0.844863057f},
-std::array<float,2>{0.448086381f, 0.196387798f},
-std::array<float,2>{0.91016829f, 0.471937239f},
-std::array<float,2>{0.160870254f, 0.56240052f},
-std::array<float,2>{0.853727281f, 0.791528702f},
-std::array<float,2>{0.0183928106f, 0.148989871f},
-std::array<float,2>{0.512646139f, 0.416902691f},
-std::array<float,2>{0.315302938f, 0.612177134f},
-std::array<float,2>{0.747906923f, 0.709160626f},
-std::array<float,2>{0.420142204f, 0.250614852f},
-std::array<float,2>{0.986405134f, 0.0210629739f},
-std::array<float,2>{0.209437668f, 0.976182282f},
-std::array<float,2>{0.889900386f, 0.515896618f},
-std::array<float,2>{0.137801677f, 0.452973574f},
-std::array<float,2>{0.666925788f, 0.221022636f},
-std::array<float,2>{0.471155047f, 0.813432455f},
-std::array<float,2>{0.578416824f, 0.912865818f},
-std::array<float,2>{0.300426662f, 0.0872579888f},
-std::array<float,2>{0.811518908f, 0.371940851f},
-std::array<float,2>{0.104058221f, 0.677806973f},
-std::array<float,2>{0.930903792f, 0.831838667f},
-std::array<float,2>{0.179947764f, 0.235187873f},
-std::array<float,2>{0.644159377f, 0.461471021f},
-std::array<float,2>{0.456310093f, 0.51042819f},
-std::array<float,2>{0.603098214f, 0.658350468f},
-std::array<float,2>{0.263082653f, 0.3486301f},
-std::array<float,2>{0.76022017f, 0.071295701f},
-std::array<float,2>{0.0816488862f, 0.921922803f},
-std::array<float,2>{0.827703238f, 0.594069839f},
-std::array<float,2>{0.0334592387f, 0.433191419f},
-std::array<float,2>{0.553155661f, 0.125577375f},
-std::array<float,2>{0.35742107f, 0.800675094f},
-std::array<float,2>{0.699297726f, 0.997602344f},
-std::array<float,2>{0.386152267f, 0.00521591445f},
-std::array<float,2>{0.940232038f, 0.265850633f},
-std::array<float,2>{0.239952475f, 0.701357603f},
-std::array<float,2>{0.791444242f, 0.890849769f},
-std::array<float,2>{0.11819984f, 0.107862875f},
-std::array<float,2>{0.566078901f, 0.337725431f},
-std::array<float,2>{0.284386456f, 0.640595019f},
-std::array<float,2>{0.680873394f, 0.545999229f},
-std::array<float,2>{0.492660433f, 0.487342805f},
-std::array<float,2>{0.891747415f, 0.204552576f},
-std::array<float,2>{0.145201564f, 0.863401413f},
-std::array<float,2>{0.982369244f, 0.732979953f},
-std::array<float,2>{0.202122778f, 0.309071928f},
-std::array<float,2>{0.725076258f, 0.032271266f},
-std::array<float,2>{0.427399427f, 0.937865853f},
-std::array<float,2>{0.529632807f, 0.76551044f},
-std::array<float,2>{0.340929687f, 0.18625696f},
-std::array<float,2>{0.865548611f, 0.400933504f},
-std::array<float,2>{0.00473414082f, 0.58869946f},
-std::array<float,2>{0.899888337f, 0.935794175f},
-std::array<float,2>{0.155766055f, 0.0672817826f},
-std::array<float,2>{0.679602921f, 0.351852983f},
-std::array<float,2>{0.488865465f, 0.669595718f},
-std::array<float,2>{0.574287534f, 0.503564119f},
-std::array<float,2>{0.292722166f, 0.458365023f},
-std::array<float,2>{0.785613358f, 0.24933812f},
-std::array<float,2>{0.111359671f, 0.842261791f},
-std::array<float,2>{0.871651292f, 0.692742527f},
-std::array<float,2>{0.0152916862f, 0.280196398f},
-std::array<float,2>{0.517084062f, 0.0107252412f},
-std::array<float,2>{0.331584513f, 0.990203023f},
-std::array<float,2>{0.733905256f, 0.807325482f},
-std::array<float,2>{0.433547616f, 0.136766896f},
-std::array<float,2>{0.970769763f, 0.429242969f},
-std::array<float,2>{0.194152817f, 0.607053697f},
-std::array<float,2>{0.754617035f, 0.868642867f},
-std::array<float,2>{0.087043561f, 0.211421221f},
-std::array<float,2>{0.596105278f, 0.493049204f},
-std::array<float,2>{0.257048756f, 0.533955097f},
-std::array<float,2>{0.648888707f, 0.63065201f},
-std::array<float,2>{0.467485636f, 0.332515985f},
-std::array<float,2>{0.927728474f, 0.0975872502f},
-std::array<float,2>{0.178465948f, 0.905813336f},
-std::array<float,2>{0.949669421f, 0.579113305f},
-std::array<float,2>{0.24881506f, 0.397908002f},
-std::array<float,2>{0.694352806f, 0.17531462f},
-std::array<float,2>{0.380437911f, 0.750592053f},
-std::array<float,2>{0.557475984f, 0.946767449f},
-std::array<float,2>{0.34620136f, 0.0408884548f},
-std::array<float,2>{0.812602341f, 0.302111238f},
-std::array<float,2>{0.0425186977f, 0.724576712f},
-std::array<float,2>{0.998254418f, 0.769518137f},
-std::array<float,2>{0.211187795f, 0.156422704f},
-std::array<float,2>{0.736076891f, 0.383307427f},
-std::array<float,2>{0.413664222f, 0.576024652f},
-std::array<float,2>{0.500579357f, 0.735614479f},
-std::array<float,2>{0.325141788f, 0.289044887f},
-std::array<float,2>{0.845880687f, 0.0477804095f},
-std::array<float,2>{0.0256194714f, 0.959038317f},
-std::array<float,2>{0.7985425f, 0.552510798f},
-std::array<float,2>{0.0965266451f, 0.481893897f},
-std::array<float,2>{0.585950196f, 0.19402881f},
-std::array<float,2>{0.30948925f, 0.858308554f},
-std::array<float,2>{0.663160086f, 0.88606745f},
-std::array<float,2>{0.476648271f, 0.111044638f},
-std::array<float,2>{0.878490269f, 0.325129807f},
-std::array<float,2>{0.128464729f, 0.642547846f},
-std::array<float,2>{0.840792894f, 0.977029979f},
-std::array<float,2>{0.0536077172f, 0.0288443044f},
-std::array<float,2>{0.542326212f, 0.258413851f},
-std::array<float,2>{0.371186554f, 0.716558456f},
-std::array<float,2>{0.703409255f, 0.621929407f},
-std::array<float,2>{0.402265221f, 0.413943648f},
-std::array<float,2>{0.95908016f, 0.146792322f},
-std::array<float,2>{0.227442399f, 0.785065234f},
-std::array<float,2>{0.915821493f, 0.684550881f},
-std::array<float,2>{0.169721961f, 0.359977782f},
-std::array<float,2>{0.62721312f, 0.0794330984f},
-std::array<float,2>{0.440214932f, 0.918481946f},
-std::array<float,2>{0.624157012f, 0.827318251f},
-std::array<float,2>{0.277811408f, 0.233136117f},
-std::array<float,2>{0.780472219f, 0.444950581f},
-std::array<float,2>{0.0754368231f, 0.524793029f},
-std::array<float,2>{0.974097729f, 0.877089977f},
-std::array<float,2>{0.188384607f, 0.117998272f},
-std::array<float,2>{0.727340579f, 0.317893505f},
-std::array<float,2>{0.436887652f, 0.649514854f},
-std::array<float,2>{0.521292031f, 0.555656791f},
-std::array<float,2>{0.334183723f, 0.473120153f},
-std::array<float,2>{0.870281637f, 0.202233404f},
-std::array<float,2>{0.0107423682f, 0.8477844f},
-std::array<float,2>{0.784711003f, 0.746284008f},
-std::array<float,2>{0.114187114f, 0.289251357f},
-std::array<float,2>{0.570712984f, 0.0553975143f},
-std::array<float,2>{0.293296397f, 0.963536799f},
-std::array<float,2>{0.672202408f, 0.776492298f},
-std::array<float,2>{0.48639676f, 0.164235905f},
-std::array<float,2>{0.905151725f, 0.379910737f},
-std::array<float,2>{0.152295604f, 0.565148711f},
-std::array<float,2>{0.819579005f, 0.816537738f},
-std::array<float,2>{0.043518886f, 0.225628048f},
-std::array<float,2>{0.560964227f, 0.448652804f},
-std::array<float,2>{0.349139065f, 0.521367669f},
-std::array<float,2>{0.687566757f, 0.673887372f},
-std::array<float,2>{0.377766788f, 0.370691746f},
-std::array<float,2>{0.948484182f, 0.0934147909f},
-std::array<float,2>{0.243260443f, 0.909709215f},
-std::array<float,2>{0.92548573f, 0.613870859f},
-std::array<float,2>{0.17558682f, 0.419314295f},
-std::array<float,2>{0.655458331f, 0.152900234f},
-std::array<float,2>{0.46140039f, 0.794300139f},
-std::array<float,2>{0.598029792f, 0.97039783f},
-std::array<float,2>{0.253258198f, 0.0188428313f},
-std::array<float,2>{0.752868831f, 0.256229043f},
-std::array<float,2>{0.0927664042f, 0.704349339f},
-std::array<float,2>{0.882597208f, 0.804243863f},
-std::array<float,2>{0.129465848f, 0.130727887f},
-std::array<float,2>{0.658507228f, 0.435597956f},
-std::array<float,2>{0.481959283f, 0.598871708f},
-std::array<float,2>{0.591241539f, 0.697916687f},
-std::array<float,2>{0.305517614f, 0.269826859f},
-std::array<float,2>{0.801447034f, 0.0018787873f},
-std::array<float,2>{0.0991969556f, 0.995263159f},
-std::array<float,2>{0.850105584f, 0.513010144f},
-std::array<float,2>{0.0283971112f, 0.465474188f},
-std::array<float,2>{0.507274628f, 0.240985483f},
-std::array<float,2>{0.324011534f, 0.835920274f},
-std::array<float,2>{0.739269078f, 0.929225028f},
-std::array<float,2>{0.40825212f, 0.0772131756f},
-std::array<float,2>{0.994913578f, 0.346856087f},
-std::array<float,2>{0.217483461f, 0.662622035f},
-std::array<float,2>{0.776058018f, 0.941635609f},
-std::array<float,2>{0.0740621313f, 0.0378960036f},
-std::array<float,2>{0.618202031f, 0.307053655f},
-std::array<float,2>{0.277209938f, 0.730086267f},
-std::array<float,2>{0.631760538f, 0.590497792f},
-std::array<float,2>{0.443374783f, 0.404334635f},
-std::array<float,2>{0.918198705f, 0.183332354f},
-std::array<float,2>{0.165706724f, 0.757935941f},
-std::array<float,2>{0.956517577f, 0.635369658f},
-std::array<float,2>{0.232458189f, 0.343049318f},
-std::array<float,2>{0.710119247f, 0.102946855f},
-std::array<float,2>{0.402558565f, 0.897558868f},
-std::array<float,2>{0.545989871f, 0.860078394f},
-std::array<float,2>{0.368837029f, 0.208653793f},
-std::array<float,2>{0.837227404f, 0.489333868f},
-std::array<float,2>{0.049572777f, 0.540284574f},
-std::array<float,2>{0.90754503f, 0.985638618f},
-std::array<float,2>{0.158373445f, 0.0142063079f},
-std::array<float,2>{0.639616191f, 0.277094007f},
-std::array<float,2>{0.452734023f, 0.690698802f},
-std::array<float,2>{0.61004746f, 0.605093122f},
-std::array<float,2>{0.27300173f, 0.425389558f},
-std::array<float,2>{0.766359627f, 0.136345759f},
-std::array<float,2>{0.0689034387f, 0.808594465f},
-std::array<float,2>{0.834367871f, 0.665497482f},
-std::array<float,2>{0.0548926666f, 0.356878191f},
-std::array<float,2>{0.538774133f, 0.0648881644f},
-std::array<float,2>{0.364430577f, 0.932445586f},
-std::array<float,2>{0.711850941f, 0.83906275f},
-std::array<float,2>{0.393425316f, 0.244010359f},
-std::array<float,2>{0.968587816f, 0.455518544f},
-std::array<float,2>{0.222940162f, 0.506218791f},
-std::array<float,2>{0.805817187f, 0.754879415f},
-std::array<float,2>{0.108523443f, 0.178663909f},
-std::array<float,2>{0.582989812f, 0.3921763f},
-std::array<float,2>{0.302116364f, 0.582634747f},
-std::array<float,2>{0.671204209f, 0.720452547f},
-std::array<float,2>{0.474559665f, 0.299535036f},
-std::array<float,2>{0.883579552f, 0.0443214551f},
-std::array<float,2>{0.133130074f, 0.952161968f},
-std::array<float,2>{0.989327133f, 0.537489831f},
-std::array<float,2>{0.204489037f, 0.49856177f},
-std::array<float,2>{0.743673623f, 0.217481539f},
-std::array<float,2>{0.414564788f, 0.873539269f},
-std::array<float,2>{0.510978758f, 0.899153411f},
-std::array<float,2>{0.317238718f, 0.0985589996f},
-std::array<float,2>{0.858058214f, 0.330252141f},
-std::array<float,2>{0.0212465525f, 0.627250016f},
-std::array<float,2>{0.943688154f, 0.852857053f},
-std::array<float,2>{0.236347735f, 0.189651877f},
-std::array<float,2>{0.698095858f, 0.478790045f},
-std::array<float,2>{0.38972795f, 0.550460994f},
-std::array<float,2>{0.549753547f, 0.645744145f},
-std::array<float,2>{0.35469541f, 0.321427166f},
-std::array<float,2>{0.821377635f, 0.113377452f},
-std::array<float,2>{0.035923101f, 0.889561296f},
-std::array<float,2>{0.761855006f, 0.573066056f},
-std::array<float,2>{0.0838510245f, 0.389761686f},
-std::array<float,2>{0.608729661f, 0.164045006f},
-std::array<float,2>{0.258230656f, 0.770088732f},
-std::array<float,2>{0.646535814f, 0.953615844f},
-std::array<float,2>{0.458795249f, 0.0526188239f},
-std::array<float,2>{0.935225546f, 0.281477153f},
-std::array<float,2>{0.186245814f, 0.740392327f},
-std::array<float,2>{0.860178709f, 0.917560995f},
-std::array<float,2>{0.00238006981f, 0.0856164694f},
-std::array<float,2>{0.526476502f, 0.366762489f},
-std::array<float,2>{0.337538749f, 0.682239473f},
-std::array<float,2>{0.718809307f, 0.529482603f},
-std::array<float,2>{0.422471225f, 0.439515948f},
-std::array<float,2>{0.977056742f, 0.227705777f},
-std::array<float,2>{0.198941246f, 0.823102295f},
-std::array<float,2>{0.89767313f, 0.711582661f},
-std::array<float,2>{0.144512877f, 0.262741804f},
-std::array<float,2>{0.683648109f, 0.0258252341f},
-std::array<float,2>{0.498449832f, 0.981923163f},
-std::array<float,2>{0.569639444f, 0.787856996f},
-std::array<float,2>{0.286841869f, 0.14277713f},
-std::array<float,2>{0.794416964f, 0.409317166f},
-std::array<float,2>{0.121899173f, 0.620709777f},
-std::array<float,2>{0.997083068f, 0.959929466f},
-std::array<float,2>{0.212977782f, 0.0473205708f},
-std::array<float,2>{0.736466825f, 0.288364649f},
-std::array<float,2>{0.41196835f, 0.735872626f},
-std::array<float,2>{0.502968967f, 0.575468361f},
-std::array<float,2>{0.326697677f, 0.383133292f},
-std::array<float,2>{0.843794346f, 0.156961188f},
-std::array<float,2>{0.023479715f, 0.768628657f},
-std::array<float,2>{0.799646497f, 0.641844869f},
-std::array<float,2>{0.0938226432f, 0.324364901f},
-std::array<float,2>{0.589679599f, 0.110459872f},
-std::array<float,2>{0.31104812f, 0.886483312f},
-std::array<float,2>{0.660217226f, 0.857627392f},
-std::array<float,2>{0.480156302f, 0.193782672f},
-std::array<float,2>{0.875018418f, 0.482049257f},
-std::array<float,2>{0.126493022f, 0.552157998f},
-std::array<float,2>{0.843643665f, 0.78419441f},
-std::array<float,2>{0.0522293635f, 0.147219434f},
-std::array<float,2>{0.540496767f, 0.413564295f},
-std::array<float,2>{0.374147445f, 0.621199489f},
-std::array<float,2>{0.706374347f, 0.715992212f},
-std::array<float,2>{0.399343312f, 0.258019209f},
-std::array<float,2>{0.958486736f, 0.0287899189f},
-std::array<float,2>{0.229072317f, 0.97752142f},
-std::array<float,2>{0.917721629f, 0.525000095f},
-std::array<float,2>{0.170040593f, 0.444382787f},
-std::array<float,2>{0.626470983f, 0.232577115f},
-std::array<float,2>{0.439132154f, 0.827829957f},
-std::array<float,2>{0.622872293f, 0.918210208f},
-std::array<float,2>{0.279319406f, 0.0798671246f},
-std::array<float,2>{0.778775811f, 0.35941267f},
-std::array<float,2>{0.0768575296f, 0.683933377f},
-std::array<float,2>{0.900851488f, 0.842390239f},
-std::array<float,2>{0.152426645f, 0.249743462f},
-std::array<float,2>{0.676724434f, 0.45851326f},
-std::array<float,2>{0.491409272f, 0.50299269f},
-std::array<float,2>{0.577655733f, 0.669292748f},
-std::array<float,2>{0.290855557f, 0.352128386f},
-std::array<float,2>{0.788634896f, 0.0664231181f},
-std::array<float,2>{0.109417327f, 0.93636322f},
-std::array<float,2>{0.873200536f, 0.606566012f},
-std::array<float,2>{0.0135162706f, 0.4287453f},
-std::array<float,2>{0.518876433f, 0.137421057f},
-std::array<float,2>{0.328749001f, 0.806758046f},
-std::array<float,2>{0.731315434f, 0.989561915f},
-std::array<float,2>{0.430436701f, 0.00991060864f},
-std::array<float,2>{0.969857037f, 0.279688388f},
-std::array<float,2>{0.193104267f, 0.693209946f},
-std::array<float,2>{0.757669032f, 0.90572685f},
-std::array<float,2>{0.0882900283f, 0.0969097838f},
-std::array<float,2>{0.595641673f, 0.332593024f},
-std::array<float,2>{0.254224539f, 0.630184412f},
-std::array<float,2>{0.650749564f, 0.533558369f},
-std::array<float,2>{0.465632498f, 0.492524087f},
-std::array<float,2>{0.929186046f, 0.211451575f},
-std::array<float,2>{0.176567569f, 0.869121671f},
-std::array<float,2>{0.952377558f, 0.723900676f},
-std::array<float,2>{0.246513903f, 0.302696437f},
-std::array<float,2>{0.692284763f, 0.0404815488f},
-std::array<float,2>{0.382632911f, 0.946974814f},
-std::array<float,2>{0.555046737f, 0.750291884f},
-std::array<float,2>{0.345605493f, 0.174942791f},
-std::array<float,2>{0.815826774f, 0.397997379f},
-std::array<float,2>{0.0398483947f, 0.579641223f},
-std::array<float,2>{0.933554649f, 0.922479272f},
-std::array<float,2>{0.181862637f, 0.0719204918f},
-std::array<float,2>{0.640891194f, 0.348098397f},
-std::array<float,2>{0.453936905f, 0.65884918f},
-std::array<float,2>{0.603954852f, 0.510240614f},
-std::array<float,2>{0.264169753f, 0.461251706f},
-std::array<float,2>{0.758101463f, 0.234401405f},
-std::array<float,2>{0.0784170032f, 0.831141293f},
-std::array<float,2>{0.825660944f, 0.702069402f},
-std::array<float,2>{0.0330539271f, 0.266416132f},
-std::array<float,2>{0.552182496f, 0.00564899342f},
-std::array<float,2>{0.358354688f, 0.997365713f},
-std::array<float,2>{0.701519608f, 0.800068974f},
-std::array<float,2>{0.383380413f, 0.125386566f},
-std::array<float,2>{0.938033819f, 0.432948202f},
-std::array<float,2>{0.240543053f, 0.594709039f},
-std::array<float,2>{0.790575445f, 0.863984346f},
-std::array<float,2>{0.119211771f, 0.204589888f},
-std::array<float,2>{0.562555134f, 0.48813659f},
-std::array<float,2>{0.281441301f, 0.546500385f},
-std::array<float,2>{0.683215439f, 0.64013505f},
-std::array<float,2>{0.495888829f, 0.336987764f},
-std::array<float,2>{0.893213809f, 0.108356059f},
-std::array<float,2>{0.148298919f, 0.89136523f},
-std::array<float,2>{0.984114766f, 0.588207603f},
-std::array<float,2>{0.199373066f, 0.400503367f},
-std::array<float,2>{0.724334478f, 0.185961559f},
-std::array<float,2>{0.427801996f, 0.765051007f},
-std::array<float,2>{0.528398275f, 0.938118517f},
-std::array<float,2>{0.342935175f, 0.033068452f},
-std::array<float,2>{0.864496291f, 0.309348434f},
-std::array<float,2>{0.00718060508f, 0.732684672f},
-std::array<float,2>{0.963297367f, 0.780138016f},
-std::array<float,2>{0.220169857f, 0.169105127f},
-std::array<float,2>{0.715949297f, 0.376374274f},
-std::array<float,2>{0.396759391f, 0.56700027f},
-std::array<float,2>{0.533340991f, 0.744400203f},
-std::array<float,2>{0.361919641f, 0.294054031f},
-std::array<float,2>{0.830862284f, 0.0606177822f},
-std::array<float,2>{0.0598703399f, 0.967081666f},
-std::array<float,2>{0.770726979f, 0.561614513f},
-std::array<float,2>{0.0635421351f, 0.472398639f},
-std::array<float,2>{0.613724053f, 0.19718197f},
-std::array<float,2>{0.269214362f, 0.845552206f},
-std::array<float,2>{0.634972334f, 0.881397307f},
-std::array<float,2>{0.446585178f, 0.123496056f},
-std::array<float,2>{0.91280216f, 0.314394176f},
-std::array<float,2>{0.163159072f, 0.655213356f},
-std::array<float,2>{0.851987362f, 0.975630701f},
-std::array<float,2>{0.0165232792f, 0.0208053831f},
-std::array<float,2>{0.514902234f, 0.250313789f},
-std::array<float,2>{0.312795341f, 0.70951426f},
-std::array<float,2>{0.748156548f, 0.611593127f},
-std::array<float,2>{0.41890341f, 0.416300744f},
-std::array<float,2>{0.984541118f, 0.148464337f},
-std::array<float,2>{0.208036467f, 0.79144901f},
-std::array<float,2>{0.88695389f, 0.678674161f},
-std::array<float,2>{0.139191478f, 0.371485621f},
-std::array<float,2>{0.665026724f, 0.0878873616f},
-std::array<float,2>{0.469710797f, 0.912371516f},
-std::array<float,2>{0.580439627f, 0.812507689f},
-std::array<float,2>{0.298555195f, 0.221522003f},
-std::array<float,2>{0.809364259f, 0.452373534f},
-std::array<float,2>{0.103205718f, 0.516125202f},
-std::array<float,2>{0.942027688f, 0.889035583f},
-std::array<float,2>{0.234940633f, 0.11383006f},
-std::array<float,2>{0.696605206f, 0.321777642f},
-std::array<float,2>{0.388445318f, 0.646083772f},
-std::array<float,2>{0.547864854f, 0.549842954f},
-std::array<float,2>{0.353324652f, 0.47908923f},
-std::array<float,2>{0.823792756f, 0.190310717f},
-std::array<float,2>{0.0376666039f, 0.853177547f},
-std::array<float,2>{0.763896525f, 0.740913212f},
-std::array<float,2>{0.0855819136f, 0.282113492f},
-std::array<float,2>{0.607335508f, 0.0522082373f},
-std::array<float,2>{0.259997219f, 0.953292906f},
-std::array<float,2>{0.646152675f, 0.769568563f},
-std::array<float,2>{0.458987057f, 0.163108423f},
-std::array<float,2>{0.936751604f, 0.390479505f},
-std::array<float,2>{0.184958681f, 0.572532415f},
-std::array<float,2>{0.862054229f, 0.822423398f},
-std::array<float,2>{0.00158478087f, 0.22848095f},
-std::array<float,2>{0.52459079f, 0.440325677f},
-std::array<float,2>{0.338417381f, 0.529863894f},
-std::array<float,2>{0.720797539f, 0.681877911f},
-std::array<float,2>{0.424708277f, 0.366685808f},
-std::array<float,2>{0.979956269f, 0.0851187259f},
-std::array<float,2>{0.195856452f, 0.917006433f},
-std::array<float,2>{0.896154702f, 0.620258689f},
-std::array<float,2>{0.142512932f, 0.410146862f},
-std::array<float,2>{0.686887681f, 0.143530041f},
-std::array<float,2>{0.497606367f, 0.787548602f},
-std::array<float,2>{0.567474365f, 0.982180953f},
-std::array<float,2>{0.288698733f, 0.0262756404f},
-std::array<float,2>{0.795140266f, 0.263390332f},
-std::array<float,2>{0.123266719f, 0.71106565f},
-std::array<float,2>{0.909572899f, 0.809084713f},
-std::array<float,2>{0.156841874f, 0.136024937f},
-std::array<float,2>{0.637212932f, 0.424946278f},
-std::array<float,2>{0.450082242f, 0.604876757f},
-std::array<float,2>{0.61280632f, 0.69098109f},
-std::array<float,2>{0.269713342f, 0.276559383f},
-std::array<float,2>{0.769523621f, 0.0137931686f},
-std::array<float,2>{0.0675581917f, 0.986314416f},
-std::array<float,2>{0.83318609f, 0.506360233f},
-std::array<float,2>{0.0585658401f, 0.455742329f},
-std::array<float,2>{0.53535074f, 0.243607998f},
-std::array<float,2>{0.365634024f, 0.839798272f},
-std::array<float,2>{0.714285672f, 0.931680202f},
-std::array<float,2>{0.390806228f, 0.0651597753f},
-std::array<float,2>{0.966634095f, 0.357132971f},
-std::array<float,2>{0.225748077f, 0.665952325f},
-std::array<float,2>{0.807117999f, 0.952765703f},
-std::array<float,2>{0.105965488f, 0.0446209237f},
-std::array<float,2>{0.584904373f, 0.298962861f},
-std::array<float,2>{0.304110259f, 0.719859719f},
-std::array<float,2>{0.669066966f, 0.582343698f},
-std::array<float,2>{0.476148158f, 0.391873062f},
-std::array<float,2>{0.886579931f, 0.178003624f},
-std::array<float,2>{0.134875566f, 0.753912747f},
-std::array<float,2>{0.991720617f, 0.627443492f},
-std::array<float,2>{0.206944153f, 0.330735326f},
-std::array<float,2>{0.745275736f, 0.098005496f},
-std::array<float,2>{0.417935103f, 0.898893416f},
-std::array<float,2>{0.508389294f, 0.873109341f},
-std::array<float,2>{0.319891989f, 0.217113301f},
-std::array<float,2>{0.85614264f, 0.498186171f},
-std::array<float,2>{0.0219339635f, 0.537910819f},
-std::array<float,2>{0.879807115f, 0.995980144f},
-std::array<float,2>{0.131886303f, 0.00102385436f},
-std::array<float,2>{0.656461895f, 0.270499915f},
-std::array<float,2>{0.484216779f, 0.69735384f},
-std::array<float,2>{0.592013836f, 0.59927094f},
-std::array<float,2>{0.30858928f, 0.436286867f},
-std::array<float,2>{0.803234637f, 0.129937768f},
-std::array<float,2>{0.101502076f, 0.803734601f},
-std::array<float,2>{0.848502278f, 0.662434816f},
-std::array<float,2>{0.0305268131f, 0.347240061f},
-std::array<float,2>{0.503975332f, 0.0779758766f},
-std::array<float,2>{0.321611613f, 0.928748548f},
-std::array<float,2>{0.74071604f, 0.835063994f},
-std::array<float,2>{0.408114851f, 0.240630165f},
-std::array<float,2>{0.993510604f, 0.464953989f},
-std::array<float,2>{0.215765685f, 0.513532341f},
-std::array<float,2>{0.774247587f, 0.75866735f},
-std::array<float,2>{0.0703452677f, 0.183080867f},
-std::array<float,2>{0.62016803f, 0.404976249f},
-std::array<float,2>{0.274388462f, 0.590199888f},
-std::array<float,2>{0.629318953f, 0.729607224f},
-std::array<float,2>{0.442166239f, 0.307303518f},
-std::array<float,2>{0.920817077f, 0.037231829f},
-std::array<float,2>{0.167008087f, 0.942262471f},
-std::array<float,2>{0.953542352f, 0.540895343f},
-std::array<float,2>{0.230659068f, 0.489959389f},
-std::array<float,2>{0.708301902f, 0.208321273f},
-std::array<float,2>{0.406080037f, 0.859566331f},
-std::array<float,2>{0.544347882f, 0.898039401f},
-std::array<float,2>{0.369877607f, 0.103418112f},
-std::array<float,2>{0.838332951f, 0.343264788f},
-std::array<float,2>{0.0486935005f, 0.635212123f},
-std::array<float,2>{0.975223899f, 0.848614454f},
-std::array<float,2>{0.189796537f, 0.202807143f},
-std::array<float,2>{0.73013103f, 0.473430991f},
-std::array<float,2>{0.435352713f, 0.554870129f},
-std::array<float,2>{0.522983193f, 0.650259078f},
-std::array<float,2>{0.33303538f, 0.317612231f},
-std::array<float,2>{0.869108737f, 0.117469892f},
-std::array<float,2>{0.0083114272f, 0.877845466f},
-std::array<float,2>{0.781663775f, 0.564454436f},
-std::array<float,2>{0.117166236f, 0.380545557f},
-std::array<float,2>{0.573592365f, 0.164882168f},
-std::array<float,2>{0.295899361f, 0.777003348f},
-std::array<float,2>{0.675023019f, 0.962997377f},
-std::array<float,2>{0.486157954f, 0.0547741055f},
-std::array<float,2>{0.903214991f, 0.289670676f},
-std::array<float,2>{0.150281727f, 0.746816754f},
-std::array<float,2>{0.817548931f, 0.909509599f},
-std::array<float,2>{0.0461549163f, 0.0928932726f},
-std::array<float,2>{0.559853613f, 0.370519638f},
-std::array<float,2>{0.349978417f, 0.674366474f},
-std::array<float,2>{0.6906358f, 0.520529926f},
-std::array<float,2>{0.376514733f, 0.448984414f},
-std::array<float,2>{0.947232902f, 0.226238683f},
-std::array<float,2>{0.245452121f, 0.817036271f},
-std::array<float,2>{0.922408164f, 0.704598844f},
-std::array<float,2>{0.172297627f, 0.256524235f},
-std::array<float,2>{0.6528216f, 0.0190775562f},
-std::array<float,2>{0.464740723f, 0.970016837f},
-std::array<float,2>{0.600289106f, 0.794630229f},
-std::array<float,2>{0.251884013f, 0.152564406f},
-std::array<float,2>{0.751744926f, 0.41946575f},
-std::array<float,2>{0.0915814266f, 0.613766134f},
-std::array<float,2>{0.959813058f, 0.979452074f},
-std::array<float,2>{0.226652876f, 0.0293844659f},
-std::array<float,2>{0.703992069f, 0.26152128f},
-std::array<float,2>{0.40172106f, 0.717955172f},
-std::array<float,2>{0.54267931f, 0.624067843f},
-std::array<float,2>{0.371798456f, 0.41177246f},
-std::array<float,2>{0.840200484f, 0.144937649f},
-std::array<float,2>{0.0528129004f, 0.78174758f},
-std::array<float,2>{0.780892909f, 0.6859411f},
-std::array<float,2>{0.0758902431f, 0.362156957f},
-std::array<float,2>{0.624513626f, 0.080744192f},
-std::array<float,2>{0.278105617f, 0.92139709f},
-std::array<float,2>{0.627828062f, 0.825809956f},
-std::array<float,2>{0.439867586f, 0.231122702f},
-std::array<float,2>{0.915253937f, 0.441800028f},
-std::array<float,2>{0.169374421f, 0.525561631f},
-std::array<float,2>{0.84621501f, 0.767242968f},
-std::array<float,2>{0.0259788912f, 0.159727931f},
-std::array<float,2>{0.500338674f, 0.38499555f},
-std::array<float,2>{0.324516326f, 0.576251507f},
-std::array<float,2>{0.735827684f, 0.738082051f},
-std::array<float,2>{0.413529366f, 0.285374999f},
-std::array<float,2>{0.998743892f, 0.0496687293f},
-std::array<float,2>{0.211483181f, 0.957986772f},
-std::array<float,2>{0.878158212f, 0.553973317f},
-std::array<float,2>{0.12822929f, 0.484034628f},
-std::array<float,2>{0.663953125f, 0.192405298f},
-std::array<float,2>{0.4770841f, 0.856552422f},
-std::array<float,2>{0.586443543f, 0.883324742f},
-std::array<float,2>{0.308610559f, 0.112418868f},
-std::array<float,2>{0.797884405f, 0.327769637f},
-std::array<float,2>{0.0961095691f, 0.642611563f},
-std::array<float,2>{0.927178979f, 0.869734406f},
-std::array<float,2>{0.177977502f, 0.214333519f},
-std::array<float,2>{0.649178445f, 0.494524658f},
-std::array<float,2>{0.466968417f, 0.533165932f},
-std::array<float,2>{0.596238136f, 0.631571949f},
-std::array<float,2>{0.257657051f, 0.334175855f},
-std::array<float,2>{0.754360855f, 0.0955198631f},
-std::array<float,2>{0.0876595899f, 0.903741539f},
-std::array<float,2>{0.81340754f, 0.581290603f},
-std::array<float,2>{0.0422566719f, 0.396129698f},
-std::array<float,2>{0.556702495f, 0.173147514f},
-std::array<float,2>{0.346029729f, 0.753277838f},
-std::array<float,2>{0.695098162f, 0.949016333f},
-std::array<float,2>{0.380088806f, 0.0412432365f},
-std::array<float,2>{0.950003803f, 0.304259568f},
-std::array<float,2>{0.248237133f, 0.726489484f},
-std::array<float,2>{0.786053002f, 0.935313106f},
-std::array<float,2>{0.111896567f, 0.0684830919f},
-std::array<float,2>{0.5747962f, 0.353969812f},
-std::array<float,2>{0.292017221f, 0.671447098f},
-std::array<float,2>{0.679000735f, 0.501430809f},
-std::array<float,2>{0.488637865f, 0.459038407f},
-std::array<float,2>{0.90007621f, 0.247931793f},
-std::array<float,2>{0.155556172f, 0.840311587f},
-std::array<float,2>{0.971289277f, 0.69457072f},
-std::array<float,2>{0.193371639f, 0.278136432f},
-std::array<float,2>{0.733427465f, 0.00945041887f},
-std::array<float,2>{0.432987809f, 0.99115026f},
-std::array<float,2>{0.517563403f, 0.805088162f},
-std::array<float,2>{0.331145078f, 0.139247641f},
-std::array<float,2>{0.871219754f, 0.426816523f},
-std::array<float,2>{0.0149817411f, 0.609126091f},
-std::array<float,2>{0.892154455f, 0.894171238f},
-std::array<float,2>{0.144927502f, 0.106662005f},
-std::array<float,2>{0.681415558f, 0.338980317f},
-std::array<float,2>{0.492712259f, 0.63799876f},
-std::array<float,2>{0.56543535f, 0.544623494f},
-std::array<float,2>{0.285124958f, 0.485207438f},
-std::array<float,2>{0.791777074f, 0.205459014f},
-std::array<float,2>{0.11894916f, 0.865330458f},
-std::array<float,2>{0.865887284f, 0.731563807f},
-std::array<float,2>{0.00403133593f, 0.311780572f},
-std::array<float,2>{0.530101359f, 0.0348196812f},
-std::array<float,2>{0.341338485f, 0.940134764f},
-std::array<float,2>{0.725394666f, 0.763272166f},
-std::array<float,2>{0.427106738f, 0.184140489f},
-std::array<float,2>{0.98192668f, 0.398999214f},
-std::array<float,2>{0.201641068f, 0.586721241f},
-std::array<float,2>{0.760441244f, 0.830061376f},
-std::array<float,2>{0.0811647847f, 0.238204092f},
-std::array<float,2>{0.602909803f, 0.463690132f},
-std::array<float,2>{0.263473898f, 0.508508325f},
-std::array<float,2>{0.643893421f, 0.657478213f},
-std::array<float,2>{0.456860751f, 0.351058841f},
-std::array<float,2>{0.931332409f, 0.0740577728f},
-std::array<float,2>{0.180253908f, 0.924716353f},
-std::array<float,2>{0.939813495f, 0.595746219f},
-std::array<float,2>{0.239723161f, 0.431116551f},
-std::array<float,2>{0.699892879f, 0.127753422f},
-std::array<float,2>{0.386670619f, 0.797806978f},
-std::array<float,2>{0.553462267f, 0.998461723f},
-std::array<float,2>{0.356503755f, 0.00686026365f},
-std::array<float,2>{0.827590942f, 0.268713087f},
-std::array<float,2>{0.034139052f, 0.700002074f},
-std::array<float,2>{0.987191796f, 0.789648771f},
-std::array<float,2>{0.209602937f, 0.152083278f},
-std::array<float,2>{0.747461498f, 0.415281415f},
-std::array<float,2>{0.420458406f, 0.609422326f},
-std::array<float,2>{0.511948228f, 0.707456946f},
-std::array<float,2>{0.314801633f, 0.253347099f},
-std::array<float,2>{0.854440808f, 0.022141343f},
-std::array<float,2>{0.0176068321f, 0.973187089f},
-std::array<float,2>{0.810651839f, 0.518663645f},
-std::array<float,2>{0.103724353f, 0.451066554f},
-std::array<float,2>{0.578730583f, 0.219715357f},
-std::array<float,2>{0.300066352f, 0.815005302f},
-std::array<float,2>{0.666208327f, 0.911081731f},
-std::array<float,2>{0.471246332f, 0.0896467119f},
-std::array<float,2>{0.890205503f, 0.374405116f},
-std::array<float,2>{0.138282537f, 0.676472008f},
-std::array<float,2>{0.828966975f, 0.965007305f},
-std::array<float,2>{0.0610213876f, 0.0601891205f},
-std::array<float,2>{0.532854199f, 0.296830267f},
-std::array<float,2>{0.360197514f, 0.742972255f},
-std::array<float,2>{0.717772067f, 0.568689287f},
-std::array<float,2>{0.395603478f, 0.378759772f},
-std::array<float,2>{0.961750329f, 0.170086369f},
-std::array<float,2>{0.221426949f, 0.778948188f},
-std::array<float,2>{0.911058843f, 0.652490675f},
-std::array<float,2>{0.160553977f, 0.315680265f},
-std::array<float,2>{0.633536279f, 0.121885225f},
-std::array<float,2>{0.447425485f, 0.880220771f},
-std::array<float,2>{0.615874231f, 0.846736073f},
-std::array<float,2>{0.266684651f, 0.19778274f},
-std::array<float,2>{0.771684706f, 0.468921334f},
-std::array<float,2>{0.0652053431f, 0.559737682f},
-std::array<float,2>{0.976886392f, 0.915350735f},
-std::array<float,2>{0.198429361f, 0.0823395029f},
-std::array<float,2>{0.719640136f, 0.364831388f},
-std::array<float,2>{0.421984017f, 0.68076241f},
-std::array<float,2>{0.527138293f, 0.529039383f},
-std::array<float,2>{0.336960316f, 0.438489228f},
-std::array<float,2>{0.859856188f, 0.229399174f},
-std::array<float,2>{0.00292363204f, 0.820776165f},
-std::array<float,2>{0.79473567f, 0.713059843f},
-std::array<float,2>{0.121123046f, 0.264275849f},
-std::array<float,2>{0.570287049f, 0.0249450821f},
-std::array<float,2>{0.28630203f, 0.983737409f},
-std::array<float,2>{0.684375048f, 0.785686016f},
-std::array<float,2>{0.498567104f, 0.140835822f},
-std::array<float,2>{0.898395061f, 0.407950401f},
-std::array<float,2>{0.143862113f, 0.618202388f},
-std::array<float,2>{0.822157681f, 0.854882956f},
-std::array<float,2>{0.0351734459f, 0.188051775f},
-std::array<float,2>{0.549247742f, 0.478192329f},
-std::array<float,2>{0.355158776f, 0.548441112f},
-std::array<float,2>{0.697330117f, 0.64837575f},
-std::array<float,2>{0.390236497f, 0.324217677f},
-std::array<float,2>{0.943948984f, 0.116699629f},
-std::array<float,2>{0.236924633f, 0.886804104f},
-std::array<float,2>{0.934592247f, 0.571656406f},
-std::array<float,2>{0.18598251f, 0.387701988f},
-std::array<float,2>{0.647017181f, 0.160710886f},
-std::array<float,2>{0.458415359f, 0.771804333f},
-std::array<float,2>{0.609269202f, 0.956032753f},
-std::array<float,2>{0.258510381f, 0.0541784652f},
-std::array<float,2>{0.7622298f, 0.283746421f},
-std::array<float,2>{0.0833355933f, 0.738429308f},
-std::array<float,2>{0.882918f, 0.757538855f},
-std::array<float,2>{0.133589774f, 0.176562622f},
-std::array<float,2>{0.671766222f, 0.392640084f},
-std::array<float,2>{0.473689705f, 0.584636033f},
-std::array<float,2>{0.582100034f, 0.721673787f},
-std::array<float,2>{0.302540809f, 0.29720664f},
-std::array<float,2>{0.806249797f, 0.0449270643f},
-std::array<float,2>{0.108979434f, 0.949397624f},
-std::array<float,2>{0.857509077f, 0.536591649f},
-std::array<float,2>{0.0205735005f, 0.496621579f},
-std::array<float,2>{0.511248589f, 0.216575757f},
-std::array<float,2>{0.316557705f, 0.871574759f},
-std::array<float,2>{0.743190885f, 0.901420832f},
-std::array<float,2>{0.414434522f, 0.101463549f},
-std::array<float,2>{0.989818752f, 0.329085618f},
-std::array<float,2>{0.204863861f, 0.625438392f},
-std::array<float,2>{0.766009748f, 0.987213492f},
-std::array<float,2>{0.0684046224f, 0.0122554535f},
-std::array<float,2>{0.6098454f, 0.274460346f},
-std::array<float,2>{0.272732466f, 0.688312232f},
-std::array<float,2>{0.638776064f, 0.602444649f},
-std::array<float,2>{0.452579588f, 0.422430933f},
-std::array<float,2>{0.907852173f, 0.134746313f},
-std::array<float,2>{0.159021944f, 0.811275065f},
-std::array<float,2>{0.96811682f, 0.667296469f},
-std::array<float,2>{0.223163217f, 0.359348357f},
-std::array<float,2>{0.710985422f, 0.0635673255f},
-std::array<float,2>{0.392912537f, 0.930631161f},
-std::array<float,2>{0.538497329f, 0.836833835f},
-std::array<float,2>{0.365180433f, 0.24470076f},
-std::array<float,2>{0.834706664f, 0.45385164f},
-std::array<float,2>{0.0554365963f, 0.505293489f},
-std::array<float,2>{0.918916941f, 0.944719613f},
-std::array<float,2>{0.16512534f, 0.0366181433f},
-std::array<float,2>{0.63133359f, 0.305818886f},
-std::array<float,2>{0.444246978f, 0.727039874f},
-std::array<float,2>{0.619099498f, 0.592841625f},
-std::array<float,2>{0.276467919f, 0.403022051f},
-std::array<float,2>{0.775623441f, 0.181230456f},
-std::array<float,2>{0.0734794885f, 0.761273265f},
-std::array<float,2>{0.837537527f, 0.634340286f},
-std::array<float,2>{0.0490240976f, 0.340005815f},
-std::array<float,2>{0.546836734f, 0.104228027f},
-std::array<float,2>{0.368467718f, 0.895928085f},
-std::array<float,2>{0.710555077f, 0.863152862f},
-std::array<float,2>{0.403033823f, 0.210284427f},
-std::array<float,2>{0.956840277f, 0.49040693f},
-std::array<float,2>{0.23337999f, 0.541974783f},
-std::array<float,2>{0.801190138f, 0.80209595f},
-std::array<float,2>{0.0989113152f, 0.13135615f},
-std::array<float,2>{0.591489434f, 0.434214234f},
-std::array<float,2>{0.304787099f, 0.599673271f},
-std::array<float,2>{0.65903306f, 0.695456982f},
-std::array<float,2>{0.481766433f, 0.272248209f},
-std::array<float,2>{0.882029951f, 0.00299803331f},
-std::array<float,2>{0.129260883f, 0.993558466f},
-std::array<float,2>{0.994618475f, 0.513764679f},
-std::array<float,2>{0.217283592f, 0.468410015f},
-std::array<float,2>{0.740010381f, 0.239968389f},
-std::array<float,2>{0.409024894f, 0.833414972f},
-std::array<float,2>{0.507571459f, 0.926491559f},
-std::array<float,2>{0.323475569f, 0.0753956959f},
-std::array<float,2>{0.850030482f, 0.345574141f},
-std::array<float,2>{0.0290240794f, 0.661023617f},
-std::array<float,2>{0.949167609f, 0.819574594f},
-std::array<float,2>{0.244099304f, 0.224189907f},
-std::array<float,2>{0.688255668f, 0.446016282f},
-std::array<float,2>{0.377284706f, 0.522160351f},
-std::array<float,2>{0.561142027f, 0.673737288f},
-std::array<float,2>{0.349013835f, 0.367861569f},
-std::array<float,2>{0.820178092f, 0.0906059518f},
-std::array<float,2>{0.043076437f, 0.906258941f},
-std::array<float,2>{0.752004266f, 0.615833759f},
-std::array<float,2>{0.0918428972f, 0.421173662f},
-std::array<float,2>{0.598209441f, 0.155650333f},
-std::array<float,2>{0.253466457f, 0.796135783f},
-std::array<float,2>{0.656064212f, 0.972268224f},
-std::array<float,2>{0.461463988f, 0.0170649979f},
-std::array<float,2>{0.92488122f, 0.254749388f},
-std::array<float,2>{0.175008073f, 0.70629096f},
-std::array<float,2>{0.870935678f, 0.876629651f},
-std::array<float,2>{0.0113033541f, 0.119710639f},
-std::array<float,2>{0.520837307f, 0.319011152f},
-std::array<float,2>{0.33487305f, 0.651278436f},
-std::array<float,2>{0.726863146f, 0.558234572f},
-std::array<float,2>{0.437423557f, 0.475209415f},
-std::array<float,2>{0.974178612f, 0.199587643f},
-std::array<float,2>{0.187600285f, 0.850340009f},
-std::array<float,2>{0.904502153f, 0.749875844f},
-std::array<float,2>{0.151551753f, 0.291214406f},
-std::array<float,2>{0.672665298f, 0.0576171428f},
-std::array<float,2>{0.486948431f, 0.961752594f},
-std::array<float,2>{0.571020722f, 0.774629176f},
-std::array<float,2>{0.293694228f, 0.167519629f},
-std::array<float,2>{0.784398019f, 0.381085753f},
-std::array<float,2>{0.113408841f, 0.56339097f},
-std::array<float,2>{0.969082236f, 0.99180156f},
-std::array<float,2>{0.192147404f, 0.00827608351f},
-std::array<float,2>{0.732026875f, 0.278561115f},
-std::array<float,2>{0.430699766f, 0.693469763f},
-std::array<float,2>{0.518380404f, 0.607592881f},
-std::array<float,2>{0.329219878f, 0.426208317f},
-std::array<float,2>{0.874813676f, 0.140221149f},
-std::array<float,2>{0.0121786864f, 0.806353748f},
-std::array<float,2>{0.787892401f, 0.670222759f},
-std::array<float,2>{0.110754803f, 0.354663521f},
-std::array<float,2>{0.577058792f, 0.0697189867f},
-std::array<float,2>{0.289067388f, 0.933649123f},
-std::array<float,2>{0.677061439f, 0.841740966f},
-std::array<float,2>{0.490787685f, 0.246322289f},
-std::array<float,2>{0.902090073f, 0.460840315f},
-std::array<float,2>{0.154138833f, 0.500085711f},
-std::array<float,2>{0.815149426f, 0.752173662f},
-std::array<float,2>{0.0401011854f, 0.1722662f},
-std::array<float,2>{0.555679739f, 0.395121843f},
-std::array<float,2>{0.343786508f, 0.580969691f},
-std::array<float,2>{0.692781627f, 0.725347161f},
-std::array<float,2>{0.381582767f, 0.302862436f},
-std::array<float,2>{0.951527297f, 0.0423191711f},
-std::array<float,2>{0.247650519f, 0.948190272f},
-std::array<float,2>{0.928502679f, 0.532221079f},
-std::array<float,2>{0.177306414f, 0.495903164f},
-std::array<float,2>{0.651389062f, 0.213401243f},
-std::array<float,2>{0.466262072f, 0.870644808f},
-std::array<float,2>{0.594058812f, 0.902500212f},
-std::array<float,2>{0.255023211f, 0.0946615785f},
-std::array<float,2>{0.756121099f, 0.335920155f},
-std::array<float,2>{0.0889450014f, 0.632479906f},
-std::array<float,2>{0.876725435f, 0.856411278f},
-std::array<float,2>{0.125003815f, 0.191671476f},
-std::array<float,2>{0.661598206f, 0.482448518f},
-std::array<float,2>{0.479337454f, 0.552859485f},
-std::array<float,2>{0.588778377f, 0.644326746f},
-std::array<float,2>{0.312023848f, 0.326350898f},
-std::array<float,2>{0.800141275f, 0.112265639f},
-std::array<float,2>{0.09483435f, 0.883861184f},
-std::array<float,2>{0.84494108f, 0.577996969f},
-std::array<float,2>{0.0245039929f, 0.385790616f},
-std::array<float,2>{0.502713203f, 0.159131303f},
-std::array<float,2>{0.327338666f, 0.76590842f},
-std::array<float,2>{0.737703264f, 0.958883882f},
-std::array<float,2>{0.410171956f, 0.050236769f},
-std::array<float,2>{0.996749759f, 0.286759406f},
-std::array<float,2>{0.214045167f, 0.736352623f},
-std::array<float,2>{0.777622759f, 0.920815289f},
-std::array<float,2>{0.0772778392f, 0.0819660574f},
-std::array<float,2>{0.621969998f, 0.362332553f},
-std::array<float,2>{0.280566782f, 0.686788678f},
-std::array<float,2>{0.625268579f, 0.526801527f},
-std::array<float,2>{0.438432395f, 0.442730963f},
-std::array<float,2>{0.916584671f, 0.231724635f},
-std::array<float,2>{0.171537668f, 0.824266851f},
-std::array<float,2>{0.957281053f, 0.717564166f},
-std::array<float,2>{0.230091378f, 0.259785235f},
-std::array<float,2>{0.70512104f, 0.0311025977f},
-std::array<float,2>{0.400019407f, 0.979649782f},
-std::array<float,2>{0.539560318f, 0.782758832f},
-std::array<float,2>{0.373626471f, 0.146315634f},
-std::array<float,2>{0.842385232f, 0.410840899f},
-std::array<float,2>{0.0508300215f, 0.623171031f},
-std::array<float,2>{0.913520873f, 0.879561841f},
-std::array<float,2>{0.1621539f, 0.122500308f},
-std::array<float,2>{0.635996699f, 0.315191329f},
-std::array<float,2>{0.445887864f, 0.653726995f},
-std::array<float,2>{0.614287436f, 0.55920589f},
-std::array<float,2>{0.267864794f, 0.469754338f},
-std::array<float,2>{0.769880116f, 0.198666513f},
-std::array<float,2>{0.0633407012f, 0.846587658f},
-std::array<float,2>{0.831657648f, 0.743640721f},
-std::array<float,2>{0.0592651106f, 0.295440704f},
-std::array<float,2>{0.534538746f, 0.0588307008f},
-std::array<float,2>{0.363006651f, 0.966008365f},
-std::array<float,2>{0.71495384f, 0.778223455f},
-std::array<float,2>{0.398405641f, 0.171756849f},
-std::array<float,2>{0.964719296f, 0.377918005f},
-std::array<float,2>{0.219051465f, 0.569553852f},
-std::array<float,2>{0.810532629f, 0.815471411f},
-std::array<float,2>{0.102514841f, 0.220214814f},
-std::array<float,2>{0.581094623f, 0.449784219f},
-std::array<float,2>{0.297334164f, 0.518063545f},
-std::array<float,2>{0.665236175f, 0.676929176f},
-std::array<float,2>{0.469997793f, 0.373307765f},
-std::array<float,2>{0.888421893f, 0.0887793303f},
-std::array<float,2>{0.139777154f, 0.911490083f},
-std::array<float,2>{0.98579222f, 0.610448241f},
-std::array<float,2>{0.207978159f, 0.414917618f},
-std::array<float,2>{0.749989212f, 0.150809705f},
-std::array<float,2>{0.419668317f, 0.79008019f},
-std::array<float,2>{0.514426708f, 0.97387445f},
-std::array<float,2>{0.313733757f, 0.0228451136f},
-std::array<float,2>{0.853466868f, 0.252289027f},
-std::array<float,2>{0.0175680611f, 0.708231568f},
-std::array<float,2>{0.939298093f, 0.798570633f},
-std::array<float,2>{0.241490752f, 0.128011316f},
-std::array<float,2>{0.702888906f, 0.430277735f},
-std::array<float,2>{0.384485841f, 0.596742511f},
-std::array<float,2>{0.551207364f, 0.700388849f},
-std::array<float,2>{0.358486146f, 0.267803937f},
-std::array<float,2>{0.824751914f, 0.00655963272f},
-std::array<float,2>{0.0315070748f, 0.999412656f},
-std::array<float,2>{0.759010434f, 0.508933008f},
-std::array<float,2>{0.0796582475f, 0.464459211f},
-std::array<float,2>{0.605451822f, 0.237264991f},
-std::array<float,2>{0.265121132f, 0.829088151f},
-std::array<float,2>{0.64170289f, 0.925449967f},
-std::array<float,2>{0.454156965f, 0.072904326f},
-std::array<float,2>{0.932246029f, 0.349998415f},
-std::array<float,2>{0.183032796f, 0.656761527f},
-std::array<float,2>{0.863414705f, 0.940959334f},
-std::array<float,2>{0.00667763129f, 0.0338113569f},
-std::array<float,2>{0.527501822f, 0.311047614f},
-std::array<float,2>{0.342122734f, 0.730512023f},
-std::array<float,2>{0.723248899f, 0.58737576f},
-std::array<float,2>{0.42963925f, 0.399876684f},
-std::array<float,2>{0.982705116f, 0.184699193f},
-std::array<float,2>{0.200950399f, 0.761833966f},
-std::array<float,2>{0.894154072f, 0.63726753f},
-std::array<float,2>{0.147193104f, 0.338499129f},
-std::array<float,2>{0.681708992f, 0.105853066f},
-std::array<float,2>{0.494644761f, 0.892868221f},
-std::array<float,2>{0.564170599f, 0.866675138f},
-std::array<float,2>{0.282639951f, 0.2069823f},
-std::array<float,2>{0.789552271f, 0.486230344f},
-std::array<float,2>{0.120791726f, 0.543200612f},
-std::array<float,2>{0.96562022f, 0.931034625f},
-std::array<float,2>{0.225268021f, 0.0629513115f},
-std::array<float,2>{0.713217497f, 0.357570678f},
-std::array<float,2>{0.391719401f, 0.666153252f},
-std::array<float,2>{0.536409318f, 0.504546404f},
-std::array<float,2>{0.366583705f, 0.454819679f},
-std::array<float,2>{0.832529664f, 0.245467365f},
-std::array<float,2>{0.0567279793f, 0.837767243f},
-std::array<float,2>{0.767644703f, 0.689100325f},
-std::array<float,2>{0.066896297f, 0.27368924f},
-std::array<float,2>{0.611807883f, 0.0131515376f},
-std::array<float,2>{0.27085343f, 0.987318456f},
-std::array<float,2>{0.638335228f, 0.811659634f},
-std::array<float,2>{0.450726897f, 0.133350924f},
-std::array<float,2>{0.908821762f, 0.42298308f},
-std::array<float,2>{0.157864109f, 0.602908492f},
-std::array<float,2>{0.856727779f, 0.87290585f},
-std::array<float,2>{0.0233245641f, 0.215213448f},
-std::array<float,2>{0.509460926f, 0.497912645f},
-std::array<float,2>{0.318653584f, 0.535450697f},
-std::array<float,2>{0.744393766f, 0.626309693f},
-std::array<float,2>{0.416365325f, 0.329581797f},
-std::array<float,2>{0.991165042f, 0.0998079851f},
-std::array<float,2>{0.206039801f, 0.900669634f},
-std::array<float,2>{0.885052204f, 0.58534348f},
-std::array<float,2>{0.136461556f, 0.394482911f},
-std::array<float,2>{0.6684466f, 0.17750223f},
-std::array<float,2>{0.47529012f, 0.756360948f},
-std::array<float,2>{0.585640669f, 0.951117456f},
-std::array<float,2>{0.303126991f, 0.0463977493f},
-std::array<float,2>{0.80833745f, 0.298321009f},
-std::array<float,2>{0.107346863f, 0.721907854f},
-std::array<float,2>{0.9360829f, 0.772719443f},
-std::array<float,2>{0.18414855f, 0.161662281f},
-std::array<float,2>{0.644568622f, 0.386805266f},
-std::array<float,2>{0.460539192f, 0.571140528f},
-std::array<float,2>{0.60605675f, 0.740111709f},
-std::array<float,2>{0.261586398f, 0.284669012f},
-std::array<float,2>{0.765159726f, 0.0529056937f},
-std::array<float,2>{0.0843811259f, 0.956221282f},
-std::array<float,2>{0.823012054f, 0.547121167f},
-std::array<float,2>{0.038268216f, 0.477200031f},
-std::array<float,2>{0.547357142f, 0.188971326f},
-std::array<float,2>{0.352438718f, 0.854383945f},
-std::array<float,2>{0.695324004f, 0.888055503f},
-std::array<float,2>{0.387300551f, 0.115393259f},
-std::array<float,2>{0.942451f, 0.322387367f},
-std::array<float,2>{0.236271054f, 0.647288024f},
-std::array<float,2>{0.795991182f, 0.983217001f},
-std::array<float,2>{0.12434458f, 0.0237438641f},
-std::array<float,2>{0.566636741f, 0.265384287f},
-std::array<float,2>{0.287657827f, 0.714290738f},
-std::array<float,2>{0.686350346f, 0.618091524f},
-std::array<float,2>{0.496384203f, 0.407086819f},
-std::array<float,2>{0.895292282f, 0.141758174f},
-std::array<float,2>{0.140819088f, 0.786762953f},
-std::array<float,2>{0.978787243f, 0.680148244f},
-std::array<float,2>{0.197154239f, 0.364160866f},
-std::array<float,2>{0.722043991f, 0.0839493275f},
-std::array<float,2>{0.425548553f, 0.914473951f},
-std::array<float,2>{0.523695111f, 0.821781576f},
-std::array<float,2>{0.339175642f, 0.230077282f},
-std::array<float,2>{0.862462223f, 0.437518507f},
-std::array<float,2>{0.000393519847f, 0.527807772f},
-std::array<float,2>{0.90426445f, 0.96231097f},
-std::array<float,2>{0.149143144f, 0.0578982234f},
-std::array<float,2>{0.674085557f, 0.29269442f},
-std::array<float,2>{0.484549463f, 0.748961151f},
-std::array<float,2>{0.57240963f, 0.563592434f},
-std::array<float,2>{0.295821697f, 0.382259429f},
-std::array<float,2>{0.782404602f, 0.166325733f},
-std::array<float,2>{0.116209403f, 0.773705363f},
-std::array<float,2>{0.867696881f, 0.651876807f},
-std::array<float,2>{0.00898953434f, 0.320209503f},
-std::array<float,2>{0.52218914f, 0.121041283f},
-std::array<float,2>{0.332224816f, 0.875356793f},
-std::array<float,2>{0.729467094f, 0.851272643f},
-std::array<float,2>{0.434298486f, 0.200449541f},
-std::array<float,2>{0.975886285f, 0.476214498f},
-std::array<float,2>{0.190933913f, 0.55689013f},
-std::array<float,2>{0.750644326f, 0.795794487f},
-std::array<float,2>{0.0900166705f, 0.155036718f},
-std::array<float,2>{0.601419032f, 0.420422643f},
-std::array<float,2>{0.250238061f, 0.616431952f},
-std::array<float,2>{0.653722405f, 0.70536679f},
-std::array<float,2>{0.462969542f, 0.255435556f},
-std::array<float,2>{0.922987163f, 0.0164728388f},
-std::array<float,2>{0.173373878f, 0.971132576f},
-std::array<float,2>{0.94565016f, 0.52327317f},
-std::array<float,2>{0.244683638f, 0.44671309f},
-std::array<float,2>{0.689481437f, 0.223044127f},
-std::array<float,2>{0.375115186f, 0.818411529f},
-std::array<float,2>{0.559140623f, 0.907392204f},
-std::array<float,2>{0.350970149f, 0.0909028351f},
-std::array<float,2>{0.816452861f, 0.368495822f},
-std::array<float,2>{0.0457197726f, 0.672345757f},
-std::array<float,2>{0.992735744f, 0.832809806f},
-std::array<float,2>{0.216027409f, 0.238871723f},
-std::array<float,2>{0.741645098f, 0.467037141f},
-std::array<float,2>{0.406737208f, 0.514737904f},
-std::array<float,2>{0.505589485f, 0.661226153f},
-std::array<float,2>{0.321046859f, 0.344634026f},
-std::array<float,2>{0.848921895f, 0.0744004697f},
-std::array<float,2>{0.029366469f, 0.927357554f},
-std::array<float,2>{0.803874552f, 0.601151347f},
-std::array<float,2>{0.0996309221f, 0.434774697f},
-std::array<float,2>{0.593637109f, 0.132665709f},
-std::array<float,2>{0.307577133f, 0.801139772f},
-std::array<float,2>{0.657580674f, 0.992198467f},
-std::array<float,2>{0.482520819f, 0.00267397892f},
-std::array<float,2>{0.880690753f, 0.273231357f},
-std::array<float,2>{0.131459132f, 0.697060347f},
-std::array<float,2>{0.839791238f, 0.894999146f},
-std::array<float,2>{0.0476369709f, 0.104988143f},
-std::array<float,2>{0.543812931f, 0.341207922f},
-std::array<float,2>{0.370846927f, 0.633424461f},
-std::array<float,2>{0.707583666f, 0.542567134f},
-std::array<float,2>{0.40475747f, 0.492139518f},
-std::array<float,2>{0.954450011f, 0.209274307f},
-std::array<float,2>{0.231765777f, 0.861552536f},
-std::array<float,2>{0.921711981f, 0.728418529f},
-std::array<float,2>{0.166415527f, 0.305021763f},
-std::array<float,2>{0.629947722f, 0.0353795923f},
-std::array<float,2>{0.443071455f, 0.943567514f},
-std::array<float,2>{0.619199038f, 0.760142028f},
-std::array<float,2>{0.275362998f, 0.18020387f},
-std::array<float,2>{0.774706066f, 0.404237419f},
-std::array<float,2>{0.0716152862f, 0.592716277f},
-std::array<float,2>{0.950300634f, 0.945701063f},
-std::array<float,2>{0.249255612f, 0.0396228842f},
-std::array<float,2>{0.693435848f, 0.3013255f},
-std::array<float,2>{0.379070759f, 0.723104596f},
-std::array<float,2>{0.558268785f, 0.578348398f},
-std::array<float,2>{0.346696079f, 0.397249937f},
-std::array<float,2>{0.814222813f, 0.173930466f},
-std::array<float,2>{0.0418264642f, 0.751874387f},
-std::array<float,2>{0.755817592f, 0.629524529f},
-std::array<float,2>{0.0861192495f, 0.333889633f},
-std::array<float,2>{0.597220898f, 0.0963712186f},
-std::array<float,2>{0.25665015f, 0.904963911f},
-std::array<float,2>{0.649731994f, 0.867377698f},
-std::array<float,2>{0.467886984f, 0.212050304f},
-std::array<float,2>{0.926599324f, 0.493816942f},
-std::array<float,2>{0.17962268f, 0.534933031f},
-std::array<float,2>{0.87210685f, 0.807934105f},
-std::array<float,2>{0.0145683289f, 0.138403684f},
-std::array<float,2>{0.516398907f, 0.428406566f},
-std::array<float,2>{0.330168009f, 0.605834067f},
-std::array<float,2>{0.732743204f, 0.691640794f},
-std::array<float,2>{0.432249606f, 0.280542701f},
-std::array<float,2>{0.972629845f, 0.0113517689f},
-std::array<float,2>{0.194638446f, 0.988462448f},
-std::array<float,2>{0.899144411f, 0.5029248f},
-std::array<float,2>{0.154374242f, 0.457509875f},
-std::array<float,2>{0.67844373f, 0.248229474f},
-std::array<float,2>{0.489557952f, 0.843571126f},
-std::array<float,2>{0.575251937f, 0.937255263f},
-std::array<float,2>{0.29125607f, 0.0674611777f},
-std::array<float,2>{0.786646664f, 0.353293926f},
-std::array<float,2>{0.113130704f, 0.668880761f},
-std::array<float,2>{0.914260983f, 0.827083349f},
-std::array<float,2>{0.168405876f, 0.234191477f},
-std::array<float,2>{0.628367603f, 0.4436481f},
-std::array<float,2>{0.440531999f, 0.52377218f},
-std::array<float,2>{0.62376827f, 0.685077131f},
-std::array<float,2>{0.27919358f, 0.361077577f},
-std::array<float,2>{0.779816329f, 0.0783687606f},
-std::array<float,2>{0.0751523226f, 0.919339001f},
-std::array<float,2>{0.841075718f, 0.622952223f},
-std::array<float,2>{0.054128319f, 0.41269812f},
-std::array<float,2>{0.54132992f, 0.147900894f},
-std::array<float,2>{0.37296766f, 0.783401966f},
-std::array<float,2>{0.704556704f, 0.977886319f},
-std::array<float,2>{0.400746673f, 0.0279426593f},
-std::array<float,2>{0.960423052f, 0.259548396f},
-std::array<float,2>{0.228147775f, 0.715004802f},
-std::array<float,2>{0.797367215f, 0.885111392f},
-std::array<float,2>{0.0973932669f, 0.109948665f},
-std::array<float,2>{0.587769926f, 0.325441599f},
-std::array<float,2>{0.309695125f, 0.641560256f},
-std::array<float,2>{0.662163913f, 0.551052153f},
-std::array<float,2>{0.47771582f, 0.481095463f},
-std::array<float,2>{0.877713203f, 0.195231557f},
-std::array<float,2>{0.127814412f, 0.858803809f},
-std::array<float,2>{0.999590814f, 0.734716237f},
-std::array<float,2>{0.212377161f, 0.287867814f},
-std::array<float,2>{0.734517634f, 0.0483968966f},
-std::array<float,2>{0.412395179f, 0.960148454f},
-std::array<float,2>{0.501282394f, 0.767592907f},
-std::array<float,2>{0.326151699f, 0.157927483f},
-std::array<float,2>{0.846886039f, 0.384496063f},
-std::array<float,2>{0.0265292935f, 0.575091958f},
-std::array<float,2>{0.889270604f, 0.913482368f},
-std::array<float,2>{0.137272209f, 0.0868317261f},
-std::array<float,2>{0.667522788f, 0.37270388f},
-std::array<float,2>{0.472069323f, 0.679441214f},
-std::array<float,2>{0.579268396f, 0.516877115f},
-std::array<float,2>{0.299122036f, 0.451321125f},
-std::array<float,2>{0.812210262f, 0.221756712f},
-std::array<float,2>{0.104626216f, 0.813597381f},
-std::array<float,2>{0.854945779f, 0.710307837f},
-std::array<float,2>{0.0193154179f, 0.251244158f},
-std::array<float,2>{0.513062954f, 0.0199082401f},
-std::array<float,2>{0.315788299f, 0.974702239f},
-std::array<float,2>{0.746830881f, 0.792547047f},
-std::array<float,2>{0.421630323f, 0.150118873f},
-std::array<float,2>{0.987342536f, 0.41786921f},
-std::array<float,2>{0.210019931f, 0.612599432f},
-std::array<float,2>{0.772864699f, 0.844404995f},
-std::array<float,2>{0.0662661344f, 0.195442766f},
-std::array<float,2>{0.616755605f, 0.470961303f},
-std::array<float,2>{0.266023844f, 0.56149292f},
-std::array<float,2>{0.633982062f, 0.655470908f},
-std::array<float,2>{0.449129194f, 0.313033283f},
-std::array<float,2>{0.911191165f, 0.124719664f},
-std::array<float,2>{0.161821425f, 0.882241666f},
-std::array<float,2>{0.962879598f, 0.567443609f},
-std::array<float,2>{0.22176531f, 0.375508189f},
-std::array<float,2>{0.718675673f, 0.168388501f},
-std::array<float,2>{0.395506024f, 0.780989587f},
-std::array<float,2>{0.531261861f, 0.96849817f},
-std::array<float,2>{0.361036897f, 0.0616289712f},
-std::array<float,2>{0.829702377f, 0.29322499f},
-std::array<float,2>{0.061943341f, 0.745864272f},
-std::array<float,2>{0.981360137f, 0.763826549f},
-std::array<float,2>{0.202270105f, 0.186564118f},
-std::array<float,2>{0.725798965f, 0.401445538f},
-std::array<float,2>{0.426330626f, 0.589270532f},
-std::array<float,2>{0.530877292f, 0.734080076f},
-std::array<float,2>{0.340485513f, 0.310313582f},
-std::array<float,2>{0.866640806f, 0.0314494707f},
-std::array<float,2>{0.00500741601f, 0.939093888f},
-std::array<float,2>{0.792136729f, 0.545668542f},
-std::array<float,2>{0.117580108f, 0.486618072f},
-std::array<float,2>{0.564816833f, 0.203683436f},
-std::array<float,2>{0.284066051f, 0.864933312f},
-std::array<float,2>{0.680585325f, 0.892402947f},
-std::array<float,2>{0.49407652f, 0.109188661f},
-std::array<float,2>{0.890877187f, 0.336337239f},
-std::array<float,2>{0.14585638f, 0.638742864f},
-std::array<float,2>{0.826951921f, 0.996694744f},
-std::array<float,2>{0.0345271304f, 0.00399320433f},
-std::array<float,2>{0.554232061f, 0.267106056f},
-std::array<float,2>{0.355950534f, 0.702891648f},
-std::array<float,2>{0.700664103f, 0.59526813f},
-std::array<float,2>{0.384928703f, 0.431852967f},
-std::array<float,2>{0.940741837f, 0.126569226f},
-std::array<float,2>{0.238635987f, 0.799684525f},
-std::array<float,2>{0.929734588f, 0.659623623f},
-std::array<float,2>{0.18127574f, 0.348776817f},
-std::array<float,2>{0.642912328f, 0.070884198f},
-std::array<float,2>{0.455980182f, 0.922883868f},
-std::array<float,2>{0.602259636f, 0.830445468f},
-std::array<float,2>{0.262514323f, 0.236161977f},
-std::array<float,2>{0.761298358f, 0.462669581f},
-std::array<float,2>{0.0806617513f, 0.510937333f},
-std::array<float,2>{0.988652229f, 0.900344729f},
-std::array<float,2>{0.203218728f, 0.0995693803f},
-std::array<float,2>{0.742308378f, 0.331666023f},
-std::array<float,2>{0.415199399f, 0.628320456f},
-std::array<float,2>{0.51074183f, 0.538450241f},
-std::array<float,2>{0.317447871f, 0.499861896f},
-std::array<float,2>{0.858567655f, 0.218078911f},
-std::array<float,2>{0.0202817712f, 0.874308288f},
-std::array<float,2>{0.805349767f, 0.719501674f},
-std::array<float,2>{0.10771437f, 0.300711751f},
-std::array<float,2>{0.583499908f, 0.0431886464f},
-std::array<float,2>{0.301517069f, 0.95188719f},
-std::array<float,2>{0.670614481f, 0.755388498f},
-std::array<float,2>{0.473382413f, 0.179025635f},
-std::array<float,2>{0.884264171f, 0.390627772f},
-std::array<float,2>{0.133847713f, 0.583270311f},
-std::array<float,2>{0.835882485f, 0.838035047f},
-std::array<float,2>{0.0559407286f, 0.242547229f},
-std::array<float,2>{0.537960589f, 0.4564026f},
-std::array<float,2>{0.363345087f, 0.50735563f},
-std::array<float,2>{0.712331533f, 0.664815068f},
-std::array<float,2>{0.39385283f, 0.356196105f},
-std::array<float,2>{0.966880381f, 0.0656940863f},
-std::array<float,2>{0.223721504f, 0.933282018f},
-std::array<float,2>{0.906765759f, 0.604210317f},
-std::array<float,2>{0.159690201f, 0.424465328f},
-std::array<float,2>{0.640440106f, 0.135723174f},
-std::array<float,2>{0.452012807f, 0.810179949f},
-std::array<float,2>{0.610880017f, 0.984531641f},
-std::array<float,2>{0.271665305f, 0.0149085587f},
-std::array<float,2>{0.767187893f, 0.276273459f},
-std::array<float,2>{0.0694873706f, 0.690352738f},
-std::array<float,2>{0.896670222f, 0.78884387f},
-std::array<float,2>{0.142726079f, 0.144026622f},
-std::array<float,2>{0.684971511f, 0.409089535f},
-std::array<float,2>{0.499346465f, 0.619859815f},
-std::array<float,2>{0.568954647f, 0.712527633f},
-std::array<float,2>{0.285667777f, 0.261981457f},
-std::array<float,2>{0.793727279f, 0.0265775826f},
-std::array<float,2>{0.122891195f, 0.980591536f},
-std::array<float,2>{0.860654533f, 0.530794442f},
-std::array<float,2>{0.00375458342f, 0.441226453f},
-std::array<float,2>{0.525916755f, 0.22712256f},
-std::array<float,2>{0.336005926f, 0.824016511f},
-std::array<float,2>{0.720362782f, 0.916878641f},
-std::array<float,2>{0.423156232f, 0.0841847435f},
-std::array<float,2>{0.977895081f, 0.365374357f},
-std::array<float,2>{0.197575837f, 0.68347317f},
-std::array<float,2>{0.763492763f, 0.954273462f},
-std::array<float,2>{0.0820902586f, 0.0512011833f},
-std::array<float,2>{0.607720912f, 0.28297323f},
-std::array<float,2>{0.259349108f, 0.741574824f},
-std::array<float,2>{0.648218691f, 0.574180245f},
-std::array<float,2>{0.457476884f, 0.389494598f},
-std::array<float,2>{0.934320986f, 0.162784904f},
-std::array<float,2>{0.187354803f, 0.77062881f},
-std::array<float,2>{0.94484663f, 0.644865572f},
-std::array<float,2>{0.237684101f, 0.32064423f},
-std::array<float,2>{0.699105918f, 0.11475727f},
-std::array<float,2>{0.389044613f, 0.889907062f},
-std::array<float,2>{0.550717592f, 0.851778328f},
-std::array<float,2>{0.354234308f, 0.19096759f},
-std::array<float,2>{0.820553362f, 0.479927361f},
-std::array<float,2>{0.0363724828f, 0.549377084f},
-std::array<float,2>{0.924504697f, 0.968869567f},
-std::array<float,2>{0.174159959f, 0.0185368769f},
-std::array<float,2>{0.655198157f, 0.257133901f},
-std::array<float,2>{0.462206542f, 0.703198373f},
-std::array<float,2>{0.599502981f, 0.61472249f},
-std::array<float,2>{0.252828002f, 0.418826282f},
-std::array<float,2>{0.75339371f, 0.153611407f},
-std::array<float,2>{0.093203336f, 0.793542027f},
-std::array<float,2>{0.818778396f, 0.675418913f},
-std::array<float,2>{0.0448165536f, 0.369918257f},
-std::array<float,2>{0.562302411f, 0.0923293009f},
-std::array<float,2>{0.348601013f, 0.908673882f},
-std::array<float,2>{0.689355671f, 0.817830324f},
-std::array<float,2>{0.378049821f, 0.225018546f},
-std::array<float,2>{0.947576165f, 0.44765377f},
-std::array<float,2>{0.24235633f, 0.519723296f},
-std::array<float,2>{0.783698142f, 0.776088595f},
-std::array<float,2>{0.114886649f, 0.165431395f},
-std::array<float,2>{0.571980357f, 0.379531413f},
-std::array<float,2>{0.294006646f, 0.565505862f},
-std::array<float,2>{0.673572063f, 0.747149825f},
-std::array<float,2>{0.487928778f, 0.290848881f},
-std::array<float,2>{0.905516863f, 0.056268584f},
-std::array<float,2>{0.150900438f, 0.96458739f},
-std::array<float,2>{0.973081768f, 0.55639267f},
-std::array<float,2>{0.188759193f, 0.473755032f},
-std::array<float,2>{0.727852285f, 0.201334044f},
-std::array<float,2>{0.435590148f, 0.8488397f},
-std::array<float,2>{0.519960403f, 0.878233075f},
-std::array<float,2>{0.335572451f, 0.119134463f},
-std::array<float,2>{0.870010614f, 0.316533178f},
-std::array<float,2>{0.00992986374f, 0.64895618f},
-std::array<float,2>{0.955838323f, 0.86128509f},
-std::array<float,2>{0.234042376f, 0.207322448f},
-std::array<float,2>{0.709567308f, 0.488880724f},
-std::array<float,2>{0.403485537f, 0.539485991f},
-std::array<float,2>{0.545347452f, 0.63575393f},
-std::array<float,2>{0.367851615f, 0.342681199f},
-std::array<float,2>{0.836711586f, 0.102471717f},
-std::array<float,2>{0.0506039187f, 0.896581352f},
-std::array<float,2>{0.77727294f, 0.591556251f},
-std::array<float,2>{0.0725225136f, 0.405579865f},
-std::array<float,2>{0.618097842f, 0.18167153f},
-std::array<float,2>{0.276095778f, 0.75884068f},
-std::array<float,2>{0.632451415f, 0.943074882f},
-std::array<float,2>{0.444746345f, 0.0390357748f},
-std::array<float,2>{0.919546247f, 0.307929933f},
-std::array<float,2>{0.164454952f, 0.728963554f},
-std::array<float,2>{0.851032913f, 0.92851299f},
-std::array<float,2>{0.0282959491f, 0.0762635693f},
-std::array<float,2>{0.505919397f, 0.346208036f},
-std::array<float,2>{0.322784752f, 0.663268745f},
-std::array<float,2>{0.738543808f, 0.512260914f},
-std::array<float,2>{0.409924358f, 0.466763616f},
-std::array<float,2>{0.995654702f, 0.242042258f},
-std::array<float,2>{0.218408346f, 0.83494854f},
-std::array<float,2>{0.881446302f, 0.698678076f},
-std::array<float,2>{0.130567968f, 0.271116555f},
-std::array<float,2>{0.65994364f, 0.000859898864f},
-std::array<float,2>{0.480560392f, 0.994684815f},
-std::array<float,2>{0.590521991f, 0.80317533f},
-std::array<float,2>{0.305970043f, 0.129626453f},
-std::array<float,2>{0.8023808f, 0.437230021f},
-std::array<float,2>{0.0985038802f, 0.598058641f}}
\ No newline at end of file
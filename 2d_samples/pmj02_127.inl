@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.130389646f, 0.0736084878f},
-std::array<float,2>{0.779618859f, 0.700852811f},
-std::array<float,2>{0.382848114f, 0.962426364f},
-std::array<float,2>{0.631880522f, 0.303607941f},
-std::array<float,2>{0.347370982f, 0.393012077f},
-std::array<float,2>{0.557134092f, 0.805845737f},
-std::array<float,2>{0.0919090956f, 0.545148492f},
-std::array<float,2>{0.884828806f, 0.182977289f},
-std::array<float,2>{0.061305631f, 0.368047297f},
-std::array<float,2>{0.980525374f, 0.896384776f},
-std::array<float,2>{0.288893253f, 0.678182185f},
-std::array<float,2>{0.595348477f, 0.0558458082f},
-std::array<float,2>{0.497197211f, 0.202970415f},
-std::array<float,2>{0.698923826f, 0.579607546f},
-std::array<float,2>{0.189266011f, 0.867983937f},
-std::array<float,2>{0.832549751f, 0.44833988f},
-std::array<float,2>{0.108040966f, 0.142029732f},
-std::array<float,2>{0.917295814f, 0.506347656f},
-std::array<float,2>{0.338442713f, 0.771143794f},
-std::array<float,2>{0.525801122f, 0.407353699f},
-std::array<float,2>{0.413291305f, 0.264592886f},
-std::array<float,2>{0.686316073f, 0.996110082f},
-std::array<float,2>{0.166008964f, 0.724817455f},
-std::array<float,2>{0.794962525f, 0.113147758f},
-std::array<float,2>{0.24747926f, 0.47879231f},
-std::array<float,2>{0.858923852f, 0.824073374f},
-std::array<float,2>{0.45027101f, 0.597908854f},
-std::array<float,2>{0.744199872f, 0.226091161f},
-std::array<float,2>{0.276704073f, 0.0284923427f},
-std::array<float,2>{0.589957297f, 0.644020975f},
-std::array<float,2>{0.0248524956f, 0.914086401f},
-std::array<float,2>{0.95404917f, 0.32309556f},
-std::array<float,2>{0.0146350013f, 0.045452293f},
-std::array<float,2>{0.941049814f, 0.657716632f},
-std::array<float,2>{0.253775567f, 0.888635278f},
-std::array<float,2>{0.565817535f, 0.35412854f},
-std::array<float,2>{0.467090309f, 0.462269157f},
-std::array<float,2>{0.731682599f, 0.855855405f},
-std::array<float,2>{0.230676308f, 0.571489394f},
-std::array<float,2>{0.861811042f, 0.214176431f},
-std::array<float,2>{0.185597554f, 0.296202689f},
-std::array<float,2>{0.803743541f, 0.940212011f},
-std::array<float,2>{0.429263175f, 0.714324653f},
-std::array<float,2>{0.656389177f, 0.088069655f},
-std::array<float,2>{0.314004123f, 0.166969478f},
-std::array<float,2>{0.511871457f, 0.554790258f},
-std::array<float,2>{0.115097903f, 0.783167839f},
-std::array<float,2>{0.930419505f, 0.387366116f},
-std::array<float,2>{0.212591171f, 0.243253782f},
-std::array<float,2>{0.816473603f, 0.62368691f},
-std::array<float,2>{0.469247252f, 0.830174625f},
-std::array<float,2>{0.715303183f, 0.487290591f},
-std::array<float,2>{0.311812043f, 0.330238342f},
-std::array<float,2>{0.619865656f, 0.932044446f},
-std::array<float,2>{0.0399890877f, 0.637572765f},
-std::array<float,2>{0.987160623f, 0.00340451091f},
-std::array<float,2>{0.0681963786f, 0.422401577f},
-std::array<float,2>{0.890729725f, 0.762685299f},
-std::array<float,2>{0.364578456f, 0.528262496f},
-std::array<float,2>{0.533678532f, 0.126359254f},
-std::array<float,2>{0.390883178f, 0.093868345f},
-std::array<float,2>{0.651033998f, 0.742115021f},
-std::array<float,2>{0.145750836f, 0.976418555f},
-std::array<float,2>{0.752416909f, 0.273171037f},
-std::array<float,2>{0.219943523f, 0.00974611659f},
-std::array<float,2>{0.8680408f, 0.625303686f},
-std::array<float,2>{0.454182297f, 0.927314937f},
-std::array<float,2>{0.718762994f, 0.340425014f},
-std::array<float,2>{0.2579391f, 0.493522674f},
-std::array<float,2>{0.571482599f, 0.838584185f},
-std::array<float,2>{0.00279545737f, 0.615076184f},
-std::array<float,2>{0.948537469f, 0.239725068f},
-std::array<float,2>{0.123180792f, 0.275781631f},
-std::array<float,2>{0.923632503f, 0.981558323f},
-std::array<float,2>{0.323708177f, 0.744901419f},
-std::array<float,2>{0.504313409f, 0.105630778f},
-std::array<float,2>{0.432637721f, 0.135893956f},
-std::array<float,2>{0.66867888f, 0.520688891f},
-std::array<float,2>{0.173417047f, 0.750784099f},
-std::array<float,2>{0.811183155f, 0.433242023f},
-std::array<float,2>{0.0323013365f, 0.208404481f},
-std::array<float,2>{0.993515074f, 0.563437939f},
-std::array<float,2>{0.299114913f, 0.850307286f},
-std::array<float,2>{0.614302456f, 0.45636031f},
-std::array<float,2>{0.480857909f, 0.345564485f},
-std::array<float,2>{0.704634845f, 0.87823689f},
-std::array<float,2>{0.206749126f, 0.669283926f},
-std::array<float,2>{0.824000776f, 0.0340310596f},
-std::array<float,2>{0.148819059f, 0.379468471f},
-std::array<float,2>{0.761078417f, 0.793602169f},
-std::array<float,2>{0.404868901f, 0.550551295f},
-std::array<float,2>{0.646085143f, 0.160519674f},
-std::array<float,2>{0.37151289f, 0.0813309401f},
-std::array<float,2>{0.543892562f, 0.707511306f},
-std::array<float,2>{0.0710471347f, 0.948801637f},
-std::array<float,2>{0.901388705f, 0.285459787f},
-std::array<float,2>{0.0791241452f, 0.122084767f},
-std::array<float,2>{0.88022697f, 0.734178483f},
-std::array<float,2>{0.357246161f, 0.986207664f},
-std::array<float,2>{0.548380494f, 0.252593279f},
-std::array<float,2>{0.376184195f, 0.41871804f},
-std::array<float,2>{0.639510989f, 0.778671741f},
-std::array<float,2>{0.135948434f, 0.51464963f},
-std::array<float,2>{0.767599165f, 0.148976579f},
-std::array<float,2>{0.197776571f, 0.318312675f},
-std::array<float,2>{0.838967025f, 0.913387179f},
-std::array<float,2>{0.49016735f, 0.655042589f},
-std::array<float,2>{0.691977262f, 0.0208650343f},
-std::array<float,2>{0.296801299f, 0.230110198f},
-std::array<float,2>{0.602106392f, 0.609042287f},
-std::array<float,2>{0.0517888665f, 0.81839633f},
-std::array<float,2>{0.976495862f, 0.472736627f},
-std::array<float,2>{0.16315268f, 0.178477496f},
-std::array<float,2>{0.786591709f, 0.537139237f},
-std::array<float,2>{0.419488221f, 0.798300385f},
-std::array<float,2>{0.672777176f, 0.40212974f},
-std::array<float,2>{0.332932413f, 0.310842276f},
-std::array<float,2>{0.52261579f, 0.954821467f},
-std::array<float,2>{0.096631214f, 0.68873477f},
-std::array<float,2>{0.912835002f, 0.0641040802f},
-std::array<float,2>{0.0199807938f, 0.440858901f},
-std::array<float,2>{0.964850128f, 0.864482999f},
-std::array<float,2>{0.272089213f, 0.587500453f},
-std::array<float,2>{0.58271265f, 0.188489839f},
-std::array<float,2>{0.443755656f, 0.0473560132f},
-std::array<float,2>{0.740430653f, 0.681479216f},
-std::array<float,2>{0.235673577f, 0.904739261f},
-std::array<float,2>{0.849027753f, 0.360865861f},
-std::array<float,2>{0.176303059f, 0.0585999824f},
-std::array<float,2>{0.806886673f, 0.675104082f},
-std::array<float,2>{0.436400384f, 0.891441405f},
-std::array<float,2>{0.664142132f, 0.371342599f},
-std::array<float,2>{0.326018453f, 0.451922059f},
-std::array<float,2>{0.503568351f, 0.871653318f},
-std::array<float,2>{0.11745701f, 0.583638728f},
-std::array<float,2>{0.927473903f, 0.198584408f},
-std::array<float,2>{0.00394924125f, 0.298755854f},
-std::array<float,2>{0.952770889f, 0.966100931f},
-std::array<float,2>{0.26214692f, 0.698692143f},
-std::array<float,2>{0.57625401f, 0.0753104985f},
-std::array<float,2>{0.459595889f, 0.186636806f},
-std::array<float,2>{0.724291801f, 0.541952968f},
-std::array<float,2>{0.223937333f, 0.809553206f},
-std::array<float,2>{0.871345162f, 0.397672206f},
-std::array<float,2>{0.0764148459f, 0.219774827f},
-std::array<float,2>{0.902766407f, 0.595362961f},
-std::array<float,2>{0.368803114f, 0.82730478f},
-std::array<float,2>{0.540558577f, 0.481696874f},
-std::array<float,2>{0.400293231f, 0.324449211f},
-std::array<float,2>{0.643441916f, 0.91914022f},
-std::array<float,2>{0.155889556f, 0.645884156f},
-std::array<float,2>{0.762838006f, 0.0262654647f},
-std::array<float,2>{0.208580673f, 0.414035767f},
-std::array<float,2>{0.827991664f, 0.766554773f},
-std::array<float,2>{0.477074295f, 0.500889122f},
-std::array<float,2>{0.70903945f, 0.144756898f},
-std::array<float,2>{0.303288311f, 0.116949119f},
-std::array<float,2>{0.610587001f, 0.722449124f},
-std::array<float,2>{0.0375435092f, 0.994134367f},
-std::array<float,2>{0.999726117f, 0.258198678f},
-std::array<float,2>{0.0481181368f, 0.0924300998f},
-std::array<float,2>{0.968802571f, 0.716287136f},
-std::array<float,2>{0.29018569f, 0.941698194f},
-std::array<float,2>{0.606199503f, 0.291200489f},
-std::array<float,2>{0.487178028f, 0.386050075f},
-std::array<float,2>{0.688470483f, 0.786520183f},
-std::array<float,2>{0.20201543f, 0.561605334f},
-std::array<float,2>{0.84218353f, 0.170131713f},
-std::array<float,2>{0.139465332f, 0.356851995f},
-std::array<float,2>{0.771668971f, 0.885002494f},
-std::array<float,2>{0.381412804f, 0.662409604f},
-std::array<float,2>{0.636453986f, 0.0415437818f},
-std::array<float,2>{0.353369415f, 0.21677272f},
-std::array<float,2>{0.55168736f, 0.577532649f},
-std::array<float,2>{0.0835788846f, 0.854693174f},
-std::array<float,2>{0.877209067f, 0.468661278f},
-std::array<float,2>{0.239680812f, 0.129002184f},
-std::array<float,2>{0.844156146f, 0.52663523f},
-std::array<float,2>{0.440658212f, 0.760336876f},
-std::array<float,2>{0.736485481f, 0.429478854f},
-std::array<float,2>{0.26711458f, 0.265637517f},
-std::array<float,2>{0.57868582f, 0.971591055f},
-std::array<float,2>{0.0169839114f, 0.735865295f},
-std::array<float,2>{0.962690115f, 0.100994594f},
-std::array<float,2>{0.0987514257f, 0.48848325f},
-std::array<float,2>{0.907364547f, 0.833459198f},
-std::array<float,2>{0.329832941f, 0.61903286f},
-std::array<float,2>{0.51766187f, 0.247714698f},
-std::array<float,2>{0.414417148f, 0.00554338051f},
-std::array<float,2>{0.678439081f, 0.635874987f},
-std::array<float,2>{0.159258246f, 0.936635554f},
-std::array<float,2>{0.783222973f, 0.333818138f},
-std::array<float,2>{0.192072913f, 0.102773391f},
-std::array<float,2>{0.829825521f, 0.747332156f},
-std::array<float,2>{0.494212747f, 0.979152501f},
-std::array<float,2>{0.702039599f, 0.280530423f},
-std::array<float,2>{0.281606734f, 0.43614623f},
-std::array<float,2>{0.597766459f, 0.756365299f},
-std::array<float,2>{0.0581495687f, 0.51692158f},
-std::array<float,2>{0.977939546f, 0.138113871f},
-std::array<float,2>{0.0876987204f, 0.338912755f},
-std::array<float,2>{0.888826728f, 0.925718188f},
-std::array<float,2>{0.347868949f, 0.62901628f},
-std::array<float,2>{0.559526742f, 0.0117517421f},
-std::array<float,2>{0.387460142f, 0.236525774f},
-std::array<float,2>{0.625445843f, 0.612831891f},
-std::array<float,2>{0.127236992f, 0.839874625f},
-std::array<float,2>{0.774870276f, 0.497833371f},
-std::array<float,2>{0.0284218937f, 0.159141034f},
-std::array<float,2>{0.960575938f, 0.551492274f},
-std::array<float,2>{0.279043406f, 0.792696416f},
-std::array<float,2>{0.588101685f, 0.376025528f},
-std::array<float,2>{0.447861969f, 0.284335613f},
-std::array<float,2>{0.747035623f, 0.950972319f},
-std::array<float,2>{0.243357629f, 0.704833388f},
-std::array<float,2>{0.853521109f, 0.0850372836f},
-std::array<float,2>{0.168730006f, 0.458117604f},
-std::array<float,2>{0.791415036f, 0.846847057f},
-std::array<float,2>{0.407176435f, 0.5676772f},
-std::array<float,2>{0.681605697f, 0.204770833f},
-std::array<float,2>{0.340431601f, 0.0362813398f},
-std::array<float,2>{0.528105021f, 0.666894913f},
-std::array<float,2>{0.103429012f, 0.880760729f},
-std::array<float,2>{0.918636262f, 0.351491779f},
-std::array<float,2>{0.109629788f, 0.0180277098f},
-std::array<float,2>{0.93459022f, 0.652317107f},
-std::array<float,2>{0.319785833f, 0.906862378f},
-std::array<float,2>{0.50821954f, 0.314222574f},
-std::array<float,2>{0.425752729f, 0.470400304f},
-std::array<float,2>{0.660685301f, 0.814531863f},
-std::array<float,2>{0.18095006f, 0.602457225f},
-std::array<float,2>{0.799048424f, 0.231390238f},
-std::array<float,2>{0.227785021f, 0.256455481f},
-std::array<float,2>{0.867180943f, 0.989655077f},
-std::array<float,2>{0.46212697f, 0.729832113f},
-std::array<float,2>{0.727792084f, 0.118567489f},
-std::array<float,2>{0.25680089f, 0.153661951f},
-std::array<float,2>{0.569177806f, 0.509898007f},
-std::array<float,2>{0.0109333703f, 0.77555263f},
-std::array<float,2>{0.944850802f, 0.414947569f},
-std::array<float,2>{0.143829226f, 0.191648856f},
-std::array<float,2>{0.755690038f, 0.593290091f},
-std::array<float,2>{0.394557685f, 0.860422432f},
-std::array<float,2>{0.655422628f, 0.441473126f},
-std::array<float,2>{0.3622455f, 0.364510745f},
-std::array<float,2>{0.53646332f, 0.898857653f},
-std::array<float,2>{0.0658631474f, 0.685698032f},
-std::array<float,2>{0.896551311f, 0.0538319573f},
-std::array<float,2>{0.0463701673f, 0.403703988f},
-std::array<float,2>{0.991263092f, 0.800829232f},
-std::array<float,2>{0.306159258f, 0.532156765f},
-std::array<float,2>{0.623225629f, 0.174495533f},
-std::array<float,2>{0.474360555f, 0.0683712885f},
-std::array<float,2>{0.712037385f, 0.691461802f},
-std::array<float,2>{0.215983599f, 0.959933937f},
-std::array<float,2>{0.813653946f, 0.305646479f},
-std::array<float,2>{0.166591376f, 0.109559685f},
-std::array<float,2>{0.794764161f, 0.723784506f},
-std::array<float,2>{0.410642147f, 0.998960137f},
-std::array<float,2>{0.683896959f, 0.262348235f},
-std::array<float,2>{0.33687079f, 0.409192383f},
-std::array<float,2>{0.525115669f, 0.77311933f},
-std::array<float,2>{0.106446862f, 0.505288601f},
-std::array<float,2>{0.914533257f, 0.143139675f},
-std::array<float,2>{0.0265204683f, 0.320314109f},
-std::array<float,2>{0.956181586f, 0.916430533f},
-std::array<float,2>{0.274769694f, 0.640892506f},
-std::array<float,2>{0.592605412f, 0.0305558536f},
-std::array<float,2>{0.452876687f, 0.222931758f},
-std::array<float,2>{0.742542326f, 0.600713074f},
-std::array<float,2>{0.249121472f, 0.821538866f},
-std::array<float,2>{0.857080817f, 0.476707578f},
-std::array<float,2>{0.0904497951f, 0.181072325f},
-std::array<float,2>{0.882988691f, 0.544308841f},
-std::array<float,2>{0.345248818f, 0.807665706f},
-std::array<float,2>{0.556453884f, 0.3915672f},
-std::array<float,2>{0.386423498f, 0.301242054f},
-std::array<float,2>{0.63052249f, 0.964216113f},
-std::array<float,2>{0.13278079f, 0.702286541f},
-std::array<float,2>{0.779231071f, 0.0706092417f},
-std::array<float,2>{0.190905273f, 0.447060406f},
-std::array<float,2>{0.834374845f, 0.869646728f},
-std::array<float,2>{0.498539984f, 0.580825746f},
-std::array<float,2>{0.696803153f, 0.200394496f},
-std::array<float,2>{0.28616941f, 0.0584098175f},
-std::array<float,2>{0.596796989f, 0.677672803f},
-std::array<float,2>{0.0602965765f, 0.896551907f},
-std::array<float,2>{0.984350204f, 0.371061862f},
-std::array<float,2>{0.0429464951f, 0.0013084379f},
-std::array<float,2>{0.984644711f, 0.640144169f},
-std::array<float,2>{0.308700204f, 0.93060559f},
-std::array<float,2>{0.618393362f, 0.328537405f},
-std::array<float,2>{0.472097814f, 0.485592365f},
-std::array<float,2>{0.718376517f, 0.828472316f},
-std::array<float,2>{0.21292074f, 0.621942461f},
-std::array<float,2>{0.820115209f, 0.244264945f},
-std::array<float,2>{0.146782577f, 0.271347642f},
-std::array<float,2>{0.751594782f, 0.973407805f},
-std::array<float,2>{0.392998606f, 0.73877579f},
-std::array<float,2>{0.648839176f, 0.0975886285f},
-std::array<float,2>{0.367023617f, 0.12850447f},
-std::array<float,2>{0.532157719f, 0.529987156f},
-std::array<float,2>{0.0691997111f, 0.765259862f},
-std::array<float,2>{0.893841028f, 0.424355596f},
-std::array<float,2>{0.233425707f, 0.211881757f},
-std::array<float,2>{0.86005348f, 0.572587967f},
-std::array<float,2>{0.466425627f, 0.85869348f},
-std::array<float,2>{0.733860612f, 0.464460105f},
-std::array<float,2>{0.251243949f, 0.351655275f},
-std::array<float,2>{0.56438154f, 0.889761746f},
-std::array<float,2>{0.012864545f, 0.65994072f},
-std::array<float,2>{0.938578427f, 0.0442959592f},
-std::array<float,2>{0.116713844f, 0.39029035f},
-std::array<float,2>{0.932931602f, 0.784195006f},
-std::array<float,2>{0.316094011f, 0.556902587f},
-std::array<float,2>{0.515266418f, 0.164253429f},
-std::array<float,2>{0.426671237f, 0.0872894526f},
-std::array<float,2>{0.659456253f, 0.712697804f},
-std::array<float,2>{0.183938816f, 0.938717842f},
-std::array<float,2>{0.801614285f, 0.293700546f},
-std::array<float,2>{0.203145847f, 0.0315852016f},
-std::array<float,2>{0.820347905f, 0.670951486f},
-std::array<float,2>{0.482928008f, 0.87623769f},
-std::array<float,2>{0.706508756f, 0.347593844f},
-std::array<float,2>{0.298186868f, 0.454178423f},
-std::array<float,2>{0.617056012f, 0.849191487f},
-std::array<float,2>{0.0335313119f, 0.565867782f},
-std::array<float,2>{0.99596256f, 0.210512519f},
-std::array<float,2>{0.0725290775f, 0.287754983f},
-std::array<float,2>{0.899313271f, 0.947006226f},
-std::array<float,2>{0.373740017f, 0.710601509f},
-std::array<float,2>{0.546025932f, 0.0792403221f},
-std::array<float,2>{0.403610021f, 0.162951171f},
-std::array<float,2>{0.646915913f, 0.547827482f},
-std::array<float,2>{0.152080834f, 0.79613018f},
-std::array<float,2>{0.758113503f, 0.382434785f},
-std::array<float,2>{0.00169307471f, 0.241533324f},
-std::array<float,2>{0.946159482f, 0.615747929f},
-std::array<float,2>{0.26133889f, 0.836351693f},
-std::array<float,2>{0.574075818f, 0.495305747f},
-std::array<float,2>{0.456615567f, 0.343134075f},
-std::array<float,2>{0.722048819f, 0.92842412f},
-std::array<float,2>{0.221171111f, 0.628096938f},
-std::array<float,2>{0.870102048f, 0.0110454811f},
-std::array<float,2>{0.174580202f, 0.430346698f},
-std::array<float,2>{0.809503853f, 0.752101839f},
-std::array<float,2>{0.430742264f, 0.521534979f},
-std::array<float,2>{0.670993209f, 0.133289263f},
-std::array<float,2>{0.321870983f, 0.108992979f},
-std::array<float,2>{0.506117582f, 0.743418336f},
-std::array<float,2>{0.121229343f, 0.982427061f},
-std::array<float,2>{0.924397171f, 0.274345458f},
-std::array<float,2>{0.0941793621f, 0.066080749f},
-std::array<float,2>{0.911824346f, 0.691295803f},
-std::array<float,2>{0.334297776f, 0.955925941f},
-std::array<float,2>{0.51960659f, 0.309531957f},
-std::array<float,2>{0.420938969f, 0.399747103f},
-std::array<float,2>{0.67400372f, 0.799600661f},
-std::array<float,2>{0.160802186f, 0.535442472f},
-std::array<float,2>{0.787984908f, 0.177128509f},
-std::array<float,2>{0.238257393f, 0.361424118f},
-std::array<float,2>{0.850688994f, 0.90260762f},
-std::array<float,2>{0.441616535f, 0.683007479f},
-std::array<float,2>{0.738865733f, 0.0492600091f},
-std::array<float,2>{0.271174461f, 0.189796299f},
-std::array<float,2>{0.584894955f, 0.58820492f},
-std::array<float,2>{0.0224196985f, 0.866471291f},
-std::array<float,2>{0.968135059f, 0.43920517f},
-std::array<float,2>{0.133622065f, 0.151857153f},
-std::array<float,2>{0.766648591f, 0.511870384f},
-std::array<float,2>{0.377059639f, 0.779826641f},
-std::array<float,2>{0.638012528f, 0.421012133f},
-std::array<float,2>{0.358530074f, 0.250868171f},
-std::array<float,2>{0.55053556f, 0.987565577f},
-std::array<float,2>{0.0809921324f, 0.73066926f},
-std::array<float,2>{0.882064342f, 0.12319655f},
-std::array<float,2>{0.0529895015f, 0.474905252f},
-std::array<float,2>{0.973111629f, 0.81784445f},
-std::array<float,2>{0.293098688f, 0.607149005f},
-std::array<float,2>{0.6048069f, 0.228369027f},
-std::array<float,2>{0.491418332f, 0.0222367868f},
-std::array<float,2>{0.695034802f, 0.653879702f},
-std::array<float,2>{0.197235972f, 0.911969304f},
-std::array<float,2>{0.837571621f, 0.319021791f},
-std::array<float,2>{0.154101297f, 0.0235121008f},
-std::array<float,2>{0.765374899f, 0.646998644f},
-std::array<float,2>{0.401559979f, 0.921007693f},
-std::array<float,2>{0.641552746f, 0.32782954f},
-std::array<float,2>{0.369458765f, 0.483678728f},
-std::array<float,2>{0.542819262f, 0.824592471f},
-std::array<float,2>{0.0745716244f, 0.596903741f},
-std::array<float,2>{0.905712545f, 0.220855027f},
-std::array<float,2>{0.0355296992f, 0.260089844f},
-std::array<float,2>{0.99668926f, 0.99481678f},
-std::array<float,2>{0.301957339f, 0.718769133f},
-std::array<float,2>{0.612554908f, 0.113764785f},
-std::array<float,2>{0.479392558f, 0.147879019f},
-std::array<float,2>{0.708327234f, 0.502984643f},
-std::array<float,2>{0.210321814f, 0.769122064f},
-std::array<float,2>{0.824367285f, 0.411749154f},
-std::array<float,2>{0.119819157f, 0.195368931f},
-std::array<float,2>{0.928503692f, 0.584905684f},
-std::array<float,2>{0.32628122f, 0.873806477f},
-std::array<float,2>{0.500366271f, 0.450555593f},
-std::array<float,2>{0.434297264f, 0.374469191f},
-std::array<float,2>{0.666211367f, 0.894451916f},
-std::array<float,2>{0.178988114f, 0.673164964f},
-std::array<float,2>{0.804950237f, 0.0618558638f},
-std::array<float,2>{0.225793555f, 0.39516896f},
-std::array<float,2>{0.87381345f, 0.810855687f},
-std::array<float,2>{0.458839923f, 0.540652394f},
-std::array<float,2>{0.726451933f, 0.184095606f},
-std::array<float,2>{0.264340073f, 0.0778746679f},
-std::array<float,2>{0.575437307f, 0.695896804f},
-std::array<float,2>{0.00726300571f, 0.96718806f},
-std::array<float,2>{0.950356901f, 0.2998254f},
-std::array<float,2>{0.0183238853f, 0.0977866575f},
-std::array<float,2>{0.963969171f, 0.737447202f},
-std::array<float,2>{0.267590076f, 0.968803644f},
-std::array<float,2>{0.580515683f, 0.269103289f},
-std::array<float,2>{0.439354092f, 0.426575512f},
-std::array<float,2>{0.736117899f, 0.759505212f},
-std::array<float,2>{0.24112539f, 0.524036884f},
-std::array<float,2>{0.847082794f, 0.131626561f},
-std::array<float,2>{0.156821191f, 0.334988594f},
-std::array<float,2>{0.781745911f, 0.933779359f},
-std::array<float,2>{0.416433364f, 0.63295114f},
-std::array<float,2>{0.676700592f, 0.00684967777f},
-std::array<float,2>{0.33201623f, 0.249631569f},
-std::array<float,2>{0.517145336f, 0.619773328f},
-std::array<float,2>{0.101185106f, 0.834642589f},
-std::array<float,2>{0.909886837f, 0.492044568f},
-std::array<float,2>{0.199700743f, 0.169787452f},
-std::array<float,2>{0.841122746f, 0.560379148f},
-std::array<float,2>{0.485677719f, 0.788751781f},
-std::array<float,2>{0.689633191f, 0.384030968f},
-std::array<float,2>{0.291944861f, 0.290129811f},
-std::array<float,2>{0.608106017f, 0.945164561f},
-std::array<float,2>{0.0496429652f, 0.718038857f},
-std::array<float,2>{0.971360981f, 0.0906137973f},
-std::array<float,2>{0.0855327323f, 0.466727108f},
-std::array<float,2>{0.875727654f, 0.852889955f},
-std::array<float,2>{0.35513708f, 0.574496329f},
-std::array<float,2>{0.552831054f, 0.217068732f},
-std::array<float,2>{0.379946023f, 0.0407370292f},
-std::array<float,2>{0.633505464f, 0.660533547f},
-std::array<float,2>{0.137187913f, 0.883909285f},
-std::array<float,2>{0.770547271f, 0.357697099f},
-std::array<float,2>{0.245669797f, 0.0831499398f},
-std::array<float,2>{0.852953255f, 0.706062496f},
-std::array<float,2>{0.446584284f, 0.951593459f},
-std::array<float,2>{0.748074293f, 0.282486022f},
-std::array<float,2>{0.279667258f, 0.378075421f},
-std::array<float,2>{0.586081922f, 0.789530039f},
-std::array<float,2>{0.0298445225f, 0.55413723f},
-std::array<float,2>{0.958285451f, 0.157736391f},
-std::array<float,2>{0.103526488f, 0.349461019f},
-std::array<float,2>{0.921603858f, 0.881263256f},
-std::array<float,2>{0.343093842f, 0.664319873f},
-std::array<float,2>{0.530538619f, 0.0381095894f},
-std::array<float,2>{0.408940732f, 0.206227809f},
-std::array<float,2>{0.681711078f, 0.569820046f},
-std::array<float,2>{0.171651199f, 0.84394592f},
-std::array<float,2>{0.78988272f, 0.459991574f},
-std::array<float,2>{0.0550843365f, 0.139773324f},
-std::array<float,2>{0.9791556f, 0.519308507f},
-std::array<float,2>{0.284606427f, 0.75446403f},
-std::array<float,2>{0.601057112f, 0.435423404f},
-std::array<float,2>{0.493840009f, 0.277500093f},
-std::array<float,2>{0.700755715f, 0.977631688f},
-std::array<float,2>{0.193485171f, 0.749777496f},
-std::array<float,2>{0.831069112f, 0.103764929f},
-std::array<float,2>{0.126631066f, 0.498549044f},
-std::array<float,2>{0.776972771f, 0.843470275f},
-std::array<float,2>{0.390540957f, 0.610576093f},
-std::array<float,2>{0.627952158f, 0.235527024f},
-std::array<float,2>{0.350220799f, 0.0142553775f},
-std::array<float,2>{0.560592294f, 0.631667852f},
-std::array<float,2>{0.0889397487f, 0.923478425f},
-std::array<float,2>{0.888586938f, 0.336545765f},
-std::array<float,2>{0.062850818f, 0.0524040982f},
-std::array<float,2>{0.895397067f, 0.684428692f},
-std::array<float,2>{0.360315025f, 0.901130497f},
-std::array<float,2>{0.538286865f, 0.366726786f},
-std::array<float,2>{0.397443175f, 0.44380793f},
-std::array<float,2>{0.65286392f, 0.861401916f},
-std::array<float,2>{0.140942097f, 0.59039861f},
-std::array<float,2>{0.75605756f, 0.193804905f},
-std::array<float,2>{0.218455166f, 0.307027727f},
-std::array<float,2>{0.81636095f, 0.958401144f},
-std::array<float,2>{0.476124823f, 0.693559945f},
-std::array<float,2>{0.71380496f, 0.0670150146f},
-std::array<float,2>{0.308418423f, 0.173808947f},
-std::array<float,2>{0.622045696f, 0.534558237f},
-std::array<float,2>{0.0436926968f, 0.804609239f},
-std::array<float,2>{0.988682687f, 0.404698491f},
-std::array<float,2>{0.182746559f, 0.233075887f},
-std::array<float,2>{0.798662245f, 0.604272604f},
-std::array<float,2>{0.423000664f, 0.812570512f},
-std::array<float,2>{0.662203252f, 0.471031636f},
-std::array<float,2>{0.317420274f, 0.314992994f},
-std::array<float,2>{0.510544479f, 0.909700394f},
-std::array<float,2>{0.111440234f, 0.649975598f},
-std::array<float,2>{0.936674953f, 0.0160854235f},
-std::array<float,2>{0.00815252122f, 0.417690426f},
-std::array<float,2>{0.94267118f, 0.773844659f},
-std::array<float,2>{0.255034f, 0.508362651f},
-std::array<float,2>{0.567456007f, 0.154666886f},
-std::array<float,2>{0.46442315f, 0.120242134f},
-std::array<float,2>{0.7294029f, 0.727266073f},
-std::array<float,2>{0.229712501f, 0.991351843f},
-std::array<float,2>{0.863970935f, 0.255175143f},
-std::array<float,2>{0.184579104f, 0.0892378092f},
-std::array<float,2>{0.802220285f, 0.712964773f},
-std::array<float,2>{0.427470595f, 0.941370726f},
-std::array<float,2>{0.658669114f, 0.295854241f},
-std::array<float,2>{0.314649522f, 0.388467669f},
-std::array<float,2>{0.513709307f, 0.781858146f},
-std::array<float,2>{0.115813255f, 0.556577027f},
-std::array<float,2>{0.931658387f, 0.16785939f},
-std::array<float,2>{0.0117764529f, 0.354750156f},
-std::array<float,2>{0.937756717f, 0.887204766f},
-std::array<float,2>{0.250227392f, 0.65631777f},
-std::array<float,2>{0.563217938f, 0.0464693047f},
-std::array<float,2>{0.465556353f, 0.213072464f},
-std::array<float,2>{0.732886255f, 0.570390582f},
-std::array<float,2>{0.232462376f, 0.856656551f},
-std::array<float,2>{0.860619187f, 0.461337447f},
-std::array<float,2>{0.0696387738f, 0.125895843f},
-std::array<float,2>{0.892632961f, 0.528418839f},
-std::array<float,2>{0.365463018f, 0.762998223f},
-std::array<float,2>{0.533006549f, 0.422906429f},
-std::array<float,2>{0.39376542f, 0.27235806f},
-std::array<float,2>{0.649877727f, 0.975355804f},
-std::array<float,2>{0.147791967f, 0.740600705f},
-std::array<float,2>{0.750395596f, 0.0947447196f},
-std::array<float,2>{0.214263141f, 0.487897038f},
-std::array<float,2>{0.818708897f, 0.831274152f},
-std::array<float,2>{0.470984638f, 0.624253333f},
-std::array<float,2>{0.716832876f, 0.242379636f},
-std::array<float,2>{0.309735894f, 0.00199347804f},
-std::array<float,2>{0.61750108f, 0.638657093f},
-std::array<float,2>{0.041195754f, 0.933173001f},
-std::array<float,2>{0.985463679f, 0.331562757f},
-std::array<float,2>{0.0588655919f, 0.0547282286f},
-std::array<float,2>{0.982770503f, 0.679513752f},
-std::array<float,2>{0.285386354f, 0.895003796f},
-std::array<float,2>{0.595852792f, 0.368347704f},
-std::array<float,2>{0.499046028f, 0.44819203f},
-std::array<float,2>{0.695398927f, 0.868524432f},
-std::array<float,2>{0.189474374f, 0.578211606f},
-std::array<float,2>{0.835139275f, 0.202018127f},
-std::array<float,2>{0.131574154f, 0.30386132f},
-std::array<float,2>{0.778237939f, 0.961601436f},
-std::array<float,2>{0.385653436f, 0.699713647f},
-std::array<float,2>{0.629384875f, 0.0730387941f},
-std::array<float,2>{0.343968451f, 0.181913793f},
-std::array<float,2>{0.555412889f, 0.546859086f},
-std::array<float,2>{0.0913738012f, 0.805415273f},
-std::array<float,2>{0.884390175f, 0.394135028f},
-std::array<float,2>{0.248607367f, 0.22514081f},
-std::array<float,2>{0.85627079f, 0.598647773f},
-std::array<float,2>{0.45178926f, 0.822887421f},
-std::array<float,2>{0.743492484f, 0.479698628f},
-std::array<float,2>{0.274351627f, 0.323626608f},
-std::array<float,2>{0.593230426f, 0.915254414f},
-std::array<float,2>{0.0257326532f, 0.643071532f},
-std::array<float,2>{0.955334306f, 0.0274423473f},
-std::array<float,2>{0.105684258f, 0.406542182f},
-std::array<float,2>{0.915216267f, 0.770505726f},
-std::array<float,2>{0.337478459f, 0.507180989f},
-std::array<float,2>{0.523752093f, 0.141381606f},
-std::array<float,2>{0.411987841f, 0.112020187f},
-std::array<float,2>{0.684597671f, 0.725681186f},
-std::array<float,2>{0.167617247f, 0.997970164f},
-std::array<float,2>{0.793861866f, 0.265598506f},
-std::array<float,2>{0.196074456f, 0.0203620289f},
-std::array<float,2>{0.836458206f, 0.655753255f},
-std::array<float,2>{0.491088837f, 0.912961483f},
-std::array<float,2>{0.693493068f, 0.316423863f},
-std::array<float,2>{0.29472965f, 0.473907053f},
-std::array<float,2>{0.603767037f, 0.820186257f},
-std::array<float,2>{0.0538377464f, 0.608395636f},
-std::array<float,2>{0.974218011f, 0.229093671f},
-std::array<float,2>{0.0816314593f, 0.253846854f},
-std::array<float,2>{0.881757081f, 0.985334933f},
-std::array<float,2>{0.357892215f, 0.732437432f},
-std::array<float,2>{0.549190164f, 0.121412218f},
-std::array<float,2>{0.37850669f, 0.150298506f},
-std::array<float,2>{0.637567461f, 0.514138937f},
-std::array<float,2>{0.134687364f, 0.777350247f},
-std::array<float,2>{0.766449213f, 0.419628024f},
-std::array<float,2>{0.0227346513f, 0.188020393f},
-std::array<float,2>{0.967627704f, 0.586150289f},
-std::array<float,2>{0.269948155f, 0.863897026f},
-std::array<float,2>{0.585455f, 0.439868599f},
-std::array<float,2>{0.442679286f, 0.360325426f},
-std::array<float,2>{0.739539266f, 0.905896664f},
-std::array<float,2>{0.237295255f, 0.680258393f},
-std::array<float,2>{0.850221157f, 0.0487806387f},
-std::array<float,2>{0.161963806f, 0.401088476f},
-std::array<float,2>{0.788645089f, 0.797150671f},
-std::array<float,2>{0.420384258f, 0.538566411f},
-std::array<float,2>{0.674823105f, 0.178876445f},
-std::array<float,2>{0.335792094f, 0.0628088564f},
-std::array<float,2>{0.521386862f, 0.687889218f},
-std::array<float,2>{0.0955635086f, 0.953673661f},
-std::array<float,2>{0.910371661f, 0.311826438f},
-std::array<float,2>{0.12241859f, 0.107152194f},
-std::array<float,2>{0.925592363f, 0.745127976f},
-std::array<float,2>{0.320784807f, 0.98102212f},
-std::array<float,2>{0.507215023f, 0.276568055f},
-std::array<float,2>{0.430099368f, 0.432203412f},
-std::array<float,2>{0.670382619f, 0.751178682f},
-std::array<float,2>{0.175141633f, 0.520200253f},
-std::array<float,2>{0.810350657f, 0.135286227f},
-std::array<float,2>{0.221907079f, 0.340959549f},
-std::array<float,2>{0.870203078f, 0.926610708f},
-std::array<float,2>{0.455821961f, 0.626820445f},
-std::array<float,2>{0.72134918f, 0.00845491979f},
-std::array<float,2>{0.260457337f, 0.238294438f},
-std::array<float,2>{0.573052227f, 0.613939524f},
-std::array<float,2>{0.000948975445f, 0.83931762f},
-std::array<float,2>{0.947092533f, 0.493121445f},
-std::array<float,2>{0.151098609f, 0.161285132f},
-std::array<float,2>{0.759259701f, 0.549083531f},
-std::array<float,2>{0.40273878f, 0.794454575f},
-std::array<float,2>{0.647601604f, 0.380707353f},
-std::array<float,2>{0.37439993f, 0.286694318f},
-std::array<float,2>{0.545120656f, 0.948052704f},
-std::array<float,2>{0.0741091818f, 0.708224356f},
-std::array<float,2>{0.900217116f, 0.080526419f},
-std::array<float,2>{0.0344389305f, 0.455881476f},
-std::array<float,2>{0.994725168f, 0.851252735f},
-std::array<float,2>{0.297574908f, 0.56433028f},
-std::array<float,2>{0.615537345f, 0.207186997f},
-std::array<float,2>{0.484210521f, 0.0348327123f},
-std::array<float,2>{0.706036985f, 0.668396235f},
-std::array<float,2>{0.204752788f, 0.877300978f},
-std::array<float,2>{0.821340144f, 0.34388721f},
-std::array<float,2>{0.138330281f, 0.0424766876f},
-std::array<float,2>{0.770356894f, 0.663484395f},
-std::array<float,2>{0.379015595f, 0.885920584f},
-std::array<float,2>{0.63404268f, 0.3563613f},
-std::array<float,2>{0.354056865f, 0.46767354f},
-std::array<float,2>{0.554550171f, 0.853978634f},
-std::array<float,2>{0.0842031911f, 0.5762586f},
-std::array<float,2>{0.876920104f, 0.215219766f},
-std::array<float,2>{0.0504249185f, 0.292187303f},
-std::array<float,2>{0.971816659f, 0.942666769f},
-std::array<float,2>{0.292461634f, 0.715671957f},
-std::array<float,2>{0.609340429f, 0.0934975892f},
-std::array<float,2>{0.485343516f, 0.171350986f},
-std::array<float,2>{0.69064045f, 0.561472356f},
-std::array<float,2>{0.200795695f, 0.785902679f},
-std::array<float,2>{0.839946806f, 0.38563028f},
-std::array<float,2>{0.100067042f, 0.246431813f},
-std::array<float,2>{0.90882951f, 0.617562115f},
-std::array<float,2>{0.330910891f, 0.83208698f},
-std::array<float,2>{0.515743136f, 0.489910156f},
-std::array<float,2>{0.417361706f, 0.33280924f},
-std::array<float,2>{0.677441478f, 0.936409414f},
-std::array<float,2>{0.15734221f, 0.634917557f},
-std::array<float,2>{0.782678127f, 0.00398135511f},
-std::array<float,2>{0.241997272f, 0.428123623f},
-std::array<float,2>{0.846589327f, 0.761072099f},
-std::array<float,2>{0.437712908f, 0.526053429f},
-std::array<float,2>{0.734561622f, 0.13060154f},
-std::array<float,2>{0.268817931f, 0.100298494f},
-std::array<float,2>{0.581479728f, 0.735257328f},
-std::array<float,2>{0.0190340504f, 0.971860647f},
-std::array<float,2>{0.96385479f, 0.266988099f},
-std::array<float,2>{0.0065494515f, 0.0744373798f},
-std::array<float,2>{0.95006901f, 0.69822526f},
-std::array<float,2>{0.265551507f, 0.965598047f},
-std::array<float,2>{0.574277222f, 0.29750362f},
-std::array<float,2>{0.457873255f, 0.397227407f},
-std::array<float,2>{0.725296497f, 0.810326576f},
-std::array<float,2>{0.225249633f, 0.542424679f},
-std::array<float,2>{0.874187291f, 0.186207369f},
-std::array<float,2>{0.178124562f, 0.372306943f},
-std::array<float,2>{0.805982172f, 0.891897559f},
-std::array<float,2>{0.434866607f, 0.67428726f},
-std::array<float,2>{0.667638898f, 0.060013026f},
-std::array<float,2>{0.328010499f, 0.198033869f},
-std::array<float,2>{0.501652598f, 0.582141757f},
-std::array<float,2>{0.120330483f, 0.872426212f},
-std::array<float,2>{0.929359376f, 0.452654272f},
-std::array<float,2>{0.209048957f, 0.145994276f},
-std::array<float,2>{0.825243056f, 0.501149774f},
-std::array<float,2>{0.479792595f, 0.766745389f},
-std::array<float,2>{0.707049906f, 0.412436992f},
-std::array<float,2>{0.30122748f, 0.258873343f},
-std::array<float,2>{0.611712575f, 0.99277395f},
-std::array<float,2>{0.0362999626f, 0.72115159f},
-std::array<float,2>{0.99712503f, 0.116183393f},
-std::array<float,2>{0.0760202631f, 0.480701447f},
-std::array<float,2>{0.904834688f, 0.827015936f},
-std::array<float,2>{0.370158732f, 0.593979657f},
-std::array<float,2>{0.541694939f, 0.218935326f},
-std::array<float,2>{0.401152283f, 0.0273178387f},
-std::array<float,2>{0.641619265f, 0.644974351f},
-std::array<float,2>{0.152699649f, 0.9183411f},
-std::array<float,2>{0.763761342f, 0.32541877f},
-std::array<float,2>{0.229201853f, 0.117689118f},
-std::array<float,2>{0.864349544f, 0.728685379f},
-std::array<float,2>{0.463633448f, 0.988822937f},
-std::array<float,2>{0.72966671f, 0.256997377f},
-std::array<float,2>{0.254466891f, 0.415717036f},
-std::array<float,2>{0.567091525f, 0.776420593f},
-std::array<float,2>{0.00929262023f, 0.511003315f},
-std::array<float,2>{0.941729367f, 0.15257515f},
-std::array<float,2>{0.112574756f, 0.312573135f},
-std::array<float,2>{0.936129928f, 0.907558084f},
-std::array<float,2>{0.317172855f, 0.650801122f},
-std::array<float,2>{0.51135999f, 0.0191328302f},
-std::array<float,2>{0.42227599f, 0.231544957f},
-std::array<float,2>{0.663244247f, 0.602874994f},
-std::array<float,2>{0.182302192f, 0.815857053f},
-std::array<float,2>{0.797473252f, 0.46918717f},
-std::array<float,2>{0.044192683f, 0.175193503f},
-std::array<float,2>{0.990041792f, 0.532295942f},
-std::array<float,2>{0.307585567f, 0.802679181f},
-std::array<float,2>{0.622363269f, 0.402977318f},
-std::array<float,2>{0.474992007f, 0.306051999f},
-std::array<float,2>{0.714302957f, 0.960628748f},
-std::array<float,2>{0.217274964f, 0.693176925f},
-std::array<float,2>{0.81449616f, 0.0693815053f},
-std::array<float,2>{0.141849428f, 0.44307214f},
-std::array<float,2>{0.756880224f, 0.859539986f},
-std::array<float,2>{0.398168623f, 0.592027307f},
-std::array<float,2>{0.653433979f, 0.192943528f},
-std::array<float,2>{0.360850364f, 0.053184703f},
-std::array<float,2>{0.53804481f, 0.687031507f},
-std::array<float,2>{0.0642379448f, 0.900190771f},
-std::array<float,2>{0.895626485f, 0.364136338f},
-std::array<float,2>{0.0879872739f, 0.0131011279f},
-std::array<float,2>{0.887666523f, 0.630844712f},
-std::array<float,2>{0.351216227f, 0.924068391f},
-std::array<float,2>{0.562014103f, 0.337908655f},
-std::array<float,2>{0.389609218f, 0.496667773f},
-std::array<float,2>{0.627349734f, 0.841715515f},
-std::array<float,2>{0.125665799f, 0.612218857f},
-std::array<float,2>{0.776262641f, 0.237981185f},
-std::array<float,2>{0.195149779f, 0.279857248f},
-std::array<float,2>{0.830298424f, 0.979807973f},
-std::array<float,2>{0.492857933f, 0.74689877f},
-std::array<float,2>{0.699385703f, 0.102176927f},
-std::array<float,2>{0.28395009f, 0.137117103f},
-std::array<float,2>{0.5999735f, 0.515790701f},
-std::array<float,2>{0.0563243106f, 0.757142246f},
-std::array<float,2>{0.980296135f, 0.437296689f},
-std::array<float,2>{0.170264602f, 0.203578368f},
-std::array<float,2>{0.790263474f, 0.567199528f},
-std::array<float,2>{0.409540325f, 0.845760942f},
-std::array<float,2>{0.682992697f, 0.457949281f},
-std::array<float,2>{0.342502028f, 0.34981069f},
-std::array<float,2>{0.529658735f, 0.879039705f},
-std::array<float,2>{0.104959987f, 0.667027116f},
-std::array<float,2>{0.920063913f, 0.0353356041f},
-std::array<float,2>{0.0303606633f, 0.375021428f},
-std::array<float,2>{0.95756954f, 0.791256011f},
-std::array<float,2>{0.280402094f, 0.552166283f},
-std::array<float,2>{0.5871014f, 0.159618184f},
-std::array<float,2>{0.445399612f, 0.0846232176f},
-std::array<float,2>{0.749803722f, 0.703511417f},
-std::array<float,2>{0.244984537f, 0.949597001f},
-std::array<float,2>{0.851937473f, 0.283747375f},
-std::array<float,2>{0.145492494f, 0.0958548039f},
-std::array<float,2>{0.753467917f, 0.739304304f},
-std::array<float,2>{0.391615003f, 0.973885834f},
-std::array<float,2>{0.651880085f, 0.269571841f},
-std::array<float,2>{0.364098817f, 0.42568478f},
-std::array<float,2>{0.534228265f, 0.764389813f},
-std::array<float,2>{0.0664850026f, 0.530334353f},
-std::array<float,2>{0.892096639f, 0.127504006f},
-std::array<float,2>{0.0401653387f, 0.3291412f},
-std::array<float,2>{0.987846375f, 0.931229353f},
-std::array<float,2>{0.311440408f, 0.638694048f},
-std::array<float,2>{0.620485306f, 0.000562726345f},
-std::array<float,2>{0.470246136f, 0.245125532f},
-std::array<float,2>{0.716264784f, 0.622957706f},
-std::array<float,2>{0.21160455f, 0.829260647f},
-std::array<float,2>{0.818040133f, 0.484534353f},
-std::array<float,2>{0.113958396f, 0.16584824f},
-std::array<float,2>{0.930751145f, 0.557919919f},
-std::array<float,2>{0.31334129f, 0.784148812f},
-std::array<float,2>{0.513351679f, 0.389066458f},
-std::array<float,2>{0.427990913f, 0.294233561f},
-std::array<float,2>{0.657679796f, 0.938461006f},
-std::array<float,2>{0.186718658f, 0.711219251f},
-std::array<float,2>{0.802825391f, 0.0861314982f},
-std::array<float,2>{0.23223421f, 0.463573933f},
-std::array<float,2>{0.862696648f, 0.857716262f},
-std::array<float,2>{0.467931211f, 0.573461413f},
-std::array<float,2>{0.731246412f, 0.212826431f},
-std::array<float,2>{0.252850294f, 0.0433058441f},
-std::array<float,2>{0.564723372f, 0.659154773f},
-std::array<float,2>{0.015461741f, 0.889642656f},
-std::array<float,2>{0.940142512f, 0.353306413f},
-std::array<float,2>{0.0238848124f, 0.0302199777f},
-std::array<float,2>{0.954341114f, 0.642555535f},
-std::array<float,2>{0.275714964f, 0.917800844f},
-std::array<float,2>{0.591504276f, 0.321674317f},
-std::array<float,2>{0.449960351f, 0.477541685f},
-std::array<float,2>{0.745675564f, 0.820523441f},
-std::array<float,2>{0.246696502f, 0.60021615f},
-std::array<float,2>{0.857433319f, 0.224261627f},
-std::array<float,2>{0.16442655f, 0.263284326f},
-std::array<float,2>{0.796156287f, 0.999332428f},
-std::array<float,2>{0.41238296f, 0.722941577f},
-std::array<float,2>{0.687019587f, 0.110714614f},
-std::array<float,2>{0.339066088f, 0.144373f},
-std::array<float,2>{0.526818275f, 0.504376054f},
-std::array<float,2>{0.108949892f, 0.772212267f},
-std::array<float,2>{0.916224778f, 0.408979326f},
-std::array<float,2>{0.18844831f, 0.199655354f},
-std::array<float,2>{0.833713591f, 0.581183374f},
-std::array<float,2>{0.49611178f, 0.870912433f},
-std::array<float,2>{0.697327495f, 0.445679337f},
-std::array<float,2>{0.287764966f, 0.369736969f},
-std::array<float,2>{0.59468472f, 0.898390234f},
-std::array<float,2>{0.061672993f, 0.676180661f},
-std::array<float,2>{0.98196435f, 0.0567632578f},
-std::array<float,2>{0.09320499f, 0.39234674f},
-std::array<float,2>{0.88588357f, 0.807006299f},
-std::array<float,2>{0.3463673f, 0.543173254f},
-std::array<float,2>{0.558072567f, 0.18058303f},
-std::array<float,2>{0.384260178f, 0.0720317513f},
-std::array<float,2>{0.631601274f, 0.701231837f},
-std::array<float,2>{0.129218727f, 0.963076651f},
-std::array<float,2>{0.780910909f, 0.302139938f},
-std::array<float,2>{0.234693408f, 0.0505987406f},
-std::array<float,2>{0.848044336f, 0.682616889f},
-std::array<float,2>{0.44487685f, 0.903760791f},
-std::array<float,2>{0.742024839f, 0.362628549f},
-std::array<float,2>{0.272810638f, 0.437813967f},
-std::array<float,2>{0.583805799f, 0.866100073f},
-std::array<float,2>{0.0207701027f, 0.589007199f},
-std::array<float,2>{0.966041863f, 0.190744817f},
-std::array<float,2>{0.0969138741f, 0.310057998f},
-std::array<float,2>{0.914060831f, 0.956347525f},
-std::array<float,2>{0.333582371f, 0.689801455f},
-std::array<float,2>{0.521722376f, 0.0652739182f},
-std::array<float,2>{0.418192506f, 0.1762297f},
-std::array<float,2>{0.673368633f, 0.536182523f},
-std::array<float,2>{0.162668243f, 0.800434589f},
-std::array<float,2>{0.785574317f, 0.399385273f},
-std::array<float,2>{0.0512441136f, 0.227414191f},
-std::array<float,2>{0.974954724f, 0.605836093f},
-std::array<float,2>{0.295601934f, 0.816507995f},
-std::array<float,2>{0.602742672f, 0.476201117f},
-std::array<float,2>{0.488957375f, 0.319942296f},
-std::array<float,2>{0.692819059f, 0.910568655f},
-std::array<float,2>{0.198286325f, 0.652703643f},
-std::array<float,2>{0.838520169f, 0.0230986979f},
-std::array<float,2>{0.135392934f, 0.420079947f},
-std::array<float,2>{0.769507647f, 0.780553102f},
-std::array<float,2>{0.375047892f, 0.51313138f},
-std::array<float,2>{0.640213311f, 0.151171073f},
-std::array<float,2>{0.355950326f, 0.124042496f},
-std::array<float,2>{0.547464311f, 0.731474161f},
-std::array<float,2>{0.0790523812f, 0.987297058f},
-std::array<float,2>{0.879028261f, 0.251815021f},
-std::array<float,2>{0.071936585f, 0.078490071f},
-std::array<float,2>{0.901034772f, 0.709937871f},
-std::array<float,2>{0.372221977f, 0.945830345f},
-std::array<float,2>{0.544860899f, 0.288977176f},
-std::array<float,2>{0.405530155f, 0.38164264f},
-std::array<float,2>{0.645396292f, 0.795086861f},
-std::array<float,2>{0.149977058f, 0.547901809f},
-std::array<float,2>{0.760215342f, 0.164051577f},
-std::array<float,2>{0.205664143f, 0.346154809f},
-std::array<float,2>{0.822533011f, 0.875471115f},
-std::array<float,2>{0.482268214f, 0.670374572f},
-std::array<float,2>{0.703757584f, 0.0331730619f},
-std::array<float,2>{0.300014049f, 0.209614992f},
-std::array<float,2>{0.613560677f, 0.565199256f},
-std::array<float,2>{0.0318456031f, 0.848010778f},
-std::array<float,2>{0.992407203f, 0.453391165f},
-std::array<float,2>{0.17282635f, 0.133805409f},
-std::array<float,2>{0.812137485f, 0.522466719f},
-std::array<float,2>{0.432167262f, 0.753727853f},
-std::array<float,2>{0.669060111f, 0.431558281f},
-std::array<float,2>{0.322359949f, 0.274676919f},
-std::array<float,2>{0.505041361f, 0.98340404f},
-std::array<float,2>{0.124617606f, 0.742464304f},
-std::array<float,2>{0.922267139f, 0.107734568f},
-std::array<float,2>{0.00345393224f, 0.494414836f},
-std::array<float,2>{0.94738102f, 0.83706826f},
-std::array<float,2>{0.259061038f, 0.617057323f},
-std::array<float,2>{0.570412457f, 0.241207451f},
-std::array<float,2>{0.453585237f, 0.0102991825f},
-std::array<float,2>{0.720574319f, 0.627882063f},
-std::array<float,2>{0.219452679f, 0.929555297f},
-std::array<float,2>{0.868406594f, 0.342243254f},
-std::array<float,2>{0.159129277f, 0.00617034733f},
-std::array<float,2>{0.784857333f, 0.63474071f},
-std::array<float,2>{0.41546315f, 0.935230851f},
-std::array<float,2>{0.679345131f, 0.334675133f},
-std::array<float,2>{0.328233957f, 0.490683109f},
-std::array<float,2>{0.518913507f, 0.83534193f},
-std::array<float,2>{0.0978751704f, 0.620773911f},
-std::array<float,2>{0.9071908f, 0.248518839f},
-std::array<float,2>{0.015921263f, 0.26778397f},
-std::array<float,2>{0.961004257f, 0.969843984f},
-std::array<float,2>{0.265865684f, 0.736368537f},
-std::array<float,2>{0.579224825f, 0.0987994149f},
-std::array<float,2>{0.440036803f, 0.132442221f},
-std::array<float,2>{0.737885356f, 0.524432719f},
-std::array<float,2>{0.238961115f, 0.758380473f},
-std::array<float,2>{0.844765246f, 0.427185893f},
-std::array<float,2>{0.0828393027f, 0.218119338f},
-std::array<float,2>{0.877950132f, 0.575460315f},
-std::array<float,2>{0.352440685f, 0.852281511f},
-std::array<float,2>{0.552337646f, 0.46554327f},
-std::array<float,2>{0.382522494f, 0.359091699f},
-std::array<float,2>{0.635320067f, 0.883058071f},
-std::array<float,2>{0.140116349f, 0.662041485f},
-std::array<float,2>{0.772907078f, 0.0398679376f},
-std::array<float,2>{0.203043878f, 0.382944196f},
-std::array<float,2>{0.84305799f, 0.787638187f},
-std::array<float,2>{0.487672865f, 0.559026122f},
-std::array<float,2>{0.689211249f, 0.168298438f},
-std::array<float,2>{0.289562464f, 0.0917006955f},
-std::array<float,2>{0.606448531f, 0.717041731f},
-std::array<float,2>{0.0477533527f, 0.944038272f},
-std::array<float,2>{0.97057879f, 0.289866418f},
-std::array<float,2>{0.0381534956f, 0.114334114f},
-std::array<float,2>{0.998909235f, 0.720154941f},
-std::array<float,2>{0.30379647f, 0.995967209f},
-std::array<float,2>{0.610167384f, 0.261322588f},
-std::array<float,2>{0.478462458f, 0.410273165f},
-std::array<float,2>{0.710731804f, 0.767945647f},
-std::array<float,2>{0.207185f, 0.502126753f},
-std::array<float,2>{0.826932609f, 0.147411495f},
-std::array<float,2>{0.154488891f, 0.326298207f},
-std::array<float,2>{0.762153745f, 0.920432091f},
-std::array<float,2>{0.39897126f, 0.647559345f},
-std::array<float,2>{0.644386709f, 0.024717303f},
-std::array<float,2>{0.36726442f, 0.222285941f},
-std::array<float,2>{0.53946346f, 0.596353054f},
-std::array<float,2>{0.0780723244f, 0.825480163f},
-std::array<float,2>{0.903698206f, 0.482634217f},
-std::array<float,2>{0.222806796f, 0.18494086f},
-std::array<float,2>{0.872858942f, 0.539277375f},
-std::array<float,2>{0.460205287f, 0.812356174f},
-std::array<float,2>{0.723519087f, 0.39568907f},
-std::array<float,2>{0.262795955f, 0.298965484f},
-std::array<float,2>{0.577209413f, 0.968576252f},
-std::array<float,2>{0.00556483818f, 0.696564794f},
-std::array<float,2>{0.951584101f, 0.0762873217f},
-std::array<float,2>{0.118347809f, 0.449238777f},
-std::array<float,2>{0.925891161f, 0.874343693f},
-std::array<float,2>{0.324916661f, 0.585243523f},
-std::array<float,2>{0.502296448f, 0.196301579f},
-std::array<float,2>{0.436583787f, 0.0607791841f},
-std::array<float,2>{0.665124297f, 0.672358871f},
-std::array<float,2>{0.176883161f, 0.893470883f},
-std::array<float,2>{0.807739973f, 0.373492777f},
-std::array<float,2>{0.215048552f, 0.0683246851f},
-std::array<float,2>{0.813308835f, 0.694840372f},
-std::array<float,2>{0.473619759f, 0.957871318f},
-std::array<float,2>{0.711060882f, 0.308243304f},
-std::array<float,2>{0.305519491f, 0.406128168f},
-std::array<float,2>{0.624789298f, 0.803496659f},
-std::array<float,2>{0.0456474014f, 0.534169078f},
-std::array<float,2>{0.990761876f, 0.172389209f},
-std::array<float,2>{0.0652025342f, 0.366069704f},
-std::array<float,2>{0.897929132f, 0.901813805f},
-std::array<float,2>{0.362475932f, 0.684841812f},
-std::array<float,2>{0.535388947f, 0.0514308773f},
-std::array<float,2>{0.395577222f, 0.194488585f},
-std::array<float,2>{0.655098736f, 0.59086293f},
-std::array<float,2>{0.142715991f, 0.86266309f},
-std::array<float,2>{0.754694462f, 0.444454998f},
-std::array<float,2>{0.010059813f, 0.155786812f},
-std::array<float,2>{0.944057703f, 0.508810401f},
-std::array<float,2>{0.257777572f, 0.774812043f},
-std::array<float,2>{0.570298851f, 0.416276276f},
-std::array<float,2>{0.46097815f, 0.254360199f},
-std::array<float,2>{0.727247775f, 0.990447879f},
-std::array<float,2>{0.227096498f, 0.727873504f},
-std::array<float,2>{0.865950346f, 0.119294852f},
-std::array<float,2>{0.180062458f, 0.471953809f},
-std::array<float,2>{0.800104976f, 0.813504696f},
-std::array<float,2>{0.42467019f, 0.604731023f},
-std::array<float,2>{0.661974192f, 0.234107137f},
-std::array<float,2>{0.318744719f, 0.0171455611f},
-std::array<float,2>{0.509671748f, 0.648624063f},
-std::array<float,2>{0.111153141f, 0.908414543f},
-std::array<float,2>{0.933604181f, 0.316164613f},
-std::array<float,2>{0.101811916f, 0.0375325866f},
-std::array<float,2>{0.919896841f, 0.665068209f},
-std::array<float,2>{0.341130137f, 0.882295728f},
-std::array<float,2>{0.528754592f, 0.347867042f},
-std::array<float,2>{0.407678723f, 0.459578782f},
-std::array<float,2>{0.680598855f, 0.845226645f},
-std::array<float,2>{0.169591591f, 0.568895578f},
-std::array<float,2>{0.792813659f, 0.205372259f},
-std::array<float,2>{0.242241129f, 0.281964719f},
-std::array<float,2>{0.855096996f, 0.953016877f},
-std::array<float,2>{0.448401421f, 0.705703735f},
-std::array<float,2>{0.74784565f, 0.0826227367f},
-std::array<float,2>{0.277989328f, 0.156804904f},
-std::array<float,2>{0.589309037f, 0.55279851f},
-std::array<float,2>{0.027393356f, 0.790271521f},
-std::array<float,2>{0.959775329f, 0.37728548f},
-std::array<float,2>{0.128411323f, 0.234672368f},
-std::array<float,2>{0.773842096f, 0.610240996f},
-std::array<float,2>{0.38838917f, 0.842223048f},
-std::array<float,2>{0.626689911f, 0.499374866f},
-std::array<float,2>{0.349579304f, 0.336927086f},
-std::array<float,2>{0.559593856f, 0.922118008f},
-std::array<float,2>{0.0860801712f, 0.632321f},
-std::array<float,2>{0.890071273f, 0.0149552813f},
-std::array<float,2>{0.0567651987f, 0.434424728f},
-std::array<float,2>{0.976720273f, 0.755642354f},
-std::array<float,2>{0.28272149f, 0.518100739f},
-std::array<float,2>{0.598901749f, 0.138930589f},
-std::array<float,2>{0.495866746f, 0.105295509f},
-std::array<float,2>{0.702443182f, 0.748434544f},
-std::array<float,2>{0.19255653f, 0.977347493f},
-std::array<float,2>{0.829046607f, 0.278794885f},
-std::array<float,2>{0.14981547f, 0.080657877f},
-std::array<float,2>{0.76058799f, 0.70881176f},
-std::array<float,2>{0.406233132f, 0.947544634f},
-std::array<float,2>{0.644878685f, 0.286239684f},
-std::array<float,2>{0.372779042f, 0.380310267f},
-std::array<float,2>{0.544183195f, 0.794147611f},
-std::array<float,2>{0.071579203f, 0.549782395f},
-std::array<float,2>{0.900545776f, 0.161864847f},
-std::array<float,2>{0.0315552019f, 0.34467274f},
-std::array<float,2>{0.993155897f, 0.877873898f},
-std::array<float,2>{0.300510436f, 0.668555975f},
-std::array<float,2>{0.613791585f, 0.0343408175f},
-std::array<float,2>{0.481499106f, 0.207868591f},
-std::array<float,2>{0.703251362f, 0.563811839f},
-std::array<float,2>{0.205230519f, 0.850909352f},
-std::array<float,2>{0.822761953f, 0.455455363f},
-std::array<float,2>{0.124355666f, 0.135022983f},
-std::array<float,2>{0.922602952f, 0.519872725f},
-std::array<float,2>{0.322988212f, 0.751944959f},
-std::array<float,2>{0.505467474f, 0.431994438f},
-std::array<float,2>{0.432029396f, 0.276889861f},
-std::array<float,2>{0.669893861f, 0.98050946f},
-std::array<float,2>{0.171936497f, 0.746043921f},
-std::array<float,2>{0.811565518f, 0.106878884f},
-std::array<float,2>{0.219112024f, 0.492486686f},
-std::array<float,2>{0.869094789f, 0.839690208f},
-std::array<float,2>{0.45371896f, 0.613660991f},
-std::array<float,2>{0.720079005f, 0.238994166f},
-std::array<float,2>{0.259440422f, 0.00797533058f},
-std::array<float,2>{0.570934951f, 0.626233101f},
-std::array<float,2>{0.00315320212f, 0.92585361f},
-std::array<float,2>{0.947891593f, 0.341750771f},
-std::array<float,2>{0.0211564898f, 0.0482750237f},
-std::array<float,2>{0.966782808f, 0.680004478f},
-std::array<float,2>{0.273034155f, 0.905611217f},
-std::array<float,2>{0.583437145f, 0.359774351f},
-std::array<float,2>{0.444461524f, 0.440387994f},
-std::array<float,2>{0.741293907f, 0.863638043f},
-std::array<float,2>{0.235121071f, 0.586877465f},
-std::array<float,2>{0.84821403f, 0.187853009f},
-std::array<float,2>{0.162536502f, 0.312162161f},
-std::array<float,2>{0.785973251f, 0.953534603f},
-std::array<float,2>{0.418637663f, 0.688153148f},
-std::array<float,2>{0.672990501f, 0.0633790344f},
-std::array<float,2>{0.333034754f, 0.179204449f},
-std::array<float,2>{0.522006452f, 0.538656056f},
-std::array<float,2>{0.0974352583f, 0.797713399f},
-std::array<float,2>{0.913095713f, 0.400730401f},
-std::array<float,2>{0.198916957f, 0.228557602f},
-std::array<float,2>{0.8382231f, 0.607424438f},
-std::array<float,2>{0.488682657f, 0.819573343f},
-std::array<float,2>{0.692988515f, 0.474202543f},
-std::array<float,2>{0.294986695f, 0.31720376f},
-std::array<float,2>{0.603138268f, 0.912539005f},
-std::array<float,2>{0.0516793802f, 0.655855298f},
-std::array<float,2>{0.975500762f, 0.0196217764f},
-std::array<float,2>{0.0782903284f, 0.4190844f},
-std::array<float,2>{0.879841626f, 0.778100133f},
-std::array<float,2>{0.356277138f, 0.514393449f},
-std::array<float,2>{0.54689616f, 0.149526164f},
-std::array<float,2>{0.375493407f, 0.121651031f},
-std::array<float,2>{0.639715195f, 0.733106673f},
-std::array<float,2>{0.134794891f, 0.984479964f},
-std::array<float,2>{0.768797815f, 0.252933204f},
-std::array<float,2>{0.246417552f, 0.0278712846f},
-std::array<float,2>{0.858016312f, 0.642862201f},
-std::array<float,2>{0.449261874f, 0.915997088f},
-std::array<float,2>{0.745430589f, 0.323846251f},
-std::array<float,2>{0.276265383f, 0.480389029f},
-std::array<float,2>{0.590897441f, 0.822357833f},
-std::array<float,2>{0.0242245998f, 0.599512577f},
-std::array<float,2>{0.954834223f, 0.225053117f},
-std::array<float,2>{0.108634405f, 0.264977574f},
-std::array<float,2>{0.916842997f, 0.997508585f},
-std::array<float,2>{0.339495629f, 0.726107776f},
-std::array<float,2>{0.527064562f, 0.111452587f},
-std::array<float,2>{0.412736595f, 0.141050771f},
-std::array<float,2>{0.686954439f, 0.507438481f},
-std::array<float,2>{0.164922744f, 0.769842148f},
-std::array<float,2>{0.7966851f, 0.406790048f},
-std::array<float,2>{0.0620640293f, 0.201310754f},
-std::array<float,2>{0.98153156f, 0.578763902f},
-std::array<float,2>{0.28751123f, 0.86907661f},
-std::array<float,2>{0.593802214f, 0.447461993f},
-std::array<float,2>{0.496585041f, 0.369092107f},
-std::array<float,2>{0.698011875f, 0.895250201f},
-std::array<float,2>{0.187921286f, 0.6790995f},
-std::array<float,2>{0.833252609f, 0.0554112308f},
-std::array<float,2>{0.129641488f, 0.393995851f},
-std::array<float,2>{0.780636311f, 0.804728329f},
-std::array<float,2>{0.384529769f, 0.5461573f},
-std::array<float,2>{0.630943656f, 0.182412416f},
-std::array<float,2>{0.345994651f, 0.0726713613f},
-std::array<float,2>{0.558295429f, 0.699419916f},
-std::array<float,2>{0.0936601385f, 0.961179852f},
-std::array<float,2>{0.886572421f, 0.304275304f},
-std::array<float,2>{0.0673246384f, 0.0952633619f},
-std::array<float,2>{0.891848266f, 0.741053879f},
-std::array<float,2>{0.363385171f, 0.974630892f},
-std::array<float,2>{0.535134375f, 0.271758705f},
-std::array<float,2>{0.392421871f, 0.423723221f},
-std::array<float,2>{0.651812017f, 0.76364851f},
-std::array<float,2>{0.14464052f, 0.529198825f},
-std::array<float,2>{0.753076792f, 0.125328287f},
-std::array<float,2>{0.210949406f, 0.331240654f},
-std::array<float,2>{0.81774652f, 0.9328264f},
-std::array<float,2>{0.469935507f, 0.637845933f},
-std::array<float,2>{0.716371477f, 0.00266198767f},
-std::array<float,2>{0.310851216f, 0.242916793f},
-std::array<float,2>{0.621063352f, 0.624655604f},
-std::array<float,2>{0.040802341f, 0.831781089f},
-std::array<float,2>{0.987584949f, 0.487567604f},
-std::array<float,2>{0.187253684f, 0.167236969f},
-std::array<float,2>{0.803538382f, 0.556137323f},
-std::array<float,2>{0.428341091f, 0.781645179f},
-std::array<float,2>{0.658121884f, 0.388014197f},
-std::array<float,2>{0.31251812f, 0.295348436f},
-std::array<float,2>{0.512911081f, 0.940809667f},
-std::array<float,2>{0.113555126f, 0.713397861f},
-std::array<float,2>{0.931406081f, 0.0894413367f},
-std::array<float,2>{0.0150446668f, 0.461733609f},
-std::array<float,2>{0.939534128f, 0.857270479f},
-std::array<float,2>{0.252077699f, 0.571115196f},
-std::array<float,2>{0.565181851f, 0.213423863f},
-std::array<float,2>{0.468559802f, 0.0461316071f},
-std::array<float,2>{0.730604887f, 0.657078803f},
-std::array<float,2>{0.231706515f, 0.887523413f},
-std::array<float,2>{0.863191724f, 0.355223358f},
-std::array<float,2>{0.169365883f, 0.0357374921f},
-std::array<float,2>{0.792082787f, 0.667925239f},
-std::array<float,2>{0.407824665f, 0.87977016f},
-std::array<float,2>{0.680012405f, 0.350341707f},
-std::array<float,2>{0.341779262f, 0.457477599f},
-std::array<float,2>{0.529056489f, 0.84641552f},
-std::array<float,2>{0.102417275f, 0.566729605f},
-std::array<float,2>{0.919095516f, 0.20402208f},
-std::array<float,2>{0.0281335469f, 0.283595085f},
-std::array<float,2>{0.959029019f, 0.949800134f},
-std::array<float,2>{0.277520359f, 0.70387274f},
-std::array<float,2>{0.589587927f, 0.0843360052f},
-std::array<float,2>{0.449073166f, 0.160085917f},
-std::array<float,2>{0.747251749f, 0.552365899f},
-std::array<float,2>{0.24272573f, 0.791731834f},
-std::array<float,2>{0.854497731f, 0.375595301f},
-std::array<float,2>{0.0866243243f, 0.237315297f},
-std::array<float,2>{0.8901999f, 0.611358345f},
-std::array<float,2>{0.348902732f, 0.840979695f},
-std::array<float,2>{0.560058653f, 0.496293426f},
-std::array<float,2>{0.387810409f, 0.338549703f},
-std::array<float,2>{0.626311541f, 0.924664259f},
-std::array<float,2>{0.128489092f, 0.629957974f},
-std::array<float,2>{0.774303257f, 0.0135133918f},
-std::array<float,2>{0.192944676f, 0.4368155f},
-std::array<float,2>{0.828491807f, 0.75747329f},
-std::array<float,2>{0.49534148f, 0.51655829f},
-std::array<float,2>{0.70266211f, 0.137680471f},
-std::array<float,2>{0.282521784f, 0.101793714f},
-std::array<float,2>{0.599563003f, 0.746249318f},
-std::array<float,2>{0.0572299622f, 0.980239153f},
-std::array<float,2>{0.977482677f, 0.279587656f},
-std::array<float,2>{0.0449855067f, 0.0698883608f},
-std::array<float,2>{0.990471959f, 0.692829311f},
-std::array<float,2>{0.304997385f, 0.960371971f},
-std::array<float,2>{0.624267638f, 0.306561649f},
-std::array<float,2>{0.472892523f, 0.402622819f},
-std::array<float,2>{0.711632431f, 0.802232146f},
-std::array<float,2>{0.215551555f, 0.533132195f},
-std::array<float,2>{0.812560558f, 0.175580725f},
-std::array<float,2>{0.143250525f, 0.363457918f},
-std::array<float,2>{0.754120171f, 0.899801493f},
-std::array<float,2>{0.396329105f, 0.686913311f},
-std::array<float,2>{0.65466702f, 0.0534356125f},
-std::array<float,2>{0.363273859f, 0.192534328f},
-std::array<float,2>{0.536070406f, 0.592339337f},
-std::array<float,2>{0.0648099333f, 0.860304832f},
-std::array<float,2>{0.89826113f, 0.442440182f},
-std::array<float,2>{0.226698518f, 0.153291911f},
-std::array<float,2>{0.865463793f, 0.511492312f},
-std::array<float,2>{0.461848706f, 0.776997924f},
-std::array<float,2>{0.726664603f, 0.415176541f},
-std::array<float,2>{0.257020921f, 0.257413656f},
-std::array<float,2>{0.569785357f, 0.988767385f},
-std::array<float,2>{0.0103594335f, 0.729173541f},
-std::array<float,2>{0.943453312f, 0.117661521f},
-std::array<float,2>{0.110839069f, 0.469463497f},
-std::array<float,2>{0.934134185f, 0.816214323f},
-std::array<float,2>{0.318908185f, 0.603301406f},
-std::array<float,2>{0.508857727f, 0.231977582f},
-std::array<float,2>{0.424108237f, 0.0188151468f},
-std::array<float,2>{0.661596358f, 0.650989234f},
-std::array<float,2>{0.180525959f, 0.90815407f},
-std::array<float,2>{0.800692737f, 0.313171089f},
-std::array<float,2>{0.207778379f, 0.115612529f},
-std::array<float,2>{0.826257169f, 0.721201658f},
-std::array<float,2>{0.478006512f, 0.992208421f},
-std::array<float,2>{0.710094094f, 0.259486407f},
-std::array<float,2>{0.304585785f, 0.413021713f},
-std::array<float,2>{0.60956037f, 0.767439187f},
-std::array<float,2>{0.0388284661f, 0.501797736f},
-std::array<float,2>{0.99817425f, 0.146187529f},
-std::array<float,2>{0.0772008598f, 0.326152563f},
-std::array<float,2>{0.904236138f, 0.918865561f},
-std::array<float,2>{0.36807698f, 0.645479262f},
-std::array<float,2>{0.539962709f, 0.0266355705f},
-std::array<float,2>{0.398899496f, 0.219271481f},
-std::array<float,2>{0.643681586f, 0.594276667f},
-std::array<float,2>{0.155024156f, 0.826497376f},
-std::array<float,2>{0.762656093f, 0.481116861f},
-std::array<float,2>{0.00493319007f, 0.185758084f},
-std::array<float,2>{0.951757789f, 0.542868078f},
-std::array<float,2>{0.263477355f, 0.809878051f},
-std::array<float,2>{0.577864051f, 0.396780521f},
-std::array<float,2>{0.460539281f, 0.296913415f},
-std::array<float,2>{0.722893178f, 0.965029538f},
-std::array<float,2>{0.223631158f, 0.697728217f},
-std::array<float,2>{0.872135878f, 0.0750014782f},
-std::array<float,2>{0.177677199f, 0.452342838f},
-std::array<float,2>{0.808277786f, 0.872622907f},
-std::array<float,2>{0.437373906f, 0.582636952f},
-std::array<float,2>{0.665657401f, 0.197475284f},
-std::array<float,2>{0.324228346f, 0.0602776483f},
-std::array<float,2>{0.502524614f, 0.674369812f},
-std::array<float,2>{0.118771948f, 0.892466009f},
-std::array<float,2>{0.926676333f, 0.372767717f},
-std::array<float,2>{0.0985168368f, 0.00464720093f},
-std::array<float,2>{0.906468153f, 0.635497451f},
-std::array<float,2>{0.328722715f, 0.935670912f},
-std::array<float,2>{0.519248605f, 0.332509637f},
-std::array<float,2>{0.41588518f, 0.48931554f},
-std::array<float,2>{0.679101229f, 0.832981408f},
-std::array<float,2>{0.15832378f, 0.618081808f},
-std::array<float,2>{0.784331083f, 0.246826977f},
-std::array<float,2>{0.238574058f, 0.267467588f},
-std::array<float,2>{0.845310032f, 0.972564757f},
-std::array<float,2>{0.439835936f, 0.734837532f},
-std::array<float,2>{0.737663984f, 0.0999370292f},
-std::array<float,2>{0.266389191f, 0.130259603f},
-std::array<float,2>{0.57973212f, 0.525685191f},
-std::array<float,2>{0.016487075f, 0.761536479f},
-std::array<float,2>{0.96167767f, 0.42865321f},
-std::array<float,2>{0.140432686f, 0.215570271f},
-std::array<float,2>{0.773271084f, 0.576868117f},
-std::array<float,2>{0.381948262f, 0.854107797f},
-std::array<float,2>{0.635111928f, 0.467208743f},
-std::array<float,2>{0.351855725f, 0.355511963f},
-std::array<float,2>{0.551899135f, 0.886346459f},
-std::array<float,2>{0.0821546018f, 0.663692892f},
-std::array<float,2>{0.878562689f, 0.0427159406f},
-std::array<float,2>{0.0473278314f, 0.385003537f},
-std::array<float,2>{0.969885707f, 0.785282731f},
-std::array<float,2>{0.289162934f, 0.560851634f},
-std::array<float,2>{0.606971562f, 0.171562672f},
-std::array<float,2>{0.488173038f, 0.0928759873f},
-std::array<float,2>{0.688883781f, 0.71524179f},
-std::array<float,2>{0.202220172f, 0.943244576f},
-std::array<float,2>{0.843595088f, 0.29278934f},
-std::array<float,2>{0.175458834f, 0.108212993f},
-std::array<float,2>{0.809707522f, 0.742791474f},
-std::array<float,2>{0.430536479f, 0.984260082f},
-std::array<float,2>{0.670675337f, 0.275259495f},
-std::array<float,2>{0.321038663f, 0.430762261f},
-std::array<float,2>{0.50769788f, 0.753165066f},
-std::array<float,2>{0.122642621f, 0.522949994f},
-std::array<float,2>{0.925131023f, 0.134301111f},
-std::array<float,2>{0.000404275954f, 0.342579514f},
-std::array<float,2>{0.946530104f, 0.928782761f},
-std::array<float,2>{0.259865254f, 0.627345383f},
-std::array<float,2>{0.572305083f, 0.0100890063f},
-std::array<float,2>{0.455476433f, 0.240564391f},
-std::array<float,2>{0.721043944f, 0.616308153f},
-std::array<float,2>{0.222591445f, 0.83755964f},
-std::array<float,2>{0.870971322f, 0.494777471f},
-std::array<float,2>{0.0732616484f, 0.163501263f},
-std::array<float,2>{0.899687231f, 0.548638225f},
-std::array<float,2>{0.374717325f, 0.795804977f},
-std::array<float,2>{0.545558691f, 0.381291419f},
-std::array<float,2>{0.402987272f, 0.288173825f},
-std::array<float,2>{0.648018777f, 0.945456266f},
-std::array<float,2>{0.150530294f, 0.709029377f},
-std::array<float,2>{0.759618342f, 0.0787968636f},
-std::array<float,2>{0.204390362f, 0.453846306f},
-std::array<float,2>{0.821876049f, 0.848403871f},
-std::array<float,2>{0.483638138f, 0.564473569f},
-std::array<float,2>{0.705354452f, 0.209228143f},
-std::array<float,2>{0.297255009f, 0.0324489512f},
-std::array<float,2>{0.616025448f, 0.670780063f},
-std::array<float,2>{0.0349491164f, 0.875598311f},
-std::array<float,2>{0.994525313f, 0.346352547f},
-std::array<float,2>{0.0544513911f, 0.0228312369f},
-std::array<float,2>{0.973982513f, 0.652920544f},
-std::array<float,2>{0.294198632f, 0.910996974f},
-std::array<float,2>{0.604392886f, 0.319658279f},
-std::array<float,2>{0.490428984f, 0.475813985f},
-std::array<float,2>{0.69410038f, 0.816984832f},
-std::array<float,2>{0.195419028f, 0.606225193f},
-std::array<float,2>{0.836228073f, 0.226941764f},
-std::array<float,2>{0.13426508f, 0.251128346f},
-std::array<float,2>{0.765942633f, 0.986702859f},
-std::array<float,2>{0.378303617f, 0.732191503f},
-std::array<float,2>{0.636750996f, 0.124967158f},
-std::array<float,2>{0.358352721f, 0.150653392f},
-std::array<float,2>{0.549578726f, 0.513265431f},
-std::array<float,2>{0.0811244026f, 0.780967414f},
-std::array<float,2>{0.881065905f, 0.42072162f},
-std::array<float,2>{0.236394703f, 0.191388577f},
-std::array<float,2>{0.849962294f, 0.589777768f},
-std::array<float,2>{0.443047851f, 0.865496814f},
-std::array<float,2>{0.739851952f, 0.438271582f},
-std::array<float,2>{0.270027041f, 0.363115519f},
-std::array<float,2>{0.585189641f, 0.904232979f},
-std::array<float,2>{0.0229960456f, 0.682111919f},
-std::array<float,2>{0.967092276f, 0.0498806834f},
-std::array<float,2>{0.0948173478f, 0.398891598f},
-std::array<float,2>{0.91086483f, 0.799815536f},
-std::array<float,2>{0.33502683f, 0.537013292f},
-std::array<float,2>{0.520771921f, 0.176305279f},
-std::array<float,2>{0.420611888f, 0.0645426735f},
-std::array<float,2>{0.67538029f, 0.690099359f},
-std::array<float,2>{0.161346853f, 0.956558645f},
-std::array<float,2>{0.788176954f, 0.31039694f},
-std::array<float,2>{0.189996392f, 0.0574388653f},
-std::array<float,2>{0.835674822f, 0.676713765f},
-std::array<float,2>{0.499668747f, 0.897864223f},
-std::array<float,2>{0.696181297f, 0.369161874f},
-std::array<float,2>{0.286069006f, 0.446008235f},
-std::array<float,2>{0.596264899f, 0.87021488f},
-std::array<float,2>{0.0593223348f, 0.581652641f},
-std::array<float,2>{0.983104348f, 0.200129017f},
-std::array<float,2>{0.0909183472f, 0.302608579f},
-std::array<float,2>{0.884218216f, 0.963493168f},
-std::array<float,2>{0.344367057f, 0.701982439f},
-std::array<float,2>{0.554814637f, 0.0715332478f},
-std::array<float,2>{0.384799808f, 0.179732993f},
-std::array<float,2>{0.629528701f, 0.543839395f},
-std::array<float,2>{0.130926937f, 0.807484448f},
-std::array<float,2>{0.777441144f, 0.391989648f},
-std::array<float,2>{0.0260304362f, 0.224021912f},
-std::array<float,2>{0.955626607f, 0.599993169f},
-std::array<float,2>{0.27371639f, 0.820811927f},
-std::array<float,2>{0.593644381f, 0.478395104f},
-std::array<float,2>{0.451182246f, 0.321798027f},
-std::array<float,2>{0.744079351f, 0.917168438f},
-std::array<float,2>{0.248316646f, 0.641921103f},
-std::array<float,2>{0.855825782f, 0.0293887872f},
-std::array<float,2>{0.167446285f, 0.408289671f},
-std::array<float,2>{0.793195128f, 0.771874011f},
-std::array<float,2>{0.41114226f, 0.50459218f},
-std::array<float,2>{0.6853109f, 0.143820524f},
-std::array<float,2>{0.337364525f, 0.111245409f},
-std::array<float,2>{0.524261355f, 0.723573685f},
-std::array<float,2>{0.106237024f, 0.999602318f},
-std::array<float,2>{0.915761769f, 0.263154805f},
-std::array<float,2>{0.115589231f, 0.0865857676f},
-std::array<float,2>{0.932562768f, 0.711650908f},
-std::array<float,2>{0.315329731f, 0.937540293f},
-std::array<float,2>{0.514234304f, 0.294469923f},
-std::array<float,2>{0.427196026f, 0.389478415f},
-std::array<float,2>{0.658828795f, 0.783552408f},
-std::array<float,2>{0.185204431f, 0.558398724f},
-std::array<float,2>{0.802696228f, 0.165094689f},
-std::array<float,2>{0.232928231f, 0.352892011f},
-std::array<float,2>{0.861221373f, 0.888971865f},
-std::array<float,2>{0.465296924f, 0.658567727f},
-std::array<float,2>{0.733198762f, 0.0437186174f},
-std::array<float,2>{0.250923574f, 0.212273434f},
-std::array<float,2>{0.562886119f, 0.574151099f},
-std::array<float,2>{0.0124684786f, 0.858365834f},
-std::array<float,2>{0.938260853f, 0.463293672f},
-std::array<float,2>{0.148436084f, 0.127182722f},
-std::array<float,2>{0.750763655f, 0.531239748f},
-std::array<float,2>{0.394117713f, 0.763830304f},
-std::array<float,2>{0.649998426f, 0.424918622f},
-std::array<float,2>{0.36607188f, 0.270440727f},
-std::array<float,2>{0.532647491f, 0.974590421f},
-std::array<float,2>{0.0702257678f, 0.739993036f},
-std::array<float,2>{0.893074989f, 0.0964889601f},
-std::array<float,2>{0.0415234752f, 0.485027105f},
-std::array<float,2>{0.98625958f, 0.829781771f},
-std::array<float,2>{0.310526669f, 0.622292519f},
-std::array<float,2>{0.618146002f, 0.245949343f},
-std::array<float,2>{0.471518576f, 0.000132692745f},
-std::array<float,2>{0.717327476f, 0.639235675f},
-std::array<float,2>{0.214612737f, 0.931132734f},
-std::array<float,2>{0.819091797f, 0.329942733f},
-std::array<float,2>{0.125474781f, 0.015230001f},
-std::array<float,2>{0.775583148f, 0.632497966f},
-std::array<float,2>{0.38891238f, 0.922445536f},
-std::array<float,2>{0.627796888f, 0.337601036f},
-std::array<float,2>{0.350898832f, 0.499747992f},
-std::array<float,2>{0.561817706f, 0.842682481f},
-std::array<float,2>{0.0887886435f, 0.609829485f},
-std::array<float,2>{0.887087047f, 0.235327005f},
-std::array<float,2>{0.0560561568f, 0.279114276f},
-std::array<float,2>{0.979970455f, 0.97656703f},
-std::array<float,2>{0.28357175f, 0.748570323f},
-std::array<float,2>{0.600551128f, 0.104532443f},
-std::array<float,2>{0.492320657f, 0.139204919f},
-std::array<float,2>{0.699984968f, 0.517639041f},
-std::array<float,2>{0.194795489f, 0.755307436f},
-std::array<float,2>{0.830976248f, 0.433691144f},
-std::array<float,2>{0.105089501f, 0.205664605f},
-std::array<float,2>{0.920727313f, 0.568709075f},
-std::array<float,2>{0.342018098f, 0.845141172f},
-std::array<float,2>{0.53021127f, 0.459160805f},
-std::array<float,2>{0.410066932f, 0.348345667f},
-std::array<float,2>{0.683420897f, 0.882530928f},
-std::array<float,2>{0.170630917f, 0.665656626f},
-std::array<float,2>{0.790998816f, 0.0377425924f},
-std::array<float,2>{0.244270295f, 0.377622485f},
-std::array<float,2>{0.852126896f, 0.790635288f},
-std::array<float,2>{0.445977479f, 0.553389907f},
-std::array<float,2>{0.749072909f, 0.156414434f},
-std::array<float,2>{0.280823201f, 0.0824698508f},
-std::array<float,2>{0.587883294f, 0.705187261f},
-std::array<float,2>{0.0309224613f, 0.952630758f},
-std::array<float,2>{0.957458735f, 0.281696677f},
-std::array<float,2>{0.00908015668f, 0.119641855f},
-std::array<float,2>{0.941993654f, 0.728497505f},
-std::array<float,2>{0.254128069f, 0.991167009f},
-std::array<float,2>{0.566653252f, 0.254832536f},
-std::array<float,2>{0.463165283f, 0.41683194f},
-std::array<float,2>{0.730172575f, 0.775105596f},
-std::array<float,2>{0.228931367f, 0.509557962f},
-std::array<float,2>{0.865045428f, 0.155747592f},
-std::array<float,2>{0.182027996f, 0.315672845f},
-std::array<float,2>{0.797141612f, 0.908958137f},
-std::array<float,2>{0.422682911f, 0.649263144f},
-std::array<float,2>{0.663983881f, 0.017045591f},
-std::array<float,2>{0.316547453f, 0.233880743f},
-std::array<float,2>{0.510985255f, 0.605450988f},
-std::array<float,2>{0.113101162f, 0.814344347f},
-std::array<float,2>{0.935903907f, 0.472392172f},
-std::array<float,2>{0.217422366f, 0.172260597f},
-std::array<float,2>{0.815022886f, 0.533658922f},
-std::array<float,2>{0.475135624f, 0.802996159f},
-std::array<float,2>{0.714621544f, 0.405414253f},
-std::array<float,2>{0.306848139f, 0.30771181f},
-std::array<float,2>{0.622562349f, 0.957358658f},
-std::array<float,2>{0.0448935442f, 0.694547415f},
-std::array<float,2>{0.989272773f, 0.0678459108f},
-std::array<float,2>{0.0637263954f, 0.445298344f},
-std::array<float,2>{0.896344662f, 0.863235235f},
-std::array<float,2>{0.360448509f, 0.591678977f},
-std::array<float,2>{0.537442684f, 0.195031911f},
-std::array<float,2>{0.397499382f, 0.051039204f},
-std::array<float,2>{0.654156923f, 0.685474038f},
-std::array<float,2>{0.142461404f, 0.901922524f},
-std::array<float,2>{0.757605731f, 0.365328103f},
-std::array<float,2>{0.224823847f, 0.0768365413f},
-std::array<float,2>{0.87452054f, 0.69693464f},
-std::array<float,2>{0.457072109f, 0.96819365f},
-std::array<float,2>{0.724836171f, 0.299604774f},
-std::array<float,2>{0.264847726f, 0.396000415f},
-std::array<float,2>{0.574991167f, 0.811557353f},
-std::array<float,2>{0.00589682907f, 0.540015459f},
-std::array<float,2>{0.949646115f, 0.185360193f},
-std::array<float,2>{0.120648883f, 0.373585403f},
-std::array<float,2>{0.929133058f, 0.892587304f},
-std::array<float,2>{0.327429265f, 0.672555804f},
-std::array<float,2>{0.501420438f, 0.0615081713f},
-std::array<float,2>{0.43527469f, 0.196941704f},
-std::array<float,2>{0.667209148f, 0.585780144f},
-std::array<float,2>{0.17845729f, 0.874977231f},
-std::array<float,2>{0.806312025f, 0.449819595f},
-std::array<float,2>{0.037056867f, 0.146634191f},
-std::array<float,2>{0.99770534f, 0.502571344f},
-std::array<float,2>{0.3012999f, 0.768515229f},
-std::array<float,2>{0.612105608f, 0.410992116f},
-std::array<float,2>{0.480017155f, 0.26102984f},
-std::array<float,2>{0.7076056f, 0.995456398f},
-std::array<float,2>{0.209824011f, 0.720360219f},
-std::array<float,2>{0.825982273f, 0.11481452f},
-std::array<float,2>{0.152948782f, 0.483136535f},
-std::array<float,2>{0.764634132f, 0.826129913f},
-std::array<float,2>{0.4006356f, 0.596183419f},
-std::array<float,2>{0.642571092f, 0.221951455f},
-std::array<float,2>{0.370635629f, 0.0253820922f},
-std::array<float,2>{0.541268706f, 0.647996724f},
-std::array<float,2>{0.0752307251f, 0.920115411f},
-std::array<float,2>{0.904722333f, 0.327014863f},
-std::array<float,2>{0.0845285654f, 0.0392127596f},
-std::array<float,2>{0.876103342f, 0.661272585f},
-std::array<float,2>{0.353991508f, 0.883394778f},
-std::array<float,2>{0.554179847f, 0.358400971f},
-std::array<float,2>{0.379734993f, 0.465029418f},
-std::array<float,2>{0.634420097f, 0.851904452f},
-std::array<float,2>{0.138050929f, 0.576087713f},
-std::array<float,2>{0.769815266f, 0.218381211f},
-std::array<float,2>{0.200421616f, 0.289442033f},
-std::array<float,2>{0.840815842f, 0.943377256f},
-std::array<float,2>{0.484841883f, 0.71751684f},
-std::array<float,2>{0.69120723f, 0.0911281854f},
-std::array<float,2>{0.292742342f, 0.168811157f},
-std::array<float,2>{0.608486414f, 0.559197485f},
-std::array<float,2>{0.0500946753f, 0.787360966f},
-std::array<float,2>{0.972554088f, 0.383318812f},
-std::array<float,2>{0.157950282f, 0.248622417f},
-std::array<float,2>{0.782911241f, 0.620340765f},
-std::array<float,2>{0.417927802f, 0.835830569f},
-std::array<float,2>{0.676964998f, 0.490742922f},
-std::array<float,2>{0.33026585f, 0.334019363f},
-std::array<float,2>{0.51629734f, 0.93492949f},
-std::array<float,2>{0.100444116f, 0.633844674f},
-std::array<float,2>{0.908545315f, 0.00660079066f},
-std::array<float,2>{0.01917216f, 0.427565992f},
-std::array<float,2>{0.963094473f, 0.757960796f},
-std::array<float,2>{0.269520074f, 0.525317729f},
-std::array<float,2>{0.581934273f, 0.131955221f},
-std::array<float,2>{0.43809253f, 0.0993632674f},
-std::array<float,2>{0.735194087f, 0.737017512f},
-std::array<float,2>{0.241672978f, 0.970339715f},
-std::array<float,2>{0.845866621f, 0.268316269f},
-std::array<float,2>{0.160292342f, 0.0639148951f},
-std::array<float,2>{0.787398577f, 0.689171433f},
-std::array<float,2>{0.421759844f, 0.954162002f},
-std::array<float,2>{0.674663484f, 0.311064005f},
-std::array<float,2>{0.334885061f, 0.401775122f},
-std::array<float,2>{0.520289361f, 0.798484147f},
-std::array<float,2>{0.0943412259f, 0.537962258f},
-std::array<float,2>{0.911435425f, 0.177841067f},
-std::array<float,2>{0.0215867031f, 0.360652387f},
-std::array<float,2>{0.968611121f, 0.905137777f},
-std::array<float,2>{0.270870775f, 0.680671751f},
-std::array<float,2>{0.584395707f, 0.0476271957f},
-std::array<float,2>{0.442100257f, 0.189186394f},
-std::array<float,2>{0.738484859f, 0.587315798f},
-std::array<float,2>{0.237524435f, 0.864756405f},
-std::array<float,2>{0.851205111f, 0.441163719f},
-std::array<float,2>{0.0804300755f, 0.148849949f},
-std::array<float,2>{0.882355988f, 0.515205622f},
-std::array<float,2>{0.359273046f, 0.778819144f},
-std::array<float,2>{0.55014497f, 0.417971939f},
-std::array<float,2>{0.377777994f, 0.252013355f},
-std::array<float,2>{0.638625979f, 0.985366046f},
-std::array<float,2>{0.132995009f, 0.733423889f},
-std::array<float,2>{0.767433107f, 0.122707434f},
-std::array<float,2>{0.196678385f, 0.473292142f},
-std::array<float,2>{0.837079346f, 0.818991959f},
-std::array<float,2>{0.492106974f, 0.608687282f},
-std::array<float,2>{0.694490969f, 0.229710326f},
-std::array<float,2>{0.293480963f, 0.0210013725f},
-std::array<float,2>{0.605437338f, 0.65476352f},
-std::array<float,2>{0.0534393564f, 0.913955331f},
-std::array<float,2>{0.973507583f, 0.31758818f},
-std::array<float,2>{0.0338185951f, 0.0335726961f},
-std::array<float,2>{0.995472789f, 0.669766724f},
-std::array<float,2>{0.298755109f, 0.878694832f},
-std::array<float,2>{0.616357923f, 0.344839513f},
-std::array<float,2>{0.482756674f, 0.456892371f},
-std::array<float,2>{0.707025647f, 0.849877775f},
-std::array<float,2>{0.203885362f, 0.562639594f},
-std::array<float,2>{0.821060479f, 0.208752751f},
-std::array<float,2>{0.151624307f, 0.286010563f},
-std::array<float,2>{0.758538723f, 0.94868052f},
-std::array<float,2>{0.403982252f, 0.707948089f},
-std::array<float,2>{0.647237062f, 0.0818808675f},
-std::array<float,2>{0.37348187f, 0.160801515f},
-std::array<float,2>{0.546510994f, 0.549848139f},
-std::array<float,2>{0.072773084f, 0.793353975f},
-std::array<float,2>{0.898830116f, 0.37894401f},
-std::array<float,2>{0.221192151f, 0.239750475f},
-std::array<float,2>{0.869384348f, 0.614568889f},
-std::array<float,2>{0.456530422f, 0.838357747f},
-std::array<float,2>{0.722309709f, 0.493745208f},
-std::array<float,2>{0.261226147f, 0.340096712f},
-std::array<float,2>{0.573333979f, 0.92713356f},
-std::array<float,2>{0.00136380445f, 0.625578284f},
-std::array<float,2>{0.945510507f, 0.00896207709f},
-std::array<float,2>{0.121723264f, 0.432843298f},
-std::array<float,2>{0.924022734f, 0.750188589f},
-std::array<float,2>{0.321667939f, 0.521048009f},
-std::array<float,2>{0.506691575f, 0.136610091f},
-std::array<float,2>{0.431222737f, 0.106350191f},
-std::array<float,2>{0.671451569f, 0.744313538f},
-std::array<float,2>{0.173915267f, 0.982066929f},
-std::array<float,2>{0.808875442f, 0.276084512f},
-std::array<float,2>{0.213765576f, 0.00349092926f},
-std::array<float,2>{0.81938684f, 0.637051642f},
-std::array<float,2>{0.47230792f, 0.932303846f},
-std::array<float,2>{0.718033135f, 0.331001192f},
-std::array<float,2>{0.3091245f, 0.486468196f},
-std::array<float,2>{0.618864357f, 0.83067131f},
-std::array<float,2>{0.0421583466f, 0.623374939f},
-std::array<float,2>{0.984933496f, 0.243815511f},
-std::array<float,2>{0.0688395351f, 0.272757739f},
-std::array<float,2>{0.894120991f, 0.976033628f},
-std::array<float,2>{0.366226047f, 0.741592765f},
-std::array<float,2>{0.531645417f, 0.0942704007f},
-std::array<float,2>{0.393119216f, 0.126722082f},
-std::array<float,2>{0.649335921f, 0.527689993f},
-std::array<float,2>{0.147140622f, 0.761966646f},
-std::array<float,2>{0.751102507f, 0.422176421f},
-std::array<float,2>{0.0133813061f, 0.214757279f},
-std::array<float,2>{0.93927598f, 0.572151303f},
-std::array<float,2>{0.251803398f, 0.856342196f},
-std::array<float,2>{0.56392318f, 0.462816745f},
-std::array<float,2>{0.466187507f, 0.353717983f},
-std::array<float,2>{0.734172225f, 0.887998819f},
-std::array<float,2>{0.23414503f, 0.657705903f},
-std::array<float,2>{0.859715343f, 0.0453812778f},
-std::array<float,2>{0.184490174f, 0.386925995f},
-std::array<float,2>{0.800923049f, 0.782456756f},
-std::array<float,2>{0.425790876f, 0.555269718f},
-std::array<float,2>{0.65998733f, 0.166256621f},
-std::array<float,2>{0.315544963f, 0.0888342112f},
-std::array<float,2>{0.514674366f, 0.714482963f},
-std::array<float,2>{0.116359152f, 0.939722061f},
-std::array<float,2>{0.933143556f, 0.296654135f},
-std::array<float,2>{0.107333124f, 0.112587035f},
-std::array<float,2>{0.914664149f, 0.725266635f},
-std::array<float,2>{0.336198181f, 0.996997893f},
-std::array<float,2>{0.524834394f, 0.264132112f},
-std::array<float,2>{0.410715491f, 0.408154011f},
-std::array<float,2>{0.684185982f, 0.770727932f},
-std::array<float,2>{0.166241392f, 0.506318748f},
-std::array<float,2>{0.793967426f, 0.142481789f},
-std::array<float,2>{0.249769956f, 0.322651744f},
-std::array<float,2>{0.856732845f, 0.914592624f},
-std::array<float,2>{0.452197611f, 0.644434094f},
-std::array<float,2>{0.742731392f, 0.0289034974f},
-std::array<float,2>{0.275194645f, 0.225594372f},
-std::array<float,2>{0.592142999f, 0.598254502f},
-std::array<float,2>{0.0268792175f, 0.823691547f},
-std::array<float,2>{0.95690918f, 0.479168415f},
-std::array<float,2>{0.131915212f, 0.183160648f},
-std::array<float,2>{0.778349996f, 0.545755088f},
-std::array<float,2>{0.386106998f, 0.806191206f},
-std::array<float,2>{0.630045891f, 0.393549055f},
-std::array<float,2>{0.345039457f, 0.302778989f},
-std::array<float,2>{0.555909336f, 0.961933494f},
-std::array<float,2>{0.0899671093f, 0.700662017f},
-std::array<float,2>{0.883627474f, 0.0741940737f},
-std::array<float,2>{0.0596562997f, 0.448916823f},
-std::array<float,2>{0.983834207f, 0.8676278f},
-std::array<float,2>{0.286850005f, 0.579277813f},
-std::array<float,2>{0.597415566f, 0.202511743f},
-std::array<float,2>{0.498509645f, 0.0564883724f},
-std::array<float,2>{0.696618557f, 0.678552091f},
-std::array<float,2>{0.191224977f, 0.895770669f},
-std::array<float,2>{0.834552765f, 0.367589533f},
-std::array<float,2>{0.141577721f, 0.054232955f},
-std::array<float,2>{0.756820619f, 0.686411977f},
-std::array<float,2>{0.396659315f, 0.89923507f},
-std::array<float,2>{0.65258044f, 0.365132302f},
-std::array<float,2>{0.35980466f, 0.442072809f},
-std::array<float,2>{0.538718462f, 0.861104071f},
-std::array<float,2>{0.063443616f, 0.593102753f},
-std::array<float,2>{0.894788623f, 0.191951677f},
-std::array<float,2>{0.0432430282f, 0.30513522f},
-std::array<float,2>{0.989211142f, 0.959270298f},
-std::array<float,2>{0.307868272f, 0.69189626f},
-std::array<float,2>{0.621338546f, 0.0689571425f},
-std::array<float,2>{0.475625098f, 0.173957035f},
-std::array<float,2>{0.713118851f, 0.531363964f},
-std::array<float,2>{0.21820645f, 0.801755369f},
-std::array<float,2>{0.815880775f, 0.404107332f},
-std::array<float,2>{0.112138204f, 0.230847821f},
-std::array<float,2>{0.937261164f, 0.601890802f},
-std::array<float,2>{0.318286896f, 0.814993083f},
-std::array<float,2>{0.509812713f, 0.47017476f},
-std::array<float,2>{0.423444808f, 0.313596725f},
-std::array<float,2>{0.6626091f, 0.906269073f},
-std::array<float,2>{0.183340266f, 0.651808321f},
-std::array<float,2>{0.798247755f, 0.0182794835f},
-std::array<float,2>{0.230078518f, 0.414421886f},
-std::array<float,2>{0.863314569f, 0.775928557f},
-std::array<float,2>{0.464062512f, 0.510274053f},
-std::array<float,2>{0.728580177f, 0.154212356f},
-std::array<float,2>{0.255378038f, 0.119138539f},
-std::array<float,2>{0.56797874f, 0.730216563f},
-std::array<float,2>{0.00878791977f, 0.990194142f},
-std::array<float,2>{0.943295121f, 0.256205976f},
-std::array<float,2>{0.0293370876f, 0.0856574699f},
-std::array<float,2>{0.958646834f, 0.704343319f},
-std::array<float,2>{0.280269891f, 0.950369477f},
-std::array<float,2>{0.586907446f, 0.284877628f},
-std::array<float,2>{0.44684723f, 0.376902997f},
-std::array<float,2>{0.748554051f, 0.7921803f},
-std::array<float,2>{0.245535776f, 0.551090717f},
-std::array<float,2>{0.853094161f, 0.158207878f},
-std::array<float,2>{0.170949936f, 0.3507258f},
-std::array<float,2>{0.789403498f, 0.879997909f},
-std::array<float,2>{0.408278644f, 0.666060746f},
-std::array<float,2>{0.682320833f, 0.0369788744f},
-std::array<float,2>{0.343488276f, 0.204155996f},
-std::array<float,2>{0.530818403f, 0.567962527f},
-std::array<float,2>{0.104440384f, 0.84732461f},
-std::array<float,2>{0.92106694f, 0.458694845f},
-std::array<float,2>{0.19413057f, 0.138583258f},
-std::array<float,2>{0.831923008f, 0.517110407f},
-std::array<float,2>{0.493558884f, 0.755997717f},
-std::array<float,2>{0.70062083f, 0.435979724f},
-std::array<float,2>{0.284802288f, 0.281059355f},
-std::array<float,2>{0.601076245f, 0.978738844f},
-std::array<float,2>{0.05534935f, 0.747781754f},
-std::array<float,2>{0.978617668f, 0.103210837f},
-std::array<float,2>{0.0897909477f, 0.497524589f},
-std::array<float,2>{0.887778759f, 0.840410829f},
-std::array<float,2>{0.349633962f, 0.612603843f},
-std::array<float,2>{0.561354399f, 0.236864284f},
-std::array<float,2>{0.3898274f, 0.0126361027f},
-std::array<float,2>{0.628902018f, 0.629526436f},
-std::array<float,2>{0.126141861f, 0.925131857f},
-std::array<float,2>{0.776677787f, 0.339702785f},
-std::array<float,2>{0.240522087f, 0.101414323f},
-std::array<float,2>{0.847234368f, 0.735714078f},
-std::array<float,2>{0.438722581f, 0.971167028f},
-std::array<float,2>{0.735408247f, 0.266226918f},
-std::array<float,2>{0.268519104f, 0.428750873f},
-std::array<float,2>{0.580673754f, 0.759937644f},
-std::array<float,2>{0.0177104641f, 0.527121365f},
-std::array<float,2>{0.964718997f, 0.129485965f},
-std::array<float,2>{0.10061001f, 0.333313465f},
-std::array<float,2>{0.909242213f, 0.937417924f},
-std::array<float,2>{0.331428468f, 0.636350214f},
-std::array<float,2>{0.516677141f, 0.00536288181f},
-std::array<float,2>{0.416713208f, 0.247181669f},
-std::array<float,2>{0.676035881f, 0.618555546f},
-std::array<float,2>{0.156702667f, 0.833750427f},
-std::array<float,2>{0.78144002f, 0.48910895f},
-std::array<float,2>{0.0488517657f, 0.170808017f},
-std::array<float,2>{0.971001565f, 0.562274754f},
-std::array<float,2>{0.291410893f, 0.787066102f},
-std::array<float,2>{0.607806802f, 0.38627556f},
-std::array<float,2>{0.486201823f, 0.291883409f},
-std::array<float,2>{0.690087199f, 0.942234039f},
-std::array<float,2>{0.199844405f, 0.71652472f},
-std::array<float,2>{0.841450095f, 0.0918266922f},
-std::array<float,2>{0.137614563f, 0.46788317f},
-std::array<float,2>{0.771001041f, 0.855283439f},
-std::array<float,2>{0.380844027f, 0.578019023f},
-std::array<float,2>{0.633247256f, 0.216165692f},
-std::array<float,2>{0.354830235f, 0.0413879119f},
-std::array<float,2>{0.553333938f, 0.663055837f},
-std::array<float,2>{0.0849686712f, 0.885484338f},
-std::array<float,2>{0.875454843f, 0.357300282f},
-std::array<float,2>{0.0748957992f, 0.0258329622f},
-std::array<float,2>{0.905971229f, 0.646103501f},
-std::array<float,2>{0.370005935f, 0.919836342f},
-std::array<float,2>{0.54207474f, 0.325102597f},
-std::array<float,2>{0.401949018f, 0.482031822f},
-std::array<float,2>{0.640939534f, 0.827712834f},
-std::array<float,2>{0.153499931f, 0.594955206f},
-std::array<float,2>{0.765001178f, 0.220437109f},
-std::array<float,2>{0.210916862f, 0.258528173f},
-std::array<float,2>{0.825053096f, 0.993406057f},
-std::array<float,2>{0.478618085f, 0.721885026f},
-std::array<float,2>{0.708714068f, 0.116323791f},
-std::array<float,2>{0.302288085f, 0.145174161f},
-std::array<float,2>{0.613164961f, 0.500463784f},
-std::array<float,2>{0.0357659198f, 0.765745699f},
-std::array<float,2>{0.996325612f, 0.413285524f},
-std::array<float,2>{0.179352522f, 0.19876422f},
-std::array<float,2>{0.805382013f, 0.583377719f},
-std::array<float,2>{0.434024721f, 0.871154547f},
-std::array<float,2>{0.666720808f, 0.451478422f},
-std::array<float,2>{0.326879054f, 0.37171042f},
-std::array<float,2>{0.500586808f, 0.891032338f},
-std::array<float,2>{0.119317524f, 0.675538242f},
-std::array<float,2>{0.927903473f, 0.0593397953f},
-std::array<float,2>{0.00744285155f, 0.398306847f},
-std::array<float,2>{0.951132655f, 0.808940351f},
-std::array<float,2>{0.263954788f, 0.541273177f},
-std::array<float,2>{0.575794697f, 0.187058717f},
-std::array<float,2>{0.458066791f, 0.0757624507f},
-std::array<float,2>{0.72592628f, 0.698757946f},
-std::array<float,2>{0.226336211f, 0.96639359f},
-std::array<float,2>{0.873242795f, 0.298182815f},
-std::array<float,2>{0.136380583f, 0.12362802f},
-std::array<float,2>{0.768404782f, 0.731280208f},
-std::array<float,2>{0.376633763f, 0.98788178f},
-std::array<float,2>{0.63913399f, 0.250355393f},
-std::array<float,2>{0.356920689f, 0.421612889f},
-std::array<float,2>{0.548271179f, 0.779607117f},
-std::array<float,2>{0.0798081011f, 0.512669504f},
-std::array<float,2>{0.88050878f, 0.151529461f},
-std::array<float,2>{0.0524330996f, 0.318769395f},
-std::array<float,2>{0.975965619f, 0.91140902f},
-std::array<float,2>{0.296170712f, 0.653543413f},
-std::array<float,2>{0.601728559f, 0.0215597972f},
-std::array<float,2>{0.489380687f, 0.227973074f},
-std::array<float,2>{0.691428423f, 0.606933594f},
-std::array<float,2>{0.197269216f, 0.818023741f},
-std::array<float,2>{0.839464247f, 0.475331038f},
-std::array<float,2>{0.0957974344f, 0.177267075f},
-std::array<float,2>{0.912569642f, 0.535921156f},
-std::array<float,2>{0.332124382f, 0.799212039f},
-std::array<float,2>{0.522990763f, 0.400135964f},
-std::array<float,2>{0.419128478f, 0.308924824f},
-std::array<float,2>{0.671953678f, 0.955544174f},
-std::array<float,2>{0.163886055f, 0.69055146f},
-std::array<float,2>{0.786874771f, 0.0657979101f},
-std::array<float,2>{0.235888317f, 0.438520372f},
-std::array<float,2>{0.849195778f, 0.867097795f},
-std::array<float,2>{0.444288015f, 0.588799357f},
-std::array<float,2>{0.741137326f, 0.190388024f},
-std::array<float,2>{0.27170819f, 0.0493686944f},
-std::array<float,2>{0.582170069f, 0.683508039f},
-std::array<float,2>{0.020330226f, 0.903193951f},
-std::array<float,2>{0.965781152f, 0.36212483f},
-std::array<float,2>{0.00239129621f, 0.0116027016f},
-std::array<float,2>{0.949064016f, 0.628689826f},
-std::array<float,2>{0.258745581f, 0.92780894f},
-std::array<float,2>{0.572233021f, 0.343470961f},
-std::array<float,2>{0.454638124f, 0.495762914f},
-std::array<float,2>{0.719706953f, 0.836608589f},
-std::array<float,2>{0.220330968f, 0.615548372f},
-std::array<float,2>{0.867667735f, 0.24179174f},
-std::array<float,2>{0.173220038f, 0.27388382f},
-std::array<float,2>{0.810864329f, 0.982979357f},
-std::array<float,2>{0.433293492f, 0.744124115f},
-std::array<float,2>{0.668346286f, 0.108472556f},
-std::array<float,2>{0.324024916f, 0.133766383f},
-std::array<float,2>{0.504520953f, 0.522306144f},
-std::array<float,2>{0.123677745f, 0.752539098f},
-std::array<float,2>{0.923248589f, 0.429706424f},
-std::array<float,2>{0.206497565f, 0.210242122f},
-std::array<float,2>{0.823402524f, 0.566275299f},
-std::array<float,2>{0.481303394f, 0.848927259f},
-std::array<float,2>{0.704567611f, 0.454725295f},
-std::array<float,2>{0.299458504f, 0.346702784f},
-std::array<float,2>{0.615156591f, 0.87678957f},
-std::array<float,2>{0.0329949893f, 0.671478868f},
-std::array<float,2>{0.993664563f, 0.0321086347f},
-std::array<float,2>{0.0704431832f, 0.382116586f},
-std::array<float,2>{0.902064443f, 0.79655391f},
-std::array<float,2>{0.371878654f, 0.546933413f},
-std::array<float,2>{0.543206692f, 0.162541449f},
-std::array<float,2>{0.404657394f, 0.0797569826f},
-std::array<float,2>{0.645637751f, 0.710106552f},
-std::array<float,2>{0.149105832f, 0.946591914f},
-std::array<float,2>{0.761631787f, 0.28735292f},
-std::array<float,2>{0.230973348f, 0.0445576869f},
-std::array<float,2>{0.862068236f, 0.659362137f},
-std::array<float,2>{0.467680335f, 0.890475512f},
-std::array<float,2>{0.732135653f, 0.352093697f},
-std::array<float,2>{0.253218383f, 0.464287043f},
-std::array<float,2>{0.56627059f, 0.858904064f},
-std::array<float,2>{0.0139192538f, 0.573142469f},
-std::array<float,2>{0.940480053f, 0.21141459f},
-std::array<float,2>{0.114565842f, 0.293382317f},
-std::array<float,2>{0.929961324f, 0.939053953f},
-std::array<float,2>{0.313794106f, 0.711988807f},
-std::array<float,2>{0.512476742f, 0.0874604434f},
-std::array<float,2>{0.429097235f, 0.164641291f},
-std::array<float,2>{0.657011867f, 0.557179093f},
-std::array<float,2>{0.186130166f, 0.784825206f},
-std::array<float,2>{0.804276228f, 0.390022218f},
-std::array<float,2>{0.0393161401f, 0.244772241f},
-std::array<float,2>{0.986595929f, 0.621534526f},
-std::array<float,2>{0.312039196f, 0.828818262f},
-std::array<float,2>{0.619488657f, 0.485939652f},
-std::array<float,2>{0.468996853f, 0.328849137f},
-std::array<float,2>{0.715797126f, 0.930056155f},
-std::array<float,2>{0.211975992f, 0.639746249f},
-std::array<float,2>{0.817320287f, 0.0015140794f},
-std::array<float,2>{0.146376982f, 0.424057424f},
-std::array<float,2>{0.752497494f, 0.764813364f},
-std::array<float,2>{0.391246796f, 0.529511333f},
-std::array<float,2>{0.65087235f, 0.128207877f},
-std::array<float,2>{0.364990711f, 0.0970602855f},
-std::array<float,2>{0.533694923f, 0.738552153f},
-std::array<float,2>{0.0678010508f, 0.973110259f},
-std::array<float,2>{0.891409099f, 0.270903796f},
-std::array<float,2>{0.092757903f, 0.0710445791f},
-std::array<float,2>{0.8856951f, 0.702754617f},
-std::array<float,2>{0.34711951f, 0.964363992f},
-std::array<float,2>{0.556696534f, 0.301741719f},
-std::array<float,2>{0.383698136f, 0.390698642f},
-std::array<float,2>{0.632495821f, 0.808167279f},
-std::array<float,2>{0.129931703f, 0.544650972f},
-std::array<float,2>{0.78011173f, 0.181172565f},
-std::array<float,2>{0.188695982f, 0.370433778f},
-std::array<float,2>{0.832480788f, 0.897256553f},
-std::array<float,2>{0.497560382f, 0.676883936f},
-std::array<float,2>{0.698383331f, 0.0577541031f},
-std::array<float,2>{0.288447827f, 0.200705066f},
-std::array<float,2>{0.59514755f, 0.580452502f},
-std::array<float,2>{0.0608494096f, 0.869287431f},
-std::array<float,2>{0.981144309f, 0.446548104f},
-std::array<float,2>{0.165068701f, 0.142951831f},
-std::array<float,2>{0.795778513f, 0.505710721f},
-std::array<float,2>{0.413575023f, 0.772541046f},
-std::array<float,2>{0.685701668f, 0.409971386f},
-std::array<float,2>{0.338003933f, 0.261729121f},
-std::array<float,2>{0.526062846f, 0.998449683f},
-std::array<float,2>{0.107735157f, 0.724305809f},
-std::array<float,2>{0.917901635f, 0.110107742f},
-std::array<float,2>{0.0253561568f, 0.477268159f},
-std::array<float,2>{0.953611374f, 0.82194066f},
-std::array<float,2>{0.277210593f, 0.601093054f},
-std::array<float,2>{0.590405822f, 0.22327207f},
-std::array<float,2>{0.450924814f, 0.030948462f},
-std::array<float,2>{0.744786739f, 0.641322613f},
-std::array<float,2>{0.247729048f, 0.916565299f},
-std::array<float,2>{0.858820677f, 0.320924133f},
-std::array<float,2>{0.181357205f, 0.0162614342f},
-std::array<float,2>{0.799479604f, 0.649587333f},
-std::array<float,2>{0.425157607f, 0.909583211f},
-std::array<float,2>{0.660170913f, 0.314836681f},
-std::array<float,2>{0.320258558f, 0.471650988f},
-std::array<float,2>{0.508766055f, 0.81325531f},
-std::array<float,2>{0.1101465f, 0.603936017f},
-std::array<float,2>{0.935148954f, 0.232566625f},
-std::array<float,2>{0.0115346862f, 0.255743504f},
-std::array<float,2>{0.944491148f, 0.991719544f},
-std::array<float,2>{0.256294847f, 0.726566017f},
-std::array<float,2>{0.56860131f, 0.121027298f},
-std::array<float,2>{0.462476701f, 0.155110165f},
-std::array<float,2>{0.72831887f, 0.508001924f},
-std::array<float,2>{0.22808373f, 0.774289966f},
-std::array<float,2>{0.866662145f, 0.417141616f},
-std::array<float,2>{0.0660304278f, 0.193999067f},
-std::array<float,2>{0.897379696f, 0.590266168f},
-std::array<float,2>{0.361643016f, 0.861822486f},
-std::array<float,2>{0.537084043f, 0.443903625f},
-std::array<float,2>{0.395296514f, 0.36667031f},
-std::array<float,2>{0.656134427f, 0.900796056f},
-std::array<float,2>{0.144278437f, 0.683766305f},
-std::array<float,2>{0.755199373f, 0.0522301458f},
-std::array<float,2>{0.216574594f, 0.405002177f},
-std::array<float,2>{0.814307153f, 0.803720415f},
-std::array<float,2>{0.47384125f, 0.535050273f},
-std::array<float,2>{0.712432384f, 0.173295945f},
-std::array<float,2>{0.305925637f, 0.066879496f},
-std::array<float,2>{0.623795033f, 0.694238245f},
-std::array<float,2>{0.0465910248f, 0.958715856f},
-std::array<float,2>{0.991835713f, 0.307341993f},
-std::array<float,2>{0.0577243343f, 0.104123615f},
-std::array<float,2>{0.978370667f, 0.749447465f},
-std::array<float,2>{0.282043904f, 0.978237748f},
-std::array<float,2>{0.598351002f, 0.278151304f},
-std::array<float,2>{0.495079458f, 0.434943795f},
-std::array<float,2>{0.70119822f, 0.754351974f},
-std::array<float,2>{0.191621229f, 0.518824399f},
-std::array<float,2>{0.829459071f, 0.140349373f},
-std::array<float,2>{0.127442345f, 0.336165339f},
-std::array<float,2>{0.774917483f, 0.923335254f},
-std::array<float,2>{0.386955976f, 0.631021857f},
-std::array<float,2>{0.625866234f, 0.0137496507f},
-std::array<float,2>{0.348455578f, 0.236253932f},
-std::array<float,2>{0.558705211f, 0.611221015f},
-std::array<float,2>{0.0872512907f, 0.842797637f},
-std::array<float,2>{0.889493942f, 0.498301119f},
-std::array<float,2>{0.243960217f, 0.157365039f},
-std::array<float,2>{0.854068816f, 0.554595351f},
-std::array<float,2>{0.447525948f, 0.789824247f},
-std::array<float,2>{0.746420503f, 0.378746957f},
-std::array<float,2>{0.278751701f, 0.282761157f},
-std::array<float,2>{0.588556111f, 0.951898754f},
-std::array<float,2>{0.0290939528f, 0.70701921f},
-std::array<float,2>{0.96020031f, 0.0836018026f},
-std::array<float,2>{0.102928154f, 0.460765898f},
-std::array<float,2>{0.918290734f, 0.844541013f},
-std::array<float,2>{0.340122104f, 0.570286572f},
-std::array<float,2>{0.527829409f, 0.20695889f},
-std::array<float,2>{0.40632236f, 0.0387754478f},
-std::array<float,2>{0.681121111f, 0.665018439f},
-std::array<float,2>{0.168221012f, 0.881373882f},
-std::array<float,2>{0.791726291f, 0.348784864f},
-std::array<float,2>{0.201285228f, 0.0903074592f},
-std::array<float,2>{0.842482507f, 0.71851939f},
-std::array<float,2>{0.486596018f, 0.944742501f},
-std::array<float,2>{0.68786633f, 0.290719837f},
-std::array<float,2>{0.290820807f, 0.384357274f},
-std::array<float,2>{0.605514705f, 0.788225234f},
-std::array<float,2>{0.0486069284f, 0.559629679f},
-std::array<float,2>{0.969552517f, 0.169028684f},
-std::array<float,2>{0.0830650479f, 0.358302772f},
-std::array<float,2>{0.877762616f, 0.884747267f},
-std::array<float,2>{0.352614343f, 0.661090374f},
-std::array<float,2>{0.551130533f, 0.0402349904f},
-std::array<float,2>{0.381265074f, 0.217661634f},
-std::array<float,2>{0.636226952f, 0.57473886f},
-std::array<float,2>{0.139058754f, 0.853502989f},
-std::array<float,2>{0.77207154f, 0.466065884f},
-std::array<float,2>{0.0173392296f, 0.131038949f},
-std::array<float,2>{0.962120593f, 0.523666322f},
-std::array<float,2>{0.266694069f, 0.75889641f},
-std::array<float,2>{0.57852757f, 0.425997406f},
-std::array<float,2>{0.441358268f, 0.268657863f},
-std::array<float,2>{0.736843348f, 0.969531775f},
-std::array<float,2>{0.239849567f, 0.738078296f},
-std::array<float,2>{0.844475985f, 0.0984689891f},
-std::array<float,2>{0.159794778f, 0.491622835f},
-std::array<float,2>{0.784068286f, 0.834262729f},
-std::array<float,2>{0.414553314f, 0.619509816f},
-std::array<float,2>{0.678118467f, 0.249452531f},
-std::array<float,2>{0.32952562f, 0.00769898901f},
-std::array<float,2>{0.518400311f, 0.633767128f},
-std::array<float,2>{0.0993166417f, 0.934485078f},
-std::array<float,2>{0.907903373f, 0.335902691f},
-std::array<float,2>{0.117978908f, 0.0623791479f},
-std::array<float,2>{0.926949799f, 0.673506737f},
-std::array<float,2>{0.325414538f, 0.8939448f},
-std::array<float,2>{0.503221393f, 0.374821573f},
-std::array<float,2>{0.436026782f, 0.450902641f},
-std::array<float,2>{0.664760947f, 0.873448253f},
-std::array<float,2>{0.176025048f, 0.584066987f},
-std::array<float,2>{0.807578564f, 0.19592081f},
-std::array<float,2>{0.224468663f, 0.300760269f},
-std::array<float,2>{0.871955097f, 0.967672348f},
-std::array<float,2>{0.459037483f, 0.695532143f},
-std::array<float,2>{0.723910928f, 0.0772966817f},
-std::array<float,2>{0.262500316f, 0.184038743f},
-std::array<float,2>{0.576719344f, 0.540430367f},
-std::array<float,2>{0.00465704221f, 0.811456561f},
-std::array<float,2>{0.952581525f, 0.394660026f},
-std::array<float,2>{0.155396298f, 0.221500486f},
-std::array<float,2>{0.763605356f, 0.597446442f},
-std::array<float,2>{0.399612248f, 0.825093925f},
-std::array<float,2>{0.642883837f, 0.484353393f},
-std::array<float,2>{0.368311852f, 0.327280134f},
-std::array<float,2>{0.540372133f, 0.921698153f},
-std::array<float,2>{0.0766615272f, 0.646745741f},
-std::array<float,2>{0.903229654f, 0.0240669474f},
-std::array<float,2>{0.0378017016f, 0.411399245f},
-std::array<float,2>{0.999339521f, 0.768580496f},
-std::array<float,2>{0.302805871f, 0.503603637f},
-std::array<float,2>{0.610859752f, 0.147977978f},
-std::array<float,2>{0.476607412f, 0.114008643f},
-std::array<float,2>{0.709583938f, 0.719254076f},
-std::array<float,2>{0.208285481f, 0.994593501f},
-std::array<float,2>{0.827236235f, 0.260254681f},
-std::array<float,2>{0.142859235f, 0.0691210032f},
-std::array<float,2>{0.754607439f, 0.692267835f},
-std::array<float,2>{0.395779759f, 0.959173262f},
-std::array<float,2>{0.655007184f, 0.304745823f},
-std::array<float,2>{0.362652391f, 0.403951108f},
-std::array<float,2>{0.535410762f, 0.801479161f},
-std::array<float,2>{0.0650229305f, 0.531513155f},
-std::array<float,2>{0.897481561f, 0.174255639f},
-std::array<float,2>{0.0457175449f, 0.364960134f},
-std::array<float,2>{0.991199493f, 0.899034619f},
-std::array<float,2>{0.305248976f, 0.686165392f},
-std::array<float,2>{0.624713719f, 0.0545353852f},
-std::array<float,2>{0.473178387f, 0.192334503f},
-std::array<float,2>{0.711308122f, 0.592918754f},
-std::array<float,2>{0.215114295f, 0.860842466f},
-std::array<float,2>{0.813078105f, 0.44236809f},
-std::array<float,2>{0.110923551f, 0.153837144f},
-std::array<float,2>{0.933883548f, 0.510611534f},
-std::array<float,2>{0.318543583f, 0.776259661f},
-std::array<float,2>{0.509488165f, 0.414265126f},
-std::array<float,2>{0.424505502f, 0.256077051f},
-std::array<float,2>{0.661850929f, 0.98994267f},
-std::array<float,2>{0.179687589f, 0.730448782f},
-std::array<float,2>{0.799985051f, 0.118682623f},
-std::array<float,2>{0.227517158f, 0.469882876f},
-std::array<float,2>{0.866087198f, 0.815282166f},
-std::array<float,2>{0.461304277f, 0.601722777f},
-std::array<float,2>{0.727509022f, 0.230659708f},
-std::array<float,2>{0.25735563f, 0.01846244f},
-std::array<float,2>{0.570039928f, 0.651368439f},
-std::array<float,2>{0.00991140027f, 0.906662226f},
-std::array<float,2>{0.944093764f, 0.313949853f},
-std::array<float,2>{0.027673075f, 0.0368616581f},
-std::array<float,2>{0.959603906f, 0.666466892f},
-std::array<float,2>{0.278114825f, 0.880225599f},
-std::array<float,2>{0.588951766f, 0.350940943f},
-std::array<float,2>{0.448523998f, 0.458896071f},
-std::array<float,2>{0.747758746f, 0.847628295f},
-std::array<float,2>{0.24261266f, 0.56834209f},
-std::array<float,2>{0.855318069f, 0.204438195f},
-std::array<float,2>{0.169826567f, 0.285090834f},
-std::array<float,2>{0.792668462f, 0.950476229f},
-std::array<float,2>{0.40742445f, 0.704446614f},
-std::array<float,2>{0.680335283f, 0.0857873186f},
-std::array<float,2>{0.340836734f, 0.15861088f},
-std::array<float,2>{0.528520405f, 0.550874949f},
-std::array<float,2>{0.101741493f, 0.792262137f},
-std::array<float,2>{0.919538498f, 0.376626819f},
-std::array<float,2>{0.192650393f, 0.237284169f},
-std::array<float,2>{0.828661978f, 0.612353384f},
-std::array<float,2>{0.495672345f, 0.840782344f},
-std::array<float,2>{0.702343225f, 0.497279316f},
-std::array<float,2>{0.283021897f, 0.339407355f},
-std::array<float,2>{0.598804891f, 0.924812436f},
-std::array<float,2>{0.0570654385f, 0.629640818f},
-std::array<float,2>{0.976896226f, 0.0122686606f},
-std::array<float,2>{0.0862202197f, 0.435573936f},
-std::array<float,2>{0.889806628f, 0.756216288f},
-std::array<float,2>{0.349210411f, 0.517539203f},
-std::array<float,2>{0.559907317f, 0.13839677f},
-std::array<float,2>{0.388433814f, 0.103452653f},
-std::array<float,2>{0.626748741f, 0.747919202f},
-std::array<float,2>{0.127938405f, 0.978973389f},
-std::array<float,2>{0.773573816f, 0.280849904f},
-std::array<float,2>{0.239072666f, 0.00489915954f},
-std::array<float,2>{0.845050573f, 0.636514783f},
-std::array<float,2>{0.440395057f, 0.937182069f},
-std::array<float,2>{0.738160908f, 0.33320415f},
-std::array<float,2>{0.266075641f, 0.48877883f},
-std::array<float,2>{0.579408705f, 0.833526373f},
-std::array<float,2>{0.0157094989f, 0.618402362f},
-std::array<float,2>{0.961381674f, 0.247316346f},
-std::array<float,2>{0.0979737639f, 0.266582429f},
-std::array<float,2>{0.906820297f, 0.970708668f},
-std::array<float,2>{0.328382254f, 0.735428691f},
-std::array<float,2>{0.518624902f, 0.101263382f},
-std::array<float,2>{0.415268153f, 0.129821718f},
-std::array<float,2>{0.679501712f, 0.526974022f},
-std::array<float,2>{0.158827841f, 0.76016736f},
-std::array<float,2>{0.785123944f, 0.429031461f},
-std::array<float,2>{0.0475877896f, 0.215902925f},
-std::array<float,2>{0.970359147f, 0.577688277f},
-std::array<float,2>{0.289972186f, 0.855041564f},
-std::array<float,2>{0.606852412f, 0.468166381f},
-std::array<float,2>{0.487496167f, 0.356993258f},
-std::array<float,2>{0.689188778f, 0.885647118f},
-std::array<float,2>{0.202716097f, 0.662777245f},
-std::array<float,2>{0.842836797f, 0.0411084667f},
-std::array<float,2>{0.139852449f, 0.386495501f},
-std::array<float,2>{0.772548974f, 0.786657035f},
-std::array<float,2>{0.382677108f, 0.562138855f},
-std::array<float,2>{0.635722637f, 0.170541361f},
-std::array<float,2>{0.352262825f, 0.0922584012f},
-std::array<float,2>{0.55258441f, 0.716721773f},
-std::array<float,2>{0.0825944841f, 0.942026913f},
-std::array<float,2>{0.878354728f, 0.291538924f},
-std::array<float,2>{0.0778141692f, 0.116463229f},
-std::array<float,2>{0.903365672f, 0.722146094f},
-std::array<float,2>{0.36762318f, 0.993489206f},
-std::array<float,2>{0.539102077f, 0.258575916f},
-std::array<float,2>{0.399286032f, 0.413546026f},
-std::array<float,2>{0.644222796f, 0.766051352f},
-std::array<float,2>{0.154558331f, 0.50011462f},
-std::array<float,2>{0.761952102f, 0.145505741f},
-std::array<float,2>{0.207456768f, 0.324944854f},
-std::array<float,2>{0.826704443f, 0.91945529f},
-std::array<float,2>{0.478244692f, 0.646383107f},
-std::array<float,2>{0.710552454f, 0.0256077573f},
-std::array<float,2>{0.304105014f, 0.220695838f},
-std::array<float,2>{0.610094011f, 0.59512794f},
-std::array<float,2>{0.0383348763f, 0.827960134f},
-std::array<float,2>{0.998717189f, 0.482328296f},
-std::array<float,2>{0.177080035f, 0.187378466f},
-std::array<float,2>{0.807932854f, 0.541204989f},
-std::array<float,2>{0.43683973f, 0.80871129f},
-std::array<float,2>{0.665444493f, 0.397991478f},
-std::array<float,2>{0.325064391f, 0.298074991f},
-std::array<float,2>{0.502064764f, 0.966667473f},
-std::array<float,2>{0.118541375f, 0.69902283f},
-std::array<float,2>{0.926140249f, 0.0759475678f},
-std::array<float,2>{0.00568174152f, 0.451415211f},
-std::array<float,2>{0.951395988f, 0.871398449f},
-std::array<float,2>{0.263154924f, 0.583139181f},
-std::array<float,2>{0.577415228f, 0.199120075f},
-std::array<float,2>{0.460115403f, 0.0591731258f},
-std::array<float,2>{0.723241448f, 0.675377429f},
-std::array<float,2>{0.223064616f, 0.890740991f},
-std::array<float,2>{0.872608781f, 0.372049361f},
-std::array<float,2>{0.163012192f, 0.047574155f},
-std::array<float,2>{0.785291195f, 0.681145847f},
-std::array<float,2>{0.418447107f, 0.90497005f},
-std::array<float,2>{0.673618257f, 0.360466927f},
-std::array<float,2>{0.333946973f, 0.441053808f},
-std::array<float,2>{0.521784067f, 0.865143716f},
-std::array<float,2>{0.0970143974f, 0.5869807f},
-std::array<float,2>{0.913604856f, 0.189406067f},
-std::array<float,2>{0.0205608886f, 0.311291844f},
-std::array<float,2>{0.966115594f, 0.954489172f},
-std::array<float,2>{0.272671372f, 0.689405262f},
-std::array<float,2>{0.583541989f, 0.0636830777f},
-std::array<float,2>{0.445256203f, 0.17819421f},
-std::array<float,2>{0.741729915f, 0.537803888f},
-std::array<float,2>{0.234565035f, 0.798805952f},
-std::array<float,2>{0.847675264f, 0.401459992f},
-std::array<float,2>{0.0788542032f, 0.229953125f},
-std::array<float,2>{0.879251897f, 0.608533382f},
-std::array<float,2>{0.355711699f, 0.819189787f},
-std::array<float,2>{0.547737122f, 0.473604649f},
-std::array<float,2>{0.375323147f, 0.317719549f},
-std::array<float,2>{0.640589833f, 0.913659811f},
-std::array<float,2>{0.135736421f, 0.654361367f},
-std::array<float,2>{0.769221246f, 0.0212998185f},
-std::array<float,2>{0.19853881f, 0.418427944f},
-std::array<float,2>{0.838796258f, 0.77908349f},
-std::array<float,2>{0.489023417f, 0.515466571f},
-std::array<float,2>{0.692424297f, 0.148627385f},
-std::array<float,2>{0.295713067f, 0.123019822f},
-std::array<float,2>{0.602851391f, 0.733729124f},
-std::array<float,2>{0.0508481041f, 0.985716343f},
-std::array<float,2>{0.974678457f, 0.25243181f},
-std::array<float,2>{0.0322181173f, 0.0817179605f},
-std::array<float,2>{0.99244827f, 0.707520008f},
-std::array<float,2>{0.30009979f, 0.948246777f},
-std::array<float,2>{0.613427997f, 0.285671383f},
-std::array<float,2>{0.481976092f, 0.37918964f},
-std::array<float,2>{0.703864992f, 0.793200672f},
-std::array<float,2>{0.205968261f, 0.550104618f},
-std::array<float,2>{0.822339296f, 0.161087364f},
-std::array<float,2>{0.150370345f, 0.345073402f},
-std::array<float,2>{0.759774566f, 0.87858516f},
-std::array<float,2>{0.405471176f, 0.669439912f},
-std::array<float,2>{0.645233631f, 0.0333800316f},
-std::array<float,2>{0.372427076f, 0.208623618f},
-std::array<float,2>{0.544490218f, 0.562799633f},
-std::array<float,2>{0.0720660836f, 0.849617541f},
-std::array<float,2>{0.901150703f, 0.456648767f},
-std::array<float,2>{0.219485655f, 0.136385694f},
-std::array<float,2>{0.868447006f, 0.521417558f},
-std::array<float,2>{0.453233808f, 0.75041759f},
-std::array<float,2>{0.720258117f, 0.432916105f},
-std::array<float,2>{0.259013116f, 0.276345521f},
-std::array<float,2>{0.570573509f, 0.982180357f},
-std::array<float,2>{0.0037903497f, 0.744434297f},
-std::array<float,2>{0.947662175f, 0.106178947f},
-std::array<float,2>{0.124889128f, 0.494077116f},
-std::array<float,2>{0.922025025f, 0.837960601f},
-std::array<float,2>{0.322743058f, 0.614476204f},
-std::array<float,2>{0.505268395f, 0.240021944f},
-std::array<float,2>{0.432576269f, 0.00906827394f},
-std::array<float,2>{0.669308543f, 0.625824094f},
-std::array<float,2>{0.172380283f, 0.926762223f},
-std::array<float,2>{0.812405109f, 0.340079516f},
-std::array<float,2>{0.21178852f, 0.0945179909f},
-std::array<float,2>{0.818220437f, 0.74141264f},
-std::array<float,2>{0.470572174f, 0.975810409f},
-std::array<float,2>{0.715935886f, 0.27247563f},
-std::array<float,2>{0.31116423f, 0.422039509f},
-std::array<float,2>{0.620129347f, 0.761805713f},
-std::array<float,2>{0.0404442735f, 0.527471423f},
-std::array<float,2>{0.988167822f, 0.126507074f},
-std::array<float,2>{0.0667463765f, 0.330602616f},
-std::array<float,2>{0.892540455f, 0.932535529f},
-std::array<float,2>{0.36395666f, 0.636938393f},
-std::array<float,2>{0.534574032f, 0.0037696294f},
-std::array<float,2>{0.391973346f, 0.244073391f},
-std::array<float,2>{0.652238846f, 0.623279691f},
-std::array<float,2>{0.145202443f, 0.830904901f},
-std::array<float,2>{0.753825128f, 0.486583978f},
-std::array<float,2>{0.0153426798f, 0.166442662f},
-std::array<float,2>{0.940408945f, 0.555516481f},
-std::array<float,2>{0.252590984f, 0.78249234f},
-std::array<float,2>{0.564510465f, 0.387055278f},
-std::array<float,2>{0.468230456f, 0.296509385f},
-std::array<float,2>{0.731188655f, 0.939516723f},
-std::array<float,2>{0.232042328f, 0.714622259f},
-std::array<float,2>{0.862385511f, 0.0884504691f},
-std::array<float,2>{0.186873093f, 0.462634385f},
-std::array<float,2>{0.803194165f, 0.855994463f},
-std::array<float,2>{0.427819252f, 0.571798205f},
-std::array<float,2>{0.657336116f, 0.214494258f},
-std::array<float,2>{0.313140452f, 0.0450784639f},
-std::array<float,2>{0.513667881f, 0.657281756f},
-std::array<float,2>{0.114095867f, 0.887769699f},
-std::array<float,2>{0.931023419f, 0.353812665f},
-std::array<float,2>{0.109239444f, 0.0292780958f},
-std::array<float,2>{0.916302621f, 0.644099891f},
-std::array<float,2>{0.339116395f, 0.91479677f},
-std::array<float,2>{0.526487172f, 0.322293311f},
-std::array<float,2>{0.412191659f, 0.479313344f},
-std::array<float,2>{0.68747437f, 0.823328912f},
-std::array<float,2>{0.16428788f, 0.598460972f},
-std::array<float,2>{0.795923293f, 0.226048529f},
-std::array<float,2>{0.247005746f, 0.263774753f},
-std::array<float,2>{0.857729375f, 0.996621072f},
-std::array<float,2>{0.449809581f, 0.725362778f},
-std::array<float,2>{0.745862782f, 0.112356752f},
-std::array<float,2>{0.275429904f, 0.142098844f},
-std::array<float,2>{0.591750026f, 0.505993307f},
-std::array<float,2>{0.0236131158f, 0.770969212f},
-std::array<float,2>{0.954373062f, 0.407831311f},
-std::array<float,2>{0.129114434f, 0.202266574f},
-std::array<float,2>{0.781010032f, 0.579528689f},
-std::array<float,2>{0.383986831f, 0.867283165f},
-std::array<float,2>{0.631534278f, 0.449153394f},
-std::array<float,2>{0.346639842f, 0.367216647f},
-std::array<float,2>{0.557796836f, 0.895750105f},
-std::array<float,2>{0.0929394588f, 0.678265214f},
-std::array<float,2>{0.886165977f, 0.0562592037f},
-std::array<float,2>{0.0618339628f, 0.393295377f},
-std::array<float,2>{0.982421219f, 0.806562364f},
-std::array<float,2>{0.288038284f, 0.545443952f},
-std::array<float,2>{0.594463944f, 0.183511764f},
-std::array<float,2>{0.496480435f, 0.0738702938f},
-std::array<float,2>{0.697532952f, 0.70036757f},
-std::array<float,2>{0.188060343f, 0.962328613f},
-std::array<float,2>{0.833770812f, 0.303037018f},
-std::array<float,2>{0.182419926f, 0.120673724f},
-std::array<float,2>{0.797655165f, 0.726913035f},
-std::array<float,2>{0.422088057f, 0.992017388f},
-std::array<float,2>{0.663496673f, 0.255429775f},
-std::array<float,2>{0.317027003f, 0.41742745f},
-std::array<float,2>{0.511476576f, 0.773970366f},
-std::array<float,2>{0.112377316f, 0.508232236f},
-std::array<float,2>{0.9362849f, 0.154874235f},
-std::array<float,2>{0.00964371301f, 0.314544141f},
-std::array<float,2>{0.941630363f, 0.909324706f},
-std::array<float,2>{0.254685372f, 0.649829745f},
-std::array<float,2>{0.567366481f, 0.0165763721f},
-std::array<float,2>{0.46358186f, 0.232793391f},
-std::array<float,2>{0.729818583f, 0.603545189f},
-std::array<float,2>{0.229270577f, 0.813205719f},
-std::array<float,2>{0.864721417f, 0.471230239f},
-std::array<float,2>{0.064070642f, 0.173001304f},
-std::array<float,2>{0.895864367f, 0.534834087f},
-std::array<float,2>{0.36127466f, 0.804003358f},
-std::array<float,2>{0.537648976f, 0.40514937f},
-std::array<float,2>{0.39824748f, 0.307550967f},
-std::array<float,2>{0.653724253f, 0.958754957f},
-std::array<float,2>{0.141796663f, 0.6938802f},
-std::array<float,2>{0.757190824f, 0.0665335283f},
-std::array<float,2>{0.216925159f, 0.444229573f},
-std::array<float,2>{0.814709544f, 0.862155259f},
-std::array<float,2>{0.47475493f, 0.589969933f},
-std::array<float,2>{0.714059711f, 0.194288924f},
-std::array<float,2>{0.307142228f, 0.0518772826f},
-std::array<float,2>{0.622179329f, 0.683965325f},
-std::array<float,2>{0.0440706983f, 0.900504053f},
-std::array<float,2>{0.989972532f, 0.366437435f},
-std::array<float,2>{0.0564241372f, 0.0141232871f},
-std::array<float,2>{0.980183303f, 0.63111341f},
-std::array<float,2>{0.283844978f, 0.922944665f},
-std::array<float,2>{0.599702418f, 0.336241692f},
-std::array<float,2>{0.493052691f, 0.498165637f},
-std::array<float,2>{0.699593663f, 0.843155742f},
-std::array<float,2>{0.194857806f, 0.610889435f},
-std::array<float,2>{0.83033973f, 0.235849649f},
-std::array<float,2>{0.125911474f, 0.277925342f},
-std::array<float,2>{0.776000738f, 0.978300035f},
-std::array<float,2>{0.389235735f, 0.749090254f},
-std::array<float,2>{0.627151251f, 0.104455456f},
-std::array<float,2>{0.35150215f, 0.140547648f},
-std::array<float,2>{0.562365055f, 0.518791854f},
-std::array<float,2>{0.0882047862f, 0.75409019f},
-std::array<float,2>{0.887245774f, 0.434617221f},
-std::array<float,2>{0.244839624f, 0.206731036f},
-std::array<float,2>{0.851623535f, 0.569979548f},
-std::array<float,2>{0.445780098f, 0.844275951f},
-std::array<float,2>{0.749565959f, 0.460481465f},
-std::array<float,2>{0.280525595f, 0.34906438f},
-std::array<float,2>{0.587353408f, 0.881749272f},
-std::array<float,2>{0.0307097137f, 0.66471535f},
-std::array<float,2>{0.957863212f, 0.0389311016f},
-std::array<float,2>{0.104677789f, 0.378499031f},
-std::array<float,2>{0.920175254f, 0.789588034f},
-std::array<float,2>{0.342532247f, 0.554390192f},
-std::array<float,2>{0.52932018f, 0.157618582f},
-std::array<float,2>{0.409207374f, 0.0839335322f},
-std::array<float,2>{0.682758272f, 0.70664084f},
-std::array<float,2>{0.170071363f, 0.952069581f},
-std::array<float,2>{0.79045552f, 0.282999307f},
-std::array<float,2>{0.201113209f, 0.0403778963f},
-std::array<float,2>{0.840255141f, 0.660788774f},
-std::array<float,2>{0.485050976f, 0.884389222f},
-std::array<float,2>{0.690876126f, 0.358134985f},
-std::array<float,2>{0.292235106f, 0.465848953f},
-std::array<float,2>{0.609042287f, 0.853214562f},
-std::array<float,2>{0.0507345051f, 0.575191677f},
-std::array<float,2>{0.97211051f, 0.217502743f},
-std::array<float,2>{0.084261097f, 0.290849984f},
-std::array<float,2>{0.876590192f, 0.944428563f},
-std::array<float,2>{0.354385018f, 0.718488455f},
-std::array<float,2>{0.55421412f, 0.0900793672f},
-std::array<float,2>{0.379264772f, 0.169425875f},
-std::array<float,2>{0.633888185f, 0.559862971f},
-std::array<float,2>{0.138665691f, 0.788473189f},
-std::array<float,2>{0.770034552f, 0.38461417f},
-std::array<float,2>{0.0186622608f, 0.249167845f},
-std::array<float,2>{0.963555157f, 0.619210303f},
-std::array<float,2>{0.26878491f, 0.83416754f},
-std::array<float,2>{0.581114709f, 0.491402686f},
-std::array<float,2>{0.437776446f, 0.335559785f},
-std::array<float,2>{0.734862864f, 0.934204459f},
-std::array<float,2>{0.241830215f, 0.633512199f},
-std::array<float,2>{0.846217513f, 0.00750500988f},
-std::array<float,2>{0.157499939f, 0.426082939f},
-std::array<float,2>{0.782254457f, 0.759076774f},
-std::array<float,2>{0.417022794f, 0.52371943f},
-std::array<float,2>{0.677580118f, 0.131113172f},
-std::array<float,2>{0.330600291f, 0.0983252302f},
-std::array<float,2>{0.51606971f, 0.738030672f},
-std::array<float,2>{0.0996563733f, 0.96937871f},
-std::array<float,2>{0.909025311f, 0.268910766f},
-std::array<float,2>{0.120444402f, 0.0775773376f},
-std::array<float,2>{0.929516077f, 0.69559902f},
-std::array<float,2>{0.327823222f, 0.967331767f},
-std::array<float,2>{0.50173831f, 0.300360709f},
-std::array<float,2>{0.434694052f, 0.394988388f},
-std::array<float,2>{0.667734504f, 0.811215639f},
-std::array<float,2>{0.177915022f, 0.540131748f},
-std::array<float,2>{0.805803299f, 0.183824033f},
-std::array<float,2>{0.225359276f, 0.374590933f},
-std::array<float,2>{0.874488533f, 0.893666863f},
-std::array<float,2>{0.457631588f, 0.67361629f},
-std::array<float,2>{0.725413978f, 0.0620685257f},
-std::array<float,2>{0.265161335f, 0.196133822f},
-std::array<float,2>{0.574676692f, 0.584230602f},
-std::array<float,2>{0.00664017117f, 0.873114765f},
-std::array<float,2>{0.949944198f, 0.451098442f},
-std::array<float,2>{0.152548969f, 0.148361713f},
-std::array<float,2>{0.764020562f, 0.503698587f},
-std::array<float,2>{0.40109095f, 0.768798828f},
-std::array<float,2>{0.642035723f, 0.411248684f},
-std::array<float,2>{0.370570928f, 0.260539681f},
-std::array<float,2>{0.541977465f, 0.994282961f},
-std::array<float,2>{0.0758894905f, 0.719664454f},
-std::array<float,2>{0.905171216f, 0.114040263f},
-std::array<float,2>{0.0365539975f, 0.483991474f},
-std::array<float,2>{0.997321546f, 0.824937761f},
-std::array<float,2>{0.300864756f, 0.597336829f},
-std::array<float,2>{0.611446261f, 0.221288294f},
-std::array<float,2>{0.479607463f, 0.0244062729f},
-std::array<float,2>{0.70744437f, 0.646704435f},
-std::array<float,2>{0.209410861f, 0.921619833f},
-std::array<float,2>{0.825674057f, 0.327516317f},
-std::array<float,2>{0.13436915f, 0.0218202919f},
-std::array<float,2>{0.76633507f, 0.653724432f},
-std::array<float,2>{0.378872275f, 0.911354363f},
-std::array<float,2>{0.637384653f, 0.318474799f},
-std::array<float,2>{0.35749504f, 0.475446045f},
-std::array<float,2>{0.548975706f, 0.818297386f},
-std::array<float,2>{0.0818691999f, 0.606662989f},
-std::array<float,2>{0.88138175f, 0.227567568f},
-std::array<float,2>{0.0541638024f, 0.250223339f},
-std::array<float,2>{0.974519253f, 0.988092661f},
-std::array<float,2>{0.294564843f, 0.73101598f},
-std::array<float,2>{0.603678882f, 0.123784944f},
-std::array<float,2>{0.490825772f, 0.151756674f},
-std::array<float,2>{0.693842888f, 0.512431741f},
-std::array<float,2>{0.195824698f, 0.779438615f},
-std::array<float,2>{0.836800039f, 0.421663016f},
-std::array<float,2>{0.0954161659f, 0.190123528f},
-std::array<float,2>{0.910615325f, 0.588492692f},
-std::array<float,2>{0.335621238f, 0.866928458f},
-std::array<float,2>{0.521005273f, 0.43892473f},
-std::array<float,2>{0.419949085f, 0.36194846f},
-std::array<float,2>{0.675181925f, 0.902875185f},
-std::array<float,2>{0.161813825f, 0.683343053f},
-std::array<float,2>{0.788859487f, 0.0497654714f},
-std::array<float,2>{0.236874461f, 0.400213748f},
-std::array<float,2>{0.850370407f, 0.799009562f},
-std::array<float,2>{0.442576617f, 0.535663307f},
-std::array<float,2>{0.739454329f, 0.177716762f},
-std::array<float,2>{0.269760579f, 0.0655243024f},
-std::array<float,2>{0.585710585f, 0.690744579f},
-std::array<float,2>{0.0226492807f, 0.955265045f},
-std::array<float,2>{0.967371464f, 0.308776826f},
-std::array<float,2>{0.000557785504f, 0.108693063f},
-std::array<float,2>{0.947015762f, 0.743894696f},
-std::array<float,2>{0.260702521f, 0.983318448f},
-std::array<float,2>{0.572842836f, 0.273476839f},
-std::array<float,2>{0.455710948f, 0.429986686f},
-std::array<float,2>{0.721610546f, 0.7529248f},
-std::array<float,2>{0.222050637f, 0.522000909f},
-std::array<float,2>{0.870465815f, 0.133483395f},
-std::array<float,2>{0.174938872f, 0.343688637f},
-std::array<float,2>{0.810184419f, 0.92812717f},
-std::array<float,2>{0.429742694f, 0.62842083f},
-std::array<float,2>{0.669978559f, 0.0114382626f},
-std::array<float,2>{0.320365697f, 0.242147297f},
-std::array<float,2>{0.506988823f, 0.615282178f},
-std::array<float,2>{0.122311637f, 0.836862624f},
-std::array<float,2>{0.92545855f, 0.496072471f},
-std::array<float,2>{0.204937145f, 0.162132204f},
-std::array<float,2>{0.821620166f, 0.547145367f},
-std::array<float,2>{0.484017044f, 0.796666503f},
-std::array<float,2>{0.705681443f, 0.381878257f},
-std::array<float,2>{0.29769069f, 0.287543058f},
-std::array<float,2>{0.615455151f, 0.946426988f},
-std::array<float,2>{0.0342778638f, 0.71033138f},
-std::array<float,2>{0.995106161f, 0.0799848661f},
-std::array<float,2>{0.0739072934f, 0.454867423f},
-std::array<float,2>{0.900116265f, 0.84878248f},
-std::array<float,2>{0.374192208f, 0.566124201f},
-std::array<float,2>{0.545193732f, 0.209990233f},
-std::array<float,2>{0.40255183f, 0.0319397226f},
-std::array<float,2>{0.647948086f, 0.671815515f},
-std::array<float,2>{0.151137292f, 0.876621306f},
-std::array<float,2>{0.758825004f, 0.347047746f},
-std::array<float,2>{0.232748479f, 0.0876489952f},
-std::array<float,2>{0.860404372f, 0.712201118f},
-std::array<float,2>{0.465578765f, 0.939269364f},
-std::array<float,2>{0.732596755f, 0.293096602f},
-std::array<float,2>{0.250392944f, 0.389856666f},
-std::array<float,2>{0.563360035f, 0.784984946f},
-std::array<float,2>{0.0120167527f, 0.557482123f},
-std::array<float,2>{0.937648952f, 0.164863944f},
-std::array<float,2>{0.116128065f, 0.35235855f},
-std::array<float,2>{0.932099521f, 0.890226662f},
-std::array<float,2>{0.314836442f, 0.659438014f},
-std::array<float,2>{0.513936579f, 0.0447714143f},
-std::array<float,2>{0.427585006f, 0.211136535f},
-std::array<float,2>{0.658409894f, 0.572925091f},
-std::array<float,2>{0.184925899f, 0.859137475f},
-std::array<float,2>{0.801982999f, 0.464072853f},
-std::array<float,2>{0.0414197929f, 0.128091007f},
-std::array<float,2>{0.985798895f, 0.529708505f},
-std::array<float,2>{0.30995661f, 0.765112042f},
-std::array<float,2>{0.617319226f, 0.424161732f},
-std::array<float,2>{0.470816493f, 0.270670444f},
-std::array<float,2>{0.717044294f, 0.972851515f},
-std::array<float,2>{0.213970676f, 0.738367021f},
-std::array<float,2>{0.818433762f, 0.0968753397f},
-std::array<float,2>{0.147500366f, 0.486324012f},
-std::array<float,2>{0.750110686f, 0.828913748f},
-std::array<float,2>{0.393912047f, 0.621329665f},
-std::array<float,2>{0.649583161f, 0.244888023f},
-std::array<float,2>{0.365524977f, 0.00185615965f},
-std::array<float,2>{0.532881379f, 0.639973998f},
-std::array<float,2>{0.0693793744f, 0.929865122f},
-std::array<float,2>{0.892974615f, 0.328919917f},
-std::array<float,2>{0.0915764496f, 0.0580146573f},
-std::array<float,2>{0.884589672f, 0.677152753f},
-std::array<float,2>{0.344135612f, 0.897173762f},
-std::array<float,2>{0.555544198f, 0.370134592f},
-std::array<float,2>{0.385418624f, 0.446298093f},
-std::array<float,2>{0.629059494f, 0.869467854f},
-std::array<float,2>{0.131777868f, 0.580204606f},
-std::array<float,2>{0.777944267f, 0.201025829f},
-std::array<float,2>{0.189707905f, 0.30150345f},
-std::array<float,2>{0.835376918f, 0.964807749f},
-std::array<float,2>{0.499408275f, 0.7029441f},
-std::array<float,2>{0.695558488f, 0.0711319596f},
-std::array<float,2>{0.285583109f, 0.181578144f},
-std::array<float,2>{0.595985055f, 0.544889688f},
-std::array<float,2>{0.0587198883f, 0.808580935f},
-std::array<float,2>{0.982606769f, 0.390870929f},
-std::array<float,2>{0.167799234f, 0.22340703f},
-std::array<float,2>{0.793473601f, 0.601391733f},
-std::array<float,2>{0.411637694f, 0.822172523f},
-std::array<float,2>{0.685021996f, 0.477418512f},
-std::array<float,2>{0.337840229f, 0.321242183f},
-std::array<float,2>{0.523589432f, 0.916987419f},
-std::array<float,2>{0.105745859f, 0.641520977f},
-std::array<float,2>{0.91533792f, 0.0312224608f},
-std::array<float,2>{0.0254487768f, 0.409816563f},
-std::array<float,2>{0.955140233f, 0.772759974f},
-std::array<float,2>{0.274134696f, 0.505583107f},
-std::array<float,2>{0.592827141f, 0.142741904f},
-std::array<float,2>{0.45193243f, 0.109895341f},
-std::array<float,2>{0.743170798f, 0.724530995f},
-std::array<float,2>{0.248951375f, 0.998097003f},
-std::array<float,2>{0.855987787f, 0.262026876f},
-std::array<float,2>{0.171578884f, 0.0842071027f},
-std::array<float,2>{0.789649665f, 0.703753948f},
-std::array<float,2>{0.408853799f, 0.950093627f},
-std::array<float,2>{0.682001412f, 0.283287257f},
-std::array<float,2>{0.34298557f, 0.375952125f},
-std::array<float,2>{0.53027916f, 0.791801035f},
-std::array<float,2>{0.103833437f, 0.552718997f},
-std::array<float,2>{0.921704471f, 0.15978761f},
-std::array<float,2>{0.0301514659f, 0.35051164f},
-std::array<float,2>{0.958071828f, 0.879580259f},
-std::array<float,2>{0.279472023f, 0.667702317f},
-std::array<float,2>{0.586214423f, 0.0360738523f},
-std::array<float,2>{0.446461231f, 0.203849912f},
-std::array<float,2>{0.748362899f, 0.566559196f},
-std::array<float,2>{0.245874614f, 0.846554935f},
-std::array<float,2>{0.852660894f, 0.457045317f},
-std::array<float,2>{0.0892936811f, 0.137415275f},
-std::array<float,2>{0.888320506f, 0.516203105f},
-std::array<float,2>{0.35034743f, 0.757692039f},
-std::array<float,2>{0.560801864f, 0.436644316f},
-std::array<float,2>{0.390301049f, 0.279479325f},
-std::array<float,2>{0.628205895f, 0.980041504f},
-std::array<float,2>{0.126941904f, 0.746522784f},
-std::array<float,2>{0.777231932f, 0.101922587f},
-std::array<float,2>{0.193845093f, 0.49649933f},
-std::array<float,2>{0.831489623f, 0.841096699f},
-std::array<float,2>{0.493965507f, 0.611765444f},
-std::array<float,2>{0.701075196f, 0.237673953f},
-std::array<float,2>{0.284310341f, 0.0133071793f},
-std::array<float,2>{0.600588202f, 0.630155861f},
-std::array<float,2>{0.0547677577f, 0.924493194f},
-std::array<float,2>{0.979464233f, 0.338796437f},
-std::array<float,2>{0.0437108353f, 0.0535566434f},
-std::array<float,2>{0.988364279f, 0.686653495f},
-std::array<float,2>{0.308114707f, 0.899478376f},
-std::array<float,2>{0.621670246f, 0.363737702f},
-std::array<float,2>{0.476348191f, 0.442860126f},
-std::array<float,2>{0.71347028f, 0.859917521f},
-std::array<float,2>{0.218720838f, 0.59265095f},
-std::array<float,2>{0.815995812f, 0.192813471f},
-std::array<float,2>{0.14062731f, 0.306345999f},
-std::array<float,2>{0.756251931f, 0.960073769f},
-std::array<float,2>{0.397129059f, 0.692536414f},
-std::array<float,2>{0.653310239f, 0.0702419952f},
-std::array<float,2>{0.360083759f, 0.175295576f},
-std::array<float,2>{0.5384776f, 0.532958508f},
-std::array<float,2>{0.0626470447f, 0.801875293f},
-std::array<float,2>{0.895023227f, 0.402403563f},
-std::array<float,2>{0.229959697f, 0.232325882f},
-std::array<float,2>{0.864037216f, 0.603194952f},
-std::array<float,2>{0.464671344f, 0.816142857f},
-std::array<float,2>{0.729190528f, 0.469619095f},
-std::array<float,2>{0.25515759f, 0.313378066f},
-std::array<float,2>{0.567676008f, 0.907843053f},
-std::array<float,2>{0.00795951951f, 0.651344657f},
-std::array<float,2>{0.942626715f, 0.018597085f},
-std::array<float,2>{0.111763798f, 0.41542533f},
-std::array<float,2>{0.936992407f, 0.777125835f},
-std::array<float,2>{0.31765902f, 0.51146394f},
-std::array<float,2>{0.510484159f, 0.153012887f},
-std::array<float,2>{0.423319727f, 0.117274329f},
-std::array<float,2>{0.662443757f, 0.72928226f},
-std::array<float,2>{0.182894513f, 0.988523424f},
-std::array<float,2>{0.798450112f, 0.257676363f},
-std::array<float,2>{0.21011278f, 0.0264427252f},
-std::array<float,2>{0.824688494f, 0.645121813f},
-std::array<float,2>{0.479200661f, 0.918471873f},
-std::array<float,2>{0.708034337f, 0.325794876f},
-std::array<float,2>{0.30223012f, 0.481350571f},
-std::array<float,2>{0.612409472f, 0.826201916f},
-std::array<float,2>{0.035213571f, 0.594691753f},
-std::array<float,2>{0.997021914f, 0.219626337f},
-std::array<float,2>{0.0742494836f, 0.259682834f},
-std::array<float,2>{0.905386806f, 0.992497206f},
-std::array<float,2>{0.3692379f, 0.721435547f},
-std::array<float,2>{0.542480886f, 0.115406208f},
-std::array<float,2>{0.401693135f, 0.146253988f},
-std::array<float,2>{0.641282439f, 0.501507759f},
-std::array<float,2>{0.153933555f, 0.767093182f},
-std::array<float,2>{0.765496135f, 0.41262728f},
-std::array<float,2>{0.00694825361f, 0.197636068f},
-std::array<float,2>{0.950632155f, 0.582952738f},
-std::array<float,2>{0.264619797f, 0.872973979f},
-std::array<float,2>{0.575604022f, 0.452428162f},
-std::array<float,2>{0.458498359f, 0.372929752f},
-std::array<float,2>{0.726191342f, 0.892326295f},
-std::array<float,2>{0.226022884f, 0.674652457f},
-std::array<float,2>{0.873557687f, 0.0603950284f},
-std::array<float,2>{0.178858846f, 0.396637917f},
-std::array<float,2>{0.804859281f, 0.80965364f},
-std::array<float,2>{0.434508353f, 0.5424909f},
-std::array<float,2>{0.666459024f, 0.185943857f},
-std::array<float,2>{0.326563895f, 0.0747582689f},
-std::array<float,2>{0.50009948f, 0.697406292f},
-std::array<float,2>{0.120114341f, 0.965246975f},
-std::array<float,2>{0.928375602f, 0.297348589f},
-std::array<float,2>{0.101432599f, 0.0997177809f},
-std::array<float,2>{0.909965217f, 0.734431446f},
-std::array<float,2>{0.331764728f, 0.972236633f},
-std::array<float,2>{0.517387331f, 0.267220765f},
-std::array<float,2>{0.416030824f, 0.428254575f},
-std::array<float,2>{0.676287115f, 0.761372149f},
-std::array<float,2>{0.157148987f, 0.525460899f},
-std::array<float,2>{0.78206414f, 0.129908949f},
-std::array<float,2>{0.240775779f, 0.332038403f},
-std::array<float,2>{0.84674418f, 0.935915112f},
-std::array<float,2>{0.439091086f, 0.635537326f},
-std::array<float,2>{0.735856354f, 0.00446354318f},
-std::array<float,2>{0.267830163f, 0.246635973f},
-std::array<float,2>{0.580154479f, 0.617698729f},
-std::array<float,2>{0.0181043837f, 0.832566559f},
-std::array<float,2>{0.964289069f, 0.489568204f},
-std::array<float,2>{0.136800572f, 0.171637774f},
-std::array<float,2>{0.770848393f, 0.56077832f},
-std::array<float,2>{0.380183816f, 0.785452545f},
-std::array<float,2>{0.633719921f, 0.385194927f},
-std::array<float,2>{0.355375558f, 0.292664677f},
-std::array<float,2>{0.55305618f, 0.942923069f},
-std::array<float,2>{0.0857974887f, 0.714935958f},
-std::array<float,2>{0.875919461f, 0.0932003111f},
-std::array<float,2>{0.0495180339f, 0.466854185f},
-std::array<float,2>{0.971583068f, 0.854411125f},
-std::array<float,2>{0.291568786f, 0.57703346f},
-std::array<float,2>{0.608281851f, 0.215787709f},
-std::array<float,2>{0.485575974f, 0.0428306758f},
-std::array<float,2>{0.689745486f, 0.664025962f},
-std::array<float,2>{0.199337587f, 0.88648659f},
-std::array<float,2>{0.840922892f, 0.355862856f},
-std::array<float,2>{0.152206689f, 0.0344366357f},
-std::array<float,2>{0.758000493f, 0.668703258f},
-std::array<float,2>{0.403326303f, 0.877545059f},
-std::array<float,2>{0.646559f, 0.344430596f},
-std::array<float,2>{0.373838395f, 0.455154061f},
-std::array<float,2>{0.546316504f, 0.850713015f},
-std::array<float,2>{0.0723998174f, 0.563545823f},
-std::array<float,2>{0.899070203f, 0.207637608f},
-std::array<float,2>{0.0332439467f, 0.286578417f},
-std::array<float,2>{0.99567318f, 0.947299361f},
-std::array<float,2>{0.29791972f, 0.708604395f},
-std::array<float,2>{0.616918385f, 0.0808889121f},
-std::array<float,2>{0.483225733f, 0.161877811f},
-std::array<float,2>{0.706231475f, 0.549465835f},
-std::array<float,2>{0.20344241f, 0.79439646f},
-std::array<float,2>{0.820654392f, 0.379988551f},
-std::array<float,2>{0.121532395f, 0.239203766f},
-std::array<float,2>{0.924619794f, 0.613404572f},
-std::array<float,2>{0.322220594f, 0.839537799f},
-std::array<float,2>{0.505935788f, 0.492286444f},
-std::array<float,2>{0.430921942f, 0.34152931f},
-std::array<float,2>{0.671355247f, 0.926028609f},
-std::array<float,2>{0.174432695f, 0.626021385f},
-std::array<float,2>{0.809137881f, 0.00811485481f},
-std::array<float,2>{0.220813394f, 0.431723118f},
-std::array<float,2>{0.869752586f, 0.751503706f},
-std::array<float,2>{0.457029521f, 0.519656539f},
-std::array<float,2>{0.721714973f, 0.134964719f},
-std::array<float,2>{0.26150158f, 0.106548607f},
-std::array<float,2>{0.573889375f, 0.74573791f},
-std::array<float,2>{0.00173909171f, 0.98079133f},
-std::array<float,2>{0.945868552f, 0.277215749f},
-std::array<float,2>{0.0221427567f, 0.0631488711f},
-std::array<float,2>{0.967874408f, 0.688468099f},
-std::array<float,2>{0.271462649f, 0.953215361f},
-std::array<float,2>{0.5845294f, 0.312444836f},
-std::array<float,2>{0.44169113f, 0.400486141f},
-std::array<float,2>{0.739252627f, 0.797460318f},
-std::array<float,2>{0.238019973f, 0.538826287f},
-std::array<float,2>{0.850970149f, 0.179492384f},
-std::array<float,2>{0.160893738f, 0.359389752f},
-std::array<float,2>{0.787638783f, 0.90542686f},
-std::array<float,2>{0.421224475f, 0.679771781f},
-std::array<float,2>{0.674121857f, 0.0480638258f},
-std::array<float,2>{0.334220737f, 0.187687695f},
-std::array<float,2>{0.519956648f, 0.586607397f},
-std::array<float,2>{0.0938832089f, 0.863311887f},
-std::array<float,2>{0.911879182f, 0.44005391f},
-std::array<float,2>{0.197017282f, 0.149661809f},
-std::array<float,2>{0.837659478f, 0.514517725f},
-std::array<float,2>{0.491455704f, 0.777879119f},
-std::array<float,2>{0.69527179f, 0.419223309f},
-std::array<float,2>{0.293271393f, 0.253370732f},
-std::array<float,2>{0.604703188f, 0.984644294f},
-std::array<float,2>{0.0529627167f, 0.733253479f},
-std::array<float,2>{0.972722828f, 0.121968277f},
-std::array<float,2>{0.0807945281f, 0.474422961f},
-std::array<float,2>{0.882094502f, 0.81970799f},
-std::array<float,2>{0.358685017f, 0.607780814f},
-std::array<float,2>{0.550744712f, 0.22877042f},
-std::array<float,2>{0.377314419f, 0.0198555421f},
-std::array<float,2>{0.637875736f, 0.656210601f},
-std::array<float,2>{0.133529454f, 0.912183881f},
-std::array<float,2>{0.767010212f, 0.316943377f},
-std::array<float,2>{0.249341622f, 0.111724883f},
-std::array<float,2>{0.857237756f, 0.726318777f},
-std::array<float,2>{0.453122675f, 0.997221172f},
-std::array<float,2>{0.742343247f, 0.264782101f},
-std::array<float,2>{0.274478287f, 0.407041818f},
-std::array<float,2>{0.59236902f, 0.769751608f},
-std::array<float,2>{0.0267097205f, 0.507624567f},
-std::array<float,2>{0.9565202f, 0.140770197f},
-std::array<float,2>{0.106909372f, 0.324118108f},
-std::array<float,2>{0.91419816f, 0.915680826f},
-std::array<float,2>{0.336520851f, 0.642754376f},
-std::array<float,2>{0.525205135f, 0.0280948691f},
-std::array<float,2>{0.410236955f, 0.224636495f},
-std::array<float,2>{0.683637679f, 0.599353611f},
-std::array<float,2>{0.166899502f, 0.822511971f},
-std::array<float,2>{0.794614673f, 0.48021251f},
-std::array<float,2>{0.0603269786f, 0.182235703f},
-std::array<float,2>{0.984081507f, 0.54605788f},
-std::array<float,2>{0.286621064f, 0.805121958f},
-std::array<float,2>{0.597128749f, 0.393784344f},
-std::array<float,2>{0.498861074f, 0.304468989f},
-std::array<float,2>{0.697037876f, 0.961403966f},
-std::array<float,2>{0.190622926f, 0.69950664f},
-std::array<float,2>{0.834060013f, 0.072333023f},
-std::array<float,2>{0.132507965f, 0.447749078f},
-std::array<float,2>{0.778892934f, 0.868818104f},
-std::array<float,2>{0.386566609f, 0.579101086f},
-std::array<float,2>{0.630723119f, 0.201473296f},
-std::array<float,2>{0.345626384f, 0.0555780642f},
-std::array<float,2>{0.556244016f, 0.678836942f},
-std::array<float,2>{0.0906299725f, 0.89543438f},
-std::array<float,2>{0.883148074f, 0.368727535f},
-std::array<float,2>{0.0689425245f, 0.00282836775f},
-std::array<float,2>{0.893614411f, 0.638068914f},
-std::array<float,2>{0.366818935f, 0.932996511f},
-std::array<float,2>{0.531757236f, 0.331359297f},
-std::array<float,2>{0.392743856f, 0.48751846f},
-std::array<float,2>{0.648585975f, 0.831991792f},
-std::array<float,2>{0.146635562f, 0.624885321f},
-std::array<float,2>{0.751736641f, 0.242982686f},
-std::array<float,2>{0.213247687f, 0.271656126f},
-std::array<float,2>{0.819913745f, 0.975059211f},
-std::array<float,2>{0.471903503f, 0.740855813f},
-std::array<float,2>{0.718666971f, 0.0956069157f},
-std::array<float,2>{0.309052199f, 0.125197589f},
-std::array<float,2>{0.618544996f, 0.528946221f},
-std::array<float,2>{0.0426065624f, 0.763288915f},
-std::array<float,2>{0.984417617f, 0.423458457f},
-std::array<float,2>{0.183684096f, 0.213783816f},
-std::array<float,2>{0.801374495f, 0.571001828f},
-std::array<float,2>{0.426507562f, 0.857062697f},
-std::array<float,2>{0.659191132f, 0.461646795f},
-std::array<float,2>{0.316168427f, 0.355460078f},
-std::array<float,2>{0.515605807f, 0.88721931f},
-std::array<float,2>{0.117051616f, 0.656796277f},
-std::array<float,2>{0.932737589f, 0.0461965129f},
-std::array<float,2>{0.0130752595f, 0.387732923f},
-std::array<float,2>{0.938954592f, 0.781445205f},
-std::array<float,2>{0.25097993f, 0.55589056f},
-std::array<float,2>{0.564137518f, 0.167103812f},
-std::array<float,2>{0.466795206f, 0.0897864699f},
-std::array<float,2>{0.7336303f, 0.713701308f},
-std::array<float,2>{0.233696967f, 0.940663874f},
-std::array<float,2>{0.860242128f, 0.295161039f},
-std::array<float,2>{0.127056658f, 0.104747191f},
-std::array<float,2>{0.774619102f, 0.748935878f},
-std::array<float,2>{0.387322992f, 0.976992726f},
-std::array<float,2>{0.625217974f, 0.279019684f},
-std::array<float,2>{0.347990215f, 0.434061497f},
-std::array<float,2>{0.559090495f, 0.755061209f},
-std::array<float,2>{0.0875576511f, 0.517996728f},
-std::array<float,2>{0.888989508f, 0.139580399f},
-std::array<float,2>{0.0583953485f, 0.337789267f},
-std::array<float,2>{0.977629662f, 0.922608972f},
-std::array<float,2>{0.281477511f, 0.632572114f},
-std::array<float,2>{0.597934365f, 0.0155489091f},
-std::array<float,2>{0.494460136f, 0.234973416f},
-std::array<float,2>{0.701797903f, 0.609381258f},
-std::array<float,2>{0.192379162f, 0.842379272f},
-std::array<float,2>{0.830045283f, 0.49991259f},
-std::array<float,2>{0.103128351f, 0.156570002f},
-std::array<float,2>{0.918713987f, 0.553581536f},
-std::array<float,2>{0.340656906f, 0.790989578f},
-std::array<float,2>{0.527953565f, 0.377782226f},
-std::array<float,2>{0.406741083f, 0.281314403f},
-std::array<float,2>{0.681280077f, 0.952158988f},
-std::array<float,2>{0.168642193f, 0.705555916f},
-std::array<float,2>{0.791193902f, 0.0820338354f},
-std::array<float,2>{0.243531033f, 0.459437817f},
-std::array<float,2>{0.853840053f, 0.844796062f},
-std::array<float,2>{0.448145956f, 0.568516493f},
-std::array<float,2>{0.746774733f, 0.205944553f},
-std::array<float,2>{0.279206634f, 0.0379725099f},
-std::array<float,2>{0.588308632f, 0.665854335f},
-std::array<float,2>{0.0286619812f, 0.882702768f},
-std::array<float,2>{0.960912526f, 0.348437637f},
-std::array<float,2>{0.0112148477f, 0.0166127738f},
-std::array<float,2>{0.9451015f, 0.649032295f},
-std::array<float,2>{0.256481826f, 0.908785582f},
-std::array<float,2>{0.56889075f, 0.315737873f},
-std::array<float,2>{0.46219486f, 0.472520053f},
-std::array<float,2>{0.727719188f, 0.814200342f},
-std::array<float,2>{0.227644295f, 0.605220914f},
-std::array<float,2>{0.866885841f, 0.233606219f},
-std::array<float,2>{0.180835649f, 0.25446558f},
-std::array<float,2>{0.799107373f, 0.990740538f},
-std::array<float,2>{0.425306082f, 0.728146493f},
-std::array<float,2>{0.661122859f, 0.120023832f},
-std::array<float,2>{0.31956476f, 0.155422226f},
-std::array<float,2>{0.507820547f, 0.509387374f},
-std::array<float,2>{0.109461263f, 0.775286257f},
-std::array<float,2>{0.935026705f, 0.416602373f},
-std::array<float,2>{0.216267258f, 0.195116654f},
-std::array<float,2>{0.813789189f, 0.591480017f},
-std::array<float,2>{0.474453658f, 0.863036394f},
-std::array<float,2>{0.712206781f, 0.444866598f},
-std::array<float,2>{0.306400418f, 0.365718544f},
-std::array<float,2>{0.623304963f, 0.902187288f},
-std::array<float,2>{0.0459331907f, 0.68515867f},
-std::array<float,2>{0.991634607f, 0.0509631559f},
-std::array<float,2>{0.0656558126f, 0.405596763f},
-std::array<float,2>{0.89697206f, 0.802753448f},
-std::array<float,2>{0.361874044f, 0.533394694f},
-std::array<float,2>{0.536271214f, 0.172085896f},
-std::array<float,2>{0.394913375f, 0.0675985664f},
-std::array<float,2>{0.655753851f, 0.694619417f},
-std::array<float,2>{0.143608615f, 0.957093775f},
-std::array<float,2>{0.755443335f, 0.30793047f},
-std::array<float,2>{0.223829046f, 0.061055664f},
-std::array<float,2>{0.87131238f, 0.672663808f},
-std::array<float,2>{0.45993343f, 0.892899156f},
-std::array<float,2>{0.72446394f, 0.373993665f},
-std::array<float,2>{0.261940747f, 0.450089455f},
-std::array<float,2>{0.576445282f, 0.874612451f},
-std::array<float,2>{0.00430970499f, 0.585674405f},
-std::array<float,2>{0.95301801f, 0.197145253f},
-std::array<float,2>{0.117357112f, 0.29938221f},
-std::array<float,2>{0.927641571f, 0.967906415f},
-std::array<float,2>{0.325818539f, 0.697237074f},
-std::array<float,2>{0.503838301f, 0.0769702643f},
-std::array<float,2>{0.436271191f, 0.185221151f},
-std::array<float,2>{0.664472103f, 0.539698601f},
-std::array<float,2>{0.176693216f, 0.811962962f},
-std::array<float,2>{0.80668515f, 0.396269828f},
-std::array<float,2>{0.0372976027f, 0.221891403f},
-std::array<float,2>{0.999761999f, 0.595850646f},
-std::array<float,2>{0.30354467f, 0.825702369f},
-std::array<float,2>{0.610759079f, 0.483177781f},
-std::array<float,2>{0.477428526f, 0.326802373f},
-std::array<float,2>{0.709419131f, 0.920294523f},
-std::array<float,2>{0.208788469f, 0.648398519f},
-std::array<float,2>{0.827679634f, 0.0249776486f},
-std::array<float,2>{0.15621388f, 0.410840809f},
-std::array<float,2>{0.762949467f, 0.768168509f},
-std::array<float,2>{0.400137067f, 0.502857924f},
-std::array<float,2>{0.64314121f, 0.146894678f},
-std::array<float,2>{0.369092971f, 0.115050808f},
-std::array<float,2>{0.540799379f, 0.720522463f},
-std::array<float,2>{0.0764353573f, 0.995206177f},
-std::array<float,2>{0.902512789f, 0.260897189f},
-std::array<float,2>{0.0838055611f, 0.0910020694f},
-std::array<float,2>{0.877083421f, 0.717733085f},
-std::array<float,2>{0.353054762f, 0.943713248f},
-std::array<float,2>{0.551466525f, 0.289085925f},
-std::array<float,2>{0.381725132f, 0.383754313f},
-std::array<float,2>{0.636655331f, 0.787119627f},
-std::array<float,2>{0.13930957f, 0.559423506f},
-std::array<float,2>{0.771735072f, 0.168654636f},
-std::array<float,2>{0.201732337f, 0.358797669f},
-std::array<float,2>{0.84182632f, 0.883595943f},
-std::array<float,2>{0.486959398f, 0.661481857f},
-std::array<float,2>{0.68799144f, 0.0394869074f},
-std::array<float,2>{0.290380955f, 0.218736768f},
-std::array<float,2>{0.606436133f, 0.575874388f},
-std::array<float,2>{0.0480952561f, 0.851755261f},
-std::array<float,2>{0.969112754f, 0.465212613f},
-std::array<float,2>{0.159476638f, 0.132218927f},
-std::array<float,2>{0.783513188f, 0.525062382f},
-std::array<float,2>{0.414209604f, 0.75817132f},
-std::array<float,2>{0.678666532f, 0.427340239f},
-std::array<float,2>{0.329974681f, 0.26817143f},
-std::array<float,2>{0.517982423f, 0.970565677f},
-std::array<float,2>{0.098881565f, 0.737151265f},
-std::array<float,2>{0.907617569f, 0.0993925333f},
-std::array<float,2>{0.0166220944f, 0.491200209f},
-std::array<float,2>{0.962569475f, 0.835471034f},
-std::array<float,2>{0.267339885f, 0.620578945f},
-std::array<float,2>{0.579016805f, 0.248905882f},
-std::array<float,2>{0.440879285f, 0.00658067456f},
-std::array<float,2>{0.736628652f, 0.634120286f},
-std::array<float,2>{0.239474282f, 0.934675395f},
-std::array<float,2>{0.843794584f, 0.334344029f},
-std::array<float,2>{0.17377463f, 0.00981732551f},
-std::array<float,2>{0.811436296f, 0.626978099f},
-std::array<float,2>{0.432942063f, 0.929088771f},
-std::array<float,2>{0.668862402f, 0.342293143f},
-std::array<float,2>{0.323260456f, 0.495036423f},
-std::array<float,2>{0.503927827f, 0.837882519f},
-std::array<float,2>{0.123357117f, 0.616664767f},
-std::array<float,2>{0.923418045f, 0.240311429f},
-std::array<float,2>{0.00246081292f, 0.274964809f},
-std::array<float,2>{0.948436201f, 0.983995259f},
-std::array<float,2>{0.258254349f, 0.74304986f},
-std::array<float,2>{0.571574628f, 0.108121961f},
-std::array<float,2>{0.454480499f, 0.134648591f},
-std::array<float,2>{0.719048679f, 0.523250163f},
-std::array<float,2>{0.220133826f, 0.753215492f},
-std::array<float,2>{0.86782527f, 0.43111065f},
-std::array<float,2>{0.070988223f, 0.209396213f},
-std::array<float,2>{0.901737392f, 0.564863622f},
-std::array<float,2>{0.371133387f, 0.84827733f},
-std::array<float,2>{0.54348278f, 0.453956634f},
-std::array<float,2>{0.405267268f, 0.346462339f},
-std::array<float,2>{0.646309495f, 0.875958443f},
-std::array<float,2>{0.148449183f, 0.670482695f},
-std::array<float,2>{0.760801315f, 0.0326917954f},
-std::array<float,2>{0.206893519f, 0.380996764f},
-std::array<float,2>{0.823814929f, 0.795612395f},
-std::array<float,2>{0.480581164f, 0.54837352f},
-std::array<float,2>{0.704964936f, 0.16314508f},
-std::array<float,2>{0.298893958f, 0.0789818689f},
-std::array<float,2>{0.614628315f, 0.709326684f},
-std::array<float,2>{0.0326518826f, 0.945615888f},
-std::array<float,2>{0.993235052f, 0.28849557f},
-std::array<float,2>{0.0521479808f, 0.124751128f},
-std::array<float,2>{0.976104975f, 0.731948972f},
-std::array<float,2>{0.296591878f, 0.986503482f},
-std::array<float,2>{0.602334559f, 0.251241475f},
-std::array<float,2>{0.489794642f, 0.420490533f},
-std::array<float,2>{0.692208946f, 0.7810601f},
-std::array<float,2>{0.198191553f, 0.513437808f},
-std::array<float,2>{0.839352489f, 0.150457308f},
-std::array<float,2>{0.136146992f, 0.319579542f},
-std::array<float,2>{0.768040538f, 0.910761714f},
-std::array<float,2>{0.376330107f, 0.65322876f},
-std::array<float,2>{0.639191806f, 0.0226334706f},
-std::array<float,2>{0.357014239f, 0.226609483f},
-std::array<float,2>{0.548591673f, 0.606169164f},
-std::array<float,2>{0.0795688331f, 0.817203641f},
-std::array<float,2>{0.880071223f, 0.476054758f},
-std::array<float,2>{0.235528916f, 0.176680058f},
-std::array<float,2>{0.848851025f, 0.536863089f},
-std::array<float,2>{0.443500131f, 0.800123334f},
-std::array<float,2>{0.740541399f, 0.398648441f},
-std::array<float,2>{0.27235809f, 0.310161203f},
-std::array<float,2>{0.582891226f, 0.95701158f},
-std::array<float,2>{0.0197295826f, 0.690418184f},
-std::array<float,2>{0.965143144f, 0.0646995679f},
-std::array<float,2>{0.0963542387f, 0.43805474f},
-std::array<float,2>{0.912868738f, 0.865339994f},
-std::array<float,2>{0.33268553f, 0.589535356f},
-std::array<float,2>{0.522842526f, 0.190937534f},
-std::array<float,2>{0.419801295f, 0.0502921119f},
-std::array<float,2>{0.672479689f, 0.68179208f},
-std::array<float,2>{0.163372293f, 0.903949022f},
-std::array<float,2>{0.786147654f, 0.362929076f},
-std::array<float,2>{0.188998207f, 0.0713584125f},
-std::array<float,2>{0.832987428f, 0.701889932f},
-std::array<float,2>{0.497528493f, 0.963840723f},
-std::array<float,2>{0.699202836f, 0.302303642f},
-std::array<float,2>{0.288684398f, 0.391844094f},
-std::array<float,2>{0.595572948f, 0.807236016f},
-std::array<float,2>{0.0612232201f, 0.543503821f},
-std::array<float,2>{0.980938613f, 0.18005833f},
-std::array<float,2>{0.0921643451f, 0.369539738f},
-std::array<float,2>{0.885125995f, 0.897521257f},
-std::array<float,2>{0.347495139f, 0.67630595f},
-std::array<float,2>{0.557561576f, 0.0573623739f},
-std::array<float,2>{0.38307184f, 0.199830279f},
-std::array<float,2>{0.632112443f, 0.581849515f},
-std::array<float,2>{0.13079612f, 0.870479465f},
-std::array<float,2>{0.779485285f, 0.446173251f},
-std::array<float,2>{0.0244503301f, 0.143590719f},
-std::array<float,2>{0.953656316f, 0.504764736f},
-std::array<float,2>{0.276509047f, 0.771664798f},
-std::array<float,2>{0.590197027f, 0.40864113f},
-std::array<float,2>{0.450560749f, 0.262708843f},
-std::array<float,2>{0.744533122f, 0.999998748f},
-std::array<float,2>{0.247098386f, 0.723187208f},
-std::array<float,2>{0.859340847f, 0.111023888f},
-std::array<float,2>{0.165576234f, 0.478078246f},
-std::array<float,2>{0.795297384f, 0.821111917f},
-std::array<float,2>{0.413387597f, 0.599719822f},
-std::array<float,2>{0.686249793f, 0.223854348f},
-std::array<float,2>{0.33875218f, 0.0297524557f},
-std::array<float,2>{0.52553165f, 0.64160192f},
-std::array<float,2>{0.108310163f, 0.917309582f},
-std::array<float,2>{0.91712147f, 0.322083592f},
-std::array<float,2>{0.114792816f, 0.0434601717f},
-std::array<float,2>{0.930653334f, 0.65839982f},
-std::array<float,2>{0.314291924f, 0.888713658f},
-std::array<float,2>{0.512071192f, 0.352763623f},
-std::array<float,2>{0.429619342f, 0.462965518f},
-std::array<float,2>{0.656696379f, 0.857987523f},
-std::array<float,2>{0.18601805f, 0.573932648f},
-std::array<float,2>{0.80398047f, 0.212076336f},
-std::array<float,2>{0.230909809f, 0.294829786f},
-std::array<float,2>{0.861525714f, 0.93783462f},
-std::array<float,2>{0.466807276f, 0.711739957f},
-std::array<float,2>{0.731717944f, 0.0867099538f},
-std::array<float,2>{0.253657192f, 0.165472701f},
-std::array<float,2>{0.565583587f, 0.558346808f},
-std::array<float,2>{0.0143843452f, 0.783205092f},
-std::array<float,2>{0.941331983f, 0.38925007f},
-std::array<float,2>{0.1457773f, 0.245619535f},
-std::array<float,2>{0.752076685f, 0.622463584f},
-std::array<float,2>{0.390861154f, 0.829859197f},
-std::array<float,2>{0.651171744f, 0.485322386f},
-std::array<float,2>{0.364267021f, 0.329796135f},
-std::array<float,2>{0.53323853f, 0.930749595f},
-std::array<float,2>{0.0679028556f, 0.639610052f},
-std::array<float,2>{0.890873134f, 0.000436167262f},
-std::array<float,2>{0.0396503694f, 0.425233871f},
-std::array<float,2>{0.987006307f, 0.763956249f},
-std::array<float,2>{0.311553031f, 0.530920804f},
-std::array<float,2>{0.619950831f, 0.127384156f},
-std::array<float,2>{0.469574183f, 0.0962055326f},
-std::array<float,2>{0.715058446f, 0.73981595f},
-std::array<float,2>{0.212690338f, 0.974183202f},
-std::array<float,2>{0.816654205f, 0.270067334f},
-std::array<float,2>{0.138730749f, 0.0936960354f},
-std::array<float,2>{0.772280753f, 0.715425014f},
-std::array<float,2>{0.380928308f, 0.942580342f},
-std::array<float,2>{0.635806501f, 0.292351723f},
-std::array<float,2>{0.353001535f, 0.385317862f},
-std::array<float,2>{0.550878942f, 0.785771191f},
-std::array<float,2>{0.0834259763f, 0.561110854f},
-std::array<float,2>{0.877600789f, 0.17104429f},
-std::array<float,2>{0.0484475344f, 0.356013328f},
-std::array<float,2>{0.969337821f, 0.88600421f},
-std::array<float,2>{0.290561229f, 0.663275361f},
-std::array<float,2>{0.605949938f, 0.0421142876f},
-std::array<float,2>{0.486504257f, 0.215063855f},
-std::array<float,2>{0.687534988f, 0.576422989f},
-std::array<float,2>{0.201549903f, 0.853755713f},
-std::array<float,2>{0.842667043f, 0.467516661f},
-std::array<float,2>{0.0995532051f, 0.130812064f},
-std::array<float,2>{0.907978475f, 0.526343167f},
-std::array<float,2>{0.329338253f, 0.760762155f},
-std::array<float,2>{0.51813513f, 0.427871913f},
-std::array<float,2>{0.414824784f, 0.26671949f},
-std::array<float,2>{0.677849591f, 0.971927285f},
-std::array<float,2>{0.160039693f, 0.734972596f},
-std::array<float,2>{0.783716798f, 0.100485004f},
-std::array<float,2>{0.24007012f, 0.490000933f},
-std::array<float,2>{0.844560862f, 0.83243835f},
-std::array<float,2>{0.441023946f, 0.617379963f},
-std::array<float,2>{0.737181842f, 0.246143058f},
-std::array<float,2>{0.266974926f, 0.00427928194f},
-std::array<float,2>{0.578176141f, 0.635159135f},
-std::array<float,2>{0.0171152875f, 0.936186194f},
-std::array<float,2>{0.962201953f, 0.332555771f},
-std::array<float,2>{0.00444378797f, 0.0597262532f},
-std::array<float,2>{0.952280641f, 0.674049735f},
-std::array<float,2>{0.262230545f, 0.891818702f},
-std::array<float,2>{0.576933324f, 0.372427106f},
-std::array<float,2>{0.459442288f, 0.452984691f},
-std::array<float,2>{0.723760426f, 0.872176409f},
-std::array<float,2>{0.224225953f, 0.582476735f},
-std::array<float,2>{0.871603847f, 0.197986752f},
-std::array<float,2>{0.176149994f, 0.297807813f},
-std::array<float,2>{0.807343543f, 0.965472817f},
-std::array<float,2>{0.435617387f, 0.697779715f},
-std::array<float,2>{0.664824247f, 0.0746470392f},
-std::array<float,2>{0.325472414f, 0.186434865f},
-std::array<float,2>{0.50314641f, 0.542004406f},
-std::array<float,2>{0.117717952f, 0.81024164f},
-std::array<float,2>{0.927093923f, 0.397090286f},
-std::array<float,2>{0.208028242f, 0.219036967f},
-std::array<float,2>{0.82755971f, 0.594238222f},
-std::array<float,2>{0.476825625f, 0.826669514f},
-std::array<float,2>{0.709748566f, 0.480753005f},
-std::array<float,2>{0.303070813f, 0.325603187f},
-std::array<float,2>{0.611227989f, 0.918199122f},
-std::array<float,2>{0.0378826857f, 0.64467293f},
-std::array<float,2>{0.999059677f, 0.0269551147f},
-std::array<float,2>{0.0770924613f, 0.412247121f},
-std::array<float,2>{0.902998269f, 0.767006099f},
-std::array<float,2>{0.368431002f, 0.501385272f},
-std::array<float,2>{0.540264845f, 0.145538539f},
-std::array<float,2>{0.399798959f, 0.115896419f},
-std::array<float,2>{0.642579734f, 0.720764637f},
-std::array<float,2>{0.155591965f, 0.992992043f},
-std::array<float,2>{0.763302088f, 0.25917995f},
-std::array<float,2>{0.228359416f, 0.0193063412f},
-std::array<float,2>{0.866344929f, 0.650487721f},
-std::array<float,2>{0.462812781f, 0.907384098f},
-std::array<float,2>{0.728146017f, 0.312980831f},
-std::array<float,2>{0.255882978f, 0.468941152f},
-std::array<float,2>{0.568699956f, 0.815473735f},
-std::array<float,2>{0.0112501234f, 0.602600455f},
-std::array<float,2>{0.94468677f, 0.23187311f},
-std::array<float,2>{0.109933682f, 0.257154405f},
-std::array<float,2>{0.935545623f, 0.989074051f},
-std::array<float,2>{0.319912404f, 0.729003072f},
-std::array<float,2>{0.508301377f, 0.117924206f},
-std::array<float,2>{0.424901724f, 0.152714118f},
-std::array<float,2>{0.660547853f, 0.510962307f},
-std::array<float,2>{0.181507021f, 0.776659489f},
-std::array<float,2>{0.799698651f, 0.415818959f},
-std::array<float,2>{0.0467741974f, 0.193166986f},
-std::array<float,2>{0.992170036f, 0.5920434f},
-std::array<float,2>{0.305793971f, 0.859856546f},
-std::array<float,2>{0.623630226f, 0.44320944f},
-std::array<float,2>{0.474080414f, 0.363876045f},
-std::array<float,2>{0.712692201f, 0.899943233f},
-std::array<float,2>{0.216481f, 0.68735832f},
-std::array<float,2>{0.814038754f, 0.0529666953f},
-std::array<float,2>{0.144443497f, 0.403130621f},
-std::array<float,2>{0.755061984f, 0.802432716f},
-std::array<float,2>{0.395107359f, 0.532497108f},
-std::array<float,2>{0.65586412f, 0.175029352f},
-std::array<float,2>{0.36133948f, 0.0697963834f},
-std::array<float,2>{0.536829114f, 0.69298476f},
-std::array<float,2>{0.0661712512f, 0.960925162f},
-std::array<float,2>{0.897123218f, 0.305899084f},
-std::array<float,2>{0.0869987607f, 0.102538764f},
-std::array<float,2>{0.889306605f, 0.746622503f},
-std::array<float,2>{0.348347962f, 0.979705334f},
-std::array<float,2>{0.559079349f, 0.280179888f},
-std::array<float,2>{0.387107849f, 0.437049001f},
-std::array<float,2>{0.625625551f, 0.756937087f},
-std::array<float,2>{0.127900213f, 0.515907705f},
-std::array<float,2>{0.775329888f, 0.136771798f},
-std::array<float,2>{0.191820025f, 0.338273704f},
-std::array<float,2>{0.829312563f, 0.924256682f},
-std::array<float,2>{0.494713783f, 0.630565464f},
-std::array<float,2>{0.701449513f, 0.0127832117f},
-std::array<float,2>{0.281795114f, 0.238123998f},
-std::array<float,2>{0.598462999f, 0.611852467f},
-std::array<float,2>{0.0580062158f, 0.841539443f},
-std::array<float,2>{0.978226602f, 0.496991128f},
-std::array<float,2>{0.168206051f, 0.159263492f},
-std::array<float,2>{0.791751742f, 0.551914155f},
-std::array<float,2>{0.406713337f, 0.79137814f},
-std::array<float,2>{0.68077755f, 0.375331253f},
-std::array<float,2>{0.340031266f, 0.284137934f},
-std::array<float,2>{0.527584493f, 0.949407578f},
-std::array<float,2>{0.102649897f, 0.70326221f},
-std::array<float,2>{0.918104529f, 0.0848585293f},
-std::array<float,2>{0.0289007984f, 0.457660854f},
-std::array<float,2>{0.96037674f, 0.846153677f},
-std::array<float,2>{0.278502345f, 0.566966295f},
-std::array<float,2>{0.588627756f, 0.203306898f},
-std::array<float,2>{0.447450012f, 0.0354055241f},
-std::array<float,2>{0.746121228f, 0.667374611f},
-std::array<float,2>{0.243751898f, 0.87931329f},
-std::array<float,2>{0.854271173f, 0.350034028f},
-std::array<float,2>{0.186427161f, 0.0467532575f},
-std::array<float,2>{0.804540813f, 0.656700432f},
-std::array<float,2>{0.428924024f, 0.88676995f},
-std::array<float,2>{0.656873286f, 0.354601353f},
-std::array<float,2>{0.313661665f, 0.461167812f},
-std::array<float,2>{0.512250423f, 0.856791437f},
-std::array<float,2>{0.114299089f, 0.57060492f},
-std::array<float,2>{0.92987293f, 0.213233083f},
-std::array<float,2>{0.0139083872f, 0.295500368f},
-std::array<float,2>{0.940811515f, 0.941132784f},
-std::array<float,2>{0.253009677f, 0.713342786f},
-std::array<float,2>{0.566033602f, 0.0889081433f},
-std::array<float,2>{0.467366695f, 0.167655125f},
-std::array<float,2>{0.732402921f, 0.556295276f},
-std::array<float,2>{0.23142314f, 0.782072008f},
-std::array<float,2>{0.861959696f, 0.388412029f},
-std::array<float,2>{0.0674119741f, 0.242640376f},
-std::array<float,2>{0.891120732f, 0.624319077f},
-std::array<float,2>{0.364973456f, 0.831308365f},
-std::array<float,2>{0.534033537f, 0.488094807f},
-std::array<float,2>{0.391456306f, 0.331892639f},
-std::array<float,2>{0.650556505f, 0.933515668f},
-std::array<float,2>{0.146029592f, 0.638411224f},
-std::array<float,2>{0.752756894f, 0.00222702511f},
-std::array<float,2>{0.212392464f, 0.423205823f},
-std::array<float,2>{0.817067087f, 0.762825608f},
-std::array<float,2>{0.468943506f, 0.5286268f},
-std::array<float,2>{0.71544981f, 0.125555173f},
-std::array<float,2>{0.312465787f, 0.0950562507f},
-std::array<float,2>{0.619323134f, 0.740384221f},
-std::array<float,2>{0.0392681099f, 0.975107729f},
-std::array<float,2>{0.986541152f, 0.272206515f},
-std::array<float,2>{0.0606629178f, 0.0728649944f},
-std::array<float,2>{0.981342256f, 0.700019419f},
-std::array<float,2>{0.288310617f, 0.96185112f},
-std::array<float,2>{0.594918191f, 0.303960472f},
-std::array<float,2>{0.497808009f, 0.394449294f},
-std::array<float,2>{0.69853729f, 0.805593729f},
-std::array<float,2>{0.188815087f, 0.546453953f},
-std::array<float,2>{0.832271457f, 0.181658059f},
-std::array<float,2>{0.130328149f, 0.368575633f},
-std::array<float,2>{0.780027866f, 0.894626558f},
-std::array<float,2>{0.383379519f, 0.679316521f},
-std::array<float,2>{0.632698894f, 0.0549333207f},
-std::array<float,2>{0.346883476f, 0.201814309f},
-std::array<float,2>{0.556908906f, 0.578538895f},
-std::array<float,2>{0.0925147608f, 0.86839515f},
-std::array<float,2>{0.885326862f, 0.447991699f},
-std::array<float,2>{0.247814596f, 0.141208202f},
-std::array<float,2>{0.858426988f, 0.507041872f},
-std::array<float,2>{0.451162905f, 0.770213544f},
-std::array<float,2>{0.745116353f, 0.406307369f},
-std::array<float,2>{0.276932776f, 0.2651501f},
-std::array<float,2>{0.590704143f, 0.997740805f},
-std::array<float,2>{0.0250429288f, 0.725949287f},
-std::array<float,2>{0.953215599f, 0.112218603f},
-std::array<float,2>{0.107580319f, 0.479972512f},
-std::array<float,2>{0.917491257f, 0.823164046f},
-std::array<float,2>{0.338232815f, 0.599077106f},
-std::array<float,2>{0.526363254f, 0.22539708f},
-std::array<float,2>{0.414051354f, 0.0277922675f},
-std::array<float,2>{0.68599999f, 0.643356979f},
-std::array<float,2>{0.165295228f, 0.915443122f},
-std::array<float,2>{0.795461595f, 0.323402524f},
-std::array<float,2>{0.197551474f, 0.121142708f},
-std::array<float,2>{0.83969301f, 0.732720196f},
-std::array<float,2>{0.489553928f, 0.984942257f},
-std::array<float,2>{0.691886961f, 0.253652632f},
-std::array<float,2>{0.296089649f, 0.419785589f},
-std::array<float,2>{0.601855278f, 0.777819276f},
-std::array<float,2>{0.0527048111f, 0.513716936f},
-std::array<float,2>{0.975628614f, 0.150021031f},
-std::array<float,2>{0.079857856f, 0.316664368f},
-std::array<float,2>{0.880628705f, 0.912783086f},
-std::array<float,2>{0.356660753f, 0.655502439f},
-std::array<float,2>{0.548033297f, 0.020215828f},
-std::array<float,2>{0.37683785f, 0.229396239f},
-std::array<float,2>{0.638867319f, 0.607983649f},
-std::array<float,2>{0.136693403f, 0.820033312f},
-std::array<float,2>{0.768080294f, 0.473724246f},
-std::array<float,2>{0.0201428737f, 0.17908904f},
-std::array<float,2>{0.965479255f, 0.538179159f},
-std::array<float,2>{0.271970928f, 0.79708463f},
-std::array<float,2>{0.582363427f, 0.401319057f},
-std::array<float,2>{0.444068402f, 0.31158787f},
-std::array<float,2>{0.740725398f, 0.954074502f},
-std::array<float,2>{0.236249402f, 0.687681258f},
-std::array<float,2>{0.849392593f, 0.0625314191f},
-std::array<float,2>{0.163597897f, 0.439462274f},
-std::array<float,2>{0.786804855f, 0.864067078f},
-std::array<float,2>{0.419363439f, 0.586199403f},
-std::array<float,2>{0.672251403f, 0.188414201f},
-std::array<float,2>{0.33229363f, 0.0485252291f},
-std::array<float,2>{0.523308337f, 0.680548787f},
-std::array<float,2>{0.0961535126f, 0.906186998f},
-std::array<float,2>{0.912240744f, 0.360103488f},
-std::array<float,2>{0.123977736f, 0.00873462297f},
-std::array<float,2>{0.922873676f, 0.626568139f},
-std::array<float,2>{0.323779941f, 0.92639786f},
-std::array<float,2>{0.504781425f, 0.341183841f},
-std::array<float,2>{0.433362693f, 0.492889702f},
-std::array<float,2>{0.668136179f, 0.839005768f},
-std::array<float,2>{0.173063532f, 0.614192069f},
-std::array<float,2>{0.810568452f, 0.238707811f},
-std::array<float,2>{0.22060658f, 0.27673474f},
-std::array<float,2>{0.867201149f, 0.98138988f},
-std::array<float,2>{0.455009133f, 0.745603383f},
-std::array<float,2>{0.719326615f, 0.107191369f},
-std::array<float,2>{0.2583628f, 0.135724723f},
-std::array<float,2>{0.571807623f, 0.520374537f},
-std::array<float,2>{0.00207168004f, 0.751338065f},
-std::array<float,2>{0.94877243f, 0.432601988f},
-std::array<float,2>{0.149304405f, 0.207277358f},
-std::array<float,2>{0.761242807f, 0.564038157f},
-std::array<float,2>{0.404445231f, 0.851464331f},
-std::array<float,2>{0.645839751f, 0.455783188f},
-std::array<float,2>{0.371758133f, 0.344106466f},
-std::array<float,2>{0.543324292f, 0.877040982f},
-std::array<float,2>{0.0706568509f, 0.668101132f},
-std::array<float,2>{0.902158022f, 0.0349320769f},
-std::array<float,2>{0.0327400863f, 0.380372763f},
-std::array<float,2>{0.993960261f, 0.794898331f},
-std::array<float,2>{0.299643189f, 0.549028277f},
-std::array<float,2>{0.614923656f, 0.161473587f},
-std::array<float,2>{0.48106271f, 0.0802859366f},
-std::array<float,2>{0.704150438f, 0.708390713f},
-std::array<float,2>{0.206139177f, 0.947877526f},
-std::array<float,2>{0.823593259f, 0.286885589f},
-std::array<float,2>{0.156339973f, 0.0990622044f},
-std::array<float,2>{0.781685889f, 0.736745715f},
-std::array<float,2>{0.416844547f, 0.970210671f},
-std::array<float,2>{0.676002622f, 0.267908186f},
-std::array<float,2>{0.331215352f, 0.426989317f},
-std::array<float,2>{0.516932607f, 0.758700788f},
-std::array<float,2>{0.100950107f, 0.524901032f},
-std::array<float,2>{0.909577668f, 0.132753506f},
-std::array<float,2>{0.0178828686f, 0.334893286f},
-std::array<float,2>{0.964452326f, 0.935349941f},
-std::array<float,2>{0.268110871f, 0.634470224f},
-std::array<float,2>{0.58084631f, 0.00591766275f},
-std::array<float,2>{0.438707739f, 0.248166531f},
-std::array<float,2>{0.735796869f, 0.620993018f},
-std::array<float,2>{0.240243316f, 0.835143328f},
-std::array<float,2>{0.84741658f, 0.490244776f},
-std::array<float,2>{0.0852996781f, 0.167972386f},
-std::array<float,2>{0.875121415f, 0.558765531f},
-std::array<float,2>{0.354562163f, 0.787876129f},
-std::array<float,2>{0.553704321f, 0.383088887f},
-std::array<float,2>{0.380371153f, 0.289718121f},
-std::array<float,2>{0.632940769f, 0.944222689f},
-std::array<float,2>{0.137300298f, 0.717039824f},
-std::array<float,2>{0.771329105f, 0.0913471803f},
-std::array<float,2>{0.200091794f, 0.46568951f},
-std::array<float,2>{0.841675699f, 0.85244453f},
-std::array<float,2>{0.486024469f, 0.575227261f},
-std::array<float,2>{0.690201938f, 0.217821613f},
-std::array<float,2>{0.291053265f, 0.0397525616f},
-std::array<float,2>{0.607584357f, 0.661707819f},
-std::array<float,2>{0.0492572486f, 0.882915139f},
-std::array<float,2>{0.970813692f, 0.359261602f},
-std::array<float,2>{0.0358954407f, 0.0245510973f},
-std::array<float,2>{0.996341825f, 0.647938907f},
-std::array<float,2>{0.302580357f, 0.920871854f},
-std::array<float,2>{0.612877369f, 0.326560289f},
-std::array<float,2>{0.478875071f, 0.482686251f},
-std::array<float,2>{0.708909214f, 0.825418651f},
-std::array<float,2>{0.210606039f, 0.596482635f},
-std::array<float,2>{0.82485503f, 0.222454056f},
-std::array<float,2>{0.153710216f, 0.261521727f},
-std::array<float,2>{0.764763534f, 0.995686471f},
-std::array<float,2>{0.402197272f, 0.719904125f},
-std::array<float,2>{0.64068228f, 0.114603378f},
-std::array<float,2>{0.369725615f, 0.147156358f},
-std::array<float,2>{0.542395771f, 0.502221286f},
-std::array<float,2>{0.0750069395f, 0.767719269f},
-std::array<float,2>{0.906238616f, 0.410452574f},
-std::array<float,2>{0.226133347f, 0.196685001f},
-std::array<float,2>{0.873421252f, 0.585201681f},
-std::array<float,2>{0.458478242f, 0.874205709f},
-std::array<float,2>{0.725805879f, 0.449557692f},
-std::array<float,2>{0.263753861f, 0.373068899f},
-std::array<float,2>{0.576134503f, 0.89319253f},
-std::array<float,2>{0.00778255239f, 0.672025263f},
-std::array<float,2>{0.950721145f, 0.0608819798f},
-std::array<float,2>{0.119623564f, 0.395974636f},
-std::array<float,2>{0.928062022f, 0.812117159f},
-std::array<float,2>{0.327070922f, 0.539405525f},
-std::array<float,2>{0.50083071f, 0.184788287f},
-std::array<float,2>{0.433834583f, 0.0764617175f},
-std::array<float,2>{0.666899204f, 0.696393132f},
-std::array<float,2>{0.179485828f, 0.968387783f},
-std::array<float,2>{0.805632472f, 0.299250633f},
-std::array<float,2>{0.217848018f, 0.0516793132f},
-std::array<float,2>{0.815665066f, 0.684810102f},
-std::array<float,2>{0.475851059f, 0.901436806f},
-std::array<float,2>{0.713361382f, 0.365755618f},
-std::array<float,2>{0.307792813f, 0.444583654f},
-std::array<float,2>{0.621136785f, 0.862487674f},
-std::array<float,2>{0.0431100391f, 0.59110862f},
-std::array<float,2>{0.988812685f, 0.194810614f},
-std::array<float,2>{0.0630600527f, 0.308484554f},
-std::array<float,2>{0.894724667f, 0.957520723f},
-std::array<float,2>{0.359579355f, 0.695097148f},
-std::array<float,2>{0.538943052f, 0.0681049973f},
-std::array<float,2>{0.396740794f, 0.17276524f},
-std::array<float,2>{0.652777135f, 0.533821344f},
-std::array<float,2>{0.141249597f, 0.80344063f},
-std::array<float,2>{0.756430984f, 0.405978739f},
-std::array<float,2>{0.00831373781f, 0.234300673f},
-std::array<float,2>{0.942907214f, 0.604975641f},
-std::array<float,2>{0.255621761f, 0.813815117f},
-std::array<float,2>{0.56834358f, 0.471707165f},
-std::array<float,2>{0.464227974f, 0.316056877f},
-std::array<float,2>{0.728842914f, 0.908495665f},
-std::array<float,2>{0.230300546f, 0.648855507f},
-std::array<float,2>{0.86356777f, 0.0174989868f},
-std::array<float,2>{0.183500975f, 0.416145027f},
-std::array<float,2>{0.797968924f, 0.774534345f},
-std::array<float,2>{0.4237822f, 0.509038687f},
-std::array<float,2>{0.662925184f, 0.156042784f},
-std::array<float,2>{0.31796512f, 0.119615391f},
-std::array<float,2>{0.510219514f, 0.727638602f},
-std::array<float,2>{0.111864544f, 0.990519285f},
-std::array<float,2>{0.937180161f, 0.254024357f},
-std::array<float,2>{0.104091547f, 0.0828403309f},
-std::array<float,2>{0.921289623f, 0.705861747f},
-std::array<float,2>{0.343652874f, 0.952864587f},
-std::array<float,2>{0.531218767f, 0.282051086f},
-std::array<float,2>{0.408498824f, 0.376989424f},
-std::array<float,2>{0.682563603f, 0.790389717f},
-std::array<float,2>{0.171223015f, 0.553160846f},
-std::array<float,2>{0.789201379f, 0.15721029f},
-std::array<float,2>{0.245266601f, 0.348031819f},
-std::array<float,2>{0.853441596f, 0.881836236f},
-std::array<float,2>{0.447176874f, 0.665516019f},
-std::array<float,2>{0.74883306f, 0.0371279605f},
-std::array<float,2>{0.27982828f, 0.205287382f},
-std::array<float,2>{0.58656919f, 0.569135785f},
-std::array<float,2>{0.0296611264f, 0.845492423f},
-std::array<float,2>{0.958904505f, 0.45976609f},
-std::array<float,2>{0.126354784f, 0.13870503f},
-std::array<float,2>{0.776588321f, 0.518520057f},
-std::array<float,2>{0.389999509f, 0.755380511f},
-std::array<float,2>{0.628606439f, 0.434226453f},
-std::array<float,2>{0.350013494f, 0.278407663f},
-std::array<float,2>{0.561211407f, 0.977121294f},
-std::array<float,2>{0.0895540193f, 0.748209476f},
-std::array<float,2>{0.888103485f, 0.105212197f},
-std::array<float,2>{0.0554977693f, 0.499127299f},
-std::array<float,2>{0.978895664f, 0.841957211f},
-std::array<float,2>{0.285026729f, 0.609992981f},
-std::array<float,2>{0.601366282f, 0.234456256f},
-std::array<float,2>{0.493179709f, 0.0146495448f},
-std::array<float,2>{0.700288415f, 0.632048905f},
-std::array<float,2>{0.193958431f, 0.922353983f},
-std::array<float,2>{0.83163774f, 0.337356746f},
-std::array<float,2>{0.147401705f, 0.000891833799f},
-std::array<float,2>{0.751392782f, 0.638958633f},
-std::array<float,2>{0.393426239f, 0.931421041f},
-std::array<float,2>{0.649013877f, 0.329402655f},
-std::array<float,2>{0.366643786f, 0.484754533f},
-std::array<float,2>{0.531469584f, 0.829586506f},
-std::array<float,2>{0.0683660135f, 0.622704685f},
-std::array<float,2>{0.894402742f, 0.245572492f},
-std::array<float,2>{0.0422673821f, 0.26981315f},
-std::array<float,2>{0.985248923f, 0.973803341f},
-std::array<float,2>{0.30939284f, 0.739530981f},
-std::array<float,2>{0.618911445f, 0.0960085317f},
-std::array<float,2>{0.472559094f, 0.127858683f},
-std::array<float,2>{0.717996001f, 0.530637801f},
-std::array<float,2>{0.213580355f, 0.764512897f},
-std::array<float,2>{0.819746137f, 0.425476044f},
-std::array<float,2>{0.116524041f, 0.212624222f},
-std::array<float,2>{0.933547854f, 0.573664188f},
-std::array<float,2>{0.31569767f, 0.857508838f},
-std::array<float,2>{0.5150612f, 0.46381408f},
-std::array<float,2>{0.426242799f, 0.353180856f},
-std::array<float,2>{0.659738183f, 0.889184415f},
-std::array<float,2>{0.184300944f, 0.658797324f},
-std::array<float,2>{0.80106461f, 0.0432114191f},
-std::array<float,2>{0.234060153f, 0.388801664f},
-std::array<float,2>{0.859595954f, 0.783912659f},
-std::array<float,2>{0.466021448f, 0.557663679f},
-std::array<float,2>{0.733891845f, 0.165566772f},
-std::array<float,2>{0.251505733f, 0.0862189308f},
-std::array<float,2>{0.56359607f, 0.711148202f},
-std::array<float,2>{0.0135065047f, 0.938069522f},
-std::array<float,2>{0.939068198f, 0.294040501f},
-std::array<float,2>{0.0271471813f, 0.110456616f},
-std::array<float,2>{0.95665139f, 0.722798228f},
-std::array<float,2>{0.275027215f, 0.999192834f},
-std::array<float,2>{0.591885269f, 0.263432682f},
-std::array<float,2>{0.452432364f, 0.408761203f},
-std::array<float,2>{0.74307555f, 0.772220373f},
-std::array<float,2>{0.249704748f, 0.504150033f},
-std::array<float,2>{0.85654974f, 0.144137293f},
-std::array<float,2>{0.166386679f, 0.32139653f},
-std::array<float,2>{0.794372201f, 0.917521179f},
-std::array<float,2>{0.411128461f, 0.642237604f},
-std::array<float,2>{0.684418857f, 0.0299960338f},
-std::array<float,2>{0.336057603f, 0.22453548f},
-std::array<float,2>{0.524628282f, 0.60034436f},
-std::array<float,2>{0.106995098f, 0.82070756f},
-std::array<float,2>{0.914898992f, 0.477909118f},
-std::array<float,2>{0.191011086f, 0.180409387f},
-std::array<float,2>{0.834913611f, 0.543310761f},
-std::array<float,2>{0.498178989f, 0.806836545f},
-std::array<float,2>{0.69630003f, 0.39231202f},
-std::array<float,2>{0.287046522f, 0.301797569f},
-std::array<float,2>{0.597324014f, 0.963306725f},
-std::array<float,2>{0.0599997304f, 0.70141983f},
-std::array<float,2>{0.983537912f, 0.0718238875f},
-std::array<float,2>{0.0900993422f, 0.445450336f},
-std::array<float,2>{0.883350909f, 0.870833635f},
-std::array<float,2>{0.344944596f, 0.581440926f},
-std::array<float,2>{0.555759788f, 0.199231505f},
-std::array<float,2>{0.385760993f, 0.0569247343f},
-std::array<float,2>{0.630222499f, 0.675832093f},
-std::array<float,2>{0.132120818f, 0.898118258f},
-std::array<float,2>{0.77858907f, 0.369966447f},
-std::array<float,2>{0.237768024f, 0.0650783032f},
-std::array<float,2>{0.851391554f, 0.689689577f},
-std::array<float,2>{0.442288756f, 0.95616138f},
-std::array<float,2>{0.738612473f, 0.309699982f},
-std::array<float,2>{0.270724267f, 0.399158418f},
-std::array<float,2>{0.584017336f, 0.800726414f},
-std::array<float,2>{0.0219536293f, 0.536458433f},
-std::array<float,2>{0.968489468f, 0.176000178f},
-std::array<float,2>{0.0944948047f, 0.362422645f},
-std::array<float,2>{0.911238492f, 0.903544724f},
-std::array<float,2>{0.33451423f, 0.682360828f},
-std::array<float,2>{0.520181119f, 0.050392285f},
-std::array<float,2>{0.421577603f, 0.190449834f},
-std::array<float,2>{0.674490809f, 0.58919853f},
-std::array<float,2>{0.16055505f, 0.865887582f},
-std::array<float,2>{0.787179768f, 0.437697768f},
-std::array<float,2>{0.0536638908f, 0.150973409f},
-std::array<float,2>{0.973320067f, 0.512927473f},
-std::array<float,2>{0.293934941f, 0.780284286f},
-std::array<float,2>{0.605075419f, 0.420227885f},
-std::array<float,2>{0.491762698f, 0.251617283f},
-std::array<float,2>{0.694782555f, 0.987032771f},
-std::array<float,2>{0.196512222f, 0.731764019f},
-std::array<float,2>{0.837304175f, 0.124359943f},
-std::array<float,2>{0.133167535f, 0.47648263f},
-std::array<float,2>{0.76721853f, 0.816877365f},
-std::array<float,2>{0.377500176f, 0.605650723f},
-std::array<float,2>{0.638257444f, 0.227210224f},
-std::array<float,2>{0.359072834f, 0.0232957844f},
-std::array<float,2>{0.550043643f, 0.652365506f},
-std::array<float,2>{0.0803084299f, 0.910320997f},
-std::array<float,2>{0.882643163f, 0.320202976f},
-std::array<float,2>{0.0731953159f, 0.0328376777f},
-std::array<float,2>{0.898532987f, 0.670073926f},
-std::array<float,2>{0.373136252f, 0.875200629f},
-std::array<float,2>{0.546694696f, 0.345804304f},
-std::array<float,2>{0.404156387f, 0.453307599f},
-std::array<float,2>{0.647203803f, 0.847727597f},
-std::array<float,2>{0.151478335f, 0.564959645f},
-std::array<float,2>{0.758645535f, 0.209895223f},
-std::array<float,2>{0.203781441f, 0.288698494f},
-std::array<float,2>{0.820878208f, 0.946277976f},
-std::array<float,2>{0.482496858f, 0.709661961f},
-std::array<float,2>{0.706698596f, 0.0783567578f},
-std::array<float,2>{0.298463315f, 0.163582981f},
-std::array<float,2>{0.616620183f, 0.548172772f},
-std::array<float,2>{0.0339907184f, 0.795356095f},
-std::array<float,2>{0.995139956f, 0.381391376f},
-std::array<float,2>{0.17427896f, 0.240817606f},
-std::array<float,2>{0.808654964f, 0.616938174f},
-std::array<float,2>{0.431508958f, 0.837241173f},
-std::array<float,2>{0.671697795f, 0.494382828f},
-std::array<float,2>{0.32150045f, 0.342028648f},
-std::array<float,2>{0.50649482f, 0.929205477f},
-std::array<float,2>{0.121974066f, 0.627648056f},
-std::array<float,2>{0.924152493f, 0.0106618404f},
-std::array<float,2>{0.00107243133f, 0.431174755f},
-std::array<float,2>{0.945738792f, 0.753512681f},
-std::array<float,2>{0.260943443f, 0.522721887f},
-std::array<float,2>{0.573552966f, 0.134193659f},
-std::array<float,2>{0.456143588f, 0.107544869f},
-std::array<float,2>{0.722474337f, 0.742416143f},
-std::array<float,2>{0.221451595f, 0.983858883f},
-std::array<float,2>{0.869597614f, 0.274485081f},
-std::array<float,2>{0.178665116f, 0.0756647289f},
-std::array<float,2>{0.806602299f, 0.698355198f},
-std::array<float,2>{0.435324311f, 0.965933442f},
-std::array<float,2>{0.66739279f, 0.298577368f},
-std::array<float,2>{0.327202708f, 0.397741944f},
-std::array<float,2>{0.501009524f, 0.809192181f},
-std::array<float,2>{0.120937578f, 0.541669309f},
-std::array<float,2>{0.928839386f, 0.186843202f},
-std::array<float,2>{0.0061937063f, 0.371259749f},
-std::array<float,2>{0.949351907f, 0.891136885f},
-std::array<float,2>{0.26497978f, 0.675039351f},
-std::array<float,2>{0.574810803f, 0.0590020679f},
-std::array<float,2>{0.457461238f, 0.198355094f},
-std::array<float,2>{0.724874616f, 0.583944619f},
-std::array<float,2>{0.2248988f, 0.871922731f},
-std::array<float,2>{0.87493974f, 0.451869458f},
-std::array<float,2>{0.0756582245f, 0.144945174f},
-std::array<float,2>{0.904402614f, 0.500666618f},
-std::array<float,2>{0.371035337f, 0.76620096f},
-std::array<float,2>{0.541241884f, 0.413656056f},
-std::array<float,2>{0.400549233f, 0.257817477f},
-std::array<float,2>{0.642178178f, 0.993813574f},
-std::array<float,2>{0.153257385f, 0.722410679f},
-std::array<float,2>{0.764264584f, 0.116919905f},
-std::array<float,2>{0.209530056f, 0.481610447f},
-std::array<float,2>{0.825805426f, 0.827450573f},
-std::array<float,2>{0.480293572f, 0.595496655f},
-std::array<float,2>{0.707935572f, 0.220167965f},
-std::array<float,2>{0.30159077f, 0.0261072144f},
-std::array<float,2>{0.611905396f, 0.645632803f},
-std::array<float,2>{0.0366334133f, 0.919345081f},
-std::array<float,2>{0.998039961f, 0.324567676f},
-std::array<float,2>{0.0499686375f, 0.0418984927f},
-std::array<float,2>{0.972295225f, 0.662263393f},
-std::array<float,2>{0.292661279f, 0.885047317f},
-std::array<float,2>{0.608764708f, 0.356536418f},
-std::array<float,2>{0.484577388f, 0.468283594f},
-std::array<float,2>{0.691082418f, 0.854768574f},
-std::array<float,2>{0.200532511f, 0.577241838f},
-std::array<float,2>{0.840422451f, 0.216405436f},
-std::array<float,2>{0.137792721f, 0.291311145f},
-std::array<float,2>{0.769675791f, 0.941527188f},
-std::array<float,2>{0.379420519f, 0.715984344f},
-std::array<float,2>{0.634668469f, 0.0926812962f},
-std::array<float,2>{0.353619635f, 0.170311511f},
-std::array<float,2>{0.553938568f, 0.561804593f},
-std::array<float,2>{0.0849429592f, 0.78632915f},
-std::array<float,2>{0.87630105f, 0.385876805f},
-std::array<float,2>{0.241454765f, 0.247964799f},
-std::array<float,2>{0.846156836f, 0.618659973f},
-std::array<float,2>{0.438458562f, 0.833211005f},
-std::array<float,2>{0.734872162f, 0.488740534f},
-std::array<float,2>{0.269248545f, 0.333735466f},
-std::array<float,2>{0.581677377f, 0.936782181f},
-std::array<float,2>{0.0194665696f, 0.636115968f},
-std::array<float,2>{0.963277578f, 0.00578946574f},
-std::array<float,2>{0.100178704f, 0.429217756f},
-std::array<float,2>{0.908310473f, 0.760651231f},
-std::array<float,2>{0.330487102f, 0.526492476f},
-std::array<float,2>{0.516378164f, 0.129198417f},
-std::array<float,2>{0.417506933f, 0.100797556f},
-std::array<float,2>{0.677137315f, 0.736237884f},
-std::array<float,2>{0.157969877f, 0.971273065f},
-std::array<float,2>{0.783072352f, 0.265978813f},
-std::array<float,2>{0.194510475f, 0.0120110996f},
-std::array<float,2>{0.830635011f, 0.629378021f},
-std::array<float,2>{0.492453575f, 0.92538929f},
-std::array<float,2>{0.699744582f, 0.339137793f},
-std::array<float,2>{0.283322871f, 0.497569233f},
-std::array<float,2>{0.600175679f, 0.84025979f},
-std::array<float,2>{0.0556744672f, 0.613232374f},
-std::array<float,2>{0.979514897f, 0.236794919f},
-std::array<float,2>{0.088613309f, 0.280372471f},
-std::array<float,2>{0.886891127f, 0.979441822f},
-std::array<float,2>{0.350683153f, 0.747273982f},
-std::array<float,2>{0.561733007f, 0.102913328f},
-std::array<float,2>{0.389139771f, 0.137749836f},
-std::array<float,2>{0.627653778f, 0.516710043f},
-std::array<float,2>{0.125021189f, 0.756666303f},
-std::array<float,2>{0.775673985f, 0.436370879f},
-std::array<float,2>{0.0312200841f, 0.204977676f},
-std::array<float,2>{0.95718354f, 0.567402601f},
-std::array<float,2>{0.281028479f, 0.846982837f},
-std::array<float,2>{0.587479949f, 0.458434641f},
-std::array<float,2>{0.44613862f, 0.351084322f},
-std::array<float,2>{0.749479651f, 0.88057816f},
-std::array<float,2>{0.244588777f, 0.666725338f},
-std::array<float,2>{0.852506161f, 0.0364356786f},
-std::array<float,2>{0.170728013f, 0.376430869f},
-std::array<float,2>{0.790769339f, 0.792809546f},
-std::array<float,2>{0.409740657f, 0.551644862f},
-std::array<float,2>{0.683201551f, 0.158761159f},
-std::array<float,2>{0.342078567f, 0.0852627456f},
-std::array<float,2>{0.529893219f, 0.705024064f},
-std::array<float,2>{0.105443791f, 0.950843155f},
-std::array<float,2>{0.920506239f, 0.284621835f},
-std::array<float,2>{0.112869889f, 0.118289232f},
-std::array<float,2>{0.935702503f, 0.729648352f},
-std::array<float,2>{0.316833884f, 0.989438951f},
-std::array<float,2>{0.510990143f, 0.256722778f},
-std::array<float,2>{0.422432065f, 0.414683074f},
-std::array<float,2>{0.663762867f, 0.775823772f},
-std::array<float,2>{0.181870073f, 0.510094821f},
-std::array<float,2>{0.796875894f, 0.15343751f},
-std::array<float,2>{0.228701875f, 0.31399101f},
-std::array<float,2>{0.864786923f, 0.907204688f},
-std::array<float,2>{0.463080972f, 0.65209496f},
-std::array<float,2>{0.730332375f, 0.0177219752f},
-std::array<float,2>{0.254226625f, 0.231085315f},
-std::array<float,2>{0.566610873f, 0.602054536f},
-std::array<float,2>{0.00895426795f, 0.814829051f},
-std::array<float,2>{0.94216609f, 0.470597059f},
-std::array<float,2>{0.142206341f, 0.174615443f},
-std::array<float,2>{0.757368505f, 0.531831264f},
-std::array<float,2>{0.397840977f, 0.801175117f},
-std::array<float,2>{0.653968275f, 0.403348923f},
-std::array<float,2>{0.360701621f, 0.305262417f},
-std::array<float,2>{0.537205279f, 0.959518731f},
-std::array<float,2>{0.0635576695f, 0.69171524f},
-std::array<float,2>{0.896000624f, 0.0687772781f},
-std::array<float,2>{0.044584699f, 0.441670924f},
-std::array<float,2>{0.989600837f, 0.860751927f},
-std::array<float,2>{0.306950927f, 0.593561709f},
-std::array<float,2>{0.622963905f, 0.191843867f},
-std::array<float,2>{0.475517422f, 0.0541379564f},
-std::array<float,2>{0.714554667f, 0.685932457f},
-std::array<float,2>{0.217714891f, 0.898518503f},
-std::array<float,2>{0.815372169f, 0.364483058f},
-std::array<float,2>{0.131108195f, 0.0559093542f},
-std::array<float,2>{0.777816117f, 0.677917778f},
-std::array<float,2>{0.385094225f, 0.896197379f},
-std::array<float,2>{0.629827857f, 0.367676824f},
-std::array<float,2>{0.344606578f, 0.44854486f},
-std::array<float,2>{0.554965734f, 0.867733121f},
-std::array<float,2>{0.0910693407f, 0.579947412f},
-std::array<float,2>{0.883820832f, 0.202704072f},
-std::array<float,2>{0.0593274012f, 0.303363055f},
-std::array<float,2>{0.983225942f, 0.962768674f},
-std::array<float,2>{0.285855293f, 0.701044679f},
-std::array<float,2>{0.59663105f, 0.0733009502f},
-std::array<float,2>{0.49983716f, 0.182793185f},
-std::array<float,2>{0.695884407f, 0.54534179f},
-std::array<float,2>{0.190355286f, 0.806014299f},
-std::array<float,2>{0.835789323f, 0.392719418f},
-std::array<float,2>{0.106074147f, 0.226473302f},
-std::array<float,2>{0.91596961f, 0.597827196f},
-std::array<float,2>{0.337050766f, 0.823839962f},
-std::array<float,2>{0.524047375f, 0.478546917f},
-std::array<float,2>{0.411603481f, 0.322878242f},
-std::array<float,2>{0.685282171f, 0.914436877f},
-std::array<float,2>{0.167076349f, 0.643605292f},
-std::array<float,2>{0.793229461f, 0.0287431479f},
-std::array<float,2>{0.248151883f, 0.407676697f},
-std::array<float,2>{0.855652392f, 0.771442592f},
-std::array<float,2>{0.451461434f, 0.506639123f},
-std::array<float,2>{0.743700743f, 0.141710535f},
-std::array<float,2>{0.273668021f, 0.112909451f},
-std::array<float,2>{0.59339124f, 0.724942744f},
-std::array<float,2>{0.0261439327f, 0.996408224f},
-std::array<float,2>{0.955919147f, 0.264321506f},
-std::array<float,2>{0.0122636212f, 0.0882767141f},
-std::array<float,2>{0.938081622f, 0.713938177f},
-std::array<float,2>{0.250499696f, 0.940137863f},
-std::array<float,2>{0.562561512f, 0.296056062f},
-std::array<float,2>{0.464996785f, 0.387683362f},
-std::array<float,2>{0.733024478f, 0.782809973f},
-std::array<float,2>{0.233331293f, 0.555095077f},
-std::array<float,2>{0.860971153f, 0.166566238f},
-std::array<float,2>{0.185339496f, 0.354352951f},
-std::array<float,2>{0.802258611f, 0.888403356f},
-std::array<float,2>{0.426887333f, 0.658063173f},
-std::array<float,2>{0.658939302f, 0.045829244f},
-std::array<float,2>{0.315159231f, 0.214017689f},
-std::array<float,2>{0.514478683f, 0.571777225f},
-std::array<float,2>{0.115362793f, 0.855655849f},
-std::array<float,2>{0.932281733f, 0.46201247f},
-std::array<float,2>{0.214369878f, 0.126185253f},
-std::array<float,2>{0.81911236f, 0.527958274f},
-std::array<float,2>{0.471259177f, 0.762320995f},
-std::array<float,2>{0.717611849f, 0.422755688f},
-std::array<float,2>{0.31010139f, 0.27342993f},
-std::array<float,2>{0.617816746f, 0.976180255f},
-std::array<float,2>{0.0417847671f, 0.7419191f},
-std::array<float,2>{0.986078918f, 0.0940567106f},
-std::array<float,2>{0.0700651631f, 0.486979365f},
-std::array<float,2>{0.893350363f, 0.83033675f},
-std::array<float,2>{0.365773559f, 0.62394923f},
-std::array<float,2>{0.532364309f, 0.243557021f},
-std::array<float,2>{0.394388109f, 0.00310524344f},
-std::array<float,2>{0.650197327f, 0.637375057f},
-std::array<float,2>{0.148085371f, 0.931704938f},
-std::array<float,2>{0.750621974f, 0.33048144f},
-std::array<float,2>{0.222250685f, 0.105850235f},
-std::array<float,2>{0.870690227f, 0.744795024f},
-std::array<float,2>{0.455189675f, 0.981745422f},
-std::array<float,2>{0.720927835f, 0.275608152f},
-std::array<float,2>{0.260245055f, 0.433519632f},
-std::array<float,2>{0.57252717f, 0.750637889f},
-std::array<float,2>{0.000120307508f, 0.520786405f},
-std::array<float,2>{0.946641684f, 0.136166856f},
-std::array<float,2>{0.122866504f, 0.340717405f},
-std::array<float,2>{0.925029755f, 0.927555144f},
-std::array<float,2>{0.321089506f, 0.625088453f},
-std::array<float,2>{0.50745219f, 0.00938578043f},
-std::array<float,2>{0.430281043f, 0.239410803f},
-std::array<float,2>{0.67049998f, 0.614978135f},
-std::array<float,2>{0.175742149f, 0.838653803f},
-std::array<float,2>{0.809815347f, 0.493343741f},
-std::array<float,2>{0.0348673835f, 0.16018647f},
-std::array<float,2>{0.994165301f, 0.550385654f},
-std::array<float,2>{0.296891719f, 0.793940961f},
-std::array<float,2>{0.615842283f, 0.379785836f},
-std::array<float,2>{0.483765692f, 0.285329193f},
-std::array<float,2>{0.705098212f, 0.949161768f},
-std::array<float,2>{0.204216883f, 0.707079709f},
-std::array<float,2>{0.822215319f, 0.0811297819f},
-std::array<float,2>{0.150735736f, 0.456110477f},
-std::array<float,2>{0.759365797f, 0.850474894f},
-std::array<float,2>{0.403136104f, 0.563009799f},
-std::array<float,2>{0.648303926f, 0.20818451f},
-std::array<float,2>{0.374839067f, 0.0337234475f},
-std::array<float,2>{0.545885205f, 0.669137895f},
-std::array<float,2>{0.073533386f, 0.877967238f},
-std::array<float,2>{0.899515212f, 0.345380932f},
-std::array<float,2>{0.0813850611f, 0.0205450598f},
-std::array<float,2>{0.881134689f, 0.654990852f},
-std::array<float,2>{0.358032018f, 0.913299978f},
-std::array<float,2>{0.54951179f, 0.317890018f},
-std::array<float,2>{0.378005326f, 0.472912103f},
-std::array<float,2>{0.637187779f, 0.818733513f},
-std::array<float,2>{0.133937567f, 0.609170258f},
-std::array<float,2>{0.765694857f, 0.230401129f},
-std::array<float,2>{0.195593864f, 0.25286293f},
-std::array<float,2>{0.836027443f, 0.986072719f},
-std::array<float,2>{0.490637124f, 0.734095991f},
-std::array<float,2>{0.693945765f, 0.122433245f},
-std::array<float,2>{0.294069469f, 0.149316594f},
-std::array<float,2>{0.604106367f, 0.51489526f},
-std::array<float,2>{0.0542117916f, 0.778430641f},
-std::array<float,2>{0.973678529f, 0.41865617f},
-std::array<float,2>{0.161474094f, 0.188869894f},
-std::array<float,2>{0.788512766f, 0.587653041f},
-std::array<float,2>{0.42078203f, 0.864516258f},
-std::array<float,2>{0.675781012f, 0.440446615f},
-std::array<float,2>{0.33531788f, 0.361237913f},
-std::array<float,2>{0.520700276f, 0.904408693f},
-std::array<float,2>{0.0951832235f, 0.681374013f},
-std::array<float,2>{0.910971999f, 0.0468961149f},
-std::array<float,2>{0.0234048571f, 0.401953995f},
-std::array<float,2>{0.966843128f, 0.798020065f},
-std::array<float,2>{0.270337552f, 0.537420332f},
-std::array<float,2>{0.58528626f, 0.178388223f},
-std::array<float,2>{0.443158716f, 0.0642969534f},
-std::array<float,2>{0.740218461f, 0.688690484f},
-std::array<float,2>{0.236707926f, 0.955057204f},
-std::array<float,2>{0.849811137f, 0.310651273f},
-std::array<float,2>{0.155156478f, 0.113468796f},
-std::array<float,2>{0.762341082f, 0.719141424f},
-std::array<float,2>{0.398628533f, 0.994967818f},
-std::array<float,2>{0.643869758f, 0.259817332f},
-std::array<float,2>{0.367888391f, 0.412094802f},
-std::array<float,2>{0.539582014f, 0.769410551f},
-std::array<float,2>{0.0776075348f, 0.503415704f},
-std::array<float,2>{0.90394038f, 0.147552207f},
-std::array<float,2>{0.0386772901f, 0.327912629f},
-std::array<float,2>{0.998416543f, 0.921367645f},
-std::array<float,2>{0.304379135f, 0.647282541f},
-std::array<float,2>{0.60974884f, 0.0237606261f},
-std::array<float,2>{0.477766931f, 0.220993146f},
-std::array<float,2>{0.71035111f, 0.597038805f},
-std::array<float,2>{0.207533017f, 0.824297845f},
-std::array<float,2>{0.826449871f, 0.483503401f},
-std::array<float,2>{0.118965514f, 0.184555694f},
-std::array<float,2>{0.926425099f, 0.540826976f},
-std::array<float,2>{0.324582815f, 0.810623705f},
-std::array<float,2>{0.502924979f, 0.395308316f},
-std::array<float,2>{0.437100708f, 0.300084025f},
-std::array<float,2>{0.665863693f, 0.966839671f},
-std::array<float,2>{0.177304223f, 0.696067095f},
-std::array<float,2>{0.808387518f, 0.0778824091f},
-std::array<float,2>{0.223187953f, 0.450437993f},
-std::array<float,2>{0.872361362f, 0.87376529f},
-std::array<float,2>{0.460835129f, 0.584568739f},
-std::array<float,2>{0.72299099f, 0.195649341f},
-std::array<float,2>{0.263248265f, 0.0616015978f},
-std::array<float,2>{0.577889085f, 0.672955513f},
-std::array<float,2>{0.00526417745f, 0.894077003f},
-std::array<float,2>{0.952069044f, 0.374129176f},
-std::array<float,2>{0.016143309f, 0.00716722105f},
-std::array<float,2>{0.961584628f, 0.633225799f},
-std::array<float,2>{0.266302139f, 0.933990717f},
-std::array<float,2>{0.579834342f, 0.33526358f},
-std::array<float,2>{0.439590037f, 0.491808891f},
-std::array<float,2>{0.737536609f, 0.834736824f},
-std::array<float,2>{0.238383785f, 0.620019674f},
-std::array<float,2>{0.845522642f, 0.249842286f},
-std::array<float,2>{0.158652633f, 0.269470572f},
-std::array<float,2>{0.784581661f, 0.969035149f},
-std::array<float,2>{0.415541083f, 0.737605512f},
-std::array<float,2>{0.678793609f, 0.098031193f},
-std::array<float,2>{0.328953415f, 0.131518081f},
-std::array<float,2>{0.519444883f, 0.524333656f},
-std::array<float,2>{0.0981838033f, 0.759533226f},
-std::array<float,2>{0.906649351f, 0.426273048f},
-std::array<float,2>{0.202512532f, 0.216951907f},
-std::array<float,2>{0.843414009f, 0.574228823f},
-std::array<float,2>{0.488032222f, 0.852690995f},
-std::array<float,2>{0.688553751f, 0.466503441f},
-std::array<float,2>{0.289449036f, 0.357591987f},
-std::array<float,2>{0.607352734f, 0.884060562f},
-std::array<float,2>{0.0468875431f, 0.660328269f},
-std::array<float,2>{0.970087051f, 0.040812429f},
-std::array<float,2>{0.0822758377f, 0.3842704f},
-std::array<float,2>{0.878700078f, 0.788925767f},
-std::array<float,2>{0.35161525f, 0.560165048f},
-std::array<float,2>{0.55220443f, 0.169618517f},
-std::array<float,2>{0.382263303f, 0.0903834403f},
-std::array<float,2>{0.63491112f, 0.717952192f},
-std::array<float,2>{0.14036949f, 0.945049703f},
-std::array<float,2>{0.773192406f, 0.290314257f},
-std::array<float,2>{0.243034899f, 0.038467247f},
-std::array<float,2>{0.854914248f, 0.664253533f},
-std::array<float,2>{0.448856086f, 0.880871058f},
-std::array<float,2>{0.747513652f, 0.349327445f},
-std::array<float,2>{0.277607828f, 0.460343063f},
-std::array<float,2>{0.589836895f, 0.844192863f},
-std::array<float,2>{0.0280643553f, 0.569419205f},
-std::array<float,2>{0.959460795f, 0.206415236f},
-std::array<float,2>{0.102135032f, 0.282382101f},
-std::array<float,2>{0.919243753f, 0.951286435f},
-std::array<float,2>{0.341340035f, 0.70647639f},
-std::array<float,2>{0.528854728f, 0.0832893401f},
-std::array<float,2>{0.408014804f, 0.158178464f},
-std::array<float,2>{0.67970413f, 0.553896248f},
-std::array<float,2>{0.169056341f, 0.789274871f},
-std::array<float,2>{0.792358339f, 0.378254056f},
-std::array<float,2>{0.0574963018f, 0.235688701f},
-std::array<float,2>{0.977087319f, 0.610700667f},
-std::array<float,2>{0.282309622f, 0.843566418f},
-std::array<float,2>{0.599239051f, 0.499017447f},
-std::array<float,2>{0.495571434f, 0.336713314f},
-std::array<float,2>{0.703109503f, 0.923611343f},
-std::array<float,2>{0.193221748f, 0.631498158f},
-std::array<float,2>{0.828193426f, 0.0145365046f},
-std::array<float,2>{0.128744423f, 0.43522495f},
-std::array<float,2>{0.774006963f, 0.754804254f},
-std::array<float,2>{0.387975454f, 0.51925838f},
-std::array<float,2>{0.626032114f, 0.140040562f},
-std::array<float,2>{0.348765701f, 0.103642322f},
-std::array<float,2>{0.560528755f, 0.74971056f},
-std::array<float,2>{0.0868819281f, 0.977894366f},
-std::array<float,2>{0.890500963f, 0.277736723f},
-std::array<float,2>{0.0646011904f, 0.0672927573f},
-std::array<float,2>{0.898080945f, 0.693629503f},
-std::array<float,2>{0.363021493f, 0.958019257f},
-std::array<float,2>{0.535816669f, 0.306864172f},
-std::array<float,2>{0.396078795f, 0.404424578f},
-std::array<float,2>{0.654306829f, 0.804217875f},
-std::array<float,2>{0.143366203f, 0.534370184f},
-std::array<float,2>{0.75434351f, 0.173569947f},
-std::array<float,2>{0.215749338f, 0.366947919f},
-std::array<float,2>{0.812776625f, 0.901064336f},
-std::array<float,2>{0.47294727f, 0.684291959f},
-std::array<float,2>{0.711839974f, 0.0526432954f},
-std::array<float,2>{0.304889381f, 0.193478838f},
-std::array<float,2>{0.624109149f, 0.59059453f},
-std::array<float,2>{0.0452532321f, 0.861618161f},
-std::array<float,2>{0.990693629f, 0.443512022f},
-std::array<float,2>{0.180404365f, 0.154380187f},
-std::array<float,2>{0.800449669f, 0.508765161f},
-std::array<float,2>{0.423950076f, 0.773561299f},
-std::array<float,2>{0.661174655f, 0.417779386f},
-std::array<float,2>{0.319154203f, 0.255011946f},
-std::array<float,2>{0.509113967f, 0.991518021f},
-std::array<float,2>{0.11053136f, 0.727460563f},
-std::array<float,2>{0.934529305f, 0.120469905f},
-std::array<float,2>{0.0105788428f, 0.470884711f},
-std::array<float,2>{0.943728745f, 0.812923431f},
-std::array<float,2>{0.257238865f, 0.604075015f},
-std::array<float,2>{0.569407165f, 0.23337321f},
-std::array<float,2>{0.46159181f, 0.0157769509f},
-std::array<float,2>{0.726888359f, 0.650332153f},
-std::array<float,2>{0.22703065f, 0.909963191f},
-std::array<float,2>{0.865483642f, 0.315419585f},
-std::array<float,2>{0.164563209f, 0.0305053461f},
-std::array<float,2>{0.796451628f, 0.64064163f},
-std::array<float,2>{0.412962914f, 0.916051984f},
-std::array<float,2>{0.686637342f, 0.320675701f},
-std::array<float,2>{0.339724213f, 0.476922929f},
-std::array<float,2>{0.52710259f, 0.821371019f},
-std::array<float,2>{0.10883832f, 0.600946605f},
-std::array<float,2>{0.916508317f, 0.222868085f},
-std::array<float,2>{0.024007475f, 0.262598634f},
-std::array<float,2>{0.954688132f, 0.998651206f},
-std::array<float,2>{0.275897175f, 0.72390604f},
-std::array<float,2>{0.591126025f, 0.10962189f},
-std::array<float,2>{0.449656278f, 0.143541649f},
-std::array<float,2>{0.745300353f, 0.504903615f},
-std::array<float,2>{0.246300682f, 0.773343027f},
-std::array<float,2>{0.858241796f, 0.409461886f},
-std::array<float,2>{0.0933610648f, 0.200561792f},
-std::array<float,2>{0.886232197f, 0.580634892f},
-std::array<float,2>{0.345907688f, 0.870016515f},
-std::array<float,2>{0.558479667f, 0.44686231f},
-std::array<float,2>{0.384356588f, 0.370826602f},
-std::array<float,2>{0.631216109f, 0.896730423f},
-std::array<float,2>{0.129505023f, 0.677390754f},
-std::array<float,2>{0.780450344f, 0.0582300574f},
-std::array<float,2>{0.187684685f, 0.391184628f},
-std::array<float,2>{0.833185256f, 0.808026791f},
-std::array<float,2>{0.496991247f, 0.544151247f},
-std::array<float,2>{0.697791874f, 0.180836409f},
-std::array<float,2>{0.28714478f, 0.0703961253f},
-std::array<float,2>{0.594119191f, 0.702415586f},
-std::array<float,2>{0.0623102784f, 0.963972211f},
-std::array<float,2>{0.981754005f, 0.300806582f},
-std::array<float,2>{0.0405851118f, 0.0972487926f},
-std::array<float,2>{0.987461805f, 0.739152789f},
-std::array<float,2>{0.31071952f, 0.973193049f},
-std::array<float,2>{0.62082684f, 0.271013141f},
-std::array<float,2>{0.470213562f, 0.42458716f},
-std::array<float,2>{0.716609895f, 0.765476763f},
-std::array<float,2>{0.211285964f, 0.530272603f},
-std::array<float,2>{0.817486584f, 0.128828764f},
-std::array<float,2>{0.144964069f, 0.328361183f},
-std::array<float,2>{0.753254771f, 0.93019861f},
-std::array<float,2>{0.392321616f, 0.640390873f},
-std::array<float,2>{0.651429892f, 0.00114717579f},
-std::array<float,2>{0.363742381f, 0.244535714f},
-std::array<float,2>{0.53488481f, 0.621738434f},
-std::array<float,2>{0.0670128018f, 0.82832092f},
-std::array<float,2>{0.891673028f, 0.485679239f},
-std::array<float,2>{0.23168242f, 0.164486185f},
-std::array<float,2>{0.86303246f, 0.556881249f},
-std::array<float,2>{0.468424469f, 0.784585178f},
-std::array<float,2>{0.730871081f, 0.390621364f},
-std::array<float,2>{0.252213776f, 0.293893933f},
-std::array<float,2>{0.565323174f, 0.938815057f},
-std::array<float,2>{0.0147063658f, 0.71258688f},
-std::array<float,2>{0.939834476f, 0.0869171023f},
-std::array<float,2>{0.113379307f, 0.464638203f},
-std::array<float,2>{0.931367636f, 0.858506799f},
-std::array<float,2>{0.312793702f, 0.572393894f},
-std::array<float,2>{0.513064146f, 0.211544752f},
-std::array<float,2>{0.428479373f, 0.0439985655f},
-std::array<float,2>{0.657939553f, 0.659881175f},
-std::array<float,2>{0.187286943f, 0.890021265f},
-std::array<float,2>{0.803350747f, 0.351884753f},
-std::array<float,2>{0.205383286f, 0.0795131847f},
-std::array<float,2>{0.823138833f, 0.710887134f},
-std::array<float,2>{0.481860578f, 0.947242737f},
-std::array<float,2>{0.703574717f, 0.288072377f},
-std::array<float,2>{0.300601661f, 0.382792592f},
-std::array<float,2>{0.614186943f, 0.796341777f},
-std::array<float,2>{0.0313058868f, 0.547538161f},
-std::array<float,2>{0.992734373f, 0.162686944f},
-std::array<float,2>{0.0713554397f, 0.347205669f},
-std::array<float,2>{0.900785446f, 0.876142383f},
-std::array<float,2>{0.3730084f, 0.671168804f},
-std::array<float,2>{0.544378877f, 0.0312978514f},
-std::array<float,2>{0.405892581f, 0.210729703f},
-std::array<float,2>{0.644599676f, 0.565500379f},
-std::array<float,2>{0.149486095f, 0.849528372f},
-std::array<float,2>{0.760424316f, 0.45440802f},
-std::array<float,2>{0.00321380352f, 0.132944852f},
-std::array<float,2>{0.948238254f, 0.521814167f},
-std::array<float,2>{0.259745359f, 0.752340794f},
-std::array<float,2>{0.571273923f, 0.430584908f},
-std::array<float,2>{0.454013228f, 0.273952752f},
-std::array<float,2>{0.719768286f, 0.982886493f},
-std::array<float,2>{0.218928248f, 0.743253648f},
-std::array<float,2>{0.868711472f, 0.109305806f},
-std::array<float,2>{0.172241494f, 0.495546728f},
-std::array<float,2>{0.811777711f, 0.836097956f},
-std::array<float,2>{0.431646019f, 0.616009951f},
-std::array<float,2>{0.669587612f, 0.241287217f},
-std::array<float,2>{0.323208898f, 0.0109348362f},
-std::array<float,2>{0.505810082f, 0.628215909f},
-std::array<float,2>{0.124260917f, 0.928484142f},
-std::array<float,2>{0.922778308f, 0.342788935f},
-std::array<float,2>{0.0973299146f, 0.0489611104f},
-std::array<float,2>{0.913361311f, 0.682841361f},
-std::array<float,2>{0.333406836f, 0.902436733f},
-std::array<float,2>{0.522229016f, 0.361677229f},
-std::array<float,2>{0.4187271f, 0.439388782f},
-std::array<float,2>{0.673095882f, 0.866317868f},
-std::array<float,2>{0.162340239f, 0.588091552f},
-std::array<float,2>{0.785756648f, 0.189579904f},
-std::array<float,2>{0.23492144f, 0.309169233f},
-std::array<float,2>{0.848459959f, 0.955678105f},
-std::array<float,2>{0.44482106f, 0.691094756f},
-std::array<float,2>{0.741471708f, 0.0663039982f},
-std::array<float,2>{0.27332443f, 0.176977873f},
-std::array<float,2>{0.583019853f, 0.53527683f},
-std::array<float,2>{0.0214621071f, 0.799388587f},
-std::array<float,2>{0.96631211f, 0.399566501f},
-std::array<float,2>{0.135157973f, 0.228258699f},
-std::array<float,2>{0.768944025f, 0.607308984f},
-std::array<float,2>{0.375944942f, 0.817487955f},
-std::array<float,2>{0.639975071f, 0.474776387f},
-std::array<float,2>{0.356125236f, 0.319101691f},
-std::array<float,2>{0.547304988f, 0.911640286f},
-std::array<float,2>{0.0784727335f, 0.654175341f},
-std::array<float,2>{0.87948513f, 0.0219993275f},
-std::array<float,2>{0.0513411276f, 0.421160847f},
-std::array<float,2>{0.975125134f, 0.780074775f},
-std::array<float,2>{0.295222938f, 0.512181282f},
-std::array<float,2>{0.603368521f, 0.152228221f},
-std::array<float,2>{0.488445491f, 0.123480454f},
-std::array<float,2>{0.6932199f, 0.730850518f},
-std::array<float,2>{0.198993698f, 0.9873088f},
-std::array<float,2>{0.837966144f, 0.250613213f}}
\ No newline at end of file
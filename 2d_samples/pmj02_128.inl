@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.202377543f, 0.178441092f},
-std::array<float,2>{0.899413645f, 0.639655113f},
-std::array<float,2>{0.312013626f, 0.889059246f},
-std::array<float,2>{0.697657168f, 0.391492814f},
-std::array<float,2>{0.432101697f, 0.250226319f},
-std::array<float,2>{0.536535501f, 0.796573341f},
-std::array<float,2>{0.0259840693f, 0.583143532f},
-std::array<float,2>{0.798251271f, 0.0580091365f},
-std::array<float,2>{0.113340288f, 0.48698622f},
-std::array<float,2>{0.842055082f, 0.979991496f},
-std::array<float,2>{0.483191669f, 0.748889208f},
-std::array<float,2>{0.589767814f, 0.195985109f},
-std::array<float,2>{0.349753082f, 0.092383042f},
-std::array<float,2>{0.656813323f, 0.550598264f},
-std::array<float,2>{0.144541249f, 0.815811813f},
-std::array<float,2>{0.945902407f, 0.330781758f},
-std::array<float,2>{0.0432632454f, 0.0299594421f},
-std::array<float,2>{0.765270948f, 0.62287879f},
-std::array<float,2>{0.379287958f, 0.7726385f},
-std::array<float,2>{0.515836835f, 0.304112613f},
-std::array<float,2>{0.280547291f, 0.422061116f},
-std::array<float,2>{0.73159039f, 0.916683853f},
-std::array<float,2>{0.247825652f, 0.656936705f},
-std::array<float,2>{0.916415811f, 0.131755263f},
-std::array<float,2>{0.178594217f, 0.356078953f},
-std::array<float,2>{0.970174849f, 0.867448866f},
-std::array<float,2>{0.336438328f, 0.504978359f},
-std::array<float,2>{0.652290463f, 0.11835935f},
-std::array<float,2>{0.465740144f, 0.235876694f},
-std::array<float,2>{0.615656614f, 0.696175277f},
-std::array<float,2>{0.0738512054f, 0.938946724f},
-std::array<float,2>{0.860803545f, 0.452752352f},
-std::array<float,2>{0.139210612f, 0.0977987647f},
-std::array<float,2>{0.962803006f, 0.520343781f},
-std::array<float,2>{0.373152584f, 0.85840106f},
-std::array<float,2>{0.678931296f, 0.366943479f},
-std::array<float,2>{0.489616126f, 0.460730523f},
-std::array<float,2>{0.571548283f, 0.953326881f},
-std::array<float,2>{0.106661506f, 0.706245363f},
-std::array<float,2>{0.825416565f, 0.231581196f},
-std::array<float,2>{2.57281135e-05f, 0.289657414f},
-std::array<float,2>{0.789625287f, 0.752933741f},
-std::array<float,2>{0.416646391f, 0.602165163f},
-std::array<float,2>{0.54895097f, 0.00249634869f},
-std::array<float,2>{0.286171883f, 0.154208437f},
-std::array<float,2>{0.710867703f, 0.680738091f},
-std::array<float,2>{0.218658373f, 0.929949939f},
-std::array<float,2>{0.875419021f, 0.408336192f},
-std::array<float,2>{0.081538491f, 0.208888993f},
-std::array<float,2>{0.85872066f, 0.73364836f},
-std::array<float,2>{0.440431297f, 0.994677246f},
-std::array<float,2>{0.60604769f, 0.478113681f},
-std::array<float,2>{0.326903135f, 0.321822405f},
-std::array<float,2>{0.62844044f, 0.842758238f},
-std::array<float,2>{0.170710981f, 0.544611275f},
-std::array<float,2>{0.989581704f, 0.0746756494f},
-std::array<float,2>{0.232276872f, 0.382641912f},
-std::array<float,2>{0.935488999f, 0.902903855f},
-std::array<float,2>{0.258795351f, 0.642695963f},
-std::array<float,2>{0.747145176f, 0.171275496f},
-std::array<float,2>{0.40105027f, 0.0319841839f},
-std::array<float,2>{0.500347733f, 0.568776309f},
-std::array<float,2>{0.0602534786f, 0.81050694f},
-std::array<float,2>{0.770916998f, 0.274730772f},
-std::array<float,2>{0.160863996f, 0.222055957f},
-std::array<float,2>{0.99554354f, 0.716148615f},
-std::array<float,2>{0.312923878f, 0.965128899f},
-std::array<float,2>{0.635117829f, 0.463513583f},
-std::array<float,2>{0.45125398f, 0.369982809f},
-std::array<float,2>{0.596709609f, 0.845673144f},
-std::array<float,2>{0.0862926841f, 0.529312313f},
-std::array<float,2>{0.851347864f, 0.106935702f},
-std::array<float,2>{0.0526762828f, 0.415577292f},
-std::array<float,2>{0.777471244f, 0.922432125f},
-std::array<float,2>{0.390973568f, 0.672761261f},
-std::array<float,2>{0.510529459f, 0.147091568f},
-std::array<float,2>{0.25390327f, 0.00961782597f},
-std::array<float,2>{0.735077858f, 0.597409368f},
-std::array<float,2>{0.221714526f, 0.763306439f},
-std::array<float,2>{0.927969396f, 0.28375119f},
-std::array<float,2>{0.0937640518f, 0.065447256f},
-std::array<float,2>{0.816809714f, 0.53399992f},
-std::array<float,2>{0.493619919f, 0.830116034f},
-std::array<float,2>{0.568750322f, 0.31510967f},
-std::array<float,2>{0.366139084f, 0.471435785f},
-std::array<float,2>{0.683330595f, 0.992015898f},
-std::array<float,2>{0.130251482f, 0.723673999f},
-std::array<float,2>{0.95849371f, 0.211146578f},
-std::array<float,2>{0.203178823f, 0.272991508f},
-std::array<float,2>{0.890154243f, 0.799546838f},
-std::array<float,2>{0.295488358f, 0.57173866f},
-std::array<float,2>{0.718328178f, 0.0463265292f},
-std::array<float,2>{0.410796314f, 0.158258185f},
-std::array<float,2>{0.554804504f, 0.654451132f},
-std::array<float,2>{0.00912510604f, 0.894218922f},
-std::array<float,2>{0.78266573f, 0.388839543f},
-std::array<float,2>{0.239389092f, 0.0486438759f},
-std::array<float,2>{0.907690585f, 0.593447149f},
-std::array<float,2>{0.266407281f, 0.788712561f},
-std::array<float,2>{0.720676661f, 0.262191296f},
-std::array<float,2>{0.387506604f, 0.405344009f},
-std::array<float,2>{0.529980838f, 0.876045644f},
-std::array<float,2>{0.0324846394f, 0.632481277f},
-std::array<float,2>{0.751611233f, 0.185279667f},
-std::array<float,2>{0.0671494752f, 0.336442769f},
-std::array<float,2>{0.872137547f, 0.820818603f},
-std::array<float,2>{0.453391254f, 0.56088227f},
-std::array<float,2>{0.617302418f, 0.0851317346f},
-std::array<float,2>{0.331152588f, 0.190029293f},
-std::array<float,2>{0.64653939f, 0.736651361f},
-std::array<float,2>{0.183960304f, 0.973182678f},
-std::array<float,2>{0.979267478f, 0.496436626f},
-std::array<float,2>{0.0198838953f, 0.137954786f},
-std::array<float,2>{0.807014585f, 0.667627096f},
-std::array<float,2>{0.425214261f, 0.91318363f},
-std::array<float,2>{0.542763293f, 0.430541605f},
-std::array<float,2>{0.297744304f, 0.311243027f},
-std::array<float,2>{0.688665748f, 0.781082451f},
-std::array<float,2>{0.188790143f, 0.615187883f},
-std::array<float,2>{0.897626579f, 0.0165885296f},
-std::array<float,2>{0.148609176f, 0.445114821f},
-std::array<float,2>{0.939040363f, 0.947648883f},
-std::array<float,2>{0.354914844f, 0.694330037f},
-std::array<float,2>{0.66882062f, 0.245916516f},
-std::array<float,2>{0.473859668f, 0.11121437f},
-std::array<float,2>{0.584732592f, 0.51082927f},
-std::array<float,2>{0.122107863f, 0.863970518f},
-std::array<float,2>{0.833460987f, 0.349245548f},
-std::array<float,2>{0.141202822f, 0.140813649f},
-std::array<float,2>{0.949671149f, 0.679049373f},
-std::array<float,2>{0.345005006f, 0.927004158f},
-std::array<float,2>{0.661706924f, 0.418560386f},
-std::array<float,2>{0.478086203f, 0.289046198f},
-std::array<float,2>{0.591188014f, 0.758122742f},
-std::array<float,2>{0.110011138f, 0.599079311f},
-std::array<float,2>{0.83947444f, 0.0119630592f},
-std::array<float,2>{0.0297869891f, 0.46529007f},
-std::array<float,2>{0.803525627f, 0.962644696f},
-std::array<float,2>{0.436942548f, 0.71162498f},
-std::array<float,2>{0.532532871f, 0.224484995f},
-std::array<float,2>{0.306779534f, 0.103187785f},
-std::array<float,2>{0.702530622f, 0.523679197f},
-std::array<float,2>{0.197748944f, 0.85114485f},
-std::array<float,2>{0.905476391f, 0.373793036f},
-std::array<float,2>{0.074966982f, 0.0410138182f},
-std::array<float,2>{0.863684535f, 0.57767123f},
-std::array<float,2>{0.462277859f, 0.801416576f},
-std::array<float,2>{0.610943615f, 0.265710026f},
-std::array<float,2>{0.341799289f, 0.384656101f},
-std::array<float,2>{0.655005991f, 0.895409048f},
-std::array<float,2>{0.17502673f, 0.649080396f},
-std::array<float,2>{0.972764194f, 0.162523866f},
-std::array<float,2>{0.242927656f, 0.317656249f},
-std::array<float,2>{0.919013083f, 0.833668232f},
-std::array<float,2>{0.275576741f, 0.538176358f},
-std::array<float,2>{0.727800488f, 0.0695374385f},
-std::array<float,2>{0.37621063f, 0.215609312f},
-std::array<float,2>{0.522742689f, 0.720273197f},
-std::array<float,2>{0.0428957753f, 0.987899065f},
-std::array<float,2>{0.758341014f, 0.475327611f},
-std::array<float,2>{0.214298308f, 0.0799039155f},
-std::array<float,2>{0.881991982f, 0.556214333f},
-std::array<float,2>{0.282771885f, 0.824227691f},
-std::array<float,2>{0.706393361f, 0.342861056f},
-std::array<float,2>{0.418739349f, 0.492773414f},
-std::array<float,2>{0.553136528f, 0.972503781f},
-std::array<float,2>{0.00724396948f, 0.739892483f},
-std::array<float,2>{0.794070542f, 0.195210531f},
-std::array<float,2>{0.10317757f, 0.260108382f},
-std::array<float,2>{0.823848546f, 0.781272709f},
-std::array<float,2>{0.485777378f, 0.588395238f},
-std::array<float,2>{0.575195432f, 0.0508232899f},
-std::array<float,2>{0.367919594f, 0.180538133f},
-std::array<float,2>{0.672523737f, 0.626960516f},
-std::array<float,2>{0.134154558f, 0.881261289f},
-std::array<float,2>{0.968423605f, 0.399035662f},
-std::array<float,2>{0.0567162298f, 0.247022867f},
-std::array<float,2>{0.767969728f, 0.690179944f},
-std::array<float,2>{0.403137624f, 0.952874184f},
-std::array<float,2>{0.505037844f, 0.438714653f},
-std::array<float,2>{0.262486309f, 0.344889075f},
-std::array<float,2>{0.743973911f, 0.862137914f},
-std::array<float,2>{0.228283852f, 0.511902153f},
-std::array<float,2>{0.932837069f, 0.115122467f},
-std::array<float,2>{0.165380478f, 0.436847329f},
-std::array<float,2>{0.986588657f, 0.909907937f},
-std::array<float,2>{0.323104173f, 0.668824673f},
-std::array<float,2>{0.628978908f, 0.13419129f},
-std::array<float,2>{0.441412091f, 0.0222946834f},
-std::array<float,2>{0.602087975f, 0.61289084f},
-std::array<float,2>{0.0848457813f, 0.777035534f},
-std::array<float,2>{0.853183925f, 0.308450371f},
-std::array<float,2>{0.22472693f, 0.202294663f},
-std::array<float,2>{0.925192177f, 0.745246172f},
-std::array<float,2>{0.254668742f, 0.980988324f},
-std::array<float,2>{0.738607228f, 0.489355057f},
-std::array<float,2>{0.395884991f, 0.33234477f},
-std::array<float,2>{0.514014721f, 0.819577217f},
-std::array<float,2>{0.05050762f, 0.55256027f},
-std::array<float,2>{0.774747193f, 0.0873695686f},
-std::array<float,2>{0.0911093652f, 0.39659819f},
-std::array<float,2>{0.847195745f, 0.88373208f},
-std::array<float,2>{0.447839141f, 0.633196831f},
-std::array<float,2>{0.598834276f, 0.172976121f},
-std::array<float,2>{0.317804635f, 0.0623336807f},
-std::array<float,2>{0.637895167f, 0.580085278f},
-std::array<float,2>{0.157167733f, 0.792685509f},
-std::array<float,2>{0.996345103f, 0.254262775f},
-std::array<float,2>{0.0154012647f, 0.122318931f},
-std::array<float,2>{0.785632074f, 0.500653207f},
-std::array<float,2>{0.410014004f, 0.871261597f},
-std::array<float,2>{0.560836256f, 0.353980184f},
-std::array<float,2>{0.292157352f, 0.447371989f},
-std::array<float,2>{0.712937117f, 0.943205893f},
-std::array<float,2>{0.207839742f, 0.701010883f},
-std::array<float,2>{0.884552002f, 0.241958201f},
-std::array<float,2>{0.125191391f, 0.300374627f},
-std::array<float,2>{0.954784334f, 0.766868293f},
-std::array<float,2>{0.360703111f, 0.620370626f},
-std::array<float,2>{0.685900927f, 0.0248064939f},
-std::array<float,2>{0.498236835f, 0.125348225f},
-std::array<float,2>{0.56491971f, 0.662611306f},
-std::array<float,2>{0.098190695f, 0.919810891f},
-std::array<float,2>{0.813775241f, 0.428081453f},
-std::array<float,2>{0.181777015f, 0.00748995552f},
-std::array<float,2>{0.982479274f, 0.60802865f},
-std::array<float,2>{0.334209979f, 0.754163504f},
-std::array<float,2>{0.643803835f, 0.294267118f},
-std::array<float,2>{0.460278839f, 0.412285119f},
-std::array<float,2>{0.622511089f, 0.933887303f},
-std::array<float,2>{0.0657079592f, 0.685647309f},
-std::array<float,2>{0.870778382f, 0.149361193f},
-std::array<float,2>{0.0363294631f, 0.360028177f},
-std::array<float,2>{0.754795492f, 0.852407813f},
-std::array<float,2>{0.385072261f, 0.518873334f},
-std::array<float,2>{0.526162088f, 0.0970970839f},
-std::array<float,2>{0.270772368f, 0.228152901f},
-std::array<float,2>{0.723614752f, 0.709376335f},
-std::array<float,2>{0.236221403f, 0.957124472f},
-std::array<float,2>{0.910459161f, 0.455569565f},
-std::array<float,2>{0.119138293f, 0.166296661f},
-std::array<float,2>{0.829648733f, 0.647493899f},
-std::array<float,2>{0.469592333f, 0.900647104f},
-std::array<float,2>{0.578373253f, 0.378389895f},
-std::array<float,2>{0.356358349f, 0.278596729f},
-std::array<float,2>{0.667703509f, 0.805261493f},
-std::array<float,2>{0.153244928f, 0.565780818f},
-std::array<float,2>{0.944742084f, 0.0371014923f},
-std::array<float,2>{0.193469107f, 0.481324196f},
-std::array<float,2>{0.89396143f, 0.998062313f},
-std::array<float,2>{0.301468641f, 0.729974627f},
-std::array<float,2>{0.693981946f, 0.204575285f},
-std::array<float,2>{0.428556949f, 0.070377633f},
-std::array<float,2>{0.544493318f, 0.540343285f},
-std::array<float,2>{0.0194973387f, 0.838220179f},
-std::array<float,2>{0.809672832f, 0.326747328f},
-std::array<float,2>{0.248991668f, 0.130128399f},
-std::array<float,2>{0.915438414f, 0.658262968f},
-std::array<float,2>{0.278570533f, 0.915566981f},
-std::array<float,2>{0.733559072f, 0.425638109f},
-std::array<float,2>{0.382778674f, 0.301863104f},
-std::array<float,2>{0.519212782f, 0.770715356f},
-std::array<float,2>{0.0450810194f, 0.62407732f},
-std::array<float,2>{0.762280583f, 0.027653005f},
-std::array<float,2>{0.0714079663f, 0.450009435f},
-std::array<float,2>{0.862337828f, 0.939773798f},
-std::array<float,2>{0.468232125f, 0.697512686f},
-std::array<float,2>{0.614665627f, 0.237275153f},
-std::array<float,2>{0.339128613f, 0.120915547f},
-std::array<float,2>{0.649978757f, 0.506505907f},
-std::array<float,2>{0.177726716f, 0.869371176f},
-std::array<float,2>{0.971764386f, 0.359159112f},
-std::array<float,2>{0.0252599642f, 0.0551463887f},
-std::array<float,2>{0.800501108f, 0.584504724f},
-std::array<float,2>{0.430780858f, 0.794525623f},
-std::array<float,2>{0.538653791f, 0.25207302f},
-std::array<float,2>{0.31047374f, 0.392832935f},
-std::array<float,2>{0.696355283f, 0.887422919f},
-std::array<float,2>{0.200194389f, 0.638091683f},
-std::array<float,2>{0.900874436f, 0.176762804f},
-std::array<float,2>{0.146625757f, 0.329797447f},
-std::array<float,2>{0.948458135f, 0.813553572f},
-std::array<float,2>{0.348375052f, 0.548136294f},
-std::array<float,2>{0.66010803f, 0.0910901651f},
-std::array<float,2>{0.481009901f, 0.19745177f},
-std::array<float,2>{0.586351991f, 0.747860551f},
-std::array<float,2>{0.116778769f, 0.977748573f},
-std::array<float,2>{0.839874446f, 0.484687775f},
-std::array<float,2>{0.169517085f, 0.0779349729f},
-std::array<float,2>{0.990435779f, 0.546023667f},
-std::array<float,2>{0.324486136f, 0.841597617f},
-std::array<float,2>{0.626036823f, 0.322531611f},
-std::array<float,2>{0.438633353f, 0.480236769f},
-std::array<float,2>{0.607830524f, 0.992339611f},
-std::array<float,2>{0.0791012794f, 0.731254816f},
-std::array<float,2>{0.856198609f, 0.210210696f},
-std::array<float,2>{0.0614460967f, 0.276157647f},
-std::array<float,2>{0.773117423f, 0.810819924f},
-std::array<float,2>{0.399969697f, 0.566589534f},
-std::array<float,2>{0.502628207f, 0.0350055471f},
-std::array<float,2>{0.261227846f, 0.169017464f},
-std::array<float,2>{0.748357654f, 0.641749442f},
-std::array<float,2>{0.233397514f, 0.904547572f},
-std::array<float,2>{0.93592906f, 0.380123615f},
-std::array<float,2>{0.108644515f, 0.233362228f},
-std::array<float,2>{0.826846063f, 0.703779578f},
-std::array<float,2>{0.490309477f, 0.956611454f},
-std::array<float,2>{0.573869526f, 0.457048714f},
-std::array<float,2>{0.37233609f, 0.365193099f},
-std::array<float,2>{0.676072955f, 0.856995165f},
-std::array<float,2>{0.138569087f, 0.522278547f},
-std::array<float,2>{0.964194298f, 0.100372367f},
-std::array<float,2>{0.215522587f, 0.407584608f},
-std::array<float,2>{0.877335787f, 0.933431089f},
-std::array<float,2>{0.28785491f, 0.683008373f},
-std::array<float,2>{0.707219005f, 0.155916303f},
-std::array<float,2>{0.415559679f, 0.00184147095f},
-std::array<float,2>{0.548163891f, 0.605112433f},
-std::array<float,2>{0.00206704484f, 0.750863731f},
-std::array<float,2>{0.792664468f, 0.292399734f},
-std::array<float,2>{0.130939752f, 0.21456112f},
-std::array<float,2>{0.959702551f, 0.726086617f},
-std::array<float,2>{0.36386171f, 0.988682687f},
-std::array<float,2>{0.680980623f, 0.470491111f},
-std::array<float,2>{0.495444953f, 0.313066304f},
-std::array<float,2>{0.567012548f, 0.830065668f},
-std::array<float,2>{0.0972992629f, 0.5323596f},
-std::array<float,2>{0.818965912f, 0.0641532093f},
-std::array<float,2>{0.0116093457f, 0.386890769f},
-std::array<float,2>{0.784787238f, 0.891104221f},
-std::array<float,2>{0.412968934f, 0.652619243f},
-std::array<float,2>{0.558182895f, 0.157013386f},
-std::array<float,2>{0.294674635f, 0.0449058451f},
-std::array<float,2>{0.71503222f, 0.572285891f},
-std::array<float,2>{0.205397472f, 0.79718256f},
-std::array<float,2>{0.886897445f, 0.270413905f},
-std::array<float,2>{0.0882283077f, 0.108058199f},
-std::array<float,2>{0.848694205f, 0.528064787f},
-std::array<float,2>{0.449265987f, 0.845822811f},
-std::array<float,2>{0.594001591f, 0.36753127f},
-std::array<float,2>{0.315038145f, 0.462583899f},
-std::array<float,2>{0.632827401f, 0.967867136f},
-std::array<float,2>{0.16289717f, 0.716912925f},
-std::array<float,2>{0.993898213f, 0.218840897f},
-std::array<float,2>{0.218778238f, 0.283073634f},
-std::array<float,2>{0.92717433f, 0.763900161f},
-std::array<float,2>{0.251674235f, 0.594017506f},
-std::array<float,2>{0.737232089f, 0.0101318657f},
-std::array<float,2>{0.393561155f, 0.145319238f},
-std::array<float,2>{0.508732021f, 0.675371945f},
-std::array<float,2>{0.0545331538f, 0.924373329f},
-std::array<float,2>{0.779728353f, 0.416495353f},
-std::array<float,2>{0.189655215f, 0.0192735102f},
-std::array<float,2>{0.895274758f, 0.617038846f},
-std::array<float,2>{0.299354225f, 0.778445005f},
-std::array<float,2>{0.689644992f, 0.309954971f},
-std::array<float,2>{0.422351152f, 0.433031589f},
-std::array<float,2>{0.539810121f, 0.910163701f},
-std::array<float,2>{0.0224779211f, 0.66530025f},
-std::array<float,2>{0.805176079f, 0.14003323f},
-std::array<float,2>{0.123604767f, 0.349759489f},
-std::array<float,2>{0.834171832f, 0.866044462f},
-std::array<float,2>{0.47469151f, 0.5089311f},
-std::array<float,2>{0.582946122f, 0.111736253f},
-std::array<float,2>{0.352541924f, 0.243510798f},
-std::array<float,2>{0.67141974f, 0.693289101f},
-std::array<float,2>{0.152261928f, 0.946430087f},
-std::array<float,2>{0.941119432f, 0.442401111f},
-std::array<float,2>{0.0348921902f, 0.187042296f},
-std::array<float,2>{0.752072871f, 0.630317688f},
-std::array<float,2>{0.388943225f, 0.877447367f},
-std::array<float,2>{0.527646542f, 0.404209703f},
-std::array<float,2>{0.269228578f, 0.264808327f},
-std::array<float,2>{0.722448528f, 0.786508977f},
-std::array<float,2>{0.241813481f, 0.59056288f},
-std::array<float,2>{0.909655213f, 0.0491233692f},
-std::array<float,2>{0.186455861f, 0.499343663f},
-std::array<float,2>{0.976702452f, 0.974659503f},
-std::array<float,2>{0.329933137f, 0.734413743f},
-std::array<float,2>{0.646002173f, 0.18810375f},
-std::array<float,2>{0.456196219f, 0.0834126025f},
-std::array<float,2>{0.619618535f, 0.559437394f},
-std::array<float,2>{0.0700125992f, 0.823700726f},
-std::array<float,2>{0.873940468f, 0.339327544f},
-std::array<float,2>{0.173757792f, 0.160870925f},
-std::array<float,2>{0.97585541f, 0.6518628f},
-std::array<float,2>{0.340822846f, 0.897380233f},
-std::array<float,2>{0.654054999f, 0.385000139f},
-std::array<float,2>{0.463471919f, 0.269108534f},
-std::array<float,2>{0.612161815f, 0.80384171f},
-std::array<float,2>{0.0772501975f, 0.575457454f},
-std::array<float,2>{0.867131054f, 0.0420882031f},
-std::array<float,2>{0.0400856137f, 0.47444123f},
-std::array<float,2>{0.759827912f, 0.985375881f},
-std::array<float,2>{0.377726346f, 0.722482979f},
-std::array<float,2>{0.520446122f, 0.217768654f},
-std::array<float,2>{0.274267286f, 0.0670252293f},
-std::array<float,2>{0.729582429f, 0.535187185f},
-std::array<float,2>{0.245381355f, 0.835659921f},
-std::array<float,2>{0.92149204f, 0.318958998f},
-std::array<float,2>{0.112568773f, 0.0147890951f},
-std::array<float,2>{0.836576819f, 0.601408601f},
-std::array<float,2>{0.480113685f, 0.760298431f},
-std::array<float,2>{0.593408406f, 0.285405189f},
-std::array<float,2>{0.346237063f, 0.420898169f},
-std::array<float,2>{0.663416505f, 0.929022193f},
-std::array<float,2>{0.144489869f, 0.677338779f},
-std::array<float,2>{0.952454507f, 0.144335374f},
-std::array<float,2>{0.196388423f, 0.371646941f},
-std::array<float,2>{0.904261231f, 0.848930478f},
-std::array<float,2>{0.305614501f, 0.525912464f},
-std::array<float,2>{0.700748563f, 0.105230927f},
-std::array<float,2>{0.435445547f, 0.226144075f},
-std::array<float,2>{0.535057127f, 0.71314168f},
-std::array<float,2>{0.0276247263f, 0.963077903f},
-std::array<float,2>{0.802097142f, 0.467434496f},
-std::array<float,2>{0.229786515f, 0.117051318f},
-std::array<float,2>{0.931544483f, 0.513769746f},
-std::array<float,2>{0.26548329f, 0.859684527f},
-std::array<float,2>{0.745153785f, 0.345854729f},
-std::array<float,2>{0.405281872f, 0.440035671f},
-std::array<float,2>{0.507692575f, 0.949261546f},
-std::array<float,2>{0.0549565665f, 0.687865436f},
-std::array<float,2>{0.767317235f, 0.24814333f},
-std::array<float,2>{0.0826473907f, 0.30550164f},
-std::array<float,2>{0.85536617f, 0.775161266f},
-std::array<float,2>{0.443368852f, 0.610170066f},
-std::array<float,2>{0.603978515f, 0.0207127314f},
-std::array<float,2>{0.320678174f, 0.135287195f},
-std::array<float,2>{0.63108933f, 0.670263708f},
-std::array<float,2>{0.166633531f, 0.907409072f},
-std::array<float,2>{0.984544575f, 0.434398681f},
-std::array<float,2>{0.00438926695f, 0.191890955f},
-std::array<float,2>{0.795732677f, 0.741595089f},
-std::array<float,2>{0.421800762f, 0.968947113f},
-std::array<float,2>{0.551495492f, 0.494174868f},
-std::array<float,2>{0.283404976f, 0.340568483f},
-std::array<float,2>{0.703902304f, 0.827692151f},
-std::array<float,2>{0.212542534f, 0.558058441f},
-std::array<float,2>{0.880274296f, 0.081463702f},
-std::array<float,2>{0.136489809f, 0.401099056f},
-std::array<float,2>{0.966746986f, 0.879937172f},
-std::array<float,2>{0.369400591f, 0.625464857f},
-std::array<float,2>{0.674125314f, 0.182749286f},
-std::array<float,2>{0.4870103f, 0.0541233383f},
-std::array<float,2>{0.576791286f, 0.586116552f},
-std::array<float,2>{0.104327276f, 0.783655941f},
-std::array<float,2>{0.821542084f, 0.259072661f},
-std::array<float,2>{0.209236443f, 0.23914361f},
-std::array<float,2>{0.886210501f, 0.701733232f},
-std::array<float,2>{0.289166838f, 0.943658292f},
-std::array<float,2>{0.711662471f, 0.445332795f},
-std::array<float,2>{0.407603204f, 0.353140265f},
-std::array<float,2>{0.559079885f, 0.874100447f},
-std::array<float,2>{0.0136646032f, 0.502661645f},
-std::array<float,2>{0.787391901f, 0.123477608f},
-std::array<float,2>{0.0999873877f, 0.426611245f},
-std::array<float,2>{0.814626992f, 0.921828508f},
-std::array<float,2>{0.497362167f, 0.661605239f},
-std::array<float,2>{0.563834071f, 0.127548084f},
-std::array<float,2>{0.361871481f, 0.0258624312f},
-std::array<float,2>{0.685279489f, 0.618207097f},
-std::array<float,2>{0.127054617f, 0.768843472f},
-std::array<float,2>{0.956412733f, 0.296982706f},
-std::array<float,2>{0.0482184626f, 0.0898104236f},
-std::array<float,2>{0.775448203f, 0.554340959f},
-std::array<float,2>{0.397471488f, 0.817850709f},
-std::array<float,2>{0.511886179f, 0.33424142f},
-std::array<float,2>{0.256119728f, 0.491962135f},
-std::array<float,2>{0.741656959f, 0.983799219f},
-std::array<float,2>{0.224048987f, 0.742494941f},
-std::array<float,2>{0.922418594f, 0.199319124f},
-std::array<float,2>{0.159860268f, 0.257061571f},
-std::array<float,2>{0.999511898f, 0.790256917f},
-std::array<float,2>{0.320064783f, 0.579833746f},
-std::array<float,2>{0.639089048f, 0.0602818355f},
-std::array<float,2>{0.445360571f, 0.175287262f},
-std::array<float,2>{0.600260139f, 0.635157168f},
-std::array<float,2>{0.0927347466f, 0.885452449f},
-std::array<float,2>{0.845701098f, 0.394977599f},
-std::array<float,2>{0.155889869f, 0.0374483056f},
-std::array<float,2>{0.943036795f, 0.563433349f},
-std::array<float,2>{0.358937651f, 0.806953788f},
-std::array<float,2>{0.664078534f, 0.28102386f},
-std::array<float,2>{0.471850574f, 0.376524061f},
-std::array<float,2>{0.58175385f, 0.899365842f},
-std::array<float,2>{0.119539104f, 0.644642174f},
-std::array<float,2>{0.830371976f, 0.164110318f},
-std::array<float,2>{0.0173091274f, 0.325705588f},
-std::array<float,2>{0.811139047f, 0.837645292f},
-std::array<float,2>{0.427578658f, 0.541531324f},
-std::array<float,2>{0.545905113f, 0.0740567148f},
-std::array<float,2>{0.30366075f, 0.205137044f},
-std::array<float,2>{0.691565633f, 0.728485763f},
-std::array<float,2>{0.192144364f, 0.996908665f},
-std::array<float,2>{0.891580462f, 0.482846737f},
-std::array<float,2>{0.0639070272f, 0.150705785f},
-std::array<float,2>{0.86771065f, 0.684941709f},
-std::array<float,2>{0.457102776f, 0.936831772f},
-std::array<float,2>{0.624212146f, 0.411164731f},
-std::array<float,2>{0.333478063f, 0.296282947f},
-std::array<float,2>{0.640773177f, 0.75717032f},
-std::array<float,2>{0.180504411f, 0.60665834f},
-std::array<float,2>{0.980646074f, 0.00411337893f},
-std::array<float,2>{0.238210708f, 0.453398705f},
-std::array<float,2>{0.913206518f, 0.959034145f},
-std::array<float,2>{0.272148788f, 0.707153141f},
-std::array<float,2>{0.725762486f, 0.230293855f},
-std::array<float,2>{0.384058386f, 0.0950643346f},
-std::array<float,2>{0.523458242f, 0.516779482f},
-std::array<float,2>{0.0381873958f, 0.854577065f},
-std::array<float,2>{0.756766021f, 0.362424642f},
-std::array<float,2>{0.216966361f, 0.155159101f},
-std::array<float,2>{0.876320422f, 0.68219316f},
-std::array<float,2>{0.285859823f, 0.932616055f},
-std::array<float,2>{0.708997309f, 0.406985581f},
-std::array<float,2>{0.417828888f, 0.291215092f},
-std::array<float,2>{0.550286233f, 0.751851797f},
-std::array<float,2>{0.00157731411f, 0.603643239f},
-std::array<float,2>{0.7907902f, 0.000309012306f},
-std::array<float,2>{0.106057584f, 0.458240181f},
-std::array<float,2>{0.824286163f, 0.955856621f},
-std::array<float,2>{0.488406092f, 0.705072641f},
-std::array<float,2>{0.57091254f, 0.234300628f},
-std::array<float,2>{0.374540031f, 0.101270229f},
-std::array<float,2>{0.677798271f, 0.52263689f},
-std::array<float,2>{0.140213117f, 0.856137991f},
-std::array<float,2>{0.961505592f, 0.363724381f},
-std::array<float,2>{0.0588894486f, 0.0336014219f},
-std::array<float,2>{0.769930124f, 0.567855537f},
-std::array<float,2>{0.401963681f, 0.812295794f},
-std::array<float,2>{0.501545131f, 0.276753455f},
-std::array<float,2>{0.258222938f, 0.379008204f},
-std::array<float,2>{0.746654928f, 0.905497313f},
-std::array<float,2>{0.231031671f, 0.641016006f},
-std::array<float,2>{0.934062958f, 0.168393567f},
-std::array<float,2>{0.171452016f, 0.324175864f},
-std::array<float,2>{0.988804221f, 0.839913249f},
-std::array<float,2>{0.328041166f, 0.545416594f},
-std::array<float,2>{0.627589762f, 0.0763352215f},
-std::array<float,2>{0.440307409f, 0.209087119f},
-std::array<float,2>{0.60688138f, 0.732196808f},
-std::array<float,2>{0.0809619874f, 0.993730485f},
-std::array<float,2>{0.857573092f, 0.479432851f},
-std::array<float,2>{0.145934016f, 0.0904622227f},
-std::array<float,2>{0.946321249f, 0.547621071f},
-std::array<float,2>{0.350710481f, 0.812821031f},
-std::array<float,2>{0.657942832f, 0.329019904f},
-std::array<float,2>{0.483933866f, 0.485728234f},
-std::array<float,2>{0.588636398f, 0.976635158f},
-std::array<float,2>{0.114296377f, 0.746501625f},
-std::array<float,2>{0.843446076f, 0.198358908f},
-std::array<float,2>{0.0265811887f, 0.25316295f},
-std::array<float,2>{0.797134876f, 0.793807685f},
-std::array<float,2>{0.43337968f, 0.58504647f},
-std::array<float,2>{0.536091626f, 0.0559678413f},
-std::array<float,2>{0.311224163f, 0.176448509f},
-std::array<float,2>{0.699185729f, 0.636793852f},
-std::array<float,2>{0.201719701f, 0.888666749f},
-std::array<float,2>{0.899838865f, 0.393809855f},
-std::array<float,2>{0.0727617368f, 0.238006651f},
-std::array<float,2>{0.859441519f, 0.698891222f},
-std::array<float,2>{0.465934902f, 0.941088438f},
-std::array<float,2>{0.616559505f, 0.450692713f},
-std::array<float,2>{0.33762762f, 0.357644826f},
-std::array<float,2>{0.651201248f, 0.870711565f},
-std::array<float,2>{0.179425776f, 0.507783413f},
-std::array<float,2>{0.969427824f, 0.119491361f},
-std::array<float,2>{0.246137396f, 0.423828632f},
-std::array<float,2>{0.917776704f, 0.914492905f},
-std::array<float,2>{0.279907435f, 0.660130858f},
-std::array<float,2>{0.730542779f, 0.12979652f},
-std::array<float,2>{0.380448848f, 0.0289640874f},
-std::array<float,2>{0.517033935f, 0.623956442f},
-std::array<float,2>{0.0448061712f, 0.769937277f},
-std::array<float,2>{0.763900995f, 0.300903827f},
-std::array<float,2>{0.185125798f, 0.188913658f},
-std::array<float,2>{0.980153501f, 0.735929251f},
-std::array<float,2>{0.330569863f, 0.97639966f},
-std::array<float,2>{0.647808969f, 0.498910636f},
-std::array<float,2>{0.454404712f, 0.338686794f},
-std::array<float,2>{0.618917227f, 0.822587132f},
-std::array<float,2>{0.0683211908f, 0.559935629f},
-std::array<float,2>{0.871582031f, 0.0825322941f},
-std::array<float,2>{0.0321583413f, 0.402848423f},
-std::array<float,2>{0.750672579f, 0.878404021f},
-std::array<float,2>{0.388375521f, 0.629270494f},
-std::array<float,2>{0.530947864f, 0.186340585f},
-std::array<float,2>{0.267402172f, 0.0506761782f},
-std::array<float,2>{0.719655216f, 0.591614664f},
-std::array<float,2>{0.239143983f, 0.78611958f},
-std::array<float,2>{0.906708062f, 0.264647782f},
-std::array<float,2>{0.121208109f, 0.11243137f},
-std::array<float,2>{0.832164586f, 0.508023024f},
-std::array<float,2>{0.472693741f, 0.866344213f},
-std::array<float,2>{0.585401297f, 0.350795865f},
-std::array<float,2>{0.353598744f, 0.441849291f},
-std::array<float,2>{0.669827521f, 0.945381761f},
-std::array<float,2>{0.150026053f, 0.692190468f},
-std::array<float,2>{0.938269138f, 0.242446229f},
-std::array<float,2>{0.188314795f, 0.309427351f},
-std::array<float,2>{0.896772146f, 0.777977169f},
-std::array<float,2>{0.298600316f, 0.615870118f},
-std::array<float,2>{0.687825859f, 0.0179320723f},
-std::array<float,2>{0.42457661f, 0.139225021f},
-std::array<float,2>{0.54173255f, 0.664605856f},
-std::array<float,2>{0.0206860472f, 0.91129148f},
-std::array<float,2>{0.807909369f, 0.432175249f},
-std::array<float,2>{0.221502408f, 0.0115862964f},
-std::array<float,2>{0.928909063f, 0.595293522f},
-std::array<float,2>{0.25246051f, 0.765543878f},
-std::array<float,2>{0.735736251f, 0.281828523f},
-std::array<float,2>{0.39215064f, 0.417911142f},
-std::array<float,2>{0.511282444f, 0.925224781f},
-std::array<float,2>{0.0514625683f, 0.673993349f},
-std::array<float,2>{0.779226959f, 0.146428078f},
-std::array<float,2>{0.0870371461f, 0.36885944f},
-std::array<float,2>{0.850383401f, 0.846743762f},
-std::array<float,2>{0.452687144f, 0.528654993f},
-std::array<float,2>{0.59646064f, 0.108824871f},
-std::array<float,2>{0.313968062f, 0.220047846f},
-std::array<float,2>{0.636437297f, 0.718313038f},
-std::array<float,2>{0.161738053f, 0.96747309f},
-std::array<float,2>{0.994617224f, 0.460998297f},
-std::array<float,2>{0.00836004503f, 0.157286435f},
-std::array<float,2>{0.781540692f, 0.653339386f},
-std::array<float,2>{0.411312878f, 0.891797721f},
-std::array<float,2>{0.555893242f, 0.388085335f},
-std::array<float,2>{0.296007395f, 0.270872295f},
-std::array<float,2>{0.717481613f, 0.798281968f},
-std::array<float,2>{0.204477727f, 0.573302746f},
-std::array<float,2>{0.889538288f, 0.0434425399f},
-std::array<float,2>{0.129851803f, 0.468984604f},
-std::array<float,2>{0.95706737f, 0.989669323f},
-std::array<float,2>{0.366402894f, 0.724750459f},
-std::array<float,2>{0.681828082f, 0.213658318f},
-std::array<float,2>{0.492294729f, 0.063432321f},
-std::array<float,2>{0.569439828f, 0.531303883f},
-std::array<float,2>{0.0954573154f, 0.829077721f},
-std::array<float,2>{0.818321884f, 0.314059794f},
-std::array<float,2>{0.132892981f, 0.182246447f},
-std::array<float,2>{0.966870487f, 0.626945496f},
-std::array<float,2>{0.368726015f, 0.879791617f},
-std::array<float,2>{0.673058331f, 0.401967794f},
-std::array<float,2>{0.484527439f, 0.258287966f},
-std::array<float,2>{0.574627817f, 0.784714639f},
-std::array<float,2>{0.10170383f, 0.587683797f},
-std::array<float,2>{0.822431803f, 0.0530140139f},
-std::array<float,2>{0.00612893933f, 0.495806545f},
-std::array<float,2>{0.793318748f, 0.970074296f},
-std::array<float,2>{0.41926524f, 0.740880132f},
-std::array<float,2>{0.55415839f, 0.192888796f},
-std::array<float,2>{0.281354487f, 0.080106616f},
-std::array<float,2>{0.70537889f, 0.557411075f},
-std::array<float,2>{0.213623792f, 0.826888382f},
-std::array<float,2>{0.881791711f, 0.340855509f},
-std::array<float,2>{0.0857669413f, 0.0199527871f},
-std::array<float,2>{0.852106214f, 0.610552549f},
-std::array<float,2>{0.443304688f, 0.77411586f},
-std::array<float,2>{0.603301406f, 0.306557357f},
-std::array<float,2>{0.323860854f, 0.43542099f},
-std::array<float,2>{0.630780756f, 0.906396449f},
-std::array<float,2>{0.164338008f, 0.671260536f},
-std::array<float,2>{0.987547159f, 0.135999024f},
-std::array<float,2>{0.22712703f, 0.347648412f},
-std::array<float,2>{0.932025969f, 0.861093402f},
-std::array<float,2>{0.262831271f, 0.515239239f},
-std::array<float,2>{0.743049741f, 0.11594265f},
-std::array<float,2>{0.40417251f, 0.249561667f},
-std::array<float,2>{0.50391829f, 0.688839197f},
-std::array<float,2>{0.0584903024f, 0.950954139f},
-std::array<float,2>{0.769125521f, 0.440915704f},
-std::array<float,2>{0.19904457f, 0.103543572f},
-std::array<float,2>{0.904773891f, 0.526445687f},
-std::array<float,2>{0.307752669f, 0.847980738f},
-std::array<float,2>{0.701305926f, 0.372613877f},
-std::array<float,2>{0.436395943f, 0.468663484f},
-std::array<float,2>{0.531329513f, 0.964135587f},
-std::array<float,2>{0.0307276249f, 0.713999033f},
-std::array<float,2>{0.804183364f, 0.224860415f},
-std::array<float,2>{0.110678978f, 0.286681592f},
-std::array<float,2>{0.838018715f, 0.761041701f},
-std::array<float,2>{0.476716667f, 0.60022378f},
-std::array<float,2>{0.59033215f, 0.0138383778f},
-std::array<float,2>{0.34457469f, 0.143443957f},
-std::array<float,2>{0.660938561f, 0.676580489f},
-std::array<float,2>{0.141735062f, 0.928059876f},
-std::array<float,2>{0.951013684f, 0.420920014f},
-std::array<float,2>{0.041831661f, 0.218433082f},
-std::array<float,2>{0.759138346f, 0.721432567f},
-std::array<float,2>{0.375057966f, 0.985099494f},
-std::array<float,2>{0.521783948f, 0.472999603f},
-std::array<float,2>{0.27669239f, 0.319499016f},
-std::array<float,2>{0.727514863f, 0.834758341f},
-std::array<float,2>{0.243272901f, 0.537106752f},
-std::array<float,2>{0.91824013f, 0.0677192211f},
-std::array<float,2>{0.174622834f, 0.386545211f},
-std::array<float,2>{0.974005222f, 0.897889614f},
-std::array<float,2>{0.343631655f, 0.651260436f},
-std::array<float,2>{0.655480623f, 0.161615461f},
-std::array<float,2>{0.461530179f, 0.0413054749f},
-std::array<float,2>{0.609816015f, 0.574685156f},
-std::array<float,2>{0.0755051747f, 0.80341357f},
-std::array<float,2>{0.864533365f, 0.26764074f},
-std::array<float,2>{0.234920502f, 0.229252934f},
-std::array<float,2>{0.911390483f, 0.708924532f},
-std::array<float,2>{0.269755661f, 0.96069032f},
-std::array<float,2>{0.723886669f, 0.454734832f},
-std::array<float,2>{0.386465549f, 0.361539006f},
-std::array<float,2>{0.526844025f, 0.854157329f},
-std::array<float,2>{0.0359932445f, 0.516069233f},
-std::array<float,2>{0.754983723f, 0.094686687f},
-std::array<float,2>{0.0645622537f, 0.410493761f},
-std::array<float,2>{0.869586766f, 0.936128795f},
-std::array<float,2>{0.459287196f, 0.683767378f},
-std::array<float,2>{0.622021735f, 0.151630923f},
-std::array<float,2>{0.335303158f, 0.00570857571f},
-std::array<float,2>{0.642912865f, 0.606027544f},
-std::array<float,2>{0.183329314f, 0.75661844f},
-std::array<float,2>{0.984225392f, 0.295427263f},
-std::array<float,2>{0.0177123751f, 0.0731305331f},
-std::array<float,2>{0.808988571f, 0.542472243f},
-std::array<float,2>{0.429109544f, 0.836461544f},
-std::array<float,2>{0.543468535f, 0.325080603f},
-std::array<float,2>{0.30256027f, 0.48357296f},
-std::array<float,2>{0.695121825f, 0.998017907f},
-std::array<float,2>{0.195158005f, 0.727446914f},
-std::array<float,2>{0.892915905f, 0.207029238f},
-std::array<float,2>{0.153709605f, 0.279821485f},
-std::array<float,2>{0.94417721f, 0.808509111f},
-std::array<float,2>{0.357419431f, 0.564353764f},
-std::array<float,2>{0.666544139f, 0.038887497f},
-std::array<float,2>{0.470373243f, 0.16599153f},
-std::array<float,2>{0.579516709f, 0.645746052f},
-std::array<float,2>{0.117523439f, 0.899481416f},
-std::array<float,2>{0.82887435f, 0.375856519f},
-std::array<float,2>{0.157942265f, 0.0585963428f},
-std::array<float,2>{0.997201025f, 0.578407705f},
-std::array<float,2>{0.317371875f, 0.789845705f},
-std::array<float,2>{0.636749983f, 0.256046534f},
-std::array<float,2>{0.449141204f, 0.395678073f},
-std::array<float,2>{0.598162353f, 0.885894001f},
-std::array<float,2>{0.0906269625f, 0.635933042f},
-std::array<float,2>{0.846545219f, 0.174506173f},
-std::array<float,2>{0.0491756387f, 0.335321695f},
-std::array<float,2>{0.774062097f, 0.816926122f},
-std::array<float,2>{0.394768417f, 0.553702891f},
-std::array<float,2>{0.515209973f, 0.0888661742f},
-std::array<float,2>{0.255498201f, 0.200989261f},
-std::array<float,2>{0.740055084f, 0.74397397f},
-std::array<float,2>{0.226115718f, 0.982550144f},
-std::array<float,2>{0.923898041f, 0.490410984f},
-std::array<float,2>{0.0986530259f, 0.128005758f},
-std::array<float,2>{0.813244641f, 0.661065876f},
-std::array<float,2>{0.499306262f, 0.920111477f},
-std::array<float,2>{0.565977335f, 0.427258551f},
-std::array<float,2>{0.360106856f, 0.298546553f},
-std::array<float,2>{0.687333763f, 0.7681126f},
-std::array<float,2>{0.126406208f, 0.617975712f},
-std::array<float,2>{0.953843772f, 0.0264213532f},
-std::array<float,2>{0.20826076f, 0.446497709f},
-std::array<float,2>{0.883233666f, 0.945188463f},
-std::array<float,2>{0.291313469f, 0.702215016f},
-std::array<float,2>{0.714516163f, 0.240107313f},
-std::array<float,2>{0.408948958f, 0.124683343f},
-std::array<float,2>{0.561584592f, 0.503847718f},
-std::array<float,2>{0.0143348612f, 0.873123229f},
-std::array<float,2>{0.787094533f, 0.352033645f},
-std::array<float,2>{0.23371394f, 0.170249149f},
-std::array<float,2>{0.93706435f, 0.644311965f},
-std::array<float,2>{0.260315001f, 0.903399348f},
-std::array<float,2>{0.749969184f, 0.3814134f},
-std::array<float,2>{0.398525506f, 0.273937643f},
-std::array<float,2>{0.503847897f, 0.808654785f},
-std::array<float,2>{0.0621037222f, 0.569651067f},
-std::array<float,2>{0.772056103f, 0.0326621681f},
-std::array<float,2>{0.0795683712f, 0.47670126f},
-std::array<float,2>{0.857262731f, 0.995550573f},
-std::array<float,2>{0.437894583f, 0.733077645f},
-std::array<float,2>{0.608954251f, 0.207952619f},
-std::array<float,2>{0.325439394f, 0.0760940388f},
-std::array<float,2>{0.62590158f, 0.543927789f},
-std::array<float,2>{0.168688685f, 0.843036056f},
-std::array<float,2>{0.992087185f, 0.321193159f},
-std::array<float,2>{0.00312768365f, 0.00323863444f},
-std::array<float,2>{0.791778326f, 0.603356838f},
-std::array<float,2>{0.414240032f, 0.752607107f},
-std::array<float,2>{0.547172725f, 0.290611744f},
-std::array<float,2>{0.288104504f, 0.410044938f},
-std::array<float,2>{0.708315432f, 0.930835307f},
-std::array<float,2>{0.216779649f, 0.679718316f},
-std::array<float,2>{0.877949595f, 0.15248771f},
-std::array<float,2>{0.13676779f, 0.365886003f},
-std::array<float,2>{0.962939501f, 0.85790652f},
-std::array<float,2>{0.371253252f, 0.52075243f},
-std::array<float,2>{0.677041829f, 0.0991658866f},
-std::array<float,2>{0.49215734f, 0.230914682f},
-std::array<float,2>{0.572379947f, 0.7059201f},
-std::array<float,2>{0.107511483f, 0.954462528f},
-std::array<float,2>{0.827715516f, 0.45908922f},
-std::array<float,2>{0.176555678f, 0.117648475f},
-std::array<float,2>{0.971488237f, 0.504696906f},
-std::array<float,2>{0.338828981f, 0.869035602f},
-std::array<float,2>{0.648919344f, 0.356886566f},
-std::array<float,2>{0.466846228f, 0.452010572f},
-std::array<float,2>{0.613952994f, 0.937647223f},
-std::array<float,2>{0.0704604089f, 0.696683347f},
-std::array<float,2>{0.861374855f, 0.234702736f},
-std::array<float,2>{0.0464119315f, 0.303352416f},
-std::array<float,2>{0.763310254f, 0.772307575f},
-std::array<float,2>{0.381242305f, 0.621780276f},
-std::array<float,2>{0.517840207f, 0.030516034f},
-std::array<float,2>{0.277419955f, 0.132130966f},
-std::array<float,2>{0.732655108f, 0.65776521f},
-std::array<float,2>{0.24932766f, 0.917544663f},
-std::array<float,2>{0.914808869f, 0.423153877f},
-std::array<float,2>{0.115729541f, 0.196362063f},
-std::array<float,2>{0.841601849f, 0.749631464f},
-std::array<float,2>{0.481881052f, 0.978845835f},
-std::array<float,2>{0.587826431f, 0.487328619f},
-std::array<float,2>{0.349314034f, 0.332012475f},
-std::array<float,2>{0.658898413f, 0.814864933f},
-std::array<float,2>{0.147913381f, 0.549412608f},
-std::array<float,2>{0.947266996f, 0.0930480883f},
-std::array<float,2>{0.200824171f, 0.391649038f},
-std::array<float,2>{0.901985347f, 0.89021951f},
-std::array<float,2>{0.308684945f, 0.638773024f},
-std::array<float,2>{0.695315957f, 0.17902194f},
-std::array<float,2>{0.430175692f, 0.057307709f},
-std::array<float,2>{0.537716627f, 0.582316458f},
-std::array<float,2>{0.0239100493f, 0.795304596f},
-std::array<float,2>{0.79890734f, 0.251587808f},
-std::array<float,2>{0.150460884f, 0.24456653f},
-std::array<float,2>{0.939879179f, 0.694419861f},
-std::array<float,2>{0.351838112f, 0.948338687f},
-std::array<float,2>{0.67039746f, 0.444285214f},
-std::array<float,2>{0.475735873f, 0.347757697f},
-std::array<float,2>{0.583061635f, 0.864626765f},
-std::array<float,2>{0.124566697f, 0.510006666f},
-std::array<float,2>{0.835669875f, 0.110017657f},
-std::array<float,2>{0.0216168314f, 0.430686682f},
-std::array<float,2>{0.805739224f, 0.912916958f},
-std::array<float,2>{0.423175216f, 0.666098654f},
-std::array<float,2>{0.540581107f, 0.136730224f},
-std::array<float,2>{0.300266445f, 0.0170522574f},
-std::array<float,2>{0.690704584f, 0.613620281f},
-std::array<float,2>{0.191079825f, 0.780124009f},
-std::array<float,2>{0.895689547f, 0.312363505f},
-std::array<float,2>{0.068875581f, 0.0840754434f},
-std::array<float,2>{0.874274731f, 0.562014163f},
-std::array<float,2>{0.455657333f, 0.821686566f},
-std::array<float,2>{0.620544076f, 0.337883115f},
-std::array<float,2>{0.328955621f, 0.497207403f},
-std::array<float,2>{0.645288467f, 0.973940432f},
-std::array<float,2>{0.18672578f, 0.73796773f},
-std::array<float,2>{0.977911353f, 0.191094667f},
-std::array<float,2>{0.240769356f, 0.26312083f},
-std::array<float,2>{0.908669293f, 0.787538707f},
-std::array<float,2>{0.268205166f, 0.592692733f},
-std::array<float,2>{0.721215129f, 0.0473650098f},
-std::array<float,2>{0.390201211f, 0.184401006f},
-std::array<float,2>{0.52923131f, 0.630925834f},
-std::array<float,2>{0.0332107246f, 0.875866175f},
-std::array<float,2>{0.753465593f, 0.404786557f},
-std::array<float,2>{0.206823543f, 0.0456405804f},
-std::array<float,2>{0.888043523f, 0.571241677f},
-std::array<float,2>{0.293892026f, 0.799954355f},
-std::array<float,2>{0.716257632f, 0.271802396f},
-std::array<float,2>{0.413653404f, 0.390390098f},
-std::array<float,2>{0.557005644f, 0.893315136f},
-std::array<float,2>{0.0104688816f, 0.656104088f},
-std::array<float,2>{0.783303678f, 0.159968764f},
-std::array<float,2>{0.0966420174f, 0.315490752f},
-std::array<float,2>{0.819440782f, 0.831427395f},
-std::array<float,2>{0.494223505f, 0.534498632f},
-std::array<float,2>{0.568200111f, 0.0651480779f},
-std::array<float,2>{0.365130574f, 0.212470785f},
-std::array<float,2>{0.680347204f, 0.722903132f},
-std::array<float,2>{0.132221058f, 0.991196632f},
-std::array<float,2>{0.960385621f, 0.471967429f},
-std::array<float,2>{0.0528709926f, 0.148358896f},
-std::array<float,2>{0.780504405f, 0.673652351f},
-std::array<float,2>{0.393002808f, 0.923564136f},
-std::array<float,2>{0.509432375f, 0.414279372f},
-std::array<float,2>{0.250818908f, 0.284438699f},
-std::array<float,2>{0.737481475f, 0.76220125f},
-std::array<float,2>{0.220001146f, 0.595838845f},
-std::array<float,2>{0.926093638f, 0.0079599442f},
-std::array<float,2>{0.163849965f, 0.464490324f},
-std::array<float,2>{0.993082762f, 0.966119885f},
-std::array<float,2>{0.315900445f, 0.715299845f},
-std::array<float,2>{0.63426578f, 0.22140412f},
-std::array<float,2>{0.4507052f, 0.106443271f},
-std::array<float,2>{0.594877839f, 0.531141043f},
-std::array<float,2>{0.0896059275f, 0.844576836f},
-std::array<float,2>{0.848604679f, 0.370766431f},
-std::array<float,2>{0.167938918f, 0.133518711f},
-std::array<float,2>{0.985840857f, 0.669609845f},
-std::array<float,2>{0.321613193f, 0.908705592f},
-std::array<float,2>{0.632425845f, 0.43603301f},
-std::array<float,2>{0.444409698f, 0.306923628f},
-std::array<float,2>{0.60489583f, 0.775670886f},
-std::array<float,2>{0.0835015923f, 0.611360252f},
-std::array<float,2>{0.853988826f, 0.0224633813f},
-std::array<float,2>{0.0565481819f, 0.43756333f},
-std::array<float,2>{0.765888691f, 0.951251507f},
-std::array<float,2>{0.404632837f, 0.69094944f},
-std::array<float,2>{0.505952358f, 0.247965798f},
-std::array<float,2>{0.264175296f, 0.113319606f},
-std::array<float,2>{0.744538128f, 0.513153672f},
-std::array<float,2>{0.229223132f, 0.862972319f},
-std::array<float,2>{0.929890573f, 0.343975723f},
-std::array<float,2>{0.10450533f, 0.0524625666f},
-std::array<float,2>{0.820976675f, 0.589594126f},
-std::array<float,2>{0.487941891f, 0.782869399f},
-std::array<float,2>{0.577797651f, 0.261265993f},
-std::array<float,2>{0.370222598f, 0.399439007f},
-std::array<float,2>{0.674846947f, 0.882103384f},
-std::array<float,2>{0.135035217f, 0.628873169f},
-std::array<float,2>{0.965447366f, 0.180876702f},
-std::array<float,2>{0.21095711f, 0.34205237f},
-std::array<float,2>{0.879805684f, 0.825930834f},
-std::array<float,2>{0.285123467f, 0.55557245f},
-std::array<float,2>{0.70426625f, 0.0785971209f},
-std::array<float,2>{0.420336396f, 0.193736494f},
-std::array<float,2>{0.552227616f, 0.738411307f},
-std::array<float,2>{0.0057312171f, 0.971377015f},
-std::array<float,2>{0.796830297f, 0.494051158f},
-std::array<float,2>{0.244773075f, 0.0689229071f},
-std::array<float,2>{0.920863509f, 0.537399352f},
-std::array<float,2>{0.274863929f, 0.832755625f},
-std::array<float,2>{0.72872442f, 0.317095131f},
-std::array<float,2>{0.378043711f, 0.475613415f},
-std::array<float,2>{0.520822048f, 0.986902237f},
-std::array<float,2>{0.0396378487f, 0.71944952f},
-std::array<float,2>{0.760863125f, 0.216603339f},
-std::array<float,2>{0.0770603791f, 0.267284244f},
-std::array<float,2>{0.865326405f, 0.802605093f},
-std::array<float,2>{0.464522421f, 0.576203525f},
-std::array<float,2>{0.61310786f, 0.0400358737f},
-std::array<float,2>{0.339852512f, 0.163642213f},
-std::array<float,2>{0.65300566f, 0.649645746f},
-std::array<float,2>{0.172663048f, 0.896147311f},
-std::array<float,2>{0.975470781f, 0.382904232f},
-std::array<float,2>{0.0284169298f, 0.222897112f},
-std::array<float,2>{0.800873399f, 0.712192178f},
-std::array<float,2>{0.43426156f, 0.961684585f},
-std::array<float,2>{0.533790529f, 0.465856105f},
-std::array<float,2>{0.306075662f, 0.374912173f},
-std::array<float,2>{0.699627519f, 0.850228369f},
-std::array<float,2>{0.196077734f, 0.524626493f},
-std::array<float,2>{0.902702451f, 0.101898037f},
-std::array<float,2>{0.143112242f, 0.419588834f},
-std::array<float,2>{0.952061176f, 0.926382482f},
-std::array<float,2>{0.347123027f, 0.678399682f},
-std::array<float,2>{0.662814558f, 0.142315224f},
-std::array<float,2>{0.478548676f, 0.0135384258f},
-std::array<float,2>{0.592299461f, 0.598402381f},
-std::array<float,2>{0.112263918f, 0.759228051f},
-std::array<float,2>{0.83695066f, 0.287169784f},
-std::array<float,2>{0.193318725f, 0.203423768f},
-std::array<float,2>{0.892513037f, 0.729329348f},
-std::array<float,2>{0.304172546f, 0.999261379f},
-std::array<float,2>{0.692954421f, 0.481531233f},
-std::array<float,2>{0.426161379f, 0.327923149f},
-std::array<float,2>{0.545344591f, 0.838971376f},
-std::array<float,2>{0.0165097546f, 0.539630532f},
-std::array<float,2>{0.812400758f, 0.0716922656f},
-std::array<float,2>{0.120383605f, 0.377188265f},
-std::array<float,2>{0.831393957f, 0.902245224f},
-std::array<float,2>{0.470952719f, 0.647108495f},
-std::array<float,2>{0.580526531f, 0.167841122f},
-std::array<float,2>{0.35776931f, 0.03559874f},
-std::array<float,2>{0.665705681f, 0.565336704f},
-std::array<float,2>{0.154907539f, 0.806031406f},
-std::array<float,2>{0.942273617f, 0.277439088f},
-std::array<float,2>{0.0379456356f, 0.0964358822f},
-std::array<float,2>{0.756951213f, 0.518183649f},
-std::array<float,2>{0.383597195f, 0.85339576f},
-std::array<float,2>{0.525038123f, 0.361060321f},
-std::array<float,2>{0.272464216f, 0.456405312f},
-std::array<float,2>{0.725293696f, 0.958852172f},
-std::array<float,2>{0.236840844f, 0.710737348f},
-std::array<float,2>{0.912231028f, 0.226802573f},
-std::array<float,2>{0.18081978f, 0.293711036f},
-std::array<float,2>{0.982090652f, 0.755001783f},
-std::array<float,2>{0.33228907f, 0.608694017f},
-std::array<float,2>{0.641951323f, 0.00615778519f},
-std::array<float,2>{0.458601028f, 0.149688005f},
-std::array<float,2>{0.623735726f, 0.686787784f},
-std::array<float,2>{0.0631612241f, 0.935347557f},
-std::array<float,2>{0.868628621f, 0.413746983f},
-std::array<float,2>{0.128557771f, 0.0241951868f},
-std::array<float,2>{0.955242693f, 0.619354784f},
-std::array<float,2>{0.362591594f, 0.766470194f},
-std::array<float,2>{0.684021115f, 0.299530476f},
-std::array<float,2>{0.49649936f, 0.429556936f},
-std::array<float,2>{0.563332319f, 0.918321669f},
-std::array<float,2>{0.100807242f, 0.66347003f},
-std::array<float,2>{0.815506876f, 0.126140535f},
-std::array<float,2>{0.0118375933f, 0.355127603f},
-std::array<float,2>{0.788135171f, 0.872133553f},
-std::array<float,2>{0.406916976f, 0.501687825f},
-std::array<float,2>{0.560258865f, 0.121142812f},
-std::array<float,2>{0.290555865f, 0.240998268f},
-std::array<float,2>{0.712303102f, 0.700097442f},
-std::array<float,2>{0.210403115f, 0.941982865f},
-std::array<float,2>{0.885644495f, 0.448609263f},
-std::array<float,2>{0.0936153308f, 0.172796071f},
-std::array<float,2>{0.844170511f, 0.634308279f},
-std::array<float,2>{0.447156072f, 0.883799255f},
-std::array<float,2>{0.60131216f, 0.397689193f},
-std::array<float,2>{0.31867069f, 0.255813003f},
-std::array<float,2>{0.640535772f, 0.791646421f},
-std::array<float,2>{0.159011811f, 0.581903875f},
-std::array<float,2>{0.998563647f, 0.0614587329f},
-std::array<float,2>{0.223243147f, 0.489168525f},
-std::array<float,2>{0.923756063f, 0.981963038f},
-std::array<float,2>{0.256983966f, 0.744563043f},
-std::array<float,2>{0.74107188f, 0.201968819f},
-std::array<float,2>{0.397101015f, 0.0867911428f},
-std::array<float,2>{0.513633609f, 0.551635385f},
-std::array<float,2>{0.0470601283f, 0.818537533f},
-std::array<float,2>{0.776943803f, 0.333228797f},
-std::array<float,2>{0.204927489f, 0.159467608f},
-std::array<float,2>{0.888981104f, 0.655370057f},
-std::array<float,2>{0.296803087f, 0.892773807f},
-std::array<float,2>{0.717074692f, 0.390069216f},
-std::array<float,2>{0.411888182f, 0.272422522f},
-std::array<float,2>{0.556537449f, 0.800577044f},
-std::array<float,2>{0.0079228133f, 0.570319355f},
-std::array<float,2>{0.781938314f, 0.0452168211f},
-std::array<float,2>{0.0950386971f, 0.47248742f},
-std::array<float,2>{0.817565799f, 0.990467966f},
-std::array<float,2>{0.492825061f, 0.723364949f},
-std::array<float,2>{0.57011354f, 0.212362632f},
-std::array<float,2>{0.366837591f, 0.0644870922f},
-std::array<float,2>{0.682581425f, 0.534810483f},
-std::array<float,2>{0.129104927f, 0.831578135f},
-std::array<float,2>{0.957966566f, 0.315924764f},
-std::array<float,2>{0.0512037501f, 0.00831121858f},
-std::array<float,2>{0.778540552f, 0.596545517f},
-std::array<float,2>{0.391761929f, 0.762521446f},
-std::array<float,2>{0.51117152f, 0.284948856f},
-std::array<float,2>{0.252392709f, 0.414882421f},
-std::array<float,2>{0.735975146f, 0.923307717f},
-std::array<float,2>{0.220992684f, 0.673279107f},
-std::array<float,2>{0.929292738f, 0.14761962f},
-std::array<float,2>{0.161297679f, 0.370315403f},
-std::array<float,2>{0.995072722f, 0.843759894f},
-std::array<float,2>{0.313908666f, 0.530615807f},
-std::array<float,2>{0.636147022f, 0.105639383f},
-std::array<float,2>{0.452425659f, 0.220864058f},
-std::array<float,2>{0.596171379f, 0.715524971f},
-std::array<float,2>{0.0877140388f, 0.966597378f},
-std::array<float,2>{0.849994838f, 0.464004338f},
-std::array<float,2>{0.149751842f, 0.109792382f},
-std::array<float,2>{0.937746644f, 0.510696352f},
-std::array<float,2>{0.354020715f, 0.864999175f},
-std::array<float,2>{0.669178069f, 0.3484447f},
-std::array<float,2>{0.473618329f, 0.443778843f},
-std::array<float,2>{0.585740983f, 0.948746979f},
-std::array<float,2>{0.121754184f, 0.694878161f},
-std::array<float,2>{0.832615614f, 0.244631067f},
-std::array<float,2>{0.021354394f, 0.311528802f},
-std::array<float,2>{0.808161974f, 0.779437125f},
-std::array<float,2>{0.424123317f, 0.613907814f},
-std::array<float,2>{0.541123211f, 0.0171512067f},
-std::array<float,2>{0.298308343f, 0.137362033f},
-std::array<float,2>{0.688339651f, 0.666894078f},
-std::array<float,2>{0.187920675f, 0.912151754f},
-std::array<float,2>{0.897392392f, 0.431627423f},
-std::array<float,2>{0.0676588416f, 0.190881774f},
-std::array<float,2>{0.871813774f, 0.737511098f},
-std::array<float,2>{0.454769373f, 0.974204004f},
-std::array<float,2>{0.618643045f, 0.49768886f},
-std::array<float,2>{0.330419421f, 0.337001503f},
-std::array<float,2>{0.648375332f, 0.822016358f},
-std::array<float,2>{0.185049176f, 0.561784804f},
-std::array<float,2>{0.979545653f, 0.0847395509f},
-std::array<float,2>{0.238611728f, 0.404635102f},
-std::array<float,2>{0.906920671f, 0.87514025f},
-std::array<float,2>{0.266974211f, 0.631426096f},
-std::array<float,2>{0.718911111f, 0.183991864f},
-std::array<float,2>{0.387716174f, 0.0469419174f},
-std::array<float,2>{0.530425787f, 0.592123687f},
-std::array<float,2>{0.0316756256f, 0.78762579f},
-std::array<float,2>{0.750223339f, 0.263304293f},
-std::array<float,2>{0.178926334f, 0.235319972f},
-std::array<float,2>{0.969160557f, 0.697039604f},
-std::array<float,2>{0.337142467f, 0.938075125f},
-std::array<float,2>{0.650496781f, 0.451364756f},
-std::array<float,2>{0.466599435f, 0.35739246f},
-std::array<float,2>{0.61714983f, 0.86832267f},
-std::array<float,2>{0.0727489293f, 0.503958225f},
-std::array<float,2>{0.860007465f, 0.117756099f},
-std::array<float,2>{0.0439893901f, 0.423599184f},
-std::array<float,2>{0.764471292f, 0.917174578f},
-std::array<float,2>{0.379903555f, 0.657559872f},
-std::array<float,2>{0.517149448f, 0.132354125f},
-std::array<float,2>{0.279370874f, 0.0307757966f},
-std::array<float,2>{0.731273293f, 0.621094525f},
-std::array<float,2>{0.2469154f, 0.771789789f},
-std::array<float,2>{0.917222202f, 0.302987337f},
-std::array<float,2>{0.115004778f, 0.0933944955f},
-std::array<float,2>{0.84302628f, 0.548989177f},
-std::array<float,2>{0.483730942f, 0.815184414f},
-std::array<float,2>{0.588185132f, 0.331306636f},
-std::array<float,2>{0.351260573f, 0.488143235f},
-std::array<float,2>{0.657270849f, 0.979019582f},
-std::array<float,2>{0.146218792f, 0.749497354f},
-std::array<float,2>{0.947110355f, 0.196884871f},
-std::array<float,2>{0.201545373f, 0.251268178f},
-std::array<float,2>{0.899988115f, 0.795815706f},
-std::array<float,2>{0.310967267f, 0.582807541f},
-std::array<float,2>{0.698349357f, 0.0569271334f},
-std::array<float,2>{0.432976454f, 0.179213762f},
-std::array<float,2>{0.535383046f, 0.639513195f},
-std::array<float,2>{0.0269297287f, 0.890074134f},
-std::array<float,2>{0.797465324f, 0.392444551f},
-std::array<float,2>{0.230794281f, 0.032831382f},
-std::array<float,2>{0.934317291f, 0.569916904f},
-std::array<float,2>{0.258582503f, 0.809227586f},
-std::array<float,2>{0.746314228f, 0.273620695f},
-std::array<float,2>{0.401524335f, 0.380950153f},
-std::array<float,2>{0.501033425f, 0.90391475f},
-std::array<float,2>{0.0591274761f, 0.644042611f},
-std::array<float,2>{0.770351648f, 0.170700878f},
-std::array<float,2>{0.0805569515f, 0.320755184f},
-std::array<float,2>{0.858316898f, 0.843725085f},
-std::array<float,2>{0.439609885f, 0.542985916f},
-std::array<float,2>{0.607262969f, 0.0753142238f},
-std::array<float,2>{0.327231228f, 0.20721589f},
-std::array<float,2>{0.627100408f, 0.732773244f},
-std::array<float,2>{0.171026498f, 0.995877683f},
-std::array<float,2>{0.988501489f, 0.477128655f},
-std::array<float,2>{0.00104160002f, 0.153024063f},
-std::array<float,2>{0.790181518f, 0.680569649f},
-std::array<float,2>{0.417350322f, 0.93159765f},
-std::array<float,2>{0.550576329f, 0.409580112f},
-std::array<float,2>{0.28560251f, 0.290506274f},
-std::array<float,2>{0.709705234f, 0.752139628f},
-std::array<float,2>{0.217471644f, 0.602778733f},
-std::array<float,2>{0.876938879f, 0.00386854564f},
-std::array<float,2>{0.140023574f, 0.459765613f},
-std::array<float,2>{0.960987329f, 0.954952478f},
-std::array<float,2>{0.374199808f, 0.705435872f},
-std::array<float,2>{0.678661466f, 0.231021091f},
-std::array<float,2>{0.488917232f, 0.0989223048f},
-std::array<float,2>{0.570650339f, 0.521228313f},
-std::array<float,2>{0.105641216f, 0.857915044f},
-std::array<float,2>{0.824888706f, 0.365466058f},
-std::array<float,2>{0.126770929f, 0.126935154f},
-std::array<float,2>{0.953342974f, 0.663644969f},
-std::array<float,2>{0.359472394f, 0.918766797f},
-std::array<float,2>{0.686738491f, 0.428913265f},
-std::array<float,2>{0.499788225f, 0.299265116f},
-std::array<float,2>{0.565827966f, 0.765863299f},
-std::array<float,2>{0.0994037539f, 0.619858801f},
-std::array<float,2>{0.812693655f, 0.023718765f},
-std::array<float,2>{0.0140598575f, 0.449030459f},
-std::array<float,2>{0.786609948f, 0.941829324f},
-std::array<float,2>{0.408585131f, 0.699609935f},
-std::array<float,2>{0.562089145f, 0.240317211f},
-std::array<float,2>{0.291803062f, 0.121741027f},
-std::array<float,2>{0.713928282f, 0.501345336f},
-std::array<float,2>{0.208901733f, 0.872753382f},
-std::array<float,2>{0.883532882f, 0.354900122f},
-std::array<float,2>{0.0902007744f, 0.0608700849f},
-std::array<float,2>{0.845914483f, 0.58109659f},
-std::array<float,2>{0.44836086f, 0.791458011f},
-std::array<float,2>{0.59810251f, 0.255081952f},
-std::array<float,2>{0.31682691f, 0.398320168f},
-std::array<float,2>{0.637471914f, 0.884638608f},
-std::array<float,2>{0.157397926f, 0.634097338f},
-std::array<float,2>{0.997777402f, 0.172160849f},
-std::array<float,2>{0.226048306f, 0.333880126f},
-std::array<float,2>{0.9244712f, 0.819311917f},
-std::array<float,2>{0.255115122f, 0.551170051f},
-std::array<float,2>{0.739659488f, 0.0863004401f},
-std::array<float,2>{0.395409644f, 0.201537445f},
-std::array<float,2>{0.514832079f, 0.745108783f},
-std::array<float,2>{0.0493903123f, 0.981716156f},
-std::array<float,2>{0.773460507f, 0.488483876f},
-std::array<float,2>{0.194344714f, 0.0718195513f},
-std::array<float,2>{0.893298745f, 0.539440036f},
-std::array<float,2>{0.302030951f, 0.839548588f},
-std::array<float,2>{0.69475323f, 0.327228248f},
-std::array<float,2>{0.42920354f, 0.482106835f},
-std::array<float,2>{0.543242693f, 0.999568999f},
-std::array<float,2>{0.0183287542f, 0.728954434f},
-std::array<float,2>{0.809155226f, 0.203913361f},
-std::array<float,2>{0.117718361f, 0.278143883f},
-std::array<float,2>{0.828197598f, 0.806234181f},
-std::array<float,2>{0.469918787f, 0.564646661f},
-std::array<float,2>{0.580074131f, 0.0360420346f},
-std::array<float,2>{0.356722564f, 0.167156652f},
-std::array<float,2>{0.666204631f, 0.646499753f},
-std::array<float,2>{0.154015973f, 0.90171212f},
-std::array<float,2>{0.94374907f, 0.377445012f},
-std::array<float,2>{0.0355985127f, 0.227142587f},
-std::array<float,2>{0.755850434f, 0.710347831f},
-std::array<float,2>{0.385969788f, 0.958356261f},
-std::array<float,2>{0.526977777f, 0.45670554f},
-std::array<float,2>{0.270129144f, 0.360716134f},
-std::array<float,2>{0.724310577f, 0.85274452f},
-std::array<float,2>{0.234809801f, 0.517843425f},
-std::array<float,2>{0.912051678f, 0.0958525464f},
-std::array<float,2>{0.182617873f, 0.413088828f},
-std::array<float,2>{0.983778596f, 0.934701025f},
-std::array<float,2>{0.335608274f, 0.687188983f},
-std::array<float,2>{0.643403649f, 0.149998173f},
-std::array<float,2>{0.459490776f, 0.00643306738f},
-std::array<float,2>{0.62113899f, 0.609286845f},
-std::array<float,2>{0.0653597787f, 0.755589306f},
-std::array<float,2>{0.869639635f, 0.29337886f},
-std::array<float,2>{0.244070783f, 0.216061234f},
-std::array<float,2>{0.918600619f, 0.718984783f},
-std::array<float,2>{0.277244776f, 0.986664295f},
-std::array<float,2>{0.727021873f, 0.476557523f},
-std::array<float,2>{0.375905931f, 0.316770762f},
-std::array<float,2>{0.522060037f, 0.832500577f},
-std::array<float,2>{0.0412237868f, 0.537743449f},
-std::array<float,2>{0.759427369f, 0.0687581971f},
-std::array<float,2>{0.0759753436f, 0.38366735f},
-std::array<float,2>{0.865071595f, 0.895700514f},
-std::array<float,2>{0.460957021f, 0.650190532f},
-std::array<float,2>{0.610149562f, 0.163544551f},
-std::array<float,2>{0.343000025f, 0.0393770784f},
-std::array<float,2>{0.656119406f, 0.577018797f},
-std::array<float,2>{0.174230248f, 0.802141905f},
-std::array<float,2>{0.974486709f, 0.266904086f},
-std::array<float,2>{0.0309656821f, 0.102166437f},
-std::array<float,2>{0.804418385f, 0.52510798f},
-std::array<float,2>{0.435693681f, 0.849850357f},
-std::array<float,2>{0.532075346f, 0.374237061f},
-std::array<float,2>{0.308275431f, 0.466671467f},
-std::array<float,2>{0.702031493f, 0.96129775f},
-std::array<float,2>{0.198553443f, 0.712413311f},
-std::array<float,2>{0.904991269f, 0.223420084f},
-std::array<float,2>{0.142185226f, 0.288079828f},
-std::array<float,2>{0.950651348f, 0.759420514f},
-std::array<float,2>{0.344136119f, 0.597988486f},
-std::array<float,2>{0.660192072f, 0.0131439529f},
-std::array<float,2>{0.477516383f, 0.142026663f},
-std::array<float,2>{0.590033948f, 0.678124309f},
-std::array<float,2>{0.110926531f, 0.926190853f},
-std::array<float,2>{0.838593602f, 0.419259638f},
-std::array<float,2>{0.164643228f, 0.0232973751f},
-std::array<float,2>{0.987813294f, 0.611904562f},
-std::array<float,2>{0.323288202f, 0.776020885f},
-std::array<float,2>{0.630257428f, 0.307316601f},
-std::array<float,2>{0.442643106f, 0.43641752f},
-std::array<float,2>{0.602981508f, 0.908604264f},
-std::array<float,2>{0.0852332041f, 0.669035077f},
-std::array<float,2>{0.851569176f, 0.132856265f},
-std::array<float,2>{0.057856407f, 0.344583601f},
-std::array<float,2>{0.768835843f, 0.862523913f},
-std::array<float,2>{0.40333271f, 0.513291478f},
-std::array<float,2>{0.504450977f, 0.114012308f},
-std::array<float,2>{0.2632671f, 0.247264907f},
-std::array<float,2>{0.742240489f, 0.690902531f},
-std::array<float,2>{0.226811364f, 0.952010155f},
-std::array<float,2>{0.93249464f, 0.43843931f},
-std::array<float,2>{0.102461882f, 0.181292608f},
-std::array<float,2>{0.823082089f, 0.628266156f},
-std::array<float,2>{0.485066861f, 0.882657766f},
-std::array<float,2>{0.574819148f, 0.400145084f},
-std::array<float,2>{0.368516207f, 0.260924041f},
-std::array<float,2>{0.673391581f, 0.782515705f},
-std::array<float,2>{0.133380875f, 0.589032292f},
-std::array<float,2>{0.967508554f, 0.0519195087f},
-std::array<float,2>{0.21321556f, 0.493214697f},
-std::array<float,2>{0.880905509f, 0.971137106f},
-std::array<float,2>{0.282181323f, 0.73923105f},
-std::array<float,2>{0.705815196f, 0.194072351f},
-std::array<float,2>{0.419796228f, 0.0787054077f},
-std::array<float,2>{0.554256022f, 0.554944873f},
-std::array<float,2>{0.00663838768f, 0.825347066f},
-std::array<float,2>{0.793830395f, 0.342310786f},
-std::array<float,2>{0.22059533f, 0.145556182f},
-std::array<float,2>{0.92644906f, 0.674359381f},
-std::array<float,2>{0.250252098f, 0.925504386f},
-std::array<float,2>{0.737874269f, 0.417410135f},
-std::array<float,2>{0.393181801f, 0.281289071f},
-std::array<float,2>{0.509168804f, 0.76505053f},
-std::array<float,2>{0.0535370596f, 0.594870687f},
-std::array<float,2>{0.780792534f, 0.0111229038f},
-std::array<float,2>{0.0892090723f, 0.461663306f},
-std::array<float,2>{0.847786307f, 0.967197001f},
-std::array<float,2>{0.450222939f, 0.717805445f},
-std::array<float,2>{0.59522891f, 0.220249847f},
-std::array<float,2>{0.316220164f, 0.109282389f},
-std::array<float,2>{0.634513497f, 0.528852701f},
-std::array<float,2>{0.1632763f, 0.847232997f},
-std::array<float,2>{0.992604077f, 0.368307322f},
-std::array<float,2>{0.00982520264f, 0.0438600816f},
-std::array<float,2>{0.784049451f, 0.573826313f},
-std::array<float,2>{0.41333878f, 0.798565209f},
-std::array<float,2>{0.557482362f, 0.271356881f},
-std::array<float,2>{0.293125778f, 0.388252228f},
-std::array<float,2>{0.716340423f, 0.892101586f},
-std::array<float,2>{0.206102878f, 0.654248953f},
-std::array<float,2>{0.888535023f, 0.157899439f},
-std::array<float,2>{0.132350489f, 0.313537955f},
-std::array<float,2>{0.960545957f, 0.828171432f},
-std::array<float,2>{0.36437878f, 0.532191575f},
-std::array<float,2>{0.679753542f, 0.062654309f},
-std::array<float,2>{0.495010942f, 0.213193744f},
-std::array<float,2>{0.567843735f, 0.725283146f},
-std::array<float,2>{0.0960306302f, 0.989927649f},
-std::array<float,2>{0.819924355f, 0.469630927f},
-std::array<float,2>{0.18734096f, 0.082388714f},
-std::array<float,2>{0.978341222f, 0.560120583f},
-std::array<float,2>{0.328557372f, 0.822942793f},
-std::array<float,2>{0.644769251f, 0.338211358f},
-std::array<float,2>{0.455413878f, 0.498502493f},
-std::array<float,2>{0.620817006f, 0.976065814f},
-std::array<float,2>{0.0684569702f, 0.735491157f},
-std::array<float,2>{0.874887526f, 0.189327613f},
-std::array<float,2>{0.033870969f, 0.26371628f},
-std::array<float,2>{0.753191471f, 0.785174787f},
-std::array<float,2>{0.38971591f, 0.590822041f},
-std::array<float,2>{0.528549612f, 0.0498351902f},
-std::array<float,2>{0.267596036f, 0.185853317f},
-std::array<float,2>{0.72092998f, 0.629426956f},
-std::array<float,2>{0.240256429f, 0.878489554f},
-std::array<float,2>{0.908929586f, 0.40264082f},
-std::array<float,2>{0.124495015f, 0.243133798f},
-std::array<float,2>{0.83530122f, 0.69184798f},
-std::array<float,2>{0.476421982f, 0.946241975f},
-std::array<float,2>{0.583540857f, 0.442344487f},
-std::array<float,2>{0.352400959f, 0.351443559f},
-std::array<float,2>{0.670890331f, 0.867070615f},
-std::array<float,2>{0.151314527f, 0.508585095f},
-std::array<float,2>{0.940424323f, 0.113202058f},
-std::array<float,2>{0.190518528f, 0.431935459f},
-std::array<float,2>{0.896065831f, 0.911896586f},
-std::array<float,2>{0.300565422f, 0.664244592f},
-std::array<float,2>{0.691304088f, 0.1390495f},
-std::array<float,2>{0.423733473f, 0.0184004512f},
-std::array<float,2>{0.540147901f, 0.615619481f},
-std::array<float,2>{0.0223387405f, 0.777578354f},
-std::array<float,2>{0.806228459f, 0.308881581f},
-std::array<float,2>{0.148248047f, 0.199093133f},
-std::array<float,2>{0.948011756f, 0.746826351f},
-std::array<float,2>{0.349108785f, 0.977349818f},
-std::array<float,2>{0.658576071f, 0.486038983f},
-std::array<float,2>{0.482000291f, 0.328274012f},
-std::array<float,2>{0.586943209f, 0.813360751f},
-std::array<float,2>{0.115411274f, 0.547047913f},
-std::array<float,2>{0.841231525f, 0.0901985914f},
-std::array<float,2>{0.0243391469f, 0.394233525f},
-std::array<float,2>{0.799445629f, 0.887944639f},
-std::array<float,2>{0.430614531f, 0.637576818f},
-std::array<float,2>{0.537414551f, 0.175843954f},
-std::array<float,2>{0.309167087f, 0.0566191524f},
-std::array<float,2>{0.695857406f, 0.585681438f},
-std::array<float,2>{0.200239241f, 0.793187082f},
-std::array<float,2>{0.901461065f, 0.253704369f},
-std::array<float,2>{0.0711001232f, 0.119796149f},
-std::array<float,2>{0.862213075f, 0.506978631f},
-std::array<float,2>{0.467653662f, 0.870440543f},
-std::array<float,2>{0.613339484f, 0.35822174f},
-std::array<float,2>{0.338209093f, 0.450358629f},
-std::array<float,2>{0.649199724f, 0.940851629f},
-std::array<float,2>{0.176089317f, 0.698681712f},
-std::array<float,2>{0.971120656f, 0.237472743f},
-std::array<float,2>{0.249677539f, 0.301338285f},
-std::array<float,2>{0.914160669f, 0.770370007f},
-std::array<float,2>{0.277876347f, 0.623403549f},
-std::array<float,2>{0.733238876f, 0.0287741739f},
-std::array<float,2>{0.381364644f, 0.129067719f},
-std::array<float,2>{0.518398643f, 0.659569561f},
-std::array<float,2>{0.0462431125f, 0.914765537f},
-std::array<float,2>{0.762994051f, 0.424501926f},
-std::array<float,2>{0.216054514f, 0.000510153244f},
-std::array<float,2>{0.878723085f, 0.604416728f},
-std::array<float,2>{0.288657665f, 0.751256049f},
-std::array<float,2>{0.708748281f, 0.291677326f},
-std::array<float,2>{0.414570272f, 0.406687289f},
-std::array<float,2>{0.547497571f, 0.932054102f},
-std::array<float,2>{0.00372141227f, 0.681865871f},
-std::array<float,2>{0.791285694f, 0.154376119f},
-std::array<float,2>{0.107966363f, 0.363801271f},
-std::array<float,2>{0.827301681f, 0.855808496f},
-std::array<float,2>{0.491415679f, 0.52303046f},
-std::array<float,2>{0.572762847f, 0.100689039f},
-std::array<float,2>{0.371990234f, 0.23355633f},
-std::array<float,2>{0.677511275f, 0.704555452f},
-std::array<float,2>{0.1374228f, 0.955564797f},
-std::array<float,2>{0.963711023f, 0.458532482f},
-std::array<float,2>{0.0618000813f, 0.168738842f},
-std::array<float,2>{0.771636844f, 0.641219318f},
-std::array<float,2>{0.399004012f, 0.906240702f},
-std::array<float,2>{0.503054142f, 0.379807293f},
-std::array<float,2>{0.259799719f, 0.277124286f},
-std::array<float,2>{0.749427319f, 0.811892331f},
-std::array<float,2>{0.234105602f, 0.568284273f},
-std::array<float,2>{0.936831117f, 0.0338430107f},
-std::array<float,2>{0.168199763f, 0.478985488f},
-std::array<float,2>{0.9916749f, 0.993414044f},
-std::array<float,2>{0.326091021f, 0.731812f},
-std::array<float,2>{0.625477552f, 0.209848672f},
-std::array<float,2>{0.438070267f, 0.0770173296f},
-std::array<float,2>{0.608864903f, 0.545000196f},
-std::array<float,2>{0.079646267f, 0.840678453f},
-std::array<float,2>{0.856928885f, 0.32369417f},
-std::array<float,2>{0.158447295f, 0.17406179f},
-std::array<float,2>{0.998237193f, 0.636247754f},
-std::array<float,2>{0.318934798f, 0.886703074f},
-std::array<float,2>{0.639811039f, 0.39627254f},
-std::array<float,2>{0.446427315f, 0.256646752f},
-std::array<float,2>{0.600961983f, 0.789343774f},
-std::array<float,2>{0.0928835645f, 0.578978658f},
-std::array<float,2>{0.844446778f, 0.0592218041f},
-std::array<float,2>{0.0475055203f, 0.491174012f},
-std::array<float,2>{0.776542902f, 0.983121157f},
-std::array<float,2>{0.396746218f, 0.743419886f},
-std::array<float,2>{0.513088107f, 0.200289443f},
-std::array<float,2>{0.257347107f, 0.0883528143f},
-std::array<float,2>{0.740573466f, 0.55278492f},
-std::array<float,2>{0.223129824f, 0.816640317f},
-std::array<float,2>{0.923035979f, 0.335530341f},
-std::array<float,2>{0.101135515f, 0.0272356961f},
-std::array<float,2>{0.816274285f, 0.617534816f},
-std::array<float,2>{0.49703294f, 0.767844856f},
-std::array<float,2>{0.562974453f, 0.2981022f},
-std::array<float,2>{0.362802267f, 0.427042246f},
-std::array<float,2>{0.684227109f, 0.920471847f},
-std::array<float,2>{0.128168896f, 0.660229325f},
-std::array<float,2>{0.95565182f, 0.128536135f},
-std::array<float,2>{0.210578069f, 0.352443844f},
-std::array<float,2>{0.885232627f, 0.873590291f},
-std::array<float,2>{0.290449917f, 0.503388107f},
-std::array<float,2>{0.712545991f, 0.124069862f},
-std::array<float,2>{0.406554282f, 0.239390478f},
-std::array<float,2>{0.559828877f, 0.702711582f},
-std::array<float,2>{0.0122088119f, 0.9443385f},
-std::array<float,2>{0.7887761f, 0.447148383f},
-std::array<float,2>{0.236403108f, 0.0937713385f},
-std::array<float,2>{0.912659168f, 0.516437531f},
-std::array<float,2>{0.273228765f, 0.853742182f},
-std::array<float,2>{0.72496736f, 0.361903101f},
-std::array<float,2>{0.383202702f, 0.454528511f},
-std::array<float,2>{0.524608076f, 0.960178912f},
-std::array<float,2>{0.0371318385f, 0.708025575f},
-std::array<float,2>{0.757584453f, 0.228636801f},
-std::array<float,2>{0.0627287999f, 0.295402169f},
-std::array<float,2>{0.868892729f, 0.755932271f},
-std::array<float,2>{0.458390564f, 0.60582453f},
-std::array<float,2>{0.623418689f, 0.00522911316f},
-std::array<float,2>{0.332968056f, 0.152073622f},
-std::array<float,2>{0.642499626f, 0.684440434f},
-std::array<float,2>{0.181158453f, 0.935560882f},
-std::array<float,2>{0.981749713f, 0.410892159f},
-std::array<float,2>{0.0156577006f, 0.206095099f},
-std::array<float,2>{0.811848283f, 0.726719975f},
-std::array<float,2>{0.426597506f, 0.99751395f},
-std::array<float,2>{0.545841694f, 0.484281301f},
-std::array<float,2>{0.304444999f, 0.324668139f},
-std::array<float,2>{0.692718744f, 0.836170316f},
-std::array<float,2>{0.192632928f, 0.542586565f},
-std::array<float,2>{0.891836047f, 0.0727404207f},
-std::array<float,2>{0.154665098f, 0.375061929f},
-std::array<float,2>{0.941721201f, 0.899996281f},
-std::array<float,2>{0.358116567f, 0.646164894f},
-std::array<float,2>{0.665522158f, 0.165480629f},
-std::array<float,2>{0.471336544f, 0.0381425619f},
-std::array<float,2>{0.580948293f, 0.563718438f},
-std::array<float,2>{0.120799899f, 0.8078354f},
-std::array<float,2>{0.831607401f, 0.279511899f},
-std::array<float,2>{0.195418552f, 0.225433737f},
-std::array<float,2>{0.903005183f, 0.714412391f},
-std::array<float,2>{0.30651328f, 0.964617014f},
-std::array<float,2>{0.700158238f, 0.468073428f},
-std::array<float,2>{0.433716595f, 0.372497708f},
-std::array<float,2>{0.533330142f, 0.848451376f},
-std::array<float,2>{0.0291031208f, 0.527153373f},
-std::array<float,2>{0.801418364f, 0.104168937f},
-std::array<float,2>{0.111470744f, 0.421797544f},
-std::array<float,2>{0.837771058f, 0.92831856f},
-std::array<float,2>{0.479331851f, 0.676262736f},
-std::array<float,2>{0.592073023f, 0.142927676f},
-std::array<float,2>{0.347566426f, 0.0145866331f},
-std::array<float,2>{0.662284076f, 0.599861741f},
-std::array<float,2>{0.142760023f, 0.761563301f},
-std::array<float,2>{0.951644599f, 0.286237806f},
-std::array<float,2>{0.0395188406f, 0.068042241f},
-std::array<float,2>{0.76171726f, 0.536542118f},
-std::array<float,2>{0.378774315f, 0.834237456f},
-std::array<float,2>{0.521322668f, 0.319971651f},
-std::array<float,2>{0.275007665f, 0.473342031f},
-std::array<float,2>{0.72918433f, 0.984407067f},
-std::array<float,2>{0.244257733f, 0.720826864f},
-std::array<float,2>{0.920390904f, 0.217970431f},
-std::array<float,2>{0.171896845f, 0.26809147f},
-std::array<float,2>{0.974959493f, 0.803113997f},
-std::array<float,2>{0.340402186f, 0.574825704f},
-std::array<float,2>{0.652397752f, 0.0415381677f},
-std::array<float,2>{0.464178354f, 0.161877543f},
-std::array<float,2>{0.612781525f, 0.650846601f},
-std::array<float,2>{0.0766501799f, 0.898299396f},
-std::array<float,2>{0.866103888f, 0.385982543f},
-std::array<float,2>{0.135370478f, 0.0532356799f},
-std::array<float,2>{0.965239644f, 0.587138474f},
-std::array<float,2>{0.37087664f, 0.78454417f},
-std::array<float,2>{0.675658047f, 0.258481532f},
-std::array<float,2>{0.487438172f, 0.401640683f},
-std::array<float,2>{0.577569723f, 0.879102111f},
-std::array<float,2>{0.105042249f, 0.625986457f},
-std::array<float,2>{0.820575058f, 0.181801021f},
-std::array<float,2>{0.00518216565f, 0.341638267f},
-std::array<float,2>{0.796206713f, 0.82640481f},
-std::array<float,2>{0.420779079f, 0.556657374f},
-std::array<float,2>{0.552521229f, 0.0808777586f},
-std::array<float,2>{0.284227461f, 0.192439258f},
-std::array<float,2>{0.704635441f, 0.740664959f},
-std::array<float,2>{0.211776793f, 0.970635116f},
-std::array<float,2>{0.878982365f, 0.495316416f},
-std::array<float,2>{0.0830249116f, 0.136420578f},
-std::array<float,2>{0.854152858f, 0.67143029f},
-std::array<float,2>{0.445081025f, 0.906739473f},
-std::array<float,2>{0.605152547f, 0.434899032f},
-std::array<float,2>{0.321943879f, 0.305803895f},
-std::array<float,2>{0.632299364f, 0.773583293f},
-std::array<float,2>{0.167369992f, 0.610854149f},
-std::array<float,2>{0.985527933f, 0.0203266274f},
-std::array<float,2>{0.228881076f, 0.441281855f},
-std::array<float,2>{0.930542231f, 0.950242162f},
-std::array<float,2>{0.263945848f, 0.689214468f},
-std::array<float,2>{0.745067775f, 0.249302611f},
-std::array<float,2>{0.405080676f, 0.115440361f},
-std::array<float,2>{0.506675124f, 0.514905751f},
-std::array<float,2>{0.0558643453f, 0.860707343f},
-std::array<float,2>{0.766564906f, 0.346834451f},
-std::array<float,2>{0.189288601f, 0.140278757f},
-std::array<float,2>{0.898370922f, 0.66598767f},
-std::array<float,2>{0.297237456f, 0.910685301f},
-std::array<float,2>{0.688988209f, 0.433538616f},
-std::array<float,2>{0.425530285f, 0.310540468f},
-std::array<float,2>{0.542376637f, 0.778874636f},
-std::array<float,2>{0.0203204043f, 0.616575599f},
-std::array<float,2>{0.807358682f, 0.0187368765f},
-std::array<float,2>{0.122743793f, 0.443110526f},
-std::array<float,2>{0.833551705f, 0.946936429f},
-std::array<float,2>{0.474567682f, 0.692690969f},
-std::array<float,2>{0.584076405f, 0.243672311f},
-std::array<float,2>{0.355152726f, 0.111871503f},
-std::array<float,2>{0.668272436f, 0.50928241f},
-std::array<float,2>{0.149062201f, 0.865384877f},
-std::array<float,2>{0.93861115f, 0.350570798f},
-std::array<float,2>{0.032728903f, 0.0496126078f},
-std::array<float,2>{0.751339495f, 0.590190351f},
-std::array<float,2>{0.386991322f, 0.786749244f},
-std::array<float,2>{0.529517233f, 0.265458703f},
-std::array<float,2>{0.266110778f, 0.403710574f},
-std::array<float,2>{0.720098913f, 0.877226293f},
-std::array<float,2>{0.239770561f, 0.630766451f},
-std::array<float,2>{0.908026278f, 0.186955765f},
-std::array<float,2>{0.184149683f, 0.339571059f},
-std::array<float,2>{0.97890085f, 0.823734641f},
-std::array<float,2>{0.331794232f, 0.558799982f},
-std::array<float,2>{0.647151411f, 0.0838642344f},
-std::array<float,2>{0.453693241f, 0.187802657f},
-std::array<float,2>{0.617891252f, 0.735252082f},
-std::array<float,2>{0.0665504187f, 0.975474656f},
-std::array<float,2>{0.872689188f, 0.499861658f},
-std::array<float,2>{0.130613104f, 0.063486293f},
-std::array<float,2>{0.958912134f, 0.532803714f},
-std::array<float,2>{0.365694046f, 0.829291344f},
-std::array<float,2>{0.683091104f, 0.312686592f},
-std::array<float,2>{0.493876219f, 0.470041633f},
-std::array<float,2>{0.568992734f, 0.988804758f},
-std::array<float,2>{0.0943635106f, 0.725697875f},
-std::array<float,2>{0.817107677f, 0.214170769f},
-std::array<float,2>{0.00954974443f, 0.269560188f},
-std::array<float,2>{0.783032596f, 0.797591448f},
-std::array<float,2>{0.410221696f, 0.573007703f},
-std::array<float,2>{0.555198491f, 0.0443911403f},
-std::array<float,2>{0.29493022f, 0.156714037f},
-std::array<float,2>{0.717792988f, 0.653134048f},
-std::array<float,2>{0.204094738f, 0.89139384f},
-std::array<float,2>{0.889687598f, 0.387558252f},
-std::array<float,2>{0.086583361f, 0.219474763f},
-std::array<float,2>{0.851059496f, 0.717683196f},
-std::array<float,2>{0.45183897f, 0.968507051f},
-std::array<float,2>{0.597595453f, 0.46233806f},
-std::array<float,2>{0.313473731f, 0.368003875f},
-std::array<float,2>{0.635367334f, 0.84665221f},
-std::array<float,2>{0.160235539f, 0.527352154f},
-std::array<float,2>{0.995723784f, 0.107795373f},
-std::array<float,2>{0.222630054f, 0.416780502f},
-std::array<float,2>{0.928573966f, 0.923945844f},
-std::array<float,2>{0.252999544f, 0.674977779f},
-std::array<float,2>{0.734581888f, 0.144660428f},
-std::array<float,2>{0.391583741f, 0.0102993203f},
-std::array<float,2>{0.510242105f, 0.594581485f},
-std::array<float,2>{0.0519941598f, 0.764333606f},
-std::array<float,2>{0.778306186f, 0.282690674f},
-std::array<float,2>{0.170072734f, 0.210746184f},
-std::array<float,2>{0.989808738f, 0.730726302f},
-std::array<float,2>{0.326655179f, 0.992789805f},
-std::array<float,2>{0.628166258f, 0.479705036f},
-std::array<float,2>{0.441236407f, 0.323166221f},
-std::array<float,2>{0.605856895f, 0.841292322f},
-std::array<float,2>{0.0815842077f, 0.546388388f},
-std::array<float,2>{0.859175861f, 0.0774739087f},
-std::array<float,2>{0.0595735908f, 0.380729944f},
-std::array<float,2>{0.77121532f, 0.905064523f},
-std::array<float,2>{0.400399595f, 0.642521501f},
-std::array<float,2>{0.500627697f, 0.169641569f},
-std::array<float,2>{0.259553373f, 0.0344378576f},
-std::array<float,2>{0.747950554f, 0.567018449f},
-std::array<float,2>{0.231550187f, 0.811236501f},
-std::array<float,2>{0.934698641f, 0.275559098f},
-std::array<float,2>{0.106939286f, 0.100055411f},
-std::array<float,2>{0.826014996f, 0.521640599f},
-std::array<float,2>{0.489809126f, 0.856787443f},
-std::array<float,2>{0.572125196f, 0.364377171f},
-std::array<float,2>{0.373802185f, 0.457590163f},
-std::array<float,2>{0.679620445f, 0.956163764f},
-std::array<float,2>{0.138857454f, 0.703551948f},
-std::array<float,2>{0.962276816f, 0.232908383f},
-std::array<float,2>{0.217940867f, 0.292508513f},
-std::array<float,2>{0.875956476f, 0.750182092f},
-std::array<float,2>{0.286952823f, 0.604887247f},
-std::array<float,2>{0.710340381f, 0.00113747665f},
-std::array<float,2>{0.416033536f, 0.155490875f},
-std::array<float,2>{0.549553871f, 0.68320924f},
-std::array<float,2>{0.00094239501f, 0.93277365f},
-std::array<float,2>{0.789077282f, 0.408034265f},
-std::array<float,2>{0.247090533f, 0.0279849581f},
-std::array<float,2>{0.916542947f, 0.624577343f},
-std::array<float,2>{0.280905008f, 0.771202028f},
-std::array<float,2>{0.732297003f, 0.302360564f},
-std::array<float,2>{0.37979418f, 0.424826801f},
-std::array<float,2>{0.516523898f, 0.915054977f},
-std::array<float,2>{0.0439087935f, 0.658829033f},
-std::array<float,2>{0.764807343f, 0.130382895f},
-std::array<float,2>{0.0736675188f, 0.358758986f},
-std::array<float,2>{0.861183643f, 0.869856298f},
-std::array<float,2>{0.465166748f, 0.506123245f},
-std::array<float,2>{0.615796566f, 0.120546855f},
-std::array<float,2>{0.336282462f, 0.23668018f},
-std::array<float,2>{0.65178144f, 0.698060155f},
-std::array<float,2>{0.177995011f, 0.940253675f},
-std::array<float,2>{0.970310271f, 0.449556291f},
-std::array<float,2>{0.0258707069f, 0.177638277f},
-std::array<float,2>{0.798659086f, 0.638552666f},
-std::array<float,2>{0.432283193f, 0.886871755f},
-std::array<float,2>{0.536862612f, 0.393214405f},
-std::array<float,2>{0.311554879f, 0.252753645f},
-std::array<float,2>{0.697883964f, 0.794092715f},
-std::array<float,2>{0.202788204f, 0.584211707f},
-std::array<float,2>{0.898866177f, 0.0555015914f},
-std::array<float,2>{0.145040646f, 0.484969914f},
-std::array<float,2>{0.945545912f, 0.978116035f},
-std::array<float,2>{0.350212812f, 0.747249722f},
-std::array<float,2>{0.656468689f, 0.198239386f},
-std::array<float,2>{0.482908607f, 0.0916626677f},
-std::array<float,2>{0.589348853f, 0.548724949f},
-std::array<float,2>{0.114012137f, 0.814447701f},
-std::array<float,2>{0.842319489f, 0.329265147f},
-std::array<float,2>{0.152501807f, 0.164848298f},
-std::array<float,2>{0.944990516f, 0.645073414f},
-std::array<float,2>{0.355933666f, 0.898744166f},
-std::array<float,2>{0.667378604f, 0.376073092f},
-std::array<float,2>{0.469155133f, 0.280527622f},
-std::array<float,2>{0.57899493f, 0.807234704f},
-std::array<float,2>{0.118403189f, 0.562632024f},
-std::array<float,2>{0.829425395f, 0.0377742834f},
-std::array<float,2>{0.018803725f, 0.483104736f},
-std::array<float,2>{0.810070872f, 0.996124327f},
-std::array<float,2>{0.428080589f, 0.727678716f},
-std::array<float,2>{0.544132888f, 0.205876678f},
-std::array<float,2>{0.301008075f, 0.0734891072f},
-std::array<float,2>{0.693567336f, 0.541444242f},
-std::array<float,2>{0.193921059f, 0.836939692f},
-std::array<float,2>{0.894387782f, 0.325540096f},
-std::array<float,2>{0.0662319064f, 0.00467760442f},
-std::array<float,2>{0.870211363f, 0.607285082f},
-std::array<float,2>{0.460544914f, 0.757372856f},
-std::array<float,2>{0.62300998f, 0.296660632f},
-std::array<float,2>{0.334777057f, 0.411767066f},
-std::array<float,2>{0.644311547f, 0.937231421f},
-std::array<float,2>{0.182274982f, 0.685381472f},
-std::array<float,2>{0.983397484f, 0.151026323f},
-std::array<float,2>{0.235559657f, 0.36299929f},
-std::array<float,2>{0.910849154f, 0.855161548f},
-std::array<float,2>{0.271255821f, 0.517166376f},
-std::array<float,2>{0.722674966f, 0.0953186154f},
-std::array<float,2>{0.385703206f, 0.229557618f},
-std::array<float,2>{0.525564313f, 0.708006203f},
-std::array<float,2>{0.0367945209f, 0.959526122f},
-std::array<float,2>{0.75425458f, 0.453710735f},
-std::array<float,2>{0.207459942f, 0.123788379f},
-std::array<float,2>{0.884034932f, 0.502180994f},
-std::array<float,2>{0.292967469f, 0.874548674f},
-std::array<float,2>{0.713394105f, 0.352788955f},
-std::array<float,2>{0.409425586f, 0.446040839f},
-std::array<float,2>{0.561040699f, 0.944119215f},
-std::array<float,2>{0.0150721055f, 0.701556683f},
-std::array<float,2>{0.785840631f, 0.23856023f},
-std::array<float,2>{0.0979732126f, 0.297667444f},
-std::array<float,2>{0.814075112f, 0.769213498f},
-std::array<float,2>{0.498897135f, 0.618951976f},
-std::array<float,2>{0.565020561f, 0.0259894598f},
-std::array<float,2>{0.360847116f, 0.126978904f},
-std::array<float,2>{0.686239064f, 0.66183567f},
-std::array<float,2>{0.125891149f, 0.920986116f},
-std::array<float,2>{0.954253495f, 0.425895959f},
-std::array<float,2>{0.0502278954f, 0.199857637f},
-std::array<float,2>{0.775228262f, 0.743051469f},
-std::array<float,2>{0.396330386f, 0.984007597f},
-std::array<float,2>{0.51462394f, 0.491301388f},
-std::array<float,2>{0.254175782f, 0.334812969f},
-std::array<float,2>{0.738994777f, 0.81792593f},
-std::array<float,2>{0.225177303f, 0.553835809f},
-std::array<float,2>{0.925408602f, 0.0892612711f},
-std::array<float,2>{0.156483963f, 0.395099849f},
-std::array<float,2>{0.996688128f, 0.88512218f},
-std::array<float,2>{0.318194777f, 0.635703743f},
-std::array<float,2>{0.638321161f, 0.175516114f},
-std::array<float,2>{0.447627842f, 0.0599280782f},
-std::array<float,2>{0.599453866f, 0.579545557f},
-std::array<float,2>{0.0914808735f, 0.790697217f},
-std::array<float,2>{0.847006619f, 0.257724822f},
-std::array<float,2>{0.227648601f, 0.248878598f},
-std::array<float,2>{0.93322134f, 0.688430965f},
-std::array<float,2>{0.261995018f, 0.950052261f},
-std::array<float,2>{0.743183136f, 0.439706534f},
-std::array<float,2>{0.402698338f, 0.346516877f},
-std::array<float,2>{0.505776167f, 0.859948158f},
-std::array<float,2>{0.0575573109f, 0.514492989f},
-std::array<float,2>{0.768474877f, 0.116695359f},
-std::array<float,2>{0.0844058022f, 0.43389526f},
-std::array<float,2>{0.852624118f, 0.907929718f},
-std::array<float,2>{0.442359626f, 0.670424581f},
-std::array<float,2>{0.602018714f, 0.134771198f},
-std::array<float,2>{0.322407991f, 0.0214728117f},
-std::array<float,2>{0.62943846f, 0.609675467f},
-std::array<float,2>{0.165661559f, 0.774582565f},
-std::array<float,2>{0.98723197f, 0.305135399f},
-std::array<float,2>{0.00757259736f, 0.0817679018f},
-std::array<float,2>{0.794537306f, 0.558323681f},
-std::array<float,2>{0.41808939f, 0.827626705f},
-std::array<float,2>{0.553370595f, 0.340231061f},
-std::array<float,2>{0.282272667f, 0.494787395f},
-std::array<float,2>{0.706581295f, 0.969706655f},
-std::array<float,2>{0.214449912f, 0.741950929f},
-std::array<float,2>{0.882380366f, 0.191917315f},
-std::array<float,2>{0.134509906f, 0.259715647f},
-std::array<float,2>{0.967897654f, 0.783769608f},
-std::array<float,2>{0.367532849f, 0.586666167f},
-std::array<float,2>{0.672120869f, 0.0544491224f},
-std::array<float,2>{0.486170799f, 0.183211997f},
-std::array<float,2>{0.575868666f, 0.625970244f},
-std::array<float,2>{0.102901846f, 0.88041079f},
-std::array<float,2>{0.823461294f, 0.4008165f},
-std::array<float,2>{0.175588831f, 0.0427720509f},
-std::array<float,2>{0.973449051f, 0.57613802f},
-std::array<float,2>{0.342369407f, 0.804454327f},
-std::array<float,2>{0.654735506f, 0.268803686f},
-std::array<float,2>{0.462453753f, 0.385602653f},
-std::array<float,2>{0.610637724f, 0.896889567f},
-std::array<float,2>{0.0743265972f, 0.651622474f},
-std::array<float,2>{0.863898993f, 0.16045551f},
-std::array<float,2>{0.0424549282f, 0.318690538f},
-std::array<float,2>{0.758035123f, 0.835140765f},
-std::array<float,2>{0.376553804f, 0.535907388f},
-std::array<float,2>{0.523340166f, 0.0665893033f},
-std::array<float,2>{0.276291013f, 0.217092752f},
-std::array<float,2>{0.728129029f, 0.722151458f},
-std::array<float,2>{0.242201507f, 0.985876322f},
-std::array<float,2>{0.919865787f, 0.473638207f},
-std::array<float,2>{0.109618999f, 0.143811285f},
-std::array<float,2>{0.838985622f, 0.677037358f},
-std::array<float,2>{0.477967441f, 0.929543436f},
-std::array<float,2>{0.591561794f, 0.42018047f},
-std::array<float,2>{0.345651418f, 0.285703212f},
-std::array<float,2>{0.661140025f, 0.759905994f},
-std::array<float,2>{0.140787229f, 0.600819409f},
-std::array<float,2>{0.949722767f, 0.015608551f},
-std::array<float,2>{0.197833359f, 0.467159599f},
-std::array<float,2>{0.905965924f, 0.963466167f},
-std::array<float,2>{0.307366669f, 0.713735044f},
-std::array<float,2>{0.703092217f, 0.225852698f},
-std::array<float,2>{0.437189579f, 0.104865819f},
-std::array<float,2>{0.532951593f, 0.525840163f},
-std::array<float,2>{0.0293983407f, 0.849342048f},
-std::array<float,2>{0.803060293f, 0.371443182f},
-std::array<float,2>{0.24138622f, 0.184992537f},
-std::array<float,2>{0.909974694f, 0.631971478f},
-std::array<float,2>{0.268597543f, 0.876507223f},
-std::array<float,2>{0.721961439f, 0.405976295f},
-std::array<float,2>{0.389536232f, 0.262349635f},
-std::array<float,2>{0.527938306f, 0.788535416f},
-std::array<float,2>{0.0346250422f, 0.592846334f},
-std::array<float,2>{0.752649844f, 0.0482374169f},
-std::array<float,2>{0.0698031187f, 0.496953547f},
-std::array<float,2>{0.873311639f, 0.972832263f},
-std::array<float,2>{0.45655781f, 0.737297297f},
-std::array<float,2>{0.61987412f, 0.189791128f},
-std::array<float,2>{0.329449862f, 0.08562994f},
-std::array<float,2>{0.645833492f, 0.561077237f},
-std::array<float,2>{0.185786486f, 0.820673943f},
-std::array<float,2>{0.977157474f, 0.33614406f},
-std::array<float,2>{0.0230749417f, 0.0158423148f},
-std::array<float,2>{0.804924667f, 0.614612877f},
-std::array<float,2>{0.422614306f, 0.780482411f},
-std::array<float,2>{0.53930074f, 0.31075415f},
-std::array<float,2>{0.298834562f, 0.429814726f},
-std::array<float,2>{0.690010607f, 0.913938344f},
-std::array<float,2>{0.190386593f, 0.667379498f},
-std::array<float,2>{0.894862413f, 0.138581485f},
-std::array<float,2>{0.151758134f, 0.348831952f},
-std::array<float,2>{0.940842807f, 0.8633371f},
-std::array<float,2>{0.353075236f, 0.511276305f},
-std::array<float,2>{0.671026945f, 0.110420592f},
-std::array<float,2>{0.475582182f, 0.245446295f},
-std::array<float,2>{0.58245939f, 0.693741739f},
-std::array<float,2>{0.123204544f, 0.947910726f},
-std::array<float,2>{0.834753036f, 0.444666266f},
-std::array<float,2>{0.162112385f, 0.106557548f},
-std::array<float,2>{0.993612051f, 0.529886305f},
-std::array<float,2>{0.314649671f, 0.845143616f},
-std::array<float,2>{0.633775115f, 0.369246811f},
-std::array<float,2>{0.449727118f, 0.463100493f},
-std::array<float,2>{0.594604552f, 0.96544677f},
-std::array<float,2>{0.0886070579f, 0.716537058f},
-std::array<float,2>{0.849529624f, 0.222229958f},
-std::array<float,2>{0.0541911535f, 0.28348437f},
-std::array<float,2>{0.780039132f, 0.763169944f},
-std::array<float,2>{0.394249082f, 0.596734166f},
-std::array<float,2>{0.507863343f, 0.00911035948f},
-std::array<float,2>{0.251101524f, 0.146939278f},
-std::array<float,2>{0.736536086f, 0.672246933f},
-std::array<float,2>{0.219496295f, 0.922338009f},
-std::array<float,2>{0.927345872f, 0.415303558f},
-std::array<float,2>{0.097091198f, 0.211546689f},
-std::array<float,2>{0.818472266f, 0.724560022f},
-std::array<float,2>{0.495682627f, 0.99129051f},
-std::array<float,2>{0.566816449f, 0.470878243f},
-std::array<float,2>{0.363518596f, 0.314925402f},
-std::array<float,2>{0.681471825f, 0.83062315f},
-std::array<float,2>{0.131404549f, 0.533622026f},
-std::array<float,2>{0.959072173f, 0.0661002919f},
-std::array<float,2>{0.205865964f, 0.389402151f},
-std::array<float,2>{0.887561738f, 0.893866897f},
-std::array<float,2>{0.294080764f, 0.655150771f},
-std::array<float,2>{0.715762615f, 0.158931836f},
-std::array<float,2>{0.412369877f, 0.0468021929f},
-std::array<float,2>{0.55800885f, 0.571875632f},
-std::array<float,2>{0.0111675765f, 0.799036205f},
-std::array<float,2>{0.78446877f, 0.27265349f},
-std::array<float,2>{0.137741596f, 0.231983408f},
-std::array<float,2>{0.964775562f, 0.707024813f},
-std::array<float,2>{0.372833937f, 0.953724921f},
-std::array<float,2>{0.676531792f, 0.460231006f},
-std::array<float,2>{0.490827888f, 0.366365343f},
-std::array<float,2>{0.573335111f, 0.859015167f},
-std::array<float,2>{0.109090492f, 0.520002723f},
-std::array<float,2>{0.826642811f, 0.0982185751f},
-std::array<float,2>{0.00252257823f, 0.409026444f},
-std::array<float,2>{0.792118013f, 0.930287659f},
-std::array<float,2>{0.415309459f, 0.68135637f},
-std::array<float,2>{0.548390687f, 0.153471768f},
-std::array<float,2>{0.287371159f, 0.00211010431f},
-std::array<float,2>{0.70797807f, 0.601590931f},
-std::array<float,2>{0.214963228f, 0.753873467f},
-std::array<float,2>{0.877453864f, 0.289373845f},
-std::array<float,2>{0.0781939849f, 0.0748554021f},
-std::array<float,2>{0.855956733f, 0.543961644f},
-std::array<float,2>{0.439447045f, 0.842232108f},
-std::array<float,2>{0.607943118f, 0.32142511f},
-std::array<float,2>{0.325054616f, 0.477975667f},
-std::array<float,2>{0.626546741f, 0.994185925f},
-std::array<float,2>{0.169277474f, 0.734369755f},
-std::array<float,2>{0.991111159f, 0.208484843f},
-std::array<float,2>{0.232682675f, 0.275286943f},
-std::array<float,2>{0.936095357f, 0.809659719f},
-std::array<float,2>{0.261379302f, 0.568864107f},
-std::array<float,2>{0.748556793f, 0.0313058533f},
-std::array<float,2>{0.399426848f, 0.171583012f},
-std::array<float,2>{0.50202316f, 0.643166006f},
-std::array<float,2>{0.060902968f, 0.902668357f},
-std::array<float,2>{0.77273345f, 0.382233411f},
-std::array<float,2>{0.199623913f, 0.0582604408f},
-std::array<float,2>{0.901145518f, 0.583957732f},
-std::array<float,2>{0.309665948f, 0.79598403f},
-std::array<float,2>{0.696904838f, 0.250778526f},
-std::array<float,2>{0.431567162f, 0.390770078f},
-std::array<float,2>{0.538161933f, 0.889505088f},
-std::array<float,2>{0.0245024003f, 0.64022404f},
-std::array<float,2>{0.799946129f, 0.178184301f},
-std::array<float,2>{0.116228826f, 0.330436617f},
-std::array<float,2>{0.840482652f, 0.816009462f},
-std::array<float,2>{0.480613828f, 0.550169587f},
-std::array<float,2>{0.586756289f, 0.0918794274f},
-std::array<float,2>{0.347837836f, 0.195488125f},
-std::array<float,2>{0.659341633f, 0.748263478f},
-std::array<float,2>{0.14730455f, 0.97958833f},
-std::array<float,2>{0.949050069f, 0.486633718f},
-std::array<float,2>{0.0456998385f, 0.131221175f},
-std::array<float,2>{0.761904597f, 0.656475246f},
-std::array<float,2>{0.381945193f, 0.916482449f},
-std::array<float,2>{0.518621862f, 0.42274186f},
-std::array<float,2>{0.279005706f, 0.304342359f},
-std::array<float,2>{0.734109521f, 0.773346305f},
-std::array<float,2>{0.248520017f, 0.622530997f},
-std::array<float,2>{0.915707648f, 0.0294462536f},
-std::array<float,2>{0.177000895f, 0.452320725f},
-std::array<float,2>{0.972450912f, 0.939426959f},
-std::array<float,2>{0.339841217f, 0.695705652f},
-std::array<float,2>{0.649682999f, 0.235680044f},
-std::array<float,2>{0.468315691f, 0.119065449f},
-std::array<float,2>{0.614854932f, 0.505592525f},
-std::array<float,2>{0.0720954016f, 0.867741764f},
-std::array<float,2>{0.862986565f, 0.35552913f},
-std::array<float,2>{0.179972917f, 0.148473531f},
-std::array<float,2>{0.981181979f, 0.686421454f},
-std::array<float,2>{0.333682626f, 0.934212744f},
-std::array<float,2>{0.641510427f, 0.412677437f},
-std::array<float,2>{0.457826257f, 0.294532925f},
-std::array<float,2>{0.624874473f, 0.7546013f},
-std::array<float,2>{0.0640709028f, 0.607843161f},
-std::array<float,2>{0.867437661f, 0.00685329782f},
-std::array<float,2>{0.038576562f, 0.455160737f},
-std::array<float,2>{0.756170213f, 0.957716882f},
-std::array<float,2>{0.384516954f, 0.709472954f},
-std::array<float,2>{0.524127066f, 0.227887452f},
-std::array<float,2>{0.271674901f, 0.0974599048f},
-std::array<float,2>{0.726527095f, 0.519472241f},
-std::array<float,2>{0.237359926f, 0.851622462f},
-std::array<float,2>{0.913702607f, 0.359479487f},
-std::array<float,2>{0.119979739f, 0.0362326689f},
-std::array<float,2>{0.830906034f, 0.565991282f},
-std::array<float,2>{0.472476572f, 0.804814816f},
-std::array<float,2>{0.581134737f, 0.278967828f},
-std::array<float,2>{0.358669102f, 0.378588378f},
-std::array<float,2>{0.664833844f, 0.901329935f},
-std::array<float,2>{0.155510426f, 0.64830029f},
-std::array<float,2>{0.942770422f, 0.166692421f},
-std::array<float,2>{0.191730499f, 0.326528251f},
-std::array<float,2>{0.891001463f, 0.838658214f},
-std::array<float,2>{0.302986085f, 0.540671349f},
-std::array<float,2>{0.692192614f, 0.0708862394f},
-std::array<float,2>{0.426857501f, 0.204656497f},
-std::array<float,2>{0.546652138f, 0.730098784f},
-std::array<float,2>{0.0169739705f, 0.998722672f},
-std::array<float,2>{0.810917974f, 0.480485052f},
-std::array<float,2>{0.224506468f, 0.087492235f},
-std::array<float,2>{0.922023296f, 0.552025497f},
-std::array<float,2>{0.256456017f, 0.819918036f},
-std::array<float,2>{0.741841614f, 0.33267054f},
-std::array<float,2>{0.398008049f, 0.489838123f},
-std::array<float,2>{0.51228559f, 0.980903745f},
-std::array<float,2>{0.0484223925f, 0.745768249f},
-std::array<float,2>{0.775947332f, 0.202945068f},
-std::array<float,2>{0.0920728222f, 0.254404485f},
-std::array<float,2>{0.844952941f, 0.792278469f},
-std::array<float,2>{0.44612661f, 0.581030011f},
-std::array<float,2>{0.599891186f, 0.0619613528f},
-std::array<float,2>{0.319371104f, 0.173798442f},
-std::array<float,2>{0.639175355f, 0.633743644f},
-std::array<float,2>{0.159662724f, 0.883087456f},
-std::array<float,2>{0.999094605f, 0.397335708f},
-std::array<float,2>{0.0127465697f, 0.241450056f},
-std::array<float,2>{0.787907004f, 0.700495183f},
-std::array<float,2>{0.407737046f, 0.942599177f},
-std::array<float,2>{0.559262335f, 0.448031843f},
-std::array<float,2>{0.289784014f, 0.354344815f},
-std::array<float,2>{0.711048424f, 0.871619582f},
-std::array<float,2>{0.209859937f, 0.500188828f},
-std::array<float,2>{0.886515439f, 0.12282306f},
-std::array<float,2>{0.127631277f, 0.428357154f},
-std::array<float,2>{0.957017481f, 0.918964565f},
-std::array<float,2>{0.361528635f, 0.662315786f},
-std::array<float,2>{0.684776247f, 0.125958592f},
-std::array<float,2>{0.497700393f, 0.0252744444f},
-std::array<float,2>{0.564271271f, 0.620853305f},
-std::array<float,2>{0.100133091f, 0.767444015f},
-std::array<float,2>{0.815019011f, 0.300263375f},
-std::array<float,2>{0.211919069f, 0.194411486f},
-std::array<float,2>{0.880448759f, 0.739395499f},
-std::array<float,2>{0.284172952f, 0.972072363f},
-std::array<float,2>{0.703368485f, 0.492212087f},
-std::array<float,2>{0.421146005f, 0.343659282f},
-std::array<float,2>{0.551010668f, 0.825057209f},
-std::array<float,2>{0.0047934507f, 0.556053042f},
-std::array<float,2>{0.795367241f, 0.0793189555f},
-std::array<float,2>{0.103620514f, 0.398829252f},
-std::array<float,2>{0.821794629f, 0.881803632f},
-std::array<float,2>{0.486672908f, 0.627654254f},
-std::array<float,2>{0.576252162f, 0.179888487f},
-std::array<float,2>{0.369655192f, 0.051327873f},
-std::array<float,2>{0.674496949f, 0.588093758f},
-std::array<float,2>{0.136209875f, 0.781846106f},
-std::array<float,2>{0.965821445f, 0.260644019f},
-std::array<float,2>{0.055442743f, 0.114374444f},
-std::array<float,2>{0.766686082f, 0.512589931f},
-std::array<float,2>{0.406042159f, 0.861427665f},
-std::array<float,2>{0.507312417f, 0.34558174f},
-std::array<float,2>{0.264970809f, 0.439218253f},
-std::array<float,2>{0.745771408f, 0.952239752f},
-std::array<float,2>{0.230245873f, 0.689719319f},
-std::array<float,2>{0.931023479f, 0.246230692f},
-std::array<float,2>{0.166181222f, 0.308014661f},
-std::array<float,2>{0.985260069f, 0.776624382f},
-std::array<float,2>{0.321184009f, 0.612770557f},
-std::array<float,2>{0.631396234f, 0.0216903016f},
-std::array<float,2>{0.444010288f, 0.134329513f},
-std::array<float,2>{0.604392111f, 0.668392479f},
-std::array<float,2>{0.0824892595f, 0.909189165f},
-std::array<float,2>{0.854818165f, 0.437067628f},
-std::array<float,2>{0.143678099f, 0.0122608421f},
-std::array<float,2>{0.9528054f, 0.599534273f},
-std::array<float,2>{0.34597674f, 0.758576035f},
-std::array<float,2>{0.663994312f, 0.288499981f},
-std::array<float,2>{0.479918242f, 0.418270618f},
-std::array<float,2>{0.593041897f, 0.927679956f},
-std::array<float,2>{0.113240778f, 0.67965275f},
-std::array<float,2>{0.836252093f, 0.141166925f},
-std::array<float,2>{0.0283072963f, 0.373424053f},
-std::array<float,2>{0.802336395f, 0.850960016f},
-std::array<float,2>{0.434963584f, 0.524093986f},
-std::array<float,2>{0.534644723f, 0.102611564f},
-std::array<float,2>{0.304839432f, 0.224026769f},
-std::array<float,2>{0.700638652f, 0.711320698f},
-std::array<float,2>{0.197251588f, 0.96207726f},
-std::array<float,2>{0.903803289f, 0.465515465f},
-std::array<float,2>{0.0776670501f, 0.163069263f},
-std::array<float,2>{0.86656177f, 0.648685277f},
-std::array<float,2>{0.463002205f, 0.894814849f},
-std::array<float,2>{0.611448407f, 0.383882523f},
-std::array<float,2>{0.341784686f, 0.266582221f},
-std::array<float,2>{0.653509438f, 0.801198483f},
-std::array<float,2>{0.172875866f, 0.577321529f},
-std::array<float,2>{0.976354957f, 0.0405015834f},
-std::array<float,2>{0.245683983f, 0.475006908f},
-std::array<float,2>{0.921134293f, 0.987630725f},
-std::array<float,2>{0.27388379f, 0.719901085f},
-std::array<float,2>{0.730193973f, 0.215164334f},
-std::array<float,2>{0.376976311f, 0.0699851215f},
-std::array<float,2>{0.519701481f, 0.538591981f},
-std::array<float,2>{0.0409195684f, 0.833023548f},
-std::array<float,2>{0.7606529f, 0.317878872f},
-std::array<float,2>{0.194202676f, 0.16770187f},
-std::array<float,2>{0.894197047f, 0.647306144f},
-std::array<float,2>{0.301267385f, 0.902002156f},
-std::array<float,2>{0.693654478f, 0.377234161f},
-std::array<float,2>{0.427937925f, 0.27770105f},
-std::array<float,2>{0.544409096f, 0.805670559f},
-std::array<float,2>{0.0187620968f, 0.564986408f},
-std::array<float,2>{0.810542285f, 0.0353024341f},
-std::array<float,2>{0.118546486f, 0.481791228f},
-std::array<float,2>{0.829215944f, 0.999437869f},
-std::array<float,2>{0.468790323f, 0.729114413f},
-std::array<float,2>{0.578738391f, 0.203225881f},
-std::array<float,2>{0.355543494f, 0.0715149865f},
-std::array<float,2>{0.667010367f, 0.53987366f},
-std::array<float,2>{0.152727351f, 0.839202166f},
-std::array<float,2>{0.945217371f, 0.327661335f},
-std::array<float,2>{0.0369761065f, 0.00588394562f},
-std::array<float,2>{0.753923655f, 0.608640909f},
-std::array<float,2>{0.385327697f, 0.75515306f},
-std::array<float,2>{0.525698006f, 0.293689102f},
-std::array<float,2>{0.27112779f, 0.413875073f},
-std::array<float,2>{0.722980201f, 0.93527931f},
-std::array<float,2>{0.235636294f, 0.686725855f},
-std::array<float,2>{0.911072671f, 0.14942421f},
-std::array<float,2>{0.182529077f, 0.361177951f},
-std::array<float,2>{0.982936561f, 0.853163064f},
-std::array<float,2>{0.334541917f, 0.518459797f},
-std::array<float,2>{0.644086957f, 0.0963428915f},
-std::array<float,2>{0.460792542f, 0.226875618f},
-std::array<float,2>{0.622577071f, 0.710682809f},
-std::array<float,2>{0.0661115721f, 0.958639503f},
-std::array<float,2>{0.870500624f, 0.456086546f},
-std::array<float,2>{0.125642434f, 0.121471412f},
-std::array<float,2>{0.954541504f, 0.501839042f},
-std::array<float,2>{0.361169398f, 0.872365534f},
-std::array<float,2>{0.686494946f, 0.355299115f},
-std::array<float,2>{0.498538375f, 0.44838357f},
-std::array<float,2>{0.565354109f, 0.942368329f},
-std::array<float,2>{0.0978101194f, 0.699831903f},
-std::array<float,2>{0.814250529f, 0.240821123f},
-std::array<float,2>{0.0147441011f, 0.299714506f},
-std::array<float,2>{0.786027193f, 0.766310871f},
-std::array<float,2>{0.409285784f, 0.619426489f},
-std::array<float,2>{0.561380565f, 0.0240282938f},
-std::array<float,2>{0.292627335f, 0.126433313f},
-std::array<float,2>{0.71380198f, 0.663279712f},
-std::array<float,2>{0.207110763f, 0.917974293f},
-std::array<float,2>{0.884026289f, 0.429367214f},
-std::array<float,2>{0.0917121023f, 0.201884255f},
-std::array<float,2>{0.846829057f, 0.74423188f},
-std::array<float,2>{0.447501093f, 0.982252002f},
-std::array<float,2>{0.599200606f, 0.488769591f},
-std::array<float,2>{0.317921489f, 0.333469272f},
-std::array<float,2>{0.63863951f, 0.818717122f},
-std::array<float,2>{0.156563893f, 0.551408231f},
-std::array<float,2>{0.996837914f, 0.0865606293f},
-std::array<float,2>{0.225433424f, 0.397815734f},
-std::array<float,2>{0.925701201f, 0.88406688f},
-std::array<float,2>{0.254000545f, 0.634556353f},
-std::array<float,2>{0.739103258f, 0.17257081f},
-std::array<float,2>{0.39611277f, 0.0612678304f},
-std::array<float,2>{0.514205039f, 0.581623375f},
-std::array<float,2>{0.0500480086f, 0.791983783f},
-std::array<float,2>{0.775087833f, 0.255402148f},
-std::array<float,2>{0.165886074f, 0.247599363f},
-std::array<float,2>{0.986944854f, 0.691354156f},
-std::array<float,2>{0.322536081f, 0.951492012f},
-std::array<float,2>{0.629793406f, 0.437834412f},
-std::array<float,2>{0.441917241f, 0.343996137f},
-std::array<float,2>{0.601780653f, 0.863204658f},
-std::array<float,2>{0.0840149224f, 0.512881637f},
-std::array<float,2>{0.8529917f, 0.113652356f},
-std::array<float,2>{0.0572219491f, 0.435757875f},
-std::array<float,2>{0.768085301f, 0.909017742f},
-std::array<float,2>{0.402407765f, 0.669739008f},
-std::array<float,2>{0.505540788f, 0.133592397f},
-std::array<float,2>{0.261856914f, 0.0229074713f},
-std::array<float,2>{0.74361372f, 0.611587763f},
-std::array<float,2>{0.227981731f, 0.775493681f},
-std::array<float,2>{0.933514357f, 0.306687176f},
-std::array<float,2>{0.102709986f, 0.0782593489f},
-std::array<float,2>{0.823534667f, 0.555285394f},
-std::array<float,2>{0.48603946f, 0.825804114f},
-std::array<float,2>{0.576120675f, 0.341957897f},
-std::array<float,2>{0.367416501f, 0.493809104f},
-std::array<float,2>{0.671928048f, 0.971571028f},
-std::array<float,2>{0.134756476f, 0.738591671f},
-std::array<float,2>{0.968135297f, 0.193386793f},
-std::array<float,2>{0.214707538f, 0.261689186f},
-std::array<float,2>{0.88271147f, 0.783069909f},
-std::array<float,2>{0.282640934f, 0.589729905f},
-std::array<float,2>{0.706950247f, 0.052703917f},
-std::array<float,2>{0.418442219f, 0.18094632f},
-std::array<float,2>{0.553541839f, 0.628654778f},
-std::array<float,2>{0.00737156114f, 0.881968796f},
-std::array<float,2>{0.794690728f, 0.399831951f},
-std::array<float,2>{0.242586911f, 0.039628204f},
-std::array<float,2>{0.919536471f, 0.576417923f},
-std::array<float,2>{0.276100576f, 0.802352011f},
-std::array<float,2>{0.728332341f, 0.267496526f},
-std::array<float,2>{0.376942605f, 0.383206397f},
-std::array<float,2>{0.523083448f, 0.896438479f},
-std::array<float,2>{0.0421046577f, 0.649678648f},
-std::array<float,2>{0.758159876f, 0.163857877f},
-std::array<float,2>{0.0747041255f, 0.317215949f},
-std::array<float,2>{0.86423713f, 0.832894206f},
-std::array<float,2>{0.462817699f, 0.537231088f},
-std::array<float,2>{0.610381782f, 0.0691141039f},
-std::array<float,2>{0.342570484f, 0.216373965f},
-std::array<float,2>{0.654347181f, 0.719698966f},
-std::array<float,2>{0.175374925f, 0.987201989f},
-std::array<float,2>{0.973150849f, 0.475952744f},
-std::array<float,2>{0.0296667647f, 0.142388284f},
-std::array<float,2>{0.802803636f, 0.678648591f},
-std::array<float,2>{0.437322408f, 0.926597714f},
-std::array<float,2>{0.533116877f, 0.419699341f},
-std::array<float,2>{0.307534158f, 0.287367254f},
-std::array<float,2>{0.702727735f, 0.758836925f},
-std::array<float,2>{0.198176339f, 0.598190665f},
-std::array<float,2>{0.906166911f, 0.0133907199f},
-std::array<float,2>{0.141018793f, 0.466255605f},
-std::array<float,2>{0.950101793f, 0.961558342f},
-std::array<float,2>{0.345242381f, 0.711939394f},
-std::array<float,2>{0.661477387f, 0.223109275f},
-std::array<float,2>{0.477698773f, 0.101636626f},
-std::array<float,2>{0.591384232f, 0.524808705f},
-std::array<float,2>{0.109647028f, 0.850403965f},
-std::array<float,2>{0.839125395f, 0.374648124f},
-std::array<float,2>{0.149269298f, 0.136966556f},
-std::array<float,2>{0.938805163f, 0.666404366f},
-std::array<float,2>{0.355248809f, 0.912762344f},
-std::array<float,2>{0.668002248f, 0.431106478f},
-std::array<float,2>{0.474135578f, 0.312207013f},
-std::array<float,2>{0.584371805f, 0.779903054f},
-std::array<float,2>{0.122932144f, 0.613512516f},
-std::array<float,2>{0.833918929f, 0.016660057f},
-std::array<float,2>{0.0202152021f, 0.443998784f},
-std::array<float,2>{0.807447612f, 0.948582113f},
-std::array<float,2>{0.425627053f, 0.694708943f},
-std::array<float,2>{0.542040706f, 0.244308069f},
-std::array<float,2>{0.297082633f, 0.11029245f},
-std::array<float,2>{0.689323902f, 0.510020137f},
-std::array<float,2>{0.189168781f, 0.864472449f},
-std::array<float,2>{0.897995114f, 0.348051101f},
-std::array<float,2>{0.0668406561f, 0.0477752164f},
-std::array<float,2>{0.872993708f, 0.592387617f},
-std::array<float,2>{0.454059631f, 0.787292242f},
-std::array<float,2>{0.617954671f, 0.262777299f},
-std::array<float,2>{0.331786811f, 0.405157804f},
-std::array<float,2>{0.647321343f, 0.875566423f},
-std::array<float,2>{0.184523389f, 0.631347656f},
-std::array<float,2>{0.978573263f, 0.184175268f},
-std::array<float,2>{0.240217432f, 0.337437481f},
-std::array<float,2>{0.907849371f, 0.821455002f},
-std::array<float,2>{0.265708148f, 0.562478364f},
-std::array<float,2>{0.719750583f, 0.0843846649f},
-std::array<float,2>{0.386732638f, 0.191319302f},
-std::array<float,2>{0.529767036f, 0.7382195f},
-std::array<float,2>{0.033167582f, 0.973788083f},
-std::array<float,2>{0.751153886f, 0.497505009f},
-std::array<float,2>{0.203740433f, 0.065187186f},
-std::array<float,2>{0.890062392f, 0.534272075f},
-std::array<float,2>{0.295354396f, 0.831090331f},
-std::array<float,2>{0.718030572f, 0.315853268f},
-std::array<float,2>{0.410534978f, 0.471806377f},
-std::array<float,2>{0.555472612f, 0.990873218f},
-std::array<float,2>{0.00936551392f, 0.722701848f},
-std::array<float,2>{0.782879293f, 0.212742493f},
-std::array<float,2>{0.094652012f, 0.27160266f},
-std::array<float,2>{0.817260325f, 0.800170779f},
-std::array<float,2>{0.493950307f, 0.570937991f},
-std::array<float,2>{0.569233119f, 0.0458750203f},
-std::array<float,2>{0.365403801f, 0.15983589f},
-std::array<float,2>{0.682745516f, 0.655837893f},
-std::array<float,2>{0.130672112f, 0.893242896f},
-std::array<float,2>{0.958639979f, 0.390362859f},
-std::array<float,2>{0.0521018356f, 0.221463352f},
-std::array<float,2>{0.777977169f, 0.714877963f},
-std::array<float,2>{0.39118737f, 0.966008246f},
-std::array<float,2>{0.509852529f, 0.464680642f},
-std::array<float,2>{0.253288954f, 0.371066213f},
-std::array<float,2>{0.734763741f, 0.844437897f},
-std::array<float,2>{0.222210512f, 0.530927479f},
-std::array<float,2>{0.928352356f, 0.106155157f},
-std::array<float,2>{0.160640702f, 0.414534092f},
-std::array<float,2>{0.996044457f, 0.923808038f},
-std::array<float,2>{0.313003153f, 0.67355597f},
-std::array<float,2>{0.635635912f, 0.147980154f},
-std::array<float,2>{0.451976866f, 0.00826370437f},
-std::array<float,2>{0.597170472f, 0.59595269f},
-std::array<float,2>{0.0868412256f, 0.761867404f},
-std::array<float,2>{0.850609004f, 0.284322083f},
-std::array<float,2>{0.231884733f, 0.207726568f},
-std::array<float,2>{0.934879243f, 0.733331501f},
-std::array<float,2>{0.259386927f, 0.995249391f},
-std::array<float,2>{0.747567236f, 0.476864606f},
-std::array<float,2>{0.400742769f, 0.320995092f},
-std::array<float,2>{0.500917971f, 0.842975676f},
-std::array<float,2>{0.0598804578f, 0.543671966f},
-std::array<float,2>{0.771247804f, 0.0757084638f},
-std::array<float,2>{0.0817975029f, 0.381611079f},
-std::array<float,2>{0.85894388f, 0.903769195f},
-std::array<float,2>{0.440927118f, 0.644055188f},
-std::array<float,2>{0.605478048f, 0.170083731f},
-std::array<float,2>{0.326199859f, 0.0323798954f},
-std::array<float,2>{0.628203809f, 0.569550157f},
-std::array<float,2>{0.170183703f, 0.808983266f},
-std::array<float,2>{0.990113497f, 0.274409682f},
-std::array<float,2>{0.000577765459f, 0.0995938852f},
-std::array<float,2>{0.789442778f, 0.52068007f},
-std::array<float,2>{0.41640082f, 0.857622802f},
-std::array<float,2>{0.549565375f, 0.366112202f},
-std::array<float,2>{0.286831945f, 0.459338516f},
-std::array<float,2>{0.710193634f, 0.954246759f},
-std::array<float,2>{0.218018249f, 0.705724835f},
-std::array<float,2>{0.875502884f, 0.230541483f},
-std::array<float,2>{0.13896507f, 0.290975392f},
-std::array<float,2>{0.962052703f, 0.752829552f},
-std::array<float,2>{0.373668194f, 0.603058279f},
-std::array<float,2>{0.679346323f, 0.00298716454f},
-std::array<float,2>{0.490094572f, 0.152808115f},
-std::array<float,2>{0.571986914f, 0.680066526f},
-std::array<float,2>{0.107255511f, 0.931124389f},
-std::array<float,2>{0.825849354f, 0.409834117f},
-std::array<float,2>{0.177798808f, 0.0306508038f},
-std::array<float,2>{0.970486224f, 0.621965051f},
-std::array<float,2>{0.335941255f, 0.77221638f},
-std::array<float,2>{0.651394188f, 0.303565204f},
-std::array<float,2>{0.46503365f, 0.42308709f},
-std::array<float,2>{0.615992129f, 0.917832553f},
-std::array<float,2>{0.0733888298f, 0.658156812f},
-std::array<float,2>{0.860857964f, 0.131869674f},
-std::array<float,2>{0.0436873361f, 0.356457502f},
-std::array<float,2>{0.764896274f, 0.868703306f},
-std::array<float,2>{0.379515737f, 0.504508197f},
-std::array<float,2>{0.516289055f, 0.117307149f},
-std::array<float,2>{0.281092703f, 0.234567627f},
-std::array<float,2>{0.731994212f, 0.696367621f},
-std::array<float,2>{0.247518718f, 0.93791616f},
-std::array<float,2>{0.916978836f, 0.451707482f},
-std::array<float,2>{0.114183843f, 0.178840786f},
-std::array<float,2>{0.842680097f, 0.639067709f},
-std::array<float,2>{0.482429355f, 0.890587807f},
-std::array<float,2>{0.589081764f, 0.392061144f},
-std::array<float,2>{0.350356668f, 0.251734048f},
-std::array<float,2>{0.656689942f, 0.795075774f},
-std::array<float,2>{0.14532654f, 0.582107723f},
-std::array<float,2>{0.945737898f, 0.0575213023f},
-std::array<float,2>{0.203079104f, 0.487651557f},
-std::array<float,2>{0.898608923f, 0.978699625f},
-std::array<float,2>{0.311789721f, 0.74980545f},
-std::array<float,2>{0.698066652f, 0.196624652f},
-std::array<float,2>{0.432482094f, 0.09285184f},
-std::array<float,2>{0.537060499f, 0.549621224f},
-std::array<float,2>{0.0254995506f, 0.814660013f},
-std::array<float,2>{0.798560441f, 0.331601948f},
-std::array<float,2>{0.23773326f, 0.151381284f},
-std::array<float,2>{0.913823426f, 0.684039831f},
-std::array<float,2>{0.271850854f, 0.936471164f},
-std::array<float,2>{0.726154685f, 0.410176396f},
-std::array<float,2>{0.384598434f, 0.295752764f},
-std::array<float,2>{0.524357796f, 0.756392598f},
-std::array<float,2>{0.0388369076f, 0.606237769f},
-std::array<float,2>{0.756069064f, 0.00545612955f},
-std::array<float,2>{0.0644379631f, 0.455007672f},
-std::array<float,2>{0.867239833f, 0.960790992f},
-std::array<float,2>{0.457762957f, 0.708684325f},
-std::array<float,2>{0.624556482f, 0.229198992f},
-std::array<float,2>{0.333939642f, 0.0944366828f},
-std::array<float,2>{0.64132899f, 0.515841305f},
-std::array<float,2>{0.179730475f, 0.854394019f},
-std::array<float,2>{0.981374562f, 0.361722469f},
-std::array<float,2>{0.0166468732f, 0.0387383774f},
-std::array<float,2>{0.810649812f, 0.564092994f},
-std::array<float,2>{0.42716822f, 0.808303416f},
-std::array<float,2>{0.546415269f, 0.280267f},
-std::array<float,2>{0.302864701f, 0.375643134f},
-std::array<float,2>{0.692054272f, 0.899882078f},
-std::array<float,2>{0.19162409f, 0.645923913f},
-std::array<float,2>{0.890745163f, 0.165591046f},
-std::array<float,2>{0.155579224f, 0.32488817f},
-std::array<float,2>{0.942404866f, 0.836900651f},
-std::array<float,2>{0.35847047f, 0.542096972f},
-std::array<float,2>{0.664733708f, 0.0728012323f},
-std::array<float,2>{0.472376406f, 0.206573918f},
-std::array<float,2>{0.581368208f, 0.727069497f},
-std::array<float,2>{0.119633228f, 0.997694254f},
-std::array<float,2>{0.830592513f, 0.483710855f},
-std::array<float,2>{0.159194991f, 0.0883886889f},
-std::array<float,2>{0.999500632f, 0.553457379f},
-std::array<float,2>{0.319684327f, 0.817232788f},
-std::array<float,2>{0.639646769f, 0.335135043f},
-std::array<float,2>{0.446012616f, 0.490549386f},
-std::array<float,2>{0.599693298f, 0.982860148f},
-std::array<float,2>{0.0919387341f, 0.743753314f},
-std::array<float,2>{0.845213532f, 0.200782165f},
-std::array<float,2>{0.0486266129f, 0.25615105f},
-std::array<float,2>{0.776339173f, 0.789620101f},
-std::array<float,2>{0.398267031f, 0.578161478f},
-std::array<float,2>{0.512651742f, 0.0590287223f},
-std::array<float,2>{0.256730676f, 0.174719706f},
-std::array<float,2>{0.742067516f, 0.636008501f},
-std::array<float,2>{0.224326625f, 0.886106431f},
-std::array<float,2>{0.922338843f, 0.395804733f},
-std::array<float,2>{0.100407816f, 0.239810377f},
-std::array<float,2>{0.815244973f, 0.702615201f},
-std::array<float,2>{0.498005658f, 0.944968581f},
-std::array<float,2>{0.56412822f, 0.446542442f},
-std::array<float,2>{0.361627817f, 0.351750791f},
-std::array<float,2>{0.684826076f, 0.873324752f},
-std::array<float,2>{0.127723888f, 0.50344038f},
-std::array<float,2>{0.956675708f, 0.124841221f},
-std::array<float,2>{0.209555343f, 0.42761001f},
-std::array<float,2>{0.886308849f, 0.920166075f},
-std::array<float,2>{0.289834023f, 0.660831928f},
-std::array<float,2>{0.711423218f, 0.128329277f},
-std::array<float,2>{0.408059388f, 0.0266227555f},
-std::array<float,2>{0.559421957f, 0.617883563f},
-std::array<float,2>{0.0130184544f, 0.768375874f},
-std::array<float,2>{0.787688911f, 0.298711002f},
-std::array<float,2>{0.135906562f, 0.193306535f},
-std::array<float,2>{0.966084719f, 0.740982115f},
-std::array<float,2>{0.370069295f, 0.969907522f},
-std::array<float,2>{0.674622715f, 0.496043921f},
-std::array<float,2>{0.486429811f, 0.34114784f},
-std::array<float,2>{0.576609075f, 0.826951087f},
-std::array<float,2>{0.103853419f, 0.557197452f},
-std::array<float,2>{0.822179198f, 0.0803365931f},
-std::array<float,2>{0.00440145796f, 0.402183264f},
-std::array<float,2>{0.795047641f, 0.879484475f},
-std::array<float,2>{0.421108693f, 0.626465797f},
-std::array<float,2>{0.551132143f, 0.182388306f},
-std::array<float,2>{0.28373313f, 0.0529185869f},
-std::array<float,2>{0.703429699f, 0.587579966f},
-std::array<float,2>{0.212260097f, 0.78500253f},
-std::array<float,2>{0.880822539f, 0.257982582f},
-std::array<float,2>{0.0820312649f, 0.115997903f},
-std::array<float,2>{0.854715943f, 0.515572369f},
-std::array<float,2>{0.444212407f, 0.860885203f},
-std::array<float,2>{0.604199529f, 0.347254604f},
-std::array<float,2>{0.321034819f, 0.440641671f},
-std::array<float,2>{0.63166368f, 0.950691581f},
-std::array<float,2>{0.166472971f, 0.688513935f},
-std::array<float,2>{0.984888494f, 0.249967113f},
-std::array<float,2>{0.230090037f, 0.306158096f},
-std::array<float,2>{0.930900216f, 0.774263382f},
-std::array<float,2>{0.26468873f, 0.61065799f},
-std::array<float,2>{0.745851457f, 0.0195661113f},
-std::array<float,2>{0.405863494f, 0.135768265f},
-std::array<float,2>{0.507008016f, 0.670979142f},
-std::array<float,2>{0.0553029217f, 0.906736195f},
-std::array<float,2>{0.766960084f, 0.435078889f},
-std::array<float,2>{0.196780741f, 0.0141042527f},
-std::array<float,2>{0.90332973f, 0.600423098f},
-std::array<float,2>{0.305056363f, 0.760882676f},
-std::array<float,2>{0.70021826f, 0.286964267f},
-std::array<float,2>{0.434630513f, 0.421331108f},
-std::array<float,2>{0.534312308f, 0.927820265f},
-std::array<float,2>{0.0279588699f, 0.676318765f},
-std::array<float,2>{0.802687466f, 0.143197253f},
-std::array<float,2>{0.112820968f, 0.372900456f},
-std::array<float,2>{0.836041093f, 0.847705364f},
-std::array<float,2>{0.479510039f, 0.526778936f},
-std::array<float,2>{0.592901409f, 0.103793107f},
-std::array<float,2>{0.345718414f, 0.224770173f},
-std::array<float,2>{0.663749158f, 0.714321494f},
-std::array<float,2>{0.143987224f, 0.963932991f},
-std::array<float,2>{0.952921152f, 0.468339235f},
-std::array<float,2>{0.0407586135f, 0.161230981f},
-std::array<float,2>{0.760329962f, 0.650906563f},
-std::array<float,2>{0.377226174f, 0.89768517f},
-std::array<float,2>{0.519817114f, 0.386244357f},
-std::array<float,2>{0.273482889f, 0.267986685f},
-std::array<float,2>{0.730447352f, 0.80356133f},
-std::array<float,2>{0.245928407f, 0.57431221f},
-std::array<float,2>{0.921195745f, 0.0412111394f},
-std::array<float,2>{0.173196122f, 0.472854733f},
-std::array<float,2>{0.97616291f, 0.985153317f},
-std::array<float,2>{0.341543406f, 0.721483707f},
-std::array<float,2>{0.6537503f, 0.218508661f},
-std::array<float,2>{0.463355452f, 0.0675404742f},
-std::array<float,2>{0.611592054f, 0.536861002f},
-std::array<float,2>{0.0781187266f, 0.834633529f},
-std::array<float,2>{0.866298914f, 0.31967181f},
-std::array<float,2>{0.185931519f, 0.186105922f},
-std::array<float,2>{0.977496386f, 0.62892288f},
-std::array<float,2>{0.329249293f, 0.878131807f},
-std::array<float,2>{0.64558655f, 0.403106064f},
-std::array<float,2>{0.457017601f, 0.264217824f},
-std::array<float,2>{0.619641423f, 0.785865307f},
-std::array<float,2>{0.0694252551f, 0.591334641f},
-std::array<float,2>{0.873247206f, 0.0503635816f},
-std::array<float,2>{0.0343284123f, 0.498747557f},
-std::array<float,2>{0.752784848f, 0.976257145f},
-std::array<float,2>{0.389398366f, 0.736193478f},
-std::array<float,2>{0.528092027f, 0.188564643f},
-std::array<float,2>{0.269024521f, 0.0829075202f},
-std::array<float,2>{0.721724033f, 0.559771836f},
-std::array<float,2>{0.241587132f, 0.822472274f},
-std::array<float,2>{0.909718931f, 0.338458806f},
-std::array<float,2>{0.123507507f, 0.0177498348f},
-std::array<float,2>{0.834659338f, 0.616055667f},
-std::array<float,2>{0.475311905f, 0.778197229f},
-std::array<float,2>{0.582209051f, 0.309251755f},
-std::array<float,2>{0.353514791f, 0.43241176f},
-std::array<float,2>{0.671363354f, 0.911500275f},
-std::array<float,2>{0.151607454f, 0.664871395f},
-std::array<float,2>{0.940642715f, 0.139557213f},
-std::array<float,2>{0.190064207f, 0.35100317f},
-std::array<float,2>{0.894729257f, 0.866617739f},
-std::array<float,2>{0.299129695f, 0.508070409f},
-std::array<float,2>{0.690396369f, 0.112585671f},
-std::array<float,2>{0.422472745f, 0.242208347f},
-std::array<float,2>{0.539427698f, 0.691928625f},
-std::array<float,2>{0.0233130828f, 0.945777535f},
-std::array<float,2>{0.805148423f, 0.44152993f},
-std::array<float,2>{0.219256356f, 0.108561471f},
-std::array<float,2>{0.927657366f, 0.52836436f},
-std::array<float,2>{0.251386791f, 0.847055614f},
-std::array<float,2>{0.736682534f, 0.369083375f},
-std::array<float,2>{0.394472629f, 0.461290509f},
-std::array<float,2>{0.508211732f, 0.967531383f},
-std::array<float,2>{0.053939335f, 0.718607068f},
-std::array<float,2>{0.780014694f, 0.219966829f},
-std::array<float,2>{0.0887401253f, 0.282144755f},
-std::array<float,2>{0.849191129f, 0.765302956f},
-std::array<float,2>{0.45001471f, 0.595475495f},
-std::array<float,2>{0.594238758f, 0.0114193419f},
-std::array<float,2>{0.314718515f, 0.146224201f},
-std::array<float,2>{0.633374333f, 0.674096882f},
-std::array<float,2>{0.162515089f, 0.924928546f},
-std::array<float,2>{0.993297458f, 0.417557031f},
-std::array<float,2>{0.0108609926f, 0.213392422f},
-std::array<float,2>{0.784197271f, 0.725090265f},
-std::array<float,2>{0.412166566f, 0.989327729f},
-std::array<float,2>{0.557694077f, 0.469022989f},
-std::array<float,2>{0.294325501f, 0.314403832f},
-std::array<float,2>{0.715566754f, 0.828811884f},
-std::array<float,2>{0.205693603f, 0.531695306f},
-std::array<float,2>{0.88726604f, 0.0632309169f},
-std::array<float,2>{0.131665185f, 0.387883216f},
-std::array<float,2>{0.959252417f, 0.8918612f},
-std::array<float,2>{0.363646477f, 0.653714001f},
-std::array<float,2>{0.681271076f, 0.157485753f},
-std::array<float,2>{0.496015459f, 0.0430040061f},
-std::array<float,2>{0.566566229f, 0.573716283f},
-std::array<float,2>{0.0967562646f, 0.798092306f},
-std::array<float,2>{0.818825126f, 0.270636529f},
-std::array<float,2>{0.215252265f, 0.233906105f},
-std::array<float,2>{0.877910018f, 0.704614103f},
-std::array<float,2>{0.287113249f, 0.955633044f},
-std::array<float,2>{0.707625628f, 0.458278924f},
-std::array<float,2>{0.415193141f, 0.363443792f},
-std::array<float,2>{0.548757732f, 0.856256843f},
-std::array<float,2>{0.00269843196f, 0.5228706f},
-std::array<float,2>{0.79223901f, 0.101542503f},
-std::array<float,2>{0.10914968f, 0.406823605f},
-std::array<float,2>{0.826236963f, 0.93230629f},
-std::array<float,2>{0.491201967f, 0.682399571f},
-std::array<float,2>{0.573491693f, 0.154799685f},
-std::array<float,2>{0.372705609f, 8.52893791e-05f},
-std::array<float,2>{0.676366985f, 0.603919029f},
-std::array<float,2>{0.13798511f, 0.751608253f},
-std::array<float,2>{0.964442015f, 0.291476876f},
-std::array<float,2>{0.0606525354f, 0.0764824152f},
-std::array<float,2>{0.77253288f, 0.545829952f},
-std::array<float,2>{0.39983961f, 0.840288162f},
-std::array<float,2>{0.502355158f, 0.323770881f},
-std::array<float,2>{0.261492401f, 0.479089141f},
-std::array<float,2>{0.7489838f, 0.993964612f},
-std::array<float,2>{0.232479885f, 0.732096434f},
-std::array<float,2>{0.936331034f, 0.209302112f},
-std::array<float,2>{0.168964416f, 0.276588947f},
-std::array<float,2>{0.990856409f, 0.812024057f},
-std::array<float,2>{0.324833781f, 0.567626476f},
-std::array<float,2>{0.626904249f, 0.0333703421f},
-std::array<float,2>{0.439165205f, 0.168161824f},
-std::array<float,2>{0.608293116f, 0.640816212f},
-std::array<float,2>{0.0784992948f, 0.90552789f},
-std::array<float,2>{0.855519772f, 0.379242659f},
-std::array<float,2>{0.147161797f, 0.0556794181f},
-std::array<float,2>{0.948831618f, 0.585286558f},
-std::array<float,2>{0.347940236f, 0.793505609f},
-std::array<float,2>{0.659454465f, 0.253236115f},
-std::array<float,2>{0.480794907f, 0.393638343f},
-std::array<float,2>{0.586587071f, 0.888266146f},
-std::array<float,2>{0.1164857f, 0.637066782f},
-std::array<float,2>{0.840591609f, 0.176530406f},
-std::array<float,2>{0.0247900449f, 0.328615248f},
-std::array<float,2>{0.800063431f, 0.812581778f},
-std::array<float,2>{0.431325167f, 0.547466874f},
-std::array<float,2>{0.538461745f, 0.0906744823f},
-std::array<float,2>{0.309957802f, 0.19858779f},
-std::array<float,2>{0.697223008f, 0.746148169f},
-std::array<float,2>{0.199267194f, 0.976926863f},
-std::array<float,2>{0.900979996f, 0.485554636f},
-std::array<float,2>{0.0718140081f, 0.129615009f},
-std::array<float,2>{0.863231301f, 0.659679234f},
-std::array<float,2>{0.468575209f, 0.91412729f},
-std::array<float,2>{0.615167677f, 0.424137652f},
-std::array<float,2>{0.339565068f, 0.301261872f},
-std::array<float,2>{0.649436653f, 0.769711494f},
-std::array<float,2>{0.177097768f, 0.623650014f},
-std::array<float,2>{0.972344041f, 0.0290779229f},
-std::array<float,2>{0.248232603f, 0.450940609f},
-std::array<float,2>{0.916014314f, 0.941389799f},
-std::array<float,2>{0.279121459f, 0.698985875f},
-std::array<float,2>{0.734274387f, 0.23807548f},
-std::array<float,2>{0.382299691f, 0.119347408f},
-std::array<float,2>{0.518819511f, 0.507548749f},
-std::array<float,2>{0.0454259999f, 0.870951891f},
-std::array<float,2>{0.762126744f, 0.357677996f},
-std::array<float,2>{0.208717152f, 0.127885371f},
-std::array<float,2>{0.883672595f, 0.661158323f},
-std::array<float,2>{0.291745067f, 0.921510458f},
-std::array<float,2>{0.714158654f, 0.426412016f},
-std::array<float,2>{0.408318818f, 0.297341645f},
-std::array<float,2>{0.562392116f, 0.76869446f},
-std::array<float,2>{0.0138154346f, 0.618476152f},
-std::array<float,2>{0.786255658f, 0.0254373699f},
-std::array<float,2>{0.099277921f, 0.445564687f},
-std::array<float,2>{0.812802494f, 0.94359237f},
-std::array<float,2>{0.499595791f, 0.701987803f},
-std::array<float,2>{0.565614045f, 0.238992199f},
-std::array<float,2>{0.359699339f, 0.123067945f},
-std::array<float,2>{0.6869995f, 0.502733827f},
-std::array<float,2>{0.126587927f, 0.874376655f},
-std::array<float,2>{0.95351702f, 0.353344977f},
-std::array<float,2>{0.0497052222f, 0.0603712797f},
-std::array<float,2>{0.773709714f, 0.580024064f},
-std::array<float,2>{0.395097941f, 0.790363252f},
-std::array<float,2>{0.514971614f, 0.257222235f},
-std::array<float,2>{0.255177289f, 0.394556552f},
-std::array<float,2>{0.739418149f, 0.885554016f},
-std::array<float,2>{0.225691795f, 0.635005116f},
-std::array<float,2>{0.924803913f, 0.174905568f},
-std::array<float,2>{0.157644376f, 0.334035933f},
-std::array<float,2>{0.99790287f, 0.817461431f},
-std::array<float,2>{0.316519022f, 0.554500282f},
-std::array<float,2>{0.637446105f, 0.0895479321f},
-std::array<float,2>{0.448615193f, 0.19963336f},
-std::array<float,2>{0.597846448f, 0.742209494f},
-std::array<float,2>{0.0899693891f, 0.983472466f},
-std::array<float,2>{0.846048832f, 0.491847456f},
-std::array<float,2>{0.154184088f, 0.0738321617f},
-std::array<float,2>{0.943481863f, 0.541891336f},
-std::array<float,2>{0.356623024f, 0.837881386f},
-std::array<float,2>{0.666467369f, 0.325985134f},
-std::array<float,2>{0.470037907f, 0.482446879f},
-std::array<float,2>{0.579764426f, 0.99662751f},
-std::array<float,2>{0.118038297f, 0.728202164f},
-std::array<float,2>{0.828469634f, 0.205333635f},
-std::array<float,2>{0.0181107428f, 0.280818909f},
-std::array<float,2>{0.809527576f, 0.806694508f},
-std::array<float,2>{0.429450214f, 0.563085616f},
-std::array<float,2>{0.542980611f, 0.0371329039f},
-std::array<float,2>{0.301908702f, 0.164535418f},
-std::array<float,2>{0.694432974f, 0.644946992f},
-std::array<float,2>{0.194700286f, 0.899011612f},
-std::array<float,2>{0.893440008f, 0.376903027f},
-std::array<float,2>{0.0650618821f, 0.230083704f},
-std::array<float,2>{0.869875968f, 0.707355738f},
-std::array<float,2>{0.459952176f, 0.959401965f},
-std::array<float,2>{0.621388137f, 0.453310311f},
-std::array<float,2>{0.335855752f, 0.362679005f},
-std::array<float,2>{0.643150508f, 0.854740739f},
-std::array<float,2>{0.183054954f, 0.516932547f},
-std::array<float,2>{0.983443975f, 0.094804801f},
-std::array<float,2>{0.234522521f, 0.411532074f},
-std::array<float,2>{0.911789894f, 0.93662411f},
-std::array<float,2>{0.270397544f, 0.684812963f},
-std::array<float,2>{0.724470317f, 0.150511116f},
-std::array<float,2>{0.386211276f, 0.004375658f},
-std::array<float,2>{0.527229249f, 0.606733978f},
-std::array<float,2>{0.0352664068f, 0.757050574f},
-std::array<float,2>{0.755490541f, 0.296006918f},
-std::array<float,2>{0.173993677f, 0.217416003f},
-std::array<float,2>{0.974321842f, 0.722402096f},
-std::array<float,2>{0.343219489f, 0.985649765f},
-std::array<float,2>{0.655849516f, 0.474305362f},
-std::array<float,2>{0.461394429f, 0.319211036f},
-std::array<float,2>{0.609985709f, 0.83570832f},
-std::array<float,2>{0.075921759f, 0.53562057f},
-std::array<float,2>{0.864874661f, 0.0673405826f},
-std::array<float,2>{0.0412827618f, 0.385017633f},
-std::array<float,2>{0.759589732f, 0.896983802f},
-std::array<float,2>{0.375712365f, 0.652280927f},
-std::array<float,2>{0.52232641f, 0.161103457f},
-std::array<float,2>{0.277056575f, 0.0423520766f},
-std::array<float,2>{0.726597428f, 0.575338185f},
-std::array<float,2>{0.243744045f, 0.803978503f},
-std::array<float,2>{0.918796659f, 0.269365102f},
-std::array<float,2>{0.111100234f, 0.105000928f},
-std::array<float,2>{0.838835955f, 0.526139498f},
-std::array<float,2>{0.477282733f, 0.848803163f},
-std::array<float,2>{0.590096533f, 0.371888041f},
-std::array<float,2>{0.343836129f, 0.467569917f},
-std::array<float,2>{0.660400391f, 0.963170707f},
-std::array<float,2>{0.142379493f, 0.712992787f},
-std::array<float,2>{0.950314999f, 0.226431489f},
-std::array<float,2>{0.198406324f, 0.285347134f},
-std::array<float,2>{0.905177772f, 0.760582685f},
-std::array<float,2>{0.308492035f, 0.601176143f},
-std::array<float,2>{0.701797485f, 0.014954594f},
-std::array<float,2>{0.435960203f, 0.14425756f},
-std::array<float,2>{0.531771958f, 0.677672625f},
-std::array<float,2>{0.0311437473f, 0.928918302f},
-std::array<float,2>{0.804676533f, 0.420429379f},
-std::array<float,2>{0.226796553f, 0.0208563469f},
-std::array<float,2>{0.932352722f, 0.609968364f},
-std::array<float,2>{0.263551235f, 0.774979591f},
-std::array<float,2>{0.742615461f, 0.305214196f},
-std::array<float,2>{0.403709412f, 0.434149176f},
-std::array<float,2>{0.504641712f, 0.907518923f},
-std::array<float,2>{0.0580251664f, 0.669929147f},
-std::array<float,2>{0.768721759f, 0.135514274f},
-std::array<float,2>{0.0851787403f, 0.346135736f},
-std::array<float,2>{0.851970971f, 0.859445214f},
-std::array<float,2>{0.442511797f, 0.513956606f},
-std::array<float,2>{0.602662027f, 0.116880991f},
-std::array<float,2>{0.323521137f, 0.248511419f},
-std::array<float,2>{0.630075753f, 0.687717438f},
-std::array<float,2>{0.164978892f, 0.949637651f},
-std::array<float,2>{0.988129914f, 0.440424562f},
-std::array<float,2>{0.00635083346f, 0.182908669f},
-std::array<float,2>{0.79367435f, 0.625123084f},
-std::array<float,2>{0.419548184f, 0.880258024f},
-std::array<float,2>{0.554570735f, 0.40135771f},
-std::array<float,2>{0.281825274f, 0.258937627f},
-std::array<float,2>{0.705617905f, 0.78335619f},
-std::array<float,2>{0.213079959f, 0.586267412f},
-std::array<float,2>{0.881138027f, 0.0539416634f},
-std::array<float,2>{0.133741394f, 0.494525403f},
-std::array<float,2>{0.967591703f, 0.969217002f},
-std::array<float,2>{0.368340909f, 0.741414905f},
-std::array<float,2>{0.673812211f, 0.191572502f},
-std::array<float,2>{0.485270858f, 0.0812094659f},
-std::array<float,2>{0.575124502f, 0.557716072f},
-std::array<float,2>{0.102207035f, 0.827895939f},
-std::array<float,2>{0.822760046f, 0.340695262f},
-std::array<float,2>{0.129227966f, 0.156886086f},
-std::array<float,2>{0.957613528f, 0.652352452f},
-std::array<float,2>{0.366947651f, 0.890713811f},
-std::array<float,2>{0.682145655f, 0.387174726f},
-std::array<float,2>{0.492946148f, 0.270049214f},
-std::array<float,2>{0.570066631f, 0.796983361f},
-std::array<float,2>{0.0947366878f, 0.572713315f},
-std::array<float,2>{0.817696929f, 0.0446301326f},
-std::array<float,2>{0.00814964157f, 0.47041595f},
-std::array<float,2>{0.782169282f, 0.988407493f},
-std::array<float,2>{0.41179961f, 0.726479113f},
-std::array<float,2>{0.556206822f, 0.214689597f},
-std::array<float,2>{0.296451271f, 0.0643352568f},
-std::array<float,2>{0.716930151f, 0.532592237f},
-std::array<float,2>{0.204657078f, 0.829700947f},
-std::array<float,2>{0.888847828f, 0.31342116f},
-std::array<float,2>{0.0874485373f, 0.00998366997f},
-std::array<float,2>{0.849845052f, 0.593797266f},
-std::array<float,2>{0.452299058f, 0.764008403f},
-std::array<float,2>{0.5958305f, 0.282870412f},
-std::array<float,2>{0.313657761f, 0.416064024f},
-std::array<float,2>{0.635795653f, 0.924764991f},
-std::array<float,2>{0.161460906f, 0.675699234f},
-std::array<float,2>{0.994749665f, 0.145170987f},
-std::array<float,2>{0.220829979f, 0.36741066f},
-std::array<float,2>{0.929446518f, 0.846169472f},
-std::array<float,2>{0.251992106f, 0.528231442f},
-std::array<float,2>{0.736181498f, 0.10815949f},
-std::array<float,2>{0.391980499f, 0.219073877f},
-std::array<float,2>{0.510839701f, 0.717165291f},
-std::array<float,2>{0.0508112796f, 0.968243301f},
-std::array<float,2>{0.778588474f, 0.462768108f},
-std::array<float,2>{0.187654451f, 0.111444272f},
-std::array<float,2>{0.897200704f, 0.509266913f},
-std::array<float,2>{0.298035622f, 0.865800679f},
-std::array<float,2>{0.688034654f, 0.349968344f},
-std::array<float,2>{0.423992395f, 0.442790747f},
-std::array<float,2>{0.541259825f, 0.946656108f},
-std::array<float,2>{0.0211469121f, 0.693048358f},
-std::array<float,2>{0.80839932f, 0.243190974f},
-std::array<float,2>{0.12193992f, 0.309704125f},
-std::array<float,2>{0.832830787f, 0.778598845f},
-std::array<float,2>{0.473316133f, 0.616854489f},
-std::array<float,2>{0.585551977f, 0.019325994f},
-std::array<float,2>{0.354255438f, 0.139717475f},
-std::array<float,2>{0.669385314f, 0.665230989f},
-std::array<float,2>{0.149508998f, 0.910423219f},
-std::array<float,2>{0.937554359f, 0.432646573f},
-std::array<float,2>{0.0313981809f, 0.188442171f},
-std::array<float,2>{0.750449896f, 0.734684944f},
-std::array<float,2>{0.388118118f, 0.975051641f},
-std::array<float,2>{0.530651271f, 0.499167293f},
-std::array<float,2>{0.266781747f, 0.338927537f},
-std::array<float,2>{0.719182909f, 0.823318481f},
-std::array<float,2>{0.238448456f, 0.559230983f},
-std::array<float,2>{0.907078743f, 0.0832059085f},
-std::array<float,2>{0.184615552f, 0.40400365f},
-std::array<float,2>{0.979976654f, 0.877700686f},
-std::array<float,2>{0.330085367f, 0.630081356f},
-std::array<float,2>{0.648046315f, 0.187482521f},
-std::array<float,2>{0.454955727f, 0.0490252599f},
-std::array<float,2>{0.618198514f, 0.590668201f},
-std::array<float,2>{0.0675654337f, 0.786275148f},
-std::array<float,2>{0.871975005f, 0.265097857f},
-std::array<float,2>{0.246806562f, 0.236895338f},
-std::array<float,2>{0.917442501f, 0.697496951f},
-std::array<float,2>{0.279580742f, 0.939549923f},
-std::array<float,2>{0.731057882f, 0.449918181f},
-std::array<float,2>{0.380154997f, 0.359103888f},
-std::array<float,2>{0.517423391f, 0.869550467f},
-std::array<float,2>{0.0442355461f, 0.506691158f},
-std::array<float,2>{0.764299572f, 0.120753303f},
-std::array<float,2>{0.0723667815f, 0.425429285f},
-std::array<float,2>{0.860340953f, 0.915955126f},
-std::array<float,2>{0.46644035f, 0.65866369f},
-std::array<float,2>{0.616793096f, 0.129925609f},
-std::array<float,2>{0.337360084f, 0.0274030473f},
-std::array<float,2>{0.650702596f, 0.624323308f},
-std::array<float,2>{0.179133147f, 0.770780981f},
-std::array<float,2>{0.968946457f, 0.302223057f},
-std::array<float,2>{0.027243007f, 0.0909161642f},
-std::array<float,2>{0.797812521f, 0.548027396f},
-std::array<float,2>{0.432712942f, 0.813865244f},
-std::array<float,2>{0.535450578f, 0.329919636f},
-std::array<float,2>{0.310738921f, 0.484469891f},
-std::array<float,2>{0.698698521f, 0.97783345f},
-std::array<float,2>{0.201263174f, 0.747790992f},
-std::array<float,2>{0.900274634f, 0.197568923f},
-std::array<float,2>{0.14624235f, 0.25225684f},
-std::array<float,2>{0.946833253f, 0.794846356f},
-std::array<float,2>{0.351377785f, 0.584857047f},
-std::array<float,2>{0.657624424f, 0.0547804125f},
-std::array<float,2>{0.48344335f, 0.177117839f},
-std::array<float,2>{0.588008046f, 0.637734771f},
-std::array<float,2>{0.11479114f, 0.887529731f},
-std::array<float,2>{0.842990994f, 0.392671794f},
-std::array<float,2>{0.171374023f, 0.0348517075f},
-std::array<float,2>{0.98874259f, 0.566774368f},
-std::array<float,2>{0.327538639f, 0.810597777f},
-std::array<float,2>{0.62741369f, 0.2759929f},
-std::array<float,2>{0.439853698f, 0.380198836f},
-std::array<float,2>{0.60710299f, 0.904300749f},
-std::array<float,2>{0.0802893117f, 0.641976535f},
-std::array<float,2>{0.858102798f, 0.169219419f},
-std::array<float,2>{0.0594323575f, 0.322312027f},
-std::array<float,2>{0.770140588f, 0.841482699f},
-std::array<float,2>{0.401849955f, 0.546150923f},
-std::array<float,2>{0.501464188f, 0.0777802467f},
-std::array<float,2>{0.258351862f, 0.210132554f},
-std::array<float,2>{0.746488035f, 0.731032133f},
-std::array<float,2>{0.230684623f, 0.992494047f},
-std::array<float,2>{0.934523284f, 0.480167359f},
-std::array<float,2>{0.105938479f, 0.15613167f},
-std::array<float,2>{0.825039089f, 0.682820201f},
-std::array<float,2>{0.489252239f, 0.933133602f},
-std::array<float,2>{0.570361555f, 0.407319307f},
-std::array<float,2>{0.374293149f, 0.292182624f},
-std::array<float,2>{0.678294241f, 0.75068301f},
-std::array<float,2>{0.139735401f, 0.605423331f},
-std::array<float,2>{0.96137172f, 0.0016632945f},
-std::array<float,2>{0.217630237f, 0.457456768f},
-std::array<float,2>{0.876678944f, 0.956852078f},
-std::array<float,2>{0.28536284f, 0.703883708f},
-std::array<float,2>{0.709877312f, 0.232975885f},
-std::array<float,2>{0.417021722f, 0.100218467f},
-std::array<float,2>{0.550483704f, 0.521975696f},
-std::array<float,2>{0.00137363409f, 0.857333004f},
-std::array<float,2>{0.790414512f, 0.364805251f},
-std::array<float,2>{0.222696021f, 0.173273727f},
-std::array<float,2>{0.923296571f, 0.633043885f},
-std::array<float,2>{0.257702947f, 0.883482695f},
-std::array<float,2>{0.7404477f, 0.396731615f},
-std::array<float,2>{0.396647304f, 0.253967762f},
-std::array<float,2>{0.51270169f, 0.792810619f},
-std::array<float,2>{0.0477218181f, 0.580504715f},
-std::array<float,2>{0.776678801f, 0.0621693544f},
-std::array<float,2>{0.0931343734f, 0.489609003f},
-std::array<float,2>{0.844693363f, 0.981290102f},
-std::array<float,2>{0.446535558f, 0.745500863f},
-std::array<float,2>{0.60068655f, 0.202509895f},
-std::array<float,2>{0.319177926f, 0.0870233476f},
-std::array<float,2>{0.639941454f, 0.552403331f},
-std::array<float,2>{0.158278361f, 0.819737613f},
-std::array<float,2>{0.998354256f, 0.33219704f},
-std::array<float,2>{0.0126423081f, 0.024509253f},
-std::array<float,2>{0.788886607f, 0.620241642f},
-std::array<float,2>{0.406339139f, 0.766774535f},
-std::array<float,2>{0.559700608f, 0.300733089f},
-std::array<float,2>{0.290090919f, 0.427784681f},
-std::array<float,2>{0.712765157f, 0.919636071f},
-std::array<float,2>{0.210860938f, 0.662877619f},
-std::array<float,2>{0.884970963f, 0.125197336f},
-std::array<float,2>{0.128254607f, 0.35353303f},
-std::array<float,2>{0.955861568f, 0.871447444f},
-std::array<float,2>{0.363269955f, 0.500834584f},
-std::array<float,2>{0.684517503f, 0.122307897f},
-std::array<float,2>{0.496599346f, 0.241819367f},
-std::array<float,2>{0.562591136f, 0.700840712f},
-std::array<float,2>{0.101410709f, 0.942981064f},
-std::array<float,2>{0.816062868f, 0.447514474f},
-std::array<float,2>{0.181552932f, 0.0968328491f},
-std::array<float,2>{0.981592059f, 0.518747866f},
-std::array<float,2>{0.332575411f, 0.852279782f},
-std::array<float,2>{0.642284513f, 0.360183209f},
-std::array<float,2>{0.458174765f, 0.455946565f},
-std::array<float,2>{0.623183727f, 0.957475662f},
-std::array<float,2>{0.0627696514f, 0.709194958f},
-std::array<float,2>{0.869020224f, 0.228367209f},
-std::array<float,2>{0.0374114923f, 0.2940588f},
-std::array<float,2>{0.75734216f, 0.754100144f},
-std::array<float,2>{0.382938206f, 0.608326018f},
-std::array<float,2>{0.524721265f, 0.00773902424f},
-std::array<float,2>{0.27315104f, 0.148930341f},
-std::array<float,2>{0.724748075f, 0.685977697f},
-std::array<float,2>{0.236777276f, 0.933727145f},
-std::array<float,2>{0.912855923f, 0.412431955f},
-std::array<float,2>{0.121089913f, 0.204288721f},
-std::array<float,2>{0.831973135f, 0.729617357f},
-std::array<float,2>{0.471447736f, 0.998506904f},
-std::array<float,2>{0.580658913f, 0.481125712f},
-std::array<float,2>{0.358232468f, 0.327118158f},
-std::array<float,2>{0.665100813f, 0.83806169f},
-std::array<float,2>{0.154320508f, 0.540183902f},
-std::array<float,2>{0.941419661f, 0.0705925524f},
-std::array<float,2>{0.192488283f, 0.378130227f},
-std::array<float,2>{0.891908228f, 0.900586426f},
-std::array<float,2>{0.304245859f, 0.647919893f},
-std::array<float,2>{0.692545056f, 0.166189209f},
-std::array<float,2>{0.426352561f, 0.0368242301f},
-std::array<float,2>{0.545411229f, 0.565583229f},
-std::array<float,2>{0.0158735663f, 0.805443823f},
-std::array<float,2>{0.811615884f, 0.278539538f},
-std::array<float,2>{0.142923191f, 0.224362582f},
-std::array<float,2>{0.951397359f, 0.711758912f},
-std::array<float,2>{0.347221404f, 0.962829709f},
-std::array<float,2>{0.662464976f, 0.464902014f},
-std::array<float,2>{0.479064494f, 0.373641342f},
-std::array<float,2>{0.591804981f, 0.851549208f},
-std::array<float,2>{0.111735769f, 0.523797512f},
-std::array<float,2>{0.837596953f, 0.103323609f},
-std::array<float,2>{0.0288700126f, 0.418934435f},
-std::array<float,2>{0.801659107f, 0.926902175f},
-std::array<float,2>{0.433857322f, 0.678725421f},
-std::array<float,2>{0.533630133f, 0.141033396f},
-std::array<float,2>{0.306191862f, 0.0119511764f},
-std::array<float,2>{0.699859679f, 0.598793924f},
-std::array<float,2>{0.195727065f, 0.757898986f},
-std::array<float,2>{0.903188586f, 0.288808197f},
-std::array<float,2>{0.0762644783f, 0.0697110444f},
-std::array<float,2>{0.865850091f, 0.53853482f},
-std::array<float,2>{0.463971287f, 0.833878219f},
-std::array<float,2>{0.612453938f, 0.317470938f},
-std::array<float,2>{0.340725183f, 0.475375921f},
-std::array<float,2>{0.652620673f, 0.988246083f},
-std::array<float,2>{0.172309652f, 0.720506489f},
-std::array<float,2>{0.974809289f, 0.215347797f},
-std::array<float,2>{0.244437724f, 0.266072273f},
-std::array<float,2>{0.919963896f, 0.80155158f},
-std::array<float,2>{0.275265962f, 0.577920377f},
-std::array<float,2>{0.72934103f, 0.0405944884f},
-std::array<float,2>{0.378654778f, 0.162314951f},
-std::array<float,2>{0.521226943f, 0.649313986f},
-std::array<float,2>{0.0391311236f, 0.895025551f},
-std::array<float,2>{0.761367798f, 0.384494513f},
-std::array<float,2>{0.211467922f, 0.0512469448f},
-std::array<float,2>{0.879253089f, 0.588647723f},
-std::array<float,2>{0.284455091f, 0.781495154f},
-std::array<float,2>{0.704852462f, 0.259796143f},
-std::array<float,2>{0.420417368f, 0.399321735f},
-std::array<float,2>{0.552255332f, 0.880888462f},
-std::array<float,2>{0.00504120905f, 0.627280056f},
-std::array<float,2>{0.796030998f, 0.180355012f},
-std::array<float,2>{0.105326705f, 0.343098134f},
-std::array<float,2>{0.820478678f, 0.824593782f},
-std::array<float,2>{0.487689763f, 0.556432724f},
-std::array<float,2>{0.577232301f, 0.0798133686f},
-std::array<float,2>{0.370712548f, 0.194841206f},
-std::array<float,2>{0.675433457f, 0.74019593f},
-std::array<float,2>{0.135652378f, 0.972378135f},
-std::array<float,2>{0.965087175f, 0.493134499f},
-std::array<float,2>{0.0559828244f, 0.133906275f},
-std::array<float,2>{0.766276956f, 0.668523192f},
-std::array<float,2>{0.404861242f, 0.910041809f},
-std::array<float,2>{0.506498098f, 0.436589211f},
-std::array<float,2>{0.263874084f, 0.308117211f},
-std::array<float,2>{0.744783401f, 0.777169168f},
-std::array<float,2>{0.228663668f, 0.613071501f},
-std::array<float,2>{0.930401087f, 0.0221919082f},
-std::array<float,2>{0.167220533f, 0.438753426f},
-std::array<float,2>{0.985715091f, 0.952941418f},
-std::array<float,2>{0.32219398f, 0.690372527f},
-std::array<float,2>{0.631879032f, 0.246591061f},
-std::array<float,2>{0.444835961f, 0.114919037f},
-std::array<float,2>{0.60528481f, 0.512156248f},
-std::array<float,2>{0.0834160447f, 0.861972988f},
-std::array<float,2>{0.854386508f, 0.345030904f},
-std::array<float,2>{0.163419023f, 0.147434235f},
-std::array<float,2>{0.992236733f, 0.672556281f},
-std::array<float,2>{0.316091061f, 0.922808409f},
-std::array<float,2>{0.634696603f, 0.415930569f},
-std::array<float,2>{0.450527608f, 0.284138292f},
-std::array<float,2>{0.595583797f, 0.763605714f},
-std::array<float,2>{0.0889380798f, 0.59745729f},
-std::array<float,2>{0.848044693f, 0.00951510668f},
-std::array<float,2>{0.0534030162f, 0.463859081f},
-std::array<float,2>{0.781057119f, 0.964943647f},
-std::array<float,2>{0.393477827f, 0.715874612f},
-std::array<float,2>{0.508927464f, 0.221699864f},
-std::array<float,2>{0.250130713f, 0.107206076f},
-std::array<float,2>{0.738076746f, 0.529697776f},
-std::array<float,2>{0.220444053f, 0.845332086f},
-std::array<float,2>{0.926604033f, 0.369696468f},
-std::array<float,2>{0.0958479792f, 0.0459947251f},
-std::array<float,2>{0.820176184f, 0.571464539f},
-std::array<float,2>{0.49472934f, 0.799698174f},
-std::array<float,2>{0.567527354f, 0.273435265f},
-std::array<float,2>{0.364621252f, 0.388944596f},
-std::array<float,2>{0.680085003f, 0.894385517f},
-std::array<float,2>{0.132603496f, 0.654726028f},
-std::array<float,2>{0.960847378f, 0.158455849f},
-std::array<float,2>{0.206299216f, 0.315225959f},
-std::array<float,2>{0.888244033f, 0.830330908f},
-std::array<float,2>{0.293379843f, 0.533911765f},
-std::array<float,2>{0.716724038f, 0.06568221f},
-std::array<float,2>{0.413210332f, 0.211405843f},
-std::array<float,2>{0.557268977f, 0.724059939f},
-std::array<float,2>{0.0101292832f, 0.991938472f},
-std::array<float,2>{0.783932865f, 0.471335381f},
-std::array<float,2>{0.240683228f, 0.0853651538f},
-std::array<float,2>{0.909135044f, 0.560626268f},
-std::array<float,2>{0.267995834f, 0.821254611f},
-std::array<float,2>{0.721134126f, 0.336861372f},
-std::array<float,2>{0.390070051f, 0.496273607f},
-std::array<float,2>{0.528716385f, 0.973483622f},
-std::array<float,2>{0.033960443f, 0.73642695f},
-std::array<float,2>{0.752944946f, 0.190363646f},
-std::array<float,2>{0.0686575696f, 0.261767715f},
-std::array<float,2>{0.874687374f, 0.78903538f},
-std::array<float,2>{0.455318302f, 0.593591094f},
-std::array<float,2>{0.621025801f, 0.0484033152f},
-std::array<float,2>{0.328278571f, 0.185373768f},
-std::array<float,2>{0.64481467f, 0.632642925f},
-std::array<float,2>{0.187206179f, 0.876408339f},
-std::array<float,2>{0.978118002f, 0.405629635f},
-std::array<float,2>{0.0221742056f, 0.245766461f},
-std::array<float,2>{0.806542814f, 0.693892717f},
-std::array<float,2>{0.423421502f, 0.94746083f},
-std::array<float,2>{0.540333271f, 0.444979906f},
-std::array<float,2>{0.300343096f, 0.349513054f},
-std::array<float,2>{0.690944195f, 0.864206731f},
-std::array<float,2>{0.1908876f, 0.511131704f},
-std::array<float,2>{0.896341026f, 0.111002624f},
-std::array<float,2>{0.151081279f, 0.43035233f},
-std::array<float,2>{0.940024674f, 0.913347602f},
-std::array<float,2>{0.352137953f, 0.667847991f},
-std::array<float,2>{0.670502901f, 0.137770817f},
-std::array<float,2>{0.476238072f, 0.016211167f},
-std::array<float,2>{0.58386457f, 0.614750743f},
-std::array<float,2>{0.124180146f, 0.780957758f},
-std::array<float,2>{0.835026562f, 0.311440945f},
-std::array<float,2>{0.200521395f, 0.196163625f},
-std::array<float,2>{0.901775301f, 0.748623312f},
-std::array<float,2>{0.309351265f, 0.980359018f},
-std::array<float,2>{0.696252167f, 0.487141877f},
-std::array<float,2>{0.430263847f, 0.331034303f},
-std::array<float,2>{0.537328899f, 0.815661013f},
-std::array<float,2>{0.0239985008f, 0.550304472f},
-std::array<float,2>{0.799620271f, 0.0925726369f},
-std::array<float,2>{0.115494736f, 0.391275138f},
-std::array<float,2>{0.841059566f, 0.888724804f},
-std::array<float,2>{0.482401371f, 0.639930844f},
-std::array<float,2>{0.587198257f, 0.178475142f},
-std::array<float,2>{0.348635733f, 0.0578345805f},
-std::array<float,2>{0.658265948f, 0.583487988f},
-std::array<float,2>{0.148072094f, 0.79684025f},
-std::array<float,2>{0.947824657f, 0.250329018f},
-std::array<float,2>{0.0461412743f, 0.118575625f},
-std::array<float,2>{0.762770891f, 0.505337775f},
-std::array<float,2>{0.381682694f, 0.867361546f},
-std::array<float,2>{0.518274844f, 0.356420457f},
-std::array<float,2>{0.278163105f, 0.4530572f},
-std::array<float,2>{0.73310107f, 0.938655794f},
-std::array<float,2>{0.249864176f, 0.695936918f},
-std::array<float,2>{0.914479673f, 0.236223951f},
-std::array<float,2>{0.176013008f, 0.303818524f},
-std::array<float,2>{0.970804393f, 0.772935569f},
-std::array<float,2>{0.337965935f, 0.622595131f},
-std::array<float,2>{0.649053931f, 0.0301237833f},
-std::array<float,2>{0.467435658f, 0.1314127f},
-std::array<float,2>{0.613680959f, 0.657106042f},
-std::array<float,2>{0.0709713772f, 0.916918516f},
-std::array<float,2>{0.861892402f, 0.422201693f},
-std::array<float,2>{0.137690797f, 0.00286714733f},
-std::array<float,2>{0.963411927f, 0.602417588f},
-std::array<float,2>{0.371646911f, 0.753309429f},
-std::array<float,2>{0.677280486f, 0.290012479f},
-std::array<float,2>{0.491683573f, 0.408581138f},
-std::array<float,2>{0.57305795f, 0.92987144f},
-std::array<float,2>{0.108321577f, 0.681112111f},
-std::array<float,2>{0.827523649f, 0.153842598f},
-std::array<float,2>{0.00350773381f, 0.366728485f},
-std::array<float,2>{0.79101932f, 0.858650744f},
-std::array<float,2>{0.414996803f, 0.520091236f},
-std::array<float,2>{0.547760606f, 0.0980018228f},
-std::array<float,2>{0.28883481f, 0.231770128f},
-std::array<float,2>{0.708509147f, 0.706416011f},
-std::array<float,2>{0.216267988f, 0.953418732f},
-std::array<float,2>{0.878418207f, 0.460508376f},
-std::array<float,2>{0.0799775347f, 0.171079502f},
-std::array<float,2>{0.856552482f, 0.643015206f},
-std::array<float,2>{0.438377321f, 0.903217375f},
-std::array<float,2>{0.608475566f, 0.382486552f},
-std::array<float,2>{0.325808704f, 0.274467975f},
-std::array<float,2>{0.625217974f, 0.810244501f},
-std::array<float,2>{0.168330625f, 0.568460763f},
-std::array<float,2>{0.991425395f, 0.0318018124f},
-std::array<float,2>{0.234358788f, 0.478434384f},
-std::array<float,2>{0.936639667f, 0.99504143f},
-std::array<float,2>{0.260092854f, 0.733541369f},
-std::array<float,2>{0.749187291f, 0.208586186f},
-std::array<float,2>{0.39926064f, 0.0743398592f},
-std::array<float,2>{0.5032745f, 0.544805348f},
-std::array<float,2>{0.0617183f, 0.842469037f},
-std::array<float,2>{0.771956146f, 0.322025806f},
-std::array<float,2>{0.213615805f, 0.180136293f},
-std::array<float,2>{0.881433904f, 0.6278193f},
-std::array<float,2>{0.281605184f, 0.881353199f},
-std::array<float,2>{0.705141306f, 0.398618817f},
-std::array<float,2>{0.419120669f, 0.260464609f},
-std::array<float,2>{0.553906024f, 0.782157719f},
-std::array<float,2>{0.00600502966f, 0.58820653f},
-std::array<float,2>{0.793152094f, 0.0517304465f},
-std::array<float,2>{0.101897269f, 0.492558539f},
-std::array<float,2>{0.822556376f, 0.971699476f},
-std::array<float,2>{0.484774083f, 0.739623129f},
-std::array<float,2>{0.574238658f, 0.194742337f},
-std::array<float,2>{0.369051248f, 0.0795640647f},
-std::array<float,2>{0.673208416f, 0.555692017f},
-std::array<float,2>{0.133240059f, 0.824894488f},
-std::array<float,2>{0.967114866f, 0.34334299f},
-std::array<float,2>{0.0583389923f, 0.0217419192f},
-std::array<float,2>{0.769493043f, 0.612398028f},
-std::array<float,2>{0.403976411f, 0.776573122f},
-std::array<float,2>{0.504335821f, 0.307767749f},
-std::array<float,2>{0.263121367f, 0.437270343f},
-std::array<float,2>{0.742837548f, 0.909594119f},
-std::array<float,2>{0.227492675f, 0.668000579f},
-std::array<float,2>{0.931882977f, 0.134707153f},
-std::array<float,2>{0.164083451f, 0.345334858f},
-std::array<float,2>{0.987587214f, 0.861601591f},
-std::array<float,2>{0.324209332f, 0.512308896f},
-std::array<float,2>{0.630389273f, 0.114677221f},
-std::array<float,2>{0.442915052f, 0.246396825f},
-std::array<float,2>{0.603092492f, 0.689558625f},
-std::array<float,2>{0.085449487f, 0.952400088f},
-std::array<float,2>{0.852462351f, 0.439169854f},
-std::array<float,2>{0.142086551f, 0.102879316f},
-std::array<float,2>{0.950803638f, 0.524401605f},
-std::array<float,2>{0.34427011f, 0.850749195f},
-std::array<float,2>{0.660851181f, 0.3731848f},
-std::array<float,2>{0.476923734f, 0.465736419f},
-std::array<float,2>{0.590607107f, 0.962179482f},
-std::array<float,2>{0.110504456f, 0.710953057f},
-std::array<float,2>{0.838265479f, 0.223804429f},
-std::array<float,2>{0.0303882677f, 0.28811574f},
-std::array<float,2>{0.803954601f, 0.758424044f},
-std::array<float,2>{0.436205328f, 0.599313259f},
-std::array<float,2>{0.531632185f, 0.0126082636f},
-std::array<float,2>{0.3080917f, 0.141506791f},
-std::array<float,2>{0.701430321f, 0.679414749f},
-std::array<float,2>{0.198784828f, 0.927266181f},
-std::array<float,2>{0.904491007f, 0.418168664f},
-std::array<float,2>{0.0752554163f, 0.215029091f},
-std::array<float,2>{0.864431977f, 0.72013098f},
-std::array<float,2>{0.461907297f, 0.987428427f},
-std::array<float,2>{0.609590769f, 0.474639446f},
-std::array<float,2>{0.343489975f, 0.318290502f},
-std::array<float,2>{0.655576885f, 0.833418012f},
-std::array<float,2>{0.174544513f, 0.538996279f},
-std::array<float,2>{0.973868966f, 0.0700881481f},
-std::array<float,2>{0.243478805f, 0.384035289f},
-std::array<float,2>{0.91817677f, 0.894608378f},
-std::array<float,2>{0.27655521f, 0.6486395f},
-std::array<float,2>{0.727288127f, 0.162694812f},
-std::array<float,2>{0.375478178f, 0.0401398316f},
-std::array<float,2>{0.521688342f, 0.577625096f},
-std::array<float,2>{0.0415218994f, 0.800944269f},
-std::array<float,2>{0.758933365f, 0.266135007f},
-std::array<float,2>{0.183466509f, 0.22767067f},
-std::array<float,2>{0.984039366f, 0.709872425f},
-std::array<float,2>{0.335135877f, 0.957898676f},
-std::array<float,2>{0.642735541f, 0.455425918f},
-std::array<float,2>{0.459028602f, 0.359624475f},
-std::array<float,2>{0.621816456f, 0.8519876f},
-std::array<float,2>{0.0649109334f, 0.519087613f},
-std::array<float,2>{0.869163632f, 0.0972268879f},
-std::array<float,2>{0.0357532017f, 0.412975132f},
-std::array<float,2>{0.75527519f, 0.934383273f},
-std::array<float,2>{0.386542648f, 0.686177313f},
-std::array<float,2>{0.526396632f, 0.148696244f},
-std::array<float,2>{0.270014614f, 0.00714095496f},
-std::array<float,2>{0.723813713f, 0.607568026f},
-std::array<float,2>{0.235262349f, 0.75464803f},
-std::array<float,2>{0.911341369f, 0.294905603f},
-std::array<float,2>{0.117426105f, 0.0710709468f},
-std::array<float,2>{0.828646898f, 0.540947556f},
-std::array<float,2>{0.470564216f, 0.838514924f},
-std::array<float,2>{0.579131663f, 0.326380044f},
-std::array<float,2>{0.357099861f, 0.4807491f},
-std::array<float,2>{0.666965604f, 0.998937964f},
-std::array<float,2>{0.15340215f, 0.730353713f},
-std::array<float,2>{0.94389528f, 0.204924196f},
-std::array<float,2>{0.195026308f, 0.279284418f},
-std::array<float,2>{0.892648101f, 0.804977298f},
-std::array<float,2>{0.302489668f, 0.566261172f},
-std::array<float,2>{0.694948673f, 0.0364906713f},
-std::array<float,2>{0.428716958f, 0.166819647f},
-std::array<float,2>{0.543728948f, 0.648130655f},
-std::array<float,2>{0.0179861207f, 0.901065946f},
-std::array<float,2>{0.808653831f, 0.378869951f},
-std::array<float,2>{0.226470098f, 0.0615518689f},
-std::array<float,2>{0.924100995f, 0.580611646f},
-std::array<float,2>{0.255801737f, 0.792223871f},
-std::array<float,2>{0.739783108f, 0.254787892f},
-std::array<float,2>{0.394830376f, 0.397048265f},
-std::array<float,2>{0.515407085f, 0.882930398f},
-std::array<float,2>{0.0489701293f, 0.633433402f},
-std::array<float,2>{0.774394155f, 0.173529252f},
-std::array<float,2>{0.0904575512f, 0.332980275f},
-std::array<float,2>{0.846411407f, 0.820165038f},
-std::array<float,2>{0.448841929f, 0.55176568f},
-std::array<float,2>{0.598487854f, 0.08774174f},
-std::array<float,2>{0.317085922f, 0.202652156f},
-std::array<float,2>{0.637135088f, 0.745858312f},
-std::array<float,2>{0.158086807f, 0.980675995f},
-std::array<float,2>{0.997495472f, 0.49003005f},
-std::array<float,2>{0.0144317802f, 0.125685126f},
-std::array<float,2>{0.786779344f, 0.662414193f},
-std::array<float,2>{0.408874273f, 0.919353247f},
-std::array<float,2>{0.561834693f, 0.428488791f},
-std::array<float,2>{0.291242659f, 0.299961835f},
-std::array<float,2>{0.714807391f, 0.767119825f},
-std::array<float,2>{0.208083466f, 0.62065345f},
-std::array<float,2>{0.882887483f, 0.0249043703f},
-std::array<float,2>{0.126186401f, 0.447962284f},
-std::array<float,2>{0.953898847f, 0.942860126f},
-std::array<float,2>{0.360306084f, 0.700393617f},
-std::array<float,2>{0.687112689f, 0.241538927f},
-std::array<float,2>{0.49917528f, 0.122579537f},
-std::array<float,2>{0.566275954f, 0.500438273f},
-std::array<float,2>{0.0990537778f, 0.871923089f},
-std::array<float,2>{0.812999904f, 0.354219824f},
-std::array<float,2>{0.140385926f, 0.153665826f},
-std::array<float,2>{0.961672902f, 0.681437254f},
-std::array<float,2>{0.374977648f, 0.930448294f},
-std::array<float,2>{0.678057492f, 0.408779651f},
-std::array<float,2>{0.488694549f, 0.289166451f},
-std::array<float,2>{0.571158409f, 0.753628969f},
-std::array<float,2>{0.106212981f, 0.601991057f},
-std::array<float,2>{0.824526191f, 0.00238359696f},
-std::array<float,2>{0.00183565833f, 0.460193753f},
-std::array<float,2>{0.790558636f, 0.954032242f},
-std::array<float,2>{0.417685598f, 0.706585944f},
-std::array<float,2>{0.550019026f, 0.232280523f},
-std::array<float,2>{0.28595227f, 0.0984527171f},
-std::array<float,2>{0.709369183f, 0.519754708f},
-std::array<float,2>{0.217055872f, 0.859301448f},
-std::array<float,2>{0.876041472f, 0.366686046f},
-std::array<float,2>{0.0805754736f, 0.0314992443f},
-std::array<float,2>{0.85768497f, 0.569302857f},
-std::array<float,2>{0.440147698f, 0.809982836f},
-std::array<float,2>{0.606610537f, 0.275042057f},
-std::array<float,2>{0.327663451f, 0.381982774f},
-std::array<float,2>{0.627927244f, 0.902553439f},
-std::array<float,2>{0.171845138f, 0.643356025f},
-std::array<float,2>{0.989087164f, 0.17166917f},
-std::array<float,2>{0.23127462f, 0.321651965f},
-std::array<float,2>{0.933691204f, 0.841870606f},
-std::array<float,2>{0.257995963f, 0.544209063f},
-std::array<float,2>{0.746971726f, 0.0749721602f},
-std::array<float,2>{0.402121037f, 0.208135739f},
-std::array<float,2>{0.501837134f, 0.734031141f},
-std::array<float,2>{0.0587589182f, 0.994583666f},
-std::array<float,2>{0.769676208f, 0.477627963f},
-std::array<float,2>{0.202113509f, 0.0921980068f},
-std::array<float,2>{0.899623156f, 0.549831331f},
-std::array<float,2>{0.31135571f, 0.81639725f},
-std::array<float,2>{0.698786318f, 0.330302566f},
-std::array<float,2>{0.43316555f, 0.486527443f},
-std::array<float,2>{0.535781503f, 0.979961812f},
-std::array<float,2>{0.0268253647f, 0.748422503f},
-std::array<float,2>{0.796962023f, 0.195601404f},
-std::array<float,2>{0.114607148f, 0.250606716f},
-std::array<float,2>{0.843534887f, 0.796252072f},
-std::array<float,2>{0.484194934f, 0.583647311f},
-std::array<float,2>{0.588549614f, 0.058565598f},
-std::array<float,2>{0.350986719f, 0.177921966f},
-std::array<float,2>{0.658040881f, 0.640617251f},
-std::array<float,2>{0.145656109f, 0.889245629f},
-std::array<float,2>{0.946675837f, 0.391062081f},
-std::array<float,2>{0.0445718914f, 0.235509068f},
-std::array<float,2>{0.764015019f, 0.695409298f},
-std::array<float,2>{0.380858928f, 0.938970983f},
-std::array<float,2>{0.516823292f, 0.45241037f},
-std::array<float,2>{0.280224174f, 0.355945498f},
-std::array<float,2>{0.730948031f, 0.867965579f},
-std::array<float,2>{0.246443063f, 0.505725563f},
-std::array<float,2>{0.917574584f, 0.118822664f},
-std::array<float,2>{0.179684713f, 0.422552586f},
-std::array<float,2>{0.969503641f, 0.916116059f},
-std::array<float,2>{0.337875694f, 0.656726837f},
-std::array<float,2>{0.650886536f, 0.130912825f},
-std::array<float,2>{0.466190368f, 0.0295989625f},
-std::array<float,2>{0.61623913f, 0.622233689f},
-std::array<float,2>{0.0731433108f, 0.773190498f},
-std::array<float,2>{0.859859169f, 0.304528743f},
-std::array<float,2>{0.238987356f, 0.189522132f},
-std::array<float,2>{0.906356573f, 0.736862659f},
-std::array<float,2>{0.267147183f, 0.973095536f},
-std::array<float,2>{0.719438791f, 0.496723533f},
-std::array<float,2>{0.388658524f, 0.336303204f},
-std::array<float,2>{0.531153679f, 0.820424199f},
-std::array<float,2>{0.0319321416f, 0.561325848f},
-std::array<float,2>{0.750824511f, 0.0858623683f},
-std::array<float,2>{0.0680389106f, 0.406197309f},
-std::array<float,2>{0.871198773f, 0.876919031f},
-std::array<float,2>{0.454164505f, 0.63224709f},
-std::array<float,2>{0.618785501f, 0.184674427f},
-std::array<float,2>{0.330920845f, 0.0480793044f},
-std::array<float,2>{0.647465527f, 0.593181312f},
-std::array<float,2>{0.185335875f, 0.788200796f},
-std::array<float,2>{0.980390608f, 0.262456506f},
-std::array<float,2>{0.0208001137f, 0.110745586f},
-std::array<float,2>{0.807805836f, 0.511710703f},
-std::array<float,2>{0.424437046f, 0.863699734f},
-std::array<float,2>{0.54193753f, 0.348927319f},
-std::array<float,2>{0.298415571f, 0.444399446f},
-std::array<float,2>{0.687575698f, 0.948143482f},
-std::array<float,2>{0.188162118f, 0.693545759f},
-std::array<float,2>{0.89660114f, 0.245169252f},
-std::array<float,2>{0.150247514f, 0.310909301f},
-std::array<float,2>{0.938078225f, 0.780620813f},
-std::array<float,2>{0.353940248f, 0.614321709f},
-std::array<float,2>{0.669675171f, 0.0159016941f},
-std::array<float,2>{0.472922236f, 0.1383297f},
-std::array<float,2>{0.585069954f, 0.667133272f},
-std::array<float,2>{0.121407554f, 0.913661599f},
-std::array<float,2>{0.832345307f, 0.430160701f},
-std::array<float,2>{0.162096739f, 0.00887082703f},
-std::array<float,2>{0.994247258f, 0.596978366f},
-std::array<float,2>{0.31421119f, 0.762905061f},
-std::array<float,2>{0.636535585f, 0.28338486f},
-std::array<float,2>{0.453102887f, 0.415170044f},
-std::array<float,2>{0.596365988f, 0.92199111f},
-std::array<float,2>{0.0873752609f, 0.671934664f},
-std::array<float,2>{0.850248337f, 0.146534622f},
-std::array<float,2>{0.0515524819f, 0.369420409f},
-std::array<float,2>{0.778820872f, 0.844914675f},
-std::array<float,2>{0.392411917f, 0.530052066f},
-std::array<float,2>{0.511609793f, 0.106802016f},
-std::array<float,2>{0.252797127f, 0.222442597f},
-std::array<float,2>{0.73540622f, 0.716779947f},
-std::array<float,2>{0.221220493f, 0.965749025f},
-std::array<float,2>{0.929170728f, 0.463277996f},
-std::array<float,2>{0.0955283344f, 0.158964783f},
-std::array<float,2>{0.818053961f, 0.65481168f},
-std::array<float,2>{0.492665648f, 0.893572152f},
-std::array<float,2>{0.569800794f, 0.38948068f},
-std::array<float,2>{0.366669685f, 0.272848397f},
-std::array<float,2>{0.681990385f, 0.799221337f},
-std::array<float,2>{0.129569441f, 0.572141588f},
-std::array<float,2>{0.957392812f, 0.0464886911f},
-std::array<float,2>{0.204300672f, 0.471049607f},
-std::array<float,2>{0.889230072f, 0.99147743f},
-std::array<float,2>{0.296149731f, 0.724338233f},
-std::array<float,2>{0.717644036f, 0.211890966f},
-std::array<float,2>{0.411401212f, 0.0663790256f},
-std::array<float,2>{0.555941045f, 0.533204675f},
-std::array<float,2>{0.0085515203f, 0.830974042f},
-std::array<float,2>{0.781299651f, 0.314553231f},
-std::array<float,2>{0.229476184f, 0.135056838f},
-std::array<float,2>{0.930064142f, 0.670738637f},
-std::array<float,2>{0.264583617f, 0.90797025f},
-std::array<float,2>{0.744339049f, 0.43364656f},
-std::array<float,2>{0.404476494f, 0.304732025f},
-std::array<float,2>{0.506110609f, 0.77475822f},
-std::array<float,2>{0.056204401f, 0.609425128f},
-std::array<float,2>{0.765802085f, 0.021190064f},
-std::array<float,2>{0.0837735608f, 0.439655304f},
-std::array<float,2>{0.853751957f, 0.949860215f},
-std::array<float,2>{0.444593191f, 0.688121974f},
-std::array<float,2>{0.604587376f, 0.248753861f},
-std::array<float,2>{0.321305811f, 0.116258815f},
-std::array<float,2>{0.632744312f, 0.514272809f},
-std::array<float,2>{0.167537928f, 0.860274553f},
-std::array<float,2>{0.9861601f, 0.346337736f},
-std::array<float,2>{0.00559602631f, 0.0543756783f},
-std::array<float,2>{0.796446443f, 0.586750448f},
-std::array<float,2>{0.420025408f, 0.784076333f},
-std::array<float,2>{0.551831365f, 0.259346664f},
-std::array<float,2>{0.284803927f, 0.400415212f},
-std::array<float,2>{0.704567254f, 0.880661547f},
-std::array<float,2>{0.211293533f, 0.625500858f},
-std::array<float,2>{0.879506767f, 0.183420748f},
-std::array<float,2>{0.135009468f, 0.339957178f},
-std::array<float,2>{0.965593398f, 0.827298343f},
-std::array<float,2>{0.370544791f, 0.558526814f},
-std::array<float,2>{0.67508626f, 0.0818336755f},
-std::array<float,2>{0.488079876f, 0.192280725f},
-std::array<float,2>{0.578093946f, 0.741815209f},
-std::array<float,2>{0.104873322f, 0.969454229f},
-std::array<float,2>{0.821226299f, 0.494967341f},
-std::array<float,2>{0.172461331f, 0.0668824241f},
-std::array<float,2>{0.97526747f, 0.535709918f},
-std::array<float,2>{0.340281308f, 0.835287571f},
-std::array<float,2>{0.653146029f, 0.318574399f},
-std::array<float,2>{0.464717627f, 0.473979831f},
-std::array<float,2>{0.612998426f, 0.986152828f},
-std::array<float,2>{0.0767080039f, 0.721854091f},
-std::array<float,2>{0.865600407f, 0.217017785f},
-std::array<float,2>{0.0399318784f, 0.268747628f},
-std::array<float,2>{0.76107347f, 0.804267704f},
-std::array<float,2>{0.378279299f, 0.575856626f},
-std::array<float,2>{0.520664334f, 0.0425362773f},
-std::array<float,2>{0.274563372f, 0.160221651f},
-std::array<float,2>{0.728913903f, 0.651557326f},
-std::array<float,2>{0.245073363f, 0.896643102f},
-std::array<float,2>{0.920605659f, 0.385267556f},
-std::array<float,2>{0.111834772f, 0.225758418f},
-std::array<float,2>{0.837272644f, 0.713574231f},
-std::array<float,2>{0.478919566f, 0.963820994f},
-std::array<float,2>{0.592736065f, 0.466803193f},
-std::array<float,2>{0.346875578f, 0.37122491f},
-std::array<float,2>{0.662971258f, 0.849593401f},
-std::array<float,2>{0.143311739f, 0.525567293f},
-std::array<float,2>{0.951898932f, 0.104571849f},
-std::array<float,2>{0.195982501f, 0.420083374f},
-std::array<float,2>{0.902356982f, 0.929397881f},
-std::array<float,2>{0.305790663f, 0.676981568f},
-std::array<float,2>{0.699325025f, 0.143729448f},
-std::array<float,2>{0.434534252f, 0.0152559988f},
-std::array<float,2>{0.534109116f, 0.600871801f},
-std::array<float,2>{0.0286894795f, 0.760056436f},
-std::array<float,2>{0.801069081f, 0.286032051f},
-std::array<float,2>{0.155204713f, 0.205625445f},
-std::array<float,2>{0.942083895f, 0.727805316f},
-std::array<float,2>{0.357571483f, 0.996452272f},
-std::array<float,2>{0.665836096f, 0.483180046f},
-std::array<float,2>{0.470857024f, 0.325223595f},
-std::array<float,2>{0.580214083f, 0.837389469f},
-std::array<float,2>{0.120129772f, 0.541227818f},
-std::array<float,2>{0.831236899f, 0.0733069777f},
-std::array<float,2>{0.0161713436f, 0.376356483f},
-std::array<float,2>{0.812177241f, 0.898549795f},
-std::array<float,2>{0.425809264f, 0.645477235f},
-std::array<float,2>{0.54515487f, 0.164697573f},
-std::array<float,2>{0.303718984f, 0.0380543582f},
-std::array<float,2>{0.693237364f, 0.562867641f},
-std::array<float,2>{0.192947581f, 0.807469964f},
-std::array<float,2>{0.892215252f, 0.280479193f},
-std::array<float,2>{0.0633840859f, 0.0956988558f},
-std::array<float,2>{0.868314028f, 0.517540276f},
-std::array<float,2>{0.458898276f, 0.855432093f},
-std::array<float,2>{0.623852134f, 0.363265365f},
-std::array<float,2>{0.332136989f, 0.453991115f},
-std::array<float,2>{0.641818285f, 0.959936261f},
-std::array<float,2>{0.181073174f, 0.707758248f},
-std::array<float,2>{0.982411385f, 0.229853988f},
-std::array<float,2>{0.237240374f, 0.296482295f},
-std::array<float,2>{0.912535906f, 0.757760108f},
-std::array<float,2>{0.27292037f, 0.607119858f},
-std::array<float,2>{0.725372672f, 0.00450983364f},
-std::array<float,2>{0.383512229f, 0.151170492f},
-std::array<float,2>{0.52521354f, 0.685156405f},
-std::array<float,2>{0.0377936922f, 0.937494576f},
-std::array<float,2>{0.757109463f, 0.41204223f},
-std::array<float,2>{0.209986731f, 0.0262055602f},
-std::array<float,2>{0.88536483f, 0.618755937f},
-std::array<float,2>{0.290826052f, 0.769455552f},
-std::array<float,2>{0.712136924f, 0.297507644f},
-std::array<float,2>{0.407095522f, 0.426054537f},
-std::array<float,2>{0.560438573f, 0.921375811f},
-std::array<float,2>{0.0119905099f, 0.661868453f},
-std::array<float,2>{0.788356543f, 0.127370924f},
-std::array<float,2>{0.100848556f, 0.352683127f},
-std::array<float,2>{0.815700114f, 0.874977708f},
-std::array<float,2>{0.496098518f, 0.502388477f},
-std::array<float,2>{0.563034356f, 0.12361405f},
-std::array<float,2>{0.362437814f, 0.238499507f},
-std::array<float,2>{0.683780491f, 0.701220512f},
-std::array<float,2>{0.128755882f, 0.94405514f},
-std::array<float,2>{0.955496311f, 0.446260363f},
-std::array<float,2>{0.0471488722f, 0.175650746f},
-std::array<float,2>{0.77726084f, 0.635266244f},
-std::array<float,2>{0.397328615f, 0.884845495f},
-std::array<float,2>{0.513203681f, 0.395334929f},
-std::array<float,2>{0.257216513f, 0.257495522f},
-std::array<float,2>{0.740869164f, 0.790865123f},
-std::array<float,2>{0.22362645f, 0.579181552f},
-std::array<float,2>{0.923506439f, 0.0596592724f},
-std::array<float,2>{0.158763036f, 0.491518468f},
-std::array<float,2>{0.998904228f, 0.984236062f},
-std::array<float,2>{0.318542153f, 0.742702782f},
-std::array<float,2>{0.640140772f, 0.200163633f},
-std::array<float,2>{0.446914524f, 0.089054741f},
-std::array<float,2>{0.601510763f, 0.554111004f},
-std::array<float,2>{0.0933265314f, 0.818291605f},
-std::array<float,2>{0.843937516f, 0.33468762f},
-std::array<float,2>{0.168795079f, 0.16985561f},
-std::array<float,2>{0.991906881f, 0.642280817f},
-std::array<float,2>{0.325592101f, 0.90478766f},
-std::array<float,2>{0.625583172f, 0.380566835f},
-std::array<float,2>{0.437710047f, 0.275830209f},
-std::array<float,2>{0.609149396f, 0.811445057f},
-std::array<float,2>{0.0791491941f, 0.567171514f},
-std::array<float,2>{0.857166052f, 0.0343865119f},
-std::array<float,2>{0.0624244772f, 0.479823709f},
-std::array<float,2>{0.772369623f, 0.993062317f},
-std::array<float,2>{0.39873445f, 0.730570793f},
-std::array<float,2>{0.503433466f, 0.210638314f},
-std::array<float,2>{0.260719955f, 0.077215001f},
-std::array<float,2>{0.749602616f, 0.546790183f},
-std::array<float,2>{0.233595103f, 0.840848625f},
-std::array<float,2>{0.93732959f, 0.322909981f},
-std::array<float,2>{0.107718162f, 0.00138434034f},
-std::array<float,2>{0.827979326f, 0.604543388f},
-std::array<float,2>{0.491905332f, 0.75043714f},
-std::array<float,2>{0.572648346f, 0.29285422f},
-std::array<float,2>{0.371339828f, 0.407881618f},
-std::array<float,2>{0.676811635f, 0.932874262f},
-std::array<float,2>{0.137071952f, 0.683393717f},
-std::array<float,2>{0.963163137f, 0.155610889f},
-std::array<float,2>{0.216528147f, 0.364672333f},
-std::array<float,2>{0.8784163f, 0.856495798f},
-std::array<float,2>{0.288515568f, 0.521920681f},
-std::array<float,2>{0.708223403f, 0.0997422934f},
-std::array<float,2>{0.414352119f, 0.23244004f},
-std::array<float,2>{0.546990514f, 0.703283131f},
-std::array<float,2>{0.00340485014f, 0.956324756f},
-std::array<float,2>{0.79155159f, 0.457959622f},
-std::array<float,2>{0.249097079f, 0.120210998f},
-std::array<float,2>{0.914675772f, 0.505946815f},
-std::array<float,2>{0.277793348f, 0.870036602f},
-std::array<float,2>{0.732670844f, 0.358544797f},
-std::array<float,2>{0.380954683f, 0.449415863f},
-std::array<float,2>{0.517800987f, 0.939993262f},
-std::array<float,2>{0.0467650183f, 0.697841823f},
-std::array<float,2>{0.763436139f, 0.236452982f},
-std::array<float,2>{0.0706577972f, 0.302619219f},
-std::array<float,2>{0.861814439f, 0.771336734f},
-std::array<float,2>{0.467052668f, 0.624998808f},
-std::array<float,2>{0.614108443f, 0.0283044409f},
-std::array<float,2>{0.338417649f, 0.130778447f},
-std::array<float,2>{0.64854449f, 0.658944786f},
-std::array<float,2>{0.176412761f, 0.91530627f},
-std::array<float,2>{0.971385121f, 0.42505464f},
-std::array<float,2>{0.0235803779f, 0.197913498f},
-std::array<float,2>{0.799303114f, 0.747344077f},
-std::array<float,2>{0.429797679f, 0.978279531f},
-std::array<float,2>{0.538084328f, 0.485296726f},
-std::array<float,2>{0.308955491f, 0.329483777f},
-std::array<float,2>{0.695717812f, 0.814165413f},
-std::array<float,2>{0.200948149f, 0.548404038f},
-std::array<float,2>{0.902128398f, 0.0915526673f},
-std::array<float,2>{0.147611544f, 0.393485159f},
-std::array<float,2>{0.947674274f, 0.887010336f},
-std::array<float,2>{0.349481374f, 0.638351858f},
-std::array<float,2>{0.65915066f, 0.1774766f},
-std::array<float,2>{0.481606871f, 0.0553508215f},
-std::array<float,2>{0.587423444f, 0.584394574f},
-std::array<float,2>{0.115995988f, 0.794304609f},
-std::array<float,2>{0.841398716f, 0.252592534f},
-std::array<float,2>{0.191172361f, 0.243994802f},
-std::array<float,2>{0.895933986f, 0.692399859f},
-std::array<float,2>{0.299879342f, 0.947128356f},
-std::array<float,2>{0.690455794f, 0.443278432f},
-std::array<float,2>{0.423070222f, 0.350338012f},
-std::array<float,2>{0.540992796f, 0.86567086f},
-std::array<float,2>{0.0218728986f, 0.509688139f},
-std::array<float,2>{0.805940211f, 0.112226583f},
-std::array<float,2>{0.124817625f, 0.433265269f},
-std::array<float,2>{0.835812032f, 0.911106944f},
-std::array<float,2>{0.47594896f, 0.665619314f},
-std::array<float,2>{0.583351493f, 0.140622824f},
-std::array<float,2>{0.351771086f, 0.0188255254f},
-std::array<float,2>{0.670090675f, 0.61631614f},
-std::array<float,2>{0.150669768f, 0.779271781f},
-std::array<float,2>{0.939585328f, 0.310199857f},
-std::array<float,2>{0.0335994139f, 0.0835329443f},
-std::array<float,2>{0.753881872f, 0.55903405f},
-std::array<float,2>{0.390409112f, 0.824002862f},
-std::array<float,2>{0.528995693f, 0.339621693f},
-std::array<float,2>{0.26854071f, 0.499574453f},
-std::array<float,2>{0.721521974f, 0.9751333f},
-std::array<float,2>{0.241168216f, 0.734934092f},
-std::array<float,2>{0.908430934f, 0.187697589f},
-std::array<float,2>{0.187002316f, 0.265328497f},
-std::array<float,2>{0.977608621f, 0.786972225f},
-std::array<float,2>{0.328630507f, 0.590038419f},
-std::array<float,2>{0.645222664f, 0.0495226346f},
-std::array<float,2>{0.45601505f, 0.186737791f},
-std::array<float,2>{0.620119035f, 0.63058883f},
-std::array<float,2>{0.0690930933f, 0.877082288f},
-std::array<float,2>{0.874090314f, 0.403463185f},
-std::array<float,2>{0.131939501f, 0.0440077931f},
-std::array<float,2>{0.959986269f, 0.572849631f},
-std::array<float,2>{0.364927948f, 0.797715664f},
-std::array<float,2>{0.680528164f, 0.269827962f},
-std::array<float,2>{0.494385064f, 0.387366444f},
-std::array<float,2>{0.568057597f, 0.891230226f},
-std::array<float,2>{0.096384868f, 0.653039217f},
-std::array<float,2>{0.819791198f, 0.156284884f},
-std::array<float,2>{0.010634765f, 0.312819064f},
-std::array<float,2>{0.783584595f, 0.829455674f},
-std::array<float,2>{0.413826793f, 0.533185661f},
-std::array<float,2>{0.556651294f, 0.063760832f},
-std::array<float,2>{0.293588102f, 0.214036927f},
-std::array<float,2>{0.716063619f, 0.726026356f},
-std::array<float,2>{0.206713721f, 0.989230812f},
-std::array<float,2>{0.887934625f, 0.469820499f},
-std::array<float,2>{0.0895585194f, 0.144948199f},
-std::array<float,2>{0.848362207f, 0.675052166f},
-std::array<float,2>{0.451020658f, 0.924288034f},
-std::array<float,2>{0.595144391f, 0.416505367f},
-std::array<float,2>{0.315613925f, 0.28232497f},
-std::array<float,2>{0.63395822f, 0.764501512f},
-std::array<float,2>{0.163627833f, 0.59429884f},
-std::array<float,2>{0.992819011f, 0.0106797069f},
-std::array<float,2>{0.219920501f, 0.461975873f},
-std::array<float,2>{0.92586422f, 0.968470812f},
-std::array<float,2>{0.250507474f, 0.717391729f},
-std::array<float,2>{0.737707734f, 0.219531462f},
-std::array<float,2>{0.39263463f, 0.107545041f},
-std::array<float,2>{0.509616017f, 0.527689517f},
-std::array<float,2>{0.0530473441f, 0.846316457f},
-std::array<float,2>{0.780685961f, 0.367698252f},
-std::array<float,2>{0.197339535f, 0.142775118f},
-std::array<float,2>{0.905575156f, 0.675847769f},
-std::array<float,2>{0.306903094f, 0.928673923f},
-std::array<float,2>{0.702336371f, 0.421421409f},
-std::array<float,2>{0.436685205f, 0.286616117f},
-std::array<float,2>{0.532449663f, 0.761336744f},
-std::array<float,2>{0.0300486423f, 0.599818349f},
-std::array<float,2>{0.80331111f, 0.0142084528f},
-std::array<float,2>{0.110110015f, 0.467796952f},
-std::array<float,2>{0.839805722f, 0.964592695f},
-std::array<float,2>{0.478293806f, 0.714694083f},
-std::array<float,2>{0.590996206f, 0.22515665f},
-std::array<float,2>{0.344754577f, 0.104287736f},
-std::array<float,2>{0.661966503f, 0.527074814f},
-std::array<float,2>{0.141555741f, 0.848365188f},
-std::array<float,2>{0.949434102f, 0.372072607f},
-std::array<float,2>{0.0425218418f, 0.0419255346f},
-std::array<float,2>{0.758662105f, 0.57496506f},
-std::array<float,2>{0.376368105f, 0.802825272f},
-std::array<float,2>{0.522468746f, 0.268472761f},
-std::array<float,2>{0.275866002f, 0.386183858f},
-std::array<float,2>{0.727543175f, 0.897964656f},
-std::array<float,2>{0.242772117f, 0.650601804f},
-std::array<float,2>{0.919285119f, 0.16164875f},
-std::array<float,2>{0.175106362f, 0.320231855f},
-std::array<float,2>{0.973124623f, 0.834189415f},
-std::array<float,2>{0.342182219f, 0.536231041f},
-std::array<float,2>{0.655201793f, 0.068205297f},
-std::array<float,2>{0.461929709f, 0.218115777f},
-std::array<float,2>{0.611311078f, 0.720971882f},
-std::array<float,2>{0.0747842267f, 0.984658718f},
-std::array<float,2>{0.863363445f, 0.473504692f},
-std::array<float,2>{0.134024844f, 0.0806343332f},
-std::array<float,2>{0.968642771f, 0.557003558f},
-std::array<float,2>{0.368041247f, 0.826473892f},
-std::array<float,2>{0.672758996f, 0.341329247f},
-std::array<float,2>{0.485559285f, 0.49550584f},
-std::array<float,2>{0.575631618f, 0.970319092f},
-std::array<float,2>{0.103413321f, 0.740292728f},
-std::array<float,2>{0.824130416f, 0.192633748f},
-std::array<float,2>{0.00691034133f, 0.258683771f},
-std::array<float,2>{0.794264019f, 0.784333229f},
-std::array<float,2>{0.418602854f, 0.587393284f},
-std::array<float,2>{0.552926064f, 0.0535052307f},
-std::array<float,2>{0.283143222f, 0.182044491f},
-std::array<float,2>{0.706079125f, 0.626280844f},
-std::array<float,2>{0.213915646f, 0.879186869f},
-std::array<float,2>{0.882311761f, 0.401570946f},
-std::array<float,2>{0.0845899284f, 0.249106333f},
-std::array<float,2>{0.853395045f, 0.68899411f},
-std::array<float,2>{0.441816598f, 0.950594962f},
-std::array<float,2>{0.602463543f, 0.440983564f},
-std::array<float,2>{0.322800487f, 0.34698236f},
-std::array<float,2>{0.629295707f, 0.860560298f},
-std::array<float,2>{0.165129781f, 0.514781117f},
-std::array<float,2>{0.986459792f, 0.115493491f},
-std::array<float,2>{0.228241354f, 0.434666663f},
-std::array<float,2>{0.933058262f, 0.90701431f},
-std::array<float,2>{0.262429208f, 0.671634674f},
-std::array<float,2>{0.743836999f, 0.13649568f},
-std::array<float,2>{0.402926594f, 0.0202143416f},
-std::array<float,2>{0.505305469f, 0.611084223f},
-std::array<float,2>{0.056940984f, 0.773774862f},
-std::array<float,2>{0.767579257f, 0.306059361f},
-std::array<float,2>{0.156821802f, 0.200573847f},
-std::array<float,2>{0.996320248f, 0.743185103f},
-std::array<float,2>{0.317470938f, 0.983223498f},
-std::array<float,2>{0.638073623f, 0.490824908f},
-std::array<float,2>{0.44816643f, 0.335761815f},
-std::array<float,2>{0.599106848f, 0.816738546f},
-std::array<float,2>{0.0910019353f, 0.55299902f},
-std::array<float,2>{0.847609758f, 0.0880980939f},
-std::array<float,2>{0.0506262146f, 0.396167189f},
-std::array<float,2>{0.774613917f, 0.886259556f},
-std::array<float,2>{0.395619839f, 0.636491358f},
-std::array<float,2>{0.51368314f, 0.174084365f},
-std::array<float,2>{0.254444301f, 0.0593668148f},
-std::array<float,2>{0.738512635f, 0.578684926f},
-std::array<float,2>{0.225056857f, 0.789306283f},
-std::array<float,2>{0.924912214f, 0.256515384f},
-std::array<float,2>{0.0985215828f, 0.124501087f},
-std::array<float,2>{0.813524365f, 0.502955854f},
-std::array<float,2>{0.498436153f, 0.873822749f},
-std::array<float,2>{0.564528525f, 0.352244735f},
-std::array<float,2>{0.360395461f, 0.446860552f},
-std::array<float,2>{0.685746789f, 0.944737792f},
-std::array<float,2>{0.125310034f, 0.703086376f},
-std::array<float,2>{0.954878569f, 0.239612728f},
-std::array<float,2>{0.207588315f, 0.298001587f},
-std::array<float,2>{0.884490728f, 0.767598867f},
-std::array<float,2>{0.29244557f, 0.617231786f},
-std::array<float,2>{0.713322282f, 0.0270245001f},
-std::array<float,2>{0.409795165f, 0.128863871f},
-std::array<float,2>{0.560721397f, 0.660434246f},
-std::array<float,2>{0.0152066303f, 0.920742691f},
-std::array<float,2>{0.785158694f, 0.426840037f},
-std::array<float,2>{0.235893577f, 0.00500055216f},
-std::array<float,2>{0.910327315f, 0.605478406f},
-std::array<float,2>{0.270618618f, 0.756258905f},
-std::array<float,2>{0.723220348f, 0.294971496f},
-std::array<float,2>{0.384895891f, 0.410707563f},
-std::array<float,2>{0.525985777f, 0.935970783f},
-std::array<float,2>{0.0365793519f, 0.684117377f},
-std::array<float,2>{0.75447309f, 0.152189955f},
-std::array<float,2>{0.0656704009f, 0.362222344f},
-std::array<float,2>{0.870936453f, 0.853927135f},
-std::array<float,2>{0.460136443f, 0.516217351f},
-std::array<float,2>{0.622249603f, 0.0942133442f},
-std::array<float,2>{0.334381104f, 0.228835836f},
-std::array<float,2>{0.643651247f, 0.708354354f},
-std::array<float,2>{0.182067528f, 0.960301638f},
-std::array<float,2>{0.982723773f, 0.454304069f},
-std::array<float,2>{0.0192595571f, 0.165216997f},
-std::array<float,2>{0.809895098f, 0.64643693f},
-std::array<float,2>{0.428354144f, 0.900219202f},
-std::array<float,2>{0.544728994f, 0.375347614f},
-std::array<float,2>{0.301613569f, 0.27965498f},
-std::array<float,2>{0.694171607f, 0.807947814f},
-std::array<float,2>{0.193663731f, 0.56390518f},
-std::array<float,2>{0.893625259f, 0.0384748913f},
-std::array<float,2>{0.152842551f, 0.48394227f},
-std::array<float,2>{0.944442332f, 0.99717927f},
-std::array<float,2>{0.355968118f, 0.726836264f},
-std::array<float,2>{0.667932928f, 0.206426606f},
-std::array<float,2>{0.469329327f, 0.0722741857f},
-std::array<float,2>{0.578186631f, 0.542819858f},
-std::array<float,2>{0.118823774f, 0.836392164f},
-std::array<float,2>{0.829959333f, 0.324401498f},
-std::array<float,2>{0.144794002f, 0.176049829f},
-std::array<float,2>{0.946185708f, 0.637260377f},
-std::array<float,2>{0.34985587f, 0.887755632f},
-std::array<float,2>{0.657127619f, 0.394321501f},
-std::array<float,2>{0.483002812f, 0.25345993f},
-std::array<float,2>{0.589444101f, 0.793415606f},
-std::array<float,2>{0.113728806f, 0.585727572f},
-std::array<float,2>{0.841884613f, 0.0562963001f},
-std::array<float,2>{0.0262202378f, 0.486224532f},
-std::array<float,2>{0.797995865f, 0.97727716f},
-std::array<float,2>{0.431831926f, 0.746608377f},
-std::array<float,2>{0.536137462f, 0.198939607f},
-std::array<float,2>{0.312421113f, 0.0899769962f},
-std::array<float,2>{0.697508276f, 0.547307134f},
-std::array<float,2>{0.202573016f, 0.813052237f},
-std::array<float,2>{0.899070501f, 0.328387946f},
-std::array<float,2>{0.0740021542f, 0.028369125f},
-std::array<float,2>{0.860413134f, 0.623246133f},
-std::array<float,2>{0.465395093f, 0.770116985f},
-std::array<float,2>{0.615348458f, 0.301628143f},
-std::array<float,2>{0.336707741f, 0.424657077f},
-std::array<float,2>{0.651997805f, 0.914921463f},
-std::array<float,2>{0.178409889f, 0.659188688f},
-std::array<float,2>{0.969793797f, 0.1293668f},
-std::array<float,2>{0.247754127f, 0.358013541f},
-std::array<float,2>{0.916137993f, 0.870284915f},
-std::array<float,2>{0.280386895f, 0.507272303f},
-std::array<float,2>{0.731759608f, 0.119950302f},
-std::array<float,2>{0.379063606f, 0.237720728f},
-std::array<float,2>{0.515892982f, 0.698388755f},
-std::array<float,2>{0.043068815f, 0.940564752f},
-std::array<float,2>{0.765528023f, 0.450538427f},
-std::array<float,2>{0.218268394f, 0.100861564f},
-std::array<float,2>{0.875055015f, 0.523367167f},
-std::array<float,2>{0.286604732f, 0.855615258f},
-std::array<float,2>{0.710483253f, 0.364212841f},
-std::array<float,2>{0.416894585f, 0.458744109f},
-std::array<float,2>{0.549110532f, 0.955243468f},
-std::array<float,2>{0.000303116336f, 0.704104722f},
-std::array<float,2>{0.790037215f, 0.233784139f},
-std::array<float,2>{0.106862202f, 0.291858494f},
-std::array<float,2>{0.825627506f, 0.751046836f},
-std::array<float,2>{0.489482373f, 0.604160488f},
-std::array<float,2>{0.571296871f, 0.000783155789f},
-std::array<float,2>{0.373344392f, 0.154631525f},
-std::array<float,2>{0.679063559f, 0.681898952f},
-std::array<float,2>{0.139627904f, 0.931862891f},
-std::array<float,2>{0.962507248f, 0.406275094f},
-std::array<float,2>{0.0603621751f, 0.20971261f},
-std::array<float,2>{0.770531893f, 0.731576502f},
-std::array<float,2>{0.401221097f, 0.993336678f},
-std::array<float,2>{0.500170708f, 0.478577256f},
-std::array<float,2>{0.259057283f, 0.323269695f},
-std::array<float,2>{0.747493148f, 0.840402603f},
-std::array<float,2>{0.232059494f, 0.545385361f},
-std::array<float,2>{0.935073972f, 0.0767658055f},
-std::array<float,2>{0.170456991f, 0.379452199f},
-std::array<float,2>{0.989307463f, 0.905960143f},
-std::array<float,2>{0.327129573f, 0.641549826f},
-std::array<float,2>{0.628700912f, 0.168547258f},
-std::array<float,2>{0.440676242f, 0.0341348387f},
-std::array<float,2>{0.606391609f, 0.567907035f},
-std::array<float,2>{0.0812621638f, 0.811653137f},
-std::array<float,2>{0.85859859f, 0.276964933f},
-std::array<float,2>{0.222010061f, 0.22053495f},
-std::array<float,2>{0.928103387f, 0.718019068f},
-std::array<float,2>{0.253423125f, 0.966938496f},
-std::array<float,2>{0.735150695f, 0.461854577f},
-std::array<float,2>{0.390862674f, 0.368480325f},
-std::array<float,2>{0.510338187f, 0.847561777f},
-std::array<float,2>{0.0522639453f, 0.529262662f},
-std::array<float,2>{0.777745545f, 0.108975075f},
-std::array<float,2>{0.0860153586f, 0.417206675f},
-std::array<float,2>{0.851092637f, 0.925629377f},
-std::array<float,2>{0.451431453f, 0.674596608f},
-std::array<float,2>{0.596998751f, 0.145844057f},
-std::array<float,2>{0.312607467f, 0.0109156277f},
-std::array<float,2>{0.634900331f, 0.595115304f},
-std::array<float,2>{0.160915971f, 0.764776945f},
-std::array<float,2>{0.995137155f, 0.281522602f},
-std::array<float,2>{0.00889519975f, 0.062832348f},
-std::array<float,2>{0.782440245f, 0.531774998f},
-std::array<float,2>{0.411117852f, 0.828445911f},
-std::array<float,2>{0.555067778f, 0.313864976f},
-std::array<float,2>{0.295798719f, 0.469363362f},
-std::array<float,2>{0.718699217f, 0.990152836f},
-std::array<float,2>{0.203552976f, 0.725496054f},
-std::array<float,2>{0.890384197f, 0.213088095f},
-std::array<float,2>{0.130061269f, 0.271098435f},
-std::array<float,2>{0.958091795f, 0.798760295f},
-std::array<float,2>{0.365789264f, 0.574055135f},
-std::array<float,2>{0.683431983f, 0.0435313135f},
-std::array<float,2>{0.493294597f, 0.158168539f},
-std::array<float,2>{0.568457186f, 0.653840542f},
-std::array<float,2>{0.0941685215f, 0.892491341f},
-std::array<float,2>{0.816416144f, 0.388543814f},
-std::array<float,2>{0.183729798f, 0.0502906851f},
-std::array<float,2>{0.979158819f, 0.591159701f},
-std::array<float,2>{0.331331015f, 0.785464823f},
-std::array<float,2>{0.646929801f, 0.264101893f},
-std::array<float,2>{0.453184485f, 0.402463496f},
-std::array<float,2>{0.617496431f, 0.878818154f},
-std::array<float,2>{0.0669844598f, 0.629642963f},
-std::array<float,2>{0.87237674f, 0.185697466f},
-std::array<float,2>{0.0324441046f, 0.338103265f},
-std::array<float,2>{0.751732171f, 0.823193967f},
-std::array<float,2>{0.387312353f, 0.560308158f},
-std::array<float,2>{0.530232489f, 0.0821854472f},
-std::array<float,2>{0.266305983f, 0.189073324f},
-std::array<float,2>{0.720401883f, 0.735741258f},
-std::array<float,2>{0.239738896f, 0.975739419f},
-std::array<float,2>{0.907313406f, 0.498060197f},
-std::array<float,2>{0.122344732f, 0.138850391f},
-std::array<float,2>{0.833009958f, 0.664352715f},
-std::array<float,2>{0.474087656f, 0.911844015f},
-std::array<float,2>{0.584697783f, 0.431857049f},
-std::array<float,2>{0.35468787f, 0.30872348f},
-std::array<float,2>{0.66859138f, 0.777621508f},
-std::array<float,2>{0.148853227f, 0.615408838f},
-std::array<float,2>{0.93932575f, 0.0182036366f},
-std::array<float,2>{0.188697487f, 0.442108035f},
-std::array<float,2>{0.897706866f, 0.945809662f},
-std::array<float,2>{0.297418118f, 0.691639185f},
-std::array<float,2>{0.688869536f, 0.242844239f},
-std::array<float,2>{0.424842209f, 0.113014698f},
-std::array<float,2>{0.542508721f, 0.508447349f},
-std::array<float,2>{0.0197581369f, 0.866789997f},
-std::array<float,2>{0.806711555f, 0.351184368f},
-std::array<float,2>{0.2451583f, 0.163303405f},
-std::array<float,2>{0.921756029f, 0.650035858f},
-std::array<float,2>{0.273998588f, 0.895936549f},
-std::array<float,2>{0.72980696f, 0.38345474f},
-std::array<float,2>{0.377600789f, 0.26684466f},
-std::array<float,2>{0.520051539f, 0.801919162f},
-std::array<float,2>{0.0403931811f, 0.576682687f},
-std::array<float,2>{0.76023972f, 0.0391794555f},
-std::array<float,2>{0.0775501505f, 0.476166278f},
-std::array<float,2>{0.866828978f, 0.986470997f},
-std::array<float,2>{0.463738352f, 0.719087183f},
-std::array<float,2>{0.611884534f, 0.216078103f},
-std::array<float,2>{0.341134042f, 0.0685884953f},
-std::array<float,2>{0.653953433f, 0.537905097f},
-std::array<float,2>{0.173579559f, 0.832265377f},
-std::array<float,2>{0.975711107f, 0.316603243f},
-std::array<float,2>{0.0275734123f, 0.0129324207f},
-std::array<float,2>{0.801828861f, 0.59773463f},
-std::array<float,2>{0.435247838f, 0.759557188f},
-std::array<float,2>{0.534847617f, 0.287711322f},
-std::array<float,2>{0.305380553f, 0.419142812f},
-std::array<float,2>{0.701070666f, 0.925983131f},
-std::array<float,2>{0.196642235f, 0.677915573f},
-std::array<float,2>{0.904040873f, 0.141754419f},
-std::array<float,2>{0.144239664f, 0.374476999f},
-std::array<float,2>{0.952246308f, 0.849968076f},
-std::array<float,2>{0.346577615f, 0.525212348f},
-std::array<float,2>{0.663153172f, 0.102528609f},
-std::array<float,2>{0.480338007f, 0.223276392f},
-std::array<float,2>{0.593632042f, 0.712815285f},
-std::array<float,2>{0.112516284f, 0.96103096f},
-std::array<float,2>{0.836812735f, 0.466527909f},
-std::array<float,2>{0.166836068f, 0.11405164f},
-std::array<float,2>{0.984619617f, 0.513497293f},
-std::array<float,2>{0.320516914f, 0.862762809f},
-std::array<float,2>{0.631168306f, 0.344256669f},
-std::array<float,2>{0.443664253f, 0.43801567f},
-std::array<float,2>{0.603699088f, 0.951755941f},
-std::array<float,2>{0.0829194337f, 0.690673649f},
-std::array<float,2>{0.855080843f, 0.247335121f},
-std::array<float,2>{0.0548145771f, 0.307565391f},
-std::array<float,2>{0.767572343f, 0.776210189f},
-std::array<float,2>{0.405704767f, 0.612270534f},
-std::array<float,2>{0.507556796f, 0.0230127312f},
-std::array<float,2>{0.265308022f, 0.133078337f},
-std::array<float,2>{0.745552421f, 0.669316053f},
-std::array<float,2>{0.229699269f, 0.908441722f},
-std::array<float,2>{0.931269407f, 0.436041802f},
-std::array<float,2>{0.104061775f, 0.19423157f},
-std::array<float,2>{0.821296751f, 0.738852561f},
-std::array<float,2>{0.487116754f, 0.970756769f},
-std::array<float,2>{0.57697773f, 0.493621051f},
-std::array<float,2>{0.369287133f, 0.342650324f},
-std::array<float,2>{0.674042881f, 0.825639725f},
-std::array<float,2>{0.136340111f, 0.554750025f},
-std::array<float,2>{0.966541052f, 0.079082422f},
-std::array<float,2>{0.212664828f, 0.400317699f},
-std::array<float,2>{0.880010247f, 0.882511616f},
-std::array<float,2>{0.283632308f, 0.628167987f},
-std::array<float,2>{0.703666687f, 0.181607172f},
-std::array<float,2>{0.421550304f, 0.0520710722f},
-std::array<float,2>{0.551629364f, 0.589149117f},
-std::array<float,2>{0.0039877966f, 0.782435298f},
-std::array<float,2>{0.795605302f, 0.261127591f},
-std::array<float,2>{0.12730749f, 0.240583241f},
-std::array<float,2>{0.956124544f, 0.699366629f},
-std::array<float,2>{0.362137169f, 0.941626966f},
-std::array<float,2>{0.685393691f, 0.448861212f},
-std::array<float,2>{0.497289389f, 0.354706675f},
-std::array<float,2>{0.563717723f, 0.873045206f},
-std::array<float,2>{0.0998462215f, 0.501125753f},
-std::array<float,2>{0.8149001f, 0.121894725f},
-std::array<float,2>{0.0133776749f, 0.428966463f},
-std::array<float,2>{0.787323773f, 0.918695927f},
-std::array<float,2>{0.407338798f, 0.663831711f},
-std::array<float,2>{0.558756828f, 0.126616687f},
-std::array<float,2>{0.289342463f, 0.0236493424f},
-std::array<float,2>{0.711672962f, 0.61998111f},
-std::array<float,2>{0.20903796f, 0.766045213f},
-std::array<float,2>{0.885904789f, 0.299069911f},
-std::array<float,2>{0.0923120528f, 0.0861694589f},
-std::array<float,2>{0.845269263f, 0.550873756f},
-std::array<float,2>{0.445622832f, 0.818974912f},
-std::array<float,2>{0.600574315f, 0.333687335f},
-std::array<float,2>{0.320258081f, 0.48856464f},
-std::array<float,2>{0.638912201f, 0.981520355f},
-std::array<float,2>{0.160088807f, 0.744707406f},
-std::array<float,2>{0.999927998f, 0.201313123f},
-std::array<float,2>{0.223771855f, 0.255204886f},
-std::array<float,2>{0.922757924f, 0.791180551f},
-std::array<float,2>{0.25591442f, 0.581442595f},
-std::array<float,2>{0.741264284f, 0.0607463792f},
-std::array<float,2>{0.397862583f, 0.172114506f},
-std::array<float,2>{0.512085676f, 0.63400811f},
-std::array<float,2>{0.0478785932f, 0.884379625f},
-std::array<float,2>{0.775681317f, 0.398106128f},
-std::array<float,2>{0.191996217f, 0.0356969461f},
-std::array<float,2>{0.891117156f, 0.564818084f},
-std::array<float,2>{0.303408951f, 0.806635141f},
-std::array<float,2>{0.691885591f, 0.277927816f},
-std::array<float,2>{0.427323341f, 0.377704412f},
-std::array<float,2>{0.546350718f, 0.901592374f},
-std::array<float,2>{0.0173717905f, 0.646941185f},
-std::array<float,2>{0.81151247f, 0.167417541f},
-std::array<float,2>{0.119339742f, 0.327410221f},
-std::array<float,2>{0.830081105f, 0.839667261f},
-std::array<float,2>{0.4719522f, 0.539090812f},
-std::array<float,2>{0.581903517f, 0.0722237304f},
-std::array<float,2>{0.359334767f, 0.203654215f},
-std::array<float,2>{0.664433777f, 0.728603184f},
-std::array<float,2>{0.156035885f, 0.999818206f},
-std::array<float,2>{0.943211973f, 0.482268304f},
-std::array<float,2>{0.0385122076f, 0.150264367f},
-std::array<float,2>{0.756589353f, 0.68735671f},
-std::array<float,2>{0.383861959f, 0.934935689f},
-std::array<float,2>{0.523703218f, 0.413454622f},
-std::array<float,2>{0.272274047f, 0.293180794f},
-std::array<float,2>{0.72590065f, 0.755733013f},
-std::array<float,2>{0.238027006f, 0.608899891f},
-std::array<float,2>{0.913395047f, 0.00673837541f},
-std::array<float,2>{0.180404454f, 0.456857115f},
-std::array<float,2>{0.980726779f, 0.958012819f},
-std::array<float,2>{0.333084494f, 0.710109234f},
-std::array<float,2>{0.641065717f, 0.227364406f},
-std::array<float,2>{0.457461596f, 0.0959735662f},
-std::array<float,2>{0.624305129f, 0.517810225f},
-std::array<float,2>{0.0634856299f, 0.852861881f},
-std::array<float,2>{0.868093431f, 0.360439241f},
-std::array<float,2>{0.177420571f, 0.132570565f},
-std::array<float,2>{0.971966326f, 0.657322347f},
-std::array<float,2>{0.339105248f, 0.917280257f},
-std::array<float,2>{0.650244534f, 0.423426181f},
-std::array<float,2>{0.467886776f, 0.302947581f},
-std::array<float,2>{0.614465594f, 0.771505594f},
-std::array<float,2>{0.071718663f, 0.621560752f},
-std::array<float,2>{0.862746835f, 0.0312296692f},
-std::array<float,2>{0.0453807004f, 0.451551616f},
-std::array<float,2>{0.762483597f, 0.938318551f},
-std::array<float,2>{0.382410526f, 0.696804285f},
-std::array<float,2>{0.519341052f, 0.235008523f},
-std::array<float,2>{0.278508723f, 0.117999166f},
-std::array<float,2>{0.733749747f, 0.50431174f},
-std::array<float,2>{0.248571023f, 0.86847651f},
-std::array<float,2>{0.915064812f, 0.357123226f},
-std::array<float,2>{0.116955698f, 0.0567421652f},
-std::array<float,2>{0.840329945f, 0.582657576f},
-std::array<float,2>{0.481377184f, 0.795520544f},
-std::array<float,2>{0.58602792f, 0.25112924f},
-std::array<float,2>{0.348391205f, 0.392280906f},
-std::array<float,2>{0.659687102f, 0.889813066f},
-std::array<float,2>{0.146760553f, 0.639297307f},
-std::array<float,2>{0.948601365f, 0.179527313f},
-std::array<float,2>{0.199948549f, 0.331298709f},
-std::array<float,2>{0.900620878f, 0.815333545f},
-std::array<float,2>{0.310133994f, 0.549265742f},
-std::array<float,2>{0.696684241f, 0.0936189145f},
-std::array<float,2>{0.431079566f, 0.197170407f},
-std::array<float,2>{0.538899839f, 0.749108613f},
-std::array<float,2>{0.0250387434f, 0.979287446f},
-std::array<float,2>{0.800655425f, 0.487831086f},
-std::array<float,2>{0.232988566f, 0.0756361187f},
-std::array<float,2>{0.935720325f, 0.543232679f},
-std::array<float,2>{0.260893017f, 0.843312144f},
-std::array<float,2>{0.748180807f, 0.320403397f},
-std::array<float,2>{0.400327474f, 0.477342486f},
-std::array<float,2>{0.502713203f, 0.995807707f},
-std::array<float,2>{0.0612031259f, 0.732440531f},
-std::array<float,2>{0.773284972f, 0.207398683f},
-std::array<float,2>{0.0786166191f, 0.273858309f},
-std::array<float,2>{0.856213927f, 0.809387982f},
-std::array<float,2>{0.43888858f, 0.570093513f},
-std::array<float,2>{0.607487857f, 0.0331342071f},
-std::array<float,2>{0.324240416f, 0.170491204f},
-std::array<float,2>{0.626334667f, 0.643642724f},
-std::array<float,2>{0.169865966f, 0.904237926f},
-std::array<float,2>{0.990707397f, 0.381170273f},
-std::array<float,2>{0.00229315087f, 0.231236845f},
-std::array<float,2>{0.792833626f, 0.705205679f},
-std::array<float,2>{0.415962607f, 0.954825521f},
-std::array<float,2>{0.547965944f, 0.459682971f},
-std::array<float,2>{0.287729412f, 0.365492791f},
-std::array<float,2>{0.707499862f, 0.858252704f},
-std::array<float,2>{0.215656564f, 0.521414518f},
-std::array<float,2>{0.877073169f, 0.0988198146f},
-std::array<float,2>{0.138339877f, 0.409316927f},
-std::array<float,2>{0.964088082f, 0.931225061f},
-std::array<float,2>{0.372179329f, 0.680183947f},
-std::array<float,2>{0.675841451f, 0.153258264f},
-std::array<float,2>{0.490517229f, 0.00363210868f},
-std::array<float,2>{0.574208856f, 0.602846086f},
-std::array<float,2>{0.108553842f, 0.752242684f},
-std::array<float,2>{0.827085316f, 0.290098697f},
-std::array<float,2>{0.205230772f, 0.21211116f},
-std::array<float,2>{0.886983037f, 0.723472655f},
-std::array<float,2>{0.294888049f, 0.990564108f},
-std::array<float,2>{0.71524775f, 0.472298831f},
-std::array<float,2>{0.412796587f, 0.31638065f},
-std::array<float,2>{0.558402479f, 0.831861973f},
-std::array<float,2>{0.0113134533f, 0.53511256f},
-std::array<float,2>{0.78514123f, 0.0649408996f},
-std::array<float,2>{0.0975693688f, 0.389715701f},
-std::array<float,2>{0.81933403f, 0.892941475f},
-std::array<float,2>{0.495117575f, 0.65558219f},
-std::array<float,2>{0.567267239f, 0.159400657f},
-std::array<float,2>{0.364173084f, 0.0451658964f},
-std::array<float,2>{0.680737734f, 0.570664346f},
-std::array<float,2>{0.131303221f, 0.800420702f},
-std::array<float,2>{0.959919512f, 0.272144467f},
-std::array<float,2>{0.0544368811f, 0.105922669f},
-std::array<float,2>{0.779417753f, 0.530300438f},
-std::array<float,2>{0.393943012f, 0.844065189f},
-std::array<float,2>{0.508458555f, 0.370600939f},
-std::array<float,2>{0.251738936f, 0.464320838f},
-std::array<float,2>{0.737051129f, 0.966481924f},
-std::array<float,2>{0.219022274f, 0.715725601f},
-std::array<float,2>{0.926844418f, 0.221043587f},
-std::array<float,2>{0.162732914f, 0.284854352f},
-std::array<float,2>{0.99388659f, 0.7622329f},
-std::array<float,2>{0.315330178f, 0.596208096f},
-std::array<float,2>{0.63321358f, 0.00869771559f},
-std::array<float,2>{0.449632049f, 0.147867873f},
-std::array<float,2>{0.593952477f, 0.673057556f},
-std::array<float,2>{0.0879837871f, 0.922867894f},
-std::array<float,2>{0.84901917f, 0.414591134f},
-std::array<float,2>{0.151860371f, 0.0173911266f},
-std::array<float,2>{0.941399276f, 0.614142776f},
-std::array<float,2>{0.352800101f, 0.779704213f},
-std::array<float,2>{0.671842575f, 0.312003016f},
-std::array<float,2>{0.475012749f, 0.43127358f},
-std::array<float,2>{0.582698166f, 0.912555158f},
-std::array<float,2>{0.123924077f, 0.666560352f},
-std::array<float,2>{0.83432436f, 0.137467936f},
-std::array<float,2>{0.0227346942f, 0.348163307f},
-std::array<float,2>{0.805604458f, 0.864810169f},
-std::array<float,2>{0.422051042f, 0.510487139f},
-std::array<float,2>{0.539576828f, 0.109540209f},
-std::array<float,2>{0.299648255f, 0.245005623f},
-std::array<float,2>{0.689774334f, 0.695114613f},
-std::array<float,2>{0.189801216f, 0.949069083f},
-std::array<float,2>{0.895198107f, 0.443495601f},
-std::array<float,2>{0.0701622441f, 0.18362689f},
-std::array<float,2>{0.873654783f, 0.631631136f},
-std::array<float,2>{0.456382275f, 0.875368416f},
-std::array<float,2>{0.619284332f, 0.40448609f},
-std::array<float,2>{0.329748452f, 0.263577819f},
-std::array<float,2>{0.646483541f, 0.78789711f},
-std::array<float,2>{0.18615289f, 0.591905594f},
-std::array<float,2>{0.976921022f, 0.047295548f},
-std::array<float,2>{0.241948321f, 0.497840881f},
-std::array<float,2>{0.909248352f, 0.974439621f},
-std::array<float,2>{0.269438684f, 0.737656593f},
-std::array<float,2>{0.722214162f, 0.19059214f},
-std::array<float,2>{0.388801455f, 0.0846336782f},
-std::array<float,2>{0.527365327f, 0.561729908f},
-std::array<float,2>{0.0349524692f, 0.822044075f},
-std::array<float,2>{0.752290845f, 0.337356508f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.55604285f, 0.242641956f},
-std::array<float,2>{0.165125996f, 0.836182415f},
-std::array<float,2>{0.293369204f, 0.399714679f},
-std::array<float,2>{0.996706605f, 0.626068294f},
-std::array<float,2>{0.816658497f, 0.310584545f},
-std::array<float,2>{0.462299585f, 0.523780763f},
-std::array<float,2>{0.0581607707f, 0.0934942216f},
-std::array<float,2>{0.652016938f, 0.989990234f},
-std::array<float,2>{0.725969613f, 0.480382115f},
-std::array<float,2>{0.0717050508f, 0.738619864f},
-std::array<float,2>{0.409947693f, 0.148495957f},
-std::array<float,2>{0.770554781f, 0.801095188f},
-std::array<float,2>{0.936528385f, 0.0569509417f},
-std::array<float,2>{0.363135725f, 0.875056207f},
-std::array<float,2>{0.213951454f, 0.346865177f},
-std::array<float,2>{0.565400422f, 0.595193207f},
-std::array<float,2>{0.676556885f, 0.116690561f},
-std::array<float,2>{0.0143141728f, 0.961520255f},
-std::array<float,2>{0.490714461f, 0.265733272f},
-std::array<float,2>{0.857616484f, 0.550998867f},
-std::array<float,2>{0.957491577f, 0.422481567f},
-std::array<float,2>{0.268732905f, 0.674798667f},
-std::array<float,2>{0.148050681f, 0.195075706f},
-std::array<float,2>{0.502963722f, 0.844030321f},
-std::array<float,2>{0.623207271f, 0.330683649f},
-std::array<float,2>{0.239518121f, 0.580093503f},
-std::array<float,2>{0.330638856f, 0.00639905035f},
-std::array<float,2>{0.883530796f, 0.91201067f},
-std::array<float,2>{0.80460453f, 0.183023825f},
-std::array<float,2>{0.375436991f, 0.769016266f},
-std::array<float,2>{0.11481265f, 0.454052389f},
-std::array<float,2>{0.690305769f, 0.692479074f},
-std::array<float,2>{0.704820454f, 0.138258517f},
-std::array<float,2>{0.105171412f, 0.789611638f},
-std::array<float,2>{0.399175078f, 0.494323522f},
-std::array<float,2>{0.79200089f, 0.727761209f},
-std::array<float,2>{0.901003122f, 0.365890563f},
-std::array<float,2>{0.323545247f, 0.61981225f},
-std::array<float,2>{0.23203896f, 0.0410774425f},
-std::array<float,2>{0.606180847f, 0.899255037f},
-std::array<float,2>{0.519350946f, 0.380912036f},
-std::array<float,2>{0.135181367f, 0.643251777f},
-std::array<float,2>{0.253067285f, 0.223930612f},
-std::array<float,2>{0.939241588f, 0.819198251f},
-std::array<float,2>{0.864968061f, 0.0780463442f},
-std::array<float,2>{0.47071448f, 0.978378475f},
-std::array<float,2>{0.0293878224f, 0.281761914f},
-std::array<float,2>{0.66483283f, 0.512949646f},
-std::array<float,2>{0.583357573f, 0.0243931562f},
-std::array<float,2>{0.20253545f, 0.932797313f},
-std::array<float,2>{0.35378933f, 0.315522313f},
-std::array<float,2>{0.91525346f, 0.569326699f},
-std::array<float,2>{0.762732565f, 0.44644928f},
-std::array<float,2>{0.426004082f, 0.711763144f},
-std::array<float,2>{0.080996193f, 0.166075796f},
-std::array<float,2>{0.737647295f, 0.764479995f},
-std::array<float,2>{0.63220185f, 0.260047644f},
-std::array<float,2>{0.0366451964f, 0.540104091f},
-std::array<float,2>{0.442662001f, 0.0962647051f},
-std::array<float,2>{0.839478552f, 0.939222217f},
-std::array<float,2>{0.979883432f, 0.217397958f},
-std::array<float,2>{0.300773025f, 0.861837626f},
-std::array<float,2>{0.178790584f, 0.410621107f},
-std::array<float,2>{0.540438414f, 0.65728271f},
-std::array<float,2>{0.601397991f, 0.157581493f},
-std::array<float,2>{0.219702959f, 0.751818717f},
-std::array<float,2>{0.314518332f, 0.445149481f},
-std::array<float,2>{0.894852698f, 0.704328895f},
-std::array<float,2>{0.788176894f, 0.323360324f},
-std::array<float,2>{0.396641523f, 0.577147841f},
-std::array<float,2>{0.0978983268f, 0.0160764921f},
-std::array<float,2>{0.71409899f, 0.923070967f},
-std::array<float,2>{0.657729805f, 0.42059347f},
-std::array<float,2>{0.0197131261f, 0.665507436f},
-std::array<float,2>{0.480611831f, 0.203771234f},
-std::array<float,2>{0.87121743f, 0.869101465f},
-std::array<float,2>{0.947773993f, 0.102451265f},
-std::array<float,2>{0.265585542f, 0.94914633f},
-std::array<float,2>{0.13216643f, 0.253374815f},
-std::array<float,2>{0.52675426f, 0.534815252f},
-std::array<float,2>{0.742215931f, 0.0316238664f},
-std::array<float,2>{0.0914397389f, 0.897464216f},
-std::array<float,2>{0.433606565f, 0.370802581f},
-std::array<float,2>{0.753742456f, 0.616462886f},
-std::array<float,2>{0.911922276f, 0.487319201f},
-std::array<float,2>{0.344212055f, 0.720389545f},
-std::array<float,2>{0.188833356f, 0.131309256f},
-std::array<float,2>{0.58700186f, 0.787071943f},
-std::array<float,2>{0.535997212f, 0.293426871f},
-std::array<float,2>{0.185680196f, 0.507655859f},
-std::array<float,2>{0.308205128f, 0.0674890876f},
-std::array<float,2>{0.974217296f, 0.976361215f},
-std::array<float,2>{0.83259052f, 0.232281327f},
-std::array<float,2>{0.449310005f, 0.823625743f},
-std::array<float,2>{0.0457674153f, 0.388534337f},
-std::array<float,2>{0.635836422f, 0.656036198f},
-std::array<float,2>{0.645328343f, 0.201910108f},
-std::array<float,2>{0.0473996587f, 0.855592489f},
-std::array<float,2>{0.457515806f, 0.434976161f},
-std::array<float,2>{0.823715448f, 0.686257482f},
-std::array<float,2>{0.991680801f, 0.280754775f},
-std::array<float,2>{0.285012454f, 0.559921622f},
-std::array<float,2>{0.162068054f, 0.121044315f},
-std::array<float,2>{0.549278438f, 0.960145056f},
-std::array<float,2>{0.576311648f, 0.467576772f},
-std::array<float,2>{0.208706841f, 0.696365058f},
-std::array<float,2>{0.369568795f, 0.179304868f},
-std::array<float,2>{0.927533984f, 0.777321756f},
-std::array<float,2>{0.778612256f, 0.0122578386f},
-std::array<float,2>{0.414184809f, 0.918306231f},
-std::array<float,2>{0.06925001f, 0.339706659f},
-std::array<float,2>{0.728515863f, 0.592033923f},
-std::array<float,2>{0.515574217f, 0.081073381f},
-std::array<float,2>{0.151388422f, 0.995452762f},
-std::array<float,2>{0.280529439f, 0.299835205f},
-std::array<float,2>{0.963637054f, 0.520325303f},
-std::array<float,2>{0.84388423f, 0.39242813f},
-std::array<float,2>{0.499601185f, 0.636572957f},
-std::array<float,2>{0.00356901344f, 0.237099737f},
-std::array<float,2>{0.680809736f, 0.83021754f},
-std::array<float,2>{0.699862123f, 0.356853813f},
-std::array<float,2>{0.118528642f, 0.606848836f},
-std::array<float,2>{0.389278024f, 0.0540493131f},
-std::array<float,2>{0.809880912f, 0.887638152f},
-std::array<float,2>{0.879573286f, 0.147916615f},
-std::array<float,2>{0.340819865f, 0.806186974f},
-std::array<float,2>{0.24514775f, 0.476235837f},
-std::array<float,2>{0.614360213f, 0.742927492f},
-std::array<float,2>{0.570003331f, 0.207040176f},
-std::array<float,2>{0.215711042f, 0.874916613f},
-std::array<float,2>{0.365605056f, 0.417442292f},
-std::array<float,2>{0.932764113f, 0.670505643f},
-std::array<float,2>{0.767618239f, 0.257278413f},
-std::array<float,2>{0.411386937f, 0.538148642f},
-std::array<float,2>{0.0743645728f, 0.107816771f},
-std::array<float,2>{0.7207883f, 0.952011049f},
-std::array<float,2>{0.6544137f, 0.438449323f},
-std::array<float,2>{0.0598471239f, 0.710582435f},
-std::array<float,2>{0.467119187f, 0.163031757f},
-std::array<float,2>{0.813821018f, 0.757637203f},
-std::array<float,2>{0.993189514f, 0.0216492172f},
-std::array<float,2>{0.289798111f, 0.927182853f},
-std::array<float,2>{0.170385763f, 0.32808575f},
-std::array<float,2>{0.561817288f, 0.572461009f},
-std::array<float,2>{0.691696167f, 0.0644075125f},
-std::array<float,2>{0.110456936f, 0.969333291f},
-std::array<float,2>{0.380610466f, 0.291942209f},
-std::array<float,2>{0.796901464f, 0.503228486f},
-std::array<float,2>{0.88744241f, 0.384187847f},
-std::array<float,2>{0.333109945f, 0.650286019f},
-std::array<float,2>{0.235545665f, 0.229748011f},
-std::array<float,2>{0.618810058f, 0.826395214f},
-std::array<float,2>{0.50460279f, 0.371871203f},
-std::array<float,2>{0.140722513f, 0.613110662f},
-std::array<float,2>{0.270432085f, 0.0383952521f},
-std::array<float,2>{0.954089344f, 0.893056512f},
-std::array<float,2>{0.853399634f, 0.128848821f},
-std::array<float,2>{0.486284226f, 0.782275856f},
-std::array<float,2>{0.00889199413f, 0.491596729f},
-std::array<float,2>{0.671928406f, 0.725902498f},
-std::array<float,2>{0.668649256f, 0.172174752f},
-std::array<float,2>{0.0246464703f, 0.78115195f},
-std::array<float,2>{0.473274291f, 0.462477148f},
-std::array<float,2>{0.861817658f, 0.702500463f},
-std::array<float,2>{0.943887115f, 0.340564996f},
-std::array<float,2>{0.257646054f, 0.587073207f},
-std::array<float,2>{0.138299063f, 0.0116719585f},
-std::array<float,2>{0.520438135f, 0.917709589f},
-std::array<float,2>{0.602941096f, 0.43286261f},
-std::array<float,2>{0.227969363f, 0.680786371f},
-std::array<float,2>{0.326248974f, 0.198373556f},
-std::array<float,2>{0.904606879f, 0.854351521f},
-std::array<float,2>{0.794765353f, 0.124296531f},
-std::array<float,2>{0.402843297f, 0.954990983f},
-std::array<float,2>{0.106815435f, 0.275325865f},
-std::array<float,2>{0.708407283f, 0.556874633f},
-std::array<float,2>{0.543186724f, 0.0490984507f},
-std::array<float,2>{0.172532648f, 0.886422753f},
-std::array<float,2>{0.304083735f, 0.353562921f},
-std::array<float,2>{0.981029212f, 0.602959335f},
-std::array<float,2>{0.843645215f, 0.471473366f},
-std::array<float,2>{0.440037668f, 0.747060299f},
-std::array<float,2>{0.0332561657f, 0.144049659f},
-std::array<float,2>{0.627951741f, 0.809953809f},
-std::array<float,2>{0.738621354f, 0.300938755f},
-std::array<float,2>{0.0820471942f, 0.515702903f},
-std::array<float,2>{0.424740285f, 0.0831602439f},
-std::array<float,2>{0.761253834f, 0.999348402f},
-std::array<float,2>{0.919635415f, 0.2391617f},
-std::array<float,2>{0.358409107f, 0.832567096f},
-std::array<float,2>{0.198812097f, 0.395951271f},
-std::array<float,2>{0.579715967f, 0.639068067f},
-std::array<float,2>{0.530430734f, 0.155584916f},
-std::array<float,2>{0.126652315f, 0.798834443f},
-std::array<float,2>{0.259782016f, 0.483519524f},
-std::array<float,2>{0.949264228f, 0.735816836f},
-std::array<float,2>{0.867346227f, 0.349473774f},
-std::array<float,2>{0.480345517f, 0.59923768f},
-std::array<float,2>{0.0192502048f, 0.0620901287f},
-std::array<float,2>{0.662404001f, 0.880791843f},
-std::array<float,2>{0.717925727f, 0.404436648f},
-std::array<float,2>{0.0974294841f, 0.629181623f},
-std::array<float,2>{0.393776f, 0.249769285f},
-std::array<float,2>{0.78146112f, 0.843193471f},
-std::array<float,2>{0.890863121f, 0.0896781906f},
-std::array<float,2>{0.318111658f, 0.986338317f},
-std::array<float,2>{0.226183847f, 0.306322694f},
-std::array<float,2>{0.5972507f, 0.531148255f},
-std::array<float,2>{0.637085795f, 0.0025541049f},
-std::array<float,2>{0.0394738577f, 0.909997642f},
-std::array<float,2>{0.446181238f, 0.332913071f},
-std::array<float,2>{0.831532359f, 0.583644927f},
-std::array<float,2>{0.971809864f, 0.458327055f},
-std::array<float,2>{0.310625643f, 0.687516332f},
-std::array<float,2>{0.17989637f, 0.185927927f},
-std::array<float,2>{0.53440994f, 0.772033989f},
-std::array<float,2>{0.591770589f, 0.269723743f},
-std::array<float,2>{0.195002332f, 0.547451377f},
-std::array<float,2>{0.350533992f, 0.112371802f},
-std::array<float,2>{0.906381011f, 0.965884745f},
-std::array<float,2>{0.757643521f, 0.189898208f},
-std::array<float,2>{0.429890692f, 0.848012567f},
-std::array<float,2>{0.0862179622f, 0.426016927f},
-std::array<float,2>{0.74686712f, 0.678239763f},
-std::array<float,2>{0.731799781f, 0.221119717f},
-std::array<float,2>{0.0647564158f, 0.814719737f},
-std::array<float,2>{0.418079257f, 0.375529468f},
-std::array<float,2>{0.775394499f, 0.647491932f},
-std::array<float,2>{0.92199713f, 0.288941234f},
-std::array<float,2>{0.372433454f, 0.509920359f},
-std::array<float,2>{0.206054926f, 0.0709913149f},
-std::array<float,2>{0.572084188f, 0.980608582f},
-std::array<float,2>{0.553554952f, 0.498326659f},
-std::array<float,2>{0.158674434f, 0.732748628f},
-std::array<float,2>{0.285763979f, 0.135463059f},
-std::array<float,2>{0.98579365f, 0.793347239f},
-std::array<float,2>{0.826218128f, 0.0452298634f},
-std::array<float,2>{0.456161231f, 0.903832555f},
-std::array<float,2>{0.051004082f, 0.361961424f},
-std::array<float,2>{0.643433809f, 0.622070432f},
-std::array<float,2>{0.610694885f, 0.0981531367f},
-std::array<float,2>{0.249044284f, 0.944942474f},
-std::array<float,2>{0.337701678f, 0.26377064f},
-std::array<float,2>{0.876151323f, 0.545098066f},
-std::array<float,2>{0.807870746f, 0.409069896f},
-std::array<float,2>{0.38432011f, 0.66350776f},
-std::array<float,2>{0.123057827f, 0.212762684f},
-std::array<float,2>{0.698222697f, 0.863981187f},
-std::array<float,2>{0.684765756f, 0.318941474f},
-std::array<float,2>{0.00535177812f, 0.56297338f},
-std::array<float,2>{0.494406253f, 0.0302783921f},
-std::array<float,2>{0.850588262f, 0.93486017f},
-std::array<float,2>{0.965567648f, 0.168583989f},
-std::array<float,2>{0.275134414f, 0.759162426f},
-std::array<float,2>{0.15272072f, 0.452711672f},
-std::array<float,2>{0.509205401f, 0.716458917f},
-std::array<float,2>{0.501874387f, 0.19246085f},
-std::array<float,2>{0.146047279f, 0.846342385f},
-std::array<float,2>{0.266807944f, 0.424154341f},
-std::array<float,2>{0.960381925f, 0.67347151f},
-std::array<float,2>{0.857382536f, 0.268367022f},
-std::array<float,2>{0.489853203f, 0.553361714f},
-std::array<float,2>{0.0130956499f, 0.114852235f},
-std::array<float,2>{0.677773237f, 0.963000476f},
-std::array<float,2>{0.68845582f, 0.455880582f},
-std::array<float,2>{0.116090633f, 0.694875777f},
-std::array<float,2>{0.377900958f, 0.180263415f},
-std::array<float,2>{0.802159309f, 0.766866446f},
-std::array<float,2>{0.885987401f, 0.00399382086f},
-std::array<float,2>{0.329691529f, 0.913362265f},
-std::array<float,2>{0.240409553f, 0.328894943f},
-std::array<float,2>{0.622382224f, 0.578632116f},
-std::array<float,2>{0.649066031f, 0.0903858691f},
-std::array<float,2>{0.055251427f, 0.991890669f},
-std::array<float,2>{0.463223636f, 0.309631079f},
-std::array<float,2>{0.820133626f, 0.526173353f},
-std::array<float,2>{0.998084724f, 0.402108699f},
-std::array<float,2>{0.296553761f, 0.627761245f},
-std::array<float,2>{0.166462719f, 0.24497512f},
-std::array<float,2>{0.557284176f, 0.839453816f},
-std::array<float,2>{0.563558161f, 0.345112622f},
-std::array<float,2>{0.211731642f, 0.597609699f},
-std::array<float,2>{0.36075899f, 0.0556151085f},
-std::array<float,2>{0.935530841f, 0.878510535f},
-std::array<float,2>{0.771700382f, 0.151379377f},
-std::array<float,2>{0.406564832f, 0.803042352f},
-std::array<float,2>{0.0726317018f, 0.477459252f},
-std::array<float,2>{0.724226773f, 0.741624057f},
-std::array<float,2>{0.735683084f, 0.165413812f},
-std::array<float,2>{0.0789065138f, 0.762519002f},
-std::array<float,2>{0.429273456f, 0.448213786f},
-std::array<float,2>{0.7641536f, 0.714639425f},
-std::array<float,2>{0.917062402f, 0.314190894f},
-std::array<float,2>{0.35321337f, 0.567938745f},
-std::array<float,2>{0.199859232f, 0.0262677483f},
-std::array<float,2>{0.584312737f, 0.931509554f},
-std::array<float,2>{0.542454362f, 0.413012534f},
-std::array<float,2>{0.176695779f, 0.658230901f},
-std::array<float,2>{0.297955692f, 0.215873301f},
-std::array<float,2>{0.976721048f, 0.861055791f},
-std::array<float,2>{0.83606714f, 0.095212996f},
-std::array<float,2>{0.445059925f, 0.940680861f},
-std::array<float,2>{0.0384558626f, 0.258859336f},
-std::array<float,2>{0.630040109f, 0.541077197f},
-std::array<float,2>{0.608105302f, 0.0398747213f},
-std::array<float,2>{0.232607946f, 0.901619732f},
-std::array<float,2>{0.321332633f, 0.365149558f},
-std::array<float,2>{0.900093377f, 0.618579149f},
-std::array<float,2>{0.790687978f, 0.493434876f},
-std::array<float,2>{0.400823355f, 0.73009795f},
-std::array<float,2>{0.101570949f, 0.139755994f},
-std::array<float,2>{0.706471443f, 0.791016161f},
-std::array<float,2>{0.666500986f, 0.285141498f},
-std::array<float,2>{0.0287177004f, 0.515003204f},
-std::array<float,2>{0.469597071f, 0.0748074725f},
-std::array<float,2>{0.865442872f, 0.97946471f},
-std::array<float,2>{0.9405213f, 0.226495042f},
-std::array<float,2>{0.251637101f, 0.817193627f},
-std::array<float,2>{0.134134561f, 0.380367607f},
-std::array<float,2>{0.516597331f, 0.642464042f},
-std::array<float,2>{0.588705301f, 0.129012898f},
-std::array<float,2>{0.189603776f, 0.7880252f},
-std::array<float,2>{0.346238732f, 0.48630029f},
-std::array<float,2>{0.912587345f, 0.720843315f},
-std::array<float,2>{0.751004338f, 0.367308199f},
-std::array<float,2>{0.435688168f, 0.613539398f},
-std::array<float,2>{0.09315712f, 0.034981586f},
-std::array<float,2>{0.744901359f, 0.895271122f},
-std::array<float,2>{0.633836389f, 0.390367955f},
-std::array<float,2>{0.043888893f, 0.653032243f},
-std::array<float,2>{0.451705128f, 0.232962266f},
-std::array<float,2>{0.835532308f, 0.82190901f},
-std::array<float,2>{0.975291014f, 0.0698028132f},
-std::array<float,2>{0.305465728f, 0.973496556f},
-std::array<float,2>{0.185489699f, 0.296655029f},
-std::array<float,2>{0.537595689f, 0.505178869f},
-std::array<float,2>{0.712001979f, 0.0185694508f},
-std::array<float,2>{0.101430759f, 0.925387859f},
-std::array<float,2>{0.395831674f, 0.320909172f},
-std::array<float,2>{0.786024809f, 0.575806022f},
-std::array<float,2>{0.898080945f, 0.442970723f},
-std::array<float,2>{0.313274741f, 0.706849754f},
-std::array<float,2>{0.221675918f, 0.159659073f},
-std::array<float,2>{0.599406779f, 0.753143668f},
-std::array<float,2>{0.524033308f, 0.251806349f},
-std::array<float,2>{0.130414054f, 0.531307638f},
-std::array<float,2>{0.262037665f, 0.105053209f},
-std::array<float,2>{0.946461618f, 0.946506679f},
-std::array<float,2>{0.874572933f, 0.205112413f},
-std::array<float,2>{0.48369664f, 0.869252026f},
-std::array<float,2>{0.0233756844f, 0.41947189f},
-std::array<float,2>{0.658364892f, 0.666355491f},
-std::array<float,2>{0.683040321f, 0.234499767f},
-std::array<float,2>{0.00059956027f, 0.829418004f},
-std::array<float,2>{0.497022301f, 0.392636627f},
-std::array<float,2>{0.846185744f, 0.634385586f},
-std::array<float,2>{0.961050034f, 0.296927571f},
-std::array<float,2>{0.278107136f, 0.522091627f},
-std::array<float,2>{0.149620891f, 0.0792918801f},
-std::array<float,2>{0.513349891f, 0.992810428f},
-std::array<float,2>{0.615347207f, 0.47401616f},
-std::array<float,2>{0.243695393f, 0.745950282f},
-std::array<float,2>{0.342365563f, 0.144734189f},
-std::array<float,2>{0.88165313f, 0.807393968f},
-std::array<float,2>{0.811229348f, 0.0511112139f},
-std::array<float,2>{0.387360692f, 0.890049338f},
-std::array<float,2>{0.120576091f, 0.357425779f},
-std::array<float,2>{0.70184654f, 0.609329581f},
-std::array<float,2>{0.548016965f, 0.118472338f},
-std::array<float,2>{0.164054155f, 0.957319558f},
-std::array<float,2>{0.281654686f, 0.278312862f},
-std::array<float,2>{0.989824593f, 0.562100828f},
-std::array<float,2>{0.822045028f, 0.43673259f},
-std::array<float,2>{0.460307986f, 0.684947968f},
-std::array<float,2>{0.0506297089f, 0.199562669f},
-std::array<float,2>{0.646905303f, 0.857486665f},
-std::array<float,2>{0.728459656f, 0.337425083f},
-std::array<float,2>{0.0673451126f, 0.591460168f},
-std::array<float,2>{0.416614234f, 0.0147234267f},
-std::array<float,2>{0.780047655f, 0.921781361f},
-std::array<float,2>{0.928403914f, 0.177202791f},
-std::array<float,2>{0.367525071f, 0.774852395f},
-std::array<float,2>{0.210803077f, 0.466339737f},
-std::array<float,2>{0.57533735f, 0.698952854f},
-std::array<float,2>{0.620255113f, 0.228118896f},
-std::array<float,2>{0.237716243f, 0.826138437f},
-std::array<float,2>{0.335792035f, 0.385474384f},
-std::array<float,2>{0.890224338f, 0.651370049f},
-std::array<float,2>{0.798848331f, 0.289933562f},
-std::array<float,2>{0.380981594f, 0.501652956f},
-std::array<float,2>{0.111720614f, 0.0652263388f},
-std::array<float,2>{0.693604052f, 0.970736146f},
-std::array<float,2>{0.675340891f, 0.488435358f},
-std::array<float,2>{0.0108892005f, 0.722713649f},
-std::array<float,2>{0.48808527f, 0.126268476f},
-std::array<float,2>{0.854287207f, 0.784951866f},
-std::array<float,2>{0.955544889f, 0.0369458608f},
-std::array<float,2>{0.273376912f, 0.890699208f},
-std::array<float,2>{0.143889576f, 0.37384361f},
-std::array<float,2>{0.507398784f, 0.611317754f},
-std::array<float,2>{0.719421983f, 0.106272034f},
-std::array<float,2>{0.0780362263f, 0.949330926f},
-std::array<float,2>{0.41352731f, 0.254606396f},
-std::array<float,2>{0.767555356f, 0.536616027f},
-std::array<float,2>{0.930160701f, 0.415420055f},
-std::array<float,2>{0.363696307f, 0.668204844f},
-std::array<float,2>{0.217247218f, 0.209898889f},
-std::array<float,2>{0.566917837f, 0.871781886f},
-std::array<float,2>{0.559199154f, 0.325601757f},
-std::array<float,2>{0.168615401f, 0.570441782f},
-std::array<float,2>{0.292011142f, 0.0208379421f},
-std::array<float,2>{0.994494796f, 0.927855253f},
-std::array<float,2>{0.815560222f, 0.160565242f},
-std::array<float,2>{0.464932799f, 0.755662382f},
-std::array<float,2>{0.0623547062f, 0.440316349f},
-std::array<float,2>{0.65326035f, 0.708107173f},
-std::array<float,2>{0.626124799f, 0.142475784f},
-std::array<float,2>{0.0324378908f, 0.810900748f},
-std::array<float,2>{0.438069165f, 0.469392568f},
-std::array<float,2>{0.841766894f, 0.749148846f},
-std::array<float,2>{0.983108163f, 0.352407277f},
-std::array<float,2>{0.301901251f, 0.603696048f},
-std::array<float,2>{0.175235972f, 0.0477092564f},
-std::array<float,2>{0.545316637f, 0.884733021f},
-std::array<float,2>{0.580568552f, 0.39654088f},
-std::array<float,2>{0.196475044f, 0.63735044f},
-std::array<float,2>{0.356308281f, 0.241653875f},
-std::array<float,2>{0.920888305f, 0.835523784f},
-std::array<float,2>{0.759066463f, 0.0847284868f},
-std::array<float,2>{0.422360927f, 0.99720633f},
-std::array<float,2>{0.0856715366f, 0.30426684f},
-std::array<float,2>{0.741555274f, 0.518224299f},
-std::array<float,2>{0.52322948f, 0.00886625983f},
-std::array<float,2>{0.140265241f, 0.914851665f},
-std::array<float,2>{0.25404954f, 0.342771858f},
-std::array<float,2>{0.943240643f, 0.589497566f},
-std::array<float,2>{0.861308813f, 0.463573635f},
-std::array<float,2>{0.475274682f, 0.701125085f},
-std::array<float,2>{0.025984427f, 0.174301207f},
-std::array<float,2>{0.671359241f, 0.778318882f},
-std::array<float,2>{0.71025759f, 0.276964188f},
-std::array<float,2>{0.108642891f, 0.556542218f},
-std::array<float,2>{0.406036168f, 0.122003958f},
-std::array<float,2>{0.795545161f, 0.95598954f},
-std::array<float,2>{0.903826118f, 0.196001709f},
-std::array<float,2>{0.325555354f, 0.853146553f},
-std::array<float,2>{0.228846148f, 0.429878592f},
-std::array<float,2>{0.604273081f, 0.682335675f},
-std::array<float,2>{0.533111095f, 0.18518059f},
-std::array<float,2>{0.18188563f, 0.770841658f},
-std::array<float,2>{0.309831172f, 0.460728854f},
-std::array<float,2>{0.969983816f, 0.690333545f},
-std::array<float,2>{0.829212546f, 0.335880548f},
-std::array<float,2>{0.447304726f, 0.585094035f},
-std::array<float,2>{0.0411155932f, 0.00141979835f},
-std::array<float,2>{0.639151454f, 0.907830894f},
-std::array<float,2>{0.749112725f, 0.428133816f},
-std::array<float,2>{0.0897497609f, 0.67625612f},
-std::array<float,2>{0.431700766f, 0.188362017f},
-std::array<float,2>{0.754306674f, 0.849909246f},
-std::array<float,2>{0.909017622f, 0.109523699f},
-std::array<float,2>{0.348430634f, 0.967940331f},
-std::array<float,2>{0.192954034f, 0.272353083f},
-std::array<float,2>{0.591828704f, 0.549397588f},
-std::array<float,2>{0.661592722f, 0.0591391958f},
-std::array<float,2>{0.0161278974f, 0.88118726f},
-std::array<float,2>{0.476644367f, 0.350405425f},
-std::array<float,2>{0.869837642f, 0.599892557f},
-std::array<float,2>{0.951969504f, 0.482085824f},
-std::array<float,2>{0.257858664f, 0.738069296f},
-std::array<float,2>{0.128707692f, 0.15301317f},
-std::array<float,2>{0.528319061f, 0.797099948f},
-std::array<float,2>{0.594379365f, 0.307653725f},
-std::array<float,2>{0.222833186f, 0.527998805f},
-std::array<float,2>{0.319146901f, 0.0878432915f},
-std::array<float,2>{0.893042266f, 0.984689355f},
-std::array<float,2>{0.783302963f, 0.246403068f},
-std::array<float,2>{0.391286492f, 0.84060806f},
-std::array<float,2>{0.0940208063f, 0.40269497f},
-std::array<float,2>{0.715738237f, 0.631617844f},
-std::array<float,2>{0.696136355f, 0.214273542f},
-std::array<float,2>{0.121608905f, 0.865697682f},
-std::array<float,2>{0.386472344f, 0.406473726f},
-std::array<float,2>{0.806377292f, 0.660332918f},
-std::array<float,2>{0.876985013f, 0.262595505f},
-std::array<float,2>{0.33983463f, 0.543055832f},
-std::array<float,2>{0.246290058f, 0.100568965f},
-std::array<float,2>{0.612822175f, 0.941939533f},
-std::array<float,2>{0.509863853f, 0.450997293f},
-std::array<float,2>{0.156186044f, 0.716814458f},
-std::array<float,2>{0.275422513f, 0.171575949f},
-std::array<float,2>{0.968393803f, 0.760748327f},
-std::array<float,2>{0.849523306f, 0.0282593872f},
-std::array<float,2>{0.493894726f, 0.937089026f},
-std::array<float,2>{0.00591032952f, 0.317388773f},
-std::array<float,2>{0.686770082f, 0.565854967f},
-std::array<float,2>{0.57254529f, 0.0730870441f},
-std::array<float,2>{0.204382494f, 0.982978284f},
-std::array<float,2>{0.374557793f, 0.285995066f},
-std::array<float,2>{0.924447f, 0.508877397f},
-std::array<float,2>{0.774108768f, 0.377005279f},
-std::array<float,2>{0.420558751f, 0.645119011f},
-std::array<float,2>{0.0633838177f, 0.219673529f},
-std::array<float,2>{0.732823968f, 0.813948333f},
-std::array<float,2>{0.641744852f, 0.360425442f},
-std::array<float,2>{0.0536384545f, 0.624263525f},
-std::array<float,2>{0.454950213f, 0.0446459129f},
-std::array<float,2>{0.825458825f, 0.905967891f},
-std::array<float,2>{0.988099933f, 0.133733526f},
-std::array<float,2>{0.288523853f, 0.795100093f},
-std::array<float,2>{0.157577619f, 0.497047812f},
-std::array<float,2>{0.550907731f, 0.730633974f},
-std::array<float,2>{0.51681298f, 0.223213062f},
-std::array<float,2>{0.132995963f, 0.819359183f},
-std::array<float,2>{0.250455737f, 0.382063776f},
-std::array<float,2>{0.939844191f, 0.644229531f},
-std::array<float,2>{0.866703391f, 0.283196151f},
-std::array<float,2>{0.469832629f, 0.512582183f},
-std::array<float,2>{0.0276744403f, 0.0762441084f},
-std::array<float,2>{0.667448521f, 0.977443159f},
-std::array<float,2>{0.705742955f, 0.49579972f},
-std::array<float,2>{0.103223048f, 0.727371752f},
-std::array<float,2>{0.401462048f, 0.137243763f},
-std::array<float,2>{0.789808691f, 0.790206194f},
-std::array<float,2>{0.899375916f, 0.0423785262f},
-std::array<float,2>{0.320747286f, 0.900020361f},
-std::array<float,2>{0.234117687f, 0.366832882f},
-std::array<float,2>{0.608919024f, 0.620827794f},
-std::array<float,2>{0.629209638f, 0.096897848f},
-std::array<float,2>{0.037335474f, 0.937665761f},
-std::array<float,2>{0.443401217f, 0.261066914f},
-std::array<float,2>{0.837607265f, 0.539399326f},
-std::array<float,2>{0.978108466f, 0.412045807f},
-std::array<float,2>{0.297240108f, 0.656888366f},
-std::array<float,2>{0.176774457f, 0.218363196f},
-std::array<float,2>{0.541217387f, 0.862428904f},
-std::array<float,2>{0.585224152f, 0.314685076f},
-std::array<float,2>{0.20101513f, 0.569647789f},
-std::array<float,2>{0.352158457f, 0.0252220444f},
-std::array<float,2>{0.916712046f, 0.932202637f},
-std::array<float,2>{0.765307546f, 0.167712778f},
-std::array<float,2>{0.427825689f, 0.765607178f},
-std::array<float,2>{0.0792640448f, 0.4457542f},
-std::array<float,2>{0.735299826f, 0.7127707f},
-std::array<float,2>{0.722944319f, 0.150275767f},
-std::array<float,2>{0.0740844607f, 0.802399158f},
-std::array<float,2>{0.407853335f, 0.478522658f},
-std::array<float,2>{0.773367405f, 0.739700258f},
-std::array<float,2>{0.933911145f, 0.346268356f},
-std::array<float,2>{0.359985799f, 0.594314277f},
-std::array<float,2>{0.212714076f, 0.0585410632f},
-std::array<float,2>{0.56346333f, 0.876587093f},
-std::array<float,2>{0.557878792f, 0.398632973f},
-std::array<float,2>{0.167957947f, 0.625069797f},
-std::array<float,2>{0.295071542f, 0.243314907f},
-std::array<float,2>{0.999852479f, 0.837768137f},
-std::array<float,2>{0.818962812f, 0.0918835998f},
-std::array<float,2>{0.46450904f, 0.989197612f},
-std::array<float,2>{0.0565705597f, 0.31248787f},
-std::array<float,2>{0.649482846f, 0.525387585f},
-std::array<float,2>{0.621690631f, 0.00773176551f},
-std::array<float,2>{0.241616338f, 0.91038394f},
-std::array<float,2>{0.328279376f, 0.331684232f},
-std::array<float,2>{0.885287046f, 0.581413209f},
-std::array<float,2>{0.800847888f, 0.454908609f},
-std::array<float,2>{0.378662825f, 0.691663861f},
-std::array<float,2>{0.117046326f, 0.182310924f},
-std::array<float,2>{0.68894875f, 0.768356919f},
-std::array<float,2>{0.679589093f, 0.267271072f},
-std::array<float,2>{0.0119055212f, 0.552626193f},
-std::array<float,2>{0.488365442f, 0.115461014f},
-std::array<float,2>{0.855766058f, 0.96205616f},
-std::array<float,2>{0.959661126f, 0.193619534f},
-std::array<float,2>{0.265768021f, 0.845131338f},
-std::array<float,2>{0.145365477f, 0.423743099f},
-std::array<float,2>{0.500354886f, 0.674998701f},
-std::array<float,2>{0.574425697f, 0.178442299f},
-std::array<float,2>{0.209804699f, 0.776300251f},
-std::array<float,2>{0.368245006f, 0.467876643f},
-std::array<float,2>{0.929465711f, 0.695872664f},
-std::array<float,2>{0.780287802f, 0.338477999f},
-std::array<float,2>{0.417840689f, 0.593566716f},
-std::array<float,2>{0.0675971285f, 0.0127461189f},
-std::array<float,2>{0.727352977f, 0.919630289f},
-std::array<float,2>{0.647754729f, 0.434062243f},
-std::array<float,2>{0.0495056771f, 0.687073648f},
-std::array<float,2>{0.459718764f, 0.203057006f},
-std::array<float,2>{0.820539892f, 0.857254505f},
-std::array<float,2>{0.988604605f, 0.119904667f},
-std::array<float,2>{0.282316417f, 0.959817827f},
-std::array<float,2>{0.162508503f, 0.27963385f},
-std::array<float,2>{0.547364831f, 0.559338093f},
-std::array<float,2>{0.703022301f, 0.0536528677f},
-std::array<float,2>{0.119313136f, 0.888469279f},
-std::array<float,2>{0.388476968f, 0.35621804f},
-std::array<float,2>{0.81240201f, 0.605663061f},
-std::array<float,2>{0.882246077f, 0.474963605f},
-std::array<float,2>{0.34332794f, 0.743978024f},
-std::array<float,2>{0.242509529f, 0.147081256f},
-std::array<float,2>{0.616838634f, 0.805540323f},
-std::array<float,2>{0.512351632f, 0.298872918f},
-std::array<float,2>{0.148968667f, 0.521337092f},
-std::array<float,2>{0.278541684f, 0.0808475167f},
-std::array<float,2>{0.962710321f, 0.994719625f},
-std::array<float,2>{0.846888602f, 0.237740993f},
-std::array<float,2>{0.497426897f, 0.831588924f},
-std::array<float,2>{0.00120687718f, 0.390792131f},
-std::array<float,2>{0.682136655f, 0.635228217f},
-std::array<float,2>{0.659614086f, 0.204297036f},
-std::array<float,2>{0.0222137887f, 0.868130565f},
-std::array<float,2>{0.483247489f, 0.421232283f},
-std::array<float,2>{0.873905063f, 0.664288044f},
-std::array<float,2>{0.945477128f, 0.252339959f},
-std::array<float,2>{0.262897134f, 0.53369534f},
-std::array<float,2>{0.129178897f, 0.103001907f},
-std::array<float,2>{0.525325239f, 0.947970331f},
-std::array<float,2>{0.598360538f, 0.444222838f},
-std::array<float,2>{0.22195287f, 0.703316867f},
-std::array<float,2>{0.31405443f, 0.156956807f},
-std::array<float,2>{0.896539152f, 0.750406921f},
-std::array<float,2>{0.786155164f, 0.0169072747f},
-std::array<float,2>{0.395082265f, 0.922030807f},
-std::array<float,2>{0.0999651998f, 0.322418272f},
-std::array<float,2>{0.711009085f, 0.577607691f},
-std::array<float,2>{0.538505018f, 0.0668589845f},
-std::array<float,2>{0.184473544f, 0.975318193f},
-std::array<float,2>{0.306550115f, 0.294512063f},
-std::array<float,2>{0.976164222f, 0.50642091f},
-std::array<float,2>{0.834782064f, 0.387263387f},
-std::array<float,2>{0.453071535f, 0.655226052f},
-std::array<float,2>{0.0447122492f, 0.230698019f},
-std::array<float,2>{0.632877767f, 0.822430074f},
-std::array<float,2>{0.745943606f, 0.369890511f},
-std::array<float,2>{0.0927140862f, 0.615726769f},
-std::array<float,2>{0.437169582f, 0.0330934264f},
-std::array<float,2>{0.750102103f, 0.896662891f},
-std::array<float,2>{0.913494349f, 0.131843716f},
-std::array<float,2>{0.347137481f, 0.785377741f},
-std::array<float,2>{0.191049039f, 0.486338049f},
-std::array<float,2>{0.589125574f, 0.71890372f},
-std::array<float,2>{0.605363905f, 0.197571456f},
-std::array<float,2>{0.2301649f, 0.854848742f},
-std::array<float,2>{0.324297428f, 0.432461143f},
-std::array<float,2>{0.903102517f, 0.679851592f},
-std::array<float,2>{0.796331406f, 0.273849458f},
-std::array<float,2>{0.404509097f, 0.55830723f},
-std::array<float,2>{0.108129971f, 0.123730756f},
-std::array<float,2>{0.709652364f, 0.95338434f},
-std::array<float,2>{0.670649886f, 0.461791694f},
-std::array<float,2>{0.0270647053f, 0.701931596f},
-std::array<float,2>{0.475750268f, 0.173137054f},
-std::array<float,2>{0.860010028f, 0.780248046f},
-std::array<float,2>{0.941629171f, 0.00993895624f},
-std::array<float,2>{0.254952669f, 0.916447103f},
-std::array<float,2>{0.139079422f, 0.341222644f},
-std::array<float,2>{0.521663308f, 0.586432517f},
-std::array<float,2>{0.741086781f, 0.0828370973f},
-std::array<float,2>{0.0841870233f, 0.998082817f},
-std::array<float,2>{0.423302174f, 0.302454561f},
-std::array<float,2>{0.758609593f, 0.517088652f},
-std::array<float,2>{0.921842813f, 0.394795567f},
-std::array<float,2>{0.356495857f, 0.63972193f},
-std::array<float,2>{0.195650324f, 0.239691272f},
-std::array<float,2>{0.581928313f, 0.83397913f},
-std::array<float,2>{0.546637893f, 0.354577452f},
-std::array<float,2>{0.174123123f, 0.601793706f},
-std::array<float,2>{0.301749587f, 0.0503172725f},
-std::array<float,2>{0.983721256f, 0.884781063f},
-std::array<float,2>{0.840519607f, 0.143034682f},
-std::array<float,2>{0.439233422f, 0.809540808f},
-std::array<float,2>{0.0318129398f, 0.471877903f},
-std::array<float,2>{0.625479698f, 0.747352898f},
-std::array<float,2>{0.654027879f, 0.163902402f},
-std::array<float,2>{0.0614604838f, 0.756273508f},
-std::array<float,2>{0.466400921f, 0.438753724f},
-std::array<float,2>{0.814955056f, 0.709005058f},
-std::array<float,2>{0.995433748f, 0.326734722f},
-std::array<float,2>{0.291652858f, 0.573546767f},
-std::array<float,2>{0.16937463f, 0.0229391474f},
-std::array<float,2>{0.559817731f, 0.926035941f},
-std::array<float,2>{0.568232894f, 0.416066557f},
-std::array<float,2>{0.218531772f, 0.671540618f},
-std::array<float,2>{0.364258498f, 0.208010927f},
-std::array<float,2>{0.930908859f, 0.873127759f},
-std::array<float,2>{0.765679955f, 0.109046929f},
-std::array<float,2>{0.412273437f, 0.952961624f},
-std::array<float,2>{0.0769015849f, 0.256721944f},
-std::array<float,2>{0.719793141f, 0.537581801f},
-std::array<float,2>{0.506357789f, 0.0376818925f},
-std::array<float,2>{0.142921701f, 0.894021511f},
-std::array<float,2>{0.271557152f, 0.372889876f},
-std::array<float,2>{0.956252337f, 0.612085521f},
-std::array<float,2>{0.855382144f, 0.490686238f},
-std::array<float,2>{0.486961305f, 0.725376487f},
-std::array<float,2>{0.00991054159f, 0.127093658f},
-std::array<float,2>{0.674242496f, 0.782154083f},
-std::array<float,2>{0.694629192f, 0.292212397f},
-std::array<float,2>{0.112335943f, 0.502723277f},
-std::array<float,2>{0.382771671f, 0.0630708113f},
-std::array<float,2>{0.800031543f, 0.970613122f},
-std::array<float,2>{0.889648199f, 0.229061902f},
-std::array<float,2>{0.334406644f, 0.827399611f},
-std::array<float,2>{0.236488327f, 0.383247167f},
-std::array<float,2>{0.619912922f, 0.649107158f},
-std::array<float,2>{0.552676558f, 0.136292085f},
-std::array<float,2>{0.156558782f, 0.793958068f},
-std::array<float,2>{0.287818551f, 0.499687195f},
-std::array<float,2>{0.986863613f, 0.733624041f},
-std::array<float,2>{0.824996829f, 0.36258474f},
-std::array<float,2>{0.45403254f, 0.621516526f},
-std::array<float,2>{0.0545113347f, 0.0460178778f},
-std::array<float,2>{0.641258359f, 0.902422965f},
-std::array<float,2>{0.733770847f, 0.376207978f},
-std::array<float,2>{0.0640752316f, 0.647320449f},
-std::array<float,2>{0.421557248f, 0.221974343f},
-std::array<float,2>{0.77468127f, 0.815499723f},
-std::array<float,2>{0.925486088f, 0.0713769272f},
-std::array<float,2>{0.373725444f, 0.981684029f},
-std::array<float,2>{0.203338549f, 0.287230402f},
-std::array<float,2>{0.573948503f, 0.510826647f},
-std::array<float,2>{0.686415911f, 0.0299426578f},
-std::array<float,2>{0.00683733867f, 0.934475958f},
-std::array<float,2>{0.492909521f, 0.319676459f},
-std::array<float,2>{0.847824097f, 0.563539922f},
-std::array<float,2>{0.966999173f, 0.451654166f},
-std::array<float,2>{0.277180135f, 0.715712726f},
-std::array<float,2>{0.154545784f, 0.169579715f},
-std::array<float,2>{0.51100713f, 0.757927358f},
-std::array<float,2>{0.611473203f, 0.264758676f},
-std::array<float,2>{0.247389972f, 0.546593428f},
-std::array<float,2>{0.338110745f, 0.0988928825f},
-std::array<float,2>{0.878821671f, 0.943793833f},
-std::array<float,2>{0.805626988f, 0.211249053f},
-std::array<float,2>{0.385079771f, 0.864931285f},
-std::array<float,2>{0.122459471f, 0.410114616f},
-std::array<float,2>{0.696329296f, 0.6622926f},
-std::array<float,2>{0.716514349f, 0.2485594f},
-std::array<float,2>{0.0949696153f, 0.842738092f},
-std::array<float,2>{0.391937882f, 0.405787259f},
-std::array<float,2>{0.7843768f, 0.630310714f},
-std::array<float,2>{0.893605888f, 0.304698467f},
-std::array<float,2>{0.320098758f, 0.529457211f},
-std::array<float,2>{0.224403948f, 0.0886934251f},
-std::array<float,2>{0.595416665f, 0.987461686f},
-std::array<float,2>{0.528975368f, 0.48286432f},
-std::array<float,2>{0.12771447f, 0.735006809f},
-std::array<float,2>{0.259000212f, 0.154718071f},
-std::array<float,2>{0.952189624f, 0.800043643f},
-std::array<float,2>{0.870944321f, 0.0609476231f},
-std::array<float,2>{0.477885872f, 0.879637778f},
-std::array<float,2>{0.0166292582f, 0.348543108f},
-std::array<float,2>{0.661099434f, 0.598090947f},
-std::array<float,2>{0.593538761f, 0.11218255f},
-std::array<float,2>{0.191620976f, 0.965694904f},
-std::array<float,2>{0.34917146f, 0.27088663f},
-std::array<float,2>{0.909242153f, 0.547986329f},
-std::array<float,2>{0.754902124f, 0.427063584f},
-std::array<float,2>{0.433354616f, 0.679368258f},
-std::array<float,2>{0.0883685276f, 0.190435186f},
-std::array<float,2>{0.748230398f, 0.849298298f},
-std::array<float,2>{0.640472174f, 0.333205402f},
-std::array<float,2>{0.0425661542f, 0.582414627f},
-std::array<float,2>{0.448667735f, 0.00304605789f},
-std::array<float,2>{0.828775823f, 0.908248544f},
-std::array<float,2>{0.96926862f, 0.187133968f},
-std::array<float,2>{0.308651984f, 0.773202896f},
-std::array<float,2>{0.182861313f, 0.457450539f},
-std::array<float,2>{0.531304121f, 0.689165473f},
-std::array<float,2>{0.53937012f, 0.215404868f},
-std::array<float,2>{0.178245693f, 0.859878838f},
-std::array<float,2>{0.299260199f, 0.413898885f},
-std::array<float,2>{0.97911191f, 0.660133421f},
-std::array<float,2>{0.838581979f, 0.258045971f},
-std::array<float,2>{0.442102611f, 0.542629004f},
-std::array<float,2>{0.0359856375f, 0.0937579796f},
-std::array<float,2>{0.631567121f, 0.939844847f},
-std::array<float,2>{0.736580729f, 0.448355615f},
-std::array<float,2>{0.0813584849f, 0.713457823f},
-std::array<float,2>{0.427453697f, 0.165027395f},
-std::array<float,2>{0.762441337f, 0.7633183f},
-std::array<float,2>{0.914187372f, 0.0269361846f},
-std::array<float,2>{0.355174422f, 0.93032831f},
-std::array<float,2>{0.201286376f, 0.312626272f},
-std::array<float,2>{0.582160294f, 0.567020297f},
-std::array<float,2>{0.665385365f, 0.0758850574f},
-std::array<float,2>{0.0304459706f, 0.980079293f},
-std::array<float,2>{0.472170681f, 0.283872634f},
-std::array<float,2>{0.864112079f, 0.514060318f},
-std::array<float,2>{0.937863886f, 0.379692823f},
-std::array<float,2>{0.252539247f, 0.641122103f},
-std::array<float,2>{0.135801941f, 0.224963263f},
-std::array<float,2>{0.51771158f, 0.81766963f},
-std::array<float,2>{0.607226789f, 0.363452941f},
-std::array<float,2>{0.230686173f, 0.617685854f},
-std::array<float,2>{0.323096335f, 0.0404216461f},
-std::array<float,2>{0.901571691f, 0.901281178f},
-std::array<float,2>{0.791446626f, 0.138678402f},
-std::array<float,2>{0.399434447f, 0.792501569f},
-std::array<float,2>{0.103960432f, 0.492705584f},
-std::array<float,2>{0.703313708f, 0.72944504f},
-std::array<float,2>{0.690730631f, 0.180853575f},
-std::array<float,2>{0.113545135f, 0.766085804f},
-std::array<float,2>{0.376861006f, 0.456519425f},
-std::array<float,2>{0.803544462f, 0.694253325f},
-std::array<float,2>{0.884698868f, 0.329424381f},
-std::array<float,2>{0.331865311f, 0.579114318f},
-std::array<float,2>{0.238465771f, 0.00500341365f},
-std::array<float,2>{0.624621332f, 0.912642062f},
-std::array<float,2>{0.50288856f, 0.425224751f},
-std::array<float,2>{0.14737542f, 0.672337294f},
-std::array<float,2>{0.268458128f, 0.19201909f},
-std::array<float,2>{0.958385766f, 0.847114146f},
-std::array<float,2>{0.858581483f, 0.113545284f},
-std::array<float,2>{0.49187085f, 0.964769423f},
-std::array<float,2>{0.0147834318f, 0.268576086f},
-std::array<float,2>{0.677375913f, 0.554535925f},
-std::array<float,2>{0.566191435f, 0.0562635697f},
-std::array<float,2>{0.213561147f, 0.877464771f},
-std::array<float,2>{0.362211257f, 0.34416759f},
-std::array<float,2>{0.936160386f, 0.596083641f},
-std::array<float,2>{0.769666374f, 0.47817716f},
-std::array<float,2>{0.408929944f, 0.740632474f},
-std::array<float,2>{0.0707788393f, 0.151046291f},
-std::array<float,2>{0.72463125f, 0.804573894f},
-std::array<float,2>{0.65116477f, 0.30921191f},
-std::array<float,2>{0.0568423867f, 0.527294278f},
-std::array<float,2>{0.461754173f, 0.0908496752f},
-std::array<float,2>{0.817417443f, 0.991063952f},
-std::array<float,2>{0.997566879f, 0.245160595f},
-std::array<float,2>{0.294558108f, 0.838831484f},
-std::array<float,2>{0.164663494f, 0.401153266f},
-std::array<float,2>{0.554859698f, 0.628464103f},
-std::array<float,2>{0.613367498f, 0.146315098f},
-std::array<float,2>{0.244602457f, 0.808004498f},
-std::array<float,2>{0.340898752f, 0.4730075f},
-std::array<float,2>{0.880011737f, 0.745018482f},
-std::array<float,2>{0.809041202f, 0.358490378f},
-std::array<float,2>{0.3898606f, 0.608140171f},
-std::array<float,2>{0.11804074f, 0.0518519022f},
-std::array<float,2>{0.700829089f, 0.889324546f},
-std::array<float,2>{0.6806584f, 0.393746525f},
-std::array<float,2>{0.00269427337f, 0.632866621f},
-std::array<float,2>{0.498731971f, 0.235699967f},
-std::array<float,2>{0.845190287f, 0.828714371f},
-std::array<float,2>{0.963877678f, 0.0782449692f},
-std::array<float,2>{0.279516757f, 0.99375242f},
-std::array<float,2>{0.151262507f, 0.298389465f},
-std::array<float,2>{0.514083505f, 0.52304101f},
-std::array<float,2>{0.730068147f, 0.0137355514f},
-std::array<float,2>{0.0701060072f, 0.920354545f},
-std::array<float,2>{0.415694207f, 0.336067289f},
-std::array<float,2>{0.777564049f, 0.590102255f},
-std::array<float,2>{0.926422954f, 0.464889318f},
-std::array<float,2>{0.371027142f, 0.697712421f},
-std::array<float,2>{0.20711492f, 0.176505372f},
-std::array<float,2>{0.577152193f, 0.77436316f},
-std::array<float,2>{0.549858391f, 0.279169023f},
-std::array<float,2>{0.16019614f, 0.560824513f},
-std::array<float,2>{0.283345491f, 0.117381655f},
-std::array<float,2>{0.990806401f, 0.958834112f},
-std::array<float,2>{0.822569668f, 0.200226545f},
-std::array<float,2>{0.458297491f, 0.859090209f},
-std::array<float,2>{0.0480449423f, 0.436467677f},
-std::array<float,2>{0.646132052f, 0.684378803f},
-std::array<float,2>{0.63537544f, 0.233451068f},
-std::array<float,2>{0.0464101881f, 0.821218133f},
-std::array<float,2>{0.45114851f, 0.389317214f},
-std::array<float,2>{0.83385551f, 0.654295504f},
-std::array<float,2>{0.973603189f, 0.295118362f},
-std::array<float,2>{0.307469726f, 0.504143059f},
-std::array<float,2>{0.186652571f, 0.0690036714f},
-std::array<float,2>{0.536148548f, 0.974565983f},
-std::array<float,2>{0.586059809f, 0.485040277f},
-std::array<float,2>{0.188155606f, 0.721934557f},
-std::array<float,2>{0.34515509f, 0.129951075f},
-std::array<float,2>{0.910482347f, 0.788788378f},
-std::array<float,2>{0.752895296f, 0.0332684629f},
-std::array<float,2>{0.43546477f, 0.896175027f},
-std::array<float,2>{0.0907260403f, 0.369132757f},
-std::array<float,2>{0.743969619f, 0.614478827f},
-std::array<float,2>{0.525632739f, 0.104273066f},
-std::array<float,2>{0.131098524f, 0.945942581f},
-std::array<float,2>{0.263811409f, 0.250299931f},
-std::array<float,2>{0.948746622f, 0.532786191f},
-std::array<float,2>{0.872728705f, 0.418274373f},
-std::array<float,2>{0.481878698f, 0.667281985f},
-std::array<float,2>{0.0205935817f, 0.206813335f},
-std::array<float,2>{0.656830251f, 0.870211303f},
-std::array<float,2>{0.713370442f, 0.32159552f},
-std::array<float,2>{0.0992762446f, 0.574287832f},
-std::array<float,2>{0.397467136f, 0.0179897919f},
-std::array<float,2>{0.787754714f, 0.923938453f},
-std::array<float,2>{0.89598304f, 0.15826419f},
-std::array<float,2>{0.315462172f, 0.752335727f},
-std::array<float,2>{0.220508292f, 0.441528589f},
-std::array<float,2>{0.600423932f, 0.705455184f},
-std::array<float,2>{0.579005241f, 0.240451515f},
-std::array<float,2>{0.197735146f, 0.83462131f},
-std::array<float,2>{0.358336836f, 0.397825897f},
-std::array<float,2>{0.917970479f, 0.638240576f},
-std::array<float,2>{0.759976864f, 0.303274095f},
-std::array<float,2>{0.425629139f, 0.51859957f},
-std::array<float,2>{0.083016485f, 0.0854648501f},
-std::array<float,2>{0.739644825f, 0.996239901f},
-std::array<float,2>{0.627116144f, 0.469982535f},
-std::array<float,2>{0.0348632075f, 0.748122871f},
-std::array<float,2>{0.441031545f, 0.141471401f},
-std::array<float,2>{0.842741847f, 0.812368989f},
-std::array<float,2>{0.982113481f, 0.0481564589f},
-std::array<float,2>{0.303358257f, 0.883683264f},
-std::array<float,2>{0.173630357f, 0.353248775f},
-std::array<float,2>{0.54481411f, 0.605010688f},
-std::array<float,2>{0.707657993f, 0.122762732f},
-std::array<float,2>{0.10550952f, 0.956240952f},
-std::array<float,2>{0.40397054f, 0.275601327f},
-std::array<float,2>{0.793692112f, 0.555521786f},
-std::array<float,2>{0.905614018f, 0.431023359f},
-std::array<float,2>{0.327677995f, 0.68272841f},
-std::array<float,2>{0.227363721f, 0.196799681f},
-std::array<float,2>{0.601931512f, 0.851791382f},
-std::array<float,2>{0.520563126f, 0.342991501f},
-std::array<float,2>{0.137142882f, 0.588529348f},
-std::array<float,2>{0.256628364f, 0.00865239277f},
-std::array<float,2>{0.944393933f, 0.915321589f},
-std::array<float,2>{0.862313271f, 0.174908563f},
-std::array<float,2>{0.473776162f, 0.778442681f},
-std::array<float,2>{0.0237059128f, 0.464568764f},
-std::array<float,2>{0.669671416f, 0.699957371f},
-std::array<float,2>{0.673279822f, 0.125339851f},
-std::array<float,2>{0.00806007162f, 0.78361994f},
-std::array<float,2>{0.485067993f, 0.489732921f},
-std::array<float,2>{0.851595223f, 0.724576056f},
-std::array<float,2>{0.955007374f, 0.374810666f},
-std::array<float,2>{0.270635486f, 0.60939759f},
-std::array<float,2>{0.14178142f, 0.0352486968f},
-std::array<float,2>{0.505849183f, 0.892194211f},
-std::array<float,2>{0.617907882f, 0.386197895f},
-std::array<float,2>{0.234687135f, 0.651197135f},
-std::array<float,2>{0.332512319f, 0.227271184f},
-std::array<float,2>{0.888332963f, 0.82441169f},
-std::array<float,2>{0.798196435f, 0.0657090694f},
-std::array<float,2>{0.379882634f, 0.97249341f},
-std::array<float,2>{0.109626174f, 0.290778846f},
-std::array<float,2>{0.693142772f, 0.500803649f},
-std::array<float,2>{0.561099112f, 0.0202212669f},
-std::array<float,2>{0.171266854f, 0.929386199f},
-std::array<float,2>{0.290684104f, 0.324392825f},
-std::array<float,2>{0.993108511f, 0.572116911f},
-std::array<float,2>{0.812930107f, 0.441372126f},
-std::array<float,2>{0.468183815f, 0.707279801f},
-std::array<float,2>{0.0595237575f, 0.161206275f},
-std::array<float,2>{0.655951142f, 0.754408121f},
-std::array<float,2>{0.722374976f, 0.255534023f},
-std::array<float,2>{0.0760713369f, 0.535945415f},
-std::array<float,2>{0.410738915f, 0.106772706f},
-std::array<float,2>{0.769102335f, 0.950446427f},
-std::array<float,2>{0.931700528f, 0.21020022f},
-std::array<float,2>{0.366898149f, 0.872782707f},
-std::array<float,2>{0.216416061f, 0.414544523f},
-std::array<float,2>{0.569274426f, 0.669140279f},
-std::array<float,2>{0.508306086f, 0.170489341f},
-std::array<float,2>{0.153635815f, 0.760101557f},
-std::array<float,2>{0.274173915f, 0.450131655f},
-std::array<float,2>{0.966236413f, 0.71851176f},
-std::array<float,2>{0.850569129f, 0.316979498f},
-std::array<float,2>{0.495536745f, 0.564465523f},
-std::array<float,2>{0.00430364534f, 0.0284559131f},
-std::array<float,2>{0.684165359f, 0.936093092f},
-std::array<float,2>{0.698926806f, 0.407355189f},
-std::array<float,2>{0.124821059f, 0.661280155f},
-std::array<float,2>{0.383575678f, 0.212991551f},
-std::array<float,2>{0.807055354f, 0.866490304f},
-std::array<float,2>{0.875356257f, 0.101476975f},
-std::array<float,2>{0.336120933f, 0.942612708f},
-std::array<float,2>{0.248175249f, 0.26341939f},
-std::array<float,2>{0.609997571f, 0.544079483f},
-std::array<float,2>{0.643807828f, 0.0430386625f},
-std::array<float,2>{0.0523152649f, 0.905270398f},
-std::array<float,2>{0.455333859f, 0.360106885f},
-std::array<float,2>{0.827939391f, 0.623211741f},
-std::array<float,2>{0.984506845f, 0.497321814f},
-std::array<float,2>{0.28675577f, 0.731909871f},
-std::array<float,2>{0.159790084f, 0.134057477f},
-std::array<float,2>{0.554127157f, 0.795984805f},
-std::array<float,2>{0.571224689f, 0.28691414f},
-std::array<float,2>{0.20531562f, 0.508147717f},
-std::array<float,2>{0.371247292f, 0.0741717145f},
-std::array<float,2>{0.92317611f, 0.983453155f},
-std::array<float,2>{0.776447594f, 0.219896957f},
-std::array<float,2>{0.419631422f, 0.812824786f},
-std::array<float,2>{0.0656034127f, 0.37878561f},
-std::array<float,2>{0.730680466f, 0.646000981f},
-std::array<float,2>{0.74715656f, 0.189049333f},
-std::array<float,2>{0.0869516134f, 0.85153687f},
-std::array<float,2>{0.431608558f, 0.429046094f},
-std::array<float,2>{0.756439269f, 0.677478075f},
-std::array<float,2>{0.908126354f, 0.272646844f},
-std::array<float,2>{0.350718021f, 0.550354183f},
-std::array<float,2>{0.19428128f, 0.110408396f},
-std::array<float,2>{0.590756714f, 0.967264533f},
-std::array<float,2>{0.533507049f, 0.459257364f},
-std::array<float,2>{0.181013018f, 0.690760434f},
-std::array<float,2>{0.311531693f, 0.183597058f},
-std::array<float,2>{0.971473813f, 0.770419478f},
-std::array<float,2>{0.830136657f, 7.36739025e-07f},
-std::array<float,2>{0.446571559f, 0.906553209f},
-std::array<float,2>{0.0405308232f, 0.334082335f},
-std::array<float,2>{0.638663232f, 0.584849f},
-std::array<float,2>{0.59597528f, 0.0865997672f},
-std::array<float,2>{0.225281492f, 0.986123443f},
-std::array<float,2>{0.316983312f, 0.30719471f},
-std::array<float,2>{0.892322063f, 0.528902888f},
-std::array<float,2>{0.783113062f, 0.40352729f},
-std::array<float,2>{0.39314121f, 0.632320642f},
-std::array<float,2>{0.0959310904f, 0.247745126f},
-std::array<float,2>{0.717286348f, 0.840903521f},
-std::array<float,2>{0.663469732f, 0.350959957f},
-std::array<float,2>{0.0184884015f, 0.600988865f},
-std::array<float,2>{0.478830636f, 0.0598170385f},
-std::array<float,2>{0.868219316f, 0.881897807f},
-std::array<float,2>{0.950505793f, 0.153952539f},
-std::array<float,2>{0.261449665f, 0.79805088f},
-std::array<float,2>{0.125938103f, 0.481073081f},
-std::array<float,2>{0.529454887f, 0.736356199f},
-std::array<float,2>{0.536727786f, 0.231015608f},
-std::array<float,2>{0.187214807f, 0.823091388f},
-std::array<float,2>{0.306653291f, 0.387129664f},
-std::array<float,2>{0.972916365f, 0.654419601f},
-std::array<float,2>{0.833265424f, 0.294132292f},
-std::array<float,2>{0.450345159f, 0.506269991f},
-std::array<float,2>{0.0459164977f, 0.0670728609f},
-std::array<float,2>{0.634854555f, 0.974853098f},
-std::array<float,2>{0.74343133f, 0.486947387f},
-std::array<float,2>{0.0899050832f, 0.71924293f},
-std::array<float,2>{0.434879571f, 0.132577226f},
-std::array<float,2>{0.7520594f, 0.785846651f},
-std::array<float,2>{0.910667062f, 0.032546401f},
-std::array<float,2>{0.345374376f, 0.897166491f},
-std::array<float,2>{0.187942907f, 0.369269907f},
-std::array<float,2>{0.586525202f, 0.615451038f},
-std::array<float,2>{0.656408787f, 0.103103533f},
-std::array<float,2>{0.0213559996f, 0.94764179f},
-std::array<float,2>{0.482048362f, 0.252711505f},
-std::array<float,2>{0.872310996f, 0.5335899f},
-std::array<float,2>{0.948572159f, 0.421577096f},
-std::array<float,2>{0.264246762f, 0.664718509f},
-std::array<float,2>{0.131612211f, 0.204625949f},
-std::array<float,2>{0.525935709f, 0.867301702f},
-std::array<float,2>{0.599879861f, 0.323082775f},
-std::array<float,2>{0.220051199f, 0.577758551f},
-std::array<float,2>{0.31625393f, 0.0171638615f},
-std::array<float,2>{0.896350205f, 0.922606587f},
-std::array<float,2>{0.787589014f, 0.156435728f},
-std::array<float,2>{0.398138821f, 0.750849366f},
-std::array<float,2>{0.0987143144f, 0.443426281f},
-std::array<float,2>{0.713489115f, 0.704082072f},
-std::array<float,2>{0.700391054f, 0.146486044f},
-std::array<float,2>{0.11722026f, 0.80487752f},
-std::array<float,2>{0.39040482f, 0.475439727f},
-std::array<float,2>{0.809524596f, 0.743419945f},
-std::array<float,2>{0.880684376f, 0.355504036f},
-std::array<float,2>{0.341438293f, 0.606040001f},
-std::array<float,2>{0.244952112f, 0.0531504266f},
-std::array<float,2>{0.614096522f, 0.887755692f},
-std::array<float,2>{0.51427424f, 0.391326219f},
-std::array<float,2>{0.150680676f, 0.63550514f},
-std::array<float,2>{0.279981852f, 0.237965614f},
-std::array<float,2>{0.964630961f, 0.83105886f},
-std::array<float,2>{0.845539212f, 0.0802307129f},
-std::array<float,2>{0.498488426f, 0.994419217f},
-std::array<float,2>{0.0020589286f, 0.299571246f},
-std::array<float,2>{0.679706395f, 0.520749152f},
-std::array<float,2>{0.577659428f, 0.0134211555f},
-std::array<float,2>{0.207864821f, 0.919019401f},
-std::array<float,2>{0.370556056f, 0.338183373f},
-std::array<float,2>{0.926262975f, 0.593148172f},
-std::array<float,2>{0.778288841f, 0.468683332f},
-std::array<float,2>{0.415132552f, 0.6953215f},
-std::array<float,2>{0.0694370344f, 0.17800118f},
-std::array<float,2>{0.729949474f, 0.775416732f},
-std::array<float,2>{0.645626903f, 0.279947549f},
-std::array<float,2>{0.0485943072f, 0.558662713f},
-std::array<float,2>{0.458662331f, 0.119534299f},
-std::array<float,2>{0.823125839f, 0.959046721f},
-std::array<float,2>{0.990246534f, 0.20219712f},
-std::array<float,2>{0.283979595f, 0.85687691f},
-std::array<float,2>{0.160677478f, 0.434466422f},
-std::array<float,2>{0.550504923f, 0.686900616f},
-std::array<float,2>{0.624148488f, 0.181754008f},
-std::array<float,2>{0.239045724f, 0.767735183f},
-std::array<float,2>{0.331242293f, 0.454122216f},
-std::array<float,2>{0.884110868f, 0.692300737f},
-std::array<float,2>{0.802975535f, 0.331101805f},
-std::array<float,2>{0.376398325f, 0.58188659f},
-std::array<float,2>{0.113898948f, 0.00725179398f},
-std::array<float,2>{0.690968394f, 0.910964489f},
-std::array<float,2>{0.676891625f, 0.423078001f},
-std::array<float,2>{0.0152428262f, 0.675765514f},
-std::array<float,2>{0.491466224f, 0.194178477f},
-std::array<float,2>{0.859260321f, 0.845541835f},
-std::array<float,2>{0.958885372f, 0.116152935f},
-std::array<float,2>{0.268051952f, 0.962416351f},
-std::array<float,2>{0.146851495f, 0.266814768f},
-std::array<float,2>{0.502287209f, 0.552179039f},
-std::array<float,2>{0.725486636f, 0.0576670058f},
-std::array<float,2>{0.0709973648f, 0.876355112f},
-std::array<float,2>{0.408513993f, 0.346120656f},
-std::array<float,2>{0.770371854f, 0.593855798f},
-std::array<float,2>{0.935864329f, 0.479240745f},
-std::array<float,2>{0.361418575f, 0.739763319f},
-std::array<float,2>{0.213156089f, 0.149461165f},
-std::array<float,2>{0.565595627f, 0.801841915f},
-std::array<float,2>{0.555278897f, 0.311941415f},
-std::array<float,2>{0.16411829f, 0.524627268f},
-std::array<float,2>{0.294218689f, 0.0927715898f},
-std::array<float,2>{0.99730128f, 0.988392293f},
-std::array<float,2>{0.8178913f, 0.243741021f},
-std::array<float,2>{0.460992157f, 0.837239444f},
-std::array<float,2>{0.0575994626f, 0.399210125f},
-std::array<float,2>{0.650563478f, 0.625936031f},
-std::array<float,2>{0.63091433f, 0.217813328f},
-std::array<float,2>{0.0353984684f, 0.863028646f},
-std::array<float,2>{0.44171387f, 0.411525279f},
-std::array<float,2>{0.838219106f, 0.656324923f},
-std::array<float,2>{0.978865445f, 0.26147595f},
-std::array<float,2>{0.299580902f, 0.539887905f},
-std::array<float,2>{0.177792594f, 0.09750209f},
-std::array<float,2>{0.539975941f, 0.938277602f},
-std::array<float,2>{0.582664847f, 0.445870727f},
-std::array<float,2>{0.201884344f, 0.712041616f},
-std::array<float,2>{0.354828656f, 0.167008787f},
-std::array<float,2>{0.914941788f, 0.764843643f},
-std::array<float,2>{0.762101173f, 0.0245669875f},
-std::array<float,2>{0.427078187f, 0.931863964f},
-std::array<float,2>{0.0818521678f, 0.315022051f},
-std::array<float,2>{0.736924171f, 0.569908082f},
-std::array<float,2>{0.518524945f, 0.0767720863f},
-std::array<float,2>{0.136477321f, 0.976654053f},
-std::array<float,2>{0.25225091f, 0.282559186f},
-std::array<float,2>{0.938178778f, 0.511899889f},
-std::array<float,2>{0.863505125f, 0.382810056f},
-std::array<float,2>{0.47200051f, 0.643585324f},
-std::array<float,2>{0.0311040003f, 0.222948104f},
-std::array<float,2>{0.665861309f, 0.820197344f},
-std::array<float,2>{0.703779995f, 0.366585135f},
-std::array<float,2>{0.104087412f, 0.620503485f},
-std::array<float,2>{0.400385022f, 0.042485062f},
-std::array<float,2>{0.791803598f, 0.899788499f},
-std::array<float,2>{0.90196681f, 0.13699697f},
-std::array<float,2>{0.322336316f, 0.790811241f},
-std::array<float,2>{0.230984032f, 0.495555282f},
-std::array<float,2>{0.606800377f, 0.726615965f},
-std::array<float,2>{0.590086639f, 0.191264585f},
-std::array<float,2>{0.193392143f, 0.848965168f},
-std::array<float,2>{0.351475894f, 0.427511841f},
-std::array<float,2>{0.907412648f, 0.679009199f},
-std::array<float,2>{0.756084561f, 0.27117756f},
-std::array<float,2>{0.430889398f, 0.548435986f},
-std::array<float,2>{0.087553069f, 0.111708418f},
-std::array<float,2>{0.747989058f, 0.964900434f},
-std::array<float,2>{0.637905836f, 0.457649559f},
-std::array<float,2>{0.0402500294f, 0.688695371f},
-std::array<float,2>{0.447137713f, 0.186942115f},
-std::array<float,2>{0.830891728f, 0.772653759f},
-std::array<float,2>{0.971100986f, 0.00359197357f},
-std::array<float,2>{0.312141269f, 0.908712626f},
-std::array<float,2>{0.181443214f, 0.33366707f},
-std::array<float,2>{0.533773661f, 0.582752466f},
-std::array<float,2>{0.717119932f, 0.0880823582f},
-std::array<float,2>{0.0962195322f, 0.988188326f},
-std::array<float,2>{0.392818749f, 0.30547294f},
-std::array<float,2>{0.78232336f, 0.529959619f},
-std::array<float,2>{0.89174062f, 0.405601233f},
-std::array<float,2>{0.316882432f, 0.630387485f},
-std::array<float,2>{0.224635392f, 0.248075053f},
-std::array<float,2>{0.596226811f, 0.842233717f},
-std::array<float,2>{0.530238986f, 0.347831994f},
-std::array<float,2>{0.125202328f, 0.598195016f},
-std::array<float,2>{0.260757387f, 0.0611330718f},
-std::array<float,2>{0.950900853f, 0.87928462f},
-std::array<float,2>{0.868743658f, 0.155056953f},
-std::array<float,2>{0.479331672f, 0.80047071f},
-std::array<float,2>{0.0178740341f, 0.483036786f},
-std::array<float,2>{0.663763225f, 0.734694839f},
-std::array<float,2>{0.68373841f, 0.169071764f},
-std::array<float,2>{0.00481744716f, 0.758736014f},
-std::array<float,2>{0.495976269f, 0.451912373f},
-std::array<float,2>{0.849909604f, 0.71491003f},
-std::array<float,2>{0.966461957f, 0.320280522f},
-std::array<float,2>{0.273658484f, 0.564022005f},
-std::array<float,2>{0.154150769f, 0.0294383503f},
-std::array<float,2>{0.50785619f, 0.933993757f},
-std::array<float,2>{0.609591782f, 0.409243643f},
-std::array<float,2>{0.248745307f, 0.662609458f},
-std::array<float,2>{0.336866081f, 0.211825594f},
-std::array<float,2>{0.875954509f, 0.864661634f},
-std::array<float,2>{0.807434261f, 0.0994186625f},
-std::array<float,2>{0.383008569f, 0.944172025f},
-std::array<float,2>{0.124332421f, 0.265429288f},
-std::array<float,2>{0.698576629f, 0.546124279f},
-std::array<float,2>{0.55455029f, 0.046408724f},
-std::array<float,2>{0.15935792f, 0.903095901f},
-std::array<float,2>{0.286398202f, 0.36297074f},
-std::array<float,2>{0.985248744f, 0.621828675f},
-std::array<float,2>{0.827191412f, 0.499264747f},
-std::array<float,2>{0.455913484f, 0.734156549f},
-std::array<float,2>{0.051928062f, 0.136045158f},
-std::array<float,2>{0.644390821f, 0.794627666f},
-std::array<float,2>{0.731129944f, 0.287882507f},
-std::array<float,2>{0.0660202801f, 0.511261821f},
-std::array<float,2>{0.418967634f, 0.0719734952f},
-std::array<float,2>{0.776894391f, 0.98239249f},
-std::array<float,2>{0.923818231f, 0.222450614f},
-std::array<float,2>{0.371817559f, 0.815950215f},
-std::array<float,2>{0.205570295f, 0.376710504f},
-std::array<float,2>{0.57056272f, 0.646561265f},
-std::array<float,2>{0.505010307f, 0.127495512f},
-std::array<float,2>{0.142563224f, 0.781343281f},
-std::array<float,2>{0.271267027f, 0.490857959f},
-std::array<float,2>{0.954396307f, 0.725005448f},
-std::array<float,2>{0.852097273f, 0.372495264f},
-std::array<float,2>{0.484831691f, 0.611797273f},
-std::array<float,2>{0.00845434796f, 0.0372962989f},
-std::array<float,2>{0.673423588f, 0.894179642f},
-std::array<float,2>{0.692775011f, 0.383783311f},
-std::array<float,2>{0.109969087f, 0.648914337f},
-std::array<float,2>{0.379372597f, 0.228927717f},
-std::array<float,2>{0.798492253f, 0.827763975f},
-std::array<float,2>{0.888004005f, 0.0629219115f},
-std::array<float,2>{0.33252573f, 0.970094919f},
-std::array<float,2>{0.235266283f, 0.29286316f},
-std::array<float,2>{0.617270291f, 0.502250135f},
-std::array<float,2>{0.655708909f, 0.0233059488f},
-std::array<float,2>{0.0587568358f, 0.926746309f},
-std::array<float,2>{0.468660682f, 0.326414883f},
-std::array<float,2>{0.813452423f, 0.57400012f},
-std::array<float,2>{0.992644131f, 0.438997984f},
-std::array<float,2>{0.290193886f, 0.709595859f},
-std::array<float,2>{0.171401352f, 0.16347082f},
-std::array<float,2>{0.560962737f, 0.756559491f},
-std::array<float,2>{0.568490624f, 0.256315649f},
-std::array<float,2>{0.215947583f, 0.537622333f},
-std::array<float,2>{0.366475254f, 0.108460806f},
-std::array<float,2>{0.93240422f, 0.952518225f},
-std::array<float,2>{0.768709898f, 0.208757102f},
-std::array<float,2>{0.410471976f, 0.873606324f},
-std::array<float,2>{0.0754946619f, 0.416784436f},
-std::array<float,2>{0.721861839f, 0.671036601f},
-std::array<float,2>{0.739994049f, 0.240055487f},
-std::array<float,2>{0.0836709738f, 0.833073616f},
-std::array<float,2>{0.424834192f, 0.395371974f},
-std::array<float,2>{0.760292411f, 0.640554011f},
-std::array<float,2>{0.918848157f, 0.301900208f},
-std::array<float,2>{0.357632846f, 0.517374516f},
-std::array<float,2>{0.197843879f, 0.0824219361f},
-std::array<float,2>{0.578413367f, 0.998978019f},
-std::array<float,2>{0.54404074f, 0.472254485f},
-std::array<float,2>{0.173321202f, 0.747636437f},
-std::array<float,2>{0.30314216f, 0.143249646f},
-std::array<float,2>{0.981745183f, 0.808754504f},
-std::array<float,2>{0.841809273f, 0.050051596f},
-std::array<float,2>{0.440458149f, 0.885496557f},
-std::array<float,2>{0.0342047624f, 0.355340719f},
-std::array<float,2>{0.627810538f, 0.602361143f},
-std::array<float,2>{0.602215111f, 0.123398729f},
-std::array<float,2>{0.226701573f, 0.953616321f},
-std::array<float,2>{0.327524185f, 0.274253339f},
-std::array<float,2>{0.905816674f, 0.557849586f},
-std::array<float,2>{0.793421805f, 0.431793869f},
-std::array<float,2>{0.403480858f, 0.680414438f},
-std::array<float,2>{0.106226288f, 0.198114559f},
-std::array<float,2>{0.707431972f, 0.854987323f},
-std::array<float,2>{0.669048488f, 0.341401011f},
-std::array<float,2>{0.0239320882f, 0.586360931f},
-std::array<float,2>{0.474280506f, 0.0105698351f},
-std::array<float,2>{0.863158703f, 0.91673702f},
-std::array<float,2>{0.944898427f, 0.173822358f},
-std::array<float,2>{0.256002635f, 0.779506803f},
-std::array<float,2>{0.137325883f, 0.46131444f},
-std::array<float,2>{0.521373689f, 0.701507747f},
-std::array<float,2>{0.524877429f, 0.206089899f},
-std::array<float,2>{0.129719779f, 0.87064451f},
-std::array<float,2>{0.263460815f, 0.418609738f},
-std::array<float,2>{0.946116745f, 0.667736411f},
-std::array<float,2>{0.873293996f, 0.250907034f},
-std::array<float,2>{0.482844174f, 0.532421112f},
-std::array<float,2>{0.0218357649f, 0.103810094f},
-std::array<float,2>{0.659694374f, 0.945533156f},
-std::array<float,2>{0.711597681f, 0.442379355f},
-std::array<float,2>{0.100181602f, 0.70599854f},
-std::array<float,2>{0.394544959f, 0.159011051f},
-std::array<float,2>{0.787097037f, 0.75278312f},
-std::array<float,2>{0.897404552f, 0.0182397254f},
-std::array<float,2>{0.313661277f, 0.924405873f},
-std::array<float,2>{0.222509235f, 0.322072983f},
-std::array<float,2>{0.597975492f, 0.57482022f},
-std::array<float,2>{0.633688569f, 0.0686886236f},
-std::array<float,2>{0.0441076867f, 0.973856091f},
-std::array<float,2>{0.452329159f, 0.295440465f},
-std::array<float,2>{0.834260225f, 0.504816771f},
-std::array<float,2>{0.975847125f, 0.389156491f},
-std::array<float,2>{0.305782825f, 0.65345341f},
-std::array<float,2>{0.183781013f, 0.234359786f},
-std::array<float,2>{0.538610995f, 0.820356071f},
-std::array<float,2>{0.589539647f, 0.368604511f},
-std::array<float,2>{0.190792516f, 0.614880681f},
-std::array<float,2>{0.347221673f, 0.0341676399f},
-std::array<float,2>{0.913732648f, 0.895838976f},
-std::array<float,2>{0.750529349f, 0.130713105f},
-std::array<float,2>{0.436956257f, 0.788455188f},
-std::array<float,2>{0.092117615f, 0.48442924f},
-std::array<float,2>{0.745371044f, 0.722425699f},
-std::array<float,2>{0.726748288f, 0.176085696f},
-std::array<float,2>{0.0679323822f, 0.773571491f},
-std::array<float,2>{0.417378157f, 0.465702653f},
-std::array<float,2>{0.780788541f, 0.69813329f},
-std::array<float,2>{0.928736746f, 0.336694479f},
-std::array<float,2>{0.369029909f, 0.590705395f},
-std::array<float,2>{0.209057584f, 0.0142045924f},
-std::array<float,2>{0.574976861f, 0.920862079f},
-std::array<float,2>{0.547332644f, 0.435901731f},
-std::array<float,2>{0.162711382f, 0.683709145f},
-std::array<float,2>{0.282945991f, 0.200787038f},
-std::array<float,2>{0.98916316f, 0.858621061f},
-std::array<float,2>{0.821246028f, 0.117715269f},
-std::array<float,2>{0.459084392f, 0.95828563f},
-std::array<float,2>{0.0492348745f, 0.278785139f},
-std::array<float,2>{0.648199618f, 0.561205268f},
-std::array<float,2>{0.616696894f, 0.0527134836f},
-std::array<float,2>{0.243160546f, 0.888904095f},
-std::array<float,2>{0.343166143f, 0.359168142f},
-std::array<float,2>{0.882528126f, 0.607724249f},
-std::array<float,2>{0.811716914f, 0.473369122f},
-std::array<float,2>{0.387695462f, 0.744587898f},
-std::array<float,2>{0.119840384f, 0.145543113f},
-std::array<float,2>{0.702211022f, 0.80845046f},
-std::array<float,2>{0.681724966f, 0.298312932f},
-std::array<float,2>{0.00173947215f, 0.522892296f},
-std::array<float,2>{0.497664332f, 0.0790114403f},
-std::array<float,2>{0.847394109f, 0.993331194f},
-std::array<float,2>{0.962249637f, 0.23631154f},
-std::array<float,2>{0.279295892f, 0.828605175f},
-std::array<float,2>{0.148530379f, 0.394179851f},
-std::array<float,2>{0.512206018f, 0.633521199f},
-std::array<float,2>{0.562961161f, 0.150759593f},
-std::array<float,2>{0.212037727f, 0.803774714f},
-std::array<float,2>{0.359637588f, 0.477779359f},
-std::array<float,2>{0.934095442f, 0.741205752f},
-std::array<float,2>{0.772478521f, 0.344507664f},
-std::array<float,2>{0.407610625f, 0.596583486f},
-std::array<float,2>{0.0736327842f, 0.0559599064f},
-std::array<float,2>{0.723330259f, 0.877039671f},
-std::array<float,2>{0.649977148f, 0.400642037f},
-std::array<float,2>{0.0557266995f, 0.628372908f},
-std::array<float,2>{0.464220881f, 0.245813578f},
-std::array<float,2>{0.818803906f, 0.838311553f},
-std::array<float,2>{0.999334455f, 0.0915571153f},
-std::array<float,2>{0.295848578f, 0.990575671f},
-std::array<float,2>{0.167065069f, 0.308892846f},
-std::array<float,2>{0.558469236f, 0.526775658f},
-std::array<float,2>{0.689176857f, 0.00579394028f},
-std::array<float,2>{0.116343558f, 0.912263334f},
-std::array<float,2>{0.378100723f, 0.329794079f},
-std::array<float,2>{0.801485062f, 0.579654574f},
-std::array<float,2>{0.884876549f, 0.456848085f},
-std::array<float,2>{0.329091847f, 0.693730414f},
-std::array<float,2>{0.241833776f, 0.181372687f},
-std::array<float,2>{0.621446729f, 0.766344011f},
-std::array<float,2>{0.500760376f, 0.269118816f},
-std::array<float,2>{0.144626379f, 0.553895891f},
-std::array<float,2>{0.266159058f, 0.114087515f},
-std::array<float,2>{0.959105611f, 0.964273632f},
-std::array<float,2>{0.85610801f, 0.191811398f},
-std::array<float,2>{0.488883048f, 0.847637057f},
-std::array<float,2>{0.0126216561f, 0.425619364f},
-std::array<float,2>{0.678941905f, 0.672834337f},
-std::array<float,2>{0.667639732f, 0.225450069f},
-std::array<float,2>{0.0282519422f, 0.818145633f},
-std::array<float,2>{0.470504701f, 0.379354388f},
-std::array<float,2>{0.866675019f, 0.640847027f},
-std::array<float,2>{0.940309584f, 0.28354755f},
-std::array<float,2>{0.25048998f, 0.514499784f},
-std::array<float,2>{0.133469999f, 0.0753970966f},
-std::array<float,2>{0.517185271f, 0.979719579f},
-std::array<float,2>{0.608533859f, 0.492304683f},
-std::array<float,2>{0.233616143f, 0.728964031f},
-std::array<float,2>{0.321038723f, 0.139201179f},
-std::array<float,2>{0.898703039f, 0.792141676f},
-std::array<float,2>{0.789485872f, 0.0407681838f},
-std::array<float,2>{0.401980698f, 0.900466084f},
-std::array<float,2>{0.102865539f, 0.363858342f},
-std::array<float,2>{0.70528692f, 0.617253423f},
-std::array<float,2>{0.541819036f, 0.0944226384f},
-std::array<float,2>{0.177514404f, 0.940424383f},
-std::array<float,2>{0.297426909f, 0.258328199f},
-std::array<float,2>{0.977941334f, 0.542416275f},
-std::array<float,2>{0.837094069f, 0.413274616f},
-std::array<float,2>{0.443974376f, 0.659259975f},
-std::array<float,2>{0.0376945399f, 0.21503742f},
-std::array<float,2>{0.629457295f, 0.859705031f},
-std::array<float,2>{0.734438121f, 0.313043803f},
-std::array<float,2>{0.0799274221f, 0.566816509f},
-std::array<float,2>{0.428670168f, 0.026669668f},
-std::array<float,2>{0.764985859f, 0.929904819f},
-std::array<float,2>{0.916285932f, 0.164287195f},
-std::array<float,2>{0.351750791f, 0.762860358f},
-std::array<float,2>{0.20037204f, 0.448896229f},
-std::array<float,2>{0.585818231f, 0.713255703f},
-std::array<float,2>{0.595007718f, 0.247446582f},
-std::array<float,2>{0.22404331f, 0.841553867f},
-std::array<float,2>{0.319601327f, 0.404157311f},
-std::array<float,2>{0.894423664f, 0.63236022f},
-std::array<float,2>{0.784914255f, 0.307106376f},
-std::array<float,2>{0.392238885f, 0.52848196f},
-std::array<float,2>{0.0952672958f, 0.086293228f},
-std::array<float,2>{0.716133356f, 0.985701025f},
-std::array<float,2>{0.660322368f, 0.480475456f},
-std::array<float,2>{0.0174705945f, 0.737030864f},
-std::array<float,2>{0.478440106f, 0.153565094f},
-std::array<float,2>{0.870456457f, 0.798522055f},
-std::array<float,2>{0.952778339f, 0.060441792f},
-std::array<float,2>{0.259572059f, 0.882774591f},
-std::array<float,2>{0.127127156f, 0.351183951f},
-std::array<float,2>{0.528726041f, 0.601497352f},
-std::array<float,2>{0.74880439f, 0.111129798f},
-std::array<float,2>{0.0886593908f, 0.967751265f},
-std::array<float,2>{0.433069825f, 0.273239553f},
-std::array<float,2>{0.75573349f, 0.550203741f},
-std::array<float,2>{0.909820378f, 0.429237843f},
-std::array<float,2>{0.3487975f, 0.676799476f},
-std::array<float,2>{0.192080021f, 0.188902363f},
-std::array<float,2>{0.592905045f, 0.851057529f},
-std::array<float,2>{0.532062411f, 0.334668666f},
-std::array<float,2>{0.183487698f, 0.584205091f},
-std::array<float,2>{0.309167325f, 0.000775454391f},
-std::array<float,2>{0.969182134f, 0.906804919f},
-std::array<float,2>{0.828320861f, 0.184154883f},
-std::array<float,2>{0.449062675f, 0.769837558f},
-std::array<float,2>{0.0421189517f, 0.459794849f},
-std::array<float,2>{0.639992237f, 0.691174448f},
-std::array<float,2>{0.640805781f, 0.134601489f},
-std::array<float,2>{0.053916458f, 0.796460688f},
-std::array<float,2>{0.453395069f, 0.497987628f},
-std::array<float,2>{0.82468617f, 0.732257009f},
-std::array<float,2>{0.986601472f, 0.359624803f},
-std::array<float,2>{0.287228554f, 0.623718202f},
-std::array<float,2>{0.156803638f, 0.0437206402f},
-std::array<float,2>{0.551892817f, 0.904706419f},
-std::array<float,2>{0.573249757f, 0.377999634f},
-std::array<float,2>{0.204054371f, 0.645539641f},
-std::array<float,2>{0.373445421f, 0.220472664f},
-std::array<float,2>{0.924880743f, 0.813101768f},
-std::array<float,2>{0.775022626f, 0.0733150244f},
-std::array<float,2>{0.420968026f, 0.984235644f},
-std::array<float,2>{0.063799873f, 0.286601782f},
-std::array<float,2>{0.734108329f, 0.508609474f},
-std::array<float,2>{0.511305213f, 0.0289954729f},
-std::array<float,2>{0.155228823f, 0.935784042f},
-std::array<float,2>{0.276503861f, 0.316768438f},
-std::array<float,2>{0.967333317f, 0.565028846f},
-std::array<float,2>{0.848155439f, 0.449446976f},
-std::array<float,2>{0.492465466f, 0.717828393f},
-std::array<float,2>{0.00766558899f, 0.170396417f},
-std::array<float,2>{0.685983479f, 0.760672867f},
-std::array<float,2>{0.697117448f, 0.263057262f},
-std::array<float,2>{0.122699566f, 0.544608831f},
-std::array<float,2>{0.385447472f, 0.100601658f},
-std::array<float,2>{0.805024326f, 0.943067729f},
-std::array<float,2>{0.878334105f, 0.213808909f},
-std::array<float,2>{0.338402659f, 0.867168903f},
-std::array<float,2>{0.247666419f, 0.408087015f},
-std::array<float,2>{0.612075984f, 0.661718547f},
-std::array<float,2>{0.560513735f, 0.161809579f},
-std::array<float,2>{0.169725716f, 0.753950655f},
-std::array<float,2>{0.291137964f, 0.440835327f},
-std::array<float,2>{0.995947778f, 0.707867444f},
-std::array<float,2>{0.814718187f, 0.324974388f},
-std::array<float,2>{0.466110885f, 0.571634889f},
-std::array<float,2>{0.0606630407f, 0.019890774f},
-std::array<float,2>{0.653743386f, 0.928899884f},
-std::array<float,2>{0.720456421f, 0.414778233f},
-std::array<float,2>{0.0765924156f, 0.669653177f},
-std::array<float,2>{0.412963063f, 0.210879013f},
-std::array<float,2>{0.766338229f, 0.872158706f},
-std::array<float,2>{0.931619167f, 0.107128762f},
-std::array<float,2>{0.365187287f, 0.951022148f},
-std::array<float,2>{0.217893943f, 0.25509274f},
-std::array<float,2>{0.567481637f, 0.53553766f},
-std::array<float,2>{0.674799919f, 0.0358863622f},
-std::array<float,2>{0.0106915133f, 0.891651273f},
-std::array<float,2>{0.486503303f, 0.374239087f},
-std::array<float,2>{0.85497117f, 0.610208809f},
-std::array<float,2>{0.956776202f, 0.489953339f},
-std::array<float,2>{0.27241239f, 0.723708332f},
-std::array<float,2>{0.143456846f, 0.125790372f},
-std::array<float,2>{0.506139636f, 0.783702135f},
-std::array<float,2>{0.619386375f, 0.290049016f},
-std::array<float,2>{0.237263128f, 0.500219584f},
-std::array<float,2>{0.334535003f, 0.0662587807f},
-std::array<float,2>{0.889096677f, 0.971906185f},
-std::array<float,2>{0.800393999f, 0.226754308f},
-std::array<float,2>{0.382021219f, 0.824747384f},
-std::array<float,2>{0.112871878f, 0.386248499f},
-std::array<float,2>{0.695150852f, 0.650755405f},
-std::array<float,2>{0.709250033f, 0.196734101f},
-std::array<float,2>{0.107838735f, 0.85253638f},
-std::array<float,2>{0.40498662f, 0.431543261f},
-std::array<float,2>{0.796739817f, 0.683519244f},
-std::array<float,2>{0.902445912f, 0.276109219f},
-std::array<float,2>{0.325006902f, 0.555033386f},
-std::array<float,2>{0.229686528f, 0.122080289f},
-std::array<float,2>{0.604929924f, 0.956801414f},
-std::array<float,2>{0.522349238f, 0.464058071f},
-std::array<float,2>{0.13934797f, 0.699536741f},
-std::array<float,2>{0.255427718f, 0.175407544f},
-std::array<float,2>{0.941911101f, 0.779194772f},
-std::array<float,2>{0.859718978f, 0.00792478863f},
-std::array<float,2>{0.476298928f, 0.91576308f},
-std::array<float,2>{0.0265812948f, 0.343529284f},
-std::array<float,2>{0.669993997f, 0.588300049f},
-std::array<float,2>{0.581496775f, 0.0851063579f},
-std::array<float,2>{0.195813194f, 0.996902883f},
-std::array<float,2>{0.357168525f, 0.302850872f},
-std::array<float,2>{0.920901954f, 0.519337118f},
-std::array<float,2>{0.758112192f, 0.397971928f},
-std::array<float,2>{0.423660219f, 0.637960792f},
-std::array<float,2>{0.0845651403f, 0.240843818f},
-std::array<float,2>{0.740634024f, 0.83438462f},
-std::array<float,2>{0.625836074f, 0.35280776f},
-std::array<float,2>{0.0313372277f, 0.604825616f},
-std::array<float,2>{0.438617855f, 0.048794128f},
-std::array<float,2>{0.840064526f, 0.882873774f},
-std::array<float,2>{0.984285116f, 0.141023755f},
-std::array<float,2>{0.301101267f, 0.811611891f},
-std::array<float,2>{0.174365416f, 0.470367551f},
-std::array<float,2>{0.545939505f, 0.748945773f},
-std::array<float,2>{0.512980223f, 0.236542806f},
-std::array<float,2>{0.149989262f, 0.830813289f},
-std::array<float,2>{0.27768591f, 0.391973346f},
-std::array<float,2>{0.96185416f, 0.636022508f},
-std::array<float,2>{0.846619666f, 0.300678194f},
-std::array<float,2>{0.49612686f, 0.51997596f},
-std::array<float,2>{0.000165847843f, 0.0817016289f},
-std::array<float,2>{0.683514237f, 0.995849013f},
-std::array<float,2>{0.701459885f, 0.475737453f},
-std::array<float,2>{0.12065386f, 0.742604852f},
-std::array<float,2>{0.387081981f, 0.147970244f},
-std::array<float,2>{0.810953498f, 0.805783629f},
-std::array<float,2>{0.881202579f, 0.0546402223f},
-std::array<float,2>{0.341921002f, 0.887019992f},
-std::array<float,2>{0.24345839f, 0.357001036f},
-std::array<float,2>{0.616008937f, 0.60698849f},
-std::array<float,2>{0.647209048f, 0.120286994f},
-std::array<float,2>{0.0499730706f, 0.960812032f},
-std::array<float,2>{0.460747898f, 0.281037211f},
-std::array<float,2>{0.82154125f, 0.560343385f},
-std::array<float,2>{0.989302278f, 0.435151607f},
-std::array<float,2>{0.282129526f, 0.685657084f},
-std::array<float,2>{0.163112476f, 0.20138824f},
-std::array<float,2>{0.548528314f, 0.856088579f},
-std::array<float,2>{0.575907409f, 0.339083642f},
-std::array<float,2>{0.210036382f, 0.592693031f},
-std::array<float,2>{0.3677935f, 0.0118069658f},
-std::array<float,2>{0.927936018f, 0.918762267f},
-std::array<float,2>{0.779388011f, 0.178943053f},
-std::array<float,2>{0.416170001f, 0.776602864f},
-std::array<float,2>{0.066484347f, 0.466971725f},
-std::array<float,2>{0.727571189f, 0.697068632f},
-std::array<float,2>{0.744188309f, 0.131583631f},
-std::array<float,2>{0.0934311152f, 0.786263824f},
-std::array<float,2>{0.436363518f, 0.487899572f},
-std::array<float,2>{0.751921296f, 0.719800353f},
-std::array<float,2>{0.912992358f, 0.370441228f},
-std::array<float,2>{0.345990211f, 0.617015004f},
-std::array<float,2>{0.190225288f, 0.0321696512f},
-std::array<float,2>{0.588242233f, 0.898257017f},
-std::array<float,2>{0.537840784f, 0.38796556f},
-std::array<float,2>{0.184999779f, 0.655504763f},
-std::array<float,2>{0.304798841f, 0.231903777f},
-std::array<float,2>{0.974877656f, 0.823730826f},
-std::array<float,2>{0.835271716f, 0.0679319426f},
-std::array<float,2>{0.451514274f, 0.975616992f},
-std::array<float,2>{0.0430876166f, 0.293860197f},
-std::array<float,2>{0.634493351f, 0.50712961f},
-std::array<float,2>{0.598767161f, 0.0161370467f},
-std::array<float,2>{0.220725626f, 0.923473001f},
-std::array<float,2>{0.312577486f, 0.324091613f},
-std::array<float,2>{0.897476435f, 0.57658875f},
-std::array<float,2>{0.785444677f, 0.444730192f},
-std::array<float,2>{0.396211147f, 0.705025017f},
-std::array<float,2>{0.101046652f, 0.157933965f},
-std::array<float,2>{0.712633312f, 0.751271248f},
-std::array<float,2>{0.65888387f, 0.253462613f},
-std::array<float,2>{0.0229386687f, 0.534448862f},
-std::array<float,2>{0.4841066f, 0.101686038f},
-std::array<float,2>{0.874376774f, 0.948304951f},
-std::array<float,2>{0.946812153f, 0.203527585f},
-std::array<float,2>{0.262335509f, 0.868603766f},
-std::array<float,2>{0.13026239f, 0.420039535f},
-std::array<float,2>{0.52359426f, 0.665547729f},
-std::array<float,2>{0.584759176f, 0.166942269f},
-std::array<float,2>{0.199549437f, 0.763773561f},
-std::array<float,2>{0.352539301f, 0.446841955f},
-std::array<float,2>{0.917891502f, 0.711215556f},
-std::array<float,2>{0.764635682f, 0.316193908f},
-std::array<float,2>{0.428913325f, 0.568704844f},
-std::array<float,2>{0.0781783685f, 0.0236431155f},
-std::array<float,2>{0.735966384f, 0.933134019f},
-std::array<float,2>{0.63046658f, 0.410874218f},
-std::array<float,2>{0.0387437157f, 0.657818973f},
-std::array<float,2>{0.444644958f, 0.216948554f},
-std::array<float,2>{0.836857975f, 0.861575544f},
-std::array<float,2>{0.977126539f, 0.0958010852f},
-std::array<float,2>{0.298467577f, 0.938540339f},
-std::array<float,2>{0.176150352f, 0.26060614f},
-std::array<float,2>{0.54296118f, 0.540713072f},
-std::array<float,2>{0.706920147f, 0.0419326872f},
-std::array<float,2>{0.10206876f, 0.898539484f},
-std::array<float,2>{0.401163846f, 0.365550429f},
-std::array<float,2>{0.79033947f, 0.619576454f},
-std::array<float,2>{0.899561107f, 0.49469921f},
-std::array<float,2>{0.322128534f, 0.728481472f},
-std::array<float,2>{0.233237103f, 0.137768105f},
-std::array<float,2>{0.607667506f, 0.789411306f},
-std::array<float,2>{0.515773475f, 0.281453133f},
-std::array<float,2>{0.1343714f, 0.513572514f},
-std::array<float,2>{0.250980914f, 0.0773470476f},
-std::array<float,2>{0.941128612f, 0.977909803f},
-std::array<float,2>{0.865981996f, 0.224555135f},
-std::array<float,2>{0.46887055f, 0.818732381f},
-std::array<float,2>{0.0289701745f, 0.381782115f},
-std::array<float,2>{0.666988969f, 0.642606676f},
-std::array<float,2>{0.678640068f, 0.194447517f},
-std::array<float,2>{0.0134372283f, 0.844451666f},
-std::array<float,2>{0.489417344f, 0.421946883f},
-std::array<float,2>{0.856915772f, 0.674073219f},
-std::array<float,2>{0.960522354f, 0.266216278f},
-std::array<float,2>{0.267120272f, 0.551496089f},
-std::array<float,2>{0.145913035f, 0.117024645f},
-std::array<float,2>{0.501220882f, 0.961282313f},
-std::array<float,2>{0.622703254f, 0.453264058f},
-std::array<float,2>{0.241096571f, 0.693236113f},
-std::array<float,2>{0.329317033f, 0.183354154f},
-std::array<float,2>{0.886597514f, 0.769147754f},
-std::array<float,2>{0.802604496f, 0.00621763198f},
-std::array<float,2>{0.377259851f, 0.911405385f},
-std::array<float,2>{0.115458556f, 0.330346107f},
-std::array<float,2>{0.687559903f, 0.58085084f},
-std::array<float,2>{0.556799233f, 0.0927766636f},
-std::array<float,2>{0.166937336f, 0.989290297f},
-std::array<float,2>{0.296040326f, 0.311415493f},
-std::array<float,2>{0.998559475f, 0.523989558f},
-std::array<float,2>{0.819403946f, 0.400139242f},
-std::array<float,2>{0.463696629f, 0.62653631f},
-std::array<float,2>{0.054895021f, 0.242789447f},
-std::array<float,2>{0.648749769f, 0.836621642f},
-std::array<float,2>{0.723885477f, 0.347302675f},
-std::array<float,2>{0.0730131641f, 0.595540464f},
-std::array<float,2>{0.406928331f, 0.0575951375f},
-std::array<float,2>{0.77244997f, 0.875595629f},
-std::array<float,2>{0.934740305f, 0.149250612f},
-std::array<float,2>{0.361241728f, 0.801341057f},
-std::array<float,2>{0.21130766f, 0.479678005f},
-std::array<float,2>{0.564256132f, 0.739020288f},
-std::array<float,2>{0.612669706f, 0.21232447f},
-std::array<float,2>{0.246757537f, 0.863745093f},
-std::array<float,2>{0.33909288f, 0.408387125f},
-std::array<float,2>{0.877467513f, 0.663725793f},
-std::array<float,2>{0.806002378f, 0.264461666f},
-std::array<float,2>{0.386056453f, 0.545769036f},
-std::array<float,2>{0.121220112f, 0.0980677903f},
-std::array<float,2>{0.695445001f, 0.944680572f},
-std::array<float,2>{0.687346816f, 0.452266812f},
-std::array<float,2>{0.00642649597f, 0.715904117f},
-std::array<float,2>{0.493413568f, 0.168444633f},
-std::array<float,2>{0.848661363f, 0.759616673f},
-std::array<float,2>{0.968213141f, 0.0308994427f},
-std::array<float,2>{0.276159644f, 0.935143054f},
-std::array<float,2>{0.155481532f, 0.318804473f},
-std::array<float,2>{0.510608435f, 0.563308299f},
-std::array<float,2>{0.733169138f, 0.0707414523f},
-std::array<float,2>{0.0628613159f, 0.981324732f},
-std::array<float,2>{0.420330673f, 0.288416445f},
-std::array<float,2>{0.773636043f, 0.510553837f},
-std::array<float,2>{0.92389518f, 0.375031561f},
-std::array<float,2>{0.374174476f, 0.648123801f},
-std::array<float,2>{0.204759687f, 0.221337512f},
-std::array<float,2>{0.573201835f, 0.815286398f},
-std::array<float,2>{0.551397979f, 0.361636341f},
-std::array<float,2>{0.158117115f, 0.622684062f},
-std::array<float,2>{0.288715661f, 0.0454413258f},
-std::array<float,2>{0.987472057f, 0.903532386f},
-std::array<float,2>{0.825872481f, 0.135211572f},
-std::array<float,2>{0.454182744f, 0.793488979f},
-std::array<float,2>{0.0527818613f, 0.499003083f},
-std::array<float,2>{0.642388701f, 0.733264804f},
-std::array<float,2>{0.639313281f, 0.18624112f},
-std::array<float,2>{0.0415207967f, 0.771604538f},
-std::array<float,2>{0.448083848f, 0.458798707f},
-std::array<float,2>{0.829594493f, 0.688165724f},
-std::array<float,2>{0.970690548f, 0.332202375f},
-std::array<float,2>{0.310462594f, 0.583210528f},
-std::array<float,2>{0.182399467f, 0.00228118571f},
-std::array<float,2>{0.53263253f, 0.909555912f},
-std::array<float,2>{0.59238106f, 0.426294625f},
-std::array<float,2>{0.192722961f, 0.677936792f},
-std::array<float,2>{0.347683519f, 0.190423235f},
-std::array<float,2>{0.908248603f, 0.848595619f},
-std::array<float,2>{0.754635394f, 0.112845913f},
-std::array<float,2>{0.432388663f, 0.966542304f},
-std::array<float,2>{0.0892647728f, 0.270347297f},
-std::array<float,2>{0.749532998f, 0.547035992f},
-std::array<float,2>{0.527451456f, 0.0616890118f},
-std::array<float,2>{0.128277555f, 0.880332708f},
-std::array<float,2>{0.25877589f, 0.348709702f},
-std::array<float,2>{0.95133394f, 0.598970294f},
-std::array<float,2>{0.869158387f, 0.483937889f},
-std::array<float,2>{0.477403671f, 0.736095428f},
-std::array<float,2>{0.0157084335f, 0.155998528f},
-std::array<float,2>{0.661622822f, 0.799788535f},
-std::array<float,2>{0.715315819f, 0.305921078f},
-std::array<float,2>{0.0944529995f, 0.530534625f},
-std::array<float,2>{0.390997201f, 0.089150764f},
-std::array<float,2>{0.783966184f, 0.986828506f},
-std::array<float,2>{0.893403292f, 0.249404147f},
-std::array<float,2>{0.318835437f, 0.843563378f},
-std::array<float,2>{0.223306611f, 0.405183852f},
-std::array<float,2>{0.59383601f, 0.629830897f},
-std::array<float,2>{0.545782447f, 0.14387469f},
-std::array<float,2>{0.175502002f, 0.810197949f},
-std::array<float,2>{0.302477419f, 0.470970958f},
-std::array<float,2>{0.982685924f, 0.746328473f},
-std::array<float,2>{0.841132104f, 0.35441649f},
-std::array<float,2>{0.437590688f, 0.603222013f},
-std::array<float,2>{0.0330582559f, 0.0493395105f},
-std::array<float,2>{0.626733065f, 0.886042535f},
-std::array<float,2>{0.741784811f, 0.396304786f},
-std::array<float,2>{0.0853814557f, 0.63951546f},
-std::array<float,2>{0.422478795f, 0.238453299f},
-std::array<float,2>{0.759536743f, 0.832307279f},
-std::array<float,2>{0.920340717f, 0.0837690756f},
-std::array<float,2>{0.355565578f, 0.999765038f},
-std::array<float,2>{0.197122142f, 0.301751226f},
-std::array<float,2>{0.580515265f, 0.516588569f},
-std::array<float,2>{0.671713054f, 0.0110170227f},
-std::array<float,2>{0.0254761502f, 0.91710484f},
-std::array<float,2>{0.47504428f, 0.340091765f},
-std::array<float,2>{0.860750437f, 0.587659299f},
-std::array<float,2>{0.942420304f, 0.462367743f},
-std::array<float,2>{0.254441828f, 0.703070402f},
-std::array<float,2>{0.139659524f, 0.172592252f},
-std::array<float,2>{0.522720575f, 0.780596614f},
-std::array<float,2>{0.603973687f, 0.274567306f},
-std::array<float,2>{0.229014993f, 0.557326615f},
-std::array<float,2>{0.326077551f, 0.124974705f},
-std::array<float,2>{0.903654933f, 0.95437789f},
-std::array<float,2>{0.795213282f, 0.199205294f},
-std::array<float,2>{0.405425102f, 0.853704512f},
-std::array<float,2>{0.108907111f, 0.433480859f},
-std::array<float,2>{0.710467577f, 0.681483746f},
-std::array<float,2>{0.694046378f, 0.230263859f},
-std::array<float,2>{0.111955732f, 0.826738f},
-std::array<float,2>{0.381406248f, 0.384645671f},
-std::array<float,2>{0.799388766f, 0.649691701f},
-std::array<float,2>{0.889730752f, 0.291128606f},
-std::array<float,2>{0.335048497f, 0.503564954f},
-std::array<float,2>{0.237840399f, 0.0638723001f},
-std::array<float,2>{0.620615065f, 0.968843818f},
-std::array<float,2>{0.507219672f, 0.492009789f},
-std::array<float,2>{0.144216567f, 0.726478279f},
-std::array<float,2>{0.27250737f, 0.128138214f},
-std::array<float,2>{0.955968916f, 0.78316164f},
-std::array<float,2>{0.853637338f, 0.0387488827f},
-std::array<float,2>{0.487673372f, 0.893552423f},
-std::array<float,2>{0.0113169914f, 0.371450841f},
-std::array<float,2>{0.674892664f, 0.612516403f},
-std::array<float,2>{0.566740394f, 0.108069003f},
-std::array<float,2>{0.217307255f, 0.951553643f},
-std::array<float,2>{0.363824576f, 0.257615507f},
-std::array<float,2>{0.930342853f, 0.5387851f},
-std::array<float,2>{0.766881227f, 0.417687625f},
-std::array<float,2>{0.413991541f, 0.670407116f},
-std::array<float,2>{0.077611044f, 0.207596466f},
-std::array<float,2>{0.719110191f, 0.874171078f},
-std::array<float,2>{0.652587771f, 0.327285975f},
-std::array<float,2>{0.0618866161f, 0.572945416f},
-std::array<float,2>{0.465761334f, 0.0221873131f},
-std::array<float,2>{0.816369593f, 0.927647948f},
-std::array<float,2>{0.995016158f, 0.162576124f},
-std::array<float,2>{0.292917967f, 0.756928563f},
-std::array<float,2>{0.168037161f, 0.437772989f},
-std::array<float,2>{0.558695555f, 0.710392356f},
-std::array<float,2>{0.549419641f, 0.200024843f},
-std::array<float,2>{0.161273047f, 0.858249605f},
-std::array<float,2>{0.28424564f, 0.437333226f},
-std::array<float,2>{0.991888463f, 0.685165763f},
-std::array<float,2>{0.824041605f, 0.277600616f},
-std::array<float,2>{0.457749248f, 0.561891735f},
-std::array<float,2>{0.0472103246f, 0.118655279f},
-std::array<float,2>{0.644574046f, 0.957846522f},
-std::array<float,2>{0.729118049f, 0.465872794f},
-std::array<float,2>{0.0684899464f, 0.698420227f},
-std::array<float,2>{0.41498825f, 0.177514076f},
-std::array<float,2>{0.778899014f, 0.775062203f},
-std::array<float,2>{0.926950514f, 0.0155656049f},
-std::array<float,2>{0.369876772f, 0.920939505f},
-std::array<float,2>{0.2081853f, 0.337040871f},
-std::array<float,2>{0.577024162f, 0.590825796f},
-std::array<float,2>{0.681379616f, 0.0796040967f},
-std::array<float,2>{0.00339337345f, 0.992230535f},
-std::array<float,2>{0.499290586f, 0.297670662f},
-std::array<float,2>{0.844326377f, 0.521753907f},
-std::array<float,2>{0.963058531f, 0.393364042f},
-std::array<float,2>{0.280960232f, 0.634111166f},
-std::array<float,2>{0.1522827f, 0.235075071f},
-std::array<float,2>{0.51495105f, 0.82984823f},
-std::array<float,2>{0.615173757f, 0.357926905f},
-std::array<float,2>{0.245838314f, 0.608712971f},
-std::array<float,2>{0.339943171f, 0.051270429f},
-std::array<float,2>{0.87898773f, 0.890471816f},
-std::array<float,2>{0.810398042f, 0.145323589f},
-std::array<float,2>{0.38874343f, 0.806940675f},
-std::array<float,2>{0.118835099f, 0.474275261f},
-std::array<float,2>{0.699632466f, 0.745444834f},
-std::array<float,2>{0.714490533f, 0.159881979f},
-std::array<float,2>{0.098528564f, 0.7539047f},
-std::array<float,2>{0.397126555f, 0.442385882f},
-std::array<float,2>{0.788613319f, 0.70628345f},
-std::array<float,2>{0.895262122f, 0.320460767f},
-std::array<float,2>{0.315007836f, 0.575479805f},
-std::array<float,2>{0.218784481f, 0.0191217288f},
-std::array<float,2>{0.600734234f, 0.925260842f},
-std::array<float,2>{0.526948154f, 0.419227988f},
-std::array<float,2>{0.132757798f, 0.666762233f},
-std::array<float,2>{0.26508826f, 0.2057724f},
-std::array<float,2>{0.947697341f, 0.869713426f},
-std::array<float,2>{0.871596396f, 0.10455852f},
-std::array<float,2>{0.481039584f, 0.947140455f},
-std::array<float,2>{0.0200270321f, 0.251278639f},
-std::array<float,2>{0.657365143f, 0.532103539f},
-std::array<float,2>{0.587777734f, 0.0343023539f},
-std::array<float,2>{0.189141065f, 0.894977152f},
-std::array<float,2>{0.344687104f, 0.367700666f},
-std::array<float,2>{0.911291003f, 0.614250183f},
-std::array<float,2>{0.752938986f, 0.485437185f},
-std::array<float,2>{0.434388041f, 0.721378803f},
-std::array<float,2>{0.0910023749f, 0.129549369f},
-std::array<float,2>{0.743017316f, 0.787219703f},
-std::array<float,2>{0.636617899f, 0.295911372f},
-std::array<float,2>{0.0452664979f, 0.505389333f},
-std::array<float,2>{0.450017661f, 0.0702296346f},
-std::array<float,2>{0.832251549f, 0.972723961f},
-std::array<float,2>{0.973677754f, 0.232900083f},
-std::array<float,2>{0.307687223f, 0.821591198f},
-std::array<float,2>{0.186357811f, 0.390042961f},
-std::array<float,2>{0.535395265f, 0.652680218f},
-std::array<float,2>{0.605596781f, 0.140237376f},
-std::array<float,2>{0.231616095f, 0.791564405f},
-std::array<float,2>{0.323886096f, 0.494011194f},
-std::array<float,2>{0.900415003f, 0.729866326f},
-std::array<float,2>{0.792834461f, 0.364575565f},
-std::array<float,2>{0.3987903f, 0.618954539f},
-std::array<float,2>{0.104764223f, 0.0392673723f},
-std::array<float,2>{0.704464555f, 0.90201062f},
-std::array<float,2>{0.664471388f, 0.380788863f},
-std::array<float,2>{0.0301010553f, 0.641885042f},
-std::array<float,2>{0.471503496f, 0.225920692f},
-std::array<float,2>{0.864690602f, 0.816480815f},
-std::array<float,2>{0.938484013f, 0.0744551867f},
-std::array<float,2>{0.25363782f, 0.978924215f},
-std::array<float,2>{0.135444403f, 0.284541845f},
-std::array<float,2>{0.518712163f, 0.515568614f},
-std::array<float,2>{0.737801731f, 0.0254157167f},
-std::array<float,2>{0.0804572329f, 0.930985153f},
-std::array<float,2>{0.426635414f, 0.313919216f},
-std::array<float,2>{0.763363123f, 0.567785263f},
-std::array<float,2>{0.915612638f, 0.4473961f},
-std::array<float,2>{0.354083419f, 0.714315474f},
-std::array<float,2>{0.202985004f, 0.165749937f},
-std::array<float,2>{0.58358109f, 0.76191479f},
-std::array<float,2>{0.540541947f, 0.259462684f},
-std::array<float,2>{0.179282874f, 0.541937888f},
-std::array<float,2>{0.29988572f, 0.0954727456f},
-std::array<float,2>{0.980062783f, 0.941183209f},
-std::array<float,2>{0.839082718f, 0.216771081f},
-std::array<float,2>{0.44331193f, 0.860496163f},
-std::array<float,2>{0.0364363045f, 0.41247198f},
-std::array<float,2>{0.632524312f, 0.65875411f},
-std::array<float,2>{0.651480615f, 0.244249448f},
-std::array<float,2>{0.0576986782f, 0.839027762f},
-std::array<float,2>{0.462804347f, 0.401377201f},
-std::array<float,2>{0.817235351f, 0.626957238f},
-std::array<float,2>{0.996363401f, 0.310327739f},
-std::array<float,2>{0.293704063f, 0.525390923f},
-std::array<float,2>{0.165785059f, 0.0900479183f},
-std::array<float,2>{0.556306362f, 0.991291761f},
-std::array<float,2>{0.564641476f, 0.476988584f},
-std::array<float,2>{0.214405894f, 0.741712928f},
-std::array<float,2>{0.36244604f, 0.151974276f},
-std::array<float,2>{0.937225401f, 0.80342412f},
-std::array<float,2>{0.771158934f, 0.0551353358f},
-std::array<float,2>{0.409524739f, 0.878328621f},
-std::array<float,2>{0.0722000822f, 0.345659852f},
-std::array<float,2>{0.726382852f, 0.596781492f},
-std::array<float,2>{0.503877521f, 0.114722349f},
-std::array<float,2>{0.147815853f, 0.963843942f},
-std::array<float,2>{0.269186735f, 0.26771751f},
-std::array<float,2>{0.957760394f, 0.553217769f},
-std::array<float,2>{0.857970834f, 0.424402744f},
-std::array<float,2>{0.490736902f, 0.672908008f},
-std::array<float,2>{0.0138803525f, 0.193133235f},
-std::array<float,2>{0.67613709f, 0.845950961f},
-std::array<float,2>{0.689512193f, 0.328590721f},
-std::array<float,2>{0.114309534f, 0.578317106f},
-std::array<float,2>{0.375833392f, 0.00457888609f},
-std::array<float,2>{0.803827226f, 0.913915396f},
-std::array<float,2>{0.882925689f, 0.179889262f},
-std::array<float,2>{0.330233097f, 0.767128408f},
-std::array<float,2>{0.239860862f, 0.455233663f},
-std::array<float,2>{0.623808742f, 0.694492698f},
-std::array<float,2>{0.571459532f, 0.21897018f},
-std::array<float,2>{0.206570819f, 0.814132929f},
-std::array<float,2>{0.372573167f, 0.377718747f},
-std::array<float,2>{0.922804058f, 0.64490366f},
-std::array<float,2>{0.776117682f, 0.285260379f},
-std::array<float,2>{0.418555409f, 0.50946182f},
-std::array<float,2>{0.0651946589f, 0.0726057589f},
-std::array<float,2>{0.732272565f, 0.982709646f},
-std::array<float,2>{0.642675281f, 0.496172309f},
-std::array<float,2>{0.0512965992f, 0.731404841f},
-std::array<float,2>{0.456922442f, 0.133250207f},
-std::array<float,2>{0.827004135f, 0.795471728f},
-std::array<float,2>{0.986130893f, 0.0441410691f},
-std::array<float,2>{0.285609722f, 0.905480266f},
-std::array<float,2>{0.159005851f, 0.360991806f},
-std::array<float,2>{0.55275166f, 0.624996066f},
-std::array<float,2>{0.69728905f, 0.099809058f},
-std::array<float,2>{0.123764284f, 0.941794753f},
-std::array<float,2>{0.383836567f, 0.261720955f},
-std::array<float,2>{0.808418632f, 0.543757439f},
-std::array<float,2>{0.876937568f, 0.406791747f},
-std::array<float,2>{0.337173909f, 0.660788953f},
-std::array<float,2>{0.249934942f, 0.21451354f},
-std::array<float,2>{0.610887289f, 0.865845144f},
-std::array<float,2>{0.509520769f, 0.318095118f},
-std::array<float,2>{0.153108194f, 0.565965593f},
-std::array<float,2>{0.274773717f, 0.0274932683f},
-std::array<float,2>{0.965122283f, 0.936975956f},
-std::array<float,2>{0.851219714f, 0.171190187f},
-std::array<float,2>{0.494933069f, 0.761233628f},
-std::array<float,2>{0.00578479562f, 0.450537115f},
-std::array<float,2>{0.68535018f, 0.717550099f},
-std::array<float,2>{0.662646711f, 0.152815342f},
-std::array<float,2>{0.0186297856f, 0.797579587f},
-std::array<float,2>{0.479672045f, 0.481835276f},
-std::array<float,2>{0.86785388f, 0.737626255f},
-std::array<float,2>{0.950158119f, 0.349680573f},
-std::array<float,2>{0.260709286f, 0.600345433f},
-std::array<float,2>{0.1264157f, 0.0587118901f},
-std::array<float,2>{0.53096664f, 0.881676376f},
-std::array<float,2>{0.596696854f, 0.403275967f},
-std::array<float,2>{0.225973383f, 0.631092429f},
-std::array<float,2>{0.317857355f, 0.246751308f},
-std::array<float,2>{0.891468048f, 0.840224266f},
-std::array<float,2>{0.781863213f, 0.0870428979f},
-std::array<float,2>{0.394076228f, 0.985237181f},
-std::array<float,2>{0.0970718935f, 0.308232605f},
-std::array<float,2>{0.718515813f, 0.527424276f},
-std::array<float,2>{0.535000861f, 0.00188323588f},
-std::array<float,2>{0.180516914f, 0.907586753f},
-std::array<float,2>{0.311117053f, 0.335150629f},
-std::array<float,2>{0.972521126f, 0.585909069f},
-std::array<float,2>{0.831794858f, 0.460053176f},
-std::array<float,2>{0.445336789f, 0.689578891f},
-std::array<float,2>{0.0396292806f, 0.184950113f},
-std::array<float,2>{0.637361109f, 0.771356165f},
-std::array<float,2>{0.746448696f, 0.271658212f},
-std::array<float,2>{0.0864827707f, 0.548961878f},
-std::array<float,2>{0.430544823f, 0.110183053f},
-std::array<float,2>{0.75703913f, 0.968435884f},
-std::array<float,2>{0.907021821f, 0.187978089f},
-std::array<float,2>{0.349727422f, 0.850352883f},
-std::array<float,2>{0.194655418f, 0.428272694f},
-std::array<float,2>{0.591083169f, 0.676410079f},
-std::array<float,2>{0.520008385f, 0.174518809f},
-std::array<float,2>{0.137839392f, 0.777421117f},
-std::array<float,2>{0.257045358f, 0.462919652f},
-std::array<float,2>{0.943778157f, 0.700322926f},
-std::array<float,2>{0.861443996f, 0.341963202f},
-std::array<float,2>{0.473090827f, 0.589074612f},
-std::array<float,2>{0.0250278879f, 0.00938928407f},
-std::array<float,2>{0.668359041f, 0.914180696f},
-std::array<float,2>{0.708868146f, 0.430405706f},
-std::array<float,2>{0.107239954f, 0.681876719f},
-std::array<float,2>{0.402413607f, 0.19578281f},
-std::array<float,2>{0.794172466f, 0.852751732f},
-std::array<float,2>{0.905020654f, 0.121380292f},
-std::array<float,2>{0.326928377f, 0.955253899f},
-std::array<float,2>{0.22803095f, 0.276795477f},
-std::array<float,2>{0.603254795f, 0.555682898f},
-std::array<float,2>{0.628638029f, 0.0473621525f},
-std::array<float,2>{0.0337135829f, 0.884099305f},
-std::array<float,2>{0.439531624f, 0.351792604f},
-std::array<float,2>{0.84288758f, 0.604388773f},
-std::array<float,2>{0.980752587f, 0.469146281f},
-std::array<float,2>{0.304568291f, 0.749898434f},
-std::array<float,2>{0.172025815f, 0.14194119f},
-std::array<float,2>{0.543572068f, 0.811356127f},
-std::array<float,2>{0.579227149f, 0.30413416f},
-std::array<float,2>{0.198658779f, 0.517617106f},
-std::array<float,2>{0.359102786f, 0.0840050131f},
-std::array<float,2>{0.919010401f, 0.997891843f},
-std::array<float,2>{0.761039019f, 0.242006972f},
-std::array<float,2>{0.423959583f, 0.835012138f},
-std::array<float,2>{0.0826453492f, 0.397065967f},
-std::array<float,2>{0.738826454f, 0.636851549f},
-std::array<float,2>{0.721637011f, 0.209083185f},
-std::array<float,2>{0.0750532001f, 0.871480405f},
-std::array<float,2>{0.411988109f, 0.415866315f},
-std::array<float,2>{0.768414199f, 0.668800175f},
-std::array<float,2>{0.933188796f, 0.254347622f},
-std::array<float,2>{0.365739465f, 0.537076414f},
-std::array<float,2>{0.214928806f, 0.105639905f},
-std::array<float,2>{0.569440067f, 0.950184524f},
-std::array<float,2>{0.562311113f, 0.439648867f},
-std::array<float,2>{0.170618936f, 0.708737969f},
-std::array<float,2>{0.28908813f, 0.161046758f},
-std::array<float,2>{0.993810236f, 0.755067229f},
-std::array<float,2>{0.814302385f, 0.0212406423f},
-std::array<float,2>{0.467468023f, 0.928295672f},
-std::array<float,2>{0.0601877235f, 0.326090932f},
-std::array<float,2>{0.655147076f, 0.570976257f},
-std::array<float,2>{0.618165731f, 0.0647122562f},
-std::array<float,2>{0.236172006f, 0.971331835f},
-std::array<float,2>{0.333713025f, 0.289531142f},
-std::array<float,2>{0.886857748f, 0.501043439f},
-std::array<float,2>{0.797557235f, 0.38511163f},
-std::array<float,2>{0.380015254f, 0.652039587f},
-std::array<float,2>{0.110873178f, 0.227749094f},
-std::array<float,2>{0.692159176f, 0.825408757f},
-std::array<float,2>{0.672706306f, 0.373509586f},
-std::array<float,2>{0.00930703431f, 0.610672832f},
-std::array<float,2>{0.48550123f, 0.0365662687f},
-std::array<float,2>{0.852930367f, 0.891265571f},
-std::array<float,2>{0.953377962f, 0.126565546f},
-std::array<float,2>{0.269613683f, 0.784200966f},
-std::array<float,2>{0.141569003f, 0.489224195f},
-std::array<float,2>{0.504074991f, 0.723212957f},
-std::array<float,2>{0.544501007f, 0.238637894f},
-std::array<float,2>{0.173485041f, 0.832136929f},
-std::array<float,2>{0.30363819f, 0.396187335f},
-std::array<float,2>{0.982396543f, 0.639386177f},
-std::array<float,2>{0.84240067f, 0.301341504f},
-std::array<float,2>{0.441240162f, 0.516120374f},
-std::array<float,2>{0.0349222124f, 0.0837244764f},
-std::array<float,2>{0.627426147f, 0.999549568f},
-std::array<float,2>{0.739483297f, 0.470919967f},
-std::array<float,2>{0.0833122656f, 0.74644208f},
-std::array<float,2>{0.425327986f, 0.143647924f},
-std::array<float,2>{0.760052621f, 0.810498953f},
-std::array<float,2>{0.918369889f, 0.0496741273f},
-std::array<float,2>{0.358139187f, 0.885901272f},
-std::array<float,2>{0.197351605f, 0.354220241f},
-std::array<float,2>{0.578660011f, 0.603307843f},
-std::array<float,2>{0.669746041f, 0.124674112f},
-std::array<float,2>{0.0234876424f, 0.95427537f},
-std::array<float,2>{0.47402215f, 0.274767995f},
-std::array<float,2>{0.862754345f, 0.557604015f},
-std::array<float,2>{0.944745958f, 0.433128297f},
-std::array<float,2>{0.256544888f, 0.681167543f},
-std::array<float,2>{0.136730522f, 0.198786169f},
-std::array<float,2>{0.520790458f, 0.853783965f},
-std::array<float,2>{0.601722836f, 0.340026081f},
-std::array<float,2>{0.22708711f, 0.587455332f},
-std::array<float,2>{0.328063309f, 0.0108603584f},
-std::array<float,2>{0.905276299f, 0.917421937f},
-std::array<float,2>{0.793880522f, 0.172672406f},
-std::array<float,2>{0.404122502f, 0.780388415f},
-std::array<float,2>{0.105826758f, 0.461984813f},
-std::array<float,2>{0.707843363f, 0.702811897f},
-std::array<float,2>{0.692950249f, 0.128174707f},
-std::array<float,2>{0.109571479f, 0.782949805f},
-std::array<float,2>{0.379426599f, 0.491903603f},
-std::array<float,2>{0.798031628f, 0.726261675f},
-std::array<float,2>{0.888661385f, 0.371105939f},
-std::array<float,2>{0.332230031f, 0.612765849f},
-std::array<float,2>{0.234590977f, 0.0389801785f},
-std::array<float,2>{0.618139029f, 0.893180966f},
-std::array<float,2>{0.505496681f, 0.384373128f},
-std::array<float,2>{0.142050043f, 0.649502456f},
-std::array<float,2>{0.270946831f, 0.230128795f},
-std::array<float,2>{0.954686284f, 0.826983452f},
-std::array<float,2>{0.851815224f, 0.0636696965f},
-std::array<float,2>{0.485199481f, 0.969196975f},
-std::array<float,2>{0.0079564359f, 0.291269481f},
-std::array<float,2>{0.672943711f, 0.50367403f},
-std::array<float,2>{0.569000423f, 0.0224296357f},
-std::array<float,2>{0.216697574f, 0.927357078f},
-std::array<float,2>{0.366965026f, 0.327601999f},
-std::array<float,2>{0.932081282f, 0.573197722f},
-std::array<float,2>{0.769456029f, 0.43766585f},
-std::array<float,2>{0.411113143f, 0.710141122f},
-std::array<float,2>{0.0758352876f, 0.162119985f},
-std::array<float,2>{0.722528875f, 0.757258415f},
-std::array<float,2>{0.656249166f, 0.257528096f},
-std::array<float,2>{0.0591001809f, 0.539049983f},
-std::array<float,2>{0.467820644f, 0.108161345f},
-std::array<float,2>{0.812526643f, 0.951220393f},
-std::array<float,2>{0.992703795f, 0.207813025f},
-std::array<float,2>{0.290985078f, 0.874457538f},
-std::array<float,2>{0.170964509f, 0.417911768f},
-std::array<float,2>{0.561360478f, 0.670063853f},
-std::array<float,2>{0.610280037f, 0.168169349f},
-std::array<float,2>{0.24837862f, 0.759445667f},
-std::array<float,2>{0.336194098f, 0.452496499f},
-std::array<float,2>{0.875197887f, 0.716280758f},
-std::array<float,2>{0.806783915f, 0.318558127f},
-std::array<float,2>{0.383314818f, 0.563144743f},
-std::array<float,2>{0.124719232f, 0.0311456826f},
-std::array<float,2>{0.698974609f, 0.935542643f},
-std::array<float,2>{0.684569478f, 0.408592522f},
-std::array<float,2>{0.00402379083f, 0.663973331f},
-std::array<float,2>{0.495289445f, 0.212082773f},
-std::array<float,2>{0.850159109f, 0.863310814f},
-std::array<float,2>{0.96602428f, 0.0978822336f},
-std::array<float,2>{0.273943335f, 0.944469392f},
-std::array<float,2>{0.153403386f, 0.264217556f},
-std::array<float,2>{0.508781016f, 0.545435667f},
-std::array<float,2>{0.730956376f, 0.0457541309f},
-std::array<float,2>{0.0657824874f, 0.903608739f},
-std::array<float,2>{0.419830054f, 0.361517936f},
-std::array<float,2>{0.776804984f, 0.622925758f},
-std::array<float,2>{0.923078299f, 0.498633087f},
-std::array<float,2>{0.371559888f, 0.733152151f},
-std::array<float,2>{0.205556005f, 0.134963244f},
-std::array<float,2>{0.570979774f, 0.793945014f},
-std::array<float,2>{0.553821623f, 0.288246304f},
-std::array<float,2>{0.160107315f, 0.510441959f},
-std::array<float,2>{0.286905318f, 0.0705216601f},
-std::array<float,2>{0.984780967f, 0.98108983f},
-std::array<float,2>{0.827725649f, 0.221602306f},
-std::array<float,2>{0.45513463f, 0.815092266f},
-std::array<float,2>{0.0525704958f, 0.37541917f},
-std::array<float,2>{0.643643737f, 0.648377478f},
-std::array<float,2>{0.638290584f, 0.190033987f},
-std::array<float,2>{0.0407795981f, 0.848382115f},
-std::array<float,2>{0.446372509f, 0.426694244f},
-std::array<float,2>{0.830383182f, 0.678181112f},
-std::array<float,2>{0.9713521f, 0.270257533f},
-std::array<float,2>{0.311992615f, 0.547341049f},
-std::array<float,2>{0.180889383f, 0.113258265f},
-std::array<float,2>{0.533429623f, 0.966742456f},
-std::array<float,2>{0.590499878f, 0.458497733f},
-std::array<float,2>{0.193857729f, 0.688243508f},
-std::array<float,2>{0.350855768f, 0.186423108f},
-std::array<float,2>{0.907921731f, 0.771895528f},
-std::array<float,2>{0.756797254f, 0.00200673332f},
-std::array<float,2>{0.431268662f, 0.909225583f},
-std::array<float,2>{0.0871794224f, 0.332476407f},
-std::array<float,2>{0.747498393f, 0.583387792f},
-std::array<float,2>{0.529548526f, 0.0889075622f},
-std::array<float,2>{0.125590429f, 0.987064958f},
-std::array<float,2>{0.261650085f, 0.30588305f},
-std::array<float,2>{0.950312793f, 0.530357361f},
-std::array<float,2>{0.86862874f, 0.404943496f},
-std::array<float,2>{0.478681862f, 0.629575372f},
-std::array<float,2>{0.0182567053f, 0.249193981f},
-std::array<float,2>{0.663166046f, 0.8433097f},
-std::array<float,2>{0.717701018f, 0.348884016f},
-std::array<float,2>{0.0959533751f, 0.598817229f},
-std::array<float,2>{0.393310785f, 0.0618867949f},
-std::array<float,2>{0.78289032f, 0.880088747f},
-std::array<float,2>{0.89245379f, 0.156013876f},
-std::array<float,2>{0.317305297f, 0.799346209f},
-std::array<float,2>{0.225503951f, 0.484234124f},
-std::array<float,2>{0.59576273f, 0.73597908f},
-std::array<float,2>{0.582451463f, 0.217155829f},
-std::array<float,2>{0.201602325f, 0.861418664f},
-std::array<float,2>{0.355353206f, 0.411012858f},
-std::array<float,2>{0.914527059f, 0.657976329f},
-std::array<float,2>{0.762508094f, 0.260425955f},
-std::array<float,2>{0.427704185f, 0.54091388f},
-std::array<float,2>{0.0812612846f, 0.0960552022f},
-std::array<float,2>{0.736422181f, 0.938865244f},
-std::array<float,2>{0.631761551f, 0.447220623f},
-std::array<float,2>{0.0358426347f, 0.711116314f},
-std::array<float,2>{0.44215849f, 0.166520506f},
-std::array<float,2>{0.83885783f, 0.763952255f},
-std::array<float,2>{0.979458511f, 0.0239135344f},
-std::array<float,2>{0.299010843f, 0.93345803f},
-std::array<float,2>{0.178515911f, 0.316058755f},
-std::array<float,2>{0.539284468f, 0.568436146f},
-std::array<float,2>{0.703605294f, 0.07755059f},
-std::array<float,2>{0.103536025f, 0.977654636f},
-std::array<float,2>{0.399660885f, 0.281699777f},
-std::array<float,2>{0.791017711f, 0.51322943f},
-std::array<float,2>{0.901846468f, 0.38157928f},
-std::array<float,2>{0.322928697f, 0.643017113f},
-std::array<float,2>{0.230899408f, 0.224130496f},
-std::array<float,2>{0.607105911f, 0.818364978f},
-std::array<float,2>{0.518046021f, 0.365276515f},
-std::array<float,2>{0.136077881f, 0.619213223f},
-std::array<float,2>{0.252845466f, 0.0417367294f},
-std::array<float,2>{0.93764627f, 0.898788095f},
-std::array<float,2>{0.863918245f, 0.138118625f},
-std::array<float,2>{0.472577631f, 0.789188743f},
-std::array<float,2>{0.0307611302f, 0.494930416f},
-std::array<float,2>{0.665212691f, 0.728225172f},
-std::array<float,2>{0.677616f, 0.183256492f},
-std::array<float,2>{0.0149795068f, 0.769492686f},
-std::array<float,2>{0.492095321f, 0.453554124f},
-std::array<float,2>{0.858826458f, 0.692980528f},
-std::array<float,2>{0.95804435f, 0.330254346f},
-std::array<float,2>{0.268197954f, 0.580637276f},
-std::array<float,2>{0.146998942f, 0.00605469244f},
-std::array<float,2>{0.502603233f, 0.911330342f},
-std::array<float,2>{0.624988556f, 0.422130167f},
-std::array<float,2>{0.238631919f, 0.673847556f},
-std::array<float,2>{0.331742018f, 0.194673553f},
-std::array<float,2>{0.884355783f, 0.844595134f},
-std::array<float,2>{0.803272784f, 0.116860539f},
-std::array<float,2>{0.376583666f, 0.961031616f},
-std::array<float,2>{0.113323048f, 0.266486406f},
-std::array<float,2>{0.690554619f, 0.551688194f},
-std::array<float,2>{0.5551669f, 0.0573095419f},
-std::array<float,2>{0.16497387f, 0.875915706f},
-std::array<float,2>{0.294684052f, 0.347584277f},
-std::array<float,2>{0.997996747f, 0.595442295f},
-std::array<float,2>{0.817633629f, 0.479923934f},
-std::array<float,2>{0.461527497f, 0.738949418f},
-std::array<float,2>{0.0570813827f, 0.149003759f},
-std::array<float,2>{0.651085377f, 0.801598668f},
-std::array<float,2>{0.725014567f, 0.311195523f},
-std::array<float,2>{0.0704862401f, 0.52438277f},
-std::array<float,2>{0.409143418f, 0.0930363387f},
-std::array<float,2>{0.770018458f, 0.989663243f},
-std::array<float,2>{0.936447799f, 0.242953762f},
-std::array<float,2>{0.361945033f, 0.836745322f},
-std::array<float,2>{0.21380274f, 0.400188565f},
-std::array<float,2>{0.566154659f, 0.626895905f},
-std::array<float,2>{0.51380074f, 0.148352951f},
-std::array<float,2>{0.150930017f, 0.806044221f},
-std::array<float,2>{0.279622316f, 0.475937545f},
-std::array<float,2>{0.964180648f, 0.742263377f},
-std::array<float,2>{0.844835699f, 0.357199788f},
-std::array<float,2>{0.498960614f, 0.607190311f},
-std::array<float,2>{0.00259174895f, 0.0543528907f},
-std::array<float,2>{0.680364251f, 0.88674891f},
-std::array<float,2>{0.701158524f, 0.391644955f},
-std::array<float,2>{0.117711924f, 0.635772586f},
-std::array<float,2>{0.390015125f, 0.236700088f},
-std::array<float,2>{0.808666825f, 0.830659986f},
-std::array<float,2>{0.880148172f, 0.0820094272f},
-std::array<float,2>{0.34126392f, 0.995917201f},
-std::array<float,2>{0.244216293f, 0.300377697f},
-std::array<float,2>{0.613713145f, 0.519705892f},
-std::array<float,2>{0.646457016f, 0.0120002674f},
-std::array<float,2>{0.0481521226f, 0.918635249f},
-std::array<float,2>{0.458073318f, 0.339268953f},
-std::array<float,2>{0.822486401f, 0.592439651f},
-std::array<float,2>{0.991043568f, 0.467233062f},
-std::array<float,2>{0.28359735f, 0.696962535f},
-std::array<float,2>{0.160526201f, 0.179038882f},
-std::array<float,2>{0.550126731f, 0.776669621f},
-std::array<float,2>{0.57755357f, 0.280769855f},
-std::array<float,2>{0.207281411f, 0.560076475f},
-std::array<float,2>{0.370781273f, 0.120575413f},
-std::array<float,2>{0.926629484f, 0.96053493f},
-std::array<float,2>{0.777646601f, 0.201617479f},
-std::array<float,2>{0.415837884f, 0.85624516f},
-std::array<float,2>{0.0700042844f, 0.435340345f},
-std::array<float,2>{0.730395496f, 0.685812652f},
-std::array<float,2>{0.743843496f, 0.2315128f},
-std::array<float,2>{0.0903468207f, 0.824035525f},
-std::array<float,2>{0.435263008f, 0.387901664f},
-std::array<float,2>{0.752658784f, 0.655521452f},
-std::array<float,2>{0.910164952f, 0.293571323f},
-std::array<float,2>{0.344842315f, 0.507056057f},
-std::array<float,2>{0.188333735f, 0.068313159f},
-std::array<float,2>{0.586405456f, 0.97587657f},
-std::array<float,2>{0.536611617f, 0.488043755f},
-std::array<float,2>{0.186864883f, 0.720014274f},
-std::array<float,2>{0.307312638f, 0.131698385f},
-std::array<float,2>{0.973343134f, 0.786576807f},
-std::array<float,2>{0.833554029f, 0.031837713f},
-std::array<float,2>{0.450870752f, 0.898165524f},
-std::array<float,2>{0.0467776023f, 0.370121986f},
-std::array<float,2>{0.635620236f, 0.616900146f},
-std::array<float,2>{0.600106895f, 0.101855628f},
-std::array<float,2>{0.220279038f, 0.948696733f},
-std::array<float,2>{0.315825462f, 0.253672123f},
-std::array<float,2>{0.895532548f, 0.534362614f},
-std::array<float,2>{0.78798449f, 0.420384943f},
-std::array<float,2>{0.397932291f, 0.665895045f},
-std::array<float,2>{0.0995726436f, 0.203272253f},
-std::array<float,2>{0.713123798f, 0.868218601f},
-std::array<float,2>{0.657105625f, 0.323878974f},
-std::array<float,2>{0.0208050366f, 0.576328754f},
-std::array<float,2>{0.48160997f, 0.0163580086f},
-std::array<float,2>{0.873010933f, 0.923715234f},
-std::array<float,2>{0.949074388f, 0.15813072f},
-std::array<float,2>{0.264084816f, 0.751158953f},
-std::array<float,2>{0.131164476f, 0.444439799f},
-std::array<float,2>{0.525874376f, 0.704827726f},
-std::array<float,2>{0.521780849f, 0.195522755f},
-std::array<float,2>{0.138834864f, 0.852971077f},
-std::array<float,2>{0.255194157f, 0.430455446f},
-std::array<float,2>{0.941744506f, 0.682048082f},
-std::array<float,2>{0.860257626f, 0.276374847f},
-std::array<float,2>{0.475950748f, 0.555951238f},
-std::array<float,2>{0.0271205623f, 0.121334188f},
-std::array<float,2>{0.670703888f, 0.955330908f},
-std::array<float,2>{0.70983845f, 0.463377476f},
-std::array<float,2>{0.108266756f, 0.700447679f},
-std::array<float,2>{0.404550344f, 0.174740896f},
-std::array<float,2>{0.79590559f, 0.777713299f},
-std::array<float,2>{0.902880073f, 0.00958041288f},
-std::array<float,2>{0.324706703f, 0.914375603f},
-std::array<float,2>{0.230341733f, 0.342184126f},
-std::array<float,2>{0.605059206f, 0.589229405f},
-std::array<float,2>{0.625218213f, 0.0843293816f},
-std::array<float,2>{0.0320701003f, 0.997559547f},
-std::array<float,2>{0.439090312f, 0.303861201f},
-std::array<float,2>{0.840631664f, 0.518041968f},
-std::array<float,2>{0.983400524f, 0.397228271f},
-std::array<float,2>{0.301294625f, 0.637183011f},
-std::array<float,2>{0.173936293f, 0.241842911f},
-std::array<float,2>{0.546563864f, 0.835358262f},
-std::array<float,2>{0.581568241f, 0.351948351f},
-std::array<float,2>{0.195486739f, 0.604177535f},
-std::array<float,2>{0.356929153f, 0.0470826812f},
-std::array<float,2>{0.921479762f, 0.883798361f},
-std::array<float,2>{0.758438647f, 0.141628876f},
-std::array<float,2>{0.422931254f, 0.811064959f},
-std::array<float,2>{0.0843536854f, 0.468847483f},
-std::array<float,2>{0.740748763f, 0.749722898f},
-std::array<float,2>{0.72007376f, 0.160808966f},
-std::array<float,2>{0.0770122632f, 0.75535953f},
-std::array<float,2>{0.412392557f, 0.43974489f},
-std::array<float,2>{0.765902519f, 0.708932221f},
-std::array<float,2>{0.930728614f, 0.325786978f},
-std::array<float,2>{0.364651948f, 0.571147025f},
-std::array<float,2>{0.218303233f, 0.0212300234f},
-std::array<float,2>{0.56810385f, 0.928529561f},
-std::array<float,2>{0.559775889f, 0.415751457f},
-std::array<float,2>{0.169179395f, 0.668688118f},
-std::array<float,2>{0.291989833f, 0.20935078f},
-std::array<float,2>{0.99513799f, 0.871093929f},
-std::array<float,2>{0.815392554f, 0.105888769f},
-std::array<float,2>{0.466673434f, 0.949873626f},
-std::array<float,2>{0.0612051748f, 0.254072607f},
-std::array<float,2>{0.654157698f, 0.536817193f},
-std::array<float,2>{0.619789124f, 0.0361638255f},
-std::array<float,2>{0.236814514f, 0.89150852f},
-std::array<float,2>{0.334066033f, 0.37321341f},
-std::array<float,2>{0.889284015f, 0.610390544f},
-std::array<float,2>{0.800087392f, 0.488872021f},
-std::array<float,2>{0.382487655f, 0.72360462f},
-std::array<float,2>{0.112554714f, 0.126755446f},
-std::array<float,2>{0.694550514f, 0.784531116f},
-std::array<float,2>{0.673897743f, 0.289093971f},
-std::array<float,2>{0.0102142151f, 0.501461565f},
-std::array<float,2>{0.48713097f, 0.0645315573f},
-std::array<float,2>{0.855094135f, 0.971654058f},
-std::array<float,2>{0.956435859f, 0.227811351f},
-std::array<float,2>{0.271853119f, 0.825552642f},
-std::array<float,2>{0.142796054f, 0.384885937f},
-std::array<float,2>{0.506702542f, 0.65225333f},
-std::array<float,2>{0.574217975f, 0.132817402f},
-std::array<float,2>{0.203533262f, 0.795785129f},
-std::array<float,2>{0.373780847f, 0.496411324f},
-std::array<float,2>{0.925746918f, 0.730970383f},
-std::array<float,2>{0.774475038f, 0.361232132f},
-std::array<float,2>{0.42182526f, 0.624660015f},
-std::array<float,2>{0.0642934814f, 0.0442592725f},
-std::array<float,2>{0.733576059f, 0.905658603f},
-std::array<float,2>{0.641403973f, 0.37746945f},
-std::array<float,2>{0.0543460064f, 0.6447469f},
-std::array<float,2>{0.453773737f, 0.219027758f},
-std::array<float,2>{0.824739933f, 0.814354122f},
-std::array<float,2>{0.98714155f, 0.0722706616f},
-std::array<float,2>{0.28807798f, 0.982623816f},
-std::array<float,2>{0.156462714f, 0.285557389f},
-std::array<float,2>{0.552349567f, 0.509684563f},
-std::array<float,2>{0.696706772f, 0.0276631452f},
-std::array<float,2>{0.122277752f, 0.936665714f},
-std::array<float,2>{0.384883434f, 0.318248481f},
-std::array<float,2>{0.805229604f, 0.566383779f},
-std::array<float,2>{0.878468037f, 0.45037514f},
-std::array<float,2>{0.338373333f, 0.717454791f},
-std::array<float,2>{0.247223333f, 0.171128035f},
-std::array<float,2>{0.611679256f, 0.761619866f},
-std::array<float,2>{0.51077354f, 0.262127519f},
-std::array<float,2>{0.154532477f, 0.543493569f},
-std::array<float,2>{0.277046591f, 0.100046135f},
-std::array<float,2>{0.967215538f, 0.941615522f},
-std::array<float,2>{0.848143995f, 0.214666724f},
-std::array<float,2>{0.493048131f, 0.865986347f},
-std::array<float,2>{0.00729664741f, 0.407001555f},
-std::array<float,2>{0.686227262f, 0.661095083f},
-std::array<float,2>{0.660705566f, 0.246919915f},
-std::array<float,2>{0.0169652589f, 0.839854658f},
-std::array<float,2>{0.4776254f, 0.403068632f},
-std::array<float,2>{0.870748401f, 0.631322205f},
-std::array<float,2>{0.952423513f, 0.308580905f},
-std::array<float,2>{0.259034365f, 0.527806759f},
-std::array<float,2>{0.12752153f, 0.0873396918f},
-std::array<float,2>{0.529147208f, 0.984983921f},
-std::array<float,2>{0.595578015f, 0.481683403f},
-std::array<float,2>{0.224241152f, 0.737537622f},
-std::array<float,2>{0.319943011f, 0.152539909f},
-std::array<float,2>{0.89387393f, 0.797831118f},
-std::array<float,2>{0.784434736f, 0.0589562729f},
-std::array<float,2>{0.391656727f, 0.881415427f},
-std::array<float,2>{0.0951562226f, 0.34988147f},
-std::array<float,2>{0.716611385f, 0.60018146f},
-std::array<float,2>{0.53164798f, 0.109873064f},
-std::array<float,2>{0.182872921f, 0.968611836f},
-std::array<float,2>{0.308859825f, 0.271771908f},
-std::array<float,2>{0.969487965f, 0.549218535f},
-std::array<float,2>{0.828992009f, 0.428535998f},
-std::array<float,2>{0.44841221f, 0.676542878f},
-std::array<float,2>{0.0429245681f, 0.18750529f},
-std::array<float,2>{0.640303731f, 0.850277364f},
-std::array<float,2>{0.748516798f, 0.335291952f},
-std::array<float,2>{0.0880163983f, 0.585633397f},
-std::array<float,2>{0.433330476f, 0.00163831818f},
-std::array<float,2>{0.755334139f, 0.90726465f},
-std::array<float,2>{0.909484744f, 0.184770778f},
-std::array<float,2>{0.34947592f, 0.771045029f},
-std::array<float,2>{0.191873297f, 0.460284799f},
-std::array<float,2>{0.593483984f, 0.689842224f},
-std::array<float,2>{0.609162331f, 0.225664228f},
-std::array<float,2>{0.234238341f, 0.816809356f},
-std::array<float,2>{0.320360333f, 0.380392432f},
-std::array<float,2>{0.899015903f, 0.641778529f},
-std::array<float,2>{0.789718628f, 0.284202933f},
-std::array<float,2>{0.401820034f, 0.515174687f},
-std::array<float,2>{0.103357337f, 0.0746611133f},
-std::array<float,2>{0.706036329f, 0.978568554f},
-std::array<float,2>{0.667083502f, 0.493796498f},
-std::array<float,2>{0.027452914f, 0.72968626f},
-std::array<float,2>{0.470166415f, 0.140504554f},
-std::array<float,2>{0.867000222f, 0.791917086f},
-std::array<float,2>{0.939475358f, 0.039316576f},
-std::array<float,2>{0.250051826f, 0.902306855f},
-std::array<float,2>{0.133125827f, 0.364438981f},
-std::array<float,2>{0.517046094f, 0.618796289f},
-std::array<float,2>{0.735069811f, 0.0953039527f},
-std::array<float,2>{0.0794000924f, 0.941070378f},
-std::array<float,2>{0.428155959f, 0.259732485f},
-std::array<float,2>{0.765541434f, 0.541590869f},
-std::array<float,2>{0.916985571f, 0.412311286f},
-std::array<float,2>{0.352337688f, 0.658940494f},
-std::array<float,2>{0.200708807f, 0.216532379f},
-std::array<float,2>{0.585088193f, 0.860622227f},
-std::array<float,2>{0.541282296f, 0.313613147f},
-std::array<float,2>{0.177016407f, 0.567455709f},
-std::array<float,2>{0.297048628f, 0.0257678069f},
-std::array<float,2>{0.978423178f, 0.930853724f},
-std::array<float,2>{0.83766222f, 0.165821686f},
-std::array<float,2>{0.44370988f, 0.762096465f},
-std::array<float,2>{0.037492089f, 0.447621554f},
-std::array<float,2>{0.629045784f, 0.713940561f},
-std::array<float,2>{0.649707615f, 0.152304381f},
-std::array<float,2>{0.056209676f, 0.803631842f},
-std::array<float,2>{0.464601815f, 0.476591408f},
-std::array<float,2>{0.819229901f, 0.742000043f},
-std::array<float,2>{0.999611199f, 0.345360577f},
-std::array<float,2>{0.295195907f, 0.596990049f},
-std::array<float,2>{0.167549551f, 0.0547033623f},
-std::array<float,2>{0.557642281f, 0.877936721f},
-std::array<float,2>{0.563127697f, 0.401832014f},
-std::array<float,2>{0.212615475f, 0.627295077f},
-std::array<float,2>{0.360165656f, 0.2444783f},
-std::array<float,2>{0.933826804f, 0.839308023f},
-std::array<float,2>{0.772985041f, 0.0902905986f},
-std::array<float,2>{0.407988787f, 0.991639853f},
-std::array<float,2>{0.0737338588f, 0.310099691f},
-std::array<float,2>{0.722695291f, 0.525676191f},
-std::array<float,2>{0.500111699f, 0.00476573501f},
-std::array<float,2>{0.145091981f, 0.913804233f},
-std::array<float,2>{0.26602143f, 0.328286678f},
-std::array<float,2>{0.959955513f, 0.578435719f},
-std::array<float,2>{0.855574071f, 0.45540145f},
-std::array<float,2>{0.488603622f, 0.694585919f},
-std::array<float,2>{0.01215747f, 0.179982945f},
-std::array<float,2>{0.679319084f, 0.767338932f},
-std::array<float,2>{0.6886518f, 0.267901987f},
-std::array<float,2>{0.116926797f, 0.552762806f},
-std::array<float,2>{0.378435582f, 0.114414394f},
-std::array<float,2>{0.801245868f, 0.963506222f},
-std::array<float,2>{0.885659873f, 0.192970216f},
-std::array<float,2>{0.328413069f, 0.84590441f},
-std::array<float,2>{0.241267666f, 0.424663931f},
-std::array<float,2>{0.621910095f, 0.673109949f},
-std::array<float,2>{0.547737896f, 0.177248612f},
-std::array<float,2>{0.162203848f, 0.77517283f},
-std::array<float,2>{0.282640547f, 0.466070801f},
-std::array<float,2>{0.988451242f, 0.698521554f},
-std::array<float,2>{0.820564091f, 0.337238818f},
-std::array<float,2>{0.459596336f, 0.591135561f},
-std::array<float,2>{0.0497123823f, 0.0151457898f},
-std::array<float,2>{0.647498369f, 0.921146572f},
-std::array<float,2>{0.72726053f, 0.437200129f},
-std::array<float,2>{0.0676837415f, 0.685429752f},
-std::array<float,2>{0.417609662f, 0.199750632f},
-std::array<float,2>{0.780703485f, 0.858126998f},
-std::array<float,2>{0.929328263f, 0.119093426f},
-std::array<float,2>{0.368629813f, 0.957711577f},
-std::array<float,2>{0.209599242f, 0.277468055f},
-std::array<float,2>{0.57457f, 0.56154865f},
-std::array<float,2>{0.682486236f, 0.0516631827f},
-std::array<float,2>{0.00123548589f, 0.890324354f},
-std::array<float,2>{0.497249603f, 0.358298868f},
-std::array<float,2>{0.847162008f, 0.60845381f},
-std::array<float,2>{0.962534785f, 0.474517465f},
-std::array<float,2>{0.278728455f, 0.745190561f},
-std::array<float,2>{0.149410114f, 0.145196453f},
-std::array<float,2>{0.512660682f, 0.806716084f},
-std::array<float,2>{0.617000282f, 0.297487378f},
-std::array<float,2>{0.242245018f, 0.521557212f},
-std::array<float,2>{0.34365657f, 0.0799489766f},
-std::array<float,2>{0.882026196f, 0.992616594f},
-std::array<float,2>{0.812096894f, 0.235261127f},
-std::array<float,2>{0.388267875f, 0.829699576f},
-std::array<float,2>{0.119622044f, 0.393184632f},
-std::array<float,2>{0.702693343f, 0.6338256f},
-std::array<float,2>{0.711293042f, 0.206041172f},
-std::array<float,2>{0.099713333f, 0.870093226f},
-std::array<float,2>{0.395458341f, 0.419031799f},
-std::array<float,2>{0.786405385f, 0.666654706f},
-std::array<float,2>{0.896731913f, 0.251149446f},
-std::array<float,2>{0.314237356f, 0.531924546f},
-std::array<float,2>{0.22187759f, 0.104753733f},
-std::array<float,2>{0.598424077f, 0.946946502f},
-std::array<float,2>{0.52511543f, 0.442829072f},
-std::array<float,2>{0.129050896f, 0.706408322f},
-std::array<float,2>{0.263016611f, 0.160122663f},
-std::array<float,2>{0.9457286f, 0.753552914f},
-std::array<float,2>{0.873728335f, 0.0194623731f},
-std::array<float,2>{0.483077049f, 0.92494452f},
-std::array<float,2>{0.0223003272f, 0.32059297f},
-std::array<float,2>{0.659193993f, 0.575297058f},
-std::array<float,2>{0.588878632f, 0.0698598027f},
-std::array<float,2>{0.191257283f, 0.972949445f},
-std::array<float,2>{0.346760154f, 0.296316385f},
-std::array<float,2>{0.913320899f, 0.505620956f},
-std::array<float,2>{0.750319898f, 0.38988933f},
-std::array<float,2>{0.437444359f, 0.652378559f},
-std::array<float,2>{0.0923010409f, 0.232521459f},
-std::array<float,2>{0.74563843f, 0.821349084f},
-std::array<float,2>{0.633116663f, 0.367920697f},
-std::array<float,2>{0.044541236f, 0.613985837f},
-std::array<float,2>{0.452780426f, 0.034660954f},
-std::array<float,2>{0.834495127f, 0.894639373f},
-std::array<float,2>{0.976469994f, 0.12968877f},
-std::array<float,2>{0.306206256f, 0.787454784f},
-std::array<float,2>{0.184167385f, 0.485802621f},
-std::array<float,2>{0.538232923f, 0.721655309f},
-std::array<float,2>{0.507657051f, 0.228730097f},
-std::array<float,2>{0.143692613f, 0.827914357f},
-std::array<float,2>{0.273137867f, 0.383449584f},
-std::array<float,2>{0.955178261f, 0.648642063f},
-std::array<float,2>{0.854186773f, 0.292569071f},
-std::array<float,2>{0.487878531f, 0.502058446f},
-std::array<float,2>{0.0109868571f, 0.062545009f},
-std::array<float,2>{0.675650656f, 0.969963908f},
-std::array<float,2>{0.693363667f, 0.491194308f},
-std::array<float,2>{0.1113941f, 0.724837542f},
-std::array<float,2>{0.381141096f, 0.12775147f},
-std::array<float,2>{0.799278915f, 0.78165853f},
-std::array<float,2>{0.890471935f, 0.0374169536f},
-std::array<float,2>{0.3356691f, 0.894499362f},
-std::array<float,2>{0.237479463f, 0.372172147f},
-std::array<float,2>{0.620486677f, 0.611539006f},
-std::array<float,2>{0.652832329f, 0.108718753f},
-std::array<float,2>{0.0621635467f, 0.952195883f},
-std::array<float,2>{0.465243548f, 0.25591892f},
-std::array<float,2>{0.815829217f, 0.538052738f},
-std::array<float,2>{0.994212866f, 0.416597873f},
-std::array<float,2>{0.292291373f, 0.67126441f},
-std::array<float,2>{0.168732136f, 0.208504111f},
-std::array<float,2>{0.559445858f, 0.874014676f},
-std::array<float,2>{0.567248702f, 0.326642424f},
-std::array<float,2>{0.216876179f, 0.573767006f},
-std::array<float,2>{0.363382399f, 0.0230363663f},
-std::array<float,2>{0.929707825f, 0.926273465f},
-std::array<float,2>{0.767105758f, 0.163274303f},
-std::array<float,2>{0.413278162f, 0.756686568f},
-std::array<float,2>{0.0777696073f, 0.43921423f},
-std::array<float,2>{0.71963954f, 0.709857404f},
-std::array<float,2>{0.741422355f, 0.143427044f},
-std::array<float,2>{0.0859180242f, 0.809000194f},
-std::array<float,2>{0.421884f, 0.472572565f},
-std::array<float,2>{0.758900404f, 0.74785161f},
-std::array<float,2>{0.920472145f, 0.355210304f},
-std::array<float,2>{0.356075525f, 0.602118552f},
-std::array<float,2>{0.196712106f, 0.0499777012f},
-std::array<float,2>{0.581009328f, 0.885729909f},
-std::array<float,2>{0.545048594f, 0.395197213f},
-std::array<float,2>{0.174863726f, 0.640168071f},
-std::array<float,2>{0.302037984f, 0.239867702f},
-std::array<float,2>{0.983264387f, 0.833451629f},
-std::array<float,2>{0.84150511f, 0.0822363421f},
-std::array<float,2>{0.438449383f, 0.998716056f},
-std::array<float,2>{0.0326759182f, 0.302173585f},
-std::array<float,2>{0.626437366f, 0.51724875f},
-std::array<float,2>{0.604004145f, 0.0104147727f},
-std::array<float,2>{0.228642851f, 0.916803837f},
-std::array<float,2>{0.32530573f, 0.341687351f},
-std::array<float,2>{0.904095292f, 0.586100638f},
-std::array<float,2>{0.795749962f, 0.460946321f},
-std::array<float,2>{0.405966789f, 0.701181054f},
-std::array<float,2>{0.108443938f, 0.173530817f},
-std::array<float,2>{0.710159123f, 0.77957046f},
-std::array<float,2>{0.671033621f, 0.274133086f},
-std::array<float,2>{0.0262787398f, 0.557948709f},
-std::array<float,2>{0.475364745f, 0.123082712f},
-std::array<float,2>{0.861000359f, 0.954079986f},
-std::array<float,2>{0.942940414f, 0.197778344f},
-std::array<float,2>{0.254270434f, 0.855351627f},
-std::array<float,2>{0.140515134f, 0.432107329f},
-std::array<float,2>{0.523138583f, 0.680612743f},
-std::array<float,2>{0.592082381f, 0.186544463f},
-std::array<float,2>{0.193213359f, 0.772711754f},
-std::array<float,2>{0.348209888f, 0.45781818f},
-std::array<float,2>{0.908695936f, 0.688932896f},
-std::array<float,2>{0.754062712f, 0.333879352f},
-std::array<float,2>{0.431967616f, 0.582995534f},
-std::array<float,2>{0.0894490033f, 0.00388088473f},
-std::array<float,2>{0.749475002f, 0.909014523f},
-std::array<float,2>{0.638881326f, 0.427425444f},
-std::array<float,2>{0.0414738581f, 0.678928852f},
-std::array<float,2>{0.44766295f, 0.191015303f},
-std::array<float,2>{0.829457045f, 0.848715365f},
-std::array<float,2>{0.969947457f, 0.111359552f},
-std::array<float,2>{0.309573084f, 0.965255022f},
-std::array<float,2>{0.181870908f, 0.271283776f},
-std::array<float,2>{0.532894015f, 0.548645258f},
-std::array<float,2>{0.715539515f, 0.0614822842f},
-std::array<float,2>{0.0939292312f, 0.879130185f},
-std::array<float,2>{0.391517639f, 0.348125756f},
-std::array<float,2>{0.783583462f, 0.598396838f},
-std::array<float,2>{0.892628074f, 0.483156294f},
-std::array<float,2>{0.319018066f, 0.734511316f},
-std::array<float,2>{0.222931758f, 0.154808074f},
-std::array<float,2>{0.594718218f, 0.800629914f},
-std::array<float,2>{0.527882814f, 0.305418193f},
-std::array<float,2>{0.128486574f, 0.530156493f},
-std::array<float,2>{0.258211046f, 0.0883780643f},
-std::array<float,2>{0.951749265f, 0.987808108f},
-std::array<float,2>{0.869949818f, 0.248294219f},
-std::array<float,2>{0.477008671f, 0.841814816f},
-std::array<float,2>{0.0165311005f, 0.405432403f},
-std::array<float,2>{0.661245465f, 0.630663276f},
-std::array<float,2>{0.68660301f, 0.211533129f},
-std::array<float,2>{0.00625355868f, 0.864292324f},
-std::array<float,2>{0.493938476f, 0.409536779f},
-std::array<float,2>{0.849324048f, 0.662934899f},
-std::array<float,2>{0.968695521f, 0.265365839f},
-std::array<float,2>{0.275820524f, 0.546374142f},
-std::array<float,2>{0.155899018f, 0.0991211459f},
-std::array<float,2>{0.510156453f, 0.943969131f},
-std::array<float,2>{0.613107443f, 0.451679528f},
-std::array<float,2>{0.246439591f, 0.715104699f},
-std::array<float,2>{0.339443147f, 0.169368416f},
-std::array<float,2>{0.877382219f, 0.75845468f},
-std::array<float,2>{0.806496978f, 0.029563453f},
-std::array<float,2>{0.386657059f, 0.93381232f},
-std::array<float,2>{0.122018158f, 0.320025921f},
-std::array<float,2>{0.696036696f, 0.564213514f},
-std::array<float,2>{0.55111438f, 0.0722610801f},
-std::array<float,2>{0.157281235f, 0.981937766f},
-std::array<float,2>{0.288275689f, 0.287646145f},
-std::array<float,2>{0.987992764f, 0.511599004f},
-std::array<float,2>{0.825413048f, 0.376666933f},
-std::array<float,2>{0.454767197f, 0.646940887f},
-std::array<float,2>{0.0534140766f, 0.222324684f},
-std::array<float,2>{0.642081916f, 0.816253662f},
-std::array<float,2>{0.7326352f, 0.363101125f},
-std::array<float,2>{0.0630320162f, 0.621800184f},
-std::array<float,2>{0.420828223f, 0.0467495881f},
-std::array<float,2>{0.774231315f, 0.902995288f},
-std::array<float,2>{0.924724996f, 0.135842219f},
-std::array<float,2>{0.374924064f, 0.79488039f},
-std::array<float,2>{0.204335004f, 0.499497265f},
-std::array<float,2>{0.572437108f, 0.734129846f},
-std::array<float,2>{0.622163534f, 0.194066316f},
-std::array<float,2>{0.240496993f, 0.845263839f},
-std::array<float,2>{0.329854637f, 0.423331618f},
-std::array<float,2>{0.885831833f, 0.675452173f},
-std::array<float,2>{0.80191052f, 0.266955763f},
-std::array<float,2>{0.377514541f, 0.551776171f},
-std::array<float,2>{0.115893781f, 0.115826257f},
-std::array<float,2>{0.688037336f, 0.962787032f},
-std::array<float,2>{0.67821312f, 0.454425126f},
-std::array<float,2>{0.0128485262f, 0.691943347f},
-std::array<float,2>{0.489997506f, 0.182065785f},
-std::array<float,2>{0.856954575f, 0.768024862f},
-std::array<float,2>{0.960169196f, 0.00684493873f},
-std::array<float,2>{0.267052531f, 0.910725772f},
-std::array<float,2>{0.146335885f, 0.331336021f},
-std::array<float,2>{0.501664758f, 0.581662595f},
-std::array<float,2>{0.724528134f, 0.0923487321f},
-std::array<float,2>{0.0724605396f, 0.988582551f},
-std::array<float,2>{0.406426549f, 0.311548799f},
-std::array<float,2>{0.771797121f, 0.524876058f},
-std::array<float,2>{0.9351089f, 0.399133921f},
-std::array<float,2>{0.360408127f, 0.62569195f},
-std::array<float,2>{0.211432725f, 0.244138375f},
-std::array<float,2>{0.563874424f, 0.837030947f},
-std::array<float,2>{0.557579458f, 0.345908284f},
-std::array<float,2>{0.166144401f, 0.594180286f},
-std::array<float,2>{0.296851575f, 0.0580262281f},
-std::array<float,2>{0.998301089f, 0.876160324f},
-std::array<float,2>{0.820015252f, 0.149687558f},
-std::array<float,2>{0.462910771f, 0.80200249f},
-std::array<float,2>{0.055581402f, 0.479271531f},
-std::array<float,2>{0.64931941f, 0.740133107f},
-std::array<float,2>{0.630247533f, 0.167444959f},
-std::array<float,2>{0.0381215997f, 0.764953196f},
-std::array<float,2>{0.445110619f, 0.446163058f},
-std::array<float,2>{0.836373985f, 0.712194383f},
-std::array<float,2>{0.976889729f, 0.315232098f},
-std::array<float,2>{0.29832077f, 0.570071459f},
-std::array<float,2>{0.17651327f, 0.024784809f},
-std::array<float,2>{0.54201442f, 0.932004154f},
-std::array<float,2>{0.584112465f, 0.411372513f},
-std::array<float,2>{0.199998438f, 0.656635106f},
-std::array<float,2>{0.353504211f, 0.218209028f},
-std::array<float,2>{0.917413831f, 0.863206267f},
-std::array<float,2>{0.763695598f, 0.0971700847f},
-std::array<float,2>{0.429646879f, 0.938145339f},
-std::array<float,2>{0.0787969679f, 0.261473596f},
-std::array<float,2>{0.735457897f, 0.539631546f},
-std::array<float,2>{0.516156375f, 0.0428484567f},
-std::array<float,2>{0.133826211f, 0.899543583f},
-std::array<float,2>{0.251944691f, 0.366435528f},
-std::array<float,2>{0.940885723f, 0.620220363f},
-std::array<float,2>{0.86564523f, 0.49515903f},
-std::array<float,2>{0.469430923f, 0.726919353f},
-std::array<float,2>{0.0284779966f, 0.136796281f},
-std::array<float,2>{0.666082442f, 0.79071939f},
-std::array<float,2>{0.706073344f, 0.282345623f},
-std::array<float,2>{0.101979785f, 0.512073994f},
-std::array<float,2>{0.400441378f, 0.0770462751f},
-std::array<float,2>{0.790976763f, 0.976998031f},
-std::array<float,2>{0.900287211f, 0.222894385f},
-std::array<float,2>{0.321760118f, 0.819879889f},
-std::array<float,2>{0.232720137f, 0.382401317f},
-std::array<float,2>{0.60828495f, 0.643800259f},
-std::array<float,2>{0.537151933f, 0.132443726f},
-std::array<float,2>{0.185198903f, 0.786102235f},
-std::array<float,2>{0.305314928f, 0.487119496f},
-std::array<float,2>{0.975361526f, 0.719604254f},
-std::array<float,2>{0.835789323f, 0.369605184f},
-std::array<float,2>{0.451999366f, 0.615585148f},
-std::array<float,2>{0.0435468629f, 0.0322908424f},
-std::array<float,2>{0.634071112f, 0.897247732f},
-std::array<float,2>{0.744763553f, 0.38688001f},
-std::array<float,2>{0.0928987414f, 0.654576004f},
-std::array<float,2>{0.435808599f, 0.231213927f},
-std::array<float,2>{0.751463473f, 0.822871983f},
-std::array<float,2>{0.912341416f, 0.0673187524f},
-std::array<float,2>{0.346590132f, 0.974980414f},
-std::array<float,2>{0.189866737f, 0.29432252f},
-std::array<float,2>{0.588515341f, 0.50596714f},
-std::array<float,2>{0.658488512f, 0.0175047014f},
-std::array<float,2>{0.0231019966f, 0.922662258f},
-std::array<float,2>{0.48361659f, 0.322915465f},
-std::array<float,2>{0.874992907f, 0.578047156f},
-std::array<float,2>{0.946775854f, 0.443764925f},
-std::array<float,2>{0.261956245f, 0.703693449f},
-std::array<float,2>{0.130752251f, 0.156664118f},
-std::array<float,2>{0.524298549f, 0.750671685f},
-std::array<float,2>{0.599226594f, 0.252661228f},
-std::array<float,2>{0.221232504f, 0.533235073f},
-std::array<float,2>{0.313150674f, 0.103367947f},
-std::array<float,2>{0.898393869f, 0.94732517f},
-std::array<float,2>{0.785872698f, 0.205078095f},
-std::array<float,2>{0.395577133f, 0.867522418f},
-std::array<float,2>{0.101202779f, 0.421653718f},
-std::array<float,2>{0.712262928f, 0.664808214f},
-std::array<float,2>{0.702148378f, 0.238209188f},
-std::array<float,2>{0.12021409f, 0.831445098f},
-std::array<float,2>{0.387473106f, 0.391381204f},
-std::array<float,2>{0.811452329f, 0.635476649f},
-std::array<float,2>{0.881580353f, 0.299503595f},
-std::array<float,2>{0.342771292f, 0.52081883f},
-std::array<float,2>{0.244093761f, 0.0805176198f},
-std::array<float,2>{0.61563319f, 0.994295061f},
-std::array<float,2>{0.513634622f, 0.475161701f},
-std::array<float,2>{0.149899527f, 0.743245721f},
-std::array<float,2>{0.277957767f, 0.146748468f},
-std::array<float,2>{0.961283982f, 0.805168033f},
-std::array<float,2>{0.845836878f, 0.052805379f},
-std::array<float,2>{0.496795446f, 0.887947381f},
-std::array<float,2>{0.000824931427f, 0.355715096f},
-std::array<float,2>{0.682633579f, 0.606364846f},
-std::array<float,2>{0.575523436f, 0.119342022f},
-std::array<float,2>{0.210672796f, 0.959247589f},
-std::array<float,2>{0.367238224f, 0.280094594f},
-std::array<float,2>{0.928488255f, 0.558946908f},
-std::array<float,2>{0.779872775f, 0.434279412f},
-std::array<float,2>{0.416848332f, 0.68666023f},
-std::array<float,2>{0.0670639127f, 0.20255594f},
-std::array<float,2>{0.728204966f, 0.856527448f},
-std::array<float,2>{0.646575332f, 0.33807081f},
-std::array<float,2>{0.0502983741f, 0.592905343f},
-std::array<float,2>{0.459989101f, 0.0135439374f},
-std::array<float,2>{0.821842015f, 0.919210196f},
-std::array<float,2>{0.99002564f, 0.177830175f},
-std::array<float,2>{0.28141728f, 0.775666237f},
-std::array<float,2>{0.163646609f, 0.468276173f},
-std::array<float,2>{0.548122346f, 0.695796013f},
-std::array<float,2>{0.561707377f, 0.210487664f},
-std::array<float,2>{0.170035973f, 0.872441232f},
-std::array<float,2>{0.289654493f, 0.414877176f},
-std::array<float,2>{0.993446112f, 0.669787884f},
-std::array<float,2>{0.813521504f, 0.255214989f},
-std::array<float,2>{0.467005998f, 0.535320222f},
-std::array<float,2>{0.0596466213f, 0.107226476f},
-std::array<float,2>{0.654664338f, 0.95083195f},
-std::array<float,2>{0.721088767f, 0.440556586f},
-std::array<float,2>{0.0746956468f, 0.707706094f},
-std::array<float,2>{0.411139011f, 0.162094131f},
-std::array<float,2>{0.768001318f, 0.754304767f},
-std::array<float,2>{0.932979167f, 0.0196400154f},
-std::array<float,2>{0.365379125f, 0.92899847f},
-std::array<float,2>{0.215483978f, 0.324826837f},
-std::array<float,2>{0.570161819f, 0.571405113f},
-std::array<float,2>{0.672203422f, 0.0659909397f},
-std::array<float,2>{0.00915770233f, 0.972113609f},
-std::array<float,2>{0.485889494f, 0.290490717f},
-std::array<float,2>{0.853123784f, 0.500285566f},
-std::array<float,2>{0.953850389f, 0.386491328f},
-std::array<float,2>{0.270094395f, 0.65040648f},
-std::array<float,2>{0.140972629f, 0.227030486f},
-std::array<float,2>{0.50484997f, 0.825132966f},
-std::array<float,2>{0.618975878f, 0.374466956f},
-std::array<float,2>{0.23572728f, 0.61003834f},
-std::array<float,2>{0.333375573f, 0.0359069221f},
-std::array<float,2>{0.887661219f, 0.892070651f},
-std::array<float,2>{0.797309756f, 0.125656202f},
-std::array<float,2>{0.380655527f, 0.784148574f},
-std::array<float,2>{0.110633969f, 0.490027666f},
-std::array<float,2>{0.691646516f, 0.723975062f},
-std::array<float,2>{0.708250582f, 0.175579578f},
-std::array<float,2>{0.10666541f, 0.779009581f},
-std::array<float,2>{0.403270185f, 0.464134246f},
-std::array<float,2>{0.794461548f, 0.699368238f},
-std::array<float,2>{0.904392779f, 0.343391508f},
-std::array<float,2>{0.326493442f, 0.587919176f},
-std::array<float,2>{0.227584764f, 0.00825625937f},
-std::array<float,2>{0.602639675f, 0.915771604f},
-std::array<float,2>{0.520121574f, 0.431159824f},
-std::array<float,2>{0.138528839f, 0.683145404f},
-std::array<float,2>{0.257375687f, 0.19634752f},
-std::array<float,2>{0.944317639f, 0.852219105f},
-std::array<float,2>{0.862190723f, 0.122348428f},
-std::array<float,2>{0.47349894f, 0.956719935f},
-std::array<float,2>{0.0248936173f, 0.276278555f},
-std::array<float,2>{0.668907344f, 0.554730952f},
-std::array<float,2>{0.579955459f, 0.0484817512f},
-std::array<float,2>{0.199011222f, 0.883100927f},
-std::array<float,2>{0.358853787f, 0.352584451f},
-std::array<float,2>{0.919799685f, 0.604569972f},
-std::array<float,2>{0.761644363f, 0.470502079f},
-std::array<float,2>{0.424381733f, 0.748766184f},
-std::array<float,2>{0.0824984461f, 0.140738592f},
-std::array<float,2>{0.738364995f, 0.811877072f},
-std::array<float,2>{0.628217161f, 0.303135544f},
-std::array<float,2>{0.0336037055f, 0.519122303f},
-std::array<float,2>{0.440385133f, 0.0852067769f},
-std::array<float,2>{0.843422055f, 0.996679306f},
-std::array<float,2>{0.98142308f, 0.241185397f},
-std::array<float,2>{0.30384028f, 0.834143519f},
-std::array<float,2>{0.172774389f, 0.398385316f},
-std::array<float,2>{0.543272138f, 0.637801826f},
-std::array<float,2>{0.597540915f, 0.153560191f},
-std::array<float,2>{0.226340562f, 0.798736811f},
-std::array<float,2>{0.318293393f, 0.480831951f},
-std::array<float,2>{0.890979648f, 0.737302482f},
-std::array<float,2>{0.781642854f, 0.351481467f},
-std::array<float,2>{0.394031107f, 0.601186454f},
-std::array<float,2>{0.0973298028f, 0.0602053255f},
-std::array<float,2>{0.718051016f, 0.882367373f},
-std::array<float,2>{0.662291765f, 0.404019654f},
-std::array<float,2>{0.0194111187f, 0.632760704f},
-std::array<float,2>{0.480116844f, 0.247220486f},
-std::array<float,2>{0.8675282f, 0.841379404f},
-std::array<float,2>{0.94953239f, 0.0860439613f},
-std::array<float,2>{0.260081351f, 0.985575199f},
-std::array<float,2>{0.126876101f, 0.306818217f},
-std::array<float,2>{0.53052479f, 0.528729498f},
-std::array<float,2>{0.746762335f, 0.000550264958f},
-std::array<float,2>{0.0860857591f, 0.90703994f},
-std::array<float,2>{0.430111915f, 0.334945887f},
-std::array<float,2>{0.757469177f, 0.584444463f},
-std::array<float,2>{0.906578422f, 0.459473312f},
-std::array<float,2>{0.350302935f, 0.691156328f},
-std::array<float,2>{0.195303515f, 0.184421539f},
-std::array<float,2>{0.591373622f, 0.769704342f},
-std::array<float,2>{0.534579396f, 0.273114592f},
-std::array<float,2>{0.180173412f, 0.54990989f},
-std::array<float,2>{0.310938179f, 0.110998988f},
-std::array<float,2>{0.971982896f, 0.967335522f},
-std::array<float,2>{0.831175506f, 0.188495398f},
-std::array<float,2>{0.445944309f, 0.850595593f},
-std::array<float,2>{0.0392654762f, 0.429493129f},
-std::array<float,2>{0.636739254f, 0.677044809f},
-std::array<float,2>{0.643107891f, 0.220344812f},
-std::array<float,2>{0.0510524251f, 0.813361883f},
-std::array<float,2>{0.456336081f, 0.378359765f},
-std::array<float,2>{0.826657474f, 0.645890296f},
-std::array<float,2>{0.98550266f, 0.286307961f},
-std::array<float,2>{0.286098868f, 0.508347511f},
-std::array<float,2>{0.158291429f, 0.0735296905f},
-std::array<float,2>{0.553417027f, 0.983957171f},
-std::array<float,2>{0.571974039f, 0.497692853f},
-std::array<float,2>{0.20652169f, 0.732067108f},
-std::array<float,2>{0.372111112f, 0.134476691f},
-std::array<float,2>{0.922208905f, 0.796843231f},
-std::array<float,2>{0.775669336f, 0.0435964838f},
-std::array<float,2>{0.41840446f, 0.904382885f},
-std::array<float,2>{0.0644823834f, 0.359485209f},
-std::array<float,2>{0.731469572f, 0.623782516f},
-std::array<float,2>{0.508912921f, 0.100977093f},
-std::array<float,2>{0.152489871f, 0.943193734f},
-std::array<float,2>{0.275276691f, 0.262731254f},
-std::array<float,2>{0.965709388f, 0.544894993f},
-std::array<float,2>{0.851027012f, 0.407863051f},
-std::array<float,2>{0.494323701f, 0.661913335f},
-std::array<float,2>{0.00511479052f, 0.213390604f},
-std::array<float,2>{0.684916496f, 0.866763473f},
-std::array<float,2>{0.697900534f, 0.31643486f},
-std::array<float,2>{0.123484023f, 0.565281928f},
-std::array<float,2>{0.384646684f, 0.0291819833f},
-std::array<float,2>{0.807728827f, 0.936028242f},
-std::array<float,2>{0.876366556f, 0.170026973f},
-std::array<float,2>{0.337502867f, 0.760314465f},
-std::array<float,2>{0.249463871f, 0.449648291f},
-std::array<float,2>{0.610378325f, 0.71805191f},
-std::array<float,2>{0.564943314f, 0.245956153f},
-std::array<float,2>{0.21413736f, 0.838074803f},
-std::array<float,2>{0.363011718f, 0.400482655f},
-std::array<float,2>{0.936823189f, 0.62794584f},
-std::array<float,2>{0.770763397f, 0.308767021f},
-std::array<float,2>{0.409753561f, 0.526447594f},
-std::array<float,2>{0.0714758709f, 0.091443263f},
-std::array<float,2>{0.725740254f, 0.990315318f},
-std::array<float,2>{0.652214587f, 0.478022575f},
-std::array<float,2>{0.0584190525f, 0.740747809f},
-std::array<float,2>{0.461928546f, 0.150484666f},
-std::array<float,2>{0.816493094f, 0.804008365f},
-std::array<float,2>{0.996968329f, 0.0557751134f},
-std::array<float,2>{0.2930668f, 0.877371788f},
-std::array<float,2>{0.165505886f, 0.344391704f},
-std::array<float,2>{0.55585438f, 0.596385837f},
-std::array<float,2>{0.690105617f, 0.113994777f},
-std::array<float,2>{0.115177885f, 0.963964999f},
-std::array<float,2>{0.375138193f, 0.269362271f},
-std::array<float,2>{0.804385424f, 0.554186642f},
-std::array<float,2>{0.883584321f, 0.425411373f},
-std::array<float,2>{0.330913424f, 0.672475636f},
-std::array<float,2>{0.239435017f, 0.191536456f},
-std::array<float,2>{0.623519123f, 0.847228944f},
-std::array<float,2>{0.503213167f, 0.329999417f},
-std::array<float,2>{0.148273304f, 0.580033064f},
-std::array<float,2>{0.268898159f, 0.00537501229f},
-std::array<float,2>{0.957242668f, 0.91242075f},
-std::array<float,2>{0.857755899f, 0.181476101f},
-std::array<float,2>{0.490345985f, 0.766379952f},
-std::array<float,2>{0.0145252747f, 0.456674308f},
-std::array<float,2>{0.676493049f, 0.693462253f},
-std::array<float,2>{0.664568722f, 0.139409691f},
-std::array<float,2>{0.0297179986f, 0.792425573f},
-std::array<float,2>{0.471155435f, 0.492544621f},
-std::array<float,2>{0.86519599f, 0.728653371f},
-std::array<float,2>{0.939190447f, 0.364159077f},
-std::array<float,2>{0.253315836f, 0.617480099f},
-std::array<float,2>{0.134951264f, 0.0409566015f},
-std::array<float,2>{0.519191384f, 0.90073061f},
-std::array<float,2>{0.606355846f, 0.379104227f},
-std::array<float,2>{0.232350752f, 0.64105159f},
-std::array<float,2>{0.323340207f, 0.225127622f},
-std::array<float,2>{0.901275992f, 0.818026781f},
-std::array<float,2>{0.79226476f, 0.0756022409f},
-std::array<float,2>{0.399098188f, 0.979944825f},
-std::array<float,2>{0.105411053f, 0.283272564f},
-std::array<float,2>{0.70492065f, 0.514238775f},
-std::array<float,2>{0.540133655f, 0.0265544709f},
-std::array<float,2>{0.178997993f, 0.930148661f},
-std::array<float,2>{0.300310284f, 0.313335061f},
-std::array<float,2>{0.979591012f, 0.566424727f},
-std::array<float,2>{0.839779615f, 0.449157417f},
-std::array<float,2>{0.442435384f, 0.713026822f},
-std::array<float,2>{0.0371072181f, 0.164538711f},
-std::array<float,2>{0.632031739f, 0.763136268f},
-std::array<float,2>{0.73731488f, 0.258773983f},
-std::array<float,2>{0.080751881f, 0.542010367f},
-std::array<float,2>{0.426190823f, 0.0945239961f},
-std::array<float,2>{0.762973964f, 0.940146208f},
-std::array<float,2>{0.915404856f, 0.215289906f},
-std::array<float,2>{0.353629708f, 0.859488785f},
-std::array<float,2>{0.202226579f, 0.413435072f},
-std::array<float,2>{0.583066702f, 0.659452736f},
-std::array<float,2>{0.526398957f, 0.158867359f},
-std::array<float,2>{0.13207534f, 0.752554595f},
-std::array<float,2>{0.265197963f, 0.442128778f},
-std::array<float,2>{0.948140562f, 0.705783665f},
-std::array<float,2>{0.871346295f, 0.321986198f},
-std::array<float,2>{0.480955809f, 0.575099528f},
-std::array<float,2>{0.0198254474f, 0.0183263868f},
-std::array<float,2>{0.658198833f, 0.924676716f},
-std::array<float,2>{0.714282334f, 0.418865323f},
-std::array<float,2>{0.0981212407f, 0.667683065f},
-std::array<float,2>{0.39680931f, 0.20644407f},
-std::array<float,2>{0.788541794f, 0.87105602f},
-std::array<float,2>{0.894624174f, 0.103531905f},
-std::array<float,2>{0.314823747f, 0.945558846f},
-std::array<float,2>{0.219422013f, 0.250549138f},
-std::array<float,2>{0.601098716f, 0.532521009f},
-std::array<float,2>{0.636182606f, 0.0339315459f},
-std::array<float,2>{0.0456100293f, 0.895711124f},
-std::array<float,2>{0.449587613f, 0.368379295f},
-std::array<float,2>{0.832843065f, 0.615000963f},
-std::array<float,2>{0.974594176f, 0.484692484f},
-std::array<float,2>{0.30858174f, 0.722373903f},
-std::array<float,2>{0.1859539f, 0.130568773f},
-std::array<float,2>{0.535858452f, 0.788169265f},
-std::array<float,2>{0.587238908f, 0.295724422f},
-std::array<float,2>{0.188636765f, 0.504637957f},
-std::array<float,2>{0.343925118f, 0.0684012026f},
-std::array<float,2>{0.911679983f, 0.97406584f},
-std::array<float,2>{0.753441215f, 0.234009042f},
-std::array<float,2>{0.433983535f, 0.820584178f},
-std::array<float,2>{0.0916242748f, 0.388819069f},
-std::array<float,2>{0.742484987f, 0.653664231f},
-std::array<float,2>{0.728837311f, 0.200941041f},
-std::array<float,2>{0.0690739751f, 0.858877122f},
-std::array<float,2>{0.414421618f, 0.435558617f},
-std::array<float,2>{0.778471589f, 0.683909059f},
-std::array<float,2>{0.927309036f, 0.278390378f},
-std::array<float,2>{0.369227082f, 0.561349869f},
-std::array<float,2>{0.20886068f, 0.118089952f},
-std::array<float,2>{0.576430857f, 0.958106995f},
-std::array<float,2>{0.549028158f, 0.465525806f},
-std::array<float,2>{0.161634937f, 0.697786033f},
-std::array<float,2>{0.284747034f, 0.175992489f},
-std::array<float,2>{0.991410613f, 0.773909152f},
-std::array<float,2>{0.823271036f, 0.0146293705f},
-std::array<float,2>{0.457165927f, 0.920583725f},
-std::array<float,2>{0.0476384275f, 0.336548179f},
-std::array<float,2>{0.645103097f, 0.590360701f},
-std::array<float,2>{0.614646316f, 0.0786224455f},
-std::array<float,2>{0.245365918f, 0.993561506f},
-std::array<float,2>{0.340530813f, 0.298065633f},
-std::array<float,2>{0.879791141f, 0.522542179f},
-std::array<float,2>{0.809773624f, 0.39452526f},
-std::array<float,2>{0.389579773f, 0.633652627f},
-std::array<float,2>{0.118289948f, 0.235929921f},
-std::array<float,2>{0.700035989f, 0.828193247f},
-std::array<float,2>{0.681004763f, 0.358936608f},
-std::array<float,2>{0.00390561344f, 0.607658207f},
-std::array<float,2>{0.49988848f, 0.0522798337f},
-std::array<float,2>{0.844012141f, 0.889152467f},
-std::array<float,2>{0.96354115f, 0.145798832f},
-std::array<float,2>{0.280293345f, 0.808135271f},
-std::array<float,2>{0.151805401f, 0.473436803f},
-std::array<float,2>{0.51521647f, 0.744352639f},
-std::array<float,2>{0.553103983f, 0.221706375f},
-std::array<float,2>{0.158803403f, 0.815722167f},
-std::array<float,2>{0.285180718f, 0.376225889f},
-std::array<float,2>{0.986057043f, 0.647094727f},
-std::array<float,2>{0.826892018f, 0.287593216f},
-std::array<float,2>{0.456637204f, 0.511191547f},
-std::array<float,2>{0.0516322851f, 0.0715930387f},
-std::array<float,2>{0.642883837f, 0.981828392f},
-std::array<float,2>{0.732113004f, 0.499790341f},
-std::array<float,2>{0.0649708435f, 0.733779907f},
-std::array<float,2>{0.418893963f, 0.136583254f},
-std::array<float,2>{0.776333034f, 0.794294596f},
-std::array<float,2>{0.922387004f, 0.0462107882f},
-std::array<float,2>{0.373043507f, 0.902782917f},
-std::array<float,2>{0.206994995f, 0.362338603f},
-std::array<float,2>{0.571686208f, 0.621239424f},
-std::array<float,2>{0.685239077f, 0.0986792371f},
-std::array<float,2>{0.00555914221f, 0.943445981f},
-std::array<float,2>{0.494692087f, 0.265063882f},
-std::array<float,2>{0.85142839f, 0.546720505f},
-std::array<float,2>{0.964944124f, 0.409696698f},
-std::array<float,2>{0.274446011f, 0.662534416f},
-std::array<float,2>{0.153009787f, 0.210951388f},
-std::array<float,2>{0.509538412f, 0.865015864f},
-std::array<float,2>{0.611150622f, 0.319402218f},
-std::array<float,2>{0.249687001f, 0.563811421f},
-std::array<float,2>{0.337105691f, 0.0302375406f},
-std::array<float,2>{0.876577735f, 0.934264243f},
-std::array<float,2>{0.808348715f, 0.169891015f},
-std::array<float,2>{0.384063542f, 0.758087397f},
-std::array<float,2>{0.124006473f, 0.45120585f},
-std::array<float,2>{0.697577775f, 0.715459049f},
-std::array<float,2>{0.718285501f, 0.15446353f},
-std::array<float,2>{0.0967038944f, 0.800221324f},
-std::array<float,2>{0.394360721f, 0.48244229f},
-std::array<float,2>{0.782115281f, 0.735231042f},
-std::array<float,2>{0.891194999f, 0.348179191f},
-std::array<float,2>{0.317420632f, 0.597759843f},
-std::array<float,2>{0.225825921f, 0.0605495758f},
-std::array<float,2>{0.597073972f, 0.879809141f},
-std::array<float,2>{0.531104922f, 0.40615356f},
-std::array<float,2>{0.126184255f, 0.630033135f},
-std::array<float,2>{0.260270596f, 0.248822972f},
-std::array<float,2>{0.949751794f, 0.842407048f},
-std::array<float,2>{0.868054271f, 0.0884932727f},
-std::array<float,2>{0.479975253f, 0.987659693f},
-std::array<float,2>{0.018916402f, 0.304943919f},
-std::array<float,2>{0.663008273f, 0.529754043f},
-std::array<float,2>{0.591013074f, 0.00321312505f},
-std::array<float,2>{0.194422349f, 0.908453286f},
-std::array<float,2>{0.350088269f, 0.333381981f},
-std::array<float,2>{0.906825364f, 0.582071185f},
-std::array<float,2>{0.757299185f, 0.457176358f},
-std::array<float,2>{0.430260122f, 0.689418435f},
-std::array<float,2>{0.0866775662f, 0.187387452f},
-std::array<float,2>{0.746309876f, 0.773160577f},
-std::array<float,2>{0.637631297f, 0.270598084f},
-std::array<float,2>{0.0398859568f, 0.548280418f},
-std::array<float,2>{0.445693552f, 0.112057775f},
-std::array<float,2>{0.831701756f, 0.965574145f},
-std::array<float,2>{0.972218335f, 0.190786809f},
-std::array<float,2>{0.311511993f, 0.849388242f},
-std::array<float,2>{0.180298507f, 0.426815033f},
-std::array<float,2>{0.534710586f, 0.679502785f},
-std::array<float,2>{0.603465021f, 0.173020065f},
-std::array<float,2>{0.228284821f, 0.779810071f},
-std::array<float,2>{0.326766104f, 0.461456358f},
-std::array<float,2>{0.905217826f, 0.701796174f},
-std::array<float,2>{0.794381082f, 0.340860069f},
-std::array<float,2>{0.402632117f, 0.586901128f},
-std::array<float,2>{0.107130036f, 0.0101258233f},
-std::array<float,2>{0.708510458f, 0.916180372f},
-std::array<float,2>{0.668186307f, 0.432366937f},
-std::array<float,2>{0.0253301505f, 0.680168092f},
-std::array<float,2>{0.472761989f, 0.1973795f},
-std::array<float,2>{0.861572385f, 0.854493022f},
-std::array<float,2>{0.943563581f, 0.12389645f},
-std::array<float,2>{0.25723958f, 0.953168154f},
-std::array<float,2>{0.138176024f, 0.273492962f},
-std::array<float,2>{0.519663155f, 0.558505893f},
-std::array<float,2>{0.739143729f, 0.050712496f},
-std::array<float,2>{0.082949549f, 0.885080397f},
-std::array<float,2>{0.424218684f, 0.354932874f},
-std::array<float,2>{0.760753512f, 0.601849139f},
-std::array<float,2>{0.919369996f, 0.471989393f},
-std::array<float,2>{0.359140426f, 0.747112811f},
-std::array<float,2>{0.19835943f, 0.142808676f},
-std::array<float,2>{0.579407632f, 0.809256017f},
-std::array<float,2>{0.54377681f, 0.302625954f},
-std::array<float,2>{0.172135249f, 0.516716897f},
-std::array<float,2>{0.304200083f, 0.0826356858f},
-std::array<float,2>{0.980673492f, 0.998523235f},
-std::array<float,2>{0.843092203f, 0.239317477f},
-std::array<float,2>{0.439754516f, 0.83371383f},
-std::array<float,2>{0.0341199972f, 0.394751519f},
-std::array<float,2>{0.628821433f, 0.640024185f},
-std::array<float,2>{0.654906929f, 0.208346218f},
-std::array<float,2>{0.060413029f, 0.873471916f},
-std::array<float,2>{0.467585832f, 0.41634652f},
-std::array<float,2>{0.813980341f, 0.671828747f},
-std::array<float,2>{0.994042933f, 0.256567627f},
-std::array<float,2>{0.289506078f, 0.537347853f},
-std::array<float,2>{0.17067875f, 0.109249614f},
-std::array<float,2>{0.562231839f, 0.952717245f},
-std::array<float,2>{0.56974566f, 0.438509494f},
-std::array<float,2>{0.215244353f, 0.709251523f},
-std::array<float,2>{0.366075993f, 0.163786992f},
-std::array<float,2>{0.933553636f, 0.75593704f},
-std::array<float,2>{0.76821506f, 0.0226910654f},
-std::array<float,2>{0.411653548f, 0.925849557f},
-std::array<float,2>{0.0749009922f, 0.327103376f},
-std::array<float,2>{0.72128278f, 0.573315501f},
-std::array<float,2>{0.504275918f, 0.0632907301f},
-std::array<float,2>{0.14129144f, 0.970445454f},
-std::array<float,2>{0.269824982f, 0.292373747f},
-std::array<float,2>{0.953196168f, 0.502488315f},
-std::array<float,2>{0.852712214f, 0.383025378f},
-std::array<float,2>{0.485690296f, 0.649332047f},
-std::array<float,2>{0.00974083319f, 0.229451403f},
-std::array<float,2>{0.672552884f, 0.827275932f},
-std::array<float,2>{0.692082584f, 0.372609049f},
-std::array<float,2>{0.111114509f, 0.61183244f},
-std::array<float,2>{0.380128801f, 0.0379842743f},
-std::array<float,2>{0.797659457f, 0.893774092f},
-std::array<float,2>{0.887001693f, 0.127217859f},
-std::array<float,2>{0.333824337f, 0.781962574f},
-std::array<float,2>{0.235867426f, 0.49044019f},
-std::array<float,2>{0.618544161f, 0.725194037f},
-std::array<float,2>{0.576790929f, 0.202844962f},
-std::array<float,2>{0.208440825f, 0.856953263f},
-std::array<float,2>{0.369731456f, 0.433812737f},
-std::array<float,2>{0.927221477f, 0.687421143f},
-std::array<float,2>{0.779144049f, 0.279526532f},
-std::array<float,2>{0.414737195f, 0.559139013f},
-std::array<float,2>{0.0687230676f, 0.119631343f},
-std::array<float,2>{0.729248643f, 0.959681869f},
-std::array<float,2>{0.644813776f, 0.468254268f},
-std::array<float,2>{0.0468979031f, 0.69615531f},
-std::array<float,2>{0.457822323f, 0.178633347f},
-std::array<float,2>{0.823889613f, 0.776073813f},
-std::array<float,2>{0.992124856f, 0.0131630944f},
-std::array<float,2>{0.284633368f, 0.919755757f},
-std::array<float,2>{0.16139932f, 0.338740349f},
-std::array<float,2>{0.549603581f, 0.593454719f},
-std::array<float,2>{0.69942975f, 0.0805930644f},
-std::array<float,2>{0.119063519f, 0.995043218f},
-std::array<float,2>{0.388922989f, 0.299218059f},
-std::array<float,2>{0.810247958f, 0.52111125f},
-std::array<float,2>{0.879280567f, 0.39087984f},
-std::array<float,2>{0.340147823f, 0.634992421f},
-std::array<float,2>{0.245853469f, 0.237320051f},
-std::array<float,2>{0.614821315f, 0.831927538f},
-std::array<float,2>{0.514651954f, 0.356105864f},
-std::array<float,2>{0.15187636f, 0.60593003f},
-std::array<float,2>{0.281223357f, 0.0532476678f},
-std::array<float,2>{0.963320434f, 0.888257146f},
-std::array<float,2>{0.844569206f, 0.147314176f},
-std::array<float,2>{0.499163061f, 0.805394709f},
-std::array<float,2>{0.00310446485f, 0.474813551f},
-std::array<float,2>{0.681452096f, 0.743880093f},
-std::array<float,2>{0.657507956f, 0.15711844f},
-std::array<float,2>{0.0202687792f, 0.750110447f},
-std::array<float,2>{0.481392622f, 0.444011182f},
-std::array<float,2>{0.872006118f, 0.7034747f},
-std::array<float,2>{0.947392106f, 0.322569817f},
-std::array<float,2>{0.264751524f, 0.577150285f},
-std::array<float,2>{0.132539913f, 0.0166293923f},
-std::array<float,2>{0.527212024f, 0.922255158f},
-std::array<float,2>{0.601074159f, 0.420922965f},
-std::array<float,2>{0.219050601f, 0.664443314f},
-std::array<float,2>{0.315258592f, 0.204568073f},
-std::array<float,2>{0.895425797f, 0.867701471f},
-std::array<float,2>{0.788826942f, 0.102547385f},
-std::array<float,2>{0.397408962f, 0.948135614f},
-std::array<float,2>{0.0983869359f, 0.2521213f},
-std::array<float,2>{0.714811265f, 0.534081697f},
-std::array<float,2>{0.535405278f, 0.0327848382f},
-std::array<float,2>{0.186091244f, 0.896937013f},
-std::array<float,2>{0.30810079f, 0.369831294f},
-std::array<float,2>{0.974048376f, 0.616030097f},
-std::array<float,2>{0.832497001f, 0.486806154f},
-std::array<float,2>{0.449898481f, 0.719051838f},
-std::array<float,2>{0.0450195372f, 0.132236481f},
-std::array<float,2>{0.636291683f, 0.785630047f},
-std::array<float,2>{0.742891252f, 0.294885129f},
-std::array<float,2>{0.0910972133f, 0.506750882f},
-std::array<float,2>{0.434258848f, 0.0664910674f},
-std::array<float,2>{0.753382027f, 0.975481808f},
-std::array<float,2>{0.911393762f, 0.230921313f},
-std::array<float,2>{0.344342947f, 0.822705388f},
-std::array<float,2>{0.189339086f, 0.387548953f},
-std::array<float,2>{0.587568462f, 0.654797792f},
-std::array<float,2>{0.518805265f, 0.137454331f},
-std::array<float,2>{0.135705084f, 0.790444434f},
-std::array<float,2>{0.253833592f, 0.495964229f},
-std::array<float,2>{0.938941002f, 0.727136433f},
-std::array<float,2>{0.864326537f, 0.367040396f},
-std::array<float,2>{0.471431643f, 0.621048152f},
-std::array<float,2>{0.0300029032f, 0.0420292765f},
-std::array<float,2>{0.664297342f, 0.900306702f},
-std::array<float,2>{0.704325914f, 0.382125288f},
-std::array<float,2>{0.104607888f, 0.644480467f},
-std::array<float,2>{0.398548305f, 0.223453119f},
-std::array<float,2>{0.792490125f, 0.81972599f},
-std::array<float,2>{0.900873661f, 0.0765895844f},
-std::array<float,2>{0.323977381f, 0.977161825f},
-std::array<float,2>{0.231739148f, 0.282831609f},
-std::array<float,2>{0.605741322f, 0.512414157f},
-std::array<float,2>{0.632675052f, 0.0250203423f},
-std::array<float,2>{0.0361855626f, 0.93239975f},
-std::array<float,2>{0.442901611f, 0.314832956f},
-std::array<float,2>{0.839131296f, 0.56956017f},
-std::array<float,2>{0.980447233f, 0.445480198f},
-std::array<float,2>{0.300128907f, 0.71256268f},
-std::array<float,2>{0.179449245f, 0.167849019f},
-std::array<float,2>{0.540874898f, 0.765322864f},
-std::array<float,2>{0.583931506f, 0.260886133f},
-std::array<float,2>{0.20266974f, 0.539281905f},
-std::array<float,2>{0.354273558f, 0.0969489068f},
-std::array<float,2>{0.91577971f, 0.937777042f},
-std::array<float,2>{0.763468146f, 0.218592569f},
-std::array<float,2>{0.426491648f, 0.862741411f},
-std::array<float,2>{0.0802084431f, 0.411815882f},
-std::array<float,2>{0.738275349f, 0.65698868f},
-std::array<float,2>{0.726266742f, 0.243613705f},
-std::array<float,2>{0.0720119327f, 0.837536395f},
-std::array<float,2>{0.409234911f, 0.398722738f},
-std::array<float,2>{0.771254838f, 0.625399888f},
-std::array<float,2>{0.937368512f, 0.312127352f},
-std::array<float,2>{0.362629235f, 0.524980903f},
-std::array<float,2>{0.214665145f, 0.0920535922f},
-std::array<float,2>{0.56488359f, 0.988776803f},
-std::array<float,2>{0.556408644f, 0.478769004f},
-std::array<float,2>{0.165610507f, 0.739294112f},
-std::array<float,2>{0.293657601f, 0.150092959f},
-std::array<float,2>{0.996104479f, 0.802604437f},
-std::array<float,2>{0.816992402f, 0.0582198054f},
-std::array<float,2>{0.462465703f, 0.876775384f},
-std::array<float,2>{0.0579159781f, 0.3464773f},
-std::array<float,2>{0.651729405f, 0.594685137f},
-std::array<float,2>{0.623775601f, 0.115554653f},
-std::array<float,2>{0.240006596f, 0.962293267f},
-std::array<float,2>{0.330406874f, 0.267389059f},
-std::array<float,2>{0.883264661f, 0.552313268f},
-std::array<float,2>{0.804168046f, 0.42351687f},
-std::array<float,2>{0.375525117f, 0.675104797f},
-std::array<float,2>{0.114604935f, 0.193492427f},
-std::array<float,2>{0.689931691f, 0.84485656f},
-std::array<float,2>{0.675936401f, 0.331946373f},
-std::array<float,2>{0.0141458372f, 0.581204832f},
-std::array<float,2>{0.490997583f, 0.00743907271f},
-std::array<float,2>{0.858323276f, 0.910463095f},
-std::array<float,2>{0.957800448f, 0.182589069f},
-std::array<float,2>{0.269482583f, 0.768069863f},
-std::array<float,2>{0.147662163f, 0.454621166f},
-std::array<float,2>{0.50363493f, 0.691546679f},
-std::array<float,2>{0.510284543f, 0.213339359f},
-std::array<float,2>{0.155649215f, 0.866360724f},
-std::array<float,2>{0.276101559f, 0.407563299f},
-std::array<float,2>{0.96791625f, 0.661570847f},
-std::array<float,2>{0.849113166f, 0.263431996f},
-std::array<float,2>{0.493204176f, 0.544257939f},
-std::array<float,2>{0.00672783284f, 0.101184748f},
-std::array<float,2>{0.68724215f, 0.942696035f},
-std::array<float,2>{0.695637524f, 0.449945241f},
-std::array<float,2>{0.121520661f, 0.718386829f},
-std::array<float,2>{0.385793865f, 0.170754299f},
-std::array<float,2>{0.805700123f, 0.759997427f},
-std::array<float,2>{0.877715528f, 0.0286237262f},
-std::array<float,2>{0.339339077f, 0.936306536f},
-std::array<float,2>{0.246997073f, 0.317261487f},
-std::array<float,2>{0.61249733f, 0.564779162f},
-std::array<float,2>{0.642126203f, 0.0738094077f},
-std::array<float,2>{0.0529841557f, 0.983826816f},
-std::array<float,2>{0.454368353f, 0.286849886f},
-std::array<float,2>{0.825958908f, 0.507879972f},
-std::array<float,2>{0.98756808f, 0.378520638f},
-std::array<float,2>{0.288904577f, 0.646457553f},
-std::array<float,2>{0.157958627f, 0.220133156f},
-std::array<float,2>{0.551644921f, 0.812585115f},
-std::array<float,2>{0.572874784f, 0.360218495f},
-std::array<float,2>{0.204951122f, 0.623460412f},
-std::array<float,2>{0.374439657f, 0.0433608107f},
-std::array<float,2>{0.924127877f, 0.905000269f},
-std::array<float,2>{0.773779571f, 0.134029195f},
-std::array<float,2>{0.419945657f, 0.796328664f},
-std::array<float,2>{0.0625641271f, 0.497095674f},
-std::array<float,2>{0.732958317f, 0.731538177f},
-std::array<float,2>{0.74996537f, 0.184022799f},
-std::array<float,2>{0.0888811648f, 0.770028472f},
-std::array<float,2>{0.432309747f, 0.459225684f},
-std::array<float,2>{0.75483042f, 0.690518916f},
-std::array<float,2>{0.908621252f, 0.334384412f},
-std::array<float,2>{0.347930789f, 0.584673166f},
-std::array<float,2>{0.192467883f, 0.000271434983f},
-std::array<float,2>{0.592733264f, 0.906365156f},
-std::array<float,2>{0.53238523f, 0.428931385f},
-std::array<float,2>{0.182244882f, 0.677688777f},
-std::array<float,2>{0.310208231f, 0.189261973f},
-std::array<float,2>{0.970375776f, 0.851241708f},
-std::array<float,2>{0.830014825f, 0.110665374f},
-std::array<float,2>{0.447898299f, 0.96695286f},
-std::array<float,2>{0.0419142768f, 0.2727229f},
-std::array<float,2>{0.639495432f, 0.550702631f},
-std::array<float,2>{0.59410882f, 0.0596068949f},
-std::array<float,2>{0.223389447f, 0.882180929f},
-std::array<float,2>{0.318550676f, 0.350699961f},
-std::array<float,2>{0.893090665f, 0.600761294f},
-std::array<float,2>{0.783866107f, 0.481376469f},
-std::array<float,2>{0.390698165f, 0.736789823f},
-std::array<float,2>{0.0945252255f, 0.154149294f},
-std::array<float,2>{0.714999139f, 0.798101068f},
-std::array<float,2>{0.661890149f, 0.307549953f},
-std::array<float,2>{0.0159573108f, 0.529129386f},
-std::array<float,2>{0.477272242f, 0.0869042724f},
-std::array<float,2>{0.869613767f, 0.985916197f},
-std::array<float,2>{0.951645076f, 0.247970372f},
-std::array<float,2>{0.258462906f, 0.841107368f},
-std::array<float,2>{0.128006652f, 0.403577656f},
-std::array<float,2>{0.52772671f, 0.632037997f},
-std::array<float,2>{0.580305457f, 0.141297027f},
-std::array<float,2>{0.196956784f, 0.812191963f},
-std::array<float,2>{0.35585475f, 0.469944268f},
-std::array<float,2>{0.919932246f, 0.748525083f},
-std::array<float,2>{0.759342074f, 0.353432387f},
-std::array<float,2>{0.422640502f, 0.605336487f},
-std::array<float,2>{0.0850794166f, 0.0479436778f},
-std::array<float,2>{0.742187262f, 0.883423865f},
-std::array<float,2>{0.626644075f, 0.397571176f},
-std::array<float,2>{0.0328741707f, 0.6385625f},
-std::array<float,2>{0.437923163f, 0.240617201f},
-std::array<float,2>{0.840922356f, 0.834727705f},
-std::array<float,2>{0.982444882f, 0.0857278332f},
-std::array<float,2>{0.302673548f, 0.996453404f},
-std::array<float,2>{0.175556213f, 0.303567737f},
-std::array<float,2>{0.545443177f, 0.519039273f},
-std::array<float,2>{0.710697651f, 0.00843106303f},
-std::array<float,2>{0.109279901f, 0.915062606f},
-std::array<float,2>{0.405548126f, 0.343129307f},
-std::array<float,2>{0.795114934f, 0.588798344f},
-std::array<float,2>{0.903520167f, 0.464757025f},
-std::array<float,2>{0.325699568f, 0.699776232f},
-std::array<float,2>{0.229390353f, 0.175110891f},
-std::array<float,2>{0.603712916f, 0.77861923f},
-std::array<float,2>{0.522602737f, 0.275644213f},
-std::array<float,2>{0.14012143f, 0.555350304f},
-std::array<float,2>{0.254795641f, 0.12284977f},
-std::array<float,2>{0.94271934f, 0.95651716f},
-std::array<float,2>{0.860440791f, 0.197051018f},
-std::array<float,2>{0.474703401f, 0.851809978f},
-std::array<float,2>{0.0257265829f, 0.43069014f},
-std::array<float,2>{0.671565056f, 0.68291235f},
-std::array<float,2>{0.675267339f, 0.227334157f},
-std::array<float,2>{0.0115095805f, 0.824465394f},
-std::array<float,2>{0.487306267f, 0.385883093f},
-std::array<float,2>{0.853995025f, 0.651053607f},
-std::array<float,2>{0.955718398f, 0.290546477f},
-std::array<float,2>{0.272742689f, 0.500560939f},
-std::array<float,2>{0.144385815f, 0.0655132681f},
-std::array<float,2>{0.506868184f, 0.972185016f},
-std::array<float,2>{0.620915532f, 0.489396155f},
-std::array<float,2>{0.238208264f, 0.724281013f},
-std::array<float,2>{0.335425287f, 0.125047922f},
-std::array<float,2>{0.889941156f, 0.783290207f},
-std::array<float,2>{0.799585164f, 0.0356033891f},
-std::array<float,2>{0.381639004f, 0.892551303f},
-std::array<float,2>{0.112233587f, 0.374600798f},
-std::array<float,2>{0.694225252f, 0.609717727f},
-std::array<float,2>{0.559019029f, 0.106467061f},
-std::array<float,2>{0.168376952f, 0.950406551f},
-std::array<float,2>{0.292580098f, 0.255635053f},
-std::array<float,2>{0.994869828f, 0.535700917f},
-std::array<float,2>{0.81603086f, 0.414122552f},
-std::array<float,2>{0.465398341f, 0.669216573f},
-std::array<float,2>{0.0616727024f, 0.210263416f},
-std::array<float,2>{0.652812064f, 0.872887552f},
-std::array<float,2>{0.71898973f, 0.324493736f},
-std::array<float,2>{0.0772710368f, 0.57190001f},
-std::array<float,2>{0.413681298f, 0.0202691238f},
-std::array<float,2>{0.766817629f, 0.929453135f},
-std::array<float,2>{0.930436194f, 0.161432028f},
-std::array<float,2>{0.364160389f, 0.754841149f},
-std::array<float,2>{0.217611164f, 0.441064119f},
-std::array<float,2>{0.566545904f, 0.707145333f},
-std::array<float,2>{0.615805149f, 0.235451192f},
-std::array<float,2>{0.243403643f, 0.828956962f},
-std::array<float,2>{0.342261612f, 0.393927842f},
-std::array<float,2>{0.880990446f, 0.633275092f},
-std::array<float,2>{0.810659945f, 0.29878509f},
-std::array<float,2>{0.386957884f, 0.523302138f},
-std::array<float,2>{0.1209049f, 0.0786011666f},
-std::array<float,2>{0.701307178f, 0.993995368f},
-std::array<float,2>{0.683190167f, 0.472705513f},
-std::array<float,2>{0.0004147664f, 0.744829595f},
-std::array<float,2>{0.496491849f, 0.14613758f},
-std::array<float,2>{0.846389353f, 0.807850838f},
-std::array<float,2>{0.961516261f, 0.0521900691f},
-std::array<float,2>{0.277473152f, 0.88942188f},
-std::array<float,2>{0.150233284f, 0.358653903f},
-std::array<float,2>{0.512832642f, 0.608268082f},
-std::array<float,2>{0.727844954f, 0.117646232f},
-std::array<float,2>{0.0667002276f, 0.958688557f},
-std::array<float,2>{0.416459709f, 0.278847575f},
-std::array<float,2>{0.77976048f, 0.560592532f},
-std::array<float,2>{0.928207517f, 0.436219931f},
-std::array<float,2>{0.367980361f, 0.684121311f},
-std::array<float,2>{0.210417956f, 0.200614288f},
-std::array<float,2>{0.576141357f, 0.859259069f},
-std::array<float,2>{0.548775136f, 0.336415499f},
-std::array<float,2>{0.163360417f, 0.5898996f},
-std::array<float,2>{0.281843901f, 0.0140486239f},
-std::array<float,2>{0.989550948f, 0.919983149f},
-std::array<float,2>{0.821371138f, 0.17656213f},
-std::array<float,2>{0.460570037f, 0.773998022f},
-std::array<float,2>{0.0502913892f, 0.465145707f},
-std::array<float,2>{0.647253931f, 0.697403312f},
-std::array<float,2>{0.634705067f, 0.130167961f},
-std::array<float,2>{0.0433721505f, 0.788847446f},
-std::array<float,2>{0.451379299f, 0.485142857f},
-std::array<float,2>{0.835189223f, 0.721751392f},
-std::array<float,2>{0.974621475f, 0.36879006f},
-std::array<float,2>{0.305052042f, 0.614514709f},
-std::array<float,2>{0.184804097f, 0.0335481875f},
-std::array<float,2>{0.537949562f, 0.896469712f},
-std::array<float,2>{0.587892473f, 0.389513016f},
-std::array<float,2>{0.190091565f, 0.653894365f},
-std::array<float,2>{0.345925689f, 0.233872905f},
-std::array<float,2>{0.912633896f, 0.821040213f},
-std::array<float,2>{0.751643836f, 0.0691882744f},
-std::array<float,2>{0.436126888f, 0.974164903f},
-std::array<float,2>{0.0937281102f, 0.295199364f},
-std::array<float,2>{0.744619071f, 0.504286885f},
-std::array<float,2>{0.523845494f, 0.0176292602f},
-std::array<float,2>{0.130118385f, 0.924183547f},
-std::array<float,2>{0.262659997f, 0.321447849f},
-std::array<float,2>{0.947104037f, 0.57446301f},
-std::array<float,2>{0.874224186f, 0.441699952f},
-std::array<float,2>{0.484167427f, 0.705313563f},
-std::array<float,2>{0.0225968864f, 0.158596203f},
-std::array<float,2>{0.658969998f, 0.75205934f},
-std::array<float,2>{0.712812543f, 0.25013876f},
-std::array<float,2>{0.100746281f, 0.53311646f},
-std::array<float,2>{0.39642635f, 0.104222476f},
-std::array<float,2>{0.785246253f, 0.94625473f},
-std::array<float,2>{0.897807181f, 0.206738055f},
-std::array<float,2>{0.312755913f, 0.870553195f},
-std::array<float,2>{0.221021309f, 0.418085963f},
-std::array<float,2>{0.598897278f, 0.66700691f},
-std::array<float,2>{0.542649448f, 0.164687365f},
-std::array<float,2>{0.175877184f, 0.763531387f},
-std::array<float,2>{0.298752218f, 0.448521018f},
-std::array<float,2>{0.977474093f, 0.713796794f},
-std::array<float,2>{0.836561263f, 0.312788099f},
-std::array<float,2>{0.444519907f, 0.567331851f},
-std::array<float,2>{0.0389234386f, 0.0273073409f},
-std::array<float,2>{0.630850852f, 0.930476844f},
-std::array<float,2>{0.736164212f, 0.413660824f},
-std::array<float,2>{0.0785798579f, 0.65985316f},
-std::array<float,2>{0.428973198f, 0.215617001f},
-std::array<float,2>{0.764346123f, 0.860314131f},
-std::array<float,2>{0.917543113f, 0.0941708907f},
-std::array<float,2>{0.352987319f, 0.939637721f},
-std::array<float,2>{0.199408799f, 0.258140206f},
-std::array<float,2>{0.584676147f, 0.542847753f},
-std::array<float,2>{0.66653049f, 0.0401670821f},
-std::array<float,2>{0.0292696431f, 0.901113629f},
-std::array<float,2>{0.46914801f, 0.363699108f},
-std::array<float,2>{0.865943849f, 0.618145466f},
-std::array<float,2>{0.941214085f, 0.492949367f},
-std::array<float,2>{0.251279324f, 0.72914654f},
-std::array<float,2>{0.134581476f, 0.138972297f},
-std::array<float,2>{0.516008377f, 0.792954266f},
-std::array<float,2>{0.607429326f, 0.284015924f},
-std::array<float,2>{0.233092859f, 0.513779998f},
-std::array<float,2>{0.321960658f, 0.076003015f},
-std::array<float,2>{0.899892211f, 0.980442047f},
-std::array<float,2>{0.790072799f, 0.224718675f},
-std::array<float,2>{0.401075661f, 0.817424536f},
-std::array<float,2>{0.102342077f, 0.379555106f},
-std::array<float,2>{0.706681073f, 0.641585708f},
-std::array<float,2>{0.687808037f, 0.192294046f},
-std::array<float,2>{0.11570023f, 0.8468135f},
-std::array<float,2>{0.377096772f, 0.424956828f},
-std::array<float,2>{0.802288413f, 0.671994627f},
-std::array<float,2>{0.886434793f, 0.268907666f},
-std::array<float,2>{0.329542458f, 0.554415703f},
-std::array<float,2>{0.240948468f, 0.11341095f},
-std::array<float,2>{0.622885406f, 0.964404762f},
-std::array<float,2>{0.501035988f, 0.456103295f},
-std::array<float,2>{0.145619661f, 0.69390583f},
-std::array<float,2>{0.267511547f, 0.180927709f},
-std::array<float,2>{0.960790217f, 0.765742421f},
-std::array<float,2>{0.856446266f, 0.00513923122f},
-std::array<float,2>{0.489514172f, 0.912962139f},
-std::array<float,2>{0.0133088967f, 0.329118043f},
-std::array<float,2>{0.678307414f, 0.579420686f},
-std::array<float,2>{0.564059734f, 0.0912690982f},
-std::array<float,2>{0.211153045f, 0.990883052f},
-std::array<float,2>{0.361050427f, 0.309473604f},
-std::array<float,2>{0.934928477f, 0.527050734f},
-std::array<float,2>{0.771973252f, 0.401081264f},
-std::array<float,2>{0.407108366f, 0.628713608f},
-std::array<float,2>{0.0729517192f, 0.245503664f},
-std::array<float,2>{0.723771691f, 0.838558793f},
-std::array<float,2>{0.648462772f, 0.343818754f},
-std::array<float,2>{0.0550001301f, 0.595944464f},
-std::array<float,2>{0.463461131f, 0.0566241741f},
-std::array<float,2>{0.819622815f, 0.877833366f},
-std::array<float,2>{0.998915851f, 0.151269391f},
-std::array<float,2>{0.296209931f, 0.804398835f},
-std::array<float,2>{0.166713312f, 0.478478342f},
-std::array<float,2>{0.556973577f, 0.740275204f},
-std::array<float,2>{0.528526902f, 0.249730453f},
-std::array<float,2>{0.12742126f, 0.842798352f},
-std::array<float,2>{0.259473115f, 0.404589832f},
-std::array<float,2>{0.9529953f, 0.628978729f},
-std::array<float,2>{0.870137095f, 0.306461394f},
-std::array<float,2>{0.478031754f, 0.530882359f},
-std::array<float,2>{0.0173053183f, 0.0894118026f},
-std::array<float,2>{0.660507202f, 0.986679196f},
-std::array<float,2>{0.715880334f, 0.483849466f},
-std::array<float,2>{0.095565863f, 0.735450387f},
-std::array<float,2>{0.392448515f, 0.155413285f},
-std::array<float,2>{0.784880102f, 0.799114466f},
-std::array<float,2>{0.894068122f, 0.0624512509f},
-std::array<float,2>{0.31941548f, 0.880558431f},
-std::array<float,2>{0.22384955f, 0.349349767f},
-std::array<float,2>{0.594955206f, 0.599567533f},
-std::array<float,2>{0.63967675f, 0.11269369f},
-std::array<float,2>{0.0424071364f, 0.966111362f},
-std::array<float,2>{0.448756933f, 0.269855618f},
-std::array<float,2>{0.828375697f, 0.547614634f},
-std::array<float,2>{0.968936563f, 0.426092476f},
-std::array<float,2>{0.309498549f, 0.678566635f},
-std::array<float,2>{0.183321476f, 0.189561814f},
-std::array<float,2>{0.531900585f, 0.847798049f},
-std::array<float,2>{0.593188286f, 0.33272326f},
-std::array<float,2>{0.19216384f, 0.583757162f},
-std::array<float,2>{0.348912895f, 0.0028690116f},
-std::array<float,2>{0.91005075f, 0.909773707f},
-std::array<float,2>{0.755517185f, 0.18558526f},
-std::array<float,2>{0.432856917f, 0.772304833f},
-std::array<float,2>{0.0884796828f, 0.458212912f},
-std::array<float,2>{0.748695135f, 0.687852144f},
-std::array<float,2>{0.734308124f, 0.13564007f},
-std::array<float,2>{0.0636758581f, 0.793134511f},
-std::array<float,2>{0.421153635f, 0.498127729f},
-std::array<float,2>{0.775192976f, 0.732593715f},
-std::array<float,2>{0.92528069f, 0.362210751f},
-std::array<float,2>{0.37327832f, 0.622443616f},
-std::array<float,2>{0.203702584f, 0.0449982099f},
-std::array<float,2>{0.573719978f, 0.904076397f},
-std::array<float,2>{0.55219835f, 0.375930816f},
-std::array<float,2>{0.157096341f, 0.647928596f},
-std::array<float,2>{0.287400216f, 0.220740914f},
-std::array<float,2>{0.986467361f, 0.814474106f},
-std::array<float,2>{0.824301362f, 0.0710942447f},
-std::array<float,2>{0.453290731f, 0.980752945f},
-std::array<float,2>{0.0540977642f, 0.288602918f},
-std::array<float,2>{0.641034484f, 0.510216832f},
-std::array<float,2>{0.612012923f, 0.0305357408f},
-std::array<float,2>{0.248035431f, 0.934656918f},
-std::array<float,2>{0.338693053f, 0.319222927f},
-std::array<float,2>{0.877941847f, 0.562699258f},
-std::array<float,2>{0.804695725f, 0.453010052f},
-std::array<float,2>{0.38571924f, 0.716677129f},
-std::array<float,2>{0.122913577f, 0.168805838f},
-std::array<float,2>{0.69691962f, 0.759014964f},
-std::array<float,2>{0.685597479f, 0.263933837f},
-std::array<float,2>{0.00749375019f, 0.545246422f},
-std::array<float,2>{0.492399812f, 0.098604545f},
-std::array<float,2>{0.84839958f, 0.945090055f},
-std::array<float,2>{0.967730284f, 0.212544143f},
-std::array<float,2>{0.276778907f, 0.864212275f},
-std::array<float,2>{0.154839978f, 0.408923894f},
-std::array<float,2>{0.511512339f, 0.66331768f},
-std::array<float,2>{0.567828596f, 0.162839547f},
-std::array<float,2>{0.218200356f, 0.757358313f},
-std::array<float,2>{0.364816606f, 0.438220173f},
-std::array<float,2>{0.931333601f, 0.710785747f},
-std::array<float,2>{0.766506433f, 0.327840894f},
-std::array<float,2>{0.41271323f, 0.572547555f},
-std::array<float,2>{0.0762370154f, 0.0218814649f},
-std::array<float,2>{0.720497966f, 0.926987469f},
-std::array<float,2>{0.653476179f, 0.417090744f},
-std::array<float,2>{0.0609579682f, 0.670744598f},
-std::array<float,2>{0.465867996f, 0.207361713f},
-std::array<float,2>{0.814653575f, 0.874613047f},
-std::array<float,2>{0.995720923f, 0.107474118f},
-std::array<float,2>{0.291336238f, 0.951669097f},
-std::array<float,2>{0.169597238f, 0.256997138f},
-std::array<float,2>{0.560140252f, 0.538473547f},
-std::array<float,2>{0.694964647f, 0.0381682143f},
-std::array<float,2>{0.113068216f, 0.892644763f},
-std::array<float,2>{0.38210398f, 0.371765733f},
-std::array<float,2>{0.800779462f, 0.612963974f},
-std::array<float,2>{0.888731658f, 0.491300851f},
-std::array<float,2>{0.334847808f, 0.725675583f},
-std::array<float,2>{0.236946464f, 0.128448457f},
-std::array<float,2>{0.619272768f, 0.782508552f},
-std::array<float,2>{0.505867422f, 0.291735917f},
-std::array<float,2>{0.143071443f, 0.502990961f},
-std::array<float,2>{0.272018522f, 0.063966684f},
-std::array<float,2>{0.956790626f, 0.969696105f},
-std::array<float,2>{0.854626834f, 0.229568109f},
-std::array<float,2>{0.486768872f, 0.826417685f},
-std::array<float,2>{0.0103704957f, 0.383961827f},
-std::array<float,2>{0.674519777f, 0.650016129f},
-std::array<float,2>{0.670166194f, 0.198564619f},
-std::array<float,2>{0.0266945176f, 0.854138315f},
-std::array<float,2>{0.476543009f, 0.432683319f},
-std::array<float,2>{0.859463573f, 0.681135595f},
-std::array<float,2>{0.942310333f, 0.275047392f},
-std::array<float,2>{0.255802244f, 0.557096124f},
-std::array<float,2>{0.139506266f, 0.124163993f},
-std::array<float,2>{0.522183239f, 0.954769254f},
-std::array<float,2>{0.604525089f, 0.462744951f},
-std::array<float,2>{0.22983171f, 0.702246368f},
-std::array<float,2>{0.324756861f, 0.171942428f},
-std::array<float,2>{0.902770102f, 0.780815363f},
-std::array<float,2>{0.796602368f, 0.0113345198f},
-std::array<float,2>{0.405119628f, 0.917832553f},
-std::array<float,2>{0.107546471f, 0.340747714f},
-std::array<float,2>{0.709209204f, 0.587388337f},
-std::array<float,2>{0.546215236f, 0.0834320039f},
-std::array<float,2>{0.174801797f, 0.999164045f},
-std::array<float,2>{0.300862581f, 0.301130414f},
-std::array<float,2>{0.98401773f, 0.51607269f},
-std::array<float,2>{0.840177178f, 0.395574659f},
-std::array<float,2>{0.438932359f, 0.638758302f},
-std::array<float,2>{0.0316986926f, 0.238777131f},
-std::array<float,2>{0.625671208f, 0.832921147f},
-std::array<float,2>{0.740352988f, 0.354000479f},
-std::array<float,2>{0.0847613737f, 0.602704346f},
-std::array<float,2>{0.423408508f, 0.0489180982f},
-std::array<float,2>{0.757893682f, 0.886529207f},
-std::array<float,2>{0.921181858f, 0.144343734f},
-std::array<float,2>{0.357409686f, 0.809702337f},
-std::array<float,2>{0.196255863f, 0.471210599f},
-std::array<float,2>{0.581267774f, 0.746795118f},
-std::array<float,2>{0.597861588f, 0.203972131f},
-std::array<float,2>{0.222240299f, 0.868710637f},
-std::array<float,2>{0.313833922f, 0.420745045f},
-std::array<float,2>{0.897148132f, 0.665208519f},
-std::array<float,2>{0.78684026f, 0.253155887f},
-std::array<float,2>{0.394887596f, 0.535053015f},
-std::array<float,2>{0.100430869f, 0.102074765f},
-std::array<float,2>{0.711902559f, 0.948947132f},
-std::array<float,2>{0.660079718f, 0.444871843f},
-std::array<float,2>{0.0215467829f, 0.704379201f},
-std::array<float,2>{0.482495487f, 0.157320574f},
-std::array<float,2>{0.873124599f, 0.751521289f},
-std::array<float,2>{0.946007371f, 0.015809929f},
-std::array<float,2>{0.26323998f, 0.923331082f},
-std::array<float,2>{0.129441321f, 0.323493421f},
-std::array<float,2>{0.524587035f, 0.57670182f},
-std::array<float,2>{0.745336533f, 0.0676836073f},
-std::array<float,2>{0.0918711796f, 0.976120472f},
-std::array<float,2>{0.436576694f, 0.293126643f},
-std::array<float,2>{0.75083369f, 0.507367194f},
-std::array<float,2>{0.913858473f, 0.388341457f},
-std::array<float,2>{0.347448558f, 0.655778468f},
-std::array<float,2>{0.190613985f, 0.231959596f},
-std::array<float,2>{0.589763582f, 0.823425293f},
-std::array<float,2>{0.539023221f, 0.370958447f},
-std::array<float,2>{0.183968261f, 0.616318822f},
-std::array<float,2>{0.306028515f, 0.0314295664f},
-std::array<float,2>{0.975799859f, 0.897734165f},
-std::array<float,2>{0.834215105f, 0.130906597f},
-std::array<float,2>{0.452480823f, 0.786761284f},
-std::array<float,2>{0.0443905704f, 0.487591922f},
-std::array<float,2>{0.633378685f, 0.720680594f},
-std::array<float,2>{0.648132145f, 0.179684207f},
-std::array<float,2>{0.0489739776f, 0.777014196f},
-std::array<float,2>{0.45943895f, 0.467431128f},
-std::array<float,2>{0.82081008f, 0.696587145f},
-std::array<float,2>{0.98891598f, 0.339525402f},
-std::array<float,2>{0.283153147f, 0.592158079f},
-std::array<float,2>{0.162856832f, 0.0125788311f},
-std::array<float,2>{0.547109127f, 0.918072045f},
-std::array<float,2>{0.574856043f, 0.43477419f},
-std::array<float,2>{0.209348142f, 0.686303914f},
-std::array<float,2>{0.368783265f, 0.201777101f},
-std::array<float,2>{0.92915535f, 0.855761588f},
-std::array<float,2>{0.781062126f, 0.12060792f},
-std::array<float,2>{0.417193145f, 0.960261881f},
-std::array<float,2>{0.0683027878f, 0.280455679f},
-std::array<float,2>{0.726839244f, 0.559632897f},
-std::array<float,2>{0.511719644f, 0.0537277088f},
-std::array<float,2>{0.148726031f, 0.88721329f},
-std::array<float,2>{0.27884835f, 0.356605649f},
-std::array<float,2>{0.961921334f, 0.606463492f},
-std::array<float,2>{0.847604036f, 0.476514548f},
-std::array<float,2>{0.497806519f, 0.742845535f},
-std::array<float,2>{0.00152734271f, 0.14763616f},
-std::array<float,2>{0.681893826f, 0.806615651f},
-std::array<float,2>{0.70242089f, 0.300223202f},
-std::array<float,2>{0.1200976f, 0.520126998f},
-std::array<float,2>{0.388044894f, 0.0814701766f},
-std::array<float,2>{0.811947584f, 0.995125294f},
-std::array<float,2>{0.882570267f, 0.236847028f},
-std::array<float,2>{0.342871279f, 0.830482483f},
-std::array<float,2>{0.242821902f, 0.392296702f},
-std::array<float,2>{0.616329014f, 0.636420548f},
-std::array<float,2>{0.558295965f, 0.148737028f},
-std::array<float,2>{0.167380586f, 0.800999761f},
-std::array<float,2>{0.295622617f, 0.479992032f},
-std::array<float,2>{0.999200165f, 0.738365531f},
-std::array<float,2>{0.81849283f, 0.347079098f},
-std::array<float,2>{0.464012116f, 0.594935656f},
-std::array<float,2>{0.0561143309f, 0.0568122156f},
-std::array<float,2>{0.650344849f, 0.875311613f},
-std::array<float,2>{0.723472297f, 0.399626464f},
-std::array<float,2>{0.0733642355f, 0.626447558f},
-std::array<float,2>{0.407348901f, 0.242260098f},
-std::array<float,2>{0.772864461f, 0.836029291f},
-std::array<float,2>{0.934396625f, 0.093694523f},
-std::array<float,2>{0.359476298f, 0.990058482f},
-std::array<float,2>{0.212190941f, 0.310792983f},
-std::array<float,2>{0.562552869f, 0.523614526f},
-std::array<float,2>{0.679025233f, 0.00676197046f},
-std::array<float,2>{0.0123587279f, 0.911807358f},
-std::array<float,2>{0.489041954f, 0.330925405f},
-std::array<float,2>{0.856269479f, 0.580329478f},
-std::array<float,2>{0.959421873f, 0.453647554f},
-std::array<float,2>{0.266495377f, 0.69277513f},
-std::array<float,2>{0.144913018f, 0.182744533f},
-std::array<float,2>{0.50063473f, 0.768696427f},
-std::array<float,2>{0.62121588f, 0.26611042f},
-std::array<float,2>{0.242128044f, 0.551038086f},
-std::array<float,2>{0.328646988f, 0.116233714f},
-std::array<float,2>{0.885166049f, 0.961755216f},
-std::array<float,2>{0.80152154f, 0.194890961f},
-std::array<float,2>{0.378306776f, 0.843913734f},
-std::array<float,2>{0.116653323f, 0.422833711f},
-std::array<float,2>{0.689278722f, 0.674515605f},
-std::array<float,2>{0.705412328f, 0.223750323f},
-std::array<float,2>{0.102758221f, 0.818874478f},
-std::array<float,2>{0.402337909f, 0.381237f},
-std::array<float,2>{0.789274573f, 0.643488348f},
-std::array<float,2>{0.898681462f, 0.282132089f},
-std::array<float,2>{0.321046799f, 0.512742579f},
-std::array<float,2>{0.233787939f, 0.077723965f},
-std::array<float,2>{0.608662248f, 0.978052497f},
-std::array<float,2>{0.517506778f, 0.494566798f},
-std::array<float,2>{0.133552864f, 0.727915943f},
-std::array<float,2>{0.250780106f, 0.138533384f},
-std::array<float,2>{0.940183938f, 0.789833248f},
-std::array<float,2>{0.866446733f, 0.041323714f},
-std::array<float,2>{0.470302671f, 0.898980796f},
-std::array<float,2>{0.0279616788f, 0.36599499f},
-std::array<float,2>{0.667920768f, 0.619993985f},
-std::array<float,2>{0.585504115f, 0.0965161175f},
-std::array<float,2>{0.200516447f, 0.939025044f},
-std::array<float,2>{0.351808727f, 0.259946316f},
-std::array<float,2>{0.916205704f, 0.540304244f},
-std::array<float,2>{0.764820576f, 0.410302788f},
-std::array<float,2>{0.42833972f, 0.657552183f},
-std::array<float,2>{0.0797290653f, 0.217680246f},
-std::array<float,2>{0.734633863f, 0.862095475f},
-std::array<float,2>{0.629754066f, 0.315697879f},
-std::array<float,2>{0.0380256288f, 0.569029748f},
-std::array<float,2>{0.444290698f, 0.0240777358f},
-std::array<float,2>{0.837181926f, 0.932864964f},
-std::array<float,2>{0.977616727f, 0.166480899f},
-std::array<float,2>{0.297691494f, 0.764299572f},
-std::array<float,2>{0.177340984f, 0.446684003f},
-std::array<float,2>{0.541729748f, 0.711617172f},
-std::array<float,2>{0.533997476f, 0.188121378f},
-std::array<float,2>{0.181185409f, 0.849663258f},
-std::array<float,2>{0.31248489f, 0.427898884f},
-std::array<float,2>{0.970901608f, 0.675803304f},
-std::array<float,2>{0.830708742f, 0.272092402f},
-std::array<float,2>{0.446818799f, 0.549700558f},
-std::array<float,2>{0.040447589f, 0.109749101f},
-std::array<float,2>{0.638039947f, 0.968035161f},
-std::array<float,2>{0.74764508f, 0.460562319f},
-std::array<float,2>{0.0877119154f, 0.690040231f},
-std::array<float,2>{0.431099981f, 0.185391411f},
-std::array<float,2>{0.756184638f, 0.77067852f},
-std::array<float,2>{0.907628655f, 0.00101708667f},
-std::array<float,2>{0.351318032f, 0.908036888f},
-std::array<float,2>{0.193694845f, 0.335484356f},
-std::array<float,2>{0.590270579f, 0.585276842f},
-std::array<float,2>{0.663963377f, 0.0876245126f},
-std::array<float,2>{0.0177702382f, 0.984588563f},
-std::array<float,2>{0.479148716f, 0.307985216f},
-std::array<float,2>{0.869044662f, 0.528221667f},
-std::array<float,2>{0.951107264f, 0.402468503f},
-std::array<float,2>{0.261088073f, 0.631501436f},
-std::array<float,2>{0.125351891f, 0.246212602f},
-std::array<float,2>{0.529995918f, 0.840483069f},
-std::array<float,2>{0.596539676f, 0.350131154f},
-std::array<float,2>{0.225095779f, 0.599737406f},
-std::array<float,2>{0.316445321f, 0.0595686436f},
-std::array<float,2>{0.892061651f, 0.880998313f},
-std::array<float,2>{0.782641888f, 0.153192341f},
-std::array<float,2>{0.392956942f, 0.797214806f},
-std::array<float,2>{0.0966595039f, 0.482238859f},
-std::array<float,2>{0.717027485f, 0.737802267f},
-std::array<float,2>{0.698423088f, 0.171732888f},
-std::array<float,2>{0.124158174f, 0.761081815f},
-std::array<float,2>{0.383064389f, 0.450897127f},
-std::array<float,2>{0.807153165f, 0.717119515f},
-std::array<float,2>{0.875610888f, 0.317729205f},
-std::array<float,2>{0.336613715f, 0.565590501f},
-std::array<float,2>{0.24883163f, 0.0280748811f},
-std::array<float,2>{0.609785318f, 0.93728143f},
-std::array<float,2>{0.508296371f, 0.406557381f},
-std::array<float,2>{0.153974101f, 0.660519183f},
-std::array<float,2>{0.273787439f, 0.214057162f},
-std::array<float,2>{0.966785848f, 0.865258276f},
-std::array<float,2>{0.849654078f, 0.100131251f},
-std::array<float,2>{0.495755136f, 0.942255795f},
-std::array<float,2>{0.00440105703f, 0.262423277f},
-std::array<float,2>{0.683968723f, 0.543329298f},
-std::array<float,2>{0.570388556f, 0.0446962453f},
-std::array<float,2>{0.20598121f, 0.906048954f},
-std::array<float,2>{0.3719818f, 0.360748082f},
-std::array<float,2>{0.923560441f, 0.624501109f},
-std::array<float,2>{0.77729696f, 0.496697068f},
-std::array<float,2>{0.419300944f, 0.730726957f},
-std::array<float,2>{0.0663035586f, 0.133424029f},
-std::array<float,2>{0.731425822f, 0.795241833f},
-std::array<float,2>{0.644220412f, 0.285802633f},
-std::array<float,2>{0.0521454848f, 0.509229243f},
-std::array<float,2>{0.455675811f, 0.0729021281f},
-std::array<float,2>{0.827532947f, 0.98320955f},
-std::array<float,2>{0.985029459f, 0.219327345f},
-std::array<float,2>{0.286234766f, 0.813612878f},
-std::array<float,2>{0.159465641f, 0.377318591f},
-std::array<float,2>{0.554252982f, 0.64545244f},
-std::array<float,2>{0.617611468f, 0.126130879f},
-std::array<float,2>{0.234980792f, 0.784713566f},
-std::array<float,2>{0.332823038f, 0.488765448f},
-std::array<float,2>{0.887720346f, 0.722958565f},
-std::array<float,2>{0.798679709f, 0.373553187f},
-std::array<float,2>{0.379079491f, 0.61089325f},
-std::array<float,2>{0.110327229f, 0.0367503688f},
-std::array<float,2>{0.692408919f, 0.891051531f},
-std::array<float,2>{0.673805833f, 0.385520518f},
-std::array<float,2>{0.00856926013f, 0.651822448f},
-std::array<float,2>{0.484500617f, 0.228354231f},
-std::array<float,2>{0.852432907f, 0.825744092f},
-std::array<float,2>{0.954192817f, 0.0651072711f},
-std::array<float,2>{0.270999342f, 0.971071661f},
-std::array<float,2>{0.142127797f, 0.289755285f},
-std::array<float,2>{0.505234063f, 0.501902997f},
-std::array<float,2>{0.722026408f, 0.0207309015f},
-std::array<float,2>{0.0753232539f, 0.928097248f},
-std::array<float,2>{0.410277605f, 0.325326353f},
-std::array<float,2>{0.769007981f, 0.570788741f},
-std::array<float,2>{0.932140768f, 0.440125436f},
-std::array<float,2>{0.366325706f, 0.708393395f},
-std::array<float,2>{0.216237485f, 0.160246193f},
-std::array<float,2>{0.568696678f, 0.755426407f},
-std::array<float,2>{0.560623884f, 0.25465706f},
-std::array<float,2>{0.171838105f, 0.53616941f},
-std::array<float,2>{0.290431291f, 0.106120005f},
-std::array<float,2>{0.992306352f, 0.949537098f},
-std::array<float,2>{0.813144684f, 0.209502771f},
-std::array<float,2>{0.46836412f, 0.872056663f},
-std::array<float,2>{0.058912687f, 0.415099472f},
-std::array<float,2>{0.655339241f, 0.668422103f},
-std::array<float,2>{0.627557278f, 0.241344899f},
-std::array<float,2>{0.0344757214f, 0.835769057f},
-std::array<float,2>{0.440766931f, 0.39679566f},
-std::array<float,2>{0.842186689f, 0.637598813f},
-std::array<float,2>{0.981596768f, 0.304535687f},
-std::array<float,2>{0.302949697f, 0.518393934f},
-std::array<float,2>{0.172977671f, 0.0845275596f},
-std::array<float,2>{0.544405222f, 0.997475326f},
-std::array<float,2>{0.578129947f, 0.469641626f},
-std::array<float,2>{0.198057815f, 0.749369442f},
-std::array<float,2>{0.357859373f, 0.142307356f},
-std::array<float,2>{0.918694794f, 0.810687661f},
-std::array<float,2>{0.760581911f, 0.0475330018f},
-std::array<float,2>{0.425177068f, 0.884369493f},
-std::array<float,2>{0.0838235989f, 0.352139205f},
-std::array<float,2>{0.739952803f, 0.603887558f},
-std::array<float,2>{0.521024108f, 0.121671885f},
-std::array<float,2>{0.137584627f, 0.955595553f},
-std::array<float,2>{0.256182581f, 0.277201205f},
-std::array<float,2>{0.945231318f, 0.556289554f},
-std::array<float,2>{0.862988949f, 0.430094063f},
-std::array<float,2>{0.474592894f, 0.682399631f},
-std::array<float,2>{0.0243563559f, 0.196286023f},
-std::array<float,2>{0.6692729f, 0.853331804f},
-std::array<float,2>{0.707084358f, 0.342428982f},
-std::array<float,2>{0.106036961f, 0.589655578f},
-std::array<float,2>{0.403649002f, 0.00921893585f},
-std::array<float,2>{0.79308337f, 0.914612234f},
-std::array<float,2>{0.906183839f, 0.173959047f},
-std::array<float,2>{0.32732299f, 0.777909338f},
-std::array<float,2>{0.227020115f, 0.463773698f},
-std::array<float,2>{0.602399886f, 0.700768471f},
-std::array<float,2>{0.586711645f, 0.233199164f},
-std::array<float,2>{0.187653974f, 0.822209716f},
-std::array<float,2>{0.345656514f, 0.390576929f},
-std::array<float,2>{0.910912156f, 0.653080523f},
-std::array<float,2>{0.752427638f, 0.296543181f},
-std::array<float,2>{0.434574753f, 0.505104959f},
-std::array<float,2>{0.0901137143f, 0.0695541352f},
-std::array<float,2>{0.743338168f, 0.973346949f},
-std::array<float,2>{0.635167956f, 0.485852242f},
-std::array<float,2>{0.046355743f, 0.721032619f},
-std::array<float,2>{0.450619906f, 0.129308924f},
-std::array<float,2>{0.833212674f, 0.787603498f},
-std::array<float,2>{0.972732186f, 0.0347356759f},
-std::array<float,2>{0.306951046f, 0.895052254f},
-std::array<float,2>{0.187259644f, 0.367658973f},
-std::array<float,2>{0.537063241f, 0.613321602f},
-std::array<float,2>{0.713785052f, 0.105426438f},
-std::array<float,2>{0.0990368798f, 0.946540058f},
-std::array<float,2>{0.398426026f, 0.251538396f},
-std::array<float,2>{0.787304223f, 0.531652331f},
-std::array<float,2>{0.896046937f, 0.419843733f},
-std::array<float,2>{0.31597954f, 0.666189015f},
-std::array<float,2>{0.21992673f, 0.205446303f},
-std::array<float,2>{0.599745989f, 0.86941576f},
-std::array<float,2>{0.52629602f, 0.321246088f},
-std::array<float,2>{0.131437659f, 0.576072156f},
-std::array<float,2>{0.264418036f, 0.0188753735f},
-std::array<float,2>{0.948390961f, 0.925665975f},
-std::array<float,2>{0.872428417f, 0.159408212f},
-std::array<float,2>{0.482278705f, 0.753297687f},
-std::array<float,2>{0.0210834909f, 0.443275064f},
-std::array<float,2>{0.656737626f, 0.706544459f},
-std::array<float,2>{0.680159211f, 0.144838706f},
-std::array<float,2>{0.00222944445f, 0.807304084f},
-std::array<float,2>{0.498162985f, 0.473750591f},
-std::array<float,2>{0.845260918f, 0.745749116f},
-std::array<float,2>{0.964589417f, 0.35786581f},
-std::array<float,2>{0.280070513f, 0.608947992f},
-std::array<float,2>{0.15052408f, 0.0509657823f},
-std::array<float,2>{0.514586627f, 0.889876187f},
-std::array<float,2>{0.613879681f, 0.39291805f},
-std::array<float,2>{0.244667366f, 0.634670913f},
-std::array<float,2>{0.341732919f, 0.234829187f},
-std::array<float,2>{0.880500913f, 0.829306185f},
-std::array<float,2>{0.809292912f, 0.0793521479f},
-std::array<float,2>{0.39035973f, 0.99310416f},
-std::array<float,2>{0.11762476f, 0.297213405f},
-std::array<float,2>{0.700530052f, 0.522278786f},
-std::array<float,2>{0.550692439f, 0.0149373561f},
-std::array<float,2>{0.161050752f, 0.921508431f},
-std::array<float,2>{0.283822328f, 0.33774972f},
-std::array<float,2>{0.990618289f, 0.591769993f},
-std::array<float,2>{0.822954774f, 0.46664694f},
-std::array<float,2>{0.458795458f, 0.699067891f},
-std::array<float,2>{0.0484010242f, 0.176985025f},
-std::array<float,2>{0.645987093f, 0.774604142f},
-std::array<float,2>{0.72949481f, 0.277882218f},
-std::array<float,2>{0.0698228851f, 0.562472522f},
-std::array<float,2>{0.415295541f, 0.118303545f},
-std::array<float,2>{0.777840316f, 0.957243502f},
-std::array<float,2>{0.925816655f, 0.199431628f},
-std::array<float,2>{0.370199531f, 0.857721686f},
-std::array<float,2>{0.207658023f, 0.436855763f},
-std::array<float,2>{0.578005195f, 0.684809089f},
-std::array<float,2>{0.502074599f, 0.180445522f},
-std::array<float,2>{0.146582767f, 0.76665175f},
-std::array<float,2>{0.267621964f, 0.455605835f},
-std::array<float,2>{0.958503783f, 0.695149899f},
-std::array<float,2>{0.858908415f, 0.328760326f},
-std::array<float,2>{0.491215885f, 0.578931153f},
-std::array<float,2>{0.0154538015f, 0.00418551406f},
-std::array<float,2>{0.677015901f, 0.913316965f},
-std::array<float,2>{0.691323578f, 0.42392391f},
-std::array<float,2>{0.114254497f, 0.673798859f},
-std::array<float,2>{0.376187205f, 0.19277437f},
-std::array<float,2>{0.803070068f, 0.846524835f},
-std::array<float,2>{0.884004116f, 0.114994779f},
-std::array<float,2>{0.331416428f, 0.963140905f},
-std::array<float,2>{0.238796085f, 0.268247962f},
-std::array<float,2>{0.624416828f, 0.553661644f},
-std::array<float,2>{0.650862336f, 0.0552491955f},
-std::array<float,2>{0.0573126227f, 0.878837287f},
-std::array<float,2>{0.461202085f, 0.344877005f},
-std::array<float,2>{0.818205714f, 0.59739387f},
-std::array<float,2>{0.997385442f, 0.477253348f},
-std::array<float,2>{0.294104218f, 0.741312146f},
-std::array<float,2>{0.164394617f, 0.151844591f},
-std::array<float,2>{0.555610657f, 0.802763104f},
-std::array<float,2>{0.565838993f, 0.310048312f},
-std::array<float,2>{0.213094309f, 0.525964499f},
-std::array<float,2>{0.361720532f, 0.0907001346f},
-std::array<float,2>{0.935606599f, 0.992019773f},
-std::array<float,2>{0.770111501f, 0.244808048f},
-std::array<float,2>{0.408284396f, 0.839841306f},
-std::array<float,2>{0.0711719766f, 0.401896089f},
-std::array<float,2>{0.725259006f, 0.627485693f},
-std::array<float,2>{0.737299144f, 0.216074541f},
-std::array<float,2>{0.0817316845f, 0.86120224f},
-std::array<float,2>{0.42686823f, 0.412776053f},
-std::array<float,2>{0.761785567f, 0.658511162f},
-std::array<float,2>{0.914668858f, 0.259264499f},
-std::array<float,2>{0.354584605f, 0.541279733f},
-std::array<float,2>{0.202005446f, 0.0948953107f},
-std::array<float,2>{0.58291316f, 0.940645039f},
-std::array<float,2>{0.539559424f, 0.447778314f},
-std::array<float,2>{0.178210571f, 0.714414775f},
-std::array<float,2>{0.299446732f, 0.165134877f},
-std::array<float,2>{0.978560388f, 0.762437224f},
-std::array<float,2>{0.838021994f, 0.0260468461f},
-std::array<float,2>{0.441420913f, 0.931361854f},
-std::array<float,2>{0.0356114432f, 0.314313382f},
-std::array<float,2>{0.631115317f, 0.568148911f},
-std::array<float,2>{0.6066432f, 0.0751053169f},
-std::array<float,2>{0.231429473f, 0.97901392f},
-std::array<float,2>{0.322739452f, 0.284725726f},
-std::array<float,2>{0.902190864f, 0.514778256f},
-std::array<float,2>{0.791540205f, 0.379974127f},
-std::array<float,2>{0.399964154f, 0.642331004f},
-std::array<float,2>{0.104410961f, 0.226265922f},
-std::array<float,2>{0.703988492f, 0.817045867f},
-std::array<float,2>{0.665732622f, 0.364912271f},
-std::array<float,2>{0.0309207253f, 0.618358135f},
-std::array<float,2>{0.471737564f, 0.039587345f},
-std::array<float,2>{0.86358285f, 0.901603222f},
-std::array<float,2>{0.938419878f, 0.140048131f},
-std::array<float,2>{0.252158582f, 0.791314602f},
-std::array<float,2>{0.13640368f, 0.493292183f},
-std::array<float,2>{0.518072665f, 0.73023212f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.132321566f, 0.128292337f},
-std::array<float,2>{0.949380696f, 0.79349792f},
-std::array<float,2>{0.265386015f, 0.57597822f},
-std::array<float,2>{0.533660829f, 0.259016007f},
-std::array<float,2>{0.400364488f, 0.444681168f},
-std::array<float,2>{0.668591738f, 0.736123085f},
-std::array<float,2>{0.0330643244f, 0.985115469f},
-std::array<float,2>{0.811665118f, 0.0182743147f},
-std::array<float,2>{0.0739637017f, 0.341466218f},
-std::array<float,2>{0.862904012f, 0.512520969f},
-std::array<float,2>{0.45345968f, 0.86648345f},
-std::array<float,2>{0.698285818f, 0.196765631f},
-std::array<float,2>{0.346412003f, 0.0830354169f},
-std::array<float,2>{0.57346946f, 0.925507426f},
-std::array<float,2>{0.203095272f, 0.629234016f},
-std::array<float,2>{0.916483879f, 0.409259498f},
-std::array<float,2>{0.0228327401f, 0.0577487759f},
-std::array<float,2>{0.775971234f, 0.949622333f},
-std::array<float,2>{0.410694182f, 0.690753818f},
-std::array<float,2>{0.65066117f, 0.492074847f},
-std::array<float,2>{0.288001537f, 0.282034934f},
-std::array<float,2>{0.524016976f, 0.605857968f},
-std::array<float,2>{0.171152085f, 0.752673686f},
-std::array<float,2>{0.996566057f, 0.180772677f},
-std::array<float,2>{0.237859517f, 0.376999915f},
-std::array<float,2>{0.898624241f, 0.682552218f},
-std::array<float,2>{0.31351468f, 0.876957178f},
-std::array<float,2>{0.609852016f, 0.0968379453f},
-std::array<float,2>{0.488035887f, 0.222778991f},
-std::array<float,2>{0.740003347f, 0.821308196f},
-std::array<float,2>{0.094549261f, 0.538755536f},
-std::array<float,2>{0.837213278f, 0.360381603f},
-std::array<float,2>{0.216029465f, 0.119604051f},
-std::array<float,2>{0.923353195f, 0.892689586f},
-std::array<float,2>{0.370537698f, 0.665492892f},
-std::array<float,2>{0.58002001f, 0.392095178f},
-std::array<float,2>{0.452600539f, 0.351076216f},
-std::array<float,2>{0.7100178f, 0.547878206f},
-std::array<float,2>{0.0781341195f, 0.840444088f},
-std::array<float,2>{0.854860008f, 0.235056475f},
-std::array<float,2>{0.0507497005f, 0.471040845f},
-std::array<float,2>{0.784818649f, 0.71076405f},
-std::array<float,2>{0.379177123f, 0.963427365f},
-std::array<float,2>{0.678617597f, 0.0447463915f},
-std::array<float,2>{0.269124538f, 0.156337589f},
-std::array<float,2>{0.552074671f, 0.780812442f},
-std::array<float,2>{0.141387537f, 0.623721182f},
-std::array<float,2>{0.957874119f, 0.309787989f},
-std::array<float,2>{0.111330077f, 0.203285649f},
-std::array<float,2>{0.823281884f, 0.856729269f},
-std::array<float,2>{0.469145983f, 0.524524629f},
-std::array<float,2>{0.72416997f, 0.319911093f},
-std::array<float,2>{0.340488404f, 0.429367512f},
-std::array<float,2>{0.604747653f, 0.640702128f},
-std::array<float,2>{0.232241586f, 0.921658933f},
-std::array<float,2>{0.884745181f, 0.0635729432f},
-std::array<float,2>{0.177656561f, 0.270508468f},
-std::array<float,2>{0.971537054f, 0.591963887f},
-std::array<float,2>{0.298388928f, 0.811315656f},
-std::array<float,2>{0.502141058f, 0.154721156f},
-std::array<float,2>{0.425128102f, 0.0126696117f},
-std::array<float,2>{0.636002421f, 0.971813738f},
-std::array<float,2>{0.0136087714f, 0.719728947f},
-std::array<float,2>{0.759999275f, 0.455167055f},
-std::array<float,2>{0.224843726f, 0.245830685f},
-std::array<float,2>{0.880936205f, 0.83328855f},
-std::array<float,2>{0.329695851f, 0.561800957f},
-std::array<float,2>{0.596139073f, 0.353865743f},
-std::array<float,2>{0.483538479f, 0.401802361f},
-std::array<float,2>{0.729691744f, 0.660515726f},
-std::array<float,2>{0.123402648f, 0.901049197f},
-std::array<float,2>{0.818355441f, 0.116567634f},
-std::array<float,2>{0.00450464524f, 0.303578526f},
-std::array<float,2>{0.750332773f, 0.612350225f},
-std::array<float,2>{0.430409074f, 0.769833624f},
-std::array<float,2>{0.63098973f, 0.170219257f},
-std::array<float,2>{0.309999377f, 0.0320195705f},
-std::array<float,2>{0.513024867f, 0.955281734f},
-std::array<float,2>{0.187253222f, 0.712188125f},
-std::array<float,2>{0.982422233f, 0.479444742f},
-std::array<float,2>{0.0902101919f, 0.0712303668f},
-std::array<float,2>{0.843968689f, 0.908889592f},
-std::array<float,2>{0.438289821f, 0.649163425f},
-std::array<float,2>{0.713147938f, 0.432934612f},
-std::array<float,2>{0.364028603f, 0.326267987f},
-std::array<float,2>{0.588216662f, 0.518778145f},
-std::array<float,2>{0.207083106f, 0.846047342f},
-std::array<float,2>{0.930707037f, 0.211972907f},
-std::array<float,2>{0.150183409f, 0.463848412f},
-std::array<float,2>{0.963443875f, 0.732043803f},
-std::array<float,2>{0.275157273f, 0.977518678f},
-std::array<float,2>{0.555676103f, 0.00279410766f},
-std::array<float,2>{0.38834399f, 0.141995966f},
-std::array<float,2>{0.685139596f, 0.803943574f},
-std::array<float,2>{0.0554870293f, 0.578468084f},
-std::array<float,2>{0.796386838f, 0.280362278f},
-std::array<float,2>{0.160150126f, 0.0298263021f},
-std::array<float,2>{0.990432441f, 0.999336302f},
-std::array<float,2>{0.290748924f, 0.748310208f},
-std::array<float,2>{0.517501533f, 0.446551085f},
-std::array<float,2>{0.419520468f, 0.256996542f},
-std::array<float,2>{0.644105077f, 0.566857517f},
-std::array<float,2>{0.0251896307f, 0.788595855f},
-std::array<float,2>{0.771748543f, 0.13958554f},
-std::array<float,2>{0.108020894f, 0.417742789f},
-std::array<float,2>{0.83114028f, 0.63956219f},
-std::array<float,2>{0.496287465f, 0.930707395f},
-std::array<float,2>{0.744235396f, 0.0889488682f},
-std::array<float,2>{0.326264381f, 0.193515942f},
-std::array<float,2>{0.622719467f, 0.870663226f},
-std::array<float,2>{0.24603866f, 0.507794499f},
-std::array<float,2>{0.896554649f, 0.333597779f},
-std::array<float,2>{0.0457983762f, 0.175262153f},
-std::array<float,2>{0.797243476f, 0.763593614f},
-std::array<float,2>{0.397567093f, 0.600963712f},
-std::array<float,2>{0.663747847f, 0.296105027f},
-std::array<float,2>{0.257429361f, 0.497731745f},
-std::array<float,2>{0.545101345f, 0.700667739f},
-std::array<float,2>{0.132875308f, 0.944855273f},
-std::array<float,2>{0.938075066f, 0.0475326106f},
-std::array<float,2>{0.192485526f, 0.369421393f},
-std::array<float,2>{0.910094082f, 0.539398611f},
-std::array<float,2>{0.359212488f, 0.815639973f},
-std::array<float,2>{0.565254033f, 0.231660932f},
-std::array<float,2>{0.466791511f, 0.105783038f},
-std::array<float,2>{0.692146719f, 0.885142207f},
-std::array<float,2>{0.0639513507f, 0.6760934f},
-std::array<float,2>{0.874689102f, 0.383768588f},
-std::array<float,2>{0.198226318f, 0.165781215f},
-std::array<float,2>{0.918461621f, 0.769320965f},
-std::array<float,2>{0.351332456f, 0.615948379f},
-std::array<float,2>{0.576863348f, 0.299908072f},
-std::array<float,2>{0.457921475f, 0.481157303f},
-std::array<float,2>{0.702175736f, 0.714910626f},
-std::array<float,2>{0.0764707178f, 0.958007812f},
-std::array<float,2>{0.864869416f, 0.0368740484f},
-std::array<float,2>{0.0387411937f, 0.356655389f},
-std::array<float,2>{0.80834353f, 0.555157602f},
-std::array<float,2>{0.403704494f, 0.828404069f},
-std::array<float,2>{0.664440095f, 0.246108189f},
-std::array<float,2>{0.258313209f, 0.112130344f},
-std::array<float,2>{0.535396934f, 0.904210627f},
-std::array<float,2>{0.125642121f, 0.65892446f},
-std::array<float,2>{0.947536349f, 0.40450561f},
-std::array<float,2>{0.0984899327f, 0.00464501325f},
-std::array<float,2>{0.842805207f, 0.980793774f},
-std::array<float,2>{0.490731537f, 0.72998631f},
-std::array<float,2>{0.734482229f, 0.467152655f},
-std::array<float,2>{0.317394555f, 0.277014643f},
-std::array<float,2>{0.614201546f, 0.585338771f},
-std::array<float,2>{0.239978686f, 0.798524082f},
-std::array<float,2>{0.904075146f, 0.147494003f},
-std::array<float,2>{0.164179906f, 0.435400516f},
-std::array<float,2>{0.995726168f, 0.656118333f},
-std::array<float,2>{0.281892568f, 0.911854625f},
-std::array<float,2>{0.52748245f, 0.0772590786f},
-std::array<float,2>{0.40787974f, 0.216938108f},
-std::array<float,2>{0.655062854f, 0.850406885f},
-std::array<float,2>{0.0174519103f, 0.519765139f},
-std::array<float,2>{0.777530193f, 0.321211278f},
-std::array<float,2>{0.148246214f, 0.093687959f},
-std::array<float,2>{0.954910994f, 0.936323106f},
-std::array<float,2>{0.273068517f, 0.63544178f},
-std::array<float,2>{0.547163546f, 0.417974383f},
-std::array<float,2>{0.376623571f, 0.330037087f},
-std::array<float,2>{0.674928665f, 0.500213444f},
-std::array<float,2>{0.0523902029f, 0.873102725f},
-std::array<float,2>{0.785973907f, 0.191281348f},
-std::array<float,2>{0.084120065f, 0.449822873f},
-std::array<float,2>{0.857445657f, 0.744798124f},
-std::array<float,2>{0.447137862f, 0.992617548f},
-std::array<float,2>{0.705652952f, 0.0273416359f},
-std::array<float,2>{0.374454796f, 0.135458931f},
-std::array<float,2>{0.58302927f, 0.784214199f},
-std::array<float,2>{0.214498565f, 0.563207388f},
-std::array<float,2>{0.926898003f, 0.252720565f},
-std::array<float,2>{0.0103963241f, 0.227457762f},
-std::array<float,2>{0.762991965f, 0.819638729f},
-std::array<float,2>{0.428302646f, 0.54620254f},
-std::array<float,2>{0.637752771f, 0.371518761f},
-std::array<float,2>{0.303838998f, 0.38908729f},
-std::array<float,2>{0.50614506f, 0.674373329f},
-std::array<float,2>{0.172386721f, 0.889194369f},
-std::array<float,2>{0.973477125f, 0.105267249f},
-std::array<float,2>{0.229911178f, 0.292818516f},
-std::array<float,2>{0.889526248f, 0.594251156f},
-std::array<float,2>{0.33873263f, 0.760184646f},
-std::array<float,2>{0.606066644f, 0.179648414f},
-std::array<float,2>{0.473455727f, 0.0542280897f},
-std::array<float,2>{0.722565532f, 0.937897682f},
-std::array<float,2>{0.116967045f, 0.696457088f},
-std::array<float,2>{0.826726019f, 0.495431513f},
-std::array<float,2>{0.182123467f, 0.200231135f},
-std::array<float,2>{0.977911294f, 0.860923409f},
-std::array<float,2>{0.305374086f, 0.511331022f},
-std::array<float,2>{0.50845027f, 0.338951796f},
-std::array<float,2>{0.435830504f, 0.413465351f},
-std::array<float,2>{0.627644956f, 0.625898302f},
-std::array<float,2>{0.00379635021f, 0.926183343f},
-std::array<float,2>{0.754727185f, 0.0783293545f},
-std::array<float,2>{0.120435551f, 0.265272737f},
-std::array<float,2>{0.81433481f, 0.571153045f},
-std::array<float,2>{0.478602707f, 0.792232692f},
-std::array<float,2>{0.73314482f, 0.131918028f},
-std::array<float,2>{0.334117115f, 0.0217979867f},
-std::array<float,2>{0.601471245f, 0.990965247f},
-std::array<float,2>{0.220431075f, 0.740053952f},
-std::array<float,2>{0.875405431f, 0.440661401f},
-std::array<float,2>{0.0601578914f, 0.10133718f},
-std::array<float,2>{0.791211963f, 0.88233608f},
-std::array<float,2>{0.386575401f, 0.685799062f},
-std::array<float,2>{0.6817047f, 0.379259735f},
-std::array<float,2>{0.279242516f, 0.365618676f},
-std::array<float,2>{0.560395062f, 0.531582892f},
-std::array<float,2>{0.153986335f, 0.827360809f},
-std::array<float,2>{0.965154409f, 0.222015277f},
-std::array<float,2>{0.203333408f, 0.487380773f},
-std::array<float,2>{0.934263706f, 0.692478418f},
-std::array<float,2>{0.363099217f, 0.948791087f},
-std::array<float,2>{0.590938687f, 0.0621987544f},
-std::array<float,2>{0.443840891f, 0.186744958f},
-std::array<float,2>{0.715317726f, 0.754503667f},
-std::array<float,2>{0.0898113921f, 0.603582561f},
-std::array<float,2>{0.848548114f, 0.286687493f},
-std::array<float,2>{0.249787644f, 0.0422256589f},
-std::array<float,2>{0.892192543f, 0.96742487f},
-std::array<float,2>{0.323305398f, 0.705183625f},
-std::array<float,2>{0.617256224f, 0.472965181f},
-std::array<float,2>{0.492197901f, 0.304961473f},
-std::array<float,2>{0.748847365f, 0.619681597f},
-std::array<float,2>{0.101702392f, 0.775578022f},
-std::array<float,2>{0.835281193f, 0.160258293f},
-std::array<float,2>{0.0291519947f, 0.395531476f},
-std::array<float,2>{0.767046571f, 0.670553207f},
-std::array<float,2>{0.415899903f, 0.89600879f},
-std::array<float,2>{0.647522449f, 0.12194287f},
-std::array<float,2>{0.295268983f, 0.241732866f},
-std::array<float,2>{0.520418227f, 0.836748242f},
-std::array<float,2>{0.161748797f, 0.552707195f},
-std::array<float,2>{0.986177206f, 0.344770879f},
-std::array<float,2>{0.0684478283f, 0.151720196f},
-std::array<float,2>{0.869002223f, 0.80726248f},
-std::array<float,2>{0.463381499f, 0.588339746f},
-std::array<float,2>{0.689688981f, 0.269417822f},
-std::array<float,2>{0.351984054f, 0.459653735f},
-std::array<float,2>{0.568167865f, 0.725349545f},
-std::array<float,2>{0.1906946f, 0.972813189f},
-std::array<float,2>{0.913747668f, 0.00816924404f},
-std::array<float,2>{0.137515515f, 0.315166771f},
-std::array<float,2>{0.942118645f, 0.529957294f},
-std::array<float,2>{0.252416492f, 0.853277266f},
-std::array<float,2>{0.539705157f, 0.208160028f},
-std::array<float,2>{0.392466486f, 0.0677199662f},
-std::array<float,2>{0.657135725f, 0.914307475f},
-std::array<float,2>{0.0407914333f, 0.645456672f},
-std::array<float,2>{0.802268445f, 0.422142178f},
-std::array<float,2>{0.169173479f, 0.182202443f},
-std::array<float,2>{0.99959904f, 0.751790106f},
-std::array<float,2>{0.286220998f, 0.608462632f},
-std::array<float,2>{0.52542448f, 0.283833712f},
-std::array<float,2>{0.412967116f, 0.489302665f},
-std::array<float,2>{0.650199234f, 0.687962115f},
-std::array<float,2>{0.0196846481f, 0.951502442f},
-std::array<float,2>{0.774552345f, 0.0551986173f},
-std::array<float,2>{0.0975024253f, 0.361910045f},
-std::array<float,2>{0.83929652f, 0.537081122f},
-std::array<float,2>{0.485626638f, 0.822849691f},
-std::array<float,2>{0.740847945f, 0.225236982f},
-std::array<float,2>{0.31495735f, 0.095196791f},
-std::array<float,2>{0.612699687f, 0.876818001f},
-std::array<float,2>{0.235071123f, 0.680586159f},
-std::array<float,2>{0.90165931f, 0.376170278f},
-std::array<float,2>{0.0340169184f, 0.0162359811f},
-std::array<float,2>{0.80897975f, 0.987500906f},
-std::array<float,2>{0.400393993f, 0.736688018f},
-std::array<float,2>{0.670802414f, 0.442155361f},
-std::array<float,2>{0.263001561f, 0.26085937f},
-std::array<float,2>{0.532170951f, 0.577032924f},
-std::array<float,2>{0.129085079f, 0.796655595f},
-std::array<float,2>{0.952885628f, 0.125021756f},
-std::array<float,2>{0.20056352f, 0.406663686f},
-std::array<float,2>{0.914396465f, 0.631070733f},
-std::array<float,2>{0.344530404f, 0.92380625f},
-std::array<float,2>{0.571638525f, 0.0856642127f},
-std::array<float,2>{0.456631809f, 0.197550848f},
-std::array<float,2>{0.695829093f, 0.864536047f},
-std::array<float,2>{0.0708944052f, 0.514571667f},
-std::array<float,2>{0.860603631f, 0.341803104f},
-std::array<float,2>{0.233945698f, 0.0652280301f},
-std::array<float,2>{0.885842085f, 0.918804288f},
-std::array<float,2>{0.342346311f, 0.643041611f},
-std::array<float,2>{0.602990031f, 0.42615518f},
-std::array<float,2>{0.471352428f, 0.316615731f},
-std::array<float,2>{0.72516185f, 0.52648133f},
-std::array<float,2>{0.109742701f, 0.858640611f},
-std::array<float,2>{0.821570277f, 0.205250695f},
-std::array<float,2>{0.0147324754f, 0.453160137f},
-std::array<float,2>{0.757888496f, 0.721127987f},
-std::array<float,2>{0.422270983f, 0.969048262f},
-std::array<float,2>{0.63380444f, 0.0151434075f},
-std::array<float,2>{0.299646258f, 0.154084235f},
-std::array<float,2>{0.501664817f, 0.809643567f},
-std::array<float,2>{0.177979916f, 0.590541542f},
-std::array<float,2>{0.970145702f, 0.271662891f},
-std::array<float,2>{0.0816965923f, 0.236989111f},
-std::array<float,2>{0.852567434f, 0.843250513f},
-std::array<float,2>{0.449555993f, 0.550177157f},
-std::array<float,2>{0.708973408f, 0.34782356f},
-std::array<float,2>{0.367807776f, 0.393620849f},
-std::array<float,2>{0.581158221f, 0.666400552f},
-std::array<float,2>{0.217147931f, 0.892553449f},
-std::array<float,2>{0.923841119f, 0.117551126f},
-std::array<float,2>{0.143673763f, 0.311674088f},
-std::array<float,2>{0.959800303f, 0.622933388f},
-std::array<float,2>{0.265713215f, 0.777829528f},
-std::array<float,2>{0.553479195f, 0.159590647f},
-std::array<float,2>{0.382410526f, 0.0459177978f},
-std::array<float,2>{0.676421225f, 0.961471558f},
-std::array<float,2>{0.0488112718f, 0.708947301f},
-std::array<float,2>{0.781630158f, 0.469610214f},
-std::array<float,2>{0.209262803f, 0.213179976f},
-std::array<float,2>{0.933136463f, 0.843921781f},
-std::array<float,2>{0.367104769f, 0.517248392f},
-std::array<float,2>{0.586093605f, 0.325459599f},
-std::array<float,2>{0.440651029f, 0.430994481f},
-std::array<float,2>{0.711672723f, 0.650459349f},
-std::array<float,2>{0.0921255872f, 0.907783449f},
-std::array<float,2>{0.84717387f, 0.0727705956f},
-std::array<float,2>{0.0576089732f, 0.279031843f},
-std::array<float,2>{0.793371618f, 0.581902921f},
-std::array<float,2>{0.389636993f, 0.801499069f},
-std::array<float,2>{0.685933709f, 0.143634945f},
-std::array<float,2>{0.277204514f, 4.97247493e-05f},
-std::array<float,2>{0.557978511f, 0.978979707f},
-std::array<float,2>{0.151725605f, 0.733643889f},
-std::array<float,2>{0.961637676f, 0.461845964f},
-std::array<float,2>{0.122284666f, 0.114686772f},
-std::array<float,2>{0.819407642f, 0.89960438f},
-std::array<float,2>{0.481372267f, 0.663716614f},
-std::array<float,2>{0.728240073f, 0.400122285f},
-std::array<float,2>{0.331727773f, 0.353268504f},
-std::array<float,2>{0.595012605f, 0.560372233f},
-std::array<float,2>{0.223433003f, 0.835518718f},
-std::array<float,2>{0.879943669f, 0.242510721f},
-std::array<float,2>{0.184942171f, 0.477004141f},
-std::array<float,2>{0.980969429f, 0.714035988f},
-std::array<float,2>{0.311587632f, 0.954465389f},
-std::array<float,2>{0.515509546f, 0.0340511426f},
-std::array<float,2>{0.433228493f, 0.168419972f},
-std::array<float,2>{0.629840374f, 0.772939503f},
-std::array<float,2>{0.00703498814f, 0.611126661f},
-std::array<float,2>{0.75284642f, 0.302702427f},
-std::array<float,2>{0.13592416f, 0.0502586737f},
-std::array<float,2>{0.940063536f, 0.941995621f},
-std::array<float,2>{0.255295813f, 0.702660799f},
-std::array<float,2>{0.544346273f, 0.49978599f},
-std::array<float,2>{0.395485431f, 0.29359436f},
-std::array<float,2>{0.660372496f, 0.59796083f},
-std::array<float,2>{0.0433115587f, 0.764070749f},
-std::array<float,2>{0.800617754f, 0.173646122f},
-std::array<float,2>{0.0648590475f, 0.385206282f},
-std::array<float,2>{0.871817172f, 0.678788483f},
-std::array<float,2>{0.467288852f, 0.883536637f},
-std::array<float,2>{0.694640934f, 0.10893818f},
-std::array<float,2>{0.356048584f, 0.233787239f},
-std::array<float,2>{0.563588858f, 0.813176095f},
-std::array<float,2>{0.193891346f, 0.542492151f},
-std::array<float,2>{0.906487763f, 0.36719653f},
-std::array<float,2>{0.026198199f, 0.138113678f},
-std::array<float,2>{0.7711519f, 0.785921454f},
-std::array<float,2>{0.420947641f, 0.570148826f},
-std::array<float,2>{0.64253813f, 0.25524798f},
-std::array<float,2>{0.292187691f, 0.447523236f},
-std::array<float,2>{0.518977344f, 0.746199369f},
-std::array<float,2>{0.158090606f, 0.99709022f},
-std::array<float,2>{0.988753557f, 0.0289580394f},
-std::array<float,2>{0.242787138f, 0.33465755f},
-std::array<float,2>{0.894820154f, 0.504235148f},
-std::array<float,2>{0.324546605f, 0.867672622f},
-std::array<float,2>{0.62405473f, 0.192143708f},
-std::array<float,2>{0.499436438f, 0.0873370022f},
-std::array<float,2>{0.742510617f, 0.9320997f},
-std::array<float,2>{0.107143193f, 0.637678266f},
-std::array<float,2>{0.829386234f, 0.415370822f},
-std::array<float,2>{0.241010129f, 0.146119162f},
-std::array<float,2>{0.90475136f, 0.79931885f},
-std::array<float,2>{0.319863409f, 0.583832026f},
-std::array<float,2>{0.616957545f, 0.273552358f},
-std::array<float,2>{0.489096701f, 0.465944231f},
-std::array<float,2>{0.737116933f, 0.728414178f},
-std::array<float,2>{0.100519113f, 0.984213114f},
-std::array<float,2>{0.841265559f, 0.0070015192f},
-std::array<float,2>{0.018393565f, 0.322699457f},
-std::array<float,2>{0.780100107f, 0.522172749f},
-std::array<float,2>{0.409876376f, 0.848234892f},
-std::array<float,2>{0.653411269f, 0.215460494f},
-std::array<float,2>{0.28487137f, 0.076072067f},
-std::array<float,2>{0.531175673f, 0.913099885f},
-std::array<float,2>{0.167659163f, 0.652686119f},
-std::array<float,2>{0.993821025f, 0.436462194f},
-std::array<float,2>{0.0746099725f, 0.0382921286f},
-std::array<float,2>{0.866410434f, 0.960712016f},
-std::array<float,2>{0.459413797f, 0.718166232f},
-std::array<float,2>{0.700768113f, 0.48300451f},
-std::array<float,2>{0.349187464f, 0.297137618f},
-std::array<float,2>{0.575800896f, 0.613986313f},
-std::array<float,2>{0.19615081f, 0.766314268f},
-std::array<float,2>{0.920234144f, 0.166177705f},
-std::array<float,2>{0.128403008f, 0.403912634f},
-std::array<float,2>{0.946092308f, 0.656880617f},
-std::array<float,2>{0.261185914f, 0.905876577f},
-std::array<float,2>{0.53882426f, 0.1111129f},
-std::array<float,2>{0.405084908f, 0.248422772f},
-std::array<float,2>{0.666280985f, 0.831819654f},
-std::array<float,2>{0.0369535759f, 0.558350801f},
-std::array<float,2>{0.805884898f, 0.358823538f},
-std::array<float,2>{0.174019992f, 0.10162168f},
-std::array<float,2>{0.976376176f, 0.888404906f},
-std::array<float,2>{0.301251352f, 0.673126757f},
-std::array<float,2>{0.504245639f, 0.388058126f},
-std::array<float,2>{0.42745477f, 0.373571962f},
-std::array<float,2>{0.638763249f, 0.544228196f},
-std::array<float,2>{0.00867984258f, 0.818285704f},
-std::array<float,2>{0.764471292f, 0.22900413f},
-std::array<float,2>{0.114335418f, 0.492698014f},
-std::array<float,2>{0.824229121f, 0.697515368f},
-std::array<float,2>{0.476261169f, 0.939919531f},
-std::array<float,2>{0.719349086f, 0.0518645719f},
-std::array<float,2>{0.337297589f, 0.177443996f},
-std::array<float,2>{0.609251082f, 0.759646177f},
-std::array<float,2>{0.228166744f, 0.596261024f},
-std::array<float,2>{0.888242841f, 0.289463818f},
-std::array<float,2>{0.0542024486f, 0.189305216f},
-std::array<float,2>{0.788775563f, 0.871183455f},
-std::array<float,2>{0.377829075f, 0.502217472f},
-std::array<float,2>{0.673663497f, 0.331359565f},
-std::array<float,2>{0.270120472f, 0.421650529f},
-std::array<float,2>{0.550031364f, 0.633765101f},
-std::array<float,2>{0.144797981f, 0.934478402f},
-std::array<float,2>{0.956565738f, 0.0903860852f},
-std::array<float,2>{0.211792648f, 0.250075996f},
-std::array<float,2>{0.928828537f, 0.564794719f},
-std::array<float,2>{0.371696442f, 0.782630503f},
-std::array<float,2>{0.584226787f, 0.133190468f},
-std::array<float,2>{0.448731184f, 0.0236103162f},
-std::array<float,2>{0.703366339f, 0.995677948f},
-std::array<float,2>{0.0831838772f, 0.742296219f},
-std::array<float,2>{0.855586052f, 0.45144847f},
-std::array<float,2>{0.155535698f, 0.218981594f},
-std::array<float,2>{0.967622697f, 0.825536609f},
-std::array<float,2>{0.280320078f, 0.534372568f},
-std::array<float,2>{0.562364578f, 0.363894939f},
-std::array<float,2>{0.383915484f, 0.38202244f},
-std::array<float,2>{0.681553781f, 0.683627486f},
-std::array<float,2>{0.0623511374f, 0.880143702f},
-std::array<float,2>{0.789192915f, 0.098600179f},
-std::array<float,2>{0.086703226f, 0.287424505f},
-std::array<float,2>{0.849975109f, 0.602566004f},
-std::array<float,2>{0.441642463f, 0.75726825f},
-std::array<float,2>{0.718618214f, 0.184318796f},
-std::array<float,2>{0.360171914f, 0.0593820438f},
-std::array<float,2>{0.593080163f, 0.946113288f},
-std::array<float,2>{0.205133453f, 0.695135474f},
-std::array<float,2>{0.935757041f, 0.485136956f},
-std::array<float,2>{0.00173629192f, 0.0807494819f},
-std::array<float,2>{0.757575333f, 0.928767264f},
-std::array<float,2>{0.434964538f, 0.627254367f},
-std::array<float,2>{0.626260936f, 0.410807937f},
-std::array<float,2>{0.307514876f, 0.336745411f},
-std::array<float,2>{0.509948969f, 0.508045614f},
-std::array<float,2>{0.18161197f, 0.862591326f},
-std::array<float,2>{0.980139673f, 0.202116743f},
-std::array<float,2>{0.220869407f, 0.438477963f},
-std::array<float,2>{0.877390623f, 0.741394341f},
-std::array<float,2>{0.333852142f, 0.990123689f},
-std::array<float,2>{0.599591196f, 0.0214487929f},
-std::array<float,2>{0.478274137f, 0.130806014f},
-std::array<float,2>{0.732132375f, 0.790698946f},
-std::array<float,2>{0.118381433f, 0.573504865f},
-std::array<float,2>{0.814948916f, 0.263367444f},
-std::array<float,2>{0.189213291f, 0.0102861123f},
-std::array<float,2>{0.910993338f, 0.975677311f},
-std::array<float,2>{0.353885174f, 0.722783506f},
-std::array<float,2>{0.569757462f, 0.458084166f},
-std::array<float,2>{0.461829185f, 0.267318249f},
-std::array<float,2>{0.688170671f, 0.586399615f},
-std::array<float,2>{0.0674172267f, 0.805929542f},
-std::array<float,2>{0.869613826f, 0.150096789f},
-std::array<float,2>{0.0416500084f, 0.425523818f},
-std::array<float,2>{0.803582907f, 0.647642493f},
-std::array<float,2>{0.393444926f, 0.91741091f},
-std::array<float,2>{0.659965754f, 0.0701366812f},
-std::array<float,2>{0.25000158f, 0.21041058f},
-std::array<float,2>{0.542142093f, 0.854995608f},
-std::array<float,2>{0.140308455f, 0.52845645f},
-std::array<float,2>{0.943453968f, 0.312605679f},
-std::array<float,2>{0.104257509f, 0.162955076f},
-std::array<float,2>{0.833723664f, 0.773579895f},
-std::array<float,2>{0.494979918f, 0.619064987f},
-std::array<float,2>{0.746170759f, 0.307710111f},
-std::array<float,2>{0.321463406f, 0.475923091f},
-std::array<float,2>{0.620912611f, 0.704579592f},
-std::array<float,2>{0.247044772f, 0.966586709f},
-std::array<float,2>{0.894442201f, 0.0403833687f},
-std::array<float,2>{0.162133694f, 0.347067922f},
-std::array<float,2>{0.987335324f, 0.553914011f},
-std::array<float,2>{0.293344468f, 0.839654863f},
-std::array<float,2>{0.522039294f, 0.239771873f},
-std::array<float,2>{0.41671437f, 0.123818897f},
-std::array<float,2>{0.646359444f, 0.897603273f},
-std::array<float,2>{0.0300436355f, 0.668309152f},
-std::array<float,2>{0.769164443f, 0.397790819f},
-std::array<float,2>{0.142069027f, 0.158207804f},
-std::array<float,2>{0.958815396f, 0.778886199f},
-std::array<float,2>{0.268019676f, 0.622018754f},
-std::array<float,2>{0.550814807f, 0.311138541f},
-std::array<float,2>{0.38034153f, 0.469871908f},
-std::array<float,2>{0.67924273f, 0.707701087f},
-std::array<float,2>{0.0497352779f, 0.962261319f},
-std::array<float,2>{0.783986449f, 0.0451450348f},
-std::array<float,2>{0.0791800842f, 0.348834187f},
-std::array<float,2>{0.853785276f, 0.549392819f},
-std::array<float,2>{0.451900452f, 0.8420977f},
-std::array<float,2>{0.709956348f, 0.237305015f},
-std::array<float,2>{0.369680583f, 0.118253708f},
-std::array<float,2>{0.578802049f, 0.891532242f},
-std::array<float,2>{0.215036318f, 0.667062402f},
-std::array<float,2>{0.922498524f, 0.393296242f},
-std::array<float,2>{0.0117446734f, 0.0139461551f},
-std::array<float,2>{0.761635959f, 0.970239758f},
-std::array<float,2>{0.424768895f, 0.721758842f},
-std::array<float,2>{0.634866595f, 0.454295725f},
-std::array<float,2>{0.296977997f, 0.272895813f},
-std::array<float,2>{0.503294289f, 0.590992212f},
-std::array<float,2>{0.175874904f, 0.809240401f},
-std::array<float,2>{0.972593129f, 0.152451143f},
-std::array<float,2>{0.230542138f, 0.427354097f},
-std::array<float,2>{0.882870793f, 0.644492865f},
-std::array<float,2>{0.341228694f, 0.919740379f},
-std::array<float,2>{0.603680909f, 0.0663516745f},
-std::array<float,2>{0.469991863f, 0.206773937f},
-std::array<float,2>{0.723172665f, 0.857842028f},
-std::array<float,2>{0.113036625f, 0.526008368f},
-std::array<float,2>{0.822525263f, 0.317627013f},
-std::array<float,2>{0.20196183f, 0.0843081325f},
-std::array<float,2>{0.917731881f, 0.921919048f},
-std::array<float,2>{0.347276568f, 0.631940365f},
-std::array<float,2>{0.572852969f, 0.408193856f},
-std::array<float,2>{0.454665154f, 0.343418777f},
-std::array<float,2>{0.697650254f, 0.515325904f},
-std::array<float,2>{0.0731275082f, 0.864095926f},
-std::array<float,2>{0.861465275f, 0.198262542f},
-std::array<float,2>{0.0319628678f, 0.442459702f},
-std::array<float,2>{0.810987294f, 0.737379909f},
-std::array<float,2>{0.398508877f, 0.986512721f},
-std::array<float,2>{0.669869661f, 0.017095957f},
-std::array<float,2>{0.264155895f, 0.126862228f},
-std::array<float,2>{0.535138071f, 0.795825303f},
-std::array<float,2>{0.131636053f, 0.577234328f},
-std::array<float,2>{0.950958371f, 0.26019451f},
-std::array<float,2>{0.0950697213f, 0.226348206f},
-std::array<float,2>{0.835944355f, 0.823631227f},
-std::array<float,2>{0.486489713f, 0.53589654f},
-std::array<float,2>{0.739119828f, 0.362852961f},
-std::array<float,2>{0.313325614f, 0.375781804f},
-std::array<float,2>{0.610846996f, 0.681115985f},
-std::array<float,2>{0.237028673f, 0.87558496f},
-std::array<float,2>{0.899940491f, 0.0939857662f},
-std::array<float,2>{0.170031697f, 0.284741044f},
-std::array<float,2>{0.997981966f, 0.608352959f},
-std::array<float,2>{0.288383722f, 0.750789285f},
-std::array<float,2>{0.525381804f, 0.182901382f},
-std::array<float,2>{0.411486f, 0.0563004576f},
-std::array<float,2>{0.652016401f, 0.952877879f},
-std::array<float,2>{0.0218682326f, 0.68877852f},
-std::array<float,2>{0.776627302f, 0.48851338f},
-std::array<float,2>{0.244884163f, 0.192567945f},
-std::array<float,2>{0.897876978f, 0.868485689f},
-std::array<float,2>{0.32806775f, 0.505415976f},
-std::array<float,2>{0.621976793f, 0.33523196f},
-std::array<float,2>{0.497099459f, 0.414965838f},
-std::array<float,2>{0.745942473f, 0.638233781f},
-std::array<float,2>{0.109026f, 0.932787299f},
-std::array<float,2>{0.830119789f, 0.0864432305f},
-std::array<float,2>{0.0240037516f, 0.254399389f},
-std::array<float,2>{0.772762835f, 0.569134593f},
-std::array<float,2>{0.418449908f, 0.786544919f},
-std::array<float,2>{0.643142402f, 0.137619108f},
-std::array<float,2>{0.289939642f, 0.0280349459f},
-std::array<float,2>{0.516470373f, 0.996857762f},
-std::array<float,2>{0.158543646f, 0.74733758f},
-std::array<float,2>{0.991681993f, 0.449099809f},
-std::array<float,2>{0.0626196787f, 0.107739173f},
-std::array<float,2>{0.873533666f, 0.884356737f},
-std::array<float,2>{0.465022683f, 0.678685427f},
-std::array<float,2>{0.693097711f, 0.386559576f},
-std::array<float,2>{0.357514858f, 0.368748486f},
-std::array<float,2>{0.565702677f, 0.541891694f},
-std::array<float,2>{0.192369074f, 0.814013541f},
-std::array<float,2>{0.908336878f, 0.232697859f},
-std::array<float,2>{0.134202048f, 0.498192668f},
-std::array<float,2>{0.939092875f, 0.701249838f},
-std::array<float,2>{0.256202936f, 0.943102598f},
-std::array<float,2>{0.546223879f, 0.048926197f},
-std::array<float,2>{0.397205085f, 0.172011435f},
-std::array<float,2>{0.662138581f, 0.764758587f},
-std::array<float,2>{0.0467969403f, 0.599594176f},
-std::array<float,2>{0.798273265f, 0.294341117f},
-std::array<float,2>{0.186245412f, 0.0347790122f},
-std::array<float,2>{0.983633637f, 0.953316569f},
-std::array<float,2>{0.309394509f, 0.712948263f},
-std::array<float,2>{0.512437165f, 0.4781515f},
-std::array<float,2>{0.431313425f, 0.301377952f},
-std::array<float,2>{0.632738829f, 0.609741926f},
-std::array<float,2>{0.00488304021f, 0.772090256f},
-std::array<float,2>{0.751525044f, 0.169865578f},
-std::array<float,2>{0.124085635f, 0.39941144f},
-std::array<float,2>{0.817366183f, 0.66302985f},
-std::array<float,2>{0.483386755f, 0.899404347f},
-std::array<float,2>{0.729358196f, 0.113463953f},
-std::array<float,2>{0.328987002f, 0.243389025f},
-std::array<float,2>{0.597193003f, 0.834151328f},
-std::array<float,2>{0.225954264f, 0.558877945f},
-std::array<float,2>{0.882286906f, 0.352172017f},
-std::array<float,2>{0.0560242645f, 0.143550158f},
-std::array<float,2>{0.79536289f, 0.80239588f},
-std::array<float,2>{0.387579322f, 0.580651939f},
-std::array<float,2>{0.684391618f, 0.277935982f},
-std::array<float,2>{0.274236411f, 0.462060839f},
-std::array<float,2>{0.555057585f, 0.732493758f},
-std::array<float,2>{0.149349168f, 0.979952872f},
-std::array<float,2>{0.964326441f, 0.00142115308f},
-std::array<float,2>{0.208457321f, 0.3244133f},
-std::array<float,2>{0.930615962f, 0.516046584f},
-std::array<float,2>{0.364612639f, 0.845537364f},
-std::array<float,2>{0.588950157f, 0.213986874f},
-std::array<float,2>{0.439390153f, 0.0741325617f},
-std::array<float,2>{0.714398146f, 0.906855404f},
-std::array<float,2>{0.0911882073f, 0.651555657f},
-std::array<float,2>{0.845210135f, 0.430420429f},
-std::array<float,2>{0.213646591f, 0.134514526f},
-std::array<float,2>{0.926082015f, 0.781324625f},
-std::array<float,2>{0.373657107f, 0.566160083f},
-std::array<float,2>{0.582464576f, 0.25145784f},
-std::array<float,2>{0.44545126f, 0.453020781f},
-std::array<float,2>{0.706874371f, 0.743581772f},
-std::array<float,2>{0.0857110247f, 0.994588852f},
-std::array<float,2>{0.8590343f, 0.0251929592f},
-std::array<float,2>{0.0514186397f, 0.330116749f},
-std::array<float,2>{0.78691119f, 0.503306448f},
-std::array<float,2>{0.375651628f, 0.872154653f},
-std::array<float,2>{0.674381256f, 0.187778309f},
-std::array<float,2>{0.272454888f, 0.0911475718f},
-std::array<float,2>{0.547928691f, 0.935282469f},
-std::array<float,2>{0.146825209f, 0.634116888f},
-std::array<float,2>{0.953894675f, 0.420620888f},
-std::array<float,2>{0.115514331f, 0.0512303077f},
-std::array<float,2>{0.827241123f, 0.940952837f},
-std::array<float,2>{0.474570274f, 0.698618114f},
-std::array<float,2>{0.721304476f, 0.493734121f},
-std::array<float,2>{0.33957991f, 0.290195942f},
-std::array<float,2>{0.606681049f, 0.59755367f},
-std::array<float,2>{0.228695288f, 0.758293211f},
-std::array<float,2>{0.890130758f, 0.176420331f},
-std::array<float,2>{0.173071638f, 0.386804849f},
-std::array<float,2>{0.974337995f, 0.672115564f},
-std::array<float,2>{0.303240895f, 0.887408912f},
-std::array<float,2>{0.507387698f, 0.103271283f},
-std::array<float,2>{0.429194957f, 0.229672521f},
-std::array<float,2>{0.63721174f, 0.816885173f},
-std::array<float,2>{0.0114436541f, 0.543603241f},
-std::array<float,2>{0.762395203f, 0.374303043f},
-std::array<float,2>{0.125982478f, 0.109545976f},
-std::array<float,2>{0.949120581f, 0.904831231f},
-std::array<float,2>{0.259540617f, 0.657876134f},
-std::array<float,2>{0.536458194f, 0.402895182f},
-std::array<float,2>{0.403023928f, 0.358022451f},
-std::array<float,2>{0.665054858f, 0.557448268f},
-std::array<float,2>{0.0371878557f, 0.830829084f},
-std::array<float,2>{0.806685865f, 0.249854878f},
-std::array<float,2>{0.0773921087f, 0.483649075f},
-std::array<float,2>{0.863990366f, 0.717543483f},
-std::array<float,2>{0.458693773f, 0.959053099f},
-std::array<float,2>{0.701735616f, 0.0379588418f},
-std::array<float,2>{0.350478292f, 0.167767137f},
-std::array<float,2>{0.577437043f, 0.766809404f},
-std::array<float,2>{0.199100867f, 0.614994824f},
-std::array<float,2>{0.918958127f, 0.297939241f},
-std::array<float,2>{0.0159602463f, 0.215908512f},
-std::array<float,2>{0.778713107f, 0.848748624f},
-std::array<float,2>{0.407149047f, 0.523353279f},
-std::array<float,2>{0.656007707f, 0.323632181f},
-std::array<float,2>{0.282571465f, 0.437217981f},
-std::array<float,2>{0.528931737f, 0.654003143f},
-std::array<float,2>{0.165707394f, 0.912349999f},
-std::array<float,2>{0.994468749f, 0.0747314543f},
-std::array<float,2>{0.238660157f, 0.275372118f},
-std::array<float,2>{0.90239346f, 0.582086563f},
-std::array<float,2>{0.317288131f, 0.800071597f},
-std::array<float,2>{0.614492059f, 0.144599095f},
-std::array<float,2>{0.491523713f, 0.00673143333f},
-std::array<float,2>{0.735442996f, 0.983034849f},
-std::array<float,2>{0.0991766751f, 0.726764739f},
-std::array<float,2>{0.842534959f, 0.465748072f},
-std::array<float,2>{0.160991728f, 0.238827676f},
-std::array<float,2>{0.985006869f, 0.838031769f},
-std::array<float,2>{0.296742469f, 0.5535568f},
-std::array<float,2>{0.520982206f, 0.346125394f},
-std::array<float,2>{0.414622307f, 0.397207499f},
-std::array<float,2>{0.646813273f, 0.669017315f},
-std::array<float,2>{0.0281957313f, 0.896627307f},
-std::array<float,2>{0.765929937f, 0.124590077f},
-std::array<float,2>{0.103512593f, 0.306659967f},
-std::array<float,2>{0.834236383f, 0.618126273f},
-std::array<float,2>{0.493227512f, 0.774697959f},
-std::array<float,2>{0.749398768f, 0.163210839f},
-std::array<float,2>{0.323163867f, 0.0396009237f},
-std::array<float,2>{0.619129539f, 0.965281367f},
-std::array<float,2>{0.248239532f, 0.703820944f},
-std::array<float,2>{0.891023815f, 0.474929035f},
-std::array<float,2>{0.039267987f, 0.0688852519f},
-std::array<float,2>{0.800803244f, 0.916431487f},
-std::array<float,2>{0.391526222f, 0.646616578f},
-std::array<float,2>{0.657443583f, 0.424354315f},
-std::array<float,2>{0.25387004f, 0.313540787f},
-std::array<float,2>{0.540726125f, 0.527757704f},
-std::array<float,2>{0.138293236f, 0.853883862f},
-std::array<float,2>{0.942618072f, 0.209340006f},
-std::array<float,2>{0.189697847f, 0.457972169f},
-std::array<float,2>{0.912230074f, 0.723806739f},
-std::array<float,2>{0.352807879f, 0.975248635f},
-std::array<float,2>{0.566941738f, 0.0115920864f},
-std::array<float,2>{0.464746267f, 0.149030313f},
-std::array<float,2>{0.690558612f, 0.804868758f},
-std::array<float,2>{0.0695566684f, 0.587025404f},
-std::array<float,2>{0.867856681f, 0.266100913f},
-std::array<float,2>{0.218829542f, 0.0200754125f},
-std::array<float,2>{0.876020312f, 0.989117563f},
-std::array<float,2>{0.335565954f, 0.741178036f},
-std::array<float,2>{0.599974394f, 0.4381181f},
-std::array<float,2>{0.480367213f, 0.262613118f},
-std::array<float,2>{0.734210074f, 0.572444797f},
-std::array<float,2>{0.119766802f, 0.789261937f},
-std::array<float,2>{0.812701643f, 0.129858494f},
-std::array<float,2>{0.00252110139f, 0.411840469f},
-std::array<float,2>{0.755658805f, 0.628285944f},
-std::array<float,2>{0.436582237f, 0.928566515f},
-std::array<float,2>{0.628890336f, 0.082025893f},
-std::array<float,2>{0.305832922f, 0.202370822f},
-std::array<float,2>{0.509694517f, 0.861552894f},
-std::array<float,2>{0.183535367f, 0.508942246f},
-std::array<float,2>{0.97724402f, 0.337859243f},
-std::array<float,2>{0.0881558359f, 0.184663564f},
-std::array<float,2>{0.848999441f, 0.75658375f},
-std::array<float,2>{0.444659621f, 0.602182567f},
-std::array<float,2>{0.716498911f, 0.288884878f},
-std::array<float,2>{0.361738205f, 0.486166924f},
-std::array<float,2>{0.590315998f, 0.694197953f},
-std::array<float,2>{0.204748079f, 0.947174549f},
-std::array<float,2>{0.934695482f, 0.0598139241f},
-std::array<float,2>{0.153155759f, 0.364721715f},
-std::array<float,2>{0.966254354f, 0.534058213f},
-std::array<float,2>{0.277730107f, 0.824285984f},
-std::array<float,2>{0.559282839f, 0.219936848f},
-std::array<float,2>{0.384768635f, 0.099199973f},
-std::array<float,2>{0.682619333f, 0.879001439f},
-std::array<float,2>{0.0594811998f, 0.684601426f},
-std::array<float,2>{0.792175889f, 0.381540567f},
-std::array<float,2>{0.179645509f, 0.155903101f},
-std::array<float,2>{0.969313741f, 0.812120259f},
-std::array<float,2>{0.300016761f, 0.593569517f},
-std::array<float,2>{0.500049114f, 0.269946277f},
-std::array<float,2>{0.423657894f, 0.456197709f},
-std::array<float,2>{0.63312012f, 0.71972549f},
-std::array<float,2>{0.0138691859f, 0.97097528f},
-std::array<float,2>{0.759007156f, 0.013610933f},
-std::array<float,2>{0.110721365f, 0.318939596f},
-std::array<float,2>{0.820689619f, 0.524269938f},
-std::array<float,2>{0.47256729f, 0.855548263f},
-std::array<float,2>{0.726403177f, 0.204386115f},
-std::array<float,2>{0.343601525f, 0.0627940521f},
-std::array<float,2>{0.60219115f, 0.920785129f},
-std::array<float,2>{0.233146429f, 0.641710043f},
-std::array<float,2>{0.885463417f, 0.428481787f},
-std::array<float,2>{0.0472719707f, 0.0435242169f},
-std::array<float,2>{0.782878637f, 0.964421213f},
-std::array<float,2>{0.381759346f, 0.709381104f},
-std::array<float,2>{0.676931798f, 0.472177684f},
-std::array<float,2>{0.267560363f, 0.30885306f},
-std::array<float,2>{0.554411888f, 0.62456435f},
-std::array<float,2>{0.143172398f, 0.779940903f},
-std::array<float,2>{0.960899889f, 0.157257289f},
-std::array<float,2>{0.218363985f, 0.39151293f},
-std::array<float,2>{0.925004244f, 0.66467905f},
-std::array<float,2>{0.368409812f, 0.894238174f},
-std::array<float,2>{0.580887437f, 0.120724529f},
-std::array<float,2>{0.450305521f, 0.235949904f},
-std::array<float,2>{0.707901835f, 0.841528177f},
-std::array<float,2>{0.0804510862f, 0.547446728f},
-std::array<float,2>{0.852392673f, 0.349712521f},
-std::array<float,2>{0.235859349f, 0.0961724594f},
-std::array<float,2>{0.901034415f, 0.878264785f},
-std::array<float,2>{0.316262484f, 0.682977498f},
-std::array<float,2>{0.611702085f, 0.378236473f},
-std::array<float,2>{0.484554768f, 0.359650701f},
-std::array<float,2>{0.741505802f, 0.537532926f},
-std::array<float,2>{0.0964280367f, 0.820945263f},
-std::array<float,2>{0.838221788f, 0.224094018f},
-std::array<float,2>{0.0213642381f, 0.490527719f},
-std::array<float,2>{0.774322689f, 0.689885974f},
-std::array<float,2>{0.413736969f, 0.950516999f},
-std::array<float,2>{0.649402678f, 0.0569255799f},
-std::array<float,2>{0.285740495f, 0.180639639f},
-std::array<float,2>{0.527131796f, 0.753796935f},
-std::array<float,2>{0.168087795f, 0.606470227f},
-std::array<float,2>{0.998366952f, 0.282701731f},
-std::array<float,2>{0.0719698742f, 0.195952564f},
-std::array<float,2>{0.860173881f, 0.866009891f},
-std::array<float,2>{0.4558492f, 0.513438284f},
-std::array<float,2>{0.696815133f, 0.340397537f},
-std::array<float,2>{0.345333457f, 0.408613533f},
-std::array<float,2>{0.571124673f, 0.630257249f},
-std::array<float,2>{0.199988261f, 0.92418921f},
-std::array<float,2>{0.915395617f, 0.0822612569f},
-std::array<float,2>{0.130124211f, 0.258549869f},
-std::array<float,2>{0.951850772f, 0.574966371f},
-std::array<float,2>{0.261722237f, 0.794437766f},
-std::array<float,2>{0.533096194f, 0.127383277f},
-std::array<float,2>{0.402120948f, 0.0188898277f},
-std::array<float,2>{0.671787858f, 0.986100078f},
-std::array<float,2>{0.0348981842f, 0.734590888f},
-std::array<float,2>{0.810056388f, 0.444117755f},
-std::array<float,2>{0.194372088f, 0.230696395f},
-std::array<float,2>{0.907586098f, 0.814780772f},
-std::array<float,2>{0.357332647f, 0.54035145f},
-std::array<float,2>{0.563262165f, 0.371088356f},
-std::array<float,2>{0.46785897f, 0.383944571f},
-std::array<float,2>{0.69388777f, 0.677001357f},
-std::array<float,2>{0.0659156963f, 0.886399209f},
-std::array<float,2>{0.872204721f, 0.106502026f},
-std::array<float,2>{0.0439510383f, 0.294954777f},
-std::array<float,2>{0.799214184f, 0.599711835f},
-std::array<float,2>{0.396045506f, 0.761835515f},
-std::array<float,2>{0.661794007f, 0.174139544f},
-std::array<float,2>{0.254509658f, 0.0479409732f},
-std::array<float,2>{0.543741524f, 0.943495274f},
-std::array<float,2>{0.135344863f, 0.700138092f},
-std::array<float,2>{0.940762699f, 0.496388167f},
-std::array<float,2>{0.105674803f, 0.0886730403f},
-std::array<float,2>{0.828799427f, 0.930193663f},
-std::array<float,2>{0.49816528f, 0.639717937f},
-std::array<float,2>{0.743523657f, 0.416900933f},
-std::array<float,2>{0.325808436f, 0.332699329f},
-std::array<float,2>{0.623755872f, 0.506676435f},
-std::array<float,2>{0.243823424f, 0.869360328f},
-std::array<float,2>{0.89638865f, 0.194337681f},
-std::array<float,2>{0.156779483f, 0.446160853f},
-std::array<float,2>{0.989772975f, 0.749665737f},
-std::array<float,2>{0.291729599f, 0.99845016f},
-std::array<float,2>{0.518021762f, 0.0303584598f},
-std::array<float,2>{0.420477033f, 0.139728531f},
-std::array<float,2>{0.640802324f, 0.788082719f},
-std::array<float,2>{0.0268534981f, 0.567627132f},
-std::array<float,2>{0.769848228f, 0.256747723f},
-std::array<float,2>{0.150882542f, 0.00340759149f},
-std::array<float,2>{0.962362647f, 0.978426456f},
-std::array<float,2>{0.275430858f, 0.73102212f},
-std::array<float,2>{0.557091713f, 0.464515209f},
-std::array<float,2>{0.390570462f, 0.279533625f},
-std::array<float,2>{0.687489986f, 0.57954067f},
-std::array<float,2>{0.0584931523f, 0.803492963f},
-std::array<float,2>{0.794195831f, 0.141097024f},
-std::array<float,2>{0.0932684392f, 0.432350636f},
-std::array<float,2>{0.846220195f, 0.650189936f},
-std::array<float,2>{0.439511716f, 0.909920633f},
-std::array<float,2>{0.712764859f, 0.072242558f},
-std::array<float,2>{0.365652412f, 0.211279243f},
-std::array<float,2>{0.587474108f, 0.846693575f},
-std::array<float,2>{0.210381389f, 0.517790377f},
-std::array<float,2>{0.93241781f, 0.327999562f},
-std::array<float,2>{0.00680982601f, 0.171720535f},
-std::array<float,2>{0.753533602f, 0.770846963f},
-std::array<float,2>{0.431985259f, 0.612158179f},
-std::array<float,2>{0.63001132f, 0.304588377f},
-std::array<float,2>{0.311186641f, 0.479527742f},
-std::array<float,2>{0.514169753f, 0.711866319f},
-std::array<float,2>{0.183992863f, 0.956103981f},
-std::array<float,2>{0.982293904f, 0.0327268094f},
-std::array<float,2>{0.224507675f, 0.354962111f},
-std::array<float,2>{0.879826248f, 0.561106622f},
-std::array<float,2>{0.330388397f, 0.832799554f},
-std::array<float,2>{0.594280601f, 0.244335204f},
-std::array<float,2>{0.481595546f, 0.116071761f},
-std::array<float,2>{0.726605594f, 0.901619494f},
-std::array<float,2>{0.121806115f, 0.66195792f},
-std::array<float,2>{0.818555117f, 0.40041399f},
-std::array<float,2>{0.22670792f, 0.177737549f},
-std::array<float,2>{0.887632489f, 0.761426747f},
-std::array<float,2>{0.335996568f, 0.595473766f},
-std::array<float,2>{0.607658923f, 0.29130882f},
-std::array<float,2>{0.47500658f, 0.494442672f},
-std::array<float,2>{0.7200014f, 0.696212292f},
-std::array<float,2>{0.113457017f, 0.938933671f},
-std::array<float,2>{0.825659752f, 0.052751556f},
-std::array<float,2>{0.00951679423f, 0.372553498f},
-std::array<float,2>{0.76473999f, 0.545071125f},
-std::array<float,2>{0.42673254f, 0.818550229f},
-std::array<float,2>{0.640604317f, 0.228469625f},
-std::array<float,2>{0.302333117f, 0.10384497f},
-std::array<float,2>{0.505599201f, 0.890371561f},
-std::array<float,2>{0.175435036f, 0.675369203f},
-std::array<float,2>{0.974970162f, 0.390010327f},
-std::array<float,2>{0.0828734338f, 0.0261057522f},
-std::array<float,2>{0.856764138f, 0.993346274f},
-std::array<float,2>{0.447562724f, 0.745534599f},
-std::array<float,2>{0.704926372f, 0.450888962f},
-std::array<float,2>{0.372727782f, 0.253716081f},
-std::array<float,2>{0.585823238f, 0.563682437f},
-std::array<float,2>{0.212418467f, 0.783907533f},
-std::array<float,2>{0.928502202f, 0.136399418f},
-std::array<float,2>{0.145516366f, 0.419089615f},
-std::array<float,2>{0.955612183f, 0.636237144f},
-std::array<float,2>{0.271198571f, 0.937366903f},
-std::array<float,2>{0.548882306f, 0.0918864086f},
-std::array<float,2>{0.378580421f, 0.189509705f},
-std::array<float,2>{0.672220826f, 0.874488056f},
-std::array<float,2>{0.0534046665f, 0.501560032f},
-std::array<float,2>{0.78785485f, 0.328809649f},
-std::array<float,2>{0.166721955f, 0.0770390183f},
-std::array<float,2>{0.993001699f, 0.910492063f},
-std::array<float,2>{0.283635288f, 0.65439415f},
-std::array<float,2>{0.5300529f, 0.433626652f},
-std::array<float,2>{0.408207148f, 0.322247922f},
-std::array<float,2>{0.652740598f, 0.52051723f},
-std::array<float,2>{0.0194635764f, 0.851257682f},
-std::array<float,2>{0.781154811f, 0.218137592f},
-std::array<float,2>{0.100807913f, 0.468015909f},
-std::array<float,2>{0.840542376f, 0.729085028f},
-std::array<float,2>{0.489785522f, 0.981455088f},
-std::array<float,2>{0.737558842f, 0.00490352046f},
-std::array<float,2>{0.318444669f, 0.146842122f},
-std::array<float,2>{0.616034031f, 0.796988726f},
-std::array<float,2>{0.241313472f, 0.584004581f},
-std::array<float,2>{0.905851722f, 0.275619417f},
-std::array<float,2>{0.0357335955f, 0.247221842f},
-std::array<float,2>{0.805473149f, 0.829893172f},
-std::array<float,2>{0.405792296f, 0.555692375f},
-std::array<float,2>{0.66734612f, 0.356230259f},
-std::array<float,2>{0.260455996f, 0.405874372f},
-std::array<float,2>{0.537214339f, 0.659709632f},
-std::array<float,2>{0.127185047f, 0.902370036f},
-std::array<float,2>{0.947176993f, 0.113067582f},
-std::array<float,2>{0.196627244f, 0.299329311f},
-std::array<float,2>{0.921357572f, 0.616774917f},
-std::array<float,2>{0.347981423f, 0.767593741f},
-std::array<float,2>{0.574792862f, 0.164063886f},
-std::array<float,2>{0.460195184f, 0.0360316597f},
-std::array<float,2>{0.700165868f, 0.95858413f},
-std::array<float,2>{0.0759352222f, 0.716534793f},
-std::array<float,2>{0.866073847f, 0.481834173f},
-std::array<float,2>{0.138673887f, 0.207555681f},
-std::array<float,2>{0.944459498f, 0.851813197f},
-std::array<float,2>{0.25129956f, 0.531165004f},
-std::array<float,2>{0.541386604f, 0.315629035f},
-std::array<float,2>{0.393868625f, 0.423786759f},
-std::array<float,2>{0.658394873f, 0.645794451f},
-std::array<float,2>{0.0422848575f, 0.915418327f},
-std::array<float,2>{0.804454386f, 0.0668795928f},
-std::array<float,2>{0.0665110201f, 0.268028677f},
-std::array<float,2>{0.870415688f, 0.589795351f},
-std::array<float,2>{0.46259287f, 0.808305383f},
-std::array<float,2>{0.688961446f, 0.151334554f},
-std::array<float,2>{0.355000287f, 0.00954003725f},
-std::array<float,2>{0.568537474f, 0.973741055f},
-std::array<float,2>{0.187849849f, 0.72628814f},
-std::array<float,2>{0.911249697f, 0.460468024f},
-std::array<float,2>{0.03035805f, 0.12212465f},
-std::array<float,2>{0.768121183f, 0.895046711f},
-std::array<float,2>{0.417659163f, 0.671403527f},
-std::array<float,2>{0.644803107f, 0.395194292f},
-std::array<float,2>{0.29436779f, 0.344663978f},
-std::array<float,2>{0.523236752f, 0.551745892f},
-std::array<float,2>{0.163474753f, 0.837769449f},
-std::array<float,2>{0.986666799f, 0.24072744f},
-std::array<float,2>{0.247765571f, 0.474022031f},
-std::array<float,2>{0.893306673f, 0.706999779f},
-std::array<float,2>{0.320427656f, 0.968360484f},
-std::array<float,2>{0.619915903f, 0.0415170677f},
-std::array<float,2>{0.495989621f, 0.161686599f},
-std::array<float,2>{0.74761951f, 0.776910663f},
-std::array<float,2>{0.104708128f, 0.620934606f},
-std::array<float,2>{0.832397699f, 0.30584386f},
-std::array<float,2>{0.206872672f, 0.0607639849f},
-std::array<float,2>{0.936938584f, 0.947719574f},
-std::array<float,2>{0.361033648f, 0.692353547f},
-std::array<float,2>{0.592667282f, 0.487165183f},
-std::array<float,2>{0.442905068f, 0.285805374f},
-std::array<float,2>{0.717136979f, 0.604702652f},
-std::array<float,2>{0.0876784325f, 0.755650103f},
-std::array<float,2>{0.851027608f, 0.186035261f},
-std::array<float,2>{0.0612699948f, 0.380488247f},
-std::array<float,2>{0.790178359f, 0.687146842f},
-std::array<float,2>{0.38355577f, 0.881758094f},
-std::array<float,2>{0.680483937f, 0.100576557f},
-std::array<float,2>{0.279513091f, 0.221263081f},
-std::array<float,2>{0.560851574f, 0.826903582f},
-std::array<float,2>{0.154946744f, 0.53225857f},
-std::array<float,2>{0.968090713f, 0.366831243f},
-std::array<float,2>{0.117287464f, 0.131662399f},
-std::array<float,2>{0.815955639f, 0.791828871f},
-std::array<float,2>{0.477013648f, 0.572008133f},
-std::array<float,2>{0.73061651f, 0.264345914f},
-std::array<float,2>{0.33271116f, 0.439845026f},
-std::array<float,2>{0.597881138f, 0.738301873f},
-std::array<float,2>{0.222654194f, 0.991282225f},
-std::array<float,2>{0.878226101f, 0.0227936786f},
-std::array<float,2>{0.179717779f, 0.338282108f},
-std::array<float,2>{0.97923398f, 0.509975076f},
-std::array<float,2>{0.308494031f, 0.859657526f},
-std::array<float,2>{0.510872543f, 0.199353755f},
-std::array<float,2>{0.433896154f, 0.0795534477f},
-std::array<float,2>{0.625346243f, 0.926853001f},
-std::array<float,2>{0.00089750468f, 0.626393259f},
-std::array<float,2>{0.756790519f, 0.412217379f},
-std::array<float,2>{0.148635417f, 0.141128734f},
-std::array<float,2>{0.964455068f, 0.803192317f},
-std::array<float,2>{0.273683876f, 0.579875886f},
-std::array<float,2>{0.555633187f, 0.280080825f},
-std::array<float,2>{0.386980236f, 0.464313865f},
-std::array<float,2>{0.683603942f, 0.730485499f},
-std::array<float,2>{0.0564169213f, 0.977609873f},
-std::array<float,2>{0.795612693f, 0.00368342432f},
-std::array<float,2>{0.0916439593f, 0.327478707f},
-std::array<float,2>{0.845416069f, 0.518444002f},
-std::array<float,2>{0.438681722f, 0.847212076f},
-std::array<float,2>{0.714174867f, 0.211534902f},
-std::array<float,2>{0.365172118f, 0.0716439188f},
-std::array<float,2>{0.589569867f, 0.909552038f},
-std::array<float,2>{0.208612874f, 0.649837434f},
-std::array<float,2>{0.930175602f, 0.432040155f},
-std::array<float,2>{0.00550411129f, 0.0323870368f},
-std::array<float,2>{0.751275897f, 0.95697844f},
-std::array<float,2>{0.43087703f, 0.710994363f},
-std::array<float,2>{0.632042527f, 0.480347037f},
-std::array<float,2>{0.308599412f, 0.30411908f},
-std::array<float,2>{0.511725664f, 0.611363769f},
-std::array<float,2>{0.185815126f, 0.771373451f},
-std::array<float,2>{0.984269202f, 0.171094149f},
-std::array<float,2>{0.22611618f, 0.401178509f},
-std::array<float,2>{0.882526219f, 0.661162913f},
-std::array<float,2>{0.328268677f, 0.901955187f},
-std::array<float,2>{0.596747339f, 0.115719907f},
-std::array<float,2>{0.482603252f, 0.244794458f},
-std::array<float,2>{0.728990197f, 0.832375228f},
-std::array<float,2>{0.124516077f, 0.560601771f},
-std::array<float,2>{0.816839457f, 0.355029136f},
-std::array<float,2>{0.191843301f, 0.107157975f},
-std::array<float,2>{0.908972859f, 0.886099994f},
-std::array<float,2>{0.358228296f, 0.67748791f},
-std::array<float,2>{0.56600076f, 0.384349674f},
-std::array<float,2>{0.465638608f, 0.370405674f},
-std::array<float,2>{0.69248271f, 0.540821433f},
-std::array<float,2>{0.0630172119f, 0.815378129f},
-std::array<float,2>{0.873962641f, 0.23133187f},
-std::array<float,2>{0.0463115796f, 0.496750176f},
-std::array<float,2>{0.798450112f, 0.699465632f},
-std::array<float,2>{0.396611363f, 0.943941116f},
-std::array<float,2>{0.663020968f, 0.0487530492f},
-std::array<float,2>{0.256486177f, 0.174799338f},
-std::array<float,2>{0.546772301f, 0.762604594f},
-std::array<float,2>{0.134763777f, 0.600142777f},
-std::array<float,2>{0.93850708f, 0.295519024f},
-std::array<float,2>{0.108563423f, 0.194902152f},
-std::array<float,2>{0.830660641f, 0.869827628f},
-std::array<float,2>{0.498012364f, 0.505863905f},
-std::array<float,2>{0.745216429f, 0.33205995f},
-std::array<float,2>{0.327249616f, 0.416096687f},
-std::array<float,2>{0.621308684f, 0.640149474f},
-std::array<float,2>{0.24434571f, 0.930167794f},
-std::array<float,2>{0.898150086f, 0.088047944f},
-std::array<float,2>{0.15894635f, 0.256181657f},
-std::array<float,2>{0.992087305f, 0.568324804f},
-std::array<float,2>{0.289387047f, 0.787292898f},
-std::array<float,2>{0.515803397f, 0.140219882f},
-std::array<float,2>{0.41868183f, 0.0309426337f},
-std::array<float,2>{0.642853677f, 0.998683989f},
-std::array<float,2>{0.0236692652f, 0.749191284f},
-std::array<float,2>{0.773333073f, 0.445471674f},
-std::array<float,2>{0.236779138f, 0.224464089f},
-std::array<float,2>{0.899763525f, 0.820471108f},
-std::array<float,2>{0.312521935f, 0.537645578f},
-std::array<float,2>{0.610563636f, 0.360037476f},
-std::array<float,2>{0.487024397f, 0.378799707f},
-std::array<float,2>{0.738529265f, 0.683373392f},
-std::array<float,2>{0.0955597311f, 0.878712416f},
-std::array<float,2>{0.836597919f, 0.0964806676f},
-std::array<float,2>{0.0222741738f, 0.28302744f},
-std::array<float,2>{0.777126372f, 0.607265174f},
-std::array<float,2>{0.411909997f, 0.753197789f},
-std::array<float,2>{0.651601374f, 0.179837853f},
-std::array<float,2>{0.288901657f, 0.0575010106f},
-std::array<float,2>{0.524598777f, 0.950757027f},
-std::array<float,2>{0.170574144f, 0.689951003f},
-std::array<float,2>{0.997232974f, 0.49118486f},
-std::array<float,2>{0.0725776628f, 0.0826080143f},
-std::array<float,2>{0.861981809f, 0.924685478f},
-std::array<float,2>{0.45424068f, 0.630440652f},
-std::array<float,2>{0.697980225f, 0.409031004f},
-std::array<float,2>{0.347134471f, 0.340124726f},
-std::array<float,2>{0.572527409f, 0.513097644f},
-std::array<float,2>{0.201249406f, 0.865352333f},
-std::array<float,2>{0.917295635f, 0.195480913f},
-std::array<float,2>{0.131195769f, 0.443452954f},
-std::array<float,2>{0.950205445f, 0.735086262f},
-std::array<float,2>{0.264467001f, 0.985621035f},
-std::array<float,2>{0.534361005f, 0.0192102659f},
-std::array<float,2>{0.399173528f, 0.127639577f},
-std::array<float,2>{0.669221699f, 0.794180334f},
-std::array<float,2>{0.031331189f, 0.574584246f},
-std::array<float,2>{0.811039031f, 0.257926583f},
-std::array<float,2>{0.176598251f, 0.0130709903f},
-std::array<float,2>{0.972130358f, 0.971650004f},
-std::array<float,2>{0.297735721f, 0.718774319f},
-std::array<float,2>{0.503713548f, 0.456573188f},
-std::array<float,2>{0.423937589f, 0.270145595f},
-std::array<float,2>{0.635415912f, 0.592929065f},
-std::array<float,2>{0.0125098303f, 0.81178683f},
-std::array<float,2>{0.760778189f, 0.155681729f},
-std::array<float,2>{0.112515531f, 0.428143829f},
-std::array<float,2>{0.822927773f, 0.642214954f},
-std::array<float,2>{0.470691651f, 0.920391917f},
-std::array<float,2>{0.723140419f, 0.0632315427f},
-std::array<float,2>{0.341430336f, 0.204837039f},
-std::array<float,2>{0.604446828f, 0.856406808f},
-std::array<float,2>{0.231431499f, 0.523561239f},
-std::array<float,2>{0.883392096f, 0.31841433f},
-std::array<float,2>{0.0490822159f, 0.158096179f},
-std::array<float,2>{0.783580482f, 0.779316545f},
-std::array<float,2>{0.380442679f, 0.624072373f},
-std::array<float,2>{0.679113507f, 0.309326947f},
-std::array<float,2>{0.26825881f, 0.471911103f},
-std::array<float,2>{0.551300049f, 0.709572792f},
-std::array<float,2>{0.142405495f, 0.96389854f},
-std::array<float,2>{0.958030701f, 0.0430618003f},
-std::array<float,2>{0.215690956f, 0.350230217f},
-std::array<float,2>{0.922156632f, 0.547268569f},
-std::array<float,2>{0.369508922f, 0.840976834f},
-std::array<float,2>{0.57831955f, 0.235721692f},
-std::array<float,2>{0.451525629f, 0.120465919f},
-std::array<float,2>{0.709085941f, 0.893817663f},
-std::array<float,2>{0.0798777416f, 0.664246559f},
-std::array<float,2>{0.854114354f, 0.390938073f},
-std::array<float,2>{0.204386815f, 0.186018109f},
-std::array<float,2>{0.93549192f, 0.755335808f},
-std::array<float,2>{0.362022847f, 0.605393112f},
-std::array<float,2>{0.59060955f, 0.285640866f},
-std::array<float,2>{0.44494766f, 0.486665159f},
-std::array<float,2>{0.716016412f, 0.691887081f},
-std::array<float,2>{0.0888016894f, 0.947983325f},
-std::array<float,2>{0.849141896f, 0.0612112731f},
-std::array<float,2>{0.0588167422f, 0.366384149f},
-std::array<float,2>{0.792950511f, 0.533134341f},
-std::array<float,2>{0.385424793f, 0.826652229f},
-std::array<float,2>{0.683480501f, 0.221015602f},
-std::array<float,2>{0.277949661f, 0.0997192636f},
-std::array<float,2>{0.559045315f, 0.880881667f},
-std::array<float,2>{0.152691633f, 0.686805904f},
-std::array<float,2>{0.966745913f, 0.380364329f},
-std::array<float,2>{0.119310662f, 0.0232966393f},
-std::array<float,2>{0.813449621f, 0.991872668f},
-std::array<float,2>{0.47960338f, 0.7392295f},
-std::array<float,2>{0.733590066f, 0.440135002f},
-std::array<float,2>{0.335166335f, 0.264030784f},
-std::array<float,2>{0.600137889f, 0.571772993f},
-std::array<float,2>{0.21924746f, 0.79114747f},
-std::array<float,2>{0.8766945f, 0.131146342f},
-std::array<float,2>{0.182899788f, 0.413064808f},
-std::array<float,2>{0.977042496f, 0.626704693f},
-std::array<float,2>{0.306222916f, 0.927608669f},
-std::array<float,2>{0.508827806f, 0.0797915012f},
-std::array<float,2>{0.437375695f, 0.199707463f},
-std::array<float,2>{0.627985418f, 0.86027205f},
-std::array<float,2>{0.00217702542f, 0.510519147f},
-std::array<float,2>{0.755047619f, 0.338573664f},
-std::array<float,2>{0.13811931f, 0.0669970065f},
-std::array<float,2>{0.943254292f, 0.915610313f},
-std::array<float,2>{0.252938628f, 0.646386564f},
-std::array<float,2>{0.540264666f, 0.422872692f},
-std::array<float,2>{0.390986472f, 0.3161228f},
-std::array<float,2>{0.65785718f, 0.530709505f},
-std::array<float,2>{0.0398576669f, 0.852495372f},
-std::array<float,2>{0.80128783f, 0.207338676f},
-std::array<float,2>{0.0701194629f, 0.460238278f},
-std::array<float,2>{0.867381215f, 0.72591573f},
-std::array<float,2>{0.464000255f, 0.974524677f},
-std::array<float,2>{0.691037059f, 0.00879849028f},
-std::array<float,2>{0.35327813f, 0.150742531f},
-std::array<float,2>{0.566754341f, 0.807708383f},
-std::array<float,2>{0.190152019f, 0.588883936f},
-std::array<float,2>{0.912840426f, 0.268285394f},
-std::array<float,2>{0.0274770856f, 0.240501508f},
-std::array<float,2>{0.766357541f, 0.837363482f},
-std::array<float,2>{0.414452881f, 0.551075161f},
-std::array<float,2>{0.647023082f, 0.343932718f},
-std::array<float,2>{0.296046436f, 0.39497155f},
-std::array<float,2>{0.521194816f, 0.670900166f},
-std::array<float,2>{0.160465077f, 0.894883931f},
-std::array<float,2>{0.984384954f, 0.122917876f},
-std::array<float,2>{0.248858795f, 0.306430668f},
-std::array<float,2>{0.891246557f, 0.620479107f},
-std::array<float,2>{0.322628111f, 0.776830137f},
-std::array<float,2>{0.618524432f, 0.161475614f},
-std::array<float,2>{0.494055867f, 0.0411509797f},
-std::array<float,2>{0.749729991f, 0.968150854f},
-std::array<float,2>{0.102978446f, 0.706519008f},
-std::array<float,2>{0.834562004f, 0.474334657f},
-std::array<float,2>{0.165392905f, 0.218640938f},
-std::array<float,2>{0.994783044f, 0.850965202f},
-std::array<float,2>{0.282901019f, 0.521047711f},
-std::array<float,2>{0.528562248f, 0.321630418f},
-std::array<float,2>{0.406640232f, 0.434315652f},
-std::array<float,2>{0.655681908f, 0.655148625f},
-std::array<float,2>{0.0162554495f, 0.910877764f},
-std::array<float,2>{0.779034257f, 0.0764591992f},
-std::array<float,2>{0.0986479521f, 0.276304334f},
-std::array<float,2>{0.841907859f, 0.584893882f},
-std::array<float,2>{0.491847128f, 0.797363758f},
-std::array<float,2>{0.736097217f, 0.147019714f},
-std::array<float,2>{0.316666812f, 0.00558321644f},
-std::array<float,2>{0.614764214f, 0.982216358f},
-std::array<float,2>{0.238988355f, 0.728735805f},
-std::array<float,2>{0.902895987f, 0.468467712f},
-std::array<float,2>{0.0377756432f, 0.112563491f},
-std::array<float,2>{0.807344854f, 0.903130591f},
-std::array<float,2>{0.402393281f, 0.659193456f},
-std::array<float,2>{0.666000009f, 0.405624032f},
-std::array<float,2>{0.258819342f, 0.355503649f},
-std::array<float,2>{0.537007153f, 0.556622505f},
-std::array<float,2>{0.126774937f, 0.829203069f},
-std::array<float,2>{0.948715687f, 0.247767389f},
-std::array<float,2>{0.198319942f, 0.482118249f},
-std::array<float,2>{0.919912994f, 0.716216922f},
-std::array<float,2>{0.349960327f, 0.958343208f},
-std::array<float,2>{0.577887535f, 0.0354420766f},
-std::array<float,2>{0.458181053f, 0.165027916f},
-std::array<float,2>{0.701483488f, 0.768537998f},
-std::array<float,2>{0.0777053759f, 0.616624534f},
-std::array<float,2>{0.863513827f, 0.29924491f},
-std::array<float,2>{0.229415745f, 0.0534061268f},
-std::array<float,2>{0.890201211f, 0.939227104f},
-std::array<float,2>{0.33897984f, 0.695361495f},
-std::array<float,2>{0.6070472f, 0.49483794f},
-std::array<float,2>{0.473774791f, 0.2915622f},
-std::array<float,2>{0.721138895f, 0.594883978f},
-std::array<float,2>{0.116083577f, 0.761205852f},
-std::array<float,2>{0.827980995f, 0.17845118f},
-std::array<float,2>{0.0109768212f, 0.390395701f},
-std::array<float,2>{0.761865973f, 0.67525506f},
-std::array<float,2>{0.429257095f, 0.889873862f},
-std::array<float,2>{0.637188852f, 0.104178913f},
-std::array<float,2>{0.303127795f, 0.22767289f},
-std::array<float,2>{0.506934345f, 0.818882048f},
-std::array<float,2>{0.17360878f, 0.545647442f},
-std::array<float,2>{0.9736377f, 0.372687906f},
-std::array<float,2>{0.0851246417f, 0.135757968f},
-std::array<float,2>{0.858420789f, 0.783629894f},
-std::array<float,2>{0.445850343f, 0.564014673f},
-std::array<float,2>{0.7061041f, 0.253414571f},
-std::array<float,2>{0.373308897f, 0.450426877f},
-std::array<float,2>{0.582604825f, 0.745997429f},
-std::array<float,2>{0.213213876f, 0.993930399f},
-std::array<float,2>{0.926476955f, 0.0256918166f},
-std::array<float,2>{0.147444755f, 0.32837972f},
-std::array<float,2>{0.953351021f, 0.501351178f},
-std::array<float,2>{0.271525145f, 0.874573112f},
-std::array<float,2>{0.548694909f, 0.189981788f},
-std::array<float,2>{0.375166684f, 0.0924936756f},
-std::array<float,2>{0.674264371f, 0.936693966f},
-std::array<float,2>{0.0511356778f, 0.636151671f},
-std::array<float,2>{0.78646946f, 0.419733524f},
-std::array<float,2>{0.18436113f, 0.168948099f},
-std::array<float,2>{0.98165679f, 0.771959841f},
-std::array<float,2>{0.3109079f, 0.61026752f},
-std::array<float,2>{0.513766646f, 0.301011592f},
-std::array<float,2>{0.432226241f, 0.477914125f},
-std::array<float,2>{0.630444169f, 0.713817835f},
-std::array<float,2>{0.00625215843f, 0.953880489f},
-std::array<float,2>{0.753162205f, 0.0341917276f},
-std::array<float,2>{0.121402703f, 0.351953506f},
-std::array<float,2>{0.819019079f, 0.559275925f},
-std::array<float,2>{0.482417941f, 0.834675968f},
-std::array<float,2>{0.727227867f, 0.243908599f},
-std::array<float,2>{0.330675095f, 0.114240155f},
-std::array<float,2>{0.594070315f, 0.898571551f},
-std::array<float,2>{0.223670438f, 0.662347317f},
-std::array<float,2>{0.879257381f, 0.39866066f},
-std::array<float,2>{0.0580493137f, 0.00172033743f},
-std::array<float,2>{0.794611871f, 0.980304658f},
-std::array<float,2>{0.389676034f, 0.733198106f},
-std::array<float,2>{0.686936438f, 0.462508261f},
-std::array<float,2>{0.276197374f, 0.277522564f},
-std::array<float,2>{0.557166696f, 0.580083549f},
-std::array<float,2>{0.150740966f, 0.801966131f},
-std::array<float,2>{0.962524951f, 0.14283374f},
-std::array<float,2>{0.210844383f, 0.43014273f},
-std::array<float,2>{0.931800365f, 0.651952446f},
-std::array<float,2>{0.36612156f, 0.906499684f},
-std::array<float,2>{0.587339938f, 0.0735610947f},
-std::array<float,2>{0.440010965f, 0.214402154f},
-std::array<float,2>{0.712183237f, 0.844810605f},
-std::array<float,2>{0.0927901119f, 0.516172945f},
-std::array<float,2>{0.845831573f, 0.324847251f},
-std::array<float,2>{0.243642002f, 0.0860104784f},
-std::array<float,2>{0.895953417f, 0.933571458f},
-std::array<float,2>{0.325449139f, 0.637697995f},
-std::array<float,2>{0.623217165f, 0.414517909f},
-std::array<float,2>{0.498755068f, 0.335673809f},
-std::array<float,2>{0.743754387f, 0.505216181f},
-std::array<float,2>{0.106236972f, 0.869130611f},
-std::array<float,2>{0.828408778f, 0.193128407f},
-std::array<float,2>{0.0272201281f, 0.448405892f},
-std::array<float,2>{0.770105243f, 0.747971296f},
-std::array<float,2>{0.420069814f, 0.996220529f},
-std::array<float,2>{0.64130336f, 0.02750469f},
-std::array<float,2>{0.29128617f, 0.137147069f},
-std::array<float,2>{0.518401146f, 0.7866925f},
-std::array<float,2>{0.15652822f, 0.568788528f},
-std::array<float,2>{0.989415765f, 0.254306704f},
-std::array<float,2>{0.066143699f, 0.232911155f},
-std::array<float,2>{0.873028338f, 0.813622952f},
-std::array<float,2>{0.468601167f, 0.541291535f},
-std::array<float,2>{0.693679273f, 0.368629068f},
-std::array<float,2>{0.356701076f, 0.386205047f},
-std::array<float,2>{0.562869608f, 0.678113341f},
-std::array<float,2>{0.194972813f, 0.884077311f},
-std::array<float,2>{0.908148587f, 0.107911155f},
-std::array<float,2>{0.135201618f, 0.294792444f},
-std::array<float,2>{0.941365659f, 0.598647714f},
-std::array<float,2>{0.253974825f, 0.765338123f},
-std::array<float,2>{0.543408215f, 0.172507808f},
-std::array<float,2>{0.395906925f, 0.0496860519f},
-std::array<float,2>{0.661315143f, 0.942846f},
-std::array<float,2>{0.0447309874f, 0.701842785f},
-std::array<float,2>{0.799717426f, 0.498718143f},
-std::array<float,2>{0.199691534f, 0.19881919f},
-std::array<float,2>{0.915987134f, 0.863316596f},
-std::array<float,2>{0.344920754f, 0.514904916f},
-std::array<float,2>{0.570552588f, 0.342791349f},
-std::array<float,2>{0.455312699f, 0.407495499f},
-std::array<float,2>{0.696484208f, 0.632668734f},
-std::array<float,2>{0.0717761219f, 0.922734141f},
-std::array<float,2>{0.859757781f, 0.0847847313f},
-std::array<float,2>{0.0342359394f, 0.2606754f},
-std::array<float,2>{0.810110211f, 0.578014433f},
-std::array<float,2>{0.401629657f, 0.795280159f},
-std::array<float,2>{0.671014488f, 0.1263569f},
-std::array<float,2>{0.262687951f, 0.0170451906f},
-std::array<float,2>{0.53261745f, 0.98694098f},
-std::array<float,2>{0.130547076f, 0.738247275f},
-std::array<float,2>{0.951600432f, 0.443061173f},
-std::array<float,2>{0.0960812494f, 0.0945838317f},
-std::array<float,2>{0.838624716f, 0.875290692f},
-std::array<float,2>{0.485064536f, 0.681282878f},
-std::array<float,2>{0.742146492f, 0.375203371f},
-std::array<float,2>{0.315862268f, 0.362616062f},
-std::array<float,2>{0.612083733f, 0.535289705f},
-std::array<float,2>{0.235679373f, 0.823925316f},
-std::array<float,2>{0.900815189f, 0.225841939f},
-std::array<float,2>{0.168641329f, 0.488867849f},
-std::array<float,2>{0.998813033f, 0.689053893f},
-std::array<float,2>{0.285406023f, 0.952165246f},
-std::array<float,2>{0.526626229f, 0.0557598509f},
-std::array<float,2>{0.413252562f, 0.183462113f},
-std::array<float,2>{0.648731828f, 0.750036597f},
-std::array<float,2>{0.0206898823f, 0.607795715f},
-std::array<float,2>{0.773615599f, 0.284656942f},
-std::array<float,2>{0.142690703f, 0.0455721691f},
-std::array<float,2>{0.960102797f, 0.962582111f},
-std::array<float,2>{0.266624123f, 0.707513332f},
-std::array<float,2>{0.554115295f, 0.470242441f},
-std::array<float,2>{0.380973369f, 0.31071502f},
-std::array<float,2>{0.677346289f, 0.621579468f},
-std::array<float,2>{0.0476570614f, 0.77865088f},
-std::array<float,2>{0.782324255f, 0.159104809f},
-std::array<float,2>{0.080663912f, 0.392891943f},
-std::array<float,2>{0.851866782f, 0.667507529f},
-std::array<float,2>{0.450910658f, 0.891093016f},
-std::array<float,2>{0.707299411f, 0.118819579f},
-std::array<float,2>{0.36895287f, 0.238220051f},
-std::array<float,2>{0.580505133f, 0.842755079f},
-std::array<float,2>{0.217983529f, 0.548934162f},
-std::array<float,2>{0.925599396f, 0.349124491f},
-std::array<float,2>{0.0143471565f, 0.15285936f},
-std::array<float,2>{0.759520829f, 0.808705986f},
-std::array<float,2>{0.422855198f, 0.591333389f},
-std::array<float,2>{0.633409262f, 0.273172408f},
-std::array<float,2>{0.30069533f, 0.454695404f},
-std::array<float,2>{0.500854254f, 0.722207487f},
-std::array<float,2>{0.17914401f, 0.970071435f},
-std::array<float,2>{0.969025671f, 0.0142196482f},
-std::array<float,2>{0.23245123f, 0.318252861f},
-std::array<float,2>{0.885068178f, 0.52586472f},
-std::array<float,2>{0.343121141f, 0.858087718f},
-std::array<float,2>{0.601903796f, 0.206343755f},
-std::array<float,2>{0.47209534f, 0.0655270666f},
-std::array<float,2>{0.72590673f, 0.919407487f},
-std::array<float,2>{0.111168861f, 0.643613696f},
-std::array<float,2>{0.820834816f, 0.427210569f},
-std::array<float,2>{0.221845001f, 0.12910825f},
-std::array<float,2>{0.878867745f, 0.789862633f},
-std::array<float,2>{0.332507879f, 0.573176801f},
-std::array<float,2>{0.598383188f, 0.26206544f},
-std::array<float,2>{0.477333784f, 0.437950373f},
-std::array<float,2>{0.731378436f, 0.74059695f},
-std::array<float,2>{0.117917046f, 0.988474667f},
-std::array<float,2>{0.815549433f, 0.0197340436f},
-std::array<float,2>{0.000121942459f, 0.33701998f},
-std::array<float,2>{0.756036639f, 0.509677649f},
-std::array<float,2>{0.434181809f, 0.862299144f},
-std::array<float,2>{0.625694931f, 0.202843457f},
-std::array<float,2>{0.307760626f, 0.081467472f},
-std::array<float,2>{0.511637032f, 0.927740872f},
-std::array<float,2>{0.18033129f, 0.628519297f},
-std::array<float,2>{0.978776276f, 0.411446244f},
-std::array<float,2>{0.0870254189f, 0.0602394044f},
-std::array<float,2>{0.851076245f, 0.946555495f},
-std::array<float,2>{0.442555457f, 0.693516135f},
-std::array<float,2>{0.717476547f, 0.485489607f},
-std::array<float,2>{0.360498846f, 0.288321346f},
-std::array<float,2>{0.592229962f, 0.601837039f},
-std::array<float,2>{0.206354514f, 0.756011605f},
-std::array<float,2>{0.937291086f, 0.185325757f},
-std::array<float,2>{0.15432255f, 0.381289363f},
-std::array<float,2>{0.968265712f, 0.685140014f},
-std::array<float,2>{0.280047476f, 0.879775882f},
-std::array<float,2>{0.561159015f, 0.0989646912f},
-std::array<float,2>{0.383025169f, 0.220439732f},
-std::array<float,2>{0.680099428f, 0.824900389f},
-std::array<float,2>{0.0605843924f, 0.533657253f},
-std::array<float,2>{0.790807366f, 0.364769399f},
-std::array<float,2>{0.164060995f, 0.124381132f},
-std::array<float,2>{0.98686415f, 0.897286594f},
-std::array<float,2>{0.294694245f, 0.669658899f},
-std::array<float,2>{0.522675991f, 0.396596253f},
-std::array<float,2>{0.417017967f, 0.346287638f},
-std::array<float,2>{0.645202696f, 0.553163707f},
-std::array<float,2>{0.0309484564f, 0.838787377f},
-std::array<float,2>{0.767706513f, 0.238447532f},
-std::array<float,2>{0.104995452f, 0.475300997f},
-std::array<float,2>{0.832787037f, 0.703135252f},
-std::array<float,2>{0.495390296f, 0.965387523f},
-std::array<float,2>{0.747404754f, 0.0392027274f},
-std::array<float,2>{0.320977777f, 0.163970619f},
-std::array<float,2>{0.619269252f, 0.775062501f},
-std::array<float,2>{0.247277156f, 0.617548943f},
-std::array<float,2>{0.892666698f, 0.307204723f},
-std::array<float,2>{0.0425301641f, 0.209600091f},
-std::array<float,2>{0.804021418f, 0.854235649f},
-std::array<float,2>{0.394151717f, 0.528259218f},
-std::array<float,2>{0.659016848f, 0.314333558f},
-std::array<float,2>{0.251704723f, 0.423990011f},
-std::array<float,2>{0.541524291f, 0.647384167f},
-std::array<float,2>{0.139310107f, 0.916837394f},
-std::array<float,2>{0.945158601f, 0.068509981f},
-std::array<float,2>{0.188469559f, 0.266493708f},
-std::array<float,2>{0.911743224f, 0.58752358f},
-std::array<float,2>{0.354896069f, 0.8052935f},
-std::array<float,2>{0.568929195f, 0.148823038f},
-std::array<float,2>{0.462301195f, 0.0109361475f},
-std::array<float,2>{0.68939513f, 0.974766791f},
-std::array<float,2>{0.0669993311f, 0.72432971f},
-std::array<float,2>{0.870917439f, 0.457247853f},
-std::array<float,2>{0.127744973f, 0.249125391f},
-std::array<float,2>{0.946521461f, 0.830119312f},
-std::array<float,2>{0.259809405f, 0.557100475f},
-std::array<float,2>{0.537619352f, 0.357591063f},
-std::array<float,2>{0.405611783f, 0.402602434f},
-std::array<float,2>{0.667815328f, 0.65737015f},
-std::array<float,2>{0.0354184881f, 0.904391289f},
-std::array<float,2>{0.805151105f, 0.109898366f},
-std::array<float,2>{0.0754866377f, 0.298678398f},
-std::array<float,2>{0.865581512f, 0.614532232f},
-std::array<float,2>{0.460878879f, 0.767149568f},
-std::array<float,2>{0.699328423f, 0.167289957f},
-std::array<float,2>{0.348184496f, 0.0372316614f},
-std::array<float,2>{0.5743258f, 0.959719121f},
-std::array<float,2>{0.196872756f, 0.717114925f},
-std::array<float,2>{0.921463251f, 0.484124899f},
-std::array<float,2>{0.0188936666f, 0.0743057653f},
-std::array<float,2>{0.780343056f, 0.912795901f},
-std::array<float,2>{0.409144044f, 0.653661788f},
-std::array<float,2>{0.652865946f, 0.436641335f},
-std::array<float,2>{0.284092724f, 0.323838979f},
-std::array<float,2>{0.529363453f, 0.522653699f},
-std::array<float,2>{0.166183829f, 0.849436343f},
-std::array<float,2>{0.992212415f, 0.216702297f},
-std::array<float,2>{0.242167577f, 0.465162665f},
-std::array<float,2>{0.905739367f, 0.727172971f},
-std::array<float,2>{0.319100261f, 0.982535243f},
-std::array<float,2>{0.615372479f, 0.00603530835f},
-std::array<float,2>{0.489683837f, 0.145386264f},
-std::array<float,2>{0.737938583f, 0.800458193f},
-std::array<float,2>{0.101185523f, 0.582527339f},
-std::array<float,2>{0.840092003f, 0.274419248f},
-std::array<float,2>{0.211993322f, 0.0244690776f},
-std::array<float,2>{0.928088725f, 0.994938731f},
-std::array<float,2>{0.372385949f, 0.743993402f},
-std::array<float,2>{0.585393846f, 0.452488273f},
-std::array<float,2>{0.447896361f, 0.251731813f},
-std::array<float,2>{0.704451382f, 0.565821469f},
-std::array<float,2>{0.0821160376f, 0.782093346f},
-std::array<float,2>{0.857226729f, 0.133877501f},
-std::array<float,2>{0.0529706664f, 0.420341313f},
-std::array<float,2>{0.787437439f, 0.634707153f},
-std::array<float,2>{0.378097534f, 0.93491894f},
-std::array<float,2>{0.672671854f, 0.0916387886f},
-std::array<float,2>{0.270530969f, 0.188135758f},
-std::array<float,2>{0.549601614f, 0.872779131f},
-std::array<float,2>{0.146257803f, 0.503682673f},
-std::array<float,2>{0.955132961f, 0.330646127f},
-std::array<float,2>{0.114012398f, 0.176243052f},
-std::array<float,2>{0.826025903f, 0.758608818f},
-std::array<float,2>{0.475239128f, 0.596729517f},
-std::array<float,2>{0.720677674f, 0.290800303f},
-std::array<float,2>{0.336657882f, 0.493527085f},
-std::array<float,2>{0.608324826f, 0.698762178f},
-std::array<float,2>{0.2274656f, 0.940805793f},
-std::array<float,2>{0.886902392f, 0.0513588116f},
-std::array<float,2>{0.174872279f, 0.374595612f},
-std::array<float,2>{0.975464463f, 0.54304862f},
-std::array<float,2>{0.302037209f, 0.817020655f},
-std::array<float,2>{0.505025446f, 0.230345458f},
-std::array<float,2>{0.426146895f, 0.102706827f},
-std::array<float,2>{0.639735103f, 0.88706255f},
-std::array<float,2>{0.00903551001f, 0.672466159f},
-std::array<float,2>{0.765218079f, 0.387691498f},
-std::array<float,2>{0.133512005f, 0.173052847f},
-std::array<float,2>{0.937826753f, 0.764344096f},
-std::array<float,2>{0.257202715f, 0.59860909f},
-std::array<float,2>{0.545470119f, 0.292973876f},
-std::array<float,2>{0.398027599f, 0.499381065f},
-std::array<float,2>{0.663116097f, 0.702323139f},
-std::array<float,2>{0.0452521518f, 0.941612482f},
-std::array<float,2>{0.797634244f, 0.0505597107f},
-std::array<float,2>{0.0642992556f, 0.367777467f},
-std::array<float,2>{0.874411166f, 0.542431355f},
-std::array<float,2>{0.466058165f, 0.812961459f},
-std::array<float,2>{0.691624463f, 0.234100297f},
-std::array<float,2>{0.358434647f, 0.108443655f},
-std::array<float,2>{0.564693093f, 0.882860959f},
-std::array<float,2>{0.192897335f, 0.679368198f},
-std::array<float,2>{0.909341633f, 0.385507852f},
-std::array<float,2>{0.0248848777f, 0.028483199f},
-std::array<float,2>{0.77222997f, 0.997562349f},
-std::array<float,2>{0.419428021f, 0.746622026f},
-std::array<float,2>{0.64375329f, 0.448066413f},
-std::array<float,2>{0.290524006f, 0.255620778f},
-std::array<float,2>{0.516602993f, 0.569774866f},
-std::array<float,2>{0.159407556f, 0.785366893f},
-std::array<float,2>{0.991072357f, 0.138458967f},
-std::array<float,2>{0.245532274f, 0.415890068f},
-std::array<float,2>{0.897179544f, 0.63715142f},
-std::array<float,2>{0.327084512f, 0.932266057f},
-std::array<float,2>{0.622318208f, 0.0878622085f},
-std::array<float,2>{0.496808112f, 0.191805571f},
-std::array<float,2>{0.744859815f, 0.867686212f},
-std::array<float,2>{0.107452624f, 0.504579663f},
-std::array<float,2>{0.831834972f, 0.334463686f},
-std::array<float,2>{0.20798783f, 0.07259994f},
-std::array<float,2>{0.931201279f, 0.907339871f},
-std::array<float,2>{0.363599002f, 0.650976598f},
-std::array<float,2>{0.588487208f, 0.431425482f},
-std::array<float,2>{0.437809199f, 0.325892985f},
-std::array<float,2>{0.713479161f, 0.517084777f},
-std::array<float,2>{0.0908026546f, 0.844654977f},
-std::array<float,2>{0.844649494f, 0.213393673f},
-std::array<float,2>{0.0546902716f, 0.461264372f},
-std::array<float,2>{0.796093166f, 0.734223008f},
-std::array<float,2>{0.387852788f, 0.979190707f},
-std::array<float,2>{0.684938669f, 0.000698317599f},
-std::array<float,2>{0.274877846f, 0.144197762f},
-std::array<float,2>{0.55632031f, 0.801136315f},
-std::array<float,2>{0.149897516f, 0.581319273f},
-std::array<float,2>{0.963002563f, 0.278717339f},
-std::array<float,2>{0.123545073f, 0.242731154f},
-std::array<float,2>{0.817571521f, 0.835136533f},
-std::array<float,2>{0.484158248f, 0.559744835f},
-std::array<float,2>{0.730354607f, 0.352801025f},
-std::array<float,2>{0.329406112f, 0.399586976f},
-std::array<float,2>{0.5966326f, 0.663118958f},
-std::array<float,2>{0.2254522f, 0.900046349f},
-std::array<float,2>{0.88151741f, 0.115182929f},
-std::array<float,2>{0.186963126f, 0.301822871f},
-std::array<float,2>{0.983211219f, 0.610464573f},
-std::array<float,2>{0.310477972f, 0.773382902f},
-std::array<float,2>{0.513207078f, 0.168740451f},
-std::array<float,2>{0.43007654f, 0.0333811454f},
-std::array<float,2>{0.631428957f, 0.954660892f},
-std::array<float,2>{0.00425557001f, 0.714541793f},
-std::array<float,2>{0.750669897f, 0.477425694f},
-std::array<float,2>{0.23189196f, 0.205662191f},
-std::array<float,2>{0.88407743f, 0.859001815f},
-std::array<float,2>{0.340288103f, 0.526874363f},
-std::array<float,2>{0.605394602f, 0.317193151f},
-std::array<float,2>{0.469568402f, 0.426699489f},
-std::array<float,2>{0.72401005f, 0.643145263f},
-std::array<float,2>{0.111991033f, 0.918026268f},
-std::array<float,2>{0.824149132f, 0.0644824803f},
-std::array<float,2>{0.012748044f, 0.272408545f},
-std::array<float,2>{0.760443091f, 0.589914024f},
-std::array<float,2>{0.425673932f, 0.810426116f},
-std::array<float,2>{0.63625592f, 0.153393641f},
-std::array<float,2>{0.298004478f, 0.0147031471f},
-std::array<float,2>{0.502449036f, 0.969256997f},
-std::array<float,2>{0.176834852f, 0.721355975f},
-std::array<float,2>{0.971149027f, 0.453872532f},
-std::array<float,2>{0.078685239f, 0.117847249f},
-std::array<float,2>{0.855113745f, 0.891950905f},
-std::array<float,2>{0.452856719f, 0.666821659f},
-std::array<float,2>{0.710558951f, 0.394149482f},
-std::array<float,2>{0.37084645f, 0.34850058f},
-std::array<float,2>{0.579325914f, 0.550767064f},
-std::array<float,2>{0.216643482f, 0.843417883f},
-std::array<float,2>{0.92308861f, 0.236796871f},
-std::array<float,2>{0.140848696f, 0.468987763f},
-std::array<float,2>{0.957037926f, 0.708329499f},
-std::array<float,2>{0.269038975f, 0.961235404f},
-std::array<float,2>{0.552296042f, 0.0465759411f},
-std::array<float,2>{0.379812866f, 0.159679666f},
-std::array<float,2>{0.677900374f, 0.777862549f},
-std::array<float,2>{0.0498474985f, 0.62242049f},
-std::array<float,2>{0.784605443f, 0.312087774f},
-std::array<float,2>{0.171507567f, 0.0550768487f},
-std::array<float,2>{0.996846497f, 0.952008903f},
-std::array<float,2>{0.287302881f, 0.688333333f},
-std::array<float,2>{0.523447812f, 0.489750475f},
-std::array<float,2>{0.41038844f, 0.283661515f},
-std::array<float,2>{0.651100695f, 0.609151304f},
-std::array<float,2>{0.0233214777f, 0.751167595f},
-std::array<float,2>{0.775826275f, 0.18183209f},
-std::array<float,2>{0.0939051956f, 0.376690477f},
-std::array<float,2>{0.837834358f, 0.679998219f},
-std::array<float,2>{0.487426013f, 0.876448512f},
-std::array<float,2>{0.739643693f, 0.0952188671f},
-std::array<float,2>{0.314344496f, 0.224640518f},
-std::array<float,2>{0.610204697f, 0.822367311f},
-std::array<float,2>{0.237610295f, 0.536370337f},
-std::array<float,2>{0.898949683f, 0.361684591f},
-std::array<float,2>{0.0326933861f, 0.125512213f},
-std::array<float,2>{0.812029421f, 0.795930266f},
-std::array<float,2>{0.399473071f, 0.576429546f},
-std::array<float,2>{0.668153107f, 0.261358619f},
-std::array<float,2>{0.264995366f, 0.441419691f},
-std::array<float,2>{0.533840597f, 0.73712939f},
-std::array<float,2>{0.132422492f, 0.988139391f},
-std::array<float,2>{0.949974537f, 0.016007565f},
-std::array<float,2>{0.202504933f, 0.34269309f},
-std::array<float,2>{0.916947603f, 0.513840139f},
-std::array<float,2>{0.345858663f, 0.864774704f},
-std::array<float,2>{0.574157715f, 0.198155135f},
-std::array<float,2>{0.453943938f, 0.0854317918f},
-std::array<float,2>{0.698839784f, 0.922903657f},
-std::array<float,2>{0.0735866725f, 0.631650031f},
-std::array<float,2>{0.86241287f, 0.407085687f},
-std::array<float,2>{0.190960273f, 0.149716899f},
-std::array<float,2>{0.9132846f, 0.806468368f},
-std::array<float,2>{0.352104038f, 0.586904645f},
-std::array<float,2>{0.567473233f, 0.26673764f},
-std::array<float,2>{0.463298321f, 0.458797872f},
-std::array<float,2>{0.690383136f, 0.723197103f},
-std::array<float,2>{0.0691724792f, 0.976460516f},
-std::array<float,2>{0.868509889f, 0.0101640029f},
-std::array<float,2>{0.0405083559f, 0.3132824f},
-std::array<float,2>{0.802016497f, 0.529012561f},
-std::array<float,2>{0.391734093f, 0.854505181f},
-std::array<float,2>{0.656565785f, 0.210754916f},
-std::array<float,2>{0.252661765f, 0.069795981f},
-std::array<float,2>{0.539498091f, 0.91750288f},
-std::array<float,2>{0.136998415f, 0.648223221f},
-std::array<float,2>{0.941665649f, 0.424965441f},
-std::array<float,2>{0.102329984f, 0.0408958532f},
-std::array<float,2>{0.835879445f, 0.966277957f},
-std::array<float,2>{0.492701828f, 0.705035865f},
-std::array<float,2>{0.748069882f, 0.47622624f},
-std::array<float,2>{0.323756188f, 0.308271557f},
-std::array<float,2>{0.617946208f, 0.618175685f},
-std::array<float,2>{0.249035671f, 0.773973405f},
-std::array<float,2>{0.891779482f, 0.16216132f},
-std::array<float,2>{0.161383152f, 0.398246795f},
-std::array<float,2>{0.985678434f, 0.668579519f},
-std::array<float,2>{0.295829296f, 0.898277521f},
-std::array<float,2>{0.519669056f, 0.123392068f},
-std::array<float,2>{0.415288389f, 0.239606977f},
-std::array<float,2>{0.647956192f, 0.839317679f},
-std::array<float,2>{0.0283611901f, 0.554307699f},
-std::array<float,2>{0.767576218f, 0.34732464f},
-std::array<float,2>{0.153591007f, 0.098066926f},
-std::array<float,2>{0.965361714f, 0.880847096f},
-std::array<float,2>{0.278504997f, 0.684114158f},
-std::array<float,2>{0.559723556f, 0.382412195f},
-std::array<float,2>{0.3861835f, 0.363693833f},
-std::array<float,2>{0.682256222f, 0.535134435f},
-std::array<float,2>{0.0597105362f, 0.825777829f},
-std::array<float,2>{0.791589499f, 0.219671845f},
-std::array<float,2>{0.0888815373f, 0.484541029f},
-std::array<float,2>{0.848078012f, 0.694642484f},
-std::array<float,2>{0.4442662f, 0.945746422f},
-std::array<float,2>{0.715452671f, 0.0589123219f},
-std::array<float,2>{0.36271733f, 0.183699042f},
-std::array<float,2>{0.591763496f, 0.757713616f},
-std::array<float,2>{0.203973442f, 0.603051543f},
-std::array<float,2>{0.933696389f, 0.287619144f},
-std::array<float,2>{0.00314772944f, 0.201644614f},
-std::array<float,2>{0.754007816f, 0.862977982f},
-std::array<float,2>{0.436255604f, 0.508346796f},
-std::array<float,2>{0.627092302f, 0.335963219f},
-std::array<float,2>{0.305051982f, 0.410549641f},
-std::array<float,2>{0.507901251f, 0.627910614f},
-std::array<float,2>{0.18245852f, 0.929433286f},
-std::array<float,2>{0.97839874f, 0.0804152563f},
-std::array<float,2>{0.219808146f, 0.263160616f},
-std::array<float,2>{0.875653863f, 0.574147403f},
-std::array<float,2>{0.334670573f, 0.790181637f},
-std::array<float,2>{0.600726366f, 0.130059525f},
-std::array<float,2>{0.479197323f, 0.0208867714f},
-std::array<float,2>{0.732458711f, 0.989297092f},
-std::array<float,2>{0.120836206f, 0.741764903f},
-std::array<float,2>{0.813693345f, 0.439147532f},
-std::array<float,2>{0.172001556f, 0.228977814f},
-std::array<float,2>{0.972847521f, 0.817570925f},
-std::array<float,2>{0.304647267f, 0.544724703f},
-std::array<float,2>{0.506742656f, 0.37306428f},
-std::array<float,2>{0.428040087f, 0.388428837f},
-std::array<float,2>{0.638441384f, 0.673762202f},
-std::array<float,2>{0.0100203771f, 0.887857676f},
-std::array<float,2>{0.763543189f, 0.102285244f},
-std::array<float,2>{0.116626292f, 0.289990515f},
-std::array<float,2>{0.826250374f, 0.596057177f},
-std::array<float,2>{0.473066956f, 0.758988559f},
-std::array<float,2>{0.722062886f, 0.176813677f},
-std::array<float,2>{0.338090718f, 0.0523779429f},
-std::array<float,2>{0.605886221f, 0.94035542f},
-std::array<float,2>{0.230352953f, 0.697808087f},
-std::array<float,2>{0.889058053f, 0.492286235f},
-std::array<float,2>{0.05209947f, 0.0900291428f},
-std::array<float,2>{0.785295188f, 0.93380183f},
-std::array<float,2>{0.376088053f, 0.633244872f},
-std::array<float,2>{0.675521195f, 0.420967489f},
-std::array<float,2>{0.27294299f, 0.331958681f},
-std::array<float,2>{0.54780972f, 0.502542794f},
-std::array<float,2>{0.147845387f, 0.871684253f},
-std::array<float,2>{0.954372704f, 0.188550711f},
-std::array<float,2>{0.213879257f, 0.451764494f},
-std::array<float,2>{0.927329302f, 0.742714286f},
-std::array<float,2>{0.374637663f, 0.99530977f},
-std::array<float,2>{0.583758771f, 0.0243918188f},
-std::array<float,2>{0.44639796f, 0.133384794f},
-std::array<float,2>{0.705193162f, 0.782968998f},
-std::array<float,2>{0.0849304274f, 0.565370739f},
-std::array<float,2>{0.858011603f, 0.250877172f},
-std::array<float,2>{0.23949486f, 0.00741638802f},
-std::array<float,2>{0.903704822f, 0.983635008f},
-std::array<float,2>{0.318315387f, 0.727689862f},
-std::array<float,2>{0.61334163f, 0.466654152f},
-std::array<float,2>{0.490266412f, 0.274209529f},
-std::array<float,2>{0.735221446f, 0.583343387f},
-std::array<float,2>{0.0978513211f, 0.799043477f},
-std::array<float,2>{0.843659043f, 0.145869955f},
-std::array<float,2>{0.0167138427f, 0.435728848f},
-std::array<float,2>{0.777884424f, 0.653095245f},
-std::array<float,2>{0.407500207f, 0.91367656f},
-std::array<float,2>{0.65430522f, 0.0752210468f},
-std::array<float,2>{0.281359702f, 0.21508652f},
-std::array<float,2>{0.527946115f, 0.847662449f},
-std::array<float,2>{0.164978743f, 0.521868408f},
-std::array<float,2>{0.995385408f, 0.323151141f},
-std::array<float,2>{0.0769494697f, 0.166517064f},
-std::array<float,2>{0.864673316f, 0.765961409f},
-std::array<float,2>{0.457090974f, 0.613327086f},
-std::array<float,2>{0.702922583f, 0.297698617f},
-std::array<float,2>{0.35076499f, 0.482766241f},
-std::array<float,2>{0.576231003f, 0.718330801f},
-std::array<float,2>{0.197736919f, 0.960307002f},
-std::array<float,2>{0.918046296f, 0.0388627984f},
-std::array<float,2>{0.125147879f, 0.359244585f},
-std::array<float,2>{0.947767615f, 0.557670951f},
-std::array<float,2>{0.258254379f, 0.831408262f},
-std::array<float,2>{0.535818517f, 0.249004036f},
-std::array<float,2>{0.403864324f, 0.110382371f},
-std::array<float,2>{0.664656997f, 0.905568182f},
-std::array<float,2>{0.0381132886f, 0.656293452f},
-std::array<float,2>{0.807740033f, 0.403779119f},
-std::array<float,2>{0.157313943f, 0.138761625f},
-std::array<float,2>{0.988923311f, 0.788302302f},
-std::array<float,2>{0.292773306f, 0.56706214f},
-std::array<float,2>{0.519430757f, 0.257572234f},
-std::array<float,2>{0.421632081f, 0.446900994f},
-std::array<float,2>{0.641798675f, 0.748812735f},
-std::array<float,2>{0.0257003997f, 0.999827564f},
-std::array<float,2>{0.770787895f, 0.0297675245f},
-std::array<float,2>{0.106775582f, 0.333203435f},
-std::array<float,2>{0.829721868f, 0.507147074f},
-std::array<float,2>{0.499670833f, 0.870538652f},
-std::array<float,2>{0.743050814f, 0.19419919f},
-std::array<float,2>{0.325119704f, 0.0898170918f},
-std::array<float,2>{0.624520123f, 0.931532562f},
-std::array<float,2>{0.242567852f, 0.638919234f},
-std::array<float,2>{0.895102501f, 0.417453468f},
-std::array<float,2>{0.0435992442f, 0.0472087152f},
-std::array<float,2>{0.800273418f, 0.944511414f},
-std::array<float,2>{0.394702405f, 0.700700641f},
-std::array<float,2>{0.660874903f, 0.497120589f},
-std::array<float,2>{0.255461812f, 0.296434134f},
-std::array<float,2>{0.54463774f, 0.601415336f},
-std::array<float,2>{0.136635542f, 0.762828052f},
-std::array<float,2>{0.939742088f, 0.175628483f},
-std::array<float,2>{0.193438336f, 0.383231938f},
-std::array<float,2>{0.907029808f, 0.676515043f},
-std::array<float,2>{0.355890721f, 0.8855775f},
-std::array<float,2>{0.56442219f, 0.106096409f},
-std::array<float,2>{0.467282295f, 0.232215941f},
-std::array<float,2>{0.694848359f, 0.816292763f},
-std::array<float,2>{0.0650263876f, 0.539678574f},
-std::array<float,2>{0.871383488f, 0.370045006f},
-std::array<float,2>{0.222946256f, 0.117029674f},
-std::array<float,2>{0.880702734f, 0.90066725f},
-std::array<float,2>{0.331358552f, 0.660837233f},
-std::array<float,2>{0.595462263f, 0.402061313f},
-std::array<float,2>{0.480902672f, 0.354016572f},
-std::array<float,2>{0.727706432f, 0.562127411f},
-std::array<float,2>{0.122950576f, 0.833564579f},
-std::array<float,2>{0.820037246f, 0.245418906f},
-std::array<float,2>{0.00766598433f, 0.478677601f},
-std::array<float,2>{0.752236664f, 0.71281004f},
-std::array<float,2>{0.432690442f, 0.955801964f},
-std::array<float,2>{0.629162371f, 0.0315291435f},
-std::array<float,2>{0.312203526f, 0.170643464f},
-std::array<float,2>{0.515102565f, 0.770399451f},
-std::array<float,2>{0.185278907f, 0.612973511f},
-std::array<float,2>{0.980920494f, 0.303027213f},
-std::array<float,2>{0.0926429108f, 0.212466568f},
-std::array<float,2>{0.847029328f, 0.846471786f},
-std::array<float,2>{0.440955788f, 0.519221485f},
-std::array<float,2>{0.710940421f, 0.326738387f},
-std::array<float,2>{0.366328567f, 0.433587998f},
-std::array<float,2>{0.586853564f, 0.648817241f},
-std::array<float,2>{0.209657669f, 0.908379257f},
-std::array<float,2>{0.932641447f, 0.0705541745f},
-std::array<float,2>{0.152011693f, 0.281137496f},
-std::array<float,2>{0.960997105f, 0.578859329f},
-std::array<float,2>{0.27657038f, 0.804439962f},
-std::array<float,2>{0.558452427f, 0.142507017f},
-std::array<float,2>{0.389101684f, 0.00222894782f},
-std::array<float,2>{0.686267853f, 0.976576328f},
-std::array<float,2>{0.0569126122f, 0.731926441f},
-std::array<float,2>{0.793786228f, 0.463154465f},
-std::array<float,2>{0.217412576f, 0.234464958f},
-std::array<float,2>{0.924768329f, 0.840038836f},
-std::array<float,2>{0.367485464f, 0.548611581f},
-std::array<float,2>{0.58183372f, 0.350892276f},
-std::array<float,2>{0.450065911f, 0.391947627f},
-std::array<float,2>{0.708324134f, 0.665896475f},
-std::array<float,2>{0.0811439455f, 0.893548429f},
-std::array<float,2>{0.853068531f, 0.119838953f},
-std::array<float,2>{0.0478768945f, 0.310064256f},
-std::array<float,2>{0.782190204f, 0.623205066f},
-std::array<float,2>{0.381853163f, 0.780448139f},
-std::array<float,2>{0.676155925f, 0.157007828f},
-std::array<float,2>{0.266237497f, 0.0442416444f},
-std::array<float,2>{0.552969456f, 0.963209212f},
-std::array<float,2>{0.144430295f, 0.710428238f},
-std::array<float,2>{0.959317029f, 0.471519738f},
-std::array<float,2>{0.110331915f, 0.0643445477f},
-std::array<float,2>{0.822238624f, 0.9210971f},
-std::array<float,2>{0.471159428f, 0.641276658f},
-std::array<float,2>{0.725068927f, 0.428959101f},
-std::array<float,2>{0.341990262f, 0.319365025f},
-std::array<float,2>{0.603242218f, 0.525097072f},
-std::array<float,2>{0.233757168f, 0.857421279f},
-std::array<float,2>{0.886696696f, 0.203769997f},
-std::array<float,2>{0.178694591f, 0.45600009f},
-std::array<float,2>{0.97023499f, 0.720477283f},
-std::array<float,2>{0.299052089f, 0.972278893f},
-std::array<float,2>{0.501012146f, 0.0121970605f},
-std::array<float,2>{0.422389507f, 0.15502575f},
-std::array<float,2>{0.634704232f, 0.810812235f},
-std::array<float,2>{0.0153848873f, 0.592510164f},
-std::array<float,2>{0.758584738f, 0.271462291f},
-std::array<float,2>{0.129453316f, 0.0177478716f},
-std::array<float,2>{0.952621102f, 0.984780848f},
-std::array<float,2>{0.263408959f, 0.735539317f},
-std::array<float,2>{0.531379163f, 0.444894284f},
-std::array<float,2>{0.401172191f, 0.259300411f},
-std::array<float,2>{0.670179844f, 0.575575531f},
-std::array<float,2>{0.033393193f, 0.793427825f},
-std::array<float,2>{0.809113204f, 0.128769755f},
-std::array<float,2>{0.0707094744f, 0.410028726f},
-std::array<float,2>{0.861092329f, 0.629662156f},
-std::array<float,2>{0.456156194f, 0.924849868f},
-std::array<float,2>{0.695527911f, 0.0835838243f},
-std::array<float,2>{0.344122589f, 0.196962804f},
-std::array<float,2>{0.572231233f, 0.867116332f},
-std::array<float,2>{0.201085225f, 0.512003064f},
-std::array<float,2>{0.914965332f, 0.340934873f},
-std::array<float,2>{0.020195283f, 0.181518316f},
-std::array<float,2>{0.775048852f, 0.75201261f},
-std::array<float,2>{0.41230303f, 0.606326163f},
-std::array<float,2>{0.649446547f, 0.281571865f},
-std::array<float,2>{0.286788642f, 0.491696119f},
-std::array<float,2>{0.526228011f, 0.691199422f},
-std::array<float,2>{0.169587031f, 0.950022399f},
-std::array<float,2>{0.999206722f, 0.0582039952f},
-std::array<float,2>{0.234712899f, 0.361242175f},
-std::array<float,2>{0.901900053f, 0.538530231f},
-std::array<float,2>{0.314555734f, 0.822224855f},
-std::array<float,2>{0.613144279f, 0.223358676f},
-std::array<float,2>{0.486078739f, 0.0975820795f},
-std::array<float,2>{0.740354002f, 0.877782404f},
-std::array<float,2>{0.0970458388f, 0.681895256f},
-std::array<float,2>{0.839601219f, 0.377616972f},
-std::array<float,2>{0.246204719f, 0.1606929f},
-std::array<float,2>{0.893823028f, 0.776358724f},
-std::array<float,2>{0.322040945f, 0.619461238f},
-std::array<float,2>{0.620333314f, 0.305261075f},
-std::array<float,2>{0.494554013f, 0.473177433f},
-std::array<float,2>{0.746839762f, 0.705574811f},
-std::array<float,2>{0.103929587f, 0.967283487f},
-std::array<float,2>{0.833478391f, 0.0425537638f},
-std::array<float,2>{0.0297617335f, 0.345290244f},
-std::array<float,2>{0.768770695f, 0.552033722f},
-std::array<float,2>{0.416152179f, 0.836341083f},
-std::array<float,2>{0.645609438f, 0.24161984f},
-std::array<float,2>{0.293666035f, 0.121324211f},
-std::array<float,2>{0.521964669f, 0.895620942f},
-std::array<float,2>{0.163082421f, 0.670126081f},
-std::array<float,2>{0.987881362f, 0.396372885f},
-std::array<float,2>{0.0680897012f, 0.00847479515f},
-std::array<float,2>{0.869757771f, 0.973339319f},
-std::array<float,2>{0.461185157f, 0.724952996f},
-std::array<float,2>{0.687677562f, 0.459114999f},
-std::array<float,2>{0.354379475f, 0.268563509f},
-std::array<float,2>{0.56985569f, 0.588438272f},
-std::array<float,2>{0.188749894f, 0.806840956f},
-std::array<float,2>{0.910232961f, 0.151926741f},
-std::array<float,2>{0.139799818f, 0.422390431f},
-std::array<float,2>{0.944266081f, 0.644938827f},
-std::array<float,2>{0.25075075f, 0.914691091f},
-std::array<float,2>{0.542771518f, 0.0681174174f},
-std::array<float,2>{0.392939299f, 0.208500117f},
-std::array<float,2>{0.659493804f, 0.852823794f},
-std::array<float,2>{0.0414963774f, 0.529306054f},
-std::array<float,2>{0.802966118f, 0.314793915f},
-std::array<float,2>{0.180833653f, 0.0788801685f},
-std::array<float,2>{0.979971409f, 0.926413476f},
-std::array<float,2>{0.306708455f, 0.625199497f},
-std::array<float,2>{0.510341763f, 0.41392225f},
-std::array<float,2>{0.435470074f, 0.339801192f},
-std::array<float,2>{0.626882613f, 0.510962605f},
-std::array<float,2>{0.00106710487f, 0.860674918f},
-std::array<float,2>{0.757059515f, 0.200761154f},
-std::array<float,2>{0.119080111f, 0.441332847f},
-std::array<float,2>{0.814504564f, 0.739706814f},
-std::array<float,2>{0.477700174f, 0.990399957f},
-std::array<float,2>{0.731617689f, 0.0221620481f},
-std::array<float,2>{0.333295375f, 0.132490903f},
-std::array<float,2>{0.598970771f, 0.792587101f},
-std::array<float,2>{0.221666485f, 0.570456326f},
-std::array<float,2>{0.877634823f, 0.265064716f},
-std::array<float,2>{0.0616928339f, 0.222307503f},
-std::array<float,2>{0.789582014f, 0.827800274f},
-std::array<float,2>{0.384683967f, 0.531818211f},
-std::array<float,2>{0.680939794f, 0.366111666f},
-std::array<float,2>{0.28087166f, 0.379845649f},
-std::array<float,2>{0.56185621f, 0.686075985f},
-std::array<float,2>{0.156051815f, 0.882023811f},
-std::array<float,2>{0.967246652f, 0.101069443f},
-std::array<float,2>{0.206036523f, 0.286337942f},
-std::array<float,2>{0.936482787f, 0.604247332f},
-std::array<float,2>{0.359628946f, 0.754391193f},
-std::array<float,2>{0.593627989f, 0.187291399f},
-std::array<float,2>{0.44200173f, 0.0619473793f},
-std::array<float,2>{0.718144476f, 0.948285639f},
-std::array<float,2>{0.0863209739f, 0.693134606f},
-std::array<float,2>{0.850389123f, 0.487952858f},
-std::array<float,2>{0.145213455f, 0.190760374f},
-std::array<float,2>{0.956494391f, 0.873558164f},
-std::array<float,2>{0.269681245f, 0.500795841f},
-std::array<float,2>{0.550780654f, 0.329390317f},
-std::array<float,2>{0.377030402f, 0.418634623f},
-std::array<float,2>{0.673178434f, 0.635169864f},
-std::array<float,2>{0.0540724881f, 0.935568571f},
-std::array<float,2>{0.788424492f, 0.0932558775f},
-std::array<float,2>{0.083923094f, 0.2524288f},
-std::array<float,2>{0.856091678f, 0.562542439f},
-std::array<float,2>{0.448270321f, 0.784876525f},
-std::array<float,2>{0.703827858f, 0.134976953f},
-std::array<float,2>{0.371440142f, 0.0267657209f},
-std::array<float,2>{0.584947765f, 0.992677987f},
-std::array<float,2>{0.211040959f, 0.744238138f},
-std::array<float,2>{0.929390669f, 0.449445844f},
-std::array<float,2>{0.00788705051f, 0.104887068f},
-std::array<float,2>{0.763685524f, 0.888867497f},
-std::array<float,2>{0.426771313f, 0.674019754f},
-std::array<float,2>{0.639372587f, 0.389533013f},
-std::array<float,2>{0.301405609f, 0.371640712f},
-std::array<float,2>{0.504562676f, 0.546851873f},
-std::array<float,2>{0.174589902f, 0.819951892f},
-std::array<float,2>{0.975745738f, 0.22675243f},
-std::array<float,2>{0.227928102f, 0.495708197f},
-std::array<float,2>{0.887702525f, 0.69705838f},
-std::array<float,2>{0.337503463f, 0.938103318f},
-std::array<float,2>{0.608616352f, 0.0537465699f},
-std::array<float,2>{0.475724399f, 0.179111645f},
-std::array<float,2>{0.718937933f, 0.760700822f},
-std::array<float,2>{0.115204342f, 0.593905151f},
-std::array<float,2>{0.825158834f, 0.292145252f},
-std::array<float,2>{0.19543539f, 0.0362103954f},
-std::array<float,2>{0.920515299f, 0.957443774f},
-std::array<float,2>{0.348779768f, 0.715799809f},
-std::array<float,2>{0.575624406f, 0.480771095f},
-std::array<float,2>{0.459488481f, 0.300706506f},
-std::array<float,2>{0.700355232f, 0.615272284f},
-std::array<float,2>{0.0747944042f, 0.76896739f},
-std::array<float,2>{0.867113531f, 0.165278077f},
-std::array<float,2>{0.0363705754f, 0.404866874f},
-std::array<float,2>{0.806191087f, 0.658209324f},
-std::array<float,2>{0.40434894f, 0.903743505f},
-std::array<float,2>{0.666634917f, 0.111424945f},
-std::array<float,2>{0.26148513f, 0.246665388f},
-std::array<float,2>{0.538540602f, 0.82870245f},
-std::array<float,2>{0.128419533f, 0.555252612f},
-std::array<float,2>{0.945711911f, 0.356953532f},
-std::array<float,2>{0.0998673588f, 0.14808546f},
-std::array<float,2>{0.841792464f, 0.798293412f},
-std::array<float,2>{0.488307863f, 0.585675538f},
-std::array<float,2>{0.736579955f, 0.276514679f},
-std::array<float,2>{0.319546491f, 0.467352659f},
-std::array<float,2>{0.616462529f, 0.729885876f},
-std::array<float,2>{0.24024038f, 0.980998755f},
-std::array<float,2>{0.904943824f, 0.00394109124f},
-std::array<float,2>{0.167457297f, 0.320471019f},
-std::array<float,2>{0.993174374f, 0.52021569f},
-std::array<float,2>{0.284405053f, 0.849666417f},
-std::array<float,2>{0.530443132f, 0.2176321f},
-std::array<float,2>{0.409575373f, 0.0776705593f},
-std::array<float,2>{0.653895617f, 0.911404669f},
-std::array<float,2>{0.0180420112f, 0.655300677f},
-std::array<float,2>{0.779389501f, 0.43471083f},
-std::array<float,2>{0.136935398f, 0.150942251f},
-std::array<float,2>{0.941570461f, 0.808484018f},
-std::array<float,2>{0.252875984f, 0.589410901f},
-std::array<float,2>{0.539265811f, 0.267791897f},
-std::array<float,2>{0.392033547f, 0.460797787f},
-std::array<float,2>{0.656334281f, 0.726442814f},
-std::array<float,2>{0.0402471572f, 0.973947167f},
-std::array<float,2>{0.801852763f, 0.00940188672f},
-std::array<float,2>{0.0688888878f, 0.315805346f},
-std::array<float,2>{0.868384123f, 0.53095746f},
-std::array<float,2>{0.462995678f, 0.851784825f},
-std::array<float,2>{0.690070331f, 0.207888484f},
-std::array<float,2>{0.352492929f, 0.0665094778f},
-std::array<float,2>{0.567659438f, 0.915259778f},
-std::array<float,2>{0.191255018f, 0.645704806f},
-std::array<float,2>{0.913409412f, 0.423452556f},
-std::array<float,2>{0.0286974832f, 0.0419302657f},
-std::array<float,2>{0.767202795f, 0.968669474f},
-std::array<float,2>{0.415256113f, 0.706739128f},
-std::array<float,2>{0.648357213f, 0.473844588f},
-std::array<float,2>{0.295636564f, 0.306108892f},
-std::array<float,2>{0.519931555f, 0.620816588f},
-std::array<float,2>{0.161150023f, 0.777226865f},
-std::array<float,2>{0.985393822f, 0.161895066f},
-std::array<float,2>{0.249464542f, 0.395446807f},
-std::array<float,2>{0.891943395f, 0.671672583f},
-std::array<float,2>{0.324208558f, 0.895383894f},
-std::array<float,2>{0.61767745f, 0.122504897f},
-std::array<float,2>{0.493020475f, 0.241009519f},
-std::array<float,2>{0.748449624f, 0.837634623f},
-std::array<float,2>{0.102217264f, 0.551380634f},
-std::array<float,2>{0.835617423f, 0.344414979f},
-std::array<float,2>{0.203834265f, 0.100102119f},
-std::array<float,2>{0.933898687f, 0.881506741f},
-std::array<float,2>{0.362449557f, 0.687385798f},
-std::array<float,2>{0.591324687f, 0.38065365f},
-std::array<float,2>{0.444014162f, 0.367076337f},
-std::array<float,2>{0.715704381f, 0.532644093f},
-std::array<float,2>{0.0891568735f, 0.827004373f},
-std::array<float,2>{0.847756207f, 0.221498579f},
-std::array<float,2>{0.0599541813f, 0.486931235f},
-std::array<float,2>{0.791853845f, 0.692030728f},
-std::array<float,2>{0.385919988f, 0.947379708f},
-std::array<float,2>{0.682607055f, 0.0609851256f},
-std::array<float,2>{0.278725356f, 0.186354369f},
-std::array<float,2>{0.55995065f, 0.755586624f},
-std::array<float,2>{0.153505921f, 0.604943335f},
-std::array<float,2>{0.965599537f, 0.285973489f},
-std::array<float,2>{0.120867155f, 0.199502647f},
-std::array<float,2>{0.813889444f, 0.859577954f},
-std::array<float,2>{0.479353964f, 0.510253847f},
-std::array<float,2>{0.732798874f, 0.337934017f},
-std::array<float,2>{0.334810108f, 0.412353754f},
-std::array<float,2>{0.600917935f, 0.62621057f},
-std::array<float,2>{0.220100373f, 0.927077115f},
-std::array<float,2>{0.87596494f, 0.0792556405f},
-std::array<float,2>{0.182288378f, 0.264598966f},
-std::array<float,2>{0.97805661f, 0.57212162f},
-std::array<float,2>{0.304921806f, 0.79173106f},
-std::array<float,2>{0.508248746f, 0.13136059f},
-std::array<float,2>{0.436386853f, 0.0225316137f},
-std::array<float,2>{0.627283275f, 0.991473615f},
-std::array<float,2>{0.00325003685f, 0.738579333f},
-std::array<float,2>{0.754353583f, 0.439525694f},
-std::array<float,2>{0.230055749f, 0.228174552f},
-std::array<float,2>{0.88889873f, 0.818756521f},
-std::array<float,2>{0.338335842f, 0.545169234f},
-std::array<float,2>{0.605577826f, 0.372212201f},
-std::array<float,2>{0.472889036f, 0.389886022f},
-std::array<float,2>{0.721764982f, 0.675617456f},
-std::array<float,2>{0.116405621f, 0.890489399f},
-std::array<float,2>{0.826570213f, 0.103531323f},
-std::array<float,2>{0.00992003176f, 0.291048855f},
-std::array<float,2>{0.763227582f, 0.595266938f},
-std::array<float,2>{0.427917212f, 0.761589706f},
-std::array<float,2>{0.638242126f, 0.178053126f},
-std::array<float,2>{0.304278374f, 0.0530084595f},
-std::array<float,2>{0.506547987f, 0.93864274f},
-std::array<float,2>{0.172196463f, 0.695919931f},
-std::array<float,2>{0.97307086f, 0.494155347f},
-std::array<float,2>{0.0846642181f, 0.0920512751f},
-std::array<float,2>{0.858231723f, 0.937079012f},
-std::array<float,2>{0.446551144f, 0.636545122f},
-std::array<float,2>{0.705323935f, 0.419227928f},
-std::array<float,2>{0.374827623f, 0.329066336f},
-std::array<float,2>{0.583571196f, 0.501926005f},
-std::array<float,2>{0.214117453f, 0.874257743f},
-std::array<float,2>{0.927567661f, 0.189879999f},
-std::array<float,2>{0.147632658f, 0.45113948f},
-std::array<float,2>{0.954230666f, 0.745280027f},
-std::array<float,2>{0.272629946f, 0.993594587f},
-std::array<float,2>{0.547561049f, 0.0262082871f},
-std::array<float,2>{0.376241714f, 0.136667654f},
-std::array<float,2>{0.67573303f, 0.783963978f},
-std::array<float,2>{0.0518029705f, 0.563860536f},
-std::array<float,2>{0.785502493f, 0.253470331f},
-std::array<float,2>{0.164587855f, 0.0052477438f},
-std::array<float,2>{0.995316267f, 0.981813431f},
-std::array<float,2>{0.281651765f, 0.729256094f},
-std::array<float,2>{0.52823323f, 0.468250453f},
-std::array<float,2>{0.407421947f, 0.275850505f},
-std::array<float,2>{0.654712379f, 0.584308565f},
-std::array<float,2>{0.0169449504f, 0.797208846f},
-std::array<float,2>{0.778312087f, 0.146616086f},
-std::array<float,2>{0.0980947614f, 0.434047222f},
-std::array<float,2>{0.843303442f, 0.654745579f},
-std::array<float,2>{0.490708709f, 0.910179853f},
-std::array<float,2>{0.734965384f, 0.0767071024f},
-std::array<float,2>{0.318044007f, 0.218005732f},
-std::array<float,2>{0.613563657f, 0.851365089f},
-std::array<float,2>{0.239623114f, 0.520830333f},
-std::array<float,2>{0.903460622f, 0.321793646f},
-std::array<float,2>{0.0383354984f, 0.164390191f},
-std::array<float,2>{0.807930708f, 0.767911136f},
-std::array<float,2>{0.404190809f, 0.617114246f},
-std::array<float,2>{0.664874077f, 0.299729675f},
-std::array<float,2>{0.257862419f, 0.481473505f},
-std::array<float,2>{0.536115646f, 0.716641307f},
-std::array<float,2>{0.125316978f, 0.958951354f},
-std::array<float,2>{0.948216021f, 0.0356655978f},
-std::array<float,2>{0.197418451f, 0.356109619f},
-std::array<float,2>{0.918243051f, 0.556049705f},
-std::array<float,2>{0.351060957f, 0.829801559f},
-std::array<float,2>{0.576479077f, 0.247318223f},
-std::array<float,2>{0.457322478f, 0.113027282f},
-std::array<float,2>{0.702643216f, 0.902757108f},
-std::array<float,2>{0.076738514f, 0.660134912f},
-std::array<float,2>{0.864280224f, 0.406146139f},
-std::array<float,2>{0.19319661f, 0.174062818f},
-std::array<float,2>{0.909551382f, 0.761984468f},
-std::array<float,2>{0.358852535f, 0.599969625f},
-std::array<float,2>{0.5649032f, 0.295408487f},
-std::array<float,2>{0.466282666f, 0.496269941f},
-std::array<float,2>{0.69167769f, 0.699905157f},
-std::array<float,2>{0.0640440658f, 0.943626702f},
-std::array<float,2>{0.874160945f, 0.0483164825f},
-std::array<float,2>{0.0451564007f, 0.370708615f},
-std::array<float,2>{0.797547519f, 0.540110767f},
-std::array<float,2>{0.398302317f, 0.814530969f},
-std::array<float,2>{0.663497806f, 0.230812892f},
-std::array<float,2>{0.25695914f, 0.106759161f},
-std::array<float,2>{0.545748055f, 0.886498988f},
-std::array<float,2>{0.133632004f, 0.677129865f},
-std::array<float,2>{0.937538862f, 0.384052962f},
-std::array<float,2>{0.107672267f, 0.0305435993f},
-std::array<float,2>{0.831611216f, 0.998197973f},
-std::array<float,2>{0.496927232f, 0.749780893f},
-std::array<float,2>{0.745080233f, 0.445990175f},
-std::array<float,2>{0.326893389f, 0.256370664f},
-std::array<float,2>{0.622312605f, 0.567535222f},
-std::array<float,2>{0.24515149f, 0.787688076f},
-std::array<float,2>{0.897328019f, 0.140078589f},
-std::array<float,2>{0.159538969f, 0.41662851f},
-std::array<float,2>{0.990781069f, 0.639904916f},
-std::array<float,2>{0.290057629f, 0.930470645f},
-std::array<float,2>{0.516968906f, 0.0884209201f},
-std::array<float,2>{0.419118911f, 0.194715977f},
-std::array<float,2>{0.644016027f, 0.869522929f},
-std::array<float,2>{0.0244221333f, 0.50644213f},
-std::array<float,2>{0.772143483f, 0.332956135f},
-std::array<float,2>{0.149474248f, 0.0719385073f},
-std::array<float,2>{0.963190436f, 0.909852803f},
-std::array<float,2>{0.274460047f, 0.650096059f},
-std::array<float,2>{0.556448281f, 0.432423919f},
-std::array<float,2>{0.388082087f, 0.327684075f},
-std::array<float,2>{0.684710383f, 0.517888963f},
-std::array<float,2>{0.0550043844f, 0.847121298f},
-std::array<float,2>{0.796359062f, 0.211150274f},
-std::array<float,2>{0.0904355198f, 0.464677155f},
-std::array<float,2>{0.84445399f, 0.731261194f},
-std::array<float,2>{0.437732726f, 0.978113234f},
-std::array<float,2>{0.713673234f, 0.00316798175f},
-std::array<float,2>{0.363443255f, 0.140656382f},
-std::array<float,2>{0.588812888f, 0.803407252f},
-std::array<float,2>{0.207726091f, 0.579218566f},
-std::array<float,2>{0.931476593f, 0.279548794f},
-std::array<float,2>{0.00402501598f, 0.244524196f},
-std::array<float,2>{0.750748992f, 0.832626224f},
-std::array<float,2>{0.429807872f, 0.561523438f},
-std::array<float,2>{0.631679654f, 0.354555249f},
-std::array<float,2>{0.310184419f, 0.40065363f},
-std::array<float,2>{0.513492942f, 0.661751568f},
-std::array<float,2>{0.186634436f, 0.901502132f},
-std::array<float,2>{0.982969403f, 0.115875281f},
-std::array<float,2>{0.225261003f, 0.304370522f},
-std::array<float,2>{0.881812334f, 0.611932933f},
-std::array<float,2>{0.329224497f, 0.770655274f},
-std::array<float,2>{0.596235633f, 0.171433404f},
-std::array<float,2>{0.483912379f, 0.0329727232f},
-std::array<float,2>{0.7301476f, 0.956429243f},
-std::array<float,2>{0.123817794f, 0.71161747f},
-std::array<float,2>{0.817698121f, 0.479793757f},
-std::array<float,2>{0.177152649f, 0.204256371f},
-std::array<float,2>{0.970807254f, 0.855955303f},
-std::array<float,2>{0.298240244f, 0.523965001f},
-std::array<float,2>{0.502730668f, 0.319215685f},
-std::array<float,2>{0.425431818f, 0.428275555f},
-std::array<float,2>{0.636603236f, 0.641919732f},
-std::array<float,2>{0.0130545944f, 0.920560181f},
-std::array<float,2>{0.760595322f, 0.0626558661f},
-std::array<float,2>{0.112172119f, 0.269541532f},
-std::array<float,2>{0.823952138f, 0.59327215f},
-std::array<float,2>{0.469288886f, 0.812431395f},
-std::array<float,2>{0.723752379f, 0.15614526f},
-std::array<float,2>{0.339867562f, 0.0133159449f},
-std::array<float,2>{0.605113208f, 0.9707371f},
-std::array<float,2>{0.231473476f, 0.719250202f},
-std::array<float,2>{0.883839309f, 0.456455082f},
-std::array<float,2>{0.0502836071f, 0.121089391f},
-std::array<float,2>{0.784366012f, 0.894312143f},
-std::array<float,2>{0.379509956f, 0.664942205f},
-std::array<float,2>{0.678072333f, 0.39114207f},
-std::array<float,2>{0.268740922f, 0.349874675f},
-std::array<float,2>{0.552648902f, 0.547620058f},
-std::array<float,2>{0.140898615f, 0.841724157f},
-std::array<float,2>{0.957490921f, 0.236191824f},
-std::array<float,2>{0.216414258f, 0.47255218f},
-std::array<float,2>{0.923258841f, 0.709145129f},
-std::array<float,2>{0.371051222f, 0.964646816f},
-std::array<float,2>{0.579539657f, 0.0437740944f},
-std::array<float,2>{0.453021407f, 0.157666937f},
-std::array<float,2>{0.710695744f, 0.780082524f},
-std::array<float,2>{0.0790878311f, 0.624862611f},
-std::array<float,2>{0.855308056f, 0.308670759f},
-std::array<float,2>{0.237454891f, 0.0567290783f},
-std::array<float,2>{0.899306357f, 0.950289249f},
-std::array<float,2>{0.314071238f, 0.689669311f},
-std::array<float,2>{0.610021114f, 0.490377307f},
-std::array<float,2>{0.487792552f, 0.282444447f},
-std::array<float,2>{0.739433467f, 0.606727839f},
-std::array<float,2>{0.0941216946f, 0.753421783f},
-std::array<float,2>{0.837618768f, 0.18031688f},
-std::array<float,2>{0.0230941679f, 0.377981275f},
-std::array<float,2>{0.775497377f, 0.682624578f},
-std::array<float,2>{0.410448164f, 0.878137708f},
-std::array<float,2>{0.651329398f, 0.0958526731f},
-std::array<float,2>{0.287353545f, 0.223638371f},
-std::array<float,2>{0.523893356f, 0.821095109f},
-std::array<float,2>{0.171660766f, 0.537286937f},
-std::array<float,2>{0.996621311f, 0.359421998f},
-std::array<float,2>{0.0732961297f, 0.126957446f},
-std::array<float,2>{0.862572372f, 0.794889748f},
-std::array<float,2>{0.453744113f, 0.574721694f},
-std::array<float,2>{0.699003518f, 0.258343786f},
-std::array<float,2>{0.346110106f, 0.444063187f},
-std::array<float,2>{0.573771179f, 0.734833658f},
-std::array<float,2>{0.202285558f, 0.985912621f},
-std::array<float,2>{0.916575015f, 0.0186742172f},
-std::array<float,2>{0.132573709f, 0.340585887f},
-std::array<float,2>{0.94973439f, 0.513423443f},
-std::array<float,2>{0.264873207f, 0.865832448f},
-std::array<float,2>{0.534108877f, 0.196241751f},
-std::array<float,2>{0.399751216f, 0.0823878869f},
-std::array<float,2>{0.668320298f, 0.924069285f},
-std::array<float,2>{0.0323802643f, 0.629964292f},
-std::array<float,2>{0.812499881f, 0.408369392f},
-std::array<float,2>{0.162836581f, 0.163414717f},
-std::array<float,2>{0.988109767f, 0.774507999f},
-std::array<float,2>{0.29393366f, 0.617772698f},
-std::array<float,2>{0.521634459f, 0.30689615f},
-std::array<float,2>{0.416317344f, 0.474838614f},
-std::array<float,2>{0.645949841f, 0.704069316f},
-std::array<float,2>{0.0293445326f, 0.96504885f},
-std::array<float,2>{0.769025326f, 0.0398051217f},
-std::array<float,2>{0.103650764f, 0.345818102f},
-std::array<float,2>{0.833119929f, 0.553355038f},
-std::array<float,2>{0.494371712f, 0.838326633f},
-std::array<float,2>{0.74666661f, 0.239208981f},
-std::array<float,2>{0.321915209f, 0.124842055f},
-std::array<float,2>{0.620548308f, 0.896942139f},
-std::array<float,2>{0.246395186f, 0.66931051f},
-std::array<float,2>{0.893731356f, 0.397279382f},
-std::array<float,2>{0.0410706848f, 0.0114404494f},
-std::array<float,2>{0.803028405f, 0.975493848f},
-std::array<float,2>{0.392691791f, 0.723905027f},
-std::array<float,2>{0.659401059f, 0.457753152f},
-std::array<float,2>{0.250628293f, 0.265751928f},
-std::array<float,2>{0.54269582f, 0.58722651f},
-std::array<float,2>{0.140069053f, 0.805094838f},
-std::array<float,2>{0.943849564f, 0.149277911f},
-std::array<float,2>{0.188653186f, 0.424571574f},
-std::array<float,2>{0.910473824f, 0.646950841f},
-std::array<float,2>{0.354122818f, 0.916056335f},
-std::array<float,2>{0.570091963f, 0.0692631677f},
-std::array<float,2>{0.461010993f, 0.209074482f},
-std::array<float,2>{0.687923074f, 0.853533566f},
-std::array<float,2>{0.0683100373f, 0.527414978f},
-std::array<float,2>{0.870043397f, 0.313933045f},
-std::array<float,2>{0.221361816f, 0.0816490427f},
-std::array<float,2>{0.877929389f, 0.928248882f},
-std::array<float,2>{0.333230436f, 0.628130376f},
-std::array<float,2>{0.598771334f, 0.412032157f},
-std::array<float,2>{0.4778907f, 0.337485731f},
-std::array<float,2>{0.731803894f, 0.50913769f},
-std::array<float,2>{0.118812755f, 0.861678541f},
-std::array<float,2>{0.814766765f, 0.202455103f},
-std::array<float,2>{0.00135171483f, 0.438259333f},
-std::array<float,2>{0.75724417f, 0.740780115f},
-std::array<float,2>{0.435205728f, 0.988915622f},
-std::array<float,2>{0.626594961f, 0.0204063077f},
-std::array<float,2>{0.306926489f, 0.129398391f},
-std::array<float,2>{0.510546863f, 0.789518178f},
-std::array<float,2>{0.181011036f, 0.572571337f},
-std::array<float,2>{0.979610801f, 0.262444913f},
-std::array<float,2>{0.086015597f, 0.220006421f},
-std::array<float,2>{0.850126505f, 0.824688256f},
-std::array<float,2>{0.442269385f, 0.533850193f},
-std::array<float,2>{0.717907906f, 0.364431739f},
-std::array<float,2>{0.359605879f, 0.381715328f},
-std::array<float,2>{0.593452096f, 0.685005486f},
-std::array<float,2>{0.205702424f, 0.879389644f},
-std::array<float,2>{0.936060131f, 0.0994355232f},
-std::array<float,2>{0.155874714f, 0.288773268f},
-std::array<float,2>{0.966980636f, 0.602419257f},
-std::array<float,2>{0.281163633f, 0.756682575f},
-std::array<float,2>{0.561654925f, 0.185047969f},
-std::array<float,2>{0.384499192f, 0.0599377379f},
-std::array<float,2>{0.680897117f, 0.946994901f},
-std::array<float,2>{0.0620057024f, 0.693980217f},
-std::array<float,2>{0.789930642f, 0.486070842f},
-std::array<float,2>{0.211328968f, 0.187685296f},
-std::array<float,2>{0.929446459f, 0.872547448f},
-std::array<float,2>{0.371182382f, 0.50310868f},
-std::array<float,2>{0.584492087f, 0.330363631f},
-std::array<float,2>{0.448721051f, 0.420724571f},
-std::array<float,2>{0.703969836f, 0.633868754f},
-std::array<float,2>{0.0836830735f, 0.93547225f},
-std::array<float,2>{0.856253266f, 0.091016762f},
-std::array<float,2>{0.0537879653f, 0.251156718f},
-std::array<float,2>{0.788176358f, 0.566373408f},
-std::array<float,2>{0.377287477f, 0.781627595f},
-std::array<float,2>{0.672878265f, 0.134727105f},
-std::array<float,2>{0.269802719f, 0.0249234121f},
-std::array<float,2>{0.55051887f, 0.994382381f},
-std::array<float,2>{0.145379588f, 0.743188381f},
-std::array<float,2>{0.956282973f, 0.45273751f},
-std::array<float,2>{0.114768535f, 0.103278987f},
-std::array<float,2>{0.824935019f, 0.887482703f},
-std::array<float,2>{0.475877821f, 0.672230482f},
-std::array<float,2>{0.719113946f, 0.387192488f},
-std::array<float,2>{0.337661177f, 0.374043107f},
-std::array<float,2>{0.608854413f, 0.543714285f},
-std::array<float,2>{0.22771661f, 0.816536665f},
-std::array<float,2>{0.888014734f, 0.229823768f},
-std::array<float,2>{0.174534291f, 0.493977219f},
-std::array<float,2>{0.975936711f, 0.698472679f},
-std::array<float,2>{0.301578164f, 0.941187263f},
-std::array<float,2>{0.504749954f, 0.0508874692f},
-std::array<float,2>{0.427125901f, 0.176704481f},
-std::array<float,2>{0.63946414f, 0.757883132f},
-std::array<float,2>{0.00824363064f, 0.597205579f},
-std::array<float,2>{0.764012098f, 0.290519834f},
-std::array<float,2>{0.128717586f, 0.0378392152f},
-std::array<float,2>{0.945449769f, 0.959368467f},
-std::array<float,2>{0.261255056f, 0.717456341f},
-std::array<float,2>{0.538194954f, 0.483582914f},
-std::array<float,2>{0.404545486f, 0.298263341f},
-std::array<float,2>{0.666774094f, 0.614752293f},
-std::array<float,2>{0.0366083458f, 0.767029762f},
-std::array<float,2>{0.80654496f, 0.167638615f},
-std::array<float,2>{0.0750663131f, 0.403284281f},
-std::array<float,2>{0.866717219f, 0.658108473f},
-std::array<float,2>{0.459849179f, 0.905052125f},
-std::array<float,2>{0.700660825f, 0.109739661f},
-std::array<float,2>{0.348983288f, 0.249663219f},
-std::array<float,2>{0.575333953f, 0.830801129f},
-std::array<float,2>{0.195631936f, 0.557152092f},
-std::array<float,2>{0.920770586f, 0.358215094f},
-std::array<float,2>{0.0176455658f, 0.144972503f},
-std::array<float,2>{0.779782176f, 0.799916565f},
-std::array<float,2>{0.409290433f, 0.582341373f},
-std::array<float,2>{0.654278517f, 0.275053084f},
-std::array<float,2>{0.284555048f, 0.465344548f},
-std::array<float,2>{0.530558825f, 0.72692138f},
-std::array<float,2>{0.167182818f, 0.983186185f},
-std::array<float,2>{0.993508756f, 0.00654058903f},
-std::array<float,2>{0.240672201f, 0.323466152f},
-std::array<float,2>{0.905072451f, 0.523070693f},
-std::array<float,2>{0.31978026f, 0.848974526f},
-std::array<float,2>{0.616262734f, 0.216123194f},
-std::array<float,2>{0.488768399f, 0.0751823708f},
-std::array<float,2>{0.736522496f, 0.91243434f},
-std::array<float,2>{0.0998362228f, 0.654192507f},
-std::array<float,2>{0.841322541f, 0.437330842f},
-std::array<float,2>{0.242414176f, 0.137264937f},
-std::array<float,2>{0.895443618f, 0.786300302f},
-std::array<float,2>{0.324930042f, 0.568992257f},
-std::array<float,2>{0.624767423f, 0.254656523f},
-std::array<float,2>{0.499853432f, 0.448859394f},
-std::array<float,2>{0.742685616f, 0.747306764f},
-std::array<float,2>{0.10645242f, 0.996773183f},
-std::array<float,2>{0.830023289f, 0.0281848386f},
-std::array<float,2>{0.0256180651f, 0.335154861f},
-std::array<float,2>{0.770573318f, 0.505804896f},
-std::array<float,2>{0.421495259f, 0.868337154f},
-std::array<float,2>{0.642023563f, 0.192717552f},
-std::array<float,2>{0.292543739f, 0.0869019479f},
-std::array<float,2>{0.519138217f, 0.933000863f},
-std::array<float,2>{0.15752998f, 0.638524771f},
-std::array<float,2>{0.989219546f, 0.414672345f},
-std::array<float,2>{0.065412581f, 0.0492140166f},
-std::array<float,2>{0.871210694f, 0.943331301f},
-std::array<float,2>{0.466996044f, 0.701539278f},
-std::array<float,2>{0.695281625f, 0.498457253f},
-std::array<float,2>{0.355663031f, 0.294014812f},
-std::array<float,2>{0.564203739f, 0.599194407f},
-std::array<float,2>{0.19373779f, 0.764937699f},
-std::array<float,2>{0.906785786f, 0.172161728f},
-std::array<float,2>{0.13641265f, 0.38626501f},
-std::array<float,2>{0.93949461f, 0.67832315f},
-std::array<float,2>{0.255793899f, 0.884644926f},
-std::array<float,2>{0.544863522f, 0.107422754f},
-std::array<float,2>{0.394945145f, 0.232665822f},
-std::array<float,2>{0.661096692f, 0.814243853f},
-std::array<float,2>{0.0438885875f, 0.541667581f},
-std::array<float,2>{0.799996614f, 0.36901319f},
-std::array<float,2>{0.185345531f, 0.113642327f},
-std::array<float,2>{0.980529189f, 0.898992479f},
-std::array<float,2>{0.31228438f, 0.66260016f},
-std::array<float,2>{0.514695883f, 0.399082512f},
-std::array<float,2>{0.433013499f, 0.352430999f},
-std::array<float,2>{0.629080951f, 0.558752f},
-std::array<float,2>{0.00734735001f, 0.834351003f},
-std::array<float,2>{0.751956582f, 0.243530914f},
-std::array<float,2>{0.122688375f, 0.478495181f},
-std::array<float,2>{0.820175707f, 0.713294566f},
-std::array<float,2>{0.480632007f, 0.953411996f},
-std::array<float,2>{0.727888644f, 0.0350007266f},
-std::array<float,2>{0.331091732f, 0.169436321f},
-std::array<float,2>{0.595416248f, 0.772375345f},
-std::array<float,2>{0.222683206f, 0.609516025f},
-std::array<float,2>{0.880492866f, 0.301577568f},
-std::array<float,2>{0.0566804819f, 0.214112818f},
-std::array<float,2>{0.793596506f, 0.845431983f},
-std::array<float,2>{0.388809443f, 0.515775502f},
-std::array<float,2>{0.686306953f, 0.324508101f},
-std::array<float,2>{0.276851207f, 0.430356562f},
-std::array<float,2>{0.558137417f, 0.651681125f},
-std::array<float,2>{0.152222425f, 0.90707618f},
-std::array<float,2>{0.961415589f, 0.0738222599f},
-std::array<float,2>{0.209760144f, 0.278080314f},
-std::array<float,2>{0.932977736f, 0.580976725f},
-std::array<float,2>{0.366628408f, 0.802697241f},
-std::array<float,2>{0.586477816f, 0.143273726f},
-std::array<float,2>{0.441390008f, 0.00104869134f},
-std::array<float,2>{0.71134901f, 0.979513466f},
-std::array<float,2>{0.0924116075f, 0.732686043f},
-std::array<float,2>{0.846748292f, 0.462174326f},
-std::array<float,2>{0.14410156f, 0.23760511f},
-std::array<float,2>{0.958996594f, 0.841961443f},
-std::array<float,2>{0.266510576f, 0.549789071f},
-std::array<float,2>{0.553174317f, 0.34894672f},
-std::array<float,2>{0.382100165f, 0.393465519f},
-std::array<float,2>{0.675806463f, 0.667257667f},
-std::array<float,2>{0.048291944f, 0.891269386f},
-std::array<float,2>{0.781873763f, 0.118538961f},
-std::array<float,2>{0.0813103244f, 0.311487973f},
-std::array<float,2>{0.853278577f, 0.621678591f},
-std::array<float,2>{0.449733973f, 0.779128075f},
-std::array<float,2>{0.708165705f, 0.158642471f},
-std::array<float,2>{0.367376924f, 0.0452244952f},
-std::array<float,2>{0.581762195f, 0.961954474f},
-std::array<float,2>{0.217723861f, 0.70782131f},
-std::array<float,2>{0.924498916f, 0.47002548f},
-std::array<float,2>{0.0152291311f, 0.0660725087f},
-std::array<float,2>{0.758363128f, 0.919672072f},
-std::array<float,2>{0.422778279f, 0.644256413f},
-std::array<float,2>{0.634444356f, 0.427627057f},
-std::array<float,2>{0.299181849f, 0.31742394f},
-std::array<float,2>{0.501379371f, 0.526166618f},
-std::array<float,2>{0.178457558f, 0.857630849f},
-std::array<float,2>{0.97064364f, 0.206849605f},
-std::array<float,2>{0.233496204f, 0.454582661f},
-std::array<float,2>{0.886333287f, 0.722035468f},
-std::array<float,2>{0.342102438f, 0.970644474f},
-std::array<float,2>{0.603352129f, 0.0139023243f},
-std::array<float,2>{0.470747292f, 0.152622223f},
-std::array<float,2>{0.72464323f, 0.809345663f},
-std::array<float,2>{0.110079907f, 0.591308355f},
-std::array<float,2>{0.821803808f, 0.272484124f},
-std::array<float,2>{0.20085305f, 0.017459888f},
-std::array<float,2>{0.914778769f, 0.986753762f},
-std::array<float,2>{0.343862653f, 0.737699986f},
-std::array<float,2>{0.571863055f, 0.442844361f},
-std::array<float,2>{0.456337094f, 0.259863317f},
-std::array<float,2>{0.69579339f, 0.577490628f},
-std::array<float,2>{0.0703574941f, 0.795620859f},
-std::array<float,2>{0.860893071f, 0.126701877f},
-std::array<float,2>{0.0334532298f, 0.407951951f},
-std::array<float,2>{0.809328854f, 0.632209182f},
-std::array<float,2>{0.401021183f, 0.92223227f},
-std::array<float,2>{0.670151889f, 0.0841004252f},
-std::array<float,2>{0.263470799f, 0.198518723f},
-std::array<float,2>{0.531549692f, 0.863947093f},
-std::array<float,2>{0.129755422f, 0.51549381f},
-std::array<float,2>{0.952199042f, 0.343704879f},
-std::array<float,2>{0.0969120041f, 0.182622552f},
-std::array<float,2>{0.839392364f, 0.75056833f},
-std::array<float,2>{0.486208946f, 0.607928157f},
-std::array<float,2>{0.740553916f, 0.285037905f},
-std::array<float,2>{0.314850807f, 0.48862952f},
-std::array<float,2>{0.612911105f, 0.688579559f},
-std::array<float,2>{0.234554961f, 0.953041852f},
-std::array<float,2>{0.902275026f, 0.0564874597f},
-std::array<float,2>{0.169741809f, 0.3632285f},
-std::array<float,2>{0.999468505f, 0.535677969f},
-std::array<float,2>{0.286887348f, 0.823278666f},
-std::array<float,2>{0.525947571f, 0.226312473f},
-std::array<float,2>{0.412525296f, 0.0940902308f},
-std::array<float,2>{0.649718404f, 0.875824451f},
-std::array<float,2>{0.0202852953f, 0.6808213f},
-std::array<float,2>{0.775338292f, 0.375573188f},
-std::array<float,2>{0.152550265f, 0.184540272f},
-std::array<float,2>{0.96644628f, 0.756914496f},
-std::array<float,2>{0.278163642f, 0.603005111f},
-std::array<float,2>{0.558800757f, 0.287173897f},
-std::array<float,2>{0.385526031f, 0.484895766f},
-std::array<float,2>{0.683154047f, 0.694898009f},
-std::array<float,2>{0.0590012819f, 0.945883811f},
-std::array<float,2>{0.792613328f, 0.0591652915f},
-std::array<float,2>{0.0884764716f, 0.364111692f},
-std::array<float,2>{0.849501014f, 0.53443563f},
-std::array<float,2>{0.445270449f, 0.825279772f},
-std::array<float,2>{0.716127455f, 0.219110638f},
-std::array<float,2>{0.362101316f, 0.0983351246f},
-std::array<float,2>{0.590362668f, 0.879888535f},
-std::array<float,2>{0.204296291f, 0.68392849f},
-std::array<float,2>{0.935232103f, 0.382311791f},
-std::array<float,2>{0.0023021549f, 0.0210044235f},
-std::array<float,2>{0.755175233f, 0.989766836f},
-std::array<float,2>{0.437126219f, 0.741504371f},
-std::array<float,2>{0.628408253f, 0.438745737f},
-std::array<float,2>{0.30648613f, 0.263484657f},
-std::array<float,2>{0.509205163f, 0.573355913f},
-std::array<float,2>{0.182773471f, 0.790808141f},
-std::array<float,2>{0.976798415f, 0.130373761f},
-std::array<float,2>{0.219538957f, 0.411103398f},
-std::array<float,2>{0.876897037f, 0.62697494f},
-std::array<float,2>{0.335300803f, 0.929075778f},
-std::array<float,2>{0.600368083f, 0.0808643773f},
-std::array<float,2>{0.479923278f, 0.201734543f},
-std::array<float,2>{0.733873904f, 0.862331629f},
-std::array<float,2>{0.119476914f, 0.5080809f},
-std::array<float,2>{0.813148916f, 0.336556107f},
-std::array<float,2>{0.190248266f, 0.0699154735f},
-std::array<float,2>{0.913060308f, 0.917232275f},
-std::array<float,2>{0.353242695f, 0.647795022f},
-std::array<float,2>{0.566597462f, 0.425600559f},
-std::array<float,2>{0.464353472f, 0.312748164f},
-std::array<float,2>{0.691329122f, 0.528731048f},
-std::array<float,2>{0.0699167475f, 0.85528326f},
-std::array<float,2>{0.867605269f, 0.21018596f},
-std::array<float,2>{0.0397586115f, 0.458434135f},
-std::array<float,2>{0.801670015f, 0.723030508f},
-std::array<float,2>{0.390662283f, 0.976063967f},
-std::array<float,2>{0.658070862f, 0.0105051454f},
-std::array<float,2>{0.253220737f, 0.150191844f},
-std::array<float,2>{0.540317595f, 0.805800378f},
-std::array<float,2>{0.137755156f, 0.586099207f},
-std::array<float,2>{0.943018854f, 0.267455071f},
-std::array<float,2>{0.102737509f, 0.239991218f},
-std::array<float,2>{0.834891081f, 0.839469969f},
-std::array<float,2>{0.493794292f, 0.553970516f},
-std::array<float,2>{0.749934494f, 0.346771598f},
-std::array<float,2>{0.322302699f, 0.397481591f},
-std::array<float,2>{0.618324757f, 0.668199658f},
-std::array<float,2>{0.248617381f, 0.897894681f},
-std::array<float,2>{0.891466081f, 0.123656474f},
-std::array<float,2>{0.160205334f, 0.307957053f},
-std::array<float,2>{0.98478353f, 0.618758142f},
-std::array<float,2>{0.296192229f, 0.773741782f},
-std::array<float,2>{0.521318853f, 0.162672728f},
-std::array<float,2>{0.414117962f, 0.0401225649f},
-std::array<float,2>{0.647241294f, 0.966323197f},
-std::array<float,2>{0.0278055705f, 0.704232991f},
-std::array<float,2>{0.766173482f, 0.475780457f},
-std::array<float,2>{0.239209786f, 0.215715468f},
-std::array<float,2>{0.903117359f, 0.848432422f},
-std::array<float,2>{0.316597909f, 0.522242129f},
-std::array<float,2>{0.61514014f, 0.32248807f},
-std::array<float,2>{0.492043108f, 0.436056226f},
-std::array<float,2>{0.735920608f, 0.652393937f},
-std::array<float,2>{0.0988840237f, 0.913462579f},
-std::array<float,2>{0.842128456f, 0.0758503675f},
-std::array<float,2>{0.0164920427f, 0.27387771f},
-std::array<float,2>{0.779167712f, 0.583694279f},
-std::array<float,2>{0.406324983f, 0.799740851f},
-std::array<float,2>{0.655440807f, 0.146308392f},
-std::array<float,2>{0.283062518f, 0.00719377957f},
-std::array<float,2>{0.528667867f, 0.983893037f},
-std::array<float,2>{0.165257677f, 0.72825557f},
-std::array<float,2>{0.994905829f, 0.466189057f},
-std::array<float,2>{0.0779992491f, 0.111039788f},
-std::array<float,2>{0.863645256f, 0.906135559f},
-std::array<float,2>{0.458389908f, 0.657032132f},
-std::array<float,2>{0.701380968f, 0.404265672f},
-std::array<float,2>{0.349842697f, 0.358489245f},
-std::array<float,2>{0.577648878f, 0.55828774f},
-std::array<float,2>{0.198542461f, 0.831734121f},
-std::array<float,2>{0.919532537f, 0.248155624f},
-std::array<float,2>{0.126664475f, 0.483324826f},
-std::array<float,2>{0.94837153f, 0.717915535f},
-std::array<float,2>{0.259127557f, 0.960467994f},
-std::array<float,2>{0.536686182f, 0.0384935625f},
-std::array<float,2>{0.402618319f, 0.16627042f},
-std::array<float,2>{0.665758431f, 0.76644659f},
-std::array<float,2>{0.0379399396f, 0.614061415f},
-std::array<float,2>{0.807603776f, 0.297023743f},
-std::array<float,2>{0.17337504f, 0.0521902926f},
-std::array<float,2>{0.973909795f, 0.939628363f},
-std::array<float,2>{0.302858621f, 0.697363973f},
-std::array<float,2>{0.507211089f, 0.492927432f},
-std::array<float,2>{0.429555655f, 0.289288998f},
-std::array<float,2>{0.636933625f, 0.596650243f},
-std::array<float,2>{0.0112154661f, 0.759386361f},
-std::array<float,2>{0.762106299f, 0.177703202f},
-std::array<float,2>{0.11586123f, 0.387812108f},
-std::array<float,2>{0.827818632f, 0.67303288f},
-std::array<float,2>{0.473916858f, 0.888668239f},
-std::array<float,2>{0.720852911f, 0.101951517f},
-std::array<float,2>{0.339209288f, 0.229483604f},
-std::array<float,2>{0.607193947f, 0.817873061f},
-std::array<float,2>{0.229084969f, 0.543963909f},
-std::array<float,2>{0.890449524f, 0.373959094f},
-std::array<float,2>{0.0508546084f, 0.132859349f},
-std::array<float,2>{0.786319733f, 0.782295048f},
-std::array<float,2>{0.375333488f, 0.564573765f},
-std::array<float,2>{0.674031615f, 0.250383735f},
-std::array<float,2>{0.271739244f, 0.451377213f},
-std::array<float,2>{0.548538387f, 0.742471099f},
-std::array<float,2>{0.147140697f, 0.996020913f},
-std::array<float,2>{0.953556836f, 0.0237160847f},
-std::array<float,2>{0.212977469f, 0.331079006f},
-std::array<float,2>{0.926714361f, 0.502055764f},
-std::array<float,2>{0.373238027f, 0.871521652f},
-std::array<float,2>{0.582789838f, 0.189049482f},
-std::array<float,2>{0.446176589f, 0.0906950608f},
-std::array<float,2>{0.706361413f, 0.93423748f},
-std::array<float,2>{0.0853827894f, 0.633509398f},
-std::array<float,2>{0.858672976f, 0.421528816f},
-std::array<float,2>{0.208968922f, 0.143936887f},
-std::array<float,2>{0.929872394f, 0.801666021f},
-std::array<float,2>{0.364793658f, 0.581742048f},
-std::array<float,2>{0.589693546f, 0.279169142f},
-std::array<float,2>{0.438947141f, 0.461630285f},
-std::array<float,2>{0.713882089f, 0.733615041f},
-std::array<float,2>{0.0915479511f, 0.978526592f},
-std::array<float,2>{0.845537245f, 0.000425852573f},
-std::array<float,2>{0.0563070774f, 0.32523194f},
-std::array<float,2>{0.795728385f, 0.517543197f},
-std::array<float,2>{0.386744827f, 0.844238222f},
-std::array<float,2>{0.683948576f, 0.212956578f},
-std::array<float,2>{0.273446918f, 0.0730780214f},
-std::array<float,2>{0.555306971f, 0.908152878f},
-std::array<float,2>{0.14891164f, 0.650670052f},
-std::array<float,2>{0.964682877f, 0.430873811f},
-std::array<float,2>{0.124802016f, 0.033713147f},
-std::array<float,2>{0.816629291f, 0.954143822f},
-std::array<float,2>{0.482683837f, 0.714255631f},
-std::array<float,2>{0.728571713f, 0.476745695f},
-std::array<float,2>{0.328552544f, 0.302259415f},
-std::array<float,2>{0.59707427f, 0.610856891f},
-std::array<float,2>{0.226436853f, 0.772634745f},
-std::array<float,2>{0.882707119f, 0.168197274f},
-std::array<float,2>{0.185774878f, 0.400256634f},
-std::array<float,2>{0.98397547f, 0.663905203f},
-std::array<float,2>{0.308946669f, 0.899811387f},
-std::array<float,2>{0.511992455f, 0.114475623f},
-std::array<float,2>{0.431101739f, 0.242399514f},
-std::array<float,2>{0.632086217f, 0.835859835f},
-std::array<float,2>{0.00578650367f, 0.560241461f},
-std::array<float,2>{0.751137376f, 0.353392422f},
-std::array<float,2>{0.134419724f, 0.10928566f},
-std::array<float,2>{0.938802779f, 0.883674204f},
-std::array<float,2>{0.256826192f, 0.679018974f},
-std::array<float,2>{0.546462536f, 0.384986013f},
-std::array<float,2>{0.39692381f, 0.367637277f},
-std::array<float,2>{0.662617385f, 0.542832494f},
-std::array<float,2>{0.0459240749f, 0.813273966f},
-std::array<float,2>{0.798711002f, 0.233533964f},
-std::array<float,2>{0.0633991882f, 0.499632537f},
-std::array<float,2>{0.873537898f, 0.702992976f},
-std::array<float,2>{0.465397477f, 0.942161441f},
-std::array<float,2>{0.692683876f, 0.0499715544f},
-std::array<float,2>{0.357918113f, 0.173583329f},
-std::array<float,2>{0.566329062f, 0.763802111f},
-std::array<float,2>{0.191433474f, 0.597678125f},
-std::array<float,2>{0.908839166f, 0.293915987f},
-std::array<float,2>{0.0238620583f, 0.192012087f},
-std::array<float,2>{0.773193061f, 0.867219627f},
-std::array<float,2>{0.418863624f, 0.503942013f},
-std::array<float,2>{0.64269048f, 0.334906638f},
-std::array<float,2>{0.289219767f, 0.415075511f},
-std::array<float,2>{0.515907228f, 0.63737613f},
-std::array<float,2>{0.158739835f, 0.931642473f},
-std::array<float,2>{0.991787374f, 0.0870158747f},
-std::array<float,2>{0.24439542f, 0.255046725f},
-std::array<float,2>{0.89826268f, 0.570063114f},
-std::array<float,2>{0.32745564f, 0.785762548f},
-std::array<float,2>{0.621512115f, 0.137883484f},
-std::array<float,2>{0.497685194f, 0.0291176438f},
-std::array<float,2>{0.74543494f, 0.997495949f},
-std::array<float,2>{0.108843111f, 0.74637562f},
-std::array<float,2>{0.830857337f, 0.447291166f},
-std::array<float,2>{0.170704126f, 0.225581288f},
-std::array<float,2>{0.997361422f, 0.823148191f},
-std::array<float,2>{0.28869465f, 0.536623418f},
-std::array<float,2>{0.524810314f, 0.362277418f},
-std::array<float,2>{0.411646724f, 0.376237661f},
-std::array<float,2>{0.651766717f, 0.680238187f},
-std::array<float,2>{0.0221778546f, 0.87658608f},
-std::array<float,2>{0.777098894f, 0.0948685333f},
-std::array<float,2>{0.0953658149f, 0.28403753f},
-std::array<float,2>{0.836801887f, 0.608776927f},
-std::array<float,2>{0.487084508f, 0.751535416f},
-std::array<float,2>{0.738353312f, 0.182438239f},
-std::array<float,2>{0.31296283f, 0.0556396693f},
-std::array<float,2>{0.610677361f, 0.951294422f},
-std::array<float,2>{0.236486644f, 0.687703133f},
-std::array<float,2>{0.89953649f, 0.489676803f},
-std::array<float,2>{0.0316581652f, 0.0857097954f},
-std::array<float,2>{0.811351299f, 0.923487842f},
-std::array<float,2>{0.399163574f, 0.631131232f},
-std::array<float,2>{0.669093311f, 0.406385064f},
-std::array<float,2>{0.264203697f, 0.342242301f},
-std::array<float,2>{0.534455955f, 0.514286339f},
-std::array<float,2>{0.130894512f, 0.86443007f},
-std::array<float,2>{0.950649798f, 0.197279692f},
-std::array<float,2>{0.201518565f, 0.442089915f},
-std::array<float,2>{0.917036414f, 0.736488521f},
-std::array<float,2>{0.34669444f, 0.987647116f},
-std::array<float,2>{0.572357297f, 0.0165138338f},
-std::array<float,2>{0.45457226f, 0.12536855f},
-std::array<float,2>{0.698197007f, 0.796570957f},
-std::array<float,2>{0.0724184141f, 0.57681787f},
-std::array<float,2>{0.862134099f, 0.261134923f},
-std::array<float,2>{0.231101185f, 0.015489215f},
-std::array<float,2>{0.883767366f, 0.968883455f},
-std::array<float,2>{0.341593593f, 0.720843315f},
-std::array<float,2>{0.604145527f, 0.453403831f},
-std::array<float,2>{0.470336795f, 0.271823555f},
-std::array<float,2>{0.722763181f, 0.590770423f},
-std::array<float,2>{0.112579092f, 0.809955895f},
-std::array<float,2>{0.823081851f, 0.153978273f},
-std::array<float,2>{0.0123587623f, 0.425913334f},
-std::array<float,2>{0.761209726f, 0.642582119f},
-std::array<float,2>{0.42422241f, 0.918543518f},
-std::array<float,2>{0.635618925f, 0.0651396587f},
-std::array<float,2>{0.297511518f, 0.205352068f},
-std::array<float,2>{0.503537178f, 0.858719349f},
-std::array<float,2>{0.176431999f, 0.526779234f},
-std::array<float,2>{0.971783817f, 0.31669268f},
-std::array<float,2>{0.0798298344f, 0.159246564f},
-std::array<float,2>{0.854399681f, 0.777571976f},
-std::array<float,2>{0.45119065f, 0.622699082f},
-std::array<float,2>{0.70932281f, 0.312006474f},
-std::array<float,2>{0.369242996f, 0.469456255f},
-std::array<float,2>{0.578384161f, 0.708634853f},
-std::array<float,2>{0.21535702f, 0.96168226f},
-std::array<float,2>{0.922052383f, 0.0463239104f},
-std::array<float,2>{0.142208174f, 0.348023444f},
-std::array<float,2>{0.958292127f, 0.549828947f},
-std::array<float,2>{0.268411338f, 0.843015611f},
-std::array<float,2>{0.551629663f, 0.237084419f},
-std::array<float,2>{0.380832642f, 0.117292792f},
-std::array<float,2>{0.678810656f, 0.892290115f},
-std::array<float,2>{0.0489002727f, 0.666083097f},
-std::array<float,2>{0.783414006f, 0.393804669f},
-std::array<float,2>{0.180432811f, 0.132271469f},
-std::array<float,2>{0.978544712f, 0.792287529f},
-std::array<float,2>{0.307925105f, 0.570997059f},
-std::array<float,2>{0.511426687f, 0.265445977f},
-std::array<float,2>{0.434372932f, 0.44082278f},
-std::array<float,2>{0.625897706f, 0.739851952f},
-std::array<float,2>{0.000318453531f, 0.991035342f},
-std::array<float,2>{0.756104171f, 0.0215945803f},
-std::array<float,2>{0.118116714f, 0.339141637f},
-std::array<float,2>{0.815721333f, 0.511541784f},
-std::array<float,2>{0.477070242f, 0.861326814f},
-std::array<float,2>{0.731078982f, 0.200600758f},
-std::array<float,2>{0.332152009f, 0.0785266533f},
-std::array<float,2>{0.598603785f, 0.92594111f},
-std::array<float,2>{0.221998602f, 0.625512481f},
-std::array<float,2>{0.878590763f, 0.41331622f},
-std::array<float,2>{0.060894154f, 0.0623649061f},
-std::array<float,2>{0.790528536f, 0.949052215f},
-std::array<float,2>{0.383251399f, 0.692756832f},
-std::array<float,2>{0.679715395f, 0.487758845f},
-std::array<float,2>{0.279954016f, 0.28693819f},
-std::array<float,2>{0.561344743f, 0.603949606f},
-std::array<float,2>{0.154660195f, 0.754660666f},
-std::array<float,2>{0.968568146f, 0.186851904f},
-std::array<float,2>{0.206189767f, 0.378959537f},
-std::array<float,2>{0.937044442f, 0.685626328f},
-std::array<float,2>{0.360620975f, 0.882597864f},
-std::array<float,2>{0.591894925f, 0.101172872f},
-std::array<float,2>{0.442859054f, 0.221851572f},
-std::array<float,2>{0.717565238f, 0.827432692f},
-std::array<float,2>{0.0872345641f, 0.53139478f},
-std::array<float,2>{0.851518095f, 0.365331709f},
-std::array<float,2>{0.247477919f, 0.121675268f},
-std::array<float,2>{0.893061638f, 0.896348774f},
-std::array<float,2>{0.321118891f, 0.670761108f},
-std::array<float,2>{0.619615674f, 0.395833731f},
-std::array<float,2>{0.495332092f, 0.345090538f},
-std::array<float,2>{0.747093976f, 0.552284539f},
-std::array<float,2>{0.105233893f, 0.836497724f},
-std::array<float,2>{0.832683325f, 0.242002815f},
-std::array<float,2>{0.0311203301f, 0.472708791f},
-std::array<float,2>{0.768040717f, 0.705389977f},
-std::array<float,2>{0.417388618f, 0.967738271f},
-std::array<float,2>{0.645362556f, 0.0424727425f},
-std::array<float,2>{0.294546217f, 0.160558894f},
-std::array<float,2>{0.522793949f, 0.775701165f},
-std::array<float,2>{0.163765162f, 0.620031834f},
-std::array<float,2>{0.987300396f, 0.304902613f},
-std::array<float,2>{0.067366451f, 0.208333746f},
-std::array<float,2>{0.870709658f, 0.853215337f},
-std::array<float,2>{0.461957991f, 0.530113935f},
-std::array<float,2>{0.688988388f, 0.315218627f},
-std::array<float,2>{0.35452196f, 0.421911716f},
-std::array<float,2>{0.569155276f, 0.645170093f},
-std::array<float,2>{0.188062429f, 0.914174199f},
-std::array<float,2>{0.912093699f, 0.0675837398f},
-std::array<float,2>{0.139588073f, 0.269179046f},
-std::array<float,2>{0.944920719f, 0.587897897f},
-std::array<float,2>{0.251876205f, 0.807373405f},
-std::array<float,2>{0.541909575f, 0.151602462f},
-std::array<float,2>{0.3944121f, 0.00787597895f},
-std::array<float,2>{0.658833265f, 0.973131657f},
-std::array<float,2>{0.0428793207f, 0.725299656f},
-std::array<float,2>{0.803744972f, 0.459919244f},
-std::array<float,2>{0.197112337f, 0.246477112f},
-std::array<float,2>{0.921774089f, 0.828157961f},
-std::array<float,2>{0.348605692f, 0.554920435f},
-std::array<float,2>{0.574558735f, 0.356714249f},
-std::array<float,2>{0.460517913f, 0.404685229f},
-std::array<float,2>{0.699542701f, 0.659093738f},
-std::array<float,2>{0.0751979724f, 0.903879583f},
-std::array<float,2>{0.865277231f, 0.111904584f},
-std::array<float,2>{0.0353465788f, 0.300206095f},
-std::array<float,2>{0.804818273f, 0.61612004f},
-std::array<float,2>{0.405425578f, 0.769121647f},
-std::array<float,2>{0.667674661f, 0.165616572f},
-std::array<float,2>{0.260040045f, 0.0366441123f},
-std::array<float,2>{0.537865341f, 0.957626581f},
-std::array<float,2>{0.127455071f, 0.715142608f},
-std::array<float,2>{0.946663737f, 0.481292963f},
-std::array<float,2>{0.10146077f, 0.0775066391f},
-std::array<float,2>{0.839936078f, 0.911878705f},
-std::array<float,2>{0.48928085f, 0.655793607f},
-std::array<float,2>{0.738167048f, 0.435106218f},
-std::array<float,2>{0.318870395f, 0.321018219f},
-std::array<float,2>{0.615599573f, 0.519827902f},
-std::array<float,2>{0.241891459f, 0.850160718f},
-std::array<float,2>{0.905414522f, 0.217260048f},
-std::array<float,2>{0.1663564f, 0.466948897f},
-std::array<float,2>{0.99258399f, 0.730312705f},
-std::array<float,2>{0.283810109f, 0.980687022f},
-std::array<float,2>{0.529759943f, 0.00448353495f},
-std::array<float,2>{0.408853859f, 0.147844478f},
-std::array<float,2>{0.653089643f, 0.7986871f},
-std::array<float,2>{0.018661879f, 0.585136294f},
-std::array<float,2>{0.780736864f, 0.277193189f},
-std::array<float,2>{0.146102592f, 0.0268931538f},
-std::array<float,2>{0.955506563f, 0.992345035f},
-std::array<float,2>{0.27077812f, 0.745089948f},
-std::array<float,2>{0.549447358f, 0.450004399f},
-std::array<float,2>{0.378304243f, 0.252592206f},
-std::array<float,2>{0.672545016f, 0.563344896f},
-std::array<float,2>{0.0531755462f, 0.784649968f},
-std::array<float,2>{0.787247121f, 0.135509968f},
-std::array<float,2>{0.0823854953f, 0.418437362f},
-std::array<float,2>{0.857145071f, 0.635513544f},
-std::array<float,2>{0.448091388f, 0.936144769f},
-std::array<float,2>{0.704293728f, 0.0934016332f},
-std::array<float,2>{0.372272402f, 0.190921143f},
-std::array<float,2>{0.585055172f, 0.873485148f},
-std::array<float,2>{0.212318271f, 0.50037992f},
-std::array<float,2>{0.92776531f, 0.329717696f},
-std::array<float,2>{0.00901090074f, 0.179339096f},
-std::array<float,2>{0.765400171f, 0.759871602f},
-std::array<float,2>{0.425833464f, 0.594707251f},
-std::array<float,2>{0.640010953f, 0.292533308f},
-std::array<float,2>{0.301760972f, 0.495147824f},
-std::array<float,2>{0.505243897f, 0.696756303f},
-std::array<float,2>{0.175113201f, 0.937533319f},
-std::array<float,2>{0.975137115f, 0.0545990095f},
-std::array<float,2>{0.227216378f, 0.371239007f},
-std::array<float,2>{0.887042999f, 0.545907915f},
-std::array<float,2>{0.336867332f, 0.819353163f},
-std::array<float,2>{0.607926011f, 0.227156594f},
-std::array<float,2>{0.475569516f, 0.105149999f},
-std::array<float,2>{0.720359027f, 0.889580369f},
-std::array<float,2>{0.114195071f, 0.674701631f},
-std::array<float,2>{0.825855494f, 0.388795078f},
-std::array<float,2>{0.223906592f, 0.170059264f},
-std::array<float,2>{0.878998518f, 0.769569457f},
-std::array<float,2>{0.330961138f, 0.612628043f},
-std::array<float,2>{0.593867779f, 0.303359002f},
-std::array<float,2>{0.482046574f, 0.479165792f},
-std::array<float,2>{0.727388144f, 0.712076247f},
-std::array<float,2>{0.121104501f, 0.955352426f},
-std::array<float,2>{0.819309354f, 0.0318508558f},
-std::array<float,2>{0.00596795138f, 0.353520691f},
-std::array<float,2>{0.753313541f, 0.561697602f},
-std::array<float,2>{0.432536989f, 0.83314991f},
-std::array<float,2>{0.630806327f, 0.245983899f},
-std::array<float,2>{0.310756326f, 0.116267048f},
-std::array<float,2>{0.514113665f, 0.901286602f},
-std::array<float,2>{0.184291914f, 0.660398364f},
-std::array<float,2>{0.981857717f, 0.401583374f},
-std::array<float,2>{0.0932406038f, 0.0025360873f},
-std::array<float,2>{0.846153796f, 0.977122664f},
-std::array<float,2>{0.440381199f, 0.732269049f},
-std::array<float,2>{0.711988151f, 0.463453114f},
-std::array<float,2>{0.365757018f, 0.280657381f},
-std::array<float,2>{0.587100029f, 0.578185558f},
-std::array<float,2>{0.210676759f, 0.80406189f},
-std::array<float,2>{0.931978643f, 0.141814455f},
-std::array<float,2>{0.150472f, 0.432772189f},
-std::array<float,2>{0.962882817f, 0.649247766f},
-std::array<float,2>{0.276040524f, 0.909135103f},
-std::array<float,2>{0.55737555f, 0.0709408969f},
-std::array<float,2>{0.39005205f, 0.212309137f},
-std::array<float,2>{0.686683357f, 0.845733464f},
-std::array<float,2>{0.0576883741f, 0.519031823f},
-std::array<float,2>{0.794758201f, 0.326486796f},
-std::array<float,2>{0.156461596f, 0.0892056078f},
-std::array<float,2>{0.989517331f, 0.930999279f},
-std::array<float,2>{0.291248828f, 0.639362335f},
-std::array<float,2>{0.518308699f, 0.417672902f},
-std::array<float,2>{0.420368135f, 0.333747298f},
-std::array<float,2>{0.641396463f, 0.507458627f},
-std::array<float,2>{0.0269529372f, 0.870968282f},
-std::array<float,2>{0.770376623f, 0.193758458f},
-std::array<float,2>{0.106075205f, 0.446399122f},
-std::array<float,2>{0.828322053f, 0.748153985f},
-std::array<float,2>{0.498910159f, 0.999074697f},
-std::array<float,2>{0.744078994f, 0.0300582889f},
-std::array<float,2>{0.325358272f, 0.139222398f},
-std::array<float,2>{0.623359323f, 0.788942218f},
-std::array<float,2>{0.24338305f, 0.566422045f},
-std::array<float,2>{0.895602167f, 0.257124305f},
-std::array<float,2>{0.0445709415f, 0.231902495f},
-std::array<float,2>{0.799316883f, 0.815738976f},
-std::array<float,2>{0.395734876f, 0.539224446f},
-std::array<float,2>{0.661567867f, 0.369346023f},
-std::array<float,2>{0.254259437f, 0.383377135f},
-std::array<float,2>{0.543032348f, 0.675816715f},
-std::array<float,2>{0.134829536f, 0.884895921f},
-std::array<float,2>{0.940978408f, 0.105530553f},
-std::array<float,2>{0.195139557f, 0.296282053f},
-std::array<float,2>{0.907865047f, 0.600600123f},
-std::array<float,2>{0.356615901f, 0.763301671f},
-std::array<float,2>{0.562595904f, 0.174969494f},
-std::array<float,2>{0.468338877f, 0.0478467047f},
-std::array<float,2>{0.693425357f, 0.945285201f},
-std::array<float,2>{0.0663377345f, 0.700197399f},
-std::array<float,2>{0.872577965f, 0.497879148f},
-std::array<float,2>{0.130779505f, 0.196335346f},
-std::array<float,2>{0.951274753f, 0.866414547f},
-std::array<float,2>{0.262366652f, 0.512285888f},
-std::array<float,2>{0.532458127f, 0.341772676f},
-std::array<float,2>{0.40155077f, 0.40950051f},
-std::array<float,2>{0.671155632f, 0.628919661f},
-std::array<float,2>{0.0345508121f, 0.925632298f},
-std::array<float,2>{0.810515404f, 0.0833867639f},
-std::array<float,2>{0.0715172365f, 0.259088606f},
-std::array<float,2>{0.859478176f, 0.575843871f},
-std::array<float,2>{0.455385506f, 0.793766201f},
-std::array<float,2>{0.696553171f, 0.128085792f},
-std::array<float,2>{0.344982445f, 0.0184862707f},
-std::array<float,2>{0.570726454f, 0.985018015f},
-std::array<float,2>{0.199362054f, 0.735874057f},
-std::array<float,2>{0.915564775f, 0.444467902f},
-std::array<float,2>{0.0208557267f, 0.0970961973f},
-std::array<float,2>{0.773700237f, 0.877412379f},
-std::array<float,2>{0.41345349f, 0.682214379f},
-std::array<float,2>{0.64864856f, 0.377348185f},
-std::array<float,2>{0.285295427f, 0.360797018f},
-std::array<float,2>{0.526504397f, 0.538968503f},
-std::array<float,2>{0.168892249f, 0.821686745f},
-std::array<float,2>{0.998537004f, 0.223132938f},
-std::array<float,2>{0.235473454f, 0.49173227f},
-std::array<float,2>{0.900479257f, 0.690448046f},
-std::array<float,2>{0.315431416f, 0.949447453f},
-std::array<float,2>{0.612044871f, 0.0578884371f},
-std::array<float,2>{0.485211164f, 0.18093957f},
-std::array<float,2>{0.741883039f, 0.752758801f},
-std::array<float,2>{0.0957530364f, 0.605607688f},
-std::array<float,2>{0.838497102f, 0.281746715f},
-std::array<float,2>{0.218255937f, 0.0444934368f},
-std::array<float,2>{0.925428033f, 0.963815212f},
-std::array<float,2>{0.368717164f, 0.710464656f},
-std::array<float,2>{0.580243349f, 0.470825404f},
-std::array<float,2>{0.451117188f, 0.309869826f},
-std::array<float,2>{0.707145035f, 0.623817325f},
-std::array<float,2>{0.0810167864f, 0.781165361f},
-std::array<float,2>{0.851583481f, 0.15669848f},
-std::array<float,2>{0.0475318879f, 0.392523259f},
-std::array<float,2>{0.782519042f, 0.665274501f},
-std::array<float,2>{0.381185859f, 0.892955184f},
-std::array<float,2>{0.677734315f, 0.119325988f},
-std::array<float,2>{0.266899645f, 0.235209361f},
-std::array<float,2>{0.55377537f, 0.840625286f},
-std::array<float,2>{0.142938942f, 0.548337996f},
-std::array<float,2>{0.960276306f, 0.351434648f},
-std::array<float,2>{0.11099153f, 0.154399902f},
-std::array<float,2>{0.821050286f, 0.811086535f},
-std::array<float,2>{0.471742809f, 0.592232347f},
-std::array<float,2>{0.725727558f, 0.27077651f},
-std::array<float,2>{0.34286657f, 0.455464453f},
-std::array<float,2>{0.601707935f, 0.720014453f},
-std::array<float,2>{0.232838139f, 0.97193265f},
-std::array<float,2>{0.884770751f, 0.0123322308f},
-std::array<float,2>{0.178761557f, 0.320125073f},
-std::array<float,2>{0.968967199f, 0.524897814f},
-std::array<float,2>{0.300425172f, 0.856587589f},
-std::array<float,2>{0.5006423f, 0.203472897f},
-std::array<float,2>{0.423278213f, 0.0637221113f},
-std::array<float,2>{0.63371259f, 0.921418846f},
-std::array<float,2>{0.0146221798f, 0.640928745f},
-std::array<float,2>{0.759620309f, 0.429551899f},
-std::array<float,2>{0.14663507f, 0.135215163f},
-std::array<float,2>{0.95383805f, 0.785095036f},
-std::array<float,2>{0.272198021f, 0.562903643f},
-std::array<float,2>{0.548285007f, 0.25196293f},
-std::array<float,2>{0.375874013f, 0.449471414f},
-std::array<float,2>{0.67461288f, 0.74439925f},
-std::array<float,2>{0.0515859686f, 0.993089616f},
-std::array<float,2>{0.786845326f, 0.0265366901f},
-std::array<float,2>{0.0855968893f, 0.329311103f},
-std::array<float,2>{0.859363198f, 0.500580847f},
-std::array<float,2>{0.445769966f, 0.873845041f},
-std::array<float,2>{0.70675689f, 0.190471992f},
-std::array<float,2>{0.373976558f, 0.0930050462f},
-std::array<float,2>{0.582067013f, 0.935946226f},
-std::array<float,2>{0.213396654f, 0.634995639f},
-std::array<float,2>{0.926004887f, 0.41880855f},
-std::array<float,2>{0.0115326261f, 0.0540956743f},
-std::array<float,2>{0.762659907f, 0.938449323f},
-std::array<float,2>{0.428858072f, 0.696829855f},
-std::array<float,2>{0.637515426f, 0.495983303f},
-std::array<float,2>{0.303569287f, 0.292433381f},
-std::array<float,2>{0.507684648f, 0.594121575f},
-std::array<float,2>{0.173122317f, 0.760475874f},
-std::array<float,2>{0.97443217f, 0.178939819f},
-std::array<float,2>{0.228797972f, 0.389309734f},
-std::array<float,2>{0.889847457f, 0.674265563f},
-std::array<float,2>{0.339633256f, 0.889095664f},
-std::array<float,2>{0.606716633f, 0.104587957f},
-std::array<float,2>{0.474339604f, 0.226970866f},
-std::array<float,2>{0.721526921f, 0.820273757f},
-std::array<float,2>{0.11533121f, 0.546547651f},
-std::array<float,2>{0.8276003f, 0.372057259f},
-std::array<float,2>{0.198755413f, 0.111794263f},
-std::array<float,2>{0.919391155f, 0.903352022f},
-std::array<float,2>{0.350337476f, 0.658599436f},
-std::array<float,2>{0.577289581f, 0.40520978f},
-std::array<float,2>{0.458761662f, 0.35738796f},
-std::array<float,2>{0.70193094f, 0.55545795f},
-std::array<float,2>{0.0775075555f, 0.828971684f},
-std::array<float,2>{0.864257753f, 0.247043252f},
-std::array<float,2>{0.0374671146f, 0.480563253f},
-std::array<float,2>{0.807043433f, 0.715537012f},
-std::array<float,2>{0.403290659f, 0.957093716f},
-std::array<float,2>{0.66551578f, 0.0364185162f},
-std::array<float,2>{0.259361625f, 0.1653786f},
-std::array<float,2>{0.536320925f, 0.768798411f},
-std::array<float,2>{0.126377866f, 0.615579069f},
-std::array<float,2>{0.948776186f, 0.300332814f},
-std::array<float,2>{0.0995637625f, 0.217438325f},
-std::array<float,2>{0.842490673f, 0.850004673f},
-std::array<float,2>{0.491301477f, 0.520306766f},
-std::array<float,2>{0.735773742f, 0.320566833f},
-std::array<float,2>{0.316901892f, 0.434973061f},
-std::array<float,2>{0.614745677f, 0.655539215f},
-std::array<float,2>{0.23831743f, 0.91117388f},
-std::array<float,2>{0.902630091f, 0.0780637935f},
-std::array<float,2>{0.165858045f, 0.276696384f},
-std::array<float,2>{0.994378328f, 0.585853636f},
-std::array<float,2>{0.282325536f, 0.797983944f},
-std::array<float,2>{0.529129744f, 0.148434013f},
-std::array<float,2>{0.406826407f, 0.00419801567f},
-std::array<float,2>{0.655802786f, 0.981278241f},
-std::array<float,2>{0.0157481097f, 0.729545832f},
-std::array<float,2>{0.778468788f, 0.467589438f},
-std::array<float,2>{0.248413563f, 0.241309613f},
-std::array<float,2>{0.890634954f, 0.836160481f},
-std::array<float,2>{0.322904259f, 0.551941514f},
-std::array<float,2>{0.618825018f, 0.345587224f},
-std::array<float,2>{0.493558407f, 0.395996332f},
-std::array<float,2>{0.74905163f, 0.670225799f},
-std::array<float,2>{0.103186652f, 0.895772278f},
-std::array<float,2>{0.83416301f, 0.121549845f},
-std::array<float,2>{0.0279540978f, 0.305508882f},
-std::array<float,2>{0.765823543f, 0.619307637f},
-std::array<float,2>{0.414977223f, 0.775913358f},
-std::array<float,2>{0.646655083f, 0.160981879f},
-std::array<float,2>{0.296439081f, 0.0429507121f},
-std::array<float,2>{0.520636082f, 0.966852129f},
-std::array<float,2>{0.160840914f, 0.705816567f},
-std::array<float,2>{0.985155642f, 0.473596752f},
-std::array<float,2>{0.0696337596f, 0.0680261403f},
-std::array<float,2>{0.868136287f, 0.914847791f},
-std::array<float,2>{0.464590967f, 0.644692481f},
-std::array<float,2>{0.690829456f, 0.422693729f},
-std::array<float,2>{0.352577239f, 0.314495474f},
-std::array<float,2>{0.567339242f, 0.529541194f},
-std::array<float,2>{0.189567402f, 0.852737367f},
-std::array<float,2>{0.912427902f, 0.208777696f},
-std::array<float,2>{0.138495252f, 0.459397763f},
-std::array<float,2>{0.942742646f, 0.724785268f},
-std::array<float,2>{0.253543973f, 0.97343123f},
-std::array<float,2>{0.540797353f, 0.00858542323f},
-std::array<float,2>{0.391262621f, 0.15225704f},
-std::array<float,2>{0.657534719f, 0.806980252f},
-std::array<float,2>{0.0393205397f, 0.588819861f},
-std::array<float,2>{0.801266193f, 0.269004464f},
-std::array<float,2>{0.183245927f, 0.0222178996f},
-std::array<float,2>{0.977529526f, 0.990680635f},
-std::array<float,2>{0.306064576f, 0.739372015f},
-std::array<float,2>{0.509496689f, 0.441033542f},
-std::array<float,2>{0.436868638f, 0.264704227f},
-std::array<float,2>{0.628640056f, 0.570781112f},
-std::array<float,2>{0.00277982862f, 0.792769432f},
-std::array<float,2>{0.755557179f, 0.132753655f},
-std::array<float,2>{0.120003261f, 0.41372183f},
-std::array<float,2>{0.81297791f, 0.625342667f},
-std::array<float,2>{0.480190784f, 0.926649451f},
-std::array<float,2>{0.733918488f, 0.0786835402f},
-std::array<float,2>{0.335774183f, 0.201044038f},
-std::array<float,2>{0.599833488f, 0.860459447f},
-std::array<float,2>{0.219160125f, 0.511111617f},
-std::array<float,2>{0.876314104f, 0.339456975f},
-std::array<float,2>{0.0592942834f, 0.187244624f},
-std::array<float,2>{0.792312145f, 0.754040182f},
-std::array<float,2>{0.385181993f, 0.604480088f},
-std::array<float,2>{0.682995617f, 0.286392152f},
-std::array<float,2>{0.277565241f, 0.488256186f},
-std::array<float,2>{0.559441984f, 0.692992747f},
-std::array<float,2>{0.152967334f, 0.94867456f},
-std::array<float,2>{0.96600008f, 0.0616775602f},
-std::array<float,2>{0.204944745f, 0.365920246f},
-std::array<float,2>{0.934904695f, 0.532188356f},
-std::array<float,2>{0.361512959f, 0.827935696f},
-std::array<float,2>{0.590016007f, 0.222460791f},
-std::array<float,2>{0.444544613f, 0.100813203f},
-std::array<float,2>{0.716761112f, 0.882266819f},
-std::array<float,2>{0.0879838318f, 0.686351418f},
-std::array<float,2>{0.848687768f, 0.379419267f},
-std::array<float,2>{0.215309322f, 0.156920522f},
-std::array<float,2>{0.922673762f, 0.780630171f},
-std::array<float,2>{0.370024234f, 0.623377502f},
-std::array<float,2>{0.57904315f, 0.310521454f},
-std::array<float,2>{0.452046156f, 0.471374184f},
-std::array<float,2>{0.709580302f, 0.710179448f},
-std::array<float,2>{0.0793661997f, 0.963046074f},
-std::array<float,2>{0.853717446f, 0.0441474505f},
-std::array<float,2>{0.0494470522f, 0.350724697f},
-std::array<float,2>{0.783736944f, 0.548528194f},
-std::array<float,2>{0.379989952f, 0.840254128f},
-std::array<float,2>{0.679601073f, 0.234826371f},
-std::array<float,2>{0.267678976f, 0.119950429f},
-std::array<float,2>{0.551220715f, 0.893091619f},
-std::array<float,2>{0.141603217f, 0.665702641f},
-std::array<float,2>{0.958629608f, 0.391769767f},
-std::array<float,2>{0.113072209f, 0.01189698f},
-std::array<float,2>{0.822402775f, 0.972621202f},
-std::array<float,2>{0.469809771f, 0.72035265f},
-std::array<float,2>{0.723414719f, 0.455636114f},
-std::array<float,2>{0.340924621f, 0.271109045f},
-std::array<float,2>{0.603781641f, 0.592556059f},
-std::array<float,2>{0.230780408f, 0.810740769f},
-std::array<float,2>{0.883172989f, 0.155050859f},
-std::array<float,2>{0.176130116f, 0.428826272f},
-std::array<float,2>{0.972337782f, 0.641510487f},
-std::array<float,2>{0.297354758f, 0.921269357f},
-std::array<float,2>{0.502963841f, 0.0641910881f},
-std::array<float,2>{0.424337775f, 0.203949109f},
-std::array<float,2>{0.635195255f, 0.857081532f},
-std::array<float,2>{0.0121764839f, 0.525344968f},
-std::array<float,2>{0.761357605f, 0.319632441f},
-std::array<float,2>{0.131432757f, 0.0839558244f},
-std::array<float,2>{0.950856745f, 0.925182164f},
-std::array<float,2>{0.26379469f, 0.629431784f},
-std::array<float,2>{0.534718871f, 0.409881204f},
-std::array<float,2>{0.398821861f, 0.341074318f},
-std::array<float,2>{0.669542789f, 0.511924148f},
-std::array<float,2>{0.0321197249f, 0.866854966f},
-std::array<float,2>{0.810613155f, 0.197044984f},
-std::array<float,2>{0.0729898289f, 0.445189714f},
-std::array<float,2>{0.861816108f, 0.735767782f},
-std::array<float,2>{0.454906791f, 0.984404624f},
-std::array<float,2>{0.697352648f, 0.0178374629f},
-std::array<float,2>{0.347499043f, 0.12846601f},
-std::array<float,2>{0.573215127f, 0.793021321f},
-std::array<float,2>{0.201871291f, 0.575434685f},
-std::array<float,2>{0.917596996f, 0.259540588f},
-std::array<float,2>{0.021663025f, 0.22352615f},
-std::array<float,2>{0.776494384f, 0.821880698f},
-std::array<float,2>{0.411172301f, 0.538244843f},
-std::array<float,2>{0.652237475f, 0.360993892f},
-std::array<float,2>{0.288121194f, 0.377774984f},
-std::array<float,2>{0.525087237f, 0.681880176f},
-std::array<float,2>{0.170309141f, 0.877535701f},
-std::array<float,2>{0.997714579f, 0.0973051041f},
-std::array<float,2>{0.237302095f, 0.28148067f},
-std::array<float,2>{0.900154173f, 0.606193542f},
-std::array<float,2>{0.313026965f, 0.752389073f},
-std::array<float,2>{0.611282587f, 0.181271911f},
-std::array<float,2>{0.48660183f, 0.0583537221f},
-std::array<float,2>{0.738898098f, 0.949839294f},
-std::array<float,2>{0.0947333053f, 0.691037953f},
-std::array<float,2>{0.836414039f, 0.491433769f},
-std::array<float,2>{0.158241332f, 0.193904012f},
-std::array<float,2>{0.991346538f, 0.870253325f},
-std::array<float,2>{0.289641738f, 0.506860614f},
-std::array<float,2>{0.516114295f, 0.33338353f},
-std::array<float,2>{0.418020576f, 0.417170882f},
-std::array<float,2>{0.643450379f, 0.638718247f},
-std::array<float,2>{0.0243467372f, 0.931349874f},
-std::array<float,2>{0.772690833f, 0.0895693451f},
-std::array<float,2>{0.109266184f, 0.257337421f},
-std::array<float,2>{0.830372691f, 0.567194641f},
-std::array<float,2>{0.497381181f, 0.788380384f},
-std::array<float,2>{0.745827436f, 0.139124438f},
-std::array<float,2>{0.327769548f, 0.0295100752f},
-std::array<float,2>{0.621741772f, 0.999543011f},
-std::array<float,2>{0.244660601f, 0.748707652f},
-std::array<float,2>{0.897584677f, 0.447147429f},
-std::array<float,2>{0.0465150662f, 0.106284775f},
-std::array<float,2>{0.79797411f, 0.885418355f},
-std::array<float,2>{0.397332698f, 0.676496327f},
-std::array<float,2>{0.662558973f, 0.382873863f},
-std::array<float,2>{0.256033003f, 0.36978662f},
-std::array<float,2>{0.54596597f, 0.540010929f},
-std::array<float,2>{0.133916155f, 0.816062272f},
-std::array<float,2>{0.939300656f, 0.232124105f},
-std::array<float,2>{0.192025304f, 0.497552186f},
-std::array<float,2>{0.908533871f, 0.701026857f},
-std::array<float,2>{0.357708603f, 0.944684505f},
-std::array<float,2>{0.565559089f, 0.0469011925f},
-std::array<float,2>{0.465211034f, 0.175495535f},
-std::array<float,2>{0.693155885f, 0.762974262f},
-std::array<float,2>{0.0627989322f, 0.60127753f},
-std::array<float,2>{0.873224616f, 0.296752989f},
-std::array<float,2>{0.225697696f, 0.0312768966f},
-std::array<float,2>{0.88202709f, 0.95603466f},
-std::array<float,2>{0.328620434f, 0.712440372f},
-std::array<float,2>{0.597621381f, 0.478926182f},
-std::array<float,2>{0.483009011f, 0.30291754f},
-std::array<float,2>{0.729092777f, 0.61321944f},
-std::array<float,2>{0.124371856f, 0.77011466f},
-std::array<float,2>{0.817031324f, 0.170781583f},
-std::array<float,2>{0.00531013403f, 0.402256519f},
-std::array<float,2>{0.751880467f, 0.660913825f},
-std::array<float,2>{0.431410909f, 0.900553405f},
-std::array<float,2>{0.632336199f, 0.116892688f},
-std::array<float,2>{0.309200704f, 0.245195448f},
-std::array<float,2>{0.512615561f, 0.833860278f},
-std::array<float,2>{0.186360732f, 0.562451839f},
-std::array<float,2>{0.983710945f, 0.354257941f},
-std::array<float,2>{0.0909846127f, 0.142122015f},
-std::array<float,2>{0.844802022f, 0.804609716f},
-std::array<float,2>{0.439051211f, 0.578677952f},
-std::array<float,2>{0.714611232f, 0.280987263f},
-std::array<float,2>{0.364410818f, 0.462924868f},
-std::array<float,2>{0.589174211f, 0.731502235f},
-std::array<float,2>{0.208236217f, 0.976977706f},
-std::array<float,2>{0.930337787f, 0.00216100225f},
-std::array<float,2>{0.148934141f, 0.326981276f},
-std::array<float,2>{0.964031339f, 0.519428432f},
-std::array<float,2>{0.274011433f, 0.846386552f},
-std::array<float,2>{0.554787934f, 0.212741643f},
-std::array<float,2>{0.387309909f, 0.0708002299f},
-std::array<float,2>{0.68412447f, 0.908664167f},
-std::array<float,2>{0.055773709f, 0.64844501f},
-std::array<float,2>{0.794943333f, 0.433219552f},
-std::array<float,2>{0.175657347f, 0.17713435f},
-std::array<float,2>{0.974700689f, 0.759185016f},
-std::array<float,2>{0.30250603f, 0.595851183f},
-std::array<float,2>{0.505688548f, 0.289711446f},
-std::array<float,2>{0.426430553f, 0.49258849f},
-std::array<float,2>{0.640180945f, 0.698140442f},
-std::array<float,2>{0.00973074883f, 0.940143287f},
-std::array<float,2>{0.765109718f, 0.0527213104f},
-std::array<float,2>{0.113717973f, 0.373520911f},
-std::array<float,2>{0.825402558f, 0.544581592f},
-std::array<float,2>{0.474849194f, 0.817745984f},
-std::array<float,2>{0.719856501f, 0.228720516f},
-std::array<float,2>{0.33634451f, 0.10252478f},
-std::array<float,2>{0.607874215f, 0.88797009f},
-std::array<float,2>{0.227001011f, 0.673437655f},
-std::array<float,2>{0.887220383f, 0.388323575f},
-std::array<float,2>{0.053633865f, 0.0240497161f},
-std::array<float,2>{0.787778735f, 0.995376229f},
-std::array<float,2>{0.378817797f, 0.743138194f},
-std::array<float,2>{0.672096312f, 0.452049315f},
-std::array<float,2>{0.271384656f, 0.250615567f},
-std::array<float,2>{0.549263954f, 0.564947248f},
-std::array<float,2>{0.145853281f, 0.782852352f},
-std::array<float,2>{0.955915213f, 0.13355121f},
-std::array<float,2>{0.212760493f, 0.421215355f},
-std::array<float,2>{0.928233147f, 0.633036077f},
-std::array<float,2>{0.372897834f, 0.934062004f},
-std::array<float,2>{0.585590065f, 0.0902474225f},
-std::array<float,2>{0.447475404f, 0.188729152f},
-std::array<float,2>{0.70473969f, 0.871957302f},
-std::array<float,2>{0.0825924948f, 0.502835691f},
-std::array<float,2>{0.856628954f, 0.331670851f},
-std::array<float,2>{0.241466731f, 0.0755835399f},
-std::array<float,2>{0.906197667f, 0.914053857f},
-std::array<float,2>{0.318826914f, 0.653016567f},
-std::array<float,2>{0.615886748f, 0.435858071f},
-std::array<float,2>{0.490125f, 0.322962493f},
-std::array<float,2>{0.73749584f, 0.52166003f},
-std::array<float,2>{0.100857884f, 0.847945035f},
-std::array<float,2>{0.840636432f, 0.215114862f},
-std::array<float,2>{0.0192270968f, 0.466432512f},
-std::array<float,2>{0.78094703f, 0.727966845f},
-std::array<float,2>{0.408601254f, 0.983805656f},
-std::array<float,2>{0.652515531f, 0.00767954532f},
-std::array<float,2>{0.283239961f, 0.145675242f},
-std::array<float,2>{0.530004621f, 0.79928875f},
-std::array<float,2>{0.16690664f, 0.583076f},
-std::array<float,2>{0.992732584f, 0.273977041f},
-std::array<float,2>{0.0759029388f, 0.248708725f},
-std::array<float,2>{0.865743279f, 0.831232905f},
-std::array<float,2>{0.460355937f, 0.557977796f},
-std::array<float,2>{0.6999138f, 0.358977854f},
-std::array<float,2>{0.347809434f, 0.403452486f},
-std::array<float,2>{0.575166285f, 0.656520247f},
-std::array<float,2>{0.196302101f, 0.905311167f},
-std::array<float,2>{0.921009779f, 0.110738792f},
-std::array<float,2>{0.127213717f, 0.297403961f},
-std::array<float,2>{0.946816146f, 0.613530278f},
-std::array<float,2>{0.260724574f, 0.765788794f},
-std::array<float,2>{0.537469208f, 0.166861251f},
-std::array<float,2>{0.406191707f, 0.038705036f},
-std::array<float,2>{0.667056441f, 0.960123122f},
-std::array<float,2>{0.0359903648f, 0.718667805f},
-std::array<float,2>{0.805325925f, 0.482586682f},
-std::array<float,2>{0.187656373f, 0.210653171f},
-std::array<float,2>{0.91150564f, 0.854892612f},
-std::array<float,2>{0.355338395f, 0.52906543f},
-std::array<float,2>{0.568638623f, 0.313216597f},
-std::array<float,2>{0.462726533f, 0.425177634f},
-std::array<float,2>{0.688487411f, 0.64805311f},
-std::array<float,2>{0.0667561814f, 0.917761326f},
-std::array<float,2>{0.870315194f, 0.0693953112f},
-std::array<float,2>{0.0420175046f, 0.266994953f},
-std::array<float,2>{0.804272532f, 0.586471438f},
-std::array<float,2>{0.39368692f, 0.806187928f},
-std::array<float,2>{0.658509791f, 0.149566457f},
-std::array<float,2>{0.251184225f, 0.00997996051f},
-std::array<float,2>{0.541105688f, 0.97611779f},
-std::array<float,2>{0.139111489f, 0.723518014f},
-std::array<float,2>{0.944624364f, 0.458632499f},
-std::array<float,2>{0.104802638f, 0.1231713f},
-std::array<float,2>{0.832117915f, 0.897961974f},
-std::array<float,2>{0.495645642f, 0.668770134f},
-std::array<float,2>{0.747950077f, 0.398187816f},
-std::array<float,2>{0.320654452f, 0.347594619f},
-std::array<float,2>{0.619635224f, 0.554545462f},
-std::array<float,2>{0.247852251f, 0.838952482f},
-std::array<float,2>{0.893398464f, 0.239361987f},
-std::array<float,2>{0.163216054f, 0.476327151f},
-std::array<float,2>{0.986409187f, 0.704782367f},
-std::array<float,2>{0.294105977f, 0.966048121f},
-std::array<float,2>{0.522949517f, 0.0407544374f},
-std::array<float,2>{0.417740852f, 0.16249226f},
-std::array<float,2>{0.644606411f, 0.774373889f},
-std::array<float,2>{0.0306068789f, 0.618413031f},
-std::array<float,2>{0.768360972f, 0.308407336f},
-std::array<float,2>{0.155059531f, 0.058807563f},
-std::array<float,2>{0.967905462f, 0.945475221f},
-std::array<float,2>{0.279662162f, 0.694535315f},
-std::array<float,2>{0.560682595f, 0.484796405f},
-std::array<float,2>{0.383452058f, 0.288056731f},
-std::array<float,2>{0.680193782f, 0.603300571f},
-std::array<float,2>{0.0614155941f, 0.757329106f},
-std::array<float,2>{0.790399849f, 0.183964968f},
-std::array<float,2>{0.0874844268f, 0.382749707f},
-std::array<float,2>{0.850657046f, 0.684336364f},
-std::array<float,2>{0.443244338f, 0.880579591f},
-std::array<float,2>{0.716859341f, 0.0978588015f},
-std::array<float,2>{0.36119774f, 0.219287768f},
-std::array<float,2>{0.592394292f, 0.826138973f},
-std::array<float,2>{0.206613392f, 0.534775972f},
-std::array<float,2>{0.936651051f, 0.363436699f},
-std::array<float,2>{0.000577375176f, 0.130190387f},
-std::array<float,2>{0.756568193f, 0.790346384f},
-std::array<float,2>{0.433821917f, 0.573734045f},
-std::array<float,2>{0.625157952f, 0.26282689f},
-std::array<float,2>{0.308314383f, 0.439259648f},
-std::array<float,2>{0.511039972f, 0.742008626f},
-std::array<float,2>{0.179990157f, 0.989652634f},
-std::array<float,2>{0.979441643f, 0.0206749327f},
-std::array<float,2>{0.222200796f, 0.33638826f},
-std::array<float,2>{0.877991736f, 0.508592248f},
-std::array<float,2>{0.332799077f, 0.863238037f},
-std::array<float,2>{0.598083854f, 0.20119749f},
-std::array<float,2>{0.476660728f, 0.0800834671f},
-std::array<float,2>{0.730907679f, 0.929542661f},
-std::array<float,2>{0.11743632f, 0.627502978f},
-std::array<float,2>{0.816168606f, 0.410338193f},
-std::array<float,2>{0.233290255f, 0.153617829f},
-std::array<float,2>{0.885546923f, 0.810095847f},
-std::array<float,2>{0.343414336f, 0.590124726f},
-std::array<float,2>{0.602352321f, 0.27200827f},
-std::array<float,2>{0.472281635f, 0.453784585f},
-std::array<float,2>{0.72621578f, 0.721495032f},
-std::array<float,2>{0.110477425f, 0.969615698f},
-std::array<float,2>{0.820523322f, 0.0151029434f},
-std::array<float,2>{0.0139795672f, 0.317031384f},
-std::array<float,2>{0.759111524f, 0.52711463f},
-std::array<float,2>{0.42343384f, 0.859302342f},
-std::array<float,2>{0.632887721f, 0.205884367f},
-std::array<float,2>{0.300142556f, 0.0648946092f},
-std::array<float,2>{0.500283718f, 0.918257594f},
-std::array<float,2>{0.179327458f, 0.643462658f},
-std::array<float,2>{0.969539464f, 0.426377356f},
-std::array<float,2>{0.0800939277f, 0.0466558747f},
-std::array<float,2>{0.852243364f, 0.960961282f},
-std::array<float,2>{0.450611979f, 0.708039045f},
-std::array<float,2>{0.707521498f, 0.469176263f},
-std::array<float,2>{0.368272096f, 0.312437564f},
-std::array<float,2>{0.580606282f, 0.622144103f},
-std::array<float,2>{0.218740925f, 0.778254628f},
-std::array<float,2>{0.925136387f, 0.160023063f},
-std::array<float,2>{0.143395245f, 0.394322842f},
-std::array<float,2>{0.96066165f, 0.66664052f},
-std::array<float,2>{0.267221957f, 0.891713619f},
-std::array<float,2>{0.554498792f, 0.117991775f},
-std::array<float,2>{0.381480902f, 0.236359715f},
-std::array<float,2>{0.67722106f, 0.84366256f},
-std::array<float,2>{0.0470279865f, 0.550429285f},
-std::array<float,2>{0.782966912f, 0.348305166f},
-std::array<float,2>{0.168296993f, 0.0955199376f},
-std::array<float,2>{0.998227835f, 0.876053512f},
-std::array<float,2>{0.285984874f, 0.679758132f},
-std::array<float,2>{0.526977777f, 0.376791984f},
-std::array<float,2>{0.413892657f, 0.361494899f},
-std::array<float,2>{0.649017155f, 0.53644675f},
-std::array<float,2>{0.0210997574f, 0.822583437f},
-std::array<float,2>{0.774021864f, 0.225001991f},
-std::array<float,2>{0.0965754464f, 0.490040123f},
-std::array<float,2>{0.838090539f, 0.688048542f},
-std::array<float,2>{0.484647512f, 0.951704919f},
-std::array<float,2>{0.741319954f, 0.0547735654f},
-std::array<float,2>{0.31614238f, 0.18200238f},
-std::array<float,2>{0.61140728f, 0.751315713f},
-std::array<float,2>{0.236221969f, 0.609055281f},
-std::array<float,2>{0.90119493f, 0.283380628f},
-std::array<float,2>{0.0350044556f, 0.197809994f},
-std::array<float,2>{0.809612572f, 0.865123808f},
-std::array<float,2>{0.402089119f, 0.513964772f},
-std::array<float,2>{0.671576738f, 0.342296422f},
-std::array<float,2>{0.26214698f, 0.406940848f},
-std::array<float,2>{0.532938957f, 0.631450593f},
-std::array<float,2>{0.130199f, 0.923227608f},
-std::array<float,2>{0.952091813f, 0.0851274282f},
-std::array<float,2>{0.199745357f, 0.261618316f},
-std::array<float,2>{0.915194333f, 0.576288044f},
-std::array<float,2>{0.345540583f, 0.79619813f},
-std::array<float,2>{0.570985794f, 0.125736654f},
-std::array<float,2>{0.455664694f, 0.0156838391f},
-std::array<float,2>{0.697039068f, 0.987877727f},
-std::array<float,2>{0.0722445846f, 0.737007082f},
-std::array<float,2>{0.860087037f, 0.441703916f},
-std::array<float,2>{0.135571048f, 0.234324306f},
-std::array<float,2>{0.940538466f, 0.81254214f},
-std::array<float,2>{0.254719704f, 0.542009234f},
-std::array<float,2>{0.5435794f, 0.367939949f},
-std::array<float,2>{0.396275401f, 0.385459751f},
-std::array<float,2>{0.662023664f, 0.679444015f},
-std::array<float,2>{0.0442408919f, 0.883059025f},
-std::array<float,2>{0.798933566f, 0.108785413f},
-std::array<float,2>{0.0656641275f, 0.293218791f},
-std::array<float,2>{0.872475147f, 0.598348081f},
-std::array<float,2>{0.468069166f, 0.76451093f},
-std::array<float,2>{0.694308877f, 0.173277259f},
-std::array<float,2>{0.35698247f, 0.0502986908f},
-std::array<float,2>{0.563126564f, 0.941788137f},
-std::array<float,2>{0.194678709f, 0.702613533f},
-std::array<float,2>{0.907340229f, 0.49919945f},
-std::array<float,2>{0.0265056882f, 0.0875111371f},
-std::array<float,2>{0.769699633f, 0.932546079f},
-std::array<float,2>{0.420727909f, 0.636847615f},
-std::array<float,2>{0.640893698f, 0.415612221f},
-std::array<float,2>{0.29198575f, 0.334008098f},
-std::array<float,2>{0.517788589f, 0.504796624f},
-std::array<float,2>{0.157110259f, 0.868030071f},
-std::array<float,2>{0.990170658f, 0.191537455f},
-std::array<float,2>{0.243897513f, 0.447894275f},
-std::array<float,2>{0.896113515f, 0.746905923f},
-std::array<float,2>{0.325969726f, 0.998002052f},
-std::array<float,2>{0.623797715f, 0.0287994072f},
-std::array<float,2>{0.498499393f, 0.13825728f},
-std::array<float,2>{0.743165433f, 0.785456777f},
-std::array<float,2>{0.105788305f, 0.569508255f},
-std::array<float,2>{0.829008222f, 0.255451053f},
-std::array<float,2>{0.210072145f, 0.000898870523f},
-std::array<float,2>{0.932147026f, 0.979420364f},
-std::array<float,2>{0.365394324f, 0.734130263f},
-std::array<float,2>{0.587730706f, 0.461043686f},
-std::array<float,2>{0.439710289f, 0.278438479f},
-std::array<float,2>{0.712611854f, 0.581116259f},
-std::array<float,2>{0.0937226862f, 0.800880432f},
-std::array<float,2>{0.846590757f, 0.144361958f},
-std::array<float,2>{0.0581503585f, 0.431280732f},
-std::array<float,2>{0.794047058f, 0.651277304f},
-std::array<float,2>{0.390335202f, 0.907497525f},
-std::array<float,2>{0.687061787f, 0.0725097358f},
-std::array<float,2>{0.275822252f, 0.2137869f},
-std::array<float,2>{0.556687653f, 0.844355345f},
-std::array<float,2>{0.15134424f, 0.516812742f},
-std::array<float,2>{0.962040603f, 0.326063812f},
-std::array<float,2>{0.122038543f, 0.168507695f},
-std::array<float,2>{0.818719208f, 0.773166001f},
-std::array<float,2>{0.481847376f, 0.610620141f},
-std::array<float,2>{0.726866603f, 0.302127212f},
-std::array<float,2>{0.330269545f, 0.477071196f},
-std::array<float,2>{0.59470135f, 0.714821815f},
-std::array<float,2>{0.224268571f, 0.954869986f},
-std::array<float,2>{0.879489541f, 0.0335868895f},
-std::array<float,2>{0.183707356f, 0.352609515f},
-std::array<float,2>{0.982066214f, 0.559945226f},
-std::array<float,2>{0.311398953f, 0.835281074f},
-std::array<float,2>{0.514522076f, 0.243126735f},
-std::array<float,2>{0.431685537f, 0.114746556f},
-std::array<float,2>{0.63032186f, 0.900376797f},
-std::array<float,2>{0.0064413785f, 0.663463473f},
-std::array<float,2>{0.753778875f, 0.399888724f},
-std::array<float,2>{0.12595351f, 0.167099327f},
-std::array<float,2>{0.947431386f, 0.767526507f},
-std::array<float,2>{0.258604944f, 0.614445329f},
-std::array<float,2>{0.535573781f, 0.298549354f},
-std::array<float,2>{0.403416276f, 0.484184265f},
-std::array<float,2>{0.664250195f, 0.716879308f},
-std::array<float,2>{0.0389573015f, 0.959680259f},
-std::array<float,2>{0.808439195f, 0.0375299752f},
-std::array<float,2>{0.0762165785f, 0.357771069f},
-std::array<float,2>{0.865118682f, 0.556875229f},
-std::array<float,2>{0.457649916f, 0.830563426f},
-std::array<float,2>{0.702518344f, 0.249337688f},
-std::array<float,2>{0.351178706f, 0.110202953f},
-std::array<float,2>{0.577035427f, 0.904702008f},
-std::array<float,2>{0.197839379f, 0.657557726f},
-std::array<float,2>{0.918854892f, 0.402378827f},
-std::array<float,2>{0.0171464272f, 0.00616600411f},
-std::array<float,2>{0.777689099f, 0.982827544f},
-std::array<float,2>{0.408049554f, 0.727370322f},
-std::array<float,2>{0.654790938f, 0.464901626f},
-std::array<float,2>{0.282193214f, 0.27468729f},
-std::array<float,2>{0.527613163f, 0.58294946f},
-std::array<float,2>{0.164322495f, 0.800565422f},
-std::array<float,2>{0.995952189f, 0.145066693f},
-std::array<float,2>{0.240205407f, 0.436869264f},
-std::array<float,2>{0.903956294f, 0.653384328f},
-std::array<float,2>{0.317641705f, 0.91297096f},
-std::array<float,2>{0.613869727f, 0.0746809244f},
-std::array<float,2>{0.491048694f, 0.216493919f},
-std::array<float,2>{0.734826028f, 0.849147439f},
-std::array<float,2>{0.0983155593f, 0.522713661f},
-std::array<float,2>{0.843067288f, 0.324123651f},
-std::array<float,2>{0.214642882f, 0.0914290696f},
-std::array<float,2>{0.927200556f, 0.934761465f},
-std::array<float,2>{0.374131978f, 0.634333193f},
-std::array<float,2>{0.583304822f, 0.420135081f},
-std::array<float,2>{0.446780235f, 0.330866963f},
-std::array<float,2>{0.705932677f, 0.50342536f},
-std::array<float,2>{0.0843205526f, 0.872808516f},
-std::array<float,2>{0.857735515f, 0.188415512f},
-std::array<float,2>{0.0525142588f, 0.452150315f},
-std::array<float,2>{0.785763562f, 0.743676007f},
-std::array<float,2>{0.376781911f, 0.994684577f},
-std::array<float,2>{0.675055087f, 0.0247565433f},
-std::array<float,2>{0.273409903f, 0.134174317f},
-std::array<float,2>{0.547008336f, 0.781972229f},
-std::array<float,2>{0.148117766f, 0.565624654f},
-std::array<float,2>{0.954762578f, 0.251686484f},
-std::array<float,2>{0.116778813f, 0.230082378f},
-std::array<float,2>{0.8271451f, 0.817344785f},
-std::array<float,2>{0.473285288f, 0.543325782f},
-std::array<float,2>{0.722253323f, 0.374914676f},
-std::array<float,2>{0.338507026f, 0.387212247f},
-std::array<float,2>{0.60629636f, 0.672684312f},
-std::array<float,2>{0.229721919f, 0.886784792f},
-std::array<float,2>{0.88929522f, 0.103018604f},
-std::array<float,2>{0.17277579f, 0.290578961f},
-std::array<float,2>{0.973247111f, 0.596935272f},
-std::array<float,2>{0.303970993f, 0.758333683f},
-std::array<float,2>{0.506007433f, 0.175996184f},
-std::array<float,2>{0.42849642f, 0.0515255742f},
-std::array<float,2>{0.638094246f, 0.940545022f},
-std::array<float,2>{0.0105574084f, 0.699112594f},
-std::array<float,2>{0.762860179f, 0.493182093f},
-std::array<float,2>{0.220566347f, 0.202987656f},
-std::array<float,2>{0.875068843f, 0.862056315f},
-std::array<float,2>{0.334454596f, 0.509500504f},
-std::array<float,2>{0.601165235f, 0.337259799f},
-std::array<float,2>{0.478763133f, 0.411178887f},
-std::array<float,2>{0.733304441f, 0.628735602f},
-std::array<float,2>{0.120194219f, 0.928010762f},
-std::array<float,2>{0.814039171f, 0.0810557082f},
-std::array<float,2>{0.00345238484f, 0.26188603f},
-std::array<float,2>{0.754513502f, 0.572893918f},
-std::array<float,2>{0.435655743f, 0.789569199f},
-std::array<float,2>{0.627925992f, 0.129181847f},
-std::array<float,2>{0.305492073f, 0.0199324414f},
-std::array<float,2>{0.508594036f, 0.988661289f},
-std::array<float,2>{0.181751445f, 0.740272224f},
-std::array<float,2>{0.977697194f, 0.437636346f},
-std::array<float,2>{0.0894413963f, 0.0988116786f},
-std::array<float,2>{0.848295093f, 0.879548669f},
-std::array<float,2>{0.443547666f, 0.68537128f},
-std::array<float,2>{0.714928806f, 0.380975097f},
-std::array<float,2>{0.362943918f, 0.365056247f},
-std::array<float,2>{0.591117561f, 0.533329248f},
-std::array<float,2>{0.20339638f, 0.825057864f},
-std::array<float,2>{0.934336543f, 0.220473126f},
-std::array<float,2>{0.154151335f, 0.48561278f},
-std::array<float,2>{0.965051115f, 0.693697751f},
-std::array<float,2>{0.278817147f, 0.946376801f},
-std::array<float,2>{0.560186863f, 0.0603935793f},
-std::array<float,2>{0.386392593f, 0.185268193f},
-std::array<float,2>{0.682117283f, 0.756127775f},
-std::array<float,2>{0.0604582466f, 0.601585269f},
-std::array<float,2>{0.79135257f, 0.288431525f},
-std::array<float,2>{0.162035078f, 0.0394469798f},
-std::array<float,2>{0.986012578f, 0.965804994f},
-std::array<float,2>{0.294959277f, 0.703470707f},
-std::array<float,2>{0.52003336f, 0.475511938f},
-std::array<float,2>{0.415573359f, 0.307533979f},
-std::array<float,2>{0.647814929f, 0.617242813f},
-std::array<float,2>{0.0290125925f, 0.775314748f},
-std::array<float,2>{0.766689122f, 0.163631886f},
-std::array<float,2>{0.102002122f, 0.396841317f},
-std::array<float,2>{0.835164249f, 0.669812799f},
-std::array<float,2>{0.492455751f, 0.897061229f},
-std::array<float,2>{0.748556137f, 0.124214537f},
-std::array<float,2>{0.32367f, 0.238613531f},
-std::array<float,2>{0.617512405f, 0.838392138f},
-std::array<float,2>{0.249641314f, 0.552769065f},
-std::array<float,2>{0.892412186f, 0.346672326f},
-std::array<float,2>{0.0405605882f, 0.148621947f},
-std::array<float,2>{0.802506983f, 0.805598497f},
-std::array<float,2>{0.392286628f, 0.587749958f},
-std::array<float,2>{0.65690887f, 0.266332746f},
-std::array<float,2>{0.252171218f, 0.457382858f},
-std::array<float,2>{0.539991438f, 0.724464417f},
-std::array<float,2>{0.137213588f, 0.975005507f},
-std::array<float,2>{0.942308962f, 0.0110746305f},
-std::array<float,2>{0.190504298f, 0.314023793f},
-std::array<float,2>{0.913935363f, 0.527908921f},
-std::array<float,2>{0.351793885f, 0.854295611f},
-std::array<float,2>{0.567946136f, 0.209840029f},
-std::array<float,2>{0.463858753f, 0.0688049793f},
-std::array<float,2>{0.689844012f, 0.916604936f},
-std::array<float,2>{0.0686633587f, 0.647145271f},
-std::array<float,2>{0.868660688f, 0.424239367f},
-std::array<float,2>{0.202647954f, 0.12613143f},
-std::array<float,2>{0.916145384f, 0.795091093f},
-std::array<float,2>{0.346462399f, 0.577710271f},
-std::array<float,2>{0.573605061f, 0.260290325f},
-std::array<float,2>{0.453178436f, 0.443183899f},
-std::array<float,2>{0.698726475f, 0.737973034f},
-std::array<float,2>{0.0740786642f, 0.987072289f},
-std::array<float,2>{0.863278449f, 0.0167031921f},
-std::array<float,2>{0.0327669457f, 0.343131244f},
-std::array<float,2>{0.811867297f, 0.514761031f},
-std::array<float,2>{0.399917215f, 0.863587201f},
-std::array<float,2>{0.668921471f, 0.199065983f},
-std::array<float,2>{0.265176237f, 0.0845683068f},
-std::array<float,2>{0.533354282f, 0.922438562f},
-std::array<float,2>{0.131982312f, 0.632535279f},
-std::array<float,2>{0.949659944f, 0.407267064f},
-std::array<float,2>{0.0944583192f, 0.0560740456f},
-std::array<float,2>{0.8370049f, 0.952531397f},
-std::array<float,2>{0.48817572f, 0.689240813f},
-std::array<float,2>{0.739764154f, 0.489024132f},
-std::array<float,2>{0.313843608f, 0.284351557f},
-std::array<float,2>{0.609523952f, 0.607535303f},
-std::array<float,2>{0.238057494f, 0.750319779f},
-std::array<float,2>{0.898782134f, 0.183322355f},
-std::array<float,2>{0.171136215f, 0.375333428f},
-std::array<float,2>{0.996175706f, 0.681521893f},
-std::array<float,2>{0.287723482f, 0.875109494f},
-std::array<float,2>{0.52422142f, 0.0944017619f},
-std::array<float,2>{0.411030591f, 0.225786179f},
-std::array<float,2>{0.650427163f, 0.824203014f},
-std::array<float,2>{0.0225584824f, 0.535612643f},
-std::array<float,2>{0.776264369f, 0.362373292f},
-std::array<float,2>{0.141283944f, 0.118971944f},
-std::array<float,2>{0.957635224f, 0.890821993f},
-std::array<float,2>{0.26937151f, 0.66784358f},
-std::array<float,2>{0.551927865f, 0.392722517f},
-std::array<float,2>{0.379039407f, 0.349565536f},
-std::array<float,2>{0.678394258f, 0.549280703f},
-std::array<float,2>{0.0504246876f, 0.842395484f},
-std::array<float,2>{0.784949243f, 0.237801328f},
-std::array<float,2>{0.0784909129f, 0.470643699f},
-std::array<float,2>{0.854662836f, 0.707243562f},
-std::array<float,2>{0.452293694f, 0.962767959f},
-std::array<float,2>{0.710220337f, 0.0457600914f},
-std::array<float,2>{0.370163888f, 0.158770055f},
-std::array<float,2>{0.579601645f, 0.778386712f},
-std::array<float,2>{0.216292664f, 0.621206522f},
-std::array<float,2>{0.923706353f, 0.310993761f},
-std::array<float,2>{0.0133311637f, 0.206297606f},
-std::array<float,2>{0.760087609f, 0.858305573f},
-std::array<float,2>{0.424869657f, 0.525582135f},
-std::array<float,2>{0.635820687f, 0.318108171f},
-std::array<float,2>{0.298748314f, 0.426841259f},
-std::array<float,2>{0.502406836f, 0.643832028f},
-std::array<float,2>{0.177370369f, 0.918965459f},
-std::array<float,2>{0.971406519f, 0.0657047704f},
-std::array<float,2>{0.231996298f, 0.273274332f},
-std::array<float,2>{0.884325981f, 0.591638863f},
-std::array<float,2>{0.340735704f, 0.809048653f},
-std::array<float,2>{0.604679585f, 0.153311744f},
-std::array<float,2>{0.468860745f, 0.0146326916f},
-std::array<float,2>{0.724446654f, 0.969739318f},
-std::array<float,2>{0.111627869f, 0.722542226f},
-std::array<float,2>{0.823529959f, 0.454884887f},
-std::array<float,2>{0.187330604f, 0.243656904f},
-std::array<float,2>{0.982895434f, 0.8349545f},
-std::array<float,2>{0.309786409f, 0.55953002f},
-std::array<float,2>{0.51289469f, 0.351700425f},
-std::array<float,2>{0.43057555f, 0.398859918f},
-std::array<float,2>{0.631113827f, 0.662530839f},
-std::array<float,2>{0.00480948854f, 0.898729444f},
-std::array<float,2>{0.750001311f, 0.114011981f},
-std::array<float,2>{0.123219758f, 0.301176608f},
-std::array<float,2>{0.817926705f, 0.610106826f},
-std::array<float,2>{0.483761221f, 0.771624207f},
-std::array<float,2>{0.729826033f, 0.169277087f},
-std::array<float,2>{0.33003372f, 0.0344847068f},
-std::array<float,2>{0.595788538f, 0.953736722f},
-std::array<float,2>{0.22503674f, 0.71354425f},
-std::array<float,2>{0.88114363f, 0.477775216f},
-std::array<float,2>{0.0552788004f, 0.0733933449f},
-std::array<float,2>{0.796789289f, 0.906399488f},
-std::array<float,2>{0.388596982f, 0.652187824f},
-std::array<float,2>{0.685395241f, 0.429712296f},
-std::array<float,2>{0.275104046f, 0.325030982f},
-std::array<float,2>{0.556063652f, 0.516499758f},
-std::array<float,2>{0.149905547f, 0.845102906f},
-std::array<float,2>{0.96374619f, 0.214810327f},
-std::array<float,2>{0.207485393f, 0.462691694f},
-std::array<float,2>{0.931030393f, 0.733054638f},
-std::array<float,2>{0.363850713f, 0.980223f},
-std::array<float,2>{0.587973893f, 0.0015625935f},
-std::array<float,2>{0.438201576f, 0.142772391f},
-std::array<float,2>{0.712977409f, 0.802205205f},
-std::array<float,2>{0.090065673f, 0.580490351f},
-std::array<float,2>{0.844234169f, 0.277622432f},
-std::array<float,2>{0.245792821f, 0.0276101157f},
-std::array<float,2>{0.896948695f, 0.996342599f},
-std::array<float,2>{0.326600879f, 0.747720182f},
-std::array<float,2>{0.623030066f, 0.448534369f},
-std::array<float,2>{0.496557444f, 0.253940046f},
-std::array<float,2>{0.744479597f, 0.568446219f},
-std::array<float,2>{0.108289421f, 0.787039161f},
-std::array<float,2>{0.831357002f, 0.136742249f},
-std::array<float,2>{0.0249563493f, 0.414088726f},
-std::array<float,2>{0.771519721f, 0.637970924f},
-std::array<float,2>{0.419774383f, 0.933273673f},
-std::array<float,2>{0.644388855f, 0.0863883719f},
-std::array<float,2>{0.290921003f, 0.193008259f},
-std::array<float,2>{0.517097652f, 0.868664563f},
-std::array<float,2>{0.159813836f, 0.505046546f},
-std::array<float,2>{0.990707695f, 0.335935235f},
-std::array<float,2>{0.0636553094f, 0.172766045f},
-std::array<float,2>{0.874986827f, 0.76541388f},
-std::array<float,2>{0.466315091f, 0.599006534f},
-std::array<float,2>{0.692095697f, 0.294453353f},
-std::array<float,2>{0.359096199f, 0.498828113f},
-std::array<float,2>{0.565092921f, 0.702111959f},
-std::array<float,2>{0.192732766f, 0.942463756f},
-std::array<float,2>{0.909754038f, 0.0494741276f},
-std::array<float,2>{0.133115828f, 0.368227184f},
-std::array<float,2>{0.938281119f, 0.541049957f},
-std::array<float,2>{0.257736713f, 0.813756764f},
-std::array<float,2>{0.545329332f, 0.233262166f},
-std::array<float,2>{0.397897691f, 0.108287826f},
-std::array<float,2>{0.663926601f, 0.883951783f},
-std::array<float,2>{0.0454850979f, 0.677891195f},
-std::array<float,2>{0.796970367f, 0.38575086f},
-std::array<float,2>{0.167939678f, 0.147284016f},
-std::array<float,2>{0.994087636f, 0.797672451f},
-std::array<float,2>{0.285084367f, 0.58452487f},
-std::array<float,2>{0.530905187f, 0.276005864f},
-std::array<float,2>{0.409963548f, 0.468698174f},
-std::array<float,2>{0.653765976f, 0.728972793f},
-std::array<float,2>{0.0181859862f, 0.982083201f},
-std::array<float,2>{0.780003548f, 0.00581965549f},
-std::array<float,2>{0.100142732f, 0.321354806f},
-std::array<float,2>{0.840859771f, 0.521268189f},
-std::array<float,2>{0.488858432f, 0.850701213f},
-std::array<float,2>{0.7370193f, 0.218288422f},
-std::array<float,2>{0.320262223f, 0.0762288496f},
-std::array<float,2>{0.616888225f, 0.911119342f},
-std::array<float,2>{0.240924001f, 0.654863715f},
-std::array<float,2>{0.904382825f, 0.434359252f},
-std::array<float,2>{0.0367174149f, 0.0352703519f},
-std::array<float,2>{0.805937588f, 0.958213925f},
-std::array<float,2>{0.404984891f, 0.715842545f},
-std::array<float,2>{0.666226745f, 0.482343137f},
-std::array<float,2>{0.260941476f, 0.29891327f},
-std::array<float,2>{0.538758934f, 0.616337359f},
-std::array<float,2>{0.127963364f, 0.768217921f},
-std::array<float,2>{0.945973158f, 0.164559215f},
-std::array<float,2>{0.195885897f, 0.40533185f},
-std::array<float,2>{0.91998297f, 0.659627557f},
-std::array<float,2>{0.349551857f, 0.90300256f},
-std::array<float,2>{0.575937808f, 0.112468094f},
-std::array<float,2>{0.459014267f, 0.248036772f},
-std::array<float,2>{0.700986564f, 0.829417586f},
-std::array<float,2>{0.0743525103f, 0.556367576f},
-std::array<float,2>{0.866463661f, 0.355893284f},
-std::array<float,2>{0.22843495f, 0.104417749f},
-std::array<float,2>{0.888455987f, 0.889960527f},
-std::array<float,2>{0.337060064f, 0.674831092f},
-std::array<float,2>{0.609029293f, 0.390368491f},
-std::array<float,2>{0.476379395f, 0.373022884f},
-std::array<float,2>{0.719600201f, 0.545712948f},
-std::array<float,2>{0.114635967f, 0.819253266f},
-std::array<float,2>{0.824653447f, 0.228013843f},
-std::array<float,2>{0.00851986185f, 0.494986206f},
-std::array<float,2>{0.764339507f, 0.695701957f},
-std::array<float,2>{0.427712947f, 0.939111233f},
-std::array<float,2>{0.638970077f, 0.0535396375f},
-std::array<float,2>{0.300816238f, 0.178467631f},
-std::array<float,2>{0.504048586f, 0.760843098f},
-std::array<float,2>{0.174207598f, 0.594993711f},
-std::array<float,2>{0.976111352f, 0.291897744f},
-std::array<float,2>{0.0833259374f, 0.190205991f},
-std::array<float,2>{0.855873525f, 0.874839962f},
-std::array<float,2>{0.449173719f, 0.501141608f},
-std::array<float,2>{0.70357281f, 0.328351647f},
-std::array<float,2>{0.371989846f, 0.419591635f},
-std::array<float,2>{0.58424449f, 0.635762691f},
-std::array<float,2>{0.21146068f, 0.937007546f},
-std::array<float,2>{0.929146349f, 0.0925523117f},
-std::array<float,2>{0.144680634f, 0.252984196f},
-std::array<float,2>{0.956893682f, 0.564215362f},
-std::array<float,2>{0.270443678f, 0.783264935f},
-std::array<float,2>{0.550079107f, 0.135994181f},
-std::array<float,2>{0.377478629f, 0.0255004466f},
-std::array<float,2>{0.673512995f, 0.993743598f},
-std::array<float,2>{0.0545378439f, 0.745640397f},
-std::array<float,2>{0.788880467f, 0.450634062f},
-std::array<float,2>{0.205458462f, 0.220800966f},
-std::array<float,2>{0.935840547f, 0.826317608f},
-std::array<float,2>{0.360053271f, 0.532785833f},
-std::array<float,2>{0.592777252f, 0.366570741f},
-std::array<float,2>{0.441878021f, 0.379961699f},
-std::array<float,2>{0.718281746f, 0.686685801f},
-std::array<float,2>{0.0864378288f, 0.881134331f},
-std::array<float,2>{0.849727273f, 0.0999304429f},
-std::array<float,2>{0.0620162226f, 0.285311788f},
-std::array<float,2>{0.789544463f, 0.605088413f},
-std::array<float,2>{0.384227782f, 0.75509268f},
-std::array<float,2>{0.681292832f, 0.185636595f},
-std::array<float,2>{0.280629456f, 0.061295297f},
-std::array<float,2>{0.562033951f, 0.948085606f},
-std::array<float,2>{0.15544726f, 0.691473603f},
-std::array<float,2>{0.967515469f, 0.486438394f},
-std::array<float,2>{0.118528433f, 0.0799127892f},
-std::array<float,2>{0.815349758f, 0.92728889f},
-std::array<float,2>{0.478258699f, 0.626925349f},
-std::array<float,2>{0.73240447f, 0.412769973f},
-std::array<float,2>{0.33370772f, 0.338790208f},
-std::array<float,2>{0.599168003f, 0.510348499f},
-std::array<float,2>{0.221166998f, 0.86003381f},
-std::array<float,2>{0.876959562f, 0.200188234f},
-std::array<float,2>{0.181192681f, 0.440420181f},
-std::array<float,2>{0.980408847f, 0.738805115f},
-std::array<float,2>{0.307347f, 0.992091596f},
-std::array<float,2>{0.510122955f, 0.0231067166f},
-std::array<float,2>{0.43470934f, 0.130908161f},
-std::array<float,2>{0.626182139f, 0.791279495f},
-std::array<float,2>{0.00163754611f, 0.571467817f},
-std::array<float,2>{0.75740695f, 0.263847768f},
-std::array<float,2>{0.140434459f, 0.00914966688f},
-std::array<float,2>{0.943809927f, 0.974256635f},
-std::array<float,2>{0.250484765f, 0.725719869f},
-std::array<float,2>{0.542346776f, 0.460102171f},
-std::array<float,2>{0.393145055f, 0.26843071f},
-std::array<float,2>{0.659829438f, 0.589277327f},
-std::array<float,2>{0.0418624021f, 0.807971954f},
-std::array<float,2>{0.803349674f, 0.150529653f},
-std::array<float,2>{0.0677479655f, 0.423183113f},
-std::array<float,2>{0.86928606f, 0.646054149f},
-std::array<float,2>{0.461491048f, 0.915917873f},
-std::array<float,2>{0.688242197f, 0.0672383308f},
-std::array<float,2>{0.353612572f, 0.207138717f},
-std::array<float,2>{0.569430828f, 0.852122605f},
-std::array<float,2>{0.189015001f, 0.530512631f},
-std::array<float,2>{0.910741568f, 0.316232115f},
-std::array<float,2>{0.0300143976f, 0.161161512f},
-std::array<float,2>{0.769529402f, 0.776609719f},
-std::array<float,2>{0.416969299f, 0.620328844f},
-std::array<float,2>{0.646110237f, 0.306188196f},
-std::array<float,2>{0.293058187f, 0.474582762f},
-std::array<float,2>{0.522429645f, 0.706104696f},
-std::array<float,2>{0.162392467f, 0.967966437f},
-std::array<float,2>{0.987787664f, 0.0412834957f},
-std::array<float,2>{0.246651083f, 0.344156265f},
-std::array<float,2>{0.894239962f, 0.550947785f},
-std::array<float,2>{0.32172966f, 0.837081075f},
-std::array<float,2>{0.620617092f, 0.240477175f},
-std::array<float,2>{0.494837523f, 0.122657776f},
-std::array<float,2>{0.746448696f, 0.894603252f},
-std::array<float,2>{0.104034066f, 0.671357453f},
-std::array<float,2>{0.833928764f, 0.394650578f},
-std::array<float,2>{0.235137537f, 0.179992005f},
-std::array<float,2>{0.901484191f, 0.753031015f},
-std::array<float,2>{0.315207779f, 0.606945753f},
-std::array<float,2>{0.612533391f, 0.282824486f},
-std::array<float,2>{0.485431999f, 0.490817815f},
-std::array<float,2>{0.741116583f, 0.690237641f},
-std::array<float,2>{0.0972112864f, 0.951024413f},
-std::array<float,2>{0.839074433f, 0.0572045073f},
-std::array<float,2>{0.0199840758f, 0.360306799f},
-std::array<float,2>{0.774821579f, 0.538050532f},
-std::array<float,2>{0.412788451f, 0.820790946f},
-std::array<float,2>{0.650094509f, 0.224215358f},
-std::array<float,2>{0.286476076f, 0.096206747f},
-std::array<float,2>{0.52565068f, 0.878491521f},
-std::array<float,2>{0.169222951f, 0.683312714f},
-std::array<float,2>{0.999942541f, 0.378659308f},
-std::array<float,2>{0.0712721497f, 0.0194584299f},
-std::array<float,2>{0.860571146f, 0.985383987f},
-std::array<float,2>{0.456913263f, 0.73513782f},
-std::array<float,2>{0.696168721f, 0.443637609f},
-std::array<float,2>{0.344391435f, 0.258203447f},
-std::array<float,2>{0.571354508f, 0.574450016f},
-std::array<float,2>{0.200374752f, 0.794387877f},
-std::array<float,2>{0.914160609f, 0.127922699f},
-std::array<float,2>{0.129260585f, 0.408727795f},
-std::array<float,2>{0.952706277f, 0.630683661f},
-std::array<float,2>{0.262758762f, 0.924522102f},
-std::array<float,2>{0.531872809f, 0.0827935636f},
-std::array<float,2>{0.40064922f, 0.195717394f},
-std::array<float,2>{0.670434654f, 0.865621865f},
-std::array<float,2>{0.0338714086f, 0.512815058f},
-std::array<float,2>{0.80861342f, 0.340048254f},
-std::array<float,2>{0.177954793f, 0.0633252263f},
-std::array<float,2>{0.969921172f, 0.919922054f},
-std::array<float,2>{0.299520701f, 0.642348051f},
-std::array<float,2>{0.50180459f, 0.427759707f},
-std::array<float,2>{0.422021002f, 0.318638951f},
-std::array<float,2>{0.634258687f, 0.523790359f},
-std::array<float,2>{0.0148968967f, 0.855970621f},
-std::array<float,2>{0.75828445f, 0.204762369f},
-std::array<float,2>{0.109616153f, 0.456921875f},
-std::array<float,2>{0.821532607f, 0.719122052f},
-std::array<float,2>{0.47151953f, 0.971320927f},
-std::array<float,2>{0.725367963f, 0.0127906585f},
-std::array<float,2>{0.342628866f, 0.155370623f},
-std::array<float,2>{0.602668285f, 0.811637461f},
-std::array<float,2>{0.234363705f, 0.593059242f},
-std::array<float,2>{0.886136949f, 0.270313919f},
-std::array<float,2>{0.0484549031f, 0.235427976f},
-std::array<float,2>{0.78140974f, 0.841187954f},
-std::array<float,2>{0.382802606f, 0.547029614f},
-std::array<float,2>{0.676655114f, 0.350402981f},
-std::array<float,2>{0.265898079f, 0.390860081f},
-std::array<float,2>{0.553313255f, 0.664354563f},
-std::array<float,2>{0.143994376f, 0.893580258f},
-std::array<float,2>{0.959500849f, 0.120360933f},
-std::array<float,2>{0.216861844f, 0.309154749f},
-std::array<float,2>{0.924099863f, 0.624496281f},
-std::array<float,2>{0.367982209f, 0.779738784f},
-std::array<float,2>{0.581513107f, 0.157774284f},
-std::array<float,2>{0.449445367f, 0.0433815867f},
-std::array<float,2>{0.708672523f, 0.964256167f},
-std::array<float,2>{0.081851989f, 0.709718764f},
-std::array<float,2>{0.853008628f, 0.472142905f},
-std::array<float,2>{0.151554808f, 0.21190308f},
-std::array<float,2>{0.961777329f, 0.847443819f},
-std::array<float,2>{0.276880562f, 0.51813221f},
-std::array<float,2>{0.557629347f, 0.327265471f},
-std::array<float,2>{0.38937974f, 0.431767195f},
-std::array<float,2>{0.685693085f, 0.649440289f},
-std::array<float,2>{0.0573234111f, 0.909220159f},
-std::array<float,2>{0.79307735f, 0.0713273585f},
-std::array<float,2>{0.0918779671f, 0.279860616f},
-std::array<float,2>{0.847424328f, 0.579621375f},
-std::array<float,2>{0.440774381f, 0.802769303f},
-std::array<float,2>{0.711657286f, 0.14139767f},
-std::array<float,2>{0.366934896f, 0.00346218492f},
-std::array<float,2>{0.586351633f, 0.977997541f},
-std::array<float,2>{0.209099442f, 0.730919361f},
-std::array<float,2>{0.93355763f, 0.46407795f},
-std::array<float,2>{0.00727600185f, 0.115278691f},
-std::array<float,2>{0.752565861f, 0.902159095f},
-std::array<float,2>{0.433390498f, 0.661467254f},
-std::array<float,2>{0.629505277f, 0.400912285f},
-std::array<float,2>{0.311838359f, 0.355229586f},
-std::array<float,2>{0.515379608f, 0.56082046f},
-std::array<float,2>{0.184701607f, 0.832098424f},
-std::array<float,2>{0.981261849f, 0.244959831f},
-std::array<float,2>{0.223315075f, 0.480129778f},
-std::array<float,2>{0.880325079f, 0.711362004f},
-std::array<float,2>{0.331889927f, 0.956577718f},
-std::array<float,2>{0.594933271f, 0.0326442048f},
-std::array<float,2>{0.480964512f, 0.171183333f},
-std::array<float,2>{0.728280306f, 0.771088719f},
-std::array<float,2>{0.122527622f, 0.611811399f},
-std::array<float,2>{0.819800258f, 0.303800255f},
-std::array<float,2>{0.194327444f, 0.0483515114f},
-std::array<float,2>{0.906507075f, 0.944320381f},
-std::array<float,2>{0.356282055f, 0.699258745f},
-std::array<float,2>{0.563840032f, 0.497004628f},
-std::array<float,2>{0.467561513f, 0.295860797f},
-std::array<float,2>{0.694558799f, 0.600517988f},
-std::array<float,2>{0.0645357221f, 0.762341976f},
-std::array<float,2>{0.871974468f, 0.17449908f},
-std::array<float,2>{0.0429992341f, 0.384658158f},
-std::array<float,2>{0.800421119f, 0.677528679f},
-std::array<float,2>{0.395235747f, 0.885929763f},
-std::array<float,2>{0.660607636f, 0.107285447f},
-std::array<float,2>{0.255019128f, 0.231019661f},
-std::array<float,2>{0.54414916f, 0.815003514f},
-std::array<float,2>{0.136055529f, 0.540607691f},
-std::array<float,2>{0.940372884f, 0.370143175f},
-std::array<float,2>{0.10736838f, 0.140422031f},
-std::array<float,2>{0.829190671f, 0.787368357f},
-std::array<float,2>{0.499031186f, 0.568047762f},
-std::array<float,2>{0.742376387f, 0.255950242f},
-std::array<float,2>{0.324398994f, 0.445781618f},
-std::array<float,2>{0.624450326f, 0.749351144f},
-std::array<float,2>{0.243100539f, 0.998896837f},
-std::array<float,2>{0.894565821f, 0.0312267598f},
-std::array<float,2>{0.157734454f, 0.332445443f},
-std::array<float,2>{0.988304436f, 0.506124794f},
-std::array<float,2>{0.29226312f, 0.870115638f},
-std::array<float,2>{0.518688619f, 0.19519797f},
-std::array<float,2>{0.42127651f, 0.0881746635f},
-std::array<float,2>{0.642301559f, 0.929774582f},
-std::array<float,2>{0.0260098614f, 0.640446067f},
-std::array<float,2>{0.771310508f, 0.41643545f}}
\ No newline at end of file
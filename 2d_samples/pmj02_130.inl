@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.9845137f, 0.448704332f},
-std::array<float,2>{0.177592814f, 0.64552778f},
-std::array<float,2>{0.277967274f, 0.164831012f},
-std::array<float,2>{0.609618247f, 0.752732635f},
-std::array<float,2>{0.700933039f, 0.00260538002f},
-std::array<float,2>{0.475931883f, 0.903686821f},
-std::array<float,2>{0.0425741747f, 0.250373244f},
-std::array<float,2>{0.842199862f, 0.560569167f},
-std::array<float,2>{0.528249502f, 0.37047255f},
-std::array<float,2>{0.313182652f, 0.597971916f},
-std::array<float,2>{0.219872445f, 0.0724311173f},
-std::array<float,2>{0.893301189f, 0.982239842f},
-std::array<float,2>{0.752784669f, 0.217795938f},
-std::array<float,2>{0.0680547133f, 0.861045241f},
-std::array<float,2>{0.410632908f, 0.416389793f},
-std::array<float,2>{0.649737835f, 0.704287231f},
-std::array<float,2>{0.873931766f, 0.287663668f},
-std::array<float,2>{0.014634206f, 0.516266227f},
-std::array<float,2>{0.44302997f, 0.0360978916f},
-std::array<float,2>{0.737153888f, 0.931559443f},
-std::array<float,2>{0.569716394f, 0.138540745f},
-std::array<float,2>{0.285089046f, 0.798202634f},
-std::array<float,2>{0.153801963f, 0.484254569f},
-std::array<float,2>{0.942500949f, 0.666049123f},
-std::array<float,2>{0.674647093f, 0.386982352f},
-std::array<float,2>{0.397843391f, 0.73419112f},
-std::array<float,2>{0.109781906f, 0.243910104f},
-std::array<float,2>{0.783234537f, 0.815083981f},
-std::array<float,2>{0.931597888f, 0.117793754f},
-std::array<float,2>{0.210269228f, 0.94111985f},
-std::array<float,2>{0.349635303f, 0.3165721f},
-std::array<float,2>{0.561090827f, 0.583238363f},
-std::array<float,2>{0.79950881f, 0.424114287f},
-std::array<float,2>{0.104913138f, 0.688750386f},
-std::array<float,2>{0.389464855f, 0.19083856f},
-std::array<float,2>{0.666570604f, 0.846103787f},
-std::array<float,2>{0.532868803f, 0.0857769921f},
-std::array<float,2>{0.371631444f, 0.995154977f},
-std::array<float,2>{0.194092244f, 0.350196004f},
-std::array<float,2>{0.919408262f, 0.619699478f},
-std::array<float,2>{0.723382652f, 0.275880128f},
-std::array<float,2>{0.459752768f, 0.536722124f},
-std::array<float,2>{0.0298811495f, 0.0239256173f},
-std::array<float,2>{0.852497518f, 0.880980849f},
-std::array<float,2>{0.960018694f, 0.179243162f},
-std::array<float,2>{0.138586044f, 0.781059563f},
-std::array<float,2>{0.303629637f, 0.46669656f},
-std::array<float,2>{0.587352216f, 0.62543571f},
-std::array<float,2>{0.877565026f, 0.333257109f},
-std::array<float,2>{0.24066183f, 0.566782773f},
-std::array<float,2>{0.338498473f, 0.109096989f},
-std::array<float,2>{0.513323426f, 0.957268476f},
-std::array<float,2>{0.635722101f, 0.22383447f},
-std::array<float,2>{0.435593784f, 0.84088707f},
-std::array<float,2>{0.0842182413f, 0.402015328f},
-std::array<float,2>{0.775883377f, 0.741230249f},
-std::array<float,2>{0.608059704f, 0.488051206f},
-std::array<float,2>{0.265219718f, 0.67296505f},
-std::array<float,2>{0.163369119f, 0.141678721f},
-std::array<float,2>{0.973673642f, 0.788520396f},
-std::array<float,2>{0.812698424f, 0.0532572679f},
-std::array<float,2>{0.0585278235f, 0.914907992f},
-std::array<float,2>{0.494382381f, 0.305779219f},
-std::array<float,2>{0.712059796f, 0.513163507f},
-std::array<float,2>{0.912187099f, 0.397464484f},
-std::array<float,2>{0.202612311f, 0.74948436f},
-std::array<float,2>{0.362041414f, 0.228992105f},
-std::array<float,2>{0.540323496f, 0.831081808f},
-std::array<float,2>{0.663928032f, 0.0993100107f},
-std::array<float,2>{0.37958014f, 0.965664864f},
-std::array<float,2>{0.101155706f, 0.341481775f},
-std::array<float,2>{0.805025518f, 0.5749017f},
-std::array<float,2>{0.583336234f, 0.300649941f},
-std::array<float,2>{0.308436394f, 0.504509151f},
-std::array<float,2>{0.131359994f, 0.0616146214f},
-std::array<float,2>{0.967798233f, 0.912864506f},
-std::array<float,2>{0.847176075f, 0.149136215f},
-std::array<float,2>{0.0220912751f, 0.796327591f},
-std::array<float,2>{0.462516189f, 0.492577285f},
-std::array<float,2>{0.733306646f, 0.683296978f},
-std::array<float,2>{0.771681428f, 0.356827557f},
-std::array<float,2>{0.0878353417f, 0.612184107f},
-std::array<float,2>{0.422227263f, 0.0880837142f},
-std::array<float,2>{0.627402663f, 0.986837685f},
-std::array<float,2>{0.505713403f, 0.202569738f},
-std::array<float,2>{0.333919972f, 0.85236299f},
-std::array<float,2>{0.247132406f, 0.43584919f},
-std::array<float,2>{0.889999509f, 0.69633007f},
-std::array<float,2>{0.710662782f, 0.456902713f},
-std::array<float,2>{0.488322228f, 0.638699591f},
-std::array<float,2>{0.0485849343f, 0.184537023f},
-std::array<float,2>{0.822076976f, 0.766298115f},
-std::array<float,2>{0.983096659f, 0.0159500055f},
-std::array<float,2>{0.171118274f, 0.889695585f},
-std::array<float,2>{0.253984541f, 0.269223571f},
-std::array<float,2>{0.599116981f, 0.542786241f},
-std::array<float,2>{0.831761837f, 0.47349745f},
-std::array<float,2>{0.0362417549f, 0.656846642f},
-std::array<float,2>{0.48349902f, 0.130063042f},
-std::array<float,2>{0.691872537f, 0.810874999f},
-std::array<float,2>{0.61789602f, 0.0430483148f},
-std::array<float,2>{0.271903396f, 0.926928461f},
-std::array<float,2>{0.185851559f, 0.291421115f},
-std::array<float,2>{0.999319971f, 0.526620924f},
-std::array<float,2>{0.644099951f, 0.32711488f},
-std::array<float,2>{0.417510688f, 0.588662148f},
-std::array<float,2>{0.0725911409f, 0.115779787f},
-std::array<float,2>{0.761207461f, 0.948613882f},
-std::array<float,2>{0.89901185f, 0.237003744f},
-std::array<float,2>{0.226577565f, 0.824638844f},
-std::array<float,2>{0.322288662f, 0.379704952f},
-std::array<float,2>{0.516716659f, 0.72527951f},
-std::array<float,2>{0.948780954f, 0.263849854f},
-std::array<float,2>{0.144912571f, 0.550600708f},
-std::array<float,2>{0.294524074f, 0.00957315974f},
-std::array<float,2>{0.570752501f, 0.894843876f},
-std::array<float,2>{0.74654758f, 0.161722183f},
-std::array<float,2>{0.446813524f, 0.764589429f},
-std::array<float,2>{0.00727754552f, 0.438787043f},
-std::array<float,2>{0.859994531f, 0.649758816f},
-std::array<float,2>{0.549179673f, 0.412852585f},
-std::array<float,2>{0.353511542f, 0.718208075f},
-std::array<float,2>{0.217821479f, 0.203716755f},
-std::array<float,2>{0.924351692f, 0.868220091f},
-std::array<float,2>{0.789989889f, 0.0681326017f},
-std::array<float,2>{0.121916905f, 0.97345221f},
-std::array<float,2>{0.400537699f, 0.362825841f},
-std::array<float,2>{0.680061042f, 0.608590186f},
-std::array<float,2>{0.962806344f, 0.419286102f},
-std::array<float,2>{0.127296045f, 0.710024118f},
-std::array<float,2>{0.308999658f, 0.212874636f},
-std::array<float,2>{0.58071053f, 0.863925934f},
-std::array<float,2>{0.727468312f, 0.0765855536f},
-std::array<float,2>{0.466872424f, 0.979343176f},
-std::array<float,2>{0.0163039844f, 0.37358743f},
-std::array<float,2>{0.851247907f, 0.597597718f},
-std::array<float,2>{0.545873344f, 0.256477326f},
-std::array<float,2>{0.363924265f, 0.557844996f},
-std::array<float,2>{0.198801577f, 0.00550751947f},
-std::array<float,2>{0.906983852f, 0.899646759f},
-std::array<float,2>{0.812467217f, 0.1704835f},
-std::array<float,2>{0.0951208994f, 0.755269825f},
-std::array<float,2>{0.375088841f, 0.449319184f},
-std::array<float,2>{0.659116745f, 0.642791927f},
-std::array<float,2>{0.827592134f, 0.313089788f},
-std::array<float,2>{0.0538070872f, 0.581856549f},
-std::array<float,2>{0.487373292f, 0.121810183f},
-std::array<float,2>{0.705724239f, 0.942543268f},
-std::array<float,2>{0.594513059f, 0.247372344f},
-std::array<float,2>{0.250104576f, 0.820127904f},
-std::array<float,2>{0.166622043f, 0.385507941f},
-std::array<float,2>{0.980239093f, 0.728022158f},
-std::array<float,2>{0.631052613f, 0.47740972f},
-std::array<float,2>{0.42882964f, 0.670734227f},
-std::array<float,2>{0.0925379023f, 0.134448126f},
-std::array<float,2>{0.766925871f, 0.804659128f},
-std::array<float,2>{0.884699106f, 0.0333777592f},
-std::array<float,2>{0.244805425f, 0.936064303f},
-std::array<float,2>{0.331726134f, 0.284681082f},
-std::array<float,2>{0.503553748f, 0.522136569f},
-std::array<float,2>{0.761994958f, 0.464611351f},
-std::array<float,2>{0.0747449473f, 0.631088197f},
-std::array<float,2>{0.4194884f, 0.173476234f},
-std::array<float,2>{0.648228943f, 0.774144173f},
-std::array<float,2>{0.5212152f, 0.0282356869f},
-std::array<float,2>{0.32436949f, 0.877780199f},
-std::array<float,2>{0.232557669f, 0.278129399f},
-std::array<float,2>{0.905691803f, 0.534421682f},
-std::array<float,2>{0.688470185f, 0.347398818f},
-std::array<float,2>{0.477818489f, 0.62165159f},
-std::array<float,2>{0.0347631536f, 0.0790868849f},
-std::array<float,2>{0.834044397f, 0.998640239f},
-std::array<float,2>{0.994345486f, 0.191710621f},
-std::array<float,2>{0.182283059f, 0.847788811f},
-std::array<float,2>{0.266096562f, 0.428652197f},
-std::array<float,2>{0.621262729f, 0.694692194f},
-std::array<float,2>{0.928505063f, 0.308682591f},
-std::array<float,2>{0.211804524f, 0.510317445f},
-std::array<float,2>{0.358107328f, 0.0477701388f},
-std::array<float,2>{0.554267526f, 0.920370817f},
-std::array<float,2>{0.686159253f, 0.144710273f},
-std::array<float,2>{0.403740793f, 0.783114433f},
-std::array<float,2>{0.118976355f, 0.490754843f},
-std::array<float,2>{0.796395779f, 0.676537991f},
-std::array<float,2>{0.577098429f, 0.403217852f},
-std::array<float,2>{0.291131258f, 0.7375471f},
-std::array<float,2>{0.14121978f, 0.221249416f},
-std::array<float,2>{0.950961173f, 0.837637126f},
-std::array<float,2>{0.865432262f, 0.103494033f},
-std::array<float,2>{0.00353788561f, 0.956368506f},
-std::array<float,2>{0.452364415f, 0.33045432f},
-std::array<float,2>{0.74462527f, 0.566392601f},
-std::array<float,2>{0.898408055f, 0.498715281f},
-std::array<float,2>{0.224353671f, 0.68415904f},
-std::array<float,2>{0.318382323f, 0.154202893f},
-std::array<float,2>{0.524990022f, 0.79092598f},
-std::array<float,2>{0.652576566f, 0.0553165674f},
-std::array<float,2>{0.406575859f, 0.906829238f},
-std::array<float,2>{0.0636144876f, 0.301090837f},
-std::array<float,2>{0.75751996f, 0.500531316f},
-std::array<float,2>{0.615703762f, 0.337312311f},
-std::array<float,2>{0.273589313f, 0.574097216f},
-std::array<float,2>{0.175281674f, 0.094838351f},
-std::array<float,2>{0.989185154f, 0.961364985f},
-std::array<float,2>{0.836087346f, 0.234218076f},
-std::array<float,2>{0.0454845689f, 0.834818184f},
-std::array<float,2>{0.468878031f, 0.393818706f},
-std::array<float,2>{0.699041486f, 0.743154764f},
-std::array<float,2>{0.78805095f, 0.270119995f},
-std::array<float,2>{0.117123052f, 0.546278298f},
-std::array<float,2>{0.391861141f, 0.0215734001f},
-std::array<float,2>{0.67760694f, 0.885120213f},
-std::array<float,2>{0.558254182f, 0.182651773f},
-std::array<float,2>{0.344903022f, 0.772247493f},
-std::array<float,2>{0.203383371f, 0.46020332f},
-std::array<float,2>{0.9371714f, 0.633245349f},
-std::array<float,2>{0.739134848f, 0.430158108f},
-std::array<float,2>{0.439746261f, 0.700489581f},
-std::array<float,2>{0.00908470992f, 0.198487148f},
-std::array<float,2>{0.869750559f, 0.858530402f},
-std::array<float,2>{0.941227436f, 0.0908996537f},
-std::array<float,2>{0.150997177f, 0.991108298f},
-std::array<float,2>{0.285779685f, 0.354464561f},
-std::array<float,2>{0.565240324f, 0.613328338f},
-std::array<float,2>{0.857136488f, 0.376767188f},
-std::array<float,2>{0.0247879587f, 0.721057415f},
-std::array<float,2>{0.454143554f, 0.240994349f},
-std::array<float,2>{0.721902311f, 0.82320714f},
-std::array<float,2>{0.592846036f, 0.112407222f},
-std::array<float,2>{0.298517019f, 0.952273965f},
-std::array<float,2>{0.135846436f, 0.322801173f},
-std::array<float,2>{0.954464853f, 0.592522621f},
-std::array<float,2>{0.669283569f, 0.295449018f},
-std::array<float,2>{0.38455978f, 0.527701735f},
-std::array<float,2>{0.107447833f, 0.03962503f},
-std::array<float,2>{0.801759899f, 0.925699055f},
-std::array<float,2>{0.914192677f, 0.128146082f},
-std::array<float,2>{0.189805597f, 0.805951178f},
-std::array<float,2>{0.369766593f, 0.471845269f},
-std::array<float,2>{0.537793517f, 0.66192919f},
-std::array<float,2>{0.9692747f, 0.363532454f},
-std::array<float,2>{0.158117861f, 0.604444146f},
-std::array<float,2>{0.259229898f, 0.0649594441f},
-std::array<float,2>{0.604503691f, 0.970546901f},
-std::array<float,2>{0.718418717f, 0.208271131f},
-std::array<float,2>{0.498990238f, 0.874821901f},
-std::array<float,2>{0.0609703995f, 0.407217115f},
-std::array<float,2>{0.817700744f, 0.71164912f},
-std::array<float,2>{0.509929121f, 0.443932891f},
-std::array<float,2>{0.342320859f, 0.655740976f},
-std::array<float,2>{0.237624541f, 0.158210993f},
-std::array<float,2>{0.880997837f, 0.759213448f},
-std::array<float,2>{0.778891087f, 0.0120302401f},
-std::array<float,2>{0.079333894f, 0.891144097f},
-std::array<float,2>{0.433576077f, 0.25819394f},
-std::array<float,2>{0.637349546f, 0.554643095f},
-std::array<float,2>{0.944708586f, 0.48077032f},
-std::array<float,2>{0.154465303f, 0.665241838f},
-std::array<float,2>{0.281684101f, 0.139209554f},
-std::array<float,2>{0.567362249f, 0.800307512f},
-std::array<float,2>{0.73550874f, 0.0382636078f},
-std::array<float,2>{0.443451524f, 0.932786882f},
-std::array<float,2>{0.0119463829f, 0.286284894f},
-std::array<float,2>{0.872002661f, 0.518042922f},
-std::array<float,2>{0.559169769f, 0.320058733f},
-std::array<float,2>{0.349211067f, 0.584591746f},
-std::array<float,2>{0.20860216f, 0.119164549f},
-std::array<float,2>{0.932541966f, 0.937706888f},
-std::array<float,2>{0.781457067f, 0.245171055f},
-std::array<float,2>{0.111970186f, 0.814258873f},
-std::array<float,2>{0.395960331f, 0.388739079f},
-std::array<float,2>{0.672649205f, 0.730518281f},
-std::array<float,2>{0.839907646f, 0.253298521f},
-std::array<float,2>{0.0409418121f, 0.558768451f},
-std::array<float,2>{0.474026322f, 0.00184327352f},
-std::array<float,2>{0.70223552f, 0.9060902f},
-std::array<float,2>{0.612241983f, 0.166152999f},
-std::array<float,2>{0.280619144f, 0.750522256f},
-std::array<float,2>{0.178867817f, 0.445730239f},
-std::array<float,2>{0.987940609f, 0.646633685f},
-std::array<float,2>{0.651258767f, 0.415894985f},
-std::array<float,2>{0.412532449f, 0.705306828f},
-std::array<float,2>{0.0698474124f, 0.215836227f},
-std::array<float,2>{0.750744641f, 0.862410367f},
-std::array<float,2>{0.8922894f, 0.0705610588f},
-std::array<float,2>{0.221466541f, 0.984040678f},
-std::array<float,2>{0.314943522f, 0.368228316f},
-std::array<float,2>{0.530417681f, 0.59980154f},
-std::array<float,2>{0.77461493f, 0.399448127f},
-std::array<float,2>{0.0823386237f, 0.738445342f},
-std::array<float,2>{0.435403317f, 0.225336954f},
-std::array<float,2>{0.634632707f, 0.842307389f},
-std::array<float,2>{0.515050054f, 0.106720574f},
-std::array<float,2>{0.336289525f, 0.960227311f},
-std::array<float,2>{0.239975125f, 0.335908532f},
-std::array<float,2>{0.876019359f, 0.568531275f},
-std::array<float,2>{0.713328779f, 0.307638645f},
-std::array<float,2>{0.492851168f, 0.515366256f},
-std::array<float,2>{0.0547274835f, 0.0517544784f},
-std::array<float,2>{0.814679682f, 0.917484879f},
-std::array<float,2>{0.976133287f, 0.143341511f},
-std::array<float,2>{0.161826909f, 0.786395311f},
-std::array<float,2>{0.261788845f, 0.484520882f},
-std::array<float,2>{0.606336117f, 0.67471993f},
-std::array<float,2>{0.920511127f, 0.348836422f},
-std::array<float,2>{0.19201301f, 0.618353426f},
-std::array<float,2>{0.373341024f, 0.0835105777f},
-std::array<float,2>{0.533648372f, 0.993449509f},
-std::array<float,2>{0.664117515f, 0.187646538f},
-std::array<float,2>{0.387240857f, 0.844629586f},
-std::array<float,2>{0.102839865f, 0.422021449f},
-std::array<float,2>{0.798660338f, 0.689769208f},
-std::array<float,2>{0.589775383f, 0.466979504f},
-std::array<float,2>{0.302032501f, 0.62838012f},
-std::array<float,2>{0.139458492f, 0.176343873f},
-std::array<float,2>{0.958409846f, 0.778923273f},
-std::array<float,2>{0.853926063f, 0.0269208457f},
-std::array<float,2>{0.0279063266f, 0.880411983f},
-std::array<float,2>{0.45884335f, 0.274225622f},
-std::array<float,2>{0.724646986f, 0.538339794f},
-std::array<float,2>{0.886808276f, 0.435403943f},
-std::array<float,2>{0.248836875f, 0.698453844f},
-std::array<float,2>{0.334741652f, 0.200648353f},
-std::array<float,2>{0.507651627f, 0.853536248f},
-std::array<float,2>{0.626196146f, 0.0877117664f},
-std::array<float,2>{0.425113916f, 0.985819817f},
-std::array<float,2>{0.0881103128f, 0.357937723f},
-std::array<float,2>{0.770664036f, 0.610523224f},
-std::array<float,2>{0.601252198f, 0.266962945f},
-std::array<float,2>{0.256709069f, 0.540024042f},
-std::array<float,2>{0.169616073f, 0.0188413579f},
-std::array<float,2>{0.981894433f, 0.887951255f},
-std::array<float,2>{0.823577642f, 0.18669349f},
-std::array<float,2>{0.0491690189f, 0.768874466f},
-std::array<float,2>{0.491923273f, 0.454730511f},
-std::array<float,2>{0.708297551f, 0.63834691f},
-std::array<float,2>{0.806835055f, 0.34199664f},
-std::array<float,2>{0.0994796604f, 0.577624321f},
-std::array<float,2>{0.381622016f, 0.100677796f},
-std::array<float,2>{0.662017226f, 0.967719018f},
-std::array<float,2>{0.542721689f, 0.227299169f},
-std::array<float,2>{0.36029169f, 0.829907f},
-std::array<float,2>{0.200469762f, 0.395436555f},
-std::array<float,2>{0.911199808f, 0.7475335f},
-std::array<float,2>{0.731017232f, 0.495656192f},
-std::array<float,2>{0.463703901f, 0.681190133f},
-std::array<float,2>{0.0211578533f, 0.152241319f},
-std::array<float,2>{0.844477654f, 0.793337345f},
-std::array<float,2>{0.965045333f, 0.0590038449f},
-std::array<float,2>{0.130030751f, 0.911479294f},
-std::array<float,2>{0.305611581f, 0.297937155f},
-std::array<float,2>{0.584291041f, 0.507417023f},
-std::array<float,2>{0.861473083f, 0.440358013f},
-std::array<float,2>{0.00408482412f, 0.652043641f},
-std::array<float,2>{0.449109405f, 0.163981006f},
-std::array<float,2>{0.749575973f, 0.762264132f},
-std::array<float,2>{0.57243067f, 0.0109061459f},
-std::array<float,2>{0.295431554f, 0.898118317f},
-std::array<float,2>{0.148159847f, 0.262975544f},
-std::array<float,2>{0.947213829f, 0.54858762f},
-std::array<float,2>{0.682417452f, 0.360814393f},
-std::array<float,2>{0.399199605f, 0.605654061f},
-std::array<float,2>{0.123387016f, 0.068685554f},
-std::array<float,2>{0.791076899f, 0.975268066f},
-std::array<float,2>{0.922431469f, 0.206059158f},
-std::array<float,2>{0.214891836f, 0.870011568f},
-std::array<float,2>{0.354289532f, 0.411826432f},
-std::array<float,2>{0.547152519f, 0.715959013f},
-std::array<float,2>{0.997792006f, 0.2893112f},
-std::array<float,2>{0.183956429f, 0.523785532f},
-std::array<float,2>{0.271322906f, 0.0466455184f},
-std::array<float,2>{0.619706094f, 0.927973688f},
-std::array<float,2>{0.694206238f, 0.131187782f},
-std::array<float,2>{0.480547756f, 0.809814692f},
-std::array<float,2>{0.0388053022f, 0.475629449f},
-std::array<float,2>{0.828647017f, 0.658996761f},
-std::array<float,2>{0.518629313f, 0.382415295f},
-std::array<float,2>{0.320722878f, 0.724446476f},
-std::array<float,2>{0.229671434f, 0.234424829f},
-std::array<float,2>{0.901995659f, 0.827728331f},
-std::array<float,2>{0.75964272f, 0.113627657f},
-std::array<float,2>{0.0720857605f, 0.94680059f},
-std::array<float,2>{0.414911807f, 0.325417459f},
-std::array<float,2>{0.641178966f, 0.587107897f},
-std::array<float,2>{0.976707816f, 0.383695453f},
-std::array<float,2>{0.164578602f, 0.729035735f},
-std::array<float,2>{0.253643185f, 0.248587385f},
-std::array<float,2>{0.59674871f, 0.817114174f},
-std::array<float,2>{0.704566181f, 0.124603108f},
-std::array<float,2>{0.485623747f, 0.943365335f},
-std::array<float,2>{0.0526283234f, 0.314731449f},
-std::array<float,2>{0.824554563f, 0.579728425f},
-std::array<float,2>{0.501237392f, 0.282305181f},
-std::array<float,2>{0.328995377f, 0.521170855f},
-std::array<float,2>{0.242905885f, 0.0331126116f},
-std::array<float,2>{0.886461258f, 0.933685958f},
-std::array<float,2>{0.767794967f, 0.135073304f},
-std::array<float,2>{0.0899580643f, 0.80149436f},
-std::array<float,2>{0.426994652f, 0.479602277f},
-std::array<float,2>{0.628993511f, 0.668927312f},
-std::array<float,2>{0.849060833f, 0.37282154f},
-std::array<float,2>{0.0194318872f, 0.594611049f},
-std::array<float,2>{0.466651589f, 0.075327903f},
-std::array<float,2>{0.72952497f, 0.978276074f},
-std::array<float,2>{0.578188479f, 0.214437753f},
-std::array<float,2>{0.310756356f, 0.865463078f},
-std::array<float,2>{0.125357613f, 0.42164737f},
-std::array<float,2>{0.964595914f, 0.708933353f},
-std::array<float,2>{0.657771051f, 0.451246202f},
-std::array<float,2>{0.37702325f, 0.641047955f},
-std::array<float,2>{0.0967977643f, 0.168055773f},
-std::array<float,2>{0.809322357f, 0.756032944f},
-std::array<float,2>{0.908291042f, 0.00778778456f},
-std::array<float,2>{0.195788831f, 0.900480688f},
-std::array<float,2>{0.366146684f, 0.255502403f},
-std::array<float,2>{0.544590473f, 0.556019425f},
-std::array<float,2>{0.794778883f, 0.488729805f},
-std::array<float,2>{0.119227856f, 0.679256439f},
-std::array<float,2>{0.404639632f, 0.147089139f},
-std::array<float,2>{0.684586525f, 0.783625841f},
-std::array<float,2>{0.551002502f, 0.0495997332f},
-std::array<float,2>{0.356636226f, 0.919464946f},
-std::array<float,2>{0.214542434f, 0.311623037f},
-std::array<float,2>{0.926479399f, 0.509120941f},
-std::array<float,2>{0.743844926f, 0.32958892f},
-std::array<float,2>{0.449618578f, 0.562580884f},
-std::array<float,2>{0.000318296021f, 0.104593232f},
-std::array<float,2>{0.864817321f, 0.954402268f},
-std::array<float,2>{0.953038573f, 0.219258338f},
-std::array<float,2>{0.143566832f, 0.839765966f},
-std::array<float,2>{0.290063202f, 0.405785173f},
-std::array<float,2>{0.575655103f, 0.735300004f},
-std::array<float,2>{0.903526604f, 0.279946417f},
-std::array<float,2>{0.231972083f, 0.532473445f},
-std::array<float,2>{0.327439278f, 0.029453136f},
-std::array<float,2>{0.522530317f, 0.876112521f},
-std::array<float,2>{0.646026373f, 0.174266368f},
-std::array<float,2>{0.420788258f, 0.775943041f},
-std::array<float,2>{0.0767787918f, 0.462625355f},
-std::array<float,2>{0.763855338f, 0.629065573f},
-std::array<float,2>{0.623128295f, 0.42668739f},
-std::array<float,2>{0.26780349f, 0.691559494f},
-std::array<float,2>{0.17973569f, 0.19371061f},
-std::array<float,2>{0.992437601f, 0.849897087f},
-std::array<float,2>{0.833802342f, 0.0800962225f},
-std::array<float,2>{0.0316709355f, 0.997988462f},
-std::array<float,2>{0.479471475f, 0.345033854f},
-std::array<float,2>{0.690908968f, 0.623385668f},
-std::array<float,2>{0.934706748f, 0.458073974f},
-std::array<float,2>{0.206364676f, 0.63653934f},
-std::array<float,2>{0.347264975f, 0.180905372f},
-std::array<float,2>{0.556486666f, 0.771395862f},
-std::array<float,2>{0.677998662f, 0.0195978638f},
-std::array<float,2>{0.392983407f, 0.883539021f},
-std::array<float,2>{0.113643095f, 0.271805257f},
-std::array<float,2>{0.785489261f, 0.544066668f},
-std::array<float,2>{0.564068794f, 0.352176368f},
-std::array<float,2>{0.288537771f, 0.615363419f},
-std::array<float,2>{0.149642274f, 0.0935443565f},
-std::array<float,2>{0.939182758f, 0.98902005f},
-std::array<float,2>{0.869005024f, 0.196543723f},
-std::array<float,2>{0.0116870459f, 0.855813265f},
-std::array<float,2>{0.438853353f, 0.43205443f},
-std::array<float,2>{0.741053581f, 0.702209413f},
-std::array<float,2>{0.755157232f, 0.303887099f},
-std::array<float,2>{0.0661926642f, 0.502430201f},
-std::array<float,2>{0.409794241f, 0.0569566153f},
-std::array<float,2>{0.655519068f, 0.908625603f},
-std::array<float,2>{0.526866078f, 0.154690653f},
-std::array<float,2>{0.317279249f, 0.791398883f},
-std::array<float,2>{0.226184636f, 0.496187657f},
-std::array<float,2>{0.894762516f, 0.686657846f},
-std::array<float,2>{0.695365429f, 0.390761137f},
-std::array<float,2>{0.472210735f, 0.744894862f},
-std::array<float,2>{0.0440172069f, 0.232331917f},
-std::array<float,2>{0.838251054f, 0.832072854f},
-std::array<float,2>{0.99081701f, 0.0963128954f},
-std::array<float,2>{0.1729289f, 0.964239597f},
-std::array<float,2>{0.276328146f, 0.339072883f},
-std::array<float,2>{0.613982737f, 0.5712533f},
-std::array<float,2>{0.819507957f, 0.408323467f},
-std::array<float,2>{0.059260536f, 0.71328932f},
-std::array<float,2>{0.498038799f, 0.208989695f},
-std::array<float,2>{0.71602428f, 0.872997344f},
-std::array<float,2>{0.601992846f, 0.0643569827f},
-std::array<float,2>{0.261120915f, 0.971529663f},
-std::array<float,2>{0.15866448f, 0.36531812f},
-std::array<float,2>{0.971841753f, 0.60234642f},
-std::array<float,2>{0.639212072f, 0.260190606f},
-std::array<float,2>{0.430978924f, 0.550841212f},
-std::array<float,2>{0.0810598657f, 0.0142357452f},
-std::array<float,2>{0.779602945f, 0.892708898f},
-std::array<float,2>{0.880172312f, 0.156351298f},
-std::array<float,2>{0.236091912f, 0.760646343f},
-std::array<float,2>{0.341278344f, 0.443078935f},
-std::array<float,2>{0.508682787f, 0.653415501f},
-std::array<float,2>{0.955349028f, 0.320825279f},
-std::array<float,2>{0.133411705f, 0.589964271f},
-std::array<float,2>{0.299049884f, 0.110197231f},
-std::array<float,2>{0.590171695f, 0.950770378f},
-std::array<float,2>{0.719122112f, 0.239811093f},
-std::array<float,2>{0.455299169f, 0.820336759f},
-std::array<float,2>{0.0270383321f, 0.378566116f},
-std::array<float,2>{0.858749986f, 0.719851017f},
-std::array<float,2>{0.536483347f, 0.470686853f},
-std::array<float,2>{0.367949694f, 0.662845016f},
-std::array<float,2>{0.188025311f, 0.125527367f},
-std::array<float,2>{0.916580021f, 0.806826532f},
-std::array<float,2>{0.803298891f, 0.0416057967f},
-std::array<float,2>{0.10710185f, 0.923238695f},
-std::array<float,2>{0.385636657f, 0.293861151f},
-std::array<float,2>{0.670021236f, 0.530314982f},
-std::array<float,2>{0.972844839f, 0.486323625f},
-std::array<float,2>{0.162927166f, 0.675101399f},
-std::array<float,2>{0.264639199f, 0.143630207f},
-std::array<float,2>{0.609326065f, 0.785990775f},
-std::array<float,2>{0.711224794f, 0.0521385819f},
-std::array<float,2>{0.495681137f, 0.916773796f},
-std::array<float,2>{0.0572802089f, 0.307372093f},
-std::array<float,2>{0.813881874f, 0.513982654f},
-std::array<float,2>{0.512445271f, 0.334575385f},
-std::array<float,2>{0.339533269f, 0.5693838f},
-std::array<float,2>{0.241707608f, 0.106404111f},
-std::array<float,2>{0.878648996f, 0.959662378f},
-std::array<float,2>{0.776963115f, 0.226382092f},
-std::array<float,2>{0.0851755515f, 0.843340933f},
-std::array<float,2>{0.437350363f, 0.398572087f},
-std::array<float,2>{0.636411309f, 0.739380002f},
-std::array<float,2>{0.853320777f, 0.274590313f},
-std::array<float,2>{0.031109849f, 0.537727475f},
-std::array<float,2>{0.460173905f, 0.0262124054f},
-std::array<float,2>{0.724016786f, 0.879803538f},
-std::array<float,2>{0.586781204f, 0.177691996f},
-std::array<float,2>{0.304480821f, 0.777968228f},
-std::array<float,2>{0.137555897f, 0.468016773f},
-std::array<float,2>{0.95978713f, 0.627028763f},
-std::array<float,2>{0.667496085f, 0.423170507f},
-std::array<float,2>{0.389988631f, 0.691125095f},
-std::array<float,2>{0.104348712f, 0.189236835f},
-std::array<float,2>{0.80013454f, 0.845427871f},
-std::array<float,2>{0.918845952f, 0.0822064951f},
-std::array<float,2>{0.194944099f, 0.992245257f},
-std::array<float,2>{0.37214306f, 0.348302305f},
-std::array<float,2>{0.531355858f, 0.617548287f},
-std::array<float,2>{0.784824193f, 0.389861226f},
-std::array<float,2>{0.111062743f, 0.732363403f},
-std::array<float,2>{0.396572828f, 0.244805783f},
-std::array<float,2>{0.675052345f, 0.812764168f},
-std::array<float,2>{0.561968088f, 0.121032096f},
-std::array<float,2>{0.351066947f, 0.939244151f},
-std::array<float,2>{0.209518477f, 0.319158316f},
-std::array<float,2>{0.930160582f, 0.585831583f},
-std::array<float,2>{0.73826468f, 0.285767615f},
-std::array<float,2>{0.441634595f, 0.518884063f},
-std::array<float,2>{0.0146725774f, 0.037706349f},
-std::array<float,2>{0.874940991f, 0.931679964f},
-std::array<float,2>{0.941994965f, 0.140155658f},
-std::array<float,2>{0.152434245f, 0.799776018f},
-std::array<float,2>{0.283940792f, 0.48217535f},
-std::array<float,2>{0.569135964f, 0.664777398f},
-std::array<float,2>{0.894469321f, 0.367480755f},
-std::array<float,2>{0.219357014f, 0.601341248f},
-std::array<float,2>{0.314006329f, 0.0716030002f},
-std::array<float,2>{0.529153228f, 0.982834995f},
-std::array<float,2>{0.648983538f, 0.214851424f},
-std::array<float,2>{0.412070245f, 0.861529529f},
-std::array<float,2>{0.0671086758f, 0.41409567f},
-std::array<float,2>{0.75383389f, 0.706710994f},
-std::array<float,2>{0.611176014f, 0.446611196f},
-std::array<float,2>{0.278323948f, 0.647863686f},
-std::array<float,2>{0.176396772f, 0.167094931f},
-std::array<float,2>{0.985375702f, 0.75180161f},
-std::array<float,2>{0.84314698f, 0.000410615263f},
-std::array<float,2>{0.0416741334f, 0.904309928f},
-std::array<float,2>{0.475234717f, 0.252380371f},
-std::array<float,2>{0.70014751f, 0.560329437f},
-std::array<float,2>{0.925444365f, 0.410510063f},
-std::array<float,2>{0.217435628f, 0.715698719f},
-std::array<float,2>{0.35167703f, 0.20560801f},
-std::array<float,2>{0.550743401f, 0.870751619f},
-std::array<float,2>{0.681137979f, 0.0694666505f},
-std::array<float,2>{0.402045101f, 0.975747585f},
-std::array<float,2>{0.12226072f, 0.359640002f},
-std::array<float,2>{0.790945292f, 0.606853604f},
-std::array<float,2>{0.571912289f, 0.262215763f},
-std::array<float,2>{0.293362439f, 0.547076821f},
-std::array<float,2>{0.145580977f, 0.0102644078f},
-std::array<float,2>{0.947355747f, 0.896987259f},
-std::array<float,2>{0.860476673f, 0.162893176f},
-std::array<float,2>{0.00625520712f, 0.763145447f},
-std::array<float,2>{0.445609987f, 0.440826744f},
-std::array<float,2>{0.747369289f, 0.650868833f},
-std::array<float,2>{0.760049701f, 0.324350208f},
-std::array<float,2>{0.0738021955f, 0.586816907f},
-std::array<float,2>{0.416441381f, 0.114667483f},
-std::array<float,2>{0.642775834f, 0.946071386f},
-std::array<float,2>{0.516279578f, 0.235404551f},
-std::array<float,2>{0.323676318f, 0.826332211f},
-std::array<float,2>{0.227683127f, 0.381724358f},
-std::array<float,2>{0.900223911f, 0.723402798f},
-std::array<float,2>{0.692728877f, 0.474998891f},
-std::array<float,2>{0.482900381f, 0.659368932f},
-std::array<float,2>{0.0351778865f, 0.132580876f},
-std::array<float,2>{0.830421805f, 0.809342206f},
-std::array<float,2>{0.998737633f, 0.0454957671f},
-std::array<float,2>{0.186773226f, 0.928735077f},
-std::array<float,2>{0.273131907f, 0.290720135f},
-std::array<float,2>{0.618586302f, 0.5250808f},
-std::array<float,2>{0.820387483f, 0.453586549f},
-std::array<float,2>{0.0473554097f, 0.636849046f},
-std::array<float,2>{0.48990804f, 0.186202198f},
-std::array<float,2>{0.709596395f, 0.768147767f},
-std::array<float,2>{0.597792029f, 0.0180256683f},
-std::array<float,2>{0.255855501f, 0.887109041f},
-std::array<float,2>{0.170837313f, 0.265847713f},
-std::array<float,2>{0.983900249f, 0.540573001f},
-std::array<float,2>{0.628412545f, 0.358451992f},
-std::array<float,2>{0.423512012f, 0.609873414f},
-std::array<float,2>{0.0864901096f, 0.0864104927f},
-std::array<float,2>{0.773356557f, 0.9850685f},
-std::array<float,2>{0.889326513f, 0.199251756f},
-std::array<float,2>{0.246113449f, 0.854991317f},
-std::array<float,2>{0.333004743f, 0.434125245f},
-std::array<float,2>{0.504719734f, 0.697360933f},
-std::array<float,2>{0.967517197f, 0.297840834f},
-std::array<float,2>{0.132454157f, 0.506060183f},
-std::array<float,2>{0.306703776f, 0.0595755167f},
-std::array<float,2>{0.582874417f, 0.910564959f},
-std::array<float,2>{0.734335721f, 0.150644526f},
-std::array<float,2>{0.461406678f, 0.794317961f},
-std::array<float,2>{0.0228259377f, 0.494588763f},
-std::array<float,2>{0.845955491f, 0.680379272f},
-std::array<float,2>{0.539351702f, 0.396170557f},
-std::array<float,2>{0.363254458f, 0.746458292f},
-std::array<float,2>{0.201445863f, 0.228296533f},
-std::array<float,2>{0.913560569f, 0.828305006f},
-std::array<float,2>{0.805811763f, 0.0997806713f},
-std::array<float,2>{0.100452825f, 0.968036473f},
-std::array<float,2>{0.380138457f, 0.343403816f},
-std::array<float,2>{0.662193954f, 0.57659328f},
-std::array<float,2>{0.949778974f, 0.404654056f},
-std::array<float,2>{0.142039761f, 0.735371888f},
-std::array<float,2>{0.29230231f, 0.219782397f},
-std::array<float,2>{0.577591062f, 0.83847928f},
-std::array<float,2>{0.746061742f, 0.103997193f},
-std::array<float,2>{0.451256067f, 0.953188658f},
-std::array<float,2>{0.00236852188f, 0.328294665f},
-std::array<float,2>{0.86686331f, 0.564222753f},
-std::array<float,2>{0.553120732f, 0.310880154f},
-std::array<float,2>{0.358523816f, 0.508273482f},
-std::array<float,2>{0.212695315f, 0.0506774411f},
-std::array<float,2>{0.929652512f, 0.918123007f},
-std::array<float,2>{0.795066416f, 0.14819856f},
-std::array<float,2>{0.117269248f, 0.784460068f},
-std::array<float,2>{0.403070062f, 0.490147561f},
-std::array<float,2>{0.687345922f, 0.678474367f},
-std::array<float,2>{0.835517466f, 0.344219983f},
-std::array<float,2>{0.0335165486f, 0.624213278f},
-std::array<float,2>{0.476908177f, 0.0818073228f},
-std::array<float,2>{0.689252555f, 0.996462941f},
-std::array<float,2>{0.622185767f, 0.195029944f},
-std::array<float,2>{0.26704666f, 0.851391256f},
-std::array<float,2>{0.18305406f, 0.427349657f},
-std::array<float,2>{0.996007323f, 0.693246305f},
-std::array<float,2>{0.64678061f, 0.461034745f},
-std::array<float,2>{0.418162972f, 0.630196512f},
-std::array<float,2>{0.0756728128f, 0.175354704f},
-std::array<float,2>{0.763497353f, 0.777130187f},
-std::array<float,2>{0.905255735f, 0.0308570787f},
-std::array<float,2>{0.234210521f, 0.87537837f},
-std::array<float,2>{0.325438261f, 0.280425042f},
-std::array<float,2>{0.520278513f, 0.531646192f},
-std::array<float,2>{0.766379833f, 0.478889942f},
-std::array<float,2>{0.0931732655f, 0.66972363f},
-std::array<float,2>{0.427862674f, 0.136027694f},
-std::array<float,2>{0.632173955f, 0.802282572f},
-std::array<float,2>{0.502248287f, 0.0317567401f},
-std::array<float,2>{0.330442607f, 0.935229659f},
-std::array<float,2>{0.245659545f, 0.282027483f},
-std::array<float,2>{0.882936954f, 0.519844472f},
-std::array<float,2>{0.706889808f, 0.316278458f},
-std::array<float,2>{0.486370087f, 0.578548133f},
-std::array<float,2>{0.0531896651f, 0.123161256f},
-std::array<float,2>{0.826612771f, 0.945259154f},
-std::array<float,2>{0.978851736f, 0.249665797f},
-std::array<float,2>{0.167583361f, 0.818233371f},
-std::array<float,2>{0.251473159f, 0.384501815f},
-std::array<float,2>{0.594845057f, 0.729736328f},
-std::array<float,2>{0.908109009f, 0.254276335f},
-std::array<float,2>{0.197266519f, 0.554702282f},
-std::array<float,2>{0.36445564f, 0.00681181904f},
-std::array<float,2>{0.546844602f, 0.901627302f},
-std::array<float,2>{0.659235716f, 0.169813469f},
-std::array<float,2>{0.376681477f, 0.75751102f},
-std::array<float,2>{0.0946878865f, 0.452185661f},
-std::array<float,2>{0.81089443f, 0.641951084f},
-std::array<float,2>{0.581228077f, 0.420663208f},
-std::array<float,2>{0.309616238f, 0.707335591f},
-std::array<float,2>{0.12888886f, 0.213040754f},
-std::array<float,2>{0.961766481f, 0.866864204f},
-std::array<float,2>{0.849615097f, 0.0749238282f},
-std::array<float,2>{0.0172310024f, 0.977508128f},
-std::array<float,2>{0.46840483f, 0.371508896f},
-std::array<float,2>{0.728365958f, 0.595528364f},
-std::array<float,2>{0.882095158f, 0.442188561f},
-std::array<float,2>{0.236462891f, 0.652671874f},
-std::array<float,2>{0.343317121f, 0.157342881f},
-std::array<float,2>{0.511679828f, 0.760956943f},
-std::array<float,2>{0.637956262f, 0.0146599142f},
-std::array<float,2>{0.431752592f, 0.893969119f},
-std::array<float,2>{0.0785305575f, 0.261639893f},
-std::array<float,2>{0.777520895f, 0.55247122f},
-std::array<float,2>{0.603588939f, 0.366694301f},
-std::array<float,2>{0.258274674f, 0.603327096f},
-std::array<float,2>{0.156250581f, 0.0629038587f},
-std::array<float,2>{0.970623791f, 0.971941888f},
-std::array<float,2>{0.816966295f, 0.21059376f},
-std::array<float,2>{0.0623766743f, 0.871772289f},
-std::array<float,2>{0.499841124f, 0.409399867f},
-std::array<float,2>{0.717424393f, 0.714604676f},
-std::array<float,2>{0.801648259f, 0.294905216f},
-std::array<float,2>{0.108851254f, 0.52969718f},
-std::array<float,2>{0.38349402f, 0.0428001881f},
-std::array<float,2>{0.668650448f, 0.9219684f},
-std::array<float,2>{0.538154066f, 0.12651819f},
-std::array<float,2>{0.370824456f, 0.807887971f},
-std::array<float,2>{0.190782532f, 0.468772024f},
-std::array<float,2>{0.915658176f, 0.663087845f},
-std::array<float,2>{0.72085613f, 0.37723586f},
-std::array<float,2>{0.453498632f, 0.718783915f},
-std::array<float,2>{0.0236804448f, 0.238769427f},
-std::array<float,2>{0.855806768f, 0.821623504f},
-std::array<float,2>{0.953337729f, 0.110975787f},
-std::array<float,2>{0.135629222f, 0.949459434f},
-std::array<float,2>{0.29721424f, 0.321477711f},
-std::array<float,2>{0.591837704f, 0.59112072f},
-std::array<float,2>{0.870562315f, 0.432769775f},
-std::array<float,2>{0.0081751449f, 0.701491594f},
-std::array<float,2>{0.440961689f, 0.195447981f},
-std::array<float,2>{0.740207314f, 0.856978714f},
-std::array<float,2>{0.565468729f, 0.0920847282f},
-std::array<float,2>{0.286809653f, 0.989778578f},
-std::array<float,2>{0.151876286f, 0.352541447f},
-std::array<float,2>{0.940238118f, 0.616448462f},
-std::array<float,2>{0.676162481f, 0.272464931f},
-std::array<float,2>{0.391187131f, 0.543584883f},
-std::array<float,2>{0.116101943f, 0.0213380177f},
-std::array<float,2>{0.788983643f, 0.884573877f},
-std::array<float,2>{0.936057687f, 0.180436507f},
-std::array<float,2>{0.204323515f, 0.770163536f},
-std::array<float,2>{0.344108135f, 0.457943231f},
-std::array<float,2>{0.556839526f, 0.635407746f},
-std::array<float,2>{0.989378631f, 0.337898105f},
-std::array<float,2>{0.174225822f, 0.571859658f},
-std::array<float,2>{0.275117606f, 0.0976247638f},
-std::array<float,2>{0.616847098f, 0.963501275f},
-std::array<float,2>{0.698168635f, 0.231192961f},
-std::array<float,2>{0.469943672f, 0.833942175f},
-std::array<float,2>{0.0460085124f, 0.391865999f},
-std::array<float,2>{0.837120056f, 0.745545805f},
-std::array<float,2>{0.523579299f, 0.497181147f},
-std::array<float,2>{0.320086896f, 0.685945094f},
-std::array<float,2>{0.222732976f, 0.156087443f},
-std::array<float,2>{0.897384346f, 0.7927019f},
-std::array<float,2>{0.756566346f, 0.058040332f},
-std::array<float,2>{0.0631220341f, 0.910119593f},
-std::array<float,2>{0.407577962f, 0.302784055f},
-std::array<float,2>{0.653332293f, 0.503045976f},
-std::array<float,2>{0.957135737f, 0.465531498f},
-std::array<float,2>{0.14022626f, 0.626087606f},
-std::array<float,2>{0.300966442f, 0.177815318f},
-std::array<float,2>{0.588035405f, 0.780266643f},
-std::array<float,2>{0.72653383f, 0.0250758808f},
-std::array<float,2>{0.457202822f, 0.882435083f},
-std::array<float,2>{0.0287489314f, 0.276663929f},
-std::array<float,2>{0.85533309f, 0.536094189f},
-std::array<float,2>{0.535104811f, 0.351315409f},
-std::array<float,2>{0.374310106f, 0.620794177f},
-std::array<float,2>{0.192601234f, 0.0839873627f},
-std::array<float,2>{0.921010077f, 0.995001793f},
-std::array<float,2>{0.796886086f, 0.18974714f},
-std::array<float,2>{0.102030799f, 0.846972704f},
-std::array<float,2>{0.38820681f, 0.425739527f},
-std::array<float,2>{0.665290117f, 0.688392699f},
-std::array<float,2>{0.815835953f, 0.305145621f},
-std::array<float,2>{0.0559966564f, 0.512330532f},
-std::array<float,2>{0.493380427f, 0.0539170951f},
-std::array<float,2>{0.714586258f, 0.915773571f},
-std::array<float,2>{0.606737554f, 0.140783966f},
-std::array<float,2>{0.262976468f, 0.78790468f},
-std::array<float,2>{0.160425991f, 0.486917049f},
-std::array<float,2>{0.975157797f, 0.672198892f},
-std::array<float,2>{0.633034825f, 0.400668114f},
-std::array<float,2>{0.434163839f, 0.740533471f},
-std::array<float,2>{0.0838532597f, 0.223569065f},
-std::array<float,2>{0.774092793f, 0.839935541f},
-std::array<float,2>{0.87592876f, 0.108171679f},
-std::array<float,2>{0.239017382f, 0.958575368f},
-std::array<float,2>{0.33777535f, 0.332195252f},
-std::array<float,2>{0.513863802f, 0.567912817f},
-std::array<float,2>{0.750999212f, 0.417428404f},
-std::array<float,2>{0.0691349879f, 0.703388393f},
-std::array<float,2>{0.413562477f, 0.217263684f},
-std::array<float,2>{0.652115047f, 0.859660149f},
-std::array<float,2>{0.529740095f, 0.0734946132f},
-std::array<float,2>{0.315739781f, 0.981360257f},
-std::array<float,2>{0.222372547f, 0.369832426f},
-std::array<float,2>{0.891589224f, 0.599549353f},
-std::array<float,2>{0.702006519f, 0.251103729f},
-std::array<float,2>{0.473187834f, 0.561764836f},
-std::array<float,2>{0.0396448188f, 0.00353584858f},
-std::array<float,2>{0.841612756f, 0.902994215f},
-std::array<float,2>{0.986945629f, 0.166014194f},
-std::array<float,2>{0.178255349f, 0.753528237f},
-std::array<float,2>{0.280182272f, 0.447748542f},
-std::array<float,2>{0.612601101f, 0.644970417f},
-std::array<float,2>{0.933580995f, 0.317958325f},
-std::array<float,2>{0.207560971f, 0.58227551f},
-std::array<float,2>{0.347732902f, 0.118844636f},
-std::array<float,2>{0.55993861f, 0.939835191f},
-std::array<float,2>{0.673291743f, 0.242497623f},
-std::array<float,2>{0.39460507f, 0.815881193f},
-std::array<float,2>{0.112529822f, 0.38861993f},
-std::array<float,2>{0.783037066f, 0.733026266f},
-std::array<float,2>{0.567510962f, 0.482715964f},
-std::array<float,2>{0.282837242f, 0.667186916f},
-std::array<float,2>{0.155279711f, 0.13752234f},
-std::array<float,2>{0.943764925f, 0.797196507f},
-std::array<float,2>{0.87292558f, 0.0369213335f},
-std::array<float,2>{0.0132966461f, 0.929998815f},
-std::array<float,2>{0.445230603f, 0.288525909f},
-std::array<float,2>{0.734774232f, 0.517188251f},
-std::array<float,2>{0.900481462f, 0.380058199f},
-std::array<float,2>{0.229251936f, 0.725625694f},
-std::array<float,2>{0.322240353f, 0.237917781f},
-std::array<float,2>{0.518006384f, 0.82600373f},
-std::array<float,2>{0.642495155f, 0.116810247f},
-std::array<float,2>{0.415529966f, 0.947450697f},
-std::array<float,2>{0.071259968f, 0.327653497f},
-std::array<float,2>{0.758295f, 0.58967644f},
-std::array<float,2>{0.620680869f, 0.292848855f},
-std::array<float,2>{0.270418137f, 0.525822401f},
-std::array<float,2>{0.185375229f, 0.0446757711f},
-std::array<float,2>{0.996764779f, 0.925945401f},
-std::array<float,2>{0.829569817f, 0.129038751f},
-std::array<float,2>{0.0371727943f, 0.81200242f},
-std::array<float,2>{0.482362479f, 0.474353701f},
-std::array<float,2>{0.694885612f, 0.657360971f},
-std::array<float,2>{0.792772412f, 0.361525208f},
-std::array<float,2>{0.124729529f, 0.608394325f},
-std::array<float,2>{0.399800867f, 0.0669970363f},
-std::array<float,2>{0.68317169f, 0.973969162f},
-std::array<float,2>{0.547998548f, 0.204823941f},
-std::array<float,2>{0.354796618f, 0.867385447f},
-std::array<float,2>{0.216068625f, 0.413111657f},
-std::array<float,2>{0.923309386f, 0.716861248f},
-std::array<float,2>{0.748285353f, 0.438394606f},
-std::array<float,2>{0.448219597f, 0.648571908f},
-std::array<float,2>{0.00497375987f, 0.160956487f},
-std::array<float,2>{0.862471521f, 0.764801621f},
-std::array<float,2>{0.945702434f, 0.00862225424f},
-std::array<float,2>{0.14702484f, 0.896116316f},
-std::array<float,2>{0.296330065f, 0.265308022f},
-std::array<float,2>{0.573407531f, 0.549206018f},
-std::array<float,2>{0.845246255f, 0.4936243f},
-std::array<float,2>{0.0196676739f, 0.68206948f},
-std::array<float,2>{0.464075029f, 0.150319278f},
-std::array<float,2>{0.732024014f, 0.795073926f},
-std::array<float,2>{0.585677028f, 0.0615045652f},
-std::array<float,2>{0.306563139f, 0.913416326f},
-std::array<float,2>{0.129610687f, 0.299744874f},
-std::array<float,2>{0.966360569f, 0.505549431f},
-std::array<float,2>{0.660702705f, 0.339858562f},
-std::array<float,2>{0.38213864f, 0.575304091f},
-std::array<float,2>{0.0977065489f, 0.0982881859f},
-std::array<float,2>{0.80804199f, 0.96587801f},
-std::array<float,2>{0.910779774f, 0.230326965f},
-std::array<float,2>{0.200013593f, 0.830866337f},
-std::array<float,2>{0.361049086f, 0.397034883f},
-std::array<float,2>{0.541845262f, 0.748758972f},
-std::array<float,2>{0.980712354f, 0.267608821f},
-std::array<float,2>{0.168651268f, 0.541800797f},
-std::array<float,2>{0.257421732f, 0.0172683597f},
-std::array<float,2>{0.599718571f, 0.889175355f},
-std::array<float,2>{0.708002627f, 0.184663296f},
-std::array<float,2>{0.491089672f, 0.767255843f},
-std::array<float,2>{0.0498181358f, 0.45595631f},
-std::array<float,2>{0.822703838f, 0.63969934f},
-std::array<float,2>{0.505877674f, 0.437486768f},
-std::array<float,2>{0.335876942f, 0.695596159f},
-std::array<float,2>{0.249433264f, 0.201533303f},
-std::array<float,2>{0.888297379f, 0.852611721f},
-std::array<float,2>{0.770383179f, 0.0892118514f},
-std::array<float,2>{0.0890605226f, 0.987338364f},
-std::array<float,2>{0.424056947f, 0.355814129f},
-std::array<float,2>{0.625234842f, 0.6126436f},
-std::array<float,2>{0.994101226f, 0.429294109f},
-std::array<float,2>{0.181135729f, 0.693603337f},
-std::array<float,2>{0.26910308f, 0.193326309f},
-std::array<float,2>{0.624876678f, 0.849419177f},
-std::array<float,2>{0.690344989f, 0.0791824386f},
-std::array<float,2>{0.480152816f, 0.999342859f},
-std::array<float,2>{0.0331914909f, 0.346248835f},
-std::array<float,2>{0.83300668f, 0.622597694f},
-std::array<float,2>{0.522071481f, 0.27882576f},
-std::array<float,2>{0.327048928f, 0.533482671f},
-std::array<float,2>{0.23081246f, 0.029002469f},
-std::array<float,2>{0.903261662f, 0.878312945f},
-std::array<float,2>{0.765621305f, 0.172813013f},
-std::array<float,2>{0.0780709609f, 0.774617732f},
-std::array<float,2>{0.421123713f, 0.463623047f},
-std::array<float,2>{0.644742131f, 0.63194418f},
-std::array<float,2>{0.86388588f, 0.331282675f},
-std::array<float,2>{0.000996812829f, 0.565228283f},
-std::array<float,2>{0.450936258f, 0.102376044f},
-std::array<float,2>{0.742408812f, 0.955958068f},
-std::array<float,2>{0.574639201f, 0.221702814f},
-std::array<float,2>{0.289086998f, 0.836567461f},
-std::array<float,2>{0.143494725f, 0.40375793f},
-std::array<float,2>{0.951815426f, 0.736832619f},
-std::array<float,2>{0.684239447f, 0.49185136f},
-std::array<float,2>{0.405906796f, 0.677413881f},
-std::array<float,2>{0.120482907f, 0.146449879f},
-std::array<float,2>{0.792975307f, 0.78205061f},
-std::array<float,2>{0.927604914f, 0.0482808053f},
-std::array<float,2>{0.213830858f, 0.921784222f},
-std::array<float,2>{0.355599791f, 0.310287893f},
-std::array<float,2>{0.552506804f, 0.511584461f},
-std::array<float,2>{0.80957365f, 0.450558096f},
-std::array<float,2>{0.096525453f, 0.644515276f},
-std::array<float,2>{0.378663361f, 0.171460032f},
-std::array<float,2>{0.657113969f, 0.754474938f},
-std::array<float,2>{0.543633401f, 0.00460687f},
-std::array<float,2>{0.367066741f, 0.899078786f},
-std::array<float,2>{0.196707219f, 0.25746268f},
-std::array<float,2>{0.909891248f, 0.557160676f},
-std::array<float,2>{0.729257822f, 0.374662101f},
-std::array<float,2>{0.465668023f, 0.595902026f},
-std::array<float,2>{0.017724121f, 0.0773286223f},
-std::array<float,2>{0.848347247f, 0.9801718f},
-std::array<float,2>{0.9634673f, 0.211782694f},
-std::array<float,2>{0.126770064f, 0.864703655f},
-std::array<float,2>{0.311779588f, 0.418007195f},
-std::array<float,2>{0.579359353f, 0.709215224f},
-std::array<float,2>{0.885532856f, 0.283742696f},
-std::array<float,2>{0.24410516f, 0.522985995f},
-std::array<float,2>{0.329273611f, 0.0350971483f},
-std::array<float,2>{0.500067472f, 0.93715471f},
-std::array<float,2>{0.630171776f, 0.132820353f},
-std::array<float,2>{0.426099598f, 0.802860439f},
-std::array<float,2>{0.0910883918f, 0.478118181f},
-std::array<float,2>{0.769221127f, 0.671469092f},
-std::array<float,2>{0.596236467f, 0.386505306f},
-std::array<float,2>{0.252695203f, 0.727161527f},
-std::array<float,2>{0.165468499f, 0.246156633f},
-std::array<float,2>{0.978323758f, 0.819060743f},
-std::array<float,2>{0.826110899f, 0.122106269f},
-std::array<float,2>{0.0515691936f, 0.941760838f},
-std::array<float,2>{0.485235542f, 0.314196497f},
-std::array<float,2>{0.703800976f, 0.580358863f},
-std::array<float,2>{0.917608619f, 0.470921695f},
-std::array<float,2>{0.189034432f, 0.660342216f},
-std::array<float,2>{0.368291467f, 0.127619565f},
-std::array<float,2>{0.53534317f, 0.805147171f},
-std::array<float,2>{0.671795845f, 0.0405359678f},
-std::array<float,2>{0.386555016f, 0.924334884f},
-std::array<float,2>{0.106327355f, 0.296254694f},
-std::array<float,2>{0.804018974f, 0.528588116f},
-std::array<float,2>{0.590857029f, 0.323586881f},
-std::array<float,2>{0.300009668f, 0.592789292f},
-std::array<float,2>{0.134080112f, 0.111719847f},
-std::array<float,2>{0.956067681f, 0.951255202f},
-std::array<float,2>{0.857440352f, 0.241271973f},
-std::array<float,2>{0.0256512109f, 0.823975384f},
-std::array<float,2>{0.456479609f, 0.37572664f},
-std::array<float,2>{0.719743967f, 0.72235167f},
-std::array<float,2>{0.78044647f, 0.258801252f},
-std::array<float,2>{0.0810170919f, 0.553457737f},
-std::array<float,2>{0.43039009f, 0.0133150648f},
-std::array<float,2>{0.639981329f, 0.892361581f},
-std::array<float,2>{0.509212852f, 0.159368515f},
-std::array<float,2>{0.340259105f, 0.757965267f},
-std::array<float,2>{0.234718144f, 0.444746733f},
-std::array<float,2>{0.879771829f, 0.654407918f},
-std::array<float,2>{0.715493619f, 0.407547206f},
-std::array<float,2>{0.496547788f, 0.712424457f},
-std::array<float,2>{0.0603347719f, 0.207827494f},
-std::array<float,2>{0.818701804f, 0.87346518f},
-std::array<float,2>{0.971133649f, 0.0658960342f},
-std::array<float,2>{0.159744069f, 0.969557524f},
-std::array<float,2>{0.260024816f, 0.364403397f},
-std::array<float,2>{0.603144467f, 0.605143249f},
-std::array<float,2>{0.838998854f, 0.393368006f},
-std::array<float,2>{0.0435868613f, 0.743200362f},
-std::array<float,2>{0.471623003f, 0.233086944f},
-std::array<float,2>{0.696675658f, 0.835129499f},
-std::array<float,2>{0.614956617f, 0.0938892215f},
-std::array<float,2>{0.276660025f, 0.962801337f},
-std::array<float,2>{0.171955645f, 0.336559534f},
-std::array<float,2>{0.991778553f, 0.572981536f},
-std::array<float,2>{0.654910266f, 0.301955789f},
-std::array<float,2>{0.408915251f, 0.501707911f},
-std::array<float,2>{0.0644640326f, 0.0556949005f},
-std::array<float,2>{0.754591465f, 0.9080742f},
-std::array<float,2>{0.896093845f, 0.152662009f},
-std::array<float,2>{0.224680856f, 0.789612651f},
-std::array<float,2>{0.31764397f, 0.499492347f},
-std::array<float,2>{0.52565062f, 0.685253024f},
-std::array<float,2>{0.938058913f, 0.355123907f},
-std::array<float,2>{0.149192542f, 0.61508286f},
-std::array<float,2>{0.287656754f, 0.0906514376f},
-std::array<float,2>{0.562907934f, 0.991367102f},
-std::array<float,2>{0.741870046f, 0.197315335f},
-std::array<float,2>{0.437895298f, 0.857668996f},
-std::array<float,2>{0.0100218477f, 0.43118453f},
-std::array<float,2>{0.86807549f, 0.6994645f},
-std::array<float,2>{0.555260837f, 0.459912568f},
-std::array<float,2>{0.346372575f, 0.633880973f},
-std::array<float,2>{0.205184668f, 0.181860045f},
-std::array<float,2>{0.934167266f, 0.772861123f},
-std::array<float,2>{0.786685705f, 0.0226227809f},
-std::array<float,2>{0.114712782f, 0.886070311f},
-std::array<float,2>{0.394145876f, 0.270664245f},
-std::array<float,2>{0.678797603f, 0.545601428f},
-std::array<float,2>{0.983460844f, 0.455478162f},
-std::array<float,2>{0.170022011f, 0.640161514f},
-std::array<float,2>{0.254955381f, 0.185167104f},
-std::array<float,2>{0.598599195f, 0.766613662f},
-std::array<float,2>{0.709194481f, 0.0168368816f},
-std::array<float,2>{0.489475489f, 0.888834119f},
-std::array<float,2>{0.0475394726f, 0.268192142f},
-std::array<float,2>{0.821087778f, 0.541423321f},
-std::array<float,2>{0.50400722f, 0.356259942f},
-std::array<float,2>{0.332155228f, 0.612889051f},
-std::array<float,2>{0.247051686f, 0.0895292759f},
-std::array<float,2>{0.889147282f, 0.987965167f},
-std::array<float,2>{0.772837102f, 0.202073544f},
-std::array<float,2>{0.0860020146f, 0.853122056f},
-std::array<float,2>{0.422937036f, 0.436623573f},
-std::array<float,2>{0.628480136f, 0.695986807f},
-std::array<float,2>{0.846649528f, 0.299247444f},
-std::array<float,2>{0.0230743103f, 0.505190492f},
-std::array<float,2>{0.461806685f, 0.0606549717f},
-std::array<float,2>{0.733433127f, 0.913823724f},
-std::array<float,2>{0.582502067f, 0.14981328f},
-std::array<float,2>{0.307147115f, 0.795747936f},
-std::array<float,2>{0.13210997f, 0.493946522f},
-std::array<float,2>{0.966958523f, 0.682443202f},
-std::array<float,2>{0.662677169f, 0.396954834f},
-std::array<float,2>{0.380621463f, 0.748372436f},
-std::array<float,2>{0.0998985693f, 0.22957851f},
-std::array<float,2>{0.806564867f, 0.830347955f},
-std::array<float,2>{0.913726747f, 0.0978534594f},
-std::array<float,2>{0.201703742f, 0.966669738f},
-std::array<float,2>{0.362542391f, 0.340704978f},
-std::array<float,2>{0.539721489f, 0.575851619f},
-std::array<float,2>{0.790360868f, 0.413611144f},
-std::array<float,2>{0.122692682f, 0.717700958f},
-std::array<float,2>{0.401587933f, 0.204344615f},
-std::array<float,2>{0.68151933f, 0.867846906f},
-std::array<float,2>{0.549858391f, 0.0665758401f},
-std::array<float,2>{0.352089494f, 0.974268436f},
-std::array<float,2>{0.216972962f, 0.362286538f},
-std::array<float,2>{0.924806178f, 0.60777539f},
-std::array<float,2>{0.747874975f, 0.264871269f},
-std::array<float,2>{0.446177512f, 0.549594283f},
-std::array<float,2>{0.00672802795f, 0.00826261565f},
-std::array<float,2>{0.860990644f, 0.895872414f},
-std::array<float,2>{0.948074162f, 0.160590082f},
-std::array<float,2>{0.146255881f, 0.765146315f},
-std::array<float,2>{0.293779969f, 0.437987506f},
-std::array<float,2>{0.571441531f, 0.649001122f},
-std::array<float,2>{0.899467766f, 0.327635616f},
-std::array<float,2>{0.228460521f, 0.589008749f},
-std::array<float,2>{0.324127495f, 0.116365604f},
-std::array<float,2>{0.5159235f, 0.947779f},
-std::array<float,2>{0.643276036f, 0.237401009f},
-std::array<float,2>{0.416739732f, 0.825425565f},
-std::array<float,2>{0.0736789778f, 0.380590081f},
-std::array<float,2>{0.760425448f, 0.726288676f},
-std::array<float,2>{0.618904412f, 0.473742515f},
-std::array<float,2>{0.272917837f, 0.657972336f},
-std::array<float,2>{0.187457219f, 0.129780874f},
-std::array<float,2>{0.998403907f, 0.81233108f},
-std::array<float,2>{0.83094269f, 0.0439658016f},
-std::array<float,2>{0.0360196419f, 0.926286459f},
-std::array<float,2>{0.483148634f, 0.292070121f},
-std::array<float,2>{0.693319678f, 0.526187956f},
-std::array<float,2>{0.930565774f, 0.387750655f},
-std::array<float,2>{0.209335908f, 0.732729912f},
-std::array<float,2>{0.351257086f, 0.243030861f},
-std::array<float,2>{0.562449157f, 0.816334307f},
-std::array<float,2>{0.675387919f, 0.118179575f},
-std::array<float,2>{0.397114187f, 0.939945877f},
-std::array<float,2>{0.11065466f, 0.317408204f},
-std::array<float,2>{0.78418535f, 0.582793653f},
-std::array<float,2>{0.568826079f, 0.288599104f},
-std::array<float,2>{0.283662111f, 0.516944468f},
-std::array<float,2>{0.153249964f, 0.0363797285f},
-std::array<float,2>{0.941748679f, 0.930196762f},
-std::array<float,2>{0.874257684f, 0.136900052f},
-std::array<float,2>{0.0154976025f, 0.797380328f},
-std::array<float,2>{0.441942036f, 0.483127087f},
-std::array<float,2>{0.737500727f, 0.667828858f},
-std::array<float,2>{0.75313133f, 0.369360238f},
-std::array<float,2>{0.0664072409f, 0.599096835f},
-std::array<float,2>{0.411407948f, 0.0741389096f},
-std::array<float,2>{0.64874512f, 0.980883479f},
-std::array<float,2>{0.528662801f, 0.217431292f},
-std::array<float,2>{0.313694328f, 0.860127211f},
-std::array<float,2>{0.218864813f, 0.417540967f},
-std::array<float,2>{0.8938604f, 0.704039812f},
-std::array<float,2>{0.699380338f, 0.448074132f},
-std::array<float,2>{0.474951178f, 0.645198882f},
-std::array<float,2>{0.0411763191f, 0.165389806f},
-std::array<float,2>{0.843270779f, 0.753408253f},
-std::array<float,2>{0.98624599f, 0.0033038184f},
-std::array<float,2>{0.176265389f, 0.902821183f},
-std::array<float,2>{0.278967172f, 0.251665205f},
-std::array<float,2>{0.610551715f, 0.562035143f},
-std::array<float,2>{0.814376652f, 0.486700624f},
-std::array<float,2>{0.0567285009f, 0.672376513f},
-std::array<float,2>{0.495519847f, 0.141203761f},
-std::array<float,2>{0.711613655f, 0.787539482f},
-std::array<float,2>{0.60868299f, 0.0544874817f},
-std::array<float,2>{0.263843596f, 0.915273309f},
-std::array<float,2>{0.16221714f, 0.30535695f},
-std::array<float,2>{0.97362864f, 0.512048125f},
-std::array<float,2>{0.636154413f, 0.332877815f},
-std::array<float,2>{0.436709464f, 0.567539036f},
-std::array<float,2>{0.0858313963f, 0.107428096f},
-std::array<float,2>{0.776419044f, 0.958019495f},
-std::array<float,2>{0.878333271f, 0.222865075f},
-std::array<float,2>{0.241357967f, 0.840781748f},
-std::array<float,2>{0.339238197f, 0.401241094f},
-std::array<float,2>{0.511933804f, 0.741055369f},
-std::array<float,2>{0.959349155f, 0.277154714f},
-std::array<float,2>{0.137131229f, 0.535281241f},
-std::array<float,2>{0.303717285f, 0.0244261865f},
-std::array<float,2>{0.586365879f, 0.881928205f},
-std::array<float,2>{0.724126577f, 0.178548381f},
-std::array<float,2>{0.460468978f, 0.779566407f},
-std::array<float,2>{0.0307296086f, 0.465062112f},
-std::array<float,2>{0.85269624f, 0.626780212f},
-std::array<float,2>{0.532141328f, 0.425018609f},
-std::array<float,2>{0.372721016f, 0.687563837f},
-std::array<float,2>{0.194652572f, 0.19003883f},
-std::array<float,2>{0.918048441f, 0.847435355f},
-std::array<float,2>{0.800346673f, 0.0848392323f},
-std::array<float,2>{0.103622288f, 0.994175971f},
-std::array<float,2>{0.390318632f, 0.350717932f},
-std::array<float,2>{0.667447984f, 0.620476663f},
-std::array<float,2>{0.939787328f, 0.430696011f},
-std::array<float,2>{0.151380986f, 0.700035274f},
-std::array<float,2>{0.286477536f, 0.197999835f},
-std::array<float,2>{0.565931857f, 0.858230531f},
-std::array<float,2>{0.739541173f, 0.090283826f},
-std::array<float,2>{0.440500289f, 0.991886318f},
-std::array<float,2>{0.00845721643f, 0.354955465f},
-std::array<float,2>{0.870899141f, 0.614442647f},
-std::array<float,2>{0.557346225f, 0.27140677f},
-std::array<float,2>{0.34471029f, 0.544976175f},
-std::array<float,2>{0.204842031f, 0.0233645178f},
-std::array<float,2>{0.935905635f, 0.886422515f},
-std::array<float,2>{0.788378239f, 0.182336971f},
-std::array<float,2>{0.115353413f, 0.773344994f},
-std::array<float,2>{0.390653223f, 0.459075511f},
-std::array<float,2>{0.676528037f, 0.634511411f},
-std::array<float,2>{0.837519705f, 0.336059302f},
-std::array<float,2>{0.0468442105f, 0.572327018f},
-std::array<float,2>{0.470480531f, 0.0942452699f},
-std::array<float,2>{0.697362006f, 0.962161779f},
-std::array<float,2>{0.616679668f, 0.232524365f},
-std::array<float,2>{0.274727911f, 0.835667491f},
-std::array<float,2>{0.174737498f, 0.392914206f},
-std::array<float,2>{0.990031838f, 0.744044304f},
-std::array<float,2>{0.653811216f, 0.499797195f},
-std::array<float,2>{0.408038378f, 0.684700966f},
-std::array<float,2>{0.0626182184f, 0.153120056f},
-std::array<float,2>{0.756220281f, 0.789547861f},
-std::array<float,2>{0.896827161f, 0.0564137213f},
-std::array<float,2>{0.223313496f, 0.907256782f},
-std::array<float,2>{0.319648117f, 0.302429527f},
-std::array<float,2>{0.523992777f, 0.501152217f},
-std::array<float,2>{0.777926326f, 0.44515422f},
-std::array<float,2>{0.0789884254f, 0.655048788f},
-std::array<float,2>{0.432280064f, 0.159982413f},
-std::array<float,2>{0.638610303f, 0.758466065f},
-std::array<float,2>{0.510979593f, 0.0127333542f},
-std::array<float,2>{0.343188316f, 0.892054558f},
-std::array<float,2>{0.237262651f, 0.259664744f},
-std::array<float,2>{0.882382631f, 0.552822292f},
-std::array<float,2>{0.717105985f, 0.364832073f},
-std::array<float,2>{0.499263912f, 0.6049546f},
-std::array<float,2>{0.0617356822f, 0.0662131831f},
-std::array<float,2>{0.816747785f, 0.968973458f},
-std::array<float,2>{0.969864964f, 0.207506597f},
-std::array<float,2>{0.15699324f, 0.873568118f},
-std::array<float,2>{0.258454949f, 0.408194661f},
-std::array<float,2>{0.604119182f, 0.712023735f},
-std::array<float,2>{0.915426731f, 0.296472907f},
-std::array<float,2>{0.191030324f, 0.529052854f},
-std::array<float,2>{0.370569944f, 0.0401729867f},
-std::array<float,2>{0.538958728f, 0.92415905f},
-std::array<float,2>{0.668352544f, 0.127406865f},
-std::array<float,2>{0.382823467f, 0.805454195f},
-std::array<float,2>{0.109272361f, 0.471595526f},
-std::array<float,2>{0.801134884f, 0.660760403f},
-std::array<float,2>{0.592531323f, 0.375111878f},
-std::array<float,2>{0.297835529f, 0.721754968f},
-std::array<float,2>{0.135240182f, 0.242181122f},
-std::array<float,2>{0.95405978f, 0.823641539f},
-std::array<float,2>{0.856250644f, 0.112201691f},
-std::array<float,2>{0.024338169f, 0.951791644f},
-std::array<float,2>{0.4540371f, 0.324126631f},
-std::array<float,2>{0.721484303f, 0.593320012f},
-std::array<float,2>{0.88350606f, 0.477972507f},
-std::array<float,2>{0.245166078f, 0.670990825f},
-std::array<float,2>{0.330875248f, 0.133579805f},
-std::array<float,2>{0.502901196f, 0.803353548f},
-std::array<float,2>{0.632635057f, 0.0343867354f},
-std::array<float,2>{0.428288639f, 0.936781824f},
-std::array<float,2>{0.0936589763f, 0.28339532f},
-std::array<float,2>{0.765845954f, 0.522778392f},
-std::array<float,2>{0.595685899f, 0.313513577f},
-std::array<float,2>{0.251330078f, 0.580762446f},
-std::array<float,2>{0.167448997f, 0.122644462f},
-std::array<float,2>{0.979318023f, 0.942273855f},
-std::array<float,2>{0.826669812f, 0.246715501f},
-std::array<float,2>{0.0535513461f, 0.818618953f},
-std::array<float,2>{0.486911565f, 0.385901123f},
-std::array<float,2>{0.706249416f, 0.726920009f},
-std::array<float,2>{0.811324179f, 0.25687471f},
-std::array<float,2>{0.0939726755f, 0.556886196f},
-std::array<float,2>{0.376027375f, 0.00392577006f},
-std::array<float,2>{0.659932792f, 0.898883939f},
-std::array<float,2>{0.546116412f, 0.171300218f},
-std::array<float,2>{0.365191787f, 0.754175663f},
-std::array<float,2>{0.197806969f, 0.450923324f},
-std::array<float,2>{0.907321274f, 0.64362669f},
-std::array<float,2>{0.728011489f, 0.418860108f},
-std::array<float,2>{0.468151093f, 0.709538996f},
-std::array<float,2>{0.016976703f, 0.210999936f},
-std::array<float,2>{0.850485444f, 0.864881039f},
-std::array<float,2>{0.96103394f, 0.07809861f},
-std::array<float,2>{0.128035799f, 0.979631782f},
-std::array<float,2>{0.310327798f, 0.374101996f},
-std::array<float,2>{0.58191067f, 0.596317947f},
-std::array<float,2>{0.866330624f, 0.40405798f},
-std::array<float,2>{0.0025626861f, 0.736487091f},
-std::array<float,2>{0.451863617f, 0.222454518f},
-std::array<float,2>{0.745545447f, 0.836006403f},
-std::array<float,2>{0.577891707f, 0.101768635f},
-std::array<float,2>{0.292926192f, 0.955097437f},
-std::array<float,2>{0.142124668f, 0.331857532f},
-std::array<float,2>{0.94923383f, 0.564728618f},
-std::array<float,2>{0.686723232f, 0.30966723f},
-std::array<float,2>{0.402537197f, 0.510862648f},
-std::array<float,2>{0.117798015f, 0.0488019809f},
-std::array<float,2>{0.795472741f, 0.920997858f},
-std::array<float,2>{0.928808153f, 0.145751864f},
-std::array<float,2>{0.212401479f, 0.781334341f},
-std::array<float,2>{0.359195501f, 0.49157694f},
-std::array<float,2>{0.553440034f, 0.677067161f},
-std::array<float,2>{0.995451212f, 0.346079886f},
-std::array<float,2>{0.1833653f, 0.622074664f},
-std::array<float,2>{0.267452121f, 0.0800566003f},
-std::array<float,2>{0.622876108f, 0.999602199f},
-std::array<float,2>{0.688527524f, 0.192488536f},
-std::array<float,2>{0.477520525f, 0.848865032f},
-std::array<float,2>{0.0339384526f, 0.429169238f},
-std::array<float,2>{0.835413933f, 0.694260657f},
-std::array<float,2>{0.519856751f, 0.463109165f},
-std::array<float,2>{0.325887591f, 0.632748842f},
-std::array<float,2>{0.23352614f, 0.172101185f},
-std::array<float,2>{0.904364526f, 0.774985313f},
-std::array<float,2>{0.762925982f, 0.0286846738f},
-std::array<float,2>{0.0760442689f, 0.878815651f},
-std::array<float,2>{0.41870755f, 0.278659314f},
-std::array<float,2>{0.647368789f, 0.534145653f},
-std::array<float,2>{0.966183841f, 0.494727105f},
-std::array<float,2>{0.129279375f, 0.680083573f},
-std::array<float,2>{0.306067973f, 0.150966555f},
-std::array<float,2>{0.585285306f, 0.794438362f},
-std::array<float,2>{0.731609404f, 0.0600814186f},
-std::array<float,2>{0.46472162f, 0.910846591f},
-std::array<float,2>{0.0201259516f, 0.296959102f},
-std::array<float,2>{0.845143378f, 0.506548882f},
-std::array<float,2>{0.541408181f, 0.34283635f},
-std::array<float,2>{0.360789984f, 0.57698071f},
-std::array<float,2>{0.199620664f, 0.100294814f},
-std::array<float,2>{0.910422087f, 0.968378961f},
-std::array<float,2>{0.808140397f, 0.227995634f},
-std::array<float,2>{0.0985147357f, 0.829020202f},
-std::array<float,2>{0.382612884f, 0.395895392f},
-std::array<float,2>{0.660233676f, 0.746818602f},
-std::array<float,2>{0.823091745f, 0.266303927f},
-std::array<float,2>{0.0507062115f, 0.540308654f},
-std::array<float,2>{0.490265906f, 0.0182722155f},
-std::array<float,2>{0.707135797f, 0.887434661f},
-std::array<float,2>{0.600313187f, 0.185656846f},
-std::array<float,2>{0.257063627f, 0.767786741f},
-std::array<float,2>{0.168346703f, 0.454089582f},
-std::array<float,2>{0.981381357f, 0.637658477f},
-std::array<float,2>{0.625786006f, 0.43374303f},
-std::array<float,2>{0.424425125f, 0.698221803f},
-std::array<float,2>{0.0895770565f, 0.199923858f},
-std::array<float,2>{0.769681156f, 0.85450542f},
-std::array<float,2>{0.887792528f, 0.086880289f},
-std::array<float,2>{0.249973521f, 0.984832823f},
-std::array<float,2>{0.335400313f, 0.359374315f},
-std::array<float,2>{0.506395817f, 0.609592378f},
-std::array<float,2>{0.758373857f, 0.381265014f},
-std::array<float,2>{0.0707305372f, 0.722871959f},
-std::array<float,2>{0.415057927f, 0.23586756f},
-std::array<float,2>{0.641615212f, 0.826802075f},
-std::array<float,2>{0.518488288f, 0.115081929f},
-std::array<float,2>{0.321759433f, 0.945708811f},
-std::array<float,2>{0.228719935f, 0.325181812f},
-std::array<float,2>{0.901215851f, 0.586304307f},
-std::array<float,2>{0.694702983f, 0.290188432f},
-std::array<float,2>{0.481547832f, 0.524519086f},
-std::array<float,2>{0.0376826264f, 0.0451911055f},
-std::array<float,2>{0.82974571f, 0.929509401f},
-std::array<float,2>{0.996545792f, 0.132310733f},
-std::array<float,2>{0.184977233f, 0.808872998f},
-std::array<float,2>{0.269870847f, 0.475492835f},
-std::array<float,2>{0.620590866f, 0.659727454f},
-std::array<float,2>{0.923588991f, 0.359950721f},
-std::array<float,2>{0.216710061f, 0.606972635f},
-std::array<float,2>{0.355422825f, 0.0699410588f},
-std::array<float,2>{0.548360109f, 0.976480365f},
-std::array<float,2>{0.682618856f, 0.205455303f},
-std::array<float,2>{0.400098711f, 0.870347857f},
-std::array<float,2>{0.124505952f, 0.410728216f},
-std::array<float,2>{0.792155385f, 0.714984953f},
-std::array<float,2>{0.573735178f, 0.44120422f},
-std::array<float,2>{0.29671368f, 0.651072443f},
-std::array<float,2>{0.146770477f, 0.162356645f},
-std::array<float,2>{0.9461357f, 0.763414323f},
-std::array<float,2>{0.862961709f, 0.00978443213f},
-std::array<float,2>{0.00541198254f, 0.896774411f},
-std::array<float,2>{0.447604358f, 0.262069225f},
-std::array<float,2>{0.748959184f, 0.547562063f},
-std::array<float,2>{0.891058922f, 0.414940029f},
-std::array<float,2>{0.221800357f, 0.70644021f},
-std::array<float,2>{0.316095352f, 0.215654284f},
-std::array<float,2>{0.529873669f, 0.861852169f},
-std::array<float,2>{0.651641488f, 0.072152473f},
-std::array<float,2>{0.41358462f, 0.983058095f},
-std::array<float,2>{0.0683734864f, 0.368080437f},
-std::array<float,2>{0.751650751f, 0.600969732f},
-std::array<float,2>{0.613002539f, 0.252445042f},
-std::array<float,2>{0.279536307f, 0.55991137f},
-std::array<float,2>{0.178077474f, 0.000942900893f},
-std::array<float,2>{0.986728609f, 0.905135036f},
-std::array<float,2>{0.841213048f, 0.16755791f},
-std::array<float,2>{0.0394043252f, 0.751182199f},
-std::array<float,2>{0.473120064f, 0.447073847f},
-std::array<float,2>{0.701275051f, 0.648241103f},
-std::array<float,2>{0.782322049f, 0.318710864f},
-std::array<float,2>{0.113038078f, 0.585208476f},
-std::array<float,2>{0.395185649f, 0.120181136f},
-std::array<float,2>{0.673575044f, 0.938792288f},
-std::array<float,2>{0.560226917f, 0.244399816f},
-std::array<float,2>{0.348567784f, 0.813439727f},
-std::array<float,2>{0.207431823f, 0.390524685f},
-std::array<float,2>{0.932734549f, 0.73154968f},
-std::array<float,2>{0.735299468f, 0.481804848f},
-std::array<float,2>{0.444728702f, 0.664456367f},
-std::array<float,2>{0.0131790247f, 0.140121743f},
-std::array<float,2>{0.872429252f, 0.79924494f},
-std::array<float,2>{0.94415307f, 0.0371376164f},
-std::array<float,2>{0.156177312f, 0.932274401f},
-std::array<float,2>{0.282584339f, 0.285589278f},
-std::array<float,2>{0.568194211f, 0.519400239f},
-std::array<float,2>{0.854621291f, 0.468363136f},
-std::array<float,2>{0.0292083491f, 0.627850652f},
-std::array<float,2>{0.457794547f, 0.176838681f},
-std::array<float,2>{0.725741148f, 0.777799785f},
-std::array<float,2>{0.588804185f, 0.0258046798f},
-std::array<float,2>{0.301409036f, 0.879207492f},
-std::array<float,2>{0.139792442f, 0.275273412f},
-std::array<float,2>{0.957851946f, 0.537417471f},
-std::array<float,2>{0.665754855f, 0.347860873f},
-std::array<float,2>{0.387996793f, 0.617772102f},
-std::array<float,2>{0.102310643f, 0.0826288015f},
-std::array<float,2>{0.797797561f, 0.992946267f},
-std::array<float,2>{0.921692967f, 0.188579872f},
-std::array<float,2>{0.193285108f, 0.844771087f},
-std::array<float,2>{0.374938577f, 0.423680037f},
-std::array<float,2>{0.53423059f, 0.690609694f},
-std::array<float,2>{0.974743664f, 0.306742311f},
-std::array<float,2>{0.160865411f, 0.514368713f},
-std::array<float,2>{0.263194591f, 0.052513849f},
-std::array<float,2>{0.607044816f, 0.916483879f},
-std::array<float,2>{0.714316547f, 0.144175217f},
-std::array<float,2>{0.493937194f, 0.785424829f},
-std::array<float,2>{0.056581527f, 0.485636055f},
-std::array<float,2>{0.816228628f, 0.67571646f},
-std::array<float,2>{0.514415205f, 0.3993541f},
-std::array<float,2>{0.337033123f, 0.740160882f},
-std::array<float,2>{0.238755718f, 0.225826129f},
-std::array<float,2>{0.875339448f, 0.843188882f},
-std::array<float,2>{0.773746908f, 0.105839834f},
-std::array<float,2>{0.0833594427f, 0.959295571f},
-std::array<float,2>{0.433835089f, 0.334017903f},
-std::array<float,2>{0.633446395f, 0.570063472f},
-std::array<float,2>{0.991580486f, 0.392526716f},
-std::array<float,2>{0.172487095f, 0.746090829f},
-std::array<float,2>{0.277143031f, 0.230739996f},
-std::array<float,2>{0.6142717f, 0.83316803f},
-std::array<float,2>{0.697167993f, 0.0968387946f},
-std::array<float,2>{0.471157342f, 0.962924778f},
-std::array<float,2>{0.043456316f, 0.33853969f},
-std::array<float,2>{0.83939749f, 0.571546674f},
-std::array<float,2>{0.526355922f, 0.303678155f},
-std::array<float,2>{0.318095684f, 0.50386703f},
-std::array<float,2>{0.225197732f, 0.0585469455f},
-std::array<float,2>{0.895597041f, 0.909372032f},
-std::array<float,2>{0.753982008f, 0.155308947f},
-std::array<float,2>{0.0653829426f, 0.792003393f},
-std::array<float,2>{0.408234984f, 0.497607112f},
-std::array<float,2>{0.654507279f, 0.686205268f},
-std::array<float,2>{0.867315531f, 0.35348925f},
-std::array<float,2>{0.010441984f, 0.61707437f},
-std::array<float,2>{0.4382312f, 0.0926975682f},
-std::array<float,2>{0.741448581f, 0.98968488f},
-std::array<float,2>{0.563228369f, 0.196108416f},
-std::array<float,2>{0.287345916f, 0.856778026f},
-std::array<float,2>{0.148894534f, 0.433339477f},
-std::array<float,2>{0.93757385f, 0.702135503f},
-std::array<float,2>{0.679536343f, 0.457302064f},
-std::array<float,2>{0.393817961f, 0.634925187f},
-std::array<float,2>{0.114771277f, 0.179706827f},
-std::array<float,2>{0.786280215f, 0.769613624f},
-std::array<float,2>{0.933819115f, 0.0208610483f},
-std::array<float,2>{0.205706239f, 0.884229422f},
-std::array<float,2>{0.345847934f, 0.273207635f},
-std::array<float,2>{0.554832399f, 0.543418229f},
-std::array<float,2>{0.804422975f, 0.46963945f},
-std::array<float,2>{0.105805151f, 0.663685322f},
-std::array<float,2>{0.386221111f, 0.126332164f},
-std::array<float,2>{0.67108506f, 0.808214486f},
-std::array<float,2>{0.535914242f, 0.0424578786f},
-std::array<float,2>{0.368794918f, 0.922507524f},
-std::array<float,2>{0.188857928f, 0.294272155f},
-std::array<float,2>{0.917115927f, 0.529820681f},
-std::array<float,2>{0.720698059f, 0.32201618f},
-std::array<float,2>{0.456986219f, 0.591791391f},
-std::array<float,2>{0.0263286084f, 0.110429086f},
-std::array<float,2>{0.858140945f, 0.950041294f},
-std::array<float,2>{0.956727147f, 0.238898814f},
-std::array<float,2>{0.134618223f, 0.822089791f},
-std::array<float,2>{0.300419122f, 0.377803475f},
-std::array<float,2>{0.591352999f, 0.719426572f},
-std::array<float,2>{0.87922895f, 0.261111975f},
-std::array<float,2>{0.235310331f, 0.551777065f},
-std::array<float,2>{0.340815276f, 0.0152469072f},
-std::array<float,2>{0.50964874f, 0.894311666f},
-std::array<float,2>{0.640170693f, 0.157895252f},
-std::array<float,2>{0.429727823f, 0.7613675f},
-std::array<float,2>{0.0803516135f, 0.441552341f},
-std::array<float,2>{0.781184375f, 0.652929306f},
-std::array<float,2>{0.602734625f, 0.410128504f},
-std::array<float,2>{0.26067999f, 0.714294851f},
-std::array<float,2>{0.159186915f, 0.210132182f},
-std::array<float,2>{0.971434236f, 0.871484518f},
-std::array<float,2>{0.818856537f, 0.0634657443f},
-std::array<float,2>{0.0596976541f, 0.972614706f},
-std::array<float,2>{0.496903777f, 0.366932184f},
-std::array<float,2>{0.715130925f, 0.602888823f},
-std::array<float,2>{0.909269094f, 0.452797443f},
-std::array<float,2>{0.197196215f, 0.642539918f},
-std::array<float,2>{0.366600037f, 0.169150814f},
-std::array<float,2>{0.543246567f, 0.75708127f},
-std::array<float,2>{0.656611025f, 0.00612633489f},
-std::array<float,2>{0.378329098f, 0.902117729f},
-std::array<float,2>{0.0958381891f, 0.254458666f},
-std::array<float,2>{0.81008631f, 0.555626512f},
-std::array<float,2>{0.579966486f, 0.371719658f},
-std::array<float,2>{0.312191099f, 0.594973981f},
-std::array<float,2>{0.12641342f, 0.0745404363f},
-std::array<float,2>{0.963296115f, 0.976852f},
-std::array<float,2>{0.847978413f, 0.21374549f},
-std::array<float,2>{0.0180732198f, 0.86621201f},
-std::array<float,2>{0.465138316f, 0.420017511f},
-std::array<float,2>{0.728752017f, 0.707912266f},
-std::array<float,2>{0.768811941f, 0.281532556f},
-std::array<float,2>{0.0915185139f, 0.520312905f},
-std::array<float,2>{0.426374048f, 0.0316393487f},
-std::array<float,2>{0.630577147f, 0.9347803f},
-std::array<float,2>{0.500555158f, 0.136586025f},
-std::array<float,2>{0.33004275f, 0.802222311f},
-std::array<float,2>{0.243236378f, 0.47900635f},
-std::array<float,2>{0.884955466f, 0.66895169f},
-std::array<float,2>{0.703575075f, 0.38396731f},
-std::array<float,2>{0.484516472f, 0.730236232f},
-std::array<float,2>{0.0508516915f, 0.24949947f},
-std::array<float,2>{0.825410843f, 0.817831337f},
-std::array<float,2>{0.977750361f, 0.123780623f},
-std::array<float,2>{0.165899366f, 0.94472158f},
-std::array<float,2>{0.252209157f, 0.315762579f},
-std::array<float,2>{0.595821917f, 0.578732431f},
-std::array<float,2>{0.832232058f, 0.427181572f},
-std::array<float,2>{0.0322964117f, 0.692716241f},
-std::array<float,2>{0.479976892f, 0.194486856f},
-std::array<float,2>{0.689709187f, 0.850985765f},
-std::array<float,2>{0.624494135f, 0.0814817399f},
-std::array<float,2>{0.268904835f, 0.997060537f},
-std::array<float,2>{0.181429967f, 0.344683498f},
-std::array<float,2>{0.993626952f, 0.624625921f},
-std::array<float,2>{0.645065367f, 0.280899763f},
-std::array<float,2>{0.4214634f, 0.531840324f},
-std::array<float,2>{0.0776125118f, 0.030298328f},
-std::array<float,2>{0.765120566f, 0.875883877f},
-std::array<float,2>{0.902633548f, 0.174906299f},
-std::array<float,2>{0.230988398f, 0.776816964f},
-std::array<float,2>{0.326173723f, 0.461509347f},
-std::array<float,2>{0.521921694f, 0.630784333f},
-std::array<float,2>{0.951382637f, 0.328631967f},
-std::array<float,2>{0.143001154f, 0.563811362f},
-std::array<float,2>{0.289670318f, 0.104477786f},
-std::array<float,2>{0.574831903f, 0.953618348f},
-std::array<float,2>{0.742965281f, 0.220285743f},
-std::array<float,2>{0.450659662f, 0.838104963f},
-std::array<float,2>{0.00168384542f, 0.405186325f},
-std::array<float,2>{0.863554657f, 0.735953271f},
-std::array<float,2>{0.551900566f, 0.489601105f},
-std::array<float,2>{0.356363118f, 0.678003132f},
-std::array<float,2>{0.213153943f, 0.14791429f},
-std::array<float,2>{0.927110672f, 0.785003245f},
-std::array<float,2>{0.793794036f, 0.0499547571f},
-std::array<float,2>{0.120888226f, 0.918675184f},
-std::array<float,2>{0.405516863f, 0.311066121f},
-std::array<float,2>{0.68368876f, 0.508548677f},
-std::array<float,2>{0.999994516f, 0.476556957f},
-std::array<float,2>{0.186344907f, 0.658298194f},
-std::array<float,2>{0.272064239f, 0.131828934f},
-std::array<float,2>{0.617362797f, 0.810505569f},
-std::array<float,2>{0.692161143f, 0.0460662656f},
-std::array<float,2>{0.48391515f, 0.92832011f},
-std::array<float,2>{0.0367900543f, 0.289669454f},
-std::array<float,2>{0.831302047f, 0.524298191f},
-std::array<float,2>{0.517506957f, 0.326165617f},
-std::array<float,2>{0.322755516f, 0.587582052f},
-std::array<float,2>{0.227267042f, 0.113775194f},
-std::array<float,2>{0.89892453f, 0.946548522f},
-std::array<float,2>{0.761680603f, 0.235211581f},
-std::array<float,2>{0.0730814934f, 0.827185392f},
-std::array<float,2>{0.416993886f, 0.381886333f},
-std::array<float,2>{0.643724442f, 0.723931909f},
-std::array<float,2>{0.859505832f, 0.263560593f},
-std::array<float,2>{0.00742286816f, 0.547976553f},
-std::array<float,2>{0.446682602f, 0.0113698868f},
-std::array<float,2>{0.746945024f, 0.897518456f},
-std::array<float,2>{0.571276307f, 0.163536131f},
-std::array<float,2>{0.294022679f, 0.761737943f},
-std::array<float,2>{0.145341143f, 0.439643353f},
-std::array<float,2>{0.948356092f, 0.651529968f},
-std::array<float,2>{0.680562198f, 0.411239117f},
-std::array<float,2>{0.400916874f, 0.716737568f},
-std::array<float,2>{0.121532977f, 0.206817314f},
-std::array<float,2>{0.789366126f, 0.86924243f},
-std::array<float,2>{0.924049795f, 0.069311969f},
-std::array<float,2>{0.218740076f, 0.974815905f},
-std::array<float,2>{0.352912784f, 0.361273855f},
-std::array<float,2>{0.549770832f, 0.606190026f},
-std::array<float,2>{0.805623353f, 0.394689828f},
-std::array<float,2>{0.100745782f, 0.747967958f},
-std::array<float,2>{0.379328042f, 0.226732492f},
-std::array<float,2>{0.663104177f, 0.829277039f},
-std::array<float,2>{0.540558755f, 0.101346716f},
-std::array<float,2>{0.36140132f, 0.967027068f},
-std::array<float,2>{0.202714562f, 0.342629433f},
-std::array<float,2>{0.912937343f, 0.577686369f},
-std::array<float,2>{0.732866108f, 0.298525333f},
-std::array<float,2>{0.462272644f, 0.506926f},
-std::array<float,2>{0.0218762718f, 0.0592379048f},
-std::array<float,2>{0.846738815f, 0.911987841f},
-std::array<float,2>{0.96833843f, 0.151449889f},
-std::array<float,2>{0.131044969f, 0.793605864f},
-std::array<float,2>{0.307747751f, 0.495597988f},
-std::array<float,2>{0.583906233f, 0.681132257f},
-std::array<float,2>{0.890558958f, 0.357593417f},
-std::array<float,2>{0.247936115f, 0.610883236f},
-std::array<float,2>{0.333232582f, 0.0872317329f},
-std::array<float,2>{0.504920065f, 0.985963821f},
-std::array<float,2>{0.627801299f, 0.200748563f},
-std::array<float,2>{0.422419548f, 0.854074299f},
-std::array<float,2>{0.0870374292f, 0.434947878f},
-std::array<float,2>{0.772045314f, 0.698783159f},
-std::array<float,2>{0.59934181f, 0.454342902f},
-std::array<float,2>{0.254712939f, 0.637939274f},
-std::array<float,2>{0.171568602f, 0.187461451f},
-std::array<float,2>{0.982428849f, 0.769076526f},
-std::array<float,2>{0.821502209f, 0.0191080645f},
-std::array<float,2>{0.0481119007f, 0.888284564f},
-std::array<float,2>{0.489001065f, 0.267509997f},
-std::array<float,2>{0.710383534f, 0.539423883f},
-std::array<float,2>{0.919891894f, 0.422393233f},
-std::array<float,2>{0.193653569f, 0.690274417f},
-std::array<float,2>{0.371323258f, 0.188388497f},
-std::array<float,2>{0.532599688f, 0.843887448f},
-std::array<float,2>{0.666476727f, 0.0834634453f},
-std::array<float,2>{0.388996154f, 0.993808091f},
-std::array<float,2>{0.10524343f, 0.349306434f},
-std::array<float,2>{0.799114347f, 0.618978143f},
-std::array<float,2>{0.587684929f, 0.273808569f},
-std::array<float,2>{0.302929312f, 0.538855195f},
-std::array<float,2>{0.138010919f, 0.0267975703f},
-std::array<float,2>{0.96055764f, 0.880251586f},
-std::array<float,2>{0.85186404f, 0.175914526f},
-std::array<float,2>{0.0297365244f, 0.778567731f},
-std::array<float,2>{0.459086597f, 0.467748642f},
-std::array<float,2>{0.723033369f, 0.628495157f},
-std::array<float,2>{0.775484085f, 0.335412294f},
-std::array<float,2>{0.0845574737f, 0.568876624f},
-std::array<float,2>{0.436276317f, 0.107071199f},
-std::array<float,2>{0.635078967f, 0.960659027f},
-std::array<float,2>{0.513119817f, 0.225048974f},
-std::array<float,2>{0.337982386f, 0.841912985f},
-std::array<float,2>{0.240787774f, 0.400362521f},
-std::array<float,2>{0.877417564f, 0.739067316f},
-std::array<float,2>{0.712865055f, 0.484981179f},
-std::array<float,2>{0.494993329f, 0.674000502f},
-std::array<float,2>{0.0578204505f, 0.142878741f},
-std::array<float,2>{0.813269258f, 0.786668956f},
-std::array<float,2>{0.97427088f, 0.0510304794f},
-std::array<float,2>{0.163646862f, 0.917212784f},
-std::array<float,2>{0.265070766f, 0.308395922f},
-std::array<float,2>{0.607894659f, 0.51486665f},
-std::array<float,2>{0.842505634f, 0.446255773f},
-std::array<float,2>{0.042364195f, 0.647147596f},
-std::array<float,2>{0.47653842f, 0.166537255f},
-std::array<float,2>{0.700417936f, 0.750365019f},
-std::array<float,2>{0.609934092f, 0.00100846833f},
-std::array<float,2>{0.277529806f, 0.905677378f},
-std::array<float,2>{0.176935107f, 0.253879905f},
-std::array<float,2>{0.984906852f, 0.559421182f},
-std::array<float,2>{0.649928331f, 0.368702531f},
-std::array<float,2>{0.411005557f, 0.600205064f},
-std::array<float,2>{0.0675307885f, 0.0710890293f},
-std::array<float,2>{0.752140164f, 0.983639777f},
-std::array<float,2>{0.893050432f, 0.216717139f},
-std::array<float,2>{0.220492929f, 0.862964928f},
-std::array<float,2>{0.312718004f, 0.415271401f},
-std::array<float,2>{0.527717888f, 0.705639839f},
-std::array<float,2>{0.943292499f, 0.286996454f},
-std::array<float,2>{0.154056981f, 0.518355191f},
-std::array<float,2>{0.284445971f, 0.0389962308f},
-std::array<float,2>{0.569935501f, 0.93321979f},
-std::array<float,2>{0.736722589f, 0.138776109f},
-std::array<float,2>{0.442608446f, 0.800179601f},
-std::array<float,2>{0.0138108702f, 0.481262863f},
-std::array<float,2>{0.873165011f, 0.66565007f},
-std::array<float,2>{0.560755193f, 0.389314592f},
-std::array<float,2>{0.350497425f, 0.731334686f},
-std::array<float,2>{0.210914209f, 0.245698437f},
-std::array<float,2>{0.930921137f, 0.813674808f},
-std::array<float,2>{0.784151495f, 0.120004326f},
-std::array<float,2>{0.109974012f, 0.938462853f},
-std::array<float,2>{0.398025572f, 0.319759667f},
-std::array<float,2>{0.674239218f, 0.58413893f},
-std::array<float,2>{0.955025136f, 0.37799263f},
-std::array<float,2>{0.136386082f, 0.720228136f},
-std::array<float,2>{0.297869921f, 0.239337474f},
-std::array<float,2>{0.593451738f, 0.82126534f},
-std::array<float,2>{0.722390175f, 0.109594665f},
-std::array<float,2>{0.45462504f, 0.950428605f},
-std::array<float,2>{0.0251711681f, 0.320336461f},
-std::array<float,2>{0.856623948f, 0.590788603f},
-std::array<float,2>{0.537322164f, 0.293209791f},
-std::array<float,2>{0.369422615f, 0.530777693f},
-std::array<float,2>{0.189962909f, 0.0414245464f},
-std::array<float,2>{0.914770365f, 0.923422098f},
-std::array<float,2>{0.802480578f, 0.125438929f},
-std::array<float,2>{0.107949041f, 0.807425439f},
-std::array<float,2>{0.384026647f, 0.469911218f},
-std::array<float,2>{0.66946286f, 0.662438571f},
-std::array<float,2>{0.818102896f, 0.365841001f},
-std::array<float,2>{0.0613249987f, 0.601975501f},
-std::array<float,2>{0.498048782f, 0.0635561496f},
-std::array<float,2>{0.718257427f, 0.971160233f},
-std::array<float,2>{0.605158389f, 0.209825739f},
-std::array<float,2>{0.259548664f, 0.872375786f},
-std::array<float,2>{0.157331869f, 0.409102023f},
-std::array<float,2>{0.968769073f, 0.713630438f},
-std::array<float,2>{0.637097776f, 0.442629367f},
-std::array<float,2>{0.432928652f, 0.654165685f},
-std::array<float,2>{0.0800093487f, 0.156962186f},
-std::array<float,2>{0.778619707f, 0.760161817f},
-std::array<float,2>{0.881484926f, 0.0137727028f},
-std::array<float,2>{0.238228962f, 0.893368542f},
-std::array<float,2>{0.342231274f, 0.260524243f},
-std::array<float,2>{0.510510802f, 0.551550508f},
-std::array<float,2>{0.757274032f, 0.497042656f},
-std::array<float,2>{0.0642419681f, 0.687306941f},
-std::array<float,2>{0.406914562f, 0.155178368f},
-std::array<float,2>{0.653068423f, 0.791658819f},
-std::array<float,2>{0.524498463f, 0.0574840456f},
-std::array<float,2>{0.319182903f, 0.908858776f},
-std::array<float,2>{0.223818585f, 0.304478228f},
-std::array<float,2>{0.897908092f, 0.502847195f},
-std::array<float,2>{0.698361337f, 0.339620978f},
-std::array<float,2>{0.469617337f, 0.570649385f},
-std::array<float,2>{0.0453034043f, 0.0957763046f},
-std::array<float,2>{0.836445153f, 0.964634836f},
-std::array<float,2>{0.988582313f, 0.231500432f},
-std::array<float,2>{0.175530449f, 0.83285135f},
-std::array<float,2>{0.273982167f, 0.391212016f},
-std::array<float,2>{0.615815282f, 0.744267344f},
-std::array<float,2>{0.936540306f, 0.272403777f},
-std::array<float,2>{0.203885242f, 0.544436634f},
-std::array<float,2>{0.345418036f, 0.0203704555f},
-std::array<float,2>{0.557659209f, 0.88321203f},
-std::array<float,2>{0.676935792f, 0.181403831f},
-std::array<float,2>{0.392283231f, 0.770618379f},
-std::array<float,2>{0.116465695f, 0.45876801f},
-std::array<float,2>{0.787507713f, 0.635906935f},
-std::array<float,2>{0.564602971f, 0.432570547f},
-std::array<float,2>{0.285564691f, 0.703122437f},
-std::array<float,2>{0.150679648f, 0.196995005f},
-std::array<float,2>{0.940784514f, 0.856309295f},
-std::array<float,2>{0.869150579f, 0.0929265395f},
-std::array<float,2>{0.00939739309f, 0.988556564f},
-std::array<float,2>{0.440230787f, 0.351589262f},
-std::array<float,2>{0.738287389f, 0.615814149f},
-std::array<float,2>{0.906053722f, 0.46219179f},
-std::array<float,2>{0.232922196f, 0.629526317f},
-std::array<float,2>{0.3247585f, 0.174480349f},
-std::array<float,2>{0.520687699f, 0.775497973f},
-std::array<float,2>{0.647573531f, 0.0300868284f},
-std::array<float,2>{0.419401586f, 0.87687844f},
-std::array<float,2>{0.0742514208f, 0.279758453f},
-std::array<float,2>{0.762657285f, 0.533043325f},
-std::array<float,2>{0.621856689f, 0.345319331f},
-std::array<float,2>{0.266560167f, 0.623766601f},
-std::array<float,2>{0.181643158f, 0.0808553547f},
-std::array<float,2>{0.994956851f, 0.997474849f},
-std::array<float,2>{0.834594011f, 0.194201156f},
-std::array<float,2>{0.034184821f, 0.850514472f},
-std::array<float,2>{0.478196323f, 0.426028311f},
-std::array<float,2>{0.687771916f, 0.692038298f},
-std::array<float,2>{0.795999467f, 0.312242419f},
-std::array<float,2>{0.118564881f, 0.509436071f},
-std::array<float,2>{0.403904051f, 0.0488371626f},
-std::array<float,2>{0.685616136f, 0.919016242f},
-std::array<float,2>{0.553951859f, 0.146840394f},
-std::array<float,2>{0.35743317f, 0.783805907f},
-std::array<float,2>{0.211021945f, 0.488922685f},
-std::array<float,2>{0.927737951f, 0.679148793f},
-std::array<float,2>{0.744867563f, 0.405366749f},
-std::array<float,2>{0.452982962f, 0.734826207f},
-std::array<float,2>{0.0029458534f, 0.219217777f},
-std::array<float,2>{0.86585182f, 0.839350998f},
-std::array<float,2>{0.9503268f, 0.104992621f},
-std::array<float,2>{0.140737593f, 0.954859197f},
-std::array<float,2>{0.291741014f, 0.329969555f},
-std::array<float,2>{0.576483727f, 0.563188374f},
-std::array<float,2>{0.851057887f, 0.421004623f},
-std::array<float,2>{0.0156824626f, 0.708114982f},
-std::array<float,2>{0.467627436f, 0.214104831f},
-std::array<float,2>{0.726874232f, 0.865980208f},
-std::array<float,2>{0.580460429f, 0.076112397f},
-std::array<float,2>{0.309346706f, 0.977852404f},
-std::array<float,2>{0.127661273f, 0.372230947f},
-std::array<float,2>{0.962115824f, 0.594131112f},
-std::array<float,2>{0.658605635f, 0.255025655f},
-std::array<float,2>{0.375645012f, 0.556295574f},
-std::array<float,2>{0.0953066945f, 0.00712291338f},
-std::array<float,2>{0.811579645f, 0.900974035f},
-std::array<float,2>{0.906363189f, 0.168845445f},
-std::array<float,2>{0.198502794f, 0.756719232f},
-std::array<float,2>{0.36340034f, 0.45170331f},
-std::array<float,2>{0.545014441f, 0.641209245f},
-std::array<float,2>{0.979645669f, 0.31524092f},
-std::array<float,2>{0.166122884f, 0.579235733f},
-std::array<float,2>{0.250881135f, 0.124447607f},
-std::array<float,2>{0.593787014f, 0.943939626f},
-std::array<float,2>{0.705431402f, 0.24804692f},
-std::array<float,2>{0.48796472f, 0.816411436f},
-std::array<float,2>{0.0544546917f, 0.38301152f},
-std::array<float,2>{0.827751517f, 0.728769004f},
-std::array<float,2>{0.50315398f, 0.480080664f},
-std::array<float,2>{0.331504822f, 0.668337882f},
-std::array<float,2>{0.244427368f, 0.135398775f},
-std::array<float,2>{0.884251177f, 0.800839722f},
-std::array<float,2>{0.767338634f, 0.0323390476f},
-std::array<float,2>{0.0918133333f, 0.93455404f},
-std::array<float,2>{0.429299891f, 0.282907486f},
-std::array<float,2>{0.631442368f, 0.520682573f},
-std::array<float,2>{0.946360886f, 0.439383745f},
-std::array<float,2>{0.147900671f, 0.649924099f},
-std::array<float,2>{0.295385122f, 0.161604866f},
-std::array<float,2>{0.572948992f, 0.764096081f},
-std::array<float,2>{0.749290764f, 0.00881831534f},
-std::array<float,2>{0.448274791f, 0.895209551f},
-std::array<float,2>{0.00471599726f, 0.2645486f},
-std::array<float,2>{0.862187982f, 0.549980223f},
-std::array<float,2>{0.547566712f, 0.362526596f},
-std::array<float,2>{0.353694558f, 0.609346926f},
-std::array<float,2>{0.215653569f, 0.0678083599f},
-std::array<float,2>{0.92233181f, 0.972977579f},
-std::array<float,2>{0.791752577f, 0.203296363f},
-std::array<float,2>{0.12362434f, 0.868791521f},
-std::array<float,2>{0.398876756f, 0.412481934f},
-std::array<float,2>{0.681680202f, 0.71844238f},
-std::array<float,2>{0.828606904f, 0.291531146f},
-std::array<float,2>{0.038135618f, 0.526993752f},
-std::array<float,2>{0.481307626f, 0.0434838049f},
-std::array<float,2>{0.693729162f, 0.927719772f},
-std::array<float,2>{0.6194489f, 0.130563006f},
-std::array<float,2>{0.270943701f, 0.811439931f},
-std::array<float,2>{0.184293941f, 0.472903877f},
-std::array<float,2>{0.997481883f, 0.656456113f},
-std::array<float,2>{0.640853703f, 0.379007012f},
-std::array<float,2>{0.414530098f, 0.724848092f},
-std::array<float,2>{0.0717013478f, 0.236538231f},
-std::array<float,2>{0.759026706f, 0.82517314f},
-std::array<float,2>{0.90161413f, 0.115399495f},
-std::array<float,2>{0.230387896f, 0.949216008f},
-std::array<float,2>{0.320900083f, 0.326523632f},
-std::array<float,2>{0.519127488f, 0.587997735f},
-std::array<float,2>{0.771185696f, 0.436041296f},
-std::array<float,2>{0.0885981917f, 0.697220027f},
-std::array<float,2>{0.425442368f, 0.202942774f},
-std::array<float,2>{0.626752138f, 0.85203141f},
-std::array<float,2>{0.507152081f, 0.0884706229f},
-std::array<float,2>{0.334174812f, 0.986394823f},
-std::array<float,2>{0.248490691f, 0.357292324f},
-std::array<float,2>{0.88763243f, 0.611718893f},
-std::array<float,2>{0.708877087f, 0.268790364f},
-std::array<float,2>{0.491611749f, 0.542162716f},
-std::array<float,2>{0.0496118851f, 0.0165656488f},
-std::array<float,2>{0.823894918f, 0.890188754f},
-std::array<float,2>{0.982186317f, 0.183743596f},
-std::array<float,2>{0.16905427f, 0.765817463f},
-std::array<float,2>{0.255881339f, 0.45620361f},
-std::array<float,2>{0.600662827f, 0.639253139f},
-std::array<float,2>{0.912029624f, 0.341284424f},
-std::array<float,2>{0.200896919f, 0.574400961f},
-std::array<float,2>{0.359462768f, 0.0990879163f},
-std::array<float,2>{0.542298496f, 0.965132535f},
-std::array<float,2>{0.661262393f, 0.22931847f},
-std::array<float,2>{0.381015092f, 0.831979454f},
-std::array<float,2>{0.0990773216f, 0.398062497f},
-std::array<float,2>{0.807612062f, 0.749527097f},
-std::array<float,2>{0.58453387f, 0.492827177f},
-std::array<float,2>{0.305133313f, 0.682935119f},
-std::array<float,2>{0.130681321f, 0.148737073f},
-std::array<float,2>{0.965472341f, 0.796739578f},
-std::array<float,2>{0.844228089f, 0.0623201281f},
-std::array<float,2>{0.0206000097f, 0.912305653f},
-std::array<float,2>{0.463200033f, 0.300127238f},
-std::array<float,2>{0.7304883f, 0.503967106f},
-std::array<float,2>{0.876887083f, 0.401436985f},
-std::array<float,2>{0.239369944f, 0.742044687f},
-std::array<float,2>{0.336835414f, 0.224396005f},
-std::array<float,2>{0.515197933f, 0.841746628f},
-std::array<float,2>{0.633817196f, 0.108759291f},
-std::array<float,2>{0.434805274f, 0.95768851f},
-std::array<float,2>{0.082535468f, 0.333680093f},
-std::array<float,2>{0.775375366f, 0.566992581f},
-std::array<float,2>{0.605718613f, 0.306514591f},
-std::array<float,2>{0.262482941f, 0.513652861f},
-std::array<float,2>{0.161254153f, 0.0529422984f},
-std::array<float,2>{0.97601229f, 0.914248228f},
-std::array<float,2>{0.815184176f, 0.142552674f},
-std::array<float,2>{0.0552024581f, 0.788975358f},
-std::array<float,2>{0.492437482f, 0.487466305f},
-std::array<float,2>{0.71338886f, 0.673633575f},
-std::array<float,2>{0.798200667f, 0.349640071f},
-std::array<float,2>{0.103125505f, 0.619348347f},
-std::array<float,2>{0.387044311f, 0.0852525532f},
-std::array<float,2>{0.664792955f, 0.995909512f},
-std::array<float,2>{0.534093797f, 0.191131115f},
-std::array<float,2>{0.373630941f, 0.846408427f},
-std::array<float,2>{0.191696346f, 0.424791932f},
-std::array<float,2>{0.919982731f, 0.689281404f},
-std::array<float,2>{0.725514174f, 0.466179222f},
-std::array<float,2>{0.458056182f, 0.625732064f},
-std::array<float,2>{0.0277850796f, 0.178894877f},
-std::array<float,2>{0.854238272f, 0.780630589f},
-std::array<float,2>{0.958875299f, 0.0239685066f},
-std::array<float,2>{0.138820603f, 0.881543577f},
-std::array<float,2>{0.302262455f, 0.275621504f},
-std::array<float,2>{0.589265585f, 0.536288857f},
-std::array<float,2>{0.871110439f, 0.483886153f},
-std::array<float,2>{0.0125864111f, 0.666843712f},
-std::array<float,2>{0.444272935f, 0.138148129f},
-std::array<float,2>{0.736274242f, 0.798574209f},
-std::array<float,2>{0.566482186f, 0.0355989747f},
-std::array<float,2>{0.28183946f, 0.930952311f},
-std::array<float,2>{0.155193657f, 0.287213951f},
-std::array<float,2>{0.945122421f, 0.515898526f},
-std::array<float,2>{0.672014832f, 0.316966593f},
-std::array<float,2>{0.396139979f, 0.583860159f},
-std::array<float,2>{0.111476615f, 0.117489412f},
-std::array<float,2>{0.782080591f, 0.940714419f},
-std::array<float,2>{0.93204695f, 0.243216142f},
-std::array<float,2>{0.208454087f, 0.814669728f},
-std::array<float,2>{0.348706961f, 0.387514949f},
-std::array<float,2>{0.558603466f, 0.73354435f},
-std::array<float,2>{0.987520039f, 0.250621915f},
-std::array<float,2>{0.179306075f, 0.5614748f},
-std::array<float,2>{0.280867964f, 0.00211119722f},
-std::array<float,2>{0.611507833f, 0.90415144f},
-std::array<float,2>{0.702728629f, 0.164423972f},
-std::array<float,2>{0.474377841f, 0.752248824f},
-std::array<float,2>{0.0400701016f, 0.449079603f},
-std::array<float,2>{0.84068799f, 0.646096349f},
-std::array<float,2>{0.530972004f, 0.416631311f},
-std::array<float,2>{0.314812154f, 0.705007255f},
-std::array<float,2>{0.221017838f, 0.21830599f},
-std::array<float,2>{0.89166379f, 0.860686719f},
-std::array<float,2>{0.75016886f, 0.0732241496f},
-std::array<float,2>{0.0694384649f, 0.981467545f},
-std::array<float,2>{0.412712783f, 0.370679706f},
-std::array<float,2>{0.650399506f, 0.598615289f},
-std::array<float,2>{0.972264647f, 0.406535089f},
-std::array<float,2>{0.159086823f, 0.711012304f},
-std::array<float,2>{0.261609107f, 0.208533555f},
-std::array<float,2>{0.602458894f, 0.874294817f},
-std::array<float,2>{0.716681838f, 0.0644974113f},
-std::array<float,2>{0.497158587f, 0.969856381f},
-std::array<float,2>{0.0586003214f, 0.364235789f},
-std::array<float,2>{0.819858313f, 0.603821993f},
-std::array<float,2>{0.507916749f, 0.25844714f},
-std::array<float,2>{0.341629893f, 0.553956509f},
-std::array<float,2>{0.235771596f, 0.0122257695f},
-std::array<float,2>{0.880763531f, 0.890823662f},
-std::array<float,2>{0.780207872f, 0.158881173f},
-std::array<float,2>{0.0818854719f, 0.759366274f},
-std::array<float,2>{0.431483477f, 0.443731368f},
-std::array<float,2>{0.638757825f, 0.656077564f},
-std::array<float,2>{0.859098196f, 0.32238239f},
-std::array<float,2>{0.0266309734f, 0.592023432f},
-std::array<float,2>{0.45604372f, 0.112876415f},
-std::array<float,2>{0.719640493f, 0.952879965f},
-std::array<float,2>{0.590367496f, 0.240403995f},
-std::array<float,2>{0.299350291f, 0.822558463f},
-std::array<float,2>{0.133261308f, 0.376409799f},
-std::array<float,2>{0.955896616f, 0.721194267f},
-std::array<float,2>{0.67082566f, 0.472653508f},
-std::array<float,2>{0.385245591f, 0.661479294f},
-std::array<float,2>{0.106490165f, 0.128452152f},
-std::array<float,2>{0.803113878f, 0.80627352f},
-std::array<float,2>{0.91633606f, 0.0392932259f},
-std::array<float,2>{0.187922284f, 0.924841583f},
-std::array<float,2>{0.36724785f, 0.295143604f},
-std::array<float,2>{0.537085831f, 0.52828306f},
-std::array<float,2>{0.785647154f, 0.460491657f},
-std::array<float,2>{0.114019677f, 0.633384585f},
-std::array<float,2>{0.393241704f, 0.183352903f},
-std::array<float,2>{0.678324997f, 0.771589458f},
-std::array<float,2>{0.555983067f, 0.0224246625f},
-std::array<float,2>{0.346891493f, 0.885725498f},
-std::array<float,2>{0.206979439f, 0.269866854f},
-std::array<float,2>{0.93547976f, 0.546438932f},
-std::array<float,2>{0.740348339f, 0.353732079f},
-std::array<float,2>{0.439143151f, 0.614158154f},
-std::array<float,2>{0.0109865954f, 0.0915400237f},
-std::array<float,2>{0.868273795f, 0.990561604f},
-std::array<float,2>{0.938869298f, 0.198754132f},
-std::array<float,2>{0.150241643f, 0.859183371f},
-std::array<float,2>{0.288990587f, 0.430652618f},
-std::array<float,2>{0.563803852f, 0.700862408f},
-std::array<float,2>{0.895158052f, 0.301704675f},
-std::array<float,2>{0.225788355f, 0.500297904f},
-std::array<float,2>{0.316515476f, 0.0549074635f},
-std::array<float,2>{0.526616275f, 0.906384408f},
-std::array<float,2>{0.65609169f, 0.153362468f},
-std::array<float,2>{0.409227401f, 0.790260077f},
-std::array<float,2>{0.0658894554f, 0.49833414f},
-std::array<float,2>{0.755851567f, 0.684028566f},
-std::array<float,2>{0.613372087f, 0.394157112f},
-std::array<float,2>{0.275677979f, 0.742199898f},
-std::array<float,2>{0.173530713f, 0.233422205f},
-std::array<float,2>{0.990344703f, 0.834086657f},
-std::array<float,2>{0.838712811f, 0.0955058485f},
-std::array<float,2>{0.0444995835f, 0.961584091f},
-std::array<float,2>{0.472030044f, 0.337406695f},
-std::array<float,2>{0.696151614f, 0.573713422f},
-std::array<float,2>{0.926266015f, 0.490638256f},
-std::array<float,2>{0.213932976f, 0.676048219f},
-std::array<float,2>{0.357198983f, 0.145283282f},
-std::array<float,2>{0.551521778f, 0.782598019f},
-std::array<float,2>{0.68524152f, 0.0472907722f},
-std::array<float,2>{0.405189365f, 0.92047137f},
-std::array<float,2>{0.119906843f, 0.30920282f},
-std::array<float,2>{0.794368863f, 0.509799421f},
-std::array<float,2>{0.57601577f, 0.330900967f},
-std::array<float,2>{0.290975749f, 0.565632343f},
-std::array<float,2>{0.144413263f, 0.102808565f},
-std::array<float,2>{0.952173948f, 0.956729174f},
-std::array<float,2>{0.864344478f, 0.220750093f},
-std::array<float,2>{0.000490908977f, 0.837346017f},
-std::array<float,2>{0.449945569f, 0.402415037f},
-std::array<float,2>{0.743252993f, 0.737876832f},
-std::array<float,2>{0.764268219f, 0.277750582f},
-std::array<float,2>{0.0762120262f, 0.534852266f},
-std::array<float,2>{0.420085192f, 0.0277219154f},
-std::array<float,2>{0.645876527f, 0.877102852f},
-std::array<float,2>{0.52321732f, 0.173040316f},
-std::array<float,2>{0.328122675f, 0.773581743f},
-std::array<float,2>{0.231469318f, 0.464152396f},
-std::array<float,2>{0.904017389f, 0.631633759f},
-std::array<float,2>{0.69110918f, 0.428140968f},
-std::array<float,2>{0.478584468f, 0.695017457f},
-std::array<float,2>{0.031948749f, 0.191987902f},
-std::array<float,2>{0.833198428f, 0.848580301f},
-std::array<float,2>{0.993125796f, 0.0781700313f},
-std::array<float,2>{0.180291161f, 0.998439074f},
-std::array<float,2>{0.268399507f, 0.346927375f},
-std::array<float,2>{0.623959184f, 0.621374369f},
-std::array<float,2>{0.824920714f, 0.384778798f},
-std::array<float,2>{0.0521387756f, 0.728511035f},
-std::array<float,2>{0.486203611f, 0.247886091f},
-std::array<float,2>{0.704992473f, 0.819459081f},
-std::array<float,2>{0.597177446f, 0.121256374f},
-std::array<float,2>{0.253206044f, 0.943126619f},
-std::array<float,2>{0.164408118f, 0.312606245f},
-std::array<float,2>{0.977204025f, 0.581182301f},
-std::array<float,2>{0.629445195f, 0.284566998f},
-std::array<float,2>{0.427440166f, 0.521607459f},
-std::array<float,2>{0.0905738547f, 0.034026105f},
-std::array<float,2>{0.76843214f, 0.93564117f},
-std::array<float,2>{0.886023045f, 0.134051949f},
-std::array<float,2>{0.242295414f, 0.804073215f},
-std::array<float,2>{0.328151733f, 0.476949424f},
-std::array<float,2>{0.501560509f, 0.670332968f},
-std::array<float,2>{0.964283049f, 0.373310506f},
-std::array<float,2>{0.125915334f, 0.597128212f},
-std::array<float,2>{0.311216861f, 0.0766851604f},
-std::array<float,2>{0.578896165f, 0.978770316f},
-std::array<float,2>{0.730255067f, 0.212295339f},
-std::array<float,2>{0.466104776f, 0.863412559f},
-std::array<float,2>{0.0187605917f, 0.419783533f},
-std::array<float,2>{0.849319458f, 0.710587978f},
-std::array<float,2>{0.543985128f, 0.449721575f},
-std::array<float,2>{0.365393966f, 0.643221319f},
-std::array<float,2>{0.196021989f, 0.170398742f},
-std::array<float,2>{0.908975601f, 0.755539238f},
-std::array<float,2>{0.808647275f, 0.00529981405f},
-std::array<float,2>{0.0975819007f, 0.900378585f},
-std::array<float,2>{0.377835572f, 0.256109118f},
-std::array<float,2>{0.657466888f, 0.558323681f},
-std::array<float,2>{0.970428526f, 0.44347468f},
-std::array<float,2>{0.156677216f, 0.655973196f},
-std::array<float,2>{0.257942766f, 0.159170911f},
-std::array<float,2>{0.603873551f, 0.759653926f},
-std::array<float,2>{0.717653573f, 0.0124625973f},
-std::array<float,2>{0.499620527f, 0.890913546f},
-std::array<float,2>{0.0621042512f, 0.258714914f},
-std::array<float,2>{0.817153394f, 0.55395335f},
-std::array<float,2>{0.51138705f, 0.363978356f},
-std::array<float,2>{0.343600959f, 0.603662312f},
-std::array<float,2>{0.236661211f, 0.0647292212f},
-std::array<float,2>{0.881933153f, 0.970198691f},
-std::array<float,2>{0.777810872f, 0.208941892f},
-std::array<float,2>{0.0782823339f, 0.874173582f},
-std::array<float,2>{0.431980908f, 0.406371951f},
-std::array<float,2>{0.637737513f, 0.711354136f},
-std::array<float,2>{0.855539203f, 0.295307845f},
-std::array<float,2>{0.0237434823f, 0.527849078f},
-std::array<float,2>{0.453285307f, 0.0395375192f},
-std::array<float,2>{0.721178055f, 0.925287843f},
-std::array<float,2>{0.592167795f, 0.128745481f},
-std::array<float,2>{0.297028065f, 0.806491315f},
-std::array<float,2>{0.135385662f, 0.472222984f},
-std::array<float,2>{0.95357585f, 0.661230326f},
-std::array<float,2>{0.668820262f, 0.376116931f},
-std::array<float,2>{0.383608043f, 0.72145468f},
-std::array<float,2>{0.108507439f, 0.240698397f},
-std::array<float,2>{0.801473916f, 0.822317302f},
-std::array<float,2>{0.915944099f, 0.113269389f},
-std::array<float,2>{0.190432832f, 0.953038752f},
-std::array<float,2>{0.371019244f, 0.322666943f},
-std::array<float,2>{0.538430631f, 0.592153907f},
-std::array<float,2>{0.788817227f, 0.430369943f},
-std::array<float,2>{0.115853593f, 0.70095104f},
-std::array<float,2>{0.391477853f, 0.199203208f},
-std::array<float,2>{0.675907433f, 0.858912349f},
-std::array<float,2>{0.557082713f, 0.0917340592f},
-std::array<float,2>{0.343831509f, 0.990425289f},
-std::array<float,2>{0.204521343f, 0.35392046f},
-std::array<float,2>{0.936454892f, 0.613883078f},
-std::array<float,2>{0.7399894f, 0.26958859f},
-std::array<float,2>{0.441316873f, 0.546807289f},
-std::array<float,2>{0.00804852135f, 0.0220831223f},
-std::array<float,2>{0.870234013f, 0.885490239f},
-std::array<float,2>{0.940096855f, 0.183287144f},
-std::array<float,2>{0.152287245f, 0.77180171f},
-std::array<float,2>{0.287086576f, 0.460808277f},
-std::array<float,2>{0.565882444f, 0.633720517f},
-std::array<float,2>{0.897091687f, 0.337794602f},
-std::array<float,2>{0.223089501f, 0.573325098f},
-std::array<float,2>{0.320029229f, 0.0953036249f},
-std::array<float,2>{0.523918271f, 0.961851418f},
-std::array<float,2>{0.653661191f, 0.233738199f},
-std::array<float,2>{0.407339215f, 0.834451318f},
-std::array<float,2>{0.0633691251f, 0.394438684f},
-std::array<float,2>{0.756704152f, 0.742642105f},
-std::array<float,2>{0.617102683f, 0.498088777f},
-std::array<float,2>{0.275295675f, 0.68372792f},
-std::array<float,2>{0.173902854f, 0.153572932f},
-std::array<float,2>{0.989724517f, 0.790356457f},
-std::array<float,2>{0.837289929f, 0.055101078f},
-std::array<float,2>{0.0463270433f, 0.906712353f},
-std::array<float,2>{0.47018984f, 0.301347166f},
-std::array<float,2>{0.697992504f, 0.500013351f},
-std::array<float,2>{0.929245114f, 0.402756572f},
-std::array<float,2>{0.212622851f, 0.738250613f},
-std::array<float,2>{0.358821929f, 0.221050158f},
-std::array<float,2>{0.552899361f, 0.836922646f},
-std::array<float,2>{0.687096417f, 0.10269098f},
-std::array<float,2>{0.403306425f, 0.956920862f},
-std::array<float,2>{0.117496721f, 0.330796063f},
-std::array<float,2>{0.795246661f, 0.565843821f},
-std::array<float,2>{0.577284217f, 0.309414297f},
-std::array<float,2>{0.292028278f, 0.510244608f},
-std::array<float,2>{0.141833827f, 0.046950452f},
-std::array<float,2>{0.950161517f, 0.920676947f},
-std::array<float,2>{0.867079079f, 0.14517875f},
-std::array<float,2>{0.00207618019f, 0.782263696f},
-std::array<float,2>{0.451422215f, 0.490430921f},
-std::array<float,2>{0.745649159f, 0.675787151f},
-std::array<float,2>{0.763337612f, 0.34678793f},
-std::array<float,2>{0.0753412321f, 0.621301174f},
-std::array<float,2>{0.418320149f, 0.0784315541f},
-std::array<float,2>{0.646715343f, 0.998258471f},
-std::array<float,2>{0.520184815f, 0.192195699f},
-std::array<float,2>{0.325620353f, 0.848231018f},
-std::array<float,2>{0.233941391f, 0.427878678f},
-std::array<float,2>{0.905026197f, 0.695095599f},
-std::array<float,2>{0.689064384f, 0.464018404f},
-std::array<float,2>{0.476791143f, 0.63158679f},
-std::array<float,2>{0.0334216133f, 0.173325166f},
-std::array<float,2>{0.83586657f, 0.773857594f},
-std::array<float,2>{0.995690525f, 0.0275646206f},
-std::array<float,2>{0.182829604f, 0.877385676f},
-std::array<float,2>{0.266759425f, 0.27741465f},
-std::array<float,2>{0.622475803f, 0.534955323f},
-std::array<float,2>{0.826184809f, 0.476778597f},
-std::array<float,2>{0.0529568829f, 0.67012167f},
-std::array<float,2>{0.486793727f, 0.133945704f},
-std::array<float,2>{0.706686497f, 0.803851247f},
-std::array<float,2>{0.595171869f, 0.0339259803f},
-std::array<float,2>{0.251718581f, 0.935901523f},
-std::array<float,2>{0.167770833f, 0.284397572f},
-std::array<float,2>{0.97869426f, 0.521892548f},
-std::array<float,2>{0.631987751f, 0.31291154f},
-std::array<float,2>{0.428068608f, 0.581485093f},
-std::array<float,2>{0.0929672867f, 0.121522449f},
-std::array<float,2>{0.766266942f, 0.942947328f},
-std::array<float,2>{0.883058012f, 0.24772042f},
-std::array<float,2>{0.24593395f, 0.819776416f},
-std::array<float,2>{0.330120385f, 0.385072351f},
-std::array<float,2>{0.502069592f, 0.728100002f},
-std::array<float,2>{0.961432397f, 0.256070673f},
-std::array<float,2>{0.128451914f, 0.558433533f},
-std::array<float,2>{0.310010433f, 0.00495302677f},
-std::array<float,2>{0.581422865f, 0.900037766f},
-std::array<float,2>{0.728223562f, 0.170147762f},
-std::array<float,2>{0.468738198f, 0.755773246f},
-std::array<float,2>{0.0174894556f, 0.450048327f},
-std::array<float,2>{0.850091696f, 0.643374026f},
-std::array<float,2>{0.546414316f, 0.419645578f},
-std::array<float,2>{0.364605874f, 0.710916877f},
-std::array<float,2>{0.197577775f, 0.212155581f},
-std::array<float,2>{0.907802463f, 0.863719583f},
-std::array<float,2>{0.810555637f, 0.0771287978f},
-std::array<float,2>{0.0943536013f, 0.978563547f},
-std::array<float,2>{0.376907825f, 0.373077571f},
-std::array<float,2>{0.659644306f, 0.5967623f},
-std::array<float,2>{0.947562754f, 0.412226647f},
-std::array<float,2>{0.145901591f, 0.718539f},
-std::array<float,2>{0.293150723f, 0.203379393f},
-std::array<float,2>{0.572179198f, 0.86898464f},
-std::array<float,2>{0.747072875f, 0.0675252974f},
-std::array<float,2>{0.44548133f, 0.972876012f},
-std::array<float,2>{0.00600999221f, 0.362618178f},
-std::array<float,2>{0.860609531f, 0.608893752f},
-std::array<float,2>{0.55052048f, 0.264240175f},
-std::array<float,2>{0.351840079f, 0.550088823f},
-std::array<float,2>{0.217573792f, 0.00905350503f},
-std::array<float,2>{0.925736785f, 0.895409346f},
-std::array<float,2>{0.79071945f, 0.16132763f},
-std::array<float,2>{0.122490741f, 0.763721228f},
-std::array<float,2>{0.402282923f, 0.439105064f},
-std::array<float,2>{0.680666745f, 0.650263846f},
-std::array<float,2>{0.830087006f, 0.326414019f},
-std::array<float,2>{0.0356084034f, 0.588199854f},
-std::array<float,2>{0.482427925f, 0.115523502f},
-std::array<float,2>{0.692581654f, 0.94873631f},
-std::array<float,2>{0.61837393f, 0.236733794f},
-std::array<float,2>{0.273229897f, 0.824917257f},
-std::array<float,2>{0.18668732f, 0.379177123f},
-std::array<float,2>{0.999019742f, 0.725088954f},
-std::array<float,2>{0.643060923f, 0.472783446f},
-std::array<float,2>{0.416218638f, 0.656643867f},
-std::array<float,2>{0.0741980597f, 0.130833924f},
-std::array<float,2>{0.759928882f, 0.811089396f},
-std::array<float,2>{0.900111794f, 0.0437694937f},
-std::array<float,2>{0.227861702f, 0.927397549f},
-std::array<float,2>{0.323435724f, 0.29193902f},
-std::array<float,2>{0.516467631f, 0.527112424f},
-std::array<float,2>{0.773114622f, 0.456301838f},
-std::array<float,2>{0.0868849456f, 0.639484942f},
-std::array<float,2>{0.423762262f, 0.184046417f},
-std::array<float,2>{0.628159225f, 0.766109467f},
-std::array<float,2>{0.504624605f, 0.016149858f},
-std::array<float,2>{0.332532942f, 0.890408516f},
-std::array<float,2>{0.24634169f, 0.269013941f},
-std::array<float,2>{0.889451444f, 0.542255342f},
-std::array<float,2>{0.709946632f, 0.357157618f},
-std::array<float,2>{0.4900693f, 0.611530542f},
-std::array<float,2>{0.0469252206f, 0.0888198838f},
-std::array<float,2>{0.820682168f, 0.986627579f},
-std::array<float,2>{0.984200358f, 0.20287472f},
-std::array<float,2>{0.170534283f, 0.851640999f},
-std::array<float,2>{0.255590647f, 0.436419606f},
-std::array<float,2>{0.598003805f, 0.696898878f},
-std::array<float,2>{0.913248539f, 0.299811721f},
-std::array<float,2>{0.201375559f, 0.504185319f},
-std::array<float,2>{0.362886131f, 0.0621359944f},
-std::array<float,2>{0.539191782f, 0.912378967f},
-std::array<float,2>{0.662453234f, 0.148631424f},
-std::array<float,2>{0.380060107f, 0.796391487f},
-std::array<float,2>{0.100318745f, 0.493144214f},
-std::array<float,2>{0.806109667f, 0.682796955f},
-std::array<float,2>{0.582686841f, 0.398397446f},
-std::array<float,2>{0.306919247f, 0.749929667f},
-std::array<float,2>{0.132570639f, 0.229110032f},
-std::array<float,2>{0.967746317f, 0.831673682f},
-std::array<float,2>{0.845767736f, 0.0986818671f},
-std::array<float,2>{0.0224887021f, 0.965084314f},
-std::array<float,2>{0.461000264f, 0.340839624f},
-std::array<float,2>{0.733940065f, 0.574541986f},
-std::array<float,2>{0.87888062f, 0.487660557f},
-std::array<float,2>{0.242072895f, 0.673362792f},
-std::array<float,2>{0.339816451f, 0.142112836f},
-std::array<float,2>{0.512631655f, 0.788660407f},
-std::array<float,2>{0.636707604f, 0.0530041754f},
-std::array<float,2>{0.437190831f, 0.914502025f},
-std::array<float,2>{0.0853357017f, 0.306301683f},
-std::array<float,2>{0.777299047f, 0.51331687f},
-std::array<float,2>{0.609026194f, 0.333962709f},
-std::array<float,2>{0.264336109f, 0.567382395f},
-std::array<float,2>{0.162719265f, 0.108530909f},
-std::array<float,2>{0.973135889f, 0.957774997f},
-std::array<float,2>{0.81365025f, 0.224335283f},
-std::array<float,2>{0.0575053617f, 0.841433585f},
-std::array<float,2>{0.495891303f, 0.401676297f},
-std::array<float,2>{0.710980117f, 0.741934776f},
-std::array<float,2>{0.799905777f, 0.275718123f},
-std::array<float,2>{0.10407722f, 0.536384404f},
-std::array<float,2>{0.389656037f, 0.0241764672f},
-std::array<float,2>{0.667835772f, 0.881760776f},
-std::array<float,2>{0.53150636f, 0.179011673f},
-std::array<float,2>{0.372400999f, 0.780276597f},
-std::array<float,2>{0.195272282f, 0.466002285f},
-std::array<float,2>{0.918558717f, 0.625831366f},
-std::array<float,2>{0.723813534f, 0.424406201f},
-std::array<float,2>{0.460344434f, 0.689159572f},
-std::array<float,2>{0.0308623463f, 0.19128184f},
-std::array<float,2>{0.85315609f, 0.846547544f},
-std::array<float,2>{0.959708333f, 0.0849924609f},
-std::array<float,2>{0.13730213f, 0.995727479f},
-std::array<float,2>{0.304434717f, 0.35006085f},
-std::array<float,2>{0.586493433f, 0.619543612f},
-std::array<float,2>{0.874655664f, 0.387361974f},
-std::array<float,2>{0.0149805527f, 0.733793497f},
-std::array<float,2>{0.44183287f, 0.243624419f},
-std::array<float,2>{0.737814486f, 0.814725876f},
-std::array<float,2>{0.569078028f, 0.117238991f},
-std::array<float,2>{0.283766866f, 0.940463662f},
-std::array<float,2>{0.1526393f, 0.317341596f},
-std::array<float,2>{0.942322016f, 0.583533466f},
-std::array<float,2>{0.674925148f, 0.28748858f},
-std::array<float,2>{0.396940678f, 0.515705645f},
-std::array<float,2>{0.111302674f, 0.0352420062f},
-std::array<float,2>{0.785143733f, 0.930862904f},
-std::array<float,2>{0.929717124f, 0.137779191f},
-std::array<float,2>{0.209902406f, 0.798751295f},
-std::array<float,2>{0.350761116f, 0.48357591f},
-std::array<float,2>{0.561688602f, 0.666626453f},
-std::array<float,2>{0.985599101f, 0.370931476f},
-std::array<float,2>{0.176549077f, 0.59821254f},
-std::array<float,2>{0.278630823f, 0.0727884248f},
-std::array<float,2>{0.610990345f, 0.981701016f},
-std::array<float,2>{0.699788272f, 0.218743548f},
-std::array<float,2>{0.475534707f, 0.860586703f},
-std::array<float,2>{0.0419125669f, 0.416776448f},
-std::array<float,2>{0.842802584f, 0.704811573f},
-std::array<float,2>{0.529031992f, 0.448824435f},
-std::array<float,2>{0.314297587f, 0.646349311f},
-std::array<float,2>{0.219689742f, 0.164189935f},
-std::array<float,2>{0.894276619f, 0.752121568f},
-std::array<float,2>{0.753427088f, 0.00220233202f},
-std::array<float,2>{0.0671588406f, 0.903897822f},
-std::array<float,2>{0.411787957f, 0.250893682f},
-std::array<float,2>{0.649399161f, 0.561160207f},
-std::array<float,2>{0.956384182f, 0.470192522f},
-std::array<float,2>{0.133898452f, 0.662195623f},
-std::array<float,2>{0.300193578f, 0.125173688f},
-std::array<float,2>{0.591082036f, 0.807289898f},
-std::array<float,2>{0.720110476f, 0.0411267206f},
-std::array<float,2>{0.456112653f, 0.92373687f},
-std::array<float,2>{0.0254812427f, 0.293316841f},
-std::array<float,2>{0.8577196f, 0.531112254f},
-std::array<float,2>{0.535473585f, 0.320636779f},
-std::array<float,2>{0.368595243f, 0.590380788f},
-std::array<float,2>{0.189346626f, 0.109675527f},
-std::array<float,2>{0.917795837f, 0.950533926f},
-std::array<float,2>{0.803734899f, 0.239593223f},
-std::array<float,2>{0.106135577f, 0.820967078f},
-std::array<float,2>{0.386295527f, 0.378176719f},
-std::array<float,2>{0.671432555f, 0.720618784f},
-std::array<float,2>{0.818366885f, 0.260363847f},
-std::array<float,2>{0.0601608269f, 0.551301301f},
-std::array<float,2>{0.496155947f, 0.0141592016f},
-std::array<float,2>{0.715742528f, 0.893262684f},
-std::array<float,2>{0.603426039f, 0.157135054f},
-std::array<float,2>{0.259789228f, 0.759912074f},
-std::array<float,2>{0.160080343f, 0.442616224f},
-std::array<float,2>{0.970898807f, 0.654044628f},
-std::array<float,2>{0.639842808f, 0.408707917f},
-std::array<float,2>{0.430552661f, 0.713615417f},
-std::array<float,2>{0.0807138309f, 0.209580243f},
-std::array<float,2>{0.780679524f, 0.872311473f},
-std::array<float,2>{0.879549623f, 0.0637535155f},
-std::array<float,2>{0.234614998f, 0.970884085f},
-std::array<float,2>{0.339940608f, 0.366169125f},
-std::array<float,2>{0.509027958f, 0.601709187f},
-std::array<float,2>{0.754682243f, 0.391414851f},
-std::array<float,2>{0.0647335574f, 0.744501293f},
-std::array<float,2>{0.409040391f, 0.231782019f},
-std::array<float,2>{0.655163407f, 0.832533836f},
-std::array<float,2>{0.525425017f, 0.0961226076f},
-std::array<float,2>{0.317586124f, 0.964505076f},
-std::array<float,2>{0.224936619f, 0.339421868f},
-std::array<float,2>{0.896273255f, 0.57050246f},
-std::array<float,2>{0.696315765f, 0.304213911f},
-std::array<float,2>{0.471330523f, 0.502485394f},
-std::array<float,2>{0.0438475758f, 0.0573649406f},
-std::array<float,2>{0.839197516f, 0.908937454f},
-std::array<float,2>{0.992009997f, 0.154867798f},
-std::array<float,2>{0.172205314f, 0.791921318f},
-std::array<float,2>{0.27647984f, 0.496789396f},
-std::array<float,2>{0.615010381f, 0.687043846f},
-std::array<float,2>{0.934538603f, 0.351834774f},
-std::array<float,2>{0.20554547f, 0.616079032f},
-std::array<float,2>{0.346519738f, 0.0931302384f},
-std::array<float,2>{0.555552602f, 0.98833245f},
-std::array<float,2>{0.679080606f, 0.197082892f},
-std::array<float,2>{0.39437604f, 0.855991423f},
-std::array<float,2>{0.114309438f, 0.432368636f},
-std::array<float,2>{0.787000597f, 0.702658713f},
-std::array<float,2>{0.562632143f, 0.458592623f},
-std::array<float,2>{0.287947297f, 0.636054635f},
-std::array<float,2>{0.148994461f, 0.181174353f},
-std::array<float,2>{0.938407302f, 0.770869434f},
-std::array<float,2>{0.867722452f, 0.0200708192f},
-std::array<float,2>{0.0098145688f, 0.883030176f},
-std::array<float,2>{0.437701106f, 0.272053212f},
-std::array<float,2>{0.742039859f, 0.544912457f},
-std::array<float,2>{0.903062463f, 0.42595154f},
-std::array<float,2>{0.230572626f, 0.692319214f},
-std::array<float,2>{0.326783866f, 0.193982571f},
-std::array<float,2>{0.522387087f, 0.850307524f},
-std::array<float,2>{0.644866407f, 0.0805921182f},
-std::array<float,2>{0.421159565f, 0.997296214f},
-std::array<float,2>{0.07781142f, 0.34562844f},
-std::array<float,2>{0.765306771f, 0.624023199f},
-std::array<float,2>{0.624695599f, 0.27952525f},
-std::array<float,2>{0.26935631f, 0.532920003f},
-std::array<float,2>{0.180859298f, 0.0299373157f},
-std::array<float,2>{0.993734121f, 0.876628876f},
-std::array<float,2>{0.832725823f, 0.17467232f},
-std::array<float,2>{0.0327496342f, 0.775715351f},
-std::array<float,2>{0.480373949f, 0.461927801f},
-std::array<float,2>{0.68994832f, 0.62966609f},
-std::array<float,2>{0.793381631f, 0.329786956f},
-std::array<float,2>{0.120198429f, 0.56333375f},
-std::array<float,2>{0.406053364f, 0.105266429f},
-std::array<float,2>{0.684455156f, 0.95482558f},
-std::array<float,2>{0.552316189f, 0.218831807f},
-std::array<float,2>{0.355931461f, 0.838941753f},
-std::array<float,2>{0.213578448f, 0.405637115f},
-std::array<float,2>{0.927409172f, 0.734595656f},
-std::array<float,2>{0.74260354f, 0.489152819f},
-std::array<float,2>{0.450767815f, 0.678849936f},
-std::array<float,2>{0.00139524403f, 0.146652088f},
-std::array<float,2>{0.864230454f, 0.78398329f},
-std::array<float,2>{0.951986492f, 0.0491503961f},
-std::array<float,2>{0.143137991f, 0.919251382f},
-std::array<float,2>{0.289403498f, 0.312393099f},
-std::array<float,2>{0.574395299f, 0.509757578f},
-std::array<float,2>{0.848630965f, 0.451969862f},
-std::array<float,2>{0.0180569291f, 0.64157778f},
-std::array<float,2>{0.465466321f, 0.168462768f},
-std::array<float,2>{0.729092717f, 0.75653249f},
-std::array<float,2>{0.579165518f, 0.00700327661f},
-std::array<float,2>{0.311674327f, 0.901181817f},
-std::array<float,2>{0.126626477f, 0.255183935f},
-std::array<float,2>{0.963799417f, 0.556539237f},
-std::array<float,2>{0.656801522f, 0.37251088f},
-std::array<float,2>{0.378619522f, 0.593809545f},
-std::array<float,2>{0.0962790698f, 0.0758937001f},
-std::array<float,2>{0.809894025f, 0.977632642f},
-std::array<float,2>{0.909927309f, 0.214169413f},
-std::array<float,2>{0.196379527f, 0.865900218f},
-std::array<float,2>{0.366894156f, 0.421297222f},
-std::array<float,2>{0.543899119f, 0.708298564f},
-std::array<float,2>{0.978138983f, 0.28309226f},
-std::array<float,2>{0.165172771f, 0.520972192f},
-std::array<float,2>{0.252568573f, 0.032555677f},
-std::array<float,2>{0.596492827f, 0.934222817f},
-std::array<float,2>{0.703890324f, 0.135677636f},
-std::array<float,2>{0.484867126f, 0.801207125f},
-std::array<float,2>{0.0514516681f, 0.480362087f},
-std::array<float,2>{0.825762093f, 0.668126583f},
-std::array<float,2>{0.500322998f, 0.383081585f},
-std::array<float,2>{0.32954064f, 0.728564441f},
-std::array<float,2>{0.243756205f, 0.248382464f},
-std::array<float,2>{0.885267675f, 0.816865683f},
-std::array<float,2>{0.769529283f, 0.124146707f},
-std::array<float,2>{0.0909890532f, 0.944333017f},
-std::array<float,2>{0.425812811f, 0.315126508f},
-std::array<float,2>{0.630120814f, 0.579555035f},
-std::array<float,2>{0.99701643f, 0.38215661f},
-std::array<float,2>{0.185141221f, 0.723756135f},
-std::array<float,2>{0.270206839f, 0.234960794f},
-std::array<float,2>{0.621040523f, 0.827479064f},
-std::array<float,2>{0.695200682f, 0.11404521f},
-std::array<float,2>{0.48200953f, 0.946307302f},
-std::array<float,2>{0.0375763886f, 0.32590878f},
-std::array<float,2>{0.829206824f, 0.587714493f},
-std::array<float,2>{0.51773423f, 0.289828688f},
-std::array<float,2>{0.321905285f, 0.523946524f},
-std::array<float,2>{0.229113147f, 0.046341408f},
-std::array<float,2>{0.90078032f, 0.928587854f},
-std::array<float,2>{0.757950783f, 0.131465629f},
-std::array<float,2>{0.0709785894f, 0.81015569f},
-std::array<float,2>{0.415896356f, 0.476171076f},
-std::array<float,2>{0.642123401f, 0.658583283f},
-std::array<float,2>{0.862575173f, 0.361067861f},
-std::array<float,2>{0.00535038812f, 0.606430292f},
-std::array<float,2>{0.447968781f, 0.0690793991f},
-std::array<float,2>{0.748455048f, 0.974855065f},
-std::array<float,2>{0.573579848f, 0.206684962f},
-std::array<float,2>{0.295943528f, 0.869588137f},
-std::array<float,2>{0.14723587f, 0.411608368f},
-std::array<float,2>{0.945341349f, 0.716503143f},
-std::array<float,2>{0.683403015f, 0.439898282f},
-std::array<float,2>{0.399549156f, 0.651839375f},
-std::array<float,2>{0.124760784f, 0.163173988f},
-std::array<float,2>{0.792675614f, 0.762174189f},
-std::array<float,2>{0.923088014f, 0.0115326988f},
-std::array<float,2>{0.215958089f, 0.897744715f},
-std::array<float,2>{0.354712903f, 0.263333857f},
-std::array<float,2>{0.548228502f, 0.548134804f},
-std::array<float,2>{0.807657778f, 0.495223671f},
-std::array<float,2>{0.0980394408f, 0.680735469f},
-std::array<float,2>{0.382039756f, 0.151681483f},
-std::array<float,2>{0.661000252f, 0.793862283f},
-std::array<float,2>{0.541580319f, 0.0595060512f},
-std::array<float,2>{0.361167312f, 0.911792696f},
-std::array<float,2>{0.199935347f, 0.298687786f},
-std::array<float,2>{0.910904765f, 0.507093906f},
-std::array<float,2>{0.732411206f, 0.342346311f},
-std::array<float,2>{0.464200199f, 0.578117669f},
-std::array<float,2>{0.019830972f, 0.101269796f},
-std::array<float,2>{0.845635176f, 0.967188537f},
-std::array<float,2>{0.9667781f, 0.226850703f},
-std::array<float,2>{0.129794598f, 0.82947731f},
-std::array<float,2>{0.306357473f, 0.394815564f},
-std::array<float,2>{0.585771203f, 0.747732639f},
-std::array<float,2>{0.888453245f, 0.267285436f},
-std::array<float,2>{0.24919112f, 0.539293051f},
-std::array<float,2>{0.335531771f, 0.0193867907f},
-std::array<float,2>{0.506113112f, 0.888526797f},
-std::array<float,2>{0.625305831f, 0.187097594f},
-std::array<float,2>{0.424158573f, 0.769368947f},
-std::array<float,2>{0.0891470835f, 0.454381794f},
-std::array<float,2>{0.770150661f, 0.638046205f},
-std::array<float,2>{0.599870503f, 0.434723705f},
-std::array<float,2>{0.257748425f, 0.699148536f},
-std::array<float,2>{0.168793723f, 0.201171458f},
-std::array<float,2>{0.98093611f, 0.854483306f},
-std::array<float,2>{0.822489917f, 0.0870970637f},
-std::array<float,2>{0.0501214229f, 0.986179531f},
-std::array<float,2>{0.490780771f, 0.357708544f},
-std::array<float,2>{0.707553983f, 0.611121118f},
-std::array<float,2>{0.92128855f, 0.467451692f},
-std::array<float,2>{0.192679837f, 0.628880799f},
-std::array<float,2>{0.374190599f, 0.176198557f},
-std::array<float,2>{0.534782827f, 0.778468966f},
-std::array<float,2>{0.665137947f, 0.0266103707f},
-std::array<float,2>{0.3886033f, 0.879958808f},
-std::array<float,2>{0.101663426f, 0.27353543f},
-std::array<float,2>{0.797360778f, 0.538589895f},
-std::array<float,2>{0.588159502f, 0.349598527f},
-std::array<float,2>{0.301084191f, 0.61875391f},
-std::array<float,2>{0.140589997f, 0.0831487775f},
-std::array<float,2>{0.957508147f, 0.994074345f},
-std::array<float,2>{0.855098665f, 0.188197196f},
-std::array<float,2>{0.0283365082f, 0.844208539f},
-std::array<float,2>{0.457464606f, 0.422620535f},
-std::array<float,2>{0.726220131f, 0.690014482f},
-std::array<float,2>{0.77441293f, 0.308286428f},
-std::array<float,2>{0.0835690275f, 0.515001416f},
-std::array<float,2>{0.434400141f, 0.0508965403f},
-std::array<float,2>{0.633075356f, 0.917410731f},
-std::array<float,2>{0.514117718f, 0.142698318f},
-std::array<float,2>{0.337530166f, 0.78693819f},
-std::array<float,2>{0.238886341f, 0.485243857f},
-std::array<float,2>{0.875645339f, 0.674142838f},
-std::array<float,2>{0.714632928f, 0.40002647f},
-std::array<float,2>{0.493498564f, 0.738966644f},
-std::array<float,2>{0.0556750223f, 0.224666581f},
-std::array<float,2>{0.815560937f, 0.842159033f},
-std::array<float,2>{0.975539327f, 0.10727483f},
-std::array<float,2>{0.160169169f, 0.960870206f},
-std::array<float,2>{0.262818187f, 0.335032225f},
-std::array<float,2>{0.606567383f, 0.569206417f},
-std::array<float,2>{0.841435432f, 0.415427178f},
-std::array<float,2>{0.0398792289f, 0.705839097f},
-std::array<float,2>{0.473623991f, 0.216535717f},
-std::array<float,2>{0.701696575f, 0.863082528f},
-std::array<float,2>{0.612471044f, 0.0709554926f},
-std::array<float,2>{0.2798675f, 0.98367548f},
-std::array<float,2>{0.178684458f, 0.369132102f},
-std::array<float,2>{0.987297535f, 0.600383282f},
-std::array<float,2>{0.652071774f, 0.253564358f},
-std::array<float,2>{0.413242996f, 0.559304953f},
-std::array<float,2>{0.0689110607f, 0.00122436986f},
-std::array<float,2>{0.751355708f, 0.905404329f},
-std::array<float,2>{0.891191423f, 0.166974723f},
-std::array<float,2>{0.222431526f, 0.750220895f},
-std::array<float,2>{0.31558615f, 0.445960671f},
-std::array<float,2>{0.529396951f, 0.64738065f},
-std::array<float,2>{0.943402767f, 0.31956616f},
-std::array<float,2>{0.155709073f, 0.58441335f},
-std::array<float,2>{0.283177137f, 0.119716436f},
-std::array<float,2>{0.567701519f, 0.93807739f},
-std::array<float,2>{0.734456837f, 0.245894894f},
-std::array<float,2>{0.444901228f, 0.813943326f},
-std::array<float,2>{0.0135554858f, 0.389480442f},
-std::array<float,2>{0.872621596f, 0.73112458f},
-std::array<float,2>{0.559639633f, 0.481047571f},
-std::array<float,2>{0.34814164f, 0.665794015f},
-std::array<float,2>{0.2078484f, 0.138961688f},
-std::array<float,2>{0.933141291f, 0.799874485f},
-std::array<float,2>{0.782768428f, 0.0387876406f},
-std::array<float,2>{0.112717122f, 0.933455169f},
-std::array<float,2>{0.394894421f, 0.286834031f},
-std::array<float,2>{0.673037231f, 0.51821661f},
-std::array<float,2>{0.988831341f, 0.498000562f},
-std::array<float,2>{0.17485109f, 0.68631345f},
-std::array<float,2>{0.273750782f, 0.155571625f},
-std::array<float,2>{0.6154778f, 0.792302847f},
-std::array<float,2>{0.698746979f, 0.0581184626f},
-std::array<float,2>{0.469204366f, 0.909486592f},
-std::array<float,2>{0.0457908772f, 0.303266287f},
-std::array<float,2>{0.83637768f, 0.50342834f},
-std::array<float,2>{0.525293827f, 0.338693142f},
-std::array<float,2>{0.318659574f, 0.571487963f},
-std::array<float,2>{0.224383608f, 0.0971637145f},
-std::array<float,2>{0.898056746f, 0.963275254f},
-std::array<float,2>{0.757808328f, 0.230648831f},
-std::array<float,2>{0.0638082474f, 0.83348f},
-std::array<float,2>{0.406410068f, 0.392264336f},
-std::array<float,2>{0.65262115f, 0.745799005f},
-std::array<float,2>{0.869879305f, 0.273162603f},
-std::array<float,2>{0.00885368418f, 0.54308784f},
-std::array<float,2>{0.439572722f, 0.0206176471f},
-std::array<float,2>{0.738912821f, 0.883887529f},
-std::array<float,2>{0.565062106f, 0.180166796f},
-std::array<float,2>{0.286011636f, 0.770018101f},
-std::array<float,2>{0.151317179f, 0.457248271f},
-std::array<float,2>{0.941021681f, 0.635072589f},
-std::array<float,2>{0.677453876f, 0.43352285f},
-std::array<float,2>{0.391684562f, 0.70186311f},
-std::array<float,2>{0.116754875f, 0.195885777f},
-std::array<float,2>{0.787604392f, 0.856498241f},
-std::array<float,2>{0.937479258f, 0.0923537537f},
-std::array<float,2>{0.203303725f, 0.989264965f},
-std::array<float,2>{0.344995797f, 0.353150368f},
-std::array<float,2>{0.558365762f, 0.616715908f},
-std::array<float,2>{0.80205375f, 0.377683997f},
-std::array<float,2>{0.107847884f, 0.719490588f},
-std::array<float,2>{0.384460211f, 0.239047468f},
-std::array<float,2>{0.669057727f, 0.821979761f},
-std::array<float,2>{0.537920177f, 0.110799655f},
-std::array<float,2>{0.369966835f, 0.9498685f},
-std::array<float,2>{0.189621687f, 0.322078079f},
-std::array<float,2>{0.914399326f, 0.591531754f},
-std::array<float,2>{0.72203666f, 0.294071674f},
-std::array<float,2>{0.454451501f, 0.530108869f},
-std::array<float,2>{0.0246023666f, 0.0420668647f},
-std::array<float,2>{0.857402802f, 0.922726691f},
-std::array<float,2>{0.954221189f, 0.126146644f},
-std::array<float,2>{0.136206836f, 0.808566391f},
-std::array<float,2>{0.298608691f, 0.469385564f},
-std::array<float,2>{0.59326005f, 0.664018631f},
-std::array<float,2>{0.881296813f, 0.36707589f},
-std::array<float,2>{0.237318069f, 0.602719307f},
-std::array<float,2>{0.342740715f, 0.0632012412f},
-std::array<float,2>{0.510216415f, 0.972217321f},
-std::array<float,2>{0.637484431f, 0.210374668f},
-std::array<float,2>{0.433326542f, 0.871242702f},
-std::array<float,2>{0.0793783739f, 0.409883976f},
-std::array<float,2>{0.779123306f, 0.714086115f},
-std::array<float,2>{0.604938507f, 0.441771954f},
-std::array<float,2>{0.258998573f, 0.65314585f},
-std::array<float,2>{0.157847211f, 0.158146679f},
-std::array<float,2>{0.969574094f, 0.761586428f},
-std::array<float,2>{0.817505956f, 0.015555989f},
-std::array<float,2>{0.0606342554f, 0.894185781f},
-std::array<float,2>{0.49863717f, 0.260918498f},
-std::array<float,2>{0.718595207f, 0.552237332f},
-std::array<float,2>{0.906942308f, 0.420406818f},
-std::array<float,2>{0.199078485f, 0.707688987f},
-std::array<float,2>{0.36405623f, 0.213514671f},
-std::array<float,2>{0.545532107f, 0.866543114f},
-std::array<float,2>{0.65870297f, 0.0743141472f},
-std::array<float,2>{0.375439048f, 0.976640403f},
-std::array<float,2>{0.0949095413f, 0.371955603f},
-std::array<float,2>{0.812107921f, 0.594830096f},
-std::array<float,2>{0.581020176f, 0.254807651f},
-std::array<float,2>{0.308805078f, 0.555216134f},
-std::array<float,2>{0.126999691f, 0.00608362909f},
-std::array<float,2>{0.962479949f, 0.902058542f},
-std::array<float,2>{0.851342916f, 0.169322237f},
-std::array<float,2>{0.016596565f, 0.756882071f},
-std::array<float,2>{0.467278749f, 0.453032136f},
-std::array<float,2>{0.727242231f, 0.642177045f},
-std::array<float,2>{0.766760468f, 0.315519184f},
-std::array<float,2>{0.092353873f, 0.578999996f},
-std::array<float,2>{0.429102629f, 0.123595826f},
-std::array<float,2>{0.631171465f, 0.94436413f},
-std::array<float,2>{0.503679574f, 0.249244973f},
-std::array<float,2>{0.33193934f, 0.817619443f},
-std::array<float,2>{0.244888678f, 0.384230614f},
-std::array<float,2>{0.884341002f, 0.730053484f},
-std::array<float,2>{0.706043839f, 0.479277253f},
-std::array<float,2>{0.48775056f, 0.669418335f},
-std::array<float,2>{0.0541318804f, 0.136326343f},
-std::array<float,2>{0.8272205f, 0.801864386f},
-std::array<float,2>{0.980104566f, 0.0313269757f},
-std::array<float,2>{0.166761994f, 0.934861541f},
-std::array<float,2>{0.250357956f, 0.28136763f},
-std::array<float,2>{0.594482005f, 0.520182014f},
-std::array<float,2>{0.834305882f, 0.46184817f},
-std::array<float,2>{0.0349900872f, 0.630484939f},
-std::array<float,2>{0.477687895f, 0.175217807f},
-std::array<float,2>{0.688134789f, 0.776441514f},
-std::array<float,2>{0.62154454f, 0.0307047479f},
-std::array<float,2>{0.265762746f, 0.875706792f},
-std::array<float,2>{0.182566628f, 0.281082153f},
-std::array<float,2>{0.994588196f, 0.532133818f},
-std::array<float,2>{0.648003757f, 0.344473332f},
-std::array<float,2>{0.419738114f, 0.624783933f},
-std::array<float,2>{0.0749826655f, 0.0812960714f},
-std::array<float,2>{0.76183939f, 0.996776462f},
-std::array<float,2>{0.905383945f, 0.194656745f},
-std::array<float,2>{0.232768849f, 0.850786269f},
-std::array<float,2>{0.324483424f, 0.426774681f},
-std::array<float,2>{0.521455467f, 0.692435563f},
-std::array<float,2>{0.950791478f, 0.311336845f},
-std::array<float,2>{0.141361579f, 0.508507729f},
-std::array<float,2>{0.291322261f, 0.050205037f},
-std::array<float,2>{0.576775849f, 0.918778181f},
-std::array<float,2>{0.744372189f, 0.147561371f},
-std::array<float,2>{0.452397794f, 0.784757614f},
-std::array<float,2>{0.00380645879f, 0.48948288f},
-std::array<float,2>{0.865675509f, 0.677824378f},
-std::array<float,2>{0.554639101f, 0.404999673f},
-std::array<float,2>{0.358292311f, 0.736152947f},
-std::array<float,2>{0.211553305f, 0.220606774f},
-std::array<float,2>{0.928316772f, 0.838281155f},
-std::array<float,2>{0.796774149f, 0.104204759f},
-std::array<float,2>{0.118666805f, 0.953941226f},
-std::array<float,2>{0.403346986f, 0.328919768f},
-std::array<float,2>{0.686315298f, 0.56351006f},
-std::array<float,2>{0.968230128f, 0.395516217f},
-std::array<float,2>{0.131607369f, 0.746868134f},
-std::array<float,2>{0.308268934f, 0.227763131f},
-std::array<float,2>{0.583149791f, 0.828736186f},
-std::array<float,2>{0.732996047f, 0.100555018f},
-std::array<float,2>{0.462786436f, 0.968711436f},
-std::array<float,2>{0.0223676059f, 0.343052804f},
-std::array<float,2>{0.847450018f, 0.576834917f},
-std::array<float,2>{0.54018575f, 0.297157466f},
-std::array<float,2>{0.362177938f, 0.506831288f},
-std::array<float,2>{0.202311814f, 0.060493622f},
-std::array<float,2>{0.912430286f, 0.910912871f},
-std::array<float,2>{0.80470264f, 0.151343212f},
-std::array<float,2>{0.101362966f, 0.794717491f},
-std::array<float,2>{0.379652739f, 0.49497664f},
-std::array<float,2>{0.663611114f, 0.679704666f},
-std::array<float,2>{0.821807086f, 0.358980685f},
-std::array<float,2>{0.0483684987f, 0.609723806f},
-std::array<float,2>{0.488659263f, 0.0865595192f},
-std::array<float,2>{0.710815072f, 0.9844203f},
-std::array<float,2>{0.598677218f, 0.200147957f},
-std::array<float,2>{0.254153401f, 0.854840875f},
-std::array<float,2>{0.171340853f, 0.433894128f},
-std::array<float,2>{0.983201623f, 0.697969794f},
-std::array<float,2>{0.627029657f, 0.453726619f},
-std::array<float,2>{0.4220469f, 0.637447655f},
-std::array<float,2>{0.0876174122f, 0.185860619f},
-std::array<float,2>{0.771798849f, 0.768036366f},
-std::array<float,2>{0.889695883f, 0.0184536949f},
-std::array<float,2>{0.247455582f, 0.887550175f},
-std::array<float,2>{0.333716393f, 0.266450971f},
-std::array<float,2>{0.505462706f, 0.540156901f},
-std::array<float,2>{0.760928631f, 0.47513786f},
-std::array<float,2>{0.0724171251f, 0.660018444f},
-std::array<float,2>{0.417936295f, 0.132078871f},
-std::array<float,2>{0.644361317f, 0.808782339f},
-std::array<float,2>{0.516959131f, 0.0450296253f},
-std::array<float,2>{0.322744399f, 0.929346979f},
-std::array<float,2>{0.226898864f, 0.290359944f},
-std::array<float,2>{0.899388194f, 0.524806619f},
-std::array<float,2>{0.69147706f, 0.324827522f},
-std::array<float,2>{0.483756512f, 0.586106837f},
-std::array<float,2>{0.0364692993f, 0.114874676f},
-std::array<float,2>{0.831931531f, 0.94555527f},
-std::array<float,2>{0.99908185f, 0.236096278f},
-std::array<float,2>{0.185749322f, 0.827081561f},
-std::array<float,2>{0.271671623f, 0.381059766f},
-std::array<float,2>{0.618121982f, 0.723010838f},
-std::array<float,2>{0.92464453f, 0.261866987f},
-std::array<float,2>{0.218207911f, 0.547665775f},
-std::array<float,2>{0.353188425f, 0.0101140803f},
-std::array<float,2>{0.548922479f, 0.896638691f},
-std::array<float,2>{0.679899573f, 0.162291929f},
-std::array<float,2>{0.400713354f, 0.763644278f},
-std::array<float,2>{0.121651031f, 0.441098034f},
-std::array<float,2>{0.789668202f, 0.651200175f},
-std::array<float,2>{0.570378363f, 0.410994828f},
-std::array<float,2>{0.294713497f, 0.715092421f},
-std::array<float,2>{0.144674942f, 0.205253169f},
-std::array<float,2>{0.949091733f, 0.870446742f},
-std::array<float,2>{0.860117376f, 0.0701681301f},
-std::array<float,2>{0.00684292894f, 0.976239145f},
-std::array<float,2>{0.447129041f, 0.360248029f},
-std::array<float,2>{0.746177852f, 0.607313991f},
-std::array<float,2>{0.89348501f, 0.446958363f},
-std::array<float,2>{0.220063552f, 0.648134112f},
-std::array<float,2>{0.313405037f, 0.167809054f},
-std::array<float,2>{0.527920187f, 0.75130862f},
-std::array<float,2>{0.649513602f, 0.00068179646f},
-std::array<float,2>{0.410220891f, 0.904814601f},
-std::array<float,2>{0.0682762191f, 0.252890587f},
-std::array<float,2>{0.752539933f, 0.559666336f},
-std::array<float,2>{0.609732151f, 0.367688805f},
-std::array<float,2>{0.278101087f, 0.600707769f},
-std::array<float,2>{0.177283451f, 0.071885556f},
-std::array<float,2>{0.984772086f, 0.983317554f},
-std::array<float,2>{0.841945887f, 0.215560839f},
-std::array<float,2>{0.0429095961f, 0.862112224f},
-std::array<float,2>{0.475604624f, 0.41464597f},
-std::array<float,2>{0.700775921f, 0.706188023f},
-std::array<float,2>{0.783475816f, 0.285267234f},
-std::array<float,2>{0.109514251f, 0.519148052f},
-std::array<float,2>{0.397538096f, 0.0374011472f},
-std::array<float,2>{0.674340904f, 0.932572842f},
-std::array<float,2>{0.561341226f, 0.13972868f},
-std::array<float,2>{0.350078225f, 0.799000919f},
-std::array<float,2>{0.21003896f, 0.481521964f},
-std::array<float,2>{0.931372106f, 0.664289951f},
-std::array<float,2>{0.736850262f, 0.39035511f},
-std::array<float,2>{0.443183899f, 0.731929004f},
-std::array<float,2>{0.0143684112f, 0.244290188f},
-std::array<float,2>{0.873583853f, 0.813000023f},
-std::array<float,2>{0.942704618f, 0.120438784f},
-std::array<float,2>{0.153335482f, 0.938541889f},
-std::array<float,2>{0.284885108f, 0.318422914f},
-std::array<float,2>{0.569398224f, 0.584989667f},
-std::array<float,2>{0.852244318f, 0.423538655f},
-std::array<float,2>{0.0301107783f, 0.690856755f},
-std::array<float,2>{0.45961231f, 0.18876712f},
-std::array<float,2>{0.723568261f, 0.845018923f},
-std::array<float,2>{0.587023795f, 0.0829598084f},
-std::array<float,2>{0.303345889f, 0.992679596f},
-std::array<float,2>{0.138380066f, 0.347937733f},
-std::array<float,2>{0.96032685f, 0.618008375f},
-std::array<float,2>{0.66688633f, 0.27496925f},
-std::array<float,2>{0.389213711f, 0.537198842f},
-std::array<float,2>{0.104691774f, 0.0255949069f},
-std::array<float,2>{0.799656212f, 0.87897265f},
-std::array<float,2>{0.918970764f, 0.177147061f},
-std::array<float,2>{0.193868861f, 0.777565539f},
-std::array<float,2>{0.371935934f, 0.468599468f},
-std::array<float,2>{0.533061564f, 0.627639115f},
-std::array<float,2>{0.973916471f, 0.334430277f},
-std::array<float,2>{0.163175434f, 0.57026428f},
-std::array<float,2>{0.265524417f, 0.105693936f},
-std::array<float,2>{0.60830754f, 0.959124625f},
-std::array<float,2>{0.712208331f, 0.226014584f},
-std::array<float,2>{0.49457103f, 0.842891157f},
-std::array<float,2>{0.058137536f, 0.399021924f},
-std::array<float,2>{0.81294018f, 0.73975724f},
-std::array<float,2>{0.513521969f, 0.485473216f},
-std::array<float,2>{0.33886373f, 0.675295889f},
-std::array<float,2>{0.240469158f, 0.144388288f},
-std::array<float,2>{0.877923846f, 0.785277367f},
-std::array<float,2>{0.776137948f, 0.0523751155f},
-std::array<float,2>{0.0842944458f, 0.916128576f},
-std::array<float,2>{0.435923278f, 0.306901157f},
-std::array<float,2>{0.635381103f, 0.514492631f},
-std::array<float,2>{0.939403236f, 0.459347159f},
-std::array<float,2>{0.149805799f, 0.634684861f},
-std::array<float,2>{0.288230807f, 0.182589129f},
-std::array<float,2>{0.564366281f, 0.773000419f},
-std::array<float,2>{0.740894139f, 0.0229621548f},
-std::array<float,2>{0.438689709f, 0.886645615f},
-std::array<float,2>{0.0113999937f, 0.271235883f},
-std::array<float,2>{0.868807316f, 0.545383871f},
-std::array<float,2>{0.556258798f, 0.354574382f},
-std::array<float,2>{0.34755221f, 0.614706218f},
-std::array<float,2>{0.206167236f, 0.0899087712f},
-std::array<float,2>{0.934850216f, 0.992178023f},
-std::array<float,2>{0.785194039f, 0.197794735f},
-std::array<float,2>{0.113350831f, 0.858091295f},
-std::array<float,2>{0.39270094f, 0.430983067f},
-std::array<float,2>{0.677968562f, 0.699902415f},
-std::array<float,2>{0.837993681f, 0.302577585f},
-std::array<float,2>{0.0444102511f, 0.501259923f},
-std::array<float,2>{0.472554713f, 0.0562223606f},
-std::array<float,2>{0.69570452f, 0.907537639f},
-std::array<float,2>{0.61423105f, 0.152900606f},
-std::array<float,2>{0.27609387f, 0.789194822f},
-std::array<float,2>{0.173268378f, 0.499640942f},
-std::array<float,2>{0.991157532f, 0.684854984f},
-std::array<float,2>{0.655355871f, 0.392765731f},
-std::array<float,2>{0.410044611f, 0.743656158f},
-std::array<float,2>{0.0660645068f, 0.232762322f},
-std::array<float,2>{0.755049527f, 0.835842431f},
-std::array<float,2>{0.894794285f, 0.0946955308f},
-std::array<float,2>{0.226438835f, 0.962130845f},
-std::array<float,2>{0.317069262f, 0.336357802f},
-std::array<float,2>{0.527231574f, 0.572747111f},
-std::array<float,2>{0.779432237f, 0.407743633f},
-std::array<float,2>{0.0813671649f, 0.712396145f},
-std::array<float,2>{0.430754215f, 0.207273826f},
-std::array<float,2>{0.639529526f, 0.873976767f},
-std::array<float,2>{0.508541763f, 0.066038996f},
-std::array<float,2>{0.341002852f, 0.969185948f},
-std::array<float,2>{0.235954493f, 0.365133971f},
-std::array<float,2>{0.879929185f, 0.604566038f},
-std::array<float,2>{0.716305494f, 0.259479016f},
-std::array<float,2>{0.497795582f, 0.553201556f},
-std::array<float,2>{0.0594862625f, 0.0130097521f},
-std::array<float,2>{0.819745243f, 0.891710877f},
-std::array<float,2>{0.971949875f, 0.159737527f},
-std::array<float,2>{0.158368737f, 0.758716285f},
-std::array<float,2>{0.260923058f, 0.445015103f},
-std::array<float,2>{0.601713359f, 0.654839396f},
-std::array<float,2>{0.916889191f, 0.323935419f},
-std::array<float,2>{0.188357696f, 0.593576849f},
-std::array<float,2>{0.367756039f, 0.111969933f},
-std::array<float,2>{0.536310554f, 0.952105641f},
-std::array<float,2>{0.670390129f, 0.241752014f},
-std::array<float,2>{0.38527444f, 0.823441505f},
-std::array<float,2>{0.107279263f, 0.375376135f},
-std::array<float,2>{0.80355072f, 0.722021878f},
-std::array<float,2>{0.589849055f, 0.471197933f},
-std::array<float,2>{0.299282253f, 0.660950661f},
-std::array<float,2>{0.133673862f, 0.126967132f},
-std::array<float,2>{0.955283821f, 0.805218875f},
-std::array<float,2>{0.858523846f, 0.0404086113f},
-std::array<float,2>{0.0271594692f, 0.923871875f},
-std::array<float,2>{0.45540905f, 0.296867192f},
-std::array<float,2>{0.718794882f, 0.528971195f},
-std::array<float,2>{0.886592686f, 0.386166334f},
-std::array<float,2>{0.243008345f, 0.726663351f},
-std::array<float,2>{0.328622788f, 0.246972039f},
-std::array<float,2>{0.501047254f, 0.818413258f},
-std::array<float,2>{0.629281163f, 0.123046771f},
-std::array<float,2>{0.427014589f, 0.941913068f},
-std::array<float,2>{0.0902832448f, 0.313863337f},
-std::array<float,2>{0.76783824f, 0.580975533f},
-std::array<float,2>{0.597114325f, 0.283682406f},
-std::array<float,2>{0.253748745f, 0.52270031f},
-std::array<float,2>{0.165029913f, 0.0344640166f},
-std::array<float,2>{0.976930141f, 0.936549246f},
-std::array<float,2>{0.824254334f, 0.133479789f},
-std::array<float,2>{0.052380614f, 0.803493977f},
-std::array<float,2>{0.485372603f, 0.477595955f},
-std::array<float,2>{0.704158843f, 0.671314001f},
-std::array<float,2>{0.809549093f, 0.374404639f},
-std::array<float,2>{0.0971512124f, 0.596595526f},
-std::array<float,2>{0.37739712f, 0.0777074173f},
-std::array<float,2>{0.657989442f, 0.97994101f},
-std::array<float,2>{0.544802547f, 0.211225435f},
-std::array<float,2>{0.36575079f, 0.865059912f},
-std::array<float,2>{0.195505753f, 0.418560296f},
-std::array<float,2>{0.908575952f, 0.709904194f},
-std::array<float,2>{0.729944766f, 0.451118261f},
-std::array<float,2>{0.466384292f, 0.643857658f},
-std::array<float,2>{0.0191290993f, 0.171139151f},
-std::array<float,2>{0.848767519f, 0.754103363f},
-std::array<float,2>{0.964791954f, 0.00422238698f},
-std::array<float,2>{0.125169277f, 0.898671687f},
-std::array<float,2>{0.310959637f, 0.257198483f},
-std::array<float,2>{0.578481019f, 0.556764364f},
-std::array<float,2>{0.86518538f, 0.491312891f},
-std::array<float,2>{8.51531331e-06f, 0.676900923f},
-std::array<float,2>{0.449400157f, 0.14579092f},
-std::array<float,2>{0.74395436f, 0.781655312f},
-std::array<float,2>{0.575349808f, 0.0484176651f},
-std::array<float,2>{0.290445894f, 0.921293676f},
-std::array<float,2>{0.143969789f, 0.309905261f},
-std::array<float,2>{0.952700853f, 0.51122123f},
-std::array<float,2>{0.684912682f, 0.331554502f},
-std::array<float,2>{0.404519856f, 0.564553022f},
-std::array<float,2>{0.119506769f, 0.101987273f},
-std::array<float,2>{0.794554532f, 0.955460072f},
-std::array<float,2>{0.926689088f, 0.2222168f},
-std::array<float,2>{0.214606181f, 0.836381853f},
-std::array<float,2>{0.356715173f, 0.403978795f},
-std::array<float,2>{0.551082671f, 0.736640334f},
-std::array<float,2>{0.992322385f, 0.278364599f},
-std::array<float,2>{0.179945499f, 0.533796132f},
-std::array<float,2>{0.267830402f, 0.0283421408f},
-std::array<float,2>{0.623417735f, 0.878576338f},
-std::array<float,2>{0.690511346f, 0.172192484f},
-std::array<float,2>{0.479128897f, 0.7753793f},
-std::array<float,2>{0.0313858651f, 0.463189662f},
-std::array<float,2>{0.833606064f, 0.632563293f},
-std::array<float,2>{0.522721469f, 0.42883122f},
-std::array<float,2>{0.327160001f, 0.6939044f},
-std::array<float,2>{0.232326239f, 0.192870393f},
-std::array<float,2>{0.903732002f, 0.849099576f},
-std::array<float,2>{0.764132321f, 0.0796674788f},
-std::array<float,2>{0.076953344f, 0.999890149f},
-std::array<float,2>{0.420543343f, 0.345787197f},
-std::array<float,2>{0.646459639f, 0.622438669f},
-std::array<float,2>{0.981475413f, 0.436845094f},
-std::array<float,2>{0.16990608f, 0.696258008f},
-std::array<float,2>{0.256512105f, 0.201836944f},
-std::array<float,2>{0.601366997f, 0.853338122f},
-std::array<float,2>{0.708037078f, 0.0896451622f},
-std::array<float,2>{0.492092758f, 0.988079369f},
-std::array<float,2>{0.0490591936f, 0.356042892f},
-std::array<float,2>{0.823408842f, 0.613133609f},
-std::array<float,2>{0.507348776f, 0.268397033f},
-std::array<float,2>{0.334533006f, 0.541190028f},
-std::array<float,2>{0.248655736f, 0.0170161836f},
-std::array<float,2>{0.887062252f, 0.889144957f},
-std::array<float,2>{0.770992637f, 0.185532004f},
-std::array<float,2>{0.0883576497f, 0.767055094f},
-std::array<float,2>{0.424961984f, 0.455289483f},
-std::array<float,2>{0.626232147f, 0.640429795f},
-std::array<float,2>{0.844548643f, 0.340392053f},
-std::array<float,2>{0.021354029f, 0.576052785f},
-std::array<float,2>{0.463383853f, 0.097961165f},
-std::array<float,2>{0.731389463f, 0.966386199f},
-std::array<float,2>{0.584131956f, 0.229944363f},
-std::array<float,2>{0.305273473f, 0.830294967f},
-std::array<float,2>{0.130283743f, 0.396498084f},
-std::array<float,2>{0.965114772f, 0.748257041f},
-std::array<float,2>{0.661732733f, 0.493758798f},
-std::array<float,2>{0.381573826f, 0.682146192f},
-std::array<float,2>{0.0992068425f, 0.149541229f},
-std::array<float,2>{0.806987643f, 0.795538127f},
-std::array<float,2>{0.911482692f, 0.0609620176f},
-std::array<float,2>{0.2003811f, 0.913796127f},
-std::array<float,2>{0.360005438f, 0.298893154f},
-std::array<float,2>{0.542881787f, 0.504905343f},
-std::array<float,2>{0.791341245f, 0.437626243f},
-std::array<float,2>{0.123161472f, 0.649221599f},
-std::array<float,2>{0.399017006f, 0.160196468f},
-std::array<float,2>{0.682233274f, 0.765590549f},
-std::array<float,2>{0.547100723f, 0.0080110468f},
-std::array<float,2>{0.354104221f, 0.895570695f},
-std::array<float,2>{0.215145543f, 0.265111685f},
-std::array<float,2>{0.922655106f, 0.549378514f},
-std::array<float,2>{0.749784887f, 0.361997187f},
-std::array<float,2>{0.448796839f, 0.607493222f},
-std::array<float,2>{0.00420939038f, 0.0666791722f},
-std::array<float,2>{0.861599863f, 0.974386752f},
-std::array<float,2>{0.946950495f, 0.204569206f},
-std::array<float,2>{0.14825049f, 0.868027806f},
-std::array<float,2>{0.295669287f, 0.413853645f},
-std::array<float,2>{0.572686374f, 0.71737808f},
-std::array<float,2>{0.902221799f, 0.292426229f},
-std::array<float,2>{0.229953721f, 0.5260849f},
-std::array<float,2>{0.320482165f, 0.0442163981f},
-std::array<float,2>{0.519016683f, 0.926756084f},
-std::array<float,2>{0.641551316f, 0.129522532f},
-std::array<float,2>{0.414767802f, 0.812021494f},
-std::array<float,2>{0.0719465092f, 0.473999292f},
-std::array<float,2>{0.759353638f, 0.657849133f},
-std::array<float,2>{0.620103598f, 0.380849183f},
-std::array<float,2>{0.271019638f, 0.726343632f},
-std::array<float,2>{0.183781371f, 0.237673268f},
-std::array<float,2>{0.997972012f, 0.825517297f},
-std::array<float,2>{0.828912377f, 0.116573922f},
-std::array<float,2>{0.0389814079f, 0.948085964f},
-std::array<float,2>{0.480744153f, 0.327249616f},
-std::array<float,2>{0.693975568f, 0.589224517f},
-std::array<float,2>{0.932313859f, 0.483336002f},
-std::array<float,2>{0.208838269f, 0.667547524f},
-std::array<float,2>{0.349412948f, 0.136982977f},
-std::array<float,2>{0.559348404f, 0.797685862f},
-std::array<float,2>{0.672529459f, 0.0361928381f},
-std::array<float,2>{0.395700514f, 0.930582583f},
-std::array<float,2>{0.112224616f, 0.288923323f},
-std::array<float,2>{0.78160584f, 0.516762078f},
-std::array<float,2>{0.566898704f, 0.317794651f},
-std::array<float,2>{0.281307697f, 0.5826931f},
-std::array<float,2>{0.15457502f, 0.118616745f},
-std::array<float,2>{0.944483876f, 0.940404773f},
-std::array<float,2>{0.871633887f, 0.242742345f},
-std::array<float,2>{0.0119943777f, 0.81609875f},
-std::array<float,2>{0.443743557f, 0.388126791f},
-std::array<float,2>{0.735758185f, 0.732626021f},
-std::array<float,2>{0.750679076f, 0.251750737f},
-std::array<float,2>{0.0701970235f, 0.562425733f},
-std::array<float,2>{0.412229806f, 0.00311802211f},
-std::array<float,2>{0.65108341f, 0.902355492f},
-std::array<float,2>{0.530707657f, 0.165052593f},
-std::array<float,2>{0.315267205f, 0.752960861f},
-std::array<float,2>{0.221423388f, 0.447783172f},
-std::array<float,2>{0.892472446f, 0.645444632f},
-std::array<float,2>{0.702494979f, 0.417901039f},
-std::array<float,2>{0.473640382f, 0.7038275f},
-std::array<float,2>{0.0406366661f, 0.217769235f},
-std::array<float,2>{0.840191483f, 0.859912038f},
-std::array<float,2>{0.988246143f, 0.07375063f},
-std::array<float,2>{0.179037347f, 0.980668724f},
-std::array<float,2>{0.280480087f, 0.369473785f},
-std::array<float,2>{0.611934483f, 0.598837197f},
-std::array<float,2>{0.814842165f, 0.400879174f},
-std::array<float,2>{0.0551268533f, 0.74096328f},
-std::array<float,2>{0.493085325f, 0.222901523f},
-std::array<float,2>{0.71299994f, 0.840386093f},
-std::array<float,2>{0.606095433f, 0.107725926f},
-std::array<float,2>{0.262058884f, 0.958495259f},
-std::array<float,2>{0.161954477f, 0.332689762f},
-std::array<float,2>{0.976525426f, 0.567709625f},
-std::array<float,2>{0.634391785f, 0.30563578f},
-std::array<float,2>{0.435078382f, 0.511787057f},
-std::array<float,2>{0.0821444169f, 0.0542359129f},
-std::array<float,2>{0.774799645f, 0.915324092f},
-std::array<float,2>{0.876266062f, 0.141434133f},
-std::array<float,2>{0.240102917f, 0.787197411f},
-std::array<float,2>{0.336018294f, 0.486487269f},
-std::array<float,2>{0.514759481f, 0.672778189f},
-std::array<float,2>{0.958072782f, 0.350968212f},
-std::array<float,2>{0.139184758f, 0.620218158f},
-std::array<float,2>{0.301997602f, 0.084650673f},
-std::array<float,2>{0.589547575f, 0.994582474f},
-std::array<float,2>{0.725095391f, 0.190399617f},
-std::array<float,2>{0.458596885f, 0.847368002f},
-std::array<float,2>{0.0282077324f, 0.42513904f},
-std::array<float,2>{0.853636682f, 0.687877297f},
-std::array<float,2>{0.533248603f, 0.465316951f},
-std::array<float,2>{0.373259693f, 0.626695037f},
-std::array<float,2>{0.192368746f, 0.178437591f},
-std::array<float,2>{0.920870423f, 0.779327571f},
-std::array<float,2>{0.798572719f, 0.0248588845f},
-std::array<float,2>{0.10255789f, 0.882301152f},
-std::array<float,2>{0.387452543f, 0.27692312f},
-std::array<float,2>{0.664523661f, 0.535626709f},
-std::array<float,2>{0.994745672f, 0.463580966f},
-std::array<float,2>{0.181999117f, 0.632108629f},
-std::array<float,2>{0.26625374f, 0.172555f},
-std::array<float,2>{0.621704638f, 0.774690807f},
-std::array<float,2>{0.68769753f, 0.0291149933f},
-std::array<float,2>{0.47843653f, 0.87816906f},
-std::array<float,2>{0.03454303f, 0.279205292f},
-std::array<float,2>{0.834734261f, 0.533400238f},
-std::array<float,2>{0.520868123f, 0.346557379f},
-std::array<float,2>{0.325021803f, 0.623036325f},
-std::array<float,2>{0.233373657f, 0.0794535875f},
-std::array<float,2>{0.905879796f, 0.999112427f},
-std::array<float,2>{0.762234747f, 0.193107694f},
-std::array<float,2>{0.0744763613f, 0.849132359f},
-std::array<float,2>{0.41915676f, 0.429461807f},
-std::array<float,2>{0.647839189f, 0.693743527f},
-std::array<float,2>{0.866050661f, 0.310334355f},
-std::array<float,2>{0.00318874279f, 0.511348486f},
-std::array<float,2>{0.452745289f, 0.0479116924f},
-std::array<float,2>{0.745066762f, 0.921512544f},
-std::array<float,2>{0.576228797f, 0.146009475f},
-std::array<float,2>{0.291776627f, 0.781854749f},
-std::array<float,2>{0.141054437f, 0.491951495f},
-std::array<float,2>{0.950520813f, 0.677605569f},
-std::array<float,2>{0.686010301f, 0.403353482f},
-std::array<float,2>{0.404154986f, 0.737072229f},
-std::array<float,2>{0.118222483f, 0.222161308f},
-std::array<float,2>{0.796316206f, 0.836689949f},
-std::array<float,2>{0.928208351f, 0.102261141f},
-std::array<float,2>{0.211347625f, 0.955651581f},
-std::array<float,2>{0.357791603f, 0.331505626f},
-std::array<float,2>{0.55419606f, 0.565005302f},
-std::array<float,2>{0.811894655f, 0.418347538f},
-std::array<float,2>{0.0955070332f, 0.709372461f},
-std::array<float,2>{0.375970274f, 0.211566418f},
-std::array<float,2>{0.658333302f, 0.864496648f},
-std::array<float,2>{0.545352042f, 0.077516973f},
-std::array<float,2>{0.363686562f, 0.98046869f},
-std::array<float,2>{0.198278129f, 0.374767661f},
-std::array<float,2>{0.906712353f, 0.596084177f},
-std::array<float,2>{0.726578534f, 0.257601082f},
-std::array<float,2>{0.467464536f, 0.557423711f},
-std::array<float,2>{0.0160995089f, 0.00479507586f},
-std::array<float,2>{0.850812972f, 0.899247885f},
-std::array<float,2>{0.96233952f, 0.171841756f},
-std::array<float,2>{0.12772195f, 0.754795134f},
-std::array<float,2>{0.309288234f, 0.4503088f},
-std::array<float,2>{0.580161273f, 0.644106448f},
-std::array<float,2>{0.883959949f, 0.314399838f},
-std::array<float,2>{0.244294509f, 0.580147326f},
-std::array<float,2>{0.331293494f, 0.122500956f},
-std::array<float,2>{0.503397763f, 0.941410899f},
-std::array<float,2>{0.631792009f, 0.246522263f},
-std::array<float,2>{0.429452926f, 0.819329977f},
-std::array<float,2>{0.0920574069f, 0.386298597f},
-std::array<float,2>{0.767264605f, 0.727440238f},
-std::array<float,2>{0.594032764f, 0.47838366f},
-std::array<float,2>{0.250656843f, 0.671864152f},
-std::array<float,2>{0.166405618f, 0.133152783f},
-std::array<float,2>{0.979958296f, 0.803038538f},
-std::array<float,2>{0.828006923f, 0.0347599611f},
-std::array<float,2>{0.0542826243f, 0.937369525f},
-std::array<float,2>{0.488126725f, 0.283988535f},
-std::array<float,2>{0.705172896f, 0.523397744f},
-std::array<float,2>{0.914940059f, 0.375755668f},
-std::array<float,2>{0.190328047f, 0.722608566f},
-std::array<float,2>{0.369312406f, 0.241659015f},
-std::array<float,2>{0.537472785f, 0.823965967f},
-std::array<float,2>{0.669706166f, 0.111408196f},
-std::array<float,2>{0.384252936f, 0.95146811f},
-std::array<float,2>{0.108253151f, 0.32344237f},
-std::array<float,2>{0.802537739f, 0.593076587f},
-std::array<float,2>{0.593550563f, 0.296113282f},
-std::array<float,2>{0.298211396f, 0.528320789f},
-std::array<float,2>{0.136480689f, 0.0410142578f},
-std::array<float,2>{0.954607666f, 0.924645424f},
-std::array<float,2>{0.856823921f, 0.127783895f},
-std::array<float,2>{0.0250244513f, 0.804818213f},
-std::array<float,2>{0.455069453f, 0.471181154f},
-std::array<float,2>{0.722603321f, 0.660470128f},
-std::array<float,2>{0.77854228f, 0.364604324f},
-std::array<float,2>{0.0797832534f, 0.605411053f},
-std::array<float,2>{0.432744294f, 0.0654694661f},
-std::array<float,2>{0.636794686f, 0.969239593f},
-std::array<float,2>{0.510435402f, 0.207637578f},
-std::array<float,2>{0.341883391f, 0.873083353f},
-std::array<float,2>{0.237813532f, 0.407394797f},
-std::array<float,2>{0.881622374f, 0.712828934f},
-std::array<float,2>{0.717807114f, 0.444550067f},
-std::array<float,2>{0.498362631f, 0.654710472f},
-std::array<float,2>{0.0611069947f, 0.159428343f},
-std::array<float,2>{0.81825918f, 0.7581411f},
-std::array<float,2>{0.96920085f, 0.0136637241f},
-std::array<float,2>{0.157525837f, 0.892190814f},
-std::array<float,2>{0.259426713f, 0.259068459f},
-std::array<float,2>{0.60540539f, 0.553637862f},
-std::array<float,2>{0.836741626f, 0.499223351f},
-std::array<float,2>{0.0451267958f, 0.685353577f},
-std::array<float,2>{0.469287902f, 0.152496964f},
-std::array<float,2>{0.698493779f, 0.789908767f},
-std::array<float,2>{0.616177082f, 0.0560338348f},
-std::array<float,2>{0.274386734f, 0.907937407f},
-std::array<float,2>{0.175678715f, 0.30214572f},
-std::array<float,2>{0.988442659f, 0.501800597f},
-std::array<float,2>{0.653177202f, 0.336871296f},
-std::array<float,2>{0.407061845f, 0.573049426f},
-std::array<float,2>{0.0639727339f, 0.0941241607f},
-std::array<float,2>{0.756855726f, 0.962592065f},
-std::array<float,2>{0.897579551f, 0.233392537f},
-std::array<float,2>{0.224014431f, 0.835354745f},
-std::array<float,2>{0.319059461f, 0.393213689f},
-std::array<float,2>{0.524844944f, 0.743419707f},
-std::array<float,2>{0.940484583f, 0.270847976f},
-std::array<float,2>{0.150633737f, 0.545851529f},
-std::array<float,2>{0.285241246f, 0.0227994826f},
-std::array<float,2>{0.564790666f, 0.88597554f},
-std::array<float,2>{0.73874414f, 0.182056934f},
-std::array<float,2>{0.440162838f, 0.772699475f},
-std::array<float,2>{0.00972876418f, 0.459569812f},
-std::array<float,2>{0.869541466f, 0.634076715f},
-std::array<float,2>{0.558022499f, 0.431555539f},
-std::array<float,2>{0.345600963f, 0.699400008f},
-std::array<float,2>{0.203637213f, 0.197692499f},
-std::array<float,2>{0.936969459f, 0.857524693f},
-std::array<float,2>{0.787284195f, 0.0905537531f},
-std::array<float,2>{0.116433203f, 0.991475165f},
-std::array<float,2>{0.392442554f, 0.355456501f},
-std::array<float,2>{0.677010715f, 0.614776373f},
-std::array<float,2>{0.960847139f, 0.425431043f},
-std::array<float,2>{0.13779895f, 0.68819046f},
-std::array<float,2>{0.303130329f, 0.189466879f},
-std::array<float,2>{0.587520599f, 0.846862555f},
-std::array<float,2>{0.722665489f, 0.0842292979f},
-std::array<float,2>{0.459371686f, 0.994816661f},
-std::array<float,2>{0.0293154661f, 0.351494074f},
-std::array<float,2>{0.851661563f, 0.6209203f},
-std::array<float,2>{0.532243848f, 0.276566088f},
-std::array<float,2>{0.371370077f, 0.535745382f},
-std::array<float,2>{0.193434373f, 0.0251816083f},
-std::array<float,2>{0.919676185f, 0.882687151f},
-std::array<float,2>{0.799004316f, 0.17805618f},
-std::array<float,2>{0.105003424f, 0.779800296f},
-std::array<float,2>{0.388913095f, 0.465779632f},
-std::array<float,2>{0.666052163f, 0.626435995f},
-std::array<float,2>{0.81299454f, 0.332388163f},
-std::array<float,2>{0.0578915551f, 0.568118811f},
-std::array<float,2>{0.494682282f, 0.108022407f},
-std::array<float,2>{0.712526679f, 0.958797932f},
-std::array<float,2>{0.60756439f, 0.22336784f},
-std::array<float,2>{0.264810681f, 0.840174258f},
-std::array<float,2>{0.16403909f, 0.400410265f},
-std::array<float,2>{0.974456847f, 0.740470111f},
-std::array<float,2>{0.634865761f, 0.487243414f},
-std::array<float,2>{0.436334491f, 0.671917021f},
-std::array<float,2>{0.0847879648f, 0.140988395f},
-std::array<float,2>{0.775769114f, 0.787690759f},
-std::array<float,2>{0.877191544f, 0.0541234389f},
-std::array<float,2>{0.241117388f, 0.915627122f},
-std::array<float,2>{0.338221222f, 0.304923296f},
-std::array<float,2>{0.51279819f, 0.51248318f},
-std::array<float,2>{0.752419293f, 0.447330117f},
-std::array<float,2>{0.0678004771f, 0.644658923f},
-std::array<float,2>{0.410763055f, 0.165719107f},
-std::array<float,2>{0.650357544f, 0.753837228f},
-std::array<float,2>{0.527570426f, 0.00368226948f},
-std::array<float,2>{0.312760025f, 0.903174937f},
-std::array<float,2>{0.220379502f, 0.251298249f},
-std::array<float,2>{0.892597079f, 0.561869979f},
-std::array<float,2>{0.700550616f, 0.36992836f},
-std::array<float,2>{0.476264149f, 0.599146307f},
-std::array<float,2>{0.0422153175f, 0.0733065754f},
-std::array<float,2>{0.842633367f, 0.981003106f},
-std::array<float,2>{0.985207081f, 0.216831103f},
-std::array<float,2>{0.177072659f, 0.859433293f},
-std::array<float,2>{0.277757436f, 0.417039812f},
-std::array<float,2>{0.610134602f, 0.703279257f},
-std::array<float,2>{0.930846632f, 0.288190395f},
-std::array<float,2>{0.210532799f, 0.517380059f},
-std::array<float,2>{0.350309581f, 0.0366384871f},
-std::array<float,2>{0.560857773f, 0.929857969f},
-std::array<float,2>{0.674028933f, 0.137429625f},
-std::array<float,2>{0.398314923f, 0.796968341f},
-std::array<float,2>{0.110331632f, 0.482504994f},
-std::array<float,2>{0.783852577f, 0.667361498f},
-std::array<float,2>{0.570116758f, 0.388322651f},
-std::array<float,2>{0.284243882f, 0.733392417f},
-std::array<float,2>{0.153914735f, 0.242414206f},
-std::array<float,2>{0.942997217f, 0.815659165f},
-std::array<float,2>{0.873297095f, 0.119058326f},
-std::array<float,2>{0.014116005f, 0.939675927f},
-std::array<float,2>{0.442843527f, 0.318194419f},
-std::array<float,2>{0.736373544f, 0.582203388f},
-std::array<float,2>{0.898661613f, 0.4745875f},
-std::array<float,2>{0.227344006f, 0.657515049f},
-std::array<float,2>{0.323023975f, 0.129290774f},
-std::array<float,2>{0.517185092f, 0.811707437f},
-std::array<float,2>{0.6440292f, 0.0447490029f},
-std::array<float,2>{0.417361706f, 0.926196933f},
-std::array<float,2>{0.0728741661f, 0.292489082f},
-std::array<float,2>{0.761464179f, 0.525619626f},
-std::array<float,2>{0.617560208f, 0.328079671f},
-std::array<float,2>{0.272264481f, 0.589552701f},
-std::array<float,2>{0.186061338f, 0.116988942f},
-std::array<float,2>{0.999698937f, 0.947728693f},
-std::array<float,2>{0.831272304f, 0.238064706f},
-std::array<float,2>{0.0370627306f, 0.825784683f},
-std::array<float,2>{0.484317571f, 0.380275786f},
-std::array<float,2>{0.692059994f, 0.72586453f},
-std::array<float,2>{0.789263844f, 0.265494138f},
-std::array<float,2>{0.121249087f, 0.548999608f},
-std::array<float,2>{0.401211649f, 0.00846541207f},
-std::array<float,2>{0.68034929f, 0.896412253f},
-std::array<float,2>{0.549432695f, 0.160846606f},
-std::array<float,2>{0.352620989f, 0.764910877f},
-std::array<float,2>{0.218405366f, 0.438225597f},
-std::array<float,2>{0.924078584f, 0.648887515f},
-std::array<float,2>{0.74672848f, 0.413398564f},
-std::array<float,2>{0.446405262f, 0.717200458f},
-std::array<float,2>{0.00762016419f, 0.204950586f},
-std::array<float,2>{0.859811664f, 0.867526591f},
-std::array<float,2>{0.948680341f, 0.0672476217f},
-std::array<float,2>{0.145058453f, 0.973638117f},
-std::array<float,2>{0.294287503f, 0.361750454f},
-std::array<float,2>{0.570950806f, 0.60805589f},
-std::array<float,2>{0.847085297f, 0.397249848f},
-std::array<float,2>{0.0216418356f, 0.748797178f},
-std::array<float,2>{0.461922973f, 0.23009339f},
-std::array<float,2>{0.732629597f, 0.830736041f},
-std::array<float,2>{0.58371079f, 0.0985945612f},
-std::array<float,2>{0.307921231f, 0.966159582f},
-std::array<float,2>{0.131268635f, 0.340144187f},
-std::array<float,2>{0.968738496f, 0.575652063f},
-std::array<float,2>{0.663389266f, 0.299388647f},
-std::array<float,2>{0.378982097f, 0.505723834f},
-std::array<float,2>{0.100847393f, 0.0612034015f},
-std::array<float,2>{0.805186749f, 0.91315037f},
-std::array<float,2>{0.912730992f, 0.149970233f},
-std::array<float,2>{0.203064159f, 0.795219183f},
-std::array<float,2>{0.361765444f, 0.493308097f},
-std::array<float,2>{0.54093498f, 0.681883752f},
-std::array<float,2>{0.982826233f, 0.355614156f},
-std::array<float,2>{0.171733618f, 0.612540901f},
-std::array<float,2>{0.254453897f, 0.0891034082f},
-std::array<float,2>{0.599543393f, 0.987579644f},
-std::array<float,2>{0.710036337f, 0.201409295f},
-std::array<float,2>{0.489219308f, 0.852901161f},
-std::array<float,2>{0.0480796807f, 0.437104106f},
-std::array<float,2>{0.821594298f, 0.695528567f},
-std::array<float,2>{0.505281746f, 0.455747068f},
-std::array<float,2>{0.333466351f, 0.639995933f},
-std::array<float,2>{0.247772291f, 0.184942156f},
-std::array<float,2>{0.890355706f, 0.76754576f},
-std::array<float,2>{0.772415876f, 0.0174168553f},
-std::array<float,2>{0.0871859416f, 0.889552355f},
-std::array<float,2>{0.422756672f, 0.267869055f},
-std::array<float,2>{0.627592623f, 0.541528463f},
-std::array<float,2>{0.95252794f, 0.489970386f},
-std::array<float,2>{0.144052267f, 0.678289711f},
-std::array<float,2>{0.29058969f, 0.148142681f},
-std::array<float,2>{0.575719535f, 0.784231246f},
-std::array<float,2>{0.743449926f, 0.0504191518f},
-std::array<float,2>{0.449963093f, 0.918254435f},
-std::array<float,2>{0.000825510535f, 0.310774595f},
-std::array<float,2>{0.864651382f, 0.507961571f},
-std::array<float,2>{0.551436365f, 0.32857877f},
-std::array<float,2>{0.357087106f, 0.564061046f},
-std::array<float,2>{0.214210749f, 0.10375917f},
-std::array<float,2>{0.925949812f, 0.953450441f},
-std::array<float,2>{0.79412365f, 0.220040396f},
-std::array<float,2>{0.119813643f, 0.838715374f},
-std::array<float,2>{0.404901624f, 0.404450893f},
-std::array<float,2>{0.68535018f, 0.735608816f},
-std::array<float,2>{0.833379269f, 0.280585557f},
-std::array<float,2>{0.0321535766f, 0.531281948f},
-std::array<float,2>{0.478765428f, 0.0310569424f},
-std::array<float,2>{0.691176236f, 0.875048101f},
-std::array<float,2>{0.62358886f, 0.175652519f},
-std::array<float,2>{0.268135786f, 0.776860178f},
-std::array<float,2>{0.180500031f, 0.461253405f},
-std::array<float,2>{0.99289161f, 0.630006254f},
-std::array<float,2>{0.645665348f, 0.427550942f},
-std::array<float,2>{0.420268655f, 0.692923784f},
-std::array<float,2>{0.0765611008f, 0.195180774f},
-std::array<float,2>{0.764600754f, 0.851199269f},
-std::array<float,2>{0.904208064f, 0.0816529244f},
-std::array<float,2>{0.231828019f, 0.996128559f},
-std::array<float,2>{0.327835411f, 0.343904525f},
-std::array<float,2>{0.52304101f, 0.62441206f},
-std::array<float,2>{0.768222094f, 0.384711474f},
-std::array<float,2>{0.0906285569f, 0.729782462f},
-std::array<float,2>{0.427509278f, 0.249771863f},
-std::array<float,2>{0.62969476f, 0.818106353f},
-std::array<float,2>{0.501834512f, 0.123524323f},
-std::array<float,2>{0.328418493f, 0.944853485f},
-std::array<float,2>{0.242534429f, 0.316032708f},
-std::array<float,2>{0.885855258f, 0.578133941f},
-std::array<float,2>{0.704785168f, 0.281885177f},
-std::array<float,2>{0.485897541f, 0.519573689f},
-std::array<float,2>{0.0518804789f, 0.0322234631f},
-std::array<float,2>{0.825010061f, 0.935330033f},
-std::array<float,2>{0.9774158f, 0.13577643f},
-std::array<float,2>{0.164117321f, 0.802536905f},
-std::array<float,2>{0.252974302f, 0.478613019f},
-std::array<float,2>{0.597575665f, 0.669457674f},
-std::array<float,2>{0.908872068f, 0.371263564f},
-std::array<float,2>{0.196276754f, 0.595420957f},
-std::array<float,2>{0.365545124f, 0.0751736984f},
-std::array<float,2>{0.544217944f, 0.977064312f},
-std::array<float,2>{0.657492816f, 0.213355005f},
-std::array<float,2>{0.377516717f, 0.866955638f},
-std::array<float,2>{0.0973053798f, 0.420483291f},
-std::array<float,2>{0.808934748f, 0.707229495f},
-std::array<float,2>{0.578778267f, 0.452620089f},
-std::array<float,2>{0.31149298f, 0.641806364f},
-std::array<float,2>{0.125609502f, 0.169555932f},
-std::array<float,2>{0.963989019f, 0.757776201f},
-std::array<float,2>{0.849592686f, 0.00648358325f},
-std::array<float,2>{0.0189372282f, 0.901589751f},
-std::array<float,2>{0.465902328f, 0.254105866f},
-std::array<float,2>{0.730222762f, 0.554965556f},
-std::array<float,2>{0.88054508f, 0.409473538f},
-std::array<float,2>{0.235525399f, 0.714487672f},
-std::array<float,2>{0.341364473f, 0.210900575f},
-std::array<float,2>{0.508281767f, 0.871920645f},
-std::array<float,2>{0.639109194f, 0.062550731f},
-std::array<float,2>{0.431377023f, 0.971808672f},
-std::array<float,2>{0.0817547441f, 0.366235852f},
-std::array<float,2>{0.779853821f, 0.603161752f},
-std::array<float,2>{0.602086842f, 0.261404783f},
-std::array<float,2>{0.2613585f, 0.552549601f},
-std::array<float,2>{0.158825681f, 0.0149700884f},
-std::array<float,2>{0.972578824f, 0.893606305f},
-std::array<float,2>{0.820077717f, 0.157640651f},
-std::array<float,2>{0.0588730611f, 0.761146605f},
-std::array<float,2>{0.497474223f, 0.442030847f},
-std::array<float,2>{0.716336012f, 0.652516425f},
-std::array<float,2>{0.802830815f, 0.321620107f},
-std::array<float,2>{0.106847793f, 0.591033459f},
-std::array<float,2>{0.384869128f, 0.11111778f},
-std::array<float,2>{0.670479f, 0.949547052f},
-std::array<float,2>{0.536813676f, 0.238522172f},
-std::array<float,2>{0.367472619f, 0.82148087f},
-std::array<float,2>{0.187550291f, 0.377134204f},
-std::array<float,2>{0.916158915f, 0.719080806f},
-std::array<float,2>{0.719345033f, 0.469206005f},
-std::array<float,2>{0.455616504f, 0.663344145f},
-std::array<float,2>{0.0264004059f, 0.126839697f},
-std::array<float,2>{0.859257996f, 0.807788908f},
-std::array<float,2>{0.955734074f, 0.0426101983f},
-std::array<float,2>{0.132838905f, 0.922266006f},
-std::array<float,2>{0.299677759f, 0.294613242f},
-std::array<float,2>{0.590773106f, 0.529389799f},
-std::array<float,2>{0.868641436f, 0.45756495f},
-std::array<float,2>{0.0107781943f, 0.635643065f},
-std::array<float,2>{0.439327389f, 0.180389896f},
-std::array<float,2>{0.740708709f, 0.770354211f},
-std::array<float,2>{0.563503683f, 0.0211304072f},
-std::array<float,2>{0.28862378f, 0.88438338f},
-std::array<float,2>{0.150119454f, 0.272716373f},
-std::array<float,2>{0.938577116f, 0.543721974f},
-std::array<float,2>{0.678649366f, 0.35288623f},
-std::array<float,2>{0.393384337f, 0.616477847f},
-std::array<float,2>{0.113826007f, 0.0919708833f},
-std::array<float,2>{0.786021173f, 0.990011215f},
-std::array<float,2>{0.935186505f, 0.195789143f},
-std::array<float,2>{0.206586629f, 0.857330263f},
-std::array<float,2>{0.346946597f, 0.433057308f},
-std::array<float,2>{0.555892169f, 0.701402545f},
-std::array<float,2>{0.99056375f, 0.303208947f},
-std::array<float,2>{0.173629478f, 0.503265977f},
-std::array<float,2>{0.27552554f, 0.0577834584f},
-std::array<float,2>{0.613602221f, 0.90966928f},
-std::array<float,2>{0.695993066f, 0.155804992f},
-std::array<float,2>{0.471866697f, 0.7928859f},
-std::array<float,2>{0.044833608f, 0.497552067f},
-std::array<float,2>{0.838593245f, 0.685715914f},
-std::array<float,2>{0.52656281f, 0.391842544f},
-std::array<float,2>{0.316720307f, 0.745188475f},
-std::array<float,2>{0.225892112f, 0.23138617f},
-std::array<float,2>{0.895415306f, 0.833542585f},
-std::array<float,2>{0.755503058f, 0.0973094925f},
-std::array<float,2>{0.0655707642f, 0.963629782f},
-std::array<float,2>{0.409645736f, 0.33818534f},
-std::array<float,2>{0.65597111f, 0.572233677f},
-std::array<float,2>{0.975597978f, 0.398857266f},
-std::array<float,2>{0.161588266f, 0.739519f},
-std::array<float,2>{0.262307614f, 0.22623463f},
-std::array<float,2>{0.605481744f, 0.843731999f},
-std::array<float,2>{0.71381104f, 0.105980955f},
-std::array<float,2>{0.492291033f, 0.959909439f},
-std::array<float,2>{0.0555129051f, 0.334743589f},
-std::array<float,2>{0.815346777f, 0.569630623f},
-std::array<float,2>{0.515610754f, 0.307571203f},
-std::array<float,2>{0.336653978f, 0.513851106f},
-std::array<float,2>{0.239701658f, 0.0519897975f},
-std::array<float,2>{0.876614273f, 0.9165501f},
-std::array<float,2>{0.775076151f, 0.143957064f},
-std::array<float,2>{0.0828911662f, 0.785800159f},
-std::array<float,2>{0.435050786f, 0.48588261f},
-std::array<float,2>{0.63414675f, 0.674898207f},
-std::array<float,2>{0.85425204f, 0.348528892f},
-std::array<float,2>{0.0275251176f, 0.617283285f},
-std::array<float,2>{0.458327383f, 0.0823076367f},
-std::array<float,2>{0.725299358f, 0.992579162f},
-std::array<float,2>{0.589099824f, 0.189084336f},
-std::array<float,2>{0.30261299f, 0.845647812f},
-std::array<float,2>{0.138983399f, 0.423080742f},
-std::array<float,2>{0.958498001f, 0.691356122f},
-std::array<float,2>{0.664959848f, 0.468078375f},
-std::array<float,2>{0.386914372f, 0.627239168f},
-std::array<float,2>{0.103325695f, 0.177286595f},
-std::array<float,2>{0.797926784f, 0.778192818f},
-std::array<float,2>{0.920219958f, 0.0258967541f},
-std::array<float,2>{0.191518113f, 0.879618287f},
-std::array<float,2>{0.373878241f, 0.274878949f},
-std::array<float,2>{0.533743322f, 0.537934601f},
-std::array<float,2>{0.781890094f, 0.482327878f},
-std::array<float,2>{0.111777849f, 0.664858758f},
-std::array<float,2>{0.396307319f, 0.140415147f},
-std::array<float,2>{0.672316313f, 0.799351573f},
-std::array<float,2>{0.558982372f, 0.0379796289f},
-std::array<float,2>{0.349006593f, 0.931897283f},
-std::array<float,2>{0.208086088f, 0.286081702f},
-std::array<float,2>{0.931721866f, 0.518662035f},
-std::array<float,2>{0.735897124f, 0.319008112f},
-std::array<float,2>{0.444017351f, 0.585453629f},
-std::array<float,2>{0.012367757f, 0.120739445f},
-std::array<float,2>{0.871355116f, 0.939176261f},
-std::array<float,2>{0.94484812f, 0.244989127f},
-std::array<float,2>{0.155016989f, 0.812533796f},
-std::array<float,2>{0.281995833f, 0.390100211f},
-std::array<float,2>{0.56681186f, 0.732055306f},
-std::array<float,2>{0.891936481f, 0.251985192f},
-std::array<float,2>{0.220823199f, 0.560224473f},
-std::array<float,2>{0.314650118f, 9.89724722e-05f},
-std::array<float,2>{0.5311414f, 0.904563427f},
-std::array<float,2>{0.650645196f, 0.16744633f},
-std::array<float,2>{0.413063437f, 0.751472116f},
-std::array<float,2>{0.0696412846f, 0.446382374f},
-std::array<float,2>{0.750405669f, 0.647693396f},
-std::array<float,2>{0.611668408f, 0.414527178f},
-std::array<float,2>{0.281026185f, 0.706884682f},
-std::array<float,2>{0.179497242f, 0.215139717f},
-std::array<float,2>{0.987755179f, 0.861765206f},
-std::array<float,2>{0.840388417f, 0.0712997913f},
-std::array<float,2>{0.040433351f, 0.982626736f},
-std::array<float,2>{0.474273175f, 0.3671875f},
-std::array<float,2>{0.702905893f, 0.601108134f},
-std::array<float,2>{0.921946585f, 0.440520346f},
-std::array<float,2>{0.215574548f, 0.650482357f},
-std::array<float,2>{0.353847265f, 0.162726507f},
-std::array<float,2>{0.547704995f, 0.762793958f},
-std::array<float,2>{0.681931734f, 0.0106339501f},
-std::array<float,2>{0.398575515f, 0.897400796f},
-std::array<float,2>{0.123786077f, 0.262677759f},
-std::array<float,2>{0.791747212f, 0.54715395f},
-std::array<float,2>{0.573191226f, 0.359606534f},
-std::array<float,2>{0.295089811f, 0.606483936f},
-std::array<float,2>{0.147547677f, 0.06972114f},
-std::array<float,2>{0.946752906f, 0.975996554f},
-std::array<float,2>{0.861863792f, 0.205898464f},
-std::array<float,2>{0.00459981477f, 0.871001303f},
-std::array<float,2>{0.448501498f, 0.410308987f},
-std::array<float,2>{0.749201894f, 0.71539104f},
-std::array<float,2>{0.759088933f, 0.29078123f},
-std::array<float,2>{0.0713240504f, 0.525183678f},
-std::array<float,2>{0.414228082f, 0.045891095f},
-std::array<float,2>{0.64102006f, 0.929078698f},
-std::array<float,2>{0.519387305f, 0.132352397f},
-std::array<float,2>{0.321269631f, 0.80910188f},
-std::array<float,2>{0.230012953f, 0.474768162f},
-std::array<float,2>{0.901608706f, 0.659470201f},
-std::array<float,2>{0.693396509f, 0.381406248f},
-std::array<float,2>{0.481143296f, 0.723383129f},
-std::array<float,2>{0.0384672359f, 0.23580651f},
-std::array<float,2>{0.828360021f, 0.826461196f},
-std::array<float,2>{0.997099638f, 0.114477381f},
-std::array<float,2>{0.184512898f, 0.945994437f},
-std::array<float,2>{0.270606935f, 0.324556798f},
-std::array<float,2>{0.619362116f, 0.586506665f},
-std::array<float,2>{0.824174881f, 0.434446305f},
-std::array<float,2>{0.0494752042f, 0.697610795f},
-std::array<float,2>{0.49134481f, 0.199632734f},
-std::array<float,2>{0.708555818f, 0.855467677f},
-std::array<float,2>{0.601059318f, 0.0859389082f},
-std::array<float,2>{0.256106555f, 0.98522228f},
-std::array<float,2>{0.169354439f, 0.358847648f},
-std::array<float,2>{0.982011616f, 0.610134721f},
-std::array<float,2>{0.626509964f, 0.265925109f},
-std::array<float,2>{0.425734162f, 0.540897071f},
-std::array<float,2>{0.0887361541f, 0.0176126603f},
-std::array<float,2>{0.771340191f, 0.886865377f},
-std::array<float,2>{0.887289107f, 0.186485782f},
-std::array<float,2>{0.248094365f, 0.768332243f},
-std::array<float,2>{0.334255695f, 0.453225881f},
-std::array<float,2>{0.507071078f, 0.637138903f},
-std::array<float,2>{0.965691209f, 0.343632519f},
-std::array<float,2>{0.130373672f, 0.576211154f},
-std::array<float,2>{0.304917961f, 0.0999602675f},
-std::array<float,2>{0.584956348f, 0.967803657f},
-std::array<float,2>{0.730927169f, 0.228092834f},
-std::array<float,2>{0.463110894f, 0.82851702f},
-std::array<float,2>{0.0208324678f, 0.396288663f},
-std::array<float,2>{0.843900383f, 0.746127605f},
-std::array<float,2>{0.54219687f, 0.494207948f},
-std::array<float,2>{0.359854341f, 0.680428684f},
-std::array<float,2>{0.201111645f, 0.150550708f},
-std::array<float,2>{0.911738575f, 0.794154644f},
-std::array<float,2>{0.807139456f, 0.0599652342f},
-std::array<float,2>{0.0987902135f, 0.910344601f},
-std::array<float,2>{0.381165206f, 0.297521979f},
-std::array<float,2>{0.66157645f, 0.506269097f},
-std::array<float,2>{0.979069114f, 0.479919344f},
-std::array<float,2>{0.16704452f, 0.668529391f},
-std::array<float,2>{0.250994086f, 0.134909764f},
-std::array<float,2>{0.595334709f, 0.801689684f},
-std::array<float,2>{0.706501544f, 0.0328280404f},
-std::array<float,2>{0.487088919f, 0.933964193f},
-std::array<float,2>{0.0534285232f, 0.282551974f},
-std::array<float,2>{0.827110589f, 0.521304965f},
-std::array<float,2>{0.502597988f, 0.314565837f},
-std::array<float,2>{0.33065179f, 0.579878569f},
-std::array<float,2>{0.245369971f, 0.124868132f},
-std::array<float,2>{0.883787036f, 0.94363749f},
-std::array<float,2>{0.765991151f, 0.248810977f},
-std::array<float,2>{0.093331404f, 0.817309558f},
-std::array<float,2>{0.428671658f, 0.383498818f},
-std::array<float,2>{0.632450581f, 0.729432523f},
-std::array<float,2>{0.850148976f, 0.255712986f},
-std::array<float,2>{0.0167501271f, 0.555846334f},
-std::array<float,2>{0.467997819f, 0.0074743554f},
-std::array<float,2>{0.727562189f, 0.900872171f},
-std::array<float,2>{0.581783712f, 0.16828531f},
-std::array<float,2>{0.310165465f, 0.756124377f},
-std::array<float,2>{0.128254279f, 0.451568007f},
-std::array<float,2>{0.961299539f, 0.640718937f},
-std::array<float,2>{0.659669876f, 0.421608597f},
-std::array<float,2>{0.376415551f, 0.70857358f},
-std::array<float,2>{0.0940658823f, 0.214820221f},
-std::array<float,2>{0.811126232f, 0.865586698f},
-std::array<float,2>{0.907526255f, 0.07558202f},
-std::array<float,2>{0.198106557f, 0.978123069f},
-std::array<float,2>{0.364981681f, 0.372712553f},
-std::array<float,2>{0.546361983f, 0.594475985f},
-std::array<float,2>{0.795876563f, 0.406207949f},
-std::array<float,2>{0.118041426f, 0.735027015f},
-std::array<float,2>{0.402599633f, 0.219484821f},
-std::array<float,2>{0.686829627f, 0.839399695f},
-std::array<float,2>{0.553698003f, 0.104824983f},
-std::array<float,2>{0.358949214f, 0.954270542f},
-std::array<float,2>{0.212064847f, 0.329147309f},
-std::array<float,2>{0.929183364f, 0.56278789f},
-std::array<float,2>{0.745185316f, 0.311858207f},
-std::array<float,2>{0.452051371f, 0.508823276f},
-std::array<float,2>{0.00279658567f, 0.049476631f},
-std::array<float,2>{0.866544604f, 0.919713914f},
-std::array<float,2>{0.949623764f, 0.147420838f},
-std::array<float,2>{0.14233911f, 0.783285856f},
-std::array<float,2>{0.292606682f, 0.488375247f},
-std::array<float,2>{0.577655256f, 0.679494739f},
-std::array<float,2>{0.904750586f, 0.344780296f},
-std::array<float,2>{0.233682886f, 0.623137712f},
-std::array<float,2>{0.326050401f, 0.080463171f},
-std::array<float,2>{0.519574285f, 0.997770965f},
-std::array<float,2>{0.646972954f, 0.193544388f},
-std::array<float,2>{0.418536276f, 0.849747896f},
-std::array<float,2>{0.0756995976f, 0.426293463f},
-std::array<float,2>{0.763006985f, 0.691737771f},
-std::array<float,2>{0.622697532f, 0.462734222f},
-std::array<float,2>{0.26733005f, 0.629200935f},
-std::array<float,2>{0.183204904f, 0.173852757f},
-std::array<float,2>{0.99527508f, 0.776337266f},
-std::array<float,2>{0.835161984f, 0.0297112428f},
-std::array<float,2>{0.0336959288f, 0.876408696f},
-std::array<float,2>{0.477276742f, 0.280264616f},
-std::array<float,2>{0.688930035f, 0.532433212f},
-std::array<float,2>{0.935621321f, 0.431744605f},
-std::array<float,2>{0.204729483f, 0.702495754f},
-std::array<float,2>{0.344310701f, 0.196300194f},
-std::array<float,2>{0.557479084f, 0.855556905f},
-std::array<float,2>{0.676338792f, 0.0933791474f},
-std::array<float,2>{0.390897572f, 0.988941371f},
-std::array<float,2>{0.115714446f, 0.352529705f},
-std::array<float,2>{0.788329422f, 0.615660608f},
-std::array<float,2>{0.566287577f, 0.271608055f},
-std::array<float,2>{0.286148608f, 0.544383764f},
-std::array<float,2>{0.15178062f, 0.0198562499f},
-std::array<float,2>{0.939596355f, 0.883627594f},
-std::array<float,2>{0.870697379f, 0.180924118f},
-std::array<float,2>{0.00866561569f, 0.771021783f},
-std::array<float,2>{0.44076395f, 0.458342552f},
-std::array<float,2>{0.739423037f, 0.63627404f},
-std::array<float,2>{0.755991638f, 0.339330643f},
-std::array<float,2>{0.0629198551f, 0.570906937f},
-std::array<float,2>{0.407769233f, 0.0966284275f},
-std::array<float,2>{0.65429616f, 0.964032412f},
-std::array<float,2>{0.524257123f, 0.231961295f},
-std::array<float,2>{0.319476455f, 0.83246696f},
-std::array<float,2>{0.22360374f, 0.391061008f},
-std::array<float,2>{0.896515608f, 0.744867802f},
-std::array<float,2>{0.697589219f, 0.496564806f},
-std::array<float,2>{0.470320255f, 0.686800718f},
-std::array<float,2>{0.046441406f, 0.154387578f},
-std::array<float,2>{0.837659299f, 0.791015804f},
-std::array<float,2>{0.98987484f, 0.0568342023f},
-std::array<float,2>{0.174548849f, 0.908232868f},
-std::array<float,2>{0.274428129f, 0.304126769f},
-std::array<float,2>{0.616230667f, 0.502101719f},
-std::array<float,2>{0.816482902f, 0.443324059f},
-std::array<float,2>{0.0619080849f, 0.653779626f},
-std::array<float,2>{0.49928686f, 0.156726524f},
-std::array<float,2>{0.717027009f, 0.760491729f},
-std::array<float,2>{0.604299188f, 0.0145342201f},
-std::array<float,2>{0.258687466f, 0.893035531f},
-std::array<float,2>{0.156812653f, 0.259896964f},
-std::array<float,2>{0.970141888f, 0.551173389f},
-std::array<float,2>{0.638332844f, 0.365619928f},
-std::array<float,2>{0.432594061f, 0.602228403f},
-std::array<float,2>{0.0786837935f, 0.0641122237f},
-std::array<float,2>{0.77815944f, 0.971409678f},
-std::array<float,2>{0.882801473f, 0.209390029f},
-std::array<float,2>{0.23705481f, 0.872600853f},
-std::array<float,2>{0.342979699f, 0.408608556f},
-std::array<float,2>{0.511011899f, 0.712981284f},
-std::array<float,2>{0.953836083f, 0.293548316f},
-std::array<float,2>{0.134831473f, 0.530523717f},
-std::array<float,2>{0.297505915f, 0.0419779159f},
-std::array<float,2>{0.59238261f, 0.922942996f},
-std::array<float,2>{0.721342504f, 0.12593776f},
-std::array<float,2>{0.453627139f, 0.807067633f},
-std::array<float,2>{0.0241639167f, 0.470259607f},
-std::array<float,2>{0.85606879f, 0.662763834f},
-std::array<float,2>{0.53879559f, 0.378884673f},
-std::array<float,2>{0.370156765f, 0.71997577f},
-std::array<float,2>{0.191367999f, 0.240027294f},
-std::array<float,2>{0.915129364f, 0.820634604f},
-std::array<float,2>{0.800965726f, 0.109942727f},
-std::array<float,2>{0.109066315f, 0.951161981f},
-std::array<float,2>{0.383283317f, 0.321286887f},
-std::array<float,2>{0.668052316f, 0.590195715f},
-std::array<float,2>{0.941501677f, 0.38915363f},
-std::array<float,2>{0.1529136f, 0.730768681f},
-std::array<float,2>{0.283229083f, 0.245575681f},
-std::array<float,2>{0.568363309f, 0.814060032f},
-std::array<float,2>{0.737564981f, 0.119423792f},
-std::array<float,2>{0.442355216f, 0.937943757f},
-std::array<float,2>{0.0152803445f, 0.320088506f},
-std::array<float,2>{0.874448299f, 0.584896863f},
-std::array<float,2>{0.562136114f, 0.286531091f},
-std::array<float,2>{0.351413965f, 0.517615974f},
-std::array<float,2>{0.20900394f, 0.0383833125f},
-std::array<float,2>{0.930250525f, 0.932910621f},
-std::array<float,2>{0.784451365f, 0.139504939f},
-std::array<float,2>{0.11044538f, 0.800633848f},
-std::array<float,2>{0.397448063f, 0.480641633f},
-std::array<float,2>{0.675598621f, 0.665521204f},
-std::array<float,2>{0.843601167f, 0.368549913f},
-std::array<float,2>{0.0413606465f, 0.600061119f},
-std::array<float,2>{0.47470367f, 0.0703197941f},
-std::array<float,2>{0.699575424f, 0.98425293f},
-std::array<float,2>{0.610712707f, 0.216180399f},
-std::array<float,2>{0.279293239f, 0.862719417f},
-std::array<float,2>{0.175910547f, 0.415657163f},
-std::array<float,2>{0.985848784f, 0.705532551f},
-std::array<float,2>{0.648551524f, 0.445551962f},
-std::array<float,2>{0.411169857f, 0.646921515f},
-std::array<float,2>{0.0668513626f, 0.166349366f},
-std::array<float,2>{0.753299177f, 0.750748873f},
-std::array<float,2>{0.893591106f, 0.00164453802f},
-std::array<float,2>{0.219110802f, 0.905983746f},
-std::array<float,2>{0.31378898f, 0.253036946f},
-std::array<float,2>{0.528363764f, 0.559056163f},
-std::array<float,2>{0.776674867f, 0.48473528f},
-std::array<float,2>{0.0856534168f, 0.674468458f},
-std::array<float,2>{0.436982632f, 0.143122971f},
-std::array<float,2>{0.635849237f, 0.786355078f},
-std::array<float,2>{0.512187958f, 0.0513409227f},
-std::array<float,2>{0.339081019f, 0.91776371f},
-std::array<float,2>{0.241682023f, 0.307945102f},
-std::array<float,2>{0.878118336f, 0.515507519f},
-std::array<float,2>{0.711881995f, 0.335606128f},
-std::array<float,2>{0.49533084f, 0.568727672f},
-std::array<float,2>{0.0568870567f, 0.106501669f},
-std::array<float,2>{0.81417048f, 0.960150361f},
-std::array<float,2>{0.973344922f, 0.225368857f},
-std::array<float,2>{0.162476137f, 0.842666209f},
-std::array<float,2>{0.263998032f, 0.399853557f},
-std::array<float,2>{0.608587146f, 0.738703728f},
-std::array<float,2>{0.918252885f, 0.274110645f},
-std::array<float,2>{0.194469139f, 0.53821373f},
-std::array<float,2>{0.373006672f, 0.0272520073f},
-std::array<float,2>{0.531776547f, 0.880731761f},
-std::array<float,2>{0.667207122f, 0.176608145f},
-std::array<float,2>{0.390521646f, 0.779172897f},
-std::array<float,2>{0.103814982f, 0.467114925f},
-std::array<float,2>{0.800621808f, 0.628160715f},
-std::array<float,2>{0.58595854f, 0.422122657f},
-std::array<float,2>{0.304098278f, 0.689602137f},
-std::array<float,2>{0.136850163f, 0.187812537f},
-std::array<float,2>{0.959144115f, 0.844280303f},
-std::array<float,2>{0.852874219f, 0.0838652775f},
-std::array<float,2>{0.0303186066f, 0.99334687f},
-std::array<float,2>{0.460923523f, 0.348946273f},
-std::array<float,2>{0.724458575f, 0.618412077f},
-std::array<float,2>{0.888752699f, 0.454973191f},
-std::array<float,2>{0.246758327f, 0.638670444f},
-std::array<float,2>{0.332473397f, 0.186773047f},
-std::array<float,2>{0.504176319f, 0.768568873f},
-std::array<float,2>{0.628700018f, 0.0186818242f},
-std::array<float,2>{0.423321813f, 0.887760043f},
-std::array<float,2>{0.0862425566f, 0.266633809f},
-std::array<float,2>{0.772622585f, 0.539670885f},
-std::array<float,2>{0.59838289f, 0.358245462f},
-std::array<float,2>{0.255228907f, 0.61076051f},
-std::array<float,2>{0.170265108f, 0.0875568017f},
-std::array<float,2>{0.983707964f, 0.9855811f},
-std::array<float,2>{0.821015358f, 0.200379953f},
-std::array<float,2>{0.0476655923f, 0.853790104f},
-std::array<float,2>{0.489739507f, 0.435209513f},
-std::array<float,2>{0.709317088f, 0.698492169f},
-std::array<float,2>{0.806307197f, 0.29832983f},
-std::array<float,2>{0.099708952f, 0.507614732f},
-std::array<float,2>{0.380396694f, 0.0586313829f},
-std::array<float,2>{0.662940085f, 0.911226392f},
-std::array<float,2>{0.539853871f, 0.151961043f},
-std::array<float,2>{0.362669855f, 0.792997599f},
-std::array<float,2>{0.201954454f, 0.495876491f},
-std::array<float,2>{0.914022386f, 0.681420386f},
-std::array<float,2>{0.733833969f, 0.39522481f},
-std::array<float,2>{0.461489737f, 0.747272789f},
-std::array<float,2>{0.0233332552f, 0.227213383f},
-std::array<float,2>{0.846263528f, 0.829681516f},
-std::array<float,2>{0.96711129f, 0.101066284f},
-std::array<float,2>{0.131939054f, 0.967518866f},
-std::array<float,2>{0.307560503f, 0.342122585f},
-std::array<float,2>{0.582229197f, 0.577173233f},
-std::array<float,2>{0.861124933f, 0.411876917f},
-std::array<float,2>{0.00652189506f, 0.716196954f},
-std::array<float,2>{0.445899814f, 0.206330359f},
-std::array<float,2>{0.747721612f, 0.869814634f},
-std::array<float,2>{0.571557999f, 0.0685387552f},
-std::array<float,2>{0.293646783f, 0.975444376f},
-std::array<float,2>{0.146210462f, 0.360537559f},
-std::array<float,2>{0.947845817f, 0.605879903f},
-std::array<float,2>{0.68119359f, 0.262733668f},
-std::array<float,2>{0.401678681f, 0.548553467f},
-std::array<float,2>{0.122824408f, 0.0110378033f},
-std::array<float,2>{0.790161669f, 0.898422599f},
-std::array<float,2>{0.925239861f, 0.163693279f},
-std::array<float,2>{0.217246786f, 0.762527227f},
-std::array<float,2>{0.352498263f, 0.440140307f},
-std::array<float,2>{0.550265789f, 0.652286887f},
-std::array<float,2>{0.998280346f, 0.325576842f},
-std::array<float,2>{0.187158123f, 0.587335169f},
-std::array<float,2>{0.272463351f, 0.113390341f},
-std::array<float,2>{0.618795455f, 0.94711262f},
-std::array<float,2>{0.692926943f, 0.234821245f},
-std::array<float,2>{0.483377784f, 0.827952802f},
-std::array<float,2>{0.0356711149f, 0.382585526f},
-std::array<float,2>{0.830646753f, 0.72432059f},
-std::array<float,2>{0.515765429f, 0.476034552f},
-std::array<float,2>{0.323903143f, 0.658926189f},
-std::array<float,2>{0.228078708f, 0.130996808f},
-std::array<float,2>{0.899891734f, 0.809759498f},
-std::array<float,2>{0.760571361f, 0.0464036465f},
-std::array<float,2>{0.0732481629f, 0.928154409f},
-std::array<float,2>{0.416785866f, 0.289247036f},
-std::array<float,2>{0.643490016f, 0.523443401f},
-std::array<float,2>{0.963110149f, 0.449557245f},
-std::array<float,2>{0.126094893f, 0.643050909f},
-std::array<float,2>{0.312365264f, 0.170785293f},
-std::array<float,2>{0.579818785f, 0.755092382f},
-std::array<float,2>{0.728984416f, 0.00580731686f},
-std::array<float,2>{0.464915246f, 0.899832308f},
-std::array<float,2>{0.0183338616f, 0.256817281f},
-std::array<float,2>{0.847669423f, 0.558000624f},
-std::array<float,2>{0.543187499f, 0.373785168f},
-std::array<float,2>{0.366396517f, 0.597354949f},
-std::array<float,2>{0.197011963f, 0.0762273744f},
-std::array<float,2>{0.909562945f, 0.979165971f},
-std::array<float,2>{0.810473621f, 0.212599054f},
-std::array<float,2>{0.0960537717f, 0.864102066f},
-std::array<float,2>{0.378041118f, 0.418960035f},
-std::array<float,2>{0.656462729f, 0.710378647f},
-std::array<float,2>{0.825504541f, 0.285039604f},
-std::array<float,2>{0.0510382019f, 0.522270739f},
-std::array<float,2>{0.484655648f, 0.0336201973f},
-std::array<float,2>{0.703312218f, 0.936458945f},
-std::array<float,2>{0.596112728f, 0.13460508f},
-std::array<float,2>{0.25195691f, 0.804411113f},
-std::array<float,2>{0.165662438f, 0.477178574f},
-std::array<float,2>{0.977993786f, 0.670639992f},
-std::array<float,2>{0.630678415f, 0.385259479f},
-std::array<float,2>{0.426569849f, 0.727737367f},
-std::array<float,2>{0.0915677547f, 0.247194186f},
-std::array<float,2>{0.768780708f, 0.819851577f},
-std::array<float,2>{0.885029256f, 0.122060239f},
-std::array<float,2>{0.243604586f, 0.942700922f},
-std::array<float,2>{0.329735875f, 0.313348919f},
-std::array<float,2>{0.500940561f, 0.581699073f},
-std::array<float,2>{0.764655292f, 0.428418905f},
-std::array<float,2>{0.0771826729f, 0.694437146f},
-std::array<float,2>{0.421677679f, 0.191563681f},
-std::array<float,2>{0.645491183f, 0.847993731f},
-std::array<float,2>{0.521523237f, 0.0787483379f},
-std::array<float,2>{0.326481253f, 0.998807609f},
-std::array<float,2>{0.231247634f, 0.347630471f},
-std::array<float,2>{0.902541578f, 0.62187928f},
-std::array<float,2>{0.68958956f, 0.277996659f},
-std::array<float,2>{0.479524165f, 0.53447032f},
-std::array<float,2>{0.0325368866f, 0.027981203f},
-std::array<float,2>{0.832309842f, 0.877564132f},
-std::array<float,2>{0.993381858f, 0.173818082f},
-std::array<float,2>{0.181233689f, 0.774268329f},
-std::array<float,2>{0.268664837f, 0.464535505f},
-std::array<float,2>{0.624242485f, 0.631176114f},
-std::array<float,2>{0.926950514f, 0.330083966f},
-std::array<float,2>{0.213102058f, 0.565960109f},
-std::array<float,2>{0.356134236f, 0.103140473f},
-std::array<float,2>{0.55207032f, 0.956101716f},
-std::array<float,2>{0.683888257f, 0.221581355f},
-std::array<float,2>{0.405697733f, 0.837669671f},
-std::array<float,2>{0.120618813f, 0.402910531f},
-std::array<float,2>{0.793684781f, 0.737642944f},
-std::array<float,2>{0.575154543f, 0.491074443f},
-std::array<float,2>{0.289930522f, 0.676417172f},
-std::array<float,2>{0.142780706f, 0.144833744f},
-std::array<float,2>{0.95161289f, 0.782731414f},
-std::array<float,2>{0.863524318f, 0.0475771464f},
-std::array<float,2>{0.00183070509f, 0.920115411f},
-std::array<float,2>{0.450239956f, 0.309007943f},
-std::array<float,2>{0.742880404f, 0.51051712f},
-std::array<float,2>{0.895936906f, 0.393554926f},
-std::array<float,2>{0.225387499f, 0.742771268f},
-std::array<float,2>{0.318297178f, 0.234095186f},
-std::array<float,2>{0.525951564f, 0.834643066f},
-std::array<float,2>{0.654596746f, 0.0951110944f},
-std::array<float,2>{0.408656806f, 0.961169362f},
-std::array<float,2>{0.064987421f, 0.337066829f},
-std::array<float,2>{0.754331708f, 0.573820055f},
-std::array<float,2>{0.614644825f, 0.30094853f},
-std::array<float,2>{0.276973546f, 0.50086534f},
-std::array<float,2>{0.172709018f, 0.0555400252f},
-std::array<float,2>{0.99124229f, 0.907090724f},
-std::array<float,2>{0.839797378f, 0.153868675f},
-std::array<float,2>{0.0431166068f, 0.79068917f},
-std::array<float,2>{0.470888346f, 0.498857051f},
-std::array<float,2>{0.696944594f, 0.684459448f},
-std::array<float,2>{0.786592126f, 0.354129463f},
-std::array<float,2>{0.115058407f, 0.613696754f},
-std::array<float,2>{0.393592805f, 0.0912414044f},
-std::array<float,2>{0.679344833f, 0.990925133f},
-std::array<float,2>{0.555005491f, 0.198313802f},
-std::array<float,2>{0.346110404f, 0.858858287f},
-std::array<float,2>{0.205989748f, 0.429708391f},
-std::array<float,2>{0.934039772f, 0.700289607f},
-std::array<float,2>{0.741568744f, 0.460345387f},
-std::array<float,2>{0.438281506f, 0.632987618f},
-std::array<float,2>{0.0105416104f, 0.183002383f},
-std::array<float,2>{0.867458761f, 0.772048235f},
-std::array<float,2>{0.937938154f, 0.021948887f},
-std::array<float,2>{0.14863272f, 0.884977937f},
-std::array<float,2>{0.287502676f, 0.27043584f},
-std::array<float,2>{0.563361585f, 0.545987129f},
-std::array<float,2>{0.858354568f, 0.472060531f},
-std::array<float,2>{0.0259044673f, 0.661784828f},
-std::array<float,2>{0.456742495f, 0.128392965f},
-std::array<float,2>{0.720414698f, 0.80582267f},
-std::array<float,2>{0.591687977f, 0.0399039052f},
-std::array<float,2>{0.300746232f, 0.925430655f},
-std::array<float,2>{0.134443194f, 0.295865834f},
-std::array<float,2>{0.95702672f, 0.527574301f},
-std::array<float,2>{0.671367168f, 0.323191106f},
-std::array<float,2>{0.385777682f, 0.59254247f},
-std::array<float,2>{0.105623469f, 0.112676129f},
-std::array<float,2>{0.804568291f, 0.952397585f},
-std::array<float,2>{0.917333364f, 0.240895271f},
-std::array<float,2>{0.188537285f, 0.82288301f},
-std::array<float,2>{0.369017273f, 0.376645148f},
-std::array<float,2>{0.535689175f, 0.720713377f},
-std::array<float,2>{0.971468031f, 0.25795123f},
-std::array<float,2>{0.159519538f, 0.554314137f},
-std::array<float,2>{0.260394305f, 0.0118095791f},
-std::array<float,2>{0.602851689f, 0.891549289f},
-std::array<float,2>{0.714881301f, 0.158513859f},
-std::array<float,2>{0.49675253f, 0.758862138f},
-std::array<float,2>{0.059923768f, 0.444259018f},
-std::array<float,2>{0.819159746f, 0.655366659f},
-std::array<float,2>{0.50937742f, 0.406927079f},
-std::array<float,2>{0.340357006f, 0.7117697f},
-std::array<float,2>{0.23486653f, 0.208169594f},
-std::array<float,2>{0.879101515f, 0.874699712f},
-std::array<float,2>{0.780826569f, 0.0652848855f},
-std::array<float,2>{0.0802657232f, 0.970271587f},
-std::array<float,2>{0.430092514f, 0.363305986f},
-std::array<float,2>{0.640535235f, 0.60417974f},
-std::array<float,2>{0.986456335f, 0.41612041f},
-std::array<float,2>{0.177760139f, 0.704585314f},
-std::array<float,2>{0.279628396f, 0.218098506f},
-std::array<float,2>{0.613129616f, 0.861288548f},
-std::array<float,2>{0.701422513f, 0.0725460798f},
-std::array<float,2>{0.472715348f, 0.98210603f},
-std::array<float,2>{0.0391291492f, 0.370206356f},
-std::array<float,2>{0.840838075f, 0.597718775f},
-std::array<float,2>{0.530059159f, 0.250042647f},
-std::array<float,2>{0.316333294f, 0.560980022f},
-std::array<float,2>{0.222068474f, 0.00288474374f},
-std::array<float,2>{0.890746891f, 0.903342485f},
-std::array<float,2>{0.751810193f, 0.164558738f},
-std::array<float,2>{0.0686706603f, 0.752627969f},
-std::array<float,2>{0.413968325f, 0.448461145f},
-std::array<float,2>{0.651486039f, 0.645783186f},
-std::array<float,2>{0.872287989f, 0.316794813f},
-std::array<float,2>{0.0127574811f, 0.583411694f},
-std::array<float,2>{0.444445878f, 0.117965274f},
-std::array<float,2>{0.734909713f, 0.941245317f},
-std::array<float,2>{0.567993224f, 0.243778452f},
-std::array<float,2>{0.282455474f, 0.815413415f},
-std::array<float,2>{0.155836046f, 0.386743575f},
-std::array<float,2>{0.944025218f, 0.733989298f},
-std::array<float,2>{0.673806965f, 0.484082758f},
-std::array<float,2>{0.395344704f, 0.666374743f},
-std::array<float,2>{0.113019876f, 0.13828817f},
-std::array<float,2>{0.78253454f, 0.797984481f},
-std::array<float,2>{0.932875097f, 0.0357772112f},
-std::array<float,2>{0.207035899f, 0.931277931f},
-std::array<float,2>{0.348157644f, 0.287967473f},
-std::array<float,2>{0.560346961f, 0.516472578f},
-std::array<float,2>{0.797527015f, 0.466403395f},
-std::array<float,2>{0.102087557f, 0.625058413f},
-std::array<float,2>{0.387769848f, 0.179626748f},
-std::array<float,2>{0.665977657f, 0.780926347f},
-std::array<float,2>{0.534625828f, 0.023469137f},
-std::array<float,2>{0.374712497f, 0.881187916f},
-std::array<float,2>{0.192962095f, 0.276228607f},
-std::array<float,2>{0.921470344f, 0.537075996f},
-std::array<float,2>{0.725890756f, 0.35045743f},
-std::array<float,2>{0.457627147f, 0.619932175f},
-std::array<float,2>{0.0289971512f, 0.0854554996f},
-std::array<float,2>{0.854902625f, 0.995510638f},
-std::array<float,2>{0.957520366f, 0.190569386f},
-std::array<float,2>{0.140083164f, 0.845836878f},
-std::array<float,2>{0.301723719f, 0.423947185f},
-std::array<float,2>{0.588549495f, 0.688680768f},
-std::array<float,2>{0.875131667f, 0.306056231f},
-std::array<float,2>{0.238517776f, 0.512790442f},
-std::array<float,2>{0.337191939f, 0.05349309f},
-std::array<float,2>{0.514335275f, 0.914609551f},
-std::array<float,2>{0.633735538f, 0.141965806f},
-std::array<float,2>{0.433943361f, 0.788116515f},
-std::array<float,2>{0.0830919519f, 0.48801142f},
-std::array<float,2>{0.773588896f, 0.673267305f},
-std::array<float,2>{0.607194662f, 0.402334154f},
-std::array<float,2>{0.26361078f, 0.741698205f},
-std::array<float,2>{0.161111772f, 0.224073634f},
-std::array<float,2>{0.97495693f, 0.841288984f},
-std::array<float,2>{0.816085458f, 0.109160461f},
-std::array<float,2>{0.0562270731f, 0.957481623f},
-std::array<float,2>{0.493744403f, 0.333139479f},
-std::array<float,2>{0.714047551f, 0.566434383f},
-std::array<float,2>{0.910264015f, 0.492364109f},
-std::array<float,2>{0.199222073f, 0.683456242f},
-std::array<float,2>{0.360562891f, 0.149180532f},
-std::array<float,2>{0.54104805f, 0.796004355f},
-std::array<float,2>{0.660544217f, 0.0617767237f},
-std::array<float,2>{0.382544816f, 0.912630022f},
-std::array<float,2>{0.0982064158f, 0.300330132f},
-std::array<float,2>{0.808386981f, 0.504855037f},
-std::array<float,2>{0.585157096f, 0.341622442f},
-std::array<float,2>{0.305721462f, 0.575051248f},
-std::array<float,2>{0.128953904f, 0.0995066464f},
-std::array<float,2>{0.966055393f, 0.965534389f},
-std::array<float,2>{0.844848752f, 0.228758365f},
-std::array<float,2>{0.0203505885f, 0.831465304f},
-std::array<float,2>{0.464553177f, 0.397852004f},
-std::array<float,2>{0.731728196f, 0.749085307f},
-std::array<float,2>{0.769942045f, 0.269368261f},
-std::array<float,2>{0.0897109732f, 0.54263413f},
-std::array<float,2>{0.424727827f, 0.0158435497f},
-std::array<float,2>{0.625660121f, 0.889924943f},
-std::array<float,2>{0.506655335f, 0.184305772f},
-std::array<float,2>{0.335112005f, 0.766531229f},
-std::array<float,2>{0.249674648f, 0.456708312f},
-std::array<float,2>{0.888117015f, 0.63915807f},
-std::array<float,2>{0.70734483f, 0.435552061f},
-std::array<float,2>{0.490509659f, 0.696615517f},
-std::array<float,2>{0.0504401959f, 0.202299565f},
-std::array<float,2>{0.822865307f, 0.852194071f},
-std::array<float,2>{0.981037319f, 0.0881577432f},
-std::array<float,2>{0.168088213f, 0.987140954f},
-std::array<float,2>{0.257116705f, 0.356503338f},
-std::array<float,2>{0.600582421f, 0.612052798f},
-std::array<float,2>{0.830061853f, 0.379627675f},
-std::array<float,2>{0.0379024632f, 0.725379348f},
-std::array<float,2>{0.481866151f, 0.237146899f},
-std::array<float,2>{0.694505215f, 0.824319422f},
-std::array<float,2>{0.620179057f, 0.11611709f},
-std::array<float,2>{0.269541055f, 0.948382497f},
-std::array<float,2>{0.184796855f, 0.326759905f},
-std::array<float,2>{0.996101558f, 0.588436007f},
-std::array<float,2>{0.64196831f, 0.291066706f},
-std::array<float,2>{0.415296316f, 0.526575744f},
-std::array<float,2>{0.0705030337f, 0.0432539731f},
-std::array<float,2>{0.758559465f, 0.927171767f},
-std::array<float,2>{0.900940359f, 0.130245492f},
-std::array<float,2>{0.228957444f, 0.810590804f},
-std::array<float,2>{0.321466923f, 0.473214716f},
-std::array<float,2>{0.518129885f, 0.657223463f},
-std::array<float,2>{0.946043909f, 0.363193035f},
-std::array<float,2>{0.14671573f, 0.60870254f},
-std::array<float,2>{0.296444893f, 0.0679937229f},
-std::array<float,2>{0.574027538f, 0.973173678f},
-std::array<float,2>{0.748627126f, 0.204045147f},
-std::array<float,2>{0.447437018f, 0.868531764f},
-std::array<float,2>{0.00576337334f, 0.412785113f},
-std::array<float,2>{0.863095403f, 0.717892885f},
-std::array<float,2>{0.548785448f, 0.438648343f},
-std::array<float,2>{0.355008662f, 0.649495721f},
-std::array<float,2>{0.216384843f, 0.162047476f},
-std::array<float,2>{0.923466504f, 0.764352143f},
-std::array<float,2>{0.792253971f, 0.00941491686f},
-std::array<float,2>{0.12404523f, 0.894681096f},
-std::array<float,2>{0.400390357f, 0.264153212f},
-std::array<float,2>{0.683087885f, 0.550451577f}}
\ No newline at end of file
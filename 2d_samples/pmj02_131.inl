@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.521885037f, 0.17306149f},
-std::array<float,2>{0.202508211f, 0.549474239f},
-std::array<float,2>{0.469214171f, 0.318393975f},
-std::array<float,2>{0.902283251f, 0.982545197f},
-std::array<float,2>{0.856409192f, 0.46274212f},
-std::array<float,2>{0.289130539f, 0.858293235f},
-std::array<float,2>{0.0704461336f, 0.0673736036f},
-std::array<float,2>{0.651404798f, 0.693062544f},
-std::array<float,2>{0.741396785f, 0.289838135f},
-std::array<float,2>{0.0557345897f, 0.88743645f},
-std::array<float,2>{0.373087674f, 0.202541441f},
-std::array<float,2>{0.764618695f, 0.591451705f},
-std::array<float,2>{0.969284058f, 0.0421319231f},
-std::array<float,2>{0.431819439f, 0.680683792f},
-std::array<float,2>{0.161247954f, 0.407410264f},
-std::array<float,2>{0.622105002f, 0.801305056f},
-std::array<float,2>{0.68588841f, 0.12162146f},
-std::array<float,2>{0.099416092f, 0.749675989f},
-std::array<float,2>{0.257398576f, 0.494410515f},
-std::array<float,2>{0.814020514f, 0.82468605f},
-std::array<float,2>{0.931960702f, 0.373061001f},
-std::array<float,2>{0.445279658f, 0.947529197f},
-std::array<float,2>{0.2325349f, 0.139888838f},
-std::array<float,2>{0.539942086f, 0.527393579f},
-std::array<float,2>{0.577460349f, 0.38820228f},
-std::array<float,2>{0.153312102f, 0.773145556f},
-std::array<float,2>{0.375710338f, 0.000656470133f},
-std::array<float,2>{0.937749028f, 0.656188786f},
-std::array<float,2>{0.792952061f, 0.246593103f},
-std::array<float,2>{0.32989347f, 0.61758256f},
-std::array<float,2>{0.0201080311f, 0.262316436f},
-std::array<float,2>{0.716881573f, 0.913584828f},
-std::array<float,2>{0.697307825f, 0.213481545f},
-std::array<float,2>{0.00868707523f, 0.568450809f},
-std::array<float,2>{0.316267461f, 0.301133931f},
-std::array<float,2>{0.803957939f, 0.892393589f},
-std::array<float,2>{0.955384314f, 0.423628062f},
-std::array<float,2>{0.398473859f, 0.783155859f},
-std::array<float,2>{0.135592565f, 0.0619820543f},
-std::array<float,2>{0.592142284f, 0.660176158f},
-std::array<float,2>{0.547948003f, 0.335285693f},
-std::array<float,2>{0.235263377f, 0.991247654f},
-std::array<float,2>{0.459350795f, 0.171187297f},
-std::array<float,2>{0.909629405f, 0.531637907f},
-std::array<float,2>{0.833668649f, 0.0890411437f},
-std::array<float,2>{0.269199312f, 0.705296576f},
-std::array<float,2>{0.11998526f, 0.445395559f},
-std::array<float,2>{0.6572209f, 0.864997327f},
-std::array<float,2>{0.603531897f, 0.0296495557f},
-std::array<float,2>{0.183510497f, 0.62958163f},
-std::array<float,2>{0.411669791f, 0.393321812f},
-std::array<float,2>{0.985739768f, 0.764705122f},
-std::array<float,2>{0.779647171f, 0.277254939f},
-std::array<float,2>{0.356353939f, 0.934714913f},
-std::array<float,2>{0.0333563685f, 0.221699193f},
-std::array<float,2>{0.720976293f, 0.594130814f},
-std::array<float,2>{0.632942617f, 0.479507178f},
-std::array<float,2>{0.0818156973f, 0.831589758f},
-std::array<float,2>{0.298929423f, 0.106331334f},
-std::array<float,2>{0.873916209f, 0.730155826f},
-std::array<float,2>{0.877256334f, 0.151885808f},
-std::array<float,2>{0.492450923f, 0.510291457f},
-std::array<float,2>{0.207002476f, 0.358920604f},
-std::array<float,2>{0.514520347f, 0.961103737f},
-std::array<float,2>{0.582732201f, 0.23141022f},
-std::array<float,2>{0.127533093f, 0.602063596f},
-std::array<float,2>{0.395431012f, 0.269259334f},
-std::array<float,2>{0.963098645f, 0.92895627f},
-std::array<float,2>{0.810117126f, 0.403388947f},
-std::array<float,2>{0.324165642f, 0.751273155f},
-std::array<float,2>{0.00202014321f, 0.0193451587f},
-std::array<float,2>{0.690114856f, 0.640081942f},
-std::array<float,2>{0.666033685f, 0.348723859f},
-std::array<float,2>{0.115915909f, 0.957429588f},
-std::array<float,2>{0.275383145f, 0.143917084f},
-std::array<float,2>{0.839370847f, 0.502012432f},
-std::array<float,2>{0.918024957f, 0.0995671228f},
-std::array<float,2>{0.467141569f, 0.720856667f},
-std::array<float,2>{0.247477308f, 0.475368202f},
-std::array<float,2>{0.56131053f, 0.842838824f},
-std::array<float,2>{0.732691526f, 0.0513276495f},
-std::array<float,2>{0.0465663448f, 0.671084225f},
-std::array<float,2>{0.344398588f, 0.430311531f},
-std::array<float,2>{0.765978098f, 0.792387724f},
-std::array<float,2>{0.997514129f, 0.306053847f},
-std::array<float,2>{0.416577578f, 0.905066252f},
-std::array<float,2>{0.172212496f, 0.205511168f},
-std::array<float,2>{0.601316512f, 0.574615359f},
-std::array<float,2>{0.503950357f, 0.438705117f},
-std::array<float,2>{0.216719985f, 0.868758082f},
-std::array<float,2>{0.486821175f, 0.0797020048f},
-std::array<float,2>{0.886953652f, 0.716733098f},
-std::array<float,2>{0.866025269f, 0.157150432f},
-std::array<float,2>{0.306037843f, 0.541916132f},
-std::array<float,2>{0.0890736505f, 0.337786168f},
-std::array<float,2>{0.630782604f, 0.996125758f},
-std::array<float,2>{0.646719754f, 0.125478446f},
-std::array<float,2>{0.0670675412f, 0.517382503f},
-std::array<float,2>{0.286260366f, 0.364582449f},
-std::array<float,2>{0.84957397f, 0.9428792f},
-std::array<float,2>{0.896764815f, 0.490331024f},
-std::array<float,2>{0.483291984f, 0.81268549f},
-std::array<float,2>{0.188864335f, 0.115598887f},
-std::array<float,2>{0.524066448f, 0.737280786f},
-std::array<float,2>{0.616192341f, 0.252035558f},
-std::array<float,2>{0.169666275f, 0.914913833f},
-std::array<float,2>{0.427913845f, 0.237062544f},
-std::array<float,2>{0.980984449f, 0.61467278f},
-std::array<float,2>{0.755239308f, 0.00996708684f},
-std::array<float,2>{0.366969198f, 0.643768132f},
-std::array<float,2>{0.0487406962f, 0.376135707f},
-std::array<float,2>{0.744447231f, 0.779727936f},
-std::array<float,2>{0.533415318f, 0.0722138062f},
-std::array<float,2>{0.225965559f, 0.699275434f},
-std::array<float,2>{0.448348254f, 0.458539605f},
-std::array<float,2>{0.923986554f, 0.845016181f},
-std::array<float,2>{0.820914924f, 0.322613209f},
-std::array<float,2>{0.261510909f, 0.971989453f},
-std::array<float,2>{0.109047048f, 0.185562238f},
-std::array<float,2>{0.679593921f, 0.555104613f},
-std::array<float,2>{0.703445196f, 0.417505115f},
-std::array<float,2>{0.0246063247f, 0.807994306f},
-std::array<float,2>{0.340861678f, 0.0382377841f},
-std::array<float,2>{0.7838943f, 0.679047346f},
-std::array<float,2>{0.949210823f, 0.192405492f},
-std::array<float,2>{0.388441414f, 0.581362665f},
-std::array<float,2>{0.142366871f, 0.285930336f},
-std::array<float,2>{0.563736081f, 0.877738595f},
-std::array<float,2>{0.620706141f, 0.145541802f},
-std::array<float,2>{0.157795399f, 0.507143497f},
-std::array<float,2>{0.434222937f, 0.347367346f},
-std::array<float,2>{0.975190282f, 0.955475688f},
-std::array<float,2>{0.758441389f, 0.469761699f},
-std::array<float,2>{0.369960606f, 0.838487983f},
-std::array<float,2>{0.0615400933f, 0.0940427482f},
-std::array<float,2>{0.734528661f, 0.724469841f},
-std::array<float,2>{0.653461754f, 0.272886366f},
-std::array<float,2>{0.074393034f, 0.923244596f},
-std::array<float,2>{0.295155525f, 0.228356764f},
-std::array<float,2>{0.853847206f, 0.606499255f},
-std::array<float,2>{0.90544337f, 0.0200667009f},
-std::array<float,2>{0.474660784f, 0.633348405f},
-std::array<float,2>{0.195523888f, 0.398900032f},
-std::array<float,2>{0.519254565f, 0.754379988f},
-std::array<float,2>{0.71180737f, 0.083053261f},
-std::array<float,2>{0.0194295458f, 0.714065015f},
-std::array<float,2>{0.335437894f, 0.44282341f},
-std::array<float,2>{0.795092463f, 0.874931693f},
-std::array<float,2>{0.94516325f, 0.340929151f},
-std::array<float,2>{0.380405039f, 0.992271781f},
-std::array<float,2>{0.149795339f, 0.160615027f},
-std::array<float,2>{0.574048877f, 0.544417381f},
-std::array<float,2>{0.543408871f, 0.435221463f},
-std::array<float,2>{0.229090974f, 0.794796348f},
-std::array<float,2>{0.440110087f, 0.0489676185f},
-std::array<float,2>{0.936385155f, 0.665445626f},
-std::array<float,2>{0.817670166f, 0.207286745f},
-std::array<float,2>{0.251109689f, 0.573919475f},
-std::array<float,2>{0.0974087268f, 0.308598042f},
-std::array<float,2>{0.679976165f, 0.900772214f},
-std::array<float,2>{0.663954794f, 0.238323212f},
-std::array<float,2>{0.121365696f, 0.612107754f},
-std::array<float,2>{0.270739853f, 0.254891425f},
-std::array<float,2>{0.830097377f, 0.921010494f},
-std::array<float,2>{0.913368344f, 0.380242109f},
-std::array<float,2>{0.454758614f, 0.775998056f},
-std::array<float,2>{0.238302633f, 0.0137239974f},
-std::array<float,2>{0.551687658f, 0.648273408f},
-std::array<float,2>{0.58889848f, 0.359787434f},
-std::array<float,2>{0.138319537f, 0.938809991f},
-std::array<float,2>{0.404475093f, 0.129175276f},
-std::array<float,2>{0.958281219f, 0.523115993f},
-std::array<float,2>{0.799029112f, 0.111452714f},
-std::array<float,2>{0.31806162f, 0.738477111f},
-std::array<float,2>{0.0120006939f, 0.484625727f},
-std::array<float,2>{0.7002303f, 0.818081856f},
-std::array<float,2>{0.508438706f, 0.0317915753f},
-std::array<float,2>{0.208699167f, 0.674856782f},
-std::array<float,2>{0.497948855f, 0.419897974f},
-std::array<float,2>{0.881992817f, 0.808784902f},
-std::array<float,2>{0.867275774f, 0.283361435f},
-std::array<float,2>{0.301890522f, 0.879790068f},
-std::array<float,2>{0.0841741711f, 0.191149995f},
-std::array<float,2>{0.638784766f, 0.582645416f},
-std::array<float,2>{0.725824833f, 0.45421654f},
-std::array<float,2>{0.0386076234f, 0.850452125f},
-std::array<float,2>{0.354692072f, 0.0765808821f},
-std::array<float,2>{0.776032746f, 0.696686029f},
-std::array<float,2>{0.989998221f, 0.180671468f},
-std::array<float,2>{0.40830183f, 0.561121285f},
-std::array<float,2>{0.185572371f, 0.327087939f},
-std::array<float,2>{0.608449876f, 0.975293398f},
-std::array<float,2>{0.555595994f, 0.196281254f},
-std::array<float,2>{0.242277086f, 0.589078128f},
-std::array<float,2>{0.464759678f, 0.293120891f},
-std::array<float,2>{0.91617465f, 0.886013031f},
-std::array<float,2>{0.840735018f, 0.412486166f},
-std::array<float,2>{0.280549824f, 0.799681425f},
-std::array<float,2>{0.112218015f, 0.0459804796f},
-std::array<float,2>{0.669249296f, 0.686739624f},
-std::array<float,2>{0.693744659f, 0.314331412f},
-std::array<float,2>{0.0041543697f, 0.980399549f},
-std::array<float,2>{0.327085078f, 0.177678034f},
-std::array<float,2>{0.807261169f, 0.553198993f},
-std::array<float,2>{0.968145788f, 0.0650341809f},
-std::array<float,2>{0.391417444f, 0.687681258f},
-std::array<float,2>{0.132447943f, 0.466345519f},
-std::array<float,2>{0.579893231f, 0.854678869f},
-std::array<float,2>{0.628173828f, 0.00560981268f},
-std::array<float,2>{0.0921349749f, 0.649568915f},
-std::array<float,2>{0.309493542f, 0.385298103f},
-std::array<float,2>{0.862921059f, 0.767534316f},
-std::array<float,2>{0.884147525f, 0.258645386f},
-std::array<float,2>{0.489395738f, 0.908296704f},
-std::array<float,2>{0.21178712f, 0.245338529f},
-std::array<float,2>{0.50127691f, 0.6228652f},
-std::array<float,2>{0.59530431f, 0.496922553f},
-std::array<float,2>{0.178088337f, 0.822808206f},
-std::array<float,2>{0.419278651f, 0.117630839f},
-std::array<float,2>{0.995711982f, 0.743326426f},
-std::array<float,2>{0.770443976f, 0.13410157f},
-std::array<float,2>{0.349193364f, 0.526964486f},
-std::array<float,2>{0.0406396799f, 0.367286891f},
-std::array<float,2>{0.729409397f, 0.951699972f},
-std::array<float,2>{0.749820173f, 0.16648604f},
-std::array<float,2>{0.0531795621f, 0.535323679f},
-std::array<float,2>{0.361258537f, 0.33127144f},
-std::array<float,2>{0.752955198f, 0.984766841f},
-std::array<float,2>{0.979390562f, 0.450175166f},
-std::array<float,2>{0.422916532f, 0.860023081f},
-std::array<float,2>{0.165889263f, 0.0918881893f},
-std::array<float,2>{0.612890482f, 0.709808588f},
-std::array<float,2>{0.530922949f, 0.300755143f},
-std::array<float,2>{0.193392679f, 0.896416008f},
-std::array<float,2>{0.479036033f, 0.215176925f},
-std::array<float,2>{0.892223835f, 0.565038621f},
-std::array<float,2>{0.84627074f, 0.0576270446f},
-std::array<float,2>{0.284529358f, 0.658033609f},
-std::array<float,2>{0.0653599501f, 0.42617619f},
-std::array<float,2>{0.643279135f, 0.787173152f},
-std::array<float,2>{0.56862855f, 0.102899872f},
-std::array<float,2>{0.147102326f, 0.732942641f},
-std::array<float,2>{0.38518548f, 0.48069796f},
-std::array<float,2>{0.949950874f, 0.832611978f},
-std::array<float,2>{0.787381291f, 0.353181422f},
-std::array<float,2>{0.337016195f, 0.968237042f},
-std::array<float,2>{0.0289833769f, 0.153103113f},
-std::array<float,2>{0.710834205f, 0.5143736f},
-std::array<float,2>{0.673815727f, 0.395241082f},
-std::array<float,2>{0.105120532f, 0.757831335f},
-std::array<float,2>{0.262258947f, 0.0262033008f},
-std::array<float,2>{0.826230705f, 0.627735972f},
-std::array<float,2>{0.928435445f, 0.224396914f},
-std::array<float,2>{0.451223224f, 0.600721359f},
-std::array<float,2>{0.221918136f, 0.277882248f},
-std::array<float,2>{0.535193145f, 0.933570683f},
-std::array<float,2>{0.54164505f, 0.137820274f},
-std::array<float,2>{0.232060924f, 0.53080678f},
-std::array<float,2>{0.442251205f, 0.372980505f},
-std::array<float,2>{0.931170046f, 0.945985675f},
-std::array<float,2>{0.816191494f, 0.493686259f},
-std::array<float,2>{0.254576534f, 0.827627301f},
-std::array<float,2>{0.10035193f, 0.124947123f},
-std::array<float,2>{0.684737861f, 0.746402383f},
-std::array<float,2>{0.715352774f, 0.264893383f},
-std::array<float,2>{0.023056427f, 0.910928249f},
-std::array<float,2>{0.331827104f, 0.248644531f},
-std::array<float,2>{0.78995508f, 0.619444132f},
-std::array<float,2>{0.939769626f, 0.00272695837f},
-std::array<float,2>{0.378100663f, 0.653827369f},
-std::array<float,2>{0.154575422f, 0.388760865f},
-std::array<float,2>{0.575457335f, 0.77118963f},
-std::array<float,2>{0.65036869f, 0.0696468651f},
-std::array<float,2>{0.0728478879f, 0.693554163f},
-std::array<float,2>{0.292825341f, 0.463268548f},
-std::array<float,2>{0.859186232f, 0.85685885f},
-std::array<float,2>{0.899512649f, 0.317716688f},
-std::array<float,2>{0.471095562f, 0.982297897f},
-std::array<float,2>{0.199731842f, 0.174565747f},
-std::array<float,2>{0.520580649f, 0.547109008f},
-std::array<float,2>{0.624660254f, 0.409707606f},
-std::array<float,2>{0.162768766f, 0.804209173f},
-std::array<float,2>{0.42993626f, 0.0408658348f},
-std::array<float,2>{0.971593678f, 0.682006061f},
-std::array<float,2>{0.763589799f, 0.200787932f},
-std::array<float,2>{0.371298045f, 0.592644036f},
-std::array<float,2>{0.0582957193f, 0.291274011f},
-std::array<float,2>{0.738917708f, 0.888790667f},
-std::array<float,2>{0.72018671f, 0.219901487f},
-std::array<float,2>{0.0328305773f, 0.595962644f},
-std::array<float,2>{0.359137088f, 0.275267333f},
-std::array<float,2>{0.777812183f, 0.93718785f},
-std::array<float,2>{0.987281978f, 0.392051727f},
-std::array<float,2>{0.413853556f, 0.763549864f},
-std::array<float,2>{0.180441245f, 0.0292861406f},
-std::array<float,2>{0.60285008f, 0.631037235f},
-std::array<float,2>{0.512966335f, 0.356733531f},
-std::array<float,2>{0.203905299f, 0.963525534f},
-std::array<float,2>{0.495332927f, 0.150052905f},
-std::array<float,2>{0.876591325f, 0.508058012f},
-std::array<float,2>{0.87261802f, 0.108254597f},
-std::array<float,2>{0.297633111f, 0.727343738f},
-std::array<float,2>{0.0792329237f, 0.477645874f},
-std::array<float,2>{0.635045648f, 0.829276323f},
-std::array<float,2>{0.589913607f, 0.0588082224f},
-std::array<float,2>{0.134340033f, 0.663298905f},
-std::array<float,2>{0.402319372f, 0.425531536f},
-std::array<float,2>{0.9543221f, 0.784887195f},
-std::array<float,2>{0.801401436f, 0.303623676f},
-std::array<float,2>{0.312969297f, 0.894469082f},
-std::array<float,2>{0.0116604427f, 0.211510137f},
-std::array<float,2>{0.695675313f, 0.568152249f},
-std::array<float,2>{0.65828371f, 0.447650701f},
-std::array<float,2>{0.118933558f, 0.866954446f},
-std::array<float,2>{0.266818762f, 0.0863281861f},
-std::array<float,2>{0.834293187f, 0.703746378f},
-std::array<float,2>{0.90633899f, 0.168298632f},
-std::array<float,2>{0.45787105f, 0.53440541f},
-std::array<float,2>{0.238161191f, 0.333843023f},
-std::array<float,2>{0.550537586f, 0.989775598f},
-std::array<float,2>{0.597875595f, 0.203154579f},
-std::array<float,2>{0.175458491f, 0.576667011f},
-std::array<float,2>{0.415878832f, 0.308530152f},
-std::array<float,2>{0.998662889f, 0.904270887f},
-std::array<float,2>{0.76860255f, 0.432453275f},
-std::array<float,2>{0.345999628f, 0.790462852f},
-std::array<float,2>{0.0447302721f, 0.0534491763f},
-std::array<float,2>{0.731674314f, 0.669730186f},
-std::array<float,2>{0.632623017f, 0.339765906f},
-std::array<float,2>{0.0867526457f, 0.998610556f},
-std::array<float,2>{0.307270795f, 0.158244357f},
-std::array<float,2>{0.863984048f, 0.539454401f},
-std::array<float,2>{0.890612066f, 0.0819083676f},
-std::array<float,2>{0.48576051f, 0.718547702f},
-std::array<float,2>{0.217486113f, 0.439965934f},
-std::array<float,2>{0.506581604f, 0.869461f},
-std::array<float,2>{0.687731147f, 0.016394509f},
-std::array<float,2>{0.000828267017f, 0.637133479f},
-std::array<float,2>{0.320633501f, 0.405095577f},
-std::array<float,2>{0.810690701f, 0.752333105f},
-std::array<float,2>{0.962762296f, 0.267336309f},
-std::array<float,2>{0.396500736f, 0.926835775f},
-std::array<float,2>{0.126339093f, 0.233070225f},
-std::array<float,2>{0.584397912f, 0.604947209f},
-std::array<float,2>{0.559289873f, 0.472909868f},
-std::array<float,2>{0.249552205f, 0.841354489f},
-std::array<float,2>{0.466058075f, 0.101190455f},
-std::array<float,2>{0.920224488f, 0.719400108f},
-std::array<float,2>{0.836230516f, 0.14098005f},
-std::array<float,2>{0.275566697f, 0.500764251f},
-std::array<float,2>{0.113982633f, 0.351049244f},
-std::array<float,2>{0.66570276f, 0.960531056f},
-std::array<float,2>{0.677645564f, 0.18362461f},
-std::array<float,2>{0.106147818f, 0.557134807f},
-std::array<float,2>{0.258660346f, 0.321356744f},
-std::array<float,2>{0.823572814f, 0.970407605f},
-std::array<float,2>{0.923522294f, 0.459570527f},
-std::array<float,2>{0.447166681f, 0.847225726f},
-std::array<float,2>{0.223113313f, 0.0732737333f},
-std::array<float,2>{0.533101916f, 0.70272541f},
-std::array<float,2>{0.565804839f, 0.287145704f},
-std::array<float,2>{0.143635333f, 0.875941694f},
-std::array<float,2>{0.38920939f, 0.194160417f},
-std::array<float,2>{0.946965456f, 0.579610407f},
-std::array<float,2>{0.783048511f, 0.0368273184f},
-std::array<float,2>{0.342056543f, 0.676469803f},
-std::array<float,2>{0.0259701908f, 0.415565133f},
-std::array<float,2>{0.706937194f, 0.806566536f},
-std::array<float,2>{0.526849866f, 0.114895701f},
-std::array<float,2>{0.189643115f, 0.73513782f},
-std::array<float,2>{0.481684178f, 0.490104556f},
-std::array<float,2>{0.896182716f, 0.815450668f},
-std::array<float,2>{0.850232422f, 0.365391672f},
-std::array<float,2>{0.287715971f, 0.945184588f},
-std::array<float,2>{0.0701045617f, 0.127089962f},
-std::array<float,2>{0.645759463f, 0.517982662f},
-std::array<float,2>{0.742760897f, 0.377900273f},
-std::array<float,2>{0.0498470999f, 0.778770745f},
-std::array<float,2>{0.363512188f, 0.00873626862f},
-std::array<float,2>{0.757306993f, 0.640679836f},
-std::array<float,2>{0.982534528f, 0.235416591f},
-std::array<float,2>{0.426110953f, 0.615430832f},
-std::array<float,2>{0.169992909f, 0.250047356f},
-std::array<float,2>{0.614423454f, 0.916551411f},
-std::array<float,2>{0.57104224f, 0.16284816f},
-std::array<float,2>{0.151606262f, 0.54664284f},
-std::array<float,2>{0.382574618f, 0.343675971f},
-std::array<float,2>{0.943020463f, 0.995676398f},
-std::array<float,2>{0.794220805f, 0.444019765f},
-std::array<float,2>{0.333174586f, 0.872774005f},
-std::array<float,2>{0.0158126876f, 0.0849403143f},
-std::array<float,2>{0.713957012f, 0.712637126f},
-std::array<float,2>{0.681890607f, 0.312024891f},
-std::array<float,2>{0.0954739451f, 0.899348438f},
-std::array<float,2>{0.252746761f, 0.210161626f},
-std::array<float,2>{0.819495976f, 0.570703268f},
-std::array<float,2>{0.935374856f, 0.0481966361f},
-std::array<float,2>{0.439313918f, 0.666652143f},
-std::array<float,2>{0.226743817f, 0.436854273f},
-std::array<float,2>{0.545824111f, 0.796757877f},
-std::array<float,2>{0.736663103f, 0.0970725715f},
-std::array<float,2>{0.0603216849f, 0.724736571f},
-std::array<float,2>{0.368290037f, 0.472061604f},
-std::array<float,2>{0.761127532f, 0.836608291f},
-std::array<float,2>{0.973046005f, 0.345089436f},
-std::array<float,2>{0.436910689f, 0.953173697f},
-std::array<float,2>{0.158231318f, 0.148208335f},
-std::array<float,2>{0.618301511f, 0.505557239f},
-std::array<float,2>{0.515678287f, 0.401573092f},
-std::array<float,2>{0.198338687f, 0.757360399f},
-std::array<float,2>{0.472812295f, 0.0231704544f},
-std::array<float,2>{0.903125167f, 0.636593759f},
-std::array<float,2>{0.85300529f, 0.23041825f},
-std::array<float,2>{0.294361413f, 0.609020948f},
-std::array<float,2>{0.0778519735f, 0.269770354f},
-std::array<float,2>{0.655994415f, 0.925387621f},
-std::array<float,2>{0.636819303f, 0.188194185f},
-std::array<float,2>{0.0831205398f, 0.584738195f},
-std::array<float,2>{0.303607911f, 0.281451225f},
-std::array<float,2>{0.870946229f, 0.882074296f},
-std::array<float,2>{0.880400121f, 0.420203328f},
-std::array<float,2>{0.498718858f, 0.810657322f},
-std::array<float,2>{0.210878626f, 0.0335440747f},
-std::array<float,2>{0.510165155f, 0.672568381f},
-std::array<float,2>{0.606549859f, 0.324576318f},
-std::array<float,2>{0.185458854f, 0.974511445f},
-std::array<float,2>{0.407198668f, 0.182105199f},
-std::array<float,2>{0.99156791f, 0.55996573f},
-std::array<float,2>{0.774036765f, 0.0756447837f},
-std::array<float,2>{0.3526043f, 0.697492421f},
-std::array<float,2>{0.035610497f, 0.456391215f},
-std::array<float,2>{0.724026144f, 0.848763108f},
-std::array<float,2>{0.554217458f, 0.0120001817f},
-std::array<float,2>{0.24083744f, 0.64538449f},
-std::array<float,2>{0.456848353f, 0.381269097f},
-std::array<float,2>{0.910188675f, 0.773726106f},
-std::array<float,2>{0.829522192f, 0.255965263f},
-std::array<float,2>{0.272365361f, 0.919346333f},
-std::array<float,2>{0.124968238f, 0.240696639f},
-std::array<float,2>{0.661121786f, 0.61037606f},
-std::array<float,2>{0.702608824f, 0.486841559f},
-std::array<float,2>{0.0143075148f, 0.819433212f},
-std::array<float,2>{0.319111675f, 0.110612087f},
-std::array<float,2>{0.797706664f, 0.741790056f},
-std::array<float,2>{0.96087414f, 0.132353708f},
-std::array<float,2>{0.402934253f, 0.520379961f},
-std::array<float,2>{0.139014915f, 0.36188221f},
-std::array<float,2>{0.585973501f, 0.940132737f},
-std::array<float,2>{0.503298938f, 0.244105846f},
-std::array<float,2>{0.214183107f, 0.623047411f},
-std::array<float,2>{0.490573168f, 0.259842068f},
-std::array<float,2>{0.886595249f, 0.907646f},
-std::array<float,2>{0.861298919f, 0.382941782f},
-std::array<float,2>{0.311138839f, 0.769086957f},
-std::array<float,2>{0.0907991603f, 0.00734617002f},
-std::array<float,2>{0.626464605f, 0.651785195f},
-std::array<float,2>{0.727216423f, 0.370756507f},
-std::array<float,2>{0.0414313078f, 0.950898945f},
-std::array<float,2>{0.350491345f, 0.136067286f},
-std::array<float,2>{0.771924615f, 0.52490288f},
-std::array<float,2>{0.992834449f, 0.120720901f},
-std::array<float,2>{0.421327472f, 0.746026933f},
-std::array<float,2>{0.177632317f, 0.499726653f},
-std::array<float,2>{0.59587121f, 0.820740044f},
-std::array<float,2>{0.671710193f, 0.0445349365f},
-std::array<float,2>{0.110945247f, 0.684541583f},
-std::array<float,2>{0.278708577f, 0.410854489f},
-std::array<float,2>{0.841998458f, 0.797816932f},
-std::array<float,2>{0.914584041f, 0.296272814f},
-std::array<float,2>{0.462667912f, 0.883087039f},
-std::array<float,2>{0.245588481f, 0.198146969f},
-std::array<float,2>{0.558042943f, 0.586005211f},
-std::array<float,2>{0.580195069f, 0.468641222f},
-std::array<float,2>{0.130311444f, 0.853242993f},
-std::array<float,2>{0.393117011f, 0.0630396307f},
-std::array<float,2>{0.966705739f, 0.690026462f},
-std::array<float,2>{0.804946482f, 0.178996623f},
-std::array<float,2>{0.325523406f, 0.550960541f},
-std::array<float,2>{0.00707136746f, 0.314671695f},
-std::array<float,2>{0.69288975f, 0.977498353f},
-std::array<float,2>{0.707164586f, 0.155989453f},
-std::array<float,2>{0.0308718905f, 0.51272279f},
-std::array<float,2>{0.338137567f, 0.354544163f},
-std::array<float,2>{0.786202073f, 0.966729105f},
-std::array<float,2>{0.952798247f, 0.484303653f},
-std::array<float,2>{0.384224683f, 0.834256172f},
-std::array<float,2>{0.145732135f, 0.104131326f},
-std::array<float,2>{0.56726563f, 0.731008887f},
-std::array<float,2>{0.538671434f, 0.280184656f},
-std::array<float,2>{0.219758987f, 0.929851651f},
-std::array<float,2>{0.450271726f, 0.226048201f},
-std::array<float,2>{0.92733252f, 0.597931921f},
-std::array<float,2>{0.826125205f, 0.0241237748f},
-std::array<float,2>{0.265470058f, 0.626183867f},
-std::array<float,2>{0.103076287f, 0.398411602f},
-std::array<float,2>{0.675468683f, 0.759861827f},
-std::array<float,2>{0.610331953f, 0.0911414027f},
-std::array<float,2>{0.167251781f, 0.707967639f},
-std::array<float,2>{0.425443769f, 0.452691674f},
-std::array<float,2>{0.977883816f, 0.861580372f},
-std::array<float,2>{0.750358462f, 0.328506768f},
-std::array<float,2>{0.362411469f, 0.987463355f},
-std::array<float,2>{0.0508939363f, 0.16517216f},
-std::array<float,2>{0.74734199f, 0.537658691f},
-std::array<float,2>{0.64166981f, 0.428224057f},
-std::array<float,2>{0.0628771633f, 0.785845876f},
-std::array<float,2>{0.282894373f, 0.0562337376f},
-std::array<float,2>{0.844694614f, 0.658649027f},
-std::array<float,2>{0.893785179f, 0.217580721f},
-std::array<float,2>{0.478204161f, 0.564334393f},
-std::array<float,2>{0.191650406f, 0.297716171f},
-std::array<float,2>{0.527704597f, 0.898206413f},
-std::array<float,2>{0.548889041f, 0.170749322f},
-std::array<float,2>{0.23663646f, 0.532916546f},
-std::array<float,2>{0.458283216f, 0.334956974f},
-std::array<float,2>{0.908097565f, 0.990564942f},
-std::array<float,2>{0.835667193f, 0.446714848f},
-std::array<float,2>{0.265873015f, 0.86365366f},
-std::array<float,2>{0.118064381f, 0.0880035535f},
-std::array<float,2>{0.659883738f, 0.706187725f},
-std::array<float,2>{0.696908355f, 0.302125603f},
-std::array<float,2>{0.010576495f, 0.891486287f},
-std::array<float,2>{0.314140737f, 0.21415703f},
-std::array<float,2>{0.802042961f, 0.569685578f},
-std::array<float,2>{0.953957975f, 0.0614536442f},
-std::array<float,2>{0.40087828f, 0.661680341f},
-std::array<float,2>{0.133774728f, 0.422081858f},
-std::array<float,2>{0.59177959f, 0.781818271f},
-std::array<float,2>{0.636483788f, 0.106609397f},
-std::array<float,2>{0.078680329f, 0.729295254f},
-std::array<float,2>{0.298167765f, 0.479102612f},
-std::array<float,2>{0.871536851f, 0.830807507f},
-std::array<float,2>{0.875303805f, 0.357814074f},
-std::array<float,2>{0.49461475f, 0.962872624f},
-std::array<float,2>{0.205059111f, 0.151050314f},
-std::array<float,2>{0.511993587f, 0.510759354f},
-std::array<float,2>{0.602176487f, 0.39451912f},
-std::array<float,2>{0.180906504f, 0.764279246f},
-std::array<float,2>{0.412799537f, 0.0311310161f},
-std::array<float,2>{0.987858117f, 0.630166709f},
-std::array<float,2>{0.778770745f, 0.221645623f},
-std::array<float,2>{0.357812077f, 0.595465243f},
-std::array<float,2>{0.0315286219f, 0.275493175f},
-std::array<float,2>{0.718763947f, 0.93383503f},
-std::array<float,2>{0.739333272f, 0.202148065f},
-std::array<float,2>{0.0573929846f, 0.589850247f},
-std::array<float,2>{0.372769088f, 0.290444255f},
-std::array<float,2>{0.762166202f, 0.887829304f},
-std::array<float,2>{0.972378492f, 0.406747997f},
-std::array<float,2>{0.43130374f, 0.802583337f},
-std::array<float,2>{0.163224325f, 0.0416826233f},
-std::array<float,2>{0.623686373f, 0.680560946f},
-std::array<float,2>{0.520314872f, 0.319901794f},
-std::array<float,2>{0.200398862f, 0.983416736f},
-std::array<float,2>{0.472468138f, 0.172011733f},
-std::array<float,2>{0.899403274f, 0.550563872f},
-std::array<float,2>{0.85752207f, 0.0678299591f},
-std::array<float,2>{0.291687816f, 0.691550493f},
-std::array<float,2>{0.0739396513f, 0.461197525f},
-std::array<float,2>{0.64850527f, 0.85884881f},
-std::array<float,2>{0.57481575f, 0.00134119694f},
-std::array<float,2>{0.156174958f, 0.654376268f},
-std::array<float,2>{0.37696898f, 0.386854082f},
-std::array<float,2>{0.941275775f, 0.772459745f},
-std::array<float,2>{0.790823102f, 0.263401628f},
-std::array<float,2>{0.330165446f, 0.91254127f},
-std::array<float,2>{0.0219125822f, 0.24767971f},
-std::array<float,2>{0.716590643f, 0.618618906f},
-std::array<float,2>{0.68410641f, 0.495514721f},
-std::array<float,2>{0.100651458f, 0.825987041f},
-std::array<float,2>{0.255675256f, 0.122741953f},
-std::array<float,2>{0.814875185f, 0.748190105f},
-std::array<float,2>{0.929927886f, 0.139251053f},
-std::array<float,2>{0.442810893f, 0.528683186f},
-std::array<float,2>{0.231343523f, 0.374273419f},
-std::array<float,2>{0.542717695f, 0.949125409f},
-std::array<float,2>{0.6141271f, 0.238118157f},
-std::array<float,2>{0.171375006f, 0.613994062f},
-std::array<float,2>{0.426772565f, 0.253033757f},
-std::array<float,2>{0.98368144f, 0.91545409f},
-std::array<float,2>{0.75673902f, 0.375054598f},
-std::array<float,2>{0.364801317f, 0.780845106f},
-std::array<float,2>{0.0492015146f, 0.0114768464f},
-std::array<float,2>{0.743864179f, 0.643474042f},
-std::array<float,2>{0.645166516f, 0.364188015f},
-std::array<float,2>{0.0692690387f, 0.941562414f},
-std::array<float,2>{0.288495421f, 0.126155943f},
-std::array<float,2>{0.850942969f, 0.515656888f},
-std::array<float,2>{0.89458251f, 0.117012702f},
-std::array<float,2>{0.480485767f, 0.737762332f},
-std::array<float,2>{0.191091269f, 0.492168784f},
-std::array<float,2>{0.525892675f, 0.814189374f},
-std::array<float,2>{0.705489278f, 0.0379861072f},
-std::array<float,2>{0.0264951941f, 0.678499699f},
-std::array<float,2>{0.342848688f, 0.41618219f},
-std::array<float,2>{0.781998456f, 0.806979835f},
-std::array<float,2>{0.945744812f, 0.287065446f},
-std::array<float,2>{0.390190333f, 0.878524065f},
-std::array<float,2>{0.143230885f, 0.192262724f},
-std::array<float,2>{0.5651142f, 0.58042711f},
-std::array<float,2>{0.532147169f, 0.457499713f},
-std::array<float,2>{0.224334091f, 0.84418416f},
-std::array<float,2>{0.445683718f, 0.0703246519f},
-std::array<float,2>{0.922410429f, 0.700532556f},
-std::array<float,2>{0.823038638f, 0.187443376f},
-std::array<float,2>{0.259525836f, 0.555775106f},
-std::array<float,2>{0.107092462f, 0.324100196f},
-std::array<float,2>{0.676490247f, 0.971120715f},
-std::array<float,2>{0.664586425f, 0.143369347f},
-std::array<float,2>{0.114429899f, 0.502998471f},
-std::array<float,2>{0.277043939f, 0.348477036f},
-std::array<float,2>{0.837593675f, 0.958133578f},
-std::array<float,2>{0.921871305f, 0.475827903f},
-std::array<float,2>{0.465419531f, 0.84207809f},
-std::array<float,2>{0.248445541f, 0.0985784009f},
-std::array<float,2>{0.560209095f, 0.721984386f},
-std::array<float,2>{0.585484326f, 0.268341005f},
-std::array<float,2>{0.12530072f, 0.928423941f},
-std::array<float,2>{0.397993177f, 0.232140973f},
-std::array<float,2>{0.9612149f, 0.602548182f},
-std::array<float,2>{0.812241018f, 0.0176689606f},
-std::array<float,2>{0.321320623f, 0.638772666f},
-std::array<float,2>{0.0010651052f, 0.402514547f},
-std::array<float,2>{0.689380407f, 0.750033617f},
-std::array<float,2>{0.507335961f, 0.0788682476f},
-std::array<float,2>{0.218253553f, 0.714934289f},
-std::array<float,2>{0.485060096f, 0.437609166f},
-std::array<float,2>{0.889211297f, 0.868069828f},
-std::array<float,2>{0.864567578f, 0.336777389f},
-std::array<float,2>{0.30769521f, 0.99750638f},
-std::array<float,2>{0.0876327157f, 0.157316864f},
-std::array<float,2>{0.630893171f, 0.542539358f},
-std::array<float,2>{0.730486929f, 0.431610912f},
-std::array<float,2>{0.0439156331f, 0.791943669f},
-std::array<float,2>{0.346964926f, 0.0524463952f},
-std::array<float,2>{0.768171549f, 0.670678258f},
-std::array<float,2>{0.999616086f, 0.206889823f},
-std::array<float,2>{0.414783746f, 0.576119304f},
-std::array<float,2>{0.174431026f, 0.305558085f},
-std::array<float,2>{0.599554896f, 0.905366182f},
-std::array<float,2>{0.587354481f, 0.13017419f},
-std::array<float,2>{0.14020817f, 0.52237016f},
-std::array<float,2>{0.403707057f, 0.360559225f},
-std::array<float,2>{0.959131181f, 0.938381374f},
-std::array<float,2>{0.797969997f, 0.485408813f},
-std::array<float,2>{0.319652319f, 0.817111909f},
-std::array<float,2>{0.0150017943f, 0.112973839f},
-std::array<float,2>{0.701427996f, 0.739869058f},
-std::array<float,2>{0.661226153f, 0.254310727f},
-std::array<float,2>{0.123146795f, 0.920800745f},
-std::array<float,2>{0.272719264f, 0.239292756f},
-std::array<float,2>{0.828570426f, 0.612504303f},
-std::array<float,2>{0.911233485f, 0.0149652036f},
-std::array<float,2>{0.456013858f, 0.646639287f},
-std::array<float,2>{0.242172271f, 0.379695743f},
-std::array<float,2>{0.552927673f, 0.777080536f},
-std::array<float,2>{0.722910106f, 0.0779851153f},
-std::array<float,2>{0.0366254598f, 0.695634961f},
-std::array<float,2>{0.352140725f, 0.453778952f},
-std::array<float,2>{0.77481848f, 0.850747883f},
-std::array<float,2>{0.990338624f, 0.327444732f},
-std::array<float,2>{0.407665521f, 0.975628018f},
-std::array<float,2>{0.184231251f, 0.179957986f},
-std::array<float,2>{0.606097639f, 0.561729133f},
-std::array<float,2>{0.511591494f, 0.418083698f},
-std::array<float,2>{0.209585175f, 0.810431778f},
-std::array<float,2>{0.499572426f, 0.0323495753f},
-std::array<float,2>{0.879435539f, 0.674610674f},
-std::array<float,2>{0.869396687f, 0.190177485f},
-std::array<float,2>{0.303791672f, 0.583325446f},
-std::array<float,2>{0.0825068802f, 0.284243912f},
-std::array<float,2>{0.638397932f, 0.880311966f},
-std::array<float,2>{0.655256927f, 0.22721529f},
-std::array<float,2>{0.0771016628f, 0.606432796f},
-std::array<float,2>{0.293024123f, 0.272166938f},
-std::array<float,2>{0.852049172f, 0.922305048f},
-std::array<float,2>{0.903988183f, 0.399418116f},
-std::array<float,2>{0.474502057f, 0.755649507f},
-std::array<float,2>{0.198220089f, 0.021107344f},
-std::array<float,2>{0.51715225f, 0.63427043f},
-std::array<float,2>{0.617667317f, 0.346435905f},
-std::array<float,2>{0.159926564f, 0.956305265f},
-std::array<float,2>{0.435601205f, 0.145194575f},
-std::array<float,2>{0.974429846f, 0.50635165f},
-std::array<float,2>{0.760029674f, 0.0954741687f},
-std::array<float,2>{0.367416024f, 0.722812831f},
-std::array<float,2>{0.0594693273f, 0.469473451f},
-std::array<float,2>{0.737748146f, 0.839190841f},
-std::array<float,2>{0.546622276f, 0.0500487052f},
-std::array<float,2>{0.227675527f, 0.664848387f},
-std::array<float,2>{0.437945962f, 0.434120506f},
-std::array<float,2>{0.933615088f, 0.793375671f},
-std::array<float,2>{0.818964362f, 0.31046018f},
-std::array<float,2>{0.253849208f, 0.901756227f},
-std::array<float,2>{0.0940641463f, 0.208707795f},
-std::array<float,2>{0.683318198f, 0.572855294f},
-std::array<float,2>{0.713834524f, 0.441732436f},
-std::array<float,2>{0.0172509905f, 0.873445272f},
-std::array<float,2>{0.332076043f, 0.0824730471f},
-std::array<float,2>{0.793637991f, 0.71370995f},
-std::array<float,2>{0.941744149f, 0.162066832f},
-std::array<float,2>{0.381456047f, 0.543290794f},
-std::array<float,2>{0.151092604f, 0.340023607f},
-std::array<float,2>{0.571765363f, 0.993541241f},
-std::array<float,2>{0.528520644f, 0.215882748f},
-std::array<float,2>{0.192679375f, 0.565445065f},
-std::array<float,2>{0.476917416f, 0.299449205f},
-std::array<float,2>{0.892579377f, 0.895494103f},
-std::array<float,2>{0.845089495f, 0.426887602f},
-std::array<float,2>{0.281386524f, 0.788704276f},
-std::array<float,2>{0.064429f, 0.0573188923f},
-std::array<float,2>{0.641331315f, 0.657091558f},
-std::array<float,2>{0.746312857f, 0.330587149f},
-std::array<float,2>{0.0520066507f, 0.985667229f},
-std::array<float,2>{0.362303346f, 0.167028382f},
-std::array<float,2>{0.751804173f, 0.537030935f},
-std::array<float,2>{0.976682663f, 0.0932003185f},
-std::array<float,2>{0.423935413f, 0.710292339f},
-std::array<float,2>{0.166470155f, 0.450471342f},
-std::array<float,2>{0.610370398f, 0.860791385f},
-std::array<float,2>{0.674407899f, 0.0270653181f},
-std::array<float,2>{0.102329701f, 0.628151596f},
-std::array<float,2>{0.264059424f, 0.39604637f},
-std::array<float,2>{0.824375749f, 0.759055138f},
-std::array<float,2>{0.926083386f, 0.27891925f},
-std::array<float,2>{0.449357331f, 0.932522357f},
-std::array<float,2>{0.219563186f, 0.223284155f},
-std::array<float,2>{0.537755787f, 0.600563288f},
-std::array<float,2>{0.567974687f, 0.482405484f},
-std::array<float,2>{0.144816637f, 0.833087802f},
-std::array<float,2>{0.383247852f, 0.101746507f},
-std::array<float,2>{0.951215625f, 0.734135568f},
-std::array<float,2>{0.785667598f, 0.15384315f},
-std::array<float,2>{0.339571238f, 0.515440524f},
-std::array<float,2>{0.0294961017f, 0.351567864f},
-std::array<float,2>{0.708311856f, 0.967386365f},
-std::array<float,2>{0.691895306f, 0.176456004f},
-std::array<float,2>{0.0058805719f, 0.554430127f},
-std::array<float,2>{0.324473858f, 0.312637448f},
-std::array<float,2>{0.806580722f, 0.978674948f},
-std::array<float,2>{0.965031266f, 0.464917839f},
-std::array<float,2>{0.394138902f, 0.853851557f},
-std::array<float,2>{0.129123911f, 0.0658208504f},
-std::array<float,2>{0.581597269f, 0.688896835f},
-std::array<float,2>{0.556944788f, 0.294070691f},
-std::array<float,2>{0.244924858f, 0.885097921f},
-std::array<float,2>{0.461549252f, 0.196588993f},
-std::array<float,2>{0.915188909f, 0.588847756f},
-std::array<float,2>{0.842773616f, 0.0450826176f},
-std::array<float,2>{0.278213918f, 0.686009467f},
-std::array<float,2>{0.109744981f, 0.413416266f},
-std::array<float,2>{0.670504928f, 0.800536811f},
-std::array<float,2>{0.597492337f, 0.118277147f},
-std::array<float,2>{0.176465109f, 0.743052542f},
-std::array<float,2>{0.420220464f, 0.4979316f},
-std::array<float,2>{0.993261039f, 0.823594153f},
-std::array<float,2>{0.772806823f, 0.369025648f},
-std::array<float,2>{0.351394236f, 0.952564895f},
-std::array<float,2>{0.0423054136f, 0.132878244f},
-std::array<float,2>{0.728400648f, 0.525428534f},
-std::array<float,2>{0.625926971f, 0.386203647f},
-std::array<float,2>{0.0916049704f, 0.766287088f},
-std::array<float,2>{0.312233955f, 0.0045165238f},
-std::array<float,2>{0.859973788f, 0.648481786f},
-std::array<float,2>{0.885004044f, 0.244431898f},
-std::array<float,2>{0.491889685f, 0.621329606f},
-std::array<float,2>{0.213360667f, 0.259745508f},
-std::array<float,2>{0.501987398f, 0.909698367f},
-std::array<float,2>{0.515442967f, 0.148553103f},
-std::array<float,2>{0.205496773f, 0.509744346f},
-std::array<float,2>{0.493440211f, 0.355989069f},
-std::array<float,2>{0.877931654f, 0.964431524f},
-std::array<float,2>{0.874244809f, 0.477206618f},
-std::array<float,2>{0.300307631f, 0.828959525f},
-std::array<float,2>{0.0803261623f, 0.109311268f},
-std::array<float,2>{0.634336054f, 0.728214741f},
-std::array<float,2>{0.722601712f, 0.274118334f},
-std::array<float,2>{0.0342859067f, 0.936509371f},
-std::array<float,2>{0.356659055f, 0.219128087f},
-std::array<float,2>{0.781038046f, 0.597369075f},
-std::array<float,2>{0.985121965f, 0.0278785508f},
-std::array<float,2>{0.410503387f, 0.632240355f},
-std::array<float,2>{0.181947589f, 0.391045719f},
-std::array<float,2>{0.60529995f, 0.762545288f},
-std::array<float,2>{0.657957017f, 0.0869457945f},
-std::array<float,2>{0.120257095f, 0.704401612f},
-std::array<float,2>{0.268036246f, 0.448554575f},
-std::array<float,2>{0.832936823f, 0.865313649f},
-std::array<float,2>{0.909136355f, 0.332375526f},
-std::array<float,2>{0.460516214f, 0.988849342f},
-std::array<float,2>{0.235918283f, 0.169841543f},
-std::array<float,2>{0.54707092f, 0.533760369f},
-std::array<float,2>{0.593638599f, 0.424798697f},
-std::array<float,2>{0.136103705f, 0.783447683f},
-std::array<float,2>{0.400224268f, 0.0599707998f},
-std::array<float,2>{0.956378043f, 0.662563324f},
-std::array<float,2>{0.802783847f, 0.212203145f},
-std::array<float,2>{0.314816028f, 0.56656301f},
-std::array<float,2>{0.00936244987f, 0.304248095f},
-std::array<float,2>{0.699023366f, 0.893045425f},
-std::array<float,2>{0.718286693f, 0.249252528f},
-std::array<float,2>{0.021256743f, 0.621028185f},
-std::array<float,2>{0.328724504f, 0.264639527f},
-std::array<float,2>{0.791354775f, 0.911265075f},
-std::array<float,2>{0.939061344f, 0.390302837f},
-std::array<float,2>{0.376698047f, 0.769675016f},
-std::array<float,2>{0.153610572f, 0.0035855663f},
-std::array<float,2>{0.576809466f, 0.65252769f},
-std::array<float,2>{0.540471911f, 0.371250302f},
-std::array<float,2>{0.234014124f, 0.946654797f},
-std::array<float,2>{0.443949312f, 0.137519613f},
-std::array<float,2>{0.933302701f, 0.52935493f},
-std::array<float,2>{0.81346786f, 0.123534083f},
-std::array<float,2>{0.256175429f, 0.747427166f},
-std::array<float,2>{0.0977940187f, 0.492349178f},
-std::array<float,2>{0.686794102f, 0.827067018f},
-std::array<float,2>{0.621905804f, 0.0395308509f},
-std::array<float,2>{0.160189137f, 0.683415294f},
-std::array<float,2>{0.432996362f, 0.409121215f},
-std::array<float,2>{0.970061898f, 0.803692102f},
-std::array<float,2>{0.7648862f, 0.292857885f},
-std::array<float,2>{0.374829918f, 0.890093267f},
-std::array<float,2>{0.0551073253f, 0.199719504f},
-std::array<float,2>{0.740294814f, 0.593387783f},
-std::array<float,2>{0.650925815f, 0.464484453f},
-std::array<float,2>{0.071955286f, 0.856322289f},
-std::array<float,2>{0.29008919f, 0.0692830458f},
-std::array<float,2>{0.857339919f, 0.695234835f},
-std::array<float,2>{0.901097417f, 0.174871251f},
-std::array<float,2>{0.470480531f, 0.548663497f},
-std::array<float,2>{0.201190859f, 0.317014217f},
-std::array<float,2>{0.523038626f, 0.98088634f},
-std::array<float,2>{0.562554836f, 0.194463462f},
-std::array<float,2>{0.14098227f, 0.579006553f},
-std::array<float,2>{0.386975139f, 0.288105577f},
-std::array<float,2>{0.947523236f, 0.876942098f},
-std::array<float,2>{0.784202874f, 0.414328128f},
-std::array<float,2>{0.340608507f, 0.805632412f},
-std::array<float,2>{0.0238241553f, 0.035327062f},
-std::array<float,2>{0.704255819f, 0.67754817f},
-std::array<float,2>{0.678299248f, 0.320538104f},
-std::array<float,2>{0.108382083f, 0.969253063f},
-std::array<float,2>{0.260160983f, 0.185536861f},
-std::array<float,2>{0.821474671f, 0.558464646f},
-std::array<float,2>{0.925240815f, 0.0725072622f},
-std::array<float,2>{0.447744608f, 0.701695085f},
-std::array<float,2>{0.224775985f, 0.459994763f},
-std::array<float,2>{0.534370542f, 0.846329689f},
-std::array<float,2>{0.745904326f, 0.00882704183f},
-std::array<float,2>{0.0470002033f, 0.641878068f},
-std::array<float,2>{0.36595428f, 0.3787027f},
-std::array<float,2>{0.754198313f, 0.778195322f},
-std::array<float,2>{0.9815799f, 0.251587838f},
-std::array<float,2>{0.429253459f, 0.917232871f},
-std::array<float,2>{0.168546617f, 0.234599143f},
-std::array<float,2>{0.616521478f, 0.616429865f},
-std::array<float,2>{0.524584651f, 0.488725543f},
-std::array<float,2>{0.187503979f, 0.815235496f},
-std::array<float,2>{0.483443171f, 0.113786221f},
-std::array<float,2>{0.898408175f, 0.736273766f},
-std::array<float,2>{0.848501682f, 0.128360078f},
-std::array<float,2>{0.285512447f, 0.51857686f},
-std::array<float,2>{0.0678422898f, 0.366219252f},
-std::array<float,2>{0.648118675f, 0.94432956f},
-std::array<float,2>{0.628977835f, 0.160027951f},
-std::array<float,2>{0.0884934515f, 0.540500104f},
-std::array<float,2>{0.305238545f, 0.338236928f},
-std::array<float,2>{0.866675138f, 0.999789655f},
-std::array<float,2>{0.888493657f, 0.440747291f},
-std::array<float,2>{0.488197625f, 0.870914817f},
-std::array<float,2>{0.215047091f, 0.080808036f},
-std::array<float,2>{0.505719066f, 0.717326045f},
-std::array<float,2>{0.599929392f, 0.30738011f},
-std::array<float,2>{0.173285604f, 0.90277195f},
-std::array<float,2>{0.417778105f, 0.204360008f},
-std::array<float,2>{0.996853769f, 0.577154636f},
-std::array<float,2>{0.767395854f, 0.0546079166f},
-std::array<float,2>{0.344985515f, 0.668005466f},
-std::array<float,2>{0.0450044051f, 0.432920575f},
-std::array<float,2>{0.734237969f, 0.790037572f},
-std::array<float,2>{0.562214196f, 0.100270271f},
-std::array<float,2>{0.246299237f, 0.720055282f},
-std::array<float,2>{0.467884421f, 0.474354714f},
-std::array<float,2>{0.919300973f, 0.840094328f},
-std::array<float,2>{0.837964237f, 0.349702269f},
-std::array<float,2>{0.2738446f, 0.95909369f},
-std::array<float,2>{0.116881281f, 0.142158821f},
-std::array<float,2>{0.667555273f, 0.501894772f},
-std::array<float,2>{0.691252351f, 0.405553192f},
-std::array<float,2>{0.00363822933f, 0.753166974f},
-std::array<float,2>{0.323096186f, 0.01708005f},
-std::array<float,2>{0.808820307f, 0.638041914f},
-std::array<float,2>{0.964764297f, 0.234145507f},
-std::array<float,2>{0.39615339f, 0.603810251f},
-std::array<float,2>{0.128410354f, 0.266541064f},
-std::array<float,2>{0.583726466f, 0.926739633f},
-std::array<float,2>{0.607931674f, 0.18272385f},
-std::array<float,2>{0.186757877f, 0.559380054f},
-std::array<float,2>{0.410010874f, 0.325529754f},
-std::array<float,2>{0.989144564f, 0.97276926f},
-std::array<float,2>{0.776806593f, 0.455801427f},
-std::array<float,2>{0.353698552f, 0.848566592f},
-std::array<float,2>{0.0379892737f, 0.0747112781f},
-std::array<float,2>{0.725011468f, 0.698708475f},
-std::array<float,2>{0.639929652f, 0.282984376f},
-std::array<float,2>{0.0851175636f, 0.881693959f},
-std::array<float,2>{0.301039815f, 0.189232275f},
-std::array<float,2>{0.868200421f, 0.58581984f},
-std::array<float,2>{0.881192029f, 0.0348082632f},
-std::array<float,2>{0.49663654f, 0.672950387f},
-std::array<float,2>{0.207687333f, 0.420965254f},
-std::array<float,2>{0.509538054f, 0.811670303f},
-std::array<float,2>{0.700002849f, 0.109833889f},
-std::array<float,2>{0.0128653347f, 0.740470409f},
-std::array<float,2>{0.316713512f, 0.487320423f},
-std::array<float,2>{0.800555408f, 0.818419516f},
-std::array<float,2>{0.95755434f, 0.362532437f},
-std::array<float,2>{0.406182647f, 0.940617561f},
-std::array<float,2>{0.137094289f, 0.130941704f},
-std::array<float,2>{0.587979794f, 0.520708978f},
-std::array<float,2>{0.55268085f, 0.382117957f},
-std::array<float,2>{0.239764974f, 0.774751365f},
-std::array<float,2>{0.453748763f, 0.0130780004f},
-std::array<float,2>{0.912928879f, 0.645772934f},
-std::array<float,2>{0.831202984f, 0.241270021f},
-std::array<float,2>{0.269817114f, 0.609700322f},
-std::array<float,2>{0.122874409f, 0.257158339f},
-std::array<float,2>{0.662795901f, 0.918469965f},
-std::array<float,2>{0.681057274f, 0.209497541f},
-std::array<float,2>{0.0957691669f, 0.57225275f},
-std::array<float,2>{0.250071168f, 0.310924143f},
-std::array<float,2>{0.816971183f, 0.899822533f},
-std::array<float,2>{0.937173605f, 0.436181337f},
-std::array<float,2>{0.44055751f, 0.795061827f},
-std::array<float,2>{0.229615763f, 0.0473883972f},
-std::array<float,2>{0.544566751f, 0.667746484f},
-std::array<float,2>{0.57227844f, 0.341798902f},
-std::array<float,2>{0.148646057f, 0.995059788f},
-std::array<float,2>{0.379230022f, 0.163967744f},
-std::array<float,2>{0.943368077f, 0.545082748f},
-std::array<float,2>{0.796307266f, 0.0857399404f},
-std::array<float,2>{0.334539026f, 0.711729586f},
-std::array<float,2>{0.0176092628f, 0.445227861f},
-std::array<float,2>{0.712666988f, 0.871836364f},
-std::array<float,2>{0.517651737f, 0.0218225662f},
-std::array<float,2>{0.196560383f, 0.63511467f},
-std::array<float,2>{0.476475745f, 0.400882274f},
-std::array<float,2>{0.904451013f, 0.756142914f},
-std::array<float,2>{0.855368197f, 0.271095544f},
-std::array<float,2>{0.296128154f, 0.924142599f},
-std::array<float,2>{0.0756894127f, 0.229390517f},
-std::array<float,2>{0.653180718f, 0.607874215f},
-std::array<float,2>{0.736133814f, 0.471634328f},
-std::array<float,2>{0.0612019971f, 0.83787173f},
-std::array<float,2>{0.370539129f, 0.0961919501f},
-std::array<float,2>{0.759293258f, 0.725622058f},
-std::array<float,2>{0.975661039f, 0.146579817f},
-std::array<float,2>{0.434720337f, 0.504532516f},
-std::array<float,2>{0.157158688f, 0.344011039f},
-std::array<float,2>{0.619877875f, 0.954781592f},
-std::array<float,2>{0.536970973f, 0.225199893f},
-std::array<float,2>{0.220926017f, 0.598947108f},
-std::array<float,2>{0.452651948f, 0.280483305f},
-std::array<float,2>{0.929082751f, 0.931005061f},
-std::array<float,2>{0.827653289f, 0.397271365f},
-std::array<float,2>{0.263347924f, 0.761659682f},
-std::array<float,2>{0.104371272f, 0.0245545581f},
-std::array<float,2>{0.672010541f, 0.625932932f},
-std::array<float,2>{0.709724247f, 0.353555501f},
-std::array<float,2>{0.0278476421f, 0.964857399f},
-std::array<float,2>{0.336696744f, 0.155161381f},
-std::array<float,2>{0.789033353f, 0.512452722f},
-std::array<float,2>{0.950220346f, 0.105133459f},
-std::array<float,2>{0.38597995f, 0.732409656f},
-std::array<float,2>{0.148007855f, 0.482486248f},
-std::array<float,2>{0.57004571f, 0.835475743f},
-std::array<float,2>{0.643583179f, 0.0551726595f},
-std::array<float,2>{0.0659150258f, 0.659823f},
-std::array<float,2>{0.28367874f, 0.42959103f},
-std::array<float,2>{0.846770763f, 0.786991775f},
-std::array<float,2>{0.891075671f, 0.298665702f},
-std::array<float,2>{0.479987562f, 0.897297978f},
-std::array<float,2>{0.195049673f, 0.217946857f},
-std::array<float,2>{0.529732108f, 0.562708855f},
-std::array<float,2>{0.611557364f, 0.451801389f},
-std::array<float,2>{0.164745718f, 0.863031745f},
-std::array<float,2>{0.422088951f, 0.0907931551f},
-std::array<float,2>{0.980358481f, 0.708536804f},
-std::array<float,2>{0.752323449f, 0.164954588f},
-std::array<float,2>{0.359567046f, 0.538926363f},
-std::array<float,2>{0.0543467104f, 0.329270154f},
-std::array<float,2>{0.748842716f, 0.986419916f},
-std::array<float,2>{0.73020649f, 0.135136247f},
-std::array<float,2>{0.0392724499f, 0.523645759f},
-std::array<float,2>{0.34855935f, 0.369610667f},
-std::array<float,2>{0.770824313f, 0.949275613f},
-std::array<float,2>{0.994672298f, 0.49891749f},
-std::array<float,2>{0.418879628f, 0.821560383f},
-std::array<float,2>{0.179641545f, 0.119752131f},
-std::array<float,2>{0.594037235f, 0.744717181f},
-std::array<float,2>{0.500280142f, 0.26113838f},
-std::array<float,2>{0.212355971f, 0.906639755f},
-std::array<float,2>{0.488623589f, 0.242491975f},
-std::array<float,2>{0.883043885f, 0.624824107f},
-std::array<float,2>{0.861560225f, 0.00676764036f},
-std::array<float,2>{0.309701562f, 0.650800943f},
-std::array<float,2>{0.093519032f, 0.384123415f},
-std::array<float,2>{0.627009332f, 0.768053412f},
-std::array<float,2>{0.578544676f, 0.063716054f},
-std::array<float,2>{0.131714702f, 0.690969646f},
-std::array<float,2>{0.392039597f, 0.467096537f},
-std::array<float,2>{0.967232227f, 0.851964176f},
-std::array<float,2>{0.808034182f, 0.316271782f},
-std::array<float,2>{0.32743305f, 0.978285432f},
-std::array<float,2>{0.00555117149f, 0.178493172f},
-std::array<float,2>{0.694464266f, 0.552520931f},
-std::array<float,2>{0.668146431f, 0.411990315f},
-std::array<float,2>{0.112918548f, 0.797969341f},
-std::array<float,2>{0.280128151f, 0.0430782214f},
-std::array<float,2>{0.841722548f, 0.685376406f},
-std::array<float,2>{0.917107701f, 0.199049428f},
-std::array<float,2>{0.463504195f, 0.587169111f},
-std::array<float,2>{0.243315756f, 0.295491159f},
-std::array<float,2>{0.555885732f, 0.884376705f},
-std::array<float,2>{0.50516361f, 0.15785943f},
-std::array<float,2>{0.21581845f, 0.542239487f},
-std::array<float,2>{0.487555265f, 0.336170554f},
-std::array<float,2>{0.888107002f, 0.998011351f},
-std::array<float,2>{0.866858006f, 0.438315272f},
-std::array<float,2>{0.304911405f, 0.86740011f},
-std::array<float,2>{0.0882839262f, 0.078481473f},
-std::array<float,2>{0.62976414f, 0.715415835f},
-std::array<float,2>{0.733474553f, 0.304790854f},
-std::array<float,2>{0.0458157174f, 0.906172216f},
-std::array<float,2>{0.345502496f, 0.206115395f},
-std::array<float,2>{0.766795993f, 0.575308204f},
-std::array<float,2>{0.996569932f, 0.0521401092f},
-std::array<float,2>{0.417079836f, 0.670282304f},
-std::array<float,2>{0.173729748f, 0.430843204f},
-std::array<float,2>{0.600528121f, 0.791224182f},
-std::array<float,2>{0.66725719f, 0.0979603752f},
-std::array<float,2>{0.116472274f, 0.722516477f},
-std::array<float,2>{0.274389088f, 0.476471215f},
-std::array<float,2>{0.838379741f, 0.842558801f},
-std::array<float,2>{0.91954416f, 0.347760022f},
-std::array<float,2>{0.468291938f, 0.958596706f},
-std::array<float,2>{0.2466629f, 0.143054664f},
-std::array<float,2>{0.561977208f, 0.503767133f},
-std::array<float,2>{0.583265185f, 0.40295738f},
-std::array<float,2>{0.12863858f, 0.750899196f},
-std::array<float,2>{0.395863146f, 0.0184711479f},
-std::array<float,2>{0.963974535f, 0.639269948f},
-std::array<float,2>{0.809285283f, 0.231739193f},
-std::array<float,2>{0.322440565f, 0.603322864f},
-std::array<float,2>{0.00319087552f, 0.267924368f},
-std::array<float,2>{0.690796375f, 0.927998602f},
-std::array<float,2>{0.704811513f, 0.191432282f},
-std::array<float,2>{0.0240511373f, 0.580869853f},
-std::array<float,2>{0.340248019f, 0.286230832f},
-std::array<float,2>{0.784680247f, 0.878114104f},
-std::array<float,2>{0.948059201f, 0.416916311f},
-std::array<float,2>{0.387492865f, 0.807228327f},
-std::array<float,2>{0.141299278f, 0.03726542f},
-std::array<float,2>{0.563458443f, 0.677822232f},
-std::array<float,2>{0.534843326f, 0.323377848f},
-std::array<float,2>{0.225529656f, 0.971598089f},
-std::array<float,2>{0.448194504f, 0.186612755f},
-std::array<float,2>{0.925439537f, 0.556230843f},
-std::array<float,2>{0.821967781f, 0.0710203424f},
-std::array<float,2>{0.260628045f, 0.701036632f},
-std::array<float,2>{0.107435592f, 0.457903355f},
-std::array<float,2>{0.677861154f, 0.844702125f},
-std::array<float,2>{0.617169738f, 0.0111509049f},
-std::array<float,2>{0.168167487f, 0.642740786f},
-std::array<float,2>{0.429145366f, 0.375641882f},
-std::array<float,2>{0.982148767f, 0.780712426f},
-std::array<float,2>{0.754438877f, 0.253485978f},
-std::array<float,2>{0.365374804f, 0.915968418f},
-std::array<float,2>{0.0476454943f, 0.23744601f},
-std::array<float,2>{0.745484114f, 0.613389969f},
-std::array<float,2>{0.647727251f, 0.491424918f},
-std::array<float,2>{0.0679624975f, 0.813933671f},
-std::array<float,2>{0.285745859f, 0.11627353f},
-std::array<float,2>{0.84809041f, 0.737876058f},
-std::array<float,2>{0.897572577f, 0.126529828f},
-std::array<float,2>{0.484282702f, 0.516170859f},
-std::array<float,2>{0.188366428f, 0.363558352f},
-std::array<float,2>{0.525139332f, 0.942089975f},
-std::array<float,2>{0.576508641f, 0.247258976f},
-std::array<float,2>{0.153985545f, 0.618996799f},
-std::array<float,2>{0.376086652f, 0.262859851f},
-std::array<float,2>{0.938599229f, 0.912879527f},
-std::array<float,2>{0.791698933f, 0.38737458f},
-std::array<float,2>{0.328521818f, 0.771751106f},
-std::array<float,2>{0.0205904804f, 0.001498912f},
-std::array<float,2>{0.718008876f, 0.655063093f},
-std::array<float,2>{0.687258482f, 0.374757528f},
-std::array<float,2>{0.0984209105f, 0.94862169f},
-std::array<float,2>{0.256523162f, 0.138736889f},
-std::array<float,2>{0.812597096f, 0.528847277f},
-std::array<float,2>{0.932636619f, 0.122492842f},
-std::array<float,2>{0.443527967f, 0.748875678f},
-std::array<float,2>{0.233539432f, 0.495939344f},
-std::array<float,2>{0.540674925f, 0.825665176f},
-std::array<float,2>{0.740735412f, 0.0413615331f},
-std::array<float,2>{0.0552878119f, 0.680118442f},
-std::array<float,2>{0.374183059f, 0.406275898f},
-std::array<float,2>{0.765455604f, 0.802217305f},
-std::array<float,2>{0.970681429f, 0.290957719f},
-std::array<float,2>{0.433510453f, 0.888529778f},
-std::array<float,2>{0.160894796f, 0.201271936f},
-std::array<float,2>{0.621152103f, 0.590767562f},
-std::array<float,2>{0.522671878f, 0.461693764f},
-std::array<float,2>{0.202054068f, 0.859275699f},
-std::array<float,2>{0.469794333f, 0.0679397583f},
-std::array<float,2>{0.900598347f, 0.692334175f},
-std::array<float,2>{0.856874585f, 0.172412157f},
-std::array<float,2>{0.290800303f, 0.550190747f},
-std::array<float,2>{0.0713708326f, 0.319704652f},
-std::array<float,2>{0.650589645f, 0.984301269f},
-std::array<float,2>{0.634121239f, 0.150590345f},
-std::array<float,2>{0.081037268f, 0.511321485f},
-std::array<float,2>{0.300222814f, 0.358258784f},
-std::array<float,2>{0.874777973f, 0.962068915f},
-std::array<float,2>{0.878664136f, 0.478614867f},
-std::array<float,2>{0.493708909f, 0.83023566f},
-std::array<float,2>{0.20577319f, 0.107105948f},
-std::array<float,2>{0.515036047f, 0.728993237f},
-std::array<float,2>{0.604620039f, 0.276312262f},
-std::array<float,2>{0.182147503f, 0.934295416f},
-std::array<float,2>{0.410704255f, 0.221144214f},
-std::array<float,2>{0.984687924f, 0.59476608f},
-std::array<float,2>{0.78031081f, 0.0307423268f},
-std::array<float,2>{0.35696587f, 0.630707681f},
-std::array<float,2>{0.034877982f, 0.393738717f},
-std::array<float,2>{0.721846879f, 0.763908565f},
-std::array<float,2>{0.547408342f, 0.088779144f},
-std::array<float,2>{0.235773891f, 0.706971407f},
-std::array<float,2>{0.460187703f, 0.44680196f},
-std::array<float,2>{0.908496737f, 0.863820732f},
-std::array<float,2>{0.832409441f, 0.334229648f},
-std::array<float,2>{0.268200785f, 0.990825593f},
-std::array<float,2>{0.12076512f, 0.169971094f},
-std::array<float,2>{0.65740329f, 0.532242715f},
-std::array<float,2>{0.698668122f, 0.422487944f},
-std::array<float,2>{0.00880587567f, 0.781356752f},
-std::array<float,2>{0.315110832f, 0.0609792955f},
-std::array<float,2>{0.803497016f, 0.66153121f},
-std::array<float,2>{0.956779003f, 0.21480155f},
-std::array<float,2>{0.399515629f, 0.570239961f},
-std::array<float,2>{0.136573434f, 0.302339524f},
-std::array<float,2>{0.593124032f, 0.890981138f},
-std::array<float,2>{0.594569981f, 0.13353239f},
-std::array<float,2>{0.179059669f, 0.526335359f},
-std::array<float,2>{0.418145269f, 0.368526995f},
-std::array<float,2>{0.994144797f, 0.952734411f},
-std::array<float,2>{0.771057725f, 0.497238159f},
-std::array<float,2>{0.348056853f, 0.823979795f},
-std::array<float,2>{0.0396792665f, 0.119074196f},
-std::array<float,2>{0.72953397f, 0.742612064f},
-std::array<float,2>{0.627905965f, 0.258822143f},
-std::array<float,2>{0.0930117294f, 0.909624636f},
-std::array<float,2>{0.310250789f, 0.244630426f},
-std::array<float,2>{0.862260044f, 0.621993959f},
-std::array<float,2>{0.883536339f, 0.00429721503f},
-std::array<float,2>{0.489014953f, 0.649052203f},
-std::array<float,2>{0.212545693f, 0.386343718f},
-std::array<float,2>{0.500879049f, 0.765806496f},
-std::array<float,2>{0.69504559f, 0.0663819164f},
-std::array<float,2>{0.00517094415f, 0.689060867f},
-std::array<float,2>{0.327672988f, 0.465558916f},
-std::array<float,2>{0.808172166f, 0.854366243f},
-std::array<float,2>{0.967667162f, 0.313334703f},
-std::array<float,2>{0.392289609f, 0.979227662f},
-std::array<float,2>{0.130895451f, 0.176052257f},
-std::array<float,2>{0.578664243f, 0.55410856f},
-std::array<float,2>{0.556279361f, 0.413594633f},
-std::array<float,2>{0.243732303f, 0.800231159f},
-std::array<float,2>{0.463290811f, 0.0456453748f},
-std::array<float,2>{0.917571902f, 0.686431825f},
-std::array<float,2>{0.840841234f, 0.197233528f},
-std::array<float,2>{0.279626936f, 0.588133812f},
-std::array<float,2>{0.112716042f, 0.294816226f},
-std::array<float,2>{0.668647945f, 0.885605752f},
-std::array<float,2>{0.672780931f, 0.222959861f},
-std::array<float,2>{0.103870712f, 0.600030601f},
-std::array<float,2>{0.262702227f, 0.278328985f},
-std::array<float,2>{0.827612221f, 0.931858003f},
-std::array<float,2>{0.929201841f, 0.395772904f},
-std::array<float,2>{0.452334434f, 0.759380579f},
-std::array<float,2>{0.221657619f, 0.0264134388f},
-std::array<float,2>{0.536229789f, 0.628723562f},
-std::array<float,2>{0.569577098f, 0.35229969f},
-std::array<float,2>{0.147853047f, 0.967085481f},
-std::array<float,2>{0.386541456f, 0.153438345f},
-std::array<float,2>{0.951134682f, 0.515086293f},
-std::array<float,2>{0.788392723f, 0.102306947f},
-std::array<float,2>{0.336253107f, 0.733612239f},
-std::array<float,2>{0.0277228244f, 0.481700867f},
-std::array<float,2>{0.709055185f, 0.833950281f},
-std::array<float,2>{0.529931843f, 0.0569224656f},
-std::array<float,2>{0.194343224f, 0.656493604f},
-std::array<float,2>{0.479798555f, 0.427535504f},
-std::array<float,2>{0.891456366f, 0.78856498f},
-std::array<float,2>{0.847650707f, 0.298894644f},
-std::array<float,2>{0.284049153f, 0.894960999f},
-std::array<float,2>{0.0661848187f, 0.216311231f},
-std::array<float,2>{0.644046485f, 0.566151261f},
-std::array<float,2>{0.748171151f, 0.450814337f},
-std::array<float,2>{0.0537397191f, 0.860906541f},
-std::array<float,2>{0.35992685f, 0.09360829f},
-std::array<float,2>{0.752787292f, 0.71084106f},
-std::array<float,2>{0.979522467f, 0.167734697f},
-std::array<float,2>{0.422424704f, 0.536607623f},
-std::array<float,2>{0.16434586f, 0.330181628f},
-std::array<float,2>{0.611906946f, 0.98617965f},
-std::array<float,2>{0.544183016f, 0.208141237f},
-std::array<float,2>{0.230103955f, 0.572749019f},
-std::array<float,2>{0.44099471f, 0.309914589f},
-std::array<float,2>{0.936798036f, 0.901940405f},
-std::array<float,2>{0.816518366f, 0.433839411f},
-std::array<float,2>{0.250973672f, 0.793577492f},
-std::array<float,2>{0.096588254f, 0.0507780686f},
-std::array<float,2>{0.681271195f, 0.664164305f},
-std::array<float,2>{0.711923838f, 0.340438575f},
-std::array<float,2>{0.0185286682f, 0.993926942f},
-std::array<float,2>{0.334050745f, 0.161398157f},
-std::array<float,2>{0.796833038f, 0.543507814f},
-std::array<float,2>{0.944263816f, 0.0825465471f},
-std::array<float,2>{0.379710585f, 0.713188052f},
-std::array<float,2>{0.149041891f, 0.442218512f},
-std::array<float,2>{0.573144555f, 0.873673677f},
-std::array<float,2>{0.652703464f, 0.0208724365f},
-std::array<float,2>{0.0756066665f, 0.634412944f},
-std::array<float,2>{0.296664804f, 0.400087327f},
-std::array<float,2>{0.854818583f, 0.755043864f},
-std::array<float,2>{0.905029118f, 0.271938145f},
-std::array<float,2>{0.476064861f, 0.922635496f},
-std::array<float,2>{0.197002262f, 0.226938501f},
-std::array<float,2>{0.51832062f, 0.605534732f},
-std::array<float,2>{0.619250357f, 0.468831003f},
-std::array<float,2>{0.156420752f, 0.839774013f},
-std::array<float,2>{0.435289413f, 0.0948257521f},
-std::array<float,2>{0.976283312f, 0.723298788f},
-std::array<float,2>{0.759020627f, 0.144893423f},
-std::array<float,2>{0.371001095f, 0.505956709f},
-std::array<float,2>{0.0607659668f, 0.345893174f},
-std::array<float,2>{0.735790074f, 0.956570685f},
-std::array<float,2>{0.725392401f, 0.180495054f},
-std::array<float,2>{0.037463516f, 0.562128186f},
-std::array<float,2>{0.35441947f, 0.327966213f},
-std::array<float,2>{0.776996315f, 0.976484537f},
-std::array<float,2>{0.988679707f, 0.453144103f},
-std::array<float,2>{0.409615457f, 0.851248741f},
-std::array<float,2>{0.187126964f, 0.0775775611f},
-std::array<float,2>{0.607645929f, 0.69585973f},
-std::array<float,2>{0.508967817f, 0.284843415f},
-std::array<float,2>{0.207515389f, 0.880539179f},
-std::array<float,2>{0.496352285f, 0.189481184f},
-std::array<float,2>{0.881721914f, 0.583922863f},
-std::array<float,2>{0.86890918f, 0.0328756459f},
-std::array<float,2>{0.301301658f, 0.673865676f},
-std::array<float,2>{0.0858587995f, 0.418904245f},
-std::array<float,2>{0.640578985f, 0.809692442f},
-std::array<float,2>{0.588594198f, 0.11231453f},
-std::array<float,2>{0.137288287f, 0.739355028f},
-std::array<float,2>{0.40571481f, 0.48596853f},
-std::array<float,2>{0.957277179f, 0.816515267f},
-std::array<float,2>{0.800065696f, 0.361197084f},
-std::array<float,2>{0.317290306f, 0.937536001f},
-std::array<float,2>{0.0135369813f, 0.130414516f},
-std::array<float,2>{0.699684799f, 0.521716595f},
-std::array<float,2>{0.662504613f, 0.378958255f},
-std::array<float,2>{0.122188814f, 0.776489913f},
-std::array<float,2>{0.270258844f, 0.0154790226f},
-std::array<float,2>{0.831884563f, 0.647280812f},
-std::array<float,2>{0.912253559f, 0.239852592f},
-std::array<float,2>{0.453237563f, 0.612982631f},
-std::array<float,2>{0.239568129f, 0.254624128f},
-std::array<float,2>{0.5520733f, 0.920399904f},
-std::array<float,2>{0.559698045f, 0.141602397f},
-std::array<float,2>{0.248826236f, 0.5012061f},
-std::array<float,2>{0.465205699f, 0.35034889f},
-std::array<float,2>{0.921260655f, 0.959534466f},
-std::array<float,2>{0.837111354f, 0.473954946f},
-std::array<float,2>{0.276483893f, 0.840484738f},
-std::array<float,2>{0.114830829f, 0.099675402f},
-std::array<float,2>{0.664244354f, 0.720362723f},
-std::array<float,2>{0.688709319f, 0.265863866f},
-std::array<float,2>{0.00159082667f, 0.926076412f},
-std::array<float,2>{0.321895301f, 0.233677f},
-std::array<float,2>{0.811670423f, 0.604231954f},
-std::array<float,2>{0.961745203f, 0.0175755043f},
-std::array<float,2>{0.397769183f, 0.638593197f},
-std::array<float,2>{0.125862956f, 0.40620622f},
-std::array<float,2>{0.585063875f, 0.753870845f},
-std::array<float,2>{0.63138324f, 0.0800932273f},
-std::array<float,2>{0.0873951465f, 0.716910839f},
-std::array<float,2>{0.308130234f, 0.44115603f},
-std::array<float,2>{0.864789069f, 0.870328128f},
-std::array<float,2>{0.889024734f, 0.338510096f},
-std::array<float,2>{0.484531492f, 0.999148011f},
-std::array<float,2>{0.218399704f, 0.15945816f},
-std::array<float,2>{0.507140398f, 0.540830195f},
-std::array<float,2>{0.598692894f, 0.433527857f},
-std::array<float,2>{0.173893854f, 0.789274573f},
-std::array<float,2>{0.414414763f, 0.0537916459f},
-std::array<float,2>{0.999382675f, 0.668654919f},
-std::array<float,2>{0.767940283f, 0.204646692f},
-std::array<float,2>{0.347512066f, 0.577793837f},
-std::array<float,2>{0.0432607606f, 0.307027161f},
-std::array<float,2>{0.730981469f, 0.902846396f},
-std::array<float,2>{0.743600726f, 0.234985799f},
-std::array<float,2>{0.0493874289f, 0.616896629f},
-std::array<float,2>{0.364721775f, 0.251445293f},
-std::array<float,2>{0.755956888f, 0.917736173f},
-std::array<float,2>{0.983968198f, 0.378355294f},
-std::array<float,2>{0.427399784f, 0.777567208f},
-std::array<float,2>{0.171570435f, 0.00944423117f},
-std::array<float,2>{0.613349438f, 0.642569363f},
-std::array<float,2>{0.525861382f, 0.367078602f},
-std::array<float,2>{0.19057107f, 0.943369985f},
-std::array<float,2>{0.481059879f, 0.128450826f},
-std::array<float,2>{0.895334601f, 0.519239247f},
-std::array<float,2>{0.85140264f, 0.11362654f},
-std::array<float,2>{0.288862199f, 0.735635519f},
-std::array<float,2>{0.0688265637f, 0.48894611f},
-std::array<float,2>{0.644630671f, 0.814483583f},
-std::array<float,2>{0.564777613f, 0.0357110202f},
-std::array<float,2>{0.142843336f, 0.67719394f},
-std::array<float,2>{0.389745861f, 0.414693862f},
-std::array<float,2>{0.945851743f, 0.804828107f},
-std::array<float,2>{0.781715095f, 0.288674414f},
-std::array<float,2>{0.343612522f, 0.876287282f},
-std::array<float,2>{0.0270062909f, 0.195040837f},
-std::array<float,2>{0.706032991f, 0.578303099f},
-std::array<float,2>{0.676129878f, 0.460659266f},
-std::array<float,2>{0.106571563f, 0.845967591f},
-std::array<float,2>{0.259128392f, 0.073023513f},
-std::array<float,2>{0.822307527f, 0.701443315f},
-std::array<float,2>{0.92221123f, 0.184985086f},
-std::array<float,2>{0.446282715f, 0.557942629f},
-std::array<float,2>{0.223716542f, 0.321067601f},
-std::array<float,2>{0.531530261f, 0.969170392f},
-std::array<float,2>{0.623416185f, 0.199501157f},
-std::array<float,2>{0.163890749f, 0.592830181f},
-std::array<float,2>{0.430733263f, 0.292198658f},
-std::array<float,2>{0.971750081f, 0.890537977f},
-std::array<float,2>{0.762656391f, 0.408585936f},
-std::array<float,2>{0.372132868f, 0.802751124f},
-std::array<float,2>{0.0569938459f, 0.039892409f},
-std::array<float,2>{0.740123034f, 0.683042288f},
-std::array<float,2>{0.649119079f, 0.316663593f},
-std::array<float,2>{0.0736484975f, 0.981039047f},
-std::array<float,2>{0.291474968f, 0.175687075f},
-std::array<float,2>{0.858183324f, 0.548030913f},
-std::array<float,2>{0.898627639f, 0.0687707886f},
-std::array<float,2>{0.471936613f, 0.694773316f},
-std::array<float,2>{0.200787991f, 0.46432218f},
-std::array<float,2>{0.519976199f, 0.855487823f},
-std::array<float,2>{0.715881109f, 0.00295011327f},
-std::array<float,2>{0.0222275574f, 0.652882099f},
-std::array<float,2>{0.330947965f, 0.389916092f},
-std::array<float,2>{0.790326834f, 0.77028501f},
-std::array<float,2>{0.940626979f, 0.264141977f},
-std::array<float,2>{0.377558112f, 0.912088752f},
-std::array<float,2>{0.155277342f, 0.249678761f},
-std::array<float,2>{0.57454741f, 0.620310366f},
-std::array<float,2>{0.542079866f, 0.493116945f},
-std::array<float,2>{0.23080337f, 0.826212287f},
-std::array<float,2>{0.44304052f, 0.123752154f},
-std::array<float,2>{0.930508673f, 0.747582376f},
-std::array<float,2>{0.815337658f, 0.136736855f},
-std::array<float,2>{0.255282432f, 0.529799044f},
-std::array<float,2>{0.101422913f, 0.371973336f},
-std::array<float,2>{0.68380028f, 0.946921647f},
-std::array<float,2>{0.659666717f, 0.16933988f},
-std::array<float,2>{0.117608942f, 0.533626914f},
-std::array<float,2>{0.266368985f, 0.332675129f},
-std::array<float,2>{0.834982336f, 0.988566816f},
-std::array<float,2>{0.907326102f, 0.448896587f},
-std::array<float,2>{0.458579689f, 0.866174996f},
-std::array<float,2>{0.237024635f, 0.0876431614f},
-std::array<float,2>{0.549626052f, 0.704878509f},
-std::array<float,2>{0.590888858f, 0.303759992f},
-std::array<float,2>{0.133048683f, 0.893304765f},
-std::array<float,2>{0.400922358f, 0.212789997f},
-std::array<float,2>{0.953216016f, 0.56695652f},
-std::array<float,2>{0.802696049f, 0.0601140372f},
-std::array<float,2>{0.313635975f, 0.663078606f},
-std::array<float,2>{0.0101996902f, 0.424171776f},
-std::array<float,2>{0.696660817f, 0.783952177f},
-std::array<float,2>{0.512350142f, 0.108676888f},
-std::array<float,2>{0.20431076f, 0.727624238f},
-std::array<float,2>{0.494631946f, 0.476642638f},
-std::array<float,2>{0.875893712f, 0.828592896f},
-std::array<float,2>{0.871743262f, 0.355530322f},
-std::array<float,2>{0.298701465f, 0.964260161f},
-std::array<float,2>{0.0782065764f, 0.14940843f},
-std::array<float,2>{0.636167705f, 0.509147346f},
-std::array<float,2>{0.719357133f, 0.391459256f},
-std::array<float,2>{0.03209126f, 0.762132525f},
-std::array<float,2>{0.358080834f, 0.0277980622f},
-std::array<float,2>{0.779233038f, 0.632752657f},
-std::array<float,2>{0.987523675f, 0.219455719f},
-std::array<float,2>{0.412440598f, 0.596809685f},
-std::array<float,2>{0.181200236f, 0.273895651f},
-std::array<float,2>{0.601840198f, 0.93602699f},
-std::array<float,2>{0.581405401f, 0.177846923f},
-std::array<float,2>{0.129796863f, 0.551784933f},
-std::array<float,2>{0.394009799f, 0.315650642f},
-std::array<float,2>{0.965778947f, 0.977547824f},
-std::array<float,2>{0.805937231f, 0.46751523f},
-std::array<float,2>{0.325007081f, 0.852051675f},
-std::array<float,2>{0.00657562958f, 0.0640516281f},
-std::array<float,2>{0.691717803f, 0.69086206f},
-std::array<float,2>{0.670247972f, 0.295109123f},
-std::array<float,2>{0.110258847f, 0.884253919f},
-std::array<float,2>{0.277614713f, 0.198713973f},
-std::array<float,2>{0.843553722f, 0.587691247f},
-std::array<float,2>{0.915908873f, 0.0438101962f},
-std::array<float,2>{0.46108076f, 0.684588432f},
-std::array<float,2>{0.244610503f, 0.411175668f},
-std::array<float,2>{0.557133257f, 0.798734963f},
-std::array<float,2>{0.727539778f, 0.119165309f},
-std::array<float,2>{0.0428485498f, 0.744169414f},
-std::array<float,2>{0.350738794f, 0.498516649f},
-std::array<float,2>{0.773090601f, 0.821855783f},
-std::array<float,2>{0.993748546f, 0.369718671f},
-std::array<float,2>{0.420656085f, 0.950086236f},
-std::array<float,2>{0.176206321f, 0.135467783f},
-std::array<float,2>{0.59705174f, 0.524214387f},
-std::array<float,2>{0.502452791f, 0.384429574f},
-std::array<float,2>{0.213396356f, 0.768144548f},
-std::array<float,2>{0.49167946f, 0.00597202592f},
-std::array<float,2>{0.885617614f, 0.65133363f},
-std::array<float,2>{0.85973233f, 0.242848054f},
-std::array<float,2>{0.311726898f, 0.624047756f},
-std::array<float,2>{0.0908772647f, 0.261518896f},
-std::array<float,2>{0.62545985f, 0.906947672f},
-std::array<float,2>{0.640928626f, 0.218276992f},
-std::array<float,2>{0.063478373f, 0.563447237f},
-std::array<float,2>{0.282067597f, 0.298102647f},
-std::array<float,2>{0.845440865f, 0.896913171f},
-std::array<float,2>{0.893236935f, 0.428757459f},
-std::array<float,2>{0.477425784f, 0.786570251f},
-std::array<float,2>{0.193152562f, 0.0556301624f},
-std::array<float,2>{0.529177606f, 0.659658134f},
-std::array<float,2>{0.611147523f, 0.329943538f},
-std::array<float,2>{0.166537702f, 0.986902475f},
-std::array<float,2>{0.424584538f, 0.164267331f},
-std::array<float,2>{0.977187157f, 0.538270772f},
-std::array<float,2>{0.751234949f, 0.0899611488f},
-std::array<float,2>{0.361599177f, 0.708224952f},
-std::array<float,2>{0.0524435453f, 0.451183289f},
-std::array<float,2>{0.746681929f, 0.862496853f},
-std::array<float,2>{0.537335277f, 0.0249100588f},
-std::array<float,2>{0.219113097f, 0.625404119f},
-std::array<float,2>{0.449873388f, 0.396722257f},
-std::array<float,2>{0.926319838f, 0.760788441f},
-std::array<float,2>{0.824964225f, 0.281199276f},
-std::array<float,2>{0.264413655f, 0.931297421f},
-std::array<float,2>{0.101900049f, 0.224744722f},
-std::array<float,2>{0.673871398f, 0.599235356f},
-std::array<float,2>{0.708755791f, 0.483269811f},
-std::array<float,2>{0.0299170315f, 0.835401893f},
-std::array<float,2>{0.339029938f, 0.104680941f},
-std::array<float,2>{0.785448313f, 0.731749058f},
-std::array<float,2>{0.951699734f, 0.154371113f},
-std::array<float,2>{0.383733392f, 0.511870027f},
-std::array<float,2>{0.145217851f, 0.354306906f},
-std::array<float,2>{0.567395568f, 0.965785265f},
-std::array<float,2>{0.516907752f, 0.228749171f},
-std::array<float,2>{0.197741956f, 0.608062446f},
-std::array<float,2>{0.47382462f, 0.27080676f},
-std::array<float,2>{0.903800726f, 0.924522579f},
-std::array<float,2>{0.85220331f, 0.40078333f},
-std::array<float,2>{0.293735176f, 0.756827474f},
-std::array<float,2>{0.0766396224f, 0.0220123697f},
-std::array<float,2>{0.654769182f, 0.635644734f},
-std::array<float,2>{0.737950683f, 0.344687045f},
-std::array<float,2>{0.0587982386f, 0.954514384f},
-std::array<float,2>{0.367879927f, 0.147037789f},
-std::array<float,2>{0.760542214f, 0.504191101f},
-std::array<float,2>{0.973903537f, 0.096186474f},
-std::array<float,2>{0.436158657f, 0.726301968f},
-std::array<float,2>{0.159376115f, 0.470829606f},
-std::array<float,2>{0.618099928f, 0.837308705f},
-std::array<float,2>{0.682843089f, 0.0473578796f},
-std::array<float,2>{0.0943123102f, 0.667331159f},
-std::array<float,2>{0.253099322f, 0.435650945f},
-std::array<float,2>{0.818746209f, 0.795885384f},
-std::array<float,2>{0.934397638f, 0.311501473f},
-std::array<float,2>{0.437989533f, 0.90010339f},
-std::array<float,2>{0.228303343f, 0.209084883f},
-std::array<float,2>{0.546304762f, 0.571391761f},
-std::array<float,2>{0.572122693f, 0.444571137f},
-std::array<float,2>{0.150744587f, 0.871491075f},
-std::array<float,2>{0.381330222f, 0.0851961896f},
-std::array<float,2>{0.942230344f, 0.711073339f},
-std::array<float,2>{0.793154478f, 0.163259387f},
-std::array<float,2>{0.332590818f, 0.545535445f},
-std::array<float,2>{0.0170739293f, 0.342542768f},
-std::array<float,2>{0.713190377f, 0.994385183f},
-std::array<float,2>{0.701830029f, 0.131627768f},
-std::array<float,2>{0.0152777908f, 0.521321774f},
-std::array<float,2>{0.320245683f, 0.363068402f},
-std::array<float,2>{0.798788905f, 0.941399813f},
-std::array<float,2>{0.959600091f, 0.487854749f},
-std::array<float,2>{0.403951854f, 0.819039524f},
-std::array<float,2>{0.14004457f, 0.110330127f},
-std::array<float,2>{0.587495446f, 0.741044998f},
-std::array<float,2>{0.553320408f, 0.257701427f},
-std::array<float,2>{0.241574794f, 0.918456376f},
-std::array<float,2>{0.455427468f, 0.241982356f},
-std::array<float,2>{0.911703229f, 0.610191584f},
-std::array<float,2>{0.828835428f, 0.0134117734f},
-std::array<float,2>{0.273274302f, 0.646433115f},
-std::array<float,2>{0.123931371f, 0.382731646f},
-std::array<float,2>{0.661845446f, 0.775356948f},
-std::array<float,2>{0.605681896f, 0.0742603913f},
-std::array<float,2>{0.184075803f, 0.699033678f},
-std::array<float,2>{0.407752603f, 0.455427319f},
-std::array<float,2>{0.991200149f, 0.847870648f},
-std::array<float,2>{0.775051773f, 0.326029927f},
-std::array<float,2>{0.351885557f, 0.97319144f},
-std::array<float,2>{0.0362663828f, 0.183432415f},
-std::array<float,2>{0.723454297f, 0.558932185f},
-std::array<float,2>{0.637806892f, 0.421854615f},
-std::array<float,2>{0.0829716176f, 0.812346637f},
-std::array<float,2>{0.304480821f, 0.0342097655f},
-std::array<float,2>{0.869691968f, 0.673754275f},
-std::array<float,2>{0.879166901f, 0.188824981f},
-std::array<float,2>{0.499211878f, 0.585055172f},
-std::array<float,2>{0.209189594f, 0.28266716f},
-std::array<float,2>{0.51090157f, 0.881221294f},
-std::array<float,2>{0.532453656f, 0.186179996f},
-std::array<float,2>{0.223218739f, 0.555202067f},
-std::array<float,2>{0.446773916f, 0.323170364f},
-std::array<float,2>{0.923158944f, 0.972615302f},
-std::array<float,2>{0.824124157f, 0.45845893f},
-std::array<float,2>{0.258161545f, 0.845442653f},
-std::array<float,2>{0.105608836f, 0.0716164485f},
-std::array<float,2>{0.677102864f, 0.699987829f},
-std::array<float,2>{0.706126988f, 0.285378873f},
-std::array<float,2>{0.0256543662f, 0.877363682f},
-std::array<float,2>{0.34259066f, 0.193087995f},
-std::array<float,2>{0.782613814f, 0.581874669f},
-std::array<float,2>{0.946776807f, 0.0387354828f},
-std::array<float,2>{0.389144927f, 0.679605007f},
-std::array<float,2>{0.144262776f, 0.417478532f},
-std::array<float,2>{0.566287458f, 0.808211029f},
-std::array<float,2>{0.646313548f, 0.115764469f},
-std::array<float,2>{0.0697901323f, 0.736745656f},
-std::array<float,2>{0.287189364f, 0.491105467f},
-std::array<float,2>{0.849807918f, 0.813134789f},
-std::array<float,2>{0.895575106f, 0.364866018f},
-std::array<float,2>{0.482106388f, 0.942792714f},
-std::array<float,2>{0.190403193f, 0.125745684f},
-std::array<float,2>{0.527267456f, 0.516650975f},
-std::array<float,2>{0.61484468f, 0.376862228f},
-std::array<float,2>{0.170889691f, 0.779855728f},
-std::array<float,2>{0.42669782f, 0.0105963815f},
-std::array<float,2>{0.983168364f, 0.644365013f},
-std::array<float,2>{0.757668257f, 0.23661764f},
-std::array<float,2>{0.364252299f, 0.614787161f},
-std::array<float,2>{0.0504343659f, 0.252818614f},
-std::array<float,2>{0.742303014f, 0.914396346f},
-std::array<float,2>{0.731990159f, 0.205803394f},
-std::array<float,2>{0.0444034971f, 0.574994385f},
-std::array<float,2>{0.346526176f, 0.306165963f},
-std::array<float,2>{0.769296587f, 0.904692769f},
-std::array<float,2>{0.998149693f, 0.430000812f},
-std::array<float,2>{0.415183663f, 0.792792022f},
-std::array<float,2>{0.175028577f, 0.0509049222f},
-std::array<float,2>{0.598333359f, 0.67158711f},
-std::array<float,2>{0.506189942f, 0.337156057f},
-std::array<float,2>{0.21703425f, 0.996850193f},
-std::array<float,2>{0.485965878f, 0.156404018f},
-std::array<float,2>{0.889924169f, 0.541286707f},
-std::array<float,2>{0.863294721f, 0.0791894868f},
-std::array<float,2>{0.306796998f, 0.716232717f},
-std::array<float,2>{0.0860950574f, 0.439373255f},
-std::array<float,2>{0.631982684f, 0.86847806f},
-std::array<float,2>{0.584826112f, 0.0185593963f},
-std::array<float,2>{0.126726523f, 0.640204072f},
-std::array<float,2>{0.397105515f, 0.404184967f},
-std::array<float,2>{0.962195694f, 0.751760662f},
-std::array<float,2>{0.811457157f, 0.26886642f},
-std::array<float,2>{0.321120471f, 0.929585218f},
-std::array<float,2>{0.000227881625f, 0.230794951f},
-std::array<float,2>{0.688151002f, 0.601909578f},
-std::array<float,2>{0.66543752f, 0.475030184f},
-std::array<float,2>{0.113666885f, 0.843557954f},
-std::array<float,2>{0.276068091f, 0.0990638956f},
-std::array<float,2>{0.83681953f, 0.721356332f},
-std::array<float,2>{0.920493186f, 0.144207031f},
-std::array<float,2>{0.466766328f, 0.502610087f},
-std::array<float,2>{0.249432161f, 0.349184692f},
-std::array<float,2>{0.558660507f, 0.957928717f},
-std::array<float,2>{0.603478014f, 0.222554415f},
-std::array<float,2>{0.179701969f, 0.594321847f},
-std::array<float,2>{0.413149029f, 0.276388437f},
-std::array<float,2>{0.986440718f, 0.935433269f},
-std::array<float,2>{0.77792418f, 0.392596602f},
-std::array<float,2>{0.358608633f, 0.765297174f},
-std::array<float,2>{0.0323748998f, 0.0301305912f},
-std::array<float,2>{0.720511019f, 0.62895453f},
-std::array<float,2>{0.635614574f, 0.358722001f},
-std::array<float,2>{0.0797370747f, 0.961661875f},
-std::array<float,2>{0.297123462f, 0.151686043f},
-std::array<float,2>{0.872177958f, 0.509881914f},
-std::array<float,2>{0.876331508f, 0.105573379f},
-std::array<float,2>{0.49599278f, 0.729924083f},
-std::array<float,2>{0.203360841f, 0.480188787f},
-std::array<float,2>{0.513223767f, 0.831134498f},
-std::array<float,2>{0.696232378f, 0.0620453209f},
-std::array<float,2>{0.0108568855f, 0.660873532f},
-std::array<float,2>{0.313465655f, 0.423265159f},
-std::array<float,2>{0.800782621f, 0.782310605f},
-std::array<float,2>{0.95486933f, 0.301698059f},
-std::array<float,2>{0.401514769f, 0.891971231f},
-std::array<float,2>{0.134008572f, 0.213033304f},
-std::array<float,2>{0.590479016f, 0.569177926f},
-std::array<float,2>{0.550095141f, 0.445872575f},
-std::array<float,2>{0.237643003f, 0.864500761f},
-std::array<float,2>{0.457515955f, 0.0898272991f},
-std::array<float,2>{0.907092035f, 0.70586282f},
-std::array<float,2>{0.834680319f, 0.171638802f},
-std::array<float,2>{0.267343909f, 0.532094717f},
-std::array<float,2>{0.118417881f, 0.335889757f},
-std::array<float,2>{0.658728242f, 0.991995215f},
-std::array<float,2>{0.685355484f, 0.14033474f},
-std::array<float,2>{0.099760063f, 0.528055966f},
-std::array<float,2>{0.254218698f, 0.373975039f},
-std::array<float,2>{0.815662205f, 0.948055148f},
-std::array<float,2>{0.931133807f, 0.494726986f},
-std::array<float,2>{0.441407382f, 0.825184643f},
-std::array<float,2>{0.23192209f, 0.121304505f},
-std::array<float,2>{0.541498363f, 0.74930805f},
-std::array<float,2>{0.575694382f, 0.261855096f},
-std::array<float,2>{0.154877856f, 0.91312778f},
-std::array<float,2>{0.378670126f, 0.246401206f},
-std::array<float,2>{0.940324962f, 0.61809808f},
-std::array<float,2>{0.789349139f, 5.78920408e-05f},
-std::array<float,2>{0.3313694f, 0.65535599f},
-std::array<float,2>{0.0225251969f, 0.387984425f},
-std::array<float,2>{0.715190411f, 0.772803843f},
-std::array<float,2>{0.521416366f, 0.0667946488f},
-std::array<float,2>{0.199525461f, 0.692869067f},
-std::array<float,2>{0.471340686f, 0.461931884f},
-std::array<float,2>{0.900203526f, 0.85765636f},
-std::array<float,2>{0.858725786f, 0.319179446f},
-std::array<float,2>{0.29209581f, 0.983305216f},
-std::array<float,2>{0.0723639876f, 0.173633128f},
-std::array<float,2>{0.649671078f, 0.549272239f},
-std::array<float,2>{0.738309026f, 0.407917857f},
-std::array<float,2>{0.0580914021f, 0.801026106f},
-std::array<float,2>{0.371872634f, 0.0429563969f},
-std::array<float,2>{0.762854457f, 0.681287587f},
-std::array<float,2>{0.971117556f, 0.202976018f},
-std::array<float,2>{0.430219978f, 0.590926707f},
-std::array<float,2>{0.162576348f, 0.289408535f},
-std::array<float,2>{0.624208927f, 0.886801898f},
-std::array<float,2>{0.566518962f, 0.15234445f},
-std::array<float,2>{0.146343619f, 0.513940215f},
-std::array<float,2>{0.384746581f, 0.352619559f},
-std::array<float,2>{0.95261097f, 0.968297064f},
-std::array<float,2>{0.786742151f, 0.481203794f},
-std::array<float,2>{0.33883068f, 0.832155228f},
-std::array<float,2>{0.0303085111f, 0.10307207f},
-std::array<float,2>{0.707653165f, 0.732643127f},
-std::array<float,2>{0.67491734f, 0.277683973f},
-std::array<float,2>{0.102647126f, 0.932651639f},
-std::array<float,2>{0.265110493f, 0.224054247f},
-std::array<float,2>{0.825327098f, 0.601480007f},
-std::array<float,2>{0.927023768f, 0.0254395343f},
-std::array<float,2>{0.4509359f, 0.627007186f},
-std::array<float,2>{0.220457584f, 0.394750178f},
-std::array<float,2>{0.538113773f, 0.758566201f},
-std::array<float,2>{0.747787952f, 0.0926949605f},
-std::array<float,2>{0.051722426f, 0.709420323f},
-std::array<float,2>{0.363016605f, 0.449232727f},
-std::array<float,2>{0.750831187f, 0.859407485f},
-std::array<float,2>{0.97823447f, 0.331853598f},
-std::array<float,2>{0.425267845f, 0.98508364f},
-std::array<float,2>{0.16768162f, 0.166910157f},
-std::array<float,2>{0.609732032f, 0.535916507f},
-std::array<float,2>{0.52820617f, 0.426689595f},
-std::array<float,2>{0.191982746f, 0.787860274f},
-std::array<float,2>{0.47799474f, 0.0581840351f},
-std::array<float,2>{0.894467354f, 0.657635152f},
-std::array<float,2>{0.844175875f, 0.2156239f},
-std::array<float,2>{0.282706738f, 0.564567268f},
-std::array<float,2>{0.0633486956f, 0.299884856f},
-std::array<float,2>{0.64235419f, 0.895716965f},
-std::array<float,2>{0.626685679f, 0.245713219f},
-std::array<float,2>{0.0899856836f, 0.622250974f},
-std::array<float,2>{0.310654193f, 0.257831603f},
-std::array<float,2>{0.860478044f, 0.908939838f},
-std::array<float,2>{0.88621664f, 0.385088116f},
-std::array<float,2>{0.491074592f, 0.766718745f},
-std::array<float,2>{0.214424282f, 0.00499256281f},
-std::array<float,2>{0.503744066f, 0.650209486f},
-std::array<float,2>{0.596549511f, 0.367868721f},
-std::array<float,2>{0.17684257f, 0.951601028f},
-std::array<float,2>{0.421654016f, 0.13445498f},
-std::array<float,2>{0.992491424f, 0.526707172f},
-std::array<float,2>{0.77212292f, 0.11811278f},
-std::array<float,2>{0.349929363f, 0.743685365f},
-std::array<float,2>{0.0418437719f, 0.496351123f},
-std::array<float,2>{0.726676345f, 0.822346985f},
-std::array<float,2>{0.558144391f, 0.0465522707f},
-std::array<float,2>{0.245730713f, 0.687028885f},
-std::array<float,2>{0.462275624f, 0.412749559f},
-std::array<float,2>{0.914394617f, 0.799250126f},
-std::array<float,2>{0.842502296f, 0.293777883f},
-std::array<float,2>{0.27921918f, 0.886263788f},
-std::array<float,2>{0.110611543f, 0.195768997f},
-std::array<float,2>{0.671168089f, 0.589465678f},
-std::array<float,2>{0.69267565f, 0.465924412f},
-std::array<float,2>{0.00779281929f, 0.855237365f},
-std::array<float,2>{0.325866252f, 0.0645482913f},
-std::array<float,2>{0.805275321f, 0.688290119f},
-std::array<float,2>{0.966172457f, 0.176875144f},
-std::array<float,2>{0.392873377f, 0.553457618f},
-std::array<float,2>{0.130772784f, 0.313568592f},
-std::array<float,2>{0.580574572f, 0.979737997f},
-std::array<float,2>{0.510705948f, 0.190862134f},
-std::array<float,2>{0.210330576f, 0.582410812f},
-std::array<float,2>{0.498226106f, 0.283707321f},
-std::array<float,2>{0.879957497f, 0.879317343f},
-std::array<float,2>{0.870373011f, 0.419315308f},
-std::array<float,2>{0.302776456f, 0.809221745f},
-std::array<float,2>{0.0838380903f, 0.0315851234f},
-std::array<float,2>{0.637332976f, 0.675318241f},
-std::array<float,2>{0.72456342f, 0.326524168f},
-std::array<float,2>{0.0359283499f, 0.974871099f},
-std::array<float,2>{0.353464156f, 0.181513935f},
-std::array<float,2>{0.773658991f, 0.560702026f},
-std::array<float,2>{0.991976082f, 0.0768530965f},
-std::array<float,2>{0.40672341f, 0.696937442f},
-std::array<float,2>{0.184838265f, 0.454726756f},
-std::array<float,2>{0.607261062f, 0.849665225f},
-std::array<float,2>{0.660225213f, 0.0146411536f},
-std::array<float,2>{0.124391824f, 0.647797465f},
-std::array<float,2>{0.271844447f, 0.380680859f},
-std::array<float,2>{0.829691172f, 0.77586484f},
-std::array<float,2>{0.911076665f, 0.255414248f},
-std::array<float,2>{0.456519663f, 0.921630085f},
-std::array<float,2>{0.240353376f, 0.238898009f},
-std::array<float,2>{0.554037392f, 0.611564755f},
-std::array<float,2>{0.586432159f, 0.485019416f},
-std::array<float,2>{0.139572814f, 0.817632258f},
-std::array<float,2>{0.402397931f, 0.11206425f},
-std::array<float,2>{0.960313737f, 0.738800704f},
-std::array<float,2>{0.797249019f, 0.129869327f},
-std::array<float,2>{0.318585992f, 0.522892118f},
-std::array<float,2>{0.0137551706f, 0.359947264f},
-std::array<float,2>{0.703088462f, 0.939196408f},
-std::array<float,2>{0.714814901f, 0.160883069f},
-std::array<float,2>{0.0165166892f, 0.544637918f},
-std::array<float,2>{0.333854586f, 0.341523588f},
-std::array<float,2>{0.794776261f, 0.992816627f},
-std::array<float,2>{0.94259721f, 0.443202704f},
-std::array<float,2>{0.382127345f, 0.874146521f},
-std::array<float,2>{0.152140796f, 0.0835933089f},
-std::array<float,2>{0.57039243f, 0.714823246f},
-std::array<float,2>{0.545027196f, 0.309243172f},
-std::array<float,2>{0.227211148f, 0.901002467f},
-std::array<float,2>{0.438646704f, 0.207586914f},
-std::array<float,2>{0.934733748f, 0.573451161f},
-std::array<float,2>{0.820115387f, 0.0496664569f},
-std::array<float,2>{0.252415776f, 0.665592194f},
-std::array<float,2>{0.0947790667f, 0.434962958f},
-std::array<float,2>{0.682417274f, 0.794340312f},
-std::array<float,2>{0.618932366f, 0.0944782868f},
-std::array<float,2>{0.158911914f, 0.723714054f},
-std::array<float,2>{0.437206745f, 0.470372677f},
-std::array<float,2>{0.973342896f, 0.838035762f},
-std::array<float,2>{0.761560857f, 0.346876651f},
-std::array<float,2>{0.368667364f, 0.955915511f},
-std::array<float,2>{0.060044989f, 0.1462605f},
-std::array<float,2>{0.736999691f, 0.507663131f},
-std::array<float,2>{0.655575395f, 0.399322957f},
-std::array<float,2>{0.0773076713f, 0.754687667f},
-std::array<float,2>{0.294668317f, 0.0198633634f},
-std::array<float,2>{0.853501141f, 0.633092463f},
-std::array<float,2>{0.902400792f, 0.227987587f},
-std::array<float,2>{0.473185331f, 0.607405961f},
-std::array<float,2>{0.199199393f, 0.273225397f},
-std::array<float,2>{0.516362369f, 0.923649132f},
-std::array<float,2>{0.523855925f, 0.127810046f},
-std::array<float,2>{0.189119533f, 0.518390417f},
-std::array<float,2>{0.482782185f, 0.36597234f},
-std::array<float,2>{0.897039473f, 0.944634616f},
-std::array<float,2>{0.849022686f, 0.489290476f},
-std::array<float,2>{0.286717087f, 0.816354096f},
-std::array<float,2>{0.0666753873f, 0.114391357f},
-std::array<float,2>{0.647152126f, 0.734837353f},
-std::array<float,2>{0.744692981f, 0.25051719f},
-std::array<float,2>{0.0478602201f, 0.916313648f},
-std::array<float,2>{0.366286963f, 0.236043766f},
-std::array<float,2>{0.755567789f, 0.61596638f},
-std::array<float,2>{0.980763674f, 0.00781716127f},
-std::array<float,2>{0.428550839f, 0.641510427f},
-std::array<float,2>{0.169130683f, 0.37716499f},
-std::array<float,2>{0.615386546f, 0.77928853f},
-std::array<float,2>{0.678862393f, 0.0741346702f},
-std::array<float,2>{0.108430676f, 0.702557802f},
-std::array<float,2>{0.261095345f, 0.459230751f},
-std::array<float,2>{0.820467353f, 0.847082913f},
-std::array<float,2>{0.924782097f, 0.322040886f},
-std::array<float,2>{0.448812038f, 0.970012069f},
-std::array<float,2>{0.22614561f, 0.184414223f},
-std::array<float,2>{0.534150958f, 0.557043374f},
-std::array<float,2>{0.564320028f, 0.415426344f},
-std::array<float,2>{0.141962662f, 0.805768251f},
-std::array<float,2>{0.387924969f, 0.0362912603f},
-std::array<float,2>{0.948442101f, 0.675955355f},
-std::array<float,2>{0.783476591f, 0.193704024f},
-std::array<float,2>{0.34167552f, 0.579200268f},
-std::array<float,2>{0.0252065063f, 0.287698746f},
-std::array<float,2>{0.703816354f, 0.87548089f},
-std::array<float,2>{0.68967104f, 0.23289068f},
-std::array<float,2>{0.00279369624f, 0.605413616f},
-std::array<float,2>{0.323283345f, 0.266879618f},
-std::array<float,2>{0.810019314f, 0.927693903f},
-std::array<float,2>{0.963840544f, 0.404777795f},
-std::array<float,2>{0.394627839f, 0.752672851f},
-std::array<float,2>{0.127021194f, 0.0158817545f},
-std::array<float,2>{0.582073092f, 0.637579918f},
-std::array<float,2>{0.560780346f, 0.35154745f},
-std::array<float,2>{0.247764185f, 0.960183322f},
-std::array<float,2>{0.467383623f, 0.141304404f},
-std::array<float,2>{0.918513119f, 0.500341356f},
-std::array<float,2>{0.838875175f, 0.100927927f},
-std::array<float,2>{0.274797976f, 0.719233096f},
-std::array<float,2>{0.115387477f, 0.473209351f},
-std::array<float,2>{0.666792512f, 0.841257393f},
-std::array<float,2>{0.600666881f, 0.0529488362f},
-std::array<float,2>{0.172504112f, 0.669003308f},
-std::array<float,2>{0.416362405f, 0.431946754f},
-std::array<float,2>{0.997558773f, 0.790558636f},
-std::array<float,2>{0.766183853f, 0.307946742f},
-std::array<float,2>{0.344104528f, 0.903707206f},
-std::array<float,2>{0.0461070612f, 0.204075575f},
-std::array<float,2>{0.733323634f, 0.576306224f},
-std::array<float,2>{0.630169332f, 0.439778298f},
-std::array<float,2>{0.0894942954f, 0.869724751f},
-std::array<float,2>{0.306222826f, 0.0814859495f},
-std::array<float,2>{0.865458369f, 0.718038499f},
-std::array<float,2>{0.887270808f, 0.15899694f},
-std::array<float,2>{0.486390829f, 0.540011406f},
-std::array<float,2>{0.216264248f, 0.338889569f},
-std::array<float,2>{0.504537046f, 0.99822551f},
-std::array<float,2>{0.592491329f, 0.211311892f},
-std::array<float,2>{0.134993136f, 0.567624331f},
-std::array<float,2>{0.399340093f, 0.303212583f},
-std::array<float,2>{0.955889821f, 0.893636107f},
-std::array<float,2>{0.804292083f, 0.425012589f},
-std::array<float,2>{0.315579265f, 0.784282207f},
-std::array<float,2>{0.0080899233f, 0.0593458526f},
-std::array<float,2>{0.69792527f, 0.663860977f},
-std::array<float,2>{0.656268179f, 0.333398908f},
-std::array<float,2>{0.119322151f, 0.98966372f},
-std::array<float,2>{0.268576264f, 0.168720394f},
-std::array<float,2>{0.833022833f, 0.534671009f},
-std::array<float,2>{0.91002661f, 0.0868533328f},
-std::array<float,2>{0.459935755f, 0.703608274f},
-std::array<float,2>{0.234700456f, 0.447783321f},
-std::array<float,2>{0.548462152f, 0.866418719f},
-std::array<float,2>{0.721632838f, 0.028327506f},
-std::array<float,2>{0.0337631442f, 0.631585121f},
-std::array<float,2>{0.355808645f, 0.392443806f},
-std::array<float,2>{0.779988647f, 0.762714684f},
-std::array<float,2>{0.985876143f, 0.274710774f},
-std::array<float,2>{0.411615938f, 0.936964035f},
-std::array<float,2>{0.183030561f, 0.220698401f},
-std::array<float,2>{0.604296684f, 0.596428394f},
-std::array<float,2>{0.513686121f, 0.478163362f},
-std::array<float,2>{0.206518933f, 0.830065608f},
-std::array<float,2>{0.492895275f, 0.107858799f},
-std::array<float,2>{0.877759218f, 0.726945043f},
-std::array<float,2>{0.873203218f, 0.149571344f},
-std::array<float,2>{0.299664915f, 0.508332431f},
-std::array<float,2>{0.0811347961f, 0.357221633f},
-std::array<float,2>{0.633471608f, 0.963280201f},
-std::array<float,2>{0.652110577f, 0.174295157f},
-std::array<float,2>{0.071040675f, 0.54748553f},
-std::array<float,2>{0.289817691f, 0.318060756f},
-std::array<float,2>{0.855614841f, 0.981775463f},
-std::array<float,2>{0.901648998f, 0.463609606f},
-std::array<float,2>{0.469621927f, 0.857235193f},
-std::array<float,2>{0.202676609f, 0.0699672922f},
-std::array<float,2>{0.522176385f, 0.694050193f},
-std::array<float,2>{0.622575819f, 0.291568875f},
-std::array<float,2>{0.162083745f, 0.889282405f},
-std::array<float,2>{0.432414591f, 0.200463504f},
-std::array<float,2>{0.968825996f, 0.59183085f},
-std::array<float,2>{0.763869703f, 0.0400604121f},
-std::array<float,2>{0.374013186f, 0.682432234f},
-std::array<float,2>{0.0562644638f, 0.409497559f},
-std::array<float,2>{0.742174804f, 0.804007232f},
-std::array<float,2>{0.539075434f, 0.124200724f},
-std::array<float,2>{0.232968882f, 0.746974468f},
-std::array<float,2>{0.444682091f, 0.49338761f},
-std::array<float,2>{0.932319224f, 0.828086555f},
-std::array<float,2>{0.813938379f, 0.372086525f},
-std::array<float,2>{0.257128537f, 0.945738137f},
-std::array<float,2>{0.0990376621f, 0.138504997f},
-std::array<float,2>{0.686127245f, 0.530759156f},
-std::array<float,2>{0.717602611f, 0.389638454f},
-std::array<float,2>{0.0199864674f, 0.77071768f},
-std::array<float,2>{0.329209417f, 0.00209575822f},
-std::array<float,2>{0.792076409f, 0.653533697f},
-std::array<float,2>{0.93826735f, 0.248153925f},
-std::array<float,2>{0.375024796f, 0.620075703f},
-std::array<float,2>{0.152456805f, 0.265497059f},
-std::array<float,2>{0.578035712f, 0.910578609f},
-std::array<float,2>{0.612340033f, 0.165930033f},
-std::array<float,2>{0.165151775f, 0.53711307f},
-std::array<float,2>{0.423719674f, 0.328861356f},
-std::array<float,2>{0.978593588f, 0.988225639f},
-std::array<float,2>{0.75375545f, 0.452532917f},
-std::array<float,2>{0.360833824f, 0.861876011f},
-std::array<float,2>{0.0532795042f, 0.0913305953f},
-std::array<float,2>{0.749072194f, 0.70747155f},
-std::array<float,2>{0.642849088f, 0.297167689f},
-std::array<float,2>{0.0644579306f, 0.897874951f},
-std::array<float,2>{0.284761012f, 0.216873646f},
-std::array<float,2>{0.845775008f, 0.563935101f},
-std::array<float,2>{0.891917467f, 0.0559549071f},
-std::array<float,2>{0.478925616f, 0.658804774f},
-std::array<float,2>{0.194037467f, 0.427783936f},
-std::array<float,2>{0.5306409f, 0.78522265f},
-std::array<float,2>{0.710092306f, 0.103892498f},
-std::array<float,2>{0.0287901964f, 0.730812609f},
-std::array<float,2>{0.337584585f, 0.483507156f},
-std::array<float,2>{0.787813663f, 0.834565759f},
-std::array<float,2>{0.94949764f, 0.354993463f},
-std::array<float,2>{0.385620773f, 0.966045618f},
-std::array<float,2>{0.14679651f, 0.155553475f},
-std::array<float,2>{0.569285929f, 0.513392508f},
-std::array<float,2>{0.536111236f, 0.39751938f},
-std::array<float,2>{0.222182512f, 0.760691106f},
-std::array<float,2>{0.451741666f, 0.0236113369f},
-std::array<float,2>{0.92794174f, 0.626582801f},
-std::array<float,2>{0.826764405f, 0.22640796f},
-std::array<float,2>{0.261913866f, 0.598255098f},
-std::array<float,2>{0.104594007f, 0.27930516f},
-std::array<float,2>{0.673122644f, 0.930405855f},
-std::array<float,2>{0.669634163f, 0.197636589f},
-std::array<float,2>{0.111621454f, 0.58650136f},
-std::array<float,2>{0.281236559f, 0.296749443f},
-std::array<float,2>{0.840249479f, 0.883306623f},
-std::array<float,2>{0.916695654f, 0.410223633f},
-std::array<float,2>{0.46434474f, 0.79710108f},
-std::array<float,2>{0.242937103f, 0.0442347378f},
-std::array<float,2>{0.554869056f, 0.683699787f},
-std::array<float,2>{0.579443038f, 0.315367907f},
-std::array<float,2>{0.13199693f, 0.976771176f},
-std::array<float,2>{0.390923023f, 0.179649249f},
-std::array<float,2>{0.968684375f, 0.551333547f},
-std::array<float,2>{0.806732297f, 0.0628953278f},
-std::array<float,2>{0.326304287f, 0.689681649f},
-std::array<float,2>{0.00464934716f, 0.468209147f},
-std::array<float,2>{0.693986595f, 0.852953017f},
-std::array<float,2>{0.50147438f, 0.00728949346f},
-std::array<float,2>{0.211094245f, 0.652169943f},
-std::array<float,2>{0.489925861f, 0.383431941f},
-std::array<float,2>{0.88454026f, 0.768992066f},
-std::array<float,2>{0.862774014f, 0.260498792f},
-std::array<float,2>{0.308896273f, 0.907895267f},
-std::array<float,2>{0.0923699364f, 0.243458137f},
-std::array<float,2>{0.628591478f, 0.624022603f},
-std::array<float,2>{0.728798807f, 0.499149531f},
-std::array<float,2>{0.0403563529f, 0.821124971f},
-std::array<float,2>{0.348913312f, 0.12049637f},
-std::array<float,2>{0.769744337f, 0.745195568f},
-std::array<float,2>{0.995593607f, 0.136548415f},
-std::array<float,2>{0.419883668f, 0.524487674f},
-std::array<float,2>{0.178285867f, 0.370533049f},
-std::array<float,2>{0.59478426f, 0.950367987f},
-std::array<float,2>{0.550894201f, 0.240947902f},
-std::array<float,2>{0.239113078f, 0.610896707f},
-std::array<float,2>{0.454188168f, 0.256812513f},
-std::array<float,2>{0.913738549f, 0.919806361f},
-std::array<float,2>{0.83100456f, 0.381531477f},
-std::array<float,2>{0.271115273f, 0.774036229f},
-std::array<float,2>{0.12189573f, 0.0126038799f},
-std::array<float,2>{0.663539708f, 0.644575953f},
-std::array<float,2>{0.701087415f, 0.361585319f},
-std::array<float,2>{0.0122263124f, 0.939677835f},
-std::array<float,2>{0.317480445f, 0.132308573f},
-std::array<float,2>{0.799340665f, 0.519815862f},
-std::array<float,2>{0.958606124f, 0.111062691f},
-std::array<float,2>{0.404911309f, 0.741675138f},
-std::array<float,2>{0.138177514f, 0.486446708f},
-std::array<float,2>{0.589375496f, 0.82026422f},
-std::array<float,2>{0.639579535f, 0.0339362063f},
-std::array<float,2>{0.084522292f, 0.672173977f},
-std::array<float,2>{0.302659571f, 0.420649886f},
-std::array<float,2>{0.867961466f, 0.811246216f},
-std::array<float,2>{0.882786751f, 0.282141179f},
-std::array<float,2>{0.497256458f, 0.882674158f},
-std::array<float,2>{0.208287984f, 0.187636003f},
-std::array<float,2>{0.508198678f, 0.584257126f},
-std::array<float,2>{0.609298885f, 0.456841558f},
-std::array<float,2>{0.186313123f, 0.849401116f},
-std::array<float,2>{0.409114599f, 0.07613267f},
-std::array<float,2>{0.989740431f, 0.69780314f},
-std::array<float,2>{0.775860369f, 0.182536662f},
-std::array<float,2>{0.355032444f, 0.560308456f},
-std::array<float,2>{0.0384262949f, 0.324778736f},
-std::array<float,2>{0.726082265f, 0.973890364f},
-std::array<float,2>{0.73494494f, 0.147914559f},
-std::array<float,2>{0.0621883087f, 0.505348086f},
-std::array<float,2>{0.369273156f, 0.345455527f},
-std::array<float,2>{0.757816136f, 0.953712106f},
-std::array<float,2>{0.974846959f, 0.472318202f},
-std::array<float,2>{0.433791608f, 0.83630836f},
-std::array<float,2>{0.15736717f, 0.0974490196f},
-std::array<float,2>{0.620343745f, 0.725174189f},
-std::array<float,2>{0.518920004f, 0.270168513f},
-std::array<float,2>{0.19585368f, 0.925018191f},
-std::array<float,2>{0.475375086f, 0.229862109f},
-std::array<float,2>{0.906218886f, 0.60851413f},
-std::array<float,2>{0.854075909f, 0.0225792415f},
-std::array<float,2>{0.295418859f, 0.635884523f},
-std::array<float,2>{0.0748635605f, 0.401885331f},
-std::array<float,2>{0.654008985f, 0.757237315f},
-std::array<float,2>{0.573703587f, 0.0839918107f},
-std::array<float,2>{0.150191873f, 0.712058067f},
-std::array<float,2>{0.380331576f, 0.443518341f},
-std::array<float,2>{0.944711864f, 0.872476757f},
-std::array<float,2>{0.795563757f, 0.34317857f},
-std::array<float,2>{0.335816413f, 0.995339632f},
-std::array<float,2>{0.0189774148f, 0.162565753f},
-std::array<float,2>{0.711372674f, 0.546302199f},
-std::array<float,2>{0.680387437f, 0.437350005f},
-std::array<float,2>{0.0968554318f, 0.796355128f},
-std::array<float,2>{0.251565427f, 0.0483975485f},
-std::array<float,2>{0.818310678f, 0.666231513f},
-std::array<float,2>{0.936034739f, 0.21080634f},
-std::array<float,2>{0.439916015f, 0.570993841f},
-std::array<float,2>{0.228743657f, 0.311803371f},
-std::array<float,2>{0.543917775f, 0.898823142f},
-std::array<float,2>{0.509354711f, 0.181195676f},
-std::array<float,2>{0.207824349f, 0.560920715f},
-std::array<float,2>{0.497008592f, 0.326236486f},
-std::array<float,2>{0.881101787f, 0.974767089f},
-std::array<float,2>{0.86845094f, 0.455039054f},
-std::array<float,2>{0.300784051f, 0.849863052f},
-std::array<float,2>{0.0853047296f, 0.0769617558f},
-std::array<float,2>{0.639701664f, 0.697067678f},
-std::array<float,2>{0.724732578f, 0.28395614f},
-std::array<float,2>{0.0377170108f, 0.878927648f},
-std::array<float,2>{0.353760779f, 0.190546021f},
-std::array<float,2>{0.776568115f, 0.582227707f},
-std::array<float,2>{0.988985419f, 0.031493172f},
-std::array<float,2>{0.409869611f, 0.675685167f},
-std::array<float,2>{0.186914444f, 0.418990761f},
-std::array<float,2>{0.608299851f, 0.809500098f},
-std::array<float,2>{0.662902355f, 0.111895695f},
-std::array<float,2>{0.122771889f, 0.7392506f},
-std::array<float,2>{0.269689918f, 0.485196888f},
-std::array<float,2>{0.831462681f, 0.817556322f},
-std::array<float,2>{0.912665069f, 0.360194981f},
-std::array<float,2>{0.45407477f, 0.939379871f},
-std::array<float,2>{0.240223527f, 0.129590526f},
-std::array<float,2>{0.552391648f, 0.522672951f},
-std::array<float,2>{0.58833909f, 0.380420685f},
-std::array<float,2>{0.136862844f, 0.775605857f},
-std::array<float,2>{0.405926228f, 0.0141676813f},
-std::array<float,2>{0.958003461f, 0.647673905f},
-std::array<float,2>{0.800448179f, 0.239072427f},
-std::array<float,2>{0.316553503f, 0.611648917f},
-std::array<float,2>{0.0131516205f, 0.255664378f},
-std::array<float,2>{0.699906111f, 0.921750128f},
-std::array<float,2>{0.712460816f, 0.207920194f},
-std::array<float,2>{0.0179156139f, 0.573699653f},
-std::array<float,2>{0.334933847f, 0.309569836f},
-std::array<float,2>{0.79591608f, 0.90125227f},
-std::array<float,2>{0.943643987f, 0.434788406f},
-std::array<float,2>{0.379024953f, 0.794018567f},
-std::array<float,2>{0.148838148f, 0.0493847281f},
-std::array<float,2>{0.572513282f, 0.666004002f},
-std::array<float,2>{0.544794858f, 0.341758519f},
-std::array<float,2>{0.229888648f, 0.993096888f},
-std::array<float,2>{0.440793604f, 0.161104336f},
-std::array<float,2>{0.937337756f, 0.544854939f},
-std::array<float,2>{0.817332149f, 0.0837652311f},
-std::array<float,2>{0.250317425f, 0.71436888f},
-std::array<float,2>{0.0960484594f, 0.442881733f},
-std::array<float,2>{0.680817068f, 0.874466181f},
-std::array<float,2>{0.61971122f, 0.0195381083f},
-std::array<float,2>{0.156795979f, 0.63289243f},
-std::array<float,2>{0.434840679f, 0.398949474f},
-std::array<float,2>{0.976016462f, 0.754566133f},
-std::array<float,2>{0.759545743f, 0.272980005f},
-std::array<float,2>{0.370195508f, 0.92349422f},
-std::array<float,2>{0.0614702404f, 0.227765143f},
-std::array<float,2>{0.735945761f, 0.607164264f},
-std::array<float,2>{0.652961552f, 0.470491439f},
-std::array<float,2>{0.0761461258f, 0.838310361f},
-std::array<float,2>{0.296318322f, 0.0946284682f},
-std::array<float,2>{0.855138123f, 0.723986566f},
-std::array<float,2>{0.904784918f, 0.146118775f},
-std::array<float,2>{0.476103634f, 0.507524312f},
-std::array<float,2>{0.196521029f, 0.347000331f},
-std::array<float,2>{0.51783371f, 0.955613077f},
-std::array<float,2>{0.570076883f, 0.223693877f},
-std::array<float,2>{0.148394793f, 0.601076603f},
-std::array<float,2>{0.386033237f, 0.277569652f},
-std::array<float,2>{0.950534105f, 0.93304044f},
-std::array<float,2>{0.788593113f, 0.394863158f},
-std::array<float,2>{0.336517513f, 0.758313537f},
-std::array<float,2>{0.0282865968f, 0.0256859399f},
-std::array<float,2>{0.709557176f, 0.627314031f},
-std::array<float,2>{0.67232126f, 0.352951318f},
-std::array<float,2>{0.104122423f, 0.968560398f},
-std::array<float,2>{0.263522863f, 0.152785063f},
-std::array<float,2>{0.828009725f, 0.513776958f},
-std::array<float,2>{0.928899884f, 0.103504017f},
-std::array<float,2>{0.452894211f, 0.732753634f},
-std::array<float,2>{0.221134275f, 0.481163204f},
-std::array<float,2>{0.53663969f, 0.832347989f},
-std::array<float,2>{0.748723805f, 0.0584179349f},
-std::array<float,2>{0.0545312874f, 0.657238066f},
-std::array<float,2>{0.359748572f, 0.426499814f},
-std::array<float,2>{0.75208056f, 0.787760019f},
-std::array<float,2>{0.980124772f, 0.300206035f},
-std::array<float,2>{0.422216117f, 0.895877361f},
-std::array<float,2>{0.165009439f, 0.215346619f},
-std::array<float,2>{0.611676574f, 0.564724147f},
-std::array<float,2>{0.529401362f, 0.449692219f},
-std::array<float,2>{0.195134312f, 0.859802127f},
-std::array<float,2>{0.480249733f, 0.0923269838f},
-std::array<float,2>{0.890742362f, 0.709090233f},
-std::array<float,2>{0.847086906f, 0.166697145f},
-std::array<float,2>{0.283246458f, 0.535787821f},
-std::array<float,2>{0.0654610917f, 0.33178404f},
-std::array<float,2>{0.64385879f, 0.985337615f},
-std::array<float,2>{0.627239168f, 0.134667858f},
-std::array<float,2>{0.0934242159f, 0.526571393f},
-std::array<float,2>{0.309909523f, 0.36809811f},
-std::array<float,2>{0.861742079f, 0.951221824f},
-std::array<float,2>{0.883129239f, 0.496167541f},
-std::array<float,2>{0.488347143f, 0.822520792f},
-std::array<float,2>{0.212094784f, 0.11788708f},
-std::array<float,2>{0.5000965f, 0.744118512f},
-std::array<float,2>{0.593924999f, 0.25820151f},
-std::array<float,2>{0.179234877f, 0.908813238f},
-std::array<float,2>{0.418576002f, 0.245915353f},
-std::array<float,2>{0.994879544f, 0.622442842f},
-std::array<float,2>{0.77065438f, 0.00533003081f},
-std::array<float,2>{0.348252326f, 0.649998426f},
-std::array<float,2>{0.0395267941f, 0.384961963f},
-std::array<float,2>{0.730356216f, 0.766850591f},
-std::array<float,2>{0.555912495f, 0.0647532567f},
-std::array<float,2>{0.243553832f, 0.688212812f},
-std::array<float,2>{0.463831276f, 0.466267854f},
-std::array<float,2>{0.917270303f, 0.855099857f},
-std::array<float,2>{0.841505706f, 0.313775331f},
-std::array<float,2>{0.279815644f, 0.979578972f},
-std::array<float,2>{0.113279611f, 0.177192271f},
-std::array<float,2>{0.668350518f, 0.5536443f},
-std::array<float,2>{0.694629669f, 0.4130238f},
-std::array<float,2>{0.00578222098f, 0.79897964f},
-std::array<float,2>{0.327335387f, 0.0468037464f},
-std::array<float,2>{0.80769527f, 0.687388957f},
-std::array<float,2>{0.966834188f, 0.195437789f},
-std::array<float,2>{0.391650647f, 0.589709878f},
-std::array<float,2>{0.131430164f, 0.293520927f},
-std::array<float,2>{0.578318238f, 0.886475325f},
-std::array<float,2>{0.605196893f, 0.151579857f},
-std::array<float,2>{0.181868762f, 0.510030329f},
-std::array<float,2>{0.410366267f, 0.35849297f},
-std::array<float,2>{0.98508805f, 0.961862326f},
-std::array<float,2>{0.780955255f, 0.480386555f},
-std::array<float,2>{0.356752813f, 0.831517756f},
-std::array<float,2>{0.0345925651f, 0.105945177f},
-std::array<float,2>{0.722313464f, 0.729560018f},
-std::array<float,2>{0.634760737f, 0.276661307f},
-std::array<float,2>{0.080322206f, 0.93511796f},
-std::array<float,2>{0.300731748f, 0.222332239f},
-std::array<float,2>{0.874364316f, 0.594523787f},
-std::array<float,2>{0.878277183f, 0.0298044439f},
-std::array<float,2>{0.493340284f, 0.629177392f},
-std::array<float,2>{0.205131039f, 0.392845422f},
-std::array<float,2>{0.515165031f, 0.765543044f},
-std::array<float,2>{0.698818266f, 0.0894690081f},
-std::array<float,2>{0.00961071532f, 0.705701292f},
-std::array<float,2>{0.314687192f, 0.446198046f},
-std::array<float,2>{0.803018391f, 0.864649236f},
-std::array<float,2>{0.956298053f, 0.33545199f},
-std::array<float,2>{0.40006274f, 0.991703153f},
-std::array<float,2>{0.135930866f, 0.171477854f},
-std::array<float,2>{0.593369544f, 0.531909525f},
-std::array<float,2>{0.547332644f, 0.422970563f},
-std::array<float,2>{0.236230522f, 0.782675385f},
-std::array<float,2>{0.46079579f, 0.0624070093f},
-std::array<float,2>{0.908928037f, 0.660908639f},
-std::array<float,2>{0.832582712f, 0.213260695f},
-std::array<float,2>{0.267787486f, 0.56895107f},
-std::array<float,2>{0.120411366f, 0.301325738f},
-std::array<float,2>{0.657984018f, 0.891810536f},
-std::array<float,2>{0.686750352f, 0.246288091f},
-std::array<float,2>{0.0980606154f, 0.61771512f},
-std::array<float,2>{0.256018519f, 0.262011021f},
-std::array<float,2>{0.813080192f, 0.913568616f},
-std::array<float,2>{0.933391154f, 0.387751132f},
-std::array<float,2>{0.44412747f, 0.772462606f},
-std::array<float,2>{0.234285176f, 0.00029524439f},
-std::array<float,2>{0.540142059f, 0.655722737f},
-std::array<float,2>{0.576941669f, 0.373549759f},
-std::array<float,2>{0.153465495f, 0.94797641f},
-std::array<float,2>{0.376896441f, 0.140562072f},
-std::array<float,2>{0.9393664f, 0.528092086f},
-std::array<float,2>{0.791081131f, 0.121406674f},
-std::array<float,2>{0.329000652f, 0.749195516f},
-std::array<float,2>{0.0212121718f, 0.495010525f},
-std::array<float,2>{0.718583822f, 0.824802816f},
-std::array<float,2>{0.523360252f, 0.0425338335f},
-std::array<float,2>{0.201495856f, 0.681554019f},
-std::array<float,2>{0.470229924f, 0.408137083f},
-std::array<float,2>{0.901157379f, 0.800819039f},
-std::array<float,2>{0.856959343f, 0.28906396f},
-std::array<float,2>{0.290502936f, 0.886993408f},
-std::array<float,2>{0.072172448f, 0.202720776f},
-std::array<float,2>{0.651341975f, 0.591188669f},
-std::array<float,2>{0.740636468f, 0.462340057f},
-std::array<float,2>{0.0549179018f, 0.857907891f},
-std::array<float,2>{0.374580443f, 0.0666140616f},
-std::array<float,2>{0.764961779f, 0.69251579f},
-std::array<float,2>{0.969953179f, 0.173460275f},
-std::array<float,2>{0.432683229f, 0.549063146f},
-std::array<float,2>{0.160560355f, 0.318958879f},
-std::array<float,2>{0.621720731f, 0.983016789f},
-std::array<float,2>{0.534486771f, 0.193219706f},
-std::array<float,2>{0.224962845f, 0.581543088f},
-std::array<float,2>{0.447394937f, 0.285403401f},
-std::array<float,2>{0.924978495f, 0.877129555f},
-std::array<float,2>{0.821646988f, 0.417117953f},
-std::array<float,2>{0.259985179f, 0.808474004f},
-std::array<float,2>{0.10810411f, 0.0388751999f},
-std::array<float,2>{0.67859453f, 0.679385304f},
-std::array<float,2>{0.704369247f, 0.322901368f},
-std::array<float,2>{0.0235494431f, 0.972183824f},
-std::array<float,2>{0.340343505f, 0.186301708f},
-std::array<float,2>{0.784543931f, 0.555478096f},
-std::array<float,2>{0.947359681f, 0.0714200065f},
-std::array<float,2>{0.386955053f, 0.699760139f},
-std::array<float,2>{0.140657753f, 0.458065629f},
-std::array<float,2>{0.562873125f, 0.845501959f},
-std::array<float,2>{0.648378253f, 0.0103170015f},
-std::array<float,2>{0.0675655156f, 0.644047081f},
-std::array<float,2>{0.285375774f, 0.376557499f},
-std::array<float,2>{0.848251939f, 0.780126154f},
-std::array<float,2>{0.898167968f, 0.252480835f},
-std::array<float,2>{0.483738482f, 0.914224505f},
-std::array<float,2>{0.187777266f, 0.236546829f},
-std::array<float,2>{0.52489531f, 0.615154624f},
-std::array<float,2>{0.616395414f, 0.490797848f},
-std::array<float,2>{0.168804482f, 0.813316762f},
-std::array<float,2>{0.429656059f, 0.116115086f},
-std::array<float,2>{0.98183924f, 0.736558318f},
-std::array<float,2>{0.7540856f, 0.125538796f},
-std::array<float,2>{0.366029203f, 0.517077684f},
-std::array<float,2>{0.0471929163f, 0.365104586f},
-std::array<float,2>{0.745811284f, 0.942489028f},
-std::array<float,2>{0.73395288f, 0.156559363f},
-std::array<float,2>{0.0453018248f, 0.541185021f},
-std::array<float,2>{0.344781995f, 0.337266952f},
-std::array<float,2>{0.767252028f, 0.996649742f},
-std::array<float,2>{0.996694326f, 0.439061373f},
-std::array<float,2>{0.41749227f, 0.868181586f},
-std::array<float,2>{0.173072144f, 0.0794798732f},
-std::array<float,2>{0.599637628f, 0.715958714f},
-std::array<float,2>{0.50555861f, 0.306452423f},
-std::array<float,2>{0.215112537f, 0.904382885f},
-std::array<float,2>{0.487990826f, 0.205881774f},
-std::array<float,2>{0.888422608f, 0.574950337f},
-std::array<float,2>{0.86635077f, 0.0511757173f},
-std::array<float,2>{0.305441022f, 0.671753943f},
-std::array<float,2>{0.0887296349f, 0.429812312f},
-std::array<float,2>{0.629336894f, 0.792670071f},
-std::array<float,2>{0.583790779f, 0.0987363309f},
-std::array<float,2>{0.128155932f, 0.721615255f},
-std::array<float,2>{0.396342039f, 0.474685222f},
-std::array<float,2>{0.964550853f, 0.843261838f},
-std::array<float,2>{0.809031069f, 0.349488229f},
-std::array<float,2>{0.322841853f, 0.957615793f},
-std::array<float,2>{0.00385646173f, 0.144360065f},
-std::array<float,2>{0.691047668f, 0.502868831f},
-std::array<float,2>{0.667752862f, 0.403913766f},
-std::array<float,2>{0.117017537f, 0.751470983f},
-std::array<float,2>{0.273507535f, 0.0189401712f},
-std::array<float,2>{0.838218987f, 0.640549183f},
-std::array<float,2>{0.919017434f, 0.230534464f},
-std::array<float,2>{0.468192697f, 0.601581216f},
-std::array<float,2>{0.246377781f, 0.26858744f},
-std::array<float,2>{0.562436342f, 0.929352522f},
-std::array<float,2>{0.553020597f, 0.13199392f},
-std::array<float,2>{0.241781279f, 0.519752324f},
-std::array<float,2>{0.45577392f, 0.361495763f},
-std::array<float,2>{0.911476791f, 0.93978399f},
-std::array<float,2>{0.8282547f, 0.486743063f},
-std::array<float,2>{0.272524297f, 0.819909453f},
-std::array<float,2>{0.123342134f, 0.111310929f},
-std::array<float,2>{0.661441565f, 0.741270661f},
-std::array<float,2>{0.701241851f, 0.256502211f},
-std::array<float,2>{0.0148173133f, 0.91953963f},
-std::array<float,2>{0.319419026f, 0.241105646f},
-std::array<float,2>{0.798323333f, 0.611291409f},
-std::array<float,2>{0.959289253f, 0.0122453878f},
-std::array<float,2>{0.403453678f, 0.644807279f},
-std::array<float,2>{0.14054665f, 0.381660372f},
-std::array<float,2>{0.587081909f, 0.774413228f},
-std::array<float,2>{0.638500631f, 0.0757284239f},
-std::array<float,2>{0.0820726007f, 0.698164046f},
-std::array<float,2>{0.304191858f, 0.456611097f},
-std::array<float,2>{0.869268298f, 0.849261999f},
-std::array<float,2>{0.879695833f, 0.325192541f},
-std::array<float,2>{0.49987343f, 0.973719001f},
-std::array<float,2>{0.20981653f, 0.182199106f},
-std::array<float,2>{0.511384547f, 0.560202718f},
-std::array<float,2>{0.606321752f, 0.420718491f},
-std::array<float,2>{0.184545144f, 0.81151849f},
-std::array<float,2>{0.407466054f, 0.0337512381f},
-std::array<float,2>{0.99069804f, 0.67188257f},
-std::array<float,2>{0.774453104f, 0.187868476f},
-std::array<float,2>{0.352404535f, 0.584145069f},
-std::array<float,2>{0.036991518f, 0.281919032f},
-std::array<float,2>{0.722881079f, 0.882416427f},
-std::array<float,2>{0.737316847f, 0.229664147f},
-std::array<float,2>{0.0591683686f, 0.608673751f},
-std::array<float,2>{0.36760059f, 0.27028808f},
-std::array<float,2>{0.759815395f, 0.92505604f},
-std::array<float,2>{0.974239945f, 0.402118117f},
-std::array<float,2>{0.435924232f, 0.756938219f},
-std::array<float,2>{0.159888908f, 0.0227328558f},
-std::array<float,2>{0.617396355f, 0.636064231f},
-std::array<float,2>{0.517533123f, 0.345656246f},
-std::array<float,2>{0.197886407f, 0.9540627f},
-std::array<float,2>{0.474173158f, 0.147592917f},
-std::array<float,2>{0.904078543f, 0.505057275f},
-std::array<float,2>{0.851681173f, 0.0973687991f},
-std::array<float,2>{0.293429822f, 0.725363374f},
-std::array<float,2>{0.0766666681f, 0.472603619f},
-std::array<float,2>{0.654948533f, 0.836176932f},
-std::array<float,2>{0.571525931f, 0.0487100855f},
-std::array<float,2>{0.151339248f, 0.666388333f},
-std::array<float,2>{0.381709844f, 0.437187135f},
-std::array<float,2>{0.941479504f, 0.7959705f},
-std::array<float,2>{0.793873966f, 0.311581105f},
-std::array<float,2>{0.332299322f, 0.898567855f},
-std::array<float,2>{0.0174064245f, 0.210563898f},
-std::array<float,2>{0.71348387f, 0.57123822f},
-std::array<float,2>{0.683473468f, 0.443674862f},
-std::array<float,2>{0.0939421654f, 0.872265875f},
-std::array<float,2>{0.253640175f, 0.0843925029f},
-std::array<float,2>{0.81916815f, 0.712282181f},
-std::array<float,2>{0.933926761f, 0.16225113f},
-std::array<float,2>{0.437656462f, 0.546043694f},
-std::array<float,2>{0.22792533f, 0.342890441f},
-std::array<float,2>{0.546835423f, 0.995451987f},
-std::array<float,2>{0.610684156f, 0.217044935f},
-std::array<float,2>{0.166035369f, 0.563506901f},
-std::array<float,2>{0.424095303f, 0.296897143f},
-std::array<float,2>{0.976853132f, 0.89761734f},
-std::array<float,2>{0.751655281f, 0.428144008f},
-std::array<float,2>{0.362015814f, 0.785549343f},
-std::array<float,2>{0.051823616f, 0.0558711104f},
-std::array<float,2>{0.746400595f, 0.659141302f},
-std::array<float,2>{0.641582727f, 0.328746647f},
-std::array<float,2>{0.0640532598f, 0.987893403f},
-std::array<float,2>{0.281513005f, 0.165727451f},
-std::array<float,2>{0.844833255f, 0.537354946f},
-std::array<float,2>{0.893050551f, 0.0917352289f},
-std::array<float,2>{0.476685226f, 0.707170784f},
-std::array<float,2>{0.192568094f, 0.45234558f},
-std::array<float,2>{0.528707802f, 0.862144411f},
-std::array<float,2>{0.708120286f, 0.0238347277f},
-std::array<float,2>{0.0295513347f, 0.626921237f},
-std::array<float,2>{0.339737713f, 0.397775263f},
-std::array<float,2>{0.785974264f, 0.760365069f},
-std::array<float,2>{0.95163697f, 0.279589325f},
-std::array<float,2>{0.383033127f, 0.930432081f},
-std::array<float,2>{0.14459677f, 0.22625722f},
-std::array<float,2>{0.568275928f, 0.598595738f},
-std::array<float,2>{0.537984133f, 0.483874142f},
-std::array<float,2>{0.219437346f, 0.834865391f},
-std::array<float,2>{0.449639469f, 0.103558116f},
-std::array<float,2>{0.92601192f, 0.73047781f},
-std::array<float,2>{0.824629724f, 0.155354962f},
-std::array<float,2>{0.263759196f, 0.513454199f},
-std::array<float,2>{0.102100343f, 0.355410278f},
-std::array<float,2>{0.674578488f, 0.966195405f},
-std::array<float,2>{0.67073977f, 0.179259852f},
-std::array<float,2>{0.109469697f, 0.551637769f},
-std::array<float,2>{0.277982056f, 0.315047383f},
-std::array<float,2>{0.843053401f, 0.976998448f},
-std::array<float,2>{0.91539222f, 0.467794657f},
-std::array<float,2>{0.461680412f, 0.85258466f},
-std::array<float,2>{0.244740948f, 0.0627054125f},
-std::array<float,2>{0.556734204f, 0.689776301f},
-std::array<float,2>{0.581857622f, 0.296391904f},
-std::array<float,2>{0.129276574f, 0.883570433f},
-std::array<float,2>{0.394480586f, 0.197376221f},
-std::array<float,2>{0.96532774f, 0.586680532f},
-std::array<float,2>{0.806374609f, 0.0439936817f},
-std::array<float,2>{0.324427485f, 0.684000432f},
-std::array<float,2>{0.00626284769f, 0.410428375f},
-std::array<float,2>{0.692274511f, 0.797236562f},
-std::array<float,2>{0.502246141f, 0.120180525f},
-std::array<float,2>{0.213095561f, 0.74546802f},
-std::array<float,2>{0.492050827f, 0.499342114f},
-std::array<float,2>{0.885037065f, 0.820860028f},
-std::array<float,2>{0.860277057f, 0.370307356f},
-std::array<float,2>{0.312346041f, 0.950662732f},
-std::array<float,2>{0.0915091336f, 0.136254519f},
-std::array<float,2>{0.625656366f, 0.524894774f},
-std::array<float,2>{0.728139937f, 0.383607f},
-std::array<float,2>{0.0422313958f, 0.768731058f},
-std::array<float,2>{0.351145446f, 0.00700056506f},
-std::array<float,2>{0.772538006f, 0.652079821f},
-std::array<float,2>{0.993463099f, 0.243214533f},
-std::array<float,2>{0.420043707f, 0.623548865f},
-std::array<float,2>{0.1765569f, 0.260407835f},
-std::array<float,2>{0.597374678f, 0.908100724f},
-std::array<float,2>{0.59139514f, 0.168475613f},
-std::array<float,2>{0.133369729f, 0.535068929f},
-std::array<float,2>{0.400632948f, 0.333238631f},
-std::array<float,2>{0.953791797f, 0.989338875f},
-std::array<float,2>{0.801932931f, 0.448150337f},
-std::array<float,2>{0.314257771f, 0.866508245f},
-std::array<float,2>{0.0104318392f, 0.0865033343f},
-std::array<float,2>{0.697049618f, 0.703185856f},
-std::array<float,2>{0.660066664f, 0.30290395f},
-std::array<float,2>{0.117717057f, 0.8938241f},
-std::array<float,2>{0.265821695f, 0.211011723f},
-std::array<float,2>{0.835708022f, 0.567697823f},
-std::array<float,2>{0.907776713f, 0.0591452047f},
-std::array<float,2>{0.458114624f, 0.663689733f},
-std::array<float,2>{0.236333072f, 0.425228566f},
-std::array<float,2>{0.549227655f, 0.784589529f},
-std::array<float,2>{0.719055057f, 0.107641935f},
-std::array<float,2>{0.0312512666f, 0.72660321f},
-std::array<float,2>{0.357524395f, 0.478480726f},
-std::array<float,2>{0.778375626f, 0.829745471f},
-std::array<float,2>{0.988194346f, 0.357123256f},
-std::array<float,2>{0.413064271f, 0.963122547f},
-std::array<float,2>{0.180958271f, 0.14985916f},
-std::array<float,2>{0.602526367f, 0.508603096f},
-std::array<float,2>{0.511928499f, 0.392251462f},
-std::array<float,2>{0.204821929f, 0.763059139f},
-std::array<float,2>{0.494363338f, 0.0287051834f},
-std::array<float,2>{0.87503165f, 0.631780565f},
-std::array<float,2>{0.871302366f, 0.220439658f},
-std::array<float,2>{0.297983825f, 0.596497297f},
-std::array<float,2>{0.0789616555f, 0.274501532f},
-std::array<float,2>{0.636303544f, 0.936565459f},
-std::array<float,2>{0.648812771f, 0.200376332f},
-std::array<float,2>{0.0740230083f, 0.592111051f},
-std::array<float,2>{0.291844815f, 0.291798502f},
-std::array<float,2>{0.857747018f, 0.889452398f},
-std::array<float,2>{0.898937225f, 0.409378827f},
-std::array<float,2>{0.472410053f, 0.803810239f},
-std::array<float,2>{0.200617462f, 0.0404613577f},
-std::array<float,2>{0.52018553f, 0.682229757f},
-std::array<float,2>{0.623981833f, 0.318255126f},
-std::array<float,2>{0.163569883f, 0.981550217f},
-std::array<float,2>{0.431578517f, 0.173991933f},
-std::array<float,2>{0.972642899f, 0.547818244f},
-std::array<float,2>{0.761929393f, 0.0702849403f},
-std::array<float,2>{0.372850984f, 0.694261849f},
-std::array<float,2>{0.057259284f, 0.463823646f},
-std::array<float,2>{0.739553094f, 0.857061565f},
-std::array<float,2>{0.542881846f, 0.00240972848f},
-std::array<float,2>{0.231050983f, 0.65357554f},
-std::array<float,2>{0.442475796f, 0.389369756f},
-std::array<float,2>{0.929985881f, 0.770966947f},
-std::array<float,2>{0.814515471f, 0.265292972f},
-std::array<float,2>{0.255508035f, 0.910216928f},
-std::array<float,2>{0.100886606f, 0.248352244f},
-std::array<float,2>{0.684519887f, 0.619778574f},
-std::array<float,2>{0.716321468f, 0.493519068f},
-std::array<float,2>{0.0215591937f, 0.827835143f},
-std::array<float,2>{0.330385208f, 0.124349222f},
-std::array<float,2>{0.790606022f, 0.746594429f},
-std::array<float,2>{0.941040933f, 0.13841629f},
-std::array<float,2>{0.377283096f, 0.53050667f},
-std::array<float,2>{0.155819327f, 0.372374743f},
-std::array<float,2>{0.574966073f, 0.945409238f},
-std::array<float,2>{0.526219428f, 0.236167714f},
-std::array<float,2>{0.191281378f, 0.61610806f},
-std::array<float,2>{0.480750263f, 0.250868231f},
-std::array<float,2>{0.894885004f, 0.916235566f},
-std::array<float,2>{0.850737989f, 0.377411902f},
-std::array<float,2>{0.28831315f, 0.779032111f},
-std::array<float,2>{0.0688728467f, 0.0081437761f},
-std::array<float,2>{0.645336747f, 0.641262472f},
-std::array<float,2>{0.743944108f, 0.365862995f},
-std::array<float,2>{0.0488461889f, 0.944522917f},
-std::array<float,2>{0.365110219f, 0.127564847f},
-std::array<float,2>{0.756547987f, 0.518134892f},
-std::array<float,2>{0.983516574f, 0.11462009f},
-std::array<float,2>{0.427229494f, 0.734584749f},
-std::array<float,2>{0.17096062f, 0.489604026f},
-std::array<float,2>{0.613776267f, 0.816105068f},
-std::array<float,2>{0.676605642f, 0.0364673883f},
-std::array<float,2>{0.107242942f, 0.676029325f},
-std::array<float,2>{0.259327561f, 0.415231407f},
-std::array<float,2>{0.822946131f, 0.805952311f},
-std::array<float,2>{0.922620654f, 0.288084626f},
-std::array<float,2>{0.445499152f, 0.875226378f},
-std::array<float,2>{0.224367559f, 0.19350329f},
-std::array<float,2>{0.531881809f, 0.579455853f},
-std::array<float,2>{0.565295935f, 0.459220082f},
-std::array<float,2>{0.143463045f, 0.846688688f},
-std::array<float,2>{0.390430599f, 0.07391119f},
-std::array<float,2>{0.945485413f, 0.70230782f},
-std::array<float,2>{0.781966567f, 0.184291318f},
-std::array<float,2>{0.343197376f, 0.556781411f},
-std::array<float,2>{0.0266705099f, 0.321789742f},
-std::array<float,2>{0.705127597f, 0.969780147f},
-std::array<float,2>{0.688978076f, 0.141507626f},
-std::array<float,2>{0.00123026513f, 0.500193894f},
-std::array<float,2>{0.32169053f, 0.351095527f},
-std::array<float,2>{0.812357306f, 0.960366607f},
-std::array<float,2>{0.961009383f, 0.473418117f},
-std::array<float,2>{0.398277044f, 0.841061831f},
-std::array<float,2>{0.125102535f, 0.100676134f},
-std::array<float,2>{0.585890174f, 0.718837321f},
-std::array<float,2>{0.560329378f, 0.266719967f},
-std::array<float,2>{0.248172998f, 0.927410185f},
-std::array<float,2>{0.465706766f, 0.232636377f},
-std::array<float,2>{0.921391487f, 0.605112255f},
-std::array<float,2>{0.837763369f, 0.0157743786f},
-std::array<float,2>{0.277317822f, 0.637217104f},
-std::array<float,2>{0.114706434f, 0.404307783f},
-std::array<float,2>{0.664795101f, 0.752797723f},
-std::array<float,2>{0.599297702f, 0.0812592134f},
-std::array<float,2>{0.174575672f, 0.71801281f},
-std::array<float,2>{0.414914757f, 0.439642727f},
-std::array<float,2>{0.999785662f, 0.869924605f},
-std::array<float,2>{0.76854831f, 0.339128435f},
-std::array<float,2>{0.346724153f, 0.998488545f},
-std::array<float,2>{0.0436671488f, 0.15874283f},
-std::array<float,2>{0.730744183f, 0.539764464f},
-std::array<float,2>{0.631128252f, 0.431738079f},
-std::array<float,2>{0.0876732096f, 0.790909946f},
-std::array<float,2>{0.308073223f, 0.0531448871f},
-std::array<float,2>{0.864443541f, 0.669317007f},
-std::array<float,2>{0.889440119f, 0.203838378f},
-std::array<float,2>{0.485327661f, 0.576647043f},
-std::array<float,2>{0.217836887f, 0.307668209f},
-std::array<float,2>{0.507615268f, 0.903443813f},
-std::array<float,2>{0.545636892f, 0.161252588f},
-std::array<float,2>{0.226870358f, 0.543754101f},
-std::array<float,2>{0.439109474f, 0.340780288f},
-std::array<float,2>{0.935156107f, 0.993726313f},
-std::array<float,2>{0.819673479f, 0.441992551f},
-std::array<float,2>{0.252561808f, 0.873981237f},
-std::array<float,2>{0.0952731818f, 0.0829531625f},
-std::array<float,2>{0.681685567f, 0.713014483f},
-std::array<float,2>{0.714285254f, 0.309724927f},
-std::array<float,2>{0.0160759985f, 0.902145803f},
-std::array<float,2>{0.333429724f, 0.208347037f},
-std::array<float,2>{0.79401809f, 0.572333395f},
-std::array<float,2>{0.943244994f, 0.0503475294f},
-std::array<float,2>{0.382412851f, 0.664473712f},
-std::array<float,2>{0.151850119f, 0.433818728f},
-std::array<float,2>{0.571227908f, 0.793762207f},
-std::array<float,2>{0.656244934f, 0.0950707942f},
-std::array<float,2>{0.0780167505f, 0.723555684f},
-std::array<float,2>{0.294148684f, 0.469109565f},
-std::array<float,2>{0.852735162f, 0.839598179f},
-std::array<float,2>{0.902905405f, 0.346064866f},
-std::array<float,2>{0.473041981f, 0.95694679f},
-std::array<float,2>{0.198501185f, 0.144731343f},
-std::array<float,2>{0.516003847f, 0.506290317f},
-std::array<float,2>{0.618632913f, 0.400351971f},
-std::array<float,2>{0.158644766f, 0.755359232f},
-std::array<float,2>{0.436608672f, 0.0206841733f},
-std::array<float,2>{0.97276783f, 0.634698331f},
-std::array<float,2>{0.760935485f, 0.226736367f},
-std::array<float,2>{0.368598998f, 0.605895817f},
-std::array<float,2>{0.0601273999f, 0.271574587f},
-std::array<float,2>{0.736499131f, 0.922405779f},
-std::array<float,2>{0.723870575f, 0.189873934f},
-std::array<float,2>{0.0351575203f, 0.5836882f},
-std::array<float,2>{0.352817267f, 0.285108566f},
-std::array<float,2>{0.774407148f, 0.880833149f},
-std::array<float,2>{0.991377473f, 0.418698311f},
-std::array<float,2>{0.406948537f, 0.810049176f},
-std::array<float,2>{0.185085744f, 0.0331674144f},
-std::array<float,2>{0.606926322f, 0.67411083f},
-std::array<float,2>{0.509981751f, 0.327831209f},
-std::array<float,2>{0.210669905f, 0.97629118f},
-std::array<float,2>{0.498801291f, 0.180193394f},
-std::array<float,2>{0.880790353f, 0.562372863f},
-std::array<float,2>{0.870698571f, 0.0772827193f},
-std::array<float,2>{0.303310603f, 0.696283698f},
-std::array<float,2>{0.0833960548f, 0.453448504f},
-std::array<float,2>{0.637072742f, 0.851528823f},
-std::array<float,2>{0.586225212f, 0.0151617741f},
-std::array<float,2>{0.138707235f, 0.64702183f},
-std::array<float,2>{0.403267473f, 0.379196674f},
-std::array<float,2>{0.960466206f, 0.776639581f},
-std::array<float,2>{0.797428727f, 0.254848331f},
-std::array<float,2>{0.318885535f, 0.919983566f},
-std::array<float,2>{0.014553749f, 0.240214452f},
-std::array<float,2>{0.702209651f, 0.613078415f},
-std::array<float,2>{0.660785556f, 0.486215711f},
-std::array<float,2>{0.124659806f, 0.816739917f},
-std::array<float,2>{0.272161812f, 0.112588868f},
-std::array<float,2>{0.82914114f, 0.73968786f},
-std::array<float,2>{0.910506427f, 0.130727142f},
-std::array<float,2>{0.45663172f, 0.521807015f},
-std::array<float,2>{0.241158709f, 0.360851854f},
-std::array<float,2>{0.554462671f, 0.937889934f},
-std::array<float,2>{0.595978975f, 0.245068237f},
-std::array<float,2>{0.177255124f, 0.621605217f},
-std::array<float,2>{0.421078831f, 0.259136796f},
-std::array<float,2>{0.992983639f, 0.909386098f},
-std::array<float,2>{0.771559834f, 0.386477977f},
-std::array<float,2>{0.350104153f, 0.766051531f},
-std::array<float,2>{0.041022867f, 0.00402980018f},
-std::array<float,2>{0.727527916f, 0.649208665f},
-std::array<float,2>{0.626219988f, 0.368275285f},
-std::array<float,2>{0.0903455913f, 0.953088939f},
-std::array<float,2>{0.311457604f, 0.133562163f},
-std::array<float,2>{0.860862672f, 0.526038945f},
-std::array<float,2>{0.886341095f, 0.118873529f},
-std::array<float,2>{0.490400642f, 0.742391109f},
-std::array<float,2>{0.21408166f, 0.497534066f},
-std::array<float,2>{0.502953827f, 0.823932946f},
-std::array<float,2>{0.693307221f, 0.045665551f},
-std::array<float,2>{0.00708826864f, 0.686038852f},
-std::array<float,2>{0.325265974f, 0.413904488f},
-std::array<float,2>{0.804700792f, 0.799965143f},
-std::array<float,2>{0.966508627f, 0.294510305f},
-std::array<float,2>{0.393370539f, 0.885316372f},
-std::array<float,2>{0.130123317f, 0.1968209f},
-std::array<float,2>{0.580525935f, 0.588225245f},
-std::array<float,2>{0.55782491f, 0.465637356f},
-std::array<float,2>{0.245170251f, 0.854187191f},
-std::array<float,2>{0.462526977f, 0.066010572f},
-std::array<float,2>{0.914957106f, 0.689361155f},
-std::array<float,2>{0.842092156f, 0.176003769f},
-std::array<float,2>{0.278453857f, 0.553780854f},
-std::array<float,2>{0.11122518f, 0.313001454f},
-std::array<float,2>{0.671504974f, 0.979393005f},
-std::array<float,2>{0.675603747f, 0.153725281f},
-std::array<float,2>{0.103419766f, 0.514885426f},
-std::array<float,2>{0.265137732f, 0.352201313f},
-std::array<float,2>{0.825755656f, 0.966865897f},
-std::array<float,2>{0.92762351f, 0.481682569f},
-std::array<float,2>{0.450650007f, 0.83355093f},
-std::array<float,2>{0.220071122f, 0.102067173f},
-std::array<float,2>{0.53904146f, 0.733749807f},
-std::array<float,2>{0.567000628f, 0.278659701f},
-std::array<float,2>{0.145914674f, 0.931961119f},
-std::array<float,2>{0.383845568f, 0.222739235f},
-std::array<float,2>{0.952967763f, 0.599727511f},
-std::array<float,2>{0.786535144f, 0.0266124941f},
-std::array<float,2>{0.337900937f, 0.628641963f},
-std::array<float,2>{0.0311739985f, 0.395740747f},
-std::array<float,2>{0.707326353f, 0.759726405f},
-std::array<float,2>{0.527486622f, 0.0934166163f},
-std::array<float,2>{0.191422895f, 0.710641086f},
-std::array<float,2>{0.478398025f, 0.451131046f},
-std::array<float,2>{0.894008398f, 0.861275971f},
-std::array<float,2>{0.84431237f, 0.330384135f},
-std::array<float,2>{0.283046693f, 0.985897422f},
-std::array<float,2>{0.0626451522f, 0.167592868f},
-std::array<float,2>{0.641962707f, 0.536233842f},
-std::array<float,2>{0.747253716f, 0.42737639f},
-std::array<float,2>{0.0512501486f, 0.788098514f},
-std::array<float,2>{0.362565368f, 0.0567663014f},
-std::array<float,2>{0.750190079f, 0.656674087f},
-std::array<float,2>{0.977634072f, 0.2167667f},
-std::array<float,2>{0.425599366f, 0.566162884f},
-std::array<float,2>{0.167207256f, 0.299167782f},
-std::array<float,2>{0.610058904f, 0.894663393f},
-std::array<float,2>{0.575315118f, 0.139090151f},
-std::array<float,2>{0.15437448f, 0.52928865f},
-std::array<float,2>{0.37827608f, 0.374564469f},
-std::array<float,2>{0.939454257f, 0.948257685f},
-std::array<float,2>{0.789674401f, 0.495837569f},
-std::array<float,2>{0.331722438f, 0.825329661f},
-std::array<float,2>{0.023406269f, 0.122079335f},
-std::array<float,2>{0.715703785f, 0.74874413f},
-std::array<float,2>{0.685003757f, 0.263166398f},
-std::array<float,2>{0.100244403f, 0.912625134f},
-std::array<float,2>{0.254673034f, 0.247380018f},
-std::array<float,2>{0.816038132f, 0.618712127f},
-std::array<float,2>{0.931475818f, 0.00188248185f},
-std::array<float,2>{0.441923171f, 0.654931903f},
-std::array<float,2>{0.232333571f, 0.387620747f},
-std::array<float,2>{0.541965544f, 0.771703899f},
-std::array<float,2>{0.739058852f, 0.0681989789f},
-std::array<float,2>{0.0585487373f, 0.691898227f},
-std::array<float,2>{0.371514708f, 0.46155867f},
-std::array<float,2>{0.763243914f, 0.858943939f},
-std::array<float,2>{0.971384764f, 0.31935057f},
-std::array<float,2>{0.429856241f, 0.984008789f},
-std::array<float,2>{0.162899688f, 0.17280063f},
-std::array<float,2>{0.624961674f, 0.549998939f},
-std::array<float,2>{0.520839036f, 0.406571269f},
-std::array<float,2>{0.200057507f, 0.80188781f},
-std::array<float,2>{0.47074005f, 0.0412024334f},
-std::array<float,2>{0.899724245f, 0.679896712f},
-std::array<float,2>{0.858919263f, 0.201525047f},
-std::array<float,2>{0.292645097f, 0.590468407f},
-std::array<float,2>{0.073189877f, 0.290754318f},
-std::array<float,2>{0.650095999f, 0.888331771f},
-std::array<float,2>{0.634769738f, 0.220724598f},
-std::array<float,2>{0.0793754309f, 0.59504348f},
-std::array<float,2>{0.297427058f, 0.275968552f},
-std::array<float,2>{0.872974217f, 0.934496105f},
-std::array<float,2>{0.876779199f, 0.393862247f},
-std::array<float,2>{0.495488197f, 0.763997793f},
-std::array<float,2>{0.203852549f, 0.03040375f},
-std::array<float,2>{0.512837529f, 0.630605996f},
-std::array<float,2>{0.602676809f, 0.357966274f},
-std::array<float,2>{0.180223405f, 0.96228236f},
-std::array<float,2>{0.41358912f, 0.150768325f},
-std::array<float,2>{0.987031937f, 0.511697471f},
-std::array<float,2>{0.777363062f, 0.107236564f},
-std::array<float,2>{0.3589423f, 0.728621602f},
-std::array<float,2>{0.033043135f, 0.478855342f},
-std::array<float,2>{0.719967186f, 0.830371559f},
-std::array<float,2>{0.550494671f, 0.0607638508f},
-std::array<float,2>{0.237990037f, 0.661352217f},
-std::array<float,2>{0.457524449f, 0.422627598f},
-std::array<float,2>{0.906581879f, 0.781596184f},
-std::array<float,2>{0.833992064f, 0.30254209f},
-std::array<float,2>{0.267011434f, 0.890684128f},
-std::array<float,2>{0.118820734f, 0.214523345f},
-std::array<float,2>{0.658558011f, 0.569876075f},
-std::array<float,2>{0.695431232f, 0.447166771f},
-std::array<float,2>{0.0114662526f, 0.864245534f},
-std::array<float,2>{0.312522709f, 0.0884049311f},
-std::array<float,2>{0.801598728f, 0.706576169f},
-std::array<float,2>{0.954507649f, 0.170332938f},
-std::array<float,2>{0.401913583f, 0.53264606f},
-std::array<float,2>{0.134694427f, 0.334219486f},
-std::array<float,2>{0.59028852f, 0.990975738f},
-std::array<float,2>{0.506699622f, 0.206518769f},
-std::array<float,2>{0.217537299f, 0.5754565f},
-std::array<float,2>{0.485529333f, 0.305054486f},
-std::array<float,2>{0.890322149f, 0.905832469f},
-std::array<float,2>{0.864097893f, 0.431053251f},
-std::array<float,2>{0.307411015f, 0.791486919f},
-std::array<float,2>{0.086431101f, 0.0517611019f},
-std::array<float,2>{0.632546902f, 0.669985771f},
-std::array<float,2>{0.731762052f, 0.336227953f},
-std::array<float,2>{0.0446462668f, 0.997674584f},
-std::array<float,2>{0.345749825f, 0.158040702f},
-std::array<float,2>{0.768855929f, 0.542159736f},
-std::array<float,2>{0.998984993f, 0.0783098042f},
-std::array<float,2>{0.415660024f, 0.71576196f},
-std::array<float,2>{0.175665826f, 0.438048184f},
-std::array<float,2>{0.598095894f, 0.867602348f},
-std::array<float,2>{0.665881336f, 0.0182024892f},
-std::array<float,2>{0.114086032f, 0.639420927f},
-std::array<float,2>{0.275876969f, 0.403191388f},
-std::array<float,2>{0.835980058f, 0.750519156f},
-std::array<float,2>{0.920063257f, 0.267592549f},
-std::array<float,2>{0.466186225f, 0.927915215f},
-std::array<float,2>{0.249878511f, 0.231492952f},
-std::array<float,2>{0.559402525f, 0.603224218f},
-std::array<float,2>{0.584111154f, 0.476186007f},
-std::array<float,2>{0.126012623f, 0.842487395f},
-std::array<float,2>{0.396882147f, 0.0978429615f},
-std::array<float,2>{0.962552845f, 0.722402513f},
-std::array<float,2>{0.810993433f, 0.142735526f},
-std::array<float,2>{0.3205024f, 0.50354439f},
-std::array<float,2>{0.000647240144f, 0.3480663f},
-std::array<float,2>{0.687794328f, 0.958963633f},
-std::array<float,2>{0.706715703f, 0.186965048f},
-std::array<float,2>{0.0261979681f, 0.556631029f},
-std::array<float,2>{0.341805637f, 0.323554635f},
-std::array<float,2>{0.782926381f, 0.971365035f},
-std::array<float,2>{0.947096527f, 0.457600832f},
-std::array<float,2>{0.389515996f, 0.844294846f},
-std::array<float,2>{0.143810347f, 0.0711505786f},
-std::array<float,2>{0.56556952f, 0.700821996f},
-std::array<float,2>{0.532745481f, 0.28652364f},
-std::array<float,2>{0.222698554f, 0.878346205f},
-std::array<float,2>{0.446923167f, 0.19187808f},
-std::array<float,2>{0.923720777f, 0.580688953f},
-std::array<float,2>{0.823376656f, 0.037394207f},
-std::array<float,2>{0.258532673f, 0.678150117f},
-std::array<float,2>{0.106319174f, 0.41673255f},
-std::array<float,2>{0.677305222f, 0.807437599f},
-std::array<float,2>{0.61458379f, 0.116580583f},
-std::array<float,2>{0.170216456f, 0.738060772f},
-std::array<float,2>{0.426001906f, 0.491513073f},
-std::array<float,2>{0.982833803f, 0.813622832f},
-std::array<float,2>{0.756871402f, 0.363332897f},
-std::array<float,2>{0.363631696f, 0.942205667f},
-std::array<float,2>{0.0502840765f, 0.126807898f},
-std::array<float,2>{0.743140459f, 0.516362369f},
-std::array<float,2>{0.645535648f, 0.375759155f},
-std::array<float,2>{0.0700511709f, 0.780474782f},
-std::array<float,2>{0.287907213f, 0.010759416f},
-std::array<float,2>{0.850548446f, 0.642946661f},
-std::array<float,2>{0.896265745f, 0.237741947f},
-std::array<float,2>{0.481758535f, 0.613769114f},
-std::array<float,2>{0.189761117f, 0.253823429f},
-std::array<float,2>{0.526386619f, 0.915598392f},
-std::array<float,2>{0.519331396f, 0.14734067f},
-std::array<float,2>{0.195635349f, 0.50396055f},
-std::array<float,2>{0.475037158f, 0.34424302f},
-std::array<float,2>{0.905659199f, 0.954215705f},
-std::array<float,2>{0.853584588f, 0.471039772f},
-std::array<float,2>{0.295284152f, 0.837046862f},
-std::array<float,2>{0.0746473595f, 0.0957816467f},
-std::array<float,2>{0.653599262f, 0.726353943f},
-std::array<float,2>{0.734793842f, 0.270718336f},
-std::array<float,2>{0.0618922114f, 0.924804688f},
-std::array<float,2>{0.369720519f, 0.228815034f},
-std::array<float,2>{0.758632183f, 0.608255684f},
-std::array<float,2>{0.975549996f, 0.0223535337f},
-std::array<float,2>{0.43442139f, 0.635377169f},
-std::array<float,2>{0.158082783f, 0.4004592f},
-std::array<float,2>{0.620958924f, 0.756577134f},
-std::array<float,2>{0.67982012f, 0.0852226391f},
-std::array<float,2>{0.097599037f, 0.711241066f},
-std::array<float,2>{0.251265794f, 0.444797128f},
-std::array<float,2>{0.817490339f, 0.871274173f},
-std::array<float,2>{0.936257958f, 0.342356175f},
-std::array<float,2>{0.440214068f, 0.994297743f},
-std::array<float,2>{0.229295f, 0.163374275f},
-std::array<float,2>{0.543047607f, 0.545792878f},
-std::array<float,2>{0.573885322f, 0.435935557f},
-std::array<float,2>{0.149500251f, 0.795438886f},
-std::array<float,2>{0.380856276f, 0.0469666459f},
-std::array<float,2>{0.944831789f, 0.66710794f},
-std::array<float,2>{0.7953704f, 0.209321916f},
-std::array<float,2>{0.334972382f, 0.571706235f},
-std::array<float,2>{0.019149892f, 0.311113119f},
-std::array<float,2>{0.711662948f, 0.900230765f},
-std::array<float,2>{0.700647473f, 0.2419274f},
-std::array<float,2>{0.0118863815f, 0.610080183f},
-std::array<float,2>{0.318173766f, 0.257509619f},
-std::array<float,2>{0.799246967f, 0.918039083f},
-std::array<float,2>{0.958246708f, 0.382527411f},
-std::array<float,2>{0.404702038f, 0.775141656f},
-std::array<float,2>{0.138460934f, 0.0134692276f},
-std::array<float,2>{0.589315534f, 0.646148741f},
-std::array<float,2>{0.551340938f, 0.362895608f},
-std::array<float,2>{0.23852776f, 0.941153049f},
-std::array<float,2>{0.455032021f, 0.131536946f},
-std::array<float,2>{0.913280964f, 0.521192312f},
-std::array<float,2>{0.830527067f, 0.110033058f},
-std::array<float,2>{0.270857662f, 0.740728438f},
-std::array<float,2>{0.121135704f, 0.488132298f},
-std::array<float,2>{0.663718998f, 0.819230914f},
-std::array<float,2>{0.608806133f, 0.0345832929f},
-std::array<float,2>{0.185828164f, 0.673501313f},
-std::array<float,2>{0.408481419f, 0.421495646f},
-std::array<float,2>{0.989861846f, 0.812098622f},
-std::array<float,2>{0.776335061f, 0.282391459f},
-std::array<float,2>{0.354837477f, 0.880989254f},
-std::array<float,2>{0.0388503522f, 0.188702658f},
-std::array<float,2>{0.725908518f, 0.585212171f},
-std::array<float,2>{0.639095962f, 0.455192775f},
-std::array<float,2>{0.0842346177f, 0.848104298f},
-std::array<float,2>{0.302098066f, 0.0746631846f},
-std::array<float,2>{0.867657661f, 0.698828816f},
-std::array<float,2>{0.882246971f, 0.183238372f},
-std::array<float,2>{0.497746795f, 0.558762431f},
-std::array<float,2>{0.208932325f, 0.325888425f},
-std::array<float,2>{0.50857687f, 0.973615289f},
-std::array<float,2>{0.5797804f, 0.198357135f},
-std::array<float,2>{0.132581845f, 0.587586343f},
-std::array<float,2>{0.39121154f, 0.295230031f},
-std::array<float,2>{0.967977524f, 0.883949935f},
-std::array<float,2>{0.807580292f, 0.411604941f},
-std::array<float,2>{0.326815069f, 0.79853332f},
-std::array<float,2>{0.0041130851f, 0.0435827523f},
-std::array<float,2>{0.693393767f, 0.684831858f},
-std::array<float,2>{0.669097304f, 0.315686882f},
-std::array<float,2>{0.111876465f, 0.978016138f},
-std::array<float,2>{0.280360579f, 0.178023621f},
-std::array<float,2>{0.840528071f, 0.552007377f},
-std::array<float,2>{0.916410029f, 0.0642994046f},
-std::array<float,2>{0.46449995f, 0.690546691f},
-std::array<float,2>{0.242567644f, 0.467621803f},
-std::array<float,2>{0.555369377f, 0.852407575f},
-std::array<float,2>{0.729109049f, 0.00622171536f},
-std::array<float,2>{0.0408593267f, 0.651081204f},
-std::array<float,2>{0.349366397f, 0.384707868f},
-std::array<float,2>{0.770257831f, 0.768423855f},
-std::array<float,2>{0.995937407f, 0.261411577f},
-std::array<float,2>{0.419080436f, 0.907028496f},
-std::array<float,2>{0.177868471f, 0.242973983f},
-std::array<float,2>{0.595480263f, 0.624313772f},
-std::array<float,2>{0.501073956f, 0.498217225f},
-std::array<float,2>{0.211624444f, 0.822099268f},
-std::array<float,2>{0.489511013f, 0.119621933f},
-std::array<float,2>{0.883820713f, 0.744393349f},
-std::array<float,2>{0.863191128f, 0.135615095f},
-std::array<float,2>{0.30932042f, 0.524001658f},
-std::array<float,2>{0.0918651745f, 0.370079249f},
-std::array<float,2>{0.628076255f, 0.949877262f},
-std::array<float,2>{0.64337182f, 0.164339468f},
-std::array<float,2>{0.0650742501f, 0.53856957f},
-std::array<float,2>{0.284256399f, 0.329641104f},
-std::array<float,2>{0.846657395f, 0.987254858f},
-std::array<float,2>{0.892442286f, 0.451658934f},
-std::array<float,2>{0.479383647f, 0.862563729f},
-std::array<float,2>{0.193711773f, 0.0901705176f},
-std::array<float,2>{0.531191528f, 0.708402574f},
-std::array<float,2>{0.613191664f, 0.298069388f},
-std::array<float,2>{0.165633738f, 0.896535337f},
-std::array<float,2>{0.423118383f, 0.218516931f},
-std::array<float,2>{0.979139388f, 0.563094974f},
-std::array<float,2>{0.753178537f, 0.0551888123f},
-std::array<float,2>{0.360957354f, 0.659199238f},
-std::array<float,2>{0.0528974198f, 0.429106385f},
-std::array<float,2>{0.749625623f, 0.78635776f},
-std::array<float,2>{0.535601854f, 0.104762308f},
-std::array<float,2>{0.222096652f, 0.731602788f},
-std::array<float,2>{0.451498628f, 0.483031958f},
-std::array<float,2>{0.92849803f, 0.834982812f},
-std::array<float,2>{0.826556146f, 0.354062051f},
-std::array<float,2>{0.262631774f, 0.965557516f},
-std::array<float,2>{0.105399981f, 0.154706687f},
-std::array<float,2>{0.673465729f, 0.51213336f},
-std::array<float,2>{0.710545063f, 0.396874458f},
-std::array<float,2>{0.0291106403f, 0.761018097f},
-std::array<float,2>{0.337228417f, 0.0252620112f},
-std::array<float,2>{0.787253737f, 0.625136554f},
-std::array<float,2>{0.950051606f, 0.224985048f},
-std::array<float,2>{0.38493371f, 0.599429309f},
-std::array<float,2>{0.147359997f, 0.280973345f},
-std::array<float,2>{0.568431973f, 0.931554675f},
-std::array<float,2>{0.622546077f, 0.175419286f},
-std::array<float,2>{0.161450729f, 0.548129559f},
-std::array<float,2>{0.432009488f, 0.316423208f},
-std::array<float,2>{0.969595253f, 0.981279016f},
-std::array<float,2>{0.764363945f, 0.463900208f},
-std::array<float,2>{0.373513252f, 0.85580498f},
-std::array<float,2>{0.0561303161f, 0.0683785006f},
-std::array<float,2>{0.741545379f, 0.694445133f},
-std::array<float,2>{0.651745319f, 0.292305589f},
-std::array<float,2>{0.0706166774f, 0.89026469f},
-std::array<float,2>{0.289476603f, 0.199325874f},
-std::array<float,2>{0.855967104f, 0.593095303f},
-std::array<float,2>{0.902018905f, 0.039778661f},
-std::array<float,2>{0.468876421f, 0.682831883f},
-std::array<float,2>{0.202373534f, 0.408439577f},
-std::array<float,2>{0.521719337f, 0.803104103f},
-std::array<float,2>{0.717190981f, 0.124023348f},
-std::array<float,2>{0.0204363335f, 0.748008549f},
-std::array<float,2>{0.329813689f, 0.492885023f},
-std::array<float,2>{0.792691529f, 0.826422215f},
-std::array<float,2>{0.937676013f, 0.371728182f},
-std::array<float,2>{0.375945657f, 0.947257996f},
-std::array<float,2>{0.152836472f, 0.137036681f},
-std::array<float,2>{0.577355742f, 0.530107379f},
-std::array<float,2>{0.539629102f, 0.389768153f},
-std::array<float,2>{0.232799485f, 0.770085335f},
-std::array<float,2>{0.444895566f, 0.00321291457f},
-std::array<float,2>{0.931694508f, 0.653115034f},
-std::array<float,2>{0.814232767f, 0.249812394f},
-std::array<float,2>{0.25764057f, 0.620367408f},
-std::array<float,2>{0.0993035883f, 0.263911307f},
-std::array<float,2>{0.685779929f, 0.911676228f},
-std::array<float,2>{0.656895995f, 0.21252355f},
-std::array<float,2>{0.119726487f, 0.567176998f},
-std::array<float,2>{0.269503206f, 0.304028869f},
-std::array<float,2>{0.833801031f, 0.893537164f},
-std::array<float,2>{0.909310162f, 0.423995793f},
-std::array<float,2>{0.459208697f, 0.783789158f},
-std::array<float,2>{0.235039651f, 0.0603091307f},
-std::array<float,2>{0.548188806f, 0.662704587f},
-std::array<float,2>{0.59181881f, 0.332901418f},
-std::array<float,2>{0.135408655f, 0.988402188f},
-std::array<float,2>{0.398779422f, 0.169134751f},
-std::array<float,2>{0.95528084f, 0.53333509f},
-std::array<float,2>{0.803769052f, 0.0876546502f},
-std::array<float,2>{0.316135019f, 0.704724014f},
-std::array<float,2>{0.00834640022f, 0.448985577f},
-std::array<float,2>{0.697569847f, 0.865884542f},
-std::array<float,2>{0.514232278f, 0.0274939165f},
-std::array<float,2>{0.206764385f, 0.632366359f},
-std::array<float,2>{0.492415458f, 0.391146243f},
-std::array<float,2>{0.877041638f, 0.761765897f},
-std::array<float,2>{0.873634815f, 0.273491979f},
-std::array<float,2>{0.299211591f, 0.935771227f},
-std::array<float,2>{0.0816521347f, 0.219499588f},
-std::array<float,2>{0.633242071f, 0.597072124f},
-std::array<float,2>{0.72078979f, 0.476998985f},
-std::array<float,2>{0.0336406454f, 0.828315735f},
-std::array<float,2>{0.356118351f, 0.108443104f},
-std::array<float,2>{0.779376447f, 0.727968633f},
-std::array<float,2>{0.985502481f, 0.148979425f},
-std::array<float,2>{0.412106067f, 0.508914053f},
-std::array<float,2>{0.183142185f, 0.355825633f},
-std::array<float,2>{0.603785455f, 0.963969588f},
-std::array<float,2>{0.561054885f, 0.233424604f},
-std::array<float,2>{0.247118175f, 0.604260564f},
-std::array<float,2>{0.466815054f, 0.265934348f},
-std::array<float,2>{0.918341398f, 0.925807178f},
-std::array<float,2>{0.839719355f, 0.405981272f},
-std::array<float,2>{0.275146157f, 0.753595948f},
-std::array<float,2>{0.116113625f, 0.017091414f},
-std::array<float,2>{0.666276574f, 0.638389051f},
-std::array<float,2>{0.69031918f, 0.350120872f},
-std::array<float,2>{0.00227668858f, 0.959754169f},
-std::array<float,2>{0.323928267f, 0.141936287f},
-std::array<float,2>{0.810491145f, 0.501304448f},
-std::array<float,2>{0.963335454f, 0.0999244079f},
-std::array<float,2>{0.395185411f, 0.720490158f},
-std::array<float,2>{0.127849028f, 0.473862559f},
-std::array<float,2>{0.582874298f, 0.840648413f},
-std::array<float,2>{0.630409658f, 0.0539626367f},
-std::array<float,2>{0.0891133919f, 0.668859482f},
-std::array<float,2>{0.305766851f, 0.433332562f},
-std::array<float,2>{0.865796983f, 0.789369464f},
-std::array<float,2>{0.887058318f, 0.306693017f},
-std::array<float,2>{0.487252623f, 0.903299034f},
-std::array<float,2>{0.216335282f, 0.204872057f},
-std::array<float,2>{0.504306436f, 0.577962101f},
-std::array<float,2>{0.601462424f, 0.441326916f},
-std::array<float,2>{0.172017843f, 0.870484531f},
-std::array<float,2>{0.416991055f, 0.0804782063f},
-std::array<float,2>{0.997262657f, 0.717211246f},
-std::array<float,2>{0.765816331f, 0.159421504f},
-std::array<float,2>{0.344508201f, 0.540591061f},
-std::array<float,2>{0.0467022285f, 0.338706642f},
-std::array<float,2>{0.732653379f, 0.999463439f},
-std::array<float,2>{0.744146228f, 0.128872693f},
-std::array<float,2>{0.0483729541f, 0.519343197f},
-std::array<float,2>{0.366808444f, 0.36670953f},
-std::array<float,2>{0.754935384f, 0.943794906f},
-std::array<float,2>{0.98120892f, 0.489184529f},
-std::array<float,2>{0.42808038f, 0.814931989f},
-std::array<float,2>{0.169690877f, 0.113479652f},
-std::array<float,2>{0.615790784f, 0.735416234f},
-std::array<float,2>{0.52440995f, 0.251059294f},
-std::array<float,2>{0.18856667f, 0.917580724f},
-std::array<float,2>{0.482924312f, 0.235243052f},
-std::array<float,2>{0.896523297f, 0.616975665f},
-std::array<float,2>{0.849155903f, 0.00961246993f},
-std::array<float,2>{0.286567241f, 0.642181158f},
-std::array<float,2>{0.0673472136f, 0.37802431f},
-std::array<float,2>{0.646907866f, 0.777788579f},
-std::array<float,2>{0.563501894f, 0.0728818923f},
-std::array<float,2>{0.142146647f, 0.701351821f},
-std::array<float,2>{0.388381451f, 0.460722685f},
-std::array<float,2>{0.948772311f, 0.845771909f},
-std::array<float,2>{0.783936143f, 0.320804983f},
-std::array<float,2>{0.341190487f, 0.968927741f},
-std::array<float,2>{0.0247662365f, 0.184720561f},
-std::array<float,2>{0.703244209f, 0.557815433f},
-std::array<float,2>{0.679288566f, 0.414851099f},
-std::array<float,2>{0.10933163f, 0.804932952f},
-std::array<float,2>{0.261416972f, 0.0360816978f},
-std::array<float,2>{0.821093619f, 0.676896632f},
-std::array<float,2>{0.924089551f, 0.195240468f},
-std::array<float,2>{0.448537707f, 0.57850945f},
-std::array<float,2>{0.22569038f, 0.28897357f},
-std::array<float,2>{0.533451796f, 0.876013279f},
-std::array<float,2>{0.530310988f, 0.167265505f},
-std::array<float,2>{0.194276989f, 0.536859155f},
-std::array<float,2>{0.478529394f, 0.330883592f},
-std::array<float,2>{0.891788661f, 0.985369205f},
-std::array<float,2>{0.846159279f, 0.450427443f},
-std::array<float,2>{0.285074919f, 0.860413373f},
-std::array<float,2>{0.0648025274f, 0.0929365456f},
-std::array<float,2>{0.64273876f, 0.710074604f},
-std::array<float,2>{0.749275148f, 0.299635947f},
-std::array<float,2>{0.0534698553f, 0.895115793f},
-std::array<float,2>{0.360444963f, 0.216152012f},
-std::array<float,2>{0.753625453f, 0.565912783f},
-std::array<float,2>{0.978773713f, 0.0576051548f},
-std::array<float,2>{0.423496783f, 0.656927526f},
-std::array<float,2>{0.165481076f, 0.42706117f},
-std::array<float,2>{0.61271888f, 0.789023042f},
-std::array<float,2>{0.672896266f, 0.101971231f},
-std::array<float,2>{0.104917675f, 0.734025061f},
-std::array<float,2>{0.262192845f, 0.482110441f},
-std::array<float,2>{0.826956987f, 0.833301187f},
-std::array<float,2>{0.928130686f, 0.351813436f},
-std::array<float,2>{0.452140957f, 0.96753341f},
-std::array<float,2>{0.222556412f, 0.154101491f},
-std::array<float,2>{0.535839081f, 0.515200853f},
-std::array<float,2>{0.568909049f, 0.396399707f},
-std::array<float,2>{0.146655783f, 0.759018719f},
-std::array<float,2>{0.385318905f, 0.0272357259f},
-std::array<float,2>{0.949354827f, 0.628315628f},
-std::array<float,2>{0.787926197f, 0.223528221f},
-std::array<float,2>{0.337743372f, 0.600140691f},
-std::array<float,2>{0.0285274144f, 0.279244572f},
-std::array<float,2>{0.710425854f, 0.932369649f},
-std::array<float,2>{0.694273233f, 0.19632566f},
-std::array<float,2>{0.00441637821f, 0.588448048f},
-std::array<float,2>{0.326615334f, 0.294268429f},
-std::array<float,2>{0.806915581f, 0.884805202f},
-std::array<float,2>{0.968505144f, 0.413223028f},
-std::array<float,2>{0.390868098f, 0.800577402f},
-std::array<float,2>{0.132084325f, 0.0453619659f},
-std::array<float,2>{0.579290748f, 0.68572402f},
-std::array<float,2>{0.554960132f, 0.312978387f},
-std::array<float,2>{0.242701232f, 0.978999436f},
-std::array<float,2>{0.464016259f, 0.176712587f},
-std::array<float,2>{0.916770637f, 0.554463446f},
-std::array<float,2>{0.839925349f, 0.0655828267f},
-std::array<float,2>{0.280850917f, 0.688703716f},
-std::array<float,2>{0.111478545f, 0.465322256f},
-std::array<float,2>{0.669725001f, 0.853688598f},
-std::array<float,2>{0.595150292f, 0.00485090259f},
-std::array<float,2>{0.178589284f, 0.648714542f},
-std::array<float,2>{0.419454783f, 0.385752827f},
-std::array<float,2>{0.995334744f, 0.766530991f},
-std::array<float,2>{0.769824028f, 0.259378523f},
-std::array<float,2>{0.348765671f, 0.909998715f},
-std::array<float,2>{0.0401864462f, 0.244375676f},
-std::array<float,2>{0.728527069f, 0.621501029f},
-std::array<float,2>{0.628715575f, 0.497730821f},
-std::array<float,2>{0.0927608907f, 0.82341069f},
-std::array<float,2>{0.308823854f, 0.118552096f},
-std::array<float,2>{0.862462819f, 0.74270469f},
-std::array<float,2>{0.884339988f, 0.13319397f},
-std::array<float,2>{0.490007609f, 0.525856912f},
-std::array<float,2>{0.211390093f, 0.368733793f},
-std::array<float,2>{0.501782835f, 0.952250123f},
-std::array<float,2>{0.589672744f, 0.239608005f},
-std::array<float,2>{0.137923717f, 0.612658083f},
-std::array<float,2>{0.405068934f, 0.253961295f},
-std::array<float,2>{0.958948195f, 0.920585334f},
-std::array<float,2>{0.79959166f, 0.379419327f},
-std::array<float,2>{0.317795753f, 0.777265847f},
-std::array<float,2>{0.0124713928f, 0.0148756513f},
-std::array<float,2>{0.700718582f, 0.646964729f},
-std::array<float,2>{0.663123012f, 0.360644042f},
-std::array<float,2>{0.121613391f, 0.938062191f},
-std::array<float,2>{0.271422744f, 0.130102158f},
-std::array<float,2>{0.830803216f, 0.522138834f},
-std::array<float,2>{0.913911819f, 0.113048017f},
-std::array<float,2>{0.454521328f, 0.740182817f},
-std::array<float,2>{0.238859609f, 0.485757947f},
-std::array<float,2>{0.551202834f, 0.817170918f},
-std::array<float,2>{0.726508141f, 0.0327088386f},
-std::array<float,2>{0.0382859781f, 0.674472928f},
-std::array<float,2>{0.355255485f, 0.418396622f},
-std::array<float,2>{0.775558233f, 0.810172558f},
-std::array<float,2>{0.989351213f, 0.284459174f},
-std::array<float,2>{0.408765197f, 0.879965365f},
-std::array<float,2>{0.186175957f, 0.190266594f},
-std::array<float,2>{0.609075963f, 0.583034635f},
-std::array<float,2>{0.508026481f, 0.454094917f},
-std::array<float,2>{0.208204076f, 0.851000726f},
-std::array<float,2>{0.497356236f, 0.077719532f},
-std::array<float,2>{0.882446706f, 0.695374131f},
-std::array<float,2>{0.867816746f, 0.179863304f},
-std::array<float,2>{0.30242607f, 0.56180495f},
-std::array<float,2>{0.0847259536f, 0.327274919f},
-std::array<float,2>{0.639353573f, 0.975863814f},
-std::array<float,2>{0.654143035f, 0.145338684f},
-std::array<float,2>{0.0751260221f, 0.506741703f},
-std::array<float,2>{0.295861006f, 0.34630233f},
-std::array<float,2>{0.854248822f, 0.95606482f},
-std::array<float,2>{0.905792415f, 0.469665557f},
-std::array<float,2>{0.475176156f, 0.839052677f},
-std::array<float,2>{0.196086794f, 0.0952630043f},
-std::array<float,2>{0.518645763f, 0.723023593f},
-std::array<float,2>{0.620510638f, 0.272261024f},
-std::array<float,2>{0.157598689f, 0.92199856f},
-std::array<float,2>{0.43402952f, 0.22744219f},
-std::array<float,2>{0.975090921f, 0.606049955f},
-std::array<float,2>{0.758102655f, 0.0214043166f},
-std::array<float,2>{0.369404346f, 0.63395834f},
-std::array<float,2>{0.0623515546f, 0.399722725f},
-std::array<float,2>{0.735324085f, 0.755490422f},
-std::array<float,2>{0.543689907f, 0.0821242332f},
-std::array<float,2>{0.228948861f, 0.713404477f},
-std::array<float,2>{0.439572364f, 0.441577822f},
-std::array<float,2>{0.935682595f, 0.873263478f},
-std::array<float,2>{0.818067014f, 0.340130121f},
-std::array<float,2>{0.251748055f, 0.993260562f},
-std::array<float,2>{0.0971089453f, 0.161794692f},
-std::array<float,2>{0.680515707f, 0.542994916f},
-std::array<float,2>{0.710998476f, 0.434538841f},
-std::array<float,2>{0.0187110193f, 0.793197811f},
-std::array<float,2>{0.335608929f, 0.0501132533f},
-std::array<float,2>{0.795724988f, 0.664628088f},
-std::array<float,2>{0.944562376f, 0.208783746f},
-std::array<float,2>{0.380018383f, 0.57300961f},
-std::array<float,2>{0.15008229f, 0.310173243f},
-std::array<float,2>{0.573290288f, 0.901499867f},
-std::array<float,2>{0.615659833f, 0.126315087f},
-std::array<float,2>{0.169315353f, 0.515995562f},
-std::array<float,2>{0.428449005f, 0.363915294f},
-std::array<float,2>{0.980494499f, 0.941890001f},
-std::array<float,2>{0.75579834f, 0.491887838f},
-std::array<float,2>{0.366506428f, 0.814289331f},
-std::array<float,2>{0.0481500365f, 0.116850078f},
-std::array<float,2>{0.745070755f, 0.737477839f},
-std::array<float,2>{0.647292793f, 0.253309369f},
-std::array<float,2>{0.0664091408f, 0.915154874f},
-std::array<float,2>{0.286952049f, 0.237964138f},
-std::array<float,2>{0.848662674f, 0.614017665f},
-std::array<float,2>{0.897344887f, 0.0112962099f},
-std::array<float,2>{0.482544839f, 0.64317441f},
-std::array<float,2>{0.189272925f, 0.375288963f},
-std::array<float,2>{0.523500443f, 0.781145096f},
-std::array<float,2>{0.703996241f, 0.070599407f},
-std::array<float,2>{0.0249718502f, 0.700421631f},
-std::array<float,2>{0.341484517f, 0.457208723f},
-std::array<float,2>{0.783237755f, 0.843889594f},
-std::array<float,2>{0.948532939f, 0.323816806f},
-std::array<float,2>{0.388147116f, 0.970907569f},
-std::array<float,2>{0.141691938f, 0.187084332f},
-std::array<float,2>{0.564028382f, 0.556103408f},
-std::array<float,2>{0.533905745f, 0.416398346f},
-std::array<float,2>{0.226454288f, 0.806809068f},
-std::array<float,2>{0.448993087f, 0.0377819166f},
-std::array<float,2>{0.924437523f, 0.67826879f},
-std::array<float,2>{0.820711076f, 0.192042083f},
-std::array<float,2>{0.260747731f, 0.580146253f},
-std::array<float,2>{0.108732224f, 0.286665171f},
-std::array<float,2>{0.679052055f, 0.878718317f},
-std::array<float,2>{0.666724026f, 0.232316241f},
-std::array<float,2>{0.115686335f, 0.60298574f},
-std::array<float,2>{0.274442136f, 0.268107712f},
-std::array<float,2>{0.839275181f, 0.928675473f},
-std::array<float,2>{0.9188748f, 0.402814865f},
-std::array<float,2>{0.467535317f, 0.750317276f},
-std::array<float,2>{0.247806847f, 0.0178699791f},
-std::array<float,2>{0.560876429f, 0.638979197f},
-std::array<float,2>{0.582439542f, 0.348231882f},
-std::array<float,2>{0.127236158f, 0.958350718f},
-std::array<float,2>{0.394972473f, 0.143222257f},
-std::array<float,2>{0.963607669f, 0.503306746f},
-std::array<float,2>{0.809609652f, 0.0982155949f},
-std::array<float,2>{0.323524594f, 0.721773684f},
-std::array<float,2>{0.00256895972f, 0.475921273f},
-std::array<float,2>{0.689927757f, 0.841934323f},
-std::array<float,2>{0.504784524f, 0.052542679f},
-std::array<float,2>{0.215981424f, 0.670429051f},
-std::array<float,2>{0.486617535f, 0.431254476f},
-std::array<float,2>{0.887571335f, 0.791690469f},
-std::array<float,2>{0.865639091f, 0.305251002f},
-std::array<float,2>{0.306401908f, 0.905701756f},
-std::array<float,2>{0.0896872953f, 0.206607893f},
-std::array<float,2>{0.629950464f, 0.575742841f},
-std::array<float,2>{0.733003199f, 0.437933713f},
-std::array<float,2>{0.0463512316f, 0.867915511f},
-std::array<float,2>{0.343916804f, 0.0786372274f},
-std::array<float,2>{0.766411364f, 0.715323448f},
-std::array<float,2>{0.998039544f, 0.157638058f},
-std::array<float,2>{0.416197181f, 0.542918563f},
-std::array<float,2>{0.17268692f, 0.336437345f},
-std::array<float,2>{0.601057649f, 0.99726212f},
-std::array<float,2>{0.548653722f, 0.213935092f},
-std::array<float,2>{0.2345438f, 0.569410563f},
-std::array<float,2>{0.459564984f, 0.301758498f},
-std::array<float,2>{0.90988934f, 0.891320586f},
-std::array<float,2>{0.833387971f, 0.42235738f},
-std::array<float,2>{0.268998414f, 0.782211959f},
-std::array<float,2>{0.119595617f, 0.0610486269f},
-std::array<float,2>{0.656628668f, 0.662021756f},
-std::array<float,2>{0.698206663f, 0.334716231f},
-std::array<float,2>{0.00801960006f, 0.990362108f},
-std::array<float,2>{0.315773785f, 0.170473382f},
-std::array<float,2>{0.804681063f, 0.533195972f},
-std::array<float,2>{0.955645859f, 0.0883722678f},
-std::array<float,2>{0.399105668f, 0.706496954f},
-std::array<float,2>{0.135124862f, 0.446456373f},
-std::array<float,2>{0.592646599f, 0.863295674f},
-std::array<float,2>{0.633756399f, 0.0309815239f},
-std::array<float,2>{0.0814255774f, 0.629934132f},
-std::array<float,2>{0.299441785f, 0.394277543f},
-std::array<float,2>{0.873319387f, 0.764464319f},
-std::array<float,2>{0.877476573f, 0.275809854f},
-std::array<float,2>{0.493105441f, 0.933976352f},
-std::array<float,2>{0.206086129f, 0.221310183f},
-std::array<float,2>{0.513977528f, 0.595352888f},
-std::array<float,2>{0.604201913f, 0.479453743f},
-std::array<float,2>{0.182737008f, 0.830928385f},
-std::array<float,2>{0.411324382f, 0.106768712f},
-std::array<float,2>{0.986102939f, 0.729225397f},
-std::array<float,2>{0.78012383f, 0.151343226f},
-std::array<float,2>{0.35569036f, 0.511047363f},
-std::array<float,2>{0.0340195782f, 0.357480824f},
-std::array<float,2>{0.721227705f, 0.962569892f},
-std::array<float,2>{0.741757214f, 0.172276855f},
-std::array<float,2>{0.056534797f, 0.55033505f},
-std::array<float,2>{0.373662144f, 0.320310533f},
-std::array<float,2>{0.763950527f, 0.983743489f},
-std::array<float,2>{0.969212413f, 0.460967571f},
-std::array<float,2>{0.432278246f, 0.858636022f},
-std::array<float,2>{0.161807939f, 0.0675938502f},
-std::array<float,2>{0.62281692f, 0.691670954f},
-std::array<float,2>{0.522449613f, 0.290266365f},
-std::array<float,2>{0.203014642f, 0.888048649f},
-std::array<float,2>{0.469353706f, 0.201876044f},
-std::array<float,2>{0.901443124f, 0.590181828f},
-std::array<float,2>{0.855930567f, 0.041878894f},
-std::array<float,2>{0.289613783f, 0.680276632f},
-std::array<float,2>{0.0711581707f, 0.407066166f},
-std::array<float,2>{0.652038813f, 0.802296937f},
-std::array<float,2>{0.57766372f, 0.122907095f},
-std::array<float,2>{0.152605772f, 0.748358607f},
-std::array<float,2>{0.37539199f, 0.49526301f},
-std::array<float,2>{0.93813169f, 0.825699687f},
-std::array<float,2>{0.792464256f, 0.374076664f},
-std::array<float,2>{0.329433739f, 0.948859215f},
-std::array<float,2>{0.0195762217f, 0.13951239f},
-std::array<float,2>{0.717479885f, 0.528517425f},
-std::array<float,2>{0.686422706f, 0.387011707f},
-std::array<float,2>{0.0986736938f, 0.771979809f},
-std::array<float,2>{0.256951839f, 0.00102921657f},
-std::array<float,2>{0.813693106f, 0.654597342f},
-std::array<float,2>{0.932525396f, 0.247807398f},
-std::array<float,2>{0.444428504f, 0.618370414f},
-std::array<float,2>{0.233242825f, 0.263513416f},
-std::array<float,2>{0.539528012f, 0.912112057f},
-std::array<float,2>{0.538390458f, 0.155006349f},
-std::array<float,2>{0.220601857f, 0.512390137f},
-std::array<float,2>{0.450840116f, 0.353789628f},
-std::array<float,2>{0.926992595f, 0.96532923f},
-std::array<float,2>{0.825644135f, 0.48273024f},
-std::array<float,2>{0.264770597f, 0.835855007f},
-std::array<float,2>{0.102881014f, 0.105405115f},
-std::array<float,2>{0.675181687f, 0.732037902f},
-std::array<float,2>{0.70792824f, 0.2807118f},
-std::array<float,2>{0.0305803102f, 0.930720448f},
-std::array<float,2>{0.338616222f, 0.225469351f},
-std::array<float,2>{0.787062049f, 0.598827183f},
-std::array<float,2>{0.952352941f, 0.0247814264f},
-std::array<float,2>{0.384301126f, 0.625611842f},
-std::array<float,2>{0.146154583f, 0.397107661f},
-std::array<float,2>{0.566706061f, 0.761416316f},
-std::array<float,2>{0.642280698f, 0.0904454216f},
-std::array<float,2>{0.0631486475f, 0.708965659f},
-std::array<float,2>{0.282460004f, 0.452051848f},
-std::array<float,2>{0.843870342f, 0.863081932f},
-std::array<float,2>{0.894097745f, 0.329402119f},
-std::array<float,2>{0.477636933f, 0.986638129f},
-std::array<float,2>{0.192326054f, 0.164576143f},
-std::array<float,2>{0.528038383f, 0.538677871f},
-std::array<float,2>{0.609449267f, 0.429223478f},
-std::array<float,2>{0.167878032f, 0.786690474f},
-std::array<float,2>{0.424960762f, 0.0548216216f},
-std::array<float,2>{0.978356242f, 0.659954965f},
-std::array<float,2>{0.750686646f, 0.218243584f},
-std::array<float,2>{0.36320585f, 0.562804043f},
-std::array<float,2>{0.0513682626f, 0.298366249f},
-std::array<float,2>{0.747936547f, 0.897091746f},
-std::array<float,2>{0.726811111f, 0.242249459f},
-std::array<float,2>{0.0415768512f, 0.62454766f},
-std::array<float,2>{0.349668026f, 0.260965526f},
-std::array<float,2>{0.772310793f, 0.906336606f},
-std::array<float,2>{0.992206395f, 0.383798838f},
-std::array<float,2>{0.421442181f, 0.767797828f},
-std::array<float,2>{0.177159905f, 0.00636813184f},
-std::array<float,2>{0.596430302f, 0.650556743f},
-std::array<float,2>{0.50348109f, 0.369266272f},
-std::array<float,2>{0.214613855f, 0.949520946f},
-std::array<float,2>{0.490897894f, 0.134937331f},
-std::array<float,2>{0.885945261f, 0.523800433f},
-std::array<float,2>{0.860821426f, 0.119892865f},
-std::array<float,2>{0.310964614f, 0.745093048f},
-std::array<float,2>{0.0902263895f, 0.498669893f},
-std::array<float,2>{0.626890838f, 0.821377099f},
-std::array<float,2>{0.580861092f, 0.0433876999f},
-std::array<float,2>{0.130523294f, 0.685145557f},
-std::array<float,2>{0.392739743f, 0.411803007f},
-std::array<float,2>{0.965910017f, 0.798128128f},
-std::array<float,2>{0.805507541f, 0.295730054f},
-std::array<float,2>{0.326085895f, 0.884627163f},
-std::array<float,2>{0.00738894008f, 0.198872924f},
-std::array<float,2>{0.692591727f, 0.587100983f},
-std::array<float,2>{0.671027422f, 0.466799796f},
-std::array<float,2>{0.110453613f, 0.851744592f},
-std::array<float,2>{0.27885595f, 0.0637705848f},
-std::array<float,2>{0.842745483f, 0.691230178f},
-std::array<float,2>{0.91415596f, 0.17835021f},
-std::array<float,2>{0.461977571f, 0.552383661f},
-std::array<float,2>{0.245852023f, 0.315962285f},
-std::array<float,2>{0.558579028f, 0.978246748f},
-std::array<float,2>{0.607023478f, 0.189112827f},
-std::array<float,2>{0.184784219f, 0.585653305f},
-std::array<float,2>{0.406310946f, 0.282810062f},
-std::array<float,2>{0.991865814f, 0.881532967f},
-std::array<float,2>{0.773715794f, 0.421277106f},
-std::array<float,2>{0.353233665f, 0.811813891f},
-std::array<float,2>{0.0357339904f, 0.0349780321f},
-std::array<float,2>{0.724177599f, 0.673288107f},
-std::array<float,2>{0.637626112f, 0.325351924f},
-std::array<float,2>{0.0836649314f, 0.972948968f},
-std::array<float,2>{0.303025126f, 0.18294704f},
-std::array<float,2>{0.870275915f, 0.559125841f},
-std::array<float,2>{0.880237401f, 0.0751544386f},
-std::array<float,2>{0.498463094f, 0.69842881f},
-std::array<float,2>{0.210018843f, 0.455847263f},
-std::array<float,2>{0.510380387f, 0.84821403f},
-std::array<float,2>{0.702705801f, 0.0128944516f},
-std::array<float,2>{0.0140475295f, 0.645662308f},
-std::array<float,2>{0.318676591f, 0.381974429f},
-std::array<float,2>{0.79695791f, 0.774559319f},
-std::array<float,2>{0.959980965f, 0.256864458f},
-std::array<float,2>{0.40265435f, 0.918882012f},
-std::array<float,2>{0.139172018f, 0.241695642f},
-std::array<float,2>{0.586886048f, 0.60955888f},
-std::array<float,2>{0.553744256f, 0.487698615f},
-std::array<float,2>{0.240665957f, 0.818698585f},
-std::array<float,2>{0.456249535f, 0.109437302f},
-std::array<float,2>{0.910798848f, 0.740598023f},
-std::array<float,2>{0.829984486f, 0.131133184f},
-std::array<float,2>{0.27172187f, 0.520786881f},
-std::array<float,2>{0.124028601f, 0.362609804f},
-std::array<float,2>{0.660603344f, 0.940848708f},
-std::array<float,2>{0.682362914f, 0.163700163f},
-std::array<float,2>{0.095169194f, 0.545382559f},
-std::array<float,2>{0.252038956f, 0.342272609f},
-std::array<float,2>{0.819904268f, 0.994707584f},
-std::array<float,2>{0.934815764f, 0.444924325f},
-std::array<float,2>{0.438825697f, 0.871722519f},
-std::array<float,2>{0.22743842f, 0.085491024f},
-std::array<float,2>{0.545345008f, 0.711478233f},
-std::array<float,2>{0.57059592f, 0.310669899f},
-std::array<float,2>{0.151922628f, 0.899443209f},
-std::array<float,2>{0.382025301f, 0.209951296f},
-std::array<float,2>{0.942806184f, 0.571824074f},
-std::array<float,2>{0.794544637f, 0.0477373488f},
-std::array<float,2>{0.333532363f, 0.667619944f},
-std::array<float,2>{0.016172383f, 0.436339766f},
-std::array<float,2>{0.714554787f, 0.795371532f},
-std::array<float,2>{0.516326368f, 0.0965867788f},
-std::array<float,2>{0.198823184f, 0.725964904f},
-std::array<float,2>{0.473415911f, 0.471368611f},
-std::array<float,2>{0.90281409f, 0.837615907f},
-std::array<float,2>{0.853241861f, 0.343774527f},
-std::array<float,2>{0.294868857f, 0.954916716f},
-std::array<float,2>{0.0776237994f, 0.146968588f},
-std::array<float,2>{0.655458987f, 0.504766107f},
-std::array<float,2>{0.737066805f, 0.401226759f},
-std::array<float,2>{0.0596595332f, 0.755939662f},
-std::array<float,2>{0.368985415f, 0.021579193f},
-std::array<float,2>{0.761373341f, 0.634900093f},
-std::array<float,2>{0.973475456f, 0.229007006f},
-std::array<float,2>{0.437465698f, 0.607503891f},
-std::array<float,2>{0.159046486f, 0.27141574f},
-std::array<float,2>{0.618667781f, 0.924009144f},
-std::array<float,2>{0.565945625f, 0.185252488f},
-std::array<float,2>{0.144359723f, 0.558140039f},
-std::array<float,2>{0.388828725f, 0.320692718f},
-std::array<float,2>{0.946346939f, 0.969701052f},
-std::array<float,2>{0.782287359f, 0.460416287f},
-std::array<float,2>{0.342401236f, 0.846558034f},
-std::array<float,2>{0.0255669318f, 0.0726336613f},
-std::array<float,2>{0.706345975f, 0.702120662f},
-std::array<float,2>{0.676788092f, 0.288332552f},
-std::array<float,2>{0.105770916f, 0.876699865f},
-std::array<float,2>{0.257904887f, 0.19480896f},
-std::array<float,2>{0.823733866f, 0.578693271f},
-std::array<float,2>{0.923007131f, 0.0354971699f},
-std::array<float,2>{0.446464777f, 0.677428603f},
-std::array<float,2>{0.22357814f, 0.414079636f},
-std::array<float,2>{0.532581449f, 0.805325925f},
-std::array<float,2>{0.742593884f, 0.114094488f},
-std::array<float,2>{0.050549414f, 0.736008823f},
-std::array<float,2>{0.363824964f, 0.488399178f},
-std::array<float,2>{0.757451117f, 0.815125823f},
-std::array<float,2>{0.983033776f, 0.366658747f},
-std::array<float,2>{0.426466972f, 0.944055676f},
-std::array<float,2>{0.17064862f, 0.128115579f},
-std::array<float,2>{0.615060151f, 0.518951833f},
-std::array<float,2>{0.526944637f, 0.378461212f},
-std::array<float,2>{0.190046325f, 0.777893424f},
-std::array<float,2>{0.482186168f, 0.00923614576f},
-std::array<float,2>{0.895864785f, 0.641821742f},
-std::array<float,2>{0.849972665f, 0.234853417f},
-std::array<float,2>{0.287511915f, 0.616618574f},
-std::array<float,2>{0.069364734f, 0.251882106f},
-std::array<float,2>{0.646177888f, 0.917327166f},
-std::array<float,2>{0.63210237f, 0.204229176f},
-std::array<float,2>{0.0863438919f, 0.577571809f},
-std::array<float,2>{0.306933165f, 0.307325989f},
-std::array<float,2>{0.863729537f, 0.902476013f},
-std::array<float,2>{0.889693022f, 0.432789385f},
-std::array<float,2>{0.486250222f, 0.789551735f},
-std::array<float,2>{0.217272669f, 0.0542721562f},
-std::array<float,2>{0.506042778f, 0.668452621f},
-std::array<float,2>{0.598412216f, 0.338029623f},
-std::array<float,2>{0.175166354f, 0.999746442f},
-std::array<float,2>{0.415363908f, 0.159791097f},
-std::array<float,2>{0.99838537f, 0.540215015f},
-std::array<float,2>{0.76909858f, 0.080978781f},
-std::array<float,2>{0.346419901f, 0.717761576f},
-std::array<float,2>{0.0440949723f, 0.440604419f},
-std::array<float,2>{0.732198119f, 0.870789886f},
-std::array<float,2>{0.558970153f, 0.0167958643f},
-std::array<float,2>{0.249044374f, 0.637912214f},
-std::array<float,2>{0.46635285f, 0.405313581f},
-std::array<float,2>{0.920829117f, 0.753416717f},
-std::array<float,2>{0.836533368f, 0.266152292f},
-std::array<float,2>{0.276296914f, 0.926470101f},
-std::array<float,2>{0.113363281f, 0.23396267f},
-std::array<float,2>{0.665225923f, 0.603654087f},
-std::array<float,2>{0.688276768f, 0.474524617f},
-std::array<float,2>{0.000425226375f, 0.839994848f},
-std::array<float,2>{0.320801705f, 0.100559957f},
-std::array<float,2>{0.811159372f, 0.719945312f},
-std::array<float,2>{0.961915314f, 0.142545238f},
-std::array<float,2>{0.39734751f, 0.501529753f},
-std::array<float,2>{0.126580536f, 0.349868059f},
-std::array<float,2>{0.584537327f, 0.959365189f},
-std::array<float,2>{0.513437629f, 0.21886152f},
-std::array<float,2>{0.203554571f, 0.597632051f},
-std::array<float,2>{0.495719552f, 0.274284393f},
-std::array<float,2>{0.876178861f, 0.936163425f},
-std::array<float,2>{0.872390449f, 0.390740901f},
-std::array<float,2>{0.297019511f, 0.762365878f},
-std::array<float,2>{0.0800703391f, 0.0280922167f},
-std::array<float,2>{0.635460973f, 0.631869793f},
-std::array<float,2>{0.720344365f, 0.356244475f},
-std::array<float,2>{0.0325204693f, 0.964832425f},
-std::array<float,2>{0.358688861f, 0.14889282f},
-std::array<float,2>{0.778228521f, 0.509385288f},
-std::array<float,2>{0.986582816f, 0.108933158f},
-std::array<float,2>{0.413333088f, 0.728509545f},
-std::array<float,2>{0.179946274f, 0.477501184f},
-std::array<float,2>{0.603231609f, 0.82865268f},
-std::array<float,2>{0.659079611f, 0.0596958846f},
-std::array<float,2>{0.118233256f, 0.662109613f},
-std::array<float,2>{0.267107099f, 0.424474835f},
-std::array<float,2>{0.834851682f, 0.783298731f},
-std::array<float,2>{0.90675509f, 0.304533243f},
-std::array<float,2>{0.457264841f, 0.892660975f},
-std::array<float,2>{0.237331033f, 0.212076426f},
-std::array<float,2>{0.549842656f, 0.566844761f},
-std::array<float,2>{0.590651333f, 0.448255956f},
-std::array<float,2>{0.134105697f, 0.865506768f},
-std::array<float,2>{0.401635379f, 0.0872538611f},
-std::array<float,2>{0.954700768f, 0.704107881f},
-std::array<float,2>{0.801149011f, 0.169586256f},
-std::array<float,2>{0.313213259f, 0.533955693f},
-std::array<float,2>{0.0110153668f, 0.33203581f},
-std::array<float,2>{0.696015537f, 0.989189088f},
-std::array<float,2>{0.714862227f, 0.137418389f},
-std::array<float,2>{0.0229136571f, 0.529657841f},
-std::array<float,2>{0.331173897f, 0.371408999f},
-std::array<float,2>{0.78919822f, 0.946439385f},
-std::array<float,2>{0.940115094f, 0.492432088f},
-std::array<float,2>{0.378646702f, 0.82672596f},
-std::array<float,2>{0.155105889f, 0.123270065f},
-std::array<float,2>{0.576051652f, 0.747274995f},
-std::array<float,2>{0.541177869f, 0.264228225f},
-std::array<float,2>{0.231460273f, 0.911588728f},
-std::array<float,2>{0.441859454f, 0.249330133f},
-std::array<float,2>{0.930691242f, 0.620769083f},
-std::array<float,2>{0.815756679f, 0.00384163903f},
-std::array<float,2>{0.254017711f, 0.652776897f},
-std::array<float,2>{0.0999219492f, 0.390593737f},
-std::array<float,2>{0.685186684f, 0.769978106f},
-std::array<float,2>{0.624505103f, 0.0688809529f},
-std::array<float,2>{0.162197351f, 0.694993198f},
-std::array<float,2>{0.430470347f, 0.464634955f},
-std::array<float,2>{0.970737576f, 0.856079102f},
-std::array<float,2>{0.762997687f, 0.317331433f},
-std::array<float,2>{0.371792644f, 0.980705619f},
-std::array<float,2>{0.0578468591f, 0.175070852f},
-std::array<float,2>{0.738688529f, 0.54834038f},
-std::array<float,2>{0.649434745f, 0.408695817f},
-std::array<float,2>{0.0727248937f, 0.803425789f},
-std::array<float,2>{0.292317778f, 0.0391090848f},
-std::array<float,2>{0.85851419f, 0.683127582f},
-std::array<float,2>{0.900028706f, 0.200095907f},
-std::array<float,2>{0.471464366f, 0.593526363f},
-std::array<float,2>{0.199281096f, 0.292592317f},
-std::array<float,2>{0.521208227f, 0.889784217f},
-std::array<float,2>{0.557468355f, 0.177339733f},
-std::array<float,2>{0.24426347f, 0.55275017f},
-std::array<float,2>{0.461332113f, 0.313995391f},
-std::array<float,2>{0.91563201f, 0.98009181f},
-std::array<float,2>{0.843272507f, 0.466778874f},
-std::array<float,2>{0.277543634f, 0.854756653f},
-std::array<float,2>{0.109938897f, 0.0652900264f},
-std::array<float,2>{0.669973254f, 0.687936187f},
-std::array<float,2>{0.691575229f, 0.293272436f},
-std::array<float,2>{0.00671880692f, 0.885844231f},
-std::array<float,2>{0.324766666f, 0.195907936f},
-std::array<float,2>{0.805736184f, 0.58932513f},
-std::array<float,2>{0.96551162f, 0.0463028029f},
-std::array<float,2>{0.39359951f, 0.686837494f},
-std::array<float,2>{0.129431024f, 0.412176192f},
-std::array<float,2>{0.581162572f, 0.799383521f},
-std::array<float,2>{0.625130534f, 0.117427312f},
-std::array<float,2>{0.0910982117f, 0.743573308f},
-std::array<float,2>{0.311996311f, 0.496755779f},
-std::array<float,2>{0.859493434f, 0.823075056f},
-std::array<float,2>{0.885456622f, 0.3674725f},
-std::array<float,2>{0.491396427f, 0.952092052f},
-std::array<float,2>{0.213842899f, 0.133953214f},
-std::array<float,2>{0.502837121f, 0.527341783f},
-std::array<float,2>{0.596707404f, 0.385549664f},
-std::array<float,2>{0.175872192f, 0.76723671f},
-std::array<float,2>{0.420464516f, 0.00567979272f},
-std::array<float,2>{0.99394542f, 0.649736643f},
-std::array<float,2>{0.773279309f, 0.24540782f},
-std::array<float,2>{0.350857526f, 0.622587979f},
-std::array<float,2>{0.0424911305f, 0.258386791f},
-std::array<float,2>{0.727855086f, 0.90855968f},
-std::array<float,2>{0.746909916f, 0.214924037f},
-std::array<float,2>{0.0526048504f, 0.565308928f},
-std::array<float,2>{0.361419857f, 0.300532043f},
-std::array<float,2>{0.751030982f, 0.896152496f},
-std::array<float,2>{0.977361381f, 0.425885707f},
-std::array<float,2>{0.424320012f, 0.787517965f},
-std::array<float,2>{0.166805223f, 0.0579330511f},
-std::array<float,2>{0.610856652f, 0.657895148f},
-std::array<float,2>{0.529033661f, 0.331516892f},
-std::array<float,2>{0.193086192f, 0.984443069f},
-std::array<float,2>{0.477114677f, 0.166168645f},
-std::array<float,2>{0.893553078f, 0.535632312f},
-std::array<float,2>{0.845664561f, 0.0922047868f},
-std::array<float,2>{0.281978011f, 0.709543824f},
-std::array<float,2>{0.0638177767f, 0.44984448f},
-std::array<float,2>{0.640747368f, 0.860300481f},
-std::array<float,2>{0.567811549f, 0.025977442f},
-std::array<float,2>{0.145381138f, 0.627468109f},
-std::array<float,2>{0.383387178f, 0.395358443f},
-std::array<float,2>{0.952122808f, 0.758173406f},
-std::array<float,2>{0.785365939f, 0.278218627f},
-std::array<float,2>{0.339224875f, 0.933296263f},
-std::array<float,2>{0.0302654002f, 0.224167258f},
-std::array<float,2>{0.708542705f, 0.600847423f},
-std::array<float,2>{0.674201667f, 0.480904728f},
-std::array<float,2>{0.101642594f, 0.832878649f},
-std::array<float,2>{0.264235288f, 0.102726579f},
-std::array<float,2>{0.824876785f, 0.733332813f},
-std::array<float,2>{0.92662245f, 0.15294832f},
-std::array<float,2>{0.450184077f, 0.514607906f},
-std::array<float,2>{0.218848526f, 0.353440553f},
-std::array<float,2>{0.537432432f, 0.967842221f},
-std::array<float,2>{0.617912471f, 0.228175923f},
-std::array<float,2>{0.159629077f, 0.60677588f},
-std::array<float,2>{0.436445892f, 0.272598892f},
-std::array<float,2>{0.973731518f, 0.922953546f},
-std::array<float,2>{0.760415733f, 0.398675114f},
-std::array<float,2>{0.368021637f, 0.753937304f},
-std::array<float,2>{0.0590575077f, 0.0203034487f},
-std::array<float,2>{0.73819989f, 0.633546591f},
-std::array<float,2>{0.654375553f, 0.347617716f},
-std::array<float,2>{0.0762901083f, 0.955116093f},
-std::array<float,2>{0.293623298f, 0.145813972f},
-std::array<float,2>{0.852422655f, 0.506964207f},
-std::array<float,2>{0.903435111f, 0.0938401967f},
-std::array<float,2>{0.474113852f, 0.724254131f},
-std::array<float,2>{0.197300896f, 0.470170319f},
-std::array<float,2>{0.516638517f, 0.838760018f},
-std::array<float,2>{0.713031232f, 0.0493097417f},
-std::array<float,2>{0.016672723f, 0.665082157f},
-std::array<float,2>{0.33293727f, 0.435462475f},
-std::array<float,2>{0.793386102f, 0.794669271f},
-std::array<float,2>{0.941948831f, 0.30901435f},
-std::array<float,2>{0.380907804f, 0.90041244f},
-std::array<float,2>{0.150448129f, 0.207089484f},
-std::array<float,2>{0.571980894f, 0.574114799f},
-std::array<float,2>{0.545928001f, 0.442553937f},
-std::array<float,2>{0.22807835f, 0.874629557f},
-std::array<float,2>{0.438460499f, 0.0833760351f},
-std::array<float,2>{0.934088647f, 0.714295566f},
-std::array<float,2>{0.818385422f, 0.160165653f},
-std::array<float,2>{0.253302068f, 0.544087112f},
-std::array<float,2>{0.0946986526f, 0.341298044f},
-std::array<float,2>{0.683102012f, 0.992571652f},
-std::array<float,2>{0.662033021f, 0.129071698f},
-std::array<float,2>{0.123616815f, 0.523378134f},
-std::array<float,2>{0.273054093f, 0.359560817f},
-std::array<float,2>{0.828908861f, 0.938677132f},
-std::array<float,2>{0.911928713f, 0.484434903f},
-std::array<float,2>{0.455242276f, 0.818234622f},
-std::array<float,2>{0.241311789f, 0.11164327f},
-std::array<float,2>{0.55358541f, 0.738717496f},
-std::array<float,2>{0.587814987f, 0.255286038f},
-std::array<float,2>{0.139812246f, 0.92115134f},
-std::array<float,2>{0.404202461f, 0.238653362f},
-std::array<float,2>{0.959936738f, 0.61182642f},
-std::array<float,2>{0.798479617f, 0.0141425747f},
-std::array<float,2>{0.319971621f, 0.648180723f},
-std::array<float,2>{0.0154091027f, 0.380034715f},
-std::array<float,2>{0.70196718f, 0.776291549f},
-std::array<float,2>{0.511142015f, 0.0762323737f},
-std::array<float,2>{0.209280372f, 0.696293175f},
-std::array<float,2>{0.499456972f, 0.454464942f},
-std::array<float,2>{0.878983498f, 0.850279391f},
-std::array<float,2>{0.870054483f, 0.326866806f},
-std::array<float,2>{0.304303735f, 0.975511789f},
-std::array<float,2>{0.0826683491f, 0.181077093f},
-std::array<float,2>{0.637989044f, 0.561374664f},
-std::array<float,2>{0.723300278f, 0.419624448f},
-std::array<float,2>{0.0365795493f, 0.808878064f},
-std::array<float,2>{0.351773024f, 0.0320288986f},
-std::array<float,2>{0.77516222f, 0.675181091f},
-std::array<float,2>{0.990763962f, 0.191392317f},
-std::array<float,2>{0.408124f, 0.582887828f},
-std::array<float,2>{0.183712006f, 0.283658832f},
-std::array<float,2>{0.605861306f, 0.879411161f},
-std::array<float,2>{0.585440993f, 0.143775254f},
-std::array<float,2>{0.125538602f, 0.502222955f},
-std::array<float,2>{0.397562325f, 0.349105239f},
-std::array<float,2>{0.961556733f, 0.95710355f},
-std::array<float,2>{0.811946273f, 0.475221574f},
-std::array<float,2>{0.322103441f, 0.843188107f},
-std::array<float,2>{0.00190102856f, 0.0991894901f},
-std::array<float,2>{0.688735068f, 0.721150994f},
-std::array<float,2>{0.664524555f, 0.269444019f},
-std::array<float,2>{0.115038335f, 0.928752005f},
-std::array<float,2>{0.27677992f, 0.231005505f},
-std::array<float,2>{0.837359011f, 0.602413774f},
-std::array<float,2>{0.921065092f, 0.0190789066f},
-std::array<float,2>{0.464943677f, 0.639711976f},
-std::array<float,2>{0.248723537f, 0.403686345f},
-std::array<float,2>{0.559993386f, 0.751052082f},
-std::array<float,2>{0.731253862f, 0.0798922479f},
-std::array<float,2>{0.0430015735f, 0.716393173f},
-std::array<float,2>{0.347263873f, 0.438885152f},
-std::array<float,2>{0.76766783f, 0.868929148f},
-std::array<float,2>{0.999194026f, 0.33761102f},
-std::array<float,2>{0.414093137f, 0.996413052f},
-std::array<float,2>{0.174133509f, 0.156771779f},
-std::array<float,2>{0.599015534f, 0.54160881f},
-std::array<float,2>{0.506846845f, 0.430453569f},
-std::array<float,2>{0.218655288f, 0.792181671f},
-std::array<float,2>{0.484765828f, 0.0515265018f},
-std::array<float,2>{0.888867497f, 0.671308935f},
-std::array<float,2>{0.865126371f, 0.205277994f},
-std::array<float,2>{0.308561325f, 0.574284554f},
-std::array<float,2>{0.0869757384f, 0.305862725f},
-std::array<float,2>{0.631720245f, 0.904934824f},
-std::array<float,2>{0.644982815f, 0.236931354f},
-std::array<float,2>{0.068574436f, 0.61444366f},
-std::array<float,2>{0.28861177f, 0.252212822f},
-std::array<float,2>{0.851249576f, 0.914629996f},
-std::array<float,2>{0.895039499f, 0.376221895f},
-std::array<float,2>{0.481276631f, 0.779539347f},
-std::array<float,2>{0.190883234f, 0.0102343829f},
-std::array<float,2>{0.525442839f, 0.643864036f},
-std::array<float,2>{0.613665462f, 0.364388138f},
-std::array<float,2>{0.171646565f, 0.94325316f},
-std::array<float,2>{0.427572131f, 0.125086844f},
-std::array<float,2>{0.98429203f, 0.517166197f},
-std::array<float,2>{0.756239057f, 0.115324438f},
-std::array<float,2>{0.364320517f, 0.736904085f},
-std::array<float,2>{0.0495752841f, 0.490719438f},
-std::array<float,2>{0.743209898f, 0.812761426f},
-std::array<float,2>{0.531373262f, 0.0384023078f},
-std::array<float,2>{0.223980129f, 0.67876929f},
-std::array<float,2>{0.44593513f, 0.417790562f},
-std::array<float,2>{0.921988368f, 0.807647526f},
-std::array<float,2>{0.822639525f, 0.285719693f},
-std::array<float,2>{0.258911043f, 0.877442718f},
-std::array<float,2>{0.106883273f, 0.192844972f},
-std::array<float,2>{0.675886035f, 0.581163466f},
-std::array<float,2>{0.70560354f, 0.45883882f},
-std::array<float,2>{0.0272945855f, 0.844889581f},
-std::array<float,2>{0.343288392f, 0.071946241f},
-std::array<float,2>{0.781266689f, 0.699629724f},
-std::array<float,2>{0.946115732f, 0.185923979f},
-std::array<float,2>{0.3900446f, 0.554906428f},
-std::array<float,2>{0.142697543f, 0.322324127f},
-std::array<float,2>{0.564578056f, 0.971915245f},
-std::array<float,2>{0.519624829f, 0.202372834f},
-std::array<float,2>{0.201131821f, 0.591698587f},
-std::array<float,2>{0.471692055f, 0.289736837f},
-std::array<float,2>{0.898831367f, 0.887614369f},
-std::array<float,2>{0.858044982f, 0.407620966f},
-std::array<float,2>{0.291195661f, 0.801662326f},
-std::array<float,2>{0.0733732879f, 0.0422485098f},
-std::array<float,2>{0.649295568f, 0.680995643f},
-std::array<float,2>{0.73991555f, 0.318769544f},
-std::array<float,2>{0.0566869266f, 0.982699752f},
-std::array<float,2>{0.372321725f, 0.173314288f},
-std::array<float,2>{0.762289762f, 0.549576223f},
-std::array<float,2>{0.972112715f, 0.0670917556f},
-std::array<float,2>{0.431104362f, 0.693310201f},
-std::array<float,2>{0.163731247f, 0.462470472f},
-std::array<float,2>{0.623179495f, 0.857985198f},
-std::array<float,2>{0.683964431f, 0.000831255806f},
-std::array<float,2>{0.101193912f, 0.655800939f},
-std::array<float,2>{0.254893243f, 0.388501436f},
-std::array<float,2>{0.815118909f, 0.773363829f},
-std::array<float,2>{0.930356443f, 0.262525618f},
-std::array<float,2>{0.443254054f, 0.914051116f},
-std::array<float,2>{0.23058708f, 0.246882424f},
-std::array<float,2>{0.542241931f, 0.617386878f},
-std::array<float,2>{0.57423079f, 0.494377822f},
-std::array<float,2>{0.155532703f, 0.824278414f},
-std::array<float,2>{0.377922148f, 0.121962264f},
-std::array<float,2>{0.940825701f, 0.749887168f},
-std::array<float,2>{0.790057898f, 0.139922231f},
-std::array<float,2>{0.330729842f, 0.527762353f},
-std::array<float,2>{0.0220644958f, 0.37349233f},
-std::array<float,2>{0.716081977f, 0.94750607f},
-std::array<float,2>{0.696513295f, 0.17109926f},
-std::array<float,2>{0.00978445169f, 0.531324446f},
-std::array<float,2>{0.313784331f, 0.335072577f},
-std::array<float,2>{0.802311718f, 0.99151355f},
-std::array<float,2>{0.953469634f, 0.445727497f},
-std::array<float,2>{0.40125531f, 0.864923656f},
-std::array<float,2>{0.133138597f, 0.0892046988f},
-std::array<float,2>{0.591092825f, 0.70546937f},
-std::array<float,2>{0.549423456f, 0.300874323f},
-std::array<float,2>{0.237186372f, 0.89217484f},
-std::array<float,2>{0.458891153f, 0.213658884f},
-std::array<float,2>{0.907509267f, 0.568771541f},
-std::array<float,2>{0.835278571f, 0.0617081113f},
-std::array<float,2>{0.266283512f, 0.660509169f},
-std::array<float,2>{0.117286585f, 0.423545063f},
-std::array<float,2>{0.659380913f, 0.782811403f},
-std::array<float,2>{0.60169667f, 0.106064171f},
-std::array<float,2>{0.181556568f, 0.730240166f},
-std::array<float,2>{0.412223965f, 0.479779631f},
-std::array<float,2>{0.987788856f, 0.831843197f},
-std::array<float,2>{0.778978229f, 0.359353334f},
-std::array<float,2>{0.358190447f, 0.961422145f},
-std::array<float,2>{0.0318866484f, 0.152311876f},
-std::array<float,2>{0.719488263f, 0.510570347f},
-std::array<float,2>{0.635900199f, 0.393077195f},
-std::array<float,2>{0.0784236565f, 0.764964521f},
-std::array<float,2>{0.298566639f, 0.0295267683f},
-std::array<float,2>{0.871999085f, 0.62971735f},
-std::array<float,2>{0.875623524f, 0.2221075f},
-std::array<float,2>{0.494953692f, 0.593773663f},
-std::array<float,2>{0.204449356f, 0.276932538f},
-std::array<float,2>{0.512694895f, 0.935040712f},
-std::array<float,2>{0.500495851f, 0.135886103f},
-std::array<float,2>{0.212747693f, 0.525228083f},
-std::array<float,2>{0.488924682f, 0.37103802f},
-std::array<float,2>{0.883646488f, 0.950949371f},
-std::array<float,2>{0.86196965f, 0.49992916f},
-std::array<float,2>{0.310467273f, 0.820487678f},
-std::array<float,2>{0.0931373388f, 0.120990373f},
-std::array<float,2>{0.627454817f, 0.745683551f},
-std::array<float,2>{0.729746699f, 0.26014784f},
-std::array<float,2>{0.0398125499f, 0.907399356f},
-std::array<float,2>{0.347778857f, 0.243657991f},
-std::array<float,2>{0.771377385f, 0.623431444f},
-std::array<float,2>{0.994625568f, 0.00778950471f},
-std::array<float,2>{0.41822806f, 0.651509106f},
-std::array<float,2>{0.178728819f, 0.38329488f},
-std::array<float,2>{0.594461739f, 0.769466162f},
-std::array<float,2>{0.668942153f, 0.0633878335f},
-std::array<float,2>{0.112472512f, 0.690239549f},
-std::array<float,2>{0.279364377f, 0.468381494f},
-std::array<float,2>{0.841191411f, 0.853514493f},
-std::array<float,2>{0.917810321f, 0.314729154f},
-std::array<float,2>{0.463103712f, 0.977175772f},
-std::array<float,2>{0.244135693f, 0.178926602f},
-std::array<float,2>{0.556482255f, 0.551066637f},
-std::array<float,2>{0.579072237f, 0.410901159f},
-std::array<float,2>{0.131131664f, 0.797526658f},
-std::array<float,2>{0.392341524f, 0.044882562f},
-std::array<float,2>{0.967481136f, 0.684153438f},
-std::array<float,2>{0.808375537f, 0.19792442f},
-std::array<float,2>{0.328033507f, 0.586214364f},
-std::array<float,2>{0.00509322202f, 0.295976311f},
-std::array<float,2>{0.695292711f, 0.882916927f},
-std::array<float,2>{0.709382892f, 0.225725248f},
-std::array<float,2>{0.0275250096f, 0.59767288f},
-std::array<float,2>{0.335963726f, 0.27997601f},
-std::array<float,2>{0.788199186f, 0.929943323f},
-std::array<float,2>{0.950845718f, 0.398148894f},
-std::array<float,2>{0.386460155f, 0.760079801f},
-std::array<float,2>{0.147660092f, 0.0242142621f},
-std::array<float,2>{0.569597185f, 0.626433849f},
-std::array<float,2>{0.536440492f, 0.354840457f},
-std::array<float,2>{0.221311554f, 0.966460645f},
-std::array<float,2>{0.452486157f, 0.156173453f},
-std::array<float,2>{0.929640591f, 0.513070047f},
-std::array<float,2>{0.827354908f, 0.104474619f},
-std::array<float,2>{0.263023674f, 0.731382966f},
-std::array<float,2>{0.10360612f, 0.483924747f},
-std::array<float,2>{0.672439635f, 0.834219217f},
-std::array<float,2>{0.612082541f, 0.0566241033f},
-std::array<float,2>{0.164112851f, 0.658218861f},
-std::array<float,2>{0.422633886f, 0.428617299f},
-std::array<float,2>{0.979942381f, 0.78605336f},
-std::array<float,2>{0.75256896f, 0.297515035f},
-std::array<float,2>{0.360174358f, 0.898118615f},
-std::array<float,2>{0.0541867018f, 0.217336163f},
-std::array<float,2>{0.748348713f, 0.564060688f},
-std::array<float,2>{0.64446038f, 0.453058511f},
-std::array<float,2>{0.0661517829f, 0.861445248f},
-std::array<float,2>{0.283763647f, 0.0908856541f},
-std::array<float,2>{0.847226918f, 0.70769453f},
-std::array<float,2>{0.891122401f, 0.165399075f},
-std::array<float,2>{0.479596019f, 0.537993312f},
-std::array<float,2>{0.194583684f, 0.328220159f},
-std::array<float,2>{0.530029655f, 0.987577617f},
-std::array<float,2>{0.572980046f, 0.210392922f},
-std::array<float,2>{0.149280578f, 0.570339978f},
-std::array<float,2>{0.379564077f, 0.312427074f},
-std::array<float,2>{0.944038928f, 0.89899528f},
-std::array<float,2>{0.796481729f, 0.436703146f},
-std::array<float,2>{0.334356219f, 0.796414137f},
-std::array<float,2>{0.0181153826f, 0.0480670817f},
-std::array<float,2>{0.712371767f, 0.666813314f},
-std::array<float,2>{0.681497753f, 0.343394756f},
-std::array<float,2>{0.096389398f, 0.995867848f},
-std::array<float,2>{0.250510544f, 0.162635118f},
-std::array<float,2>{0.816668451f, 0.546607375f},
-std::array<float,2>{0.936670065f, 0.0846448466f},
-std::array<float,2>{0.441342205f, 0.71279937f},
-std::array<float,2>{0.230447099f, 0.444215268f},
-std::array<float,2>{0.544355392f, 0.872887075f},
-std::array<float,2>{0.735524774f, 0.0233439133f},
-std::array<float,2>{0.0608953945f, 0.636348128f},
-std::array<float,2>{0.370627701f, 0.401614875f},
-std::array<float,2>{0.759062111f, 0.75763309f},
-std::array<float,2>{0.976428032f, 0.269922048f},
-std::array<float,2>{0.435437262f, 0.925608099f},
-std::array<float,2>{0.156650275f, 0.230007172f},
-std::array<float,2>{0.619449615f, 0.609303772f},
-std::array<float,2>{0.518294573f, 0.471804827f},
-std::array<float,2>{0.19709681f, 0.836705208f},
-std::array<float,2>{0.47574228f, 0.0966996774f},
-std::array<float,2>{0.905156434f, 0.724877656f},
-std::array<float,2>{0.854628921f, 0.148053899f},
-std::array<float,2>{0.296613425f, 0.505706251f},
-std::array<float,2>{0.0754187703f, 0.344876528f},
-std::array<float,2>{0.652379632f, 0.953483999f},
-std::array<float,2>{0.640285552f, 0.181864455f},
-std::array<float,2>{0.0855409727f, 0.559646189f},
-std::array<float,2>{0.301717341f, 0.324294269f},
-std::array<float,2>{0.868800759f, 0.974336803f},
-std::array<float,2>{0.881537914f, 0.456282437f},
-std::array<float,2>{0.496159464f, 0.848907828f},
-std::array<float,2>{0.207259268f, 0.0753553733f},
-std::array<float,2>{0.509183049f, 0.697520673f},
-std::array<float,2>{0.607878566f, 0.281543851f},
-std::array<float,2>{0.187289551f, 0.882188261f},
-std::array<float,2>{0.40931204f, 0.188312426f},
-std::array<float,2>{0.988302171f, 0.584644318f},
-std::array<float,2>{0.777239978f, 0.0332668275f},
-std::array<float,2>{0.354191273f, 0.672717035f},
-std::array<float,2>{0.0372758731f, 0.419932812f},
-std::array<float,2>{0.725174785f, 0.810801804f},
-std::array<float,2>{0.551821053f, 0.110533297f},
-std::array<float,2>{0.23936592f, 0.741975784f},
-std::array<float,2>{0.453400731f, 0.487071872f},
-std::array<float,2>{0.912381411f, 0.819737077f},
-std::array<float,2>{0.83163017f, 0.362270534f},
-std::array<float,2>{0.270348519f, 0.940315247f},
-std::array<float,2>{0.122426674f, 0.13266094f},
-std::array<float,2>{0.662159026f, 0.520114005f},
-std::array<float,2>{0.699348092f, 0.381009459f},
-std::array<float,2>{0.0134171555f, 0.773550808f},
-std::array<float,2>{0.317087114f, 0.0118892789f},
-std::array<float,2>{0.800019324f, 0.645102441f},
-std::array<float,2>{0.95716399f, 0.240402445f},
-std::array<float,2>{0.405335695f, 0.610839307f},
-std::array<float,2>{0.13767603f, 0.256207764f},
-std::array<float,2>{0.588775337f, 0.919073462f},
-std::array<float,2>{0.60030663f, 0.158691138f},
-std::array<float,2>{0.173453376f, 0.539156139f},
-std::array<float,2>{0.417340428f, 0.33945787f},
-std::array<float,2>{0.996150494f, 0.998915672f},
-std::array<float,2>{0.766857862f, 0.440286607f},
-std::array<float,2>{0.345331371f, 0.869154036f},
-std::array<float,2>{0.0455706902f, 0.0816856548f},
-std::array<float,2>{0.733803332f, 0.718366563f},
-std::array<float,2>{0.629425108f, 0.308187068f},
-std::array<float,2>{0.0880413502f, 0.903852403f},
-std::array<float,2>{0.304933637f, 0.203423217f},
-std::array<float,2>{0.867174566f, 0.577147543f},
-std::array<float,2>{0.887701333f, 0.0535391383f},
-std::array<float,2>{0.487306088f, 0.66966188f},
-std::array<float,2>{0.215570152f, 0.43233946f},
-std::array<float,2>{0.504924655f, 0.790115416f},
-std::array<float,2>{0.690439105f, 0.101357654f},
-std::array<float,2>{0.00314207305f, 0.719533861f},
-std::array<float,2>{0.322705656f, 0.472855508f},
-std::array<float,2>{0.809439421f, 0.841602147f},
-std::array<float,2>{0.964269817f, 0.350595176f},
-std::array<float,2>{0.395549417f, 0.960796833f},
-std::array<float,2>{0.128894955f, 0.140788615f},
-std::array<float,2>{0.583154559f, 0.500651002f},
-std::array<float,2>{0.561655104f, 0.40492183f},
-std::array<float,2>{0.24694252f, 0.751956999f},
-std::array<float,2>{0.468680531f, 0.0163543932f},
-std::array<float,2>{0.919791102f, 0.636810958f},
-std::array<float,2>{0.838720381f, 0.233272403f},
-std::array<float,2>{0.274045438f, 0.604554296f},
-std::array<float,2>{0.116405696f, 0.267104f},
-std::array<float,2>{0.66707474f, 0.927178144f},
-std::array<float,2>{0.678202927f, 0.193948552f},
-std::array<float,2>{0.107717969f, 0.580058575f},
-std::array<float,2>{0.260345697f, 0.287575096f},
-std::array<float,2>{0.822224677f, 0.875497937f},
-std::array<float,2>{0.925728917f, 0.415778428f},
-std::array<float,2>{0.447923154f, 0.806395292f},
-std::array<float,2>{0.225316659f, 0.0369512327f},
-std::array<float,2>{0.534974694f, 0.676627398f},
-std::array<float,2>{0.56313467f, 0.321651757f},
-std::array<float,2>{0.141500145f, 0.97047931f},
-std::array<float,2>{0.387337387f, 0.183906391f},
-std::array<float,2>{0.947876751f, 0.55750525f},
-std::array<float,2>{0.784991205f, 0.07355427f},
-std::array<float,2>{0.340041459f, 0.702992916f},
-std::array<float,2>{0.0243575815f, 0.459857941f},
-std::array<float,2>{0.704928398f, 0.847530246f},
-std::array<float,2>{0.52515161f, 0.00840228703f},
-std::array<float,2>{0.18821311f, 0.64098531f},
-std::array<float,2>{0.484060496f, 0.377674729f},
-std::array<float,2>{0.897727847f, 0.77851361f},
-std::array<float,2>{0.847821176f, 0.250268817f},
-std::array<float,2>{0.285921514f, 0.916931152f},
-std::array<float,2>{0.0683591217f, 0.235756487f},
-std::array<float,2>{0.647607327f, 0.615653634f},
-std::array<float,2>{0.745146215f, 0.489825577f},
-std::array<float,2>{0.0473710373f, 0.815875411f},
-std::array<float,2>{0.365591973f, 0.115060516f},
-std::array<float,2>{0.754763305f, 0.735023737f},
-std::array<float,2>{0.982367694f, 0.127246305f},
-std::array<float,2>{0.428924531f, 0.517796218f},
-std::array<float,2>{0.168275759f, 0.365678817f},
-std::array<float,2>{0.616817713f, 0.944863558f},
-std::array<float,2>{0.540923297f, 0.248841941f},
-std::array<float,2>{0.233882383f, 0.619382322f},
-std::array<float,2>{0.443835527f, 0.264765501f},
-std::array<float,2>{0.933019578f, 0.910728991f},
-std::array<float,2>{0.81283772f, 0.389048994f},
-std::array<float,2>{0.256626219f, 0.771390319f},
-std::array<float,2>{0.0982832462f, 0.00259544235f},
-std::array<float,2>{0.687034965f, 0.654289246f},
-std::array<float,2>{0.718253732f, 0.372678608f},
-std::array<float,2>{0.0208286513f, 0.946177304f},
-std::array<float,2>{0.328210026f, 0.138089284f},
-std::array<float,2>{0.791909754f, 0.531120837f},
-std::array<float,2>{0.938786685f, 0.124554187f},
-std::array<float,2>{0.376254469f, 0.746162593f},
-std::array<float,2>{0.154111475f, 0.494104594f},
-std::array<float,2>{0.576323807f, 0.827194929f},
-std::array<float,2>{0.650650263f, 0.0406821407f},
-std::array<float,2>{0.0717602f, 0.681644142f},
-std::array<float,2>{0.290591061f, 0.410090178f},
-std::array<float,2>{0.856623948f, 0.804465413f},
-std::array<float,2>{0.900854409f, 0.291054964f},
-std::array<float,2>{0.470160067f, 0.889017463f},
-std::array<float,2>{0.201702848f, 0.201167494f},
-std::array<float,2>{0.522925556f, 0.592353225f},
-std::array<float,2>{0.621545851f, 0.463107347f},
-std::array<float,2>{0.160729483f, 0.856673121f},
-std::array<float,2>{0.43330434f, 0.0694499314f},
-std::array<float,2>{0.970274329f, 0.693623066f},
-std::array<float,2>{0.765375018f, 0.174335316f},
-std::array<float,2>{0.374440491f, 0.547187448f},
-std::array<float,2>{0.0555358231f, 0.317388922f},
-std::array<float,2>{0.741178572f, 0.982141554f},
-std::array<float,2>{0.722154617f, 0.150265887f},
-std::array<float,2>{0.0349196047f, 0.507911026f},
-std::array<float,2>{0.357306004f, 0.356472909f},
-std::array<float,2>{0.78055948f, 0.96363461f},
-std::array<float,2>{0.984609425f, 0.477921218f},
-std::array<float,2>{0.411045313f, 0.829563022f},
-std::array<float,2>{0.182442173f, 0.108053349f},
-std::array<float,2>{0.604759455f, 0.727095246f},
-std::array<float,2>{0.514765143f, 0.275030375f},
-std::array<float,2>{0.205964476f, 0.937306285f},
-std::array<float,2>{0.494109929f, 0.220136732f},
-std::array<float,2>{0.878659904f, 0.595936179f},
-std::array<float,2>{0.874694109f, 0.0289225653f},
-std::array<float,2>{0.299901098f, 0.631203592f},
-std::array<float,2>{0.0806923136f, 0.391688883f},
-std::array<float,2>{0.633950472f, 0.763194323f},
-std::array<float,2>{0.592838168f, 0.0861219168f},
-std::array<float,2>{0.136246175f, 0.703887582f},
-std::array<float,2>{0.399843514f, 0.447372884f},
-std::array<float,2>{0.95689857f, 0.866918325f},
-std::array<float,2>{0.803417325f, 0.333698004f},
-std::array<float,2>{0.315193594f, 0.990084469f},
-std::array<float,2>{0.00909942668f, 0.168128282f},
-std::array<float,2>{0.69834125f, 0.534608245f},
-std::array<float,2>{0.657636285f, 0.425540805f},
-std::array<float,2>{0.121013924f, 0.785044789f},
-std::array<float,2>{0.268350482f, 0.0590803549f},
-std::array<float,2>{0.832116961f, 0.663402379f},
-std::array<float,2>{0.908437014f, 0.211837083f},
-std::array<float,2>{0.460217118f, 0.568089128f},
-std::array<float,2>{0.235438854f, 0.303335011f},
-std::array<float,2>{0.547759116f, 0.894149303f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.404176474f, 0.921317995f},
-std::array<float,2>{0.802831054f, 0.455961227f},
-std::array<float,2>{0.022610629f, 0.106110223f},
-std::array<float,2>{0.538703799f, 0.553913474f},
-std::array<float,2>{0.23934333f, 0.662870169f},
-std::array<float,2>{0.639700472f, 0.196814731f},
-std::array<float,2>{0.301571816f, 0.374607354f},
-std::array<float,2>{0.924840093f, 0.792478383f},
-std::array<float,2>{0.0972950235f, 0.843210995f},
-std::array<float,2>{0.598947167f, 0.293811858f},
-std::array<float,2>{0.464018852f, 0.148692995f},
-std::array<float,2>{0.824324131f, 0.701630473f},
-std::array<float,2>{0.367850393f, 0.61876744f},
-std::array<float,2>{0.953862965f, 0.0601075813f},
-std::array<float,2>{0.158547699f, 0.398510635f},
-std::array<float,2>{0.731974244f, 0.993371546f},
-std::array<float,2>{0.256868571f, 0.780036211f},
-std::array<float,2>{0.892888129f, 0.316514075f},
-std::array<float,2>{0.196313053f, 0.225427955f},
-std::array<float,2>{0.672273576f, 0.654334664f},
-std::array<float,2>{0.059927348f, 0.520035207f},
-std::array<float,2>{0.514053345f, 0.0780658573f},
-std::array<float,2>{0.419930965f, 0.480309188f},
-std::array<float,2>{0.765109181f, 0.879785836f},
-std::array<float,2>{0.125523955f, 0.947232425f},
-std::array<float,2>{0.718404651f, 0.406998217f},
-std::array<float,2>{0.340852171f, 0.0171046574f},
-std::array<float,2>{0.990633249f, 0.5916574f},
-std::array<float,2>{0.474008054f, 0.731017113f},
-std::array<float,2>{0.844181478f, 0.173811376f},
-std::array<float,2>{0.0731307268f, 0.251465768f},
-std::array<float,2>{0.563802123f, 0.855016708f},
-std::array<float,2>{0.315024823f, 0.984179139f},
-std::array<float,2>{0.970241845f, 0.38769111f},
-std::array<float,2>{0.152110666f, 0.0328696929f},
-std::array<float,2>{0.692886412f, 0.599349558f},
-std::array<float,2>{0.0932901949f, 0.715031981f},
-std::array<float,2>{0.588364422f, 0.13405785f},
-std::array<float,2>{0.493219405f, 0.301261574f},
-std::array<float,2>{0.862381816f, 0.81392324f},
-std::array<float,2>{0.203849182f, 0.799117863f},
-std::array<float,2>{0.669524491f, 0.356681317f},
-std::array<float,2>{0.27662918f, 0.210646212f},
-std::array<float,2>{0.878706038f, 0.683197677f},
-std::array<float,2>{0.437249511f, 0.545016646f},
-std::array<float,2>{0.772485554f, 0.11897257f},
-std::array<float,2>{0.0427979939f, 0.449927032f},
-std::array<float,2>{0.516488552f, 0.926873803f},
-std::array<float,2>{0.442992628f, 0.871477544f},
-std::array<float,2>{0.837670922f, 0.276973307f},
-std::array<float,2>{0.124007292f, 0.159575582f},
-std::array<float,2>{0.616713881f, 0.741602421f},
-std::array<float,2>{0.18594186f, 0.56421566f},
-std::array<float,2>{0.749034166f, 0.00839997455f},
-std::array<float,2>{0.352914304f, 0.424465597f},
-std::array<float,2>{0.948088884f, 0.964541972f},
-std::array<float,2>{0.0049247737f, 0.893270493f},
-std::array<float,2>{0.554589927f, 0.484994322f},
-std::array<float,2>{0.390256673f, 0.0895064399f},
-std::array<float,2>{0.786920965f, 0.511487424f},
-std::array<float,2>{0.290981859f, 0.634607494f},
-std::array<float,2>{0.921231866f, 0.23705779f},
-std::array<float,2>{0.220744833f, 0.333246708f},
-std::array<float,2>{0.647329926f, 0.755482614f},
-std::array<float,2>{0.489190072f, 0.958998203f},
-std::array<float,2>{0.867590427f, 0.436374217f},
-std::array<float,2>{0.0817810595f, 0.00526532158f},
-std::array<float,2>{0.580338478f, 0.576570511f},
-std::array<float,2>{0.146854803f, 0.747871518f},
-std::array<float,2>{0.701612175f, 0.166175634f},
-std::array<float,2>{0.327246755f, 0.271555841f},
-std::array<float,2>{0.980906427f, 0.861192107f},
-std::array<float,2>{0.0322583392f, 0.764941692f},
-std::array<float,2>{0.530377626f, 0.337985843f},
-std::array<float,2>{0.427231073f, 0.245173648f},
-std::array<float,2>{0.776477695f, 0.627770603f},
-std::array<float,2>{0.266513646f, 0.501476347f},
-std::array<float,2>{0.8897627f, 0.0801881403f},
-std::array<float,2>{0.216569379f, 0.495344043f},
-std::array<float,2>{0.656494498f, 0.905901134f},
-std::array<float,2>{0.344700813f, 0.82279259f},
-std::array<float,2>{0.941611528f, 0.308817506f},
-std::array<float,2>{0.174387157f, 0.128750086f},
-std::array<float,2>{0.739221036f, 0.706448972f},
-std::array<float,2>{0.115673892f, 0.606984258f},
-std::array<float,2>{0.62139678f, 0.0392980613f},
-std::array<float,2>{0.446535617f, 0.377043933f},
-std::array<float,2>{0.834498167f, 0.970028698f},
-std::array<float,2>{0.2317238f, 0.93244046f},
-std::array<float,2>{0.653939784f, 0.443272024f},
-std::array<float,2>{0.282741398f, 0.114666022f},
-std::array<float,2>{0.911426365f, 0.5387609f},
-std::array<float,2>{0.375323832f, 0.675231695f},
-std::array<float,2>{0.794961452f, 0.216686502f},
-std::array<float,2>{0.0102016665f, 0.347177476f},
-std::array<float,2>{0.555459976f, 0.805210292f},
-std::array<float,2>{0.306433499f, 0.889712095f},
-std::array<float,2>{0.937330425f, 0.472394407f},
-std::array<float,2>{0.243260771f, 0.0674750954f},
-std::array<float,2>{0.631837487f, 0.524692476f},
-std::array<float,2>{0.0275584571f, 0.647657692f},
-std::array<float,2>{0.541125834f, 0.227234676f},
-std::array<float,2>{0.391781658f, 0.322606295f},
-std::array<float,2>{0.81115216f, 0.772589982f},
-std::array<float,2>{0.164489955f, 0.844155669f},
-std::array<float,2>{0.722442091f, 0.261773914f},
-std::array<float,2>{0.359728783f, 0.184211984f},
-std::array<float,2>{0.965141296f, 0.721729219f},
-std::array<float,2>{0.45880726f, 0.583578587f},
-std::array<float,2>{0.816634119f, 0.0288132392f},
-std::array<float,2>{0.102108739f, 0.421144962f},
-std::array<float,2>{0.602648258f, 0.938349128f},
-std::array<float,2>{0.409361154f, 0.782262146f},
-std::array<float,2>{0.754564106f, 0.365983635f},
-std::array<float,2>{0.0519960895f, 0.189111531f},
-std::array<float,2>{0.501616597f, 0.664945543f},
-std::array<float,2>{0.193247855f, 0.562429726f},
-std::array<float,2>{0.685779691f, 0.0965044126f},
-std::array<float,2>{0.260139197f, 0.466898024f},
-std::array<float,2>{0.903861582f, 0.909971356f},
-std::array<float,2>{0.0644475892f, 0.987510204f},
-std::array<float,2>{0.570848703f, 0.398339391f},
-std::array<float,2>{0.480940163f, 0.0493681282f},
-std::array<float,2>{0.856378019f, 0.615239024f},
-std::array<float,2>{0.330346465f, 0.693792701f},
-std::array<float,2>{0.998186409f, 0.145372033f},
-std::array<float,2>{0.139186531f, 0.287258416f},
-std::array<float,2>{0.703397512f, 0.833434045f},
-std::array<float,2>{0.468627721f, 0.900684297f},
-std::array<float,2>{0.822341502f, 0.499130279f},
-std::array<float,2>{0.0990037918f, 0.085511446f},
-std::array<float,2>{0.596371174f, 0.505128205f},
-std::array<float,2>{0.161188424f, 0.631426573f},
-std::array<float,2>{0.727576733f, 0.24635762f},
-std::array<float,2>{0.372076869f, 0.341122389f},
-std::array<float,2>{0.957799911f, 0.761479974f},
-std::array<float,2>{0.0161200259f, 0.866827488f},
-std::array<float,2>{0.533377051f, 0.265690804f},
-std::array<float,2>{0.401835322f, 0.171408042f},
-std::array<float,2>{0.800533414f, 0.745788515f},
-std::array<float,2>{0.300586045f, 0.573751986f},
-std::array<float,2>{0.928175747f, 0.00125628384f},
-std::array<float,2>{0.234528512f, 0.432617515f},
-std::array<float,2>{0.634879231f, 0.955838561f},
-std::array<float,2>{0.337519169f, 0.810468614f},
-std::array<float,2>{0.985098779f, 0.350390971f},
-std::array<float,2>{0.130095765f, 0.212526038f},
-std::array<float,2>{0.713406026f, 0.677632272f},
-std::array<float,2>{0.0776144788f, 0.531698287f},
-std::array<float,2>{0.568298578f, 0.111871995f},
-std::array<float,2>{0.472510427f, 0.440972477f},
-std::array<float,2>{0.849521697f, 0.936901987f},
-std::array<float,2>{0.202265531f, 0.975625157f},
-std::array<float,2>{0.677948356f, 0.381539226f},
-std::array<float,2>{0.253105372f, 0.0466743559f},
-std::array<float,2>{0.894741118f, 0.601979256f},
-std::array<float,2>{0.417551905f, 0.707910836f},
-std::array<float,2>{0.760276854f, 0.129139081f},
-std::array<float,2>{0.0577918701f, 0.305351585f},
-std::array<float,2>{0.51045537f, 0.827097178f},
-std::array<float,2>{0.278014302f, 0.941452801f},
-std::array<float,2>{0.880199909f, 0.416547745f},
-std::array<float,2>{0.209127292f, 0.0263907798f},
-std::array<float,2>{0.667247951f, 0.580557883f},
-std::array<float,2>{0.0467987098f, 0.723564565f},
-std::array<float,2>{0.523226917f, 0.181678101f},
-std::array<float,2>{0.432145f, 0.258568943f},
-std::array<float,2>{0.767544806f, 0.848977566f},
-std::array<float,2>{0.152647972f, 0.765884399f},
-std::array<float,2>{0.690326393f, 0.327281237f},
-std::array<float,2>{0.317271024f, 0.231423691f},
-std::array<float,2>{0.974644601f, 0.641786456f},
-std::array<float,2>{0.497719139f, 0.52949512f},
-std::array<float,2>{0.866874576f, 0.0661789402f},
-std::array<float,2>{0.086486496f, 0.474234462f},
-std::array<float,2>{0.592476249f, 0.883324921f},
-std::array<float,2>{0.38524884f, 0.829318643f},
-std::array<float,2>{0.784710348f, 0.284355044f},
-std::array<float,2>{0.00285957358f, 0.142108038f},
-std::array<float,2>{0.548563898f, 0.690913737f},
-std::array<float,2>{0.222793415f, 0.61231637f},
-std::array<float,2>{0.644484937f, 0.0535532944f},
-std::array<float,2>{0.295045018f, 0.391760975f},
-std::array<float,2>{0.916275501f, 0.991243899f},
-std::array<float,2>{0.119214095f, 0.911739886f},
-std::array<float,2>{0.611054599f, 0.464192748f},
-std::array<float,2>{0.43846336f, 0.0995120853f},
-std::array<float,2>{0.84286046f, 0.555357277f},
-std::array<float,2>{0.357045591f, 0.671658397f},
-std::array<float,2>{0.951439381f, 0.192839593f},
-std::array<float,2>{0.181068063f, 0.36301285f},
-std::array<float,2>{0.744881809f, 0.788484156f},
-std::array<float,2>{0.425197929f, 0.999364972f},
-std::array<float,2>{0.780064166f, 0.402997464f},
-std::array<float,2>{0.0372345895f, 0.0579811446f},
-std::array<float,2>{0.523644507f, 0.624819398f},
-std::array<float,2>{0.214312807f, 0.697307169f},
-std::array<float,2>{0.660267234f, 0.152498707f},
-std::array<float,2>{0.271354824f, 0.291791856f},
-std::array<float,2>{0.886301994f, 0.837649167f},
-std::array<float,2>{0.0825021565f, 0.795822442f},
-std::array<float,2>{0.583545566f, 0.368916243f},
-std::array<float,2>{0.486139238f, 0.201720506f},
-std::array<float,2>{0.872262478f, 0.656818151f},
-std::array<float,2>{0.321851999f, 0.548398793f},
-std::array<float,2>{0.977756202f, 0.102096774f},
-std::array<float,2>{0.141820967f, 0.457235873f},
-std::array<float,2>{0.696721733f, 0.916129231f},
-std::array<float,2>{0.285520941f, 0.857290983f},
-std::array<float,2>{0.906502306f, 0.257108182f},
-std::array<float,2>{0.228271708f, 0.177999675f},
-std::array<float,2>{0.652176857f, 0.726685226f},
-std::array<float,2>{0.0118905148f, 0.587184548f},
-std::array<float,2>{0.559997141f, 0.0206824206f},
-std::array<float,2>{0.380467117f, 0.41318658f},
-std::array<float,2>{0.792125106f, 0.952408493f},
-std::array<float,2>{0.176133379f, 0.875784874f},
-std::array<float,2>{0.735495269f, 0.483274758f},
-std::array<float,2>{0.351102263f, 0.0742020682f},
-std::array<float,2>{0.939811349f, 0.515791535f},
-std::array<float,2>{0.453010231f, 0.649068534f},
-std::array<float,2>{0.830270886f, 0.22141628f},
-std::array<float,2>{0.111386903f, 0.314201862f},
-std::array<float,2>{0.617988646f, 0.775534391f},
-std::array<float,2>{0.364192247f, 0.924669981f},
-std::array<float,2>{0.964459956f, 0.448292047f},
-std::array<float,2>{0.16913037f, 0.12316297f},
-std::array<float,2>{0.726405561f, 0.540645838f},
-std::array<float,2>{0.107827336f, 0.685548663f},
-std::array<float,2>{0.606904566f, 0.205062434f},
-std::array<float,2>{0.456092179f, 0.353510112f},
-std::array<float,2>{0.815747678f, 0.803149462f},
-std::array<float,2>{0.246274188f, 0.819952667f},
-std::array<float,2>{0.625875592f, 0.297631085f},
-std::array<float,2>{0.310050428f, 0.13749063f},
-std::array<float,2>{0.932339191f, 0.711075485f},
-std::array<float,2>{0.395433545f, 0.597195148f},
-std::array<float,2>{0.805495381f, 0.0370457023f},
-std::array<float,2>{0.0251775272f, 0.385620564f},
-std::array<float,2>{0.543820381f, 0.9799366f},
-std::array<float,2>{0.47964114f, 0.752155125f},
-std::array<float,2>{0.854281127f, 0.331447512f},
-std::array<float,2>{0.0689746737f, 0.240096599f},
-std::array<float,2>{0.574471891f, 0.640185237f},
-std::array<float,2>{0.134974107f, 0.514823496f},
-std::array<float,2>{0.707265735f, 0.0903722718f},
-std::array<float,2>{0.335798383f, 0.489572853f},
-std::array<float,2>{0.994170189f, 0.895658255f},
-std::array<float,2>{0.0496492721f, 0.968741834f},
-std::array<float,2>{0.505615056f, 0.426972687f},
-std::array<float,2>{0.412167192f, 0.0119473226f},
-std::array<float,2>{0.753358901f, 0.567745149f},
-std::array<float,2>{0.263069034f, 0.737767577f},
-std::array<float,2>{0.898747325f, 0.163148493f},
-std::array<float,2>{0.189848214f, 0.277393848f},
-std::array<float,2>{0.681950986f, 0.870964229f},
-std::array<float,2>{0.419338316f, 0.880923808f},
-std::array<float,2>{0.762288392f, 0.477622837f},
-std::array<float,2>{0.0624994896f, 0.0748144761f},
-std::array<float,2>{0.513174415f, 0.522248089f},
-std::array<float,2>{0.197646126f, 0.654030323f},
-std::array<float,2>{0.674424112f, 0.224525586f},
-std::array<float,2>{0.255331188f, 0.319112033f},
-std::array<float,2>{0.890898108f, 0.77893275f},
-std::array<float,2>{0.0703139231f, 0.851787567f},
-std::array<float,2>{0.565592408f, 0.252390862f},
-std::array<float,2>{0.476198673f, 0.174142495f},
-std::array<float,2>{0.847203732f, 0.732429981f},
-std::array<float,2>{0.342690676f, 0.592527628f},
-std::array<float,2>{0.989522219f, 0.0189602394f},
-std::array<float,2>{0.1274243f, 0.409807295f},
-std::array<float,2>{0.71657759f, 0.948654175f},
-std::array<float,2>{0.303709596f, 0.789107323f},
-std::array<float,2>{0.922898173f, 0.371170938f},
-std::array<float,2>{0.241197795f, 0.198351756f},
-std::array<float,2>{0.637816668f, 0.660506904f},
-std::array<float,2>{0.0212938767f, 0.551546097f},
-std::array<float,2>{0.536607325f, 0.108912803f},
-std::array<float,2>{0.404868007f, 0.455030799f},
-std::array<float,2>{0.802637875f, 0.919836819f},
-std::array<float,2>{0.157944933f, 0.995664358f},
-std::array<float,2>{0.732524633f, 0.401300818f},
-std::array<float,2>{0.369462937f, 0.0617460124f},
-std::array<float,2>{0.956970215f, 0.62096858f},
-std::array<float,2>{0.461690038f, 0.701130927f},
-std::array<float,2>{0.827021599f, 0.152086124f},
-std::array<float,2>{0.0942445248f, 0.296730161f},
-std::array<float,2>{0.600248218f, 0.841066122f},
-std::array<float,2>{0.355287015f, 0.961786032f},
-std::array<float,2>{0.946802378f, 0.42252624f},
-std::array<float,2>{0.183741927f, 0.0107759628f},
-std::array<float,2>{0.74663192f, 0.564924061f},
-std::array<float,2>{0.121897392f, 0.738862514f},
-std::array<float,2>{0.613888085f, 0.15693666f},
-std::array<float,2>{0.445258439f, 0.274167776f},
-std::array<float,2>{0.839780629f, 0.874403417f},
-std::array<float,2>{0.220170125f, 0.757633567f},
-std::array<float,2>{0.645552516f, 0.334588557f},
-std::array<float,2>{0.291368186f, 0.236212283f},
-std::array<float,2>{0.918349326f, 0.636691988f},
-std::array<float,2>{0.387652695f, 0.509059131f},
-std::array<float,2>{0.787711322f, 0.0863717347f},
-std::array<float,2>{0.00726218894f, 0.486585706f},
-std::array<float,2>{0.55206126f, 0.892401755f},
-std::array<float,2>{0.494992077f, 0.816219568f},
-std::array<float,2>{0.859684289f, 0.303236037f},
-std::array<float,2>{0.0914386436f, 0.13575168f},
-std::array<float,2>{0.587225616f, 0.71700412f},
-std::array<float,2>{0.148890227f, 0.600627065f},
-std::array<float,2>{0.694192588f, 0.0348213911f},
-std::array<float,2>{0.314077675f, 0.389834911f},
-std::array<float,2>{0.972620726f, 0.981279016f},
-std::array<float,2>{0.0391965508f, 0.92928499f},
-std::array<float,2>{0.518045008f, 0.452657044f},
-std::array<float,2>{0.434327394f, 0.120203882f},
-std::array<float,2>{0.771112561f, 0.544119895f},
-std::array<float,2>{0.274933577f, 0.67976141f},
-std::array<float,2>{0.87612009f, 0.207605019f},
-std::array<float,2>{0.206668779f, 0.359172046f},
-std::array<float,2>{0.670232296f, 0.796920419f},
-std::array<float,2>{0.448153079f, 0.971035719f},
-std::array<float,2>{0.832425535f, 0.375966936f},
-std::array<float,2>{0.114781f, 0.0415592492f},
-std::array<float,2>{0.623699784f, 0.608817339f},
-std::array<float,2>{0.173203468f, 0.704584897f},
-std::array<float,2>{0.741754472f, 0.125781715f},
-std::array<float,2>{0.346534669f, 0.312114298f},
-std::array<float,2>{0.945136964f, 0.820390642f},
-std::array<float,2>{0.00837005768f, 0.808492959f},
-std::array<float,2>{0.557316005f, 0.343990028f},
-std::array<float,2>{0.378115088f, 0.218378246f},
-std::array<float,2>{0.79475528f, 0.672054172f},
-std::array<float,2>{0.284647018f, 0.535601318f},
-std::array<float,2>{0.912987232f, 0.116229229f},
-std::array<float,2>{0.234005883f, 0.444662094f},
-std::array<float,2>{0.655513763f, 0.931132436f},
-std::array<float,2>{0.325744987f, 0.861955225f},
-std::array<float,2>{0.982785761f, 0.26998198f},
-std::array<float,2>{0.145522878f, 0.164746329f},
-std::array<float,2>{0.700582147f, 0.748875976f},
-std::array<float,2>{0.0785816982f, 0.574382722f},
-std::array<float,2>{0.57891506f, 0.00765014812f},
-std::array<float,2>{0.491576016f, 0.433871895f},
-std::array<float,2>{0.870082736f, 0.957927167f},
-std::array<float,2>{0.218221754f, 0.903619349f},
-std::array<float,2>{0.658675492f, 0.493918329f},
-std::array<float,2>{0.268400252f, 0.0797669888f},
-std::array<float,2>{0.887753665f, 0.502172828f},
-std::array<float,2>{0.428158402f, 0.625833213f},
-std::array<float,2>{0.775220931f, 0.243640825f},
-std::array<float,2>{0.0345935822f, 0.337490916f},
-std::array<float,2>{0.527841091f, 0.763228774f},
-std::array<float,2>{0.258826315f, 0.907311797f},
-std::array<float,2>{0.905575037f, 0.465347201f},
-std::array<float,2>{0.194287628f, 0.0944152176f},
-std::array<float,2>{0.684189737f, 0.560115397f},
-std::array<float,2>{0.0546034686f, 0.666751146f},
-std::array<float,2>{0.503482699f, 0.189685002f},
-std::array<float,2>{0.407651037f, 0.364052266f},
-std::array<float,2>{0.756776989f, 0.784106851f},
-std::array<float,2>{0.138409108f, 0.835746765f},
-std::array<float,2>{0.706599593f, 0.285983741f},
-std::array<float,2>{0.329767466f, 0.146729469f},
-std::array<float,2>{0.996285975f, 0.692408025f},
-std::array<float,2>{0.483515143f, 0.614828646f},
-std::array<float,2>{0.85828805f, 0.047126323f},
-std::array<float,2>{0.0650987923f, 0.394759268f},
-std::array<float,2>{0.572736859f, 0.985230982f},
-std::array<float,2>{0.39344129f, 0.769993424f},
-std::array<float,2>{0.810443819f, 0.321102083f},
-std::array<float,2>{0.030226592f, 0.230341449f},
-std::array<float,2>{0.539567769f, 0.645617187f},
-std::array<float,2>{0.24592343f, 0.526929677f},
-std::array<float,2>{0.63043493f, 0.0683730617f},
-std::array<float,2>{0.308379948f, 0.469485074f},
-std::array<float,2>{0.933754265f, 0.888130188f},
-std::array<float,2>{0.104512557f, 0.939836025f},
-std::array<float,2>{0.604139507f, 0.418899059f},
-std::array<float,2>{0.459690273f, 0.0308285207f},
-std::array<float,2>{0.819973826f, 0.58403939f},
-std::array<float,2>{0.362734884f, 0.720227778f},
-std::array<float,2>{0.968362331f, 0.186424062f},
-std::array<float,2>{0.167180002f, 0.263809621f},
-std::array<float,2>{0.719036937f, 0.846744061f},
-std::array<float,2>{0.470330656f, 0.934744239f},
-std::array<float,2>{0.850174189f, 0.439160168f},
-std::array<float,2>{0.0744877979f, 0.110455044f},
-std::array<float,2>{0.569383621f, 0.533664823f},
-std::array<float,2>{0.132199541f, 0.679077923f},
-std::array<float,2>{0.71154058f, 0.214335918f},
-std::array<float,2>{0.338585466f, 0.34867689f},
-std::array<float,2>{0.98758775f, 0.811605811f},
-std::array<float,2>{0.0556653626f, 0.825706303f},
-std::array<float,2>{0.509460449f, 0.308093905f},
-std::array<float,2>{0.415335298f, 0.131770179f},
-std::array<float,2>{0.759101391f, 0.710302234f},
-std::array<float,2>{0.250453115f, 0.60357511f},
-std::array<float,2>{0.896553218f, 0.0446367972f},
-std::array<float,2>{0.199468747f, 0.380035907f},
-std::array<float,2>{0.677019715f, 0.972736835f},
-std::array<float,2>{0.373047888f, 0.75838697f},
-std::array<float,2>{0.960032463f, 0.342021078f},
-std::array<float,2>{0.163841531f, 0.248598382f},
-std::array<float,2>{0.728886962f, 0.629037559f},
-std::array<float,2>{0.101522356f, 0.507274032f},
-std::array<float,2>{0.593796015f, 0.083209306f},
-std::array<float,2>{0.466214567f, 0.496739537f},
-std::array<float,2>{0.822185278f, 0.900141001f},
-std::array<float,2>{0.236376122f, 0.953803182f},
-std::array<float,2>{0.633351445f, 0.431121051f},
-std::array<float,2>{0.298397362f, 0.00269864337f},
-std::array<float,2>{0.926032722f, 0.571494818f},
-std::array<float,2>{0.3994596f, 0.742401361f},
-std::array<float,2>{0.797522247f, 0.169132337f},
-std::array<float,2>{0.0177093204f, 0.269173771f},
-std::array<float,2>{0.531828821f, 0.86491406f},
-std::array<float,2>{0.294370055f, 0.989815056f},
-std::array<float,2>{0.914967299f, 0.393608481f},
-std::array<float,2>{0.226498827f, 0.0527335629f},
-std::array<float,2>{0.641943395f, 0.610323608f},
-std::array<float,2>{0.00151155028f, 0.687517822f},
-std::array<float,2>{0.548997998f, 0.143375114f},
-std::array<float,2>{0.382946342f, 0.281323016f},
-std::array<float,2>{0.78243202f, 0.83018589f},
-std::array<float,2>{0.18228364f, 0.78567344f},
-std::array<float,2>{0.743275583f, 0.360378593f},
-std::array<float,2>{0.358714968f, 0.193990648f},
-std::array<float,2>{0.950963914f, 0.669448137f},
-std::array<float,2>{0.441304386f, 0.557644248f},
-std::array<float,2>{0.840174735f, 0.100577161f},
-std::array<float,2>{0.118958004f, 0.462875158f},
-std::array<float,2>{0.612893403f, 0.913683355f},
-std::array<float,2>{0.430325389f, 0.850752234f},
-std::array<float,2>{0.768988311f, 0.260266721f},
-std::array<float,2>{0.0439701155f, 0.180986553f},
-std::array<float,2>{0.520281017f, 0.726401269f},
-std::array<float,2>{0.20752877f, 0.58005172f},
-std::array<float,2>{0.665680826f, 0.023530161f},
-std::array<float,2>{0.281239182f, 0.414602458f},
-std::array<float,2>{0.881234586f, 0.944998085f},
-std::array<float,2>{0.0895145983f, 0.886036515f},
-std::array<float,2>{0.590780318f, 0.475999027f},
-std::array<float,2>{0.499223799f, 0.0639282018f},
-std::array<float,2>{0.863650024f, 0.528738678f},
-std::array<float,2>{0.319661707f, 0.643025815f},
-std::array<float,2>{0.974152386f, 0.234246194f},
-std::array<float,2>{0.154547036f, 0.325003266f},
-std::array<float,2>{0.688264251f, 0.768924117f},
-std::array<float,2>{0.38111046f, 0.950616062f},
-std::array<float,2>{0.789792538f, 0.411866575f},
-std::array<float,2>{0.0152588245f, 0.0228231773f},
-std::array<float,2>{0.562029362f, 0.588144541f},
-std::array<float,2>{0.229226351f, 0.72958076f},
-std::array<float,2>{0.649431944f, 0.176704332f},
-std::array<float,2>{0.288498461f, 0.255523324f},
-std::array<float,2>{0.909388781f, 0.858621061f},
-std::array<float,2>{0.109839089f, 0.773900986f},
-std::array<float,2>{0.620079994f, 0.314950705f},
-std::array<float,2>{0.449814141f, 0.220533416f},
-std::array<float,2>{0.829778612f, 0.652120292f},
-std::array<float,2>{0.348644495f, 0.518771887f},
-std::array<float,2>{0.939406633f, 0.0709088221f},
-std::array<float,2>{0.177789912f, 0.480894506f},
-std::array<float,2>{0.736933947f, 0.878420472f},
-std::array<float,2>{0.271849126f, 0.838035643f},
-std::array<float,2>{0.884693861f, 0.290615767f},
-std::array<float,2>{0.211180657f, 0.155284032f},
-std::array<float,2>{0.662530959f, 0.69666487f},
-std::array<float,2>{0.0358828418f, 0.621554792f},
-std::array<float,2>{0.526018322f, 0.0554907657f},
-std::array<float,2>{0.422635317f, 0.404301167f},
-std::array<float,2>{0.779010713f, 0.997163177f},
-std::array<float,2>{0.14304091f, 0.914280653f},
-std::array<float,2>{0.697421253f, 0.459980369f},
-std::array<float,2>{0.323189825f, 0.105458021f},
-std::array<float,2>{0.979772091f, 0.550468206f},
-std::array<float,2>{0.487591863f, 0.658861935f},
-std::array<float,2>{0.874027729f, 0.199854821f},
-std::array<float,2>{0.0844612718f, 0.370497763f},
-std::array<float,2>{0.584270358f, 0.794570744f},
-std::array<float,2>{0.333828151f, 0.896924973f},
-std::array<float,2>{0.993373036f, 0.490488261f},
-std::array<float,2>{0.133346304f, 0.0923248008f},
-std::array<float,2>{0.710877299f, 0.512967467f},
-std::array<float,2>{0.0681594238f, 0.63672334f},
-std::array<float,2>{0.577202618f, 0.241900682f},
-std::array<float,2>{0.478466898f, 0.329712063f},
-std::array<float,2>{0.853391111f, 0.751075089f},
-std::array<float,2>{0.187820107f, 0.868876576f},
-std::array<float,2>{0.680614054f, 0.279782176f},
-std::array<float,2>{0.265475273f, 0.160275251f},
-std::array<float,2>{0.902304411f, 0.734760165f},
-std::array<float,2>{0.410342157f, 0.568954349f},
-std::array<float,2>{0.750524402f, 0.0153916283f},
-std::array<float,2>{0.0475811623f, 0.428575426f},
-std::array<float,2>{0.506869256f, 0.966331303f},
-std::array<float,2>{0.454643101f, 0.800799251f},
-std::array<float,2>{0.814062297f, 0.354943335f},
-std::array<float,2>{0.106191158f, 0.206121027f},
-std::array<float,2>{0.608832479f, 0.683619559f},
-std::array<float,2>{0.17096594f, 0.541175842f},
-std::array<float,2>{0.72423768f, 0.122742943f},
-std::array<float,2>{0.36712721f, 0.44704324f},
-std::array<float,2>{0.962541759f, 0.922187984f},
-std::array<float,2>{0.0265818946f, 0.978395522f},
-std::array<float,2>{0.544930875f, 0.383832484f},
-std::array<float,2>{0.397625893f, 0.0387700945f},
-std::array<float,2>{0.806792557f, 0.595587075f},
-std::array<float,2>{0.311892867f, 0.713650286f},
-std::array<float,2>{0.929776847f, 0.139807239f},
-std::array<float,2>{0.248079225f, 0.30061093f},
-std::array<float,2>{0.627431571f, 0.817040861f},
-std::array<float,2>{0.435106337f, 0.926341295f},
-std::array<float,2>{0.769955754f, 0.450968891f},
-std::array<float,2>{0.0408165976f, 0.117350347f},
-std::array<float,2>{0.519483268f, 0.546032369f},
-std::array<float,2>{0.205989957f, 0.682277679f},
-std::array<float,2>{0.671714306f, 0.209534198f},
-std::array<float,2>{0.273990512f, 0.356298953f},
-std::array<float,2>{0.875962615f, 0.800445735f},
-std::array<float,2>{0.0905129761f, 0.812511504f},
-std::array<float,2>{0.586045265f, 0.302711397f},
-std::array<float,2>{0.495758384f, 0.133446828f},
-std::array<float,2>{0.860694468f, 0.716749191f},
-std::array<float,2>{0.313152254f, 0.598307848f},
-std::array<float,2>{0.971476495f, 0.032145489f},
-std::array<float,2>{0.149910107f, 0.388418347f},
-std::array<float,2>{0.694774628f, 0.98303026f},
-std::array<float,2>{0.292718112f, 0.754626274f},
-std::array<float,2>{0.919350922f, 0.332194388f},
-std::array<float,2>{0.219271019f, 0.237327397f},
-std::array<float,2>{0.645505846f, 0.633286297f},
-std::array<float,2>{0.00591082219f, 0.510018051f},
-std::array<float,2>{0.550941527f, 0.0888313726f},
-std::array<float,2>{0.388555974f, 0.485897958f},
-std::array<float,2>{0.788106859f, 0.894224882f},
-std::array<float,2>{0.185167775f, 0.963675559f},
-std::array<float,2>{0.747190058f, 0.425641537f},
-std::array<float,2>{0.353829533f, 0.00897152536f},
-std::array<float,2>{0.945692658f, 0.563020885f},
-std::array<float,2>{0.444268763f, 0.740464926f},
-std::array<float,2>{0.838723481f, 0.158323988f},
-std::array<float,2>{0.122158639f, 0.275717527f},
-std::array<float,2>{0.614482999f, 0.872582436f},
-std::array<float,2>{0.371058226f, 0.99311024f},
-std::array<float,2>{0.955719769f, 0.399831206f},
-std::array<float,2>{0.156651258f, 0.0593984984f},
-std::array<float,2>{0.733570874f, 0.617251158f},
-std::array<float,2>{0.0950907022f, 0.702705562f},
-std::array<float,2>{0.601048827f, 0.149494156f},
-std::array<float,2>{0.462860197f, 0.29433772f},
-std::array<float,2>{0.827550173f, 0.842157423f},
-std::array<float,2>{0.241272405f, 0.791910052f},
-std::array<float,2>{0.637287915f, 0.374018043f},
-std::array<float,2>{0.304173708f, 0.195748851f},
-std::array<float,2>{0.922589302f, 0.663319945f},
-std::array<float,2>{0.405977726f, 0.553182781f},
-std::array<float,2>{0.801157117f, 0.107004844f},
-std::array<float,2>{0.020067025f, 0.456983507f},
-std::array<float,2>{0.536011696f, 0.920040369f},
-std::array<float,2>{0.47538659f, 0.85370189f},
-std::array<float,2>{0.846501708f, 0.250279307f},
-std::array<float,2>{0.0714191198f, 0.172290459f},
-std::array<float,2>{0.564988792f, 0.731834054f},
-std::array<float,2>{0.127962068f, 0.590324402f},
-std::array<float,2>{0.715455592f, 0.0159301031f},
-std::array<float,2>{0.342793822f, 0.407836348f},
-std::array<float,2>{0.9886356f, 0.945612371f},
-std::array<float,2>{0.0607692078f, 0.880229354f},
-std::array<float,2>{0.512450814f, 0.479228944f},
-std::array<float,2>{0.41890049f, 0.0765553638f},
-std::array<float,2>{0.763254046f, 0.521323919f},
-std::array<float,2>{0.254373282f, 0.656081617f},
-std::array<float,2>{0.892441511f, 0.226242438f},
-std::array<float,2>{0.198938921f, 0.317590773f},
-std::array<float,2>{0.675228655f, 0.78120631f},
-std::array<float,2>{0.460543185f, 0.93936193f},
-std::array<float,2>{0.818395257f, 0.420854717f},
-std::array<float,2>{0.104068696f, 0.0273820013f},
-std::array<float,2>{0.604642689f, 0.582040846f},
-std::array<float,2>{0.166451499f, 0.721047699f},
-std::array<float,2>{0.720142066f, 0.185049236f},
-std::array<float,2>{0.361706436f, 0.262899846f},
-std::array<float,2>{0.966869652f, 0.84551084f},
-std::array<float,2>{0.0305917133f, 0.772091627f},
-std::array<float,2>{0.540179193f, 0.323561996f},
-std::array<float,2>{0.394036353f, 0.227637991f},
-std::array<float,2>{0.809379041f, 0.647188425f},
-std::array<float,2>{0.306651831f, 0.524354279f},
-std::array<float,2>{0.934704244f, 0.0673508272f},
-std::array<float,2>{0.245040029f, 0.470892221f},
-std::array<float,2>{0.629719555f, 0.889647305f},
-std::array<float,2>{0.32874462f, 0.832547605f},
-std::array<float,2>{0.997073591f, 0.288126498f},
-std::array<float,2>{0.136781901f, 0.146171674f},
-std::array<float,2>{0.705664396f, 0.694612384f},
-std::array<float,2>{0.0658327639f, 0.616263866f},
-std::array<float,2>{0.573586643f, 0.0504194759f},
-std::array<float,2>{0.48338294f, 0.397236913f},
-std::array<float,2>{0.858663142f, 0.986643314f},
-std::array<float,2>{0.194905758f, 0.908606589f},
-std::array<float,2>{0.685469449f, 0.468318641f},
-std::array<float,2>{0.257924706f, 0.0974658802f},
-std::array<float,2>{0.905029178f, 0.560642183f},
-std::array<float,2>{0.406801939f, 0.665079355f},
-std::array<float,2>{0.757479966f, 0.187546521f},
-std::array<float,2>{0.053155832f, 0.366873294f},
-std::array<float,2>{0.502440333f, 0.782147884f},
-std::array<float,2>{0.268561631f, 0.904481947f},
-std::array<float,2>{0.887674391f, 0.494987577f},
-std::array<float,2>{0.217758268f, 0.0812512338f},
-std::array<float,2>{0.659707844f, 0.500250459f},
-std::array<float,2>{0.0333321989f, 0.628260851f},
-std::array<float,2>{0.529041886f, 0.244911835f},
-std::array<float,2>{0.428794891f, 0.339128971f},
-std::array<float,2>{0.774073839f, 0.764020801f},
-std::array<float,2>{0.144960538f, 0.859822452f},
-std::array<float,2>{0.699473858f, 0.273002774f},
-std::array<float,2>{0.32516259f, 0.167478755f},
-std::array<float,2>{0.98355341f, 0.746174037f},
-std::array<float,2>{0.490745127f, 0.57787329f},
-std::array<float,2>{0.870394528f, 0.00411212584f},
-std::array<float,2>{0.0795575306f, 0.437108248f},
-std::array<float,2>{0.57994622f, 0.960861444f},
-std::array<float,2>{0.377059907f, 0.805900693f},
-std::array<float,2>{0.793813467f, 0.346500307f},
-std::array<float,2>{0.00924240239f, 0.215269059f},
-std::array<float,2>{0.558055699f, 0.674603879f},
-std::array<float,2>{0.233088255f, 0.537801564f},
-std::array<float,2>{0.654699028f, 0.113864429f},
-std::array<float,2>{0.284064144f, 0.44171679f},
-std::array<float,2>{0.913801014f, 0.933001995f},
-std::array<float,2>{0.114084095f, 0.969548821f},
-std::array<float,2>{0.624102473f, 0.378681958f},
-std::array<float,2>{0.449003935f, 0.0403823964f},
-std::array<float,2>{0.833857715f, 0.605858982f},
-std::array<float,2>{0.346914172f, 0.7057603f},
-std::array<float,2>{0.943581522f, 0.127885103f},
-std::array<float,2>{0.171986863f, 0.310000002f},
-std::array<float,2>{0.741080999f, 0.823763847f},
-std::array<float,2>{0.498149663f, 0.884239018f},
-std::array<float,2>{0.86520505f, 0.473500848f},
-std::array<float,2>{0.0883009508f, 0.0649109483f},
-std::array<float,2>{0.591678619f, 0.53046608f},
-std::array<float,2>{0.155530617f, 0.641567707f},
-std::array<float,2>{0.688520789f, 0.232003063f},
-std::array<float,2>{0.319141626f, 0.32672295f},
-std::array<float,2>{0.973499775f, 0.766642332f},
-std::array<float,2>{0.0437599495f, 0.848096251f},
-std::array<float,2>{0.521313488f, 0.259642303f},
-std::array<float,2>{0.431129307f, 0.183227181f},
-std::array<float,2>{0.768252492f, 0.724317968f},
-std::array<float,2>{0.280009896f, 0.581406713f},
-std::array<float,2>{0.882506847f, 0.0257912893f},
-std::array<float,2>{0.208957434f, 0.417229533f},
-std::array<float,2>{0.664579272f, 0.942408144f},
-std::array<float,2>{0.358056933f, 0.787694037f},
-std::array<float,2>{0.94991523f, 0.361820847f},
-std::array<float,2>{0.183213085f, 0.192361519f},
-std::array<float,2>{0.742595077f, 0.670067191f},
-std::array<float,2>{0.117476456f, 0.556134224f},
-std::array<float,2>{0.611367285f, 0.0982114449f},
-std::array<float,2>{0.440143973f, 0.463172346f},
-std::array<float,2>{0.841709673f, 0.910190642f},
-std::array<float,2>{0.224778518f, 0.990452111f},
-std::array<float,2>{0.640869558f, 0.391083568f},
-std::array<float,2>{0.293917149f, 0.0540846661f},
-std::array<float,2>{0.915062606f, 0.611630142f},
-std::array<float,2>{0.384559691f, 0.690338194f},
-std::array<float,2>{0.781615794f, 0.141332597f},
-std::array<float,2>{0.000481674098f, 0.284076482f},
-std::array<float,2>{0.55069685f, 0.828900516f},
-std::array<float,2>{0.297262698f, 0.956163347f},
-std::array<float,2>{0.927359819f, 0.4319534f},
-std::array<float,2>{0.237952456f, 0.000749866187f},
-std::array<float,2>{0.633792877f, 0.573231041f},
-std::array<float,2>{0.0194117669f, 0.744445682f},
-std::array<float,2>{0.532988489f, 0.170512229f},
-std::array<float,2>{0.39855966f, 0.267021328f},
-std::array<float,2>{0.798220873f, 0.865242779f},
-std::array<float,2>{0.162258923f, 0.760717511f},
-std::array<float,2>{0.729500711f, 0.34077242f},
-std::array<float,2>{0.374628544f, 0.247129247f},
-std::array<float,2>{0.95918411f, 0.632747829f},
-std::array<float,2>{0.4651196f, 0.504737556f},
-std::array<float,2>{0.821124911f, 0.0845469236f},
-std::array<float,2>{0.0997546837f, 0.498808086f},
-std::array<float,2>{0.595089674f, 0.902285337f},
-std::array<float,2>{0.414247662f, 0.828108072f},
-std::array<float,2>{0.758410931f, 0.306344539f},
-std::array<float,2>{0.0551853105f, 0.130119249f},
-std::array<float,2>{0.508413672f, 0.708574057f},
-std::array<float,2>{0.201033995f, 0.603028953f},
-std::array<float,2>{0.676650763f, 0.0450013392f},
-std::array<float,2>{0.25116539f, 0.382718235f},
-std::array<float,2>{0.897706449f, 0.975570738f},
-std::array<float,2>{0.0758447275f, 0.936131716f},
-std::array<float,2>{0.568858027f, 0.440204859f},
-std::array<float,2>{0.469439536f, 0.113000713f},
-std::array<float,2>{0.851020455f, 0.532585442f},
-std::array<float,2>{0.339315712f, 0.676354945f},
-std::array<float,2>{0.986905992f, 0.2117531f},
-std::array<float,2>{0.131681606f, 0.350681514f},
-std::array<float,2>{0.712689877f, 0.808842719f},
-std::array<float,2>{0.397307932f, 0.979122996f},
-std::array<float,2>{0.808144391f, 0.38643834f},
-std::array<float,2>{0.0254240353f, 0.0360359326f},
-std::array<float,2>{0.546828568f, 0.596507788f},
-std::array<float,2>{0.249320865f, 0.712009728f},
-std::array<float,2>{0.628762364f, 0.138591409f},
-std::array<float,2>{0.311331511f, 0.298055679f},
-std::array<float,2>{0.931514859f, 0.819223344f},
-std::array<float,2>{0.107215606f, 0.804204047f},
-std::array<float,2>{0.607691288f, 0.351763755f},
-std::array<float,2>{0.453821152f, 0.204056174f},
-std::array<float,2>{0.813366473f, 0.687489867f},
-std::array<float,2>{0.365247577f, 0.539384365f},
-std::array<float,2>{0.96161598f, 0.124325611f},
-std::array<float,2>{0.170590073f, 0.447401851f},
-std::array<float,2>{0.723067343f, 0.925267994f},
-std::array<float,2>{0.264166027f, 0.869507372f},
-std::array<float,2>{0.900428176f, 0.278812766f},
-std::array<float,2>{0.18856734f, 0.162303686f},
-std::array<float,2>{0.680772901f, 0.736837983f},
-std::array<float,2>{0.0482502282f, 0.56668514f},
-std::array<float,2>{0.505927324f, 0.0135027263f},
-std::array<float,2>{0.411800444f, 0.425940752f},
-std::array<float,2>{0.751657009f, 0.967616737f},
-std::array<float,2>{0.134352103f, 0.895118713f},
-std::array<float,2>{0.709398746f, 0.488630354f},
-std::array<float,2>{0.332759976f, 0.0912362412f},
-std::array<float,2>{0.992335796f, 0.51390028f},
-std::array<float,2>{0.477457553f, 0.639517605f},
-std::array<float,2>{0.851711273f, 0.238284886f},
-std::array<float,2>{0.0669540167f, 0.330250621f},
-std::array<float,2>{0.577074111f, 0.753790677f},
-std::array<float,2>{0.323827863f, 0.917662382f},
-std::array<float,2>{0.978996992f, 0.458061785f},
-std::array<float,2>{0.144168958f, 0.103502579f},
-std::array<float,2>{0.698798656f, 0.546921551f},
-std::array<float,2>{0.0850223675f, 0.658110619f},
-std::array<float,2>{0.58586663f, 0.202240542f},
-std::array<float,2>{0.486604124f, 0.368021786f},
-std::array<float,2>{0.873388529f, 0.7966398f},
-std::array<float,2>{0.212637827f, 0.836461723f},
-std::array<float,2>{0.66344738f, 0.292406052f},
-std::array<float,2>{0.273437023f, 0.153964907f},
-std::array<float,2>{0.88351649f, 0.698284686f},
-std::array<float,2>{0.423267305f, 0.623097956f},
-std::array<float,2>{0.778069913f, 0.0575550869f},
-std::array<float,2>{0.036228627f, 0.403533965f},
-std::array<float,2>{0.526665628f, 0.998181581f},
-std::array<float,2>{0.451015711f, 0.776795387f},
-std::array<float,2>{0.828415513f, 0.312977582f},
-std::array<float,2>{0.111277416f, 0.222258702f},
-std::array<float,2>{0.620881379f, 0.649989128f},
-std::array<float,2>{0.178767174f, 0.517532706f},
-std::array<float,2>{0.737621307f, 0.0726076737f},
-std::array<float,2>{0.348257869f, 0.483683616f},
-std::array<float,2>{0.937769771f, 0.876150608f},
-std::array<float,2>{0.0146243908f, 0.951202571f},
-std::array<float,2>{0.5605762f, 0.412564874f},
-std::array<float,2>{0.38239637f, 0.0200715177f},
-std::array<float,2>{0.79078716f, 0.586277902f},
-std::array<float,2>{0.287266374f, 0.727743506f},
-std::array<float,2>{0.908920825f, 0.178895682f},
-std::array<float,2>{0.23006992f, 0.256225526f},
-std::array<float,2>{0.649216652f, 0.856255114f},
-std::array<float,2>{0.389115363f, 0.891349912f},
-std::array<float,2>{0.78557384f, 0.488012999f},
-std::array<float,2>{0.00391431665f, 0.0874289647f},
-std::array<float,2>{0.553682923f, 0.508653879f},
-std::array<float,2>{0.2226329f, 0.63531059f},
-std::array<float,2>{0.647986174f, 0.234670758f},
-std::array<float,2>{0.289449781f, 0.334996879f},
-std::array<float,2>{0.920117199f, 0.756681323f},
-std::array<float,2>{0.124980636f, 0.873166978f},
-std::array<float,2>{0.615877628f, 0.27450484f},
-std::array<float,2>{0.441875279f, 0.157770634f},
-std::array<float,2>{0.836263239f, 0.739878714f},
-std::array<float,2>{0.351936907f, 0.565939665f},
-std::array<float,2>{0.948458791f, 0.0102937007f},
-std::array<float,2>{0.187063977f, 0.423598051f},
-std::array<float,2>{0.748484313f, 0.962440968f},
-std::array<float,2>{0.276140302f, 0.798166752f},
-std::array<float,2>{0.877366543f, 0.357632667f},
-std::array<float,2>{0.204753309f, 0.208094999f},
-std::array<float,2>{0.668115556f, 0.680702448f},
-std::array<float,2>{0.0411580801f, 0.543496072f},
-std::array<float,2>{0.516697526f, 0.119429618f},
-std::array<float,2>{0.435956359f, 0.45136255f},
-std::array<float,2>{0.772443295f, 0.928679228f},
-std::array<float,2>{0.150557652f, 0.982400954f},
-std::array<float,2>{0.691596985f, 0.389243126f},
-std::array<float,2>{0.315939844f, 0.0340751484f},
-std::array<float,2>{0.969670653f, 0.600421548f},
-std::array<float,2>{0.492506385f, 0.718395412f},
-std::array<float,2>{0.862048268f, 0.135715291f},
-std::array<float,2>{0.092682533f, 0.304425567f},
-std::array<float,2>{0.589384258f, 0.815218985f},
-std::array<float,2>{0.340566158f, 0.948174238f},
-std::array<float,2>{0.991973281f, 0.408950239f},
-std::array<float,2>{0.126458928f, 0.0177362971f},
-std::array<float,2>{0.71771723f, 0.593394995f},
-std::array<float,2>{0.0734390989f, 0.733696938f},
-std::array<float,2>{0.56281805f, 0.175594836f},
-std::array<float,2>{0.473522455f, 0.253449589f},
-std::array<float,2>{0.845644951f, 0.853253484f},
-std::array<float,2>{0.195800215f, 0.777853429f},
-std::array<float,2>{0.673067987f, 0.319666743f},
-std::array<float,2>{0.256139964f, 0.223480538f},
-std::array<float,2>{0.893766701f, 0.652620673f},
-std::array<float,2>{0.421064794f, 0.522900581f},
-std::array<float,2>{0.764539957f, 0.0756611004f},
-std::array<float,2>{0.0589524321f, 0.476975679f},
-std::array<float,2>{0.514868915f, 0.882124186f},
-std::array<float,2>{0.463046789f, 0.840378344f},
-std::array<float,2>{0.825462759f, 0.295537055f},
-std::array<float,2>{0.0960887745f, 0.150812477f},
-std::array<float,2>{0.598579943f, 0.699300647f},
-std::array<float,2>{0.159517139f, 0.619253218f},
-std::array<float,2>{0.730609238f, 0.0608089864f},
-std::array<float,2>{0.36878103f, 0.401690215f},
-std::array<float,2>{0.955003381f, 0.994871914f},
-std::array<float,2>{0.0223749485f, 0.918379962f},
-std::array<float,2>{0.537314415f, 0.453497291f},
-std::array<float,2>{0.402597219f, 0.107989743f},
-std::array<float,2>{0.804316998f, 0.551983654f},
-std::array<float,2>{0.302218795f, 0.661359608f},
-std::array<float,2>{0.924295485f, 0.19738254f},
-std::array<float,2>{0.238671079f, 0.372239143f},
-std::array<float,2>{0.639619529f, 0.790481567f},
-std::array<float,2>{0.481650472f, 0.985807121f},
-std::array<float,2>{0.857404828f, 0.395549625f},
-std::array<float,2>{0.063436076f, 0.048208382f},
-std::array<float,2>{0.572028041f, 0.613709271f},
-std::array<float,2>{0.139774173f, 0.691782236f},
-std::array<float,2>{0.704817593f, 0.147671133f},
-std::array<float,2>{0.331659734f, 0.286386102f},
-std::array<float,2>{0.999600887f, 0.83467567f},
-std::array<float,2>{0.0515593775f, 0.784305513f},
-std::array<float,2>{0.500240624f, 0.365127981f},
-std::array<float,2>{0.408404469f, 0.190870374f},
-std::array<float,2>{0.75505662f, 0.66736573f},
-std::array<float,2>{0.26105094f, 0.559269488f},
-std::array<float,2>{0.902747512f, 0.0952766314f},
-std::array<float,2>{0.191821128f, 0.465873122f},
-std::array<float,2>{0.686745465f, 0.906959534f},
-std::array<float,2>{0.361002594f, 0.84578979f},
-std::array<float,2>{0.966175795f, 0.265387416f},
-std::array<float,2>{0.165505975f, 0.187223867f},
-std::array<float,2>{0.720810533f, 0.719530344f},
-std::array<float,2>{0.102790982f, 0.585567594f},
-std::array<float,2>{0.601801574f, 0.0294122156f},
-std::array<float,2>{0.457605243f, 0.41918546f},
-std::array<float,2>{0.817781746f, 0.940756679f},
-std::array<float,2>{0.242652386f, 0.887260079f},
-std::array<float,2>{0.631818533f, 0.470093518f},
-std::array<float,2>{0.305545002f, 0.069629468f},
-std::array<float,2>{0.935561478f, 0.52626431f},
-std::array<float,2>{0.391226202f, 0.645340979f},
-std::array<float,2>{0.811661541f, 0.22871922f},
-std::array<float,2>{0.0285792295f, 0.32221964f},
-std::array<float,2>{0.542087674f, 0.771058977f},
-std::array<float,2>{0.281526268f, 0.929760039f},
-std::array<float,2>{0.910486937f, 0.443494737f},
-std::array<float,2>{0.2309753f, 0.115569115f},
-std::array<float,2>{0.652770579f, 0.536207855f},
-std::array<float,2>{0.0115638971f, 0.673453212f},
-std::array<float,2>{0.556449413f, 0.216878042f},
-std::array<float,2>{0.376279384f, 0.345568508f},
-std::array<float,2>{0.796632528f, 0.806913495f},
-std::array<float,2>{0.175124273f, 0.821447611f},
-std::array<float,2>{0.740227878f, 0.311520964f},
-std::array<float,2>{0.345100701f, 0.126742244f},
-std::array<float,2>{0.942384481f, 0.704045892f},
-std::array<float,2>{0.446041852f, 0.608010411f},
-std::array<float,2>{0.835713744f, 0.0420151167f},
-std::array<float,2>{0.117155105f, 0.376075447f},
-std::array<float,2>{0.622619629f, 0.972126901f},
-std::array<float,2>{0.425923258f, 0.762594581f},
-std::array<float,2>{0.775768936f, 0.336497366f},
-std::array<float,2>{0.0318778604f, 0.243107289f},
-std::array<float,2>{0.530219734f, 0.626016021f},
-std::array<float,2>{0.21489884f, 0.503362417f},
-std::array<float,2>{0.657763243f, 0.0788958296f},
-std::array<float,2>{0.266750574f, 0.492701858f},
-std::array<float,2>{0.889298975f, 0.902852476f},
-std::array<float,2>{0.0804207623f, 0.958758116f},
-std::array<float,2>{0.581314027f, 0.434829414f},
-std::array<float,2>{0.489765376f, 0.00646116026f},
-std::array<float,2>{0.868920803f, 0.57583797f},
-std::array<float,2>{0.326749921f, 0.749527693f},
-std::array<float,2>{0.981572688f, 0.165454134f},
-std::array<float,2>{0.147477984f, 0.271274626f},
-std::array<float,2>{0.702888548f, 0.862796426f},
-std::array<float,2>{0.439085782f, 0.912450552f},
-std::array<float,2>{0.842323422f, 0.461400419f},
-std::array<float,2>{0.120469876f, 0.100835919f},
-std::array<float,2>{0.609681904f, 0.557398379f},
-std::array<float,2>{0.180120662f, 0.668685257f},
-std::array<float,2>{0.745387852f, 0.194386914f},
-std::array<float,2>{0.355632693f, 0.359778494f},
-std::array<float,2>{0.953074753f, 0.787063599f},
-std::array<float,2>{0.00293544866f, 0.831106007f},
-std::array<float,2>{0.547149837f, 0.282993257f},
-std::array<float,2>{0.385821104f, 0.143623888f},
-std::array<float,2>{0.783734739f, 0.688716352f},
-std::array<float,2>{0.296810895f, 0.611293137f},
-std::array<float,2>{0.917944849f, 0.0508481637f},
-std::array<float,2>{0.224540666f, 0.392951578f},
-std::array<float,2>{0.642646492f, 0.989180386f},
-std::array<float,2>{0.317644954f, 0.7683146f},
-std::array<float,2>{0.976300895f, 0.325733185f},
-std::array<float,2>{0.153537169f, 0.232602224f},
-std::array<float,2>{0.691354871f, 0.644215345f},
-std::array<float,2>{0.0869271606f, 0.52800113f},
-std::array<float,2>{0.593205154f, 0.0632214472f},
-std::array<float,2>{0.49626562f, 0.475408226f},
-std::array<float,2>{0.865374386f, 0.884923339f},
-std::array<float,2>{0.210857913f, 0.944038093f},
-std::array<float,2>{0.666710079f, 0.41587168f},
-std::array<float,2>{0.279270291f, 0.0244961735f},
-std::array<float,2>{0.879866004f, 0.578388751f},
-std::array<float,2>{0.433362395f, 0.724811673f},
-std::array<float,2>{0.765631616f, 0.180608541f},
-std::array<float,2>{0.0453146733f, 0.261661321f},
-std::array<float,2>{0.522360742f, 0.850147903f},
-std::array<float,2>{0.252380192f, 0.973726332f},
-std::array<float,2>{0.896476865f, 0.379111409f},
-std::array<float,2>{0.201359034f, 0.0434940457f},
-std::array<float,2>{0.679032803f, 0.604867637f},
-std::array<float,2>{0.0572016537f, 0.709713399f},
-std::array<float,2>{0.510897577f, 0.132569283f},
-std::array<float,2>{0.416197628f, 0.307579041f},
-std::array<float,2>{0.760762691f, 0.824924946f},
-std::array<float,2>{0.129545957f, 0.810680151f},
-std::array<float,2>{0.714784443f, 0.347763985f},
-std::array<float,2>{0.33601594f, 0.213249445f},
-std::array<float,2>{0.986191511f, 0.678236306f},
-std::array<float,2>{0.471184283f, 0.534582973f},
-std::array<float,2>{0.848304451f, 0.1094402f},
-std::array<float,2>{0.0762469396f, 0.437895715f},
-std::array<float,2>{0.566873431f, 0.933788896f},
-std::array<float,2>{0.40097034f, 0.864165545f},
-std::array<float,2>{0.79961431f, 0.268170208f},
-std::array<float,2>{0.0166755356f, 0.168048367f},
-std::array<float,2>{0.534676909f, 0.743861318f},
-std::array<float,2>{0.235494763f, 0.571143806f},
-std::array<float,2>{0.636598647f, 0.00377605995f},
-std::array<float,2>{0.298945308f, 0.430648059f},
-std::array<float,2>{0.929302275f, 0.954918563f},
-std::array<float,2>{0.0985976905f, 0.898944378f},
-std::array<float,2>{0.596835077f, 0.497937799f},
-std::array<float,2>{0.467583984f, 0.0829365999f},
-std::array<float,2>{0.824135423f, 0.506064713f},
-std::array<float,2>{0.371142566f, 0.630463541f},
-std::array<float,2>{0.958275676f, 0.249300703f},
-std::array<float,2>{0.160284355f, 0.343099743f},
-std::array<float,2>{0.726731837f, 0.75920397f},
-std::array<float,2>{0.414020598f, 0.965679348f},
-std::array<float,2>{0.752116084f, 0.429188162f},
-std::array<float,2>{0.0506188534f, 0.0145411203f},
-std::array<float,2>{0.504855156f, 0.569868803f},
-std::array<float,2>{0.190509945f, 0.735536754f},
-std::array<float,2>{0.682978213f, 0.161335796f},
-std::array<float,2>{0.261921048f, 0.280310541f},
-std::array<float,2>{0.89958936f, 0.868132591f},
-std::array<float,2>{0.0703088865f, 0.750077426f},
-std::array<float,2>{0.576064646f, 0.328875571f},
-std::array<float,2>{0.478684217f, 0.240745261f},
-std::array<float,2>{0.855352879f, 0.638385236f},
-std::array<float,2>{0.334574342f, 0.511987686f},
-std::array<float,2>{0.995493531f, 0.0933614671f},
-std::array<float,2>{0.136450291f, 0.49194628f},
-std::array<float,2>{0.708179772f, 0.897598565f},
-std::array<float,2>{0.308705002f, 0.817583025f},
-std::array<float,2>{0.933033168f, 0.299439162f},
-std::array<float,2>{0.247313514f, 0.139046758f},
-std::array<float,2>{0.625996232f, 0.714370847f},
-std::array<float,2>{0.0243883859f, 0.59405458f},
-std::array<float,2>{0.544445097f, 0.0376491174f},
-std::array<float,2>{0.39606753f, 0.383721739f},
-std::array<float,2>{0.806622744f, 0.977107704f},
-std::array<float,2>{0.168111488f, 0.923119068f},
-std::array<float,2>{0.725067854f, 0.445699662f},
-std::array<float,2>{0.364693761f, 0.121620543f},
-std::array<float,2>{0.963546276f, 0.542022705f},
-std::array<float,2>{0.455438256f, 0.685322762f},
-std::array<float,2>{0.815422714f, 0.205497131f},
-std::array<float,2>{0.109026149f, 0.354187071f},
-std::array<float,2>{0.605870903f, 0.802197397f},
-std::array<float,2>{0.349918574f, 0.877222121f},
-std::array<float,2>{0.940805614f, 0.482113689f},
-std::array<float,2>{0.176976964f, 0.0720369443f},
-std::array<float,2>{0.734771729f, 0.517676532f},
-std::array<float,2>{0.113058493f, 0.651343763f},
-std::array<float,2>{0.618487537f, 0.21910882f},
-std::array<float,2>{0.451896667f, 0.315826386f},
-std::array<float,2>{0.831136584f, 0.775015712f},
-std::array<float,2>{0.227402255f, 0.857716322f},
-std::array<float,2>{0.650471032f, 0.254005909f},
-std::array<float,2>{0.286272764f, 0.176767051f},
-std::array<float,2>{0.90807569f, 0.728617966f},
-std::array<float,2>{0.379136115f, 0.589590311f},
-std::array<float,2>{0.791505992f, 0.0221507493f},
-std::array<float,2>{0.0130534917f, 0.410791636f},
-std::array<float,2>{0.559133708f, 0.949252963f},
-std::array<float,2>{0.485175222f, 0.793721497f},
-std::array<float,2>{0.871356785f, 0.369336218f},
-std::array<float,2>{0.0834264308f, 0.201068103f},
-std::array<float,2>{0.582238734f, 0.659832656f},
-std::array<float,2>{0.14105396f, 0.548942804f},
-std::array<float,2>{0.69612509f, 0.103705607f},
-std::array<float,2>{0.320686519f, 0.459369212f},
-std::array<float,2>{0.977319598f, 0.915108621f},
-std::array<float,2>{0.03819656f, 0.997056067f},
-std::array<float,2>{0.525197446f, 0.405297518f},
-std::array<float,2>{0.424700022f, 0.0557638407f},
-std::array<float,2>{0.781136692f, 0.622319877f},
-std::array<float,2>{0.270332128f, 0.696104646f},
-std::array<float,2>{0.88526535f, 0.154915199f},
-std::array<float,2>{0.212990999f, 0.289780825f},
-std::array<float,2>{0.662028372f, 0.838957667f},
-std::array<float,2>{0.376689106f, 0.933194101f},
-std::array<float,2>{0.79606694f, 0.442193508f},
-std::array<float,2>{0.0109474622f, 0.113409579f},
-std::array<float,2>{0.556089222f, 0.537445426f},
-std::array<float,2>{0.230678111f, 0.67389524f},
-std::array<float,2>{0.653104186f, 0.21561189f},
-std::array<float,2>{0.281839818f, 0.346176147f},
-std::array<float,2>{0.910695612f, 0.806287825f},
-std::array<float,2>{0.116309047f, 0.823311269f},
-std::array<float,2>{0.622535884f, 0.310248911f},
-std::array<float,2>{0.445390105f, 0.127017751f},
-std::array<float,2>{0.835251629f, 0.705565631f},
-std::array<float,2>{0.345526695f, 0.60609293f},
-std::array<float,2>{0.943137169f, 0.0406993702f},
-std::array<float,2>{0.175557658f, 0.378099918f},
-std::array<float,2>{0.739302695f, 0.969194114f},
-std::array<float,2>{0.267365187f, 0.764323652f},
-std::array<float,2>{0.888718069f, 0.339605778f},
-std::array<float,2>{0.21542652f, 0.244608432f},
-std::array<float,2>{0.657330155f, 0.628621936f},
-std::array<float,2>{0.0314137973f, 0.500532985f},
-std::array<float,2>{0.529716849f, 0.0816782936f},
-std::array<float,2>{0.426722944f, 0.494582981f},
-std::array<float,2>{0.776355803f, 0.904889643f},
-std::array<float,2>{0.148303315f, 0.960066617f},
-std::array<float,2>{0.702392519f, 0.436743826f},
-std::array<float,2>{0.326388955f, 0.0045887637f},
-std::array<float,2>{0.982404768f, 0.577226818f},
-std::array<float,2>{0.489407182f, 0.746904731f},
-std::array<float,2>{0.8682096f, 0.167720243f},
-std::array<float,2>{0.080602251f, 0.272920847f},
-std::array<float,2>{0.581642509f, 0.860003412f},
-std::array<float,2>{0.331080556f, 0.986915231f},
-std::array<float,2>{0.999286175f, 0.39693138f},
-std::array<float,2>{0.140287861f, 0.0501721278f},
-std::array<float,2>{0.704474211f, 0.61680305f},
-std::array<float,2>{0.0628946647f, 0.694832146f},
-std::array<float,2>{0.571389198f, 0.145818427f},
-std::array<float,2>{0.482037604f, 0.288744897f},
-std::array<float,2>{0.856712759f, 0.83218056f},
-std::array<float,2>{0.192023322f, 0.781712949f},
-std::array<float,2>{0.687482059f, 0.366479099f},
-std::array<float,2>{0.261296421f, 0.188297674f},
-std::array<float,2>{0.903225422f, 0.665891528f},
-std::array<float,2>{0.409112066f, 0.561236382f},
-std::array<float,2>{0.755525589f, 0.0967249572f},
-std::array<float,2>{0.0509470366f, 0.468081236f},
-std::array<float,2>{0.500942945f, 0.909071684f},
-std::array<float,2>{0.457451016f, 0.845117152f},
-std::array<float,2>{0.817930818f, 0.263331622f},
-std::array<float,2>{0.103185371f, 0.185377404f},
-std::array<float,2>{0.602232456f, 0.721449077f},
-std::array<float,2>{0.165891156f, 0.582855046f},
-std::array<float,2>{0.721354842f, 0.0281848777f},
-std::array<float,2>{0.360607445f, 0.420152843f},
-std::array<float,2>{0.966707826f, 0.938624144f},
-std::array<float,2>{0.0289266054f, 0.888851047f},
-std::array<float,2>{0.542822003f, 0.471506715f},
-std::array<float,2>{0.390894681f, 0.0665274635f},
-std::array<float,2>{0.812387884f, 0.523624897f},
-std::array<float,2>{0.305106103f, 0.646802366f},
-std::array<float,2>{0.936476052f, 0.228037581f},
-std::array<float,2>{0.242875308f, 0.324073017f},
-std::array<float,2>{0.631174803f, 0.771969736f},
-std::array<float,2>{0.472743928f, 0.945843697f},
-std::array<float,2>{0.845124543f, 0.407630235f},
-std::array<float,2>{0.0738874599f, 0.0164681263f},
-std::array<float,2>{0.563415229f, 0.590421259f},
-std::array<float,2>{0.126763716f, 0.732259214f},
-std::array<float,2>{0.717030048f, 0.172739759f},
-std::array<float,2>{0.340229899f, 0.250970125f},
-std::array<float,2>{0.991594374f, 0.85429132f},
-std::array<float,2>{0.0594918467f, 0.780722618f},
-std::array<float,2>{0.515408874f, 0.318333834f},
-std::array<float,2>{0.421726644f, 0.225603402f},
-std::array<float,2>{0.763710439f, 0.655629158f},
-std::array<float,2>{0.256534934f, 0.520842671f},
-std::array<float,2>{0.894392371f, 0.076778993f},
-std::array<float,2>{0.196041092f, 0.478775114f},
-std::array<float,2>{0.673716128f, 0.880659223f},
-std::array<float,2>{0.368537903f, 0.842359841f},
-std::array<float,2>{0.95429939f, 0.294635922f},
-std::array<float,2>{0.159989282f, 0.150327682f},
-std::array<float,2>{0.73142606f, 0.702584028f},
-std::array<float,2>{0.0964125544f, 0.61767596f},
-std::array<float,2>{0.597718596f, 0.0586543866f},
-std::array<float,2>{0.463806599f, 0.400173008f},
-std::array<float,2>{0.825999975f, 0.992365301f},
-std::array<float,2>{0.238870531f, 0.920722663f},
-std::array<float,2>{0.638983607f, 0.456207246f},
-std::array<float,2>{0.302414298f, 0.106691144f},
-std::array<float,2>{0.924387693f, 0.55358851f},
-std::array<float,2>{0.403096348f, 0.66394335f},
-std::array<float,2>{0.803981245f, 0.19595103f},
-std::array<float,2>{0.0218292698f, 0.373129755f},
-std::array<float,2>{0.538044095f, 0.791082084f},
-std::array<float,2>{0.290008813f, 0.893901348f},
-std::array<float,2>{0.920890927f, 0.485717863f},
-std::array<float,2>{0.221788123f, 0.0880545452f},
-std::array<float,2>{0.64757061f, 0.510547459f},
-std::array<float,2>{0.00470887823f, 0.633697093f},
-std::array<float,2>{0.552952707f, 0.238191411f},
-std::array<float,2>{0.38943851f, 0.332731247f},
-std::array<float,2>{0.785797477f, 0.754273713f},
-std::array<float,2>{0.186917618f, 0.872512877f},
-std::array<float,2>{0.748642504f, 0.276136369f},
-std::array<float,2>{0.352421582f, 0.159140751f},
-std::array<float,2>{0.949201941f, 0.740866542f},
-std::array<float,2>{0.441997677f, 0.562703013f},
-std::array<float,2>{0.836551189f, 0.00954393018f},
-std::array<float,2>{0.124474153f, 0.424945533f},
-std::array<float,2>{0.615315735f, 0.963124156f},
-std::array<float,2>{0.436279088f, 0.799979925f},
-std::array<float,2>{0.771588624f, 0.355481416f},
-std::array<float,2>{0.0418034196f, 0.209060237f},
-std::array<float,2>{0.517312944f, 0.682030797f},
-std::array<float,2>{0.204436988f, 0.546718419f},
-std::array<float,2>{0.668889582f, 0.117998667f},
-std::array<float,2>{0.275552243f, 0.450357765f},
-std::array<float,2>{0.877610505f, 0.925836444f},
-std::array<float,2>{0.0919339657f, 0.982476175f},
-std::array<float,2>{0.589004397f, 0.387971014f},
-std::array<float,2>{0.492741972f, 0.0313688889f},
-std::array<float,2>{0.861583591f, 0.597805023f},
-std::array<float,2>{0.315598309f, 0.715961456f},
-std::array<float,2>{0.969165564f, 0.133247465f},
-std::array<float,2>{0.151115805f, 0.301788807f},
-std::array<float,2>{0.691935182f, 0.813310742f},
-std::array<float,2>{0.451658428f, 0.876492202f},
-std::array<float,2>{0.831941605f, 0.48421663f},
-std::array<float,2>{0.112306394f, 0.0730433539f},
-std::array<float,2>{0.618705511f, 0.516619802f},
-std::array<float,2>{0.177459627f, 0.649499536f},
-std::array<float,2>{0.73531574f, 0.22200802f},
-std::array<float,2>{0.350476503f, 0.313267648f},
-std::array<float,2>{0.94129163f, 0.777038634f},
-std::array<float,2>{0.0136383036f, 0.855940878f},
-std::array<float,2>{0.558695316f, 0.256573766f},
-std::array<float,2>{0.379836202f, 0.179351464f},
-std::array<float,2>{0.791092217f, 0.72832191f},
-std::array<float,2>{0.287011981f, 0.586516678f},
-std::array<float,2>{0.907255411f, 0.0197016969f},
-std::array<float,2>{0.226895213f, 0.412775964f},
-std::array<float,2>{0.650965452f, 0.951705277f},
-std::array<float,2>{0.32108584f, 0.796334684f},
-std::array<float,2>{0.977017224f, 0.367441386f},
-std::array<float,2>{0.141443476f, 0.202733234f},
-std::array<float,2>{0.695639014f, 0.657611132f},
-std::array<float,2>{0.0838684216f, 0.54767555f},
-std::array<float,2>{0.582608998f, 0.102825284f},
-std::array<float,2>{0.484403372f, 0.45873946f},
-std::array<float,2>{0.872061253f, 0.917122126f},
-std::array<float,2>{0.21363017f, 0.998756588f},
-std::array<float,2>{0.661326945f, 0.403946549f},
-std::array<float,2>{0.269712985f, 0.0567358583f},
-std::array<float,2>{0.885157704f, 0.623879135f},
-std::array<float,2>{0.424224436f, 0.698831379f},
-std::array<float,2>{0.780649483f, 0.153439954f},
-std::array<float,2>{0.0390573815f, 0.292830735f},
-std::array<float,2>{0.524619877f, 0.836368561f},
-std::array<float,2>{0.26246196f, 0.967239559f},
-std::array<float,2>{0.900096118f, 0.426675975f},
-std::array<float,2>{0.191220924f, 0.0128539503f},
-std::array<float,2>{0.683211982f, 0.567278504f},
-std::array<float,2>{0.0499319769f, 0.736721456f},
-std::array<float,2>{0.504055679f, 0.162780732f},
-std::array<float,2>{0.413365662f, 0.278660059f},
-std::array<float,2>{0.752572358f, 0.869722247f},
-std::array<float,2>{0.136075959f, 0.753196597f},
-std::array<float,2>{0.708929241f, 0.330804557f},
-std::array<float,2>{0.334371924f, 0.23882705f},
-std::array<float,2>{0.996023655f, 0.638877094f},
-std::array<float,2>{0.479148865f, 0.5146029f},
-std::array<float,2>{0.854816616f, 0.0913739204f},
-std::array<float,2>{0.0694087297f, 0.488892108f},
-std::array<float,2>{0.575221896f, 0.894692123f},
-std::array<float,2>{0.39561522f, 0.818676233f},
-std::array<float,2>{0.805766284f, 0.298753023f},
-std::array<float,2>{0.0236941595f, 0.137978628f},
-std::array<float,2>{0.544240355f, 0.712547004f},
-std::array<float,2>{0.247827426f, 0.595988989f},
-std::array<float,2>{0.626846731f, 0.0352596231f},
-std::array<float,2>{0.309124261f, 0.386117309f},
-std::array<float,2>{0.933178008f, 0.978926837f},
-std::array<float,2>{0.10875041f, 0.925426304f},
-std::array<float,2>{0.606048405f, 0.447767764f},
-std::array<float,2>{0.455683202f, 0.124644376f},
-std::array<float,2>{0.814575136f, 0.539578021f},
-std::array<float,2>{0.365079314f, 0.686931074f},
-std::array<float,2>{0.962983727f, 0.203206107f},
-std::array<float,2>{0.168809742f, 0.352479845f},
-std::array<float,2>{0.725395024f, 0.804070652f},
-std::array<float,2>{0.416654944f, 0.974865556f},
-std::array<float,2>{0.761668205f, 0.382163882f},
-std::array<float,2>{0.0567474104f, 0.0455670469f},
-std::array<float,2>{0.51128161f, 0.602867782f},
-std::array<float,2>{0.201935381f, 0.70814085f},
-std::array<float,2>{0.679588616f, 0.13038069f},
-std::array<float,2>{0.252747387f, 0.305944502f},
-std::array<float,2>{0.895677805f, 0.827344239f},
-std::array<float,2>{0.0770004392f, 0.809199691f},
-std::array<float,2>{0.567314386f, 0.351500958f},
-std::array<float,2>{0.471260428f, 0.211417153f},
-std::array<float,2>{0.84770757f, 0.675903022f},
-std::array<float,2>{0.336776823f, 0.532737076f},
-std::array<float,2>{0.985562146f, 0.112777844f},
-std::array<float,2>{0.12906982f, 0.439647436f},
-std::array<float,2>{0.714038312f, 0.935818732f},
-std::array<float,2>{0.29943946f, 0.866132677f},
-std::array<float,2>{0.929075301f, 0.267122388f},
-std::array<float,2>{0.236122042f, 0.170121744f},
-std::array<float,2>{0.635938704f, 0.745112956f},
-std::array<float,2>{0.0171287991f, 0.572594762f},
-std::array<float,2>{0.5341959f, 6.14007658e-05f},
-std::array<float,2>{0.400572985f, 0.432441711f},
-std::array<float,2>{0.799087286f, 0.956757605f},
-std::array<float,2>{0.160968795f, 0.901612043f},
-std::array<float,2>{0.727178454f, 0.498245776f},
-std::array<float,2>{0.371760905f, 0.0841752365f},
-std::array<float,2>{0.958701372f, 0.504234493f},
-std::array<float,2>{0.467109203f, 0.632168472f},
-std::array<float,2>{0.823303938f, 0.24763675f},
-std::array<float,2>{0.0980242044f, 0.339959621f},
-std::array<float,2>{0.597175181f, 0.760204434f},
-std::array<float,2>{0.356078088f, 0.910857975f},
-std::array<float,2>{0.952244699f, 0.463809252f},
-std::array<float,2>{0.180232778f, 0.0976800323f},
-std::array<float,2>{0.745739758f, 0.556297421f},
-std::array<float,2>{0.120638527f, 0.670868039f},
-std::array<float,2>{0.610300958f, 0.191584542f},
-std::array<float,2>{0.438954085f, 0.361618817f},
-std::array<float,2>{0.842231989f, 0.787472665f},
-std::array<float,2>{0.223935306f, 0.828235805f},
-std::array<float,2>{0.643470407f, 0.283367336f},
-std::array<float,2>{0.295921594f, 0.140918583f},
-std::array<float,2>{0.9170717f, 0.689937115f},
-std::array<float,2>{0.386477798f, 0.611907423f},
-std::array<float,2>{0.783286631f, 0.0546530262f},
-std::array<float,2>{0.00362706021f, 0.391438365f},
-std::array<float,2>{0.547600687f, 0.991008997f},
-std::array<float,2>{0.496633232f, 0.767378747f},
-std::array<float,2>{0.866104543f, 0.326492459f},
-std::array<float,2>{0.0876540765f, 0.231471658f},
-std::array<float,2>{0.593433499f, 0.640787363f},
-std::array<float,2>{0.154130951f, 0.531222522f},
-std::array<float,2>{0.690815151f, 0.0653673112f},
-std::array<float,2>{0.317990601f, 0.473131865f},
-std::array<float,2>{0.975666821f, 0.88457334f},
-std::array<float,2>{0.0456811935f, 0.943318605f},
-std::array<float,2>{0.521690071f, 0.417828649f},
-std::array<float,2>{0.433080584f, 0.0260322392f},
-std::array<float,2>{0.766591132f, 0.581622422f},
-std::array<float,2>{0.27858755f, 0.723636687f},
-std::array<float,2>{0.879277289f, 0.182622463f},
-std::array<float,2>{0.210034996f, 0.259179264f},
-std::array<float,2>{0.666106403f, 0.848216236f},
-std::array<float,2>{0.429298609f, 0.902786911f},
-std::array<float,2>{0.773543477f, 0.492342263f},
-std::array<float,2>{0.0338078961f, 0.0783140808f},
-std::array<float,2>{0.528598726f, 0.503729761f},
-std::array<float,2>{0.216876417f, 0.62672925f},
-std::array<float,2>{0.659422338f, 0.242335796f},
-std::array<float,2>{0.269322455f, 0.336093277f},
-std::array<float,2>{0.88700366f, 0.761800528f},
-std::array<float,2>{0.0799715966f, 0.862791717f},
-std::array<float,2>{0.579179227f, 0.270934939f},
-std::array<float,2>{0.490328401f, 0.165656134f},
-std::array<float,2>{0.871025145f, 0.749059558f},
-std::array<float,2>{0.324571252f, 0.575473487f},
-std::array<float,2>{0.984187901f, 0.00592526095f},
-std::array<float,2>{0.145155475f, 0.435182869f},
-std::array<float,2>{0.700008512f, 0.958280385f},
-std::array<float,2>{0.28345564f, 0.807370067f},
-std::array<float,2>{0.913110256f, 0.345132411f},
-std::array<float,2>{0.232805118f, 0.21748437f},
-std::array<float,2>{0.655085206f, 0.672983825f},
-std::array<float,2>{0.00962234568f, 0.536848545f},
-std::array<float,2>{0.558452904f, 0.115837865f},
-std::array<float,2>{0.377704531f, 0.443986326f},
-std::array<float,2>{0.793303192f, 0.930360973f},
-std::array<float,2>{0.172450453f, 0.972576976f},
-std::array<float,2>{0.740374506f, 0.376560569f},
-std::array<float,2>{0.347299576f, 0.0426662043f},
-std::array<float,2>{0.94418776f, 0.607523978f},
-std::array<float,2>{0.448303938f, 0.703589857f},
-std::array<float,2>{0.833319187f, 0.1260975f},
-std::array<float,2>{0.113432139f, 0.310579151f},
-std::array<float,2>{0.62453258f, 0.821877956f},
-std::array<float,2>{0.361986786f, 0.941026688f},
-std::array<float,2>{0.967726529f, 0.419746935f},
-std::array<float,2>{0.166585118f, 0.0302315634f},
-std::array<float,2>{0.720524907f, 0.585153282f},
-std::array<float,2>{0.103687346f, 0.719160318f},
-std::array<float,2>{0.605328143f, 0.186854571f},
-std::array<float,2>{0.460291177f, 0.26477015f},
-std::array<float,2>{0.818962514f, 0.84654367f},
-std::array<float,2>{0.244168028f, 0.770792127f},
-std::array<float,2>{0.62895906f, 0.321526259f},
-std::array<float,2>{0.307438403f, 0.229086533f},
-std::array<float,2>{0.935239494f, 0.644749701f},
-std::array<float,2>{0.394440889f, 0.525807977f},
-std::array<float,2>{0.808683097f, 0.0699307397f},
-std::array<float,2>{0.0310744215f, 0.47069177f},
-std::array<float,2>{0.540961683f, 0.8871907f},
-std::array<float,2>{0.482592791f, 0.834100604f},
-std::array<float,2>{0.859354258f, 0.287018418f},
-std::array<float,2>{0.0660560355f, 0.148076326f},
-std::array<float,2>{0.574174643f, 0.69234401f},
-std::array<float,2>{0.137281939f, 0.613883853f},
-std::array<float,2>{0.705303848f, 0.0487428308f},
-std::array<float,2>{0.328125387f, 0.396306932f},
-std::array<float,2>{0.997910202f, 0.986060262f},
-std::array<float,2>{0.0532818809f, 0.906668901f},
-std::array<float,2>{0.502721906f, 0.466566175f},
-std::array<float,2>{0.406413436f, 0.0949042812f},
-std::array<float,2>{0.757216275f, 0.558927417f},
-std::array<float,2>{0.258730322f, 0.667730093f},
-std::array<float,2>{0.904484034f, 0.191180855f},
-std::array<float,2>{0.194634929f, 0.364285618f},
-std::array<float,2>{0.684714198f, 0.784932017f},
-std::array<float,2>{0.462334037f, 0.994183421f},
-std::array<float,2>{0.828035712f, 0.402305573f},
-std::array<float,2>{0.0956769064f, 0.0615150817f},
-std::array<float,2>{0.601151705f, 0.620058179f},
-std::array<float,2>{0.157220557f, 0.699877739f},
-std::array<float,2>{0.734362125f, 0.151122212f},
-std::array<float,2>{0.370198756f, 0.295017362f},
-std::array<float,2>{0.95513618f, 0.839847922f},
-std::array<float,2>{0.0199398566f, 0.790942311f},
-std::array<float,2>{0.535366237f, 0.372693241f},
-std::array<float,2>{0.405671388f, 0.198139668f},
-std::array<float,2>{0.801417768f, 0.661858082f},
-std::array<float,2>{0.304313034f, 0.552326679f},
-std::array<float,2>{0.922040224f, 0.107565477f},
-std::array<float,2>{0.242132127f, 0.453977138f},
-std::array<float,2>{0.637083054f, 0.918658793f},
-std::array<float,2>{0.343483984f, 0.852690458f},
-std::array<float,2>{0.988821864f, 0.253310472f},
-std::array<float,2>{0.128583282f, 0.174814746f},
-std::array<float,2>{0.715022802f, 0.734240413f},
-std::array<float,2>{0.0718841404f, 0.592875957f},
-std::array<float,2>{0.564638972f, 0.0184735823f},
-std::array<float,2>{0.475048751f, 0.408659309f},
-std::array<float,2>{0.846096277f, 0.947751582f},
-std::array<float,2>{0.198258176f, 0.882614851f},
-std::array<float,2>{0.67547363f, 0.477446884f},
-std::array<float,2>{0.254467189f, 0.0760116652f},
-std::array<float,2>{0.892069757f, 0.523115158f},
-std::array<float,2>{0.418041259f, 0.652951419f},
-std::array<float,2>{0.762968421f, 0.222813457f},
-std::array<float,2>{0.0610477589f, 0.320059687f},
-std::array<float,2>{0.512171745f, 0.777374566f},
-std::array<float,2>{0.273736835f, 0.92781961f},
-std::array<float,2>{0.875468194f, 0.451888949f},
-std::array<float,2>{0.205482513f, 0.119799793f},
-std::array<float,2>{0.671045661f, 0.543325305f},
-std::array<float,2>{0.0403126627f, 0.681261718f},
-std::array<float,2>{0.519028366f, 0.208679065f},
-std::array<float,2>{0.434601724f, 0.358127385f},
-std::array<float,2>{0.770157874f, 0.798800766f},
-std::array<float,2>{0.149641275f, 0.814574301f},
-std::array<float,2>{0.6949417f, 0.304103404f},
-std::array<float,2>{0.312735081f, 0.134824142f},
-std::array<float,2>{0.970970333f, 0.718054175f},
-std::array<float,2>{0.495461315f, 0.599983037f},
-std::array<float,2>{0.860846221f, 0.0334694311f},
-std::array<float,2>{0.0902418867f, 0.388721734f},
-std::array<float,2>{0.586661577f, 0.98182869f},
-std::array<float,2>{0.387909859f, 0.755977273f},
-std::array<float,2>{0.788790286f, 0.33555299f},
-std::array<float,2>{0.00665593985f, 0.235094428f},
-std::array<float,2>{0.551355422f, 0.634784043f},
-std::array<float,2>{0.218908668f, 0.508180559f},
-std::array<float,2>{0.644793272f, 0.0873401985f},
-std::array<float,2>{0.292274863f, 0.487702489f},
-std::array<float,2>{0.919607341f, 0.890761435f},
-std::array<float,2>{0.122980885f, 0.962172925f},
-std::array<float,2>{0.615154982f, 0.423153073f},
-std::array<float,2>{0.443438113f, 0.0101862857f},
-std::array<float,2>{0.838051379f, 0.565570772f},
-std::array<float,2>{0.354239285f, 0.739580452f},
-std::array<float,2>{0.945903599f, 0.157675609f},
-std::array<float,2>{0.184777007f, 0.274918377f},
-std::array<float,2>{0.747606516f, 0.873769522f},
-std::array<float,2>{0.486995965f, 0.91559726f},
-std::array<float,2>{0.87357676f, 0.459610641f},
-std::array<float,2>{0.0855650976f, 0.104220599f},
-std::array<float,2>{0.585415006f, 0.549358845f},
-std::array<float,2>{0.143718779f, 0.659266233f},
-std::array<float,2>{0.698284626f, 0.200469062f},
-std::array<float,2>{0.32355994f, 0.36976105f},
-std::array<float,2>{0.979049146f, 0.793201864f},
-std::array<float,2>{0.0370363519f, 0.839441776f},
-std::array<float,2>{0.526956499f, 0.289251864f},
-std::array<float,2>{0.423762113f, 0.154324636f},
-std::array<float,2>{0.777502894f, 0.69549042f},
-std::array<float,2>{0.272844017f, 0.622559726f},
-std::array<float,2>{0.883155406f, 0.0563224703f},
-std::array<float,2>{0.212401912f, 0.406193852f},
-std::array<float,2>{0.663919568f, 0.99641937f},
-std::array<float,2>{0.348101646f, 0.774727404f},
-std::array<float,2>{0.93805325f, 0.315940827f},
-std::array<float,2>{0.179545492f, 0.219495267f},
-std::array<float,2>{0.737893879f, 0.650766611f},
-std::array<float,2>{0.110818915f, 0.518149197f},
-std::array<float,2>{0.620325208f, 0.0717105791f},
-std::array<float,2>{0.450476587f, 0.481618404f},
-std::array<float,2>{0.828966618f, 0.877443671f},
-std::array<float,2>{0.229745403f, 0.950155675f},
-std::array<float,2>{0.648764908f, 0.410439998f},
-std::array<float,2>{0.288051426f, 0.0215172656f},
-std::array<float,2>{0.908209026f, 0.58898741f},
-std::array<float,2>{0.382193446f, 0.72940737f},
-std::array<float,2>{0.790514231f, 0.177426592f},
-std::array<float,2>{0.0139460079f, 0.254439384f},
-std::array<float,2>{0.561220169f, 0.858036339f},
-std::array<float,2>{0.310579926f, 0.976954341f},
-std::array<float,2>{0.930726826f, 0.382894427f},
-std::array<float,2>{0.249964461f, 0.0375717767f},
-std::array<float,2>{0.628092587f, 0.594643354f},
-std::array<float,2>{0.025915578f, 0.713987291f},
-std::array<float,2>{0.546101451f, 0.139309362f},
-std::array<float,2>{0.396721333f, 0.299297214f},
-std::array<float,2>{0.807694674f, 0.817979991f},
-std::array<float,2>{0.170033708f, 0.802552581f},
-std::array<float,2>{0.723454177f, 0.353976011f},
-std::array<float,2>{0.366172016f, 0.205927119f},
-std::array<float,2>{0.961134493f, 0.68486166f},
-std::array<float,2>{0.453463852f, 0.542826831f},
-std::array<float,2>{0.812622368f, 0.121429138f},
-std::array<float,2>{0.106717229f, 0.446249038f},
-std::array<float,2>{0.608314276f, 0.923737347f},
-std::array<float,2>{0.411474228f, 0.867194355f},
-std::array<float,2>{0.751187325f, 0.281053543f},
-std::array<float,2>{0.0486086719f, 0.162072852f},
-std::array<float,2>{0.506828666f, 0.736200035f},
-std::array<float,2>{0.189058676f, 0.56969744f},
-std::array<float,2>{0.681308329f, 0.0141475257f},
-std::array<float,2>{0.264149785f, 0.429245383f},
-std::array<float,2>{0.901332915f, 0.965032995f},
-std::array<float,2>{0.0667672679f, 0.89843452f},
-std::array<float,2>{0.576523483f, 0.491683424f},
-std::array<float,2>{0.476789832f, 0.0928780064f},
-std::array<float,2>{0.85249424f, 0.512630403f},
-std::array<float,2>{0.332078964f, 0.638181388f},
-std::array<float,2>{0.992962539f, 0.240325719f},
-std::array<float,2>{0.134074703f, 0.328467458f},
-std::array<float,2>{0.709647715f, 0.75094521f},
-std::array<float,2>{0.398979694f, 0.954379797f},
-std::array<float,2>{0.798716187f, 0.430003256f},
-std::array<float,2>{0.0186175294f, 0.00326530309f},
-std::array<float,2>{0.532287419f, 0.570585072f},
-std::array<float,2>{0.23748064f, 0.743314266f},
-std::array<float,2>{0.634415925f, 0.168776199f},
-std::array<float,2>{0.29755035f, 0.267593443f},
-std::array<float,2>{0.926799119f, 0.863640189f},
-std::array<float,2>{0.100160554f, 0.759599209f},
-std::array<float,2>{0.595665932f, 0.343391359f},
-std::array<float,2>{0.465352386f, 0.249652594f},
-std::array<float,2>{0.820715249f, 0.630086184f},
-std::array<float,2>{0.374259174f, 0.506550312f},
-std::array<float,2>{0.959486902f, 0.082327418f},
-std::array<float,2>{0.162870675f, 0.497481227f},
-std::array<float,2>{0.730134249f, 0.898750901f},
-std::array<float,2>{0.251651764f, 0.824359298f},
-std::array<float,2>{0.898238242f, 0.306699485f},
-std::array<float,2>{0.200608954f, 0.132169187f},
-std::array<float,2>{0.676126719f, 0.709398329f},
-std::array<float,2>{0.0549715906f, 0.605148137f},
-std::array<float,2>{0.508121371f, 0.0433636717f},
-std::array<float,2>{0.414638788f, 0.379711032f},
-std::array<float,2>{0.758289635f, 0.974552274f},
-std::array<float,2>{0.130915955f, 0.934544981f},
-std::array<float,2>{0.711996555f, 0.438396513f},
-std::array<float,2>{0.339490354f, 0.110203639f},
-std::array<float,2>{0.986794949f, 0.535105526f},
-std::array<float,2>{0.468799412f, 0.677838624f},
-std::array<float,2>{0.851126254f, 0.213689268f},
-std::array<float,2>{0.0753925815f, 0.348249108f},
-std::array<float,2>{0.568619013f, 0.811193585f},
-std::array<float,2>{0.318652511f, 0.885436416f},
-std::array<float,2>{0.973014772f, 0.474861592f},
-std::array<float,2>{0.156125024f, 0.0627728701f},
-std::array<float,2>{0.689315975f, 0.527645051f},
-std::array<float,2>{0.0884311348f, 0.643936098f},
-std::array<float,2>{0.591076195f, 0.233093277f},
-std::array<float,2>{0.498759866f, 0.325510114f},
-std::array<float,2>{0.864695013f, 0.767975509f},
-std::array<float,2>{0.20808199f, 0.84987402f},
-std::array<float,2>{0.664096713f, 0.260966539f},
-std::array<float,2>{0.279488057f, 0.18004179f},
-std::array<float,2>{0.882238925f, 0.725384653f},
-std::array<float,2>{0.431436479f, 0.579013944f},
-std::array<float,2>{0.767662823f, 0.025201166f},
-std::array<float,2>{0.0431067832f, 0.415352672f},
-std::array<float,2>{0.520954132f, 0.943519771f},
-std::array<float,2>{0.439738154f, 0.78650713f},
-std::array<float,2>{0.841285944f, 0.360174209f},
-std::array<float,2>{0.118163839f, 0.194852605f},
-std::array<float,2>{0.61200428f, 0.668267131f},
-std::array<float,2>{0.183059782f, 0.55698657f},
-std::array<float,2>{0.742936254f, 0.101336308f},
-std::array<float,2>{0.357583702f, 0.461639881f},
-std::array<float,2>{0.949337721f, 0.912982404f},
-std::array<float,2>{0.000960080826f, 0.98853451f},
-std::array<float,2>{0.550035417f, 0.393546432f},
-std::array<float,2>{0.384149969f, 0.051297728f},
-std::array<float,2>{0.782086492f, 0.610621691f},
-std::array<float,2>{0.293281764f, 0.689053893f},
-std::array<float,2>{0.915865421f, 0.144162789f},
-std::array<float,2>{0.225204021f, 0.282252699f},
-std::array<float,2>{0.641418934f, 0.83167845f},
-std::array<float,2>{0.407847583f, 0.909583509f},
-std::array<float,2>{0.756025136f, 0.467416376f},
-std::array<float,2>{0.0541662537f, 0.0961104259f},
-std::array<float,2>{0.50317055f, 0.561861038f},
-std::array<float,2>{0.193434551f, 0.664521098f},
-std::array<float,2>{0.683668077f, 0.188784137f},
-std::array<float,2>{0.259754062f, 0.365682483f},
-std::array<float,2>{0.906208217f, 0.782861054f},
-std::array<float,2>{0.0649046674f, 0.833804905f},
-std::array<float,2>{0.572985172f, 0.287875891f},
-std::array<float,2>{0.484134436f, 0.145009145f},
-std::array<float,2>{0.857729435f, 0.694254935f},
-std::array<float,2>{0.329348177f, 0.615958095f},
-std::array<float,2>{0.99677521f, 0.0490408316f},
-std::array<float,2>{0.137808621f, 0.397518188f},
-std::array<float,2>{0.706292033f, 0.98805815f},
-std::array<float,2>{0.308037877f, 0.773319125f},
-std::array<float,2>{0.93439573f, 0.323216051f},
-std::array<float,2>{0.245300069f, 0.22677429f},
-std::array<float,2>{0.630173087f, 0.64834106f},
-std::array<float,2>{0.0293339305f, 0.525242269f},
-std::array<float,2>{0.53921324f, 0.068069309f},
-std::array<float,2>{0.392925739f, 0.471765101f},
-std::array<float,2>{0.809711039f, 0.890304685f},
-std::array<float,2>{0.167498186f, 0.937957644f},
-std::array<float,2>{0.719596088f, 0.421846718f},
-std::array<float,2>{0.363271296f, 0.02850114f},
-std::array<float,2>{0.967844486f, 0.583301008f},
-std::array<float,2>{0.459421247f, 0.722214699f},
-std::array<float,2>{0.819773972f, 0.184060574f},
-std::array<float,2>{0.105178043f, 0.262689054f},
-std::array<float,2>{0.603723407f, 0.844267845f},
-std::array<float,2>{0.345873207f, 0.970568955f},
-std::array<float,2>{0.944408655f, 0.377888948f},
-std::array<float,2>{0.173690692f, 0.0398251787f},
-std::array<float,2>{0.74159354f, 0.606814384f},
-std::array<float,2>{0.11431206f, 0.707005858f},
-std::array<float,2>{0.623465776f, 0.128320202f},
-std::array<float,2>{0.447529763f, 0.309260249f},
-std::array<float,2>{0.832973301f, 0.822646081f},
-std::array<float,2>{0.233857051f, 0.805135608f},
-std::array<float,2>{0.65596056f, 0.347065777f},
-std::array<float,2>{0.284789652f, 0.215856493f},
-std::array<float,2>{0.912553668f, 0.675608099f},
-std::array<float,2>{0.378769845f, 0.538254857f},
-std::array<float,2>{0.794389248f, 0.115151092f},
-std::array<float,2>{0.00810842402f, 0.442770928f},
-std::array<float,2>{0.557043374f, 0.93181169f},
-std::array<float,2>{0.491988957f, 0.860781133f},
-std::array<float,2>{0.869451165f, 0.2720806f},
-std::array<float,2>{0.0788043886f, 0.166834936f},
-std::array<float,2>{0.578233361f, 0.747435033f},
-std::array<float,2>{0.146367699f, 0.576905131f},
-std::array<float,2>{0.700817049f, 0.00560882175f},
-std::array<float,2>{0.325513124f, 0.435781658f},
-std::array<float,2>{0.982931137f, 0.959753394f},
-std::array<float,2>{0.0349932238f, 0.905675232f},
-std::array<float,2>{0.527592182f, 0.496077269f},
-std::array<float,2>{0.428273618f, 0.0810425133f},
-std::array<float,2>{0.774481893f, 0.501282394f},
-std::array<float,2>{0.267846584f, 0.627002954f},
-std::array<float,2>{0.888597429f, 0.246056095f},
-std::array<float,2>{0.218473554f, 0.338778704f},
-std::array<float,2>{0.658935905f, 0.765309155f},
-std::array<float,2>{0.444757909f, 0.964337647f},
-std::array<float,2>{0.838977337f, 0.424075276f},
-std::array<float,2>{0.12154986f, 0.00789986085f},
-std::array<float,2>{0.613685071f, 0.563666463f},
-std::array<float,2>{0.184398815f, 0.741978347f},
-std::array<float,2>{0.74628222f, 0.15974462f},
-std::array<float,2>{0.354977161f, 0.276570499f},
-std::array<float,2>{0.946461201f, 0.871969521f},
-std::array<float,2>{0.00771223335f, 0.754993677f},
-std::array<float,2>{0.552489042f, 0.333620727f},
-std::array<float,2>{0.387119502f, 0.236629575f},
-std::array<float,2>{0.787366509f, 0.634251058f},
-std::array<float,2>{0.2918998f, 0.51099354f},
-std::array<float,2>{0.918526292f, 0.088936843f},
-std::array<float,2>{0.220334336f, 0.484397799f},
-std::array<float,2>{0.646470606f, 0.892778754f},
-std::array<float,2>{0.313770115f, 0.813984156f},
-std::array<float,2>{0.971819401f, 0.301553667f},
-std::array<float,2>{0.148965314f, 0.134363711f},
-std::array<float,2>{0.693800628f, 0.715641558f},
-std::array<float,2>{0.0908210129f, 0.598963439f},
-std::array<float,2>{0.587594867f, 0.0322292596f},
-std::array<float,2>{0.494220227f, 0.387108624f},
-std::array<float,2>{0.860233843f, 0.983751118f},
-std::array<float,2>{0.206476897f, 0.927621067f},
-std::array<float,2>{0.670808613f, 0.449490428f},
-std::array<float,2>{0.274424613f, 0.118315786f},
-std::array<float,2>{0.876804709f, 0.545592487f},
-std::array<float,2>{0.433932692f, 0.682923853f},
-std::array<float,2>{0.770564914f, 0.210056439f},
-std::array<float,2>{0.0398794562f, 0.356998205f},
-std::array<float,2>{0.518508077f, 0.799341798f},
-std::array<float,2>{0.255452365f, 0.879024565f},
-std::array<float,2>{0.891430199f, 0.479745835f},
-std::array<float,2>{0.197764993f, 0.0773064047f},
-std::array<float,2>{0.674272776f, 0.519946635f},
-std::array<float,2>{0.0615316853f, 0.655141771f},
-std::array<float,2>{0.513193667f, 0.224980965f},
-std::array<float,2>{0.41967833f, 0.317137957f},
-std::array<float,2>{0.761719644f, 0.779624522f},
-std::array<float,2>{0.127724767f, 0.854939044f},
-std::array<float,2>{0.715934575f, 0.251202554f},
-std::array<float,2>{0.342004269f, 0.173192814f},
-std::array<float,2>{0.990083694f, 0.730843902f},
-std::array<float,2>{0.475592792f, 0.591124475f},
-std::array<float,2>{0.846977413f, 0.0166947339f},
-std::array<float,2>{0.0708967149f, 0.406289935f},
-std::array<float,2>{0.566404462f, 0.946700811f},
-std::array<float,2>{0.404613495f, 0.792607129f},
-std::array<float,2>{0.802020013f, 0.374246359f},
-std::array<float,2>{0.0207571331f, 0.196400121f},
-std::array<float,2>{0.536698103f, 0.662551939f},
-std::array<float,2>{0.240251929f, 0.554650486f},
-std::array<float,2>{0.638243854f, 0.105947196f},
-std::array<float,2>{0.303181082f, 0.455371439f},
-std::array<float,2>{0.923744023f, 0.921651244f},
-std::array<float,2>{0.0937690586f, 0.993829846f},
-std::array<float,2>{0.599814117f, 0.399089128f},
-std::array<float,2>{0.461055517f, 0.0597237125f},
-std::array<float,2>{0.826182842f, 0.618227899f},
-std::array<float,2>{0.369899392f, 0.701743364f},
-std::array<float,2>{0.956280351f, 0.14935039f},
-std::array<float,2>{0.157623231f, 0.293055892f},
-std::array<float,2>{0.733038306f, 0.843345702f},
-std::array<float,2>{0.477831334f, 0.896483064f},
-std::array<float,2>{0.852953315f, 0.490084529f},
-std::array<float,2>{0.0676840022f, 0.0899213925f},
-std::array<float,2>{0.578035057f, 0.515417755f},
-std::array<float,2>{0.133046806f, 0.639927149f},
-std::array<float,2>{0.710375547f, 0.239547178f},
-std::array<float,2>{0.333052635f, 0.331909359f},
-std::array<float,2>{0.994006515f, 0.752512276f},
-std::array<float,2>{0.0472208373f, 0.870148659f},
-std::array<float,2>{0.507582843f, 0.278201133f},
-std::array<float,2>{0.410993636f, 0.163611025f},
-std::array<float,2>{0.750128388f, 0.737869143f},
-std::array<float,2>{0.264823735f, 0.568205476f},
-std::array<float,2>{0.901838124f, 0.012537783f},
-std::array<float,2>{0.188273296f, 0.427505791f},
-std::array<float,2>{0.680035353f, 0.968184769f},
-std::array<float,2>{0.366614938f, 0.803302824f},
-std::array<float,2>{0.961960077f, 0.352573007f},
-std::array<float,2>{0.171517149f, 0.204426929f},
-std::array<float,2>{0.723673642f, 0.686072648f},
-std::array<float,2>{0.105591528f, 0.540442348f},
-std::array<float,2>{0.609090686f, 0.123559698f},
-std::array<float,2>{0.454338402f, 0.448952645f},
-std::array<float,2>{0.813920617f, 0.924053311f},
-std::array<float,2>{0.248859838f, 0.980275214f},
-std::array<float,2>{0.627898872f, 0.38486582f},
-std::array<float,2>{0.31209901f, 0.0363063179f},
-std::array<float,2>{0.930549443f, 0.597130954f},
-std::array<float,2>{0.398192286f, 0.711701453f},
-std::array<float,2>{0.807575166f, 0.13713634f},
-std::array<float,2>{0.0271036047f, 0.297052771f},
-std::array<float,2>{0.545603812f, 0.819687605f},
-std::array<float,2>{0.288860649f, 0.952897131f},
-std::array<float,2>{0.909712195f, 0.413954973f},
-std::array<float,2>{0.228530318f, 0.0214722622f},
-std::array<float,2>{0.649960935f, 0.587887585f},
-std::array<float,2>{0.0146745564f, 0.727088869f},
-std::array<float,2>{0.561875999f, 0.17860429f},
-std::array<float,2>{0.381543487f, 0.257615834f},
-std::array<float,2>{0.789198697f, 0.856476784f},
-std::array<float,2>{0.178326145f, 0.776302636f},
-std::array<float,2>{0.736554563f, 0.313553184f},
-std::array<float,2>{0.349529147f, 0.220763683f},
-std::array<float,2>{0.938517928f, 0.648603618f},
-std::array<float,2>{0.449513793f, 0.516431093f},
-std::array<float,2>{0.829188645f, 0.0733009577f},
-std::array<float,2>{0.1100218f, 0.482862025f},
-std::array<float,2>{0.619304121f, 0.875269115f},
-std::array<float,2>{0.421986371f, 0.836989045f},
-std::array<float,2>{0.778731585f, 0.291288257f},
-std::array<float,2>{0.0355015211f, 0.152974024f},
-std::array<float,2>{0.525760472f, 0.697901905f},
-std::array<float,2>{0.211512491f, 0.624067843f},
-std::array<float,2>{0.663000822f, 0.0581412949f},
-std::array<float,2>{0.272227407f, 0.402474761f},
-std::array<float,2>{0.883889258f, 0.999878287f},
-std::array<float,2>{0.0848755017f, 0.916821957f},
-std::array<float,2>{0.58450377f, 0.457957268f},
-std::array<float,2>{0.48801136f, 0.10194774f},
-std::array<float,2>{0.874655962f, 0.548324287f},
-std::array<float,2>{0.322638005f, 0.656340122f},
-std::array<float,2>{0.980175316f, 0.201301143f},
-std::array<float,2>{0.143361881f, 0.368497521f},
-std::array<float,2>{0.697930872f, 0.795101166f},
-std::array<float,2>{0.383643568f, 0.991706133f},
-std::array<float,2>{0.782913923f, 0.39223215f},
-std::array<float,2>{0.00143358007f, 0.053062126f},
-std::array<float,2>{0.549413145f, 0.613135576f},
-std::array<float,2>{0.225967467f, 0.691282749f},
-std::array<float,2>{0.642338395f, 0.141652063f},
-std::array<float,2>{0.294774532f, 0.285138726f},
-std::array<float,2>{0.914142549f, 0.829987407f},
-std::array<float,2>{0.118259542f, 0.788625479f},
-std::array<float,2>{0.612559557f, 0.362690687f},
-std::array<float,2>{0.440571427f, 0.193343312f},
-std::array<float,2>{0.840562582f, 0.671286881f},
-std::array<float,2>{0.359337717f, 0.554761648f},
-std::array<float,2>{0.950317025f, 0.0990191326f},
-std::array<float,2>{0.18193084f, 0.464401752f},
-std::array<float,2>{0.743904829f, 0.911372185f},
-std::array<float,2>{0.280380279f, 0.849481404f},
-std::array<float,2>{0.881671548f, 0.25794214f},
-std::array<float,2>{0.207115144f, 0.182437092f},
-std::array<float,2>{0.665130377f, 0.722892702f},
-std::array<float,2>{0.0445872135f, 0.58067733f},
-std::array<float,2>{0.519704044f, 0.0270136371f},
-std::array<float,2>{0.429690897f, 0.416211337f},
-std::array<float,2>{0.769460082f, 0.941904545f},
-std::array<float,2>{0.154873863f, 0.882896304f},
-std::array<float,2>{0.687678456f, 0.473699033f},
-std::array<float,2>{0.319871128f, 0.0655892864f},
-std::array<float,2>{0.974050343f, 0.529881358f},
-std::array<float,2>{0.499724239f, 0.642234862f},
-std::array<float,2>{0.863916576f, 0.230851099f},
-std::array<float,2>{0.0890192538f, 0.32799843f},
-std::array<float,2>{0.590317667f, 0.766167283f},
-std::array<float,2>{0.337957978f, 0.937330782f},
-std::array<float,2>{0.987826765f, 0.440732598f},
-std::array<float,2>{0.132651046f, 0.111584239f},
-std::array<float,2>{0.711135387f, 0.531898201f},
-std::array<float,2>{0.0750772506f, 0.676953077f},
-std::array<float,2>{0.569885969f, 0.212201625f},
-std::array<float,2>{0.469835877f, 0.349671841f},
-std::array<float,2>{0.85002166f, 0.809917688f},
-std::array<float,2>{0.199831575f, 0.826333165f},
-std::array<float,2>{0.677372992f, 0.304915071f},
-std::array<float,2>{0.250548542f, 0.129609078f},
-std::array<float,2>{0.897365272f, 0.707513928f},
-std::array<float,2>{0.415683717f, 0.602503479f},
-std::array<float,2>{0.759309351f, 0.0460804813f},
-std::array<float,2>{0.0562514886f, 0.380975276f},
-std::array<float,2>{0.508817911f, 0.976335347f},
-std::array<float,2>{0.466733098f, 0.761199355f},
-std::array<float,2>{0.821421444f, 0.341458648f},
-std::array<float,2>{0.100785807f, 0.246952042f},
-std::array<float,2>{0.59445399f, 0.63107878f},
-std::array<float,2>{0.163141996f, 0.505827487f},
-std::array<float,2>{0.729125619f, 0.084964633f},
-std::array<float,2>{0.373824656f, 0.499862522f},
-std::array<float,2>{0.960650325f, 0.901223361f},
-std::array<float,2>{0.0185526069f, 0.955341876f},
-std::array<float,2>{0.531583011f, 0.433185875f},
-std::array<float,2>{0.400284111f, 0.00154934486f},
-std::array<float,2>{0.796954811f, 0.573355794f},
-std::array<float,2>{0.29818961f, 0.745437562f},
-std::array<float,2>{0.926431239f, 0.170985132f},
-std::array<float,2>{0.237053305f, 0.266408712f},
-std::array<float,2>{0.633167982f, 0.866532564f},
-std::array<float,2>{0.392304987f, 0.888491571f},
-std::array<float,2>{0.810861647f, 0.469137102f},
-std::array<float,2>{0.0282898787f, 0.0690718219f},
-std::array<float,2>{0.541948974f, 0.526465952f},
-std::array<float,2>{0.244119793f, 0.646332204f},
-std::array<float,2>{0.632705867f, 0.229740366f},
-std::array<float,2>{0.306028157f, 0.320589572f},
-std::array<float,2>{0.936870873f, 0.770195246f},
-std::array<float,2>{0.101721123f, 0.847584963f},
-std::array<float,2>{0.603047371f, 0.264553308f},
-std::array<float,2>{0.458319962f, 0.185994491f},
-std::array<float,2>{0.817207277f, 0.719858587f},
-std::array<float,2>{0.360236257f, 0.584652364f},
-std::array<float,2>{0.965565383f, 0.0307463873f},
-std::array<float,2>{0.165037632f, 0.418411821f},
-std::array<float,2>{0.721701503f, 0.940389037f},
-std::array<float,2>{0.260663718f, 0.783481896f},
-std::array<float,2>{0.903361082f, 0.363387972f},
-std::array<float,2>{0.192768663f, 0.190159842f},
-std::array<float,2>{0.686198413f, 0.666129231f},
-std::array<float,2>{0.0523255914f, 0.55960077f},
-std::array<float,2>{0.501313627f, 0.0937571153f},
-std::array<float,2>{0.410115927f, 0.464874238f},
-std::array<float,2>{0.754333138f, 0.907822311f},
-std::array<float,2>{0.138719216f, 0.984420955f},
-std::array<float,2>{0.704041719f, 0.395306528f},
-std::array<float,2>{0.330971748f, 0.0474313162f},
-std::array<float,2>{0.998715341f, 0.614421666f},
-std::array<float,2>{0.481012374f, 0.693327606f},
-std::array<float,2>{0.855616748f, 0.147045061f},
-std::array<float,2>{0.0634809881f, 0.285598993f},
-std::array<float,2>{0.570599735f, 0.835288763f},
-std::array<float,2>{0.328063041f, 0.957203031f},
-std::array<float,2>{0.981183171f, 0.434084505f},
-std::array<float,2>{0.146979779f, 0.0072321468f},
-std::array<float,2>{0.702070594f, 0.574853599f},
-std::array<float,2>{0.0811621398f, 0.748323858f},
-std::array<float,2>{0.580852687f, 0.164121762f},
-std::array<float,2>{0.488583237f, 0.27047649f},
-std::array<float,2>{0.86799252f, 0.861802042f},
-std::array<float,2>{0.216115758f, 0.76293987f},
-std::array<float,2>{0.657029092f, 0.337354302f},
-std::array<float,2>{0.265855521f, 0.243829012f},
-std::array<float,2>{0.89053905f, 0.625368059f},
-std::array<float,2>{0.427342504f, 0.502654374f},
-std::array<float,2>{0.777051568f, 0.0793394744f},
-std::array<float,2>{0.0329546779f, 0.49360913f},
-std::array<float,2>{0.53087163f, 0.904057026f},
-std::array<float,2>{0.447063863f, 0.821082413f},
-std::array<float,2>{0.834429204f, 0.311862618f},
-std::array<float,2>{0.11603082f, 0.125451177f},
-std::array<float,2>{0.621608198f, 0.704955876f},
-std::array<float,2>{0.173995405f, 0.609371066f},
-std::array<float,2>{0.738581717f, 0.0412726291f},
-std::array<float,2>{0.344182372f, 0.375415832f},
-std::array<float,2>{0.942091048f, 0.971474648f},
-std::array<float,2>{0.010701865f, 0.93153429f},
-std::array<float,2>{0.554743886f, 0.445209682f},
-std::array<float,2>{0.375535578f, 0.117164858f},
-std::array<float,2>{0.795734882f, 0.535969377f},
-std::array<float,2>{0.282693058f, 0.672416866f},
-std::array<float,2>{0.911954284f, 0.217970893f},
-std::array<float,2>{0.232258946f, 0.344325095f},
-std::array<float,2>{0.653430343f, 0.808094382f},
-std::array<float,2>{0.493995667f, 0.980839014f},
-std::array<float,2>{0.862898171f, 0.390256256f},
-std::array<float,2>{0.0928775743f, 0.0343508832f},
-std::array<float,2>{0.588466346f, 0.601324558f},
-std::array<float,2>{0.151784167f, 0.717652678f},
-std::array<float,2>{0.692567587f, 0.136449605f},
-std::array<float,2>{0.314733922f, 0.303174078f},
-std::array<float,2>{0.969980061f, 0.815810323f},
-std::array<float,2>{0.0424687788f, 0.797383308f},
-std::array<float,2>{0.515790164f, 0.358478069f},
-std::array<float,2>{0.436636508f, 0.207122728f},
-std::array<float,2>{0.773410916f, 0.680643976f},
-std::array<float,2>{0.277104229f, 0.544506192f},
-std::array<float,2>{0.877983868f, 0.120664321f},
-std::array<float,2>{0.203262955f, 0.452213258f},
-std::array<float,2>{0.669111609f, 0.928904414f},
-std::array<float,2>{0.353083998f, 0.874981046f},
-std::array<float,2>{0.947417438f, 0.273778409f},
-std::array<float,2>{0.186243922f, 0.156311989f},
-std::array<float,2>{0.749765754f, 0.738695741f},
-std::array<float,2>{0.123196535f, 0.565276086f},
-std::array<float,2>{0.616674542f, 0.0117160892f},
-std::array<float,2>{0.442719787f, 0.422088623f},
-std::array<float,2>{0.837290287f, 0.961316705f},
-std::array<float,2>{0.221487239f, 0.891814232f},
-std::array<float,2>{0.646767974f, 0.486933291f},
-std::array<float,2>{0.290092617f, 0.0868305862f},
-std::array<float,2>{0.921488583f, 0.509411693f},
-std::array<float,2>{0.389682204f, 0.636084557f},
-std::array<float,2>{0.786156952f, 0.235664025f},
-std::array<float,2>{0.00575927133f, 0.334413141f},
-std::array<float,2>{0.553722918f, 0.756981254f},
-std::array<float,2>{0.300928414f, 0.919021487f},
-std::array<float,2>{0.925444365f, 0.454465449f},
-std::array<float,2>{0.239819959f, 0.108688377f},
-std::array<float,2>{0.640367091f, 0.550949275f},
-std::array<float,2>{0.0231406465f, 0.66073513f},
-std::array<float,2>{0.538269877f, 0.199066818f},
-std::array<float,2>{0.403727233f, 0.371952027f},
-std::array<float,2>{0.803393781f, 0.789841235f},
-std::array<float,2>{0.158830076f, 0.841607869f},
-std::array<float,2>{0.7318483f, 0.296143502f},
-std::array<float,2>{0.367286384f, 0.151815608f},
-std::array<float,2>{0.953272343f, 0.700206935f},
-std::array<float,2>{0.464666873f, 0.620457768f},
-std::array<float,2>{0.825120866f, 0.0620141663f},
-std::array<float,2>{0.0971529484f, 0.40073061f},
-std::array<float,2>{0.599594712f, 0.995418668f},
-std::array<float,2>{0.420439363f, 0.77867049f},
-std::array<float,2>{0.76516211f, 0.318612993f},
-std::array<float,2>{0.0601638779f, 0.223742038f},
-std::array<float,2>{0.514416099f, 0.653716803f},
-std::array<float,2>{0.197086304f, 0.521555126f},
-std::array<float,2>{0.67257297f, 0.0743012056f},
-std::array<float,2>{0.25738889f, 0.478336096f},
-std::array<float,2>{0.89345628f, 0.881767213f},
-std::array<float,2>{0.0724147186f, 0.948839486f},
-std::array<float,2>{0.563970566f, 0.409568399f},
-std::array<float,2>{0.474141926f, 0.0193768069f},
-std::array<float,2>{0.844330728f, 0.59185487f},
-std::array<float,2>{0.341582686f, 0.733289123f},
-std::array<float,2>{0.990857899f, 0.1744712f},
-std::array<float,2>{0.125152081f, 0.252850056f},
-std::array<float,2>{0.718169689f, 0.85208559f},
-std::array<float,2>{0.456905276f, 0.922729015f},
-std::array<float,2>{0.816028714f, 0.446519971f},
-std::array<float,2>{0.108256839f, 0.122395128f},
-std::array<float,2>{0.607388079f, 0.541644096f},
-std::array<float,2>{0.169491246f, 0.684287965f},
-std::array<float,2>{0.725613296f, 0.206974193f},
-std::array<float,2>{0.363733202f, 0.355408669f},
-std::array<float,2>{0.963968933f, 0.801555812f},
-std::array<float,2>{0.0247365199f, 0.816561401f},
-std::array<float,2>{0.543437719f, 0.299951017f},
-std::array<float,2>{0.39464739f, 0.140232489f},
-std::array<float,2>{0.80477035f, 0.713061213f},
-std::array<float,2>{0.310512036f, 0.595147073f},
-std::array<float,2>{0.93181777f, 0.0382743441f},
-std::array<float,2>{0.247002959f, 0.384686768f},
-std::array<float,2>{0.625041842f, 0.977812946f},
-std::array<float,2>{0.335425705f, 0.751845002f},
-std::array<float,2>{0.995087743f, 0.329140842f},
-std::array<float,2>{0.135338992f, 0.241647661f},
-std::array<float,2>{0.707719982f, 0.637455761f},
-std::array<float,2>{0.0686411411f, 0.51331073f},
-std::array<float,2>{0.574931443f, 0.0918787643f},
-std::array<float,2>{0.480211079f, 0.49092862f},
-std::array<float,2>{0.853535056f, 0.897293627f},
-std::array<float,2>{0.190389007f, 0.966140151f},
-std::array<float,2>{0.682268381f, 0.427759975f},
-std::array<float,2>{0.263277709f, 0.0149139911f},
-std::array<float,2>{0.899107277f, 0.568803132f},
-std::array<float,2>{0.412928522f, 0.735069573f},
-std::array<float,2>{0.753520489f, 0.160937756f},
-std::array<float,2>{0.0490175784f, 0.280115515f},
-std::array<float,2>{0.505238414f, 0.86843574f},
-std::array<float,2>{0.270891279f, 0.997897446f},
-std::array<float,2>{0.885946393f, 0.404930711f},
-std::array<float,2>{0.214444265f, 0.0551444143f},
-std::array<float,2>{0.661092222f, 0.621929049f},
-std::array<float,2>{0.0380626172f, 0.697060585f},
-std::array<float,2>{0.523998439f, 0.156036437f},
-std::array<float,2>{0.425373971f, 0.290360183f},
-std::array<float,2>{0.779717565f, 0.838592529f},
-std::array<float,2>{0.142429814f, 0.794005394f},
-std::array<float,2>{0.697257817f, 0.370877892f},
-std::array<float,2>{0.321429729f, 0.199485466f},
-std::array<float,2>{0.978392065f, 0.658215046f},
-std::array<float,2>{0.485800296f, 0.550007224f},
-std::array<float,2>{0.872948945f, 0.104940213f},
-std::array<float,2>{0.0825829431f, 0.460769832f},
-std::array<float,2>{0.583485007f, 0.91455996f},
-std::array<float,2>{0.379964113f, 0.859112918f},
-std::array<float,2>{0.792839348f, 0.255206496f},
-std::array<float,2>{0.0124661969f, 0.175790921f},
-std::array<float,2>{0.560102642f, 0.730429411f},
-std::array<float,2>{0.22794278f, 0.588773668f},
-std::array<float,2>{0.651729345f, 0.0230646376f},
-std::array<float,2>{0.2861f, 0.411216408f},
-std::array<float,2>{0.907028198f, 0.950813532f},
-std::array<float,2>{0.112152621f, 0.878102839f},
-std::array<float,2>{0.617476583f, 0.481029004f},
-std::array<float,2>{0.452195376f, 0.0703959391f},
-std::array<float,2>{0.830756545f, 0.519099832f},
-std::array<float,2>{0.350703567f, 0.651625812f},
-std::array<float,2>{0.940227926f, 0.219896078f},
-std::array<float,2>{0.176456466f, 0.314640075f},
-std::array<float,2>{0.736278772f, 0.77426517f},
-std::array<float,2>{0.431891859f, 0.944735348f},
-std::array<float,2>{0.766606629f, 0.414342701f},
-std::array<float,2>{0.0463401079f, 0.0242748559f},
-std::array<float,2>{0.522723615f, 0.579288483f},
-std::array<float,2>{0.209557205f, 0.72575742f},
-std::array<float,2>{0.667643845f, 0.181252182f},
-std::array<float,2>{0.277783513f, 0.26016289f},
-std::array<float,2>{0.880838454f, 0.851296544f},
-std::array<float,2>{0.0861501843f, 0.769059896f},
-std::array<float,2>{0.591881275f, 0.324403048f},
-std::array<float,2>{0.497429878f, 0.233564422f},
-std::array<float,2>{0.86630547f, 0.643448651f},
-std::array<float,2>{0.316830665f, 0.528809428f},
-std::array<float,2>{0.975199282f, 0.0640254095f},
-std::array<float,2>{0.152837351f, 0.476490319f},
-std::array<float,2>{0.689854324f, 0.886345685f},
-std::array<float,2>{0.29570508f, 0.830670238f},
-std::array<float,2>{0.916803062f, 0.282020777f},
-std::array<float,2>{0.223536298f, 0.142978013f},
-std::array<float,2>{0.643952191f, 0.688186884f},
-std::array<float,2>{0.00212129648f, 0.609410584f},
-std::array<float,2>{0.548004389f, 0.0519714914f},
-std::array<float,2>{0.385350972f, 0.394482225f},
-std::array<float,2>{0.784412861f, 0.989642084f},
-std::array<float,2>{0.181389257f, 0.913258672f},
-std::array<float,2>{0.744626403f, 0.462317497f},
-std::array<float,2>{0.356876642f, 0.0999751389f},
-std::array<float,2>{0.951841414f, 0.558575988f},
-std::array<float,2>{0.437854022f, 0.669386387f},
-std::array<float,2>{0.843491316f, 0.193783715f},
-std::array<float,2>{0.119748779f, 0.36122182f},
-std::array<float,2>{0.610659957f, 0.785610676f},
-std::array<float,2>{0.372626424f, 0.899789691f},
-std::array<float,2>{0.957167506f, 0.496376365f},
-std::array<float,2>{0.161961064f, 0.0839826092f},
-std::array<float,2>{0.72805202f, 0.507797837f},
-std::array<float,2>{0.0992641076f, 0.629844546f},
-std::array<float,2>{0.596066892f, 0.248262674f},
-std::array<float,2>{0.468000293f, 0.342664391f},
-std::array<float,2>{0.822956979f, 0.758014083f},
-std::array<float,2>{0.235069722f, 0.864272654f},
-std::array<float,2>{0.635666013f, 0.268755317f},
-std::array<float,2>{0.300187767f, 0.16957286f},
-std::array<float,2>{0.928704619f, 0.742881358f},
-std::array<float,2>{0.402097404f, 0.57200712f},
-std::array<float,2>{0.799993277f, 0.00213040807f},
-std::array<float,2>{0.0160910208f, 0.431424797f},
-std::array<float,2>{0.533756614f, 0.953346252f},
-std::array<float,2>{0.471708268f, 0.812464952f},
-std::array<float,2>{0.848804712f, 0.349124461f},
-std::array<float,2>{0.077755712f, 0.214559615f},
-std::array<float,2>{0.567727625f, 0.679353535f},
-std::array<float,2>{0.130400375f, 0.53381139f},
-std::array<float,2>{0.713024199f, 0.111256026f},
-std::array<float,2>{0.337062925f, 0.438948631f},
-std::array<float,2>{0.984581649f, 0.935292661f},
-std::array<float,2>{0.0581138693f, 0.973493159f},
-std::array<float,2>{0.509793878f, 0.38069576f},
-std::array<float,2>{0.417059213f, 0.04416712f},
-std::array<float,2>{0.759794652f, 0.604456663f},
-std::array<float,2>{0.253534675f, 0.710566044f},
-std::array<float,2>{0.895439506f, 0.131197795f},
-std::array<float,2>{0.202951625f, 0.308420986f},
-std::array<float,2>{0.678239465f, 0.825314522f},
-std::array<float,2>{0.38622582f, 0.911545277f},
-std::array<float,2>{0.784170508f, 0.464786798f},
-std::array<float,2>{0.00330939773f, 0.098717846f},
-std::array<float,2>{0.547101915f, 0.555088162f},
-std::array<float,2>{0.22433348f, 0.671002567f},
-std::array<float,2>{0.642941356f, 0.193000421f},
-std::array<float,2>{0.296589255f, 0.362312615f},
-std::array<float,2>{0.917720079f, 0.788985372f},
-std::array<float,2>{0.120234221f, 0.829594433f},
-std::array<float,2>{0.609442115f, 0.284802258f},
-std::array<float,2>{0.439284325f, 0.141910419f},
-std::array<float,2>{0.842618883f, 0.691007555f},
-std::array<float,2>{0.355802953f, 0.612980843f},
-std::array<float,2>{0.952759624f, 0.0527890362f},
-std::array<float,2>{0.179707244f, 0.392408699f},
-std::array<float,2>{0.745142341f, 0.992081344f},
-std::array<float,2>{0.278999239f, 0.766394198f},
-std::array<float,2>{0.879567564f, 0.327651024f},
-std::array<float,2>{0.210629404f, 0.230635926f},
-std::array<float,2>{0.666891873f, 0.642412663f},
-std::array<float,2>{0.0450370498f, 0.530087352f},
-std::array<float,2>{0.522150517f, 0.0656955689f},
-std::array<float,2>{0.433254242f, 0.4741036f},
-std::array<float,2>{0.765928388f, 0.883196056f},
-std::array<float,2>{0.153674111f, 0.942284763f},
-std::array<float,2>{0.690952003f, 0.416284651f},
-std::array<float,2>{0.317399472f, 0.0271135401f},
-std::array<float,2>{0.97641027f, 0.580865562f},
-std::array<float,2>{0.496340692f, 0.723112583f},
-std::array<float,2>{0.865575969f, 0.182322308f},
-std::array<float,2>{0.0873974785f, 0.258197516f},
-std::array<float,2>{0.592826545f, 0.849206924f},
-std::array<float,2>{0.336387217f, 0.976163983f},
-std::array<float,2>{0.98590529f, 0.381335586f},
-std::array<float,2>{0.129786462f, 0.0463204533f},
-std::array<float,2>{0.714557588f, 0.602083743f},
-std::array<float,2>{0.0765717402f, 0.707060933f},
-std::array<float,2>{0.566612124f, 0.129745036f},
-std::array<float,2>{0.470750183f, 0.305055559f},
-std::array<float,2>{0.848545074f, 0.826590538f},
-std::array<float,2>{0.20141688f, 0.809674621f},
-std::array<float,2>{0.678800642f, 0.34992215f},
-std::array<float,2>{0.251969159f, 0.211986765f},
-std::array<float,2>{0.896020591f, 0.677151203f},
-std::array<float,2>{0.416387081f, 0.532053947f},
-std::array<float,2>{0.761152506f, 0.111377336f},
-std::array<float,2>{0.0574018881f, 0.440572053f},
-std::array<float,2>{0.511080325f, 0.937226236f},
-std::array<float,2>{0.467292637f, 0.866441131f},
-std::array<float,2>{0.823858678f, 0.266176343f},
-std::array<float,2>{0.0982131362f, 0.171255678f},
-std::array<float,2>{0.596993744f, 0.745188951f},
-std::array<float,2>{0.160548851f, 0.573689997f},
-std::array<float,2>{0.726937652f, 0.00182690867f},
-std::array<float,2>{0.37155202f, 0.433415443f},
-std::array<float,2>{0.958153844f, 0.955248594f},
-std::array<float,2>{0.0170747917f, 0.901069999f},
-std::array<float,2>{0.535043001f, 0.499633819f},
-std::array<float,2>{0.401201129f, 0.0853230581f},
-std::array<float,2>{0.799316823f, 0.505547583f},
-std::array<float,2>{0.299231678f, 0.631312907f},
-std::array<float,2>{0.929587543f, 0.24663718f},
-std::array<float,2>{0.235805422f, 0.341726333f},
-std::array<float,2>{0.636303365f, 0.760823727f},
-std::array<float,2>{0.478800893f, 0.967993677f},
-std::array<float,2>{0.855036676f, 0.427281827f},
-std::array<float,2>{0.0700266138f, 0.0123385349f},
-std::array<float,2>{0.575805128f, 0.567997515f},
-std::array<float,2>{0.136503428f, 0.738197982f},
-std::array<float,2>{0.708271086f, 0.163881809f},
-std::array<float,2>{0.334774345f, 0.277894229f},
-std::array<float,2>{0.995194614f, 0.870433629f},
-std::array<float,2>{0.05038343f, 0.752786756f},
-std::array<float,2>{0.504439294f, 0.331667811f},
-std::array<float,2>{0.41363436f, 0.239416286f},
-std::array<float,2>{0.752407968f, 0.639865816f},
-std::array<float,2>{0.262082815f, 0.515238583f},
-std::array<float,2>{0.899705052f, 0.0902856737f},
-std::array<float,2>{0.190885603f, 0.48974818f},
-std::array<float,2>{0.682727337f, 0.896238446f},
-std::array<float,2>{0.364425391f, 0.819440544f},
-std::array<float,2>{0.963703036f, 0.297233075f},
-std::array<float,2>{0.168390274f, 0.136781469f},
-std::array<float,2>{0.72464478f, 0.711442947f},
-std::array<float,2>{0.109265693f, 0.596758366f},
-std::array<float,2>{0.605516136f, 0.0365111642f},
-std::array<float,2>{0.455092251f, 0.385218918f},
-std::array<float,2>{0.814987421f, 0.980203092f},
-std::array<float,2>{0.247461513f, 0.924307525f},
-std::array<float,2>{0.626450956f, 0.449135959f},
-std::array<float,2>{0.30888319f, 0.123833552f},
-std::array<float,2>{0.93276608f, 0.540125966f},
-std::array<float,2>{0.396426171f, 0.686411858f},
-std::array<float,2>{0.806234241f, 0.20427838f},
-std::array<float,2>{0.0240748376f, 0.352927655f},
-std::array<float,2>{0.544913411f, 0.803690195f},
-std::array<float,2>{0.286427706f, 0.875106752f},
-std::array<float,2>{0.907898843f, 0.482509494f},
-std::array<float,2>{0.227195323f, 0.0735722557f},
-std::array<float,2>{0.650825739f, 0.516286731f},
-std::array<float,2>{0.0128501086f, 0.648836732f},
-std::array<float,2>{0.559441388f, 0.221068487f},
-std::array<float,2>{0.379278541f, 0.313904077f},
-std::array<float,2>{0.791765153f, 0.776104391f},
-std::array<float,2>{0.177214339f, 0.856702924f},
-std::array<float,2>{0.734450758f, 0.257530361f},
-std::array<float,2>{0.349669456f, 0.178367972f},
-std::array<float,2>{0.940477908f, 0.727495253f},
-std::array<float,2>{0.452129811f, 0.587456286f},
-std::array<float,2>{0.831367731f, 0.0211462341f},
-std::array<float,2>{0.112835616f, 0.413778096f},
-std::array<float,2>{0.618284166f, 0.952761769f},
-std::array<float,2>{0.424495578f, 0.795310557f},
-std::array<float,2>{0.780779123f, 0.368287235f},
-std::array<float,2>{0.0384333245f, 0.201468304f},
-std::array<float,2>{0.524945319f, 0.656612277f},
-std::array<float,2>{0.213277221f, 0.548051119f},
-std::array<float,2>{0.661679924f, 0.101586066f},
-std::array<float,2>{0.270150542f, 0.457666665f},
-std::array<float,2>{0.885518253f, 0.916528344f},
-std::array<float,2>{0.0832008198f, 0.999655843f},
-std::array<float,2>{0.582283676f, 0.402588576f},
-std::array<float,2>{0.485031962f, 0.0585919991f},
-std::array<float,2>{0.871294856f, 0.624283552f},
-std::array<float,2>{0.32040289f, 0.69817394f},
-std::array<float,2>{0.97716254f, 0.153275371f},
-std::array<float,2>{0.140625209f, 0.29125461f},
-std::array<float,2>{0.695919096f, 0.837332189f},
-std::array<float,2>{0.441546828f, 0.892932713f},
-std::array<float,2>{0.835991561f, 0.484648675f},
-std::array<float,2>{0.124541022f, 0.0892678425f},
-std::array<float,2>{0.616032362f, 0.51076901f},
-std::array<float,2>{0.187303096f, 0.633933842f},
-std::array<float,2>{0.748222113f, 0.236438423f},
-std::array<float,2>{0.351794004f, 0.333794385f},
-std::array<float,2>{0.948705196f, 0.755265117f},
-std::array<float,2>{0.00429361733f, 0.871690929f},
-std::array<float,2>{0.553459406f, 0.27681461f},
-std::array<float,2>{0.388864368f, 0.159935817f},
-std::array<float,2>{0.785273612f, 0.741736114f},
-std::array<float,2>{0.289248526f, 0.563769579f},
-std::array<float,2>{0.920354009f, 0.00826025847f},
-std::array<float,2>{0.222391382f, 0.423957556f},
-std::array<float,2>{0.648235738f, 0.963992417f},
-std::array<float,2>{0.316295326f, 0.799746156f},
-std::array<float,2>{0.969373465f, 0.35724923f},
-std::array<float,2>{0.150821924f, 0.21040222f},
-std::array<float,2>{0.691849887f, 0.682823956f},
-std::array<float,2>{0.0924362391f, 0.545656443f},
-std::array<float,2>{0.589842141f, 0.118604705f},
-std::array<float,2>{0.492235005f, 0.449455142f},
-std::array<float,2>{0.862069666f, 0.927458048f},
-std::array<float,2>{0.204994723f, 0.983431995f},
-std::array<float,2>{0.66842711f, 0.386839867f},
-std::array<float,2>{0.27599436f, 0.0326828733f},
-std::array<float,2>{0.877114654f, 0.598646522f},
-std::array<float,2>{0.435617328f, 0.715445101f},
-std::array<float,2>{0.77204597f, 0.134715348f},
-std::array<float,2>{0.0414394103f, 0.301302433f},
-std::array<float,2>{0.516996026f, 0.814382195f},
-std::array<float,2>{0.256069541f, 0.946436763f},
-std::array<float,2>{0.89396584f, 0.406561464f},
-std::array<float,2>{0.195485562f, 0.0169323795f},
-std::array<float,2>{0.673297346f, 0.590985239f},
-std::array<float,2>{0.0588173755f, 0.730639398f},
-std::array<float,2>{0.514910519f, 0.173075661f},
-std::array<float,2>{0.421350539f, 0.251340657f},
-std::array<float,2>{0.764285624f, 0.854492426f},
-std::array<float,2>{0.125992864f, 0.779328763f},
-std::array<float,2>{0.717288136f, 0.317276806f},
-std::array<float,2>{0.340764403f, 0.224852994f},
-std::array<float,2>{0.991855502f, 0.65493077f},
-std::array<float,2>{0.47336182f, 0.519741237f},
-std::array<float,2>{0.845231175f, 0.077467896f},
-std::array<float,2>{0.0736866593f, 0.479627311f},
-std::array<float,2>{0.562664449f, 0.879378319f},
-std::array<float,2>{0.402391911f, 0.843665063f},
-std::array<float,2>{0.804478526f, 0.293345153f},
-std::array<float,2>{0.0220034048f, 0.1490172f},
-std::array<float,2>{0.537495673f, 0.70206368f},
-std::array<float,2>{0.238339186f, 0.618516088f},
-std::array<float,2>{0.639344931f, 0.0600392632f},
-std::array<float,2>{0.301903933f, 0.399362445f},
-std::array<float,2>{0.923977733f, 0.99411422f},
-std::array<float,2>{0.0959267169f, 0.921478629f},
-std::array<float,2>{0.598200917f, 0.455113471f},
-std::array<float,2>{0.463194251f, 0.105517164f},
-std::array<float,2>{0.825396478f, 0.554433405f},
-std::array<float,2>{0.369083226f, 0.662261248f},
-std::array<float,2>{0.9545995f, 0.19674775f},
-std::array<float,2>{0.15923506f, 0.374324322f},
-std::array<float,2>{0.730777979f, 0.792734444f},
-std::array<float,2>{0.408688635f, 0.988020778f},
-std::array<float,2>{0.755201995f, 0.397791505f},
-std::array<float,2>{0.0513860881f, 0.0491346195f},
-std::array<float,2>{0.500246704f, 0.61615026f},
-std::array<float,2>{0.191447869f, 0.694050133f},
-std::array<float,2>{0.686801314f, 0.144578576f},
-std::array<float,2>{0.260908991f, 0.287673712f},
-std::array<float,2>{0.90249902f, 0.833671868f},
-std::array<float,2>{0.0630873963f, 0.783144355f},
-std::array<float,2>{0.571964204f, 0.365399778f},
-std::array<float,2>{0.481702775f, 0.188583538f},
-std::array<float,2>{0.856939971f, 0.664133549f},
-std::array<float,2>{0.331845403f, 0.561599553f},
-std::array<float,2>{0.999785006f, 0.0957053676f},
-std::array<float,2>{0.139952049f, 0.467709213f},
-std::array<float,2>{0.705042481f, 0.909356713f},
-std::array<float,2>{0.305261195f, 0.844658613f},
-std::array<float,2>{0.9359954f, 0.262215346f},
-std::array<float,2>{0.242233947f, 0.183746606f},
-std::array<float,2>{0.631402075f, 0.722568512f},
-std::array<float,2>{0.0284587909f, 0.58323586f},
-std::array<float,2>{0.542452633f, 0.0286581088f},
-std::array<float,2>{0.391390085f, 0.421542287f},
-std::array<float,2>{0.811937273f, 0.937645257f},
-std::array<float,2>{0.165171996f, 0.890539587f},
-std::array<float,2>{0.721175194f, 0.472165734f},
-std::array<float,2>{0.361131817f, 0.0682079121f},
-std::array<float,2>{0.966037571f, 0.525123835f},
-std::array<float,2>{0.457795829f, 0.647978425f},
-std::array<float,2>{0.817406714f, 0.226935506f},
-std::array<float,2>{0.102782421f, 0.32298857f},
-std::array<float,2>{0.601995766f, 0.7731691f},
-std::array<float,2>{0.344943017f, 0.931890666f},
-std::array<float,2>{0.942681193f, 0.442518145f},
-std::array<float,2>{0.174902707f, 0.114929013f},
-std::array<float,2>{0.739830673f, 0.538567543f},
-std::array<float,2>{0.116821416f, 0.675340712f},
-std::array<float,2>{0.622916818f, 0.216234714f},
-std::array<float,2>{0.44609201f, 0.346858025f},
-std::array<float,2>{0.835538745f, 0.804745793f},
-std::array<float,2>{0.231315747f, 0.822458148f},
-std::array<float,2>{0.652468443f, 0.309442639f},
-std::array<float,2>{0.281367272f, 0.127973378f},
-std::array<float,2>{0.910312533f, 0.706656933f},
-std::array<float,2>{0.37611711f, 0.606589317f},
-std::array<float,2>{0.796550095f, 0.0396432802f},
-std::array<float,2>{0.0113927564f, 0.377578616f},
-std::array<float,2>{0.556170285f, 0.97032541f},
-std::array<float,2>{0.490059763f, 0.765555203f},
-std::array<float,2>{0.868758261f, 0.338410139f},
-std::array<float,2>{0.0801509693f, 0.245654076f},
-std::array<float,2>{0.581123352f, 0.627345681f},
-std::array<float,2>{0.147863224f, 0.501152515f},
-std::array<float,2>{0.702874064f, 0.0806547999f},
-std::array<float,2>{0.326995283f, 0.495642096f},
-std::array<float,2>{0.981883168f, 0.905424774f},
-std::array<float,2>{0.0321826003f, 0.959481061f},
-std::array<float,2>{0.529886186f, 0.435929328f},
-std::array<float,2>{0.42624706f, 0.00562248752f},
-std::array<float,2>{0.775551856f, 0.576750457f},
-std::array<float,2>{0.267070144f, 0.747200191f},
-std::array<float,2>{0.889549494f, 0.166556716f},
-std::array<float,2>{0.215290725f, 0.272384495f},
-std::array<float,2>{0.658197165f, 0.860522032f},
-std::array<float,2>{0.430844754f, 0.886564016f},
-std::array<float,2>{0.76839906f, 0.476205617f},
-std::array<float,2>{0.0436577387f, 0.0644346252f},
-std::array<float,2>{0.521006763f, 0.529077768f},
-std::array<float,2>{0.208708599f, 0.643229008f},
-std::array<float,2>{0.664818048f, 0.233782932f},
-std::array<float,2>{0.280138284f, 0.324500948f},
-std::array<float,2>{0.882592201f, 0.769357085f},
-std::array<float,2>{0.0881146118f, 0.851443887f},
-std::array<float,2>{0.591332316f, 0.259969413f},
-std::array<float,2>{0.498452783f, 0.181583107f},
-std::array<float,2>{0.864927769f, 0.726001918f},
-std::array<float,2>{0.319089919f, 0.57942158f},
-std::array<float,2>{0.973227501f, 0.024137089f},
-std::array<float,2>{0.155355498f, 0.414263338f},
-std::array<float,2>{0.688837111f, 0.944475651f},
-std::array<float,2>{0.293587536f, 0.785319746f},
-std::array<float,2>{0.915490508f, 0.360971272f},
-std::array<float,2>{0.225085661f, 0.193395972f},
-std::array<float,2>{0.640820801f, 0.669042647f},
-std::array<float,2>{7.33691268e-05f, 0.558142543f},
-std::array<float,2>{0.550465286f, 0.0996828154f},
-std::array<float,2>{0.384434313f, 0.462111801f},
-std::array<float,2>{0.781261563f, 0.913515329f},
-std::array<float,2>{0.18345499f, 0.98949182f},
-std::array<float,2>{0.742231071f, 0.394249856f},
-std::array<float,2>{0.358194947f, 0.0521731339f},
-std::array<float,2>{0.949991047f, 0.609657049f},
-std::array<float,2>{0.440399975f, 0.688408196f},
-std::array<float,2>{0.84135884f, 0.142643049f},
-std::array<float,2>{0.11731185f, 0.281921744f},
-std::array<float,2>{0.611710548f, 0.830927432f},
-std::array<float,2>{0.374781221f, 0.953457773f},
-std::array<float,2>{0.959391177f, 0.43123731f},
-std::array<float,2>{0.162473157f, 0.002222643f},
-std::array<float,2>{0.729860306f, 0.572035968f},
-std::array<float,2>{0.100014277f, 0.743161201f},
-std::array<float,2>{0.594835877f, 0.169861659f},
-std::array<float,2>{0.464844167f, 0.268832833f},
-std::array<float,2>{0.820854425f, 0.864723861f},
-std::array<float,2>{0.238062203f, 0.7581231f},
-std::array<float,2>{0.634208202f, 0.342398882f},
-std::array<float,2>{0.296959013f, 0.248338878f},
-std::array<float,2>{0.927582979f, 0.629627287f},
-std::array<float,2>{0.398810238f, 0.507358611f},
-std::array<float,2>{0.798037887f, 0.0835924223f},
-std::array<float,2>{0.0191112142f, 0.496115714f},
-std::array<float,2>{0.532927394f, 0.899539769f},
-std::array<float,2>{0.469636977f, 0.825658262f},
-std::array<float,2>{0.850800633f, 0.308186859f},
-std::array<float,2>{0.076113306f, 0.130905852f},
-std::array<float,2>{0.569174767f, 0.710905433f},
-std::array<float,2>{0.13142924f, 0.604040921f},
-std::array<float,2>{0.71254158f, 0.044381652f},
-std::array<float,2>{0.338874221f, 0.38041091f},
-std::array<float,2>{0.987121403f, 0.973255217f},
-std::array<float,2>{0.0556523874f, 0.935439646f},
-std::array<float,2>{0.508748829f, 0.438596368f},
-std::array<float,2>{0.414482415f, 0.110950038f},
-std::array<float,2>{0.758605599f, 0.534029603f},
-std::array<float,2>{0.251354665f, 0.679569125f},
-std::array<float,2>{0.897553384f, 0.21465759f},
-std::array<float,2>{0.200888738f, 0.349387616f},
-std::array<float,2>{0.676335573f, 0.812021911f},
-std::array<float,2>{0.453971177f, 0.977596283f},
-std::array<float,2>{0.813216984f, 0.384341717f},
-std::array<float,2>{0.106962845f, 0.0384625569f},
-std::array<float,2>{0.607578456f, 0.594742656f},
-std::array<float,2>{0.170803934f, 0.713145196f},
-std::array<float,2>{0.722773373f, 0.140500739f},
-std::array<float,2>{0.365624219f, 0.300224423f},
-std::array<float,2>{0.961704075f, 0.816738307f},
-std::array<float,2>{0.0257770978f, 0.801283836f},
-std::array<float,2>{0.546484828f, 0.355037242f},
-std::array<float,2>{0.397151798f, 0.206759602f},
-std::array<float,2>{0.808352649f, 0.684338212f},
-std::array<float,2>{0.311231881f, 0.541785002f},
-std::array<float,2>{0.931361556f, 0.12220867f},
-std::array<float,2>{0.2491007f, 0.446568936f},
-std::array<float,2>{0.628443778f, 0.922480226f},
-std::array<float,2>{0.332816809f, 0.868295014f},
-std::array<float,2>{0.992562532f, 0.279814065f},
-std::array<float,2>{0.134681329f, 0.160858542f},
-std::array<float,2>{0.709014654f, 0.735208869f},
-std::array<float,2>{0.0672224686f, 0.568599522f},
-std::array<float,2>{0.576811492f, 0.0148812542f},
-std::array<float,2>{0.477071077f, 0.428186834f},
-std::array<float,2>{0.851949632f, 0.965973914f},
-std::array<float,2>{0.188903332f, 0.897098601f},
-std::array<float,2>{0.680980563f, 0.491158694f},
-std::array<float,2>{0.264607191f, 0.0922705904f},
-std::array<float,2>{0.900665343f, 0.513509452f},
-std::array<float,2>{0.411868632f, 0.637257695f},
-std::array<float,2>{0.751836717f, 0.241245806f},
-std::array<float,2>{0.0479534268f, 0.329365075f},
-std::array<float,2>{0.506146193f, 0.751481235f},
-std::array<float,2>{0.272972852f, 0.914989829f},
-std::array<float,2>{0.883586049f, 0.460468352f},
-std::array<float,2>{0.212791085f, 0.104637504f},
-std::array<float,2>{0.663142741f, 0.55026722f},
-std::array<float,2>{0.0366113745f, 0.658451915f},
-std::array<float,2>{0.526555955f, 0.199375674f},
-std::array<float,2>{0.422954708f, 0.370655656f},
-std::array<float,2>{0.778209865f, 0.794193983f},
-std::array<float,2>{0.144445673f, 0.838707685f},
-std::array<float,2>{0.699094951f, 0.29019165f},
-std::array<float,2>{0.324147552f, 0.155963808f},
-std::array<float,2>{0.978708327f, 0.69697541f},
-std::array<float,2>{0.486383528f, 0.621780396f},
-std::array<float,2>{0.873190224f, 0.0547380522f},
-std::array<float,2>{0.0853169188f, 0.405097455f},
-std::array<float,2>{0.585541487f, 0.997757554f},
-std::array<float,2>{0.382760555f, 0.773983181f},
-std::array<float,2>{0.790623367f, 0.314737856f},
-std::array<float,2>{0.0143063599f, 0.220117867f},
-std::array<float,2>{0.560796022f, 0.651542902f},
-std::array<float,2>{0.230248094f, 0.519437551f},
-std::array<float,2>{0.649104238f, 0.0706920996f},
-std::array<float,2>{0.287355006f, 0.481357396f},
-std::array<float,2>{0.909122586f, 0.878282666f},
-std::array<float,2>{0.111051254f, 0.950965703f},
-std::array<float,2>{0.620849431f, 0.411409229f},
-std::array<float,2>{0.450808853f, 0.0232873894f},
-std::array<float,2>{0.828257442f, 0.588413179f},
-std::array<float,2>{0.348548651f, 0.730087101f},
-std::array<float,2>{0.937528908f, 0.176145747f},
-std::array<float,2>{0.179013819f, 0.255000681f},
-std::array<float,2>{0.737318993f, 0.859164298f},
-std::array<float,2>{0.495894164f, 0.929061413f},
-std::array<float,2>{0.860554755f, 0.452521503f},
-std::array<float,2>{0.0905977488f, 0.121026888f},
-std::array<float,2>{0.586183608f, 0.54474777f},
-std::array<float,2>{0.150225684f, 0.680243909f},
-std::array<float,2>{0.69448024f, 0.207334161f},
-std::array<float,2>{0.313378394f, 0.358747542f},
-std::array<float,2>{0.971218944f, 0.797617376f},
-std::array<float,2>{0.0407574251f, 0.815596342f},
-std::array<float,2>{0.519091785f, 0.30293721f},
-std::array<float,2>{0.435444295f, 0.136514455f},
-std::array<float,2>{0.769557893f, 0.717416823f},
-std::array<float,2>{0.274279892f, 0.601189256f},
-std::array<float,2>{0.875550985f, 0.0346390232f},
-std::array<float,2>{0.205768496f, 0.390539438f},
-std::array<float,2>{0.671557367f, 0.980577469f},
-std::array<float,2>{0.353563994f, 0.757183552f},
-std::array<float,2>{0.945356071f, 0.33417806f},
-std::array<float,2>{0.18531546f, 0.235558912f},
-std::array<float,2>{0.747435391f, 0.635946095f},
-std::array<float,2>{0.122497015f, 0.509657621f},
-std::array<float,2>{0.614649355f, 0.0866257995f},
-std::array<float,2>{0.444088638f, 0.487239927f},
-std::array<float,2>{0.838480175f, 0.891884267f},
-std::array<float,2>{0.219697908f, 0.961069047f},
-std::array<float,2>{0.645083189f, 0.422224611f},
-std::array<float,2>{0.292910516f, 0.0113969287f},
-std::array<float,2>{0.919138908f, 0.565132976f},
-std::array<float,2>{0.388218045f, 0.73830235f},
-std::array<float,2>{0.788424551f, 0.156677127f},
-std::array<float,2>{0.00633027172f, 0.273671955f},
-std::array<float,2>{0.551240265f, 0.874614418f},
-std::array<float,2>{0.303816676f, 0.995120287f},
-std::array<float,2>{0.922744334f, 0.400589198f},
-std::array<float,2>{0.241588101f, 0.0624925308f},
-std::array<float,2>{0.637523055f, 0.620225966f},
-std::array<float,2>{0.0203737337f, 0.700493097f},
-std::array<float,2>{0.535673618f, 0.151476547f},
-std::array<float,2>{0.406138837f, 0.295952737f},
-std::array<float,2>{0.800964594f, 0.841526031f},
-std::array<float,2>{0.156313106f, 0.789609194f},
-std::array<float,2>{0.733671427f, 0.371748954f},
-std::array<float,2>{0.370610774f, 0.198900536f},
-std::array<float,2>{0.955843627f, 0.661032677f},
-std::array<float,2>{0.462562472f, 0.55103308f},
-std::array<float,2>{0.827242434f, 0.108442381f},
-std::array<float,2>{0.094903715f, 0.45416975f},
-std::array<float,2>{0.600708663f, 0.919233739f},
-std::array<float,2>{0.418472975f, 0.852471054f},
-std::array<float,2>{0.763606846f, 0.252551287f},
-std::array<float,2>{0.0607916191f, 0.174601987f},
-std::array<float,2>{0.512475193f, 0.733144879f},
-std::array<float,2>{0.199201629f, 0.592050195f},
-std::array<float,2>{0.674807012f, 0.0192197058f},
-std::array<float,2>{0.253910094f, 0.409205109f},
-std::array<float,2>{0.892095983f, 0.949155033f},
-std::array<float,2>{0.0715811327f, 0.881444693f},
-std::array<float,2>{0.565194368f, 0.478041291f},
-std::array<float,2>{0.475245029f, 0.0745990872f},
-std::array<float,2>{0.846265435f, 0.521842659f},
-std::array<float,2>{0.343099028f, 0.653441608f},
-std::array<float,2>{0.988428712f, 0.223927513f},
-std::array<float,2>{0.128311723f, 0.318581492f},
-std::array<float,2>{0.715809345f, 0.778524518f},
-std::array<float,2>{0.393769324f, 0.939978421f},
-std::array<float,2>{0.809196472f, 0.418031096f},
-std::array<float,2>{0.0303871389f, 0.0304606147f},
-std::array<float,2>{0.540343821f, 0.58479768f},
-std::array<float,2>{0.244863942f, 0.720174253f},
-std::array<float,2>{0.629478753f, 0.185725987f},
-std::array<float,2>{0.306938976f, 0.264203697f},
-std::array<float,2>{0.934897304f, 0.847346306f},
-std::array<float,2>{0.104298323f, 0.77048111f},
-std::array<float,2>{0.604959786f, 0.320453078f},
-std::array<float,2>{0.460757911f, 0.229586512f},
-std::array<float,2>{0.818622112f, 0.6461097f},
-std::array<float,2>{0.361522973f, 0.526809514f},
-std::array<float,2>{0.967196226f, 0.0693177581f},
-std::array<float,2>{0.166244581f, 0.468985915f},
-std::array<float,2>{0.719935894f, 0.888385773f},
-std::array<float,2>{0.258182764f, 0.835064411f},
-std::array<float,2>{0.905255616f, 0.285376549f},
-std::array<float,2>{0.195197731f, 0.147426963f},
-std::array<float,2>{0.68524009f, 0.692907631f},
-std::array<float,2>{0.0527692325f, 0.614699423f},
-std::array<float,2>{0.502145588f, 0.0477668792f},
-std::array<float,2>{0.407081217f, 0.395102859f},
-std::array<float,2>{0.757645845f, 0.98480618f},
-std::array<float,2>{0.137163818f, 0.908024549f},
-std::array<float,2>{0.70599252f, 0.465253651f},
-std::array<float,2>{0.329008847f, 0.0942268372f},
-std::array<float,2>{0.997540355f, 0.560028374f},
-std::array<float,2>{0.482999444f, 0.666466951f},
-std::array<float,2>{0.858500183f, 0.190411553f},
-std::array<float,2>{0.0654813498f, 0.363757879f},
-std::array<float,2>{0.573368073f, 0.783374727f},
-std::array<float,2>{0.324849993f, 0.903898656f},
-std::array<float,2>{0.983873665f, 0.493326783f},
-std::array<float,2>{0.144774199f, 0.0793760568f},
-std::array<float,2>{0.699361622f, 0.50274843f},
-std::array<float,2>{0.0791244507f, 0.625156879f},
-std::array<float,2>{0.579657555f, 0.2440449f},
-std::array<float,2>{0.491151631f, 0.337015927f},
-std::array<float,2>{0.870140791f, 0.762744486f},
-std::array<float,2>{0.217498899f, 0.861533701f},
-std::array<float,2>{0.66004473f, 0.270200282f},
-std::array<float,2>{0.268901199f, 0.164425939f},
-std::array<float,2>{0.887379408f, 0.748275578f},
-std::array<float,2>{0.429157257f, 0.57496959f},
-std::array<float,2>{0.77426368f, 0.00684877811f},
-std::array<float,2>{0.0336668491f, 0.434420407f},
-std::array<float,2>{0.529139936f, 0.957410157f},
-std::array<float,2>{0.448789597f, 0.807852149f},
-std::array<float,2>{0.83358252f, 0.344486356f},
-std::array<float,2>{0.114002742f, 0.21807006f},
-std::array<float,2>{0.624500036f, 0.672747433f},
-std::array<float,2>{0.172302753f, 0.535680532f},
-std::array<float,2>{0.740725517f, 0.116812147f},
-std::array<float,2>{0.347087026f, 0.445000589f},
-std::array<float,2>{0.943619847f, 0.931376398f},
-std::array<float,2>{0.00898131449f, 0.971388817f},
-std::array<float,2>{0.55762583f, 0.37505585f},
-std::array<float,2>{0.377201498f, 0.0410860628f},
-std::array<float,2>{0.793522656f, 0.608965099f},
-std::array<float,2>{0.283850491f, 0.704642057f},
-std::array<float,2>{0.914040089f, 0.125169724f},
-std::array<float,2>{0.233176678f, 0.311724603f},
-std::array<float,2>{0.654397666f, 0.820946276f},
-std::array<float,2>{0.415075123f, 0.935561538f},
-std::array<float,2>{0.759008586f, 0.43993625f},
-std::array<float,2>{0.0561401993f, 0.112320796f},
-std::array<float,2>{0.509741843f, 0.533067107f},
-std::array<float,2>{0.199277014f, 0.676184893f},
-std::array<float,2>{0.676916301f, 0.211176082f},
-std::array<float,2>{0.250077218f, 0.35119918f},
-std::array<float,2>{0.896928787f, 0.80936265f},
-std::array<float,2>{0.0743715242f, 0.827601075f},
-std::array<float,2>{0.5696733f, 0.305787355f},
-std::array<float,2>{0.470567316f, 0.130639404f},
-std::array<float,2>{0.850367844f, 0.708273947f},
-std::array<float,2>{0.338783145f, 0.602701187f},
-std::array<float,2>{0.987392485f, 0.0458878987f},
-std::array<float,2>{0.132006064f, 0.381849915f},
-std::array<float,2>{0.711688042f, 0.974707961f},
-std::array<float,2>{0.298607558f, 0.759867847f},
-std::array<float,2>{0.925935626f, 0.340164602f},
-std::array<float,2>{0.23664774f, 0.247969821f},
-std::array<float,2>{0.633640409f, 0.631937623f},
-std::array<float,2>{0.0179310367f, 0.503945291f},
-std::array<float,2>{0.532193601f, 0.0844645128f},
-std::array<float,2>{0.399828255f, 0.498369604f},
-std::array<float,2>{0.797722876f, 0.901554704f},
-std::array<float,2>{0.163720995f, 0.956927657f},
-std::array<float,2>{0.728691399f, 0.43222782f},
-std::array<float,2>{0.37332955f, 0.000376022625f},
-std::array<float,2>{0.960322142f, 0.57233578f},
-std::array<float,2>{0.466029823f, 0.744725883f},
-std::array<float,2>{0.82198441f, 0.170205444f},
-std::array<float,2>{0.101288505f, 0.267463058f},
-std::array<float,2>{0.594196141f, 0.865756512f},
-std::array<float,2>{0.358605117f, 0.990739107f},
-std::array<float,2>{0.950789869f, 0.391283542f},
-std::array<float,2>{0.182381064f, 0.0542291924f},
-std::array<float,2>{0.743570685f, 0.612137914f},
-std::array<float,2>{0.118767075f, 0.689688444f},
-std::array<float,2>{0.613234162f, 0.140725464f},
-std::array<float,2>{0.440978348f, 0.283457428f},
-std::array<float,2>{0.839972973f, 0.828428328f},
-std::array<float,2>{0.22625111f, 0.787296653f},
-std::array<float,2>{0.641695142f, 0.361482382f},
-std::array<float,2>{0.293996245f, 0.191666156f},
-std::array<float,2>{0.914623857f, 0.670570433f},
-std::array<float,2>{0.383100599f, 0.556472421f},
-std::array<float,2>{0.782669783f, 0.0979863927f},
-std::array<float,2>{0.00174970983f, 0.463621229f},
-std::array<float,2>{0.549244702f, 0.911017597f},
-std::array<float,2>{0.499354362f, 0.848441839f},
-std::array<float,2>{0.863324165f, 0.258899778f},
-std::array<float,2>{0.0897634029f, 0.18294163f},
-std::array<float,2>{0.590488613f, 0.723960996f},
-std::array<float,2>{0.154303357f, 0.581933379f},
-std::array<float,2>{0.688084245f, 0.0262882449f},
-std::array<float,2>{0.319517851f, 0.417689949f},
-std::array<float,2>{0.974373996f, 0.942979217f},
-std::array<float,2>{0.0442073531f, 0.88436681f},
-std::array<float,2>{0.5200876f, 0.472675204f},
-std::array<float,2>{0.430505127f, 0.0649973005f},
-std::array<float,2>{0.76874429f, 0.530912101f},
-std::array<float,2>{0.280795336f, 0.640902519f},
-std::array<float,2>{0.880871594f, 0.23181276f},
-std::array<float,2>{0.20800513f, 0.326297671f},
-std::array<float,2>{0.665954411f, 0.767289698f},
-std::array<float,2>{0.450144589f, 0.952112079f},
-std::array<float,2>{0.829850793f, 0.412999123f},
-std::array<float,2>{0.109432757f, 0.0199101735f},
-std::array<float,2>{0.619772553f, 0.586787879f},
-std::array<float,2>{0.178118527f, 0.728173614f},
-std::array<float,2>{0.737184525f, 0.179545596f},
-std::array<float,2>{0.348989636f, 0.256774336f},
-std::array<float,2>{0.939031541f, 0.855686188f},
-std::array<float,2>{0.0156134833f, 0.777277708f},
-std::array<float,2>{0.562283516f, 0.313143045f},
-std::array<float,2>{0.380905777f, 0.221768856f},
-std::array<float,2>{0.790007353f, 0.649833024f},
-std::array<float,2>{0.288118839f, 0.517043471f},
-std::array<float,2>{0.909502149f, 0.072924614f},
-std::array<float,2>{0.229274437f, 0.48390013f},
-std::array<float,2>{0.649797738f, 0.87693423f},
-std::array<float,2>{0.322928846f, 0.836017728f},
-std::array<float,2>{0.979702234f, 0.29249841f},
-std::array<float,2>{0.14272365f, 0.153742194f},
-std::array<float,2>{0.697554708f, 0.69917357f},
-std::array<float,2>{0.0841676295f, 0.623535633f},
-std::array<float,2>{0.58417356f, 0.0569803044f},
-std::array<float,2>{0.487521261f, 0.404105186f},
-std::array<float,2>{0.874304295f, 0.998845398f},
-std::array<float,2>{0.211265936f, 0.917381823f},
-std::array<float,2>{0.662155449f, 0.458868027f},
-std::array<float,2>{0.271532595f, 0.10261149f},
-std::array<float,2>{0.884423792f, 0.547400653f},
-std::array<float,2>{0.422370821f, 0.657396972f},
-std::array<float,2>{0.779073119f, 0.202996954f},
-std::array<float,2>{0.03600467f, 0.367379159f},
-std::array<float,2>{0.526163399f, 0.79600656f},
-std::array<float,2>{0.265283883f, 0.894852519f},
-std::array<float,2>{0.901952684f, 0.489244103f},
-std::array<float,2>{0.18753548f, 0.0915683284f},
-std::array<float,2>{0.680266619f, 0.514354587f},
-std::array<float,2>{0.0477939099f, 0.639037907f},
-std::array<float,2>{0.507080257f, 0.23913531f},
-std::array<float,2>{0.410640836f, 0.330908984f},
-std::array<float,2>{0.750899494f, 0.752994299f},
-std::array<float,2>{0.133675322f, 0.869998753f},
-std::array<float,2>{0.710520148f, 0.278340161f},
-std::array<float,2>{0.333500594f, 0.162977159f},
-std::array<float,2>{0.99349159f, 0.736516654f},
-std::array<float,2>{0.478060484f, 0.566950142f},
-std::array<float,2>{0.853159964f, 0.0130662452f},
-std::array<float,2>{0.068063207f, 0.426450789f},
-std::array<float,2>{0.577500939f, 0.966863275f},
-std::array<float,2>{0.397916853f, 0.803775966f},
-std::array<float,2>{0.807114899f, 0.352100462f},
-std::array<float,2>{0.0267387368f, 0.203546435f},
-std::array<float,2>{0.545404971f, 0.68654412f},
-std::array<float,2>{0.248348564f, 0.539894521f},
-std::array<float,2>{0.626994312f, 0.124763183f},
-std::array<float,2>{0.311620831f, 0.448186159f},
-std::array<float,2>{0.929963648f, 0.925691605f},
-std::array<float,2>{0.10644161f, 0.978731811f},
-std::array<float,2>{0.608585477f, 0.385975718f},
-std::array<float,2>{0.454842329f, 0.0355332419f},
-std::array<float,2>{0.814239502f, 0.595794499f},
-std::array<float,2>{0.366887033f, 0.712791324f},
-std::array<float,2>{0.962854683f, 0.137870073f},
-std::array<float,2>{0.171329901f, 0.298582762f},
-std::array<float,2>{0.724447846f, 0.818363845f},
-std::array<float,2>{0.476464391f, 0.88041693f},
-std::array<float,2>{0.847575307f, 0.478721648f},
-std::array<float,2>{0.0706310868f, 0.0770433545f},
-std::array<float,2>{0.565861583f, 0.520717025f},
-std::array<float,2>{0.127024055f, 0.655284464f},
-std::array<float,2>{0.716392696f, 0.225973397f},
-std::array<float,2>{0.342438936f, 0.317986608f},
-std::array<float,2>{0.98939991f, 0.780286551f},
-std::array<float,2>{0.0620954596f, 0.854189992f},
-std::array<float,2>{0.512783527f, 0.25057587f},
-std::array<float,2>{0.419018805f, 0.172592983f},
-std::array<float,2>{0.762454093f, 0.732136071f},
-std::array<float,2>{0.254885346f, 0.590788662f},
-std::array<float,2>{0.890774727f, 0.0161611233f},
-std::array<float,2>{0.197342366f, 0.407336384f},
-std::array<float,2>{0.674703479f, 0.946072638f},
-std::array<float,2>{0.369289726f, 0.791487455f},
-std::array<float,2>{0.956714511f, 0.373465061f},
-std::array<float,2>{0.158189356f, 0.196150601f},
-std::array<float,2>{0.732676566f, 0.66363883f},
-std::array<float,2>{0.0945675075f, 0.553294361f},
-std::array<float,2>{0.600542605f, 0.106608965f},
-std::array<float,2>{0.461514205f, 0.4564161f},
-std::array<float,2>{0.82682246f, 0.920582294f},
-std::array<float,2>{0.240887567f, 0.992529869f},
-std::array<float,2>{0.637978375f, 0.400097638f},
-std::array<float,2>{0.303224325f, 0.0589369312f},
-std::array<float,2>{0.923102796f, 0.61800766f},
-std::array<float,2>{0.405217618f, 0.702284098f},
-std::array<float,2>{0.802442431f, 0.149974465f},
-std::array<float,2>{0.0210276935f, 0.294772774f},
-std::array<float,2>{0.5361678f, 0.842722058f},
-std::array<float,2>{0.291066259f, 0.963252187f},
-std::array<float,2>{0.918071985f, 0.425059021f},
-std::array<float,2>{0.219939992f, 0.0092927143f},
-std::array<float,2>{0.645901561f, 0.562955678f},
-std::array<float,2>{0.00686035492f, 0.741087794f},
-std::array<float,2>{0.551945031f, 0.158758461f},
-std::array<float,2>{0.387371272f, 0.275882602f},
-std::array<float,2>{0.788024366f, 0.872263253f},
-std::array<float,2>{0.183921218f, 0.754148185f},
-std::array<float,2>{0.746939957f, 0.332950681f},
-std::array<float,2>{0.355171382f, 0.237800524f},
-std::array<float,2>{0.947240591f, 0.633324742f},
-std::array<float,2>{0.445030153f, 0.510400712f},
-std::array<float,2>{0.839357913f, 0.0883321613f},
-std::array<float,2>{0.121774316f, 0.485474646f},
-std::array<float,2>{0.614172697f, 0.893743277f},
-std::array<float,2>{0.434200495f, 0.813029528f},
-std::array<float,2>{0.771343827f, 0.302187294f},
-std::array<float,2>{0.0394805223f, 0.132819936f},
-std::array<float,2>{0.517682195f, 0.716101706f},
-std::array<float,2>{0.206878126f, 0.597951591f},
-std::array<float,2>{0.67003268f, 0.0316695981f},
-std::array<float,2>{0.275379896f, 0.387926549f},
-std::array<float,2>{0.876280308f, 0.98278445f},
-std::array<float,2>{0.0917813554f, 0.92606622f},
-std::array<float,2>{0.586991549f, 0.450594038f},
-std::array<float,2>{0.494862109f, 0.117886864f},
-std::array<float,2>{0.859538853f, 0.546442449f},
-std::array<float,2>{0.31443274f, 0.681841195f},
-std::array<float,2>{0.972229481f, 0.209469169f},
-std::array<float,2>{0.148672447f, 0.355801433f},
-std::array<float,2>{0.693998635f, 0.80027014f},
-std::array<float,2>{0.378354967f, 0.968892455f},
-std::array<float,2>{0.794433773f, 0.378407151f},
-std::array<float,2>{0.00871385727f, 0.040874742f},
-std::array<float,2>{0.557521999f, 0.606426716f},
-std::array<float,2>{0.234329566f, 0.705309808f},
-std::array<float,2>{0.655590236f, 0.127286628f},
-std::array<float,2>{0.284214139f, 0.310422361f},
-std::array<float,2>{0.91271323f, 0.823701262f},
-std::array<float,2>{0.115151852f, 0.806396902f},
-std::array<float,2>{0.623973668f, 0.345923185f},
-std::array<float,2>{0.447980911f, 0.215519577f},
-std::array<float,2>{0.832194328f, 0.67407918f},
-std::array<float,2>{0.346339077f, 0.53722626f},
-std::array<float,2>{0.944902182f, 0.113635592f},
-std::array<float,2>{0.17285572f, 0.442066491f},
-std::array<float,2>{0.742008388f, 0.933560669f},
-std::array<float,2>{0.268289328f, 0.860265076f},
-std::array<float,2>{0.887982845f, 0.272694588f},
-std::array<float,2>{0.217817962f, 0.167763695f},
-std::array<float,2>{0.658408999f, 0.746597528f},
-std::array<float,2>{0.034317784f, 0.577465117f},
-std::array<float,2>{0.528083861f, 0.00476161856f},
-std::array<float,2>{0.42778194f, 0.43700695f},
-std::array<float,2>{0.77495563f, 0.960374892f},
-std::array<float,2>{0.145967379f, 0.905029893f},
-std::array<float,2>{0.700352907f, 0.494339079f},
-std::array<float,2>{0.326126307f, 0.081872873f},
-std::array<float,2>{0.982444048f, 0.500845313f},
-std::array<float,2>{0.491264254f, 0.628720284f},
-std::array<float,2>{0.869650304f, 0.244173661f},
-std::array<float,2>{0.0781937614f, 0.339544356f},
-std::array<float,2>{0.578802109f, 0.764488518f},
-std::array<float,2>{0.330069453f, 0.908717394f},
-std::array<float,2>{0.996384442f, 0.467782587f},
-std::array<float,2>{0.138437152f, 0.0969345272f},
-std::array<float,2>{0.706888378f, 0.561397612f},
-std::array<float,2>{0.0651954636f, 0.66556102f},
-std::array<float,2>{0.572308421f, 0.188172698f},
-std::array<float,2>{0.483804822f, 0.366451859f},
-std::array<float,2>{0.858102322f, 0.781318486f},
-std::array<float,2>{0.193959147f, 0.832402229f},
-std::array<float,2>{0.684445202f, 0.289002568f},
-std::array<float,2>{0.259145349f, 0.145555079f},
-std::array<float,2>{0.905317962f, 0.695074022f},
-std::array<float,2>{0.40745765f, 0.617186368f},
-std::array<float,2>{0.756459653f, 0.0499938838f},
-std::array<float,2>{0.0542680547f, 0.396609992f},
-std::array<float,2>{0.503739536f, 0.987157822f},
-std::array<float,2>{0.459768385f, 0.771698475f},
-std::array<float,2>{0.820247293f, 0.323929965f},
-std::array<float,2>{0.104946963f, 0.228390217f},
-std::array<float,2>{0.604395092f, 0.64651233f},
-std::array<float,2>{0.167344883f, 0.523693323f},
-std::array<float,2>{0.718933165f, 0.0666820034f},
-std::array<float,2>{0.362537861f, 0.471296966f},
-std::array<float,2>{0.968544543f, 0.88909018f},
-std::array<float,2>{0.0298612826f, 0.938788831f},
-std::array<float,2>{0.539909303f, 0.420167238f},
-std::array<float,2>{0.393090278f, 0.0279712025f},
-std::array<float,2>{0.810142636f, 0.582656324f},
-std::array<float,2>{0.308144569f, 0.721280813f},
-std::array<float,2>{0.934014738f, 0.185253084f},
-std::array<float,2>{0.245804146f, 0.263567924f},
-std::array<float,2>{0.630689025f, 0.844853222f},
-std::array<float,2>{0.401542246f, 0.898459852f},
-std::array<float,2>{0.800598979f, 0.497296989f},
-std::array<float,2>{0.016432438f, 0.0821657181f},
-std::array<float,2>{0.533530831f, 0.506829679f},
-std::array<float,2>{0.234793037f, 0.63013047f},
-std::array<float,2>{0.63510561f, 0.24999617f},
-std::array<float,2>{0.30044204f, 0.34368825f},
-std::array<float,2>{0.927790046f, 0.759509742f},
-std::array<float,2>{0.0986607224f, 0.863472164f},
-std::array<float,2>{0.596515238f, 0.267899364f},
-std::array<float,2>{0.468377203f, 0.16867204f},
-std::array<float,2>{0.822733641f, 0.743631244f},
-std::array<float,2>{0.372552812f, 0.57042557f},
-std::array<float,2>{0.957655668f, 0.00304783741f},
-std::array<float,2>{0.161546439f, 0.429689556f},
-std::array<float,2>{0.727865279f, 0.954137981f},
-std::array<float,2>{0.253355801f, 0.811504722f},
-std::array<float,2>{0.89486903f, 0.348393291f},
-std::array<float,2>{0.202470496f, 0.213419884f},
-std::array<float,2>{0.678073168f, 0.678093791f},
-std::array<float,2>{0.0578972176f, 0.534789205f},
-std::array<float,2>{0.510559082f, 0.109888487f},
-std::array<float,2>{0.417959988f, 0.43809104f},
-std::array<float,2>{0.760714173f, 0.934167147f},
-std::array<float,2>{0.130235761f, 0.9743433f},
-std::array<float,2>{0.713718951f, 0.379402667f},
-std::array<float,2>{0.337648451f, 0.0430352949f},
-std::array<float,2>{0.985277772f, 0.60542649f},
-std::array<float,2>{0.472173631f, 0.70906657f},
-std::array<float,2>{0.849297643f, 0.132051975f},
-std::array<float,2>{0.0773513466f, 0.306982368f},
-std::array<float,2>{0.567920864f, 0.824701488f},
-std::array<float,2>{0.316963285f, 0.943663955f},
-std::array<float,2>{0.974888802f, 0.415066183f},
-std::array<float,2>{0.152496234f, 0.0249803122f},
-std::array<float,2>{0.689951956f, 0.578826785f},
-std::array<float,2>{0.0868805125f, 0.725316107f},
-std::array<float,2>{0.592740119f, 0.179830059f},
-std::array<float,2>{0.497990131f, 0.261101872f},
-std::array<float,2>{0.866969049f, 0.849797368f},
-std::array<float,2>{0.20934695f, 0.767639279f},
-std::array<float,2>{0.66712743f, 0.325322509f},
-std::array<float,2>{0.278111339f, 0.233391687f},
-std::array<float,2>{0.880032957f, 0.643620491f},
-std::array<float,2>{0.43242842f, 0.52743572f},
-std::array<float,2>{0.767122447f, 0.0626788661f},
-std::array<float,2>{0.0465065166f, 0.474763572f},
-std::array<float,2>{0.523156404f, 0.885624349f},
-std::array<float,2>{0.438169181f, 0.832027733f},
-std::array<float,2>{0.843107939f, 0.282558948f},
-std::array<float,2>{0.119590826f, 0.144356206f},
-std::array<float,2>{0.611203372f, 0.689213693f},
-std::array<float,2>{0.180762738f, 0.610449851f},
-std::array<float,2>{0.744684756f, 0.0517276898f},
-std::array<float,2>{0.357289433f, 0.393068463f},
-std::array<float,2>{0.951241612f, 0.988515198f},
-std::array<float,2>{0.00244694715f, 0.912705481f},
-std::array<float,2>{0.548689604f, 0.46185264f},
-std::array<float,2>{0.384886503f, 0.101096779f},
-std::array<float,2>{0.785076797f, 0.556854486f},
-std::array<float,2>{0.295247525f, 0.668068826f},
-std::array<float,2>{0.916027367f, 0.195105582f},
-std::array<float,2>{0.223005027f, 0.360043675f},
-std::array<float,2>{0.644264102f, 0.786180139f},
-std::array<float,2>{0.485860139f, 0.996299803f},
-std::array<float,2>{0.872440755f, 0.405911207f},
-std::array<float,2>{0.0820322186f, 0.0565761141f},
-std::array<float,2>{0.58381933f, 0.623030365f},
-std::array<float,2>{0.141848713f, 0.695752919f},
-std::array<float,2>{0.696491659f, 0.15455769f},
-std::array<float,2>{0.32225576f, 0.289401352f},
-std::array<float,2>{0.977869332f, 0.839805305f},
-std::array<float,2>{0.0375304557f, 0.793372154f},
-std::array<float,2>{0.523694754f, 0.370066017f},
-std::array<float,2>{0.425042987f, 0.20021145f},
-std::array<float,2>{0.779851794f, 0.659486115f},
-std::array<float,2>{0.271126509f, 0.549748838f},
-std::array<float,2>{0.886609375f, 0.104432784f},
-std::array<float,2>{0.213961348f, 0.459803104f},
-std::array<float,2>{0.660588324f, 0.915904522f},
-std::array<float,2>{0.35148716f, 0.858160734f},
-std::array<float,2>{0.939563632f, 0.254685998f},
-std::array<float,2>{0.175821915f, 0.177544549f},
-std::array<float,2>{0.735799134f, 0.729044974f},
-std::array<float,2>{0.111808032f, 0.58914566f},
-std::array<float,2>{0.617803335f, 0.0218092743f},
-std::array<float,2>{0.452762842f, 0.410359472f},
-std::array<float,2>{0.830506027f, 0.949806392f},
-std::array<float,2>{0.228204712f, 0.877784908f},
-std::array<float,2>{0.651891649f, 0.481694788f},
-std::array<float,2>{0.285220861f, 0.0712972209f},
-std::array<float,2>{0.90630722f, 0.518348694f},
-std::array<float,2>{0.380615294f, 0.650632441f},
-std::array<float,2>{0.792462826f, 0.21930714f},
-std::array<float,2>{0.012027707f, 0.316370428f},
-std::array<float,2>{0.559574544f, 0.774457991f},
-std::array<float,2>{0.309662968f, 0.92344892f},
-std::array<float,2>{0.932453513f, 0.445868075f},
-std::array<float,2>{0.246472821f, 0.121334672f},
-std::array<float,2>{0.625681758f, 0.542545855f},
-std::array<float,2>{0.0251427721f, 0.684685171f},
-std::array<float,2>{0.543583214f, 0.205636725f},
-std::array<float,2>{0.395124108f, 0.353607565f},
-std::array<float,2>{0.805236757f, 0.802255094f},
-std::array<float,2>{0.169383869f, 0.818153024f},
-std::array<float,2>{0.726235449f, 0.298880577f},
-std::array<float,2>{0.363978297f, 0.139636725f},
-std::array<float,2>{0.964671016f, 0.714322269f},
-std::array<float,2>{0.456329376f, 0.594383597f},
-std::array<float,2>{0.815566421f, 0.037165679f},
-std::array<float,2>{0.107541427f, 0.383228034f},
-std::array<float,2>{0.606456876f, 0.976738334f},
-std::array<float,2>{0.41248098f, 0.750546873f},
-std::array<float,2>{0.75309974f, 0.328346223f},
-std::array<float,2>{0.0493279956f, 0.240674898f},
-std::array<float,2>{0.505850255f, 0.637795866f},
-std::array<float,2>{0.189692572f, 0.512289762f},
-std::array<float,2>{0.681728303f, 0.0930861682f},
-std::array<float,2>{0.262915045f, 0.491411775f},
-std::array<float,2>{0.89861542f, 0.898052514f},
-std::array<float,2>{0.0692224875f, 0.965295553f},
-std::array<float,2>{0.574265003f, 0.429516077f},
-std::array<float,2>{0.479933232f, 0.0137243429f},
-std::array<float,2>{0.854041994f, 0.569441319f},
-std::array<float,2>{0.335553408f, 0.736057937f},
-std::array<float,2>{0.994590342f, 0.161712795f},
-std::array<float,2>{0.135011017f, 0.280949116f},
-std::array<float,2>{0.707389891f, 0.867525637f},
-std::array<float,2>{0.464244813f, 0.918792129f},
-std::array<float,2>{0.824678421f, 0.453650981f},
-std::array<float,2>{0.0975355953f, 0.107890554f},
-std::array<float,2>{0.598852634f, 0.552718639f},
-std::array<float,2>{0.158323899f, 0.66191411f},
-std::array<float,2>{0.73241502f, 0.1978084f},
-std::array<float,2>{0.368066877f, 0.37283963f},
-std::array<float,2>{0.95367974f, 0.790591538f},
-std::array<float,2>{0.0227611978f, 0.840177059f},
-std::array<float,2>{0.538844287f, 0.295300633f},
-std::array<float,2>{0.403995275f, 0.151293874f},
-std::array<float,2>{0.803210497f, 0.700155199f},
-std::array<float,2>{0.301308006f, 0.619722784f},
-std::array<float,2>{0.925183296f, 0.061204467f},
-std::array<float,2>{0.239607945f, 0.402031362f},
-std::array<float,2>{0.640052378f, 0.994441748f},
-std::array<float,2>{0.341279566f, 0.777753592f},
-std::array<float,2>{0.990276754f, 0.320100993f},
-std::array<float,2>{0.125879005f, 0.223090783f},
-std::array<float,2>{0.718603432f, 0.653303027f},
-std::array<float,2>{0.0728155002f, 0.523269355f},
-std::array<float,2>{0.563504934f, 0.0757820234f},
-std::array<float,2>{0.473708719f, 0.477118373f},
-std::array<float,2>{0.843773127f, 0.882556975f},
-std::array<float,2>{0.196603894f, 0.947478354f},
-std::array<float,2>{0.672041655f, 0.408395767f},
-std::array<float,2>{0.257093966f, 0.0182262659f},
-std::array<float,2>{0.892722189f, 0.593224883f},
-std::array<float,2>{0.420379549f, 0.734024942f},
-std::array<float,2>{0.764741302f, 0.175089672f},
-std::array<float,2>{0.0597027875f, 0.25308913f},
-std::array<float,2>{0.513804615f, 0.852900386f},
-std::array<float,2>{0.276471913f, 0.9814834f},
-std::array<float,2>{0.878421903f, 0.389098465f},
-std::array<float,2>{0.203983337f, 0.0333810151f},
-std::array<float,2>{0.669797421f, 0.59978658f},
-std::array<float,2>{0.0425944515f, 0.717927277f},
-std::array<float,2>{0.516209543f, 0.135044709f},
-std::array<float,2>{0.437315702f, 0.303799748f},
-std::array<float,2>{0.7728827f, 0.814838469f},
-std::array<float,2>{0.152038798f, 0.798435569f},
-std::array<float,2>{0.693252325f, 0.358321071f},
-std::array<float,2>{0.315246373f, 0.208751366f},
-std::array<float,2>{0.970500708f, 0.681447446f},
-std::array<float,2>{0.49354291f, 0.542979956f},
-std::array<float,2>{0.862582386f, 0.119907722f},
-std::array<float,2>{0.0936113149f, 0.452054918f},
-std::array<float,2>{0.587968409f, 0.928018987f},
-std::array<float,2>{0.390396357f, 0.873804271f},
-std::array<float,2>{0.78675586f, 0.275231272f},
-std::array<float,2>{0.00522385025f, 0.157351941f},
-std::array<float,2>{0.554268301f, 0.739419162f},
-std::array<float,2>{0.220984623f, 0.565833867f},
-std::array<float,2>{0.64699769f, 0.00992797595f},
-std::array<float,2>{0.290770799f, 0.42294398f},
-std::array<float,2>{0.921074688f, 0.962145448f},
-std::array<float,2>{0.123730302f, 0.891035199f},
-std::array<float,2>{0.617157638f, 0.487416804f},
-std::array<float,2>{0.443276972f, 0.0869909525f},
-std::array<float,2>{0.837625742f, 0.50801897f},
-std::array<float,2>{0.35275352f, 0.63514173f},
-std::array<float,2>{0.947776675f, 0.235288337f},
-std::array<float,2>{0.185580194f, 0.335854232f},
-std::array<float,2>{0.749272764f, 0.756319165f},
-std::array<float,2>{0.426795751f, 0.95803839f},
-std::array<float,2>{0.776838303f, 0.435441822f},
-std::array<float,2>{0.0326920971f, 0.00615647808f},
-std::array<float,2>{0.530741513f, 0.575289369f},
-std::array<float,2>{0.216370538f, 0.749384701f},
-std::array<float,2>{0.65636611f, 0.165888116f},
-std::array<float,2>{0.266134799f, 0.27054131f},
-std::array<float,2>{0.889908195f, 0.862342715f},
-std::array<float,2>{0.0819725469f, 0.762068629f},
-std::array<float,2>{0.580086648f, 0.336242259f},
-std::array<float,2>{0.488940388f, 0.24267152f},
-std::array<float,2>{0.867405951f, 0.626667917f},
-std::array<float,2>{0.32755509f, 0.503578305f},
-std::array<float,2>{0.98062551f, 0.0783720165f},
-std::array<float,2>{0.146534562f, 0.492459357f},
-std::array<float,2>{0.701271176f, 0.90253377f},
-std::array<float,2>{0.283175498f, 0.822131515f},
-std::array<float,2>{0.911331713f, 0.310989588f},
-std::array<float,2>{0.231647044f, 0.12630868f},
-std::array<float,2>{0.65417552f, 0.703178585f},
-std::array<float,2>{0.00984656066f, 0.607893169f},
-std::array<float,2>{0.555410802f, 0.0427535772f},
-std::array<float,2>{0.375187457f, 0.376923621f},
-std::array<float,2>{0.795313358f, 0.972406089f},
-std::array<float,2>{0.174678445f, 0.930519402f},
-std::array<float,2>{0.738921702f, 0.444124013f},
-std::array<float,2>{0.344322354f, 0.116143212f},
-std::array<float,2>{0.94172591f, 0.536877871f},
-std::array<float,2>{0.446486354f, 0.673143327f},
-std::array<float,2>{0.834866285f, 0.217726991f},
-std::array<float,2>{0.115289375f, 0.344864726f},
-std::array<float,2>{0.621204197f, 0.80744046f},
-std::array<float,2>{0.359603226f, 0.886933267f},
-std::array<float,2>{0.964934707f, 0.470330924f},
-std::array<float,2>{0.164187029f, 0.0701055825f},
-std::array<float,2>{0.722317576f, 0.525456965f},
-std::array<float,2>{0.102480538f, 0.644916534f},
-std::array<float,2>{0.602945864f, 0.229479268f},
-std::array<float,2>{0.458738118f, 0.321672648f},
-std::array<float,2>{0.816817701f, 0.770508587f},
-std::array<float,2>{0.243464798f, 0.84620893f},
-std::array<float,2>{0.632304549f, 0.264919639f},
-std::array<float,2>{0.306277722f, 0.186529577f},
-std::array<float,2>{0.937054753f, 0.718757689f},
-std::array<float,2>{0.391967148f, 0.585411668f},
-std::array<float,2>{0.811433911f, 0.0298564956f},
-std::array<float,2>{0.0278256927f, 0.419578254f},
-std::array<float,2>{0.541426122f, 0.941308558f},
-std::array<float,2>{0.480578423f, 0.784757018f},
-std::array<float,2>{0.856070101f, 0.36451599f},
-std::array<float,2>{0.0640218034f, 0.191029474f},
-std::array<float,2>{0.571097672f, 0.667688727f},
-std::array<float,2>{0.139592558f, 0.558730602f},
-std::array<float,2>{0.703344643f, 0.0950306952f},
-std::array<float,2>{0.330123335f, 0.466328353f},
-std::array<float,2>{0.998361886f, 0.906412959f},
-std::array<float,2>{0.0521189496f, 0.986250341f},
-std::array<float,2>{0.501711845f, 0.396117538f},
-std::array<float,2>{0.4095985f, 0.048363816f},
-std::array<float,2>{0.754720092f, 0.614091635f},
-std::array<float,2>{0.259991288f, 0.691986203f},
-std::array<float,2>{0.904114962f, 0.148358151f},
-std::array<float,2>{0.192995608f, 0.286845148f},
-std::array<float,2>{0.685827971f, 0.83441025f},
-std::array<float,2>{0.394801199f, 0.924990058f},
-std::array<float,2>{0.805119514f, 0.447522312f},
-std::array<float,2>{0.0244208947f, 0.124164745f},
-std::array<float,2>{0.543098569f, 0.539219677f},
-std::array<float,2>{0.246624976f, 0.687054336f},
-std::array<float,2>{0.625473559f, 0.203673676f},
-std::array<float,2>{0.310071617f, 0.352018118f},
-std::array<float,2>{0.9319911f, 0.80444622f},
-std::array<float,2>{0.107990198f, 0.818929136f},
-std::array<float,2>{0.606978834f, 0.298244298f},
-std::array<float,2>{0.456551671f, 0.138361037f},
-std::array<float,2>{0.816232324f, 0.71221298f},
-std::array<float,2>{0.363429844f, 0.5963943f},
-std::array<float,2>{0.964180887f, 0.0358571671f},
-std::array<float,2>{0.169731915f, 0.386524975f},
-std::array<float,2>{0.725962937f, 0.979431808f},
-std::array<float,2>{0.263666153f, 0.753601968f},
-std::array<float,2>{0.899196386f, 0.330434114f},
-std::array<float,2>{0.19014734f, 0.238673657f},
-std::array<float,2>{0.682430327f, 0.63932085f},
-std::array<float,2>{0.0491603799f, 0.51404947f},
-std::array<float,2>{0.505057216f, 0.0909188986f},
-std::array<float,2>{0.41283381f, 0.488319904f},
-std::array<float,2>{0.753744245f, 0.895412326f},
-std::array<float,2>{0.135678932f, 0.967366695f},
-std::array<float,2>{0.707851231f, 0.426168561f},
-std::array<float,2>{0.335004538f, 0.0133927315f},
-std::array<float,2>{0.994857252f, 0.566551924f},
-std::array<float,2>{0.480442137f, 0.737138212f},
-std::array<float,2>{0.853992403f, 0.162582457f},
-std::array<float,2>{0.068588607f, 0.279196769f},
-std::array<float,2>{0.575049222f, 0.869380236f},
-std::array<float,2>{0.321707487f, 0.998502195f},
-std::array<float,2>{0.978203058f, 0.403743118f},
-std::array<float,2>{0.142246395f, 0.0571868941f},
-std::array<float,2>{0.696845531f, 0.623419762f},
-std::array<float,2>{0.0828633234f, 0.698680043f},
-std::array<float,2>{0.58315146f, 0.154242098f},
-std::array<float,2>{0.485544622f, 0.292191535f},
-std::array<float,2>{0.872601748f, 0.836681008f},
-std::array<float,2>{0.214681834f, 0.796505511f},
-std::array<float,2>{0.660872698f, 0.367913634f},
-std::array<float,2>{0.270745724f, 0.202521443f},
-std::array<float,2>{0.886129677f, 0.65784204f},
-std::array<float,2>{0.425559402f, 0.547280908f},
-std::array<float,2>{0.779500008f, 0.103178293f},
-std::array<float,2>{0.0377115235f, 0.458416015f},
-std::array<float,2>{0.524276555f, 0.917788744f},
-std::array<float,2>{0.452525377f, 0.856116891f},
-std::array<float,2>{0.831021726f, 0.25605616f},
-std::array<float,2>{0.111844063f, 0.178986624f},
-std::array<float,2>{0.617346525f, 0.727859616f},
-std::array<float,2>{0.176693574f, 0.585968137f},
-std::array<float,2>{0.736054778f, 0.0204117056f},
-std::array<float,2>{0.350830138f, 0.412132204f},
-std::array<float,2>{0.939991474f, 0.951498508f},
-std::array<float,2>{0.0123437103f, 0.876404166f},
-std::array<float,2>{0.560461879f, 0.483410448f},
-std::array<float,2>{0.380369067f, 0.0722973943f},
-std::array<float,2>{0.792611659f, 0.517150879f},
-std::array<float,2>{0.285725266f, 0.650155902f},
-std::array<float,2>{0.906844616f, 0.222653687f},
-std::array<float,2>{0.227705568f, 0.312619597f},
-std::array<float,2>{0.651407182f, 0.776494026f},
-std::array<float,2>{0.497204334f, 0.942664087f},
-std::array<float,2>{0.866663933f, 0.417241901f},
-std::array<float,2>{0.0863088444f, 0.0256107189f},
-std::array<float,2>{0.592213809f, 0.581246078f},
-std::array<float,2>{0.15314357f, 0.724537373f},
-std::array<float,2>{0.689492106f, 0.183359817f},
-std::array<float,2>{0.316526264f, 0.25929749f},
-std::array<float,2>{0.975354254f, 0.847823262f},
-std::array<float,2>{0.046078641f, 0.76704216f},
-std::array<float,2>{0.52257663f, 0.327060759f},
-std::array<float,2>{0.431753606f, 0.232334822f},
-std::array<float,2>{0.766955912f, 0.641316295f},
-std::array<float,2>{0.277490377f, 0.530534863f},
-std::array<float,2>{0.880420327f, 0.064690344f},
-std::array<float,2>{0.209917739f, 0.473313391f},
-std::array<float,2>{0.667766631f, 0.883942902f},
-std::array<float,2>{0.356458634f, 0.828766346f},
-std::array<float,2>{0.952082932f, 0.283730328f},
-std::array<float,2>{0.181453034f, 0.141411245f},
-std::array<float,2>{0.744306386f, 0.690114677f},
-std::array<float,2>{0.120064303f, 0.611570477f},
-std::array<float,2>{0.610528111f, 0.0538559221f},
-std::array<float,2>{0.437740535f, 0.390856415f},
-std::array<float,2>{0.843663275f, 0.99051404f},
-std::array<float,2>{0.22319524f, 0.910418451f},
-std::array<float,2>{0.643745065f, 0.463090628f},
-std::array<float,2>{0.29550758f, 0.0985800028f},
-std::array<float,2>{0.91673404f, 0.555882692f},
-std::array<float,2>{0.385598749f, 0.670270503f},
-std::array<float,2>{0.784526646f, 0.19210887f},
-std::array<float,2>{0.00225913664f, 0.36220479f},
-std::array<float,2>{0.548318446f, 0.787935555f},
-std::array<float,2>{0.299827009f, 0.901950598f},
-std::array<float,2>{0.928310752f, 0.49865222f},
-std::array<float,2>{0.235181704f, 0.0848178491f},
-std::array<float,2>{0.635478139f, 0.504637301f},
-std::array<float,2>{0.0157032777f, 0.63253665f},
-std::array<float,2>{0.534094393f, 0.247558221f},
-std::array<float,2>{0.402112544f, 0.340437382f},
-std::array<float,2>{0.800193965f, 0.760385811f},
-std::array<float,2>{0.161729634f, 0.865530133f},
-std::array<float,2>{0.72833848f, 0.266705185f},
-std::array<float,2>{0.373024344f, 0.170753419f},
-std::array<float,2>{0.957331181f, 0.744265556f},
-std::array<float,2>{0.468122482f, 0.572844505f},
-std::array<float,2>{0.823101878f, 0.000561821973f},
-std::array<float,2>{0.0994346961f, 0.431772828f},
-std::array<float,2>{0.595747054f, 0.956505358f},
-std::array<float,2>{0.417423785f, 0.80872643f},
-std::array<float,2>{0.76022768f, 0.350976199f},
-std::array<float,2>{0.0583930276f, 0.21165508f},
-std::array<float,2>{0.510071635f, 0.676677465f},
-std::array<float,2>{0.202754319f, 0.53244555f},
-std::array<float,2>{0.678472817f, 0.11303924f},
-std::array<float,2>{0.253828555f, 0.440031081f},
-std::array<float,2>{0.895263493f, 0.936317027f},
-std::array<float,2>{0.0779067501f, 0.975241482f},
-std::array<float,2>{0.56745249f, 0.382559419f},
-std::array<float,2>{0.471954972f, 0.0452831425f},
-std::array<float,2>{0.848879576f, 0.603476822f},
-std::array<float,2>{0.337201834f, 0.708868206f},
-std::array<float,2>{0.984806836f, 0.130163983f},
-std::array<float,2>{0.130721092f, 0.306404591f},
-std::array<float,2>{0.713344395f, 0.827810168f},
-std::array<float,2>{0.458034158f, 0.889270067f},
-std::array<float,2>{0.817083716f, 0.471077561f},
-std::array<float,2>{0.101945169f, 0.0671200603f},
-std::array<float,2>{0.603501141f, 0.524007738f},
-std::array<float,2>{0.164585367f, 0.647434533f},
-std::array<float,2>{0.721976638f, 0.227949157f},
-std::array<float,2>{0.359883249f, 0.323325694f},
-std::array<float,2>{0.965748131f, 0.772262752f},
-std::array<float,2>{0.0279712528f, 0.845454574f},
-std::array<float,2>{0.541574538f, 0.263056755f},
-std::array<float,2>{0.392465591f, 0.184641615f},
-std::array<float,2>{0.810665071f, 0.720928669f},
-std::array<float,2>{0.305869907f, 0.58231473f},
-std::array<float,2>{0.936659396f, 0.0277145896f},
-std::array<float,2>{0.243866354f, 0.420493633f},
-std::array<float,2>{0.632328987f, 0.939147711f},
-std::array<float,2>{0.330730081f, 0.781976342f},
-std::array<float,2>{0.998814702f, 0.36716187f},
-std::array<float,2>{0.139082134f, 0.187951684f},
-std::array<float,2>{0.703793705f, 0.665454686f},
-std::array<float,2>{0.0638262257f, 0.560921729f},
-std::array<float,2>{0.57046634f, 0.0973524079f},
-std::array<float,2>{0.481271923f, 0.46852392f},
-std::array<float,2>{0.855917871f, 0.908346236f},
-std::array<float,2>{0.192620024f, 0.986474156f},
-std::array<float,2>{0.686447382f, 0.397134006f},
-std::array<float,2>{0.260359198f, 0.0506212153f},
-std::array<float,2>{0.903797865f, 0.616505861f},
-std::array<float,2>{0.409814715f, 0.694369912f},
-std::array<float,2>{0.754106641f, 0.146273196f},
-std::array<float,2>{0.0526408181f, 0.288565099f},
-std::array<float,2>{0.501137614f, 0.832776248f},
-std::array<float,2>{0.266088217f, 0.960684717f},
-std::array<float,2>{0.890316784f, 0.437270641f},
-std::array<float,2>{0.21601443f, 0.00433537923f},
-std::array<float,2>{0.656966031f, 0.577931106f},
-std::array<float,2>{0.0330982432f, 0.746456027f},
-std::array<float,2>{0.531179607f, 0.16720669f},
-std::array<float,2>{0.427596092f, 0.273197621f},
-std::array<float,2>{0.777215064f, 0.85953784f},
-std::array<float,2>{0.147398382f, 0.763712764f},
-std::array<float,2>{0.701880097f, 0.338927448f},
-std::array<float,2>{0.327851772f, 0.244737312f},
-std::array<float,2>{0.981237292f, 0.628041267f},
-std::array<float,2>{0.48846814f, 0.500220597f},
-std::array<float,2>{0.86785084f, 0.0814085081f},
-std::array<float,2>{0.0814154297f, 0.494693249f},
-std::array<float,2>{0.580710351f, 0.904678524f},
-std::array<float,2>{0.375818521f, 0.824030221f},
-std::array<float,2>{0.795605958f, 0.309610009f},
-std::array<float,2>{0.0104898056f, 0.127520233f},
-std::array<float,2>{0.554993987f, 0.705898523f},
-std::array<float,2>{0.232171372f, 0.605590284f},
-std::array<float,2>{0.653593481f, 0.0400877111f},
-std::array<float,2>{0.282335669f, 0.378448933f},
-std::array<float,2>{0.911754072f, 0.969308913f},
-std::array<float,2>{0.115777984f, 0.932755351f},
-std::array<float,2>{0.62186861f, 0.441598445f},
-std::array<float,2>{0.446994871f, 0.11422313f},
-std::array<float,2>{0.834128857f, 0.538052499f},
-std::array<float,2>{0.343957335f, 0.674422503f},
-std::array<float,2>{0.942223489f, 0.214905381f},
-std::array<float,2>{0.174242526f, 0.346419394f},
-std::array<float,2>{0.738333702f, 0.806048632f},
-std::array<float,2>{0.436929554f, 0.983394682f},
-std::array<float,2>{0.773000538f, 0.38846603f},
-std::array<float,2>{0.0422116518f, 0.0319631472f},
-std::array<float,2>{0.516103685f, 0.598590255f},
-std::array<float,2>{0.203474462f, 0.7164222f},
-std::array<float,2>{0.669283032f, 0.133607745f},
-std::array<float,2>{0.276886255f, 0.302308589f},
-std::array<float,2>{0.878205717f, 0.812974036f},
-std::array<float,2>{0.0931308717f, 0.800643265f},
-std::array<float,2>{0.588652849f, 0.356001318f},
-std::array<float,2>{0.493770897f, 0.209720522f},
-std::array<float,2>{0.863142729f, 0.682518244f},
-std::array<float,2>{0.314670473f, 0.546382487f},
-std::array<float,2>{0.969763696f, 0.117501222f},
-std::array<float,2>{0.151545286f, 0.450787127f},
-std::array<float,2>{0.692859352f, 0.9266873f},
-std::array<float,2>{0.29048565f, 0.872854471f},
-std::array<float,2>{0.92166549f, 0.275475532f},
-std::array<float,2>{0.221262813f, 0.158546552f},
-std::array<float,2>{0.646624088f, 0.740658462f},
-std::array<float,2>{0.0055070417f, 0.563244402f},
-std::array<float,2>{0.554149151f, 0.00916477107f},
-std::array<float,2>{0.38991794f, 0.425342679f},
-std::array<float,2>{0.786381245f, 0.963451862f},
-std::array<float,2>{0.18641901f, 0.894378424f},
-std::array<float,2>{0.749683261f, 0.486197144f},
-std::array<float,2>{0.353360713f, 0.0884604976f},
-std::array<float,2>{0.947535157f, 0.509916902f},
-std::array<float,2>{0.442451298f, 0.632969201f},
-std::array<float,2>{0.83700788f, 0.237639874f},
-std::array<float,2>{0.123385832f, 0.332511812f},
-std::array<float,2>{0.616392374f, 0.754789054f},
-std::array<float,2>{0.367641509f, 0.920400739f},
-std::array<float,2>{0.953470707f, 0.456593096f},
-std::array<float,2>{0.159076214f, 0.107309923f},
-std::array<float,2>{0.731611133f, 0.552859366f},
-std::array<float,2>{0.0966811106f, 0.663394451f},
-std::array<float,2>{0.599176645f, 0.195342973f},
-std::array<float,2>{0.464595467f, 0.373631835f},
-std::array<float,2>{0.824801803f, 0.791626036f},
-std::array<float,2>{0.240141124f, 0.84181881f},
-std::array<float,2>{0.640614688f, 0.294106483f},
-std::array<float,2>{0.301050186f, 0.149863571f},
-std::array<float,2>{0.925613403f, 0.702934027f},
-std::array<float,2>{0.403389782f, 0.61753118f},
-std::array<float,2>{0.803563297f, 0.0592535511f},
-std::array<float,2>{0.0233026464f, 0.399424464f},
-std::array<float,2>{0.538494766f, 0.992779553f},
-std::array<float,2>{0.474375308f, 0.780847609f},
-std::array<float,2>{0.844653904f, 0.317816705f},
-std::array<float,2>{0.0725944042f, 0.226529181f},
-std::array<float,2>{0.564381838f, 0.655859172f},
-std::array<float,2>{0.125457436f, 0.521228969f},
-std::array<float,2>{0.717918396f, 0.076215595f},
-std::array<float,2>{0.341334373f, 0.479410559f},
-std::array<float,2>{0.991090655f, 0.880001664f},
-std::array<float,2>{0.0604261868f, 0.945344448f},
-std::array<float,2>{0.514304459f, 0.408068627f},
-std::array<float,2>{0.420669407f, 0.0157282539f},
-std::array<float,2>{0.765429735f, 0.589950204f},
-std::array<float,2>{0.257715255f, 0.731630266f},
-std::array<float,2>{0.893095136f, 0.171963587f},
-std::array<float,2>{0.196902961f, 0.250201255f},
-std::array<float,2>{0.672704637f, 0.853951931f},
-std::array<float,2>{0.410700589f, 0.897844851f},
-std::array<float,2>{0.750356138f, 0.491746008f},
-std::array<float,2>{0.0470607243f, 0.0937091336f},
-std::array<float,2>{0.507494628f, 0.511719048f},
-std::array<float,2>{0.187999293f, 0.638528347f},
-std::array<float,2>{0.679902077f, 0.241029471f},
-std::array<float,2>{0.265012592f, 0.328627259f},
-std::array<float,2>{0.901396573f, 0.75032264f},
-std::array<float,2>{0.0675994903f, 0.867691576f},
-std::array<float,2>{0.577783644f, 0.280636728f},
-std::array<float,2>{0.477603853f, 0.161387533f},
-std::array<float,2>{0.852757633f, 0.7357108f},
-std::array<float,2>{0.333297104f, 0.570091426f},
-std::array<float,2>{0.993788898f, 0.0141671496f},
-std::array<float,2>{0.133091599f, 0.428862751f},
-std::array<float,2>{0.710179627f, 0.965489507f},
-std::array<float,2>{0.312281519f, 0.801950872f},
-std::array<float,2>{0.930380702f, 0.354395211f},
-std::array<float,2>{0.248704299f, 0.20521754f},
-std::array<float,2>{0.627535403f, 0.685281038f},
-std::array<float,2>{0.0269269254f, 0.542454243f},
-std::array<float,2>{0.545872867f, 0.121922784f},
-std::array<float,2>{0.39822495f, 0.4455235f},
-std::array<float,2>{0.807259977f, 0.922957063f},
-std::array<float,2>{0.171851188f, 0.977505505f},
-std::array<float,2>{0.723964512f, 0.383533329f},
-std::array<float,2>{0.366246283f, 0.0379592739f},
-std::array<float,2>{0.962270021f, 0.59393537f},
-std::array<float,2>{0.454384416f, 0.714616776f},
-std::array<float,2>{0.813635409f, 0.138730019f},
-std::array<float,2>{0.105933942f, 0.29963401f},
-std::array<float,2>{0.609343052f, 0.817828238f},
-std::array<float,2>{0.349280238f, 0.94970119f},
-std::array<float,2>{0.938944459f, 0.411090046f},
-std::array<float,2>{0.178698808f, 0.0222639982f},
-std::array<float,2>{0.736581862f, 0.589834034f},
-std::array<float,2>{0.110159926f, 0.728946328f},
-std::array<float,2>{0.619398594f, 0.177169472f},
-std::array<float,2>{0.44936499f, 0.254231036f},
-std::array<float,2>{0.829545498f, 0.857441843f},
-std::array<float,2>{0.228875741f, 0.775217712f},
-std::array<float,2>{0.650302529f, 0.315550774f},
-std::array<float,2>{0.288787007f, 0.218803197f},
-std::array<float,2>{0.909973621f, 0.651115894f},
-std::array<float,2>{0.381815463f, 0.518060982f},
-std::array<float,2>{0.789316118f, 0.0718836039f},
-std::array<float,2>{0.0150365829f, 0.482227266f},
-std::array<float,2>{0.5615834f, 0.877145648f},
-std::array<float,2>{0.488217264f, 0.839222372f},
-std::array<float,2>{0.874894321f, 0.28983438f},
-std::array<float,2>{0.0846120268f, 0.155088589f},
-std::array<float,2>{0.58475554f, 0.695874393f},
-std::array<float,2>{0.143165305f, 0.622129321f},
-std::array<float,2>{0.698082805f, 0.0559688173f},
-std::array<float,2>{0.322304904f, 0.405664951f},
-std::array<float,2>{0.980234265f, 0.996702373f},
-std::array<float,2>{0.0352334455f, 0.915300846f},
-std::array<float,2>{0.525545061f, 0.459110558f},
-std::array<float,2>{0.422240496f, 0.103966102f},
-std::array<float,2>{0.778492749f, 0.549241543f},
-std::array<float,2>{0.272172689f, 0.659915626f},
-std::array<float,2>{0.884058237f, 0.20085679f},
-std::array<float,2>{0.211816996f, 0.369602144f},
-std::array<float,2>{0.662707388f, 0.793469608f},
-std::array<float,2>{0.440723896f, 0.988845646f},
-std::array<float,2>{0.840602875f, 0.392750412f},
-std::array<float,2>{0.118538141f, 0.0511859246f},
-std::array<float,2>{0.612499893f, 0.611010075f},
-std::array<float,2>{0.181861281f, 0.688943326f},
-std::array<float,2>{0.743761182f, 0.143979445f},
-std::array<float,2>{0.359003067f, 0.282943934f},
-std::array<float,2>{0.950450838f, 0.83130157f},
-std::array<float,2>{0.0010822016f, 0.786769032f},
-std::array<float,2>{0.549740076f, 0.359617919f},
-std::array<float,2>{0.383386314f, 0.194609076f},
-std::array<float,2>{0.783019006f, 0.668904305f},
-std::array<float,2>{0.294496834f, 0.557161689f},
-std::array<float,2>{0.914512932f, 0.100721821f},
-std::array<float,2>{0.225798503f, 0.460939974f},
-std::array<float,2>{0.642124712f, 0.912293553f},
-std::array<float,2>{0.320208251f, 0.850382149f},
-std::array<float,2>{0.97382468f, 0.261443645f},
-std::array<float,2>{0.155244216f, 0.180300742f},
-std::array<float,2>{0.687860787f, 0.724916637f},
-std::array<float,2>{0.0892168507f, 0.578313291f},
-std::array<float,2>{0.589889944f, 0.0248858668f},
-std::array<float,2>{0.499845743f, 0.415734053f},
-std::array<float,2>{0.864041209f, 0.944224834f},
-std::array<float,2>{0.207442284f, 0.885025382f},
-std::array<float,2>{0.665321648f, 0.475261539f},
-std::array<float,2>{0.280736208f, 0.0634542108f},
-std::array<float,2>{0.881511271f, 0.528234243f},
-std::array<float,2>{0.430027068f, 0.644331634f},
-std::array<float,2>{0.769049823f, 0.232885629f},
-std::array<float,2>{0.0447827838f, 0.325973034f},
-std::array<float,2>{0.519862771f, 0.768149793f},
-std::array<float,2>{0.250740737f, 0.934052885f},
-std::array<float,2>{0.897213399f, 0.437537819f},
-std::array<float,2>{0.199971557f, 0.109672375f},
-std::array<float,2>{0.677575588f, 0.534210026f},
-std::array<float,2>{0.0564301088f, 0.678661227f},
-std::array<float,2>{0.509133399f, 0.212984711f},
-std::array<float,2>{0.41580534f, 0.348132491f},
-std::array<float,2>{0.759658217f, 0.810950816f},
-std::array<float,2>{0.132485703f, 0.825090408f},
-std::array<float,2>{0.711199164f, 0.307358801f},
-std::array<float,2>{0.338260949f, 0.132348016f},
-std::array<float,2>{0.988174498f, 0.709783554f},
-std::array<float,2>{0.470166117f, 0.604717016f},
-std::array<float,2>{0.84979713f, 0.0437834077f},
-std::array<float,2>{0.0747329965f, 0.379246503f},
-std::array<float,2>{0.570083082f, 0.97406435f},
-std::array<float,2>{0.399939388f, 0.758861244f},
-std::array<float,2>{0.797170937f, 0.34297961f},
-std::array<float,2>{0.0181659106f, 0.249172509f},
-std::array<float,2>{0.53127265f, 0.630684197f},
-std::array<float,2>{0.237137958f, 0.506229281f},
-std::array<float,2>{0.63296324f, 0.0827234089f},
-std::array<float,2>{0.297958046f, 0.497677416f},
-std::array<float,2>{0.926594496f, 0.899188995f},
-std::array<float,2>{0.101030819f, 0.954773724f},
-std::array<float,2>{0.594685435f, 0.430360883f},
-std::array<float,2>{0.466336131f, 0.00342889107f},
-std::array<float,2>{0.821564019f, 0.570897043f},
-std::array<float,2>{0.373742282f, 0.744004667f},
-std::array<float,2>{0.96080929f, 0.168442205f},
-std::array<float,2>{0.163368583f, 0.26839605f},
-std::array<float,2>{0.72933346f, 0.86377281f},
-std::array<float,2>{0.484003067f, 0.90708679f},
-std::array<float,2>{0.857537329f, 0.466153383f},
-std::array<float,2>{0.064575538f, 0.0956122577f},
-std::array<float,2>{0.573001146f, 0.559355199f},
-std::array<float,2>{0.13817656f, 0.667202294f},
-std::array<float,2>{0.706416428f, 0.190637678f},
-std::array<float,2>{0.32913509f, 0.364978164f},
-std::array<float,2>{0.997027755f, 0.784475565f},
-std::array<float,2>{0.0538145378f, 0.834816813f},
-std::array<float,2>{0.503380358f, 0.286133498f},
-std::array<float,2>{0.408070594f, 0.147823885f},
-std::array<float,2>{0.756321311f, 0.691473603f},
-std::array<float,2>{0.25946334f, 0.613508046f},
-std::array<float,2>{0.905991852f, 0.048076041f},
-std::array<float,2>{0.193718091f, 0.395927101f},
-std::array<float,2>{0.683859646f, 0.985441744f},
-std::array<float,2>{0.362994432f, 0.771248102f},
-std::array<float,2>{0.968159974f, 0.321951777f},
-std::array<float,2>{0.167837158f, 0.228966624f},
-std::array<float,2>{0.71935457f, 0.645065248f},
-std::array<float,2>{0.105391875f, 0.525985599f},
-std::array<float,2>{0.603800774f, 0.0693549588f},
-std::array<float,2>{0.459169477f, 0.469768971f},
-std::array<float,2>{0.819366395f, 0.887640774f},
-std::array<float,2>{0.245414972f, 0.940656841f},
-std::array<float,2>{0.629958987f, 0.419316977f},
-std::array<float,2>{0.307859838f, 0.0297759622f},
-std::array<float,2>{0.934280455f, 0.585873723f},
-std::array<float,2>{0.392807394f, 0.719408154f},
-std::array<float,2>{0.80990231f, 0.187433288f},
-std::array<float,2>{0.0295704529f, 0.265319645f},
-std::array<float,2>{0.539470196f, 0.846018851f},
-std::array<float,2>{0.28497687f, 0.971905947f},
-std::array<float,2>{0.912132978f, 0.376266211f},
-std::array<float,2>{0.233632088f, 0.042448774f},
-std::array<float,2>{0.656159937f, 0.608232498f},
-std::array<float,2>{0.00795287825f, 0.703766823f},
-std::array<float,2>{0.556834221f, 0.126594111f},
-std::array<float,2>{0.378648072f, 0.311243474f},
-std::array<float,2>{0.794014752f, 0.821726143f},
-std::array<float,2>{0.173371941f, 0.806692004f},
-std::array<float,2>{0.741331518f, 0.345429122f},
-std::array<float,2>{0.34596768f, 0.21719043f},
-std::array<float,2>{0.944711685f, 0.67360574f},
-std::array<float,2>{0.4473252f, 0.536386073f},
-std::array<float,2>{0.832618177f, 0.115273111f},
-std::array<float,2>{0.114540182f, 0.443715602f},
-std::array<float,2>{0.623231649f, 0.93000114f},
-std::array<float,2>{0.428557009f, 0.863064826f},
-std::array<float,2>{0.774728537f, 0.271031916f},
-std::array<float,2>{0.0347729661f, 0.165039659f},
-std::array<float,2>{0.527449071f, 0.749877572f},
-std::array<float,2>{0.218647286f, 0.576076031f},
-std::array<float,2>{0.658807337f, 0.00670621824f},
-std::array<float,2>{0.267635316f, 0.434712112f},
-std::array<float,2>{0.888324499f, 0.958545625f},
-std::array<float,2>{0.0790046453f, 0.90324676f},
-std::array<float,2>{0.578549564f, 0.492932767f},
-std::array<float,2>{0.491771162f, 0.0787819624f},
-std::array<float,2>{0.869233131f, 0.502969682f},
-std::array<float,2>{0.325336039f, 0.626301587f},
-std::array<float,2>{0.983338952f, 0.242903933f},
-std::array<float,2>{0.146199211f, 0.336711586f},
-std::array<float,2>{0.701106191f, 0.762351453f},
-std::array<float,2>{0.386847258f, 0.962692559f},
-std::array<float,2>{0.787226558f, 0.423563749f},
-std::array<float,2>{0.00748017244f, 0.0106627047f},
-std::array<float,2>{0.552690446f, 0.566317379f},
-std::array<float,2>{0.220690444f, 0.740136325f},
-std::array<float,2>{0.646191359f, 0.158149317f},
-std::array<float,2>{0.291552156f, 0.274820834f},
-std::array<float,2>{0.918761671f, 0.873342276f},
-std::array<float,2>{0.121238075f, 0.756468832f},
-std::array<float,2>{0.613396227f, 0.335336f},
-std::array<float,2>{0.444548011f, 0.234522998f},
-std::array<float,2>{0.839201391f, 0.635659814f},
-std::array<float,2>{0.354727298f, 0.508317351f},
-std::array<float,2>{0.946680665f, 0.087671645f},
-std::array<float,2>{0.184150875f, 0.488192916f},
-std::array<float,2>{0.74642545f, 0.891551375f},
-std::array<float,2>{0.274878472f, 0.81504029f},
-std::array<float,2>{0.876662493f, 0.30467239f},
-std::array<float,2>{0.206274465f, 0.135273427f},
-std::array<float,2>{0.670467138f, 0.718650818f},
-std::array<float,2>{0.0395784453f, 0.60029465f},
-std::array<float,2>{0.518205881f, 0.0337270796f},
-std::array<float,2>{0.433816701f, 0.389619708f},
-std::array<float,2>{0.770957887f, 0.981937051f},
-std::array<float,2>{0.149407968f, 0.9283939f},
-std::array<float,2>{0.693478942f, 0.45157975f},
-std::array<float,2>{0.313707292f, 0.119176745f},
-std::array<float,2>{0.972015858f, 0.54387784f},
-std::array<float,2>{0.49457413f, 0.681067824f},
-std::array<float,2>{0.860084891f, 0.208268642f},
-std::array<float,2>{0.0912216827f, 0.35768804f},
-std::array<float,2>{0.587745011f, 0.79788363f},
-std::array<float,2>{0.34215799f, 0.88203311f},
-std::array<float,2>{0.989934683f, 0.476717293f},
-std::array<float,2>{0.127548009f, 0.0753190145f},
-std::array<float,2>{0.716294289f, 0.522502601f},
-std::array<float,2>{0.0711550191f, 0.652452707f},
-std::array<float,2>{0.566083074f, 0.223160431f},
-std::array<float,2>{0.475862294f, 0.319513202f},
-std::array<float,2>{0.846761942f, 0.778253436f},
-std::array<float,2>{0.198045105f, 0.853296399f},
-std::array<float,2>{0.673841536f, 0.253795892f},
-std::array<float,2>{0.255678982f, 0.175525755f},
-std::array<float,2>{0.891309142f, 0.73358047f},
-std::array<float,2>{0.419562221f, 0.59370786f},
-std::array<float,2>{0.762006581f, 0.0180124324f},
-std::array<float,2>{0.0619833693f, 0.408763498f},
-std::array<float,2>{0.513430595f, 0.947981775f},
-std::array<float,2>{0.461268097f, 0.790090919f},
-std::array<float,2>{0.826643288f, 0.372488886f},
-std::array<float,2>{0.094006367f, 0.197592646f},
-std::array<float,2>{0.599918246f, 0.661451578f},
-std::array<float,2>{0.157422796f, 0.552009225f},
-std::array<float,2>{0.733391285f, 0.108309045f},
-std::array<float,2>{0.369871676f, 0.453283608f},
-std::array<float,2>{0.956510842f, 0.918133438f},
-std::array<float,2>{0.0206862465f, 0.994984567f},
-std::array<float,2>{0.537023604f, 0.401607007f},
-std::array<float,2>{0.404399395f, 0.0607648008f},
-std::array<float,2>{0.801835537f, 0.619397342f},
-std::array<float,2>{0.302860647f, 0.699546754f},
-std::array<float,2>{0.923372626f, 0.150568113f},
-std::array<float,2>{0.240603134f, 0.295673102f},
-std::array<float,2>{0.638509333f, 0.840633869f},
-std::array<float,2>{0.423555464f, 0.916358232f},
-std::array<float,2>{0.77780211f, 0.457307369f},
-std::array<float,2>{0.0368147008f, 0.102387115f},
-std::array<float,2>{0.527331829f, 0.548675656f},
-std::array<float,2>{0.212027445f, 0.657089353f},
-std::array<float,2>{0.663626373f, 0.202051163f},
-std::array<float,2>{0.272651523f, 0.36870876f},
-std::array<float,2>{0.88299644f, 0.795462966f},
-std::array<float,2>{0.0857748464f, 0.837595403f},
-std::array<float,2>{0.584996104f, 0.291572243f},
-std::array<float,2>{0.48718679f, 0.152809799f},
-std::array<float,2>{0.873865068f, 0.697571695f},
-std::array<float,2>{0.323480517f, 0.624701679f},
-std::array<float,2>{0.979306638f, 0.0577374138f},
-std::array<float,2>{0.143905923f, 0.403175473f},
-std::array<float,2>{0.69857806f, 0.999123573f},
-std::array<float,2>{0.287709236f, 0.775780141f},
-std::array<float,2>{0.90851438f, 0.314236552f},
-std::array<float,2>{0.229628727f, 0.221574649f},
-std::array<float,2>{0.648453295f, 0.649374127f},
-std::array<float,2>{0.0138818147f, 0.515915751f},
-std::array<float,2>{0.561285138f, 0.0739236549f},
-std::array<float,2>{0.38196671f, 0.483038634f},
-std::array<float,2>{0.790228009f, 0.875579298f},
-std::array<float,2>{0.179414108f, 0.952366889f},
-std::array<float,2>{0.738114119f, 0.413400441f},
-std::array<float,2>{0.347686142f, 0.02095153f},
-std::array<float,2>{0.938273668f, 0.587123752f},
-std::array<float,2>{0.450290471f, 0.726928294f},
-std::array<float,2>{0.828643262f, 0.177956864f},
-std::array<float,2>{0.110566773f, 0.25704658f},
-std::array<float,2>{0.620383918f, 0.856997252f},
-std::array<float,2>{0.365741283f, 0.979495943f},
-std::array<float,2>{0.961241841f, 0.385483742f},
-std::array<float,2>{0.170270562f, 0.0366830751f},
-std::array<float,2>{0.723220229f, 0.597416997f},
-std::array<float,2>{0.106684849f, 0.711285174f},
-std::array<float,2>{0.608079791f, 0.137402833f},
-std::array<float,2>{0.453184813f, 0.297469825f},
-std::array<float,2>{0.812763572f, 0.820092738f},
-std::array<float,2>{0.249721155f, 0.802836955f},
-std::array<float,2>{0.62840414f, 0.35318476f},
-std::array<float,2>{0.31084761f, 0.204669952f},
-std::array<float,2>{0.930926502f, 0.685949504f},
-std::array<float,2>{0.396750867f, 0.540943742f},
-std::array<float,2>{0.80787009f, 0.12347956f},
-std::array<float,2>{0.0261400994f, 0.448675394f},
-std::array<float,2>{0.546214342f, 0.924458325f},
-std::array<float,2>{0.476894259f, 0.870812416f},
-std::array<float,2>{0.852286041f, 0.277780324f},
-std::array<float,2>{0.0665108934f, 0.163545653f},
-std::array<float,2>{0.576220751f, 0.737407386f},
-std::array<float,2>{0.133854762f, 0.567434371f},
-std::array<float,2>{0.709781289f, 0.0121905915f},
-std::array<float,2>{0.332323045f, 0.427011192f},
-std::array<float,2>{0.99271363f, 0.968340874f},
-std::array<float,2>{0.048470784f, 0.895798564f},
-std::array<float,2>{0.506398976f, 0.489344716f},
-std::array<float,2>{0.411297292f, 0.090675503f},
-std::array<float,2>{0.751429319f, 0.515075862f},
-std::array<float,2>{0.263747007f, 0.640528381f},
-std::array<float,2>{0.900959373f, 0.239825994f},
-std::array<float,2>{0.189420834f, 0.331255853f},
-std::array<float,2>{0.681446075f, 0.752429664f},
-std::array<float,2>{0.465583056f, 0.95580399f},
-std::array<float,2>{0.820333898f, 0.432872117f},
-std::array<float,2>{0.100533068f, 0.00100843678f},
-std::array<float,2>{0.595375061f, 0.574061513f},
-std::array<float,2>{0.162622407f, 0.746065319f},
-std::array<float,2>{0.730407298f, 0.17173028f},
-std::array<float,2>{0.374275655f, 0.266089618f},
-std::array<float,2>{0.959911406f, 0.867105246f},
-std::array<float,2>{0.0190045126f, 0.761388779f},
-std::array<float,2>{0.532496989f, 0.340889692f},
-std::array<float,2>{0.399280041f, 0.246176362f},
-std::array<float,2>{0.798501968f, 0.631652951f},
-std::array<float,2>{0.297734261f, 0.50493902f},
-std::array<float,2>{0.92705369f, 0.0858784392f},
-std::array<float,2>{0.237650052f, 0.499488652f},
-std::array<float,2>{0.634591997f, 0.900528491f},
-std::array<float,2>{0.339795351f, 0.826778114f},
-std::array<float,2>{0.98637557f, 0.30558902f},
-std::array<float,2>{0.131292596f, 0.12922065f},
-std::array<float,2>{0.712267935f, 0.707731307f},
-std::array<float,2>{0.075555779f, 0.601613998f},
-std::array<float,2>{0.568553507f, 0.0464482717f},
-std::array<float,2>{0.469191402f, 0.381811291f},
-std::array<float,2>{0.851466894f, 0.976023972f},
-std::array<float,2>{0.200223699f, 0.936599553f},
-std::array<float,2>{0.675882936f, 0.441282123f},
-std::array<float,2>{0.251746953f, 0.112086505f},
-std::array<float,2>{0.898002982f, 0.531302035f},
-std::array<float,2>{0.415007532f, 0.677426577f},
-std::array<float,2>{0.757968247f, 0.212857917f},
-std::array<float,2>{0.0548438132f, 0.350247979f},
-std::array<float,2>{0.507911742f, 0.810087442f},
-std::array<float,2>{0.279679954f, 0.883630633f},
-std::array<float,2>{0.881844461f, 0.474393576f},
-std::array<float,2>{0.2084876f, 0.0659685731f},
-std::array<float,2>{0.664499521f, 0.529681623f},
-std::array<float,2>{0.0433623344f, 0.642071187f},
-std::array<float,2>{0.520717263f, 0.231082737f},
-std::array<float,2>{0.431208074f, 0.327413559f},
-std::array<float,2>{0.768014908f, 0.76585567f},
-std::array<float,2>{0.155785814f, 0.848856866f},
-std::array<float,2>{0.689123988f, 0.258306772f},
-std::array<float,2>{0.318401396f, 0.181976825f},
-std::array<float,2>{0.972864509f, 0.723174393f},
-std::array<float,2>{0.498917401f, 0.580121815f},
-std::array<float,2>{0.864400506f, 0.0267038848f},
-std::array<float,2>{0.0886487514f, 0.416846544f},
-std::array<float,2>{0.591029763f, 0.941789508f},
-std::array<float,2>{0.383874983f, 0.788329363f},
-std::array<float,2>{0.781864762f, 0.363083214f},
-std::array<float,2>{0.000498469453f, 0.192615971f},
-std::array<float,2>{0.550097466f, 0.671474278f},
-std::array<float,2>{0.225458339f, 0.555653155f},
-std::array<float,2>{0.641204536f, 0.0991802439f},
-std::array<float,2>{0.293045014f, 0.464071959f},
-std::array<float,2>{0.915768266f, 0.912027836f},
-std::array<float,2>{0.117906742f, 0.991566241f},
-std::array<float,2>{0.612065732f, 0.39193818f},
-std::array<float,2>{0.439538062f, 0.0532996915f},
-std::array<float,2>{0.84086442f, 0.612718582f},
-std::array<float,2>{0.357673347f, 0.690532207f},
-std::array<float,2>{0.949509799f, 0.142561421f},
-std::array<float,2>{0.182685003f, 0.284485966f},
-std::array<float,2>{0.742791772f, 0.829509437f},
-std::array<float,2>{0.490672737f, 0.906007648f},
-std::array<float,2>{0.870771289f, 0.495402604f},
-std::array<float,2>{0.079614237f, 0.0805456042f},
-std::array<float,2>{0.579565346f, 0.501867115f},
-std::array<float,2>{0.145316735f, 0.627469242f},
-std::array<float,2>{0.699793994f, 0.245512739f},
-std::array<float,2>{0.324339986f, 0.338153511f},
-std::array<float,2>{0.984003186f, 0.764784634f},
-std::array<float,2>{0.0339711979f, 0.860933304f},
-std::array<float,2>{0.528535903f, 0.271902233f},
-std::array<float,2>{0.429675549f, 0.166369706f},
-std::array<float,2>{0.773878157f, 0.747642457f},
-std::array<float,2>{0.26920405f, 0.576381147f},
-std::array<float,2>{0.88686043f, 0.00492278766f},
-std::array<float,2>{0.217141181f, 0.436077952f},
-std::array<float,2>{0.659613907f, 0.959439814f},
-std::array<float,2>{0.347530961f, 0.805524528f},
-std::array<float,2>{0.943886399f, 0.34757784f},
-std::array<float,2>{0.172628075f, 0.216488302f},
-std::array<float,2>{0.740710199f, 0.674889982f},
-std::array<float,2>{0.113745779f, 0.538964331f},
-std::array<float,2>{0.624883652f, 0.11446584f},
-std::array<float,2>{0.448517382f, 0.442948729f},
-std::array<float,2>{0.833225608f, 0.932276607f},
-std::array<float,2>{0.232505009f, 0.969950855f},
-std::array<float,2>{0.654848039f, 0.377351731f},
-std::array<float,2>{0.28333351f, 0.0394071303f},
-std::array<float,2>{0.91334182f, 0.607234597f},
-std::array<float,2>{0.377657056f, 0.70624274f},
-std::array<float,2>{0.793079197f, 0.128648266f},
-std::array<float,2>{0.00930244476f, 0.309024006f},
-std::array<float,2>{0.558127642f, 0.823223174f},
-std::array<float,2>{0.30714336f, 0.938135147f},
-std::array<float,2>{0.935411811f, 0.420937955f},
-std::array<float,2>{0.244456038f, 0.0291855093f},
-std::array<float,2>{0.629266798f, 0.583825767f},
-std::array<float,2>{0.0308625028f, 0.722099185f},
-std::array<float,2>{0.540533423f, 0.184446275f},
-std::array<float,2>{0.394209355f, 0.262074202f},
-std::array<float,2>{0.809039295f, 0.843853652f},
-std::array<float,2>{0.166808307f, 0.772916615f},
-std::array<float,2>{0.720420241f, 0.322449386f},
-std::array<float,2>{0.36226061f, 0.227411315f},
-std::array<float,2>{0.967422366f, 0.647713482f},
-std::array<float,2>{0.460027516f, 0.524471581f},
-std::array<float,2>{0.819146633f, 0.0677316263f},
-std::array<float,2>{0.103895999f, 0.472508371f},
-std::array<float,2>{0.605104208f, 0.890123606f},
-std::array<float,2>{0.406567633f, 0.833140075f},
-std::array<float,2>{0.756882012f, 0.287541538f},
-std::array<float,2>{0.0537104644f, 0.145179853f},
-std::array<float,2>{0.502480447f, 0.693382442f},
-std::array<float,2>{0.194519237f, 0.615522265f},
-std::array<float,2>{0.684899688f, 0.0497977622f},
-std::array<float,2>{0.258325458f, 0.39804551f},
-std::array<float,2>{0.904611945f, 0.987745285f},
-std::array<float,2>{0.0663746372f, 0.909786165f},
-std::array<float,2>{0.573969841f, 0.467248321f},
-std::array<float,2>{0.482851535f, 0.0963356569f},
-std::array<float,2>{0.85909766f, 0.562138975f},
-std::array<float,2>{0.328562886f, 0.664775491f},
-std::array<float,2>{0.9976089f, 0.189255416f},
-std::array<float,2>{0.137527809f, 0.365954161f},
-std::array<float,2>{0.705561996f, 0.782660365f},
-std::array<float,2>{0.405292153f, 0.993609965f},
-std::array<float,2>{0.801544845f, 0.398747534f},
-std::array<float,2>{0.019746216f, 0.0604155548f},
-std::array<float,2>{0.53559655f, 0.619064331f},
-std::array<float,2>{0.24186343f, 0.701370955f},
-std::array<float,2>{0.636809945f, 0.148487389f},
-std::array<float,2>{0.304488003f, 0.293516785f},
-std::array<float,2>{0.922181189f, 0.842867732f},
-std::array<float,2>{0.095400624f, 0.792034447f},
-std::array<float,2>{0.601415992f, 0.374963015f},
-std::array<float,2>{0.462084115f, 0.197178707f},
-std::array<float,2>{0.827787757f, 0.662721217f},
-std::array<float,2>{0.370601684f, 0.554020166f},
-std::array<float,2>{0.955512166f, 0.106220774f},
-std::array<float,2>{0.156846553f, 0.455594361f},
-std::array<float,2>{0.733955204f, 0.921108305f},
-std::array<float,2>{0.254746437f, 0.85539782f},
-std::array<float,2>{0.891624928f, 0.251752853f},
-std::array<float,2>{0.198588118f, 0.173534185f},
-std::array<float,2>{0.675627172f, 0.731326044f},
-std::array<float,2>{0.0613972656f, 0.591542244f},
-std::array<float,2>{0.511942744f, 0.0173653178f},
-std::array<float,2>{0.418377846f, 0.406750649f},
-std::array<float,2>{0.762895584f, 0.946902633f},
-std::array<float,2>{0.128844038f, 0.87944597f},
-std::array<float,2>{0.715307713f, 0.480175674f},
-std::array<float,2>{0.343539029f, 0.0776971281f},
-std::array<float,2>{0.989075661f, 0.520386934f},
-std::array<float,2>{0.474717081f, 0.654768944f},
-std::array<float,2>{0.845896304f, 0.225111008f},
-std::array<float,2>{0.0722523704f, 0.316893667f},
-std::array<float,2>{0.564774632f, 0.779932201f},
-std::array<float,2>{0.312749982f, 0.927050948f},
-std::array<float,2>{0.970709622f, 0.450115681f},
-std::array<float,2>{0.149739608f, 0.118825801f},
-std::array<float,2>{0.695292354f, 0.545266628f},
-std::array<float,2>{0.0900623277f, 0.683421671f},
-std::array<float,2>{0.586836457f, 0.210766867f},
-std::array<float,2>{0.495167792f, 0.35679692f},
-std::array<float,2>{0.861173451f, 0.798839927f},
-std::array<float,2>{0.205243692f, 0.813616395f},
-std::array<float,2>{0.671327293f, 0.300801396f},
-std::array<float,2>{0.273555279f, 0.133960694f},
-std::array<float,2>{0.875148356f, 0.715136886f},
-std::array<float,2>{0.434819877f, 0.599376857f},
-std::array<float,2>{0.770445347f, 0.0330649167f},
-std::array<float,2>{0.0401322208f, 0.387234956f},
-std::array<float,2>{0.518649399f, 0.983961582f},
-std::array<float,2>{0.443653286f, 0.755694747f},
-std::array<float,2>{0.838185728f, 0.333378077f},
-std::array<float,2>{0.122574344f, 0.237095818f},
-std::array<float,2>{0.614757776f, 0.634303272f},
-std::array<float,2>{0.184992462f, 0.511368036f},
-std::array<float,2>{0.747871459f, 0.0896802321f},
-std::array<float,2>{0.354304373f, 0.485150933f},
-std::array<float,2>{0.946174741f, 0.893550396f},
-std::array<float,2>{0.00641951244f, 0.964839458f},
-std::array<float,2>{0.55173403f, 0.424669683f},
-std::array<float,2>{0.38814798f, 0.00866364595f},
-std::array<float,2>{0.788980782f, 0.564132929f},
-std::array<float,2>{0.292160928f, 0.741225243f},
-std::array<float,2>{0.919770181f, 0.159252986f},
-std::array<float,2>{0.219006181f, 0.27730754f},
-std::array<float,2>{0.644703627f, 0.87133348f},
-std::array<float,2>{0.379469246f, 0.878669858f},
-std::array<float,2>{0.791424751f, 0.48063761f},
-std::array<float,2>{0.013314805f, 0.0711585358f},
-std::array<float,2>{0.558996677f, 0.518848181f},
-std::array<float,2>{0.226805001f, 0.651896536f},
-std::array<float,2>{0.651258707f, 0.220324278f},
-std::array<float,2>{0.286675572f, 0.315419108f},
-std::array<float,2>{0.907576084f, 0.7735551f},
-std::array<float,2>{0.112653017f, 0.858740032f},
-std::array<float,2>{0.618921816f, 0.255659938f},
-std::array<float,2>{0.451210201f, 0.176491573f},
-std::array<float,2>{0.831764817f, 0.729742825f},
-std::array<float,2>{0.350153357f, 0.588069677f},
-std::array<float,2>{0.941108227f, 0.0226143878f},
-std::array<float,2>{0.177720308f, 0.411840051f},
-std::array<float,2>{0.734952211f, 0.950252056f},
-std::array<float,2>{0.269789517f, 0.794831157f},
-std::array<float,2>{0.884778678f, 0.370273858f},
-std::array<float,2>{0.213588476f, 0.200063974f},
-std::array<float,2>{0.661607504f, 0.659126818f},
-std::array<float,2>{0.0385763608f, 0.550655544f},
-std::array<float,2>{0.52478385f, 0.105021372f},
-std::array<float,2>{0.424007803f, 0.460267842f},
-std::array<float,2>{0.780499339f, 0.914342821f},
-std::array<float,2>{0.141285211f, 0.997374117f},
-std::array<float,2>{0.69538641f, 0.40455386f},
-std::array<float,2>{0.320884675f, 0.0552904457f},
-std::array<float,2>{0.976716399f, 0.621202409f},
-std::array<float,2>{0.484631747f, 0.696516871f},
-std::array<float,2>{0.871749818f, 0.155757457f},
-std::array<float,2>{0.0836233199f, 0.290865541f},
-std::array<float,2>{0.583001912f, 0.838281631f},
-std::array<float,2>{0.33404693f, 0.966743588f},
-std::array<float,2>{0.995653987f, 0.428279698f},
-std::array<float,2>{0.135882542f, 0.0152665572f},
-std::array<float,2>{0.708517551f, 0.569234192f},
-std::array<float,2>{0.0697456226f, 0.734597206f},
-std::array<float,2>{0.575528085f, 0.160590857f},
-std::array<float,2>{0.47934249f, 0.279510558f},
-std::array<float,2>{0.854563653f, 0.868941188f},
-std::array<float,2>{0.191013873f, 0.751426816f},
-std::array<float,2>{0.683424473f, 0.329866588f},
-std::array<float,2>{0.262245297f, 0.2421294f},
-std::array<float,2>{0.900194705f, 0.637031555f},
-std::array<float,2>{0.413296431f, 0.512752414f},
-std::array<float,2>{0.752701402f, 0.0926746428f},
-std::array<float,2>{0.0501859374f, 0.490397573f},
-std::array<float,2>{0.504380822f, 0.896726251f},
-std::array<float,2>{0.455932051f, 0.817347348f},
-std::array<float,2>{0.814773858f, 0.300445735f},
-std::array<float,2>{0.108593792f, 0.13994199f},
-std::array<float,2>{0.606424749f, 0.713454127f},
-std::array<float,2>{0.168519557f, 0.595285833f},
-std::array<float,2>{0.725232124f, 0.0390146859f},
-std::array<float,2>{0.364976048f, 0.384203851f},
-std::array<float,2>{0.963148475f, 0.978248119f},
-std::array<float,2>{0.0235501062f, 0.921881199f},
-std::array<float,2>{0.543998718f, 0.446924716f},
-std::array<float,2>{0.395758748f, 0.123028658f},
-std::array<float,2>{0.806080103f, 0.541272104f},
-std::array<float,2>{0.309509695f, 0.68400228f},
-std::array<float,2>{0.93337357f, 0.206527695f},
-std::array<float,2>{0.247561768f, 0.354570597f},
-std::array<float,2>{0.626685381f, 0.801107883f},
-std::array<float,2>{0.471491784f, 0.973007858f},
-std::array<float,2>{0.847987175f, 0.380320847f},
-std::array<float,2>{0.0767763406f, 0.0447441563f},
-std::array<float,2>{0.566954017f, 0.603974044f},
-std::array<float,2>{0.129315034f, 0.710011363f},
-std::array<float,2>{0.714207292f, 0.131411135f},
-std::array<float,2>{0.3365058f, 0.307738274f},
-std::array<float,2>{0.98561269f, 0.826020598f},
-std::array<float,2>{0.0569488034f, 0.811919391f},
-std::array<float,2>{0.511702657f, 0.349087954f},
-std::array<float,2>{0.416754246f, 0.213936433f},
-std::array<float,2>{0.761321425f, 0.678807616f},
-std::array<float,2>{0.25245285f, 0.533357918f},
-std::array<float,2>{0.895923018f, 0.110682972f},
-std::array<float,2>{0.201794028f, 0.439377725f},
-std::array<float,2>{0.679408729f, 0.934873104f},
-std::array<float,2>{0.371826798f, 0.865227222f},
-std::array<float,2>{0.958978534f, 0.269339681f},
-std::array<float,2>{0.160786018f, 0.169238284f},
-std::array<float,2>{0.727412879f, 0.742518842f},
-std::array<float,2>{0.0978232473f, 0.571698129f},
-std::array<float,2>{0.597458243f, 0.00262224278f},
-std::array<float,2>{0.466812819f, 0.430763364f},
-std::array<float,2>{0.823728919f, 0.95390296f},
-std::array<float,2>{0.236043453f, 0.900292456f},
-std::array<float,2>{0.635997593f, 0.497040123f},
-std::array<float,2>{0.299614012f, 0.08338774f},
-std::array<float,2>{0.928756833f, 0.506948829f},
-std::array<float,2>{0.400648028f, 0.629372239f},
-std::array<float,2>{0.798836112f, 0.248850688f},
-std::array<float,2>{0.0174082294f, 0.342186272f},
-std::array<float,2>{0.534608066f, 0.758549213f},
-std::array<float,2>{0.296298146f, 0.913858414f},
-std::array<float,2>{0.917281568f, 0.462560564f},
-std::array<float,2>{0.223644152f, 0.100326836f},
-std::array<float,2>{0.643298805f, 0.558080971f},
-std::array<float,2>{0.00380235887f, 0.669870317f},
-std::array<float,2>{0.547639787f, 0.194175094f},
-std::array<float,2>{0.386440426f, 0.360617071f},
-std::array<float,2>{0.783674657f, 0.786015034f},
-std::array<float,2>{0.180576041f, 0.830514967f},
-std::array<float,2>{0.745897412f, 0.281543285f},
-std::array<float,2>{0.35628137f, 0.143171251f},
-std::array<float,2>{0.952497184f, 0.687747121f},
-std::array<float,2>{0.438512743f, 0.609925568f},
-std::array<float,2>{0.841837287f, 0.0523501001f},
-std::array<float,2>{0.121019781f, 0.393942624f},
-std::array<float,2>{0.610050023f, 0.989992559f},
-std::array<float,2>{0.432849467f, 0.768675983f},
-std::array<float,2>{0.766174138f, 0.324848264f},
-std::array<float,2>{0.0455670096f, 0.234053224f},
-std::array<float,2>{0.521748304f, 0.6426844f},
-std::array<float,2>{0.21032533f, 0.528475881f},
-std::array<float,2>{0.666266859f, 0.0635601506f},
-std::array<float,2>{0.278535634f, 0.475761265f},
-std::array<float,2>{0.879032552f, 0.885805488f},
-std::array<float,2>{0.0874385387f, 0.945245087f},
-std::array<float,2>{0.593715489f, 0.414990872f},
-std::array<float,2>{0.497014076f, 0.0237583835f},
-std::array<float,2>{0.865936458f, 0.579815507f},
-std::array<float,2>{0.318317443f, 0.726145685f},
-std::array<float,2>{0.975925803f, 0.180815771f},
-std::array<float,2>{0.153942436f, 0.260641754f},
-std::array<float,2>{0.690481126f, 0.851044118f},
-std::array<float,2>{0.445797563f, 0.93068856f},
-std::array<float,2>{0.83506459f, 0.444417655f},
-std::array<float,2>{0.116494611f, 0.116593383f},
-std::array<float,2>{0.622071803f, 0.535195827f},
-std::array<float,2>{0.175336093f, 0.672304809f},
-std::array<float,2>{0.739599168f, 0.218558639f},
-std::array<float,2>{0.345338434f, 0.344111025f},
-std::array<float,2>{0.942886055f, 0.80822891f},
-std::array<float,2>{0.0110934936f, 0.820586383f},
-std::array<float,2>{0.555824816f, 0.312413126f},
-std::array<float,2>{0.376928151f, 0.1255254f},
-std::array<float,2>{0.796263635f, 0.704282165f},
-std::array<float,2>{0.282054782f, 0.608599424f},
-std::array<float,2>{0.911057353f, 0.0417841636f},
-std::array<float,2>{0.230865106f, 0.375638992f},
-std::array<float,2>{0.652956188f, 0.970857561f},
-std::array<float,2>{0.32648325f, 0.763661981f},
-std::array<float,2>{0.982102215f, 0.337696135f},
-std::array<float,2>{0.148135975f, 0.243391752f},
-std::array<float,2>{0.702611208f, 0.625622988f},
-std::array<float,2>{0.0809968933f, 0.502394855f},
-std::array<float,2>{0.581865609f, 0.0800745487f},
-std::array<float,2>{0.48968178f, 0.49375391f},
-std::array<float,2>{0.868562639f, 0.903347075f},
-std::array<float,2>{0.215606898f, 0.957602084f},
-std::array<float,2>{0.657693505f, 0.433695018f},
-std::array<float,2>{0.267328531f, 0.0075651505f},
-std::array<float,2>{0.889144778f, 0.574558556f},
-std::array<float,2>{0.426288366f, 0.748690426f},
-std::array<float,2>{0.775949717f, 0.16493471f},
-std::array<float,2>{0.0316811949f, 0.269766301f},
-std::array<float,2>{0.529503286f, 0.862197816f},
-std::array<float,2>{0.261641085f, 0.98487711f},
-std::array<float,2>{0.90287143f, 0.394998491f},
-std::array<float,2>{0.192306921f, 0.0469151624f},
-std::array<float,2>{0.68713361f, 0.615114689f},
-std::array<float,2>{0.0511084385f, 0.692781389f},
-std::array<float,2>{0.500507772f, 0.146630049f},
-std::array<float,2>{0.408776104f, 0.285791695f},
-std::array<float,2>{0.755838752f, 0.835639715f},
-std::array<float,2>{0.140591517f, 0.783717513f},
-std::array<float,2>{0.704185665f, 0.36378938f},
-std::array<float,2>{0.33154127f, 0.189913422f},
-std::array<float,2>{0.99910444f, 0.666612804f},
-std::array<float,2>{0.482287079f, 0.560509741f},
-std::array<float,2>{0.856570184f, 0.0947090909f},
-std::array<float,2>{0.0625988618f, 0.465663522f},
-std::array<float,2>{0.571711659f, 0.90751642f},
-std::array<float,2>{0.390639842f, 0.847092509f},
-std::array<float,2>{0.812247217f, 0.264155179f},
-std::array<float,2>{0.0292952172f, 0.186110169f},
-std::array<float,2>{0.542620301f, 0.720469415f},
-std::array<float,2>{0.24311249f, 0.584375322f},
-std::array<float,2>{0.631015897f, 0.0311542377f},
-std::array<float,2>{0.304809451f, 0.418462306f},
-std::array<float,2>{0.936236084f, 0.939562023f},
-std::array<float,2>{0.103282757f, 0.887695491f},
-std::array<float,2>{0.602387607f, 0.469452649f},
-std::array<float,2>{0.457075417f, 0.068817623f},
-std::array<float,2>{0.818175375f, 0.527241647f},
-std::array<float,2>{0.360516965f, 0.645812631f},
-std::array<float,2>{0.9663257f, 0.23000133f},
-std::array<float,2>{0.16571787f, 0.320976108f},
-std::array<float,2>{0.721572399f, 0.769672632f},
-std::array<float,2>{0.421540439f, 0.948246241f},
-std::array<float,2>{0.764143646f, 0.409940928f},
-std::array<float,2>{0.0592312813f, 0.0186488647f},
-std::array<float,2>{0.515358925f, 0.592538714f},
-std::array<float,2>{0.196122989f, 0.732773721f},
-std::array<float,2>{0.673349977f, 0.173843771f},
-std::array<float,2>{0.256655335f, 0.252175897f},
-std::array<float,2>{0.894210637f, 0.852046549f},
-std::array<float,2>{0.0741199031f, 0.779147208f},
-std::array<float,2>{0.563227057f, 0.318911076f},
-std::array<float,2>{0.472905666f, 0.224237353f},
-std::array<float,2>{0.844955981f, 0.654159486f},
-std::array<float,2>{0.339877546f, 0.522206783f},
-std::array<float,2>{0.991318941f, 0.0750495344f},
-std::array<float,2>{0.126503229f, 0.478000373f},
-std::array<float,2>{0.717133641f, 0.881314754f},
-std::array<float,2>{0.302711576f, 0.841061175f},
-std::array<float,2>{0.924629509f, 0.296433896f},
-std::array<float,2>{0.23921074f, 0.152217388f},
-std::array<float,2>{0.638809443f, 0.70090282f},
-std::array<float,2>{0.021505991f, 0.620687008f},
-std::array<float,2>{0.537714005f, 0.0618004911f},
-std::array<float,2>{0.402904123f, 0.401087672f},
-std::array<float,2>{0.803913593f, 0.99587059f},
-std::array<float,2>{0.159703419f, 0.91952157f},
-std::array<float,2>{0.730988562f, 0.454663575f},
-std::array<float,2>{0.368328542f, 0.109356701f},
-std::array<float,2>{0.954450488f, 0.551391542f},
-std::array<float,2>{0.463462263f, 0.660163343f},
-std::array<float,2>{0.825892448f, 0.198675036f},
-std::array<float,2>{0.0965657383f, 0.371543825f},
-std::array<float,2>{0.598137796f, 0.789315462f},
-std::array<float,2>{0.352229297f, 0.892192125f},
-std::array<float,2>{0.948938191f, 0.486485571f},
-std::array<float,2>{0.186643258f, 0.0861061439f},
-std::array<float,2>{0.748983085f, 0.508970439f},
-std::array<float,2>{0.124078065f, 0.636301816f},
-std::array<float,2>{0.61561799f, 0.235852033f},
-std::array<float,2>{0.442259669f, 0.33489418f},
-std::array<float,2>{0.836784959f, 0.757505715f},
-std::array<float,2>{0.22199437f, 0.874111474f},
-std::array<float,2>{0.647875428f, 0.274291277f},
-std::array<float,2>{0.289743185f, 0.157203659f},
-std::array<float,2>{0.9206236f, 0.73918891f},
-std::array<float,2>{0.389259309f, 0.564689219f},
-std::array<float,2>{0.78609097f, 0.010999931f},
-std::array<float,2>{0.00462477189f, 0.422725052f},
-std::array<float,2>{0.553208232f, 0.961589158f},
-std::array<float,2>{0.493023485f, 0.797193527f},
-std::array<float,2>{0.861550391f, 0.358919442f},
-std::array<float,2>{0.0920618922f, 0.207951948f},
-std::array<float,2>{0.589117408f, 0.680124104f},
-std::array<float,2>{0.151265711f, 0.544386446f},
-std::array<float,2>{0.692266047f, 0.120374471f},
-std::array<float,2>{0.31573537f, 0.453095734f},
-std::array<float,2>{0.968750119f, 0.929632246f},
-std::array<float,2>{0.0416145399f, 0.981016099f},
-std::array<float,2>{0.517412484f, 0.389898509f},
-std::array<float,2>{0.436396122f, 0.0349152796f},
-std::array<float,2>{0.771838188f, 0.601053417f},
-std::array<float,2>{0.275861621f, 0.717220128f},
-std::array<float,2>{0.877795935f, 0.136199653f},
-std::array<float,2>{0.204246387f, 0.303650051f},
-std::array<float,2>{0.66847527f, 0.816025615f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.774258792f, 0.487912625f},
-std::array<float,2>{0.0835420713f, 0.977827072f},
-std::array<float,2>{0.387161016f, 0.151082888f},
-std::array<float,2>{0.633952022f, 0.683919191f},
-std::array<float,2>{0.540380239f, 0.12122377f},
-std::array<float,2>{0.350455433f, 0.515748143f},
-std::array<float,2>{0.201082587f, 0.315309435f},
-std::array<float,2>{0.9811185f, 0.855682969f},
-std::array<float,2>{0.710590959f, 0.307646722f},
-std::array<float,2>{0.473789006f, 0.754833877f},
-std::array<float,2>{0.00772034889f, 0.0388311222f},
-std::array<float,2>{0.823950589f, 0.601763427f},
-std::array<float,2>{0.929002821f, 0.249726489f},
-std::array<float,2>{0.153208762f, 0.733362973f},
-std::array<float,2>{0.302080363f, 0.401596278f},
-std::array<float,2>{0.599859118f, 0.927412212f},
-std::array<float,2>{0.939832628f, 0.352337778f},
-std::array<float,2>{0.248193204f, 0.82981658f},
-std::array<float,2>{0.341277063f, 0.0775867254f},
-std::array<float,2>{0.525149763f, 0.547506988f},
-std::array<float,2>{0.680594623f, 0.1726785f},
-std::array<float,2>{0.413650185f, 0.641721189f},
-std::array<float,2>{0.124982581f, 0.454327762f},
-std::array<float,2>{0.802801192f, 0.947104454f},
-std::array<float,2>{0.592261136f, 0.427629441f},
-std::array<float,2>{0.275745183f, 0.883604705f},
-std::array<float,2>{0.174804688f, 0.193456843f},
-std::array<float,2>{0.876081824f, 0.707914531f},
-std::array<float,2>{0.872602761f, 0.0138482749f},
-std::array<float,2>{0.0496233702f, 0.57608211f},
-std::array<float,2>{0.445067346f, 0.265690356f},
-std::array<float,2>{0.744677186f, 0.799304664f},
-std::array<float,2>{0.831948221f, 0.259238064f},
-std::array<float,2>{0.0260475669f, 0.788939774f},
-std::array<float,2>{0.495691687f, 0.0161205996f},
-std::array<float,2>{0.693110645f, 0.579323709f},
-std::array<float,2>{0.612103462f, 0.210318819f},
-std::array<float,2>{0.284057379f, 0.70129627f},
-std::array<float,2>{0.133758992f, 0.414858878f},
-std::array<float,2>{0.909574747f, 0.901880085f},
-std::array<float,2>{0.649738193f, 0.437778771f},
-std::array<float,2>{0.395005852f, 0.959991395f},
-std::array<float,2>{0.068196021f, 0.157448366f},
-std::array<float,2>{0.76036638f, 0.63245821f},
-std::array<float,2>{0.992016196f, 0.0918609351f},
-std::array<float,2>{0.218240589f, 0.531529367f},
-std::array<float,2>{0.365931123f, 0.360597789f},
-std::array<float,2>{0.553603411f, 0.813718915f},
-std::array<float,2>{0.903682411f, 0.385096997f},
-std::array<float,2>{0.158411086f, 0.911048412f},
-std::array<float,2>{0.252462387f, 0.224966571f},
-std::array<float,2>{0.570293248f, 0.745087087f},
-std::array<float,2>{0.729140222f, 0.0560631007f},
-std::array<float,2>{0.462906688f, 0.623980522f},
-std::array<float,2>{0.0344277993f, 0.294651508f},
-std::array<float,2>{0.846637845f, 0.775415599f},
-std::array<float,2>{0.501772285f, 0.343607903f},
-std::array<float,2>{0.31312567f, 0.872407019f},
-std::array<float,2>{0.222010016f, 0.106300741f},
-std::array<float,2>{0.963713348f, 0.501827419f},
-std::array<float,2>{0.79531002f, 0.129952937f},
-std::array<float,2>{0.0951209888f, 0.65790385f},
-std::array<float,2>{0.43489185f, 0.474983603f},
-std::array<float,2>{0.66500473f, 0.995913744f},
-std::array<float,2>{0.853733957f, 0.407655716f},
-std::array<float,2>{0.0402881578f, 0.896753073f},
-std::array<float,2>{0.454316258f, 0.213547543f},
-std::array<float,2>{0.722051263f, 0.690167487f},
-std::array<float,2>{0.578014433f, 0.0262481179f},
-std::array<float,2>{0.264856726f, 0.591855228f},
-std::array<float,2>{0.171447664f, 0.250972301f},
-std::array<float,2>{0.898053169f, 0.796077549f},
-std::array<float,2>{0.662288189f, 0.369663656f},
-std::array<float,2>{0.429273605f, 0.827424705f},
-std::array<float,2>{0.107256442f, 0.0821248814f},
-std::array<float,2>{0.782187104f, 0.545962572f},
-std::array<float,2>{0.95590806f, 0.170660645f},
-std::array<float,2>{0.230822742f, 0.636374891f},
-std::array<float,2>{0.32207948f, 0.447591633f},
-std::array<float,2>{0.514143288f, 0.962947309f},
-std::array<float,2>{0.91979152f, 0.282309592f},
-std::array<float,2>{0.126878053f, 0.771441042f},
-std::array<float,2>{0.291862845f, 0.0499488749f},
-std::array<float,2>{0.624021053f, 0.615751266f},
-std::array<float,2>{0.700462103f, 0.226578698f},
-std::array<float,2>{0.489821732f, 0.73646158f},
-std::array<float,2>{0.0176087301f, 0.378630042f},
-std::array<float,2>{0.841290772f, 0.920348406f},
-std::array<float,2>{0.558880448f, 0.483061135f},
-std::array<float,2>{0.373371303f, 0.988004804f},
-std::array<float,2>{0.206788957f, 0.133879691f},
-std::array<float,2>{0.999180853f, 0.671773076f},
-std::array<float,2>{0.753163338f, 0.0939378142f},
-std::array<float,2>{0.0761918649f, 0.511804104f},
-std::array<float,2>{0.402565449f, 0.334072798f},
-std::array<float,2>{0.647319853f, 0.863117218f},
-std::array<float,2>{0.806386173f, 0.324025333f},
-std::array<float,2>{0.115173399f, 0.847917557f},
-std::array<float,2>{0.416541547f, 0.11080236f},
-std::array<float,2>{0.672682047f, 0.524451792f},
-std::array<float,2>{0.519703865f, 0.14288497f},
-std::array<float,2>{0.332710207f, 0.676743805f},
-std::array<float,2>{0.239107952f, 0.494178057f},
-std::array<float,2>{0.946172893f, 0.975627959f},
-std::array<float,2>{0.741466939f, 0.391585857f},
-std::array<float,2>{0.452099741f, 0.934889793f},
-std::array<float,2>{0.0589418411f, 0.234378546f},
-std::array<float,2>{0.86291194f, 0.723559797f},
-std::array<float,2>{0.890157342f, 0.0446813218f},
-std::array<float,2>{0.181723818f, 0.598298252f},
-std::array<float,2>{0.268295407f, 0.302453876f},
-std::array<float,2>{0.585676968f, 0.763550282f},
-std::array<float,2>{0.976358533f, 0.467410058f},
-std::array<float,2>{0.194229275f, 0.93958807f},
-std::array<float,2>{0.359196454f, 0.186154515f},
-std::array<float,2>{0.535523593f, 0.649206996f},
-std::array<float,2>{0.625766933f, 0.0644394383f},
-std::array<float,2>{0.379552096f, 0.560079217f},
-std::array<float,2>{0.0890439749f, 0.347987145f},
-std::array<float,2>{0.770766854f, 0.843343318f},
-std::array<float,2>{0.605616391f, 0.274567902f},
-std::array<float,2>{0.304778159f, 0.806431234f},
-std::array<float,2>{0.14802891f, 0.00755541446f},
-std::array<float,2>{0.933203876f, 0.562902272f},
-std::array<float,2>{0.819517374f, 0.199463844f},
-std::array<float,2>{0.00810196996f, 0.710975111f},
-std::array<float,2>{0.479829103f, 0.435195684f},
-std::array<float,2>{0.717145324f, 0.879421353f},
-std::array<float,2>{0.827278972f, 0.450709134f},
-std::array<float,2>{0.00313792704f, 0.968380749f},
-std::array<float,2>{0.470188618f, 0.164800674f},
-std::array<float,2>{0.706861913f, 0.637478709f},
-std::array<float,2>{0.596375287f, 0.0794954821f},
-std::array<float,2>{0.297250628f, 0.541197598f},
-std::array<float,2>{0.15016523f, 0.371279567f},
-std::array<float,2>{0.925230861f, 0.821135759f},
-std::array<float,2>{0.639201343f, 0.255520105f},
-std::array<float,2>{0.385794193f, 0.791479528f},
-std::array<float,2>{0.0800966471f, 0.0304397643f},
-std::array<float,2>{0.777788579f, 0.588758588f},
-std::array<float,2>{0.980021298f, 0.215540439f},
-std::array<float,2>{0.197002888f, 0.694398224f},
-std::array<float,2>{0.344392836f, 0.410368621f},
-std::array<float,2>{0.545744956f, 0.892865062f},
-std::array<float,2>{0.879879057f, 0.330820054f},
-std::array<float,2>{0.17934446f, 0.864658892f},
-std::array<float,2>{0.277782649f, 0.100058712f},
-std::array<float,2>{0.588819742f, 0.508230448f},
-std::array<float,2>{0.748800695f, 0.138241723f},
-std::array<float,2>{0.43813017f, 0.664304554f},
-std::array<float,2>{0.0519139096f, 0.476620942f},
-std::array<float,2>{0.867822766f, 0.990505874f},
-std::array<float,2>{0.527451754f, 0.380117476f},
-std::array<float,2>{0.339536965f, 0.91469568f},
-std::array<float,2>{0.244873703f, 0.233548611f},
-std::array<float,2>{0.944873631f, 0.740968287f},
-std::array<float,2>{0.799189389f, 0.0513177775f},
-std::array<float,2>{0.120566867f, 0.612126946f},
-std::array<float,2>{0.406439304f, 0.285398722f},
-std::array<float,2>{0.685152113f, 0.768846571f},
-std::array<float,2>{0.762969792f, 0.297882438f},
-std::array<float,2>{0.0626627877f, 0.761683166f},
-std::array<float,2>{0.391367108f, 0.0394849107f},
-std::array<float,2>{0.656009138f, 0.597253561f},
-std::array<float,2>{0.549086332f, 0.239252463f},
-std::array<float,2>{0.363271207f, 0.720083892f},
-std::array<float,2>{0.214275017f, 0.395183623f},
-std::array<float,2>{0.98472774f, 0.932707846f},
-std::array<float,2>{0.688198805f, 0.497622222f},
-std::array<float,2>{0.497396499f, 0.971251369f},
-std::array<float,2>{0.0277868677f, 0.147688776f},
-std::array<float,2>{0.83266747f, 0.674392939f},
-std::array<float,2>{0.912131667f, 0.11563316f},
-std::array<float,2>{0.137698591f, 0.530990183f},
-std::array<float,2>{0.287483335f, 0.325950474f},
-std::array<float,2>{0.61714679f, 0.847003102f},
-std::array<float,2>{0.965992332f, 0.431018382f},
-std::array<float,2>{0.226491645f, 0.877655208f},
-std::array<float,2>{0.317478418f, 0.199004591f},
-std::array<float,2>{0.507433772f, 0.716975629f},
-std::array<float,2>{0.670556962f, 0.00127423217f},
-std::array<float,2>{0.430145353f, 0.567210615f},
-std::array<float,2>{0.0978734344f, 0.2800318f},
-std::array<float,2>{0.792172611f, 0.812228799f},
-std::array<float,2>{0.565044582f, 0.34576416f},
-std::array<float,2>{0.256415159f, 0.839163601f},
-std::array<float,2>{0.163718849f, 0.0675434545f},
-std::array<float,2>{0.899285257f, 0.55667299f},
-std::array<float,2>{0.850611091f, 0.180475876f},
-std::array<float,2>{0.0355528891f, 0.65376842f},
-std::array<float,2>{0.468032658f, 0.462706685f},
-std::array<float,2>{0.733549297f, 0.943665564f},
-std::array<float,2>{0.787284076f, 0.404169112f},
-std::array<float,2>{0.101818681f, 0.921998918f},
-std::array<float,2>{0.424935371f, 0.246066988f},
-std::array<float,2>{0.658044577f, 0.727769077f},
-std::array<float,2>{0.510727942f, 0.0318661965f},
-std::array<float,2>{0.32640934f, 0.608646333f},
-std::array<float,2>{0.227211744f, 0.30994311f},
-std::array<float,2>{0.958739102f, 0.750778079f},
-std::array<float,2>{0.724708676f, 0.320115119f},
-std::array<float,2>{0.457237124f, 0.852050543f},
-std::array<float,2>{0.0434373729f, 0.118219882f},
-std::array<float,2>{0.85849309f, 0.519970298f},
-std::array<float,2>{0.892396569f, 0.155569717f},
-std::array<float,2>{0.164501831f, 0.680049181f},
-std::array<float,2>{0.25910908f, 0.489872545f},
-std::array<float,2>{0.571507633f, 0.981392443f},
-std::array<float,2>{0.99473691f, 0.269561887f},
-std::array<float,2>{0.207817346f, 0.804103255f},
-std::array<float,2>{0.367369831f, 0.0112011181f},
-std::array<float,2>{0.558120191f, 0.573530614f},
-std::array<float,2>{0.643603861f, 0.190162778f},
-std::array<float,2>{0.39942798f, 0.703560412f},
-std::array<float,2>{0.0730154589f, 0.423461378f},
-std::array<float,2>{0.754641771f, 0.887446761f},
-std::array<float,2>{0.618908167f, 0.458018512f},
-std::array<float,2>{0.293242127f, 0.952369034f},
-std::array<float,2>{0.130886361f, 0.17876251f},
-std::array<float,2>{0.91668123f, 0.648345053f},
-std::array<float,2>{0.839811444f, 0.0716167912f},
-std::array<float,2>{0.0231036544f, 0.553159475f},
-std::array<float,2>{0.486320376f, 0.355531693f},
-std::array<float,2>{0.699048042f, 0.833770752f},
-std::array<float,2>{0.865582764f, 0.36403951f},
-std::array<float,2>{0.0572852567f, 0.81821245f},
-std::array<float,2>{0.446265876f, 0.0870293453f},
-std::array<float,2>{0.736606002f, 0.536257207f},
-std::array<float,2>{0.578290701f, 0.160212442f},
-std::array<float,2>{0.271706492f, 0.626587749f},
-std::array<float,2>{0.187473163f, 0.441449314f},
-std::array<float,2>{0.886031926f, 0.956458449f},
-std::array<float,2>{0.67583859f, 0.41972515f},
-std::array<float,2>{0.418831885f, 0.905723333f},
-std::array<float,2>{0.110953614f, 0.20612745f},
-std::array<float,2>{0.811747372f, 0.697950065f},
-std::array<float,2>{0.950368047f, 0.0218244549f},
-std::array<float,2>{0.235762462f, 0.58411628f},
-std::array<float,2>{0.330515891f, 0.264434427f},
-std::array<float,2>{0.51617676f, 0.783393502f},
-std::array<float,2>{0.937022269f, 0.470462084f},
-std::array<float,2>{0.1445297f, 0.998590767f},
-std::array<float,2>{0.312229156f, 0.128283352f},
-std::array<float,2>{0.603387237f, 0.660388827f},
-std::array<float,2>{0.712064266f, 0.10383518f},
-std::array<float,2>{0.481374294f, 0.506449759f},
-std::array<float,2>{0.011758632f, 0.338279217f},
-std::array<float,2>{0.815416038f, 0.868979514f},
-std::array<float,2>{0.533453524f, 0.291467875f},
-std::array<float,2>{0.354520708f, 0.779832423f},
-std::array<float,2>{0.190826982f, 0.0587142408f},
-std::array<float,2>{0.969516873f, 0.61905545f},
-std::array<float,2>{0.768490255f, 0.222032979f},
-std::array<float,2>{0.091546759f, 0.749275804f},
-std::array<float,2>{0.376843721f, 0.390019923f},
-std::array<float,2>{0.631930292f, 0.906876981f},
-std::array<float,2>{0.802363098f, 0.455384344f},
-std::array<float,2>{0.122527577f, 0.948404312f},
-std::array<float,2>{0.411376476f, 0.175291881f},
-std::array<float,2>{0.682646453f, 0.643069088f},
-std::array<float,2>{0.526449978f, 0.0742328241f},
-std::array<float,2>{0.342732131f, 0.550213754f},
-std::array<float,2>{0.246481568f, 0.353686094f},
-std::array<float,2>{0.938216031f, 0.831658006f},
-std::array<float,2>{0.742691159f, 0.268965423f},
-std::array<float,2>{0.442466557f, 0.798751533f},
-std::array<float,2>{0.0469120778f, 0.0124151949f},
-std::array<float,2>{0.873547137f, 0.57713145f},
-std::array<float,2>{0.877307177f, 0.193224207f},
-std::array<float,2>{0.173630357f, 0.710390925f},
-std::array<float,2>{0.275320411f, 0.428248793f},
-std::array<float,2>{0.591744721f, 0.886189938f},
-std::array<float,2>{0.983891726f, 0.313599527f},
-std::array<float,2>{0.202312186f, 0.857505798f},
-std::array<float,2>{0.348595083f, 0.123470344f},
-std::array<float,2>{0.542794824f, 0.518146515f},
-std::array<float,2>{0.636621237f, 0.148761243f},
-std::array<float,2>{0.389517099f, 0.686290681f},
-std::array<float,2>{0.085213244f, 0.4854137f},
-std::array<float,2>{0.776185572f, 0.97871536f},
-std::array<float,2>{0.599126577f, 0.400084853f},
-std::array<float,2>{0.303482413f, 0.92954123f},
-std::array<float,2>{0.155085087f, 0.246273428f},
-std::array<float,2>{0.927608013f, 0.732050717f},
-std::array<float,2>{0.820953667f, 0.0356149562f},
-std::array<float,2>{0.0057819779f, 0.603530526f},
-std::array<float,2>{0.476491451f, 0.305877626f},
-std::array<float,2>{0.708535135f, 0.757056117f},
-std::array<float,2>{0.84434551f, 0.296768963f},
-std::array<float,2>{0.0321930014f, 0.775086164f},
-std::array<float,2>{0.462085694f, 0.0568117127f},
-std::array<float,2>{0.72803092f, 0.622430086f},
-std::array<float,2>{0.568136871f, 0.224068731f},
-std::array<float,2>{0.250485867f, 0.743083179f},
-std::array<float,2>{0.156505972f, 0.383985639f},
-std::array<float,2>{0.905107975f, 0.912580967f},
-std::array<float,2>{0.666345537f, 0.473784178f},
-std::array<float,2>{0.435710371f, 0.993875921f},
-std::array<float,2>{0.0961169377f, 0.131964669f},
-std::array<float,2>{0.794030666f, 0.659404457f},
-std::array<float,2>{0.962888241f, 0.108949713f},
-std::array<float,2>{0.219054639f, 0.502864718f},
-std::array<float,2>{0.315371245f, 0.34067449f},
-std::array<float,2>{0.502636552f, 0.874994099f},
-std::array<float,2>{0.907562196f, 0.416673481f},
-std::array<float,2>{0.136309057f, 0.899565876f},
-std::array<float,2>{0.282449603f, 0.207329735f},
-std::array<float,2>{0.610611618f, 0.700125873f},
-std::array<float,2>{0.694610655f, 0.0194032062f},
-std::array<float,2>{0.493831426f, 0.581032753f},
-std::array<float,2>{0.025353441f, 0.260527283f},
-std::array<float,2>{0.828159451f, 0.786479056f},
-std::array<float,2>{0.552298427f, 0.361431062f},
-std::array<float,2>{0.364085704f, 0.81481868f},
-std::array<float,2>{0.216190591f, 0.0909153f},
-std::array<float,2>{0.988797188f, 0.533249736f},
-std::array<float,2>{0.759527981f, 0.158829466f},
-std::array<float,2>{0.0701219216f, 0.629025459f},
-std::array<float,2>{0.398429662f, 0.439609706f},
-std::array<float,2>{0.651595592f, 0.957749069f},
-std::array<float,2>{0.843652248f, 0.376669616f},
-std::array<float,2>{0.0166735798f, 0.918246031f},
-std::array<float,2>{0.491920292f, 0.229069918f},
-std::array<float,2>{0.702742457f, 0.734781802f},
-std::array<float,2>{0.621644557f, 0.0481880382f},
-std::array<float,2>{0.290809631f, 0.614627004f},
-std::array<float,2>{0.128376439f, 0.284165531f},
-std::array<float,2>{0.921677172f, 0.771740556f},
-std::array<float,2>{0.645947874f, 0.333031356f},
-std::array<float,2>{0.404747158f, 0.859837592f},
-std::array<float,2>{0.0753137916f, 0.0974110365f},
-std::array<float,2>{0.751640975f, 0.513848484f},
-std::array<float,2>{0.996714473f, 0.135675773f},
-std::array<float,2>{0.203989431f, 0.668665707f},
-std::array<float,2>{0.372282863f, 0.482261419f},
-std::array<float,2>{0.5617432f, 0.985863626f},
-std::array<float,2>{0.895377457f, 0.252425164f},
-std::array<float,2>{0.168443188f, 0.793807328f},
-std::array<float,2>{0.263609439f, 0.0236121863f},
-std::array<float,2>{0.57593441f, 0.591170728f},
-std::array<float,2>{0.720592022f, 0.211411268f},
-std::array<float,2>{0.456051588f, 0.688759387f},
-std::array<float,2>{0.0422634557f, 0.408568293f},
-std::array<float,2>{0.852429509f, 0.895803213f},
-std::array<float,2>{0.511903703f, 0.446917027f},
-std::array<float,2>{0.323607594f, 0.961124897f},
-std::array<float,2>{0.234236613f, 0.167997122f},
-std::array<float,2>{0.954268694f, 0.63292253f},
-std::array<float,2>{0.783652723f, 0.085703142f},
-std::array<float,2>{0.107457988f, 0.544838786f},
-std::array<float,2>{0.427657127f, 0.368810952f},
-std::array<float,2>{0.660970807f, 0.825012684f},
-std::array<float,2>{0.772323489f, 0.350728095f},
-std::array<float,2>{0.086933814f, 0.840674937f},
-std::array<float,2>{0.382117361f, 0.0660748556f},
-std::array<float,2>{0.628224313f, 0.560644209f},
-std::array<float,2>{0.537570834f, 0.183895603f},
-std::array<float,2>{0.356146753f, 0.651965797f},
-std::array<float,2>{0.191738084f, 0.465287f},
-std::array<float,2>{0.973049462f, 0.937508106f},
-std::array<float,2>{0.716444135f, 0.437414229f},
-std::array<float,2>{0.477144927f, 0.881127298f},
-std::array<float,2>{0.0102006476f, 0.201440334f},
-std::array<float,2>{0.818192661f, 0.712891817f},
-std::array<float,2>{0.930709183f, 0.00421768613f},
-std::array<float,2>{0.146332622f, 0.564548552f},
-std::array<float,2>{0.308282912f, 0.275852174f},
-std::array<float,2>{0.607590258f, 0.80788523f},
-std::array<float,2>{0.948168755f, 0.493985534f},
-std::array<float,2>{0.241249546f, 0.973603845f},
-std::array<float,2>{0.3358711f, 0.142235056f},
-std::array<float,2>{0.522581935f, 0.67900002f},
-std::array<float,2>{0.675514996f, 0.112578094f},
-std::array<float,2>{0.415504307f, 0.526775479f},
-std::array<float,2>{0.116721489f, 0.321945965f},
-std::array<float,2>{0.807521999f, 0.850095689f},
-std::array<float,2>{0.582823813f, 0.302961379f},
-std::array<float,2>{0.265793025f, 0.764071167f},
-std::array<float,2>{0.180414081f, 0.0460583828f},
-std::array<float,2>{0.887751341f, 0.599714816f},
-std::array<float,2>{0.86051923f, 0.23650755f},
-std::array<float,2>{0.0614870265f, 0.726477802f},
-std::array<float,2>{0.450494051f, 0.394477129f},
-std::array<float,2>{0.738341331f, 0.937147319f},
-std::array<float,2>{0.869191527f, 0.479952306f},
-std::array<float,2>{0.054476928f, 0.988397956f},
-std::array<float,2>{0.439954907f, 0.139195889f},
-std::array<float,2>{0.747115672f, 0.666810095f},
-std::array<float,2>{0.586834252f, 0.097898297f},
-std::array<float,2>{0.279613167f, 0.510522842f},
-std::array<float,2>{0.177191541f, 0.329660982f},
-std::array<float,2>{0.882200241f, 0.86657846f},
-std::array<float,2>{0.687115669f, 0.288036019f},
-std::array<float,2>{0.408628374f, 0.766312659f},
-std::array<float,2>{0.119022898f, 0.0528237261f},
-std::array<float,2>{0.797174573f, 0.610120118f},
-std::array<float,2>{0.942784965f, 0.23138763f},
-std::array<float,2>{0.243073136f, 0.739836514f},
-std::array<float,2>{0.337267786f, 0.381599069f},
-std::array<float,2>{0.530960262f, 0.917629004f},
-std::array<float,2>{0.922578394f, 0.374035984f},
-std::array<float,2>{0.150426075f, 0.823609293f},
-std::array<float,2>{0.299519658f, 0.0805110559f},
-std::array<float,2>{0.594041049f, 0.539605021f},
-std::array<float,2>{0.704241395f, 0.167362511f},
-std::array<float,2>{0.472313493f, 0.638941348f},
-std::array<float,2>{0.000442879827f, 0.45308274f},
-std::array<float,2>{0.824421406f, 0.96604538f},
-std::array<float,2>{0.543363333f, 0.412742406f},
-std::array<float,2>{0.346874863f, 0.891072929f},
-std::array<float,2>{0.197769865f, 0.217984736f},
-std::array<float,2>{0.978503048f, 0.691720784f},
-std::array<float,2>{0.780433238f, 0.0292588882f},
-std::array<float,2>{0.0782601684f, 0.587890565f},
-std::array<float,2>{0.383144408f, 0.256464303f},
-std::array<float,2>{0.636997342f, 0.791010499f},
-std::array<float,2>{0.789699435f, 0.278403878f},
-std::array<float,2>{0.100587107f, 0.809624195f},
-std::array<float,2>{0.431682616f, 0.0038999808f},
-std::array<float,2>{0.669527292f, 0.568508208f},
-std::array<float,2>{0.504653752f, 0.195940033f},
-std::array<float,2>{0.318917215f, 0.715162158f},
-std::array<float,2>{0.222897053f, 0.432503045f},
-std::array<float,2>{0.967406094f, 0.875665665f},
-std::array<float,2>{0.731377423f, 0.464128077f},
-std::array<float,2>{0.466256171f, 0.942747116f},
-std::array<float,2>{0.0380984545f, 0.182275161f},
-std::array<float,2>{0.847712934f, 0.656034768f},
-std::array<float,2>{0.901746333f, 0.0690221861f},
-std::array<float,2>{0.161273956f, 0.555039406f},
-std::array<float,2>{0.255372971f, 0.344388276f},
-std::array<float,2>{0.5627985f, 0.836009264f},
-std::array<float,2>{0.98687923f, 0.397983551f},
-std::array<float,2>{0.211530045f, 0.930998385f},
-std::array<float,2>{0.360807389f, 0.2419983f},
-std::array<float,2>{0.54694593f, 0.721180141f},
-std::array<float,2>{0.653032184f, 0.0413074493f},
-std::array<float,2>{0.39312923f, 0.594008267f},
-std::array<float,2>{0.0655374825f, 0.300556839f},
-std::array<float,2>{0.765302479f, 0.758330882f},
-std::array<float,2>{0.614942849f, 0.327140957f},
-std::array<float,2>{0.286772311f, 0.844248772f},
-std::array<float,2>{0.138942301f, 0.114120468f},
-std::array<float,2>{0.911025941f, 0.528438747f},
-std::array<float,2>{0.834890425f, 0.145297617f},
-std::array<float,2>{0.0303606354f, 0.673585773f},
-std::array<float,2>{0.498832166f, 0.498359829f},
-std::array<float,2>{0.689821064f, 0.9692716f},
-std::array<float,2>{0.75658524f, 0.424972862f},
-std::array<float,2>{0.0710138008f, 0.889127135f},
-std::array<float,2>{0.401469857f, 0.188854799f},
-std::array<float,2>{0.642453313f, 0.705605865f},
-std::array<float,2>{0.555693209f, 0.00862284005f},
-std::array<float,2>{0.369184107f, 0.57032603f},
-std::array<float,2>{0.210449085f, 0.271812648f},
-std::array<float,2>{0.994114339f, 0.801350653f},
-std::array<float,2>{0.695474207f, 0.358609408f},
-std::array<float,2>{0.488180459f, 0.834886372f},
-std::array<float,2>{0.0209180471f, 0.0732392445f},
-std::array<float,2>{0.836426258f, 0.552289546f},
-std::array<float,2>{0.915424526f, 0.177562281f},
-std::array<float,2>{0.129242837f, 0.645849824f},
-std::array<float,2>{0.296220839f, 0.459955364f},
-std::array<float,2>{0.620174527f, 0.95082128f},
-std::array<float,2>{0.959843278f, 0.3120327f},
-std::array<float,2>{0.228621483f, 0.752786636f},
-std::array<float,2>{0.32433787f, 0.0340598822f},
-std::array<float,2>{0.508952558f, 0.60556823f},
-std::array<float,2>{0.659178436f, 0.243599236f},
-std::array<float,2>{0.423186362f, 0.729321301f},
-std::array<float,2>{0.104097627f, 0.405367047f},
-std::array<float,2>{0.786724031f, 0.92498076f},
-std::array<float,2>{0.572852731f, 0.491290987f},
-std::array<float,2>{0.260165662f, 0.983988643f},
-std::array<float,2>{0.166235685f, 0.154235408f},
-std::array<float,2>{0.894204199f, 0.681693971f},
-std::array<float,2>{0.856807351f, 0.119622372f},
-std::array<float,2>{0.0450841114f, 0.521510422f},
-std::array<float,2>{0.459399998f, 0.316913396f},
-std::array<float,2>{0.722694099f, 0.855272293f},
-std::array<float,2>{0.814263165f, 0.337620199f},
-std::array<float,2>{0.0140017169f, 0.870837212f},
-std::array<float,2>{0.483592272f, 0.10296306f},
-std::array<float,2>{0.712982774f, 0.50490284f},
-std::array<float,2>{0.604899287f, 0.126479551f},
-std::array<float,2>{0.309330881f, 0.663376451f},
-std::array<float,2>{0.141261503f, 0.471978992f},
-std::array<float,2>{0.934778869f, 0.99800247f},
-std::array<float,2>{0.629041672f, 0.388232976f},
-std::array<float,2>{0.378214151f, 0.908984184f},
-std::array<float,2>{0.0918706283f, 0.220143199f},
-std::array<float,2>{0.765945077f, 0.747951031f},
-std::array<float,2>{0.971717477f, 0.0621520989f},
-std::array<float,2>{0.188709885f, 0.620933056f},
-std::array<float,2>{0.353479445f, 0.289972037f},
-std::array<float,2>{0.532220364f, 0.778512001f},
-std::array<float,2>{0.884227574f, 0.444409102f},
-std::array<float,2>{0.184351772f, 0.953331351f},
-std::array<float,2>{0.27003181f, 0.163202047f},
-std::array<float,2>{0.580606997f, 0.627473593f},
-std::array<float,2>{0.73628515f, 0.0898127407f},
-std::array<float,2>{0.447553337f, 0.538072944f},
-std::array<float,2>{0.0562568046f, 0.36694926f},
-std::array<float,2>{0.864186108f, 0.818643451f},
-std::array<float,2>{0.51842618f, 0.262764424f},
-std::array<float,2>{0.329915583f, 0.781393111f},
-std::array<float,2>{0.237316772f, 0.0201195739f},
-std::array<float,2>{0.952415705f, 0.583007991f},
-std::array<float,2>{0.809499919f, 0.205057651f},
-std::array<float,2>{0.112947345f, 0.696811676f},
-std::array<float,2>{0.421589524f, 0.420437276f},
-std::array<float,2>{0.678260744f, 0.903779984f},
-std::array<float,2>{0.793073893f, 0.476007491f},
-std::array<float,2>{0.0971258059f, 0.994828165f},
-std::array<float,2>{0.4367266f, 0.129293457f},
-std::array<float,2>{0.667841315f, 0.657187045f},
-std::array<float,2>{0.503357649f, 0.106925331f},
-std::array<float,2>{0.316191435f, 0.500672758f},
-std::array<float,2>{0.219766259f, 0.342037678f},
-std::array<float,2>{0.961254776f, 0.872000098f},
-std::array<float,2>{0.727244675f, 0.293477714f},
-std::array<float,2>{0.461227059f, 0.776652455f},
-std::array<float,2>{0.0330103971f, 0.055385042f},
-std::array<float,2>{0.845490992f, 0.624277532f},
-std::array<float,2>{0.905363739f, 0.226334751f},
-std::array<float,2>{0.158145979f, 0.745865822f},
-std::array<float,2>{0.251388341f, 0.386410952f},
-std::array<float,2>{0.567064226f, 0.911263466f},
-std::array<float,2>{0.990199685f, 0.359787226f},
-std::array<float,2>{0.214901268f, 0.812918782f},
-std::array<float,2>{0.364587963f, 0.0935933441f},
-std::array<float,2>{0.551616311f, 0.53225404f},
-std::array<float,2>{0.650781929f, 0.156939194f},
-std::array<float,2>{0.397426546f, 0.631817102f},
-std::array<float,2>{0.0684484541f, 0.439299554f},
-std::array<float,2>{0.758486152f, 0.959043086f},
-std::array<float,2>{0.609794378f, 0.415343732f},
-std::array<float,2>{0.281416327f, 0.900812805f},
-std::array<float,2>{0.135246664f, 0.20985128f},
-std::array<float,2>{0.906340122f, 0.703043759f},
-std::array<float,2>{0.830010891f, 0.0174813271f},
-std::array<float,2>{0.0235934947f, 0.578272462f},
-std::array<float,2>{0.492620498f, 0.258341312f},
-std::array<float,2>{0.693755686f, 0.78796488f},
-std::array<float,2>{0.874203622f, 0.267155468f},
-std::array<float,2>{0.0478893742f, 0.800087035f},
-std::array<float,2>{0.441895545f, 0.0150723448f},
-std::array<float,2>{0.743339062f, 0.574491322f},
-std::array<float,2>{0.590275586f, 0.195054948f},
-std::array<float,2>{0.274128407f, 0.708289504f},
-std::array<float,2>{0.172170758f, 0.426246434f},
-std::array<float,2>{0.877934217f, 0.884486496f},
-std::array<float,2>{0.682076633f, 0.454041749f},
-std::array<float,2>{0.41068244f, 0.945689023f},
-std::array<float,2>{0.1211548f, 0.173339054f},
-std::array<float,2>{0.801492453f, 0.640746653f},
-std::array<float,2>{0.939070284f, 0.0764170513f},
-std::array<float,2>{0.247963145f, 0.547985017f},
-std::array<float,2>{0.343599439f, 0.352780759f},
-std::array<float,2>{0.525782585f, 0.828576863f},
-std::array<float,2>{0.926234305f, 0.400850832f},
-std::array<float,2>{0.155904368f, 0.926341772f},
-std::array<float,2>{0.304646701f, 0.248307571f},
-std::array<float,2>{0.598316073f, 0.733507276f},
-std::array<float,2>{0.707626045f, 0.0378318653f},
-std::array<float,2>{0.474621356f, 0.602878332f},
-std::array<float,2>{0.00402230211f, 0.306813002f},
-std::array<float,2>{0.822083473f, 0.755343139f},
-std::array<float,2>{0.541873813f, 0.316144407f},
-std::array<float,2>{0.349553168f, 0.857350051f},
-std::array<float,2>{0.201931655f, 0.122460574f},
-std::array<float,2>{0.98253113f, 0.516719639f},
-std::array<float,2>{0.777338266f, 0.151882678f},
-std::array<float,2>{0.0842899755f, 0.68505609f},
-std::array<float,2>{0.389721572f, 0.486441553f},
-std::array<float,2>{0.635694146f, 0.977263033f},
-std::array<float,2>{0.817308128f, 0.433919877f},
-std::array<float,2>{0.0116093187f, 0.880818367f},
-std::array<float,2>{0.47799176f, 0.200812846f},
-std::array<float,2>{0.715360224f, 0.712753475f},
-std::array<float,2>{0.608725369f, 0.0067013707f},
-std::array<float,2>{0.307337701f, 0.563983321f},
-std::array<float,2>{0.145173207f, 0.273596674f},
-std::array<float,2>{0.930512846f, 0.804906487f},
-std::array<float,2>{0.627636731f, 0.34944886f},
-std::array<float,2>{0.381087363f, 0.842408001f},
-std::array<float,2>{0.086664699f, 0.0627860576f},
-std::array<float,2>{0.772730589f, 0.558719516f},
-std::array<float,2>{0.973779857f, 0.187499911f},
-std::array<float,2>{0.192713007f, 0.649804771f},
-std::array<float,2>{0.356624335f, 0.468281537f},
-std::array<float,2>{0.538397312f, 0.940815806f},
-std::array<float,2>{0.886776388f, 0.301283449f},
-std::array<float,2>{0.180857182f, 0.762613237f},
-std::array<float,2>{0.267274886f, 0.0435068868f},
-std::array<float,2>{0.583267272f, 0.598963976f},
-std::array<float,2>{0.739744842f, 0.236064076f},
-std::array<float,2>{0.449537903f, 0.724202573f},
-std::array<float,2>{0.061905127f, 0.391684681f},
-std::array<float,2>{0.859466553f, 0.93361187f},
-std::array<float,2>{0.52231878f, 0.496074229f},
-std::array<float,2>{0.334529251f, 0.974678576f},
-std::array<float,2>{0.241136327f, 0.144405603f},
-std::array<float,2>{0.948484361f, 0.677352071f},
-std::array<float,2>{0.807918549f, 0.109811358f},
-std::array<float,2>{0.115386158f, 0.523543477f},
-std::array<float,2>{0.41452843f, 0.32261166f},
-std::array<float,2>{0.674634933f, 0.84887743f},
-std::array<float,2>{0.750662208f, 0.33538118f},
-std::array<float,2>{0.0749209672f, 0.861464739f},
-std::array<float,2>{0.405292958f, 0.09498135f},
-std::array<float,2>{0.644883573f, 0.51315999f},
-std::array<float,2>{0.560552955f, 0.132916316f},
-std::array<float,2>{0.371657014f, 0.670483947f},
-std::array<float,2>{0.204480872f, 0.484152317f},
-std::array<float,2>{0.997325361f, 0.986433506f},
-std::array<float,2>{0.701854229f, 0.377319545f},
-std::array<float,2>{0.490618676f, 0.921811044f},
-std::array<float,2>{0.0163601507f, 0.227616534f},
-std::array<float,2>{0.842394233f, 0.737795711f},
-std::array<float,2>{0.920662344f, 0.0497824512f},
-std::array<float,2>{0.127245545f, 0.61693126f},
-std::array<float,2>{0.289115429f, 0.281518787f},
-std::array<float,2>{0.622435272f, 0.770184457f},
-std::array<float,2>{0.953577995f, 0.448970973f},
-std::array<float,2>{0.23315765f, 0.964222431f},
-std::array<float,2>{0.322877079f, 0.171236515f},
-std::array<float,2>{0.51310879f, 0.635607302f},
-std::array<float,2>{0.661873281f, 0.0837136358f},
-std::array<float,2>{0.426701844f, 0.545381606f},
-std::array<float,2>{0.10918811f, 0.370684713f},
-std::array<float,2>{0.784958243f, 0.827120602f},
-std::array<float,2>{0.574451864f, 0.251947135f},
-std::array<float,2>{0.262336612f, 0.795423269f},
-std::array<float,2>{0.169789642f, 0.0265710782f},
-std::array<float,2>{0.895692468f, 0.593304157f},
-std::array<float,2>{0.852777123f, 0.214101434f},
-std::array<float,2>{0.0410627723f, 0.691200018f},
-std::array<float,2>{0.456142336f, 0.406660885f},
-std::array<float,2>{0.719034672f, 0.89756f},
-std::array<float,2>{0.848938286f, 0.461558968f},
-std::array<float,2>{0.0377024934f, 0.945263445f},
-std::array<float,2>{0.465693414f, 0.181637809f},
-std::array<float,2>{0.732068956f, 0.652497768f},
-std::array<float,2>{0.564366162f, 0.0667843521f},
-std::array<float,2>{0.254403263f, 0.558155954f},
-std::array<float,2>{0.160592407f, 0.347605169f},
-std::array<float,2>{0.901263475f, 0.838469028f},
-std::array<float,2>{0.668498099f, 0.280971915f},
-std::array<float,2>{0.433195114f, 0.810608268f},
-std::array<float,2>{0.100382529f, 0.000850531505f},
-std::array<float,2>{0.790699899f, 0.567795455f},
-std::array<float,2>{0.968462408f, 0.198109612f},
-std::array<float,2>{0.224461839f, 0.718657613f},
-std::array<float,2>{0.320223659f, 0.42985639f},
-std::array<float,2>{0.505520105f, 0.878378689f},
-std::array<float,2>{0.911757588f, 0.324787855f},
-std::array<float,2>{0.140575737f, 0.846245468f},
-std::array<float,2>{0.28550148f, 0.116212413f},
-std::array<float,2>{0.614052176f, 0.530124485f},
-std::array<float,2>{0.690573812f, 0.146739751f},
-std::array<float,2>{0.499059021f, 0.675641835f},
-std::array<float,2>{0.0301711839f, 0.496638089f},
-std::array<float,2>{0.835081875f, 0.972198129f},
-std::array<float,2>{0.548306942f, 0.396256626f},
-std::array<float,2>{0.3599374f, 0.932478845f},
-std::array<float,2>{0.212220967f, 0.239324167f},
-std::array<float,2>{0.987609506f, 0.718810737f},
-std::array<float,2>{0.764522612f, 0.0400906317f},
-std::array<float,2>{0.0647704601f, 0.596348345f},
-std::array<float,2>{0.394296646f, 0.297668189f},
-std::array<float,2>{0.653933644f, 0.760138333f},
-std::array<float,2>{0.79854846f, 0.286136091f},
-std::array<float,2>{0.117660969f, 0.768053293f},
-std::array<float,2>{0.409569234f, 0.0527087785f},
-std::array<float,2>{0.686331034f, 0.612930119f},
-std::array<float,2>{0.530069947f, 0.233385608f},
-std::array<float,2>{0.336568505f, 0.741979539f},
-std::array<float,2>{0.243812516f, 0.379825532f},
-std::array<float,2>{0.941698313f, 0.915493309f},
-std::array<float,2>{0.746343851f, 0.477883279f},
-std::array<float,2>{0.441196352f, 0.992018044f},
-std::array<float,2>{0.0534986816f, 0.137466431f},
-std::array<float,2>{0.870669186f, 0.665253401f},
-std::array<float,2>{0.880911529f, 0.101008251f},
-std::array<float,2>{0.176690549f, 0.508912861f},
-std::array<float,2>{0.281110257f, 0.331415594f},
-std::array<float,2>{0.586966872f, 0.863894522f},
-std::array<float,2>{0.977052867f, 0.411296695f},
-std::array<float,2>{0.199215949f, 0.893558204f},
-std::array<float,2>{0.346047461f, 0.215909988f},
-std::array<float,2>{0.544593275f, 0.694280028f},
-std::array<float,2>{0.63840872f, 0.0298140422f},
-std::array<float,2>{0.384473324f, 0.589352548f},
-std::array<float,2>{0.0798994824f, 0.254140437f},
-std::array<float,2>{0.779822767f, 0.792704999f},
-std::array<float,2>{0.595345318f, 0.372521967f},
-std::array<float,2>{0.300739795f, 0.822183549f},
-std::array<float,2>{0.151642904f, 0.0786126181f},
-std::array<float,2>{0.923366487f, 0.542588949f},
-std::array<float,2>{0.825540125f, 0.165659145f},
-std::array<float,2>{0.00168424798f, 0.638450503f},
-std::array<float,2>{0.47104767f, 0.449747115f},
-std::array<float,2>{0.703262031f, 0.966863513f},
-std::array<float,2>{0.766612113f, 0.389544278f},
-std::array<float,2>{0.0935144797f, 0.907356024f},
-std::array<float,2>{0.377215177f, 0.221607f},
-std::array<float,2>{0.630048096f, 0.748144925f},
-std::array<float,2>{0.533046067f, 0.0597896725f},
-std::array<float,2>{0.351621538f, 0.61764884f},
-std::array<float,2>{0.187791556f, 0.292436898f},
-std::array<float,2>{0.971190333f, 0.781126738f},
-std::array<float,2>{0.713893354f, 0.338933945f},
-std::array<float,2>{0.482795388f, 0.867371321f},
-std::array<float,2>{0.0149484864f, 0.104498908f},
-std::array<float,2>{0.812611759f, 0.507778168f},
-std::array<float,2>{0.933633864f, 0.127817094f},
-std::array<float,2>{0.141942605f, 0.662028015f},
-std::array<float,2>{0.309853792f, 0.469273269f},
-std::array<float,2>{0.60435462f, 0.999374449f},
-std::array<float,2>{0.951984227f, 0.26526773f},
-std::array<float,2>{0.236561835f, 0.784820199f},
-std::array<float,2>{0.328900099f, 0.0225250199f},
-std::array<float,2>{0.51889801f, 0.585420728f},
-std::array<float,2>{0.679569542f, 0.206036568f},
-std::array<float,2>{0.420396656f, 0.698929071f},
-std::array<float,2>{0.111573569f, 0.418939739f},
-std::array<float,2>{0.810252309f, 0.904667854f},
-std::array<float,2>{0.581673801f, 0.443319082f},
-std::array<float,2>{0.270711869f, 0.955905616f},
-std::array<float,2>{0.185358763f, 0.161228716f},
-std::array<float,2>{0.883077502f, 0.625850201f},
-std::array<float,2>{0.865230143f, 0.0859571323f},
-std::array<float,2>{0.055599317f, 0.535511494f},
-std::array<float,2>{0.448552042f, 0.364547074f},
-std::array<float,2>{0.735253274f, 0.81686604f},
-std::array<float,2>{0.837413311f, 0.356827438f},
-std::array<float,2>{0.0195534509f, 0.832564056f},
-std::array<float,2>{0.486635119f, 0.0706804767f},
-std::array<float,2>{0.69671011f, 0.554009259f},
-std::array<float,2>{0.61931932f, 0.17797567f},
-std::array<float,2>{0.295296699f, 0.646484613f},
-std::array<float,2>{0.130607501f, 0.457711667f},
-std::array<float,2>{0.914449334f, 0.951698542f},
-std::array<float,2>{0.641322255f, 0.422616929f},
-std::array<float,2>{0.401212484f, 0.887810588f},
-std::array<float,2>{0.0719664693f, 0.191108942f},
-std::array<float,2>{0.757250786f, 0.704945147f},
-std::array<float,2>{0.992412031f, 0.0102352714f},
-std::array<float,2>{0.209079832f, 0.572341442f},
-std::array<float,2>{0.370404959f, 0.271262556f},
-std::array<float,2>{0.555081248f, 0.80325377f},
-std::array<float,2>{0.892718792f, 0.489066899f},
-std::array<float,2>{0.167168334f, 0.982066035f},
-std::array<float,2>{0.261120021f, 0.155255839f},
-std::array<float,2>{0.574012697f, 0.680707097f},
-std::array<float,2>{0.723816574f, 0.117707409f},
-std::array<float,2>{0.460786968f, 0.52096343f},
-std::array<float,2>{0.0460717566f, 0.319165111f},
-std::array<float,2>{0.85618937f, 0.852919936f},
-std::array<float,2>{0.508565545f, 0.309127718f},
-std::array<float,2>{0.325341314f, 0.751921296f},
-std::array<float,2>{0.230110824f, 0.0327694081f},
-std::array<float,2>{0.960333943f, 0.60763216f},
-std::array<float,2>{0.786072314f, 0.244188324f},
-std::array<float,2>{0.104743488f, 0.72726512f},
-std::array<float,2>{0.421980172f, 0.402356297f},
-std::array<float,2>{0.659775913f, 0.923332453f},
-std::array<float,2>{0.761657536f, 0.440680057f},
-std::array<float,2>{0.0668246895f, 0.958530664f},
-std::array<float,2>{0.396260709f, 0.159864634f},
-std::array<float,2>{0.648933768f, 0.630185962f},
-std::array<float,2>{0.554572046f, 0.0907893851f},
-std::array<float,2>{0.366389811f, 0.534213185f},
-std::array<float,2>{0.217085615f, 0.363142759f},
-std::array<float,2>{0.990725458f, 0.815738678f},
-std::array<float,2>{0.69175154f, 0.261385411f},
-std::array<float,2>{0.49509421f, 0.785844028f},
-std::array<float,2>{0.0266873427f, 0.0182830021f},
-std::array<float,2>{0.830891669f, 0.581109285f},
-std::array<float,2>{0.908326149f, 0.208221912f},
-std::array<float,2>{0.13409704f, 0.70106107f},
-std::array<float,2>{0.285038024f, 0.417239666f},
-std::array<float,2>{0.612743855f, 0.898748934f},
-std::array<float,2>{0.963905036f, 0.341460109f},
-std::array<float,2>{0.22106947f, 0.87365675f},
-std::array<float,2>{0.314043343f, 0.108038425f},
-std::array<float,2>{0.500659645f, 0.503225386f},
-std::array<float,2>{0.665726244f, 0.131591305f},
-std::array<float,2>{0.433898091f, 0.658446133f},
-std::array<float,2>{0.0940437689f, 0.473218858f},
-std::array<float,2>{0.79673475f, 0.992948055f},
-std::array<float,2>{0.56883055f, 0.382970899f},
-std::array<float,2>{0.253483623f, 0.913842618f},
-std::array<float,2>{0.15939419f, 0.223425657f},
-std::array<float,2>{0.903114974f, 0.743963599f},
-std::array<float,2>{0.847544074f, 0.0577688552f},
-std::array<float,2>{0.0332729705f, 0.62178874f},
-std::array<float,2>{0.4647201f, 0.295469701f},
-std::array<float,2>{0.729999006f, 0.77395004f},
-std::array<float,2>{0.822417915f, 0.305081606f},
-std::array<float,2>{0.00647577364f, 0.756809652f},
-std::array<float,2>{0.473277032f, 0.0361612141f},
-std::array<float,2>{0.709715605f, 0.605030179f},
-std::array<float,2>{0.601422608f, 0.24716796f},
-std::array<float,2>{0.301236093f, 0.73090893f},
-std::array<float,2>{0.153665677f, 0.398624331f},
-std::array<float,2>{0.928132772f, 0.928331792f},
-std::array<float,2>{0.633425355f, 0.48480466f},
-std::array<float,2>{0.388320625f, 0.980080068f},
-std::array<float,2>{0.0820313841f, 0.149664447f},
-std::array<float,2>{0.775112629f, 0.68745935f},
-std::array<float,2>{0.981744528f, 0.1248964f},
-std::array<float,2>{0.200108662f, 0.519218683f},
-std::array<float,2>{0.351274282f, 0.312870085f},
-std::array<float,2>{0.539971411f, 0.859087229f},
-std::array<float,2>{0.875287116f, 0.429189056f},
-std::array<float,2>{0.174927041f, 0.885020435f},
-std::array<float,2>{0.276827872f, 0.192105591f},
-std::array<float,2>{0.592946887f, 0.709264815f},
-std::array<float,2>{0.745469153f, 0.0129114529f},
-std::array<float,2>{0.444298208f, 0.577266335f},
-std::array<float,2>{0.0500410832f, 0.268118382f},
-std::array<float,2>{0.871277571f, 0.797819376f},
-std::array<float,2>{0.52371186f, 0.355267465f},
-std::array<float,2>{0.340392381f, 0.830222368f},
-std::array<float,2>{0.2499201f, 0.0754480287f},
-std::array<float,2>{0.940478146f, 0.549642205f},
-std::array<float,2>{0.804569185f, 0.173870176f},
-std::array<float,2>{0.123095594f, 0.644095302f},
-std::array<float,2>{0.412528515f, 0.456856906f},
-std::array<float,2>{0.68123883f, 0.94768703f},
-std::array<float,2>{0.861963868f, 0.39266476f},
-std::array<float,2>{0.0601775013f, 0.935829461f},
-std::array<float,2>{0.453006119f, 0.237657726f},
-std::array<float,2>{0.740284026f, 0.725086451f},
-std::array<float,2>{0.584290743f, 0.0452934913f},
-std::array<float,2>{0.269050032f, 0.600915253f},
-std::array<float,2>{0.182879925f, 0.304186285f},
-std::array<float,2>{0.8893103f, 0.764799356f},
-std::array<float,2>{0.673520505f, 0.320539206f},
-std::array<float,2>{0.417320281f, 0.851401925f},
-std::array<float,2>{0.113764405f, 0.112172917f},
-std::array<float,2>{0.805446327f, 0.526199818f},
-std::array<float,2>{0.946851134f, 0.141570032f},
-std::array<float,2>{0.239465177f, 0.677847326f},
-std::array<float,2>{0.333009452f, 0.493028164f},
-std::array<float,2>{0.521264791f, 0.974598408f},
-std::array<float,2>{0.932410896f, 0.27710256f},
-std::array<float,2>{0.146770611f, 0.806918263f},
-std::array<float,2>{0.306412935f, 0.00502820779f},
-std::array<float,2>{0.60699147f, 0.565544307f},
-std::array<float,2>{0.718487859f, 0.202634871f},
-std::array<float,2>{0.479317605f, 0.714816332f},
-std::array<float,2>{0.00909575634f, 0.435575634f},
-std::array<float,2>{0.819148302f, 0.882535398f},
-std::array<float,2>{0.536622643f, 0.466586053f},
-std::array<float,2>{0.357820868f, 0.939242661f},
-std::array<float,2>{0.19516322f, 0.18496111f},
-std::array<float,2>{0.975297809f, 0.650592983f},
-std::array<float,2>{0.770417392f, 0.0653055236f},
-std::array<float,2>{0.0882681385f, 0.56237632f},
-std::array<float,2>{0.380807817f, 0.350022584f},
-std::array<float,2>{0.626575172f, 0.841626883f},
-std::array<float,2>{0.783182204f, 0.36787343f},
-std::array<float,2>{0.105857052f, 0.825648487f},
-std::array<float,2>{0.428050488f, 0.0844169706f},
-std::array<float,2>{0.663506925f, 0.543474555f},
-std::array<float,2>{0.515089571f, 0.169376984f},
-std::array<float,2>{0.320868403f, 0.634470642f},
-std::array<float,2>{0.231549725f, 0.445927709f},
-std::array<float,2>{0.956558049f, 0.962117136f},
-std::array<float,2>{0.721138418f, 0.40995124f},
-std::array<float,2>{0.453625739f, 0.894853354f},
-std::array<float,2>{0.0392210186f, 0.212670162f},
-std::array<float,2>{0.855442464f, 0.687867939f},
-std::array<float,2>{0.896964312f, 0.0245606024f},
-std::array<float,2>{0.170453683f, 0.590589404f},
-std::array<float,2>{0.263976008f, 0.252956867f},
-std::array<float,2>{0.576944947f, 0.794558287f},
-std::array<float,2>{0.998160541f, 0.48072046f},
-std::array<float,2>{0.205890089f, 0.984942973f},
-std::array<float,2>{0.374520063f, 0.136454597f},
-std::array<float,2>{0.55969727f, 0.669525981f},
-std::array<float,2>{0.647950053f, 0.0958302319f},
-std::array<float,2>{0.404036403f, 0.515578806f},
-std::array<float,2>{0.0774812251f, 0.332554549f},
-std::array<float,2>{0.752785385f, 0.860947132f},
-std::array<float,2>{0.624907017f, 0.28469488f},
-std::array<float,2>{0.292785287f, 0.773168564f},
-std::array<float,2>{0.125148609f, 0.0476656407f},
-std::array<float,2>{0.918597817f, 0.613522828f},
-std::array<float,2>{0.840693772f, 0.230173975f},
-std::array<float,2>{0.0190659724f, 0.736205637f},
-std::array<float,2>{0.488374144f, 0.375295192f},
-std::array<float,2>{0.699935138f, 0.919818282f},
-std::array<float,2>{0.833269536f, 0.499252379f},
-std::array<float,2>{0.0286310036f, 0.969775677f},
-std::array<float,2>{0.496554285f, 0.146056622f},
-std::array<float,2>{0.689065099f, 0.672765911f},
-std::array<float,2>{0.615840018f, 0.114502504f},
-std::array<float,2>{0.288636982f, 0.52823633f},
-std::array<float,2>{0.137072399f, 0.327354014f},
-std::array<float,2>{0.913685501f, 0.845633507f},
-std::array<float,2>{0.654738367f, 0.298883826f},
-std::array<float,2>{0.391678602f, 0.759025455f},
-std::array<float,2>{0.0643274561f, 0.0427742004f},
-std::array<float,2>{0.762528598f, 0.594971061f},
-std::array<float,2>{0.986210346f, 0.240583941f},
-std::array<float,2>{0.213306129f, 0.722443104f},
-std::array<float,2>{0.361427158f, 0.396991134f},
-std::array<float,2>{0.550306678f, 0.930410087f},
-std::array<float,2>{0.899763465f, 0.345341325f},
-std::array<float,2>{0.163073704f, 0.83716315f},
-std::array<float,2>{0.257370591f, 0.0701435059f},
-std::array<float,2>{0.566374958f, 0.555940211f},
-std::array<float,2>{0.732926369f, 0.182637021f},
-std::array<float,2>{0.46770829f, 0.654386103f},
-std::array<float,2>{0.0367301479f, 0.463567674f},
-std::array<float,2>{0.849732101f, 0.941896677f},
-std::array<float,2>{0.505984604f, 0.432855308f},
-std::array<float,2>{0.316715449f, 0.876554549f},
-std::array<float,2>{0.224977523f, 0.196891308f},
-std::array<float,2>{0.965792179f, 0.716167331f},
-std::array<float,2>{0.791953385f, 0.0024305624f},
-std::array<float,2>{0.0988268405f, 0.570178092f},
-std::array<float,2>{0.430699229f, 0.278206408f},
-std::array<float,2>{0.671269715f, 0.809497058f},
-std::array<float,2>{0.779013216f, 0.257786036f},
-std::array<float,2>{0.0811914951f, 0.789641201f},
-std::array<float,2>{0.384773582f, 0.0274053346f},
-std::array<float,2>{0.639918745f, 0.586453736f},
-std::array<float,2>{0.546348095f, 0.217012003f},
-std::array<float,2>{0.344728202f, 0.693182707f},
-std::array<float,2>{0.19602263f, 0.413557291f},
-std::array<float,2>{0.979451299f, 0.892019331f},
-std::array<float,2>{0.705692708f, 0.451630056f},
-std::array<float,2>{0.469124854f, 0.965579569f},
-std::array<float,2>{0.00227897894f, 0.166775256f},
-std::array<float,2>{0.826823771f, 0.639735341f},
-std::array<float,2>{0.924013793f, 0.0817848817f},
-std::array<float,2>{0.148577765f, 0.540649176f},
-std::array<float,2>{0.297955126f, 0.373316586f},
-std::array<float,2>{0.596912682f, 0.8229689f},
-std::array<float,2>{0.943550289f, 0.382655323f},
-std::array<float,2>{0.246031791f, 0.916420698f},
-std::array<float,2>{0.338488549f, 0.232128188f},
-std::array<float,2>{0.529214501f, 0.738435984f},
-std::array<float,2>{0.684533f, 0.0542326793f},
-std::array<float,2>{0.408161908f, 0.611083686f},
-std::array<float,2>{0.119152583f, 0.288784444f},
-std::array<float,2>{0.800087214f, 0.766924798f},
-std::array<float,2>{0.589330494f, 0.328472823f},
-std::array<float,2>{0.279195219f, 0.865425289f},
-std::array<float,2>{0.177789167f, 0.098716177f},
-std::array<float,2>{0.880797207f, 0.511690617f},
-std::array<float,2>{0.868265927f, 0.140370995f},
-std::array<float,2>{0.051408194f, 0.667137146f},
-std::array<float,2>{0.439268529f, 0.479022801f},
-std::array<float,2>{0.749415159f, 0.989619851f},
-std::array<float,2>{0.810749054f, 0.420990169f},
-std::array<float,2>{0.110316724f, 0.903117657f},
-std::array<float,2>{0.419566482f, 0.203389734f},
-std::array<float,2>{0.677472472f, 0.69609946f},
-std::array<float,2>{0.517089128f, 0.0205417182f},
-std::array<float,2>{0.331247479f, 0.582227588f},
-std::array<float,2>{0.234935865f, 0.262119174f},
-std::array<float,2>{0.949246764f, 0.782657564f},
-std::array<float,2>{0.738153875f, 0.366138011f},
-std::array<float,2>{0.446654171f, 0.819752514f},
-std::array<float,2>{0.0579286329f, 0.088657096f},
-std::array<float,2>{0.866639733f, 0.538871646f},
-std::array<float,2>{0.885575175f, 0.162461728f},
-std::array<float,2>{0.18597573f, 0.628129721f},
-std::array<float,2>{0.273163259f, 0.443937123f},
-std::array<float,2>{0.579265594f, 0.95420146f},
-std::array<float,2>{0.970251739f, 0.290391594f},
-std::array<float,2>{0.190019131f, 0.777571321f},
-std::array<float,2>{0.353942245f, 0.0613680966f},
-std::array<float,2>{0.534609735f, 0.619574606f},
-std::array<float,2>{0.631257057f, 0.219304875f},
-std::array<float,2>{0.375089884f, 0.746261775f},
-std::array<float,2>{0.0898452997f, 0.38753438f},
-std::array<float,2>{0.769435167f, 0.91015178f},
-std::array<float,2>{0.602215648f, 0.470823258f},
-std::array<float,2>{0.310712397f, 0.996394753f},
-std::array<float,2>{0.14334771f, 0.12500675f},
-std::array<float,2>{0.935796618f, 0.662802398f},
-std::array<float,2>{0.815601647f, 0.102061942f},
-std::array<float,2>{0.0130308112f, 0.504674852f},
-std::array<float,2>{0.481799841f, 0.33660087f},
-std::array<float,2>{0.711175025f, 0.869299591f},
-std::array<float,2>{0.85784322f, 0.318019956f},
-std::array<float,2>{0.0444225818f, 0.85381937f},
-std::array<float,2>{0.458389401f, 0.120283946f},
-std::array<float,2>{0.725854158f, 0.522913992f},
-std::array<float,2>{0.57043159f, 0.152905971f},
-std::array<float,2>{0.258140385f, 0.682764113f},
-std::array<float,2>{0.165551558f, 0.490365028f},
-std::array<float,2>{0.891580224f, 0.98255825f},
-std::array<float,2>{0.656508923f, 0.404742479f},
-std::array<float,2>{0.424130321f, 0.923970997f},
-std::array<float,2>{0.103503473f, 0.242563412f},
-std::array<float,2>{0.788158f, 0.729854703f},
-std::array<float,2>{0.957953334f, 0.0346188806f},
-std::array<float,2>{0.228330284f, 0.606519341f},
-std::array<float,2>{0.32763648f, 0.310852528f},
-std::array<float,2>{0.510763764f, 0.753322542f},
-std::array<float,2>{0.917798221f, 0.460318416f},
-std::array<float,2>{0.132001892f, 0.950034678f},
-std::array<float,2>{0.294780493f, 0.176122263f},
-std::array<float,2>{0.617824256f, 0.64537704f},
-std::array<float,2>{0.69792366f, 0.07384523f},
-std::array<float,2>{0.484997869f, 0.551379323f},
-std::array<float,2>{0.0216323026f, 0.357595742f},
-std::array<float,2>{0.838456869f, 0.835011661f},
-std::array<float,2>{0.556861877f, 0.273250908f},
-std::array<float,2>{0.368566334f, 0.802550375f},
-std::array<float,2>{0.208930984f, 0.0097078057f},
-std::array<float,2>{0.995597064f, 0.571579814f},
-std::array<float,2>{0.755859137f, 0.188278332f},
-std::array<float,2>{0.0738762543f, 0.706407547f},
-std::array<float,2>{0.399049163f, 0.424776882f},
-std::array<float,2>{0.642610013f, 0.89024967f},
-std::array<float,2>{0.752166748f, 0.483455271f},
-std::array<float,2>{0.0777932256f, 0.987158f},
-std::array<float,2>{0.403695613f, 0.133410782f},
-std::array<float,2>{0.647733152f, 0.670029581f},
-std::array<float,2>{0.560454607f, 0.0955626592f},
-std::array<float,2>{0.374489993f, 0.513543129f},
-std::array<float,2>{0.205556363f, 0.335849702f},
-std::array<float,2>{0.998785019f, 0.862277985f},
-std::array<float,2>{0.699599087f, 0.282205224f},
-std::array<float,2>{0.48909384f, 0.769818544f},
-std::array<float,2>{0.0188165195f, 0.0491497889f},
-std::array<float,2>{0.839989722f, 0.616289079f},
-std::array<float,2>{0.918019891f, 0.228426471f},
-std::array<float,2>{0.125532851f, 0.737384498f},
-std::array<float,2>{0.292356849f, 0.377682179f},
-std::array<float,2>{0.624504983f, 0.921289146f},
-std::array<float,2>{0.956339777f, 0.370596647f},
-std::array<float,2>{0.232015505f, 0.826440036f},
-std::array<float,2>{0.320537716f, 0.0830965787f},
-std::array<float,2>{0.515602291f, 0.545500398f},
-std::array<float,2>{0.663946867f, 0.171692565f},
-std::array<float,2>{0.42863515f, 0.635105431f},
-std::array<float,2>{0.106332518f, 0.448434412f},
-std::array<float,2>{0.782651424f, 0.964690149f},
-std::array<float,2>{0.576536596f, 0.40706867f},
-std::array<float,2>{0.264188707f, 0.898173928f},
-std::array<float,2>{0.170099691f, 0.214834735f},
-std::array<float,2>{0.897232234f, 0.690707505f},
-std::array<float,2>{0.854607463f, 0.026868429f},
-std::array<float,2>{0.0397756621f, 0.593143046f},
-std::array<float,2>{0.453348666f, 0.25129956f},
-std::array<float,2>{0.721487999f, 0.795131028f},
-std::array<float,2>{0.818396986f, 0.274016738f},
-std::array<float,2>{0.00929149333f, 0.8054654f},
-std::array<float,2>{0.478654593f, 0.00590520585f},
-std::array<float,2>{0.717831552f, 0.563802302f},
-std::array<float,2>{0.606920123f, 0.200465336f},
-std::array<float,2>{0.305752784f, 0.71228987f},
-std::array<float,2>{0.147073001f, 0.434418678f},
-std::array<float,2>{0.93181777f, 0.880040526f},
-std::array<float,2>{0.626235306f, 0.467910469f},
-std::array<float,2>{0.379945219f, 0.941150844f},
-std::array<float,2>{0.0887705833f, 0.18689096f},
-std::array<float,2>{0.76993084f, 0.650316775f},
-std::array<float,2>{0.974838257f, 0.0632349625f},
-std::array<float,2>{0.194488391f, 0.559372306f},
-std::array<float,2>{0.358077168f, 0.349015117f},
-std::array<float,2>{0.536586463f, 0.841992259f},
-std::array<float,2>{0.888823628f, 0.392427295f},
-std::array<float,2>{0.183369562f, 0.934371293f},
-std::array<float,2>{0.268871844f, 0.235708788f},
-std::array<float,2>{0.584871471f, 0.724003553f},
-std::array<float,2>{0.740784585f, 0.0430298373f},
-std::array<float,2>{0.452349544f, 0.599238873f},
-std::array<float,2>{0.0598487407f, 0.301196516f},
-std::array<float,2>{0.861560345f, 0.761803806f},
-std::array<float,2>{0.520572305f, 0.323208034f},
-std::array<float,2>{0.333827734f, 0.849549592f},
-std::array<float,2>{0.239844188f, 0.110334784f},
-std::array<float,2>{0.946694374f, 0.524396241f},
-std::array<float,2>{0.804975092f, 0.143769547f},
-std::array<float,2>{0.114037126f, 0.676909864f},
-std::array<float,2>{0.417564273f, 0.495138615f},
-std::array<float,2>{0.672972977f, 0.975305796f},
-std::array<float,2>{0.871720493f, 0.426323861f},
-std::array<float,2>{0.0506249815f, 0.883875787f},
-std::array<float,2>{0.443388462f, 0.194702521f},
-std::array<float,2>{0.746066272f, 0.708561063f},
-std::array<float,2>{0.593458354f, 0.0155818919f},
-std::array<float,2>{0.277212739f, 0.574962318f},
-std::array<float,2>{0.175391048f, 0.266672343f},
-std::array<float,2>{0.875843167f, 0.800473928f},
-std::array<float,2>{0.680969059f, 0.353278786f},
-std::array<float,2>{0.412834615f, 0.829025984f},
-std::array<float,2>{0.123659894f, 0.0768003464f},
-std::array<float,2>{0.803741217f, 0.548625231f},
-std::array<float,2>{0.941281796f, 0.173552155f},
-std::array<float,2>{0.249383375f, 0.641555071f},
-std::array<float,2>{0.339993387f, 0.453488231f},
-std::array<float,2>{0.524306834f, 0.9459548f},
-std::array<float,2>{0.928381383f, 0.307430029f},
-std::array<float,2>{0.154093057f, 0.755653203f},
-std::array<float,2>{0.301518351f, 0.0374005102f},
-std::array<float,2>{0.600741029f, 0.603098094f},
-std::array<float,2>{0.709406734f, 0.248694628f},
-std::array<float,2>{0.472962946f, 0.73400265f},
-std::array<float,2>{0.00629438087f, 0.401174963f},
-std::array<float,2>{0.823078275f, 0.925929248f},
-std::array<float,2>{0.539130747f, 0.487013906f},
-std::array<float,2>{0.35104543f, 0.976661682f},
-std::array<float,2>{0.199559689f, 0.151817232f},
-std::array<float,2>{0.98241806f, 0.685433149f},
-std::array<float,2>{0.77486217f, 0.123040028f},
-std::array<float,2>{0.0828830227f, 0.51715368f},
-std::array<float,2>{0.38810572f, 0.315553367f},
-std::array<float,2>{0.632974267f, 0.856526077f},
-std::array<float,2>{0.796214998f, 0.342324167f},
-std::array<float,2>{0.0946754366f, 0.871577024f},
-std::array<float,2>{0.434138924f, 0.107027069f},
-std::array<float,2>{0.665318429f, 0.500374496f},
-std::array<float,2>{0.500417709f, 0.129809052f},
-std::array<float,2>{0.313852131f, 0.656297922f},
-std::array<float,2>{0.221425593f, 0.476305068f},
-std::array<float,2>{0.964633882f, 0.994410157f},
-std::array<float,2>{0.729928195f, 0.386114568f},
-std::array<float,2>{0.464326829f, 0.911634862f},
-std::array<float,2>{0.0338996053f, 0.225798413f},
-std::array<float,2>{0.846921325f, 0.745509982f},
-std::array<float,2>{0.902779162f, 0.0549573824f},
-std::array<float,2>{0.159688234f, 0.624567091f},
-std::array<float,2>{0.253399163f, 0.293095917f},
-std::array<float,2>{0.568927348f, 0.777266443f},
-std::array<float,2>{0.990435541f, 0.438742191f},
-std::array<float,2>{0.217413098f, 0.959500909f},
-std::array<float,2>{0.366776288f, 0.156489104f},
-std::array<float,2>{0.553968012f, 0.6309219f},
-std::array<float,2>{0.648454726f, 0.092825681f},
-std::array<float,2>{0.395541817f, 0.533042073f},
-std::array<float,2>{0.0672760829f, 0.360102087f},
-std::array<float,2>{0.761112154f, 0.813222528f},
-std::array<float,2>{0.613205135f, 0.257877767f},
-std::array<float,2>{0.28448382f, 0.787373245f},
-std::array<float,2>{0.134482473f, 0.0169271138f},
-std::array<float,2>{0.908842206f, 0.578938484f},
-std::array<float,2>{0.830225766f, 0.20923911f},
-std::array<float,2>{0.0270496085f, 0.702585578f},
-std::array<float,2>{0.494468898f, 0.415942878f},
-std::array<float,2>{0.692069769f, 0.901169777f},
-std::array<float,2>{0.838170648f, 0.457338452f},
-std::array<float,2>{0.0222872198f, 0.951408148f},
-std::array<float,2>{0.4845227f, 0.178322881f},
-std::array<float,2>{0.697685301f, 0.64709276f},
-std::array<float,2>{0.617609739f, 0.0709747821f},
-std::array<float,2>{0.29408583f, 0.554255247f},
-std::array<float,2>{0.13246876f, 0.357091367f},
-std::array<float,2>{0.917461216f, 0.832518876f},
-std::array<float,2>{0.643349051f, 0.270847678f},
-std::array<float,2>{0.398911059f, 0.802858233f},
-std::array<float,2>{0.0737099648f, 0.0106968172f},
-std::array<float,2>{0.755351424f, 0.572907031f},
-std::array<float,2>{0.995863378f, 0.190878481f},
-std::array<float,2>{0.208279833f, 0.704434454f},
-std::array<float,2>{0.368927658f, 0.421958745f},
-std::array<float,2>{0.557594478f, 0.888392806f},
-std::array<float,2>{0.891006768f, 0.318682104f},
-std::array<float,2>{0.165205956f, 0.853273273f},
-std::array<float,2>{0.258723885f, 0.11723166f},
-std::array<float,2>{0.570986688f, 0.521295011f},
-std::array<float,2>{0.726549089f, 0.154643655f},
-std::array<float,2>{0.458561212f, 0.681199908f},
-std::array<float,2>{0.0448712781f, 0.488340557f},
-std::array<float,2>{0.857997835f, 0.981588721f},
-std::array<float,2>{0.51165849f, 0.403252602f},
-std::array<float,2>{0.327699274f, 0.92377162f},
-std::array<float,2>{0.227851957f, 0.244804591f},
-std::array<float,2>{0.957287908f, 0.726790607f},
-std::array<float,2>{0.788605452f, 0.032538414f},
-std::array<float,2>{0.102601625f, 0.607994258f},
-std::array<float,2>{0.42456159f, 0.308740228f},
-std::array<float,2>{0.657209694f, 0.751137137f},
-std::array<float,2>{0.769001007f, 0.292733222f},
-std::array<float,2>{0.0906219408f, 0.780385196f},
-std::array<float,2>{0.37565428f, 0.0603791885f},
-std::array<float,2>{0.631833673f, 0.617996037f},
-std::array<float,2>{0.53485018f, 0.221092865f},
-std::array<float,2>{0.354447693f, 0.748780191f},
-std::array<float,2>{0.189546272f, 0.389159143f},
-std::array<float,2>{0.969742119f, 0.907988906f},
-std::array<float,2>{0.711524606f, 0.469068885f},
-std::array<float,2>{0.482328624f, 0.999914706f},
-std::array<float,2>{0.0131867686f, 0.127387583f},
-std::array<float,2>{0.81598109f, 0.661215723f},
-std::array<float,2>{0.936227083f, 0.105191775f},
-std::array<float,2>{0.142706826f, 0.507001221f},
-std::array<float,2>{0.31141156f, 0.339454532f},
-std::array<float,2>{0.601670146f, 0.868093908f},
-std::array<float,2>{0.949988842f, 0.418382138f},
-std::array<float,2>{0.234506413f, 0.90488869f},
-std::array<float,2>{0.33187449f, 0.205200359f},
-std::array<float,2>{0.517119944f, 0.698582947f},
-std::array<float,2>{0.676969886f, 0.0233727302f},
-std::array<float,2>{0.4192141f, 0.585820854f},
-std::array<float,2>{0.109690093f, 0.264814138f},
-std::array<float,2>{0.811496317f, 0.784601808f},
-std::array<float,2>{0.579610229f, 0.364856452f},
-std::array<float,2>{0.272529751f, 0.817318857f},
-std::array<float,2>{0.1863361f, 0.0867062807f},
-std::array<float,2>{0.885007501f, 0.535990179f},
-std::array<float,2>{0.866881609f, 0.16193682f},
-std::array<float,2>{0.0583066307f, 0.625370324f},
-std::array<float,2>{0.44689101f, 0.442614824f},
-std::array<float,2>{0.737504303f, 0.955300808f},
-std::array<float,2>{0.800362229f, 0.379212081f},
-std::array<float,2>{0.11979536f, 0.915603578f},
-std::array<float,2>{0.40752098f, 0.232871756f},
-std::array<float,2>{0.683618367f, 0.741267681f},
-std::array<float,2>{0.528381765f, 0.052235648f},
-std::array<float,2>{0.338273019f, 0.612688243f},
-std::array<float,2>{0.245547116f, 0.287014633f},
-std::array<float,2>{0.94424361f, 0.76826936f},
-std::array<float,2>{0.74993962f, 0.331587017f},
-std::array<float,2>{0.438598573f, 0.86337626f},
-std::array<float,2>{0.0510948636f, 0.101173237f},
-std::array<float,2>{0.869040012f, 0.509333253f},
-std::array<float,2>{0.88019681f, 0.137138382f},
-std::array<float,2>{0.178495854f, 0.665887535f},
-std::array<float,2>{0.278723717f, 0.478137732f},
-std::array<float,2>{0.589680076f, 0.991549313f},
-std::array<float,2>{0.97890991f, 0.254645258f},
-std::array<float,2>{0.195764691f, 0.792381525f},
-std::array<float,2>{0.345413685f, 0.0297479033f},
-std::array<float,2>{0.546521246f, 0.589535713f},
-std::array<float,2>{0.640312016f, 0.216512442f},
-std::array<float,2>{0.385617048f, 0.6935516f},
-std::array<float,2>{0.0817016885f, 0.411666363f},
-std::array<float,2>{0.778676987f, 0.89420867f},
-std::array<float,2>{0.597472548f, 0.449640095f},
-std::array<float,2>{0.298688561f, 0.967546999f},
-std::array<float,2>{0.149012432f, 0.165265739f},
-std::array<float,2>{0.924705625f, 0.637898028f},
-std::array<float,2>{0.826314628f, 0.0789963603f},
-std::array<float,2>{0.00257513579f, 0.542170405f},
-std::array<float,2>{0.469369382f, 0.372885317f},
-std::array<float,2>{0.705476463f, 0.821772933f},
-std::array<float,2>{0.850268662f, 0.346980125f},
-std::array<float,2>{0.0364247262f, 0.838141561f},
-std::array<float,2>{0.466817141f, 0.067293644f},
-std::array<float,2>{0.732730329f, 0.557744503f},
-std::array<float,2>{0.565662026f, 0.180960625f},
-std::array<float,2>{0.257063061f, 0.652842164f},
-std::array<float,2>{0.162576169f, 0.461336046f},
-std::array<float,2>{0.900258899f, 0.944412768f},
-std::array<float,2>{0.6717664f, 0.430180132f},
-std::array<float,2>{0.431616336f, 0.878511488f},
-std::array<float,2>{0.0992686227f, 0.197580442f},
-std::array<float,2>{0.791160703f, 0.717928708f},
-std::array<float,2>{0.96523267f, 0.000211572973f},
-std::array<float,2>{0.225123435f, 0.568057001f},
-std::array<float,2>{0.317179531f, 0.280404598f},
-std::array<float,2>{0.506819248f, 0.811113954f},
-std::array<float,2>{0.913546443f, 0.496162206f},
-std::array<float,2>{0.137650684f, 0.971871853f},
-std::array<float,2>{0.288222104f, 0.147009909f},
-std::array<float,2>{0.615451694f, 0.675079823f},
-std::array<float,2>{0.688759744f, 0.11677777f},
-std::array<float,2>{0.49662596f, 0.529627681f},
-std::array<float,2>{0.0290057492f, 0.324694097f},
-std::array<float,2>{0.833900213f, 0.845954657f},
-std::array<float,2>{0.549928188f, 0.297050834f},
-std::array<float,2>{0.362063259f, 0.760497153f},
-std::array<float,2>{0.213543937f, 0.0409869514f},
-std::array<float,2>{0.985478103f, 0.596140921f},
-std::array<float,2>{0.761819184f, 0.239950687f},
-std::array<float,2>{0.0637514666f, 0.719622016f},
-std::array<float,2>{0.392557472f, 0.395804435f},
-std::array<float,2>{0.654974997f, 0.931810141f},
-std::array<float,2>{0.784554839f, 0.445751458f},
-std::array<float,2>{0.108741537f, 0.962674916f},
-std::array<float,2>{0.42588377f, 0.169584736f},
-std::array<float,2>{0.661472857f, 0.633977652f},
-std::array<float,2>{0.513228536f, 0.0845713168f},
-std::array<float,2>{0.322410405f, 0.543355167f},
-std::array<float,2>{0.232479095f, 0.367565602f},
-std::array<float,2>{0.953893781f, 0.825876236f},
-std::array<float,2>{0.719640553f, 0.253568321f},
-std::array<float,2>{0.456876695f, 0.794212103f},
-std::array<float,2>{0.0416808464f, 0.0249809586f},
-std::array<float,2>{0.853475451f, 0.589883626f},
-std::array<float,2>{0.896393657f, 0.211996526f},
-std::array<float,2>{0.1692013f, 0.6880005f},
-std::array<float,2>{0.26212272f, 0.409330904f},
-std::array<float,2>{0.574780881f, 0.895376623f},
-std::array<float,2>{0.997562468f, 0.332125187f},
-std::array<float,2>{0.204736203f, 0.8604182f},
-std::array<float,2>{0.371457875f, 0.0962989181f},
-std::array<float,2>{0.561390638f, 0.514875352f},
-std::array<float,2>{0.645312071f, 0.13591817f},
-std::array<float,2>{0.406090438f, 0.66916889f},
-std::array<float,2>{0.074423328f, 0.481095761f},
-std::array<float,2>{0.750291228f, 0.984720051f},
-std::array<float,2>{0.622880042f, 0.375814617f},
-std::array<float,2>{0.289754629f, 0.919397652f},
-std::array<float,2>{0.127896458f, 0.229816243f},
-std::array<float,2>{0.920226336f, 0.735389769f},
-std::array<float,2>{0.842066824f, 0.0472571552f},
-std::array<float,2>{0.016038768f, 0.613798022f},
-std::array<float,2>{0.491038352f, 0.284213245f},
-std::array<float,2>{0.701269627f, 0.772598445f},
-std::array<float,2>{0.86030668f, 0.304296911f},
-std::array<float,2>{0.0620119646f, 0.765212655f},
-std::array<float,2>{0.450100541f, 0.0457430221f},
-std::array<float,2>{0.740036666f, 0.601365507f},
-std::array<float,2>{0.583568335f, 0.23796241f},
-std::array<float,2>{0.266794294f, 0.725291729f},
-std::array<float,2>{0.181173652f, 0.393434405f},
-std::array<float,2>{0.887215734f, 0.936187923f},
-std::array<float,2>{0.67399013f, 0.492548913f},
-std::array<float,2>{0.414929926f, 0.973823071f},
-std::array<float,2>{0.116118304f, 0.140791103f},
-std::array<float,2>{0.808333755f, 0.678382516f},
-std::array<float,2>{0.948996902f, 0.11161501f},
-std::array<float,2>{0.240703776f, 0.525869668f},
-std::array<float,2>{0.334018528f, 0.320827097f},
-std::array<float,2>{0.521862686f, 0.850681126f},
-std::array<float,2>{0.93002063f, 0.436416239f},
-std::array<float,2>{0.144893169f, 0.881954253f},
-std::array<float,2>{0.307106227f, 0.202723294f},
-std::array<float,2>{0.608901858f, 0.714004815f},
-std::array<float,2>{0.71501869f, 0.00563148921f},
-std::array<float,2>{0.478314608f, 0.566121757f},
-std::array<float,2>{0.0112246955f, 0.276744097f},
-std::array<float,2>{0.816804051f, 0.807168424f},
-std::array<float,2>{0.53880167f, 0.350504786f},
-std::array<float,2>{0.357347757f, 0.841101527f},
-std::array<float,2>{0.193255261f, 0.0647718534f},
-std::array<float,2>{0.974587679f, 0.561734021f},
-std::array<float,2>{0.773308575f, 0.185474113f},
-std::array<float,2>{0.0862774476f, 0.651109338f},
-std::array<float,2>{0.38169378f, 0.46606347f},
-std::array<float,2>{0.627140462f, 0.938637555f},
-std::array<float,2>{0.821342289f, 0.399057478f},
-std::array<float,2>{0.00457242783f, 0.928028107f},
-std::array<float,2>{0.47518602f, 0.247733697f},
-std::array<float,2>{0.707391441f, 0.731154263f},
-std::array<float,2>{0.597755611f, 0.036753647f},
-std::array<float,2>{0.303986907f, 0.604845107f},
-std::array<float,2>{0.155456647f, 0.305605859f},
-std::array<float,2>{0.926697731f, 0.756054699f},
-std::array<float,2>{0.635202706f, 0.313124627f},
-std::array<float,2>{0.39020589f, 0.858501017f},
-std::array<float,2>{0.0845835656f, 0.124324456f},
-std::array<float,2>{0.776681364f, 0.518966258f},
-std::array<float,2>{0.982982099f, 0.15037784f},
-std::array<float,2>{0.201498196f, 0.687008917f},
-std::array<float,2>{0.348748833f, 0.485026658f},
-std::array<float,2>{0.541394711f, 0.979596257f},
-std::array<float,2>{0.878570139f, 0.26771301f},
-std::array<float,2>{0.172640279f, 0.797159553f},
-std::array<float,2>{0.273683131f, 0.0135054085f},
-std::array<float,2>{0.590538323f, 0.577887535f},
-std::array<float,2>{0.744054854f, 0.191606402f},
-std::array<float,2>{0.441606909f, 0.709576428f},
-std::array<float,2>{0.0483725332f, 0.429328412f},
-std::array<float,2>{0.874877393f, 0.885532379f},
-std::array<float,2>{0.526196778f, 0.456154019f},
-std::array<float,2>{0.342825234f, 0.947840929f},
-std::array<float,2>{0.247425199f, 0.174756333f},
-std::array<float,2>{0.938928962f, 0.643949449f},
-std::array<float,2>{0.801173747f, 0.0757030249f},
-std::array<float,2>{0.121614456f, 0.548897684f},
-std::array<float,2>{0.410604864f, 0.354739189f},
-std::array<float,2>{0.682579219f, 0.831003249f},
-std::array<float,2>{0.758034885f, 0.362361461f},
-std::array<float,2>{0.0689068213f, 0.816074908f},
-std::array<float,2>{0.396806657f, 0.0901722386f},
-std::array<float,2>{0.650909841f, 0.534902096f},
-std::array<float,2>{0.550997555f, 0.159361631f},
-std::array<float,2>{0.365064442f, 0.630469859f},
-std::array<float,2>{0.215507105f, 0.440968275f},
-std::array<float,2>{0.989706755f, 0.958125412f},
-std::array<float,2>{0.694230497f, 0.417899221f},
-std::array<float,2>{0.492736489f, 0.898941636f},
-std::array<float,2>{0.0243707728f, 0.208599791f},
-std::array<float,2>{0.829460561f, 0.700509429f},
-std::array<float,2>{0.907016575f, 0.0178685449f},
-std::array<float,2>{0.135562882f, 0.581865311f},
-std::array<float,2>{0.281928718f, 0.261021137f},
-std::array<float,2>{0.609863341f, 0.785471439f},
-std::array<float,2>{0.961698055f, 0.473139882f},
-std::array<float,2>{0.22059606f, 0.992246747f},
-std::array<float,2>{0.315728605f, 0.131118611f},
-std::array<float,2>{0.503742754f, 0.658897042f},
-std::array<float,2>{0.66739589f, 0.107537664f},
-std::array<float,2>{0.437209815f, 0.503472328f},
-std::array<float,2>{0.0976512209f, 0.341055959f},
-std::array<float,2>{0.79391098f, 0.873419583f},
-std::array<float,2>{0.566823065f, 0.295352101f},
-std::array<float,2>{0.251832426f, 0.773529768f},
-std::array<float,2>{0.157488853f, 0.0581399538f},
-std::array<float,2>{0.905805469f, 0.621254444f},
-std::array<float,2>{0.844730794f, 0.223007157f},
-std::array<float,2>{0.0323734805f, 0.743202388f},
-std::array<float,2>{0.461822301f, 0.383701116f},
-std::array<float,2>{0.726752281f, 0.913182497f},
-std::array<float,2>{0.855764925f, 0.490736365f},
-std::array<float,2>{0.0464619584f, 0.982933939f},
-std::array<float,2>{0.460022718f, 0.15239653f},
-std::array<float,2>{0.724186718f, 0.683443367f},
-std::array<float,2>{0.57368356f, 0.120687023f},
-std::array<float,2>{0.261246353f, 0.523283482f},
-std::array<float,2>{0.167948559f, 0.317648858f},
-std::array<float,2>{0.893215775f, 0.854289651f},
-std::array<float,2>{0.659525335f, 0.311302364f},
-std::array<float,2>{0.422373295f, 0.75367254f},
-std::array<float,2>{0.105135716f, 0.0347382762f},
-std::array<float,2>{0.785307705f, 0.607146442f},
-std::array<float,2>{0.960546732f, 0.242906198f},
-std::array<float,2>{0.22989516f, 0.730120003f},
-std::array<float,2>{0.326000422f, 0.404954731f},
-std::array<float,2>{0.50783962f, 0.924359798f},
-std::array<float,2>{0.914720356f, 0.358016312f},
-std::array<float,2>{0.12991178f, 0.835827351f},
-std::array<float,2>{0.295810223f, 0.073548086f},
-std::array<float,2>{0.619726241f, 0.550994158f},
-std::array<float,2>{0.69686383f, 0.176413819f},
-std::array<float,2>{0.487209916f, 0.644700944f},
-std::array<float,2>{0.0201420579f, 0.46062997f},
-std::array<float,2>{0.837308407f, 0.949592888f},
-std::array<float,2>{0.555580139f, 0.423930258f},
-std::array<float,2>{0.370614409f, 0.890021443f},
-std::array<float,2>{0.209838301f, 0.187623635f},
-std::array<float,2>{0.993029416f, 0.706591427f},
-std::array<float,2>{0.75780952f, 0.00897770002f},
-std::array<float,2>{0.071479328f, 0.572255671f},
-std::array<float,2>{0.400427699f, 0.272748828f},
-std::array<float,2>{0.640897155f, 0.802053094f},
-std::array<float,2>{0.809704542f, 0.26242575f},
-std::array<float,2>{0.112010427f, 0.783015847f},
-std::array<float,2>{0.420464963f, 0.0213409252f},
-std::array<float,2>{0.679069042f, 0.582791388f},
-std::array<float,2>{0.519064665f, 0.20403412f},
-std::array<float,2>{0.328252614f, 0.695552289f},
-std::array<float,2>{0.237168998f, 0.421785176f},
-std::array<float,2>{0.95122081f, 0.902761459f},
-std::array<float,2>{0.734793544f, 0.443831563f},
-std::array<float,2>{0.448807985f, 0.954706192f},
-std::array<float,2>{0.0548800156f, 0.162637264f},
-std::array<float,2>{0.864396513f, 0.628766716f},
-std::array<float,2>{0.883617163f, 0.088233754f},
-std::array<float,2>{0.18499139f, 0.53855598f},
-std::array<float,2>{0.271402895f, 0.365273297f},
-std::array<float,2>{0.581245124f, 0.819975674f},
-std::array<float,2>{0.971281648f, 0.386778146f},
-std::array<float,2>{0.188012823f, 0.909422636f},
-std::array<float,2>{0.352404416f, 0.218882293f},
-std::array<float,2>{0.532312512f, 0.747068167f},
-std::array<float,2>{0.630549371f, 0.0610257275f},
-std::array<float,2>{0.377850235f, 0.620112836f},
-std::array<float,2>{0.0932319909f, 0.290634245f},
-std::array<float,2>{0.767515898f, 0.777981699f},
-std::array<float,2>{0.603623986f, 0.336265206f},
-std::array<float,2>{0.310327977f, 0.870115042f},
-std::array<float,2>{0.142100275f, 0.101795129f},
-std::array<float,2>{0.934125543f, 0.503954113f},
-std::array<float,2>{0.813097f, 0.125715673f},
-std::array<float,2>{0.0155103831f, 0.662467837f},
-std::array<float,2>{0.483389109f, 0.471362531f},
-std::array<float,2>{0.714618862f, 0.996760368f},
-std::array<float,2>{0.779394031f, 0.413592547f},
-std::array<float,2>{0.0794397369f, 0.892150223f},
-std::array<float,2>{0.383882582f, 0.217684671f},
-std::array<float,2>{0.638179302f, 0.692812562f},
-std::array<float,2>{0.544245303f, 0.027883742f},
-std::array<float,2>{0.346228093f, 0.586204946f},
-std::array<float,2>{0.198300615f, 0.257248044f},
-std::array<float,2>{0.976704955f, 0.789170563f},
-std::array<float,2>{0.703718543f, 0.373724312f},
-std::array<float,2>{0.471541971f, 0.822513521f},
-std::array<float,2>{0.00139729551f, 0.0811674893f},
-std::array<float,2>{0.825971842f, 0.540496051f},
-std::array<float,2>{0.922980547f, 0.166161656f},
-std::array<float,2>{0.152197033f, 0.640530467f},
-std::array<float,2>{0.300062597f, 0.45203504f},
-std::array<float,2>{0.594783485f, 0.965035856f},
-std::array<float,2>{0.941983283f, 0.288192421f},
-std::array<float,2>{0.243208498f, 0.767174721f},
-std::array<float,2>{0.336075336f, 0.0539811142f},
-std::array<float,2>{0.529648781f, 0.610823035f},
-std::array<float,2>{0.685967743f, 0.231730506f},
-std::array<float,2>{0.41009903f, 0.739047825f},
-std::array<float,2>{0.118132681f, 0.382079303f},
-std::array<float,2>{0.798185706f, 0.916507185f},
-std::array<float,2>{0.587515712f, 0.478788525f},
-std::array<float,2>{0.280385882f, 0.989960134f},
-std::array<float,2>{0.176250979f, 0.140085548f},
-std::array<float,2>{0.881472588f, 0.667948425f},
-std::array<float,2>{0.870196939f, 0.0995384455f},
-std::array<float,2>{0.0530348495f, 0.510919034f},
-std::array<float,2>{0.440833896f, 0.328626931f},
-std::array<float,2>{0.746945798f, 0.865836382f},
-std::array<float,2>{0.835709333f, 0.328040153f},
-std::array<float,2>{0.0293863975f, 0.844771266f},
-std::array<float,2>{0.499741167f, 0.115176164f},
-std::array<float,2>{0.691099703f, 0.527566075f},
-std::array<float,2>{0.613410771f, 0.145875201f},
-std::array<float,2>{0.285918117f, 0.672189116f},
-std::array<float,2>{0.140055805f, 0.499995291f},
-std::array<float,2>{0.911617696f, 0.970341861f},
-std::array<float,2>{0.6534518f, 0.39657262f},
-std::array<float,2>{0.393660218f, 0.929924965f},
-std::array<float,2>{0.0650287122f, 0.240765303f},
-std::array<float,2>{0.76409024f, 0.722087801f},
-std::array<float,2>{0.987941802f, 0.0421571322f},
-std::array<float,2>{0.212546974f, 0.595493555f},
-std::array<float,2>{0.359476149f, 0.299336016f},
-std::array<float,2>{0.54853797f, 0.7595855f},
-std::array<float,2>{0.900509953f, 0.463047147f},
-std::array<float,2>{0.161093205f, 0.941864073f},
-std::array<float,2>{0.254077613f, 0.183317482f},
-std::array<float,2>{0.563887894f, 0.655046999f},
-std::array<float,2>{0.731610715f, 0.069534421f},
-std::array<float,2>{0.464931965f, 0.556560218f},
-std::array<float,2>{0.0373953469f, 0.344734281f},
-std::array<float,2>{0.849531174f, 0.837618947f},
-std::array<float,2>{0.505048871f, 0.27773416f},
-std::array<float,2>{0.319689959f, 0.80860275f},
-std::array<float,2>{0.224079669f, 0.00289803976f},
-std::array<float,2>{0.96815896f, 0.569482625f},
-std::array<float,2>{0.79041189f, 0.196737185f},
-std::array<float,2>{0.0998976454f, 0.716433048f},
-std::array<float,2>{0.432764828f, 0.433460712f},
-std::array<float,2>{0.66818434f, 0.876163721f},
-std::array<float,2>{0.806666315f, 0.495078027f},
-std::array<float,2>{0.116269797f, 0.97652781f},
-std::array<float,2>{0.415677309f, 0.143137157f},
-std::array<float,2>{0.675055683f, 0.675808311f},
-std::array<float,2>{0.523283243f, 0.110856056f},
-std::array<float,2>{0.335292041f, 0.525385499f},
-std::array<float,2>{0.241799206f, 0.323692679f},
-std::array<float,2>{0.9473418f, 0.848161936f},
-std::array<float,2>{0.738979518f, 0.301924139f},
-std::array<float,2>{0.450814217f, 0.763122141f},
-std::array<float,2>{0.0608985536f, 0.044283215f},
-std::array<float,2>{0.861251295f, 0.597816408f},
-std::array<float,2>{0.888503373f, 0.235139847f},
-std::array<float,2>{0.179836005f, 0.722938836f},
-std::array<float,2>{0.266398579f, 0.390739322f},
-std::array<float,2>{0.582216084f, 0.935211241f},
-std::array<float,2>{0.973329723f, 0.348366231f},
-std::array<float,2>{0.192051277f, 0.842914999f},
-std::array<float,2>{0.3555336f, 0.0634922758f},
-std::array<float,2>{0.537626505f, 0.559708774f},
-std::array<float,2>{0.628637135f, 0.185623303f},
-std::array<float,2>{0.382329732f, 0.648547113f},
-std::array<float,2>{0.0874220282f, 0.466853499f},
-std::array<float,2>{0.771501601f, 0.939958215f},
-std::array<float,2>{0.607916296f, 0.434889942f},
-std::array<float,2>{0.30788362f, 0.878989756f},
-std::array<float,2>{0.145642281f, 0.200127691f},
-std::array<float,2>{0.931390405f, 0.71177125f},
-std::array<float,2>{0.817549527f, 0.00725434814f},
-std::array<float,2>{0.0107094459f, 0.563339472f},
-std::array<float,2>{0.476730824f, 0.275287449f},
-std::array<float,2>{0.716094196f, 0.805821121f},
-std::array<float,2>{0.851910174f, 0.250453442f},
-std::array<float,2>{0.0427211225f, 0.796553791f},
-std::array<float,2>{0.455345035f, 0.0256606415f},
-std::array<float,2>{0.720124662f, 0.592465639f},
-std::array<float,2>{0.575614035f, 0.213058978f},
-std::array<float,2>{0.263148189f, 0.689499319f},
-std::array<float,2>{0.168821052f, 0.407880485f},
-std::array<float,2>{0.894588888f, 0.897066176f},
-std::array<float,2>{0.660398662f, 0.447924912f},
-std::array<float,2>{0.427031785f, 0.963734388f},
-std::array<float,2>{0.108327061f, 0.170236006f},
-std::array<float,2>{0.784054458f, 0.636119127f},
-std::array<float,2>{0.955063283f, 0.0826910734f},
-std::array<float,2>{0.233745769f, 0.546801507f},
-std::array<float,2>{0.324168026f, 0.369208127f},
-std::array<float,2>{0.512569308f, 0.827875853f},
-std::array<float,2>{0.921145082f, 0.378284544f},
-std::array<float,2>{0.128616318f, 0.920834303f},
-std::array<float,2>{0.290066838f, 0.227452934f},
-std::array<float,2>{0.621413767f, 0.737264931f},
-std::array<float,2>{0.702596784f, 0.0506047197f},
-std::array<float,2>{0.491509795f, 0.615459263f},
-std::array<float,2>{0.0174433365f, 0.282869458f},
-std::array<float,2>{0.843215168f, 0.770573437f},
-std::array<float,2>{0.562199712f, 0.334637523f},
-std::array<float,2>{0.372738749f, 0.86237359f},
-std::array<float,2>{0.203408107f, 0.0943578035f},
-std::array<float,2>{0.996216834f, 0.512264848f},
-std::array<float,2>{0.751394749f, 0.134598583f},
-std::array<float,2>{0.0760333687f, 0.670994759f},
-std::array<float,2>{0.404874444f, 0.482664317f},
-std::array<float,2>{0.64648056f, 0.987642169f},
-std::array<float,2>{0.828952789f, 0.414330274f},
-std::array<float,2>{0.0245173387f, 0.901825666f},
-std::array<float,2>{0.493296921f, 0.210604995f},
-std::array<float,2>{0.695210099f, 0.7020154f},
-std::array<float,2>{0.611236036f, 0.0161007382f},
-std::array<float,2>{0.282844722f, 0.579950094f},
-std::array<float,2>{0.135875896f, 0.259664267f},
-std::array<float,2>{0.908040583f, 0.788532972f},
-std::array<float,2>{0.652125001f, 0.361145586f},
-std::array<float,2>{0.397682548f, 0.814247668f},
-std::array<float,2>{0.0695553869f, 0.0923433006f},
-std::array<float,2>{0.759108901f, 0.532217622f},
-std::array<float,2>{0.988620341f, 0.157947958f},
-std::array<float,2>{0.216714814f, 0.632176638f},
-std::array<float,2>{0.363687545f, 0.438168824f},
-std::array<float,2>{0.552097321f, 0.960611403f},
-std::array<float,2>{0.904392242f, 0.294320613f},
-std::array<float,2>{0.157202691f, 0.775886297f},
-std::array<float,2>{0.250492483f, 0.0561921448f},
-std::array<float,2>{0.567682087f, 0.623432934f},
-std::array<float,2>{0.72799772f, 0.225537002f},
-std::array<float,2>{0.462569177f, 0.744475842f},
-std::array<float,2>{0.0314409956f, 0.385507226f},
-std::array<float,2>{0.844135046f, 0.910610259f},
-std::array<float,2>{0.502191007f, 0.475452185f},
-std::array<float,2>{0.314849615f, 0.995266259f},
-std::array<float,2>{0.21945405f, 0.130600542f},
-std::array<float,2>{0.962375402f, 0.657639742f},
-std::array<float,2>{0.794533968f, 0.105510302f},
-std::array<float,2>{0.0962186679f, 0.50100261f},
-std::array<float,2>{0.436082721f, 0.343163103f},
-std::array<float,2>{0.666750371f, 0.873022497f},
-std::array<float,2>{0.775654852f, 0.314736605f},
-std::array<float,2>{0.0859043896f, 0.856035471f},
-std::array<float,2>{0.389036864f, 0.121803671f},
-std::array<float,2>{0.636055768f, 0.516560853f},
-std::array<float,2>{0.5423944f, 0.150764495f},
-std::array<float,2>{0.347827494f, 0.684500813f},
-std::array<float,2>{0.202778593f, 0.487663716f},
-std::array<float,2>{0.983491123f, 0.978288949f},
-std::array<float,2>{0.708008826f, 0.402308971f},
-std::array<float,2>{0.475797504f, 0.926801264f},
-std::array<float,2>{0.00497736875f, 0.249502793f},
-std::array<float,2>{0.820439696f, 0.732612789f},
-std::array<float,2>{0.927181482f, 0.0382368043f},
-std::array<float,2>{0.154503688f, 0.602275252f},
-std::array<float,2>{0.302899629f, 0.308527172f},
-std::array<float,2>{0.598725915f, 0.754362464f},
-std::array<float,2>{0.937789738f, 0.454594284f},
-std::array<float,2>{0.246691152f, 0.946710944f},
-std::array<float,2>{0.342065573f, 0.172264993f},
-std::array<float,2>{0.527342916f, 0.642394602f},
-std::array<float,2>{0.68321532f, 0.0780205876f},
-std::array<float,2>{0.411640167f, 0.546978772f},
-std::array<float,2>{0.122658148f, 0.351685375f},
-std::array<float,2>{0.802108943f, 0.829482138f},
-std::array<float,2>{0.590968907f, 0.26635322f},
-std::array<float,2>{0.274776101f, 0.799381018f},
-std::array<float,2>{0.172985852f, 0.0142184384f},
-std::array<float,2>{0.877880275f, 0.575565636f},
-std::array<float,2>{0.873172045f, 0.19401136f},
-std::array<float,2>{0.0477365181f, 0.707402647f},
-std::array<float,2>{0.443130434f, 0.426940978f},
-std::array<float,2>{0.742446303f, 0.883161187f},
-std::array<float,2>{0.863723516f, 0.442197382f},
-std::array<float,2>{0.0560193248f, 0.957017303f},
-std::array<float,2>{0.448161244f, 0.160821587f},
-std::array<float,2>{0.735667348f, 0.626083553f},
-std::array<float,2>{0.580143392f, 0.0878018215f},
-std::array<float,2>{0.269678742f, 0.536954761f},
-std::array<float,2>{0.18386212f, 0.363614023f},
-std::array<float,2>{0.884565353f, 0.817568302f},
-std::array<float,2>{0.678136528f, 0.263775706f},
-std::array<float,2>{0.421245366f, 0.783893943f},
-std::array<float,2>{0.112391286f, 0.0223111603f},
-std::array<float,2>{0.80907923f, 0.584660351f},
-std::array<float,2>{0.952820241f, 0.206775442f},
-std::array<float,2>{0.237841621f, 0.697582603f},
-std::array<float,2>{0.329555869f, 0.419017166f},
-std::array<float,2>{0.517990053f, 0.906068861f},
-std::array<float,2>{0.935357392f, 0.338756233f},
-std::array<float,2>{0.140736431f, 0.868568897f},
-std::array<float,2>{0.30874157f, 0.104035117f},
-std::array<float,2>{0.605406225f, 0.506201088f},
-std::array<float,2>{0.71341759f, 0.128728673f},
-std::array<float,2>{0.484340549f, 0.660893023f},
-std::array<float,2>{0.0144089311f, 0.470048815f},
-std::array<float,2>{0.813522935f, 0.998346031f},
-std::array<float,2>{0.531593382f, 0.390272051f},
-std::array<float,2>{0.352931827f, 0.906520605f},
-std::array<float,2>{0.189036295f, 0.222495094f},
-std::array<float,2>{0.972548723f, 0.749889314f},
-std::array<float,2>{0.766457438f, 0.0595540367f},
-std::array<float,2>{0.0924749598f, 0.618451655f},
-std::array<float,2>{0.378594905f, 0.291831434f},
-std::array<float,2>{0.629677296f, 0.779647768f},
-std::array<float,2>{0.78659749f, 0.310517967f},
-std::array<float,2>{0.10374365f, 0.750246227f},
-std::array<float,2>{0.423545897f, 0.031482242f},
-std::array<float,2>{0.658628225f, 0.609066367f},
-std::array<float,2>{0.509661078f, 0.245253474f},
-std::array<float,2>{0.32516697f, 0.728073776f},
-std::array<float,2>{0.229135454f, 0.403489292f},
-std::array<float,2>{0.959355175f, 0.922691107f},
-std::array<float,2>{0.7234568f, 0.489275277f},
-std::array<float,2>{0.459511727f, 0.98080039f},
-std::array<float,2>{0.045837149f, 0.156204671f},
-std::array<float,2>{0.85701859f, 0.680381f},
-std::array<float,2>{0.893971801f, 0.118758768f},
-std::array<float,2>{0.166793838f, 0.520134985f},
-std::array<float,2>{0.260618359f, 0.319344193f},
-std::array<float,2>{0.572706759f, 0.852460146f},
-std::array<float,2>{0.993477941f, 0.422868997f},
-std::array<float,2>{0.210578173f, 0.887180626f},
-std::array<float,2>{0.37004292f, 0.189708903f},
-std::array<float,2>{0.556403697f, 0.7038486f},
-std::array<float,2>{0.641898513f, 0.0114984298f},
-std::array<float,2>{0.402298063f, 0.574061871f},
-std::array<float,2>{0.0703430027f, 0.270089298f},
-std::array<float,2>{0.756013155f, 0.804321051f},
-std::array<float,2>{0.620612323f, 0.356326371f},
-std::array<float,2>{0.296576917f, 0.833428621f},
-std::array<float,2>{0.129462704f, 0.0718207806f},
-std::array<float,2>{0.915857494f, 0.553591549f},
-std::array<float,2>{0.836143553f, 0.179554403f},
-std::array<float,2>{0.0211707409f, 0.647686481f},
-std::array<float,2>{0.487563759f, 0.458720386f},
-std::array<float,2>{0.69586724f, 0.952849627f},
-std::array<float,2>{0.764951408f, 0.394754797f},
-std::array<float,2>{0.0661985874f, 0.933437824f},
-std::array<float,2>{0.392789751f, 0.238508344f},
-std::array<float,2>{0.652460098f, 0.720436513f},
-std::array<float,2>{0.547839224f, 0.0397384651f},
-std::array<float,2>{0.361058682f, 0.596721113f},
-std::array<float,2>{0.211155489f, 0.298577279f},
-std::array<float,2>{0.986688733f, 0.76114881f},
-std::array<float,2>{0.690333843f, 0.32519719f},
-std::array<float,2>{0.498305082f, 0.84760952f},
-std::array<float,2>{0.0307667702f, 0.115982488f},
-std::array<float,2>{0.834318697f, 0.530517817f},
-std::array<float,2>{0.910331249f, 0.148189172f},
-std::array<float,2>{0.139609098f, 0.674033701f},
-std::array<float,2>{0.286478519f, 0.497439682f},
-std::array<float,2>{0.61442399f, 0.97079277f},
-std::array<float,2>{0.967250943f, 0.27935183f},
-std::array<float,2>{0.223498493f, 0.811723471f},
-std::array<float,2>{0.31863305f, 0.00186801795f},
-std::array<float,2>{0.504043043f, 0.566867352f},
-std::array<float,2>{0.668955863f, 0.198450163f},
-std::array<float,2>{0.432363421f, 0.717402756f},
-std::array<float,2>{0.101460405f, 0.431333631f},
-std::array<float,2>{0.789272726f, 0.877011836f},
-std::array<float,2>{0.563062727f, 0.462288678f},
-std::array<float,2>{0.255281538f, 0.944093049f},
-std::array<float,2>{0.162101477f, 0.18006593f},
-std::array<float,2>{0.901948154f, 0.653853655f},
-std::array<float,2>{0.848590434f, 0.0678930134f},
-std::array<float,2>{0.0390329994f, 0.557158172f},
-std::array<float,2>{0.466689527f, 0.346598446f},
-std::array<float,2>{0.730602443f, 0.839538336f},
-std::array<float,2>{0.824867249f, 0.371748716f},
-std::array<float,2>{0.000958335586f, 0.820322156f},
-std::array<float,2>{0.471967906f, 0.0798493102f},
-std::array<float,2>{0.704725742f, 0.541547656f},
-std::array<float,2>{0.594459713f, 0.164423898f},
-std::array<float,2>{0.299237609f, 0.6369344f},
-std::array<float,2>{0.15115045f, 0.450622261f},
-std::array<float,2>{0.922346592f, 0.968103647f},
-std::array<float,2>{0.637592196f, 0.410743922f},
-std::array<float,2>{0.383377969f, 0.893530548f},
-std::array<float,2>{0.0787093639f, 0.214975178f},
-std::array<float,2>{0.781198978f, 0.695247591f},
-std::array<float,2>{0.977587044f, 0.0310340133f},
-std::array<float,2>{0.197563216f, 0.58812058f},
-std::array<float,2>{0.3472296f, 0.255102158f},
-std::array<float,2>{0.543925226f, 0.791710436f},
-std::array<float,2>{0.88277477f, 0.477051765f},
-std::array<float,2>{0.177292049f, 0.991130948f},
-std::array<float,2>{0.279871374f, 0.137704536f},
-std::array<float,2>{0.586350501f, 0.665033758f},
-std::array<float,2>{0.747994125f, 0.100511707f},
-std::array<float,2>{0.439926952f, 0.508544147f},
-std::array<float,2>{0.0539306737f, 0.330148041f},
-std::array<float,2>{0.869807422f, 0.86507231f},
-std::array<float,2>{0.530754685f, 0.285765022f},
-std::array<float,2>{0.337668896f, 0.769459903f},
-std::array<float,2>{0.242411882f, 0.0509742573f},
-std::array<float,2>{0.942872703f, 0.611330628f},
-std::array<float,2>{0.797771215f, 0.234329864f},
-std::array<float,2>{0.118313283f, 0.740565419f},
-std::array<float,2>{0.409084618f, 0.380485177f},
-std::array<float,2>{0.686757565f, 0.914246798f},
-std::array<float,2>{0.771029711f, 0.465454131f},
-std::array<float,2>{0.0893912539f, 0.938221872f},
-std::array<float,2>{0.379153073f, 0.184122041f},
-std::array<float,2>{0.625154853f, 0.651663661f},
-std::array<float,2>{0.536038995f, 0.0657985359f},
-std::array<float,2>{0.358820766f, 0.561404884f},
-std::array<float,2>{0.193539158f, 0.351241916f},
-std::array<float,2>{0.975939989f, 0.840100288f},
-std::array<float,2>{0.71737206f, 0.276046485f},
-std::array<float,2>{0.480028421f, 0.808436811f},
-std::array<float,2>{0.00856813509f, 0.00446496578f},
-std::array<float,2>{0.820243895f, 0.565084815f},
-std::array<float,2>{0.932996213f, 0.201970071f},
-std::array<float,2>{0.147588283f, 0.713537574f},
-std::array<float,2>{0.30522576f, 0.436690956f},
-std::array<float,2>{0.606415629f, 0.881516159f},
-std::array<float,2>{0.945316613f, 0.321398139f},
-std::array<float,2>{0.23830153f, 0.850364089f},
-std::array<float,2>{0.332331479f, 0.112851404f},
-std::array<float,2>{0.520369291f, 0.527156651f},
-std::array<float,2>{0.672124028f, 0.141893089f},
-std::array<float,2>{0.416352093f, 0.679657638f},
-std::array<float,2>{0.114470959f, 0.493456334f},
-std::array<float,2>{0.805738926f, 0.972891271f},
-std::array<float,2>{0.584992468f, 0.39384076f},
-std::array<float,2>{0.267670095f, 0.93660742f},
-std::array<float,2>{0.18218407f, 0.236834079f},
-std::array<float,2>{0.890051365f, 0.72580874f},
-std::array<float,2>{0.862434506f, 0.0464876294f},
-std::array<float,2>{0.0594208054f, 0.600486457f},
-std::array<float,2>{0.451649666f, 0.30344227f},
-std::array<float,2>{0.741719782f, 0.764480054f},
-std::array<float,2>{0.841536462f, 0.283482164f},
-std::array<float,2>{0.0184271839f, 0.772155404f},
-std::array<float,2>{0.489608318f, 0.048599191f},
-std::array<float,2>{0.701159894f, 0.615180552f},
-std::array<float,2>{0.623529792f, 0.228778049f},
-std::array<float,2>{0.291301042f, 0.735311151f},
-std::array<float,2>{0.126264259f, 0.376267076f},
-std::array<float,2>{0.919018686f, 0.918543935f},
-std::array<float,2>{0.646529436f, 0.481489629f},
-std::array<float,2>{0.403187096f, 0.985839546f},
-std::array<float,2>{0.0766940489f, 0.13524273f},
-std::array<float,2>{0.753628552f, 0.668109715f},
-std::array<float,2>{0.999547958f, 0.0968985409f},
-std::array<float,2>{0.206055209f, 0.514241278f},
-std::array<float,2>{0.373868585f, 0.333970696f},
-std::array<float,2>{0.559252322f, 0.860011995f},
-std::array<float,2>{0.897913933f, 0.408751935f},
-std::array<float,2>{0.170918271f, 0.896154225f},
-std::array<float,2>{0.265524954f, 0.211644351f},
-std::array<float,2>{0.577209949f, 0.689111531f},
-std::array<float,2>{0.722213149f, 0.0243728589f},
-std::array<float,2>{0.454822779f, 0.591693819f},
-std::array<float,2>{0.040747229f, 0.252903789f},
-std::array<float,2>{0.854074419f, 0.793136895f},
-std::array<float,2>{0.514272451f, 0.368320346f},
-std::array<float,2>{0.321748763f, 0.824479282f},
-std::array<float,2>{0.231183439f, 0.0854116008f},
-std::array<float,2>{0.955312729f, 0.544233918f},
-std::array<float,2>{0.781470299f, 0.168567553f},
-std::array<float,2>{0.106844008f, 0.633669853f},
-std::array<float,2>{0.428760618f, 0.446368098f},
-std::array<float,2>{0.662778258f, 0.961687744f},
-std::array<float,2>{0.845964134f, 0.384745777f},
-std::array<float,2>{0.0347036198f, 0.913036883f},
-std::array<float,2>{0.46382001f, 0.22414811f},
-std::array<float,2>{0.72886771f, 0.742629468f},
-std::array<float,2>{0.569787443f, 0.0573436767f},
-std::array<float,2>{0.252176076f, 0.622840106f},
-std::array<float,2>{0.158788353f, 0.296096891f},
-std::array<float,2>{0.904232085f, 0.774822533f},
-std::array<float,2>{0.664098978f, 0.340164095f},
-std::array<float,2>{0.435331374f, 0.874159575f},
-std::array<float,2>{0.0954264179f, 0.108811073f},
-std::array<float,2>{0.795682728f, 0.502044082f},
-std::array<float,2>{0.963264585f, 0.132684037f},
-std::array<float,2>{0.222506732f, 0.659753442f},
-std::array<float,2>{0.312714249f, 0.474517494f},
-std::array<float,2>{0.501131892f, 0.993197024f},
-std::array<float,2>{0.910130203f, 0.260154545f},
-std::array<float,2>{0.133050114f, 0.78684628f},
-std::array<float,2>{0.283399582f, 0.0187063031f},
-std::array<float,2>{0.611641526f, 0.580399275f},
-std::array<float,2>{0.692511976f, 0.207818225f},
-std::array<float,2>{0.495318383f, 0.699584544f},
-std::array<float,2>{0.0257549305f, 0.416090965f},
-std::array<float,2>{0.831187189f, 0.900303781f},
-std::array<float,2>{0.553203225f, 0.440039426f},
-std::array<float,2>{0.365485072f, 0.957206964f},
-std::array<float,2>{0.218455642f, 0.158413872f},
-std::array<float,2>{0.991627932f, 0.629788101f},
-std::array<float,2>{0.759846807f, 0.0915885791f},
-std::array<float,2>{0.0677440166f, 0.533979893f},
-std::array<float,2>{0.395475894f, 0.362103015f},
-std::array<float,2>{0.650081635f, 0.815187275f},
-std::array<float,2>{0.803690434f, 0.35414353f},
-std::array<float,2>{0.124097407f, 0.831502974f},
-std::array<float,2>{0.413177878f, 0.0747303441f},
-std::array<float,2>{0.679889977f, 0.550446033f},
-std::array<float,2>{0.524856985f, 0.175493449f},
-std::array<float,2>{0.341584533f, 0.64291966f},
-std::array<float,2>{0.248759493f, 0.455953717f},
-std::array<float,2>{0.940131485f, 0.949085653f},
-std::array<float,2>{0.744227469f, 0.428163528f},
-std::array<float,2>{0.444793314f, 0.886294544f},
-std::array<float,2>{0.0492245071f, 0.19264172f},
-std::array<float,2>{0.872477472f, 0.710620821f},
-std::array<float,2>{0.876580596f, 0.0118025625f},
-std::array<float,2>{0.17385827f, 0.576593518f},
-std::array<float,2>{0.276238143f, 0.269064218f},
-std::array<float,2>{0.592602789f, 0.798267543f},
-std::array<float,2>{0.980724335f, 0.486005634f},
-std::array<float,2>{0.200357109f, 0.979294181f},
-std::array<float,2>{0.349803001f, 0.149324134f},
-std::array<float,2>{0.540948808f, 0.685784817f},
-std::array<float,2>{0.634415269f, 0.123648256f},
-std::array<float,2>{0.387627751f, 0.517712295f},
-std::array<float,2>{0.0832254887f, 0.314411938f},
-std::array<float,2>{0.77356261f, 0.858373106f},
-std::array<float,2>{0.600546241f, 0.306431234f},
-std::array<float,2>{0.302392632f, 0.757354975f},
-std::array<float,2>{0.152692974f, 0.035705179f},
-std::array<float,2>{0.929676414f, 0.604230344f},
-std::array<float,2>{0.823524356f, 0.246680841f},
-std::array<float,2>{0.0070859096f, 0.731476784f},
-std::array<float,2>{0.474348307f, 0.399827391f},
-std::array<float,2>{0.710211158f, 0.928944707f},
-std::array<float,2>{0.81450969f, 0.472272873f},
-std::array<float,2>{0.0125497328f, 0.997279942f},
-std::array<float,2>{0.480911732f, 0.126115769f},
-std::array<float,2>{0.712421f, 0.664048016f},
-std::array<float,2>{0.60274744f, 0.103096157f},
-std::array<float,2>{0.311620235f, 0.505565345f},
-std::array<float,2>{0.143740252f, 0.337207794f},
-std::array<float,2>{0.936905503f, 0.870352268f},
-std::array<float,2>{0.632514179f, 0.289319843f},
-std::array<float,2>{0.376439542f, 0.779057443f},
-std::array<float,2>{0.0912826806f, 0.0619508103f},
-std::array<float,2>{0.767631054f, 0.620556235f},
-std::array<float,2>{0.968823552f, 0.220226139f},
-std::array<float,2>{0.191355944f, 0.74713856f},
-std::array<float,2>{0.355318427f, 0.388124585f},
-std::array<float,2>{0.534106314f, 0.908210099f},
-std::array<float,2>{0.886257887f, 0.366288662f},
-std::array<float,2>{0.186527252f, 0.819045126f},
-std::array<float,2>{0.27220273f, 0.0891303793f},
-std::array<float,2>{0.578974187f, 0.537378132f},
-std::array<float,2>{0.736941576f, 0.163722411f},
-std::array<float,2>{0.445739001f, 0.627304256f},
-std::array<float,2>{0.0566598512f, 0.445042074f},
-std::array<float,2>{0.866182983f, 0.954057336f},
-std::array<float,2>{0.515648603f, 0.419975817f},
-std::array<float,2>{0.330702931f, 0.904099941f},
-std::array<float,2>{0.235900655f, 0.204453558f},
-std::array<float,2>{0.950738609f, 0.696746528f},
-std::array<float,2>{0.812202632f, 0.0198503807f},
-std::array<float,2>{0.110833742f, 0.583742797f},
-std::array<float,2>{0.418447524f, 0.263585627f},
-std::array<float,2>{0.676291645f, 0.781921029f},
-std::array<float,2>{0.75430274f, 0.272107422f},
-std::array<float,2>{0.0723892599f, 0.801029325f},
-std::array<float,2>{0.400268704f, 0.00818956271f},
-std::array<float,2>{0.644242644f, 0.571198404f},
-std::array<float,2>{0.557757974f, 0.18900758f},
-std::array<float,2>{0.367871493f, 0.705201685f},
-std::array<float,2>{0.207350463f, 0.425685585f},
-std::array<float,2>{0.994445324f, 0.889462769f},
-std::array<float,2>{0.698722064f, 0.459196627f},
-std::array<float,2>{0.485518068f, 0.950557828f},
-std::array<float,2>{0.022653779f, 0.176962465f},
-std::array<float,2>{0.839272857f, 0.646414101f},
-std::array<float,2>{0.916085362f, 0.0723511577f},
-std::array<float,2>{0.13140668f, 0.552106142f},
-std::array<float,2>{0.293666393f, 0.358993411f},
-std::array<float,2>{0.618314385f, 0.83440119f},
-std::array<float,2>{0.958276749f, 0.405799806f},
-std::array<float,2>{0.226966813f, 0.925368845f},
-std::array<float,2>{0.326701581f, 0.244053826f},
-std::array<float,2>{0.509891927f, 0.728924155f},
-std::array<float,2>{0.657449245f, 0.0336710364f},
-std::array<float,2>{0.425623715f, 0.606306791f},
-std::array<float,2>{0.10206794f, 0.311623991f},
-std::array<float,2>{0.788083911f, 0.752402961f},
-std::array<float,2>{0.571886539f, 0.316462934f},
-std::array<float,2>{0.259719521f, 0.854858518f},
-std::array<float,2>{0.164855212f, 0.120072939f},
-std::array<float,2>{0.891785681f, 0.522441983f},
-std::array<float,2>{0.859311223f, 0.153789058f},
-std::array<float,2>{0.0438710228f, 0.682349086f},
-std::array<float,2>{0.457800865f, 0.492085785f},
-std::array<float,2>{0.72535038f, 0.983828604f},
-std::array<float,2>{0.792575896f, 0.431654125f},
-std::array<float,2>{0.0984988362f, 0.875195861f},
-std::array<float,2>{0.430464417f, 0.195382908f},
-std::array<float,2>{0.670166612f, 0.715715766f},
-std::array<float,2>{0.507295847f, 0.00305493688f},
-std::array<float,2>{0.318178236f, 0.569247782f},
-std::array<float,2>{0.225865096f, 0.27881223f},
-std::array<float,2>{0.96678108f, 0.81010884f},
-std::array<float,2>{0.734180212f, 0.343963712f},
-std::array<float,2>{0.468678206f, 0.836530447f},
-std::array<float,2>{0.0359382071f, 0.0683847368f},
-std::array<float,2>{0.851268172f, 0.555228829f},
-std::array<float,2>{0.89858073f, 0.182006985f},
-std::array<float,2>{0.163533449f, 0.655382156f},
-std::array<float,2>{0.256055981f, 0.464537382f},
-std::array<float,2>{0.564763129f, 0.94308722f},
-std::array<float,2>{0.984927356f, 0.300267518f},
-std::array<float,2>{0.214406297f, 0.758064568f},
-std::array<float,2>{0.362654656f, 0.0417111851f},
-std::array<float,2>{0.549714804f, 0.594490111f},
-std::array<float,2>{0.655559838f, 0.241549507f},
-std::array<float,2>{0.390938908f, 0.721502483f},
-std::array<float,2>{0.0634339303f, 0.397741079f},
-std::array<float,2>{0.763394952f, 0.931191444f},
-std::array<float,2>{0.616254508f, 0.498584062f},
-std::array<float,2>{0.287733108f, 0.968899667f},
-std::array<float,2>{0.138358235f, 0.144762039f},
-std::array<float,2>{0.912931502f, 0.672876894f},
-std::array<float,2>{0.832155645f, 0.113561966f},
-std::array<float,2>{0.0280776192f, 0.529195309f},
-std::array<float,2>{0.497717321f, 0.32623297f},
-std::array<float,2>{0.687528312f, 0.844225883f},
-std::array<float,2>{0.867607534f, 0.329289258f},
-std::array<float,2>{0.0524021424f, 0.866881311f},
-std::array<float,2>{0.43794325f, 0.0983560681f},
-std::array<float,2>{0.748290777f, 0.509830832f},
-std::array<float,2>{0.587998807f, 0.138749346f},
-std::array<float,2>{0.278009444f, 0.666477144f},
-std::array<float,2>{0.178711459f, 0.48004517f},
-std::array<float,2>{0.878980339f, 0.98903811f},
-std::array<float,2>{0.68500942f, 0.381206363f},
-std::array<float,2>{0.406922251f, 0.917086005f},
-std::array<float,2>{0.120887928f, 0.230474129f},
-std::array<float,2>{0.799574375f, 0.739596069f},
-std::array<float,2>{0.944723487f, 0.0532395244f},
-std::array<float,2>{0.244219556f, 0.609399974f},
-std::array<float,2>{0.339011759f, 0.28715086f},
-std::array<float,2>{0.528225243f, 0.766054213f},
-std::array<float,2>{0.925777614f, 0.452239722f},
-std::array<float,2>{0.149645895f, 0.966695726f},
-std::array<float,2>{0.29743132f, 0.167855397f},
-std::array<float,2>{0.596185744f, 0.639579475f},
-std::array<float,2>{0.70615238f, 0.0806076601f},
-std::array<float,2>{0.470377445f, 0.539369643f},
-std::array<float,2>{0.00346658612f, 0.374534011f},
-std::array<float,2>{0.827969253f, 0.824199915f},
-std::array<float,2>{0.545217514f, 0.256068915f},
-std::array<float,2>{0.344149232f, 0.790214896f},
-std::array<float,2>{0.196773887f, 0.0285361372f},
-std::array<float,2>{0.979769826f, 0.587180793f},
-std::array<float,2>{0.778092086f, 0.218651801f},
-std::array<float,2>{0.0805707723f, 0.69214797f},
-std::array<float,2>{0.386691868f, 0.412505269f},
-std::array<float,2>{0.638899624f, 0.891254663f},
-std::array<float,2>{0.768055856f, 0.469550759f},
-std::array<float,2>{0.0908586979f, 0.999153495f},
-std::array<float,2>{0.376104832f, 0.127604246f},
-std::array<float,2>{0.632596672f, 0.661634684f},
-std::array<float,2>{0.533692718f, 0.10479524f},
-std::array<float,2>{0.355114579f, 0.507387698f},
-std::array<float,2>{0.191035375f, 0.33930245f},
-std::array<float,2>{0.96919775f, 0.867661238f},
-std::array<float,2>{0.7126863f, 0.292204648f},
-std::array<float,2>{0.480592549f, 0.780897737f},
-std::array<float,2>{0.0122127021f, 0.0599474348f},
-std::array<float,2>{0.814840853f, 0.617349505f},
-std::array<float,2>{0.936608195f, 0.221200511f},
-std::array<float,2>{0.143992066f, 0.748403072f},
-std::array<float,2>{0.311988622f, 0.389243901f},
-std::array<float,2>{0.602783442f, 0.907545328f},
-std::array<float,2>{0.95109868f, 0.364361316f},
-std::array<float,2>{0.236119658f, 0.816537023f},
-std::array<float,2>{0.33097589f, 0.0862350687f},
-std::array<float,2>{0.515873253f, 0.535183072f},
-std::array<float,2>{0.676626921f, 0.161454976f},
-std::array<float,2>{0.418036163f, 0.625603557f},
-std::array<float,2>{0.11042019f, 0.443034291f},
-std::array<float,2>{0.812459052f, 0.95562309f},
-std::array<float,2>{0.578815758f, 0.418645084f},
-std::array<float,2>{0.27227962f, 0.904539466f},
-std::array<float,2>{0.186996311f, 0.205590814f},
-std::array<float,2>{0.886696398f, 0.699047983f},
-std::array<float,2>{0.865963459f, 0.0229226146f},
-std::array<float,2>{0.0569939651f, 0.585066378f},
-std::array<float,2>{0.445353508f, 0.265512645f},
-std::array<float,2>{0.737299562f, 0.785028338f},
-std::array<float,2>{0.839101911f, 0.271107972f},
-std::array<float,2>{0.0228466261f, 0.803587258f},
-std::array<float,2>{0.485712081f, 0.00997447968f},
-std::array<float,2>{0.698326111f, 0.572554529f},
-std::array<float,2>{0.618537128f, 0.191185668f},
-std::array<float,2>{0.293800771f, 0.704699755f},
-std::array<float,2>{0.131795928f, 0.422569662f},
-std::array<float,2>{0.91637218f, 0.887980282f},
-std::array<float,2>{0.644334018f, 0.457865834f},
-std::array<float,2>{0.400069416f, 0.952114224f},
-std::array<float,2>{0.072705999f, 0.178010598f},
-std::array<float,2>{0.753998876f, 0.646757185f},
-std::array<float,2>{0.994371235f, 0.0703784898f},
-std::array<float,2>{0.207144752f, 0.553899527f},
-std::array<float,2>{0.36793378f, 0.356488645f},
-std::array<float,2>{0.557892621f, 0.832897604f},
-std::array<float,2>{0.89199537f, 0.402636945f},
-std::array<float,2>{0.164665818f, 0.922938526f},
-std::array<float,2>{0.259290934f, 0.244469061f},
-std::array<float,2>{0.57221204f, 0.727441669f},
-std::array<float,2>{0.725286961f, 0.0329930745f},
-std::array<float,2>{0.457724035f, 0.607791543f},
-std::array<float,2>{0.0437008329f, 0.309396297f},
-std::array<float,2>{0.858989596f, 0.751528442f},
-std::array<float,2>{0.510046065f, 0.319033504f},
-std::array<float,2>{0.327080011f, 0.852702022f},
-std::array<float,2>{0.226647437f, 0.118112199f},
-std::array<float,2>{0.95804745f, 0.5205791f},
-std::array<float,2>{0.787822783f, 0.154824957f},
-std::array<float,2>{0.102465473f, 0.68100363f},
-std::array<float,2>{0.42546913f, 0.488980919f},
-std::array<float,2>{0.657583296f, 0.982324779f},
-std::array<float,2>{0.851546109f, 0.430175006f},
-std::array<float,2>{0.0357768461f, 0.878047884f},
-std::array<float,2>{0.468313515f, 0.197958916f},
-std::array<float,2>{0.733996153f, 0.718356848f},
-std::array<float,2>{0.564658284f, 0.00071191811f},
-std::array<float,2>{0.256222248f, 0.567484558f},
-std::array<float,2>{0.163195476f, 0.281193107f},
-std::array<float,2>{0.898699045f, 0.810916543f},
-std::array<float,2>{0.670088053f, 0.347279668f},
-std::array<float,2>{0.430232882f, 0.838730872f},
-std::array<float,2>{0.0982486904f, 0.0666384995f},
-std::array<float,2>{0.792872608f, 0.558442891f},
-std::array<float,2>{0.966346502f, 0.181359708f},
-std::array<float,2>{0.225697219f, 0.652706742f},
-std::array<float,2>{0.317994624f, 0.461874157f},
-std::array<float,2>{0.50705725f, 0.944904983f},
-std::array<float,2>{0.91263938f, 0.297564566f},
-std::array<float,2>{0.138544723f, 0.760004878f},
-std::array<float,2>{0.28787607f, 0.0404360592f},
-std::array<float,2>{0.616691172f, 0.596656501f},
-std::array<float,2>{0.687769413f, 0.239710614f},
-std::array<float,2>{0.497920185f, 0.719227672f},
-std::array<float,2>{0.0278740264f, 0.396009535f},
-std::array<float,2>{0.832310319f, 0.932186246f},
-std::array<float,2>{0.549316883f, 0.496931344f},
-std::array<float,2>{0.362485498f, 0.972441316f},
-std::array<float,2>{0.214601666f, 0.146673292f},
-std::array<float,2>{0.985274374f, 0.675419152f},
-std::array<float,2>{0.763639271f, 0.116585232f},
-std::array<float,2>{0.0632220879f, 0.529844582f},
-std::array<float,2>{0.390781134f, 0.325023979f},
-std::array<float,2>{0.655510545f, 0.846576333f},
-std::array<float,2>{0.799542844f, 0.331157535f},
-std::array<float,2>{0.120817453f, 0.864219964f},
-std::array<float,2>{0.40702641f, 0.100668326f},
-std::array<float,2>{0.684665501f, 0.509269416f},
-std::array<float,2>{0.527879715f, 0.137366936f},
-std::array<float,2>{0.339291096f, 0.665401459f},
-std::array<float,2>{0.2446125f, 0.477554232f},
-std::array<float,2>{0.944507778f, 0.991857648f},
-std::array<float,2>{0.748398781f, 0.37958166f},
-std::array<float,2>{0.43760559f, 0.91523993f},
-std::array<float,2>{0.0525177978f, 0.232934579f},
-std::array<float,2>{0.867269039f, 0.741739869f},
-std::array<float,2>{0.8792696f, 0.0524593294f},
-std::array<float,2>{0.179015562f, 0.613164008f},
-std::array<float,2>{0.278278679f, 0.286539435f},
-std::array<float,2>{0.588155448f, 0.767728746f},
-std::array<float,2>{0.979502738f, 0.450072706f},
-std::array<float,2>{0.19652307f, 0.967263103f},
-std::array<float,2>{0.343961418f, 0.165829286f},
-std::array<float,2>{0.545156598f, 0.638379157f},
-std::array<float,2>{0.639096975f, 0.0782881305f},
-std::array<float,2>{0.386264563f, 0.542830765f},
-std::array<float,2>{0.0809875578f, 0.372194111f},
-std::array<float,2>{0.777891576f, 0.821898401f},
-std::array<float,2>{0.595865786f, 0.254383504f},
-std::array<float,2>{0.297657251f, 0.792955875f},
-std::array<float,2>{0.14974761f, 0.0301970001f},
-std::array<float,2>{0.925335109f, 0.589039385f},
-std::array<float,2>{0.8276788f, 0.216214135f},
-std::array<float,2>{0.00366618484f, 0.694067419f},
-std::array<float,2>{0.470641404f, 0.411558539f},
-std::array<float,2>{0.70641005f, 0.893925428f},
-std::array<float,2>{0.819856465f, 0.468741268f},
-std::array<float,2>{0.00843284745f, 0.940614343f},
-std::array<float,2>{0.480372518f, 0.18701987f},
-std::array<float,2>{0.717732012f, 0.649632633f},
-std::array<float,2>{0.606186688f, 0.0625834018f},
-std::array<float,2>{0.305620164f, 0.558843851f},
-std::array<float,2>{0.147882983f, 0.34932059f},
-std::array<float,2>{0.932770491f, 0.842744231f},
-std::array<float,2>{0.625326097f, 0.273866683f},
-std::array<float,2>{0.379029185f, 0.805142224f},
-std::array<float,2>{0.0896563381f, 0.00654140487f},
-std::array<float,2>{0.771290898f, 0.564231038f},
-std::array<float,2>{0.975747943f, 0.201028481f},
-std::array<float,2>{0.193828687f, 0.712450922f},
-std::array<float,2>{0.358607799f, 0.433594942f},
-std::array<float,2>{0.53583324f, 0.880515933f},
-std::array<float,2>{0.889837205f, 0.322442859f},
-std::array<float,2>{0.182608247f, 0.848705769f},
-std::array<float,2>{0.267900139f, 0.109479114f},
-std::array<float,2>{0.585250854f, 0.523920357f},
-std::array<float,2>{0.742032826f, 0.144109428f},
-std::array<float,2>{0.451256722f, 0.677633047f},
-std::array<float,2>{0.0592586696f, 0.495830119f},
-std::array<float,2>{0.862650692f, 0.975022197f},
-std::array<float,2>{0.520192206f, 0.392037839f},
-std::array<float,2>{0.33209458f, 0.933974504f},
-std::array<float,2>{0.238573968f, 0.236284509f},
-std::array<float,2>{0.945782065f, 0.72447139f},
-std::array<float,2>{0.806056678f, 0.043912489f},
-std::array<float,2>{0.114524625f, 0.598715425f},
-std::array<float,2>{0.416250378f, 0.301728755f},
-std::array<float,2>{0.671875477f, 0.762416482f},
-std::array<float,2>{0.753717601f, 0.281274199f},
-std::array<float,2>{0.0771181062f, 0.770471811f},
-std::array<float,2>{0.403030157f, 0.0494873822f},
-std::array<float,2>{0.646879315f, 0.617080271f},
-std::array<float,2>{0.559363723f, 0.228000015f},
-std::array<float,2>{0.373652488f, 0.7381109f},
-std::array<float,2>{0.206498668f, 0.377076715f},
-std::array<float,2>{0.999810696f, 0.921626925f},
-std::array<float,2>{0.700695813f, 0.484034628f},
-std::array<float,2>{0.489370823f, 0.986774206f},
-std::array<float,2>{0.0181479678f, 0.133114442f},
-std::array<float,2>{0.841700554f, 0.670755744f},
-std::array<float,2>{0.919426501f, 0.0947345048f},
-std::array<float,2>{0.12601912f, 0.51274395f},
-std::array<float,2>{0.291168928f, 0.33511126f},
-std::array<float,2>{0.62324965f, 0.861662865f},
-std::array<float,2>{0.955448329f, 0.406377763f},
-std::array<float,2>{0.231277257f, 0.897710741f},
-std::array<float,2>{0.321434319f, 0.214114487f},
-std::array<float,2>{0.514562607f, 0.691147745f},
-std::array<float,2>{0.663001418f, 0.0268390719f},
-std::array<float,2>{0.42910558f, 0.59369576f},
-std::array<float,2>{0.106450781f, 0.251621485f},
-std::array<float,2>{0.781684518f, 0.79581821f},
-std::array<float,2>{0.577452004f, 0.371062398f},
-std::array<float,2>{0.265288383f, 0.826703966f},
-std::array<float,2>{0.171258673f, 0.0839160532f},
-std::array<float,2>{0.897605121f, 0.545002997f},
-std::array<float,2>{0.854260385f, 0.170920983f},
-std::array<float,2>{0.0407732278f, 0.635460794f},
-std::array<float,2>{0.454835802f, 0.449143142f},
-std::array<float,2>{0.722417414f, 0.964093387f},
-std::array<float,2>{0.795546472f, 0.386598557f},
-std::array<float,2>{0.0955869108f, 0.911570251f},
-std::array<float,2>{0.435097456f, 0.226244062f},
-std::array<float,2>{0.664491892f, 0.745688856f},
-std::array<float,2>{0.501365185f, 0.055525247f},
-std::array<float,2>{0.312875986f, 0.624230802f},
-std::array<float,2>{0.222344741f, 0.293749034f},
-std::array<float,2>{0.962968588f, 0.776386619f},
-std::array<float,2>{0.728559256f, 0.342276126f},
-std::array<float,2>{0.46337983f, 0.871598125f},
-std::array<float,2>{0.0351002626f, 0.106628679f},
-std::array<float,2>{0.845885336f, 0.500767827f},
-std::array<float,2>{0.903839946f, 0.129130319f},
-std::array<float,2>{0.159062684f, 0.656908989f},
-std::array<float,2>{0.252322167f, 0.475626051f},
-std::array<float,2>{0.569349825f, 0.995053828f},
-std::array<float,2>{0.991288483f, 0.258763999f},
-std::array<float,2>{0.218724698f, 0.787629485f},
-std::array<float,2>{0.365463704f, 0.0173308644f},
-std::array<float,2>{0.55292362f, 0.578536689f},
-std::array<float,2>{0.650373578f, 0.209520414f},
-std::array<float,2>{0.395100623f, 0.702871084f},
-std::array<float,2>{0.0675255954f, 0.415220857f},
-std::array<float,2>{0.760034978f, 0.90046531f},
-std::array<float,2>{0.611556649f, 0.439112931f},
-std::array<float,2>{0.283662796f, 0.959257364f},
-std::array<float,2>{0.133192003f, 0.157224789f},
-std::array<float,2>{0.909849584f, 0.631351352f},
-std::array<float,2>{0.831310093f, 0.0933902934f},
-std::array<float,2>{0.0254701227f, 0.532689035f},
-std::array<float,2>{0.49542731f, 0.359449863f},
-std::array<float,2>{0.692634881f, 0.812640905f},
-std::array<float,2>{0.872152925f, 0.352818131f},
-std::array<float,2>{0.0488435887f, 0.828150272f},
-std::array<float,2>{0.444349349f, 0.076262109f},
-std::array<float,2>{0.744612575f, 0.548129857f},
-std::array<float,2>{0.59249568f, 0.173033342f},
-std::array<float,2>{0.275925249f, 0.640981555f},
-std::array<float,2>{0.174168035f, 0.453740865f},
-std::array<float,2>{0.876817882f, 0.945532143f},
-std::array<float,2>{0.680167854f, 0.425986201f},
-std::array<float,2>{0.413455784f, 0.884538472f},
-std::array<float,2>{0.124444023f, 0.195288509f},
-std::array<float,2>{0.803459525f, 0.708200932f},
-std::array<float,2>{0.940332174f, 0.0146528305f},
-std::array<float,2>{0.248800844f, 0.574394584f},
-std::array<float,2>{0.341384709f, 0.26748234f},
-std::array<float,2>{0.524508238f, 0.799817562f},
-std::array<float,2>{0.929209054f, 0.486781836f},
-std::array<float,2>{0.152535766f, 0.97743547f},
-std::array<float,2>{0.302603245f, 0.152310595f},
-std::array<float,2>{0.600108325f, 0.684573293f},
-std::array<float,2>{0.710115552f, 0.122086093f},
-std::array<float,2>{0.474515259f, 0.517048776f},
-std::array<float,2>{0.00696813129f, 0.316370219f},
-std::array<float,2>{0.823336482f, 0.857131243f},
-std::array<float,2>{0.540626585f, 0.30702579f},
-std::array<float,2>{0.350000858f, 0.755053341f},
-std::array<float,2>{0.200591087f, 0.037998382f},
-std::array<float,2>{0.980543077f, 0.602680981f},
-std::array<float,2>{0.773827076f, 0.248174533f},
-std::array<float,2>{0.0833043084f, 0.733687997f},
-std::array<float,2>{0.387354523f, 0.400433987f},
-std::array<float,2>{0.634599328f, 0.926689744f},
-std::array<float,2>{0.808788598f, 0.44410792f},
-std::array<float,2>{0.112742662f, 0.954525292f},
-std::array<float,2>{0.42103982f, 0.162272438f},
-std::array<float,2>{0.677872777f, 0.628335059f},
-std::array<float,2>{0.517645597f, 0.0884070396f},
-std::array<float,2>{0.329141468f, 0.538626373f},
-std::array<float,2>{0.238101646f, 0.365963936f},
-std::array<float,2>{0.952927768f, 0.81937623f},
-std::array<float,2>{0.73555541f, 0.261775047f},
-std::array<float,2>{0.447812408f, 0.78246361f},
-std::array<float,2>{0.0557569377f, 0.0209463686f},
-std::array<float,2>{0.863333881f, 0.5823434f},
-std::array<float,2>{0.884378552f, 0.203139409f},
-std::array<float,2>{0.183739796f, 0.695869803f},
-std::array<float,2>{0.26996088f, 0.421215981f},
-std::array<float,2>{0.580477297f, 0.902999878f},
-std::array<float,2>{0.972281218f, 0.336797208f},
-std::array<float,2>{0.189391747f, 0.869487882f},
-std::array<float,2>{0.352618843f, 0.102427006f},
-std::array<float,2>{0.531372309f, 0.504544139f},
-std::array<float,2>{0.629493654f, 0.125348687f},
-std::array<float,2>{0.378898889f, 0.662869215f},
-std::array<float,2>{0.0925326794f, 0.471163273f},
-std::array<float,2>{0.766227841f, 0.996333361f},
-std::array<float,2>{0.605206013f, 0.387356579f},
-std::array<float,2>{0.308987051f, 0.909816682f},
-std::array<float,2>{0.141017854f, 0.219702125f},
-std::array<float,2>{0.935150266f, 0.746541858f},
-std::array<float,2>{0.813945174f, 0.061080005f},
-std::array<float,2>{0.0143544003f, 0.619200706f},
-std::array<float,2>{0.483952999f, 0.290226609f},
-std::array<float,2>{0.713653386f, 0.777607381f},
-std::array<float,2>{0.857342958f, 0.310739249f},
-std::array<float,2>{0.0455784872f, 0.752945244f},
-std::array<float,2>{0.459780157f, 0.0343344063f},
-std::array<float,2>{0.723365545f, 0.606798768f},
-std::array<float,2>{0.572365046f, 0.242244273f},
-std::array<float,2>{0.260266274f, 0.72954005f},
-std::array<float,2>{0.166741416f, 0.404413909f},
-std::array<float,2>{0.893706739f, 0.924195111f},
-std::array<float,2>{0.658403337f, 0.490691423f},
-std::array<float,2>{0.423786432f, 0.982889652f},
-std::array<float,2>{0.103930116f, 0.153259799f},
-std::array<float,2>{0.786355436f, 0.682950675f},
-std::array<float,2>{0.959127963f, 0.120579056f},
-std::array<float,2>{0.229470208f, 0.522638559f},
-std::array<float,2>{0.324929833f, 0.318284333f},
-std::array<float,2>{0.509368598f, 0.853521705f},
-std::array<float,2>{0.915743649f, 0.424552232f},
-std::array<float,2>{0.129869282f, 0.890529692f},
-std::array<float,2>{0.296846509f, 0.188124672f},
-std::array<float,2>{0.620914996f, 0.706196547f},
-std::array<float,2>{0.696134508f, 0.00946619827f},
-std::array<float,2>{0.48750779f, 0.571497381f},
-std::array<float,2>{0.0212859698f, 0.273126572f},
-std::array<float,2>{0.836283386f, 0.802380502f},
-std::array<float,2>{0.556168556f, 0.357802421f},
-std::array<float,2>{0.369705588f, 0.835384369f},
-std::array<float,2>{0.210883468f, 0.0740816295f},
-std::array<float,2>{0.993405163f, 0.551612139f},
-std::array<float,2>{0.756275296f, 0.175898969f},
-std::array<float,2>{0.0706089959f, 0.645177901f},
-std::array<float,2>{0.401918381f, 0.46004501f},
-std::array<float,2>{0.641710937f, 0.949744046f},
-std::array<float,2>{0.834092319f, 0.397220671f},
-std::array<float,2>{0.0310431458f, 0.930645287f},
-std::array<float,2>{0.498066515f, 0.240275458f},
-std::array<float,2>{0.690065563f, 0.72237134f},
-std::array<float,2>{0.614704788f, 0.0425568298f},
-std::array<float,2>{0.286196023f, 0.594833851f},
-std::array<float,2>{0.139252782f, 0.299146116f},
-std::array<float,2>{0.91042608f, 0.759118557f},
-std::array<float,2>{0.652680278f, 0.327615023f},
-std::array<float,2>{0.393017799f, 0.84537977f},
-std::array<float,2>{0.0660968721f, 0.114490971f},
-std::array<float,2>{0.764861882f, 0.52804327f},
-std::array<float,2>{0.986539543f, 0.146390513f},
-std::array<float,2>{0.211257726f, 0.672435701f},
-std::array<float,2>{0.361273438f, 0.499296427f},
-std::array<float,2>{0.547440529f, 0.970210671f},
-std::array<float,2>{0.902297556f, 0.277861059f},
-std::array<float,2>{0.161761835f, 0.809283555f},
-std::array<float,2>{0.254966944f, 0.00209485227f},
-std::array<float,2>{0.56345284f, 0.569936216f},
-std::array<float,2>{0.73088479f, 0.197258607f},
-std::array<float,2>{0.466367364f, 0.715824187f},
-std::array<float,2>{0.0387563035f, 0.433039069f},
-std::array<float,2>{0.848156452f, 0.87691468f},
-std::array<float,2>{0.504344583f, 0.46364373f},
-std::array<float,2>{0.318493664f, 0.94224757f},
-std::array<float,2>{0.22326526f, 0.182973444f},
-std::array<float,2>{0.967016578f, 0.654784977f},
-std::array<float,2>{0.789482594f, 0.06996198f},
-std::array<float,2>{0.101127341f, 0.555721283f},
-std::array<float,2>{0.432552457f, 0.345651269f},
-std::array<float,2>{0.66934967f, 0.83697474f},
-std::array<float,2>{0.780818045f, 0.373085111f},
-std::array<float,2>{0.0788596869f, 0.823191881f},
-std::array<float,2>{0.383551419f, 0.0819393322f},
-std::array<float,2>{0.637271881f, 0.540788472f},
-std::array<float,2>{0.543629944f, 0.166565403f},
-std::array<float,2>{0.347611189f, 0.640096247f},
-std::array<float,2>{0.197378993f, 0.45137462f},
-std::array<float,2>{0.977784455f, 0.965344787f},
-std::array<float,2>{0.70496136f, 0.413147241f},
-std::array<float,2>{0.471842855f, 0.891766191f},
-std::array<float,2>{0.000691728201f, 0.217162803f},
-std::array<float,2>{0.825194001f, 0.692968428f},
-std::array<float,2>{0.922067404f, 0.0277020801f},
-std::array<float,2>{0.150979072f, 0.586847186f},
-std::array<float,2>{0.299069673f, 0.257464111f},
-std::array<float,2>{0.594629467f, 0.789875388f},
-std::array<float,2>{0.943227589f, 0.479370952f},
-std::array<float,2>{0.242580041f, 0.98932147f},
-std::array<float,2>{0.33756265f, 0.140415281f},
-std::array<float,2>{0.530407727f, 0.667375565f},
-std::array<float,2>{0.686947942f, 0.0990964249f},
-std::array<float,2>{0.408905983f, 0.51146245f},
-std::array<float,2>{0.118637331f, 0.328165114f},
-std::array<float,2>{0.797437191f, 0.865638912f},
-std::array<float,2>{0.586011469f, 0.288935333f},
-std::array<float,2>{0.280177265f, 0.766605258f},
-std::array<float,2>{0.177496284f, 0.0545000769f},
-std::array<float,2>{0.882461667f, 0.611278355f},
-std::array<float,2>{0.8699494f, 0.232334778f},
-std::array<float,2>{0.0541109778f, 0.738689542f},
-std::array<float,2>{0.4395625f, 0.382355303f},
-std::array<float,2>{0.747781456f, 0.916053176f},
-std::array<float,2>{0.860887289f, 0.492821842f},
-std::array<float,2>{0.0605998114f, 0.974208891f},
-std::array<float,2>{0.45112893f, 0.141143352f},
-std::array<float,2>{0.739037156f, 0.678150415f},
-std::array<float,2>{0.582312405f, 0.111933753f},
-std::array<float,2>{0.266234368f, 0.526055098f},
-std::array<float,2>{0.180137515f, 0.320774704f},
-std::array<float,2>{0.888219416f, 0.851076365f},
-std::array<float,2>{0.674878955f, 0.303887963f},
-std::array<float,2>{0.415812194f, 0.765128374f},
-std::array<float,2>{0.11667975f, 0.0450499542f},
-std::array<float,2>{0.80699259f, 0.60067904f},
-std::array<float,2>{0.947576225f, 0.237324357f},
-std::array<float,2>{0.242164955f, 0.724632502f},
-std::array<float,2>{0.335032463f, 0.392967016f},
-std::array<float,2>{0.522980332f, 0.9356727f},
-std::array<float,2>{0.931527972f, 0.349635184f},
-std::array<float,2>{0.145964712f, 0.8413167f},
-std::array<float,2>{0.307667404f, 0.0650255382f},
-std::array<float,2>{0.608380795f, 0.562068284f},
-std::array<float,2>{0.71603322f, 0.184626013f},
-std::array<float,2>{0.476862699f, 0.650644481f},
-std::array<float,2>{0.0103487959f, 0.466368943f},
-std::array<float,2>{0.817769825f, 0.939046741f},
-std::array<float,2>{0.537860215f, 0.435920179f},
-std::array<float,2>{0.355917513f, 0.882755041f},
-std::array<float,2>{0.192349777f, 0.202163577f},
-std::array<float,2>{0.97361964f, 0.71451205f},
-std::array<float,2>{0.771903396f, 0.00530518172f},
-std::array<float,2>{0.0878641233f, 0.565790474f},
-std::array<float,2>{0.382578999f, 0.277091622f},
-std::array<float,2>{0.628694654f, 0.806871712f},
-std::array<float,2>{0.78387481f, 0.25322184f},
-std::array<float,2>{0.108129993f, 0.794833183f},
-std::array<float,2>{0.426868558f, 0.0248825196f},
-std::array<float,2>{0.660439074f, 0.590526462f},
-std::array<float,2>{0.512351573f, 0.21244818f},
-std::array<float,2>{0.323934197f, 0.68768388f},
-std::array<float,2>{0.233451605f, 0.409729153f},
-std::array<float,2>{0.954685092f, 0.894584358f},
-std::array<float,2>{0.71978873f, 0.446173906f},
-std::array<float,2>{0.455272228f, 0.962231576f},
-std::array<float,2>{0.0428625681f, 0.169186369f},
-std::array<float,2>{0.851610661f, 0.634533644f},
-std::array<float,2>{0.894925177f, 0.0840775892f},
-std::array<float,2>{0.16856797f, 0.543916523f},
-std::array<float,2>{0.262753695f, 0.367927998f},
-std::array<float,2>{0.575362325f, 0.82524544f},
-std::array<float,2>{0.996560872f, 0.375023425f},
-std::array<float,2>{0.203293636f, 0.919623077f},
-std::array<float,2>{0.37291795f, 0.230453491f},
-std::array<float,2>{0.562318206f, 0.73607707f},
-std::array<float,2>{0.646231592f, 0.0474194214f},
-std::array<float,2>{0.405193508f, 0.613744974f},
-std::array<float,2>{0.0758531317f, 0.285015166f},
-std::array<float,2>{0.751148343f, 0.773270011f},
-std::array<float,2>{0.621271014f, 0.332917958f},
-std::array<float,2>{0.290335447f, 0.86109215f},
-std::array<float,2>{0.128731713f, 0.0960242376f},
-std::array<float,2>{0.921121955f, 0.51527065f},
-std::array<float,2>{0.842864454f, 0.136513665f},
-std::array<float,2>{0.0172187593f, 0.669690192f},
-std::array<float,2>{0.49128744f, 0.480647713f},
-std::array<float,2>{0.702281952f, 0.985195339f},
-std::array<float,2>{0.758971214f, 0.417151034f},
-std::array<float,2>{0.0696837902f, 0.898449004f},
-std::array<float,2>{0.397738874f, 0.208469614f},
-std::array<float,2>{0.651961148f, 0.700732112f},
-std::array<float,2>{0.551888943f, 0.018546816f},
-std::array<float,2>{0.363352537f, 0.581429005f},
-std::array<float,2>{0.216436073f, 0.261526972f},
-std::array<float,2>{0.988500595f, 0.786028266f},
-std::array<float,2>{0.694826543f, 0.362798572f},
-std::array<float,2>{0.493505001f, 0.81544739f},
-std::array<float,2>{0.0246788971f, 0.0904429406f},
-std::array<float,2>{0.828772426f, 0.534654737f},
-std::array<float,2>{0.907783747f, 0.159928545f},
-std::array<float,2>{0.136030793f, 0.629929066f},
-std::array<float,2>{0.283191442f, 0.440613091f},
-std::array<float,2>{0.610969961f, 0.958890378f},
-std::array<float,2>{0.961980581f, 0.295860618f},
-std::array<float,2>{0.219585016f, 0.774348915f},
-std::array<float,2>{0.314584464f, 0.0580782145f},
-std::array<float,2>{0.502427101f, 0.621873975f},
-std::array<float,2>{0.666506588f, 0.223301739f},
-std::array<float,2>{0.436419368f, 0.743712544f},
-std::array<float,2>{0.0965691134f, 0.383276045f},
-std::array<float,2>{0.794879258f, 0.913626134f},
-std::array<float,2>{0.567512155f, 0.473543108f},
-std::array<float,2>{0.250849694f, 0.992817581f},
-std::array<float,2>{0.156747565f, 0.131638795f},
-std::array<float,2>{0.904594183f, 0.658595562f},
-std::array<float,2>{0.84389782f, 0.108274713f},
-std::array<float,2>{0.031610392f, 0.503080308f},
-std::array<float,2>{0.462888837f, 0.341718465f},
-std::array<float,2>{0.727712274f, 0.873839915f},
-std::array<float,2>{0.820797801f, 0.312701881f},
-std::array<float,2>{0.00534403231f, 0.859178722f},
-std::array<float,2>{0.475994796f, 0.124656267f},
-std::array<float,2>{0.708312273f, 0.519306481f},
-std::array<float,2>{0.599045992f, 0.149508461f},
-std::array<float,2>{0.303109497f, 0.687248647f},
-std::array<float,2>{0.154668406f, 0.484377921f},
-std::array<float,2>{0.926774263f, 0.98040992f},
-std::array<float,2>{0.635906577f, 0.398696214f},
-std::array<float,2>{0.388722926f, 0.928710818f},
-std::array<float,2>{0.0854626074f, 0.247349933f},
-std::array<float,2>{0.775476396f, 0.730706811f},
-std::array<float,2>{0.983723998f, 0.0364470296f},
-std::array<float,2>{0.202884525f, 0.605235457f},
-std::array<float,2>{0.348000914f, 0.304689318f},
-std::array<float,2>{0.542019963f, 0.756507099f},
-std::array<float,2>{0.87754637f, 0.456649274f},
-std::array<float,2>{0.17317231f, 0.947330177f},
-std::array<float,2>{0.274653882f, 0.174113274f},
-std::array<float,2>{0.591242075f, 0.644312382f},
-std::array<float,2>{0.742224157f, 0.0754267946f},
-std::array<float,2>{0.443033427f, 0.549452543f},
-std::array<float,2>{0.0475375652f, 0.355061501f},
-std::array<float,2>{0.873363495f, 0.830363512f},
-std::array<float,2>{0.527084649f, 0.268376589f},
-std::array<float,2>{0.341846764f, 0.797587574f},
-std::array<float,2>{0.246990293f, 0.0130168265f},
-std::array<float,2>{0.937517524f, 0.577404141f},
-std::array<float,2>{0.801809251f, 0.192337558f},
-std::array<float,2>{0.122999378f, 0.709159613f},
-std::array<float,2>{0.412075818f, 0.428841352f},
-std::array<float,2>{0.683512509f, 0.884956777f},
-std::array<float,2>{0.785633266f, 0.490138799f},
-std::array<float,2>{0.105374448f, 0.980987728f},
-std::array<float,2>{0.422713906f, 0.155479595f},
-std::array<float,2>{0.65938741f, 0.679884017f},
-std::array<float,2>{0.508219957f, 0.11853984f},
-std::array<float,2>{0.325684905f, 0.519531906f},
-std::array<float,2>{0.229640961f, 0.31992203f},
-std::array<float,2>{0.9609375f, 0.851734638f},
-std::array<float,2>{0.724464536f, 0.309710115f},
-std::array<float,2>{0.460279644f, 0.750625491f},
-std::array<float,2>{0.0467551723f, 0.0320101269f},
-std::array<float,2>{0.85560447f, 0.608445585f},
-std::array<float,2>{0.893354416f, 0.24576579f},
-std::array<float,2>{0.16763632f, 0.727814198f},
-std::array<float,2>{0.261655927f, 0.403861135f},
-std::array<float,2>{0.573325813f, 0.922146142f},
-std::array<float,2>{0.992866397f, 0.355940789f},
-std::array<float,2>{0.209623203f, 0.833614826f},
-std::array<float,2>{0.370949715f, 0.0715044886f},
-std::array<float,2>{0.555284619f, 0.55283767f},
-std::array<float,2>{0.64074862f, 0.179023951f},
-std::array<float,2>{0.400678277f, 0.648035705f},
-std::array<float,2>{0.0716839954f, 0.458424509f},
-std::array<float,2>{0.757365108f, 0.952636182f},
-std::array<float,2>{0.619986534f, 0.423819125f},
-std::array<float,2>{0.295546085f, 0.887594759f},
-std::array<float,2>{0.130127311f, 0.190331995f},
-std::array<float,2>{0.914971054f, 0.703198195f},
-std::array<float,2>{0.837079942f, 0.0107868509f},
-std::array<float,2>{0.0203519687f, 0.573385835f},
-std::array<float,2>{0.486827672f, 0.269782126f},
-std::array<float,2>{0.697060883f, 0.803775966f},
-std::array<float,2>{0.864733756f, 0.264356911f},
-std::array<float,2>{0.0549687445f, 0.783608913f},
-std::array<float,2>{0.44921419f, 0.0216129757f},
-std::array<float,2>{0.734530747f, 0.584364653f},
-std::array<float,2>{0.581500292f, 0.206318483f},
-std::array<float,2>{0.271190137f, 0.698235214f},
-std::array<float,2>{0.184736863f, 0.419497401f},
-std::array<float,2>{0.883476675f, 0.905471623f},
-std::array<float,2>{0.67887032f, 0.441835731f},
-std::array<float,2>{0.420886338f, 0.956115842f},
-std::array<float,2>{0.112304077f, 0.16063951f},
-std::array<float,2>{0.809827626f, 0.626909614f},
-std::array<float,2>{0.951439559f, 0.0871755034f},
-std::array<float,2>{0.236947641f, 0.536602497f},
-std::array<float,2>{0.328545868f, 0.363895267f},
-std::array<float,2>{0.519446313f, 0.817902446f},
-std::array<float,2>{0.934350193f, 0.389693946f},
-std::array<float,2>{0.142373994f, 0.907205522f},
-std::array<float,2>{0.31020999f, 0.221872956f},
-std::array<float,2>{0.603959143f, 0.749173284f},
-std::array<float,2>{0.714536905f, 0.0590106435f},
-std::array<float,2>{0.483082533f, 0.618800759f},
-std::array<float,2>{0.0153601216f, 0.291200459f},
-std::array<float,2>{0.813450515f, 0.780177772f},
-std::array<float,2>{0.532517433f, 0.33789441f},
-std::array<float,2>{0.352229804f, 0.868813097f},
-std::array<float,2>{0.188238695f, 0.103713661f},
-std::array<float,2>{0.971564353f, 0.506699979f},
-std::array<float,2>{0.767117381f, 0.128114462f},
-std::array<float,2>{0.0928951576f, 0.660401404f},
-std::array<float,2>{0.377652645f, 0.470398277f},
-std::array<float,2>{0.630737662f, 0.998929024f},
-std::array<float,2>{0.825809896f, 0.410625875f},
-std::array<float,2>{0.00117904809f, 0.892770529f},
-std::array<float,2>{0.471285403f, 0.215777695f},
-std::array<float,2>{0.704002917f, 0.694658816f},
-std::array<float,2>{0.595112503f, 0.0305423494f},
-std::array<float,2>{0.299946755f, 0.588486254f},
-std::array<float,2>{0.151905492f, 0.255618155f},
-std::array<float,2>{0.92313683f, 0.79112792f},
-std::array<float,2>{0.637820423f, 0.37137264f},
-std::array<float,2>{0.384216815f, 0.820859611f},
-std::array<float,2>{0.0792533308f, 0.0791717172f},
-std::array<float,2>{0.779699087f, 0.541280031f},
-std::array<float,2>{0.976967156f, 0.164633766f},
-std::array<float,2>{0.198556349f, 0.637431383f},
-std::array<float,2>{0.346647829f, 0.451042563f},
-std::array<float,2>{0.544074118f, 0.968598068f},
-std::array<float,2>{0.881607652f, 0.285474151f},
-std::array<float,2>{0.175846964f, 0.768754959f},
-std::array<float,2>{0.280677319f, 0.0517560393f},
-std::array<float,2>{0.587839067f, 0.611854911f},
-std::array<float,2>{0.746691108f, 0.233757958f},
-std::array<float,2>{0.440651834f, 0.740951538f},
-std::array<float,2>{0.0527599119f, 0.380349964f},
-std::array<float,2>{0.87057054f, 0.914908469f},
-std::array<float,2>{0.5293625f, 0.476987302f},
-std::array<float,2>{0.336324781f, 0.990238249f},
-std::array<float,2>{0.243540481f, 0.138638973f},
-std::array<float,2>{0.942162335f, 0.664413154f},
-std::array<float,2>{0.798067212f, 0.0998467207f},
-std::array<float,2>{0.117908202f, 0.507941365f},
-std::array<float,2>{0.409691662f, 0.330596834f},
-std::array<float,2>{0.685620308f, 0.864428759f},
-std::array<float,2>{0.763827682f, 0.325834811f},
-std::array<float,2>{0.0652799234f, 0.846861362f},
-std::array<float,2>{0.393870562f, 0.115285374f},
-std::array<float,2>{0.653782785f, 0.531068742f},
-std::array<float,2>{0.548628211f, 0.147886261f},
-std::array<float,2>{0.35978353f, 0.674804091f},
-std::array<float,2>{0.21276179f, 0.498001039f},
-std::array<float,2>{0.988259196f, 0.971444964f},
-std::array<float,2>{0.691358209f, 0.395396709f},
-std::array<float,2>{0.499904305f, 0.932919562f},
-std::array<float,2>{0.0297760051f, 0.238836065f},
-std::array<float,2>{0.835545599f, 0.719756424f},
-std::array<float,2>{0.911190391f, 0.0390832871f},
-std::array<float,2>{0.139737874f, 0.597619891f},
-std::array<float,2>{0.285762131f, 0.29824847f},
-std::array<float,2>{0.613699436f, 0.761283934f},
-std::array<float,2>{0.967842519f, 0.462464124f},
-std::array<float,2>{0.223799929f, 0.943446338f},
-std::array<float,2>{0.319364399f, 0.180180386f},
-std::array<float,2>{0.505204797f, 0.653382957f},
-std::array<float,2>{0.668386579f, 0.0677051544f},
-std::array<float,2>{0.433083117f, 0.556978464f},
-std::array<float,2>{0.099748753f, 0.346043378f},
-std::array<float,2>{0.790089548f, 0.838938296f},
-std::array<float,2>{0.56365335f, 0.279813856f},
-std::array<float,2>{0.254266024f, 0.812271774f},
-std::array<float,2>{0.16069071f, 0.00110963418f},
-std::array<float,2>{0.900798917f, 0.566951215f},
-std::array<float,2>{0.849150598f, 0.198798835f},
-std::array<float,2>{0.0371532477f, 0.717073083f},
-std::array<float,2>{0.46526131f, 0.430789739f},
-std::array<float,2>{0.731765449f, 0.877798021f},
-std::array<float,2>{0.85305208f, 0.447492152f},
-std::array<float,2>{0.0417976901f, 0.963253617f},
-std::array<float,2>{0.45661369f, 0.170501307f},
-std::array<float,2>{0.719324231f, 0.636637866f},
-std::array<float,2>{0.575119436f, 0.0824539661f},
-std::array<float,2>{0.261831582f, 0.54631263f},
-std::array<float,2>{0.169023708f, 0.370002717f},
-std::array<float,2>{0.89623487f, 0.827158988f},
-std::array<float,2>{0.661276042f, 0.250516653f},
-std::array<float,2>{0.426155299f, 0.796195269f},
-std::array<float,2>{0.108614117f, 0.0259017702f},
-std::array<float,2>{0.784290612f, 0.592091799f},
-std::array<float,2>{0.953672528f, 0.213772684f},
-std::array<float,2>{0.232774466f, 0.690299034f},
-std::array<float,2>{0.322678506f, 0.407265872f},
-std::array<float,2>{0.513602912f, 0.896567523f},
-std::array<float,2>{0.919975519f, 0.334415823f},
-std::array<float,2>{0.12746276f, 0.86287117f},
-std::array<float,2>{0.289940476f, 0.0940256268f},
-std::array<float,2>{0.62278235f, 0.512182057f},
-std::array<float,2>{0.701423287f, 0.134088874f},
-std::array<float,2>{0.490741789f, 0.671596825f},
-std::array<float,2>{0.0156837124f, 0.483273298f},
-std::array<float,2>{0.842030287f, 0.988163114f},
-std::array<float,2>{0.561115026f, 0.378710479f},
-std::array<float,2>{0.371185601f, 0.91996783f},
-std::array<float,2>{0.204998896f, 0.22685957f},
-std::array<float,2>{0.997897983f, 0.736674428f},
-std::array<float,2>{0.750244021f, 0.0500752516f},
-std::array<float,2>{0.0746281445f, 0.6161412f},
-std::array<float,2>{0.405773997f, 0.282626331f},
-std::array<float,2>{0.645252347f, 0.77123946f},
-std::array<float,2>{0.808484375f, 0.302603513f},
-std::array<float,2>{0.11578428f, 0.763217688f},
-std::array<float,2>{0.414741248f, 0.0445600562f},
-std::array<float,2>{0.674098134f, 0.598599076f},
-std::array<float,2>{0.521487355f, 0.234845757f},
-std::array<float,2>{0.334381014f, 0.72334969f},
-std::array<float,2>{0.240269691f, 0.391150206f},
-std::array<float,2>{0.94875145f, 0.934772432f},
-std::array<float,2>{0.73977536f, 0.494494826f},
-std::array<float,2>{0.449800104f, 0.976008475f},
-std::array<float,2>{0.0624672323f, 0.142711058f},
-std::array<float,2>{0.860095561f, 0.676304936f},
-std::array<float,2>{0.887581885f, 0.110476449f},
-std::array<float,2>{0.181465432f, 0.524663329f},
-std::array<float,2>{0.266967058f, 0.323877603f},
-std::array<float,2>{0.583908379f, 0.84771955f},
-std::array<float,2>{0.974238098f, 0.435410857f},
-std::array<float,2>{0.192956358f, 0.879784584f},
-std::array<float,2>{0.357099473f, 0.199375421f},
-std::array<float,2>{0.539013922f, 0.71129179f},
-std::array<float,2>{0.627322495f, 0.00772437872f},
-std::array<float,2>{0.381387442f, 0.562668979f},
-std::array<float,2>{0.0859716088f, 0.274883032f},
-std::array<float,2>{0.773139417f, 0.806279898f},
-std::array<float,2>{0.609254718f, 0.347891539f},
-std::array<float,2>{0.30676803f, 0.843654156f},
-std::array<float,2>{0.144730866f, 0.0640642345f},
-std::array<float,2>{0.929921031f, 0.560453355f},
-std::array<float,2>{0.81662482f, 0.186370298f},
-std::array<float,2>{0.0108762821f, 0.649105072f},
-std::array<float,2>{0.478233188f, 0.467579186f},
-std::array<float,2>{0.715306818f, 0.939795494f},
-std::array<float,2>{0.776436329f, 0.401799232f},
-std::array<float,2>{0.084763892f, 0.927697182f},
-std::array<float,2>{0.390524536f, 0.249829203f},
-std::array<float,2>{0.634879768f, 0.732998133f},
-std::array<float,2>{0.541061163f, 0.0385787599f},
-std::array<float,2>{0.348979563f, 0.60203886f},
-std::array<float,2>{0.201265588f, 0.308030754f},
-std::array<float,2>{0.983397305f, 0.754594624f},
-std::array<float,2>{0.707116961f, 0.315033227f},
-std::array<float,2>{0.475537241f, 0.855852127f},
-std::array<float,2>{0.00482023461f, 0.121509604f},
-std::array<float,2>{0.821606219f, 0.515926182f},
-std::array<float,2>{0.926313519f, 0.151362315f},
-std::array<float,2>{0.155739769f, 0.683790624f},
-std::array<float,2>{0.303852081f, 0.488168985f},
-std::array<float,2>{0.597927332f, 0.977585196f},
-std::array<float,2>{0.938515425f, 0.265965462f},
-std::array<float,2>{0.247312814f, 0.799028039f},
-std::array<float,2>{0.343239605f, 0.0139534799f},
-std::array<float,2>{0.526058674f, 0.575736284f},
-std::array<float,2>{0.682264924f, 0.193823725f},
-std::array<float,2>{0.410170615f, 0.707656145f},
-std::array<float,2>{0.122020066f, 0.427259475f},
-std::array<float,2>{0.80086869f, 0.883404911f},
-std::array<float,2>{0.590628684f, 0.454432249f},
-std::array<float,2>{0.273612082f, 0.946832955f},
-std::array<float,2>{0.172506168f, 0.17260164f},
-std::array<float,2>{0.878864169f, 0.641985953f},
-std::array<float,2>{0.874657154f, 0.0773763731f},
-std::array<float,2>{0.0488201156f, 0.54763633f},
-std::array<float,2>{0.441827565f, 0.352151185f},
-std::array<float,2>{0.743681312f, 0.830022931f},
-std::array<float,2>{0.829295218f, 0.360532403f},
-std::array<float,2>{0.0240418818f, 0.813781083f},
-std::array<float,2>{0.493130744f, 0.0922409222f},
-std::array<float,2>{0.693986416f, 0.531445742f},
-std::array<float,2>{0.610183656f, 0.15766941f},
-std::array<float,2>{0.28211996f, 0.632588804f},
-std::array<float,2>{0.135386974f, 0.437661767f},
-std::array<float,2>{0.90678376f, 0.960359752f},
-std::array<float,2>{0.651304483f, 0.414627105f},
-std::array<float,2>{0.396666288f, 0.902310371f},
-std::array<float,2>{0.0692521036f, 0.210108832f},
-std::array<float,2>{0.75822711f, 0.70145452f},
-std::array<float,2>{0.989436567f, 0.0165660232f},
-std::array<float,2>{0.215618655f, 0.579507411f},
-std::array<float,2>{0.364960968f, 0.258816153f},
-std::array<float,2>{0.551229954f, 0.788695216f},
-std::array<float,2>{0.906242192f, 0.474711657f},
-std::array<float,2>{0.157271475f, 0.995677829f},
-std::array<float,2>{0.251586169f, 0.130313635f},
-std::array<float,2>{0.566636384f, 0.658069611f},
-std::array<float,2>{0.726985812f, 0.106017239f},
-std::array<float,2>{0.461584151f, 0.50161171f},
-std::array<float,2>{0.0325002261f, 0.343430966f},
-std::array<float,2>{0.845088005f, 0.872309983f},
-std::array<float,2>{0.503468335f, 0.29470849f},
-std::array<float,2>{0.315506965f, 0.775824189f},
-std::array<float,2>{0.22024484f, 0.055756446f},
-std::array<float,2>{0.961430252f, 0.623738825f},
-std::array<float,2>{0.793560863f, 0.224717721f},
-std::array<float,2>{0.0973606333f, 0.744799435f},
-std::array<float,2>{0.437466413f, 0.384903401f},
-std::array<float,2>{0.667115271f, 0.910821974f},
-std::array<float,2>{0.755072832f, 0.459582239f},
-std::array<float,2>{0.0733159855f, 0.951134026f},
-std::array<float,2>{0.398501575f, 0.177407011f},
-std::array<float,2>{0.643218338f, 0.645568669f},
-std::array<float,2>{0.55734086f, 0.0727694556f},
-std::array<float,2>{0.368784487f, 0.552576602f},
-std::array<float,2>{0.208089828f, 0.358825475f},
-std::array<float,2>{0.995682895f, 0.834571779f},
-std::array<float,2>{0.697274506f, 0.271588594f},
-std::array<float,2>{0.484796822f, 0.801737547f},
-std::array<float,2>{0.0221205465f, 0.00853105821f},
-std::array<float,2>{0.838072956f, 0.570695758f},
-std::array<float,2>{0.91716063f, 0.188479587f},
-std::array<float,2>{0.132626057f, 0.705894709f},
-std::array<float,2>{0.294262797f, 0.425233632f},
-std::array<float,2>{0.617201507f, 0.888848424f},
-std::array<float,2>{0.957272649f, 0.317234844f},
-std::array<float,2>{0.227659345f, 0.855187595f},
-std::array<float,2>{0.328124493f, 0.119283937f},
-std::array<float,2>{0.511299014f, 0.52189678f},
-std::array<float,2>{0.656779349f, 0.153873667f},
-std::array<float,2>{0.424354345f, 0.682032406f},
-std::array<float,2>{0.103018917f, 0.491648883f},
-std::array<float,2>{0.789031565f, 0.984310567f},
-std::array<float,2>{0.571168244f, 0.405662358f},
-std::array<float,2>{0.258375108f, 0.925062835f},
-std::array<float,2>{0.165354982f, 0.243314609f},
-std::array<float,2>{0.890755534f, 0.729068637f},
-std::array<float,2>{0.858280301f, 0.0339244232f},
-std::array<float,2>{0.0446634404f, 0.605770111f},
-std::array<float,2>{0.458917588f, 0.312376052f},
-std::array<float,2>{0.72610724f, 0.752594113f},
-std::array<float,2>{0.816179991f, 0.28968361f},
-std::array<float,2>{0.0134627027f, 0.778726339f},
-std::array<float,2>{0.482078999f, 0.0622919202f},
-std::array<float,2>{0.711805165f, 0.620740592f},
-std::array<float,2>{0.601818621f, 0.219866723f},
-std::array<float,2>{0.311036676f, 0.747581363f},
-std::array<float,2>{0.143039256f, 0.388671011f},
-std::array<float,2>{0.936322331f, 0.908798099f},
-std::array<float,2>{0.631391525f, 0.471694916f},
-std::array<float,2>{0.375889331f, 0.997676671f},
-std::array<float,2>{0.0904716179f, 0.126857013f},
-std::array<float,2>{0.76864773f, 0.663297236f},
-std::array<float,2>{0.969997287f, 0.102640413f},
-std::array<float,2>{0.189728081f, 0.505311847f},
-std::array<float,2>{0.354016274f, 0.337689131f},
-std::array<float,2>{0.534925342f, 0.870878935f},
-std::array<float,2>{0.88502723f, 0.420851886f},
-std::array<float,2>{0.186096936f, 0.903413177f},
-std::array<float,2>{0.272811711f, 0.204607919f},
-std::array<float,2>{0.58000648f, 0.697178662f},
-std::array<float,2>{0.737732589f, 0.0202642269f},
-std::array<float,2>{0.447146356f, 0.583316088f},
-std::array<float,2>{0.0584938228f, 0.263108671f},
-std::array<float,2>{0.867113411f, 0.781603217f},
-std::array<float,2>{0.517409205f, 0.366934329f},
-std::array<float,2>{0.331603408f, 0.818505049f},
-std::array<float,2>{0.234751284f, 0.0894307271f},
-std::array<float,2>{0.949750841f, 0.537644088f},
-std::array<float,2>{0.811259806f, 0.163407475f},
-std::array<float,2>{0.109383576f, 0.627800882f},
-std::array<float,2>{0.419037819f, 0.44481644f},
-std::array<float,2>{0.677020788f, 0.953401864f},
-std::array<float,2>{0.868750215f, 0.381554157f},
-std::array<float,2>{0.0508654229f, 0.917730629f},
-std::array<float,2>{0.438874811f, 0.230959043f},
-std::array<float,2>{0.749680698f, 0.740110517f},
-std::array<float,2>{0.589486718f, 0.0530648492f},
-std::array<float,2>{0.278449714f, 0.609917164f},
-std::array<float,2>{0.178346589f, 0.287835002f},
-std::array<float,2>{0.879970014f, 0.766598701f},
-std::array<float,2>{0.68390131f, 0.329970211f},
-std::array<float,2>{0.407236367f, 0.866270483f},
-std::array<float,2>{0.120006472f, 0.0980024412f},
-std::array<float,2>{0.800764799f, 0.510422528f},
-std::array<float,2>{0.943950295f, 0.139606103f},
-std::array<float,2>{0.245133981f, 0.666555285f},
-std::array<float,2>{0.337910086f, 0.479718596f},
-std::array<float,2>{0.528704584f, 0.988630772f},
-std::array<float,2>{0.924338877f, 0.256798357f},
-std::array<float,2>{0.14925772f, 0.79058069f},
-std::array<float,2>{0.298404694f, 0.0290422328f},
-std::array<float,2>{0.597186446f, 0.58743453f},
-std::array<float,2>{0.705275834f, 0.218050182f},
-std::array<float,2>{0.469586462f, 0.691419482f},
-std::array<float,2>{0.00276015815f, 0.412984788f},
-std::array<float,2>{0.826562941f, 0.890718222f},
-std::array<float,2>{0.546818793f, 0.45286271f},
-std::array<float,2>{0.345465124f, 0.966170251f},
-std::array<float,2>{0.195422336f, 0.167084381f},
-std::array<float,2>{0.978570044f, 0.638789117f},
-std::array<float,2>{0.77837652f, 0.080160439f},
-std::array<float,2>{0.0818136632f, 0.539847732f},
-std::array<float,2>{0.385470897f, 0.374424785f},
-std::array<float,2>{0.640532315f, 0.823340714f},
-std::array<float,2>{0.791494787f, 0.344515741f},
-std::array<float,2>{0.099569805f, 0.836327791f},
-std::array<float,2>{0.431300491f, 0.0691987053f},
-std::array<float,2>{0.671533823f, 0.554789007f},
-std::array<float,2>{0.506424844f, 0.182545826f},
-std::array<float,2>{0.316948742f, 0.655890167f},
-std::array<float,2>{0.225421771f, 0.463891119f},
-std::array<float,2>{0.96491909f, 0.942597151f},
-std::array<float,2>{0.732622385f, 0.432173938f},
-std::array<float,2>{0.467247963f, 0.875766158f},
-std::array<float,2>{0.0363404676f, 0.196268901f},
-std::array<float,2>{0.850346327f, 0.714920163f},
-std::array<float,2>{0.899910688f, 0.00342958723f},
-std::array<float,2>{0.162164673f, 0.56862545f},
-std::array<float,2>{0.257136881f, 0.278794289f},
-std::array<float,2>{0.565743387f, 0.809880733f},
-std::array<float,2>{0.985725284f, 0.49819991f},
-std::array<float,2>{0.213710859f, 0.969620943f},
-std::array<float,2>{0.361881942f, 0.145200759f},
-std::array<float,2>{0.550124407f, 0.673486352f},
-std::array<float,2>{0.655110002f, 0.113897905f},
-std::array<float,2>{0.392113864f, 0.528604507f},
-std::array<float,2>{0.063542679f, 0.326831728f},
-std::array<float,2>{0.762003779f, 0.844552696f},
-std::array<float,2>{0.6155231f, 0.300363094f},
-std::array<float,2>{0.288570464f, 0.758592784f},
-std::array<float,2>{0.137374848f, 0.041092556f},
-std::array<float,2>{0.91319263f, 0.593873322f},
-std::array<float,2>{0.833724856f, 0.241883501f},
-std::array<float,2>{0.0292961299f, 0.720924556f},
-std::array<float,2>{0.496969223f, 0.398232728f},
-std::array<float,2>{0.688604295f, 0.930903912f},
-std::array<float,2>{0.84010309f, 0.481945843f},
-std::array<float,2>{0.0186225586f, 0.986266553f},
-std::array<float,2>{0.488911837f, 0.135330454f},
-std::array<float,2>{0.699251294f, 0.668762505f},
-std::array<float,2>{0.62417388f, 0.0975513235f},
-std::array<float,2>{0.292070389f, 0.513999224f},
-std::array<float,2>{0.1258111f, 0.333443701f},
-std::array<float,2>{0.918273747f, 0.85959959f},
-std::array<float,2>{0.647539616f, 0.283746302f},
-std::array<float,2>{0.403416187f, 0.771547198f},
-std::array<float,2>{0.0780687407f, 0.0480270423f},
-std::array<float,2>{0.752389193f, 0.614373744f},
-std::array<float,2>{0.99877739f, 0.22937265f},
-std::array<float,2>{0.205206096f, 0.734450877f},
-std::array<float,2>{0.374029785f, 0.376916558f},
-std::array<float,2>{0.56026125f, 0.91805315f},
-std::array<float,2>{0.897058427f, 0.369101346f},
-std::array<float,2>{0.17031683f, 0.824947834f},
-std::array<float,2>{0.264481932f, 0.0854522139f},
-std::array<float,2>{0.57618767f, 0.54443568f},
-std::array<float,2>{0.721295178f, 0.168215588f},
-std::array<float,2>{0.453501046f, 0.633171082f},
-std::array<float,2>{0.0399161875f, 0.4472197f},
-std::array<float,2>{0.854932785f, 0.961200714f},
-std::array<float,2>{0.515369892f, 0.408297032f},
-std::array<float,2>{0.32064712f, 0.89553678f},
-std::array<float,2>{0.232313052f, 0.211004898f},
-std::array<float,2>{0.956112266f, 0.688686728f},
-std::array<float,2>{0.782295525f, 0.0237740818f},
-std::array<float,2>{0.106171928f, 0.590994775f},
-std::array<float,2>{0.428232163f, 0.252113432f},
-std::array<float,2>{0.663591981f, 0.79352051f},
-std::array<float,2>{0.769766152f, 0.275505334f},
-std::array<float,2>{0.0885380283f, 0.807679236f},
-std::array<float,2>{0.380202055f, 0.00399461621f},
-std::array<float,2>{0.625991344f, 0.564891756f},
-std::array<float,2>{0.536290169f, 0.201414526f},
-std::array<float,2>{0.358293056f, 0.713242948f},
-std::array<float,2>{0.194604531f, 0.437209427f},
-std::array<float,2>{0.974952459f, 0.880863369f},
-std::array<float,2>{0.718065739f, 0.464935452f},
-std::array<float,2>{0.478815764f, 0.937777281f},
-std::array<float,2>{0.00965048559f, 0.183729917f},
-std::array<float,2>{0.818803489f, 0.652324557f},
-std::array<float,2>{0.932031929f, 0.066338554f},
-std::array<float,2>{0.147315234f, 0.560794711f},
-std::array<float,2>{0.306015134f, 0.350983322f},
-std::array<float,2>{0.606565118f, 0.84045136f},
-std::array<float,2>{0.946508586f, 0.3941181f},
-std::array<float,2>{0.240090296f, 0.937496841f},
-std::array<float,2>{0.333532035f, 0.236781269f},
-std::array<float,2>{0.520929635f, 0.726260781f},
-std::array<float,2>{0.673316538f, 0.0462992005f},
-std::array<float,2>{0.417770833f, 0.600060403f},
-std::array<float,2>{0.113914341f, 0.303104758f},
-std::array<float,2>{0.80490303f, 0.763738215f},
-std::array<float,2>{0.584695458f, 0.322173119f},
-std::array<float,2>{0.268683761f, 0.849671602f},
-std::array<float,2>{0.183292747f, 0.112404324f},
-std::array<float,2>{0.889129937f, 0.526459157f},
-std::array<float,2>{0.861722708f, 0.142501369f},
-std::array<float,2>{0.0597550161f, 0.678726137f},
-std::array<float,2>{0.452458292f, 0.493787229f},
-std::array<float,2>{0.741125226f, 0.973381221f},
-std::array<float,2>{0.804110289f, 0.428503394f},
-std::array<float,2>{0.123909317f, 0.885757446f},
-std::array<float,2>{0.413004726f, 0.192985117f},
-std::array<float,2>{0.680834472f, 0.710056484f},
-std::array<float,2>{0.524079144f, 0.0126333274f},
-std::array<float,2>{0.340282738f, 0.576690495f},
-std::array<float,2>{0.249116853f, 0.26860109f},
-std::array<float,2>{0.941069722f, 0.798438311f},
-std::array<float,2>{0.745725989f, 0.353918374f},
-std::array<float,2>{0.443626404f, 0.831853807f},
-std::array<float,2>{0.0503972843f, 0.0745240003f},
-std::array<float,2>{0.872029781f, 0.550011277f},
-std::array<float,2>{0.875579119f, 0.174872518f},
-std::array<float,2>{0.175566018f, 0.643483043f},
-std::array<float,2>{0.27686283f, 0.455110431f},
-std::array<float,2>{0.593725502f, 0.948636055f},
-std::array<float,2>{0.982030153f, 0.306138605f},
-std::array<float,2>{0.199450433f, 0.757235646f},
-std::array<float,2>{0.350709021f, 0.0351868421f},
-std::array<float,2>{0.539537251f, 0.603803992f},
-std::array<float,2>{0.633077979f, 0.246470034f},
-std::array<float,2>{0.387717664f, 0.732269168f},
-std::array<float,2>{0.0827609524f, 0.400173426f},
-std::array<float,2>{0.774449766f, 0.92943418f},
-std::array<float,2>{0.601038873f, 0.485809296f},
-std::array<float,2>{0.301279008f, 0.978816807f},
-std::array<float,2>{0.153911471f, 0.148672029f},
-std::array<float,2>{0.928686559f, 0.686270416f},
-std::array<float,2>{0.822812796f, 0.123126037f},
-std::array<float,2>{0.0060200817f, 0.518331051f},
-std::array<float,2>{0.472732902f, 0.313924253f},
-std::array<float,2>{0.709043622f, 0.857897401f},
-std::array<float,2>{0.847066998f, 0.34039256f},
-std::array<float,2>{0.0341553614f, 0.874647319f},
-std::array<float,2>{0.463986099f, 0.109285846f},
-std::array<float,2>{0.729683816f, 0.502589345f},
-std::array<float,2>{0.569335103f, 0.132226765f},
-std::array<float,2>{0.253004253f, 0.659601271f},
-std::array<float,2>{0.15998821f, 0.474113375f},
-std::array<float,2>{0.902370691f, 0.993902445f},
-std::array<float,2>{0.665158391f, 0.3841649f},
-std::array<float,2>{0.434519082f, 0.912223876f},
-std::array<float,2>{0.0942828581f, 0.223731786f},
-std::array<float,2>{0.795900643f, 0.742773771f},
-std::array<float,2>{0.964413643f, 0.0569166988f},
-std::array<float,2>{0.221579596f, 0.622257411f},
-std::array<float,2>{0.313720524f, 0.296421885f},
-std::array<float,2>{0.500105798f, 0.775153339f},
-std::array<float,2>{0.909023762f, 0.439781636f},
-std::array<float,2>{0.134522751f, 0.957959712f},
-std::array<float,2>{0.284333795f, 0.159176126f},
-std::array<float,2>{0.612823486f, 0.629222155f},
-std::array<float,2>{0.692169189f, 0.0911394358f},
-std::array<float,2>{0.494270235f, 0.533523321f},
-std::array<float,2>{0.0271369368f, 0.361601055f},
-std::array<float,2>{0.830405593f, 0.814543784f},
-std::array<float,2>{0.553830981f, 0.260433435f},
-std::array<float,2>{0.367096424f, 0.786211729f},
-std::array<float,2>{0.217540905f, 0.0191555545f},
-std::array<float,2>{0.990696728f, 0.580709279f},
-std::array<float,2>{0.760887325f, 0.207058206f},
-std::array<float,2>{0.0671386346f, 0.699821532f},
-std::array<float,2>{0.395884573f, 0.416943789f},
-std::array<float,2>{0.64888519f, 0.899823785f},
-std::array<float,2>{0.762402296f, 0.497133166f},
-std::array<float,2>{0.0640613884f, 0.971141577f},
-std::array<float,2>{0.391986668f, 0.148369536f},
-std::array<float,2>{0.654334068f, 0.674152374f},
-std::array<float,2>{0.55057025f, 0.115909256f},
-std::array<float,2>{0.361721545f, 0.530432105f},
-std::array<float,2>{0.212960854f, 0.325449407f},
-std::array<float,2>{0.98586452f, 0.847218335f},
-std::array<float,2>{0.689301312f, 0.298826218f},
-std::array<float,2>{0.49631542f, 0.76084429f},
-std::array<float,2>{0.0284085218f, 0.0398717038f},
-std::array<float,2>{0.83313483f, 0.597137928f},
-std::array<float,2>{0.913861573f, 0.238617882f},
-std::array<float,2>{0.136851683f, 0.7204898f},
-std::array<float,2>{0.288876921f, 0.394932479f},
-std::array<float,2>{0.616133988f, 0.933341682f},
-std::array<float,2>{0.96547991f, 0.346243888f},
-std::array<float,2>{0.224654928f, 0.839753389f},
-std::array<float,2>{0.31664747f, 0.0683017969f},
-std::array<float,2>{0.50620091f, 0.557527542f},
-std::array<float,2>{0.67090708f, 0.179748595f},
-std::array<float,2>{0.430918455f, 0.654244304f},
-std::array<float,2>{0.0990256742f, 0.461946636f},
-std::array<float,2>{0.791696191f, 0.944027722f},
-std::array<float,2>{0.565987229f, 0.431495994f},
-std::array<float,2>{0.257649392f, 0.877274871f},
-std::array<float,2>{0.162736014f, 0.198531464f},
-std::array<float,2>{0.899495006f, 0.717626274f},
-std::array<float,2>{0.84993583f, 0.00155504781f},
-std::array<float,2>{0.0368674695f, 0.566424787f},
-std::array<float,2>{0.467511535f, 0.279750109f},
-std::array<float,2>{0.733301461f, 0.811832309f},
-std::array<float,2>{0.826933444f, 0.255322337f},
-std::array<float,2>{0.00213476317f, 0.791941762f},
-std::array<float,2>{0.468916595f, 0.0308999624f},
-std::array<float,2>{0.705844939f, 0.588376522f},
-std::array<float,2>{0.597083926f, 0.215275764f},
-std::array<float,2>{0.29830876f, 0.695010662f},
-std::array<float,2>{0.148867577f, 0.411034614f},
-std::array<float,2>{0.924139142f, 0.893309534f},
-std::array<float,2>{0.639821649f, 0.45021686f},
-std::array<float,2>{0.385085911f, 0.967843294f},
-std::array<float,2>{0.0814919621f, 0.164157733f},
-std::array<float,2>{0.779245138f, 0.637116671f},
-std::array<float,2>{0.979015648f, 0.0798100904f},
-std::array<float,2>{0.196086809f, 0.541792035f},
-std::array<float,2>{0.345124394f, 0.371951282f},
-std::array<float,2>{0.545925736f, 0.820641696f},
-std::array<float,2>{0.8804003f, 0.380823463f},
-std::array<float,2>{0.178052455f, 0.914309442f},
-std::array<float,2>{0.279052019f, 0.234001726f},
-std::array<float,2>{0.588965237f, 0.740287066f},
-std::array<float,2>{0.749159694f, 0.0512074456f},
-std::array<float,2>{0.439131707f, 0.611728728f},
-std::array<float,2>{0.051561892f, 0.285900533f},
-std::array<float,2>{0.868649423f, 0.769152164f},
-std::array<float,2>{0.528830409f, 0.330365062f},
-std::array<float,2>{0.338773012f, 0.864836037f},
-std::array<float,2>{0.245616525f, 0.100329094f},
-std::array<float,2>{0.943606734f, 0.508785903f},
-std::array<float,2>{0.799807966f, 0.138007894f},
-std::array<float,2>{0.11951232f, 0.664555073f},
-std::array<float,2>{0.407845616f, 0.477334082f},
-std::array<float,2>{0.684174895f, 0.99077487f},
-std::array<float,2>{0.866375327f, 0.41920504f},
-std::array<float,2>{0.0578228049f, 0.905854285f},
-std::array<float,2>{0.446410447f, 0.207017869f},
-std::array<float,2>{0.737971425f, 0.697354913f},
-std::array<float,2>{0.579363227f, 0.0221489929f},
-std::array<float,2>{0.273231238f, 0.584799349f},
-std::array<float,2>{0.185715735f, 0.264121562f},
-std::array<float,2>{0.88546735f, 0.78407073f},
-std::array<float,2>{0.677681804f, 0.363496006f},
-std::array<float,2>{0.419844717f, 0.817801416f},
-std::array<float,2>{0.109872192f, 0.0875461474f},
-std::array<float,2>{0.811029792f, 0.536686301f},
-std::array<float,2>{0.949487746f, 0.161124662f},
-std::array<float,2>{0.235248089f, 0.62636137f},
-std::array<float,2>{0.331355751f, 0.442092389f},
-std::array<float,2>{0.516721249f, 0.956549406f},
-std::array<float,2>{0.93575722f, 0.291535765f},
-std::array<float,2>{0.143284082f, 0.779364288f},
-std::array<float,2>{0.310803592f, 0.0590938665f},
-std::array<float,2>{0.602363765f, 0.618309379f},
-std::array<float,2>{0.711387336f, 0.222283572f},
-std::array<float,2>{0.481614918f, 0.74965024f},
-std::array<float,2>{0.0127714826f, 0.39040029f},
-std::array<float,2>{0.815688372f, 0.906273782f},
-std::array<float,2>{0.534295261f, 0.46991542f},
-std::array<float,2>{0.353674501f, 0.99823916f},
-std::array<float,2>{0.19026868f, 0.128574654f},
-std::array<float,2>{0.970495343f, 0.660738528f},
-std::array<float,2>{0.769159555f, 0.104372509f},
-std::array<float,2>{0.090189442f, 0.506086111f},
-std::array<float,2>{0.375303417f, 0.338609785f},
-std::array<float,2>{0.631102324f, 0.868353963f},
-std::array<float,2>{0.788517952f, 0.319656461f},
-std::array<float,2>{0.103223525f, 0.852147043f},
-std::array<float,2>{0.423838198f, 0.118909128f},
-std::array<float,2>{0.656304836f, 0.52027458f},
-std::array<float,2>{0.511122227f, 0.155824661f},
-std::array<float,2>{0.327182591f, 0.680526137f},
-std::array<float,2>{0.228188366f, 0.489702553f},
-std::array<float,2>{0.95761168f, 0.980496049f},
-std::array<float,2>{0.725807965f, 0.403691232f},
-std::array<float,2>{0.458184659f, 0.922391653f},
-std::array<float,2>{0.0441792496f, 0.245604739f},
-std::array<float,2>{0.857437789f, 0.728466988f},
-std::array<float,2>{0.891198874f, 0.0315538161f},
-std::array<float,2>{0.165806651f, 0.609252393f},
-std::array<float,2>{0.257966667f, 0.310173839f},
-std::array<float,2>{0.570561767f, 0.750039399f},
-std::array<float,2>{0.995346367f, 0.458765537f},
-std::array<float,2>{0.208708838f, 0.953042984f},
-std::array<float,2>{0.368336946f, 0.179374948f},
-std::array<float,2>{0.557089388f, 0.64772141f},
-std::array<float,2>{0.642904222f, 0.0722151995f},
-std::array<float,2>{0.399223864f, 0.553315938f},
-std::array<float,2>{0.0741456002f, 0.35619083f},
-std::array<float,2>{0.755429506f, 0.83306694f},
-std::array<float,2>{0.618061781f, 0.270495176f},
-std::array<float,2>{0.294674516f, 0.804517388f},
-std::array<float,2>{0.132299319f, 0.011446652f},
-std::array<float,2>{0.917569458f, 0.573895335f},
-std::array<float,2>{0.838627696f, 0.189484254f},
-std::array<float,2>{0.0218117926f, 0.703881025f},
-std::array<float,2>{0.485275388f, 0.42328319f},
-std::array<float,2>{0.698233902f, 0.886774421f},
-std::array<float,2>{0.83061713f, 0.438308835f},
-std::array<float,2>{0.0265214816f, 0.960896313f},
-std::array<float,2>{0.49473682f, 0.15807651f},
-std::array<float,2>{0.691555142f, 0.632004738f},
-std::array<float,2>{0.612341523f, 0.0926916525f},
-std::array<float,2>{0.284793437f, 0.53175205f},
-std::array<float,2>{0.133985206f, 0.361073971f},
-std::array<float,2>{0.908686578f, 0.814178705f},
-std::array<float,2>{0.649248123f, 0.259393245f},
-std::array<float,2>{0.396182477f, 0.788183153f},
-std::array<float,2>{0.0665441602f, 0.0157109033f},
-std::array<float,2>{0.761382937f, 0.579788983f},
-std::array<float,2>{0.991167665f, 0.210715488f},
-std::array<float,2>{0.216877177f, 0.701720357f},
-std::array<float,2>{0.366664022f, 0.414171129f},
-std::array<float,2>{0.554272532f, 0.901524007f},
-std::array<float,2>{0.903051496f, 0.342973262f},
-std::array<float,2>{0.159599245f, 0.872762382f},
-std::array<float,2>{0.253791034f, 0.105778143f},
-std::array<float,2>{0.568367779f, 0.50131768f},
-std::array<float,2>{0.730467916f, 0.130848125f},
-std::array<float,2>{0.464508832f, 0.657459319f},
-std::array<float,2>{0.0336907245f, 0.47518906f},
-std::array<float,2>{0.847373664f, 0.995598733f},
-std::array<float,2>{0.500808716f, 0.385398567f},
-std::array<float,2>{0.314423531f, 0.91030556f},
-std::array<float,2>{0.220741928f, 0.225164115f},
-std::array<float,2>{0.964159966f, 0.744291723f},
-std::array<float,2>{0.796489179f, 0.0564328954f},
-std::array<float,2>{0.0939022228f, 0.623080194f},
-std::array<float,2>{0.433806777f, 0.294090301f},
-std::array<float,2>{0.665913284f, 0.776232004f},
-std::array<float,2>{0.775314212f, 0.308305025f},
-std::array<float,2>{0.0824786127f, 0.753964961f},
-std::array<float,2>{0.388530612f, 0.0384554043f},
-std::array<float,2>{0.633720815f, 0.602434993f},
-std::array<float,2>{0.539699018f, 0.249174833f},
-std::array<float,2>{0.351541042f, 0.732822359f},
-std::array<float,2>{0.199839219f, 0.401989341f},
-std::array<float,2>{0.981473804f, 0.927198827f},
-std::array<float,2>{0.709911942f, 0.48751238f},
-std::array<float,2>{0.473470807f, 0.978131711f},
-std::array<float,2>{0.00681788754f, 0.150561795f},
-std::array<float,2>{0.822565198f, 0.68412149f},
-std::array<float,2>{0.927763343f, 0.121838033f},
-std::array<float,2>{0.15332514f, 0.516266465f},
-std::array<float,2>{0.300946087f, 0.314478427f},
-std::array<float,2>{0.601296604f, 0.856404126f},
-std::array<float,2>{0.940746665f, 0.427043855f},
-std::array<float,2>{0.249549717f, 0.883043408f},
-std::array<float,2>{0.340808004f, 0.194109648f},
-std::array<float,2>{0.523522139f, 0.707051516f},
-std::array<float,2>{0.681562006f, 0.0145515501f},
-std::array<float,2>{0.412257463f, 0.575429142f},
-std::array<float,2>{0.123434521f, 0.266534328f},
-std::array<float,2>{0.804273129f, 0.799675584f},
-std::array<float,2>{0.593156517f, 0.351853281f},
-std::array<float,2>{0.276477396f, 0.829320073f},
-std::array<float,2>{0.175215349f, 0.0777038857f},
-std::array<float,2>{0.875049233f, 0.547228277f},
-std::array<float,2>{0.871556461f, 0.172103733f},
-std::array<float,2>{0.0502862372f, 0.642202616f},
-std::array<float,2>{0.443933964f, 0.454934776f},
-std::array<float,2>{0.745131314f, 0.946502984f},
-std::array<float,2>{0.805384398f, 0.39104405f},
-std::array<float,2>{0.113496557f, 0.935443401f},
-std::array<float,2>{0.417173892f, 0.234912634f},
-std::array<float,2>{0.673603892f, 0.722731471f},
-std::array<float,2>{0.521005869f, 0.0441881865f},
-std::array<float,2>{0.333345443f, 0.598090708f},
-std::array<float,2>{0.239655316f, 0.30203101f},
-std::array<float,2>{0.947043777f, 0.76287818f},
-std::array<float,2>{0.740659475f, 0.32332024f},
-std::array<float,2>{0.452781022f, 0.848581493f},
-std::array<float,2>{0.0604643896f, 0.111259766f},
-std::array<float,2>{0.862242699f, 0.525141418f},
-std::array<float,2>{0.889415741f, 0.143454283f},
-std::array<float,2>{0.182668418f, 0.67614007f},
-std::array<float,2>{0.26952529f, 0.494841516f},
-std::array<float,2>{0.584036469f, 0.976222992f},
-std::array<float,2>{0.975583196f, 0.275144488f},
-std::array<float,2>{0.194894776f, 0.806150615f},
-std::array<float,2>{0.357489347f, 0.00686809793f},
-std::array<float,2>{0.537094116f, 0.563189983f},
-std::array<float,2>{0.626767516f, 0.199830249f},
-std::array<float,2>{0.380387664f, 0.711485505f},
-std::array<float,2>{0.0879672542f, 0.434636712f},
-std::array<float,2>{0.770243585f, 0.879293084f},
-std::array<float,2>{0.607412934f, 0.467081517f},
-std::array<float,2>{0.306200236f, 0.940205574f},
-std::array<float,2>{0.146599501f, 0.18591021f},
-std::array<float,2>{0.932204843f, 0.648863792f},
-std::array<float,2>{0.819035828f, 0.0638492331f},
-std::array<float,2>{0.00899925735f, 0.559853017f},
-std::array<float,2>{0.479148626f, 0.348504901f},
-std::array<float,2>{0.71861279f, 0.843183815f},
-std::array<float,2>{0.855137646f, 0.369487315f},
-std::array<float,2>{0.0395377688f, 0.828124881f},
-std::array<float,2>{0.453974605f, 0.0829751268f},
-std::array<float,2>{0.720728457f, 0.546621501f},
-std::array<float,2>{0.576698899f, 0.170071602f},
-std::array<float,2>{0.263876617f, 0.635915577f},
-std::array<float,2>{0.170851707f, 0.448055804f},
-std::array<float,2>{0.896506011f, 0.96353066f},
-std::array<float,2>{0.663116813f, 0.408126652f},
-std::array<float,2>{0.427941859f, 0.897349358f},
-std::array<float,2>{0.105665676f, 0.213268638f},
-std::array<float,2>{0.782818615f, 0.689703941f},
-std::array<float,2>{0.956822872f, 0.0254157037f},
-std::array<float,2>{0.231829837f, 0.592677236f},
-std::array<float,2>{0.321246266f, 0.250167906f},
-std::array<float,2>{0.51486069f, 0.796869636f},
-std::array<float,2>{0.918900609f, 0.482789516f},
-std::array<float,2>{0.125284985f, 0.987458348f},
-std::array<float,2>{0.292628556f, 0.134306222f},
-std::array<float,2>{0.624577165f, 0.671350658f},
-std::array<float,2>{0.699971855f, 0.0946551263f},
-std::array<float,2>{0.488703549f, 0.51263845f},
-std::array<float,2>{0.0193439238f, 0.334921956f},
-std::array<float,2>{0.840394437f, 0.862586617f},
-std::array<float,2>{0.559903026f, 0.283179313f},
-std::array<float,2>{0.374876171f, 0.770838916f},
-std::array<float,2>{0.205735669f, 0.0505027585f},
-std::array<float,2>{0.998506367f, 0.615677714f},
-std::array<float,2>{0.752499044f, 0.227265626f},
-std::array<float,2>{0.0772994906f, 0.736938f},
-std::array<float,2>{0.404197007f, 0.37816903f},
-std::array<float,2>{0.648417711f, 0.920530498f},
-std::array<float,2>{0.790927827f, 0.464711815f},
-std::array<float,2>{0.100278877f, 0.943257034f},
-std::array<float,2>{0.433537722f, 0.181784987f},
-std::array<float,2>{0.668811858f, 0.655716538f},
-std::array<float,2>{0.505754709f, 0.068795979f},
-std::array<float,2>{0.320027798f, 0.555571556f},
-std::array<float,2>{0.224355862f, 0.344013214f},
-std::array<float,2>{0.968509138f, 0.836710274f},
-std::array<float,2>{0.732334256f, 0.279105276f},
-std::array<float,2>{0.465448916f, 0.810458004f},
-std::array<float,2>{0.038029898f, 0.00321374764f},
-std::array<float,2>{0.848694503f, 0.568916619f},
-std::array<float,2>{0.901004493f, 0.195677653f},
-std::array<float,2>{0.16034992f, 0.715553284f},
-std::array<float,2>{0.254856229f, 0.431889504f},
-std::array<float,2>{0.56412518f, 0.875418961f},
-std::array<float,2>{0.987422764f, 0.326446325f},
-std::array<float,2>{0.211923838f, 0.84390223f},
-std::array<float,2>{0.360198468f, 0.113326989f},
-std::array<float,2>{0.54791224f, 0.528891742f},
-std::array<float,2>{0.654272258f, 0.144948274f},
-std::array<float,2>{0.394279689f, 0.673246741f},
-std::array<float,2>{0.0644903332f, 0.498990744f},
-std::array<float,2>{0.764315724f, 0.969116807f},
-std::array<float,2>{0.613850117f, 0.397545636f},
-std::array<float,2>{0.285164267f, 0.93163532f},
-std::array<float,2>{0.140256345f, 0.241284505f},
-std::array<float,2>{0.911895156f, 0.721267164f},
-std::array<float,2>{0.835228443f, 0.0419203602f},
-std::array<float,2>{0.0299942363f, 0.594427526f},
-std::array<float,2>{0.499495506f, 0.299961835f},
-std::array<float,2>{0.69068259f, 0.757851839f},
-std::array<float,2>{0.871013165f, 0.287583083f},
-std::array<float,2>{0.0532655753f, 0.765714049f},
-std::array<float,2>{0.440960616f, 0.0536832921f},
-std::array<float,2>{0.746298254f, 0.609821141f},
-std::array<float,2>{0.587366164f, 0.230846226f},
-std::array<float,2>{0.280792534f, 0.739356101f},
-std::array<float,2>{0.176487789f, 0.38100183f},
-std::array<float,2>{0.881148398f, 0.917370737f},
-std::array<float,2>{0.6860466f, 0.480256349f},
-std::array<float,2>{0.409355968f, 0.988911748f},
-std::array<float,2>{0.117279135f, 0.139135867f},
-std::array<float,2>{0.798631728f, 0.666246176f},
-std::array<float,2>{0.941581547f, 0.0986277461f},
-std::array<float,2>{0.243967995f, 0.510137618f},
-std::array<float,2>{0.336850017f, 0.329429597f},
-std::array<float,2>{0.53002423f, 0.866955936f},
-std::array<float,2>{0.923757374f, 0.412165493f},
-std::array<float,2>{0.151485071f, 0.89137131f},
-std::array<float,2>{0.300516188f, 0.218358129f},
-std::array<float,2>{0.595603764f, 0.691929162f},
-std::array<float,2>{0.703565359f, 0.028674148f},
-std::array<float,2>{0.470769256f, 0.5869385f},
-std::array<float,2>{0.00189031498f, 0.256203026f},
-std::array<float,2>{0.825212061f, 0.790363073f},
-std::array<float,2>{0.544841409f, 0.374911994f},
-std::array<float,2>{0.345755339f, 0.823922217f},
-std::array<float,2>{0.198948473f, 0.0809220597f},
-std::array<float,2>{0.977481246f, 0.539279103f},
-std::array<float,2>{0.780089259f, 0.167665884f},
-std::array<float,2>{0.0797464997f, 0.63935864f},
-std::array<float,2>{0.384567261f, 0.452627331f},
-std::array<float,2>{0.638445437f, 0.966505229f},
-std::array<float,2>{0.812957346f, 0.387823761f},
-std::array<float,2>{0.0147323739f, 0.908654869f},
-std::array<float,2>{0.482550919f, 0.220675573f},
-std::array<float,2>{0.714336514f, 0.747372508f},
-std::array<float,2>{0.604197621f, 0.0616386719f},
-std::array<float,2>{0.309694856f, 0.620351732f},
-std::array<float,2>{0.141642958f, 0.289153546f},
-std::array<float,2>{0.933932126f, 0.778820992f},
-std::array<float,2>{0.630313993f, 0.336927772f},
-std::array<float,2>{0.376977116f, 0.870370865f},
-std::array<float,2>{0.0934282169f, 0.103296749f},
-std::array<float,2>{0.766983807f, 0.505750656f},
-std::array<float,2>{0.970942557f, 0.126426026f},
-std::array<float,2>{0.187677771f, 0.66361165f},
-std::array<float,2>{0.352007449f, 0.472465426f},
-std::array<float,2>{0.532822013f, 0.997555435f},
-std::array<float,2>{0.882840693f, 0.263342828f},
-std::array<float,2>{0.18523106f, 0.782207608f},
-std::array<float,2>{0.270772159f, 0.0196388382f},
-std::array<float,2>{0.581894279f, 0.583718777f},
-std::array<float,2>{0.735037386f, 0.204322502f},
-std::array<float,2>{0.448279381f, 0.69630444f},
-std::array<float,2>{0.0554190055f, 0.420183122f},
-std::array<float,2>{0.864795029f, 0.903900325f},
-std::array<float,2>{0.518624425f, 0.445309907f},
-std::array<float,2>{0.32881698f, 0.953643322f},
-std::array<float,2>{0.236780256f, 0.163931161f},
-std::array<float,2>{0.951785803f, 0.627024889f},
-std::array<float,2>{0.810460806f, 0.0890409127f},
-std::array<float,2>{0.111525983f, 0.537171364f},
-std::array<float,2>{0.420026153f, 0.3665452f},
-std::array<float,2>{0.679442108f, 0.819247603f},
-std::array<float,2>{0.757069826f, 0.359132111f},
-std::array<float,2>{0.0720526651f, 0.834159255f},
-std::array<float,2>{0.400903136f, 0.072709322f},
-std::array<float,2>{0.641481936f, 0.551959634f},
-std::array<float,2>{0.554839492f, 0.177154094f},
-std::array<float,2>{0.370185822f, 0.646118164f},
-std::array<float,2>{0.209447026f, 0.459334314f},
-std::array<float,2>{0.992598891f, 0.950277209f},
-std::array<float,2>{0.696502328f, 0.425339401f},
-std::array<float,2>{0.486450464f, 0.889247894f},
-std::array<float,2>{0.019913476f, 0.189209208f},
-std::array<float,2>{0.837703764f, 0.705392957f},
-std::array<float,2>{0.914132655f, 0.00792722404f},
-std::array<float,2>{0.130806148f, 0.570975065f},
-std::array<float,2>{0.295094371f, 0.272424728f},
-std::array<float,2>{0.619448423f, 0.800886989f},
-std::array<float,2>{0.959972799f, 0.491842389f},
-std::array<float,2>{0.230466783f, 0.983494461f},
-std::array<float,2>{0.325466901f, 0.153346792f},
-std::array<float,2>{0.508437335f, 0.68250978f},
-std::array<float,2>{0.659984231f, 0.119677216f},
-std::array<float,2>{0.422169745f, 0.522065043f},
-std::array<float,2>{0.10452766f, 0.31688413f},
-std::array<float,2>{0.78567344f, 0.854660034f},
-std::array<float,2>{0.573792517f, 0.311845362f},
-std::array<float,2>{0.260891289f, 0.752105594f},
-std::array<float,2>{0.167439252f, 0.0333726071f},
-std::array<float,2>{0.892894208f, 0.606015563f},
-std::array<float,2>{0.856365204f, 0.243809983f},
-std::array<float,2>{0.0462881103f, 0.728731096f},
-std::array<float,2>{0.460677564f, 0.406124234f},
-std::array<float,2>{0.724004805f, 0.92577374f},
-std::array<float,2>{0.845223665f, 0.474200904f},
-std::array<float,2>{0.0328596272f, 0.993500531f},
-std::array<float,2>{0.460964859f, 0.132390827f},
-std::array<float,2>{0.727390468f, 0.659976602f},
-std::array<float,2>{0.567367852f, 0.108541444f},
-std::array<float,2>{0.251088738f, 0.502293229f},
-std::array<float,2>{0.157893762f, 0.339855134f},
-std::array<float,2>{0.905738711f, 0.874304533f},
-std::array<float,2>{0.667723358f, 0.296365917f},
-std::array<float,2>{0.436822593f, 0.774421275f},
-std::array<float,2>{0.0967412591f, 0.057373751f},
-std::array<float,2>{0.793289721f, 0.622725844f},
-std::array<float,2>{0.961101949f, 0.224456802f},
-std::array<float,2>{0.220087528f, 0.742202759f},
-std::array<float,2>{0.316034257f, 0.384337634f},
-std::array<float,2>{0.503169954f, 0.912737489f},
-std::array<float,2>{0.906538069f, 0.36200428f},
-std::array<float,2>{0.134864226f, 0.814945877f},
-std::array<float,2>{0.281612813f, 0.0914365798f},
-std::array<float,2>{0.609494865f, 0.533768654f},
-std::array<float,2>{0.693473101f, 0.15860112f},
-std::array<float,2>{0.492190659f, 0.62944454f},
-std::array<float,2>{0.0237373691f, 0.440365344f},
-std::array<float,2>{0.829643071f, 0.957378745f},
-std::array<float,2>{0.55126971f, 0.416494578f},
-std::array<float,2>{0.364275128f, 0.900008321f},
-std::array<float,2>{0.215113834f, 0.207627863f},
-std::array<float,2>{0.989858925f, 0.699426651f},
-std::array<float,2>{0.758750856f, 0.0188289937f},
-std::array<float,2>{0.068767406f, 0.580159724f},
-std::array<float,2>{0.397097051f, 0.259951174f},
-std::array<float,2>{0.650579989f, 0.787077308f},
-std::array<float,2>{0.801576614f, 0.269495279f},
-std::array<float,2>{0.121503204f, 0.79808414f},
-std::array<float,2>{0.41107136f, 0.012088934f},
-std::array<float,2>{0.681771338f, 0.576341391f},
-std::array<float,2>{0.525478065f, 0.192545757f},
-std::array<float,2>{0.343458056f, 0.71088779f},
-std::array<float,2>{0.247798517f, 0.427809596f},
-std::array<float,2>{0.939269662f, 0.886566818f},
-std::array<float,2>{0.743489206f, 0.455666453f},
-std::array<float,2>{0.442198634f, 0.948903799f},
-std::array<float,2>{0.0481360555f, 0.175735608f},
-std::array<float,2>{0.874350309f, 0.642806351f},
-std::array<float,2>{0.878383756f, 0.0750231743f},
-std::array<float,2>{0.171966016f, 0.550691903f},
-std::array<float,2>{0.274338841f, 0.354251862f},
-std::array<float,2>{0.59003222f, 0.8311041f},
-std::array<float,2>{0.98286128f, 0.399510294f},
-std::array<float,2>{0.201896116f, 0.929169953f},
-std::array<float,2>{0.349146932f, 0.24689053f},
-std::array<float,2>{0.541745842f, 0.731830657f},
-std::array<float,2>{0.635372758f, 0.0361027494f},
-std::array<float,2>{0.389976442f, 0.604345441f},
-std::array<float,2>{0.0840642899f, 0.306279361f},
-std::array<float,2>{0.777044296f, 0.757573962f},
-std::array<float,2>{0.598618627f, 0.314005405f},
-std::array<float,2>{0.304279685f, 0.858029902f},
-std::array<float,2>{0.156076744f, 0.123925067f},
-std::array<float,2>{0.925906181f, 0.517996609f},
-std::array<float,2>{0.821906149f, 0.148933575f},
-std::array<float,2>{0.0043167863f, 0.685845137f},
-std::array<float,2>{0.474919856f, 0.486162245f},
-std::array<float,2>{0.707935154f, 0.979204953f},
-std::array<float,2>{0.772570908f, 0.436923802f},
-std::array<float,2>{0.0866841078f, 0.881789148f},
-std::array<float,2>{0.381201327f, 0.201744497f},
-std::array<float,2>{0.627760351f, 0.713729978f},
-std::array<float,2>{0.538191974f, 0.004686411f},
-std::array<float,2>{0.356749803f, 0.565238953f},
-std::array<float,2>{0.192596108f, 0.276151448f},
-std::array<float,2>{0.973935664f, 0.808241487f},
-std::array<float,2>{0.715604663f, 0.351467401f},
-std::array<float,2>{0.477736056f, 0.839984417f},
-std::array<float,2>{0.0112790372f, 0.0656005591f},
-std::array<float,2>{0.817123055f, 0.561277807f},
-std::array<float,2>{0.930375099f, 0.184329182f},
-std::array<float,2>{0.145374805f, 0.651433468f},
-std::array<float,2>{0.307582706f, 0.465611756f},
-std::array<float,2>{0.608641922f, 0.938456535f},
-std::array<float,2>{0.948566914f, 0.303598046f},
-std::array<float,2>{0.240910798f, 0.764323354f},
-std::array<float,2>{0.334783196f, 0.0467202663f},
-std::array<float,2>{0.522178233f, 0.600245893f},
-std::array<float,2>{0.674513638f, 0.237247869f},
-std::array<float,2>{0.414204746f, 0.725882292f},
-std::array<float,2>{0.115510434f, 0.393728614f},
-std::array<float,2>{0.807732821f, 0.936860621f},
-std::array<float,2>{0.583141327f, 0.493205547f},
-std::array<float,2>{0.267576993f, 0.973116815f},
-std::array<float,2>{0.181053132f, 0.141696081f},
-std::array<float,2>{0.887195408f, 0.679202139f},
-std::array<float,2>{0.859839797f, 0.113274433f},
-std::array<float,2>{0.0617247298f, 0.526885092f},
-std::array<float,2>{0.449280828f, 0.321755081f},
-std::array<float,2>{0.739385784f, 0.850123644f},
-std::array<float,2>{0.842641354f, 0.33358866f},
-std::array<float,2>{0.0162733532f, 0.860138416f},
-std::array<float,2>{0.490404278f, 0.0970350653f},
-std::array<float,2>{0.701997936f, 0.514595091f},
-std::array<float,2>{0.622269452f, 0.134978965f},
-std::array<float,2>{0.289352983f, 0.668337345f},
-std::array<float,2>{0.126956552f, 0.481807172f},
-std::array<float,2>{0.920504987f, 0.985367775f},
-std::array<float,2>{0.644651532f, 0.376151055f},
-std::array<float,2>{0.405526698f, 0.918702602f},
-std::array<float,2>{0.0749901459f, 0.22870566f},
-std::array<float,2>{0.750885248f, 0.734944582f},
-std::array<float,2>{0.997093856f, 0.0484277532f},
-std::array<float,2>{0.204340085f, 0.614879251f},
-std::array<float,2>{0.372017056f, 0.283411056f},
-std::array<float,2>{0.560947061f, 0.772394538f},
-std::array<float,2>{0.895918846f, 0.446607739f},
-std::array<float,2>{0.169650391f, 0.961474776f},
-std::array<float,2>{0.262460113f, 0.168913871f},
-std::array<float,2>{0.574573278f, 0.633480787f},
-std::array<float,2>{0.718784571f, 0.0851124749f},
-std::array<float,2>{0.456374466f, 0.544009387f},
-std::array<float,2>{0.0414539389f, 0.368628025f},
-std::array<float,2>{0.852927804f, 0.824318886f},
-std::array<float,2>{0.512907445f, 0.252622843f},
-std::array<float,2>{0.323070616f, 0.793452263f},
-std::array<float,2>{0.232950106f, 0.024166774f},
-std::array<float,2>{0.953343034f, 0.591499567f},
-std::array<float,2>{0.784819663f, 0.211800724f},
-std::array<float,2>{0.108977906f, 0.689295948f},
-std::array<float,2>{0.426472366f, 0.408982396f},
-std::array<float,2>{0.661638081f, 0.89640373f},
-std::array<float,2>{0.797061324f, 0.478320152f},
-std::array<float,2>{0.118751571f, 0.991391897f},
-std::array<float,2>{0.408211708f, 0.136883214f},
-std::array<float,2>{0.687441111f, 0.665708303f},
-std::array<float,2>{0.531024456f, 0.101451792f},
-std::array<float,2>{0.336970538f, 0.509625077f},
-std::array<float,2>{0.242806613f, 0.331867337f},
-std::array<float,2>{0.942568004f, 0.863614321f},
-std::array<float,2>{0.747430623f, 0.286721706f},
-std::array<float,2>{0.44035697f, 0.768441975f},
-std::array<float,2>{0.0542875342f, 0.0519866794f},
-std::array<float,2>{0.869423568f, 0.612470567f},
-std::array<float,2>{0.881991267f, 0.232592076f},
-std::array<float,2>{0.176946625f, 0.741668761f},
-std::array<float,2>{0.279415578f, 0.37896657f},
-std::array<float,2>{0.586498618f, 0.915794313f},
-std::array<float,2>{0.978074133f, 0.372706503f},
-std::array<float,2>{0.198197022f, 0.821290255f},
-std::array<float,2>{0.346983373f, 0.0786821246f},
-std::array<float,2>{0.542970836f, 0.542345643f},
-std::array<float,2>{0.636836529f, 0.16537255f},
-std::array<float,2>{0.382860184f, 0.638023615f},
-std::array<float,2>{0.0785099417f, 0.449453264f},
-std::array<float,2>{0.780744135f, 0.967290998f},
-std::array<float,2>{0.593754113f, 0.411968499f},
-std::array<float,2>{0.299787402f, 0.894498706f},
-std::array<float,2>{0.150781617f, 0.216788754f},
-std::array<float,2>{0.922745228f, 0.693766236f},
-std::array<float,2>{0.824562371f, 0.0294719692f},
-std::array<float,2>{0.00014472648f, 0.589840531f},
-std::array<float,2>{0.472624779f, 0.254634619f},
-std::array<float,2>{0.704498708f, 0.792032659f},
-std::array<float,2>{0.847987056f, 0.280713677f},
-std::array<float,2>{0.0384024903f, 0.811288059f},
-std::array<float,2>{0.466031104f, 0.000287924195f},
-std::array<float,2>{0.73101449f, 0.568276584f},
-std::array<float,2>{0.56252563f, 0.197445095f},
-std::array<float,2>{0.255618751f, 0.71806252f},
-std::array<float,2>{0.161465332f, 0.430476308f},
-std::array<float,2>{0.901433527f, 0.878722191f},
-std::array<float,2>{0.669767141f, 0.461060762f},
-std::array<float,2>{0.432052702f, 0.944778919f},
-std::array<float,2>{0.100960121f, 0.18078357f},
-std::array<float,2>{0.789874494f, 0.653113961f},
-std::array<float,2>{0.967752516f, 0.0669033974f},
-std::array<float,2>{0.222984761f, 0.557872176f},
-std::array<float,2>{0.319285393f, 0.346729636f},
-std::array<float,2>{0.504617512f, 0.837921202f},
-std::array<float,2>{0.910748482f, 0.395591021f},
-std::array<float,2>{0.138774559f, 0.932124019f},
-std::array<float,2>{0.287068605f, 0.240230188f},
-std::array<float,2>{0.615078986f, 0.719474316f},
-std::array<float,2>{0.689459383f, 0.0406808294f},
-std::array<float,2>{0.498655289f, 0.595791638f},
-std::array<float,2>{0.0305261854f, 0.297176361f},
-std::array<float,2>{0.834656358f, 0.760718882f},
-std::array<float,2>{0.547318995f, 0.324342012f},
-std::array<float,2>{0.360518128f, 0.845771849f},
-std::array<float,2>{0.211908579f, 0.117034145f},
-std::array<float,2>{0.987206995f, 0.529404759f},
-std::array<float,2>{0.765467525f, 0.147239953f},
-std::array<float,2>{0.065876469f, 0.674876094f},
-std::array<float,2>{0.393397629f, 0.496532887f},
-std::array<float,2>{0.653306842f, 0.972074211f},
-std::array<float,2>{0.836808383f, 0.42213124f},
-std::array<float,2>{0.0207154825f, 0.888495028f},
-std::array<float,2>{0.487967581f, 0.190483555f},
-std::array<float,2>{0.695704818f, 0.704319715f},
-std::array<float,2>{0.620490372f, 0.0104273539f},
-std::array<float,2>{0.295980424f, 0.573112607f},
-std::array<float,2>{0.128960863f, 0.27069357f},
-std::array<float,2>{0.915079951f, 0.8030985f},
-std::array<float,2>{0.642238259f, 0.357341498f},
-std::array<float,2>{0.401681036f, 0.832161248f},
-std::array<float,2>{0.0710996613f, 0.0710473806f},
-std::array<float,2>{0.756695509f, 0.554469466f},
-std::array<float,2>{0.993849456f, 0.178541645f},
-std::array<float,2>{0.210133001f, 0.647310913f},
-std::array<float,2>{0.369476527f, 0.457066685f},
-std::array<float,2>{0.556050181f, 0.951426625f},
-std::array<float,2>{0.894368827f, 0.308890402f},
-std::array<float,2>{0.166304082f, 0.751420677f},
-std::array<float,2>{0.259947091f, 0.0323841199f},
-std::array<float,2>{0.573150873f, 0.608371556f},
-std::array<float,2>{0.723087192f, 0.245015025f},
-std::array<float,2>{0.45908919f, 0.726951957f},
-std::array<float,2>{0.0453513786f, 0.402884036f},
-std::array<float,2>{0.856613576f, 0.92346698f},
-std::array<float,2>{0.509263515f, 0.488736033f},
-std::array<float,2>{0.324619472f, 0.981786489f},
-std::array<float,2>{0.228910133f, 0.154362023f},
-std::array<float,2>{0.959705472f, 0.681487918f},
-std::array<float,2>{0.786936879f, 0.117627017f},
-std::array<float,2>{0.104482867f, 0.521202266f},
-std::array<float,2>{0.423049033f, 0.318591386f},
-std::array<float,2>{0.658733308f, 0.853222251f},
-std::array<float,2>{0.765821755f, 0.339603186f},
-std::array<float,2>{0.092250824f, 0.867851496f},
-std::array<float,2>{0.378049493f, 0.105239928f},
-std::array<float,2>{0.629294276f, 0.507169545f},
-std::array<float,2>{0.531860411f, 0.127088517f},
-std::array<float,2>{0.35319531f, 0.661381304f},
-std::array<float,2>{0.188839525f, 0.468767524f},
-std::array<float,2>{0.972100317f, 0.999703288f},
-std::array<float,2>{0.713302612f, 0.388832748f},
-std::array<float,2>{0.483857691f, 0.907951534f},
-std::array<float,2>{0.0138314422f, 0.220711827f},
-std::array<float,2>{0.814050674f, 0.748769641f},
-std::array<float,2>{0.934818029f, 0.0601599365f},
-std::array<float,2>{0.141447142f, 0.6177845f},
-std::array<float,2>{0.309302539f, 0.29257533f},
-std::array<float,2>{0.604559422f, 0.780525804f},
-std::array<float,2>{0.952221692f, 0.442845404f},
-std::array<float,2>{0.237619326f, 0.955554008f},
-std::array<float,2>{0.329599947f, 0.161805809f},
-std::array<float,2>{0.51823771f, 0.625196278f},
-std::array<float,2>{0.678605199f, 0.0864684135f},
-std::array<float,2>{0.421793997f, 0.535870135f},
-std::array<float,2>{0.113265455f, 0.365027547f},
-std::array<float,2>{0.809185386f, 0.817127168f},
-std::array<float,2>{0.580900967f, 0.264911145f},
-std::array<float,2>{0.270278305f, 0.784229219f},
-std::array<float,2>{0.184190661f, 0.0230660681f},
-std::array<float,2>{0.883984327f, 0.585529864f},
-std::array<float,2>{0.863774717f, 0.205428079f},
-std::array<float,2>{0.0564869419f, 0.698386431f},
-std::array<float,2>{0.447499722f, 0.418162048f},
-std::array<float,2>{0.736002564f, 0.905118465f},
-std::array<float,2>{0.874022543f, 0.453296453f},
-std::array<float,2>{0.0473125465f, 0.946274817f},
-std::array<float,2>{0.442801774f, 0.173606172f},
-std::array<float,2>{0.742970288f, 0.641225934f},
-std::array<float,2>{0.591365755f, 0.0769210011f},
-std::array<float,2>{0.275130868f, 0.548468471f},
-std::array<float,2>{0.173516452f, 0.353137314f},
-std::array<float,2>{0.876980186f, 0.828745067f},
-std::array<float,2>{0.682901323f, 0.266945601f},
-std::array<float,2>{0.411377519f, 0.800594866f},
-std::array<float,2>{0.12227606f, 0.0152329868f},
-std::array<float,2>{0.802602828f, 0.574919343f},
-std::array<float,2>{0.938331187f, 0.194455922f},
-std::array<float,2>{0.246335521f, 0.708769143f},
-std::array<float,2>{0.342483342f, 0.426536173f},
-std::array<float,2>{0.526825309f, 0.884095252f},
-std::array<float,2>{0.92738688f, 0.315835327f},
-std::array<float,2>{0.15493384f, 0.8569085f},
-std::array<float,2>{0.303238511f, 0.122634575f},
-std::array<float,2>{0.599550903f, 0.51751864f},
-std::array<float,2>{0.708968997f, 0.151497558f},
-std::array<float,2>{0.47631073f, 0.685272455f},
-std::array<float,2>{0.00555019407f, 0.487115443f},
-std::array<float,2>{0.821263731f, 0.976979136f},
-std::array<float,2>{0.542518377f, 0.401109576f},
-std::array<float,2>{0.348251194f, 0.926037312f},
-std::array<float,2>{0.202425137f, 0.248904988f},
-std::array<float,2>{0.984271049f, 0.734286964f},
-std::array<float,2>{0.775900841f, 0.0372409038f},
-std::array<float,2>{0.0850541219f, 0.603485823f},
-std::array<float,2>{0.389263541f, 0.307348549f},
-std::array<float,2>{0.636421204f, 0.755442858f},
-std::array<float,2>{0.794236541f, 0.29335168f},
-std::array<float,2>{0.0957423672f, 0.776900351f},
-std::array<float,2>{0.435950845f, 0.0547558814f},
-std::array<float,2>{0.666250885f, 0.624771655f},
-std::array<float,2>{0.502768219f, 0.225994587f},
-std::array<float,2>{0.3151007f, 0.745197713f},
-std::array<float,2>{0.2187583f, 0.385900885f},
-std::array<float,2>{0.962509573f, 0.912035167f},
-std::array<float,2>{0.72845906f, 0.476480514f},
-std::array<float,2>{0.462270856f, 0.994327128f},
-std::array<float,2>{0.03174752f, 0.129496008f},
-std::array<float,2>{0.844581485f, 0.656700373f},
-std::array<float,2>{0.904895663f, 0.107216775f},
-std::array<float,2>{0.156456724f, 0.500080884f},
-std::array<float,2>{0.25000909f, 0.342568815f},
-std::array<float,2>{0.568053842f, 0.871254086f},
-std::array<float,2>{0.989097297f, 0.415586978f},
-std::array<float,2>{0.215849712f, 0.900884867f},
-std::array<float,2>{0.363839895f, 0.209156975f},
-std::array<float,2>{0.552524805f, 0.702327549f},
-std::array<float,2>{0.651697278f, 0.0166850314f},
-std::array<float,2>{0.398094982f, 0.578785121f},
-std::array<float,2>{0.0698504075f, 0.258257002f},
-std::array<float,2>{0.759384573f, 0.787184834f},
-std::array<float,2>{0.610411227f, 0.360285521f},
-std::array<float,2>{0.282557815f, 0.81337595f},
-std::array<float,2>{0.136572242f, 0.0932420492f},
-std::array<float,2>{0.907305956f, 0.532849848f},
-std::array<float,2>{0.828485191f, 0.156590924f},
-std::array<float,2>{0.0250588283f, 0.631304145f},
-std::array<float,2>{0.494017601f, 0.438585043f},
-std::array<float,2>{0.694434583f, 0.959762931f},
-std::array<float,2>{0.751741886f, 0.377840132f},
-std::array<float,2>{0.0754938722f, 0.921001196f},
-std::array<float,2>{0.404452294f, 0.228162274f},
-std::array<float,2>{0.645619512f, 0.737646759f},
-std::array<float,2>{0.561983287f, 0.0489317775f},
-std::array<float,2>{0.372445464f, 0.616690218f},
-std::array<float,2>{0.203617856f, 0.281885356f},
-std::array<float,2>{0.997044027f, 0.769740939f},
-std::array<float,2>{0.702971458f, 0.335533172f},
-std::array<float,2>{0.492112517f, 0.862002015f},
-std::array<float,2>{0.0170067102f, 0.0953128785f},
-std::array<float,2>{0.843467534f, 0.513269603f},
-std::array<float,2>{0.921576917f, 0.133774817f},
-std::array<float,2>{0.128135607f, 0.670237958f},
-std::array<float,2>{0.290651679f, 0.483806074f},
-std::array<float,2>{0.621961713f, 0.986826718f},
-std::array<float,2>{0.9545452f, 0.250993937f},
-std::array<float,2>{0.233947471f, 0.795214415f},
-std::array<float,2>{0.323402256f, 0.027251279f},
-std::array<float,2>{0.512057066f, 0.592925668f},
-std::array<float,2>{0.660668492f, 0.214424029f},
-std::array<float,2>{0.427333891f, 0.690672159f},
-std::array<float,2>{0.107770503f, 0.406799644f},
-std::array<float,2>{0.783385813f, 0.898290813f},
-std::array<float,2>{0.575912833f, 0.448666543f},
-std::array<float,2>{0.263416648f, 0.964524686f},
-std::array<float,2>{0.168197528f, 0.171540394f},
-std::array<float,2>{0.895179451f, 0.634965241f},
-std::array<float,2>{0.852095485f, 0.0833145902f},
-std::array<float,2>{0.04221889f, 0.5457322f},
-std::array<float,2>{0.455622226f, 0.370154798f},
-std::array<float,2>{0.720311165f, 0.826270819f},
-std::array<float,2>{0.81792599f, 0.348847687f},
-std::array<float,2>{0.00991332065f, 0.842187405f},
-std::array<float,2>{0.477473915f, 0.0631551817f},
-std::array<float,2>{0.716691315f, 0.559222758f},
-std::array<float,2>{0.607740641f, 0.186638713f},
-std::array<float,2>{0.30841288f, 0.650009274f},
-std::array<float,2>{0.146002561f, 0.468226314f},
-std::array<float,2>{0.931105494f, 0.941350222f},
-std::array<float,2>{0.627956569f, 0.434200376f},
-std::array<float,2>{0.38189584f, 0.880339563f},
-std::array<float,2>{0.0871602595f, 0.20029752f},
-std::array<float,2>{0.772016346f, 0.712139308f},
-std::array<float,2>{0.972806215f, 0.00620138831f},
-std::array<float,2>{0.191523165f, 0.563652396f},
-std::array<float,2>{0.356210679f, 0.274323016f},
-std::array<float,2>{0.537155211f, 0.80521214f},
-std::array<float,2>{0.887997091f, 0.4955706f},
-std::array<float,2>{0.180538833f, 0.975406349f},
-std::array<float,2>{0.265943468f, 0.143997312f},
-std::array<float,2>{0.582731903f, 0.677087903f},
-std::array<float,2>{0.738694727f, 0.10991177f},
-std::array<float,2>{0.450360298f, 0.523991287f},
-std::array<float,2>{0.0610935129f, 0.32295236f},
-std::array<float,2>{0.860736489f, 0.849278092f},
-std::array<float,2>{0.522890329f, 0.300794303f},
-std::array<float,2>{0.335525453f, 0.762008607f},
-std::array<float,2>{0.241627648f, 0.043245513f},
-std::array<float,2>{0.94791615f, 0.599547148f},
-std::array<float,2>{0.807335198f, 0.235440135f},
-std::array<float,2>{0.117048413f, 0.723726332f},
-std::array<float,2>{0.415242165f, 0.392150432f},
-std::array<float,2>{0.675664723f, 0.934171319f},
-std::array<float,2>{0.77736336f, 0.451685637f},
-std::array<float,2>{0.0804328322f, 0.965242743f},
-std::array<float,2>{0.386025667f, 0.166409642f},
-std::array<float,2>{0.639565408f, 0.640216887f},
-std::array<float,2>{0.545438588f, 0.0815342963f},
-std::array<float,2>{0.344660312f, 0.540280342f},
-std::array<float,2>{0.197264224f, 0.373873621f},
-std::array<float,2>{0.980228484f, 0.822474778f},
-std::array<float,2>{0.706556976f, 0.256912649f},
-std::array<float,2>{0.469944865f, 0.789373636f},
-std::array<float,2>{0.00328330393f, 0.0281816702f},
-std::array<float,2>{0.827497721f, 0.585974813f},
-std::array<float,2>{0.92501241f, 0.217395827f},
-std::array<float,2>{0.150073126f, 0.692540526f},
-std::array<float,2>{0.296950758f, 0.413876772f},
-std::array<float,2>{0.596535563f, 0.892462432f},
-std::array<float,2>{0.94519341f, 0.329054713f},
-std::array<float,2>{0.244804725f, 0.866011143f},
-std::array<float,2>{0.339815795f, 0.0992289484f},
-std::array<float,2>{0.527763963f, 0.511092424f},
-std::array<float,2>{0.685463309f, 0.139682546f},
-std::array<float,2>{0.406659991f, 0.6676507f},
-std::array<float,2>{0.120217092f, 0.478538811f},
-std::array<float,2>{0.798932314f, 0.990178466f},
-std::array<float,2>{0.588592887f, 0.382166326f},
-std::array<float,2>{0.277553648f, 0.916811645f},
-std::array<float,2>{0.179450706f, 0.231649935f},
-std::array<float,2>{0.879491985f, 0.738858223f},
-std::array<float,2>{0.868102431f, 0.0539467409f},
-std::array<float,2>{0.0520743504f, 0.610486448f},
-std::array<float,2>{0.43834126f, 0.288494259f},
-std::array<float,2>{0.748708367f, 0.767480612f},
-std::array<float,2>{0.832768321f, 0.299690783f},
-std::array<float,2>{0.0273999963f, 0.759298325f},
-std::array<float,2>{0.497177094f, 0.0422914326f},
-std::array<float,2>{0.688339651f, 0.595304191f},
-std::array<float,2>{0.616853952f, 0.240969837f},
-std::array<float,2>{0.287190318f, 0.721718311f},
-std::array<float,2>{0.138032094f, 0.396754414f},
-std::array<float,2>{0.912565947f, 0.930010498f},
-std::array<float,2>{0.655994952f, 0.499676764f},
-std::array<float,2>{0.39127484f, 0.97058326f},
-std::array<float,2>{0.062855266f, 0.145618066f},
-std::array<float,2>{0.762710035f, 0.671876013f},
-std::array<float,2>{0.984535694f, 0.114914611f},
-std::array<float,2>{0.213926643f, 0.527816713f},
-std::array<float,2>{0.362843394f, 0.327638328f},
-std::array<float,2>{0.548869252f, 0.844984889f},
-std::array<float,2>{0.899068892f, 0.43316555f},
-std::array<float,2>{0.163934439f, 0.876320064f},
-std::array<float,2>{0.256634086f, 0.196514651f},
-std::array<float,2>{0.565225899f, 0.716770768f},
-std::array<float,2>{0.733758807f, 0.00254903827f},
-std::array<float,2>{0.467952192f, 0.569763601f},
-std::array<float,2>{0.0353881344f, 0.277369082f},
-std::array<float,2>{0.850853562f, 0.808853805f},
-std::array<float,2>{0.507753372f, 0.345001668f},
-std::array<float,2>{0.317822069f, 0.837830245f},
-std::array<float,2>{0.226092666f, 0.0697800964f},
-std::array<float,2>{0.966271162f, 0.556363642f},
-std::array<float,2>{0.792410135f, 0.183480501f},
-std::array<float,2>{0.0980950743f, 0.654798627f},
-std::array<float,2>{0.429780096f, 0.463180423f},
-std::array<float,2>{0.670817554f, 0.941587508f},
-std::array<float,2>{0.858822823f, 0.405048966f},
-std::array<float,2>{0.0430022813f, 0.924799442f},
-std::array<float,2>{0.457431376f, 0.243085623f},
-std::array<float,2>{0.724867404f, 0.730430901f},
-std::array<float,2>{0.57155931f, 0.0349275693f},
-std::array<float,2>{0.258849889f, 0.607191443f},
-std::array<float,2>{0.164230868f, 0.311155736f},
-std::array<float,2>{0.892150044f, 0.753478885f},
-std::array<float,2>{0.657944024f, 0.317430466f},
-std::array<float,2>{0.425177813f, 0.854017496f},
-std::array<float,2>{0.101667948f, 0.121000148f},
-std::array<float,2>{0.787490368f, 0.522991896f},
-std::array<float,2>{0.958843768f, 0.152822241f},
-std::array<float,2>{0.227513969f, 0.68315196f},
-std::array<float,2>{0.326557547f, 0.491052955f},
-std::array<float,2>{0.510450721f, 0.983379066f},
-std::array<float,2>{0.916767061f, 0.272513419f},
-std::array<float,2>{0.13125594f, 0.80190748f},
-std::array<float,2>{0.293001205f, 0.00915722828f},
-std::array<float,2>{0.618807197f, 0.571918786f},
-std::array<float,2>{0.698790789f, 0.187766567f},
-std::array<float,2>{0.48598963f, 0.706975758f},
-std::array<float,2>{0.0232618023f, 0.424273789f},
-std::array<float,2>{0.839520454f, 0.889891207f},
-std::array<float,2>{0.558414161f, 0.460880369f},
-std::array<float,2>{0.367476821f, 0.949388444f},
-std::array<float,2>{0.207616523f, 0.176526859f},
-std::array<float,2>{0.994939327f, 0.644835591f},
-std::array<float,2>{0.754522681f, 0.0733040422f},
-std::array<float,2>{0.0728257746f, 0.551201701f},
-std::array<float,2>{0.399753928f, 0.358245701f},
-std::array<float,2>{0.644036114f, 0.8356179f},
-std::array<float,2>{0.811910391f, 0.365650386f},
-std::array<float,2>{0.111232221f, 0.820219278f},
-std::array<float,2>{0.418496519f, 0.0879866853f},
-std::array<float,2>{0.676109016f, 0.538310766f},
-std::array<float,2>{0.516564906f, 0.162842333f},
-std::array<float,2>{0.330208123f, 0.628557742f},
-std::array<float,2>{0.235392019f, 0.443505317f},
-std::array<float,2>{0.950516462f, 0.955062151f},
-std::array<float,2>{0.736389995f, 0.421390802f},
-std::array<float,2>{0.445847392f, 0.902578473f},
-std::array<float,2>{0.0575196408f, 0.20373255f},
-std::array<float,2>{0.865367353f, 0.695623815f},
-std::array<float,2>{0.885953188f, 0.0210307445f},
-std::array<float,2>{0.187199652f, 0.582598448f},
-std::array<float,2>{0.271949321f, 0.262514919f},
-std::array<float,2>{0.578377962f, 0.782828391f},
-std::array<float,2>{0.969257951f, 0.471477896f},
-std::array<float,2>{0.190533385f, 0.996920824f},
-std::array<float,2>{0.354741275f, 0.125946671f},
-std::array<float,2>{0.533416927f, 0.662159979f},
-std::array<float,2>{0.632229328f, 0.10203699f},
-std::array<float,2>{0.376589149f, 0.504349768f},
-std::array<float,2>{0.0917949677f, 0.336129397f},
-std::array<float,2>{0.768262625f, 0.869791508f},
-std::array<float,2>{0.603094399f, 0.290791512f},
-std::array<float,2>{0.312428653f, 0.7781201f},
-std::array<float,2>{0.1442011f, 0.0605561659f},
-std::array<float,2>{0.937459111f, 0.619631171f},
-std::array<float,2>{0.814997971f, 0.219099313f},
-std::array<float,2>{0.0121693257f, 0.746779978f},
-std::array<float,2>{0.481110722f, 0.387138665f},
-std::array<float,2>{0.712377191f, 0.909639001f},
-std::array<float,2>{0.82418704f, 0.485159099f},
-std::array<float,2>{0.00733856484f, 0.979795575f},
-std::array<float,2>{0.474110276f, 0.150034443f},
-std::array<float,2>{0.710842013f, 0.686685741f},
-std::array<float,2>{0.599717319f, 0.124175116f},
-std::array<float,2>{0.301920831f, 0.518699944f},
-std::array<float,2>{0.153044716f, 0.31338641f},
-std::array<float,2>{0.928729355f, 0.858825088f},
-std::array<float,2>{0.634102345f, 0.305367321f},
-std::array<float,2>{0.386838377f, 0.756211758f},
-std::array<float,2>{0.0838276073f, 0.0371012725f},
-std::array<float,2>{0.773983717f, 0.604611933f},
-std::array<float,2>{0.981241763f, 0.247985587f},
-std::array<float,2>{0.200861976f, 0.731233239f},
-std::array<float,2>{0.350209981f, 0.399349213f},
-std::array<float,2>{0.540177822f, 0.927834094f},
-std::array<float,2>{0.876274407f, 0.354648799f},
-std::array<float,2>{0.174474865f, 0.830617666f},
-std::array<float,2>{0.275485367f, 0.0761679187f},
-std::array<float,2>{0.591800153f, 0.549178481f},
-std::array<float,2>{0.74509573f, 0.174493283f},
-std::array<float,2>{0.445113391f, 0.643776f},
-std::array<float,2>{0.0494279973f, 0.456317246f},
-std::array<float,2>{0.872976601f, 0.948202491f},
-std::array<float,2>{0.525004387f, 0.429566413f},
-std::array<float,2>{0.340981752f, 0.885348797f},
-std::array<float,2>{0.24839443f, 0.191811204f},
-std::array<float,2>{0.93961519f, 0.709883213f},
-std::array<float,2>{0.803049445f, 0.0133475959f},
-std::array<float,2>{0.124752216f, 0.577767015f},
-std::array<float,2>{0.413935512f, 0.267897844f},
-std::array<float,2>{0.680188298f, 0.797025263f},
-std::array<float,2>{0.760500669f, 0.260826707f},
-std::array<float,2>{0.0680355504f, 0.785190105f},
-std::array<float,2>{0.394641638f, 0.0177767538f},
-std::array<float,2>{0.64964503f, 0.581692278f},
-std::array<float,2>{0.553388953f, 0.208785832f},
-std::array<float,2>{0.366136372f, 0.700251818f},
-std::array<float,2>{0.217780262f, 0.41756627f},
-std::array<float,2>{0.991881132f, 0.899227142f},
-std::array<float,2>{0.693126321f, 0.441362798f},
-std::array<float,2>{0.496077895f, 0.958296537f},
-std::array<float,2>{0.0263304878f, 0.159464285f},
-std::array<float,2>{0.831545889f, 0.630782843f},
-std::array<float,2>{0.909361184f, 0.0900861472f},
-std::array<float,2>{0.133505717f, 0.535032094f},
-std::array<float,2>{0.28373754f, 0.362662256f},
-std::array<float,2>{0.611866176f, 0.816283643f},
-std::array<float,2>{0.963600218f, 0.383355051f},
-std::array<float,2>{0.221832365f, 0.913419664f},
-std::array<float,2>{0.313441187f, 0.222698718f},
-std::array<float,2>{0.501700401f, 0.743444264f},
-std::array<float,2>{0.66458869f, 0.0584604926f},
-std::array<float,2>{0.434654474f, 0.621413589f},
-std::array<float,2>{0.0949162021f, 0.294934481f},
-std::array<float,2>{0.795131922f, 0.773743749f},
-std::array<float,2>{0.56990397f, 0.341186523f},
-std::array<float,2>{0.252784342f, 0.873059928f},
-std::array<float,2>{0.158686638f, 0.107731208f},
-std::array<float,2>{0.903458476f, 0.503754735f},
-std::array<float,2>{0.846355796f, 0.130957976f},
-std::array<float,2>{0.0342154801f, 0.659039795f},
-std::array<float,2>{0.463195056f, 0.472687662f},
-std::array<float,2>{0.729363441f, 0.992489576f},
-std::array<float,2>{0.781946719f, 0.409535706f},
-std::array<float,2>{0.107023016f, 0.89521569f},
-std::array<float,2>{0.429524511f, 0.212174788f},
-std::array<float,2>{0.662556469f, 0.688475311f},
-std::array<float,2>{0.513883233f, 0.0251550544f},
-std::array<float,2>{0.321826637f, 0.590277135f},
-std::array<float,2>{0.230533853f, 0.25373438f},
-std::array<float,2>{0.955643475f, 0.79402405f},
-std::array<float,2>{0.721680343f, 0.367190987f},
-std::array<float,2>{0.454440117f, 0.825962484f},
-std::array<float,2>{0.0402643792f, 0.0848556906f},
-std::array<float,2>{0.853812456f, 0.543164015f},
-std::array<float,2>{0.898248434f, 0.16975151f},
-std::array<float,2>{0.171710789f, 0.634277225f},
-std::array<float,2>{0.265052468f, 0.445333332f},
-std::array<float,2>{0.577877343f, 0.962453067f},
-std::array<float,2>{0.9993487f, 0.284528136f},
-std::array<float,2>{0.206610695f, 0.77280432f},
-std::array<float,2>{0.373220772f, 0.0470846258f},
-std::array<float,2>{0.558829725f, 0.614156187f},
-std::array<float,2>{0.647205174f, 0.229635581f},
-std::array<float,2>{0.402782649f, 0.735795319f},
-std::array<float,2>{0.0764472559f, 0.375674129f},
-std::array<float,2>{0.753354609f, 0.918985724f},
-std::array<float,2>{0.623538792f, 0.481386185f},
-std::array<float,2>{0.291709483f, 0.984511435f},
-std::array<float,2>{0.126600772f, 0.136189029f},
-std::array<float,2>{0.919635057f, 0.669236422f},
-std::array<float,2>{0.840967476f, 0.0966274738f},
-std::array<float,2>{0.0179598946f, 0.515068889f},
-std::array<float,2>{0.490058273f, 0.332454085f},
-std::array<float,2>{0.700339496f, 0.860685587f},
-std::array<float,2>{0.863203228f, 0.321203679f},
-std::array<float,2>{0.058772102f, 0.850999713f},
-std::array<float,2>{0.451792777f, 0.111552164f},
-std::array<float,2>{0.741357625f, 0.525571823f},
-std::array<float,2>{0.585789919f, 0.141006276f},
-std::array<float,2>{0.268434644f, 0.678587139f},
-std::array<float,2>{0.182021707f, 0.49233073f},
-std::array<float,2>{0.89061892f, 0.973951817f},
-std::array<float,2>{0.672392428f, 0.393267542f},
-std::array<float,2>{0.416777879f, 0.936396539f},
-std::array<float,2>{0.114805914f, 0.23818548f},
-std::array<float,2>{0.806481779f, 0.725477695f},
-std::array<float,2>{0.945867002f, 0.0456057973f},
-std::array<float,2>{0.238882989f, 0.601225138f},
-std::array<float,2>{0.332942545f, 0.304446667f},
-std::array<float,2>{0.519916415f, 0.765569568f},
-std::array<float,2>{0.93355304f, 0.466245979f},
-std::array<float,2>{0.148392528f, 0.938861549f},
-std::array<float,2>{0.305136174f, 0.185185358f},
-std::array<float,2>{0.605953336f, 0.651157856f},
-std::array<float,2>{0.716948807f, 0.064481616f},
-std::array<float,2>{0.479619354f, 0.561830342f},
-std::array<float,2>{0.00802997965f, 0.350120902f},
-std::array<float,2>{0.819809616f, 0.84087497f},
-std::array<float,2>{0.535336375f, 0.276560694f},
-std::array<float,2>{0.358976364f, 0.807544172f},
-std::array<float,2>{0.194075733f, 0.00549321203f},
-std::array<float,2>{0.976248264f, 0.566371262f},
-std::array<float,2>{0.770698667f, 0.202915892f},
-std::array<float,2>{0.0891146809f, 0.714162052f},
-std::array<float,2>{0.379665285f, 0.436166972f},
-std::array<float,2>{0.625491798f, 0.882224679f}}
\ No newline at end of file
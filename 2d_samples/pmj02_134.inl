@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.16292955f, 0.122090593f},
-std::array<float,2>{0.574043393f, 0.963555336f},
-std::array<float,2>{0.284720927f, 0.541239262f},
-std::array<float,2>{0.907083392f, 0.473140776f},
-std::array<float,2>{0.445736825f, 0.297673196f},
-std::array<float,2>{0.780952275f, 0.651640475f},
-std::array<float,2>{0.0680739135f, 0.830546916f},
-std::array<float,2>{0.648697674f, 0.146596685f},
-std::array<float,2>{0.366136491f, 0.243133977f},
-std::array<float,2>{0.995833576f, 0.806215644f},
-std::array<float,2>{0.232437119f, 0.695424497f},
-std::array<float,2>{0.559838772f, 0.361699939f},
-std::array<float,2>{0.0464666896f, 0.421146482f},
-std::array<float,2>{0.733350575f, 0.589716375f},
-std::array<float,2>{0.383315265f, 0.935349166f},
-std::array<float,2>{0.827798665f, 0.034370061f},
-std::array<float,2>{0.122061118f, 0.157289714f},
-std::array<float,2>{0.683153033f, 0.866526008f},
-std::array<float,2>{0.472704351f, 0.666091084f},
-std::array<float,2>{0.783132136f, 0.272250175f},
-std::array<float,2>{0.261589378f, 0.442875355f},
-std::array<float,2>{0.89258796f, 0.500604093f},
-std::array<float,2>{0.143006325f, 0.985614121f},
-std::array<float,2>{0.611497879f, 0.0683641136f},
-std::array<float,2>{0.417999685f, 0.0149534624f},
-std::array<float,2>{0.845005095f, 0.902939916f},
-std::array<float,2>{0.0259266458f, 0.596231997f},
-std::array<float,2>{0.703414977f, 0.375262856f},
-std::array<float,2>{0.218326882f, 0.340709537f},
-std::array<float,2>{0.502422154f, 0.720925987f},
-std::array<float,2>{0.342314988f, 0.750179529f},
-std::array<float,2>{0.959115267f, 0.201211095f},
-std::array<float,2>{0.00627312623f, 0.0520402789f},
-std::array<float,2>{0.68815726f, 0.917948842f},
-std::array<float,2>{0.434979469f, 0.564324319f},
-std::array<float,2>{0.872017562f, 0.433142215f},
-std::array<float,2>{0.323398709f, 0.355552495f},
-std::array<float,2>{0.95266974f, 0.715082824f},
-std::array<float,2>{0.193794981f, 0.790366054f},
-std::array<float,2>{0.518173814f, 0.224439159f},
-std::array<float,2>{0.489582449f, 0.132541209f},
-std::array<float,2>{0.796916604f, 0.825724602f},
-std::array<float,2>{0.0964411646f, 0.628772318f},
-std::array<float,2>{0.665085316f, 0.282798171f},
-std::array<float,2>{0.132460967f, 0.491647214f},
-std::array<float,2>{0.597609997f, 0.549269021f},
-std::array<float,2>{0.266067207f, 0.950749815f},
-std::array<float,2>{0.876052141f, 0.0970226973f},
-std::array<float,2>{0.242299214f, 0.208783463f},
-std::array<float,2>{0.534976304f, 0.777910829f},
-std::array<float,2>{0.345555782f, 0.747692287f},
-std::array<float,2>{0.969327211f, 0.313598871f},
-std::array<float,2>{0.402991652f, 0.394658506f},
-std::array<float,2>{0.842329264f, 0.619789064f},
-std::array<float,2>{0.0505644009f, 0.88489449f},
-std::array<float,2>{0.739585638f, 0.0215160977f},
-std::array<float,2>{0.302883357f, 0.0886548162f},
-std::array<float,2>{0.932888031f, 0.979831815f},
-std::array<float,2>{0.176951349f, 0.527656198f},
-std::array<float,2>{0.585040092f, 0.462936729f},
-std::array<float,2>{0.0886512846f, 0.253533721f},
-std::array<float,2>{0.629276276f, 0.680080473f},
-std::array<float,2>{0.466633976f, 0.858372033f},
-std::array<float,2>{0.760729134f, 0.172514558f},
-std::array<float,2>{0.20063366f, 0.0285014044f},
-std::array<float,2>{0.525426447f, 0.878733039f},
-std::array<float,2>{0.313948363f, 0.614623904f},
-std::array<float,2>{0.943334341f, 0.404421657f},
-std::array<float,2>{0.424487054f, 0.321414411f},
-std::array<float,2>{0.861124039f, 0.735125959f},
-std::array<float,2>{0.0107525093f, 0.770227015f},
-std::array<float,2>{0.697671294f, 0.212207839f},
-std::array<float,2>{0.280313075f, 0.183796123f},
-std::array<float,2>{0.888548076f, 0.848012388f},
-std::array<float,2>{0.13317962f, 0.672785461f},
-std::array<float,2>{0.606303155f, 0.261698037f},
-std::array<float,2>{0.108912401f, 0.456047207f},
-std::array<float,2>{0.661190987f, 0.518911183f},
-std::array<float,2>{0.49696517f, 0.974246442f},
-std::array<float,2>{0.810371399f, 0.0782769769f},
-std::array<float,2>{0.0555914603f, 0.233752534f},
-std::array<float,2>{0.749059796f, 0.788472772f},
-std::array<float,2>{0.391664356f, 0.704460025f},
-std::array<float,2>{0.829757512f, 0.349938333f},
-std::array<float,2>{0.355629236f, 0.428307146f},
-std::array<float,2>{0.982740283f, 0.57665211f},
-std::array<float,2>{0.235898778f, 0.91254133f},
-std::array<float,2>{0.54125762f, 0.0588882081f},
-std::array<float,2>{0.457505763f, 0.107585438f},
-std::array<float,2>{0.752054095f, 0.937936366f},
-std::array<float,2>{0.0841817558f, 0.557531178f},
-std::array<float,2>{0.635704398f, 0.499085724f},
-std::array<float,2>{0.179745689f, 0.29108569f},
-std::array<float,2>{0.586342752f, 0.633926272f},
-std::array<float,2>{0.308496952f, 0.817783177f},
-std::array<float,2>{0.924434006f, 0.139647767f},
-std::array<float,2>{0.0714902282f, 0.0721306875f},
-std::array<float,2>{0.648343086f, 0.997846544f},
-std::array<float,2>{0.439253747f, 0.509152651f},
-std::array<float,2>{0.772859216f, 0.450752765f},
-std::array<float,2>{0.296520621f, 0.273454934f},
-std::array<float,2>{0.920902312f, 0.662655711f},
-std::array<float,2>{0.164223716f, 0.872612715f},
-std::array<float,2>{0.569685638f, 0.168308541f},
-std::array<float,2>{0.379133612f, 0.1921141f},
-std::array<float,2>{0.818583131f, 0.763106465f},
-std::array<float,2>{0.0358139984f, 0.731167316f},
-std::array<float,2>{0.721966922f, 0.328730285f},
-std::array<float,2>{0.220827743f, 0.385958582f},
-std::array<float,2>{0.549313605f, 0.602047682f},
-std::array<float,2>{0.370344877f, 0.897175252f},
-std::array<float,2>{0.985193849f, 0.00300374185f},
-std::array<float,2>{0.15054895f, 0.15120092f},
-std::array<float,2>{0.623111129f, 0.839630544f},
-std::array<float,2>{0.255909771f, 0.648092687f},
-std::array<float,2>{0.902101815f, 0.311256826f},
-std::array<float,2>{0.479571491f, 0.482969671f},
-std::array<float,2>{0.792691886f, 0.535436511f},
-std::array<float,2>{0.115214638f, 0.957676232f},
-std::array<float,2>{0.676727712f, 0.111388259f},
-std::array<float,2>{0.335070252f, 0.04474831f},
-std::array<float,2>{0.964992046f, 0.926468074f},
-std::array<float,2>{0.208108872f, 0.582092762f},
-std::array<float,2>{0.510675907f, 0.411150366f},
-std::array<float,2>{0.0185336135f, 0.367449999f},
-std::array<float,2>{0.714644253f, 0.692146897f},
-std::array<float,2>{0.409374237f, 0.798470914f},
-std::array<float,2>{0.857167244f, 0.236097828f},
-std::array<float,2>{0.140324861f, 0.0354698524f},
-std::array<float,2>{0.601967335f, 0.930189371f},
-std::array<float,2>{0.27372098f, 0.592939436f},
-std::array<float,2>{0.88290143f, 0.415337861f},
-std::array<float,2>{0.493378818f, 0.364649028f},
-std::array<float,2>{0.806225538f, 0.700313866f},
-std::array<float,2>{0.103301525f, 0.810034215f},
-std::array<float,2>{0.656827867f, 0.246175662f},
-std::array<float,2>{0.316970527f, 0.141938001f},
-std::array<float,2>{0.939632118f, 0.832589328f},
-std::array<float,2>{0.19670558f, 0.652904093f},
-std::array<float,2>{0.530309021f, 0.301629245f},
-std::array<float,2>{0.0147476196f, 0.47035858f},
-std::array<float,2>{0.70288378f, 0.545431852f},
-std::array<float,2>{0.429593056f, 0.966407597f},
-std::array<float,2>{0.866962552f, 0.119452834f},
-std::array<float,2>{0.0810920075f, 0.196361989f},
-std::array<float,2>{0.639708996f, 0.754048109f},
-std::array<float,2>{0.4537386f, 0.724458992f},
-std::array<float,2>{0.756391823f, 0.33773154f},
-std::array<float,2>{0.310732633f, 0.381129503f},
-std::array<float,2>{0.926542401f, 0.599152565f},
-std::array<float,2>{0.186656952f, 0.899442732f},
-std::array<float,2>{0.592395246f, 0.00909595843f},
-std::array<float,2>{0.398349553f, 0.0639292449f},
-std::array<float,2>{0.832395136f, 0.988349617f},
-std::array<float,2>{0.0593417548f, 0.505951703f},
-std::array<float,2>{0.745601237f, 0.44089511f},
-std::array<float,2>{0.24206613f, 0.266725093f},
-std::array<float,2>{0.544321239f, 0.668070316f},
-std::array<float,2>{0.353856325f, 0.8619923f},
-std::array<float,2>{0.977584898f, 0.16358602f},
-std::array<float,2>{0.0350701697f, 0.101089783f},
-std::array<float,2>{0.723758698f, 0.948480546f},
-std::array<float,2>{0.375534654f, 0.552802444f},
-std::array<float,2>{0.814903915f, 0.484505117f},
-std::array<float,2>{0.37490809f, 0.287310123f},
-std::array<float,2>{0.989695847f, 0.630437553f},
-std::array<float,2>{0.223091945f, 0.823803544f},
-std::array<float,2>{0.551332355f, 0.128030017f},
-std::array<float,2>{0.442328572f, 0.220977619f},
-std::array<float,2>{0.767660797f, 0.795599163f},
-std::array<float,2>{0.0778341815f, 0.711454213f},
-std::array<float,2>{0.64085561f, 0.35419333f},
-std::array<float,2>{0.170363754f, 0.434768558f},
-std::array<float,2>{0.565796196f, 0.567087948f},
-std::array<float,2>{0.29085201f, 0.918083429f},
-std::array<float,2>{0.916980982f, 0.0472844318f},
-std::array<float,2>{0.203245208f, 0.178910211f},
-std::array<float,2>{0.511854291f, 0.8541466f},
-std::array<float,2>{0.330069453f, 0.686092377f},
-std::array<float,2>{0.96337831f, 0.257522702f},
-std::array<float,2>{0.413701922f, 0.465540379f},
-std::array<float,2>{0.854114532f, 0.525910914f},
-std::array<float,2>{0.0232521575f, 0.982835531f},
-std::array<float,2>{0.717789948f, 0.0925164521f},
-std::array<float,2>{0.25141865f, 0.0158881173f},
-std::array<float,2>{0.904792726f, 0.88854593f},
-std::array<float,2>{0.15254356f, 0.6240955f},
-std::array<float,2>{0.620673358f, 0.393251568f},
-std::array<float,2>{0.112171501f, 0.319144815f},
-std::array<float,2>{0.672450006f, 0.744854748f},
-std::array<float,2>{0.483610779f, 0.77386713f},
-std::array<float,2>{0.795152724f, 0.204494342f},
-std::array<float,2>{0.228256345f, 0.0841723233f},
-std::array<float,2>{0.558540344f, 0.970111907f},
-std::array<float,2>{0.363076508f, 0.521624446f},
-std::array<float,2>{0.998381674f, 0.45905748f},
-std::array<float,2>{0.390326023f, 0.264668316f},
-std::array<float,2>{0.82088083f, 0.677627563f},
-std::array<float,2>{0.0414543003f, 0.846723855f},
-std::array<float,2>{0.7288872f, 0.180152729f},
-std::array<float,2>{0.285720795f, 0.21853371f},
-std::array<float,2>{0.911005259f, 0.765759885f},
-std::array<float,2>{0.158654317f, 0.738836527f},
-std::array<float,2>{0.574763834f, 0.326333195f},
-std::array<float,2>{0.06394694f, 0.399106622f},
-std::array<float,2>{0.655826688f, 0.609781563f},
-std::array<float,2>{0.453079015f, 0.881446362f},
-std::array<float,2>{0.774003625f, 0.024639871f},
-std::array<float,2>{0.0277995523f, 0.135494962f},
-std::array<float,2>{0.70747292f, 0.816362679f},
-std::array<float,2>{0.417771876f, 0.636774659f},
-std::array<float,2>{0.847931445f, 0.296186417f},
-std::array<float,2>{0.338676542f, 0.49250105f},
-std::array<float,2>{0.953297019f, 0.559324384f},
-std::array<float,2>{0.213566422f, 0.943531573f},
-std::array<float,2>{0.505579114f, 0.104994543f},
-std::array<float,2>{0.471666992f, 0.0559472442f},
-std::array<float,2>{0.78666538f, 0.908600152f},
-std::array<float,2>{0.119838417f, 0.571483076f},
-std::array<float,2>{0.684676886f, 0.423880041f},
-std::array<float,2>{0.147960111f, 0.344665527f},
-std::array<float,2>{0.614628851f, 0.708284557f},
-std::array<float,2>{0.262962312f, 0.782193899f},
-std::array<float,2>{0.894733191f, 0.226969197f},
-std::array<float,2>{0.101308696f, 0.00510041602f},
-std::array<float,2>{0.671189427f, 0.89159143f},
-std::array<float,2>{0.485227227f, 0.605927289f},
-std::array<float,2>{0.804667413f, 0.388338625f},
-std::array<float,2>{0.273173064f, 0.333547592f},
-std::array<float,2>{0.879324317f, 0.727401376f},
-std::array<float,2>{0.128055215f, 0.760406971f},
-std::array<float,2>{0.601120114f, 0.188754171f},
-std::array<float,2>{0.431278855f, 0.16538097f},
-std::array<float,2>{0.870782375f, 0.869115114f},
-std::array<float,2>{0.00306539424f, 0.659169197f},
-std::array<float,2>{0.693237603f, 0.280889988f},
-std::array<float,2>{0.190380007f, 0.448484063f},
-std::array<float,2>{0.520173311f, 0.515142918f},
-std::array<float,2>{0.327916533f, 0.995628536f},
-std::array<float,2>{0.945422173f, 0.075269945f},
-std::array<float,2>{0.17436406f, 0.241761997f},
-std::array<float,2>{0.579140723f, 0.801665425f},
-std::array<float,2>{0.300566852f, 0.689788163f},
-std::array<float,2>{0.937308073f, 0.373923153f},
-std::array<float,2>{0.461726278f, 0.407905638f},
-std::array<float,2>{0.765222013f, 0.580089629f},
-std::array<float,2>{0.0933019668f, 0.923360229f},
-std::array<float,2>{0.62554127f, 0.040549051f},
-std::array<float,2>{0.351459861f, 0.113411494f},
-std::array<float,2>{0.976532102f, 0.956482112f},
-std::array<float,2>{0.249493659f, 0.53369844f},
-std::array<float,2>{0.536189377f, 0.478076041f},
-std::array<float,2>{0.0518231131f, 0.305940121f},
-std::array<float,2>{0.737227023f, 0.643370628f},
-std::array<float,2>{0.400681973f, 0.841677129f},
-std::array<float,2>{0.839644909f, 0.156177536f},
-std::array<float,2>{0.141573995f, 0.068062149f},
-std::array<float,2>{0.610973001f, 0.987655342f},
-std::array<float,2>{0.258770913f, 0.502729416f},
-std::array<float,2>{0.890651107f, 0.44499743f},
-std::array<float,2>{0.47579366f, 0.270340174f},
-std::array<float,2>{0.783371687f, 0.664954364f},
-std::array<float,2>{0.123392783f, 0.863451123f},
-std::array<float,2>{0.680939555f, 0.159355834f},
-std::array<float,2>{0.340794295f, 0.200251803f},
-std::array<float,2>{0.958558857f, 0.753280759f},
-std::array<float,2>{0.215264097f, 0.719019711f},
-std::array<float,2>{0.501580119f, 0.343601346f},
-std::array<float,2>{0.0244247653f, 0.3781932f},
-std::array<float,2>{0.705759883f, 0.594932497f},
-std::array<float,2>{0.420037538f, 0.904736519f},
-std::array<float,2>{0.847641528f, 0.0131449467f},
-std::array<float,2>{0.0698857382f, 0.145405665f},
-std::array<float,2>{0.65120995f, 0.829961002f},
-std::array<float,2>{0.448279947f, 0.64959389f},
-std::array<float,2>{0.778511226f, 0.300083965f},
-std::array<float,2>{0.282761455f, 0.475652903f},
-std::array<float,2>{0.90857625f, 0.539956868f},
-std::array<float,2>{0.160743788f, 0.961332023f},
-std::array<float,2>{0.570645213f, 0.12499629f},
-std::array<float,2>{0.386384845f, 0.0319699682f},
-std::array<float,2>{0.824846804f, 0.93746388f},
-std::array<float,2>{0.0442899279f, 0.586695015f},
-std::array<float,2>{0.730858564f, 0.419344962f},
-std::array<float,2>{0.232040182f, 0.360230416f},
-std::array<float,2>{0.560599804f, 0.698747993f},
-std::array<float,2>{0.363366812f, 0.806886971f},
-std::array<float,2>{0.993491828f, 0.244977087f},
-std::array<float,2>{0.047729291f, 0.020697834f},
-std::array<float,2>{0.741000652f, 0.88396287f},
-std::array<float,2>{0.40484944f, 0.618517399f},
-std::array<float,2>{0.841357827f, 0.396528035f},
-std::array<float,2>{0.347523957f, 0.315134853f},
-std::array<float,2>{0.970813334f, 0.748621941f},
-std::array<float,2>{0.244374886f, 0.781062484f},
-std::array<float,2>{0.53303355f, 0.209732905f},
-std::array<float,2>{0.468243092f, 0.17449683f},
-std::array<float,2>{0.757946432f, 0.856915653f},
-std::array<float,2>{0.087171942f, 0.682707131f},
-std::array<float,2>{0.631619036f, 0.251480252f},
-std::array<float,2>{0.178235531f, 0.462506473f},
-std::array<float,2>{0.583320796f, 0.529984176f},
-std::array<float,2>{0.301018506f, 0.977371037f},
-std::array<float,2>{0.931574047f, 0.0875347778f},
-std::array<float,2>{0.192975923f, 0.225136101f},
-std::array<float,2>{0.516768456f, 0.791452765f},
-std::array<float,2>{0.32101649f, 0.718593895f},
-std::array<float,2>{0.950126767f, 0.357892931f},
-std::array<float,2>{0.437243879f, 0.430903494f},
-std::array<float,2>{0.873576224f, 0.565574467f},
-std::array<float,2>{0.00449044863f, 0.915427744f},
-std::array<float,2>{0.689554214f, 0.0534202941f},
-std::array<float,2>{0.268327147f, 0.0952936709f},
-std::array<float,2>{0.878481627f, 0.951892316f},
-std::array<float,2>{0.129472479f, 0.547028184f},
-std::array<float,2>{0.594561875f, 0.489445895f},
-std::array<float,2>{0.0950845405f, 0.283765703f},
-std::array<float,2>{0.666639864f, 0.626708746f},
-std::array<float,2>{0.492092013f, 0.826799929f},
-std::array<float,2>{0.800475895f, 0.12997885f},
-std::array<float,2>{0.236368746f, 0.0624684431f},
-std::array<float,2>{0.539876699f, 0.910697997f},
-std::array<float,2>{0.357896209f, 0.575560927f},
-std::array<float,2>{0.981090426f, 0.425917953f},
-std::array<float,2>{0.39271912f, 0.348986566f},
-std::array<float,2>{0.830108941f, 0.705353439f},
-std::array<float,2>{0.0579383485f, 0.785852015f},
-std::array<float,2>{0.748008728f, 0.230798647f},
-std::array<float,2>{0.30543834f, 0.137030274f},
-std::array<float,2>{0.922125041f, 0.818868637f},
-std::array<float,2>{0.183443561f, 0.634928107f},
-std::array<float,2>{0.589232624f, 0.291009963f},
-std::array<float,2>{0.0830690265f, 0.497917652f},
-std::array<float,2>{0.634332001f, 0.555167377f},
-std::array<float,2>{0.460145801f, 0.941129744f},
-std::array<float,2>{0.751777053f, 0.106087774f},
-std::array<float,2>{0.00872756355f, 0.213053837f},
-std::array<float,2>{0.695503414f, 0.772941887f},
-std::array<float,2>{0.422375858f, 0.737218022f},
-std::array<float,2>{0.861478031f, 0.323185623f},
-std::array<float,2>{0.315308303f, 0.402413607f},
-std::array<float,2>{0.94530952f, 0.616371751f},
-std::array<float,2>{0.202593789f, 0.875972688f},
-std::array<float,2>{0.523648202f, 0.0307876039f},
-std::array<float,2>{0.498670757f, 0.0809948146f},
-std::array<float,2>{0.811380506f, 0.974825799f},
-std::array<float,2>{0.106475897f, 0.516827404f},
-std::array<float,2>{0.663043618f, 0.453591466f},
-std::array<float,2>{0.136091858f, 0.257877529f},
-std::array<float,2>{0.608645439f, 0.674766421f},
-std::array<float,2>{0.278896272f, 0.849725902f},
-std::array<float,2>{0.890147209f, 0.187357217f},
-std::array<float,2>{0.116706602f, 0.111290976f},
-std::array<float,2>{0.677890658f, 0.960896373f},
-std::array<float,2>{0.478214294f, 0.53856492f},
-std::array<float,2>{0.789468467f, 0.480746448f},
-std::array<float,2>{0.255173922f, 0.309417963f},
-std::array<float,2>{0.900382519f, 0.644770861f},
-std::array<float,2>{0.149452731f, 0.837444067f},
-std::array<float,2>{0.622887909f, 0.149661198f},
-std::array<float,2>{0.407086134f, 0.237423837f},
-std::array<float,2>{0.857671559f, 0.80038774f},
-std::array<float,2>{0.0160050802f, 0.693583786f},
-std::array<float,2>{0.712319553f, 0.369735301f},
-std::array<float,2>{0.210683361f, 0.412726521f},
-std::array<float,2>{0.508281291f, 0.585867345f},
-std::array<float,2>{0.332903683f, 0.929481268f},
-std::array<float,2>{0.967365861f, 0.0468614511f},
-std::array<float,2>{0.167384014f, 0.171554849f},
-std::array<float,2>{0.566478431f, 0.8741588f},
-std::array<float,2>{0.293252647f, 0.660431385f},
-std::array<float,2>{0.917978823f, 0.276996315f},
-std::array<float,2>{0.440842301f, 0.452162534f},
-std::array<float,2>{0.769754171f, 0.510411024f},
-std::array<float,2>{0.0739476606f, 0.999622047f},
-std::array<float,2>{0.646197855f, 0.0728308484f},
-std::array<float,2>{0.368048757f, 0.000599741121f},
-std::array<float,2>{0.987989664f, 0.894728661f},
-std::array<float,2>{0.21950385f, 0.604451418f},
-std::array<float,2>{0.548214078f, 0.38429153f},
-std::array<float,2>{0.0380664878f, 0.330962956f},
-std::array<float,2>{0.719987631f, 0.733676791f},
-std::array<float,2>{0.381668985f, 0.764844596f},
-std::array<float,2>{0.816949666f, 0.194090098f},
-std::array<float,2>{0.183704004f, 0.00986870937f},
-std::array<float,2>{0.590767503f, 0.901352346f},
-std::array<float,2>{0.31007418f, 0.601477981f},
-std::array<float,2>{0.929656863f, 0.379256785f},
-std::array<float,2>{0.456558943f, 0.339393049f},
-std::array<float,2>{0.754204035f, 0.725359738f},
-std::array<float,2>{0.0799764767f, 0.756072342f},
-std::array<float,2>{0.63846308f, 0.198037267f},
-std::array<float,2>{0.353387773f, 0.160396785f},
-std::array<float,2>{0.978926718f, 0.860212564f},
-std::array<float,2>{0.239451766f, 0.670245469f},
-std::array<float,2>{0.546218991f, 0.268041223f},
-std::array<float,2>{0.0605704673f, 0.43887502f},
-std::array<float,2>{0.744034946f, 0.505352437f},
-std::array<float,2>{0.395811528f, 0.992016733f},
-std::array<float,2>{0.835184753f, 0.0650121123f},
-std::array<float,2>{0.103902377f, 0.249588206f},
-std::array<float,2>{0.659439862f, 0.810646415f},
-std::array<float,2>{0.495003045f, 0.702410519f},
-std::array<float,2>{0.80752176f, 0.366340011f},
-std::array<float,2>{0.275918752f, 0.41697818f},
-std::array<float,2>{0.88554126f, 0.590486467f},
-std::array<float,2>{0.13702786f, 0.932456613f},
-std::array<float,2>{0.603548944f, 0.0377814025f},
-std::array<float,2>{0.426117182f, 0.118107378f},
-std::array<float,2>{0.864133954f, 0.966906011f},
-std::array<float,2>{0.0127364779f, 0.544335306f},
-std::array<float,2>{0.700073957f, 0.470742017f},
-std::array<float,2>{0.197825238f, 0.304040581f},
-std::array<float,2>{0.527523816f, 0.654632151f},
-std::array<float,2>{0.318474591f, 0.834160507f},
-std::array<float,2>{0.938135982f, 0.142908052f},
-std::array<float,2>{0.0208621733f, 0.091693677f},
-std::array<float,2>{0.715173304f, 0.980698466f},
-std::array<float,2>{0.411558926f, 0.523778379f},
-std::array<float,2>{0.853470564f, 0.467779875f},
-std::array<float,2>{0.331037611f, 0.255065501f},
-std::array<float,2>{0.961958706f, 0.685342312f},
-std::array<float,2>{0.206778526f, 0.85162282f},
-std::array<float,2>{0.514918029f, 0.176662639f},
-std::array<float,2>{0.481758654f, 0.205952868f},
-std::array<float,2>{0.793635666f, 0.777117848f},
-std::array<float,2>{0.109610178f, 0.742623329f},
-std::array<float,2>{0.674122393f, 0.316484451f},
-std::array<float,2>{0.15522112f, 0.390700638f},
-std::array<float,2>{0.619117796f, 0.621197164f},
-std::array<float,2>{0.253247023f, 0.890322328f},
-std::array<float,2>{0.903816402f, 0.0188557152f},
-std::array<float,2>{0.225446954f, 0.125591382f},
-std::array<float,2>{0.553025365f, 0.821841598f},
-std::array<float,2>{0.372660398f, 0.63139838f},
-std::array<float,2>{0.990906298f, 0.285859227f},
-std::array<float,2>{0.37861532f, 0.487516642f},
-std::array<float,2>{0.812891662f, 0.552437901f},
-std::array<float,2>{0.0328490362f, 0.946603954f},
-std::array<float,2>{0.726284266f, 0.0982979536f},
-std::array<float,2>{0.292339355f, 0.0506305359f},
-std::array<float,2>{0.915923476f, 0.92147547f},
-std::array<float,2>{0.168008536f, 0.569757342f},
-std::array<float,2>{0.562518597f, 0.43718639f},
-std::array<float,2>{0.0743019506f, 0.352975786f},
-std::array<float,2>{0.643374264f, 0.714823246f},
-std::array<float,2>{0.444646537f, 0.794495046f},
-std::array<float,2>{0.766371787f, 0.218840018f},
-std::array<float,2>{0.21223864f, 0.101742536f},
-std::array<float,2>{0.506185889f, 0.942273676f},
-std::array<float,2>{0.336454153f, 0.561021328f},
-std::array<float,2>{0.956022143f, 0.495598137f},
-std::array<float,2>{0.414480567f, 0.294024736f},
-std::array<float,2>{0.849724948f, 0.639126658f},
-std::array<float,2>{0.0295425989f, 0.81390202f},
-std::array<float,2>{0.710797727f, 0.133670002f},
-std::array<float,2>{0.263805985f, 0.229085535f},
-std::array<float,2>{0.896505296f, 0.783657014f},
-std::array<float,2>{0.145315528f, 0.709728956f},
-std::array<float,2>{0.616042674f, 0.345894158f},
-std::array<float,2>{0.118648976f, 0.422508717f},
-std::array<float,2>{0.685666025f, 0.573109031f},
-std::array<float,2>{0.469889045f, 0.907824814f},
-std::array<float,2>{0.78833729f, 0.058325652f},
-std::array<float,2>{0.0398603007f, 0.183225989f},
-std::array<float,2>{0.728349864f, 0.845605373f},
-std::array<float,2>{0.388178468f, 0.677919984f},
-std::array<float,2>{0.824180067f, 0.262420177f},
-std::array<float,2>{0.359723449f, 0.457905024f},
-std::array<float,2>{0.996590137f, 0.520133972f},
-std::array<float,2>{0.230201378f, 0.971214592f},
-std::array<float,2>{0.554798245f, 0.0836216062f},
-std::array<float,2>{0.449521124f, 0.0271382164f},
-std::array<float,2>{0.775611758f, 0.880265892f},
-std::array<float,2>{0.0662026331f, 0.611696839f},
-std::array<float,2>{0.653544366f, 0.401346117f},
-std::array<float,2>{0.157045916f, 0.32460469f},
-std::array<float,2>{0.576884985f, 0.741764307f},
-std::array<float,2>{0.288731277f, 0.768161714f},
-std::array<float,2>{0.913419008f, 0.214863732f},
-std::array<float,2>{0.0903668031f, 0.0426084399f},
-std::array<float,2>{0.628364027f, 0.924148142f},
-std::array<float,2>{0.464252472f, 0.57920593f},
-std::array<float,2>{0.762724817f, 0.40935573f},
-std::array<float,2>{0.297650039f, 0.372407258f},
-std::array<float,2>{0.935490429f, 0.688540339f},
-std::array<float,2>{0.172607943f, 0.803528607f},
-std::array<float,2>{0.581350386f, 0.239440605f},
-std::array<float,2>{0.39907977f, 0.152746543f},
-std::array<float,2>{0.837112725f, 0.843238056f},
-std::array<float,2>{0.0535645597f, 0.642206311f},
-std::array<float,2>{0.736288488f, 0.308174729f},
-std::array<float,2>{0.246718243f, 0.479483724f},
-std::array<float,2>{0.537327945f, 0.532183945f},
-std::array<float,2>{0.348591208f, 0.95371896f},
-std::array<float,2>{0.972803473f, 0.116249323f},
-std::array<float,2>{0.126365304f, 0.190828234f},
-std::array<float,2>{0.598015428f, 0.758478045f},
-std::array<float,2>{0.270340741f, 0.7293818f},
-std::array<float,2>{0.881394804f, 0.334555268f},
-std::array<float,2>{0.487851828f, 0.389488548f},
-std::array<float,2>{0.802550256f, 0.608667135f},
-std::array<float,2>{0.0989297852f, 0.894284725f},
-std::array<float,2>{0.668968856f, 0.00605273014f},
-std::array<float,2>{0.326003104f, 0.0779174417f},
-std::array<float,2>{0.949025512f, 0.992551386f},
-std::array<float,2>{0.188369215f, 0.513351381f},
-std::array<float,2>{0.522280931f, 0.446855813f},
-std::array<float,2>{0.0019517683f, 0.278638691f},
-std::array<float,2>{0.694469452f, 0.656356454f},
-std::array<float,2>{0.432334244f, 0.870254099f},
-std::array<float,2>{0.867427647f, 0.166321069f},
-std::array<float,2>{0.130487338f, 0.0959307849f},
-std::array<float,2>{0.595120609f, 0.949362457f},
-std::array<float,2>{0.268620938f, 0.550706267f},
-std::array<float,2>{0.877818525f, 0.491031736f},
-std::array<float,2>{0.490406126f, 0.282179028f},
-std::array<float,2>{0.799367845f, 0.627604842f},
-std::array<float,2>{0.0946371555f, 0.82435894f},
-std::array<float,2>{0.667904079f, 0.131625548f},
-std::array<float,2>{0.32132566f, 0.22308436f},
-std::array<float,2>{0.950766146f, 0.789497912f},
-std::array<float,2>{0.192180425f, 0.716304243f},
-std::array<float,2>{0.515742123f, 0.357196152f},
-std::array<float,2>{0.00558832847f, 0.431901067f},
-std::array<float,2>{0.690577209f, 0.563410878f},
-std::array<float,2>{0.435843438f, 0.916954994f},
-std::array<float,2>{0.874628425f, 0.051708214f},
-std::array<float,2>{0.0862171128f, 0.173070669f},
-std::array<float,2>{0.632517815f, 0.859326959f},
-std::array<float,2>{0.467037857f, 0.680957198f},
-std::array<float,2>{0.75944525f, 0.252448648f},
-std::array<float,2>{0.302306682f, 0.464340329f},
-std::array<float,2>{0.930535555f, 0.528712153f},
-std::array<float,2>{0.178821787f, 0.979116559f},
-std::array<float,2>{0.582488f, 0.0897797495f},
-std::array<float,2>{0.406039864f, 0.0230891462f},
-std::array<float,2>{0.84022367f, 0.886433899f},
-std::array<float,2>{0.0487210155f, 0.620771408f},
-std::array<float,2>{0.741262436f, 0.395788789f},
-std::array<float,2>{0.245324209f, 0.313067049f},
-std::array<float,2>{0.531374395f, 0.746485174f},
-std::array<float,2>{0.346194893f, 0.779184282f},
-std::array<float,2>{0.972477376f, 0.207696646f},
-std::array<float,2>{0.0437644273f, 0.033827439f},
-std::array<float,2>{0.731569648f, 0.933785975f},
-std::array<float,2>{0.38530609f, 0.588060975f},
-std::array<float,2>{0.825820327f, 0.420223534f},
-std::array<float,2>{0.364488006f, 0.362981379f},
-std::array<float,2>{0.992546022f, 0.696985543f},
-std::array<float,2>{0.231294841f, 0.805467367f},
-std::array<float,2>{0.562435925f, 0.24346751f},
-std::array<float,2>{0.447655499f, 0.148019582f},
-std::array<float,2>{0.777723074f, 0.831191003f},
-std::array<float,2>{0.0684667304f, 0.650398076f},
-std::array<float,2>{0.651594996f, 0.297972381f},
-std::array<float,2>{0.161361173f, 0.47393015f},
-std::array<float,2>{0.571307182f, 0.542356849f},
-std::array<float,2>{0.281833798f, 0.963934362f},
-std::array<float,2>{0.90979898f, 0.121882543f},
-std::array<float,2>{0.216119811f, 0.202834949f},
-std::array<float,2>{0.500268996f, 0.751392305f},
-std::array<float,2>{0.341525048f, 0.721744239f},
-std::array<float,2>{0.957783103f, 0.341283292f},
-std::array<float,2>{0.421643883f, 0.376837641f},
-std::array<float,2>{0.845969737f, 0.597411752f},
-std::array<float,2>{0.0242933352f, 0.903983235f},
-std::array<float,2>{0.70684576f, 0.0140070952f},
-std::array<float,2>{0.259062201f, 0.0695753321f},
-std::array<float,2>{0.89220953f, 0.985281169f},
-std::array<float,2>{0.141924888f, 0.501477838f},
-std::array<float,2>{0.61029768f, 0.442270637f},
-std::array<float,2>{0.124170087f, 0.273308992f},
-std::array<float,2>{0.680594504f, 0.667670786f},
-std::array<float,2>{0.475099713f, 0.865921676f},
-std::array<float,2>{0.784363687f, 0.156323031f},
-std::array<float,2>{0.219866991f, 0.00287864404f},
-std::array<float,2>{0.546962976f, 0.897594571f},
-std::array<float,2>{0.368867487f, 0.603413761f},
-std::array<float,2>{0.986332059f, 0.385321409f},
-std::array<float,2>{0.382309616f, 0.329615533f},
-std::array<float,2>{0.817594588f, 0.732395411f},
-std::array<float,2>{0.0386980735f, 0.762640715f},
-std::array<float,2>{0.719684184f, 0.193003267f},
-std::array<float,2>{0.294875622f, 0.168962926f},
-std::array<float,2>{0.919436872f, 0.871681571f},
-std::array<float,2>{0.166500255f, 0.663700998f},
-std::array<float,2>{0.568137348f, 0.275207818f},
-std::array<float,2>{0.0724362284f, 0.449380249f},
-std::array<float,2>{0.644893289f, 0.508142531f},
-std::array<float,2>{0.439969599f, 0.996186793f},
-std::array<float,2>{0.770619214f, 0.0710665584f},
-std::array<float,2>{0.0168697201f, 0.234586582f},
-std::array<float,2>{0.711461723f, 0.797339857f},
-std::array<float,2>{0.408087075f, 0.693008065f},
-std::array<float,2>{0.859250724f, 0.368892074f},
-std::array<float,2>{0.333665639f, 0.410619587f},
-std::array<float,2>{0.96837163f, 0.583845794f},
-std::array<float,2>{0.209028304f, 0.927019f},
-std::array<float,2>{0.509312034f, 0.0432249606f},
-std::array<float,2>{0.47680375f, 0.11297024f},
-std::array<float,2>{0.790579379f, 0.958150327f},
-std::array<float,2>{0.116144262f, 0.536474884f},
-std::array<float,2>{0.679466903f, 0.484045893f},
-std::array<float,2>{0.14903f, 0.31193459f},
-std::array<float,2>{0.621652663f, 0.646712601f},
-std::array<float,2>{0.253985107f, 0.838319361f},
-std::array<float,2>{0.89934212f, 0.152136981f},
-std::array<float,2>{0.105938002f, 0.0791238397f},
-std::array<float,2>{0.663932085f, 0.973582745f},
-std::array<float,2>{0.499247223f, 0.518487334f},
-std::array<float,2>{0.811571002f, 0.456101716f},
-std::array<float,2>{0.277724028f, 0.259784371f},
-std::array<float,2>{0.889104664f, 0.673109114f},
-std::array<float,2>{0.135261118f, 0.849150777f},
-std::array<float,2>{0.607581139f, 0.185097158f},
-std::array<float,2>{0.423507959f, 0.211102813f},
-std::array<float,2>{0.862966835f, 0.77145505f},
-std::array<float,2>{0.00906965137f, 0.735372365f},
-std::array<float,2>{0.697259307f, 0.320473045f},
-std::array<float,2>{0.2019016f, 0.40566653f},
-std::array<float,2>{0.524771869f, 0.61413455f},
-std::array<float,2>{0.315679699f, 0.877564192f},
-std::array<float,2>{0.943678856f, 0.0273525715f},
-std::array<float,2>{0.18250154f, 0.140590742f},
-std::array<float,2>{0.588518322f, 0.817218781f},
-std::array<float,2>{0.306543022f, 0.633318782f},
-std::array<float,2>{0.923790574f, 0.292702764f},
-std::array<float,2>{0.45898509f, 0.498610765f},
-std::array<float,2>{0.75041163f, 0.557786226f},
-std::array<float,2>{0.0823644102f, 0.939211488f},
-std::array<float,2>{0.633270323f, 0.109034806f},
-std::array<float,2>{0.359254897f, 0.0603316873f},
-std::array<float,2>{0.981892169f, 0.913970947f},
-std::array<float,2>{0.238268286f, 0.577620745f},
-std::array<float,2>{0.540119052f, 0.42890358f},
-std::array<float,2>{0.0572257787f, 0.350936532f},
-std::array<float,2>{0.746999741f, 0.703792453f},
-std::array<float,2>{0.39413777f, 0.787256241f},
-std::array<float,2>{0.831902266f, 0.232581675f},
-std::array<float,2>{0.16968219f, 0.0483491346f},
-std::array<float,2>{0.564430773f, 0.919907153f},
-std::array<float,2>{0.291441858f, 0.568065107f},
-std::array<float,2>{0.91502732f, 0.433606505f},
-std::array<float,2>{0.444188118f, 0.355054051f},
-std::array<float,2>{0.766974747f, 0.712103784f},
-std::array<float,2>{0.0761699602f, 0.796190798f},
-std::array<float,2>{0.644063771f, 0.221832603f},
-std::array<float,2>{0.371157855f, 0.127616793f},
-std::array<float,2>{0.991347611f, 0.822375596f},
-std::array<float,2>{0.226371408f, 0.628909051f},
-std::array<float,2>{0.553888261f, 0.288770288f},
-std::array<float,2>{0.0317155905f, 0.485911876f},
-std::array<float,2>{0.725080669f, 0.554326475f},
-std::array<float,2>{0.377663165f, 0.947762132f},
-std::array<float,2>{0.813750625f, 0.0998077765f},
-std::array<float,2>{0.111181468f, 0.203342974f},
-std::array<float,2>{0.675515771f, 0.77509445f},
-std::array<float,2>{0.480685264f, 0.745305657f},
-std::array<float,2>{0.794466913f, 0.319368124f},
-std::array<float,2>{0.252875686f, 0.393768281f},
-std::array<float,2>{0.902916193f, 0.623702645f},
-std::array<float,2>{0.155428693f, 0.887206674f},
-std::array<float,2>{0.617737174f, 0.0167081971f},
-std::array<float,2>{0.410167605f, 0.0934965685f},
-std::array<float,2>{0.851973355f, 0.983727455f},
-std::array<float,2>{0.0201250613f, 0.527029693f},
-std::array<float,2>{0.716126263f, 0.466082811f},
-std::array<float,2>{0.205346882f, 0.256783456f},
-std::array<float,2>{0.514422894f, 0.686595857f},
-std::array<float,2>{0.331148535f, 0.854909837f},
-std::array<float,2>{0.961852789f, 0.178665385f},
-std::array<float,2>{0.0125801144f, 0.120398052f},
-std::array<float,2>{0.700373411f, 0.965357304f},
-std::array<float,2>{0.42717424f, 0.546364546f},
-std::array<float,2>{0.864792585f, 0.469514728f},
-std::array<float,2>{0.319433004f, 0.302120775f},
-std::array<float,2>{0.938714445f, 0.653505683f},
-std::array<float,2>{0.198933065f, 0.833764791f},
-std::array<float,2>{0.52843672f, 0.14069286f},
-std::array<float,2>{0.495694429f, 0.247807339f},
-std::array<float,2>{0.80784297f, 0.808947265f},
-std::array<float,2>{0.10503114f, 0.699974716f},
-std::array<float,2>{0.658381283f, 0.364104301f},
-std::array<float,2>{0.138457254f, 0.41428718f},
-std::array<float,2>{0.605127275f, 0.591972649f},
-std::array<float,2>{0.276736468f, 0.931447744f},
-std::array<float,2>{0.885977685f, 0.0367473364f},
-std::array<float,2>{0.239011556f, 0.162868366f},
-std::array<float,2>{0.545800865f, 0.863176942f},
-std::array<float,2>{0.352530926f, 0.669709206f},
-std::array<float,2>{0.980062425f, 0.265712649f},
-std::array<float,2>{0.394909292f, 0.439614475f},
-std::array<float,2>{0.834253073f, 0.507247269f},
-std::array<float,2>{0.0621855818f, 0.990191162f},
-std::array<float,2>{0.742328882f, 0.0629340485f},
-std::array<float,2>{0.308963567f, 0.00836114306f},
-std::array<float,2>{0.927834749f, 0.898937881f},
-std::array<float,2>{0.184915975f, 0.597729445f},
-std::array<float,2>{0.591321766f, 0.381883651f},
-std::array<float,2>{0.0786321461f, 0.336547941f},
-std::array<float,2>{0.636921465f, 0.723349869f},
-std::array<float,2>{0.455890894f, 0.755049586f},
-std::array<float,2>{0.755106926f, 0.195366547f},
-std::array<float,2>{0.189297199f, 0.0750606731f},
-std::array<float,2>{0.52295804f, 0.994204819f},
-std::array<float,2>{0.325166315f, 0.514549792f},
-std::array<float,2>{0.94803226f, 0.447682202f},
-std::array<float,2>{0.433342785f, 0.280122787f},
-std::array<float,2>{0.868447959f, 0.659510016f},
-std::array<float,2>{0.000183605051f, 0.867825329f},
-std::array<float,2>{0.694158971f, 0.164401636f},
-std::array<float,2>{0.270576179f, 0.18826516f},
-std::array<float,2>{0.882129729f, 0.761369169f},
-std::array<float,2>{0.125672385f, 0.727624416f},
-std::array<float,2>{0.599524558f, 0.332862645f},
-std::array<float,2>{0.0980921462f, 0.387493193f},
-std::array<float,2>{0.668154716f, 0.606505096f},
-std::array<float,2>{0.48653245f, 0.891643941f},
-std::array<float,2>{0.800862014f, 0.00460838713f},
-std::array<float,2>{0.0540875345f, 0.154544845f},
-std::array<float,2>{0.734772086f, 0.840638995f},
-std::array<float,2>{0.400206268f, 0.644280612f},
-std::array<float,2>{0.835959613f, 0.30492568f},
-std::array<float,2>{0.34934926f, 0.477183878f},
-std::array<float,2>{0.97377634f, 0.534363985f},
-std::array<float,2>{0.247495934f, 0.95538193f},
-std::array<float,2>{0.53835696f, 0.115160212f},
-std::array<float,2>{0.463674277f, 0.0399170369f},
-std::array<float,2>{0.762515128f, 0.921992779f},
-std::array<float,2>{0.0915116593f, 0.581454396f},
-std::array<float,2>{0.627236843f, 0.407061964f},
-std::array<float,2>{0.173780546f, 0.374128908f},
-std::array<float,2>{0.580148518f, 0.690753818f},
-std::array<float,2>{0.298143744f, 0.802402139f},
-std::array<float,2>{0.934055448f, 0.240488693f},
-std::array<float,2>{0.0645378008f, 0.0236462466f},
-std::array<float,2>{0.652633488f, 0.882013738f},
-std::array<float,2>{0.451125205f, 0.611277461f},
-std::array<float,2>{0.776661813f, 0.399580538f},
-std::array<float,2>{0.28750059f, 0.327591538f},
-std::array<float,2>{0.912962854f, 0.739313722f},
-std::array<float,2>{0.157841772f, 0.767575681f},
-std::array<float,2>{0.577564299f, 0.217610717f},
-std::array<float,2>{0.387035966f, 0.18145287f},
-std::array<float,2>{0.82275033f, 0.846364498f},
-std::array<float,2>{0.0406552888f, 0.676361322f},
-std::array<float,2>{0.727184772f, 0.264182717f},
-std::array<float,2>{0.229123577f, 0.460798353f},
-std::array<float,2>{0.555726588f, 0.522875667f},
-std::array<float,2>{0.360785395f, 0.969533384f},
-std::array<float,2>{0.997283638f, 0.085308589f},
-std::array<float,2>{0.146270812f, 0.228402257f},
-std::array<float,2>{0.617067456f, 0.782339394f},
-std::array<float,2>{0.265114456f, 0.707623303f},
-std::array<float,2>{0.897594929f, 0.345612198f},
-std::array<float,2>{0.469357252f, 0.425000548f},
-std::array<float,2>{0.787684679f, 0.571016431f},
-std::array<float,2>{0.117625616f, 0.909878314f},
-std::array<float,2>{0.687244654f, 0.0548148192f},
-std::array<float,2>{0.337738037f, 0.104184322f},
-std::array<float,2>{0.956236005f, 0.944428623f},
-std::array<float,2>{0.211597726f, 0.560459554f},
-std::array<float,2>{0.507358015f, 0.493488371f},
-std::array<float,2>{0.0310481712f, 0.295090824f},
-std::array<float,2>{0.709230959f, 0.638466954f},
-std::array<float,2>{0.415656388f, 0.815235734f},
-std::array<float,2>{0.850820303f, 0.136455849f},
-std::array<float,2>{0.176662713f, 0.0867673382f},
-std::array<float,2>{0.584773064f, 0.97839272f},
-std::array<float,2>{0.303830385f, 0.530857861f},
-std::array<float,2>{0.931856453f, 0.461707383f},
-std::array<float,2>{0.465592623f, 0.250013083f},
-std::array<float,2>{0.761140585f, 0.682444811f},
-std::array<float,2>{0.089303337f, 0.855575919f},
-std::array<float,2>{0.63066417f, 0.175318211f},
-std::array<float,2>{0.344082206f, 0.210553005f},
-std::array<float,2>{0.96996212f, 0.78011632f},
-std::array<float,2>{0.243991911f, 0.749574065f},
-std::array<float,2>{0.533458412f, 0.315940559f},
-std::array<float,2>{0.0491605401f, 0.397822827f},
-std::array<float,2>{0.738793075f, 0.617828846f},
-std::array<float,2>{0.403406203f, 0.883333325f},
-std::array<float,2>{0.843684435f, 0.0198198166f},
-std::array<float,2>{0.0973306075f, 0.129768893f},
-std::array<float,2>{0.664074063f, 0.827932417f},
-std::array<float,2>{0.488754004f, 0.625273287f},
-std::array<float,2>{0.79855299f, 0.285051078f},
-std::array<float,2>{0.266895086f, 0.488996714f},
-std::array<float,2>{0.875086486f, 0.548014343f},
-std::array<float,2>{0.131300703f, 0.952486336f},
-std::array<float,2>{0.596625865f, 0.094361797f},
-std::array<float,2>{0.433815062f, 0.0543741286f},
-std::array<float,2>{0.872552574f, 0.914757729f},
-std::array<float,2>{0.00764741749f, 0.564791203f},
-std::array<float,2>{0.688736081f, 0.430098146f},
-std::array<float,2>{0.194967031f, 0.359300584f},
-std::array<float,2>{0.51941222f, 0.717458546f},
-std::array<float,2>{0.323094279f, 0.792669296f},
-std::array<float,2>{0.952058852f, 0.226388127f},
-std::array<float,2>{0.0272736996f, 0.0122121321f},
-std::array<float,2>{0.704989552f, 0.90616858f},
-std::array<float,2>{0.419508874f, 0.593940973f},
-std::array<float,2>{0.844032288f, 0.377595961f},
-std::array<float,2>{0.343404055f, 0.342523336f},
-std::array<float,2>{0.960276663f, 0.720006406f},
-std::array<float,2>{0.217290848f, 0.752842247f},
-std::array<float,2>{0.503471255f, 0.200155392f},
-std::array<float,2>{0.473931372f, 0.158983216f},
-std::array<float,2>{0.781352401f, 0.865107417f},
-std::array<float,2>{0.122399382f, 0.665471733f},
-std::array<float,2>{0.681709766f, 0.271030903f},
-std::array<float,2>{0.143631428f, 0.443545938f},
-std::array<float,2>{0.613183141f, 0.503384769f},
-std::array<float,2>{0.260704875f, 0.986482441f},
-std::array<float,2>{0.893581867f, 0.0671475455f},
-std::array<float,2>{0.234066844f, 0.245695025f},
-std::array<float,2>{0.558603585f, 0.808129609f},
-std::array<float,2>{0.366770446f, 0.698008418f},
-std::array<float,2>{0.994754076f, 0.361284643f},
-std::array<float,2>{0.384067655f, 0.418827593f},
-std::array<float,2>{0.82636559f, 0.587712348f},
-std::array<float,2>{0.0455352589f, 0.935741663f},
-std::array<float,2>{0.734022141f, 0.0323243886f},
-std::array<float,2>{0.28330344f, 0.123967633f},
-std::array<float,2>{0.908114314f, 0.962442696f},
-std::array<float,2>{0.163786858f, 0.540254235f},
-std::array<float,2>{0.572691917f, 0.475584745f},
-std::array<float,2>{0.0666034296f, 0.299417168f},
-std::array<float,2>{0.649578214f, 0.649223268f},
-std::array<float,2>{0.44660762f, 0.828962505f},
-std::array<float,2>{0.779557705f, 0.146034852f},
-std::array<float,2>{0.207466066f, 0.0458934493f},
-std::array<float,2>{0.510866642f, 0.928624511f},
-std::array<float,2>{0.334292352f, 0.58477658f},
-std::array<float,2>{0.966461718f, 0.413743407f},
-std::array<float,2>{0.408348173f, 0.370813906f},
-std::array<float,2>{0.855478942f, 0.69500941f},
-std::array<float,2>{0.0192751661f, 0.799170017f},
-std::array<float,2>{0.713567674f, 0.236459702f},
-std::array<float,2>{0.257135749f, 0.148565516f},
-std::array<float,2>{0.900955617f, 0.83618331f},
-std::array<float,2>{0.152157381f, 0.646188557f},
-std::array<float,2>{0.624911368f, 0.309788525f},
-std::array<float,2>{0.114178531f, 0.481989831f},
-std::array<float,2>{0.677200615f, 0.537827432f},
-std::array<float,2>{0.479391187f, 0.959845245f},
-std::array<float,2>{0.791051328f, 0.109895736f},
-std::array<float,2>{0.036988169f, 0.195092306f},
-std::array<float,2>{0.720722079f, 0.76373899f},
-std::array<float,2>{0.380695313f, 0.732479393f},
-std::array<float,2>{0.819961905f, 0.331252128f},
-std::array<float,2>{0.369194031f, 0.383007109f},
-std::array<float,2>{0.985379875f, 0.60469234f},
-std::array<float,2>{0.222456396f, 0.89603281f},
-std::array<float,2>{0.550198674f, 0.00146088575f},
-std::array<float,2>{0.437757671f, 0.0740303621f},
-std::array<float,2>{0.772122979f, 0.998750091f},
-std::array<float,2>{0.0710562542f, 0.511035323f},
-std::array<float,2>{0.647018135f, 0.451530933f},
-std::array<float,2>{0.165380925f, 0.276070654f},
-std::array<float,2>{0.568897069f, 0.661225498f},
-std::array<float,2>{0.295651615f, 0.873729885f},
-std::array<float,2>{0.92059797f, 0.169923246f},
-std::array<float,2>{0.0856672153f, 0.107033752f},
-std::array<float,2>{0.63582021f, 0.940288961f},
-std::array<float,2>{0.458410531f, 0.556411564f},
-std::array<float,2>{0.753825426f, 0.496786237f},
-std::array<float,2>{0.307535768f, 0.289844275f},
-std::array<float,2>{0.925092101f, 0.63641566f},
-std::array<float,2>{0.18144536f, 0.820030391f},
-std::array<float,2>{0.58747232f, 0.138407677f},
-std::array<float,2>{0.390714318f, 0.232342884f},
-std::array<float,2>{0.828272641f, 0.786529362f},
-std::array<float,2>{0.0561419874f, 0.706280172f},
-std::array<float,2>{0.748454869f, 0.348465085f},
-std::array<float,2>{0.234377235f, 0.427174032f},
-std::array<float,2>{0.542631328f, 0.574469864f},
-std::array<float,2>{0.356909186f, 0.911604702f},
-std::array<float,2>{0.983470082f, 0.0607350767f},
-std::array<float,2>{0.134196177f, 0.185945153f},
-std::array<float,2>{0.607304275f, 0.851518869f},
-std::array<float,2>{0.280046433f, 0.675572038f},
-std::array<float,2>{0.886922836f, 0.259162515f},
-std::array<float,2>{0.497214705f, 0.454102635f},
-std::array<float,2>{0.808961391f, 0.515745997f},
-std::array<float,2>{0.108329102f, 0.975835323f},
-std::array<float,2>{0.660860002f, 0.0812648982f},
-std::array<float,2>{0.313045591f, 0.030142054f},
-std::array<float,2>{0.941600561f, 0.876417577f},
-std::array<float,2>{0.199526578f, 0.615318537f},
-std::array<float,2>{0.526411891f, 0.403468758f},
-std::array<float,2>{0.010462258f, 0.323493987f},
-std::array<float,2>{0.698620319f, 0.7378757f},
-std::array<float,2>{0.42481643f, 0.771981955f},
-std::array<float,2>{0.859992743f, 0.214632064f},
-std::array<float,2>{0.15340519f, 0.01836689f},
-std::array<float,2>{0.619207144f, 0.889054239f},
-std::array<float,2>{0.250634938f, 0.622329354f},
-std::array<float,2>{0.905905008f, 0.391694427f},
-std::array<float,2>{0.483346283f, 0.317973673f},
-std::array<float,2>{0.796177328f, 0.743582726f},
-std::array<float,2>{0.112910531f, 0.775612235f},
-std::array<float,2>{0.673463762f, 0.206619844f},
-std::array<float,2>{0.328571975f, 0.176838413f},
-std::array<float,2>{0.964728236f, 0.853240371f},
-std::array<float,2>{0.204360813f, 0.683864176f},
-std::array<float,2>{0.513253927f, 0.254298538f},
-std::array<float,2>{0.0221807715f, 0.467537403f},
-std::array<float,2>{0.717757702f, 0.524461448f},
-std::array<float,2>{0.412269622f, 0.981720448f},
-std::array<float,2>{0.854563534f, 0.0902407244f},
-std::array<float,2>{0.0769150853f, 0.219815195f},
-std::array<float,2>{0.642497361f, 0.793565214f},
-std::array<float,2>{0.442876965f, 0.713521302f},
-std::array<float,2>{0.768981993f, 0.35183984f},
-std::array<float,2>{0.289744139f, 0.435651273f},
-std::array<float,2>{0.917623103f, 0.569261491f},
-std::array<float,2>{0.17149736f, 0.920667708f},
-std::array<float,2>{0.565421224f, 0.0490135886f},
-std::array<float,2>{0.376714885f, 0.0988532901f},
-std::array<float,2>{0.815841734f, 0.946201921f},
-std::array<float,2>{0.0334586799f, 0.551032603f},
-std::array<float,2>{0.723359883f, 0.486985445f},
-std::array<float,2>{0.224004149f, 0.28646335f},
-std::array<float,2>{0.551806509f, 0.632327497f},
-std::array<float,2>{0.373215199f, 0.821104884f},
-std::array<float,2>{0.988571525f, 0.126640603f},
-std::array<float,2>{0.0598051473f, 0.0657385811f},
-std::array<float,2>{0.744883895f, 0.99104774f},
-std::array<float,2>{0.396779895f, 0.50449425f},
-std::array<float,2>{0.833152652f, 0.437699348f},
-std::array<float,2>{0.35495773f, 0.268981814f},
-std::array<float,2>{0.977349877f, 0.671047151f},
-std::array<float,2>{0.240561008f, 0.860837579f},
-std::array<float,2>{0.543630123f, 0.161657199f},
-std::array<float,2>{0.454296649f, 0.198979348f},
-std::array<float,2>{0.757201731f, 0.757213414f},
-std::array<float,2>{0.0803800151f, 0.725950003f},
-std::array<float,2>{0.639280021f, 0.338606745f},
-std::array<float,2>{0.185659409f, 0.380250841f},
-std::array<float,2>{0.592802525f, 0.600219607f},
-std::array<float,2>{0.311683774f, 0.90209657f},
-std::array<float,2>{0.926858425f, 0.0113952216f},
-std::array<float,2>{0.195907354f, 0.143941462f},
-std::array<float,2>{0.529727519f, 0.835308313f},
-std::array<float,2>{0.31780079f, 0.656160176f},
-std::array<float,2>{0.940835059f, 0.303265989f},
-std::array<float,2>{0.428113967f, 0.471747726f},
-std::array<float,2>{0.865925074f, 0.543879747f},
-std::array<float,2>{0.0145064108f, 0.968130291f},
-std::array<float,2>{0.701943338f, 0.118777744f},
-std::array<float,2>{0.274855644f, 0.039008595f},
-std::array<float,2>{0.884156525f, 0.933419347f},
-std::array<float,2>{0.139505848f, 0.591610134f},
-std::array<float,2>{0.60257417f, 0.417720854f},
-std::array<float,2>{0.101797536f, 0.365336567f},
-std::array<float,2>{0.657536089f, 0.702093124f},
-std::array<float,2>{0.492423117f, 0.811664343f},
-std::array<float,2>{0.804944873f, 0.248170912f},
-std::array<float,2>{0.248163238f, 0.115845859f},
-std::array<float,2>{0.535414457f, 0.954679012f},
-std::array<float,2>{0.350418776f, 0.532538295f},
-std::array<float,2>{0.975124478f, 0.479910165f},
-std::array<float,2>{0.402042747f, 0.307218343f},
-std::array<float,2>{0.838691831f, 0.640690386f},
-std::array<float,2>{0.0510330833f, 0.841892481f},
-std::array<float,2>{0.737869024f, 0.153688207f},
-std::array<float,2>{0.299378604f, 0.239107937f},
-std::array<float,2>{0.936466515f, 0.804063857f},
-std::array<float,2>{0.175445542f, 0.687731028f},
-std::array<float,2>{0.578487992f, 0.371552438f},
-std::array<float,2>{0.0923876911f, 0.40832901f},
-std::array<float,2>{0.626659632f, 0.57817173f},
-std::array<float,2>{0.462454885f, 0.925589204f},
-std::array<float,2>{0.76379782f, 0.0410803333f},
-std::array<float,2>{0.00279614702f, 0.167628258f},
-std::array<float,2>{0.691863179f, 0.869597971f},
-std::array<float,2>{0.429869711f, 0.657884002f},
-std::array<float,2>{0.869275689f, 0.277727157f},
-std::array<float,2>{0.326201528f, 0.445708632f},
-std::array<float,2>{0.946888804f, 0.512099445f},
-std::array<float,2>{0.190953687f, 0.993918717f},
-std::array<float,2>{0.521367669f, 0.0761838257f},
-std::array<float,2>{0.485717773f, 0.00743666105f},
-std::array<float,2>{0.80369854f, 0.892859101f},
-std::array<float,2>{0.0996635556f, 0.607897103f},
-std::array<float,2>{0.670594811f, 0.390277773f},
-std::array<float,2>{0.127656564f, 0.335186303f},
-std::array<float,2>{0.599773765f, 0.729966521f},
-std::array<float,2>{0.272269756f, 0.759218395f},
-std::array<float,2>{0.880141914f, 0.19016099f},
-std::array<float,2>{0.12104933f, 0.0574564226f},
-std::array<float,2>{0.684213817f, 0.907114327f},
-std::array<float,2>{0.472530752f, 0.574190497f},
-std::array<float,2>{0.786117494f, 0.423238605f},
-std::array<float,2>{0.261851609f, 0.347421885f},
-std::array<float,2>{0.89631778f, 0.710444868f},
-std::array<float,2>{0.146928117f, 0.78495878f},
-std::array<float,2>{0.613928139f, 0.229620963f},
-std::array<float,2>{0.41659838f, 0.134225816f},
-std::array<float,2>{0.848911643f, 0.813319981f},
-std::array<float,2>{0.028955264f, 0.639876068f},
-std::array<float,2>{0.708496153f, 0.293330193f},
-std::array<float,2>{0.214734495f, 0.49510479f},
-std::array<float,2>{0.504436076f, 0.562122524f},
-std::array<float,2>{0.339038521f, 0.942416489f},
-std::array<float,2>{0.954191744f, 0.102639973f},
-std::array<float,2>{0.159765542f, 0.216172755f},
-std::array<float,2>{0.575859129f, 0.769016922f},
-std::array<float,2>{0.286688626f, 0.740265489f},
-std::array<float,2>{0.911319137f, 0.32573992f},
-std::array<float,2>{0.451312244f, 0.4015553f},
-std::array<float,2>{0.775252283f, 0.612964153f},
-std::array<float,2>{0.0629796609f, 0.879571319f},
-std::array<float,2>{0.65484786f, 0.0258339699f},
-std::array<float,2>{0.361892879f, 0.0822427273f},
-std::array<float,2>{0.999985993f, 0.971691549f},
-std::array<float,2>{0.226748452f, 0.52096051f},
-std::array<float,2>{0.557220936f, 0.45868656f},
-std::array<float,2>{0.0426518582f, 0.262833476f},
-std::array<float,2>{0.730327427f, 0.679478168f},
-std::array<float,2>{0.389063537f, 0.84443748f},
-std::array<float,2>{0.822015822f, 0.182188928f},
-std::array<float,2>{0.180960327f, 0.108506925f},
-std::array<float,2>{0.587269247f, 0.938694954f},
-std::array<float,2>{0.306726217f, 0.558214247f},
-std::array<float,2>{0.925436914f, 0.498496622f},
-std::array<float,2>{0.458786666f, 0.29207328f},
-std::array<float,2>{0.753386855f, 0.633013368f},
-std::array<float,2>{0.0850561932f, 0.816550255f},
-std::array<float,2>{0.636251092f, 0.140118435f},
-std::array<float,2>{0.357290119f, 0.232995093f},
-std::array<float,2>{0.98436892f, 0.787828267f},
-std::array<float,2>{0.235227138f, 0.703442693f},
-std::array<float,2>{0.542183578f, 0.351142704f},
-std::array<float,2>{0.0566234291f, 0.429347605f},
-std::array<float,2>{0.748584688f, 0.577913225f},
-std::array<float,2>{0.391471416f, 0.913378119f},
-std::array<float,2>{0.828735948f, 0.059641026f},
-std::array<float,2>{0.107499957f, 0.184668511f},
-std::array<float,2>{0.660629511f, 0.848727942f},
-std::array<float,2>{0.497561693f, 0.673815846f},
-std::array<float,2>{0.809317112f, 0.260537267f},
-std::array<float,2>{0.279338121f, 0.457004279f},
-std::array<float,2>{0.887610912f, 0.518025875f},
-std::array<float,2>{0.134732172f, 0.972657859f},
-std::array<float,2>{0.606766522f, 0.0800067857f},
-std::array<float,2>{0.425476074f, 0.0282741245f},
-std::array<float,2>{0.859684765f, 0.877160907f},
-std::array<float,2>{0.0101457331f, 0.613642454f},
-std::array<float,2>{0.698904157f, 0.406242281f},
-std::array<float,2>{0.200056717f, 0.320946336f},
-std::array<float,2>{0.527128756f, 0.736266255f},
-std::array<float,2>{0.312801212f, 0.770668149f},
-std::array<float,2>{0.941998124f, 0.211907834f},
-std::array<float,2>{0.0186387189f, 0.0435451865f},
-std::array<float,2>{0.713278294f, 0.927506506f},
-std::array<float,2>{0.409152031f, 0.583180666f},
-std::array<float,2>{0.856332719f, 0.411119461f},
-std::array<float,2>{0.334838897f, 0.368436188f},
-std::array<float,2>{0.966055334f, 0.692413807f},
-std::array<float,2>{0.207568631f, 0.797813833f},
-std::array<float,2>{0.511718452f, 0.23490487f},
-std::array<float,2>{0.478654772f, 0.151456058f},
-std::array<float,2>{0.791529238f, 0.838805676f},
-std::array<float,2>{0.113647692f, 0.647242725f},
-std::array<float,2>{0.677518785f, 0.31228736f},
-std::array<float,2>{0.151522875f, 0.483616769f},
-std::array<float,2>{0.62414372f, 0.537079275f},
-std::array<float,2>{0.257783651f, 0.958764076f},
-std::array<float,2>{0.900598168f, 0.112564869f},
-std::array<float,2>{0.222165182f, 0.19254671f},
-std::array<float,2>{0.550676465f, 0.762079f},
-std::array<float,2>{0.370014399f, 0.731641889f},
-std::array<float,2>{0.985947609f, 0.329239935f},
-std::array<float,2>{0.380325139f, 0.385166347f},
-std::array<float,2>{0.819558144f, 0.602555215f},
-std::array<float,2>{0.0364996754f, 0.898029745f},
-std::array<float,2>{0.72160697f, 0.0022969041f},
-std::array<float,2>{0.295208603f, 0.0706389397f},
-std::array<float,2>{0.920044839f, 0.996618927f},
-std::array<float,2>{0.166011781f, 0.508449793f},
-std::array<float,2>{0.56868434f, 0.449863166f},
-std::array<float,2>{0.0705602393f, 0.274470389f},
-std::array<float,2>{0.646584511f, 0.6634022f},
-std::array<float,2>{0.438225329f, 0.871517539f},
-std::array<float,2>{0.771957219f, 0.169595242f},
-std::array<float,2>{0.216924727f, 0.0145675903f},
-std::array<float,2>{0.503086388f, 0.903494239f},
-std::array<float,2>{0.343210191f, 0.596755087f},
-std::array<float,2>{0.960832417f, 0.376278222f},
-std::array<float,2>{0.419096082f, 0.341698825f},
-std::array<float,2>{0.844366312f, 0.722343624f},
-std::array<float,2>{0.0266570542f, 0.751541138f},
-std::array<float,2>{0.704301894f, 0.202230632f},
-std::array<float,2>{0.260123909f, 0.156897247f},
-std::array<float,2>{0.894499302f, 0.865260482f},
-std::array<float,2>{0.144342646f, 0.66722852f},
-std::array<float,2>{0.612451255f, 0.27287358f},
-std::array<float,2>{0.122864917f, 0.441557437f},
-std::array<float,2>{0.682403684f, 0.501456261f},
-std::array<float,2>{0.474556983f, 0.984681189f},
-std::array<float,2>{0.78178823f, 0.0702643096f},
-std::array<float,2>{0.0452859327f, 0.244034216f},
-std::array<float,2>{0.733454168f, 0.805126071f},
-std::array<float,2>{0.384737998f, 0.696737885f},
-std::array<float,2>{0.826726675f, 0.362340957f},
-std::array<float,2>{0.366433024f, 0.420559466f},
-std::array<float,2>{0.994481385f, 0.588855922f},
-std::array<float,2>{0.233465493f, 0.934534192f},
-std::array<float,2>{0.559112906f, 0.0335378386f},
-std::array<float,2>{0.447120368f, 0.121571444f},
-std::array<float,2>{0.77996558f, 0.964496434f},
-std::array<float,2>{0.0672500432f, 0.542723596f},
-std::array<float,2>{0.650155127f, 0.474487782f},
-std::array<float,2>{0.163367718f, 0.298363894f},
-std::array<float,2>{0.573060393f, 0.651085854f},
-std::array<float,2>{0.283819944f, 0.831983864f},
-std::array<float,2>{0.907340467f, 0.147814885f},
-std::array<float,2>{0.0896356553f, 0.08916457f},
-std::array<float,2>{0.630252957f, 0.978991568f},
-std::array<float,2>{0.464844733f, 0.528879285f},
-std::array<float,2>{0.761316419f, 0.464369744f},
-std::array<float,2>{0.304453969f, 0.252201229f},
-std::array<float,2>{0.932559371f, 0.681241453f},
-std::array<float,2>{0.175927162f, 0.858655035f},
-std::array<float,2>{0.584446788f, 0.173779786f},
-std::array<float,2>{0.403890073f, 0.207291096f},
-std::array<float,2>{0.843213141f, 0.778515995f},
-std::array<float,2>{0.0496177338f, 0.746963978f},
-std::array<float,2>{0.738591373f, 0.312696427f},
-std::array<float,2>{0.243371055f, 0.396352202f},
-std::array<float,2>{0.534021616f, 0.62046665f},
-std::array<float,2>{0.344649792f, 0.886122704f},
-std::array<float,2>{0.970619678f, 0.022606926f},
-std::array<float,2>{0.131594047f, 0.131007716f},
-std::array<float,2>{0.596140027f, 0.82477653f},
-std::array<float,2>{0.267361671f, 0.627159655f},
-std::array<float,2>{0.87550348f, 0.281624079f},
-std::array<float,2>{0.488901436f, 0.490598738f},
-std::array<float,2>{0.798102856f, 0.550210059f},
-std::array<float,2>{0.0969946384f, 0.950096905f},
-std::array<float,2>{0.664733589f, 0.0964897797f},
-std::array<float,2>{0.322521895f, 0.0512496606f},
-std::array<float,2>{0.951602638f, 0.916046143f},
-std::array<float,2>{0.1943883f, 0.562708199f},
-std::array<float,2>{0.518986166f, 0.432516813f},
-std::array<float,2>{0.00699706934f, 0.356854051f},
-std::array<float,2>{0.689406455f, 0.716370583f},
-std::array<float,2>{0.434146702f, 0.789674401f},
-std::array<float,2>{0.872895598f, 0.223326474f},
-std::array<float,2>{0.147280842f, 0.055483859f},
-std::array<float,2>{0.613369107f, 0.909224212f},
-std::array<float,2>{0.262275279f, 0.570757449f},
-std::array<float,2>{0.895693362f, 0.425316811f},
-std::array<float,2>{0.472074121f, 0.345073164f},
-std::array<float,2>{0.785205185f, 0.707399249f},
-std::array<float,2>{0.120170534f, 0.783047915f},
-std::array<float,2>{0.683913946f, 0.227730766f},
-std::array<float,2>{0.339656353f, 0.135764584f},
-std::array<float,2>{0.955044091f, 0.814865351f},
-std::array<float,2>{0.214003712f, 0.638102889f},
-std::array<float,2>{0.504197836f, 0.295658469f},
-std::array<float,2>{0.0283894874f, 0.493726611f},
-std::array<float,2>{0.708392918f, 0.559860408f},
-std::array<float,2>{0.416050613f, 0.945186138f},
-std::array<float,2>{0.849155962f, 0.10381373f},
-std::array<float,2>{0.0631034225f, 0.217285067f},
-std::array<float,2>{0.654535651f, 0.766712904f},
-std::array<float,2>{0.4517681f, 0.739753008f},
-std::array<float,2>{0.774825752f, 0.327998877f},
-std::array<float,2>{0.28641066f, 0.400009632f},
-std::array<float,2>{0.911978722f, 0.610507488f},
-std::array<float,2>{0.159404218f, 0.882634997f},
-std::array<float,2>{0.575564682f, 0.0242100358f},
-std::array<float,2>{0.389277995f, 0.0859032795f},
-std::array<float,2>{0.821462214f, 0.969019353f},
-std::array<float,2>{0.0424687527f, 0.523077846f},
-std::array<float,2>{0.729949176f, 0.460220188f},
-std::array<float,2>{0.227101952f, 0.26408571f},
-std::array<float,2>{0.557117641f, 0.675789833f},
-std::array<float,2>{0.361522466f, 0.846072078f},
-std::array<float,2>{0.999489725f, 0.180862337f},
-std::array<float,2>{0.051401969f, 0.114280038f},
-std::array<float,2>{0.737786055f, 0.955965698f},
-std::array<float,2>{0.401627988f, 0.535088539f},
-std::array<float,2>{0.838239372f, 0.476848036f},
-std::array<float,2>{0.349842399f, 0.305327952f},
-std::array<float,2>{0.97479558f, 0.643974125f},
-std::array<float,2>{0.248584285f, 0.840135455f},
-std::array<float,2>{0.535666466f, 0.154918477f},
-std::array<float,2>{0.462198913f, 0.24117732f},
-std::array<float,2>{0.764206231f, 0.802082121f},
-std::array<float,2>{0.0920352563f, 0.69111377f},
-std::array<float,2>{0.626370728f, 0.374593645f},
-std::array<float,2>{0.17510806f, 0.406413049f},
-std::array<float,2>{0.578885317f, 0.582026064f},
-std::array<float,2>{0.298870653f, 0.922454536f},
-std::array<float,2>{0.935654759f, 0.039091371f},
-std::array<float,2>{0.190771058f, 0.164763734f},
-std::array<float,2>{0.520519853f, 0.867207766f},
-std::array<float,2>{0.326675683f, 0.659678578f},
-std::array<float,2>{0.946308076f, 0.279423088f},
-std::array<float,2>{0.430300087f, 0.448013127f},
-std::array<float,2>{0.869901717f, 0.513836026f},
-std::array<float,2>{0.00208826177f, 0.994815707f},
-std::array<float,2>{0.691899717f, 0.0744014457f},
-std::array<float,2>{0.271730661f, 0.00398046989f},
-std::array<float,2>{0.880620539f, 0.892254651f},
-std::array<float,2>{0.127056643f, 0.607185543f},
-std::array<float,2>{0.600416601f, 0.386738598f},
-std::array<float,2>{0.100199543f, 0.332395285f},
-std::array<float,2>{0.670150578f, 0.728041768f},
-std::array<float,2>{0.486152112f, 0.76097554f},
-std::array<float,2>{0.803169131f, 0.187501475f},
-std::array<float,2>{0.241096884f, 0.0630266964f},
-std::array<float,2>{0.543138981f, 0.989494085f},
-std::array<float,2>{0.355374455f, 0.50780493f},
-std::array<float,2>{0.976879954f, 0.440092802f},
-std::array<float,2>{0.39732793f, 0.266180456f},
-std::array<float,2>{0.833510697f, 0.669071853f},
-std::array<float,2>{0.0601510368f, 0.862684429f},
-std::array<float,2>{0.744620562f, 0.162478045f},
-std::array<float,2>{0.312309235f, 0.196145624f},
-std::array<float,2>{0.927541614f, 0.755612671f},
-std::array<float,2>{0.186317459f, 0.723073006f},
-std::array<float,2>{0.593310654f, 0.335968226f},
-std::array<float,2>{0.080742389f, 0.382776022f},
-std::array<float,2>{0.638827562f, 0.59817785f},
-std::array<float,2>{0.454715431f, 0.898691475f},
-std::array<float,2>{0.757488787f, 0.0079377275f},
-std::array<float,2>{0.0137542728f, 0.141314119f},
-std::array<float,2>{0.70156014f, 0.833380044f},
-std::array<float,2>{0.428301275f, 0.653842807f},
-std::array<float,2>{0.865298927f, 0.302342534f},
-std::array<float,2>{0.318080485f, 0.468856186f},
-std::array<float,2>{0.941302478f, 0.546525717f},
-std::array<float,2>{0.195599794f, 0.965020955f},
-std::array<float,2>{0.529904246f, 0.120716676f},
-std::array<float,2>{0.49309963f, 0.0364906937f},
-std::array<float,2>{0.805298984f, 0.93099755f},
-std::array<float,2>{0.102075964f, 0.592324018f},
-std::array<float,2>{0.657975435f, 0.414969057f},
-std::array<float,2>{0.138932392f, 0.363756686f},
-std::array<float,2>{0.603350759f, 0.699623883f},
-std::array<float,2>{0.27497676f, 0.809308767f},
-std::array<float,2>{0.884407222f, 0.247326791f},
-std::array<float,2>{0.112765267f, 0.0174588189f},
-std::array<float,2>{0.673034132f, 0.887506902f},
-std::array<float,2>{0.482861459f, 0.623171389f},
-std::array<float,2>{0.79675436f, 0.39420566f},
-std::array<float,2>{0.25035882f, 0.319945306f},
-std::array<float,2>{0.905277669f, 0.746083319f},
-std::array<float,2>{0.154161692f, 0.774687827f},
-std::array<float,2>{0.619790614f, 0.2038991f},
-std::array<float,2>{0.413039505f, 0.178219751f},
-std::array<float,2>{0.855413675f, 0.855411351f},
-std::array<float,2>{0.0218938477f, 0.687434614f},
-std::array<float,2>{0.717184603f, 0.25594303f},
-std::array<float,2>{0.204971597f, 0.466763377f},
-std::array<float,2>{0.512863576f, 0.526422262f},
-std::array<float,2>{0.328705162f, 0.98421061f},
-std::array<float,2>{0.964348197f, 0.0932127088f},
-std::array<float,2>{0.171353087f, 0.222451597f},
-std::array<float,2>{0.564899325f, 0.796487451f},
-std::array<float,2>{0.289080292f, 0.712425947f},
-std::array<float,2>{0.917090654f, 0.354972512f},
-std::array<float,2>{0.442758769f, 0.434122682f},
-std::array<float,2>{0.769163072f, 0.567510605f},
-std::array<float,2>{0.076504752f, 0.919308245f},
-std::array<float,2>{0.641829193f, 0.0481739864f},
-std::array<float,2>{0.37386018f, 0.100234531f},
-std::array<float,2>{0.98916471f, 0.947732508f},
-std::array<float,2>{0.22453028f, 0.5540874f},
-std::array<float,2>{0.55245316f, 0.485399306f},
-std::array<float,2>{0.0341439731f, 0.288086742f},
-std::array<float,2>{0.723126352f, 0.629397631f},
-std::array<float,2>{0.376436532f, 0.823076487f},
-std::array<float,2>{0.815949202f, 0.127362967f},
-std::array<float,2>{0.134951115f, 0.0818724856f},
-std::array<float,2>{0.608204067f, 0.976110816f},
-std::array<float,2>{0.278294891f, 0.516317248f},
-std::array<float,2>{0.889335752f, 0.455028623f},
-std::array<float,2>{0.499854952f, 0.259389728f},
-std::array<float,2>{0.812460601f, 0.675291002f},
-std::array<float,2>{0.106429227f, 0.850785553f},
-std::array<float,2>{0.663343132f, 0.18643792f},
-std::array<float,2>{0.315952599f, 0.214082494f},
-std::array<float,2>{0.944229007f, 0.771828234f},
-std::array<float,2>{0.201540262f, 0.737661839f},
-std::array<float,2>{0.524997771f, 0.324211746f},
-std::array<float,2>{0.0095349066f, 0.404034555f},
-std::array<float,2>{0.696430564f, 0.615813136f},
-std::array<float,2>{0.423333228f, 0.876633108f},
-std::array<float,2>{0.862389684f, 0.0296375193f},
-std::array<float,2>{0.0829532072f, 0.137963757f},
-std::array<float,2>{0.633541644f, 0.819794655f},
-std::array<float,2>{0.459777892f, 0.635888875f},
-std::array<float,2>{0.75055927f, 0.2895118f},
-std::array<float,2>{0.305728137f, 0.496558905f},
-std::array<float,2>{0.923233271f, 0.555687606f},
-std::array<float,2>{0.181675956f, 0.93961215f},
-std::array<float,2>{0.587899268f, 0.106674455f},
-std::array<float,2>{0.393862426f, 0.061320819f},
-std::array<float,2>{0.831542432f, 0.91166234f},
-std::array<float,2>{0.0568715706f, 0.575157344f},
-std::array<float,2>{0.746345401f, 0.427613288f},
-std::array<float,2>{0.237311035f, 0.347949654f},
-std::array<float,2>{0.540886998f, 0.706877172f},
-std::array<float,2>{0.358587563f, 0.787001669f},
-std::array<float,2>{0.982090414f, 0.23180531f},
-std::array<float,2>{0.038451761f, 0.00148646266f},
-std::array<float,2>{0.719189048f, 0.895535827f},
-std::array<float,2>{0.382781833f, 0.605132222f},
-std::array<float,2>{0.818131685f, 0.383377403f},
-std::array<float,2>{0.368236601f, 0.331643999f},
-std::array<float,2>{0.987130046f, 0.733343601f},
-std::array<float,2>{0.220490694f, 0.764405847f},
-std::array<float,2>{0.547433853f, 0.194576368f},
-std::array<float,2>{0.439813852f, 0.170769751f},
-std::array<float,2>{0.771232009f, 0.873429239f},
-std::array<float,2>{0.072811f, 0.661823571f},
-std::array<float,2>{0.645322621f, 0.275545508f},
-std::array<float,2>{0.166911259f, 0.451891363f},
-std::array<float,2>{0.567684233f, 0.511563778f},
-std::array<float,2>{0.29409343f, 0.998496711f},
-std::array<float,2>{0.919256628f, 0.0736539736f},
-std::array<float,2>{0.209856302f, 0.237038985f},
-std::array<float,2>{0.50921464f, 0.799564779f},
-std::array<float,2>{0.333081394f, 0.694366455f},
-std::array<float,2>{0.968141556f, 0.370154172f},
-std::array<float,2>{0.407288641f, 0.413154572f},
-std::array<float,2>{0.858639836f, 0.584154367f},
-std::array<float,2>{0.017392939f, 0.927838206f},
-std::array<float,2>{0.711281955f, 0.0451690555f},
-std::array<float,2>{0.254742116f, 0.109634742f},
-std::array<float,2>{0.898618877f, 0.95921731f},
-std::array<float,2>{0.148505032f, 0.537173271f},
-std::array<float,2>{0.621527612f, 0.481520772f},
-std::array<float,2>{0.115528964f, 0.310188949f},
-std::array<float,2>{0.67908448f, 0.645784914f},
-std::array<float,2>{0.477164805f, 0.836666405f},
-std::array<float,2>{0.790123224f, 0.149062902f},
-std::array<float,2>{0.230842873f, 0.0329353586f},
-std::array<float,2>{0.56182152f, 0.936454713f},
-std::array<float,2>{0.364781022f, 0.58726424f},
-std::array<float,2>{0.992714882f, 0.417971969f},
-std::array<float,2>{0.384977669f, 0.360787272f},
-std::array<float,2>{0.825524509f, 0.697374165f},
-std::array<float,2>{0.0429833122f, 0.807868481f},
-std::array<float,2>{0.732363999f, 0.245592669f},
-std::array<float,2>{0.281523913f, 0.145711273f},
-std::array<float,2>{0.909264326f, 0.828449607f},
-std::array<float,2>{0.161661595f, 0.648903906f},
-std::array<float,2>{0.571989536f, 0.299096793f},
-std::array<float,2>{0.0689461157f, 0.474858016f},
-std::array<float,2>{0.652041554f, 0.540973306f},
-std::array<float,2>{0.448207021f, 0.962096512f},
-std::array<float,2>{0.77797085f, 0.123092644f},
-std::array<float,2>{0.0237103011f, 0.199395224f},
-std::array<float,2>{0.706323564f, 0.752087891f},
-std::array<float,2>{0.421321243f, 0.720304191f},
-std::array<float,2>{0.846334159f, 0.342230171f},
-std::array<float,2>{0.341022938f, 0.377290845f},
-std::array<float,2>{0.95740217f, 0.594356537f},
-std::array<float,2>{0.216374084f, 0.905312598f},
-std::array<float,2>{0.500907898f, 0.0117998952f},
-std::array<float,2>{0.474893421f, 0.0664086789f},
-std::array<float,2>{0.784974873f, 0.987038255f},
-std::array<float,2>{0.124581203f, 0.503828704f},
-std::array<float,2>{0.680055499f, 0.444118053f},
-std::array<float,2>{0.142153516f, 0.270759076f},
-std::array<float,2>{0.609477639f, 0.665641606f},
-std::array<float,2>{0.259436011f, 0.864328802f},
-std::array<float,2>{0.891946614f, 0.158247069f},
-std::array<float,2>{0.0942115933f, 0.0939915478f},
-std::array<float,2>{0.667312562f, 0.952655733f},
-std::array<float,2>{0.490980148f, 0.548534155f},
-std::array<float,2>{0.798907757f, 0.488322914f},
-std::array<float,2>{0.269115299f, 0.284237385f},
-std::array<float,2>{0.877185285f, 0.625621796f},
-std::array<float,2>{0.129930839f, 0.827513158f},
-std::array<float,2>{0.595386147f, 0.128992081f},
-std::array<float,2>{0.436472982f, 0.225676373f},
-std::array<float,2>{0.874185681f, 0.792200923f},
-std::array<float,2>{0.00513015501f, 0.71696353f},
-std::array<float,2>{0.690929532f, 0.358457595f},
-std::array<float,2>{0.191818938f, 0.430588007f},
-std::array<float,2>{0.516268671f, 0.565069079f},
-std::array<float,2>{0.32194072f, 0.914389431f},
-std::array<float,2>{0.950298905f, 0.0540843457f},
-std::array<float,2>{0.179542065f, 0.174914926f},
-std::array<float,2>{0.582806766f, 0.856408358f},
-std::array<float,2>{0.30186519f, 0.682039142f},
-std::array<float,2>{0.930040479f, 0.250549525f},
-std::array<float,2>{0.46776095f, 0.460946083f},
-std::array<float,2>{0.75900209f, 0.530591071f},
-std::array<float,2>{0.0868801028f, 0.977554679f},
-std::array<float,2>{0.632254303f, 0.0862184241f},
-std::array<float,2>{0.345927238f, 0.0201139171f},
-std::array<float,2>{0.971832693f, 0.883004963f},
-std::array<float,2>{0.245937169f, 0.617560208f},
-std::array<float,2>{0.532213271f, 0.398264676f},
-std::array<float,2>{0.0479694828f, 0.315515757f},
-std::array<float,2>{0.741764247f, 0.749403417f},
-std::array<float,2>{0.405481458f, 0.779631853f},
-std::array<float,2>{0.840515971f, 0.210231662f},
-std::array<float,2>{0.157523498f, 0.0260210391f},
-std::array<float,2>{0.578043759f, 0.87922734f},
-std::array<float,2>{0.287750781f, 0.612676978f},
-std::array<float,2>{0.912176311f, 0.402270854f},
-std::array<float,2>{0.450338989f, 0.325496465f},
-std::array<float,2>{0.777321279f, 0.740889013f},
-std::array<float,2>{0.065085955f, 0.769499719f},
-std::array<float,2>{0.653163493f, 0.216358051f},
-std::array<float,2>{0.360984564f, 0.182058051f},
-std::array<float,2>{0.997754335f, 0.843886316f},
-std::array<float,2>{0.228973284f, 0.679024696f},
-std::array<float,2>{0.556266308f, 0.263386697f},
-std::array<float,2>{0.040452823f, 0.458345979f},
-std::array<float,2>{0.727036595f, 0.521159708f},
-std::array<float,2>{0.387403905f, 0.972618103f},
-std::array<float,2>{0.823018551f, 0.0827630833f},
-std::array<float,2>{0.117905103f, 0.230349407f},
-std::array<float,2>{0.686856151f, 0.784398615f},
-std::array<float,2>{0.468909204f, 0.710812747f},
-std::array<float,2>{0.787365079f, 0.347075254f},
-std::array<float,2>{0.265270174f, 0.423672795f},
-std::array<float,2>{0.898428738f, 0.57365334f},
-std::array<float,2>{0.145639449f, 0.906423271f},
-std::array<float,2>{0.616580784f, 0.056899529f},
-std::array<float,2>{0.415107489f, 0.103485376f},
-std::array<float,2>{0.851443887f, 0.943279326f},
-std::array<float,2>{0.0306887012f, 0.561568975f},
-std::array<float,2>{0.709634364f, 0.494193584f},
-std::array<float,2>{0.211272508f, 0.293618798f},
-std::array<float,2>{0.5071311f, 0.640179813f},
-std::array<float,2>{0.337081373f, 0.812578976f},
-std::array<float,2>{0.957009137f, 0.134555101f},
-std::array<float,2>{0.000901883643f, 0.0768317431f},
-std::array<float,2>{0.693651795f, 0.993332088f},
-std::array<float,2>{0.432885915f, 0.512659967f},
-std::array<float,2>{0.869095266f, 0.446125269f},
-std::array<float,2>{0.324354768f, 0.278055131f},
-std::array<float,2>{0.947486401f, 0.657331407f},
-std::array<float,2>{0.188775435f, 0.869744837f},
-std::array<float,2>{0.522806287f, 0.167432472f},
-std::array<float,2>{0.487164527f, 0.189926937f},
-std::array<float,2>{0.801435709f, 0.75932163f},
-std::array<float,2>{0.0985290408f, 0.730156004f},
-std::array<float,2>{0.66855365f, 0.335894376f},
-std::array<float,2>{0.125488028f, 0.390054047f},
-std::array<float,2>{0.598903358f, 0.608352721f},
-std::array<float,2>{0.271042198f, 0.893477023f},
-std::array<float,2>{0.882444739f, 0.00726456428f},
-std::array<float,2>{0.247913167f, 0.154025897f},
-std::array<float,2>{0.538844645f, 0.842733443f},
-std::array<float,2>{0.348809719f, 0.641476631f},
-std::array<float,2>{0.974376023f, 0.30712682f},
-std::array<float,2>{0.399768561f, 0.479999453f},
-std::array<float,2>{0.836646557f, 0.533090413f},
-std::array<float,2>{0.0543658175f, 0.954582751f},
-std::array<float,2>{0.735179186f, 0.115305848f},
-std::array<float,2>{0.298609763f, 0.0416246578f},
-std::array<float,2>{0.934363782f, 0.92502743f},
-std::array<float,2>{0.173121661f, 0.578665435f},
-std::array<float,2>{0.580577135f, 0.409069538f},
-std::array<float,2>{0.0908497795f, 0.371648133f},
-std::array<float,2>{0.627904117f, 0.688259542f},
-std::array<float,2>{0.46311909f, 0.80435878f},
-std::array<float,2>{0.761832774f, 0.238500446f},
-std::array<float,2>{0.198641956f, 0.118517078f},
-std::array<float,2>{0.528883576f, 0.968355834f},
-std::array<float,2>{0.32013002f, 0.543258429f},
-std::array<float,2>{0.939330399f, 0.472435862f},
-std::array<float,2>{0.427340895f, 0.303076327f},
-std::array<float,2>{0.86460191f, 0.655372739f},
-std::array<float,2>{0.01213226f, 0.835917473f},
-std::array<float,2>{0.700810671f, 0.144240677f},
-std::array<float,2>{0.277032167f, 0.248962641f},
-std::array<float,2>{0.886692882f, 0.812411547f},
-std::array<float,2>{0.137874529f, 0.701477766f},
-std::array<float,2>{0.604622722f, 0.366062701f},
-std::array<float,2>{0.1047526f, 0.417031407f},
-std::array<float,2>{0.658731937f, 0.59089154f},
-std::array<float,2>{0.495201379f, 0.932734549f},
-std::array<float,2>{0.808585763f, 0.038366247f},
-std::array<float,2>{0.0615725704f, 0.161235422f},
-std::array<float,2>{0.742988348f, 0.861052275f},
-std::array<float,2>{0.395024687f, 0.671646714f},
-std::array<float,2>{0.834841728f, 0.269252956f},
-std::array<float,2>{0.352045149f, 0.438230544f},
-std::array<float,2>{0.979854882f, 0.504107773f},
-std::array<float,2>{0.238335922f, 0.99043417f},
-std::array<float,2>{0.545329094f, 0.0660117269f},
-std::array<float,2>{0.455505133f, 0.0109505132f},
-std::array<float,2>{0.755461991f, 0.901614368f},
-std::array<float,2>{0.0783972964f, 0.600041449f},
-std::array<float,2>{0.637666941f, 0.380532324f},
-std::array<float,2>{0.18553175f, 0.337895632f},
-std::array<float,2>{0.591091037f, 0.726118386f},
-std::array<float,2>{0.309417605f, 0.757372141f},
-std::array<float,2>{0.928442836f, 0.198276222f},
-std::array<float,2>{0.0753896981f, 0.0493511483f},
-std::array<float,2>{0.643760979f, 0.919941366f},
-std::array<float,2>{0.44365412f, 0.568396509f},
-std::array<float,2>{0.767198086f, 0.436344326f},
-std::array<float,2>{0.291535795f, 0.352077007f},
-std::array<float,2>{0.914213777f, 0.713321686f},
-std::array<float,2>{0.169295698f, 0.792985559f},
-std::array<float,2>{0.563668728f, 0.220459759f},
-std::array<float,2>{0.377201408f, 0.126203477f},
-std::array<float,2>{0.814155877f, 0.82063365f},
-std::array<float,2>{0.0317661129f, 0.632139206f},
-std::array<float,2>{0.725554585f, 0.286928415f},
-std::array<float,2>{0.226026863f, 0.486732543f},
-std::array<float,2>{0.554453015f, 0.551272988f},
-std::array<float,2>{0.371922791f, 0.945574462f},
-std::array<float,2>{0.992182076f, 0.0992474258f},
-std::array<float,2>{0.15576528f, 0.206109151f},
-std::array<float,2>{0.617300093f, 0.776138127f},
-std::array<float,2>{0.252382964f, 0.74375701f},
-std::array<float,2>{0.902495146f, 0.317463189f},
-std::array<float,2>{0.481009722f, 0.39234826f},
-std::array<float,2>{0.794050574f, 0.622574747f},
-std::array<float,2>{0.110681765f, 0.889284909f},
-std::array<float,2>{0.675102293f, 0.0176355187f},
-std::array<float,2>{0.331741661f, 0.090427205f},
-std::array<float,2>{0.961307704f, 0.981980324f},
-std::array<float,2>{0.205918089f, 0.525376379f},
-std::array<float,2>{0.513730586f, 0.466802865f},
-std::array<float,2>{0.0200180504f, 0.254400939f},
-std::array<float,2>{0.716638803f, 0.684524596f},
-std::array<float,2>{0.410781711f, 0.852708995f},
-std::array<float,2>{0.852341175f, 0.177610561f},
-std::array<float,2>{0.150061682f, 0.112287447f},
-std::array<float,2>{0.622324884f, 0.957222462f},
-std::array<float,2>{0.255800724f, 0.536047578f},
-std::array<float,2>{0.899571061f, 0.482617855f},
-std::array<float,2>{0.477613896f, 0.310563922f},
-std::array<float,2>{0.789879858f, 0.647715986f},
-std::array<float,2>{0.116275765f, 0.839095116f},
-std::array<float,2>{0.6785025f, 0.150446072f},
-std::array<float,2>{0.332360297f, 0.235404313f},
-std::array<float,2>{0.966903865f, 0.798206806f},
-std::array<float,2>{0.210107297f, 0.691852331f},
-std::array<float,2>{0.508684754f, 0.367691338f},
-std::array<float,2>{0.0163568687f, 0.412107944f},
-std::array<float,2>{0.712814033f, 0.582646012f},
-std::array<float,2>{0.406354487f, 0.925926685f},
-std::array<float,2>{0.858027041f, 0.0441955589f},
-std::array<float,2>{0.0734691545f, 0.168695748f},
-std::array<float,2>{0.645624101f, 0.872351646f},
-std::array<float,2>{0.441370547f, 0.662397265f},
-std::array<float,2>{0.770321906f, 0.274095178f},
-std::array<float,2>{0.293757141f, 0.450602651f},
-std::array<float,2>{0.918645024f, 0.509356618f},
-std::array<float,2>{0.167639241f, 0.997539341f},
-std::array<float,2>{0.567273259f, 0.0716949329f},
-std::array<float,2>{0.380877227f, 0.00375096314f},
-std::array<float,2>{0.816432893f, 0.896703601f},
-std::array<float,2>{0.037143141f, 0.602059126f},
-std::array<float,2>{0.720271587f, 0.386468798f},
-std::array<float,2>{0.219091177f, 0.328450352f},
-std::array<float,2>{0.548501909f, 0.730813622f},
-std::array<float,2>{0.367249399f, 0.763566852f},
-std::array<float,2>{0.987785101f, 0.191655129f},
-std::array<float,2>{0.0584009066f, 0.0593064763f},
-std::array<float,2>{0.747148573f, 0.912806094f},
-std::array<float,2>{0.39315778f, 0.57667923f},
-std::array<float,2>{0.830811739f, 0.428091168f},
-std::array<float,2>{0.358207881f, 0.350174397f},
-std::array<float,2>{0.980892539f, 0.705002964f},
-std::array<float,2>{0.237110898f, 0.788616061f},
-std::array<float,2>{0.539403677f, 0.23429586f},
-std::array<float,2>{0.46055612f, 0.139067113f},
-std::array<float,2>{0.751089334f, 0.817908168f},
-std::array<float,2>{0.0839090198f, 0.634554565f},
-std::array<float,2>{0.633965194f, 0.291610122f},
-std::array<float,2>{0.182683304f, 0.499769747f},
-std::array<float,2>{0.589823782f, 0.556826949f},
-std::array<float,2>{0.304691285f, 0.938118756f},
-std::array<float,2>{0.922363937f, 0.107968435f},
-std::array<float,2>{0.202940896f, 0.212711617f},
-std::array<float,2>{0.524144709f, 0.769933522f},
-std::array<float,2>{0.314522833f, 0.734549701f},
-std::array<float,2>{0.944739342f, 0.321872354f},
-std::array<float,2>{0.422257215f, 0.405201882f},
-std::array<float,2>{0.861887097f, 0.615196347f},
-std::array<float,2>{0.00811098609f, 0.878368676f},
-std::array<float,2>{0.696089625f, 0.0288759265f},
-std::array<float,2>{0.278642893f, 0.079075627f},
-std::array<float,2>{0.890018344f, 0.973874331f},
-std::array<float,2>{0.136239037f, 0.51906538f},
-std::array<float,2>{0.608972967f, 0.455566108f},
-std::array<float,2>{0.107234403f, 0.261191815f},
-std::array<float,2>{0.662170589f, 0.671992898f},
-std::array<float,2>{0.498362899f, 0.848154485f},
-std::array<float,2>{0.8108024f, 0.184254482f},
-std::array<float,2>{0.244746044f, 0.0223456454f},
-std::array<float,2>{0.532384217f, 0.885577261f},
-std::array<float,2>{0.346724033f, 0.619558454f},
-std::array<float,2>{0.971467793f, 0.395135224f},
-std::array<float,2>{0.404461384f, 0.314019233f},
-std::array<float,2>{0.840846837f, 0.747311771f},
-std::array<float,2>{0.0471827872f, 0.777374387f},
-std::array<float,2>{0.740689635f, 0.208098724f},
-std::array<float,2>{0.301581353f, 0.172360301f},
-std::array<float,2>{0.930756032f, 0.857732117f},
-std::array<float,2>{0.178199276f, 0.680461764f},
-std::array<float,2>{0.583744824f, 0.253068447f},
-std::array<float,2>{0.0875540152f, 0.463593304f},
-std::array<float,2>{0.631201625f, 0.528261662f},
-std::array<float,2>{0.468446255f, 0.980020225f},
-std::array<float,2>{0.75838393f, 0.0880282894f},
-std::array<float,2>{0.00402673241f, 0.223722756f},
-std::array<float,2>{0.689987421f, 0.790868342f},
-std::array<float,2>{0.436885595f, 0.715739787f},
-std::array<float,2>{0.87321794f, 0.356280863f},
-std::array<float,2>{0.320582777f, 0.432659864f},
-std::array<float,2>{0.949558616f, 0.563741505f},
-std::array<float,2>{0.192734405f, 0.917419314f},
-std::array<float,2>{0.517507851f, 0.0523665622f},
-std::array<float,2>{0.491289526f, 0.0972132757f},
-std::array<float,2>{0.799827754f, 0.950459957f},
-std::array<float,2>{0.0956989974f, 0.549433649f},
-std::array<float,2>{0.666357696f, 0.491732836f},
-std::array<float,2>{0.128959551f, 0.2826792f},
-std::array<float,2>{0.593765557f, 0.628168881f},
-std::array<float,2>{0.267849445f, 0.825361371f},
-std::array<float,2>{0.878073454f, 0.131962851f},
-std::array<float,2>{0.123928308f, 0.0691025779f},
-std::array<float,2>{0.681312263f, 0.986014545f},
-std::array<float,2>{0.476448298f, 0.500221312f},
-std::array<float,2>{0.783785641f, 0.44244501f},
-std::array<float,2>{0.25799486f, 0.27178821f},
-std::array<float,2>{0.891353071f, 0.666670322f},
-std::array<float,2>{0.140691504f, 0.867052019f},
-std::array<float,2>{0.610650957f, 0.158118039f},
-std::array<float,2>{0.420737505f, 0.201789469f},
-std::array<float,2>{0.846799552f, 0.750767887f},
-std::array<float,2>{0.0251062028f, 0.721459031f},
-std::array<float,2>{0.705119312f, 0.340006351f},
-std::array<float,2>{0.215768144f, 0.375814587f},
-std::array<float,2>{0.501179278f, 0.595873833f},
-std::array<float,2>{0.340280741f, 0.902386725f},
-std::array<float,2>{0.958327174f, 0.0156190172f},
-std::array<float,2>{0.160502806f, 0.147019953f},
-std::array<float,2>{0.571160793f, 0.830898046f},
-std::array<float,2>{0.282702923f, 0.652324736f},
-std::array<float,2>{0.909018993f, 0.297335804f},
-std::array<float,2>{0.449195117f, 0.473466814f},
-std::array<float,2>{0.779199302f, 0.54182148f},
-std::array<float,2>{0.0694881976f, 0.963163555f},
-std::array<float,2>{0.650464952f, 0.122882031f},
-std::array<float,2>{0.364115775f, 0.0351198837f},
-std::array<float,2>{0.993780911f, 0.934811234f},
-std::array<float,2>{0.231803134f, 0.589106262f},
-std::array<float,2>{0.561275423f, 0.42181164f},
-std::array<float,2>{0.0445235074f, 0.362257749f},
-std::array<float,2>{0.731249869f, 0.695831418f},
-std::array<float,2>{0.385793746f, 0.805848598f},
-std::array<float,2>{0.824469805f, 0.242384806f},
-std::array<float,2>{0.17233713f, 0.0402217135f},
-std::array<float,2>{0.581884205f, 0.923048913f},
-std::array<float,2>{0.296911895f, 0.58056736f},
-std::array<float,2>{0.934663534f, 0.40735811f},
-std::array<float,2>{0.464665502f, 0.373053491f},
-std::array<float,2>{0.763532102f, 0.690281749f},
-std::array<float,2>{0.090113841f, 0.80125469f},
-std::array<float,2>{0.628771484f, 0.241241693f},
-std::array<float,2>{0.347799361f, 0.155656517f},
-std::array<float,2>{0.973500729f, 0.840913534f},
-std::array<float,2>{0.246572658f, 0.642586946f},
-std::array<float,2>{0.537770927f, 0.306390524f},
-std::array<float,2>{0.0530380532f, 0.477832317f},
-std::array<float,2>{0.735512495f, 0.533400953f},
-std::array<float,2>{0.398632795f, 0.95656383f},
-std::array<float,2>{0.837876081f, 0.114219308f},
-std::array<float,2>{0.0994390249f, 0.188966453f},
-std::array<float,2>{0.669554293f, 0.760185421f},
-std::array<float,2>{0.487491965f, 0.726692915f},
-std::array<float,2>{0.802218854f, 0.333400875f},
-std::array<float,2>{0.269829184f, 0.387781411f},
-std::array<float,2>{0.881163597f, 0.606032848f},
-std::array<float,2>{0.126660392f, 0.890756309f},
-std::array<float,2>{0.598169982f, 0.0058073448f},
-std::array<float,2>{0.43192181f, 0.0756934956f},
-std::array<float,2>{0.86796838f, 0.995422602f},
-std::array<float,2>{0.00144894619f, 0.514745831f},
-std::array<float,2>{0.695042014f, 0.448779017f},
-std::array<float,2>{0.187718496f, 0.280603796f},
-std::array<float,2>{0.521860003f, 0.658628345f},
-std::array<float,2>{0.325312287f, 0.868489325f},
-std::array<float,2>{0.94833684f, 0.16560939f},
-std::array<float,2>{0.0301120132f, 0.104706094f},
-std::array<float,2>{0.710141122f, 0.943895876f},
-std::array<float,2>{0.414872706f, 0.558737457f},
-std::array<float,2>{0.8505162f, 0.492801756f},
-std::array<float,2>{0.336406469f, 0.29657957f},
-std::array<float,2>{0.955210805f, 0.637401342f},
-std::array<float,2>{0.212439403f, 0.815573156f},
-std::array<float,2>{0.506645977f, 0.135108188f},
-std::array<float,2>{0.470616043f, 0.227516428f},
-std::array<float,2>{0.789020598f, 0.781555116f},
-std::array<float,2>{0.118767425f, 0.708938837f},
-std::array<float,2>{0.686260164f, 0.34378463f},
-std::array<float,2>{0.144720331f, 0.424473852f},
-std::array<float,2>{0.615390301f, 0.571810961f},
-std::array<float,2>{0.264249951f, 0.908819079f},
-std::array<float,2>{0.897099555f, 0.0562735759f},
-std::array<float,2>{0.2295935f, 0.180338413f},
-std::array<float,2>{0.55553633f, 0.847203791f},
-std::array<float,2>{0.359973103f, 0.6769858f},
-std::array<float,2>{0.996532917f, 0.26526475f},
-std::array<float,2>{0.388582975f, 0.459698945f},
-std::array<float,2>{0.823546827f, 0.52240622f},
-std::array<float,2>{0.0394416675f, 0.97023505f},
-std::array<float,2>{0.727611065f, 0.0845211372f},
-std::array<float,2>{0.288433284f, 0.0252607111f},
-std::array<float,2>{0.913579345f, 0.881225049f},
-std::array<float,2>{0.156250566f, 0.610124648f},
-std::array<float,2>{0.576475084f, 0.398468077f},
-std::array<float,2>{0.0656264946f, 0.326816022f},
-std::array<float,2>{0.654138863f, 0.738411605f},
-std::array<float,2>{0.450047582f, 0.766543925f},
-std::array<float,2>{0.776313901f, 0.218035206f},
-std::array<float,2>{0.20626162f, 0.0922671333f},
-std::array<float,2>{0.515573442f, 0.983275294f},
-std::array<float,2>{0.330218047f, 0.525605917f},
-std::array<float,2>{0.962779522f, 0.464901954f},
-std::array<float,2>{0.412068784f, 0.257044673f},
-std::array<float,2>{0.852671087f, 0.685836852f},
-std::array<float,2>{0.0212129112f, 0.854000092f},
-std::array<float,2>{0.715699494f, 0.179311991f},
-std::array<float,2>{0.25385192f, 0.204784721f},
-std::array<float,2>{0.90377301f, 0.774237573f},
-std::array<float,2>{0.154580325f, 0.744207084f},
-std::array<float,2>{0.618443012f, 0.318702638f},
-std::array<float,2>{0.110261589f, 0.392897338f},
-std::array<float,2>{0.674683869f, 0.624625981f},
-std::array<float,2>{0.482338458f, 0.887995958f},
-std::array<float,2>{0.793146849f, 0.0161589794f},
-std::array<float,2>{0.0324815176f, 0.128826544f},
-std::array<float,2>{0.725619495f, 0.823557198f},
-std::array<float,2>{0.378387302f, 0.630023479f},
-std::array<float,2>{0.813380718f, 0.287818432f},
-std::array<float,2>{0.372175694f, 0.485318244f},
-std::array<float,2>{0.9903934f, 0.553598642f},
-std::array<float,2>{0.224613443f, 0.948886871f},
-std::array<float,2>{0.553528905f, 0.100848414f},
-std::array<float,2>{0.444880754f, 0.0477046557f},
-std::array<float,2>{0.766014814f, 0.918650508f},
-std::array<float,2>{0.0750831291f, 0.566592753f},
-std::array<float,2>{0.642591596f, 0.435066342f},
-std::array<float,2>{0.168540046f, 0.353857934f},
-std::array<float,2>{0.563403428f, 0.711238027f},
-std::array<float,2>{0.292782068f, 0.795338809f},
-std::array<float,2>{0.91519022f, 0.221250579f},
-std::array<float,2>{0.0792351514f, 0.00972241256f},
-std::array<float,2>{0.638157666f, 0.900281191f},
-std::array<float,2>{0.456156254f, 0.598951876f},
-std::array<float,2>{0.754413426f, 0.381431878f},
-std::array<float,2>{0.309678823f, 0.336915612f},
-std::array<float,2>{0.928930759f, 0.723924458f},
-std::array<float,2>{0.184090689f, 0.754403353f},
-std::array<float,2>{0.590111792f, 0.196805671f},
-std::array<float,2>{0.39614588f, 0.163230792f},
-std::array<float,2>{0.835803092f, 0.861569703f},
-std::array<float,2>{0.061328087f, 0.668546617f},
-std::array<float,2>{0.743493199f, 0.267410934f},
-std::array<float,2>{0.240078524f, 0.441316903f},
-std::array<float,2>{0.546794355f, 0.5067873f},
-std::array<float,2>{0.352973253f, 0.988923728f},
-std::array<float,2>{0.979111373f, 0.0640182793f},
-std::array<float,2>{0.137541652f, 0.246708974f},
-std::array<float,2>{0.60411793f, 0.810152173f},
-std::array<float,2>{0.275634676f, 0.701154113f},
-std::array<float,2>{0.885054708f, 0.364800274f},
-std::array<float,2>{0.494320869f, 0.415872186f},
-std::array<float,2>{0.806722343f, 0.593732893f},
-std::array<float,2>{0.104068629f, 0.93010515f},
-std::array<float,2>{0.660128534f, 0.0359243192f},
-std::array<float,2>{0.319266498f, 0.11987403f},
-std::array<float,2>{0.937806726f, 0.965923548f},
-std::array<float,2>{0.197386101f, 0.545203209f},
-std::array<float,2>{0.527987003f, 0.469928116f},
-std::array<float,2>{0.0134856571f, 0.30096072f},
-std::array<float,2>{0.699318886f, 0.65279454f},
-std::array<float,2>{0.426591516f, 0.832505941f},
-std::array<float,2>{0.863340378f, 0.142337725f},
-std::array<float,2>{0.164958373f, 0.072404325f},
-std::array<float,2>{0.570026696f, 0.999040961f},
-std::array<float,2>{0.296161085f, 0.509768963f},
-std::array<float,2>{0.921662569f, 0.452937126f},
-std::array<float,2>{0.438541621f, 0.276473254f},
-std::array<float,2>{0.773338974f, 0.660693824f},
-std::array<float,2>{0.0722185522f, 0.874865472f},
-std::array<float,2>{0.647626996f, 0.171289206f},
-std::array<float,2>{0.370858699f, 0.193828136f},
-std::array<float,2>{0.984686911f, 0.765547574f},
-std::array<float,2>{0.221676841f, 0.73394233f},
-std::array<float,2>{0.549728632f, 0.330474019f},
-std::array<float,2>{0.0353760198f, 0.383884907f},
-std::array<float,2>{0.722436368f, 0.603985965f},
-std::array<float,2>{0.379606307f, 0.89515233f},
-std::array<float,2>{0.819282949f, 0.000378673023f},
-std::array<float,2>{0.114305235f, 0.150129542f},
-std::array<float,2>{0.676154435f, 0.837100685f},
-std::array<float,2>{0.480316252f, 0.645397425f},
-std::array<float,2>{0.792115033f, 0.308666021f},
-std::array<float,2>{0.2565929f, 0.481363416f},
-std::array<float,2>{0.901588798f, 0.538869977f},
-std::array<float,2>{0.151340112f, 0.960129797f},
-std::array<float,2>{0.623608172f, 0.11081627f},
-std::array<float,2>{0.409879267f, 0.0459726043f},
-std::array<float,2>{0.856761634f, 0.929043055f},
-std::array<float,2>{0.017900737f, 0.58517009f},
-std::array<float,2>{0.714128435f, 0.412412584f},
-std::array<float,2>{0.208782077f, 0.369356155f},
-std::array<float,2>{0.509911597f, 0.693883777f},
-std::array<float,2>{0.335837573f, 0.799910128f},
-std::array<float,2>{0.965444922f, 0.238216132f},
-std::array<float,2>{0.0116489381f, 0.0304083824f},
-std::array<float,2>{0.698173285f, 0.875128627f},
-std::array<float,2>{0.423905224f, 0.617129326f},
-std::array<float,2>{0.860422671f, 0.402908027f},
-std::array<float,2>{0.314435452f, 0.322455138f},
-std::array<float,2>{0.942536414f, 0.73636502f},
-std::array<float,2>{0.200796008f, 0.77334857f},
-std::array<float,2>{0.526061654f, 0.21342285f},
-std::array<float,2>{0.496401489f, 0.18681556f},
-std::array<float,2>{0.809651911f, 0.850492895f},
-std::array<float,2>{0.108489379f, 0.67417717f},
-std::array<float,2>{0.661666453f, 0.258695036f},
-std::array<float,2>{0.133622751f, 0.453969777f},
-std::array<float,2>{0.605689287f, 0.517127395f},
-std::array<float,2>{0.281189591f, 0.975232005f},
-std::array<float,2>{0.887751698f, 0.0804530531f},
-std::array<float,2>{0.23568584f, 0.231265381f},
-std::array<float,2>{0.541815698f, 0.785287559f},
-std::array<float,2>{0.356260508f, 0.70576632f},
-std::array<float,2>{0.983007073f, 0.349436074f},
-std::array<float,2>{0.392171979f, 0.426647127f},
-std::array<float,2>{0.829583287f, 0.576118886f},
-std::array<float,2>{0.0551301166f, 0.910191953f},
-std::array<float,2>{0.749598384f, 0.0616171099f},
-std::array<float,2>{0.307746261f, 0.105611295f},
-std::array<float,2>{0.923952222f, 0.940678298f},
-std::array<float,2>{0.180180117f, 0.555482209f},
-std::array<float,2>{0.586605072f, 0.497300059f},
-std::array<float,2>{0.0847501904f, 0.290503711f},
-std::array<float,2>{0.635046661f, 0.635354817f},
-std::array<float,2>{0.457888663f, 0.81875217f},
-std::array<float,2>{0.752538681f, 0.137501761f},
-std::array<float,2>{0.193980545f, 0.0528527088f},
-std::array<float,2>{0.51777333f, 0.915748954f},
-std::array<float,2>{0.323803604f, 0.566149294f},
-std::array<float,2>{0.95229578f, 0.431330472f},
-std::array<float,2>{0.435187727f, 0.358273029f},
-std::array<float,2>{0.871410489f, 0.718249321f},
-std::array<float,2>{0.00668542972f, 0.791639447f},
-std::array<float,2>{0.687638581f, 0.224967211f},
-std::array<float,2>{0.266147763f, 0.130377054f},
-std::array<float,2>{0.876919508f, 0.826376021f},
-std::array<float,2>{0.132168487f, 0.626242876f},
-std::array<float,2>{0.597038507f, 0.283460557f},
-std::array<float,2>{0.0961118564f, 0.490162373f},
-std::array<float,2>{0.665773034f, 0.547561646f},
-std::array<float,2>{0.490116566f, 0.95130235f},
-std::array<float,2>{0.797761381f, 0.0950424522f},
-std::array<float,2>{0.0502014346f, 0.209069297f},
-std::array<float,2>{0.740227699f, 0.780355811f},
-std::array<float,2>{0.402635068f, 0.748529494f},
-std::array<float,2>{0.841981947f, 0.314825475f},
-std::array<float,2>{0.345196873f, 0.397141308f},
-std::array<float,2>{0.968754351f, 0.618889511f},
-std::array<float,2>{0.24308008f, 0.884747744f},
-std::array<float,2>{0.534647644f, 0.0213406663f},
-std::array<float,2>{0.46612975f, 0.0873788074f},
-std::array<float,2>{0.759860575f, 0.977001846f},
-std::array<float,2>{0.0880220383f, 0.529750824f},
-std::array<float,2>{0.629625857f, 0.462120861f},
-std::array<float,2>{0.177407727f, 0.251167506f},
-std::array<float,2>{0.585735857f, 0.683311343f},
-std::array<float,2>{0.303307295f, 0.857358515f},
-std::array<float,2>{0.933248997f, 0.174159616f},
-std::array<float,2>{0.0677670315f, 0.124361105f},
-std::array<float,2>{0.648933053f, 0.961765707f},
-std::array<float,2>{0.446286798f, 0.539239407f},
-std::array<float,2>{0.780469775f, 0.476243824f},
-std::array<float,2>{0.284430653f, 0.300319195f},
-std::array<float,2>{0.906307995f, 0.650110304f},
-std::array<float,2>{0.162162662f, 0.829155087f},
-std::array<float,2>{0.573503196f, 0.144914448f},
-std::array<float,2>{0.383229226f, 0.244208366f},
-std::array<float,2>{0.827407241f, 0.807528377f},
-std::array<float,2>{0.0462507606f, 0.698572934f},
-std::array<float,2>{0.732472599f, 0.359734893f},
-std::array<float,2>{0.233067229f, 0.419751316f},
-std::array<float,2>{0.560271621f, 0.586243868f},
-std::array<float,2>{0.365596682f, 0.936746776f},
-std::array<float,2>{0.995264292f, 0.0316284858f},
-std::array<float,2>{0.143254519f, 0.159938782f},
-std::array<float,2>{0.611828685f, 0.864190876f},
-std::array<float,2>{0.260785282f, 0.664113522f},
-std::array<float,2>{0.893154979f, 0.269825011f},
-std::array<float,2>{0.47345373f, 0.444662601f},
-std::array<float,2>{0.78253895f, 0.502154529f},
-std::array<float,2>{0.121131346f, 0.988217711f},
-std::array<float,2>{0.682802916f, 0.0674763843f},
-std::array<float,2>{0.342061758f, 0.0134634897f},
-std::array<float,2>{0.959707439f, 0.905205846f},
-std::array<float,2>{0.217896596f, 0.595420241f},
-std::array<float,2>{0.502670169f, 0.378720492f},
-std::array<float,2>{0.0256996416f, 0.34288767f},
-std::array<float,2>{0.703977346f, 0.719455004f},
-std::array<float,2>{0.418790609f, 0.75385505f},
-std::array<float,2>{0.845661581f, 0.200931191f},
-std::array<float,2>{0.128892154f, 0.00646265084f},
-std::array<float,2>{0.600743353f, 0.893872917f},
-std::array<float,2>{0.272922546f, 0.609281182f},
-std::array<float,2>{0.879490554f, 0.388791561f},
-std::array<float,2>{0.484831452f, 0.334346265f},
-std::array<float,2>{0.803712845f, 0.728867292f},
-std::array<float,2>{0.100979507f, 0.758232653f},
-std::array<float,2>{0.671794653f, 0.191192776f},
-std::array<float,2>{0.327465743f, 0.166976541f},
-std::array<float,2>{0.946275234f, 0.870699525f},
-std::array<float,2>{0.189800352f, 0.657196581f},
-std::array<float,2>{0.519800127f, 0.279024959f},
-std::array<float,2>{0.00364197814f, 0.446704417f},
-std::array<float,2>{0.692517161f, 0.512703717f},
-std::array<float,2>{0.430927068f, 0.99283582f},
-std::array<float,2>{0.870557189f, 0.0774173066f},
-std::array<float,2>{0.0932168663f, 0.240029678f},
-std::array<float,2>{0.625079453f, 0.803095639f},
-std::array<float,2>{0.461009473f, 0.689141989f},
-std::array<float,2>{0.764807403f, 0.372747421f},
-std::array<float,2>{0.299844742f, 0.410065651f},
-std::array<float,2>{0.936953485f, 0.579784036f},
-std::array<float,2>{0.173978403f, 0.924773991f},
-std::array<float,2>{0.579683959f, 0.0423863828f},
-std::array<float,2>{0.401147485f, 0.117046393f},
-std::array<float,2>{0.839321077f, 0.953391314f},
-std::array<float,2>{0.0526735522f, 0.531273067f},
-std::array<float,2>{0.736760795f, 0.4788118f},
-std::array<float,2>{0.249946773f, 0.307873547f},
-std::array<float,2>{0.536895216f, 0.641743064f},
-std::array<float,2>{0.351056248f, 0.8436957f},
-std::array<float,2>{0.975600302f, 0.153240412f},
-std::array<float,2>{0.0415361077f, 0.0833803937f},
-std::array<float,2>{0.729424894f, 0.970703959f},
-std::array<float,2>{0.38986665f, 0.519715786f},
-std::array<float,2>{0.82072556f, 0.457031578f},
-std::array<float,2>{0.362507939f, 0.26188904f},
-std::array<float,2>{0.999007463f, 0.678635597f},
-std::array<float,2>{0.22782895f, 0.844762623f},
-std::array<float,2>{0.557865739f, 0.182978943f},
-std::array<float,2>{0.452371389f, 0.215532228f},
-std::array<float,2>{0.773574293f, 0.767876983f},
-std::array<float,2>{0.0642274618f, 0.741363764f},
-std::array<float,2>{0.655556679f, 0.324829102f},
-std::array<float,2>{0.159079164f, 0.400714964f},
-std::array<float,2>{0.574381828f, 0.612247884f},
-std::array<float,2>{0.285354495f, 0.880853057f},
-std::array<float,2>{0.910550594f, 0.0267433915f},
-std::array<float,2>{0.213257715f, 0.133046657f},
-std::array<float,2>{0.504973948f, 0.814143777f},
-std::array<float,2>{0.337905228f, 0.639499426f},
-std::array<float,2>{0.953920662f, 0.294645965f},
-std::array<float,2>{0.417468786f, 0.495682478f},
-std::array<float,2>{0.84856832f, 0.561428189f},
-std::array<float,2>{0.0279053766f, 0.941437662f},
-std::array<float,2>{0.708001733f, 0.10225901f},
-std::array<float,2>{0.263619423f, 0.0580773838f},
-std::array<float,2>{0.89524579f, 0.907476783f},
-std::array<float,2>{0.147751674f, 0.572573483f},
-std::array<float,2>{0.614998519f, 0.421891719f},
-std::array<float,2>{0.119487688f, 0.346625865f},
-std::array<float,2>{0.685451746f, 0.709361136f},
-std::array<float,2>{0.471112967f, 0.784179449f},
-std::array<float,2>{0.786353707f, 0.228802428f},
-std::array<float,2>{0.223621055f, 0.0976800397f},
-std::array<float,2>{0.551157594f, 0.946965933f},
-std::array<float,2>{0.374366045f, 0.5521155f},
-std::array<float,2>{0.989857674f, 0.487939f},
-std::array<float,2>{0.375149339f, 0.28527835f},
-std::array<float,2>{0.815253973f, 0.631191373f},
-std::array<float,2>{0.0346524976f, 0.821448088f},
-std::array<float,2>{0.724268496f, 0.125424951f},
-std::array<float,2>{0.290109068f, 0.21940425f},
-std::array<float,2>{0.916142344f, 0.794160187f},
-std::array<float,2>{0.170865208f, 0.713884294f},
-std::array<float,2>{0.566072464f, 0.353028595f},
-std::array<float,2>{0.0773876607f, 0.436940908f},
-std::array<float,2>{0.641180217f, 0.570126712f},
-std::array<float,2>{0.441480696f, 0.921227098f},
-std::array<float,2>{0.768319964f, 0.0502309874f},
-std::array<float,2>{0.0224953704f, 0.176087335f},
-std::array<float,2>{0.718732178f, 0.852484703f},
-std::array<float,2>{0.413240433f, 0.685015619f},
-std::array<float,2>{0.853757203f, 0.255499303f},
-std::array<float,2>{0.329110056f, 0.468620032f},
-std::array<float,2>{0.963668227f, 0.524029672f},
-std::array<float,2>{0.204097003f, 0.981071949f},
-std::array<float,2>{0.512247384f, 0.0912841409f},
-std::array<float,2>{0.48407951f, 0.0191953052f},
-std::array<float,2>{0.795799196f, 0.89000833f},
-std::array<float,2>{0.111421183f, 0.621713698f},
-std::array<float,2>{0.672135234f, 0.39139533f},
-std::array<float,2>{0.153278783f, 0.31735599f},
-std::array<float,2>{0.620602787f, 0.743117213f},
-std::array<float,2>{0.251729757f, 0.776664734f},
-std::array<float,2>{0.904501498f, 0.205496639f},
-std::array<float,2>{0.102601439f, 0.0371872969f},
-std::array<float,2>{0.656694591f, 0.932002783f},
-std::array<float,2>{0.493925154f, 0.589958191f},
-std::array<float,2>{0.805733025f, 0.416148275f},
-std::array<float,2>{0.274326921f, 0.367160499f},
-std::array<float,2>{0.883558869f, 0.703095734f},
-std::array<float,2>{0.139672339f, 0.811240554f},
-std::array<float,2>{0.602336824f, 0.249383494f},
-std::array<float,2>{0.428858876f, 0.143110096f},
-std::array<float,2>{0.866652489f, 0.834702194f},
-std::array<float,2>{0.0152671235f, 0.655103087f},
-std::array<float,2>{0.702459157f, 0.304222971f},
-std::array<float,2>{0.196782887f, 0.471448213f},
-std::array<float,2>{0.531150937f, 0.544577241f},
-std::array<float,2>{0.31646508f, 0.967559218f},
-std::array<float,2>{0.939982355f, 0.117358714f},
-std::array<float,2>{0.187292174f, 0.197707266f},
-std::array<float,2>{0.592115521f, 0.756366193f},
-std::array<float,2>{0.311047167f, 0.725086451f},
-std::array<float,2>{0.926219165f, 0.339093179f},
-std::array<float,2>{0.453269869f, 0.379562676f},
-std::array<float,2>{0.755902231f, 0.600984633f},
-std::array<float,2>{0.0817437842f, 0.900548816f},
-std::array<float,2>{0.640590131f, 0.0104933931f},
-std::array<float,2>{0.354148328f, 0.0646603182f},
-std::array<float,2>{0.97839433f, 0.99167484f},
-std::array<float,2>{0.241281688f, 0.505538702f},
-std::array<float,2>{0.544903219f, 0.439267218f},
-std::array<float,2>{0.0587151237f, 0.268166065f},
-std::array<float,2>{0.745746672f, 0.670745671f},
-std::array<float,2>{0.397866249f, 0.859433055f},
-std::array<float,2>{0.83292681f, 0.161098778f},
-std::array<float,2>{0.175675631f, 0.113813199f},
-std::array<float,2>{0.578163326f, 0.956815243f},
-std::array<float,2>{0.299724251f, 0.533676684f},
-std::array<float,2>{0.936039627f, 0.47760585f},
-std::array<float,2>{0.462804705f, 0.30643791f},
-std::array<float,2>{0.764104068f, 0.643038332f},
-std::array<float,2>{0.0926629901f, 0.84108001f},
-std::array<float,2>{0.626828194f, 0.155366287f},
-std::array<float,2>{0.350150287f, 0.241558015f},
-std::array<float,2>{0.975406945f, 0.80086267f},
-std::array<float,2>{0.248527631f, 0.690063477f},
-std::array<float,2>{0.535323739f, 0.373457134f},
-std::array<float,2>{0.0509789623f, 0.407485306f},
-std::array<float,2>{0.738191545f, 0.580924392f},
-std::array<float,2>{0.402118385f, 0.9232108f},
-std::array<float,2>{0.838540852f, 0.0403141975f},
-std::array<float,2>{0.0999880955f, 0.165787235f},
-std::array<float,2>{0.670687616f, 0.868349791f},
-std::array<float,2>{0.485492051f, 0.658248067f},
-std::array<float,2>{0.803327918f, 0.280388743f},
-std::array<float,2>{0.272065163f, 0.448974848f},
-std::array<float,2>{0.879921436f, 0.514928043f},
-std::array<float,2>{0.127717629f, 0.995264232f},
-std::array<float,2>{0.600001693f, 0.0761048943f},
-std::array<float,2>{0.430107266f, 0.00541552436f},
-std::array<float,2>{0.869406939f, 0.891033173f},
-std::array<float,2>{0.00260936352f, 0.606310308f},
-std::array<float,2>{0.691522717f, 0.388104022f},
-std::array<float,2>{0.191231281f, 0.333185077f},
-std::array<float,2>{0.521176398f, 0.726931393f},
-std::array<float,2>{0.32647875f, 0.759882808f},
-std::array<float,2>{0.947196484f, 0.189446062f},
-std::array<float,2>{0.0290586147f, 0.0565063991f},
-std::array<float,2>{0.708909452f, 0.909024119f},
-std::array<float,2>{0.416903228f, 0.5721156f},
-std::array<float,2>{0.848767042f, 0.424622059f},
-std::array<float,2>{0.339144737f, 0.344037712f},
-std::array<float,2>{0.954391718f, 0.708716393f},
-std::array<float,2>{0.214396521f, 0.781346858f},
-std::array<float,2>{0.504734159f, 0.227106839f},
-std::array<float,2>{0.472352117f, 0.134931847f},
-std::array<float,2>{0.785776734f, 0.815688908f},
-std::array<float,2>{0.120612234f, 0.637628496f},
-std::array<float,2>{0.684361577f, 0.296797484f},
-std::array<float,2>{0.146532014f, 0.493106931f},
-std::array<float,2>{0.614216268f, 0.559047818f},
-std::array<float,2>{0.262190282f, 0.944151759f},
-std::array<float,2>{0.896016836f, 0.104831539f},
-std::array<float,2>{0.226874888f, 0.218015939f},
-std::array<float,2>{0.557452261f, 0.766162813f},
-std::array<float,2>{0.362223715f, 0.738751113f},
-std::array<float,2>{0.999531567f, 0.327113181f},
-std::array<float,2>{0.388779789f, 0.398862928f},
-std::array<float,2>{0.822140396f, 0.609877229f},
-std::array<float,2>{0.0429116264f, 0.881045282f},
-std::array<float,2>{0.7301898f, 0.0249864794f},
-std::array<float,2>{0.287065685f, 0.0847343281f},
-std::array<float,2>{0.911441147f, 0.97049731f},
-std::array<float,2>{0.159981713f, 0.522097707f},
-std::array<float,2>{0.576106608f, 0.459748179f},
-std::array<float,2>{0.0626548976f, 0.265411973f},
-std::array<float,2>{0.655272961f, 0.677151918f},
-std::array<float,2>{0.451534629f, 0.847592711f},
-std::array<float,2>{0.775000095f, 0.180568025f},
-std::array<float,2>{0.20411928f, 0.0163978525f},
-std::array<float,2>{0.513530672f, 0.887744784f},
-std::array<float,2>{0.3283104f, 0.624886453f},
-std::array<float,2>{0.964518547f, 0.392590731f},
-std::array<float,2>{0.412552804f, 0.318593353f},
-std::array<float,2>{0.854827046f, 0.744603872f},
-std::array<float,2>{0.022436006f, 0.773949146f},
-std::array<float,2>{0.717499554f, 0.20487079f},
-std::array<float,2>{0.250885904f, 0.179615244f},
-std::array<float,2>{0.906225801f, 0.853751063f},
-std::array<float,2>{0.153607801f, 0.685556412f},
-std::array<float,2>{0.619579315f, 0.257211983f},
-std::array<float,2>{0.113074526f, 0.465321481f},
-std::array<float,2>{0.673776567f, 0.525802016f},
-std::array<float,2>{0.483114958f, 0.982916892f},
-std::array<float,2>{0.796020031f, 0.092028074f},
-std::array<float,2>{0.0334436782f, 0.221548662f},
-std::array<float,2>{0.723417163f, 0.794935882f},
-std::array<float,2>{0.376703382f, 0.711151958f},
-std::array<float,2>{0.815505505f, 0.35351634f},
-std::array<float,2>{0.373326629f, 0.435518473f},
-std::array<float,2>{0.988468409f, 0.56670475f},
-std::array<float,2>{0.223649994f, 0.918760955f},
-std::array<float,2>{0.552167177f, 0.0473682135f},
-std::array<float,2>{0.443262339f, 0.100778148f},
-std::array<float,2>{0.768761277f, 0.948977411f},
-std::array<float,2>{0.076741308f, 0.553328454f},
-std::array<float,2>{0.642227471f, 0.484887183f},
-std::array<float,2>{0.171726882f, 0.287965059f},
-std::array<float,2>{0.565018713f, 0.630286396f},
-std::array<float,2>{0.289798856f, 0.823279858f},
-std::array<float,2>{0.917893708f, 0.128542036f},
-std::array<float,2>{0.080110319f, 0.0644179583f},
-std::array<float,2>{0.639447153f, 0.989120483f},
-std::array<float,2>{0.454534441f, 0.50634867f},
-std::array<float,2>{0.757077396f, 0.440952957f},
-std::array<float,2>{0.311975837f, 0.267325372f},
-std::array<float,2>{0.927215338f, 0.668772578f},
-std::array<float,2>{0.18588227f, 0.861805856f},
-std::array<float,2>{0.593237877f, 0.163517401f},
-std::array<float,2>{0.396644175f, 0.197134838f},
-std::array<float,2>{0.833317578f, 0.754726768f},
-std::array<float,2>{0.0599172078f, 0.723706722f},
-std::array<float,2>{0.74484992f, 0.337298959f},
-std::array<float,2>{0.240472749f, 0.381734818f},
-std::array<float,2>{0.543910742f, 0.598773956f},
-std::array<float,2>{0.354721755f, 0.900121212f},
-std::array<float,2>{0.977105081f, 0.00951866433f},
-std::array<float,2>{0.139219224f, 0.142206416f},
-std::array<float,2>{0.60285759f, 0.832139909f},
-std::array<float,2>{0.274562359f, 0.652530193f},
-std::array<float,2>{0.884011447f, 0.301148325f},
-std::array<float,2>{0.492584109f, 0.470121831f},
-std::array<float,2>{0.804790974f, 0.545120776f},
-std::array<float,2>{0.101919115f, 0.966096938f},
-std::array<float,2>{0.657371879f, 0.119739644f},
-std::array<float,2>{0.317416161f, 0.0357166938f},
-std::array<float,2>{0.94066304f, 0.929881692f},
-std::array<float,2>{0.196175277f, 0.593459547f},
-std::array<float,2>{0.529375017f, 0.415580213f},
-std::array<float,2>{0.0143467756f, 0.36511755f},
-std::array<float,2>{0.701803327f, 0.700694144f},
-std::array<float,2>{0.427898437f, 0.810337543f},
-std::array<float,2>{0.866196334f, 0.247068167f},
-std::array<float,2>{0.151979268f, 0.0440780893f},
-std::array<float,2>{0.624537587f, 0.926032901f},
-std::array<float,2>{0.256851673f, 0.582779825f},
-std::array<float,2>{0.90121758f, 0.411799639f},
-std::array<float,2>{0.479094148f, 0.368137985f},
-std::array<float,2>{0.79139322f, 0.691446006f},
-std::array<float,2>{0.113902591f, 0.797873139f},
-std::array<float,2>{0.676815391f, 0.235663101f},
-std::array<float,2>{0.334214061f, 0.150671169f},
-std::array<float,2>{0.966565073f, 0.839208603f},
-std::array<float,2>{0.207238987f, 0.647621989f},
-std::array<float,2>{0.510989428f, 0.310945988f},
-std::array<float,2>{0.0193436667f, 0.482725054f},
-std::array<float,2>{0.713768959f, 0.53566134f},
-std::array<float,2>{0.408528924f, 0.957442999f},
-std::array<float,2>{0.855783761f, 0.111837305f},
-std::array<float,2>{0.0708929896f, 0.191599056f},
-std::array<float,2>{0.647372067f, 0.763245583f},
-std::array<float,2>{0.437589556f, 0.730575621f},
-std::array<float,2>{0.77242589f, 0.328234464f},
-std::array<float,2>{0.295829684f, 0.386674345f},
-std::array<float,2>{0.92069304f, 0.602329433f},
-std::array<float,2>{0.165155813f, 0.896848083f},
-std::array<float,2>{0.56910634f, 0.00347833196f},
-std::array<float,2>{0.38053143f, 0.0715068653f},
-std::array<float,2>{0.820218742f, 0.997254014f},
-std::array<float,2>{0.0367282778f, 0.509681046f},
-std::array<float,2>{0.721116364f, 0.450385898f},
-std::array<float,2>{0.222352833f, 0.274242908f},
-std::array<float,2>{0.549811661f, 0.662252605f},
-std::array<float,2>{0.369466901f, 0.872210681f},
-std::array<float,2>{0.9856866f, 0.168831185f},
-std::array<float,2>{0.0558437183f, 0.108192794f},
-std::array<float,2>{0.748213112f, 0.938351095f},
-std::array<float,2>{0.391087472f, 0.556948543f},
-std::array<float,2>{0.828478515f, 0.499679178f},
-std::array<float,2>{0.356595337f, 0.291768223f},
-std::array<float,2>{0.983674109f, 0.634489238f},
-std::array<float,2>{0.234770015f, 0.818350792f},
-std::array<float,2>{0.54292655f, 0.138689741f},
-std::array<float,2>{0.45822528f, 0.233898133f},
-std::array<float,2>{0.753497958f, 0.788897395f},
-std::array<float,2>{0.0859023556f, 0.704724133f},
-std::array<float,2>{0.636146128f, 0.350512892f},
-std::array<float,2>{0.181239516f, 0.427844584f},
-std::array<float,2>{0.587660849f, 0.57703656f},
-std::array<float,2>{0.307249725f, 0.912939608f},
-std::array<float,2>{0.924815238f, 0.0594974123f},
-std::array<float,2>{0.199271724f, 0.184347123f},
-std::array<float,2>{0.526771545f, 0.848627388f},
-std::array<float,2>{0.313274086f, 0.672197461f},
-std::array<float,2>{0.941827416f, 0.260870278f},
-std::array<float,2>{0.425081432f, 0.455124676f},
-std::array<float,2>{0.860152543f, 0.519428015f},
-std::array<float,2>{0.0106751472f, 0.974018931f},
-std::array<float,2>{0.69837755f, 0.0788177103f},
-std::array<float,2>{0.279921919f, 0.0291701686f},
-std::array<float,2>{0.887202263f, 0.878127635f},
-std::array<float,2>{0.133979574f, 0.614885688f},
-std::array<float,2>{0.607024014f, 0.404855609f},
-std::array<float,2>{0.108134605f, 0.322093666f},
-std::array<float,2>{0.660904765f, 0.734780252f},
-std::array<float,2>{0.497370094f, 0.769677222f},
-std::array<float,2>{0.808636129f, 0.21244286f},
-std::array<float,2>{0.243658453f, 0.0882202387f},
-std::array<float,2>{0.53334868f, 0.980281174f},
-std::array<float,2>{0.34378764f, 0.527898848f},
-std::array<float,2>{0.970163047f, 0.463749677f},
-std::array<float,2>{0.403669208f, 0.253278404f},
-std::array<float,2>{0.843483984f, 0.680379272f},
-std::array<float,2>{0.0489936732f, 0.85747683f},
-std::array<float,2>{0.73924315f, 0.172006205f},
-std::array<float,2>{0.303963721f, 0.208305284f},
-std::array<float,2>{0.931891441f, 0.777602434f},
-std::array<float,2>{0.176489726f, 0.747557878f},
-std::array<float,2>{0.584625661f, 0.314222932f},
-std::array<float,2>{0.0889314413f, 0.395445019f},
-std::array<float,2>{0.630595326f, 0.619204462f},
-std::array<float,2>{0.465553373f, 0.885488451f},
-std::array<float,2>{0.760935545f, 0.0220798478f},
-std::array<float,2>{0.00749259535f, 0.132081553f},
-std::array<float,2>{0.688565254f, 0.825557828f},
-std::array<float,2>{0.433993071f, 0.628288805f},
-std::array<float,2>{0.87216264f, 0.282462031f},
-std::array<float,2>{0.322893232f, 0.492033154f},
-std::array<float,2>{0.951850057f, 0.549680889f},
-std::array<float,2>{0.19507347f, 0.950239599f},
-std::array<float,2>{0.519115329f, 0.0975200981f},
-std::array<float,2>{0.48841241f, 0.0527119637f},
-std::array<float,2>{0.798798621f, 0.917160034f},
-std::array<float,2>{0.0975367129f, 0.563666999f},
-std::array<float,2>{0.664423704f, 0.432874143f},
-std::array<float,2>{0.130880892f, 0.356090486f},
-std::array<float,2>{0.596276402f, 0.715426683f},
-std::array<float,2>{0.26679951f, 0.790549517f},
-std::array<float,2>{0.875424027f, 0.22402589f},
-std::array<float,2>{0.122181848f, 0.0153122591f},
-std::array<float,2>{0.681973696f, 0.902746081f},
-std::array<float,2>{0.473801374f, 0.596043289f},
-std::array<float,2>{0.781712234f, 0.375622362f},
-std::array<float,2>{0.260302037f, 0.340168715f},
-std::array<float,2>{0.893883467f, 0.72135359f},
-std::array<float,2>{0.143885761f, 0.750691533f},
-std::array<float,2>{0.612919569f, 0.202097222f},
-std::array<float,2>{0.419903547f, 0.157935649f},
-std::array<float,2>{0.843903184f, 0.866750896f},
-std::array<float,2>{0.0269669406f, 0.666850924f},
-std::array<float,2>{0.704694688f, 0.271565557f},
-std::array<float,2>{0.21763581f, 0.442674398f},
-std::array<float,2>{0.503727674f, 0.50046581f},
-std::array<float,2>{0.343693674f, 0.986246943f},
-std::array<float,2>{0.960157573f, 0.0690766573f},
-std::array<float,2>{0.163890556f, 0.242451295f},
-std::array<float,2>{0.572363317f, 0.806104839f},
-std::array<float,2>{0.283506662f, 0.696273506f},
-std::array<float,2>{0.907935917f, 0.36191383f},
-std::array<float,2>{0.446362793f, 0.421421111f},
-std::array<float,2>{0.779316425f, 0.589203537f},
-std::array<float,2>{0.0666556433f, 0.934952497f},
-std::array<float,2>{0.649784029f, 0.034726426f},
-std::array<float,2>{0.366946906f, 0.12272732f},
-std::array<float,2>{0.994918168f, 0.96290499f},
-std::array<float,2>{0.234206229f, 0.54170841f},
-std::array<float,2>{0.558887184f, 0.473308235f},
-std::array<float,2>{0.0456761606f, 0.296949238f},
-std::array<float,2>{0.734198391f, 0.652053952f},
-std::array<float,2>{0.383802354f, 0.83064723f},
-std::array<float,2>{0.826613069f, 0.14734675f},
-std::array<float,2>{0.125892729f, 0.0773092508f},
-std::array<float,2>{0.59934932f, 0.992970467f},
-std::array<float,2>{0.270938873f, 0.51295954f},
-std::array<float,2>{0.88190186f, 0.446403384f},
-std::array<float,2>{0.486639887f, 0.279219538f},
-std::array<float,2>{0.801042676f, 0.656871498f},
-std::array<float,2>{0.097857967f, 0.870984793f},
-std::array<float,2>{0.668377459f, 0.166588351f},
-std::array<float,2>{0.324731827f, 0.191040754f},
-std::array<float,2>{0.947897077f, 0.757985532f},
-std::array<float,2>{0.189058796f, 0.728585303f},
-std::array<float,2>{0.523274064f, 0.334111422f},
-std::array<float,2>{0.000412357738f, 0.389045954f},
-std::array<float,2>{0.693920732f, 0.609008551f},
-std::array<float,2>{0.433361322f, 0.893788815f},
-std::array<float,2>{0.868320286f, 0.00661134161f},
-std::array<float,2>{0.0917362422f, 0.152990237f},
-std::array<float,2>{0.62716186f, 0.843389153f},
-std::array<float,2>{0.463590086f, 0.642036736f},
-std::array<float,2>{0.762237966f, 0.307860792f},
-std::array<float,2>{0.297906935f, 0.478686333f},
-std::array<float,2>{0.933706105f, 0.531587124f},
-std::array<float,2>{0.17335254f, 0.953180194f},
-std::array<float,2>{0.58051002f, 0.11675144f},
-std::array<float,2>{0.399978518f, 0.0420743413f},
-std::array<float,2>{0.836264372f, 0.92435956f},
-std::array<float,2>{0.0538326874f, 0.579894423f},
-std::array<float,2>{0.734527349f, 0.409759015f},
-std::array<float,2>{0.247309491f, 0.373019636f},
-std::array<float,2>{0.538262904f, 0.689444482f},
-std::array<float,2>{0.349383235f, 0.802838802f},
-std::array<float,2>{0.973979771f, 0.23991558f},
-std::array<float,2>{0.040900778f, 0.0266021751f},
-std::array<float,2>{0.727533042f, 0.880474627f},
-std::array<float,2>{0.386939824f, 0.612034261f},
-std::array<float,2>{0.822395682f, 0.400560528f},
-std::array<float,2>{0.360411853f, 0.325122595f},
-std::array<float,2>{0.997315466f, 0.741588771f},
-std::array<float,2>{0.22933048f, 0.767606914f},
-std::array<float,2>{0.555919826f, 0.215595722f},
-std::array<float,2>{0.450792283f, 0.182822108f},
-std::array<float,2>{0.776606202f, 0.845085561f},
-std::array<float,2>{0.0647222027f, 0.678289294f},
-std::array<float,2>{0.652373314f, 0.261972308f},
-std::array<float,2>{0.158107534f, 0.457339942f},
-std::array<float,2>{0.577229142f, 0.51977545f},
-std::array<float,2>{0.287201345f, 0.971089303f},
-std::array<float,2>{0.912757397f, 0.0831457078f},
-std::array<float,2>{0.211913541f, 0.228665262f},
-std::array<float,2>{0.507726431f, 0.783876896f},
-std::array<float,2>{0.33741948f, 0.709115148f},
-std::array<float,2>{0.956489682f, 0.346226066f},
-std::array<float,2>{0.415833771f, 0.422241688f},
-std::array<float,2>{0.850831568f, 0.572320521f},
-std::array<float,2>{0.0308298897f, 0.907348096f},
-std::array<float,2>{0.709070146f, 0.0578550287f},
-std::array<float,2>{0.264773756f, 0.102440618f},
-std::array<float,2>{0.8977139f, 0.941824198f},
-std::array<float,2>{0.146223128f, 0.561143517f},
-std::array<float,2>{0.616897345f, 0.496033102f},
-std::array<float,2>{0.117192484f, 0.294737637f},
-std::array<float,2>{0.687256455f, 0.639392614f},
-std::array<float,2>{0.469551742f, 0.814301014f},
-std::array<float,2>{0.787965894f, 0.13313812f},
-std::array<float,2>{0.226192579f, 0.0498054661f},
-std::array<float,2>{0.554046273f, 0.921120167f},
-std::array<float,2>{0.371364385f, 0.569841564f},
-std::array<float,2>{0.991675198f, 0.436585546f},
-std::array<float,2>{0.377790481f, 0.353440374f},
-std::array<float,2>{0.813666463f, 0.714142084f},
-std::array<float,2>{0.0313490629f, 0.794385552f},
-std::array<float,2>{0.724794209f, 0.219576791f},
-std::array<float,2>{0.291223079f, 0.125100702f},
-std::array<float,2>{0.914687872f, 0.82173723f},
-std::array<float,2>{0.169461384f, 0.631039858f},
-std::array<float,2>{0.564194798f, 0.285454869f},
-std::array<float,2>{0.0757397562f, 0.488134116f},
-std::array<float,2>{0.644402683f, 0.551976323f},
-std::array<float,2>{0.444091529f, 0.947096169f},
-std::array<float,2>{0.76673907f, 0.0980597138f},
-std::array<float,2>{0.0204363335f, 0.205292597f},
-std::array<float,2>{0.715934277f, 0.776436388f},
-std::array<float,2>{0.410431862f, 0.742805362f},
-std::array<float,2>{0.851601839f, 0.317121089f},
-std::array<float,2>{0.331300497f, 0.391212791f},
-std::array<float,2>{0.961554825f, 0.621922672f},
-std::array<float,2>{0.205268711f, 0.889889657f},
-std::array<float,2>{0.514270842f, 0.0193726234f},
-std::array<float,2>{0.480754793f, 0.0908457339f},
-std::array<float,2>{0.794911563f, 0.981300592f},
-std::array<float,2>{0.11103148f, 0.524406552f},
-std::array<float,2>{0.675553381f, 0.468335956f},
-std::array<float,2>{0.155535161f, 0.255846977f},
-std::array<float,2>{0.618144453f, 0.684720218f},
-std::array<float,2>{0.252615273f, 0.852215707f},
-std::array<float,2>{0.90322262f, 0.175820515f},
-std::array<float,2>{0.105279803f, 0.117560424f},
-std::array<float,2>{0.658529878f, 0.967302382f},
-std::array<float,2>{0.495949984f, 0.544818044f},
-std::array<float,2>{0.807919502f, 0.471352696f},
-std::array<float,2>{0.276462227f, 0.30466181f},
-std::array<float,2>{0.885989606f, 0.654858053f},
-std::array<float,2>{0.138233691f, 0.834904432f},
-std::array<float,2>{0.605245292f, 0.143463284f},
-std::array<float,2>{0.426963449f, 0.249026865f},
-std::array<float,2>{0.865029693f, 0.811463892f},
-std::array<float,2>{0.012307575f, 0.702851772f},
-std::array<float,2>{0.700608313f, 0.366839528f},
-std::array<float,2>{0.1990567f, 0.416406751f},
-std::array<float,2>{0.528584838f, 0.590267181f},
-std::array<float,2>{0.319775224f, 0.93181926f},
-std::array<float,2>{0.938859224f, 0.0374001376f},
-std::array<float,2>{0.184687093f, 0.160742551f},
-std::array<float,2>{0.591589272f, 0.859856844f},
-std::array<float,2>{0.308798045f, 0.670413852f},
-std::array<float,2>{0.928166568f, 0.268405497f},
-std::array<float,2>{0.455694884f, 0.439169586f},
-std::array<float,2>{0.755288422f, 0.505656958f},
-std::array<float,2>{0.0790717974f, 0.991386116f},
-std::array<float,2>{0.637097538f, 0.0647766441f},
-std::array<float,2>{0.352210045f, 0.0105448645f},
-std::array<float,2>{0.980353475f, 0.900765777f},
-std::array<float,2>{0.239090279f, 0.600675166f},
-std::array<float,2>{0.545558214f, 0.379861325f},
-std::array<float,2>{0.0624470413f, 0.339149266f},
-std::array<float,2>{0.742630422f, 0.72464323f},
-std::array<float,2>{0.394763619f, 0.7566185f},
-std::array<float,2>{0.834025085f, 0.197487652f},
-std::array<float,2>{0.166101292f, 0.000234441759f},
-std::array<float,2>{0.568092585f, 0.895415246f},
-std::array<float,2>{0.294555247f, 0.603548884f},
-std::array<float,2>{0.919810116f, 0.384134322f},
-std::array<float,2>{0.440417558f, 0.330104828f},
-std::array<float,2>{0.770756364f, 0.734341741f},
-std::array<float,2>{0.072683312f, 0.765212953f},
-std::array<float,2>{0.644649029f, 0.193378046f},
-std::array<float,2>{0.368953019f, 0.170967311f},
-std::array<float,2>{0.986654341f, 0.874670684f},
-std::array<float,2>{0.220010445f, 0.661089003f},
-std::array<float,2>{0.547226489f, 0.276800185f},
-std::array<float,2>{0.0388294905f, 0.452873766f},
-std::array<float,2>{0.719250083f, 0.510051608f},
-std::array<float,2>{0.381843984f, 0.999445796f},
-std::array<float,2>{0.81775856f, 0.0726758093f},
-std::array<float,2>{0.115801141f, 0.237945825f},
-std::array<float,2>{0.679372251f, 0.800124168f},
-std::array<float,2>{0.47685042f, 0.69412595f},
-std::array<float,2>{0.790910721f, 0.369409502f},
-std::array<float,2>{0.254207879f, 0.412300706f},
-std::array<float,2>{0.899024904f, 0.58537966f},
-std::array<float,2>{0.149402782f, 0.928744078f},
-std::array<float,2>{0.621951222f, 0.0463177972f},
-std::array<float,2>{0.407848835f, 0.11038854f},
-std::array<float,2>{0.859122276f, 0.960240781f},
-std::array<float,2>{0.0168059524f, 0.538626492f},
-std::array<float,2>{0.711720407f, 0.481163293f},
-std::array<float,2>{0.209290504f, 0.309000373f},
-std::array<float,2>{0.509737313f, 0.64518249f},
-std::array<float,2>{0.333827555f, 0.837241352f},
-std::array<float,2>{0.968691289f, 0.150151804f},
-std::array<float,2>{0.00888054352f, 0.0802402422f},
-std::array<float,2>{0.69698602f, 0.975366175f},
-std::array<float,2>{0.423612624f, 0.517405033f},
-std::array<float,2>{0.863044322f, 0.453701258f},
-std::array<float,2>{0.315508723f, 0.258364201f},
-std::array<float,2>{0.943494558f, 0.673943162f},
-std::array<float,2>{0.202030525f, 0.850257456f},
-std::array<float,2>{0.524561107f, 0.186656684f},
-std::array<float,2>{0.499487132f, 0.213767797f},
-std::array<float,2>{0.811881721f, 0.773028791f},
-std::array<float,2>{0.105626427f, 0.73673135f},
-std::array<float,2>{0.663627148f, 0.322600067f},
-std::array<float,2>{0.135682702f, 0.403134704f},
-std::array<float,2>{0.607863128f, 0.616764665f},
-std::array<float,2>{0.27749604f, 0.875450313f},
-std::array<float,2>{0.88872999f, 0.0306887794f},
-std::array<float,2>{0.237826332f, 0.137372836f},
-std::array<float,2>{0.540446997f, 0.818547428f},
-std::array<float,2>{0.359039813f, 0.635586619f},
-std::array<float,2>{0.981639266f, 0.290168643f},
-std::array<float,2>{0.394308507f, 0.497530311f},
-std::array<float,2>{0.831771493f, 0.555363059f},
-std::array<float,2>{0.0575933605f, 0.940441191f},
-std::array<float,2>{0.746799052f, 0.105823703f},
-std::array<float,2>{0.306173414f, 0.0618966557f},
-std::array<float,2>{0.923548639f, 0.910552025f},
-std::array<float,2>{0.182321265f, 0.575702071f},
-std::array<float,2>{0.588745952f, 0.426491231f},
-std::array<float,2>{0.0820723921f, 0.349272341f},
-std::array<float,2>{0.632842302f, 0.705872655f},
-std::array<float,2>{0.459242821f, 0.78540355f},
-std::array<float,2>{0.750231206f, 0.231005311f},
-std::array<float,2>{0.192061126f, 0.0949498713f},
-std::array<float,2>{0.515904009f, 0.951423943f},
-std::array<float,2>{0.321768701f, 0.54775095f},
-std::array<float,2>{0.95107162f, 0.489877909f},
-std::array<float,2>{0.435729891f, 0.283250242f},
-std::array<float,2>{0.874905229f, 0.626047075f},
-std::array<float,2>{0.00565267913f, 0.826442838f},
-std::array<float,2>{0.690882921f, 0.13071838f},
-std::array<float,2>{0.269017994f, 0.224722803f},
-std::array<float,2>{0.877518952f, 0.791937888f},
-std::array<float,2>{0.130705327f, 0.717784524f},
-std::array<float,2>{0.594878078f, 0.358144253f},
-std::array<float,2>{0.0943610519f, 0.431487471f},
-std::array<float,2>{0.667706907f, 0.566366732f},
-std::array<float,2>{0.490638703f, 0.915862322f},
-std::array<float,2>{0.799584925f, 0.0532125719f},
-std::array<float,2>{0.0485004894f, 0.173997194f},
-std::array<float,2>{0.741515875f, 0.857173324f},
-std::array<float,2>{0.405829817f, 0.68341291f},
-std::array<float,2>{0.83992362f, 0.251275748f},
-std::array<float,2>{0.346596658f, 0.462367117f},
-std::array<float,2>{0.972181439f, 0.529326737f},
-std::array<float,2>{0.245378628f, 0.976798475f},
-std::array<float,2>{0.531654298f, 0.0870792344f},
-std::array<float,2>{0.467262477f, 0.021049777f},
-std::array<float,2>{0.759624541f, 0.884432852f},
-std::array<float,2>{0.086075455f, 0.618910134f},
-std::array<float,2>{0.632682383f, 0.397316903f},
-std::array<float,2>{0.178998411f, 0.314571768f},
-std::array<float,2>{0.582088888f, 0.748165488f},
-std::array<float,2>{0.302630395f, 0.780665815f},
-std::array<float,2>{0.930391848f, 0.209427655f},
-std::array<float,2>{0.0688413456f, 0.0313566662f},
-std::array<float,2>{0.651822209f, 0.936924815f},
-std::array<float,2>{0.447425038f, 0.586127341f},
-std::array<float,2>{0.777368307f, 0.419458359f},
-std::array<float,2>{0.282094687f, 0.35956648f},
-std::array<float,2>{0.909977853f, 0.698419929f},
-std::array<float,2>{0.161434323f, 0.807134569f},
-std::array<float,2>{0.571714342f, 0.244552806f},
-std::array<float,2>{0.385692149f, 0.144676313f},
-std::array<float,2>{0.826030731f, 0.829551339f},
-std::array<float,2>{0.0436764657f, 0.650315344f},
-std::array<float,2>{0.731847763f, 0.300691307f},
-std::array<float,2>{0.230965912f, 0.476380378f},
-std::array<float,2>{0.562122107f, 0.539401233f},
-std::array<float,2>{0.364662707f, 0.961628973f},
-std::array<float,2>{0.992271245f, 0.124206595f},
-std::array<float,2>{0.141659722f, 0.200812861f},
-std::array<float,2>{0.609967291f, 0.753637552f},
-std::array<float,2>{0.258803904f, 0.719715059f},
-std::array<float,2>{0.892420232f, 0.343191475f},
-std::array<float,2>{0.475522876f, 0.378608733f},
-std::array<float,2>{0.784479439f, 0.595545053f},
-std::array<float,2>{0.124507196f, 0.904804587f},
-std::array<float,2>{0.680199504f, 0.0132056f},
-std::array<float,2>{0.341738403f, 0.0676803738f},
-std::array<float,2>{0.957550764f, 0.987817764f},
-std::array<float,2>{0.215825945f, 0.502426147f},
-std::array<float,2>{0.500216424f, 0.444338053f},
-std::array<float,2>{0.0241319817f, 0.269761026f},
-std::array<float,2>{0.706660092f, 0.664471924f},
-std::array<float,2>{0.421439677f, 0.86384213f},
-std::array<float,2>{0.845775068f, 0.15984799f},
-std::array<float,2>{0.145056754f, 0.10359887f},
-std::array<float,2>{0.615772188f, 0.945032537f},
-std::array<float,2>{0.26400733f, 0.559642315f},
-std::array<float,2>{0.896864891f, 0.493897498f},
-std::array<float,2>{0.469971716f, 0.295598686f},
-std::array<float,2>{0.788159788f, 0.637815833f},
-std::array<float,2>{0.118192717f, 0.814505398f},
-std::array<float,2>{0.685991108f, 0.136020392f},
-std::array<float,2>{0.336818427f, 0.227801919f},
-std::array<float,2>{0.95578897f, 0.782751679f},
-std::array<float,2>{0.212131217f, 0.707084596f},
-std::array<float,2>{0.506055176f, 0.344784886f},
-std::array<float,2>{0.0295043085f, 0.425736457f},
-std::array<float,2>{0.710563302f, 0.570535541f},
-std::array<float,2>{0.414282441f, 0.909536898f},
-std::array<float,2>{0.849984288f, 0.0553347729f},
-std::array<float,2>{0.0660021529f, 0.181039974f},
-std::array<float,2>{0.653652966f, 0.845819294f},
-std::array<float,2>{0.449279368f, 0.676084757f},
-std::array<float,2>{0.775736928f, 0.263726652f},
-std::array<float,2>{0.288974524f, 0.460069448f},
-std::array<float,2>{0.913225412f, 0.523402095f},
-std::array<float,2>{0.156956896f, 0.968926311f},
-std::array<float,2>{0.577132702f, 0.085599646f},
-std::array<float,2>{0.387771279f, 0.0240265206f},
-std::array<float,2>{0.823945642f, 0.882403851f},
-std::array<float,2>{0.0396447442f, 0.610674262f},
-std::array<float,2>{0.728103817f, 0.400344491f},
-std::array<float,2>{0.230284676f, 0.327828616f},
-std::array<float,2>{0.554937363f, 0.740042806f},
-std::array<float,2>{0.359466642f, 0.766907275f},
-std::array<float,2>{0.996899843f, 0.216907352f},
-std::array<float,2>{0.0534447171f, 0.0393387005f},
-std::array<float,2>{0.735857666f, 0.922808886f},
-std::array<float,2>{0.399196565f, 0.581719816f},
-std::array<float,2>{0.837296724f, 0.406528592f},
-std::array<float,2>{0.348188996f, 0.374894708f},
-std::array<float,2>{0.973035634f, 0.691211164f},
-std::array<float,2>{0.246992782f, 0.801979959f},
-std::array<float,2>{0.537566185f, 0.240907878f},
-std::array<float,2>{0.463968426f, 0.155132532f},
-std::array<float,2>{0.76314801f, 0.839905858f},
-std::array<float,2>{0.0907653198f, 0.643794894f},
-std::array<float,2>{0.628151298f, 0.305484176f},
-std::array<float,2>{0.172484055f, 0.47666499f},
-std::array<float,2>{0.581161022f, 0.534763217f},
-std::array<float,2>{0.297561109f, 0.955775738f},
-std::array<float,2>{0.93506664f, 0.114506118f},
-std::array<float,2>{0.188114882f, 0.187765688f},
-std::array<float,2>{0.522137344f, 0.761121035f},
-std::array<float,2>{0.325876504f, 0.728316903f},
-std::array<float,2>{0.948916256f, 0.332206488f},
-std::array<float,2>{0.432376981f, 0.387067169f},
-std::array<float,2>{0.867670655f, 0.606935382f},
-std::array<float,2>{0.00162697746f, 0.892423451f},
-std::array<float,2>{0.694603801f, 0.00416001165f},
-std::array<float,2>{0.270027399f, 0.0745623857f},
-std::array<float,2>{0.881819546f, 0.995030165f},
-std::array<float,2>{0.126183793f, 0.513938665f},
-std::array<float,2>{0.597796261f, 0.447967559f},
-std::array<float,2>{0.0986960754f, 0.279653609f},
-std::array<float,2>{0.669264495f, 0.660095036f},
-std::array<float,2>{0.48808074f, 0.867540181f},
-std::array<float,2>{0.802363753f, 0.165028468f},
-std::array<float,2>{0.239505783f, 0.00820132345f},
-std::array<float,2>{0.545955777f, 0.898493886f},
-std::array<float,2>{0.353028029f, 0.598572254f},
-std::array<float,2>{0.978735626f, 0.382447064f},
-std::array<float,2>{0.395672768f, 0.3363747f},
-std::array<float,2>{0.835446358f, 0.7226668f},
-std::array<float,2>{0.0610274374f, 0.755826473f},
-std::array<float,2>{0.743697107f, 0.195969284f},
-std::array<float,2>{0.31032902f, 0.162135184f},
-std::array<float,2>{0.92939806f, 0.862353861f},
-std::array<float,2>{0.184052438f, 0.669261336f},
-std::array<float,2>{0.590335011f, 0.266435772f},
-std::array<float,2>{0.0796625763f, 0.440421283f},
-std::array<float,2>{0.638364375f, 0.507451475f},
-std::array<float,2>{0.456843138f, 0.989579737f},
-std::array<float,2>{0.754052699f, 0.0633482859f},
-std::array<float,2>{0.0131040774f, 0.247136518f},
-std::array<float,2>{0.699746728f, 0.809356987f},
-std::array<float,2>{0.4259018f, 0.699303031f},
-std::array<float,2>{0.863847077f, 0.363372982f},
-std::array<float,2>{0.318619072f, 0.414706916f},
-std::array<float,2>{0.938426137f, 0.592728257f},
-std::array<float,2>{0.198209226f, 0.930686414f},
-std::array<float,2>{0.527733922f, 0.0363705829f},
-std::array<float,2>{0.494719774f, 0.120922819f},
-std::array<float,2>{0.807301641f, 0.965139031f},
-std::array<float,2>{0.103706717f, 0.546774566f},
-std::array<float,2>{0.659268022f, 0.469162583f},
-std::array<float,2>{0.136837378f, 0.302703857f},
-std::array<float,2>{0.603884757f, 0.654106557f},
-std::array<float,2>{0.276323557f, 0.83323884f},
-std::array<float,2>{0.885292709f, 0.141442165f},
-std::array<float,2>{0.109812275f, 0.0929250717f},
-std::array<float,2>{0.674010992f, 0.984048665f},
-std::array<float,2>{0.481519729f, 0.526725113f},
-std::array<float,2>{0.793831706f, 0.466422707f},
-std::array<float,2>{0.252944171f, 0.25633508f},
-std::array<float,2>{0.904278278f, 0.68702352f},
-std::array<float,2>{0.155018196f, 0.855033457f},
-std::array<float,2>{0.618734181f, 0.177877188f},
-std::array<float,2>{0.411279708f, 0.203724593f},
-std::array<float,2>{0.853101492f, 0.774647951f},
-std::array<float,2>{0.0206217896f, 0.745752275f},
-std::array<float,2>{0.714853108f, 0.320299208f},
-std::array<float,2>{0.206806317f, 0.394340187f},
-std::array<float,2>{0.514863133f, 0.623401761f},
-std::array<float,2>{0.33059147f, 0.887327433f},
-std::array<float,2>{0.962221801f, 0.0172695164f},
-std::array<float,2>{0.16834718f, 0.127140522f},
-std::array<float,2>{0.562869251f, 0.822980225f},
-std::array<float,2>{0.292085946f, 0.629651546f},
-std::array<float,2>{0.915754497f, 0.288513124f},
-std::array<float,2>{0.444520921f, 0.485811889f},
-std::array<float,2>{0.766239643f, 0.553712189f},
-std::array<float,2>{0.0744714364f, 0.947504997f},
-std::array<float,2>{0.643136084f, 0.100523174f},
-std::array<float,2>{0.373015225f, 0.047942169f},
-std::array<float,2>{0.99098599f, 0.919001102f},
-std::array<float,2>{0.225149736f, 0.567860484f},
-std::array<float,2>{0.552831888f, 0.434456944f},
-std::array<float,2>{0.0329602771f, 0.354514509f},
-std::array<float,2>{0.726461351f, 0.712887824f},
-std::array<float,2>{0.378736526f, 0.796796739f},
-std::array<float,2>{0.812518954f, 0.22232312f},
-std::array<float,2>{0.18314521f, 0.0598324239f},
-std::array<float,2>{0.588929057f, 0.913196325f},
-std::array<float,2>{0.30530408f, 0.577726424f},
-std::array<float,2>{0.921996474f, 0.429647475f},
-std::array<float,2>{0.460326791f, 0.351559907f},
-std::array<float,2>{0.751515329f, 0.703171968f},
-std::array<float,2>{0.0834003463f, 0.788019001f},
-std::array<float,2>{0.634658933f, 0.233329982f},
-std::array<float,2>{0.357466429f, 0.139811561f},
-std::array<float,2>{0.981369317f, 0.816837907f},
-std::array<float,2>{0.236727968f, 0.633070648f},
-std::array<float,2>{0.539782822f, 0.292417735f},
-std::array<float,2>{0.0576276742f, 0.498055995f},
-std::array<float,2>{0.747646213f, 0.558547914f},
-std::array<float,2>{0.393052369f, 0.938822746f},
-std::array<float,2>{0.830442429f, 0.108705498f},
-std::array<float,2>{0.106820427f, 0.211666927f},
-std::array<float,2>{0.662741005f, 0.770815134f},
-std::array<float,2>{0.498948663f, 0.736017585f},
-std::array<float,2>{0.811097324f, 0.321241856f},
-std::array<float,2>{0.279184312f, 0.40587306f},
-std::array<float,2>{0.890430212f, 0.613296032f},
-std::array<float,2>{0.135804355f, 0.87725091f},
-std::array<float,2>{0.608519495f, 0.0280493107f},
-std::array<float,2>{0.422607511f, 0.0797214955f},
-std::array<float,2>{0.861591816f, 0.972974896f},
-std::array<float,2>{0.0083081089f, 0.517635584f},
-std::array<float,2>{0.695592284f, 0.456617534f},
-std::array<float,2>{0.202219054f, 0.260378033f},
-std::array<float,2>{0.523756862f, 0.673453033f},
-std::array<float,2>{0.315047681f, 0.849083066f},
-std::array<float,2>{0.945024967f, 0.184967682f},
-std::array<float,2>{0.0158562642f, 0.112498879f},
-std::array<float,2>{0.712013662f, 0.958499789f},
-std::array<float,2>{0.406856596f, 0.536776364f},
-std::array<float,2>{0.857437015f, 0.483735561f},
-std::array<float,2>{0.33252871f, 0.312128067f},
-std::array<float,2>{0.967735887f, 0.646982372f},
-std::array<float,2>{0.21090737f, 0.83844161f},
-std::array<float,2>{0.508029103f, 0.151656687f},
-std::array<float,2>{0.478459001f, 0.235186696f},
-std::array<float,2>{0.789287984f, 0.797369003f},
-std::array<float,2>{0.116958797f, 0.692785323f},
-std::array<float,2>{0.678058505f, 0.368259043f},
-std::array<float,2>{0.149841145f, 0.410878241f},
-std::array<float,2>{0.62262398f, 0.583335876f},
-std::array<float,2>{0.255058318f, 0.927317202f},
-std::array<float,2>{0.900128663f, 0.0439154841f},
-std::array<float,2>{0.219304129f, 0.169834465f},
-std::array<float,2>{0.54787457f, 0.871135771f},
-std::array<float,2>{0.367716193f, 0.663144767f},
-std::array<float,2>{0.988107681f, 0.274692953f},
-std::array<float,2>{0.381450325f, 0.450062513f},
-std::array<float,2>{0.817153275f, 0.508605242f},
-std::array<float,2>{0.037675377f, 0.997036695f},
-std::array<float,2>{0.719836414f, 0.0704722852f},
-std::array<float,2>{0.293160528f, 0.00195577461f},
-std::array<float,2>{0.918268085f, 0.898274839f},
-std::array<float,2>{0.167046815f, 0.602887571f},
-std::array<float,2>{0.566816032f, 0.384777516f},
-std::array<float,2>{0.0739987865f, 0.329492152f},
-std::array<float,2>{0.646291614f, 0.731834829f},
-std::array<float,2>{0.440639943f, 0.761838615f},
-std::array<float,2>{0.770019114f, 0.192829475f},
-std::array<float,2>{0.214946881f, 0.0699933246f},
-std::array<float,2>{0.501810789f, 0.984401584f},
-std::array<float,2>{0.340514272f, 0.501035094f},
-std::array<float,2>{0.958943427f, 0.441784322f},
-std::array<float,2>{0.420206249f, 0.27251789f},
-std::array<float,2>{0.847170115f, 0.667395532f},
-std::array<float,2>{0.0247574933f, 0.865495801f},
-std::array<float,2>{0.705820799f, 0.157212093f},
-std::array<float,2>{0.258467436f, 0.202581272f},
-std::array<float,2>{0.890905917f, 0.751712382f},
-std::array<float,2>{0.141309097f, 0.722503483f},
-std::array<float,2>{0.611253142f, 0.341472864f},
-std::array<float,2>{0.123193383f, 0.376076788f},
-std::array<float,2>{0.680667937f, 0.596927345f},
-std::array<float,2>{0.475869805f, 0.903781593f},
-std::array<float,2>{0.783533454f, 0.0143171772f},
-std::array<float,2>{0.0441558585f, 0.147545829f},
-std::array<float,2>{0.730513573f, 0.83177799f},
-std::array<float,2>{0.386490166f, 0.651131272f},
-std::array<float,2>{0.824971795f, 0.298657656f},
-std::array<float,2>{0.363675594f, 0.474253893f},
-std::array<float,2>{0.9932037f, 0.542843461f},
-std::array<float,2>{0.232400879f, 0.964776099f},
-std::array<float,2>{0.560881972f, 0.121324636f},
-std::array<float,2>{0.448640466f, 0.0333582908f},
-std::array<float,2>{0.778580248f, 0.934185743f},
-std::array<float,2>{0.0702384934f, 0.588514686f},
-std::array<float,2>{0.650923193f, 0.420850843f},
-std::array<float,2>{0.160999745f, 0.362603307f},
-std::array<float,2>{0.570367217f, 0.696309507f},
-std::array<float,2>{0.283091813f, 0.80485332f},
-std::array<float,2>{0.90835315f, 0.243750244f},
-std::array<float,2>{0.0870493576f, 0.0227976441f},
-std::array<float,2>{0.63137722f, 0.885858297f},
-std::array<float,2>{0.46795541f, 0.620308995f},
-std::array<float,2>{0.758134484f, 0.396024048f},
-std::array<float,2>{0.301045775f, 0.312826425f},
-std::array<float,2>{0.931211472f, 0.746592879f},
-std::array<float,2>{0.178662345f, 0.778638482f},
-std::array<float,2>{0.583022833f, 0.207140952f},
-std::array<float,2>{0.405171841f, 0.173373803f},
-std::array<float,2>{0.841741979f, 0.858538747f},
-std::array<float,2>{0.0475490429f, 0.681498528f},
-std::array<float,2>{0.740802348f, 0.252020985f},
-std::array<float,2>{0.244590342f, 0.464782864f},
-std::array<float,2>{0.532836497f, 0.529127717f},
-std::array<float,2>{0.347368211f, 0.978596091f},
-std::array<float,2>{0.971012652f, 0.0889106914f},
-std::array<float,2>{0.129640564f, 0.223419771f},
-std::array<float,2>{0.594377279f, 0.789845467f},
-std::array<float,2>{0.268112987f, 0.716632962f},
-std::array<float,2>{0.878896415f, 0.356483102f},
-std::array<float,2>{0.491712838f, 0.432169199f},
-std::array<float,2>{0.800701201f, 0.562975645f},
-std::array<float,2>{0.0948786139f, 0.916334093f},
-std::array<float,2>{0.666866839f, 0.0509265438f},
-std::array<float,2>{0.321246445f, 0.0963112563f},
-std::array<float,2>{0.949911594f, 0.949935913f},
-std::array<float,2>{0.193187952f, 0.549978316f},
-std::array<float,2>{0.517060935f, 0.490465522f},
-std::array<float,2>{0.00486115087f, 0.281291723f},
-std::array<float,2>{0.689825296f, 0.627351284f},
-std::array<float,2>{0.437309444f, 0.824961126f},
-std::array<float,2>{0.873938382f, 0.131258875f},
-std::array<float,2>{0.158399701f, 0.0829705074f},
-std::array<float,2>{0.57501781f, 0.972404301f},
-std::array<float,2>{0.286044598f, 0.521329761f},
-std::array<float,2>{0.91085887f, 0.458112985f},
-std::array<float,2>{0.452781737f, 0.263440043f},
-std::array<float,2>{0.774269819f, 0.678902626f},
-std::array<float,2>{0.0636536852f, 0.844022691f},
-std::array<float,2>{0.656126559f, 0.181845754f},
-std::array<float,2>{0.363020003f, 0.21668835f},
-std::array<float,2>{0.998107731f, 0.769113004f},
-std::array<float,2>{0.22842823f, 0.741018295f},
-std::array<float,2>{0.558195233f, 0.325327039f},
-std::array<float,2>{0.0410872623f, 0.401910037f},
-std::array<float,2>{0.728685796f, 0.612333775f},
-std::array<float,2>{0.390402496f, 0.879047632f},
-std::array<float,2>{0.821081102f, 0.026275374f},
-std::array<float,2>{0.12006817f, 0.134502634f},
-std::array<float,2>{0.684901834f, 0.812864363f},
-std::array<float,2>{0.471210331f, 0.640443206f},
-std::array<float,2>{0.786904216f, 0.293731302f},
-std::array<float,2>{0.26274702f, 0.494565994f},
-std::array<float,2>{0.894999623f, 0.561794341f},
-std::array<float,2>{0.148435101f, 0.942933619f},
-std::array<float,2>{0.614345908f, 0.103240199f},
-std::array<float,2>{0.417496383f, 0.0567349903f},
-std::array<float,2>{0.847888768f, 0.906675816f},
-std::array<float,2>{0.0273984857f, 0.573469937f},
-std::array<float,2>{0.707092226f, 0.423362702f},
-std::array<float,2>{0.21368435f, 0.346737653f},
-std::array<float,2>{0.505812585f, 0.710474968f},
-std::array<float,2>{0.338458866f, 0.784650087f},
-std::array<float,2>{0.953500152f, 0.23000823f},
-std::array<float,2>{0.00325569324f, 0.00692130253f},
-std::array<float,2>{0.693073034f, 0.893070936f},
-std::array<float,2>{0.43142575f, 0.608094215f},
-std::array<float,2>{0.870880306f, 0.389782608f},
-std::array<float,2>{0.327725887f, 0.335607648f},
-std::array<float,2>{0.94571197f, 0.730272412f},
-std::array<float,2>{0.190076724f, 0.759620786f},
-std::array<float,2>{0.520403564f, 0.189455017f},
-std::array<float,2>{0.485037893f, 0.167108655f},
-std::array<float,2>{0.804228306f, 0.870063424f},
-std::array<float,2>{0.101339221f, 0.657642722f},
-std::array<float,2>{0.670991659f, 0.278318197f},
-std::array<float,2>{0.128174767f, 0.445830792f},
-std::array<float,2>{0.601424158f, 0.512299418f},
-std::array<float,2>{0.273198396f, 0.993512988f},
-std::array<float,2>{0.878907382f, 0.0769803524f},
-std::array<float,2>{0.249036252f, 0.238546178f},
-std::array<float,2>{0.536405504f, 0.804596066f},
-std::array<float,2>{0.35115245f, 0.688003182f},
-std::array<float,2>{0.976243198f, 0.371950924f},
-std::array<float,2>{0.400596142f, 0.408808678f},
-std::array<float,2>{0.839409649f, 0.57896471f},
-std::array<float,2>{0.0520127192f, 0.925171375f},
-std::array<float,2>{0.737006545f, 0.0418353304f},
-std::array<float,2>{0.300391763f, 0.115503348f},
-std::array<float,2>{0.937074661f, 0.954124808f},
-std::array<float,2>{0.174645215f, 0.532773674f},
-std::array<float,2>{0.579574823f, 0.480251849f},
-std::array<float,2>{0.0935973376f, 0.306867927f},
-std::array<float,2>{0.625760496f, 0.641163647f},
-std::array<float,2>{0.461591899f, 0.842468619f},
-std::array<float,2>{0.765565276f, 0.154100642f},
-std::array<float,2>{0.196427256f, 0.0382653251f},
-std::array<float,2>{0.530632257f, 0.933022618f},
-std::array<float,2>{0.317263454f, 0.591183782f},
-std::array<float,2>{0.939735174f, 0.417479903f},
-std::array<float,2>{0.429394811f, 0.365847468f},
-std::array<float,2>{0.866902888f, 0.701365709f},
-std::array<float,2>{0.0151313869f, 0.812247634f},
-std::array<float,2>{0.702716947f, 0.248747721f},
-std::array<float,2>{0.273604274f, 0.144451648f},
-std::array<float,2>{0.883111656f, 0.835579634f},
-std::array<float,2>{0.140563101f, 0.655731022f},
-std::array<float,2>{0.601580322f, 0.302904576f},
-std::array<float,2>{0.103120573f, 0.472250313f},
-std::array<float,2>{0.657132983f, 0.542974591f},
-std::array<float,2>{0.493514538f, 0.968555689f},
-std::array<float,2>{0.806424618f, 0.118287668f},
-std::array<float,2>{0.0592015348f, 0.198695019f},
-std::array<float,2>{0.745277286f, 0.757767677f},
-std::array<float,2>{0.398088753f, 0.726324439f},
-std::array<float,2>{0.832087636f, 0.338359594f},
-std::array<float,2>{0.353549391f, 0.380697161f},
-std::array<float,2>{0.977792323f, 0.599653065f},
-std::array<float,2>{0.241849631f, 0.901420474f},
-std::array<float,2>{0.544128716f, 0.011071234f},
-std::array<float,2>{0.453945965f, 0.0662111714f},
-std::array<float,2>{0.75676614f, 0.990674973f},
-std::array<float,2>{0.0814843401f, 0.504282236f},
-std::array<float,2>{0.640124559f, 0.438277483f},
-std::array<float,2>{0.186834738f, 0.269446164f},
-std::array<float,2>{0.59257108f, 0.671394467f},
-std::array<float,2>{0.310853601f, 0.861104071f},
-std::array<float,2>{0.926378965f, 0.161565989f},
-std::array<float,2>{0.0781197846f, 0.0994933769f},
-std::array<float,2>{0.641011119f, 0.945532978f},
-std::array<float,2>{0.44194594f, 0.551729262f},
-std::array<float,2>{0.767985761f, 0.486528218f},
-std::array<float,2>{0.290678889f, 0.286841393f},
-std::array<float,2>{0.916743696f, 0.632011414f},
-std::array<float,2>{0.169975564f, 0.82043457f},
-std::array<float,2>{0.565469384f, 0.126297429f},
-std::array<float,2>{0.375877768f, 0.220343485f},
-std::array<float,2>{0.814541519f, 0.793220937f},
-std::array<float,2>{0.0346712843f, 0.713009179f},
-std::array<float,2>{0.724042058f, 0.352420598f},
-std::array<float,2>{0.222882211f, 0.436182946f},
-std::array<float,2>{0.551734626f, 0.568665862f},
-std::array<float,2>{0.374552131f, 0.920383632f},
-std::array<float,2>{0.989285648f, 0.0497537516f},
-std::array<float,2>{0.152735829f, 0.177449986f},
-std::array<float,2>{0.620949447f, 0.852971435f},
-std::array<float,2>{0.251098394f, 0.684212983f},
-std::array<float,2>{0.905078173f, 0.254794389f},
-std::array<float,2>{0.483885646f, 0.467063248f},
-std::array<float,2>{0.79516995f, 0.525065958f},
-std::array<float,2>{0.111918867f, 0.982230961f},
-std::array<float,2>{0.672796547f, 0.0906459019f},
-std::array<float,2>{0.329735875f, 0.0180626083f},
-std::array<float,2>{0.962970436f, 0.889510632f},
-std::array<float,2>{0.203423291f, 0.622889578f},
-std::array<float,2>{0.512157738f, 0.39210391f},
-std::array<float,2>{0.0231071375f, 0.317644864f},
-std::array<float,2>{0.718072772f, 0.744102895f},
-std::array<float,2>{0.413844466f, 0.775913298f},
-std::array<float,2>{0.854340911f, 0.20645304f},
-std::array<float,2>{0.133006886f, 0.0294517726f},
-std::array<float,2>{0.606054962f, 0.87692976f},
-std::array<float,2>{0.280636936f, 0.616036117f},
-std::array<float,2>{0.888246298f, 0.404064864f},
-std::array<float,2>{0.496746212f, 0.323761851f},
-std::array<float,2>{0.810065448f, 0.737306237f},
-std::array<float,2>{0.109200083f, 0.771580637f},
-std::array<float,2>{0.661409259f, 0.214195147f},
-std::array<float,2>{0.313662022f, 0.18627812f},
-std::array<float,2>{0.942923486f, 0.850989223f},
-std::array<float,2>{0.200251251f, 0.67503041f},
-std::array<float,2>{0.525704682f, 0.259751081f},
-std::array<float,2>{0.0111472607f, 0.454775184f},
-std::array<float,2>{0.697346509f, 0.516559958f},
-std::array<float,2>{0.424690455f, 0.976399064f},
-std::array<float,2>{0.86095649f, 0.0817502141f},
-std::array<float,2>{0.0843613744f, 0.231618628f},
-std::array<float,2>{0.635356784f, 0.786769986f},
-std::array<float,2>{0.457176864f, 0.706689239f},
-std::array<float,2>{0.75234431f, 0.347757787f},
-std::array<float,2>{0.308192194f, 0.427368641f},
-std::array<float,2>{0.924576402f, 0.574724197f},
-std::array<float,2>{0.180016458f, 0.912048876f},
-std::array<float,2>{0.586052299f, 0.0612460263f},
-std::array<float,2>{0.391999364f, 0.106746748f},
-std::array<float,2>{0.829871058f, 0.93970871f},
-std::array<float,2>{0.0553427376f, 0.555977762f},
-std::array<float,2>{0.749490619f, 0.496118456f},
-std::array<float,2>{0.23617509f, 0.289253116f},
-std::array<float,2>{0.541309714f, 0.63606745f},
-std::array<float,2>{0.355955899f, 0.819381475f},
-std::array<float,2>{0.982512474f, 0.137754127f},
-std::array<float,2>{0.036073979f, 0.0732995942f},
-std::array<float,2>{0.721769989f, 0.998186588f},
-std::array<float,2>{0.379180729f, 0.511246502f},
-std::array<float,2>{0.818816781f, 0.451907337f},
-std::array<float,2>{0.370514482f, 0.275802284f},
-std::array<float,2>{0.985057771f, 0.662031531f},
-std::array<float,2>{0.221172035f, 0.873241782f},
-std::array<float,2>{0.548963249f, 0.170643881f},
-std::array<float,2>{0.439041764f, 0.194813952f},
-std::array<float,2>{0.772665381f, 0.764367104f},
-std::array<float,2>{0.0717468485f, 0.733045936f},
-std::array<float,2>{0.64809972f, 0.332010567f},
-std::array<float,2>{0.164409608f, 0.383758515f},
-std::array<float,2>{0.569382608f, 0.605281651f},
-std::array<float,2>{0.296638727f, 0.895990133f},
-std::array<float,2>{0.921296895f, 0.00180732866f},
-std::array<float,2>{0.208452791f, 0.149362162f},
-std::array<float,2>{0.510480404f, 0.83690393f},
-std::array<float,2>{0.335293204f, 0.645607769f},
-std::array<float,2>{0.96521759f, 0.310345203f},
-std::array<float,2>{0.409567028f, 0.481854826f},
-std::array<float,2>{0.857280195f, 0.537405729f},
-std::array<float,2>{0.0181580167f, 0.959339917f},
-std::array<float,2>{0.714505017f, 0.109461531f},
-std::array<float,2>{0.256304681f, 0.0450678319f},
-std::array<float,2>{0.901930809f, 0.928112924f},
-std::array<float,2>{0.150872886f, 0.584447086f},
-std::array<float,2>{0.623365581f, 0.413565367f},
-std::array<float,2>{0.114757761f, 0.370406151f},
-std::array<float,2>{0.676305294f, 0.69468832f},
-std::array<float,2>{0.479841381f, 0.799522281f},
-std::array<float,2>{0.79272759f, 0.237126485f},
-std::array<float,2>{0.232828677f, 0.123340726f},
-std::array<float,2>{0.559768617f, 0.962348819f},
-std::array<float,2>{0.365744054f, 0.540759802f},
-std::array<float,2>{0.995958984f, 0.474642664f},
-std::array<float,2>{0.383746833f, 0.298830301f},
-std::array<float,2>{0.827884674f, 0.648657441f},
-std::array<float,2>{0.0467783399f, 0.828355014f},
-std::array<float,2>{0.733051538f, 0.145871907f},
-std::array<float,2>{0.285100937f, 0.245355457f},
-std::array<float,2>{0.90678668f, 0.807793975f},
-std::array<float,2>{0.16271615f, 0.697653592f},
-std::array<float,2>{0.573945284f, 0.360355437f},
-std::array<float,2>{0.0681156367f, 0.418451935f},
-std::array<float,2>{0.648505747f, 0.586997032f},
-std::array<float,2>{0.445517749f, 0.936041594f},
-std::array<float,2>{0.781235874f, 0.0330945849f},
-std::array<float,2>{0.0262254756f, 0.158636644f},
-std::array<float,2>{0.703342021f, 0.864575863f},
-std::array<float,2>{0.41836527f, 0.666006923f},
-std::array<float,2>{0.844871759f, 0.270687312f},
-std::array<float,2>{0.342574805f, 0.443928689f},
-std::array<float,2>{0.95926398f, 0.503640473f},
-std::array<float,2>{0.218683586f, 0.987236619f},
-std::array<float,2>{0.501994312f, 0.066765964f},
-std::array<float,2>{0.472947419f, 0.0119990977f},
-std::array<float,2>{0.782898843f, 0.905749917f},
-std::array<float,2>{0.121703796f, 0.594650924f},
-std::array<float,2>{0.683380485f, 0.376981586f},
-std::array<float,2>{0.142810345f, 0.341981143f},
-std::array<float,2>{0.611702442f, 0.720483899f},
-std::array<float,2>{0.261372864f, 0.752239406f},
-std::array<float,2>{0.893034339f, 0.199610129f},
-std::array<float,2>{0.0963421836f, 0.0539099574f},
-std::array<float,2>{0.66543144f, 0.914112329f},
-std::array<float,2>{0.489500254f, 0.565359831f},
-std::array<float,2>{0.797223508f, 0.430342257f},
-std::array<float,2>{0.265774101f, 0.358772367f},
-std::array<float,2>{0.876442611f, 0.717205584f},
-std::array<float,2>{0.132629395f, 0.792399108f},
-std::array<float,2>{0.597342968f, 0.225831255f},
-std::array<float,2>{0.434617728f, 0.129344448f},
-std::array<float,2>{0.871755838f, 0.827343583f},
-std::array<float,2>{0.00592432311f, 0.625949919f},
-std::array<float,2>{0.688262999f, 0.284552306f},
-std::array<float,2>{0.193529174f, 0.488591641f},
-std::array<float,2>{0.518432498f, 0.548766494f},
-std::array<float,2>{0.323533267f, 0.953079998f},
-std::array<float,2>{0.952966928f, 0.0940393507f},
-std::array<float,2>{0.177050292f, 0.209987447f},
-std::array<float,2>{0.585358262f, 0.779307008f},
-std::array<float,2>{0.303157657f, 0.7490924f},
-std::array<float,2>{0.932674229f, 0.315696478f},
-std::array<float,2>{0.466498107f, 0.398168623f},
-std::array<float,2>{0.760304213f, 0.617265642f},
-std::array<float,2>{0.0885797441f, 0.883287609f},
-std::array<float,2>{0.629036129f, 0.0204724148f},
-std::array<float,2>{0.345304072f, 0.0859467536f},
-std::array<float,2>{0.969607949f, 0.977833748f},
-std::array<float,2>{0.242571875f, 0.530487061f},
-std::array<float,2>{0.534801602f, 0.461228997f},
-std::array<float,2>{0.0504921973f, 0.25083971f},
-std::array<float,2>{0.739288568f, 0.681669652f},
-std::array<float,2>{0.403312862f, 0.856163383f},
-std::array<float,2>{0.842576504f, 0.175164238f},
-std::array<float,2>{0.170528412f, 0.0999130979f},
-std::array<float,2>{0.566377521f, 0.948044479f},
-std::array<float,2>{0.290394425f, 0.554524422f},
-std::array<float,2>{0.916441739f, 0.486103237f},
-std::array<float,2>{0.441799581f, 0.28905338f},
-std::array<float,2>{0.768157482f, 0.629232228f},
-std::array<float,2>{0.0776247308f, 0.822690725f},
-std::array<float,2>{0.6415205f, 0.127796978f},
-std::array<float,2>{0.374255806f, 0.222098202f},
-std::array<float,2>{0.990086675f, 0.796028793f},
-std::array<float,2>{0.223187104f, 0.712255955f},
-std::array<float,2>{0.55079174f, 0.355342299f},
-std::array<float,2>{0.0343462043f, 0.434072495f},
-std::array<float,2>{0.724452257f, 0.568307996f},
-std::array<float,2>{0.375454754f, 0.919652402f},
-std::array<float,2>{0.814979374f, 0.0488186292f},
-std::array<float,2>{0.111656144f, 0.178363189f},
-std::array<float,2>{0.672025084f, 0.854505181f},
-std::array<float,2>{0.484135807f, 0.686811566f},
-std::array<float,2>{0.795569003f, 0.256505579f},
-std::array<float,2>{0.251607955f, 0.465998948f},
-std::array<float,2>{0.904703438f, 0.527171433f},
-std::array<float,2>{0.152833983f, 0.983430386f},
-std::array<float,2>{0.620311797f, 0.0935929269f},
-std::array<float,2>{0.41340065f, 0.0170580335f},
-std::array<float,2>{0.853905439f, 0.886854529f},
-std::array<float,2>{0.0228521712f, 0.623805046f},
-std::array<float,2>{0.718478501f, 0.393902928f},
-std::array<float,2>{0.203760073f, 0.319629937f},
-std::array<float,2>{0.512455642f, 0.745429397f},
-std::array<float,2>{0.329441369f, 0.775178313f},
-std::array<float,2>{0.963602901f, 0.203569323f},
-std::array<float,2>{0.0154566681f, 0.0368820652f},
-std::array<float,2>{0.70231837f, 0.931303084f},
-std::array<float,2>{0.429103285f, 0.592134535f},
-std::array<float,2>{0.866224706f, 0.414421618f},
-std::array<float,2>{0.316831499f, 0.363956511f},
-std::array<float,2>{0.940267444f, 0.699773371f},
-std::array<float,2>{0.197044119f, 0.808715641f},
-std::array<float,2>{0.531003416f, 0.247561499f},
-std::array<float,2>{0.493692756f, 0.141029418f},
-std::array<float,2>{0.806113839f, 0.833622813f},
-std::array<float,2>{0.102960594f, 0.653728306f},
-std::array<float,2>{0.656276107f, 0.301961482f},
-std::array<float,2>{0.14012675f, 0.469453394f},
-std::array<float,2>{0.602074683f, 0.546109617f},
-std::array<float,2>{0.274135381f, 0.965694547f},
-std::array<float,2>{0.883304238f, 0.120159991f},
-std::array<float,2>{0.241500854f, 0.195568547f},
-std::array<float,2>{0.544501185f, 0.755339444f},
-std::array<float,2>{0.354272693f, 0.723618269f},
-std::array<float,2>{0.97802949f, 0.336821258f},
-std::array<float,2>{0.397524506f, 0.382136583f},
-std::array<float,2>{0.832684755f, 0.597994745f},
-std::array<float,2>{0.0588875972f, 0.899317622f},
-std::array<float,2>{0.745968342f, 0.00858706422f},
-std::array<float,2>{0.311510026f, 0.0625278354f},
-std::array<float,2>{0.925951183f, 0.989930451f},
-std::array<float,2>{0.187145695f, 0.506955504f},
-std::array<float,2>{0.591984808f, 0.43973583f},
-std::array<float,2>{0.0819281191f, 0.266104788f},
-std::array<float,2>{0.640209734f, 0.669595063f},
-std::array<float,2>{0.453611672f, 0.862960637f},
-std::array<float,2>{0.756172121f, 0.162723437f},
-std::array<float,2>{0.189555883f, 0.00465781009f},
-std::array<float,2>{0.519548953f, 0.891894758f},
-std::array<float,2>{0.32721138f, 0.606917262f},
-std::array<float,2>{0.945816875f, 0.387307793f},
-std::array<float,2>{0.430843562f, 0.332719266f},
-std::array<float,2>{0.870247602f, 0.727912486f},
-std::array<float,2>{0.00382598094f, 0.761668682f},
-std::array<float,2>{0.69281584f, 0.18817313f},
-std::array<float,2>{0.272494376f, 0.164264902f},
-std::array<float,2>{0.879774332f, 0.868023634f},
-std::array<float,2>{0.128578052f, 0.659399569f},
-std::array<float,2>{0.601022243f, 0.279992372f},
-std::array<float,2>{0.100802623f, 0.447392881f},
-std::array<float,2>{0.67159313f, 0.514200568f},
-std::array<float,2>{0.48442173f, 0.994551659f},
-std::array<float,2>{0.804169893f, 0.0747372061f},
-std::array<float,2>{0.0522698723f, 0.240456924f},
-std::array<float,2>{0.736542463f, 0.802581012f},
-std::array<float,2>{0.401120991f, 0.690654635f},
-std::array<float,2>{0.838906407f, 0.374320924f},
-std::array<float,2>{0.350827128f, 0.406972647f},
-std::array<float,2>{0.975896537f, 0.581259549f},
-std::array<float,2>{0.249536783f, 0.922284663f},
-std::array<float,2>{0.536732495f, 0.0397725925f},
-std::array<float,2>{0.461258799f, 0.114766538f},
-std::array<float,2>{0.764957547f, 0.955105603f},
-std::array<float,2>{0.092858538f, 0.534430623f},
-std::array<float,2>{0.625396729f, 0.477296442f},
-std::array<float,2>{0.174087808f, 0.305141538f},
-std::array<float,2>{0.579973161f, 0.644504905f},
-std::array<float,2>{0.300195932f, 0.840376735f},
-std::array<float,2>{0.936719596f, 0.154512748f},
-std::array<float,2>{0.0640553236f, 0.0850408003f},
-std::array<float,2>{0.655411363f, 0.969451129f},
-std::array<float,2>{0.452411473f, 0.522515774f},
-std::array<float,2>{0.77385813f, 0.460496575f},
-std::array<float,2>{0.285505235f, 0.264408559f},
-std::array<float,2>{0.91031009f, 0.676636279f},
-std::array<float,2>{0.158766732f, 0.846509337f},
-std::array<float,2>{0.574500978f, 0.181281894f},
-std::array<float,2>{0.390119761f, 0.217312247f},
-std::array<float,2>{0.82041961f, 0.76716429f},
-std::array<float,2>{0.0417992137f, 0.739702404f},
-std::array<float,2>{0.729140818f, 0.327367157f},
-std::array<float,2>{0.227609307f, 0.399781674f},
-std::array<float,2>{0.557665229f, 0.610849559f},
-std::array<float,2>{0.362740725f, 0.882261992f},
-std::array<float,2>{0.998645663f, 0.0237417426f},
-std::array<float,2>{0.147593677f, 0.136659876f},
-std::array<float,2>{0.614888549f, 0.814951777f},
-std::array<float,2>{0.26338771f, 0.638195813f},
-std::array<float,2>{0.895404816f, 0.295368135f},
-std::array<float,2>{0.470899493f, 0.493172884f},
-std::array<float,2>{0.786473453f, 0.560204446f},
-std::array<float,2>{0.1192021f, 0.944793761f},
-std::array<float,2>{0.685202837f, 0.104275756f},
-std::array<float,2>{0.338139683f, 0.0550686307f},
-std::array<float,2>{0.953729987f, 0.909916162f},
-std::array<float,2>{0.212904975f, 0.571195781f},
-std::array<float,2>{0.505246222f, 0.425234526f},
-std::array<float,2>{0.0281974059f, 0.345267832f},
-std::array<float,2>{0.707628667f, 0.707941473f},
-std::array<float,2>{0.417171657f, 0.782691598f},
-std::array<float,2>{0.84824717f, 0.228072137f},
-std::array<float,2>{0.131965607f, 0.0514778681f},
-std::array<float,2>{0.596858442f, 0.916609049f},
-std::array<float,2>{0.266581804f, 0.563125491f},
-std::array<float,2>{0.876602292f, 0.4317424f},
-std::array<float,2>{0.489765972f, 0.357021153f},
-std::array<float,2>{0.797471225f, 0.716048896f},
-std::array<float,2>{0.0957779586f, 0.789109826f},
-std::array<float,2>{0.665680528f, 0.222797275f},
-std::array<float,2>{0.323998272f, 0.131362766f},
-std::array<float,2>{0.952483833f, 0.824588597f},
-std::array<float,2>{0.194285348f, 0.62773627f},
-std::array<float,2>{0.517929554f, 0.281918675f},
-std::array<float,2>{0.00646011718f, 0.490797997f},
-std::array<float,2>{0.687784016f, 0.550311327f},
-std::array<float,2>{0.435332865f, 0.949629307f},
-std::array<float,2>{0.871325552f, 0.0961512923f},
-std::array<float,2>{0.0882148072f, 0.207897916f},
-std::array<float,2>{0.629669607f, 0.778809965f},
-std::array<float,2>{0.466056615f, 0.746153712f},
-std::array<float,2>{0.760199189f, 0.313447535f},
-std::array<float,2>{0.303590119f, 0.395534337f},
-std::array<float,2>{0.933518708f, 0.621057451f},
-std::array<float,2>{0.177509129f, 0.886690617f},
-std::array<float,2>{0.585458934f, 0.0233208258f},
-std::array<float,2>{0.402544588f, 0.0894989595f},
-std::array<float,2>{0.842276156f, 0.979336023f},
-std::array<float,2>{0.0499170572f, 0.528379679f},
-std::array<float,2>{0.739873052f, 0.463893384f},
-std::array<float,2>{0.242752239f, 0.252711624f},
-std::array<float,2>{0.534344971f, 0.680773973f},
-std::array<float,2>{0.344756603f, 0.858904898f},
-std::array<float,2>{0.969080269f, 0.173229069f},
-std::array<float,2>{0.0459540933f, 0.121690772f},
-std::array<float,2>{0.73287499f, 0.964345872f},
-std::array<float,2>{0.382983774f, 0.542082012f},
-std::array<float,2>{0.827383578f, 0.473698229f},
-std::array<float,2>{0.365290552f, 0.298252642f},
-std::array<float,2>{0.995496869f, 0.650690734f},
-std::array<float,2>{0.23339653f, 0.831430614f},
-std::array<float,2>{0.560505867f, 0.148276597f},
-std::array<float,2>{0.44587177f, 0.243218809f},
-std::array<float,2>{0.780566931f, 0.805224597f},
-std::array<float,2>{0.0675836504f, 0.697022438f},
-std::array<float,2>{0.649291813f, 0.363265008f},
-std::array<float,2>{0.162418246f, 0.419926643f},
-std::array<float,2>{0.573331654f, 0.58824873f},
-std::array<float,2>{0.284291565f, 0.933924794f},
-std::array<float,2>{0.906551719f, 0.0339816399f},
-std::array<float,2>{0.218106046f, 0.156512544f},
-std::array<float,2>{0.502712607f, 0.866124332f},
-std::array<float,2>{0.341859996f, 0.667947292f},
-std::array<float,2>{0.959881246f, 0.273174644f},
-std::array<float,2>{0.418660462f, 0.44199568f},
-std::array<float,2>{0.845230758f, 0.501923561f},
-std::array<float,2>{0.0254330598f, 0.984921813f},
-std::array<float,2>{0.703693867f, 0.0696614683f},
-std::array<float,2>{0.261088818f, 0.0137208765f},
-std::array<float,2>{0.893341839f, 0.904108524f},
-std::array<float,2>{0.143324822f, 0.597639859f},
-std::array<float,2>{0.612113953f, 0.376686543f},
-std::array<float,2>{0.12150421f, 0.341042638f},
-std::array<float,2>{0.682919621f, 0.722065687f},
-std::array<float,2>{0.473326802f, 0.751006663f},
-std::array<float,2>{0.782227337f, 0.203044742f},
-std::array<float,2>{0.221416742f, 0.0709966794f},
-std::array<float,2>{0.549397707f, 0.996385694f},
-std::array<float,2>{0.370780915f, 0.508011699f},
-std::array<float,2>{0.984610379f, 0.449640512f},
-std::array<float,2>{0.379717767f, 0.275059998f},
-std::array<float,2>{0.818986893f, 0.664005935f},
-std::array<float,2>{0.0356299244f, 0.871898592f},
-std::array<float,2>{0.722329795f, 0.16935198f},
-std::array<float,2>{0.296016484f, 0.193145484f},
-std::array<float,2>{0.921478152f, 0.762439549f},
-std::array<float,2>{0.164684698f, 0.732157886f},
-std::array<float,2>{0.570286095f, 0.329838127f},
-std::array<float,2>{0.0719150603f, 0.385678262f},
-std::array<float,2>{0.647736371f, 0.603035152f},
-std::array<float,2>{0.438747436f, 0.897756457f},
-std::array<float,2>{0.773153782f, 0.00245252019f},
-std::array<float,2>{0.0176194515f, 0.15189974f},
-std::array<float,2>{0.714000344f, 0.837941885f},
-std::array<float,2>{0.410088331f, 0.646744788f},
-std::array<float,2>{0.856625974f, 0.311703891f},
-std::array<float,2>{0.33568877f, 0.484194696f},
-std::array<float,2>{0.965592206f, 0.536369741f},
-std::array<float,2>{0.208657235f, 0.958393633f},
-std::array<float,2>{0.510201395f, 0.113245741f},
-std::array<float,2>{0.480064571f, 0.0430018902f},
-std::array<float,2>{0.792313159f, 0.926854551f},
-std::array<float,2>{0.114607669f, 0.583519578f},
-std::array<float,2>{0.675956547f, 0.410347074f},
-std::array<float,2>{0.151030406f, 0.368935585f},
-std::array<float,2>{0.623936713f, 0.693326712f},
-std::array<float,2>{0.256352007f, 0.796932817f},
-std::array<float,2>{0.90182507f, 0.234802872f},
-std::array<float,2>{0.108834684f, 0.0275947135f},
-std::array<float,2>{0.661954403f, 0.877893806f},
-std::array<float,2>{0.496118486f, 0.613832891f},
-std::array<float,2>{0.809909999f, 0.40535903f},
-std::array<float,2>{0.280857801f, 0.320557684f},
-std::array<float,2>{0.888096929f, 0.735697269f},
-std::array<float,2>{0.133416831f, 0.771141827f},
-std::array<float,2>{0.605946958f, 0.2114003f},
-std::array<float,2>{0.424110264f, 0.18546553f},
-std::array<float,2>{0.860695183f, 0.84945327f},
-std::array<float,2>{0.011435695f, 0.672899485f},
-std::array<float,2>{0.69785589f, 0.260089666f},
-std::array<float,2>{0.200972721f, 0.456445485f},
-std::array<float,2>{0.526221097f, 0.518273115f},
-std::array<float,2>{0.31405279f, 0.973203659f},
-std::array<float,2>{0.942775965f, 0.0793685392f},
-std::array<float,2>{0.180556372f, 0.232727021f},
-std::array<float,2>{0.586685777f, 0.787500441f},
-std::array<float,2>{0.308057636f, 0.704082549f},
-std::array<float,2>{0.924115002f, 0.35075891f},
-std::array<float,2>{0.45754534f, 0.429027975f},
-std::array<float,2>{0.752900243f, 0.577163815f},
-std::array<float,2>{0.0845651031f, 0.913807929f},
-std::array<float,2>{0.634804964f, 0.0600706786f},
-std::array<float,2>{0.356153429f, 0.10927581f},
-std::array<float,2>{0.983287394f, 0.939109743f},
-std::array<float,2>{0.235552639f, 0.557884812f},
-std::array<float,2>{0.541536272f, 0.498961985f},
-std::array<float,2>{0.0547180735f, 0.292836308f},
-std::array<float,2>{0.749984384f, 0.633710384f},
-std::array<float,2>{0.392556697f, 0.817086101f},
-std::array<float,2>{0.82919389f, 0.140294999f},
-std::array<float,2>{0.154444531f, 0.0899165869f},
-std::array<float,2>{0.618308842f, 0.981510341f},
-std::array<float,2>{0.253535181f, 0.524876952f},
-std::array<float,2>{0.903396189f, 0.467337221f},
-std::array<float,2>{0.482105613f, 0.254010201f},
-std::array<float,2>{0.793321311f, 0.683701456f},
-std::array<float,2>{0.109970763f, 0.853271902f},
-std::array<float,2>{0.674347937f, 0.177071974f},
-std::array<float,2>{0.330335677f, 0.206805289f},
-std::array<float,2>{0.96253258f, 0.775804937f},
-std::array<float,2>{0.206395254f, 0.743360639f},
-std::array<float,2>{0.515143514f, 0.318158627f},
-std::array<float,2>{0.0212525949f, 0.392006248f},
-std::array<float,2>{0.715522408f, 0.622120917f},
-std::array<float,2>{0.411747515f, 0.888714552f},
-std::array<float,2>{0.852955341f, 0.0181904528f},
-std::array<float,2>{0.0748691261f, 0.126756266f},
-std::array<float,2>{0.642880857f, 0.820999444f},
-std::array<float,2>{0.445185155f, 0.632605076f},
-std::array<float,2>{0.765805185f, 0.286229461f},
-std::array<float,2>{0.292579561f, 0.48712644f},
-std::array<float,2>{0.915447712f, 0.550940752f},
-std::array<float,2>{0.1687406f, 0.945836842f},
-std::array<float,2>{0.563084066f, 0.0990828499f},
-std::array<float,2>{0.37799871f, 0.0492186993f},
-std::array<float,2>{0.812998474f, 0.920508504f},
-std::array<float,2>{0.0323052593f, 0.568912387f},
-std::array<float,2>{0.725848079f, 0.435940683f},
-std::array<float,2>{0.225008637f, 0.351600707f},
-std::array<float,2>{0.553380609f, 0.713627279f},
-std::array<float,2>{0.372445792f, 0.793718278f},
-std::array<float,2>{0.990657747f, 0.220133498f},
-std::array<float,2>{0.0611746013f, 0.0114923334f},
-std::array<float,2>{0.743318021f, 0.902323782f},
-std::array<float,2>{0.396441191f, 0.60049504f},
-std::array<float,2>{0.835582078f, 0.380090714f},
-std::array<float,2>{0.352725089f, 0.338784218f},
-std::array<float,2>{0.979395032f, 0.725794077f},
-std::array<float,2>{0.239911348f, 0.757032633f},
-std::array<float,2>{0.546496928f, 0.198814839f},
-std::array<float,2>{0.456325859f, 0.161915272f},
-std::array<float,2>{0.75466764f, 0.860488534f},
-std::array<float,2>{0.0795296356f, 0.671294749f},
-std::array<float,2>{0.637785614f, 0.268609792f},
-std::array<float,2>{0.184530571f, 0.437787414f},
-std::array<float,2>{0.590066195f, 0.504795909f},
-std::array<float,2>{0.309855402f, 0.990729153f},
-std::array<float,2>{0.929129779f, 0.0656238049f},
-std::array<float,2>{0.197588012f, 0.248472393f},
-std::array<float,2>{0.528273642f, 0.812008619f},
-std::array<float,2>{0.319079012f, 0.701667666f},
-std::array<float,2>{0.93752116f, 0.365521193f},
-std::array<float,2>{0.426461935f, 0.417785496f},
-std::array<float,2>{0.863744855f, 0.59136945f},
-std::array<float,2>{0.0132107046f, 0.933271587f},
-std::array<float,2>{0.699683964f, 0.0386410207f},
-std::array<float,2>{0.275854051f, 0.118947662f},
-std::array<float,2>{0.884904742f, 0.96798569f},
-std::array<float,2>{0.137241244f, 0.543570399f},
-std::array<float,2>{0.604272485f, 0.472110808f},
-std::array<float,2>{0.104284242f, 0.303590775f},
-std::array<float,2>{0.65987587f, 0.655965388f},
-std::array<float,2>{0.494452536f, 0.835045874f},
-std::array<float,2>{0.806974232f, 0.143599734f},
-std::array<float,2>{0.246257663f, 0.0414631478f},
-std::array<float,2>{0.538061202f, 0.925472617f},
-std::array<float,2>{0.348077238f, 0.578418374f},
-std::array<float,2>{0.973325849f, 0.408548445f},
-std::array<float,2>{0.398881257f, 0.371209741f},
-std::array<float,2>{0.837562978f, 0.68780297f},
-std::array<float,2>{0.0528796837f, 0.803952515f},
-std::array<float,2>{0.735661805f, 0.238803744f},
-std::array<float,2>{0.29731065f, 0.153553441f},
-std::array<float,2>{0.934978485f, 0.842250764f},
-std::array<float,2>{0.171920806f, 0.641103804f},
-std::array<float,2>{0.581754267f, 0.307380915f},
-std::array<float,2>{0.0898763165f, 0.479555607f},
-std::array<float,2>{0.62853229f, 0.532403886f},
-std::array<float,2>{0.4645513f, 0.95494467f},
-std::array<float,2>{0.763399065f, 0.116201483f},
-std::array<float,2>{0.00110333099f, 0.190319121f},
-std::array<float,2>{0.695084751f, 0.758800507f},
-std::array<float,2>{0.431690276f, 0.729645789f},
-std::array<float,2>{0.867807269f, 0.335411847f},
-std::array<float,2>{0.325553656f, 0.390551299f},
-std::array<float,2>{0.948552191f, 0.607642591f},
-std::array<float,2>{0.187929779f, 0.892789125f},
-std::array<float,2>{0.521571994f, 0.00765047781f},
-std::array<float,2>{0.48775363f, 0.0766483247f},
-std::array<float,2>{0.801772356f, 0.993775904f},
-std::array<float,2>{0.099224098f, 0.511765242f},
-std::array<float,2>{0.669842839f, 0.445413589f},
-std::array<float,2>{0.126902074f, 0.277366936f},
-std::array<float,2>{0.598601758f, 0.657974184f},
-std::array<float,2>{0.269661576f, 0.869205117f},
-std::array<float,2>{0.880917966f, 0.16785951f},
-std::array<float,2>{0.119032472f, 0.102902733f},
-std::array<float,2>{0.686387122f, 0.942818463f},
-std::array<float,2>{0.4704054f, 0.562350452f},
-std::array<float,2>{0.788636327f, 0.494689345f},
-std::array<float,2>{0.264553815f, 0.293047309f},
-std::array<float,2>{0.897316396f, 0.639983475f},
-std::array<float,2>{0.144948512f, 0.813232243f},
-std::array<float,2>{0.615675271f, 0.134001568f},
-std::array<float,2>{0.414739221f, 0.229836136f},
-std::array<float,2>{0.85029614f, 0.7847597f},
-std::array<float,2>{0.0298286378f, 0.710010171f},
-std::array<float,2>{0.710237324f, 0.347295612f},
-std::array<float,2>{0.212877676f, 0.422923148f},
-std::array<float,2>{0.506585956f, 0.573859751f},
-std::array<float,2>{0.33595404f, 0.906862676f},
-std::array<float,2>{0.955453336f, 0.0571494251f},
-std::array<float,2>{0.156570941f, 0.182469487f},
-std::array<float,2>{0.57641387f, 0.844517589f},
-std::array<float,2>{0.288306415f, 0.679353476f},
-std::array<float,2>{0.914013684f, 0.262993038f},
-std::array<float,2>{0.449860424f, 0.458968878f},
-std::array<float,2>{0.775965691f, 0.520700634f},
-std::array<float,2>{0.0658398196f, 0.972025096f},
-std::array<float,2>{0.653989911f, 0.0823550299f},
-std::array<float,2>{0.360278606f, 0.0254604053f},
-std::array<float,2>{0.996174276f, 0.879805624f},
-std::array<float,2>{0.229837403f, 0.613151968f},
-std::array<float,2>{0.555306375f, 0.401624739f},
-std::array<float,2>{0.0392244011f, 0.326093167f},
-std::array<float,2>{0.727973461f, 0.740584195f},
-std::array<float,2>{0.388424069f, 0.768722415f},
-std::array<float,2>{0.823392987f, 0.215870366f},
-std::array<float,2>{0.177820712f, 0.0197583362f},
-std::array<float,2>{0.583526731f, 0.883758187f},
-std::array<float,2>{0.301489264f, 0.618083715f},
-std::array<float,2>{0.930931211f, 0.397532493f},
-std::array<float,2>{0.468675345f, 0.316360384f},
-std::array<float,2>{0.75865674f, 0.749870718f},
-std::array<float,2>{0.0877199844f, 0.779785693f},
-std::array<float,2>{0.630964577f, 0.210848108f},
-std::array<float,2>{0.346984684f, 0.1755611f},
-std::array<float,2>{0.971235037f, 0.855763912f},
-std::array<float,2>{0.245109156f, 0.682147145f},
-std::array<float,2>{0.532621801f, 0.250325888f},
-std::array<float,2>{0.0469344631f, 0.461637259f},
-std::array<float,2>{0.740403414f, 0.531147242f},
-std::array<float,2>{0.404711545f, 0.978036523f},
-std::array<float,2>{0.841120839f, 0.0865870714f},
-std::array<float,2>{0.0954293609f, 0.226189911f},
-std::array<float,2>{0.666099846f, 0.792865872f},
-std::array<float,2>{0.49149251f, 0.717769325f},
-std::array<float,2>{0.800266564f, 0.359001666f},
-std::array<float,2>{0.267700672f, 0.42981115f},
-std::array<float,2>{0.878183663f, 0.564490318f},
-std::array<float,2>{0.129207388f, 0.914903045f},
-std::array<float,2>{0.594215512f, 0.0546694621f},
-std::array<float,2>{0.436737716f, 0.0947140902f},
-std::array<float,2>{0.873405159f, 0.952184856f},
-std::array<float,2>{0.00416813884f, 0.54826659f},
-std::array<float,2>{0.690337181f, 0.489234298f},
-std::array<float,2>{0.192549884f, 0.284904629f},
-std::array<float,2>{0.517272174f, 0.625060022f},
-std::array<float,2>{0.320345968f, 0.827772975f},
-std::array<float,2>{0.949379563f, 0.129417792f},
-std::array<float,2>{0.0253641475f, 0.0671045184f},
-std::array<float,2>{0.705373943f, 0.986724734f},
-std::array<float,2>{0.420412272f, 0.503017008f},
-std::array<float,2>{0.847012758f, 0.443806887f},
-std::array<float,2>{0.340035439f, 0.271460325f},
-std::array<float,2>{0.958068192f, 0.665097773f},
-std::array<float,2>{0.215556726f, 0.864928246f},
-std::array<float,2>{0.501389384f, 0.158908322f},
-std::array<float,2>{0.476204067f, 0.199851528f},
-std::array<float,2>{0.784166217f, 0.752524674f},
-std::array<float,2>{0.123586029f, 0.719766378f},
-std::array<float,2>{0.681469679f, 0.342758238f},
-std::array<float,2>{0.140890107f, 0.377703458f},
-std::array<float,2>{0.61046207f, 0.594237268f},
-std::array<float,2>{0.258194387f, 0.9058007f},
-std::array<float,2>{0.891541004f, 0.0126909893f},
-std::array<float,2>{0.231630728f, 0.146253452f},
-std::array<float,2>{0.561432362f, 0.828769624f},
-std::array<float,2>{0.363771766f, 0.64911443f},
-std::array<float,2>{0.993936837f, 0.299680412f},
-std::array<float,2>{0.386151642f, 0.47511524f},
-std::array<float,2>{0.824323654f, 0.540504277f},
-std::array<float,2>{0.0448108353f, 0.96279633f},
-std::array<float,2>{0.731121898f, 0.12360438f},
-std::array<float,2>{0.282462656f, 0.032655865f},
-std::array<float,2>{0.908771276f, 0.93585968f},
-std::array<float,2>{0.160273522f, 0.587563336f},
-std::array<float,2>{0.570859551f, 0.418592513f},
-std::array<float,2>{0.0696255043f, 0.360922605f},
-std::array<float,2>{0.650664866f, 0.697780371f},
-std::array<float,2>{0.448811978f, 0.808476985f},
-std::array<float,2>{0.778848767f, 0.245920494f},
-std::array<float,2>{0.210243046f, 0.110145174f},
-std::array<float,2>{0.508455634f, 0.959632874f},
-std::array<float,2>{0.33206746f, 0.538083375f},
-std::array<float,2>{0.967159092f, 0.482177973f},
-std::array<float,2>{0.406677753f, 0.309961796f},
-std::array<float,2>{0.858197272f, 0.646458566f},
-std::array<float,2>{0.0165597424f, 0.835958004f},
-std::array<float,2>{0.712455928f, 0.148759574f},
-std::array<float,2>{0.255379617f, 0.236718819f},
-std::array<float,2>{0.899830282f, 0.799029827f},
-std::array<float,2>{0.150311038f, 0.695155978f},
-std::array<float,2>{0.62217164f, 0.370895416f},
-std::array<float,2>{0.116551124f, 0.413974911f},
-std::array<float,2>{0.678289771f, 0.584644973f},
-std::array<float,2>{0.478027076f, 0.928391993f},
-std::array<float,2>{0.789596915f, 0.0456461199f},
-std::array<float,2>{0.0375213809f, 0.170374036f},
-std::array<float,2>{0.720511615f, 0.873898387f},
-std::array<float,2>{0.381258994f, 0.661596775f},
-std::array<float,2>{0.816786289f, 0.276222318f},
-std::array<float,2>{0.367581546f, 0.451294273f},
-std::array<float,2>{0.987371504f, 0.510874867f},
-std::array<float,2>{0.218951479f, 0.998909116f},
-std::array<float,2>{0.548675239f, 0.073777087f},
-std::array<float,2>{0.44099164f, 0.0011219281f},
-std::array<float,2>{0.770256281f, 0.896262944f},
-std::array<float,2>{0.0735690072f, 0.604943812f},
-std::array<float,2>{0.645971477f, 0.383191913f},
-std::array<float,2>{0.16775541f, 0.331417531f},
-std::array<float,2>{0.567088902f, 0.732815325f},
-std::array<float,2>{0.293607861f, 0.764087498f},
-std::array<float,2>{0.918712318f, 0.194862381f},
-std::array<float,2>{0.0835902616f, 0.0608963855f},
-std::array<float,2>{0.634197414f, 0.911359549f},
-std::array<float,2>{0.460793823f, 0.574354112f},
-std::array<float,2>{0.75135076f, 0.426807702f},
-std::array<float,2>{0.304940194f, 0.348181576f},
-std::array<float,2>{0.922766685f, 0.70633167f},
-std::array<float,2>{0.182920903f, 0.786263049f},
-std::array<float,2>{0.589574337f, 0.232013553f},
-std::array<float,2>{0.393470615f, 0.138620242f},
-std::array<float,2>{0.830644011f, 0.82009095f},
-std::array<float,2>{0.0582601652f, 0.63662982f},
-std::array<float,2>{0.747476816f, 0.289689153f},
-std::array<float,2>{0.236962214f, 0.496999294f},
-std::array<float,2>{0.539162874f, 0.556201518f},
-std::array<float,2>{0.357986987f, 0.940053165f},
-std::array<float,2>{0.980483174f, 0.107342258f},
-std::array<float,2>{0.136644766f, 0.214422852f},
-std::array<float,2>{0.60914588f, 0.772289336f},
-std::array<float,2>{0.278326184f, 0.738262951f},
-std::array<float,2>{0.88967067f, 0.323421597f},
-std::array<float,2>{0.498237967f, 0.403713644f},
-std::array<float,2>{0.810600519f, 0.615675747f},
-std::array<float,2>{0.106954619f, 0.876025736f},
-std::array<float,2>{0.662386835f, 0.0299949273f},
-std::array<float,2>{0.31475094f, 0.0815158263f},
-std::array<float,2>{0.944517732f, 0.97559762f},
-std::array<float,2>{0.202724054f, 0.515907764f},
-std::array<float,2>{0.52439183f, 0.454487532f},
-std::array<float,2>{0.00803882349f, 0.259006143f},
-std::array<float,2>{0.695972919f, 0.675455689f},
-std::array<float,2>{0.421883494f, 0.851178229f},
-std::array<float,2>{0.862177968f, 0.185628891f},
-std::array<float,2>{0.138146639f, 0.11920847f},
-std::array<float,2>{0.604902685f, 0.966629565f},
-std::array<float,2>{0.277317852f, 0.545735776f},
-std::array<float,2>{0.886239529f, 0.470633715f},
-std::array<float,2>{0.495420784f, 0.301513016f},
-std::array<float,2>{0.808250427f, 0.653255045f},
-std::array<float,2>{0.104624853f, 0.83295399f},
-std::array<float,2>{0.659129918f, 0.141669646f},
-std::array<float,2>{0.319980472f, 0.246518716f},
-std::array<float,2>{0.939203322f, 0.809667826f},
-std::array<float,2>{0.198329628f, 0.700651467f},
-std::array<float,2>{0.529224575f, 0.364361227f},
-std::array<float,2>{0.0118360752f, 0.415103257f},
-std::array<float,2>{0.70107007f, 0.593248606f},
-std::array<float,2>{0.427717894f, 0.930536211f},
-std::array<float,2>{0.864374936f, 0.0351566523f},
-std::array<float,2>{0.0783280879f, 0.16392839f},
-std::array<float,2>{0.637258708f, 0.862103701f},
-std::array<float,2>{0.455172896f, 0.668370247f},
-std::array<float,2>{0.75574553f, 0.267014772f},
-std::array<float,2>{0.309152007f, 0.440620333f},
-std::array<float,2>{0.928692162f, 0.506321073f},
-std::array<float,2>{0.185165301f, 0.988573492f},
-std::array<float,2>{0.590988994f, 0.0636820197f},
-std::array<float,2>{0.395493835f, 0.00886507519f},
-std::array<float,2>{0.834478319f, 0.899882078f},
-std::array<float,2>{0.0618610755f, 0.599573493f},
-std::array<float,2>{0.742884099f, 0.381096393f},
-std::array<float,2>{0.238636702f, 0.337494105f},
-std::array<float,2>{0.545073092f, 0.724213064f},
-std::array<float,2>{0.351664066f, 0.754352391f},
-std::array<float,2>{0.979522705f, 0.196591496f},
-std::array<float,2>{0.0320957042f, 0.046880722f},
-std::array<float,2>{0.725180268f, 0.918435931f},
-std::array<float,2>{0.377056897f, 0.567364573f},
-std::array<float,2>{0.814228892f, 0.434857965f},
-std::array<float,2>{0.371604234f, 0.354377776f},
-std::array<float,2>{0.991911173f, 0.711877763f},
-std::array<float,2>{0.225616977f, 0.795702934f},
-std::array<float,2>{0.554213107f, 0.220925659f},
-std::array<float,2>{0.443515569f, 0.128200188f},
-std::array<float,2>{0.767552555f, 0.824148953f},
-std::array<float,2>{0.0754909888f, 0.630821466f},
-std::array<float,2>{0.643807471f, 0.28756693f},
-std::array<float,2>{0.169166237f, 0.484861463f},
-std::array<float,2>{0.563740194f, 0.553043544f},
-std::array<float,2>{0.291969955f, 0.94851774f},
-std::array<float,2>{0.914496779f, 0.101364836f},
-std::array<float,2>{0.205638781f, 0.204149187f},
-std::array<float,2>{0.514140964f, 0.773518205f},
-std::array<float,2>{0.331962258f, 0.745094538f},
-std::array<float,2>{0.961144269f, 0.319090933f},
-std::array<float,2>{0.410955667f, 0.393499553f},
-std::array<float,2>{0.852241933f, 0.624422789f},
-std::array<float,2>{0.0195377599f, 0.88830936f},
-std::array<float,2>{0.716353238f, 0.0156765506f},
-std::array<float,2>{0.251991928f, 0.0927282348f},
-std::array<float,2>{0.902619898f, 0.98254925f},
-std::array<float,2>{0.156021222f, 0.526204228f},
-std::array<float,2>{0.617534935f, 0.465643495f},
-std::array<float,2>{0.110590562f, 0.257634431f},
-std::array<float,2>{0.674987793f, 0.686486542f},
-std::array<float,2>{0.481331587f, 0.8543185f},
-std::array<float,2>{0.794286966f, 0.178960219f},
-std::array<float,2>{0.228747264f, 0.0247516893f},
-std::array<float,2>{0.556488335f, 0.881813407f},
-std::array<float,2>{0.361161441f, 0.609542549f},
-std::array<float,2>{0.997833371f, 0.399281472f},
-std::array<float,2>{0.387561411f, 0.326646745f},
-std::array<float,2>{0.822931468f, 0.739232659f},
-std::array<float,2>{0.0401874445f, 0.765875161f},
-std::array<float,2>{0.726668f, 0.218333185f},
-std::array<float,2>{0.287999809f, 0.179816604f},
-std::array<float,2>{0.912380099f, 0.84707433f},
-std::array<float,2>{0.157429636f, 0.677371681f},
-std::array<float,2>{0.577790022f, 0.26503107f},
-std::array<float,2>{0.0653797835f, 0.459335327f},
-std::array<float,2>{0.653024733f, 0.521870792f},
-std::array<float,2>{0.450599492f, 0.969923377f},
-std::array<float,2>{0.776936114f, 0.084399268f},
-std::array<float,2>{0.0305129867f, 0.226645127f},
-std::array<float,2>{0.709773421f, 0.781929195f},
-std::array<float,2>{0.415377766f, 0.708083987f},
-std::array<float,2>{0.851174057f, 0.344294012f},
-std::array<float,2>{0.337243885f, 0.424226105f},
-std::array<float,2>{0.956671536f, 0.571624339f},
-std::array<float,2>{0.211016625f, 0.908262372f},
-std::array<float,2>{0.506900489f, 0.0558222011f},
-std::array<float,2>{0.469152719f, 0.105463922f},
-std::array<float,2>{0.787340045f, 0.943712652f},
-std::array<float,2>{0.118004657f, 0.559553921f},
-std::array<float,2>{0.686570108f, 0.492349178f},
-std::array<float,2>{0.145906851f, 0.295900583f},
-std::array<float,2>{0.616352856f, 0.636989892f},
-std::array<float,2>{0.265593708f, 0.816124678f},
-std::array<float,2>{0.898074031f, 0.135719597f},
-std::array<float,2>{0.098276116f, 0.0755884051f},
-std::array<float,2>{0.668944597f, 0.995918572f},
-std::array<float,2>{0.487007827f, 0.515393555f},
-std::array<float,2>{0.801571071f, 0.448682487f},
-std::array<float,2>{0.271343678f, 0.281123281f},
-std::array<float,2>{0.882734478f, 0.658698201f},
-std::array<float,2>{0.125237718f, 0.86876291f},
-std::array<float,2>{0.598787129f, 0.165042162f},
-std::array<float,2>{0.432828307f, 0.188640907f},
-std::array<float,2>{0.86887455f, 0.760650635f},
-std::array<float,2>{0.000491861545f, 0.727051735f},
-std::array<float,2>{0.69356972f, 0.333745807f},
-std::array<float,2>{0.188716024f, 0.388667822f},
-std::array<float,2>{0.522481203f, 0.605655253f},
-std::array<float,2>{0.324640512f, 0.891202748f},
-std::array<float,2>{0.947653413f, 0.00517373206f},
-std::array<float,2>{0.17294848f, 0.155930266f},
-std::array<float,2>{0.581053078f, 0.841336191f},
-std::array<float,2>{0.298568964f, 0.643206537f},
-std::array<float,2>{0.934086621f, 0.305666506f},
-std::array<float,2>{0.463311017f, 0.478329003f},
-std::array<float,2>{0.762155235f, 0.533971608f},
-std::array<float,2>{0.0911356732f, 0.956130087f},
-std::array<float,2>{0.627577305f, 0.113541856f},
-std::array<float,2>{0.348984867f, 0.0408473425f},
-std::array<float,2>{0.97414726f, 0.923688471f},
-std::array<float,2>{0.247608855f, 0.580508769f},
-std::array<float,2>{0.538798809f, 0.407994658f},
-std::array<float,2>{0.0544827729f, 0.37357375f},
-std::array<float,2>{0.735055506f, 0.689561725f},
-std::array<float,2>{0.399600118f, 0.801415086f},
-std::array<float,2>{0.836735725f, 0.242084965f},
-std::array<float,2>{0.161927611f, 0.0345578194f},
-std::array<float,2>{0.572075546f, 0.935151935f},
-std::array<float,2>{0.281294465f, 0.589513302f},
-std::array<float,2>{0.909549236f, 0.421131313f},
-std::array<float,2>{0.44778645f, 0.361461878f},
-std::array<float,2>{0.778246939f, 0.695787549f},
-std::array<float,2>{0.0692143068f, 0.806594312f},
-std::array<float,2>{0.65232563f, 0.242718026f},
-std::array<float,2>{0.365213186f, 0.146817952f},
-std::array<float,2>{0.993028879f, 0.830082536f},
-std::array<float,2>{0.230557278f, 0.651390553f},
-std::array<float,2>{0.561697304f, 0.29748717f},
-std::array<float,2>{0.0433585867f, 0.47284928f},
-std::array<float,2>{0.732061028f, 0.541417241f},
-std::array<float,2>{0.385237694f, 0.963667929f},
-std::array<float,2>{0.825369835f, 0.12247365f},
-std::array<float,2>{0.124953553f, 0.201527372f},
-std::array<float,2>{0.679850936f, 0.750386894f},
-std::array<float,2>{0.474824458f, 0.721104503f},
-std::array<float,2>{0.784789085f, 0.340369016f},
-std::array<float,2>{0.259741306f, 0.375197709f},
-std::array<float,2>{0.891648352f, 0.59644717f},
-std::array<float,2>{0.142378047f, 0.903143644f},
-std::array<float,2>{0.609738052f, 0.0146907475f},
-std::array<float,2>{0.42106849f, 0.0686497018f},
-std::array<float,2>{0.846485496f, 0.985464811f},
-std::array<float,2>{0.0236307289f, 0.500963449f},
-std::array<float,2>{0.706140637f, 0.443240762f},
-std::array<float,2>{0.216689274f, 0.272079468f},
-std::array<float,2>{0.500691414f, 0.666377723f},
-std::array<float,2>{0.341097265f, 0.866290331f},
-std::array<float,2>{0.957081437f, 0.157606661f},
-std::array<float,2>{0.00493176561f, 0.0967177898f},
-std::array<float,2>{0.691286445f, 0.951115668f},
-std::array<float,2>{0.436115384f, 0.548978984f},
-std::array<float,2>{0.874313176f, 0.491338015f},
-std::array<float,2>{0.322123975f, 0.283063978f},
-std::array<float,2>{0.950620055f, 0.628578663f},
-std::array<float,2>{0.191595852f, 0.826098144f},
-std::array<float,2>{0.516548753f, 0.132755488f},
-std::array<float,2>{0.490833431f, 0.224315286f},
-std::array<float,2>{0.799255788f, 0.790183961f},
-std::array<float,2>{0.0937544331f, 0.715248525f},
-std::array<float,2>{0.6670174f, 0.355849773f},
-std::array<float,2>{0.130277097f, 0.433352977f},
-std::array<float,2>{0.595690429f, 0.563967824f},
-std::array<float,2>{0.269426703f, 0.917585731f},
-std::array<float,2>{0.877343178f, 0.0519979633f},
-std::array<float,2>{0.245609552f, 0.172753334f},
-std::array<float,2>{0.531754076f, 0.858062506f},
-std::array<float,2>{0.346019447f, 0.679835021f},
-std::array<float,2>{0.971990764f, 0.253740251f},
-std::array<float,2>{0.405519336f, 0.46328178f},
-std::array<float,2>{0.840636671f, 0.527464986f},
-std::array<float,2>{0.0483027846f, 0.979710042f},
-std::array<float,2>{0.742121696f, 0.0885157213f},
-std::array<float,2>{0.302140862f, 0.0218901243f},
-std::array<float,2>{0.929754317f, 0.885253906f},
-std::array<float,2>{0.179209605f, 0.619985521f},
-std::array<float,2>{0.582530439f, 0.394874275f},
-std::array<float,2>{0.0864279643f, 0.313842118f},
-std::array<float,2>{0.631997168f, 0.748022854f},
-std::array<float,2>{0.467311382f, 0.778306723f},
-std::array<float,2>{0.759200096f, 0.20868586f},
-std::array<float,2>{0.201339036f, 0.0784076005f},
-std::array<float,2>{0.525219381f, 0.974576831f},
-std::array<float,2>{0.316250503f, 0.518684089f},
-std::array<float,2>{0.94399935f, 0.455774128f},
-std::array<float,2>{0.422857732f, 0.261446953f},
-std::array<float,2>{0.862760782f, 0.672441423f},
-std::array<float,2>{0.00930119399f, 0.847786963f},
-std::array<float,2>{0.696673393f, 0.183900937f},
-std::array<float,2>{0.277989566f, 0.212041587f},
-std::array<float,2>{0.889457583f, 0.770283639f},
-std::array<float,2>{0.135073215f, 0.734948397f},
-std::array<float,2>{0.607919455f, 0.321566254f},
-std::array<float,2>{0.105974235f, 0.404594481f},
-std::array<float,2>{0.663253069f, 0.614463925f},
-std::array<float,2>{0.499537528f, 0.878642738f},
-std::array<float,2>{0.812112093f, 0.0285887476f},
-std::array<float,2>{0.0569898486f, 0.139268428f},
-std::array<float,2>{0.746277571f, 0.817505598f},
-std::array<float,2>{0.393701822f, 0.634145737f},
-std::array<float,2>{0.831202328f, 0.291331738f},
-std::array<float,2>{0.358747989f, 0.499407649f},
-std::array<float,2>{0.982332766f, 0.557340324f},
-std::array<float,2>{0.237782925f, 0.937632382f},
-std::array<float,2>{0.540575922f, 0.107670598f},
-std::array<float,2>{0.459714711f, 0.0586140566f},
-std::array<float,2>{0.75080353f, 0.9122594f},
-std::array<float,2>{0.0826954246f, 0.576323211f},
-std::array<float,2>{0.633608878f, 0.428616822f},
-std::array<float,2>{0.181924209f, 0.349835366f},
-std::array<float,2>{0.588341773f, 0.704339027f},
-std::array<float,2>{0.306132823f, 0.788279295f},
-std::array<float,2>{0.922989488f, 0.233604565f},
-std::array<float,2>{0.0732122138f, 0.00333864102f},
-std::array<float,2>{0.645099878f, 0.897418141f},
-std::array<float,2>{0.439642221f, 0.601659298f},
-std::array<float,2>{0.771341324f, 0.38608411f},
-std::array<float,2>{0.294404417f, 0.329100996f},
-std::array<float,2>{0.919118226f, 0.731346965f},
-std::array<float,2>{0.166550249f, 0.762869298f},
-std::array<float,2>{0.567537308f, 0.192381009f},
-std::array<float,2>{0.38249138f, 0.168045685f},
-std::array<float,2>{0.818070889f, 0.872813702f},
-std::array<float,2>{0.0381405614f, 0.662936032f},
-std::array<float,2>{0.71880722f, 0.273772448f},
-std::array<float,2>{0.220455334f, 0.451157123f},
-std::array<float,2>{0.547757924f, 0.508951664f},
-std::array<float,2>{0.368464768f, 0.997677743f},
-std::array<float,2>{0.986970544f, 0.0718349218f},
-std::array<float,2>{0.148785681f, 0.235875964f},
-std::array<float,2>{0.621113956f, 0.798706949f},
-std::array<float,2>{0.254586011f, 0.691992521f},
-std::array<float,2>{0.898914099f, 0.367229104f},
-std::array<float,2>{0.477370292f, 0.411533266f},
-std::array<float,2>{0.790487826f, 0.58242929f},
-std::array<float,2>{0.115439951f, 0.926704526f},
-std::array<float,2>{0.678829491f, 0.044565551f},
-std::array<float,2>{0.333336711f, 0.111667439f},
-std::array<float,2>{0.967858195f, 0.957883894f},
-std::array<float,2>{0.209502563f, 0.535221934f},
-std::array<float,2>{0.508985758f, 0.483200878f},
-std::array<float,2>{0.017252231f, 0.311423928f},
-std::array<float,2>{0.711163282f, 0.648433924f},
-std::array<float,2>{0.407585472f, 0.839581609f},
-std::array<float,2>{0.858867466f, 0.150962159f},
-std::array<float,2>{0.186080813f, 0.0652822629f},
-std::array<float,2>{0.593511164f, 0.991873622f},
-std::array<float,2>{0.312141448f, 0.504954398f},
-std::array<float,2>{0.927304149f, 0.438592374f},
-std::array<float,2>{0.454935431f, 0.267804414f},
-std::array<float,2>{0.757799089f, 0.67000109f},
-std::array<float,2>{0.0809705555f, 0.859876633f},
-std::array<float,2>{0.638963223f, 0.160515949f},
-std::array<float,2>{0.355064511f, 0.197910815f},
-std::array<float,2>{0.976772189f, 0.756251812f},
-std::array<float,2>{0.240953431f, 0.725311518f},
-std::array<float,2>{0.543424547f, 0.339722991f},
-std::array<float,2>{0.0603598915f, 0.378912151f},
-std::array<float,2>{0.744250476f, 0.601094604f},
-std::array<float,2>{0.396988839f, 0.901036799f},
-std::array<float,2>{0.83380872f, 0.0101297833f},
-std::array<float,2>{0.102450222f, 0.142666459f},
-std::array<float,2>{0.657792389f, 0.834300876f},
-std::array<float,2>{0.492689103f, 0.654395521f},
-std::array<float,2>{0.805620253f, 0.303954035f},
-std::array<float,2>{0.275179654f, 0.470974505f},
-std::array<float,2>{0.884750783f, 0.5441522f},
-std::array<float,2>{0.13877064f, 0.967219293f},
-std::array<float,2>{0.603250146f, 0.117781036f},
-std::array<float,2>{0.428678304f, 0.0378616266f},
-std::array<float,2>{0.865551472f, 0.932318866f},
-std::array<float,2>{0.013978078f, 0.590743482f},
-std::array<float,2>{0.701389253f, 0.416514874f},
-std::array<float,2>{0.195453241f, 0.366529614f},
-std::array<float,2>{0.530095339f, 0.702342629f},
-std::array<float,2>{0.318325132f, 0.810937881f},
-std::array<float,2>{0.941047132f, 0.249870792f},
-std::array<float,2>{0.0216144808f, 0.0186234321f},
-std::array<float,2>{0.716836512f, 0.890387237f},
-std::array<float,2>{0.412785262f, 0.62155968f},
-std::array<float,2>{0.85507524f, 0.390923262f},
-std::array<float,2>{0.329014868f, 0.316894382f},
-std::array<float,2>{0.963869452f, 0.742266715f},
-std::array<float,2>{0.204630241f, 0.776955724f},
-std::array<float,2>{0.512955189f, 0.205575049f},
-std::array<float,2>{0.482471108f, 0.176488876f},
-std::array<float,2>{0.796501517f, 0.851910889f},
-std::array<float,2>{0.112338871f, 0.685291111f},
-std::array<float,2>{0.673307717f, 0.255138934f},
-std::array<float,2>{0.153824419f, 0.468106002f},
-std::array<float,2>{0.620043993f, 0.523670852f},
-std::array<float,2>{0.250004262f, 0.980753362f},
-std::array<float,2>{0.905521691f, 0.0913420767f},
-std::array<float,2>{0.224177808f, 0.219176769f},
-std::array<float,2>{0.552563965f, 0.794858992f},
-std::array<float,2>{0.373646498f, 0.714482129f},
-std::array<float,2>{0.988901019f, 0.352781743f},
-std::array<float,2>{0.376155555f, 0.437407076f},
-std::array<float,2>{0.816308737f, 0.569579184f},
-std::array<float,2>{0.0338037871f, 0.921699286f},
-std::array<float,2>{0.722887695f, 0.0503402613f},
-std::array<float,2>{0.289415032f, 0.098459661f},
-std::array<float,2>{0.917405188f, 0.946314633f},
-std::array<float,2>{0.170987591f, 0.552624822f},
-std::array<float,2>{0.564478099f, 0.48760131f},
-std::array<float,2>{0.0763461217f, 0.285981447f},
-std::array<float,2>{0.641952455f, 0.631712973f},
-std::array<float,2>{0.442512214f, 0.822187424f},
-std::array<float,2>{0.769439757f, 0.125867143f},
-std::array<float,2>{0.214168951f, 0.0585903935f},
-std::array<float,2>{0.503994286f, 0.908010602f},
-std::array<float,2>{0.33947891f, 0.57282871f},
-std::array<float,2>{0.954656601f, 0.422770143f},
-std::array<float,2>{0.416440904f, 0.346097499f},
-std::array<float,2>{0.84942162f, 0.709667623f},
-std::array<float,2>{0.0287442375f, 0.783343971f},
-std::array<float,2>{0.708100379f, 0.229410619f},
-std::array<float,2>{0.26262188f, 0.133449256f},
-std::array<float,2>{0.895906866f, 0.813486934f},
-std::array<float,2>{0.147197977f, 0.638739645f},
-std::array<float,2>{0.613658726f, 0.294381261f},
-std::array<float,2>{0.120475464f, 0.495332122f},
-std::array<float,2>{0.683734775f, 0.560689926f},
-std::array<float,2>{0.471731603f, 0.942004561f},
-std::array<float,2>{0.785448611f, 0.101813212f},
-std::array<float,2>{0.0420381092f, 0.215160951f},
-std::array<float,2>{0.729584157f, 0.768358171f},
-std::array<float,2>{0.389424443f, 0.742063284f},
-std::array<float,2>{0.821643829f, 0.32425335f},
-std::array<float,2>{0.361635089f, 0.401042938f},
-std::array<float,2>{0.999191821f, 0.611498415f},
-std::array<float,2>{0.227322489f, 0.880123198f},
-std::array<float,2>{0.556859791f, 0.0269641336f},
-std::array<float,2>{0.45203647f, 0.0837662145f},
-std::array<float,2>{0.774621129f, 0.971550345f},
-std::array<float,2>{0.0633584484f, 0.520444453f},
-std::array<float,2>{0.654771686f, 0.457717717f},
-std::array<float,2>{0.159459308f, 0.262634158f},
-std::array<float,2>{0.575206697f, 0.678220987f},
-std::array<float,2>{0.28618899f, 0.845215082f},
-std::array<float,2>{0.91178894f, 0.18359068f},
-std::array<float,2>{0.0921349004f, 0.116535261f},
-std::array<float,2>{0.626061559f, 0.953949571f},
-std::array<float,2>{0.462056309f, 0.531908333f},
-std::array<float,2>{0.764591753f, 0.479054928f},
-std::array<float,2>{0.299208254f, 0.308524609f},
-std::array<float,2>{0.935897171f, 0.642360747f},
-std::array<float,2>{0.174907044f, 0.842876017f},
-std::array<float,2>{0.578758419f, 0.152457952f},
-std::array<float,2>{0.401523173f, 0.239573389f},
-std::array<float,2>{0.838115633f, 0.803311765f},
-std::array<float,2>{0.0515886061f, 0.688765764f},
-std::array<float,2>{0.737518847f, 0.372070342f},
-std::array<float,2>{0.248823777f, 0.409451902f},
-std::array<float,2>{0.536091805f, 0.579452157f},
-std::array<float,2>{0.350049019f, 0.924040735f},
-std::array<float,2>{0.975004613f, 0.0427820422f},
-std::array<float,2>{0.127439171f, 0.166232392f},
-std::array<float,2>{0.600279987f, 0.870439947f},
-std::array<float,2>{0.271688342f, 0.656594753f},
-std::array<float,2>{0.880429864f, 0.278540254f},
-std::array<float,2>{0.485894024f, 0.447060347f},
-std::array<float,2>{0.8028965f, 0.513597488f},
-std::array<float,2>{0.10049703f, 0.99230063f},
-std::array<float,2>{0.670194745f, 0.0777464882f},
-std::array<float,2>{0.327014059f, 0.00619842065f},
-std::array<float,2>{0.946553946f, 0.894352496f},
-std::array<float,2>{0.190543994f, 0.608430803f},
-std::array<float,2>{0.520776808f, 0.389202505f},
-std::array<float,2>{0.0023961626f, 0.334875196f},
-std::array<float,2>{0.692382216f, 0.729153872f},
-std::array<float,2>{0.430645764f, 0.758678794f},
-std::array<float,2>{0.869698584f, 0.190494657f},
-std::array<float,2>{0.144163251f, 0.0129227471f},
-std::array<float,2>{0.612726569f, 0.904308915f},
-std::array<float,2>{0.259798348f, 0.595138788f},
-std::array<float,2>{0.894051969f, 0.377980739f},
-std::array<float,2>{0.474285126f, 0.343319744f},
-std::array<float,2>{0.782221258f, 0.718975186f},
-std::array<float,2>{0.122769825f, 0.75301075f},
-std::array<float,2>{0.68225646f, 0.200565442f},
-std::array<float,2>{0.34282276f, 0.159482062f},
-std::array<float,2>{0.960581601f, 0.863667428f},
-std::array<float,2>{0.217166215f, 0.664588928f},
-std::array<float,2>{0.503302097f, 0.270095199f},
-std::array<float,2>{0.0264558531f, 0.445195764f},
-std::array<float,2>{0.704498768f, 0.502669752f},
-std::array<float,2>{0.419263393f, 0.98732394f},
-std::array<float,2>{0.844688296f, 0.0681913123f},
-std::array<float,2>{0.0669604763f, 0.244707659f},
-std::array<float,2>{0.650094748f, 0.806860387f},
-std::array<float,2>{0.447012335f, 0.699199438f},
-std::array<float,2>{0.780061066f, 0.36003983f},
-std::array<float,2>{0.284099072f, 0.419094682f},
-std::array<float,2>{0.907535911f, 0.586580336f},
-std::array<float,2>{0.163175732f, 0.937224686f},
-std::array<float,2>{0.572852492f, 0.0319997147f},
-std::array<float,2>{0.384475172f, 0.124614455f},
-std::array<float,2>{0.827139258f, 0.961163163f},
-std::array<float,2>{0.0450004414f, 0.539552748f},
-std::array<float,2>{0.733771682f, 0.476037174f},
-std::array<float,2>{0.233732015f, 0.299817383f},
-std::array<float,2>{0.559568703f, 0.649790347f},
-std::array<float,2>{0.366658032f, 0.829718351f},
-std::array<float,2>{0.994178534f, 0.145263091f},
-std::array<float,2>{0.0494131744f, 0.0876524523f},
-std::array<float,2>{0.738382638f, 0.977095902f},
-std::array<float,2>{0.40406239f, 0.530174136f},
-std::array<float,2>{0.842973888f, 0.462863892f},
-std::array<float,2>{0.344332606f, 0.251875579f},
-std::array<float,2>{0.97022599f, 0.682979405f},
-std::array<float,2>{0.243502438f, 0.856660783f},
-std::array<float,2>{0.533724964f, 0.174702302f},
-std::array<float,2>{0.465283066f, 0.209609196f},
-std::array<float,2>{0.761588991f, 0.780967355f},
-std::array<float,2>{0.0894182399f, 0.74886483f},
-std::array<float,2>{0.630096197f, 0.315315038f},
-std::array<float,2>{0.176267505f, 0.396900445f},
-std::array<float,2>{0.583990514f, 0.618193984f},
-std::array<float,2>{0.304288298f, 0.884221137f},
-std::array<float,2>{0.932220459f, 0.0209084041f},
-std::array<float,2>{0.194652528f, 0.13015911f},
-std::array<float,2>{0.518797636f, 0.826918781f},
-std::array<float,2>{0.322272152f, 0.626717865f},
-std::array<float,2>{0.951388657f, 0.284013003f},
-std::array<float,2>{0.434350312f, 0.489602774f},
-std::array<float,2>{0.872670233f, 0.547186136f},
-std::array<float,2>{0.00718508661f, 0.952144146f},
-std::array<float,2>{0.688975215f, 0.0956533402f},
-std::array<float,2>{0.267215073f, 0.05347405f},
-std::array<float,2>{0.875739336f, 0.91515094f},
-std::array<float,2>{0.131562725f, 0.565894425f},
-std::array<float,2>{0.595728278f, 0.431009769f},
-std::array<float,2>{0.0968793184f, 0.357601672f},
-std::array<float,2>{0.664981544f, 0.718393922f},
-std::array<float,2>{0.489141047f, 0.791100681f},
-std::array<float,2>{0.797971785f, 0.225509986f},
-std::array<float,2>{0.234904289f, 0.106382295f},
-std::array<float,2>{0.542356372f, 0.941404343f},
-std::array<float,2>{0.356991351f, 0.554687977f},
-std::array<float,2>{0.984081149f, 0.497759461f},
-std::array<float,2>{0.391302824f, 0.290576607f},
-std::array<float,2>{0.828911006f, 0.635200739f},
-std::array<float,2>{0.0563064776f, 0.819188893f},
-std::array<float,2>{0.74880451f, 0.136754543f},
-std::array<float,2>{0.307023793f, 0.230500996f},
-std::array<float,2>{0.92567265f, 0.786112547f},
-std::array<float,2>{0.180820867f, 0.705124259f},
-std::array<float,2>{0.587001085f, 0.348849833f},
-std::array<float,2>{0.0853000134f, 0.426057875f},
-std::array<float,2>{0.63661027f, 0.575310767f},
-std::array<float,2>{0.458518326f, 0.911067963f},
-std::array<float,2>{0.752990603f, 0.0622480698f},
-std::array<float,2>{0.00981640443f, 0.187133238f},
-std::array<float,2>{0.698983312f, 0.850022256f},
-std::array<float,2>{0.425562203f, 0.674464047f},
-std::array<float,2>{0.859430492f, 0.25813657f},
-std::array<float,2>{0.312621951f, 0.453274697f},
-std::array<float,2>{0.942298293f, 0.516945958f},
-std::array<float,2>{0.199913308f, 0.974947691f},
-std::array<float,2>{0.526869953f, 0.0806697533f},
-std::array<float,2>{0.497888774f, 0.0312251821f},
-std::array<float,2>{0.809523642f, 0.875662267f},
-std::array<float,2>{0.107670069f, 0.61658597f},
-std::array<float,2>{0.660266459f, 0.402610332f},
-std::array<float,2>{0.134498149f, 0.322809517f},
-std::array<float,2>{0.60658586f, 0.736837626f},
-std::array<float,2>{0.279679656f, 0.772588074f},
-std::array<float,2>{0.88731277f, 0.213330135f},
-std::array<float,2>{0.113325551f, 0.0465981886f},
-std::array<float,2>{0.677349806f, 0.929259181f},
-std::array<float,2>{0.478848249f, 0.585495055f},
-std::array<float,2>{0.791965067f, 0.413018763f},
-std::array<float,2>{0.257411599f, 0.370056808f},
-std::array<float,2>{0.900640726f, 0.693619192f},
-std::array<float,2>{0.15174675f, 0.800762951f},
-std::array<float,2>{0.624455631f, 0.237741709f},
-std::array<float,2>{0.408928633f, 0.149620578f},
-std::array<float,2>{0.856081963f, 0.837865591f},
-std::array<float,2>{0.0188052505f, 0.644886434f},
-std::array<float,2>{0.713075936f, 0.309268296f},
-std::array<float,2>{0.20784013f, 0.480518192f},
-std::array<float,2>{0.511436403f, 0.538217187f},
-std::array<float,2>{0.334490657f, 0.960586905f},
-std::array<float,2>{0.966279626f, 0.110881053f},
-std::array<float,2>{0.16574505f, 0.194309607f},
-std::array<float,2>{0.56853193f, 0.764985681f},
-std::array<float,2>{0.295144111f, 0.733402133f},
-std::array<float,2>{0.920235693f, 0.33060813f},
-std::array<float,2>{0.438275576f, 0.384559333f},
-std::array<float,2>{0.77154094f, 0.604144573f},
-std::array<float,2>{0.0704489052f, 0.8947891f},
-std::array<float,2>{0.646892667f, 0.000760161201f},
-std::array<float,2>{0.369856745f, 0.0731716529f},
-std::array<float,2>{0.986298144f, 0.999878109f},
-std::array<float,2>{0.221850544f, 0.510516644f},
-std::array<float,2>{0.550328016f, 0.45253402f},
-std::array<float,2>{0.036184974f, 0.277309507f},
-std::array<float,2>{0.721267641f, 0.660158098f},
-std::array<float,2>{0.380082607f, 0.874312818f},
-std::array<float,2>{0.819710135f, 0.171718225f}}
\ No newline at end of file
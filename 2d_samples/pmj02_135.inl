@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.203858882f, 0.797032833f},
-std::array<float,2>{0.892523766f, 0.441579163f},
-std::array<float,2>{0.407151997f, 0.0233917385f},
-std::array<float,2>{0.644022763f, 0.690212846f},
-std::array<float,2>{0.334998846f, 0.524249792f},
-std::array<float,2>{0.555751503f, 0.192193568f},
-std::array<float,2>{0.0291189123f, 0.25819692f},
-std::array<float,2>{0.760083973f, 0.976848543f},
-std::array<float,2>{0.0948297009f, 0.635060787f},
-std::array<float,2>{0.865484834f, 0.089720048f},
-std::array<float,2>{0.265196323f, 0.397465646f},
-std::array<float,2>{0.623164892f, 0.836701274f},
-std::array<float,2>{0.475756586f, 0.912104547f},
-std::array<float,2>{0.731368124f, 0.34919104f},
-std::array<float,2>{0.138763994f, 0.15922524f},
-std::array<float,2>{0.96198684f, 0.571642935f},
-std::array<float,2>{0.0532597825f, 0.953336298f},
-std::array<float,2>{0.79172045f, 0.286885858f},
-std::array<float,2>{0.344946623f, 0.227497235f},
-std::array<float,2>{0.528218329f, 0.549673855f},
-std::array<float,2>{0.397521913f, 0.734130561f},
-std::array<float,2>{0.661419332f, 0.0528524034f},
-std::array<float,2>{0.246129334f, 0.498851538f},
-std::array<float,2>{0.928507626f, 0.777858555f},
-std::array<float,2>{0.163662165f, 0.620304585f},
-std::array<float,2>{0.983067453f, 0.1562116f},
-std::array<float,2>{0.45795399f, 0.327422649f},
-std::array<float,2>{0.707488954f, 0.883500159f},
-std::array<float,2>{0.287198424f, 0.872861087f},
-std::array<float,2>{0.56512475f, 0.410695046f},
-std::array<float,2>{0.0864644647f, 0.105648771f},
-std::array<float,2>{0.830015421f, 0.674185276f},
-std::array<float,2>{0.145617545f, 0.902712464f},
-std::array<float,2>{0.940263271f, 0.330396593f},
-std::array<float,2>{0.489332139f, 0.138494521f},
-std::array<float,2>{0.742275119f, 0.596361637f},
-std::array<float,2>{0.277266234f, 0.665036976f},
-std::array<float,2>{0.598041534f, 0.112179466f},
-std::array<float,2>{0.113281518f, 0.431559324f},
-std::array<float,2>{0.849877894f, 0.85550642f},
-std::array<float,2>{0.00682157231f, 0.543917596f},
-std::array<float,2>{0.777728021f, 0.241208389f},
-std::array<float,2>{0.321019083f, 0.299486369f},
-std::array<float,2>{0.538520873f, 0.941763461f},
-std::array<float,2>{0.435276687f, 0.755790234f},
-std::array<float,2>{0.626712561f, 0.475175381f},
-std::array<float,2>{0.198607326f, 0.0456907414f},
-std::array<float,2>{0.881435573f, 0.745467901f},
-std::array<float,2>{0.0719156191f, 0.812943637f},
-std::array<float,2>{0.814076006f, 0.376947641f},
-std::array<float,2>{0.303506076f, 0.0747235566f},
-std::array<float,2>{0.587246954f, 0.653481662f},
-std::array<float,2>{0.441132486f, 0.582971513f},
-std::array<float,2>{0.700124919f, 0.172124118f},
-std::array<float,2>{0.175892949f, 0.367257237f},
-std::array<float,2>{0.986017883f, 0.929511189f},
-std::array<float,2>{0.21928221f, 0.711602688f},
-std::array<float,2>{0.91003716f, 0.00154905533f},
-std::array<float,2>{0.386837095f, 0.453237683f},
-std::array<float,2>{0.676249444f, 0.782782972f},
-std::array<float,2>{0.362486869f, 0.984396458f},
-std::array<float,2>{0.504981458f, 0.26817596f},
-std::array<float,2>{0.034213528f, 0.206252769f},
-std::array<float,2>{0.806237459f, 0.515462041f},
-std::array<float,2>{0.181877881f, 0.847751081f},
-std::array<float,2>{0.997891784f, 0.425121516f},
-std::array<float,2>{0.451130062f, 0.123049125f},
-std::array<float,2>{0.688606203f, 0.656559527f},
-std::array<float,2>{0.308212548f, 0.609220803f},
-std::array<float,2>{0.585447013f, 0.13086386f},
-std::array<float,2>{0.0697878376f, 0.337326735f},
-std::array<float,2>{0.821581602f, 0.89366883f},
-std::array<float,2>{0.0405593403f, 0.735280275f},
-std::array<float,2>{0.79980576f, 0.0388865955f},
-std::array<float,2>{0.374758542f, 0.479913503f},
-std::array<float,2>{0.515005171f, 0.759033084f},
-std::array<float,2>{0.378568918f, 0.951411843f},
-std::array<float,2>{0.682780564f, 0.308468401f},
-std::array<float,2>{0.230273664f, 0.247060612f},
-std::array<float,2>{0.920321465f, 0.534017324f},
-std::array<float,2>{0.122228496f, 0.930253267f},
-std::array<float,2>{0.852124155f, 0.363938361f},
-std::array<float,2>{0.266912639f, 0.182417542f},
-std::array<float,2>{0.606351674f, 0.587576509f},
-std::array<float,2>{0.495955557f, 0.641768932f},
-std::array<float,2>{0.740915954f, 0.0658510625f},
-std::array<float,2>{0.15206489f, 0.385228902f},
-std::array<float,2>{0.949000299f, 0.825424373f},
-std::array<float,2>{0.194771439f, 0.501712024f},
-std::array<float,2>{0.890093327f, 0.211224824f},
-std::array<float,2>{0.42741999f, 0.280480921f},
-std::array<float,2>{0.638358891f, 0.993505836f},
-std::array<float,2>{0.314198107f, 0.794080436f},
-std::array<float,2>{0.540714622f, 0.464980185f},
-std::array<float,2>{0.00847364403f, 0.00863354374f},
-std::array<float,2>{0.770728707f, 0.71007818f},
-std::array<float,2>{0.238283932f, 0.972209513f},
-std::array<float,2>{0.932776392f, 0.253454149f},
-std::array<float,2>{0.405927956f, 0.197234675f},
-std::array<float,2>{0.669301152f, 0.520017147f},
-std::array<float,2>{0.357030183f, 0.702003419f},
-std::array<float,2>{0.519353569f, 0.0252033472f},
-std::array<float,2>{0.0621023588f, 0.447789401f},
-std::array<float,2>{0.788672745f, 0.810492814f},
-std::array<float,2>{0.0811370015f, 0.5687235f},
-std::array<float,2>{0.84357059f, 0.169954062f},
-std::array<float,2>{0.291642308f, 0.357075155f},
-std::array<float,2>{0.57529366f, 0.916478097f},
-std::array<float,2>{0.462287635f, 0.835338593f},
-std::array<float,2>{0.718205929f, 0.404016286f},
-std::array<float,2>{0.167194635f, 0.0824814215f},
-std::array<float,2>{0.974900305f, 0.632306218f},
-std::array<float,2>{0.0207797773f, 0.770372748f},
-std::array<float,2>{0.753701508f, 0.491364181f},
-std::array<float,2>{0.342472464f, 0.0602637567f},
-std::array<float,2>{0.548422933f, 0.726285815f},
-std::array<float,2>{0.417013526f, 0.562468112f},
-std::array<float,2>{0.65564549f, 0.222608387f},
-std::array<float,2>{0.211194649f, 0.289171755f},
-std::array<float,2>{0.904432118f, 0.96281904f},
-std::array<float,2>{0.12749137f, 0.685062528f},
-std::array<float,2>{0.954525113f, 0.0999747813f},
-std::array<float,2>{0.483644634f, 0.42001161f},
-std::array<float,2>{0.720845401f, 0.860657632f},
-std::array<float,2>{0.257699817f, 0.877157688f},
-std::array<float,2>{0.61019206f, 0.313242555f},
-std::array<float,2>{0.108702853f, 0.148158655f},
-std::array<float,2>{0.874944746f, 0.614130616f},
-std::array<float,2>{0.135296211f, 0.76429534f},
-std::array<float,2>{0.968114853f, 0.481395483f},
-std::array<float,2>{0.470778078f, 0.0351122245f},
-std::array<float,2>{0.729368448f, 0.741158783f},
-std::array<float,2>{0.260920286f, 0.538396299f},
-std::array<float,2>{0.6194911f, 0.243664369f},
-std::array<float,2>{0.101538457f, 0.310848922f},
-std::array<float,2>{0.86319375f, 0.9456833f},
-std::array<float,2>{0.0258552432f, 0.662528038f},
-std::array<float,2>{0.765491962f, 0.118141733f},
-std::array<float,2>{0.330100805f, 0.427771151f},
-std::array<float,2>{0.560774088f, 0.846616983f},
-std::array<float,2>{0.412327707f, 0.895298243f},
-std::array<float,2>{0.645223796f, 0.340233743f},
-std::array<float,2>{0.207181737f, 0.126087502f},
-std::array<float,2>{0.898331761f, 0.601801693f},
-std::array<float,2>{0.0936021209f, 0.998727918f},
-std::array<float,2>{0.832439244f, 0.273942679f},
-std::array<float,2>{0.284331203f, 0.217868865f},
-std::array<float,2>{0.569057882f, 0.507257283f},
-std::array<float,2>{0.455226898f, 0.703589678f},
-std::array<float,2>{0.705530882f, 0.011982834f},
-std::array<float,2>{0.160132006f, 0.46190998f},
-std::array<float,2>{0.979568899f, 0.789561629f},
-std::array<float,2>{0.244097501f, 0.589995921f},
-std::array<float,2>{0.925384283f, 0.185543299f},
-std::array<float,2>{0.391247392f, 0.362980932f},
-std::array<float,2>{0.65886271f, 0.935291529f},
-std::array<float,2>{0.351319939f, 0.824185133f},
-std::array<float,2>{0.523899794f, 0.389804989f},
-std::array<float,2>{0.0472298935f, 0.0666070804f},
-std::array<float,2>{0.795736074f, 0.644868731f},
-std::array<float,2>{0.202005416f, 0.921430886f},
-std::array<float,2>{0.876387179f, 0.354918092f},
-std::array<float,2>{0.431727797f, 0.164891198f},
-std::array<float,2>{0.62953645f, 0.563611805f},
-std::array<float,2>{0.326379508f, 0.625210941f},
-std::array<float,2>{0.534610271f, 0.0800717846f},
-std::array<float,2>{0.00162338943f, 0.401142865f},
-std::array<float,2>{0.774004281f, 0.831011713f},
-std::array<float,2>{0.110832945f, 0.518205583f},
-std::array<float,2>{0.847340822f, 0.200219974f},
-std::array<float,2>{0.277489036f, 0.253967375f},
-std::array<float,2>{0.595484197f, 0.975665271f},
-std::array<float,2>{0.488043159f, 0.807488501f},
-std::array<float,2>{0.746940732f, 0.450172335f},
-std::array<float,2>{0.142827898f, 0.0306224786f},
-std::array<float,2>{0.945118308f, 0.696668327f},
-std::array<float,2>{0.0354534984f, 0.864028156f},
-std::array<float,2>{0.809004486f, 0.415835559f},
-std::array<float,2>{0.363831758f, 0.0954794213f},
-std::array<float,2>{0.500801444f, 0.680122733f},
-std::array<float,2>{0.386491507f, 0.609625101f},
-std::array<float,2>{0.67321682f, 0.140893504f},
-std::array<float,2>{0.225183487f, 0.316997677f},
-std::array<float,2>{0.91243273f, 0.880906641f},
-std::array<float,2>{0.174868241f, 0.72173351f},
-std::array<float,2>{0.991965652f, 0.056832768f},
-std::array<float,2>{0.444585949f, 0.484937489f},
-std::array<float,2>{0.696254849f, 0.769145548f},
-std::array<float,2>{0.299537152f, 0.967524052f},
-std::array<float,2>{0.591276824f, 0.294574022f},
-std::array<float,2>{0.0749417022f, 0.226275504f},
-std::array<float,2>{0.817152619f, 0.558014512f},
-std::array<float,2>{0.232641906f, 0.842726827f},
-std::array<float,2>{0.917329788f, 0.393307626f},
-std::array<float,2>{0.382201433f, 0.0907223746f},
-std::array<float,2>{0.685936987f, 0.639344037f},
-std::array<float,2>{0.37093237f, 0.577824175f},
-std::array<float,2>{0.511234522f, 0.16389212f},
-std::array<float,2>{0.0468490236f, 0.345061719f},
-std::array<float,2>{0.801810205f, 0.908026755f},
-std::array<float,2>{0.0657193884f, 0.693525791f},
-std::array<float,2>{0.825768352f, 0.0158438869f},
-std::array<float,2>{0.31091091f, 0.438679665f},
-std::array<float,2>{0.581875205f, 0.800866008f},
-std::array<float,2>{0.447513252f, 0.982137144f},
-std::array<float,2>{0.692927361f, 0.26182425f},
-std::array<float,2>{0.186087295f, 0.187863857f},
-std::array<float,2>{0.995164335f, 0.527833641f},
-std::array<float,2>{0.0121059623f, 0.888004601f},
-std::array<float,2>{0.768535614f, 0.32182458f},
-std::array<float,2>{0.318221152f, 0.15058212f},
-std::array<float,2>{0.546494246f, 0.622562885f},
-std::array<float,2>{0.422083735f, 0.679175615f},
-std::array<float,2>{0.634608924f, 0.102468066f},
-std::array<float,2>{0.18923755f, 0.407767653f},
-std::array<float,2>{0.884441078f, 0.870638847f},
-std::array<float,2>{0.155289218f, 0.552682698f},
-std::array<float,2>{0.952690721f, 0.231542885f},
-std::array<float,2>{0.497831762f, 0.284841001f},
-std::array<float,2>{0.737081528f, 0.957701325f},
-std::array<float,2>{0.272431344f, 0.776972413f},
-std::array<float,2>{0.602447808f, 0.496079147f},
-std::array<float,2>{0.120172247f, 0.0482298248f},
-std::array<float,2>{0.859170794f, 0.72737062f},
-std::array<float,2>{0.16999492f, 0.941110969f},
-std::array<float,2>{0.969544709f, 0.304283589f},
-std::array<float,2>{0.465298206f, 0.236244097f},
-std::array<float,2>{0.713692904f, 0.540824413f},
-std::array<float,2>{0.294680119f, 0.746830046f},
-std::array<float,2>{0.570983529f, 0.041403573f},
-std::array<float,2>{0.083376281f, 0.470575631f},
-std::array<float,2>{0.839673162f, 0.752566576f},
-std::array<float,2>{0.057745304f, 0.600618899f},
-std::array<float,2>{0.782148302f, 0.13589327f},
-std::array<float,2>{0.354591191f, 0.333026141f},
-std::array<float,2>{0.52142477f, 0.901878715f},
-std::array<float,2>{0.401975036f, 0.85382098f},
-std::array<float,2>{0.667541027f, 0.434025407f},
-std::array<float,2>{0.238139689f, 0.115473852f},
-std::array<float,2>{0.933799148f, 0.668767273f},
-std::array<float,2>{0.102548249f, 0.786319256f},
-std::array<float,2>{0.86823982f, 0.457326382f},
-std::array<float,2>{0.251922905f, 0.0040398906f},
-std::array<float,2>{0.613882542f, 0.714933038f},
-std::array<float,2>{0.478857309f, 0.509544909f},
-std::array<float,2>{0.723399162f, 0.210130051f},
-std::array<float,2>{0.130561054f, 0.27291882f},
-std::array<float,2>{0.959838271f, 0.990518093f},
-std::array<float,2>{0.218021795f, 0.650587976f},
-std::array<float,2>{0.901201308f, 0.0739958137f},
-std::array<float,2>{0.41965121f, 0.382443488f},
-std::array<float,2>{0.651987314f, 0.816428363f},
-std::array<float,2>{0.336976677f, 0.925086498f},
-std::array<float,2>{0.552624404f, 0.371365577f},
-std::array<float,2>{0.0191302299f, 0.177449957f},
-std::array<float,2>{0.754899859f, 0.58051616f},
-std::array<float,2>{0.248882532f, 0.780858159f},
-std::array<float,2>{0.927727699f, 0.497516334f},
-std::array<float,2>{0.394620061f, 0.0511483476f},
-std::array<float,2>{0.66271776f, 0.731797993f},
-std::array<float,2>{0.346334934f, 0.548772633f},
-std::array<float,2>{0.530750632f, 0.229295433f},
-std::array<float,2>{0.0526745878f, 0.288929433f},
-std::array<float,2>{0.78952831f, 0.95684278f},
-std::array<float,2>{0.0886957869f, 0.673217177f},
-std::array<float,2>{0.830906153f, 0.108256444f},
-std::array<float,2>{0.286642224f, 0.413650393f},
-std::array<float,2>{0.562795222f, 0.873720348f},
-std::array<float,2>{0.460739344f, 0.886167943f},
-std::array<float,2>{0.710605204f, 0.324285507f},
-std::array<float,2>{0.161810368f, 0.152926311f},
-std::array<float,2>{0.981949389f, 0.618319631f},
-std::array<float,2>{0.0295058396f, 0.980412662f},
-std::array<float,2>{0.758744836f, 0.260401338f},
-std::array<float,2>{0.332710147f, 0.19363445f},
-std::array<float,2>{0.5579741f, 0.525788248f},
-std::array<float,2>{0.409814835f, 0.688348353f},
-std::array<float,2>{0.642128587f, 0.0213072281f},
-std::array<float,2>{0.205956191f, 0.443901122f},
-std::array<float,2>{0.892731965f, 0.800495505f},
-std::array<float,2>{0.137137219f, 0.572784603f},
-std::array<float,2>{0.963313818f, 0.156947047f},
-std::array<float,2>{0.473271757f, 0.349886835f},
-std::array<float,2>{0.733071983f, 0.912664592f},
-std::array<float,2>{0.262550294f, 0.839654922f},
-std::array<float,2>{0.62251538f, 0.396031797f},
-std::array<float,2>{0.0968131125f, 0.0869121775f},
-std::array<float,2>{0.863943219f, 0.634604454f},
-std::array<float,2>{0.179656684f, 0.926373005f},
-std::array<float,2>{0.987347066f, 0.369765699f},
-std::array<float,2>{0.438877404f, 0.174272686f},
-std::array<float,2>{0.702862561f, 0.584146559f},
-std::array<float,2>{0.302155614f, 0.654425085f},
-std::array<float,2>{0.589808702f, 0.0779812336f},
-std::array<float,2>{0.0740647763f, 0.377010345f},
-std::array<float,2>{0.814909399f, 0.814596295f},
-std::array<float,2>{0.0313699171f, 0.51207757f},
-std::array<float,2>{0.806835532f, 0.203681976f},
-std::array<float,2>{0.360822529f, 0.266637027f},
-std::array<float,2>{0.507373095f, 0.987344384f},
-std::array<float,2>{0.390407205f, 0.784326136f},
-std::array<float,2>{0.677771568f, 0.456670493f},
-std::array<float,2>{0.220813766f, 0.00279564201f},
-std::array<float,2>{0.906404316f, 0.714257479f},
-std::array<float,2>{0.116837956f, 0.858540177f},
-std::array<float,2>{0.847736239f, 0.432454795f},
-std::array<float,2>{0.274039924f, 0.109866284f},
-std::array<float,2>{0.600194335f, 0.666837096f},
-std::array<float,2>{0.490965992f, 0.594801366f},
-std::array<float,2>{0.745493352f, 0.139241815f},
-std::array<float,2>{0.147019848f, 0.329251468f},
-std::array<float,2>{0.93794769f, 0.905185282f},
-std::array<float,2>{0.195919245f, 0.742723346f},
-std::array<float,2>{0.879946947f, 0.0436179824f},
-std::array<float,2>{0.436030179f, 0.473018318f},
-std::array<float,2>{0.628794014f, 0.757187724f},
-std::array<float,2>{0.323728442f, 0.945015311f},
-std::array<float,2>{0.535479546f, 0.297981977f},
-std::array<float,2>{0.00429692352f, 0.239067137f},
-std::array<float,2>{0.780011058f, 0.54656595f},
-std::array<float,2>{0.149491042f, 0.82710737f},
-std::array<float,2>{0.946998298f, 0.383273602f},
-std::array<float,2>{0.493285716f, 0.0631457269f},
-std::array<float,2>{0.739424467f, 0.643700302f},
-std::array<float,2>{0.267927766f, 0.589136422f},
-std::array<float,2>{0.608914256f, 0.181095734f},
-std::array<float,2>{0.123854525f, 0.365731865f},
-std::array<float,2>{0.85486275f, 0.933189452f},
-std::array<float,2>{0.0114121316f, 0.70768708f},
-std::array<float,2>{0.772139668f, 0.0115786623f},
-std::array<float,2>{0.315609008f, 0.468097091f},
-std::array<float,2>{0.542075574f, 0.796135008f},
-std::array<float,2>{0.427856266f, 0.994973302f},
-std::array<float,2>{0.639052451f, 0.278919786f},
-std::array<float,2>{0.192636222f, 0.213390142f},
-std::array<float,2>{0.887511671f, 0.502941787f},
-std::array<float,2>{0.0679632425f, 0.892260134f},
-std::array<float,2>{0.823539019f, 0.338992417f},
-std::array<float,2>{0.306624353f, 0.129599929f},
-std::array<float,2>{0.583417177f, 0.606024206f},
-std::array<float,2>{0.452800065f, 0.659184694f},
-std::array<float,2>{0.691308022f, 0.121213205f},
-std::array<float,2>{0.181286037f, 0.423595816f},
-std::array<float,2>{0.999395907f, 0.851346016f},
-std::array<float,2>{0.227446735f, 0.531368792f},
-std::array<float,2>{0.919223785f, 0.248505831f},
-std::array<float,2>{0.375892192f, 0.306347579f},
-std::array<float,2>{0.680550337f, 0.949685872f},
-std::array<float,2>{0.371750653f, 0.760830998f},
-std::array<float,2>{0.513247132f, 0.478374153f},
-std::array<float,2>{0.042736154f, 0.0356544033f},
-std::array<float,2>{0.797687411f, 0.737968504f},
-std::array<float,2>{0.213901043f, 0.964001298f},
-std::array<float,2>{0.904062331f, 0.292965919f},
-std::array<float,2>{0.415461183f, 0.220701993f},
-std::array<float,2>{0.652677238f, 0.559464753f},
-std::array<float,2>{0.341119736f, 0.724463463f},
-std::array<float,2>{0.549390972f, 0.0608374253f},
-std::array<float,2>{0.0225945208f, 0.490158319f},
-std::array<float,2>{0.750019014f, 0.772994936f},
-std::array<float,2>{0.106070213f, 0.61569488f},
-std::array<float,2>{0.872325122f, 0.144814461f},
-std::array<float,2>{0.25457111f, 0.315500796f},
-std::array<float,2>{0.611589253f, 0.875528276f},
-std::array<float,2>{0.481133163f, 0.862335145f},
-std::array<float,2>{0.72015065f, 0.418340892f},
-std::array<float,2>{0.125781596f, 0.0992153808f},
-std::array<float,2>{0.956885099f, 0.68587172f},
-std::array<float,2>{0.0592976585f, 0.811028302f},
-std::array<float,2>{0.786320984f, 0.445491195f},
-std::array<float,2>{0.358453572f, 0.0264056269f},
-std::array<float,2>{0.517376602f, 0.69947058f},
-std::array<float,2>{0.402483463f, 0.5218485f},
-std::array<float,2>{0.671518803f, 0.198312014f},
-std::array<float,2>{0.241055012f, 0.251404405f},
-std::array<float,2>{0.930873096f, 0.970116794f},
-std::array<float,2>{0.164476201f, 0.630404115f},
-std::array<float,2>{0.973125637f, 0.0843170583f},
-std::array<float,2>{0.464349896f, 0.405932307f},
-std::array<float,2>{0.716064334f, 0.83374542f},
-std::array<float,2>{0.289347827f, 0.914989889f},
-std::array<float,2>{0.577967346f, 0.358340323f},
-std::array<float,2>{0.0790177211f, 0.168443903f},
-std::array<float,2>{0.840345621f, 0.567066133f},
-std::array<float,2>{0.15722467f, 0.792697847f},
-std::array<float,2>{0.97716552f, 0.464363813f},
-std::array<float,2>{0.453883111f, 0.0141269155f},
-std::array<float,2>{0.70316124f, 0.705434144f},
-std::array<float,2>{0.282894671f, 0.505809963f},
-std::array<float,2>{0.566785455f, 0.214976177f},
-std::array<float,2>{0.0899263844f, 0.276549816f},
-std::array<float,2>{0.83492136f, 0.997883439f},
-std::array<float,2>{0.0494708344f, 0.647895098f},
-std::array<float,2>{0.793664515f, 0.0702493712f},
-std::array<float,2>{0.349042326f, 0.388266683f},
-std::array<float,2>{0.525796056f, 0.821049809f},
-std::array<float,2>{0.393860161f, 0.93679297f},
-std::array<float,2>{0.656737804f, 0.360096812f},
-std::array<float,2>{0.244550094f, 0.185705468f},
-std::array<float,2>{0.923546255f, 0.593458593f},
-std::array<float,2>{0.099282518f, 0.947819471f},
-std::array<float,2>{0.86068213f, 0.31047371f},
-std::array<float,2>{0.257822961f, 0.24451378f},
-std::array<float,2>{0.61864531f, 0.536196947f},
-std::array<float,2>{0.469001412f, 0.738527775f},
-std::array<float,2>{0.728332579f, 0.0313968882f},
-std::array<float,2>{0.13369453f, 0.484363377f},
-std::array<float,2>{0.966704249f, 0.763336897f},
-std::array<float,2>{0.209052816f, 0.604042709f},
-std::array<float,2>{0.895482481f, 0.127119049f},
-std::array<float,2>{0.410194695f, 0.343152612f},
-std::array<float,2>{0.647372544f, 0.897714555f},
-std::array<float,2>{0.328700155f, 0.845391929f},
-std::array<float,2>{0.559967101f, 0.427005798f},
-std::array<float,2>{0.0243948065f, 0.1201737f},
-std::array<float,2>{0.762049317f, 0.66019243f},
-std::array<float,2>{0.224488586f, 0.88018465f},
-std::array<float,2>{0.910185635f, 0.31863904f},
-std::array<float,2>{0.383172125f, 0.144497484f},
-std::array<float,2>{0.674465954f, 0.613019884f},
-std::array<float,2>{0.365735531f, 0.68180126f},
-std::array<float,2>{0.50353539f, 0.0969202593f},
-std::array<float,2>{0.0386642963f, 0.417596608f},
-std::array<float,2>{0.810605824f, 0.866454184f},
-std::array<float,2>{0.077457726f, 0.555906177f},
-std::array<float,2>{0.819791436f, 0.224437222f},
-std::array<float,2>{0.297585636f, 0.296740025f},
-std::array<float,2>{0.592168272f, 0.966430068f},
-std::array<float,2>{0.44207105f, 0.765674651f},
-std::array<float,2>{0.699132919f, 0.487878978f},
-std::array<float,2>{0.173227116f, 0.0563914515f},
-std::array<float,2>{0.990086913f, 0.719587266f},
-std::array<float,2>{0.00247562514f, 0.828413486f},
-std::array<float,2>{0.775981128f, 0.399297535f},
-std::array<float,2>{0.324552864f, 0.0804656297f},
-std::array<float,2>{0.531797409f, 0.627203107f},
-std::array<float,2>{0.431393802f, 0.565142632f},
-std::array<float,2>{0.632379055f, 0.166631833f},
-std::array<float,2>{0.200290456f, 0.351634651f},
-std::array<float,2>{0.878674328f, 0.917997539f},
-std::array<float,2>{0.142491713f, 0.698124826f},
-std::array<float,2>{0.942452192f, 0.0278377626f},
-std::array<float,2>{0.485532373f, 0.451917678f},
-std::array<float,2>{0.749060214f, 0.80622977f},
-std::array<float,2>{0.281043649f, 0.973544359f},
-std::array<float,2>{0.596448779f, 0.256677151f},
-std::array<float,2>{0.111658439f, 0.202548742f},
-std::array<float,2>{0.844542861f, 0.517396986f},
-std::array<float,2>{0.190452263f, 0.868139982f},
-std::array<float,2>{0.886350811f, 0.409449011f},
-std::array<float,2>{0.423879445f, 0.104166418f},
-std::array<float,2>{0.634965599f, 0.677580655f},
-std::array<float,2>{0.318837911f, 0.623509288f},
-std::array<float,2>{0.54319334f, 0.149417818f},
-std::array<float,2>{0.0155411586f, 0.322761834f},
-std::array<float,2>{0.767445683f, 0.889800787f},
-std::array<float,2>{0.119059399f, 0.72999531f},
-std::array<float,2>{0.856117725f, 0.0505576506f},
-std::array<float,2>{0.271170586f, 0.492820114f},
-std::array<float,2>{0.605031669f, 0.77532053f},
-std::array<float,2>{0.498972386f, 0.960199237f},
-std::array<float,2>{0.736017883f, 0.283186287f},
-std::array<float,2>{0.152509987f, 0.233047411f},
-std::array<float,2>{0.950432479f, 0.552914858f},
-std::array<float,2>{0.0441619381f, 0.908871531f},
-std::array<float,2>{0.803923368f, 0.34610644f},
-std::array<float,2>{0.368810564f, 0.161929086f},
-std::array<float,2>{0.507976055f, 0.574225724f},
-std::array<float,2>{0.380507112f, 0.636833012f},
-std::array<float,2>{0.684658229f, 0.093248859f},
-std::array<float,2>{0.230998769f, 0.391099155f},
-std::array<float,2>{0.914573669f, 0.840143025f},
-std::array<float,2>{0.18381229f, 0.530112088f},
-std::array<float,2>{0.992588639f, 0.1900713f},
-std::array<float,2>{0.445628732f, 0.263707131f},
-std::array<float,2>{0.695285797f, 0.982470155f},
-std::array<float,2>{0.309485525f, 0.804537892f},
-std::array<float,2>{0.5783512f, 0.441158116f},
-std::array<float,2>{0.064065367f, 0.0181566682f},
-std::array<float,2>{0.827893317f, 0.693264961f},
-std::array<float,2>{0.132060602f, 0.98938632f},
-std::array<float,2>{0.957894385f, 0.271279067f},
-std::array<float,2>{0.477411062f, 0.207220927f},
-std::array<float,2>{0.724875569f, 0.510127366f},
-std::array<float,2>{0.252018154f, 0.717437744f},
-std::array<float,2>{0.615305126f, 0.00700955f},
-std::array<float,2>{0.104056247f, 0.460189313f},
-std::array<float,2>{0.870569706f, 0.788001955f},
-std::array<float,2>{0.0174724404f, 0.579916358f},
-std::array<float,2>{0.757338822f, 0.179531664f},
-std::array<float,2>{0.338941634f, 0.374281883f},
-std::array<float,2>{0.552824974f, 0.923742115f},
-std::array<float,2>{0.420205116f, 0.819452405f},
-std::array<float,2>{0.650133252f, 0.380486101f},
-std::array<float,2>{0.214886025f, 0.0715020448f},
-std::array<float,2>{0.898499846f, 0.649030387f},
-std::array<float,2>{0.0842719078f, 0.750348985f},
-std::array<float,2>{0.836887538f, 0.471745491f},
-std::array<float,2>{0.296549648f, 0.0397165418f},
-std::array<float,2>{0.573416889f, 0.748661578f},
-std::array<float,2>{0.468113303f, 0.541421473f},
-std::array<float,2>{0.711671233f, 0.237387538f},
-std::array<float,2>{0.169280708f, 0.301790029f},
-std::array<float,2>{0.972423673f, 0.939114332f},
-std::array<float,2>{0.23458764f, 0.670532882f},
-std::array<float,2>{0.936405063f, 0.114396468f},
-std::array<float,2>{0.399864018f, 0.436099321f},
-std::array<float,2>{0.665544689f, 0.853333473f},
-std::array<float,2>{0.352764368f, 0.898441851f},
-std::array<float,2>{0.521953285f, 0.335017413f},
-std::array<float,2>{0.0547360517f, 0.133841574f},
-std::array<float,2>{0.784471691f, 0.598298788f},
-std::array<float,2>{0.221872494f, 0.782191932f},
-std::array<float,2>{0.908006728f, 0.454464972f},
-std::array<float,2>{0.389343858f, 1.08594031e-06f},
-std::array<float,2>{0.678890824f, 0.712195933f},
-std::array<float,2>{0.359485388f, 0.514113128f},
-std::array<float,2>{0.506151676f, 0.205400646f},
-std::array<float,2>{0.032940723f, 0.269329011f},
-std::array<float,2>{0.808313787f, 0.98608309f},
-std::array<float,2>{0.0728891119f, 0.653279185f},
-std::array<float,2>{0.816082418f, 0.0761170685f},
-std::array<float,2>{0.301240206f, 0.375684261f},
-std::array<float,2>{0.588160813f, 0.814193249f},
-std::array<float,2>{0.437884331f, 0.927830756f},
-std::array<float,2>{0.701382577f, 0.368433148f},
-std::array<float,2>{0.178107038f, 0.173361927f},
-std::array<float,2>{0.986665547f, 0.583939254f},
-std::array<float,2>{0.00539048295f, 0.943131745f},
-std::array<float,2>{0.780913651f, 0.300346464f},
-std::array<float,2>{0.322956204f, 0.241927147f},
-std::array<float,2>{0.536782384f, 0.544354796f},
-std::array<float,2>{0.436778814f, 0.744755745f},
-std::array<float,2>{0.627770245f, 0.0461244136f},
-std::array<float,2>{0.196601033f, 0.475922644f},
-std::array<float,2>{0.879518688f, 0.754752278f},
-std::array<float,2>{0.148392171f, 0.597029865f},
-std::array<float,2>{0.938678563f, 0.137687668f},
-std::array<float,2>{0.492110193f, 0.331167608f},
-std::array<float,2>{0.744695961f, 0.90395695f},
-std::array<float,2>{0.275185674f, 0.857206762f},
-std::array<float,2>{0.601307392f, 0.43062225f},
-std::array<float,2>{0.115750939f, 0.112657093f},
-std::array<float,2>{0.849018991f, 0.665468514f},
-std::array<float,2>{0.16040273f, 0.884215772f},
-std::array<float,2>{0.981368482f, 0.327014983f},
-std::array<float,2>{0.459155321f, 0.154958516f},
-std::array<float,2>{0.709676325f, 0.619216263f},
-std::array<float,2>{0.285248876f, 0.675217748f},
-std::array<float,2>{0.563572466f, 0.106767617f},
-std::array<float,2>{0.0891588554f, 0.411738813f},
-std::array<float,2>{0.831848681f, 0.871214867f},
-std::array<float,2>{0.0509531796f, 0.550541222f},
-std::array<float,2>{0.790749073f, 0.228292048f},
-std::array<float,2>{0.347178847f, 0.286037177f},
-std::array<float,2>{0.529741645f, 0.955041349f},
-std::array<float,2>{0.396097571f, 0.778377831f},
-std::array<float,2>{0.66364795f, 0.499474436f},
-std::array<float,2>{0.249237284f, 0.0537750684f},
-std::array<float,2>{0.926236153f, 0.732424557f},
-std::array<float,2>{0.0966383219f, 0.83783251f},
-std::array<float,2>{0.864757597f, 0.396718889f},
-std::array<float,2>{0.263153613f, 0.0882017687f},
-std::array<float,2>{0.621405244f, 0.636530817f},
-std::array<float,2>{0.473948717f, 0.570967793f},
-std::array<float,2>{0.734066844f, 0.158313885f},
-std::array<float,2>{0.13802819f, 0.348236054f},
-std::array<float,2>{0.964198709f, 0.910686135f},
-std::array<float,2>{0.206350893f, 0.690480053f},
-std::array<float,2>{0.893719077f, 0.0224359855f},
-std::array<float,2>{0.408638388f, 0.44243452f},
-std::array<float,2>{0.641054153f, 0.79802537f},
-std::array<float,2>{0.333300292f, 0.977590024f},
-std::array<float,2>{0.55685246f, 0.259236246f},
-std::array<float,2>{0.0303524137f, 0.192384765f},
-std::array<float,2>{0.759495676f, 0.525093496f},
-std::array<float,2>{0.126887232f, 0.859825313f},
-std::array<float,2>{0.955213428f, 0.421006411f},
-std::array<float,2>{0.481817365f, 0.100848958f},
-std::array<float,2>{0.718906224f, 0.684035897f},
-std::array<float,2>{0.254889578f, 0.614864409f},
-std::array<float,2>{0.613239348f, 0.147429243f},
-std::array<float,2>{0.106631741f, 0.313776106f},
-std::array<float,2>{0.87182194f, 0.878351629f},
-std::array<float,2>{0.02187673f, 0.724780083f},
-std::array<float,2>{0.751626194f, 0.0587346926f},
-std::array<float,2>{0.340527952f, 0.490666866f},
-std::array<float,2>{0.550705969f, 0.77062577f},
-std::array<float,2>{0.414407045f, 0.961264312f},
-std::array<float,2>{0.653427005f, 0.290678054f},
-std::array<float,2>{0.213554338f, 0.221112847f},
-std::array<float,2>{0.902796626f, 0.560919881f},
-std::array<float,2>{0.0794450343f, 0.917553663f},
-std::array<float,2>{0.841099322f, 0.356383413f},
-std::array<float,2>{0.290330201f, 0.171828687f},
-std::array<float,2>{0.57695508f, 0.569938242f},
-std::array<float,2>{0.463399351f, 0.631691456f},
-std::array<float,2>{0.715004921f, 0.0833272263f},
-std::array<float,2>{0.165209308f, 0.402507246f},
-std::array<float,2>{0.974279344f, 0.834766626f},
-std::array<float,2>{0.242138743f, 0.521149457f},
-std::array<float,2>{0.930308282f, 0.196024731f},
-std::array<float,2>{0.403468847f, 0.252546251f},
-std::array<float,2>{0.670144737f, 0.971465409f},
-std::array<float,2>{0.35826382f, 0.809445322f},
-std::array<float,2>{0.515956342f, 0.448265016f},
-std::array<float,2>{0.0605043024f, 0.0241710655f},
-std::array<float,2>{0.78573817f, 0.702649057f},
-std::array<float,2>{0.191591963f, 0.992807984f},
-std::array<float,2>{0.888448596f, 0.280081451f},
-std::array<float,2>{0.429504275f, 0.212081701f},
-std::array<float,2>{0.639994562f, 0.500241339f},
-std::array<float,2>{0.314983249f, 0.708995163f},
-std::array<float,2>{0.541878581f, 0.00969289057f},
-std::array<float,2>{0.0104649048f, 0.466554344f},
-std::array<float,2>{0.772847474f, 0.793197274f},
-std::array<float,2>{0.124210693f, 0.586107254f},
-std::array<float,2>{0.854005218f, 0.183430493f},
-std::array<float,2>{0.26946944f, 0.365034491f},
-std::array<float,2>{0.607769787f, 0.931620717f},
-std::array<float,2>{0.493031025f, 0.825181246f},
-std::array<float,2>{0.738752961f, 0.386477113f},
-std::array<float,2>{0.14929989f, 0.0649971813f},
-std::array<float,2>{0.945886552f, 0.641105533f},
-std::array<float,2>{0.0414173938f, 0.757835746f},
-std::array<float,2>{0.798691869f, 0.479243904f},
-std::array<float,2>{0.372815728f, 0.0374985412f},
-std::array<float,2>{0.512094021f, 0.735643566f},
-std::array<float,2>{0.376639068f, 0.534666359f},
-std::array<float,2>{0.681152761f, 0.247107431f},
-std::array<float,2>{0.228463963f, 0.307259232f},
-std::array<float,2>{0.918591678f, 0.952940345f},
-std::array<float,2>{0.180165708f, 0.657295048f},
-std::array<float,2>{0.998758733f, 0.124398783f},
-std::array<float,2>{0.451254636f, 0.424722701f},
-std::array<float,2>{0.689927042f, 0.849045277f},
-std::array<float,2>{0.305109948f, 0.892739475f},
-std::array<float,2>{0.58236748f, 0.336499631f},
-std::array<float,2>{0.0664146319f, 0.13187246f},
-std::array<float,2>{0.822875798f, 0.608325541f},
-std::array<float,2>{0.172756717f, 0.768267393f},
-std::array<float,2>{0.98855108f, 0.485487789f},
-std::array<float,2>{0.442787379f, 0.0579537638f},
-std::array<float,2>{0.697647691f, 0.721254766f},
-std::array<float,2>{0.298469603f, 0.556815445f},
-std::array<float,2>{0.593273282f, 0.22525996f},
-std::array<float,2>{0.0768682286f, 0.29364121f},
-std::array<float,2>{0.819012463f, 0.968547523f},
-std::array<float,2>{0.0378533266f, 0.681080401f},
-std::array<float,2>{0.812173069f, 0.0943590701f},
-std::array<float,2>{0.366637409f, 0.414595306f},
-std::array<float,2>{0.50280565f, 0.864279807f},
-std::array<float,2>{0.383830965f, 0.882721245f},
-std::array<float,2>{0.674877286f, 0.317792505f},
-std::array<float,2>{0.222749144f, 0.142111495f},
-std::array<float,2>{0.91113627f, 0.610426366f},
-std::array<float,2>{0.112548046f, 0.975041091f},
-std::array<float,2>{0.845459044f, 0.255078644f},
-std::array<float,2>{0.279939413f, 0.199553952f},
-std::array<float,2>{0.596696496f, 0.518810391f},
-std::array<float,2>{0.485091448f, 0.695828557f},
-std::array<float,2>{0.748952687f, 0.0298561547f},
-std::array<float,2>{0.141232327f, 0.450265348f},
-std::array<float,2>{0.941946268f, 0.807766795f},
-std::array<float,2>{0.199629739f, 0.562555611f},
-std::array<float,2>{0.877228141f, 0.165287793f},
-std::array<float,2>{0.430052906f, 0.353799373f},
-std::array<float,2>{0.63164717f, 0.920353472f},
-std::array<float,2>{0.325375795f, 0.831773221f},
-std::array<float,2>{0.532823503f, 0.401530236f},
-std::array<float,2>{0.00337474351f, 0.0790341944f},
-std::array<float,2>{0.776535332f, 0.626619756f},
-std::array<float,2>{0.245208234f, 0.933774352f},
-std::array<float,2>{0.922770441f, 0.361403197f},
-std::array<float,2>{0.393458217f, 0.184124827f},
-std::array<float,2>{0.658143282f, 0.591503799f},
-std::array<float,2>{0.348332614f, 0.64571625f},
-std::array<float,2>{0.526523352f, 0.0681686252f},
-std::array<float,2>{0.050413914f, 0.389407367f},
-std::array<float,2>{0.794293821f, 0.823093116f},
-std::array<float,2>{0.0912875384f, 0.505872548f},
-std::array<float,2>{0.835554719f, 0.217444643f},
-std::array<float,2>{0.28177312f, 0.275040388f},
-std::array<float,2>{0.567686975f, 0.999764383f},
-std::array<float,2>{0.454335183f, 0.790319145f},
-std::array<float,2>{0.704829574f, 0.462020069f},
-std::array<float,2>{0.157281235f, 0.0131774182f},
-std::array<float,2>{0.978347242f, 0.704259157f},
-std::array<float,2>{0.0245774835f, 0.847334087f},
-std::array<float,2>{0.763480186f, 0.429156393f},
-std::array<float,2>{0.32950452f, 0.118725501f},
-std::array<float,2>{0.558842897f, 0.663636446f},
-std::array<float,2>{0.412021428f, 0.603171647f},
-std::array<float,2>{0.64784801f, 0.12566112f},
-std::array<float,2>{0.210889861f, 0.34107247f},
-std::array<float,2>{0.895624459f, 0.896072805f},
-std::array<float,2>{0.134465858f, 0.74207598f},
-std::array<float,2>{0.96562016f, 0.0336533524f},
-std::array<float,2>{0.470147282f, 0.482070774f},
-std::array<float,2>{0.726857662f, 0.764743149f},
-std::array<float,2>{0.25940907f, 0.946554303f},
-std::array<float,2>{0.618144929f, 0.312070042f},
-std::array<float,2>{0.098399356f, 0.242612422f},
-std::array<float,2>{0.860127807f, 0.537143052f},
-std::array<float,2>{0.215838671f, 0.817411482f},
-std::array<float,2>{0.899676681f, 0.3818084f},
-std::array<float,2>{0.421872348f, 0.0727150962f},
-std::array<float,2>{0.648942828f, 0.651627481f},
-std::array<float,2>{0.338621855f, 0.581986487f},
-std::array<float,2>{0.554382145f, 0.176315755f},
-std::array<float,2>{0.0162424296f, 0.372854799f},
-std::array<float,2>{0.755970597f, 0.924473941f},
-std::array<float,2>{0.104801796f, 0.716488898f},
-std::array<float,2>{0.869773507f, 0.00542410184f},
-std::array<float,2>{0.25346902f, 0.458038628f},
-std::array<float,2>{0.616559744f, 0.785448968f},
-std::array<float,2>{0.477859229f, 0.99156487f},
-std::array<float,2>{0.725963771f, 0.27211374f},
-std::array<float,2>{0.13113223f, 0.209370822f},
-std::array<float,2>{0.958545566f, 0.507888436f},
-std::array<float,2>{0.0558527336f, 0.901330233f},
-std::array<float,2>{0.784148097f, 0.332835585f},
-std::array<float,2>{0.352454543f, 0.135652572f},
-std::array<float,2>{0.522481859f, 0.60019666f},
-std::array<float,2>{0.398914427f, 0.669377387f},
-std::array<float,2>{0.664110661f, 0.116742119f},
-std::array<float,2>{0.23571521f, 0.434786558f},
-std::array<float,2>{0.937318206f, 0.854546845f},
-std::array<float,2>{0.168313548f, 0.53991735f},
-std::array<float,2>{0.970974803f, 0.234633386f},
-std::array<float,2>{0.467320502f, 0.30357185f},
-std::array<float,2>{0.712162077f, 0.940247059f},
-std::array<float,2>{0.295167357f, 0.753902555f},
-std::array<float,2>{0.572290838f, 0.469441086f},
-std::array<float,2>{0.0852482915f, 0.0427978002f},
-std::array<float,2>{0.837176025f, 0.747839034f},
-std::array<float,2>{0.153912067f, 0.958750427f},
-std::array<float,2>{0.949952245f, 0.283396095f},
-std::array<float,2>{0.499619126f, 0.231029972f},
-std::array<float,2>{0.734861314f, 0.551001251f},
-std::array<float,2>{0.269602656f, 0.727573633f},
-std::array<float,2>{0.603956759f, 0.0471317582f},
-std::array<float,2>{0.117396906f, 0.494412512f},
-std::array<float,2>{0.857109427f, 0.775992513f},
-std::array<float,2>{0.0140245147f, 0.62121278f},
-std::array<float,2>{0.766146362f, 0.151720569f},
-std::array<float,2>{0.31989783f, 0.320387393f},
-std::array<float,2>{0.544719994f, 0.887230277f},
-std::array<float,2>{0.425498098f, 0.869561076f},
-std::array<float,2>{0.636230886f, 0.406370729f},
-std::array<float,2>{0.190296918f, 0.103453547f},
-std::array<float,2>{0.885190189f, 0.67776382f},
-std::array<float,2>{0.0631282628f, 0.802586854f},
-std::array<float,2>{0.826547921f, 0.438237131f},
-std::array<float,2>{0.310080647f, 0.0168146547f},
-std::array<float,2>{0.579401731f, 0.694841087f},
-std::array<float,2>{0.447245181f, 0.528839052f},
-std::array<float,2>{0.69351542f, 0.188615963f},
-std::array<float,2>{0.18525137f, 0.263205558f},
-std::array<float,2>{0.993860602f, 0.981330216f},
-std::array<float,2>{0.231633902f, 0.640061915f},
-std::array<float,2>{0.915773511f, 0.0913401842f},
-std::array<float,2>{0.378911436f, 0.394528806f},
-std::array<float,2>{0.683948517f, 0.84290266f},
-std::array<float,2>{0.367949426f, 0.906558931f},
-std::array<float,2>{0.508930385f, 0.344161302f},
-std::array<float,2>{0.0438165478f, 0.162936315f},
-std::array<float,2>{0.803444743f, 0.576672256f},
-std::array<float,2>{0.198085293f, 0.756538212f},
-std::array<float,2>{0.882418692f, 0.473927259f},
-std::array<float,2>{0.433670282f, 0.0446733944f},
-std::array<float,2>{0.625428379f, 0.743235767f},
-std::array<float,2>{0.321711928f, 0.545590103f},
-std::array<float,2>{0.537118077f, 0.239677399f},
-std::array<float,2>{0.00753608393f, 0.297137499f},
-std::array<float,2>{0.778366148f, 0.943818569f},
-std::array<float,2>{0.11486046f, 0.667508125f},
-std::array<float,2>{0.851133406f, 0.110905819f},
-std::array<float,2>{0.275390923f, 0.432763904f},
-std::array<float,2>{0.599153161f, 0.858182728f},
-std::array<float,2>{0.488698065f, 0.905974627f},
-std::array<float,2>{0.74350065f, 0.328904182f},
-std::array<float,2>{0.145463943f, 0.139963508f},
-std::array<float,2>{0.940463424f, 0.594422638f},
-std::array<float,2>{0.0335705243f, 0.987240791f},
-std::array<float,2>{0.805558622f, 0.265780002f},
-std::array<float,2>{0.361704826f, 0.204790726f},
-std::array<float,2>{0.50392735f, 0.513544977f},
-std::array<float,2>{0.387898743f, 0.713774204f},
-std::array<float,2>{0.676841259f, 0.00373937516f},
-std::array<float,2>{0.220179215f, 0.455869704f},
-std::array<float,2>{0.908355534f, 0.784090459f},
-std::array<float,2>{0.177341521f, 0.585368276f},
-std::array<float,2>{0.985043466f, 0.175658762f},
-std::array<float,2>{0.440184504f, 0.370976835f},
-std::array<float,2>{0.700203538f, 0.927188456f},
-std::array<float,2>{0.30448252f, 0.815975428f},
-std::array<float,2>{0.586403131f, 0.378296882f},
-std::array<float,2>{0.0705273077f, 0.0764204562f},
-std::array<float,2>{0.813370883f, 0.65587008f},
-std::array<float,2>{0.140156314f, 0.913771033f},
-std::array<float,2>{0.961682379f, 0.350618392f},
-std::array<float,2>{0.475378007f, 0.1573769f},
-std::array<float,2>{0.731999338f, 0.573463678f},
-std::array<float,2>{0.263841748f, 0.633442342f},
-std::array<float,2>{0.624745607f, 0.0871144012f},
-std::array<float,2>{0.0938765332f, 0.395193428f},
-std::array<float,2>{0.867020726f, 0.837925017f},
-std::array<float,2>{0.0280969739f, 0.526936114f},
-std::array<float,2>{0.76147759f, 0.195094511f},
-std::array<float,2>{0.334083617f, 0.261696398f},
-std::array<float,2>{0.555312991f, 0.979191899f},
-std::array<float,2>{0.407515079f, 0.799663901f},
-std::array<float,2>{0.643110037f, 0.444848537f},
-std::array<float,2>{0.204128996f, 0.02015399f},
-std::array<float,2>{0.890923858f, 0.688946307f},
-std::array<float,2>{0.0876693353f, 0.874323606f},
-std::array<float,2>{0.828386009f, 0.412616521f},
-std::array<float,2>{0.288592786f, 0.109296836f},
-std::array<float,2>{0.566013098f, 0.672050595f},
-std::array<float,2>{0.458089888f, 0.617817879f},
-std::array<float,2>{0.708584905f, 0.153453812f},
-std::array<float,2>{0.162674814f, 0.325489044f},
-std::array<float,2>{0.984362185f, 0.885132313f},
-std::array<float,2>{0.247646078f, 0.730700076f},
-std::array<float,2>{0.929185152f, 0.052153904f},
-std::array<float,2>{0.396783799f, 0.49678269f},
-std::array<float,2>{0.660379529f, 0.779996455f},
-std::array<float,2>{0.343953669f, 0.955191612f},
-std::array<float,2>{0.528494179f, 0.287848979f},
-std::array<float,2>{0.0537868738f, 0.230458066f},
-std::array<float,2>{0.792363942f, 0.547648251f},
-std::array<float,2>{0.16676572f, 0.832473516f},
-std::array<float,2>{0.976325035f, 0.40483138f},
-std::array<float,2>{0.461721718f, 0.0858247057f},
-std::array<float,2>{0.717424929f, 0.629673541f},
-std::array<float,2>{0.292159379f, 0.567892849f},
-std::array<float,2>{0.574912012f, 0.169711292f},
-std::array<float,2>{0.0809853896f, 0.358846307f},
-std::array<float,2>{0.842653573f, 0.915999889f},
-std::array<float,2>{0.0605584495f, 0.700519204f},
-std::array<float,2>{0.787669361f, 0.0259614903f},
-std::array<float,2>{0.356440216f, 0.446950018f},
-std::array<float,2>{0.518450737f, 0.812096119f},
-std::array<float,2>{0.404464483f, 0.968769789f},
-std::array<float,2>{0.668194771f, 0.250797749f},
-std::array<float,2>{0.239406124f, 0.197487667f},
-std::array<float,2>{0.932023466f, 0.522497833f},
-std::array<float,2>{0.107744925f, 0.876716256f},
-std::array<float,2>{0.873105407f, 0.315371692f},
-std::array<float,2>{0.256301343f, 0.146402925f},
-std::array<float,2>{0.610678494f, 0.616397679f},
-std::array<float,2>{0.482711494f, 0.686755836f},
-std::array<float,2>{0.722093999f, 0.0983594134f},
-std::array<float,2>{0.128558606f, 0.419495612f},
-std::array<float,2>{0.953454852f, 0.861624718f},
-std::array<float,2>{0.212299228f, 0.55998826f},
-std::array<float,2>{0.905866206f, 0.219178721f},
-std::array<float,2>{0.416394323f, 0.291893005f},
-std::array<float,2>{0.654429436f, 0.963795185f},
-std::array<float,2>{0.34370929f, 0.771532595f},
-std::array<float,2>{0.546924472f, 0.489044726f},
-std::array<float,2>{0.0204713065f, 0.0621981248f},
-std::array<float,2>{0.752033532f, 0.723228097f},
-std::array<float,2>{0.229394704f, 0.950505495f},
-std::array<float,2>{0.921824276f, 0.305068582f},
-std::array<float,2>{0.377444327f, 0.249882549f},
-std::array<float,2>{0.681947231f, 0.53313458f},
-std::array<float,2>{0.373222858f, 0.737263262f},
-std::array<float,2>{0.514118671f, 0.0361924693f},
-std::array<float,2>{0.0391507298f, 0.477428019f},
-std::array<float,2>{0.799500525f, 0.760323048f},
-std::array<float,2>{0.0684069395f, 0.607210457f},
-std::array<float,2>{0.820685565f, 0.130199984f},
-std::array<float,2>{0.307015061f, 0.338350415f},
-std::array<float,2>{0.584069908f, 0.891224384f},
-std::array<float,2>{0.449532062f, 0.850570321f},
-std::array<float,2>{0.687760651f, 0.421931773f},
-std::array<float,2>{0.183088318f, 0.122405395f},
-std::array<float,2>{0.996324241f, 0.658891559f},
-std::array<float,2>{0.00911379792f, 0.795334816f},
-std::array<float,2>{0.770246804f, 0.467427462f},
-std::array<float,2>{0.312592179f, 0.0103182094f},
-std::array<float,2>{0.539916992f, 0.708066344f},
-std::array<float,2>{0.426654577f, 0.502857268f},
-std::array<float,2>{0.637615144f, 0.214081496f},
-std::array<float,2>{0.193835363f, 0.277849585f},
-std::array<float,2>{0.889279008f, 0.995535314f},
-std::array<float,2>{0.150430411f, 0.643472433f},
-std::array<float,2>{0.947959185f, 0.0637433231f},
-std::array<float,2>{0.494956821f, 0.384640127f},
-std::array<float,2>{0.741798759f, 0.827152312f},
-std::array<float,2>{0.266379952f, 0.932413697f},
-std::array<float,2>{0.606877208f, 0.36631164f},
-std::array<float,2>{0.121610753f, 0.180256039f},
-std::array<float,2>{0.852881193f, 0.58809793f},
-std::array<float,2>{0.143581629f, 0.805044115f},
-std::array<float,2>{0.943932593f, 0.452207983f},
-std::array<float,2>{0.48635295f, 0.0284119733f},
-std::array<float,2>{0.747669578f, 0.698411167f},
-std::array<float,2>{0.278624743f, 0.515904725f},
-std::array<float,2>{0.5937953f, 0.201355308f},
-std::array<float,2>{0.11002107f, 0.257085174f},
-std::array<float,2>{0.846620917f, 0.973891914f},
-std::array<float,2>{0.000955544354f, 0.628429294f},
-std::array<float,2>{0.774451613f, 0.0814432874f},
-std::array<float,2>{0.327537924f, 0.400023848f},
-std::array<float,2>{0.533825159f, 0.829581499f},
-std::array<float,2>{0.433404356f, 0.919632375f},
-std::array<float,2>{0.630144238f, 0.352751285f},
-std::array<float,2>{0.203014091f, 0.167323694f},
-std::array<float,2>{0.875861883f, 0.56582135f},
-std::array<float,2>{0.0757563412f, 0.964991748f},
-std::array<float,2>{0.817756891f, 0.295016885f},
-std::array<float,2>{0.300364137f, 0.223268762f},
-std::array<float,2>{0.590685129f, 0.554898381f},
-std::array<float,2>{0.443967909f, 0.719778955f},
-std::array<float,2>{0.69680196f, 0.0551334471f},
-std::array<float,2>{0.17438966f, 0.486386836f},
-std::array<float,2>{0.990970671f, 0.76671046f},
-std::array<float,2>{0.225765824f, 0.611667156f},
-std::array<float,2>{0.913289428f, 0.143360123f},
-std::array<float,2>{0.384861499f, 0.320263088f},
-std::array<float,2>{0.672296405f, 0.879435837f},
-std::array<float,2>{0.364592522f, 0.865383804f},
-std::array<float,2>{0.501313627f, 0.416315913f},
-std::array<float,2>{0.0365421809f, 0.095859319f},
-std::array<float,2>{0.810202777f, 0.68326056f},
-std::array<float,2>{0.208245978f, 0.896963894f},
-std::array<float,2>{0.896839082f, 0.34210673f},
-std::array<float,2>{0.413333654f, 0.128367633f},
-std::array<float,2>{0.645855129f, 0.604842484f},
-std::array<float,2>{0.331559271f, 0.661652446f},
-std::array<float,2>{0.561658382f, 0.119198762f},
-std::array<float,2>{0.0267967619f, 0.426184148f},
-std::array<float,2>{0.764648139f, 0.844365656f},
-std::array<float,2>{0.0997722447f, 0.535564005f},
-std::array<float,2>{0.86144191f, 0.245498657f},
-std::array<float,2>{0.260500133f, 0.309204459f},
-std::array<float,2>{0.620958626f, 0.948678136f},
-std::array<float,2>{0.472507983f, 0.76197052f},
-std::array<float,2>{0.730189502f, 0.483275563f},
-std::array<float,2>{0.136021733f, 0.0325456932f},
-std::array<float,2>{0.966802716f, 0.739870489f},
-std::array<float,2>{0.0478677563f, 0.822150588f},
-std::array<float,2>{0.796658039f, 0.387503028f},
-std::array<float,2>{0.349776566f, 0.0689623281f},
-std::array<float,2>{0.525174797f, 0.646561921f},
-std::array<float,2>{0.392273158f, 0.592363715f},
-std::array<float,2>{0.65973556f, 0.187023401f},
-std::array<float,2>{0.242998615f, 0.360809058f},
-std::array<float,2>{0.923885345f, 0.936487436f},
-std::array<float,2>{0.158257902f, 0.70677501f},
-std::array<float,2>{0.978709936f, 0.0154437656f},
-std::array<float,2>{0.456241488f, 0.463816166f},
-std::array<float,2>{0.706399858f, 0.791298151f},
-std::array<float,2>{0.283644795f, 0.996416807f},
-std::array<float,2>{0.57029599f, 0.275518417f},
-std::array<float,2>{0.0918159038f, 0.21667093f},
-std::array<float,2>{0.833882391f, 0.504446387f},
-std::array<float,2>{0.236403689f, 0.851902664f},
-std::array<float,2>{0.935028434f, 0.436605304f},
-std::array<float,2>{0.400633991f, 0.114097334f},
-std::array<float,2>{0.666803777f, 0.671171665f},
-std::array<float,2>{0.354218543f, 0.598671377f},
-std::array<float,2>{0.519691944f, 0.133059502f},
-std::array<float,2>{0.0571744479f, 0.334138632f},
-std::array<float,2>{0.782544434f, 0.899969399f},
-std::array<float,2>{0.082296133f, 0.749329627f},
-std::array<float,2>{0.838824272f, 0.0407693535f},
-std::array<float,2>{0.293784052f, 0.471378684f},
-std::array<float,2>{0.571893394f, 0.751276493f},
-std::array<float,2>{0.466171771f, 0.93770802f},
-std::array<float,2>{0.714213789f, 0.301551729f},
-std::array<float,2>{0.171306714f, 0.236915469f},
-std::array<float,2>{0.970428884f, 0.542923033f},
-std::array<float,2>{0.017788047f, 0.921944916f},
-std::array<float,2>{0.753942966f, 0.37385571f},
-std::array<float,2>{0.336488485f, 0.178550899f},
-std::array<float,2>{0.551453769f, 0.578868747f},
-std::array<float,2>{0.4181692f, 0.650061846f},
-std::array<float,2>{0.650635421f, 0.070612371f},
-std::array<float,2>{0.217359558f, 0.379870176f},
-std::array<float,2>{0.901942551f, 0.819029868f},
-std::array<float,2>{0.129526556f, 0.511583328f},
-std::array<float,2>{0.960417092f, 0.208419338f},
-std::array<float,2>{0.480331779f, 0.270500124f},
-std::array<float,2>{0.72452569f, 0.988370061f},
-std::array<float,2>{0.250754863f, 0.788873553f},
-std::array<float,2>{0.615224898f, 0.459872961f},
-std::array<float,2>{0.102039486f, 0.00629264722f},
-std::array<float,2>{0.867907763f, 0.717862964f},
-std::array<float,2>{0.186749801f, 0.98404187f},
-std::array<float,2>{0.994388342f, 0.26509133f},
-std::array<float,2>{0.448373705f, 0.190832615f},
-std::array<float,2>{0.691910505f, 0.530902922f},
-std::array<float,2>{0.312412798f, 0.692141175f},
-std::array<float,2>{0.580085337f, 0.0187683497f},
-std::array<float,2>{0.0652580857f, 0.439632863f},
-std::array<float,2>{0.82506603f, 0.802997887f},
-std::array<float,2>{0.0455914959f, 0.575773537f},
-std::array<float,2>{0.801732123f, 0.161037341f},
-std::array<float,2>{0.369259268f, 0.346859246f},
-std::array<float,2>{0.510481119f, 0.909330845f},
-std::array<float,2>{0.38155356f, 0.840980947f},
-std::array<float,2>{0.686919808f, 0.392252952f},
-std::array<float,2>{0.234131709f, 0.091987215f},
-std::array<float,2>{0.916432381f, 0.63825953f},
-std::array<float,2>{0.119446374f, 0.774204731f},
-std::array<float,2>{0.857674122f, 0.493356258f},
-std::array<float,2>{0.272666276f, 0.0495888107f},
-std::array<float,2>{0.602748573f, 0.729447305f},
-std::array<float,2>{0.497052789f, 0.553936303f},
-std::array<float,2>{0.737452447f, 0.233603194f},
-std::array<float,2>{0.154820621f, 0.282010674f},
-std::array<float,2>{0.951742947f, 0.959103405f},
-std::array<float,2>{0.188238427f, 0.675831854f},
-std::array<float,2>{0.88308841f, 0.104767054f},
-std::array<float,2>{0.423190802f, 0.408557028f},
-std::array<float,2>{0.633610189f, 0.868499339f},
-std::array<float,2>{0.316411346f, 0.888683856f},
-std::array<float,2>{0.545157909f, 0.323768049f},
-std::array<float,2>{0.0131473532f, 0.148501292f},
-std::array<float,2>{0.76898545f, 0.624347508f},
-std::array<float,2>{0.193876192f, 0.793733299f},
-std::array<float,2>{0.888891459f, 0.46594438f},
-std::array<float,2>{0.426226795f, 0.00900435541f},
-std::array<float,2>{0.636831105f, 0.709698021f},
-std::array<float,2>{0.313059539f, 0.500905573f},
-std::array<float,2>{0.539387822f, 0.212817952f},
-std::array<float,2>{0.00939396024f, 0.279394984f},
-std::array<float,2>{0.769748151f, 0.992645323f},
-std::array<float,2>{0.121405445f, 0.641312242f},
-std::array<float,2>{0.853360415f, 0.0647246316f},
-std::array<float,2>{0.265879184f, 0.385817826f},
-std::array<float,2>{0.607351363f, 0.824647129f},
-std::array<float,2>{0.494519889f, 0.930806816f},
-std::array<float,2>{0.741340041f, 0.364285469f},
-std::array<float,2>{0.151349768f, 0.183023781f},
-std::array<float,2>{0.947495878f, 0.586810768f},
-std::array<float,2>{0.0398048535f, 0.952500522f},
-std::array<float,2>{0.799289584f, 0.307054877f},
-std::array<float,2>{0.373929113f, 0.247816741f},
-std::array<float,2>{0.514356613f, 0.535039306f},
-std::array<float,2>{0.377236992f, 0.735956907f},
-std::array<float,2>{0.682544589f, 0.0380521044f},
-std::array<float,2>{0.228760555f, 0.478769243f},
-std::array<float,2>{0.921148121f, 0.758767843f},
-std::array<float,2>{0.183119416f, 0.60770005f},
-std::array<float,2>{0.996869266f, 0.13279672f},
-std::array<float,2>{0.450062096f, 0.336324483f},
-std::array<float,2>{0.688150942f, 0.89316988f},
-std::array<float,2>{0.307490021f, 0.849579394f},
-std::array<float,2>{0.584540308f, 0.423863471f},
-std::array<float,2>{0.0692417398f, 0.124760002f},
-std::array<float,2>{0.821031272f, 0.658181727f},
-std::array<float,2>{0.128222376f, 0.878742337f},
-std::array<float,2>{0.954045832f, 0.314023405f},
-std::array<float,2>{0.483279765f, 0.146669045f},
-std::array<float,2>{0.722577631f, 0.614491999f},
-std::array<float,2>{0.256353438f, 0.684247196f},
-std::array<float,2>{0.611313581f, 0.101562396f},
-std::array<float,2>{0.107982829f, 0.421812445f},
-std::array<float,2>{0.873577476f, 0.860010505f},
-std::array<float,2>{0.0199223477f, 0.561145365f},
-std::array<float,2>{0.75265044f, 0.221467853f},
-std::array<float,2>{0.342970997f, 0.290305078f},
-std::array<float,2>{0.547422647f, 0.961803555f},
-std::array<float,2>{0.416982919f, 0.771411717f},
-std::array<float,2>{0.654886544f, 0.49103725f},
-std::array<float,2>{0.212731615f, 0.0595107451f},
-std::array<float,2>{0.905381083f, 0.725286186f},
-std::array<float,2>{0.0801026523f, 0.834035754f},
-std::array<float,2>{0.841802537f, 0.402989715f},
-std::array<float,2>{0.292615086f, 0.083791241f},
-std::array<float,2>{0.574452043f, 0.630936086f},
-std::array<float,2>{0.461093098f, 0.569723427f},
-std::array<float,2>{0.716850638f, 0.170909166f},
-std::array<float,2>{0.166343421f, 0.355513901f},
-std::array<float,2>{0.975787699f, 0.917324543f},
-std::array<float,2>{0.240149736f, 0.702272713f},
-std::array<float,2>{0.932137191f, 0.0234742053f},
-std::array<float,2>{0.405115634f, 0.448904663f},
-std::array<float,2>{0.6684708f, 0.808888197f},
-std::array<float,2>{0.355485469f, 0.971072853f},
-std::array<float,2>{0.518007338f, 0.251988947f},
-std::array<float,2>{0.0612920523f, 0.19546181f},
-std::array<float,2>{0.787361324f, 0.520784974f},
-std::array<float,2>{0.162412375f, 0.871763587f},
-std::array<float,2>{0.983579755f, 0.411238402f},
-std::array<float,2>{0.458673149f, 0.107073724f},
-std::array<float,2>{0.708455741f, 0.675424457f},
-std::array<float,2>{0.288491547f, 0.61997956f},
-std::array<float,2>{0.565562069f, 0.154477164f},
-std::array<float,2>{0.0871187374f, 0.326327026f},
-std::array<float,2>{0.828783274f, 0.884642184f},
-std::array<float,2>{0.0543376803f, 0.733032584f},
-std::array<float,2>{0.792889953f, 0.0546190403f},
-std::array<float,2>{0.344481826f, 0.499647439f},
-std::array<float,2>{0.528941274f, 0.779271305f},
-std::array<float,2>{0.397325277f, 0.954168558f},
-std::array<float,2>{0.660684884f, 0.285338134f},
-std::array<float,2>{0.247195825f, 0.227664322f},
-std::array<float,2>{0.929599106f, 0.550179303f},
-std::array<float,2>{0.0945658535f, 0.910644472f},
-std::array<float,2>{0.866544902f, 0.348013014f},
-std::array<float,2>{0.264577359f, 0.15900369f},
-std::array<float,2>{0.624220252f, 0.570660233f},
-std::array<float,2>{0.474960744f, 0.636070132f},
-std::array<float,2>{0.731715441f, 0.0887436345f},
-std::array<float,2>{0.139759526f, 0.397148252f},
-std::array<float,2>{0.961343765f, 0.837279916f},
-std::array<float,2>{0.204945728f, 0.524854958f},
-std::array<float,2>{0.891461194f, 0.192950323f},
-std::array<float,2>{0.407729268f, 0.259618878f},
-std::array<float,2>{0.642828584f, 0.978081644f},
-std::array<float,2>{0.334693998f, 0.798638701f},
-std::array<float,2>{0.555115819f, 0.443173289f},
-std::array<float,2>{0.0275661927f, 0.0217401758f},
-std::array<float,2>{0.760780513f, 0.690972269f},
-std::array<float,2>{0.220578253f, 0.985609233f},
-std::array<float,2>{0.909165084f, 0.26882273f},
-std::array<float,2>{0.388272464f, 0.205956131f},
-std::array<float,2>{0.677402079f, 0.514602721f},
-std::array<float,2>{0.362124056f, 0.712445855f},
-std::array<float,2>{0.50476414f, 0.000605858921f},
-std::array<float,2>{0.0339210182f, 0.454943568f},
-std::array<float,2>{0.804837823f, 0.78127259f},
-std::array<float,2>{0.0708949342f, 0.58314991f},
-std::array<float,2>{0.812518716f, 0.172979325f},
-std::array<float,2>{0.303902417f, 0.368919462f},
-std::array<float,2>{0.586680055f, 0.928512275f},
-std::array<float,2>{0.439596415f, 0.813479543f},
-std::array<float,2>{0.700991988f, 0.375158012f},
-std::array<float,2>{0.176990852f, 0.0755273998f},
-std::array<float,2>{0.98437798f, 0.652418852f},
-std::array<float,2>{0.00729124853f, 0.753986061f},
-std::array<float,2>{0.778850079f, 0.476373285f},
-std::array<float,2>{0.322143495f, 0.0467938446f},
-std::array<float,2>{0.537706852f, 0.74456811f},
-std::array<float,2>{0.434402257f, 0.544487178f},
-std::array<float,2>{0.625931859f, 0.241237342f},
-std::array<float,2>{0.19770281f, 0.300047576f},
-std::array<float,2>{0.882027924f, 0.942516625f},
-std::array<float,2>{0.144573614f, 0.666004062f},
-std::array<float,2>{0.941137791f, 0.112911612f},
-std::array<float,2>{0.488985866f, 0.430166155f},
-std::array<float,2>{0.743904769f, 0.856553137f},
-std::array<float,2>{0.276178151f, 0.903327227f},
-std::array<float,2>{0.598676085f, 0.33164078f},
-std::array<float,2>{0.114539951f, 0.136911839f},
-std::array<float,2>{0.850723624f, 0.597435474f},
-std::array<float,2>{0.154577598f, 0.775678873f},
-std::array<float,2>{0.951497912f, 0.494967431f},
-std::array<float,2>{0.49615398f, 0.0477999859f},
-std::array<float,2>{0.738065183f, 0.728433549f},
-std::array<float,2>{0.272981435f, 0.551500261f},
-std::array<float,2>{0.603356004f, 0.230896696f},
-std::array<float,2>{0.119685099f, 0.28372246f},
-std::array<float,2>{0.858103693f, 0.958111882f},
-std::array<float,2>{0.0133049162f, 0.678450406f},
-std::array<float,2>{0.769384682f, 0.102809139f},
-std::array<float,2>{0.317230731f, 0.406792939f},
-std::array<float,2>{0.545785189f, 0.869969547f},
-std::array<float,2>{0.423819929f, 0.886766672f},
-std::array<float,2>{0.633283675f, 0.32109791f},
-std::array<float,2>{0.187705234f, 0.151964247f},
-std::array<float,2>{0.883345962f, 0.621776104f},
-std::array<float,2>{0.0647474155f, 0.980917275f},
-std::array<float,2>{0.824414134f, 0.263137162f},
-std::array<float,2>{0.311875343f, 0.189093128f},
-std::array<float,2>{0.580800235f, 0.528558791f},
-std::array<float,2>{0.449106067f, 0.69453764f},
-std::array<float,2>{0.691823184f, 0.0171111971f},
-std::array<float,2>{0.187091082f, 0.437528789f},
-std::array<float,2>{0.994641781f, 0.801820636f},
-std::array<float,2>{0.233547986f, 0.576423466f},
-std::array<float,2>{0.916874588f, 0.162478223f},
-std::array<float,2>{0.381143063f, 0.344657212f},
-std::array<float,2>{0.687186003f, 0.906921387f},
-std::array<float,2>{0.370064944f, 0.843548656f},
-std::array<float,2>{0.510253608f, 0.393679321f},
-std::array<float,2>{0.0453903638f, 0.09096504f},
-std::array<float,2>{0.80083698f, 0.640505314f},
-std::array<float,2>{0.216989413f, 0.924125731f},
-std::array<float,2>{0.901631057f, 0.372194648f},
-std::array<float,2>{0.418894708f, 0.176054567f},
-std::array<float,2>{0.651126444f, 0.581381977f},
-std::array<float,2>{0.336326599f, 0.652278602f},
-std::array<float,2>{0.551159143f, 0.0728433654f},
-std::array<float,2>{0.0181835461f, 0.381276637f},
-std::array<float,2>{0.754861891f, 0.81795764f},
-std::array<float,2>{0.102431431f, 0.508585811f},
-std::array<float,2>{0.867287815f, 0.209604889f},
-std::array<float,2>{0.250477999f, 0.271831334f},
-std::array<float,2>{0.614420891f, 0.991947949f},
-std::array<float,2>{0.479579121f, 0.785751343f},
-std::array<float,2>{0.723899066f, 0.458943158f},
-std::array<float,2>{0.129259363f, 0.00499923015f},
-std::array<float,2>{0.960679412f, 0.715894222f},
-std::array<float,2>{0.0569158979f, 0.85531044f},
-std::array<float,2>{0.782937706f, 0.435373276f},
-std::array<float,2>{0.35358274f, 0.116418064f},
-std::array<float,2>{0.520401597f, 0.669630587f},
-std::array<float,2>{0.400948733f, 0.599908471f},
-std::array<float,2>{0.666124701f, 0.135211378f},
-std::array<float,2>{0.237280831f, 0.332169056f},
-std::array<float,2>{0.935318947f, 0.900496066f},
-std::array<float,2>{0.171552703f, 0.747407734f},
-std::array<float,2>{0.96999675f, 0.0423260964f},
-std::array<float,2>{0.466459781f, 0.468947619f},
-std::array<float,2>{0.714490771f, 0.753004193f},
-std::array<float,2>{0.29334873f, 0.939688802f},
-std::array<float,2>{0.571678817f, 0.302819252f},
-std::array<float,2>{0.0829391703f, 0.234900221f},
-std::array<float,2>{0.837970495f, 0.539303422f},
-std::array<float,2>{0.242661282f, 0.82265991f},
-std::array<float,2>{0.924499512f, 0.388924062f},
-std::array<float,2>{0.391971141f, 0.0675293654f},
-std::array<float,2>{0.659400225f, 0.646159589f},
-std::array<float,2>{0.350412726f, 0.59103781f},
-std::array<float,2>{0.52460736f, 0.18392919f},
-std::array<float,2>{0.0484524183f, 0.36218226f},
-std::array<float,2>{0.796188414f, 0.934566259f},
-std::array<float,2>{0.092554301f, 0.704995036f},
-std::array<float,2>{0.833077133f, 0.013402313f},
-std::array<float,2>{0.283760279f, 0.462715507f},
-std::array<float,2>{0.56934762f, 0.79054445f},
-std::array<float,2>{0.456682295f, 0.999471486f},
-std::array<float,2>{0.707012594f, 0.274820894f},
-std::array<float,2>{0.158735991f, 0.216968223f},
-std::array<float,2>{0.979316831f, 0.506355405f},
-std::array<float,2>{0.0271472055f, 0.895570099f},
-std::array<float,2>{0.763864338f, 0.341336131f},
-std::array<float,2>{0.331319988f, 0.125226468f},
-std::array<float,2>{0.562404454f, 0.602638662f},
-std::array<float,2>{0.413635254f, 0.663446069f},
-std::array<float,2>{0.646466255f, 0.118642621f},
-std::array<float,2>{0.20890379f, 0.429270297f},
-std::array<float,2>{0.897435963f, 0.846931934f},
-std::array<float,2>{0.136280969f, 0.538000226f},
-std::array<float,2>{0.96761471f, 0.242915377f},
-std::array<float,2>{0.47170645f, 0.311760187f},
-std::array<float,2>{0.729719698f, 0.947222054f},
-std::array<float,2>{0.259802788f, 0.765248656f},
-std::array<float,2>{0.620420814f, 0.481927782f},
-std::array<float,2>{0.100520715f, 0.0338100269f},
-std::array<float,2>{0.861974597f, 0.741661549f},
-std::array<float,2>{0.17426309f, 0.967915058f},
-std::array<float,2>{0.990515232f, 0.293181539f},
-std::array<float,2>{0.443570673f, 0.2246259f},
-std::array<float,2>{0.696333289f, 0.557465494f},
-std::array<float,2>{0.299965799f, 0.721137166f},
-std::array<float,2>{0.590269327f, 0.0585049875f},
-std::array<float,2>{0.0753872842f, 0.486309111f},
-std::array<float,2>{0.818271339f, 0.767578244f},
-std::array<float,2>{0.0366385542f, 0.61117053f},
-std::array<float,2>{0.809942782f, 0.141699165f},
-std::array<float,2>{0.365052015f, 0.31808871f},
-std::array<float,2>{0.501492202f, 0.881895244f},
-std::array<float,2>{0.38556686f, 0.864949524f},
-std::array<float,2>{0.672618747f, 0.414213359f},
-std::array<float,2>{0.226175413f, 0.0941004157f},
-std::array<float,2>{0.914019346f, 0.681586742f},
-std::array<float,2>{0.109609067f, 0.808138251f},
-std::array<float,2>{0.845901847f, 0.450888008f},
-std::array<float,2>{0.279294819f, 0.0297786389f},
-std::array<float,2>{0.594394267f, 0.695659041f},
-std::array<float,2>{0.487097234f, 0.519155025f},
-std::array<float,2>{0.747356772f, 0.199833795f},
-std::array<float,2>{0.144233093f, 0.255841345f},
-std::array<float,2>{0.94366765f, 0.97549057f},
-std::array<float,2>{0.202597201f, 0.626391053f},
-std::array<float,2>{0.875380993f, 0.0781760514f},
-std::array<float,2>{0.432784796f, 0.402000964f},
-std::array<float,2>{0.630436838f, 0.83106041f},
-std::array<float,2>{0.327828199f, 0.920413256f},
-std::array<float,2>{0.533444047f, 0.354052186f},
-std::array<float,2>{0.000376929151f, 0.165980309f},
-std::array<float,2>{0.775236249f, 0.56311512f},
-std::array<float,2>{0.227881521f, 0.759789824f},
-std::array<float,2>{0.918274224f, 0.476843536f},
-std::array<float,2>{0.376320064f, 0.0366381481f},
-std::array<float,2>{0.680992603f, 0.736528277f},
-std::array<float,2>{0.372464001f, 0.532400191f},
-std::array<float,2>{0.512330711f, 0.249505267f},
-std::array<float,2>{0.0416121781f, 0.305658937f},
-std::array<float,2>{0.798321903f, 0.95102042f},
-std::array<float,2>{0.067163147f, 0.65856564f},
-std::array<float,2>{0.822625339f, 0.122857265f},
-std::array<float,2>{0.305248767f, 0.422780067f},
-std::array<float,2>{0.582962632f, 0.849861085f},
-std::array<float,2>{0.451857686f, 0.890822589f},
-std::array<float,2>{0.690067112f, 0.338796169f},
-std::array<float,2>{0.180414036f, 0.130558714f},
-std::array<float,2>{0.998522997f, 0.606717229f},
-std::array<float,2>{0.00991060305f, 0.996090889f},
-std::array<float,2>{0.773371398f, 0.27757293f},
-std::array<float,2>{0.31490466f, 0.214756593f},
-std::array<float,2>{0.541496754f, 0.502174795f},
-std::array<float,2>{0.428844243f, 0.708685875f},
-std::array<float,2>{0.640556991f, 0.0102200527f},
-std::array<float,2>{0.192354724f, 0.467185527f},
-std::array<float,2>{0.887749314f, 0.79572922f},
-std::array<float,2>{0.148904026f, 0.588444829f},
-std::array<float,2>{0.945725679f, 0.179898098f},
-std::array<float,2>{0.492324412f, 0.36671102f},
-std::array<float,2>{0.739116311f, 0.93165803f},
-std::array<float,2>{0.269016176f, 0.827947855f},
-std::array<float,2>{0.608110964f, 0.384043545f},
-std::array<float,2>{0.124856584f, 0.0640858635f},
-std::array<float,2>{0.853639126f, 0.642759025f},
-std::array<float,2>{0.165760651f, 0.915127218f},
-std::array<float,2>{0.97376889f, 0.358972847f},
-std::array<float,2>{0.463027f, 0.169047609f},
-std::array<float,2>{0.715659499f, 0.567425191f},
-std::array<float,2>{0.290537f, 0.62893182f},
-std::array<float,2>{0.576420069f, 0.0853932798f},
-std::array<float,2>{0.0800029933f, 0.404297024f},
-std::array<float,2>{0.841402173f, 0.832533717f},
-std::array<float,2>{0.0599614643f, 0.52318871f},
-std::array<float,2>{0.78550452f, 0.197805583f},
-std::array<float,2>{0.357716113f, 0.250011027f},
-std::array<float,2>{0.516455173f, 0.969647169f},
-std::array<float,2>{0.403833061f, 0.81168443f},
-std::array<float,2>{0.670506179f, 0.446499735f},
-std::array<float,2>{0.241615191f, 0.0257146023f},
-std::array<float,2>{0.929911315f, 0.701079786f},
-std::array<float,2>{0.107066445f, 0.861987293f},
-std::array<float,2>{0.871398091f, 0.419335604f},
-std::array<float,2>{0.255574048f, 0.0979282483f},
-std::array<float,2>{0.612676024f, 0.68739295f},
-std::array<float,2>{0.482092232f, 0.616780221f},
-std::array<float,2>{0.719377637f, 0.145949572f},
-std::array<float,2>{0.125985697f, 0.314606279f},
-std::array<float,2>{0.955682397f, 0.876453578f},
-std::array<float,2>{0.212992087f, 0.722937465f},
-std::array<float,2>{0.903143585f, 0.0615565814f},
-std::array<float,2>{0.414606065f, 0.488501847f},
-std::array<float,2>{0.653879583f, 0.77199918f},
-std::array<float,2>{0.340088814f, 0.963075638f},
-std::array<float,2>{0.549996197f, 0.291076839f},
-std::array<float,2>{0.022146184f, 0.219502449f},
-std::array<float,2>{0.751331985f, 0.560138941f},
-std::array<float,2>{0.138341531f, 0.838832259f},
-std::array<float,2>{0.964475572f, 0.394836366f},
-std::array<float,2>{0.474212915f, 0.087491639f},
-std::array<float,2>{0.733762622f, 0.633246481f},
-std::array<float,2>{0.263550609f, 0.574213505f},
-std::array<float,2>{0.621767819f, 0.158155903f},
-std::array<float,2>{0.0958271101f, 0.351136237f},
-std::array<float,2>{0.864657521f, 0.913480639f},
-std::array<float,2>{0.0312110893f, 0.688995838f},
-std::array<float,2>{0.759254098f, 0.0196185615f},
-std::array<float,2>{0.333521187f, 0.444678396f},
-std::array<float,2>{0.557356119f, 0.799271166f},
-std::array<float,2>{0.408997744f, 0.978796542f},
-std::array<float,2>{0.641432881f, 0.260935128f},
-std::array<float,2>{0.206589505f, 0.194429919f},
-std::array<float,2>{0.894478559f, 0.52652818f},
-std::array<float,2>{0.0896562114f, 0.885489404f},
-std::array<float,2>{0.831493497f, 0.325997829f},
-std::array<float,2>{0.285862207f, 0.154090136f},
-std::array<float,2>{0.564279377f, 0.617274165f},
-std::array<float,2>{0.45970726f, 0.672689974f},
-std::array<float,2>{0.709342062f, 0.108512759f},
-std::array<float,2>{0.160836831f, 0.412368238f},
-std::array<float,2>{0.980521083f, 0.874727845f},
-std::array<float,2>{0.249660596f, 0.547260106f},
-std::array<float,2>{0.92664963f, 0.229923621f},
-std::array<float,2>{0.39566797f, 0.287143737f},
-std::array<float,2>{0.663126171f, 0.955793619f},
-std::array<float,2>{0.347102404f, 0.779517829f},
-std::array<float,2>{0.529872835f, 0.496296108f},
-std::array<float,2>{0.0513639115f, 0.0523234978f},
-std::array<float,2>{0.790389895f, 0.731433153f},
-std::array<float,2>{0.196964622f, 0.94425869f},
-std::array<float,2>{0.879360497f, 0.297418445f},
-std::array<float,2>{0.43725431f, 0.239796713f},
-std::array<float,2>{0.627376676f, 0.54505688f},
-std::array<float,2>{0.322494954f, 0.744114995f},
-std::array<float,2>{0.536191702f, 0.0442469008f},
-std::array<float,2>{0.00500412052f, 0.474330157f},
-std::array<float,2>{0.780610144f, 0.755886674f},
-std::array<float,2>{0.115472496f, 0.594047487f},
-std::array<float,2>{0.849551976f, 0.140467539f},
-std::array<float,2>{0.274874359f, 0.328591168f},
-std::array<float,2>{0.600696504f, 0.905735016f},
-std::array<float,2>{0.49148187f, 0.857723773f},
-std::array<float,2>{0.744562864f, 0.433185697f},
-std::array<float,2>{0.14761731f, 0.110729963f},
-std::array<float,2>{0.93932569f, 0.667394042f},
-std::array<float,2>{0.0323644355f, 0.783449173f},
-std::array<float,2>{0.807955921f, 0.455387473f},
-std::array<float,2>{0.360257357f, 0.00329343532f},
-std::array<float,2>{0.506423295f, 0.713219821f},
-std::array<float,2>{0.38873291f, 0.512807965f},
-std::array<float,2>{0.679332495f, 0.204552472f},
-std::array<float,2>{0.222429544f, 0.266192555f},
-std::array<float,2>{0.907335579f, 0.986709297f},
-std::array<float,2>{0.17855826f, 0.655549347f},
-std::array<float,2>{0.987015247f, 0.0766682252f},
-std::array<float,2>{0.438108414f, 0.378620088f},
-std::array<float,2>{0.701922417f, 0.815600216f},
-std::array<float,2>{0.301618546f, 0.927379727f},
-std::array<float,2>{0.588773131f, 0.370155305f},
-std::array<float,2>{0.0724233314f, 0.1751142f},
-std::array<float,2>{0.815866292f, 0.585591972f},
-std::array<float,2>{0.184911802f, 0.803252816f},
-std::array<float,2>{0.99346292f, 0.440194935f},
-std::array<float,2>{0.446695685f, 0.0192786865f},
-std::array<float,2>{0.694178581f, 0.691893756f},
-std::array<float,2>{0.30974406f, 0.530413032f},
-std::array<float,2>{0.579833746f, 0.19102779f},
-std::array<float,2>{0.0629395396f, 0.265540183f},
-std::array<float,2>{0.82713151f, 0.983776689f},
-std::array<float,2>{0.0431945883f, 0.638051331f},
-std::array<float,2>{0.802782714f, 0.0925808623f},
-std::array<float,2>{0.367380321f, 0.392030895f},
-std::array<float,2>{0.50937742f, 0.841729641f},
-std::array<float,2>{0.379645228f, 0.909917891f},
-std::array<float,2>{0.684170783f, 0.34765321f},
-std::array<float,2>{0.232014582f, 0.160389751f},
-std::array<float,2>{0.915404677f, 0.575208426f},
-std::array<float,2>{0.117983431f, 0.959944844f},
-std::array<float,2>{0.856530666f, 0.28140381f},
-std::array<float,2>{0.270292491f, 0.234354213f},
-std::array<float,2>{0.604166329f, 0.554214358f},
-std::array<float,2>{0.49925527f, 0.728869021f},
-std::array<float,2>{0.734891713f, 0.0492770635f},
-std::array<float,2>{0.153454408f, 0.494023263f},
-std::array<float,2>{0.949320853f, 0.773839533f},
-std::array<float,2>{0.189813212f, 0.624940097f},
-std::array<float,2>{0.885411322f, 0.149022326f},
-std::array<float,2>{0.425008416f, 0.323255539f},
-std::array<float,2>{0.636006892f, 0.889504254f},
-std::array<float,2>{0.31934163f, 0.869053543f},
-std::array<float,2>{0.544278562f, 0.408753425f},
-std::array<float,2>{0.0145764565f, 0.105263121f},
-std::array<float,2>{0.766019642f, 0.676366806f},
-std::array<float,2>{0.236050069f, 0.899818778f},
-std::array<float,2>{0.936668754f, 0.334527969f},
-std::array<float,2>{0.399135053f, 0.133463442f},
-std::array<float,2>{0.664862037f, 0.599460483f},
-std::array<float,2>{0.351944983f, 0.671424091f},
-std::array<float,2>{0.523366451f, 0.11355307f},
-std::array<float,2>{0.056509126f, 0.437188566f},
-std::array<float,2>{0.783458054f, 0.852261841f},
-std::array<float,2>{0.0855650306f, 0.542283833f},
-std::array<float,2>{0.837702096f, 0.23666963f},
-std::array<float,2>{0.295751572f, 0.300975204f},
-std::array<float,2>{0.573104978f, 0.938076556f},
-std::array<float,2>{0.467152327f, 0.751573503f},
-std::array<float,2>{0.712750793f, 0.471155375f},
-std::array<float,2>{0.16879116f, 0.0402186215f},
-std::array<float,2>{0.971312404f, 0.749661624f},
-std::array<float,2>{0.0156727713f, 0.818840683f},
-std::array<float,2>{0.756411672f, 0.379143983f},
-std::array<float,2>{0.338341326f, 0.0711675659f},
-std::array<float,2>{0.554027438f, 0.649871469f},
-std::array<float,2>{0.421035081f, 0.578233957f},
-std::array<float,2>{0.648568213f, 0.178154677f},
-std::array<float,2>{0.216664344f, 0.373188704f},
-std::array<float,2>{0.900206804f, 0.922367632f},
-std::array<float,2>{0.131672591f, 0.718710184f},
-std::array<float,2>{0.958184004f, 0.00657128356f},
-std::array<float,2>{0.478508025f, 0.459185362f},
-std::array<float,2>{0.726419389f, 0.78831625f},
-std::array<float,2>{0.253068864f, 0.988770962f},
-std::array<float,2>{0.617015958f, 0.269741118f},
-std::array<float,2>{0.105073318f, 0.208584294f},
-std::array<float,2>{0.869330049f, 0.510859072f},
-std::array<float,2>{0.210120395f, 0.843809247f},
-std::array<float,2>{0.89645499f, 0.426306814f},
-std::array<float,2>{0.411405832f, 0.120091446f},
-std::array<float,2>{0.647992074f, 0.661553562f},
-std::array<float,2>{0.329817504f, 0.605156779f},
-std::array<float,2>{0.559414864f, 0.128597751f},
-std::array<float,2>{0.0252570119f, 0.342597306f},
-std::array<float,2>{0.762976885f, 0.897453308f},
-std::array<float,2>{0.097756356f, 0.739280403f},
-std::array<float,2>{0.859456658f, 0.0331247188f},
-std::array<float,2>{0.258841366f, 0.48274526f},
-std::array<float,2>{0.617478788f, 0.76232785f},
-std::array<float,2>{0.470526248f, 0.948742092f},
-std::array<float,2>{0.727294326f, 0.308940202f},
-std::array<float,2>{0.133851305f, 0.245671779f},
-std::array<float,2>{0.964892447f, 0.535723805f},
-std::array<float,2>{0.0499227867f, 0.936019063f},
-std::array<float,2>{0.794885099f, 0.361152202f},
-std::array<float,2>{0.347722203f, 0.186948478f},
-std::array<float,2>{0.526883364f, 0.591894567f},
-std::array<float,2>{0.392700821f, 0.647200286f},
-std::array<float,2>{0.657599449f, 0.0684053749f},
-std::array<float,2>{0.245855421f, 0.386834979f},
-std::array<float,2>{0.922236919f, 0.821403086f},
-std::array<float,2>{0.158052504f, 0.50399226f},
-std::array<float,2>{0.977568209f, 0.215821847f},
-std::array<float,2>{0.454617709f, 0.275915861f},
-std::array<float,2>{0.704427361f, 0.996747732f},
-std::array<float,2>{0.281513065f, 0.791921258f},
-std::array<float,2>{0.568285346f, 0.462916523f},
-std::array<float,2>{0.0917224735f, 0.0147998715f},
-std::array<float,2>{0.835232913f, 0.706527233f},
-std::array<float,2>{0.140711278f, 0.974261045f},
-std::array<float,2>{0.941686392f, 0.257350087f},
-std::array<float,2>{0.484668136f, 0.201774657f},
-std::array<float,2>{0.748530149f, 0.516312957f},
-std::array<float,2>{0.279417127f, 0.698750854f},
-std::array<float,2>{0.597590923f, 0.0291647092f},
-std::array<float,2>{0.112850338f, 0.4529351f},
-std::array<float,2>{0.845205426f, 0.805510104f},
-std::array<float,2>{0.00368790841f, 0.565969944f},
-std::array<float,2>{0.776915193f, 0.167806342f},
-std::array<float,2>{0.325725585f, 0.353336602f},
-std::array<float,2>{0.532446384f, 0.918960631f},
-std::array<float,2>{0.430433095f, 0.829773188f},
-std::array<float,2>{0.63105315f, 0.399665922f},
-std::array<float,2>{0.200183764f, 0.0818059295f},
-std::array<float,2>{0.877744734f, 0.628014147f},
-std::array<float,2>{0.0764749199f, 0.767232656f},
-std::array<float,2>{0.818381488f, 0.486913323f},
-std::array<float,2>{0.298164189f, 0.0555786528f},
-std::array<float,2>{0.593041897f, 0.720437944f},
-std::array<float,2>{0.443206459f, 0.555588901f},
-std::array<float,2>{0.698174596f, 0.22298941f},
-std::array<float,2>{0.172179163f, 0.295679986f},
-std::array<float,2>{0.988832831f, 0.965656519f},
-std::array<float,2>{0.223226324f, 0.682786763f},
-std::array<float,2>{0.911905587f, 0.0962341055f},
-std::array<float,2>{0.38447696f, 0.416754246f},
-std::array<float,2>{0.675470591f, 0.866177022f},
-std::array<float,2>{0.366903633f, 0.878908157f},
-std::array<float,2>{0.502308011f, 0.319647491f},
-std::array<float,2>{0.037124265f, 0.14279215f},
-std::array<float,2>{0.811706007f, 0.611832023f},
-std::array<float,2>{0.240641579f, 0.809793234f},
-std::array<float,2>{0.931264579f, 0.44739601f},
-std::array<float,2>{0.403025299f, 0.0245484896f},
-std::array<float,2>{0.67133373f, 0.701502264f},
-std::array<float,2>{0.359350711f, 0.520310342f},
-std::array<float,2>{0.516673088f, 0.196663395f},
-std::array<float,2>{0.0589207262f, 0.253174692f},
-std::array<float,2>{0.786800504f, 0.971714318f},
-std::array<float,2>{0.0783040076f, 0.632469177f},
-std::array<float,2>{0.839925587f, 0.082628794f},
-std::array<float,2>{0.289600164f, 0.403374672f},
-std::array<float,2>{0.577366292f, 0.835545838f},
-std::array<float,2>{0.464521021f, 0.916869462f},
-std::array<float,2>{0.71655941f, 0.356865793f},
-std::array<float,2>{0.164729387f, 0.170690954f},
-std::array<float,2>{0.973276854f, 0.569293857f},
-std::array<float,2>{0.0231426097f, 0.961957037f},
-std::array<float,2>{0.750668049f, 0.289650708f},
-std::array<float,2>{0.341789782f, 0.222114399f},
-std::array<float,2>{0.54885608f, 0.561679602f},
-std::array<float,2>{0.415909946f, 0.725611329f},
-std::array<float,2>{0.653281748f, 0.0596159585f},
-std::array<float,2>{0.214378148f, 0.491939306f},
-std::array<float,2>{0.903800726f, 0.769969761f},
-std::array<float,2>{0.125403211f, 0.613407433f},
-std::array<float,2>{0.956181645f, 0.147614375f},
-std::array<float,2>{0.480602205f, 0.312593609f},
-std::array<float,2>{0.720520377f, 0.877896667f},
-std::array<float,2>{0.254385144f, 0.86085844f},
-std::array<float,2>{0.612155974f, 0.42049104f},
-std::array<float,2>{0.105739675f, 0.10049779f},
-std::array<float,2>{0.872929633f, 0.684656441f},
-std::array<float,2>{0.180992603f, 0.894444585f},
-std::array<float,2>{0.999548435f, 0.337450773f},
-std::array<float,2>{0.452355325f, 0.131647691f},
-std::array<float,2>{0.69050163f, 0.608713865f},
-std::array<float,2>{0.305966526f, 0.657061219f},
-std::array<float,2>{0.583694994f, 0.123895288f},
-std::array<float,2>{0.0677891523f, 0.425293118f},
-std::array<float,2>{0.82392174f, 0.848426402f},
-std::array<float,2>{0.0420050621f, 0.533284247f},
-std::array<float,2>{0.796878755f, 0.246499911f},
-std::array<float,2>{0.371524841f, 0.307967186f},
-std::array<float,2>{0.513064563f, 0.951839387f},
-std::array<float,2>{0.375178993f, 0.759677172f},
-std::array<float,2>{0.679905057f, 0.480299294f},
-std::array<float,2>{0.226850063f, 0.0383921862f},
-std::array<float,2>{0.919485807f, 0.734747231f},
-std::array<float,2>{0.12337999f, 0.826167047f},
-std::array<float,2>{0.855279028f, 0.385355622f},
-std::array<float,2>{0.268217862f, 0.0661529303f},
-std::array<float,2>{0.60851419f, 0.642559707f},
-std::array<float,2>{0.493726611f, 0.5869506f},
-std::array<float,2>{0.739782512f, 0.181991383f},
-std::array<float,2>{0.15024446f, 0.363690764f},
-std::array<float,2>{0.946626425f, 0.929992378f},
-std::array<float,2>{0.193022028f, 0.710760295f},
-std::array<float,2>{0.887099445f, 0.00786954816f},
-std::array<float,2>{0.428574562f, 0.465407014f},
-std::array<float,2>{0.639402509f, 0.794702828f},
-std::array<float,2>{0.316263258f, 0.994116783f},
-std::array<float,2>{0.542673886f, 0.281194329f},
-std::array<float,2>{0.0110826129f, 0.211815178f},
-std::array<float,2>{0.771648228f, 0.500988901f},
-std::array<float,2>{0.146738946f, 0.855993211f},
-std::array<float,2>{0.938350379f, 0.430826634f},
-std::array<float,2>{0.490392655f, 0.111540884f},
-std::array<float,2>{0.746065617f, 0.664402843f},
-std::array<float,2>{0.273748785f, 0.596149325f},
-std::array<float,2>{0.599641502f, 0.137927666f},
-std::array<float,2>{0.11652986f, 0.330943853f},
-std::array<float,2>{0.848187983f, 0.902893722f},
-std::array<float,2>{0.00469818944f, 0.745710611f},
-std::array<float,2>{0.779632866f, 0.0452859364f},
-std::array<float,2>{0.323880404f, 0.474830508f},
-std::array<float,2>{0.53608644f, 0.754903615f},
-std::array<float,2>{0.436102867f, 0.942238927f},
-std::array<float,2>{0.628070951f, 0.299292594f},
-std::array<float,2>{0.195598736f, 0.240598157f},
-std::array<float,2>{0.880601764f, 0.5434286f},
-std::array<float,2>{0.073383972f, 0.929084897f},
-std::array<float,2>{0.815163016f, 0.368156999f},
-std::array<float,2>{0.302269936f, 0.172832251f},
-std::array<float,2>{0.589161873f, 0.582171202f},
-std::array<float,2>{0.438999236f, 0.653896749f},
-std::array<float,2>{0.702527106f, 0.074224323f},
-std::array<float,2>{0.178865746f, 0.375997573f},
-std::array<float,2>{0.988064587f, 0.813403428f},
-std::array<float,2>{0.221196383f, 0.514673471f},
-std::array<float,2>{0.906998515f, 0.206707522f},
-std::array<float,2>{0.38994965f, 0.267714769f},
-std::array<float,2>{0.678293943f, 0.985200167f},
-std::array<float,2>{0.360861599f, 0.782669187f},
-std::array<float,2>{0.507257044f, 0.453746825f},
-std::array<float,2>{0.0322253667f, 0.00101371226f},
-std::array<float,2>{0.807505786f, 0.711348593f},
-std::array<float,2>{0.205278322f, 0.977348089f},
-std::array<float,2>{0.893518329f, 0.258553028f},
-std::array<float,2>{0.409319103f, 0.19141376f},
-std::array<float,2>{0.642011523f, 0.523550093f},
-std::array<float,2>{0.33233875f, 0.689702153f},
-std::array<float,2>{0.558572471f, 0.022830721f},
-std::array<float,2>{0.029916957f, 0.441909194f},
-std::array<float,2>{0.758084655f, 0.797785878f},
-std::array<float,2>{0.0973238274f, 0.571801424f},
-std::array<float,2>{0.863761902f, 0.160051525f},
-std::array<float,2>{0.261966407f, 0.349047035f},
-std::array<float,2>{0.622867048f, 0.9114272f},
-std::array<float,2>{0.473111153f, 0.836203754f},
-std::array<float,2>{0.732458115f, 0.39827168f},
-std::array<float,2>{0.13741836f, 0.0892907083f},
-std::array<float,2>{0.963568449f, 0.635692537f},
-std::array<float,2>{0.0517729521f, 0.777561784f},
-std::array<float,2>{0.789672315f, 0.498106062f},
-std::array<float,2>{0.345836848f, 0.0535606071f},
-std::array<float,2>{0.530918539f, 0.733825266f},
-std::array<float,2>{0.395442516f, 0.549240947f},
-std::array<float,2>{0.662347913f, 0.226808801f},
-std::array<float,2>{0.248189896f, 0.286452144f},
-std::array<float,2>{0.92711693f, 0.953949809f},
-std::array<float,2>{0.161552414f, 0.674768031f},
-std::array<float,2>{0.981820107f, 0.106131673f},
-std::array<float,2>{0.460205793f, 0.410622746f},
-std::array<float,2>{0.710124314f, 0.872472942f},
-std::array<float,2>{0.286407501f, 0.883129358f},
-std::array<float,2>{0.563010991f, 0.32810086f},
-std::array<float,2>{0.0883403867f, 0.155494705f},
-std::array<float,2>{0.830185533f, 0.620808661f},
-std::array<float,2>{0.169805974f, 0.752243161f},
-std::array<float,2>{0.97179395f, 0.470131248f},
-std::array<float,2>{0.468682855f, 0.0415786132f},
-std::array<float,2>{0.711220503f, 0.7461496f},
-std::array<float,2>{0.296274036f, 0.540100694f},
-std::array<float,2>{0.574041307f, 0.235525429f},
-std::array<float,2>{0.0849124268f, 0.30376935f},
-std::array<float,2>{0.836100519f, 0.940455675f},
-std::array<float,2>{0.0552835055f, 0.668311954f},
-std::array<float,2>{0.785104096f, 0.115836985f},
-std::array<float,2>{0.353469729f, 0.434566498f},
-std::array<float,2>{0.521995604f, 0.854311585f},
-std::array<float,2>{0.400383025f, 0.901731372f},
-std::array<float,2>{0.665436149f, 0.333700478f},
-std::array<float,2>{0.235213205f, 0.136508837f},
-std::array<float,2>{0.935841978f, 0.601279378f},
-std::array<float,2>{0.103863023f, 0.991179526f},
-std::array<float,2>{0.870720983f, 0.272999763f},
-std::array<float,2>{0.252442628f, 0.21050787f},
-std::array<float,2>{0.616050005f, 0.509270608f},
-std::array<float,2>{0.476667315f, 0.715512574f},
-std::array<float,2>{0.725494683f, 0.00461556064f},
-std::array<float,2>{0.13261503f, 0.457573086f},
-std::array<float,2>{0.957393706f, 0.786871612f},
-std::array<float,2>{0.215552956f, 0.580597579f},
-std::array<float,2>{0.899408102f, 0.177215993f},
-std::array<float,2>{0.420563281f, 0.372028351f},
-std::array<float,2>{0.6495713f, 0.925445735f},
-std::array<float,2>{0.339522183f, 0.817122936f},
-std::array<float,2>{0.553320706f, 0.382106215f},
-std::array<float,2>{0.0166560542f, 0.0734979287f},
-std::array<float,2>{0.756915569f, 0.650951028f},
-std::array<float,2>{0.23067078f, 0.907403111f},
-std::array<float,2>{0.914525688f, 0.345341831f},
-std::array<float,2>{0.380089313f, 0.163121879f},
-std::array<float,2>{0.685316265f, 0.577495456f},
-std::array<float,2>{0.368598193f, 0.639084637f},
-std::array<float,2>{0.508466959f, 0.0902097449f},
-std::array<float,2>{0.0448734649f, 0.393018037f},
-std::array<float,2>{0.804383814f, 0.841996789f},
-std::array<float,2>{0.0636655167f, 0.527633667f},
-std::array<float,2>{0.827624023f, 0.188234195f},
-std::array<float,2>{0.309030324f, 0.262393117f},
-std::array<float,2>{0.578723788f, 0.981924772f},
-std::array<float,2>{0.445860833f, 0.80141896f},
-std::array<float,2>{0.694345176f, 0.439419419f},
-std::array<float,2>{0.184494764f, 0.0165457204f},
-std::array<float,2>{0.993095458f, 0.694274068f},
-std::array<float,2>{0.0148480479f, 0.870171368f},
-std::array<float,2>{0.76665169f, 0.407626867f},
-std::array<float,2>{0.318981022f, 0.101745695f},
-std::array<float,2>{0.54363817f, 0.679663539f},
-std::array<float,2>{0.424366593f, 0.622493684f},
-std::array<float,2>{0.635427892f, 0.151125193f},
-std::array<float,2>{0.19114314f, 0.321357936f},
-std::array<float,2>{0.886210442f, 0.888199866f},
-std::array<float,2>{0.15316157f, 0.726923823f},
-std::array<float,2>{0.950818181f, 0.0485106818f},
-std::array<float,2>{0.498404771f, 0.495204389f},
-std::array<float,2>{0.735690296f, 0.776587963f},
-std::array<float,2>{0.27054283f, 0.957275629f},
-std::array<float,2>{0.604764283f, 0.284639597f},
-std::array<float,2>{0.118338324f, 0.232277617f},
-std::array<float,2>{0.855526924f, 0.552156329f},
-std::array<float,2>{0.200692967f, 0.83011961f},
-std::array<float,2>{0.877984405f, 0.40079245f},
-std::array<float,2>{0.430882633f, 0.0795666873f},
-std::array<float,2>{0.632275283f, 0.625694752f},
-std::array<float,2>{0.325017482f, 0.564442217f},
-std::array<float,2>{0.531391025f, 0.164374888f},
-std::array<float,2>{0.00197543926f, 0.355146229f},
-std::array<float,2>{0.775573075f, 0.921011031f},
-std::array<float,2>{0.112080924f, 0.69713974f},
-std::array<float,2>{0.844211698f, 0.0307768825f},
-std::array<float,2>{0.280362785f, 0.449251831f},
-std::array<float,2>{0.59575808f, 0.806981742f},
-std::array<float,2>{0.485986918f, 0.976181328f},
-std::array<float,2>{0.749642372f, 0.25458014f},
-std::array<float,2>{0.141719937f, 0.201073334f},
-std::array<float,2>{0.943216026f, 0.517610371f},
-std::array<float,2>{0.0382073671f, 0.881597221f},
-std::array<float,2>{0.811051011f, 0.316688478f},
-std::array<float,2>{0.365404338f, 0.141156331f},
-std::array<float,2>{0.5033288f, 0.609907627f},
-std::array<float,2>{0.383364975f, 0.680611372f},
-std::array<float,2>{0.674149871f, 0.0949114189f},
-std::array<float,2>{0.223790482f, 0.415293574f},
-std::array<float,2>{0.910849631f, 0.863312244f},
-std::array<float,2>{0.173373267f, 0.558438659f},
-std::array<float,2>{0.98969394f, 0.225907847f},
-std::array<float,2>{0.441833824f, 0.294135243f},
-std::array<float,2>{0.698475957f, 0.966888607f},
-std::array<float,2>{0.297098637f, 0.768569589f},
-std::array<float,2>{0.592452347f, 0.484593272f},
-std::array<float,2>{0.0778232068f, 0.0572759621f},
-std::array<float,2>{0.820269644f, 0.722450435f},
-std::array<float,2>{0.132820651f, 0.946110845f},
-std::array<float,2>{0.966088891f, 0.311492711f},
-std::array<float,2>{0.469428152f, 0.243400618f},
-std::array<float,2>{0.727820992f, 0.53863281f},
-std::array<float,2>{0.258482218f, 0.740576327f},
-std::array<float,2>{0.618749797f, 0.0345345102f},
-std::array<float,2>{0.0988549665f, 0.480906725f},
-std::array<float,2>{0.860934615f, 0.764040709f},
-std::array<float,2>{0.023695644f, 0.602535784f},
-std::array<float,2>{0.76248014f, 0.126750857f},
-std::array<float,2>{0.32827419f, 0.34072572f},
-std::array<float,2>{0.560460746f, 0.894725263f},
-std::array<float,2>{0.411059201f, 0.845879316f},
-std::array<float,2>{0.646963298f, 0.428375542f},
-std::array<float,2>{0.209696949f, 0.117394879f},
-std::array<float,2>{0.894637764f, 0.663002849f},
-std::array<float,2>{0.0906210467f, 0.789230585f},
-std::array<float,2>{0.834040761f, 0.460962623f},
-std::array<float,2>{0.282233387f, 0.012625332f},
-std::array<float,2>{0.566918015f, 0.704079986f},
-std::array<float,2>{0.453184903f, 0.507650614f},
-std::array<float,2>{0.703879833f, 0.218270361f},
-std::array<float,2>{0.156437844f, 0.27360025f},
-std::array<float,2>{0.976863444f, 0.99844116f},
-std::array<float,2>{0.244811475f, 0.645059288f},
-std::array<float,2>{0.922867596f, 0.0671371445f},
-std::array<float,2>{0.394352347f, 0.390465021f},
-std::array<float,2>{0.65708673f, 0.823381901f},
-std::array<float,2>{0.349582881f, 0.935057104f},
-std::array<float,2>{0.526218832f, 0.362778008f},
-std::array<float,2>{0.0492217205f, 0.184617549f},
-std::array<float,2>{0.793338001f, 0.590605617f},
-std::array<float,2>{0.211466864f, 0.772728562f},
-std::array<float,2>{0.905258656f, 0.489352614f},
-std::array<float,2>{0.41796574f, 0.0615026914f},
-std::array<float,2>{0.655935168f, 0.724091589f},
-std::array<float,2>{0.341829032f, 0.558945119f},
-std::array<float,2>{0.548224747f, 0.219788775f},
-std::array<float,2>{0.0211918782f, 0.292386621f},
-std::array<float,2>{0.75293833f, 0.964719415f},
-std::array<float,2>{0.109219193f, 0.686456501f},
-std::array<float,2>{0.874105453f, 0.098945342f},
-std::array<float,2>{0.256841928f, 0.418683946f},
-std::array<float,2>{0.609545708f, 0.863007903f},
-std::array<float,2>{0.484199584f, 0.875185907f},
-std::array<float,2>{0.721595287f, 0.316005707f},
-std::array<float,2>{0.127404362f, 0.145225897f},
-std::array<float,2>{0.954763114f, 0.61600554f},
-std::array<float,2>{0.0618358739f, 0.970248818f},
-std::array<float,2>{0.788322389f, 0.251689225f},
-std::array<float,2>{0.356466353f, 0.19901216f},
-std::array<float,2>{0.519016266f, 0.522034228f},
-std::array<float,2>{0.405290812f, 0.699938297f},
-std::array<float,2>{0.669505596f, 0.027185427f},
-std::array<float,2>{0.23918806f, 0.445991665f},
-std::array<float,2>{0.93342793f, 0.81143564f},
-std::array<float,2>{0.167699769f, 0.566467941f},
-std::array<float,2>{0.975548804f, 0.168923557f},
-std::array<float,2>{0.462753654f, 0.357492268f},
-std::array<float,2>{0.718746722f, 0.91416657f},
-std::array<float,2>{0.29137814f, 0.8333143f},
-std::array<float,2>{0.575730264f, 0.405629605f},
-std::array<float,2>{0.08198452f, 0.0848938599f},
-std::array<float,2>{0.843150675f, 0.630272269f},
-std::array<float,2>{0.151530892f, 0.932957113f},
-std::array<float,2>{0.948388278f, 0.365501314f},
-std::array<float,2>{0.495464951f, 0.181577146f},
-std::array<float,2>{0.740323186f, 0.589782953f},
-std::array<float,2>{0.267290324f, 0.644490302f},
-std::array<float,2>{0.605716348f, 0.0627727136f},
-std::array<float,2>{0.122736074f, 0.383762956f},
-std::array<float,2>{0.851707816f, 0.826232851f},
-std::array<float,2>{0.00823877007f, 0.503691316f},
-std::array<float,2>{0.771194875f, 0.213030487f},
-std::array<float,2>{0.31365788f, 0.27835831f},
-std::array<float,2>{0.540261626f, 0.994343877f},
-std::array<float,2>{0.427160501f, 0.796471357f},
-std::array<float,2>{0.637922108f, 0.468377829f},
-std::array<float,2>{0.195197254f, 0.0109302672f},
-std::array<float,2>{0.890137553f, 0.707086682f},
-std::array<float,2>{0.0701698288f, 0.851014912f},
-std::array<float,2>{0.821829617f, 0.423273087f},
-std::array<float,2>{0.307997018f, 0.121857241f},
-std::array<float,2>{0.585465133f, 0.659884691f},
-std::array<float,2>{0.450420946f, 0.60567522f},
-std::array<float,2>{0.68938148f, 0.129091173f},
-std::array<float,2>{0.182296261f, 0.339833587f},
-std::array<float,2>{0.997557878f, 0.892029643f},
-std::array<float,2>{0.229640335f, 0.737559259f},
-std::array<float,2>{0.920480669f, 0.0354132019f},
-std::array<float,2>{0.378059238f, 0.477804333f},
-std::array<float,2>{0.683489919f, 0.761459827f},
-std::array<float,2>{0.374350429f, 0.949733377f},
-std::array<float,2>{0.51544112f, 0.305993199f},
-std::array<float,2>{0.040195588f, 0.248998567f},
-std::array<float,2>{0.80033958f, 0.531849265f},
-std::array<float,2>{0.176569209f, 0.81523782f},
-std::array<float,2>{0.985838592f, 0.377913713f},
-std::array<float,2>{0.440619439f, 0.0772066265f},
-std::array<float,2>{0.699667633f, 0.655226886f},
-std::array<float,2>{0.302997708f, 0.584937572f},
-std::array<float,2>{0.587458193f, 0.174409449f},
-std::array<float,2>{0.0713999122f, 0.369430512f},
-std::array<float,2>{0.813504994f, 0.925884724f},
-std::array<float,2>{0.0349682942f, 0.714733899f},
-std::array<float,2>{0.805859506f, 0.00224312348f},
-std::array<float,2>{0.363243312f, 0.456467092f},
-std::array<float,2>{0.505550027f, 0.784709513f},
-std::array<float,2>{0.387561917f, 0.987935662f},
-std::array<float,2>{0.67632091f, 0.267270654f},
-std::array<float,2>{0.219124779f, 0.20335497f},
-std::array<float,2>{0.909228027f, 0.512616992f},
-std::array<float,2>{0.114120826f, 0.90475297f},
-std::array<float,2>{0.850161731f, 0.329934597f},
-std::array<float,2>{0.276508659f, 0.138677493f},
-std::array<float,2>{0.598319232f, 0.595380425f},
-std::array<float,2>{0.489974648f, 0.666274607f},
-std::array<float,2>{0.742915988f, 0.109680228f},
-std::array<float,2>{0.146293536f, 0.431867182f},
-std::array<float,2>{0.93963021f, 0.859234691f},
-std::array<float,2>{0.199028462f, 0.546117961f},
-std::array<float,2>{0.88122201f, 0.238429859f},
-std::array<float,2>{0.434889674f, 0.298716068f},
-std::array<float,2>{0.626067519f, 0.944477081f},
-std::array<float,2>{0.32067135f, 0.757735133f},
-std::array<float,2>{0.538875163f, 0.473602891f},
-std::array<float,2>{0.00633597886f, 0.0434567332f},
-std::array<float,2>{0.778102875f, 0.742522001f},
-std::array<float,2>{0.246857867f, 0.956202149f},
-std::array<float,2>{0.927817345f, 0.28813079f},
-std::array<float,2>{0.398365319f, 0.229002208f},
-std::array<float,2>{0.662038743f, 0.547961533f},
-std::array<float,2>{0.34531936f, 0.732149422f},
-std::array<float,2>{0.527572095f, 0.0513515025f},
-std::array<float,2>{0.0527788326f, 0.497758031f},
-std::array<float,2>{0.791486323f, 0.780670643f},
-std::array<float,2>{0.0863562897f, 0.618998766f},
-std::array<float,2>{0.829279661f, 0.152750939f},
-std::array<float,2>{0.287680775f, 0.324957341f},
-std::array<float,2>{0.564840317f, 0.886600256f},
-std::array<float,2>{0.45738095f, 0.873138964f},
-std::array<float,2>{0.707698107f, 0.413353473f},
-std::array<float,2>{0.163412884f, 0.107760072f},
-std::array<float,2>{0.982851803f, 0.673541486f},
-std::array<float,2>{0.0285746586f, 0.800063193f},
-std::array<float,2>{0.76039201f, 0.443786114f},
-std::array<float,2>{0.335463822f, 0.0206380393f},
-std::array<float,2>{0.556488395f, 0.687723577f},
-std::array<float,2>{0.406594723f, 0.526275039f},
-std::array<float,2>{0.644129515f, 0.19422704f},
-std::array<float,2>{0.203341067f, 0.259828836f},
-std::array<float,2>{0.892026663f, 0.979752481f},
-std::array<float,2>{0.139460668f, 0.634164274f},
-std::array<float,2>{0.962619543f, 0.0861406103f},
-std::array<float,2>{0.476132661f, 0.395813733f},
-std::array<float,2>{0.730914831f, 0.839049399f},
-std::array<float,2>{0.264798254f, 0.912446141f},
-std::array<float,2>{0.623862982f, 0.350512773f},
-std::array<float,2>{0.0953070149f, 0.156411529f},
-std::array<float,2>{0.866200328f, 0.572267056f},
-std::array<float,2>{0.130336046f, 0.787503898f},
-std::array<float,2>{0.95943898f, 0.460858256f},
-std::array<float,2>{0.479145378f, 0.007487786f},
-std::array<float,2>{0.722816706f, 0.716914058f},
-std::array<float,2>{0.251077771f, 0.510277033f},
-std::array<float,2>{0.613559544f, 0.207580626f},
-std::array<float,2>{0.103300817f, 0.270536691f},
-std::array<float,2>{0.868800521f, 0.989923537f},
-std::array<float,2>{0.0188573562f, 0.648864985f},
-std::array<float,2>{0.755384088f, 0.071871832f},
-std::array<float,2>{0.337712884f, 0.380218416f},
-std::array<float,2>{0.551927209f, 0.820254743f},
-std::array<float,2>{0.419016033f, 0.923066378f},
-std::array<float,2>{0.651402116f, 0.374606878f},
-std::array<float,2>{0.218603671f, 0.178793848f},
-std::array<float,2>{0.900688112f, 0.579151213f},
-std::array<float,2>{0.0835833773f, 0.938608825f},
-std::array<float,2>{0.83905381f, 0.30224967f},
-std::array<float,2>{0.294256657f, 0.237942025f},
-std::array<float,2>{0.570612788f, 0.541602969f},
-std::array<float,2>{0.465610355f, 0.748419344f},
-std::array<float,2>{0.713173211f, 0.0394549258f},
-std::array<float,2>{0.17047438f, 0.472537726f},
-std::array<float,2>{0.968806744f, 0.750677049f},
-std::array<float,2>{0.237368956f, 0.597798645f},
-std::array<float,2>{0.934085429f, 0.134650588f},
-std::array<float,2>{0.401470244f, 0.335825711f},
-std::array<float,2>{0.667439222f, 0.899129033f},
-std::array<float,2>{0.355177999f, 0.852946639f},
-std::array<float,2>{0.520979762f, 0.43585214f},
-std::array<float,2>{0.0582925603f, 0.114964284f},
-std::array<float,2>{0.781707704f, 0.67003566f},
-std::array<float,2>{0.188696936f, 0.890376806f},
-std::array<float,2>{0.884213269f, 0.322504222f},
-std::array<float,2>{0.422738343f, 0.149960741f},
-std::array<float,2>{0.634216726f, 0.623859048f},
-std::array<float,2>{0.317608714f, 0.676915228f},
-std::array<float,2>{0.546080053f, 0.103700951f},
-std::array<float,2>{0.0123244477f, 0.409668088f},
-std::array<float,2>{0.767697752f, 0.867342234f},
-std::array<float,2>{0.120900869f, 0.553528488f},
-std::array<float,2>{0.858572364f, 0.232510164f},
-std::array<float,2>{0.271953851f, 0.282316387f},
-std::array<float,2>{0.601997972f, 0.960759938f},
-std::array<float,2>{0.497470975f, 0.77458179f},
-std::array<float,2>{0.736754537f, 0.492318541f},
-std::array<float,2>{0.156177893f, 0.0501169637f},
-std::array<float,2>{0.952486873f, 0.729779959f},
-std::array<float,2>{0.0460309125f, 0.840634584f},
-std::array<float,2>{0.802384973f, 0.391270041f},
-std::array<float,2>{0.370354712f, 0.0932622403f},
-std::array<float,2>{0.510899901f, 0.637658536f},
-std::array<float,2>{0.382543474f, 0.575179517f},
-std::array<float,2>{0.686444879f, 0.161146164f},
-std::array<float,2>{0.233164355f, 0.346677005f},
-std::array<float,2>{0.917602599f, 0.908458471f},
-std::array<float,2>{0.185734197f, 0.692793608f},
-std::array<float,2>{0.995799363f, 0.0178076141f},
-std::array<float,2>{0.447990835f, 0.440817147f},
-std::array<float,2>{0.692781627f, 0.804085135f},
-std::array<float,2>{0.311248004f, 0.983248532f},
-std::array<float,2>{0.581117153f, 0.264187574f},
-std::array<float,2>{0.0659196153f, 0.189938262f},
-std::array<float,2>{0.82567668f, 0.529447436f},
-std::array<float,2>{0.224816218f, 0.866901398f},
-std::array<float,2>{0.912604809f, 0.417095572f},
-std::array<float,2>{0.386030227f, 0.0972590074f},
-std::array<float,2>{0.673340023f, 0.682242215f},
-std::array<float,2>{0.363325387f, 0.612704337f},
-std::array<float,2>{0.500228286f, 0.144032404f},
-std::array<float,2>{0.0359098092f, 0.319183558f},
-std::array<float,2>{0.809287488f, 0.880652487f},
-std::array<float,2>{0.0746157616f, 0.718900859f},
-std::array<float,2>{0.81683749f, 0.0558771528f},
-std::array<float,2>{0.299020857f, 0.487733632f},
-std::array<float,2>{0.591326416f, 0.766181827f},
-std::array<float,2>{0.445161819f, 0.9658885f},
-std::array<float,2>{0.69556731f, 0.296341598f},
-std::array<float,2>{0.175740659f, 0.223884568f},
-std::array<float,2>{0.991645277f, 0.556629121f},
-std::array<float,2>{0.00123933249f, 0.918489516f},
-std::array<float,2>{0.773777783f, 0.352316231f},
-std::array<float,2>{0.3269701f, 0.16616872f},
-std::array<float,2>{0.534724772f, 0.56482935f},
-std::array<float,2>{0.43225646f, 0.627796292f},
-std::array<float,2>{0.62926501f, 0.0807569921f},
-std::array<float,2>{0.201379135f, 0.398759514f},
-std::array<float,2>{0.876635432f, 0.82870388f},
-std::array<float,2>{0.143183291f, 0.517057121f},
-std::array<float,2>{0.944436908f, 0.203079656f},
-std::array<float,2>{0.487696052f, 0.256095588f},
-std::array<float,2>{0.746556342f, 0.972745478f},
-std::array<float,2>{0.278112918f, 0.805888355f},
-std::array<float,2>{0.595137715f, 0.451213092f},
-std::array<float,2>{0.110866055f, 0.0273751654f},
-std::array<float,2>{0.847077131f, 0.697508752f},
-std::array<float,2>{0.159261718f, 0.997467995f},
-std::array<float,2>{0.980134487f, 0.277023166f},
-std::array<float,2>{0.45591256f, 0.215436354f},
-std::array<float,2>{0.705891609f, 0.505144298f},
-std::array<float,2>{0.284711033f, 0.705736876f},
-std::array<float,2>{0.568779886f, 0.0144285252f},
-std::array<float,2>{0.0927935094f, 0.464074403f},
-std::array<float,2>{0.832830012f, 0.792045474f},
-std::array<float,2>{0.0475424491f, 0.593249083f},
-std::array<float,2>{0.795222998f, 0.186104238f},
-std::array<float,2>{0.350618631f, 0.359484941f},
-std::array<float,2>{0.524369955f, 0.937100053f},
-std::array<float,2>{0.39093861f, 0.82032752f},
-std::array<float,2>{0.658430755f, 0.388031334f},
-std::array<float,2>{0.243331149f, 0.0694004297f},
-std::array<float,2>{0.925266325f, 0.64795053f},
-std::array<float,2>{0.100839287f, 0.762892723f},
-std::array<float,2>{0.862466991f, 0.483488083f},
-std::array<float,2>{0.261632234f, 0.0319928043f},
-std::array<float,2>{0.619822085f, 0.738822401f},
-std::array<float,2>{0.471511245f, 0.536851168f},
-std::array<float,2>{0.728639185f, 0.244978517f},
-std::array<float,2>{0.135227129f, 0.309699476f},
-std::array<float,2>{0.968728244f, 0.947400331f},
-std::array<float,2>{0.207773983f, 0.661109865f},
-std::array<float,2>{0.897573233f, 0.120811813f},
-std::array<float,2>{0.41303134f, 0.427310944f},
-std::array<float,2>{0.644923151f, 0.844896197f},
-std::array<float,2>{0.33089149f, 0.898173988f},
-std::array<float,2>{0.561120033f, 0.34341836f},
-std::array<float,2>{0.0258881506f, 0.127818406f},
-std::array<float,2>{0.764968216f, 0.603860497f},
-std::array<float,2>{0.218424916f, 0.785360754f},
-std::array<float,2>{0.900399446f, 0.458355665f},
-std::array<float,2>{0.419314981f, 0.00568833062f},
-std::array<float,2>{0.651842117f, 0.716752887f},
-std::array<float,2>{0.337514848f, 0.508131027f},
-std::array<float,2>{0.552112162f, 0.209003583f},
-std::array<float,2>{0.0186849777f, 0.272294074f},
-std::array<float,2>{0.755812049f, 0.991322756f},
-std::array<float,2>{0.103122339f, 0.651600361f},
-std::array<float,2>{0.869053364f, 0.072266914f},
-std::array<float,2>{0.251337707f, 0.381560147f},
-std::array<float,2>{0.613504827f, 0.817827821f},
-std::array<float,2>{0.479324371f, 0.924804509f},
-std::array<float,2>{0.723086059f, 0.37277469f},
-std::array<float,2>{0.130109712f, 0.176682666f},
-std::array<float,2>{0.958986402f, 0.581563175f},
-std::array<float,2>{0.0583917238f, 0.939978957f},
-std::array<float,2>{0.781431854f, 0.303261489f},
-std::array<float,2>{0.355455458f, 0.234440491f},
-std::array<float,2>{0.520695686f, 0.539695799f},
-std::array<float,2>{0.401758552f, 0.747591257f},
-std::array<float,2>{0.66704005f, 0.0426057912f},
-std::array<float,2>{0.23774147f, 0.46961242f},
-std::array<float,2>{0.934530854f, 0.753537655f},
-std::array<float,2>{0.170804992f, 0.60050559f},
-std::array<float,2>{0.969056368f, 0.135493025f},
-std::array<float,2>{0.465443879f, 0.332647324f},
-std::array<float,2>{0.713101506f, 0.901103854f},
-std::array<float,2>{0.294125021f, 0.854957402f},
-std::array<float,2>{0.570439517f, 0.434885323f},
-std::array<float,2>{0.0839557797f, 0.1170903f},
-std::array<float,2>{0.839148641f, 0.669045389f},
-std::array<float,2>{0.155871034f, 0.887690246f},
-std::array<float,2>{0.952391207f, 0.320739657f},
-std::array<float,2>{0.497166753f, 0.151554897f},
-std::array<float,2>{0.736416698f, 0.621473372f},
-std::array<float,2>{0.271712959f, 0.678005338f},
-std::array<float,2>{0.601796448f, 0.103264369f},
-std::array<float,2>{0.12071678f, 0.406732947f},
-std::array<float,2>{0.858682334f, 0.869254887f},
-std::array<float,2>{0.012541132f, 0.551147759f},
-std::array<float,2>{0.767938197f, 0.231301248f},
-std::array<float,2>{0.317807078f, 0.283591002f},
-std::array<float,2>{0.546171367f, 0.958680451f},
-std::array<float,2>{0.422469318f, 0.776263118f},
-std::array<float,2>{0.633911133f, 0.494365692f},
-std::array<float,2>{0.188895628f, 0.0469235405f},
-std::array<float,2>{0.883930862f, 0.727785826f},
-std::array<float,2>{0.0662493855f, 0.843240321f},
-std::array<float,2>{0.8253842f, 0.39425385f},
-std::array<float,2>{0.311457485f, 0.0917331874f},
-std::array<float,2>{0.581449687f, 0.639851153f},
-std::array<float,2>{0.448053539f, 0.577078104f},
-std::array<float,2>{0.692619324f, 0.162770286f},
-std::array<float,2>{0.185831562f, 0.343957007f},
-std::array<float,2>{0.996040046f, 0.906294048f},
-std::array<float,2>{0.233013779f, 0.695191741f},
-std::array<float,2>{0.917730927f, 0.017067235f},
-std::array<float,2>{0.382661641f, 0.438042194f},
-std::array<float,2>{0.686203897f, 0.802269816f},
-std::array<float,2>{0.370587587f, 0.980970621f},
-std::array<float,2>{0.511085689f, 0.263567328f},
-std::array<float,2>{0.0462989546f, 0.18891719f},
-std::array<float,2>{0.802695215f, 0.52914685f},
-std::array<float,2>{0.1753387f, 0.864549696f},
-std::array<float,2>{0.991333544f, 0.414850026f},
-std::array<float,2>{0.444873601f, 0.0945707038f},
-std::array<float,2>{0.695351779f, 0.680685341f},
-std::array<float,2>{0.2991032f, 0.610693514f},
-std::array<float,2>{0.591581643f, 0.142393842f},
-std::array<float,2>{0.0744163767f, 0.317550629f},
-std::array<float,2>{0.816478252f, 0.88245064f},
-std::array<float,2>{0.0357850194f, 0.721520901f},
-std::array<float,2>{0.809494078f, 0.0577313192f},
-std::array<float,2>{0.363550812f, 0.485721052f},
-std::array<float,2>{0.500363827f, 0.768531203f},
-std::array<float,2>{0.385824233f, 0.968429744f},
-std::array<float,2>{0.673588336f, 0.293836802f},
-std::array<float,2>{0.224990472f, 0.225479141f},
-std::array<float,2>{0.912842274f, 0.556917727f},
-std::array<float,2>{0.111190759f, 0.920133948f},
-std::array<float,2>{0.846820354f, 0.353751391f},
-std::array<float,2>{0.277835518f, 0.165220678f},
-std::array<float,2>{0.594917476f, 0.562817335f},
-std::array<float,2>{0.487324178f, 0.626747966f},
-std::array<float,2>{0.746326804f, 0.0786756352f},
-std::array<float,2>{0.143455163f, 0.401748925f},
-std::array<float,2>{0.944711983f, 0.831862748f},
-std::array<float,2>{0.201433748f, 0.518574834f},
-std::array<float,2>{0.876721978f, 0.199390471f},
-std::array<float,2>{0.432380468f, 0.255311728f},
-std::array<float,2>{0.629146457f, 0.974654019f},
-std::array<float,2>{0.32689622f, 0.808035851f},
-std::array<float,2>{0.535093904f, 0.450597137f},
-std::array<float,2>{0.0011689458f, 0.0302061159f},
-std::array<float,2>{0.773661613f, 0.696288407f},
-std::array<float,2>{0.243506089f, 0.999672771f},
-std::array<float,2>{0.924963415f, 0.275283009f},
-std::array<float,2>{0.390815675f, 0.217751354f},
-std::array<float,2>{0.658470035f, 0.50631547f},
-std::array<float,2>{0.35088262f, 0.704389215f},
-std::array<float,2>{0.524084151f, 0.0127369836f},
-std::array<float,2>{0.047789555f, 0.462254405f},
-std::array<float,2>{0.795051038f, 0.790054739f},
-std::array<float,2>{0.0931023955f, 0.591591179f},
-std::array<float,2>{0.832744956f, 0.184361562f},
-std::array<float,2>{0.284992039f, 0.361612171f},
-std::array<float,2>{0.568572044f, 0.934033215f},
-std::array<float,2>{0.455570728f, 0.822967887f},
-std::array<float,2>{0.705575287f, 0.389233261f},
-std::array<float,2>{0.159656256f, 0.0679875538f},
-std::array<float,2>{0.980239332f, 0.64599365f},
-std::array<float,2>{0.0261865668f, 0.764962733f},
-std::array<float,2>{0.764720142f, 0.482234448f},
-std::array<float,2>{0.330797464f, 0.0332213156f},
-std::array<float,2>{0.561394572f, 0.74187988f},
-std::array<float,2>{0.412770241f, 0.537396908f},
-std::array<float,2>{0.644721746f, 0.242193222f},
-std::array<float,2>{0.207653552f, 0.312404305f},
-std::array<float,2>{0.897901237f, 0.946399152f},
-std::array<float,2>{0.134924501f, 0.663862765f},
-std::array<float,2>{0.968503058f, 0.119012795f},
-std::array<float,2>{0.471405804f, 0.428747863f},
-std::array<float,2>{0.728815496f, 0.847608387f},
-std::array<float,2>{0.261270881f, 0.896432042f},
-std::array<float,2>{0.619998336f, 0.340888619f},
-std::array<float,2>{0.100798704f, 0.125812545f},
-std::array<float,2>{0.862770796f, 0.603427351f},
-std::array<float,2>{0.127163917f, 0.770906329f},
-std::array<float,2>{0.954996526f, 0.490427673f},
-std::array<float,2>{0.483968645f, 0.0589164235f},
-std::array<float,2>{0.721328318f, 0.72486335f},
-std::array<float,2>{0.257308304f, 0.560632527f},
-std::array<float,2>{0.609841228f, 0.220917165f},
-std::array<float,2>{0.109127238f, 0.290820718f},
-std::array<float,2>{0.874309778f, 0.961029649f},
-std::array<float,2>{0.0214543957f, 0.683760822f},
-std::array<float,2>{0.753208518f, 0.100589707f},
-std::array<float,2>{0.342085838f, 0.421160638f},
-std::array<float,2>{0.548039734f, 0.859426796f},
-std::array<float,2>{0.417484224f, 0.878079772f},
-std::array<float,2>{0.656217456f, 0.31356737f},
-std::array<float,2>{0.211757064f, 0.147102669f},
-std::array<float,2>{0.904993474f, 0.615046799f},
-std::array<float,2>{0.0817446262f, 0.971426129f},
-std::array<float,2>{0.842965007f, 0.252813935f},
-std::array<float,2>{0.291191876f, 0.19621785f},
-std::array<float,2>{0.576062024f, 0.521424413f},
-std::array<float,2>{0.462555259f, 0.703070462f},
-std::array<float,2>{0.718325436f, 0.0241183266f},
-std::array<float,2>{0.167784661f, 0.44860509f},
-std::array<float,2>{0.975101769f, 0.809151351f},
-std::array<float,2>{0.238888964f, 0.570154548f},
-std::array<float,2>{0.933226883f, 0.171523616f},
-std::array<float,2>{0.405553609f, 0.356122077f},
-std::array<float,2>{0.669889271f, 0.917841434f},
-std::array<float,2>{0.356734067f, 0.834526658f},
-std::array<float,2>{0.518795311f, 0.402753949f},
-std::array<float,2>{0.0617056303f, 0.0830152929f},
-std::array<float,2>{0.788386285f, 0.631423771f},
-std::array<float,2>{0.195059225f, 0.931332052f},
-std::array<float,2>{0.890551984f, 0.364962459f},
-std::array<float,2>{0.426792085f, 0.183151662f},
-std::array<float,2>{0.638159335f, 0.586313963f},
-std::array<float,2>{0.313808262f, 0.640775919f},
-std::array<float,2>{0.54030019f, 0.0654048175f},
-std::array<float,2>{0.00791673642f, 0.386358798f},
-std::array<float,2>{0.771357f, 0.824736953f},
-std::array<float,2>{0.123000562f, 0.500353396f},
-std::array<float,2>{0.851901114f, 0.212393746f},
-std::array<float,2>{0.267361164f, 0.279937297f},
-std::array<float,2>{0.605529308f, 0.992955863f},
-std::array<float,2>{0.495230079f, 0.793431699f},
-std::array<float,2>{0.740711868f, 0.466410041f},
-std::array<float,2>{0.151818454f, 0.0093714539f},
-std::array<float,2>{0.948718905f, 0.709423602f},
-std::array<float,2>{0.0404296815f, 0.848806739f},
-std::array<float,2>{0.800597668f, 0.424492985f},
-std::array<float,2>{0.37417084f, 0.124259397f},
-std::array<float,2>{0.515361845f, 0.657484531f},
-std::array<float,2>{0.378179222f, 0.607998729f},
-std::array<float,2>{0.683269858f, 0.132305637f},
-std::array<float,2>{0.229947209f, 0.336880863f},
-std::array<float,2>{0.920730233f, 0.892986298f},
-std::array<float,2>{0.18248567f, 0.735585034f},
-std::array<float,2>{0.99715662f, 0.0372946002f},
-std::array<float,2>{0.450523555f, 0.479469568f},
-std::array<float,2>{0.689107656f, 0.758178353f},
-std::array<float,2>{0.30781284f, 0.952701926f},
-std::array<float,2>{0.585918427f, 0.307598799f},
-std::array<float,2>{0.0700029135f, 0.247498631f},
-std::array<float,2>{0.822149396f, 0.534395635f},
-std::array<float,2>{0.218757987f, 0.81440562f},
-std::array<float,2>{0.909662247f, 0.375852615f},
-std::array<float,2>{0.38727209f, 0.0757289305f},
-std::array<float,2>{0.676533401f, 0.653000057f},
-std::array<float,2>{0.36301288f, 0.58351016f},
-std::array<float,2>{0.505786896f, 0.1735847f},
-std::array<float,2>{0.0348790698f, 0.368338585f},
-std::array<float,2>{0.806131303f, 0.928182602f},
-std::array<float,2>{0.0715731829f, 0.712112844f},
-std::array<float,2>{0.813780129f, 0.000303678709f},
-std::array<float,2>{0.302969277f, 0.454122514f},
-std::array<float,2>{0.587656856f, 0.781874716f},
-std::array<float,2>{0.440862298f, 0.986167431f},
-std::array<float,2>{0.699368894f, 0.269176185f},
-std::array<float,2>{0.176367432f, 0.205160722f},
-std::array<float,2>{0.985478044f, 0.513792872f},
-std::array<float,2>{0.00600676239f, 0.904064953f},
-std::array<float,2>{0.778038561f, 0.331386864f},
-std::array<float,2>{0.320394129f, 0.137316197f},
-std::array<float,2>{0.538674593f, 0.596786916f},
-std::array<float,2>{0.434664577f, 0.665186107f},
-std::array<float,2>{0.626325071f, 0.112319425f},
-std::array<float,2>{0.198883325f, 0.430381119f},
-std::array<float,2>{0.880990326f, 0.857130408f},
-std::array<float,2>{0.14605552f, 0.54408437f},
-std::array<float,2>{0.939754426f, 0.242046684f},
-std::array<float,2>{0.490092397f, 0.300562054f},
-std::array<float,2>{0.742961943f, 0.942871153f},
-std::array<float,2>{0.276622683f, 0.75462842f},
-std::array<float,2>{0.598442733f, 0.475751102f},
-std::array<float,2>{0.113852262f, 0.0462597683f},
-std::array<float,2>{0.850454926f, 0.745068252f},
-std::array<float,2>{0.163233876f, 0.954688072f},
-std::array<float,2>{0.982487977f, 0.285716176f},
-std::array<float,2>{0.45704779f, 0.228225082f},
-std::array<float,2>{0.707780242f, 0.550369561f},
-std::array<float,2>{0.287992001f, 0.732874334f},
-std::array<float,2>{0.564480901f, 0.0541036613f},
-std::array<float,2>{0.0860743523f, 0.499214143f},
-std::array<float,2>{0.829373956f, 0.778755844f},
-std::array<float,2>{0.0532110333f, 0.619442284f},
-std::array<float,2>{0.791150093f, 0.155264899f},
-std::array<float,2>{0.345700204f, 0.326752067f},
-std::array<float,2>{0.527745605f, 0.883982301f},
-std::array<float,2>{0.397968978f, 0.871408463f},
-std::array<float,2>{0.66168201f, 0.41203776f},
-std::array<float,2>{0.246591762f, 0.106532075f},
-std::array<float,2>{0.927978814f, 0.674982488f},
-std::array<float,2>{0.0956040025f, 0.798246562f},
-std::array<float,2>{0.865786672f, 0.442862034f},
-std::array<float,2>{0.265062749f, 0.0221287161f},
-std::array<float,2>{0.623688877f, 0.690815032f},
-std::array<float,2>{0.476418793f, 0.525331318f},
-std::array<float,2>{0.730581999f, 0.19284223f},
-std::array<float,2>{0.139388546f, 0.258822203f},
-std::array<float,2>{0.962797463f, 0.977784336f},
-std::array<float,2>{0.203480452f, 0.63640213f},
-std::array<float,2>{0.891755998f, 0.0880759358f},
-std::array<float,2>{0.406289548f, 0.396889836f},
-std::array<float,2>{0.644413948f, 0.837596476f},
-std::array<float,2>{0.335722744f, 0.911130369f},
-std::array<float,2>{0.55627358f, 0.348420143f},
-std::array<float,2>{0.0285030007f, 0.158680975f},
-std::array<float,2>{0.760524154f, 0.571078658f},
-std::array<float,2>{0.234908327f, 0.751120329f},
-std::array<float,2>{0.935552657f, 0.471454322f},
-std::array<float,2>{0.400108308f, 0.0408109836f},
-std::array<float,2>{0.665114105f, 0.749224246f},
-std::array<float,2>{0.353271127f, 0.542706013f},
-std::array<float,2>{0.522396028f, 0.237282902f},
-std::array<float,2>{0.0555886775f, 0.301423103f},
-std::array<float,2>{0.784856319f, 0.937972963f},
-std::array<float,2>{0.084592618f, 0.670914054f},
-std::array<float,2>{0.836322904f, 0.113938682f},
-std::array<float,2>{0.296009779f, 0.436962873f},
-std::array<float,2>{0.573930085f, 0.851805091f},
-std::array<float,2>{0.468431562f, 0.900262475f},
-std::array<float,2>{0.711034417f, 0.334435165f},
-std::array<float,2>{0.169568315f, 0.132909968f},
-std::array<float,2>{0.97208035f, 0.598944962f},
-std::array<float,2>{0.0169178266f, 0.98875159f},
-std::array<float,2>{0.757302999f, 0.270052582f},
-std::array<float,2>{0.33964175f, 0.208235338f},
-std::array<float,2>{0.553664207f, 0.511409402f},
-std::array<float,2>{0.420762867f, 0.718025625f},
-std::array<float,2>{0.649746299f, 0.00591156492f},
-std::array<float,2>{0.215666696f, 0.459690481f},
-std::array<float,2>{0.898947895f, 0.788757384f},
-std::array<float,2>{0.132531762f, 0.578700662f},
-std::array<float,2>{0.957158864f, 0.178386495f},
-std::array<float,2>{0.477048159f, 0.37371698f},
-std::array<float,2>{0.725120306f, 0.922210991f},
-std::array<float,2>{0.252829075f, 0.819188476f},
-std::array<float,2>{0.61578989f, 0.379530519f},
-std::array<float,2>{0.103609674f, 0.07054203f},
-std::array<float,2>{0.871021986f, 0.650195897f},
-std::array<float,2>{0.184257179f, 0.909497559f},
-std::array<float,2>{0.992805243f, 0.347114682f},
-std::array<float,2>{0.44606638f, 0.160718784f},
-std::array<float,2>{0.694600403f, 0.576070905f},
-std::array<float,2>{0.308603436f, 0.638453245f},
-std::array<float,2>{0.579061508f, 0.0922232345f},
-std::array<float,2>{0.063771382f, 0.392373145f},
-std::array<float,2>{0.827340066f, 0.841231525f},
-std::array<float,2>{0.0444573723f, 0.53114152f},
-std::array<float,2>{0.804672003f, 0.190474555f},
-std::array<float,2>{0.368406951f, 0.264696449f},
-std::array<float,2>{0.508706927f, 0.984292805f},
-std::array<float,2>{0.38025254f, 0.802936912f},
-std::array<float,2>{0.685115874f, 0.439713776f},
-std::array<float,2>{0.230759695f, 0.0188919231f},
-std::array<float,2>{0.914189398f, 0.691901863f},
-std::array<float,2>{0.118518166f, 0.868227661f},
-std::array<float,2>{0.855889857f, 0.408231527f},
-std::array<float,2>{0.270963609f, 0.104573831f},
-std::array<float,2>{0.604572773f, 0.67605412f},
-std::array<float,2>{0.498253018f, 0.624109745f},
-std::array<float,2>{0.735352457f, 0.148769766f},
-std::array<float,2>{0.152839124f, 0.324209929f},
-std::array<float,2>{0.951067388f, 0.889108479f},
-std::array<float,2>{0.191335917f, 0.729121208f},
-std::array<float,2>{0.885868967f, 0.0493468754f},
-std::array<float,2>{0.424681604f, 0.493622839f},
-std::array<float,2>{0.635644615f, 0.774039328f},
-std::array<float,2>{0.319146425f, 0.959427476f},
-std::array<float,2>{0.543765664f, 0.281932831f},
-std::array<float,2>{0.0151000619f, 0.233862862f},
-std::array<float,2>{0.766946077f, 0.5541628f},
-std::array<float,2>{0.142003477f, 0.829143584f},
-std::array<float,2>{0.942927361f, 0.400348544f},
-std::array<float,2>{0.486084789f, 0.0811205879f},
-std::array<float,2>{0.749762654f, 0.628721118f},
-std::array<float,2>{0.280760586f, 0.565483034f},
-std::array<float,2>{0.596147835f, 0.167191565f},
-std::array<float,2>{0.111886203f, 0.352859885f},
-std::array<float,2>{0.843931854f, 0.919840932f},
-std::array<float,2>{0.00227869139f, 0.698651135f},
-std::array<float,2>{0.775857925f, 0.0287080873f},
-std::array<float,2>{0.324801058f, 0.45257777f},
-std::array<float,2>{0.531499803f, 0.804861367f},
-std::array<float,2>{0.431080371f, 0.973821342f},
-std::array<float,2>{0.631961107f, 0.256870031f},
-std::array<float,2>{0.201096997f, 0.201586679f},
-std::array<float,2>{0.878183305f, 0.515669465f},
-std::array<float,2>{0.0781089813f, 0.879740059f},
-std::array<float,2>{0.819858491f, 0.319998384f},
-std::array<float,2>{0.297267526f, 0.143238887f},
-std::array<float,2>{0.59273535f, 0.611395299f},
-std::array<float,2>{0.441558659f, 0.683542311f},
-std::array<float,2>{0.698699534f, 0.0961169824f},
-std::array<float,2>{0.173633277f, 0.416044474f},
-std::array<float,2>{0.989348292f, 0.865531266f},
-std::array<float,2>{0.224012345f, 0.555109441f},
-std::array<float,2>{0.910979331f, 0.223514155f},
-std::array<float,2>{0.383570164f, 0.2953448f},
-std::array<float,2>{0.673889399f, 0.965309083f},
-std::array<float,2>{0.365689129f, 0.766872108f},
-std::array<float,2>{0.503128946f, 0.486752868f},
-std::array<float,2>{0.0383614898f, 0.0547310002f},
-std::array<float,2>{0.811434448f, 0.720089614f},
-std::array<float,2>{0.209913f, 0.948410213f},
-std::array<float,2>{0.894890428f, 0.309389174f},
-std::array<float,2>{0.410872966f, 0.245137081f},
-std::array<float,2>{0.646642983f, 0.535399914f},
-std::array<float,2>{0.32850948f, 0.740133405f},
-std::array<float,2>{0.560077846f, 0.0323752463f},
-std::array<float,2>{0.0235259943f, 0.483058959f},
-std::array<float,2>{0.762319326f, 0.761727393f},
-std::array<float,2>{0.0990549698f, 0.604572833f},
-std::array<float,2>{0.86127913f, 0.127960786f},
-std::array<float,2>{0.258753598f, 0.341958731f},
-std::array<float,2>{0.618955135f, 0.896529019f},
-std::array<float,2>{0.469497055f, 0.844672561f},
-std::array<float,2>{0.727662802f, 0.42582041f},
-std::array<float,2>{0.13311331f, 0.119452856f},
-std::array<float,2>{0.96604085f, 0.661896706f},
-std::array<float,2>{0.0489085913f, 0.791224003f},
-std::array<float,2>{0.793096542f, 0.46357581f},
-std::array<float,2>{0.349316031f, 0.0151770329f},
-std::array<float,2>{0.525989473f, 0.707003474f},
-std::array<float,2>{0.394161433f, 0.504687905f},
-std::array<float,2>{0.656954229f, 0.21637693f},
-std::array<float,2>{0.245115519f, 0.275658399f},
-std::array<float,2>{0.923309982f, 0.996282101f},
-std::array<float,2>{0.156569347f, 0.646742582f},
-std::array<float,2>{0.976795614f, 0.0691091865f},
-std::array<float,2>{0.453599602f, 0.387359053f},
-std::array<float,2>{0.703649104f, 0.821942329f},
-std::array<float,2>{0.282511771f, 0.936255038f},
-std::array<float,2>{0.567183793f, 0.360440642f},
-std::array<float,2>{0.0904046372f, 0.187432602f},
-std::array<float,2>{0.834376872f, 0.592698097f},
-std::array<float,2>{0.164879888f, 0.812338054f},
-std::array<float,2>{0.973524749f, 0.447037846f},
-std::array<float,2>{0.464836985f, 0.0261358581f},
-std::array<float,2>{0.716546953f, 0.700433493f},
-std::array<float,2>{0.289916575f, 0.522773802f},
-std::array<float,2>{0.577536702f, 0.197723165f},
-std::array<float,2>{0.0785796344f, 0.250561029f},
-std::array<float,2>{0.840322673f, 0.968998373f},
-std::array<float,2>{0.0586336367f, 0.62963438f},
-std::array<float,2>{0.78709954f, 0.0855806544f},
-std::array<float,2>{0.358944684f, 0.405143708f},
-std::array<float,2>{0.51691699f, 0.832205415f},
-std::array<float,2>{0.40315491f, 0.915632248f},
-std::array<float,2>{0.671117902f, 0.358524293f},
-std::array<float,2>{0.240345344f, 0.169445127f},
-std::array<float,2>{0.931450903f, 0.568282187f},
-std::array<float,2>{0.105495535f, 0.9633798f},
-std::array<float,2>{0.872643769f, 0.291662008f},
-std::array<float,2>{0.254128069f, 0.218810052f},
-std::array<float,2>{0.6120013f, 0.559713364f},
-std::array<float,2>{0.480921447f, 0.723564208f},
-std::array<float,2>{0.720327199f, 0.0622769967f},
-std::array<float,2>{0.12503241f, 0.488961488f},
-std::array<float,2>{0.956307232f, 0.7718063f},
-std::array<float,2>{0.214645073f, 0.616463006f},
-std::array<float,2>{0.903440237f, 0.14617011f},
-std::array<float,2>{0.41569224f, 0.314997166f},
-std::array<float,2>{0.652966917f, 0.876482069f},
-std::array<float,2>{0.341352314f, 0.861369848f},
-std::array<float,2>{0.549163043f, 0.419903219f},
-std::array<float,2>{0.0233754721f, 0.0986253098f},
-std::array<float,2>{0.750820577f, 0.686784148f},
-std::array<float,2>{0.226695105f, 0.891404688f},
-std::array<float,2>{0.919707716f, 0.338125944f},
-std::array<float,2>{0.375301868f, 0.129940778f},
-std::array<float,2>{0.679997861f, 0.606967509f},
-std::array<float,2>{0.371324122f, 0.65912801f},
-std::array<float,2>{0.512857139f, 0.122118689f},
-std::array<float,2>{0.0422897525f, 0.422334522f},
-std::array<float,2>{0.79715395f, 0.850129843f},
-std::array<float,2>{0.067623958f, 0.532896936f},
-std::array<float,2>{0.824104071f, 0.249626696f},
-std::array<float,2>{0.305778801f, 0.304909796f},
-std::array<float,2>{0.583851457f, 0.950200975f},
-std::array<float,2>{0.452537984f, 0.760585308f},
-std::array<float,2>{0.690818369f, 0.477172434f},
-std::array<float,2>{0.180737972f, 0.0365235247f},
-std::array<float,2>{0.999772489f, 0.736875892f},
-std::array<float,2>{0.0108025894f, 0.827633262f},
-std::array<float,2>{0.771946847f, 0.384512752f},
-std::array<float,2>{0.316128492f, 0.0635120645f},
-std::array<float,2>{0.542756021f, 0.643206358f},
-std::array<float,2>{0.428341389f, 0.588223934f},
-std::array<float,2>{0.639604688f, 0.180634037f},
-std::array<float,2>{0.193203896f, 0.366462737f},
-std::array<float,2>{0.886897683f, 0.932316244f},
-std::array<float,2>{0.150111601f, 0.708384871f},
-std::array<float,2>{0.946467876f, 0.010533276f},
-std::array<float,2>{0.493943274f, 0.467771888f},
-std::array<float,2>{0.739994586f, 0.795019448f},
-std::array<float,2>{0.268477917f, 0.995237887f},
-std::array<float,2>{0.608776808f, 0.278268486f},
-std::array<float,2>{0.123174369f, 0.214140549f},
-std::array<float,2>{0.855200231f, 0.502519667f},
-std::array<float,2>{0.195358321f, 0.858115792f},
-std::array<float,2>{0.880679667f, 0.433078289f},
-std::array<float,2>{0.436496437f, 0.11123509f},
-std::array<float,2>{0.628413737f, 0.667812645f},
-std::array<float,2>{0.324048907f, 0.594608545f},
-std::array<float,2>{0.535690248f, 0.139827624f},
-std::array<float,2>{0.00451153703f, 0.328733981f},
-std::array<float,2>{0.779364407f, 0.906154513f},
-std::array<float,2>{0.116309568f, 0.743589342f},
-std::array<float,2>{0.848546565f, 0.0448674858f},
-std::array<float,2>{0.273675621f, 0.473717839f},
-std::array<float,2>{0.599917054f, 0.756722569f},
-std::array<float,2>{0.490591079f, 0.943540692f},
-std::array<float,2>{0.745720506f, 0.297095567f},
-std::array<float,2>{0.146727324f, 0.239378363f},
-std::array<float,2>{0.93818599f, 0.545778692f},
-std::array<float,2>{0.0318413228f, 0.926908255f},
-std::array<float,2>{0.807176054f, 0.370643735f},
-std::array<float,2>{0.361304164f, 0.17535916f},
-std::array<float,2>{0.507063389f, 0.585132658f},
-std::array<float,2>{0.389740825f, 0.656147063f},
-std::array<float,2>{0.67851299f, 0.076243192f},
-std::array<float,2>{0.22166343f, 0.378009409f},
-std::array<float,2>{0.906745493f, 0.816325307f},
-std::array<float,2>{0.17896089f, 0.513294935f},
-std::array<float,2>{0.987926543f, 0.204873443f},
-std::array<float,2>{0.439346313f, 0.266065896f},
-std::array<float,2>{0.702366173f, 0.986878812f},
-std::array<float,2>{0.302521825f, 0.783863008f},
-std::array<float,2>{0.588916957f, 0.455739111f},
-std::array<float,2>{0.0735706761f, 0.00365060708f},
-std::array<float,2>{0.815260649f, 0.713534057f},
-std::array<float,2>{0.137657553f, 0.979426563f},
-std::array<float,2>{0.963630199f, 0.261401534f},
-std::array<float,2>{0.472850382f, 0.19494994f},
-std::array<float,2>{0.732864678f, 0.527160645f},
-std::array<float,2>{0.261861891f, 0.688647687f},
-std::array<float,2>{0.622653246f, 0.0202703122f},
-std::array<float,2>{0.0976530537f, 0.445276916f},
-std::array<float,2>{0.863368213f, 0.799550831f},
-std::array<float,2>{0.0302517284f, 0.573728263f},
-std::array<float,2>{0.757926762f, 0.157642543f},
-std::array<float,2>{0.332077801f, 0.35105744f},
-std::array<float,2>{0.558185279f, 0.914043605f},
-std::array<float,2>{0.409549356f, 0.838223934f},
-std::array<float,2>{0.64170742f, 0.395437479f},
-std::array<float,2>{0.205369517f, 0.0873685032f},
-std::array<float,2>{0.893103242f, 0.633756578f},
-std::array<float,2>{0.0878948197f, 0.780147612f},
-std::array<float,2>{0.830458105f, 0.496850997f},
-std::array<float,2>{0.286294013f, 0.0519168936f},
-std::array<float,2>{0.56342715f, 0.730894983f},
-std::array<float,2>{0.459992319f, 0.547565818f},
-std::array<float,2>{0.710375726f, 0.230012268f},
-std::array<float,2>{0.161221027f, 0.287659615f},
-std::array<float,2>{0.981570125f, 0.95554626f},
-std::array<float,2>{0.248395368f, 0.672196567f},
-std::array<float,2>{0.926933587f, 0.108983159f},
-std::array<float,2>{0.395077705f, 0.412956387f},
-std::array<float,2>{0.662440479f, 0.874228835f},
-std::array<float,2>{0.345978647f, 0.884994447f},
-std::array<float,2>{0.531017125f, 0.325234205f},
-std::array<float,2>{0.0522076935f, 0.153697357f},
-std::array<float,2>{0.789927661f, 0.617971063f},
-std::array<float,2>{0.23233667f, 0.801243901f},
-std::array<float,2>{0.915117741f, 0.438722342f},
-std::array<float,2>{0.379520446f, 0.0158905908f},
-std::array<float,2>{0.684403121f, 0.693789423f},
-std::array<float,2>{0.367473304f, 0.528247058f},
-std::array<float,2>{0.509542048f, 0.187554255f},
-std::array<float,2>{0.043456398f, 0.262201667f},
-std::array<float,2>{0.803133368f, 0.982185423f},
-std::array<float,2>{0.0627082214f, 0.639628232f},
-std::array<float,2>{0.82683593f, 0.0903612077f},
-std::array<float,2>{0.309899122f, 0.3935121f},
-std::array<float,2>{0.579952836f, 0.84234786f},
-std::array<float,2>{0.446463048f, 0.907941222f},
-std::array<float,2>{0.694003522f, 0.344814122f},
-std::array<float,2>{0.18470785f, 0.163732231f},
-std::array<float,2>{0.99330467f, 0.577903271f},
-std::array<float,2>{0.0143148322f, 0.957950354f},
-std::array<float,2>{0.765666068f, 0.284997255f},
-std::array<float,2>{0.3197864f, 0.231846631f},
-std::array<float,2>{0.544032574f, 0.552376866f},
-std::array<float,2>{0.425208509f, 0.727236569f},
-std::array<float,2>{0.635838628f, 0.0479429513f},
-std::array<float,2>{0.18950294f, 0.495629042f},
-std::array<float,2>{0.885741889f, 0.777249992f},
-std::array<float,2>{0.153735355f, 0.622869015f},
-std::array<float,2>{0.949515522f, 0.150700852f},
-std::array<float,2>{0.499352217f, 0.322206259f},
-std::array<float,2>{0.735184968f, 0.887860179f},
-std::array<float,2>{0.270231336f, 0.870943487f},
-std::array<float,2>{0.604400277f, 0.408173352f},
-std::array<float,2>{0.117692411f, 0.102166273f},
-std::array<float,2>{0.856742203f, 0.678897321f},
-std::array<float,2>{0.168601424f, 0.902110159f},
-std::array<float,2>{0.971585333f, 0.333443671f},
-std::array<float,2>{0.466823459f, 0.136204019f},
-std::array<float,2>{0.712549984f, 0.601068258f},
-std::array<float,2>{0.295439512f, 0.668680489f},
-std::array<float,2>{0.572973669f, 0.115603417f},
-std::array<float,2>{0.0857601911f, 0.433724552f},
-std::array<float,2>{0.837506711f, 0.853641629f},
-std::array<float,2>{0.0561677106f, 0.540712833f},
-std::array<float,2>{0.783389747f, 0.23591198f},
-std::array<float,2>{0.351746231f, 0.30449453f},
-std::array<float,2>{0.523087144f, 0.941325068f},
-std::array<float,2>{0.399234265f, 0.752752006f},
-std::array<float,2>{0.664748728f, 0.470367163f},
-std::array<float,2>{0.236301407f, 0.0411449298f},
-std::array<float,2>{0.936975121f, 0.746664703f},
-std::array<float,2>{0.105359577f, 0.816654205f},
-std::array<float,2>{0.869443655f, 0.382732153f},
-std::array<float,2>{0.25333485f, 0.073865734f},
-std::array<float,2>{0.616925657f, 0.650852859f},
-std::array<float,2>{0.478110164f, 0.580277741f},
-std::array<float,2>{0.7262851f, 0.177576378f},
-std::array<float,2>{0.131442577f, 0.371098995f},
-std::array<float,2>{0.958288193f, 0.924906135f},
-std::array<float,2>{0.216351733f, 0.715097368f},
-std::array<float,2>{0.900121033f, 0.00433985889f},
-std::array<float,2>{0.421166748f, 0.457095742f},
-std::array<float,2>{0.648803532f, 0.786430359f},
-std::array<float,2>{0.338026375f, 0.990239859f},
-std::array<float,2>{0.55386436f, 0.272550911f},
-std::array<float,2>{0.0160058215f, 0.210416764f},
-std::array<float,2>{0.756624103f, 0.509293437f},
-std::array<float,2>{0.134184599f, 0.846292019f},
-std::array<float,2>{0.965141356f, 0.428196669f},
-std::array<float,2>{0.47022596f, 0.117738426f},
-std::array<float,2>{0.727500439f, 0.662192225f},
-std::array<float,2>{0.259179533f, 0.601970673f},
-std::array<float,2>{0.617353499f, 0.126295477f},
-std::array<float,2>{0.0979861394f, 0.339879036f},
-std::array<float,2>{0.859693944f, 0.895237744f},
-std::array<float,2>{0.0250183959f, 0.740925133f},
-std::array<float,2>{0.762911439f, 0.0347744934f},
-std::array<float,2>{0.330008954f, 0.481027722f},
-std::array<float,2>{0.559107721f, 0.764537334f},
-std::array<float,2>{0.411254466f, 0.945493519f},
-std::array<float,2>{0.648284674f, 0.310758799f},
-std::array<float,2>{0.210324824f, 0.243948847f},
-std::array<float,2>{0.896050632f, 0.538235068f},
-std::array<float,2>{0.0914668143f, 0.935432017f},
-std::array<float,2>{0.834998906f, 0.363085359f},
-std::array<float,2>{0.281301647f, 0.185286462f},
-std::array<float,2>{0.568059146f, 0.590177536f},
-std::array<float,2>{0.454834938f, 0.644689977f},
-std::array<float,2>{0.704197645f, 0.0668486729f},
-std::array<float,2>{0.157773718f, 0.389975578f},
-std::array<float,2>{0.977882206f, 0.823752642f},
-std::array<float,2>{0.245801345f, 0.506918371f},
-std::array<float,2>{0.921948552f, 0.218092889f},
-std::array<float,2>{0.393051803f, 0.274198562f},
-std::array<float,2>{0.657245815f, 0.998855293f},
-std::array<float,2>{0.348082334f, 0.790001869f},
-std::array<float,2>{0.527182996f, 0.46157372f},
-std::array<float,2>{0.0501149632f, 0.0119180372f},
-std::array<float,2>{0.794535518f, 0.703347623f},
-std::array<float,2>{0.199734092f, 0.975948274f},
-std::array<float,2>{0.877661943f, 0.254156619f},
-std::array<float,2>{0.430308878f, 0.200443715f},
-std::array<float,2>{0.631293774f, 0.518545151f},
-std::array<float,2>{0.32595861f, 0.696505964f},
-std::array<float,2>{0.532531261f, 0.0304213446f},
-std::array<float,2>{0.00345627521f, 0.449877769f},
-std::array<float,2>{0.777115285f, 0.807145f},
-std::array<float,2>{0.113086373f, 0.56377095f},
-std::array<float,2>{0.844737887f, 0.164570823f},
-std::array<float,2>{0.279708534f, 0.354699492f},
-std::array<float,2>{0.597363353f, 0.921717763f},
-std::array<float,2>{0.484445184f, 0.830750406f},
-std::array<float,2>{0.74805057f, 0.401068211f},
-std::array<float,2>{0.141001597f, 0.0798057765f},
-std::array<float,2>{0.941648781f, 0.625454426f},
-std::array<float,2>{0.0373573713f, 0.769412875f},
-std::array<float,2>{0.811803699f, 0.485339522f},
-std::array<float,2>{0.367084414f, 0.0569155812f},
-std::array<float,2>{0.501960158f, 0.722031891f},
-std::array<float,2>{0.384650171f, 0.557860136f},
-std::array<float,2>{0.675665557f, 0.226463363f},
-std::array<float,2>{0.223571122f, 0.29486993f},
-std::array<float,2>{0.911699295f, 0.967707217f},
-std::array<float,2>{0.171976209f, 0.679791987f},
-std::array<float,2>{0.989198387f, 0.0952407569f},
-std::array<float,2>{0.442943484f, 0.415586025f},
-std::array<float,2>{0.697995543f, 0.863814592f},
-std::array<float,2>{0.297960162f, 0.881110787f},
-std::array<float,2>{0.59290725f, 0.317238837f},
-std::array<float,2>{0.0763185024f, 0.140744224f},
-std::array<float,2>{0.818715036f, 0.609514296f},
-std::array<float,2>{0.180467427f, 0.759076059f},
-std::array<float,2>{0.998161554f, 0.47968322f},
-std::array<float,2>{0.452119559f, 0.0385806598f},
-std::array<float,2>{0.690229774f, 0.735007524f},
-std::array<float,2>{0.30564028f, 0.533718228f},
-std::array<float,2>{0.582608998f, 0.246819183f},
-std::array<float,2>{0.0669282079f, 0.30828923f},
-std::array<float,2>{0.822343171f, 0.951418936f},
-std::array<float,2>{0.0419753976f, 0.656335771f},
-std::array<float,2>{0.798094213f, 0.123373814f},
-std::array<float,2>{0.372110873f, 0.424900323f},
-std::array<float,2>{0.512629509f, 0.847956657f},
-std::array<float,2>{0.376135439f, 0.893802166f},
-std::array<float,2>{0.68070662f, 0.337030113f},
-std::array<float,2>{0.227601588f, 0.131313533f},
-std::array<float,2>{0.91800642f, 0.608942568f},
-std::array<float,2>{0.124539137f, 0.993371248f},
-std::array<float,2>{0.853871644f, 0.280626655f},
-std::array<float,2>{0.268605798f, 0.211060837f},
-std::array<float,2>{0.608301699f, 0.501471817f},
-std::array<float,2>{0.492659152f, 0.71035558f},
-std::array<float,2>{0.738996208f, 0.00846207887f},
-std::array<float,2>{0.148643091f, 0.465146452f},
-std::array<float,2>{0.945423126f, 0.794364333f},
-std::array<float,2>{0.191947475f, 0.58770299f},
-std::array<float,2>{0.888017893f, 0.18217738f},
-std::array<float,2>{0.428974628f, 0.364100516f},
-std::array<float,2>{0.640318632f, 0.930448055f},
-std::array<float,2>{0.314467818f, 0.825581551f},
-std::array<float,2>{0.541127205f, 0.384961367f},
-std::array<float,2>{0.0102295922f, 0.0654952526f},
-std::array<float,2>{0.772969902f, 0.641920805f},
-std::array<float,2>{0.241429001f, 0.916240036f},
-std::array<float,2>{0.930104434f, 0.357387424f},
-std::array<float,2>{0.404115111f, 0.170296207f},
-std::array<float,2>{0.670697033f, 0.568393528f},
-std::array<float,2>{0.357512385f, 0.631979644f},
-std::array<float,2>{0.516313791f, 0.082178846f},
-std::array<float,2>{0.0596861951f, 0.404105812f},
-std::array<float,2>{0.785350502f, 0.835051f},
-std::array<float,2>{0.0796381235f, 0.519767582f},
-std::array<float,2>{0.841788352f, 0.196915433f},
-std::array<float,2>{0.290862262f, 0.253662586f},
-std::array<float,2>{0.576366782f, 0.972631752f},
-std::array<float,2>{0.463344425f, 0.810099125f},
-std::array<float,2>{0.715383291f, 0.448042631f},
-std::array<float,2>{0.165916875f, 0.0250745229f},
-std::array<float,2>{0.974094987f, 0.701884449f},
-std::array<float,2>{0.0223884024f, 0.860445917f},
-std::array<float,2>{0.75119102f, 0.420175672f},
-std::array<float,2>{0.339999229f, 0.0998238847f},
-std::array<float,2>{0.550050735f, 0.685417354f},
-std::array<float,2>{0.414817154f, 0.613944411f},
-std::array<float,2>{0.654140532f, 0.148294896f},
-std::array<float,2>{0.21324648f, 0.313058823f},
-std::array<float,2>{0.903069854f, 0.877218783f},
-std::array<float,2>{0.1262234f, 0.726389349f},
-std::array<float,2>{0.956027806f, 0.0605329052f},
-std::array<float,2>{0.482282877f, 0.491536915f},
-std::array<float,2>{0.719524562f, 0.770224094f},
-std::array<float,2>{0.255815268f, 0.962534428f},
-std::array<float,2>{0.612471581f, 0.289496124f},
-std::array<float,2>{0.107187666f, 0.222388908f},
-std::array<float,2>{0.871123254f, 0.56224227f},
-std::array<float,2>{0.206836984f, 0.836603165f},
-std::array<float,2>{0.894101918f, 0.397853166f},
-std::array<float,2>{0.40870446f, 0.0893680081f},
-std::array<float,2>{0.64123857f, 0.634975314f},
-std::array<float,2>{0.333971858f, 0.571533144f},
-std::array<float,2>{0.557413995f, 0.159625754f},
-std::array<float,2>{0.0310011115f, 0.349369556f},
-std::array<float,2>{0.758892715f, 0.911841512f},
-std::array<float,2>{0.0961768404f, 0.690143645f},
-std::array<float,2>{0.864458203f, 0.0230678171f},
-std::array<float,2>{0.263319969f, 0.441767156f},
-std::array<float,2>{0.621943593f, 0.797284007f},
-std::array<float,2>{0.474548757f, 0.976763964f},
-std::array<float,2>{0.733529985f, 0.257832795f},
-std::array<float,2>{0.138580784f, 0.192104727f},
-std::array<float,2>{0.964674294f, 0.524062872f},
-std::array<float,2>{0.0516683049f, 0.88371855f},
-std::array<float,2>{0.790265203f, 0.327378213f},
-std::array<float,2>{0.346860677f, 0.155971363f},
-std::array<float,2>{0.530141413f, 0.620561779f},
-std::array<float,2>{0.395779699f, 0.674003422f},
-std::array<float,2>{0.663514197f, 0.105766781f},
-std::array<float,2>{0.249846116f, 0.410975635f},
-std::array<float,2>{0.926274419f, 0.872598231f},
-std::array<float,2>{0.160991535f, 0.549381077f},
-std::array<float,2>{0.98091346f, 0.227251157f},
-std::array<float,2>{0.459887296f, 0.286639392f},
-std::array<float,2>{0.708987176f, 0.953486264f},
-std::array<float,2>{0.286094487f, 0.778091848f},
-std::array<float,2>{0.564098597f, 0.498711437f},
-std::array<float,2>{0.0893905759f, 0.0532074496f},
-std::array<float,2>{0.831168473f, 0.734242618f},
-std::array<float,2>{0.147744462f, 0.941460729f},
-std::array<float,2>{0.939071774f, 0.299584985f},
-std::array<float,2>{0.491232842f, 0.240901306f},
-std::array<float,2>{0.744258285f, 0.543691576f},
-std::array<float,2>{0.274476737f, 0.745246828f},
-std::array<float,2>{0.601036549f, 0.0455419309f},
-std::array<float,2>{0.115524031f, 0.475506186f},
-std::array<float,2>{0.849138677f, 0.755599499f},
-std::array<float,2>{0.00531673338f, 0.596653938f},
-std::array<float,2>{0.780353785f, 0.138344571f},
-std::array<float,2>{0.322630763f, 0.330136567f},
-std::array<float,2>{0.536405563f, 0.902561545f},
-std::array<float,2>{0.437389046f, 0.855737925f},
-std::array<float,2>{0.627164125f, 0.431218535f},
-std::array<float,2>{0.197090313f, 0.111891404f},
-std::array<float,2>{0.879145861f, 0.664680958f},
-std::array<float,2>{0.0725719929f, 0.783131242f},
-std::array<float,2>{0.8155424f, 0.453418106f},
-std::array<float,2>{0.301414549f, 0.00171893183f},
-std::array<float,2>{0.588534057f, 0.711771727f},
-std::array<float,2>{0.438383996f, 0.515249133f},
-std::array<float,2>{0.701875389f, 0.206387028f},
-std::array<float,2>{0.178426236f, 0.268337905f},
-std::array<float,2>{0.987213552f, 0.984660268f},
-std::array<float,2>{0.222260594f, 0.653570175f},
-std::array<float,2>{0.907571673f, 0.0749733374f},
-std::array<float,2>{0.388939172f, 0.376575768f},
-std::array<float,2>{0.679676175f, 0.812602758f},
-std::array<float,2>{0.360035688f, 0.929391026f},
-std::array<float,2>{0.506799459f, 0.36749807f},
-std::array<float,2>{0.0326586962f, 0.172004774f},
-std::array<float,2>{0.807810605f, 0.582750142f},
-std::array<float,2>{0.187756017f, 0.775085092f},
-std::array<float,2>{0.883660972f, 0.493019462f},
-std::array<float,2>{0.423430651f, 0.050351128f},
-std::array<float,2>{0.632812798f, 0.730339766f},
-std::array<float,2>{0.317110151f, 0.55304563f},
-std::array<float,2>{0.545434833f, 0.233392656f},
-std::array<float,2>{0.0136191212f, 0.282776326f},
-std::array<float,2>{0.769136786f, 0.960243046f},
-std::array<float,2>{0.119936801f, 0.677326977f},
-std::array<float,2>{0.858160138f, 0.104275741f},
-std::array<float,2>{0.273298502f, 0.409192741f},
-std::array<float,2>{0.603263617f, 0.867887795f},
-std::array<float,2>{0.496416152f, 0.890092909f},
-std::array<float,2>{0.737884879f, 0.323071092f},
-std::array<float,2>{0.154435337f, 0.149701566f},
-std::array<float,2>{0.95134747f, 0.623264849f},
-std::array<float,2>{0.0449969508f, 0.982820749f},
-std::array<float,2>{0.801252961f, 0.264154762f},
-std::array<float,2>{0.369704694f, 0.190391719f},
-std::array<float,2>{0.509817123f, 0.529907703f},
-std::array<float,2>{0.380943626f, 0.693028092f},
-std::array<float,2>{0.687479019f, 0.0184407309f},
-std::array<float,2>{0.233867735f, 0.441173345f},
-std::array<float,2>{0.916684985f, 0.804258525f},
-std::array<float,2>{0.187397599f, 0.574657559f},
-std::array<float,2>{0.995101929f, 0.161781326f},
-std::array<float,2>{0.44885236f, 0.345903099f},
-std::array<float,2>{0.691515148f, 0.909159243f},
-std::array<float,2>{0.311681896f, 0.839876056f},
-std::array<float,2>{0.580975413f, 0.390798897f},
-std::array<float,2>{0.0645264313f, 0.0928096399f},
-std::array<float,2>{0.824698985f, 0.637119532f},
-std::array<float,2>{0.129063264f, 0.92345649f},
-std::array<float,2>{0.960849345f, 0.374097884f},
-std::array<float,2>{0.479886115f, 0.179398492f},
-std::array<float,2>{0.723813295f, 0.579779565f},
-std::array<float,2>{0.250037283f, 0.649346173f},
-std::array<float,2>{0.614505231f, 0.0716425553f},
-std::array<float,2>{0.102247804f, 0.380668789f},
-std::array<float,2>{0.867652535f, 0.819805086f},
-std::array<float,2>{0.0185239185f, 0.509833097f},
-std::array<float,2>{0.754538834f, 0.207519412f},
-std::array<float,2>{0.336018026f, 0.271118104f},
-std::array<float,2>{0.550792575f, 0.989611089f},
-std::array<float,2>{0.418616146f, 0.787782907f},
-std::array<float,2>{0.651088774f, 0.460289478f},
-std::array<float,2>{0.217156917f, 0.00721885404f},
-std::array<float,2>{0.901588261f, 0.717712164f},
-std::array<float,2>{0.0826683193f, 0.853119493f},
-std::array<float,2>{0.838364065f, 0.436412007f},
-std::array<float,2>{0.29309535f, 0.114703052f},
-std::array<float,2>{0.571420789f, 0.670762777f},
-std::array<float,2>{0.466568112f, 0.598472118f},
-std::array<float,2>{0.714607775f, 0.134101599f},
-std::array<float,2>{0.171711877f, 0.335232437f},
-std::array<float,2>{0.969849885f, 0.898718357f},
-std::array<float,2>{0.236944556f, 0.748837829f},
-std::array<float,2>{0.935197949f, 0.0398418941f},
-std::array<float,2>{0.401146382f, 0.471991122f},
-std::array<float,2>{0.666342974f, 0.750241399f},
-std::array<float,2>{0.353824615f, 0.939228475f},
-std::array<float,2>{0.520117819f, 0.302023649f},
-std::array<float,2>{0.0567914695f, 0.237642691f},
-std::array<float,2>{0.783038497f, 0.541258872f},
-std::array<float,2>{0.158994943f, 0.82099539f},
-std::array<float,2>{0.979100287f, 0.388633162f},
-std::array<float,2>{0.456850797f, 0.0700179935f},
-std::array<float,2>{0.70656836f, 0.647471428f},
-std::array<float,2>{0.284144819f, 0.593512058f},
-std::array<float,2>{0.56965071f, 0.185957119f},
-std::array<float,2>{0.0922963023f, 0.360321701f},
-std::array<float,2>{0.833494604f, 0.936560392f},
-std::array<float,2>{0.0487395525f, 0.705243111f},
-std::array<float,2>{0.795898974f, 0.0138926972f},
-std::array<float,2>{0.350218564f, 0.464602202f},
-std::array<float,2>{0.524747133f, 0.792774379f},
-std::array<float,2>{0.39177835f, 0.99769634f},
-std::array<float,2>{0.659667194f, 0.276614785f},
-std::array<float,2>{0.242258102f, 0.215282023f},
-std::array<float,2>{0.924574792f, 0.505599856f},
-std::array<float,2>{0.100214116f, 0.897584796f},
-std::array<float,2>{0.862066686f, 0.342833161f},
-std::array<float,2>{0.260049582f, 0.127367899f},
-std::array<float,2>{0.620194495f, 0.604367435f},
-std::array<float,2>{0.471958935f, 0.660609365f},
-std::array<float,2>{0.729823828f, 0.120598644f},
-std::array<float,2>{0.136622995f, 0.426809996f},
-std::array<float,2>{0.967526376f, 0.84557426f},
-std::array<float,2>{0.208519146f, 0.536487758f},
-std::array<float,2>{0.897124469f, 0.244215578f},
-std::array<float,2>{0.413982153f, 0.310088217f},
-std::array<float,2>{0.646144867f, 0.948078573f},
-std::array<float,2>{0.331186175f, 0.763644814f},
-std::array<float,2>{0.562195778f, 0.483970016f},
-std::array<float,2>{0.0269142445f, 0.0316966251f},
-std::array<float,2>{0.764056444f, 0.73848784f},
-std::array<float,2>{0.226354867f, 0.966584444f},
-std::array<float,2>{0.913680315f, 0.296410054f},
-std::array<float,2>{0.385331035f, 0.224276751f},
-std::array<float,2>{0.672564149f, 0.556008101f},
-std::array<float,2>{0.364749581f, 0.71925211f},
-std::array<float,2>{0.50172627f, 0.0565312468f},
-std::array<float,2>{0.0369561799f, 0.488197744f},
-std::array<float,2>{0.809661567f, 0.765997231f},
-std::array<float,2>{0.0755228251f, 0.613092721f},
-std::array<float,2>{0.81809485f, 0.144180387f},
-std::array<float,2>{0.300163388f, 0.318393767f},
-std::array<float,2>{0.589959919f, 0.880032301f},
-std::array<float,2>{0.443667442f, 0.866606772f},
-std::array<float,2>{0.696626425f, 0.417728871f},
-std::array<float,2>{0.173952058f, 0.0970933288f},
-std::array<float,2>{0.990362585f, 0.681909084f},
-std::array<float,2>{0.000119961136f, 0.806406558f},
-std::array<float,2>{0.775136411f, 0.451868773f},
-std::array<float,2>{0.328067511f, 0.028195139f},
-std::array<float,2>{0.533643603f, 0.697888911f},
-std::array<float,2>{0.433056921f, 0.517277181f},
-std::array<float,2>{0.630671799f, 0.20223175f},
-std::array<float,2>{0.202372268f, 0.25647077f},
-std::array<float,2>{0.875130177f, 0.973255515f},
-std::array<float,2>{0.144394115f, 0.62706089f},
-std::array<float,2>{0.943459213f, 0.0800983757f},
-std::array<float,2>{0.486830115f, 0.399093926f},
-std::array<float,2>{0.747284472f, 0.82832849f},
-std::array<float,2>{0.278929949f, 0.918453336f},
-std::array<float,2>{0.594547391f, 0.35181123f},
-std::array<float,2>{0.109843493f, 0.166838437f},
-std::array<float,2>{0.84616673f, 0.56540519f},
-std::array<float,2>{0.151008621f, 0.796348333f},
-std::array<float,2>{0.947673798f, 0.467784107f},
-std::array<float,2>{0.494215995f, 0.0113184685f},
-std::array<float,2>{0.741514325f, 0.70790118f},
-std::array<float,2>{0.265769958f, 0.50328517f},
-std::array<float,2>{0.606965482f, 0.213817254f},
-std::array<float,2>{0.121234827f, 0.279260814f},
-std::array<float,2>{0.853054643f, 0.994752944f},
-std::array<float,2>{0.00971466582f, 0.643995821f},
-std::array<float,2>{0.769950509f, 0.0633269772f},
-std::array<float,2>{0.313381195f, 0.383012563f},
-std::array<float,2>{0.539066911f, 0.826812744f},
-std::array<float,2>{0.425787687f, 0.933417737f},
-std::array<float,2>{0.637045026f, 0.365991473f},
-std::array<float,2>{0.194194362f, 0.180897519f},
-std::array<float,2>{0.888955712f, 0.589077652f},
-std::array<float,2>{0.0689213201f, 0.949430764f},
-std::array<float,2>{0.82125479f, 0.306499422f},
-std::array<float,2>{0.307272345f, 0.248053044f},
-std::array<float,2>{0.584934235f, 0.531504333f},
-std::array<float,2>{0.449740916f, 0.738105953f},
-std::array<float,2>{0.688378632f, 0.0360980369f},
-std::array<float,2>{0.183515921f, 0.478196949f},
-std::array<float,2>{0.996592283f, 0.761073709f},
-std::array<float,2>{0.228632659f, 0.606323719f},
-std::array<float,2>{0.921117961f, 0.129876122f},
-std::array<float,2>{0.37703678f, 0.339112699f},
-std::array<float,2>{0.68232137f, 0.892510712f},
-std::array<float,2>{0.373773396f, 0.851107895f},
-std::array<float,2>{0.514530838f, 0.423558772f},
-std::array<float,2>{0.0397770405f, 0.121345401f},
-std::array<float,2>{0.798965037f, 0.659440935f},
-std::array<float,2>{0.212573469f, 0.875793695f},
-std::array<float,2>{0.905712247f, 0.315863222f},
-std::array<float,2>{0.416531831f, 0.144672066f},
-std::array<float,2>{0.655121028f, 0.615451872f},
-std::array<float,2>{0.34322086f, 0.685628772f},
-std::array<float,2>{0.547670305f, 0.0993725136f},
-std::array<float,2>{0.0196310934f, 0.418128073f},
-std::array<float,2>{0.752917588f, 0.862766147f},
-std::array<float,2>{0.108268261f, 0.559289455f},
-std::array<float,2>{0.873795033f, 0.220269978f},
-std::array<float,2>{0.25682658f, 0.292663664f},
-std::array<float,2>{0.61104095f, 0.964230418f},
-std::array<float,2>{0.483120739f, 0.773287475f},
-std::array<float,2>{0.722221673f, 0.489831775f},
-std::array<float,2>{0.128000021f, 0.060638763f},
-std::array<float,2>{0.953785956f, 0.724146307f},
-std::array<float,2>{0.0612729304f, 0.833626091f},
-std::array<float,2>{0.787231624f, 0.406198621f},
-std::array<float,2>{0.355855107f, 0.0840633288f},
-std::array<float,2>{0.517721891f, 0.630659163f},
-std::array<float,2>{0.405002832f, 0.567234695f},
-std::array<float,2>{0.668823838f, 0.167979747f},
-std::array<float,2>{0.239890531f, 0.358015031f},
-std::array<float,2>{0.932470024f, 0.914618015f},
-std::array<float,2>{0.166015729f, 0.699222147f},
-std::array<float,2>{0.975974739f, 0.0266500823f},
-std::array<float,2>{0.461319238f, 0.445637405f},
-std::array<float,2>{0.717069626f, 0.81074971f},
-std::array<float,2>{0.292812496f, 0.969961524f},
-std::array<float,2>{0.574557781f, 0.25101307f},
-std::array<float,2>{0.0804026276f, 0.198535115f},
-std::array<float,2>{0.842132092f, 0.521530092f},
-std::array<float,2>{0.247524723f, 0.873877048f},
-std::array<float,2>{0.929420471f, 0.413864225f},
-std::array<float,2>{0.396981418f, 0.107931986f},
-std::array<float,2>{0.661090016f, 0.672893167f},
-std::array<float,2>{0.34449634f, 0.618605196f},
-std::array<float,2>{0.529078662f, 0.153235808f},
-std::array<float,2>{0.0545826629f, 0.324695915f},
-std::array<float,2>{0.792563617f, 0.885748923f},
-std::array<float,2>{0.0871651471f, 0.731489599f},
-std::array<float,2>{0.829030991f, 0.0509520806f},
-std::array<float,2>{0.288240254f, 0.497308105f},
-std::array<float,2>{0.565713584f, 0.78116256f},
-std::array<float,2>{0.458819062f, 0.956662834f},
-std::array<float,2>{0.708193183f, 0.288710296f},
-std::array<float,2>{0.162120357f, 0.229065463f},
-std::array<float,2>{0.983771682f, 0.54851073f},
-std::array<float,2>{0.0278251525f, 0.912898302f},
-std::array<float,2>{0.761021733f, 0.349633336f},
-std::array<float,2>{0.334769368f, 0.157069564f},
-std::array<float,2>{0.554774404f, 0.573083818f},
-std::array<float,2>{0.408073246f, 0.634348452f},
-std::array<float,2>{0.642723501f, 0.0865033716f},
-std::array<float,2>{0.204805836f, 0.396301597f},
-std::array<float,2>{0.891214192f, 0.839434266f},
-std::array<float,2>{0.140007377f, 0.525615156f},
-std::array<float,2>{0.961031139f, 0.193501294f},
-std::array<float,2>{0.474629998f, 0.260734499f},
-std::array<float,2>{0.73157078f, 0.980206788f},
-std::array<float,2>{0.264243066f, 0.80078119f},
-std::array<float,2>{0.624276519f, 0.444326788f},
-std::array<float,2>{0.0942670181f, 0.0211116709f},
-std::array<float,2>{0.866323888f, 0.688053906f},
-std::array<float,2>{0.177188635f, 0.98762399f},
-std::array<float,2>{0.984624505f, 0.266998887f},
-std::array<float,2>{0.43973434f, 0.203994662f},
-std::array<float,2>{0.700829029f, 0.511908472f},
-std::array<float,2>{0.304188102f, 0.714036167f},
-std::array<float,2>{0.586633801f, 0.00244760537f},
-std::array<float,2>{0.0712448582f, 0.45702675f},
-std::array<float,2>{0.812878191f, 0.78444761f},
-std::array<float,2>{0.0339648202f, 0.584429502f},
-std::array<float,2>{0.804973543f, 0.173902526f},
-std::array<float,2>{0.361871719f, 0.370012373f},
-std::array<float,2>{0.504545331f, 0.926701486f},
-std::array<float,2>{0.388620585f, 0.814841151f},
-std::array<float,2>{0.677714109f, 0.377261609f},
-std::array<float,2>{0.220231369f, 0.0778067037f},
-std::array<float,2>{0.908785701f, 0.654679835f},
-std::array<float,2>{0.11433576f, 0.756972075f},
-std::array<float,2>{0.85100472f, 0.472658306f},
-std::array<float,2>{0.275925994f, 0.0438815653f},
-std::array<float,2>{0.598937869f, 0.743133008f},
-std::array<float,2>{0.489174396f, 0.546672642f},
-std::array<float,2>{0.74367249f, 0.238781288f},
-std::array<float,2>{0.144934252f, 0.298198074f},
-std::array<float,2>{0.941171288f, 0.945215285f},
-std::array<float,2>{0.197373897f, 0.666737139f},
-std::array<float,2>{0.882230043f, 0.110171869f},
-std::array<float,2>{0.434105814f, 0.432346404f},
-std::array<float,2>{0.625558019f, 0.85882324f},
-std::array<float,2>{0.322007805f, 0.904994488f},
-std::array<float,2>{0.537917137f, 0.329365641f},
-std::array<float,2>{0.00703278882f, 0.139429241f},
-std::array<float,2>{0.779097557f, 0.595123172f},
-std::array<float,2>{0.202679485f, 0.806861341f},
-std::array<float,2>{0.875575721f, 0.449466407f},
-std::array<float,2>{0.433226854f, 0.0312012881f},
-std::array<float,2>{0.630122662f, 0.697021186f},
-std::array<float,2>{0.32732299f, 0.517986834f},
-std::array<float,2>{0.534029603f, 0.200718239f},
-std::array<float,2>{0.00059757242f, 0.254833013f},
-std::array<float,2>{0.774675846f, 0.976445794f},
-std::array<float,2>{0.110128291f, 0.62583077f},
-std::array<float,2>{0.84639889f, 0.0791409239f},
-std::array<float,2>{0.278453708f, 0.400495231f},
-std::array<float,2>{0.594230056f, 0.830402553f},
-std::array<float,2>{0.48676157f, 0.921289504f},
-std::array<float,2>{0.747830033f, 0.355301231f},
-std::array<float,2>{0.143883213f, 0.164263055f},
-std::array<float,2>{0.944173813f, 0.564043939f},
-std::array<float,2>{0.0363175981f, 0.967068195f},
-std::array<float,2>{0.810343981f, 0.294283599f},
-std::array<float,2>{0.364304453f, 0.225658685f},
-std::array<float,2>{0.500987232f, 0.558313191f},
-std::array<float,2>{0.385048568f, 0.722194731f},
-std::array<float,2>{0.671976507f, 0.0575258397f},
-std::array<float,2>{0.226052746f, 0.48481828f},
-std::array<float,2>{0.913511634f, 0.768950164f},
-std::array<float,2>{0.174632713f, 0.610239565f},
-std::array<float,2>{0.990804195f, 0.141407058f},
-std::array<float,2>{0.444306821f, 0.316408515f},
-std::array<float,2>{0.697093308f, 0.881577134f},
-std::array<float,2>{0.300608993f, 0.863687396f},
-std::array<float,2>{0.590347528f, 0.415127248f},
-std::array<float,2>{0.0760277659f, 0.0952063799f},
-std::array<float,2>{0.817449212f, 0.680187762f},
-std::array<float,2>{0.135970011f, 0.895003796f},
-std::array<float,2>{0.967240036f, 0.340363204f},
-std::array<float,2>{0.472293556f, 0.126656219f},
-std::array<float,2>{0.73028338f, 0.602082372f},
-std::array<float,2>{0.2604056f, 0.662709355f},
-std::array<float,2>{0.620745122f, 0.117587127f},
-std::array<float,2>{0.099981159f, 0.428537339f},
-std::array<float,2>{0.861577153f, 0.846052229f},
-std::array<float,2>{0.0264928844f, 0.538823545f},
-std::array<float,2>{0.764186025f, 0.243474647f},
-std::array<float,2>{0.331942528f, 0.311207145f},
-std::array<float,2>{0.561805069f, 0.945891798f},
-std::array<float,2>{0.41328913f, 0.763688147f},
-std::array<float,2>{0.645643294f, 0.48052451f},
-std::array<float,2>{0.208277777f, 0.0342755504f},
-std::array<float,2>{0.896630883f, 0.740355849f},
-std::array<float,2>{0.0921689123f, 0.823713422f},
-std::array<float,2>{0.833705783f, 0.39032349f},
-std::array<float,2>{0.283361793f, 0.0673080608f},
-std::array<float,2>{0.569911778f, 0.645290256f},
-std::array<float,2>{0.45640713f, 0.590383708f},
-std::array<float,2>{0.706145942f, 0.1849408f},
-std::array<float,2>{0.158468083f, 0.362377882f},
-std::array<float,2>{0.97887671f, 0.93457371f},
-std::array<float,2>{0.24268809f, 0.703742564f},
-std::array<float,2>{0.924195707f, 0.0122880181f},
-std::array<float,2>{0.39236325f, 0.461187869f},
-std::array<float,2>{0.66013509f, 0.789491117f},
-std::array<float,2>{0.350052088f, 0.998138905f},
-std::array<float,2>{0.525076389f, 0.273769319f},
-std::array<float,2>{0.0482068583f, 0.218654737f},
-std::array<float,2>{0.796467245f, 0.507498682f},
-std::array<float,2>{0.170960754f, 0.854004145f},
-std::array<float,2>{0.970469534f, 0.434161454f},
-std::array<float,2>{0.465973139f, 0.115969434f},
-std::array<float,2>{0.713913083f, 0.667972624f},
-std::array<float,2>{0.293654561f, 0.601514816f},
-std::array<float,2>{0.57203877f, 0.136407986f},
-std::array<float,2>{0.0820500404f, 0.333749294f},
-std::array<float,2>{0.838531554f, 0.901541352f},
-std::array<float,2>{0.057464689f, 0.746515334f},
-std::array<float,2>{0.782395124f, 0.041900035f},
-std::array<float,2>{0.354303628f, 0.469731271f},
-std::array<float,2>{0.519890249f, 0.752069056f},
-std::array<float,2>{0.400638849f, 0.940679491f},
-std::array<float,2>{0.666670501f, 0.303990573f},
-std::array<float,2>{0.236602917f, 0.235679165f},
-std::array<float,2>{0.934594631f, 0.540303826f},
-std::array<float,2>{0.101731338f, 0.925614238f},
-std::array<float,2>{0.86792922f, 0.371708542f},
-std::array<float,2>{0.250547677f, 0.176843017f},
-std::array<float,2>{0.614974856f, 0.580993354f},
-std::array<float,2>{0.480043203f, 0.651322842f},
-std::array<float,2>{0.724281967f, 0.0733602718f},
-std::array<float,2>{0.129871652f, 0.381995469f},
-std::array<float,2>{0.960114717f, 0.81720072f},
-std::array<float,2>{0.217538953f, 0.508848011f},
-std::array<float,2>{0.902227938f, 0.210696578f},
-std::array<float,2>{0.418240458f, 0.273422599f},
-std::array<float,2>{0.650618911f, 0.990935206f},
-std::array<float,2>{0.33676064f, 0.786747098f},
-std::array<float,2>{0.551556587f, 0.457792908f},
-std::array<float,2>{0.0178881139f, 0.0048177084f},
-std::array<float,2>{0.754289627f, 0.715735674f},
-std::array<float,2>{0.234060392f, 0.981502414f},
-std::array<float,2>{0.916052043f, 0.262507021f},
-std::array<float,2>{0.381646395f, 0.188194796f},
-std::array<float,2>{0.686662197f, 0.527542114f},
-std::array<float,2>{0.369415581f, 0.693995416f},
-std::array<float,2>{0.510529637f, 0.016356796f},
-std::array<float,2>{0.0457143299f, 0.438979328f},
-std::array<float,2>{0.801491439f, 0.801740408f},
-std::array<float,2>{0.0650583431f, 0.577275515f},
-std::array<float,2>{0.824779034f, 0.163488209f},
-std::array<float,2>{0.312124699f, 0.345696121f},
-std::array<float,2>{0.580345452f, 0.907664061f},
-std::array<float,2>{0.448564053f, 0.842284024f},
-std::array<float,2>{0.692368925f, 0.39261815f},
-std::array<float,2>{0.186878577f, 0.0898581892f},
-std::array<float,2>{0.994320929f, 0.638876975f},
-std::array<float,2>{0.0128196673f, 0.776757777f},
-std::array<float,2>{0.768740237f, 0.495517731f},
-std::array<float,2>{0.316873491f, 0.0487690978f},
-std::array<float,2>{0.545250237f, 0.726661503f},
-std::array<float,2>{0.423032463f, 0.551962554f},
-std::array<float,2>{0.633410215f, 0.232170656f},
-std::array<float,2>{0.188114703f, 0.284243077f},
-std::array<float,2>{0.882984579f, 0.957076609f},
-std::array<float,2>{0.155156672f, 0.679272294f},
-std::array<float,2>{0.952054501f, 0.102027178f},
-std::array<float,2>{0.496799469f, 0.407342017f},
-std::array<float,2>{0.73763448f, 0.870379627f},
-std::array<float,2>{0.272712439f, 0.888561189f},
-std::array<float,2>{0.602837563f, 0.321644187f},
-std::array<float,2>{0.119197555f, 0.151040077f},
-std::array<float,2>{0.857610703f, 0.622162819f},
-std::array<float,2>{0.145066276f, 0.755320311f},
-std::array<float,2>{0.940790653f, 0.474879563f},
-std::array<float,2>{0.488450557f, 0.0449333787f},
-std::array<float,2>{0.743245125f, 0.745856762f},
-std::array<float,2>{0.275665015f, 0.543109655f},
-std::array<float,2>{0.599547505f, 0.240445957f},
-std::array<float,2>{0.115092829f, 0.299009055f},
-std::array<float,2>{0.851423204f, 0.942106187f},
-std::array<float,2>{0.00774603197f, 0.664142966f},
-std::array<float,2>{0.778641403f, 0.111609511f},
-std::array<float,2>{0.321504474f, 0.430919766f},
-std::array<float,2>{0.537555635f, 0.856293261f},
-std::array<float,2>{0.433969855f, 0.903129101f},
-std::array<float,2>{0.625137985f, 0.330700904f},
-std::array<float,2>{0.197779477f, 0.138105735f},
-std::array<float,2>{0.882699847f, 0.595793188f},
-std::array<float,2>{0.0706957206f, 0.985031664f},
-std::array<float,2>{0.813221812f, 0.26782468f},
-std::array<float,2>{0.304222912f, 0.206950322f},
-std::array<float,2>{0.586127877f, 0.515117347f},
-std::array<float,2>{0.440307409f, 0.711167991f},
-std::array<float,2>{0.700451016f, 0.00135771954f},
-std::array<float,2>{0.177694991f, 0.454097509f},
-std::array<float,2>{0.985258698f, 0.782241821f},
-std::array<float,2>{0.219847828f, 0.582316458f},
-std::array<float,2>{0.908469319f, 0.172495127f},
-std::array<float,2>{0.388154685f, 0.36787796f},
-std::array<float,2>{0.677145362f, 0.928923965f},
-std::array<float,2>{0.361430317f, 0.813153088f},
-std::array<float,2>{0.504368305f, 0.376421481f},
-std::array<float,2>{0.0332960486f, 0.0746149123f},
-std::array<float,2>{0.805345058f, 0.654124975f},
-std::array<float,2>{0.204392344f, 0.911150873f},
-std::array<float,2>{0.890633523f, 0.348641962f},
-std::array<float,2>{0.407382667f, 0.159679428f},
-std::array<float,2>{0.643383622f, 0.57219249f},
-std::array<float,2>{0.334420055f, 0.635273397f},
-std::array<float,2>{0.555570722f, 0.0890640318f},
-std::array<float,2>{0.0280196518f, 0.397951156f},
-std::array<float,2>{0.761292398f, 0.836000979f},
-std::array<float,2>{0.0941400602f, 0.523861349f},
-std::array<float,2>{0.866928339f, 0.191753119f},
-std::array<float,2>{0.264118165f, 0.258416712f},
-std::array<float,2>{0.624790251f, 0.977210641f},
-std::array<float,2>{0.47525847f, 0.797384918f},
-std::array<float,2>{0.732306004f, 0.442364007f},
-std::array<float,2>{0.140567571f, 0.0226317458f},
-std::array<float,2>{0.961627662f, 0.689462364f},
-std::array<float,2>{0.0541102104f, 0.872129083f},
-std::array<float,2>{0.792051077f, 0.410269797f},
-std::array<float,2>{0.344006717f, 0.106424965f},
-std::array<float,2>{0.528653979f, 0.674503684f},
-std::array<float,2>{0.396677643f, 0.621069372f},
-std::array<float,2>{0.660478234f, 0.155708402f},
-std::array<float,2>{0.247838363f, 0.327873409f},
-std::array<float,2>{0.928921938f, 0.882918894f},
-std::array<float,2>{0.162852839f, 0.733488262f},
-std::array<float,2>{0.984055817f, 0.0534229316f},
-std::array<float,2>{0.458384782f, 0.498519123f},
-std::array<float,2>{0.708850563f, 0.777723789f},
-std::array<float,2>{0.288873523f, 0.953657389f},
-std::array<float,2>{0.566405714f, 0.286327899f},
-std::array<float,2>{0.0874621645f, 0.22663337f},
-std::array<float,2>{0.828359425f, 0.549036443f},
-std::array<float,2>{0.239522517f, 0.835849762f},
-std::array<float,2>{0.931795955f, 0.403694063f},
-std::array<float,2>{0.404656172f, 0.0829691738f},
-std::array<float,2>{0.668250561f, 0.632707477f},
-std::array<float,2>{0.356171936f, 0.568878055f},
-std::array<float,2>{0.518286407f, 0.170584083f},
-std::array<float,2>{0.0609156303f, 0.356642157f},
-std::array<float,2>{0.787905455f, 0.916646302f},
-std::array<float,2>{0.0807189494f, 0.701388955f},
-std::array<float,2>{0.842459381f, 0.0247801095f},
-std::array<float,2>{0.292287856f, 0.447559953f},
-std::array<float,2>{0.575037777f, 0.809929967f},
-std::array<float,2>{0.461484581f, 0.971924126f},
-std::array<float,2>{0.71774435f, 0.252963632f},
-std::array<float,2>{0.166587025f, 0.196371675f},
-std::array<float,2>{0.976262093f, 0.520110548f},
-std::array<float,2>{0.020229714f, 0.877540708f},
-std::array<float,2>{0.752291441f, 0.312975943f},
-std::array<float,2>{0.343454421f, 0.147874445f},
-std::array<float,2>{0.547245026f, 0.613651693f},
-std::array<float,2>{0.416153669f, 0.685004056f},
-std::array<float,2>{0.654724002f, 0.100140132f},
-std::array<float,2>{0.211920246f, 0.420832515f},
-std::array<float,2>{0.906162024f, 0.861273408f},
-std::array<float,2>{0.128878653f, 0.561799765f},
-std::array<float,2>{0.95328778f, 0.221778378f},
-std::array<float,2>{0.482552856f, 0.29001087f},
-std::array<float,2>{0.721908987f, 0.962167442f},
-std::array<float,2>{0.255968302f, 0.769597411f},
-std::array<float,2>{0.610391378f, 0.492177069f},
-std::array<float,2>{0.107475057f, 0.0599753745f},
-std::array<float,2>{0.87348032f, 0.725892723f},
-std::array<float,2>{0.182735935f, 0.951959133f},
-std::array<float,2>{0.996578991f, 0.307730526f},
-std::array<float,2>{0.449228227f, 0.24616982f},
-std::array<float,2>{0.687557518f, 0.533631384f},
-std::array<float,2>{0.306703418f, 0.734487712f},
-std::array<float,2>{0.58441335f, 0.0381217152f},
-std::array<float,2>{0.0687801465f, 0.480084777f},
-std::array<float,2>{0.820459127f, 0.759450793f},
-std::array<float,2>{0.0394242816f, 0.608513832f},
-std::array<float,2>{0.79974407f, 0.131470785f},
-std::array<float,2>{0.373463541f, 0.337890178f},
-std::array<float,2>{0.513842225f, 0.894093037f},
-std::array<float,2>{0.377806813f, 0.848305285f},
-std::array<float,2>{0.681821704f, 0.425770462f},
-std::array<float,2>{0.229014069f, 0.123743892f},
-std::array<float,2>{0.92152077f, 0.656880081f},
-std::array<float,2>{0.121979974f, 0.794592261f},
-std::array<float,2>{0.852664173f, 0.465634495f},
-std::array<float,2>{0.266262412f, 0.00820448343f},
-std::array<float,2>{0.606661081f, 0.710463345f},
-std::array<float,2>{0.49471432f, 0.501403391f},
-std::array<float,2>{0.742134213f, 0.211652473f},
-std::array<float,2>{0.150751621f, 0.28095305f},
-std::array<float,2>{0.948106885f, 0.993879378f},
-std::array<float,2>{0.193377167f, 0.642221868f},
-std::array<float,2>{0.88963753f, 0.0662093833f},
-std::array<float,2>{0.426277727f, 0.38555038f},
-std::array<float,2>{0.637256086f, 0.825794339f},
-std::array<float,2>{0.31285271f, 0.929924488f},
-std::array<float,2>{0.539618194f, 0.363496214f},
-std::array<float,2>{0.00880754273f, 0.181838214f},
-std::array<float,2>{0.770417094f, 0.587266803f},
-std::array<float,2>{0.223134428f, 0.766503811f},
-std::array<float,2>{0.911547363f, 0.487366706f},
-std::array<float,2>{0.384046048f, 0.0559265539f},
-std::array<float,2>{0.675191879f, 0.719031274f},
-std::array<float,2>{0.366276801f, 0.556231916f},
-std::array<float,2>{0.502609432f, 0.223760396f},
-std::array<float,2>{0.0377707779f, 0.295954019f},
-std::array<float,2>{0.812451184f, 0.966258824f},
-std::array<float,2>{0.0770428032f, 0.682538509f},
-std::array<float,2>{0.819213212f, 0.0974562764f},
-std::array<float,2>{0.298777431f, 0.417443961f},
-std::array<float,2>{0.593560278f, 0.867174983f},
-std::array<float,2>{0.442609251f, 0.880479276f},
-std::array<float,2>{0.697420239f, 0.319039464f},
-std::array<float,2>{0.172542378f, 0.143604413f},
-std::array<float,2>{0.988324225f, 0.612501025f},
-std::array<float,2>{0.00298053771f, 0.972959816f},
-std::array<float,2>{0.776791215f, 0.256206632f},
-std::array<float,2>{0.325489819f, 0.20281592f},
-std::array<float,2>{0.533073127f, 0.516618729f},
-std::array<float,2>{0.429921329f, 0.697554886f},
-std::array<float,2>{0.63136977f, 0.0277226642f},
-std::array<float,2>{0.199444935f, 0.451642126f},
-std::array<float,2>{0.876955152f, 0.806008816f},
-std::array<float,2>{0.141569883f, 0.564504862f},
-std::array<float,2>{0.942170382f, 0.166301817f},
-std::array<float,2>{0.485250443f, 0.352184027f},
-std::array<float,2>{0.748640716f, 0.918861449f},
-std::array<float,2>{0.280235857f, 0.828924298f},
-std::array<float,2>{0.596963227f, 0.398584783f},
-std::array<float,2>{0.112747967f, 0.0810412094f},
-std::array<float,2>{0.845345855f, 0.62764746f},
-std::array<float,2>{0.157539159f, 0.937461853f},
-std::array<float,2>{0.978064418f, 0.359821618f},
-std::array<float,2>{0.454420239f, 0.186413839f},
-std::array<float,2>{0.70491004f, 0.592856467f},
-std::array<float,2>{0.28199771f, 0.648309529f},
-std::array<float,2>{0.567566216f, 0.0695998371f},
-std::array<float,2>{0.0909926146f, 0.38770467f},
-std::array<float,2>{0.835735917f, 0.820787549f},
-std::array<float,2>{0.0507421568f, 0.505112886f},
-std::array<float,2>{0.79411155f, 0.215759486f},
-std::array<float,2>{0.348520547f, 0.277341932f},
-std::array<float,2>{0.526705027f, 0.997133255f},
-std::array<float,2>{0.39327386f, 0.79246223f},
-std::array<float,2>{0.657789111f, 0.464119524f},
-std::array<float,2>{0.245516941f, 0.0142087052f},
-std::array<float,2>{0.922397614f, 0.705926597f},
-std::array<float,2>{0.0983605161f, 0.845115662f},
-std::array<float,2>{0.859941065f, 0.427716881f},
-std::array<float,2>{0.25973466f, 0.121031933f},
-std::array<float,2>{0.617760003f, 0.660704851f},
-std::array<float,2>{0.469832122f, 0.603597105f},
-std::array<float,2>{0.726564467f, 0.127469733f},
-std::array<float,2>{0.134691983f, 0.343558967f},
-std::array<float,2>{0.96536231f, 0.898241162f},
-std::array<float,2>{0.21061869f, 0.73908478f},
-std::array<float,2>{0.89577347f, 0.0318447687f},
-std::array<float,2>{0.411733836f, 0.483834267f},
-std::array<float,2>{0.647595763f, 0.762981892f},
-std::array<float,2>{0.329158008f, 0.947752237f},
-std::array<float,2>{0.558678031f, 0.310040534f},
-std::array<float,2>{0.0247832388f, 0.244761795f},
-std::array<float,2>{0.763283491f, 0.536985815f},
-std::array<float,2>{0.131003186f, 0.820013165f},
-std::array<float,2>{0.958791375f, 0.379933029f},
-std::array<float,2>{0.477772117f, 0.0721022561f},
-std::array<float,2>{0.725761175f, 0.648460567f},
-std::array<float,2>{0.253802359f, 0.579393983f},
-std::array<float,2>{0.616227686f, 0.179094166f},
-std::array<float,2>{0.104621485f, 0.374800414f},
-std::array<float,2>{0.869916797f, 0.923104405f},
-std::array<float,2>{0.0164372437f, 0.717200279f},
-std::array<float,2>{0.756333888f, 0.00775466161f},
-std::array<float,2>{0.338665277f, 0.460522771f},
-std::array<float,2>{0.55452466f, 0.787351608f},
-std::array<float,2>{0.421504557f, 0.990158021f},
-std::array<float,2>{0.649276972f, 0.270763218f},
-std::array<float,2>{0.21615766f, 0.207985744f},
-std::array<float,2>{0.899415553f, 0.510621011f},
-std::array<float,2>{0.0849904567f, 0.899250865f},
-std::array<float,2>{0.837127388f, 0.335565984f},
-std::array<float,2>{0.295085788f, 0.13440153f},
-std::array<float,2>{0.572642624f, 0.598115504f},
-std::array<float,2>{0.467656046f, 0.670253456f},
-std::array<float,2>{0.712075412f, 0.115091324f},
-std::array<float,2>{0.168099046f, 0.435613841f},
-std::array<float,2>{0.970852673f, 0.852572024f},
-std::array<float,2>{0.235408455f, 0.541968644f},
-std::array<float,2>{0.937042475f, 0.238246232f},
-std::array<float,2>{0.398479193f, 0.302555531f},
-std::array<float,2>{0.664539874f, 0.938923895f},
-std::array<float,2>{0.352072388f, 0.750891745f},
-std::array<float,2>{0.522714436f, 0.472231746f},
-std::array<float,2>{0.0559801832f, 0.0392467454f},
-std::array<float,2>{0.783771634f, 0.74810195f},
-std::array<float,2>{0.190052956f, 0.960671782f},
-std::array<float,2>{0.884957671f, 0.282474041f},
-std::array<float,2>{0.425564378f, 0.232821822f},
-std::array<float,2>{0.636684239f, 0.553361177f},
-std::array<float,2>{0.320291936f, 0.729611456f},
-std::array<float,2>{0.544472158f, 0.0498114862f},
-std::array<float,2>{0.0137195764f, 0.492665797f},
-std::array<float,2>{0.766591191f, 0.774771154f},
-std::array<float,2>{0.11753089f, 0.62364018f},
-std::array<float,2>{0.857410789f, 0.150312707f},
-std::array<float,2>{0.26978907f, 0.322707295f},
-std::array<float,2>{0.603550017f, 0.890535533f},
-std::array<float,2>{0.499896735f, 0.867486119f},
-std::array<float,2>{0.734485924f, 0.409912229f},
-std::array<float,2>{0.154267624f, 0.104003705f},
-std::array<float,2>{0.949763834f, 0.677213669f},
-std::array<float,2>{0.0434918739f, 0.803904891f},
-std::array<float,2>{0.803522229f, 0.440646142f},
-std::array<float,2>{0.367847472f, 0.0180227607f},
-std::array<float,2>{0.50908196f, 0.692543149f},
-std::array<float,2>{0.379155576f, 0.529652953f},
-std::array<float,2>{0.683695018f, 0.189615101f},
-std::array<float,2>{0.231887057f, 0.264471322f},
-std::array<float,2>{0.915603459f, 0.982957184f},
-std::array<float,2>{0.185486779f, 0.637214601f},
-std::array<float,2>{0.993927062f, 0.0936525241f},
-std::array<float,2>{0.446838826f, 0.391436279f},
-std::array<float,2>{0.69378531f, 0.840453625f},
-std::array<float,2>{0.3103818f, 0.908322453f},
-std::array<float,2>{0.579284966f, 0.346271038f},
-std::array<float,2>{0.0633041486f, 0.161476955f},
-std::array<float,2>{0.826340854f, 0.574823558f},
-std::array<float,2>{0.177817822f, 0.785015166f},
-std::array<float,2>{0.986370325f, 0.456098437f},
-std::array<float,2>{0.437687635f, 0.00210276828f},
-std::array<float,2>{0.70165962f, 0.714357674f},
-std::array<float,2>{0.300895542f, 0.512420595f},
-std::array<float,2>{0.588096619f, 0.203522205f},
-std::array<float,2>{0.0731793493f, 0.267445654f},
-std::array<float,2>{0.816396236f, 0.988257229f},
-std::array<float,2>{0.0330714062f, 0.654950261f},
-std::array<float,2>{0.80856967f, 0.0774469376f},
-std::array<float,2>{0.359795779f, 0.377540112f},
-std::array<float,2>{0.505913734f, 0.815156519f},
-std::array<float,2>{0.389441162f, 0.926029682f},
-std::array<float,2>{0.678975403f, 0.369361997f},
-std::array<float,2>{0.222166702f, 0.174592242f},
-std::array<float,2>{0.907728434f, 0.584706962f},
-std::array<float,2>{0.116158798f, 0.944658935f},
-std::array<float,2>{0.848670781f, 0.298359334f},
-std::array<float,2>{0.274980515f, 0.238647312f},
-std::array<float,2>{0.601552069f, 0.546181619f},
-std::array<float,2>{0.491933852f, 0.742387295f},
-std::array<float,2>{0.744950414f, 0.0431281962f},
-std::array<float,2>{0.148017824f, 0.473161161f},
-std::array<float,2>{0.938854933f, 0.75732708f},
-std::array<float,2>{0.196358413f, 0.595569253f},
-std::array<float,2>{0.879805148f, 0.138923809f},
-std::array<float,2>{0.436626166f, 0.329751819f},
-std::array<float,2>{0.627647817f, 0.904459417f},
-std::array<float,2>{0.323184073f, 0.858956158f},
-std::array<float,2>{0.536979973f, 0.432014912f},
-std::array<float,2>{0.00574332988f, 0.109480485f},
-std::array<float,2>{0.781032979f, 0.666259229f},
-std::array<float,2>{0.249504074f, 0.886256635f},
-std::array<float,2>{0.925979853f, 0.324786782f},
-std::array<float,2>{0.396294713f, 0.152483031f},
-std::array<float,2>{0.663841248f, 0.618851423f},
-std::array<float,2>{0.347551376f, 0.673750997f},
-std::array<float,2>{0.529328763f, 0.107572496f},
-std::array<float,2>{0.0511487611f, 0.413297087f},
-std::array<float,2>{0.790895283f, 0.873439789f},
-std::array<float,2>{0.0888842791f, 0.548213303f},
-std::array<float,2>{0.831692994f, 0.228674382f},
-std::array<float,2>{0.285475671f, 0.288553596f},
-std::array<float,2>{0.563930929f, 0.956428409f},
-std::array<float,2>{0.459262073f, 0.780321658f},
-std::array<float,2>{0.709882677f, 0.497819602f},
-std::array<float,2>{0.160277054f, 0.0515633859f},
-std::array<float,2>{0.980986416f, 0.73241806f},
-std::array<float,2>{0.0305581428f, 0.839355409f},
-std::array<float,2>{0.759672225f, 0.395601183f},
-std::array<float,2>{0.333011478f, 0.0862899497f},
-std::array<float,2>{0.557036757f, 0.634006977f},
-std::array<float,2>{0.40840143f, 0.572619796f},
-std::array<float,2>{0.640644789f, 0.156668335f},
-std::array<float,2>{0.206295311f, 0.350239694f},
-std::array<float,2>{0.893915176f, 0.912163198f},
-std::array<float,2>{0.137773916f, 0.687777996f},
-std::array<float,2>{0.963909924f, 0.0208017938f},
-std::array<float,2>{0.473715305f, 0.443400592f},
-std::array<float,2>{0.73429358f, 0.799999118f},
-std::array<float,2>{0.26288715f, 0.979604959f},
-std::array<float,2>{0.621186078f, 0.260237545f},
-std::array<float,2>{0.09626811f, 0.194002375f},
-std::array<float,2>{0.865163565f, 0.526000798f},
-std::array<float,2>{0.213748753f, 0.863197684f},
-std::array<float,2>{0.902366459f, 0.418930233f},
-std::array<float,2>{0.414209127f, 0.0987773612f},
-std::array<float,2>{0.653636336f, 0.686255813f},
-std::array<float,2>{0.340685815f, 0.615935922f},
-std::array<float,2>{0.550462902f, 0.145400271f},
-std::array<float,2>{0.021613773f, 0.316241175f},
-std::array<float,2>{0.751857638f, 0.875388265f},
-std::array<float,2>{0.106897101f, 0.723749161f},
-std::array<float,2>{0.871965408f, 0.0611979999f},
-std::array<float,2>{0.255305171f, 0.489567846f},
-std::array<float,2>{0.612870336f, 0.772470117f},
-std::array<float,2>{0.481629461f, 0.964573085f},
-std::array<float,2>{0.719119608f, 0.292063683f},
-std::array<float,2>{0.1266976f, 0.220188335f},
-std::array<float,2>{0.95549947f, 0.558769166f},
-std::array<float,2>{0.0601066798f, 0.914486527f},
-std::array<float,2>{0.785989225f, 0.357688278f},
-std::array<float,2>{0.358131438f, 0.168628007f},
-std::array<float,2>{0.515702128f, 0.566818416f},
-std::array<float,2>{0.40363121f, 0.62994653f},
-std::array<float,2>{0.670352697f, 0.0846907198f},
-std::array<float,2>{0.241784766f, 0.405492455f},
-std::array<float,2>{0.930478275f, 0.833061457f},
-std::array<float,2>{0.165296197f, 0.522349596f},
-std::array<float,2>{0.974467039f, 0.198926002f},
-std::array<float,2>{0.463847339f, 0.251862943f},
-std::array<float,2>{0.715129733f, 0.970655978f},
-std::array<float,2>{0.290237159f, 0.811172068f},
-std::array<float,2>{0.576874375f, 0.446089506f},
-std::array<float,2>{0.0791279525f, 0.026907919f},
-std::array<float,2>{0.840908647f, 0.699965715f},
-std::array<float,2>{0.149049774f, 0.994614482f},
-std::array<float,2>{0.946236372f, 0.278651804f},
-std::array<float,2>{0.492708921f, 0.213375241f},
-std::array<float,2>{0.738320231f, 0.503548682f},
-std::array<float,2>{0.269198924f, 0.707402229f},
-std::array<float,2>{0.60747844f, 0.0111016389f},
-std::array<float,2>{0.124437258f, 0.468715817f},
-std::array<float,2>{0.854457021f, 0.796643734f},
-std::array<float,2>{0.0106673902f, 0.589558423f},
-std::array<float,2>{0.772653222f, 0.18128565f},
-std::array<float,2>{0.315283209f, 0.365244895f},
-std::array<float,2>{0.541746259f, 0.932846725f},
-std::array<float,2>{0.429310143f, 0.826559007f},
-std::array<float,2>{0.639841378f, 0.383536339f},
-std::array<float,2>{0.191876575f, 0.0626637936f},
-std::array<float,2>{0.88827908f, 0.644284487f},
-std::array<float,2>{0.066816628f, 0.761556506f},
-std::array<float,2>{0.823207855f, 0.477588624f},
-std::array<float,2>{0.304787636f, 0.0353983007f},
-std::array<float,2>{0.582152009f, 0.737504184f},
-std::array<float,2>{0.451616526f, 0.532044709f},
-std::array<float,2>{0.689678013f, 0.248594359f},
-std::array<float,2>{0.179717764f, 0.30578652f},
-std::array<float,2>{0.99893105f, 0.950005233f},
-std::array<float,2>{0.2280467f, 0.660135925f},
-std::array<float,2>{0.918871462f, 0.121588677f},
-std::array<float,2>{0.376716763f, 0.422900766f},
-std::array<float,2>{0.681602478f, 0.850607634f},
-std::array<float,2>{0.372656345f, 0.891694784f},
-std::array<float,2>{0.511719167f, 0.339514881f},
-std::array<float,2>{0.0411529914f, 0.129382297f},
-std::array<float,2>{0.798539102f, 0.605762422f},
-std::array<float,2>{0.24415417f, 0.790911853f},
-std::array<float,2>{0.923768997f, 0.462571979f},
-std::array<float,2>{0.393703192f, 0.0135479895f},
-std::array<float,2>{0.656395853f, 0.704690695f},
-std::array<float,2>{0.348691434f, 0.506830692f},
-std::array<float,2>{0.525560379f, 0.217189521f},
-std::array<float,2>{0.049730327f, 0.274588466f},
-std::array<float,2>{0.793924332f, 0.99920857f},
-std::array<float,2>{0.0900958478f, 0.646298468f},
-std::array<float,2>{0.834506094f, 0.0676521659f},
-std::array<float,2>{0.283156186f, 0.388777137f},
-std::array<float,2>{0.566526413f, 0.822380364f},
-std::array<float,2>{0.453623891f, 0.934166968f},
-std::array<float,2>{0.703460574f, 0.361824632f},
-std::array<float,2>{0.156966195f, 0.183717445f},
-std::array<float,2>{0.977455676f, 0.591079414f},
-std::array<float,2>{0.0240157899f, 0.946996331f},
-std::array<float,2>{0.761881351f, 0.311942965f},
-std::array<float,2>{0.329083502f, 0.243094727f},
-std::array<float,2>{0.559633732f, 0.537775755f},
-std::array<float,2>{0.410577178f, 0.741278112f},
-std::array<float,2>{0.647192717f, 0.0341331027f},
-std::array<float,2>{0.209455356f, 0.481589556f},
-std::array<float,2>{0.895080864f, 0.765519381f},
-std::array<float,2>{0.133393317f, 0.602903724f},
-std::array<float,2>{0.966545463f, 0.125375673f},
-std::array<float,2>{0.46891433f, 0.341671497f},
-std::array<float,2>{0.728232503f, 0.895792782f},
-std::array<float,2>{0.258210272f, 0.846737564f},
-std::array<float,2>{0.618228436f, 0.429499149f},
-std::array<float,2>{0.0994983986f, 0.118324317f},
-std::array<float,2>{0.860508025f, 0.663159311f},
-std::array<float,2>{0.172956556f, 0.882143736f},
-std::array<float,2>{0.9897542f, 0.318220973f},
-std::array<float,2>{0.442355424f, 0.141956553f},
-std::array<float,2>{0.698967099f, 0.611018717f},
-std::array<float,2>{0.297682852f, 0.681242764f},
-std::array<float,2>{0.592017233f, 0.0938040316f},
-std::array<float,2>{0.0773189664f, 0.414396882f},
-std::array<float,2>{0.819572806f, 0.865136623f},
-std::array<float,2>{0.0388461277f, 0.557267368f},
-std::array<float,2>{0.811024785f, 0.224933505f},
-std::array<float,2>{0.366194755f, 0.293393284f},
-std::array<float,2>{0.503851354f, 0.968198836f},
-std::array<float,2>{0.382909715f, 0.76788038f},
-std::array<float,2>{0.674614906f, 0.485964119f},
-std::array<float,2>{0.224313453f, 0.0583372749f},
-std::array<float,2>{0.910631061f, 0.720720708f},
-std::array<float,2>{0.111525938f, 0.831539035f},
-std::array<float,2>{0.844446182f, 0.402164549f},
-std::array<float,2>{0.280980349f, 0.0784317926f},
-std::array<float,2>{0.596395314f, 0.626024365f},
-std::array<float,2>{0.485649318f, 0.56328851f},
-std::array<float,2>{0.749282777f, 0.165743262f},
-std::array<float,2>{0.14224124f, 0.35427475f},
-std::array<float,2>{0.942675114f, 0.920891702f},
-std::array<float,2>{0.200520724f, 0.69534111f},
-std::array<float,2>{0.87861383f, 0.0294818487f},
-std::array<float,2>{0.431405723f, 0.451017678f},
-std::array<float,2>{0.632674158f, 0.808463812f},
-std::array<float,2>{0.324291259f, 0.975340784f},
-std::array<float,2>{0.532118559f, 0.255490631f},
-std::array<float,2>{0.00272490131f, 0.200134918f},
-std::array<float,2>{0.776358306f, 0.519314647f},
-std::array<float,2>{0.152689844f, 0.869639933f},
-std::array<float,2>{0.95064187f, 0.407031f},
-std::array<float,2>{0.498640627f, 0.102659307f},
-std::array<float,2>{0.736133337f, 0.678500772f},
-std::array<float,2>{0.271423817f, 0.621875644f},
-std::array<float,2>{0.60538137f, 0.152165085f},
-std::array<float,2>{0.11868988f, 0.321008414f},
-std::array<float,2>{0.856392384f, 0.887137473f},
-std::array<float,2>{0.0151725635f, 0.728122234f},
-std::array<float,2>{0.767281115f, 0.0473925658f},
-std::array<float,2>{0.31853494f, 0.494816095f},
-std::array<float,2>{0.543216109f, 0.775592268f},
-std::array<float,2>{0.424252391f, 0.958442926f},
-std::array<float,2>{0.635236323f, 0.284131885f},
-std::array<float,2>{0.190862656f, 0.230710164f},
-std::array<float,2>{0.8865242f, 0.551534534f},
-std::array<float,2>{0.0643180832f, 0.907120764f},
-std::array<float,2>{0.827783167f, 0.344456494f},
-std::array<float,2>{0.309214503f, 0.162259832f},
-std::array<float,2>{0.578501761f, 0.576363623f},
-std::array<float,2>{0.445364714f, 0.640192151f},
-std::array<float,2>{0.695006669f, 0.0911177844f},
-std::array<float,2>{0.183863461f, 0.394039869f},
-std::array<float,2>{0.992227077f, 0.843371212f},
-std::array<float,2>{0.231223732f, 0.528737545f},
-std::array<float,2>{0.914931715f, 0.189446017f},
-std::array<float,2>{0.380813569f, 0.26276356f},
-std::array<float,2>{0.685030878f, 0.980692387f},
-std::array<float,2>{0.369056195f, 0.802013993f},
-std::array<float,2>{0.50818181f, 0.437959909f},
-std::array<float,2>{0.0444101058f, 0.0175074656f},
-std::array<float,2>{0.804020703f, 0.69461745f},
-std::array<float,2>{0.215218201f, 0.991787612f},
-std::array<float,2>{0.898881257f, 0.271714598f},
-std::array<float,2>{0.42001605f, 0.209953055f},
-std::array<float,2>{0.6502918f, 0.508359969f},
-std::array<float,2>{0.339254588f, 0.716095328f},
-std::array<float,2>{0.55306077f, 0.00532352319f},
-std::array<float,2>{0.0172413029f, 0.458659649f},
-std::array<float,2>{0.75778389f, 0.786059141f},
-std::array<float,2>{0.104473464f, 0.581099629f},
-std::array<float,2>{0.870201886f, 0.175957039f},
-std::array<float,2>{0.252229691f, 0.372369796f},
-std::array<float,2>{0.615653276f, 0.924016476f},
-std::array<float,2>{0.477056175f, 0.818195879f},
-std::array<float,2>{0.724725008f, 0.381030709f},
-std::array<float,2>{0.132152051f, 0.0730941892f},
-std::array<float,2>{0.95752281f, 0.651942432f},
-std::array<float,2>{0.0550715216f, 0.753356218f},
-std::array<float,2>{0.784355402f, 0.469186038f},
-std::array<float,2>{0.352870822f, 0.0420002639f},
-std::array<float,2>{0.521721363f, 0.747179925f},
-std::array<float,2>{0.399498165f, 0.539354026f},
-std::array<float,2>{0.66581136f, 0.235171765f},
-std::array<float,2>{0.234739795f, 0.303067386f},
-std::array<float,2>{0.93616575f, 0.939801455f},
-std::array<float,2>{0.169117227f, 0.669825554f},
-std::array<float,2>{0.97219193f, 0.116471641f},
-std::array<float,2>{0.467951357f, 0.435081035f},
-std::array<float,2>{0.711472988f, 0.855147123f},
-std::array<float,2>{0.29672721f, 0.900824189f},
-std::array<float,2>{0.573600709f, 0.332315713f},
-std::array<float,2>{0.084035553f, 0.135000363f},
-std::array<float,2>{0.836489737f, 0.599684775f},
-std::array<float,2>{0.161928907f, 0.778990269f},
-std::array<float,2>{0.982205033f, 0.499980062f},
-std::array<float,2>{0.460684001f, 0.0542725176f},
-std::array<float,2>{0.710768342f, 0.733355701f},
-std::array<float,2>{0.287064016f, 0.550006807f},
-std::array<float,2>{0.562582493f, 0.227891877f},
-std::array<float,2>{0.0886208564f, 0.285446793f},
-std::array<float,2>{0.830722868f, 0.954555273f},
-std::array<float,2>{0.0523296371f, 0.675775766f},
-std::array<float,2>{0.789232492f, 0.107334062f},
-std::array<float,2>{0.346635371f, 0.41159445f},
-std::array<float,2>{0.530412674f, 0.871922433f},
-std::array<float,2>{0.394860029f, 0.88448137f},
-std::array<float,2>{0.663043082f, 0.326598138f},
-std::array<float,2>{0.248666048f, 0.154580995f},
-std::array<float,2>{0.927322626f, 0.619810283f},
-std::array<float,2>{0.0970687792f, 0.978505433f},
-std::array<float,2>{0.864219606f, 0.259297967f},
-std::array<float,2>{0.26225546f, 0.193208128f},
-std::array<float,2>{0.622070789f, 0.524487793f},
-std::array<float,2>{0.473598331f, 0.691336334f},
-std::array<float,2>{0.733374834f, 0.0216291081f},
-std::array<float,2>{0.13691701f, 0.443093836f},
-std::array<float,2>{0.963003039f, 0.798561275f},
-std::array<float,2>{0.205614448f, 0.570455313f},
-std::array<float,2>{0.892860293f, 0.158862188f},
-std::array<float,2>{0.409968048f, 0.347862452f},
-std::array<float,2>{0.642394006f, 0.910274327f},
-std::array<float,2>{0.332776845f, 0.83691895f},
-std::array<float,2>{0.557809234f, 0.397421479f},
-std::array<float,2>{0.0296114571f, 0.0883975253f},
-std::array<float,2>{0.758356988f, 0.635776937f},
-std::array<float,2>{0.221086517f, 0.928235769f},
-std::array<float,2>{0.906606615f, 0.368681729f},
-std::array<float,2>{0.390363663f, 0.173313856f},
-std::array<float,2>{0.678156197f, 0.583384514f},
-std::array<float,2>{0.360453486f, 0.652796626f},
-std::array<float,2>{0.507573426f, 0.0752740502f},
-std::array<float,2>{0.0317248739f, 0.375261903f},
-std::array<float,2>{0.806997895f, 0.813834667f},
-std::array<float,2>{0.0738085881f, 0.514160931f},
-std::array<float,2>{0.814465225f, 0.205723912f},
-std::array<float,2>{0.301790535f, 0.268640608f},
-std::array<float,2>{0.58953917f, 0.985503793f},
-std::array<float,2>{0.438507259f, 0.781686544f},
-std::array<float,2>{0.702883303f, 0.45459038f},
-std::array<float,2>{0.179259285f, 0.000870031945f},
-std::array<float,2>{0.987568796f, 0.712751687f},
-std::array<float,2>{0.00410259748f, 0.856801689f},
-std::array<float,2>{0.78005141f, 0.429727465f},
-std::array<float,2>{0.323372513f, 0.113139458f},
-std::array<float,2>{0.535292864f, 0.665761411f},
-std::array<float,2>{0.435594261f, 0.59739852f},
-std::array<float,2>{0.628604233f, 0.137187004f},
-std::array<float,2>{0.196259782f, 0.331878513f},
-std::array<float,2>{0.880283594f, 0.90366292f},
-std::array<float,2>{0.147415727f, 0.744174659f},
-std::array<float,2>{0.937660694f, 0.0464154668f},
-std::array<float,2>{0.491115063f, 0.476312578f},
-std::array<float,2>{0.745308459f, 0.754279256f},
-std::array<float,2>{0.274298459f, 0.942866623f},
-std::array<float,2>{0.600551367f, 0.300203502f},
-std::array<float,2>{0.117024787f, 0.241502494f},
-std::array<float,2>{0.84794575f, 0.544733822f},
-std::array<float,2>{0.192596555f, 0.824309528f},
-std::array<float,2>{0.887383103f, 0.38610667f},
-std::array<float,2>{0.428049445f, 0.0646702871f},
-std::array<float,2>{0.638770342f, 0.641588748f},
-std::array<float,2>{0.315824747f, 0.586591423f},
-std::array<float,2>{0.542393982f, 0.182671353f},
-std::array<float,2>{0.0115738288f, 0.36473015f},
-std::array<float,2>{0.77232641f, 0.931043029f},
-std::array<float,2>{0.123733997f, 0.709917307f},
-std::array<float,2>{0.854699492f, 0.00917866267f},
-std::array<float,2>{0.267752767f, 0.466109544f},
-std::array<float,2>{0.60923183f, 0.793690801f},
-std::array<float,2>{0.493410975f, 0.99241519f},
-std::array<float,2>{0.739634335f, 0.279773563f},
-std::array<float,2>{0.149754509f, 0.212546989f},
-std::array<float,2>{0.947097778f, 0.500582814f},
-std::array<float,2>{0.042588722f, 0.893414438f},
-std::array<float,2>{0.797576249f, 0.336025894f},
-std::array<float,2>{0.371837318f, 0.132429868f},
-std::array<float,2>{0.513623714f, 0.60745734f},
-std::array<float,2>{0.375571936f, 0.657763481f},
-std::array<float,2>{0.68034029f, 0.124617182f},
-std::array<float,2>{0.227147698f, 0.424170285f},
-std::array<float,2>{0.919135451f, 0.849291265f},
-std::array<float,2>{0.181577131f, 0.534828126f},
-std::array<float,2>{0.999066472f, 0.247564927f},
-std::array<float,2>{0.453081965f, 0.306686103f},
-std::array<float,2>{0.691039503f, 0.952306747f},
-std::array<float,2>{0.306388259f, 0.75837779f},
-std::array<float,2>{0.583108604f, 0.478552133f},
-std::array<float,2>{0.0681753457f, 0.0376886353f},
-std::array<float,2>{0.823397279f, 0.73621726f},
-std::array<float,2>{0.125708729f, 0.961606026f},
-std::array<float,2>{0.956606567f, 0.290098608f},
-std::array<float,2>{0.481358916f, 0.221386045f},
-std::array<float,2>{0.719746292f, 0.561479211f},
-std::array<float,2>{0.254798949f, 0.725437999f},
-std::array<float,2>{0.611382484f, 0.0590866059f},
-std::array<float,2>{0.106342025f, 0.490966678f},
-std::array<float,2>{0.872253358f, 0.771214604f},
-std::array<float,2>{0.0227199346f, 0.614742219f},
-std::array<float,2>{0.750314474f, 0.14677529f},
-std::array<float,2>{0.340987116f, 0.31436497f},
-std::array<float,2>{0.549696505f, 0.878609002f},
-std::array<float,2>{0.415121317f, 0.860282898f},
-std::array<float,2>{0.652554095f, 0.42148453f},
-std::array<float,2>{0.214167207f, 0.10112647f},
-std::array<float,2>{0.903942585f, 0.684412301f},
-std::array<float,2>{0.0787425861f, 0.808730185f},
-std::array<float,2>{0.840689957f, 0.449065953f},
-std::array<float,2>{0.289217204f, 0.0237035472f},
-std::array<float,2>{0.577736616f, 0.70247823f},
-std::array<float,2>{0.46393609f, 0.520588577f},
-std::array<float,2>{0.716114759f, 0.195759252f},
-std::array<float,2>{0.164131194f, 0.252294093f},
-std::array<float,2>{0.972805977f, 0.970896125f},
-std::array<float,2>{0.240895241f, 0.631105185f},
-std::array<float,2>{0.931143761f, 0.0836687461f},
-std::array<float,2>{0.402662724f, 0.403297871f},
-std::array<float,2>{0.671705365f, 0.834314823f},
-std::array<float,2>{0.35869205f, 0.917050838f},
-std::array<float,2>{0.517201364f, 0.355955154f},
-std::array<float,2>{0.059402246f, 0.171192139f},
-std::array<float,2>{0.786597133f, 0.569400668f},
-std::array<float,2>{0.207317784f, 0.762495697f},
-std::array<float,2>{0.898030281f, 0.482604593f},
-std::array<float,2>{0.412439317f, 0.0328300484f},
-std::array<float,2>{0.645395637f, 0.739720404f},
-std::array<float,2>{0.330419213f, 0.536047637f},
-std::array<float,2>{0.560827613f, 0.246092349f},
-std::array<float,2>{0.0255072471f, 0.308729857f},
-std::array<float,2>{0.765294135f, 0.949188232f},
-std::array<float,2>{0.101234987f, 0.661343277f},
-std::array<float,2>{0.862964809f, 0.119696692f},
-std::array<float,2>{0.260989636f, 0.426698238f},
-std::array<float,2>{0.619226754f, 0.844056129f},
-std::array<float,2>{0.471185416f, 0.897005558f},
-std::array<float,2>{0.729085565f, 0.342323393f},
-std::array<float,2>{0.135697454f, 0.1288919f},
-std::array<float,2>{0.968003392f, 0.605374873f},
-std::array<float,2>{0.047064282f, 0.996887743f},
-std::array<float,2>{0.795451701f, 0.276276171f},
-std::array<float,2>{0.351146132f, 0.216139406f},
-std::array<float,2>{0.523510158f, 0.504334331f},
-std::array<float,2>{0.391597211f, 0.706070364f},
-std::array<float,2>{0.659072042f, 0.0149621982f},
-std::array<float,2>{0.243769184f, 0.463207781f},
-std::array<float,2>{0.92560184f, 0.791528821f},
-std::array<float,2>{0.15974094f, 0.592104018f},
-std::array<float,2>{0.979769528f, 0.186671153f},
-std::array<float,2>{0.455362767f, 0.361004114f},
-std::array<float,2>{0.705107272f, 0.935598314f},
-std::array<float,2>{0.284463167f, 0.821720779f},
-std::array<float,2>{0.569094241f, 0.387049586f},
-std::array<float,2>{0.0933176428f, 0.068628639f},
-std::array<float,2>{0.832158566f, 0.647350669f},
-std::array<float,2>{0.142600283f, 0.91939038f},
-std::array<float,2>{0.944850087f, 0.353202194f},
-std::array<float,2>{0.487806648f, 0.167491466f},
-std::array<float,2>{0.746729195f, 0.566375911f},
-std::array<float,2>{0.277757585f, 0.62822628f},
-std::array<float,2>{0.595320106f, 0.0817464888f},
-std::array<float,2>{0.110510424f, 0.399491787f},
-std::array<float,2>{0.847481847f, 0.829942584f},
-std::array<float,2>{0.00188485638f, 0.516565442f},
-std::array<float,2>{0.774326682f, 0.202039167f},
-std::array<float,2>{0.326652437f, 0.257709891f},
-std::array<float,2>{0.53436631f, 0.97446698f},
-std::array<float,2>{0.432115823f, 0.805314064f},
-std::array<float,2>{0.629849851f, 0.452685714f},
-std::array<float,2>{0.201717958f, 0.0289293081f},
-std::array<float,2>{0.87615633f, 0.69912827f},
-std::array<float,2>{0.0751917511f, 0.865756154f},
-std::array<float,2>{0.817080259f, 0.41668576f},
-std::array<float,2>{0.299654126f, 0.0964874104f},
-std::array<float,2>{0.590904415f, 0.682970941f},
-std::array<float,2>{0.444426417f, 0.612265944f},
-std::array<float,2>{0.695848167f, 0.14284043f},
-std::array<float,2>{0.175064594f, 0.319363803f},
-std::array<float,2>{0.991755068f, 0.879323483f},
-std::array<float,2>{0.225422606f, 0.720657229f},
-std::array<float,2>{0.912255347f, 0.0552868173f},
-std::array<float,2>{0.386373132f, 0.487218738f},
-std::array<float,2>{0.67296797f, 0.767537653f},
-std::array<float,2>{0.364026099f, 0.965531051f},
-std::array<float,2>{0.500552952f, 0.295425713f},
-std::array<float,2>{0.0353793167f, 0.222895622f},
-std::array<float,2>{0.808798015f, 0.555331171f},
-std::array<float,2>{0.186480716f, 0.841401398f},
-std::array<float,2>{0.995583594f, 0.391845167f},
-std::array<float,2>{0.44736892f, 0.0925283358f},
-std::array<float,2>{0.693188488f, 0.637716293f},
-std::array<float,2>{0.31067276f, 0.575680435f},
-std::array<float,2>{0.58158046f, 0.160550922f},
-std::array<float,2>{0.0654760301f, 0.347172111f},
-std::array<float,2>{0.826150239f, 0.909716189f},
-std::array<float,2>{0.0464162268f, 0.691498935f},
-std::array<float,2>{0.802089334f, 0.0193413701f},
-std::array<float,2>{0.370839983f, 0.439953685f},
-std::array<float,2>{0.511509955f, 0.803648472f},
-std::array<float,2>{0.381975144f, 0.983430862f},
-std::array<float,2>{0.685697973f, 0.265175611f},
-std::array<float,2>{0.232850328f, 0.191316679f},
-std::array<float,2>{0.91705066f, 0.530733705f},
-std::array<float,2>{0.120604597f, 0.889228284f},
-std::array<float,2>{0.858935237f, 0.32367751f},
-std::array<float,2>{0.272160977f, 0.149370536f},
-std::array<float,2>{0.602068424f, 0.624512494f},
-std::array<float,2>{0.497647643f, 0.676745892f},
-std::array<float,2>{0.737011075f, 0.10521163f},
-std::array<float,2>{0.155738205f, 0.408935994f},
-std::array<float,2>{0.953026056f, 0.868835628f},
-std::array<float,2>{0.189109832f, 0.554602444f},
-std::array<float,2>{0.884616137f, 0.233917609f},
-std::array<float,2>{0.422202349f, 0.281615496f},
-std::array<float,2>{0.634451628f, 0.959678292f},
-std::array<float,2>{0.318067551f, 0.773532033f},
-std::array<float,2>{0.546650052f, 0.493704796f},
-std::array<float,2>{0.0118081411f, 0.0490095653f},
-std::array<float,2>{0.768283069f, 0.728571653f},
-std::array<float,2>{0.237988397f, 0.93835777f},
-std::array<float,2>{0.933863044f, 0.301076531f},
-std::array<float,2>{0.402132481f, 0.236442506f},
-std::array<float,2>{0.667867005f, 0.542002916f},
-std::array<float,2>{0.35477066f, 0.749871314f},
-std::array<float,2>{0.521177232f, 0.0402949676f},
-std::array<float,2>{0.0578751266f, 0.470757663f},
-std::array<float,2>{0.781950712f, 0.751832187f},
-std::array<float,2>{0.0831560194f, 0.599317074f},
-std::array<float,2>{0.839422226f, 0.13371706f},
-std::array<float,2>{0.294481814f, 0.334729224f},
-std::array<float,2>{0.571233809f, 0.899571478f},
-std::array<float,2>{0.464934707f, 0.852433264f},
-std::array<float,2>{0.713484049f, 0.437458277f},
-std::array<float,2>{0.170306519f, 0.113515273f},
-std::array<float,2>{0.969376683f, 0.67163527f},
-std::array<float,2>{0.0194815099f, 0.788535655f},
-std::array<float,2>{0.755129457f, 0.459472537f},
-std::array<float,2>{0.337265193f, 0.00664861081f},
-std::array<float,2>{0.552414238f, 0.718388855f},
-std::array<float,2>{0.419850767f, 0.511118472f},
-std::array<float,2>{0.652294457f, 0.208764777f},
-std::array<float,2>{0.217824966f, 0.269877672f},
-std::array<float,2>{0.901017368f, 0.989023924f},
-std::array<float,2>{0.130766764f, 0.649472356f},
-std::array<float,2>{0.959546208f, 0.0709257126f},
-std::array<float,2>{0.478741527f, 0.379165888f},
-std::array<float,2>{0.723358452f, 0.81842649f},
-std::array<float,2>{0.251658648f, 0.922732711f},
-std::array<float,2>{0.614149928f, 0.373411924f},
-std::array<float,2>{0.102895916f, 0.177777171f},
-std::array<float,2>{0.86859709f, 0.578502119f},
-std::array<float,2>{0.138922408f, 0.79898423f},
-std::array<float,2>{0.962170839f, 0.444576383f},
-std::array<float,2>{0.475914598f, 0.019833073f},
-std::array<float,2>{0.731110752f, 0.689258218f},
-std::array<float,2>{0.265429467f, 0.526692986f},
-std::array<float,2>{0.623367667f, 0.194737107f},
-std::array<float,2>{0.0950252041f, 0.261125147f},
-std::array<float,2>{0.865455985f, 0.978690922f},
-std::array<float,2>{0.0289433412f, 0.632840335f},
-std::array<float,2>{0.759924293f, 0.0877433792f},
-std::array<float,2>{0.335217237f, 0.39468804f},
-std::array<float,2>{0.556081414f, 0.838442445f},
-std::array<float,2>{0.406826615f, 0.913297653f},
-std::array<float,2>{0.643787563f, 0.351423979f},
-std::array<float,2>{0.203672722f, 0.157768041f},
-std::array<float,2>{0.892121196f, 0.573925972f},
-std::array<float,2>{0.0868946016f, 0.955813885f},
-std::array<float,2>{0.829750061f, 0.287438005f},
-std::array<float,2>{0.287464738f, 0.229718894f},
-std::array<float,2>{0.565261483f, 0.547070861f},
-std::array<float,2>{0.457697272f, 0.731187761f},
-std::array<float,2>{0.707163811f, 0.0527293347f},
-std::array<float,2>{0.163888738f, 0.496405244f},
-std::array<float,2>{0.983346879f, 0.77968657f},
-std::array<float,2>{0.246575236f, 0.61753428f},
-std::array<float,2>{0.928403616f, 0.154021397f},
-std::array<float,2>{0.397791386f, 0.325788617f},
-std::array<float,2>{0.661167145f, 0.885661542f},
-std::array<float,2>{0.345192134f, 0.874944866f},
-std::array<float,2>{0.527946293f, 0.412150145f},
-std::array<float,2>{0.0535288528f, 0.108872823f},
-std::array<float,2>{0.791978896f, 0.67249006f},
-std::array<float,2>{0.198461697f, 0.905419171f},
-std::array<float,2>{0.881700099f, 0.328210533f},
-std::array<float,2>{0.435400277f, 0.140248224f},
-std::array<float,2>{0.626525402f, 0.593919873f},
-std::array<float,2>{0.32114765f, 0.667011142f},
-std::array<float,2>{0.538149774f, 0.110525526f},
-std::array<float,2>{0.00637401501f, 0.43357867f},
-std::array<float,2>{0.777552843f, 0.857606292f},
-std::array<float,2>{0.113641277f, 0.545322418f},
-std::array<float,2>{0.849843204f, 0.240061522f},
-std::array<float,2>{0.276969761f, 0.297656685f},
-std::array<float,2>{0.5978719f, 0.944067538f},
-std::array<float,2>{0.489626974f, 0.756135404f},
-std::array<float,2>{0.742453814f, 0.474423677f},
-std::array<float,2>{0.145858154f, 0.0440644026f},
-std::array<float,2>{0.940102398f, 0.743671298f},
-std::array<float,2>{0.0346312746f, 0.815779388f},
-std::array<float,2>{0.806454241f, 0.378867745f},
-std::array<float,2>{0.362603128f, 0.0770726278f},
-std::array<float,2>{0.505130708f, 0.655437171f},
-std::array<float,2>{0.387003839f, 0.585743904f},
-std::array<float,2>{0.675961137f, 0.174923435f},
-std::array<float,2>{0.219660297f, 0.370425165f},
-std::array<float,2>{0.909830093f, 0.927729964f},
-std::array<float,2>{0.176216394f, 0.712916791f},
-std::array<float,2>{0.986192048f, 0.00303898682f},
-std::array<float,2>{0.441304386f, 0.455107421f},
-std::array<float,2>{0.699840605f, 0.783393264f},
-std::array<float,2>{0.303349167f, 0.986538231f},
-std::array<float,2>{0.58708334f, 0.266486585f},
-std::array<float,2>{0.0722202435f, 0.204253227f},
-std::array<float,2>{0.814296722f, 0.513131201f},
-std::array<float,2>{0.230040371f, 0.849833727f},
-std::array<float,2>{0.919945359f, 0.422605485f},
-std::array<float,2>{0.37870723f, 0.122590117f},
-std::array<float,2>{0.682930827f, 0.658239663f},
-std::array<float,2>{0.37458092f, 0.606661916f},
-std::array<float,2>{0.514857411f, 0.130644068f},
-std::array<float,2>{0.0408878773f, 0.338469774f},
-std::array<float,2>{0.800087869f, 0.890924454f},
-std::array<float,2>{0.069447957f, 0.736622572f},
-std::array<float,2>{0.821337581f, 0.0370608754f},
-std::array<float,2>{0.308563799f, 0.476654619f},
-std::array<float,2>{0.585169256f, 0.760081351f},
-std::array<float,2>{0.450756371f, 0.950747848f},
-std::array<float,2>{0.688851118f, 0.305323809f},
-std::array<float,2>{0.182090312f, 0.249077544f},
-std::array<float,2>{0.997716367f, 0.532567441f},
-std::array<float,2>{0.00873024575f, 0.932005703f},
-std::array<float,2>{0.770757258f, 0.367156982f},
-std::array<float,2>{0.314367205f, 0.179970041f},
-std::array<float,2>{0.540901482f, 0.588797987f},
-std::array<float,2>{0.427503526f, 0.642960489f},
-std::array<float,2>{0.638597608f, 0.064347066f},
-std::array<float,2>{0.194466189f, 0.383952409f},
-std::array<float,2>{0.88972491f, 0.827778578f},
-std::array<float,2>{0.152289912f, 0.502309263f},
-std::array<float,2>{0.948771298f, 0.214356378f},
-std::array<float,2>{0.495747834f, 0.277780741f},
-std::array<float,2>{0.741124868f, 0.995714962f},
-std::array<float,2>{0.266658127f, 0.795544863f},
-std::array<float,2>{0.606064379f, 0.466813326f},
-std::array<float,2>{0.122476786f, 0.00987111311f},
-std::array<float,2>{0.852425396f, 0.708950937f},
-std::array<float,2>{0.167412326f, 0.969343066f},
-std::array<float,2>{0.974706471f, 0.250285298f},
-std::array<float,2>{0.46210742f, 0.197998077f},
-std::array<float,2>{0.717922986f, 0.523217082f},
-std::array<float,2>{0.291920811f, 0.700689614f},
-std::array<float,2>{0.575635552f, 0.0254651308f},
-std::array<float,2>{0.0813768432f, 0.446659774f},
-std::array<float,2>{0.843473673f, 0.811778784f},
-std::array<float,2>{0.0624935068f, 0.567856908f},
-std::array<float,2>{0.788917303f, 0.16937016f},
-std::array<float,2>{0.357347846f, 0.359263718f},
-std::array<float,2>{0.51918292f, 0.91536355f},
-std::array<float,2>{0.40606454f, 0.832947552f},
-std::array<float,2>{0.669070899f, 0.404603899f},
-std::array<float,2>{0.238539234f, 0.0851992816f},
-std::array<float,2>{0.932956934f, 0.629254818f},
-std::array<float,2>{0.108553469f, 0.772332668f},
-std::array<float,2>{0.874622643f, 0.488768607f},
-std::array<float,2>{0.257484555f, 0.0619158819f},
-std::array<float,2>{0.609874964f, 0.722814262f},
-std::array<float,2>{0.483633757f, 0.560477734f},
-std::array<float,2>{0.721004963f, 0.219418615f},
-std::array<float,2>{0.127763197f, 0.291263074f},
-std::array<float,2>{0.954300463f, 0.963231921f},
-std::array<float,2>{0.21103327f, 0.687024474f},
-std::array<float,2>{0.904606223f, 0.0977305472f},
-std::array<float,2>{0.417446256f, 0.419171542f},
-std::array<float,2>{0.655279696f, 0.862133503f},
-std::array<float,2>{0.342603743f, 0.875993848f},
-std::array<float,2>{0.548736989f, 0.314785749f},
-std::array<float,2>{0.0205272604f, 0.145523295f},
-std::array<float,2>{0.753599405f, 0.616975009f}}
\ No newline at end of file
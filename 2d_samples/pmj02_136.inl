@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0436208695f, 0.378854424f},
-std::array<float,2>{0.603958428f, 0.995582223f},
-std::array<float,2>{0.788218915f, 0.0721480101f},
-std::array<float,2>{0.43791765f, 0.578762412f},
-std::array<float,2>{0.327720463f, 0.220334277f},
-std::array<float,2>{0.990340829f, 0.67503345f},
-std::array<float,2>{0.650927663f, 0.25893259f},
-std::array<float,2>{0.181399137f, 0.857825637f},
-std::array<float,2>{0.200257018f, 0.0425283276f},
-std::array<float,2>{0.730756581f, 0.553962708f},
-std::array<float,2>{0.931243002f, 0.488829762f},
-std::array<float,2>{0.281979531f, 0.926196277f},
-std::array<float,2>{0.396750093f, 0.34583059f},
-std::array<float,2>{0.873336315f, 0.750241578f},
-std::array<float,2>{0.535843551f, 0.136952564f},
-std::array<float,2>{0.123613276f, 0.697708845f},
-std::array<float,2>{0.126914009f, 0.298792243f},
-std::array<float,2>{0.674130082f, 0.843067706f},
-std::array<float,2>{0.941916525f, 0.214866251f},
-std::array<float,2>{0.372416824f, 0.647246182f},
-std::array<float,2>{0.492782801f, 0.103513181f},
-std::array<float,2>{0.751947105f, 0.599322081f},
-std::array<float,2>{0.576301336f, 0.433470339f},
-std::array<float,2>{0.00145036599f, 0.951151669f},
-std::array<float,2>{0.0736897364f, 0.177475199f},
-std::array<float,2>{0.500757396f, 0.736268818f},
-std::array<float,2>{0.838058949f, 0.316582203f},
-std::array<float,2>{0.421760291f, 0.793117285f},
-std::array<float,2>{0.279070199f, 0.459825277f},
-std::array<float,2>{0.89165765f, 0.892421424f},
-std::array<float,2>{0.691826582f, 0.013018663f},
-std::array<float,2>{0.226310194f, 0.523202181f},
-std::array<float,2>{0.240973607f, 0.483695179f},
-std::array<float,2>{0.705199361f, 0.910680652f},
-std::array<float,2>{0.882218838f, 0.0549478084f},
-std::array<float,2>{0.254413426f, 0.533604026f},
-std::array<float,2>{0.427741885f, 0.14097476f},
-std::array<float,2>{0.816669822f, 0.706974447f},
-std::array<float,2>{0.522202671f, 0.359664589f},
-std::array<float,2>{0.0900086761f, 0.767713666f},
-std::array<float,2>{0.0307019334f, 0.0790650249f},
-std::array<float,2>{0.584587038f, 0.562761903f},
-std::array<float,2>{0.775835216f, 0.402214378f},
-std::array<float,2>{0.473857999f, 0.970729828f},
-std::array<float,2>{0.350249171f, 0.266421139f},
-std::array<float,2>{0.96057725f, 0.870711982f},
-std::array<float,2>{0.668068469f, 0.243259579f},
-std::array<float,2>{0.153602436f, 0.663326442f},
-std::array<float,2>{0.0993060917f, 0.33205536f},
-std::array<float,2>{0.550770223f, 0.808574736f},
-std::array<float,2>{0.850352168f, 0.15699473f},
-std::array<float,2>{0.378737837f, 0.72455132f},
-std::array<float,2>{0.303769231f, 0.0168462824f},
-std::array<float,2>{0.909587324f, 0.508620381f},
-std::array<float,2>{0.7348575f, 0.437516809f},
-std::array<float,2>{0.217369616f, 0.881441832f},
-std::array<float,2>{0.171259239f, 0.19415243f},
-std::array<float,2>{0.638687432f, 0.631571829f},
-std::array<float,2>{0.969718039f, 0.29183653f},
-std::array<float,2>{0.335795373f, 0.814555585f},
-std::array<float,2>{0.457617521f, 0.406315833f},
-std::array<float,2>{0.807393968f, 0.968394339f},
-std::array<float,2>{0.616863906f, 0.115541443f},
-std::array<float,2>{0.0536462292f, 0.620818913f},
-std::array<float,2>{0.0783026293f, 0.445322692f},
-std::array<float,2>{0.529066682f, 0.889198244f},
-std::array<float,2>{0.827750444f, 0.0275359172f},
-std::array<float,2>{0.435005695f, 0.503841937f},
-std::array<float,2>{0.264171839f, 0.168994442f},
-std::array<float,2>{0.890114367f, 0.730889916f},
-std::array<float,2>{0.718574584f, 0.337259412f},
-std::array<float,2>{0.245172292f, 0.801363111f},
-std::array<float,2>{0.146243274f, 0.122459576f},
-std::array<float,2>{0.663850427f, 0.612014294f},
-std::array<float,2>{0.967029274f, 0.41519779f},
-std::array<float,2>{0.357357532f, 0.954413354f},
-std::array<float,2>{0.478558242f, 0.284219593f},
-std::array<float,2>{0.768530786f, 0.823676765f},
-std::array<float,2>{0.589654982f, 0.19993481f},
-std::array<float,2>{0.0225772038f, 0.638455212f},
-std::array<float,2>{0.209505096f, 0.374051511f},
-std::array<float,2>{0.744232178f, 0.780559421f},
-std::array<float,2>{0.919277549f, 0.149937913f},
-std::array<float,2>{0.305518776f, 0.716611385f},
-std::array<float,2>{0.382867873f, 0.0497298837f},
-std::array<float,2>{0.857968867f, 0.544678688f},
-std::array<float,2>{0.562220633f, 0.47160089f},
-std::array<float,2>{0.106993183f, 0.915245056f},
-std::array<float,2>{0.0601056628f, 0.234733f},
-std::array<float,2>{0.619911373f, 0.671683431f},
-std::array<float,2>{0.7999475f, 0.276793391f},
-std::array<float,2>{0.46411857f, 0.860356212f},
-std::array<float,2>{0.336034536f, 0.393340141f},
-std::array<float,2>{0.981005251f, 0.982265949f},
-std::array<float,2>{0.627348781f, 0.0915810466f},
-std::array<float,2>{0.161152333f, 0.578077614f},
-std::array<float,2>{0.175100878f, 0.428922772f},
-std::array<float,2>{0.646064878f, 0.940360725f},
-std::array<float,2>{0.992446005f, 0.0954152867f},
-std::array<float,2>{0.31453526f, 0.601856947f},
-std::array<float,2>{0.447779357f, 0.204279378f},
-std::array<float,2>{0.792395294f, 0.654618919f},
-std::array<float,2>{0.599435389f, 0.309804529f},
-std::array<float,2>{0.0312578157f, 0.829743445f},
-std::array<float,2>{0.116937093f, 0.000113156661f},
-std::array<float,2>{0.540335417f, 0.531200409f},
-std::array<float,2>{0.862487078f, 0.465007603f},
-std::array<float,2>{0.400339454f, 0.901869774f},
-std::array<float,2>{0.295418561f, 0.321551234f},
-std::array<float,2>{0.929685235f, 0.784902275f},
-std::array<float,2>{0.725838959f, 0.179750681f},
-std::array<float,2>{0.191872463f, 0.745651007f},
-std::array<float,2>{0.00867473334f, 0.255812585f},
-std::array<float,2>{0.565414727f, 0.849694729f},
-std::array<float,2>{0.764149845f, 0.226677462f},
-std::array<float,2>{0.490497679f, 0.685167849f},
-std::array<float,2>{0.366612583f, 0.0698282793f},
-std::array<float,2>{0.952705562f, 0.590639293f},
-std::array<float,2>{0.68058753f, 0.386764348f},
-std::array<float,2>{0.13659893f, 0.987361491f},
-std::array<float,2>{0.228739187f, 0.127521411f},
-std::array<float,2>{0.695572019f, 0.693466783f},
-std::array<float,2>{0.905219436f, 0.357824564f},
-std::array<float,2>{0.268812895f, 0.761306763f},
-std::array<float,2>{0.413455725f, 0.495136291f},
-std::array<float,2>{0.830296874f, 0.930768251f},
-std::array<float,2>{0.511934817f, 0.034906324f},
-std::array<float,2>{0.0656917989f, 0.561923862f},
-std::array<float,2>{0.12010023f, 0.419450194f},
-std::array<float,2>{0.535061061f, 0.96043241f},
-std::array<float,2>{0.870533347f, 0.118209146f},
-std::array<float,2>{0.390663773f, 0.61593014f},
-std::array<float,2>{0.285556883f, 0.196138307f},
-std::array<float,2>{0.933861732f, 0.635538697f},
-std::array<float,2>{0.727860153f, 0.28604883f},
-std::array<float,2>{0.196140006f, 0.824223936f},
-std::array<float,2>{0.186058804f, 0.0259915497f},
-std::array<float,2>{0.654160023f, 0.506699264f},
-std::array<float,2>{0.988134146f, 0.450894892f},
-std::array<float,2>{0.322211444f, 0.883459985f},
-std::array<float,2>{0.442409784f, 0.339985818f},
-std::array<float,2>{0.782927811f, 0.799337327f},
-std::array<float,2>{0.609086573f, 0.165737242f},
-std::array<float,2>{0.0406740643f, 0.727928042f},
-std::array<float,2>{0.21946758f, 0.27854684f},
-std::array<float,2>{0.687991619f, 0.866192162f},
-std::array<float,2>{0.897065878f, 0.241127416f},
-std::array<float,2>{0.275993943f, 0.665105104f},
-std::array<float,2>{0.415755898f, 0.0878554657f},
-std::array<float,2>{0.842999876f, 0.572642982f},
-std::array<float,2>{0.506352663f, 0.396692038f},
-std::array<float,2>{0.0778899938f, 0.979608893f},
-std::array<float,2>{0.00648768479f, 0.153169364f},
-std::array<float,2>{0.572406948f, 0.711483955f},
-std::array<float,2>{0.755699873f, 0.369686872f},
-std::array<float,2>{0.499929518f, 0.77462101f},
-std::array<float,2>{0.370598108f, 0.473255277f},
-std::array<float,2>{0.940122545f, 0.920764685f},
-std::array<float,2>{0.678201735f, 0.0525298826f},
-std::array<float,2>{0.131888926f, 0.542708337f},
-std::array<float,2>{0.151476726f, 0.463779062f},
-std::array<float,2>{0.667013764f, 0.902661383f},
-std::array<float,2>{0.955907047f, 0.005673334f},
-std::array<float,2>{0.343962789f, 0.52613157f},
-std::array<float,2>{0.471509755f, 0.185482785f},
-std::array<float,2>{0.779364347f, 0.749715686f},
-std::array<float,2>{0.579602718f, 0.325416863f},
-std::array<float,2>{0.0270171855f, 0.786872029f},
-std::array<float,2>{0.0865067169f, 0.0983208716f},
-std::array<float,2>{0.516385555f, 0.607638299f},
-std::array<float,2>{0.813642085f, 0.424641222f},
-std::array<float,2>{0.423589021f, 0.944906592f},
-std::array<float,2>{0.250741988f, 0.306542158f},
-std::array<float,2>{0.878535926f, 0.833064795f},
-std::array<float,2>{0.707086027f, 0.2072694f},
-std::array<float,2>{0.234644681f, 0.651210546f},
-std::array<float,2>{0.0477977432f, 0.355398864f},
-std::array<float,2>{0.612047732f, 0.762923062f},
-std::array<float,2>{0.811594844f, 0.129368946f},
-std::array<float,2>{0.4536708f, 0.691315055f},
-std::array<float,2>{0.328761995f, 0.0374596417f},
-std::array<float,2>{0.973359108f, 0.556212068f},
-std::array<float,2>{0.633433759f, 0.499674231f},
-std::array<float,2>{0.165294543f, 0.935715377f},
-std::array<float,2>{0.211245194f, 0.231188551f},
-std::array<float,2>{0.740934372f, 0.681149185f},
-std::array<float,2>{0.911335766f, 0.251704931f},
-std::array<float,2>{0.298526645f, 0.84551394f},
-std::array<float,2>{0.381867737f, 0.384354502f},
-std::array<float,2>{0.847377539f, 0.989630044f},
-std::array<float,2>{0.551318765f, 0.0628828257f},
-std::array<float,2>{0.0960883573f, 0.589058578f},
-std::array<float,2>{0.0191335008f, 0.486377954f},
-std::array<float,2>{0.593153119f, 0.923726261f},
-std::array<float,2>{0.771169901f, 0.0441113077f},
-std::array<float,2>{0.481622517f, 0.548274338f},
-std::array<float,2>{0.352723926f, 0.134741902f},
-std::array<float,2>{0.961659312f, 0.70223999f},
-std::array<float,2>{0.658124983f, 0.349908441f},
-std::array<float,2>{0.143684074f, 0.756059647f},
-std::array<float,2>{0.249762416f, 0.0780867711f},
-std::array<float,2>{0.714402497f, 0.584865034f},
-std::array<float,2>{0.882904768f, 0.379505396f},
-std::array<float,2>{0.260155171f, 0.996594071f},
-std::array<float,2>{0.431817561f, 0.263234615f},
-std::array<float,2>{0.823756278f, 0.851623774f},
-std::array<float,2>{0.523786843f, 0.226384193f},
-std::array<float,2>{0.0828061029f, 0.677778184f},
-std::array<float,2>{0.158229977f, 0.314170659f},
-std::array<float,2>{0.629642785f, 0.791150272f},
-std::array<float,2>{0.980461419f, 0.172375381f},
-std::array<float,2>{0.341497689f, 0.739876091f},
-std::array<float,2>{0.464848518f, 0.0111901267f},
-std::array<float,2>{0.801595807f, 0.516618013f},
-std::array<float,2>{0.623230517f, 0.454570115f},
-std::array<float,2>{0.0547403693f, 0.897919774f},
-std::array<float,2>{0.104289666f, 0.212770864f},
-std::array<float,2>{0.557742596f, 0.641510069f},
-std::array<float,2>{0.853129685f, 0.304338872f},
-std::array<float,2>{0.388063103f, 0.838270783f},
-std::array<float,2>{0.310528547f, 0.434558719f},
-std::array<float,2>{0.915416956f, 0.94548142f},
-std::array<float,2>{0.747133434f, 0.108390935f},
-std::array<float,2>{0.20422563f, 0.595522165f},
-std::array<float,2>{0.188099757f, 0.403873205f},
-std::array<float,2>{0.722053528f, 0.973727465f},
-std::array<float,2>{0.922106743f, 0.0826851428f},
-std::array<float,2>{0.289128482f, 0.567159474f},
-std::array<float,2>{0.406163722f, 0.249134526f},
-std::array<float,2>{0.863667548f, 0.65777415f},
-std::array<float,2>{0.544054151f, 0.273054212f},
-std::array<float,2>{0.112123005f, 0.873124003f},
-std::array<float,2>{0.0360984318f, 0.0588425957f},
-std::array<float,2>{0.594790757f, 0.536024928f},
-std::array<float,2>{0.794024825f, 0.479500115f},
-std::array<float,2>{0.449991196f, 0.908507288f},
-std::array<float,2>{0.317588896f, 0.366575122f},
-std::array<float,2>{0.999682128f, 0.771257818f},
-std::array<float,2>{0.643029749f, 0.146425515f},
-std::array<float,2>{0.178109452f, 0.70789969f},
-std::array<float,2>{0.0699394569f, 0.294768661f},
-std::array<float,2>{0.508486569f, 0.819419622f},
-std::array<float,2>{0.833321691f, 0.191038519f},
-std::array<float,2>{0.406350642f, 0.627224684f},
-std::array<float,2>{0.271629959f, 0.111330658f},
-std::array<float,2>{0.902160347f, 0.622115016f},
-std::array<float,2>{0.702447772f, 0.411166936f},
-std::array<float,2>{0.233782172f, 0.961038113f},
-std::array<float,2>{0.136836514f, 0.160490379f},
-std::array<float,2>{0.683636487f, 0.71957612f},
-std::array<float,2>{0.947099328f, 0.331649631f},
-std::array<float,2>{0.360257179f, 0.811293304f},
-std::array<float,2>{0.488172114f, 0.442758471f},
-std::array<float,2>{0.761373639f, 0.876747429f},
-std::array<float,2>{0.567762971f, 0.0214397274f},
-std::array<float,2>{0.0132366819f, 0.512151599f},
-std::array<float,2>{0.00321180443f, 0.431307435f},
-std::array<float,2>{0.575232208f, 0.95132488f},
-std::array<float,2>{0.752630055f, 0.10380917f},
-std::array<float,2>{0.49509564f, 0.600293875f},
-std::array<float,2>{0.374262899f, 0.218529433f},
-std::array<float,2>{0.944937706f, 0.644904912f},
-std::array<float,2>{0.672308445f, 0.299184203f},
-std::array<float,2>{0.127087191f, 0.840377688f},
-std::array<float,2>{0.22308974f, 0.0143449623f},
-std::array<float,2>{0.693483114f, 0.5210886f},
-std::array<float,2>{0.893326342f, 0.457549989f},
-std::array<float,2>{0.279837608f, 0.894065976f},
-std::array<float,2>{0.41844219f, 0.319422752f},
-std::array<float,2>{0.836707175f, 0.796780765f},
-std::array<float,2>{0.503742933f, 0.179528058f},
-std::array<float,2>{0.0708556846f, 0.73719424f},
-std::array<float,2>{0.182476804f, 0.261312813f},
-std::array<float,2>{0.650220037f, 0.856238782f},
-std::array<float,2>{0.989551485f, 0.221228108f},
-std::array<float,2>{0.325677097f, 0.673499167f},
-std::array<float,2>{0.440190107f, 0.0724507943f},
-std::array<float,2>{0.786356807f, 0.580682039f},
-std::array<float,2>{0.602197409f, 0.375796199f},
-std::array<float,2>{0.0464343242f, 0.992794871f},
-std::array<float,2>{0.122055657f, 0.139614001f},
-std::array<float,2>{0.538942218f, 0.697013915f},
-std::array<float,2>{0.872180343f, 0.344777256f},
-std::array<float,2>{0.394676447f, 0.752707481f},
-std::array<float,2>{0.284012705f, 0.491037279f},
-std::array<float,2>{0.931657016f, 0.928708792f},
-std::array<float,2>{0.733694196f, 0.0400397927f},
-std::array<float,2>{0.202318698f, 0.551247895f},
-std::array<float,2>{0.215826839f, 0.440395057f},
-std::array<float,2>{0.737875879f, 0.879338562f},
-std::array<float,2>{0.908124149f, 0.018185284f},
-std::array<float,2>{0.301395088f, 0.510633111f},
-std::array<float,2>{0.376298696f, 0.160101533f},
-std::array<float,2>{0.849096894f, 0.726440668f},
-std::array<float,2>{0.548460126f, 0.334631652f},
-std::array<float,2>{0.0998621136f, 0.804733872f},
-std::array<float,2>{0.0519271642f, 0.113524288f},
-std::array<float,2>{0.614220083f, 0.618010163f},
-std::array<float,2>{0.80592227f, 0.410007387f},
-std::array<float,2>{0.459076494f, 0.966527402f},
-std::array<float,2>{0.333346337f, 0.289131731f},
-std::array<float,2>{0.972513974f, 0.813485801f},
-std::array<float,2>{0.637748837f, 0.191865459f},
-std::array<float,2>{0.169209272f, 0.630699873f},
-std::array<float,2>{0.0937019065f, 0.363060653f},
-std::array<float,2>{0.519944191f, 0.767185152f},
-std::array<float,2>{0.818760335f, 0.142995283f},
-std::array<float,2>{0.426252067f, 0.703953803f},
-std::array<float,2>{0.25776872f, 0.0573763661f},
-std::array<float,2>{0.880360246f, 0.531617641f},
-std::array<float,2>{0.704942942f, 0.481000602f},
-std::array<float,2>{0.239299476f, 0.913485467f},
-std::array<float,2>{0.1548246f, 0.245311216f},
-std::array<float,2>{0.67042613f, 0.660372972f},
-std::array<float,2>{0.957310855f, 0.267663568f},
-std::array<float,2>{0.349505752f, 0.867385089f},
-std::array<float,2>{0.476518482f, 0.40005064f},
-std::array<float,2>{0.773652911f, 0.970069885f},
-std::array<float,2>{0.583170354f, 0.0811456069f},
-std::array<float,2>{0.0288053714f, 0.565172136f},
-std::array<float,2>{0.108394958f, 0.468959987f},
-std::array<float,2>{0.558948874f, 0.917190373f},
-std::array<float,2>{0.856716096f, 0.0469836928f},
-std::array<float,2>{0.385100901f, 0.545794547f},
-std::array<float,2>{0.30781883f, 0.151283756f},
-std::array<float,2>{0.920704961f, 0.718457043f},
-std::array<float,2>{0.743512213f, 0.371646166f},
-std::array<float,2>{0.207142815f, 0.777716279f},
-std::array<float,2>{0.162449136f, 0.092279844f},
-std::array<float,2>{0.625372231f, 0.576126277f},
-std::array<float,2>{0.982943535f, 0.391558707f},
-std::array<float,2>{0.339610726f, 0.98315084f},
-std::array<float,2>{0.462037057f, 0.275307208f},
-std::array<float,2>{0.798627198f, 0.862235785f},
-std::array<float,2>{0.617340863f, 0.237970293f},
-std::array<float,2>{0.0612899438f, 0.669611633f},
-std::array<float,2>{0.242612317f, 0.339489132f},
-std::array<float,2>{0.716127038f, 0.802898884f},
-std::array<float,2>{0.887645125f, 0.171869606f},
-std::array<float,2>{0.261994869f, 0.733043194f},
-std::array<float,2>{0.436710626f, 0.0310415234f},
-std::array<float,2>{0.825276434f, 0.501150131f},
-std::array<float,2>{0.529677331f, 0.447413802f},
-std::array<float,2>{0.0817842782f, 0.887252629f},
-std::array<float,2>{0.0213504788f, 0.202539966f},
-std::array<float,2>{0.586723506f, 0.639419496f},
-std::array<float,2>{0.766026616f, 0.282414228f},
-std::array<float,2>{0.477965087f, 0.820880413f},
-std::array<float,2>{0.35818693f, 0.417590111f},
-std::array<float,2>{0.966389954f, 0.955106139f},
-std::array<float,2>{0.661569357f, 0.123876154f},
-std::array<float,2>{0.146931097f, 0.609824598f},
-std::array<float,2>{0.134586498f, 0.38965854f},
-std::array<float,2>{0.683340371f, 0.984378278f},
-std::array<float,2>{0.950396121f, 0.068124257f},
-std::array<float,2>{0.363285244f, 0.59321171f},
-std::array<float,2>{0.489456862f, 0.229667649f},
-std::array<float,2>{0.763389349f, 0.686177611f},
-std::array<float,2>{0.563900173f, 0.255975157f},
-std::array<float,2>{0.0115384804f, 0.849337816f},
-std::array<float,2>{0.0643579736f, 0.0329631045f},
-std::array<float,2>{0.51458621f, 0.559856236f},
-std::array<float,2>{0.828166783f, 0.492987454f},
-std::array<float,2>{0.410734475f, 0.933114529f},
-std::array<float,2>{0.267313719f, 0.35588184f},
-std::array<float,2>{0.902519166f, 0.757968724f},
-std::array<float,2>{0.697549343f, 0.125170559f},
-std::array<float,2>{0.227941558f, 0.691773295f},
-std::array<float,2>{0.0344628282f, 0.310597241f},
-std::array<float,2>{0.601420283f, 0.83099699f},
-std::array<float,2>{0.789450467f, 0.205355555f},
-std::array<float,2>{0.445332199f, 0.653465509f},
-std::array<float,2>{0.313448548f, 0.0966734365f},
-std::array<float,2>{0.996073842f, 0.605445862f},
-std::array<float,2>{0.648390472f, 0.426666141f},
-std::array<float,2>{0.173180103f, 0.93751049f},
-std::array<float,2>{0.194501355f, 0.18314229f},
-std::array<float,2>{0.723347545f, 0.743041098f},
-std::array<float,2>{0.925904393f, 0.322623283f},
-std::array<float,2>{0.293600708f, 0.781508505f},
-std::array<float,2>{0.400842607f, 0.467633516f},
-std::array<float,2>{0.859799445f, 0.899868667f},
-std::array<float,2>{0.541668832f, 0.00297449133f},
-std::array<float,2>{0.114983879f, 0.527425706f},
-std::array<float,2>{0.0752364248f, 0.396233022f},
-std::array<float,2>{0.505607247f, 0.978203356f},
-std::array<float,2>{0.840725839f, 0.0895798504f},
-std::array<float,2>{0.416935772f, 0.570942402f},
-std::array<float,2>{0.274737f, 0.238804206f},
-std::array<float,2>{0.895077288f, 0.666483819f},
-std::array<float,2>{0.690505922f, 0.279844105f},
-std::array<float,2>{0.222535133f, 0.863847077f},
-std::array<float,2>{0.130344242f, 0.0533103496f},
-std::array<float,2>{0.676043212f, 0.539317667f},
-std::array<float,2>{0.939396203f, 0.475032449f},
-std::array<float,2>{0.368709624f, 0.919173002f},
-std::array<float,2>{0.497512668f, 0.368871003f},
-std::array<float,2>{0.757775545f, 0.775885999f},
-std::array<float,2>{0.571375668f, 0.154826686f},
-std::array<float,2>{0.00416732999f, 0.714729905f},
-std::array<float,2>{0.19858174f, 0.288434923f},
-std::array<float,2>{0.730398893f, 0.826361835f},
-std::array<float,2>{0.93667084f, 0.198304981f},
-std::array<float,2>{0.288763821f, 0.633264899f},
-std::array<float,2>{0.393354088f, 0.119615681f},
-std::array<float,2>{0.868769467f, 0.614998817f},
-std::array<float,2>{0.532316089f, 0.420096785f},
-std::array<float,2>{0.118754849f, 0.95814234f},
-std::array<float,2>{0.0411155559f, 0.167376444f},
-std::array<float,2>{0.605931163f, 0.728822947f},
-std::array<float,2>{0.783930361f, 0.343355685f},
-std::array<float,2>{0.444674671f, 0.797673464f},
-std::array<float,2>{0.324142367f, 0.452292979f},
-std::array<float,2>{0.984568357f, 0.885583103f},
-std::array<float,2>{0.654794395f, 0.0246446226f},
-std::array<float,2>{0.185119227f, 0.505534172f},
-std::array<float,2>{0.167234257f, 0.497947544f},
-std::array<float,2>{0.636610448f, 0.934834182f},
-std::array<float,2>{0.974993765f, 0.0354142413f},
-std::array<float,2>{0.331365854f, 0.558588743f},
-std::array<float,2>{0.455935001f, 0.1324424f},
-std::array<float,2>{0.809918404f, 0.688563228f},
-std::array<float,2>{0.609806061f, 0.35296464f},
-std::array<float,2>{0.0489511862f, 0.764263093f},
-std::array<float,2>{0.0951194316f, 0.0657634512f},
-std::array<float,2>{0.554243743f, 0.587669253f},
-std::array<float,2>{0.845513105f, 0.384898126f},
-std::array<float,2>{0.380337745f, 0.990367591f},
-std::array<float,2>{0.300215334f, 0.253739506f},
-std::array<float,2>{0.913774967f, 0.847270191f},
-std::array<float,2>{0.739756346f, 0.232810929f},
-std::array<float,2>{0.213484034f, 0.683134794f},
-std::array<float,2>{0.0250998568f, 0.326717883f},
-std::array<float,2>{0.581741214f, 0.788435936f},
-std::array<float,2>{0.778336942f, 0.18608214f},
-std::array<float,2>{0.470576942f, 0.747152925f},
-std::array<float,2>{0.347392976f, 0.0060251425f},
-std::array<float,2>{0.953338444f, 0.523680866f},
-std::array<float,2>{0.66425091f, 0.461512685f},
-std::array<float,2>{0.149375081f, 0.904899597f},
-std::array<float,2>{0.237210765f, 0.210046425f},
-std::array<float,2>{0.709389687f, 0.648441851f},
-std::array<float,2>{0.875120878f, 0.307766825f},
-std::array<float,2>{0.252450049f, 0.834401429f},
-std::array<float,2>{0.425621122f, 0.422922164f},
-std::array<float,2>{0.814857066f, 0.943287671f},
-std::array<float,2>{0.51816529f, 0.101347692f},
-std::array<float,2>{0.0883560032f, 0.605596781f},
-std::array<float,2>{0.0567455702f, 0.456458896f},
-std::array<float,2>{0.621806383f, 0.896122754f},
-std::array<float,2>{0.803238332f, 0.0097062448f},
-std::array<float,2>{0.468165725f, 0.518443882f},
-std::array<float,2>{0.343429059f, 0.174139172f},
-std::array<float,2>{0.977750301f, 0.740269721f},
-std::array<float,2>{0.63205719f, 0.31587854f},
-std::array<float,2>{0.156916261f, 0.790428698f},
-std::array<float,2>{0.205539733f, 0.106116802f},
-std::array<float,2>{0.748624027f, 0.59647578f},
-std::array<float,2>{0.916202664f, 0.437002867f},
-std::array<float,2>{0.311071694f, 0.948273361f},
-std::array<float,2>{0.390530735f, 0.301193982f},
-std::array<float,2>{0.854949594f, 0.836213946f},
-std::array<float,2>{0.556460142f, 0.213844776f},
-std::array<float,2>{0.102271676f, 0.643756866f},
-std::array<float,2>{0.141543433f, 0.348423809f},
-std::array<float,2>{0.659555554f, 0.755172193f},
-std::array<float,2>{0.963681698f, 0.136701956f},
-std::array<float,2>{0.354569674f, 0.699916661f},
-std::array<float,2>{0.483746916f, 0.0451361574f},
-std::array<float,2>{0.772564054f, 0.550023437f},
-std::array<float,2>{0.591032326f, 0.486205548f},
-std::array<float,2>{0.0159613118f, 0.924890757f},
-std::array<float,2>{0.0844341293f, 0.223969147f},
-std::array<float,2>{0.525803208f, 0.676349878f},
-std::array<float,2>{0.820508182f, 0.265534282f},
-std::array<float,2>{0.43043372f, 0.854917288f},
-std::array<float,2>{0.259196699f, 0.381738693f},
-std::array<float,2>{0.885807753f, 0.998061419f},
-std::array<float,2>{0.712012589f, 0.0753899962f},
-std::array<float,2>{0.247228146f, 0.58275795f},
-std::array<float,2>{0.230475396f, 0.412575185f},
-std::array<float,2>{0.700416386f, 0.963871658f},
-std::array<float,2>{0.898918033f, 0.111263193f},
-std::array<float,2>{0.270039797f, 0.623094261f},
-std::array<float,2>{0.408438742f, 0.189039946f},
-std::array<float,2>{0.835478067f, 0.625993788f},
-std::array<float,2>{0.510954976f, 0.295316279f},
-std::array<float,2>{0.0670943633f, 0.817809045f},
-std::array<float,2>{0.0137218954f, 0.0217935722f},
-std::array<float,2>{0.569822311f, 0.514878213f},
-std::array<float,2>{0.759271979f, 0.443875164f},
-std::array<float,2>{0.485307127f, 0.878026545f},
-std::array<float,2>{0.362479657f, 0.329333186f},
-std::array<float,2>{0.949151695f, 0.809321523f},
-std::array<float,2>{0.686629593f, 0.162627697f},
-std::array<float,2>{0.140511453f, 0.722507596f},
-std::array<float,2>{0.109795511f, 0.269545346f},
-std::array<float,2>{0.546256363f, 0.87169528f},
-std::array<float,2>{0.866652548f, 0.246335909f},
-std::array<float,2>{0.403210431f, 0.660132766f},
-std::array<float,2>{0.291591853f, 0.0847723261f},
-std::array<float,2>{0.924910247f, 0.570206583f},
-std::array<float,2>{0.71993649f, 0.405000865f},
-std::array<float,2>{0.191374689f, 0.974622846f},
-std::array<float,2>{0.176154345f, 0.147556335f},
-std::array<float,2>{0.641857862f, 0.710676372f},
-std::array<float,2>{0.996856868f, 0.363798678f},
-std::array<float,2>{0.319993019f, 0.771721542f},
-std::array<float,2>{0.451560915f, 0.476882517f},
-std::array<float,2>{0.795801163f, 0.906840384f},
-std::array<float,2>{0.597357988f, 0.0615427718f},
-std::array<float,2>{0.0378769785f, 0.537853956f},
-std::array<float,2>{0.0276118945f, 0.400780529f},
-std::array<float,2>{0.582327962f, 0.972459972f},
-std::array<float,2>{0.774748921f, 0.0799598545f},
-std::array<float,2>{0.47558251f, 0.563722551f},
-std::array<float,2>{0.347964525f, 0.243040055f},
-std::array<float,2>{0.958358288f, 0.662774861f},
-std::array<float,2>{0.671480536f, 0.266780645f},
-std::array<float,2>{0.155797914f, 0.869881153f},
-std::array<float,2>{0.239024401f, 0.0560240634f},
-std::array<float,2>{0.703826427f, 0.534312129f},
-std::array<float,2>{0.879759669f, 0.483231336f},
-std::array<float,2>{0.256097287f, 0.911748767f},
-std::array<float,2>{0.427537978f, 0.360423088f},
-std::array<float,2>{0.819769979f, 0.769075632f},
-std::array<float,2>{0.520814836f, 0.141626447f},
-std::array<float,2>{0.0922869071f, 0.706033349f},
-std::array<float,2>{0.168669432f, 0.292143464f},
-std::array<float,2>{0.637433589f, 0.815502822f},
-std::array<float,2>{0.971657395f, 0.194812596f},
-std::array<float,2>{0.332883716f, 0.632449865f},
-std::array<float,2>{0.460273802f, 0.116363339f},
-std::array<float,2>{0.804871261f, 0.61958462f},
-std::array<float,2>{0.614835083f, 0.407429069f},
-std::array<float,2>{0.0516166314f, 0.967262805f},
-std::array<float,2>{0.100595489f, 0.158065856f},
-std::array<float,2>{0.546931446f, 0.722952187f},
-std::array<float,2>{0.84810102f, 0.333292723f},
-std::array<float,2>{0.375432074f, 0.807091236f},
-std::array<float,2>{0.302645653f, 0.439167619f},
-std::array<float,2>{0.906419635f, 0.882241726f},
-std::array<float,2>{0.737003028f, 0.0157748498f},
-std::array<float,2>{0.215044126f, 0.50961256f},
-std::array<float,2>{0.201681882f, 0.489713013f},
-std::array<float,2>{0.732664883f, 0.926807404f},
-std::array<float,2>{0.932868898f, 0.0418109782f},
-std::array<float,2>{0.284189731f, 0.553697586f},
-std::array<float,2>{0.396046966f, 0.137775823f},
-std::array<float,2>{0.871646106f, 0.698493004f},
-std::array<float,2>{0.537132978f, 0.346951157f},
-std::array<float,2>{0.122126266f, 0.75146389f},
-std::array<float,2>{0.0451001897f, 0.0710613206f},
-std::array<float,2>{0.602567732f, 0.579709053f},
-std::array<float,2>{0.785627782f, 0.377120882f},
-std::array<float,2>{0.440720141f, 0.994745314f},
-std::array<float,2>{0.32424745f, 0.257867426f},
-std::array<float,2>{0.988914669f, 0.85937351f},
-std::array<float,2>{0.648574948f, 0.218757987f},
-std::array<float,2>{0.183382034f, 0.67452687f},
-std::array<float,2>{0.0721078962f, 0.318283975f},
-std::array<float,2>{0.502119005f, 0.794679046f},
-std::array<float,2>{0.837000966f, 0.175969899f},
-std::array<float,2>{0.419716269f, 0.734817564f},
-std::array<float,2>{0.280714154f, 0.0121115865f},
-std::array<float,2>{0.893724322f, 0.522199512f},
-std::array<float,2>{0.694461346f, 0.459984452f},
-std::array<float,2>{0.223919794f, 0.891383231f},
-std::array<float,2>{0.128737107f, 0.216624811f},
-std::array<float,2>{0.673522174f, 0.648395419f},
-std::array<float,2>{0.943457305f, 0.296892166f},
-std::array<float,2>{0.373745352f, 0.842652321f},
-std::array<float,2>{0.495921314f, 0.432393014f},
-std::array<float,2>{0.75295651f, 0.949822485f},
-std::array<float,2>{0.574472249f, 0.102060027f},
-std::array<float,2>{0.00279644108f, 0.597846031f},
-std::array<float,2>{0.113754384f, 0.465935469f},
-std::array<float,2>{0.542416096f, 0.900494337f},
-std::array<float,2>{0.860382676f, 0.00168196613f},
-std::array<float,2>{0.401408017f, 0.529702067f},
-std::array<float,2>{0.294815063f, 0.180695936f},
-std::array<float,2>{0.927041709f, 0.74511534f},
-std::array<float,2>{0.723962069f, 0.320314974f},
-std::array<float,2>{0.19366695f, 0.783393741f},
-std::array<float,2>{0.17240946f, 0.0939177424f},
-std::array<float,2>{0.647351325f, 0.602671027f},
-std::array<float,2>{0.994942248f, 0.42816186f},
-std::array<float,2>{0.313794702f, 0.941241145f},
-std::array<float,2>{0.446362227f, 0.30897674f},
-std::array<float,2>{0.790070832f, 0.828475654f},
-std::array<float,2>{0.600090802f, 0.203342915f},
-std::array<float,2>{0.0338893496f, 0.655803919f},
-std::array<float,2>{0.227518365f, 0.358676672f},
-std::array<float,2>{0.698717594f, 0.759929121f},
-std::array<float,2>{0.903655648f, 0.128081098f},
-std::array<float,2>{0.266188741f, 0.694573402f},
-std::array<float,2>{0.412004292f, 0.0336904898f},
-std::array<float,2>{0.82955724f, 0.560608089f},
-std::array<float,2>{0.51486665f, 0.494542658f},
-std::array<float,2>{0.0626344383f, 0.929757714f},
-std::array<float,2>{0.0101812584f, 0.228235051f},
-std::array<float,2>{0.562718093f, 0.684318841f},
-std::array<float,2>{0.762255609f, 0.254434139f},
-std::array<float,2>{0.488507986f, 0.85109973f},
-std::array<float,2>{0.364567012f, 0.388203472f},
-std::array<float,2>{0.949643731f, 0.987106919f},
-std::array<float,2>{0.682212353f, 0.0684373453f},
-std::array<float,2>{0.133651733f, 0.591579795f},
-std::array<float,2>{0.148213655f, 0.414251953f},
-std::array<float,2>{0.660924315f, 0.953268468f},
-std::array<float,2>{0.965094686f, 0.121095367f},
-std::array<float,2>{0.358767539f, 0.612929106f},
-std::array<float,2>{0.477064729f, 0.200312212f},
-std::array<float,2>{0.766872585f, 0.637197435f},
-std::array<float,2>{0.587406993f, 0.284087777f},
-std::array<float,2>{0.0203639567f, 0.823082626f},
-std::array<float,2>{0.0809688568f, 0.0288906395f},
-std::array<float,2>{0.530839741f, 0.502483249f},
-std::array<float,2>{0.824952066f, 0.446830839f},
-std::array<float,2>{0.436356932f, 0.890075326f},
-std::array<float,2>{0.263089091f, 0.33666411f},
-std::array<float,2>{0.888227582f, 0.801784813f},
-std::array<float,2>{0.715018094f, 0.168253794f},
-std::array<float,2>{0.243220478f, 0.732156932f},
-std::array<float,2>{0.0617282391f, 0.275808781f},
-std::array<float,2>{0.618914902f, 0.859949052f},
-std::array<float,2>{0.7971825f, 0.236229882f},
-std::array<float,2>{0.461661875f, 0.670520544f},
-std::array<float,2>{0.338264585f, 0.0906966925f},
-std::array<float,2>{0.984035313f, 0.576678157f},
-std::array<float,2>{0.625988066f, 0.393671632f},
-std::array<float,2>{0.163873807f, 0.981121957f},
-std::array<float,2>{0.208418399f, 0.14937073f},
-std::array<float,2>{0.742484272f, 0.714961648f},
-std::array<float,2>{0.921293914f, 0.373673588f},
-std::array<float,2>{0.306798935f, 0.780097723f},
-std::array<float,2>{0.386530906f, 0.472316951f},
-std::array<float,2>{0.855762243f, 0.914673507f},
-std::array<float,2>{0.560200274f, 0.0507281981f},
-std::array<float,2>{0.109311856f, 0.543871224f},
-std::array<float,2>{0.0892774835f, 0.425610453f},
-std::array<float,2>{0.519282937f, 0.943817914f},
-std::array<float,2>{0.815530419f, 0.0991126522f},
-std::array<float,2>{0.424598545f, 0.608501673f},
-std::array<float,2>{0.253785074f, 0.208937436f},
-std::array<float,2>{0.876887262f, 0.65191853f},
-std::array<float,2>{0.710845113f, 0.305078119f},
-std::array<float,2>{0.237987071f, 0.83205688f},
-std::array<float,2>{0.150221795f, 0.00477101328f},
-std::array<float,2>{0.665070176f, 0.52696985f},
-std::array<float,2>{0.954657137f, 0.464036882f},
-std::array<float,2>{0.345757246f, 0.903479695f},
-std::array<float,2>{0.469373882f, 0.324565589f},
-std::array<float,2>{0.777780354f, 0.785177112f},
-std::array<float,2>{0.580858111f, 0.184281141f},
-std::array<float,2>{0.0235271156f, 0.749006391f},
-std::array<float,2>{0.214477852f, 0.250915259f},
-std::array<float,2>{0.738294959f, 0.84400475f},
-std::array<float,2>{0.913037241f, 0.231630951f},
-std::array<float,2>{0.298975587f, 0.680285215f},
-std::array<float,2>{0.379560083f, 0.0639142096f},
-std::array<float,2>{0.844337225f, 0.588107705f},
-std::array<float,2>{0.552812696f, 0.383339077f},
-std::array<float,2>{0.0942297131f, 0.989165306f},
-std::array<float,2>{0.0503601171f, 0.130408183f},
-std::array<float,2>{0.610982239f, 0.689878285f},
-std::array<float,2>{0.808953047f, 0.35380137f},
-std::array<float,2>{0.456678778f, 0.762299478f},
-std::array<float,2>{0.330680966f, 0.498480946f},
-std::array<float,2>{0.975790441f, 0.93726325f},
-std::array<float,2>{0.635220408f, 0.0389398709f},
-std::array<float,2>{0.16632174f, 0.555454731f},
-std::array<float,2>{0.184427664f, 0.449800521f},
-std::array<float,2>{0.65574652f, 0.884016991f},
-std::array<float,2>{0.985878885f, 0.0265902225f},
-std::array<float,2>{0.322514713f, 0.507423699f},
-std::array<float,2>{0.443879068f, 0.164485589f},
-std::array<float,2>{0.784392416f, 0.727082372f},
-std::array<float,2>{0.606811464f, 0.34126386f},
-std::array<float,2>{0.0422569029f, 0.80012089f},
-std::array<float,2>{0.117671959f, 0.117600814f},
-std::array<float,2>{0.531947851f, 0.616957605f},
-std::array<float,2>{0.868061543f, 0.418165863f},
-std::array<float,2>{0.394076496f, 0.959169686f},
-std::array<float,2>{0.287705004f, 0.286508739f},
-std::array<float,2>{0.935549915f, 0.825336516f},
-std::array<float,2>{0.729305267f, 0.196351886f},
-std::array<float,2>{0.197677284f, 0.636126995f},
-std::array<float,2>{0.00514918752f, 0.37083438f},
-std::array<float,2>{0.570365369f, 0.774287581f},
-std::array<float,2>{0.756319821f, 0.153884038f},
-std::array<float,2>{0.4962928f, 0.712125301f},
-std::array<float,2>{0.367275089f, 0.0517232046f},
-std::array<float,2>{0.937994123f, 0.541302502f},
-std::array<float,2>{0.676767349f, 0.474141747f},
-std::array<float,2>{0.129277423f, 0.921697795f},
-std::array<float,2>{0.221376151f, 0.241726995f},
-std::array<float,2>{0.689837813f, 0.664568722f},
-std::array<float,2>{0.895733356f, 0.277436376f},
-std::array<float,2>{0.273601234f, 0.86630708f},
-std::array<float,2>{0.417686045f, 0.397569805f},
-std::array<float,2>{0.841031969f, 0.979366124f},
-std::array<float,2>{0.504359663f, 0.0861316621f},
-std::array<float,2>{0.0750185177f, 0.573941529f},
-std::array<float,2>{0.0385112241f, 0.478914559f},
-std::array<float,2>{0.595741332f, 0.90949738f},
-std::array<float,2>{0.796526134f, 0.0599486083f},
-std::array<float,2>{0.452634305f, 0.537091136f},
-std::array<float,2>{0.318372637f, 0.145179316f},
-std::array<float,2>{0.997400999f, 0.708649457f},
-std::array<float,2>{0.640664995f, 0.365564197f},
-std::array<float,2>{0.177622408f, 0.769823015f},
-std::array<float,2>{0.190055594f, 0.0831812099f},
-std::array<float,2>{0.719443858f, 0.567969024f},
-std::array<float,2>{0.924421191f, 0.40261063f},
-std::array<float,2>{0.292430401f, 0.973102391f},
-std::array<float,2>{0.403853923f, 0.271663606f},
-std::array<float,2>{0.866008699f, 0.87443167f},
-std::array<float,2>{0.545793116f, 0.248187497f},
-std::array<float,2>{0.11069233f, 0.656648934f},
-std::array<float,2>{0.139613494f, 0.330859184f},
-std::array<float,2>{0.686125636f, 0.811599493f},
-std::array<float,2>{0.947414756f, 0.161852866f},
-std::array<float,2>{0.361347854f, 0.719736516f},
-std::array<float,2>{0.48543185f, 0.0201849993f},
-std::array<float,2>{0.758118331f, 0.513642013f},
-std::array<float,2>{0.568935931f, 0.441669643f},
-std::array<float,2>{0.0146574304f, 0.875303864f},
-std::array<float,2>{0.067840308f, 0.190067917f},
-std::array<float,2>{0.509788275f, 0.628284037f},
-std::array<float,2>{0.834812343f, 0.293893129f},
-std::array<float,2>{0.409543425f, 0.81915164f},
-std::array<float,2>{0.270981491f, 0.41081208f},
-std::array<float,2>{0.899793506f, 0.962027729f},
-std::array<float,2>{0.699955165f, 0.112636715f},
-std::array<float,2>{0.231908143f, 0.621742845f},
-std::array<float,2>{0.246648803f, 0.38070631f},
-std::array<float,2>{0.711861432f, 0.997798264f},
-std::array<float,2>{0.885207593f, 0.0765613317f},
-std::array<float,2>{0.258529067f, 0.585498989f},
-std::array<float,2>{0.430897832f, 0.225560054f},
-std::array<float,2>{0.821446538f, 0.679192305f},
-std::array<float,2>{0.52701205f, 0.262401372f},
-std::array<float,2>{0.0859069377f, 0.853105247f},
-std::array<float,2>{0.0174691658f, 0.0439317487f},
-std::array<float,2>{0.590678871f, 0.547692597f},
-std::array<float,2>{0.772170544f, 0.488011748f},
-std::array<float,2>{0.482598215f, 0.921875656f},
-std::array<float,2>{0.353886247f, 0.35109973f},
-std::array<float,2>{0.964645386f, 0.757347226f},
-std::array<float,2>{0.659098387f, 0.133539841f},
-std::array<float,2>{0.142322943f, 0.701952994f},
-std::array<float,2>{0.102999739f, 0.303497881f},
-std::array<float,2>{0.555281878f, 0.839797497f},
-std::array<float,2>{0.853643239f, 0.211017326f},
-std::array<float,2>{0.389035165f, 0.642347097f},
-std::array<float,2>{0.312112689f, 0.108495891f},
-std::array<float,2>{0.917711079f, 0.593798101f},
-std::array<float,2>{0.749444485f, 0.434980839f},
-std::array<float,2>{0.206869766f, 0.94651264f},
-std::array<float,2>{0.157652408f, 0.173045442f},
-std::array<float,2>{0.631063938f, 0.739100754f},
-std::array<float,2>{0.977217257f, 0.312788337f},
-std::array<float,2>{0.342604756f, 0.792554736f},
-std::array<float,2>{0.467383087f, 0.453466266f},
-std::array<float,2>{0.804122269f, 0.897126853f},
-std::array<float,2>{0.622867286f, 0.0100732855f},
-std::array<float,2>{0.0583275557f, 0.516130447f},
-std::array<float,2>{0.0537771583f, 0.408610165f},
-std::array<float,2>{0.615615487f, 0.965431213f},
-std::array<float,2>{0.807944894f, 0.11430975f},
-std::array<float,2>{0.458687514f, 0.618656278f},
-std::array<float,2>{0.334470928f, 0.193348914f},
-std::array<float,2>{0.970478475f, 0.629463077f},
-std::array<float,2>{0.640040636f, 0.290679812f},
-std::array<float,2>{0.170723513f, 0.812508702f},
-std::array<float,2>{0.218195915f, 0.0185752958f},
-std::array<float,2>{0.736041605f, 0.511541247f},
-std::array<float,2>{0.909001946f, 0.441017061f},
-std::array<float,2>{0.303673983f, 0.879904747f},
-std::array<float,2>{0.376958072f, 0.335595429f},
-std::array<float,2>{0.85102886f, 0.806036711f},
-std::array<float,2>{0.549633682f, 0.159076646f},
-std::array<float,2>{0.0976584405f, 0.725390196f},
-std::array<float,2>{0.152817577f, 0.268803149f},
-std::array<float,2>{0.669235468f, 0.868912995f},
-std::array<float,2>{0.959792554f, 0.244858101f},
-std::array<float,2>{0.350876808f, 0.661462247f},
-std::array<float,2>{0.473268807f, 0.0803585574f},
-std::array<float,2>{0.776978016f, 0.565894663f},
-std::array<float,2>{0.585701704f, 0.399031579f},
-std::array<float,2>{0.0294786524f, 0.969707787f},
-std::array<float,2>{0.0913920626f, 0.144509345f},
-std::array<float,2>{0.523270607f, 0.70416081f},
-std::array<float,2>{0.817818284f, 0.361555994f},
-std::array<float,2>{0.42927289f, 0.765967607f},
-std::array<float,2>{0.254974663f, 0.481875539f},
-std::array<float,2>{0.881224036f, 0.91252166f},
-std::array<float,2>{0.706090808f, 0.0581145436f},
-std::array<float,2>{0.241418004f, 0.532907903f},
-std::array<float,2>{0.225165457f, 0.458198607f},
-std::array<float,2>{0.693344057f, 0.892950773f},
-std::array<float,2>{0.8907215f, 0.015211965f},
-std::array<float,2>{0.27742067f, 0.519884527f},
-std::array<float,2>{0.420483112f, 0.17805028f},
-std::array<float,2>{0.83979404f, 0.737977386f},
-std::array<float,2>{0.501441181f, 0.318780988f},
-std::array<float,2>{0.0726080462f, 0.795699656f},
-std::array<float,2>{0.000209992999f, 0.104942776f},
-std::array<float,2>{0.578081548f, 0.600953817f},
-std::array<float,2>{0.750344098f, 0.430174261f},
-std::array<float,2>{0.493639767f, 0.952361405f},
-std::array<float,2>{0.371242106f, 0.29992795f},
-std::array<float,2>{0.943059623f, 0.841328681f},
-std::array<float,2>{0.675670326f, 0.217695773f},
-std::array<float,2>{0.125099823f, 0.646250665f},
-std::array<float,2>{0.124866702f, 0.344198167f},
-std::array<float,2>{0.537073255f, 0.753668129f},
-std::array<float,2>{0.874185562f, 0.139667183f},
-std::array<float,2>{0.398120433f, 0.696037591f},
-std::array<float,2>{0.2826491f, 0.039535135f},
-std::array<float,2>{0.930035114f, 0.552007318f},
-std::array<float,2>{0.731928945f, 0.49139455f},
-std::array<float,2>{0.200070366f, 0.929030478f},
-std::array<float,2>{0.180356532f, 0.221907005f},
-std::array<float,2>{0.652199209f, 0.672673523f},
-std::array<float,2>{0.991966248f, 0.259912074f},
-std::array<float,2>{0.326256692f, 0.85658443f},
-std::array<float,2>{0.438681632f, 0.376258731f},
-std::array<float,2>{0.7872715f, 0.993746281f},
-std::array<float,2>{0.604640722f, 0.0739667118f},
-std::array<float,2>{0.0446595438f, 0.581145048f},
-std::array<float,2>{0.064958185f, 0.493646532f},
-std::array<float,2>{0.513152838f, 0.93166101f},
-std::array<float,2>{0.831905782f, 0.0315677859f},
-std::array<float,2>{0.412195146f, 0.559072495f},
-std::array<float,2>{0.268062443f, 0.126442552f},
-std::array<float,2>{0.905566096f, 0.693041503f},
-std::array<float,2>{0.696818292f, 0.357010394f},
-std::array<float,2>{0.230102032f, 0.759578288f},
-std::array<float,2>{0.135722563f, 0.0673769042f},
-std::array<float,2>{0.681550622f, 0.591853499f},
-std::array<float,2>{0.951277435f, 0.388812691f},
-std::array<float,2>{0.366187215f, 0.986232817f},
-std::array<float,2>{0.492126018f, 0.257380754f},
-std::array<float,2>{0.764918864f, 0.847912073f},
-std::array<float,2>{0.565707564f, 0.229467705f},
-std::array<float,2>{0.00913046021f, 0.687055469f},
-std::array<float,2>{0.193194687f, 0.323427647f},
-std::array<float,2>{0.725430012f, 0.783138752f},
-std::array<float,2>{0.927873969f, 0.181938246f},
-std::array<float,2>{0.296323866f, 0.744013071f},
-std::array<float,2>{0.398945153f, 0.00215980387f},
-std::array<float,2>{0.862038791f, 0.528801322f},
-std::array<float,2>{0.539972067f, 0.468662053f},
-std::array<float,2>{0.115642644f, 0.898738742f},
-std::array<float,2>{0.032867156f, 0.206093684f},
-std::array<float,2>{0.597887635f, 0.652671874f},
-std::array<float,2>{0.791218162f, 0.31190607f},
-std::array<float,2>{0.44830364f, 0.831403494f},
-std::array<float,2>{0.315757096f, 0.427098244f},
-std::array<float,2>{0.993631124f, 0.93874228f},
-std::array<float,2>{0.645325363f, 0.0972085744f},
-std::array<float,2>{0.174675286f, 0.603603005f},
-std::array<float,2>{0.160753444f, 0.391856462f},
-std::array<float,2>{0.628209829f, 0.983513236f},
-std::array<float,2>{0.981691301f, 0.0934156105f},
-std::array<float,2>{0.337263763f, 0.574438453f},
-std::array<float,2>{0.463090956f, 0.236331373f},
-std::array<float,2>{0.799554884f, 0.66867578f},
-std::array<float,2>{0.620515406f, 0.274181515f},
-std::array<float,2>{0.0592396483f, 0.863153756f},
-std::array<float,2>{0.105527259f, 0.0484210663f},
-std::array<float,2>{0.560597479f, 0.546150565f},
-std::array<float,2>{0.858943641f, 0.470415235f},
-std::array<float,2>{0.38447094f, 0.916579068f},
-std::array<float,2>{0.306280762f, 0.372620374f},
-std::array<float,2>{0.918901563f, 0.77895999f},
-std::array<float,2>{0.745972335f, 0.151401773f},
-std::array<float,2>{0.210887283f, 0.717092454f},
-std::array<float,2>{0.0218157042f, 0.281537712f},
-std::array<float,2>{0.588350236f, 0.821999252f},
-std::array<float,2>{0.768604457f, 0.201624155f},
-std::array<float,2>{0.47959587f, 0.640570462f},
-std::array<float,2>{0.356352508f, 0.12406192f},
-std::array<float,2>{0.968521595f, 0.610822082f},
-std::array<float,2>{0.662881553f, 0.416341603f},
-std::array<float,2>{0.145410776f, 0.956666231f},
-std::array<float,2>{0.244809017f, 0.170223147f},
-std::array<float,2>{0.71774137f, 0.733848691f},
-std::array<float,2>{0.889098883f, 0.337922454f},
-std::array<float,2>{0.264935791f, 0.803810894f},
-std::array<float,2>{0.434009612f, 0.449025989f},
-std::array<float,2>{0.826875985f, 0.888350487f},
-std::array<float,2>{0.527542531f, 0.0296455175f},
-std::array<float,2>{0.0791163296f, 0.500792384f},
-std::array<float,2>{0.0976093411f, 0.386546671f},
-std::array<float,2>{0.552286267f, 0.991914332f},
-std::array<float,2>{0.846368611f, 0.065176554f},
-std::array<float,2>{0.381467104f, 0.58639133f},
-std::array<float,2>{0.296907634f, 0.233462602f},
-std::array<float,2>{0.910328269f, 0.681694448f},
-std::array<float,2>{0.741820693f, 0.252379268f},
-std::array<float,2>{0.2122197f, 0.845776439f},
-std::array<float,2>{0.16435647f, 0.036876969f},
-std::array<float,2>{0.634073794f, 0.55734098f},
-std::array<float,2>{0.973639965f, 0.496867031f},
-std::array<float,2>{0.329629093f, 0.933975518f},
-std::array<float,2>{0.454156756f, 0.351589143f},
-std::array<float,2>{0.810702562f, 0.765545905f},
-std::array<float,2>{0.612662554f, 0.131386936f},
-std::array<float,2>{0.0487426668f, 0.687639177f},
-std::array<float,2>{0.236242071f, 0.306716859f},
-std::array<float,2>{0.708124101f, 0.835344493f},
-std::array<float,2>{0.877247691f, 0.209332943f},
-std::array<float,2>{0.251228988f, 0.64969033f},
-std::array<float,2>{0.422339737f, 0.100557595f},
-std::array<float,2>{0.8125844f, 0.607225895f},
-std::array<float,2>{0.517435372f, 0.422364146f},
-std::array<float,2>{0.0875562429f, 0.942192018f},
-std::array<float,2>{0.0257556103f, 0.187060967f},
-std::array<float,2>{0.578562796f, 0.746958554f},
-std::array<float,2>{0.781054497f, 0.327440679f},
-std::array<float,2>{0.471880436f, 0.787131369f},
-std::array<float,2>{0.345214128f, 0.461946458f},
-std::array<float,2>{0.956255019f, 0.906196415f},
-std::array<float,2>{0.66602999f, 0.00773925474f},
-std::array<float,2>{0.150797695f, 0.525189459f},
-std::array<float,2>{0.131269574f, 0.476374775f},
-std::array<float,2>{0.679375052f, 0.918297887f},
-std::array<float,2>{0.941194892f, 0.0541590638f},
-std::array<float,2>{0.370062083f, 0.540733814f},
-std::array<float,2>{0.498794317f, 0.155414313f},
-std::array<float,2>{0.754011214f, 0.713314712f},
-std::array<float,2>{0.573379934f, 0.367530644f},
-std::array<float,2>{0.00721262442f, 0.776464164f},
-std::array<float,2>{0.0765540451f, 0.0878926292f},
-std::array<float,2>{0.507390201f, 0.571679413f},
-std::array<float,2>{0.841930866f, 0.394538641f},
-std::array<float,2>{0.414143205f, 0.977129817f},
-std::array<float,2>{0.277239323f, 0.281208694f},
-std::array<float,2>{0.897710264f, 0.864969254f},
-std::array<float,2>{0.689375043f, 0.239443257f},
-std::array<float,2>{0.220552191f, 0.667300045f},
-std::array<float,2>{0.0391833745f, 0.342374295f},
-std::array<float,2>{0.60806191f, 0.798724055f},
-std::array<float,2>{0.781814814f, 0.166185379f},
-std::array<float,2>{0.441598684f, 0.729691625f},
-std::array<float,2>{0.321206003f, 0.0239240471f},
-std::array<float,2>{0.98705101f, 0.504490376f},
-std::array<float,2>{0.653077781f, 0.451861858f},
-std::array<float,2>{0.187421426f, 0.886125982f},
-std::array<float,2>{0.197223261f, 0.197394013f},
-std::array<float,2>{0.727358937f, 0.634132802f},
-std::array<float,2>{0.935503602f, 0.287587881f},
-std::array<float,2>{0.28663519f, 0.827556431f},
-std::array<float,2>{0.392329782f, 0.421336472f},
-std::array<float,2>{0.869893134f, 0.957436502f},
-std::array<float,2>{0.533718944f, 0.121082202f},
-std::array<float,2>{0.120482206f, 0.613771558f},
-std::array<float,2>{0.0118297674f, 0.445147157f},
-std::array<float,2>{0.566461265f, 0.877677143f},
-std::array<float,2>{0.760402024f, 0.0226263572f},
-std::array<float,2>{0.48647359f, 0.514558017f},
-std::array<float,2>{0.360483229f, 0.163384855f},
-std::array<float,2>{0.945982397f, 0.721035898f},
-std::array<float,2>{0.685188532f, 0.328512371f},
-std::array<float,2>{0.137782156f, 0.810407162f},
-std::array<float,2>{0.23331964f, 0.109806873f},
-std::array<float,2>{0.701998532f, 0.624963641f},
-std::array<float,2>{0.901055276f, 0.413807482f},
-std::array<float,2>{0.273280472f, 0.96319437f},
-std::array<float,2>{0.407871872f, 0.296729088f},
-std::array<float,2>{0.832595527f, 0.817010105f},
-std::array<float,2>{0.509330153f, 0.188270405f},
-std::array<float,2>{0.0684585199f, 0.62583667f},
-std::array<float,2>{0.179031417f, 0.365216881f},
-std::array<float,2>{0.643934309f, 0.772651613f},
-std::array<float,2>{0.998121262f, 0.147125646f},
-std::array<float,2>{0.316607267f, 0.709726453f},
-std::array<float,2>{0.451099396f, 0.0612199716f},
-std::array<float,2>{0.793250203f, 0.538281858f},
-std::array<float,2>{0.594225764f, 0.478152037f},
-std::array<float,2>{0.0362666138f, 0.907346129f},
-std::array<float,2>{0.112715982f, 0.247679964f},
-std::array<float,2>{0.543900967f, 0.658489943f},
-std::array<float,2>{0.864799082f, 0.270543158f},
-std::array<float,2>{0.404890299f, 0.872513473f},
-std::array<float,2>{0.29095903f, 0.406116605f},
-std::array<float,2>{0.922864437f, 0.976512849f},
-std::array<float,2>{0.721093595f, 0.0857530311f},
-std::array<float,2>{0.189293653f, 0.568785489f},
-std::array<float,2>{0.20324257f, 0.435764968f},
-std::array<float,2>{0.746572256f, 0.948087275f},
-std::array<float,2>{0.914087772f, 0.106702879f},
-std::array<float,2>{0.308759689f, 0.597646952f},
-std::array<float,2>{0.387392879f, 0.214838237f},
-std::array<float,2>{0.852190197f, 0.643511534f},
-std::array<float,2>{0.55712992f, 0.302195996f},
-std::array<float,2>{0.105163679f, 0.837310493f},
-std::array<float,2>{0.0565087683f, 0.00877943542f},
-std::array<float,2>{0.624815226f, 0.519400656f},
-std::array<float,2>{0.802309394f, 0.455500931f},
-std::array<float,2>{0.46600157f, 0.8953529f},
-std::array<float,2>{0.340224952f, 0.314985305f},
-std::array<float,2>{0.978962481f, 0.789224148f},
-std::array<float,2>{0.630191624f, 0.175574824f},
-std::array<float,2>{0.159720972f, 0.741701782f},
-std::array<float,2>{0.0832784176f, 0.264016956f},
-std::array<float,2>{0.525217533f, 0.853695154f},
-std::array<float,2>{0.822945774f, 0.222856537f},
-std::array<float,2>{0.432853878f, 0.67711103f},
-std::array<float,2>{0.260747731f, 0.0744655356f},
-std::array<float,2>{0.884093583f, 0.583912134f},
-std::array<float,2>{0.712968528f, 0.382038504f},
-std::array<float,2>{0.248879448f, 0.999723256f},
-std::array<float,2>{0.143155351f, 0.135282218f},
-std::array<float,2>{0.656324148f, 0.700323284f},
-std::array<float,2>{0.96245122f, 0.349364221f},
-std::array<float,2>{0.352411151f, 0.75488162f},
-std::array<float,2>{0.480605036f, 0.484969437f},
-std::array<float,2>{0.769738734f, 0.924103856f},
-std::array<float,2>{0.592097819f, 0.0462567881f},
-std::array<float,2>{0.0180507731f, 0.548984051f},
-std::array<float,2>{0.0589576103f, 0.394523054f},
-std::array<float,2>{0.621067643f, 0.980613768f},
-std::array<float,2>{0.799219549f, 0.0899589732f},
-std::array<float,2>{0.463699937f, 0.576473415f},
-std::array<float,2>{0.337623715f, 0.235418156f},
-std::array<float,2>{0.982330859f, 0.670272589f},
-std::array<float,2>{0.628541172f, 0.276095361f},
-std::array<float,2>{0.160406157f, 0.859503329f},
-std::array<float,2>{0.210232571f, 0.0499860086f},
-std::array<float,2>{0.745229781f, 0.543162346f},
-std::array<float,2>{0.918372333f, 0.471958101f},
-std::array<float,2>{0.305883229f, 0.914418995f},
-std::array<float,2>{0.384015352f, 0.373118341f},
-std::array<float,2>{0.85888201f, 0.779337525f},
-std::array<float,2>{0.56124264f, 0.14845182f},
-std::array<float,2>{0.106134713f, 0.715607464f},
-std::array<float,2>{0.145016655f, 0.283451974f},
-std::array<float,2>{0.662393093f, 0.822729766f},
-std::array<float,2>{0.967776299f, 0.200764224f},
-std::array<float,2>{0.355930001f, 0.63739413f},
-std::array<float,2>{0.480367988f, 0.121602349f},
-std::array<float,2>{0.769333005f, 0.612508297f},
-std::array<float,2>{0.588639855f, 0.414572179f},
-std::array<float,2>{0.0222402848f, 0.95373559f},
-std::array<float,2>{0.0800221115f, 0.168517992f},
-std::array<float,2>{0.527858496f, 0.731808245f},
-std::array<float,2>{0.826447427f, 0.336367458f},
-std::array<float,2>{0.434195369f, 0.802456856f},
-std::array<float,2>{0.265539527f, 0.446368903f},
-std::array<float,2>{0.889340639f, 0.890381217f},
-std::array<float,2>{0.716907322f, 0.0286406558f},
-std::array<float,2>{0.244373068f, 0.502045095f},
-std::array<float,2>{0.229758024f, 0.495078921f},
-std::array<float,2>{0.696772397f, 0.93064183f},
-std::array<float,2>{0.905888557f, 0.0338825211f},
-std::array<float,2>{0.268353909f, 0.561359286f},
-std::array<float,2>{0.41281116f, 0.128501311f},
-std::array<float,2>{0.831507623f, 0.695187032f},
-std::array<float,2>{0.513440251f, 0.358945787f},
-std::array<float,2>{0.0649055913f, 0.760398746f},
-std::array<float,2>{0.00973791722f, 0.0690302178f},
-std::array<float,2>{0.56622529f, 0.591122568f},
-std::array<float,2>{0.765375316f, 0.387819886f},
-std::array<float,2>{0.491284937f, 0.986414731f},
-std::array<float,2>{0.365235567f, 0.253961772f},
-std::array<float,2>{0.951920629f, 0.851066351f},
-std::array<float,2>{0.680702746f, 0.227884427f},
-std::array<float,2>{0.135014609f, 0.683785796f},
-std::array<float,2>{0.115836211f, 0.320894301f},
-std::array<float,2>{0.539421439f, 0.784144819f},
-std::array<float,2>{0.86149466f, 0.18151544f},
-std::array<float,2>{0.398630798f, 0.744150221f},
-std::array<float,2>{0.29686901f, 0.00102162082f},
-std::array<float,2>{0.928460419f, 0.530156314f},
-std::array<float,2>{0.72495538f, 0.466499746f},
-std::array<float,2>{0.192385748f, 0.901197076f},
-std::array<float,2>{0.174165353f, 0.204012796f},
-std::array<float,2>{0.644598007f, 0.655373275f},
-std::array<float,2>{0.993693113f, 0.309152037f},
-std::array<float,2>{0.316262096f, 0.82884872f},
-std::array<float,2>{0.448989123f, 0.428230435f},
-std::array<float,2>{0.791852951f, 0.94068563f},
-std::array<float,2>{0.598601878f, 0.0943475217f},
-std::array<float,2>{0.0326815732f, 0.603156328f},
-std::array<float,2>{0.0730261952f, 0.460579634f},
-std::array<float,2>{0.501589298f, 0.890655041f},
-std::array<float,2>{0.838986754f, 0.0124500254f},
-std::array<float,2>{0.420027375f, 0.521701276f},
-std::array<float,2>{0.278229147f, 0.176296845f},
-std::array<float,2>{0.891285062f, 0.734969795f},
-std::array<float,2>{0.69247967f, 0.317418963f},
-std::array<float,2>{0.22497271f, 0.794392228f},
-std::array<float,2>{0.125933677f, 0.101933248f},
-std::array<float,2>{0.67491138f, 0.598315835f},
-std::array<float,2>{0.942598999f, 0.431785077f},
-std::array<float,2>{0.371993333f, 0.949635267f},
-std::array<float,2>{0.494100064f, 0.297666788f},
-std::array<float,2>{0.750594676f, 0.841797411f},
-std::array<float,2>{0.577248394f, 0.216038004f},
-std::array<float,2>{0.000898516853f, 0.647674739f},
-std::array<float,2>{0.199310094f, 0.34754163f},
-std::array<float,2>{0.732165575f, 0.751486361f},
-std::array<float,2>{0.930634439f, 0.138644055f},
-std::array<float,2>{0.28295508f, 0.698884249f},
-std::array<float,2>{0.397471964f, 0.0411579907f},
-std::array<float,2>{0.87469101f, 0.55276823f},
-std::array<float,2>{0.536612153f, 0.490094811f},
-std::array<float,2>{0.12406414f, 0.927335978f},
-std::array<float,2>{0.0439595841f, 0.219407901f},
-std::array<float,2>{0.605297089f, 0.674182773f},
-std::array<float,2>{0.788051367f, 0.258424789f},
-std::array<float,2>{0.439051837f, 0.858648896f},
-std::array<float,2>{0.326897591f, 0.377749741f},
-std::array<float,2>{0.99137491f, 0.99417299f},
-std::array<float,2>{0.651531339f, 0.0707735941f},
-std::array<float,2>{0.179819435f, 0.579115748f},
-std::array<float,2>{0.169970304f, 0.407726586f},
-std::array<float,2>{0.640213788f, 0.967285872f},
-std::array<float,2>{0.970191002f, 0.117159814f},
-std::array<float,2>{0.334791332f, 0.619964719f},
-std::array<float,2>{0.458147317f, 0.195070848f},
-std::array<float,2>{0.808282912f, 0.63196373f},
-std::array<float,2>{0.616007686f, 0.292950571f},
-std::array<float,2>{0.0543623604f, 0.816222191f},
-std::array<float,2>{0.0983967111f, 0.016324766f},
-std::array<float,2>{0.549236596f, 0.508858562f},
-std::array<float,2>{0.851174772f, 0.438601583f},
-std::array<float,2>{0.377506137f, 0.882538915f},
-std::array<float,2>{0.302948445f, 0.333604038f},
-std::array<float,2>{0.908537686f, 0.807444155f},
-std::array<float,2>{0.735643208f, 0.157648131f},
-std::array<float,2>{0.218596831f, 0.723366678f},
-std::array<float,2>{0.0298039448f, 0.267485917f},
-std::array<float,2>{0.585233569f, 0.869260073f},
-std::array<float,2>{0.776607096f, 0.242581293f},
-std::array<float,2>{0.472769916f, 0.662255406f},
-std::array<float,2>{0.351536125f, 0.0792130977f},
-std::array<float,2>{0.958993793f, 0.564311028f},
-std::array<float,2>{0.669488311f, 0.401138484f},
-std::array<float,2>{0.152884841f, 0.971942186f},
-std::array<float,2>{0.242121756f, 0.142523721f},
-std::array<float,2>{0.706931233f, 0.705368757f},
-std::array<float,2>{0.88175416f, 0.361050069f},
-std::array<float,2>{0.255524069f, 0.768802583f},
-std::array<float,2>{0.428805351f, 0.48268047f},
-std::array<float,2>{0.81805259f, 0.911239922f},
-std::array<float,2>{0.522843897f, 0.0563020259f},
-std::array<float,2>{0.0912773684f, 0.534849823f},
-std::array<float,2>{0.104521744f, 0.435239732f},
-std::array<float,2>{0.556982815f, 0.947071612f},
-std::array<float,2>{0.851790369f, 0.109209858f},
-std::array<float,2>{0.386767417f, 0.594560146f},
-std::array<float,2>{0.309284031f, 0.211660996f},
-std::array<float,2>{0.91477257f, 0.641635299f},
-std::array<float,2>{0.747003675f, 0.302817136f},
-std::array<float,2>{0.203643113f, 0.839128613f},
-std::array<float,2>{0.15919587f, 0.0104070194f},
-std::array<float,2>{0.630467296f, 0.516102076f},
-std::array<float,2>{0.979217291f, 0.453814477f},
-std::array<float,2>{0.340554267f, 0.896582246f},
-std::array<float,2>{0.466756463f, 0.313078105f},
-std::array<float,2>{0.802169561f, 0.792103887f},
-std::array<float,2>{0.624399066f, 0.173728094f},
-std::array<float,2>{0.0557843298f, 0.738361061f},
-std::array<float,2>{0.248521641f, 0.261835337f},
-std::array<float,2>{0.713857234f, 0.852912247f},
-std::array<float,2>{0.884371996f, 0.224772975f},
-std::array<float,2>{0.261405915f, 0.679219127f},
-std::array<float,2>{0.433257848f, 0.0766648352f},
-std::array<float,2>{0.822304428f, 0.584988356f},
-std::array<float,2>{0.524873078f, 0.380230963f},
-std::array<float,2>{0.0835694745f, 0.997230709f},
-std::array<float,2>{0.0182918403f, 0.133045837f},
-std::array<float,2>{0.592744529f, 0.701379538f},
-std::array<float,2>{0.770426035f, 0.351034582f},
-std::array<float,2>{0.481154263f, 0.757290721f},
-std::array<float,2>{0.352016419f, 0.487589777f},
-std::array<float,2>{0.962237f, 0.922403336f},
-std::array<float,2>{0.656812787f, 0.0431349687f},
-std::array<float,2>{0.142791167f, 0.547141552f},
-std::array<float,2>{0.138476089f, 0.442323416f},
-std::array<float,2>{0.685007393f, 0.875775576f},
-std::array<float,2>{0.945764542f, 0.0196478758f},
-std::array<float,2>{0.361167014f, 0.512703121f},
-std::array<float,2>{0.487204552f, 0.161552072f},
-std::array<float,2>{0.760099709f, 0.720447779f},
-std::array<float,2>{0.567187607f, 0.33033371f},
-std::array<float,2>{0.01241202f, 0.812472045f},
-std::array<float,2>{0.0692294762f, 0.113270231f},
-std::array<float,2>{0.508943677f, 0.62147218f},
-std::array<float,2>{0.832461119f, 0.41047594f},
-std::array<float,2>{0.407321304f, 0.96279484f},
-std::array<float,2>{0.272949219f, 0.293292612f},
-std::array<float,2>{0.900780857f, 0.818619311f},
-std::array<float,2>{0.701386571f, 0.189495444f},
-std::array<float,2>{0.232450023f, 0.628421187f},
-std::array<float,2>{0.0370220281f, 0.366063565f},
-std::array<float,2>{0.59441483f, 0.770076215f},
-std::array<float,2>{0.793713987f, 0.144671485f},
-std::array<float,2>{0.450399935f, 0.708126128f},
-std::array<float,2>{0.3169581f, 0.0604963452f},
-std::array<float,2>{0.998747289f, 0.536371648f},
-std::array<float,2>{0.644308805f, 0.479267269f},
-std::array<float,2>{0.179462984f, 0.909964919f},
-std::array<float,2>{0.188714609f, 0.248786733f},
-std::array<float,2>{0.721360803f, 0.657169342f},
-std::array<float,2>{0.92354852f, 0.272328794f},
-std::array<float,2>{0.290100217f, 0.874949336f},
-std::array<float,2>{0.404625714f, 0.403271198f},
-std::array<float,2>{0.86441505f, 0.973611414f},
-std::array<float,2>{0.543342233f, 0.0836079419f},
-std::array<float,2>{0.113210492f, 0.567501903f},
-std::array<float,2>{0.00768031273f, 0.473667681f},
-std::array<float,2>{0.573902071f, 0.921141148f},
-std::array<float,2>{0.754510343f, 0.0511266701f},
-std::array<float,2>{0.498433083f, 0.54161191f},
-std::array<float,2>{0.369211584f, 0.153610379f},
-std::array<float,2>{0.940844655f, 0.712659895f},
-std::array<float,2>{0.679142296f, 0.370167911f},
-std::array<float,2>{0.131413922f, 0.773492932f},
-std::array<float,2>{0.220099613f, 0.0869051814f},
-std::array<float,2>{0.688622534f, 0.573280871f},
-std::array<float,2>{0.898051143f, 0.398231089f},
-std::array<float,2>{0.276686847f, 0.978962004f},
-std::array<float,2>{0.414897829f, 0.27795428f},
-std::array<float,2>{0.842324436f, 0.866735995f},
-std::array<float,2>{0.507077038f, 0.24145171f},
-std::array<float,2>{0.0771344304f, 0.664485335f},
-std::array<float,2>{0.186526269f, 0.341780007f},
-std::array<float,2>{0.652585626f, 0.800304711f},
-std::array<float,2>{0.986448526f, 0.164800033f},
-std::array<float,2>{0.320355713f, 0.726585865f},
-std::array<float,2>{0.441997707f, 0.0269921366f},
-std::array<float,2>{0.781314313f, 0.506905913f},
-std::array<float,2>{0.607744932f, 0.449580103f},
-std::array<float,2>{0.0399817713f, 0.884674668f},
-std::array<float,2>{0.121017486f, 0.197158605f},
-std::array<float,2>{0.533323646f, 0.636615455f},
-std::array<float,2>{0.869512975f, 0.287075758f},
-std::array<float,2>{0.391747206f, 0.825946689f},
-std::array<float,2>{0.286209971f, 0.418585896f},
-std::array<float,2>{0.934805572f, 0.959789693f},
-std::array<float,2>{0.727035165f, 0.117728435f},
-std::array<float,2>{0.19644694f, 0.61628449f},
-std::array<float,2>{0.212687209f, 0.383151382f},
-std::array<float,2>{0.741381526f, 0.98840183f},
-std::array<float,2>{0.910948753f, 0.064279519f},
-std::array<float,2>{0.29765296f, 0.588846505f},
-std::array<float,2>{0.381033897f, 0.232328564f},
-std::array<float,2>{0.845820427f, 0.679804027f},
-std::array<float,2>{0.551843524f, 0.250043273f},
-std::array<float,2>{0.0969548821f, 0.84438628f},
-std::array<float,2>{0.0479721427f, 0.0385717116f},
-std::array<float,2>{0.613279641f, 0.554891169f},
-std::array<float,2>{0.811220169f, 0.498980641f},
-std::array<float,2>{0.454745352f, 0.93660754f},
-std::array<float,2>{0.329259336f, 0.354012102f},
-std::array<float,2>{0.974373221f, 0.761762738f},
-std::array<float,2>{0.634641469f, 0.129957974f},
-std::array<float,2>{0.164671898f, 0.689956784f},
-std::array<float,2>{0.0872902274f, 0.30541569f},
-std::array<float,2>{0.51681751f, 0.832988203f},
-std::array<float,2>{0.813131392f, 0.208166644f},
-std::array<float,2>{0.422388643f, 0.651460648f},
-std::array<float,2>{0.251647234f, 0.0995148867f},
-std::array<float,2>{0.877540112f, 0.6093238f},
-std::array<float,2>{0.708507836f, 0.424847364f},
-std::array<float,2>{0.235513926f, 0.944209158f},
-std::array<float,2>{0.151211709f, 0.184025049f},
-std::array<float,2>{0.666658461f, 0.748474896f},
-std::array<float,2>{0.956782818f, 0.32492134f},
-std::array<float,2>{0.345462501f, 0.785740852f},
-std::array<float,2>{0.472623855f, 0.464660048f},
-std::array<float,2>{0.780512035f, 0.904085696f},
-std::array<float,2>{0.57872504f, 0.00392639125f},
-std::array<float,2>{0.0260790773f, 0.526581168f},
-std::array<float,2>{0.0195697565f, 0.416912407f},
-std::array<float,2>{0.587227821f, 0.956534147f},
-std::array<float,2>{0.767121971f, 0.124555863f},
-std::array<float,2>{0.476806909f, 0.611134708f},
-std::array<float,2>{0.358932823f, 0.202024043f},
-std::array<float,2>{0.965715468f, 0.639787257f},
-std::array<float,2>{0.660597801f, 0.281858236f},
-std::array<float,2>{0.147522375f, 0.821753979f},
-std::array<float,2>{0.243687674f, 0.0300005153f},
-std::array<float,2>{0.715355873f, 0.50039953f},
-std::array<float,2>{0.887922227f, 0.448573977f},
-std::array<float,2>{0.263279229f, 0.887750685f},
-std::array<float,2>{0.435790062f, 0.338630795f},
-std::array<float,2>{0.824551225f, 0.804370344f},
-std::array<float,2>{0.530698359f, 0.170651704f},
-std::array<float,2>{0.0801451802f, 0.734026015f},
-std::array<float,2>{0.163397074f, 0.273686528f},
-std::array<float,2>{0.626570582f, 0.862721205f},
-std::array<float,2>{0.983614266f, 0.237118348f},
-std::array<float,2>{0.338503808f, 0.668236732f},
-std::array<float,2>{0.46097073f, 0.093257837f},
-std::array<float,2>{0.797678709f, 0.574851573f},
-std::array<float,2>{0.618386984f, 0.392567217f},
-std::array<float,2>{0.062319763f, 0.984122217f},
-std::array<float,2>{0.108611673f, 0.152041823f},
-std::array<float,2>{0.559675932f, 0.717696309f},
-std::array<float,2>{0.855979383f, 0.372259766f},
-std::array<float,2>{0.385819405f, 0.778729975f},
-std::array<float,2>{0.307506025f, 0.469995648f},
-std::array<float,2>{0.921507895f, 0.916087031f},
-std::array<float,2>{0.742677629f, 0.0479341783f},
-std::array<float,2>{0.208545476f, 0.546535254f},
-std::array<float,2>{0.194116771f, 0.468210846f},
-std::array<float,2>{0.724276125f, 0.899066091f},
-std::array<float,2>{0.927527547f, 0.00263641053f},
-std::array<float,2>{0.29434514f, 0.529119074f},
-std::array<float,2>{0.402325541f, 0.182590276f},
-std::array<float,2>{0.861021936f, 0.74337101f},
-std::array<float,2>{0.542653441f, 0.324207932f},
-std::array<float,2>{0.114239968f, 0.782244086f},
-std::array<float,2>{0.0334786139f, 0.0968196094f},
-std::array<float,2>{0.600292623f, 0.604133844f},
-std::array<float,2>{0.790875256f, 0.427395582f},
-std::array<float,2>{0.446778208f, 0.939348459f},
-std::array<float,2>{0.314394146f, 0.312147707f},
-std::array<float,2>{0.994511366f, 0.831636369f},
-std::array<float,2>{0.646699131f, 0.206887186f},
-std::array<float,2>{0.172088265f, 0.65317148f},
-std::array<float,2>{0.0632934272f, 0.356887549f},
-std::array<float,2>{0.515299737f, 0.759197354f},
-std::array<float,2>{0.830057144f, 0.126615211f},
-std::array<float,2>{0.411576897f, 0.692836463f},
-std::array<float,2>{0.265838265f, 0.0320437439f},
-std::array<float,2>{0.904110551f, 0.559557199f},
-std::array<float,2>{0.699109852f, 0.494109243f},
-std::array<float,2>{0.22691375f, 0.932161808f},
-std::array<float,2>{0.133160397f, 0.228964925f},
-std::array<float,2>{0.681947589f, 0.686536252f},
-std::array<float,2>{0.949790239f, 0.257024467f},
-std::array<float,2>{0.365125179f, 0.848602176f},
-std::array<float,2>{0.488978684f, 0.38920477f},
-std::array<float,2>{0.76201272f, 0.985686541f},
-std::array<float,2>{0.563259482f, 0.0668648034f},
-std::array<float,2>{0.010435788f, 0.592735469f},
-std::array<float,2>{0.122925192f, 0.492012292f},
-std::array<float,2>{0.537807345f, 0.929653108f},
-std::array<float,2>{0.871576786f, 0.0399626568f},
-std::array<float,2>{0.395671993f, 0.552390337f},
-std::array<float,2>{0.284898788f, 0.140492693f},
-std::array<float,2>{0.933264554f, 0.695462584f},
-std::array<float,2>{0.733120203f, 0.34463504f},
-std::array<float,2>{0.201455072f, 0.753396332f},
-std::array<float,2>{0.182631433f, 0.0734307021f},
-std::array<float,2>{0.64918077f, 0.58177042f},
-std::array<float,2>{0.988703787f, 0.376930803f},
-std::array<float,2>{0.324718535f, 0.993200421f},
-std::array<float,2>{0.441184878f, 0.260475934f},
-std::array<float,2>{0.785704374f, 0.857246161f},
-std::array<float,2>{0.603227794f, 0.222368374f},
-std::array<float,2>{0.0458654575f, 0.672215939f},
-std::array<float,2>{0.224567518f, 0.318850517f},
-std::array<float,2>{0.695289731f, 0.795066357f},
-std::array<float,2>{0.894231141f, 0.178251058f},
-std::array<float,2>{0.280845374f, 0.737675428f},
-std::array<float,2>{0.419397712f, 0.0146636441f},
-std::array<float,2>{0.837480247f, 0.5202142f},
-std::array<float,2>{0.502724111f, 0.458957553f},
-std::array<float,2>{0.0715844482f, 0.893418729f},
-std::array<float,2>{0.0022597413f, 0.2171202f},
-std::array<float,2>{0.575086117f, 0.645577192f},
-std::array<float,2>{0.753508329f, 0.300622433f},
-std::array<float,2>{0.4954997f, 0.8408916f},
-std::array<float,2>{0.373215675f, 0.430297971f},
-std::array<float,2>{0.944303691f, 0.952943146f},
-std::array<float,2>{0.6729756f, 0.105456635f},
-std::array<float,2>{0.128165975f, 0.601464689f},
-std::array<float,2>{0.155320153f, 0.39875114f},
-std::array<float,2>{0.670956373f, 0.969232142f},
-std::array<float,2>{0.958804488f, 0.0807132721f},
-std::array<float,2>{0.348214597f, 0.565989196f},
-std::array<float,2>{0.47478354f, 0.244244963f},
-std::array<float,2>{0.775168955f, 0.661699176f},
-std::array<float,2>{0.582897902f, 0.269061089f},
-std::array<float,2>{0.0280145835f, 0.868229032f},
-std::array<float,2>{0.092057094f, 0.05809265f},
-std::array<float,2>{0.52132529f, 0.532277346f},
-std::array<float,2>{0.819996834f, 0.482155889f},
-std::array<float,2>{0.426992446f, 0.912663221f},
-std::array<float,2>{0.256504893f, 0.361831337f},
-std::array<float,2>{0.879041493f, 0.76659447f},
-std::array<float,2>{0.703329384f, 0.143788725f},
-std::array<float,2>{0.238563865f, 0.704663277f},
-std::array<float,2>{0.0509514064f, 0.290207565f},
-std::array<float,2>{0.614290416f, 0.813214719f},
-std::array<float,2>{0.805584013f, 0.19249177f},
-std::array<float,2>{0.460521936f, 0.629327953f},
-std::array<float,2>{0.332335323f, 0.11516463f},
-std::array<float,2>{0.971044242f, 0.618535399f},
-std::array<float,2>{0.636879683f, 0.408796102f},
-std::array<float,2>{0.167980283f, 0.964997888f},
-std::array<float,2>{0.21548456f, 0.158240899f},
-std::array<float,2>{0.736384869f, 0.724990427f},
-std::array<float,2>{0.906836987f, 0.335052729f},
-std::array<float,2>{0.301778853f, 0.806496799f},
-std::array<float,2>{0.375795454f, 0.440898895f},
-std::array<float,2>{0.848256707f, 0.880725443f},
-std::array<float,2>{0.547566473f, 0.0190734956f},
-std::array<float,2>{0.101356611f, 0.510892153f},
-std::array<float,2>{0.0850657374f, 0.382399738f},
-std::array<float,2>{0.526741564f, 0.999276876f},
-std::array<float,2>{0.821792424f, 0.0750529096f},
-std::array<float,2>{0.431166649f, 0.583207667f},
-std::array<float,2>{0.25789088f, 0.223434523f},
-std::array<float,2>{0.885697365f, 0.677248776f},
-std::array<float,2>{0.71135062f, 0.264636308f},
-std::array<float,2>{0.246242821f, 0.854473472f},
-std::array<float,2>{0.141910136f, 0.0465163514f},
-std::array<float,2>{0.658263266f, 0.549583554f},
-std::array<float,2>{0.964261174f, 0.484724313f},
-std::array<float,2>{0.354204297f, 0.924327075f},
-std::array<float,2>{0.483229518f, 0.349017173f},
-std::array<float,2>{0.771561921f, 0.754081368f},
-std::array<float,2>{0.589997292f, 0.134936705f},
-std::array<float,2>{0.0167770199f, 0.701115072f},
-std::array<float,2>{0.206504092f, 0.302295804f},
-std::array<float,2>{0.74956882f, 0.837811351f},
-std::array<float,2>{0.917077661f, 0.21419996f},
-std::array<float,2>{0.311980516f, 0.642675102f},
-std::array<float,2>{0.389517367f, 0.107171282f},
-std::array<float,2>{0.85400939f, 0.596705437f},
-std::array<float,2>{0.555160284f, 0.436217338f},
-std::array<float,2>{0.103174366f, 0.947751939f},
-std::array<float,2>{0.0578878447f, 0.175258905f},
-std::array<float,2>{0.622473598f, 0.741226554f},
-std::array<float,2>{0.804213703f, 0.314674169f},
-std::array<float,2>{0.467114747f, 0.789939046f},
-std::array<float,2>{0.342030674f, 0.455630034f},
-std::array<float,2>{0.976628125f, 0.894700766f},
-std::array<float,2>{0.631537557f, 0.00820386689f},
-std::array<float,2>{0.157786787f, 0.51898253f},
-std::array<float,2>{0.177004278f, 0.477626175f},
-std::array<float,2>{0.641284347f, 0.908137977f},
-std::array<float,2>{0.997606337f, 0.0608798824f},
-std::array<float,2>{0.319255531f, 0.538863599f},
-std::array<float,2>{0.452779472f, 0.146574408f},
-std::array<float,2>{0.796212852f, 0.709416151f},
-std::array<float,2>{0.596321583f, 0.364471585f},
-std::array<float,2>{0.0388625227f, 0.773340523f},
-std::array<float,2>{0.111058928f, 0.0853614137f},
-std::array<float,2>{0.545136869f, 0.569066942f},
-std::array<float,2>{0.865604818f, 0.405385911f},
-std::array<float,2>{0.403406233f, 0.975600421f},
-std::array<float,2>{0.292494327f, 0.27119264f},
-std::array<float,2>{0.924139619f, 0.872591019f},
-std::array<float,2>{0.718785226f, 0.247209713f},
-std::array<float,2>{0.189823747f, 0.65876317f},
-std::array<float,2>{0.0154344589f, 0.329025894f},
-std::array<float,2>{0.568399251f, 0.809940875f},
-std::array<float,2>{0.75860101f, 0.163880572f},
-std::array<float,2>{0.485995501f, 0.721525192f},
-std::array<float,2>{0.362110853f, 0.0233332757f},
-std::array<float,2>{0.947849035f, 0.513706863f},
-std::array<float,2>{0.685857952f, 0.4447999f},
-std::array<float,2>{0.138899297f, 0.877099156f},
-std::array<float,2>{0.232039541f, 0.187868059f},
-std::array<float,2>{0.699460089f, 0.625058353f},
-std::array<float,2>{0.900096178f, 0.296126127f},
-std::array<float,2>{0.271438092f, 0.816851199f},
-std::array<float,2>{0.410100073f, 0.413485795f},
-std::array<float,2>{0.834282577f, 0.963770866f},
-std::array<float,2>{0.510660589f, 0.110174738f},
-std::array<float,2>{0.0683411583f, 0.624119639f},
-std::array<float,2>{0.0428875722f, 0.451477855f},
-std::array<float,2>{0.606970429f, 0.886385858f},
-std::array<float,2>{0.784873247f, 0.0242165178f},
-std::array<float,2>{0.443650931f, 0.504176378f},
-std::array<float,2>{0.323054016f, 0.166814327f},
-std::array<float,2>{0.985695004f, 0.730341554f},
-std::array<float,2>{0.655845404f, 0.342069983f},
-std::array<float,2>{0.183594555f, 0.797920644f},
-std::array<float,2>{0.197879195f, 0.120272107f},
-std::array<float,2>{0.728796721f, 0.613700509f},
-std::array<float,2>{0.936108828f, 0.421716779f},
-std::array<float,2>{0.287157655f, 0.957895517f},
-std::array<float,2>{0.393696129f, 0.287693679f},
-std::array<float,2>{0.867354751f, 0.828115642f},
-std::array<float,2>{0.531533539f, 0.197880417f},
-std::array<float,2>{0.118121125f, 0.634454608f},
-std::array<float,2>{0.129536808f, 0.367779821f},
-std::array<float,2>{0.677337229f, 0.776866317f},
-std::array<float,2>{0.937523723f, 0.15618071f},
-std::array<float,2>{0.367895126f, 0.713379025f},
-std::array<float,2>{0.496990621f, 0.0546625741f},
-std::array<float,2>{0.756702483f, 0.540376961f},
-std::array<float,2>{0.57090348f, 0.476062357f},
-std::array<float,2>{0.00581468083f, 0.918816507f},
-std::array<float,2>{0.0745710209f, 0.239772663f},
-std::array<float,2>{0.504546642f, 0.667746365f},
-std::array<float,2>{0.841467857f, 0.280752897f},
-std::array<float,2>{0.417065591f, 0.864698231f},
-std::array<float,2>{0.274410784f, 0.395404398f},
-std::array<float,2>{0.896203458f, 0.976603985f},
-std::array<float,2>{0.690192342f, 0.0884743705f},
-std::array<float,2>{0.220955446f, 0.572120547f},
-std::array<float,2>{0.237342462f, 0.421903998f},
-std::array<float,2>{0.71039933f, 0.941562414f},
-std::array<float,2>{0.87601161f, 0.0999042466f},
-std::array<float,2>{0.253309608f, 0.606696427f},
-std::array<float,2>{0.424127847f, 0.209744304f},
-std::array<float,2>{0.816049397f, 0.649978518f},
-std::array<float,2>{0.518649101f, 0.307451785f},
-std::array<float,2>{0.0897192284f, 0.835478485f},
-std::array<float,2>{0.0240363721f, 0.00723563973f},
-std::array<float,2>{0.580336332f, 0.524760962f},
-std::array<float,2>{0.777858734f, 0.462727517f},
-std::array<float,2>{0.468759805f, 0.905448854f},
-std::array<float,2>{0.346583247f, 0.328122228f},
-std::array<float,2>{0.954230249f, 0.788010538f},
-std::array<float,2>{0.665993333f, 0.186632067f},
-std::array<float,2>{0.14989996f, 0.746358395f},
-std::array<float,2>{0.094272241f, 0.252827764f},
-std::array<float,2>{0.553601921f, 0.846381307f},
-std::array<float,2>{0.843971431f, 0.233896777f},
-std::array<float,2>{0.379370153f, 0.682368577f},
-std::array<float,2>{0.299356997f, 0.0646898597f},
-std::array<float,2>{0.912417293f, 0.58678472f},
-std::array<float,2>{0.738863528f, 0.385772586f},
-std::array<float,2>{0.214036688f, 0.991413713f},
-std::array<float,2>{0.166835189f, 0.131158367f},
-std::array<float,2>{0.635712981f, 0.688366294f},
-std::array<float,2>{0.976505041f, 0.352085739f},
-std::array<float,2>{0.330415696f, 0.764925778f},
-std::array<float,2>{0.456384093f, 0.496227056f},
-std::array<float,2>{0.809117258f, 0.934099495f},
-std::array<float,2>{0.610573232f, 0.0363383964f},
-std::array<float,2>{0.0500154905f, 0.556831598f},
-std::array<float,2>{0.0110518336f, 0.387691855f},
-std::array<float,2>{0.563984573f, 0.987858295f},
-std::array<float,2>{0.76279217f, 0.0698043928f},
-std::array<float,2>{0.490002066f, 0.589870393f},
-std::array<float,2>{0.363880634f, 0.227372959f},
-std::array<float,2>{0.950796366f, 0.685048401f},
-std::array<float,2>{0.682948351f, 0.255312383f},
-std::array<float,2>{0.133912668f, 0.850337863f},
-std::array<float,2>{0.228155628f, 0.0343364254f},
-std::array<float,2>{0.698099434f, 0.562137127f},
-std::array<float,2>{0.903115094f, 0.495807469f},
-std::array<float,2>{0.266801685f, 0.93140018f},
-std::array<float,2>{0.410505354f, 0.35820511f},
-std::array<float,2>{0.828733504f, 0.760900259f},
-std::array<float,2>{0.514085114f, 0.127124369f},
-std::array<float,2>{0.0639592782f, 0.69409138f},
-std::array<float,2>{0.173673615f, 0.310310036f},
-std::array<float,2>{0.647579551f, 0.829554558f},
-std::array<float,2>{0.995136559f, 0.204853565f},
-std::array<float,2>{0.312574506f, 0.655136704f},
-std::array<float,2>{0.44628185f, 0.094900243f},
-std::array<float,2>{0.7897802f, 0.602493703f},
-std::array<float,2>{0.600819945f, 0.429673016f},
-std::array<float,2>{0.0348536894f, 0.939489841f},
-std::array<float,2>{0.114666365f, 0.180416837f},
-std::array<float,2>{0.54138732f, 0.745397747f},
-std::array<float,2>{0.860295951f, 0.321871549f},
-std::array<float,2>{0.400958508f, 0.784262002f},
-std::array<float,2>{0.29338035f, 0.465569943f},
-std::array<float,2>{0.926502109f, 0.901413679f},
-std::array<float,2>{0.723123789f, 0.000489128637f},
-std::array<float,2>{0.19507201f, 0.530390561f},
-std::array<float,2>{0.207752123f, 0.471055537f},
-std::array<float,2>{0.743853986f, 0.915678024f},
-std::array<float,2>{0.920277119f, 0.0489886291f},
-std::array<float,2>{0.308275998f, 0.544246554f},
-std::array<float,2>{0.385310739f, 0.149663821f},
-std::array<float,2>{0.857309163f, 0.716211557f},
-std::array<float,2>{0.55929476f, 0.37496087f},
-std::array<float,2>{0.107760325f, 0.780812442f},
-std::array<float,2>{0.060563039f, 0.09116593f},
-std::array<float,2>{0.617830157f, 0.577517331f},
-std::array<float,2>{0.798260927f, 0.392723799f},
-std::array<float,2>{0.462612033f, 0.981737435f},
-std::array<float,2>{0.33897236f, 0.277126163f},
-std::array<float,2>{0.982506692f, 0.861169159f},
-std::array<float,2>{0.625807941f, 0.235306889f},
-std::array<float,2>{0.16302228f, 0.671141267f},
-std::array<float,2>{0.0814166367f, 0.337779671f},
-std::array<float,2>{0.53022182f, 0.800973356f},
-std::array<float,2>{0.826132178f, 0.169589296f},
-std::array<float,2>{0.437133133f, 0.731426775f},
-std::array<float,2>{0.262479693f, 0.0279786438f},
-std::array<float,2>{0.886941969f, 0.503207922f},
-std::array<float,2>{0.716558635f, 0.446226448f},
-std::array<float,2>{0.242858335f, 0.889143467f},
-std::array<float,2>{0.14722082f, 0.199309066f},
-std::array<float,2>{0.661779165f, 0.638122737f},
-std::array<float,2>{0.966186523f, 0.284691602f},
-std::array<float,2>{0.35782674f, 0.823967695f},
-std::array<float,2>{0.478038996f, 0.415563822f},
-std::array<float,2>{0.766537666f, 0.954824626f},
-std::array<float,2>{0.586247861f, 0.122999743f},
-std::array<float,2>{0.0205641948f, 0.611718237f},
-std::array<float,2>{0.100264437f, 0.438117951f},
-std::array<float,2>{0.548067272f, 0.881075025f},
-std::array<float,2>{0.849507809f, 0.0174278729f},
-std::array<float,2>{0.376624554f, 0.50798893f},
-std::array<float,2>{0.30095166f, 0.156449124f},
-std::array<float,2>{0.907469213f, 0.723988295f},
-std::array<float,2>{0.737373412f, 0.332624674f},
-std::array<float,2>{0.21636872f, 0.807768583f},
-std::array<float,2>{0.169554114f, 0.116180591f},
-std::array<float,2>{0.638269186f, 0.620123506f},
-std::array<float,2>{0.971697509f, 0.406857133f},
-std::array<float,2>{0.333915532f, 0.967878342f},
-std::array<float,2>{0.459603667f, 0.291458428f},
-std::array<float,2>{0.806402564f, 0.815114796f},
-std::array<float,2>{0.613584161f, 0.19362101f},
-std::array<float,2>{0.0522811152f, 0.631253004f},
-std::array<float,2>{0.239915967f, 0.359988749f},
-std::array<float,2>{0.704517365f, 0.768455267f},
-std::array<float,2>{0.880749285f, 0.141421348f},
-std::array<float,2>{0.257136315f, 0.70636189f},
-std::array<float,2>{0.426671445f, 0.0552834347f},
-std::array<float,2>{0.819067776f, 0.533784091f},
-std::array<float,2>{0.520071447f, 0.483919144f},
-std::array<float,2>{0.0932223201f, 0.910630941f},
-std::array<float,2>{0.0291690808f, 0.243853092f},
-std::array<float,2>{0.583745003f, 0.663948834f},
-std::array<float,2>{0.774369717f, 0.266056895f},
-std::array<float,2>{0.476008952f, 0.870274007f},
-std::array<float,2>{0.34865734f, 0.401847273f},
-std::array<float,2>{0.957576513f, 0.971359551f},
-std::array<float,2>{0.669954598f, 0.0781438947f},
-std::array<float,2>{0.154588982f, 0.56345439f},
-std::array<float,2>{0.127829328f, 0.432659f},
-std::array<float,2>{0.67274946f, 0.950501323f},
-std::array<float,2>{0.944602311f, 0.10265404f},
-std::array<float,2>{0.374643117f, 0.598725677f},
-std::array<float,2>{0.49442777f, 0.215490982f},
-std::array<float,2>{0.752407134f, 0.646900117f},
-std::array<float,2>{0.576043546f, 0.297994077f},
-std::array<float,2>{0.00342326867f, 0.843605042f},
-std::array<float,2>{0.0704929903f, 0.0133454595f},
-std::array<float,2>{0.50320375f, 0.522698641f},
-std::array<float,2>{0.836019456f, 0.45912835f},
-std::array<float,2>{0.418934166f, 0.891790867f},
-std::array<float,2>{0.279655159f, 0.317140162f},
-std::array<float,2>{0.892647862f, 0.793484092f},
-std::array<float,2>{0.694120228f, 0.177019119f},
-std::array<float,2>{0.223270252f, 0.735357761f},
-std::array<float,2>{0.0459111184f, 0.259693444f},
-std::array<float,2>{0.601654351f, 0.857984126f},
-std::array<float,2>{0.786972106f, 0.220202833f},
-std::array<float,2>{0.439789295f, 0.675449908f},
-std::array<float,2>{0.325691909f, 0.071429491f},
-std::array<float,2>{0.989842236f, 0.57844156f},
-std::array<float,2>{0.64946121f, 0.378202796f},
-std::array<float,2>{0.181777656f, 0.995648086f},
-std::array<float,2>{0.202638447f, 0.137527615f},
-std::array<float,2>{0.734029233f, 0.698126674f},
-std::array<float,2>{0.932168603f, 0.346612155f},
-std::array<float,2>{0.28348127f, 0.750809133f},
-std::array<float,2>{0.395068437f, 0.488436759f},
-std::array<float,2>{0.872818708f, 0.926400006f},
-std::array<float,2>{0.538280249f, 0.0420837626f},
-std::array<float,2>{0.121248722f, 0.554437816f},
-std::array<float,2>{0.0666040704f, 0.412087142f},
-std::array<float,2>{0.511678934f, 0.961509943f},
-std::array<float,2>{0.834967673f, 0.112055942f},
-std::array<float,2>{0.408922493f, 0.622559071f},
-std::array<float,2>{0.269553065f, 0.190854549f},
-std::array<float,2>{0.899387896f, 0.627656102f},
-std::array<float,2>{0.701022208f, 0.294108033f},
-std::array<float,2>{0.231119573f, 0.820242286f},
-std::array<float,2>{0.139708742f, 0.0209222902f},
-std::array<float,2>{0.687024891f, 0.512336075f},
-std::array<float,2>{0.948709488f, 0.442892849f},
-std::array<float,2>{0.363156557f, 0.876437545f},
-std::array<float,2>{0.484452695f, 0.331419706f},
-std::array<float,2>{0.75938648f, 0.810900986f},
-std::array<float,2>{0.570205092f, 0.160979301f},
-std::array<float,2>{0.0142433234f, 0.718911469f},
-std::array<float,2>{0.190868616f, 0.272834182f},
-std::array<float,2>{0.720464885f, 0.87380302f},
-std::array<float,2>{0.925653458f, 0.249578506f},
-std::array<float,2>{0.291440278f, 0.657250524f},
-std::array<float,2>{0.402682245f, 0.0823573619f},
-std::array<float,2>{0.866771519f, 0.566893518f},
-std::array<float,2>{0.546716034f, 0.403355777f},
-std::array<float,2>{0.109908834f, 0.974549532f},
-std::array<float,2>{0.0374286771f, 0.145683646f},
-std::array<float,2>{0.596848547f, 0.707279921f},
-std::array<float,2>{0.795007527f, 0.366810501f},
-std::array<float,2>{0.451687843f, 0.770661175f},
-std::array<float,2>{0.319756716f, 0.480104178f},
-std::array<float,2>{0.996566415f, 0.909134746f},
-std::array<float,2>{0.642267227f, 0.0591639802f},
-std::array<float,2>{0.176673785f, 0.535368741f},
-std::array<float,2>{0.156414255f, 0.454820663f},
-std::array<float,2>{0.632719278f, 0.897963822f},
-std::array<float,2>{0.9783355f, 0.0114615569f},
-std::array<float,2>{0.3432419f, 0.517162383f},
-std::array<float,2>{0.468555272f, 0.172172427f},
-std::array<float,2>{0.802929997f, 0.739509881f},
-std::array<float,2>{0.621168494f, 0.313534141f},
-std::array<float,2>{0.0571666658f, 0.791615725f},
-std::array<float,2>{0.101572782f, 0.107597105f},
-std::array<float,2>{0.555665433f, 0.59473753f},
-std::array<float,2>{0.855030477f, 0.433871657f},
-std::array<float,2>{0.389942139f, 0.945974708f},
-std::array<float,2>{0.310771435f, 0.303806603f},
-std::array<float,2>{0.916695476f, 0.838768125f},
-std::array<float,2>{0.748461008f, 0.212079257f},
-std::array<float,2>{0.205700591f, 0.640645742f},
-std::array<float,2>{0.0164170656f, 0.350192755f},
-std::array<float,2>{0.591598928f, 0.756629705f},
-std::array<float,2>{0.773229182f, 0.13381952f},
-std::array<float,2>{0.483926773f, 0.702663302f},
-std::array<float,2>{0.355121404f, 0.044468753f},
-std::array<float,2>{0.962971509f, 0.548597336f},
-std::array<float,2>{0.65988946f, 0.486923099f},
-std::array<float,2>{0.141047448f, 0.923147619f},
-std::array<float,2>{0.247784093f, 0.225815251f},
-std::array<float,2>{0.712764263f, 0.678227067f},
-std::array<float,2>{0.886667073f, 0.263131648f},
-std::array<float,2>{0.259371907f, 0.852308571f},
-std::array<float,2>{0.429821432f, 0.379198253f},
-std::array<float,2>{0.821202219f, 0.996498942f},
-std::array<float,2>{0.526017249f, 0.07763087f},
-std::array<float,2>{0.0845649168f, 0.584026098f},
-std::array<float,2>{0.0493716821f, 0.499295831f},
-std::array<float,2>{0.610184908f, 0.936386049f},
-std::array<float,2>{0.810448408f, 0.0378446504f},
-std::array<float,2>{0.455142617f, 0.555999041f},
-std::array<float,2>{0.331968695f, 0.129577115f},
-std::array<float,2>{0.975272119f, 0.690793633f},
-std::array<float,2>{0.635774553f, 0.354841083f},
-std::array<float,2>{0.167656541f, 0.763544679f},
-std::array<float,2>{0.212984905f, 0.0630980209f},
-std::array<float,2>{0.739728749f, 0.589830339f},
-std::array<float,2>{0.913116395f, 0.384022236f},
-std::array<float,2>{0.300302953f, 0.989946604f},
-std::array<float,2>{0.380379379f, 0.2510162f},
-std::array<float,2>{0.844930053f, 0.844944f},
-std::array<float,2>{0.554177284f, 0.230605766f},
-std::array<float,2>{0.0955093279f, 0.681194425f},
-std::array<float,2>{0.148589581f, 0.326108068f},
-std::array<float,2>{0.664924085f, 0.786529303f},
-std::array<float,2>{0.953893185f, 0.184994131f},
-std::array<float,2>{0.346992671f, 0.749357522f},
-std::array<float,2>{0.469752222f, 0.00533003267f},
-std::array<float,2>{0.778960586f, 0.525445163f},
-std::array<float,2>{0.581085861f, 0.463347167f},
-std::array<float,2>{0.0248097237f, 0.903273761f},
-std::array<float,2>{0.0883902386f, 0.20797886f},
-std::array<float,2>{0.51762718f, 0.65055716f},
-std::array<float,2>{0.81541431f, 0.305779934f},
-std::array<float,2>{0.425217837f, 0.833925605f},
-std::array<float,2>{0.252081305f, 0.424100488f},
-std::array<float,2>{0.875926137f, 0.944816172f},
-std::array<float,2>{0.709554911f, 0.0980471075f},
-std::array<float,2>{0.236477673f, 0.608117044f},
-std::array<float,2>{0.221936107f, 0.39711085f},
-std::array<float,2>{0.691111207f, 0.980333209f},
-std::array<float,2>{0.894942343f, 0.0869783983f},
-std::array<float,2>{0.275035501f, 0.572772026f},
-std::array<float,2>{0.416022509f, 0.240698099f},
-std::array<float,2>{0.839881063f, 0.665582538f},
-std::array<float,2>{0.505349874f, 0.278984427f},
-std::array<float,2>{0.0757175982f, 0.865571558f},
-std::array<float,2>{0.00477044983f, 0.0519001633f},
-std::array<float,2>{0.571820676f, 0.542421162f},
-std::array<float,2>{0.757141709f, 0.472844124f},
-std::array<float,2>{0.497583449f, 0.919924617f},
-std::array<float,2>{0.368481457f, 0.369206697f},
-std::array<float,2>{0.938558936f, 0.77518332f},
-std::array<float,2>{0.676320195f, 0.152732864f},
-std::array<float,2>{0.130375102f, 0.711236537f},
-std::array<float,2>{0.118229657f, 0.285597116f},
-std::array<float,2>{0.533000767f, 0.824940741f},
-std::array<float,2>{0.868540406f, 0.195590734f},
-std::array<float,2>{0.393024534f, 0.635181308f},
-std::array<float,2>{0.288214803f, 0.118880756f},
-std::array<float,2>{0.937363386f, 0.615573585f},
-std::array<float,2>{0.72958833f, 0.419073105f},
-std::array<float,2>{0.199122161f, 0.960666597f},
-std::array<float,2>{0.184658602f, 0.165155008f},
-std::array<float,2>{0.654545009f, 0.728060663f},
-std::array<float,2>{0.985037923f, 0.340574801f},
-std::array<float,2>{0.323397666f, 0.79890883f},
-std::array<float,2>{0.444975138f, 0.450661629f},
-std::array<float,2>{0.78353101f, 0.883293509f},
-std::array<float,2>{0.606060624f, 0.0255636163f},
-std::array<float,2>{0.041681651f, 0.506227374f},
-std::array<float,2>{0.0317877904f, 0.426154464f},
-std::array<float,2>{0.598710656f, 0.938153207f},
-std::array<float,2>{0.792889774f, 0.0961217433f},
-std::array<float,2>{0.447645515f, 0.604921997f},
-std::array<float,2>{0.315020353f, 0.205994576f},
-std::array<float,2>{0.99287045f, 0.654035449f},
-std::array<float,2>{0.645630658f, 0.311446071f},
-std::array<float,2>{0.175504819f, 0.830420077f},
-std::array<float,2>{0.192032486f, 0.00356744416f},
-std::array<float,2>{0.726491392f, 0.527862668f},
-std::array<float,2>{0.928810418f, 0.467125118f},
-std::array<float,2>{0.295344651f, 0.900236547f},
-std::array<float,2>{0.399554074f, 0.32275781f},
-std::array<float,2>{0.86313504f, 0.781786442f},
-std::array<float,2>{0.540888011f, 0.182720706f},
-std::array<float,2>{0.11641752f, 0.74218756f},
-std::array<float,2>{0.135793269f, 0.256488204f},
-std::array<float,2>{0.679987133f, 0.848774254f},
-std::array<float,2>{0.952567875f, 0.230212331f},
-std::array<float,2>{0.366890281f, 0.685621858f},
-std::array<float,2>{0.491068542f, 0.0676595345f},
-std::array<float,2>{0.764405727f, 0.593429506f},
-std::array<float,2>{0.564476252f, 0.390234202f},
-std::array<float,2>{0.00796239916f, 0.984986901f},
-std::array<float,2>{0.066149123f, 0.125600696f},
-std::array<float,2>{0.512215734f, 0.69202286f},
-std::array<float,2>{0.830951512f, 0.356165022f},
-std::array<float,2>{0.413790524f, 0.758430481f},
-std::array<float,2>{0.269420207f, 0.492251277f},
-std::array<float,2>{0.904307783f, 0.932977796f},
-std::array<float,2>{0.695888937f, 0.0322381407f},
-std::array<float,2>{0.229059786f, 0.560402095f},
-std::array<float,2>{0.245657548f, 0.447896689f},
-std::array<float,2>{0.718150198f, 0.886779189f},
-std::array<float,2>{0.890458167f, 0.0303232726f},
-std::array<float,2>{0.264023095f, 0.50177002f},
-std::array<float,2>{0.435227901f, 0.171284914f},
-std::array<float,2>{0.82722342f, 0.732689738f},
-std::array<float,2>{0.528780401f, 0.339197218f},
-std::array<float,2>{0.0786868259f, 0.803552628f},
-std::array<float,2>{0.0233800653f, 0.123476967f},
-std::array<float,2>{0.589143515f, 0.609888673f},
-std::array<float,2>{0.767678976f, 0.417297035f},
-std::array<float,2>{0.479079485f, 0.955840945f},
-std::array<float,2>{0.356754661f, 0.282867491f},
-std::array<float,2>{0.967503726f, 0.820332885f},
-std::array<float,2>{0.663257837f, 0.202845335f},
-std::array<float,2>{0.145991087f, 0.638948143f},
-std::array<float,2>{0.106797628f, 0.371126652f},
-std::array<float,2>{0.561921179f, 0.778068364f},
-std::array<float,2>{0.857865393f, 0.150668666f},
-std::array<float,2>{0.383610964f, 0.717910707f},
-std::array<float,2>{0.304729074f, 0.0475091115f},
-std::array<float,2>{0.919910073f, 0.544973612f},
-std::array<float,2>{0.745029747f, 0.469648212f},
-std::array<float,2>{0.209307715f, 0.917773724f},
-std::array<float,2>{0.161768779f, 0.237729266f},
-std::array<float,2>{0.627903223f, 0.669278741f},
-std::array<float,2>{0.98071456f, 0.274439335f},
-std::array<float,2>{0.336580455f, 0.86139816f},
-std::array<float,2>{0.464496732f, 0.391031146f},
-std::array<float,2>{0.800629258f, 0.982593894f},
-std::array<float,2>{0.619351625f, 0.0927446708f},
-std::array<float,2>{0.0596196651f, 0.575410485f},
-std::array<float,2>{0.0906473547f, 0.480799735f},
-std::array<float,2>{0.52153492f, 0.913648427f},
-std::array<float,2>{0.817084491f, 0.0569518954f},
-std::array<float,2>{0.428455889f, 0.532111466f},
-std::array<float,2>{0.254016936f, 0.143300056f},
-std::array<float,2>{0.882532954f, 0.703483701f},
-std::array<float,2>{0.70559299f, 0.362491369f},
-std::array<float,2>{0.240304604f, 0.766916752f},
-std::array<float,2>{0.154270247f, 0.0816773996f},
-std::array<float,2>{0.668807268f, 0.564550161f},
-std::array<float,2>{0.960056126f, 0.399769366f},
-std::array<float,2>{0.349826425f, 0.970499277f},
-std::array<float,2>{0.474429727f, 0.26820159f},
-std::array<float,2>{0.776242197f, 0.867723227f},
-std::array<float,2>{0.584018886f, 0.245986491f},
-std::array<float,2>{0.0310481042f, 0.660854876f},
-std::array<float,2>{0.217264846f, 0.334304303f},
-std::array<float,2>{0.73504293f, 0.805536985f},
-std::array<float,2>{0.909704208f, 0.159575567f},
-std::array<float,2>{0.30448541f, 0.725708485f},
-std::array<float,2>{0.378208667f, 0.0176967904f},
-std::array<float,2>{0.850059688f, 0.510097206f},
-std::array<float,2>{0.550086081f, 0.43965742f},
-std::array<float,2>{0.0988908261f, 0.879879177f},
-std::array<float,2>{0.0532220155f, 0.192100912f},
-std::array<float,2>{0.616529346f, 0.630343199f},
-std::array<float,2>{0.807113111f, 0.289961904f},
-std::array<float,2>{0.457047135f, 0.814157903f},
-std::array<float,2>{0.335001618f, 0.409215212f},
-std::array<float,2>{0.968959153f, 0.965969682f},
-std::array<float,2>{0.639407635f, 0.114029281f},
-std::array<float,2>{0.171507135f, 0.617411137f},
-std::array<float,2>{0.181136161f, 0.375164837f},
-std::array<float,2>{0.650779307f, 0.992435634f},
-std::array<float,2>{0.991150916f, 0.0728885531f},
-std::array<float,2>{0.327289939f, 0.580450296f},
-std::array<float,2>{0.438345611f, 0.220752716f},
-std::array<float,2>{0.788617492f, 0.673139632f},
-std::array<float,2>{0.604331911f, 0.260928512f},
-std::array<float,2>{0.0433940738f, 0.855771601f},
-std::array<float,2>{0.123387426f, 0.040921364f},
-std::array<float,2>{0.535418391f, 0.551666737f},
-std::array<float,2>{0.873536706f, 0.490460247f},
-std::array<float,2>{0.397375047f, 0.928035259f},
-std::array<float,2>{0.281312704f, 0.345606536f},
-std::array<float,2>{0.93101275f, 0.752349913f},
-std::array<float,2>{0.731255651f, 0.139081389f},
-std::array<float,2>{0.200781405f, 0.696636081f},
-std::array<float,2>{0.00160902971f, 0.299735665f},
-std::array<float,2>{0.576922596f, 0.840085685f},
-std::array<float,2>{0.751001596f, 0.217917681f},
-std::array<float,2>{0.492674857f, 0.645051718f},
-std::array<float,2>{0.372573286f, 0.104370974f},
-std::array<float,2>{0.941826522f, 0.600013077f},
-std::array<float,2>{0.674597681f, 0.430862576f},
-std::array<float,2>{0.126234472f, 0.951696992f},
-std::array<float,2>{0.226051107f, 0.178936318f},
-std::array<float,2>{0.692259014f, 0.736644268f},
-std::array<float,2>{0.892535508f, 0.319890767f},
-std::array<float,2>{0.278696895f, 0.796011746f},
-std::array<float,2>{0.421008319f, 0.457495093f},
-std::array<float,2>{0.838636875f, 0.893701136f},
-std::array<float,2>{0.50048697f, 0.0137262391f},
-std::array<float,2>{0.0737517327f, 0.520770252f},
-std::array<float,2>{0.111739665f, 0.40447548f},
-std::array<float,2>{0.54489392f, 0.975122809f},
-std::array<float,2>{0.863970459f, 0.0840722173f},
-std::array<float,2>{0.40531671f, 0.569547117f},
-std::array<float,2>{0.289913207f, 0.246687323f},
-std::array<float,2>{0.922730327f, 0.659269691f},
-std::array<float,2>{0.722599387f, 0.270494491f},
-std::array<float,2>{0.187905028f, 0.871324778f},
-std::array<float,2>{0.178466767f, 0.0623196624f},
-std::array<float,2>{0.643454731f, 0.53715229f},
-std::array<float,2>{0.999482334f, 0.477212042f},
-std::array<float,2>{0.318225622f, 0.90629971f},
-std::array<float,2>{0.449378073f, 0.363434851f},
-std::array<float,2>{0.794876933f, 0.772036552f},
-std::array<float,2>{0.595497906f, 0.148251981f},
-std::array<float,2>{0.0355694108f, 0.710104525f},
-std::array<float,2>{0.2339641f, 0.295776576f},
-std::array<float,2>{0.702999949f, 0.817917407f},
-std::array<float,2>{0.901392162f, 0.188492551f},
-std::array<float,2>{0.272386044f, 0.626889467f},
-std::array<float,2>{0.406867772f, 0.110664785f},
-std::array<float,2>{0.833502173f, 0.623583496f},
-std::array<float,2>{0.507911742f, 0.412914306f},
-std::array<float,2>{0.0697582886f, 0.964826405f},
-std::array<float,2>{0.0129401339f, 0.162120268f},
-std::array<float,2>{0.568176389f, 0.722099781f},
-std::array<float,2>{0.761156201f, 0.329809308f},
-std::array<float,2>{0.487413496f, 0.808817565f},
-std::array<float,2>{0.359632343f, 0.443475753f},
-std::array<float,2>{0.946612835f, 0.878883719f},
-std::array<float,2>{0.68427223f, 0.0220923182f},
-std::array<float,2>{0.137299374f, 0.515328467f},
-std::array<float,2>{0.144504309f, 0.485370696f},
-std::array<float,2>{0.657490075f, 0.925643504f},
-std::array<float,2>{0.96110636f, 0.0458274223f},
-std::array<float,2>{0.353046209f, 0.550584316f},
-std::array<float,2>{0.482091576f, 0.136076689f},
-std::array<float,2>{0.770883679f, 0.699445128f},
-std::array<float,2>{0.593746722f, 0.347900391f},
-std::array<float,2>{0.0188941732f, 0.755511403f},
-std::array<float,2>{0.0821257532f, 0.0757953078f},
-std::array<float,2>{0.524271786f, 0.582514584f},
-std::array<float,2>{0.823306918f, 0.381038547f},
-std::array<float,2>{0.432241827f, 0.998912752f},
-std::array<float,2>{0.260731786f, 0.26498732f},
-std::array<float,2>{0.883429706f, 0.855282724f},
-std::array<float,2>{0.714328587f, 0.224543601f},
-std::array<float,2>{0.249141514f, 0.67587769f},
-std::array<float,2>{0.0552035123f, 0.316229641f},
-std::array<float,2>{0.623933434f, 0.790698588f},
-std::array<float,2>{0.800881863f, 0.174797922f},
-std::array<float,2>{0.465449512f, 0.740937591f},
-std::array<float,2>{0.340958506f, 0.00891624298f},
-std::array<float,2>{0.979583979f, 0.517896235f},
-std::array<float,2>{0.62938714f, 0.457022697f},
-std::array<float,2>{0.159123585f, 0.895810425f},
-std::array<float,2>{0.204593882f, 0.213335395f},
-std::array<float,2>{0.748037815f, 0.644210279f},
-std::array<float,2>{0.915986478f, 0.301670134f},
-std::array<float,2>{0.3100155f, 0.836894751f},
-std::array<float,2>{0.388352543f, 0.43713659f},
-std::array<float,2>{0.852623105f, 0.948888004f},
-std::array<float,2>{0.558233976f, 0.105829969f},
-std::array<float,2>{0.103780098f, 0.595853746f},
-std::array<float,2>{0.0268339943f, 0.461181372f},
-std::array<float,2>{0.579283357f, 0.904626548f},
-std::array<float,2>{0.779893994f, 0.00672271196f},
-std::array<float,2>{0.471160799f, 0.523982286f},
-std::array<float,2>{0.344543844f, 0.185840175f},
-std::array<float,2>{0.955153227f, 0.747681499f},
-std::array<float,2>{0.667491436f, 0.326509923f},
-std::array<float,2>{0.151944518f, 0.788817644f},
-std::array<float,2>{0.235283345f, 0.100756533f},
-std::array<float,2>{0.707951427f, 0.606096387f},
-std::array<float,2>{0.87805748f, 0.423527449f},
-std::array<float,2>{0.250439852f, 0.942745388f},
-std::array<float,2>{0.422906786f, 0.308258921f},
-std::array<float,2>{0.814421475f, 0.83456552f},
-std::array<float,2>{0.515709281f, 0.210648522f},
-std::array<float,2>{0.0863936245f, 0.649088264f},
-std::array<float,2>{0.166009471f, 0.353175551f},
-std::array<float,2>{0.633180857f, 0.763900757f},
-std::array<float,2>{0.972677708f, 0.132221401f},
-std::array<float,2>{0.32849735f, 0.689136922f},
-std::array<float,2>{0.45334062f, 0.0358679295f},
-std::array<float,2>{0.812311351f, 0.557903588f},
-std::array<float,2>{0.61157757f, 0.497356772f},
-std::array<float,2>{0.0470883362f, 0.935112536f},
-std::array<float,2>{0.096373111f, 0.232984543f},
-std::array<float,2>{0.551054895f, 0.68291676f},
-std::array<float,2>{0.846971214f, 0.253001213f},
-std::array<float,2>{0.382535785f, 0.846797347f},
-std::array<float,2>{0.298299044f, 0.385596722f},
-std::array<float,2>{0.911847949f, 0.990947008f},
-std::array<float,2>{0.740314126f, 0.0660764277f},
-std::array<float,2>{0.211783335f, 0.587040246f},
-std::array<float,2>{0.19560346f, 0.420776784f},
-std::array<float,2>{0.728226244f, 0.95878756f},
-std::array<float,2>{0.934309304f, 0.120076261f},
-std::array<float,2>{0.285934716f, 0.614292145f},
-std::array<float,2>{0.391481757f, 0.199201092f},
-std::array<float,2>{0.870848119f, 0.633450508f},
-std::array<float,2>{0.534271002f, 0.288843453f},
-std::array<float,2>{0.119356841f, 0.826973855f},
-std::array<float,2>{0.040435791f, 0.0253707618f},
-std::array<float,2>{0.608461857f, 0.505052447f},
-std::array<float,2>{0.782245576f, 0.453041166f},
-std::array<float,2>{0.44326216f, 0.885051906f},
-std::array<float,2>{0.321776569f, 0.34295702f},
-std::array<float,2>{0.987758934f, 0.797240436f},
-std::array<float,2>{0.653584063f, 0.167673752f},
-std::array<float,2>{0.185857952f, 0.729308724f},
-std::array<float,2>{0.0774193406f, 0.279315948f},
-std::array<float,2>{0.505992115f, 0.863460958f},
-std::array<float,2>{0.843268871f, 0.23871468f},
-std::array<float,2>{0.415455133f, 0.666549087f},
-std::array<float,2>{0.275777757f, 0.088981986f},
-std::array<float,2>{0.896525919f, 0.570437133f},
-std::array<float,2>{0.68782115f, 0.395751297f},
-std::array<float,2>{0.218892857f, 0.977707207f},
-std::array<float,2>{0.132435411f, 0.154780775f},
-std::array<float,2>{0.678341329f, 0.714078844f},
-std::array<float,2>{0.939669311f, 0.368446201f},
-std::array<float,2>{0.371067435f, 0.775467753f},
-std::array<float,2>{0.499025166f, 0.475447774f},
-std::array<float,2>{0.755124211f, 0.919778943f},
-std::array<float,2>{0.572782218f, 0.0529404655f},
-std::array<float,2>{0.00621242542f, 0.540035248f},
-std::array<float,2>{0.0352623016f, 0.402372152f},
-std::array<float,2>{0.595225692f, 0.972900093f},
-std::array<float,2>{0.794598043f, 0.0834468603f},
-std::array<float,2>{0.449507475f, 0.568352818f},
-std::array<float,2>{0.317957908f, 0.248423368f},
-std::array<float,2>{0.999190688f, 0.656336844f},
-std::array<float,2>{0.643186569f, 0.271902651f},
-std::array<float,2>{0.178606495f, 0.874087691f},
-std::array<float,2>{0.187537789f, 0.0597947314f},
-std::array<float,2>{0.72234726f, 0.536863387f},
-std::array<float,2>{0.922601521f, 0.47859472f},
-std::array<float,2>{0.289675921f, 0.909297764f},
-std::array<float,2>{0.405711293f, 0.365416735f},
-std::array<float,2>{0.864027679f, 0.769611955f},
-std::array<float,2>{0.544460237f, 0.145321921f},
-std::array<float,2>{0.111348122f, 0.708950698f},
-std::array<float,2>{0.137642309f, 0.293600678f},
-std::array<float,2>{0.684511364f, 0.819029868f},
-std::array<float,2>{0.946402013f, 0.190252319f},
-std::array<float,2>{0.359547436f, 0.628169477f},
-std::array<float,2>{0.487755924f, 0.112525642f},
-std::array<float,2>{0.760980904f, 0.62202549f},
-std::array<float,2>{0.568013787f, 0.411025554f},
-std::array<float,2>{0.0128424931f, 0.962248147f},
-std::array<float,2>{0.0694694594f, 0.161935657f},
-std::array<float,2>{0.508180916f, 0.720050156f},
-std::array<float,2>{0.833781242f, 0.330581427f},
-std::array<float,2>{0.407016098f, 0.811971903f},
-std::array<float,2>{0.272065163f, 0.441570818f},
-std::array<float,2>{0.901773691f, 0.875115812f},
-std::array<float,2>{0.702665091f, 0.0204828791f},
-std::array<float,2>{0.234193459f, 0.513214886f},
-std::array<float,2>{0.249359414f, 0.48807162f},
-std::array<float,2>{0.714108706f, 0.922119439f},
-std::array<float,2>{0.883669019f, 0.043509122f},
-std::array<float,2>{0.260468215f, 0.547527432f},
-std::array<float,2>{0.432443589f, 0.133691624f},
-std::array<float,2>{0.823487401f, 0.701783895f},
-std::array<float,2>{0.523982882f, 0.351531118f},
-std::array<float,2>{0.0823009387f, 0.757655799f},
-std::array<float,2>{0.0185793359f, 0.0761990026f},
-std::array<float,2>{0.593467295f, 0.585811198f},
-std::array<float,2>{0.770734668f, 0.380376011f},
-std::array<float,2>{0.482221663f, 0.997882783f},
-std::array<float,2>{0.353474528f, 0.262654126f},
-std::array<float,2>{0.961360991f, 0.853504121f},
-std::array<float,2>{0.657340646f, 0.225200102f},
-std::array<float,2>{0.144267768f, 0.678774834f},
-std::array<float,2>{0.103595391f, 0.312728405f},
-std::array<float,2>{0.558456898f, 0.792807162f},
-std::array<float,2>{0.852993429f, 0.173339143f},
-std::array<float,2>{0.388579547f, 0.73888123f},
-std::array<float,2>{0.309797406f, 0.00992236659f},
-std::array<float,2>{0.915669322f, 0.516551077f},
-std::array<float,2>{0.747802377f, 0.453162521f},
-std::array<float,2>{0.20484972f, 0.897341013f},
-std::array<float,2>{0.158873111f, 0.211307451f},
-std::array<float,2>{0.628966689f, 0.64224112f},
-std::array<float,2>{0.979746699f, 0.303451061f},
-std::array<float,2>{0.34107241f, 0.839548171f},
-std::array<float,2>{0.465795487f, 0.434605241f},
-std::array<float,2>{0.801056981f, 0.946568489f},
-std::array<float,2>{0.623610616f, 0.108808585f},
-std::array<float,2>{0.0556339882f, 0.594054699f},
-std::array<float,2>{0.0861429721f, 0.464129359f},
-std::array<float,2>{0.515996218f, 0.903611004f},
-std::array<float,2>{0.814149976f, 0.00461969199f},
-std::array<float,2>{0.423234373f, 0.527164936f},
-std::array<float,2>{0.250038266f, 0.184453681f},
-std::array<float,2>{0.878326833f, 0.748559713f},
-std::array<float,2>{0.707637787f, 0.324320078f},
-std::array<float,2>{0.234982058f, 0.785638511f},
-std::array<float,2>{0.152110502f, 0.0987413302f},
-std::array<float,2>{0.667946756f, 0.608820438f},
-std::array<float,2>{0.955511928f, 0.425458521f},
-std::array<float,2>{0.344246626f, 0.943572342f},
-std::array<float,2>{0.470861763f, 0.30471769f},
-std::array<float,2>{0.780187666f, 0.832471728f},
-std::array<float,2>{0.579482138f, 0.208567739f},
-std::array<float,2>{0.0265133511f, 0.65217942f},
-std::array<float,2>{0.211589277f, 0.353621781f},
-std::array<float,2>{0.740531623f, 0.762543857f},
-std::array<float,2>{0.911872506f, 0.130793199f},
-std::array<float,2>{0.297926217f, 0.689645588f},
-std::array<float,2>{0.382582456f, 0.0386753976f},
-std::array<float,2>{0.846681535f, 0.555279016f},
-std::array<float,2>{0.550966144f, 0.498103887f},
-std::array<float,2>{0.0965115875f, 0.937162399f},
-std::array<float,2>{0.0472470634f, 0.231772944f},
-std::array<float,2>{0.611409783f, 0.680530429f},
-std::array<float,2>{0.812204599f, 0.250605166f},
-std::array<float,2>{0.453453064f, 0.843896329f},
-std::array<float,2>{0.328320235f, 0.383701533f},
-std::array<float,2>{0.972912371f, 0.988961518f},
-std::array<float,2>{0.633006454f, 0.0635392144f},
-std::array<float,2>{0.165742144f, 0.588177025f},
-std::array<float,2>{0.185737535f, 0.418386936f},
-std::array<float,2>{0.653546929f, 0.959263206f},
-std::array<float,2>{0.987500906f, 0.117244743f},
-std::array<float,2>{0.321353674f, 0.616877973f},
-std::array<float,2>{0.442970604f, 0.196698576f},
-std::array<float,2>{0.78269124f, 0.635784268f},
-std::array<float,2>{0.608667314f, 0.286342263f},
-std::array<float,2>{0.0401117168f, 0.825520754f},
-std::array<float,2>{0.119495057f, 0.02661971f},
-std::array<float,2>{0.534638882f, 0.507703006f},
-std::array<float,2>{0.870930612f, 0.449981064f},
-std::array<float,2>{0.391234159f, 0.884125769f},
-std::array<float,2>{0.285862237f, 0.34095791f},
-std::array<float,2>{0.934471607f, 0.799889922f},
-std::array<float,2>{0.728452265f, 0.164118156f},
-std::array<float,2>{0.195438042f, 0.727429509f},
-std::array<float,2>{0.00604779972f, 0.277762502f},
-std::array<float,2>{0.573183119f, 0.866628408f},
-std::array<float,2>{0.755328894f, 0.242030576f},
-std::array<float,2>{0.49949038f, 0.664935887f},
-std::array<float,2>{0.370730013f, 0.0863693878f},
-std::array<float,2>{0.939759552f, 0.574104071f},
-std::array<float,2>{0.678549647f, 0.397803485f},
-std::array<float,2>{0.132725194f, 0.979018986f},
-std::array<float,2>{0.219154418f, 0.15429531f},
-std::array<float,2>{0.687651038f, 0.712180674f},
-std::array<float,2>{0.896945894f, 0.370965451f},
-std::array<float,2>{0.275526941f, 0.77406323f},
-std::array<float,2>{0.415096104f, 0.474605888f},
-std::array<float,2>{0.84354943f, 0.921512723f},
-std::array<float,2>{0.506290734f, 0.0513722673f},
-std::array<float,2>{0.0773224533f, 0.54122889f},
-std::array<float,2>{0.116696164f, 0.427948564f},
-std::array<float,2>{0.540614426f, 0.941118896f},
-std::array<float,2>{0.862906396f, 0.0940894559f},
-std::array<float,2>{0.399658978f, 0.603020847f},
-std::array<float,2>{0.294965267f, 0.203498632f},
-std::array<float,2>{0.929095984f, 0.656214714f},
-std::array<float,2>{0.726277053f, 0.308675408f},
-std::array<float,2>{0.192301422f, 0.828160763f},
-std::array<float,2>{0.175600737f, 0.00190220552f},
-std::array<float,2>{0.645859599f, 0.529481828f},
-std::array<float,2>{0.99301827f, 0.466238886f},
-std::array<float,2>{0.315312147f, 0.900830209f},
-std::array<float,2>{0.447294295f, 0.320634663f},
-std::array<float,2>{0.792492807f, 0.783538043f},
-std::array<float,2>{0.598897159f, 0.18092981f},
-std::array<float,2>{0.0320357494f, 0.744861007f},
-std::array<float,2>{0.229393736f, 0.254726619f},
-std::array<float,2>{0.696239054f, 0.851433218f},
-std::array<float,2>{0.90463388f, 0.228380442f},
-std::array<float,2>{0.269093722f, 0.684366047f},
-std::array<float,2>{0.413957983f, 0.0687281787f},
-std::array<float,2>{0.830810308f, 0.591469824f},
-std::array<float,2>{0.512651622f, 0.388649464f},
-std::array<float,2>{0.066403769f, 0.986834228f},
-std::array<float,2>{0.00818412844f, 0.128352925f},
-std::array<float,2>{0.564765632f, 0.694599509f},
-std::array<float,2>{0.764341116f, 0.358544588f},
-std::array<float,2>{0.490819722f, 0.760139287f},
-std::array<float,2>{0.367024451f, 0.494152009f},
-std::array<float,2>{0.952366829f, 0.929981291f},
-std::array<float,2>{0.679735124f, 0.0332492776f},
-std::array<float,2>{0.136075675f, 0.560984373f},
-std::array<float,2>{0.145730883f, 0.447221279f},
-std::array<float,2>{0.663557172f, 0.889820039f},
-std::array<float,2>{0.967535853f, 0.0291721318f},
-std::array<float,2>{0.35650906f, 0.502739608f},
-std::array<float,2>{0.479337662f, 0.168042764f},
-std::array<float,2>{0.767996848f, 0.732418299f},
-std::array<float,2>{0.589082241f, 0.336787283f},
-std::array<float,2>{0.023065988f, 0.802213192f},
-std::array<float,2>{0.0788600817f, 0.121498182f},
-std::array<float,2>{0.528474391f, 0.613125443f},
-std::array<float,2>{0.827415526f, 0.414325923f},
-std::array<float,2>{0.435374916f, 0.953607142f},
-std::array<float,2>{0.263874501f, 0.283879876f},
-std::array<float,2>{0.890189469f, 0.822924674f},
-std::array<float,2>{0.717875302f, 0.200600982f},
-std::array<float,2>{0.245987996f, 0.636926234f},
-std::array<float,2>{0.0598628633f, 0.373985469f},
-std::array<float,2>{0.619486988f, 0.779977977f},
-std::array<float,2>{0.800350606f, 0.149015293f},
-std::array<float,2>{0.464668155f, 0.715314806f},
-std::array<float,2>{0.33673209f, 0.0504256487f},
-std::array<float,2>{0.980497718f, 0.543614507f},
-std::array<float,2>{0.627585351f, 0.47243166f},
-std::array<float,2>{0.161924824f, 0.915021956f},
-std::array<float,2>{0.20918332f, 0.235869288f},
-std::array<float,2>{0.744705677f, 0.670730233f},
-std::array<float,2>{0.91952616f, 0.275427192f},
-std::array<float,2>{0.305166781f, 0.860277474f},
-std::array<float,2>{0.383340478f, 0.393866062f},
-std::array<float,2>{0.857477486f, 0.981402457f},
-std::array<float,2>{0.561755478f, 0.0904859081f},
-std::array<float,2>{0.106543325f, 0.577078938f},
-std::array<float,2>{0.0308897272f, 0.483099133f},
-std::array<float,2>{0.584382772f, 0.912044764f},
-std::array<float,2>{0.77606225f, 0.0556804724f},
-std::array<float,2>{0.474312335f, 0.534464359f},
-std::array<float,2>{0.349995196f, 0.142038837f},
-std::array<float,2>{0.960224032f, 0.705744088f},
-std::array<float,2>{0.668485224f, 0.360770136f},
-std::array<float,2>{0.153997451f, 0.769460201f},
-std::array<float,2>{0.240710855f, 0.0796960145f},
-std::array<float,2>{0.706029415f, 0.563567758f},
-std::array<float,2>{0.882672071f, 0.400483102f},
-std::array<float,2>{0.254213989f, 0.972212911f},
-std::array<float,2>{0.428705364f, 0.266939014f},
-std::array<float,2>{0.817336202f, 0.869783223f},
-std::array<float,2>{0.521928191f, 0.24272868f},
-std::array<float,2>{0.0905598179f, 0.662965953f},
-std::array<float,2>{0.171817496f, 0.333251685f},
-std::array<float,2>{0.639274061f, 0.806798756f},
-std::array<float,2>{0.969074011f, 0.157803148f},
-std::array<float,2>{0.335219413f, 0.722747624f},
-std::array<float,2>{0.457276076f, 0.0159940645f},
-std::array<float,2>{0.806830943f, 0.509309828f},
-std::array<float,2>{0.616420865f, 0.439348906f},
-std::array<float,2>{0.052820947f, 0.881852806f},
-std::array<float,2>{0.0986908451f, 0.194360942f},
-std::array<float,2>{0.549912214f, 0.632707596f},
-std::array<float,2>{0.849654853f, 0.292269796f},
-std::array<float,2>{0.378157407f, 0.815852702f},
-std::array<float,2>{0.304413646f, 0.407514125f},
-std::array<float,2>{0.91000706f, 0.966968238f},
-std::array<float,2>{0.735225677f, 0.116461016f},
-std::array<float,2>{0.21694535f, 0.619208455f},
-std::array<float,2>{0.200933218f, 0.377265781f},
-std::array<float,2>{0.731098473f, 0.994942307f},
-std::array<float,2>{0.930846214f, 0.0709415823f},
-std::array<float,2>{0.281703025f, 0.580058932f},
-std::array<float,2>{0.397178769f, 0.219127461f},
-std::array<float,2>{0.873983145f, 0.6747908f},
-std::array<float,2>{0.53523469f, 0.258218169f},
-std::array<float,2>{0.123098128f, 0.859088004f},
-std::array<float,2>{0.0431193635f, 0.0415583253f},
-std::array<float,2>{0.604182184f, 0.553355515f},
-std::array<float,2>{0.788942337f, 0.489495516f},
-std::array<float,2>{0.438200623f, 0.927242219f},
-std::array<float,2>{0.327395409f, 0.346838087f},
-std::array<float,2>{0.990825176f, 0.751105666f},
-std::array<float,2>{0.650436103f, 0.138097957f},
-std::array<float,2>{0.180764407f, 0.69846946f},
-std::array<float,2>{0.0741453767f, 0.297283828f},
-std::array<float,2>{0.500103354f, 0.842452347f},
-std::array<float,2>{0.838449836f, 0.216348931f},
-std::array<float,2>{0.421194166f, 0.648064792f},
-std::array<float,2>{0.278442711f, 0.10247232f},
-std::array<float,2>{0.892098606f, 0.597974837f},
-std::array<float,2>{0.691985726f, 0.432194561f},
-std::array<float,2>{0.225812033f, 0.95001179f},
-std::array<float,2>{0.126186103f, 0.176238447f},
-std::array<float,2>{0.674559534f, 0.734391034f},
-std::array<float,2>{0.941591859f, 0.317922115f},
-std::array<float,2>{0.372969717f, 0.794570625f},
-std::array<float,2>{0.492249876f, 0.460215211f},
-std::array<float,2>{0.751380503f, 0.89117825f},
-std::array<float,2>{0.576702476f, 0.0117726345f},
-std::array<float,2>{0.0018450974f, 0.522333384f},
-std::array<float,2>{0.0144522013f, 0.414045095f},
-std::array<float,2>{0.570012212f, 0.962970972f},
-std::array<float,2>{0.7596488f, 0.109481826f},
-std::array<float,2>{0.484651864f, 0.624526918f},
-std::array<float,2>{0.362940401f, 0.188213229f},
-std::array<float,2>{0.948304474f, 0.625666797f},
-std::array<float,2>{0.687414169f, 0.296419054f},
-std::array<float,2>{0.140064612f, 0.817268789f},
-std::array<float,2>{0.23142764f, 0.0227607097f},
-std::array<float,2>{0.700729072f, 0.514183283f},
-std::array<float,2>{0.898975074f, 0.444833308f},
-std::array<float,2>{0.269838542f, 0.877922952f},
-std::array<float,2>{0.408956915f, 0.328222156f},
-std::array<float,2>{0.835318208f, 0.810195863f},
-std::array<float,2>{0.511365294f, 0.163247526f},
-std::array<float,2>{0.0667871237f, 0.720845222f},
-std::array<float,2>{0.176436394f, 0.27076599f},
-std::array<float,2>{0.642499208f, 0.872131944f},
-std::array<float,2>{0.996108949f, 0.24783048f},
-std::array<float,2>{0.319381654f, 0.658290505f},
-std::array<float,2>{0.452036291f, 0.085488081f},
-std::array<float,2>{0.795251906f, 0.568538606f},
-std::array<float,2>{0.597019613f, 0.406005412f},
-std::array<float,2>{0.0372575745f, 0.976225853f},
-std::array<float,2>{0.110308647f, 0.147403508f},
-std::array<float,2>{0.546543479f, 0.709641397f},
-std::array<float,2>{0.867097855f, 0.364881784f},
-std::array<float,2>{0.402539819f, 0.7728495f},
-std::array<float,2>{0.291187376f, 0.478407234f},
-std::array<float,2>{0.925392747f, 0.907713413f},
-std::array<float,2>{0.72032553f, 0.0613339432f},
-std::array<float,2>{0.190573961f, 0.53836298f},
-std::array<float,2>{0.205930024f, 0.455139786f},
-std::array<float,2>{0.748104334f, 0.895147204f},
-std::array<float,2>{0.916782498f, 0.00842165016f},
-std::array<float,2>{0.310837656f, 0.519281745f},
-std::array<float,2>{0.389708787f, 0.175433099f},
-std::array<float,2>{0.855357885f, 0.742139637f},
-std::array<float,2>{0.556078196f, 0.315270543f},
-std::array<float,2>{0.10185238f, 0.789540052f},
-std::array<float,2>{0.0574198216f, 0.106529258f},
-std::array<float,2>{0.621468842f, 0.597201884f},
-std::array<float,2>{0.803158343f, 0.435979098f},
-std::array<float,2>{0.468422025f, 0.947952926f},
-std::array<float,2>{0.343005806f, 0.301846415f},
-std::array<float,2>{0.978049576f, 0.836990237f},
-std::array<float,2>{0.632398367f, 0.214576587f},
-std::array<float,2>{0.156542927f, 0.643293798f},
-std::array<float,2>{0.0848460495f, 0.349373519f},
-std::array<float,2>{0.526247919f, 0.754635036f},
-std::array<float,2>{0.820919335f, 0.135603458f},
-std::array<float,2>{0.42997238f, 0.700619876f},
-std::array<float,2>{0.259669453f, 0.0460663661f},
-std::array<float,2>{0.886377335f, 0.549282789f},
-std::array<float,2>{0.712538898f, 0.485200912f},
-std::array<float,2>{0.247977883f, 0.924017072f},
-std::array<float,2>{0.140682265f, 0.223002598f},
-std::array<float,2>{0.660042703f, 0.676861763f},
-std::array<float,2>{0.96330446f, 0.263805181f},
-std::array<float,2>{0.355233699f, 0.853794932f},
-std::array<float,2>{0.484354556f, 0.382133037f},
-std::array<float,2>{0.773009777f, 0.999949992f},
-std::array<float,2>{0.591457963f, 0.074271068f},
-std::array<float,2>{0.0161375199f, 0.583585441f},
-std::array<float,2>{0.095381856f, 0.496612728f},
-std::array<float,2>{0.553775668f, 0.933822691f},
-std::array<float,2>{0.845007002f, 0.0366490372f},
-std::array<float,2>{0.38077721f, 0.557466805f},
-std::array<float,2>{0.300655007f, 0.131807551f},
-std::array<float,2>{0.913502216f, 0.687822819f},
-std::array<float,2>{0.739477277f, 0.351938903f},
-std::array<float,2>{0.213301957f, 0.765224636f},
-std::array<float,2>{0.167934626f, 0.0652223006f},
-std::array<float,2>{0.636156201f, 0.585957646f},
-std::array<float,2>{0.975502491f, 0.386239141f},
-std::array<float,2>{0.331564814f, 0.992100894f},
-std::array<float,2>{0.455503047f, 0.252039135f},
-std::array<float,2>{0.81014055f, 0.845964789f},
-std::array<float,2>{0.609915078f, 0.233863488f},
-std::array<float,2>{0.0497481823f, 0.681993544f},
-std::array<float,2>{0.236680716f, 0.327188492f},
-std::array<float,2>{0.709909618f, 0.787540615f},
-std::array<float,2>{0.87560153f, 0.187334895f},
-std::array<float,2>{0.252353489f, 0.746660769f},
-std::array<float,2>{0.4249807f, 0.0073382468f},
-std::array<float,2>{0.814956427f, 0.525081754f},
-std::array<float,2>{0.517969251f, 0.462318152f},
-std::array<float,2>{0.0888596773f, 0.905846894f},
-std::array<float,2>{0.0245375913f, 0.209153011f},
-std::array<float,2>{0.581332922f, 0.649585605f},
-std::array<float,2>{0.779278338f, 0.307010442f},
-std::array<float,2>{0.470123142f, 0.834961534f},
-std::array<float,2>{0.346901685f, 0.422843963f},
-std::array<float,2>{0.953747332f, 0.941982269f},
-std::array<float,2>{0.66477704f, 0.100307576f},
-std::array<float,2>{0.148758173f, 0.607088089f},
-std::array<float,2>{0.130637407f, 0.394885808f},
-std::array<float,2>{0.676713645f, 0.977516472f},
-std::array<float,2>{0.93875891f, 0.0882068127f},
-std::array<float,2>{0.368242174f, 0.571521342f},
-std::array<float,2>{0.497842193f, 0.239613414f},
-std::array<float,2>{0.757010221f, 0.667058825f},
-std::array<float,2>{0.572180331f, 0.280915618f},
-std::array<float,2>{0.0045659272f, 0.865051866f},
-std::array<float,2>{0.0760373026f, 0.0539099798f},
-std::array<float,2>{0.50508523f, 0.540862799f},
-std::array<float,2>{0.840248048f, 0.476279348f},
-std::array<float,2>{0.416323036f, 0.918165684f},
-std::array<float,2>{0.275152743f, 0.367198318f},
-std::array<float,2>{0.894542277f, 0.776791751f},
-std::array<float,2>{0.691245437f, 0.155627325f},
-std::array<float,2>{0.221874908f, 0.713010669f},
-std::array<float,2>{0.0418602377f, 0.287237257f},
-std::array<float,2>{0.606281757f, 0.8272686f},
-std::array<float,2>{0.783215463f, 0.197716281f},
-std::array<float,2>{0.445163041f, 0.633858204f},
-std::array<float,2>{0.323564142f, 0.120780289f},
-std::array<float,2>{0.985211968f, 0.614041567f},
-std::array<float,2>{0.654384434f, 0.420932472f},
-std::array<float,2>{0.184995949f, 0.957187653f},
-std::array<float,2>{0.198966399f, 0.166452676f},
-std::array<float,2>{0.729865491f, 0.72993958f},
-std::array<float,2>{0.937132895f, 0.342561781f},
-std::array<float,2>{0.288495153f, 0.798573554f},
-std::array<float,2>{0.392755657f, 0.45204702f},
-std::array<float,2>{0.868212819f, 0.885907173f},
-std::array<float,2>{0.5328632f, 0.0234417189f},
-std::array<float,2>{0.118634917f, 0.504882157f},
-std::array<float,2>{0.0636667162f, 0.389054f},
-std::array<float,2>{0.513804376f, 0.985901654f},
-std::array<float,2>{0.828988075f, 0.067120105f},
-std::array<float,2>{0.410291761f, 0.59218955f},
-std::array<float,2>{0.266949743f, 0.229006529f},
-std::array<float,2>{0.902852654f, 0.6874789f},
-std::array<float,2>{0.697762072f, 0.257731408f},
-std::array<float,2>{0.228425726f, 0.847764134f},
-std::array<float,2>{0.134254679f, 0.0312850885f},
-std::array<float,2>{0.6827057f, 0.558766007f},
-std::array<float,2>{0.9510625f, 0.493186682f},
-std::array<float,2>{0.364066452f, 0.932051837f},
-std::array<float,2>{0.489950776f, 0.357269734f},
-std::array<float,2>{0.763159335f, 0.759452701f},
-std::array<float,2>{0.564404249f, 0.12611568f},
-std::array<float,2>{0.0108188232f, 0.693330765f},
-std::array<float,2>{0.195048064f, 0.311684877f},
-std::array<float,2>{0.722684145f, 0.831205368f},
-std::array<float,2>{0.926556647f, 0.206375703f},
-std::array<float,2>{0.293156415f, 0.652361631f},
-std::array<float,2>{0.401292443f, 0.0974501222f},
-std::array<float,2>{0.860024035f, 0.603860199f},
-std::array<float,2>{0.541099966f, 0.426916122f},
-std::array<float,2>{0.114284225f, 0.938704371f},
-std::array<float,2>{0.0349730998f, 0.181712791f},
-std::array<float,2>{0.60095638f, 0.743690848f},
-std::array<float,2>{0.789804518f, 0.323574573f},
-std::array<float,2>{0.446026593f, 0.782909989f},
-std::array<float,2>{0.312761486f, 0.468469888f},
-std::array<float,2>{0.995516479f, 0.898441374f},
-std::array<float,2>{0.647888601f, 0.00238347147f},
-std::array<float,2>{0.173365697f, 0.528502584f},
-std::array<float,2>{0.162829608f, 0.470511585f},
-std::array<float,2>{0.62558341f, 0.91684866f},
-std::array<float,2>{0.982830167f, 0.0486034155f},
-std::array<float,2>{0.339204043f, 0.54596436f},
-std::array<float,2>{0.462798893f, 0.151690513f},
-std::array<float,2>{0.797999442f, 0.716806471f},
-std::array<float,2>{0.617953718f, 0.373013347f},
-std::array<float,2>{0.0609130934f, 0.779277444f},
-std::array<float,2>{0.107643843f, 0.0936480984f},
-std::array<float,2>{0.559485137f, 0.574529588f},
-std::array<float,2>{0.8570171f, 0.391828954f},
-std::array<float,2>{0.38556847f, 0.983673692f},
-std::array<float,2>{0.308424503f, 0.274159402f},
-std::array<float,2>{0.919957817f, 0.862811089f},
-std::array<float,2>{0.74391824f, 0.236769751f},
-std::array<float,2>{0.207839847f, 0.668920994f},
-std::array<float,2>{0.0207605399f, 0.338202447f},
-std::array<float,2>{0.586125553f, 0.80411315f},
-std::array<float,2>{0.766212285f, 0.170100763f},
-std::array<float,2>{0.478372753f, 0.733554423f},
-std::array<float,2>{0.357487112f, 0.0294143092f},
-std::array<float,2>{0.965838015f, 0.50065589f},
-std::array<float,2>{0.662080944f, 0.448894292f},
-std::array<float,2>{0.14714852f, 0.888565004f},
-std::array<float,2>{0.243061796f, 0.201342165f},
-std::array<float,2>{0.716439426f, 0.640357137f},
-std::array<float,2>{0.887002647f, 0.281279027f},
-std::array<float,2>{0.262335002f, 0.822169662f},
-std::array<float,2>{0.437406182f, 0.416079819f},
-std::array<float,2>{0.825814486f, 0.956814647f},
-std::array<float,2>{0.529831111f, 0.124271981f},
-std::array<float,2>{0.0811010897f, 0.610477388f},
-std::array<float,2>{0.0527185053f, 0.441286474f},
-std::array<float,2>{0.613514364f, 0.880157411f},
-std::array<float,2>{0.806310534f, 0.0189803969f},
-std::array<float,2>{0.459871143f, 0.511417508f},
-std::array<float,2>{0.333567798f, 0.15872407f},
-std::array<float,2>{0.972010493f, 0.725099981f},
-std::array<float,2>{0.638534486f, 0.335798472f},
-std::array<float,2>{0.169858992f, 0.805798829f},
-std::array<float,2>{0.216691747f, 0.114609659f},
-std::array<float,2>{0.737769306f, 0.618947625f},
-std::array<float,2>{0.907610416f, 0.408345312f},
-std::array<float,2>{0.301032692f, 0.965781569f},
-std::array<float,2>{0.376942486f, 0.290854633f},
-std::array<float,2>{0.849165738f, 0.812809408f},
-std::array<float,2>{0.548172534f, 0.193039641f},
-std::array<float,2>{0.100443691f, 0.629720628f},
-std::array<float,2>{0.154449612f, 0.36181578f},
-std::array<float,2>{0.670224428f, 0.765686572f},
-std::array<float,2>{0.957810462f, 0.144240737f},
-std::array<float,2>{0.349016458f, 0.704524159f},
-std::array<float,2>{0.475633174f, 0.0583876222f},
-std::array<float,2>{0.773988962f, 0.533151865f},
-std::array<float,2>{0.583530366f, 0.481666952f},
-std::array<float,2>{0.0289913956f, 0.912126362f},
-std::array<float,2>{0.0928638577f, 0.245056227f},
-std::array<float,2>{0.520341039f, 0.66135782f},
-std::array<float,2>{0.819188654f, 0.268753707f},
-std::array<float,2>{0.426312506f, 0.868791103f},
-std::array<float,2>{0.25684604f, 0.39929384f},
-std::array<float,2>{0.88049072f, 0.969272673f},
-std::array<float,2>{0.704133034f, 0.0801377669f},
-std::array<float,2>{0.240069121f, 0.565577984f},
-std::array<float,2>{0.223517373f, 0.42977646f},
-std::array<float,2>{0.69398576f, 0.952442944f},
-std::array<float,2>{0.892931044f, 0.104495406f},
-std::array<float,2>{0.279453009f, 0.600735128f},
-std::array<float,2>{0.418602347f, 0.217505068f},
-std::array<float,2>{0.836259961f, 0.646069527f},
-std::array<float,2>{0.503109097f, 0.300148129f},
-std::array<float,2>{0.0706245974f, 0.84168613f},
-std::array<float,2>{0.00379687501f, 0.0154926516f},
-std::array<float,2>{0.575847387f, 0.519761264f},
-std::array<float,2>{0.752008736f, 0.458291441f},
-std::array<float,2>{0.494349718f, 0.892687798f},
-std::array<float,2>{0.374834538f, 0.318482667f},
-std::array<float,2>{0.944362104f, 0.79550606f},
-std::array<float,2>{0.672384799f, 0.177818447f},
-std::array<float,2>{0.127616346f, 0.738233209f},
-std::array<float,2>{0.121451497f, 0.260070056f},
-std::array<float,2>{0.538560688f, 0.856859684f},
-std::array<float,2>{0.87266928f, 0.221966207f},
-std::array<float,2>{0.395337731f, 0.672521114f},
-std::array<float,2>{0.28332296f, 0.0740309805f},
-std::array<float,2>{0.93257159f, 0.581385553f},
-std::array<float,2>{0.734223664f, 0.376080424f},
-std::array<float,2>{0.20311591f, 0.994117677f},
-std::array<float,2>{0.181954965f, 0.139964834f},
-std::array<float,2>{0.64978832f, 0.696070254f},
-std::array<float,2>{0.990049899f, 0.343764096f},
-std::array<float,2>{0.326005369f, 0.753435969f},
-std::array<float,2>{0.439646542f, 0.491488367f},
-std::array<float,2>{0.786745489f, 0.928758264f},
-std::array<float,2>{0.601874053f, 0.0390683599f},
-std::array<float,2>{0.0462101623f, 0.551995337f},
-std::array<float,2>{0.016863836f, 0.379709065f},
-std::array<float,2>{0.590235114f, 0.99694109f},
-std::array<float,2>{0.771905005f, 0.0778444558f},
-std::array<float,2>{0.483061761f, 0.584592164f},
-std::array<float,2>{0.354481369f, 0.22628659f},
-std::array<float,2>{0.96389246f, 0.678172231f},
-std::array<float,2>{0.658653796f, 0.263463944f},
-std::array<float,2>{0.141821921f, 0.851988733f},
-std::array<float,2>{0.246510163f, 0.044314649f},
-std::array<float,2>{0.71110934f, 0.547963977f},
-std::array<float,2>{0.885279894f, 0.486587673f},
-std::array<float,2>{0.258152544f, 0.923455238f},
-std::array<float,2>{0.431398988f, 0.34970209f},
-std::array<float,2>{0.82214433f, 0.756109536f},
-std::array<float,2>{0.52657181f, 0.134481058f},
-std::array<float,2>{0.0853522122f, 0.702450454f},
-std::array<float,2>{0.158175558f, 0.304506361f},
-std::array<float,2>{0.63167274f, 0.837982714f},
-std::array<float,2>{0.976973593f, 0.212558329f},
-std::array<float,2>{0.342231154f, 0.641127527f},
-std::array<float,2>{0.466941535f, 0.10812936f},
-std::array<float,2>{0.804571271f, 0.595298946f},
-std::array<float,2>{0.622235179f, 0.434220999f},
-std::array<float,2>{0.0578523315f, 0.945584178f},
-std::array<float,2>{0.103503346f, 0.172621921f},
-std::array<float,2>{0.5547418f, 0.740184486f},
-std::array<float,2>{0.854349256f, 0.314389437f},
-std::array<float,2>{0.389348418f, 0.791388631f},
-std::array<float,2>{0.311630726f, 0.454278558f},
-std::array<float,2>{0.917457104f, 0.897464514f},
-std::array<float,2>{0.749960601f, 0.0107540982f},
-std::array<float,2>{0.206187502f, 0.517049193f},
-std::array<float,2>{0.189577788f, 0.479771703f},
-std::array<float,2>{0.719171762f, 0.908306301f},
-std::array<float,2>{0.923933327f, 0.0586251579f},
-std::array<float,2>{0.292893678f, 0.535801291f},
-std::array<float,2>{0.403659075f, 0.146226391f},
-std::array<float,2>{0.865275323f, 0.707533777f},
-std::array<float,2>{0.545218468f, 0.366279602f},
-std::array<float,2>{0.111248568f, 0.771055698f},
-std::array<float,2>{0.0386875272f, 0.0830005258f},
-std::array<float,2>{0.596439958f, 0.567111552f},
-std::array<float,2>{0.795940876f, 0.404193074f},
-std::array<float,2>{0.45298329f, 0.973993361f},
-std::array<float,2>{0.318933159f, 0.273273677f},
-std::array<float,2>{0.998018324f, 0.87353301f},
-std::array<float,2>{0.641377926f, 0.249491721f},
-std::array<float,2>{0.176996678f, 0.658032298f},
-std::array<float,2>{0.0679988861f, 0.331893623f},
-std::array<float,2>{0.510483205f, 0.811217844f},
-std::array<float,2>{0.834098876f, 0.160251796f},
-std::array<float,2>{0.409899443f, 0.719336689f},
-std::array<float,2>{0.271040529f, 0.0210588146f},
-std::array<float,2>{0.900316656f, 0.511945128f},
-std::array<float,2>{0.699704409f, 0.442406446f},
-std::array<float,2>{0.23229292f, 0.876520693f},
-std::array<float,2>{0.138935298f, 0.191226065f},
-std::array<float,2>{0.685779274f, 0.626969159f},
-std::array<float,2>{0.948179603f, 0.294662267f},
-std::array<float,2>{0.361918896f, 0.819695652f},
-std::array<float,2>{0.486189455f, 0.411443889f},
-std::array<float,2>{0.758304894f, 0.961311579f},
-std::array<float,2>{0.56863898f, 0.111658655f},
-std::array<float,2>{0.0151660917f, 0.622460604f},
-std::array<float,2>{0.117895275f, 0.451019853f},
-std::array<float,2>{0.53142041f, 0.883693516f},
-std::array<float,2>{0.867578387f, 0.0261771698f},
-std::array<float,2>{0.393943936f, 0.506384134f},
-std::array<float,2>{0.287408799f, 0.16597338f},
-std::array<float,2>{0.936280847f, 0.727776349f},
-std::array<float,2>{0.728547692f, 0.340179682f},
-std::array<float,2>{0.198093057f, 0.799782634f},
-std::array<float,2>{0.184005052f, 0.118628733f},
-std::array<float,2>{0.656173468f, 0.616155684f},
-std::array<float,2>{0.985542357f, 0.419856817f},
-std::array<float,2>{0.322858661f, 0.959988177f},
-std::array<float,2>{0.443387747f, 0.285794675f},
-std::array<float,2>{0.785061181f, 0.824701726f},
-std::array<float,2>{0.607287347f, 0.195898026f},
-std::array<float,2>{0.0425756127f, 0.635468364f},
-std::array<float,2>{0.220844626f, 0.369936198f},
-std::array<float,2>{0.689982712f, 0.774805665f},
-std::array<float,2>{0.896464467f, 0.153022051f},
-std::array<float,2>{0.274158299f, 0.711871207f},
-std::array<float,2>{0.41741398f, 0.052459605f},
-std::array<float,2>{0.841704845f, 0.54278934f},
-std::array<float,2>{0.5047732f, 0.473398954f},
-std::array<float,2>{0.0742780641f, 0.920572281f},
-std::array<float,2>{0.00547595602f, 0.240873232f},
-std::array<float,2>{0.571175039f, 0.665404856f},
-std::array<float,2>{0.756552696f, 0.278598219f},
-std::array<float,2>{0.496694773f, 0.865878224f},
-std::array<float,2>{0.368113399f, 0.396861911f},
-std::array<float,2>{0.937866151f, 0.9798702f},
-std::array<float,2>{0.677508414f, 0.0875695646f},
-std::array<float,2>{0.129674643f, 0.572327852f},
-std::array<float,2>{0.149577618f, 0.424324781f},
-std::array<float,2>{0.665711701f, 0.945207238f},
-std::array<float,2>{0.954511285f, 0.0985262766f},
-std::array<float,2>{0.346425027f, 0.607867002f},
-std::array<float,2>{0.469080627f, 0.207325861f},
-std::array<float,2>{0.778139055f, 0.651108444f},
-std::array<float,2>{0.580226541f, 0.306337714f},
-std::array<float,2>{0.0242972448f, 0.833416998f},
-std::array<float,2>{0.0894325972f, 0.00559831504f},
-std::array<float,2>{0.518907547f, 0.526088059f},
-std::array<float,2>{0.816168785f, 0.463608921f},
-std::array<float,2>{0.4239963f, 0.902412117f},
-std::array<float,2>{0.252984792f, 0.32549718f},
-std::array<float,2>{0.876298726f, 0.786655009f},
-std::array<float,2>{0.709989429f, 0.185070723f},
-std::array<float,2>{0.237560153f, 0.749774694f},
-std::array<float,2>{0.0501024872f, 0.251915991f},
-std::array<float,2>{0.610619664f, 0.845225155f},
-std::array<float,2>{0.809428513f, 0.231261715f},
-std::array<float,2>{0.456116647f, 0.680690944f},
-std::array<float,2>{0.330092043f, 0.0625937283f},
-std::array<float,2>{0.976147652f, 0.589130521f},
-std::array<float,2>{0.635322034f, 0.384529859f},
-std::array<float,2>{0.166652545f, 0.989373505f},
-std::array<float,2>{0.214134768f, 0.129025042f},
-std::array<float,2>{0.739019513f, 0.691151798f},
-std::array<float,2>{0.912129819f, 0.355018437f},
-std::array<float,2>{0.299597234f, 0.763021886f},
-std::array<float,2>{0.379130274f, 0.49983415f},
-std::array<float,2>{0.84408468f, 0.935983658f},
-std::array<float,2>{0.553223312f, 0.037341103f},
-std::array<float,2>{0.094563216f, 0.556424499f},
-std::array<float,2>{0.0804401562f, 0.415468961f},
-std::array<float,2>{0.530468881f, 0.954198897f},
-std::array<float,2>{0.824447274f, 0.122311674f},
-std::array<float,2>{0.435968935f, 0.612215638f},
-std::array<float,2>{0.263576686f, 0.200000957f},
-std::array<float,2>{0.88816309f, 0.638405859f},
-std::array<float,2>{0.715649962f, 0.284564316f},
-std::array<float,2>{0.243962228f, 0.823485136f},
-std::array<float,2>{0.14771843f, 0.0277499538f},
-std::array<float,2>{0.660239339f, 0.503490925f},
-std::array<float,2>{0.965407372f, 0.445732832f},
-std::array<float,2>{0.359134763f, 0.889506042f},
-std::array<float,2>{0.47666195f, 0.336934179f},
-std::array<float,2>{0.767502606f, 0.80173254f},
-std::array<float,2>{0.586982787f, 0.169300437f},
-std::array<float,2>{0.0198720843f, 0.730496883f},
-std::array<float,2>{0.20890379f, 0.276441514f},
-std::array<float,2>{0.743038237f, 0.860827148f},
-std::array<float,2>{0.921632528f, 0.234462664f},
-std::array<float,2>{0.307226717f, 0.671449244f},
-std::array<float,2>{0.386119485f, 0.0913355127f},
-std::array<float,2>{0.856258512f, 0.577796042f},
-std::array<float,2>{0.55997175f, 0.393127143f},
-std::array<float,2>{0.108881198f, 0.982039928f},
-std::array<float,2>{0.0621263757f, 0.150202498f},
-std::array<float,2>{0.61841023f, 0.716533005f},
-std::array<float,2>{0.797437668f, 0.374375612f},
-std::array<float,2>{0.461204648f, 0.780286372f},
-std::array<float,2>{0.33879289f, 0.471249968f},
-std::array<float,2>{0.983682752f, 0.915380001f},
-std::array<float,2>{0.626947522f, 0.0493790284f},
-std::array<float,2>{0.163106158f, 0.544598281f},
-std::array<float,2>{0.172313064f, 0.46519652f},
-std::array<float,2>{0.646813154f, 0.902104199f},
-std::array<float,2>{0.994370162f, 0.00047802506f},
-std::array<float,2>{0.313982636f, 0.530768692f},
-std::array<float,2>{0.447059393f, 0.180112466f},
-std::array<float,2>{0.790548325f, 0.745991528f},
-std::array<float,2>{0.600583375f, 0.321381152f},
-std::array<float,2>{0.0333961993f, 0.785147727f},
-std::array<float,2>{0.11389178f, 0.095624879f},
-std::array<float,2>{0.542841852f, 0.601702809f},
-std::array<float,2>{0.861213744f, 0.429142624f},
-std::array<float,2>{0.401868701f, 0.939950228f},
-std::array<float,2>{0.294103831f, 0.3098315f},
-std::array<float,2>{0.927267671f, 0.829858363f},
-std::array<float,2>{0.724461436f, 0.204367399f},
-std::array<float,2>{0.1940258f, 0.654509008f},
-std::array<float,2>{0.010595453f, 0.35752669f},
-std::array<float,2>{0.563025355f, 0.761683166f},
-std::array<float,2>{0.761804223f, 0.127809957f},
-std::array<float,2>{0.489222467f, 0.69381988f},
-std::array<float,2>{0.36498341f, 0.0351442359f},
-std::array<float,2>{0.950021803f, 0.561709166f},
-std::array<float,2>{0.681815565f, 0.4955841f},
-std::array<float,2>{0.1329519f, 0.931147933f},
-std::array<float,2>{0.226691619f, 0.22688061f},
-std::array<float,2>{0.698784411f, 0.685439408f},
-std::array<float,2>{0.903845549f, 0.255544841f},
-std::array<float,2>{0.26598379f, 0.850049019f},
-std::array<float,2>{0.411300689f, 0.387103289f},
-std::array<float,2>{0.829651475f, 0.987597644f},
-std::array<float,2>{0.515545428f, 0.0701021776f},
-std::array<float,2>{0.063046217f, 0.590446115f},
-std::array<float,2>{0.045653183f, 0.489189684f},
-std::array<float,2>{0.603418291f, 0.92588377f},
-std::array<float,2>{0.785984159f, 0.0429540053f},
-std::array<float,2>{0.441030264f, 0.553750396f},
-std::array<float,2>{0.325035542f, 0.137030944f},
-std::array<float,2>{0.988479793f, 0.697393298f},
-std::array<float,2>{0.649091303f, 0.346055746f},
-std::array<float,2>{0.182936087f, 0.750466764f},
-std::array<float,2>{0.201184496f, 0.0719134063f},
-std::array<float,2>{0.733386636f, 0.579033017f},
-std::array<float,2>{0.93343395f, 0.378518134f},
-std::array<float,2>{0.285114676f, 0.995121002f},
-std::array<float,2>{0.395786434f, 0.259190083f},
-std::array<float,2>{0.871267736f, 0.857536256f},
-std::array<float,2>{0.53804642f, 0.220561162f},
-std::array<float,2>{0.122721106f, 0.675263226f},
-std::array<float,2>{0.128333375f, 0.316708833f},
-std::array<float,2>{0.673231602f, 0.793362081f},
-std::array<float,2>{0.944051027f, 0.177692011f},
-std::array<float,2>{0.373363823f, 0.736031771f},
-std::array<float,2>{0.49525556f, 0.0127051268f},
-std::array<float,2>{0.753770053f, 0.523116648f},
-std::array<float,2>{0.574714839f, 0.459494293f},
-std::array<float,2>{0.0021789209f, 0.892286956f},
-std::array<float,2>{0.0713185519f, 0.215264246f},
-std::array<float,2>{0.502635837f, 0.647087634f},
-std::array<float,2>{0.837738037f, 0.29838565f},
-std::array<float,2>{0.418983638f, 0.842998087f},
-std::array<float,2>{0.281238228f, 0.4332892f},
-std::array<float,2>{0.894312918f, 0.950905681f},
-std::array<float,2>{0.694911838f, 0.103097089f},
-std::array<float,2>{0.224128589f, 0.599576712f},
-std::array<float,2>{0.238436759f, 0.401926786f},
-std::array<float,2>{0.70353806f, 0.971048951f},
-std::array<float,2>{0.879350901f, 0.0786297247f},
-std::array<float,2>{0.256794065f, 0.562564194f},
-std::array<float,2>{0.427223742f, 0.243452594f},
-std::array<float,2>{0.820298851f, 0.663398862f},
-std::array<float,2>{0.521054268f, 0.266343027f},
-std::array<float,2>{0.0919116512f, 0.870963335f},
-std::array<float,2>{0.0282796025f, 0.0548434928f},
-std::array<float,2>{0.582729101f, 0.533308625f},
-std::array<float,2>{0.775045872f, 0.483611137f},
-std::array<float,2>{0.474945992f, 0.910929203f},
-std::array<float,2>{0.348531783f, 0.359400779f},
-std::array<float,2>{0.958564579f, 0.767829835f},
-std::array<float,2>{0.671319485f, 0.140865028f},
-std::array<float,2>{0.155635595f, 0.706739664f},
-std::array<float,2>{0.101125218f, 0.291740298f},
-std::array<float,2>{0.547697961f, 0.814911366f},
-std::array<float,2>{0.848535061f, 0.193923995f},
-std::array<float,2>{0.375640064f, 0.631739855f},
-std::array<float,2>{0.302217782f, 0.115470789f},
-std::array<float,2>{0.906983316f, 0.621071577f},
-std::array<float,2>{0.736737907f, 0.406722695f},
-std::array<float,2>{0.215658873f, 0.968522191f},
-std::array<float,2>{0.168344066f, 0.15694423f},
-std::array<float,2>{0.637088656f, 0.72416836f},
-std::array<float,2>{0.970814645f, 0.332422704f},
-std::array<float,2>{0.332137227f, 0.808124423f},
-std::array<float,2>{0.460833728f, 0.437954187f},
-std::array<float,2>{0.805288851f, 0.881748915f},
-std::array<float,2>{0.614504814f, 0.0166350901f},
-std::array<float,2>{0.0510308184f, 0.508385718f},
-std::array<float,2>{0.0560345463f, 0.436659724f},
-std::array<float,2>{0.624203146f, 0.948606849f},
-std::array<float,2>{0.801787078f, 0.106265046f},
-std::array<float,2>{0.466509938f, 0.596353889f},
-std::array<float,2>{0.340753257f, 0.213514671f},
-std::array<float,2>{0.979290605f, 0.643995821f},
-std::array<float,2>{0.630838811f, 0.300916374f},
-std::array<float,2>{0.159576058f, 0.83594811f},
-std::array<float,2>{0.204075456f, 0.00936209317f},
-std::array<float,2>{0.746722102f, 0.51810962f},
-std::array<float,2>{0.914903224f, 0.456062287f},
-std::array<float,2>{0.309401423f, 0.896369874f},
-std::array<float,2>{0.387205988f, 0.315494686f},
-std::array<float,2>{0.851890087f, 0.790142894f},
-std::array<float,2>{0.556839347f, 0.173867226f},
-std::array<float,2>{0.10495194f, 0.740604043f},
-std::array<float,2>{0.142896876f, 0.265312791f},
-std::array<float,2>{0.657143712f, 0.854579091f},
-std::array<float,2>{0.961972594f, 0.22374028f},
-std::array<float,2>{0.351745099f, 0.676524937f},
-std::array<float,2>{0.481431067f, 0.0755884275f},
-std::array<float,2>{0.770057201f, 0.582813442f},
-std::array<float,2>{0.592493117f, 0.381536275f},
-std::array<float,2>{0.0184514765f, 0.998506546f},
-std::array<float,2>{0.0839091912f, 0.136466935f},
-std::array<float,2>{0.524463117f, 0.700037658f},
-std::array<float,2>{0.82275337f, 0.348174393f},
-std::array<float,2>{0.433449686f, 0.754897773f},
-std::array<float,2>{0.261625946f, 0.486067474f},
-std::array<float,2>{0.884705842f, 0.925144553f},
-std::array<float,2>{0.713493705f, 0.0452683046f},
-std::array<float,2>{0.248106465f, 0.550136328f},
-std::array<float,2>{0.232894763f, 0.444093734f},
-std::array<float,2>{0.701602161f, 0.8783108f},
-std::array<float,2>{0.900618255f, 0.0215329733f},
-std::array<float,2>{0.272694379f, 0.514992177f},
-std::array<float,2>{0.407579929f, 0.162942335f},
-std::array<float,2>{0.832171977f, 0.722326875f},
-std::array<float,2>{0.509242296f, 0.329360873f},
-std::array<float,2>{0.0690706596f, 0.809555054f},
-std::array<float,2>{0.0124712829f, 0.110876508f},
-std::array<float,2>{0.566898286f, 0.623404562f},
-std::array<float,2>{0.759896994f, 0.412181079f},
-std::array<float,2>{0.486889154f, 0.964215755f},
-std::array<float,2>{0.360947758f, 0.29513064f},
-std::array<float,2>{0.945376098f, 0.817510128f},
-std::array<float,2>{0.684746146f, 0.189378619f},
-std::array<float,2>{0.138234854f, 0.62626785f},
-std::array<float,2>{0.112813272f, 0.364166647f},
-std::array<float,2>{0.543014526f, 0.771921098f},
-std::array<float,2>{0.864557803f, 0.147801965f},
-std::array<float,2>{0.404368579f, 0.710818827f},
-std::array<float,2>{0.290385693f, 0.0619632527f},
-std::array<float,2>{0.923727274f, 0.537779331f},
-std::array<float,2>{0.721590936f, 0.476623029f},
-std::array<float,2>{0.188881457f, 0.907128572f},
-std::array<float,2>{0.179204926f, 0.246378869f},
-std::array<float,2>{0.644211173f, 0.659711778f},
-std::array<float,2>{0.998825252f, 0.26993677f},
-std::array<float,2>{0.317199141f, 0.872003615f},
-std::array<float,2>{0.450630218f, 0.405163199f},
-std::array<float,2>{0.793484747f, 0.975093901f},
-std::array<float,2>{0.594625652f, 0.0847010091f},
-std::array<float,2>{0.0366252847f, 0.569961369f},
-std::array<float,2>{0.0769042894f, 0.474822432f},
-std::array<float,2>{0.50728333f, 0.919190586f},
-std::array<float,2>{0.842606544f, 0.0536179766f},
-std::array<float,2>{0.41469267f, 0.539281189f},
-std::array<float,2>{0.276566595f, 0.155168056f},
-std::array<float,2>{0.898278654f, 0.714539766f},
-std::array<float,2>{0.688743591f, 0.369035333f},
-std::array<float,2>{0.219864964f, 0.776184559f},
-std::array<float,2>{0.131792262f, 0.0897889808f},
-std::array<float,2>{0.678935587f, 0.571100116f},
-std::array<float,2>{0.940506995f, 0.396263778f},
-std::array<float,2>{0.369574994f, 0.978284657f},
-std::array<float,2>{0.498195291f, 0.280165315f},
-std::array<float,2>{0.754793525f, 0.864078462f},
-std::array<float,2>{0.57412976f, 0.239254028f},
-std::array<float,2>{0.00733338017f, 0.666235864f},
-std::array<float,2>{0.196616247f, 0.343720078f},
-std::array<float,2>{0.726682365f, 0.797555447f},
-std::array<float,2>{0.934848368f, 0.167010337f},
-std::array<float,2>{0.286447585f, 0.728731334f},
-std::array<float,2>{0.392028391f, 0.0247469191f},
-std::array<float,2>{0.869264603f, 0.505742848f},
-std::array<float,2>{0.533576369f, 0.452612668f},
-std::array<float,2>{0.120735459f, 0.885477245f},
-std::array<float,2>{0.0396293588f, 0.198587477f},
-std::array<float,2>{0.607643545f, 0.633046091f},
-std::array<float,2>{0.781697392f, 0.288191378f},
-std::array<float,2>{0.442325026f, 0.826633334f},
-std::array<float,2>{0.320666701f, 0.420383275f},
-std::array<float,2>{0.986800909f, 0.958440304f},
-std::array<float,2>{0.652656555f, 0.119203568f},
-std::array<float,2>{0.186786205f, 0.61482954f},
-std::array<float,2>{0.164951757f, 0.385209918f},
-std::array<float,2>{0.634338737f, 0.990622759f},
-std::array<float,2>{0.974322259f, 0.0655573979f},
-std::array<float,2>{0.329462707f, 0.587440133f},
-std::array<float,2>{0.454939127f, 0.232527032f},
-std::array<float,2>{0.811347008f, 0.683369994f},
-std::array<float,2>{0.612954676f, 0.253522158f},
-std::array<float,2>{0.0483215749f, 0.847646654f},
-std::array<float,2>{0.0967096835f, 0.0353452675f},
-std::array<float,2>{0.552243352f, 0.55823338f},
-std::array<float,2>{0.846054137f, 0.49770081f},
-std::array<float,2>{0.381118357f, 0.934734225f},
-std::array<float,2>{0.297374904f, 0.352774441f},
-std::array<float,2>{0.910772443f, 0.764526248f},
-std::array<float,2>{0.741492629f, 0.132752001f},
-std::array<float,2>{0.212565497f, 0.688953161f},
-std::array<float,2>{0.026331665f, 0.308046043f},
-std::array<float,2>{0.579063714f, 0.834108055f},
-std::array<float,2>{0.780566514f, 0.210246235f},
-std::array<float,2>{0.472371876f, 0.64883852f},
-std::array<float,2>{0.345334828f, 0.101094261f},
-std::array<float,2>{0.956855357f, 0.605926752f},
-std::array<float,2>{0.666778445f, 0.423197597f},
-std::array<float,2>{0.151012778f, 0.942940712f},
-std::array<float,2>{0.235630959f, 0.186475337f},
-std::array<float,2>{0.70882833f, 0.747524261f},
-std::array<float,2>{0.877822936f, 0.326950729f},
-std::array<float,2>{0.251781046f, 0.788282871f},
-std::array<float,2>{0.422740102f, 0.461711407f},
-std::array<float,2>{0.813437998f, 0.905053198f},
-std::array<float,2>{0.516925633f, 0.0061134221f},
-std::array<float,2>{0.0870662108f, 0.523766041f},
-std::array<float,2>{0.106213465f, 0.391175389f},
-std::array<float,2>{0.561319411f, 0.983396471f},
-std::array<float,2>{0.858641446f, 0.0919864401f},
-std::array<float,2>{0.384103715f, 0.575793982f},
-std::array<float,2>{0.306113005f, 0.238223612f},
-std::array<float,2>{0.918082297f, 0.669703245f},
-std::array<float,2>{0.745563269f, 0.275019616f},
-std::array<float,2>{0.210147411f, 0.862054586f},
-std::array<float,2>{0.160278529f, 0.0473614559f},
-std::array<float,2>{0.628889859f, 0.545428813f},
-std::array<float,2>{0.981999278f, 0.469029546f},
-std::array<float,2>{0.337791741f, 0.917268157f},
-std::array<float,2>{0.463448346f, 0.371967137f},
-std::array<float,2>{0.798973024f, 0.777469456f},
-std::array<float,2>{0.620792806f, 0.150939032f},
-std::array<float,2>{0.0586651154f, 0.71862042f},
-std::array<float,2>{0.244465604f, 0.282484829f},
-std::array<float,2>{0.717239261f, 0.82120961f},
-std::array<float,2>{0.889556229f, 0.202252641f},
-std::array<float,2>{0.265281171f, 0.639234543f},
-std::array<float,2>{0.434531093f, 0.123544909f},
-std::array<float,2>{0.826366961f, 0.609524965f},
-std::array<float,2>{0.528238773f, 0.417908967f},
-std::array<float,2>{0.0798310935f, 0.955383897f},
-std::array<float,2>{0.0221148673f, 0.171450719f},
-std::array<float,2>{0.588447273f, 0.733213365f},
-std::array<float,2>{0.769261181f, 0.339630872f},
-std::array<float,2>{0.48003909f, 0.803151667f},
-std::array<float,2>{0.355615437f, 0.447578073f},
-std::array<float,2>{0.968192279f, 0.887574196f},
-std::array<float,2>{0.662196159f, 0.0308160447f},
-std::array<float,2>{0.144575119f, 0.501429558f},
-std::array<float,2>{0.134838432f, 0.492742628f},
-std::array<float,2>{0.680912614f, 0.933516562f},
-std::array<float,2>{0.951752305f, 0.0327908732f},
-std::array<float,2>{0.365649909f, 0.55967015f},
-std::array<float,2>{0.491522491f, 0.125419021f},
-std::array<float,2>{0.765473485f, 0.691637874f},
-std::array<float,2>{0.565941155f, 0.355546564f},
-std::array<float,2>{0.00946253911f, 0.758231819f},
-std::array<float,2>{0.0645588487f, 0.0681020245f},
-std::array<float,2>{0.51338172f, 0.592988133f},
-std::array<float,2>{0.831097424f, 0.389933258f},
-std::array<float,2>{0.412997305f, 0.984799325f},
-std::array<float,2>{0.268124074f, 0.256322861f},
-std::array<float,2>{0.906219363f, 0.849511743f},
-std::array<float,2>{0.696325481f, 0.229941517f},
-std::array<float,2>{0.229599431f, 0.686470568f},
-std::array<float,2>{0.0324661881f, 0.322492957f},
-std::array<float,2>{0.598271012f, 0.781375885f},
-std::array<float,2>{0.791742027f, 0.183371961f},
-std::array<float,2>{0.448774278f, 0.742898703f},
-std::array<float,2>{0.315927744f, 0.00323757599f},
-std::array<float,2>{0.993985593f, 0.527632654f},
-std::array<float,2>{0.644975901f, 0.467360437f},
-std::array<float,2>{0.173857003f, 0.899528623f},
-std::array<float,2>{0.192835197f, 0.205251038f},
-std::array<float,2>{0.724847078f, 0.653734028f},
-std::array<float,2>{0.928573608f, 0.310868025f},
-std::array<float,2>{0.29648304f, 0.830669165f},
-std::array<float,2>{0.398922265f, 0.426441431f},
-std::array<float,2>{0.861588776f, 0.937829137f},
-std::array<float,2>{0.539077699f, 0.0962507948f},
-std::array<float,2>{0.116069958f, 0.605011165f},
-std::array<float,2>{0.000512135099f, 0.457875937f},
-std::array<float,2>{0.577509761f, 0.894309342f},
-std::array<float,2>{0.750735223f, 0.0146406423f},
-std::array<float,2>{0.493773878f, 0.521395802f},
-std::array<float,2>{0.371695429f, 0.179402769f},
-std::array<float,2>{0.942680478f, 0.736910284f},
-std::array<float,2>{0.675206423f, 0.319713652f},
-std::array<float,2>{0.12549673f, 0.796600819f},
-std::array<float,2>{0.224823937f, 0.103701018f},
-std::array<float,2>{0.692772686f, 0.600499213f},
-std::array<float,2>{0.89155376f, 0.431622863f},
-std::array<float,2>{0.277957439f, 0.951488435f},
-std::array<float,2>{0.420200288f, 0.298965126f},
-std::array<float,2>{0.839218676f, 0.840587854f},
-std::array<float,2>{0.501781762f, 0.218472406f},
-std::array<float,2>{0.07289505f, 0.644727588f},
-std::array<float,2>{0.180066735f, 0.345184714f},
-std::array<float,2>{0.651808262f, 0.752574146f},
-std::array<float,2>{0.991476357f, 0.139204696f},
-std::array<float,2>{0.326913297f, 0.697141111f},
-std::array<float,2>{0.439408898f, 0.0403411612f},
-std::array<float,2>{0.787741601f, 0.55085367f},
-std::array<float,2>{0.6049999f, 0.490734249f},
-std::array<float,2>{0.0442357659f, 0.928248823f},
-std::array<float,2>{0.12445654f, 0.221656352f},
-std::array<float,2>{0.536180675f, 0.673759818f},
-std::array<float,2>{0.874773383f, 0.261694431f},
-std::array<float,2>{0.397774458f, 0.856154561f},
-std::array<float,2>{0.283040524f, 0.375680417f},
-std::array<float,2>{0.930195332f, 0.993019521f},
-std::array<float,2>{0.732257187f, 0.0726864338f},
-std::array<float,2>{0.199599579f, 0.58089745f},
-std::array<float,2>{0.218308747f, 0.409880102f},
-std::array<float,2>{0.735566616f, 0.966743827f},
-std::array<float,2>{0.908212245f, 0.113605887f},
-std::array<float,2>{0.303080291f, 0.61788106f},
-std::array<float,2>{0.377841592f, 0.191603735f},
-std::array<float,2>{0.851401746f, 0.630436003f},
-std::array<float,2>{0.548929691f, 0.289413124f},
-std::array<float,2>{0.0982572585f, 0.81394428f},
-std::array<float,2>{0.0546518452f, 0.0183660444f},
-std::array<float,2>{0.615920782f, 0.510477066f},
-std::array<float,2>{0.808489919f, 0.440015525f},
-std::array<float,2>{0.458300471f, 0.878911912f},
-std::array<float,2>{0.334542304f, 0.334871322f},
-std::array<float,2>{0.969902217f, 0.805105507f},
-std::array<float,2>{0.640428364f, 0.15976423f},
-std::array<float,2>{0.170189351f, 0.726248205f},
-std::array<float,2>{0.0909875482f, 0.267898321f},
-std::array<float,2>{0.5225721f, 0.867660522f},
-std::array<float,2>{0.818288326f, 0.245519251f},
-std::array<float,2>{0.429152638f, 0.660518944f},
-std::array<float,2>{0.255834103f, 0.0814378336f},
-std::array<float,2>{0.881477475f, 0.565218508f},
-std::array<float,2>{0.706734478f, 0.400337279f},
-std::array<float,2>{0.241764739f, 0.969740987f},
-std::array<float,2>{0.153159454f, 0.142630011f},
-std::array<float,2>{0.66982758f, 0.703789771f},
-std::array<float,2>{0.959457099f, 0.363001406f},
-std::array<float,2>{0.351230443f, 0.767560124f},
-std::array<float,2>{0.472987801f, 0.48121804f},
-std::array<float,2>{0.776852012f, 0.913212538f},
-std::array<float,2>{0.585106015f, 0.0571885817f},
-std::array<float,2>{0.0301056672f, 0.531441152f},
-std::array<float,2>{0.0484614111f, 0.38406226f},
-std::array<float,2>{0.612442374f, 0.990014791f},
-std::array<float,2>{0.810939252f, 0.0634716451f},
-std::array<float,2>{0.454396665f, 0.589444041f},
-std::array<float,2>{0.33003965f, 0.230807632f},
-std::array<float,2>{0.974080682f, 0.681544244f},
-std::array<float,2>{0.633980572f, 0.251341105f},
-std::array<float,2>{0.164289698f, 0.845170081f},
-std::array<float,2>{0.211952865f, 0.0377620682f},
-std::array<float,2>{0.742123425f, 0.555867136f},
-std::array<float,2>{0.91059047f, 0.499221891f},
-std::array<float,2>{0.29720068f, 0.936121702f},
-std::array<float,2>{0.381675541f, 0.354632229f},
-std::array<float,2>{0.846570909f, 0.763385236f},
-std::array<float,2>{0.552708983f, 0.129738092f},
-std::array<float,2>{0.097270906f, 0.690517068f},
-std::array<float,2>{0.150598213f, 0.306119055f},
-std::array<float,2>{0.66631484f, 0.83369875f},
-std::array<float,2>{0.956493974f, 0.207714885f},
-std::array<float,2>{0.344728708f, 0.65072602f},
-std::array<float,2>{0.472094238f, 0.097658284f},
-std::array<float,2>{0.780824482f, 0.608165324f},
-std::array<float,2>{0.578279972f, 0.423899084f},
-std::array<float,2>{0.0255439989f, 0.944354177f},
-std::array<float,2>{0.0878147408f, 0.184645802f},
-std::array<float,2>{0.517276168f, 0.74905169f},
-std::array<float,2>{0.812756479f, 0.325760752f},
-std::array<float,2>{0.421961725f, 0.786252558f},
-std::array<float,2>{0.251108676f, 0.463001758f},
-std::array<float,2>{0.876963854f, 0.902946353f},
-std::array<float,2>{0.708396137f, 0.00502454769f},
-std::array<float,2>{0.235904917f, 0.525760055f},
-std::array<float,2>{0.220302403f, 0.472924471f},
-std::array<float,2>{0.689162791f, 0.92024678f},
-std::array<float,2>{0.897701621f, 0.0521258414f},
-std::array<float,2>{0.276915699f, 0.54221791f},
-std::array<float,2>{0.414316863f, 0.152464718f},
-std::array<float,2>{0.842158794f, 0.711075366f},
-std::array<float,2>{0.507574975f, 0.369433522f},
-std::array<float,2>{0.0762209892f, 0.775145352f},
-std::array<float,2>{0.00697090523f, 0.0872411504f},
-std::array<float,2>{0.573530674f, 0.573230267f},
-std::array<float,2>{0.754375815f, 0.39731136f},
-std::array<float,2>{0.498665571f, 0.980216503f},
-std::array<float,2>{0.369700491f, 0.279287845f},
-std::array<float,2>{0.940942824f, 0.86530757f},
-std::array<float,2>{0.679590344f, 0.240364745f},
-std::array<float,2>{0.131097138f, 0.665881097f},
-std::array<float,2>{0.120314986f, 0.340612769f},
-std::array<float,2>{0.533943772f, 0.799156606f},
-std::array<float,2>{0.869742155f, 0.165422425f},
-std::array<float,2>{0.392435014f, 0.728499532f},
-std::array<float,2>{0.286871523f, 0.0257745869f},
-std::array<float,2>{0.935181677f, 0.505973101f},
-std::array<float,2>{0.727208495f, 0.450230181f},
-std::array<float,2>{0.19678846f, 0.882985711f},
-std::array<float,2>{0.18715024f, 0.195550859f},
-std::array<float,2>{0.653003216f, 0.635002077f},
-std::array<float,2>{0.987091303f, 0.285279781f},
-std::array<float,2>{0.32093513f, 0.824980676f},
-std::array<float,2>{0.441788822f, 0.419258177f},
-std::array<float,2>{0.782018304f, 0.960751534f},
-std::array<float,2>{0.608228624f, 0.119080111f},
-std::array<float,2>{0.0395404361f, 0.615342259f},
-std::array<float,2>{0.0686550364f, 0.44332388f},
-std::array<float,2>{0.509737253f, 0.875980377f},
-std::array<float,2>{0.832860887f, 0.0206137616f},
-std::array<float,2>{0.408199757f, 0.512630522f},
-std::array<float,2>{0.273024201f, 0.160761252f},
-std::array<float,2>{0.901201248f, 0.719034731f},
-std::array<float,2>{0.701815367f, 0.331252486f},
-std::array<float,2>{0.233070269f, 0.810646117f},
-std::array<float,2>{0.138142914f, 0.112192042f},
-std::array<float,2>{0.685474157f, 0.622960329f},
-std::array<float,2>{0.946210325f, 0.411803067f},
-std::array<float,2>{0.3605977f, 0.961682141f},
-std::array<float,2>{0.486780554f, 0.29442811f},
-std::array<float,2>{0.760598719f, 0.819903612f},
-std::array<float,2>{0.566847742f, 0.190605909f},
-std::array<float,2>{0.0120597789f, 0.627889216f},
-std::array<float,2>{0.188990802f, 0.367076099f},
-std::array<float,2>{0.720764935f, 0.770989716f},
-std::array<float,2>{0.923251748f, 0.145913467f},
-std::array<float,2>{0.290734142f, 0.707131326f},
-std::array<float,2>{0.405218154f, 0.0593460537f},
-std::array<float,2>{0.865205884f, 0.535458803f},
-std::array<float,2>{0.543676496f, 0.480394483f},
-std::array<float,2>{0.112468138f, 0.908867896f},
-std::array<float,2>{0.0365864672f, 0.249927044f},
-std::array<float,2>{0.593821704f, 0.657617748f},
-std::array<float,2>{0.793038547f, 0.27262345f},
-std::array<float,2>{0.450785816f, 0.873576581f},
-std::array<float,2>{0.316763699f, 0.403726786f},
-std::array<float,2>{0.998522997f, 0.97423625f},
-std::array<float,2>{0.643668473f, 0.0821406096f},
-std::array<float,2>{0.178810924f, 0.566438258f},
-std::array<float,2>{0.159963757f, 0.433685631f},
-std::array<float,2>{0.629935503f, 0.946226001f},
-std::array<float,2>{0.978575349f, 0.107765257f},
-std::array<float,2>{0.339954466f, 0.595159411f},
-std::array<float,2>{0.466194332f, 0.212311238f},
-std::array<float,2>{0.802636862f, 0.640880644f},
-std::array<float,2>{0.62451911f, 0.304004043f},
-std::array<float,2>{0.0563399903f, 0.838459551f},
-std::array<float,2>{0.105297588f, 0.0115281381f},
-std::array<float,2>{0.557437062f, 0.517545283f},
-std::array<float,2>{0.85235101f, 0.455071449f},
-std::array<float,2>{0.387518048f, 0.898351848f},
-std::array<float,2>{0.308862507f, 0.313951433f},
-std::array<float,2>{0.914361119f, 0.791938782f},
-std::array<float,2>{0.74613148f, 0.172030464f},
-std::array<float,2>{0.203578889f, 0.739472449f},
-std::array<float,2>{0.0176454205f, 0.26290068f},
-std::array<float,2>{0.591872692f, 0.852153718f},
-std::array<float,2>{0.769927204f, 0.226057172f},
-std::array<float,2>{0.480733424f, 0.678663135f},
-std::array<float,2>{0.352064043f, 0.0773165971f},
-std::array<float,2>{0.962801516f, 0.584398627f},
-std::array<float,2>{0.656654179f, 0.378988326f},
-std::array<float,2>{0.143314183f, 0.996178269f},
-std::array<float,2>{0.24868381f, 0.134185329f},
-std::array<float,2>{0.713306248f, 0.703015804f},
-std::array<float,2>{0.884030581f, 0.350381106f},
-std::array<float,2>{0.261014044f, 0.756521106f},
-std::array<float,2>{0.432870865f, 0.487191677f},
-std::array<float,2>{0.823148489f, 0.922904968f},
-std::array<float,2>{0.525043964f, 0.0447711498f},
-std::array<float,2>{0.0832369998f, 0.548409343f},
-std::array<float,2>{0.098127f, 0.407057106f},
-std::array<float,2>{0.549365342f, 0.968018115f},
-std::array<float,2>{0.850645244f, 0.115897983f},
-std::array<float,2>{0.377303153f, 0.620508373f},
-std::array<float,2>{0.303456992f, 0.193568379f},
-std::array<float,2>{0.908854306f, 0.631011605f},
-std::array<float,2>{0.736182094f, 0.291164249f},
-std::array<float,2>{0.218008518f, 0.815213263f},
-std::array<float,2>{0.170572117f, 0.0172673054f},
-std::array<float,2>{0.639823914f, 0.508287609f},
-std::array<float,2>{0.970230341f, 0.438384593f},
-std::array<float,2>{0.334059954f, 0.88115418f},
-std::array<float,2>{0.458965391f, 0.332840413f},
-std::array<float,2>{0.807704985f, 0.807933986f},
-std::array<float,2>{0.615302622f, 0.156691343f},
-std::array<float,2>{0.0540024042f, 0.723842382f},
-std::array<float,2>{0.241586193f, 0.265724123f},
-std::array<float,2>{0.706431746f, 0.870394707f},
-std::array<float,2>{0.880872488f, 0.24400261f},
-std::array<float,2>{0.255188167f, 0.663789392f},
-std::array<float,2>{0.429518193f, 0.0785184577f},
-std::array<float,2>{0.81760478f, 0.563214123f},
-std::array<float,2>{0.523125947f, 0.401604474f},
-std::array<float,2>{0.0917843729f, 0.971537411f},
-std::array<float,2>{0.0297464896f, 0.141263604f},
-std::array<float,2>{0.585556328f, 0.706156969f},
-std::array<float,2>{0.777147353f, 0.360174417f},
-std::array<float,2>{0.47352463f, 0.768124819f},
-std::array<float,2>{0.350795478f, 0.484217733f},
-std::array<float,2>{0.9595294f, 0.910317957f},
-std::array<float,2>{0.668971717f, 0.0555092171f},
-std::array<float,2>{0.15256533f, 0.534116626f},
-std::array<float,2>{0.125428259f, 0.459317148f},
-std::array<float,2>{0.675393403f, 0.891852617f},
-std::array<float,2>{0.943343341f, 0.0135372039f},
-std::array<float,2>{0.371436119f, 0.52286005f},
-std::array<float,2>{0.493290097f, 0.176847354f},
-std::array<float,2>{0.750236452f, 0.735839248f},
-std::array<float,2>{0.577880323f, 0.317075104f},
-std::array<float,2>{0.000351490278f, 0.793729901f},
-std::array<float,2>{0.0723690465f, 0.102994144f},
-std::array<float,2>{0.50102663f, 0.598878086f},
-std::array<float,2>{0.839444935f, 0.433032364f},
-std::array<float,2>{0.420827031f, 0.950378835f},
-std::array<float,2>{0.277607471f, 0.298140645f},
-std::array<float,2>{0.891011f, 0.843490779f},
-std::array<float,2>{0.692920983f, 0.21575518f},
-std::array<float,2>{0.225577235f, 0.646702051f},
-std::array<float,2>{0.0447947159f, 0.346262246f},
-std::array<float,2>{0.604951501f, 0.750722706f},
-std::array<float,2>{0.787569642f, 0.137213334f},
-std::array<float,2>{0.43879813f, 0.697964191f},
-std::array<float,2>{0.326465815f, 0.0424425937f},
-std::array<float,2>{0.991800547f, 0.554558754f},
-std::array<float,2>{0.652023554f, 0.488616616f},
-std::array<float,2>{0.180661365f, 0.926623881f},
-std::array<float,2>{0.19991082f, 0.219934061f},
-std::array<float,2>{0.731631875f, 0.675646544f},
-std::array<float,2>{0.929699242f, 0.259339094f},
-std::array<float,2>{0.2823039f, 0.858313859f},
-std::array<float,2>{0.398411542f, 0.377953976f},
-std::array<float,2>{0.874290884f, 0.995853066f},
-std::array<float,2>{0.53677398f, 0.0715927035f},
-std::array<float,2>{0.124628201f, 0.57816124f},
-std::array<float,2>{0.00881656073f, 0.495937943f},
-std::array<float,2>{0.565434933f, 0.93121314f},
-std::array<float,2>{0.764860034f, 0.0346283987f},
-std::array<float,2>{0.491765738f, 0.562297463f},
-std::array<float,2>{0.365856081f, 0.127259135f},
-std::array<float,2>{0.951559722f, 0.694263995f},
-std::array<float,2>{0.681271672f, 0.358037233f},
-std::array<float,2>{0.135380104f, 0.761193514f},
-std::array<float,2>{0.230385616f, 0.0695639029f},
-std::array<float,2>{0.697072208f, 0.590318739f},
-std::array<float,2>{0.905418456f, 0.38734436f},
-std::array<float,2>{0.267779678f, 0.98807168f},
-std::array<float,2>{0.412460685f, 0.254885256f},
-std::array<float,2>{0.831602097f, 0.850435793f},
-std::array<float,2>{0.512732983f, 0.227079809f},
-std::array<float,2>{0.0653978735f, 0.684726894f},
-std::array<float,2>{0.174351975f, 0.322232872f},
-std::array<float,2>{0.645098031f, 0.784600317f},
-std::array<float,2>{0.993400514f, 0.18049714f},
-std::array<float,2>{0.315454543f, 0.74529767f},
-std::array<float,2>{0.448667318f, 0.000767086982f},
-std::array<float,2>{0.791496336f, 0.530541778f},
-std::array<float,2>{0.59801501f, 0.465752512f},
-std::array<float,2>{0.0330999941f, 0.901741326f},
-std::array<float,2>{0.115258537f, 0.204673335f},
-std::array<float,2>{0.539661705f, 0.654872179f},
-std::array<float,2>{0.862270951f, 0.310242444f},
-std::array<float,2>{0.399281949f, 0.829165816f},
-std::array<float,2>{0.295944244f, 0.429272115f},
-std::array<float,2>{0.92808187f, 0.939869404f},
-std::array<float,2>{0.725318432f, 0.0949885622f},
-std::array<float,2>{0.192904562f, 0.602165461f},
-std::array<float,2>{0.210471764f, 0.392908305f},
-std::array<float,2>{0.745624065f, 0.981458008f},
-std::array<float,2>{0.918525815f, 0.0910262689f},
-std::array<float,2>{0.306592405f, 0.577220857f},
-std::array<float,2>{0.384600759f, 0.235007137f},
-std::array<float,2>{0.859368026f, 0.671236157f},
-std::array<float,2>{0.560981095f, 0.276966959f},
-std::array<float,2>{0.105876409f, 0.860905409f},
-std::array<float,2>{0.059462741f, 0.0492880531f},
-std::array<float,2>{0.62021786f, 0.544140995f},
-std::array<float,2>{0.799796224f, 0.470870435f},
-std::array<float,2>{0.463217795f, 0.915878534f},
-std::array<float,2>{0.337103367f, 0.374717146f},
-std::array<float,2>{0.981593609f, 0.781209826f},
-std::array<float,2>{0.628086329f, 0.149607375f},
-std::array<float,2>{0.160975769f, 0.715895295f},
-std::array<float,2>{0.0793923587f, 0.284931123f},
-std::array<float,2>{0.527735889f, 0.824115038f},
-std::array<float,2>{0.827142119f, 0.199522242f},
-std::array<float,2>{0.433689505f, 0.637854755f},
-std::array<float,2>{0.264878273f, 0.122787513f},
-std::array<float,2>{0.88886106f, 0.611391425f},
-std::array<float,2>{0.717303038f, 0.415783972f},
-std::array<float,2>{0.244997963f, 0.954912722f},
-std::array<float,2>{0.145019561f, 0.169819579f},
-std::array<float,2>{0.662754595f, 0.730997205f},
-std::array<float,2>{0.968388915f, 0.33743462f},
-std::array<float,2>{0.355969578f, 0.801067054f},
-std::array<float,2>{0.479941875f, 0.44588846f},
-std::array<float,2>{0.768843353f, 0.888731539f},
-std::array<float,2>{0.588053405f, 0.028185105f},
-std::array<float,2>{0.0215797648f, 0.50302887f},
-std::array<float,2>{0.0238141436f, 0.423794985f},
-std::array<float,2>{0.580757082f, 0.942500532f},
-std::array<float,2>{0.777452052f, 0.100930393f},
-std::array<float,2>{0.469553083f, 0.606286108f},
-std::array<float,2>{0.346173704f, 0.210804999f},
-std::array<float,2>{0.95499754f, 0.649224937f},
-std::array<float,2>{0.665419757f, 0.308517486f},
-std::array<float,2>{0.149963766f, 0.834878504f},
-std::array<float,2>{0.23809509f, 0.00638961f},
-std::array<float,2>{0.710505486f, 0.524319768f},
-std::array<float,2>{0.876469553f, 0.461399645f},
-std::array<float,2>{0.253426343f, 0.904447436f},
-std::array<float,2>{0.424474955f, 0.326291502f},
-std::array<float,2>{0.815898061f, 0.788879633f},
-std::array<float,2>{0.519308746f, 0.185654297f},
-std::array<float,2>{0.0890561938f, 0.747969091f},
-std::array<float,2>{0.166077793f, 0.253409266f},
-std::array<float,2>{0.635000527f, 0.847066641f},
-std::array<float,2>{0.976024687f, 0.23320286f},
-std::array<float,2>{0.331014454f, 0.682681322f},
-std::array<float,2>{0.456859052f, 0.0661981553f},
-std::array<float,2>{0.808596313f, 0.587321103f},
-std::array<float,2>{0.611129999f, 0.385389537f},
-std::array<float,2>{0.0507662445f, 0.991153181f},
-std::array<float,2>{0.0939581916f, 0.131844401f},
-std::array<float,2>{0.553053558f, 0.689415395f},
-std::array<float,2>{0.844594657f, 0.353512019f},
-std::array<float,2>{0.379725993f, 0.764120758f},
-std::array<float,2>{0.299101919f, 0.497193843f},
-std::array<float,2>{0.912632585f, 0.935527563f},
-std::array<float,2>{0.738588393f, 0.0359607562f},
-std::array<float,2>{0.214685529f, 0.557688117f},
-std::array<float,2>{0.197451696f, 0.452639759f},
-std::array<float,2>{0.729052186f, 0.884910703f},
-std::array<float,2>{0.936008751f, 0.0251016319f},
-std::array<float,2>{0.287906259f, 0.505178452f},
-std::array<float,2>{0.39450559f, 0.16794391f},
-std::array<float,2>{0.867702842f, 0.729219317f},
-std::array<float,2>{0.532058537f, 0.343204826f},
-std::array<float,2>{0.117356189f, 0.797014475f},
-std::array<float,2>{0.042224966f, 0.119755708f},
-std::array<float,2>{0.606610298f, 0.61464572f},
-std::array<float,2>{0.784435868f, 0.420596749f},
-std::array<float,2>{0.444188416f, 0.958686531f},
-std::array<float,2>{0.322336197f, 0.288695961f},
-std::array<float,2>{0.986191809f, 0.826877415f},
-std::array<float,2>{0.655474186f, 0.198791638f},
-std::array<float,2>{0.184240013f, 0.633708f},
-std::array<float,2>{0.0748507008f, 0.368361861f},
-std::array<float,2>{0.504021585f, 0.77576369f},
-std::array<float,2>{0.841144681f, 0.154506683f},
-std::array<float,2>{0.417792678f, 0.714114547f},
-std::array<float,2>{0.273848921f, 0.0531283952f},
-std::array<float,2>{0.895924389f, 0.53975141f},
-std::array<float,2>{0.68950063f, 0.475226074f},
-std::array<float,2>{0.221545711f, 0.919435203f},
-std::array<float,2>{0.12907736f, 0.23846066f},
-std::array<float,2>{0.677012503f, 0.666853428f},
-std::array<float,2>{0.938360155f, 0.279701501f},
-std::array<float,2>{0.367532194f, 0.863756359f},
-std::array<float,2>{0.496405423f, 0.395884871f},
-std::array<float,2>{0.756054044f, 0.977869511f},
-std::array<float,2>{0.570688248f, 0.0892772228f},
-std::array<float,2>{0.00496113021f, 0.570772231f},
-std::array<float,2>{0.110542879f, 0.477455705f},
-std::array<float,2>{0.545501769f, 0.906622052f},
-std::array<float,2>{0.865939021f, 0.0621549524f},
-std::array<float,2>{0.40420121f, 0.537587762f},
-std::array<float,2>{0.292061567f, 0.148152053f},
-std::array<float,2>{0.924581409f, 0.710427344f},
-std::array<float,2>{0.719643414f, 0.363532573f},
-std::array<float,2>{0.19039084f, 0.772305071f},
-std::array<float,2>{0.177263588f, 0.0842930973f},
-std::array<float,2>{0.641010642f, 0.569720507f},
-std::array<float,2>{0.997117162f, 0.404544532f},
-std::array<float,2>{0.318694472f, 0.975497544f},
-std::array<float,2>{0.452274859f, 0.270167947f},
-std::array<float,2>{0.79664427f, 0.871429205f},
-std::array<float,2>{0.596186638f, 0.24684912f},
-std::array<float,2>{0.038146019f, 0.65955919f},
-std::array<float,2>{0.231456205f, 0.330023885f},
-std::array<float,2>{0.699819505f, 0.808841109f},
-std::array<float,2>{0.899510145f, 0.162439629f},
-std::array<float,2>{0.270604551f, 0.721740067f},
-std::array<float,2>{0.409324825f, 0.0222705901f},
-std::array<float,2>{0.834486783f, 0.515606046f},
-std::array<float,2>{0.510234118f, 0.443774074f},
-std::array<float,2>{0.0674777925f, 0.878525734f},
-std::array<float,2>{0.01495397f, 0.188950092f},
-std::array<float,2>{0.569246233f, 0.626606703f},
-std::array<float,2>{0.757949412f, 0.295525998f},
-std::array<float,2>{0.485795557f, 0.818262398f},
-std::array<float,2>{0.361612022f, 0.412777603f},
-std::array<float,2>{0.947716296f, 0.964372277f},
-std::array<float,2>{0.686390877f, 0.110540539f},
-std::array<float,2>{0.139213815f, 0.623947084f},
-std::array<float,2>{0.14245525f, 0.38120535f},
-std::array<float,2>{0.658808172f, 0.998691618f},
-std::array<float,2>{0.964384913f, 0.0759688616f},
-std::array<float,2>{0.353578299f, 0.582263052f},
-std::array<float,2>{0.482848883f, 0.224150553f},
-std::array<float,2>{0.772262633f, 0.676250875f},
-std::array<float,2>{0.590395868f, 0.264779419f},
-std::array<float,2>{0.0172517691f, 0.855015337f},
-std::array<float,2>{0.0856575742f, 0.0456519388f},
-std::array<float,2>{0.527225256f, 0.550416827f},
-std::array<float,2>{0.821636617f, 0.485728532f},
-std::array<float,2>{0.431073546f, 0.925411463f},
-std::array<float,2>{0.258635104f, 0.348066062f},
-std::array<float,2>{0.884914637f, 0.755631685f},
-std::array<float,2>{0.711611331f, 0.135784283f},
-std::array<float,2>{0.246851057f, 0.699504554f},
-std::array<float,2>{0.0584555268f, 0.301505506f},
-std::array<float,2>{0.62270385f, 0.836501241f},
-std::array<float,2>{0.803899229f, 0.212924659f},
-std::array<float,2>{0.467563421f, 0.644390523f},
-std::array<float,2>{0.342520446f, 0.105590411f},
-std::array<float,2>{0.977471888f, 0.596011162f},
-std::array<float,2>{0.631210864f, 0.437285423f},
-std::array<float,2>{0.157255337f, 0.949058175f},
-std::array<float,2>{0.206745669f, 0.174501568f},
-std::array<float,2>{0.749079347f, 0.741189718f},
-std::array<float,2>{0.917808414f, 0.315978974f},
-std::array<float,2>{0.312396407f, 0.790892184f},
-std::array<float,2>{0.388846278f, 0.456708908f},
-std::array<float,2>{0.853906095f, 0.895568013f},
-std::array<float,2>{0.555522144f, 0.00909351744f},
-std::array<float,2>{0.102736071f, 0.517738521f},
-std::array<float,2>{0.0926277936f, 0.399478346f},
-std::array<float,2>{0.520561099f, 0.970263183f},
-std::array<float,2>{0.819341481f, 0.0819817707f},
-std::array<float,2>{0.427365303f, 0.564827263f},
-std::array<float,2>{0.256148696f, 0.245757684f},
-std::array<float,2>{0.879445493f, 0.661072612f},
-std::array<float,2>{0.703893602f, 0.268461883f},
-std::array<float,2>{0.238901526f, 0.868026793f},
-std::array<float,2>{0.15608415f, 0.056663841f},
-std::array<float,2>{0.671847939f, 0.531857908f},
-std::array<float,2>{0.958205283f, 0.480567992f},
-std::array<float,2>{0.347752333f, 0.913901985f},
-std::array<float,2>{0.475249499f, 0.362582058f},
-std::array<float,2>{0.774551928f, 0.766824722f},
-std::array<float,2>{0.582187712f, 0.143512502f},
-std::array<float,2>{0.0273776315f, 0.703305781f},
-std::array<float,2>{0.215121821f, 0.289672613f},
-std::array<float,2>{0.737272203f, 0.814420819f},
-std::array<float,2>{0.906691968f, 0.192360118f},
-std::array<float,2>{0.302370459f, 0.629886925f},
-std::array<float,2>{0.375089675f, 0.11379759f},
-std::array<float,2>{0.847872853f, 0.61744678f},
-std::array<float,2>{0.54719013f, 0.409442872f},
-std::array<float,2>{0.100930907f, 0.966199338f},
-std::array<float,2>{0.05145818f, 0.159207001f},
-std::array<float,2>{0.61501503f, 0.7260378f},
-std::array<float,2>{0.805051565f, 0.334218383f},
-std::array<float,2>{0.460083395f, 0.805355608f},
-std::array<float,2>{0.33257103f, 0.439746588f},
-std::array<float,2>{0.971394539f, 0.879594088f},
-std::array<float,2>{0.637517452f, 0.0180053916f},
-std::array<float,2>{0.168785259f, 0.509861827f},
-std::array<float,2>{0.183146387f, 0.490610749f},
-std::array<float,2>{0.648908973f, 0.927768052f},
-std::array<float,2>{0.989216268f, 0.0407214351f},
-std::array<float,2>{0.324687451f, 0.551394761f},
-std::array<float,2>{0.440509379f, 0.138695523f},
-std::array<float,2>{0.785191953f, 0.696334481f},
-std::array<float,2>{0.602889836f, 0.345259368f},
-std::array<float,2>{0.0452480353f, 0.751978755f},
-std::array<float,2>{0.122328147f, 0.0730976388f},
-std::array<float,2>{0.537592053f, 0.580155134f},
-std::array<float,2>{0.871978402f, 0.375478983f},
-std::array<float,2>{0.39646852f, 0.99228704f},
-std::array<float,2>{0.284618527f, 0.261166453f},
-std::array<float,2>{0.932758927f, 0.855561912f},
-std::array<float,2>{0.73288995f, 0.22096321f},
-std::array<float,2>{0.202141851f, 0.672931552f},
-std::array<float,2>{0.00266341283f, 0.32028091f},
-std::array<float,2>{0.574252546f, 0.796192527f},
-std::array<float,2>{0.753190935f, 0.179065958f},
-std::array<float,2>{0.495657086f, 0.736335099f},
-std::array<float,2>{0.373819619f, 0.0140738571f},
-std::array<float,2>{0.943686724f, 0.520691395f},
-std::array<float,2>{0.673827291f, 0.457050532f},
-std::array<float,2>{0.128561169f, 0.894029856f},
-std::array<float,2>{0.223673284f, 0.218149185f},
-std::array<float,2>{0.694817722f, 0.645289123f},
-std::array<float,2>{0.893973827f, 0.299327701f},
-std::array<float,2>{0.280421704f, 0.840114176f},
-std::array<float,2>{0.419537425f, 0.430938959f},
-std::array<float,2>{0.837300897f, 0.952094138f},
-std::array<float,2>{0.502215266f, 0.104141809f},
-std::array<float,2>{0.0719560832f, 0.599691689f},
-std::array<float,2>{0.0340766162f, 0.466917664f},
-std::array<float,2>{0.599658191f, 0.899985373f},
-std::array<float,2>{0.7903108f, 0.00379143702f},
-std::array<float,2>{0.446617991f, 0.528240681f},
-std::array<float,2>{0.31360966f, 0.182973817f},
-std::array<float,2>{0.994654775f, 0.742461979f},
-std::array<float,2>{0.64710176f, 0.323225409f},
-std::array<float,2>{0.172673926f, 0.78221482f},
-std::array<float,2>{0.193517476f, 0.0959352031f},
-std::array<float,2>{0.723638713f, 0.604548097f},
-std::array<float,2>{0.92690289f, 0.425851554f},
-std::array<float,2>{0.294640303f, 0.9383564f},
-std::array<float,2>{0.401700079f, 0.311189413f},
-std::array<float,2>{0.860743761f, 0.830266535f},
-std::array<float,2>{0.542121887f, 0.205666557f},
-std::array<float,2>{0.113436304f, 0.654074192f},
-std::array<float,2>{0.133428082f, 0.356407523f},
-std::array<float,2>{0.682539344f, 0.758783877f},
-std::array<float,2>{0.949398696f, 0.125764877f},
-std::array<float,2>{0.364427954f, 0.692343771f},
-std::array<float,2>{0.488735169f, 0.0326951556f},
-std::array<float,2>{0.762680531f, 0.560189486f},
-std::array<float,2>{0.562852383f, 0.49263531f},
-std::array<float,2>{0.00994670112f, 0.9326846f},
-std::array<float,2>{0.0628004074f, 0.230329692f},
-std::array<float,2>{0.514947593f, 0.686026335f},
-std::array<float,2>{0.829122484f, 0.256681025f},
-std::array<float,2>{0.411794037f, 0.848941565f},
-std::array<float,2>{0.266394317f, 0.390547007f},
-std::array<float,2>{0.903526068f, 0.985292733f},
-std::array<float,2>{0.698461533f, 0.0675314665f},
-std::array<float,2>{0.227253258f, 0.593668163f},
-std::array<float,2>{0.243570626f, 0.4171592f},
-std::array<float,2>{0.71509558f, 0.955793619f},
-std::array<float,2>{0.888594031f, 0.123064965f},
-std::array<float,2>{0.262791097f, 0.610280931f},
-std::array<float,2>{0.436217278f, 0.203012273f},
-std::array<float,2>{0.824857473f, 0.638791323f},
-std::array<float,2>{0.531086862f, 0.28314963f},
-std::array<float,2>{0.0805836767f, 0.820718408f},
-std::array<float,2>{0.0202429295f, 0.0307236277f},
-std::array<float,2>{0.587874651f, 0.501540363f},
-std::array<float,2>{0.766764462f, 0.448148161f},
-std::array<float,2>{0.477426946f, 0.887024105f},
-std::array<float,2>{0.358557642f, 0.339029163f},
-std::array<float,2>{0.965046525f, 0.803380072f},
-std::array<float,2>{0.660743952f, 0.171043664f},
-std::array<float,2>{0.148067757f, 0.732629061f},
-std::array<float,2>{0.108982086f, 0.274686724f},
-std::array<float,2>{0.560387015f, 0.861633718f},
-std::array<float,2>{0.855489194f, 0.237305433f},
-std::array<float,2>{0.38642621f, 0.669105113f},
-std::array<float,2>{0.307101309f, 0.0923018456f},
-std::array<float,2>{0.921075821f, 0.575544477f},
-std::array<float,2>{0.742231011f, 0.390797198f},
-std::array<float,2>{0.208116591f, 0.982791066f},
-std::array<float,2>{0.163815647f, 0.150605157f},
-std::array<float,2>{0.626354039f, 0.718053937f},
-std::array<float,2>{0.984325647f, 0.371553272f},
-std::array<float,2>{0.337904334f, 0.778174877f},
-std::array<float,2>{0.461907834f, 0.469335854f},
-std::array<float,2>{0.79708159f, 0.917557836f},
-std::array<float,2>{0.618692994f, 0.0476807803f},
-std::array<float,2>{0.0619665273f, 0.545179367f},
-std::array<float,2>{0.00403480884f, 0.398021847f},
-std::array<float,2>{0.571687043f, 0.978753805f},
-std::array<float,2>{0.757413626f, 0.0864922702f},
-std::array<float,2>{0.497215211f, 0.573558331f},
-std::array<float,2>{0.368914694f, 0.241490334f},
-std::array<float,2>{0.939153433f, 0.66418469f},
-std::array<float,2>{0.67595011f, 0.278086722f},
-std::array<float,2>{0.129921272f, 0.86701107f},
-std::array<float,2>{0.222294137f, 0.0509215072f},
-std::array<float,2>{0.690791488f, 0.541947007f},
-std::array<float,2>{0.895279944f, 0.473900825f},
-std::array<float,2>{0.274503708f, 0.921241522f},
-std::array<float,2>{0.416713893f, 0.37040624f},
-std::array<float,2>{0.840476573f, 0.773757637f},
-std::array<float,2>{0.50585711f, 0.153474346f},
-std::array<float,2>{0.07551153f, 0.712560713f},
-std::array<float,2>{0.185490236f, 0.286696345f},
-std::array<float,2>{0.655130267f, 0.825818598f},
-std::array<float,2>{0.984755516f, 0.196901545f},
-std::array<float,2>{0.323749006f, 0.636379421f},
-std::array<float,2>{0.444388539f, 0.118117161f},
-std::array<float,2>{0.784150958f, 0.616689265f},
-std::array<float,2>{0.605534732f, 0.418905348f},
-std::array<float,2>{0.0413950682f, 0.959654808f},
-std::array<float,2>{0.119118087f, 0.164715871f},
-std::array<float,2>{0.5327003f, 0.726890683f},
-std::array<float,2>{0.868977547f, 0.341327578f},
-std::array<float,2>{0.393277377f, 0.800754428f},
-std::array<float,2>{0.288890541f, 0.44925794f},
-std::array<float,2>{0.936875165f, 0.884341359f},
-std::array<float,2>{0.730187595f, 0.0272645243f},
-std::array<float,2>{0.198352084f, 0.507175386f},
-std::array<float,2>{0.213756219f, 0.498631656f},
-std::array<float,2>{0.740070283f, 0.936788201f},
-std::array<float,2>{0.914061368f, 0.0381400436f},
-std::array<float,2>{0.299920857f, 0.55510962f},
-std::array<float,2>{0.380049169f, 0.130223796f},
-std::array<float,2>{0.845229328f, 0.690413058f},
-std::array<float,2>{0.55450356f, 0.354366422f},
-std::array<float,2>{0.0947866514f, 0.762064993f},
-std::array<float,2>{0.0491923578f, 0.0642049536f},
-std::array<float,2>{0.609444261f, 0.588430166f},
-std::array<float,2>{0.809659183f, 0.382949799f},
-std::array<float,2>{0.455788404f, 0.988753378f},
-std::array<float,2>{0.331105083f, 0.250388622f},
-std::array<float,2>{0.97463274f, 0.844649553f},
-std::array<float,2>{0.636233628f, 0.231951892f},
-std::array<float,2>{0.167349726f, 0.680126548f},
-std::array<float,2>{0.0878970399f, 0.325025886f},
-std::array<float,2>{0.518398464f, 0.785975516f},
-std::array<float,2>{0.8146438f, 0.183674097f},
-std::array<float,2>{0.425525695f, 0.748231053f},
-std::array<float,2>{0.252854466f, 0.00418689381f},
-std::array<float,2>{0.875463963f, 0.526797473f},
-std::array<float,2>{0.70918411f, 0.464362174f},
-std::array<float,2>{0.236905366f, 0.903877795f},
-std::array<float,2>{0.14910391f, 0.20848538f},
-std::array<float,2>{0.664358199f, 0.651624322f},
-std::array<float,2>{0.953502953f, 0.305609733f},
-std::array<float,2>{0.347612083f, 0.832717299f},
-std::array<float,2>{0.470219582f, 0.425104439f},
-std::array<float,2>{0.778732359f, 0.944069684f},
-std::array<float,2>{0.581972718f, 0.0992860422f},
-std::array<float,2>{0.0252586361f, 0.609032691f},
-std::array<float,2>{0.102520876f, 0.453974754f},
-std::array<float,2>{0.556373715f, 0.896863759f},
-std::array<float,2>{0.854736149f, 0.0106547261f},
-std::array<float,2>{0.390374869f, 0.51579088f},
-std::array<float,2>{0.311372668f, 0.173548937f},
-std::array<float,2>{0.91637373f, 0.738623857f},
-std::array<float,2>{0.748893321f, 0.313292623f},
-std::array<float,2>{0.205175281f, 0.792325437f},
-std::array<float,2>{0.157213986f, 0.108986773f},
-std::array<float,2>{0.632296979f, 0.594425499f},
-std::array<float,2>{0.977803528f, 0.435352623f},
-std::array<float,2>{0.343720853f, 0.946935833f},
-std::array<float,2>{0.467966229f, 0.303142786f},
-std::array<float,2>{0.803678453f, 0.83897227f},
-std::array<float,2>{0.622056127f, 0.211704925f},
-std::array<float,2>{0.056918215f, 0.641891241f},
-std::array<float,2>{0.24738349f, 0.350818604f},
-std::array<float,2>{0.712330043f, 0.75694102f},
-std::array<float,2>{0.88612318f, 0.13327539f},
-std::array<float,2>{0.259030193f, 0.701537788f},
-std::array<float,2>{0.430294693f, 0.043300502f},
-std::array<float,2>{0.82070905f, 0.546987712f},
-std::array<float,2>{0.525533795f, 0.487324893f},
-std::array<float,2>{0.0840974152f, 0.92273128f},
-std::array<float,2>{0.0158241056f, 0.225050077f},
-std::array<float,2>{0.591096401f, 0.679637372f},
-std::array<float,2>{0.772805214f, 0.26218307f},
-std::array<float,2>{0.483563602f, 0.852603257f},
-std::array<float,2>{0.35489732f, 0.379886627f},
-std::array<float,2>{0.963386059f, 0.997345507f},
-std::array<float,2>{0.659205437f, 0.0769529492f},
-std::array<float,2>{0.141271561f, 0.5852862f},
-std::array<float,2>{0.140344173f, 0.410194248f},
-std::array<float,2>{0.686843991f, 0.962459564f},
-std::array<float,2>{0.94892478f, 0.112923644f},
-std::array<float,2>{0.362788081f, 0.621101797f},
-std::array<float,2>{0.484983265f, 0.189883769f},
-std::array<float,2>{0.758923352f, 0.628815472f},
-std::array<float,2>{0.569448173f, 0.293061942f},
-std::array<float,2>{0.0140952487f, 0.818516612f},
-std::array<float,2>{0.0671805218f, 0.020011507f},
-std::array<float,2>{0.511089206f, 0.513068974f},
-std::array<float,2>{0.835794866f, 0.442026645f},
-std::array<float,2>{0.408684969f, 0.875511229f},
-std::array<float,2>{0.270336986f, 0.330091417f},
-std::array<float,2>{0.898667753f, 0.812070906f},
-std::array<float,2>{0.700615883f, 0.161158964f},
-std::array<float,2>{0.230852857f, 0.720692337f},
-std::array<float,2>{0.0377891101f, 0.272131473f},
-std::array<float,2>{0.597435951f, 0.874603629f},
-std::array<float,2>{0.795530677f, 0.2485497f},
-std::array<float,2>{0.45139119f, 0.656791151f},
-std::array<float,2>{0.320119441f, 0.0837491825f},
-std::array<float,2>{0.996723592f, 0.567667663f},
-std::array<float,2>{0.641709566f, 0.403061569f},
-std::array<float,2>{0.175938606f, 0.973160982f},
-std::array<float,2>{0.190966472f, 0.144938335f},
-std::array<float,2>{0.720111609f, 0.708278596f},
-std::array<float,2>{0.925167501f, 0.365745544f},
-std::array<float,2>{0.291823804f, 0.770445466f},
-std::array<float,2>{0.402994812f, 0.479214162f},
-std::array<float,2>{0.866280973f, 0.90977937f},
-std::array<float,2>{0.546050191f, 0.0601957813f},
-std::array<float,2>{0.109424792f, 0.536543787f},
-std::array<float,2>{0.0712616071f, 0.431889713f},
-std::array<float,2>{0.503657043f, 0.9492957f},
-std::array<float,2>{0.836622298f, 0.101785704f},
-std::array<float,2>{0.418151557f, 0.59854573f},
-std::array<float,2>{0.28016454f, 0.216287777f},
-std::array<float,2>{0.893225312f, 0.647852778f},
-std::array<float,2>{0.69364357f, 0.29741621f},
-std::array<float,2>{0.222686246f, 0.842194796f},
-std::array<float,2>{0.12729907f, 0.0125336451f},
-std::array<float,2>{0.672071993f, 0.521873534f},
-std::array<float,2>{0.945170701f, 0.460901231f},
-std::array<float,2>{0.374367744f, 0.890891135f},
-std::array<float,2>{0.494821012f, 0.317784816f},
-std::array<float,2>{0.752815664f, 0.793947875f},
-std::array<float,2>{0.575500906f, 0.176728398f},
-std::array<float,2>{0.00293699838f, 0.735259473f},
-std::array<float,2>{0.202524915f, 0.258739918f},
-std::array<float,2>{0.733463109f, 0.858436525f},
-std::array<float,2>{0.932107985f, 0.219668016f},
-std::array<float,2>{0.283885956f, 0.67387414f},
-std::array<float,2>{0.394776225f, 0.0703220591f},
-std::array<float,2>{0.872463167f, 0.579365611f},
-std::array<float,2>{0.538584173f, 0.377631664f},
-std::array<float,2>{0.121705435f, 0.994537294f},
-std::array<float,2>{0.0468282662f, 0.138194412f},
-std::array<float,2>{0.602413654f, 0.698996305f},
-std::array<float,2>{0.786487341f, 0.347213894f},
-std::array<float,2>{0.440143168f, 0.75173825f},
-std::array<float,2>{0.325314164f, 0.489777565f},
-std::array<float,2>{0.989275694f, 0.927550018f},
-std::array<float,2>{0.649989665f, 0.0413105153f},
-std::array<float,2>{0.182157427f, 0.553179502f},
-std::array<float,2>{0.168984324f, 0.43887499f},
-std::array<float,2>{0.638011575f, 0.882710874f},
-std::array<float,2>{0.972199917f, 0.0164722055f},
-std::array<float,2>{0.333022505f, 0.509194911f},
-std::array<float,2>{0.459379047f, 0.157306373f},
-std::array<float,2>{0.80580467f, 0.723463833f},
-std::array<float,2>{0.61381954f, 0.333955616f},
-std::array<float,2>{0.052207157f, 0.807219863f},
-std::array<float,2>{0.0996436477f, 0.116935492f},
-std::array<float,2>{0.548663497f, 0.619641244f},
-std::array<float,2>{0.84875989f, 0.407989949f},
-std::array<float,2>{0.376006186f, 0.967752218f},
-std::array<float,2>{0.301754117f, 0.292599112f},
-std::array<float,2>{0.907722354f, 0.816071868f},
-std::array<float,2>{0.738074481f, 0.195013195f},
-std::array<float,2>{0.216234282f, 0.632200241f},
-std::array<float,2>{0.0283460543f, 0.361265928f},
-std::array<float,2>{0.583300591f, 0.768567979f},
-std::array<float,2>{0.773690403f, 0.142149433f},
-std::array<float,2>{0.476176172f, 0.705309868f},
-std::array<float,2>{0.349232256f, 0.0565070137f},
-std::array<float,2>{0.957042992f, 0.535076499f},
-std::array<float,2>{0.670784652f, 0.482603788f},
-std::array<float,2>{0.155171171f, 0.911614001f},
-std::array<float,2>{0.239519969f, 0.242274418f},
-std::array<float,2>{0.704787493f, 0.662469327f},
-std::array<float,2>{0.880094588f, 0.267230093f},
-std::array<float,2>{0.25751552f, 0.869566441f},
-std::array<float,2>{0.425894439f, 0.401037425f},
-std::array<float,2>{0.818442106f, 0.971755028f},
-std::array<float,2>{0.519552648f, 0.0793959722f},
-std::array<float,2>{0.0933601931f, 0.564185202f},
-std::array<float,2>{0.0610791966f, 0.471749991f},
-std::array<float,2>{0.617574096f, 0.914124489f},
-std::array<float,2>{0.798417032f, 0.0502452031f},
-std::array<float,2>{0.46237272f, 0.543356955f},
-std::array<float,2>{0.339410841f, 0.14870505f},
-std::array<float,2>{0.983318806f, 0.71549809f},
-std::array<float,2>{0.625142097f, 0.373402983f},
-std::array<float,2>{0.162287578f, 0.7796911f},
-std::array<float,2>{0.207340747f, 0.0901498273f},
-std::array<float,2>{0.743276179f, 0.576328695f},
-std::array<float,2>{0.920454562f, 0.394061297f},
-std::array<float,2>{0.30788517f, 0.980848312f},
-std::array<float,2>{0.385000706f, 0.276148289f},
-std::array<float,2>{0.856562436f, 0.859744549f},
-std::array<float,2>{0.558624208f, 0.235625863f},
-std::array<float,2>{0.108083405f, 0.670132458f},
-std::array<float,2>{0.146621659f, 0.336014003f},
-std::array<float,2>{0.661278069f, 0.802514911f},
-std::array<float,2>{0.96678257f, 0.168811992f},
-std::array<float,2>{0.358026415f, 0.731680512f},
-std::array<float,2>{0.477633238f, 0.0284922794f},
-std::array<float,2>{0.765737593f, 0.502376795f},
-std::array<float,2>{0.586429775f, 0.446659803f},
-std::array<float,2>{0.0212288853f, 0.890369236f},
-std::array<float,2>{0.0819150135f, 0.200935781f},
-std::array<float,2>{0.529537678f, 0.637518167f},
-std::array<float,2>{0.825480163f, 0.283208489f},
-std::array<float,2>{0.43686676f, 0.822509646f},
-std::array<float,2>{0.261829019f, 0.414815128f},
-std::array<float,2>{0.887388647f, 0.954047084f},
-std::array<float,2>{0.715993643f, 0.12194743f},
-std::array<float,2>{0.242324546f, 0.612666368f},
-std::array<float,2>{0.227761924f, 0.388140768f},
-std::array<float,2>{0.697492301f, 0.986733735f},
-std::array<float,2>{0.902636528f, 0.0692004934f},
-std::array<float,2>{0.267496049f, 0.590970814f},
-std::array<float,2>{0.411118984f, 0.227778688f},
-std::array<float,2>{0.82847476f, 0.684032142f},
-std::array<float,2>{0.514315248f, 0.25428772f},
-std::array<float,2>{0.0639731213f, 0.850756586f},
-std::array<float,2>{0.011282878f, 0.0339536332f},
-std::array<float,2>{0.563649476f, 0.56119591f},
-std::array<float,2>{0.763615131f, 0.4947007f},
-std::array<float,2>{0.489731401f, 0.930323541f},
-std::array<float,2>{0.363728881f, 0.359348565f},
-std::array<float,2>{0.950682163f, 0.760594189f},
-std::array<float,2>{0.683509707f, 0.128877252f},
-std::array<float,2>{0.134455293f, 0.694971442f},
-std::array<float,2>{0.115179829f, 0.309428096f},
-std::array<float,2>{0.541955173f, 0.828895271f},
-std::array<float,2>{0.859552681f, 0.203758538f},
-std::array<float,2>{0.400490999f, 0.655589521f},
-std::array<float,2>{0.293832242f, 0.0945939049f},
-std::array<float,2>{0.926111281f, 0.603381515f},
-std::array<float,2>{0.723410547f, 0.428594142f},
-std::array<float,2>{0.194690585f, 0.940517724f},
-std::array<float,2>{0.17299813f, 0.181214809f},
-std::array<float,2>{0.648075283f, 0.744464576f},
-std::array<float,2>{0.995841324f, 0.321104586f},
-std::array<float,2>{0.313046217f, 0.783874989f},
-std::array<float,2>{0.445786685f, 0.466662645f},
-std::array<float,2>{0.789290428f, 0.90102613f},
-std::array<float,2>{0.601262867f, 0.00128222059f},
-std::array<float,2>{0.0344154499f, 0.529973149f},
-std::array<float,2>{0.0410117768f, 0.42149058f},
-std::array<float,2>{0.609310091f, 0.957720637f},
-std::array<float,2>{0.783102632f, 0.120382287f},
-std::array<float,2>{0.442672789f, 0.613460481f},
-std::array<float,2>{0.321874261f, 0.198006287f},
-std::array<float,2>{0.987883449f, 0.634585738f},
-std::array<float,2>{0.653850138f, 0.28802672f},
-std::array<float,2>{0.186413139f, 0.827725649f},
-std::array<float,2>{0.195851088f, 0.0241192915f},
-std::array<float,2>{0.727763474f, 0.504121423f},
-std::array<float,2>{0.933604062f, 0.451185137f},
-std::array<float,2>{0.285330385f, 0.886580944f},
-std::array<float,2>{0.391109139f, 0.341897637f},
-std::array<float,2>{0.870274127f, 0.798130989f},
-std::array<float,2>{0.534860313f, 0.16653502f},
-std::array<float,2>{0.11977388f, 0.730077446f},
-std::array<float,2>{0.132312372f, 0.280388504f},
-std::array<float,2>{0.677871406f, 0.864284813f},
-std::array<float,2>{0.940392017f, 0.240200937f},
-std::array<float,2>{0.370316893f, 0.667669177f},
-std::array<float,2>{0.49957484f, 0.0886786133f},
-std::array<float,2>{0.755535603f, 0.571888924f},
-std::array<float,2>{0.572571337f, 0.395045221f},
-std::array<float,2>{0.00672546867f, 0.976950288f},
-std::array<float,2>{0.0776500553f, 0.15580371f},
-std::array<float,2>{0.506662846f, 0.71371305f},
-std::array<float,2>{0.84320879f, 0.368035585f},
-std::array<float,2>{0.416009724f, 0.777195692f},
-std::array<float,2>{0.27628845f, 0.47566095f},
-std::array<float,2>{0.897393763f, 0.918693542f},
-std::array<float,2>{0.688382447f, 0.0543181822f},
-std::array<float,2>{0.219494268f, 0.540190518f},
-std::array<float,2>{0.234524176f, 0.462529302f},
-std::array<float,2>{0.707331955f, 0.905680835f},
-std::array<float,2>{0.878762245f, 0.00684385374f},
-std::array<float,2>{0.250678778f, 0.524596035f},
-std::array<float,2>{0.423420131f, 0.186769456f},
-std::array<float,2>{0.813880801f, 0.746163785f},
-std::array<float,2>{0.516139507f, 0.327873141f},
-std::array<float,2>{0.0867474526f, 0.787633657f},
-std::array<float,2>{0.0272983499f, 0.0998261124f},
-std::array<float,2>{0.579995871f, 0.606553614f},
-std::array<float,2>{0.779678941f, 0.422178835f},
-std::array<float,2>{0.471264631f, 0.941847086f},
-std::array<float,2>{0.344029427f, 0.307222277f},
-std::array<float,2>{0.955771387f, 0.835707963f},
-std::array<float,2>{0.667279124f, 0.209538847f},
-std::array<float,2>{0.151646689f, 0.650198996f},
-std::array<float,2>{0.0958721042f, 0.352382571f},
-std::array<float,2>{0.551756799f, 0.764883339f},
-std::array<float,2>{0.847533107f, 0.130914837f},
-std::array<float,2>{0.382187217f, 0.688051283f},
-std::array<float,2>{0.298605353f, 0.0365612805f},
-std::array<float,2>{0.911586761f, 0.557067394f},
-std::array<float,2>{0.741199195f, 0.496497601f},
-std::array<float,2>{0.211088896f, 0.934565842f},
-std::array<float,2>{0.165066719f, 0.234154046f},
-std::array<float,2>{0.633700013f, 0.682439625f},
-std::array<float,2>{0.973488569f, 0.252583086f},
-std::array<float,2>{0.328929424f, 0.846534073f},
-std::array<float,2>{0.454000175f, 0.386089802f},
-std::array<float,2>{0.811844409f, 0.991609037f},
-std::array<float,2>{0.612303555f, 0.0647954494f},
-std::array<float,2>{0.0473856255f, 0.586465299f},
-std::array<float,2>{0.0825888142f, 0.48441872f},
-std::array<float,2>{0.523546815f, 0.924623668f},
-std::array<float,2>{0.823977649f, 0.0468453243f},
-std::array<float,2>{0.432116747f, 0.54938215f},
-std::array<float,2>{0.259859622f, 0.135057539f},
-std::array<float,2>{0.883122623f, 0.700707972f},
-std::array<float,2>{0.714827836f, 0.348840058f},
-std::array<float,2>{0.249639288f, 0.754289985f},
-std::array<float,2>{0.144029081f, 0.0748666301f},
-std::array<float,2>{0.65776217f, 0.583330631f},
-std::array<float,2>{0.961752057f, 0.382628679f},
-std::array<float,2>{0.352839589f, 0.999238193f},
-std::array<float,2>{0.481711596f, 0.264327854f},
-std::array<float,2>{0.771347284f, 0.854111373f},
-std::array<float,2>{0.59289366f, 0.223235294f},
-std::array<float,2>{0.0193534754f, 0.677518487f},
-std::array<float,2>{0.204366893f, 0.314812124f},
-std::array<float,2>{0.747536838f, 0.789666951f},
-std::array<float,2>{0.915245712f, 0.174857676f},
-std::array<float,2>{0.310103118f, 0.741474509f},
-std::array<float,2>{0.387813777f, 0.00783240981f},
-std::array<float,2>{0.853341281f, 0.518619478f},
-std::array<float,2>{0.557872117f, 0.455826074f},
-std::array<float,2>{0.104194865f, 0.894889176f},
-std::array<float,2>{0.0551516898f, 0.213878781f},
-std::array<float,2>{0.623482704f, 0.642938256f},
-std::array<float,2>{0.801395118f, 0.302617848f},
-std::array<float,2>{0.465146571f, 0.83763814f},
-std::array<float,2>{0.341670901f, 0.436332256f},
-std::array<float,2>{0.980204821f, 0.94729495f},
-std::array<float,2>{0.629424453f, 0.107268646f},
-std::array<float,2>{0.158556968f, 0.597090423f},
-std::array<float,2>{0.177846849f, 0.405567735f},
-std::array<float,2>{0.642647028f, 0.975876391f},
-std::array<float,2>{0.999783337f, 0.0849898681f},
-std::array<float,2>{0.317686796f, 0.569111526f},
-std::array<float,2>{0.449941933f, 0.247430205f},
-std::array<float,2>{0.794204116f, 0.659005225f},
-std::array<float,2>{0.595000565f, 0.271320671f},
-std::array<float,2>{0.0358486213f, 0.872934699f},
-std::array<float,2>{0.111962795f, 0.0606745705f},
-std::array<float,2>{0.54424417f, 0.538710475f},
-std::array<float,2>{0.86341548f, 0.477939039f},
-std::array<float,2>{0.405857325f, 0.907864392f},
-std::array<float,2>{0.289490223f, 0.364537239f},
-std::array<float,2>{0.922211826f, 0.773116112f},
-std::array<float,2>{0.721773207f, 0.146767274f},
-std::array<float,2>{0.188240096f, 0.709011674f},
-std::array<float,2>{0.0135831907f, 0.296155155f},
-std::array<float,2>{0.567498147f, 0.816496134f},
-std::array<float,2>{0.761503935f, 0.187602207f},
-std::array<float,2>{0.487815946f, 0.625377655f},
-std::array<float,2>{0.359998077f, 0.110048264f},
-std::array<float,2>{0.946815908f, 0.624488473f},
-std::array<float,2>{0.683913231f, 0.413228065f},
-std::array<float,2>{0.137065679f, 0.96362263f},
-std::array<float,2>{0.233509585f, 0.163708255f},
-std::array<float,2>{0.702364385f, 0.721195996f},
-std::array<float,2>{0.902097881f, 0.32884112f},
-std::array<float,2>{0.271909297f, 0.809699953f},
-std::array<float,2>{0.40665406f, 0.444467992f},
-std::array<float,2>{0.833143234f, 0.877235055f},
-std::array<float,2>{0.508636057f, 0.0231628474f},
-std::array<float,2>{0.0700909644f, 0.514125943f},
-std::array<float,2>{0.123863354f, 0.376664639f},
-std::array<float,2>{0.536049962f, 0.993598402f},
-std::array<float,2>{0.873141825f, 0.0735917836f},
-std::array<float,2>{0.396664411f, 0.58181119f},
-std::array<float,2>{0.28219074f, 0.222508252f},
-std::array<float,2>{0.931536615f, 0.671875954f},
-std::array<float,2>{0.730519593f, 0.260521382f},
-std::array<float,2>{0.200452164f, 0.857072353f},
-std::array<float,2>{0.181363195f, 0.0395689569f},
-std::array<float,2>{0.651242733f, 0.552690089f},
-std::array<float,2>{0.990697026f, 0.491894901f},
-std::array<float,2>{0.327946782f, 0.9294312f},
-std::array<float,2>{0.437541306f, 0.344274551f},
-std::array<float,2>{0.788392901f, 0.753026724f},
-std::array<float,2>{0.603708446f, 0.140275031f},
-std::array<float,2>{0.0439155847f, 0.6956141f},
-std::array<float,2>{0.22638905f, 0.300406784f},
-std::array<float,2>{0.691625774f, 0.841286242f},
-std::array<float,2>{0.892000794f, 0.217001587f},
-std::array<float,2>{0.279043406f, 0.645767748f},
-std::array<float,2>{0.421522141f, 0.105114579f},
-std::array<float,2>{0.838184059f, 0.601225555f},
-std::array<float,2>{0.500732362f, 0.430549264f},
-std::array<float,2>{0.0734759048f, 0.952669382f},
-std::array<float,2>{0.00114638114f, 0.178567454f},
-std::array<float,2>{0.576617897f, 0.737306893f},
-std::array<float,2>{0.751632154f, 0.319165409f},
-std::array<float,2>{0.493134856f, 0.795179367f},
-std::array<float,2>{0.372233897f, 0.458608419f},
-std::array<float,2>{0.942330897f, 0.893200815f},
-std::array<float,2>{0.673862994f, 0.0149841029f},
-std::array<float,2>{0.126592144f, 0.520303249f},
-std::array<float,2>{0.153356731f, 0.482257664f},
-std::array<float,2>{0.668343008f, 0.912923872f},
-std::array<float,2>{0.960696518f, 0.0577619821f},
-std::array<float,2>{0.350390047f, 0.532577753f},
-std::array<float,2>{0.473983079f, 0.143811524f},
-std::array<float,2>{0.775440753f, 0.705009162f},
-std::array<float,2>{0.584762931f, 0.362236649f},
-std::array<float,2>{0.0303816814f, 0.766332328f},
-std::array<float,2>{0.0901844651f, 0.0808322281f},
-std::array<float,2>{0.522293627f, 0.566320956f},
-std::array<float,2>{0.816541016f, 0.398457885f},
-std::array<float,2>{0.427991927f, 0.968862772f},
-std::array<float,2>{0.254781753f, 0.269448102f},
-std::array<float,2>{0.881925285f, 0.868501961f},
-std::array<float,2>{0.705497622f, 0.244602472f},
-std::array<float,2>{0.240894914f, 0.661925733f},
-std::array<float,2>{0.0534592718f, 0.335266829f},
-std::array<float,2>{0.616971314f, 0.806249499f},
-std::array<float,2>{0.807209373f, 0.158641234f},
-std::array<float,2>{0.457825005f, 0.724676967f},
-std::array<float,2>{0.335516006f, 0.0194057822f},
-std::array<float,2>{0.96939075f, 0.511172056f},
-std::array<float,2>{0.638976872f, 0.440582484f},
-std::array<float,2>{0.170925975f, 0.880554557f},
-std::array<float,2>{0.217569366f, 0.192662492f},
-std::array<float,2>{0.734443963f, 0.628987432f},
-std::array<float,2>{0.909344554f, 0.29035002f},
-std::array<float,2>{0.30402264f, 0.813384414f},
-std::array<float,2>{0.378543735f, 0.408959389f},
-std::array<float,2>{0.850251257f, 0.965200186f},
-std::array<float,2>{0.550489306f, 0.114801519f},
-std::array<float,2>{0.0995332003f, 0.618214488f},
-std::array<float,2>{0.0229305737f, 0.448286802f},
-std::array<float,2>{0.589379847f, 0.88803941f},
-std::array<float,2>{0.768218935f, 0.0302163661f},
-std::array<float,2>{0.478763759f, 0.500092089f},
-std::array<float,2>{0.357043415f, 0.170750961f},
-std::array<float,2>{0.967284679f, 0.734265327f},
-std::array<float,2>{0.663719296f, 0.338543981f},
-std::array<float,2>{0.146208212f, 0.804650843f},
-std::array<float,2>{0.245571047f, 0.124884456f},
-std::array<float,2>{0.718463242f, 0.610854268f},
-std::array<float,2>{0.889694631f, 0.416638374f},
-std::array<float,2>{0.26443404f, 0.956159592f},
-std::array<float,2>{0.434648871f, 0.282020241f},
-std::array<float,2>{0.828087687f, 0.821389019f},
-std::array<float,2>{0.529046834f, 0.201760337f},
-std::array<float,2>{0.0785419121f, 0.640012026f},
-std::array<float,2>{0.161611393f, 0.372372389f},
-std::array<float,2>{0.627175331f, 0.778375268f},
-std::array<float,2>{0.981419802f, 0.152269423f},
-std::array<float,2>{0.336194634f, 0.717394829f},
-std::array<float,2>{0.464068294f, 0.0483208559f},
-std::array<float,2>{0.800099909f, 0.546660781f},
-std::array<float,2>{0.619687855f, 0.46988371f},
-std::array<float,2>{0.0605235063f, 0.916273654f},
-std::array<float,2>{0.107222289f, 0.237012729f},
-std::array<float,2>{0.562297583f, 0.66809535f},
-std::array<float,2>{0.858368695f, 0.273662031f},
-std::array<float,2>{0.383159399f, 0.862350881f},
-std::array<float,2>{0.305397093f, 0.392101854f},
-std::array<float,2>{0.919172645f, 0.984288931f},
-std::array<float,2>{0.744585216f, 0.0928089693f},
-std::array<float,2>{0.209738195f, 0.574977756f},
-std::array<float,2>{0.191629454f, 0.4277246f},
-std::array<float,2>{0.725817025f, 0.939068913f},
-std::array<float,2>{0.929329634f, 0.0971564651f},
-std::array<float,2>{0.295707226f, 0.604446948f},
-std::array<float,2>{0.399970293f, 0.20672144f},
-std::array<float,2>{0.862675488f, 0.653001845f},
-std::array<float,2>{0.540069699f, 0.312498957f},
-std::array<float,2>{0.116968527f, 0.831808329f},
-std::array<float,2>{0.0316052586f, 0.00286873034f},
-std::array<float,2>{0.599238276f, 0.529030621f},
-std::array<float,2>{0.792072475f, 0.467862159f},
-std::array<float,2>{0.448041707f, 0.899211705f},
-std::array<float,2>{0.314870805f, 0.32393533f},
-std::array<float,2>{0.99233526f, 0.782502651f},
-std::array<float,2>{0.646308303f, 0.182216316f},
-std::array<float,2>{0.174997643f, 0.743650317f},
-std::array<float,2>{0.0655111969f, 0.257092386f},
-std::array<float,2>{0.512072146f, 0.848285973f},
-std::array<float,2>{0.830483198f, 0.228622526f},
-std::array<float,2>{0.413221687f, 0.686795413f},
-std::array<float,2>{0.268636167f, 0.0665978342f},
-std::array<float,2>{0.904887021f, 0.592315078f},
-std::array<float,2>{0.695525169f, 0.389505059f},
-std::array<float,2>{0.228952408f, 0.985467792f},
-std::array<float,2>{0.136295006f, 0.126784861f},
-std::array<float,2>{0.680404663f, 0.692383528f},
-std::array<float,2>{0.952998757f, 0.3566266f},
-std::array<float,2>{0.366365522f, 0.759005606f},
-std::array<float,2>{0.490415215f, 0.493691027f},
-std::array<float,2>{0.763860464f, 0.932503104f},
-std::array<float,2>{0.564959049f, 0.0318159796f},
-std::array<float,2>{0.0084650144f, 0.559097886f}}
\ No newline at end of file
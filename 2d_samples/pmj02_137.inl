@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.615254641f, 0.533075809f},
-std::array<float,2>{0.350310117f, 0.285426557f},
-std::array<float,2>{0.907272398f, 0.209263161f},
-std::array<float,2>{0.0173010416f, 0.815294802f},
-std::array<float,2>{0.831868052f, 0.90427804f},
-std::array<float,2>{0.240794003f, 0.075345695f},
-std::array<float,2>{0.684177041f, 0.420244187f},
-std::array<float,2>{0.493825614f, 0.704696536f},
-std::array<float,2>{0.693001866f, 0.789933801f},
-std::array<float,2>{0.430954218f, 0.17313768f},
-std::array<float,2>{0.782823205f, 0.350713193f},
-std::array<float,2>{0.168516144f, 0.563087702f},
-std::array<float,2>{0.986679494f, 0.660860658f},
-std::array<float,2>{0.102407351f, 0.47596994f},
-std::array<float,2>{0.552664042f, 0.0454135835f},
-std::array<float,2>{0.287565202f, 0.972872555f},
-std::array<float,2>{0.643963397f, 0.729685545f},
-std::array<float,2>{0.462726802f, 0.393604219f},
-std::array<float,2>{0.856906772f, 0.100732148f},
-std::array<float,2>{0.217301518f, 0.920417666f},
-std::array<float,2>{0.895599723f, 0.860199332f},
-std::array<float,2>{0.0525596999f, 0.230972737f},
-std::array<float,2>{0.568256259f, 0.273214549f},
-std::array<float,2>{0.316711634f, 0.506105781f},
-std::array<float,2>{0.513411343f, 0.955410779f},
-std::array<float,2>{0.263161361f, 0.0287828222f},
-std::array<float,2>{0.941446245f, 0.445616335f},
-std::array<float,2>{0.0655869693f, 0.641735494f},
-std::array<float,2>{0.774229407f, 0.594672799f},
-std::array<float,2>{0.137786761f, 0.3404935f},
-std::array<float,2>{0.739673495f, 0.150992855f},
-std::array<float,2>{0.387776583f, 0.766158462f},
-std::array<float,2>{0.546333551f, 0.626019835f},
-std::array<float,2>{0.297697783f, 0.460900694f},
-std::array<float,2>{0.970175147f, 0.0116978409f},
-std::array<float,2>{0.114265941f, 0.938160717f},
-std::array<float,2>{0.812220991f, 0.757365942f},
-std::array<float,2>{0.182068348f, 0.139795065f},
-std::array<float,2>{0.705222666f, 0.326450169f},
-std::array<float,2>{0.421063632f, 0.624726355f},
-std::array<float,2>{0.659961045f, 0.932068527f},
-std::array<float,2>{0.46996206f, 0.112241395f},
-std::array<float,2>{0.818239987f, 0.390521109f},
-std::array<float,2>{0.224558011f, 0.741416037f},
-std::array<float,2>{0.935379505f, 0.522006452f},
-std::array<float,2>{0.00410912698f, 0.253694624f},
-std::array<float,2>{0.609362304f, 0.238148883f},
-std::array<float,2>{0.372412652f, 0.847465217f},
-std::array<float,2>{0.725999236f, 0.590060771f},
-std::array<float,2>{0.391104639f, 0.373196393f},
-std::array<float,2>{0.762983382f, 0.164882347f},
-std::array<float,2>{0.142852157f, 0.807387233f},
-std::array<float,2>{0.953979015f, 0.998751938f},
-std::array<float,2>{0.0873141512f, 0.0493276566f},
-std::array<float,2>{0.526585996f, 0.488685757f},
-std::array<float,2>{0.268339664f, 0.687356174f},
-std::array<float,2>{0.585340083f, 0.831267655f},
-std::array<float,2>{0.343538344f, 0.192800969f},
-std::array<float,2>{0.885918438f, 0.30460152f},
-std::array<float,2>{0.0368274637f, 0.560913801f},
-std::array<float,2>{0.86488694f, 0.695742846f},
-std::array<float,2>{0.200343862f, 0.436110198f},
-std::array<float,2>{0.637918055f, 0.0854229927f},
-std::array<float,2>{0.44266209f, 0.882047653f},
-std::array<float,2>{0.517477155f, 0.614319623f},
-std::array<float,2>{0.280773789f, 0.318576366f},
-std::array<float,2>{0.963561177f, 0.125547484f},
-std::array<float,2>{0.0824586302f, 0.764558554f},
-std::array<float,2>{0.750608504f, 0.951213241f},
-std::array<float,2>{0.154216632f, 0.00656617293f},
-std::array<float,2>{0.732700646f, 0.461171925f},
-std::array<float,2>{0.403172404f, 0.639552176f},
-std::array<float,2>{0.632208049f, 0.852694333f},
-std::array<float,2>{0.4498173f, 0.248683155f},
-std::array<float,2>{0.869434476f, 0.263602704f},
-std::array<float,2>{0.192024529f, 0.523718834f},
-std::array<float,2>{0.876081228f, 0.745764673f},
-std::array<float,2>{0.0437327065f, 0.381474793f},
-std::array<float,2>{0.591008604f, 0.117598817f},
-std::array<float,2>{0.335839331f, 0.928703249f},
-std::array<float,2>{0.712671697f, 0.678741872f},
-std::array<float,2>{0.413083762f, 0.498333663f},
-std::array<float,2>{0.804129303f, 0.0550987571f},
-std::array<float,2>{0.178857654f, 0.985405207f},
-std::array<float,2>{0.981830955f, 0.802703679f},
-std::array<float,2>{0.123013578f, 0.15643543f},
-std::array<float,2>{0.53878206f, 0.362358272f},
-std::array<float,2>{0.311313182f, 0.58004266f},
-std::array<float,2>{0.599670053f, 0.885897398f},
-std::array<float,2>{0.364765286f, 0.0882368833f},
-std::array<float,2>{0.92845571f, 0.429353744f},
-std::array<float,2>{0.0114033744f, 0.689891219f},
-std::array<float,2>{0.826820016f, 0.551371396f},
-std::array<float,2>{0.227122217f, 0.31131348f},
-std::array<float,2>{0.670045555f, 0.19564411f},
-std::array<float,2>{0.483922362f, 0.840756178f},
-std::array<float,2>{0.575244665f, 0.71702224f},
-std::array<float,2>{0.327550799f, 0.412398696f},
-std::array<float,2>{0.903047621f, 0.0638633296f},
-std::array<float,2>{0.0597197413f, 0.89639461f},
-std::array<float,2>{0.847281635f, 0.825551808f},
-std::array<float,2>{0.21018438f, 0.212472022f},
-std::array<float,2>{0.655013204f, 0.291023135f},
-std::array<float,2>{0.460230142f, 0.54098022f},
-std::array<float,2>{0.747258306f, 0.978834093f},
-std::array<float,2>{0.381622255f, 0.035059493f},
-std::array<float,2>{0.772946358f, 0.481859386f},
-std::array<float,2>{0.128673404f, 0.671124578f},
-std::array<float,2>{0.94625783f, 0.572933793f},
-std::array<float,2>{0.0722076818f, 0.358044147f},
-std::array<float,2>{0.507420659f, 0.186473444f},
-std::array<float,2>{0.250278294f, 0.783778429f},
-std::array<float,2>{0.676030517f, 0.512111485f},
-std::array<float,2>{0.490866572f, 0.275497407f},
-std::array<float,2>{0.842328489f, 0.221798897f},
-std::array<float,2>{0.246991694f, 0.867496789f},
-std::array<float,2>{0.917519391f, 0.910123527f},
-std::array<float,2>{0.0245414097f, 0.107433192f},
-std::array<float,2>{0.621342063f, 0.398765206f},
-std::array<float,2>{0.352721661f, 0.719261229f},
-std::array<float,2>{0.55676496f, 0.780144513f},
-std::array<float,2>{0.289167315f, 0.140693754f},
-std::array<float,2>{0.998407781f, 0.334121704f},
-std::array<float,2>{0.0976729915f, 0.609161139f},
-std::array<float,2>{0.791614354f, 0.655008495f},
-std::array<float,2>{0.160729051f, 0.43817848f},
-std::array<float,2>{0.698363185f, 0.0179524682f},
-std::array<float,2>{0.422432274f, 0.964128494f},
-std::array<float,2>{0.548181057f, 0.530676365f},
-std::array<float,2>{0.283699125f, 0.258531272f},
-std::array<float,2>{0.988673747f, 0.242840797f},
-std::array<float,2>{0.106796451f, 0.856374383f},
-std::array<float,2>{0.785703719f, 0.924657702f},
-std::array<float,2>{0.16744639f, 0.123566993f},
-std::array<float,2>{0.687549174f, 0.376984537f},
-std::array<float,2>{0.437132806f, 0.74692446f},
-std::array<float,2>{0.68269974f, 0.761535764f},
-std::array<float,2>{0.496627092f, 0.131385654f},
-std::array<float,2>{0.833078682f, 0.314236939f},
-std::array<float,2>{0.23810865f, 0.609746456f},
-std::array<float,2>{0.914022863f, 0.634411693f},
-std::array<float,2>{0.0195319392f, 0.46602881f},
-std::array<float,2>{0.609584153f, 0.000109132889f},
-std::array<float,2>{0.343899369f, 0.945792556f},
-std::array<float,2>{0.734840333f, 0.692346215f},
-std::array<float,2>{0.386432886f, 0.424931735f},
-std::array<float,2>{0.778141856f, 0.090588361f},
-std::array<float,2>{0.133180723f, 0.889963031f},
-std::array<float,2>{0.941186428f, 0.838712633f},
-std::array<float,2>{0.0678458884f, 0.200230196f},
-std::array<float,2>{0.509220898f, 0.308306873f},
-std::array<float,2>{0.258322895f, 0.548045576f},
-std::array<float,2>{0.563797414f, 0.988925695f},
-std::array<float,2>{0.313869238f, 0.0606637783f},
-std::array<float,2>{0.891068518f, 0.492591947f},
-std::array<float,2>{0.050776653f, 0.675093591f},
-std::array<float,2>{0.853460789f, 0.584170103f},
-std::array<float,2>{0.214417413f, 0.364372224f},
-std::array<float,2>{0.648073018f, 0.16251646f},
-std::array<float,2>{0.468595624f, 0.797890544f},
-std::array<float,2>{0.604306102f, 0.666630685f},
-std::array<float,2>{0.369645953f, 0.479054302f},
-std::array<float,2>{0.933283985f, 0.037704356f},
-std::array<float,2>{0.0029007683f, 0.980600953f},
-std::array<float,2>{0.814011157f, 0.785676777f},
-std::array<float,2>{0.221486926f, 0.180766195f},
-std::array<float,2>{0.66110301f, 0.353929251f},
-std::array<float,2>{0.47629714f, 0.577440679f},
-std::array<float,2>{0.707912445f, 0.892368317f},
-std::array<float,2>{0.415699571f, 0.0665615052f},
-std::array<float,2>{0.807752728f, 0.408656836f},
-std::array<float,2>{0.184105724f, 0.711007476f},
-std::array<float,2>{0.974138319f, 0.54321748f},
-std::array<float,2>{0.109848611f, 0.293730855f},
-std::array<float,2>{0.539906144f, 0.216087207f},
-std::array<float,2>{0.301139176f, 0.82310015f},
-std::array<float,2>{0.634662509f, 0.602944314f},
-std::array<float,2>{0.439883828f, 0.331550241f},
-std::array<float,2>{0.860855818f, 0.147774339f},
-std::array<float,2>{0.196479827f, 0.775075972f},
-std::array<float,2>{0.890237391f, 0.966605663f},
-std::array<float,2>{0.0316035189f, 0.0221933294f},
-std::array<float,2>{0.580664694f, 0.442572236f},
-std::array<float,2>{0.339728326f, 0.651789963f},
-std::array<float,2>{0.531104863f, 0.874488294f},
-std::array<float,2>{0.272253722f, 0.224957064f},
-std::array<float,2>{0.95927912f, 0.280291706f},
-std::array<float,2>{0.0905320421f, 0.511101305f},
-std::array<float,2>{0.760369539f, 0.725076675f},
-std::array<float,2>{0.145386368f, 0.403691024f},
-std::array<float,2>{0.718866646f, 0.104877263f},
-std::array<float,2>{0.396772206f, 0.911508083f},
-std::array<float,2>{0.586137354f, 0.570209861f},
-std::array<float,2>{0.330679506f, 0.34659493f},
-std::array<float,2>{0.879977703f, 0.178339228f},
-std::array<float,2>{0.040920835f, 0.793965518f},
-std::array<float,2>{0.873940468f, 0.972400904f},
-std::array<float,2>{0.190596253f, 0.041300334f},
-std::array<float,2>{0.627356291f, 0.469608605f},
-std::array<float,2>{0.446995646f, 0.65713799f},
-std::array<float,2>{0.730287731f, 0.816826761f},
-std::array<float,2>{0.401166677f, 0.204551414f},
-std::array<float,2>{0.754777551f, 0.283799618f},
-std::array<float,2>{0.150155038f, 0.536867678f},
-std::array<float,2>{0.965876997f, 0.708177686f},
-std::array<float,2>{0.0809824914f, 0.415670782f},
-std::array<float,2>{0.52307868f, 0.0724257976f},
-std::array<float,2>{0.276317865f, 0.898701906f},
-std::array<float,2>{0.667376161f, 0.646928906f},
-std::array<float,2>{0.478987187f, 0.4525581f},
-std::array<float,2>{0.820796132f, 0.0270999223f},
-std::array<float,2>{0.233427331f, 0.957586884f},
-std::array<float,2>{0.925432563f, 0.772635579f},
-std::array<float,2>{0.0119537199f, 0.153115094f},
-std::array<float,2>{0.593874633f, 0.335949302f},
-std::array<float,2>{0.359647363f, 0.599008679f},
-std::array<float,2>{0.532936156f, 0.914479792f},
-std::array<float,2>{0.308318704f, 0.0942581072f},
-std::array<float,2>{0.977736592f, 0.396072596f},
-std::array<float,2>{0.11992906f, 0.732261181f},
-std::array<float,2>{0.797284722f, 0.501753569f},
-std::array<float,2>{0.172116384f, 0.267116427f},
-std::array<float,2>{0.716780543f, 0.227804661f},
-std::array<float,2>{0.406279296f, 0.863623381f},
-std::array<float,2>{0.503553927f, 0.734761894f},
-std::array<float,2>{0.256803513f, 0.384165436f},
-std::array<float,2>{0.949664295f, 0.114931524f},
-std::array<float,2>{0.0761398375f, 0.934792399f},
-std::array<float,2>{0.767787695f, 0.849009097f},
-std::array<float,2>{0.130571499f, 0.24075523f},
-std::array<float,2>{0.744613588f, 0.255556524f},
-std::array<float,2>{0.376806021f, 0.518155575f},
-std::array<float,2>{0.65141356f, 0.942017734f},
-std::array<float,2>{0.453392118f, 0.012227485f},
-std::array<float,2>{0.848252058f, 0.454277635f},
-std::array<float,2>{0.204200611f, 0.630358756f},
-std::array<float,2>{0.898658991f, 0.620632648f},
-std::array<float,2>{0.0581861846f, 0.321646035f},
-std::array<float,2>{0.570771515f, 0.134117365f},
-std::array<float,2>{0.321722269f, 0.75362277f},
-std::array<float,2>{0.701541722f, 0.556302547f},
-std::array<float,2>{0.42858848f, 0.298088849f},
-std::array<float,2>{0.793648481f, 0.189871043f},
-std::array<float,2>{0.159255207f, 0.833100498f},
-std::array<float,2>{0.992805481f, 0.878306627f},
-std::array<float,2>{0.0956699774f, 0.0818912759f},
-std::array<float,2>{0.560365856f, 0.430185527f},
-std::array<float,2>{0.293663472f, 0.701539397f},
-std::array<float,2>{0.618213058f, 0.812066734f},
-std::array<float,2>{0.357607007f, 0.169823483f},
-std::array<float,2>{0.921127796f, 0.368271351f},
-std::array<float,2>{0.0305257607f, 0.585998893f},
-std::array<float,2>{0.838276446f, 0.680817783f},
-std::array<float,2>{0.245299965f, 0.485530376f},
-std::array<float,2>{0.673586547f, 0.0543575399f},
-std::array<float,2>{0.486439645f, 0.995126247f},
-std::array<float,2>{0.569986701f, 0.505162299f},
-std::array<float,2>{0.320015937f, 0.270065814f},
-std::array<float,2>{0.897101402f, 0.234221295f},
-std::array<float,2>{0.0540641546f, 0.862677038f},
-std::array<float,2>{0.858890235f, 0.919186234f},
-std::array<float,2>{0.215524137f, 0.099038057f},
-std::array<float,2>{0.64095968f, 0.391634822f},
-std::array<float,2>{0.463926107f, 0.728463054f},
-std::array<float,2>{0.742113829f, 0.768712699f},
-std::array<float,2>{0.390430272f, 0.149536774f},
-std::array<float,2>{0.776592851f, 0.342089653f},
-std::array<float,2>{0.139755696f, 0.595905483f},
-std::array<float,2>{0.943569422f, 0.643928349f},
-std::array<float,2>{0.0633472204f, 0.447749853f},
-std::array<float,2>{0.514424264f, 0.0308951288f},
-std::array<float,2>{0.264912605f, 0.954660654f},
-std::array<float,2>{0.686929345f, 0.705715179f},
-std::array<float,2>{0.494778842f, 0.419568479f},
-std::array<float,2>{0.829377532f, 0.0780056119f},
-std::array<float,2>{0.238919184f, 0.9059304f},
-std::array<float,2>{0.91007328f, 0.813274622f},
-std::array<float,2>{0.0178566314f, 0.20703204f},
-std::array<float,2>{0.613586664f, 0.288853288f},
-std::array<float,2>{0.349017709f, 0.533242583f},
-std::array<float,2>{0.554023623f, 0.974649072f},
-std::array<float,2>{0.286393374f, 0.0440297015f},
-std::array<float,2>{0.984672427f, 0.473644435f},
-std::array<float,2>{0.104196854f, 0.662575901f},
-std::array<float,2>{0.785025537f, 0.564833701f},
-std::array<float,2>{0.171451733f, 0.348573357f},
-std::array<float,2>{0.695044041f, 0.175523773f},
-std::array<float,2>{0.433074206f, 0.791112721f},
-std::array<float,2>{0.525095999f, 0.684703231f},
-std::array<float,2>{0.26618278f, 0.491825163f},
-std::array<float,2>{0.955107868f, 0.0473873876f},
-std::array<float,2>{0.0883084089f, 0.9968822f},
-std::array<float,2>{0.764022529f, 0.806299686f},
-std::array<float,2>{0.142093629f, 0.166447088f},
-std::array<float,2>{0.724452376f, 0.372356236f},
-std::array<float,2>{0.393731117f, 0.593052864f},
-std::array<float,2>{0.638754904f, 0.879872501f},
-std::array<float,2>{0.444036692f, 0.0834950879f},
-std::array<float,2>{0.865974069f, 0.434404552f},
-std::array<float,2>{0.202876717f, 0.698323786f},
-std::array<float,2>{0.883022189f, 0.56005168f},
-std::array<float,2>{0.0378188677f, 0.301346004f},
-std::array<float,2>{0.582409501f, 0.19433628f},
-std::array<float,2>{0.341768354f, 0.829242587f},
-std::array<float,2>{0.703851879f, 0.621810973f},
-std::array<float,2>{0.419531941f, 0.325256675f},
-std::array<float,2>{0.809353292f, 0.136809647f},
-std::array<float,2>{0.180615425f, 0.755759418f},
-std::array<float,2>{0.971310019f, 0.939675331f},
-std::array<float,2>{0.116598047f, 0.00789669249f},
-std::array<float,2>{0.544029057f, 0.457952708f},
-std::array<float,2>{0.299212158f, 0.628580093f},
-std::array<float,2>{0.607234478f, 0.844012618f},
-std::array<float,2>{0.374949068f, 0.235727847f},
-std::array<float,2>{0.935608208f, 0.250724047f},
-std::array<float,2>{0.00700560585f, 0.521463633f},
-std::array<float,2>{0.818677068f, 0.7397995f},
-std::array<float,2>{0.224743396f, 0.38774702f},
-std::array<float,2>{0.656715691f, 0.109784432f},
-std::array<float,2>{0.47187385f, 0.929746568f},
-std::array<float,2>{0.53600347f, 0.580938518f},
-std::array<float,2>{0.310325086f, 0.360716343f},
-std::array<float,2>{0.984174132f, 0.15949215f},
-std::array<float,2>{0.124415427f, 0.804645836f},
-std::array<float,2>{0.80083251f, 0.987279892f},
-std::array<float,2>{0.17670761f, 0.0570784025f},
-std::array<float,2>{0.71335113f, 0.496694803f},
-std::array<float,2>{0.411419421f, 0.676857293f},
-std::array<float,2>{0.669750571f, 0.842929363f},
-std::array<float,2>{0.482112497f, 0.198823929f},
-std::array<float,2>{0.825988054f, 0.310084492f},
-std::array<float,2>{0.229314402f, 0.553338468f},
-std::array<float,2>{0.926255405f, 0.687775016f},
-std::array<float,2>{0.00881104544f, 0.427302122f},
-std::array<float,2>{0.59887886f, 0.0875787735f},
-std::array<float,2>{0.366194218f, 0.884312391f},
-std::array<float,2>{0.73171258f, 0.637509465f},
-std::array<float,2>{0.404585987f, 0.463306576f},
-std::array<float,2>{0.752602875f, 0.00448141666f},
-std::array<float,2>{0.154840901f, 0.950452089f},
-std::array<float,2>{0.962705135f, 0.762968481f},
-std::array<float,2>{0.0854470655f, 0.128088042f},
-std::array<float,2>{0.518202186f, 0.316474617f},
-std::array<float,2>{0.278473228f, 0.617093801f},
-std::array<float,2>{0.592021465f, 0.927603126f},
-std::array<float,2>{0.333256066f, 0.119256675f},
-std::array<float,2>{0.878427207f, 0.379308015f},
-std::array<float,2>{0.0463222079f, 0.742323518f},
-std::array<float,2>{0.867874146f, 0.526118815f},
-std::array<float,2>{0.193861991f, 0.264249623f},
-std::array<float,2>{0.630812407f, 0.247481018f},
-std::array<float,2>{0.452764839f, 0.855355978f},
-std::array<float,2>{0.624004841f, 0.721382678f},
-std::array<float,2>{0.35407266f, 0.40206334f},
-std::array<float,2>{0.91441679f, 0.105596527f},
-std::array<float,2>{0.0268127955f, 0.908011615f},
-std::array<float,2>{0.84158355f, 0.870955229f},
-std::array<float,2>{0.24858889f, 0.218970582f},
-std::array<float,2>{0.679638624f, 0.275308371f},
-std::array<float,2>{0.488336891f, 0.514268577f},
-std::array<float,2>{0.69679141f, 0.962047517f},
-std::array<float,2>{0.425195545f, 0.0175702889f},
-std::array<float,2>{0.790581107f, 0.439500332f},
-std::array<float,2>{0.16352208f, 0.652741849f},
-std::array<float,2>{0.996329367f, 0.607275248f},
-std::array<float,2>{0.101227961f, 0.33361879f},
-std::array<float,2>{0.556030691f, 0.144133881f},
-std::array<float,2>{0.291315496f, 0.778439641f},
-std::array<float,2>{0.653874874f, 0.542331219f},
-std::array<float,2>{0.45773524f, 0.290700108f},
-std::array<float,2>{0.845204651f, 0.214026049f},
-std::array<float,2>{0.207034081f, 0.826556802f},
-std::array<float,2>{0.904333889f, 0.896724224f},
-std::array<float,2>{0.0613518357f, 0.065367125f},
-std::array<float,2>{0.577049553f, 0.411343992f},
-std::array<float,2>{0.325942546f, 0.716558158f},
-std::array<float,2>{0.504216671f, 0.782239854f},
-std::array<float,2>{0.252425671f, 0.185461879f},
-std::array<float,2>{0.94919461f, 0.355567575f},
-std::array<float,2>{0.072357215f, 0.57190001f},
-std::array<float,2>{0.769622266f, 0.669091821f},
-std::array<float,2>{0.125285491f, 0.483139217f},
-std::array<float,2>{0.749492109f, 0.0320702195f},
-std::array<float,2>{0.380610675f, 0.977880836f},
-std::array<float,2>{0.509922504f, 0.549835861f},
-std::array<float,2>{0.261406839f, 0.306116283f},
-std::array<float,2>{0.939332545f, 0.201892346f},
-std::array<float,2>{0.0685171336f, 0.837169349f},
-std::array<float,2>{0.780604064f, 0.888297439f},
-std::array<float,2>{0.136467412f, 0.0921244472f},
-std::array<float,2>{0.737625599f, 0.422803849f},
-std::array<float,2>{0.383218527f, 0.693896949f},
-std::array<float,2>{0.645420015f, 0.800750315f},
-std::array<float,2>{0.466723591f, 0.162050262f},
-std::array<float,2>{0.85534513f, 0.366142541f},
-std::array<float,2>{0.210957751f, 0.583866358f},
-std::array<float,2>{0.89423573f, 0.672277451f},
-std::array<float,2>{0.0487321503f, 0.494192272f},
-std::array<float,2>{0.564768732f, 0.0598549098f},
-std::array<float,2>{0.314980417f, 0.991117835f},
-std::array<float,2>{0.689644396f, 0.749131382f},
-std::array<float,2>{0.434013605f, 0.376842082f},
-std::array<float,2>{0.787671566f, 0.121918172f},
-std::array<float,2>{0.165645242f, 0.922141731f},
-std::array<float,2>{0.991013587f, 0.857991815f},
-std::array<float,2>{0.107858762f, 0.245243981f},
-std::array<float,2>{0.550021291f, 0.25989753f},
-std::array<float,2>{0.281816661f, 0.529073834f},
-std::array<float,2>{0.612323582f, 0.947736323f},
-std::array<float,2>{0.345707566f, 0.00352595048f},
-std::array<float,2>{0.910914302f, 0.468455642f},
-std::array<float,2>{0.0229374971f, 0.636080325f},
-std::array<float,2>{0.835378706f, 0.611860037f},
-std::array<float,2>{0.23619549f, 0.315355361f},
-std::array<float,2>{0.680404603f, 0.129162773f},
-std::array<float,2>{0.49909693f, 0.759748459f},
-std::array<float,2>{0.578223765f, 0.649193466f},
-std::array<float,2>{0.337334156f, 0.444836497f},
-std::array<float,2>{0.886891544f, 0.0214809328f},
-std::array<float,2>{0.0347927622f, 0.968325615f},
-std::array<float,2>{0.861569822f, 0.776846766f},
-std::array<float,2>{0.198196664f, 0.146218836f},
-std::array<float,2>{0.635474682f, 0.328969419f},
-std::array<float,2>{0.437916994f, 0.605210662f},
-std::array<float,2>{0.72179693f, 0.912985206f},
-std::array<float,2>{0.396270037f, 0.102674559f},
-std::array<float,2>{0.759295464f, 0.404297769f},
-std::array<float,2>{0.146702662f, 0.722661376f},
-std::array<float,2>{0.95881331f, 0.508222997f},
-std::array<float,2>{0.0920044482f, 0.279144317f},
-std::array<float,2>{0.528064966f, 0.222777382f},
-std::array<float,2>{0.271456301f, 0.871787608f},
-std::array<float,2>{0.66329515f, 0.575070739f},
-std::array<float,2>{0.472911209f, 0.353319794f},
-std::array<float,2>{0.816305935f, 0.183258951f},
-std::array<float,2>{0.219488472f, 0.788117886f},
-std::array<float,2>{0.929820895f, 0.982605875f},
-std::array<float,2>{0.000779761409f, 0.0369906761f},
-std::array<float,2>{0.601620674f, 0.477305651f},
-std::array<float,2>{0.367600054f, 0.664894879f},
-std::array<float,2>{0.542839825f, 0.821722984f},
-std::array<float,2>{0.304672956f, 0.218385816f},
-std::array<float,2>{0.975170255f, 0.295796275f},
-std::array<float,2>{0.111988932f, 0.545254827f},
-std::array<float,2>{0.804780781f, 0.713936388f},
-std::array<float,2>{0.185764372f, 0.407658577f},
-std::array<float,2>{0.710898459f, 0.0697252676f},
-std::array<float,2>{0.416433275f, 0.894242048f},
-std::array<float,2>{0.597059786f, 0.599891961f},
-std::array<float,2>{0.362731069f, 0.339633912f},
-std::array<float,2>{0.923151135f, 0.154982701f},
-std::array<float,2>{0.0148740206f, 0.770774603f},
-std::array<float,2>{0.824031651f, 0.959926546f},
-std::array<float,2>{0.231394291f, 0.0243274346f},
-std::array<float,2>{0.665486455f, 0.449634135f},
-std::array<float,2>{0.477594733f, 0.64511323f},
-std::array<float,2>{0.718355417f, 0.865395248f},
-std::array<float,2>{0.409656256f, 0.230050638f},
-std::array<float,2>{0.799522281f, 0.268738925f},
-std::array<float,2>{0.175325662f, 0.502929926f},
-std::array<float,2>{0.979839444f, 0.734011352f},
-std::array<float,2>{0.117732316f, 0.396839261f},
-std::array<float,2>{0.534772933f, 0.096110858f},
-std::array<float,2>{0.306097478f, 0.916453063f},
-std::array<float,2>{0.626376212f, 0.660153031f},
-std::array<float,2>{0.449126989f, 0.472411901f},
-std::array<float,2>{0.872830451f, 0.0400245413f},
-std::array<float,2>{0.188920513f, 0.969706357f},
-std::array<float,2>{0.882268012f, 0.795466125f},
-std::array<float,2>{0.0415714644f, 0.176521555f},
-std::array<float,2>{0.58847636f, 0.345319688f},
-std::array<float,2>{0.330064744f, 0.567367852f},
-std::array<float,2>{0.521445751f, 0.901569724f},
-std::array<float,2>{0.27429682f, 0.0704909638f},
-std::array<float,2>{0.967321575f, 0.416425884f},
-std::array<float,2>{0.079394348f, 0.709739566f},
-std::array<float,2>{0.756519318f, 0.537614226f},
-std::array<float,2>{0.151329488f, 0.282463223f},
-std::array<float,2>{0.727530539f, 0.206752673f},
-std::array<float,2>{0.39948377f, 0.819146991f},
-std::array<float,2>{0.561823905f, 0.699866056f},
-std::array<float,2>{0.296055198f, 0.432273567f},
-std::array<float,2>{0.995608032f, 0.0791046843f},
-std::array<float,2>{0.0957180485f, 0.876711965f},
-std::array<float,2>{0.795831978f, 0.834115088f},
-std::array<float,2>{0.158031538f, 0.188427418f},
-std::array<float,2>{0.700721383f, 0.299441546f},
-std::array<float,2>{0.4258551f, 0.557927847f},
-std::array<float,2>{0.675706208f, 0.992957771f},
-std::array<float,2>{0.484729528f, 0.0518265851f},
-std::array<float,2>{0.836306453f, 0.486747503f},
-std::array<float,2>{0.242884398f, 0.683172524f},
-std::array<float,2>{0.91820246f, 0.589271605f},
-std::array<float,2>{0.0281150341f, 0.369439542f},
-std::array<float,2>{0.619352996f, 0.17161189f},
-std::array<float,2>{0.357360035f, 0.809606552f},
-std::array<float,2>{0.744109333f, 0.516892612f},
-std::array<float,2>{0.378092259f, 0.256088555f},
-std::array<float,2>{0.765849173f, 0.238503605f},
-std::array<float,2>{0.132650003f, 0.850546539f},
-std::array<float,2>{0.951791346f, 0.936583757f},
-std::array<float,2>{0.0770909116f, 0.117146194f},
-std::array<float,2>{0.501393974f, 0.384978831f},
-std::array<float,2>{0.255778223f, 0.737247825f},
-std::array<float,2>{0.572576523f, 0.750963032f},
-std::array<float,2>{0.32277143f, 0.136522576f},
-std::array<float,2>{0.901105165f, 0.323208362f},
-std::array<float,2>{0.05623018f, 0.617387712f},
-std::array<float,2>{0.850080907f, 0.630888343f},
-std::array<float,2>{0.205917373f, 0.456813037f},
-std::array<float,2>{0.650226176f, 0.0140969874f},
-std::array<float,2>{0.456774861f, 0.943861723f},
-std::array<float,2>{0.607839227f, 0.519753873f},
-std::array<float,2>{0.371845126f, 0.251770049f},
-std::array<float,2>{0.933851302f, 0.234639987f},
-std::array<float,2>{0.00503753172f, 0.845617592f},
-std::array<float,2>{0.817196012f, 0.931562006f},
-std::array<float,2>{0.222874999f, 0.110590905f},
-std::array<float,2>{0.658999324f, 0.387267679f},
-std::array<float,2>{0.468812168f, 0.73897177f},
-std::array<float,2>{0.706365466f, 0.754158437f},
-std::array<float,2>{0.420741022f, 0.138328403f},
-std::array<float,2>{0.810733736f, 0.324222147f},
-std::array<float,2>{0.183307543f, 0.622928262f},
-std::array<float,2>{0.969157875f, 0.627429008f},
-std::array<float,2>{0.113875829f, 0.458051622f},
-std::array<float,2>{0.54552418f, 0.00917376112f},
-std::array<float,2>{0.298208207f, 0.941218197f},
-std::array<float,2>{0.637504041f, 0.697613418f},
-std::array<float,2>{0.441451013f, 0.434598625f},
-std::array<float,2>{0.863357246f, 0.0829858109f},
-std::array<float,2>{0.199935243f, 0.880252779f},
-std::array<float,2>{0.885685861f, 0.828149617f},
-std::array<float,2>{0.0357105061f, 0.193394244f},
-std::array<float,2>{0.584040642f, 0.302108645f},
-std::array<float,2>{0.342345625f, 0.558956206f},
-std::array<float,2>{0.525594354f, 0.997841358f},
-std::array<float,2>{0.269460499f, 0.0486705154f},
-std::array<float,2>{0.954441547f, 0.491007745f},
-std::array<float,2>{0.086112693f, 0.684232056f},
-std::array<float,2>{0.762003779f, 0.592545271f},
-std::array<float,2>{0.144341752f, 0.372031748f},
-std::array<float,2>{0.725263774f, 0.167084545f},
-std::array<float,2>{0.392025262f, 0.805622518f},
-std::array<float,2>{0.550942898f, 0.663295805f},
-std::array<float,2>{0.288668156f, 0.472853333f},
-std::array<float,2>{0.987545729f, 0.043108765f},
-std::array<float,2>{0.102791488f, 0.975901961f},
-std::array<float,2>{0.781954467f, 0.792317808f},
-std::array<float,2>{0.169301182f, 0.174688309f},
-std::array<float,2>{0.691445887f, 0.34921518f},
-std::array<float,2>{0.430584162f, 0.565999091f},
-std::array<float,2>{0.685455561f, 0.905269504f},
-std::array<float,2>{0.492340475f, 0.0765039921f},
-std::array<float,2>{0.830694079f, 0.418652534f},
-std::array<float,2>{0.24213171f, 0.706543207f},
-std::array<float,2>{0.906273723f, 0.534352839f},
-std::array<float,2>{0.0165432654f, 0.287632018f},
-std::array<float,2>{0.616774023f, 0.208654568f},
-std::array<float,2>{0.35097903f, 0.814295888f},
-std::array<float,2>{0.739051282f, 0.596892059f},
-std::array<float,2>{0.387661129f, 0.343329817f},
-std::array<float,2>{0.774431288f, 0.148854569f},
-std::array<float,2>{0.137527749f, 0.768376231f},
-std::array<float,2>{0.943340778f, 0.953574777f},
-std::array<float,2>{0.0653207302f, 0.0298782066f},
-std::array<float,2>{0.512689471f, 0.449024022f},
-std::array<float,2>{0.262122482f, 0.643149734f},
-std::array<float,2>{0.566982985f, 0.862062573f},
-std::array<float,2>{0.318113208f, 0.232771471f},
-std::array<float,2>{0.895173073f, 0.271146059f},
-std::array<float,2>{0.0509822294f, 0.504610121f},
-std::array<float,2>{0.856125534f, 0.727131486f},
-std::array<float,2>{0.218329877f, 0.391215026f},
-std::array<float,2>{0.643469036f, 0.0978316218f},
-std::array<float,2>{0.461255848f, 0.91841954f},
-std::array<float,2>{0.506428003f, 0.570574462f},
-std::array<float,2>{0.25173986f, 0.356606632f},
-std::array<float,2>{0.946502805f, 0.184305072f},
-std::array<float,2>{0.071224615f, 0.781438112f},
-std::array<float,2>{0.772215486f, 0.977040827f},
-std::array<float,2>{0.127789199f, 0.0328118689f},
-std::array<float,2>{0.746699393f, 0.48347342f},
-std::array<float,2>{0.382809997f, 0.66870147f},
-std::array<float,2>{0.656019449f, 0.827780187f},
-std::array<float,2>{0.459477156f, 0.213322282f},
-std::array<float,2>{0.845849156f, 0.2892178f},
-std::array<float,2>{0.209764898f, 0.541499078f},
-std::array<float,2>{0.903624415f, 0.714962423f},
-std::array<float,2>{0.0595149882f, 0.410586059f},
-std::array<float,2>{0.574906468f, 0.0660934001f},
-std::array<float,2>{0.326372057f, 0.897902012f},
-std::array<float,2>{0.69744128f, 0.653959811f},
-std::array<float,2>{0.42367202f, 0.441153437f},
-std::array<float,2>{0.792093277f, 0.0159105379f},
-std::array<float,2>{0.161448777f, 0.96163547f},
-std::array<float,2>{0.99923259f, 0.777450144f},
-std::array<float,2>{0.0993696079f, 0.142834634f},
-std::array<float,2>{0.558249712f, 0.332586616f},
-std::array<float,2>{0.290574789f, 0.606325448f},
-std::array<float,2>{0.622550547f, 0.906870544f},
-std::array<float,2>{0.351691008f, 0.107024245f},
-std::array<float,2>{0.916812658f, 0.401070982f},
-std::array<float,2>{0.0242985226f, 0.722168386f},
-std::array<float,2>{0.843493283f, 0.515621662f},
-std::array<float,2>{0.24725832f, 0.273506224f},
-std::array<float,2>{0.677554309f, 0.220190197f},
-std::array<float,2>{0.492115319f, 0.870102406f},
-std::array<float,2>{0.589879751f, 0.743572712f},
-std::array<float,2>{0.334690213f, 0.380133361f},
-std::array<float,2>{0.875274479f, 0.120648198f},
-std::array<float,2>{0.0443296954f, 0.925844848f},
-std::array<float,2>{0.870798945f, 0.85417062f},
-std::array<float,2>{0.193267971f, 0.246263236f},
-std::array<float,2>{0.630923092f, 0.264864057f},
-std::array<float,2>{0.450741082f, 0.52649796f},
-std::array<float,2>{0.733400822f, 0.949249804f},
-std::array<float,2>{0.403649747f, 0.00576916942f},
-std::array<float,2>{0.751135468f, 0.46451956f},
-std::array<float,2>{0.152828053f, 0.638258934f},
-std::array<float,2>{0.964291036f, 0.615554273f},
-std::array<float,2>{0.083342202f, 0.317563981f},
-std::array<float,2>{0.516324282f, 0.127408609f},
-std::array<float,2>{0.280225158f, 0.761786461f},
-std::array<float,2>{0.670905292f, 0.554486871f},
-std::array<float,2>{0.483217418f, 0.308643103f},
-std::array<float,2>{0.828102112f, 0.197412282f},
-std::array<float,2>{0.228008181f, 0.842430115f},
-std::array<float,2>{0.929441571f, 0.882969797f},
-std::array<float,2>{0.0102683278f, 0.0868897736f},
-std::array<float,2>{0.600643635f, 0.426598281f},
-std::array<float,2>{0.363823891f, 0.689382851f},
-std::array<float,2>{0.537745416f, 0.803202331f},
-std::array<float,2>{0.311973959f, 0.158279598f},
-std::array<float,2>{0.981201947f, 0.35941875f},
-std::array<float,2>{0.121704899f, 0.581959784f},
-std::array<float,2>{0.803675413f, 0.676608741f},
-std::array<float,2>{0.178276703f, 0.497512788f},
-std::array<float,2>{0.71155405f, 0.0585543849f},
-std::array<float,2>{0.413852364f, 0.988253951f},
-std::array<float,2>{0.540506065f, 0.54635191f},
-std::array<float,2>{0.301935405f, 0.29641059f},
-std::array<float,2>{0.97273916f, 0.217205346f},
-std::array<float,2>{0.111092031f, 0.82044071f},
-std::array<float,2>{0.807403743f, 0.893463731f},
-std::array<float,2>{0.184849799f, 0.0686608627f},
-std::array<float,2>{0.708211482f, 0.406635731f},
-std::array<float,2>{0.414141744f, 0.713424981f},
-std::array<float,2>{0.661147177f, 0.787141919f},
-std::array<float,2>{0.475157797f, 0.182123229f},
-std::array<float,2>{0.812575221f, 0.352391094f},
-std::array<float,2>{0.222315639f, 0.575280607f},
-std::array<float,2>{0.932389259f, 0.665560842f},
-std::array<float,2>{0.00342619861f, 0.477860093f},
-std::array<float,2>{0.604768872f, 0.0360506587f},
-std::array<float,2>{0.370633304f, 0.983493984f},
-std::array<float,2>{0.72010994f, 0.723790228f},
-std::array<float,2>{0.398092389f, 0.405452549f},
-std::array<float,2>{0.761320233f, 0.102393121f},
-std::array<float,2>{0.146427423f, 0.91393137f},
-std::array<float,2>{0.960525274f, 0.872697532f},
-std::array<float,2>{0.0916152224f, 0.223779649f},
-std::array<float,2>{0.529803693f, 0.277585983f},
-std::array<float,2>{0.27320835f, 0.509356618f},
-std::array<float,2>{0.58201611f, 0.96732676f},
-std::array<float,2>{0.337998658f, 0.0204422809f},
-std::array<float,2>{0.888869762f, 0.443553448f},
-std::array<float,2>{0.0329226926f, 0.649603784f},
-std::array<float,2>{0.859551966f, 0.604419291f},
-std::array<float,2>{0.195712879f, 0.329784989f},
-std::array<float,2>{0.63326031f, 0.144889876f},
-std::array<float,2>{0.440978616f, 0.775506318f},
-std::array<float,2>{0.610789359f, 0.635247767f},
-std::array<float,2>{0.345362782f, 0.467146516f},
-std::array<float,2>{0.912809908f, 0.00222176802f},
-std::array<float,2>{0.0214237534f, 0.948986828f},
-std::array<float,2>{0.83242321f, 0.758756399f},
-std::array<float,2>{0.236824691f, 0.130681112f},
-std::array<float,2>{0.682010531f, 0.316222787f},
-std::array<float,2>{0.497697055f, 0.612935364f},
-std::array<float,2>{0.688691854f, 0.923129976f},
-std::array<float,2>{0.435915858f, 0.12239901f},
-std::array<float,2>{0.786935985f, 0.375890881f},
-std::array<float,2>{0.166596934f, 0.748217523f},
-std::array<float,2>{0.989365578f, 0.528035045f},
-std::array<float,2>{0.105953731f, 0.261335164f},
-std::array<float,2>{0.546917379f, 0.244999513f},
-std::array<float,2>{0.284793496f, 0.858415306f},
-std::array<float,2>{0.647052884f, 0.582534254f},
-std::array<float,2>{0.46731782f, 0.366811395f},
-std::array<float,2>{0.852492273f, 0.160398021f},
-std::array<float,2>{0.213255525f, 0.799596906f},
-std::array<float,2>{0.89175123f, 0.991930723f},
-std::array<float,2>{0.049253311f, 0.0589693449f},
-std::array<float,2>{0.563351274f, 0.49539423f},
-std::array<float,2>{0.312539339f, 0.673701048f},
-std::array<float,2>{0.508162737f, 0.836147845f},
-std::array<float,2>{0.259667873f, 0.20264338f},
-std::array<float,2>{0.940370679f, 0.305209428f},
-std::array<float,2>{0.066480957f, 0.549495876f},
-std::array<float,2>{0.77907902f, 0.694715559f},
-std::array<float,2>{0.134206429f, 0.423005611f},
-std::array<float,2>{0.735730588f, 0.0928984955f},
-std::array<float,2>{0.384833902f, 0.887091875f},
-std::array<float,2>{0.571474135f, 0.618240118f},
-std::array<float,2>{0.320625424f, 0.323270291f},
-std::array<float,2>{0.899554908f, 0.134905145f},
-std::array<float,2>{0.056760665f, 0.751009762f},
-std::array<float,2>{0.848642945f, 0.944578886f},
-std::array<float,2>{0.204091549f, 0.0152175725f},
-std::array<float,2>{0.650754511f, 0.455800414f},
-std::array<float,2>{0.454589367f, 0.632268488f},
-std::array<float,2>{0.745131433f, 0.850966275f},
-std::array<float,2>{0.375620306f, 0.239924029f},
-std::array<float,2>{0.768969715f, 0.256889254f},
-std::array<float,2>{0.129619449f, 0.516384065f},
-std::array<float,2>{0.950844109f, 0.737492442f},
-std::array<float,2>{0.0748703703f, 0.386249155f},
-std::array<float,2>{0.502335906f, 0.115927584f},
-std::array<float,2>{0.256960601f, 0.935803533f},
-std::array<float,2>{0.672174752f, 0.682486415f},
-std::array<float,2>{0.488206357f, 0.487727195f},
-std::array<float,2>{0.839210212f, 0.0514884852f},
-std::array<float,2>{0.244274959f, 0.993971705f},
-std::array<float,2>{0.920821667f, 0.808902979f},
-std::array<float,2>{0.0301983878f, 0.170247674f},
-std::array<float,2>{0.617786825f, 0.371051222f},
-std::array<float,2>{0.358480483f, 0.58860141f},
-std::array<float,2>{0.559414208f, 0.87569344f},
-std::array<float,2>{0.293951243f, 0.0783130378f},
-std::array<float,2>{0.993706405f, 0.433292955f},
-std::array<float,2>{0.0945620388f, 0.70031029f},
-std::array<float,2>{0.794900119f, 0.557271421f},
-std::array<float,2>{0.15826115f, 0.299936861f},
-std::array<float,2>{0.702232718f, 0.188936815f},
-std::array<float,2>{0.429638594f, 0.835197151f},
-std::array<float,2>{0.52170682f, 0.710238278f},
-std::array<float,2>{0.27683419f, 0.417045921f},
-std::array<float,2>{0.965595484f, 0.072148025f},
-std::array<float,2>{0.0814122856f, 0.901083469f},
-std::array<float,2>{0.755613685f, 0.819578707f},
-std::array<float,2>{0.148615658f, 0.205479279f},
-std::array<float,2>{0.729246259f, 0.281979352f},
-std::array<float,2>{0.401601672f, 0.538240731f},
-std::array<float,2>{0.628276169f, 0.970194399f},
-std::array<float,2>{0.446042478f, 0.0404544882f},
-std::array<float,2>{0.87406683f, 0.471396714f},
-std::array<float,2>{0.189742744f, 0.658946991f},
-std::array<float,2>{0.87905997f, 0.568251967f},
-std::array<float,2>{0.0395112969f, 0.344723433f},
-std::array<float,2>{0.587271214f, 0.177078992f},
-std::array<float,2>{0.331423998f, 0.795987606f},
-std::array<float,2>{0.715090692f, 0.50279206f},
-std::array<float,2>{0.408095837f, 0.268416971f},
-std::array<float,2>{0.797989547f, 0.228873998f},
-std::array<float,2>{0.173579827f, 0.866372883f},
-std::array<float,2>{0.977428496f, 0.917954624f},
-std::array<float,2>{0.120793201f, 0.0969056115f},
-std::array<float,2>{0.531409442f, 0.397637993f},
-std::array<float,2>{0.307305545f, 0.733048081f},
-std::array<float,2>{0.595632255f, 0.769997597f},
-std::array<float,2>{0.360693097f, 0.155961543f},
-std::array<float,2>{0.923871875f, 0.338019073f},
-std::array<float,2>{0.013538653f, 0.600948393f},
-std::array<float,2>{0.821814597f, 0.645606399f},
-std::array<float,2>{0.232640758f, 0.450286657f},
-std::array<float,2>{0.666859388f, 0.0250488147f},
-std::array<float,2>{0.479954302f, 0.959986329f},
-std::array<float,2>{0.583933771f, 0.562107801f},
-std::array<float,2>{0.340672314f, 0.303408176f},
-std::array<float,2>{0.883812904f, 0.191492587f},
-std::array<float,2>{0.0386015624f, 0.830172479f},
-std::array<float,2>{0.866652548f, 0.881587207f},
-std::array<float,2>{0.201677397f, 0.0843362957f},
-std::array<float,2>{0.640373528f, 0.437266827f},
-std::array<float,2>{0.444915742f, 0.696983814f},
-std::array<float,2>{0.723584533f, 0.808012307f},
-std::array<float,2>{0.393382192f, 0.165591016f},
-std::array<float,2>{0.765609264f, 0.37498796f},
-std::array<float,2>{0.140733421f, 0.590846717f},
-std::array<float,2>{0.956681669f, 0.686357319f},
-std::array<float,2>{0.0895062983f, 0.490005434f},
-std::array<float,2>{0.52393949f, 0.0499449633f},
-std::array<float,2>{0.267491311f, 0.999975324f},
-std::array<float,2>{0.658145308f, 0.740793526f},
-std::array<float,2>{0.471633822f, 0.389420033f},
-std::array<float,2>{0.819662452f, 0.113229737f},
-std::array<float,2>{0.226153225f, 0.932893276f},
-std::array<float,2>{0.936532378f, 0.845943868f},
-std::array<float,2>{0.00649451651f, 0.237160996f},
-std::array<float,2>{0.605498374f, 0.252042323f},
-std::array<float,2>{0.373358905f, 0.522524118f},
-std::array<float,2>{0.543662131f, 0.939008415f},
-std::array<float,2>{0.300369948f, 0.010641329f},
-std::array<float,2>{0.972338974f, 0.459134251f},
-std::array<float,2>{0.115530878f, 0.625696659f},
-std::array<float,2>{0.809727669f, 0.623693466f},
-std::array<float,2>{0.18099843f, 0.32766521f},
-std::array<float,2>{0.704111159f, 0.139158741f},
-std::array<float,2>{0.418160617f, 0.756559134f},
-std::array<float,2>{0.51514703f, 0.640841722f},
-std::array<float,2>{0.264510214f, 0.44642666f},
-std::array<float,2>{0.944634438f, 0.0280106384f},
-std::array<float,2>{0.0637762547f, 0.956375003f},
-std::array<float,2>{0.775424004f, 0.767449796f},
-std::array<float,2>{0.139596269f, 0.15180026f},
-std::array<float,2>{0.740424335f, 0.341516465f},
-std::array<float,2>{0.389085978f, 0.594897151f},
-std::array<float,2>{0.642501056f, 0.921000779f},
-std::array<float,2>{0.463223726f, 0.0997771919f},
-std::array<float,2>{0.858375072f, 0.39347592f},
-std::array<float,2>{0.216627777f, 0.728790164f},
-std::array<float,2>{0.897711992f, 0.507189035f},
-std::array<float,2>{0.0532516986f, 0.2717655f},
-std::array<float,2>{0.568764389f, 0.232307658f},
-std::array<float,2>{0.319283932f, 0.86090982f},
-std::array<float,2>{0.693602026f, 0.564311981f},
-std::array<float,2>{0.431972265f, 0.349998981f},
-std::array<float,2>{0.783307374f, 0.172366276f},
-std::array<float,2>{0.1707692f, 0.790076554f},
-std::array<float,2>{0.986132264f, 0.974096239f},
-std::array<float,2>{0.105345644f, 0.0464228727f},
-std::array<float,2>{0.5532341f, 0.475505143f},
-std::array<float,2>{0.285841167f, 0.661583364f},
-std::array<float,2>{0.615105152f, 0.816126168f},
-std::array<float,2>{0.348034084f, 0.210595697f},
-std::array<float,2>{0.908966064f, 0.286472112f},
-std::array<float,2>{0.0188839454f, 0.531401634f},
-std::array<float,2>{0.828721702f, 0.703246415f},
-std::array<float,2>{0.240227059f, 0.421114713f},
-std::array<float,2>{0.686310351f, 0.0748143792f},
-std::array<float,2>{0.495982617f, 0.902518868f},
-std::array<float,2>{0.555409372f, 0.608164191f},
-std::array<float,2>{0.292541951f, 0.33496663f},
-std::array<float,2>{0.99779588f, 0.141630068f},
-std::array<float,2>{0.100315996f, 0.780458868f},
-std::array<float,2>{0.789751828f, 0.963619947f},
-std::array<float,2>{0.162928969f, 0.0186973624f},
-std::array<float,2>{0.696240962f, 0.438784659f},
-std::array<float,2>{0.424646914f, 0.655918956f},
-std::array<float,2>{0.678264976f, 0.868885994f},
-std::array<float,2>{0.489679486f, 0.221391931f},
-std::array<float,2>{0.840355039f, 0.277290523f},
-std::array<float,2>{0.24976036f, 0.513368547f},
-std::array<float,2>{0.915329456f, 0.71977967f},
-std::array<float,2>{0.0263045616f, 0.399594486f},
-std::array<float,2>{0.624938309f, 0.108425297f},
-std::array<float,2>{0.354574978f, 0.909130096f},
-std::array<float,2>{0.748548687f, 0.670585334f},
-std::array<float,2>{0.379470378f, 0.481171042f},
-std::array<float,2>{0.771343827f, 0.0335863493f},
-std::array<float,2>{0.126306117f, 0.980184436f},
-std::array<float,2>{0.947804272f, 0.784601152f},
-std::array<float,2>{0.0732882693f, 0.187041759f},
-std::array<float,2>{0.505546153f, 0.358411521f},
-std::array<float,2>{0.25320527f, 0.574178576f},
-std::array<float,2>{0.577249289f, 0.894590259f},
-std::array<float,2>{0.325053602f, 0.0626543239f},
-std::array<float,2>{0.905842543f, 0.414011508f},
-std::array<float,2>{0.0620603785f, 0.718702912f},
-std::array<float,2>{0.844668925f, 0.539082706f},
-std::array<float,2>{0.208973065f, 0.292798162f},
-std::array<float,2>{0.652825117f, 0.211157039f},
-std::array<float,2>{0.458088458f, 0.824829102f},
-std::array<float,2>{0.597875535f, 0.690775156f},
-std::array<float,2>{0.366500467f, 0.428702533f},
-std::array<float,2>{0.927637875f, 0.0891792253f},
-std::array<float,2>{0.00832906738f, 0.885003269f},
-std::array<float,2>{0.824719429f, 0.841134846f},
-std::array<float,2>{0.230053738f, 0.19678095f},
-std::array<float,2>{0.668834925f, 0.311807215f},
-std::array<float,2>{0.480819732f, 0.5526281f},
-std::array<float,2>{0.714749932f, 0.984905183f},
-std::array<float,2>{0.410631329f, 0.055916857f},
-std::array<float,2>{0.801989555f, 0.499076813f},
-std::array<float,2>{0.1775617f, 0.677760482f},
-std::array<float,2>{0.983103275f, 0.578622997f},
-std::array<float,2>{0.123533107f, 0.362071663f},
-std::array<float,2>{0.537074924f, 0.158188775f},
-std::array<float,2>{0.308814943f, 0.801270902f},
-std::array<float,2>{0.629632115f, 0.525231004f},
-std::array<float,2>{0.45174244f, 0.261884987f},
-std::array<float,2>{0.868419349f, 0.249177456f},
-std::array<float,2>{0.194624081f, 0.851772428f},
-std::array<float,2>{0.877635777f, 0.929090023f},
-std::array<float,2>{0.0449891761f, 0.118621074f},
-std::array<float,2>{0.593141854f, 0.382125467f},
-std::array<float,2>{0.332959503f, 0.74476999f},
-std::array<float,2>{0.519408524f, 0.765519083f},
-std::array<float,2>{0.278186381f, 0.126234531f},
-std::array<float,2>{0.961118639f, 0.319977343f},
-std::array<float,2>{0.0847161785f, 0.613565803f},
-std::array<float,2>{0.753497481f, 0.639738321f},
-std::array<float,2>{0.155617177f, 0.462502033f},
-std::array<float,2>{0.730939686f, 0.00749114947f},
-std::array<float,2>{0.405658752f, 0.952166617f},
-std::array<float,2>{0.529014349f, 0.510662973f},
-std::array<float,2>{0.270230412f, 0.280164242f},
-std::array<float,2>{0.957905889f, 0.22596544f},
-std::array<float,2>{0.0928614587f, 0.873741269f},
-std::array<float,2>{0.758316994f, 0.910245597f},
-std::array<float,2>{0.148323968f, 0.103764832f},
-std::array<float,2>{0.721283853f, 0.403046817f},
-std::array<float,2>{0.395467728f, 0.725733399f},
-std::array<float,2>{0.63642025f, 0.773899138f},
-std::array<float,2>{0.438915491f, 0.147140503f},
-std::array<float,2>{0.862644136f, 0.330252528f},
-std::array<float,2>{0.198626041f, 0.602267683f},
-std::array<float,2>{0.888454974f, 0.651106715f},
-std::array<float,2>{0.0334155895f, 0.441723317f},
-std::array<float,2>{0.579590738f, 0.0228956304f},
-std::array<float,2>{0.336391121f, 0.965694904f},
-std::array<float,2>{0.709875047f, 0.712262213f},
-std::array<float,2>{0.417160213f, 0.409919322f},
-std::array<float,2>{0.806130409f, 0.0678207725f},
-std::array<float,2>{0.187256083f, 0.891252577f},
-std::array<float,2>{0.975845814f, 0.823600173f},
-std::array<float,2>{0.112838097f, 0.215488836f},
-std::array<float,2>{0.541573107f, 0.294657439f},
-std::array<float,2>{0.303239018f, 0.543969512f},
-std::array<float,2>{0.602899075f, 0.982184708f},
-std::array<float,2>{0.368530154f, 0.0382329933f},
-std::array<float,2>{0.931096017f, 0.480120987f},
-std::array<float,2>{0.00106011203f, 0.667121768f},
-std::array<float,2>{0.814648211f, 0.57633847f},
-std::array<float,2>{0.220460594f, 0.354809999f},
-std::array<float,2>{0.662904561f, 0.179861218f},
-std::array<float,2>{0.473970532f, 0.786680043f},
-std::array<float,2>{0.566243827f, 0.674549282f},
-std::array<float,2>{0.315664291f, 0.493633479f},
-std::array<float,2>{0.892852426f, 0.0618847497f},
-std::array<float,2>{0.0472086854f, 0.989506602f},
-std::array<float,2>{0.85425806f, 0.797537804f},
-std::array<float,2>{0.211951867f, 0.163805693f},
-std::array<float,2>{0.646418273f, 0.36404115f},
-std::array<float,2>{0.46574986f, 0.585769713f},
-std::array<float,2>{0.736923873f, 0.889204502f},
-std::array<float,2>{0.384168714f, 0.0914569199f},
-std::array<float,2>{0.779699802f, 0.424466729f},
-std::array<float,2>{0.135690227f, 0.692650378f},
-std::array<float,2>{0.93770355f, 0.547045469f},
-std::array<float,2>{0.07000269f, 0.306844056f},
-std::array<float,2>{0.511172831f, 0.199340433f},
-std::array<float,2>{0.25978294f, 0.839069128f},
-std::array<float,2>{0.681020021f, 0.611125886f},
-std::array<float,2>{0.498575062f, 0.312663913f},
-std::array<float,2>{0.834558189f, 0.132687837f},
-std::array<float,2>{0.235157937f, 0.760658383f},
-std::array<float,2>{0.912006915f, 0.9472422f},
-std::array<float,2>{0.0217814501f, 0.00115776388f},
-std::array<float,2>{0.611542344f, 0.465405017f},
-std::array<float,2>{0.347066671f, 0.633116484f},
-std::array<float,2>{0.549673676f, 0.856969595f},
-std::array<float,2>{0.282289892f, 0.243787974f},
-std::array<float,2>{0.991334081f, 0.259640098f},
-std::array<float,2>{0.108902931f, 0.530052423f},
-std::array<float,2>{0.788624465f, 0.747969806f},
-std::array<float,2>{0.164197609f, 0.378583223f},
-std::array<float,2>{0.691288173f, 0.12425819f},
-std::array<float,2>{0.435207009f, 0.925545931f},
-std::array<float,2>{0.620389342f, 0.587325335f},
-std::array<float,2>{0.35571748f, 0.367724001f},
-std::array<float,2>{0.919573188f, 0.168570116f},
-std::array<float,2>{0.0284955353f, 0.811269522f},
-std::array<float,2>{0.837114215f, 0.994333267f},
-std::array<float,2>{0.243537724f, 0.053635031f},
-std::array<float,2>{0.674443066f, 0.484567434f},
-std::array<float,2>{0.485658944f, 0.680553436f},
-std::array<float,2>{0.699658453f, 0.83209163f},
-std::array<float,2>{0.427427649f, 0.190878674f},
-std::array<float,2>{0.795938492f, 0.297417849f},
-std::array<float,2>{0.15635328f, 0.555663049f},
-std::array<float,2>{0.994214892f, 0.702347457f},
-std::array<float,2>{0.0969159156f, 0.431599349f},
-std::array<float,2>{0.560763597f, 0.0803861469f},
-std::array<float,2>{0.29586637f, 0.877104878f},
-std::array<float,2>{0.648440957f, 0.628970146f},
-std::array<float,2>{0.455838382f, 0.45344162f},
-std::array<float,2>{0.851520479f, 0.0134465117f},
-std::array<float,2>{0.206379682f, 0.942930102f},
-std::array<float,2>{0.901462615f, 0.752497315f},
-std::array<float,2>{0.054726284f, 0.132888258f},
-std::array<float,2>{0.573420167f, 0.321065575f},
-std::array<float,2>{0.323346257f, 0.619416654f},
-std::array<float,2>{0.500182867f, 0.933715641f},
-std::array<float,2>{0.254526883f, 0.113317512f},
-std::array<float,2>{0.952575266f, 0.383259326f},
-std::array<float,2>{0.0780210644f, 0.735677719f},
-std::array<float,2>{0.767484844f, 0.519337595f},
-std::array<float,2>{0.131579608f, 0.254858673f},
-std::array<float,2>{0.742210686f, 0.241476327f},
-std::array<float,2>{0.377403736f, 0.848352373f},
-std::array<float,2>{0.533466339f, 0.73050648f},
-std::array<float,2>{0.305645615f, 0.395230144f},
-std::array<float,2>{0.979229033f, 0.0950841829f},
-std::array<float,2>{0.118956067f, 0.915536642f},
-std::array<float,2>{0.80008626f, 0.864454389f},
-std::array<float,2>{0.17436491f, 0.226770118f},
-std::array<float,2>{0.716962695f, 0.265992194f},
-std::array<float,2>{0.408703268f, 0.500662506f},
-std::array<float,2>{0.664277732f, 0.958384633f},
-std::array<float,2>{0.476723105f, 0.0260752887f},
-std::array<float,2>{0.82295388f, 0.451298118f},
-std::array<float,2>{0.23175092f, 0.648365796f},
-std::array<float,2>{0.922674358f, 0.597887576f},
-std::array<float,2>{0.0144271646f, 0.337214381f},
-std::array<float,2>{0.595792234f, 0.153400034f},
-std::array<float,2>{0.362029374f, 0.771982372f},
-std::array<float,2>{0.727806032f, 0.535566151f},
-std::array<float,2>{0.398595333f, 0.285144806f},
-std::array<float,2>{0.756985784f, 0.20388864f},
-std::array<float,2>{0.151975229f, 0.817822158f},
-std::array<float,2>{0.968200684f, 0.899531245f},
-std::array<float,2>{0.0788837299f, 0.0741194338f},
-std::array<float,2>{0.520004869f, 0.415005147f},
-std::array<float,2>{0.275204033f, 0.707260728f},
-std::array<float,2>{0.58978796f, 0.79392153f},
-std::array<float,2>{0.328154922f, 0.179542258f},
-std::array<float,2>{0.881036162f, 0.347577572f},
-std::array<float,2>{0.0428267606f, 0.56871599f},
-std::array<float,2>{0.871551096f, 0.657591462f},
-std::array<float,2>{0.18781811f, 0.470516115f},
-std::array<float,2>{0.625194788f, 0.0427028649f},
-std::array<float,2>{0.447271585f, 0.97162497f},
-std::array<float,2>{0.601495981f, 0.552119434f},
-std::array<float,2>{0.363341868f, 0.312166095f},
-std::array<float,2>{0.929041326f, 0.196429774f},
-std::array<float,2>{0.0102365697f, 0.84144181f},
-std::array<float,2>{0.827287674f, 0.885385573f},
-std::array<float,2>{0.228109822f, 0.0898327157f},
-std::array<float,2>{0.671500742f, 0.428052157f},
-std::array<float,2>{0.482777148f, 0.691118002f},
-std::array<float,2>{0.711285233f, 0.800816119f},
-std::array<float,2>{0.413463444f, 0.157244578f},
-std::array<float,2>{0.80287832f, 0.361573488f},
-std::array<float,2>{0.177837551f, 0.578395307f},
-std::array<float,2>{0.980830312f, 0.678535223f},
-std::array<float,2>{0.12121354f, 0.49952966f},
-std::array<float,2>{0.537492871f, 0.056213595f},
-std::array<float,2>{0.312321752f, 0.984650195f},
-std::array<float,2>{0.631831169f, 0.744198442f},
-std::array<float,2>{0.450681984f, 0.382681549f},
-std::array<float,2>{0.870364487f, 0.118653223f},
-std::array<float,2>{0.192467347f, 0.929359317f},
-std::array<float,2>{0.875768125f, 0.852186799f},
-std::array<float,2>{0.0445974618f, 0.249813721f},
-std::array<float,2>{0.590734899f, 0.262366265f},
-std::array<float,2>{0.334128082f, 0.524767578f},
-std::array<float,2>{0.515808403f, 0.952776194f},
-std::array<float,2>{0.279753119f, 0.00704331836f},
-std::array<float,2>{0.964582324f, 0.462116063f},
-std::array<float,2>{0.0839446038f, 0.640222311f},
-std::array<float,2>{0.751939535f, 0.6138376f},
-std::array<float,2>{0.152846918f, 0.319632947f},
-std::array<float,2>{0.734011292f, 0.126495153f},
-std::array<float,2>{0.404006034f, 0.764657021f},
-std::array<float,2>{0.55771929f, 0.655507267f},
-std::array<float,2>{0.290137082f, 0.43907997f},
-std::array<float,2>{0.999784708f, 0.0192660019f},
-std::array<float,2>{0.0987423658f, 0.962974608f},
-std::array<float,2>{0.792835832f, 0.780809045f},
-std::array<float,2>{0.161905363f, 0.142380938f},
-std::array<float,2>{0.69802171f, 0.335900128f},
-std::array<float,2>{0.423075616f, 0.607810915f},
-std::array<float,2>{0.677238882f, 0.908502579f},
-std::array<float,2>{0.491583437f, 0.109209463f},
-std::array<float,2>{0.843120396f, 0.400036961f},
-std::array<float,2>{0.247638851f, 0.720619202f},
-std::array<float,2>{0.916445553f, 0.512980223f},
-std::array<float,2>{0.023877224f, 0.276853055f},
-std::array<float,2>{0.622903168f, 0.221011341f},
-std::array<float,2>{0.352204204f, 0.868627191f},
-std::array<float,2>{0.746556461f, 0.573464394f},
-std::array<float,2>{0.382134169f, 0.359265566f},
-std::array<float,2>{0.771799862f, 0.186951667f},
-std::array<float,2>{0.126993075f, 0.78495878f},
-std::array<float,2>{0.947131634f, 0.979748905f},
-std::array<float,2>{0.070548512f, 0.0340373665f},
-std::array<float,2>{0.50628823f, 0.480916351f},
-std::array<float,2>{0.251226395f, 0.670086145f},
-std::array<float,2>{0.574643195f, 0.824671745f},
-std::array<float,2>{0.326789469f, 0.211908996f},
-std::array<float,2>{0.903810918f, 0.292074114f},
-std::array<float,2>{0.0587384775f, 0.539551973f},
-std::array<float,2>{0.846572876f, 0.71803683f},
-std::array<float,2>{0.209417194f, 0.413179219f},
-std::array<float,2>{0.655651689f, 0.0633644909f},
-std::array<float,2>{0.45920971f, 0.895090044f},
-std::array<float,2>{0.512040138f, 0.595220864f},
-std::array<float,2>{0.262274653f, 0.341047138f},
-std::array<float,2>{0.942578256f, 0.152100727f},
-std::array<float,2>{0.0647504106f, 0.767081916f},
-std::array<float,2>{0.775218368f, 0.956668496f},
-std::array<float,2>{0.137168035f, 0.0277183075f},
-std::array<float,2>{0.738634467f, 0.447245032f},
-std::array<float,2>{0.386759222f, 0.641127229f},
-std::array<float,2>{0.642717361f, 0.860599339f},
-std::array<float,2>{0.4615044f, 0.231803462f},
-std::array<float,2>{0.855502009f, 0.272141069f},
-std::array<float,2>{0.2179517f, 0.507662535f},
-std::array<float,2>{0.894738972f, 0.729354799f},
-std::array<float,2>{0.0514127091f, 0.392844081f},
-std::array<float,2>{0.566653848f, 0.10011822f},
-std::array<float,2>{0.317600667f, 0.921503305f},
-std::array<float,2>{0.69236058f, 0.661811769f},
-std::array<float,2>{0.429712683f, 0.474823117f},
-std::array<float,2>{0.781614065f, 0.0459000506f},
-std::array<float,2>{0.169658139f, 0.974343061f},
-std::array<float,2>{0.988022506f, 0.790599644f},
-std::array<float,2>{0.103127845f, 0.172264993f},
-std::array<float,2>{0.551528811f, 0.350425422f},
-std::array<float,2>{0.288383037f, 0.563777924f},
-std::array<float,2>{0.616557717f, 0.903123021f},
-std::array<float,2>{0.351461351f, 0.0742665157f},
-std::array<float,2>{0.906804264f, 0.421723515f},
-std::array<float,2>{0.0156447086f, 0.70367384f},
-std::array<float,2>{0.830560803f, 0.532155752f},
-std::array<float,2>{0.241653636f, 0.286812544f},
-std::array<float,2>{0.68463701f, 0.210018381f},
-std::array<float,2>{0.492756605f, 0.815546811f},
-std::array<float,2>{0.584839344f, 0.696302116f},
-std::array<float,2>{0.341812432f, 0.436841905f},
-std::array<float,2>{0.88499558f, 0.0847048834f},
-std::array<float,2>{0.0356062576f, 0.881097913f},
-std::array<float,2>{0.864124537f, 0.830666363f},
-std::array<float,2>{0.199426427f, 0.192272797f},
-std::array<float,2>{0.636808634f, 0.302981645f},
-std::array<float,2>{0.44235158f, 0.561695576f},
-std::array<float,2>{0.72502768f, 0.99917388f},
-std::array<float,2>{0.392218918f, 0.0506701581f},
-std::array<float,2>{0.762508154f, 0.489412993f},
-std::array<float,2>{0.143901646f, 0.685724139f},
-std::array<float,2>{0.954692543f, 0.591309547f},
-std::array<float,2>{0.0867839381f, 0.374353796f},
-std::array<float,2>{0.525999188f, 0.165453345f},
-std::array<float,2>{0.268894076f, 0.808399796f},
-std::array<float,2>{0.65837276f, 0.522967994f},
-std::array<float,2>{0.469412565f, 0.25248763f},
-std::array<float,2>{0.816863239f, 0.236669987f},
-std::array<float,2>{0.223337457f, 0.84625113f},
-std::array<float,2>{0.934511662f, 0.933353841f},
-std::array<float,2>{0.0057490319f, 0.112629056f},
-std::array<float,2>{0.60831219f, 0.388739854f},
-std::array<float,2>{0.371126145f, 0.740472436f},
-std::array<float,2>{0.544937909f, 0.755901158f},
-std::array<float,2>{0.298524797f, 0.139385104f},
-std::array<float,2>{0.969717264f, 0.327185541f},
-std::array<float,2>{0.113462366f, 0.623279631f},
-std::array<float,2>{0.811205268f, 0.625002205f},
-std::array<float,2>{0.182842806f, 0.45974192f},
-std::array<float,2>{0.706613719f, 0.0101428051f},
-std::array<float,2>{0.42026633f, 0.938837886f},
-std::array<float,2>{0.531773031f, 0.500387847f},
-std::array<float,2>{0.306863755f, 0.266325563f},
-std::array<float,2>{0.976884842f, 0.227378324f},
-std::array<float,2>{0.12043158f, 0.865096509f},
-std::array<float,2>{0.798662603f, 0.915378988f},
-std::array<float,2>{0.173124239f, 0.095252268f},
-std::array<float,2>{0.715751231f, 0.394824922f},
-std::array<float,2>{0.407461882f, 0.731433272f},
-std::array<float,2>{0.666503131f, 0.771641612f},
-std::array<float,2>{0.479996085f, 0.154248044f},
-std::array<float,2>{0.82172972f, 0.337478876f},
-std::array<float,2>{0.23309499f, 0.598228037f},
-std::array<float,2>{0.924608469f, 0.64791894f},
-std::array<float,2>{0.0128663937f, 0.451751202f},
-std::array<float,2>{0.595139623f, 0.0258468091f},
-std::array<float,2>{0.360993594f, 0.958759546f},
-std::array<float,2>{0.72900176f, 0.707628369f},
-std::array<float,2>{0.401996166f, 0.41447565f},
-std::array<float,2>{0.755102336f, 0.0732934549f},
-std::array<float,2>{0.14909026f, 0.900318742f},
-std::array<float,2>{0.965318322f, 0.818129063f},
-std::array<float,2>{0.081605196f, 0.203464359f},
-std::array<float,2>{0.522303641f, 0.28430903f},
-std::array<float,2>{0.276949674f, 0.535945117f},
-std::array<float,2>{0.587545037f, 0.970868051f},
-std::array<float,2>{0.331971884f, 0.0423969552f},
-std::array<float,2>{0.879802704f, 0.46995616f},
-std::array<float,2>{0.0399110243f, 0.65810889f},
-std::array<float,2>{0.874919891f, 0.568919778f},
-std::array<float,2>{0.190342173f, 0.346751183f},
-std::array<float,2>{0.628677905f, 0.178775907f},
-std::array<float,2>{0.445362002f, 0.793341279f},
-std::array<float,2>{0.617533684f, 0.679721475f},
-std::array<float,2>{0.359320074f, 0.485074997f},
-std::array<float,2>{0.920385301f, 0.0530667268f},
-std::array<float,2>{0.0297285654f, 0.994909346f},
-std::array<float,2>{0.839639068f, 0.810683608f},
-std::array<float,2>{0.245023787f, 0.168256208f},
-std::array<float,2>{0.672720969f, 0.367376953f},
-std::array<float,2>{0.48753649f, 0.587429821f},
-std::array<float,2>{0.702968121f, 0.877757549f},
-std::array<float,2>{0.429038703f, 0.0806344151f},
-std::array<float,2>{0.794329226f, 0.431131661f},
-std::array<float,2>{0.159041852f, 0.702928424f},
-std::array<float,2>{0.993637919f, 0.55501765f},
-std::array<float,2>{0.0939834416f, 0.297352582f},
-std::array<float,2>{0.558621705f, 0.191145211f},
-std::array<float,2>{0.294865608f, 0.832524002f},
-std::array<float,2>{0.651046574f, 0.619694591f},
-std::array<float,2>{0.45485577f, 0.320383549f},
-std::array<float,2>{0.849550724f, 0.133586541f},
-std::array<float,2>{0.203321472f, 0.75205934f},
-std::array<float,2>{0.900094628f, 0.942701876f},
-std::array<float,2>{0.0574421324f, 0.0127239097f},
-std::array<float,2>{0.572044075f, 0.453793734f},
-std::array<float,2>{0.321199954f, 0.629686058f},
-std::array<float,2>{0.502818704f, 0.847688854f},
-std::array<float,2>{0.257613778f, 0.241902649f},
-std::array<float,2>{0.950435638f, 0.25393036f},
-std::array<float,2>{0.0746348277f, 0.518682539f},
-std::array<float,2>{0.769051373f, 0.736298144f},
-std::array<float,2>{0.129115403f, 0.383446693f},
-std::array<float,2>{0.745611668f, 0.113927908f},
-std::array<float,2>{0.375439733f, 0.934519231f},
-std::array<float,2>{0.562957585f, 0.585218787f},
-std::array<float,2>{0.313145339f, 0.363766044f},
-std::array<float,2>{0.892243624f, 0.163322523f},
-std::array<float,2>{0.0497508124f, 0.79729408f},
-std::array<float,2>{0.852043688f, 0.990083396f},
-std::array<float,2>{0.213628605f, 0.0624567904f},
-std::array<float,2>{0.646957755f, 0.494044572f},
-std::array<float,2>{0.466983974f, 0.673948288f},
-std::array<float,2>{0.736114502f, 0.839810789f},
-std::array<float,2>{0.38565889f, 0.199986801f},
-std::array<float,2>{0.778601885f, 0.307212591f},
-std::array<float,2>{0.134736314f, 0.547819793f},
-std::array<float,2>{0.939686894f, 0.69296664f},
-std::array<float,2>{0.0672821999f, 0.423927933f},
-std::array<float,2>{0.508567154f, 0.0909543931f},
-std::array<float,2>{0.259097874f, 0.888751566f},
-std::array<float,2>{0.682396352f, 0.633732677f},
-std::array<float,2>{0.497464716f, 0.465320617f},
-std::array<float,2>{0.83262223f, 0.00167374779f},
-std::array<float,2>{0.236426577f, 0.946537554f},
-std::array<float,2>{0.912368476f, 0.760059774f},
-std::array<float,2>{0.0207390822f, 0.132010445f},
-std::array<float,2>{0.611001492f, 0.313038886f},
-std::array<float,2>{0.344853222f, 0.61035651f},
-std::array<float,2>{0.547577381f, 0.92499125f},
-std::array<float,2>{0.284549981f, 0.124979295f},
-std::array<float,2>{0.989812315f, 0.378047138f},
-std::array<float,2>{0.10637074f, 0.747127056f},
-std::array<float,2>{0.786167741f, 0.529430628f},
-std::array<float,2>{0.166405082f, 0.258856654f},
-std::array<float,2>{0.689313173f, 0.243342057f},
-std::array<float,2>{0.436490148f, 0.85667491f},
-std::array<float,2>{0.529756248f, 0.726345897f},
-std::array<float,2>{0.272552699f, 0.402517259f},
-std::array<float,2>{0.960052788f, 0.104379095f},
-std::array<float,2>{0.091297619f, 0.910697877f},
-std::array<float,2>{0.761021435f, 0.873500586f},
-std::array<float,2>{0.145901173f, 0.226167962f},
-std::array<float,2>{0.720486104f, 0.279512048f},
-std::array<float,2>{0.397532731f, 0.509861171f},
-std::array<float,2>{0.633421481f, 0.964934886f},
-std::array<float,2>{0.440462053f, 0.0230433289f},
-std::array<float,2>{0.860222042f, 0.441974819f},
-std::array<float,2>{0.196071967f, 0.650748372f},
-std::array<float,2>{0.889350474f, 0.601822734f},
-std::array<float,2>{0.032496646f, 0.330823332f},
-std::array<float,2>{0.58112818f, 0.146688536f},
-std::array<float,2>{0.338453621f, 0.774116457f},
-std::array<float,2>{0.708897352f, 0.544795156f},
-std::array<float,2>{0.415011913f, 0.294339895f},
-std::array<float,2>{0.806709766f, 0.214929983f},
-std::array<float,2>{0.185151175f, 0.823807359f},
-std::array<float,2>{0.973471344f, 0.891089559f},
-std::array<float,2>{0.110528894f, 0.0679935068f},
-std::array<float,2>{0.54067266f, 0.409472108f},
-std::array<float,2>{0.302479357f, 0.712830007f},
-std::array<float,2>{0.605236232f, 0.786459625f},
-std::array<float,2>{0.370166332f, 0.180404186f},
-std::array<float,2>{0.931691945f, 0.355418593f},
-std::array<float,2>{0.00321815861f, 0.576857388f},
-std::array<float,2>{0.813051641f, 0.667626023f},
-std::array<float,2>{0.221814424f, 0.479804009f},
-std::array<float,2>{0.661726892f, 0.0386346057f},
-std::array<float,2>{0.475046217f, 0.981826663f},
-std::array<float,2>{0.593293309f, 0.527037442f},
-std::array<float,2>{0.332236886f, 0.265401155f},
-std::array<float,2>{0.876989782f, 0.246651515f},
-std::array<float,2>{0.0454859994f, 0.853541613f},
-std::array<float,2>{0.868990302f, 0.926514328f},
-std::array<float,2>{0.195178166f, 0.120401144f},
-std::array<float,2>{0.628961205f, 0.3807199f},
-std::array<float,2>{0.451423556f, 0.743867457f},
-std::array<float,2>{0.73143363f, 0.762285233f},
-std::array<float,2>{0.406147659f, 0.127742931f},
-std::array<float,2>{0.753383756f, 0.318283379f},
-std::array<float,2>{0.155949384f, 0.615876198f},
-std::array<float,2>{0.961575449f, 0.637908518f},
-std::array<float,2>{0.0844328478f, 0.463985234f},
-std::array<float,2>{0.518764675f, 0.00508344267f},
-std::array<float,2>{0.277484268f, 0.949942052f},
-std::array<float,2>{0.668204665f, 0.68868345f},
-std::array<float,2>{0.481392086f, 0.426140636f},
-std::array<float,2>{0.824344039f, 0.0861419141f},
-std::array<float,2>{0.229822129f, 0.88331002f},
-std::array<float,2>{0.926882625f, 0.841963649f},
-std::array<float,2>{0.00806889031f, 0.197912812f},
-std::array<float,2>{0.59838289f, 0.309268117f},
-std::array<float,2>{0.366985232f, 0.553983569f},
-std::array<float,2>{0.536503255f, 0.987507343f},
-std::array<float,2>{0.309424937f, 0.0580085628f},
-std::array<float,2>{0.982674837f, 0.49785459f},
-std::array<float,2>{0.123682112f, 0.675919592f},
-std::array<float,2>{0.80225724f, 0.581389725f},
-std::array<float,2>{0.177006438f, 0.360230803f},
-std::array<float,2>{0.714296699f, 0.158811674f},
-std::array<float,2>{0.4110668f, 0.803385913f},
-std::array<float,2>{0.505200624f, 0.668199658f},
-std::array<float,2>{0.253468424f, 0.484165847f},
-std::array<float,2>{0.947630048f, 0.0323878601f},
-std::array<float,2>{0.0738224983f, 0.977157414f},
-std::array<float,2>{0.770857096f, 0.781873286f},
-std::array<float,2>{0.126703709f, 0.18385689f},
-std::array<float,2>{0.748448193f, 0.357298285f},
-std::array<float,2>{0.37926656f, 0.570937335f},
-std::array<float,2>{0.652965009f, 0.898325324f},
-std::array<float,2>{0.458777815f, 0.0657393634f},
-std::array<float,2>{0.843909085f, 0.410700947f},
-std::array<float,2>{0.208192691f, 0.715561152f},
-std::array<float,2>{0.905441284f, 0.541921794f},
-std::array<float,2>{0.0615532696f, 0.289705545f},
-std::array<float,2>{0.577839911f, 0.21366477f},
-std::array<float,2>{0.324327528f, 0.827162802f},
-std::array<float,2>{0.69552511f, 0.605943203f},
-std::array<float,2>{0.424165279f, 0.332220435f},
-std::array<float,2>{0.789212763f, 0.143370256f},
-std::array<float,2>{0.162203595f, 0.777895927f},
-std::array<float,2>{0.997247517f, 0.961233675f},
-std::array<float,2>{0.10009148f, 0.0165061634f},
-std::array<float,2>{0.555126071f, 0.440565675f},
-std::array<float,2>{0.292419523f, 0.653408289f},
-std::array<float,2>{0.624408364f, 0.869302869f},
-std::array<float,2>{0.355191052f, 0.220227614f},
-std::array<float,2>{0.915891945f, 0.274323374f},
-std::array<float,2>{0.0256031435f, 0.514963806f},
-std::array<float,2>{0.840093076f, 0.72191608f},
-std::array<float,2>{0.249049529f, 0.400824815f},
-std::array<float,2>{0.678138196f, 0.106766738f},
-std::array<float,2>{0.490055174f, 0.906266451f},
-std::array<float,2>{0.552795172f, 0.565627456f},
-std::array<float,2>{0.285277635f, 0.348767102f},
-std::array<float,2>{0.985616922f, 0.174170732f},
-std::array<float,2>{0.104629599f, 0.792776763f},
-std::array<float,2>{0.783837557f, 0.976494193f},
-std::array<float,2>{0.170097008f, 0.0435611121f},
-std::array<float,2>{0.69403249f, 0.473309278f},
-std::array<float,2>{0.432529449f, 0.66385895f},
-std::array<float,2>{0.685619235f, 0.813560188f},
-std::array<float,2>{0.495591998f, 0.208311215f},
-std::array<float,2>{0.828537047f, 0.287388146f},
-std::array<float,2>{0.239551201f, 0.534807026f},
-std::array<float,2>{0.908369303f, 0.706248045f},
-std::array<float,2>{0.0192541312f, 0.418387473f},
-std::array<float,2>{0.614437044f, 0.0767955408f},
-std::array<float,2>{0.348536164f, 0.904449165f},
-std::array<float,2>{0.740832329f, 0.642696798f},
-std::array<float,2>{0.389194727f, 0.448529094f},
-std::array<float,2>{0.775922775f, 0.0293835439f},
-std::array<float,2>{0.139082894f, 0.95394963f},
-std::array<float,2>{0.94500649f, 0.767763555f},
-std::array<float,2>{0.0643721074f, 0.148973837f},
-std::array<float,2>{0.514909029f, 0.342893124f},
-std::array<float,2>{0.263924032f, 0.597408652f},
-std::array<float,2>{0.569264352f, 0.918800473f},
-std::array<float,2>{0.318665862f, 0.0983491242f},
-std::array<float,2>{0.898381531f, 0.390865356f},
-std::array<float,2>{0.0531709194f, 0.726777852f},
-std::array<float,2>{0.857553601f, 0.504048586f},
-std::array<float,2>{0.216210932f, 0.270944983f},
-std::array<float,2>{0.641625464f, 0.23326838f},
-std::array<float,2>{0.463634074f, 0.861383855f},
-std::array<float,2>{0.606442273f, 0.738656104f},
-std::array<float,2>{0.373864919f, 0.3868258f},
-std::array<float,2>{0.937095404f, 0.110840283f},
-std::array<float,2>{0.00592653966f, 0.930953205f},
-std::array<float,2>{0.820065975f, 0.845157504f},
-std::array<float,2>{0.22564505f, 0.235201254f},
-std::array<float,2>{0.657581389f, 0.251342058f},
-std::array<float,2>{0.470937759f, 0.520168185f},
-std::array<float,2>{0.704648256f, 0.940890074f},
-std::array<float,2>{0.418877661f, 0.00928235427f},
-std::array<float,2>{0.810240269f, 0.458869249f},
-std::array<float,2>{0.181612983f, 0.627756f},
-std::array<float,2>{0.971784115f, 0.62252152f},
-std::array<float,2>{0.115926206f, 0.325182676f},
-std::array<float,2>{0.54323566f, 0.138131306f},
-std::array<float,2>{0.300269663f, 0.754552901f},
-std::array<float,2>{0.63984549f, 0.559506536f},
-std::array<float,2>{0.444373697f, 0.302316159f},
-std::array<float,2>{0.867062032f, 0.194325447f},
-std::array<float,2>{0.201550335f, 0.82892853f},
-std::array<float,2>{0.884291112f, 0.880548775f},
-std::array<float,2>{0.0381146707f, 0.0824937746f},
-std::array<float,2>{0.583161056f, 0.435171753f},
-std::array<float,2>{0.340111911f, 0.697891355f},
-std::array<float,2>{0.523630381f, 0.804944754f},
-std::array<float,2>{0.266718656f, 0.167835429f},
-std::array<float,2>{0.956412077f, 0.371127665f},
-std::array<float,2>{0.089082092f, 0.59201324f},
-std::array<float,2>{0.7647627f, 0.6837762f},
-std::array<float,2>{0.141549289f, 0.490383863f},
-std::array<float,2>{0.723048568f, 0.0480897501f},
-std::array<float,2>{0.392719567f, 0.997516334f},
-std::array<float,2>{0.520058274f, 0.538664222f},
-std::array<float,2>{0.274884045f, 0.281545967f},
-std::array<float,2>{0.968736351f, 0.205642417f},
-std::array<float,2>{0.0781776756f, 0.819915056f},
-std::array<float,2>{0.757326961f, 0.900867283f},
-std::array<float,2>{0.151683643f, 0.0716459602f},
-std::array<float,2>{0.728355408f, 0.417766511f},
-std::array<float,2>{0.399270982f, 0.71080792f},
-std::array<float,2>{0.625576675f, 0.796568871f},
-std::array<float,2>{0.447792321f, 0.177459776f},
-std::array<float,2>{0.871788383f, 0.344173104f},
-std::array<float,2>{0.188025802f, 0.567616284f},
-std::array<float,2>{0.881764114f, 0.658564806f},
-std::array<float,2>{0.0422382057f, 0.470955074f},
-std::array<float,2>{0.589223683f, 0.0408560224f},
-std::array<float,2>{0.328906894f, 0.970589757f},
-std::array<float,2>{0.717705071f, 0.732587337f},
-std::array<float,2>{0.408572823f, 0.398276359f},
-std::array<float,2>{0.800298691f, 0.0974338949f},
-std::array<float,2>{0.174202904f, 0.91741389f},
-std::array<float,2>{0.978527009f, 0.866785049f},
-std::array<float,2>{0.118410654f, 0.2292476f},
-std::array<float,2>{0.534127116f, 0.26804015f},
-std::array<float,2>{0.30517295f, 0.502245426f},
-std::array<float,2>{0.596194923f, 0.960494161f},
-std::array<float,2>{0.361717701f, 0.0246047489f},
-std::array<float,2>{0.922052801f, 0.451029301f},
-std::array<float,2>{0.0137311919f, 0.646254361f},
-std::array<float,2>{0.822390914f, 0.601426899f},
-std::array<float,2>{0.232141137f, 0.338530481f},
-std::array<float,2>{0.664615333f, 0.155732304f},
-std::array<float,2>{0.477416128f, 0.770330846f},
-std::array<float,2>{0.574155271f, 0.632517338f},
-std::array<float,2>{0.324026644f, 0.455289692f},
-std::array<float,2>{0.901900291f, 0.0146928513f},
-std::array<float,2>{0.0554056838f, 0.945020437f},
-std::array<float,2>{0.850755811f, 0.751829922f},
-std::array<float,2>{0.206683367f, 0.135718688f},
-std::array<float,2>{0.649330616f, 0.323841065f},
-std::array<float,2>{0.455326647f, 0.618771613f},
-std::array<float,2>{0.742711663f, 0.936213136f},
-std::array<float,2>{0.377488852f, 0.11552503f},
-std::array<float,2>{0.766833842f, 0.386018634f},
-std::array<float,2>{0.131002858f, 0.738129139f},
-std::array<float,2>{0.95270592f, 0.516049743f},
-std::array<float,2>{0.0771644935f, 0.25753668f},
-std::array<float,2>{0.500554204f, 0.239561483f},
-std::array<float,2>{0.254252374f, 0.851454794f},
-std::array<float,2>{0.674095988f, 0.58824873f},
-std::array<float,2>{0.486024559f, 0.370272964f},
-std::array<float,2>{0.837462723f, 0.170473382f},
-std::array<float,2>{0.244107276f, 0.809276223f},
-std::array<float,2>{0.919421852f, 0.993640065f},
-std::array<float,2>{0.0288446639f, 0.0511951186f},
-std::array<float,2>{0.620966792f, 0.487957001f},
-std::array<float,2>{0.356114537f, 0.681895733f},
-std::array<float,2>{0.561156332f, 0.835539162f},
-std::array<float,2>{0.295161009f, 0.189074889f},
-std::array<float,2>{0.9946872f, 0.300700337f},
-std::array<float,2>{0.0974895507f, 0.556792974f},
-std::array<float,2>{0.796565473f, 0.701123118f},
-std::array<float,2>{0.156814203f, 0.432838678f},
-std::array<float,2>{0.699974358f, 0.0788694546f},
-std::array<float,2>{0.426901609f, 0.875178277f},
-std::array<float,2>{0.611907005f, 0.612521172f},
-std::array<float,2>{0.347337782f, 0.315602273f},
-std::array<float,2>{0.911191285f, 0.130011261f},
-std::array<float,2>{0.0222660769f, 0.758260727f},
-std::array<float,2>{0.834108591f, 0.948710918f},
-std::array<float,2>{0.234821439f, 0.00280527351f},
-std::array<float,2>{0.681503892f, 0.467444062f},
-std::array<float,2>{0.498396724f, 0.635399282f},
-std::array<float,2>{0.690647304f, 0.859036028f},
-std::array<float,2>{0.434758395f, 0.244628504f},
-std::array<float,2>{0.788524806f, 0.260910064f},
-std::array<float,2>{0.164896637f, 0.527484655f},
-std::array<float,2>{0.991732001f, 0.74884057f},
-std::array<float,2>{0.108673036f, 0.375008762f},
-std::array<float,2>{0.548904121f, 0.123036109f},
-std::array<float,2>{0.283172786f, 0.923782706f},
-std::array<float,2>{0.645522654f, 0.673036814f},
-std::array<float,2>{0.46489349f, 0.495850682f},
-std::array<float,2>{0.853666544f, 0.0594616644f},
-std::array<float,2>{0.212598339f, 0.99127996f},
-std::array<float,2>{0.893144429f, 0.79916966f},
-std::array<float,2>{0.0474217832f, 0.160716891f},
-std::array<float,2>{0.565488875f, 0.366525531f},
-std::array<float,2>{0.316187084f, 0.582191348f},
-std::array<float,2>{0.511248469f, 0.887557507f},
-std::array<float,2>{0.260590434f, 0.093565464f},
-std::array<float,2>{0.938446164f, 0.423716754f},
-std::array<float,2>{0.0696534067f, 0.694828093f},
-std::array<float,2>{0.780145109f, 0.549041867f},
-std::array<float,2>{0.135229245f, 0.304706872f},
-std::array<float,2>{0.736799479f, 0.202249706f},
-std::array<float,2>{0.384280294f, 0.836708665f},
-std::array<float,2>{0.541329384f, 0.71289289f},
-std::array<float,2>{0.303090781f, 0.406847626f},
-std::array<float,2>{0.97650075f, 0.0690583363f},
-std::array<float,2>{0.112495139f, 0.892958999f},
-std::array<float,2>{0.8061921f, 0.820939958f},
-std::array<float,2>{0.186687455f, 0.217429444f},
-std::array<float,2>{0.709365427f, 0.296035588f},
-std::array<float,2>{0.417863607f, 0.54645282f},
-std::array<float,2>{0.662144661f, 0.983915985f},
-std::array<float,2>{0.474192441f, 0.0355417058f},
-std::array<float,2>{0.815385818f, 0.478488594f},
-std::array<float,2>{0.220124632f, 0.665044069f},
-std::array<float,2>{0.931604862f, 0.575767756f},
-std::array<float,2>{0.00167700835f, 0.352004915f},
-std::array<float,2>{0.603264928f, 0.182240307f},
-std::array<float,2>{0.368839115f, 0.787942827f},
-std::array<float,2>{0.720869482f, 0.509038806f},
-std::array<float,2>{0.394757986f, 0.278309554f},
-std::array<float,2>{0.758099675f, 0.224364609f},
-std::array<float,2>{0.147718266f, 0.872380733f},
-std::array<float,2>{0.957427204f, 0.913349211f},
-std::array<float,2>{0.0935505554f, 0.101863451f},
-std::array<float,2>{0.528647065f, 0.406093359f},
-std::array<float,2>{0.269796759f, 0.724578917f},
-std::array<float,2>{0.579357445f, 0.776312232f},
-std::array<float,2>{0.33658278f, 0.145045757f},
-std::array<float,2>{0.887821019f, 0.329583526f},
-std::array<float,2>{0.0338799767f, 0.603715301f},
-std::array<float,2>{0.863049328f, 0.650239944f},
-std::array<float,2>{0.19896093f, 0.444117337f},
-std::array<float,2>{0.636003375f, 0.019926535f},
-std::array<float,2>{0.438979924f, 0.966802359f},
-std::array<float,2>{0.621865153f, 0.513860583f},
-std::array<float,2>{0.353125513f, 0.274713516f},
-std::array<float,2>{0.917345762f, 0.219474465f},
-std::array<float,2>{0.0253217723f, 0.870490789f},
-std::array<float,2>{0.842037082f, 0.907562733f},
-std::array<float,2>{0.246424422f, 0.106372625f},
-std::array<float,2>{0.676459193f, 0.401827633f},
-std::array<float,2>{0.490435511f, 0.720945358f},
-std::array<float,2>{0.698750913f, 0.779031396f},
-std::array<float,2>{0.422040731f, 0.143713146f},
-std::array<float,2>{0.791284144f, 0.33328405f},
-std::array<float,2>{0.160610035f, 0.606554866f},
-std::array<float,2>{0.998732328f, 0.652907252f},
-std::array<float,2>{0.0984837189f, 0.439963281f},
-std::array<float,2>{0.557489395f, 0.0167974308f},
-std::array<float,2>{0.289929509f, 0.962510586f},
-std::array<float,2>{0.654350102f, 0.715942144f},
-std::array<float,2>{0.460936129f, 0.411706567f},
-std::array<float,2>{0.847164452f, 0.0648015067f},
-std::array<float,2>{0.210463896f, 0.897403538f},
-std::array<float,2>{0.902689934f, 0.826896071f},
-std::array<float,2>{0.060503196f, 0.21450007f},
-std::array<float,2>{0.575946629f, 0.290133446f},
-std::array<float,2>{0.327768832f, 0.542827845f},
-std::array<float,2>{0.506972134f, 0.978501499f},
-std::array<float,2>{0.250971556f, 0.0316742659f},
-std::array<float,2>{0.945395947f, 0.482607514f},
-std::array<float,2>{0.071505338f, 0.669862509f},
-std::array<float,2>{0.773287892f, 0.571424246f},
-std::array<float,2>{0.127943322f, 0.356113255f},
-std::array<float,2>{0.747926295f, 0.184828281f},
-std::array<float,2>{0.380928427f, 0.782845736f},
-std::array<float,2>{0.53824085f, 0.677542567f},
-std::array<float,2>{0.31072852f, 0.49653554f},
-std::array<float,2>{0.981955707f, 0.0575266257f},
-std::array<float,2>{0.122145571f, 0.986781061f},
-std::array<float,2>{0.804461122f, 0.803994536f},
-std::array<float,2>{0.179468289f, 0.160070151f},
-std::array<float,2>{0.711914301f, 0.361245334f},
-std::array<float,2>{0.412529498f, 0.580113053f},
-std::array<float,2>{0.670762956f, 0.88412267f},
-std::array<float,2>{0.483624458f, 0.0869353265f},
-std::array<float,2>{0.826256931f, 0.427231133f},
-std::array<float,2>{0.226623848f, 0.688139379f},
-std::array<float,2>{0.927943647f, 0.5531829f},
-std::array<float,2>{0.0109621445f, 0.309924662f},
-std::array<float,2>{0.600350082f, 0.198290527f},
-std::array<float,2>{0.364651561f, 0.843567371f},
-std::array<float,2>{0.733028769f, 0.616535425f},
-std::array<float,2>{0.40247187f, 0.317080587f},
-std::array<float,2>{0.750273943f, 0.1286259f},
-std::array<float,2>{0.153705165f, 0.763322473f},
-std::array<float,2>{0.963174403f, 0.951027274f},
-std::array<float,2>{0.082611382f, 0.00397668127f},
-std::array<float,2>{0.516919792f, 0.463582247f},
-std::array<float,2>{0.280436039f, 0.636896491f},
-std::array<float,2>{0.591762185f, 0.854974389f},
-std::array<float,2>{0.335385501f, 0.247731239f},
-std::array<float,2>{0.876625061f, 0.26383549f},
-std::array<float,2>{0.0433935225f, 0.525543272f},
-std::array<float,2>{0.869695485f, 0.742863238f},
-std::array<float,2>{0.191531867f, 0.379699379f},
-std::array<float,2>{0.632564485f, 0.119685054f},
-std::array<float,2>{0.449266464f, 0.926954031f},
-std::array<float,2>{0.527082145f, 0.593744099f},
-std::array<float,2>{0.268055856f, 0.372865081f},
-std::array<float,2>{0.953432262f, 0.166571513f},
-std::array<float,2>{0.0876465738f, 0.805886328f},
-std::array<float,2>{0.76326257f, 0.996475041f},
-std::array<float,2>{0.143108681f, 0.0471484847f},
-std::array<float,2>{0.726550519f, 0.49151656f},
-std::array<float,2>{0.391139001f, 0.685421944f},
-std::array<float,2>{0.638522089f, 0.829908133f},
-std::array<float,2>{0.443002343f, 0.195308268f},
-std::array<float,2>{0.864665449f, 0.300823927f},
-std::array<float,2>{0.200904638f, 0.560245097f},
-std::array<float,2>{0.886658132f, 0.69920069f},
-std::array<float,2>{0.0361554213f, 0.433757097f},
-std::array<float,2>{0.585800529f, 0.08374881f},
-std::array<float,2>{0.343182355f, 0.878919721f},
-std::array<float,2>{0.705829501f, 0.628005981f},
-std::array<float,2>{0.421445549f, 0.457260847f},
-std::array<float,2>{0.81166327f, 0.00853122864f},
-std::array<float,2>{0.182194278f, 0.940117896f},
-std::array<float,2>{0.97029084f, 0.755286455f},
-std::array<float,2>{0.114881426f, 0.137639552f},
-std::array<float,2>{0.546467721f, 0.325928181f},
-std::array<float,2>{0.297184169f, 0.621529937f},
-std::array<float,2>{0.608635485f, 0.930527151f},
-std::array<float,2>{0.372595966f, 0.110206984f},
-std::array<float,2>{0.934657872f, 0.388627172f},
-std::array<float,2>{0.00462307269f, 0.739736497f},
-std::array<float,2>{0.817434251f, 0.5206725f},
-std::array<float,2>{0.224084169f, 0.250361025f},
-std::array<float,2>{0.65931505f, 0.235887066f},
-std::array<float,2>{0.470248163f, 0.844448805f},
-std::array<float,2>{0.567649961f, 0.727913618f},
-std::array<float,2>{0.317046523f, 0.392103344f},
-std::array<float,2>{0.896064043f, 0.099554643f},
-std::array<float,2>{0.0520376116f, 0.919516802f},
-std::array<float,2>{0.857168674f, 0.863188088f},
-std::array<float,2>{0.21723339f, 0.233441472f},
-std::array<float,2>{0.644152582f, 0.26954332f},
-std::array<float,2>{0.462187201f, 0.505425155f},
-std::array<float,2>{0.739849389f, 0.954240739f},
-std::array<float,2>{0.388254374f, 0.0305825025f},
-std::array<float,2>{0.773833632f, 0.447795868f},
-std::array<float,2>{0.138572261f, 0.644388258f},
-std::array<float,2>{0.941902876f, 0.596468925f},
-std::array<float,2>{0.0659504011f, 0.342621356f},
-std::array<float,2>{0.512823701f, 0.150054783f},
-std::array<float,2>{0.2634767f, 0.769190967f},
-std::array<float,2>{0.683703363f, 0.534021437f},
-std::array<float,2>{0.493631721f, 0.288558841f},
-std::array<float,2>{0.831366301f, 0.207834661f},
-std::array<float,2>{0.240279555f, 0.812800825f},
-std::array<float,2>{0.908080339f, 0.905616641f},
-std::array<float,2>{0.0169444848f, 0.0775060952f},
-std::array<float,2>{0.615966201f, 0.419238091f},
-std::array<float,2>{0.349948674f, 0.705462813f},
-std::array<float,2>{0.551913381f, 0.791925311f},
-std::array<float,2>{0.287839472f, 0.175087169f},
-std::array<float,2>{0.98685807f, 0.347773045f},
-std::array<float,2>{0.101843841f, 0.565034926f},
-std::array<float,2>{0.78227061f, 0.662883997f},
-std::array<float,2>{0.168090746f, 0.474429995f},
-std::array<float,2>{0.692432404f, 0.0447860733f},
-std::array<float,2>{0.431559414f, 0.975104868f},
-std::array<float,2>{0.559731901f, 0.558263838f},
-std::array<float,2>{0.29330048f, 0.299119502f},
-std::array<float,2>{0.992396891f, 0.187864363f},
-std::array<float,2>{0.0948814601f, 0.834499598f},
-std::array<float,2>{0.793373942f, 0.876463592f},
-std::array<float,2>{0.159691975f, 0.0799755082f},
-std::array<float,2>{0.701952755f, 0.431878418f},
-std::array<float,2>{0.427948922f, 0.699683964f},
-std::array<float,2>{0.672954321f, 0.810180604f},
-std::array<float,2>{0.486819625f, 0.171126291f},
-std::array<float,2>{0.838539362f, 0.369731337f},
-std::array<float,2>{0.245725989f, 0.589560509f},
-std::array<float,2>{0.921645522f, 0.682655036f},
-std::array<float,2>{0.0309071448f, 0.487042934f},
-std::array<float,2>{0.618805647f, 0.0524382964f},
-std::array<float,2>{0.358341277f, 0.992553413f},
-std::array<float,2>{0.745057166f, 0.736370385f},
-std::array<float,2>{0.376022875f, 0.385576248f},
-std::array<float,2>{0.768415749f, 0.116374128f},
-std::array<float,2>{0.130125165f, 0.937170804f},
-std::array<float,2>{0.950058222f, 0.850006461f},
-std::array<float,2>{0.0754872933f, 0.239023268f},
-std::array<float,2>{0.503405988f, 0.256726563f},
-std::array<float,2>{0.256093293f, 0.517334282f},
-std::array<float,2>{0.571112096f, 0.943451047f},
-std::array<float,2>{0.322158456f, 0.0142137529f},
-std::array<float,2>{0.898938537f, 0.456146657f},
-std::array<float,2>{0.0578909107f, 0.631577194f},
-std::array<float,2>{0.847849727f, 0.618099868f},
-std::array<float,2>{0.204922184f, 0.322490752f},
-std::array<float,2>{0.652117193f, 0.135975868f},
-std::array<float,2>{0.453720838f, 0.750104427f},
-std::array<float,2>{0.594371378f, 0.644592464f},
-std::array<float,2>{0.359972417f, 0.449875295f},
-std::array<float,2>{0.925250411f, 0.0237340741f},
-std::array<float,2>{0.012548822f, 0.95916003f},
-std::array<float,2>{0.820833981f, 0.771151185f},
-std::array<float,2>{0.233986422f, 0.154754654f},
-std::array<float,2>{0.667907596f, 0.339303464f},
-std::array<float,2>{0.479325294f, 0.600379765f},
-std::array<float,2>{0.716041267f, 0.916956186f},
-std::array<float,2>{0.407141715f, 0.0966721699f},
-std::array<float,2>{0.797759295f, 0.397151202f},
-std::array<float,2>{0.172433689f, 0.7335971f},
-std::array<float,2>{0.978434801f, 0.503651917f},
-std::array<float,2>{0.11927437f, 0.269375861f},
-std::array<float,2>{0.532571197f, 0.229755729f},
-std::array<float,2>{0.308058858f, 0.866173863f},
-std::array<float,2>{0.627761126f, 0.566881359f},
-std::array<float,2>{0.446306497f, 0.344931602f},
-std::array<float,2>{0.873478532f, 0.175791264f},
-std::array<float,2>{0.191082329f, 0.794995308f},
-std::array<float,2>{0.880735934f, 0.968894243f},
-std::array<float,2>{0.0404917188f, 0.0392491184f},
-std::array<float,2>{0.586519241f, 0.471702963f},
-std::array<float,2>{0.330340117f, 0.659596086f},
-std::array<float,2>{0.52249974f, 0.818535149f},
-std::array<float,2>{0.275563926f, 0.206384614f},
-std::array<float,2>{0.966724217f, 0.282810211f},
-std::array<float,2>{0.0800983906f, 0.537164927f},
-std::array<float,2>{0.7542274f, 0.709184408f},
-std::array<float,2>{0.149753347f, 0.416689664f},
-std::array<float,2>{0.729873061f, 0.0709291771f},
-std::array<float,2>{0.400633603f, 0.902168453f},
-std::array<float,2>{0.580396473f, 0.604682207f},
-std::array<float,2>{0.339173079f, 0.328504533f},
-std::array<float,2>{0.889653683f, 0.145664483f},
-std::array<float,2>{0.0322174728f, 0.777315021f},
-std::array<float,2>{0.860450923f, 0.967847049f},
-std::array<float,2>{0.197240621f, 0.0206563976f},
-std::array<float,2>{0.634164214f, 0.444420218f},
-std::array<float,2>{0.44005686f, 0.648575187f},
-std::array<float,2>{0.71943599f, 0.87149471f},
-std::array<float,2>{0.397121906f, 0.223490596f},
-std::array<float,2>{0.760049343f, 0.278358757f},
-std::array<float,2>{0.144590437f, 0.508429587f},
-std::array<float,2>{0.959606767f, 0.723216593f},
-std::array<float,2>{0.0898448005f, 0.40489763f},
-std::array<float,2>{0.530723393f, 0.10327623f},
-std::array<float,2>{0.271808058f, 0.912219107f},
-std::array<float,2>{0.660502613f, 0.664303601f},
-std::array<float,2>{0.475826144f, 0.47665751f},
-std::array<float,2>{0.813831925f, 0.0361951925f},
-std::array<float,2>{0.221136123f, 0.983153045f},
-std::array<float,2>{0.93287015f, 0.788911045f},
-std::array<float,2>{0.00216847518f, 0.182905659f},
-std::array<float,2>{0.603694081f, 0.352954924f},
-std::array<float,2>{0.36919865f, 0.574695826f},
-std::array<float,2>{0.539085627f, 0.893715918f},
-std::array<float,2>{0.301553845f, 0.0700967386f},
-std::array<float,2>{0.974022686f, 0.408068806f},
-std::array<float,2>{0.110336892f, 0.714790165f},
-std::array<float,2>{0.808229327f, 0.545847833f},
-std::array<float,2>{0.183969364f, 0.294998109f},
-std::array<float,2>{0.707440972f, 0.218258023f},
-std::array<float,2>{0.415186137f, 0.821789443f},
-std::array<float,2>{0.509736896f, 0.693599403f},
-std::array<float,2>{0.258004338f, 0.422124982f},
-std::array<float,2>{0.940504551f, 0.0925878584f},
-std::array<float,2>{0.0683497488f, 0.888016939f},
-std::array<float,2>{0.777397454f, 0.837697983f},
-std::array<float,2>{0.133667812f, 0.201378331f},
-std::array<float,2>{0.735045969f, 0.306232601f},
-std::array<float,2>{0.385994405f, 0.550470412f},
-std::array<float,2>{0.647677004f, 0.990421772f},
-std::array<float,2>{0.468243629f, 0.0604354329f},
-std::array<float,2>{0.852879405f, 0.494639903f},
-std::array<float,2>{0.213932216f, 0.672443926f},
-std::array<float,2>{0.891415596f, 0.583074093f},
-std::array<float,2>{0.049836114f, 0.365614921f},
-std::array<float,2>{0.564000428f, 0.161185861f},
-std::array<float,2>{0.314036876f, 0.799889028f},
-std::array<float,2>{0.688260615f, 0.528789878f},
-std::array<float,2>{0.43677631f, 0.260317087f},
-std::array<float,2>{0.78562206f, 0.245762601f},
-std::array<float,2>{0.16766566f, 0.857801378f},
-std::array<float,2>{0.988985002f, 0.922792912f},
-std::array<float,2>{0.107137553f, 0.121353991f},
-std::array<float,2>{0.548429668f, 0.376363993f},
-std::array<float,2>{0.28325218f, 0.749707222f},
-std::array<float,2>{0.610273302f, 0.759268224f},
-std::array<float,2>{0.344698399f, 0.129548997f},
-std::array<float,2>{0.913165271f, 0.314588249f},
-std::array<float,2>{0.0202279817f, 0.611814439f},
-std::array<float,2>{0.833505034f, 0.636618853f},
-std::array<float,2>{0.237474993f, 0.46802637f},
-std::array<float,2>{0.683494508f, 0.00300879031f},
-std::array<float,2>{0.496296763f, 0.947994411f},
-std::array<float,2>{0.576318204f, 0.540155172f},
-std::array<float,2>{0.325197369f, 0.291636527f},
-std::array<float,2>{0.904886484f, 0.2121346f},
-std::array<float,2>{0.0607151538f, 0.826089859f},
-std::array<float,2>{0.845514774f, 0.895515144f},
-std::array<float,2>{0.20770666f, 0.0644142106f},
-std::array<float,2>{0.653698802f, 0.412771523f},
-std::array<float,2>{0.457079947f, 0.717477798f},
-std::array<float,2>{0.749839246f, 0.783601284f},
-std::array<float,2>{0.380155444f, 0.185896531f},
-std::array<float,2>{0.770181596f, 0.357520074f},
-std::array<float,2>{0.125949472f, 0.572374642f},
-std::array<float,2>{0.948534131f, 0.671702445f},
-std::array<float,2>{0.0732407123f, 0.481967121f},
-std::array<float,2>{0.504464805f, 0.0342243873f},
-std::array<float,2>{0.252900183f, 0.979155719f},
-std::array<float,2>{0.678836763f, 0.719229758f},
-std::array<float,2>{0.488898635f, 0.399202794f},
-std::array<float,2>{0.841037989f, 0.107988223f},
-std::array<float,2>{0.248333886f, 0.909615636f},
-std::array<float,2>{0.915012181f, 0.868048847f},
-std::array<float,2>{0.0272666514f, 0.222615138f},
-std::array<float,2>{0.623503685f, 0.276052356f},
-std::array<float,2>{0.353755713f, 0.512284815f},
-std::array<float,2>{0.556602538f, 0.964838624f},
-std::array<float,2>{0.291794062f, 0.0184698738f},
-std::array<float,2>{0.996678829f, 0.437827677f},
-std::array<float,2>{0.100997597f, 0.654434323f},
-std::array<float,2>{0.790058911f, 0.608423769f},
-std::array<float,2>{0.163788572f, 0.33471936f},
-std::array<float,2>{0.696686447f, 0.141154751f},
-std::array<float,2>{0.425759614f, 0.77956754f},
-std::array<float,2>{0.517667174f, 0.639044046f},
-std::array<float,2>{0.278939366f, 0.461467981f},
-std::array<float,2>{0.962132752f, 0.00618692674f},
-std::array<float,2>{0.0858426616f, 0.9517048f},
-std::array<float,2>{0.752326548f, 0.763841152f},
-std::array<float,2>{0.154693708f, 0.125065818f},
-std::array<float,2>{0.732321978f, 0.319233239f},
-std::array<float,2>{0.405116826f, 0.614774942f},
-std::array<float,2>{0.630056143f, 0.92792964f},
-std::array<float,2>{0.452399611f, 0.11797522f},
-std::array<float,2>{0.867592931f, 0.380950004f},
-std::array<float,2>{0.193599239f, 0.745327175f},
-std::array<float,2>{0.878064573f, 0.524199128f},
-std::array<float,2>{0.046563942f, 0.263026655f},
-std::array<float,2>{0.592511117f, 0.248121366f},
-std::array<float,2>{0.333978921f, 0.853480279f},
-std::array<float,2>{0.713520885f, 0.579125524f},
-std::array<float,2>{0.411636055f, 0.363089025f},
-std::array<float,2>{0.801440895f, 0.15700157f},
-std::array<float,2>{0.176257819f, 0.802234471f},
-std::array<float,2>{0.983701825f, 0.985864699f},
-std::array<float,2>{0.124829546f, 0.0554398298f},
-std::array<float,2>{0.535374939f, 0.498949051f},
-std::array<float,2>{0.309798479f, 0.679508388f},
-std::array<float,2>{0.599474311f, 0.84025532f},
-std::array<float,2>{0.365453541f, 0.19609046f},
-std::array<float,2>{0.926591337f, 0.310741156f},
-std::array<float,2>{0.00961838011f, 0.550993621f},
-std::array<float,2>{0.825670719f, 0.690367877f},
-std::array<float,2>{0.228988439f, 0.428795248f},
-std::array<float,2>{0.669249177f, 0.0887913331f},
-std::array<float,2>{0.48167184f, 0.886499107f},
-std::array<float,2>{0.544873953f, 0.624235153f},
-std::array<float,2>{0.29952985f, 0.32707575f},
-std::array<float,2>{0.971068323f, 0.140247539f},
-std::array<float,2>{0.117143616f, 0.757158995f},
-std::array<float,2>{0.808732212f, 0.937722683f},
-std::array<float,2>{0.180025712f, 0.0108571956f},
-std::array<float,2>{0.703550816f, 0.460012436f},
-std::array<float,2>{0.419384062f, 0.62663728f},
-std::array<float,2>{0.656801105f, 0.846754134f},
-std::array<float,2>{0.472632587f, 0.237670153f},
-std::array<float,2>{0.81907177f, 0.253277868f},
-std::array<float,2>{0.2255577f, 0.521601975f},
-std::array<float,2>{0.936220884f, 0.741834283f},
-std::array<float,2>{0.00751823746f, 0.389734864f},
-std::array<float,2>{0.606903434f, 0.111763075f},
-std::array<float,2>{0.374306113f, 0.932516038f},
-std::array<float,2>{0.723945081f, 0.686645091f},
-std::array<float,2>{0.394110441f, 0.488811672f},
-std::array<float,2>{0.764322042f, 0.0491539463f},
-std::array<float,2>{0.141606152f, 0.998301685f},
-std::array<float,2>{0.955749691f, 0.806726098f},
-std::array<float,2>{0.0884191394f, 0.164132789f},
-std::array<float,2>{0.524742067f, 0.373802304f},
-std::array<float,2>{0.266061783f, 0.590796471f},
-std::array<float,2>{0.582841456f, 0.882428229f},
-std::array<float,2>{0.340945363f, 0.0857746974f},
-std::array<float,2>{0.883380473f, 0.435678482f},
-std::array<float,2>{0.0373999961f, 0.696059585f},
-std::array<float,2>{0.865670264f, 0.561163008f},
-std::array<float,2>{0.20224297f, 0.303887099f},
-std::array<float,2>{0.639363766f, 0.193311661f},
-std::array<float,2>{0.443689138f, 0.831669986f},
-std::array<float,2>{0.613902092f, 0.704298675f},
-std::array<float,2>{0.349278241f, 0.420670748f},
-std::array<float,2>{0.909359992f, 0.0759829953f},
-std::array<float,2>{0.0182420593f, 0.903528512f},
-std::array<float,2>{0.829821527f, 0.814527452f},
-std::array<float,2>{0.238422662f, 0.209912956f},
-std::array<float,2>{0.687293589f, 0.286057264f},
-std::array<float,2>{0.494402885f, 0.532351017f},
-std::array<float,2>{0.694741845f, 0.973321021f},
-std::array<float,2>{0.433400273f, 0.0450945497f},
-std::array<float,2>{0.784195185f, 0.476263851f},
-std::array<float,2>{0.171251833f, 0.660181403f},
-std::array<float,2>{0.984918118f, 0.562897742f},
-std::array<float,2>{0.103875637f, 0.351519763f},
-std::array<float,2>{0.55456686f, 0.173666984f},
-std::array<float,2>{0.28706935f, 0.789145052f},
-std::array<float,2>{0.641182899f, 0.506739855f},
-std::array<float,2>{0.464678079f, 0.272807717f},
-std::array<float,2>{0.858559608f, 0.230763018f},
-std::array<float,2>{0.215247497f, 0.859659135f},
-std::array<float,2>{0.896682262f, 0.920037985f},
-std::array<float,2>{0.0544537418f, 0.101394519f},
-std::array<float,2>{0.569764614f, 0.394253939f},
-std::array<float,2>{0.319755346f, 0.73036778f},
-std::array<float,2>{0.513689756f, 0.765819192f},
-std::array<float,2>{0.265475512f, 0.150391892f},
-std::array<float,2>{0.943860948f, 0.340044081f},
-std::array<float,2>{0.0628903732f, 0.593856275f},
-std::array<float,2>{0.777229786f, 0.642170846f},
-std::array<float,2>{0.140544653f, 0.445805341f},
-std::array<float,2>{0.741366208f, 0.0292924922f},
-std::array<float,2>{0.389878988f, 0.955819905f},
-std::array<float,2>{0.501535952f, 0.517754316f},
-std::array<float,2>{0.254955202f, 0.255060166f},
-std::array<float,2>{0.951372802f, 0.240620434f},
-std::array<float,2>{0.0765459985f, 0.849245429f},
-std::array<float,2>{0.766487718f, 0.935317695f},
-std::array<float,2>{0.132106796f, 0.11441572f},
-std::array<float,2>{0.743326604f, 0.384615749f},
-std::array<float,2>{0.378437579f, 0.735291541f},
-std::array<float,2>{0.649546385f, 0.753284693f},
-std::array<float,2>{0.456366867f, 0.134728178f},
-std::array<float,2>{0.850184798f, 0.322224557f},
-std::array<float,2>{0.205351382f, 0.620536745f},
-std::array<float,2>{0.900512516f, 0.630568087f},
-std::array<float,2>{0.0561374687f, 0.454859525f},
-std::array<float,2>{0.573204756f, 0.012033076f},
-std::array<float,2>{0.322752982f, 0.941810727f},
-std::array<float,2>{0.700545192f, 0.701952279f},
-std::array<float,2>{0.426333696f, 0.429972053f},
-std::array<float,2>{0.795069277f, 0.081542179f},
-std::array<float,2>{0.157651678f, 0.878772914f},
-std::array<float,2>{0.995219767f, 0.833768129f},
-std::array<float,2>{0.0965227261f, 0.190136552f},
-std::array<float,2>{0.562380373f, 0.298680246f},
-std::array<float,2>{0.296720177f, 0.556108475f},
-std::array<float,2>{0.619800985f, 0.99587971f},
-std::array<float,2>{0.356931478f, 0.0537456051f},
-std::array<float,2>{0.91852659f, 0.485940725f},
-std::array<float,2>{0.0276889224f, 0.681286752f},
-std::array<float,2>{0.836832881f, 0.58690083f},
-std::array<float,2>{0.242282733f, 0.368707806f},
-std::array<float,2>{0.674892128f, 0.16909425f},
-std::array<float,2>{0.485090345f, 0.811714053f},
-std::array<float,2>{0.588335693f, 0.656457543f},
-std::array<float,2>{0.329467475f, 0.469132632f},
-std::array<float,2>{0.882718325f, 0.0416587256f},
-std::array<float,2>{0.0414599329f, 0.972092986f},
-std::array<float,2>{0.87225908f, 0.794640183f},
-std::array<float,2>{0.189428896f, 0.178034395f},
-std::array<float,2>{0.626495898f, 0.3460989f},
-std::array<float,2>{0.448535353f, 0.56972003f},
-std::array<float,2>{0.726811588f, 0.898945451f},
-std::array<float,2>{0.400080174f, 0.0728192776f},
-std::array<float,2>{0.756192446f, 0.415371627f},
-std::array<float,2>{0.150564343f, 0.70866698f},
-std::array<float,2>{0.967041969f, 0.536571383f},
-std::array<float,2>{0.0798817948f, 0.283298582f},
-std::array<float,2>{0.520647466f, 0.204934925f},
-std::array<float,2>{0.273635238f, 0.817315638f},
-std::array<float,2>{0.665843964f, 0.599542797f},
-std::array<float,2>{0.478052288f, 0.336683452f},
-std::array<float,2>{0.823312759f, 0.152565286f},
-std::array<float,2>{0.230654433f, 0.773064435f},
-std::array<float,2>{0.923779547f, 0.957381785f},
-std::array<float,2>{0.0155162346f, 0.0266360808f},
-std::array<float,2>{0.597417295f, 0.452783436f},
-std::array<float,2>{0.362975478f, 0.647244215f},
-std::array<float,2>{0.534458697f, 0.86387372f},
-std::array<float,2>{0.306508362f, 0.228091061f},
-std::array<float,2>{0.980321288f, 0.267048001f},
-std::array<float,2>{0.117410921f, 0.501029313f},
-std::array<float,2>{0.799144924f, 0.731781602f},
-std::array<float,2>{0.175245523f, 0.395861715f},
-std::array<float,2>{0.718194664f, 0.0940909907f},
-std::array<float,2>{0.410121113f, 0.914882123f},
-std::array<float,2>{0.602226973f, 0.578054488f},
-std::array<float,2>{0.368097544f, 0.354120821f},
-std::array<float,2>{0.930318892f, 0.181425393f},
-std::array<float,2>{6.97010837e-05f, 0.785496175f},
-std::array<float,2>{0.815841377f, 0.981191576f},
-std::array<float,2>{0.218799651f, 0.0375204235f},
-std::array<float,2>{0.663757265f, 0.478907585f},
-std::array<float,2>{0.473299474f, 0.666338444f},
-std::array<float,2>{0.710198402f, 0.822635114f},
-std::array<float,2>{0.416852236f, 0.216374397f},
-std::array<float,2>{0.805314779f, 0.293012679f},
-std::array<float,2>{0.186102718f, 0.543470442f},
-std::array<float,2>{0.974645197f, 0.711836159f},
-std::array<float,2>{0.111402377f, 0.408765256f},
-std::array<float,2>{0.542032063f, 0.0673318207f},
-std::array<float,2>{0.303773522f, 0.891894162f},
-std::array<float,2>{0.634859085f, 0.65208286f},
-std::array<float,2>{0.438422352f, 0.442990243f},
-std::array<float,2>{0.862130404f, 0.0215875562f},
-std::array<float,2>{0.197504476f, 0.966270685f},
-std::array<float,2>{0.887462616f, 0.774855793f},
-std::array<float,2>{0.0345979929f, 0.148235887f},
-std::array<float,2>{0.57884568f, 0.331487089f},
-std::array<float,2>{0.337597221f, 0.603182137f},
-std::array<float,2>{0.52737385f, 0.911917806f},
-std::array<float,2>{0.270823509f, 0.105436407f},
-std::array<float,2>{0.958429694f, 0.403908879f},
-std::array<float,2>{0.0923950151f, 0.725415289f},
-std::array<float,2>{0.759239733f, 0.51123625f},
-std::array<float,2>{0.147349343f, 0.280781627f},
-std::array<float,2>{0.722513437f, 0.225107968f},
-std::array<float,2>{0.395844877f, 0.874822855f},
-std::array<float,2>{0.55058974f, 0.746507466f},
-std::array<float,2>{0.281509995f, 0.377741218f},
-std::array<float,2>{0.990502f, 0.123258121f},
-std::array<float,2>{0.108067244f, 0.924312055f},
-std::array<float,2>{0.78738308f, 0.855716884f},
-std::array<float,2>{0.165155649f, 0.242376447f},
-std::array<float,2>{0.690422118f, 0.257930398f},
-std::array<float,2>{0.434358299f, 0.530775726f},
-std::array<float,2>{0.680027306f, 0.946244776f},
-std::array<float,2>{0.499892294f, 0.000762825366f},
-std::array<float,2>{0.835507274f, 0.466764092f},
-std::array<float,2>{0.235610768f, 0.633932829f},
-std::array<float,2>{0.910601139f, 0.610130727f},
-std::array<float,2>{0.0230570268f, 0.313930124f},
-std::array<float,2>{0.612950325f, 0.131143019f},
-std::array<float,2>{0.346481472f, 0.761161327f},
-std::array<float,2>{0.738176286f, 0.548816442f},
-std::array<float,2>{0.38338533f, 0.307951987f},
-std::array<float,2>{0.781119108f, 0.201136723f},
-std::array<float,2>{0.136109099f, 0.838011205f},
-std::array<float,2>{0.938514769f, 0.890207052f},
-std::array<float,2>{0.0692892075f, 0.0898639783f},
-std::array<float,2>{0.510518193f, 0.425749213f},
-std::array<float,2>{0.26097253f, 0.691471457f},
-std::array<float,2>{0.565131128f, 0.79862833f},
-std::array<float,2>{0.314477772f, 0.162690505f},
-std::array<float,2>{0.894031763f, 0.365077615f},
-std::array<float,2>{0.0481775329f, 0.58479476f},
-std::array<float,2>{0.854673624f, 0.675709844f},
-std::array<float,2>{0.211880982f, 0.492797613f},
-std::array<float,2>{0.644846141f, 0.0612984374f},
-std::array<float,2>{0.465872228f, 0.988409221f},
-std::array<float,2>{0.604539573f, 0.543777347f},
-std::array<float,2>{0.371059239f, 0.293285936f},
-std::array<float,2>{0.9321661f, 0.216668487f},
-std::array<float,2>{0.0037513047f, 0.822479844f},
-std::array<float,2>{0.812897027f, 0.891697288f},
-std::array<float,2>{0.222631291f, 0.0670975968f},
-std::array<float,2>{0.661504626f, 0.408976525f},
-std::array<float,2>{0.475500643f, 0.711553037f},
-std::array<float,2>{0.70827812f, 0.785190761f},
-std::array<float,2>{0.414324433f, 0.181381151f},
-std::array<float,2>{0.807267845f, 0.354343981f},
-std::array<float,2>{0.184643298f, 0.577789485f},
-std::array<float,2>{0.973102093f, 0.666165471f},
-std::array<float,2>{0.110919356f, 0.478540063f},
-std::array<float,2>{0.540195405f, 0.0372716039f},
-std::array<float,2>{0.302169055f, 0.981369555f},
-std::array<float,2>{0.632879674f, 0.72530818f},
-std::array<float,2>{0.441187561f, 0.404160142f},
-std::array<float,2>{0.85983336f, 0.10503567f},
-std::array<float,2>{0.195382178f, 0.91173768f},
-std::array<float,2>{0.88914597f, 0.874590337f},
-std::array<float,2>{0.0331122652f, 0.225458503f},
-std::array<float,2>{0.581611574f, 0.281178117f},
-std::array<float,2>{0.338289648f, 0.511554539f},
-std::array<float,2>{0.530193329f, 0.965891898f},
-std::array<float,2>{0.272997826f, 0.0218813773f},
-std::array<float,2>{0.960885286f, 0.443345636f},
-std::array<float,2>{0.091382347f, 0.6522578f},
-std::array<float,2>{0.761619747f, 0.603486955f},
-std::array<float,2>{0.146048114f, 0.33110404f},
-std::array<float,2>{0.71977073f, 0.148159862f},
-std::array<float,2>{0.398263901f, 0.774571419f},
-std::array<float,2>{0.547288239f, 0.634129286f},
-std::array<float,2>{0.284917504f, 0.466518968f},
-std::array<float,2>{0.989680707f, 0.000561642752f},
-std::array<float,2>{0.105490401f, 0.94587636f},
-std::array<float,2>{0.786837518f, 0.7607916f},
-std::array<float,2>{0.16689837f, 0.130872414f},
-std::array<float,2>{0.688771427f, 0.313509345f},
-std::array<float,2>{0.435654402f, 0.610052586f},
-std::array<float,2>{0.681827843f, 0.923897147f},
-std::array<float,2>{0.497879177f, 0.123482138f},
-std::array<float,2>{0.832115352f, 0.377619356f},
-std::array<float,2>{0.237067342f, 0.746276855f},
-std::array<float,2>{0.912976086f, 0.531006753f},
-std::array<float,2>{0.0211685318f, 0.258129179f},
-std::array<float,2>{0.610493064f, 0.242632791f},
-std::array<float,2>{0.345593035f, 0.855624259f},
-std::array<float,2>{0.735572338f, 0.58464551f},
-std::array<float,2>{0.385052621f, 0.364816755f},
-std::array<float,2>{0.778927028f, 0.162892208f},
-std::array<float,2>{0.133941174f, 0.798555255f},
-std::array<float,2>{0.939958513f, 0.988641262f},
-std::array<float,2>{0.0668550804f, 0.0612470582f},
-std::array<float,2>{0.507903337f, 0.493121147f},
-std::array<float,2>{0.259506464f, 0.675519824f},
-std::array<float,2>{0.563173175f, 0.838172495f},
-std::array<float,2>{0.312849283f, 0.200814858f},
-std::array<float,2>{0.891880751f, 0.307671815f},
-std::array<float,2>{0.0490032919f, 0.548488736f},
-std::array<float,2>{0.852211297f, 0.691803336f},
-std::array<float,2>{0.212908179f, 0.425439388f},
-std::array<float,2>{0.647234023f, 0.0901482627f},
-std::array<float,2>{0.467645526f, 0.890389383f},
-std::array<float,2>{0.502163112f, 0.620220542f},
-std::array<float,2>{0.257307947f, 0.321941197f},
-std::array<float,2>{0.951016545f, 0.134307563f},
-std::array<float,2>{0.0751296356f, 0.753017724f},
-std::array<float,2>{0.768588483f, 0.941529989f},
-std::array<float,2>{0.129695505f, 0.011901387f},
-std::array<float,2>{0.745442867f, 0.454804152f},
-std::array<float,2>{0.375791788f, 0.630854309f},
-std::array<float,2>{0.650474131f, 0.849446177f},
-std::array<float,2>{0.454339713f, 0.240304247f},
-std::array<float,2>{0.84894681f, 0.255360007f},
-std::array<float,2>{0.203637823f, 0.517989695f},
-std::array<float,2>{0.89979881f, 0.735088527f},
-std::array<float,2>{0.057018131f, 0.384414494f},
-std::array<float,2>{0.571536779f, 0.114686877f},
-std::array<float,2>{0.320394158f, 0.935276568f},
-std::array<float,2>{0.702493608f, 0.681596518f},
-std::array<float,2>{0.429327101f, 0.486117512f},
-std::array<float,2>{0.794489622f, 0.0541595742f},
-std::array<float,2>{0.158634171f, 0.995844483f},
-std::array<float,2>{0.993988156f, 0.811954558f},
-std::array<float,2>{0.0943094939f, 0.169403106f},
-std::array<float,2>{0.559105456f, 0.369041026f},
-std::array<float,2>{0.29442367f, 0.586620629f},
-std::array<float,2>{0.618162513f, 0.878514111f},
-std::array<float,2>{0.358714223f, 0.0810904875f},
-std::array<float,2>{0.920463383f, 0.429749727f},
-std::array<float,2>{0.029800754f, 0.701672018f},
-std::array<float,2>{0.839018524f, 0.555679381f},
-std::array<float,2>{0.244625643f, 0.298410058f},
-std::array<float,2>{0.672071993f, 0.190298393f},
-std::array<float,2>{0.48783648f, 0.83350563f},
-std::array<float,2>{0.587104678f, 0.708871245f},
-std::array<float,2>{0.331176788f, 0.415068865f},
-std::array<float,2>{0.87935555f, 0.0731032863f},
-std::array<float,2>{0.0392532535f, 0.899206042f},
-std::array<float,2>{0.874387681f, 0.817019403f},
-std::array<float,2>{0.189568803f, 0.204668373f},
-std::array<float,2>{0.628130078f, 0.283541411f},
-std::array<float,2>{0.446287304f, 0.536276817f},
-std::array<float,2>{0.729249597f, 0.971687734f},
-std::array<float,2>{0.401719779f, 0.0417587087f},
-std::array<float,2>{0.755820036f, 0.468754649f},
-std::array<float,2>{0.148847967f, 0.656710029f},
-std::array<float,2>{0.965418935f, 0.569464922f},
-std::array<float,2>{0.0811928436f, 0.345842123f},
-std::array<float,2>{0.521744907f, 0.177934587f},
-std::array<float,2>{0.27661106f, 0.794866443f},
-std::array<float,2>{0.666564107f, 0.501276076f},
-std::array<float,2>{0.479686022f, 0.266608924f},
-std::array<float,2>{0.822256088f, 0.228444085f},
-std::array<float,2>{0.232757851f, 0.864239395f},
-std::array<float,2>{0.924290419f, 0.914693654f},
-std::array<float,2>{0.0132865263f, 0.0939039811f},
-std::array<float,2>{0.595279396f, 0.395697206f},
-std::array<float,2>{0.360455364f, 0.731540978f},
-std::array<float,2>{0.531501174f, 0.773418725f},
-std::array<float,2>{0.307399869f, 0.152718902f},
-std::array<float,2>{0.977224171f, 0.336487889f},
-std::array<float,2>{0.120897591f, 0.599285364f},
-std::array<float,2>{0.798293293f, 0.647071242f},
-std::array<float,2>{0.173776656f, 0.45311749f},
-std::array<float,2>{0.715007722f, 0.0264133792f},
-std::array<float,2>{0.407860994f, 0.957226753f},
-std::array<float,2>{0.54566741f, 0.521760821f},
-std::array<float,2>{0.297890276f, 0.253118634f},
-std::array<float,2>{0.968967021f, 0.237333328f},
-std::array<float,2>{0.114221275f, 0.847160101f},
-std::array<float,2>{0.810899019f, 0.932258427f},
-std::array<float,2>{0.183553696f, 0.111424424f},
-std::array<float,2>{0.706290245f, 0.389901668f},
-std::array<float,2>{0.420433819f, 0.741978347f},
-std::array<float,2>{0.658871353f, 0.757037818f},
-std::array<float,2>{0.469160467f, 0.140458897f},
-std::array<float,2>{0.817017853f, 0.326759964f},
-std::array<float,2>{0.222934529f, 0.624293447f},
-std::array<float,2>{0.93363291f, 0.626762807f},
-std::array<float,2>{0.00527259056f, 0.460227281f},
-std::array<float,2>{0.607455134f, 0.0110124275f},
-std::array<float,2>{0.371710658f, 0.937772214f},
-std::array<float,2>{0.725488126f, 0.69589746f},
-std::array<float,2>{0.391632557f, 0.435966969f},
-std::array<float,2>{0.761745512f, 0.0854822397f},
-std::array<float,2>{0.144108415f, 0.882618427f},
-std::array<float,2>{0.954201996f, 0.831948996f},
-std::array<float,2>{0.0863933712f, 0.192875177f},
-std::array<float,2>{0.525805414f, 0.304060936f},
-std::array<float,2>{0.269228101f, 0.561477661f},
-std::array<float,2>{0.584363818f, 0.998073578f},
-std::array<float,2>{0.342642158f, 0.0488624126f},
-std::array<float,2>{0.885340154f, 0.489241093f},
-std::array<float,2>{0.0359946936f, 0.686773896f},
-std::array<float,2>{0.863651276f, 0.590511501f},
-std::array<float,2>{0.199970871f, 0.373565793f},
-std::array<float,2>{0.637414098f, 0.164385721f},
-std::array<float,2>{0.441874057f, 0.806997597f},
-std::array<float,2>{0.617181838f, 0.660525143f},
-std::array<float,2>{0.350605011f, 0.476557225f},
-std::array<float,2>{0.906717718f, 0.0453901291f},
-std::array<float,2>{0.0162936114f, 0.973545492f},
-std::array<float,2>{0.83093214f, 0.789384902f},
-std::array<float,2>{0.241896421f, 0.173340261f},
-std::array<float,2>{0.685067058f, 0.351233751f},
-std::array<float,2>{0.492495865f, 0.562531769f},
-std::array<float,2>{0.691854f, 0.903741002f},
-std::array<float,2>{0.430343717f, 0.0757048503f},
-std::array<float,2>{0.782138228f, 0.42042926f},
-std::array<float,2>{0.169111386f, 0.70453161f},
-std::array<float,2>{0.987786531f, 0.532621324f},
-std::array<float,2>{0.102617025f, 0.285808414f},
-std::array<float,2>{0.551164329f, 0.209585398f},
-std::array<float,2>{0.289022893f, 0.814843953f},
-std::array<float,2>{0.643124521f, 0.594137728f},
-std::array<float,2>{0.461003333f, 0.34015283f},
-std::array<float,2>{0.856270373f, 0.150695771f},
-std::array<float,2>{0.218727529f, 0.765971065f},
-std::array<float,2>{0.895406604f, 0.955790877f},
-std::array<float,2>{0.051079791f, 0.028823128f},
-std::array<float,2>{0.56737721f, 0.446144849f},
-std::array<float,2>{0.318272412f, 0.642460346f},
-std::array<float,2>{0.512230635f, 0.859618664f},
-std::array<float,2>{0.261814713f, 0.23049055f},
-std::array<float,2>{0.942996025f, 0.272532731f},
-std::array<float,2>{0.064974077f, 0.506498277f},
-std::array<float,2>{0.774780214f, 0.730194509f},
-std::array<float,2>{0.137379214f, 0.394426584f},
-std::array<float,2>{0.73896873f, 0.101216897f},
-std::array<float,2>{0.387437731f, 0.920323253f},
-std::array<float,2>{0.575090289f, 0.572698057f},
-std::array<float,2>{0.326479107f, 0.357755303f},
-std::array<float,2>{0.903459728f, 0.185605496f},
-std::array<float,2>{0.0592828505f, 0.783398449f},
-std::array<float,2>{0.846039355f, 0.979373753f},
-std::array<float,2>{0.209653184f, 0.0344435684f},
-std::array<float,2>{0.655809939f, 0.482276708f},
-std::array<float,2>{0.459827751f, 0.671586812f},
-std::array<float,2>{0.746873498f, 0.825811148f},
-std::array<float,2>{0.382493526f, 0.212193266f},
-std::array<float,2>{0.772264361f, 0.291778177f},
-std::array<float,2>{0.127645969f, 0.540329933f},
-std::array<float,2>{0.946577907f, 0.717572451f},
-std::array<float,2>{0.0708552673f, 0.413069934f},
-std::array<float,2>{0.506768584f, 0.0641591772f},
-std::array<float,2>{0.251537442f, 0.895924389f},
-std::array<float,2>{0.677326739f, 0.65458262f},
-std::array<float,2>{0.491734177f, 0.437531829f},
-std::array<float,2>{0.843710542f, 0.0181289185f},
-std::array<float,2>{0.247479469f, 0.964564264f},
-std::array<float,2>{0.916584671f, 0.779367507f},
-std::array<float,2>{0.0240735784f, 0.141500637f},
-std::array<float,2>{0.622122467f, 0.334681332f},
-std::array<float,2>{0.351962686f, 0.608664691f},
-std::array<float,2>{0.558498025f, 0.909226418f},
-std::array<float,2>{0.290851861f, 0.108324423f},
-std::array<float,2>{0.999460876f, 0.398970544f},
-std::array<float,2>{0.0991524681f, 0.718794167f},
-std::array<float,2>{0.792362869f, 0.512595475f},
-std::array<float,2>{0.161275774f, 0.276216656f},
-std::array<float,2>{0.697719753f, 0.222208455f},
-std::array<float,2>{0.423469305f, 0.867688179f},
-std::array<float,2>{0.516575038f, 0.745570302f},
-std::array<float,2>{0.279942364f, 0.381330729f},
-std::array<float,2>{0.963972807f, 0.117905706f},
-std::array<float,2>{0.0831888616f, 0.928192854f},
-std::array<float,2>{0.75134927f, 0.853099883f},
-std::array<float,2>{0.152469516f, 0.248446435f},
-std::array<float,2>{0.733825147f, 0.262894571f},
-std::array<float,2>{0.403503954f, 0.524012864f},
-std::array<float,2>{0.631115615f, 0.952038586f},
-std::array<float,2>{0.451096267f, 0.00589901116f},
-std::array<float,2>{0.870993316f, 0.461694181f},
-std::array<float,2>{0.192930311f, 0.638826847f},
-std::array<float,2>{0.875196218f, 0.615026116f},
-std::array<float,2>{0.0440524817f, 0.318918765f},
-std::array<float,2>{0.590096951f, 0.125368491f},
-std::array<float,2>{0.334756762f, 0.764080346f},
-std::array<float,2>{0.711776376f, 0.551229656f},
-std::array<float,2>{0.413810581f, 0.310825795f},
-std::array<float,2>{0.803227127f, 0.195966661f},
-std::array<float,2>{0.178640053f, 0.840027571f},
-std::array<float,2>{0.981094241f, 0.886467874f},
-std::array<float,2>{0.12203975f, 0.0886142552f},
-std::array<float,2>{0.538070977f, 0.429073125f},
-std::array<float,2>{0.311749846f, 0.690003455f},
-std::array<float,2>{0.600837052f, 0.801927686f},
-std::array<float,2>{0.364125907f, 0.156947374f},
-std::array<float,2>{0.929536819f, 0.362848401f},
-std::array<float,2>{0.0106221093f, 0.579440355f},
-std::array<float,2>{0.827809811f, 0.679403245f},
-std::array<float,2>{0.227682993f, 0.49856624f},
-std::array<float,2>{0.671210468f, 0.0552400164f},
-std::array<float,2>{0.483004153f, 0.986285388f},
-std::array<float,2>{0.57998693f, 0.508775175f},
-std::array<float,2>{0.335951209f, 0.278756142f},
-std::array<float,2>{0.888196588f, 0.223355994f},
-std::array<float,2>{0.0334965363f, 0.871206462f},
-std::array<float,2>{0.862517357f, 0.91239351f},
-std::array<float,2>{0.198317543f, 0.103040919f},
-std::array<float,2>{0.636525989f, 0.4050529f},
-std::array<float,2>{0.438713431f, 0.723411381f},
-std::array<float,2>{0.721599162f, 0.776881397f},
-std::array<float,2>{0.395191073f, 0.145906284f},
-std::array<float,2>{0.758746922f, 0.328237265f},
-std::array<float,2>{0.147979528f, 0.604758441f},
-std::array<float,2>{0.957691967f, 0.648851752f},
-std::array<float,2>{0.0931622609f, 0.444823056f},
-std::array<float,2>{0.529191494f, 0.0207744241f},
-std::array<float,2>{0.270383894f, 0.968197584f},
-std::array<float,2>{0.662613809f, 0.714370251f},
-std::array<float,2>{0.473809123f, 0.407847643f},
-std::array<float,2>{0.8147735f, 0.0700175464f},
-std::array<float,2>{0.220258161f, 0.893958151f},
-std::array<float,2>{0.930796385f, 0.822047412f},
-std::array<float,2>{0.00136465835f, 0.217947885f},
-std::array<float,2>{0.602680027f, 0.29526329f},
-std::array<float,2>{0.368370831f, 0.545434177f},
-std::array<float,2>{0.541801989f, 0.983280241f},
-std::array<float,2>{0.303684115f, 0.0364926085f},
-std::array<float,2>{0.975749969f, 0.476908118f},
-std::array<float,2>{0.113037542f, 0.664341331f},
-std::array<float,2>{0.805764556f, 0.574272931f},
-std::array<float,2>{0.187115103f, 0.352779776f},
-std::array<float,2>{0.709604502f, 0.18275471f},
-std::array<float,2>{0.417443067f, 0.788587093f},
-std::array<float,2>{0.510872841f, 0.672611117f},
-std::array<float,2>{0.260124981f, 0.494980782f},
-std::array<float,2>{0.93789798f, 0.060282547f},
-std::array<float,2>{0.0701711252f, 0.99056536f},
-std::array<float,2>{0.779361665f, 0.800124347f},
-std::array<float,2>{0.135308921f, 0.161382094f},
-std::array<float,2>{0.737189472f, 0.365297824f},
-std::array<float,2>{0.383911192f, 0.583404243f},
-std::array<float,2>{0.646098912f, 0.887871146f},
-std::array<float,2>{0.465344369f, 0.0923327059f},
-std::array<float,2>{0.854199231f, 0.421916664f},
-std::array<float,2>{0.212186754f, 0.693774581f},
-std::array<float,2>{0.89279443f, 0.550579131f},
-std::array<float,2>{0.0471186154f, 0.306441724f},
-std::array<float,2>{0.566109836f, 0.201422974f},
-std::array<float,2>{0.315811992f, 0.837516606f},
-std::array<float,2>{0.691143274f, 0.611417115f},
-std::array<float,2>{0.43535462f, 0.314841896f},
-std::array<float,2>{0.788949788f, 0.129657522f},
-std::array<float,2>{0.164353967f, 0.758924007f},
-std::array<float,2>{0.991565287f, 0.9481408f},
-std::array<float,2>{0.109174468f, 0.00325556076f},
-std::array<float,2>{0.549438179f, 0.46784094f},
-std::array<float,2>{0.282477677f, 0.63634789f},
-std::array<float,2>{0.61180979f, 0.857533455f},
-std::array<float,2>{0.346888006f, 0.246087834f},
-std::array<float,2>{0.91176343f, 0.260638565f},
-std::array<float,2>{0.0216720756f, 0.528433919f},
-std::array<float,2>{0.834741831f, 0.749852419f},
-std::array<float,2>{0.235072911f, 0.37616086f},
-std::array<float,2>{0.680678904f, 0.12114802f},
-std::array<float,2>{0.499013394f, 0.92249763f},
-std::array<float,2>{0.560943186f, 0.589790761f},
-std::array<float,2>{0.295546293f, 0.370102704f},
-std::array<float,2>{0.994410634f, 0.171304837f},
-std::array<float,2>{0.0969626978f, 0.810427666f},
-std::array<float,2>{0.79628551f, 0.992198586f},
-std::array<float,2>{0.156704336f, 0.0525595658f},
-std::array<float,2>{0.699431002f, 0.487240583f},
-std::array<float,2>{0.427540541f, 0.683053672f},
-std::array<float,2>{0.674565792f, 0.834867299f},
-std::array<float,2>{0.485401422f, 0.187555686f},
-std::array<float,2>{0.837379217f, 0.298859328f},
-std::array<float,2>{0.243314296f, 0.558488965f},
-std::array<float,2>{0.919820011f, 0.699413478f},
-std::array<float,2>{0.0286258683f, 0.432005435f},
-std::array<float,2>{0.620204449f, 0.0797362253f},
-std::array<float,2>{0.355480611f, 0.876190245f},
-std::array<float,2>{0.742657304f, 0.631649137f},
-std::array<float,2>{0.377129078f, 0.456420362f},
-std::array<float,2>{0.76721406f, 0.0145878727f},
-std::array<float,2>{0.131662086f, 0.943779171f},
-std::array<float,2>{0.952346385f, 0.750277698f},
-std::array<float,2>{0.0777635649f, 0.136199906f},
-std::array<float,2>{0.50039196f, 0.322666466f},
-std::array<float,2>{0.254765272f, 0.617812991f},
-std::array<float,2>{0.573544741f, 0.93732959f},
-std::array<float,2>{0.323651701f, 0.11667423f},
-std::array<float,2>{0.901841402f, 0.385292649f},
-std::array<float,2>{0.0551617369f, 0.73662591f},
-std::array<float,2>{0.851216197f, 0.517274737f},
-std::array<float,2>{0.206128672f, 0.256569892f},
-std::array<float,2>{0.648797512f, 0.238837227f},
-std::array<float,2>{0.455676645f, 0.849817514f},
-std::array<float,2>{0.59599328f, 0.733880222f},
-std::array<float,2>{0.362255216f, 0.397263587f},
-std::array<float,2>{0.922592998f, 0.0962361991f},
-std::array<float,2>{0.0143249007f, 0.916719556f},
-std::array<float,2>{0.823007882f, 0.865912378f},
-std::array<float,2>{0.231607899f, 0.229496062f},
-std::array<float,2>{0.664516628f, 0.269106418f},
-std::array<float,2>{0.476837724f, 0.503857791f},
-std::array<float,2>{0.717241466f, 0.959380269f},
-std::array<float,2>{0.409123033f, 0.0236255527f},
-std::array<float,2>{0.799832761f, 0.450167716f},
-std::array<float,2>{0.174704462f, 0.644949138f},
-std::array<float,2>{0.979295909f, 0.600300372f},
-std::array<float,2>{0.118835717f, 0.339045376f},
-std::array<float,2>{0.533399165f, 0.154409081f},
-std::array<float,2>{0.30541113f, 0.771308541f},
-std::array<float,2>{0.625357747f, 0.537540853f},
-std::array<float,2>{0.447543383f, 0.283093423f},
-std::array<float,2>{0.871232092f, 0.206135407f},
-std::array<float,2>{0.187513188f, 0.818781853f},
-std::array<float,2>{0.881323814f, 0.901895583f},
-std::array<float,2>{0.0426225401f, 0.0711570755f},
-std::array<float,2>{0.589540243f, 0.416801929f},
-std::array<float,2>{0.328553408f, 0.709293544f},
-std::array<float,2>{0.519598722f, 0.79525423f},
-std::array<float,2>{0.274977356f, 0.176085681f},
-std::array<float,2>{0.96791923f, 0.345071375f},
-std::array<float,2>{0.0786835179f, 0.566469729f},
-std::array<float,2>{0.757300675f, 0.659257114f},
-std::array<float,2>{0.152321175f, 0.472006172f},
-std::array<float,2>{0.72761482f, 0.0393411145f},
-std::array<float,2>{0.398870677f, 0.968999863f},
-std::array<float,2>{0.524176717f, 0.560441911f},
-std::array<float,2>{0.267093211f, 0.301252604f},
-std::array<float,2>{0.956830204f, 0.195002422f},
-std::array<float,2>{0.0897848532f, 0.829614341f},
-std::array<float,2>{0.765299737f, 0.879374444f},
-std::array<float,2>{0.140911043f, 0.0835907757f},
-std::array<float,2>{0.723294258f, 0.433960497f},
-std::array<float,2>{0.393180251f, 0.698901296f},
-std::array<float,2>{0.640562236f, 0.806139946f},
-std::array<float,2>{0.445245802f, 0.166782871f},
-std::array<float,2>{0.866232634f, 0.37267068f},
-std::array<float,2>{0.201980636f, 0.593286455f},
-std::array<float,2>{0.884113371f, 0.685059309f},
-std::array<float,2>{0.0388621576f, 0.491280258f},
-std::array<float,2>{0.583673835f, 0.047049053f},
-std::array<float,2>{0.340557873f, 0.996279776f},
-std::array<float,2>{0.704485536f, 0.739406288f},
-std::array<float,2>{0.418276668f, 0.388416559f},
-std::array<float,2>{0.809922338f, 0.109963715f},
-std::array<float,2>{0.180669188f, 0.930253863f},
-std::array<float,2>{0.972427368f, 0.844718874f},
-std::array<float,2>{0.115400754f, 0.236272335f},
-std::array<float,2>{0.543928444f, 0.250023305f},
-std::array<float,2>{0.300648183f, 0.520916939f},
-std::array<float,2>{0.605930805f, 0.940306187f},
-std::array<float,2>{0.373213738f, 0.00861312728f},
-std::array<float,2>{0.936955988f, 0.457386553f},
-std::array<float,2>{0.00674584694f, 0.628353f},
-std::array<float,2>{0.819379687f, 0.621167421f},
-std::array<float,2>{0.2263906f, 0.325714022f},
-std::array<float,2>{0.657923758f, 0.137395248f},
-std::array<float,2>{0.471238554f, 0.754997551f},
-std::array<float,2>{0.568536222f, 0.644055665f},
-std::array<float,2>{0.319074512f, 0.448138475f},
-std::array<float,2>{0.897488356f, 0.0302747376f},
-std::array<float,2>{0.0536505431f, 0.954482913f},
-std::array<float,2>{0.85814935f, 0.769374073f},
-std::array<float,2>{0.216438547f, 0.150382191f},
-std::array<float,2>{0.642163336f, 0.342391729f},
-std::array<float,2>{0.462962151f, 0.596340299f},
-std::array<float,2>{0.740630925f, 0.919684112f},
-std::array<float,2>{0.388745278f, 0.099264428f},
-std::array<float,2>{0.77573061f, 0.392476112f},
-std::array<float,2>{0.139194831f, 0.727777719f},
-std::array<float,2>{0.944494486f, 0.505857706f},
-std::array<float,2>{0.0636276603f, 0.269854337f},
-std::array<float,2>{0.515598536f, 0.233876824f},
-std::array<float,2>{0.264340281f, 0.863003314f},
-std::array<float,2>{0.686134934f, 0.565397799f},
-std::array<float,2>{0.495632768f, 0.348142505f},
-std::array<float,2>{0.828959942f, 0.175003976f},
-std::array<float,2>{0.239852294f, 0.791640162f},
-std::array<float,2>{0.908765912f, 0.975534737f},
-std::array<float,2>{0.0186053291f, 0.0446195155f},
-std::array<float,2>{0.614768982f, 0.474273682f},
-std::array<float,2>{0.347762793f, 0.662798703f},
-std::array<float,2>{0.553482711f, 0.812552989f},
-std::array<float,2>{0.286097556f, 0.207630321f},
-std::array<float,2>{0.985973716f, 0.288315564f},
-std::array<float,2>{0.105029903f, 0.533883989f},
-std::array<float,2>{0.7835657f, 0.705187023f},
-std::array<float,2>{0.170451015f, 0.419022024f},
-std::array<float,2>{0.693650544f, 0.077360183f},
-std::array<float,2>{0.431674689f, 0.905453563f},
-std::array<float,2>{0.624674618f, 0.606699169f},
-std::array<float,2>{0.354839504f, 0.333237976f},
-std::array<float,2>{0.915140212f, 0.143861011f},
-std::array<float,2>{0.0258799177f, 0.779147625f},
-std::array<float,2>{0.840799212f, 0.962741375f},
-std::array<float,2>{0.249583989f, 0.0170179233f},
-std::array<float,2>{0.678593814f, 0.440237194f},
-std::array<float,2>{0.489402413f, 0.653206706f},
-std::array<float,2>{0.695926487f, 0.870290935f},
-std::array<float,2>{0.424470186f, 0.219683483f},
-std::array<float,2>{0.789822757f, 0.274563015f},
-std::array<float,2>{0.16268757f, 0.513985097f},
-std::array<float,2>{0.997983098f, 0.721090078f},
-std::array<float,2>{0.100398377f, 0.401578128f},
-std::array<float,2>{0.555619299f, 0.105969869f},
-std::array<float,2>{0.292746305f, 0.907317877f},
-std::array<float,2>{0.652582467f, 0.669519484f},
-std::array<float,2>{0.458342224f, 0.48279202f},
-std::array<float,2>{0.844325364f, 0.0314702131f},
-std::array<float,2>{0.208732113f, 0.978233814f},
-std::array<float,2>{0.906134367f, 0.783165395f},
-std::array<float,2>{0.0624681264f, 0.184595421f},
-std::array<float,2>{0.577549696f, 0.356295079f},
-std::array<float,2>{0.324872524f, 0.571625054f},
-std::array<float,2>{0.505717576f, 0.897158861f},
-std::array<float,2>{0.252936661f, 0.0644847676f},
-std::array<float,2>{0.948088288f, 0.412109286f},
-std::array<float,2>{0.0736473352f, 0.716290832f},
-std::array<float,2>{0.771022022f, 0.54248935f},
-std::array<float,2>{0.126052544f, 0.290302098f},
-std::array<float,2>{0.748909175f, 0.214787573f},
-std::array<float,2>{0.379745066f, 0.827065647f},
-std::array<float,2>{0.536784232f, 0.688328326f},
-std::array<float,2>{0.309070855f, 0.426883191f},
-std::array<float,2>{0.983172417f, 0.087318927f},
-std::array<float,2>{0.123142563f, 0.883967161f},
-std::array<float,2>{0.802115083f, 0.843375981f},
-std::array<float,2>{0.177456751f, 0.198630676f},
-std::array<float,2>{0.714554548f, 0.309800446f},
-std::array<float,2>{0.410219997f, 0.552828312f},
-std::array<float,2>{0.668582082f, 0.986356616f},
-std::array<float,2>{0.480610073f, 0.0571597293f},
-std::array<float,2>{0.825069666f, 0.496103495f},
-std::array<float,2>{0.230377451f, 0.677361071f},
-std::array<float,2>{0.927390873f, 0.580416441f},
-std::array<float,2>{0.00868658163f, 0.360955805f},
-std::array<float,2>{0.597999811f, 0.159680232f},
-std::array<float,2>{0.366331816f, 0.803774714f},
-std::array<float,2>{0.730565488f, 0.525735974f},
-std::array<float,2>{0.405364454f, 0.264016926f},
-std::array<float,2>{0.75375098f, 0.248013467f},
-std::array<float,2>{0.15549396f, 0.854650497f},
-std::array<float,2>{0.961248815f, 0.927119732f},
-std::array<float,2>{0.0849545375f, 0.120108031f},
-std::array<float,2>{0.519253314f, 0.379523546f},
-std::array<float,2>{0.277986944f, 0.743004441f},
-std::array<float,2>{0.592864513f, 0.763509154f},
-std::array<float,2>{0.33254379f, 0.12886472f},
-std::array<float,2>{0.877699435f, 0.317188472f},
-std::array<float,2>{0.0453257822f, 0.616244912f},
-std::array<float,2>{0.8682881f, 0.637086093f},
-std::array<float,2>{0.194454342f, 0.463640958f},
-std::array<float,2>{0.629773557f, 0.00422168802f},
-std::array<float,2>{0.452133656f, 0.95072943f},
-std::array<float,2>{0.609749317f, 0.527643085f},
-std::array<float,2>{0.344129533f, 0.261051774f},
-std::array<float,2>{0.913707972f, 0.24434571f},
-std::array<float,2>{0.0200046077f, 0.859181702f},
-std::array<float,2>{0.833424211f, 0.923342526f},
-std::array<float,2>{0.237899348f, 0.122613259f},
-std::array<float,2>{0.68289417f, 0.375443161f},
-std::array<float,2>{0.49706769f, 0.748535395f},
-std::array<float,2>{0.6877864f, 0.757847011f},
-std::array<float,2>{0.437445581f, 0.130198047f},
-std::array<float,2>{0.786094069f, 0.315749139f},
-std::array<float,2>{0.167152211f, 0.61278373f},
-std::array<float,2>{0.988390625f, 0.63565284f},
-std::array<float,2>{0.106451571f, 0.467560917f},
-std::array<float,2>{0.54785943f, 0.00252508605f},
-std::array<float,2>{0.283972144f, 0.948476613f},
-std::array<float,2>{0.648366332f, 0.695312142f},
-std::array<float,2>{0.4682751f, 0.423506111f},
-std::array<float,2>{0.853260875f, 0.0934481174f},
-std::array<float,2>{0.214803278f, 0.887345374f},
-std::array<float,2>{0.89071697f, 0.836473763f},
-std::array<float,2>{0.0504951142f, 0.202457413f},
-std::array<float,2>{0.563543677f, 0.304998904f},
-std::array<float,2>{0.313717216f, 0.549124718f},
-std::array<float,2>{0.508933961f, 0.991664112f},
-std::array<float,2>{0.258680016f, 0.0593081415f},
-std::array<float,2>{0.941013992f, 0.495705575f},
-std::array<float,2>{0.0674260259f, 0.673137605f},
-std::array<float,2>{0.777966917f, 0.582440794f},
-std::array<float,2>{0.133052111f, 0.366358548f},
-std::array<float,2>{0.734519839f, 0.161030546f},
-std::array<float,2>{0.386675835f, 0.799041629f},
-std::array<float,2>{0.539767861f, 0.665408611f},
-std::array<float,2>{0.300803363f, 0.478038102f},
-std::array<float,2>{0.974533498f, 0.0353189223f},
-std::array<float,2>{0.109569855f, 0.984185576f},
-std::array<float,2>{0.807866037f, 0.787634432f},
-std::array<float,2>{0.184446961f, 0.182486266f},
-std::array<float,2>{0.707540154f, 0.351673394f},
-std::array<float,2>{0.415843308f, 0.576129496f},
-std::array<float,2>{0.660868347f, 0.892731071f},
-std::array<float,2>{0.476432532f, 0.0691194013f},
-std::array<float,2>{0.814253688f, 0.407132536f},
-std::array<float,2>{0.221331134f, 0.713278115f},
-std::array<float,2>{0.933477163f, 0.546810031f},
-std::array<float,2>{0.00260792952f, 0.296263248f},
-std::array<float,2>{0.60419631f, 0.217664644f},
-std::array<float,2>{0.369969279f, 0.821093917f},
-std::array<float,2>{0.719116867f, 0.603875935f},
-std::array<float,2>{0.396513999f, 0.329291075f},
-std::array<float,2>{0.760733485f, 0.145442903f},
-std::array<float,2>{0.145192504f, 0.776098847f},
-std::array<float,2>{0.959186971f, 0.967262983f},
-std::array<float,2>{0.0907360241f, 0.0197156407f},
-std::array<float,2>{0.530794144f, 0.44390747f},
-std::array<float,2>{0.271996915f, 0.64997232f},
-std::array<float,2>{0.580871046f, 0.872129261f},
-std::array<float,2>{0.33942911f, 0.224490568f},
-std::array<float,2>{0.890497565f, 0.277984619f},
-std::array<float,2>{0.0314593799f, 0.508798063f},
-std::array<float,2>{0.861260116f, 0.724303484f},
-std::array<float,2>{0.196758017f, 0.405862987f},
-std::array<float,2>{0.634302557f, 0.101781309f},
-std::array<float,2>{0.439472467f, 0.913307905f},
-std::array<float,2>{0.523319185f, 0.567658484f},
-std::array<float,2>{0.275893092f, 0.343942344f},
-std::array<float,2>{0.966287732f, 0.177697897f},
-std::array<float,2>{0.0805781111f, 0.796751142f},
-std::array<float,2>{0.754431486f, 0.970237017f},
-std::array<float,2>{0.14991428f, 0.0405838154f},
-std::array<float,2>{0.729988754f, 0.470773309f},
-std::array<float,2>{0.400954038f, 0.658205152f},
-std::array<float,2>{0.626983762f, 0.820172012f},
-std::array<float,2>{0.447047561f, 0.205968991f},
-std::array<float,2>{0.873720229f, 0.281335503f},
-std::array<float,2>{0.190737695f, 0.539060473f},
-std::array<float,2>{0.880200803f, 0.710544527f},
-std::array<float,2>{0.0407485254f, 0.417658567f},
-std::array<float,2>{0.586202383f, 0.0714572221f},
-std::array<float,2>{0.331053406f, 0.900461555f},
-std::array<float,2>{0.716445267f, 0.646154702f},
-std::array<float,2>{0.406681478f, 0.450720012f},
-std::array<float,2>{0.797117293f, 0.0248768926f},
-std::array<float,2>{0.172162861f, 0.960885584f},
-std::array<float,2>{0.977805972f, 0.770186782f},
-std::array<float,2>{0.119669385f, 0.155376732f},
-std::array<float,2>{0.533048093f, 0.338822514f},
-std::array<float,2>{0.308395803f, 0.601105154f},
-std::array<float,2>{0.594013095f, 0.91723007f},
-std::array<float,2>{0.359610558f, 0.0974084064f},
-std::array<float,2>{0.92557627f, 0.397966981f},
-std::array<float,2>{0.0121952593f, 0.732861996f},
-std::array<float,2>{0.820318162f, 0.501982033f},
-std::array<float,2>{0.233666375f, 0.2677764f},
-std::array<float,2>{0.667055547f, 0.229419187f},
-std::array<float,2>{0.478630334f, 0.867089689f},
-std::array<float,2>{0.570405006f, 0.738006353f},
-std::array<float,2>{0.321448147f, 0.385792434f},
-std::array<float,2>{0.898712635f, 0.115376696f},
-std::array<float,2>{0.058483053f, 0.93643862f},
-std::array<float,2>{0.848489225f, 0.851260841f},
-std::array<float,2>{0.204468042f, 0.239437059f},
-std::array<float,2>{0.651848197f, 0.257800311f},
-std::array<float,2>{0.453179449f, 0.515674889f},
-std::array<float,2>{0.744249046f, 0.945089698f},
-std::array<float,2>{0.376490176f, 0.0149171669f},
-std::array<float,2>{0.767880261f, 0.455334395f},
-std::array<float,2>{0.13074024f, 0.632802427f},
-std::array<float,2>{0.949293196f, 0.619091988f},
-std::array<float,2>{0.0758649781f, 0.324175239f},
-std::array<float,2>{0.503864288f, 0.135446891f},
-std::array<float,2>{0.256522059f, 0.751568735f},
-std::array<float,2>{0.67353034f, 0.556942821f},
-std::array<float,2>{0.486652851f, 0.300481051f},
-std::array<float,2>{0.837958813f, 0.18939513f},
-std::array<float,2>{0.245525256f, 0.835869491f},
-std::array<float,2>{0.921355128f, 0.875290155f},
-std::array<float,2>{0.0303614177f, 0.0788124427f},
-std::array<float,2>{0.618549407f, 0.432895541f},
-std::array<float,2>{0.357801706f, 0.700907171f},
-std::array<float,2>{0.56011337f, 0.809556127f},
-std::array<float,2>{0.293917537f, 0.170895815f},
-std::array<float,2>{0.993073106f, 0.370585591f},
-std::array<float,2>{0.095288299f, 0.58793664f},
-std::array<float,2>{0.793856561f, 0.681817174f},
-std::array<float,2>{0.15949899f, 0.488262862f},
-std::array<float,2>{0.701241493f, 0.0508394465f},
-std::array<float,2>{0.428413212f, 0.993188679f},
-std::array<float,2>{0.552257359f, 0.535098135f},
-std::array<float,2>{0.287153214f, 0.287285149f},
-std::array<float,2>{0.986569345f, 0.208057389f},
-std::array<float,2>{0.102213189f, 0.813943028f},
-std::array<float,2>{0.783147693f, 0.904614687f},
-std::array<float,2>{0.16875124f, 0.0769682303f},
-std::array<float,2>{0.693191111f, 0.418106794f},
-std::array<float,2>{0.430874944f, 0.70640409f},
-std::array<float,2>{0.684361815f, 0.792589307f},
-std::array<float,2>{0.49408564f, 0.174024314f},
-std::array<float,2>{0.83177346f, 0.349044025f},
-std::array<float,2>{0.241148055f, 0.565835238f},
-std::array<float,2>{0.907503188f, 0.663620234f},
-std::array<float,2>{0.0175484326f, 0.473572761f},
-std::array<float,2>{0.615614414f, 0.0438283123f},
-std::array<float,2>{0.350514144f, 0.97609657f},
-std::array<float,2>{0.739272237f, 0.726807952f},
-std::array<float,2>{0.388174981f, 0.39097017f},
-std::array<float,2>{0.774021685f, 0.0985556543f},
-std::array<float,2>{0.13815254f, 0.918603897f},
-std::array<float,2>{0.941752791f, 0.861770928f},
-std::array<float,2>{0.0658340231f, 0.232949749f},
-std::array<float,2>{0.513634264f, 0.270726591f},
-std::array<float,2>{0.262711734f, 0.50430876f},
-std::array<float,2>{0.568012536f, 0.953801274f},
-std::array<float,2>{0.31641984f, 0.0296082683f},
-std::array<float,2>{0.895919383f, 0.448261261f},
-std::array<float,2>{0.0524549969f, 0.642873347f},
-std::array<float,2>{0.856454074f, 0.597433031f},
-std::array<float,2>{0.217773035f, 0.343186587f},
-std::array<float,2>{0.643574417f, 0.149309516f},
-std::array<float,2>{0.462563872f, 0.767897129f},
-std::array<float,2>{0.609011352f, 0.627668142f},
-std::array<float,2>{0.3722471f, 0.458568871f},
-std::array<float,2>{0.935228884f, 0.00975161139f},
-std::array<float,2>{0.00430990895f, 0.94064939f},
-std::array<float,2>{0.817902565f, 0.754818618f},
-std::array<float,2>{0.224145412f, 0.137700692f},
-std::array<float,2>{0.659795642f, 0.324708879f},
-std::array<float,2>{0.470098972f, 0.622146666f},
-std::array<float,2>{0.705374777f, 0.930700183f},
-std::array<float,2>{0.421313882f, 0.111171976f},
-std::array<float,2>{0.812421978f, 0.387107253f},
-std::array<float,2>{0.181771845f, 0.738444269f},
-std::array<float,2>{0.969936311f, 0.520475447f},
-std::array<float,2>{0.1146973f, 0.251037776f},
-std::array<float,2>{0.54593271f, 0.234984532f},
-std::array<float,2>{0.297548413f, 0.844942927f},
-std::array<float,2>{0.638135195f, 0.592280328f},
-std::array<float,2>{0.442536652f, 0.371423244f},
-std::array<float,2>{0.86517936f, 0.167503312f},
-std::array<float,2>{0.200635269f, 0.804801583f},
-std::array<float,2>{0.886090219f, 0.997177303f},
-std::array<float,2>{0.0370775051f, 0.0481759235f},
-std::array<float,2>{0.585052729f, 0.490648538f},
-std::array<float,2>{0.34329617f, 0.683994174f},
-std::array<float,2>{0.526739538f, 0.828794479f},
-std::array<float,2>{0.26811552f, 0.193880618f},
-std::array<float,2>{0.953641772f, 0.302586555f},
-std::array<float,2>{0.0870930851f, 0.559118867f},
-std::array<float,2>{0.762806118f, 0.698052347f},
-std::array<float,2>{0.142612755f, 0.435430586f},
-std::array<float,2>{0.725736976f, 0.0820359588f},
-std::array<float,2>{0.390673459f, 0.880680144f},
-std::array<float,2>{0.591114581f, 0.616026938f},
-std::array<float,2>{0.335548341f, 0.317978263f},
-std::array<float,2>{0.876315296f, 0.127620369f},
-std::array<float,2>{0.0435293987f, 0.762564361f},
-std::array<float,2>{0.869199157f, 0.950015604f},
-std::array<float,2>{0.192236304f, 0.00520022865f},
-std::array<float,2>{0.631886125f, 0.464248717f},
-std::array<float,2>{0.450006515f, 0.638073444f},
-std::array<float,2>{0.7325387f, 0.853959918f},
-std::array<float,2>{0.402960092f, 0.246919945f},
-std::array<float,2>{0.750782132f, 0.265246302f},
-std::array<float,2>{0.153917879f, 0.52728045f},
-std::array<float,2>{0.963804066f, 0.744128883f},
-std::array<float,2>{0.0822566822f, 0.380573422f},
-std::array<float,2>{0.517277122f, 0.120203212f},
-std::array<float,2>{0.281125963f, 0.92634505f},
-std::array<float,2>{0.670396388f, 0.676088631f},
-std::array<float,2>{0.484160006f, 0.497742444f},
-std::array<float,2>{0.827092648f, 0.0577188507f},
-std::array<float,2>{0.227423504f, 0.987646997f},
-std::array<float,2>{0.928674757f, 0.803503036f},
-std::array<float,2>{0.0116650034f, 0.159023523f},
-std::array<float,2>{0.599874914f, 0.359916955f},
-std::array<float,2>{0.36519447f, 0.581152081f},
-std::array<float,2>{0.539058268f, 0.883586526f},
-std::array<float,2>{0.311243504f, 0.0863949731f},
-std::array<float,2>{0.981536269f, 0.42595005f},
-std::array<float,2>{0.122605227f, 0.688781977f},
-std::array<float,2>{0.803914368f, 0.553758383f},
-std::array<float,2>{0.17897816f, 0.309553653f},
-std::array<float,2>{0.712528288f, 0.198141128f},
-std::array<float,2>{0.412727565f, 0.842082918f},
-std::array<float,2>{0.507699788f, 0.715791106f},
-std::array<float,2>{0.250107169f, 0.411059618f},
-std::array<float,2>{0.946042657f, 0.0654991344f},
-std::array<float,2>{0.0718407109f, 0.898158431f},
-std::array<float,2>{0.772629082f, 0.827441037f},
-std::array<float,2>{0.128621951f, 0.213449746f},
-std::array<float,2>{0.747432292f, 0.289926112f},
-std::array<float,2>{0.381472111f, 0.541743696f},
-std::array<float,2>{0.655118406f, 0.977519572f},
-std::array<float,2>{0.460203946f, 0.0325290188f},
-std::array<float,2>{0.847582996f, 0.48407048f},
-std::array<float,2>{0.21029681f, 0.668396115f},
-std::array<float,2>{0.903130829f, 0.571104109f},
-std::array<float,2>{0.0598387532f, 0.357096016f},
-std::array<float,2>{0.57563287f, 0.183741987f},
-std::array<float,2>{0.327211171f, 0.782110751f},
-std::array<float,2>{0.698546827f, 0.51475209f},
-std::array<float,2>{0.422809154f, 0.274155706f},
-std::array<float,2>{0.791964293f, 0.220689118f},
-std::array<float,2>{0.160979554f, 0.86939764f},
-std::array<float,2>{0.998144567f, 0.906727314f},
-std::array<float,2>{0.0980142504f, 0.106631644f},
-std::array<float,2>{0.557096839f, 0.400500178f},
-std::array<float,2>{0.2894063f, 0.721956253f},
-std::array<float,2>{0.621201932f, 0.778149009f},
-std::array<float,2>{0.35290888f, 0.143121615f},
-std::array<float,2>{0.917942762f, 0.332356811f},
-std::array<float,2>{0.024786409f, 0.605574846f},
-std::array<float,2>{0.84276253f, 0.653583765f},
-std::array<float,2>{0.24665387f, 0.440767884f},
-std::array<float,2>{0.675954759f, 0.0163269565f},
-std::array<float,2>{0.491019875f, 0.961000085f},
-std::array<float,2>{0.564668596f, 0.547376275f},
-std::array<float,2>{0.315199554f, 0.307550699f},
-std::array<float,2>{0.894519627f, 0.199763209f},
-std::array<float,2>{0.048557248f, 0.839385331f},
-std::array<float,2>{0.85518235f, 0.889154732f},
-std::array<float,2>{0.211403534f, 0.0912385881f},
-std::array<float,2>{0.645096123f, 0.424198836f},
-std::array<float,2>{0.466469735f, 0.693346262f},
-std::array<float,2>{0.737347245f, 0.79694432f},
-std::array<float,2>{0.382836729f, 0.163360104f},
-std::array<float,2>{0.780286551f, 0.363442451f},
-std::array<float,2>{0.13656725f, 0.585049748f},
-std::array<float,2>{0.938977838f, 0.674123645f},
-std::array<float,2>{0.0688342899f, 0.493656963f},
-std::array<float,2>{0.510044634f, 0.0621545054f},
-std::array<float,2>{0.261678964f, 0.989762306f},
-std::array<float,2>{0.680626869f, 0.747552454f},
-std::array<float,2>{0.499387145f, 0.378414601f},
-std::array<float,2>{0.835160613f, 0.124549419f},
-std::array<float,2>{0.236040458f, 0.925153017f},
-std::array<float,2>{0.910696805f, 0.85680902f},
-std::array<float,2>{0.0226384755f, 0.243552774f},
-std::array<float,2>{0.612601042f, 0.25917843f},
-std::array<float,2>{0.346114337f, 0.529713988f},
-std::array<float,2>{0.550049365f, 0.946476042f},
-std::array<float,2>{0.282120705f, 0.00171056506f},
-std::array<float,2>{0.990762055f, 0.464987576f},
-std::array<float,2>{0.107441112f, 0.633453667f},
-std::array<float,2>{0.788019359f, 0.61083436f},
-std::array<float,2>{0.165796533f, 0.313384205f},
-std::array<float,2>{0.689748108f, 0.132254198f},
-std::array<float,2>{0.433646202f, 0.759862304f},
-std::array<float,2>{0.528175116f, 0.65054065f},
-std::array<float,2>{0.271008402f, 0.442348838f},
-std::array<float,2>{0.958685815f, 0.0232698452f},
-std::array<float,2>{0.0920922309f, 0.965134978f},
-std::array<float,2>{0.759578168f, 0.774274886f},
-std::array<float,2>{0.146738231f, 0.146901637f},
-std::array<float,2>{0.72192663f, 0.330751777f},
-std::array<float,2>{0.396048307f, 0.601760626f},
-std::array<float,2>{0.635651886f, 0.911057711f},
-std::array<float,2>{0.437650949f, 0.104178414f},
-std::array<float,2>{0.861652613f, 0.402655512f},
-std::array<float,2>{0.197910234f, 0.726229191f},
-std::array<float,2>{0.887094557f, 0.510078073f},
-std::array<float,2>{0.035116449f, 0.279700577f},
-std::array<float,2>{0.578560948f, 0.226354271f},
-std::array<float,2>{0.337116063f, 0.873056293f},
-std::array<float,2>{0.71050477f, 0.577063799f},
-std::array<float,2>{0.416256964f, 0.355157614f},
-std::array<float,2>{0.805040777f, 0.180459499f},
-std::array<float,2>{0.185948521f, 0.786144555f},
-std::array<float,2>{0.975511968f, 0.981661022f},
-std::array<float,2>{0.11209207f, 0.0389409102f},
-std::array<float,2>{0.542562127f, 0.479656339f},
-std::array<float,2>{0.304409564f, 0.667774558f},
-std::array<float,2>{0.601982594f, 0.82417351f},
-std::array<float,2>{0.36727649f, 0.215314105f},
-std::array<float,2>{0.930119634f, 0.294068992f},
-std::array<float,2>{0.000567531679f, 0.544449985f},
-std::array<float,2>{0.816153824f, 0.71250999f},
-std::array<float,2>{0.219325826f, 0.409196377f},
-std::array<float,2>{0.663419306f, 0.0683453009f},
-std::array<float,2>{0.472729355f, 0.890648186f},
-std::array<float,2>{0.535031796f, 0.598395228f},
-std::array<float,2>{0.305664718f, 0.337727606f},
-std::array<float,2>{0.979509711f, 0.153831795f},
-std::array<float,2>{0.118141145f, 0.771750391f},
-std::array<float,2>{0.799743176f, 0.958702862f},
-std::array<float,2>{0.175731659f, 0.0255969334f},
-std::array<float,2>{0.718505979f, 0.452095628f},
-std::array<float,2>{0.40937072f, 0.647534311f},
-std::array<float,2>{0.665210605f, 0.864758372f},
-std::array<float,2>{0.477883071f, 0.227242678f},
-std::array<float,2>{0.823974371f, 0.266407311f},
-std::array<float,2>{0.231132597f, 0.500049829f},
-std::array<float,2>{0.923005521f, 0.731049478f},
-std::array<float,2>{0.0151172867f, 0.394633144f},
-std::array<float,2>{0.596776128f, 0.0955118909f},
-std::array<float,2>{0.362483442f, 0.91505301f},
-std::array<float,2>{0.727191687f, 0.657728314f},
-std::array<float,2>{0.399863094f, 0.470054209f},
-std::array<float,2>{0.756727457f, 0.0421787463f},
-std::array<float,2>{0.150949657f, 0.971143723f},
-std::array<float,2>{0.967611194f, 0.793034613f},
-std::array<float,2>{0.0792808011f, 0.17915228f},
-std::array<float,2>{0.521222949f, 0.347122103f},
-std::array<float,2>{0.274128586f, 0.569256365f},
-std::array<float,2>{0.58871156f, 0.900120199f},
-std::array<float,2>{0.329813629f, 0.0736855865f},
-std::array<float,2>{0.881976187f, 0.414180189f},
-std::array<float,2>{0.0417647026f, 0.707992852f},
-std::array<float,2>{0.872592926f, 0.535798788f},
-std::array<float,2>{0.188617036f, 0.284638584f},
-std::array<float,2>{0.626067519f, 0.203152925f},
-std::array<float,2>{0.448909134f, 0.818065941f},
-std::array<float,2>{0.61961931f, 0.702801406f},
-std::array<float,2>{0.357162625f, 0.430795193f},
-std::array<float,2>{0.918389261f, 0.0808197558f},
-std::array<float,2>{0.0278928466f, 0.877556026f},
-std::array<float,2>{0.835959792f, 0.833003044f},
-std::array<float,2>{0.243089184f, 0.191164196f},
-std::array<float,2>{0.675354123f, 0.297022134f},
-std::array<float,2>{0.484446526f, 0.554704487f},
-std::array<float,2>{0.700936913f, 0.994837582f},
-std::array<float,2>{0.426263601f, 0.0529650934f},
-std::array<float,2>{0.795458317f, 0.485155135f},
-std::array<float,2>{0.157938913f, 0.680031955f},
-std::array<float,2>{0.996002495f, 0.587847352f},
-std::array<float,2>{0.0960943922f, 0.367637843f},
-std::array<float,2>{0.5616467f, 0.168190777f},
-std::array<float,2>{0.296180367f, 0.811004281f},
-std::array<float,2>{0.650074661f, 0.519005477f},
-std::array<float,2>{0.45684725f, 0.254220247f},
-std::array<float,2>{0.849809349f, 0.241955578f},
-std::array<float,2>{0.205636352f, 0.848036528f},
-std::array<float,2>{0.901268899f, 0.934147239f},
-std::array<float,2>{0.05656901f, 0.114017211f},
-std::array<float,2>{0.572317362f, 0.383643776f},
-std::array<float,2>{0.323108733f, 0.735996664f},
-std::array<float,2>{0.501154184f, 0.75229001f},
-std::array<float,2>{0.255433172f, 0.133449465f},
-std::array<float,2>{0.951913476f, 0.320563793f},
-std::array<float,2>{0.0766776651f, 0.619878471f},
-std::array<float,2>{0.765955806f, 0.629449546f},
-std::array<float,2>{0.132408097f, 0.454043657f},
-std::array<float,2>{0.743721604f, 0.0130299516f},
-std::array<float,2>{0.378362298f, 0.942404509f},
-std::array<float,2>{0.514237463f, 0.507350087f},
-std::array<float,2>{0.264715523f, 0.272357613f},
-std::array<float,2>{0.943743706f, 0.231574357f},
-std::array<float,2>{0.0630098805f, 0.860497355f},
-std::array<float,2>{0.776734531f, 0.921754122f},
-std::array<float,2>{0.139911264f, 0.100425854f},
-std::array<float,2>{0.741856635f, 0.392799437f},
-std::array<float,2>{0.39019981f, 0.729034901f},
-std::array<float,2>{0.640814602f, 0.766684651f},
-std::array<float,2>{0.464217603f, 0.152065948f},
-std::array<float,2>{0.859194994f, 0.341189474f},
-std::array<float,2>{0.215796828f, 0.595658362f},
-std::array<float,2>{0.897457182f, 0.641358316f},
-std::array<float,2>{0.053927362f, 0.446856767f},
-std::array<float,2>{0.570107102f, 0.0273471586f},
-std::array<float,2>{0.320079654f, 0.956900954f},
-std::array<float,2>{0.695120096f, 0.703961551f},
-std::array<float,2>{0.432702601f, 0.421591729f},
-std::array<float,2>{0.784840584f, 0.0744818449f},
-std::array<float,2>{0.171830654f, 0.90306747f},
-std::array<float,2>{0.984568059f, 0.815827847f},
-std::array<float,2>{0.104386203f, 0.210340619f},
-std::array<float,2>{0.553882897f, 0.286989838f},
-std::array<float,2>{0.286352932f, 0.531798184f},
-std::array<float,2>{0.613524377f, 0.974605083f},
-std::array<float,2>{0.348744512f, 0.046211198f},
-std::array<float,2>{0.909793615f, 0.474909812f},
-std::array<float,2>{0.0177227613f, 0.6619277f},
-std::array<float,2>{0.829117596f, 0.563526571f},
-std::array<float,2>{0.239167988f, 0.350311071f},
-std::array<float,2>{0.686625004f, 0.172073931f},
-std::array<float,2>{0.494923979f, 0.790885687f},
-std::array<float,2>{0.582242548f, 0.685809493f},
-std::array<float,2>{0.341353178f, 0.489556581f},
-std::array<float,2>{0.883224487f, 0.0505063646f},
-std::array<float,2>{0.037927296f, 0.999468327f},
-std::array<float,2>{0.865907431f, 0.808153868f},
-std::array<float,2>{0.202947229f, 0.165265799f},
-std::array<float,2>{0.639105141f, 0.374145746f},
-std::array<float,2>{0.444125473f, 0.591767848f},
-std::array<float,2>{0.72421068f, 0.881235182f},
-std::array<float,2>{0.393970102f, 0.0848799646f},
-std::array<float,2>{0.763716161f, 0.436632067f},
-std::array<float,2>{0.142390937f, 0.696606994f},
-std::array<float,2>{0.955511093f, 0.561891198f},
-std::array<float,2>{0.0880965814f, 0.302868217f},
-std::array<float,2>{0.525343895f, 0.192102656f},
-std::array<float,2>{0.26650551f, 0.830921292f},
-std::array<float,2>{0.656387925f, 0.623450816f},
-std::array<float,2>{0.472033262f, 0.32743302f},
-std::array<float,2>{0.818511844f, 0.139477819f},
-std::array<float,2>{0.225040361f, 0.756252587f},
-std::array<float,2>{0.935969889f, 0.93848598f},
-std::array<float,2>{0.00716315163f, 0.00980391353f},
-std::array<float,2>{0.6071257f, 0.459658504f},
-std::array<float,2>{0.374714911f, 0.62530756f},
-std::array<float,2>{0.544304252f, 0.84659946f},
-std::array<float,2>{0.298903584f, 0.236395612f},
-std::array<float,2>{0.971452177f, 0.252704293f},
-std::array<float,2>{0.116346031f, 0.523352981f},
-std::array<float,2>{0.809203923f, 0.740529656f},
-std::array<float,2>{0.18034862f, 0.38909632f},
-std::array<float,2>{0.703947008f, 0.112430051f},
-std::array<float,2>{0.419725001f, 0.933195174f},
-std::array<float,2>{0.5987885f, 0.578339815f},
-std::array<float,2>{0.3657296f, 0.361339152f},
-std::array<float,2>{0.925815582f, 0.157558277f},
-std::array<float,2>{0.00904022064f, 0.801045358f},
-std::array<float,2>{0.825714886f, 0.984376907f},
-std::array<float,2>{0.229164094f, 0.0566144995f},
-std::array<float,2>{0.669593394f, 0.499910325f},
-std::array<float,2>{0.482208788f, 0.678383052f},
-std::array<float,2>{0.713067472f, 0.841579258f},
-std::array<float,2>{0.411196589f, 0.19671528f},
-std::array<float,2>{0.801130652f, 0.312454998f},
-std::array<float,2>{0.176313356f, 0.551991165f},
-std::array<float,2>{0.984038591f, 0.691199541f},
-std::array<float,2>{0.124055736f, 0.427848756f},
-std::array<float,2>{0.535727501f, 0.0894164741f},
-std::array<float,2>{0.310112119f, 0.885652781f},
-std::array<float,2>{0.630541682f, 0.640486658f},
-std::array<float,2>{0.452979654f, 0.462261349f},
-std::array<float,2>{0.868076324f, 0.00720517104f},
-std::array<float,2>{0.194209471f, 0.953054011f},
-std::array<float,2>{0.878726363f, 0.764990211f},
-std::array<float,2>{0.0460391976f, 0.126724124f},
-std::array<float,2>{0.592226326f, 0.319468021f},
-std::array<float,2>{0.333206147f, 0.614194632f},
-std::array<float,2>{0.518425047f, 0.929487646f},
-std::array<float,2>{0.278714597f, 0.119128928f},
-std::array<float,2>{0.962416351f, 0.382451326f},
-std::array<float,2>{0.0851405486f, 0.744490564f},
-std::array<float,2>{0.75268662f, 0.524475336f},
-std::array<float,2>{0.155061319f, 0.262681782f},
-std::array<float,2>{0.731529295f, 0.249625683f},
-std::array<float,2>{0.404426754f, 0.85234946f},
-std::array<float,2>{0.555891752f, 0.720268607f},
-std::array<float,2>{0.291184157f, 0.400149703f},
-std::array<float,2>{0.996352971f, 0.108989649f},
-std::array<float,2>{0.101516381f, 0.908233345f},
-std::array<float,2>{0.790787458f, 0.868377447f},
-std::array<float,2>{0.163162023f, 0.220936f},
-std::array<float,2>{0.697030723f, 0.276549846f},
-std::array<float,2>{0.425020874f, 0.512751043f},
-std::array<float,2>{0.67941916f, 0.963209689f},
-std::array<float,2>{0.488552094f, 0.0193831399f},
-std::array<float,2>{0.841419637f, 0.439402759f},
-std::array<float,2>{0.248875007f, 0.655608594f},
-std::array<float,2>{0.91415f, 0.607436299f},
-std::array<float,2>{0.0265826639f, 0.335562795f},
-std::array<float,2>{0.623759925f, 0.142148748f},
-std::array<float,2>{0.354438156f, 0.78115207f},
-std::array<float,2>{0.749041378f, 0.539987624f},
-std::array<float,2>{0.380686343f, 0.292347252f},
-std::array<float,2>{0.769980907f, 0.211643726f},
-std::array<float,2>{0.125026301f, 0.824456155f},
-std::array<float,2>{0.948894918f, 0.895374298f},
-std::array<float,2>{0.0726330057f, 0.063019976f},
-std::array<float,2>{0.504006803f, 0.413569897f},
-std::array<float,2>{0.252108812f, 0.717885554f},
-std::array<float,2>{0.576711833f, 0.784876406f},
-std::array<float,2>{0.325729609f, 0.186686054f},
-std::array<float,2>{0.904715538f, 0.35900864f},
-std::array<float,2>{0.0612476058f, 0.573727846f},
-std::array<float,2>{0.844851017f, 0.670357704f},
-std::array<float,2>{0.207497373f, 0.480542779f},
-std::array<float,2>{0.654262185f, 0.03381164f},
-std::array<float,2>{0.45786491f, 0.979556441f},
-std::array<float,2>{0.619108975f, 0.555208325f},
-std::array<float,2>{0.358094782f, 0.297820538f},
-std::array<float,2>{0.921546638f, 0.190521225f},
-std::array<float,2>{0.0312140211f, 0.832329392f},
-std::array<float,2>{0.838697731f, 0.877201915f},
-std::array<float,2>{0.245852068f, 0.0801102519f},
-std::array<float,2>{0.673127115f, 0.43132636f},
-std::array<float,2>{0.487087876f, 0.702456474f},
-std::array<float,2>{0.701777399f, 0.811445415f},
-std::array<float,2>{0.428022623f, 0.168775499f},
-std::array<float,2>{0.793193877f, 0.368140101f},
-std::array<float,2>{0.159952462f, 0.587021887f},
-std::array<float,2>{0.992628038f, 0.680395901f},
-std::array<float,2>{0.0950433612f, 0.48475194f},
-std::array<float,2>{0.559912682f, 0.0534641705f},
-std::array<float,2>{0.293195397f, 0.994576156f},
-std::array<float,2>{0.651897907f, 0.735514998f},
-std::array<float,2>{0.454013228f, 0.382925034f},
-std::array<float,2>{0.848060191f, 0.113631494f},
-std::array<float,2>{0.204741657f, 0.933967054f},
-std::array<float,2>{0.899317265f, 0.848560452f},
-std::array<float,2>{0.0577029847f, 0.241402552f},
-std::array<float,2>{0.570917308f, 0.254460841f},
-std::array<float,2>{0.321798801f, 0.519123375f},
-std::array<float,2>{0.503154516f, 0.943296731f},
-std::array<float,2>{0.256196797f, 0.0134050772f},
-std::array<float,2>{0.949742675f, 0.453227192f},
-std::array<float,2>{0.0752300471f, 0.629203796f},
-std::array<float,2>{0.768073261f, 0.619305551f},
-std::array<float,2>{0.130278245f, 0.321031064f},
-std::array<float,2>{0.744811893f, 0.133107364f},
-std::array<float,2>{0.37634784f, 0.752727807f},
-std::array<float,2>{0.532359183f, 0.64798069f},
-std::array<float,2>{0.307657301f, 0.451593846f},
-std::array<float,2>{0.978268683f, 0.0263175741f},
-std::array<float,2>{0.119553842f, 0.958210945f},
-std::array<float,2>{0.797485173f, 0.772408426f},
-std::array<float,2>{0.172712386f, 0.153778285f},
-std::array<float,2>{0.716142893f, 0.337057412f},
-std::array<float,2>{0.406760216f, 0.598024726f},
-std::array<float,2>{0.667696476f, 0.915888309f},
-std::array<float,2>{0.479022652f, 0.0949546546f},
-std::array<float,2>{0.821064115f, 0.395295024f},
-std::array<float,2>{0.234150037f, 0.730814874f},
-std::array<float,2>{0.925025761f, 0.500943661f},
-std::array<float,2>{0.0123656457f, 0.265816838f},
-std::array<float,2>{0.594686151f, 0.226943821f},
-std::array<float,2>{0.360236317f, 0.864679635f},
-std::array<float,2>{0.729616702f, 0.568585277f},
-std::array<float,2>{0.400637537f, 0.347290486f},
-std::array<float,2>{0.753969669f, 0.179436803f},
-std::array<float,2>{0.14947708f, 0.793590963f},
-std::array<float,2>{0.966492176f, 0.971252918f},
-std::array<float,2>{0.080452241f, 0.0429651476f},
-std::array<float,2>{0.522878945f, 0.470288277f},
-std::array<float,2>{0.275862038f, 0.657271385f},
-std::array<float,2>{0.586687922f, 0.817425013f},
-std::array<float,2>{0.33014974f, 0.203736559f},
-std::array<float,2>{0.880459905f, 0.284898579f},
-std::array<float,2>{0.0402190462f, 0.53516078f},
-std::array<float,2>{0.873081684f, 0.707434237f},
-std::array<float,2>{0.191406012f, 0.414572388f},
-std::array<float,2>{0.627516806f, 0.0738496184f},
-std::array<float,2>{0.44653663f, 0.899752975f},
-std::array<float,2>{0.530516088f, 0.602417469f},
-std::array<float,2>{0.271635532f, 0.330514014f},
-std::array<float,2>{0.959842443f, 0.147381946f},
-std::array<float,2>{0.0902395919f, 0.773559332f},
-std::array<float,2>{0.759952486f, 0.965357065f},
-std::array<float,2>{0.144884557f, 0.0226450488f},
-std::array<float,2>{0.719725728f, 0.441555172f},
-std::array<float,2>{0.397441357f, 0.65123558f},
-std::array<float,2>{0.633817554f, 0.873938859f},
-std::array<float,2>{0.440331995f, 0.225822955f},
-std::array<float,2>{0.860634327f, 0.279808462f},
-std::array<float,2>{0.196793064f, 0.510425925f},
-std::array<float,2>{0.889971316f, 0.725882649f},
-std::array<float,2>{0.0318465717f, 0.403158516f},
-std::array<float,2>{0.580214143f, 0.103690416f},
-std::array<float,2>{0.338894844f, 0.91061604f},
-std::array<float,2>{0.707215428f, 0.667422116f},
-std::array<float,2>{0.415317804f, 0.480237514f},
-std::array<float,2>{0.808512688f, 0.038480375f},
-std::array<float,2>{0.183710262f, 0.98216933f},
-std::array<float,2>{0.973825812f, 0.7868945f},
-std::array<float,2>{0.110026821f, 0.180119067f},
-std::array<float,2>{0.539539397f, 0.354573339f},
-std::array<float,2>{0.301449686f, 0.576569378f},
-std::array<float,2>{0.604001045f, 0.891481519f},
-std::array<float,2>{0.369590729f, 0.0674023852f},
-std::array<float,2>{0.932718575f, 0.409778953f},
-std::array<float,2>{0.00238822983f, 0.712141633f},
-std::array<float,2>{0.813694358f, 0.544273555f},
-std::array<float,2>{0.220840007f, 0.294762045f},
-std::array<float,2>{0.660359979f, 0.215796769f},
-std::array<float,2>{0.475836724f, 0.823295355f},
-std::array<float,2>{0.564422727f, 0.692487776f},
-std::array<float,2>{0.31444484f, 0.424690157f},
-std::array<float,2>{0.891268373f, 0.0916729495f},
-std::array<float,2>{0.0500855297f, 0.889576852f},
-std::array<float,2>{0.852770567f, 0.839289844f},
-std::array<float,2>{0.214169994f, 0.199628323f},
-std::array<float,2>{0.647717178f, 0.307110697f},
-std::array<float,2>{0.467888147f, 0.547329903f},
-std::array<float,2>{0.735159636f, 0.989258528f},
-std::array<float,2>{0.385774106f, 0.0617300235f},
-std::array<float,2>{0.777689636f, 0.493265569f},
-std::array<float,2>{0.133359775f, 0.674802721f},
-std::array<float,2>{0.940803885f, 0.585687518f},
-std::array<float,2>{0.0679864883f, 0.363854289f},
-std::array<float,2>{0.50933212f, 0.164053798f},
-std::array<float,2>{0.258066297f, 0.797729254f},
-std::array<float,2>{0.683298886f, 0.529789686f},
-std::array<float,2>{0.496359617f, 0.259477049f},
-std::array<float,2>{0.833848059f, 0.24410969f},
-std::array<float,2>{0.23759611f, 0.857323587f},
-std::array<float,2>{0.913516939f, 0.925364137f},
-std::array<float,2>{0.020269854f, 0.124290839f},
-std::array<float,2>{0.609867036f, 0.37879172f},
-std::array<float,2>{0.344344646f, 0.747628868f},
-std::array<float,2>{0.548729241f, 0.760376155f},
-std::array<float,2>{0.283466339f, 0.132399619f},
-std::array<float,2>{0.989187241f, 0.312896907f},
-std::array<float,2>{0.107311428f, 0.610988617f},
-std::array<float,2>{0.785281956f, 0.632973969f},
-std::array<float,2>{0.167778105f, 0.465707392f},
-std::array<float,2>{0.688133121f, 0.00132924528f},
-std::array<float,2>{0.436678857f, 0.946993887f},
-std::array<float,2>{0.557274163f, 0.513601482f},
-std::array<float,2>{0.289725512f, 0.276934892f},
-std::array<float,2>{0.998966694f, 0.221678719f},
-std::array<float,2>{0.0981985256f, 0.868975043f},
-std::array<float,2>{0.79103303f, 0.90875268f},
-std::array<float,2>{0.160391897f, 0.108676828f},
-std::array<float,2>{0.699157715f, 0.399841577f},
-std::array<float,2>{0.422245234f, 0.720048368f},
-std::array<float,2>{0.676586688f, 0.780702233f},
-std::array<float,2>{0.490685284f, 0.142056659f},
-std::array<float,2>{0.842212498f, 0.335356295f},
-std::array<float,2>{0.246217012f, 0.608043194f},
-std::array<float,2>{0.916998684f, 0.656089664f},
-std::array<float,2>{0.0251024831f, 0.438645422f},
-std::array<float,2>{0.621583402f, 0.0190210193f},
-std::array<float,2>{0.353395343f, 0.963647246f},
-std::array<float,2>{0.747655213f, 0.718491614f},
-std::array<float,2>{0.381264061f, 0.413616717f},
-std::array<float,2>{0.772969484f, 0.062881723f},
-std::array<float,2>{0.128277093f, 0.894830108f},
-std::array<float,2>{0.945607901f, 0.824987948f},
-std::array<float,2>{0.0716308877f, 0.211198702f},
-std::array<float,2>{0.507081985f, 0.292694986f},
-std::array<float,2>{0.250654191f, 0.539473772f},
-std::array<float,2>{0.575823367f, 0.980370641f},
-std::array<float,2>{0.327894419f, 0.0333445296f},
-std::array<float,2>{0.902411163f, 0.481345892f},
-std::array<float,2>{0.0602207556f, 0.670757473f},
-std::array<float,2>{0.846844673f, 0.573934078f},
-std::array<float,2>{0.210902616f, 0.358882487f},
-std::array<float,2>{0.654712617f, 0.187298089f},
-std::array<float,2>{0.460481703f, 0.784346938f},
-std::array<float,2>{0.600214124f, 0.67820245f},
-std::array<float,2>{0.364276588f, 0.499403119f},
-std::array<float,2>{0.928070307f, 0.0558837987f},
-std::array<float,2>{0.0110376067f, 0.985244513f},
-std::array<float,2>{0.82654798f, 0.80171591f},
-std::array<float,2>{0.22700575f, 0.157884777f},
-std::array<float,2>{0.67057544f, 0.362039506f},
-std::array<float,2>{0.483807623f, 0.578935504f},
-std::array<float,2>{0.712401092f, 0.885010123f},
-std::array<float,2>{0.41226697f, 0.0889259428f},
-std::array<float,2>{0.804267228f, 0.428445309f},
-std::array<float,2>{0.179275289f, 0.690477312f},
-std::array<float,2>{0.982213616f, 0.552466214f},
-std::array<float,2>{0.122530229f, 0.311630219f},
-std::array<float,2>{0.538478553f, 0.197184339f},
-std::array<float,2>{0.311017245f, 0.840858042f},
-std::array<float,2>{0.632607758f, 0.613309264f},
-std::array<float,2>{0.449642032f, 0.320279717f},
-std::array<float,2>{0.869970083f, 0.126108646f},
-std::array<float,2>{0.19182694f, 0.765361011f},
-std::array<float,2>{0.876934052f, 0.952479482f},
-std::array<float,2>{0.0431368165f, 0.00774445478f},
-std::array<float,2>{0.591460049f, 0.462761521f},
-std::array<float,2>{0.335194945f, 0.64002037f},
-std::array<float,2>{0.516719699f, 0.851873875f},
-std::array<float,2>{0.280621022f, 0.249406993f},
-std::array<float,2>{0.963009238f, 0.262086898f},
-std::array<float,2>{0.0827847645f, 0.524926126f},
-std::array<float,2>{0.750013947f, 0.745006204f},
-std::array<float,2>{0.153336465f, 0.382033765f},
-std::array<float,2>{0.733373284f, 0.118190028f},
-std::array<float,2>{0.402686447f, 0.928762019f},
-std::array<float,2>{0.585616708f, 0.591290951f},
-std::array<float,2>{0.342933208f, 0.374679357f},
-std::array<float,2>{0.886331201f, 0.165880278f},
-std::array<float,2>{0.0364636146f, 0.807829082f},
-std::array<float,2>{0.864368558f, 0.999689519f},
-std::array<float,2>{0.20110245f, 0.0501983389f},
-std::array<float,2>{0.638349891f, 0.489949465f},
-std::array<float,2>{0.443118811f, 0.686230421f},
-std::array<float,2>{0.726106405f, 0.830333352f},
-std::array<float,2>{0.391427368f, 0.191781223f},
-std::array<float,2>{0.763454616f, 0.303508729f},
-std::array<float,2>{0.1433817f, 0.56245923f},
-std::array<float,2>{0.953267753f, 0.697196066f},
-std::array<float,2>{0.0875652507f, 0.437250227f},
-std::array<float,2>{0.527175426f, 0.0840131491f},
-std::array<float,2>{0.267807305f, 0.881615162f},
-std::array<float,2>{0.659536242f, 0.625907481f},
-std::array<float,2>{0.470487356f, 0.459254652f},
-std::array<float,2>{0.817698777f, 0.0103065558f},
-std::array<float,2>{0.223729968f, 0.939350903f},
-std::array<float,2>{0.934939206f, 0.756636441f},
-std::array<float,2>{0.0048738881f, 0.138681501f},
-std::array<float,2>{0.608800292f, 0.328025073f},
-std::array<float,2>{0.372976214f, 0.623926699f},
-std::array<float,2>{0.546819508f, 0.932786942f},
-std::array<float,2>{0.297057092f, 0.112873688f},
-std::array<float,2>{0.97061342f, 0.389282107f},
-std::array<float,2>{0.115228854f, 0.741071701f},
-std::array<float,2>{0.811876893f, 0.522843301f},
-std::array<float,2>{0.182492942f, 0.252371311f},
-std::array<float,2>{0.705772161f, 0.236894891f},
-std::array<float,2>{0.421815485f, 0.846125305f},
-std::array<float,2>{0.513127625f, 0.728758156f},
-std::array<float,2>{0.263221711f, 0.393071353f},
-std::array<float,2>{0.942211926f, 0.10009288f},
-std::array<float,2>{0.0662768781f, 0.921211004f},
-std::array<float,2>{0.773438036f, 0.861185491f},
-std::array<float,2>{0.138365135f, 0.232063204f},
-std::array<float,2>{0.740221858f, 0.271676838f},
-std::array<float,2>{0.388446301f, 0.506999612f},
-std::array<float,2>{0.64447093f, 0.956290603f},
-std::array<float,2>{0.462091774f, 0.0281529613f},
-std::array<float,2>{0.857258558f, 0.446654081f},
-std::array<float,2>{0.216822177f, 0.640928566f},
-std::array<float,2>{0.896295547f, 0.59499073f},
-std::array<float,2>{0.0517938584f, 0.3417916f},
-std::array<float,2>{0.567449093f, 0.151523158f},
-std::array<float,2>{0.317357868f, 0.767215371f},
-std::array<float,2>{0.692858577f, 0.531695485f},
-std::array<float,2>{0.431355894f, 0.28628248f},
-std::array<float,2>{0.782637239f, 0.210788026f},
-std::array<float,2>{0.168419853f, 0.816255867f},
-std::array<float,2>{0.98727423f, 0.902803302f},
-std::array<float,2>{0.101631165f, 0.0750578567f},
-std::array<float,2>{0.552137256f, 0.421279132f},
-std::array<float,2>{0.287986189f, 0.703607738f},
-std::array<float,2>{0.616141498f, 0.790504277f},
-std::array<float,2>{0.349638313f, 0.172791749f},
-std::array<float,2>{0.907886863f, 0.349822849f},
-std::array<float,2>{0.016818637f, 0.564077079f},
-std::array<float,2>{0.831151128f, 0.661226034f},
-std::array<float,2>{0.240504816f, 0.475161999f},
-std::array<float,2>{0.683872283f, 0.0466995127f},
-std::array<float,2>{0.493214518f, 0.973807454f},
-std::array<float,2>{0.572890759f, 0.516329467f},
-std::array<float,2>{0.322494119f, 0.257184565f},
-std::array<float,2>{0.900637805f, 0.240095541f},
-std::array<float,2>{0.055740349f, 0.850797594f},
-std::array<float,2>{0.850429654f, 0.93568188f},
-std::array<float,2>{0.205153063f, 0.115992203f},
-std::array<float,2>{0.649739742f, 0.386566997f},
-std::array<float,2>{0.456121206f, 0.737630785f},
-std::array<float,2>{0.743468821f, 0.751301169f},
-std::array<float,2>{0.378765613f, 0.135247827f},
-std::array<float,2>{0.766120911f, 0.323554695f},
-std::array<float,2>{0.13203834f, 0.618601263f},
-std::array<float,2>{0.951479077f, 0.632041454f},
-std::array<float,2>{0.0763807595f, 0.455961108f},
-std::array<float,2>{0.501814783f, 0.0154920537f},
-std::array<float,2>{0.255213439f, 0.944661558f},
-std::array<float,2>{0.675277233f, 0.700610876f},
-std::array<float,2>{0.485172898f, 0.433418304f},
-std::array<float,2>{0.836647391f, 0.0784220099f},
-std::array<float,2>{0.242452741f, 0.875744522f},
-std::array<float,2>{0.918870151f, 0.835417449f},
-std::array<float,2>{0.0275506023f, 0.188615412f},
-std::array<float,2>{0.620085895f, 0.300250649f},
-std::array<float,2>{0.356459081f, 0.557527781f},
-std::array<float,2>{0.562234581f, 0.993795156f},
-std::array<float,2>{0.296515971f, 0.0515598431f},
-std::array<float,2>{0.995402932f, 0.487351686f},
-std::array<float,2>{0.0963562801f, 0.682156146f},
-std::array<float,2>{0.795329571f, 0.588820815f},
-std::array<float,2>{0.157405615f, 0.370806664f},
-std::array<float,2>{0.700409591f, 0.169999897f},
-std::array<float,2>{0.426717252f, 0.808678329f},
-std::array<float,2>{0.520875573f, 0.658726156f},
-std::array<float,2>{0.273729384f, 0.471462339f},
-std::array<float,2>{0.967036009f, 0.0401830226f},
-std::array<float,2>{0.0796297565f, 0.969956875f},
-std::array<float,2>{0.755875945f, 0.796238959f},
-std::array<float,2>{0.150791809f, 0.176780581f},
-std::array<float,2>{0.72678262f, 0.344321102f},
-std::array<float,2>{0.400190115f, 0.567909837f},
-std::array<float,2>{0.626817822f, 0.901131988f},
-std::array<float,2>{0.448282123f, 0.0718123466f},
-std::array<float,2>{0.872545123f, 0.417271882f},
-std::array<float,2>{0.188990742f, 0.710175633f},
-std::array<float,2>{0.882361531f, 0.538533688f},
-std::array<float,2>{0.0410969183f, 0.282143027f},
-std::array<float,2>{0.587959826f, 0.205208719f},
-std::array<float,2>{0.329223275f, 0.819712341f},
-std::array<float,2>{0.717984319f, 0.600693047f},
-std::array<float,2>{0.409722209f, 0.338185221f},
-std::array<float,2>{0.799062312f, 0.15602994f},
-std::array<float,2>{0.174879044f, 0.769748688f},
-std::array<float,2>{0.980007708f, 0.960371077f},
-std::array<float,2>{0.117611013f, 0.0252356492f},
-std::array<float,2>{0.534276724f, 0.450499892f},
-std::array<float,2>{0.306208938f, 0.645929694f},
-std::array<float,2>{0.597249687f, 0.866528809f},
-std::array<float,2>{0.363244265f, 0.228640556f},
-std::array<float,2>{0.923463702f, 0.268287539f},
-std::array<float,2>{0.0152603146f, 0.50256449f},
-std::array<float,2>{0.823677838f, 0.733170569f},
-std::array<float,2>{0.230734408f, 0.397733927f},
-std::array<float,2>{0.665754676f, 0.0971665606f},
-std::array<float,2>{0.478391498f, 0.917512357f},
-std::array<float,2>{0.542305708f, 0.575492501f},
-std::array<float,2>{0.304159552f, 0.352087706f},
-std::array<float,2>{0.974965096f, 0.181824818f},
-std::array<float,2>{0.111642882f, 0.787562191f},
-std::array<float,2>{0.805432916f, 0.983731568f},
-std::array<float,2>{0.186471865f, 0.0356814712f},
-std::array<float,2>{0.71032691f, 0.477744013f},
-std::array<float,2>{0.416712999f, 0.665983021f},
-std::array<float,2>{0.663850605f, 0.820597053f},
-std::array<float,2>{0.47342208f, 0.216926962f},
-std::array<float,2>{0.815584779f, 0.296759546f},
-std::array<float,2>{0.219124183f, 0.545943081f},
-std::array<float,2>{0.930609643f, 0.713865042f},
-std::array<float,2>{0.000378055149f, 0.406302661f},
-std::array<float,2>{0.60241586f, 0.0683847815f},
-std::array<float,2>{0.36779204f, 0.893148482f},
-std::array<float,2>{0.722357333f, 0.64975059f},
-std::array<float,2>{0.395528942f, 0.443745762f},
-std::array<float,2>{0.758793533f, 0.0201131515f},
-std::array<float,2>{0.147041693f, 0.967729032f},
-std::array<float,2>{0.958231032f, 0.775868416f},
-std::array<float,2>{0.0926834792f, 0.14460817f},
-std::array<float,2>{0.527756631f, 0.32985726f},
-std::array<float,2>{0.270528316f, 0.604123235f},
-std::array<float,2>{0.578953385f, 0.913591444f},
-std::array<float,2>{0.337664902f, 0.102091648f},
-std::array<float,2>{0.887229204f, 0.405741394f},
-std::array<float,2>{0.0342727788f, 0.72392875f},
-std::array<float,2>{0.862026215f, 0.509686112f},
-std::array<float,2>{0.19764404f, 0.277739644f},
-std::array<float,2>{0.635139048f, 0.223949015f},
-std::array<float,2>{0.438014388f, 0.872964323f},
-std::array<float,2>{0.613086879f, 0.748306453f},
-std::array<float,2>{0.346406579f, 0.375703782f},
-std::array<float,2>{0.910278022f, 0.122222699f},
-std::array<float,2>{0.023407137f, 0.923002541f},
-std::array<float,2>{0.835799277f, 0.858678758f},
-std::array<float,2>{0.235395715f, 0.244839981f},
-std::array<float,2>{0.679888427f, 0.261691421f},
-std::array<float,2>{0.499721944f, 0.52830565f},
-std::array<float,2>{0.690043211f, 0.948964059f},
-std::array<float,2>{0.434168369f, 0.00201002602f},
-std::array<float,2>{0.787270129f, 0.466871142f},
-std::array<float,2>{0.165408775f, 0.634912491f},
-std::array<float,2>{0.990455449f, 0.613263547f},
-std::array<float,2>{0.108283021f, 0.315995485f},
-std::array<float,2>{0.550519586f, 0.130591109f},
-std::array<float,2>{0.281345367f, 0.758356988f},
-std::array<float,2>{0.644726038f, 0.549575686f},
-std::array<float,2>{0.466081113f, 0.305428743f},
-std::array<float,2>{0.854814887f, 0.203123599f},
-std::array<float,2>{0.211642802f, 0.836288154f},
-std::array<float,2>{0.893568337f, 0.886838198f},
-std::array<float,2>{0.0479463078f, 0.0932046324f},
-std::array<float,2>{0.565418005f, 0.423185796f},
-std::array<float,2>{0.314881086f, 0.694499373f},
-std::array<float,2>{0.510443509f, 0.799336314f},
-std::array<float,2>{0.261052042f, 0.16062519f},
-std::array<float,2>{0.938853025f, 0.366948664f},
-std::array<float,2>{0.0688680261f, 0.583007753f},
-std::array<float,2>{0.780809343f, 0.673582852f},
-std::array<float,2>{0.135800377f, 0.495170295f},
-std::array<float,2>{0.738012731f, 0.0586208329f},
-std::array<float,2>{0.383736432f, 0.991965532f},
-std::array<float,2>{0.504669785f, 0.541225851f},
-std::array<float,2>{0.252483577f, 0.289403558f},
-std::array<float,2>{0.948256493f, 0.213068381f},
-std::array<float,2>{0.0729431659f, 0.827945113f},
-std::array<float,2>{0.770383477f, 0.897537351f},
-std::array<float,2>{0.125638887f, 0.0661876574f},
-std::array<float,2>{0.749700189f, 0.410378426f},
-std::array<float,2>{0.380008966f, 0.71523571f},
-std::array<float,2>{0.653500438f, 0.781690896f},
-std::array<float,2>{0.457326561f, 0.184434026f},
-std::array<float,2>{0.845231712f, 0.356765807f},
-std::array<float,2>{0.207856283f, 0.570354819f},
-std::array<float,2>{0.905249357f, 0.668653131f},
-std::array<float,2>{0.0609017648f, 0.483772039f},
-std::array<float,2>{0.576535225f, 0.0330395177f},
-std::array<float,2>{0.325609952f, 0.976590037f},
-std::array<float,2>{0.696353436f, 0.722652793f},
-std::array<float,2>{0.425391734f, 0.40122667f},
-std::array<float,2>{0.790473282f, 0.107320629f},
-std::array<float,2>{0.163907975f, 0.907207131f},
-std::array<float,2>{0.997003853f, 0.869721889f},
-std::array<float,2>{0.100818262f, 0.219821066f},
-std::array<float,2>{0.55619812f, 0.273750365f},
-std::array<float,2>{0.291627914f, 0.515137911f},
-std::array<float,2>{0.623060405f, 0.96183455f},
-std::array<float,2>{0.353794605f, 0.0157962665f},
-std::array<float,2>{0.914640307f, 0.441334993f},
-std::array<float,2>{0.0270425696f, 0.654260695f},
-std::array<float,2>{0.841194272f, 0.606067836f},
-std::array<float,2>{0.248095915f, 0.332995147f},
-std::array<float,2>{0.678997576f, 0.142777994f},
-std::array<float,2>{0.489142329f, 0.777828991f},
-std::array<float,2>{0.592749894f, 0.638483942f},
-std::array<float,2>{0.333693534f, 0.464727432f},
-std::array<float,2>{0.878217399f, 0.00556202093f},
-std::array<float,2>{0.0467319489f, 0.949618757f},
-std::array<float,2>{0.867309213f, 0.762144804f},
-std::array<float,2>{0.19380638f, 0.127185643f},
-std::array<float,2>{0.630346715f, 0.317631334f},
-std::array<float,2>{0.452328861f, 0.615300953f},
-std::array<float,2>{0.732070446f, 0.926060557f},
-std::array<float,2>{0.405006886f, 0.120978445f},
-std::array<float,2>{0.752020061f, 0.380087048f},
-std::array<float,2>{0.154361293f, 0.743191183f},
-std::array<float,2>{0.962193251f, 0.52672267f},
-std::array<float,2>{0.0856570378f, 0.265125006f},
-std::array<float,2>{0.517924786f, 0.246580288f},
-std::array<float,2>{0.279142857f, 0.854391336f},
-std::array<float,2>{0.669026256f, 0.581644058f},
-std::array<float,2>{0.481738299f, 0.359731048f},
-std::array<float,2>{0.825205266f, 0.15861468f},
-std::array<float,2>{0.228669733f, 0.802922785f},
-std::array<float,2>{0.926432073f, 0.987852454f},
-std::array<float,2>{0.00927916449f, 0.0582808368f},
-std::array<float,2>{0.599176586f, 0.497274071f},
-std::array<float,2>{0.365483969f, 0.676375508f},
-std::array<float,2>{0.535639942f, 0.842607737f},
-std::array<float,2>{0.309941143f, 0.197575182f},
-std::array<float,2>{0.983543634f, 0.309020877f},
-std::array<float,2>{0.124515571f, 0.554436088f},
-std::array<float,2>{0.801701546f, 0.689123929f},
-std::array<float,2>{0.175831065f, 0.426459134f},
-std::array<float,2>{0.713768184f, 0.0866162404f},
-std::array<float,2>{0.412089467f, 0.883168221f},
-std::array<float,2>{0.606614292f, 0.622671425f},
-std::array<float,2>{0.37406975f, 0.324682683f},
-std::array<float,2>{0.936475575f, 0.138571575f},
-std::array<float,2>{0.00757997157f, 0.753955126f},
-std::array<float,2>{0.819155097f, 0.941155195f},
-std::array<float,2>{0.225162357f, 0.00891632587f},
-std::array<float,2>{0.657179117f, 0.458408177f},
-std::array<float,2>{0.472263783f, 0.626963615f},
-std::array<float,2>{0.703296244f, 0.845332205f},
-std::array<float,2>{0.419160575f, 0.23453705f},
-std::array<float,2>{0.809037209f, 0.251523167f},
-std::array<float,2>{0.179808706f, 0.519961894f},
-std::array<float,2>{0.970800579f, 0.739245832f},
-std::array<float,2>{0.116897821f, 0.38755089f},
-std::array<float,2>{0.54456383f, 0.110654935f},
-std::array<float,2>{0.299732327f, 0.931313753f},
-std::array<float,2>{0.63955611f, 0.68452692f},
-std::array<float,2>{0.443425268f, 0.490859538f},
-std::array<float,2>{0.865320504f, 0.0483696088f},
-std::array<float,2>{0.202420205f, 0.997789621f},
-std::array<float,2>{0.883682132f, 0.805383146f},
-std::array<float,2>{0.03722056f, 0.16740407f},
-std::array<float,2>{0.5825966f, 0.37166965f},
-std::array<float,2>{0.341242582f, 0.592402041f},
-std::array<float,2>{0.524562716f, 0.879954576f},
-std::array<float,2>{0.265632629f, 0.0825789124f},
-std::array<float,2>{0.956020355f, 0.434954613f},
-std::array<float,2>{0.0888062939f, 0.697310328f},
-std::array<float,2>{0.764550328f, 0.558711708f},
-std::array<float,2>{0.142070979f, 0.301837713f},
-std::array<float,2>{0.723798454f, 0.193693593f},
-std::array<float,2>{0.394438058f, 0.828558266f},
-std::array<float,2>{0.55434823f, 0.706998587f},
-std::array<float,2>{0.286676258f, 0.418759197f},
-std::array<float,2>{0.98515141f, 0.0762403831f},
-std::array<float,2>{0.103520088f, 0.904813707f},
-std::array<float,2>{0.784506857f, 0.81402272f},
-std::array<float,2>{0.170904696f, 0.208932862f},
-std::array<float,2>{0.694420993f, 0.288068324f},
-std::array<float,2>{0.433256358f, 0.534638822f},
-std::array<float,2>{0.687069654f, 0.975644648f},
-std::array<float,2>{0.494268149f, 0.0432391092f},
-std::array<float,2>{0.830003202f, 0.473026365f},
-std::array<float,2>{0.238548577f, 0.66349566f},
-std::array<float,2>{0.909606099f, 0.5661906f},
-std::array<float,2>{0.0185274649f, 0.349568039f},
-std::array<float,2>{0.61410135f, 0.174349606f},
-std::array<float,2>{0.349373251f, 0.792058825f},
-std::array<float,2>{0.741697967f, 0.504672408f},
-std::array<float,2>{0.390003413f, 0.271415651f},
-std::array<float,2>{0.776860952f, 0.23252055f},
-std::array<float,2>{0.140258074f, 0.862059593f},
-std::array<float,2>{0.944145858f, 0.918187916f},
-std::array<float,2>{0.0625875071f, 0.097941041f},
-std::array<float,2>{0.514091432f, 0.391597837f},
-std::array<float,2>{0.265258908f, 0.727475762f},
-std::array<float,2>{0.569345593f, 0.768271029f},
-std::array<float,2>{0.319342166f, 0.148477823f},
-std::array<float,2>{0.89689213f, 0.343621552f},
-std::array<float,2>{0.0542197116f, 0.597029209f},
-std::array<float,2>{0.858752072f, 0.64352262f},
-std::array<float,2>{0.214895234f, 0.448817044f},
-std::array<float,2>{0.641435981f, 0.0302077234f},
-std::array<float,2>{0.4645859f, 0.953197896f},
-std::array<float,2>{0.594865084f, 0.503289282f},
-std::array<float,2>{0.361165851f, 0.268853754f},
-std::array<float,2>{0.924438119f, 0.230399877f},
-std::array<float,2>{0.012995597f, 0.865629137f},
-std::array<float,2>{0.821308076f, 0.916114867f},
-std::array<float,2>{0.23319231f, 0.0957629085f},
-std::array<float,2>{0.666171491f, 0.396601349f},
-std::array<float,2>{0.480360955f, 0.734299242f},
-std::array<float,2>{0.715341747f, 0.770519137f},
-std::array<float,2>{0.4075194f, 0.155066624f},
-std::array<float,2>{0.79851681f, 0.339387149f},
-std::array<float,2>{0.172877401f, 0.599634588f},
-std::array<float,2>{0.976801813f, 0.645471513f},
-std::array<float,2>{0.120356739f, 0.44940266f},
-std::array<float,2>{0.532049179f, 0.024119053f},
-std::array<float,2>{0.307021499f, 0.959509194f},
-std::array<float,2>{0.628453195f, 0.70966655f},
-std::array<float,2>{0.445756048f, 0.416084886f},
-std::array<float,2>{0.874512076f, 0.0706500784f},
-std::array<float,2>{0.189966053f, 0.901747286f},
-std::array<float,2>{0.87956953f, 0.818985403f},
-std::array<float,2>{0.0397231467f, 0.206894636f},
-std::array<float,2>{0.587746561f, 0.282699406f},
-std::array<float,2>{0.331628054f, 0.538051367f},
-std::array<float,2>{0.522174716f, 0.969470561f},
-std::array<float,2>{0.277273178f, 0.0396536402f},
-std::array<float,2>{0.964882016f, 0.472552717f},
-std::array<float,2>{0.0818216577f, 0.659876108f},
-std::array<float,2>{0.755343676f, 0.567117691f},
-std::array<float,2>{0.149238616f, 0.345678002f},
-std::array<float,2>{0.728655219f, 0.176294744f},
-std::array<float,2>{0.402264774f, 0.795669854f},
-std::array<float,2>{0.559046388f, 0.683362246f},
-std::array<float,2>{0.2945382f, 0.486555696f},
-std::array<float,2>{0.99321723f, 0.0521642938f},
-std::array<float,2>{0.094189845f, 0.99283427f},
-std::array<float,2>{0.794056535f, 0.809881508f},
-std::array<float,2>{0.158736199f, 0.171687096f},
-std::array<float,2>{0.702650309f, 0.369199216f},
-std::array<float,2>{0.428775251f, 0.588882983f},
-std::array<float,2>{0.672426462f, 0.876649261f},
-std::array<float,2>{0.487769455f, 0.0794133916f},
-std::array<float,2>{0.839528084f, 0.432376236f},
-std::array<float,2>{0.244784862f, 0.700006008f},
-std::array<float,2>{0.920086324f, 0.557650924f},
-std::array<float,2>{0.0295051187f, 0.299706876f},
-std::array<float,2>{0.617278993f, 0.188196778f},
-std::array<float,2>{0.359035522f, 0.834373415f},
-std::array<float,2>{0.745947361f, 0.617625713f},
-std::array<float,2>{0.375231862f, 0.322969943f},
-std::array<float,2>{0.769416928f, 0.136252716f},
-std::array<float,2>{0.129240483f, 0.750581503f},
-std::array<float,2>{0.950573206f, 0.944139719f},
-std::array<float,2>{0.0742358789f, 0.0137960268f},
-std::array<float,2>{0.502614558f, 0.456781507f},
-std::array<float,2>{0.257340699f, 0.631276071f},
-std::array<float,2>{0.57200563f, 0.850206554f},
-std::array<float,2>{0.320807606f, 0.238761693f},
-std::array<float,2>{0.900210917f, 0.256301105f},
-std::array<float,2>{0.0572287664f, 0.516708851f},
-std::array<float,2>{0.849203527f, 0.736919284f},
-std::array<float,2>{0.203454986f, 0.385115534f},
-std::array<float,2>{0.65136224f, 0.116722122f},
-std::array<float,2>{0.454700083f, 0.936966062f},
-std::array<float,2>{0.508416235f, 0.58356142f},
-std::array<float,2>{0.258790076f, 0.36577791f},
-std::array<float,2>{0.939910829f, 0.161760107f},
-std::array<float,2>{0.0670052096f, 0.800358772f},
-std::array<float,2>{0.778326392f, 0.990882099f},
-std::array<float,2>{0.134358242f, 0.0598053932f},
-std::array<float,2>{0.735871911f, 0.494623303f},
-std::array<float,2>{0.38548249f, 0.671878874f},
-std::array<float,2>{0.646637142f, 0.83697468f},
-std::array<float,2>{0.467209518f, 0.20206362f},
-std::array<float,2>{0.851788819f, 0.305804849f},
-std::array<float,2>{0.213479444f, 0.550243974f},
-std::array<float,2>{0.892479718f, 0.694096744f},
-std::array<float,2>{0.0493319519f, 0.422552258f},
-std::array<float,2>{0.562656283f, 0.0919574574f},
-std::array<float,2>{0.313360512f, 0.888618767f},
-std::array<float,2>{0.689121842f, 0.63587743f},
-std::array<float,2>{0.436277807f, 0.468659192f},
-std::array<float,2>{0.786423564f, 0.00379709946f},
-std::array<float,2>{0.166053176f, 0.947386146f},
-std::array<float,2>{0.990209639f, 0.759286821f},
-std::array<float,2>{0.106115483f, 0.128952056f},
-std::array<float,2>{0.5477283f, 0.315130055f},
-std::array<float,2>{0.284316599f, 0.612287879f},
-std::array<float,2>{0.611151874f, 0.921972156f},
-std::array<float,2>{0.345074713f, 0.121678457f},
-std::array<float,2>{0.912216365f, 0.376655936f},
-std::array<float,2>{0.0208091252f, 0.74941051f},
-std::array<float,2>{0.832876325f, 0.52896744f},
-std::array<float,2>{0.23668623f, 0.260078132f},
-std::array<float,2>{0.682196319f, 0.245400742f},
-std::array<float,2>{0.497109681f, 0.858362556f},
-std::array<float,2>{0.581500292f, 0.722968459f},
-std::array<float,2>{0.338659704f, 0.404669076f},
-std::array<float,2>{0.889542043f, 0.102934308f},
-std::array<float,2>{0.0323045515f, 0.912625849f},
-std::array<float,2>{0.859893918f, 0.871900201f},
-std::array<float,2>{0.195917144f, 0.22303611f},
-std::array<float,2>{0.633775651f, 0.279006541f},
-std::array<float,2>{0.440871656f, 0.507984877f},
-std::array<float,2>{0.720314324f, 0.968527615f},
-std::array<float,2>{0.397828728f, 0.0210906435f},
-std::array<float,2>{0.760794818f, 0.445222318f},
-std::array<float,2>{0.145587519f, 0.649095953f},
-std::array<float,2>{0.960417271f, 0.605437636f},
-std::array<float,2>{0.0910514891f, 0.328698963f},
-std::array<float,2>{0.529327035f, 0.146429464f},
-std::array<float,2>{0.272758871f, 0.776549041f},
-std::array<float,2>{0.66197449f, 0.545104742f},
-std::array<float,2>{0.47480461f, 0.295443803f},
-std::array<float,2>{0.813286126f, 0.218642071f},
-std::array<float,2>{0.222021207f, 0.821297884f},
-std::array<float,2>{0.932081103f, 0.894496024f},
-std::array<float,2>{0.00295428466f, 0.069466196f},
-std::array<float,2>{0.605000615f, 0.407266974f},
-std::array<float,2>{0.370389432f, 0.714168251f},
-std::array<float,2>{0.540849984f, 0.788496375f},
-std::array<float,2>{0.302555799f, 0.183583021f},
-std::array<float,2>{0.973247349f, 0.353122622f},
-std::array<float,2>{0.11083778f, 0.574756324f},
-std::array<float,2>{0.807068408f, 0.664651752f},
-std::array<float,2>{0.185306638f, 0.477057636f},
-std::array<float,2>{0.708601832f, 0.0368427075f},
-std::array<float,2>{0.414574414f, 0.982855022f},
-std::array<float,2>{0.537240863f, 0.553573608f},
-std::array<float,2>{0.312235087f, 0.310475796f},
-std::array<float,2>{0.980615854f, 0.19920963f},
-std::array<float,2>{0.121444367f, 0.843239546f},
-std::array<float,2>{0.803026736f, 0.884705067f},
-std::array<float,2>{0.178050876f, 0.0877995938f},
-std::array<float,2>{0.710948706f, 0.427522838f},
-std::array<float,2>{0.413316071f, 0.68769592f},
-std::array<float,2>{0.671671987f, 0.804236591f},
-std::array<float,2>{0.48248294f, 0.159220859f},
-std::array<float,2>{0.827422321f, 0.360560626f},
-std::array<float,2>{0.228433222f, 0.580671787f},
-std::array<float,2>{0.928880811f, 0.677172422f},
-std::array<float,2>{0.0100065339f, 0.49697575f},
-std::array<float,2>{0.601258039f, 0.056874536f},
-std::array<float,2>{0.363707066f, 0.98682034f},
-std::array<float,2>{0.734309077f, 0.742550671f},
-std::array<float,2>{0.404175133f, 0.37912634f},
-std::array<float,2>{0.751571238f, 0.119406834f},
-std::array<float,2>{0.153132722f, 0.927330673f},
-std::array<float,2>{0.964727521f, 0.855187953f},
-std::array<float,2>{0.0835409611f, 0.247070521f},
-std::array<float,2>{0.516020715f, 0.264409065f},
-std::array<float,2>{0.279475778f, 0.526327312f},
-std::array<float,2>{0.590465367f, 0.950427711f},
-std::array<float,2>{0.33437863f, 0.00482233241f},
-std::array<float,2>{0.875729144f, 0.463082403f},
-std::array<float,2>{0.0446888879f, 0.63724333f},
-std::array<float,2>{0.87022078f, 0.616736412f},
-std::array<float,2>{0.192840457f, 0.316773325f},
-std::array<float,2>{0.631433666f, 0.128251374f},
-std::array<float,2>{0.450264871f, 0.762845874f},
-std::array<float,2>{0.622696757f, 0.65251559f},
-std::array<float,2>{0.352533072f, 0.439820468f},
-std::array<float,2>{0.916202724f, 0.0171063542f},
-std::array<float,2>{0.0235786848f, 0.962217987f},
-std::array<float,2>{0.843016922f, 0.778792918f},
-std::array<float,2>{0.247907028f, 0.144504696f},
-std::array<float,2>{0.676934183f, 0.333891809f},
-std::array<float,2>{0.491438687f, 0.607122064f},
-std::array<float,2>{0.697885036f, 0.907847345f},
-std::array<float,2>{0.423318565f, 0.105721325f},
-std::array<float,2>{0.792608857f, 0.402133882f},
-std::array<float,2>{0.161740243f, 0.7215873f},
-std::array<float,2>{0.999637067f, 0.514418542f},
-std::array<float,2>{0.0990365893f, 0.274919569f},
-std::array<float,2>{0.558042765f, 0.219122112f},
-std::array<float,2>{0.290372491f, 0.870624065f},
-std::array<float,2>{0.655325234f, 0.572152615f},
-std::array<float,2>{0.459270298f, 0.35586974f},
-std::array<float,2>{0.846384943f, 0.185223177f},
-std::array<float,2>{0.209187254f, 0.782664359f},
-std::array<float,2>{0.904102325f, 0.977769554f},
-std::array<float,2>{0.0590057857f, 0.0317832083f},
-std::array<float,2>{0.574399233f, 0.483229786f},
-std::array<float,2>{0.327034861f, 0.669427752f},
-std::array<float,2>{0.505996406f, 0.826194823f},
-std::array<float,2>{0.251105934f, 0.214175463f},
-std::array<float,2>{0.946834385f, 0.290819138f},
-std::array<float,2>{0.0707030669f, 0.542163074f},
-std::array<float,2>{0.771489918f, 0.716455221f},
-std::array<float,2>{0.127367735f, 0.411520183f},
-std::array<float,2>{0.746306658f, 0.0649769902f},
-std::array<float,2>{0.381904304f, 0.896871984f},
-std::array<float,2>{0.566645026f, 0.59618479f},
-std::array<float,2>{0.317850202f, 0.341956794f},
-std::array<float,2>{0.894999802f, 0.149770617f},
-std::array<float,2>{0.0516965501f, 0.76893574f},
-std::array<float,2>{0.85571748f, 0.954849958f},
-std::array<float,2>{0.218174592f, 0.0312055498f},
-std::array<float,2>{0.642991304f, 0.447300255f},
-std::array<float,2>{0.461712301f, 0.643751085f},
-std::array<float,2>{0.738492012f, 0.862524211f},
-std::array<float,2>{0.387136221f, 0.23410514f},
-std::array<float,2>{0.775114298f, 0.270434797f},
-std::array<float,2>{0.136819988f, 0.504923582f},
-std::array<float,2>{0.942756772f, 0.728144586f},
-std::array<float,2>{0.0645080134f, 0.391902119f},
-std::array<float,2>{0.511962056f, 0.0987960622f},
-std::array<float,2>{0.262461334f, 0.919325769f},
-std::array<float,2>{0.684856117f, 0.662280023f},
-std::array<float,2>{0.493060857f, 0.473991811f},
-std::array<float,2>{0.83008039f, 0.0443134382f},
-std::array<float,2>{0.241289258f, 0.974927425f},
-std::array<float,2>{0.90701592f, 0.791383743f},
-std::array<float,2>{0.0159490686f, 0.175585374f},
-std::array<float,2>{0.616431832f, 0.348239034f},
-std::array<float,2>{0.351262599f, 0.564577699f},
-std::array<float,2>{0.551422477f, 0.906090379f},
-std::array<float,2>{0.288219601f, 0.0777419955f},
-std::array<float,2>{0.988199949f, 0.419920325f},
-std::array<float,2>{0.103462018f, 0.706053257f},
-std::array<float,2>{0.781433702f, 0.533468604f},
-std::array<float,2>{0.169785261f, 0.288786203f},
-std::array<float,2>{0.69190681f, 0.20736824f},
-std::array<float,2>{0.430124164f, 0.81311363f},
-std::array<float,2>{0.526176751f, 0.698680699f},
-std::array<float,2>{0.268631935f, 0.434295982f},
-std::array<float,2>{0.954951584f, 0.0830935538f},
-std::array<float,2>{0.0866662338f, 0.879588902f},
-std::array<float,2>{0.762304008f, 0.82936281f},
-std::array<float,2>{0.143717349f, 0.194700256f},
-std::array<float,2>{0.724784672f, 0.301726937f},
-std::array<float,2>{0.392441571f, 0.55979377f},
-std::array<float,2>{0.636992276f, 0.996723175f},
-std::array<float,2>{0.442040503f, 0.0477348901f},
-std::array<float,2>{0.863786519f, 0.492043734f},
-std::array<float,2>{0.19968614f, 0.685005665f},
-std::array<float,2>{0.885097682f, 0.592906058f},
-std::array<float,2>{0.0353167616f, 0.372144848f},
-std::array<float,2>{0.584506392f, 0.166258067f},
-std::array<float,2>{0.34216246f, 0.806489289f},
-std::array<float,2>{0.706810534f, 0.521091938f},
-std::array<float,2>{0.420030385f, 0.250916392f},
-std::array<float,2>{0.811420918f, 0.235468432f},
-std::array<float,2>{0.182868898f, 0.843833506f},
-std::array<float,2>{0.969339669f, 0.930092812f},
-std::array<float,2>{0.11358387f, 0.109436393f},
-std::array<float,2>{0.545236528f, 0.388128281f},
-std::array<float,2>{0.298826456f, 0.740231752f},
-std::array<float,2>{0.60796237f, 0.755605519f},
-std::array<float,2>{0.371356755f, 0.136993259f},
-std::array<float,2>{0.934151351f, 0.32567066f},
-std::array<float,2>{0.00542858057f, 0.621899307f},
-std::array<float,2>{0.816431284f, 0.628893256f},
-std::array<float,2>{0.223605797f, 0.457591623f},
-std::array<float,2>{0.65867269f, 0.00826889835f},
-std::array<float,2>{0.469531775f, 0.939934015f},
-std::array<float,2>{0.589000285f, 0.536632299f},
-std::array<float,2>{0.328790307f, 0.284012049f},
-std::array<float,2>{0.881543815f, 0.204313636f},
-std::array<float,2>{0.0420789272f, 0.816515744f},
-std::array<float,2>{0.871863723f, 0.898473561f},
-std::array<float,2>{0.188393697f, 0.0727339014f},
-std::array<float,2>{0.625914335f, 0.415973604f},
-std::array<float,2>{0.448206961f, 0.708488405f},
-std::array<float,2>{0.728086948f, 0.794301152f},
-std::array<float,2>{0.399090469f, 0.178656176f},
-std::array<float,2>{0.757767618f, 0.346352607f},
-std::array<float,2>{0.151370481f, 0.570020914f},
-std::array<float,2>{0.968474925f, 0.656872332f},
-std::array<float,2>{0.0784925967f, 0.469403386f},
-std::array<float,2>{0.52046603f, 0.0410793722f},
-std::array<float,2>{0.274589598f, 0.972442925f},
-std::array<float,2>{0.665004909f, 0.732176483f},
-std::array<float,2>{0.477185428f, 0.396330774f},
-std::array<float,2>{0.822728753f, 0.0945656821f},
-std::array<float,2>{0.232248053f, 0.914222598f},
-std::array<float,2>{0.922333777f, 0.863405287f},
-std::array<float,2>{0.0141012119f, 0.227648154f},
-std::array<float,2>{0.59664166f, 0.267347157f},
-std::array<float,2>{0.361376822f, 0.501643121f},
-std::array<float,2>{0.533814847f, 0.957968116f},
-std::array<float,2>{0.30471307f, 0.0270408448f},
-std::array<float,2>{0.978836298f, 0.452231377f},
-std::array<float,2>{0.11831601f, 0.646525025f},
-std::array<float,2>{0.800715029f, 0.598754704f},
-std::array<float,2>{0.1738583f, 0.336386263f},
-std::array<float,2>{0.717414677f, 0.152866438f},
-std::array<float,2>{0.408406675f, 0.772909403f},
-std::array<float,2>{0.500963449f, 0.629889488f},
-std::array<float,2>{0.254077673f, 0.454479784f},
-std::array<float,2>{0.953029156f, 0.0126586547f},
-std::array<float,2>{0.0774151906f, 0.942307591f},
-std::array<float,2>{0.7670452f, 0.753873169f},
-std::array<float,2>{0.131104931f, 0.133913651f},
-std::array<float,2>{0.743102074f, 0.321511269f},
-std::array<float,2>{0.377918154f, 0.62104708f},
-std::array<float,2>{0.648978293f, 0.934860647f},
-std::array<float,2>{0.455316901f, 0.115004472f},
-std::array<float,2>{0.851049185f, 0.383918256f},
-std::array<float,2>{0.206854418f, 0.734406054f},
-std::array<float,2>{0.902325153f, 0.518413723f},
-std::array<float,2>{0.0556482486f, 0.255766153f},
-std::array<float,2>{0.573771179f, 0.240972921f},
-std::array<float,2>{0.323848367f, 0.848863602f},
-std::array<float,2>{0.69987607f, 0.586392343f},
-std::array<float,2>{0.42700243f, 0.368470997f},
-std::array<float,2>{0.796706676f, 0.169573024f},
-std::array<float,2>{0.157203779f, 0.81240207f},
-std::array<float,2>{0.994910836f, 0.995473027f},
-std::array<float,2>{0.0972772166f, 0.0544723384f},
-std::array<float,2>{0.561420798f, 0.485643238f},
-std::array<float,2>{0.295198113f, 0.681112707f},
-std::array<float,2>{0.620695412f, 0.833308518f},
-std::array<float,2>{0.356353045f, 0.189503089f},
-std::array<float,2>{0.919049144f, 0.298137784f},
-std::array<float,2>{0.0292091034f, 0.556497812f},
-std::array<float,2>{0.837886631f, 0.701337576f},
-std::array<float,2>{0.243776098f, 0.43045336f},
-std::array<float,2>{0.674069941f, 0.0815935433f},
-std::array<float,2>{0.486288399f, 0.878045976f},
-std::array<float,2>{0.54924351f, 0.609549403f},
-std::array<float,2>{0.282908112f, 0.314027905f},
-std::array<float,2>{0.991969705f, 0.131594017f},
-std::array<float,2>{0.108528718f, 0.761398733f},
-std::array<float,2>{0.788199365f, 0.945529699f},
-std::array<float,2>{0.164704695f, 0.000265190814f},
-std::array<float,2>{0.690738976f, 0.466177613f},
-std::array<float,2>{0.434866458f, 0.634664059f},
-std::array<float,2>{0.68124485f, 0.856019318f},
-std::array<float,2>{0.498277932f, 0.243084908f},
-std::array<float,2>{0.834353745f, 0.258742422f},
-std::array<float,2>{0.234405085f, 0.530328393f},
-std::array<float,2>{0.911511421f, 0.746609092f},
-std::array<float,2>{0.022164518f, 0.377287239f},
-std::array<float,2>{0.612132132f, 0.123885475f},
-std::array<float,2>{0.347463667f, 0.924391925f},
-std::array<float,2>{0.736367583f, 0.674884856f},
-std::array<float,2>{0.384713918f, 0.492292285f},
-std::array<float,2>{0.779808581f, 0.0609181598f},
-std::array<float,2>{0.134787172f, 0.989019215f},
-std::array<float,2>{0.938121259f, 0.798110247f},
-std::array<float,2>{0.0695194826f, 0.162299737f},
-std::array<float,2>{0.51157558f, 0.364718765f},
-std::array<float,2>{0.260407805f, 0.584254265f},
-std::array<float,2>{0.565815449f, 0.889807045f},
-std::array<float,2>{0.316153705f, 0.090509437f},
-std::array<float,2>{0.893488228f, 0.425209969f},
-std::array<float,2>{0.0476839468f, 0.692122161f},
-std::array<float,2>{0.853867352f, 0.548318923f},
-std::array<float,2>{0.212819815f, 0.308563381f},
-std::array<float,2>{0.645965993f, 0.200627327f},
-std::array<float,2>{0.465280384f, 0.838418126f},
-std::array<float,2>{0.603359282f, 0.711222947f},
-std::array<float,2>{0.369068772f, 0.408408016f},
-std::array<float,2>{0.931211174f, 0.0667892992f},
-std::array<float,2>{0.00184849126f, 0.892259836f},
-std::array<float,2>{0.8150599f, 0.82292372f},
-std::array<float,2>{0.219934434f, 0.215954572f},
-std::array<float,2>{0.662578404f, 0.293611109f},
-std::array<float,2>{0.474554807f, 0.543071687f},
-std::array<float,2>{0.709006071f, 0.980763555f},
-std::array<float,2>{0.417638034f, 0.0380469151f},
-std::array<float,2>{0.806477249f, 0.479386926f},
-std::array<float,2>{0.186993897f, 0.666879356f},
-std::array<float,2>{0.976263642f, 0.577231288f},
-std::array<float,2>{0.112687834f, 0.353597105f},
-std::array<float,2>{0.541218102f, 0.181008443f},
-std::array<float,2>{0.302754819f, 0.7859056f},
-std::array<float,2>{0.635780811f, 0.510840833f},
-std::array<float,2>{0.439331114f, 0.280695826f},
-std::array<float,2>{0.862886667f, 0.224622145f},
-std::array<float,2>{0.199009031f, 0.874147773f},
-std::array<float,2>{0.887945414f, 0.911217272f},
-std::array<float,2>{0.0340144746f, 0.104530796f},
-std::array<float,2>{0.579286158f, 0.403443426f},
-std::array<float,2>{0.336865425f, 0.724672735f},
-std::array<float,2>{0.528324246f, 0.775226831f},
-std::array<float,2>{0.26956135f, 0.147649318f},
-std::array<float,2>{0.957201481f, 0.33183679f},
-std::array<float,2>{0.0934533104f, 0.602645099f},
-std::array<float,2>{0.758056402f, 0.65154916f},
-std::array<float,2>{0.147526026f, 0.442727029f},
-std::array<float,2>{0.721162796f, 0.0223598406f},
-std::array<float,2>{0.394998074f, 0.966416061f},
-std::array<float,2>{0.518917024f, 0.523626268f},
-std::array<float,2>{0.277629197f, 0.263227582f},
-std::array<float,2>{0.961901784f, 0.249019042f},
-std::array<float,2>{0.0841497555f, 0.852905989f},
-std::array<float,2>{0.753075778f, 0.928265333f},
-std::array<float,2>{0.156172276f, 0.117410861f},
-std::array<float,2>{0.731070042f, 0.381773472f},
-std::array<float,2>{0.405839324f, 0.745964408f},
-std::array<float,2>{0.629323781f, 0.764170825f},
-std::array<float,2>{0.451287866f, 0.12589179f},
-std::array<float,2>{0.868670285f, 0.318709433f},
-std::array<float,2>{0.195025817f, 0.614668608f},
-std::array<float,2>{0.877415597f, 0.63935101f},
-std::array<float,2>{0.0457452834f, 0.461372524f},
-std::array<float,2>{0.593533158f, 0.00682515092f},
-std::array<float,2>{0.332338214f, 0.951503515f},
-std::array<float,2>{0.714019775f, 0.689465404f},
-std::array<float,2>{0.410772175f, 0.429606676f},
-std::array<float,2>{0.802558303f, 0.0879409686f},
-std::array<float,2>{0.176975474f, 0.886189818f},
-std::array<float,2>{0.982502162f, 0.840471625f},
-std::array<float,2>{0.123981424f, 0.195508718f},
-std::array<float,2>{0.536237359f, 0.311274886f},
-std::array<float,2>{0.309292257f, 0.55172658f},
-std::array<float,2>{0.598427892f, 0.985661924f},
-std::array<float,2>{0.366942316f, 0.0549219027f},
-std::array<float,2>{0.927169859f, 0.49825877f},
-std::array<float,2>{0.00795510598f, 0.679167628f},
-std::array<float,2>{0.824528337f, 0.579628408f},
-std::array<float,2>{0.2296606f, 0.362670183f},
-std::array<float,2>{0.668432891f, 0.156505808f},
-std::array<float,2>{0.480963737f, 0.802329421f},
-std::array<float,2>{0.577906966f, 0.671378553f},
-std::array<float,2>{0.324493527f, 0.481635153f},
-std::array<float,2>{0.905656815f, 0.0347216278f},
-std::array<float,2>{0.0618632622f, 0.978757024f},
-std::array<float,2>{0.844069362f, 0.783938527f},
-std::array<float,2>{0.208420128f, 0.18616496f},
-std::array<float,2>{0.653320074f, 0.358309239f},
-std::array<float,2>{0.458522081f, 0.573166907f},
-std::array<float,2>{0.748275876f, 0.896198213f},
-std::array<float,2>{0.37914598f, 0.063554965f},
-std::array<float,2>{0.770709097f, 0.412270904f},
-std::array<float,2>{0.126913145f, 0.717154503f},
-std::array<float,2>{0.947437465f, 0.540732682f},
-std::array<float,2>{0.0741348267f, 0.291375339f},
-std::array<float,2>{0.504985452f, 0.21282658f},
-std::array<float,2>{0.25389123f, 0.825279951f},
-std::array<float,2>{0.677867532f, 0.609018326f},
-std::array<float,2>{0.489888191f, 0.334410459f},
-std::array<float,2>{0.840076089f, 0.14109315f},
-std::array<float,2>{0.249432325f, 0.779809654f},
-std::array<float,2>{0.915563881f, 0.96386975f},
-std::array<float,2>{0.0258122571f, 0.0177840404f},
-std::array<float,2>{0.624205112f, 0.438319176f},
-std::array<float,2>{0.355344743f, 0.655197859f},
-std::array<float,2>{0.554787695f, 0.867294252f},
-std::array<float,2>{0.292200774f, 0.222056955f},
-std::array<float,2>{0.997543454f, 0.275660127f},
-std::array<float,2>{0.09983138f, 0.511914372f},
-std::array<float,2>{0.789421678f, 0.719500363f},
-std::array<float,2>{0.162369609f, 0.398627639f},
-std::array<float,2>{0.695594609f, 0.107843161f},
-std::array<float,2>{0.424071312f, 0.909860075f},
-std::array<float,2>{0.61460489f, 0.563343346f},
-std::array<float,2>{0.348296076f, 0.350985825f},
-std::array<float,2>{0.908477664f, 0.172990918f},
-std::array<float,2>{0.0195160098f, 0.789618433f},
-std::array<float,2>{0.828205466f, 0.972992241f},
-std::array<float,2>{0.239345059f, 0.0458456203f},
-std::array<float,2>{0.685984969f, 0.475741446f},
-std::array<float,2>{0.495354325f, 0.661062896f},
-std::array<float,2>{0.694137156f, 0.815051913f},
-std::array<float,2>{0.432153136f, 0.209127977f},
-std::array<float,2>{0.783963501f, 0.285254031f},
-std::array<float,2>{0.170394227f, 0.532944143f},
-std::array<float,2>{0.98549515f, 0.704919636f},
-std::array<float,2>{0.10492377f, 0.420140207f},
-std::array<float,2>{0.553167224f, 0.0754780471f},
-std::array<float,2>{0.285543174f, 0.903814137f},
-std::array<float,2>{0.641866446f, 0.642026603f},
-std::array<float,2>{0.463496596f, 0.445481777f},
-std::array<float,2>{0.857800603f, 0.0284390375f},
-std::array<float,2>{0.216049984f, 0.955257714f},
-std::array<float,2>{0.898122609f, 0.766569316f},
-std::array<float,2>{0.0529342331f, 0.151230678f},
-std::array<float,2>{0.569024324f, 0.340580523f},
-std::array<float,2>{0.318424791f, 0.594349146f},
-std::array<float,2>{0.514720976f, 0.920765698f},
-std::array<float,2>{0.263680071f, 0.101050638f},
-std::array<float,2>{0.945280552f, 0.393887728f},
-std::array<float,2>{0.064174585f, 0.729926765f},
-std::array<float,2>{0.776235163f, 0.505998731f},
-std::array<float,2>{0.138773486f, 0.273118556f},
-std::array<float,2>{0.741092026f, 0.231369451f},
-std::array<float,2>{0.389449716f, 0.859900475f},
-std::array<float,2>{0.543206632f, 0.741577744f},
-std::array<float,2>{0.299881041f, 0.390317827f},
-std::array<float,2>{0.972056329f, 0.112009309f},
-std::array<float,2>{0.116157264f, 0.931698084f},
-std::array<float,2>{0.810493588f, 0.847403944f},
-std::array<float,2>{0.181203961f, 0.237871423f},
-std::array<float,2>{0.704883277f, 0.253616005f},
-std::array<float,2>{0.418472588f, 0.522231758f},
-std::array<float,2>{0.657360733f, 0.938419223f},
-std::array<float,2>{0.471158713f, 0.0113321897f},
-std::array<float,2>{0.820305049f, 0.46062094f},
-std::array<float,2>{0.225985467f, 0.626322985f},
-std::array<float,2>{0.937365294f, 0.624977887f},
-std::array<float,2>{0.00633194344f, 0.326194167f},
-std::array<float,2>{0.606131375f, 0.139927477f},
-std::array<float,2>{0.373559237f, 0.757594943f},
-std::array<float,2>{0.722865522f, 0.560738862f},
-std::array<float,2>{0.392921388f, 0.304273576f},
-std::array<float,2>{0.765039563f, 0.192589447f},
-std::array<float,2>{0.141125783f, 0.831375182f},
-std::array<float,2>{0.956107855f, 0.88219589f},
-std::array<float,2>{0.0892527103f, 0.0850093216f},
-std::array<float,2>{0.523688257f, 0.436485559f},
-std::array<float,2>{0.267082453f, 0.695466578f},
-std::array<float,2>{0.583323658f, 0.807369411f},
-std::array<float,2>{0.340054572f, 0.164619729f},
-std::array<float,2>{0.884543478f, 0.373457879f},
-std::array<float,2>{0.0384653136f, 0.590316296f},
-std::array<float,2>{0.866871476f, 0.687215865f},
-std::array<float,2>{0.201241851f, 0.488439828f},
-std::array<float,2>{0.640006363f, 0.0497882776f},
-std::array<float,2>{0.444582283f, 0.998815596f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.265518218f, 0.540348113f},
-std::array<float,2>{0.672541499f, 0.415665507f},
-std::array<float,2>{0.0521607585f, 0.0552369878f},
-std::array<float,2>{0.868666947f, 0.925867021f},
-std::array<float,2>{0.235031292f, 0.857761919f},
-std::array<float,2>{0.896047175f, 0.213240221f},
-std::array<float,2>{0.479023218f, 0.326673687f},
-std::array<float,2>{0.610730231f, 0.6343683f},
-std::array<float,2>{0.383907199f, 0.950503111f},
-std::array<float,2>{0.551683366f, 0.121511564f},
-std::array<float,2>{0.128803849f, 0.469318628f},
-std::array<float,2>{0.944672108f, 0.580118477f},
-std::array<float,2>{0.0919118971f, 0.698886395f},
-std::array<float,2>{0.764204443f, 0.264107347f},
-std::array<float,2>{0.336908489f, 0.140677601f},
-std::array<float,2>{0.732502699f, 0.775464714f},
-std::array<float,2>{0.442071915f, 0.685124874f},
-std::array<float,2>{0.588092148f, 0.359840184f},
-std::array<float,2>{0.196124032f, 0.230259374f},
-std::array<float,2>{0.922579944f, 0.838682294f},
-std::array<float,2>{0.013077002f, 0.88009423f},
-std::array<float,2>{0.83220315f, 0.0196117088f},
-std::array<float,2>{0.299684912f, 0.381470561f},
-std::array<float,2>{0.641587257f, 0.500693798f},
-std::array<float,2>{0.344697565f, 0.789955735f},
-std::array<float,2>{0.688523054f, 0.177414417f},
-std::array<float,2>{0.0982274637f, 0.311508358f},
-std::array<float,2>{0.797709882f, 0.748434246f},
-std::array<float,2>{0.180167928f, 0.60286051f},
-std::array<float,2>{0.983714402f, 0.452890158f},
-std::array<float,2>{0.414410919f, 0.0800715461f},
-std::array<float,2>{0.520454586f, 0.985859871f},
-std::array<float,2>{0.433279127f, 0.573100209f},
-std::array<float,2>{0.50194478f, 0.486092329f},
-std::array<float,2>{0.169240102f, 0.0982094631f},
-std::array<float,2>{0.994529426f, 0.963650286f},
-std::array<float,2>{0.111166991f, 0.757505596f},
-std::array<float,2>{0.793401301f, 0.136101499f},
-std::array<float,2>{0.374622405f, 0.269133598f},
-std::array<float,2>{0.718332052f, 0.708051026f},
-std::array<float,2>{0.28300485f, 0.907090724f},
-std::array<float,2>{0.62974f, 0.0409447998f},
-std::array<float,2>{0.0274023991f, 0.437424898f},
-std::array<float,2>{0.82747072f, 0.555120289f},
-std::array<float,2>{0.207759738f, 0.654810429f},
-std::array<float,2>{0.921315014f, 0.329439133f},
-std::array<float,2>{0.467746258f, 0.202775404f},
-std::array<float,2>{0.574506223f, 0.863366067f},
-std::array<float,2>{0.317688942f, 0.725575209f},
-std::array<float,2>{0.747411966f, 0.295083672f},
-std::array<float,2>{0.0639553815f, 0.162035793f},
-std::array<float,2>{0.772554755f, 0.807909071f},
-std::array<float,2>{0.150353953f, 0.973966599f},
-std::array<float,2>{0.955340564f, 0.076337263f},
-std::array<float,2>{0.399168253f, 0.465274096f},
-std::array<float,2>{0.544685364f, 0.609677136f},
-std::array<float,2>{0.486790806f, 0.816167772f},
-std::array<float,2>{0.607150674f, 0.239437655f},
-std::array<float,2>{0.233078361f, 0.346229225f},
-std::array<float,2>{0.879757702f, 0.662836015f},
-std::array<float,2>{0.0321370922f, 0.523168743f},
-std::array<float,2>{0.848533154f, 0.403630912f},
-std::array<float,2>{0.274405807f, 0.00453452859f},
-std::array<float,2>{0.668504655f, 0.896545708f},
-std::array<float,2>{0.366065383f, 0.623226702f},
-std::array<float,2>{0.709373474f, 0.455470592f},
-std::array<float,2>{0.121896841f, 0.0686999038f},
-std::array<float,2>{0.788589597f, 0.98128432f},
-std::array<float,2>{0.159996465f, 0.801908731f},
-std::array<float,2>{0.991007268f, 0.165707543f},
-std::array<float,2>{0.422931999f, 0.285009801f},
-std::array<float,2>{0.513555646f, 0.733655691f},
-std::array<float,2>{0.460695893f, 0.905036032f},
-std::array<float,2>{0.568989754f, 0.0146935014f},
-std::array<float,2>{0.216732949f, 0.393043697f},
-std::array<float,2>{0.911167741f, 0.530097783f},
-std::array<float,2>{0.018153511f, 0.664659798f},
-std::array<float,2>{0.812925279f, 0.352832317f},
-std::array<float,2>{0.294891804f, 0.242576525f},
-std::array<float,2>{0.635131359f, 0.820441127f},
-std::array<float,2>{0.398261547f, 0.715058923f},
-std::array<float,2>{0.532551467f, 0.274896771f},
-std::array<float,2>{0.148137286f, 0.128805935f},
-std::array<float,2>{0.965429366f, 0.761712432f},
-std::array<float,2>{0.0773874223f, 0.960217237f},
-std::array<float,2>{0.777619898f, 0.105693296f},
-std::array<float,2>{0.320860922f, 0.494596779f},
-std::array<float,2>{0.739675164f, 0.569924533f},
-std::array<float,2>{0.268556803f, 0.871145904f},
-std::array<float,2>{0.659085035f, 0.190058529f},
-std::array<float,2>{0.0436771065f, 0.336342573f},
-std::array<float,2>{0.855358243f, 0.644779146f},
-std::array<float,2>{0.225996509f, 0.548977077f},
-std::array<float,2>{0.885843098f, 0.422025561f},
-std::array<float,2>{0.492422193f, 0.0327348709f},
-std::array<float,2>{0.599245369f, 0.917519093f},
-std::array<float,2>{0.475390732f, 0.508178532f},
-std::array<float,2>{0.622497559f, 0.383375168f},
-std::array<float,2>{0.246109366f, 0.0293976292f},
-std::array<float,2>{0.90237689f, 0.882921755f},
-std::array<float,2>{0.0598194003f, 0.828736186f},
-std::array<float,2>{0.866691768f, 0.220384195f},
-std::array<float,2>{0.254510581f, 0.370416254f},
-std::array<float,2>{0.682533503f, 0.675212204f},
-std::array<float,2>{0.331817597f, 0.993026316f},
-std::array<float,2>{0.720827579f, 0.0934210494f},
-std::array<float,2>{0.0857466236f, 0.438251972f},
-std::array<float,2>{0.750124395f, 0.59548378f},
-std::array<float,2>{0.13643533f, 0.738649368f},
-std::array<float,2>{0.946485281f, 0.302347362f},
-std::array<float,2>{0.378031701f, 0.186905757f},
-std::array<float,2>{0.561507583f, 0.782737076f},
-std::array<float,2>{0.306836098f, 0.627766848f},
-std::array<float,2>{0.655140817f, 0.320141226f},
-std::array<float,2>{0.00654906966f, 0.208597645f},
-std::array<float,2>{0.837202966f, 0.847734869f},
-std::array<float,2>{0.189568907f, 0.936637282f},
-std::array<float,2>{0.931978822f, 0.0502647236f},
-std::array<float,2>{0.445582598f, 0.407474965f},
-std::array<float,2>{0.585133672f, 0.537074625f},
-std::array<float,2>{0.409249336f, 0.771340549f},
-std::array<float,2>{0.526300192f, 0.152630314f},
-std::array<float,2>{0.177743629f, 0.253515393f},
-std::array<float,2>{0.969271004f, 0.687875867f},
-std::array<float,2>{0.107556157f, 0.591576457f},
-std::array<float,2>{0.810905755f, 0.483983845f},
-std::array<float,2>{0.35785839f, 0.116601191f},
-std::array<float,2>{0.69786638f, 0.942061305f},
-std::array<float,2>{0.289579511f, 0.584882259f},
-std::array<float,2>{0.636878669f, 0.473350912f},
-std::array<float,2>{0.0196615886f, 0.118438512f},
-std::array<float,2>{0.819210529f, 0.949068725f},
-std::array<float,2>{0.212890238f, 0.78077358f},
-std::array<float,2>{0.908148468f, 0.146245494f},
-std::array<float,2>{0.455040455f, 0.261311024f},
-std::array<float,2>{0.565168023f, 0.702635646f},
-std::array<float,2>{0.429037094f, 0.92382431f},
-std::array<float,2>{0.508327484f, 0.0621069521f},
-std::array<float,2>{0.163976178f, 0.421562403f},
-std::array<float,2>{0.985369563f, 0.546096861f},
-std::array<float,2>{0.119740911f, 0.638311625f},
-std::array<float,2>{0.781959474f, 0.321261555f},
-std::array<float,2>{0.360832661f, 0.216898665f},
-std::array<float,2>{0.703287184f, 0.851757288f},
-std::array<float,2>{0.499910086f, 0.746059239f},
-std::array<float,2>{0.594232559f, 0.305263638f},
-std::array<float,2>{0.221235141f, 0.173533186f},
-std::array<float,2>{0.888293266f, 0.794424415f},
-std::array<float,2>{0.0401354991f, 0.988815427f},
-std::array<float,2>{0.855808079f, 0.0856144652f},
-std::array<float,2>{0.272310793f, 0.446814835f},
-std::array<float,2>{0.66168499f, 0.605814517f},
-std::array<float,2>{0.326027483f, 0.84095335f},
-std::array<float,2>{0.735498667f, 0.233908579f},
-std::array<float,2>{0.0704586878f, 0.366560549f},
-std::array<float,2>{0.775757849f, 0.682040811f},
-std::array<float,2>{0.143842012f, 0.504997611f},
-std::array<float,2>{0.961148977f, 0.375352979f},
-std::array<float,2>{0.393521249f, 0.0185935311f},
-std::array<float,2>{0.535878837f, 0.876655996f},
-std::array<float,2>{0.380943626f, 0.559042156f},
-std::array<float,2>{0.557391822f, 0.429980665f},
-std::array<float,2>{0.138376042f, 0.0463698395f},
-std::array<float,2>{0.951146722f, 0.910532892f},
-std::array<float,2>{0.0783300623f, 0.860106051f},
-std::array<float,2>{0.756459713f, 0.196795166f},
-std::array<float,2>{0.332695067f, 0.333278596f},
-std::array<float,2>{0.723189056f, 0.648821771f},
-std::array<float,2>{0.253567219f, 0.965328574f},
-std::array<float,2>{0.686404705f, 0.0951588899f},
-std::array<float,2>{0.0564126819f, 0.489806205f},
-std::array<float,2>{0.859860718f, 0.574585795f},
-std::array<float,2>{0.244614303f, 0.706225395f},
-std::array<float,2>{0.899974287f, 0.272411823f},
-std::array<float,2>{0.469925314f, 0.137914464f},
-std::array<float,2>{0.618097544f, 0.752096772f},
-std::array<float,2>{0.355246276f, 0.658146262f},
-std::array<float,2>{0.70192337f, 0.349116951f},
-std::array<float,2>{0.10160841f, 0.237323597f},
-std::array<float,2>{0.80492723f, 0.818327844f},
-std::array<float,2>{0.175170228f, 0.894104898f},
-std::array<float,2>{0.975479305f, 0.00257859379f},
-std::array<float,2>{0.413431764f, 0.400853068f},
-std::array<float,2>{0.53046453f, 0.516509831f},
-std::array<float,2>{0.452491552f, 0.809589684f},
-std::array<float,2>{0.581842184f, 0.157979175f},
-std::array<float,2>{0.192314163f, 0.291200817f},
-std::array<float,2>{0.936046422f, 0.719556272f},
-std::array<float,2>{0.00199612766f, 0.613461018f},
-std::array<float,2>{0.842236876f, 0.463625818f},
-std::array<float,2>{0.310937881f, 0.0741160437f},
-std::array<float,2>{0.650304794f, 0.97151345f},
-std::array<float,2>{0.342757076f, 0.525519371f},
-std::array<float,2>{0.729365885f, 0.39641118f},
-std::array<float,2>{0.0881591514f, 0.00900309533f},
-std::array<float,2>{0.759604156f, 0.901322842f},
-std::array<float,2>{0.132277921f, 0.826122761f},
-std::array<float,2>{0.938465655f, 0.246634454f},
-std::array<float,2>{0.386754394f, 0.355849087f},
-std::array<float,2>{0.548578918f, 0.668858945f},
-std::array<float,2>{0.483969897f, 0.978043556f},
-std::array<float,2>{0.615178406f, 0.0663242713f},
-std::array<float,2>{0.239800036f, 0.458390743f},
-std::array<float,2>{0.894213736f, 0.617924094f},
-std::array<float,2>{0.0484577529f, 0.729602575f},
-std::array<float,2>{0.873441398f, 0.288688928f},
-std::array<float,2>{0.261659622f, 0.170754462f},
-std::array<float,2>{0.677957237f, 0.799770534f},
-std::array<float,2>{0.420202166f, 0.642697394f},
-std::array<float,2>{0.517758787f, 0.34083569f},
-std::array<float,2>{0.184617832f, 0.194559187f},
-std::array<float,2>{0.979514301f, 0.871092558f},
-std::array<float,2>{0.0961638838f, 0.921030164f},
-std::array<float,2>{0.802637398f, 0.0387704372f},
-std::array<float,2>{0.349715769f, 0.425993741f},
-std::array<float,2>{0.691496849f, 0.552066803f},
-std::array<float,2>{0.301295668f, 0.765175462f},
-std::array<float,2>{0.645675957f, 0.130741268f},
-std::array<float,2>{0.00913123321f, 0.277630448f},
-std::array<float,2>{0.831883669f, 0.712587416f},
-std::array<float,2>{0.200065032f, 0.563585401f},
-std::array<float,2>{0.926082134f, 0.499332011f},
-std::array<float,2>{0.438594609f, 0.104643777f},
-std::array<float,2>{0.591243029f, 0.955592453f},
-std::array<float,2>{0.463307619f, 0.598167837f},
-std::array<float,2>{0.570365429f, 0.444087476f},
-std::array<float,2>{0.205940485f, 0.0867809281f},
-std::array<float,2>{0.917280436f, 0.998580754f},
-std::array<float,2>{0.0245623905f, 0.787271261f},
-std::array<float,2>{0.820341825f, 0.182228908f},
-std::array<float,2>{0.286936074f, 0.300429225f},
-std::array<float,2>{0.626213849f, 0.736430109f},
-std::array<float,2>{0.369158626f, 0.887451053f},
-std::array<float,2>{0.713431537f, 0.0262912717f},
-std::array<float,2>{0.115745999f, 0.387982458f},
-std::array<float,2>{0.789647579f, 0.512316406f},
-std::array<float,2>{0.166619167f, 0.679373562f},
-std::array<float,2>{0.999864697f, 0.374355048f},
-std::array<float,2>{0.435296476f, 0.225539446f},
-std::array<float,2>{0.506891489f, 0.835560381f},
-std::array<float,2>{0.279960066f, 0.695132315f},
-std::array<float,2>{0.667746425f, 0.255093634f},
-std::array<float,2>{0.036950212f, 0.150144696f},
-std::array<float,2>{0.845651269f, 0.767484963f},
-std::array<float,2>{0.229657531f, 0.937937379f},
-std::array<float,2>{0.878591537f, 0.110396318f},
-std::array<float,2>{0.490611047f, 0.477431178f},
-std::array<float,2>{0.604118824f, 0.586020827f},
-std::array<float,2>{0.403787017f, 0.846497536f},
-std::array<float,2>{0.540003419f, 0.20488809f},
-std::array<float,2>{0.15375948f, 0.315268159f},
-std::array<float,2>{0.959125936f, 0.63171345f},
-std::array<float,2>{0.068914406f, 0.533558607f},
-std::array<float,2>{0.768742561f, 0.410250127f},
-std::array<float,2>{0.312574536f, 0.0531331524f},
-std::array<float,2>{0.744178593f, 0.931772649f},
-std::array<float,2>{0.297897607f, 0.503380775f},
-std::array<float,2>{0.644057274f, 0.379928827f},
-std::array<float,2>{0.0152172195f, 0.0227768235f},
-std::array<float,2>{0.834068835f, 0.882687926f},
-std::array<float,2>{0.198065445f, 0.837831795f},
-std::array<float,2>{0.923831463f, 0.227440208f},
-std::array<float,2>{0.443712831f, 0.363234043f},
-std::array<float,2>{0.586920738f, 0.686167836f},
-std::array<float,2>{0.417063773f, 0.987942576f},
-std::array<float,2>{0.522248328f, 0.0801459178f},
-std::array<float,2>{0.18227832f, 0.449746847f},
-std::array<float,2>{0.980562568f, 0.604617774f},
-std::array<float,2>{0.101374842f, 0.747150004f},
-std::array<float,2>{0.799516976f, 0.310381621f},
-std::array<float,2>{0.347273767f, 0.179076508f},
-std::array<float,2>{0.689634264f, 0.792364955f},
-std::array<float,2>{0.47656548f, 0.636307597f},
-std::array<float,2>{0.611664474f, 0.324385136f},
-std::array<float,2>{0.236840621f, 0.212185681f},
-std::array<float,2>{0.896698833f, 0.857154787f},
-std::array<float,2>{0.0538792238f, 0.928278506f},
-std::array<float,2>{0.870158136f, 0.0575536899f},
-std::array<float,2>{0.263319224f, 0.417806178f},
-std::array<float,2>{0.675542235f, 0.54284668f},
-std::array<float,2>{0.33847782f, 0.775160432f},
-std::array<float,2>{0.731929719f, 0.144003898f},
-std::array<float,2>{0.091655992f, 0.262503654f},
-std::array<float,2>{0.762752473f, 0.696643949f},
-std::array<float,2>{0.126091555f, 0.579873919f},
-std::array<float,2>{0.941976011f, 0.470912635f},
-std::array<float,2>{0.38509348f, 0.123227261f},
-std::array<float,2>{0.55393374f, 0.952266991f},
-std::array<float,2>{0.400398791f, 0.613170087f},
-std::array<float,2>{0.546822309f, 0.468234241f},
-std::array<float,2>{0.152264446f, 0.0758546293f},
-std::array<float,2>{0.95365113f, 0.975624323f},
-std::array<float,2>{0.0660450682f, 0.805323303f},
-std::array<float,2>{0.770187736f, 0.163687736f},
-std::array<float,2>{0.319175452f, 0.293190032f},
-std::array<float,2>{0.749815643f, 0.723834515f},
-std::array<float,2>{0.275840521f, 0.895654559f},
-std::array<float,2>{0.670661628f, 0.00745644607f},
-std::array<float,2>{0.034885902f, 0.404341489f},
-std::array<float,2>{0.850423396f, 0.521160066f},
-std::array<float,2>{0.232231811f, 0.661536396f},
-std::array<float,2>{0.882698536f, 0.345278054f},
-std::array<float,2>{0.485892802f, 0.240500346f},
-std::array<float,2>{0.607468724f, 0.812909961f},
-std::array<float,2>{0.371271431f, 0.710861742f},
-std::array<float,2>{0.716065466f, 0.266888052f},
-std::array<float,2>{0.111632414f, 0.13402459f},
-std::array<float,2>{0.794990659f, 0.755520999f},
-std::array<float,2>{0.171630085f, 0.961920261f},
-std::array<float,2>{0.992711782f, 0.10027808f},
-std::array<float,2>{0.429818749f, 0.487292975f},
-std::array<float,2>{0.501953125f, 0.571891308f},
-std::array<float,2>{0.466077358f, 0.866942406f},
-std::array<float,2>{0.576199949f, 0.199721783f},
-std::array<float,2>{0.209752679f, 0.33027041f},
-std::array<float,2>{0.918767571f, 0.653074443f},
-std::array<float,2>{0.0310849566f, 0.558511436f},
-std::array<float,2>{0.825020313f, 0.435371667f},
-std::array<float,2>{0.284846872f, 0.0417136848f},
-std::array<float,2>{0.631117165f, 0.910137653f},
-std::array<float,2>{0.323746353f, 0.566675425f},
-std::array<float,2>{0.74211359f, 0.492809862f},
-std::array<float,2>{0.0750190988f, 0.10824737f},
-std::array<float,2>{0.780331492f, 0.957814395f},
-std::array<float,2>{0.144658595f, 0.758607447f},
-std::array<float,2>{0.967989087f, 0.126850307f},
-std::array<float,2>{0.396155417f, 0.27625829f},
-std::array<float,2>{0.533442676f, 0.717409015f},
-std::array<float,2>{0.495494217f, 0.914604127f},
-std::array<float,2>{0.601528764f, 0.0336423852f},
-std::array<float,2>{0.22309275f, 0.424627274f},
-std::array<float,2>{0.883998692f, 0.548243105f},
-std::array<float,2>{0.0458541922f, 0.647312224f},
-std::array<float,2>{0.851606667f, 0.338522792f},
-std::array<float,2>{0.266998976f, 0.187596083f},
-std::array<float,2>{0.657842636f, 0.874974191f},
-std::array<float,2>{0.424650639f, 0.732340276f},
-std::array<float,2>{0.515425205f, 0.282962739f},
-std::array<float,2>{0.156707332f, 0.167555287f},
-std::array<float,2>{0.989659786f, 0.8032552f},
-std::array<float,2>{0.12374597f, 0.982668698f},
-std::array<float,2>{0.78595823f, 0.0680982992f},
-std::array<float,2>{0.365156174f, 0.45413059f},
-std::array<float,2>{0.708160162f, 0.623005152f},
-std::array<float,2>{0.295948654f, 0.822793424f},
-std::array<float,2>{0.634275556f, 0.244855925f},
-std::array<float,2>{0.0174592882f, 0.354801565f},
-std::array<float,2>{0.815490723f, 0.667740107f},
-std::array<float,2>{0.216841251f, 0.528906405f},
-std::array<float,2>{0.912990034f, 0.392403781f},
-std::array<float,2>{0.457410723f, 0.0118644778f},
-std::array<float,2>{0.566705763f, 0.903496742f},
-std::array<float,2>{0.447822124f, 0.53867656f},
-std::array<float,2>{0.582341969f, 0.409468025f},
-std::array<float,2>{0.187854916f, 0.0476406217f},
-std::array<float,2>{0.931239247f, 0.93545413f},
-std::array<float,2>{0.00464258995f, 0.850596964f},
-std::array<float,2>{0.838692069f, 0.210702345f},
-std::array<float,2>{0.304781705f, 0.31829235f},
-std::array<float,2>{0.652468741f, 0.625029981f},
-std::array<float,2>{0.356538147f, 0.94413352f},
-std::array<float,2>{0.696979165f, 0.113832451f},
-std::array<float,2>{0.106010176f, 0.481833577f},
-std::array<float,2>{0.809039652f, 0.592628896f},
-std::array<float,2>{0.176299751f, 0.690821946f},
-std::array<float,2>{0.971088529f, 0.251303196f},
-std::array<float,2>{0.408170789f, 0.154318273f},
-std::array<float,2>{0.523823142f, 0.771807909f},
-std::array<float,2>{0.256638438f, 0.673590064f},
-std::array<float,2>{0.680018604f, 0.367848814f},
-std::array<float,2>{0.061759349f, 0.221135333f},
-std::array<float,2>{0.864508212f, 0.831457138f},
-std::array<float,2>{0.24830164f, 0.885909557f},
-std::array<float,2>{0.905255914f, 0.0292913076f},
-std::array<float,2>{0.472717881f, 0.384881884f},
-std::array<float,2>{0.623924136f, 0.51126945f},
-std::array<float,2>{0.375971705f, 0.783493996f},
-std::array<float,2>{0.560243368f, 0.184508026f},
-std::array<float,2>{0.133714661f, 0.303490013f},
-std::array<float,2>{0.947882116f, 0.740508914f},
-std::array<float,2>{0.0828795657f, 0.595713794f},
-std::array<float,2>{0.753439486f, 0.440395653f},
-std::array<float,2>{0.328528106f, 0.0915946588f},
-std::array<float,2>{0.720591128f, 0.995362937f},
-std::array<float,2>{0.270143241f, 0.608646393f},
-std::array<float,2>{0.662234902f, 0.447604984f},
-std::array<float,2>{0.0413217172f, 0.0835817158f},
-std::array<float,2>{0.858782053f, 0.991956174f},
-std::array<float,2>{0.219770461f, 0.796233833f},
-std::array<float,2>{0.889562726f, 0.175646052f},
-std::array<float,2>{0.497756511f, 0.306983203f},
-std::array<float,2>{0.596393347f, 0.742530584f},
-std::array<float,2>{0.391148776f, 0.877496302f},
-std::array<float,2>{0.538309634f, 0.0163701288f},
-std::array<float,2>{0.140862867f, 0.377196431f},
-std::array<float,2>{0.963472962f, 0.505923629f},
-std::array<float,2>{0.0738687962f, 0.681245029f},
-std::array<float,2>{0.773921788f, 0.364567906f},
-std::array<float,2>{0.32806769f, 0.232088834f},
-std::array<float,2>{0.737420201f, 0.842837095f},
-std::array<float,2>{0.455254495f, 0.699506462f},
-std::array<float,2>{0.564404428f, 0.257887602f},
-std::array<float,2>{0.213336304f, 0.147258654f},
-std::array<float,2>{0.909496486f, 0.777888119f},
-std::array<float,2>{0.0222033262f, 0.946327567f},
-std::array<float,2>{0.81728071f, 0.119464636f},
-std::array<float,2>{0.291639328f, 0.47615853f},
-std::array<float,2>{0.639095843f, 0.583903968f},
-std::array<float,2>{0.361931026f, 0.855107963f},
-std::array<float,2>{0.705535293f, 0.21618405f},
-std::array<float,2>{0.117672145f, 0.322295427f},
-std::array<float,2>{0.783885062f, 0.639642775f},
-std::array<float,2>{0.162097424f, 0.544752538f},
-std::array<float,2>{0.988026321f, 0.418714672f},
-std::array<float,2>{0.425980419f, 0.0605063029f},
-std::array<float,2>{0.51015234f, 0.925247312f},
-std::array<float,2>{0.41143316f, 0.517796099f},
-std::array<float,2>{0.527364552f, 0.39847672f},
-std::array<float,2>{0.173347101f, 0.00132141623f},
-std::array<float,2>{0.973980427f, 0.89080137f},
-std::array<float,2>{0.103894569f, 0.819284022f},
-std::array<float,2>{0.80682534f, 0.234548777f},
-std::array<float,2>{0.353025496f, 0.350786686f},
-std::array<float,2>{0.699452758f, 0.658337593f},
-std::array<float,2>{0.310516089f, 0.970694721f},
-std::array<float,2>{0.652169406f, 0.0712057278f},
-std::array<float,2>{0.00195298996f, 0.46136117f},
-std::array<float,2>{0.84021163f, 0.616671741f},
-std::array<float,2>{0.195120588f, 0.721594632f},
-std::array<float,2>{0.935374439f, 0.290487945f},
-std::array<float,2>{0.449894071f, 0.158983737f},
-std::array<float,2>{0.579318404f, 0.811987281f},
-std::array<float,2>{0.334289521f, 0.650624514f},
-std::array<float,2>{0.724752128f, 0.335349172f},
-std::array<float,2>{0.0812654123f, 0.197545305f},
-std::array<float,2>{0.755142748f, 0.862653971f},
-std::array<float,2>{0.140476823f, 0.912899256f},
-std::array<float,2>{0.951933622f, 0.0434646569f},
-std::array<float,2>{0.379884213f, 0.431788415f},
-std::array<float,2>{0.554940283f, 0.56224072f},
-std::array<float,2>{0.471971154f, 0.750697196f},
-std::array<float,2>{0.620486617f, 0.140398324f},
-std::array<float,2>{0.243925974f, 0.271031588f},
-std::array<float,2>{0.90212065f, 0.704054475f},
-std::array<float,2>{0.0584260151f, 0.577507973f},
-std::array<float,2>{0.861665785f, 0.490667999f},
-std::array<float,2>{0.250228018f, 0.097568579f},
-std::array<float,2>{0.684195876f, 0.967039883f},
-std::array<float,2>{0.347870767f, 0.553248823f},
-std::array<float,2>{0.693592608f, 0.428049773f},
-std::array<float,2>{0.0942789838f, 0.0352562442f},
-std::array<float,2>{0.803616405f, 0.919735789f},
-std::array<float,2>{0.185706049f, 0.868426621f},
-std::array<float,2>{0.977723479f, 0.192899033f},
-std::array<float,2>{0.419103473f, 0.342652291f},
-std::array<float,2>{0.516526163f, 0.641676366f},
-std::array<float,2>{0.440101564f, 0.954789996f},
-std::array<float,2>{0.592183471f, 0.101576373f},
-std::array<float,2>{0.202390641f, 0.497911185f},
-std::array<float,2>{0.929484189f, 0.565106273f},
-std::array<float,2>{0.0114061097f, 0.712921143f},
-std::array<float,2>{0.829567552f, 0.280292034f},
-std::array<float,2>{0.304103494f, 0.132735342f},
-std::array<float,2>{0.647793233f, 0.762680054f},
-std::array<float,2>{0.390410781f, 0.671613514f},
-std::array<float,2>{0.549244106f, 0.358478814f},
-std::array<float,2>{0.129387617f, 0.248106733f},
-std::array<float,2>{0.941353619f, 0.827300847f},
-std::array<float,2>{0.0868731588f, 0.899378896f},
-std::array<float,2>{0.761156559f, 0.0111032836f},
-std::array<float,2>{0.341691047f, 0.396752298f},
-std::array<float,2>{0.727373123f, 0.525251687f},
-std::array<float,2>{0.258213729f, 0.79770273f},
-std::array<float,2>{0.677101791f, 0.168521196f},
-std::array<float,2>{0.0496868193f, 0.285913736f},
-std::array<float,2>{0.872149646f, 0.726697326f},
-std::array<float,2>{0.240664154f, 0.619890571f},
-std::array<float,2>{0.890640795f, 0.459590048f},
-std::array<float,2>{0.480482221f, 0.063871555f},
-std::array<float,2>{0.615850508f, 0.980091631f},
-std::array<float,2>{0.489653081f, 0.589696884f},
-std::array<float,2>{0.602095783f, 0.480157733f},
-std::array<float,2>{0.227964833f, 0.112993605f},
-std::array<float,2>{0.876820385f, 0.940236926f},
-std::array<float,2>{0.0372238606f, 0.76767683f},
-std::array<float,2>{0.847210288f, 0.151000306f},
-std::array<float,2>{0.277984887f, 0.255898327f},
-std::array<float,2>{0.665288866f, 0.692910016f},
-std::array<float,2>{0.315149933f, 0.931319416f},
-std::array<float,2>{0.743027151f, 0.0509213097f},
-std::array<float,2>{0.0672431886f, 0.412780106f},
-std::array<float,2>{0.766823947f, 0.531458616f},
-std::array<float,2>{0.15464057f, 0.629209876f},
-std::array<float,2>{0.958220363f, 0.313505113f},
-std::array<float,2>{0.406004816f, 0.206317723f},
-std::array<float,2>{0.541175306f, 0.845240116f},
-std::array<float,2>{0.288634628f, 0.735922873f},
-std::array<float,2>{0.628009796f, 0.297279656f},
-std::array<float,2>{0.0263539534f, 0.181091323f},
-std::array<float,2>{0.822389662f, 0.786324084f},
-std::array<float,2>{0.204726547f, 0.996477425f},
-std::array<float,2>{0.915487945f, 0.0888433754f},
-std::array<float,2>{0.462819874f, 0.442384064f},
-std::array<float,2>{0.573263168f, 0.600506425f},
-std::array<float,2>{0.436958879f, 0.833031893f},
-std::array<float,2>{0.505731106f, 0.224224463f},
-std::array<float,2>{0.164766535f, 0.372595698f},
-std::array<float,2>{0.997621953f, 0.677624941f},
-std::array<float,2>{0.113527544f, 0.515257061f},
-std::array<float,2>{0.791139424f, 0.389602214f},
-std::array<float,2>{0.368392199f, 0.0249062013f},
-std::array<float,2>{0.712709963f, 0.889752865f},
-std::array<float,2>{0.283910692f, 0.555690646f},
-std::array<float,2>{0.632205606f, 0.43600136f},
-std::array<float,2>{0.0300167482f, 0.0392822102f},
-std::array<float,2>{0.826048791f, 0.908147752f},
-std::array<float,2>{0.21026732f, 0.865180612f},
-std::array<float,2>{0.919634819f, 0.201760367f},
-std::array<float,2>{0.465668976f, 0.329029799f},
-std::array<float,2>{0.577611864f, 0.655888021f},
-std::array<float,2>{0.430911511f, 0.964476645f},
-std::array<float,2>{0.503142953f, 0.0992193595f},
-std::array<float,2>{0.170587316f, 0.484926552f},
-std::array<float,2>{0.993913472f, 0.574019432f},
-std::array<float,2>{0.112382196f, 0.707673013f},
-std::array<float,2>{0.796632051f, 0.268516988f},
-std::array<float,2>{0.372619033f, 0.134814292f},
-std::array<float,2>{0.71493119f, 0.756501377f},
-std::array<float,2>{0.484405518f, 0.663242579f},
-std::array<float,2>{0.60850352f, 0.347495764f},
-std::array<float,2>{0.230487391f, 0.238526598f},
-std::array<float,2>{0.88182652f, 0.814503491f},
-std::array<float,2>{0.0337378234f, 0.898247063f},
-std::array<float,2>{0.851412535f, 0.00574215502f},
-std::array<float,2>{0.277028799f, 0.403226405f},
-std::array<float,2>{0.671117902f, 0.521602154f},
-std::array<float,2>{0.319503486f, 0.806662321f},
-std::array<float,2>{0.748239696f, 0.160333529f},
-std::array<float,2>{0.0651249886f, 0.296750486f},
-std::array<float,2>{0.770768285f, 0.726468444f},
-std::array<float,2>{0.150842011f, 0.610380769f},
-std::array<float,2>{0.954251766f, 0.466201693f},
-std::array<float,2>{0.40154773f, 0.0773892105f},
-std::array<float,2>{0.545743883f, 0.972932816f},
-std::array<float,2>{0.386115611f, 0.581875324f},
-std::array<float,2>{0.553690672f, 0.470656395f},
-std::array<float,2>{0.125747785f, 0.122743212f},
-std::array<float,2>{0.943055987f, 0.949893713f},
-std::array<float,2>{0.0907788277f, 0.777015924f},
-std::array<float,2>{0.762646019f, 0.14215517f},
-std::array<float,2>{0.339556038f, 0.265535444f},
-std::array<float,2>{0.73119539f, 0.697817445f},
-std::array<float,2>{0.262145787f, 0.927177429f},
-std::array<float,2>{0.673980176f, 0.0561779104f},
-std::array<float,2>{0.0530800484f, 0.414272487f},
-std::array<float,2>{0.869173706f, 0.539601088f},
-std::array<float,2>{0.237611756f, 0.633749723f},
-std::array<float,2>{0.897715151f, 0.327702701f},
-std::array<float,2>{0.478244603f, 0.214794323f},
-std::array<float,2>{0.613199294f, 0.858780324f},
-std::array<float,2>{0.34574163f, 0.749295533f},
-std::array<float,2>{0.690797031f, 0.311653376f},
-std::array<float,2>{0.0996963009f, 0.176582605f},
-std::array<float,2>{0.800676823f, 0.790763736f},
-std::array<float,2>{0.182911381f, 0.984626412f},
-std::array<float,2>{0.982361853f, 0.0781992301f},
-std::array<float,2>{0.416885406f, 0.451245964f},
-std::array<float,2>{0.52286166f, 0.601707578f},
-std::array<float,2>{0.444591165f, 0.839360595f},
-std::array<float,2>{0.586799085f, 0.229433119f},
-std::array<float,2>{0.198380247f, 0.360885471f},
-std::array<float,2>{0.925299287f, 0.684278369f},
-std::array<float,2>{0.0140147451f, 0.501290619f},
-std::array<float,2>{0.83579427f, 0.382767677f},
-std::array<float,2>{0.296921372f, 0.0209527388f},
-std::array<float,2>{0.642793059f, 0.879809797f},
-std::array<float,2>{0.32954976f, 0.594205797f},
-std::array<float,2>{0.719718874f, 0.43866384f},
-std::array<float,2>{0.0832761079f, 0.0921399817f},
-std::array<float,2>{0.75256896f, 0.993833899f},
-std::array<float,2>{0.134738132f, 0.781978369f},
-std::array<float,2>{0.948305786f, 0.185622439f},
-std::array<float,2>{0.376583695f, 0.300891221f},
-std::array<float,2>{0.558620334f, 0.739809394f},
-std::array<float,2>{0.473942399f, 0.884118617f},
-std::array<float,2>{0.624104381f, 0.0312140211f},
-std::array<float,2>{0.249238238f, 0.384171814f},
-std::array<float,2>{0.905467451f, 0.509301126f},
-std::array<float,2>{0.0606604703f, 0.674208879f},
-std::array<float,2>{0.863528609f, 0.369437605f},
-std::array<float,2>{0.257144451f, 0.218932331f},
-std::array<float,2>{0.680936635f, 0.829238713f},
-std::array<float,2>{0.406717747f, 0.688951373f},
-std::array<float,2>{0.524776816f, 0.252858609f},
-std::array<float,2>{0.177685693f, 0.153613091f},
-std::array<float,2>{0.972468674f, 0.769943655f},
-std::array<float,2>{0.106821276f, 0.942887008f},
-std::array<float,2>{0.810242414f, 0.115830161f},
-std::array<float,2>{0.356369525f, 0.482904911f},
-std::array<float,2>{0.696149111f, 0.590378821f},
-std::array<float,2>{0.306157082f, 0.848978162f},
-std::array<float,2>{0.653584838f, 0.207274616f},
-std::array<float,2>{0.00525367353f, 0.31928876f},
-std::array<float,2>{0.839590967f, 0.628711522f},
-std::array<float,2>{0.189171538f, 0.53573209f},
-std::array<float,2>{0.929690599f, 0.406833947f},
-std::array<float,2>{0.448480427f, 0.0494801775f},
-std::array<float,2>{0.583036423f, 0.936010063f},
-std::array<float,2>{0.458356977f, 0.531105399f},
-std::array<float,2>{0.56834954f, 0.393661797f},
-std::array<float,2>{0.218593583f, 0.0137658147f},
-std::array<float,2>{0.914001822f, 0.905971348f},
-std::array<float,2>{0.0165163167f, 0.821882248f},
-std::array<float,2>{0.814525485f, 0.243523911f},
-std::array<float,2>{0.295683503f, 0.352203727f},
-std::array<float,2>{0.632940829f, 0.665932953f},
-std::array<float,2>{0.363751799f, 0.981699824f},
-std::array<float,2>{0.707326531f, 0.0695864409f},
-std::array<float,2>{0.124584936f, 0.457014799f},
-std::array<float,2>{0.786143243f, 0.624237597f},
-std::array<float,2>{0.158198804f, 0.732789814f},
-std::array<float,2>{0.989054561f, 0.283487767f},
-std::array<float,2>{0.425351411f, 0.164131865f},
-std::array<float,2>{0.514561176f, 0.80084753f},
-std::array<float,2>{0.266062409f, 0.645721078f},
-std::array<float,2>{0.656453252f, 0.337621927f},
-std::array<float,2>{0.0464474186f, 0.191101223f},
-std::array<float,2>{0.852748632f, 0.872485101f},
-std::array<float,2>{0.223966688f, 0.916734874f},
-std::array<float,2>{0.88323915f, 0.0312757008f},
-std::array<float,2>{0.495007753f, 0.423409194f},
-std::array<float,2>{0.59989059f, 0.550516903f},
-std::array<float,2>{0.394792438f, 0.760472f},
-std::array<float,2>{0.535034001f, 0.127820835f},
-std::array<float,2>{0.146074101f, 0.273719072f},
-std::array<float,2>{0.966923594f, 0.716074109f},
-std::array<float,2>{0.0756054446f, 0.568655312f},
-std::array<float,2>{0.780213416f, 0.49521333f},
-std::array<float,2>{0.322845876f, 0.106476635f},
-std::array<float,2>{0.740320146f, 0.959958434f},
-std::array<float,2>{0.251270235f, 0.576047659f},
-std::array<float,2>{0.684782386f, 0.488392532f},
-std::array<float,2>{0.0567470044f, 0.0939970315f},
-std::array<float,2>{0.862368762f, 0.966466844f},
-std::array<float,2>{0.242509514f, 0.753716946f},
-std::array<float,2>{0.901191056f, 0.136789843f},
-std::array<float,2>{0.471632749f, 0.272801131f},
-std::array<float,2>{0.61918962f, 0.705356777f},
-std::array<float,2>{0.379682004f, 0.91210115f},
-std::array<float,2>{0.556494176f, 0.0453705266f},
-std::array<float,2>{0.139568239f, 0.430993706f},
-std::array<float,2>{0.953091025f, 0.559687972f},
-std::array<float,2>{0.0804868042f, 0.64968282f},
-std::array<float,2>{0.754309118f, 0.332457691f},
-std::array<float,2>{0.335098863f, 0.196183085f},
-std::array<float,2>{0.726187289f, 0.861140907f},
-std::array<float,2>{0.450615823f, 0.720111251f},
-std::array<float,2>{0.578945816f, 0.292629451f},
-std::array<float,2>{0.194271773f, 0.156730101f},
-std::array<float,2>{0.933767736f, 0.808953762f},
-std::array<float,2>{0.000725129677f, 0.972399473f},
-std::array<float,2>{0.841167986f, 0.0727653727f},
-std::array<float,2>{0.308695883f, 0.463876337f},
-std::array<float,2>{0.650770664f, 0.614357889f},
-std::array<float,2>{0.351589322f, 0.817266285f},
-std::array<float,2>{0.700755537f, 0.236646682f},
-std::array<float,2>{0.104936644f, 0.348114997f},
-std::array<float,2>{0.807994246f, 0.656647444f},
-std::array<float,2>{0.172097862f, 0.517423511f},
-std::array<float,2>{0.973163009f, 0.402300924f},
-std::array<float,2>{0.410631806f, 0.00318845059f},
-std::array<float,2>{0.528450012f, 0.893517673f},
-std::array<float,2>{0.427492857f, 0.545285463f},
-std::array<float,2>{0.511370897f, 0.419972986f},
-std::array<float,2>{0.160484165f, 0.06091718f},
-std::array<float,2>{0.987162292f, 0.922003269f},
-std::array<float,2>{0.119017944f, 0.853310347f},
-std::array<float,2>{0.784567297f, 0.21831435f},
-std::array<float,2>{0.362571061f, 0.321620971f},
-std::array<float,2>{0.706898749f, 0.636765838f},
-std::array<float,2>{0.292122453f, 0.947997808f},
-std::array<float,2>{0.640302956f, 0.117650643f},
-std::array<float,2>{0.0226251837f, 0.473918647f},
-std::array<float,2>{0.817733943f, 0.585014343f},
-std::array<float,2>{0.213907078f, 0.702048481f},
-std::array<float,2>{0.908638835f, 0.260461062f},
-std::array<float,2>{0.456419438f, 0.144847408f},
-std::array<float,2>{0.563098967f, 0.779710114f},
-std::array<float,2>{0.326244414f, 0.682725251f},
-std::array<float,2>{0.73677808f, 0.365273267f},
-std::array<float,2>{0.0725958422f, 0.232663348f},
-std::array<float,2>{0.775082648f, 0.840239167f},
-std::array<float,2>{0.142399862f, 0.87549752f},
-std::array<float,2>{0.964417577f, 0.0180949066f},
-std::array<float,2>{0.392566711f, 0.376473278f},
-std::array<float,2>{0.537391484f, 0.50392431f},
-std::array<float,2>{0.496833324f, 0.79374826f},
-std::array<float,2>{0.597199917f, 0.17275548f},
-std::array<float,2>{0.219632059f, 0.306019694f},
-std::array<float,2>{0.890330493f, 0.744172454f},
-std::array<float,2>{0.042872455f, 0.606713414f},
-std::array<float,2>{0.858079016f, 0.445848554f},
-std::array<float,2>{0.270563602f, 0.0844729245f},
-std::array<float,2>{0.663355112f, 0.990040421f},
-std::array<float,2>{0.367488176f, 0.513348222f},
-std::array<float,2>{0.711778581f, 0.387639105f},
-std::array<float,2>{0.114830703f, 0.0265006591f},
-std::array<float,2>{0.792543232f, 0.888113141f},
-std::array<float,2>{0.16523698f, 0.83490622f},
-std::array<float,2>{0.996342421f, 0.22598207f},
-std::array<float,2>{0.435831666f, 0.373066336f},
-std::array<float,2>{0.504162848f, 0.677991152f},
-std::array<float,2>{0.461630434f, 0.999707282f},
-std::array<float,2>{0.573215663f, 0.0870722532f},
-std::array<float,2>{0.203658372f, 0.445168525f},
-std::array<float,2>{0.914971292f, 0.599130929f},
-std::array<float,2>{0.0272511188f, 0.737320364f},
-std::array<float,2>{0.823479414f, 0.299532324f},
-std::array<float,2>{0.287917674f, 0.182828054f},
-std::array<float,2>{0.627581477f, 0.788420439f},
-std::array<float,2>{0.405105233f, 0.632406056f},
-std::array<float,2>{0.542253733f, 0.316191316f},
-std::array<float,2>{0.155691281f, 0.203675285f},
-std::array<float,2>{0.957781136f, 0.846826792f},
-std::array<float,2>{0.0680574179f, 0.932912827f},
-std::array<float,2>{0.766550183f, 0.0544462204f},
-std::array<float,2>{0.316013247f, 0.412042201f},
-std::array<float,2>{0.743487298f, 0.534900427f},
-std::array<float,2>{0.278778434f, 0.76640135f},
-std::array<float,2>{0.664311588f, 0.148586407f},
-std::array<float,2>{0.0381747968f, 0.254186243f},
-std::array<float,2>{0.846175134f, 0.693759322f},
-std::array<float,2>{0.2271391f, 0.587064266f},
-std::array<float,2>{0.87593776f, 0.478084236f},
-std::array<float,2>{0.489234388f, 0.110214874f},
-std::array<float,2>{0.60281384f, 0.938985646f},
-std::array<float,2>{0.482167214f, 0.61904788f},
-std::array<float,2>{0.616738975f, 0.457331717f},
-std::array<float,2>{0.241612598f, 0.0647851676f},
-std::array<float,2>{0.891964853f, 0.977193832f},
-std::array<float,2>{0.050112959f, 0.800260603f},
-std::array<float,2>{0.871267736f, 0.170927539f},
-std::array<float,2>{0.259506077f, 0.28788656f},
-std::array<float,2>{0.676400721f, 0.728783786f},
-std::array<float,2>{0.340436339f, 0.901431978f},
-std::array<float,2>{0.728341162f, 0.00869229622f},
-std::array<float,2>{0.0869297236f, 0.395122498f},
-std::array<float,2>{0.760125279f, 0.527125895f},
-std::array<float,2>{0.129900768f, 0.669831753f},
-std::array<float,2>{0.939899504f, 0.356637716f},
-std::array<float,2>{0.38927713f, 0.247939527f},
-std::array<float,2>{0.55046463f, 0.824867964f},
-std::array<float,2>{0.302741438f, 0.711107194f},
-std::array<float,2>{0.647231221f, 0.278839707f},
-std::array<float,2>{0.0107122185f, 0.12937963f},
-std::array<float,2>{0.828375876f, 0.763754487f},
-std::array<float,2>{0.20184499f, 0.9569453f},
-std::array<float,2>{0.928008676f, 0.103712432f},
-std::array<float,2>{0.441086888f, 0.498255253f},
-std::array<float,2>{0.592999876f, 0.563015282f},
-std::array<float,2>{0.418239623f, 0.869655013f},
-std::array<float,2>{0.517481446f, 0.194224045f},
-std::array<float,2>{0.187165856f, 0.33987993f},
-std::array<float,2>{0.977389872f, 0.644120753f},
-std::array<float,2>{0.0951726288f, 0.551309049f},
-std::array<float,2>{0.804240942f, 0.427608758f},
-std::array<float,2>{0.34890157f, 0.0377830341f},
-std::array<float,2>{0.695107162f, 0.920872509f},
-std::array<float,2>{0.274725646f, 0.519684911f},
-std::array<float,2>{0.669337749f, 0.406223297f},
-std::array<float,2>{0.0324532054f, 0.00587566011f},
-std::array<float,2>{0.849569678f, 0.895108938f},
-std::array<float,2>{0.234372973f, 0.813548028f},
-std::array<float,2>{0.880678475f, 0.24204132f},
-std::array<float,2>{0.488215476f, 0.343937606f},
-std::array<float,2>{0.605964005f, 0.66041702f},
-std::array<float,2>{0.399579465f, 0.975089073f},
-std::array<float,2>{0.543317258f, 0.0749320835f},
-std::array<float,2>{0.14877443f, 0.467326403f},
-std::array<float,2>{0.957004607f, 0.611446619f},
-std::array<float,2>{0.0629139468f, 0.722937465f},
-std::array<float,2>{0.771655083f, 0.294504344f},
-std::array<float,2>{0.316433668f, 0.16225493f},
-std::array<float,2>{0.746450126f, 0.806392968f},
-std::array<float,2>{0.468342602f, 0.653551579f},
-std::array<float,2>{0.575219214f, 0.3317056f},
-std::array<float,2>{0.208839312f, 0.200717658f},
-std::array<float,2>{0.920883775f, 0.865344286f},
-std::array<float,2>{0.0287480485f, 0.909094453f},
-std::array<float,2>{0.826406002f, 0.0424844623f},
-std::array<float,2>{0.281789362f, 0.433738559f},
-std::array<float,2>{0.630594254f, 0.556689978f},
-std::array<float,2>{0.373898268f, 0.754802823f},
-std::array<float,2>{0.716903925f, 0.133003801f},
-std::array<float,2>{0.110273473f, 0.2664226f},
-std::array<float,2>{0.794123173f, 0.709385812f},
-std::array<float,2>{0.168462276f, 0.57125628f},
-std::array<float,2>{0.995598495f, 0.487474591f},
-std::array<float,2>{0.432110965f, 0.100919008f},
-std::array<float,2>{0.500003397f, 0.961800337f},
-std::array<float,2>{0.415201187f, 0.603535354f},
-std::array<float,2>{0.521142304f, 0.450775772f},
-std::array<float,2>{0.180990472f, 0.081341736f},
-std::array<float,2>{0.982834876f, 0.986416221f},
-std::array<float,2>{0.0994739309f, 0.791853189f},
-std::array<float,2>{0.798730016f, 0.178234071f},
-std::array<float,2>{0.344730407f, 0.308711916f},
-std::array<float,2>{0.68821454f, 0.746134579f},
-std::array<float,2>{0.300438017f, 0.881078184f},
-std::array<float,2>{0.641619265f, 0.0218690056f},
-std::array<float,2>{0.0123503897f, 0.378960788f},
-std::array<float,2>{0.83397758f, 0.502558351f},
-std::array<float,2>{0.196859032f, 0.686962605f},
-std::array<float,2>{0.923772693f, 0.361733198f},
-std::array<float,2>{0.443263143f, 0.228252023f},
-std::array<float,2>{0.588888526f, 0.836682439f},
-std::array<float,2>{0.337515175f, 0.695334971f},
-std::array<float,2>{0.733871818f, 0.263574809f},
-std::array<float,2>{0.0933748931f, 0.143240258f},
-std::array<float,2>{0.765480042f, 0.773670077f},
-std::array<float,2>{0.126999095f, 0.951852143f},
-std::array<float,2>{0.943701386f, 0.124592982f},
-std::array<float,2>{0.383739144f, 0.47214973f},
-std::array<float,2>{0.552646875f, 0.578853488f},
-std::array<float,2>{0.479872584f, 0.855760932f},
-std::array<float,2>{0.61015743f, 0.211852506f},
-std::array<float,2>{0.235879228f, 0.326079816f},
-std::array<float,2>{0.894698322f, 0.635482371f},
-std::array<float,2>{0.0514825024f, 0.541819572f},
-std::array<float,2>{0.867354214f, 0.416966647f},
-std::array<float,2>{0.264207006f, 0.0582472794f},
-std::array<float,2>{0.673027992f, 0.928904653f},
-std::array<float,2>{0.358875275f, 0.593384743f},
-std::array<float,2>{0.698635519f, 0.480475694f},
-std::array<float,2>{0.108746327f, 0.114865944f},
-std::array<float,2>{0.812053382f, 0.944895506f},
-std::array<float,2>{0.179172173f, 0.772993505f},
-std::array<float,2>{0.969840348f, 0.155416653f},
-std::array<float,2>{0.408652484f, 0.250352263f},
-std::array<float,2>{0.52673018f, 0.690294147f},
-std::array<float,2>{0.446865261f, 0.934283674f},
-std::array<float,2>{0.584410131f, 0.0488088541f},
-std::array<float,2>{0.190681234f, 0.409078658f},
-std::array<float,2>{0.933425128f, 0.537649214f},
-std::array<float,2>{0.0077326512f, 0.626769423f},
-std::array<float,2>{0.836318493f, 0.316557795f},
-std::array<float,2>{0.308569938f, 0.209441096f},
-std::array<float,2>{0.655612946f, 0.849676669f},
-std::array<float,2>{0.377900243f, 0.741662025f},
-std::array<float,2>{0.562030435f, 0.304526418f},
-std::array<float,2>{0.134772852f, 0.185048684f},
-std::array<float,2>{0.945785046f, 0.784296691f},
-std::array<float,2>{0.0843910426f, 0.994492412f},
-std::array<float,2>{0.7518695f, 0.0901031867f},
-std::array<float,2>{0.330204308f, 0.440607786f},
-std::array<float,2>{0.722519696f, 0.597203016f},
-std::array<float,2>{0.25494945f, 0.830174506f},
-std::array<float,2>{0.683048844f, 0.221951261f},
-std::array<float,2>{0.0588557422f, 0.368440539f},
-std::array<float,2>{0.865300596f, 0.672315657f},
-std::array<float,2>{0.2476006f, 0.510016561f},
-std::array<float,2>{0.903476238f, 0.386706233f},
-std::array<float,2>{0.476427376f, 0.0274748188f},
-std::array<float,2>{0.621872485f, 0.884904861f},
-std::array<float,2>{0.493712723f, 0.547828138f},
-std::array<float,2>{0.597673893f, 0.425023645f},
-std::array<float,2>{0.225258186f, 0.0345324911f},
-std::array<float,2>{0.884775817f, 0.915462613f},
-std::array<float,2>{0.0445055924f, 0.873503029f},
-std::array<float,2>{0.854021549f, 0.189163238f},
-std::array<float,2>{0.268276513f, 0.339309335f},
-std::array<float,2>{0.660027325f, 0.648205996f},
-std::array<float,2>{0.321548074f, 0.958070755f},
-std::array<float,2>{0.738942325f, 0.108720541f},
-std::array<float,2>{0.0767053291f, 0.493492246f},
-std::array<float,2>{0.778595924f, 0.567818046f},
-std::array<float,2>{0.147335246f, 0.718387663f},
-std::array<float,2>{0.966120958f, 0.277187288f},
-std::array<float,2>{0.39682743f, 0.125128806f},
-std::array<float,2>{0.531721175f, 0.759221435f},
-std::array<float,2>{0.293644309f, 0.666753292f},
-std::array<float,2>{0.635769188f, 0.35408172f},
-std::array<float,2>{0.0190049466f, 0.245536059f},
-std::array<float,2>{0.813485742f, 0.823576808f},
-std::array<float,2>{0.215035737f, 0.902532399f},
-std::array<float,2>{0.910602033f, 0.0132229719f},
-std::array<float,2>{0.459806174f, 0.390841007f},
-std::array<float,2>{0.570219815f, 0.527519763f},
-std::array<float,2>{0.422030687f, 0.80401808f},
-std::array<float,2>{0.512542427f, 0.16627644f},
-std::array<float,2>{0.158642188f, 0.281815171f},
-std::array<float,2>{0.991617978f, 0.731291175f},
-std::array<float,2>{0.122278087f, 0.621948302f},
-std::array<float,2>{0.787904859f, 0.45393905f},
-std::array<float,2>{0.366752416f, 0.0672501922f},
-std::array<float,2>{0.710080028f, 0.983420074f},
-std::array<float,2>{0.312460661f, 0.616092086f},
-std::array<float,2>{0.648773253f, 0.462837279f},
-std::array<float,2>{0.00305729616f, 0.0722342208f},
-std::array<float,2>{0.843223631f, 0.96883148f},
-std::array<float,2>{0.193355471f, 0.811075747f},
-std::array<float,2>{0.936971664f, 0.159363836f},
-std::array<float,2>{0.451853096f, 0.28974995f},
-std::array<float,2>{0.58049947f, 0.722134531f},
-std::array<float,2>{0.412165821f, 0.891728997f},
-std::array<float,2>{0.530058026f, 0.000841925794f},
-std::array<float,2>{0.174570143f, 0.399581611f},
-std::array<float,2>{0.97640717f, 0.518680453f},
-std::array<float,2>{0.103317186f, 0.65988332f},
-std::array<float,2>{0.806285918f, 0.34999004f},
-std::array<float,2>{0.353554726f, 0.236314654f},
-std::array<float,2>{0.702778578f, 0.819550276f},
-std::array<float,2>{0.469569892f, 0.704895437f},
-std::array<float,2>{0.618719041f, 0.27040562f},
-std::array<float,2>{0.245910183f, 0.139426023f},
-std::array<float,2>{0.898731589f, 0.751446962f},
-std::array<float,2>{0.0555005558f, 0.968171716f},
-std::array<float,2>{0.860374689f, 0.095965527f},
-std::array<float,2>{0.252173364f, 0.491312951f},
-std::array<float,2>{0.686784506f, 0.576962829f},
-std::array<float,2>{0.333863139f, 0.861351669f},
-std::array<float,2>{0.72443974f, 0.198453635f},
-std::array<float,2>{0.0794818327f, 0.334866256f},
-std::array<float,2>{0.757151902f, 0.651823282f},
-std::array<float,2>{0.136795074f, 0.561347306f},
-std::array<float,2>{0.950060606f, 0.432962537f},
-std::array<float,2>{0.382754147f, 0.0447522365f},
-std::array<float,2>{0.557646811f, 0.913743258f},
-std::array<float,2>{0.393681735f, 0.507011354f},
-std::array<float,2>{0.536783636f, 0.378830045f},
-std::array<float,2>{0.143322319f, 0.0174401663f},
-std::array<float,2>{0.962114036f, 0.878684342f},
-std::array<float,2>{0.0722557753f, 0.842361271f},
-std::array<float,2>{0.776560307f, 0.230860263f},
-std::array<float,2>{0.325107217f, 0.363338768f},
-std::array<float,2>{0.734937429f, 0.679911792f},
-std::array<float,2>{0.273048669f, 0.990839601f},
-std::array<float,2>{0.660289824f, 0.0824823976f},
-std::array<float,2>{0.0399982072f, 0.448821604f},
-std::array<float,2>{0.856975257f, 0.608333647f},
-std::array<float,2>{0.221781701f, 0.743356407f},
-std::array<float,2>{0.887451053f, 0.308548778f},
-std::array<float,2>{0.498208553f, 0.174239039f},
-std::array<float,2>{0.595321655f, 0.795128703f},
-std::array<float,2>{0.360273361f, 0.640568435f},
-std::array<float,2>{0.704110026f, 0.323497593f},
-std::array<float,2>{0.120658666f, 0.215074345f},
-std::array<float,2>{0.782794595f, 0.853651881f},
-std::array<float,2>{0.162465915f, 0.924248636f},
-std::array<float,2>{0.984922647f, 0.0591500401f},
-std::array<float,2>{0.428218305f, 0.419391423f},
-std::array<float,2>{0.508877099f, 0.543327808f},
-std::array<float,2>{0.453458875f, 0.778445125f},
-std::array<float,2>{0.566121161f, 0.148347691f},
-std::array<float,2>{0.211588457f, 0.259644479f},
-std::array<float,2>{0.906854391f, 0.700448871f},
-std::array<float,2>{0.0210451577f, 0.582365513f},
-std::array<float,2>{0.820038259f, 0.475442946f},
-std::array<float,2>{0.29047507f, 0.121062919f},
-std::array<float,2>{0.637739301f, 0.946164668f},
-std::array<float,2>{0.314386249f, 0.533071876f},
-std::array<float,2>{0.74606204f, 0.413910121f},
-std::array<float,2>{0.0698677525f, 0.0522236712f},
-std::array<float,2>{0.768242419f, 0.930295885f},
-std::array<float,2>{0.153144658f, 0.844008446f},
-std::array<float,2>{0.96043843f, 0.205297023f},
-std::array<float,2>{0.402655661f, 0.313356578f},
-std::array<float,2>{0.540805459f, 0.63052541f},
-std::array<float,2>{0.491764694f, 0.940659881f},
-std::array<float,2>{0.60506779f, 0.111363545f},
-std::array<float,2>{0.228756756f, 0.47933042f},
-std::array<float,2>{0.877429545f, 0.58799994f},
-std::array<float,2>{0.0354030877f, 0.691580951f},
-std::array<float,2>{0.844222248f, 0.256898284f},
-std::array<float,2>{0.280278206f, 0.152121961f},
-std::array<float,2>{0.666601479f, 0.768833816f},
-std::array<float,2>{0.434264421f, 0.676589906f},
-std::array<float,2>{0.506425261f, 0.371766537f},
-std::array<float,2>{0.167032301f, 0.223488882f},
-std::array<float,2>{0.998898625f, 0.832609773f},
-std::array<float,2>{0.116707161f, 0.888701797f},
-std::array<float,2>{0.790241122f, 0.0239384025f},
-std::array<float,2>{0.370508611f, 0.389664412f},
-std::array<float,2>{0.714501083f, 0.51448369f},
-std::array<float,2>{0.286105454f, 0.786051691f},
-std::array<float,2>{0.625409067f, 0.180212438f},
-std::array<float,2>{0.0241351128f, 0.297942847f},
-std::array<float,2>{0.822107792f, 0.734484911f},
-std::array<float,2>{0.206092641f, 0.601407051f},
-std::array<float,2>{0.916079462f, 0.44189769f},
-std::array<float,2>{0.46459654f, 0.0891600475f},
-std::array<float,2>{0.571289122f, 0.997376323f},
-std::array<float,2>{0.437933445f, 0.565582871f},
-std::array<float,2>{0.58998096f, 0.496704668f},
-std::array<float,2>{0.200984776f, 0.102692075f},
-std::array<float,2>{0.927243173f, 0.954049826f},
-std::array<float,2>{0.00841965433f, 0.762765169f},
-std::array<float,2>{0.830591798f, 0.131366059f},
-std::array<float,2>{0.302219063f, 0.279850781f},
-std::array<float,2>{0.645254195f, 0.714704156f},
-std::array<float,2>{0.350949079f, 0.91887778f},
-std::array<float,2>{0.69294858f, 0.0370880887f},
-std::array<float,2>{0.0969334468f, 0.429546386f},
-std::array<float,2>{0.801518023f, 0.554629505f},
-std::array<float,2>{0.184204057f, 0.641238749f},
-std::array<float,2>{0.979186952f, 0.343096018f},
-std::array<float,2>{0.421624571f, 0.191590518f},
-std::array<float,2>{0.518777907f, 0.867990494f},
-std::array<float,2>{0.260061622f, 0.728115976f},
-std::array<float,2>{0.679089725f, 0.28707698f},
-std::array<float,2>{0.0472112298f, 0.169267952f},
-std::array<float,2>{0.874128699f, 0.798450589f},
-std::array<float,2>{0.239071727f, 0.97909683f},
-std::array<float,2>{0.893063068f, 0.0625378191f},
-std::array<float,2>{0.483377069f, 0.460517883f},
-std::array<float,2>{0.614108205f, 0.620772719f},
-std::array<float,2>{0.388446271f, 0.826898456f},
-std::array<float,2>{0.547052741f, 0.249520317f},
-std::array<float,2>{0.131142408f, 0.357688099f},
-std::array<float,2>{0.939286888f, 0.670246303f},
-std::array<float,2>{0.0898152292f, 0.524369538f},
-std::array<float,2>{0.758430362f, 0.398332894f},
-std::array<float,2>{0.343104124f, 0.0100052534f},
-std::array<float,2>{0.73014766f, 0.900182724f},
-std::array<float,2>{0.267839074f, 0.550113499f},
-std::array<float,2>{0.659277737f, 0.423202664f},
-std::array<float,2>{0.0441101901f, 0.0317582898f},
-std::array<float,2>{0.853604078f, 0.916206002f},
-std::array<float,2>{0.224967942f, 0.872912645f},
-std::array<float,2>{0.885377347f, 0.190787464f},
-std::array<float,2>{0.493252575f, 0.337202489f},
-std::array<float,2>{0.598297f, 0.646043777f},
-std::array<float,2>{0.397277445f, 0.95925355f},
-std::array<float,2>{0.531903684f, 0.106965683f},
-std::array<float,2>{0.146516189f, 0.49575159f},
-std::array<float,2>{0.966643631f, 0.569256544f},
-std::array<float,2>{0.0766058639f, 0.716755331f},
-std::array<float,2>{0.778953969f, 0.274358392f},
-std::array<float,2>{0.322235167f, 0.127107203f},
-std::array<float,2>{0.738316119f, 0.759822249f},
-std::array<float,2>{0.459444493f, 0.665040314f},
-std::array<float,2>{0.56936413f, 0.351593643f},
-std::array<float,2>{0.215628579f, 0.243656784f},
-std::array<float,2>{0.911060274f, 0.821585715f},
-std::array<float,2>{0.0195195619f, 0.905545354f},
-std::array<float,2>{0.814020514f, 0.0145425759f},
-std::array<float,2>{0.293311089f, 0.394062161f},
-std::array<float,2>{0.636547089f, 0.530465007f},
-std::array<float,2>{0.366662234f, 0.801674306f},
-std::array<float,2>{0.710639894f, 0.164627478f},
-std::array<float,2>{0.122608051f, 0.283877254f},
-std::array<float,2>{0.787274599f, 0.733020425f},
-std::array<float,2>{0.15915817f, 0.624602675f},
-std::array<float,2>{0.992058039f, 0.456315428f},
-std::array<float,2>{0.422780871f, 0.0701385736f},
-std::array<float,2>{0.512109399f, 0.982106984f},
-std::array<float,2>{0.408704311f, 0.590191364f},
-std::array<float,2>{0.527040064f, 0.483168662f},
-std::array<float,2>{0.179484576f, 0.115705617f},
-std::array<float,2>{0.970342994f, 0.942728519f},
-std::array<float,2>{0.109141245f, 0.770171404f},
-std::array<float,2>{0.811535001f, 0.153938115f},
-std::array<float,2>{0.359092355f, 0.252324134f},
-std::array<float,2>{0.69892633f, 0.68901062f},
-std::array<float,2>{0.307964057f, 0.936100841f},
-std::array<float,2>{0.656019688f, 0.0489469394f},
-std::array<float,2>{0.00710063847f, 0.406319767f},
-std::array<float,2>{0.836524606f, 0.535441041f},
-std::array<float,2>{0.190969869f, 0.628292739f},
-std::array<float,2>{0.933065474f, 0.318579376f},
-std::array<float,2>{0.446544737f, 0.207622245f},
-std::array<float,2>{0.584941626f, 0.849531591f},
-std::array<float,2>{0.331035823f, 0.739667833f},
-std::array<float,2>{0.721788466f, 0.301741481f},
-std::array<float,2>{0.0845919997f, 0.186349615f},
-std::array<float,2>{0.75115937f, 0.781542718f},
-std::array<float,2>{0.135613561f, 0.993318439f},
-std::array<float,2>{0.946003258f, 0.0924505293f},
-std::array<float,2>{0.377118856f, 0.439060092f},
-std::array<float,2>{0.561911702f, 0.594643414f},
-std::array<float,2>{0.475862652f, 0.829807043f},
-std::array<float,2>{0.621111214f, 0.219460085f},
-std::array<float,2>{0.247288346f, 0.369952947f},
-std::array<float,2>{0.904012859f, 0.674640775f},
-std::array<float,2>{0.059137512f, 0.50890559f},
-std::array<float,2>{0.866198182f, 0.384679109f},
-std::array<float,2>{0.255731523f, 0.0307321865f},
-std::array<float,2>{0.683128834f, 0.884763956f},
-std::array<float,2>{0.345241487f, 0.602151692f},
-std::array<float,2>{0.687568307f, 0.451744825f},
-std::array<float,2>{0.0987006873f, 0.0790754482f},
-std::array<float,2>{0.798100352f, 0.985225856f},
-std::array<float,2>{0.181256011f, 0.790060341f},
-std::array<float,2>{0.982915461f, 0.175914988f},
-std::array<float,2>{0.415688902f, 0.312355787f},
-std::array<float,2>{0.520931423f, 0.749602795f},
-std::array<float,2>{0.442431927f, 0.87900573f},
-std::array<float,2>{0.589609802f, 0.0214743242f},
-std::array<float,2>{0.196436241f, 0.382304043f},
-std::array<float,2>{0.923074961f, 0.501569629f},
-std::array<float,2>{0.0121120112f, 0.684014916f},
-std::array<float,2>{0.833228588f, 0.36041224f},
-std::array<float,2>{0.300271571f, 0.228733584f},
-std::array<float,2>{0.642158329f, 0.838984907f},
-std::array<float,2>{0.382975906f, 0.697484195f},
-std::array<float,2>{0.552167773f, 0.264942557f},
-std::array<float,2>{0.127777547f, 0.142082155f},
-std::array<float,2>{0.944190085f, 0.77660203f},
-std::array<float,2>{0.0927824378f, 0.949354887f},
-std::array<float,2>{0.764801204f, 0.122376777f},
-std::array<float,2>{0.336951554f, 0.469819844f},
-std::array<float,2>{0.734024823f, 0.58126688f},
-std::array<float,2>{0.264021009f, 0.858938873f},
-std::array<float,2>{0.673625648f, 0.214092419f},
-std::array<float,2>{0.0512630194f, 0.327210069f},
-std::array<float,2>{0.867915809f, 0.63295114f},
-std::array<float,2>{0.235374749f, 0.539169014f},
-std::array<float,2>{0.895378292f, 0.414581805f},
-std::array<float,2>{0.480166376f, 0.0559846088f},
-std::array<float,2>{0.609437466f, 0.927572548f},
-std::array<float,2>{0.487487108f, 0.522436619f},
-std::array<float,2>{0.605738997f, 0.40258348f},
-std::array<float,2>{0.233857766f, 0.00515843974f},
-std::array<float,2>{0.880287111f, 0.897576869f},
-std::array<float,2>{0.0327594616f, 0.815255642f},
-std::array<float,2>{0.848828137f, 0.238877475f},
-std::array<float,2>{0.275329769f, 0.347077906f},
-std::array<float,2>{0.669459164f, 0.663692892f},
-std::array<float,2>{0.317078471f, 0.973321497f},
-std::array<float,2>{0.746924758f, 0.0780797973f},
-std::array<float,2>{0.0633257553f, 0.466649264f},
-std::array<float,2>{0.772294044f, 0.610868275f},
-std::array<float,2>{0.14895162f, 0.725592971f},
-std::array<float,2>{0.956267893f, 0.296256751f},
-std::array<float,2>{0.400031745f, 0.160690993f},
-std::array<float,2>{0.543854177f, 0.807307899f},
-std::array<float,2>{0.281701952f, 0.655427992f},
-std::array<float,2>{0.629953444f, 0.328184694f},
-std::array<float,2>{0.0292510372f, 0.201205119f},
-std::array<float,2>{0.827028513f, 0.864606619f},
-std::array<float,2>{0.208426282f, 0.907405317f},
-std::array<float,2>{0.919990242f, 0.0396985561f},
-std::array<float,2>{0.467816383f, 0.436304986f},
-std::array<float,2>{0.576070607f, 0.55619359f},
-std::array<float,2>{0.432213515f, 0.756345093f},
-std::array<float,2>{0.500557601f, 0.135716811f},
-std::array<float,2>{0.168204308f, 0.267728239f},
-std::array<float,2>{0.995753229f, 0.707120121f},
-std::array<float,2>{0.109782241f, 0.573328912f},
-std::array<float,2>{0.794838369f, 0.484758198f},
-std::array<float,2>{0.373306394f, 0.0989671499f},
-std::array<float,2>{0.717387497f, 0.963926017f},
-std::array<float,2>{0.302671403f, 0.562830985f},
-std::array<float,2>{0.64484489f, 0.49895817f},
-std::array<float,2>{0.00812168512f, 0.104107715f},
-std::array<float,2>{0.830230653f, 0.956356049f},
-std::array<float,2>{0.200275898f, 0.764498711f},
-std::array<float,2>{0.927426815f, 0.129693657f},
-std::array<float,2>{0.438080877f, 0.278461665f},
-std::array<float,2>{0.590507865f, 0.711580634f},
-std::array<float,2>{0.421132684f, 0.919948816f},
-std::array<float,2>{0.51920563f, 0.0372975841f},
-std::array<float,2>{0.183906689f, 0.426968277f},
-std::array<float,2>{0.97896117f, 0.5509606f},
-std::array<float,2>{0.0974413007f, 0.643882573f},
-std::array<float,2>{0.800995827f, 0.340763777f},
-std::array<float,2>{0.351092547f, 0.193762064f},
-std::array<float,2>{0.692579567f, 0.86921072f},
-std::array<float,2>{0.482833713f, 0.729361176f},
-std::array<float,2>{0.613697946f, 0.287593931f},
-std::array<float,2>{0.238645032f, 0.171826199f},
-std::array<float,2>{0.893126726f, 0.800600171f},
-std::array<float,2>{0.0475782007f, 0.97670871f},
-std::array<float,2>{0.874622285f, 0.0650362968f},
-std::array<float,2>{0.260583103f, 0.457988977f},
-std::array<float,2>{0.679437399f, 0.618271887f},
-std::array<float,2>{0.34344098f, 0.824344933f},
-std::array<float,2>{0.729816914f, 0.2472758f},
-std::array<float,2>{0.0891136378f, 0.356980801f},
-std::array<float,2>{0.758098602f, 0.66939038f},
-std::array<float,2>{0.131615639f, 0.526729286f},
-std::array<float,2>{0.938623607f, 0.394798458f},
-std::array<float,2>{0.38769713f, 0.00813494716f},
-std::array<float,2>{0.54774183f, 0.902146697f},
-std::array<float,2>{0.403196365f, 0.534224331f},
-std::array<float,2>{0.540216029f, 0.411166608f},
-std::array<float,2>{0.152458161f, 0.0541706681f},
-std::array<float,2>{0.960857034f, 0.933518469f},
-std::array<float,2>{0.0695920512f, 0.847249568f},
-std::array<float,2>{0.76783061f, 0.203190818f},
-std::array<float,2>{0.313928336f, 0.315758973f},
-std::array<float,2>{0.745148778f, 0.632187903f},
-std::array<float,2>{0.280774742f, 0.938747942f},
-std::array<float,2>{0.666439772f, 0.109394245f},
-std::array<float,2>{0.0358407348f, 0.477903485f},
-std::array<float,2>{0.844497144f, 0.587561309f},
-std::array<float,2>{0.229478329f, 0.693853199f},
-std::array<float,2>{0.87761879f, 0.254648507f},
-std::array<float,2>{0.491523027f, 0.149069622f},
-std::array<float,2>{0.60492599f, 0.765869677f},
-std::array<float,2>{0.370717585f, 0.678689837f},
-std::array<float,2>{0.714003921f, 0.373613745f},
-std::array<float,2>{0.116638087f, 0.226118147f},
-std::array<float,2>{0.790664732f, 0.834138751f},
-std::array<float,2>{0.167605057f, 0.888578475f},
-std::array<float,2>{0.998255491f, 0.0273316577f},
-std::array<float,2>{0.434071064f, 0.386849225f},
-std::array<float,2>{0.5062958f, 0.512887537f},
-std::array<float,2>{0.464349687f, 0.788918674f},
-std::array<float,2>{0.571828902f, 0.183453515f},
-std::array<float,2>{0.206701964f, 0.299170971f},
-std::array<float,2>{0.916864574f, 0.738192141f},
-std::array<float,2>{0.0235815607f, 0.598642409f},
-std::array<float,2>{0.821715951f, 0.4443672f},
-std::array<float,2>{0.285335392f, 0.0878835618f},
-std::array<float,2>{0.62574178f, 0.999209225f},
-std::array<float,2>{0.324329913f, 0.504763305f},
-std::array<float,2>{0.734723985f, 0.376335174f},
-std::array<float,2>{0.071324043f, 0.0176148433f},
-std::array<float,2>{0.777189553f, 0.875290215f},
-std::array<float,2>{0.142671883f, 0.840754151f},
-std::array<float,2>{0.962733388f, 0.23291491f},
-std::array<float,2>{0.394360781f, 0.366138548f},
-std::array<float,2>{0.536223114f, 0.683256686f},
-std::array<float,2>{0.498615861f, 0.989500225f},
-std::array<float,2>{0.595089376f, 0.0840689316f},
-std::array<float,2>{0.222361609f, 0.445332259f},
-std::array<float,2>{0.887084424f, 0.607109487f},
-std::array<float,2>{0.0393122621f, 0.74498868f},
-std::array<float,2>{0.856547117f, 0.306611627f},
-std::array<float,2>{0.272506952f, 0.171880409f},
-std::array<float,2>{0.660666049f, 0.793410301f},
-std::array<float,2>{0.428524077f, 0.637405455f},
-std::array<float,2>{0.509396195f, 0.322048634f},
-std::array<float,2>{0.163059726f, 0.218206391f},
-std::array<float,2>{0.984721661f, 0.852714658f},
-std::array<float,2>{0.120222203f, 0.922727227f},
-std::array<float,2>{0.782232463f, 0.0610912777f},
-std::array<float,2>{0.359713912f, 0.420438319f},
-std::array<float,2>{0.704898298f, 0.545526743f},
-std::array<float,2>{0.290730506f, 0.779807806f},
-std::array<float,2>{0.638541877f, 0.145267591f},
-std::array<float,2>{0.0207687058f, 0.259903997f},
-std::array<float,2>{0.819761574f, 0.701203048f},
-std::array<float,2>{0.211343825f, 0.585707545f},
-std::array<float,2>{0.906486928f, 0.474419653f},
-std::array<float,2>{0.453981876f, 0.11806374f},
-std::array<float,2>{0.565593183f, 0.947427094f},
-std::array<float,2>{0.451486677f, 0.614831567f},
-std::array<float,2>{0.580878258f, 0.464795947f},
-std::array<float,2>{0.192659527f, 0.0724301934f},
-std::array<float,2>{0.937051177f, 0.972102702f},
-std::array<float,2>{0.00380690908f, 0.809503973f},
-std::array<float,2>{0.843545914f, 0.15714924f},
-std::array<float,2>{0.311746955f, 0.292316258f},
-std::array<float,2>{0.649125934f, 0.720410645f},
-std::array<float,2>{0.354199171f, 0.892841458f},
-std::array<float,2>{0.702305734f, 0.00371234701f},
-std::array<float,2>{0.102750756f, 0.401702374f},
-std::array<float,2>{0.805680633f, 0.516876876f},
-std::array<float,2>{0.174310893f, 0.657160282f},
-std::array<float,2>{0.975716054f, 0.34817937f},
-std::array<float,2>{0.4130826f, 0.237220407f},
-std::array<float,2>{0.529573917f, 0.816620827f},
-std::array<float,2>{0.252586812f, 0.705940425f},
-std::array<float,2>{0.68726784f, 0.273352742f},
-std::array<float,2>{0.0549051575f, 0.137643501f},
-std::array<float,2>{0.861185193f, 0.752935052f},
-std::array<float,2>{0.245310441f, 0.966204166f},
-std::array<float,2>{0.899114251f, 0.0946949497f},
-std::array<float,2>{0.468919694f, 0.489199847f},
-std::array<float,2>{0.618446112f, 0.575371563f},
-std::array<float,2>{0.381976187f, 0.860789955f},
-std::array<float,2>{0.558316529f, 0.195758864f},
-std::array<float,2>{0.137479186f, 0.332681596f},
-std::array<float,2>{0.949602544f, 0.650274694f},
-std::array<float,2>{0.0799848288f, 0.56019026f},
-std::array<float,2>{0.75761193f, 0.43144238f},
-std::array<float,2>{0.333169013f, 0.0456483141f},
-std::array<float,2>{0.723688185f, 0.911503077f},
-std::array<float,2>{0.295041651f, 0.52804482f},
-std::array<float,2>{0.633675337f, 0.391150177f},
-std::array<float,2>{0.0156357046f, 0.0127434693f},
-std::array<float,2>{0.815313935f, 0.90289849f},
-std::array<float,2>{0.217921242f, 0.823913634f},
-std::array<float,2>{0.913312316f, 0.245704234f},
-std::array<float,2>{0.45882982f, 0.35369122f},
-std::array<float,2>{0.567693532f, 0.666247249f},
-std::array<float,2>{0.425017238f, 0.983917475f},
-std::array<float,2>{0.51386708f, 0.0666665435f},
-std::array<float,2>{0.157527849f, 0.453477412f},
-std::array<float,2>{0.988606334f, 0.621153712f},
-std::array<float,2>{0.12412627f, 0.730603158f},
-std::array<float,2>{0.786687315f, 0.281389713f},
-std::array<float,2>{0.364152074f, 0.166963965f},
-std::array<float,2>{0.708001077f, 0.80441308f},
-std::array<float,2>{0.494234771f, 0.647821665f},
-std::array<float,2>{0.600458086f, 0.339532822f},
-std::array<float,2>{0.224490583f, 0.188662067f},
-std::array<float,2>{0.883452594f, 0.874021292f},
-std::array<float,2>{0.046083618f, 0.9156335f},
-std::array<float,2>{0.853424847f, 0.0346726291f},
-std::array<float,2>{0.266312569f, 0.425720572f},
-std::array<float,2>{0.657224655f, 0.546992242f},
-std::array<float,2>{0.322554946f, 0.759291828f},
-std::array<float,2>{0.740754128f, 0.12562412f},
-std::array<float,2>{0.0758404285f, 0.27672857f},
-std::array<float,2>{0.779368997f, 0.717906833f},
-std::array<float,2>{0.14586331f, 0.568091393f},
-std::array<float,2>{0.967331946f, 0.493927538f},
-std::array<float,2>{0.395439088f, 0.109025396f},
-std::array<float,2>{0.534372091f, 0.958953261f},
-std::array<float,2>{0.376270026f, 0.596695662f},
-std::array<float,2>{0.559158921f, 0.440936744f},
-std::array<float,2>{0.134203866f, 0.0904306993f},
-std::array<float,2>{0.948764086f, 0.995051146f},
-std::array<float,2>{0.0839824155f, 0.785140753f},
-std::array<float,2>{0.752242625f, 0.185326889f},
-std::array<float,2>{0.329608381f, 0.303863704f},
-std::array<float,2>{0.718802154f, 0.741949618f},
-std::array<float,2>{0.257461011f, 0.8854146f},
-std::array<float,2>{0.681383371f, 0.0283072591f},
-std::array<float,2>{0.0613116324f, 0.386030018f},
-std::array<float,2>{0.864121675f, 0.510411203f},
-std::array<float,2>{0.249812409f, 0.672811389f},
-std::array<float,2>{0.905815065f, 0.368886828f},
-std::array<float,2>{0.474333107f, 0.222486928f},
-std::array<float,2>{0.624882877f, 0.830746233f},
-std::array<float,2>{0.355897993f, 0.689557195f},
-std::array<float,2>{0.695765316f, 0.250849605f},
-std::array<float,2>{0.107051231f, 0.156055763f},
-std::array<float,2>{0.809618056f, 0.772776186f},
-std::array<float,2>{0.177030146f, 0.9447245f},
-std::array<float,2>{0.972101629f, 0.114365451f},
-std::array<float,2>{0.406748176f, 0.481359661f},
-std::array<float,2>{0.52505517f, 0.592914104f},
-std::array<float,2>{0.448879898f, 0.85042578f},
-std::array<float,2>{0.583612382f, 0.209777713f},
-std::array<float,2>{0.188617229f, 0.317086428f},
-std::array<float,2>{0.9304775f, 0.62613821f},
-std::array<float,2>{0.00558873685f, 0.537322998f},
-std::array<float,2>{0.839334428f, 0.408347934f},
-std::array<float,2>{0.306125581f, 0.0482657738f},
-std::array<float,2>{0.653890789f, 0.933833897f},
-std::array<float,2>{0.339124292f, 0.578604341f},
-std::array<float,2>{0.730842769f, 0.472321153f},
-std::array<float,2>{0.0900969505f, 0.124179892f},
-std::array<float,2>{0.762152076f, 0.951365471f},
-std::array<float,2>{0.125192091f, 0.774014235f},
-std::array<float,2>{0.942424774f, 0.142743766f},
-std::array<float,2>{0.386356562f, 0.262746394f},
-std::array<float,2>{0.553088188f, 0.695972919f},
-std::array<float,2>{0.47798568f, 0.929674566f},
-std::array<float,2>{0.61232686f, 0.057920862f},
-std::array<float,2>{0.238096789f, 0.416299403f},
-std::array<float,2>{0.898226202f, 0.54122901f},
-std::array<float,2>{0.0534896366f, 0.635144472f},
-std::array<float,2>{0.869824469f, 0.325463414f},
-std::array<float,2>{0.262390077f, 0.211168692f},
-std::array<float,2>{0.674685717f, 0.856063545f},
-std::array<float,2>{0.416307449f, 0.746646583f},
-std::array<float,2>{0.523268282f, 0.30922094f},
-std::array<float,2>{0.183352351f, 0.177983925f},
-std::array<float,2>{0.981834412f, 0.791301548f},
-std::array<float,2>{0.100175731f, 0.987289608f},
-std::array<float,2>{0.800004125f, 0.0816426128f},
-std::array<float,2>{0.346315056f, 0.450196981f},
-std::array<float,2>{0.691036403f, 0.604044795f},
-std::array<float,2>{0.297693521f, 0.836209655f},
-std::array<float,2>{0.643217444f, 0.227991462f},
-std::array<float,2>{0.0145319169f, 0.362115085f},
-std::array<float,2>{0.835000396f, 0.687312067f},
-std::array<float,2>{0.198989436f, 0.502073288f},
-std::array<float,2>{0.924924254f, 0.379509896f},
-std::array<float,2>{0.445153236f, 0.0221157335f},
-std::array<float,2>{0.585970283f, 0.881715953f},
-std::array<float,2>{0.465290934f, 0.557252705f},
-std::array<float,2>{0.577942431f, 0.434249252f},
-std::array<float,2>{0.210594416f, 0.0421203747f},
-std::array<float,2>{0.919319093f, 0.908628047f},
-std::array<float,2>{0.0295900349f, 0.865960717f},
-std::array<float,2>{0.825518966f, 0.200558186f},
-std::array<float,2>{0.283582866f, 0.331155151f},
-std::array<float,2>{0.632324755f, 0.653965652f},
-std::array<float,2>{0.372080296f, 0.961319387f},
-std::array<float,2>{0.715646386f, 0.101286277f},
-std::array<float,2>{0.113180719f, 0.487827212f},
-std::array<float,2>{0.796007633f, 0.570682943f},
-std::array<float,2>{0.170336246f, 0.70972091f},
-std::array<float,2>{0.993430138f, 0.26589638f},
-std::array<float,2>{0.431620389f, 0.133559659f},
-std::array<float,2>{0.503693283f, 0.754349828f},
-std::array<float,2>{0.276771665f, 0.660704851f},
-std::array<float,2>{0.671406448f, 0.344428986f},
-std::array<float,2>{0.033315815f, 0.241483048f},
-std::array<float,2>{0.850982308f, 0.814051449f},
-std::array<float,2>{0.231112033f, 0.894600034f},
-std::array<float,2>{0.881017745f, 0.0064780144f},
-std::array<float,2>{0.484863639f, 0.405425459f},
-std::array<float,2>{0.609281957f, 0.520043373f},
-std::array<float,2>{0.402054638f, 0.805692613f},
-std::array<float,2>{0.545231938f, 0.16272673f},
-std::array<float,2>{0.15121752f, 0.294020295f},
-std::array<float,2>{0.954890788f, 0.723445415f},
-std::array<float,2>{0.0646194816f, 0.611829996f},
-std::array<float,2>{0.771068335f, 0.466863096f},
-std::array<float,2>{0.320055872f, 0.0742496401f},
-std::array<float,2>{0.748765469f, 0.975197673f},
-std::array<float,2>{0.259105057f, 0.620211065f},
-std::array<float,2>{0.675871849f, 0.460013807f},
-std::array<float,2>{0.0506428033f, 0.0630969331f},
-std::array<float,2>{0.871865451f, 0.978551507f},
-std::array<float,2>{0.24172996f, 0.798197031f},
-std::array<float,2>{0.89211762f, 0.169511586f},
-std::array<float,2>{0.48158142f, 0.286351562f},
-std::array<float,2>{0.616594374f, 0.727893889f},
-std::array<float,2>{0.388780147f, 0.89958477f},
-std::array<float,2>{0.550032914f, 0.0102885636f},
-std::array<float,2>{0.130509898f, 0.397906333f},
-std::array<float,2>{0.940231502f, 0.523526371f},
-std::array<float,2>{0.0877156109f, 0.670547426f},
-std::array<float,2>{0.760360956f, 0.358103693f},
-std::array<float,2>{0.340221077f, 0.24907513f},
-std::array<float,2>{0.727715611f, 0.826544106f},
-std::array<float,2>{0.44070521f, 0.714004338f},
-std::array<float,2>{0.593717158f, 0.279495895f},
-std::array<float,2>{0.201552004f, 0.131057635f},
-std::array<float,2>{0.928512454f, 0.763335586f},
-std::array<float,2>{0.00987024326f, 0.953344584f},
-std::array<float,2>{0.828771472f, 0.103067242f},
-std::array<float,2>{0.303460121f, 0.496504873f},
-std::array<float,2>{0.646964073f, 0.566070855f},
-std::array<float,2>{0.34945479f, 0.867250621f},
-std::array<float,2>{0.694795012f, 0.192053899f},
-std::array<float,2>{0.0954952687f, 0.343518257f},
-std::array<float,2>{0.803937972f, 0.640704513f},
-std::array<float,2>{0.186922088f, 0.554048955f},
-std::array<float,2>{0.976940155f, 0.428943396f},
-std::array<float,2>{0.418765724f, 0.0364794545f},
-std::array<float,2>{0.516884267f, 0.918266475f},
-std::array<float,2>{0.436390042f, 0.513725162f},
-std::array<float,2>{0.504565895f, 0.390195966f},
-std::array<float,2>{0.165700704f, 0.0238414668f},
-std::array<float,2>{0.99679774f, 0.88960731f},
-std::array<float,2>{0.114694506f, 0.83237344f},
-std::array<float,2>{0.792173445f, 0.222798079f},
-std::array<float,2>{0.367958605f, 0.37141186f},
-std::array<float,2>{0.711384952f, 0.676138282f},
-std::array<float,2>{0.287361622f, 0.997952282f},
-std::array<float,2>{0.627373695f, 0.0893601999f},
-std::array<float,2>{0.026830351f, 0.44145602f},
-std::array<float,2>{0.823964715f, 0.600699782f},
-std::array<float,2>{0.203223795f, 0.735079825f},
-std::array<float,2>{0.914191663f, 0.298751712f},
-std::array<float,2>{0.461048961f, 0.179963872f},
-std::array<float,2>{0.572672904f, 0.785267651f},
-std::array<float,2>{0.31549117f, 0.630058885f},
-std::array<float,2>{0.743677914f, 0.312552422f},
-std::array<float,2>{0.0674648806f, 0.205977485f},
-std::array<float,2>{0.765846968f, 0.844640017f},
-std::array<float,2>{0.155947939f, 0.929739356f},
-std::array<float,2>{0.957305729f, 0.0522526577f},
-std::array<float,2>{0.404435545f, 0.413367122f},
-std::array<float,2>{0.542803586f, 0.532443166f},
-std::array<float,2>{0.488396347f, 0.769128144f},
-std::array<float,2>{0.603112876f, 0.151522249f},
-std::array<float,2>{0.226621732f, 0.257550836f},
-std::array<float,2>{0.8750332f, 0.692275643f},
-std::array<float,2>{0.0388081037f, 0.588613391f},
-std::array<float,2>{0.846263111f, 0.478553534f},
-std::array<float,2>{0.278992593f, 0.111942016f},
-std::array<float,2>{0.664914429f, 0.941304207f},
-std::array<float,2>{0.363233805f, 0.543714285f},
-std::array<float,2>{0.706433654f, 0.419804841f},
-std::array<float,2>{0.118600443f, 0.0586870536f},
-std::array<float,2>{0.785119295f, 0.924372077f},
-std::array<float,2>{0.160985887f, 0.854348958f},
-std::array<float,2>{0.986713648f, 0.215513259f},
-std::array<float,2>{0.426974982f, 0.324014127f},
-std::array<float,2>{0.510757983f, 0.639818311f},
-std::array<float,2>{0.456889242f, 0.94539398f},
-std::array<float,2>{0.562948704f, 0.120239064f},
-std::array<float,2>{0.214592412f, 0.474935204f},
-std::array<float,2>{0.90917021f, 0.582993507f},
-std::array<float,2>{0.0232581738f, 0.700896442f},
-std::array<float,2>{0.818341136f, 0.259066463f},
-std::array<float,2>{0.292672843f, 0.147785828f},
-std::array<float,2>{0.640121043f, 0.779221475f},
-std::array<float,2>{0.392023414f, 0.680358529f},
-std::array<float,2>{0.538036168f, 0.363905609f},
-std::array<float,2>{0.141667515f, 0.23124662f},
-std::array<float,2>{0.964261234f, 0.842219174f},
-std::array<float,2>{0.0729107633f, 0.878262639f},
-std::array<float,2>{0.774420381f, 0.0166511778f},
-std::array<float,2>{0.326965183f, 0.378325522f},
-std::array<float,2>{0.737134695f, 0.50755924f},
-std::array<float,2>{0.271089435f, 0.795755088f},
-std::array<float,2>{0.663648129f, 0.174770638f},
-std::array<float,2>{0.0424539596f, 0.30770728f},
-std::array<float,2>{0.857770264f, 0.743793964f},
-std::array<float,2>{0.219208762f, 0.607699215f},
-std::array<float,2>{0.89007628f, 0.448663712f},
-std::array<float,2>{0.496505052f, 0.0826496556f},
-std::array<float,2>{0.596973002f, 0.990567803f},
-std::array<float,2>{0.47082752f, 0.57631284f},
-std::array<float,2>{0.61982888f, 0.492014319f},
-std::array<float,2>{0.242925033f, 0.0966697112f},
-std::array<float,2>{0.900624692f, 0.96862489f},
-std::array<float,2>{0.0575397201f, 0.75189954f},
-std::array<float,2>{0.862973154f, 0.1387413f},
-std::array<float,2>{0.251681685f, 0.269643664f},
-std::array<float,2>{0.685504138f, 0.704573154f},
-std::array<float,2>{0.33575213f, 0.913484156f},
-std::array<float,2>{0.725791216f, 0.0441365801f},
-std::array<float,2>{0.0809856132f, 0.43321839f},
-std::array<float,2>{0.754552305f, 0.560760319f},
-std::array<float,2>{0.139159203f, 0.65195787f},
-std::array<float,2>{0.952439964f, 0.334211588f},
-std::array<float,2>{0.378962159f, 0.198887467f},
-std::array<float,2>{0.555995822f, 0.8622877f},
-std::array<float,2>{0.309473932f, 0.72257328f},
-std::array<float,2>{0.651347399f, 0.28927058f},
-std::array<float,2>{0.000123235994f, 0.159954846f},
-std::array<float,2>{0.841792524f, 0.810609937f},
-std::array<float,2>{0.19354111f, 0.969475567f},
-std::array<float,2>{0.934362292f, 0.071476154f},
-std::array<float,2>{0.451163024f, 0.462037832f},
-std::array<float,2>{0.578393877f, 0.615444064f},
-std::array<float,2>{0.410669982f, 0.819874525f},
-std::array<float,2>{0.529164135f, 0.235625476f},
-std::array<float,2>{0.172629923f, 0.350321352f},
-std::array<float,2>{0.972688735f, 0.659507811f},
-std::array<float,2>{0.10505148f, 0.519125342f},
-std::array<float,2>{0.80840838f, 0.400252819f},
-std::array<float,2>{0.352262139f, 6.60836167e-06f},
-std::array<float,2>{0.700572371f, 0.892174423f},
-std::array<float,2>{0.305648714f, 0.536458015f},
-std::array<float,2>{0.653048933f, 0.40780437f},
-std::array<float,2>{0.00427716691f, 0.0504988767f},
-std::array<float,2>{0.837994039f, 0.937205851f},
-std::array<float,2>{0.188023955f, 0.848215282f},
-std::array<float,2>{0.930850267f, 0.208281323f},
-std::array<float,2>{0.447752804f, 0.319567472f},
-std::array<float,2>{0.582579851f, 0.6270715f},
-std::array<float,2>{0.407366514f, 0.941664934f},
-std::array<float,2>{0.523962438f, 0.116980992f},
-std::array<float,2>{0.176022127f, 0.483615965f},
-std::array<float,2>{0.97124815f, 0.590841234f},
-std::array<float,2>{0.105765954f, 0.68814677f},
-std::array<float,2>{0.809301555f, 0.253347009f},
-std::array<float,2>{0.357338339f, 0.152872652f},
-std::array<float,2>{0.696536064f, 0.770826042f},
-std::array<float,2>{0.473407477f, 0.675512671f},
-std::array<float,2>{0.623074114f, 0.371065468f},
-std::array<float,2>{0.248601303f, 0.220058173f},
-std::array<float,2>{0.904752076f, 0.828417063f},
-std::array<float,2>{0.0624696948f, 0.883475661f},
-std::array<float,2>{0.865153432f, 0.0302474741f},
-std::array<float,2>{0.256029844f, 0.383138984f},
-std::array<float,2>{0.680255115f, 0.508645236f},
-std::array<float,2>{0.329038411f, 0.782293975f},
-std::array<float,2>{0.720016003f, 0.187100515f},
-std::array<float,2>{0.0820696577f, 0.302080542f},
-std::array<float,2>{0.753241062f, 0.73913002f},
-std::array<float,2>{0.133238643f, 0.595036447f},
-std::array<float,2>{0.947639048f, 0.437916398f},
-std::array<float,2>{0.375268847f, 0.0929485783f},
-std::array<float,2>{0.560056806f, 0.992453814f},
-std::array<float,2>{0.395938009f, 0.569367945f},
-std::array<float,2>{0.534154296f, 0.494821042f},
-std::array<float,2>{0.145117864f, 0.105999678f},
-std::array<float,2>{0.968452632f, 0.960706711f},
-std::array<float,2>{0.0745980367f, 0.761140227f},
-std::array<float,2>{0.781138778f, 0.128009677f},
-std::array<float,2>{0.323578447f, 0.275029749f},
-std::array<float,2>{0.741608858f, 0.715444088f},
-std::array<float,2>{0.267535895f, 0.917066157f},
-std::array<float,2>{0.657327712f, 0.0326521844f},
-std::array<float,2>{0.0453893058f, 0.422520816f},
-std::array<float,2>{0.852147698f, 0.54936254f},
-std::array<float,2>{0.223517418f, 0.645059288f},
-std::array<float,2>{0.884591639f, 0.336665899f},
-std::array<float,2>{0.495740294f, 0.189767867f},
-std::array<float,2>{0.60085541f, 0.871936262f},
-std::array<float,2>{0.364454359f, 0.734301567f},
-std::array<float,2>{0.708835363f, 0.284340113f},
-std::array<float,2>{0.123215795f, 0.16521354f},
-std::array<float,2>{0.785164416f, 0.802566886f},
-std::array<float,2>{0.156754404f, 0.980616689f},
-std::array<float,2>{0.989917994f, 0.0692490339f},
-std::array<float,2>{0.424057901f, 0.455646813f},
-std::array<float,2>{0.514882267f, 0.623906791f},
-std::array<float,2>{0.457770318f, 0.821252167f},
-std::array<float,2>{0.567274034f, 0.24291648f},
-std::array<float,2>{0.217432275f, 0.353131384f},
-std::array<float,2>{0.912164807f, 0.664412618f},
-std::array<float,2>{0.0167842321f, 0.529350817f},
-std::array<float,2>{0.816241443f, 0.393462002f},
-std::array<float,2>{0.296624184f, 0.0154588604f},
-std::array<float,2>{0.634759009f, 0.904742479f},
-std::array<float,2>{0.318428725f, 0.609968007f},
-std::array<float,2>{0.74925679f, 0.46558997f},
-std::array<float,2>{0.0656591728f, 0.0769609809f},
-std::array<float,2>{0.769595444f, 0.974168241f},
-std::array<float,2>{0.151583031f, 0.808522046f},
-std::array<float,2>{0.953382671f, 0.161533788f},
-std::array<float,2>{0.401341528f, 0.295486361f},
-std::array<float,2>{0.546361327f, 0.724723041f},
-std::array<float,2>{0.485838056f, 0.897281706f},
-std::array<float,2>{0.608268201f, 0.00403081439f},
-std::array<float,2>{0.231725484f, 0.404290915f},
-std::array<float,2>{0.881942511f, 0.522625387f},
-std::array<float,2>{0.0343154483f, 0.662381411f},
-std::array<float,2>{0.84992969f, 0.345827311f},
-std::array<float,2>{0.276010484f, 0.240036651f},
-std::array<float,2>{0.670198262f, 0.815899372f},
-std::array<float,2>{0.430647045f, 0.708639383f},
-std::array<float,2>{0.502550066f, 0.269030899f},
-std::array<float,2>{0.171383977f, 0.136408255f},
-std::array<float,2>{0.992215514f, 0.757304728f},
-std::array<float,2>{0.112176865f, 0.963098824f},
-std::array<float,2>{0.795655787f, 0.0979064032f},
-std::array<float,2>{0.371684641f, 0.485395372f},
-std::array<float,2>{0.716310561f, 0.572348714f},
-std::array<float,2>{0.284309328f, 0.863914371f},
-std::array<float,2>{0.631797493f, 0.202355564f},
-std::array<float,2>{0.0303922184f, 0.329945505f},
-std::array<float,2>{0.824290335f, 0.654666662f},
-std::array<float,2>{0.209265202f, 0.555479527f},
-std::array<float,2>{0.917998731f, 0.436976612f},
-std::array<float,2>{0.46649465f, 0.0402053185f},
-std::array<float,2>{0.577103436f, 0.906460106f},
-std::array<float,2>{0.444303572f, 0.500396252f},
-std::array<float,2>{0.587494612f, 0.380911142f},
-std::array<float,2>{0.197564885f, 0.0204442833f},
-std::array<float,2>{0.924751639f, 0.880814791f},
-std::array<float,2>{0.0148203708f, 0.838285863f},
-std::array<float,2>{0.834878683f, 0.229664668f},
-std::array<float,2>{0.29849866f, 0.360075563f},
-std::array<float,2>{0.64367801f, 0.684928834f},
-std::array<float,2>{0.346916914f, 0.985358179f},
-std::array<float,2>{0.690173864f, 0.0792567879f},
-std::array<float,2>{0.101013869f, 0.452509046f},
-std::array<float,2>{0.799225509f, 0.603502393f},
-std::array<float,2>{0.181845918f, 0.748645842f},
-std::array<float,2>{0.981137097f, 0.310756385f},
-std::array<float,2>{0.417512774f, 0.176955432f},
-std::array<float,2>{0.521774113f, 0.789313555f},
-std::array<float,2>{0.262818068f, 0.633918047f},
-std::array<float,2>{0.674811363f, 0.326261908f},
-std::array<float,2>{0.0542096011f, 0.213742226f},
-std::array<float,2>{0.870692194f, 0.858082712f},
-std::array<float,2>{0.23665455f, 0.926731586f},
-std::array<float,2>{0.897188067f, 0.0548943542f},
-std::array<float,2>{0.477481991f, 0.4154962f},
-std::array<float,2>{0.611850858f, 0.540953755f},
-std::array<float,2>{0.385493517f, 0.775887966f},
-std::array<float,2>{0.554630578f, 0.14115037f},
-std::array<float,2>{0.126491189f, 0.264594376f},
-std::array<float,2>{0.94165796f, 0.698370516f},
-std::array<float,2>{0.091023162f, 0.580774128f},
-std::array<float,2>{0.763189554f, 0.468828112f},
-std::array<float,2>{0.338273585f, 0.121673785f},
-std::array<float,2>{0.732049465f, 0.950827122f},
-std::array<float,2>{0.277761847f, 0.586889207f},
-std::array<float,2>{0.665975928f, 0.476616889f},
-std::array<float,2>{0.0376110822f, 0.111122347f},
-std::array<float,2>{0.847162366f, 0.938476026f},
-std::array<float,2>{0.228265211f, 0.767052174f},
-std::array<float,2>{0.876154661f, 0.149832636f},
-std::array<float,2>{0.490009546f, 0.255858123f},
-std::array<float,2>{0.601819634f, 0.694561183f},
-std::array<float,2>{0.405591935f, 0.932543278f},
-std::array<float,2>{0.541962564f, 0.0536405221f},
-std::array<float,2>{0.154994369f, 0.410934806f},
-std::array<float,2>{0.958859086f, 0.53374505f},
-std::array<float,2>{0.0664143637f, 0.63104105f},
-std::array<float,2>{0.767486513f, 0.314676791f},
-std::array<float,2>{0.314615995f, 0.204491168f},
-std::array<float,2>{0.742511868f, 0.84587419f},
-std::array<float,2>{0.462121636f, 0.737223744f},
-std::array<float,2>{0.573922932f, 0.29988572f},
-std::array<float,2>{0.20453696f, 0.182104871f},
-std::array<float,2>{0.9158566f, 0.787752509f},
-std::array<float,2>{0.0254109837f, 0.998331547f},
-std::array<float,2>{0.823084831f, 0.0861324742f},
-std::array<float,2>{0.288556755f, 0.443749666f},
-std::array<float,2>{0.628842711f, 0.597744167f},
-std::array<float,2>{0.368831009f, 0.835338056f},
-std::array<float,2>{0.712097108f, 0.224873558f},
-std::array<float,2>{0.114074655f, 0.374549717f},
-std::array<float,2>{0.791635454f, 0.679111958f},
-std::array<float,2>{0.164270744f, 0.511984408f},
-std::array<float,2>{0.997230232f, 0.388278782f},
-std::array<float,2>{0.437097847f, 0.0256076716f},
-std::array<float,2>{0.505328357f, 0.886861622f},
-std::array<float,2>{0.41983524f, 0.552592635f},
-std::array<float,2>{0.515633047f, 0.426381856f},
-std::array<float,2>{0.18605645f, 0.0381495543f},
-std::array<float,2>{0.978378356f, 0.921497047f},
-std::array<float,2>{0.0940331295f, 0.8702088f},
-std::array<float,2>{0.803084612f, 0.19526571f},
-std::array<float,2>{0.348266363f, 0.341516107f},
-std::array<float,2>{0.693919957f, 0.643224835f},
-std::array<float,2>{0.304439992f, 0.955503047f},
-std::array<float,2>{0.648171484f, 0.105456948f},
-std::array<float,2>{0.010925456f, 0.499866962f},
-std::array<float,2>{0.829742253f, 0.564382792f},
-std::array<float,2>{0.202930793f, 0.712089539f},
-std::array<float,2>{0.928752482f, 0.27791661f},
-std::array<float,2>{0.43987f, 0.1303045f},
-std::array<float,2>{0.592386425f, 0.765037239f},
-std::array<float,2>{0.341020405f, 0.668283224f},
-std::array<float,2>{0.72656846f, 0.356236517f},
-std::array<float,2>{0.0859806687f, 0.246105805f},
-std::array<float,2>{0.761357546f, 0.825243711f},
-std::array<float,2>{0.129781023f, 0.900533855f},
-std::array<float,2>{0.94088614f, 0.00959567633f},
-std::array<float,2>{0.389803618f, 0.395588815f},
-std::array<float,2>{0.549802423f, 0.525928915f},
-std::array<float,2>{0.481213838f, 0.799112439f},
-std::array<float,2>{0.615261555f, 0.170016274f},
-std::array<float,2>{0.240781069f, 0.288438737f},
-std::array<float,2>{0.891444921f, 0.730310023f},
-std::array<float,2>{0.0492328443f, 0.617644846f},
-std::array<float,2>{0.872691154f, 0.45852831f},
-std::array<float,2>{0.258372396f, 0.0655342564f},
-std::array<float,2>{0.677689135f, 0.97797358f},
-std::array<float,2>{0.353198439f, 0.515917182f},
-std::array<float,2>{0.700160921f, 0.400967181f},
-std::array<float,2>{0.104308411f, 0.00236000307f},
-std::array<float,2>{0.807512045f, 0.893673956f},
-std::array<float,2>{0.172888935f, 0.817516148f},
-std::array<float,2>{0.974163294f, 0.237882748f},
-std::array<float,2>{0.411673278f, 0.349409848f},
-std::array<float,2>{0.52790004f, 0.657305062f},
-std::array<float,2>{0.449432075f, 0.971013725f},
-std::array<float,2>{0.579672039f, 0.073545903f},
-std::array<float,2>{0.194761857f, 0.463121623f},
-std::array<float,2>{0.934958994f, 0.613849282f},
-std::array<float,2>{0.0012157755f, 0.718907833f},
-std::array<float,2>{0.840367258f, 0.29150635f},
-std::array<float,2>{0.309856325f, 0.157351598f},
-std::array<float,2>{0.65184325f, 0.810366631f},
-std::array<float,2>{0.380434602f, 0.649053812f},
-std::array<float,2>{0.555483162f, 0.333589464f},
-std::array<float,2>{0.139720201f, 0.196473628f},
-std::array<float,2>{0.951243222f, 0.859693408f},
-std::array<float,2>{0.0818590894f, 0.910803914f},
-std::array<float,2>{0.755810797f, 0.046795316f},
-std::array<float,2>{0.33482334f, 0.430417746f},
-std::array<float,2>{0.725247681f, 0.559163213f},
-std::array<float,2>{0.250508308f, 0.752860963f},
-std::array<float,2>{0.683641136f, 0.138329774f},
-std::array<float,2>{0.0577701293f, 0.271806419f},
-std::array<float,2>{0.862212002f, 0.706598103f},
-std::array<float,2>{0.24354811f, 0.574789643f},
-std::array<float,2>{0.901616752f, 0.489399463f},
-std::array<float,2>{0.472295672f, 0.095361717f},
-std::array<float,2>{0.620639145f, 0.965758145f},
-std::array<float,2>{0.497520804f, 0.605976641f},
-std::array<float,2>{0.595816255f, 0.446709335f},
-std::array<float,2>{0.22038655f, 0.0852096155f},
-std::array<float,2>{0.889050424f, 0.988712251f},
-std::array<float,2>{0.0419891961f, 0.794628799f},
-std::array<float,2>{0.858935416f, 0.173189566f},
-std::array<float,2>{0.269725621f, 0.304904073f},
-std::array<float,2>{0.663045764f, 0.745169938f},
-std::array<float,2>{0.327193975f, 0.876168072f},
-std::array<float,2>{0.738275528f, 0.0194892213f},
-std::array<float,2>{0.0735808909f, 0.3756226f},
-std::array<float,2>{0.774082899f, 0.505550861f},
-std::array<float,2>{0.141228348f, 0.68233192f},
-std::array<float,2>{0.962967098f, 0.366727501f},
-std::array<float,2>{0.390845776f, 0.233702123f},
-std::array<float,2>{0.538802505f, 0.841611207f},
-std::array<float,2>{0.291237444f, 0.702871978f},
-std::array<float,2>{0.639543414f, 0.261060953f},
-std::array<float,2>{0.0218627546f, 0.145630091f},
-std::array<float,2>{0.81655705f, 0.780635953f},
-std::array<float,2>{0.213607311f, 0.948530257f},
-std::array<float,2>{0.909765542f, 0.119129442f},
-std::array<float,2>{0.455806702f, 0.472953379f},
-std::array<float,2>{0.563809216f, 0.584265292f},
-std::array<float,2>{0.42634666f, 0.852432728f},
-std::array<float,2>{0.510455787f, 0.217649519f},
-std::array<float,2>{0.161611617f, 0.320725679f},
-std::array<float,2>{0.987322092f, 0.637879789f},
-std::array<float,2>{0.117898792f, 0.546458662f},
-std::array<float,2>{0.783556581f, 0.421352059f},
-std::array<float,2>{0.361500889f, 0.0618133172f},
-std::array<float,2>{0.705953777f, 0.922924399f},
-std::array<float,2>{0.254352361f, 0.511194348f},
-std::array<float,2>{0.681823254f, 0.385635346f},
-std::array<float,2>{0.0604371093f, 0.0285631325f},
-std::array<float,2>{0.866858363f, 0.886714637f},
-std::array<float,2>{0.246948987f, 0.831873119f},
-std::array<float,2>{0.902859211f, 0.221589282f},
-std::array<float,2>{0.47469905f, 0.367578834f},
-std::array<float,2>{0.622844636f, 0.672966301f},
-std::array<float,2>{0.378480017f, 0.995759547f},
-std::array<float,2>{0.560798705f, 0.0910691172f},
-std::array<float,2>{0.136045739f, 0.439474493f},
-std::array<float,2>{0.94696188f, 0.596600354f},
-std::array<float,2>{0.0854349881f, 0.740887284f},
-std::array<float,2>{0.750767469f, 0.302965224f},
-std::array<float,2>{0.331120282f, 0.18407236f},
-std::array<float,2>{0.721653163f, 0.78375572f},
-std::array<float,2>{0.446268052f, 0.625677049f},
-std::array<float,2>{0.58564806f, 0.317772329f},
-std::array<float,2>{0.190076321f, 0.209993809f},
-std::array<float,2>{0.93214643f, 0.851529181f},
-std::array<float,2>{0.00598674361f, 0.934910595f},
-std::array<float,2>{0.83765322f, 0.0470878333f},
-std::array<float,2>{0.307231963f, 0.409930974f},
-std::array<float,2>{0.654399037f, 0.538383067f},
-std::array<float,2>{0.35806933f, 0.772039533f},
-std::array<float,2>{0.697692811f, 0.155173346f},
-std::array<float,2>{0.107934326f, 0.251880825f},
-std::array<float,2>{0.811369538f, 0.691206872f},
-std::array<float,2>{0.178281769f, 0.591876268f},
-std::array<float,2>{0.96884799f, 0.48234868f},
-std::array<float,2>{0.409892231f, 0.113734111f},
-std::array<float,2>{0.525638938f, 0.94338721f},
-std::array<float,2>{0.423781991f, 0.622410893f},
-std::array<float,2>{0.512860417f, 0.455053568f},
-std::array<float,2>{0.159432039f, 0.0675346553f},
-std::array<float,2>{0.990475178f, 0.98304081f},
-std::array<float,2>{0.121381834f, 0.803041875f},
-std::array<float,2>{0.788230658f, 0.167440161f},
-std::array<float,2>{0.365617961f, 0.282515198f},
-std::array<float,2>{0.70970732f, 0.731899023f},
-std::array<float,2>{0.29401046f, 0.903967798f},
-std::array<float,2>{0.635609388f, 0.0124153169f},
-std::array<float,2>{0.0176506136f, 0.391795635f},
-std::array<float,2>{0.813236058f, 0.528371632f},
-std::array<float,2>{0.215977117f, 0.667263567f},
-std::array<float,2>{0.912064373f, 0.355304092f},
-std::array<float,2>{0.460211098f, 0.244241357f},
-std::array<float,2>{0.568652391f, 0.822633088f},
-std::array<float,2>{0.320506185f, 0.716884315f},
-std::array<float,2>{0.739933133f, 0.275753915f},
-std::array<float,2>{0.0778985843f, 0.126320809f},
-std::array<float,2>{0.777938604f, 0.757901609f},
-std::array<float,2>{0.147713929f, 0.957296193f},
-std::array<float,2>{0.964983284f, 0.107683606f},
-std::array<float,2>{0.397595614f, 0.492540002f},
-std::array<float,2>{0.533067346f, 0.567010701f},
-std::array<float,2>{0.492734492f, 0.874486268f},
-std::array<float,2>{0.598793507f, 0.188314766f},
-std::array<float,2>{0.226149499f, 0.338021725f},
-std::array<float,2>{0.886525214f, 0.646529436f},
-std::array<float,2>{0.0431235805f, 0.548653901f},
-std::array<float,2>{0.854948878f, 0.423886746f},
-std::array<float,2>{0.269444525f, 0.0337341167f},
-std::array<float,2>{0.658271909f, 0.914441943f},
-std::array<float,2>{0.374166936f, 0.571538866f},
-std::array<float,2>{0.71823591f, 0.486592978f},
-std::array<float,2>{0.110495307f, 0.0997144431f},
-std::array<float,2>{0.79393965f, 0.962706029f},
-std::array<float,2>{0.169782698f, 0.754921973f},
-std::array<float,2>{0.99486649f, 0.134475142f},
-std::array<float,2>{0.432995856f, 0.267329663f},
-std::array<float,2>{0.501310289f, 0.710314333f},
-std::array<float,2>{0.467030346f, 0.909591377f},
-std::array<float,2>{0.574730158f, 0.0411421247f},
-std::array<float,2>{0.207262382f, 0.434816033f},
-std::array<float,2>{0.921601951f, 0.557801247f},
-std::array<float,2>{0.0282311644f, 0.652502537f},
-std::array<float,2>{0.828098178f, 0.330710351f},
-std::array<float,2>{0.282673568f, 0.199227303f},
-std::array<float,2>{0.629329979f, 0.866668522f},
-std::array<float,2>{0.398548931f, 0.724301934f},
-std::array<float,2>{0.543992698f, 0.293823868f},
-std::array<float,2>{0.149834901f, 0.163212061f},
-std::array<float,2>{0.956032336f, 0.805060208f},
-std::array<float,2>{0.064240396f, 0.976085901f},
-std::array<float,2>{0.773046851f, 0.0756499022f},
-std::array<float,2>{0.31811884f, 0.468701452f},
-std::array<float,2>{0.747754574f, 0.612532318f},
-std::array<float,2>{0.273538321f, 0.813463867f},
-std::array<float,2>{0.66816628f, 0.241057843f},
-std::array<float,2>{0.0316586196f, 0.345077425f},
-std::array<float,2>{0.847847641f, 0.661868691f},
-std::array<float,2>{0.232653111f, 0.520829678f},
-std::array<float,2>{0.878983498f, 0.404999942f},
-std::array<float,2>{0.487103522f, 0.00703841681f},
-std::array<float,2>{0.606838346f, 0.896374464f},
-std::array<float,2>{0.478823155f, 0.542305291f},
-std::array<float,2>{0.611157715f, 0.417478114f},
-std::array<float,2>{0.23467125f, 0.0566855483f},
-std::array<float,2>{0.895892024f, 0.927894711f},
-std::array<float,2>{0.0523718894f, 0.856467605f},
-std::array<float,2>{0.868420959f, 0.212860718f},
-std::array<float,2>{0.264989585f, 0.325141132f},
-std::array<float,2>{0.672225714f, 0.636007428f},
-std::array<float,2>{0.336106718f, 0.953055501f},
-std::array<float,2>{0.733242929f, 0.123594075f},
-std::array<float,2>{0.092388317f, 0.471601695f},
-std::array<float,2>{0.763737202f, 0.579475343f},
-std::array<float,2>{0.128080145f, 0.696965873f},
-std::array<float,2>{0.945215762f, 0.262187988f},
-std::array<float,2>{0.384591341f, 0.144059241f},
-std::array<float,2>{0.550924659f, 0.774899602f},
-std::array<float,2>{0.299134791f, 0.685765862f},
-std::array<float,2>{0.640803635f, 0.36230576f},
-std::array<float,2>{0.0136202909f, 0.226810649f},
-std::array<float,2>{0.83289057f, 0.837185323f},
-std::array<float,2>{0.195349663f, 0.882234037f},
-std::array<float,2>{0.92217797f, 0.0231453143f},
-std::array<float,2>{0.441481978f, 0.380694747f},
-std::array<float,2>{0.588709235f, 0.503552079f},
-std::array<float,2>{0.414575875f, 0.792718887f},
-std::array<float,2>{0.519635499f, 0.179451138f},
-std::array<float,2>{0.180636287f, 0.309724838f},
-std::array<float,2>{0.98412621f, 0.7478953f},
-std::array<float,2>{0.0978865996f, 0.605123878f},
-std::array<float,2>{0.796996772f, 0.449595392f},
-std::array<float,2>{0.344130129f, 0.0809295252f},
-std::array<float,2>{0.689189494f, 0.987454832f},
-std::array<float,2>{0.286538392f, 0.599715829f},
-std::array<float,2>{0.626544476f, 0.443050534f},
-std::array<float,2>{0.0253437199f, 0.0880259722f},
-std::array<float,2>{0.821002066f, 0.996773779f},
-std::array<float,2>{0.205303192f, 0.786903322f},
-std::array<float,2>{0.917499125f, 0.181368262f},
-std::array<float,2>{0.463382512f, 0.297409296f},
-std::array<float,2>{0.571010649f, 0.735503972f},
-std::array<float,2>{0.434774399f, 0.890471339f},
-std::array<float,2>{0.507625401f, 0.024592761f},
-std::array<float,2>{0.166261569f, 0.388826191f},
-std::array<float,2>{0.999042034f, 0.514922857f},
-std::array<float,2>{0.115609601f, 0.67711395f},
-std::array<float,2>{0.789162755f, 0.372319549f},
-std::array<float,2>{0.36990577f, 0.22390233f},
-std::array<float,2>{0.713107824f, 0.833668709f},
-std::array<float,2>{0.490965426f, 0.692399979f},
-std::array<float,2>{0.60374099f, 0.25638321f},
-std::array<float,2>{0.230369046f, 0.150674611f},
-std::array<float,2>{0.878069699f, 0.768496811f},
-std::array<float,2>{0.0364213772f, 0.939488769f},
-std::array<float,2>{0.84518677f, 0.11239133f},
-std::array<float,2>{0.27934429f, 0.479813248f},
-std::array<float,2>{0.66734755f, 0.589351773f},
-std::array<float,2>{0.313375324f, 0.844936609f},
-std::array<float,2>{0.744724393f, 0.207030162f},
-std::array<float,2>{0.0687053576f, 0.314106524f},
-std::array<float,2>{0.769293845f, 0.629418969f},
-std::array<float,2>{0.154176965f, 0.532061219f},
-std::array<float,2>{0.95972383f, 0.412197202f},
-std::array<float,2>{0.403963506f, 0.0517363772f},
-std::array<float,2>{0.53926909f, 0.931013048f},
-std::array<float,2>{0.387408495f, 0.524727404f},
-std::array<float,2>{0.548189104f, 0.397245646f},
-std::array<float,2>{0.132465333f, 0.0115176886f},
-std::array<float,2>{0.937932312f, 0.8987059f},
-std::array<float,2>{0.0886616558f, 0.827679455f},
-std::array<float,2>{0.758958697f, 0.248612344f},
-std::array<float,2>{0.341903895f, 0.359079182f},
-std::array<float,2>{0.728576005f, 0.671154022f},
-std::array<float,2>{0.261022866f, 0.979863167f},
-std::array<float,2>{0.678382874f, 0.06408564f},
-std::array<float,2>{0.0479913279f, 0.459414333f},
-std::array<float,2>{0.873596966f, 0.619176447f},
-std::array<float,2>{0.239679039f, 0.727523506f},
-std::array<float,2>{0.893559337f, 0.285611808f},
-std::array<float,2>{0.483540714f, 0.168198749f},
-std::array<float,2>{0.614724457f, 0.796968997f},
-std::array<float,2>{0.350258321f, 0.642469347f},
-std::array<float,2>{0.692380428f, 0.341854453f},
-std::array<float,2>{0.0965782106f, 0.192710787f},
-std::array<float,2>{0.802078307f, 0.868707299f},
-std::array<float,2>{0.185133755f, 0.919325471f},
-std::array<float,2>{0.980410814f, 0.0359395854f},
-std::array<float,2>{0.420780689f, 0.428319335f},
-std::array<float,2>{0.51840353f, 0.552924335f},
-std::array<float,2>{0.439018816f, 0.762023091f},
-std::array<float,2>{0.591785789f, 0.13230519f},
-std::array<float,2>{0.199404314f, 0.280905753f},
-std::array<float,2>{0.926276028f, 0.713664591f},
-std::array<float,2>{0.00954143237f, 0.564834654f},
-std::array<float,2>{0.831294775f, 0.497175336f},
-std::array<float,2>{0.300930709f, 0.10207849f},
-std::array<float,2>{0.64612639f, 0.954225063f},
-std::array<float,2>{0.332439154f, 0.562002122f},
-std::array<float,2>{0.722822666f, 0.432332754f},
-std::array<float,2>{0.0786928013f, 0.0432710424f},
-std::array<float,2>{0.755968213f, 0.912356794f},
-std::array<float,2>{0.137971953f, 0.863177299f},
-std::array<float,2>{0.950456679f, 0.198145315f},
-std::array<float,2>{0.381369025f, 0.335817724f},
-std::array<float,2>{0.557086527f, 0.651202202f},
-std::array<float,2>{0.470406562f, 0.967734993f},
-std::array<float,2>{0.617585838f, 0.0969677642f},
-std::array<float,2>{0.244724318f, 0.49096632f},
-std::array<float,2>{0.89964515f, 0.577924848f},
-std::array<float,2>{0.0560520664f, 0.703188956f},
-std::array<float,2>{0.860151708f, 0.270861f},
-std::array<float,2>{0.25325048f, 0.139684722f},
-std::array<float,2>{0.685716808f, 0.750005186f},
-std::array<float,2>{0.413823128f, 0.658785105f},
-std::array<float,2>{0.53102082f, 0.351209939f},
-std::array<float,2>{0.175740451f, 0.235017747f},
-std::array<float,2>{0.974643409f, 0.818566382f},
-std::array<float,2>{0.102332182f, 0.891357183f},
-std::array<float,2>{0.805180848f, 0.00171657768f},
-std::array<float,2>{0.354846507f, 0.399046928f},
-std::array<float,2>{0.701539636f, 0.51817745f},
-std::array<float,2>{0.311253458f, 0.812341213f},
-std::array<float,2>{0.649543405f, 0.158366159f},
-std::array<float,2>{0.0026326871f, 0.290655702f},
-std::array<float,2>{0.842423022f, 0.720787704f},
-std::array<float,2>{0.191595301f, 0.616902411f},
-std::array<float,2>{0.935594022f, 0.461907566f},
-std::array<float,2>{0.452815682f, 0.0704496801f},
-std::array<float,2>{0.581270635f, 0.969967306f},
-std::array<float,2>{0.454341352f, 0.583271563f},
-std::array<float,2>{0.564514995f, 0.475745142f},
-std::array<float,2>{0.212326214f, 0.120004065f},
-std::array<float,2>{0.907302082f, 0.947004676f},
-std::array<float,2>{0.0200470574f, 0.777654767f},
-std::array<float,2>{0.818399608f, 0.146843895f},
-std::array<float,2>{0.289198518f, 0.258743525f},
-std::array<float,2>{0.637690723f, 0.699782014f},
-std::array<float,2>{0.361102819f, 0.925648332f},
-std::array<float,2>{0.703773618f, 0.0597150885f},
-std::array<float,2>{0.119564831f, 0.417991132f},
-std::array<float,2>{0.781360388f, 0.544285119f},
-std::array<float,2>{0.163265646f, 0.638764262f},
-std::array<float,2>{0.986020684f, 0.323185235f},
-std::array<float,2>{0.429648519f, 0.21645382f},
-std::array<float,2>{0.507962525f, 0.854895532f},
-std::array<float,2>{0.271968573f, 0.743042827f},
-std::array<float,2>{0.661615729f, 0.307204515f},
-std::array<float,2>{0.040978197f, 0.174893826f},
-std::array<float,2>{0.856411994f, 0.796652794f},
-std::array<float,2>{0.220719993f, 0.991689622f},
-std::array<float,2>{0.888133109f, 0.0831346437f},
-std::array<float,2>{0.499074399f, 0.448045313f},
-std::array<float,2>{0.594281614f, 0.608940125f},
-std::array<float,2>{0.392950773f, 0.843679607f},
-std::array<float,2>{0.535209239f, 0.231923625f},
-std::array<float,2>{0.144207656f, 0.364835262f},
-std::array<float,2>{0.961680174f, 0.680990577f},
-std::array<float,2>{0.0709733963f, 0.506763399f},
-std::array<float,2>{0.776269197f, 0.377845436f},
-std::array<float,2>{0.325545013f, 0.0159823298f},
-std::array<float,2>{0.735841215f, 0.877344787f},
-std::array<float,2>{0.28070125f, 0.534157157f},
-std::array<float,2>{0.666791379f, 0.41065073f},
-std::array<float,2>{0.0352815613f, 0.0533668436f},
-std::array<float,2>{0.843781352f, 0.932286203f},
-std::array<float,2>{0.228785649f, 0.845957994f},
-std::array<float,2>{0.877047598f, 0.204334155f},
-std::array<float,2>{0.491949022f, 0.314697593f},
-std::array<float,2>{0.605354548f, 0.63115716f},
-std::array<float,2>{0.402406424f, 0.938003004f},
-std::array<float,2>{0.540741742f, 0.110955857f},
-std::array<float,2>{0.1530108f, 0.476891577f},
-std::array<float,2>{0.960184634f, 0.586575389f},
-std::array<float,2>{0.0702250525f, 0.694650888f},
-std::array<float,2>{0.76851958f, 0.255414486f},
-std::array<float,2>{0.31417051f, 0.149621725f},
-std::array<float,2>{0.745634258f, 0.766721845f},
-std::array<float,2>{0.464759201f, 0.678815544f},
-std::array<float,2>{0.571626365f, 0.374861747f},
-std::array<float,2>{0.206442729f, 0.22463347f},
-std::array<float,2>{0.916430056f, 0.835136116f},
-std::array<float,2>{0.0243141819f, 0.88716948f},
-std::array<float,2>{0.821819782f, 0.0256767496f},
-std::array<float,2>{0.28579703f, 0.388666987f},
-std::array<float,2>{0.625065446f, 0.511899471f},
-std::array<float,2>{0.370281398f, 0.787885189f},
-std::array<float,2>{0.714706659f, 0.181781664f},
-std::array<float,2>{0.117026553f, 0.300143331f},
-std::array<float,2>{0.790474534f, 0.737012208f},
-std::array<float,2>{0.167259827f, 0.598032653f},
-std::array<float,2>{0.99873805f, 0.44359681f},
-std::array<float,2>{0.434510857f, 0.0863819793f},
-std::array<float,2>{0.506767273f, 0.998093307f},
-std::array<float,2>{0.421816558f, 0.564028442f},
-std::array<float,2>{0.519021451f, 0.499625325f},
-std::array<float,2>{0.184419692f, 0.105196826f},
-std::array<float,2>{0.979474127f, 0.955205798f},
-std::array<float,2>{0.0967486575f, 0.764756978f},
-std::array<float,2>{0.801370382f, 0.130075082f},
-std::array<float,2>{0.3506217f, 0.2782695f},
-std::array<float,2>{0.693192899f, 0.712228954f},
-std::array<float,2>{0.301911116f, 0.921699762f},
-std::array<float,2>{0.645348132f, 0.038490627f},
-std::array<float,2>{0.00865708571f, 0.426585972f},
-std::array<float,2>{0.831047535f, 0.55242461f},
-std::array<float,2>{0.200905934f, 0.643334568f},
-std::array<float,2>{0.926837087f, 0.341730446f},
-std::array<float,2>{0.437563986f, 0.194881886f},
-std::array<float,2>{0.590282857f, 0.870448232f},
-std::array<float,2>{0.342959911f, 0.730206966f},
-std::array<float,2>{0.730292141f, 0.288247436f},
-std::array<float,2>{0.0895171762f, 0.170182452f},
-std::array<float,2>{0.758681238f, 0.799057066f},
-std::array<float,2>{0.131057188f, 0.977696061f},
-std::array<float,2>{0.939090788f, 0.065917246f},
-std::array<float,2>{0.388308972f, 0.458777636f},
-std::array<float,2>{0.54718703f, 0.617263913f},
-std::array<float,2>{0.483118445f, 0.8255288f},
-std::array<float,2>{0.613909006f, 0.246406779f},
-std::array<float,2>{0.238964945f, 0.355958372f},
-std::array<float,2>{0.892626047f, 0.668102741f},
-std::array<float,2>{0.0470332131f, 0.526164055f},
-std::array<float,2>{0.87442416f, 0.395755351f},
-std::array<float,2>{0.259885639f, 0.00932370685f},
-std::array<float,2>{0.678783238f, 0.900709391f},
-std::array<float,2>{0.353975147f, 0.614214003f},
-std::array<float,2>{0.703044832f, 0.463268012f},
-std::array<float,2>{0.103120588f, 0.0734754279f},
-std::array<float,2>{0.806618035f, 0.970732927f},
-std::array<float,2>{0.174530357f, 0.810151756f},
-std::array<float,2>{0.976202011f, 0.157480046f},
-std::array<float,2>{0.412382066f, 0.291818738f},
-std::array<float,2>{0.529934943f, 0.71909517f},
-std::array<float,2>{0.452109128f, 0.894015253f},
-std::array<float,2>{0.580128491f, 0.00211534766f},
-std::array<float,2>{0.192880392f, 0.401176393f},
-std::array<float,2>{0.936733961f, 0.515752733f},
-std::array<float,2>{0.00333144027f, 0.657579839f},
-std::array<float,2>{0.842837214f, 0.349194646f},
-std::array<float,2>{0.312136054f, 0.238112807f},
-std::array<float,2>{0.64854151f, 0.817727804f},
-std::array<float,2>{0.382499993f, 0.707004488f},
-std::array<float,2>{0.557891309f, 0.271538556f},
-std::array<float,2>{0.137073949f, 0.138446152f},
-std::array<float,2>{0.949791431f, 0.752501369f},
-std::array<float,2>{0.0793394223f, 0.965459168f},
-std::array<float,2>{0.756911159f, 0.0955921188f},
-std::array<float,2>{0.333591104f, 0.489515156f},
-std::array<float,2>{0.724156857f, 0.575005591f},
-std::array<float,2>{0.252215832f, 0.859570265f},
-std::array<float,2>{0.686552763f, 0.196747154f},
-std::array<float,2>{0.0552745238f, 0.333864808f},
-std::array<float,2>{0.860718131f, 0.649174392f},
-std::array<float,2>{0.245664909f, 0.559467137f},
-std::array<float,2>{0.898507953f, 0.430641651f},
-std::array<float,2>{0.469415218f, 0.0465001389f},
-std::array<float,2>{0.619090259f, 0.91106391f},
-std::array<float,2>{0.498426974f, 0.505636573f},
-std::array<float,2>{0.595459878f, 0.375852764f},
-std::array<float,2>{0.222145751f, 0.0192135703f},
-std::array<float,2>{0.887639284f, 0.876265645f},
-std::array<float,2>{0.0395698473f, 0.841449857f},
-std::array<float,2>{0.857257187f, 0.233560994f},
-std::array<float,2>{0.273256361f, 0.367174953f},
-std::array<float,2>{0.66042906f, 0.682411134f},
-std::array<float,2>{0.324801087f, 0.988487959f},
-std::array<float,2>{0.735226691f, 0.085160844f},
-std::array<float,2>{0.0719164833f, 0.446394652f},
-std::array<float,2>{0.776644468f, 0.60640347f},
-std::array<float,2>{0.143104553f, 0.74540931f},
-std::array<float,2>{0.962228417f, 0.305062205f},
-std::array<float,2>{0.393913239f, 0.172908619f},
-std::array<float,2>{0.536931932f, 0.794748962f},
-std::array<float,2>{0.290041775f, 0.638133883f},
-std::array<float,2>{0.638176501f, 0.3205176f},
-std::array<float,2>{0.0213389974f, 0.217425138f},
-std::array<float,2>{0.820251465f, 0.852162659f},
-std::array<float,2>{0.211722508f, 0.92312628f},
-std::array<float,2>{0.907083094f, 0.0615251847f},
-std::array<float,2>{0.453224063f, 0.420954496f},
-std::array<float,2>{0.566332281f, 0.546851993f},
-std::array<float,2>{0.427912891f, 0.780502021f},
-std::array<float,2>{0.509123027f, 0.145827621f},
-std::array<float,2>{0.16218999f, 0.260945469f},
-std::array<float,2>{0.985237241f, 0.702899039f},
-std::array<float,2>{0.121060431f, 0.584112942f},
-std::array<float,2>{0.783004999f, 0.472891539f},
-std::array<float,2>{0.360062659f, 0.118657731f},
-std::array<float,2>{0.704500675f, 0.948433459f},
-std::array<float,2>{0.30821836f, 0.591211319f},
-std::array<float,2>{0.655356646f, 0.483816475f},
-std::array<float,2>{0.00739150867f, 0.116702847f},
-std::array<float,2>{0.836113989f, 0.941509664f},
-std::array<float,2>{0.190502256f, 0.770511806f},
-std::array<float,2>{0.933254004f, 0.15308097f},
-std::array<float,2>{0.44709307f, 0.253129572f},
-std::array<float,2>{0.584056795f, 0.688342094f},
-std::array<float,2>{0.408253878f, 0.937363088f},
-std::array<float,2>{0.526542842f, 0.0507137552f},
-std::array<float,2>{0.17874223f, 0.40820241f},
-std::array<float,2>{0.97013104f, 0.536273539f},
-std::array<float,2>{0.10858532f, 0.627418876f},
-std::array<float,2>{0.812393963f, 0.319811136f},
-std::array<float,2>{0.358461231f, 0.208027586f},
-std::array<float,2>{0.698383093f, 0.848392487f},
-std::array<float,2>{0.476307541f, 0.738930047f},
-std::array<float,2>{0.62179327f, 0.301776469f},
-std::array<float,2>{0.247892544f, 0.187431827f},
-std::array<float,2>{0.903698504f, 0.782521486f},
-std::array<float,2>{0.0587126017f, 0.992299139f},
-std::array<float,2>{0.865631044f, 0.0931989402f},
-std::array<float,2>{0.255247146f, 0.437706292f},
-std::array<float,2>{0.682641625f, 0.594763458f},
-std::array<float,2>{0.330374241f, 0.828362346f},
-std::array<float,2>{0.722211003f, 0.219787329f},
-std::array<float,2>{0.0841831639f, 0.370785713f},
-std::array<float,2>{0.751496017f, 0.675646901f},
-std::array<float,2>{0.135253355f, 0.508412957f},
-std::array<float,2>{0.945447564f, 0.382879376f},
-std::array<float,2>{0.377626002f, 0.0299492832f},
-std::array<float,2>{0.56242305f, 0.883681953f},
-std::array<float,2>{0.396643013f, 0.549783051f},
-std::array<float,2>{0.531482518f, 0.422625691f},
-std::array<float,2>{0.14714101f, 0.0324529111f},
-std::array<float,2>{0.965827227f, 0.917294085f},
-std::array<float,2>{0.0770563483f, 0.871629477f},
-std::array<float,2>{0.778323829f, 0.189591601f},
-std::array<float,2>{0.3214131f, 0.336812496f},
-std::array<float,2>{0.739210784f, 0.645324051f},
-std::array<float,2>{0.268436581f, 0.960686922f},
-std::array<float,2>{0.659872293f, 0.106201753f},
-std::array<float,2>{0.0448679067f, 0.495079279f},
-std::array<float,2>{0.854379654f, 0.569605947f},
-std::array<float,2>{0.225393564f, 0.715696275f},
-std::array<float,2>{0.885214448f, 0.275332063f},
-std::array<float,2>{0.494116545f, 0.128201067f},
-std::array<float,2>{0.597959399f, 0.760847449f},
-std::array<float,2>{0.366980284f, 0.664303422f},
-std::array<float,2>{0.710215807f, 0.353468031f},
-std::array<float,2>{0.122455008f, 0.24314709f},
-std::array<float,2>{0.787717223f, 0.820900619f},
-std::array<float,2>{0.158372328f, 0.904304266f},
-std::array<float,2>{0.991241455f, 0.0152925393f},
-std::array<float,2>{0.422290295f, 0.393254727f},
-std::array<float,2>{0.512353241f, 0.529559016f},
-std::array<float,2>{0.459494501f, 0.802320838f},
-std::array<float,2>{0.569871664f, 0.165320531f},
-std::array<float,2>{0.2151995f, 0.284574538f},
-std::array<float,2>{0.910318732f, 0.733925521f},
-std::array<float,2>{0.0187274329f, 0.623543322f},
-std::array<float,2>{0.813881755f, 0.455822259f},
-std::array<float,2>{0.293819606f, 0.0688625872f},
-std::array<float,2>{0.63615787f, 0.980916858f},
-std::array<float,2>{0.316851974f, 0.522787452f},
-std::array<float,2>{0.746143222f, 0.403866082f},
-std::array<float,2>{0.0626859143f, 0.00437344797f},
-std::array<float,2>{0.771857858f, 0.897024691f},
-std::array<float,2>{0.148607209f, 0.81554389f},
-std::array<float,2>{0.95677489f, 0.239747614f},
-std::array<float,2>{0.399721533f, 0.345948458f},
-std::array<float,2>{0.543172717f, 0.662296355f},
-std::array<float,2>{0.487929612f, 0.974427521f},
-std::array<float,2>{0.606368959f, 0.0767352581f},
-std::array<float,2>{0.233936071f, 0.465568185f},
-std::array<float,2>{0.880538225f, 0.610125721f},
-std::array<float,2>{0.0324836746f, 0.724886954f},
-std::array<float,2>{0.849290431f, 0.295756489f},
-std::array<float,2>{0.274541736f, 0.161262661f},
-std::array<float,2>{0.669111729f, 0.808168769f},
-std::array<float,2>{0.431836218f, 0.654523671f},
-std::array<float,2>{0.500360608f, 0.32964325f},
-std::array<float,2>{0.168709919f, 0.202400863f},
-std::array<float,2>{0.995318353f, 0.864062369f},
-std::array<float,2>{0.11001429f, 0.906523526f},
-std::array<float,2>{0.794417143f, 0.0404971205f},
-std::array<float,2>{0.373657793f, 0.436587065f},
-std::array<float,2>{0.717132151f, 0.555250645f},
-std::array<float,2>{0.282064527f, 0.757021427f},
-std::array<float,2>{0.63063997f, 0.136594415f},
-std::array<float,2>{0.0283890925f, 0.268602937f},
-std::array<float,2>{0.826646805f, 0.708792329f},
-std::array<float,2>{0.208737552f, 0.572589755f},
-std::array<float,2>{0.920455456f, 0.485814214f},
-std::array<float,2>{0.468726724f, 0.0977566242f},
-std::array<float,2>{0.575480402f, 0.963281512f},
-std::array<float,2>{0.443077892f, 0.603042662f},
-std::array<float,2>{0.589184761f, 0.452346236f},
-std::array<float,2>{0.197110817f, 0.0794612765f},
-std::array<float,2>{0.923349321f, 0.985779703f},
-std::array<float,2>{0.0126806758f, 0.789292216f},
-std::array<float,2>{0.833583951f, 0.177127555f},
-std::array<float,2>{0.300625652f, 0.310834497f},
-std::array<float,2>{0.642014861f, 0.748858213f},
-std::array<float,2>{0.345070302f, 0.880468428f},
-std::array<float,2>{0.688346744f, 0.0201094672f},
-std::array<float,2>{0.0993093401f, 0.381156474f},
-std::array<float,2>{0.798372626f, 0.500093758f},
-std::array<float,2>{0.180804163f, 0.684631407f},
-std::array<float,2>{0.982494891f, 0.36022687f},
-std::array<float,2>{0.415309131f, 0.229913622f},
-std::array<float,2>{0.521470904f, 0.838046372f},
-std::array<float,2>{0.264408916f, 0.698498964f},
-std::array<float,2>{0.673196614f, 0.264228404f},
-std::array<float,2>{0.051594954f, 0.141411781f},
-std::array<float,2>{0.867439747f, 0.776364744f},
-std::array<float,2>{0.23620908f, 0.951020598f},
-std::array<float,2>{0.894956052f, 0.121891499f},
-std::array<float,2>{0.479493231f, 0.469027728f},
-std::array<float,2>{0.609997749f, 0.580986619f},
-std::array<float,2>{0.383469701f, 0.858247638f},
-std::array<float,2>{0.552417994f, 0.213467419f},
-std::array<float,2>{0.127218902f, 0.326438636f},
-std::array<float,2>{0.943430781f, 0.634084046f},
-std::array<float,2>{0.0937276185f, 0.54073751f},
-std::array<float,2>{0.765339196f, 0.41521886f},
-std::array<float,2>{0.337652773f, 0.0551008433f},
-std::array<float,2>{0.733521461f, 0.926299691f},
-std::array<float,2>{0.287659973f, 0.51464957f},
-std::array<float,2>{0.62783438f, 0.389011323f},
-std::array<float,2>{0.0269979313f, 0.0248323455f},
-std::array<float,2>{0.823667586f, 0.890309393f},
-std::array<float,2>{0.20400463f, 0.833872855f},
-std::array<float,2>{0.914672315f, 0.22370404f},
-std::array<float,2>{0.46173501f, 0.372138381f},
-std::array<float,2>{0.572887003f, 0.676927745f},
-std::array<float,2>{0.435682178f, 0.996995091f},
-std::array<float,2>{0.504013896f, 0.0881571248f},
-std::array<float,2>{0.165390268f, 0.443266004f},
-std::array<float,2>{0.996097028f, 0.599957645f},
-std::array<float,2>{0.115115672f, 0.735831439f},
-std::array<float,2>{0.792956173f, 0.297808915f},
-std::array<float,2>{0.367215723f, 0.181435391f},
-std::array<float,2>{0.711623728f, 0.786728323f},
-std::array<float,2>{0.488773614f, 0.629760146f},
-std::array<float,2>{0.602759719f, 0.314263254f},
-std::array<float,2>{0.227353498f, 0.206682384f},
-std::array<float,2>{0.875709295f, 0.845193267f},
-std::array<float,2>{0.0385290198f, 0.930790603f},
-std::array<float,2>{0.845849395f, 0.0513943732f},
-std::array<float,2>{0.278339297f, 0.412575632f},
-std::array<float,2>{0.664068222f, 0.531838477f},
-std::array<float,2>{0.316319644f, 0.768226922f},
-std::array<float,2>{0.743191838f, 0.150559649f},
-std::array<float,2>{0.0683540329f, 0.256603539f},
-std::array<float,2>{0.766333818f, 0.692766309f},
-std::array<float,2>{0.155384973f, 0.589101434f},
-std::array<float,2>{0.957559705f, 0.479643732f},
-std::array<float,2>{0.404934466f, 0.112563752f},
-std::array<float,2>{0.542209566f, 0.93979454f},
-std::array<float,2>{0.389644414f, 0.61948061f},
-std::array<float,2>{0.550748825f, 0.459078968f},
-std::array<float,2>{0.130229935f, 0.0642316714f},
-std::array<float,2>{0.939569712f, 0.97961551f},
-std::array<float,2>{0.0871706754f, 0.797228873f},
-std::array<float,2>{0.759810686f, 0.168418765f},
-std::array<float,2>{0.340746492f, 0.285159111f},
-std::array<float,2>{0.728157222f, 0.727187991f},
-std::array<float,2>{0.259713501f, 0.898681581f},
-std::array<float,2>{0.67663312f, 0.0114191575f},
-std::array<float,2>{0.0500425957f, 0.396995485f},
-std::array<float,2>{0.87141484f, 0.52455014f},
-std::array<float,2>{0.241322935f, 0.670936227f},
-std::array<float,2>{0.891725957f, 0.359357178f},
-std::array<float,2>{0.482249349f, 0.248993456f},
-std::array<float,2>{0.616982102f, 0.827913523f},
-std::array<float,2>{0.348692209f, 0.713611364f},
-std::array<float,2>{0.695021272f, 0.281144381f},
-std::array<float,2>{0.0949006304f, 0.13186577f},
-std::array<float,2>{0.804620087f, 0.761721134f},
-std::array<float,2>{0.187362999f, 0.954395235f},
-std::array<float,2>{0.977126896f, 0.102536544f},
-std::array<float,2>{0.418037206f, 0.497431666f},
-std::array<float,2>{0.517315149f, 0.564573228f},
-std::array<float,2>{0.441220433f, 0.868983805f},
-std::array<float,2>{0.593159199f, 0.19242233f},
-std::array<float,2>{0.201912627f, 0.342269808f},
-std::array<float,2>{0.927805543f, 0.64223069f},
-std::array<float,2>{0.0102898516f, 0.553125501f},
-std::array<float,2>{0.828246832f, 0.428654253f},
-std::array<float,2>{0.303114772f, 0.0357873514f},
-std::array<float,2>{0.64708513f, 0.919101536f},
-std::array<float,2>{0.335232794f, 0.577804625f},
-std::array<float,2>{0.726508856f, 0.49115628f},
-std::array<float,2>{0.0801649243f, 0.0966952518f},
-std::array<float,2>{0.754025161f, 0.9673751f},
-std::array<float,2>{0.139387384f, 0.750394344f},
-std::array<float,2>{0.952751696f, 0.140005559f},
-std::array<float,2>{0.379537702f, 0.270636678f},
-std::array<float,2>{0.556162536f, 0.703452051f},
-std::array<float,2>{0.471385777f, 0.912320673f},
-std::array<float,2>{0.619545162f, 0.0430771187f},
-std::array<float,2>{0.242338061f, 0.432509273f},
-std::array<float,2>{0.901005745f, 0.561689556f},
-std::array<float,2>{0.0570626408f, 0.650981665f},
-std::array<float,2>{0.862661839f, 0.335562319f},
-std::array<float,2>{0.251018286f, 0.197868794f},
-std::array<float,2>{0.684838593f, 0.862956405f},
-std::array<float,2>{0.410219878f, 0.721176147f},
-std::array<float,2>{0.528663635f, 0.29097724f},
-std::array<float,2>{0.172181115f, 0.158451334f},
-std::array<float,2>{0.973447382f, 0.812168777f},
-std::array<float,2>{0.104690865f, 0.969979942f},
-std::array<float,2>{0.807703376f, 0.0706681311f},
-std::array<float,2>{0.351876587f, 0.46144855f},
-std::array<float,2>{0.700969696f, 0.617084324f},
-std::array<float,2>{0.308960021f, 0.818609416f},
-std::array<float,2>{0.650527894f, 0.235146955f},
-std::array<float,2>{0.000969005749f, 0.351388484f},
-std::array<float,2>{0.84087795f, 0.65910387f},
-std::array<float,2>{0.194031522f, 0.518406928f},
-std::array<float,2>{0.933872402f, 0.399380922f},
-std::array<float,2>{0.450413018f, 0.00162963569f},
-std::array<float,2>{0.578634322f, 0.891513288f},
-std::array<float,2>{0.456286043f, 0.544042051f},
-std::array<float,2>{0.563386142f, 0.418218464f},
-std::array<float,2>{0.214243278f, 0.0598301254f},
-std::array<float,2>{0.908305407f, 0.925334036f},
-std::array<float,2>{0.0228117574f, 0.854541361f},
-std::array<float,2>{0.817439318f, 0.216765836f},
-std::array<float,2>{0.292262852f, 0.322939515f},
-std::array<float,2>{0.640473843f, 0.639110267f},
-std::array<float,2>{0.362490803f, 0.947243571f},
-std::array<float,2>{0.706696808f, 0.119752146f},
-std::array<float,2>{0.118677564f, 0.476001382f},
-std::array<float,2>{0.784245133f, 0.583071172f},
-std::array<float,2>{0.160161003f, 0.700067878f},
-std::array<float,2>{0.986819029f, 0.258310407f},
-std::array<float,2>{0.427391678f, 0.146680817f},
-std::array<float,2>{0.511584878f, 0.777386844f},
-std::array<float,2>{0.270894378f, 0.680767119f},
-std::array<float,2>{0.663255274f, 0.365034968f},
-std::array<float,2>{0.0425523669f, 0.231643438f},
-std::array<float,2>{0.858290672f, 0.843496203f},
-std::array<float,2>{0.219476834f, 0.877189934f},
-std::array<float,2>{0.890540719f, 0.0157084558f},
-std::array<float,2>{0.496721745f, 0.377681077f},
-std::array<float,2>{0.597554862f, 0.506382585f},
-std::array<float,2>{0.392175943f, 0.796452761f},
-std::array<float,2>{0.537112772f, 0.175238162f},
-std::array<float,2>{0.142205477f, 0.307400644f},
-std::array<float,2>{0.964741409f, 0.742912412f},
-std::array<float,2>{0.0723014101f, 0.609350562f},
-std::array<float,2>{0.775249839f, 0.447829545f},
-std::array<float,2>{0.326598793f, 0.0834265798f},
-std::array<float,2>{0.736336231f, 0.991236925f},
-std::array<float,2>{0.256958067f, 0.596199811f},
-std::array<float,2>{0.680676222f, 0.439717591f},
-std::array<float,2>{0.060855303f, 0.09085875f},
-std::array<float,2>{0.863467276f, 0.996020496f},
-std::array<float,2>{0.249308676f, 0.784147799f},
-std::array<float,2>{0.905743301f, 0.18378593f},
-std::array<float,2>{0.47374776f, 0.303210378f},
-std::array<float,2>{0.624421716f, 0.741008341f},
-std::array<float,2>{0.376769155f, 0.886371851f},
-std::array<float,2>{0.558885634f, 0.0287846103f},
-std::array<float,2>{0.13433966f, 0.385291845f},
-std::array<float,2>{0.948631823f, 0.510873616f},
-std::array<float,2>{0.0832018331f, 0.673336327f},
-std::array<float,2>{0.752827644f, 0.367208511f},
-std::array<float,2>{0.329113692f, 0.221412852f},
-std::array<float,2>{0.719274461f, 0.831589341f},
-std::array<float,2>{0.448509753f, 0.691087723f},
-std::array<float,2>{0.583395839f, 0.251580179f},
-std::array<float,2>{0.189407974f, 0.154971197f},
-std::array<float,2>{0.930024445f, 0.772253931f},
-std::array<float,2>{0.00497054355f, 0.943790853f},
-std::array<float,2>{0.839788616f, 0.113417111f},
-std::array<float,2>{0.306502074f, 0.482104659f},
-std::array<float,2>{0.653465986f, 0.592223048f},
-std::array<float,2>{0.35619688f, 0.851281047f},
-std::array<float,2>{0.695931196f, 0.210434869f},
-std::array<float,2>{0.106638208f, 0.317415714f},
-std::array<float,2>{0.81053102f, 0.625788152f},
-std::array<float,2>{0.177474514f, 0.538217306f},
-std::array<float,2>{0.972339869f, 0.409770668f},
-std::array<float,2>{0.406427145f, 0.0472587422f},
-std::array<float,2>{0.524528444f, 0.934644103f},
-std::array<float,2>{0.425744981f, 0.528586268f},
-std::array<float,2>{0.514337659f, 0.392039061f},
-std::array<float,2>{0.157875657f, 0.0125338705f},
-std::array<float,2>{0.988790572f, 0.904133856f},
-std::array<float,2>{0.124880254f, 0.822471261f},
-std::array<float,2>{0.786481977f, 0.244583622f},
-std::array<float,2>{0.363475919f, 0.355082273f},
-std::array<float,2>{0.707140684f, 0.667062938f},
-std::array<float,2>{0.295478135f, 0.983332157f},
-std::array<float,2>{0.633057117f, 0.0676614642f},
-std::array<float,2>{0.0161502529f, 0.454822212f},
-std::array<float,2>{0.814739525f, 0.622281969f},
-std::array<float,2>{0.218288586f, 0.731674492f},
-std::array<float,2>{0.913739502f, 0.282373548f},
-std::array<float,2>{0.458104491f, 0.167051122f},
-std::array<float,2>{0.567888141f, 0.802823186f},
-std::array<float,2>{0.323187232f, 0.646777093f},
-std::array<float,2>{0.740647972f, 0.338326156f},
-std::array<float,2>{0.0752052516f, 0.188058719f},
-std::array<float,2>{0.779848278f, 0.87422812f},
-std::array<float,2>{0.146444321f, 0.914072275f},
-std::array<float,2>{0.967266381f, 0.0341272242f},
-std::array<float,2>{0.394737512f, 0.424079567f},
-std::array<float,2>{0.534803152f, 0.548360765f},
-std::array<float,2>{0.494671702f, 0.758085012f},
-std::array<float,2>{0.599737763f, 0.126116529f},
-std::array<float,2>{0.223811492f, 0.275476158f},
-std::array<float,2>{0.882822394f, 0.717246115f},
-std::array<float,2>{0.0466530994f, 0.56732893f},
-std::array<float,2>{0.852862835f, 0.492256135f},
-std::array<float,2>{0.265829891f, 0.107497074f},
-std::array<float,2>{0.656544209f, 0.95712769f},
-std::array<float,2>{0.372994751f, 0.557990313f},
-std::array<float,2>{0.715113938f, 0.43466568f},
-std::array<float,2>{0.112708457f, 0.0412861556f},
-std::array<float,2>{0.796601653f, 0.909348488f},
-std::array<float,2>{0.170729741f, 0.86645025f},
-std::array<float,2>{0.99379921f, 0.199575692f},
-std::array<float,2>{0.430754244f, 0.330818057f},
-std::array<float,2>{0.503411174f, 0.652651131f},
-std::array<float,2>{0.465458542f, 0.962405562f},
-std::array<float,2>{0.577157676f, 0.0999713987f},
-std::array<float,2>{0.210056841f, 0.486335397f},
-std::array<float,2>{0.919743538f, 0.571410954f},
-std::array<float,2>{0.0301247835f, 0.710097194f},
-std::array<float,2>{0.825898111f, 0.267463416f},
-std::array<float,2>{0.284102917f, 0.134544402f},
-std::array<float,2>{0.631852925f, 0.755259931f},
-std::array<float,2>{0.401623785f, 0.661816955f},
-std::array<float,2>{0.545479059f, 0.344937533f},
-std::array<float,2>{0.150518462f, 0.240966529f},
-std::array<float,2>{0.954374909f, 0.813206732f},
-std::array<float,2>{0.0654109865f, 0.896236181f},
-std::array<float,2>{0.77054292f, 0.00711126672f},
-std::array<float,2>{0.319789976f, 0.405242682f},
-std::array<float,2>{0.748294353f, 0.520646811f},
-std::array<float,2>{0.277206451f, 0.804735899f},
-std::array<float,2>{0.671242952f, 0.163458154f},
-std::array<float,2>{0.0340794101f, 0.293508142f},
-std::array<float,2>{0.851139307f, 0.724524438f},
-std::array<float,2>{0.230812222f, 0.612562776f},
-std::array<float,2>{0.881537318f, 0.468337178f},
-std::array<float,2>{0.484734029f, 0.0753604174f},
-std::array<float,2>{0.608642697f, 0.976443231f},
-std::array<float,2>{0.478293747f, 0.579171479f},
-std::array<float,2>{0.612863719f, 0.471302152f},
-std::array<float,2>{0.237506047f, 0.123811588f},
-std::array<float,2>{0.897547722f, 0.952791274f},
-std::array<float,2>{0.0529176481f, 0.774439991f},
-std::array<float,2>{0.869593561f, 0.144403473f},
-std::array<float,2>{0.261823088f, 0.261821359f},
-std::array<float,2>{0.674200714f, 0.697145283f},
-std::array<float,2>{0.339809716f, 0.928038955f},
-std::array<float,2>{0.73138845f, 0.0570329167f},
-std::array<float,2>{0.0903789476f, 0.417018294f},
-std::array<float,2>{0.762254357f, 0.541997552f},
-std::array<float,2>{0.125637621f, 0.635750294f},
-std::array<float,2>{0.943286896f, 0.324932307f},
-std::array<float,2>{0.385898203f, 0.212553322f},
-std::array<float,2>{0.553388357f, 0.856774688f},
-std::array<float,2>{0.297124684f, 0.7475968f},
-std::array<float,2>{0.642830968f, 0.309962958f},
-std::array<float,2>{0.0137802493f, 0.179216787f},
-std::array<float,2>{0.835450172f, 0.792805851f},
-std::array<float,2>{0.198597208f, 0.987710536f},
-std::array<float,2>{0.925669253f, 0.0806714445f},
-std::array<float,2>{0.44441545f, 0.44928357f},
-std::array<float,2>{0.586428642f, 0.60525912f},
-std::array<float,2>{0.416698277f, 0.836931586f},
-std::array<float,2>{0.522682667f, 0.226706713f},
-std::array<float,2>{0.182722241f, 0.362782419f},
-std::array<float,2>{0.982036293f, 0.685982704f},
-std::array<float,2>{0.100090154f, 0.503838301f},
-std::array<float,2>{0.800305247f, 0.380499631f},
-std::array<float,2>{0.346115202f, 0.0232000276f},
-std::array<float,2>{0.6905545f, 0.881994843f},
-std::array<float,2>{0.303715169f, 0.551180661f},
-std::array<float,2>{0.647684991f, 0.427218586f},
-std::array<float,2>{0.0115238521f, 0.0375918262f},
-std::array<float,2>{0.829255998f, 0.920255423f},
-std::array<float,2>{0.20255056f, 0.869488895f},
-std::array<float,2>{0.929272056f, 0.193541631f},
-std::array<float,2>{0.440257818f, 0.340433449f},
-std::array<float,2>{0.591982186f, 0.643671334f},
-std::array<float,2>{0.419232458f, 0.956170738f},
-std::array<float,2>{0.516311288f, 0.104260214f},
-std::array<float,2>{0.185862601f, 0.498700291f},
-std::array<float,2>{0.977848589f, 0.562672973f},
-std::array<float,2>{0.0946226642f, 0.71175164f},
-std::array<float,2>{0.80340457f, 0.278785437f},
-std::array<float,2>{0.347937971f, 0.129584879f},
-std::array<float,2>{0.693682313f, 0.76432389f},
-std::array<float,2>{0.480927885f, 0.669014692f},
-std::array<float,2>{0.616027057f, 0.3573443f},
-std::array<float,2>{0.240318939f, 0.247363731f},
-std::array<float,2>{0.891103983f, 0.824510038f},
-std::array<float,2>{0.0494908839f, 0.902057827f},
-std::array<float,2>{0.872535825f, 0.00804756489f},
-std::array<float,2>{0.257996678f, 0.394765615f},
-std::array<float,2>{0.676871836f, 0.526579797f},
-std::array<float,2>{0.34149608f, 0.800379157f},
-std::array<float,2>{0.727262914f, 0.171506345f},
-std::array<float,2>{0.0864372477f, 0.28724739f},
-std::array<float,2>{0.760783911f, 0.7291466f},
-std::array<float,2>{0.129142016f, 0.618421495f},
-std::array<float,2>{0.940963507f, 0.457758963f},
-std::array<float,2>{0.390234709f, 0.0652122498f},
-std::array<float,2>{0.548971117f, 0.976914108f},
-std::array<float,2>{0.406098008f, 0.587856889f},
-std::array<float,2>{0.541301847f, 0.477703154f},
-std::array<float,2>{0.154340491f, 0.10975673f},
-std::array<float,2>{0.958259463f, 0.938588917f},
-std::array<float,2>{0.0671340302f, 0.765861154f},
-std::array<float,2>{0.76701808f, 0.149185777f},
-std::array<float,2>{0.315420091f, 0.254598409f},
-std::array<float,2>{0.742784917f, 0.694297433f},
-std::array<float,2>{0.278283358f, 0.93329376f},
-std::array<float,2>{0.665059566f, 0.0538520366f},
-std::array<float,2>{0.0374535173f, 0.4114317f},
-std::array<float,2>{0.847561002f, 0.534622312f},
-std::array<float,2>{0.227614626f, 0.632062614f},
-std::array<float,2>{0.876699567f, 0.3155303f},
-std::array<float,2>{0.48944506f, 0.203489646f},
-std::array<float,2>{0.602428198f, 0.847488403f},
-std::array<float,2>{0.368647993f, 0.737912595f},
-std::array<float,2>{0.712588549f, 0.29884994f},
-std::array<float,2>{0.11342746f, 0.183255121f},
-std::array<float,2>{0.791297793f, 0.788796008f},
-std::array<float,2>{0.164930865f, 0.999287069f},
-std::array<float,2>{0.997819424f, 0.0874210075f},
-std::array<float,2>{0.436687738f, 0.444735438f},
-std::array<float,2>{0.505547941f, 0.598889232f},
-std::array<float,2>{0.462468624f, 0.834386766f},
-std::array<float,2>{0.573664129f, 0.226379797f},
-std::array<float,2>{0.20502542f, 0.3739236f},
-std::array<float,2>{0.915086687f, 0.678288221f},
-std::array<float,2>{0.0261223f, 0.513010085f},
-std::array<float,2>{0.822686255f, 0.387073934f},
-std::array<float,2>{0.289061993f, 0.0268700719f},
-std::array<float,2>{0.628271461f, 0.888340771f},
-std::array<float,2>{0.327754319f, 0.607189536f},
-std::array<float,2>{0.737560153f, 0.445582837f},
-std::array<float,2>{0.0742131919f, 0.0843269825f},
-std::array<float,2>{0.773532331f, 0.989548326f},
-std::array<float,2>{0.141068414f, 0.79313612f},
-std::array<float,2>{0.963700831f, 0.172134459f},
-std::array<float,2>{0.391388923f, 0.306321174f},
-std::array<float,2>{0.538469017f, 0.74473983f},
-std::array<float,2>{0.497903824f, 0.875141501f},
-std::array<float,2>{0.59658128f, 0.0179151259f},
-std::array<float,2>{0.220033988f, 0.376179695f},
-std::array<float,2>{0.88928926f, 0.504607558f},
-std::array<float,2>{0.0410673581f, 0.683547497f},
-std::array<float,2>{0.858400345f, 0.365831375f},
-std::array<float,2>{0.270280629f, 0.233281255f},
-std::array<float,2>{0.662486374f, 0.840356886f},
-std::array<float,2>{0.426243991f, 0.701546729f},
-std::array<float,2>{0.509927511f, 0.260089517f},
-std::array<float,2>{0.161639303f, 0.145123363f},
-std::array<float,2>{0.988204539f, 0.780261219f},
-std::array<float,2>{0.11739412f, 0.947570205f},
-std::array<float,2>{0.784056425f, 0.117783152f},
-std::array<float,2>{0.362148136f, 0.474251837f},
-std::array<float,2>{0.705257893f, 0.585534573f},
-std::array<float,2>{0.29193899f, 0.852908015f},
-std::array<float,2>{0.638755858f, 0.217995718f},
-std::array<float,2>{0.0222715996f, 0.322005987f},
-std::array<float,2>{0.8169294f, 0.637674391f},
-std::array<float,2>{0.212933019f, 0.545665801f},
-std::array<float,2>{0.909375489f, 0.420857072f},
-std::array<float,2>{0.455373377f, 0.0614836998f},
-std::array<float,2>{0.564109862f, 0.922406852f},
-std::array<float,2>{0.450038254f, 0.516822517f},
-std::array<float,2>{0.579384387f, 0.40140602f},
-std::array<float,2>{0.195031047f, 0.00355444779f},
-std::array<float,2>{0.935227692f, 0.892627001f},
-std::array<float,2>{0.00150051375f, 0.81670934f},
-std::array<float,2>{0.840047181f, 0.236923337f},
-std::array<float,2>{0.310147583f, 0.34840408f},
-std::array<float,2>{0.652074158f, 0.656897545f},
-std::array<float,2>{0.352663845f, 0.971744478f},
-std::array<float,2>{0.699476123f, 0.0726859793f},
-std::array<float,2>{0.103686146f, 0.464394808f},
-std::array<float,2>{0.807119071f, 0.614991188f},
-std::array<float,2>{0.173650444f, 0.720508635f},
-std::array<float,2>{0.973759055f, 0.292117268f},
-std::array<float,2>{0.41122669f, 0.15684472f},
-std::array<float,2>{0.527632773f, 0.809301019f},
-std::array<float,2>{0.250283778f, 0.649950206f},
-std::array<float,2>{0.684333205f, 0.332873106f},
-std::array<float,2>{0.0582297519f, 0.195335105f},
-std::array<float,2>{0.861526787f, 0.860383093f},
-std::array<float,2>{0.243813783f, 0.911366999f},
-std::array<float,2>{0.902083814f, 0.0457431749f},
-std::array<float,2>{0.471722692f, 0.4311997f},
-std::array<float,2>{0.620297492f, 0.56053859f},
-std::array<float,2>{0.380331755f, 0.753296137f},
-std::array<float,2>{0.554884493f, 0.137210414f},
-std::array<float,2>{0.140211388f, 0.273067921f},
-std::array<float,2>{0.951694906f, 0.705685496f},
-std::array<float,2>{0.081375964f, 0.575680792f},
-std::array<float,2>{0.755084634f, 0.488928825f},
-std::array<float,2>{0.334139824f, 0.0943231136f},
-std::array<float,2>{0.724969745f, 0.965941906f},
-std::array<float,2>{0.266732424f, 0.568996429f},
-std::array<float,2>{0.658170402f, 0.496016592f},
-std::array<float,2>{0.0455446541f, 0.107221365f},
-std::array<float,2>{0.851961136f, 0.959216833f},
-std::array<float,2>{0.22267741f, 0.760056496f},
-std::array<float,2>{0.884093046f, 0.127216771f},
-std::array<float,2>{0.495147645f, 0.273955822f},
-std::array<float,2>{0.601159275f, 0.716535091f},
-std::array<float,2>{0.396459877f, 0.916398823f},
-std::array<float,2>{0.533480048f, 0.0321547277f},
-std::array<float,2>{0.144812331f, 0.422913104f},
-std::array<float,2>{0.968217373f, 0.549973726f},
-std::array<float,2>{0.0747323856f, 0.646289885f},
-std::array<float,2>{0.780721903f, 0.337008953f},
-std::array<float,2>{0.324070871f, 0.190544531f},
-std::array<float,2>{0.741904318f, 0.872666538f},
-std::array<float,2>{0.4570508f, 0.733290434f},
-std::array<float,2>{0.566634774f, 0.284027487f},
-std::array<float,2>{0.217092052f, 0.165036485f},
-std::array<float,2>{0.912718952f, 0.80127871f},
-std::array<float,2>{0.0171758085f, 0.98236084f},
-std::array<float,2>{0.815866292f, 0.0700441897f},
-std::array<float,2>{0.296357423f, 0.456160128f},
-std::array<float,2>{0.633975267f, 0.624975681f},
-std::array<float,2>{0.36491996f, 0.821520627f},
-std::array<float,2>{0.708323121f, 0.243904397f},
-std::array<float,2>{0.123991862f, 0.35198012f},
-std::array<float,2>{0.785757482f, 0.665452421f},
-std::array<float,2>{0.156484008f, 0.530593157f},
-std::array<float,2>{0.989296019f, 0.394376844f},
-std::array<float,2>{0.424420327f, 0.0143743316f},
-std::array<float,2>{0.515191436f, 0.905321479f},
-std::array<float,2>{0.407831192f, 0.53534615f},
-std::array<float,2>{0.523649454f, 0.406568706f},
-std::array<float,2>{0.176521048f, 0.0492578223f},
-std::array<float,2>{0.970900834f, 0.93650341f},
-std::array<float,2>{0.106205605f, 0.849194407f},
-std::array<float,2>{0.808687747f, 0.207855701f},
-std::array<float,2>{0.356729507f, 0.318660975f},
-std::array<float,2>{0.697242916f, 0.628150046f},
-std::array<float,2>{0.305080563f, 0.942386329f},
-std::array<float,2>{0.652792811f, 0.115267046f},
-std::array<float,2>{0.00449981354f, 0.483022034f},
-std::array<float,2>{0.83848834f, 0.590014219f},
-std::array<float,2>{0.187529743f, 0.689399362f},
-std::array<float,2>{0.931549013f, 0.252142638f},
-std::array<float,2>{0.448134989f, 0.154215753f},
-std::array<float,2>{0.582147181f, 0.770355523f},
-std::array<float,2>{0.328191549f, 0.674496591f},
-std::array<float,2>{0.720270514f, 0.369777501f},
-std::array<float,2>{0.0827403292f, 0.219659448f},
-std::array<float,2>{0.753734946f, 0.830027163f},
-std::array<float,2>{0.133431479f, 0.884362519f},
-std::array<float,2>{0.948051035f, 0.030384114f},
-std::array<float,2>{0.375585735f, 0.384458125f},
-std::array<float,2>{0.560526371f, 0.509265304f},
-std::array<float,2>{0.473143697f, 0.781460583f},
-std::array<float,2>{0.623636723f, 0.186185122f},
-std::array<float,2>{0.248271972f, 0.301454514f},
-std::array<float,2>{0.904933214f, 0.73930347f},
-std::array<float,2>{0.0618785471f, 0.594261348f},
-std::array<float,2>{0.86441958f, 0.439276218f},
-std::array<float,2>{0.25646621f, 0.092637673f},
-std::array<float,2>{0.679718614f, 0.993639588f},
-std::array<float,2>{0.34757185f, 0.501846731f},
-std::array<float,2>{0.689819217f, 0.38187924f},
-std::array<float,2>{0.101268314f, 0.0211337022f},
-std::array<float,2>{0.799747348f, 0.879166424f},
-std::array<float,2>{0.182452962f, 0.839137018f},
-std::array<float,2>{0.980717301f, 0.228837267f},
-std::array<float,2>{0.417434394f, 0.360766888f},
-std::array<float,2>{0.522026658f, 0.683682084f},
-std::array<float,2>{0.443459213f, 0.984881818f},
-std::array<float,2>{0.587359965f, 0.0787376016f},
-std::array<float,2>{0.197923586f, 0.452077866f},
-std::array<float,2>{0.92415905f, 0.602325082f},
-std::array<float,2>{0.0155071886f, 0.74993813f},
-std::array<float,2>{0.834308267f, 0.312017381f},
-std::array<float,2>{0.298216403f, 0.176199734f},
-std::array<float,2>{0.64441973f, 0.79038763f},
-std::array<float,2>{0.384824246f, 0.633109689f},
-std::array<float,2>{0.554189801f, 0.327474982f},
-std::array<float,2>{0.126330093f, 0.21431537f},
-std::array<float,2>{0.942264676f, 0.85925591f},
-std::array<float,2>{0.091356799f, 0.927335858f},
-std::array<float,2>{0.762960792f, 0.0558671542f},
-std::array<float,2>{0.338683039f, 0.414866298f},
-std::array<float,2>{0.731484771f, 0.539382517f},
-std::array<float,2>{0.263635308f, 0.776784599f},
-std::array<float,2>{0.67540133f, 0.141733274f},
-std::array<float,2>{0.0540895462f, 0.264684886f},
-std::array<float,2>{0.870428741f, 0.697512567f},
-std::array<float,2>{0.23730351f, 0.581395328f},
-std::array<float,2>{0.896873236f, 0.470053524f},
-std::array<float,2>{0.477000117f, 0.122243464f},
-std::array<float,2>{0.611430645f, 0.949501097f},
-std::array<float,2>{0.486103177f, 0.611183405f},
-std::array<float,2>{0.607814312f, 0.466357112f},
-std::array<float,2>{0.231965482f, 0.0777759999f},
-std::array<float,2>{0.882544756f, 0.973513246f},
-std::array<float,2>{0.0350430422f, 0.807517171f},
-std::array<float,2>{0.850287616f, 0.161032468f},
-std::array<float,2>{0.275476336f, 0.296024948f},
-std::array<float,2>{0.670579135f, 0.726027846f},
-std::array<float,2>{0.318893373f, 0.897791922f},
-std::array<float,2>{0.749616444f, 0.00512145599f},
-std::array<float,2>{0.0662817582f, 0.402676433f},
-std::array<float,2>{0.770426035f, 0.522167623f},
-std::array<float,2>{0.151989773f, 0.663852811f},
-std::array<float,2>{0.95410049f, 0.346841782f},
-std::array<float,2>{0.400817752f, 0.239117086f},
-std::array<float,2>{0.546395242f, 0.814957023f},
-std::array<float,2>{0.284973919f, 0.707386792f},
-std::array<float,2>{0.630901098f, 0.268043697f},
-std::array<float,2>{0.0309654269f, 0.135422438f},
-std::array<float,2>{0.824794114f, 0.756014764f},
-std::array<float,2>{0.209498167f, 0.964173257f},
-std::array<float,2>{0.918537259f, 0.0987807661f},
-std::array<float,2>{0.465874553f, 0.484517157f},
-std::array<float,2>{0.576640546f, 0.573659658f},
-std::array<float,2>{0.429957956f, 0.864428222f},
-std::array<float,2>{0.50240773f, 0.201638833f},
-std::array<float,2>{0.171785429f, 0.328469366f},
-std::array<float,2>{0.993009746f, 0.655564308f},
-std::array<float,2>{0.111523159f, 0.556603312f},
-std::array<float,2>{0.795295715f, 0.436111182f},
-std::array<float,2>{0.37150225f, 0.0400043614f},
-std::array<float,2>{0.715950549f, 0.907709301f},
-std::array<float,2>{0.261293858f, 0.523772657f},
-std::array<float,2>{0.678178012f, 0.39756763f},
-std::array<float,2>{0.0487871021f, 0.0106474711f},
-std::array<float,2>{0.873202562f, 0.89968437f},
-std::array<float,2>{0.24010095f, 0.826291859f},
-std::array<float,2>{0.894322991f, 0.249387264f},
-std::array<float,2>{0.484338075f, 0.358172089f},
-std::array<float,2>{0.614908397f, 0.670732021f},
-std::array<float,2>{0.387132287f, 0.978843033f},
-std::array<float,2>{0.548671126f, 0.0634152442f},
-std::array<float,2>{0.131937459f, 0.46020624f},
-std::array<float,2>{0.938208282f, 0.620418429f},
-std::array<float,2>{0.0879754871f, 0.727761805f},
-std::array<float,2>{0.75941205f, 0.28653878f},
-std::array<float,2>{0.342415333f, 0.169867352f},
-std::array<float,2>{0.729127228f, 0.798016846f},
-std::array<float,2>{0.438953012f, 0.640904486f},
-std::array<float,2>{0.590841413f, 0.343439817f},
-std::array<float,2>{0.199751422f, 0.192357689f},
-std::array<float,2>{0.925848722f, 0.867586792f},
-std::array<float,2>{0.00897936337f, 0.918209493f},
-std::array<float,2>{0.831766665f, 0.0363541506f},
-std::array<float,2>{0.301550329f, 0.428982735f},
-std::array<float,2>{0.645926416f, 0.553901315f},
-std::array<float,2>{0.350024223f, 0.763568819f},
-std::array<float,2>{0.691834331f, 0.131299689f},
-std::array<float,2>{0.0958049223f, 0.279766232f},
-std::array<float,2>{0.802386582f, 0.714226604f},
-std::array<float,2>{0.18487294f, 0.566350758f},
-std::array<float,2>{0.979868174f, 0.496239424f},
-std::array<float,2>{0.420164555f, 0.103391722f},
-std::array<float,2>{0.517836213f, 0.953565836f},
-std::array<float,2>{0.435374796f, 0.600877404f},
-std::array<float,2>{0.507295489f, 0.441756994f},
-std::array<float,2>{0.166956812f, 0.0896115676f},
-std::array<float,2>{0.999669135f, 0.997605383f},
-std::array<float,2>{0.11617738f, 0.78541708f},
-std::array<float,2>{0.789802074f, 0.179712996f},
-std::array<float,2>{0.369556963f, 0.298390657f},
-std::array<float,2>{0.713805199f, 0.735322535f},
-std::array<float,2>{0.286664605f, 0.889263093f},
-std::array<float,2>{0.626455545f, 0.0234681331f},
-std::array<float,2>{0.0248184893f, 0.390555263f},
-std::array<float,2>{0.820668876f, 0.514067113f},
-std::array<float,2>{0.205660805f, 0.675962269f},
-std::array<float,2>{0.917046309f, 0.371301234f},
-std::array<float,2>{0.462972939f, 0.223121941f},
-std::array<float,2>{0.570604861f, 0.832244992f},
-std::array<float,2>{0.31290409f, 0.692063272f},
-std::array<float,2>{0.744428635f, 0.257658184f},
-std::array<float,2>{0.0693168193f, 0.151709795f},
-std::array<float,2>{0.768913925f, 0.769493043f},
-std::array<float,2>{0.153320521f, 0.941157281f},
-std::array<float,2>{0.959387898f, 0.112159722f},
-std::array<float,2>{0.403548896f, 0.478844583f},
-std::array<float,2>{0.539589226f, 0.588752031f},
-std::array<float,2>{0.490354478f, 0.844339788f},
-std::array<float,2>{0.604345679f, 0.205701679f},
-std::array<float,2>{0.229903609f, 0.312932134f},
-std::array<float,2>{0.878848314f, 0.630322397f},
-std::array<float,2>{0.036822401f, 0.532660365f},
-std::array<float,2>{0.845270693f, 0.413275599f},
-std::array<float,2>{0.280191034f, 0.0525284819f},
-std::array<float,2>{0.667489707f, 0.930072367f},
-std::array<float,2>{0.3603791f, 0.582695544f},
-std::array<float,2>{0.703488708f, 0.474810123f},
-std::array<float,2>{0.119942568f, 0.120521851f},
-std::array<float,2>{0.781992197f, 0.945584834f},
-std::array<float,2>{0.163787022f, 0.779000282f},
-std::array<float,2>{0.985734284f, 0.147650406f},
-std::array<float,2>{0.428814471f, 0.258873582f},
-std::array<float,2>{0.508639991f, 0.700932205f},
-std::array<float,2>{0.454677403f, 0.924693704f},
-std::array<float,2>{0.565274537f, 0.0590229332f},
-std::array<float,2>{0.212595969f, 0.419440359f},
-std::array<float,2>{0.907872081f, 0.543463051f},
-std::array<float,2>{0.0198483039f, 0.639974535f},
-std::array<float,2>{0.819087029f, 0.323972344f},
-std::array<float,2>{0.289926022f, 0.215668336f},
-std::array<float,2>{0.637056291f, 0.854194522f},
-std::array<float,2>{0.393150955f, 0.74398762f},
-std::array<float,2>{0.535954952f, 0.307941794f},
-std::array<float,2>{0.143716872f, 0.174516037f},
-std::array<float,2>{0.961355448f, 0.795468211f},
-std::array<float,2>{0.0706048682f, 0.990474284f},
-std::array<float,2>{0.775501847f, 0.0828271583f},
-std::array<float,2>{0.325848401f, 0.44826746f},
-std::array<float,2>{0.735750198f, 0.607662618f},
-std::array<float,2>{0.272011757f, 0.841915727f},
-std::array<float,2>{0.6621086f, 0.231152013f},
-std::array<float,2>{0.0404596515f, 0.364050299f},
-std::array<float,2>{0.855655015f, 0.680519283f},
-std::array<float,2>{0.221611351f, 0.507676899f},
-std::array<float,2>{0.888530254f, 0.378136903f},
-std::array<float,2>{0.499518305f, 0.0168997403f},
-std::array<float,2>{0.593922257f, 0.87811321f},
-std::array<float,2>{0.470141858f, 0.560924411f},
-std::array<float,2>{0.617810011f, 0.433554024f},
-std::array<float,2>{0.244167164f, 0.0444301739f},
-std::array<float,2>{0.900388181f, 0.913161516f},
-std::array<float,2>{0.0563240424f, 0.861823678f},
-std::array<float,2>{0.859479129f, 0.19903709f},
-std::array<float,2>{0.253880173f, 0.334449053f},
-std::array<float,2>{0.686212718f, 0.652145445f},
-std::array<float,2>{0.332764596f, 0.968487084f},
-std::array<float,2>{0.723511696f, 0.0964046717f},
-std::array<float,2>{0.0786065534f, 0.491806746f},
-std::array<float,2>{0.756592572f, 0.576643705f},
-std::array<float,2>{0.138461679f, 0.704122007f},
-std::array<float,2>{0.950880706f, 0.269886225f},
-std::array<float,2>{0.381342649f, 0.139012307f},
-std::array<float,2>{0.557184815f, 0.75162071f},
-std::array<float,2>{0.31074658f, 0.659182966f},
-std::array<float,2>{0.650084496f, 0.350377858f},
-std::array<float,2>{0.00226986711f, 0.235431165f},
-std::array<float,2>{0.841881037f, 0.820255578f},
-std::array<float,2>{0.192023367f, 0.89245832f},
-std::array<float,2>{0.936336935f, 0.000449733721f},
-std::array<float,2>{0.452233493f, 0.400038958f},
-std::array<float,2>{0.581765115f, 0.519401312f},
-std::array<float,2>{0.413188368f, 0.810824811f},
-std::array<float,2>{0.530629039f, 0.159873292f},
-std::array<float,2>{0.174825788f, 0.289342463f},
-std::array<float,2>{0.975137591f, 0.722232878f},
-std::array<float,2>{0.101966545f, 0.615561962f},
-std::array<float,2>{0.805155396f, 0.462227523f},
-std::array<float,2>{0.355218738f, 0.0716159269f},
-std::array<float,2>{0.701854646f, 0.969518542f},
-std::array<float,2>{0.294502378f, 0.621394515f},
-std::array<float,2>{0.634965956f, 0.453346968f},
-std::array<float,2>{0.0184004344f, 0.0665625855f},
-std::array<float,2>{0.812611401f, 0.984137118f},
-std::array<float,2>{0.216493562f, 0.804685712f},
-std::array<float,2>{0.911390066f, 0.166637212f},
-std::array<float,2>{0.460538715f, 0.281561583f},
-std::array<float,2>{0.569118261f, 0.730805039f},
-std::array<float,2>{0.423299164f, 0.903264463f},
-std::array<float,2>{0.513209164f, 0.0130865723f},
-std::array<float,2>{0.159738198f, 0.391597152f},
-std::array<float,2>{0.990836859f, 0.528222442f},
-std::array<float,2>{0.121685177f, 0.666297734f},
-std::array<float,2>{0.788857162f, 0.353971213f},
-std::array<float,2>{0.36578095f, 0.246020555f},
-std::array<float,2>{0.70899421f, 0.824142218f},
-std::array<float,2>{0.492511451f, 0.718019247f},
-std::array<float,2>{0.599375606f, 0.276426226f},
-std::array<float,2>{0.22568056f, 0.125759542f},
-std::array<float,2>{0.886182904f, 0.759736001f},
-std::array<float,2>{0.0437282398f, 0.958621144f},
-std::array<float,2>{0.855131805f, 0.109239027f},
-std::array<float,2>{0.269021183f, 0.493831813f},
-std::array<float,2>{0.658693373f, 0.568247855f},
-std::array<float,2>{0.321229905f, 0.873696923f},
-std::array<float,2>{0.739332855f, 0.188868642f},
-std::array<float,2>{0.0775430053f, 0.339677185f},
-std::array<float,2>{0.777566373f, 0.647678733f},
-std::array<float,2>{0.148238912f, 0.547277272f},
-std::array<float,2>{0.965708673f, 0.425352663f},
-std::array<float,2>{0.39796111f, 0.0350245275f},
-std::array<float,2>{0.532385111f, 0.915908396f},
-std::array<float,2>{0.378365397f, 0.51063329f},
-std::array<float,2>{0.561074376f, 0.385810673f},
-std::array<float,2>{0.13666442f, 0.028024191f},
-std::array<float,2>{0.946703196f, 0.885549784f},
-std::array<float,2>{0.0856116489f, 0.830966711f},
-std::array<float,2>{0.750420332f, 0.222365856f},
-std::array<float,2>{0.33166948f, 0.36907807f},
-std::array<float,2>{0.720983922f, 0.672380388f},
-std::array<float,2>{0.25486356f, 0.994750798f},
-std::array<float,2>{0.682140291f, 0.090605177f},
-std::array<float,2>{0.0596584678f, 0.441270828f},
-std::array<float,2>{0.866242707f, 0.597013712f},
-std::array<float,2>{0.246559918f, 0.741745889f},
-std::array<float,2>{0.90275389f, 0.304052383f},
-std::array<float,2>{0.475164354f, 0.185133621f},
-std::array<float,2>{0.622099459f, 0.784882963f},
-std::array<float,2>{0.357639194f, 0.626343131f},
-std::array<float,2>{0.698091686f, 0.317226708f},
-std::array<float,2>{0.107907794f, 0.209562048f},
-std::array<float,2>{0.81057179f, 0.850230217f},
-std::array<float,2>{0.178147376f, 0.933994353f},
-std::array<float,2>{0.969694614f, 0.0480163768f},
-std::array<float,2>{0.409470439f, 0.408659577f},
-std::array<float,2>{0.525889814f, 0.537539423f},
-std::array<float,2>{0.445369422f, 0.772461772f},
-std::array<float,2>{0.585247159f, 0.15595825f},
-std::array<float,2>{0.189770877f, 0.250709921f},
-std::array<float,2>{0.931822956f, 0.689929187f},
-std::array<float,2>{0.00660069054f, 0.593138039f},
-std::array<float,2>{0.836983085f, 0.480987161f},
-std::array<float,2>{0.307085752f, 0.114647791f},
-std::array<float,2>{0.654851437f, 0.944349885f},
-std::array<float,2>{0.33645457f, 0.541473985f},
-std::array<float,2>{0.732836783f, 0.416190803f},
-std::array<float,2>{0.0922026113f, 0.0576284789f},
-std::array<float,2>{0.764417231f, 0.929292381f},
-std::array<float,2>{0.128616691f, 0.856404364f},
-std::array<float,2>{0.944554627f, 0.211215153f},
-std::array<float,2>{0.384250462f, 0.325357497f},
-std::array<float,2>{0.551450014f, 0.634993553f},
-std::array<float,2>{0.479277551f, 0.951652229f},
-std::array<float,2>{0.610476613f, 0.124329895f},
-std::array<float,2>{0.235244259f, 0.472600162f},
-std::array<float,2>{0.896476269f, 0.578349829f},
-std::array<float,2>{0.0518275723f, 0.696274579f},
-std::array<float,2>{0.868994713f, 0.263006806f},
-std::array<float,2>{0.265360475f, 0.142953306f},
-std::array<float,2>{0.672637761f, 0.774254501f},
-std::array<float,2>{0.414172858f, 0.687079072f},
-std::array<float,2>{0.520110965f, 0.361956269f},
-std::array<float,2>{0.17991966f, 0.227587521f},
-std::array<float,2>{0.983445883f, 0.836075664f},
-std::array<float,2>{0.0985595062f, 0.881462276f},
-std::array<float,2>{0.797561646f, 0.0224479567f},
-std::array<float,2>{0.34445706f, 0.379860491f},
-std::array<float,2>{0.688964307f, 0.502239883f},
-std::array<float,2>{0.299497664f, 0.79111737f},
-std::array<float,2>{0.64135623f, 0.177790061f},
-std::array<float,2>{0.012714697f, 0.309340805f},
-std::array<float,2>{0.832359314f, 0.746892571f},
-std::array<float,2>{0.195944309f, 0.604443908f},
-std::array<float,2>{0.92277801f, 0.450673997f},
-std::array<float,2>{0.442268759f, 0.0819909871f},
-std::array<float,2>{0.588319838f, 0.986851931f},
-std::array<float,2>{0.46746546f, 0.570546448f},
-std::array<float,2>{0.574359834f, 0.488061577f},
-std::array<float,2>{0.20800598f, 0.101555489f},
-std::array<float,2>{0.920983613f, 0.961087286f},
-std::array<float,2>{0.0277853794f, 0.753927708f},
-std::array<float,2>{0.827256799f, 0.133423924f},
-std::array<float,2>{0.28277418f, 0.265768826f},
-std::array<float,2>{0.629542053f, 0.709704638f},
-std::array<float,2>{0.374863356f, 0.908417404f},
-std::array<float,2>{0.718639135f, 0.0424568243f},
-std::array<float,2>{0.111024186f, 0.434444547f},
-std::array<float,2>{0.793133318f, 0.557404339f},
-std::array<float,2>{0.168990627f, 0.654149592f},
-std::array<float,2>{0.994267762f, 0.331492543f},
-std::array<float,2>{0.4334203f, 0.200396791f},
-std::array<float,2>{0.501505017f, 0.866066813f},
-std::array<float,2>{0.273999989f, 0.723329663f},
-std::array<float,2>{0.668912113f, 0.294397473f},
-std::array<float,2>{0.0319714583f, 0.162857428f},
-std::array<float,2>{0.848270535f, 0.806121111f},
-std::array<float,2>{0.23316741f, 0.975494206f},
-std::array<float,2>{0.879497945f, 0.0746634826f},
-std::array<float,2>{0.486511558f, 0.467134506f},
-std::array<float,2>{0.607299447f, 0.612073481f},
-std::array<float,2>{0.399178922f, 0.814282179f},
-std::array<float,2>{0.54461056f, 0.241441041f},
-std::array<float,2>{0.150086343f, 0.344621092f},
-std::array<float,2>{0.955316842f, 0.661031604f},
-std::array<float,2>{0.0637094453f, 0.520294547f},
-std::array<float,2>{0.772722125f, 0.405686527f},
-std::array<float,2>{0.317405492f, 0.00659972755f},
-std::array<float,2>{0.747086287f, 0.894852221f},
-std::array<float,2>{0.253030121f, 0.559987962f},
-std::array<float,2>{0.685856223f, 0.430883735f},
-std::array<float,2>{0.0556828938f, 0.0451145396f},
-std::array<float,2>{0.859992445f, 0.911653399f},
-std::array<float,2>{0.244990394f, 0.861060202f},
-std::array<float,2>{0.899900138f, 0.196010843f},
-std::array<float,2>{0.470588058f, 0.332114279f},
-std::array<float,2>{0.617266178f, 0.6496315f},
-std::array<float,2>{0.381669194f, 0.966745257f},
-std::array<float,2>{0.556651652f, 0.0938529596f},
-std::array<float,2>{0.137900859f, 0.488740146f},
-std::array<float,2>{0.950285971f, 0.575773537f},
-std::array<float,2>{0.0789375082f, 0.705263495f},
-std::array<float,2>{0.756202936f, 0.272667259f},
-std::array<float,2>{0.332098514f, 0.137009993f},
-std::array<float,2>{0.723009467f, 0.753545403f},
-std::array<float,2>{0.4530828f, 0.656320512f},
-std::array<float,2>{0.581448138f, 0.347864628f},
-std::array<float,2>{0.191783622f, 0.236408994f},
-std::array<float,2>{0.935839355f, 0.8171103f},
-std::array<float,2>{0.00276449998f, 0.893277526f},
-std::array<float,2>{0.842556477f, 0.00315512624f},
-std::array<float,2>{0.31144473f, 0.402064234f},
-std::array<float,2>{0.64968729f, 0.517124832f},
-std::array<float,2>{0.354616165f, 0.808628082f},
-std::array<float,2>{0.701411664f, 0.156401396f},
-std::array<float,2>{0.102246076f, 0.292787462f},
-std::array<float,2>{0.805611193f, 0.719850481f},
-std::array<float,2>{0.175526559f, 0.614592016f},
-std::array<float,2>{0.975003481f, 0.464148462f},
-std::array<float,2>{0.413580239f, 0.0730377138f},
-std::array<float,2>{0.530895293f, 0.972601533f},
-std::array<float,2>{0.42925626f, 0.585288525f},
-std::array<float,2>{0.508267701f, 0.47384721f},
-std::array<float,2>{0.163434714f, 0.11719802f},
-std::array<float,2>{0.986229002f, 0.948092461f},
-std::array<float,2>{0.119330317f, 0.779416144f},
-std::array<float,2>{0.781557024f, 0.144556329f},
-std::array<float,2>{0.360959083f, 0.260665864f},
-std::array<float,2>{0.704099f, 0.701853156f},
-std::array<float,2>{0.289426804f, 0.922259033f},
-std::array<float,2>{0.63744235f, 0.0605605096f},
-std::array<float,2>{0.0204321109f, 0.420316935f},
-std::array<float,2>{0.818696678f, 0.545067012f},
-std::array<float,2>{0.21192944f, 0.637038708f},
-std::array<float,2>{0.90770781f, 0.32135585f},
-std::array<float,2>{0.454447329f, 0.218570977f},
-std::array<float,2>{0.564729571f, 0.853234112f},
-std::array<float,2>{0.325221688f, 0.744431674f},
-std::array<float,2>{0.736185431f, 0.305749804f},
-std::array<float,2>{0.0711778924f, 0.17250599f},
-std::array<float,2>{0.776024282f, 0.793586671f},
-std::array<float,2>{0.144515112f, 0.989857554f},
-std::array<float,2>{0.961435914f, 0.0848987401f},
-std::array<float,2>{0.392586201f, 0.446072966f},
-std::array<float,2>{0.535611093f, 0.606644154f},
-std::array<float,2>{0.49944824f, 0.840069234f},
-std::array<float,2>{0.594563246f, 0.23284629f},
-std::array<float,2>{0.221074864f, 0.365521938f},
-std::array<float,2>{0.88780731f, 0.682878077f},
-std::array<float,2>{0.0407493934f, 0.504256487f},
-std::array<float,2>{0.856129706f, 0.376898855f},
-std::array<float,2>{0.27157408f, 0.0185220242f},
-std::array<float,2>{0.661364555f, 0.875858128f},
-std::array<float,2>{0.369760484f, 0.599606633f},
-std::array<float,2>{0.713254988f, 0.445004344f},
-std::array<float,2>{0.115457185f, 0.0873149186f},
-std::array<float,2>{0.789483547f, 0.999930739f},
-std::array<float,2>{0.166145355f, 0.788119376f},
-std::array<float,2>{0.999462366f, 0.182958812f},
-std::array<float,2>{0.43494907f, 0.299789041f},
-std::array<float,2>{0.507496119f, 0.737554371f},
-std::array<float,2>{0.463687569f, 0.887741864f},
-std::array<float,2>{0.571055651f, 0.0267290827f},
-std::array<float,2>{0.205484092f, 0.387451023f},
-std::array<float,2>{0.917880356f, 0.513485849f},
-std::array<float,2>{0.0250751581f, 0.677805662f},
-std::array<float,2>{0.821284294f, 0.373334825f},
-std::array<float,2>{0.286276847f, 0.225709513f},
-std::array<float,2>{0.626912117f, 0.834619701f},
-std::array<float,2>{0.404188454f, 0.693432987f},
-std::array<float,2>{0.539354682f, 0.254136682f},
-std::array<float,2>{0.153961882f, 0.148710072f},
-std::array<float,2>{0.959571779f, 0.766221821f},
-std::array<float,2>{0.0684774294f, 0.939313114f},
-std::array<float,2>{0.76911062f, 0.11005982f},
-std::array<float,2>{0.313034892f, 0.478456557f},
-std::array<float,2>{0.74495995f, 0.587161958f},
-std::array<float,2>{0.279644012f, 0.847129524f},
-std::array<float,2>{0.6670385f, 0.203971758f},
-std::array<float,2>{0.0361492969f, 0.316039503f},
-std::array<float,2>{0.844775856f, 0.632800877f},
-std::array<float,2>{0.230078027f, 0.535068154f},
-std::array<float,2>{0.87821734f, 0.411749274f},
-std::array<float,2>{0.491065055f, 0.0543322787f},
-std::array<float,2>{0.603931308f, 0.932721615f},
-std::array<float,2>{0.483874977f, 0.527017951f},
-std::array<float,2>{0.614283264f, 0.395487487f},
-std::array<float,2>{0.239472821f, 0.00848904438f},
-std::array<float,2>{0.893855214f, 0.901673377f},
-std::array<float,2>{0.0482982993f, 0.825186729f},
-std::array<float,2>{0.873926401f, 0.247579634f},
-std::array<float,2>{0.260813624f, 0.356851935f},
-std::array<float,2>{0.678529918f, 0.669563651f},
-std::array<float,2>{0.342230558f, 0.977314889f},
-std::array<float,2>{0.728788853f, 0.0645375848f},
-std::array<float,2>{0.0884529129f, 0.457269132f},
-std::array<float,2>{0.759221792f, 0.618735969f},
-std::array<float,2>{0.132742599f, 0.728758633f},
-std::array<float,2>{0.93766427f, 0.287816495f},
-std::array<float,2>{0.387486964f, 0.171272561f},
-std::array<float,2>{0.548044562f, 0.799905658f},
-std::array<float,2>{0.301085114f, 0.644298792f},
-std::array<float,2>{0.64625603f, 0.340196639f},
-std::array<float,2>{0.00949211046f, 0.193868652f},
-std::array<float,2>{0.831461072f, 0.869959116f},
-std::array<float,2>{0.199553266f, 0.920579672f},
-std::array<float,2>{0.926620781f, 0.0378431492f},
-std::array<float,2>{0.439344585f, 0.427398086f},
-std::array<float,2>{0.591432631f, 0.551612079f},
-std::array<float,2>{0.420574099f, 0.763941109f},
-std::array<float,2>{0.518111169f, 0.128921479f},
-std::array<float,2>{0.185401469f, 0.279227734f},
-std::array<float,2>{0.980151355f, 0.71130985f},
-std::array<float,2>{0.0963814259f, 0.563405812f},
-std::array<float,2>{0.801800609f, 0.498408496f},
-std::array<float,2>{0.350445688f, 0.103982389f},
-std::array<float,2>{0.691951036f, 0.956760883f},
-std::array<float,2>{0.282277077f, 0.573870063f},
-std::array<float,2>{0.629082322f, 0.485246778f},
-std::array<float,2>{0.0279070996f, 0.0995774344f},
-std::array<float,2>{0.827836096f, 0.964668393f},
-std::array<float,2>{0.20745492f, 0.756594479f},
-std::array<float,2>{0.921839595f, 0.135066122f},
-std::array<float,2>{0.467207074f, 0.268167704f},
-std::array<float,2>{0.575124145f, 0.707764745f},
-std::array<float,2>{0.432674617f, 0.907772303f},
-std::array<float,2>{0.501183689f, 0.0393777043f},
-std::array<float,2>{0.169583827f, 0.435694307f},
-std::array<float,2>{0.994984627f, 0.556126237f},
-std::array<float,2>{0.110711403f, 0.656145155f},
-std::array<float,2>{0.793526411f, 0.328648746f},
-std::array<float,2>{0.3743442f, 0.202094391f},
-std::array<float,2>{0.7178303f, 0.864928365f},
-std::array<float,2>{0.487025768f, 0.72625649f},
-std::array<float,2>{0.60662365f, 0.296433806f},
-std::array<float,2>{0.232788071f, 0.160407558f},
-std::array<float,2>{0.879213095f, 0.806964457f},
-std::array<float,2>{0.0313955396f, 0.972836077f},
-std::array<float,2>{0.848011434f, 0.0774318054f},
-std::array<float,2>{0.273759544f, 0.465828121f},
-std::array<float,2>{0.668410301f, 0.610787749f},
-std::array<float,2>{0.318102151f, 0.814905584f},
-std::array<float,2>{0.747920692f, 0.238411009f},
-std::array<float,2>{0.0640036762f, 0.347232044f},
-std::array<float,2>{0.773412406f, 0.663349688f},
-std::array<float,2>{0.149580196f, 0.52189368f},
-std::array<float,2>{0.955688059f, 0.40293178f},
-std::array<float,2>{0.398707449f, 0.00537484977f},
-std::array<float,2>{0.544359326f, 0.898109138f},
-std::array<float,2>{0.384349257f, 0.540038228f},
-std::array<float,2>{0.55115056f, 0.41433692f},
-std::array<float,2>{0.128267199f, 0.0565011315f},
-std::array<float,2>{0.944839716f, 0.926924944f},
-std::array<float,2>{0.0926157236f, 0.858427167f},
-std::array<float,2>{0.764100611f, 0.214389592f},
-std::array<float,2>{0.336360812f, 0.32804817f},
-std::array<float,2>{0.733043075f, 0.633475184f},
-std::array<float,2>{0.264869481f, 0.949996591f},
-std::array<float,2>{0.671920478f, 0.122919619f},
-std::array<float,2>{0.0525388494f, 0.470323294f},
-std::array<float,2>{0.868206441f, 0.581699133f},
-std::array<float,2>{0.234617889f, 0.698113501f},
-std::array<float,2>{0.895653307f, 0.265287101f},
-std::array<float,2>{0.478647023f, 0.142513454f},
-std::array<float,2>{0.61084044f, 0.777256548f},
-std::array<float,2>{0.34375152f, 0.684420168f},
-std::array<float,2>{0.689353049f, 0.361140579f},
-std::array<float,2>{0.0980387181f, 0.229194015f},
-std::array<float,2>{0.797301054f, 0.83971858f},
-std::array<float,2>{0.180339277f, 0.879454553f},
-std::array<float,2>{0.984287024f, 0.0207334496f},
-std::array<float,2>{0.414966881f, 0.382536978f},
-std::array<float,2>{0.519788563f, 0.501125157f},
-std::array<float,2>{0.441738248f, 0.790995717f},
-std::array<float,2>{0.588429451f, 0.17634277f},
-std::array<float,2>{0.195572615f, 0.311891377f},
-std::array<float,2>{0.922114015f, 0.749032259f},
-std::array<float,2>{0.0133745214f, 0.60187608f},
-std::array<float,2>{0.832606196f, 0.451458037f},
-std::array<float,2>{0.298893929f, 0.0784506947f},
-std::array<float,2>{0.640887916f, 0.984450161f},
-std::array<float,2>{0.331476927f, 0.509727597f},
-std::array<float,2>{0.721274674f, 0.383913815f},
-std::array<float,2>{0.0851722658f, 0.0309202857f},
-std::array<float,2>{0.750661612f, 0.883985519f},
-std::array<float,2>{0.135917827f, 0.829514146f},
-std::array<float,2>{0.947094083f, 0.219104931f},
-std::array<float,2>{0.37870872f, 0.369229734f},
-std::array<float,2>{0.560624182f, 0.673911154f},
-std::array<float,2>{0.474857926f, 0.994096994f},
-std::array<float,2>{0.622702003f, 0.0918676332f},
-std::array<float,2>{0.246664554f, 0.438797921f},
-std::array<float,2>{0.90319097f, 0.593960345f},
-std::array<float,2>{0.0602946281f, 0.740194082f},
-std::array<float,2>{0.867038786f, 0.301220536f},
-std::array<float,2>{0.253949463f, 0.185803875f},
-std::array<float,2>{0.682071745f, 0.782200754f},
-std::array<float,2>{0.409938365f, 0.628470778f},
-std::array<float,2>{0.525515437f, 0.318981737f},
-std::array<float,2>{0.178555235f, 0.207411289f},
-std::array<float,2>{0.969219506f, 0.848871827f},
-std::array<float,2>{0.10839501f, 0.935649812f},
-std::array<float,2>{0.811167359f, 0.0495698527f},
-std::array<float,2>{0.358298779f, 0.4072088f},
-std::array<float,2>{0.697491825f, 0.536103785f},
-std::array<float,2>{0.307478994f, 0.769630551f},
-std::array<float,2>{0.654617071f, 0.153529137f},
-std::array<float,2>{0.00621569389f, 0.252591461f},
-std::array<float,2>{0.83743453f, 0.68850106f},
-std::array<float,2>{0.190415785f, 0.590632975f},
-std::array<float,2>{0.932524145f, 0.482455969f},
-std::array<float,2>{0.445982665f, 0.11606738f},
-std::array<float,2>{0.585757375f, 0.943149507f},
-std::array<float,2>{0.459964693f, 0.624391496f},
-std::array<float,2>{0.568558455f, 0.45668754f},
-std::array<float,2>{0.216228455f, 0.0694828555f},
-std::array<float,2>{0.911749125f, 0.981664896f},
-std::array<float,2>{0.0180451181f, 0.801209629f},
-std::array<float,2>{0.813093841f, 0.164427549f},
-std::array<float,2>{0.294340581f, 0.283370644f},
-std::array<float,2>{0.635349989f, 0.73262018f},
-std::array<float,2>{0.365315825f, 0.906166911f},
-std::array<float,2>{0.70977062f, 0.0141514866f},
-std::array<float,2>{0.121118307f, 0.393840522f},
-std::array<float,2>{0.78852129f, 0.530883551f},
-std::array<float,2>{0.159320205f, 0.665593505f},
-std::array<float,2>{0.990505636f, 0.352318406f},
-std::array<float,2>{0.423443347f, 0.243272156f},
-std::array<float,2>{0.51295048f, 0.822097361f},
-std::array<float,2>{0.269255698f, 0.715921938f},
-std::array<float,2>{0.658496499f, 0.27350229f},
-std::array<float,2>{0.0434552059f, 0.127587736f},
-std::array<float,2>{0.85453397f, 0.760515332f},
-std::array<float,2>{0.226560965f, 0.959488332f},
-std::array<float,2>{0.886259675f, 0.106853575f},
-std::array<float,2>{0.493111283f, 0.495514631f},
-std::array<float,2>{0.599038482f, 0.568458557f},
-std::array<float,2>{0.397716194f, 0.872160017f},
-std::array<float,2>{0.53294754f, 0.191198081f},
-std::array<float,2>{0.147636116f, 0.337648332f},
-std::array<float,2>{0.965168417f, 0.645883441f},
-std::array<float,2>{0.0776733011f, 0.550538838f},
-std::array<float,2>{0.778220892f, 0.423775673f},
-std::array<float,2>{0.320763558f, 0.0316931456f},
-std::array<float,2>{0.740156591f, 0.916849852f},
-std::array<float,2>{0.309791744f, 0.518894017f},
-std::array<float,2>{0.651520789f, 0.399817169f},
-std::array<float,2>{0.00139498629f, 0.000634035037f},
-std::array<float,2>{0.840663433f, 0.891933739f},
-std::array<float,2>{0.194460228f, 0.819803715f},
-std::array<float,2>{0.934613943f, 0.23592183f},
-std::array<float,2>{0.449696749f, 0.349826485f},
-std::array<float,2>{0.579974711f, 0.660072207f},
-std::array<float,2>{0.411995649f, 0.969139218f},
-std::array<float,2>{0.528141856f, 0.0719821304f},
-std::array<float,2>{0.173165083f, 0.462427646f},
-std::array<float,2>{0.974379659f, 0.615809739f},
-std::array<float,2>{0.104222208f, 0.721860647f},
-std::array<float,2>{0.807338417f, 0.289984405f},
-std::array<float,2>{0.353399575f, 0.1595525f},
-std::array<float,2>{0.699752033f, 0.811284721f},
-std::array<float,2>{0.472455889f, 0.65138495f},
-std::array<float,2>{0.620908082f, 0.334594697f},
-std::array<float,2>{0.243340001f, 0.198562488f},
-std::array<float,2>{0.901533663f, 0.861635327f},
-std::array<float,2>{0.0580139123f, 0.913980007f},
-std::array<float,2>{0.862037539f, 0.0446043871f},
-std::array<float,2>{0.250951082f, 0.432857394f},
-std::array<float,2>{0.684051573f, 0.561173499f},
-std::array<float,2>{0.334706813f, 0.751162767f},
-std::array<float,2>{0.725418866f, 0.139323398f},
-std::array<float,2>{0.081706129f, 0.270148128f},
-std::array<float,2>{0.75542146f, 0.704774678f},
-std::array<float,2>{0.139967754f, 0.576781988f},
-std::array<float,2>{0.951504767f, 0.491457254f},
-std::array<float,2>{0.380676359f, 0.0957801789f},
-std::array<float,2>{0.555187643f, 0.967955947f},
-std::array<float,2>{0.391071111f, 0.608014107f},
-std::array<float,2>{0.538999498f, 0.449089825f},
-std::array<float,2>{0.141384095f, 0.0820369199f},
-std::array<float,2>{0.963336051f, 0.991070747f},
-std::array<float,2>{0.0732486024f, 0.795184731f},
-std::array<float,2>{0.774276316f, 0.174041346f},
-std::array<float,2>{0.327579439f, 0.30829227f},
-std::array<float,2>{0.737911105f, 0.743581176f},
-std::array<float,2>{0.269803047f, 0.878448248f},
-std::array<float,2>{0.662609458f, 0.0172599517f},
-std::array<float,2>{0.0416352935f, 0.378521264f},
-std::array<float,2>{0.8592363f, 0.507244468f},
-std::array<float,2>{0.220545679f, 0.680162251f},
-std::array<float,2>{0.888871551f, 0.363559365f},
-std::array<float,2>{0.497269362f, 0.2306519f},
-std::array<float,2>{0.596101642f, 0.84255451f},
-std::array<float,2>{0.361714572f, 0.700242162f},
-std::array<float,2>{0.705634296f, 0.259509951f},
-std::array<float,2>{0.118150346f, 0.148098648f},
-std::array<float,2>{0.783380032f, 0.778671861f},
-std::array<float,2>{0.161313564f, 0.94590199f},
-std::array<float,2>{0.987650335f, 0.120798327f},
-std::array<float,2>{0.426602036f, 0.475117296f},
-std::array<float,2>{0.51055485f, 0.582143128f},
-std::array<float,2>{0.456024498f, 0.85399574f},
-std::array<float,2>{0.563680172f, 0.215308592f},
-std::array<float,2>{0.213756382f, 0.323308617f},
-std::array<float,2>{0.910040557f, 0.640226603f},
-std::array<float,2>{0.0215375889f, 0.543102384f},
-std::array<float,2>{0.816798449f, 0.419034302f},
-std::array<float,2>{0.291302234f, 0.059474159f},
-std::array<float,2>{0.639284372f, 0.923856854f},
-std::array<float,2>{0.314749628f, 0.58829689f},
-std::array<float,2>{0.742382169f, 0.479172915f},
-std::array<float,2>{0.0667732358f, 0.111651734f},
-std::array<float,2>{0.767177939f, 0.940821588f},
-std::array<float,2>{0.155273274f, 0.768556535f},
-std::array<float,2>{0.958628297f, 0.151961029f},
-std::array<float,2>{0.405427605f, 0.257157534f},
-std::array<float,2>{0.541697741f, 0.691668689f},
-std::array<float,2>{0.489774555f, 0.930547535f},
-std::array<float,2>{0.601769567f, 0.051846616f},
-std::array<float,2>{0.228293613f, 0.413799673f},
-std::array<float,2>{0.876241744f, 0.532730699f},
-std::array<float,2>{0.0378822014f, 0.630800962f},
-std::array<float,2>{0.846838236f, 0.313044786f},
-std::array<float,2>{0.277467191f, 0.205489635f},
-std::array<float,2>{0.665737808f, 0.843795121f},
-std::array<float,2>{0.437404931f, 0.73479712f},
-std::array<float,2>{0.50508368f, 0.298134953f},
-std::array<float,2>{0.164309159f, 0.180648953f},
-std::array<float,2>{0.997499824f, 0.785648227f},
-std::array<float,2>{0.113874763f, 0.997255921f},
-std::array<float,2>{0.791809857f, 0.0890802369f},
-std::array<float,2>{0.369111061f, 0.442184657f},
-std::array<float,2>{0.712399483f, 0.601082206f},
-std::array<float,2>{0.288279563f, 0.832790792f},
-std::array<float,2>{0.62853837f, 0.223280102f},
-std::array<float,2>{0.0256890003f, 0.371981233f},
-std::array<float,2>{0.822857618f, 0.676395655f},
-std::array<float,2>{0.204286426f, 0.514211357f},
-std::array<float,2>{0.915669024f, 0.389968693f},
-std::array<float,2>{0.46226427f, 0.0243727174f},
-std::array<float,2>{0.574139118f, 0.889099121f},
-std::array<float,2>{0.439610779f, 0.554350019f},
-std::array<float,2>{0.592590153f, 0.429250866f},
-std::array<float,2>{0.202830553f, 0.0367772616f},
-std::array<float,2>{0.929145098f, 0.918523669f},
-std::array<float,2>{0.0110332808f, 0.867733359f},
-std::array<float,2>{0.829996765f, 0.191702068f},
-std::array<float,2>{0.30464983f, 0.342959285f},
-std::array<float,2>{0.648413599f, 0.641481698f},
-std::array<float,2>{0.348598301f, 0.953774333f},
-std::array<float,2>{0.694101572f, 0.103015594f},
-std::array<float,2>{0.0938314572f, 0.497018367f},
-std::array<float,2>{0.802965701f, 0.565794468f},
-std::array<float,2>{0.186479345f, 0.714526772f},
-std::array<float,2>{0.978268981f, 0.280247808f},
-std::array<float,2>{0.419460595f, 0.131787643f},
-std::array<float,2>{0.515955627f, 0.763071835f},
-std::array<float,2>{0.258637309f, 0.669996262f},
-std::array<float,2>{0.677287757f, 0.357619017f},
-std::array<float,2>{0.0488505997f, 0.249865726f},
-std::array<float,2>{0.873028815f, 0.826914966f},
-std::array<float,2>{0.241085216f, 0.899996579f},
-std::array<float,2>{0.891125143f, 0.0100941462f},
-std::array<float,2>{0.481062889f, 0.398054093f},
-std::array<float,2>{0.615613282f, 0.523998618f},
-std::array<float,2>{0.390114069f, 0.798719227f},
-std::array<float,2>{0.549485326f, 0.169183522f},
-std::array<float,2>{0.129445776f, 0.286844492f},
-std::array<float,2>{0.94043076f, 0.728334129f},
-std::array<float,2>{0.0863479748f, 0.621074438f},
-std::array<float,2>{0.761539042f, 0.460913837f},
-std::array<float,2>{0.341300279f, 0.0628966168f},
-std::array<float,2>{0.726815879f, 0.979373991f},
-std::array<float,2>{0.276349574f, 0.611651301f},
-std::array<float,2>{0.670151174f, 0.467614889f},
-std::array<float,2>{0.0344570652f, 0.0749917701f},
-std::array<float,2>{0.849637747f, 0.974678755f},
-std::array<float,2>{0.231471062f, 0.806470692f},
-std::array<float,2>{0.882112801f, 0.162511617f},
-std::array<float,2>{0.485530794f, 0.2948291f},
-std::array<float,2>{0.608015478f, 0.722768545f},
-std::array<float,2>{0.401001662f, 0.895430088f},
-std::array<float,2>{0.546016216f, 0.00633107778f},
-std::array<float,2>{0.151803583f, 0.405885994f},
-std::array<float,2>{0.953216016f, 0.519949734f},
-std::array<float,2>{0.0658762306f, 0.660283566f},
-std::array<float,2>{0.769932687f, 0.344155073f},
-std::array<float,2>{0.318695545f, 0.241910115f},
-std::array<float,2>{0.749358118f, 0.813947678f},
-std::array<float,2>{0.466575086f, 0.709030271f},
-std::array<float,2>{0.576901913f, 0.266341984f},
-std::array<float,2>{0.209129825f, 0.133255884f},
-std::array<float,2>{0.918233514f, 0.75439471f},
-std::array<float,2>{0.0305293761f, 0.961542487f},
-std::array<float,2>{0.824483454f, 0.100635059f},
-std::array<float,2>{0.284662485f, 0.487781852f},
-std::array<float,2>{0.63151145f, 0.570974827f},
-std::array<float,2>{0.371888459f, 0.865638375f},
-std::array<float,2>{0.716725409f, 0.201056257f},
-std::array<float,2>{0.112020716f, 0.331840843f},
-std::array<float,2>{0.795519531f, 0.653679073f},
-std::array<float,2>{0.171110079f, 0.557048321f},
-std::array<float,2>{0.992535174f, 0.434044868f},
-std::array<float,2>{0.430287749f, 0.0429472737f},
-std::array<float,2>{0.502693594f, 0.908871412f},
-std::array<float,2>{0.417880118f, 0.502860606f},
-std::array<float,2>{0.521578193f, 0.379358798f},
-std::array<float,2>{0.182082072f, 0.0214852896f},
-std::array<float,2>{0.981300592f, 0.881115198f},
-std::array<float,2>{0.100827977f, 0.836581647f},
-std::array<float,2>{0.798999846f, 0.228406236f},
-std::array<float,2>{0.347033501f, 0.361509949f},
-std::array<float,2>{0.69036603f, 0.686616302f},
-std::array<float,2>{0.298592836f, 0.986659646f},
-std::array<float,2>{0.64390713f, 0.0812979862f},
-std::array<float,2>{0.0149273602f, 0.451158285f},
-std::array<float,2>{0.834690094f, 0.603796601f},
-std::array<float,2>{0.197307035f, 0.746397376f},
-std::array<float,2>{0.92451036f, 0.309003472f},
-std::array<float,2>{0.443885565f, 0.178489164f},
-std::array<float,2>{0.587789953f, 0.791630089f},
-std::array<float,2>{0.338022292f, 0.63555038f},
-std::array<float,2>{0.732347906f, 0.325870305f},
-std::array<float,2>{0.0911705345f, 0.211463109f},
-std::array<float,2>{0.763569891f, 0.855491757f},
-std::array<float,2>{0.126907632f, 0.929042578f},
-std::array<float,2>{0.941640675f, 0.0584316626f},
-std::array<float,2>{0.38558501f, 0.416584581f},
-std::array<float,2>{0.554403484f, 0.541715086f},
-std::array<float,2>{0.47722289f, 0.773854971f},
-std::array<float,2>{0.612063706f, 0.143422946f},
-std::array<float,2>{0.236345261f, 0.263300538f},
-std::array<float,2>{0.897356808f, 0.69571656f},
-std::array<float,2>{0.0544803999f, 0.579076886f},
-std::array<float,2>{0.870886922f, 0.471852273f},
-std::array<float,2>{0.263134837f, 0.124964744f},
-std::array<float,2>{0.675223827f, 0.951941609f},
-std::array<float,2>{0.357037365f, 0.537931144f},
-std::array<float,2>{0.696317196f, 0.408780247f},
-std::array<float,2>{0.105654411f, 0.0483973287f},
-std::array<float,2>{0.809335589f, 0.934406579f},
-std::array<float,2>{0.176146209f, 0.850059211f},
-std::array<float,2>{0.971519172f, 0.209110275f},
-std::array<float,2>{0.407521307f, 0.316764206f},
-std::array<float,2>{0.524184406f, 0.626706243f},
-std::array<float,2>{0.447473615f, 0.945284545f},
-std::array<float,2>{0.582899928f, 0.11499171f},
-std::array<float,2>{0.188251793f, 0.480769485f},
-std::array<float,2>{0.931077421f, 0.593743682f},
-std::array<float,2>{0.00409352081f, 0.690054238f},
-std::array<float,2>{0.838147402f, 0.250045091f},
-std::array<float,2>{0.3053464f, 0.155650884f},
-std::array<float,2>{0.653298318f, 0.773197055f},
-std::array<float,2>{0.375164092f, 0.671930015f},
-std::array<float,2>{0.559686601f, 0.368313432f},
-std::array<float,2>{0.13303256f, 0.221791506f},
-std::array<float,2>{0.947291434f, 0.830420077f},
-std::array<float,2>{0.082415767f, 0.885154784f},
-std::array<float,2>{0.753001988f, 0.0277344268f},
-std::array<float,2>{0.328659356f, 0.386279434f},
-std::array<float,2>{0.719823956f, 0.510000348f},
-std::array<float,2>{0.256211281f, 0.784616351f},
-std::array<float,2>{0.680440187f, 0.184639126f},
-std::array<float,2>{0.0620800443f, 0.304222763f},
-std::array<float,2>{0.864946008f, 0.741219163f},
-std::array<float,2>{0.248872012f, 0.597419679f},
-std::array<float,2>{0.904325187f, 0.440851748f},
-std::array<float,2>{0.473208189f, 0.0899594352f},
-std::array<float,2>{0.623449981f, 0.994213104f},
-std::array<float,2>{0.495910347f, 0.567575336f},
-std::array<float,2>{0.600704491f, 0.493404627f},
-std::array<float,2>{0.223151267f, 0.10858696f},
-std::array<float,2>{0.884383142f, 0.958310843f},
-std::array<float,2>{0.0451521985f, 0.758871198f},
-std::array<float,2>{0.852395773f, 0.125475883f},
-std::array<float,2>{0.267261863f, 0.277031779f},
-std::array<float,2>{0.657650054f, 0.718656778f},
-std::array<float,2>{0.323443174f, 0.915091455f},
-std::array<float,2>{0.741292059f, 0.034296196f},
-std::array<float,2>{0.0742974207f, 0.425083607f},
-std::array<float,2>{0.78086549f, 0.547454298f},
-std::array<float,2>{0.145322114f, 0.648020566f},
-std::array<float,2>{0.968712568f, 0.338941127f},
-std::array<float,2>{0.395721525f, 0.189405769f},
-std::array<float,2>{0.53370142f, 0.873192251f},
-std::array<float,2>{0.296719581f, 0.73112607f},
-std::array<float,2>{0.634394109f, 0.282038689f},
-std::array<float,2>{0.0168679301f, 0.166020408f},
-std::array<float,2>{0.816068172f, 0.803892672f},
-std::array<float,2>{0.217738941f, 0.983687639f},
-std::array<float,2>{0.912458658f, 0.066941306f},
-std::array<float,2>{0.457593113f, 0.453707993f},
-std::array<float,2>{0.566993117f, 0.621709406f},
-std::array<float,2>{0.424239308f, 0.823312759f},
-std::array<float,2>{0.51494658f, 0.245210513f},
-std::array<float,2>{0.157209575f, 0.354410172f},
-std::array<float,2>{0.990219057f, 0.666658163f},
-std::array<float,2>{0.123532161f, 0.527710855f},
-std::array<float,2>{0.785623491f, 0.39103514f},
-std::array<float,2>{0.364694864f, 0.0134686828f},
-std::array<float,2>{0.708537757f, 0.902657926f},
-std::array<float,2>{0.292793483f, 0.546346605f},
-std::array<float,2>{0.639847517f, 0.421640694f},
-std::array<float,2>{0.0231098626f, 0.0624670088f},
-std::array<float,2>{0.81791091f, 0.923508584f},
-std::array<float,2>{0.21481207f, 0.851944089f},
-std::array<float,2>{0.908692896f, 0.217041597f},
-std::array<float,2>{0.456674993f, 0.320992559f},
-std::array<float,2>{0.562629342f, 0.638447583f},
-std::array<float,2>{0.427042872f, 0.948844135f},
-std::array<float,2>{0.5111292f, 0.118168138f},
-std::array<float,2>{0.160664424f, 0.473485291f},
-std::array<float,2>{0.986517966f, 0.584644258f},
-std::array<float,2>{0.11831598f, 0.702271521f},
-std::array<float,2>{0.784751892f, 0.261572003f},
-std::array<float,2>{0.363002211f, 0.14608103f},
-std::array<float,2>{0.706173837f, 0.781013191f},
-std::array<float,2>{0.496153861f, 0.681727886f},
-std::array<float,2>{0.596763253f, 0.366376817f},
-std::array<float,2>{0.218892962f, 0.234354407f},
-std::array<float,2>{0.889703333f, 0.841249764f},
-std::array<float,2>{0.0420764647f, 0.876872957f},
-std::array<float,2>{0.857635081f, 0.0189704094f},
-std::array<float,2>{0.271380246f, 0.375066161f},
-std::array<float,2>{0.663847566f, 0.505196393f},
-std::array<float,2>{0.326679379f, 0.794171274f},
-std::array<float,2>{0.736852407f, 0.173764721f},
-std::array<float,2>{0.072999306f, 0.305635065f},
-std::array<float,2>{0.774825096f, 0.745829046f},
-std::array<float,2>{0.141997695f, 0.605564475f},
-std::array<float,2>{0.964060485f, 0.447093785f},
-std::array<float,2>{0.391602486f, 0.085706301f},
-std::array<float,2>{0.537795305f, 0.989208817f},
-std::array<float,2>{0.379339099f, 0.574369848f},
-std::array<float,2>{0.555768192f, 0.490231067f},
-std::array<float,2>{0.138818562f, 0.0947274864f},
-std::array<float,2>{0.952352643f, 0.964855552f},
-std::array<float,2>{0.0807720348f, 0.752238691f},
-std::array<float,2>{0.754874587f, 0.138130009f},
-std::array<float,2>{0.335675567f, 0.272042722f},
-std::array<float,2>{0.725841641f, 0.706537962f},
-std::array<float,2>{0.251803994f, 0.910387158f},
-std::array<float,2>{0.685081542f, 0.0461041555f},
-std::array<float,2>{0.0571860559f, 0.429841995f},
-std::array<float,2>{0.863146305f, 0.558827937f},
-std::array<float,2>{0.242896363f, 0.648590207f},
-std::array<float,2>{0.90077436f, 0.333143204f},
-std::array<float,2>{0.471132278f, 0.197165713f},
-std::array<float,2>{0.620006382f, 0.860312402f},
-std::array<float,2>{0.352338046f, 0.719326079f},
-std::array<float,2>{0.700227857f, 0.291316777f},
-std::array<float,2>{0.105258912f, 0.157859504f},
-std::array<float,2>{0.808230281f, 0.809849143f},
-std::array<float,2>{0.172542974f, 0.971218109f},
-std::array<float,2>{0.973019421f, 0.0738919526f},
-std::array<float,2>{0.411082178f, 0.463622928f},
-std::array<float,2>{0.528923988f, 0.613660276f},
-std::array<float,2>{0.45083186f, 0.817967832f},
-std::array<float,2>{0.57830584f, 0.237599239f},
-std::array<float,2>{0.193651199f, 0.348711073f},
-std::array<float,2>{0.934313178f, 0.657792866f},
-std::array<float,2>{0.000305317197f, 0.516146839f},
-std::array<float,2>{0.841403008f, 0.40051052f},
-std::array<float,2>{0.309180915f, 0.00287034386f},
-std::array<float,2>{0.650885165f, 0.894305646f},
-std::array<float,2>{0.33995077f, 0.617697299f},
-std::array<float,2>{0.728004336f, 0.458210975f},
-std::array<float,2>{0.0876186416f, 0.0660260171f},
-std::array<float,2>{0.760631502f, 0.978396356f},
-std::array<float,2>{0.130656347f, 0.799440086f},
-std::array<float,2>{0.940109253f, 0.170617238f},
-std::array<float,2>{0.38909477f, 0.288978249f},
-std::array<float,2>{0.550286114f, 0.729900062f},
-std::array<float,2>{0.481875956f, 0.901121736f},
-std::array<float,2>{0.61632812f, 0.00924762152f},
-std::array<float,2>{0.242180482f, 0.396231651f},
-std::array<float,2>{0.892504573f, 0.525769591f},
-std::array<float,2>{0.050335478f, 0.668590009f},
-std::array<float,2>{0.871772885f, 0.355682492f},
-std::array<float,2>{0.258990079f, 0.24695915f},
-std::array<float,2>{0.676104903f, 0.825875103f},
-std::array<float,2>{0.418579996f, 0.712772369f},
-std::array<float,2>{0.516789317f, 0.277492672f},
-std::array<float,2>{0.186575308f, 0.130548254f},
-std::array<float,2>{0.97664541f, 0.76538676f},
-std::array<float,2>{0.0952185541f, 0.955930769f},
-std::array<float,2>{0.804167509f, 0.104977019f},
-std::array<float,2>{0.3493191f, 0.499192357f},
-std::array<float,2>{0.694369853f, 0.563877463f},
-std::array<float,2>{0.303710282f, 0.87084657f},
-std::array<float,2>{0.646562338f, 0.194777653f},
-std::array<float,2>{0.0101549169f, 0.341197163f},
-std::array<float,2>{0.829045117f, 0.642922461f},
-std::array<float,2>{0.201328024f, 0.551924586f},
-std::array<float,2>{0.928363562f, 0.426095128f},
-std::array<float,2>{0.440658212f, 0.0388787538f},
-std::array<float,2>{0.593355417f, 0.92115891f},
-std::array<float,2>{0.461286396f, 0.512671649f},
-std::array<float,2>{0.572501183f, 0.38786006f},
-std::array<float,2>{0.203569457f, 0.0259721298f},
-std::array<float,2>{0.914476097f, 0.887575865f},
-std::array<float,2>{0.0264350567f, 0.83581233f},
-std::array<float,2>{0.824214816f, 0.225256488f},
-std::array<float,2>{0.287326247f, 0.374127418f},
-std::array<float,2>{0.627190351f, 0.679540455f},
-std::array<float,2>{0.36778149f, 0.998856068f},
-std::array<float,2>{0.711077332f, 0.0866184682f},
-std::array<float,2>{0.114380725f, 0.44412145f},
-std::array<float,2>{0.792299151f, 0.598511875f},
-std::array<float,2>{0.165841416f, 0.736641765f},
-std::array<float,2>{0.997047186f, 0.300661564f},
-std::array<float,2>{0.436125189f, 0.182560533f},
-std::array<float,2>{0.504839718f, 0.787386477f},
-std::array<float,2>{0.279083341f, 0.631483495f},
-std::array<float,2>{0.664582908f, 0.315053165f},
-std::array<float,2>{0.0389054976f, 0.204790667f},
-std::array<float,2>{0.846600652f, 0.846388459f},
-std::array<float,2>{0.226892069f, 0.932037175f},
-std::array<float,2>{0.875433445f, 0.0528871305f},
-std::array<float,2>{0.488681674f, 0.41050607f},
-std::array<float,2>{0.60336405f, 0.533324361f},
-std::array<float,2>{0.404637545f, 0.767215908f},
-std::array<float,2>{0.542665303f, 0.150221333f},
-std::array<float,2>{0.156073302f, 0.255168498f},
-std::array<float,2>{0.957074344f, 0.694915175f},
-std::array<float,2>{0.067641288f, 0.586232007f},
-std::array<float,2>{0.766007841f, 0.47726509f},
-std::array<float,2>{0.315903217f, 0.11077594f},
-std::array<float,2>{0.74402231f, 0.937715948f},
-std::array<float,2>{0.262463868f, 0.580559075f},
-std::array<float,2>{0.674373746f, 0.469494998f},
-std::array<float,2>{0.0534367375f, 0.121193804f},
-std::array<float,2>{0.87000829f, 0.950235784f},
-std::array<float,2>{0.238002881f, 0.775878072f},
-std::array<float,2>{0.898080766f, 0.140899852f},
-std::array<float,2>{0.477689981f, 0.26388067f},
-std::array<float,2>{0.612704515f, 0.699063241f},
-std::array<float,2>{0.386496276f, 0.926103115f},
-std::array<float,2>{0.552977085f, 0.0554301441f},
-std::array<float,2>{0.12540631f, 0.41598016f},
-std::array<float,2>{0.942852497f, 0.540117383f},
-std::array<float,2>{0.0899164602f, 0.634542346f},
-std::array<float,2>{0.761864781f, 0.326954454f},
-std::array<float,2>{0.338933587f, 0.21294789f},
-std::array<float,2>{0.730659544f, 0.857621968f},
-std::array<float,2>{0.444986105f, 0.748060048f},
-std::array<float,2>{0.586399972f, 0.311050594f},
-std::array<float,2>{0.198960632f, 0.177626505f},
-std::array<float,2>{0.925169289f, 0.789716244f},
-std::array<float,2>{0.0142136924f, 0.986305416f},
-std::array<float,2>{0.835367203f, 0.0796925798f},
-std::array<float,2>{0.29754284f, 0.452745736f},
-std::array<float,2>{0.64335686f, 0.602694511f},
-std::array<float,2>{0.346576512f, 0.838565052f},
-std::array<float,2>{0.691323757f, 0.230155915f},
-std::array<float,2>{0.100482829f, 0.359444767f},
-std::array<float,2>{0.800216436f, 0.685472071f},
-std::array<float,2>{0.183172345f, 0.500747681f},
-std::array<float,2>{0.981592715f, 0.381615222f},
-std::array<float,2>{0.416035682f, 0.0198157243f},
-std::array<float,2>{0.523070574f, 0.880325913f},
-std::array<float,2>{0.431211919f, 0.554844797f},
-std::array<float,2>{0.503515661f, 0.437152505f},
-std::array<float,2>{0.170069635f, 0.0406775884f},
-std::array<float,2>{0.993204057f, 0.906932116f},
-std::array<float,2>{0.113037087f, 0.863647699f},
-std::array<float,2>{0.796384156f, 0.203039065f},
-std::array<float,2>{0.372536272f, 0.329324514f},
-std::array<float,2>{0.715439618f, 0.655202329f},
-std::array<float,2>{0.283429205f, 0.96357435f},
-std::array<float,2>{0.632694066f, 0.098445639f},
-std::array<float,2>{0.0295207202f, 0.485957772f},
-std::array<float,2>{0.825413167f, 0.572983563f},
-std::array<float,2>{0.210699558f, 0.708357573f},
-std::array<float,2>{0.918945491f, 0.269467354f},
-std::array<float,2>{0.465061158f, 0.135930151f},
-std::array<float,2>{0.577751338f, 0.75766629f},
-std::array<float,2>{0.3201406f, 0.663032174f},
-std::array<float,2>{0.748871088f, 0.346557289f},
-std::array<float,2>{0.0647364482f, 0.239706799f},
-std::array<float,2>{0.771308601f, 0.816009104f},
-std::array<float,2>{0.150960326f, 0.896832407f},
-std::array<float,2>{0.954818189f, 0.0048174453f},
-std::array<float,2>{0.402216494f, 0.403405339f},
-std::array<float,2>{0.545105159f, 0.523274481f},
-std::array<float,2>{0.485214382f, 0.807641447f},
-std::array<float,2>{0.60897094f, 0.161792099f},
-std::array<float,2>{0.231344044f, 0.295282423f},
-std::array<float,2>{0.881184638f, 0.725245178f},
-std::array<float,2>{0.0336001366f, 0.60959363f},
-std::array<float,2>{0.850677133f, 0.4649795f},
-std::array<float,2>{0.276537687f, 0.0766247362f},
-std::array<float,2>{0.671633303f, 0.973646164f},
-std::array<float,2>{0.363886178f, 0.529819429f},
-std::array<float,2>{0.707699776f, 0.392618448f},
-std::array<float,2>{0.124355942f, 0.0148936315f},
-std::array<float,2>{0.786895633f, 0.904935718f},
-std::array<float,2>{0.157235488f, 0.8206985f},
-std::array<float,2>{0.98835516f, 0.242258757f},
-std::array<float,2>{0.425133318f, 0.352762192f},
-std::array<float,2>{0.513951182f, 0.664984524f},
-std::array<float,2>{0.458635211f, 0.981043756f},
-std::array<float,2>{0.5675807f, 0.0684528798f},
-std::array<float,2>{0.218049124f, 0.455198675f},
-std::array<float,2>{0.913461983f, 0.623444498f},
-std::array<float,2>{0.0158778131f, 0.733606458f},
-std::array<float,2>{0.815115511f, 0.28477338f},
-std::array<float,2>{0.295409501f, 0.165837914f},
-std::array<float,2>{0.633521795f, 0.802114546f},
-std::array<float,2>{0.395140618f, 0.644670188f},
-std::array<float,2>{0.534479976f, 0.3360098f},
-std::array<float,2>{0.145570979f, 0.190247312f},
-std::array<float,2>{0.967653215f, 0.871526003f},
-std::array<float,2>{0.0761317983f, 0.917755783f},
-std::array<float,2>{0.779635549f, 0.0330231935f},
-std::array<float,2>{0.322287887f, 0.422357649f},
-std::array<float,2>{0.740993321f, 0.549197018f},
-std::array<float,2>{0.266399771f, 0.761413038f},
-std::array<float,2>{0.656852901f, 0.128634468f},
-std::array<float,2>{0.0462117195f, 0.274531394f},
-std::array<float,2>{0.853065073f, 0.715300083f},
-std::array<float,2>{0.224167719f, 0.570261836f},
-std::array<float,2>{0.883776605f, 0.494173944f},
-std::array<float,2>{0.494436234f, 0.105865851f},
-std::array<float,2>{0.600236237f, 0.960157931f},
-std::array<float,2>{0.47436884f, 0.595349491f},
-std::array<float,2>{0.624609649f, 0.438026637f},
-std::array<float,2>{0.249748036f, 0.0936954468f},
-std::array<float,2>{0.906086266f, 0.992707193f},
-std::array<float,2>{0.0612642691f, 0.782995164f},
-std::array<float,2>{0.863995433f, 0.18654108f},
-std::array<float,2>{0.257774115f, 0.302706093f},
-std::array<float,2>{0.681445479f, 0.73828572f},
-std::array<float,2>{0.330003858f, 0.883291483f},
-std::array<float,2>{0.71923244f, 0.0295521915f},
-std::array<float,2>{0.0837214142f, 0.383664459f},
-std::array<float,2>{0.751972377f, 0.507849455f},
-std::array<float,2>{0.133931905f, 0.674910069f},
-std::array<float,2>{0.949045539f, 0.3702389f},
-std::array<float,2>{0.376014173f, 0.220507622f},
-std::array<float,2>{0.559557974f, 0.829075277f},
-std::array<float,2>{0.305809051f, 0.687536418f},
-std::array<float,2>{0.65426904f, 0.253752053f},
-std::array<float,2>{0.00570648676f, 0.152479604f},
-std::array<float,2>{0.838905632f, 0.77111721f},
-std::array<float,2>{0.188725457f, 0.942311227f},
-std::array<float,2>{0.930362046f, 0.116444379f},
-std::array<float,2>{0.448982209f, 0.484183609f},
-std::array<float,2>{0.583933353f, 0.59134239f},
-std::array<float,2>{0.406986058f, 0.847956955f},
-std::array<float,2>{0.525210261f, 0.208825529f},
-std::array<float,2>{0.17684333f, 0.319922358f},
-std::array<float,2>{0.971849144f, 0.627506912f},
-std::array<float,2>{0.107301548f, 0.536751628f},
-std::array<float,2>{0.809907615f, 0.407331616f},
-std::array<float,2>{0.35547322f, 0.0499068387f},
-std::array<float,2>{0.695457697f, 0.936793864f},
-std::array<float,2>{0.272714406f, 0.50631398f},
-std::array<float,2>{0.661113441f, 0.377313882f},
-std::array<float,2>{0.0391643196f, 0.0161464866f},
-std::array<float,2>{0.85674417f, 0.877875328f},
-std::array<float,2>{0.2224444f, 0.843021572f},
-std::array<float,2>{0.8868258f, 0.232185692f},
-std::array<float,2>{0.498913109f, 0.364383161f},
-std::array<float,2>{0.594840944f, 0.681504428f},
-std::array<float,2>{0.394088566f, 0.991931736f},
-std::array<float,2>{0.536594808f, 0.083832778f},
-std::array<float,2>{0.142850325f, 0.447394937f},
-std::array<float,2>{0.962405324f, 0.608576596f},
-std::array<float,2>{0.0717591345f, 0.74240011f},
-std::array<float,2>{0.776993334f, 0.306802064f},
-std::array<float,2>{0.324537873f, 0.175364822f},
-std::array<float,2>{0.734414101f, 0.79609412f},
-std::array<float,2>{0.45365864f, 0.639366269f},
-std::array<float,2>{0.565916002f, 0.322716296f},
-std::array<float,2>{0.210946262f, 0.215932399f},
-std::array<float,2>{0.906577229f, 0.855273247f},
-std::array<float,2>{0.0207042228f, 0.92496258f},
-std::array<float,2>{0.819381714f, 0.0602786094f},
-std::array<float,2>{0.290933311f, 0.418471694f},
-std::array<float,2>{0.638353288f, 0.544487834f},
-std::array<float,2>{0.359519243f, 0.778250098f},
-std::array<float,2>{0.704790294f, 0.147009194f},
-std::array<float,2>{0.120525405f, 0.258197725f},
-std::array<float,2>{0.782600045f, 0.699301183f},
-std::array<float,2>{0.162608862f, 0.583723187f},
-std::array<float,2>{0.984475434f, 0.476352364f},
-std::array<float,2>{0.428298384f, 0.119210064f},
-std::array<float,2>{0.509688556f, 0.946633399f},
-std::array<float,2>{0.412610948f, 0.616344571f},
-std::array<float,2>{0.529417217f, 0.460962713f},
-std::array<float,2>{0.173890114f, 0.0708191171f},
-std::array<float,2>{0.976027191f, 0.970415473f},
-std::array<float,2>{0.103021987f, 0.811728656f},
-std::array<float,2>{0.806040287f, 0.158925071f},
-std::array<float,2>{0.35430792f, 0.290127456f},
-std::array<float,2>{0.70254302f, 0.721253395f},
-std::array<float,2>{0.311797142f, 0.891017377f},
-std::array<float,2>{0.649261236f, 0.00108699326f},
-std::array<float,2>{0.00344135799f, 0.39885962f},
-std::array<float,2>{0.843333006f, 0.517997324f},
-std::array<float,2>{0.192607477f, 0.658656895f},
-std::array<float,2>{0.937318623f, 0.350964725f},
-std::array<float,2>{0.451241344f, 0.234809935f},
-std::array<float,2>{0.580736816f, 0.81894207f},
-std::array<float,2>{0.333463609f, 0.703636765f},
-std::array<float,2>{0.723988414f, 0.271407902f},
-std::array<float,2>{0.0796276778f, 0.140212312f},
-std::array<float,2>{0.757357836f, 0.750743389f},
-std::array<float,2>{0.137288928f, 0.967041314f},
-std::array<float,2>{0.949367523f, 0.0973775908f},
-std::array<float,2>{0.382195801f, 0.490458459f},
-std::array<float,2>{0.558545172f, 0.577322185f},
-std::array<float,2>{0.46911931f, 0.862319231f},
-std::array<float,2>{0.618255675f, 0.197334677f},
-std::array<float,2>{0.245602682f, 0.335161507f},
-std::array<float,2>{0.8992908f, 0.650860429f},
-std::array<float,2>{0.0550416596f, 0.562472463f},
-std::array<float,2>{0.860950708f, 0.432016343f},
-std::array<float,2>{0.252874345f, 0.0437656939f},
-std::array<float,2>{0.687164962f, 0.912723303f},
-std::array<float,2>{0.351341784f, 0.56539911f},
-std::array<float,2>{0.692755401f, 0.497667313f},
-std::array<float,2>{0.0971875712f, 0.101930693f},
-std::array<float,2>{0.801236689f, 0.954989016f},
-std::array<float,2>{0.183634281f, 0.76237762f},
-std::array<float,2>{0.978698969f, 0.132371873f},
-std::array<float,2>{0.421367288f, 0.280649602f},
-std::array<float,2>{0.519479632f, 0.713253915f},
-std::array<float,2>{0.438238531f, 0.919532597f},
-std::array<float,2>{0.590649843f, 0.035570398f},
-std::array<float,2>{0.200615585f, 0.42779544f},
-std::array<float,2>{0.927505314f, 0.553699434f},
-std::array<float,2>{0.00802519731f, 0.641910553f},
-std::array<float,2>{0.830384552f, 0.342479855f},
-std::array<float,2>{0.302323639f, 0.193343446f},
-std::array<float,2>{0.644681454f, 0.868406594f},
-std::array<float,2>{0.388058901f, 0.72681576f},
-std::array<float,2>{0.547596514f, 0.285654128f},
-std::array<float,2>{0.131376907f, 0.168926731f},
-std::array<float,2>{0.938867509f, 0.797441721f},
-std::array<float,2>{0.088898927f, 0.980340302f},
-std::array<float,2>{0.757848859f, 0.0636571571f},
-std::array<float,2>{0.343576729f, 0.459883898f},
-std::array<float,2>{0.729635835f, 0.619718254f},
-std::array<float,2>{0.260275334f, 0.827489018f},
-std::array<float,2>{0.679452837f, 0.248405859f},
-std::array<float,2>{0.0476468652f, 0.358863622f},
-std::array<float,2>{0.874850631f, 0.671686113f},
-std::array<float,2>{0.238505095f, 0.524969041f},
-std::array<float,2>{0.893447042f, 0.396603912f},
-std::array<float,2>{0.482641757f, 0.0109121613f},
-std::array<float,2>{0.613290787f, 0.898985445f},
-std::array<float,2>{0.491432071f, 0.531719744f},
-std::array<float,2>{0.604523659f, 0.412870347f},
-std::array<float,2>{0.229140833f, 0.051265765f},
-std::array<float,2>{0.877918899f, 0.931556702f},
-std::array<float,2>{0.0359739922f, 0.845488966f},
-std::array<float,2>{0.844372749f, 0.206277594f},
-std::array<float,2>{0.28124103f, 0.313860565f},
-std::array<float,2>{0.666193724f, 0.628985345f},
-std::array<float,2>{0.313573927f, 0.94015342f},
-std::array<float,2>{0.745591342f, 0.113204964f},
-std::array<float,2>{0.0694767982f, 0.480339378f},
-std::array<float,2>{0.767708123f, 0.58943361f},
-std::array<float,2>{0.152803972f, 0.693252444f},
-std::array<float,2>{0.960656047f, 0.256310582f},
-std::array<float,2>{0.403040677f, 0.15133357f},
-std::array<float,2>{0.540468574f, 0.768055856f},
-std::array<float,2>{0.285626352f, 0.677377403f},
-std::array<float,2>{0.625611186f, 0.372951686f},
-std::array<float,2>{0.023855919f, 0.22448203f},
-std::array<float,2>{0.821491838f, 0.83349371f},
-std::array<float,2>{0.206946731f, 0.8899073f},
-std::array<float,2>{0.916744769f, 0.025380753f},
-std::array<float,2>{0.464053273f, 0.389369786f},
-std::array<float,2>{0.572216809f, 0.515450656f},
-std::array<float,2>{0.433733106f, 0.786613524f},
-std::array<float,2>{0.505922616f, 0.180670857f},
-std::array<float,2>{0.167822793f, 0.296894222f},
-std::array<float,2>{0.998359144f, 0.736142099f},
-std::array<float,2>{0.116314039f, 0.600236654f},
-std::array<float,2>{0.790961027f, 0.442741781f},
-std::array<float,2>{0.370855123f, 0.0884953067f},
-std::array<float,2>{0.714345753f, 0.996131778f},
-std::array<float,2>{0.300038129f, 0.604740024f},
-std::array<float,2>{0.642473519f, 0.44997564f},
-std::array<float,2>{0.0119444272f, 0.0804308727f},
-std::array<float,2>{0.833279192f, 0.988052011f},
-std::array<float,2>{0.19660385f, 0.792052746f},
-std::array<float,2>{0.923291504f, 0.178712457f},
-std::array<float,2>{0.442797452f, 0.310292006f},
-std::array<float,2>{0.58953613f, 0.747542918f},
-std::array<float,2>{0.415850252f, 0.882400155f},
-std::array<float,2>{0.520744979f, 0.022555612f},
-std::array<float,2>{0.181550801f, 0.380231053f},
-std::array<float,2>{0.983356059f, 0.503071189f},
-std::array<float,2>{0.09889777f, 0.686425149f},
-std::array<float,2>{0.79794395f, 0.362878531f},
-std::array<float,2>{0.345644236f, 0.227169797f},
-std::array<float,2>{0.687953293f, 0.837558091f},
-std::array<float,2>{0.48032406f, 0.696476758f},
-std::array<float,2>{0.609703064f, 0.262371749f},
-std::array<float,2>{0.235620439f, 0.14370364f},
-std::array<float,2>{0.89523536f, 0.774922907f},
-std::array<float,2>{0.0508091748f, 0.952515602f},
-std::array<float,2>{0.86798799f, 0.123366557f},
-std::array<float,2>{0.26376155f, 0.471031815f},
-std::array<float,2>{0.673395395f, 0.579702795f},
-std::array<float,2>{0.337238669f, 0.857309103f},
-std::array<float,2>{0.734254301f, 0.212091357f},
-std::array<float,2>{0.0932503045f, 0.324557036f},
-std::array<float,2>{0.765128374f, 0.63655591f},
-std::array<float,2>{0.127545044f, 0.542720973f},
-std::array<float,2>{0.943898261f, 0.417712033f},
-std::array<float,2>{0.383221209f, 0.0572427437f},
-std::array<float,2>{0.551789999f, 0.928622723f},
-std::array<float,2>{0.400366932f, 0.521445453f},
-std::array<float,2>{0.543691516f, 0.40462932f},
-std::array<float,2>{0.149230301f, 0.00778086064f},
-std::array<float,2>{0.956392288f, 0.895894468f},
-std::array<float,2>{0.0631917417f, 0.812629342f},
-std::array<float,2>{0.772014558f, 0.240450889f},
-std::array<float,2>{0.317160726f, 0.345503628f},
-std::array<float,2>{0.746602654f, 0.661376715f},
-std::array<float,2>{0.275031149f, 0.975842714f},
-std::array<float,2>{0.669894993f, 0.0761473998f},
-std::array<float,2>{0.0331673324f, 0.467787623f},
-std::array<float,2>{0.849011362f, 0.612905264f},
-std::array<float,2>{0.233471438f, 0.724094748f},
-std::array<float,2>{0.879893064f, 0.293351442f},
-std::array<float,2>{0.487787008f, 0.163930476f},
-std::array<float,2>{0.605601549f, 0.805648804f},
-std::array<float,2>{0.373198599f, 0.653249085f},
-std::array<float,2>{0.717767358f, 0.330541581f},
-std::array<float,2>{0.10957469f, 0.200136766f},
-std::array<float,2>{0.794460058f, 0.867164731f},
-std::array<float,2>{0.168363884f, 0.909750879f},
-std::array<float,2>{0.995903194f, 0.0419585891f},
-std::array<float,2>{0.432613432f, 0.435280085f},
-std::array<float,2>{0.500733852f, 0.5582726f},
-std::array<float,2>{0.468022078f, 0.755691111f},
-std::array<float,2>{0.575831294f, 0.134109437f},
-std::array<float,2>{0.208063707f, 0.266833186f},
-std::array<float,2>{0.920248687f, 0.710599303f},
-std::array<float,2>{0.0288529973f, 0.572105289f},
-std::array<float,2>{0.826881051f, 0.487055302f},
-std::array<float,2>{0.281431586f, 0.10051395f},
-std::array<float,2>{0.630143285f, 0.962164879f},
-std::array<float,2>{0.321973979f, 0.548021555f},
-std::array<float,2>{0.738569736f, 0.42442736f},
-std::array<float,2>{0.0761779398f, 0.0332282148f},
-std::array<float,2>{0.779296279f, 0.914871812f},
-std::array<float,2>{0.146905586f, 0.874638319f},
-std::array<float,2>{0.966519833f, 0.187971577f},
-std::array<float,2>{0.397124857f, 0.338643372f},
-std::array<float,2>{0.532139719f, 0.646973491f},
-std::array<float,2>{0.493518353f, 0.957740784f},
-std::array<float,2>{0.598403156f, 0.107983805f},
-std::array<float,2>{0.224803016f, 0.493134141f},
-std::array<float,2>{0.885594249f, 0.566550672f},
-std::array<float,2>{0.0443966277f, 0.717596054f},
-std::array<float,2>{0.853773654f, 0.275947243f},
-std::array<float,2>{0.267590016f, 0.126534432f},
-std::array<float,2>{0.659519017f, 0.758364856f},
-std::array<float,2>{0.422520339f, 0.66751039f},
-std::array<float,2>{0.511801064f, 0.35468322f},
-std::array<float,2>{0.158718497f, 0.245015562f},
-std::array<float,2>{0.991729915f, 0.82309854f},
-std::array<float,2>{0.122919157f, 0.903581023f},
-std::array<float,2>{0.787571967f, 0.0121676289f},
-std::array<float,2>{0.366454333f, 0.392184168f},
-std::array<float,2>{0.710920393f, 0.529253602f},
-std::array<float,2>{0.293125421f, 0.80356276f},
-std::array<float,2>{0.636366308f, 0.167761922f},
-std::array<float,2>{0.0192078687f, 0.282839388f},
-std::array<float,2>{0.81444335f, 0.731988847f},
-std::array<float,2>{0.215511248f, 0.622736216f},
-std::array<float,2>{0.910712957f, 0.454568058f},
-std::array<float,2>{0.459073156f, 0.06820371f},
-std::array<float,2>{0.569763184f, 0.982598305f},
-std::array<float,2>{0.446401417f, 0.592337251f},
-std::array<float,2>{0.584640503f, 0.481628478f},
-std::array<float,2>{0.19120422f, 0.114183791f},
-std::array<float,2>{0.932681322f, 0.943931818f},
-std::array<float,2>{0.00705056172f, 0.77149117f},
-std::array<float,2>{0.836824775f, 0.154730231f},
-std::array<float,2>{0.307686269f, 0.251200825f},
-std::array<float,2>{0.655885577f, 0.690518916f},
-std::array<float,2>{0.359313518f, 0.935183227f},
-std::array<float,2>{0.699170887f, 0.0475883707f},
-std::array<float,2>{0.109025113f, 0.40924409f},
-std::array<float,2>{0.811827123f, 0.538995683f},
-std::array<float,2>{0.17939733f, 0.625460148f},
-std::array<float,2>{0.970499456f, 0.318019718f},
-std::array<float,2>{0.409062922f, 0.210455149f},
-std::array<float,2>{0.52731508f, 0.850832045f},
-std::array<float,2>{0.255524367f, 0.740428746f},
-std::array<float,2>{0.683543503f, 0.303454578f},
-std::array<float,2>{0.0593917668f, 0.18415086f},
-std::array<float,2>{0.865872622f, 0.78325808f},
-std::array<float,2>{0.247443095f, 0.995145619f},
-std::array<float,2>{0.904083192f, 0.0914153978f},
-std::array<float,2>{0.475699812f, 0.440168351f},
-std::array<float,2>{0.621394515f, 0.596026421f},
-std::array<float,2>{0.377404243f, 0.831155717f},
-std::array<float,2>{0.561559618f, 0.220875293f},
-std::array<float,2>{0.13534835f, 0.368090093f},
-std::array<float,2>{0.946089089f, 0.67343092f},
-std::array<float,2>{0.0848348364f, 0.511700332f},
-std::array<float,2>{0.75142622f, 0.385125875f},
-std::array<float,2>{0.330570191f, 0.0290164277f},
-std::array<float,2>{0.722011864f, 0.886162341f}}
\ No newline at end of file
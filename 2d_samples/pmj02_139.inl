@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.445789427f, 0.513041914f},
-std::array<float,2>{0.688800812f, 0.166781589f},
-std::array<float,2>{0.861548662f, 0.830195904f},
-std::array<float,2>{0.0806311071f, 0.293728322f},
-std::array<float,2>{0.16464287f, 0.88039732f},
-std::array<float,2>{0.918685675f, 0.491809756f},
-std::array<float,2>{0.562752962f, 0.671393514f},
-std::array<float,2>{0.274690628f, 0.0227102917f},
-std::array<float,2>{0.313093871f, 0.807541549f},
-std::array<float,2>{0.501395762f, 0.37118727f},
-std::array<float,2>{0.941371262f, 0.585079551f},
-std::array<float,2>{0.203811601f, 0.244985729f},
-std::array<float,2>{0.0395037085f, 0.712562859f},
-std::array<float,2>{0.781765997f, 0.0869422629f},
-std::array<float,2>{0.659281552f, 0.954600871f},
-std::array<float,2>{0.3942689f, 0.376309216f},
-std::array<float,2>{0.295410842f, 0.651262999f},
-std::array<float,2>{0.595089197f, 0.04272094f},
-std::array<float,2>{0.903336465f, 0.91548419f},
-std::array<float,2>{0.127771318f, 0.449495971f},
-std::array<float,2>{0.119423613f, 0.871185124f},
-std::array<float,2>{0.834934235f, 0.251567483f},
-std::array<float,2>{0.727022767f, 0.53367877f},
-std::array<float,2>{0.497050047f, 0.132481068f},
-std::array<float,2>{0.415231496f, 0.985682845f},
-std::array<float,2>{0.636077642f, 0.437396765f},
-std::array<float,2>{0.773670197f, 0.727560043f},
-std::array<float,2>{0.0303979293f, 0.107112765f},
-std::array<float,2>{0.226011813f, 0.593969285f},
-std::array<float,2>{0.978983879f, 0.198105961f},
-std::array<float,2>{0.538384318f, 0.774264276f},
-std::array<float,2>{0.345137864f, 0.335581213f},
-std::array<float,2>{0.367803872f, 0.577235401f},
-std::array<float,2>{0.552211285f, 0.227587029f},
-std::array<float,2>{0.985116005f, 0.790425241f},
-std::array<float,2>{0.238273844f, 0.349206477f},
-std::array<float,2>{0.00317409821f, 0.950724661f},
-std::array<float,2>{0.756329775f, 0.395308077f},
-std::array<float,2>{0.652837634f, 0.695955694f},
-std::array<float,2>{0.426260084f, 0.0759611577f},
-std::array<float,2>{0.474706769f, 0.815800607f},
-std::array<float,2>{0.735466957f, 0.304095119f},
-std::array<float,2>{0.816849709f, 0.524362564f},
-std::array<float,2>{0.0946743339f, 0.173856601f},
-std::array<float,2>{0.151641533f, 0.677708626f},
-std::array<float,2>{0.881983042f, 0.0029049376f},
-std::array<float,2>{0.619173348f, 0.899442017f},
-std::array<float,2>{0.312129706f, 0.477970064f},
-std::array<float,2>{0.38136667f, 0.749282002f},
-std::array<float,2>{0.682865679f, 0.110885769f},
-std::array<float,2>{0.801755369f, 0.981325209f},
-std::array<float,2>{0.0587415919f, 0.407732248f},
-std::array<float,2>{0.202577114f, 0.755040467f},
-std::array<float,2>{0.954721034f, 0.323875666f},
-std::array<float,2>{0.525784135f, 0.615931153f},
-std::array<float,2>{0.334683627f, 0.203766599f},
-std::array<float,2>{0.259340614f, 0.929761529f},
-std::array<float,2>{0.582591355f, 0.466457069f},
-std::array<float,2>{0.924766004f, 0.629366696f},
-std::array<float,2>{0.178247616f, 0.0615787953f},
-std::array<float,2>{0.0695713982f, 0.547271073f},
-std::array<float,2>{0.859369993f, 0.150046155f},
-std::array<float,2>{0.713815689f, 0.850116491f},
-std::array<float,2>{0.459991276f, 0.272331446f},
-std::array<float,2>{0.437033206f, 0.621599913f},
-std::array<float,2>{0.648119032f, 0.214576259f},
-std::array<float,2>{0.758250117f, 0.765609264f},
-std::array<float,2>{0.011360175f, 0.312976003f},
-std::array<float,2>{0.247956723f, 0.973755777f},
-std::array<float,2>{0.998578846f, 0.415873379f},
-std::array<float,2>{0.561345994f, 0.736343324f},
-std::array<float,2>{0.359869331f, 0.121453181f},
-std::array<float,2>{0.303429574f, 0.857830167f},
-std::array<float,2>{0.615636826f, 0.277121484f},
-std::array<float,2>{0.88515377f, 0.554896295f},
-std::array<float,2>{0.14706555f, 0.143608123f},
-std::array<float,2>{0.108192712f, 0.640286028f},
-std::array<float,2>{0.82518816f, 0.0470658056f},
-std::array<float,2>{0.743010283f, 0.923900068f},
-std::array<float,2>{0.477214932f, 0.454666913f},
-std::array<float,2>{0.34113133f, 0.688847363f},
-std::array<float,2>{0.517774284f, 0.0692085475f},
-std::array<float,2>{0.962970376f, 0.940744758f},
-std::array<float,2>{0.191210806f, 0.405486584f},
-std::array<float,2>{0.0534069613f, 0.783488333f},
-std::array<float,2>{0.810169041f, 0.351654112f},
-std::array<float,2>{0.674178243f, 0.56603545f},
-std::array<float,2>{0.390582085f, 0.219603866f},
-std::array<float,2>{0.466239333f, 0.894998431f},
-std::array<float,2>{0.70611459f, 0.470416665f},
-std::array<float,2>{0.848808765f, 0.682478547f},
-std::array<float,2>{0.0720522702f, 0.0100368895f},
-std::array<float,2>{0.180578887f, 0.518363714f},
-std::array<float,2>{0.931986392f, 0.185970172f},
-std::array<float,2>{0.590634465f, 0.823297322f},
-std::array<float,2>{0.251324892f, 0.311808735f},
-std::array<float,2>{0.270356715f, 0.539620757f},
-std::array<float,2>{0.571299016f, 0.139146879f},
-std::array<float,2>{0.910082161f, 0.860572755f},
-std::array<float,2>{0.156788558f, 0.26432994f},
-std::array<float,2>{0.0904143751f, 0.912044227f},
-std::array<float,2>{0.870922863f, 0.438538849f},
-std::array<float,2>{0.697534561f, 0.644934952f},
-std::array<float,2>{0.443022698f, 0.0358596779f},
-std::array<float,2>{0.401301146f, 0.769022584f},
-std::array<float,2>{0.665328741f, 0.343295485f},
-std::array<float,2>{0.793998063f, 0.606150806f},
-std::array<float,2>{0.035722319f, 0.189454645f},
-std::array<float,2>{0.218479007f, 0.725030899f},
-std::array<float,2>{0.951845288f, 0.0963333398f},
-std::array<float,2>{0.515026748f, 0.995524049f},
-std::array<float,2>{0.326469094f, 0.428253174f},
-std::array<float,2>{0.491692424f, 0.657885194f},
-std::array<float,2>{0.722505689f, 0.0262812562f},
-std::array<float,2>{0.836697996f, 0.888355851f},
-std::array<float,2>{0.112814307f, 0.49710241f},
-std::array<float,2>{0.133633271f, 0.837208092f},
-std::array<float,2>{0.89247942f, 0.288112581f},
-std::array<float,2>{0.609300196f, 0.504060328f},
-std::array<float,2>{0.283712715f, 0.15701139f},
-std::array<float,2>{0.352156132f, 0.967219353f},
-std::array<float,2>{0.543293357f, 0.389368415f},
-std::array<float,2>{0.972657025f, 0.708275139f},
-std::array<float,2>{0.228776321f, 0.0805752873f},
-std::array<float,2>{0.0228049047f, 0.589337766f},
-std::array<float,2>{0.772502959f, 0.234686479f},
-std::array<float,2>{0.627155244f, 0.804134548f},
-std::array<float,2>{0.406701535f, 0.360180289f},
-std::array<float,2>{0.394996703f, 0.559210002f},
-std::array<float,2>{0.661270142f, 0.148088276f},
-std::array<float,2>{0.787945509f, 0.852427006f},
-std::array<float,2>{0.0460532978f, 0.277641028f},
-std::array<float,2>{0.207931817f, 0.928372324f},
-std::array<float,2>{0.944875956f, 0.457889229f},
-std::array<float,2>{0.505499065f, 0.633586347f},
-std::array<float,2>{0.317664206f, 0.0512382165f},
-std::array<float,2>{0.28034085f, 0.759754598f},
-std::array<float,2>{0.568189979f, 0.319061697f},
-std::array<float,2>{0.915355206f, 0.618704855f},
-std::array<float,2>{0.170942172f, 0.217415527f},
-std::array<float,2>{0.0846118256f, 0.741436899f},
-std::array<float,2>{0.866912425f, 0.118238851f},
-std::array<float,2>{0.693491399f, 0.972627461f},
-std::array<float,2>{0.45038271f, 0.418690383f},
-std::array<float,2>{0.348383814f, 0.684703648f},
-std::array<float,2>{0.534296155f, 0.0130858561f},
-std::array<float,2>{0.983655453f, 0.892250657f},
-std::array<float,2>{0.222185522f, 0.474790215f},
-std::array<float,2>{0.0236905161f, 0.825084388f},
-std::array<float,2>{0.778526545f, 0.306225479f},
-std::array<float,2>{0.638721526f, 0.521049559f},
-std::array<float,2>{0.420834541f, 0.18179515f},
-std::array<float,2>{0.495394975f, 0.943787992f},
-std::array<float,2>{0.734193802f, 0.399469852f},
-std::array<float,2>{0.828459203f, 0.694532812f},
-std::array<float,2>{0.124251872f, 0.0639745519f},
-std::array<float,2>{0.131509662f, 0.567220151f},
-std::array<float,2>{0.898889661f, 0.223843947f},
-std::array<float,2>{0.60051316f, 0.78716594f},
-std::array<float,2>{0.291885018f, 0.355906129f},
-std::array<float,2>{0.305717051f, 0.603646636f},
-std::array<float,2>{0.62393564f, 0.194021583f},
-std::array<float,2>{0.875163794f, 0.770444632f},
-std::array<float,2>{0.154208213f, 0.33956486f},
-std::array<float,2>{0.0996591896f, 0.997912407f},
-std::array<float,2>{0.812538624f, 0.422724277f},
-std::array<float,2>{0.741365671f, 0.719937146f},
-std::array<float,2>{0.472189963f, 0.098887071f},
-std::array<float,2>{0.424820572f, 0.866288543f},
-std::array<float,2>{0.649891376f, 0.260954827f},
-std::array<float,2>{0.752130866f, 0.544911206f},
-std::array<float,2>{0.00483997911f, 0.135675803f},
-std::array<float,2>{0.239257663f, 0.644071221f},
-std::array<float,2>{0.988716602f, 0.0349286161f},
-std::array<float,2>{0.547424018f, 0.909213603f},
-std::array<float,2>{0.374526739f, 0.444323987f},
-std::array<float,2>{0.45557642f, 0.704039216f},
-std::array<float,2>{0.718464077f, 0.0848178789f},
-std::array<float,2>{0.852904081f, 0.961230755f},
-std::array<float,2>{0.0658707172f, 0.385376483f},
-std::array<float,2>{0.17405802f, 0.800013542f},
-std::array<float,2>{0.926160336f, 0.365068406f},
-std::array<float,2>{0.5792467f, 0.593664348f},
-std::array<float,2>{0.265010864f, 0.240821168f},
-std::array<float,2>{0.329775512f, 0.885024369f},
-std::array<float,2>{0.529389203f, 0.492526352f},
-std::array<float,2>{0.960862577f, 0.661275029f},
-std::array<float,2>{0.196789682f, 0.0309184883f},
-std::array<float,2>{0.0563797131f, 0.501107395f},
-std::array<float,2>{0.799955428f, 0.162608907f},
-std::array<float,2>{0.686429679f, 0.84359777f},
-std::array<float,2>{0.375168443f, 0.282610625f},
-std::array<float,2>{0.480845422f, 0.578750193f},
-std::array<float,2>{0.747397542f, 0.247439951f},
-std::array<float,2>{0.823342919f, 0.809513569f},
-std::array<float,2>{0.10259679f, 0.370258301f},
-std::array<float,2>{0.142010003f, 0.958735108f},
-std::array<float,2>{0.88815558f, 0.382162929f},
-std::array<float,2>{0.611875236f, 0.715616226f},
-std::array<float,2>{0.297325611f, 0.0925117359f},
-std::array<float,2>{0.364921749f, 0.832187295f},
-std::array<float,2>{0.558294892f, 0.291640192f},
-std::array<float,2>{0.992554665f, 0.510641396f},
-std::array<float,2>{0.243280739f, 0.170813143f},
-std::array<float,2>{0.0152656455f, 0.665761292f},
-std::array<float,2>{0.763694286f, 0.0159856677f},
-std::array<float,2>{0.642377734f, 0.878719032f},
-std::array<float,2>{0.43167904f, 0.48608917f},
-std::array<float,2>{0.256767064f, 0.731566966f},
-std::array<float,2>{0.586472094f, 0.10190057f},
-std::array<float,2>{0.934601963f, 0.989377677f},
-std::array<float,2>{0.18535693f, 0.432509691f},
-std::array<float,2>{0.0762029439f, 0.778388083f},
-std::array<float,2>{0.847259283f, 0.330262601f},
-std::array<float,2>{0.707274079f, 0.601003289f},
-std::array<float,2>{0.461111873f, 0.20270969f},
-std::array<float,2>{0.382858932f, 0.918256998f},
-std::array<float,2>{0.679526269f, 0.447562188f},
-std::array<float,2>{0.807176054f, 0.653262317f},
-std::array<float,2>{0.0505184643f, 0.0458586924f},
-std::array<float,2>{0.192499682f, 0.53541249f},
-std::array<float,2>{0.968437195f, 0.126526564f},
-std::array<float,2>{0.520374358f, 0.867189944f},
-std::array<float,2>{0.338283062f, 0.256260604f},
-std::array<float,2>{0.324020833f, 0.530930459f},
-std::array<float,2>{0.511512041f, 0.177353993f},
-std::array<float,2>{0.948490858f, 0.817939639f},
-std::array<float,2>{0.21378696f, 0.300370902f},
-std::array<float,2>{0.0349457003f, 0.904392302f},
-std::array<float,2>{0.791166425f, 0.484232694f},
-std::array<float,2>{0.67021358f, 0.673518896f},
-std::array<float,2>{0.404881656f, 0.00398346549f},
-std::array<float,2>{0.439824015f, 0.794794559f},
-std::array<float,2>{0.700288713f, 0.345758408f},
-std::array<float,2>{0.873048067f, 0.573596537f},
-std::array<float,2>{0.0874067098f, 0.23356171f},
-std::array<float,2>{0.160894111f, 0.701347053f},
-std::array<float,2>{0.910542846f, 0.0741990358f},
-std::array<float,2>{0.575851977f, 0.948521972f},
-std::array<float,2>{0.268973708f, 0.394505441f},
-std::array<float,2>{0.410455823f, 0.626500666f},
-std::array<float,2>{0.630576015f, 0.0578611568f},
-std::array<float,2>{0.766522646f, 0.934582472f},
-std::array<float,2>{0.0192652196f, 0.462113649f},
-std::array<float,2>{0.231960714f, 0.845797241f},
-std::array<float,2>{0.971363425f, 0.26789245f},
-std::array<float,2>{0.539803505f, 0.551821947f},
-std::array<float,2>{0.358221412f, 0.154407233f},
-std::array<float,2>{0.2879062f, 0.98038578f},
-std::array<float,2>{0.604569852f, 0.411282331f},
-std::array<float,2>{0.896417439f, 0.746057868f},
-std::array<float,2>{0.138141468f, 0.115863271f},
-std::array<float,2>{0.116220988f, 0.613208234f},
-std::array<float,2>{0.84303695f, 0.207903162f},
-std::array<float,2>{0.723460078f, 0.751384497f},
-std::array<float,2>{0.484413117f, 0.327824533f},
-std::array<float,2>{0.499652445f, 0.532889485f},
-std::array<float,2>{0.728540421f, 0.129025251f},
-std::array<float,2>{0.8332268f, 0.873489797f},
-std::array<float,2>{0.118054755f, 0.25281778f},
-std::array<float,2>{0.12568967f, 0.917712986f},
-std::array<float,2>{0.90459913f, 0.451327056f},
-std::array<float,2>{0.596435726f, 0.64929682f},
-std::array<float,2>{0.293401301f, 0.0409228243f},
-std::array<float,2>{0.346463859f, 0.776870966f},
-std::array<float,2>{0.536391377f, 0.33272472f},
-std::array<float,2>{0.976846278f, 0.597548544f},
-std::array<float,2>{0.222860947f, 0.197229698f},
-std::array<float,2>{0.0287020896f, 0.729667664f},
-std::array<float,2>{0.775700092f, 0.109001853f},
-std::array<float,2>{0.63310945f, 0.987297833f},
-std::array<float,2>{0.416303605f, 0.434473991f},
-std::array<float,2>{0.276271909f, 0.669543743f},
-std::array<float,2>{0.565821767f, 0.0198950116f},
-std::array<float,2>{0.92003572f, 0.881839275f},
-std::array<float,2>{0.167895049f, 0.490105748f},
-std::array<float,2>{0.0798341483f, 0.829381287f},
-std::array<float,2>{0.859670162f, 0.296053976f},
-std::array<float,2>{0.690181792f, 0.514017045f},
-std::array<float,2>{0.448760539f, 0.164129794f},
-std::array<float,2>{0.392090231f, 0.956533849f},
-std::array<float,2>{0.657113314f, 0.378712207f},
-std::array<float,2>{0.783587098f, 0.713569343f},
-std::array<float,2>{0.0422553122f, 0.0895681009f},
-std::array<float,2>{0.206260026f, 0.583580911f},
-std::array<float,2>{0.937710822f, 0.24340874f},
-std::array<float,2>{0.501977086f, 0.80605185f},
-std::array<float,2>{0.315622658f, 0.374679863f},
-std::array<float,2>{0.332978606f, 0.614015639f},
-std::array<float,2>{0.523527145f, 0.205161408f},
-std::array<float,2>{0.955112278f, 0.756856799f},
-std::array<float,2>{0.19933705f, 0.32140398f},
-std::array<float,2>{0.0614167266f, 0.983274162f},
-std::array<float,2>{0.803773999f, 0.408213675f},
-std::array<float,2>{0.681373298f, 0.747507453f},
-std::array<float,2>{0.379079252f, 0.112788193f},
-std::array<float,2>{0.458807468f, 0.849580288f},
-std::array<float,2>{0.711215973f, 0.271382004f},
-std::array<float,2>{0.856284201f, 0.549875081f},
-std::array<float,2>{0.0675604492f, 0.151052013f},
-std::array<float,2>{0.175908238f, 0.630992651f},
-std::array<float,2>{0.921888471f, 0.0595565811f},
-std::array<float,2>{0.585017562f, 0.933234632f},
-std::array<float,2>{0.260866195f, 0.468248993f},
-std::array<float,2>{0.428970337f, 0.69737494f},
-std::array<float,2>{0.654820442f, 0.0780102238f},
-std::array<float,2>{0.754292309f, 0.952950001f},
-std::array<float,2>{0.00103723654f, 0.39673844f},
-std::array<float,2>{0.235320002f, 0.791661024f},
-std::array<float,2>{0.988274753f, 0.349902451f},
-std::array<float,2>{0.552751184f, 0.576053858f},
-std::array<float,2>{0.370144784f, 0.229979128f},
-std::array<float,2>{0.309168547f, 0.901374757f},
-std::array<float,2>{0.61838299f, 0.478789091f},
-std::array<float,2>{0.87983948f, 0.678739429f},
-std::array<float,2>{0.14895688f, 0.000107022373f},
-std::array<float,2>{0.0969544724f, 0.526321471f},
-std::array<float,2>{0.818458617f, 0.172839448f},
-std::array<float,2>{0.737963498f, 0.813688099f},
-std::array<float,2>{0.472992033f, 0.30145964f},
-std::array<float,2>{0.387550473f, 0.562769234f},
-std::array<float,2>{0.672924459f, 0.221565455f},
-std::array<float,2>{0.811275005f, 0.78182447f},
-std::array<float,2>{0.0510734208f, 0.354859889f},
-std::array<float,2>{0.187721923f, 0.937510192f},
-std::array<float,2>{0.961811364f, 0.402978003f},
-std::array<float,2>{0.516954541f, 0.691229105f},
-std::array<float,2>{0.34272328f, 0.0675835237f},
-std::array<float,2>{0.252770633f, 0.821699739f},
-std::array<float,2>{0.592730224f, 0.309261739f},
-std::array<float,2>{0.930659056f, 0.516221344f},
-std::array<float,2>{0.181920141f, 0.184204981f},
-std::array<float,2>{0.0736022294f, 0.679847121f},
-std::array<float,2>{0.851520181f, 0.0092239771f},
-std::array<float,2>{0.704066992f, 0.897324324f},
-std::array<float,2>{0.467242926f, 0.47167173f},
-std::array<float,2>{0.363245457f, 0.735546589f},
-std::array<float,2>{0.559101641f, 0.123733051f},
-std::array<float,2>{0.997772992f, 0.974939942f},
-std::array<float,2>{0.24830313f, 0.416870296f},
-std::array<float,2>{0.00842724461f, 0.762907863f},
-std::array<float,2>{0.761093795f, 0.31448248f},
-std::array<float,2>{0.644580543f, 0.624114752f},
-std::array<float,2>{0.434074968f, 0.212118f},
-std::array<float,2>{0.480283856f, 0.923136234f},
-std::array<float,2>{0.745957375f, 0.456849515f},
-std::array<float,2>{0.827339649f, 0.638065636f},
-std::array<float,2>{0.107202053f, 0.0493831299f},
-std::array<float,2>{0.146009192f, 0.557288527f},
-std::array<float,2>{0.88403964f, 0.142177254f},
-std::array<float,2>{0.614230275f, 0.856803417f},
-std::array<float,2>{0.301457554f, 0.273986936f},
-std::array<float,2>{0.282991797f, 0.505937755f},
-std::array<float,2>{0.6057688f, 0.160069987f},
-std::array<float,2>{0.893250346f, 0.839181483f},
-std::array<float,2>{0.136038557f, 0.285594821f},
-std::array<float,2>{0.110811405f, 0.889264822f},
-std::array<float,2>{0.839124799f, 0.499966025f},
-std::array<float,2>{0.719500661f, 0.658577263f},
-std::array<float,2>{0.489006549f, 0.0235058498f},
-std::array<float,2>{0.408688515f, 0.801598668f},
-std::array<float,2>{0.625903487f, 0.36189574f},
-std::array<float,2>{0.769799113f, 0.587737381f},
-std::array<float,2>{0.0196304079f, 0.238161966f},
-std::array<float,2>{0.227495953f, 0.709535718f},
-std::array<float,2>{0.975117803f, 0.078147307f},
-std::array<float,2>{0.545388579f, 0.965283215f},
-std::array<float,2>{0.354151249f, 0.388037235f},
-std::array<float,2>{0.443747401f, 0.647563338f},
-std::array<float,2>{0.695691288f, 0.0388375074f},
-std::array<float,2>{0.867284715f, 0.912459612f},
-std::array<float,2>{0.0927055925f, 0.439834923f},
-std::array<float,2>{0.159759521f, 0.863189578f},
-std::array<float,2>{0.906731486f, 0.262008488f},
-std::array<float,2>{0.573929071f, 0.542902946f},
-std::array<float,2>{0.272860259f, 0.137834772f},
-std::array<float,2>{0.32424286f, 0.993383884f},
-std::array<float,2>{0.511880279f, 0.426404029f},
-std::array<float,2>{0.949446917f, 0.723435819f},
-std::array<float,2>{0.216446579f, 0.095059745f},
-std::array<float,2>{0.0372406803f, 0.60879606f},
-std::array<float,2>{0.795985281f, 0.189043328f},
-std::array<float,2>{0.666816056f, 0.766012251f},
-std::array<float,2>{0.399041981f, 0.340232909f},
-std::array<float,2>{0.419258773f, 0.521817505f},
-std::array<float,2>{0.637930095f, 0.180869684f},
-std::array<float,2>{0.780309141f, 0.826794565f},
-std::array<float,2>{0.0257350281f, 0.308484137f},
-std::array<float,2>{0.218823045f, 0.892769158f},
-std::array<float,2>{0.982107341f, 0.47302559f},
-std::array<float,2>{0.531549096f, 0.687133372f},
-std::array<float,2>{0.350316435f, 0.01479086f},
-std::array<float,2>{0.290250778f, 0.785382032f},
-std::array<float,2>{0.599423826f, 0.359071225f},
-std::array<float,2>{0.901541412f, 0.568910718f},
-std::array<float,2>{0.129857108f, 0.224670559f},
-std::array<float,2>{0.121864006f, 0.691777468f},
-std::array<float,2>{0.830306172f, 0.0646577552f},
-std::array<float,2>{0.732290089f, 0.942567408f},
-std::array<float,2>{0.49361971f, 0.400667638f},
-std::array<float,2>{0.319715172f, 0.635798693f},
-std::array<float,2>{0.506334424f, 0.0540986955f},
-std::array<float,2>{0.943000793f, 0.927163899f},
-std::array<float,2>{0.20997481f, 0.460284561f},
-std::array<float,2>{0.043254368f, 0.855407894f},
-std::array<float,2>{0.785872638f, 0.280804247f},
-std::array<float,2>{0.663240969f, 0.561130226f},
-std::array<float,2>{0.398272961f, 0.145791605f},
-std::array<float,2>{0.452442974f, 0.969922066f},
-std::array<float,2>{0.692519665f, 0.421489418f},
-std::array<float,2>{0.864752293f, 0.738798797f},
-std::array<float,2>{0.0825019255f, 0.119748428f},
-std::array<float,2>{0.168366283f, 0.619470894f},
-std::array<float,2>{0.917705655f, 0.216025636f},
-std::array<float,2>{0.569871128f, 0.761343002f},
-std::array<float,2>{0.27846697f, 0.317646712f},
-std::array<float,2>{0.263121754f, 0.590124011f},
-std::array<float,2>{0.580454409f, 0.23894906f},
-std::array<float,2>{0.929128528f, 0.797720909f},
-std::array<float,2>{0.172477797f, 0.366677433f},
-std::array<float,2>{0.0638292879f, 0.964660645f},
-std::array<float,2>{0.853645504f, 0.383371294f},
-std::array<float,2>{0.714975476f, 0.706866086f},
-std::array<float,2>{0.45465368f, 0.0830770507f},
-std::array<float,2>{0.377635866f, 0.840045035f},
-std::array<float,2>{0.684349298f, 0.284015536f},
-std::array<float,2>{0.798352242f, 0.502761483f},
-std::array<float,2>{0.0574751496f, 0.161970526f},
-std::array<float,2>{0.198696315f, 0.662618399f},
-std::array<float,2>{0.958792984f, 0.0286881309f},
-std::array<float,2>{0.529067695f, 0.883972883f},
-std::array<float,2>{0.330175459f, 0.494168967f},
-std::array<float,2>{0.469364762f, 0.721083224f},
-std::array<float,2>{0.73846215f, 0.0998939499f},
-std::array<float,2>{0.814499021f, 0.998809397f},
-std::array<float,2>{0.0986989364f, 0.425614119f},
-std::array<float,2>{0.155258492f, 0.772921801f},
-std::array<float,2>{0.877785802f, 0.336986959f},
-std::array<float,2>{0.623039603f, 0.602471173f},
-std::array<float,2>{0.308376461f, 0.192643449f},
-std::array<float,2>{0.37202394f, 0.90627557f},
-std::array<float,2>{0.550142586f, 0.442060769f},
-std::array<float,2>{0.990679502f, 0.64095825f},
-std::array<float,2>{0.241988748f, 0.0326512642f},
-std::array<float,2>{0.00744358357f, 0.54659909f},
-std::array<float,2>{0.751567006f, 0.133781612f},
-std::array<float,2>{0.651728809f, 0.864203393f},
-std::array<float,2>{0.422777861f, 0.259415776f},
-std::array<float,2>{0.463780761f, 0.599590123f},
-std::array<float,2>{0.709783196f, 0.199404642f},
-std::array<float,2>{0.845245361f, 0.780637801f},
-std::array<float,2>{0.0756557584f, 0.329130471f},
-std::array<float,2>{0.187065095f, 0.991309881f},
-std::array<float,2>{0.936088502f, 0.430930048f},
-std::array<float,2>{0.589082718f, 0.733300328f},
-std::array<float,2>{0.25577879f, 0.104116835f},
-std::array<float,2>{0.337274462f, 0.870804012f},
-std::array<float,2>{0.521598041f, 0.255855709f},
-std::array<float,2>{0.965586305f, 0.537474871f},
-std::array<float,2>{0.193783671f, 0.128464699f},
-std::array<float,2>{0.0487477481f, 0.655013204f},
-std::array<float,2>{0.805153608f, 0.0448361002f},
-std::array<float,2>{0.676119685f, 0.920323908f},
-std::array<float,2>{0.384964019f, 0.445517421f},
-std::array<float,2>{0.299529076f, 0.718510747f},
-std::array<float,2>{0.610189438f, 0.0910848901f},
-std::array<float,2>{0.888708711f, 0.960904777f},
-std::array<float,2>{0.143408239f, 0.380094349f},
-std::array<float,2>{0.104816161f, 0.811686754f},
-std::array<float,2>{0.822032154f, 0.368224055f},
-std::array<float,2>{0.748637676f, 0.581997395f},
-std::array<float,2>{0.483492166f, 0.248402849f},
-std::array<float,2>{0.429753155f, 0.87513411f},
-std::array<float,2>{0.644303977f, 0.487291127f},
-std::array<float,2>{0.763656139f, 0.667673051f},
-std::array<float,2>{0.0134881511f, 0.0185890887f},
-std::array<float,2>{0.245184541f, 0.50932914f},
-std::array<float,2>{0.995021284f, 0.169239208f},
-std::array<float,2>{0.556332231f, 0.835728705f},
-std::array<float,2>{0.366495967f, 0.289289474f},
-std::array<float,2>{0.356491894f, 0.554168344f},
-std::array<float,2>{0.542612493f, 0.153476596f},
-std::array<float,2>{0.970089316f, 0.844812274f},
-std::array<float,2>{0.232594669f, 0.266631097f},
-std::array<float,2>{0.0159608517f, 0.937135816f},
-std::array<float,2>{0.76887393f, 0.464680225f},
-std::array<float,2>{0.630957842f, 0.628248334f},
-std::array<float,2>{0.41323474f, 0.0562096797f},
-std::array<float,2>{0.487269998f, 0.753708839f},
-std::array<float,2>{0.726090789f, 0.324934125f},
-std::array<float,2>{0.840887368f, 0.609563708f},
-std::array<float,2>{0.113385245f, 0.209096372f},
-std::array<float,2>{0.139716178f, 0.743430734f},
-std::array<float,2>{0.897993207f, 0.113559499f},
-std::array<float,2>{0.602276504f, 0.977149785f},
-std::array<float,2>{0.28620699f, 0.414043278f},
-std::array<float,2>{0.403655857f, 0.675652444f},
-std::array<float,2>{0.668140054f, 0.00664218375f},
-std::array<float,2>{0.789740086f, 0.903198957f},
-std::array<float,2>{0.0326579101f, 0.481414318f},
-std::array<float,2>{0.211869344f, 0.81989187f},
-std::array<float,2>{0.946951866f, 0.298299313f},
-std::array<float,2>{0.508346677f, 0.528399467f},
-std::array<float,2>{0.321979165f, 0.177862838f},
-std::array<float,2>{0.267270207f, 0.945974171f},
-std::array<float,2>{0.577774704f, 0.391024709f},
-std::array<float,2>{0.912129819f, 0.700850427f},
-std::array<float,2>{0.162518293f, 0.0712349266f},
-std::array<float,2>{0.0880249664f, 0.571746886f},
-std::array<float,2>{0.871605933f, 0.231963202f},
-std::array<float,2>{0.701530159f, 0.795024514f},
-std::array<float,2>{0.438681126f, 0.344698995f},
-std::array<float,2>{0.459478676f, 0.549475133f},
-std::array<float,2>{0.713992596f, 0.152016237f},
-std::array<float,2>{0.85779357f, 0.847803295f},
-std::array<float,2>{0.0691016316f, 0.27023834f},
-std::array<float,2>{0.179133326f, 0.932314098f},
-std::array<float,2>{0.925336659f, 0.4675951f},
-std::array<float,2>{0.583277404f, 0.632161379f},
-std::array<float,2>{0.258478791f, 0.0599392653f},
-std::array<float,2>{0.335605472f, 0.756290495f},
-std::array<float,2>{0.527176917f, 0.320523471f},
-std::array<float,2>{0.953313768f, 0.61428827f},
-std::array<float,2>{0.201297089f, 0.206113771f},
-std::array<float,2>{0.0597277805f, 0.746777117f},
-std::array<float,2>{0.802054763f, 0.111469083f},
-std::array<float,2>{0.682466269f, 0.983453214f},
-std::array<float,2>{0.382349372f, 0.409696043f},
-std::array<float,2>{0.311100662f, 0.678031504f},
-std::array<float,2>{0.620388806f, 0.00154901273f},
-std::array<float,2>{0.881735861f, 0.901226521f},
-std::array<float,2>{0.151115939f, 0.48040539f},
-std::array<float,2>{0.0950948074f, 0.813246369f},
-std::array<float,2>{0.817648947f, 0.301868021f},
-std::array<float,2>{0.734442115f, 0.526766062f},
-std::array<float,2>{0.476281583f, 0.173420385f},
-std::array<float,2>{0.427411318f, 0.951976955f},
-std::array<float,2>{0.653365016f, 0.39812547f},
-std::array<float,2>{0.757202148f, 0.698409021f},
-std::array<float,2>{0.00268365373f, 0.0762834847f},
-std::array<float,2>{0.237167254f, 0.574450791f},
-std::array<float,2>{0.986215353f, 0.22939603f},
-std::array<float,2>{0.551216006f, 0.792858839f},
-std::array<float,2>{0.368324041f, 0.351541907f},
-std::array<float,2>{0.343816519f, 0.595957577f},
-std::array<float,2>{0.537195385f, 0.196204111f},
-std::array<float,2>{0.979838371f, 0.775955081f},
-std::array<float,2>{0.225159362f, 0.333910495f},
-std::array<float,2>{0.0298360437f, 0.987608671f},
-std::array<float,2>{0.77527082f, 0.435261518f},
-std::array<float,2>{0.635248244f, 0.729335308f},
-std::array<float,2>{0.414242476f, 0.108156964f},
-std::array<float,2>{0.498013645f, 0.87468344f},
-std::array<float,2>{0.727724195f, 0.253895819f},
-std::array<float,2>{0.835533917f, 0.531438351f},
-std::array<float,2>{0.120239429f, 0.130542889f},
-std::array<float,2>{0.128516912f, 0.649834394f},
-std::array<float,2>{0.902363241f, 0.0391515307f},
-std::array<float,2>{0.594136715f, 0.916335821f},
-std::array<float,2>{0.296337783f, 0.452157229f},
-std::array<float,2>{0.393136412f, 0.714293838f},
-std::array<float,2>{0.658342957f, 0.0882273912f},
-std::array<float,2>{0.782999396f, 0.955201864f},
-std::array<float,2>{0.0405279025f, 0.377668738f},
-std::array<float,2>{0.205020994f, 0.805609167f},
-std::array<float,2>{0.940167069f, 0.37338993f},
-std::array<float,2>{0.500029802f, 0.582822144f},
-std::array<float,2>{0.314406693f, 0.24253948f},
-std::array<float,2>{0.273513466f, 0.881564975f},
-std::array<float,2>{0.563947499f, 0.488775343f},
-std::array<float,2>{0.919493079f, 0.668749928f},
-std::array<float,2>{0.165777177f, 0.0212442949f},
-std::array<float,2>{0.0811831057f, 0.515588522f},
-std::array<float,2>{0.862365961f, 0.165119365f},
-std::array<float,2>{0.687812448f, 0.829094648f},
-std::array<float,2>{0.447199255f, 0.294924945f},
-std::array<float,2>{0.407323867f, 0.586891532f},
-std::array<float,2>{0.628339589f, 0.237251863f},
-std::array<float,2>{0.772108197f, 0.801832139f},
-std::array<float,2>{0.0222347565f, 0.362982333f},
-std::array<float,2>{0.230269685f, 0.966238737f},
-std::array<float,2>{0.973878086f, 0.38699156f},
-std::array<float,2>{0.544257104f, 0.710055172f},
-std::array<float,2>{0.353443682f, 0.079770036f},
-std::array<float,2>{0.285112977f, 0.838615537f},
-std::array<float,2>{0.608309925f, 0.286181033f},
-std::array<float,2>{0.891510844f, 0.507169306f},
-std::array<float,2>{0.13399078f, 0.159073785f},
-std::array<float,2>{0.111621797f, 0.659250677f},
-std::array<float,2>{0.837405741f, 0.0253581051f},
-std::array<float,2>{0.720836043f, 0.89019084f},
-std::array<float,2>{0.490481973f, 0.498850048f},
-std::array<float,2>{0.327588886f, 0.723868608f},
-std::array<float,2>{0.514389217f, 0.0945723355f},
-std::array<float,2>{0.9524616f, 0.992693841f},
-std::array<float,2>{0.217724711f, 0.427488953f},
-std::array<float,2>{0.0367843062f, 0.766616642f},
-std::array<float,2>{0.793243229f, 0.34170571f},
-std::array<float,2>{0.664201081f, 0.607923448f},
-std::array<float,2>{0.401697606f, 0.188239053f},
-std::array<float,2>{0.441735774f, 0.913794518f},
-std::array<float,2>{0.699042201f, 0.44043684f},
-std::array<float,2>{0.86962688f, 0.647216439f},
-std::array<float,2>{0.0911346003f, 0.0374041274f},
-std::array<float,2>{0.158059254f, 0.541911721f},
-std::array<float,2>{0.908484519f, 0.137666002f},
-std::array<float,2>{0.570818007f, 0.861571908f},
-std::array<float,2>{0.270784259f, 0.263483733f},
-std::array<float,2>{0.250318021f, 0.516991735f},
-std::array<float,2>{0.591197789f, 0.184860453f},
-std::array<float,2>{0.933455765f, 0.821282029f},
-std::array<float,2>{0.181567878f, 0.310010791f},
-std::array<float,2>{0.0711125806f, 0.897711635f},
-std::array<float,2>{0.847868025f, 0.471867979f},
-std::array<float,2>{0.705282748f, 0.68083936f},
-std::array<float,2>{0.465073407f, 0.00843920652f},
-std::array<float,2>{0.388954014f, 0.782573879f},
-std::array<float,2>{0.675288916f, 0.35402739f},
-std::array<float,2>{0.808837771f, 0.563508213f},
-std::array<float,2>{0.0545843504f, 0.221836224f},
-std::array<float,2>{0.189814895f, 0.689985096f},
-std::array<float,2>{0.96417284f, 0.0673821568f},
-std::array<float,2>{0.518794894f, 0.938884318f},
-std::array<float,2>{0.340783566f, 0.40350017f},
-std::array<float,2>{0.477568984f, 0.637382925f},
-std::array<float,2>{0.743929148f, 0.0498533286f},
-std::array<float,2>{0.825950921f, 0.922785997f},
-std::array<float,2>{0.109022528f, 0.455936849f},
-std::array<float,2>{0.148420751f, 0.855823636f},
-std::array<float,2>{0.886355817f, 0.275252044f},
-std::array<float,2>{0.6165241f, 0.558013856f},
-std::array<float,2>{0.304305196f, 0.141020849f},
-std::array<float,2>{0.36043036f, 0.975762725f},
-std::array<float,2>{0.561922193f, 0.417801648f},
-std::array<float,2>{0.999404073f, 0.734666765f},
-std::array<float,2>{0.247009799f, 0.124590211f},
-std::array<float,2>{0.0102522615f, 0.623800397f},
-std::array<float,2>{0.759253263f, 0.21175772f},
-std::array<float,2>{0.646951973f, 0.762201846f},
-std::array<float,2>{0.436328292f, 0.315701485f},
-std::array<float,2>{0.376171917f, 0.503503442f},
-std::array<float,2>{0.687399209f, 0.160240501f},
-std::array<float,2>{0.799224734f, 0.84099251f},
-std::array<float,2>{0.0547503754f, 0.284877211f},
-std::array<float,2>{0.196167812f, 0.88364315f},
-std::array<float,2>{0.959048629f, 0.495184124f},
-std::array<float,2>{0.530824184f, 0.663906932f},
-std::array<float,2>{0.328989565f, 0.0277112704f},
-std::array<float,2>{0.264329314f, 0.798808515f},
-std::array<float,2>{0.578543305f, 0.366167784f},
-std::array<float,2>{0.927215099f, 0.591736972f},
-std::array<float,2>{0.175485104f, 0.23988232f},
-std::array<float,2>{0.0648009554f, 0.705390632f},
-std::array<float,2>{0.852496922f, 0.0825219974f},
-std::array<float,2>{0.717362583f, 0.963230968f},
-std::array<float,2>{0.456338853f, 0.38474679f},
-std::array<float,2>{0.373132139f, 0.641603291f},
-std::array<float,2>{0.548585951f, 0.0317794792f},
-std::array<float,2>{0.989876449f, 0.907622993f},
-std::array<float,2>{0.239623293f, 0.44301632f},
-std::array<float,2>{0.00496134441f, 0.864678144f},
-std::array<float,2>{0.75314343f, 0.258613676f},
-std::array<float,2>{0.649126768f, 0.545823455f},
-std::array<float,2>{0.423916727f, 0.134612143f},
-std::array<float,2>{0.471113265f, 0.999653697f},
-std::array<float,2>{0.740950823f, 0.424646169f},
-std::array<float,2>{0.814214706f, 0.722555399f},
-std::array<float,2>{0.101314716f, 0.101548962f},
-std::array<float,2>{0.15330714f, 0.60328424f},
-std::array<float,2>{0.876327515f, 0.192239478f},
-std::array<float,2>{0.62449199f, 0.771805227f},
-std::array<float,2>{0.305249929f, 0.336262137f},
-std::array<float,2>{0.292399108f, 0.569410563f},
-std::array<float,2>{0.60093385f, 0.226554036f},
-std::array<float,2>{0.899513125f, 0.786422372f},
-std::array<float,2>{0.13256295f, 0.358070165f},
-std::array<float,2>{0.123179287f, 0.941799939f},
-std::array<float,2>{0.82945925f, 0.401446521f},
-std::array<float,2>{0.732827485f, 0.692546368f},
-std::array<float,2>{0.494911402f, 0.0661198571f},
-std::array<float,2>{0.4214499f, 0.827318311f},
-std::array<float,2>{0.639852047f, 0.306903422f},
-std::array<float,2>{0.778077722f, 0.523091793f},
-std::array<float,2>{0.0253592841f, 0.180332124f},
-std::array<float,2>{0.220868707f, 0.686295092f},
-std::array<float,2>{0.982694983f, 0.0144202281f},
-std::array<float,2>{0.533277571f, 0.894470155f},
-std::array<float,2>{0.349011749f, 0.474465638f},
-std::array<float,2>{0.449599147f, 0.739493072f},
-std::array<float,2>{0.69483614f, 0.120706767f},
-std::array<float,2>{0.865736604f, 0.969519377f},
-std::array<float,2>{0.0850996003f, 0.42029351f},
-std::array<float,2>{0.170885071f, 0.760232031f},
-std::array<float,2>{0.914365232f, 0.317356825f},
-std::array<float,2>{0.567270696f, 0.620332837f},
-std::array<float,2>{0.279839277f, 0.21486029f},
-std::array<float,2>{0.317306995f, 0.926452696f},
-std::array<float,2>{0.504828155f, 0.459667206f},
-std::array<float,2>{0.943415165f, 0.635550439f},
-std::array<float,2>{0.208328843f, 0.0536558367f},
-std::array<float,2>{0.0455594249f, 0.562234342f},
-std::array<float,2>{0.788785517f, 0.145054325f},
-std::array<float,2>{0.660871923f, 0.854070246f},
-std::array<float,2>{0.395596653f, 0.279690742f},
-std::array<float,2>{0.485777259f, 0.611299396f},
-std::array<float,2>{0.723679423f, 0.210734457f},
-std::array<float,2>{0.842001677f, 0.752822578f},
-std::array<float,2>{0.116042264f, 0.325458735f},
-std::array<float,2>{0.137035891f, 0.977945328f},
-std::array<float,2>{0.894578457f, 0.412709683f},
-std::array<float,2>{0.603639066f, 0.742411256f},
-std::array<float,2>{0.288259864f, 0.114859864f},
-std::array<float,2>{0.359114438f, 0.843815148f},
-std::array<float,2>{0.54019016f, 0.265899271f},
-std::array<float,2>{0.972167373f, 0.553112268f},
-std::array<float,2>{0.231333509f, 0.152600139f},
-std::array<float,2>{0.0181681626f, 0.627240777f},
-std::array<float,2>{0.766737819f, 0.0548240356f},
-std::array<float,2>{0.62903893f, 0.936337173f},
-std::array<float,2>{0.411134124f, 0.463771045f},
-std::array<float,2>{0.268466443f, 0.699915409f},
-std::array<float,2>{0.574647367f, 0.0720166117f},
-std::array<float,2>{0.91176635f, 0.946687281f},
-std::array<float,2>{0.161918148f, 0.392333686f},
-std::array<float,2>{0.0863133669f, 0.796565354f},
-std::array<float,2>{0.87473619f, 0.344924182f},
-std::array<float,2>{0.699974656f, 0.57047075f},
-std::array<float,2>{0.441075146f, 0.230646908f},
-std::array<float,2>{0.405910134f, 0.904074132f},
-std::array<float,2>{0.671541095f, 0.482106477f},
-std::array<float,2>{0.792599022f, 0.674735785f},
-std::array<float,2>{0.0337442718f, 0.00695221033f},
-std::array<float,2>{0.213972762f, 0.527436972f},
-std::array<float,2>{0.948037684f, 0.179234967f},
-std::array<float,2>{0.510487556f, 0.819320142f},
-std::array<float,2>{0.323017448f, 0.297283918f},
-std::array<float,2>{0.339487225f, 0.538572192f},
-std::array<float,2>{0.52067095f, 0.126964673f},
-std::array<float,2>{0.967182636f, 0.869511962f},
-std::array<float,2>{0.192284942f, 0.254775316f},
-std::array<float,2>{0.0490665212f, 0.921658695f},
-std::array<float,2>{0.808580875f, 0.446295291f},
-std::array<float,2>{0.67797488f, 0.656028986f},
-std::array<float,2>{0.384100437f, 0.0436702892f},
-std::array<float,2>{0.462261111f, 0.779826105f},
-std::array<float,2>{0.708284795f, 0.328932375f},
-std::array<float,2>{0.845838249f, 0.598458052f},
-std::array<float,2>{0.0779684559f, 0.200429916f},
-std::array<float,2>{0.184340551f, 0.734219909f},
-std::array<float,2>{0.93377465f, 0.105112039f},
-std::array<float,2>{0.586979926f, 0.990803599f},
-std::array<float,2>{0.257149071f, 0.430369675f},
-std::array<float,2>{0.432937145f, 0.666059315f},
-std::array<float,2>{0.640751004f, 0.0177713446f},
-std::array<float,2>{0.765154839f, 0.876041532f},
-std::array<float,2>{0.0141603956f, 0.48780182f},
-std::array<float,2>{0.242844105f, 0.834768891f},
-std::array<float,2>{0.993201256f, 0.290249348f},
-std::array<float,2>{0.556675911f, 0.508693874f},
-std::array<float,2>{0.364161223f, 0.168748364f},
-std::array<float,2>{0.298200071f, 0.959885538f},
-std::array<float,2>{0.612649024f, 0.37934348f},
-std::array<float,2>{0.887460232f, 0.71708256f},
-std::array<float,2>{0.14125976f, 0.090558365f},
-std::array<float,2>{0.102326937f, 0.580393851f},
-std::array<float,2>{0.822611511f, 0.249158397f},
-std::array<float,2>{0.746283531f, 0.811030984f},
-std::array<float,2>{0.481984526f, 0.367514819f},
-std::array<float,2>{0.473706454f, 0.524636149f},
-std::array<float,2>{0.737113178f, 0.175416976f},
-std::array<float,2>{0.81966269f, 0.815345585f},
-std::array<float,2>{0.0966602862f, 0.303169698f},
-std::array<float,2>{0.14964965f, 0.898852289f},
-std::array<float,2>{0.880476832f, 0.477383256f},
-std::array<float,2>{0.617587507f, 0.676116168f},
-std::array<float,2>{0.310099483f, 0.00347236521f},
-std::array<float,2>{0.369411319f, 0.789508581f},
-std::array<float,2>{0.55405885f, 0.34844622f},
-std::array<float,2>{0.98657304f, 0.577007473f},
-std::array<float,2>{0.23564139f, 0.227430597f},
-std::array<float,2>{0.000962914142f, 0.69723618f},
-std::array<float,2>{0.755160034f, 0.0744297206f},
-std::array<float,2>{0.656120002f, 0.949358404f},
-std::array<float,2>{0.42804116f, 0.396215647f},
-std::array<float,2>{0.26044181f, 0.629899919f},
-std::array<float,2>{0.584556043f, 0.0614729747f},
-std::array<float,2>{0.923033655f, 0.931460857f},
-std::array<float,2>{0.177062705f, 0.464906812f},
-std::array<float,2>{0.066695258f, 0.850754857f},
-std::array<float,2>{0.856618404f, 0.273334384f},
-std::array<float,2>{0.712554336f, 0.548678219f},
-std::array<float,2>{0.45729655f, 0.148782969f},
-std::array<float,2>{0.380428702f, 0.981808901f},
-std::array<float,2>{0.679928303f, 0.406862944f},
-std::array<float,2>{0.803691387f, 0.74854511f},
-std::array<float,2>{0.0619979426f, 0.110316716f},
-std::array<float,2>{0.201072723f, 0.616849184f},
-std::array<float,2>{0.956655741f, 0.20418644f},
-std::array<float,2>{0.524971366f, 0.754581749f},
-std::array<float,2>{0.333300382f, 0.322835445f},
-std::array<float,2>{0.314646542f, 0.584079266f},
-std::array<float,2>{0.503349483f, 0.245406702f},
-std::array<float,2>{0.939162016f, 0.807658494f},
-std::array<float,2>{0.205594793f, 0.372261494f},
-std::array<float,2>{0.0417193957f, 0.954099536f},
-std::array<float,2>{0.78453666f, 0.375641584f},
-std::array<float,2>{0.658125162f, 0.711427212f},
-std::array<float,2>{0.391469926f, 0.0860303864f},
-std::array<float,2>{0.447594762f, 0.831672847f},
-std::array<float,2>{0.690793037f, 0.294562519f},
-std::array<float,2>{0.860464752f, 0.512366593f},
-std::array<float,2>{0.0787117556f, 0.167705938f},
-std::array<float,2>{0.166797936f, 0.67066431f},
-std::array<float,2>{0.921386421f, 0.0223185103f},
-std::array<float,2>{0.565099657f, 0.879812479f},
-std::array<float,2>{0.277238786f, 0.49067089f},
-std::array<float,2>{0.417441308f, 0.727237701f},
-std::array<float,2>{0.63420552f, 0.105562687f},
-std::array<float,2>{0.777074575f, 0.984514356f},
-std::array<float,2>{0.0274206828f, 0.435868412f},
-std::array<float,2>{0.223783836f, 0.774773836f},
-std::array<float,2>{0.978415668f, 0.334271103f},
-std::array<float,2>{0.535714984f, 0.595470667f},
-std::array<float,2>{0.346814692f, 0.198864117f},
-std::array<float,2>{0.29480207f, 0.914638042f},
-std::array<float,2>{0.597650349f, 0.450407922f},
-std::array<float,2>{0.905844033f, 0.651682854f},
-std::array<float,2>{0.126026452f, 0.0410642661f},
-std::array<float,2>{0.118374683f, 0.535124183f},
-std::array<float,2>{0.832382679f, 0.130929366f},
-std::array<float,2>{0.729712665f, 0.87219429f},
-std::array<float,2>{0.498337418f, 0.25050956f},
-std::array<float,2>{0.399920225f, 0.607402503f},
-std::array<float,2>{0.667289734f, 0.191032916f},
-std::array<float,2>{0.795715034f, 0.76782167f},
-std::array<float,2>{0.0389858335f, 0.342454404f},
-std::array<float,2>{0.215301782f, 0.994232714f},
-std::array<float,2>{0.950441539f, 0.429683626f},
-std::array<float,2>{0.513139606f, 0.726352513f},
-std::array<float,2>{0.325929016f, 0.097409755f},
-std::array<float,2>{0.272001982f, 0.859896421f},
-std::array<float,2>{0.572906196f, 0.265368372f},
-std::array<float,2>{0.908137858f, 0.54085964f},
-std::array<float,2>{0.159086511f, 0.14035517f},
-std::array<float,2>{0.0929007605f, 0.646468103f},
-std::array<float,2>{0.86901176f, 0.0366380811f},
-std::array<float,2>{0.696821332f, 0.910833359f},
-std::array<float,2>{0.445124775f, 0.437809527f},
-std::array<float,2>{0.354943573f, 0.707735956f},
-std::array<float,2>{0.546255708f, 0.0815328509f},
-std::array<float,2>{0.976095498f, 0.968349218f},
-std::array<float,2>{0.228023618f, 0.390225679f},
-std::array<float,2>{0.020576464f, 0.803609192f},
-std::array<float,2>{0.771381021f, 0.361296654f},
-std::array<float,2>{0.626807809f, 0.588128865f},
-std::array<float,2>{0.410089374f, 0.236302137f},
-std::array<float,2>{0.490219027f, 0.886986077f},
-std::array<float,2>{0.720021784f, 0.496953309f},
-std::array<float,2>{0.838675261f, 0.657112896f},
-std::array<float,2>{0.109431259f, 0.02677444f},
-std::array<float,2>{0.134800434f, 0.5053581f},
-std::array<float,2>{0.894172728f, 0.157293588f},
-std::array<float,2>{0.606458127f, 0.836806297f},
-std::array<float,2>{0.28138724f, 0.287456453f},
-std::array<float,2>{0.302110374f, 0.55600816f},
-std::array<float,2>{0.614998519f, 0.143242449f},
-std::array<float,2>{0.882881761f, 0.858819067f},
-std::array<float,2>{0.144766107f, 0.275530338f},
-std::array<float,2>{0.105645947f, 0.925385892f},
-std::array<float,2>{0.826811671f, 0.453558117f},
-std::array<float,2>{0.744699657f, 0.638803542f},
-std::array<float,2>{0.478864402f, 0.0482169837f},
-std::array<float,2>{0.435098022f, 0.764645994f},
-std::array<float,2>{0.646419883f, 0.313732922f},
-std::array<float,2>{0.759991348f, 0.6228894f},
-std::array<float,2>{0.00924036186f, 0.213001534f},
-std::array<float,2>{0.249628633f, 0.737970829f},
-std::array<float,2>{0.996197224f, 0.122453317f},
-std::array<float,2>{0.559924185f, 0.972896755f},
-std::array<float,2>{0.361403018f, 0.41444689f},
-std::array<float,2>{0.468722463f, 0.682857096f},
-std::array<float,2>{0.704124033f, 0.0113739269f},
-std::array<float,2>{0.85025996f, 0.896015227f},
-std::array<float,2>{0.072375223f, 0.4690364f},
-std::array<float,2>{0.183354259f, 0.82309258f},
-std::array<float,2>{0.931023538f, 0.310986876f},
-std::array<float,2>{0.593454063f, 0.519450009f},
-std::array<float,2>{0.253251165f, 0.187091306f},
-std::array<float,2>{0.342905521f, 0.940164983f},
-std::array<float,2>{0.516307831f, 0.404774398f},
-std::array<float,2>{0.962414622f, 0.687683046f},
-std::array<float,2>{0.189402565f, 0.0698321909f},
-std::array<float,2>{0.051773876f, 0.564903498f},
-std::array<float,2>{0.812164545f, 0.219743922f},
-std::array<float,2>{0.672681272f, 0.784974337f},
-std::array<float,2>{0.387723655f, 0.353124678f},
-std::array<float,2>{0.423809648f, 0.543584347f},
-std::array<float,2>{0.650673389f, 0.136210531f},
-std::array<float,2>{0.75006181f, 0.866117239f},
-std::array<float,2>{0.00673497748f, 0.260534465f},
-std::array<float,2>{0.241020635f, 0.908667028f},
-std::array<float,2>{0.991721034f, 0.444408089f},
-std::array<float,2>{0.549623191f, 0.643503964f},
-std::array<float,2>{0.372554302f, 0.0333087333f},
-std::array<float,2>{0.30691576f, 0.770810306f},
-std::array<float,2>{0.621347964f, 0.338679731f},
-std::array<float,2>{0.878242373f, 0.605210841f},
-std::array<float,2>{0.156036079f, 0.194553286f},
-std::array<float,2>{0.0980812013f, 0.71935302f},
-std::array<float,2>{0.815447628f, 0.098172769f},
-std::array<float,2>{0.739865482f, 0.997012138f},
-std::array<float,2>{0.470643133f, 0.422924995f},
-std::array<float,2>{0.331059217f, 0.660951555f},
-std::array<float,2>{0.528195083f, 0.0296567492f},
-std::array<float,2>{0.957771957f, 0.886580706f},
-std::array<float,2>{0.197577655f, 0.493999869f},
-std::array<float,2>{0.0582483597f, 0.842237949f},
-std::array<float,2>{0.797096491f, 0.281914473f},
-std::array<float,2>{0.685234606f, 0.500818193f},
-std::array<float,2>{0.378233433f, 0.163470179f},
-std::array<float,2>{0.453584492f, 0.962225854f},
-std::array<float,2>{0.716776133f, 0.386068702f},
-std::array<float,2>{0.854886353f, 0.704719782f},
-std::array<float,2>{0.0626532957f, 0.0849918723f},
-std::array<float,2>{0.172853574f, 0.592247903f},
-std::array<float,2>{0.927774489f, 0.241495714f},
-std::array<float,2>{0.58156842f, 0.799508095f},
-std::array<float,2>{0.262628824f, 0.363931507f},
-std::array<float,2>{0.277898252f, 0.617350399f},
-std::array<float,2>{0.568565249f, 0.218257055f},
-std::array<float,2>{0.916975737f, 0.75823766f},
-std::array<float,2>{0.169843018f, 0.319777429f},
-std::array<float,2>{0.0834713429f, 0.97106564f},
-std::array<float,2>{0.86395663f, 0.419194609f},
-std::array<float,2>{0.691542387f, 0.740649521f},
-std::array<float,2>{0.451889634f, 0.117431469f},
-std::array<float,2>{0.396890134f, 0.853217542f},
-std::array<float,2>{0.663005292f, 0.278436869f},
-std::array<float,2>{0.786798954f, 0.560358405f},
-std::array<float,2>{0.0443994738f, 0.146990463f},
-std::array<float,2>{0.209049076f, 0.634127319f},
-std::array<float,2>{0.941781104f, 0.0523138568f},
-std::array<float,2>{0.507577479f, 0.929529965f},
-std::array<float,2>{0.318629086f, 0.458117992f},
-std::array<float,2>{0.492237329f, 0.693613648f},
-std::array<float,2>{0.730484545f, 0.0629783943f},
-std::array<float,2>{0.831969321f, 0.944990814f},
-std::array<float,2>{0.122282028f, 0.398484439f},
-std::array<float,2>{0.129937232f, 0.788515627f},
-std::array<float,2>{0.901138544f, 0.357344627f},
-std::array<float,2>{0.5979653f, 0.567518473f},
-std::array<float,2>{0.290003568f, 0.222799554f},
-std::array<float,2>{0.351048291f, 0.891400337f},
-std::array<float,2>{0.532377481f, 0.476395547f},
-std::array<float,2>{0.980493367f, 0.684253633f},
-std::array<float,2>{0.220153183f, 0.0120446356f},
-std::array<float,2>{0.027202962f, 0.520294607f},
-std::array<float,2>{0.780246317f, 0.182669699f},
-std::array<float,2>{0.63684684f, 0.826027215f},
-std::array<float,2>{0.418832541f, 0.305597216f},
-std::array<float,2>{0.437749535f, 0.57234633f},
-std::array<float,2>{0.70286423f, 0.232805535f},
-std::array<float,2>{0.872538507f, 0.793193102f},
-std::array<float,2>{0.0895435885f, 0.347382128f},
-std::array<float,2>{0.163648576f, 0.948021352f},
-std::array<float,2>{0.913767934f, 0.392941892f},
-std::array<float,2>{0.576544762f, 0.702890694f},
-std::array<float,2>{0.265843302f, 0.0724046379f},
-std::array<float,2>{0.320432395f, 0.816534936f},
-std::array<float,2>{0.509745896f, 0.299018174f},
-std::array<float,2>{0.946246684f, 0.52977401f},
-std::array<float,2>{0.212361664f, 0.17580013f},
-std::array<float,2>{0.0313406512f, 0.672688961f},
-std::array<float,2>{0.790486217f, 0.00578308199f},
-std::array<float,2>{0.669649661f, 0.905707717f},
-std::array<float,2>{0.403303236f, 0.482991397f},
-std::array<float,2>{0.286049902f, 0.74493742f},
-std::array<float,2>{0.60287255f, 0.11677295f},
-std::array<float,2>{0.896989405f, 0.978617728f},
-std::array<float,2>{0.139536887f, 0.410687804f},
-std::array<float,2>{0.11443758f, 0.750043213f},
-std::array<float,2>{0.840563297f, 0.326490432f},
-std::array<float,2>{0.725486636f, 0.611873984f},
-std::array<float,2>{0.487932861f, 0.208689958f},
-std::array<float,2>{0.412412822f, 0.93444711f},
-std::array<float,2>{0.63201189f, 0.461428136f},
-std::array<float,2>{0.76801151f, 0.625897467f},
-std::array<float,2>{0.0172193814f, 0.057367906f},
-std::array<float,2>{0.234303623f, 0.551527381f},
-std::array<float,2>{0.968837678f, 0.155584663f},
-std::array<float,2>{0.541189134f, 0.846939981f},
-std::array<float,2>{0.355470687f, 0.268690914f},
-std::array<float,2>{0.365596145f, 0.510963678f},
-std::array<float,2>{0.554948092f, 0.171845078f},
-std::array<float,2>{0.995929539f, 0.833729804f},
-std::array<float,2>{0.244638309f, 0.292686284f},
-std::array<float,2>{0.0122780306f, 0.877049565f},
-std::array<float,2>{0.762111425f, 0.484964401f},
-std::array<float,2>{0.643188655f, 0.664352417f},
-std::array<float,2>{0.430678934f, 0.0171790682f},
-std::array<float,2>{0.483092338f, 0.809820592f},
-std::array<float,2>{0.749712169f, 0.369550765f},
-std::array<float,2>{0.820554435f, 0.579963923f},
-std::array<float,2>{0.104389988f, 0.246718094f},
-std::array<float,2>{0.143944725f, 0.716792464f},
-std::array<float,2>{0.890543818f, 0.0932602212f},
-std::array<float,2>{0.611212432f, 0.957965136f},
-std::array<float,2>{0.300658524f, 0.381634623f},
-std::array<float,2>{0.386136919f, 0.65424037f},
-std::array<float,2>{0.677174807f, 0.0463659167f},
-std::array<float,2>{0.805831254f, 0.919352353f},
-std::array<float,2>{0.0473427288f, 0.448781371f},
-std::array<float,2>{0.194779783f, 0.868600309f},
-std::array<float,2>{0.966377437f, 0.257015646f},
-std::array<float,2>{0.522758365f, 0.536318243f},
-std::array<float,2>{0.336504191f, 0.125344709f},
-std::array<float,2>{0.254359424f, 0.988327205f},
-std::array<float,2>{0.588040054f, 0.432945967f},
-std::array<float,2>{0.937012315f, 0.731418848f},
-std::array<float,2>{0.186296985f, 0.1033279f},
-std::array<float,2>{0.0748785436f, 0.600448191f},
-std::array<float,2>{0.844496787f, 0.201601997f},
-std::array<float,2>{0.710016549f, 0.77760452f},
-std::array<float,2>{0.464060724f, 0.331138045f},
-std::array<float,2>{0.465503454f, 0.518926919f},
-std::array<float,2>{0.70581466f, 0.186775312f},
-std::array<float,2>{0.848564386f, 0.822711647f},
-std::array<float,2>{0.0705397055f, 0.311099976f},
-std::array<float,2>{0.18103525f, 0.895892143f},
-std::array<float,2>{0.933033764f, 0.469647408f},
-std::array<float,2>{0.59173125f, 0.683560252f},
-std::array<float,2>{0.250971615f, 0.011009411f},
-std::array<float,2>{0.340140134f, 0.784275115f},
-std::array<float,2>{0.519481421f, 0.352988303f},
-std::array<float,2>{0.964827478f, 0.565428972f},
-std::array<float,2>{0.190252513f, 0.220336437f},
-std::array<float,2>{0.0541950352f, 0.688154995f},
-std::array<float,2>{0.809412599f, 0.0696023405f},
-std::array<float,2>{0.675780535f, 0.939641297f},
-std::array<float,2>{0.389591962f, 0.404867858f},
-std::array<float,2>{0.303999513f, 0.63934058f},
-std::array<float,2>{0.616978645f, 0.0484159291f},
-std::array<float,2>{0.885758162f, 0.924851358f},
-std::array<float,2>{0.147515863f, 0.453672081f},
-std::array<float,2>{0.108441338f, 0.859202921f},
-std::array<float,2>{0.825671852f, 0.276355147f},
-std::array<float,2>{0.743469298f, 0.556603014f},
-std::array<float,2>{0.478452682f, 0.142967895f},
-std::array<float,2>{0.435860336f, 0.973400414f},
-std::array<float,2>{0.647091091f, 0.41458714f},
-std::array<float,2>{0.759705305f, 0.737450242f},
-std::array<float,2>{0.0103423698f, 0.122768693f},
-std::array<float,2>{0.246294603f, 0.622241855f},
-std::array<float,2>{0.99983722f, 0.213538408f},
-std::array<float,2>{0.562162042f, 0.763910234f},
-std::array<float,2>{0.360927373f, 0.313990504f},
-std::array<float,2>{0.352896124f, 0.588790596f},
-std::array<float,2>{0.544868529f, 0.235532582f},
-std::array<float,2>{0.974314332f, 0.80274266f},
-std::array<float,2>{0.229876608f, 0.360563695f},
-std::array<float,2>{0.0217622612f, 0.967917562f},
-std::array<float,2>{0.771559119f, 0.389822453f},
-std::array<float,2>{0.628596306f, 0.707145691f},
-std::array<float,2>{0.408033133f, 0.081744574f},
-std::array<float,2>{0.490890652f, 0.83606708f},
-std::array<float,2>{0.721252918f, 0.287884444f},
-std::array<float,2>{0.837095499f, 0.505588412f},
-std::array<float,2>{0.112229832f, 0.157876909f},
-std::array<float,2>{0.134487107f, 0.656474769f},
-std::array<float,2>{0.891021311f, 0.0272140149f},
-std::array<float,2>{0.60746032f, 0.887540102f},
-std::array<float,2>{0.284468591f, 0.496186852f},
-std::array<float,2>{0.401990414f, 0.725832939f},
-std::array<float,2>{0.664717555f, 0.0966954604f},
-std::array<float,2>{0.79360497f, 0.995004714f},
-std::array<float,2>{0.0363381989f, 0.428831011f},
-std::array<float,2>{0.217261449f, 0.768136799f},
-std::array<float,2>{0.953037739f, 0.342264801f},
-std::array<float,2>{0.513717175f, 0.606839478f},
-std::array<float,2>{0.327921927f, 0.190464422f},
-std::array<float,2>{0.271176577f, 0.910267711f},
-std::array<float,2>{0.570468187f, 0.438299984f},
-std::array<float,2>{0.90870738f, 0.645757079f},
-std::array<float,2>{0.157269612f, 0.0364056714f},
-std::array<float,2>{0.091650784f, 0.540057421f},
-std::array<float,2>{0.86996609f, 0.139872178f},
-std::array<float,2>{0.698647738f, 0.859567583f},
-std::array<float,2>{0.442021608f, 0.265089154f},
-std::array<float,2>{0.414770722f, 0.594789863f},
-std::array<float,2>{0.635606587f, 0.198387817f},
-std::array<float,2>{0.774711847f, 0.775374711f},
-std::array<float,2>{0.0296555292f, 0.334828377f},
-std::array<float,2>{0.224835351f, 0.985027194f},
-std::array<float,2>{0.980397105f, 0.436056137f},
-std::array<float,2>{0.538058817f, 0.726882398f},
-std::array<float,2>{0.344722122f, 0.10605818f},
-std::array<float,2>{0.296795934f, 0.872679532f},
-std::array<float,2>{0.594281197f, 0.250410855f},
-std::array<float,2>{0.902988136f, 0.534449816f},
-std::array<float,2>{0.12825644f, 0.131695107f},
-std::array<float,2>{0.12103951f, 0.651913822f},
-std::array<float,2>{0.835052133f, 0.0417468697f},
-std::array<float,2>{0.728482306f, 0.914420962f},
-std::array<float,2>{0.497152209f, 0.450801075f},
-std::array<float,2>{0.313869685f, 0.711144269f},
-std::array<float,2>{0.500688434f, 0.0866323113f},
-std::array<float,2>{0.939677596f, 0.953173935f},
-std::array<float,2>{0.204127684f, 0.375056475f},
-std::array<float,2>{0.0404566564f, 0.808212519f},
-std::array<float,2>{0.782662332f, 0.372879624f},
-std::array<float,2>{0.659147561f, 0.584640741f},
-std::array<float,2>{0.392935276f, 0.245923564f},
-std::array<float,2>{0.446552932f, 0.879237115f},
-std::array<float,2>{0.688246906f, 0.490931034f},
-std::array<float,2>{0.863012433f, 0.669933677f},
-std::array<float,2>{0.0820013061f, 0.0216333382f},
-std::array<float,2>{0.165264994f, 0.512121797f},
-std::array<float,2>{0.919234514f, 0.167141631f},
-std::array<float,2>{0.564229667f, 0.831085026f},
-std::array<float,2>{0.274273694f, 0.294183165f},
-std::array<float,2>{0.257894874f, 0.54799509f},
-std::array<float,2>{0.583795249f, 0.149181306f},
-std::array<float,2>{0.925032794f, 0.851327837f},
-std::array<float,2>{0.179296881f, 0.272943765f},
-std::array<float,2>{0.0686169937f, 0.930966258f},
-std::array<float,2>{0.858193278f, 0.465680599f},
-std::array<float,2>{0.714391172f, 0.630744815f},
-std::array<float,2>{0.459388822f, 0.0605570674f},
-std::array<float,2>{0.382165521f, 0.754200041f},
-std::array<float,2>{0.682033777f, 0.322370827f},
-std::array<float,2>{0.802320898f, 0.61625433f},
-std::array<float,2>{0.0604519099f, 0.20460698f},
-std::array<float,2>{0.201920822f, 0.748443484f},
-std::array<float,2>{0.953830302f, 0.109605618f},
-std::array<float,2>{0.526696861f, 0.982171834f},
-std::array<float,2>{0.33534199f, 0.406652987f},
-std::array<float,2>{0.475852489f, 0.67665422f},
-std::array<float,2>{0.735231996f, 0.00317369518f},
-std::array<float,2>{0.817988336f, 0.899105132f},
-std::array<float,2>{0.0953438208f, 0.476762861f},
-std::array<float,2>{0.150476962f, 0.814533293f},
-std::array<float,2>{0.881081164f, 0.303591192f},
-std::array<float,2>{0.620715559f, 0.525055468f},
-std::array<float,2>{0.310659111f, 0.17492111f},
-std::array<float,2>{0.369050622f, 0.950007558f},
-std::array<float,2>{0.551655531f, 0.395879596f},
-std::array<float,2>{0.985723495f, 0.696519434f},
-std::array<float,2>{0.23657003f, 0.0748596862f},
-std::array<float,2>{0.00222757924f, 0.576460421f},
-std::array<float,2>{0.757665634f, 0.226851001f},
-std::array<float,2>{0.65384984f, 0.789567769f},
-std::array<float,2>{0.427075297f, 0.348117083f},
-std::array<float,2>{0.38450703f, 0.536980629f},
-std::array<float,2>{0.678265512f, 0.125600815f},
-std::array<float,2>{0.807986557f, 0.868812025f},
-std::array<float,2>{0.0494813845f, 0.257423311f},
-std::array<float,2>{0.191466376f, 0.919581294f},
-std::array<float,2>{0.967323363f, 0.448660672f},
-std::array<float,2>{0.521081924f, 0.653732538f},
-std::array<float,2>{0.339051634f, 0.046486266f},
-std::array<float,2>{0.257328004f, 0.777834713f},
-std::array<float,2>{0.587417662f, 0.331824452f},
-std::array<float,2>{0.934551299f, 0.599646807f},
-std::array<float,2>{0.183723956f, 0.20201838f},
-std::array<float,2>{0.0775094777f, 0.730903745f},
-std::array<float,2>{0.846659243f, 0.102612674f},
-std::array<float,2>{0.708752394f, 0.989233851f},
-std::array<float,2>{0.46278286f, 0.433445066f},
-std::array<float,2>{0.363494009f, 0.664608836f},
-std::array<float,2>{0.55747354f, 0.0170259643f},
-std::array<float,2>{0.994060338f, 0.877757072f},
-std::array<float,2>{0.242579788f, 0.48442021f},
-std::array<float,2>{0.0138128251f, 0.833302259f},
-std::array<float,2>{0.764937222f, 0.292168856f},
-std::array<float,2>{0.64122045f, 0.511331439f},
-std::array<float,2>{0.43349117f, 0.171047971f},
-std::array<float,2>{0.481633425f, 0.957377613f},
-std::array<float,2>{0.746989071f, 0.381230205f},
-std::array<float,2>{0.823156118f, 0.716195285f},
-std::array<float,2>{0.101919577f, 0.0935950354f},
-std::array<float,2>{0.140850261f, 0.579323232f},
-std::array<float,2>{0.887111127f, 0.246570289f},
-std::array<float,2>{0.612912118f, 0.810355425f},
-std::array<float,2>{0.298345894f, 0.370074868f},
-std::array<float,2>{0.289031178f, 0.611664534f},
-std::array<float,2>{0.604119718f, 0.208035737f},
-std::array<float,2>{0.895207107f, 0.750916123f},
-std::array<float,2>{0.137379512f, 0.326693773f},
-std::array<float,2>{0.115581073f, 0.979284883f},
-std::array<float,2>{0.842632532f, 0.410200089f},
-std::array<float,2>{0.724265516f, 0.7443133f},
-std::array<float,2>{0.48617962f, 0.116402507f},
-std::array<float,2>{0.411766469f, 0.847581923f},
-std::array<float,2>{0.629572153f, 0.269313812f},
-std::array<float,2>{0.767277062f, 0.551083684f},
-std::array<float,2>{0.0178392585f, 0.155784041f},
-std::array<float,2>{0.230950445f, 0.62510556f},
-std::array<float,2>{0.972252607f, 0.0566799678f},
-std::array<float,2>{0.540988624f, 0.933913648f},
-std::array<float,2>{0.358684629f, 0.461289227f},
-std::array<float,2>{0.44063428f, 0.702460289f},
-std::array<float,2>{0.699291646f, 0.0729825869f},
-std::array<float,2>{0.874419987f, 0.947545409f},
-std::array<float,2>{0.0866076276f, 0.393417984f},
-std::array<float,2>{0.16147919f, 0.793490708f},
-std::array<float,2>{0.911536276f, 0.346926719f},
-std::array<float,2>{0.575193465f, 0.573055506f},
-std::array<float,2>{0.26786387f, 0.233136028f},
-std::array<float,2>{0.322586358f, 0.905879736f},
-std::array<float,2>{0.509878635f, 0.482699811f},
-std::array<float,2>{0.947372317f, 0.671935737f},
-std::array<float,2>{0.214626834f, 0.00535401236f},
-std::array<float,2>{0.0333128311f, 0.530041635f},
-std::array<float,2>{0.792327046f, 0.176465899f},
-std::array<float,2>{0.670936584f, 0.816925883f},
-std::array<float,2>{0.405707955f, 0.299534947f},
-std::array<float,2>{0.494383782f, 0.568143487f},
-std::array<float,2>{0.73336935f, 0.223264113f},
-std::array<float,2>{0.829876006f, 0.78905946f},
-std::array<float,2>{0.123864695f, 0.356697768f},
-std::array<float,2>{0.131936565f, 0.944480062f},
-std::array<float,2>{0.900030553f, 0.399291247f},
-std::array<float,2>{0.601384103f, 0.694176555f},
-std::array<float,2>{0.292944521f, 0.0634108037f},
-std::array<float,2>{0.34913367f, 0.825547099f},
-std::array<float,2>{0.533807278f, 0.304855704f},
-std::array<float,2>{0.982969761f, 0.519609928f},
-std::array<float,2>{0.22121048f, 0.183203325f},
-std::array<float,2>{0.0247609802f, 0.683719397f},
-std::array<float,2>{0.777778804f, 0.0122946072f},
-std::array<float,2>{0.640574217f, 0.890934944f},
-std::array<float,2>{0.421081781f, 0.476006091f},
-std::array<float,2>{0.279386967f, 0.741149962f},
-std::array<float,2>{0.566807568f, 0.118026115f},
-std::array<float,2>{0.914935112f, 0.971483052f},
-std::array<float,2>{0.17040357f, 0.419780284f},
-std::array<float,2>{0.0856402889f, 0.758574963f},
-std::array<float,2>{0.865264773f, 0.320011944f},
-std::array<float,2>{0.694385886f, 0.617734313f},
-std::array<float,2>{0.449914247f, 0.218433604f},
-std::array<float,2>{0.396091849f, 0.928930461f},
-std::array<float,2>{0.660269499f, 0.458885521f},
-std::array<float,2>{0.788321555f, 0.634504259f},
-std::array<float,2>{0.0449448563f, 0.0521036498f},
-std::array<float,2>{0.208654031f, 0.559993148f},
-std::array<float,2>{0.943870306f, 0.14694953f},
-std::array<float,2>{0.50404036f, 0.852853417f},
-std::array<float,2>{0.316622198f, 0.279123604f},
-std::array<float,2>{0.328532785f, 0.500310779f},
-std::array<float,2>{0.530504704f, 0.163646594f},
-std::array<float,2>{0.959577262f, 0.842535913f},
-std::array<float,2>{0.195506275f, 0.281709671f},
-std::array<float,2>{0.0556099042f, 0.886018574f},
-std::array<float,2>{0.799473822f, 0.493467182f},
-std::array<float,2>{0.686692238f, 0.660351813f},
-std::array<float,2>{0.376638561f, 0.030160524f},
-std::array<float,2>{0.456568867f, 0.79912287f},
-std::array<float,2>{0.717283905f, 0.363586724f},
-std::array<float,2>{0.85196656f, 0.592669606f},
-std::array<float,2>{0.0651592091f, 0.24208799f},
-std::array<float,2>{0.174950063f, 0.704338431f},
-std::array<float,2>{0.927322924f, 0.0854950324f},
-std::array<float,2>{0.578785181f, 0.962692738f},
-std::array<float,2>{0.264104843f, 0.386690199f},
-std::array<float,2>{0.424513936f, 0.642697632f},
-std::array<float,2>{0.648491383f, 0.0338720232f},
-std::array<float,2>{0.753768444f, 0.908915162f},
-std::array<float,2>{0.00579343271f, 0.445064068f},
-std::array<float,2>{0.240014359f, 0.865382493f},
-std::array<float,2>{0.989396334f, 0.259839416f},
-std::array<float,2>{0.547855794f, 0.543359637f},
-std::array<float,2>{0.373579979f, 0.136612386f},
-std::array<float,2>{0.304988384f, 0.996184886f},
-std::array<float,2>{0.624609411f, 0.423824877f},
-std::array<float,2>{0.876521885f, 0.719023705f},
-std::array<float,2>{0.152623251f, 0.0979419723f},
-std::array<float,2>{0.100933053f, 0.604751348f},
-std::array<float,2>{0.81351012f, 0.194983676f},
-std::array<float,2>{0.74047786f, 0.771464705f},
-std::array<float,2>{0.471350759f, 0.338230669f},
-std::array<float,2>{0.479017079f, 0.558115423f},
-std::array<float,2>{0.744334221f, 0.141124219f},
-std::array<float,2>{0.826483786f, 0.855993688f},
-std::array<float,2>{0.106093094f, 0.27470848f},
-std::array<float,2>{0.145283669f, 0.922355175f},
-std::array<float,2>{0.883632064f, 0.455442876f},
-std::array<float,2>{0.614259243f, 0.637021661f},
-std::array<float,2>{0.30252564f, 0.0507048965f},
-std::array<float,2>{0.362113416f, 0.762625635f},
-std::array<float,2>{0.560518384f, 0.316380262f},
-std::array<float,2>{0.996658444f, 0.62315166f},
-std::array<float,2>{0.249417916f, 0.211276084f},
-std::array<float,2>{0.00959592219f, 0.734868586f},
-std::array<float,2>{0.760451972f, 0.124125652f},
-std::array<float,2>{0.645974159f, 0.976415515f},
-std::array<float,2>{0.434787393f, 0.417395145f},
-std::array<float,2>{0.253518134f, 0.681404173f},
-std::array<float,2>{0.593099296f, 0.00828849897f},
-std::array<float,2>{0.931580842f, 0.898212314f},
-std::array<float,2>{0.182706311f, 0.472253084f},
-std::array<float,2>{0.0728009641f, 0.820504189f},
-std::array<float,2>{0.849665523f, 0.310510576f},
-std::array<float,2>{0.704708576f, 0.517440557f},
-std::array<float,2>{0.468090773f, 0.185354307f},
-std::array<float,2>{0.388667166f, 0.939422488f},
-std::array<float,2>{0.672138274f, 0.403970987f},
-std::array<float,2>{0.811546385f, 0.689919114f},
-std::array<float,2>{0.0525213815f, 0.0668694973f},
-std::array<float,2>{0.188792065f, 0.564010859f},
-std::array<float,2>{0.962110698f, 0.222273976f},
-std::array<float,2>{0.515953004f, 0.782972217f},
-std::array<float,2>{0.343379498f, 0.353623331f},
-std::array<float,2>{0.325404763f, 0.607517242f},
-std::array<float,2>{0.51363349f, 0.187845692f},
-std::array<float,2>{0.950724721f, 0.767260194f},
-std::array<float,2>{0.215405837f, 0.340966254f},
-std::array<float,2>{0.0381405614f, 0.992471278f},
-std::array<float,2>{0.795146942f, 0.427174747f},
-std::array<float,2>{0.667723894f, 0.724466741f},
-std::array<float,2>{0.399625987f, 0.0938621834f},
-std::array<float,2>{0.444418907f, 0.861898243f},
-std::array<float,2>{0.696777225f, 0.263017982f},
-std::array<float,2>{0.868652105f, 0.541324198f},
-std::array<float,2>{0.0935004801f, 0.136907727f},
-std::array<float,2>{0.158548102f, 0.646825969f},
-std::array<float,2>{0.907231033f, 0.0379182138f},
-std::array<float,2>{0.572517931f, 0.913397491f},
-std::array<float,2>{0.271933585f, 0.44115302f},
-std::array<float,2>{0.409351707f, 0.710851192f},
-std::array<float,2>{0.626153231f, 0.0794845894f},
-std::array<float,2>{0.770550668f, 0.966356575f},
-std::array<float,2>{0.0213959012f, 0.387441307f},
-std::array<float,2>{0.228263468f, 0.802269101f},
-std::array<float,2>{0.975685656f, 0.362505645f},
-std::array<float,2>{0.546567023f, 0.586105049f},
-std::array<float,2>{0.35524106f, 0.236815482f},
-std::array<float,2>{0.282167375f, 0.889960527f},
-std::array<float,2>{0.607330799f, 0.498530537f},
-std::array<float,2>{0.893664658f, 0.659739494f},
-std::array<float,2>{0.13565506f, 0.0245726276f},
-std::array<float,2>{0.110239029f, 0.507407129f},
-std::array<float,2>{0.838378608f, 0.158273578f},
-std::array<float,2>{0.72060734f, 0.837984979f},
-std::array<float,2>{0.489411354f, 0.287062615f},
-std::array<float,2>{0.390850723f, 0.582413614f},
-std::array<float,2>{0.657392681f, 0.24272415f},
-std::array<float,2>{0.784835875f, 0.80474788f},
-std::array<float,2>{0.0410718955f, 0.373657554f},
-std::array<float,2>{0.205271572f, 0.955574036f},
-std::array<float,2>{0.938680291f, 0.377112359f},
-std::array<float,2>{0.503681123f, 0.714692831f},
-std::array<float,2>{0.31501165f, 0.0887371078f},
-std::array<float,2>{0.276567549f, 0.828367352f},
-std::array<float,2>{0.564887047f, 0.2957986f},
-std::array<float,2>{0.921657264f, 0.515024006f},
-std::array<float,2>{0.166077554f, 0.165883213f},
-std::array<float,2>{0.0782242119f, 0.668171108f},
-std::array<float,2>{0.861043572f, 0.0205623545f},
-std::array<float,2>{0.690943778f, 0.880876303f},
-std::array<float,2>{0.44801724f, 0.488345772f},
-std::array<float,2>{0.347309202f, 0.728662252f},
-std::array<float,2>{0.535465181f, 0.107880764f},
-std::array<float,2>{0.977878153f, 0.988213658f},
-std::array<float,2>{0.224526018f, 0.434621483f},
-std::array<float,2>{0.0281968303f, 0.775408745f},
-std::array<float,2>{0.776661456f, 0.333206594f},
-std::array<float,2>{0.634437442f, 0.596592963f},
-std::array<float,2>{0.417937994f, 0.195355639f},
-std::array<float,2>{0.498755366f, 0.916573405f},
-std::array<float,2>{0.730437338f, 0.452694476f},
-std::array<float,2>{0.83293587f, 0.650331616f},
-std::array<float,2>{0.119065471f, 0.0397224762f},
-std::array<float,2>{0.126928255f, 0.532054782f},
-std::array<float,2>{0.905721486f, 0.129890889f},
-std::array<float,2>{0.597058237f, 0.87447083f},
-std::array<float,2>{0.294005811f, 0.253016889f},
-std::array<float,2>{0.310004294f, 0.527078867f},
-std::array<float,2>{0.617910445f, 0.173339769f},
-std::array<float,2>{0.880259037f, 0.812838852f},
-std::array<float,2>{0.150140867f, 0.302248329f},
-std::array<float,2>{0.0958365276f, 0.900509119f},
-std::array<float,2>{0.82010901f, 0.4798235f},
-std::array<float,2>{0.736566126f, 0.67859304f},
-std::array<float,2>{0.47448647f, 0.00110880425f},
-std::array<float,2>{0.42833668f, 0.792298436f},
-std::array<float,2>{0.65570426f, 0.350834221f},
-std::array<float,2>{0.755824924f, 0.57507509f},
-std::array<float,2>{3.66727836e-05f, 0.228521526f},
-std::array<float,2>{0.236235157f, 0.699004769f},
-std::array<float,2>{0.987139702f, 0.0769783854f},
-std::array<float,2>{0.554567158f, 0.951454401f},
-std::array<float,2>{0.370081991f, 0.397512645f},
-std::array<float,2>{0.457677275f, 0.632502735f},
-std::array<float,2>{0.711956501f, 0.0604826808f},
-std::array<float,2>{0.857382119f, 0.931865215f},
-std::array<float,2>{0.0669067502f, 0.466799617f},
-std::array<float,2>{0.177320331f, 0.848588884f},
-std::array<float,2>{0.923440278f, 0.269729704f},
-std::array<float,2>{0.584420562f, 0.549070537f},
-std::array<float,2>{0.259812891f, 0.151372582f},
-std::array<float,2>{0.333552897f, 0.984258652f},
-std::array<float,2>{0.524695516f, 0.409573466f},
-std::array<float,2>{0.956164479f, 0.746264815f},
-std::array<float,2>{0.200642481f, 0.111981176f},
-std::array<float,2>{0.0624805391f, 0.614986122f},
-std::array<float,2>{0.802782714f, 0.206793517f},
-std::array<float,2>{0.680294991f, 0.756673515f},
-std::array<float,2>{0.380260736f, 0.32113114f},
-std::array<float,2>{0.431388736f, 0.507923186f},
-std::array<float,2>{0.642626047f, 0.168333247f},
-std::array<float,2>{0.762223125f, 0.834357798f},
-std::array<float,2>{0.0119770048f, 0.290932238f},
-std::array<float,2>{0.244446114f, 0.87662667f},
-std::array<float,2>{0.995389104f, 0.487661093f},
-std::array<float,2>{0.555310905f, 0.666974902f},
-std::array<float,2>{0.366142988f, 0.0181489978f},
-std::array<float,2>{0.300291538f, 0.811102033f},
-std::array<float,2>{0.610829115f, 0.367969304f},
-std::array<float,2>{0.889982402f, 0.580797076f},
-std::array<float,2>{0.144445881f, 0.249595031f},
-std::array<float,2>{0.103716135f, 0.717381299f},
-std::array<float,2>{0.820810378f, 0.0899662003f},
-std::array<float,2>{0.749292433f, 0.959172666f},
-std::array<float,2>{0.48263219f, 0.37966758f},
-std::array<float,2>{0.3363702f, 0.655344367f},
-std::array<float,2>{0.523177564f, 0.0434051193f},
-std::array<float,2>{0.966259956f, 0.921073318f},
-std::array<float,2>{0.195088834f, 0.447160333f},
-std::array<float,2>{0.047668051f, 0.869629383f},
-std::array<float,2>{0.806483746f, 0.254173726f},
-std::array<float,2>{0.677435279f, 0.538963437f},
-std::array<float,2>{0.386445343f, 0.127620608f},
-std::array<float,2>{0.464638323f, 0.990688086f},
-std::array<float,2>{0.71059525f, 0.430152357f},
-std::array<float,2>{0.843989789f, 0.733464539f},
-std::array<float,2>{0.074442476f, 0.104875237f},
-std::array<float,2>{0.185566753f, 0.597855568f},
-std::array<float,2>{0.936702967f, 0.200986013f},
-std::array<float,2>{0.58875066f, 0.77940166f},
-std::array<float,2>{0.254876047f, 0.328382283f},
-std::array<float,2>{0.266522855f, 0.571155906f},
-std::array<float,2>{0.576816082f, 0.231176808f},
-std::array<float,2>{0.913339019f, 0.796099365f},
-std::array<float,2>{0.163174883f, 0.345254838f},
-std::array<float,2>{0.0889003649f, 0.946878433f},
-std::array<float,2>{0.872958839f, 0.391971111f},
-std::array<float,2>{0.702634454f, 0.699397802f},
-std::array<float,2>{0.438177556f, 0.0715134814f},
-std::array<float,2>{0.402729511f, 0.818486333f},
-std::array<float,2>{0.669280589f, 0.297512472f},
-std::array<float,2>{0.790818334f, 0.527843118f},
-std::array<float,2>{0.0319821313f, 0.178904757f},
-std::array<float,2>{0.21255222f, 0.674196899f},
-std::array<float,2>{0.945364714f, 0.00738809211f},
-std::array<float,2>{0.508839965f, 0.903368413f},
-std::array<float,2>{0.320989817f, 0.481903374f},
-std::array<float,2>{0.487670392f, 0.742827356f},
-std::array<float,2>{0.724736094f, 0.114355102f},
-std::array<float,2>{0.839987397f, 0.978360713f},
-std::array<float,2>{0.114854477f, 0.412353486f},
-std::array<float,2>{0.138938636f, 0.752230048f},
-std::array<float,2>{0.896861315f, 0.32594496f},
-std::array<float,2>{0.603249967f, 0.610387087f},
-std::array<float,2>{0.285374701f, 0.209972367f},
-std::array<float,2>{0.356070578f, 0.935573459f},
-std::array<float,2>{0.541618466f, 0.462905735f},
-std::array<float,2>{0.969491005f, 0.627713144f},
-std::array<float,2>{0.233679935f, 0.0552464686f},
-std::array<float,2>{0.0167756341f, 0.553280175f},
-std::array<float,2>{0.768369734f, 0.152927548f},
-std::array<float,2>{0.632564247f, 0.844405174f},
-std::array<float,2>{0.413050026f, 0.266458124f},
-std::array<float,2>{0.451304376f, 0.62061286f},
-std::array<float,2>{0.692221165f, 0.215687543f},
-std::array<float,2>{0.863383055f, 0.760529041f},
-std::array<float,2>{0.083754696f, 0.316824019f},
-std::array<float,2>{0.168974921f, 0.96887666f},
-std::array<float,2>{0.916365623f, 0.420581222f},
-std::array<float,2>{0.569230616f, 0.740132272f},
-std::array<float,2>{0.277449936f, 0.120595232f},
-std::array<float,2>{0.319117904f, 0.853620768f},
-std::array<float,2>{0.506975889f, 0.279938728f},
-std::array<float,2>{0.941979587f, 0.561817944f},
-std::array<float,2>{0.209483579f, 0.144621149f},
-std::array<float,2>{0.0447831675f, 0.634913981f},
-std::array<float,2>{0.786298156f, 0.0531732291f},
-std::array<float,2>{0.662185073f, 0.926251829f},
-std::array<float,2>{0.397099942f, 0.45898512f},
-std::array<float,2>{0.289483666f, 0.693261206f},
-std::array<float,2>{0.598579466f, 0.0656644404f},
-std::array<float,2>{0.900412142f, 0.942130208f},
-std::array<float,2>{0.130813241f, 0.402222365f},
-std::array<float,2>{0.123009607f, 0.786985099f},
-std::array<float,2>{0.831473172f, 0.357788712f},
-std::array<float,2>{0.731370747f, 0.570084691f},
-std::array<float,2>{0.493037403f, 0.225874022f},
-std::array<float,2>{0.418397844f, 0.893577099f},
-std::array<float,2>{0.637668967f, 0.473864704f},
-std::array<float,2>{0.779387414f, 0.685918748f},
-std::array<float,2>{0.02648836f, 0.0139345946f},
-std::array<float,2>{0.220579505f, 0.522821188f},
-std::array<float,2>{0.981189907f, 0.179872587f},
-std::array<float,2>{0.533159077f, 0.827707946f},
-std::array<float,2>{0.35148102f, 0.30758518f},
-std::array<float,2>{0.372611433f, 0.545068443f},
-std::array<float,2>{0.549226701f, 0.134161726f},
-std::array<float,2>{0.991323173f, 0.865132391f},
-std::array<float,2>{0.240452379f, 0.258286417f},
-std::array<float,2>{0.00604563253f, 0.907911301f},
-std::array<float,2>{0.750693738f, 0.442416668f},
-std::array<float,2>{0.651025057f, 0.642426789f},
-std::array<float,2>{0.423039526f, 0.0316714868f},
-std::array<float,2>{0.470211506f, 0.772413373f},
-std::array<float,2>{0.739522815f, 0.336688548f},
-std::array<float,2>{0.81633848f, 0.602548897f},
-std::array<float,2>{0.0984714255f, 0.191741988f},
-std::array<float,2>{0.155535832f, 0.721782029f},
-std::array<float,2>{0.878584445f, 0.100761496f},
-std::array<float,2>{0.621935725f, 0.999314845f},
-std::array<float,2>{0.307446808f, 0.424025893f},
-std::array<float,2>{0.37865755f, 0.663292885f},
-std::array<float,2>{0.6846205f, 0.0282261427f},
-std::array<float,2>{0.797507405f, 0.883129001f},
-std::array<float,2>{0.0577919632f, 0.495831609f},
-std::array<float,2>{0.198205128f, 0.841497421f},
-std::array<float,2>{0.957430482f, 0.284290522f},
-std::array<float,2>{0.527551174f, 0.503007472f},
-std::array<float,2>{0.331792355f, 0.160992607f},
-std::array<float,2>{0.262073547f, 0.963526964f},
-std::array<float,2>{0.581260324f, 0.384004295f},
-std::array<float,2>{0.928683877f, 0.705742836f},
-std::array<float,2>{0.173620641f, 0.0823748857f},
-std::array<float,2>{0.0633762851f, 0.59107393f},
-std::array<float,2>{0.855238974f, 0.239720389f},
-std::array<float,2>{0.715901613f, 0.79806298f},
-std::array<float,2>{0.453877538f, 0.365415633f},
-std::array<float,2>{0.442737997f, 0.542414963f},
-std::array<float,2>{0.697858989f, 0.138388023f},
-std::array<float,2>{0.87050426f, 0.862578094f},
-std::array<float,2>{0.0900219828f, 0.262301832f},
-std::array<float,2>{0.156594679f, 0.912667632f},
-std::array<float,2>{0.909482896f, 0.440099686f},
-std::array<float,2>{0.571832597f, 0.648168564f},
-std::array<float,2>{0.269687265f, 0.0382280611f},
-std::array<float,2>{0.327143133f, 0.766267836f},
-std::array<float,2>{0.515150368f, 0.340681463f},
-std::array<float,2>{0.951221824f, 0.609297872f},
-std::array<float,2>{0.217778817f, 0.188795477f},
-std::array<float,2>{0.0354073867f, 0.723071456f},
-std::array<float,2>{0.794738114f, 0.0955212265f},
-std::array<float,2>{0.665766537f, 0.993918657f},
-std::array<float,2>{0.400637954f, 0.42578572f},
-std::array<float,2>{0.283548474f, 0.658740878f},
-std::array<float,2>{0.608471096f, 0.0241758954f},
-std::array<float,2>{0.892047465f, 0.888855934f},
-std::array<float,2>{0.132823378f, 0.499282151f},
-std::array<float,2>{0.112314388f, 0.839841664f},
-std::array<float,2>{0.836329162f, 0.285989285f},
-std::array<float,2>{0.722077787f, 0.50676322f},
-std::array<float,2>{0.492108196f, 0.159500688f},
-std::array<float,2>{0.407007724f, 0.965491354f},
-std::array<float,2>{0.627670467f, 0.388634801f},
-std::array<float,2>{0.773164749f, 0.709058762f},
-std::array<float,2>{0.0232370682f, 0.0788958892f},
-std::array<float,2>{0.229390234f, 0.587359011f},
-std::array<float,2>{0.97336179f, 0.237652078f},
-std::array<float,2>{0.543874264f, 0.800850332f},
-std::array<float,2>{0.35179767f, 0.361666828f},
-std::array<float,2>{0.359822363f, 0.624641001f},
-std::array<float,2>{0.560723662f, 0.212529257f},
-std::array<float,2>{0.998359859f, 0.763310969f},
-std::array<float,2>{0.247317836f, 0.315378994f},
-std::array<float,2>{0.0111361137f, 0.97516495f},
-std::array<float,2>{0.758633792f, 0.416049033f},
-std::array<float,2>{0.647578418f, 0.736002803f},
-std::array<float,2>{0.436804622f, 0.123415276f},
-std::array<float,2>{0.476773679f, 0.85714817f},
-std::array<float,2>{0.742371142f, 0.27385208f},
-std::array<float,2>{0.824395835f, 0.556973517f},
-std::array<float,2>{0.107556157f, 0.141635895f},
-std::array<float,2>{0.146516487f, 0.638314426f},
-std::array<float,2>{0.885576427f, 0.0491119325f},
-std::array<float,2>{0.616164804f, 0.923553526f},
-std::array<float,2>{0.303089052f, 0.456158519f},
-std::array<float,2>{0.389757067f, 0.690864563f},
-std::array<float,2>{0.674503028f, 0.0681212693f},
-std::array<float,2>{0.810002804f, 0.938202262f},
-std::array<float,2>{0.0530081615f, 0.402594477f},
-std::array<float,2>{0.190526903f, 0.781365633f},
-std::array<float,2>{0.963796616f, 0.355137289f},
-std::array<float,2>{0.518293321f, 0.563178957f},
-std::array<float,2>{0.341469437f, 0.221114904f},
-std::array<float,2>{0.251684308f, 0.896764696f},
-std::array<float,2>{0.590211093f, 0.470821053f},
-std::array<float,2>{0.932196319f, 0.680251598f},
-std::array<float,2>{0.179989934f, 0.00948800892f},
-std::array<float,2>{0.0714020357f, 0.515772045f},
-std::array<float,2>{0.84946382f, 0.183882535f},
-std::array<float,2>{0.706787527f, 0.821858406f},
-std::array<float,2>{0.466571778f, 0.308624327f},
-std::array<float,2>{0.426353425f, 0.575551689f},
-std::array<float,2>{0.652562559f, 0.230444267f},
-std::array<float,2>{0.75665319f, 0.791332543f},
-std::array<float,2>{0.00361770648f, 0.350546002f},
-std::array<float,2>{0.237417892f, 0.952420771f},
-std::array<float,2>{0.98459208f, 0.39700678f},
-std::array<float,2>{0.552465379f, 0.6980533f},
-std::array<float,2>{0.367312282f, 0.0775330067f},
-std::array<float,2>{0.311845511f, 0.814365089f},
-std::array<float,2>{0.619767487f, 0.300944358f},
-std::array<float,2>{0.882668793f, 0.52579242f},
-std::array<float,2>{0.152120024f, 0.172231182f},
-std::array<float,2>{0.0942308679f, 0.679670393f},
-std::array<float,2>{0.817335427f, 0.000783745549f},
-std::array<float,2>{0.736169279f, 0.902057946f},
-std::array<float,2>{0.475176692f, 0.479431242f},
-std::array<float,2>{0.33411625f, 0.747792661f},
-std::array<float,2>{0.526312888f, 0.112808242f},
-std::array<float,2>{0.954348505f, 0.982555211f},
-std::array<float,2>{0.202993095f, 0.408718854f},
-std::array<float,2>{0.0595393367f, 0.757563472f},
-std::array<float,2>{0.801014423f, 0.322232187f},
-std::array<float,2>{0.683221638f, 0.613501072f},
-std::array<float,2>{0.381251812f, 0.205917165f},
-std::array<float,2>{0.460638374f, 0.932905436f},
-std::array<float,2>{0.713034213f, 0.46856156f},
-std::array<float,2>{0.858705997f, 0.63183558f},
-std::array<float,2>{0.0699036345f, 0.0587222353f},
-std::array<float,2>{0.178002685f, 0.550385892f},
-std::array<float,2>{0.92406857f, 0.15052864f},
-std::array<float,2>{0.582224905f, 0.84872669f},
-std::array<float,2>{0.258883893f, 0.270566911f},
-std::array<float,2>{0.275034487f, 0.51424998f},
-std::array<float,2>{0.563285768f, 0.164773703f},
-std::array<float,2>{0.918435872f, 0.829706073f},
-std::array<float,2>{0.164255589f, 0.296548188f},
-std::array<float,2>{0.0804379731f, 0.882672966f},
-std::array<float,2>{0.861855149f, 0.489588708f},
-std::array<float,2>{0.689065814f, 0.669422984f},
-std::array<float,2>{0.445855975f, 0.0203734953f},
-std::array<float,2>{0.393731087f, 0.806331515f},
-std::array<float,2>{0.659828663f, 0.374284476f},
-std::array<float,2>{0.781393945f, 0.583179593f},
-std::array<float,2>{0.0399876535f, 0.244046047f},
-std::array<float,2>{0.203518361f, 0.713125229f},
-std::array<float,2>{0.940672159f, 0.0891731679f},
-std::array<float,2>{0.501636982f, 0.95670712f},
-std::array<float,2>{0.312953711f, 0.378084093f},
-std::array<float,2>{0.496189922f, 0.64857173f},
-std::array<float,2>{0.727159023f, 0.040169362f},
-std::array<float,2>{0.834363818f, 0.917133152f},
-std::array<float,2>{0.120101191f, 0.45191431f},
-std::array<float,2>{0.12695764f, 0.873799324f},
-std::array<float,2>{0.903841496f, 0.252434134f},
-std::array<float,2>{0.595552802f, 0.532486796f},
-std::array<float,2>{0.295383871f, 0.129503116f},
-std::array<float,2>{0.345375001f, 0.986587286f},
-std::array<float,2>{0.53858f, 0.433728695f},
-std::array<float,2>{0.979404092f, 0.73002702f},
-std::array<float,2>{0.226217777f, 0.108565167f},
-std::array<float,2>{0.0310563799f, 0.59712553f},
-std::array<float,2>{0.774242699f, 0.196428329f},
-std::array<float,2>{0.636483252f, 0.776486397f},
-std::array<float,2>{0.415771306f, 0.33211261f},
-std::array<float,2>{0.404610485f, 0.529226959f},
-std::array<float,2>{0.670576096f, 0.178706199f},
-std::array<float,2>{0.79185003f, 0.819540262f},
-std::array<float,2>{0.0342032537f, 0.298449337f},
-std::array<float,2>{0.213312685f, 0.902542353f},
-std::array<float,2>{0.948955178f, 0.480583698f},
-std::array<float,2>{0.510847092f, 0.675005555f},
-std::array<float,2>{0.323641241f, 0.00612760242f},
-std::array<float,2>{0.26925683f, 0.795890331f},
-std::array<float,2>{0.575384796f, 0.343936354f},
-std::array<float,2>{0.910749257f, 0.572030067f},
-std::array<float,2>{0.160461321f, 0.231908351f},
-std::array<float,2>{0.087021023f, 0.700533867f},
-std::array<float,2>{0.873778999f, 0.0707963407f},
-std::array<float,2>{0.701072216f, 0.945558727f},
-std::array<float,2>{0.440196037f, 0.39153114f},
-std::array<float,2>{0.357564628f, 0.628702939f},
-std::array<float,2>{0.53918308f, 0.0557668246f},
-std::array<float,2>{0.971092045f, 0.936878204f},
-std::array<float,2>{0.231659025f, 0.46413514f},
-std::array<float,2>{0.0188906956f, 0.845283449f},
-std::array<float,2>{0.766100049f, 0.267427474f},
-std::array<float,2>{0.630025566f, 0.554435492f},
-std::array<float,2>{0.410856575f, 0.154205129f},
-std::array<float,2>{0.484923065f, 0.976687491f},
-std::array<float,2>{0.722911596f, 0.41356647f},
-std::array<float,2>{0.843537807f, 0.744106412f},
-std::array<float,2>{0.116721652f, 0.114238508f},
-std::array<float,2>{0.138526514f, 0.610041976f},
-std::array<float,2>{0.895543814f, 0.20957984f},
-std::array<float,2>{0.605398357f, 0.752947688f},
-std::array<float,2>{0.287124008f, 0.324678898f},
-std::array<float,2>{0.297502607f, 0.581337154f},
-std::array<float,2>{0.611507535f, 0.248832583f},
-std::array<float,2>{0.888222277f, 0.812274158f},
-std::array<float,2>{0.142127976f, 0.368667483f},
-std::array<float,2>{0.103250027f, 0.960360348f},
-std::array<float,2>{0.82384789f, 0.38053292f},
-std::array<float,2>{0.747668922f, 0.717972457f},
-std::array<float,2>{0.481430143f, 0.0917924196f},
-std::array<float,2>{0.43250671f, 0.835353553f},
-std::array<float,2>{0.641611934f, 0.289851397f},
-std::array<float,2>{0.764330268f, 0.509061933f},
-std::array<float,2>{0.0148343258f, 0.169704258f},
-std::array<float,2>{0.244072184f, 0.667320311f},
-std::array<float,2>{0.992744148f, 0.0195194539f},
-std::array<float,2>{0.557974339f, 0.875730872f},
-std::array<float,2>{0.364391506f, 0.486703426f},
-std::array<float,2>{0.461622596f, 0.732824504f},
-std::array<float,2>{0.707852781f, 0.103706561f},
-std::array<float,2>{0.846817613f, 0.991862833f},
-std::array<float,2>{0.0767455474f, 0.431233913f},
-std::array<float,2>{0.184823096f, 0.781074822f},
-std::array<float,2>{0.935402572f, 0.329649061f},
-std::array<float,2>{0.586218297f, 0.598797917f},
-std::array<float,2>{0.256136924f, 0.199928492f},
-std::array<float,2>{0.338635921f, 0.920788646f},
-std::array<float,2>{0.519670486f, 0.44596988f},
-std::array<float,2>{0.96811533f, 0.654587686f},
-std::array<float,2>{0.193283021f, 0.0441327654f},
-std::array<float,2>{0.0498077609f, 0.538015068f},
-std::array<float,2>{0.806779325f, 0.128031701f},
-std::array<float,2>{0.679099619f, 0.87047869f},
-std::array<float,2>{0.383398443f, 0.255364776f},
-std::array<float,2>{0.471745223f, 0.601913989f},
-std::array<float,2>{0.741874874f, 0.193066478f},
-std::array<float,2>{0.813473046f, 0.773311794f},
-std::array<float,2>{0.100473307f, 0.337488532f},
-std::array<float,2>{0.153373823f, 0.998227358f},
-std::array<float,2>{0.875596881f, 0.425269693f},
-std::array<float,2>{0.623347878f, 0.721452475f},
-std::array<float,2>{0.306507111f, 0.100344203f},
-std::array<float,2>{0.374057502f, 0.863685906f},
-std::array<float,2>{0.547261357f, 0.259103477f},
-std::array<float,2>{0.989046812f, 0.546310663f},
-std::array<float,2>{0.238424703f, 0.133220047f},
-std::array<float,2>{0.00423802249f, 0.641318679f},
-std::array<float,2>{0.752538979f, 0.0327483565f},
-std::array<float,2>{0.650220394f, 0.906888545f},
-std::array<float,2>{0.425526232f, 0.441858351f},
-std::array<float,2>{0.265322059f, 0.70607239f},
-std::array<float,2>{0.579947054f, 0.0836868137f},
-std::array<float,2>{0.926292539f, 0.964010835f},
-std::array<float,2>{0.174727559f, 0.382877797f},
-std::array<float,2>{0.0663251281f, 0.797321737f},
-std::array<float,2>{0.853091359f, 0.367180556f},
-std::array<float,2>{0.717779517f, 0.590627849f},
-std::array<float,2>{0.455361485f, 0.238599792f},
-std::array<float,2>{0.375911534f, 0.884350061f},
-std::array<float,2>{0.68570441f, 0.494907707f},
-std::array<float,2>{0.800407827f, 0.662587345f},
-std::array<float,2>{0.05604323f, 0.0292336587f},
-std::array<float,2>{0.196300462f, 0.502177596f},
-std::array<float,2>{0.960265398f, 0.161171436f},
-std::array<float,2>{0.529952109f, 0.840385318f},
-std::array<float,2>{0.329309434f, 0.283231109f},
-std::array<float,2>{0.318287581f, 0.560834765f},
-std::array<float,2>{0.505283892f, 0.14610292f},
-std::array<float,2>{0.94481802f, 0.854913175f},
-std::array<float,2>{0.207223475f, 0.280600607f},
-std::array<float,2>{0.0464734659f, 0.927437425f},
-std::array<float,2>{0.78740859f, 0.460875124f},
-std::array<float,2>{0.661661327f, 0.636464238f},
-std::array<float,2>{0.39538461f, 0.0546256378f},
-std::array<float,2>{0.451098949f, 0.761149704f},
-std::array<float,2>{0.693917811f, 0.318250388f},
-std::array<float,2>{0.86659205f, 0.620103478f},
-std::array<float,2>{0.0841353387f, 0.216518462f},
-std::array<float,2>{0.171618596f, 0.738581777f},
-std::array<float,2>{0.91560781f, 0.119294874f},
-std::array<float,2>{0.567627251f, 0.970692158f},
-std::array<float,2>{0.280820072f, 0.421127886f},
-std::array<float,2>{0.420292765f, 0.686873317f},
-std::array<float,2>{0.639546633f, 0.0151405204f},
-std::array<float,2>{0.779195964f, 0.893231452f},
-std::array<float,2>{0.0242194906f, 0.473265558f},
-std::array<float,2>{0.222138971f, 0.826465428f},
-std::array<float,2>{0.984047949f, 0.307790011f},
-std::array<float,2>{0.535002828f, 0.522442698f},
-std::array<float,2>{0.348097682f, 0.181273788f},
-std::array<float,2>{0.291374713f, 0.94320488f},
-std::array<float,2>{0.599654853f, 0.401340395f},
-std::array<float,2>{0.899324834f, 0.69230479f},
-std::array<float,2>{0.130954817f, 0.0653540045f},
-std::array<float,2>{0.124796882f, 0.56844902f},
-std::array<float,2>{0.828966916f, 0.225343302f},
-std::array<float,2>{0.733489335f, 0.785963953f},
-std::array<float,2>{0.496050835f, 0.358466625f},
-std::array<float,2>{0.488555104f, 0.50444448f},
-std::array<float,2>{0.71876812f, 0.156362668f},
-std::array<float,2>{0.839663625f, 0.837425947f},
-std::array<float,2>{0.111060642f, 0.288745582f},
-std::array<float,2>{0.136349738f, 0.887900531f},
-std::array<float,2>{0.89278245f, 0.497752696f},
-std::array<float,2>{0.60597378f, 0.657247305f},
-std::array<float,2>{0.282514006f, 0.0255205575f},
-std::array<float,2>{0.353942782f, 0.804260254f},
-std::array<float,2>{0.545454562f, 0.359520584f},
-std::array<float,2>{0.974758983f, 0.589482486f},
-std::array<float,2>{0.226668537f, 0.23534742f},
-std::array<float,2>{0.0202508196f, 0.708901346f},
-std::array<float,2>{0.770333886f, 0.0800988972f},
-std::array<float,2>{0.625390708f, 0.967427015f},
-std::array<float,2>{0.409012794f, 0.388910502f},
-std::array<float,2>{0.273375213f, 0.645268023f},
-std::array<float,2>{0.573635161f, 0.0353248343f},
-std::array<float,2>{0.906772673f, 0.911336482f},
-std::array<float,2>{0.159440085f, 0.439210296f},
-std::array<float,2>{0.0919098631f, 0.861032486f},
-std::array<float,2>{0.867791414f, 0.263985842f},
-std::array<float,2>{0.695845246f, 0.539424539f},
-std::array<float,2>{0.444255918f, 0.139402121f},
-std::array<float,2>{0.398617685f, 0.996061563f},
-std::array<float,2>{0.666193128f, 0.427897364f},
-std::array<float,2>{0.796415627f, 0.72524935f},
-std::array<float,2>{0.0378050618f, 0.0958360434f},
-std::array<float,2>{0.216275379f, 0.605616212f},
-std::array<float,2>{0.949745536f, 0.190144762f},
-std::array<float,2>{0.512268424f, 0.769418478f},
-std::array<float,2>{0.324883729f, 0.343067169f},
-std::array<float,2>{0.342101783f, 0.5657354f},
-std::array<float,2>{0.51749289f, 0.21909295f},
-std::array<float,2>{0.961421788f, 0.784092665f},
-std::array<float,2>{0.188147739f, 0.352260679f},
-std::array<float,2>{0.0513324775f, 0.94122088f},
-std::array<float,2>{0.810977876f, 0.405973107f},
-std::array<float,2>{0.673780143f, 0.689418614f},
-std::array<float,2>{0.386908054f, 0.0683751851f},
-std::array<float,2>{0.467596799f, 0.823972225f},
-std::array<float,2>{0.703461051f, 0.312022239f},
-std::array<float,2>{0.850769401f, 0.517657757f},
-std::array<float,2>{0.0738249868f, 0.186401591f},
-std::array<float,2>{0.18259123f, 0.682001472f},
-std::array<float,2>{0.929728568f, 0.0103882533f},
-std::array<float,2>{0.592093825f, 0.895037174f},
-std::array<float,2>{0.252138466f, 0.470018744f},
-std::array<float,2>{0.434509784f, 0.737158656f},
-std::array<float,2>{0.645373046f, 0.121610783f},
-std::array<float,2>{0.761339843f, 0.974391818f},
-std::array<float,2>{0.00804079231f, 0.41525802f},
-std::array<float,2>{0.248724163f, 0.764751732f},
-std::array<float,2>{0.997279167f, 0.313041002f},
-std::array<float,2>{0.559011161f, 0.6214782f},
-std::array<float,2>{0.362769544f, 0.214220017f},
-std::array<float,2>{0.301246256f, 0.924350321f},
-std::array<float,2>{0.613514781f, 0.454524577f},
-std::array<float,2>{0.88474983f, 0.640118062f},
-std::array<float,2>{0.145559743f, 0.0474038757f},
-std::array<float,2>{0.106521606f, 0.555209875f},
-std::array<float,2>{0.827871978f, 0.144218713f},
-std::array<float,2>{0.745185971f, 0.858232617f},
-std::array<float,2>{0.479775012f, 0.276479542f},
-std::array<float,2>{0.37958914f, 0.615682542f},
-std::array<float,2>{0.680984318f, 0.203164622f},
-std::array<float,2>{0.804512262f, 0.755589366f},
-std::array<float,2>{0.0605917387f, 0.323428214f},
-std::array<float,2>{0.199760273f, 0.980633616f},
-std::array<float,2>{0.955684483f, 0.407550395f},
-std::array<float,2>{0.524258673f, 0.749699831f},
-std::array<float,2>{0.332413644f, 0.110629804f},
-std::array<float,2>{0.261263281f, 0.849941075f},
-std::array<float,2>{0.585829079f, 0.271745265f},
-std::array<float,2>{0.922478497f, 0.547814012f},
-std::array<float,2>{0.176317856f, 0.149824262f},
-std::array<float,2>{0.0679944754f, 0.629676342f},
-std::array<float,2>{0.855538547f, 0.0620196164f},
-std::array<float,2>{0.711591959f, 0.930430532f},
-std::array<float,2>{0.458199024f, 0.46611017f},
-std::array<float,2>{0.370830417f, 0.695357323f},
-std::array<float,2>{0.553582549f, 0.0752244592f},
-std::array<float,2>{0.987457514f, 0.950298607f},
-std::array<float,2>{0.234583393f, 0.39497453f},
-std::array<float,2>{0.00169828767f, 0.790974319f},
-std::array<float,2>{0.754441082f, 0.348668277f},
-std::array<float,2>{0.654726624f, 0.577872932f},
-std::array<float,2>{0.429516941f, 0.228070736f},
-std::array<float,2>{0.473209053f, 0.899915755f},
-std::array<float,2>{0.737496734f, 0.478039891f},
-std::array<float,2>{0.818991363f, 0.676878035f},
-std::array<float,2>{0.0971796736f, 0.00238279579f},
-std::array<float,2>{0.148620784f, 0.523681223f},
-std::array<float,2>{0.879190624f, 0.174784362f},
-std::array<float,2>{0.61912632f, 0.816176951f},
-std::array<float,2>{0.308734834f, 0.304353684f},
-std::array<float,2>{0.293928295f, 0.533914983f},
-std::array<float,2>{0.595745385f, 0.132233694f},
-std::array<float,2>{0.904992521f, 0.871685863f},
-std::array<float,2>{0.125055268f, 0.251128942f},
-std::array<float,2>{0.11746487f, 0.915616393f},
-std::array<float,2>{0.833972692f, 0.450163245f},
-std::array<float,2>{0.729292452f, 0.650435209f},
-std::array<float,2>{0.499143839f, 0.0421407335f},
-std::array<float,2>{0.416889101f, 0.773865402f},
-std::array<float,2>{0.633429825f, 0.335215986f},
-std::array<float,2>{0.775983572f, 0.594628632f},
-std::array<float,2>{0.0289748553f, 0.197530076f},
-std::array<float,2>{0.223596796f, 0.728096426f},
-std::array<float,2>{0.977204144f, 0.106871575f},
-std::array<float,2>{0.536992311f, 0.985880077f},
-std::array<float,2>{0.345932037f, 0.436662287f},
-std::array<float,2>{0.448419631f, 0.671363175f},
-std::array<float,2>{0.689464688f, 0.0232123639f},
-std::array<float,2>{0.860153258f, 0.880081117f},
-std::array<float,2>{0.0791822076f, 0.491429597f},
-std::array<float,2>{0.16718702f, 0.830581307f},
-std::array<float,2>{0.920474052f, 0.293008566f},
-std::array<float,2>{0.566239536f, 0.513649106f},
-std::array<float,2>{0.275556087f, 0.16627726f},
-std::array<float,2>{0.316224277f, 0.954166949f},
-std::array<float,2>{0.502830148f, 0.376906246f},
-std::array<float,2>{0.938135564f, 0.712035418f},
-std::array<float,2>{0.206660867f, 0.0878885463f},
-std::array<float,2>{0.042717956f, 0.58592844f},
-std::array<float,2>{0.783897996f, 0.244418949f},
-std::array<float,2>{0.656598032f, 0.806730986f},
-std::array<float,2>{0.391680241f, 0.372037649f},
-std::array<float,2>{0.41396454f, 0.552382112f},
-std::array<float,2>{0.631592989f, 0.155152678f},
-std::array<float,2>{0.76944524f, 0.846621037f},
-std::array<float,2>{0.0163681675f, 0.268474787f},
-std::array<float,2>{0.233207956f, 0.935492992f},
-std::array<float,2>{0.970518053f, 0.462743938f},
-std::array<float,2>{0.542374253f, 0.626115143f},
-std::array<float,2>{0.357277155f, 0.0582188219f},
-std::array<float,2>{0.286901474f, 0.751880348f},
-std::array<float,2>{0.60204047f, 0.327397078f},
-std::array<float,2>{0.897731006f, 0.612350166f},
-std::array<float,2>{0.140389964f, 0.207508579f},
-std::array<float,2>{0.113889828f, 0.745586693f},
-std::array<float,2>{0.841759086f, 0.115335763f},
-std::array<float,2>{0.725816667f, 0.979811013f},
-std::array<float,2>{0.486685812f, 0.412021011f},
-std::array<float,2>{0.32141149f, 0.673339188f},
-std::array<float,2>{0.507954359f, 0.00458680093f},
-std::array<float,2>{0.946776688f, 0.905021131f},
-std::array<float,2>{0.211322621f, 0.483552456f},
-std::array<float,2>{0.0329026915f, 0.81784904f},
-std::array<float,2>{0.789143026f, 0.300120801f},
-std::array<float,2>{0.668909609f, 0.530276597f},
-std::array<float,2>{0.404211611f, 0.176844761f},
-std::array<float,2>{0.439417779f, 0.948881507f},
-std::array<float,2>{0.702081203f, 0.39377895f},
-std::array<float,2>{0.871283054f, 0.702122927f},
-std::array<float,2>{0.0884905457f, 0.0736472681f},
-std::array<float,2>{0.162877366f, 0.57389456f},
-std::array<float,2>{0.912988067f, 0.234258085f},
-std::array<float,2>{0.577164888f, 0.794013977f},
-std::array<float,2>{0.266884446f, 0.346471608f},
-std::array<float,2>{0.255158722f, 0.60128063f},
-std::array<float,2>{0.589808404f, 0.202510074f},
-std::array<float,2>{0.935596108f, 0.778809011f},
-std::array<float,2>{0.186559737f, 0.330597162f},
-std::array<float,2>{0.0757067353f, 0.989911914f},
-std::array<float,2>{0.84520793f, 0.43195647f},
-std::array<float,2>{0.709298432f, 0.732366264f},
-std::array<float,2>{0.463080943f, 0.102068529f},
-std::array<float,2>{0.385459661f, 0.867957711f},
-std::array<float,2>{0.676684856f, 0.256669879f},
-std::array<float,2>{0.805650592f, 0.53566432f},
-std::array<float,2>{0.0481155366f, 0.126022205f},
-std::array<float,2>{0.194006786f, 0.652559161f},
-std::array<float,2>{0.965202451f, 0.0453175195f},
-std::array<float,2>{0.522167504f, 0.918944776f},
-std::array<float,2>{0.337769091f, 0.448022276f},
-std::array<float,2>{0.483920157f, 0.715241969f},
-std::array<float,2>{0.748302341f, 0.0921795741f},
-std::array<float,2>{0.821309268f, 0.958411157f},
-std::array<float,2>{0.105259567f, 0.382383496f},
-std::array<float,2>{0.142884448f, 0.808928847f},
-std::array<float,2>{0.889319122f, 0.370965481f},
-std::array<float,2>{0.609496355f, 0.578456163f},
-std::array<float,2>{0.298989177f, 0.247975484f},
-std::array<float,2>{0.367073447f, 0.878146648f},
-std::array<float,2>{0.556043684f, 0.485710949f},
-std::array<float,2>{0.99456352f, 0.665523946f},
-std::array<float,2>{0.245670319f, 0.0165561456f},
-std::array<float,2>{0.0130432975f, 0.51004827f},
-std::array<float,2>{0.763135195f, 0.170090064f},
-std::array<float,2>{0.643759072f, 0.832650721f},
-std::array<float,2>{0.430540621f, 0.29114449f},
-std::array<float,2>{0.45428285f, 0.592974901f},
-std::array<float,2>{0.715722799f, 0.240478486f},
-std::array<float,2>{0.854197621f, 0.800459266f},
-std::array<float,2>{0.0642437115f, 0.364450634f},
-std::array<float,2>{0.172213316f, 0.961688638f},
-std::array<float,2>{0.929306865f, 0.385147542f},
-std::array<float,2>{0.58084774f, 0.703417897f},
-std::array<float,2>{0.263480097f, 0.0843592882f},
-std::array<float,2>{0.33085987f, 0.842882752f},
-std::array<float,2>{0.528484404f, 0.282740086f},
-std::array<float,2>{0.95841217f, 0.501808226f},
-std::array<float,2>{0.198994488f, 0.162518874f},
-std::array<float,2>{0.0567675084f, 0.661666811f},
-std::array<float,2>{0.798181891f, 0.0304668155f},
-std::array<float,2>{0.683812439f, 0.885269165f},
-std::array<float,2>{0.37723133f, 0.493108153f},
-std::array<float,2>{0.307869941f, 0.720238805f},
-std::array<float,2>{0.622343838f, 0.0992973f},
-std::array<float,2>{0.877223551f, 0.997316658f},
-std::array<float,2>{0.154384971f, 0.421926141f},
-std::array<float,2>{0.0995432436f, 0.769579232f},
-std::array<float,2>{0.815310657f, 0.339032292f},
-std::array<float,2>{0.738882303f, 0.604176879f},
-std::array<float,2>{0.469121844f, 0.193570092f},
-std::array<float,2>{0.422044337f, 0.910086334f},
-std::array<float,2>{0.652237713f, 0.44375658f},
-std::array<float,2>{0.751018047f, 0.644014835f},
-std::array<float,2>{0.00726969028f, 0.0342846736f},
-std::array<float,2>{0.241604224f, 0.54410404f},
-std::array<float,2>{0.990746319f, 0.134797052f},
-std::array<float,2>{0.550352991f, 0.866787314f},
-std::array<float,2>{0.371335804f, 0.261252671f},
-std::array<float,2>{0.349888325f, 0.520514488f},
-std::array<float,2>{0.531805933f, 0.182393193f},
-std::array<float,2>{0.981693923f, 0.824261248f},
-std::array<float,2>{0.219420716f, 0.305673391f},
-std::array<float,2>{0.0263586622f, 0.891838551f},
-std::array<float,2>{0.781154513f, 0.475410074f},
-std::array<float,2>{0.63854146f, 0.685241044f},
-std::array<float,2>{0.419850081f, 0.0132349087f},
-std::array<float,2>{0.494115889f, 0.787946403f},
-std::array<float,2>{0.731473982f, 0.356217861f},
-std::array<float,2>{0.830929995f, 0.56671083f},
-std::array<float,2>{0.121307261f, 0.224309832f},
-std::array<float,2>{0.129280999f, 0.695126116f},
-std::array<float,2>{0.902252853f, 0.0636857972f},
-std::array<float,2>{0.599045038f, 0.943952084f},
-std::array<float,2>{0.290681571f, 0.400262147f},
-std::array<float,2>{0.397738636f, 0.633053362f},
-std::array<float,2>{0.66367358f, 0.0514793769f},
-std::array<float,2>{0.78523463f, 0.927938163f},
-std::array<float,2>{0.0437259376f, 0.457115114f},
-std::array<float,2>{0.210736126f, 0.851819634f},
-std::array<float,2>{0.942793548f, 0.278199673f},
-std::array<float,2>{0.506560624f, 0.558709741f},
-std::array<float,2>{0.320097506f, 0.14789103f},
-std::array<float,2>{0.278979063f, 0.972008228f},
-std::array<float,2>{0.569677055f, 0.418041945f},
-std::array<float,2>{0.917164445f, 0.741775811f},
-std::array<float,2>{0.168787077f, 0.118870534f},
-std::array<float,2>{0.0829470828f, 0.618627787f},
-std::array<float,2>{0.86443454f, 0.21708937f},
-std::array<float,2>{0.693001032f, 0.759259224f},
-std::array<float,2>{0.452747166f, 0.318837732f},
-std::array<float,2>{0.456181169f, 0.501575351f},
-std::array<float,2>{0.717771292f, 0.162275314f},
-std::array<float,2>{0.8521415f, 0.843214154f},
-std::array<float,2>{0.0646495074f, 0.282985926f},
-std::array<float,2>{0.175637111f, 0.885659516f},
-std::array<float,2>{0.926974595f, 0.492813557f},
-std::array<float,2>{0.578354359f, 0.661947906f},
-std::array<float,2>{0.264464557f, 0.0307341497f},
-std::array<float,2>{0.328783661f, 0.800637841f},
-std::array<float,2>{0.531013429f, 0.364741325f},
-std::array<float,2>{0.959302306f, 0.593046784f},
-std::array<float,2>{0.195844725f, 0.240560725f},
-std::array<float,2>{0.0550007857f, 0.703146338f},
-std::array<float,2>{0.798945546f, 0.0842007995f},
-std::array<float,2>{0.68710041f, 0.961629927f},
-std::array<float,2>{0.376285493f, 0.384930909f},
-std::array<float,2>{0.305621892f, 0.643661916f},
-std::array<float,2>{0.624102712f, 0.0345842727f},
-std::array<float,2>{0.876088202f, 0.909885108f},
-std::array<float,2>{0.152866483f, 0.443372935f},
-std::array<float,2>{0.101509579f, 0.867092907f},
-std::array<float,2>{0.814120114f, 0.261630893f},
-std::array<float,2>{0.741031289f, 0.54434526f},
-std::array<float,2>{0.470885724f, 0.135086268f},
-std::array<float,2>{0.424189299f, 0.997235358f},
-std::array<float,2>{0.649209559f, 0.422188848f},
-std::array<float,2>{0.753289163f, 0.72048533f},
-std::array<float,2>{0.00519184023f, 0.0995921716f},
-std::array<float,2>{0.23938331f, 0.604399204f},
-std::array<float,2>{0.990061522f, 0.193736136f},
-std::array<float,2>{0.548483074f, 0.769863129f},
-std::array<float,2>{0.373394102f, 0.339134365f},
-std::array<float,2>{0.348825157f, 0.566455126f},
-std::array<float,2>{0.533554673f, 0.224552631f},
-std::array<float,2>{0.982477307f, 0.787662446f},
-std::array<float,2>{0.221185043f, 0.356183708f},
-std::array<float,2>{0.025073383f, 0.944192946f},
-std::array<float,2>{0.778053343f, 0.40007925f},
-std::array<float,2>{0.640073001f, 0.694925129f},
-std::array<float,2>{0.421738923f, 0.0638347939f},
-std::array<float,2>{0.49464339f, 0.824626386f},
-std::array<float,2>{0.732434452f, 0.30608803f},
-std::array<float,2>{0.829278529f, 0.520860076f},
-std::array<float,2>{0.123331495f, 0.182196736f},
-std::array<float,2>{0.132615536f, 0.685467184f},
-std::array<float,2>{0.899673343f, 0.0136061693f},
-std::array<float,2>{0.60072273f, 0.892076433f},
-std::array<float,2>{0.292077422f, 0.475136638f},
-std::array<float,2>{0.395927131f, 0.742170215f},
-std::array<float,2>{0.66113168f, 0.118904702f},
-std::array<float,2>{0.788833499f, 0.971772552f},
-std::array<float,2>{0.0456623062f, 0.418213874f},
-std::array<float,2>{0.208122328f, 0.758922338f},
-std::array<float,2>{0.943686128f, 0.318602443f},
-std::array<float,2>{0.504522502f, 0.618180275f},
-std::array<float,2>{0.31690377f, 0.216903403f},
-std::array<float,2>{0.280226678f, 0.928032637f},
-std::array<float,2>{0.567071557f, 0.457414269f},
-std::array<float,2>{0.914087892f, 0.633180976f},
-std::array<float,2>{0.170604303f, 0.0516803078f},
-std::array<float,2>{0.0853969678f, 0.55890739f},
-std::array<float,2>{0.866052568f, 0.14763841f},
-std::array<float,2>{0.695127189f, 0.85169673f},
-std::array<float,2>{0.449433357f, 0.277832121f},
-std::array<float,2>{0.411421448f, 0.612608135f},
-std::array<float,2>{0.629226804f, 0.207086727f},
-std::array<float,2>{0.767018318f, 0.75163579f},
-std::array<float,2>{0.0184927378f, 0.327183336f},
-std::array<float,2>{0.23111923f, 0.979730189f},
-std::array<float,2>{0.971768558f, 0.411729544f},
-std::array<float,2>{0.540496111f, 0.745311797f},
-std::array<float,2>{0.359222323f, 0.115623698f},
-std::array<float,2>{0.288558632f, 0.846404314f},
-std::array<float,2>{0.603815973f, 0.268153578f},
-std::array<float,2>{0.894797862f, 0.552651525f},
-std::array<float,2>{0.136755243f, 0.154903695f},
-std::array<float,2>{0.115869224f, 0.626402855f},
-std::array<float,2>{0.842101336f, 0.0583816245f},
-std::array<float,2>{0.724038064f, 0.935293853f},
-std::array<float,2>{0.485471338f, 0.462583423f},
-std::array<float,2>{0.322977364f, 0.701730251f},
-std::array<float,2>{0.510559738f, 0.0732804015f},
-std::array<float,2>{0.947981894f, 0.949068248f},
-std::array<float,2>{0.214247271f, 0.393881351f},
-std::array<float,2>{0.0341507792f, 0.794321775f},
-std::array<float,2>{0.792879641f, 0.346208602f},
-std::array<float,2>{0.671765685f, 0.574160635f},
-std::array<float,2>{0.406159312f, 0.234048784f},
-std::array<float,2>{0.441387743f, 0.905082226f},
-std::array<float,2>{0.699889481f, 0.483844668f},
-std::array<float,2>{0.874944448f, 0.672853231f},
-std::array<float,2>{0.0859865099f, 0.00468496187f},
-std::array<float,2>{0.161689162f, 0.53060472f},
-std::array<float,2>{0.911958039f, 0.177072555f},
-std::array<float,2>{0.574368358f, 0.81745553f},
-std::array<float,2>{0.268107086f, 0.299884975f},
-std::array<float,2>{0.256861448f, 0.536089778f},
-std::array<float,2>{0.587378323f, 0.126320824f},
-std::array<float,2>{0.934061825f, 0.867687583f},
-std::array<float,2>{0.184289634f, 0.256549299f},
-std::array<float,2>{0.0778464451f, 0.918634772f},
-std::array<float,2>{0.846080184f, 0.44790858f},
-std::array<float,2>{0.708188713f, 0.652633846f},
-std::array<float,2>{0.461946756f, 0.0451527797f},
-std::array<float,2>{0.383921087f, 0.77920121f},
-std::array<float,2>{0.678189278f, 0.330826908f},
-std::array<float,2>{0.808308601f, 0.601434529f},
-std::array<float,2>{0.049172543f, 0.202220947f},
-std::array<float,2>{0.192103222f, 0.732096732f},
-std::array<float,2>{0.966803789f, 0.102402017f},
-std::array<float,2>{0.520968914f, 0.990046144f},
-std::array<float,2>{0.339734346f, 0.431826085f},
-std::array<float,2>{0.482383162f, 0.665236592f},
-std::array<float,2>{0.746474862f, 0.0162683241f},
-std::array<float,2>{0.82229948f, 0.878277481f},
-std::array<float,2>{0.102270603f, 0.485581696f},
-std::array<float,2>{0.141507387f, 0.832888961f},
-std::array<float,2>{0.887429893f, 0.291353345f},
-std::array<float,2>{0.612412214f, 0.509847522f},
-std::array<float,2>{0.297939181f, 0.170180634f},
-std::array<float,2>{0.36388433f, 0.958071947f},
-std::array<float,2>{0.557012379f, 0.382713467f},
-std::array<float,2>{0.993451178f, 0.714978456f},
-std::array<float,2>{0.243137792f, 0.091824837f},
-std::array<float,2>{0.0145058967f, 0.578163683f},
-std::array<float,2>{0.765575647f, 0.247776315f},
-std::array<float,2>{0.641034126f, 0.808714986f},
-std::array<float,2>{0.432824641f, 0.370762199f},
-std::array<float,2>{0.382602066f, 0.547405303f},
-std::array<float,2>{0.68236804f, 0.149493888f},
-std::array<float,2>{0.801879168f, 0.849705517f},
-std::array<float,2>{0.0599713549f, 0.27165845f},
-std::array<float,2>{0.201551124f, 0.930252731f},
-std::array<float,2>{0.953456819f, 0.465851009f},
-std::array<float,2>{0.527067125f, 0.629542589f},
-std::array<float,2>{0.33589527f, 0.0623545945f},
-std::array<float,2>{0.258570552f, 0.755810976f},
-std::array<float,2>{0.583118916f, 0.323680311f},
-std::array<float,2>{0.925753474f, 0.615253627f},
-std::array<float,2>{0.178896204f, 0.20346956f},
-std::array<float,2>{0.0689583644f, 0.74982667f},
-std::array<float,2>{0.857591927f, 0.110515952f},
-std::array<float,2>{0.714334249f, 0.980888486f},
-std::array<float,2>{0.459783942f, 0.407323182f},
-std::array<float,2>{0.368622899f, 0.677181542f},
-std::array<float,2>{0.55088222f, 0.00209948979f},
-std::array<float,2>{0.985973775f, 0.900286853f},
-std::array<float,2>{0.236920446f, 0.478338987f},
-std::array<float,2>{0.00292217056f, 0.816046059f},
-std::array<float,2>{0.756844401f, 0.304562896f},
-std::array<float,2>{0.653765142f, 0.523698092f},
-std::array<float,2>{0.427532703f, 0.174370676f},
-std::array<float,2>{0.476411015f, 0.950578153f},
-std::array<float,2>{0.734663069f, 0.394556046f},
-std::array<float,2>{0.817589879f, 0.69566679f},
-std::array<float,2>{0.0949340686f, 0.0756610036f},
-std::array<float,2>{0.151172802f, 0.57805711f},
-std::array<float,2>{0.881499052f, 0.228400782f},
-std::array<float,2>{0.620184004f, 0.790702999f},
-std::array<float,2>{0.31129685f, 0.349061519f},
-std::array<float,2>{0.296012223f, 0.594244897f},
-std::array<float,2>{0.593910813f, 0.197390348f},
-std::array<float,2>{0.902787864f, 0.773469567f},
-std::array<float,2>{0.128887415f, 0.335020065f},
-std::array<float,2>{0.120421626f, 0.986223161f},
-std::array<float,2>{0.835789263f, 0.436906785f},
-std::array<float,2>{0.72796756f, 0.728272915f},
-std::array<float,2>{0.497632772f, 0.106585763f},
-std::array<float,2>{0.41431725f, 0.871861875f},
-std::array<float,2>{0.634836316f, 0.251442701f},
-std::array<float,2>{0.775042474f, 0.533988714f},
-std::array<float,2>{0.0300750975f, 0.132045269f},
-std::array<float,2>{0.225561574f, 0.650704563f},
-std::array<float,2>{0.979543805f, 0.0423609316f},
-std::array<float,2>{0.537581503f, 0.915876031f},
-std::array<float,2>{0.344070286f, 0.449803799f},
-std::array<float,2>{0.446871698f, 0.712210894f},
-std::array<float,2>{0.687653244f, 0.0875685364f},
-std::array<float,2>{0.8626436f, 0.954546094f},
-std::array<float,2>{0.0813807994f, 0.376641005f},
-std::array<float,2>{0.165762201f, 0.80711019f},
-std::array<float,2>{0.919759154f, 0.371692687f},
-std::array<float,2>{0.563710868f, 0.585627437f},
-std::array<float,2>{0.273868322f, 0.244231194f},
-std::array<float,2>{0.314049214f, 0.880332172f},
-std::array<float,2>{0.500369251f, 0.491673589f},
-std::array<float,2>{0.940188706f, 0.671109676f},
-std::array<float,2>{0.204818755f, 0.02303789f},
-std::array<float,2>{0.0409361087f, 0.513200939f},
-std::array<float,2>{0.782731891f, 0.166078582f},
-std::array<float,2>{0.658616662f, 0.83094275f},
-std::array<float,2>{0.393422484f, 0.293412924f},
-std::array<float,2>{0.490245312f, 0.589635253f},
-std::array<float,2>{0.720955253f, 0.235033348f},
-std::array<float,2>{0.837746143f, 0.804475069f},
-std::array<float,2>{0.111363731f, 0.359798312f},
-std::array<float,2>{0.134057164f, 0.967640936f},
-std::array<float,2>{0.891300142f, 0.389123887f},
-std::array<float,2>{0.608110309f, 0.708510399f},
-std::array<float,2>{0.284723759f, 0.080529049f},
-std::array<float,2>{0.353079915f, 0.83780849f},
-std::array<float,2>{0.544161916f, 0.289054751f},
-std::array<float,2>{0.973732293f, 0.504644334f},
-std::array<float,2>{0.230088159f, 0.156595305f},
-std::array<float,2>{0.0219779052f, 0.657674611f},
-std::array<float,2>{0.772420585f, 0.0258235782f},
-std::array<float,2>{0.628138125f, 0.888017654f},
-std::array<float,2>{0.407687396f, 0.497854024f},
-std::array<float,2>{0.270714998f, 0.725412726f},
-std::array<float,2>{0.571160793f, 0.0960175246f},
-std::array<float,2>{0.908439994f, 0.995639026f},
-std::array<float,2>{0.157930508f, 0.428021729f},
-std::array<float,2>{0.0909664631f, 0.769102752f},
-std::array<float,2>{0.869149685f, 0.34292534f},
-std::array<float,2>{0.698922873f, 0.605794489f},
-std::array<float,2>{0.441537499f, 0.190392956f},
-std::array<float,2>{0.401498526f, 0.911530375f},
-std::array<float,2>{0.664394617f, 0.439193517f},
-std::array<float,2>{0.793072224f, 0.645140052f},
-std::array<float,2>{0.036980994f, 0.03561683f},
-std::array<float,2>{0.217466637f, 0.539140701f},
-std::array<float,2>{0.952329636f, 0.139433965f},
-std::array<float,2>{0.514404416f, 0.861150384f},
-std::array<float,2>{0.327156037f, 0.263850033f},
-std::array<float,2>{0.340361416f, 0.517910719f},
-std::array<float,2>{0.518982887f, 0.186259136f},
-std::array<float,2>{0.963947594f, 0.824038029f},
-std::array<float,2>{0.18951726f, 0.312309802f},
-std::array<float,2>{0.0542746149f, 0.89540422f},
-std::array<float,2>{0.808988094f, 0.469816118f},
-std::array<float,2>{0.674909711f, 0.681860626f},
-std::array<float,2>{0.388676405f, 0.0105677461f},
-std::array<float,2>{0.465131134f, 0.783726335f},
-std::array<float,2>{0.705357492f, 0.352472156f},
-std::array<float,2>{0.847956419f, 0.565492094f},
-std::array<float,2>{0.0710436478f, 0.218889743f},
-std::array<float,2>{0.181254089f, 0.689080358f},
-std::array<float,2>{0.933133841f, 0.0688216165f},
-std::array<float,2>{0.590914428f, 0.941039443f},
-std::array<float,2>{0.250118792f, 0.406202376f},
-std::array<float,2>{0.436211586f, 0.63967073f},
-std::array<float,2>{0.646519303f, 0.0477859378f},
-std::array<float,2>{0.758800089f, 0.924753249f},
-std::array<float,2>{0.00993105583f, 0.454308599f},
-std::array<float,2>{0.246734604f, 0.858138561f},
-std::array<float,2>{0.999062896f, 0.276752442f},
-std::array<float,2>{0.561755955f, 0.555617809f},
-std::array<float,2>{0.360675186f, 0.144468293f},
-std::array<float,2>{0.304497391f, 0.974295974f},
-std::array<float,2>{0.616346836f, 0.41539675f},
-std::array<float,2>{0.886686504f, 0.736997426f},
-std::array<float,2>{0.148058429f, 0.121944338f},
-std::array<float,2>{0.109337099f, 0.62114197f},
-std::array<float,2>{0.825865626f, 0.214103431f},
-std::array<float,2>{0.743830442f, 0.764893472f},
-std::array<float,2>{0.477959275f, 0.313428372f},
-std::array<float,2>{0.470255733f, 0.545921743f},
-std::array<float,2>{0.740208209f, 0.133009538f},
-std::array<float,2>{0.815822244f, 0.863402367f},
-std::array<float,2>{0.0977949873f, 0.258808404f},
-std::array<float,2>{0.155987173f, 0.907037735f},
-std::array<float,2>{0.878155351f, 0.441412479f},
-std::array<float,2>{0.62114656f, 0.641377389f},
-std::array<float,2>{0.30687502f, 0.0329832248f},
-std::array<float,2>{0.372202307f, 0.773126662f},
-std::array<float,2>{0.549381495f, 0.337830484f},
-std::array<float,2>{0.992058516f, 0.601592839f},
-std::array<float,2>{0.240729779f, 0.193309888f},
-std::array<float,2>{0.00656426046f, 0.721324205f},
-std::array<float,2>{0.750449002f, 0.100128628f},
-std::array<float,2>{0.650610685f, 0.998357356f},
-std::array<float,2>{0.423475713f, 0.425023109f},
-std::array<float,2>{0.262406856f, 0.662264466f},
-std::array<float,2>{0.581789553f, 0.0288917646f},
-std::array<float,2>{0.928195298f, 0.884538352f},
-std::array<float,2>{0.173169509f, 0.494861662f},
-std::array<float,2>{0.0628855228f, 0.840592682f},
-std::array<float,2>{0.85464555f, 0.283656299f},
-std::array<float,2>{0.716413379f, 0.502424061f},
-std::array<float,2>{0.453312457f, 0.161494568f},
-std::array<float,2>{0.377987176f, 0.964271724f},
-std::array<float,2>{0.685497642f, 0.383083791f},
-std::array<float,2>{0.797250271f, 0.706418753f},
-std::array<float,2>{0.0584524795f, 0.0839535892f},
-std::array<float,2>{0.197417259f, 0.590572f},
-std::array<float,2>{0.957728624f, 0.238454893f},
-std::array<float,2>{0.527890563f, 0.796946704f},
-std::array<float,2>{0.331343651f, 0.36688152f},
-std::array<float,2>{0.318486184f, 0.619763315f},
-std::array<float,2>{0.507412255f, 0.216740176f},
-std::array<float,2>{0.941616535f, 0.760892987f},
-std::array<float,2>{0.209276497f, 0.317951977f},
-std::array<float,2>{0.0440124162f, 0.970415235f},
-std::array<float,2>{0.787004709f, 0.421212673f},
-std::array<float,2>{0.662770331f, 0.738396585f},
-std::array<float,2>{0.396695137f, 0.119558752f},
-std::array<float,2>{0.452082127f, 0.854585409f},
-std::array<float,2>{0.691662788f, 0.280414999f},
-std::array<float,2>{0.864107549f, 0.560666323f},
-std::array<float,2>{0.0832374692f, 0.146400824f},
-std::array<float,2>{0.169659793f, 0.636609495f},
-std::array<float,2>{0.916545093f, 0.0542512126f},
-std::array<float,2>{0.568656981f, 0.927634478f},
-std::array<float,2>{0.278101385f, 0.460625976f},
-std::array<float,2>{0.418618917f, 0.692112386f},
-std::array<float,2>{0.637170792f, 0.0650322214f},
-std::array<float,2>{0.779999971f, 0.943082213f},
-std::array<float,2>{0.0270517226f, 0.400987029f},
-std::array<float,2>{0.219771266f, 0.785862744f},
-std::array<float,2>{0.980744004f, 0.358698964f},
-std::array<float,2>{0.532546282f, 0.568799257f},
-std::array<float,2>{0.350817621f, 0.225176156f},
-std::array<float,2>{0.289778084f, 0.893369198f},
-std::array<float,2>{0.597782314f, 0.473412007f},
-std::array<float,2>{0.901012361f, 0.686606765f},
-std::array<float,2>{0.130214274f, 0.0155427009f},
-std::array<float,2>{0.122515127f, 0.522129416f},
-std::array<float,2>{0.831731439f, 0.181596339f},
-std::array<float,2>{0.730929375f, 0.826378942f},
-std::array<float,2>{0.492666632f, 0.307958692f},
-std::array<float,2>{0.402838945f, 0.571955979f},
-std::array<float,2>{0.669917703f, 0.231568828f},
-std::array<float,2>{0.790266216f, 0.795612514f},
-std::array<float,2>{0.031725347f, 0.344064504f},
-std::array<float,2>{0.212095588f, 0.945331633f},
-std::array<float,2>{0.94600153f, 0.391202539f},
-std::array<float,2>{0.50941056f, 0.70022738f},
-std::array<float,2>{0.320649028f, 0.07040032f},
-std::array<float,2>{0.266070098f, 0.819769263f},
-std::array<float,2>{0.576208234f, 0.298724145f},
-std::array<float,2>{0.913975954f, 0.529047251f},
-std::array<float,2>{0.163936451f, 0.178273037f},
-std::array<float,2>{0.089671351f, 0.675247133f},
-std::array<float,2>{0.872301102f, 0.00610021176f},
-std::array<float,2>{0.703079879f, 0.902819753f},
-std::array<float,2>{0.437646627f, 0.480845928f},
-std::array<float,2>{0.355772048f, 0.74368614f},
-std::array<float,2>{0.541445196f, 0.113773718f},
-std::array<float,2>{0.969022334f, 0.976913095f},
-std::array<float,2>{0.234104618f, 0.413098782f},
-std::array<float,2>{0.0173644274f, 0.753395855f},
-std::array<float,2>{0.767820954f, 0.324250191f},
-std::array<float,2>{0.632294476f, 0.610116184f},
-std::array<float,2>{0.412142426f, 0.209866524f},
-std::array<float,2>{0.488091618f, 0.936544776f},
-std::array<float,2>{0.725104868f, 0.464065641f},
-std::array<float,2>{0.840640843f, 0.628456295f},
-std::array<float,2>{0.114687726f, 0.0559567995f},
-std::array<float,2>{0.139167711f, 0.554674625f},
-std::array<float,2>{0.897402942f, 0.153894752f},
-std::array<float,2>{0.602571607f, 0.845701098f},
-std::array<float,2>{0.285888642f, 0.267143071f},
-std::array<float,2>{0.300507993f, 0.508792281f},
-std::array<float,2>{0.610891879f, 0.169613704f},
-std::array<float,2>{0.89015764f, 0.835149527f},
-std::array<float,2>{0.143751502f, 0.289683014f},
-std::array<float,2>{0.104236335f, 0.875776768f},
-std::array<float,2>{0.820684552f, 0.486555666f},
-std::array<float,2>{0.749828219f, 0.667226374f},
-std::array<float,2>{0.483288944f, 0.0191705395f},
-std::array<float,2>{0.431084245f, 0.812188923f},
-std::array<float,2>{0.643531322f, 0.368981719f},
-std::array<float,2>{0.761768878f, 0.581126511f},
-std::array<float,2>{0.0126190335f, 0.248778492f},
-std::array<float,2>{0.245024487f, 0.718124568f},
-std::array<float,2>{0.99567771f, 0.0915078893f},
-std::array<float,2>{0.554723322f, 0.960051954f},
-std::array<float,2>{0.365324914f, 0.380723149f},
-std::array<float,2>{0.46421057f, 0.654539645f},
-std::array<float,2>{0.71035111f, 0.0442239791f},
-std::array<float,2>{0.844250202f, 0.92064029f},
-std::array<float,2>{0.0751728415f, 0.446157664f},
-std::array<float,2>{0.186150461f, 0.870146573f},
-std::array<float,2>{0.937462687f, 0.255036265f},
-std::array<float,2>{0.588137686f, 0.537642956f},
-std::array<float,2>{0.253906339f, 0.128403455f},
-std::array<float,2>{0.336908042f, 0.992154777f},
-std::array<float,2>{0.522550702f, 0.43144846f},
-std::array<float,2>{0.966563225f, 0.732496321f},
-std::array<float,2>{0.194572121f, 0.10398484f},
-std::array<float,2>{0.0470916256f, 0.598984599f},
-std::array<float,2>{0.806072295f, 0.200180024f},
-std::array<float,2>{0.676964939f, 0.780843735f},
-std::array<float,2>{0.385797113f, 0.330005527f},
-std::array<float,2>{0.427946359f, 0.525494874f},
-std::array<float,2>{0.655799329f, 0.172074243f},
-std::array<float,2>{0.754906774f, 0.814003885f},
-std::array<float,2>{0.00054593297f, 0.301219344f},
-std::array<float,2>{0.235442236f, 0.902245045f},
-std::array<float,2>{0.986345291f, 0.479217201f},
-std::array<float,2>{0.553919971f, 0.679365933f},
-std::array<float,2>{0.369384289f, 0.000650327129f},
-std::array<float,2>{0.310363472f, 0.79124254f},
-std::array<float,2>{0.617427826f, 0.350114584f},
-std::array<float,2>{0.880658269f, 0.575380981f},
-std::array<float,2>{0.149728343f, 0.230121657f},
-std::array<float,2>{0.0964058712f, 0.697848976f},
-std::array<float,2>{0.819392085f, 0.0772787109f},
-std::array<float,2>{0.736869097f, 0.952378988f},
-std::array<float,2>{0.474109173f, 0.397403389f},
-std::array<float,2>{0.333053648f, 0.631445765f},
-std::array<float,2>{0.525297284f, 0.0589670315f},
-std::array<float,2>{0.957008302f, 0.9327389f},
-std::array<float,2>{0.200686008f, 0.468276232f},
-std::array<float,2>{0.0615343861f, 0.849101603f},
-std::array<float,2>{0.803261578f, 0.270761818f},
-std::array<float,2>{0.680174947f, 0.550691724f},
-std::array<float,2>{0.38079235f, 0.150801256f},
-std::array<float,2>{0.457119912f, 0.982754767f},
-std::array<float,2>{0.712649882f, 0.409105003f},
-std::array<float,2>{0.856860638f, 0.747973442f},
-std::array<float,2>{0.0664374754f, 0.113120377f},
-std::array<float,2>{0.176792994f, 0.613663197f},
-std::array<float,2>{0.923285425f, 0.205707163f},
-std::array<float,2>{0.584881425f, 0.757641375f},
-std::array<float,2>{0.260626554f, 0.322003245f},
-std::array<float,2>{0.27693662f, 0.583396733f},
-std::array<float,2>{0.565208495f, 0.243852943f},
-std::array<float,2>{0.920938969f, 0.806539178f},
-std::array<float,2>{0.166589454f, 0.374092191f},
-std::array<float,2>{0.0789281204f, 0.956817329f},
-std::array<float,2>{0.860712588f, 0.378189415f},
-std::array<float,2>{0.690644205f, 0.713226616f},
-std::array<float,2>{0.447386384f, 0.0890383944f},
-std::array<float,2>{0.391175956f, 0.829926133f},
-std::array<float,2>{0.657808006f, 0.296819925f},
-std::array<float,2>{0.784329236f, 0.514481187f},
-std::array<float,2>{0.0419389755f, 0.164800331f},
-std::array<float,2>{0.205870017f, 0.669077575f},
-std::array<float,2>{0.939388216f, 0.0202380121f},
-std::array<float,2>{0.50311929f, 0.882453382f},
-std::array<float,2>{0.314716667f, 0.489446908f},
-std::array<float,2>{0.498252243f, 0.730439603f},
-std::array<float,2>{0.729843915f, 0.108819991f},
-std::array<float,2>{0.832207859f, 0.986336172f},
-std::array<float,2>{0.118518166f, 0.43397665f},
-std::array<float,2>{0.126386717f, 0.776673079f},
-std::array<float,2>{0.906128407f, 0.332290977f},
-std::array<float,2>{0.597345531f, 0.596841693f},
-std::array<float,2>{0.294442654f, 0.196589693f},
-std::array<float,2>{0.347093046f, 0.917418838f},
-std::array<float,2>{0.53608197f, 0.45179224f},
-std::array<float,2>{0.978044748f, 0.648883522f},
-std::array<float,2>{0.22409755f, 0.040316999f},
-std::array<float,2>{0.0278239381f, 0.532346725f},
-std::array<float,2>{0.777300954f, 0.129672274f},
-std::array<float,2>{0.633812249f, 0.873746157f},
-std::array<float,2>{0.417101026f, 0.252001315f},
-std::array<float,2>{0.445040017f, 0.609091043f},
-std::array<float,2>{0.697254956f, 0.188489467f},
-std::array<float,2>{0.868851244f, 0.766456127f},
-std::array<float,2>{0.0931779593f, 0.340446174f},
-std::array<float,2>{0.158708453f, 0.993656754f},
-std::array<float,2>{0.907829821f, 0.42614916f},
-std::array<float,2>{0.573054373f, 0.722894669f},
-std::array<float,2>{0.272309661f, 0.0953127891f},
-std::array<float,2>{0.32585004f, 0.862349272f},
-std::array<float,2>{0.512731135f, 0.262576371f},
-std::array<float,2>{0.950279474f, 0.542075634f},
-std::array<float,2>{0.21495299f, 0.138515681f},
-std::array<float,2>{0.0387865379f, 0.648256421f},
-std::array<float,2>{0.795485318f, 0.0385621116f},
-std::array<float,2>{0.667221189f, 0.912991464f},
-std::array<float,2>{0.400323421f, 0.440366805f},
-std::array<float,2>{0.281567276f, 0.709408283f},
-std::array<float,2>{0.606702566f, 0.0787501186f},
-std::array<float,2>{0.894509315f, 0.965697289f},
-std::array<float,2>{0.135103449f, 0.388381064f},
-std::array<float,2>{0.109850168f, 0.801034391f},
-std::array<float,2>{0.83855629f, 0.361359417f},
-std::array<float,2>{0.719946682f, 0.587085247f},
-std::array<float,2>{0.489824951f, 0.237529367f},
-std::array<float,2>{0.409701586f, 0.889128745f},
-std::array<float,2>{0.626705229f, 0.499228746f},
-std::array<float,2>{0.771006286f, 0.659027398f},
-std::array<float,2>{0.0208097138f, 0.023960026f},
-std::array<float,2>{0.22757414f, 0.506386578f},
-std::array<float,2>{0.976521969f, 0.159215748f},
-std::array<float,2>{0.546093285f, 0.839592516f},
-std::array<float,2>{0.354684234f, 0.285713434f},
-std::array<float,2>{0.361798882f, 0.556677163f},
-std::array<float,2>{0.55960983f, 0.141984895f},
-std::array<float,2>{0.996347487f, 0.857313454f},
-std::array<float,2>{0.249917254f, 0.273602486f},
-std::array<float,2>{0.00883257762f, 0.92375946f},
-std::array<float,2>{0.760104835f, 0.456488013f},
-std::array<float,2>{0.64618355f, 0.638648093f},
-std::array<float,2>{0.435493976f, 0.048878219f},
-std::array<float,2>{0.47862336f, 0.763539195f},
-std::array<float,2>{0.745108545f, 0.315144807f},
-std::array<float,2>{0.827024996f, 0.624925137f},
-std::array<float,2>{0.105717018f, 0.2127361f},
-std::array<float,2>{0.144959033f, 0.736230671f},
-std::array<float,2>{0.88308847f, 0.12311615f},
-std::array<float,2>{0.614874721f, 0.975380898f},
-std::array<float,2>{0.301883101f, 0.416309267f},
-std::array<float,2>{0.387997627f, 0.680493772f},
-std::array<float,2>{0.672598064f, 0.00967540219f},
-std::array<float,2>{0.812438965f, 0.896679699f},
-std::array<float,2>{0.0521947108f, 0.471042126f},
-std::array<float,2>{0.189005524f, 0.822093964f},
-std::array<float,2>{0.962806165f, 0.308898449f},
-std::array<float,2>{0.516448915f, 0.515949965f},
-std::array<float,2>{0.34314996f, 0.183826193f},
-std::array<float,2>{0.253086179f, 0.938285291f},
-std::array<float,2>{0.593705714f, 0.402380913f},
-std::array<float,2>{0.930856109f, 0.690566719f},
-std::array<float,2>{0.183231056f, 0.0679095164f},
-std::array<float,2>{0.0725950524f, 0.563469708f},
-std::array<float,2>{0.850483775f, 0.220807105f},
-std::array<float,2>{0.704464138f, 0.781573713f},
-std::array<float,2>{0.468415678f, 0.35525915f},
-std::array<float,2>{0.450525254f, 0.561630309f},
-std::array<float,2>{0.69368428f, 0.144987851f},
-std::array<float,2>{0.867148995f, 0.853908002f},
-std::array<float,2>{0.0847743377f, 0.280075043f},
-std::array<float,2>{0.171376914f, 0.926012218f},
-std::array<float,2>{0.91518563f, 0.459354669f},
-std::array<float,2>{0.567915499f, 0.635084033f},
-std::array<float,2>{0.280687481f, 0.0527751856f},
-std::array<float,2>{0.317555368f, 0.760406137f},
-std::array<float,2>{0.505804241f, 0.316448539f},
-std::array<float,2>{0.945165038f, 0.620929778f},
-std::array<float,2>{0.207668215f, 0.21548906f},
-std::array<float,2>{0.0463553295f, 0.739845693f},
-std::array<float,2>{0.787662745f, 0.120331354f},
-std::array<float,2>{0.66143018f, 0.968997598f},
-std::array<float,2>{0.394738525f, 0.42080456f},
-std::array<float,2>{0.291519552f, 0.685625374f},
-std::array<float,2>{0.600158811f, 0.0138828512f},
-std::array<float,2>{0.898659706f, 0.894041479f},
-std::array<float,2>{0.131633922f, 0.474106848f},
-std::array<float,2>{0.124439746f, 0.828100324f},
-std::array<float,2>{0.828142464f, 0.307332307f},
-std::array<float,2>{0.73395586f, 0.522685826f},
-std::array<float,2>{0.495324582f, 0.17996566f},
-std::array<float,2>{0.420410424f, 0.942220449f},
-std::array<float,2>{0.638965368f, 0.401934624f},
-std::array<float,2>{0.778645337f, 0.69298631f},
-std::array<float,2>{0.0235942993f, 0.0657530278f},
-std::array<float,2>{0.222502738f, 0.5699628f},
-std::array<float,2>{0.98344171f, 0.225618333f},
-std::array<float,2>{0.534667075f, 0.786741138f},
-std::array<float,2>{0.348432928f, 0.357586414f},
-std::array<float,2>{0.374979138f, 0.602819085f},
-std::array<float,2>{0.54780519f, 0.191528156f},
-std::array<float,2>{0.988500893f, 0.772091627f},
-std::array<float,2>{0.238950104f, 0.336467952f},
-std::array<float,2>{0.00454846444f, 0.999077201f},
-std::array<float,2>{0.752426028f, 0.424074978f},
-std::array<float,2>{0.649619162f, 0.721991777f},
-std::array<float,2>{0.425185472f, 0.100856058f},
-std::array<float,2>{0.472593307f, 0.864790857f},
-std::array<float,2>{0.741603792f, 0.257858574f},
-std::array<float,2>{0.812811792f, 0.545214534f},
-std::array<float,2>{0.100053854f, 0.133863032f},
-std::array<float,2>{0.15398775f, 0.642100334f},
-std::array<float,2>{0.875332892f, 0.0314152129f},
-std::array<float,2>{0.623553514f, 0.908087373f},
-std::array<float,2>{0.306150883f, 0.442800701f},
-std::array<float,2>{0.375244319f, 0.705874264f},
-std::array<float,2>{0.686223865f, 0.0822196305f},
-std::array<float,2>{0.800195098f, 0.963679671f},
-std::array<float,2>{0.0565992594f, 0.384239763f},
-std::array<float,2>{0.19705978f, 0.798253715f},
-std::array<float,2>{0.960630953f, 0.365663141f},
-std::array<float,2>{0.529642105f, 0.590827167f},
-std::array<float,2>{0.329947442f, 0.239335477f},
-std::array<float,2>{0.264832169f, 0.883050203f},
-std::array<float,2>{0.579520226f, 0.496023834f},
-std::array<float,2>{0.925968289f, 0.663484693f},
-std::array<float,2>{0.174163088f, 0.0280680116f},
-std::array<float,2>{0.0654861256f, 0.503372133f},
-std::array<float,2>{0.852749407f, 0.160799697f},
-std::array<float,2>{0.718513012f, 0.84171313f},
-std::array<float,2>{0.455825865f, 0.284505159f},
-std::array<float,2>{0.431968719f, 0.580992341f},
-std::array<float,2>{0.642255068f, 0.249796048f},
-std::array<float,2>{0.764159739f, 0.811410069f},
-std::array<float,2>{0.0155459568f, 0.367819816f},
-std::array<float,2>{0.243566886f, 0.959348917f},
-std::array<float,2>{0.992255569f, 0.379471332f},
-std::array<float,2>{0.558518767f, 0.717530012f},
-std::array<float,2>{0.365229785f, 0.0902206376f},
-std::array<float,2>{0.29709065f, 0.834221542f},
-std::array<float,2>{0.612232566f, 0.290601403f},
-std::array<float,2>{0.887801349f, 0.508086801f},
-std::array<float,2>{0.141751304f, 0.168207914f},
-std::array<float,2>{0.102882884f, 0.66653955f},
-std::array<float,2>{0.823609769f, 0.0184990335f},
-std::array<float,2>{0.747102559f, 0.876944244f},
-std::array<float,2>{0.480509311f, 0.48730576f},
-std::array<float,2>{0.338127166f, 0.733653486f},
-std::array<float,2>{0.520043671f, 0.104565717f},
-std::array<float,2>{0.968664408f, 0.99034667f},
-std::array<float,2>{0.192760885f, 0.429814845f},
-std::array<float,2>{0.050655365f, 0.779754877f},
-std::array<float,2>{0.807513475f, 0.328227669f},
-std::array<float,2>{0.679271996f, 0.597914696f},
-std::array<float,2>{0.383092731f, 0.200729504f},
-std::array<float,2>{0.461331487f, 0.92122072f},
-std::array<float,2>{0.707351863f, 0.446793288f},
-std::array<float,2>{0.847633421f, 0.655738175f},
-std::array<float,2>{0.0765960366f, 0.0430592336f},
-std::array<float,2>{0.185201138f, 0.538630545f},
-std::array<float,2>{0.934885561f, 0.12783736f},
-std::array<float,2>{0.586800814f, 0.869893134f},
-std::array<float,2>{0.256526977f, 0.253982753f},
-std::array<float,2>{0.268644542f, 0.52827853f},
-std::array<float,2>{0.575969279f, 0.179041237f},
-std::array<float,2>{0.91031605f, 0.818747282f},
-std::array<float,2>{0.160664484f, 0.297738433f},
-std::array<float,2>{0.0877109244f, 0.903745413f},
-std::array<float,2>{0.873335779f, 0.481536776f},
-std::array<float,2>{0.700550556f, 0.674031258f},
-std::array<float,2>{0.439661145f, 0.00767173199f},
-std::array<float,2>{0.405040652f, 0.796341002f},
-std::array<float,2>{0.670048058f, 0.345641434f},
-std::array<float,2>{0.791365147f, 0.570888758f},
-std::array<float,2>{0.0347743072f, 0.231256992f},
-std::array<float,2>{0.213588879f, 0.699581563f},
-std::array<float,2>{0.948433876f, 0.0715814009f},
-std::array<float,2>{0.511261523f, 0.947189152f},
-std::array<float,2>{0.323759913f, 0.391779602f},
-std::array<float,2>{0.484836191f, 0.627477944f},
-std::array<float,2>{0.723234236f, 0.0556293726f},
-std::array<float,2>{0.842884302f, 0.935963571f},
-std::array<float,2>{0.116463885f, 0.463181138f},
-std::array<float,2>{0.13772428f, 0.844566226f},
-std::array<float,2>{0.896203756f, 0.266222775f},
-std::array<float,2>{0.6048792f, 0.5535869f},
-std::array<float,2>{0.287780404f, 0.153141707f},
-std::array<float,2>{0.358023852f, 0.978237808f},
-std::array<float,2>{0.539726257f, 0.412419289f},
-std::array<float,2>{0.971528769f, 0.743111432f},
-std::array<float,2>{0.232301131f, 0.114657529f},
-std::array<float,2>{0.0194458533f, 0.610605955f},
-std::array<float,2>{0.766283214f, 0.210266456f},
-std::array<float,2>{0.630692065f, 0.752170086f},
-std::array<float,2>{0.410220206f, 0.325748265f},
-std::array<float,2>{0.394360185f, 0.514801621f},
-std::array<float,2>{0.659504533f, 0.16556412f},
-std::array<float,2>{0.782024801f, 0.828492045f},
-std::array<float,2>{0.0391972251f, 0.295571119f},
-std::array<float,2>{0.204093426f, 0.881277204f},
-std::array<float,2>{0.941051662f, 0.488763303f},
-std::array<float,2>{0.50107348f, 0.668323576f},
-std::array<float,2>{0.313303828f, 0.0209939126f},
-std::array<float,2>{0.27459833f, 0.805012822f},
-std::array<float,2>{0.562521219f, 0.373875469f},
-std::array<float,2>{0.91891104f, 0.582032084f},
-std::array<float,2>{0.164974943f, 0.243149802f},
-std::array<float,2>{0.0809081346f, 0.714512765f},
-std::array<float,2>{0.86169523f, 0.0884232521f},
-std::array<float,2>{0.688514709f, 0.955963433f},
-std::array<float,2>{0.445375055f, 0.377407461f},
-std::array<float,2>{0.344763368f, 0.649961591f},
-std::array<float,2>{0.538228869f, 0.0399547778f},
-std::array<float,2>{0.97864455f, 0.91685003f},
-std::array<float,2>{0.225638375f, 0.452982217f},
-std::array<float,2>{0.0305489078f, 0.874215901f},
-std::array<float,2>{0.773696423f, 0.253316283f},
-std::array<float,2>{0.635821998f, 0.531745911f},
-std::array<float,2>{0.415362388f, 0.130306825f},
-std::array<float,2>{0.496805429f, 0.987798154f},
-std::array<float,2>{0.726689816f, 0.435042828f},
-std::array<float,2>{0.834587157f, 0.728982508f},
-std::array<float,2>{0.119244032f, 0.10758999f},
-std::array<float,2>{0.127470031f, 0.59632057f},
-std::array<float,2>{0.903779507f, 0.195745111f},
-std::array<float,2>{0.594777822f, 0.775810838f},
-std::array<float,2>{0.295868337f, 0.333418459f},
-std::array<float,2>{0.312418878f, 0.574759126f},
-std::array<float,2>{0.619413555f, 0.228830814f},
-std::array<float,2>{0.882096291f, 0.792235494f},
-std::array<float,2>{0.151598975f, 0.350754708f},
-std::array<float,2>{0.0943894908f, 0.951354682f},
-std::array<float,2>{0.816650212f, 0.39785853f},
-std::array<float,2>{0.735777855f, 0.698974252f},
-std::array<float,2>{0.474915683f, 0.0767879933f},
-std::array<float,2>{0.425992787f, 0.812636077f},
-std::array<float,2>{0.653081f, 0.302707791f},
-std::array<float,2>{0.755951643f, 0.527184308f},
-std::array<float,2>{0.00301399687f, 0.173077837f},
-std::array<float,2>{0.237974122f, 0.678276956f},
-std::array<float,2>{0.985020936f, 0.00131986558f},
-std::array<float,2>{0.551824152f, 0.900793612f},
-std::array<float,2>{0.367983282f, 0.479588509f},
-std::array<float,2>{0.460234135f, 0.74633956f},
-std::array<float,2>{0.71360451f, 0.112300381f},
-std::array<float,2>{0.858985484f, 0.984004676f},
-std::array<float,2>{0.0697008818f, 0.40928334f},
-std::array<float,2>{0.178617075f, 0.756403744f},
-std::array<float,2>{0.92437464f, 0.320852637f},
-std::array<float,2>{0.582942843f, 0.615018725f},
-std::array<float,2>{0.259714842f, 0.206654757f},
-std::array<float,2>{0.334819585f, 0.932040751f},
-std::array<float,2>{0.525458395f, 0.467259556f},
-std::array<float,2>{0.954993606f, 0.632685304f},
-std::array<float,2>{0.20235607f, 0.0602338389f},
-std::array<float,2>{0.058950007f, 0.549093664f},
-std::array<float,2>{0.801329553f, 0.151746571f},
-std::array<float,2>{0.682719231f, 0.848155141f},
-std::array<float,2>{0.381652236f, 0.269946873f},
-std::array<float,2>{0.477421075f, 0.623465419f},
-std::array<float,2>{0.742753685f, 0.210961848f},
-std::array<float,2>{0.824856281f, 0.76222533f},
-std::array<float,2>{0.107924424f, 0.315941155f},
-std::array<float,2>{0.147274241f, 0.976247072f},
-std::array<float,2>{0.884941578f, 0.41717875f},
-std::array<float,2>{0.615281045f, 0.735115826f},
-std::array<float,2>{0.303580225f, 0.124338694f},
-std::array<float,2>{0.36033687f, 0.856255233f},
-std::array<float,2>{0.561168432f, 0.274524182f},
-std::array<float,2>{0.99892211f, 0.558474123f},
-std::array<float,2>{0.247653097f, 0.141534179f},
-std::array<float,2>{0.0115559576f, 0.636917055f},
-std::array<float,2>{0.758031845f, 0.0504090674f},
-std::array<float,2>{0.648307681f, 0.921919823f},
-std::array<float,2>{0.43745333f, 0.455223233f},
-std::array<float,2>{0.251177967f, 0.68951118f},
-std::array<float,2>{0.590502143f, 0.0665569901f},
-std::array<float,2>{0.931679606f, 0.93900001f},
-std::array<float,2>{0.180353776f, 0.404199451f},
-std::array<float,2>{0.0719182864f, 0.782809675f},
-std::array<float,2>{0.849010944f, 0.353858292f},
-std::array<float,2>{0.706357479f, 0.564410031f},
-std::array<float,2>{0.465877712f, 0.222593606f},
-std::array<float,2>{0.390332788f, 0.897971332f},
-std::array<float,2>{0.673960447f, 0.472460896f},
-std::array<float,2>{0.81033963f, 0.68127799f},
-std::array<float,2>{0.0535700358f, 0.0079101976f},
-std::array<float,2>{0.191020831f, 0.517158568f},
-std::array<float,2>{0.963290989f, 0.185236484f},
-std::array<float,2>{0.51790899f, 0.820582569f},
-std::array<float,2>{0.340861648f, 0.310096115f},
-std::array<float,2>{0.326348543f, 0.5411129f},
-std::array<float,2>{0.514768541f, 0.137177795f},
-std::array<float,2>{0.952086508f, 0.862241447f},
-std::array<float,2>{0.218518287f, 0.262727439f},
-std::array<float,2>{0.0359826162f, 0.913185835f},
-std::array<float,2>{0.794269502f, 0.441313773f},
-std::array<float,2>{0.665209591f, 0.646617532f},
-std::array<float,2>{0.400901794f, 0.0376040041f},
-std::array<float,2>{0.443282157f, 0.767397344f},
-std::array<float,2>{0.697266757f, 0.341068029f},
-std::array<float,2>{0.87070328f, 0.607903659f},
-std::array<float,2>{0.0905935988f, 0.187663212f},
-std::array<float,2>{0.157142743f, 0.724237204f},
-std::array<float,2>{0.909822881f, 0.0940529853f},
-std::array<float,2>{0.57160455f, 0.992317736f},
-std::array<float,2>{0.270042866f, 0.426868081f},
-std::array<float,2>{0.406396747f, 0.6599195f},
-std::array<float,2>{0.627278328f, 0.0246974882f},
-std::array<float,2>{0.772712409f, 0.889698029f},
-std::array<float,2>{0.0226974078f, 0.498071879f},
-std::array<float,2>{0.228643447f, 0.838286281f},
-std::array<float,2>{0.973035574f, 0.286682904f},
-std::array<float,2>{0.542990685f, 0.507577777f},
-std::array<float,2>{0.352449983f, 0.158652186f},
-std::array<float,2>{0.283943444f, 0.966572285f},
-std::array<float,2>{0.60889405f, 0.38745445f},
-std::array<float,2>{0.892098963f, 0.710518897f},
-std::array<float,2>{0.133482933f, 0.0792586356f},
-std::array<float,2>{0.113048188f, 0.586260021f},
-std::array<float,2>{0.836469471f, 0.236376658f},
-std::array<float,2>{0.722339988f, 0.802577853f},
-std::array<float,2>{0.491255879f, 0.362764508f},
-std::array<float,2>{0.493374556f, 0.519890428f},
-std::array<float,2>{0.732168972f, 0.183392137f},
-std::array<float,2>{0.83040756f, 0.825415611f},
-std::array<float,2>{0.121763416f, 0.305046916f},
-std::array<float,2>{0.129595995f, 0.890661061f},
-std::array<float,2>{0.901672065f, 0.475676477f},
-std::array<float,2>{0.599296689f, 0.684051931f},
-std::array<float,2>{0.290467381f, 0.0125725493f},
-std::array<float,2>{0.350430727f, 0.7885831f},
-std::array<float,2>{0.531456232f, 0.356624782f},
-std::array<float,2>{0.982358456f, 0.568097055f},
-std::array<float,2>{0.219237864f, 0.223572567f},
-std::array<float,2>{0.0254953429f, 0.693928838f},
-std::array<float,2>{0.780752897f, 0.063133128f},
-std::array<float,2>{0.638065577f, 0.944725931f},
-std::array<float,2>{0.419129282f, 0.399077535f},
-std::array<float,2>{0.278787851f, 0.634611964f},
-std::array<float,2>{0.570117831f, 0.0518367626f},
-std::array<float,2>{0.917921901f, 0.929157853f},
-std::array<float,2>{0.168043882f, 0.458729476f},
-std::array<float,2>{0.082237564f, 0.852767944f},
-std::array<float,2>{0.865142465f, 0.278928816f},
-std::array<float,2>{0.692851603f, 0.559794724f},
-std::array<float,2>{0.452237964f, 0.146555126f},
-std::array<float,2>{0.398133039f, 0.971290171f},
-std::array<float,2>{0.66340065f, 0.419492483f},
-std::array<float,2>{0.786061585f, 0.740886271f},
-std::array<float,2>{0.0431216285f, 0.117699027f},
-std::array<float,2>{0.210363969f, 0.617970407f},
-std::array<float,2>{0.943334103f, 0.218706027f},
-std::array<float,2>{0.506085336f, 0.758376181f},
-std::array<float,2>{0.319471985f, 0.32027629f},
-std::array<float,2>{0.330522478f, 0.592524886f},
-std::array<float,2>{0.528960526f, 0.241810426f},
-std::array<float,2>{0.958548903f, 0.798863649f},
-std::array<float,2>{0.198319107f, 0.363411546f},
-std::array<float,2>{0.0572591759f, 0.962641478f},
-std::array<float,2>{0.798705935f, 0.386438817f},
-std::array<float,2>{0.684091687f, 0.704571068f},
-std::array<float,2>{0.377717614f, 0.0859325975f},
-std::array<float,2>{0.454911411f, 0.842455626f},
-std::array<float,2>{0.715094745f, 0.281385064f},
-std::array<float,2>{0.853965819f, 0.50001502f},
-std::array<float,2>{0.0634942651f, 0.163920701f},
-std::array<float,2>{0.172837093f, 0.660457194f},
-std::array<float,2>{0.928857386f, 0.0299823973f},
-std::array<float,2>{0.580263197f, 0.885825574f},
-std::array<float,2>{0.262831807f, 0.493292153f},
-std::array<float,2>{0.422452718f, 0.718813896f},
-std::array<float,2>{0.651463032f, 0.097793825f},
-std::array<float,2>{0.751834929f, 0.996511281f},
-std::array<float,2>{0.00760200992f, 0.423480093f},
-std::array<float,2>{0.241855845f, 0.771008909f},
-std::array<float,2>{0.990439832f, 0.337981969f},
-std::array<float,2>{0.549986064f, 0.604515851f},
-std::array<float,2>{0.371634156f, 0.19517225f},
-std::array<float,2>{0.308232546f, 0.90898186f},
-std::array<float,2>{0.622726262f, 0.44510141f},
-std::array<float,2>{0.877613842f, 0.64298743f},
-std::array<float,2>{0.154978827f, 0.0340727195f},
-std::array<float,2>{0.0989548862f, 0.543038249f},
-std::array<float,2>{0.814707279f, 0.136425197f},
-std::array<float,2>{0.738594055f, 0.865620375f},
-std::array<float,2>{0.46969381f, 0.260118842f},
-std::array<float,2>{0.385134369f, 0.599943757f},
-std::array<float,2>{0.675830841f, 0.201763228f},
-std::array<float,2>{0.804860592f, 0.778317988f},
-std::array<float,2>{0.0484801047f, 0.331627756f},
-std::array<float,2>{0.193483338f, 0.988867223f},
-std::array<float,2>{0.965459764f, 0.433181971f},
-std::array<float,2>{0.521766961f, 0.730648577f},
-std::array<float,2>{0.3369959f, 0.103007458f},
-std::array<float,2>{0.255380303f, 0.868959725f},
-std::array<float,2>{0.589241683f, 0.257754594f},
-std::array<float,2>{0.936408103f, 0.536622703f},
-std::array<float,2>{0.187466219f, 0.125881672f},
-std::array<float,2>{0.0752821267f, 0.65346843f},
-std::array<float,2>{0.845555961f, 0.0468738489f},
-std::array<float,2>{0.709642529f, 0.919889212f},
-std::array<float,2>{0.463508695f, 0.448269784f},
-std::array<float,2>{0.366414547f, 0.715897322f},
-std::array<float,2>{0.55649209f, 0.0933549032f},
-std::array<float,2>{0.994798481f, 0.95704633f},
-std::array<float,2>{0.245570317f, 0.380957514f},
-std::array<float,2>{0.0134246526f, 0.810154617f},
-std::array<float,2>{0.76329118f, 0.36984387f},
-std::array<float,2>{0.644064069f, 0.579378366f},
-std::array<float,2>{0.430081099f, 0.246167436f},
-std::array<float,2>{0.483871907f, 0.877537966f},
-std::array<float,2>{0.748880744f, 0.484781653f},
-std::array<float,2>{0.821973562f, 0.665022135f},
-std::array<float,2>{0.104706138f, 0.0167280659f},
-std::array<float,2>{0.143301249f, 0.511532426f},
-std::array<float,2>{0.889062703f, 0.171212569f},
-std::array<float,2>{0.61001122f, 0.833223164f},
-std::array<float,2>{0.299801022f, 0.292265654f},
-std::array<float,2>{0.286411017f, 0.550971448f},
-std::array<float,2>{0.602299571f, 0.156102687f},
-std::array<float,2>{0.898369551f, 0.847346008f},
-std::array<float,2>{0.140065908f, 0.26912865f},
-std::array<float,2>{0.113562383f, 0.933642805f},
-std::array<float,2>{0.841221929f, 0.461139798f},
-std::array<float,2>{0.726381838f, 0.625357747f},
-std::array<float,2>{0.486859381f, 0.0569389276f},
-std::array<float,2>{0.41353783f, 0.750651479f},
-std::array<float,2>{0.631297529f, 0.327023923f},
-std::array<float,2>{0.768726051f, 0.611343503f},
-std::array<float,2>{0.015723357f, 0.208378091f},
-std::array<float,2>{0.232828423f, 0.744513392f},
-std::array<float,2>{0.969933212f, 0.116684198f},
-std::array<float,2>{0.542779982f, 0.979134679f},
-std::array<float,2>{0.356924504f, 0.410604149f},
-std::array<float,2>{0.438807279f, 0.672284842f},
-std::array<float,2>{0.701410174f, 0.00492328778f},
-std::array<float,2>{0.871927679f, 0.90606761f},
-std::array<float,2>{0.0883622691f, 0.482453436f},
-std::array<float,2>{0.162201136f, 0.817224741f},
-std::array<float,2>{0.912474275f, 0.299802125f},
-std::array<float,2>{0.578064561f, 0.529937744f},
-std::array<float,2>{0.267393857f, 0.176653147f},
-std::array<float,2>{0.322154254f, 0.947381556f},
-std::array<float,2>{0.508765042f, 0.393087029f},
-std::array<float,2>{0.947166204f, 0.702382028f},
-std::array<float,2>{0.211642787f, 0.0730175599f},
-std::array<float,2>{0.0323995352f, 0.572799206f},
-std::array<float,2>{0.789881289f, 0.233329847f},
-std::array<float,2>{0.668322384f, 0.793744385f},
-std::array<float,2>{0.403395265f, 0.346848875f},
-std::array<float,2>{0.416049063f, 0.534247875f},
-std::array<float,2>{0.632860243f, 0.131563842f},
-std::array<float,2>{0.775445879f, 0.872949779f},
-std::array<float,2>{0.0285593029f, 0.250239998f},
-std::array<float,2>{0.223038867f, 0.914187312f},
-std::array<float,2>{0.976611257f, 0.451141804f},
-std::array<float,2>{0.536355615f, 0.652103782f},
-std::array<float,2>{0.346322954f, 0.0419005863f},
-std::array<float,2>{0.293045849f, 0.774940073f},
-std::array<float,2>{0.596296787f, 0.334631592f},
-std::array<float,2>{0.904478431f, 0.595073819f},
-std::array<float,2>{0.125796422f, 0.198510855f},
-std::array<float,2>{0.117873587f, 0.72670126f},
-std::array<float,2>{0.833495796f, 0.106388696f},
-std::array<float,2>{0.728899658f, 0.985210955f},
-std::array<float,2>{0.499973238f, 0.436516792f},
-std::array<float,2>{0.31579423f, 0.67026329f},
-std::array<float,2>{0.502200007f, 0.0218841657f},
-std::array<float,2>{0.937900424f, 0.878955543f},
-std::array<float,2>{0.206507444f, 0.491015494f},
-std::array<float,2>{0.0421512648f, 0.831532836f},
-std::array<float,2>{0.783416033f, 0.294209629f},
-std::array<float,2>{0.65693742f, 0.511726081f},
-std::array<float,2>{0.392497301f, 0.167335793f},
-std::array<float,2>{0.449019194f, 0.95348984f},
-std::array<float,2>{0.690276682f, 0.375415295f},
-std::array<float,2>{0.859600186f, 0.711365342f},
-std::array<float,2>{0.0797662959f, 0.0868294016f},
-std::array<float,2>{0.167662486f, 0.58472997f},
-std::array<float,2>{0.920193672f, 0.245725751f},
-std::array<float,2>{0.56549722f, 0.80855006f},
-std::array<float,2>{0.275900066f, 0.372718275f},
-std::array<float,2>{0.261118591f, 0.616674483f},
-std::array<float,2>{0.585272253f, 0.204892501f},
-std::array<float,2>{0.922315896f, 0.753929734f},
-std::array<float,2>{0.176037759f, 0.322588712f},
-std::array<float,2>{0.0676343367f, 0.982326269f},
-std::array<float,2>{0.855972946f, 0.406474978f},
-std::array<float,2>{0.711165965f, 0.748119891f},
-std::array<float,2>{0.458581626f, 0.109832145f},
-std::array<float,2>{0.379393697f, 0.851207852f},
-std::array<float,2>{0.6815992f, 0.272620857f},
-std::array<float,2>{0.804063618f, 0.548114479f},
-std::array<float,2>{0.0611814782f, 0.149024472f},
-std::array<float,2>{0.199683517f, 0.630424261f},
-std::array<float,2>{0.955446661f, 0.0608884767f},
-std::array<float,2>{0.523747802f, 0.930845737f},
-std::array<float,2>{0.332665682f, 0.465340108f},
-std::array<float,2>{0.472660035f, 0.696720243f},
-std::array<float,2>{0.738176763f, 0.0750913322f},
-std::array<float,2>{0.81874907f, 0.949948609f},
-std::array<float,2>{0.0968915895f, 0.39552784f},
-std::array<float,2>{0.14937301f, 0.789956868f},
-std::array<float,2>{0.879407585f, 0.347832799f},
-std::array<float,2>{0.618550539f, 0.576351821f},
-std::array<float,2>{0.309559792f, 0.226590902f},
-std::array<float,2>{0.370424569f, 0.899225831f},
-std::array<float,2>{0.553188682f, 0.476893187f},
-std::array<float,2>{0.987821996f, 0.676337779f},
-std::array<float,2>{0.234931722f, 0.003364773f},
-std::array<float,2>{0.00145223178f, 0.525216043f},
-std::array<float,2>{0.753948152f, 0.175233036f},
-std::array<float,2>{0.655227959f, 0.814799786f},
-std::array<float,2>{0.428801477f, 0.303389132f},
-std::array<float,2>{0.466965616f, 0.565153956f},
-std::array<float,2>{0.703841269f, 0.220602483f},
-std::array<float,2>{0.851074278f, 0.784454465f},
-std::array<float,2>{0.0734473839f, 0.352674156f},
-std::array<float,2>{0.181815594f, 0.939838409f},
-std::array<float,2>{0.930328012f, 0.405227512f},
-std::array<float,2>{0.592325509f, 0.688261867f},
-std::array<float,2>{0.252648592f, 0.0693684369f},
-std::array<float,2>{0.342322528f, 0.822431803f},
-std::array<float,2>{0.516606331f, 0.311330676f},
-std::array<float,2>{0.961639047f, 0.518767953f},
-std::array<float,2>{0.187823147f, 0.186743587f},
-std::array<float,2>{0.0509022437f, 0.683252037f},
-std::array<float,2>{0.811479509f, 0.0108856279f},
-std::array<float,2>{0.673123956f, 0.895715594f},
-std::array<float,2>{0.387238503f, 0.469403177f},
-std::array<float,2>{0.30154857f, 0.737783015f},
-std::array<float,2>{0.613800585f, 0.122939996f},
-std::array<float,2>{0.884011507f, 0.973265886f},
-std::array<float,2>{0.146257132f, 0.414871275f},
-std::array<float,2>{0.107152134f, 0.763988793f},
-std::array<float,2>{0.827624083f, 0.314331502f},
-std::array<float,2>{0.745660007f, 0.622528195f},
-std::array<float,2>{0.480033964f, 0.213742107f},
-std::array<float,2>{0.433765203f, 0.925289154f},
-std::array<float,2>{0.644812822f, 0.454049498f},
-std::array<float,2>{0.760899246f, 0.639557362f},
-std::array<float,2>{0.00857043546f, 0.0485904664f},
-std::array<float,2>{0.248200804f, 0.55634445f},
-std::array<float,2>{0.997913718f, 0.142641515f},
-std::array<float,2>{0.559443116f, 0.859090149f},
-std::array<float,2>{0.362965703f, 0.276021361f},
-std::array<float,2>{0.354485124f, 0.505780518f},
-std::array<float,2>{0.544943333f, 0.158187807f},
-std::array<float,2>{0.975398123f, 0.836380541f},
-std::array<float,2>{0.227120355f, 0.287621707f},
-std::array<float,2>{0.0199711062f, 0.887377977f},
-std::array<float,2>{0.7695719f, 0.496441662f},
-std::array<float,2>{0.625645936f, 0.656656027f},
-std::array<float,2>{0.408322543f, 0.0270723179f},
-std::array<float,2>{0.489056885f, 0.803043187f},
-std::array<float,2>{0.719434917f, 0.360633403f},
-std::array<float,2>{0.839106798f, 0.588537931f},
-std::array<float,2>{0.1105951f, 0.235649899f},
-std::array<float,2>{0.135770455f, 0.707409918f},
-std::array<float,2>{0.893339336f, 0.0818255246f},
-std::array<float,2>{0.605608642f, 0.968171299f},
-std::array<float,2>{0.282726675f, 0.389906406f},
-std::array<float,2>{0.399308294f, 0.645574629f},
-std::array<float,2>{0.666701674f, 0.0362043157f},
-std::array<float,2>{0.796317041f, 0.910595119f},
-std::array<float,2>{0.0373972356f, 0.43805784f},
-std::array<float,2>{0.216556236f, 0.859825671f},
-std::array<float,2>{0.949642897f, 0.264707923f},
-std::array<float,2>{0.511966765f, 0.54036504f},
-std::array<float,2>{0.324675828f, 0.139907762f},
-std::array<float,2>{0.272571564f, 0.994682312f},
-std::array<float,2>{0.574127436f, 0.429118574f},
-std::array<float,2>{0.906365514f, 0.725650728f},
-std::array<float,2>{0.159994677f, 0.0971359089f},
-std::array<float,2>{0.0922969505f, 0.606593072f},
-std::array<float,2>{0.867612422f, 0.190841556f},
-std::array<float,2>{0.69549793f, 0.768443346f},
-std::array<float,2>{0.44343704f, 0.341983497f},
-std::array<float,2>{0.439982146f, 0.529512823f},
-std::array<float,2>{0.700716436f, 0.176069155f},
-std::array<float,2>{0.873952091f, 0.816789985f},
-std::array<float,2>{0.0872224271f, 0.299119532f},
-std::array<float,2>{0.160288319f, 0.905281484f},
-std::array<float,2>{0.910957694f, 0.483193338f},
-std::array<float,2>{0.575566173f, 0.672533751f},
-std::array<float,2>{0.269309789f, 0.00558470655f},
-std::array<float,2>{0.323474318f, 0.793337166f},
-std::array<float,2>{0.511147976f, 0.347540855f},
-std::array<float,2>{0.949183762f, 0.572607219f},
-std::array<float,2>{0.212989643f, 0.2324384f},
-std::array<float,2>{0.0346081816f, 0.70287919f},
-std::array<float,2>{0.791598439f, 0.072706148f},
-std::array<float,2>{0.670762956f, 0.947802365f},
-std::array<float,2>{0.404329509f, 0.39263171f},
-std::array<float,2>{0.287557691f, 0.625528991f},
-std::array<float,2>{0.60509187f, 0.0574954636f},
-std::array<float,2>{0.895890176f, 0.934314668f},
-std::array<float,2>{0.138333783f, 0.46181339f},
-std::array<float,2>{0.11708533f, 0.846857905f},
-std::array<float,2>{0.843357682f, 0.268888146f},
-std::array<float,2>{0.722683966f, 0.551427543f},
-std::array<float,2>{0.485213369f, 0.155428454f},
-std::array<float,2>{0.410976231f, 0.978862524f},
-std::array<float,2>{0.630257249f, 0.41092521f},
-std::array<float,2>{0.765827775f, 0.744735599f},
-std::array<float,2>{0.018578412f, 0.117122851f},
-std::array<float,2>{0.231899261f, 0.612171352f},
-std::array<float,2>{0.970847785f, 0.208895087f},
-std::array<float,2>{0.539456546f, 0.750317395f},
-std::array<float,2>{0.357675612f, 0.326350123f},
-std::array<float,2>{0.364726543f, 0.579653144f},
-std::array<float,2>{0.557826161f, 0.247064769f},
-std::array<float,2>{0.992952287f, 0.809652209f},
-std::array<float,2>{0.243805453f, 0.369330823f},
-std::array<float,2>{0.0150034502f, 0.957711756f},
-std::array<float,2>{0.764430702f, 0.381559521f},
-std::array<float,2>{0.641932666f, 0.71630919f},
-std::array<float,2>{0.432180345f, 0.0928836018f},
-std::array<float,2>{0.481057942f, 0.833953619f},
-std::array<float,2>{0.747870147f, 0.292751938f},
-std::array<float,2>{0.824125648f, 0.511083007f},
-std::array<float,2>{0.103448108f, 0.171567678f},
-std::array<float,2>{0.142493308f, 0.664131761f},
-std::array<float,2>{0.888433278f, 0.0173812192f},
-std::array<float,2>{0.611793041f, 0.877236485f},
-std::array<float,2>{0.297739148f, 0.48513326f},
-std::array<float,2>{0.383601308f, 0.731126845f},
-std::array<float,2>{0.67879504f, 0.103036962f},
-std::array<float,2>{0.807055235f, 0.988744557f},
-std::array<float,2>{0.0502352007f, 0.432805032f},
-std::array<float,2>{0.193091005f, 0.777570367f},
-std::array<float,2>{0.967915714f, 0.331439048f},
-std::array<float,2>{0.520001411f, 0.600310147f},
-std::array<float,2>{0.338532001f, 0.201273724f},
-std::array<float,2>{0.255998462f, 0.919052422f},
-std::array<float,2>{0.586043656f, 0.449112713f},
-std::array<float,2>{0.935162365f, 0.654043138f},
-std::array<float,2>{0.184663117f, 0.0460224599f},
-std::array<float,2>{0.0770196095f, 0.536566913f},
-std::array<float,2>{0.847027957f, 0.125191376f},
-std::array<float,2>{0.707581878f, 0.868340671f},
-std::array<float,2>{0.461800098f, 0.257220984f},
-std::array<float,2>{0.425702453f, 0.605394006f},
-std::array<float,2>{0.650035977f, 0.194669783f},
-std::array<float,2>{0.752845585f, 0.770529807f},
-std::array<float,2>{0.00409964612f, 0.338576704f},
-std::array<float,2>{0.238631666f, 0.996721268f},
-std::array<float,2>{0.988910913f, 0.42329669f},
-std::array<float,2>{0.547104418f, 0.719620049f},
-std::array<float,2>{0.374371111f, 0.0984918028f},
-std::array<float,2>{0.30616197f, 0.865929544f},
-std::array<float,2>{0.623243988f, 0.26049614f},
-std::array<float,2>{0.875898123f, 0.543900847f},
-std::array<float,2>{0.153604776f, 0.135791212f},
-std::array<float,2>{0.100317925f, 0.643193662f},
-std::array<float,2>{0.812997878f, 0.0335940644f},
-std::array<float,2>{0.742082655f, 0.908387005f},
-std::array<float,2>{0.472128332f, 0.444691539f},
-std::array<float,2>{0.329469532f, 0.704986572f},
-std::array<float,2>{0.530168653f, 0.0854230374f},
-std::array<float,2>{0.959975183f, 0.96212554f},
-std::array<float,2>{0.196715698f, 0.38594225f},
-std::array<float,2>{0.0557738543f, 0.799754083f},
-std::array<float,2>{0.800717771f, 0.364018679f},
-std::array<float,2>{0.685976267f, 0.591973901f},
-std::array<float,2>{0.375571817f, 0.241332904f},
-std::array<float,2>{0.455196679f, 0.886371851f},
-std::array<float,2>{0.718068361f, 0.493700653f},
-std::array<float,2>{0.85327208f, 0.660647273f},
-std::array<float,2>{0.0661526546f, 0.0293650366f},
-std::array<float,2>{0.174351931f, 0.500655591f},
-std::array<float,2>{0.926639616f, 0.163122416f},
-std::array<float,2>{0.57980901f, 0.841995955f},
-std::array<float,2>{0.265589505f, 0.282179266f},
-std::array<float,2>{0.28119418f, 0.560073256f},
-std::array<float,2>{0.567513704f, 0.147325754f},
-std::array<float,2>{0.915965974f, 0.853372812f},
-std::array<float,2>{0.17174378f, 0.278796345f},
-std::array<float,2>{0.0844359621f, 0.929364562f},
-std::array<float,2>{0.866406798f, 0.458299398f},
-std::array<float,2>{0.69432056f, 0.633944929f},
-std::array<float,2>{0.450921476f, 0.052501291f},
-std::array<float,2>{0.395048082f, 0.757869065f},
-std::array<float,2>{0.661991835f, 0.319561094f},
-std::array<float,2>{0.787175775f, 0.617640078f},
-std::array<float,2>{0.0466421247f, 0.217989206f},
-std::array<float,2>{0.207351625f, 0.740473151f},
-std::array<float,2>{0.944361687f, 0.117622688f},
-std::array<float,2>{0.50492084f, 0.970779121f},
-std::array<float,2>{0.318066716f, 0.419004977f},
-std::array<float,2>{0.495836079f, 0.684534371f},
-std::array<float,2>{0.733732462f, 0.0117345024f},
-std::array<float,2>{0.828627884f, 0.891116977f},
-std::array<float,2>{0.124548279f, 0.476150542f},
-std::array<float,2>{0.131232485f, 0.825726151f},
-std::array<float,2>{0.899107099f, 0.305415869f},
-std::array<float,2>{0.599947631f, 0.520251274f},
-std::array<float,2>{0.29119733f, 0.183014423f},
-std::array<float,2>{0.347765505f, 0.945282102f},
-std::array<float,2>{0.534852386f, 0.398898333f},
-std::array<float,2>{0.984322965f, 0.693402946f},
-std::array<float,2>{0.221778274f, 0.0626843199f},
-std::array<float,2>{0.0241450071f, 0.567806244f},
-std::array<float,2>{0.779048145f, 0.223050222f},
-std::array<float,2>{0.639306545f, 0.788298428f},
-std::array<float,2>{0.420109183f, 0.357174665f},
-std::array<float,2>{0.400466472f, 0.540596187f},
-std::array<float,2>{0.665905058f, 0.140442282f},
-std::array<float,2>{0.794512749f, 0.860321462f},
-std::array<float,2>{0.0351602063f, 0.265490353f},
-std::array<float,2>{0.218148574f, 0.910959244f},
-std::array<float,2>{0.951607525f, 0.437720388f},
-std::array<float,2>{0.515562475f, 0.646021664f},
-std::array<float,2>{0.326791525f, 0.036916744f},
-std::array<float,2>{0.269828081f, 0.7678442f},
-std::array<float,2>{0.572262406f, 0.342538029f},
-std::array<float,2>{0.909361243f, 0.606947958f},
-std::array<float,2>{0.156337604f, 0.191344544f},
-std::array<float,2>{0.0901665464f, 0.726160884f},
-std::array<float,2>{0.870160758f, 0.0974923745f},
-std::array<float,2>{0.698015451f, 0.994471371f},
-std::array<float,2>{0.44255513f, 0.429330707f},
-std::array<float,2>{0.351817489f, 0.65690136f},
-std::array<float,2>{0.543566048f, 0.0266038477f},
-std::array<float,2>{0.973390102f, 0.8869403f},
-std::array<float,2>{0.22921358f, 0.496687174f},
-std::array<float,2>{0.0231357049f, 0.836542964f},
-std::array<float,2>{0.773293316f, 0.287223339f},
-std::array<float,2>{0.627708495f, 0.50502336f},
-std::array<float,2>{0.406781375f, 0.157644719f},
-std::array<float,2>{0.491928786f, 0.968587637f},
-std::array<float,2>{0.721869886f, 0.390454084f},
-std::array<float,2>{0.836053133f, 0.707945645f},
-std::array<float,2>{0.112751231f, 0.0810557902f},
-std::array<float,2>{0.133196354f, 0.588362455f},
-std::array<float,2>{0.891816258f, 0.235855862f},
-std::array<float,2>{0.608746171f, 0.803361237f},
-std::array<float,2>{0.283316135f, 0.361077487f},
-std::array<float,2>{0.302859098f, 0.622731984f},
-std::array<float,2>{0.615806043f, 0.213352412f},
-std::array<float,2>{0.885392249f, 0.764231384f},
-std::array<float,2>{0.146742329f, 0.313551575f},
-std::array<float,2>{0.107849292f, 0.972963035f},
-std::array<float,2>{0.824502647f, 0.414067864f},
-std::array<float,2>{0.742561817f, 0.738096297f},
-std::array<float,2>{0.476807237f, 0.122072972f},
-std::array<float,2>{0.43658486f, 0.858474791f},
-std::array<float,2>{0.647861242f, 0.275854915f},
-std::array<float,2>{0.758514941f, 0.555720627f},
-std::array<float,2>{0.0107814772f, 0.143445417f},
-std::array<float,2>{0.247252643f, 0.639080822f},
-std::array<float,2>{0.998219907f, 0.0480885282f},
-std::array<float,2>{0.560823321f, 0.925566196f},
-std::array<float,2>{0.35948959f, 0.453245312f},
-std::array<float,2>{0.466503441f, 0.68777442f},
-std::array<float,2>{0.706661105f, 0.0702769756f},
-std::array<float,2>{0.849129379f, 0.940192401f},
-std::array<float,2>{0.071661219f, 0.404399514f},
-std::array<float,2>{0.179861829f, 0.784673929f},
-std::array<float,2>{0.932604015f, 0.353453964f},
-std::array<float,2>{0.590017974f, 0.564518929f},
-std::array<float,2>{0.251743406f, 0.220191926f},
-std::array<float,2>{0.341556072f, 0.896284878f},
-std::array<float,2>{0.518534899f, 0.468901783f},
-std::array<float,2>{0.963470876f, 0.683082521f},
-std::array<float,2>{0.190857813f, 0.0116264336f},
-std::array<float,2>{0.0528148487f, 0.519245863f},
-std::array<float,2>{0.809774756f, 0.187352777f},
-std::array<float,2>{0.674694121f, 0.82285279f},
-std::array<float,2>{0.389994711f, 0.310635418f},
-std::array<float,2>{0.475422442f, 0.576736271f},
-std::array<float,2>{0.735994518f, 0.227263123f},
-std::array<float,2>{0.81698966f, 0.789182901f},
-std::array<float,2>{0.0939446762f, 0.348206699f},
-std::array<float,2>{0.151886657f, 0.949653745f},
-std::array<float,2>{0.882455826f, 0.396442264f},
-std::array<float,2>{0.620087266f, 0.696884334f},
-std::array<float,2>{0.311710328f, 0.0745125636f},
-std::array<float,2>{0.367622226f, 0.815089643f},
-std::array<float,2>{0.552569926f, 0.302944124f},
-std::array<float,2>{0.984785795f, 0.524804831f},
-std::array<float,2>{0.23760663f, 0.175611496f},
-std::array<float,2>{0.00371356378f, 0.675798535f},
-std::array<float,2>{0.756350994f, 0.00388084701f},
-std::array<float,2>{0.652763486f, 0.898554862f},
-std::array<float,2>{0.426645786f, 0.477064282f},
-std::array<float,2>{0.259049326f, 0.748874605f},
-std::array<float,2>{0.582378864f, 0.109937258f},
-std::array<float,2>{0.924240232f, 0.981487274f},
-std::array<float,2>{0.177936494f, 0.40720132f},
-std::array<float,2>{0.0700699538f, 0.754781604f},
-std::array<float,2>{0.858449161f, 0.3230744f},
-std::array<float,2>{0.71336323f, 0.617109895f},
-std::array<float,2>{0.460915625f, 0.204575837f},
-std::array<float,2>{0.380918413f, 0.931389749f},
-std::array<float,2>{0.683573067f, 0.465107888f},
-std::array<float,2>{0.801030219f, 0.630165219f},
-std::array<float,2>{0.0592537597f, 0.0611107685f},
-std::array<float,2>{0.202637851f, 0.548501492f},
-std::array<float,2>{0.954201341f, 0.148487225f},
-std::array<float,2>{0.525962234f, 0.851009846f},
-std::array<float,2>{0.33431977f, 0.273077965f},
-std::array<float,2>{0.312670976f, 0.512640834f},
-std::array<float,2>{0.501760006f, 0.167809829f},
-std::array<float,2>{0.940757811f, 0.83180958f},
-std::array<float,2>{0.203334749f, 0.294775963f},
-std::array<float,2>{0.0395560451f, 0.879415333f},
-std::array<float,2>{0.781536937f, 0.490344226f},
-std::array<float,2>{0.659940481f, 0.670541525f},
-std::array<float,2>{0.394014835f, 0.0221270993f},
-std::array<float,2>{0.44621253f, 0.807987452f},
-std::array<float,2>{0.689447761f, 0.372366488f},
-std::array<float,2>{0.862114549f, 0.584390819f},
-std::array<float,2>{0.0801671818f, 0.245221123f},
-std::array<float,2>{0.164545745f, 0.711719036f},
-std::array<float,2>{0.918142974f, 0.086232841f},
-std::array<float,2>{0.563148618f, 0.953673065f},
-std::array<float,2>{0.275312126f, 0.37589848f},
-std::array<float,2>{0.415872216f, 0.651480317f},
-std::array<float,2>{0.63629657f, 0.0413636938f},
-std::array<float,2>{0.774056196f, 0.914969087f},
-std::array<float,2>{0.0308227818f, 0.450524747f},
-std::array<float,2>{0.226394147f, 0.872470856f},
-std::array<float,2>{0.979070842f, 0.250881076f},
-std::array<float,2>{0.538853168f, 0.534793854f},
-std::array<float,2>{0.345606863f, 0.131295338f},
-std::array<float,2>{0.295083791f, 0.984678268f},
-std::array<float,2>{0.595372975f, 0.435571045f},
-std::array<float,2>{0.904257178f, 0.727353334f},
-std::array<float,2>{0.127326503f, 0.105871238f},
-std::array<float,2>{0.119857408f, 0.595433772f},
-std::array<float,2>{0.834216893f, 0.199045271f},
-std::array<float,2>{0.727324903f, 0.774644434f},
-std::array<float,2>{0.496424317f, 0.334123999f},
-std::array<float,2>{0.486506224f, 0.552944005f},
-std::array<float,2>{0.726008356f, 0.152482763f},
-std::array<float,2>{0.84136188f, 0.844141424f},
-std::array<float,2>{0.114071749f, 0.265820086f},
-std::array<float,2>{0.140204489f, 0.936144412f},
-std::array<float,2>{0.897532523f, 0.463422537f},
-std::array<float,2>{0.601571918f, 0.626979947f},
-std::array<float,2>{0.286828786f, 0.0550836623f},
-std::array<float,2>{0.35697946f, 0.75256151f},
-std::array<float,2>{0.542022526f, 0.325356275f},
-std::array<float,2>{0.970309794f, 0.610999167f},
-std::array<float,2>{0.2329261f, 0.210510522f},
-std::array<float,2>{0.0162895359f, 0.742663026f},
-std::array<float,2>{0.769067049f, 0.115213782f},
-std::array<float,2>{0.631396711f, 0.977542281f},
-std::array<float,2>{0.413646549f, 0.412915885f},
-std::array<float,2>{0.266655296f, 0.67439127f},
-std::array<float,2>{0.57753998f, 0.00716841547f},
-std::array<float,2>{0.912631631f, 0.903899074f},
-std::array<float,2>{0.162729621f, 0.482242763f},
-std::array<float,2>{0.08869344f, 0.818855524f},
-std::array<float,2>{0.871506631f, 0.296889395f},
-std::array<float,2>{0.701815069f, 0.527828038f},
-std::array<float,2>{0.439115226f, 0.179575309f},
-std::array<float,2>{0.404019028f, 0.946531415f},
-std::array<float,2>{0.668675184f, 0.392508388f},
-std::array<float,2>{0.789492726f, 0.700144589f},
-std::array<float,2>{0.0331263579f, 0.0721546113f},
-std::array<float,2>{0.21101518f, 0.570596874f},
-std::array<float,2>{0.946520269f, 0.230773628f},
-std::array<float,2>{0.508208573f, 0.796658754f},
-std::array<float,2>{0.321587741f, 0.345132858f},
-std::array<float,2>{0.337405443f, 0.598351896f},
-std::array<float,2>{0.522238314f, 0.200454861f},
-std::array<float,2>{0.964881718f, 0.780085206f},
-std::array<float,2>{0.194314614f, 0.328823894f},
-std::array<float,2>{0.0479138345f, 0.990980208f},
-std::array<float,2>{0.805287182f, 0.430548579f},
-std::array<float,2>{0.676495075f, 0.734087229f},
-std::array<float,2>{0.385666072f, 0.105351359f},
-std::array<float,2>{0.463363141f, 0.86922878f},
-std::array<float,2>{0.709140897f, 0.254479975f},
-std::array<float,2>{0.844827473f, 0.538130701f},
-std::array<float,2>{0.0759521127f, 0.127397671f},
-std::array<float,2>{0.18691349f, 0.655860126f},
-std::array<float,2>{0.935829759f, 0.0437154695f},
-std::array<float,2>{0.589387596f, 0.921416998f},
-std::array<float,2>{0.254990339f, 0.446774423f},
-std::array<float,2>{0.430237234f, 0.716914356f},
-std::array<float,2>{0.643927991f, 0.0907132998f},
-std::array<float,2>{0.762837231f, 0.959563255f},
-std::array<float,2>{0.0128887743f, 0.379092842f},
-std::array<float,2>{0.24606514f, 0.810759068f},
-std::array<float,2>{0.994228601f, 0.367401451f},
-std::array<float,2>{0.555842817f, 0.580120504f},
-std::array<float,2>{0.366871536f, 0.249280721f},
-std::array<float,2>{0.299096048f, 0.876316011f},
-std::array<float,2>{0.609650671f, 0.488246173f},
-std::array<float,2>{0.889419794f, 0.666472614f},
-std::array<float,2>{0.142777413f, 0.0179490466f},
-std::array<float,2>{0.105224527f, 0.508390725f},
-std::array<float,2>{0.821548879f, 0.168698505f},
-std::array<float,2>{0.748147011f, 0.834543228f},
-std::array<float,2>{0.484307677f, 0.290467024f},
-std::array<float,2>{0.377014995f, 0.591333151f},
-std::array<float,2>{0.683882177f, 0.24013181f},
-std::array<float,2>{0.797948599f, 0.798503458f},
-std::array<float,2>{0.0569110215f, 0.365842193f},
-std::array<float,2>{0.198811337f, 0.963031471f},
-std::array<float,2>{0.958154142f, 0.38438496f},
-std::array<float,2>{0.528603375f, 0.705258429f},
-std::array<float,2>{0.33058092f, 0.0828687921f},
-std::array<float,2>{0.263221562f, 0.841141343f},
-std::array<float,2>{0.580735743f, 0.284983814f},
-std::array<float,2>{0.929560661f, 0.503792822f},
-std::array<float,2>{0.17207855f, 0.160521179f},
-std::array<float,2>{0.0640577301f, 0.663628638f},
-std::array<float,2>{0.854456007f, 0.0275749713f},
-std::array<float,2>{0.715534031f, 0.883330464f},
-std::array<float,2>{0.454534352f, 0.495477527f},
-std::array<float,2>{0.371389598f, 0.722406566f},
-std::array<float,2>{0.550712705f, 0.101181231f},
-std::array<float,2>{0.991015017f, 0.999829113f},
-std::array<float,2>{0.241318151f, 0.424488544f},
-std::array<float,2>{0.00684970757f, 0.771613359f},
-std::array<float,2>{0.751463532f, 0.336036474f},
-std::array<float,2>{0.651941478f, 0.603265643f},
-std::array<float,2>{0.422306657f, 0.192036137f},
-std::array<float,2>{0.468939006f, 0.907253563f},
-std::array<float,2>{0.739017546f, 0.443269432f},
-std::array<float,2>{0.814992905f, 0.641910136f},
-std::array<float,2>{0.0993577987f, 0.0321754105f},
-std::array<float,2>{0.154747397f, 0.545434356f},
-std::array<float,2>{0.877153575f, 0.13433376f},
-std::array<float,2>{0.622216523f, 0.864295304f},
-std::array<float,2>{0.307838261f, 0.258408964f},
-std::array<float,2>{0.290926129f, 0.52332443f},
-std::array<float,2>{0.598662436f, 0.180576339f},
-std::array<float,2>{0.901856124f, 0.827562273f},
-std::array<float,2>{0.128954783f, 0.306681514f},
-std::array<float,2>{0.121436402f, 0.894145966f},
-std::array<float,2>{0.830591917f, 0.47428447f},
-std::array<float,2>{0.731840193f, 0.68626821f},
-std::array<float,2>{0.493741304f, 0.0142474333f},
-std::array<float,2>{0.419452757f, 0.786217988f},
-std::array<float,2>{0.638189197f, 0.35826993f},
-std::array<float,2>{0.780893564f, 0.569745839f},
-std::array<float,2>{0.0260524098f, 0.22611475f},
-std::array<float,2>{0.219579518f, 0.692636013f},
-std::array<float,2>{0.981595993f, 0.0663126037f},
-std::array<float,2>{0.532171547f, 0.941547275f},
-std::array<float,2>{0.349849135f, 0.401746094f},
-std::array<float,2>{0.452947885f, 0.635271311f},
-std::array<float,2>{0.693331182f, 0.0532961376f},
-std::array<float,2>{0.864638567f, 0.926690221f},
-std::array<float,2>{0.0826648548f, 0.459731162f},
-std::array<float,2>{0.168624729f, 0.854262829f},
-std::array<float,2>{0.917382538f, 0.27940312f},
-std::array<float,2>{0.569362879f, 0.562356591f},
-std::array<float,2>{0.27908501f, 0.14532651f},
-std::array<float,2>{0.319928855f, 0.969267011f},
-std::array<float,2>{0.506708086f, 0.420025021f},
-std::array<float,2>{0.94252938f, 0.739555418f},
-std::array<float,2>{0.210522518f, 0.120975219f},
-std::array<float,2>{0.0435580462f, 0.620434046f},
-std::array<float,2>{0.785488367f, 0.215127289f},
-std::array<float,2>{0.66398108f, 0.759940028f},
-std::array<float,2>{0.397627473f, 0.317066759f},
-std::array<float,2>{0.408758938f, 0.507023335f},
-std::array<float,2>{0.625146091f, 0.158850282f},
-std::array<float,2>{0.770115614f, 0.838824689f},
-std::array<float,2>{0.0204486139f, 0.286393613f},
-std::array<float,2>{0.226928815f, 0.890489697f},
-std::array<float,2>{0.975057125f, 0.498592973f},
-std::array<float,2>{0.545658469f, 0.659499764f},
-std::array<float,2>{0.353607684f, 0.0250888709f},
-std::array<float,2>{0.282409221f, 0.802165985f},
-std::array<float,2>{0.606417477f, 0.363143533f},
-std::array<float,2>{0.893050313f, 0.586664677f},
-std::array<float,2>{0.136639938f, 0.236888155f},
-std::array<float,2>{0.111300372f, 0.710222542f},
-std::array<float,2>{0.839413643f, 0.0799450949f},
-std::array<float,2>{0.719202161f, 0.965893865f},
-std::array<float,2>{0.488376349f, 0.386746496f},
-std::array<float,2>{0.325004131f, 0.647264481f},
-std::array<float,2>{0.512490988f, 0.0371962488f},
-std::array<float,2>{0.950052559f, 0.914002776f},
-std::array<float,2>{0.216054961f, 0.440743744f},
-std::array<float,2>{0.0379860587f, 0.861812174f},
-std::array<float,2>{0.796639442f, 0.263254315f},
-std::array<float,2>{0.666417778f, 0.541684151f},
-std::array<float,2>{0.398795873f, 0.137224808f},
-std::array<float,2>{0.443917662f, 0.992926598f},
-std::array<float,2>{0.696060181f, 0.427537858f},
-std::array<float,2>{0.867997527f, 0.724066675f},
-std::array<float,2>{0.0920537859f, 0.0943094641f},
-std::array<float,2>{0.159260899f, 0.608348012f},
-std::array<float,2>{0.907126009f, 0.188041747f},
-std::array<float,2>{0.57332021f, 0.766914189f},
-std::array<float,2>{0.273179203f, 0.34151879f},
-std::array<float,2>{0.252367795f, 0.563890517f},
-std::array<float,2>{0.591989458f, 0.222055644f},
-std::array<float,2>{0.929991186f, 0.782245874f},
-std::array<float,2>{0.182162791f, 0.354425371f},
-std::array<float,2>{0.0742178857f, 0.938701689f},
-std::array<float,2>{0.85089165f, 0.403629154f},
-std::array<float,2>{0.703165472f, 0.69018966f},
-std::array<float,2>{0.467406482f, 0.0669477731f},
-std::array<float,2>{0.387115419f, 0.82093215f},
-std::array<float,2>{0.673359215f, 0.309735864f},
-std::array<float,2>{0.810697436f, 0.516802609f},
-std::array<float,2>{0.0516607612f, 0.184787884f},
-std::array<float,2>{0.188257366f, 0.681066573f},
-std::array<float,2>{0.961176813f, 0.00878548902f},
-std::array<float,2>{0.517333865f, 0.897570014f},
-std::array<float,2>{0.341809183f, 0.472036719f},
-std::array<float,2>{0.479652047f, 0.734588861f},
-std::array<float,2>{0.745387256f, 0.124758668f},
-std::array<float,2>{0.82804817f, 0.975905418f},
-std::array<float,2>{0.106707729f, 0.41751489f},
-std::array<float,2>{0.145996004f, 0.761817694f},
-std::array<float,2>{0.884501755f, 0.315606475f},
-std::array<float,2>{0.61365515f, 0.62355423f},
-std::array<float,2>{0.300947398f, 0.211649641f},
-std::array<float,2>{0.362461537f, 0.922558069f},
-std::array<float,2>{0.558770657f, 0.455765516f},
-std::array<float,2>{0.99752748f, 0.637630403f},
-std::array<float,2>{0.248917982f, 0.050088726f},
-std::array<float,2>{0.00822811387f, 0.557721734f},
-std::array<float,2>{0.761566043f, 0.140760794f},
-std::array<float,2>{0.645063818f, 0.855517805f},
-std::array<float,2>{0.434170932f, 0.275135934f},
-std::array<float,2>{0.458452672f, 0.614668548f},
-std::array<float,2>{0.711863518f, 0.206509128f},
-std::array<float,2>{0.855956674f, 0.755999625f},
-std::array<float,2>{0.0681808814f, 0.320685118f},
-std::array<float,2>{0.176607057f, 0.983835876f},
-std::array<float,2>{0.922792792f, 0.410004616f},
-std::array<float,2>{0.585548997f, 0.74682641f},
-std::array<float,2>{0.261581242f, 0.11176943f},
-std::array<float,2>{0.33220914f, 0.848137081f},
-std::array<float,2>{0.523928583f, 0.270424038f},
-std::array<float,2>{0.955863953f, 0.549606383f},
-std::array<float,2>{0.199989662f, 0.152321592f},
-std::array<float,2>{0.0608927757f, 0.631983995f},
-std::array<float,2>{0.804327607f, 0.0596398786f},
-std::array<float,2>{0.680680871f, 0.932375371f},
-std::array<float,2>{0.379876286f, 0.467379004f},
-std::array<float,2>{0.308976561f, 0.698680878f},
-std::array<float,2>{0.61875546f, 0.0764458179f},
-std::array<float,2>{0.879134774f, 0.951875389f},
-std::array<float,2>{0.148911476f, 0.398436934f},
-std::array<float,2>{0.0975086913f, 0.792639077f},
-std::array<float,2>{0.819143414f, 0.351288825f},
-std::array<float,2>{0.737630427f, 0.574526548f},
-std::array<float,2>{0.473439783f, 0.229051158f},
-std::array<float,2>{0.429220289f, 0.901014686f},
-std::array<float,2>{0.654490054f, 0.479987413f},
-std::array<float,2>{0.754812241f, 0.677751064f},
-std::array<float,2>{0.00183942309f, 0.0017647252f},
-std::array<float,2>{0.234726459f, 0.526569664f},
-std::array<float,2>{0.987611771f, 0.17366454f},
-std::array<float,2>{0.553313434f, 0.81299603f},
-std::array<float,2>{0.37086919f, 0.302227616f},
-std::array<float,2>{0.346140951f, 0.531680524f},
-std::array<float,2>{0.536647737f, 0.130835637f},
-std::array<float,2>{0.977424145f, 0.87484777f},
-std::array<float,2>{0.223352671f, 0.253525704f},
-std::array<float,2>{0.0292256065f, 0.916064799f},
-std::array<float,2>{0.776206672f, 0.452592939f},
-std::array<float,2>{0.633579731f, 0.649657667f},
-std::array<float,2>{0.416680336f, 0.0394459851f},
-std::array<float,2>{0.499271423f, 0.77623266f},
-std::array<float,2>{0.72912395f, 0.333515555f},
-std::array<float,2>{0.833727539f, 0.595909953f},
-std::array<float,2>{0.117303163f, 0.195845813f},
-std::array<float,2>{0.125361025f, 0.729096413f},
-std::array<float,2>{0.905162156f, 0.108086899f},
-std::array<float,2>{0.596070826f, 0.987322867f},
-std::array<float,2>{0.293592662f, 0.435410619f},
-std::array<float,2>{0.392015129f, 0.66858232f},
-std::array<float,2>{0.656363487f, 0.0210761689f},
-std::array<float,2>{0.784161985f, 0.881804347f},
-std::array<float,2>{0.0427668914f, 0.489077687f},
-std::array<float,2>{0.206814319f, 0.828646243f},
-std::array<float,2>{0.938441932f, 0.295285165f},
-std::array<float,2>{0.502539814f, 0.515207052f},
-std::array<float,2>{0.315925896f, 0.165420979f},
-std::array<float,2>{0.275677532f, 0.955539703f},
-std::array<float,2>{0.566095471f, 0.377881974f},
-std::array<float,2>{0.920658112f, 0.714007676f},
-std::array<float,2>{0.167394936f, 0.0879223794f},
-std::array<float,2>{0.0795599669f, 0.582578242f},
-std::array<float,2>{0.86006248f, 0.242374554f},
-std::array<float,2>{0.68992579f, 0.805315435f},
-std::array<float,2>{0.448665559f, 0.373093814f},
-std::array<float,2>{0.462446868f, 0.537329733f},
-std::array<float,2>{0.708572388f, 0.128669456f},
-std::array<float,2>{0.846295357f, 0.871088386f},
-std::array<float,2>{0.0773038641f, 0.255506009f},
-std::array<float,2>{0.183995843f, 0.920081973f},
-std::array<float,2>{0.934242845f, 0.445576042f},
-std::array<float,2>{0.587678552f, 0.655254364f},
-std::array<float,2>{0.257676333f, 0.0446629561f},
-std::array<float,2>{0.33934167f, 0.780382216f},
-std::array<float,2>{0.521311045f, 0.329500735f},
-std::array<float,2>{0.967693031f, 0.599152565f},
-std::array<float,2>{0.191867068f, 0.199558437f},
-std::array<float,2>{0.049581524f, 0.733143747f},
-std::array<float,2>{0.807727456f, 0.10434822f},
-std::array<float,2>{0.678704441f, 0.991494775f},
-std::array<float,2>{0.384640217f, 0.430764437f},
-std::array<float,2>{0.298786074f, 0.66790694f},
-std::array<float,2>{0.613089502f, 0.0188321825f},
-std::array<float,2>{0.886886537f, 0.875417948f},
-std::array<float,2>{0.140992492f, 0.487022609f},
-std::array<float,2>{0.101653621f, 0.835656106f},
-std::array<float,2>{0.822911441f, 0.289536864f},
-std::array<float,2>{0.74670893f, 0.509529889f},
-std::array<float,2>{0.481899023f, 0.169044465f},
-std::array<float,2>{0.433312088f, 0.960454166f},
-std::array<float,2>{0.641449809f, 0.380232185f},
-std::array<float,2>{0.76477164f, 0.71833384f},
-std::array<float,2>{0.0141168442f, 0.0908821821f},
-std::array<float,2>{0.242332131f, 0.581637084f},
-std::array<float,2>{0.993863463f, 0.248104528f},
-std::array<float,2>{0.557294011f, 0.811808765f},
-std::array<float,2>{0.363541543f, 0.368434727f},
-std::array<float,2>{0.358608007f, 0.609653771f},
-std::array<float,2>{0.540637612f, 0.209315747f},
-std::array<float,2>{0.97262311f, 0.753574371f},
-std::array<float,2>{0.230572999f, 0.324992895f},
-std::array<float,2>{0.0177674871f, 0.977493763f},
-std::array<float,2>{0.767548621f, 0.413811684f},
-std::array<float,2>{0.629844964f, 0.743211091f},
-std::array<float,2>{0.412043363f, 0.113380305f},
-std::array<float,2>{0.485890567f, 0.844971776f},
-std::array<float,2>{0.724576592f, 0.266896129f},
-std::array<float,2>{0.842445612f, 0.553895772f},
-std::array<float,2>{0.11523518f, 0.153683648f},
-std::array<float,2>{0.137621477f, 0.62807852f},
-std::array<float,2>{0.89532429f, 0.0565020032f},
-std::array<float,2>{0.60445255f, 0.937448382f},
-std::array<float,2>{0.288718343f, 0.464594871f},
-std::array<float,2>{0.405396461f, 0.700956643f},
-std::array<float,2>{0.6713503f, 0.0710071549f},
-std::array<float,2>{0.791995883f, 0.94621104f},
-std::array<float,2>{0.0334478132f, 0.390782624f},
-std::array<float,2>{0.214492857f, 0.795317233f},
-std::array<float,2>{0.947534204f, 0.344453961f},
-std::array<float,2>{0.510200322f, 0.571362376f},
-std::array<float,2>{0.322273552f, 0.232333004f},
-std::array<float,2>{0.267812133f, 0.903031945f},
-std::array<float,2>{0.574887216f, 0.481142282f},
-std::array<float,2>{0.911327481f, 0.675383389f},
-std::array<float,2>{0.16121462f, 0.00645157509f},
-std::array<float,2>{0.0867690668f, 0.528788626f},
-std::array<float,2>{0.874252558f, 0.178026378f},
-std::array<float,2>{0.699613392f, 0.820219159f},
-std::array<float,2>{0.440755218f, 0.297892928f},
-std::array<float,2>{0.421240419f, 0.569258809f},
-std::array<float,2>{0.640222251f, 0.224940926f},
-std::array<float,2>{0.777515113f, 0.78556484f},
-std::array<float,2>{0.0244186129f, 0.359252185f},
-std::array<float,2>{0.221577629f, 0.942685127f},
-std::array<float,2>{0.98324281f, 0.400546789f},
-std::array<float,2>{0.533958614f, 0.691571891f},
-std::array<float,2>{0.349411786f, 0.0647943765f},
-std::array<float,2>{0.292517215f, 0.827144504f},
-std::array<float,2>{0.601151764f, 0.308145314f},
-std::array<float,2>{0.900317907f, 0.521542728f},
-std::array<float,2>{0.132104442f, 0.180952162f},
-std::array<float,2>{0.123764127f, 0.687421322f},
-std::array<float,2>{0.829642594f, 0.0150789618f},
-std::array<float,2>{0.732990086f, 0.893042207f},
-std::array<float,2>{0.494419664f, 0.472756058f},
-std::array<float,2>{0.316768736f, 0.739157915f},
-std::array<float,2>{0.504311442f, 0.119893454f},
-std::array<float,2>{0.944293916f, 0.970138252f},
-std::array<float,2>{0.20892714f, 0.421776623f},
-std::array<float,2>{0.0453286581f, 0.761685491f},
-std::array<float,2>{0.788508892f, 0.317395657f},
-std::array<float,2>{0.660523474f, 0.619170904f},
-std::array<float,2>{0.396383494f, 0.216121301f},
-std::array<float,2>{0.450183511f, 0.926999807f},
-std::array<float,2>{0.69471699f, 0.459962934f},
-std::array<float,2>{0.865525723f, 0.636230111f},
-std::array<float,2>{0.0859286189f, 0.0539383665f},
-std::array<float,2>{0.17003046f, 0.561378658f},
-std::array<float,2>{0.914554715f, 0.145633906f},
-std::array<float,2>{0.566483676f, 0.855081975f},
-std::array<float,2>{0.27962032f, 0.281042069f},
-std::array<float,2>{0.263792187f, 0.502476752f},
-std::array<float,2>{0.578969777f, 0.161736399f},
-std::array<float,2>{0.927493334f, 0.840202272f},
-std::array<float,2>{0.175283477f, 0.28383106f},
-std::array<float,2>{0.0653482452f, 0.884210289f},
-std::array<float,2>{0.85160929f, 0.494570345f},
-std::array<float,2>{0.716963112f, 0.662880003f},
-std::array<float,2>{0.456885576f, 0.0283493549f},
-std::array<float,2>{0.3768484f, 0.79744941f},
-std::array<float,2>{0.686843216f, 0.366445392f},
-std::array<float,2>{0.799631178f, 0.589862227f},
-std::array<float,2>{0.0552892908f, 0.239133835f},
-std::array<float,2>{0.195770308f, 0.706745028f},
-std::array<float,2>{0.959860682f, 0.0834098905f},
-std::array<float,2>{0.530564725f, 0.964456558f},
-std::array<float,2>{0.328156322f, 0.383718431f},
-std::array<float,2>{0.471601099f, 0.640847504f},
-std::array<float,2>{0.740560889f, 0.0323808677f},
-std::array<float,2>{0.813791096f, 0.906661391f},
-std::array<float,2>{0.10067375f, 0.442143053f},
-std::array<float,2>{0.152529016f, 0.863894999f},
-std::array<float,2>{0.876790583f, 0.259599119f},
-std::array<float,2>{0.624871969f, 0.546789587f},
-std::array<float,2>{0.304706365f, 0.133424148f},
-std::array<float,2>{0.373959273f, 0.998610377f},
-std::array<float,2>{0.54833889f, 0.425499707f},
-std::array<float,2>{0.989745736f, 0.7208094f},
-std::array<float,2>{0.239934281f, 0.0996128842f},
-std::array<float,2>{0.00559793878f, 0.60218811f},
-std::array<float,2>{0.753546298f, 0.192614257f},
-std::array<float,2>{0.648726702f, 0.772567987f},
-std::array<float,2>{0.424675077f, 0.337170452f},
-std::array<float,2>{0.389160186f, 0.516598701f},
-std::array<float,2>{0.675524354f, 0.184378549f},
-std::array<float,2>{0.809097111f, 0.821508706f},
-std::array<float,2>{0.0538593866f, 0.309440374f},
-std::array<float,2>{0.190177336f, 0.897007644f},
-std::array<float,2>{0.96458602f, 0.471283853f},
-std::array<float,2>{0.519286335f, 0.680032432f},
-std::array<float,2>{0.340016246f, 0.00896937959f},
-std::array<float,2>{0.250496387f, 0.782184601f},
-std::array<float,2>{0.591534078f, 0.354729503f},
-std::array<float,2>{0.93276763f, 0.562663317f},
-std::array<float,2>{0.180858776f, 0.221389145f},
-std::array<float,2>{0.0707187131f, 0.690988421f},
-std::array<float,2>{0.848187625f, 0.0676814616f},
-std::array<float,2>{0.705613434f, 0.937921703f},
-std::array<float,2>{0.465718746f, 0.403110802f},
-std::array<float,2>{0.361088812f, 0.637824178f},
-std::array<float,2>{0.562343836f, 0.049657654f},
-std::array<float,2>{0.999551773f, 0.923072994f},
-std::array<float,2>{0.246553838f, 0.456655473f},
-std::array<float,2>{0.0106941368f, 0.856508076f},
-std::array<float,2>{0.75943172f, 0.274341404f},
-std::array<float,2>{0.647419333f, 0.557520628f},
-std::array<float,2>{0.435670733f, 0.142558903f},
-std::array<float,2>{0.478132188f, 0.974840999f},
-std::array<float,2>{0.743182063f, 0.416743279f},
-std::array<float,2>{0.82531023f, 0.735654056f},
-std::array<float,2>{0.108693153f, 0.123906471f},
-std::array<float,2>{0.147731349f, 0.624326468f},
-std::array<float,2>{0.8861081f, 0.212226823f},
-std::array<float,2>{0.616929591f, 0.763038754f},
-std::array<float,2>{0.303843737f, 0.314772576f},
-std::array<float,2>{0.284277827f, 0.587519467f},
-std::array<float,2>{0.607751489f, 0.237878606f},
-std::array<float,2>{0.890836775f, 0.801487625f},
-std::array<float,2>{0.134700522f, 0.362202704f},
-std::array<float,2>{0.112022124f, 0.964891672f},
-std::array<float,2>{0.837231278f, 0.387761831f},
-std::array<float,2>{0.72150594f, 0.709754705f},
-std::array<float,2>{0.491210043f, 0.0785498172f},
-std::array<float,2>{0.40785262f, 0.838940918f},
-std::array<float,2>{0.628851712f, 0.285398811f},
-std::array<float,2>{0.771958232f, 0.506180346f},
-std::array<float,2>{0.0216960907f, 0.159866616f},
-std::array<float,2>{0.229566544f, 0.658297241f},
-std::array<float,2>{0.974462032f, 0.023762824f},
-std::array<float,2>{0.544572473f, 0.889594316f},
-std::array<float,2>{0.352607131f, 0.499588639f},
-std::array<float,2>{0.442159504f, 0.723218143f},
-std::array<float,2>{0.698253036f, 0.0948782414f},
-std::array<float,2>{0.869780123f, 0.99350816f},
-std::array<float,2>{0.0913515016f, 0.426628321f},
-std::array<float,2>{0.157573849f, 0.765850246f},
-std::array<float,2>{0.90913409f, 0.339911669f},
-std::array<float,2>{0.570644379f, 0.608538508f},
-std::array<float,2>{0.271320611f, 0.189285681f},
-std::array<float,2>{0.327875048f, 0.91217947f},
-std::array<float,2>{0.514049888f, 0.439612687f},
-std::array<float,2>{0.952836275f, 0.64773494f},
-std::array<float,2>{0.216876522f, 0.0387657061f},
-std::array<float,2>{0.036528118f, 0.542668164f},
-std::array<float,2>{0.793833494f, 0.138087615f},
-std::array<float,2>{0.664805114f, 0.863034725f},
-std::array<float,2>{0.402105063f, 0.261757255f},
-std::array<float,2>{0.497437209f, 0.597327054f},
-std::array<float,2>{0.72813338f, 0.196889013f},
-std::array<float,2>{0.835280657f, 0.777119458f},
-std::array<float,2>{0.120691039f, 0.332897186f},
-std::array<float,2>{0.128105581f, 0.986933708f},
-std::array<float,2>{0.903076708f, 0.434147418f},
-std::array<float,2>{0.59455812f, 0.729925156f},
-std::array<float,2>{0.296506137f, 0.109225422f},
-std::array<float,2>{0.344477624f, 0.873245955f},
-std::array<float,2>{0.53776741f, 0.252562881f},
-std::array<float,2>{0.980210304f, 0.532993197f},
-std::array<float,2>{0.224967778f, 0.129345655f},
-std::array<float,2>{0.0295002628f, 0.649031997f},
-std::array<float,2>{0.774493814f, 0.040533632f},
-std::array<float,2>{0.635450304f, 0.917810678f},
-std::array<float,2>{0.414797127f, 0.451609254f},
-std::array<float,2>{0.27412957f, 0.71369189f},
-std::array<float,2>{0.564082921f, 0.0898141339f},
-std::array<float,2>{0.918984652f, 0.956170797f},
-std::array<float,2>{0.165389597f, 0.37861076f},
-std::array<float,2>{0.0816848502f, 0.805703759f},
-std::array<float,2>{0.863149345f, 0.374762714f},
-std::array<float,2>{0.688042402f, 0.5838148f},
-std::array<float,2>{0.446406007f, 0.243242174f},
-std::array<float,2>{0.392713487f, 0.882239878f},
-std::array<float,2>{0.658756018f, 0.489987195f},
-std::array<float,2>{0.782442391f, 0.66986227f},
-std::array<float,2>{0.0400742851f, 0.0197305456f},
-std::array<float,2>{0.204359725f, 0.513856173f},
-std::array<float,2>{0.939919591f, 0.164501756f},
-std::array<float,2>{0.500826418f, 0.829128683f},
-std::array<float,2>{0.313686669f, 0.296248615f},
-std::array<float,2>{0.335160941f, 0.550088704f},
-std::array<float,2>{0.526598215f, 0.151164383f},
-std::array<float,2>{0.954048634f, 0.849131823f},
-std::array<float,2>{0.201861873f, 0.27103442f},
-std::array<float,2>{0.0602581501f, 0.93344593f},
-std::array<float,2>{0.802624643f, 0.467916071f},
-std::array<float,2>{0.68183881f, 0.631125331f},
-std::array<float,2>{0.381991416f, 0.059277866f},
-std::array<float,2>{0.459183544f, 0.757239401f},
-std::array<float,2>{0.714607835f, 0.321584016f},
-std::array<float,2>{0.857974231f, 0.613991261f},
-std::array<float,2>{0.0685824156f, 0.205395699f},
-std::array<float,2>{0.179648444f, 0.747237861f},
-std::array<float,2>{0.92509228f, 0.112537168f},
-std::array<float,2>{0.583619535f, 0.983007669f},
-std::array<float,2>{0.258270085f, 0.408517897f},
-std::array<float,2>{0.426975548f, 0.679110944f},
-std::array<float,2>{0.654186785f, 0.000320902909f},
-std::array<float,2>{0.757371604f, 0.901846528f},
-std::array<float,2>{0.00204592547f, 0.478748739f},
-std::array<float,2>{0.236596942f, 0.813959539f},
-std::array<float,2>{0.985503554f, 0.301535428f},
-std::array<float,2>{0.551500499f, 0.52607733f},
-std::array<float,2>{0.368674815f, 0.172442287f},
-std::array<float,2>{0.310813993f, 0.952875376f},
-std::array<float,2>{0.620882273f, 0.39672184f},
-std::array<float,2>{0.881254256f, 0.697632492f},
-std::array<float,2>{0.150757566f, 0.0778090805f},
-std::array<float,2>{0.0956145078f, 0.575903237f},
-std::array<float,2>{0.818198442f, 0.229597539f},
-std::array<float,2>{0.734874308f, 0.791967094f},
-std::array<float,2>{0.475616634f, 0.349734664f},
-std::array<float,2>{0.482679933f, 0.510345221f},
-std::array<float,2>{0.749145687f, 0.170644984f},
-std::array<float,2>{0.821269333f, 0.83250773f},
-std::array<float,2>{0.103935227f, 0.29180783f},
-std::array<float,2>{0.144232959f, 0.878426433f},
-std::array<float,2>{0.889856339f, 0.485984057f},
-std::array<float,2>{0.610536397f, 0.665989161f},
-std::array<float,2>{0.299924344f, 0.0158658754f},
-std::array<float,2>{0.365805358f, 0.809237659f},
-std::array<float,2>{0.555649161f, 0.370527953f},
-std::array<float,2>{0.995309114f, 0.579038918f},
-std::array<float,2>{0.244287506f, 0.24712415f},
-std::array<float,2>{0.0118715409f, 0.715471148f},
-std::array<float,2>{0.762585461f, 0.0925573409f},
-std::array<float,2>{0.643000424f, 0.958831072f},
-std::array<float,2>{0.431534797f, 0.382010758f},
-std::array<float,2>{0.254437268f, 0.652990758f},
-std::array<float,2>{0.588575006f, 0.0454463288f},
-std::array<float,2>{0.936982214f, 0.918139696f},
-std::array<float,2>{0.185810283f, 0.447364509f},
-std::array<float,2>{0.0746894777f, 0.867437482f},
-std::array<float,2>{0.844074726f, 0.25594762f},
-std::array<float,2>{0.71091795f, 0.535334229f},
-std::array<float,2>{0.464543432f, 0.126904666f},
-std::array<float,2>{0.386511534f, 0.989540696f},
-std::array<float,2>{0.677593768f, 0.432369471f},
-std::array<float,2>{0.806265175f, 0.7318995f},
-std::array<float,2>{0.0475718118f, 0.101569347f},
-std::array<float,2>{0.195009664f, 0.600672483f},
-std::array<float,2>{0.966047168f, 0.20308125f},
-std::array<float,2>{0.523362219f, 0.778572261f},
-std::array<float,2>{0.33610189f, 0.330405861f},
-std::array<float,2>{0.321227878f, 0.573461533f},
-std::array<float,2>{0.509249568f, 0.233846009f},
-std::array<float,2>{0.945714355f, 0.794607759f},
-std::array<float,2>{0.212661028f, 0.346123666f},
-std::array<float,2>{0.0320196077f, 0.948472202f},
-std::array<float,2>{0.790685654f, 0.394142836f},
-std::array<float,2>{0.668996453f, 0.701648235f},
-std::array<float,2>{0.402409077f, 0.0738439187f},
-std::array<float,2>{0.4384152f, 0.818240464f},
-std::array<float,2>{0.702170134f, 0.30065164f},
-std::array<float,2>{0.872767866f, 0.531101525f},
-std::array<float,2>{0.0891975686f, 0.177730247f},
-std::array<float,2>{0.163440868f, 0.673699021f},
-std::array<float,2>{0.913174272f, 0.00430798717f},
-std::array<float,2>{0.577138782f, 0.904696584f},
-std::array<float,2>{0.266116202f, 0.484099746f},
-std::array<float,2>{0.412834734f, 0.745665014f},
-std::array<float,2>{0.632682979f, 0.116043419f},
-std::array<float,2>{0.768139243f, 0.980134368f},
-std::array<float,2>{0.0170059819f, 0.411563575f},
-std::array<float,2>{0.233601287f, 0.751031458f},
-std::array<float,2>{0.96932888f, 0.327953935f},
-std::array<float,2>{0.541911483f, 0.61302352f},
-std::array<float,2>{0.35633269f, 0.207627863f},
-std::array<float,2>{0.285456032f, 0.934850812f},
-std::array<float,2>{0.603403032f, 0.462166786f},
-std::array<float,2>{0.896499813f, 0.626886845f},
-std::array<float,2>{0.138789758f, 0.057941258f},
-std::array<float,2>{0.115171149f, 0.552140236f},
-std::array<float,2>{0.840115666f, 0.154615402f},
-std::array<float,2>{0.72487402f, 0.846185684f},
-std::array<float,2>{0.48737964f, 0.267654657f},
-std::array<float,2>{0.397237718f, 0.618936002f},
-std::array<float,2>{0.662415087f, 0.217627719f},
-std::array<float,2>{0.786411881f, 0.759295464f},
-std::array<float,2>{0.0445055179f, 0.319255084f},
-std::array<float,2>{0.2097193f, 0.972264111f},
-std::array<float,2>{0.942213476f, 0.418896526f},
-std::array<float,2>{0.5072999f, 0.741506815f},
-std::array<float,2>{0.31886366f, 0.118454508f},
-std::array<float,2>{0.277800679f, 0.852272332f},
-std::array<float,2>{0.568892896f, 0.277503043f},
-std::array<float,2>{0.916118085f, 0.559540272f},
-std::array<float,2>{0.169412643f, 0.148361787f},
-std::array<float,2>{0.0835791528f, 0.633507073f},
-std::array<float,2>{0.863703012f, 0.0508548133f},
-std::array<float,2>{0.691914737f, 0.928615808f},
-std::array<float,2>{0.451530725f, 0.457673639f},
-std::array<float,2>{0.351276696f, 0.69468987f},
-std::array<float,2>{0.532758415f, 0.0642785057f},
-std::array<float,2>{0.981323719f, 0.943525195f},
-std::array<float,2>{0.220399395f, 0.399722159f},
-std::array<float,2>{0.026721755f, 0.787436604f},
-std::array<float,2>{0.779604197f, 0.355665654f},
-std::array<float,2>{0.637255073f, 0.567134023f},
-std::array<float,2>{0.417970598f, 0.223920479f},
-std::array<float,2>{0.492774218f, 0.892399788f},
-std::array<float,2>{0.731074691f, 0.475059032f},
-std::array<float,2>{0.831161857f, 0.684908211f},
-std::array<float,2>{0.122698069f, 0.012894975f},
-std::array<float,2>{0.130573452f, 0.521386385f},
-std::array<float,2>{0.900861561f, 0.182044268f},
-std::array<float,2>{0.598262012f, 0.824910164f},
-std::array<float,2>{0.289137304f, 0.306454897f},
-std::array<float,2>{0.307134092f, 0.544563055f},
-std::array<float,2>{0.621755242f, 0.135278597f},
-std::array<float,2>{0.87883836f, 0.866459966f},
-std::array<float,2>{0.155484617f, 0.260996163f},
-std::array<float,2>{0.0983180553f, 0.909552813f},
-std::array<float,2>{0.816132128f, 0.444060236f},
-std::array<float,2>{0.739357829f, 0.644490302f},
-std::array<float,2>{0.469737113f, 0.034806557f},
-std::array<float,2>{0.42320016f, 0.770099401f},
-std::array<float,2>{0.651169658f, 0.339738667f},
-std::array<float,2>{0.750965416f, 0.603968501f},
-std::array<float,2>{0.00613504741f, 0.194331408f},
-std::array<float,2>{0.240674332f, 0.719974995f},
-std::array<float,2>{0.991502821f, 0.098833628f},
-std::array<float,2>{0.549020588f, 0.997752249f},
-std::array<float,2>{0.373028576f, 0.422569305f},
-std::array<float,2>{0.453640789f, 0.66140157f},
-std::array<float,2>{0.716278255f, 0.0310365837f},
-std::array<float,2>{0.85513562f, 0.884877324f},
-std::array<float,2>{0.0630631819f, 0.492258012f},
-std::array<float,2>{0.173370212f, 0.843333185f},
-std::array<float,2>{0.928279519f, 0.282450169f},
-std::array<float,2>{0.581429541f, 0.501427591f},
-std::array<float,2>{0.261796802f, 0.162907168f},
-std::array<float,2>{0.331560999f, 0.960965514f},
-std::array<float,2>{0.527644873f, 0.385524064f},
-std::array<float,2>{0.957189739f, 0.703635037f},
-std::array<float,2>{0.197897136f, 0.0846986324f},
-std::array<float,2>{0.0580509305f, 0.593500793f},
-std::array<float,2>{0.797772288f, 0.241196305f},
-std::array<float,2>{0.684992731f, 0.800065219f},
-std::array<float,2>{0.378747672f, 0.364811271f},
-std::array<float,2>{0.434814811f, 0.555109859f},
-std::array<float,2>{0.645639241f, 0.143978268f},
-std::array<float,2>{0.760591209f, 0.857459128f},
-std::array<float,2>{0.00941324979f, 0.277025104f},
-std::array<float,2>{0.249213725f, 0.924108803f},
-std::array<float,2>{0.996927202f, 0.454944551f},
-std::array<float,2>{0.560265481f, 0.64054215f},
-std::array<float,2>{0.361940295f, 0.0473212861f},
-std::array<float,2>{0.30239144f, 0.765298247f},
-std::array<float,2>{0.614541113f, 0.312707782f},
-std::array<float,2>{0.883432567f, 0.622025788f},
-std::array<float,2>{0.14519164f, 0.214808524f},
-std::array<float,2>{0.106315143f, 0.736581028f},
-std::array<float,2>{0.826176643f, 0.121335447f},
-std::array<float,2>{0.744512677f, 0.973985612f},
-std::array<float,2>{0.479388833f, 0.415628731f},
-std::array<float,2>{0.343562484f, 0.682177603f},
-std::array<float,2>{0.515861511f, 0.00995626301f},
-std::array<float,2>{0.962170899f, 0.894715786f},
-std::array<float,2>{0.188677654f, 0.470500141f},
-std::array<float,2>{0.052407492f, 0.823631227f},
-std::array<float,2>{0.811944902f, 0.311757594f},
-std::array<float,2>{0.672096193f, 0.51807785f},
-std::array<float,2>{0.388329566f, 0.185565367f},
-std::array<float,2>{0.467870414f, 0.940590501f},
-std::array<float,2>{0.705068827f, 0.405667216f},
-std::array<float,2>{0.849900246f, 0.688592792f},
-std::array<float,2>{0.0730910972f, 0.0690382197f},
-std::array<float,2>{0.182881489f, 0.566403508f},
-std::array<float,2>{0.931155562f, 0.219293311f},
-std::array<float,2>{0.592870593f, 0.783284903f},
-std::array<float,2>{0.253764719f, 0.351999342f},
-std::array<float,2>{0.271706372f, 0.606416404f},
-std::array<float,2>{0.57240355f, 0.189703926f},
-std::array<float,2>{0.907515049f, 0.768645167f},
-std::array<float,2>{0.158265263f, 0.343558908f},
-std::array<float,2>{0.0936726183f, 0.995131373f},
-std::array<float,2>{0.868351698f, 0.428627491f},
-std::array<float,2>{0.696465433f, 0.724718451f},
-std::array<float,2>{0.444701523f, 0.096646741f},
-std::array<float,2>{0.399747342f, 0.86079365f},
-std::array<float,2>{0.667866588f, 0.264420509f},
-std::array<float,2>{0.795401275f, 0.539857268f},
-std::array<float,2>{0.0385014713f, 0.138786465f},
-std::array<float,2>{0.215583324f, 0.644773543f},
-std::array<float,2>{0.951065004f, 0.0359671935f},
-std::array<float,2>{0.513370037f, 0.91163069f},
-std::array<float,2>{0.325481594f, 0.438771755f},
-std::array<float,2>{0.48966676f, 0.708245039f},
-std::array<float,2>{0.720249176f, 0.0808293819f},
-std::array<float,2>{0.838048756f, 0.966961622f},
-std::array<float,2>{0.110065557f, 0.389618486f},
-std::array<float,2>{0.135259971f, 0.803871095f},
-std::array<float,2>{0.893862009f, 0.35992384f},
-std::array<float,2>{0.607003927f, 0.588928401f},
-std::array<float,2>{0.28195101f, 0.234415308f},
-std::array<float,2>{0.355078727f, 0.888638079f},
-std::array<float,2>{0.546844602f, 0.497380406f},
-std::array<float,2>{0.976044118f, 0.657997727f},
-std::array<float,2>{0.228398606f, 0.0259585567f},
-std::array<float,2>{0.021140825f, 0.504256368f},
-std::array<float,2>{0.770777225f, 0.156741515f},
-std::array<float,2>{0.62635237f, 0.836947262f},
-std::array<float,2>{0.409452081f, 0.288520098f},
-std::array<float,2>{0.44790259f, 0.585247755f},
-std::array<float,2>{0.691196024f, 0.244679883f},
-std::array<float,2>{0.861301124f, 0.807160795f},
-std::array<float,2>{0.0784579068f, 0.371525019f},
-std::array<float,2>{0.166487679f, 0.954991698f},
-std::array<float,2>{0.921480775f, 0.376128465f},
-std::array<float,2>{0.564560592f, 0.712725937f},
-std::array<float,2>{0.276736856f, 0.0873443037f},
-std::array<float,2>{0.315365106f, 0.830469131f},
-std::array<float,2>{0.503439069f, 0.293487251f},
-std::array<float,2>{0.938885689f, 0.512806594f},
-std::array<float,2>{0.205511764f, 0.166745052f},
-std::array<float,2>{0.0413108021f, 0.671791196f},
-std::array<float,2>{0.78500551f, 0.02254555f},
-std::array<float,2>{0.657587886f, 0.880778313f},
-std::array<float,2>{0.390977681f, 0.492079586f},
-std::array<float,2>{0.294386774f, 0.727977157f},
-std::array<float,2>{0.596828043f, 0.107208416f},
-std::array<float,2>{0.905412972f, 0.985418856f},
-std::array<float,2>{0.126478642f, 0.437064409f},
-std::array<float,2>{0.118720412f, 0.774048984f},
-std::array<float,2>{0.832536399f, 0.335906416f},
-std::array<float,2>{0.730079889f, 0.594189763f},
-std::array<float,2>{0.498993665f, 0.197808996f},
-std::array<float,2>{0.417686999f, 0.915237248f},
-std::array<float,2>{0.634722888f, 0.449237347f},
-std::array<float,2>{0.776530147f, 0.651060402f},
-std::array<float,2>{0.0278494041f, 0.0428943895f},
-std::array<float,2>{0.224196792f, 0.53334105f},
-std::array<float,2>{0.977549374f, 0.132581845f},
-std::array<float,2>{0.535309076f, 0.871446669f},
-std::array<float,2>{0.347601771f, 0.251860112f},
-std::array<float,2>{0.369732141f, 0.524057925f},
-std::array<float,2>{0.554338932f, 0.174125865f},
-std::array<float,2>{0.986972332f, 0.815610588f},
-std::array<float,2>{0.235911876f, 0.303849667f},
-std::array<float,2>{0.000473211345f, 0.899779439f},
-std::array<float,2>{0.755558729f, 0.477621496f},
-std::array<float,2>{0.655293822f, 0.677323699f},
-std::array<float,2>{0.428548366f, 0.00249775592f},
-std::array<float,2>{0.474160343f, 0.790242434f},
-std::array<float,2>{0.736795664f, 0.349381089f},
-std::array<float,2>{0.819947541f, 0.577444792f},
-std::array<float,2>{0.0961478725f, 0.227948263f},
-std::array<float,2>{0.150198892f, 0.696196735f},
-std::array<float,2>{0.880007744f, 0.0759118721f},
-std::array<float,2>{0.617974937f, 0.951040924f},
-std::array<float,2>{0.309768111f, 0.395085633f},
-std::array<float,2>{0.38012436f, 0.629044235f},
-std::array<float,2>{0.680572093f, 0.061890509f},
-std::array<float,2>{0.803036153f, 0.930173218f},
-std::array<float,2>{0.0621444732f, 0.466596693f},
-std::array<float,2>{0.200251222f, 0.850407422f},
-std::array<float,2>{0.956387758f, 0.272174418f},
-std::array<float,2>{0.52444005f, 0.547097564f},
-std::array<float,2>{0.33386302f, 0.150272638f},
-std::array<float,2>{0.260213435f, 0.981015325f},
-std::array<float,2>{0.584022403f, 0.407996923f},
-std::array<float,2>{0.923742354f, 0.749048412f},
-std::array<float,2>{0.17767112f, 0.111315347f},
-std::array<float,2>{0.0673394352f, 0.616079926f},
-std::array<float,2>{0.857108891f, 0.203893855f},
-std::array<float,2>{0.71218133f, 0.755167305f},
-std::array<float,2>{0.457952678f, 0.324026436f}}
\ No newline at end of file
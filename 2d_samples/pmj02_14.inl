@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.217910588f, 0.362936825f},
-std::array<float,2>{0.513678491f, 0.976404965f},
-std::array<float,2>{0.284081966f, 0.636003137f},
-std::array<float,2>{0.842277646f, 0.00394291943f},
-std::array<float,2>{0.426227599f, 0.232945442f},
-std::array<float,2>{0.899791121f, 0.5974828f},
-std::array<float,2>{0.106481254f, 0.763715208f},
-std::array<float,2>{0.640781164f, 0.41921261f},
-std::array<float,2>{0.0277802888f, 0.0807176158f},
-std::array<float,2>{0.69946301f, 0.699843943f},
-std::array<float,2>{0.456091046f, 0.933617294f},
-std::array<float,2>{0.949963808f, 0.289199919f},
-std::array<float,2>{0.344375998f, 0.4669002f},
-std::array<float,2>{0.794205725f, 0.83288908f},
-std::array<float,2>{0.14424184f, 0.538452685f},
-std::array<float,2>{0.570949376f, 0.166227251f},
-std::array<float,2>{0.0790540129f, 0.376566797f},
-std::array<float,2>{0.669867158f, 0.783074081f},
-std::array<float,2>{0.38728565f, 0.564341128f},
-std::array<float,2>{0.925550163f, 0.191361994f},
-std::array<float,2>{0.26084134f, 0.0337631255f},
-std::array<float,2>{0.860083759f, 0.656625211f},
-std::array<float,2>{0.242400318f, 0.941716015f},
-std::array<float,2>{0.557572782f, 0.33057794f},
-std::array<float,2>{0.175775886f, 0.126546398f},
-std::array<float,2>{0.598492146f, 0.523771048f},
-std::array<float,2>{0.325015157f, 0.874929249f},
-std::array<float,2>{0.769698441f, 0.476162374f},
-std::array<float,2>{0.497992516f, 0.279486269f},
-std::array<float,2>{0.99942261f, 0.879686534f},
-std::array<float,2>{0.0411222167f, 0.723565638f},
-std::array<float,2>{0.72273761f, 0.123216152f},
-std::array<float,2>{0.130856365f, 0.485567182f},
-std::array<float,2>{0.591417253f, 0.851548612f},
-std::array<float,2>{0.374813169f, 0.503200114f},
-std::array<float,2>{0.797790527f, 0.153277561f},
-std::array<float,2>{0.453016788f, 0.103366084f},
-std::array<float,2>{0.957584321f, 0.738823712f},
-std::array<float,2>{0.00577847939f, 0.897027194f},
-std::array<float,2>{0.709830701f, 0.260361135f},
-std::array<float,2>{0.120763421f, 0.214200512f},
-std::array<float,2>{0.629868388f, 0.58371532f},
-std::array<float,2>{0.406609267f, 0.80022645f},
-std::array<float,2>{0.878226638f, 0.400697142f},
-std::array<float,2>{0.309161216f, 0.312762856f},
-std::array<float,2>{0.827901065f, 0.95933938f},
-std::array<float,2>{0.188177392f, 0.679865718f},
-std::array<float,2>{0.524567902f, 0.0540421009f},
-std::array<float,2>{0.0564750023f, 0.303696513f},
-std::array<float,2>{0.743024111f, 0.91364646f},
-std::array<float,2>{0.471550196f, 0.705756664f},
-std::array<float,2>{0.979219615f, 0.0739007518f},
-std::array<float,2>{0.330343693f, 0.174652323f},
-std::array<float,2>{0.763039112f, 0.549711049f},
-std::array<float,2>{0.159903884f, 0.812513769f},
-std::array<float,2>{0.610140741f, 0.44295451f},
-std::array<float,2>{0.222481534f, 0.0241503417f},
-std::array<float,2>{0.543826103f, 0.642834961f},
-std::array<float,2>{0.275012523f, 0.995911837f},
-std::array<float,2>{0.85235852f, 0.353927344f},
-std::array<float,2>{0.397070169f, 0.423523396f},
-std::array<float,2>{0.919492722f, 0.777314544f},
-std::array<float,2>{0.0774127245f, 0.619453371f},
-std::array<float,2>{0.673573375f, 0.243488073f},
-std::array<float,2>{0.171677336f, 0.250625074f},
-std::array<float,2>{0.618270338f, 0.902469039f},
-std::array<float,2>{0.340701014f, 0.742876828f},
-std::array<float,2>{0.757215083f, 0.098536849f},
-std::array<float,2>{0.479576468f, 0.143556669f},
-std::array<float,2>{0.97100085f, 0.507844269f},
-std::array<float,2>{0.0508367904f, 0.855792046f},
-std::array<float,2>{0.73715198f, 0.499424487f},
-std::array<float,2>{0.0674510524f, 0.061345581f},
-std::array<float,2>{0.684221387f, 0.67936188f},
-std::array<float,2>{0.399994671f, 0.964465618f},
-std::array<float,2>{0.909579575f, 0.325969696f},
-std::array<float,2>{0.270887226f, 0.392511874f},
-std::array<float,2>{0.848003745f, 0.806482911f},
-std::array<float,2>{0.231331557f, 0.591893137f},
-std::array<float,2>{0.536868513f, 0.206167981f},
-std::array<float,2>{0.0104893167f, 0.449480295f},
-std::array<float,2>{0.71847719f, 0.820456922f},
-std::array<float,2>{0.441082358f, 0.560282946f},
-std::array<float,2>{0.963524401f, 0.182451099f},
-std::array<float,2>{0.361135989f, 0.0686891004f},
-std::array<float,2>{0.80699712f, 0.712479472f},
-std::array<float,2>{0.137221098f, 0.919959545f},
-std::array<float,2>{0.582701027f, 0.310533702f},
-std::array<float,2>{0.195536986f, 0.235528752f},
-std::array<float,2>{0.518274009f, 0.616721094f},
-std::array<float,2>{0.304249316f, 0.772096932f},
-std::array<float,2>{0.816087246f, 0.436884463f},
-std::array<float,2>{0.415347219f, 0.345728755f},
-std::array<float,2>{0.887255073f, 0.986651301f},
-std::array<float,2>{0.112777151f, 0.649121821f},
-std::array<float,2>{0.637111664f, 0.0216501914f},
-std::array<float,2>{0.239986956f, 0.412503123f},
-std::array<float,2>{0.551594138f, 0.755164325f},
-std::array<float,2>{0.256472707f, 0.606736124f},
-std::array<float,2>{0.87066859f, 0.226068288f},
-std::array<float,2>{0.382141739f, 0.00877300836f},
-std::array<float,2>{0.930192232f, 0.629729629f},
-std::array<float,2>{0.0894468725f, 0.981281877f},
-std::array<float,2>{0.658438444f, 0.374815047f},
-std::array<float,2>{0.0345608667f, 0.163882926f},
-std::array<float,2>{0.733388126f, 0.546570539f},
-std::array<float,2>{0.485544443f, 0.83772248f},
-std::array<float,2>{0.988745213f, 0.459624261f},
-std::array<float,2>{0.318936199f, 0.286986202f},
-std::array<float,2>{0.777825236f, 0.923623085f},
-std::array<float,2>{0.180750415f, 0.688134015f},
-std::array<float,2>{0.604978919f, 0.0868600085f},
-std::array<float,2>{0.0972582996f, 0.341287524f},
-std::array<float,2>{0.64946425f, 0.945590198f},
-std::array<float,2>{0.433481187f, 0.669122756f},
-std::array<float,2>{0.893465996f, 0.0465797819f},
-std::array<float,2>{0.295884758f, 0.197727427f},
-std::array<float,2>{0.833637714f, 0.574694395f},
-std::array<float,2>{0.204216033f, 0.790466249f},
-std::array<float,2>{0.502047062f, 0.384733737f},
-std::array<float,2>{0.1560729f, 0.110130131f},
-std::array<float,2>{0.570162416f, 0.728567779f},
-std::array<float,2>{0.352282465f, 0.884069681f},
-std::array<float,2>{0.781614542f, 0.272203952f},
-std::array<float,2>{0.462151885f, 0.478614688f},
-std::array<float,2>{0.938386142f, 0.864728808f},
-std::array<float,2>{0.023288168f, 0.521573722f},
-std::array<float,2>{0.688266039f, 0.136153057f},
-std::array<float,2>{0.147300303f, 0.322278142f},
-std::array<float,2>{0.577831566f, 0.965250432f},
-std::array<float,2>{0.348437339f, 0.673314571f},
-std::array<float,2>{0.791116893f, 0.0550644621f},
-std::array<float,2>{0.457986295f, 0.210664511f},
-std::array<float,2>{0.945867062f, 0.588914096f},
-std::array<float,2>{0.0272374414f, 0.810475051f},
-std::array<float,2>{0.695634067f, 0.397776604f},
-std::array<float,2>{0.104811169f, 0.0946080312f},
-std::array<float,2>{0.646369696f, 0.749963105f},
-std::array<float,2>{0.425471455f, 0.902117312f},
-std::array<float,2>{0.904346287f, 0.254344076f},
-std::array<float,2>{0.286719799f, 0.495874316f},
-std::array<float,2>{0.836472273f, 0.854982793f},
-std::array<float,2>{0.213739127f, 0.512943447f},
-std::array<float,2>{0.510396838f, 0.144804075f},
-std::array<float,2>{0.0463547222f, 0.429817319f},
-std::array<float,2>{0.720714509f, 0.768566132f},
-std::array<float,2>{0.492399424f, 0.611218452f},
-std::array<float,2>{0.995755196f, 0.239411712f},
-std::array<float,2>{0.32140848f, 0.0159859601f},
-std::array<float,2>{0.766908646f, 0.654013634f},
-std::array<float,2>{0.177157462f, 0.991332591f},
-std::array<float,2>{0.59519881f, 0.350185841f},
-std::array<float,2>{0.249952599f, 0.187043115f},
-std::array<float,2>{0.562123358f, 0.557973921f},
-std::array<float,2>{0.262965679f, 0.824648142f},
-std::array<float,2>{0.864184141f, 0.445408314f},
-std::array<float,2>{0.383458763f, 0.308295637f},
-std::array<float,2>{0.92604357f, 0.916140795f},
-std::array<float,2>{0.0837391689f, 0.718570888f},
-std::array<float,2>{0.667277813f, 0.0663371682f},
-std::array<float,2>{0.194693625f, 0.456199706f},
-std::array<float,2>{0.529612601f, 0.841650188f},
-std::array<float,2>{0.308364749f, 0.541422963f},
-std::array<float,2>{0.82332176f, 0.158951521f},
-std::array<float,2>{0.412176877f, 0.0909439847f},
-std::array<float,2>{0.881510854f, 0.691563785f},
-std::array<float,2>{0.124633715f, 0.929312289f},
-std::array<float,2>{0.625829995f, 0.281310618f},
-std::array<float,2>{0.000962622173f, 0.221552625f},
-std::array<float,2>{0.705176115f, 0.604264498f},
-std::array<float,2>{0.448775738f, 0.750049114f},
-std::array<float,2>{0.953787386f, 0.409699738f},
-std::array<float,2>{0.370195419f, 0.36947462f},
-std::array<float,2>{0.80347836f, 0.97966069f},
-std::array<float,2>{0.127680764f, 0.62885797f},
-std::array<float,2>{0.588804543f, 0.0150820287f},
-std::array<float,2>{0.071596317f, 0.266950339f},
-std::array<float,2>{0.679385364f, 0.889270842f},
-std::array<float,2>{0.390828103f, 0.731360197f},
-std::array<float,2>{0.916555822f, 0.115348771f},
-std::array<float,2>{0.279613853f, 0.137750074f},
-std::array<float,2>{0.856176436f, 0.517830074f},
-std::array<float,2>{0.224489182f, 0.862206638f},
-std::array<float,2>{0.542889595f, 0.482832044f},
-std::array<float,2>{0.162837729f, 0.0410786234f},
-std::array<float,2>{0.613606632f, 0.666433573f},
-std::array<float,2>{0.332364798f, 0.949740529f},
-std::array<float,2>{0.758318543f, 0.339224815f},
-std::array<float,2>{0.473743856f, 0.38889423f},
-std::array<float,2>{0.981777966f, 0.795980871f},
-std::array<float,2>{0.0606625304f, 0.572600663f},
-std::array<float,2>{0.749677002f, 0.199855924f},
-std::array<float,2>{0.229212776f, 0.293481171f},
-std::array<float,2>{0.532834053f, 0.931249678f},
-std::array<float,2>{0.267968506f, 0.696029484f},
-std::array<float,2>{0.846555829f, 0.0857531503f},
-std::array<float,2>{0.403759092f, 0.169265553f},
-std::array<float,2>{0.910612643f, 0.533181548f},
-std::array<float,2>{0.0636362433f, 0.830503047f},
-std::array<float,2>{0.681587219f, 0.463492781f},
-std::array<float,2>{0.0496284515f, 0.00270999153f},
-std::array<float,2>{0.741554618f, 0.636960506f},
-std::array<float,2>{0.483071208f, 0.971563637f},
-std::array<float,2>{0.97566098f, 0.363939434f},
-std::array<float,2>{0.339714438f, 0.415212005f},
-std::array<float,2>{0.752160966f, 0.759999692f},
-std::array<float,2>{0.165745109f, 0.600114048f},
-std::array<float,2>{0.622706354f, 0.229646116f},
-std::array<float,2>{0.116231024f, 0.472354949f},
-std::array<float,2>{0.633523464f, 0.869365513f},
-std::array<float,2>{0.4181723f, 0.530153275f},
-std::array<float,2>{0.884722114f, 0.129472807f},
-std::array<float,2>{0.297931224f, 0.120832726f},
-std::array<float,2>{0.819586337f, 0.721695006f},
-std::array<float,2>{0.202461645f, 0.8760764f},
-std::array<float,2>{0.519965827f, 0.274940759f},
-std::array<float,2>{0.133069098f, 0.192942157f},
-std::array<float,2>{0.581748128f, 0.569912016f},
-std::array<float,2>{0.366872996f, 0.787332952f},
-std::array<float,2>{0.80870086f, 0.38236931f},
-std::array<float,2>{0.444351822f, 0.335471094f},
-std::array<float,2>{0.966198981f, 0.941395879f},
-std::array<float,2>{0.0123718148f, 0.66189146f},
-std::array<float,2>{0.712143421f, 0.0372582823f},
-std::array<float,2>{0.184237674f, 0.403364152f},
-std::array<float,2>{0.607406616f, 0.801307559f},
-std::array<float,2>{0.31430012f, 0.580179036f},
-std::array<float,2>{0.774968922f, 0.215869278f},
-std::array<float,2>{0.491984427f, 0.05028449f},
-std::array<float,2>{0.987004161f, 0.684226453f},
-std::array<float,2>{0.0358480252f, 0.956988692f},
-std::array<float,2>{0.728823006f, 0.318120182f},
-std::array<float,2>{0.0898889825f, 0.15111652f},
-std::array<float,2>{0.660680234f, 0.507497668f},
-std::array<float,2>{0.376403153f, 0.844553351f},
-std::array<float,2>{0.933799982f, 0.488369942f},
-std::array<float,2>{0.25205484f, 0.262826532f},
-std::array<float,2>{0.874852598f, 0.891241729f},
-std::array<float,2>{0.237189502f, 0.73473835f},
-std::array<float,2>{0.550464392f, 0.108700365f},
-std::array<float,2>{0.0180935934f, 0.359081119f},
-std::array<float,2>{0.694482028f, 0.997180223f},
-std::array<float,2>{0.466503501f, 0.646921992f},
-std::array<float,2>{0.944739521f, 0.0278868303f},
-std::array<float,2>{0.356592327f, 0.2497008f},
-std::array<float,2>{0.787764072f, 0.624048293f},
-std::array<float,2>{0.150370181f, 0.778306603f},
-std::array<float,2>{0.563899517f, 0.427578449f},
-std::array<float,2>{0.207951188f, 0.0748147592f},
-std::array<float,2>{0.507641375f, 0.707398355f},
-std::array<float,2>{0.29151836f, 0.908214867f},
-std::array<float,2>{0.831246197f, 0.297017962f},
-std::array<float,2>{0.434831232f, 0.438716531f},
-std::array<float,2>{0.895020068f, 0.81683135f},
-std::array<float,2>{0.0983945951f, 0.553030491f},
-std::array<float,2>{0.653301299f, 0.175801471f},
-std::array<float,2>{0.244166091f, 0.328645796f},
-std::array<float,2>{0.555703402f, 0.945060909f},
-std::array<float,2>{0.259207994f, 0.658690929f},
-std::array<float,2>{0.861450136f, 0.0313864872f},
-std::array<float,2>{0.389777064f, 0.189090103f},
-std::array<float,2>{0.923239529f, 0.565905154f},
-std::array<float,2>{0.0806118473f, 0.783534467f},
-std::array<float,2>{0.670363903f, 0.37828964f},
-std::array<float,2>{0.0390693545f, 0.121556222f},
-std::array<float,2>{0.726226747f, 0.724702895f},
-std::array<float,2>{0.499781042f, 0.881299496f},
-std::array<float,2>{0.996578217f, 0.277694702f},
-std::array<float,2>{0.326708198f, 0.47322759f},
-std::array<float,2>{0.77312237f, 0.871683538f},
-std::array<float,2>{0.173726737f, 0.526414931f},
-std::array<float,2>{0.601040602f, 0.128831178f},
-std::array<float,2>{0.10932827f, 0.421434194f},
-std::array<float,2>{0.642868698f, 0.761915207f},
-std::array<float,2>{0.428916365f, 0.595054984f},
-std::array<float,2>{0.901912332f, 0.231381297f},
-std::array<float,2>{0.282989323f, 0.00776408147f},
-std::array<float,2>{0.839865029f, 0.634227037f},
-std::array<float,2>{0.215570077f, 0.974235415f},
-std::array<float,2>{0.511910915f, 0.360775113f},
-std::array<float,2>{0.142111003f, 0.165455982f},
-std::array<float,2>{0.573847532f, 0.53651607f},
-std::array<float,2>{0.346732736f, 0.835571289f},
-std::array<float,2>{0.795363367f, 0.465791553f},
-std::array<float,2>{0.454112798f, 0.2926265f},
-std::array<float,2>{0.952511609f, 0.936876535f},
-std::array<float,2>{0.0305513795f, 0.703004658f},
-std::array<float,2>{0.703061402f, 0.0787701383f},
-std::array<float,2>{0.157736912f, 0.445254296f},
-std::array<float,2>{0.611332178f, 0.816098452f},
-std::array<float,2>{0.328650892f, 0.547748446f},
-std::array<float,2>{0.764506459f, 0.173486099f},
-std::array<float,2>{0.470084757f, 0.0713654235f},
-std::array<float,2>{0.978051305f, 0.704719484f},
-std::array<float,2>{0.0581688732f, 0.910938442f},
-std::array<float,2>{0.744561851f, 0.301420659f},
-std::array<float,2>{0.0743489265f, 0.245389014f},
-std::array<float,2>{0.673859596f, 0.617447197f},
-std::array<float,2>{0.396008402f, 0.774614155f},
-std::array<float,2>{0.920223653f, 0.423971504f},
-std::array<float,2>{0.276569545f, 0.351761431f},
-std::array<float,2>{0.853907645f, 0.993901908f},
-std::array<float,2>{0.219299182f, 0.642068088f},
-std::array<float,2>{0.54636389f, 0.0258661639f},
-std::array<float,2>{0.00761523983f, 0.259171039f},
-std::array<float,2>{0.707555473f, 0.894686878f},
-std::array<float,2>{0.449604988f, 0.741938472f},
-std::array<float,2>{0.960596263f, 0.103958488f},
-std::array<float,2>{0.372414887f, 0.156130522f},
-std::array<float,2>{0.799896777f, 0.500053108f},
-std::array<float,2>{0.131673172f, 0.849077582f},
-std::array<float,2>{0.59357208f, 0.486349195f},
-std::array<float,2>{0.190333471f, 0.0510436296f},
-std::array<float,2>{0.525931954f, 0.68343389f},
-std::array<float,2>{0.310813546f, 0.958570659f},
-std::array<float,2>{0.825958371f, 0.314650476f},
-std::array<float,2>{0.409969717f, 0.399950802f},
-std::array<float,2>{0.876170039f, 0.797341943f},
-std::array<float,2>{0.117727287f, 0.584041178f},
-std::array<float,2>{0.631580949f, 0.212599725f},
-std::array<float,2>{0.140152127f, 0.311184734f},
-std::array<float,2>{0.585562527f, 0.919230163f},
-std::array<float,2>{0.362612903f, 0.713868022f},
-std::array<float,2>{0.804960787f, 0.067434296f},
-std::array<float,2>{0.438255668f, 0.180468023f},
-std::array<float,2>{0.962512255f, 0.561256766f},
-std::array<float,2>{0.00908399373f, 0.822270513f},
-std::array<float,2>{0.71588403f, 0.451993704f},
-std::array<float,2>{0.110352807f, 0.0214643385f},
-std::array<float,2>{0.640170276f, 0.651613176f},
-std::array<float,2>{0.417012572f, 0.985925853f},
-std::array<float,2>{0.890204966f, 0.344014823f},
-std::array<float,2>{0.301216632f, 0.434331894f},
-std::array<float,2>{0.813105762f, 0.770481527f},
-std::array<float,2>{0.197314635f, 0.613707423f},
-std::array<float,2>{0.517540514f, 0.23735331f},
-std::array<float,2>{0.0529679321f, 0.496714205f},
-std::array<float,2>{0.734980285f, 0.858142316f},
-std::array<float,2>{0.477243453f, 0.510020435f},
-std::array<float,2>{0.968980908f, 0.141031757f},
-std::array<float,2>{0.342102885f, 0.100103185f},
-std::array<float,2>{0.754954159f, 0.745120406f},
-std::array<float,2>{0.169836804f, 0.904391408f},
-std::array<float,2>{0.620434105f, 0.252118677f},
-std::array<float,2>{0.234122038f, 0.204425693f},
-std::array<float,2>{0.537449718f, 0.59172523f},
-std::array<float,2>{0.273399323f, 0.808297396f},
-std::array<float,2>{0.850369573f, 0.393688232f},
-std::array<float,2>{0.401716769f, 0.32690677f},
-std::array<float,2>{0.907805383f, 0.962835073f},
-std::array<float,2>{0.0695186108f, 0.677564681f},
-std::array<float,2>{0.685830355f, 0.0595891401f},
-std::array<float,2>{0.206505597f, 0.38623628f},
-std::array<float,2>{0.500964522f, 0.791447401f},
-std::array<float,2>{0.293868959f, 0.577660084f},
-std::array<float,2>{0.835490108f, 0.195844665f},
-std::array<float,2>{0.43119812f, 0.0437337756f},
-std::array<float,2>{0.892359674f, 0.671319723f},
-std::array<float,2>{0.0943122804f, 0.947642446f},
-std::array<float,2>{0.651381433f, 0.341855913f},
-std::array<float,2>{0.0205590036f, 0.133753076f},
-std::array<float,2>{0.691072345f, 0.520017147f},
-std::array<float,2>{0.464776784f, 0.86663872f},
-std::array<float,2>{0.939479113f, 0.478246331f},
-std::array<float,2>{0.354010075f, 0.271207988f},
-std::array<float,2>{0.783720374f, 0.886292756f},
-std::array<float,2>{0.152359366f, 0.727044106f},
-std::array<float,2>{0.567697108f, 0.112245813f},
-std::array<float,2>{0.0862335116f, 0.372835279f},
-std::array<float,2>{0.657699108f, 0.9838503f},
-std::array<float,2>{0.380365044f, 0.632355034f},
-std::array<float,2>{0.932517588f, 0.010981774f},
-std::array<float,2>{0.255098373f, 0.224542901f},
-std::array<float,2>{0.868510902f, 0.608512998f},
-std::array<float,2>{0.24106124f, 0.757018745f},
-std::array<float,2>{0.552758694f, 0.410654217f},
-std::array<float,2>{0.182766289f, 0.0886898264f},
-std::array<float,2>{0.602039754f, 0.69112891f},
-std::array<float,2>{0.318198144f, 0.925048828f},
-std::array<float,2>{0.779437125f, 0.287163258f},
-std::array<float,2>{0.486883461f, 0.458420634f},
-std::array<float,2>{0.99182409f, 0.838884652f},
-std::array<float,2>{0.0330219269f, 0.544315934f},
-std::array<float,2>{0.731883585f, 0.160270557f},
-std::array<float,2>{0.179016396f, 0.34880811f},
-std::array<float,2>{0.5976367f, 0.988452911f},
-std::array<float,2>{0.323935449f, 0.65489924f},
-std::array<float,2>{0.768740773f, 0.01950581f},
-std::array<float,2>{0.495672822f, 0.240359202f},
-std::array<float,2>{0.993198693f, 0.6116817f},
-std::array<float,2>{0.0444399379f, 0.765691876f},
-std::array<float,2>{0.720201194f, 0.433130294f},
-std::array<float,2>{0.0853808671f, 0.0625733733f},
-std::array<float,2>{0.664565384f, 0.715100348f},
-std::array<float,2>{0.385810852f, 0.915382504f},
-std::array<float,2>{0.928939879f, 0.30648154f},
-std::array<float,2>{0.265441775f, 0.448257357f},
-std::array<float,2>{0.866609633f, 0.82630378f},
-std::array<float,2>{0.246244207f, 0.555393219f},
-std::array<float,2>{0.558993399f, 0.185383141f},
-std::array<float,2>{0.0238442365f, 0.395317346f},
-std::array<float,2>{0.698001206f, 0.811073363f},
-std::array<float,2>{0.459560603f, 0.586184144f},
-std::array<float,2>{0.947265983f, 0.208515167f},
-std::array<float,2>{0.350017667f, 0.056865152f},
-std::array<float,2>{0.790236771f, 0.675260305f},
-std::array<float,2>{0.145584837f, 0.968173087f},
-std::array<float,2>{0.574289083f, 0.320339113f},
-std::array<float,2>{0.212871775f, 0.147352517f},
-std::array<float,2>{0.509577215f, 0.514184415f},
-std::array<float,2>{0.289061755f, 0.852624476f},
-std::array<float,2>{0.839684606f, 0.49397409f},
-std::array<float,2>{0.422732741f, 0.255952507f},
-std::array<float,2>{0.903017759f, 0.898887515f},
-std::array<float,2>{0.102796338f, 0.747993171f},
-std::array<float,2>{0.648002923f, 0.0960418135f},
-std::array<float,2>{0.22567448f, 0.481225878f},
-std::array<float,2>{0.539889157f, 0.859660029f},
-std::array<float,2>{0.278254926f, 0.516463459f},
-std::array<float,2>{0.858283639f, 0.140606031f},
-std::array<float,2>{0.394092292f, 0.113436125f},
-std::array<float,2>{0.914286613f, 0.734044015f},
-std::array<float,2>{0.0738861635f, 0.886954963f},
-std::array<float,2>{0.676757753f, 0.268140435f},
-std::array<float,2>{0.0602628365f, 0.202210203f},
-std::array<float,2>{0.746977806f, 0.571756542f},
-std::array<float,2>{0.475029081f, 0.794491351f},
-std::array<float,2>{0.983818471f, 0.387142211f},
-std::array<float,2>{0.334044963f, 0.337384075f},
-std::array<float,2>{0.759860694f, 0.952357233f},
-std::array<float,2>{0.160634398f, 0.664499879f},
-std::array<float,2>{0.616420746f, 0.0409126133f},
-std::array<float,2>{0.1215422f, 0.284686029f},
-std::array<float,2>{0.627830327f, 0.927551448f},
-std::array<float,2>{0.410951465f, 0.693928242f},
-std::array<float,2>{0.878907502f, 0.092939958f},
-std::array<float,2>{0.306011766f, 0.158122286f},
-std::array<float,2>{0.820332646f, 0.540796459f},
-std::array<float,2>{0.192241505f, 0.842249691f},
-std::array<float,2>{0.528810501f, 0.453561932f},
-std::array<float,2>{0.126072794f, 0.0119354343f},
-std::array<float,2>{0.587336183f, 0.626612663f},
-std::array<float,2>{0.368151963f, 0.977374673f},
-std::array<float,2>{0.802370846f, 0.367967188f},
-std::array<float,2>{0.447022974f, 0.4081738f},
-std::array<float,2>{0.956257343f, 0.753101468f},
-std::array<float,2>{0.00269187079f, 0.602688789f},
-std::array<float,2>{0.704609513f, 0.219558924f},
-std::array<float,2>{0.199546129f, 0.276898265f},
-std::array<float,2>{0.522804081f, 0.877559483f},
-std::array<float,2>{0.300438136f, 0.720100403f},
-std::array<float,2>{0.818107247f, 0.117426358f},
-std::array<float,2>{0.420326978f, 0.130906135f},
-std::array<float,2>{0.885562122f, 0.528206587f},
-std::array<float,2>{0.113335788f, 0.8673805f},
-std::array<float,2>{0.63665396f, 0.469738513f},
-std::array<float,2>{0.014940951f, 0.0355258435f},
-std::array<float,2>{0.712959886f, 0.662449896f},
-std::array<float,2>{0.44267121f, 0.938747823f},
-std::array<float,2>{0.968217313f, 0.332764596f},
-std::array<float,2>{0.364510447f, 0.380250752f},
-std::array<float,2>{0.811521888f, 0.786947489f},
-std::array<float,2>{0.135078818f, 0.568206429f},
-std::array<float,2>{0.580027759f, 0.195311174f},
-std::array<float,2>{0.065252386f, 0.46210444f},
-std::array<float,2>{0.683574736f, 0.828849375f},
-std::array<float,2>{0.406154573f, 0.534956336f},
-std::array<float,2>{0.913482368f, 0.170009047f},
-std::array<float,2>{0.266400099f, 0.0822190493f},
-std::array<float,2>{0.845112503f, 0.698169172f},
-std::array<float,2>{0.226675436f, 0.932195783f},
-std::array<float,2>{0.534952283f, 0.295862287f},
-std::array<float,2>{0.166374803f, 0.227644071f},
-std::array<float,2>{0.623470426f, 0.597982764f},
-std::array<float,2>{0.336258799f, 0.758522689f},
-std::array<float,2>{0.750897646f, 0.41700986f},
-std::array<float,2>{0.482108235f, 0.367015511f},
-std::array<float,2>{0.972761869f, 0.970079541f},
-std::array<float,2>{0.0474400781f, 0.639744759f},
-std::array<float,2>{0.738743603f, 8.58735511e-05f},
-std::array<float,2>{0.152273193f, 0.428287208f},
-std::array<float,2>{0.565176606f, 0.781036377f},
-std::array<float,2>{0.35883379f, 0.622711539f},
-std::array<float,2>{0.786130309f, 0.246764615f},
-std::array<float,2>{0.467171013f, 0.02949908f},
-std::array<float,2>{0.942560077f, 0.644934416f},
-std::array<float,2>{0.0170346871f, 0.999927044f},
-std::array<float,2>{0.692083836f, 0.356642902f},
-std::array<float,2>{0.0998896211f, 0.178236753f},
-std::array<float,2>{0.655831456f, 0.551849425f},
-std::array<float,2>{0.436208338f, 0.819898546f},
-std::array<float,2>{0.898178697f, 0.440855622f},
-std::array<float,2>{0.289729655f, 0.299327791f},
-std::array<float,2>{0.82986033f, 0.907825172f},
-std::array<float,2>{0.209315866f, 0.710861206f},
-std::array<float,2>{0.50453192f, 0.076633893f},
-std::array<float,2>{0.0382362567f, 0.320145845f},
-std::array<float,2>{0.727691472f, 0.954119444f},
-std::array<float,2>{0.489949405f, 0.686156809f},
-std::array<float,2>{0.985005736f, 0.0488027968f},
-std::array<float,2>{0.314506561f, 0.217312247f},
-std::array<float,2>{0.776581347f, 0.579712391f},
-std::array<float,2>{0.187010825f, 0.803727627f},
-std::array<float,2>{0.607877135f, 0.404684842f},
-std::array<float,2>{0.23577185f, 0.10655164f},
-std::array<float,2>{0.547682285f, 0.738011062f},
-std::array<float,2>{0.251390576f, 0.892722309f},
-std::array<float,2>{0.872761011f, 0.265341431f},
-std::array<float,2>{0.378429383f, 0.491289645f},
-std::array<float,2>{0.936842382f, 0.847090602f},
-std::array<float,2>{0.0920239016f, 0.504210711f},
-std::array<float,2>{0.663562059f, 0.149628013f},
-std::array<float,2>{0.189057976f, 0.31589666f},
-std::array<float,2>{0.524389029f, 0.957500994f},
-std::array<float,2>{0.310312152f, 0.681714058f},
-std::array<float,2>{0.826726377f, 0.0519152507f},
-std::array<float,2>{0.407355279f, 0.211389333f},
-std::array<float,2>{0.877671182f, 0.585077226f},
-std::array<float,2>{0.119832881f, 0.798002303f},
-std::array<float,2>{0.630779266f, 0.399013042f},
-std::array<float,2>{0.00440835347f, 0.104547232f},
-std::array<float,2>{0.710225463f, 0.740292132f},
-std::array<float,2>{0.452044457f, 0.895718396f},
-std::array<float,2>{0.958079994f, 0.258379579f},
-std::array<float,2>{0.373450994f, 0.487947613f},
-std::array<float,2>{0.798046589f, 0.84825635f},
-std::array<float,2>{0.129395932f, 0.501235723f},
-std::array<float,2>{0.590807676f, 0.154851824f},
-std::array<float,2>{0.0762869045f, 0.425527006f},
-std::array<float,2>{0.672554731f, 0.774188519f},
-std::array<float,2>{0.398281991f, 0.618901968f},
-std::array<float,2>{0.918877363f, 0.244867489f},
-std::array<float,2>{0.273700088f, 0.0272121187f},
-std::array<float,2>{0.852550983f, 0.640731454f},
-std::array<float,2>{0.221312299f, 0.992548585f},
-std::array<float,2>{0.544903457f, 0.353197008f},
-std::array<float,2>{0.159119204f, 0.17254509f},
-std::array<float,2>{0.61065954f, 0.548131526f},
-std::array<float,2>{0.331289321f, 0.814871132f},
-std::array<float,2>{0.7625494f, 0.443687916f},
-std::array<float,2>{0.471758813f, 0.302273542f},
-std::array<float,2>{0.979819715f, 0.911395371f},
-std::array<float,2>{0.0552143976f, 0.703342736f},
-std::array<float,2>{0.743696511f, 0.0703878552f},
-std::array<float,2>{0.142732069f, 0.46629402f},
-std::array<float,2>{0.571945727f, 0.83425051f},
-std::array<float,2>{0.344907612f, 0.535871327f},
-std::array<float,2>{0.793241918f, 0.164364383f},
-std::array<float,2>{0.45511204f, 0.0796766728f},
-std::array<float,2>{0.950475097f, 0.701623499f},
-std::array<float,2>{0.0287757441f, 0.935674131f},
-std::array<float,2>{0.70101589f, 0.291297823f},
-std::array<float,2>{0.10569647f, 0.23187393f},
-std::array<float,2>{0.641653359f, 0.594656289f},
-std::array<float,2>{0.427011281f, 0.762852073f},
-std::array<float,2>{0.89865011f, 0.420661092f},
-std::array<float,2>{0.28440389f, 0.36031577f},
-std::array<float,2>{0.842870712f, 0.973139942f},
-std::array<float,2>{0.217351064f, 0.63285774f},
-std::array<float,2>{0.515314341f, 0.00673401123f},
-std::array<float,2>{0.0423365757f, 0.278935611f},
-std::array<float,2>{0.723940194f, 0.882057905f},
-std::array<float,2>{0.496314943f, 0.726363897f},
-std::array<float,2>{0.998078883f, 0.122473747f},
-std::array<float,2>{0.325986713f, 0.127096742f},
-std::array<float,2>{0.770625293f, 0.526135921f},
-std::array<float,2>{0.174779952f, 0.872661054f},
-std::array<float,2>{0.598645985f, 0.474249035f},
-std::array<float,2>{0.243682191f, 0.033193659f},
-std::array<float,2>{0.558212996f, 0.659467936f},
-std::array<float,2>{0.260273248f, 0.944145381f},
-std::array<float,2>{0.860855162f, 0.329706788f},
-std::array<float,2>{0.38812235f, 0.377541482f},
-std::array<float,2>{0.924511552f, 0.784973919f},
-std::array<float,2>{0.0799972042f, 0.565048695f},
-std::array<float,2>{0.668027401f, 0.188441753f},
-std::array<float,2>{0.179854065f, 0.288369596f},
-std::array<float,2>{0.603655636f, 0.924337089f},
-std::array<float,2>{0.320264459f, 0.689833283f},
-std::array<float,2>{0.779148519f, 0.0891136751f},
-std::array<float,2>{0.485158652f, 0.162045613f},
-std::array<float,2>{0.989494264f, 0.543622434f},
-std::array<float,2>{0.0335813649f, 0.838039219f},
-std::array<float,2>{0.733636856f, 0.457223654f},
-std::array<float,2>{0.0880415291f, 0.0103665646f},
-std::array<float,2>{0.659581661f, 0.631312251f},
-std::array<float,2>{0.381246716f, 0.982683003f},
-std::array<float,2>{0.931608379f, 0.371126413f},
-std::array<float,2>{0.257595628f, 0.411720544f},
-std::array<float,2>{0.869289935f, 0.756647885f},
-std::array<float,2>{0.239164278f, 0.608289063f},
-std::array<float,2>{0.551798761f, 0.222730339f},
-std::array<float,2>{0.0215285867f, 0.477146178f},
-std::array<float,2>{0.688563466f, 0.866200805f},
-std::array<float,2>{0.461090684f, 0.520769715f},
-std::array<float,2>{0.939403296f, 0.13410379f},
-std::array<float,2>{0.352575541f, 0.112533703f},
-std::array<float,2>{0.782751262f, 0.728320837f},
-std::array<float,2>{0.154937252f, 0.88509959f},
-std::array<float,2>{0.568598092f, 0.270211697f},
-std::array<float,2>{0.203145266f, 0.196910664f},
-std::array<float,2>{0.502956748f, 0.576292932f},
-std::array<float,2>{0.296593249f, 0.792439044f},
-std::array<float,2>{0.832503736f, 0.384819001f},
-std::array<float,2>{0.432405323f, 0.343130738f},
-std::array<float,2>{0.893866897f, 0.948393881f},
-std::array<float,2>{0.096345067f, 0.67089659f},
-std::array<float,2>{0.648689747f, 0.0444209576f},
-std::array<float,2>{0.23191686f, 0.392599732f},
-std::array<float,2>{0.535676181f, 0.807426393f},
-std::array<float,2>{0.269978017f, 0.590766847f},
-std::array<float,2>{0.849374413f, 0.203670591f},
-std::array<float,2>{0.399029166f, 0.058859963f},
-std::array<float,2>{0.908607364f, 0.67592752f},
-std::array<float,2>{0.0667654425f, 0.961675346f},
-std::array<float,2>{0.685415149f, 0.327370107f},
-std::array<float,2>{0.0518190004f, 0.141803011f},
-std::array<float,2>{0.737937331f, 0.511279762f},
-std::array<float,2>{0.479391545f, 0.858877242f},
-std::array<float,2>{0.972014964f, 0.497562319f},
-std::array<float,2>{0.34174335f, 0.253745437f},
-std::array<float,2>{0.755868256f, 0.906219542f},
-std::array<float,2>{0.170549095f, 0.744654834f},
-std::array<float,2>{0.617637634f, 0.100746706f},
-std::array<float,2>{0.112220638f, 0.345620275f},
-std::array<float,2>{0.637700737f, 0.985309243f},
-std::array<float,2>{0.414074898f, 0.650785446f},
-std::array<float,2>{0.887792528f, 0.0197687559f},
-std::array<float,2>{0.303629994f, 0.236902952f},
-std::array<float,2>{0.814634323f, 0.6151371f},
-std::array<float,2>{0.196582958f, 0.77061677f},
-std::array<float,2>{0.519392848f, 0.435179204f},
-std::array<float,2>{0.138632819f, 0.0672269315f},
-std::array<float,2>{0.583128035f, 0.713563263f},
-std::array<float,2>{0.360022396f, 0.91797334f},
-std::array<float,2>{0.808368921f, 0.3124125f},
-std::array<float,2>{0.439682037f, 0.453002363f},
-std::array<float,2>{0.964067519f, 0.823250711f},
-std::array<float,2>{0.011412601f, 0.561661661f},
-std::array<float,2>{0.716952264f, 0.181337297f},
-std::array<float,2>{0.128214329f, 0.36888665f},
-std::array<float,2>{0.58958286f, 0.978399873f},
-std::array<float,2>{0.369460613f, 0.625740945f},
-std::array<float,2>{0.804077089f, 0.0135278478f},
-std::array<float,2>{0.447516233f, 0.219869122f},
-std::array<float,2>{0.954202354f, 0.601773202f},
-std::array<float,2>{0.00164188247f, 0.752400935f},
-std::array<float,2>{0.707008004f, 0.406529635f},
-std::array<float,2>{0.123676412f, 0.0926224813f},
-std::array<float,2>{0.62680918f, 0.694583654f},
-std::array<float,2>{0.413885295f, 0.926068246f},
-std::array<float,2>{0.88269186f, 0.28359434f},
-std::array<float,2>{0.306963384f, 0.454312265f},
-std::array<float,2>{0.823053181f, 0.843371093f},
-std::array<float,2>{0.193801984f, 0.539752066f},
-std::array<float,2>{0.530443847f, 0.156492531f},
-std::array<float,2>{0.0618836507f, 0.388351619f},
-std::array<float,2>{0.748344481f, 0.793276191f},
-std::array<float,2>{0.472989321f, 0.570957601f},
-std::array<float,2>{0.980873942f, 0.201510116f},
-std::array<float,2>{0.333930433f, 0.0399393998f},
-std::array<float,2>{0.758789778f, 0.665105581f},
-std::array<float,2>{0.16403085f, 0.951362312f},
-std::array<float,2>{0.614879847f, 0.336240858f},
-std::array<float,2>{0.223306328f, 0.139593586f},
-std::array<float,2>{0.541786551f, 0.51699096f},
-std::array<float,2>{0.280718505f, 0.86109513f},
-std::array<float,2>{0.856781304f, 0.481568098f},
-std::array<float,2>{0.391634136f, 0.269019932f},
-std::array<float,2>{0.91747278f, 0.888052166f},
-std::array<float,2>{0.0708395615f, 0.733008087f},
-std::array<float,2>{0.678096235f, 0.114665054f},
-std::array<float,2>{0.214400694f, 0.492958695f},
-std::array<float,2>{0.511709929f, 0.851835072f},
-std::array<float,2>{0.285617173f, 0.515123725f},
-std::array<float,2>{0.837454379f, 0.148253754f},
-std::array<float,2>{0.423881412f, 0.0970100611f},
-std::array<float,2>{0.905912042f, 0.746443748f},
-std::array<float,2>{0.104032815f, 0.900089025f},
-std::array<float,2>{0.64493829f, 0.256985247f},
-std::array<float,2>{0.0261415336f, 0.207448095f},
-std::array<float,2>{0.696615815f, 0.587688565f},
-std::array<float,2>{0.458702832f, 0.811692536f},
-std::array<float,2>{0.947054923f, 0.396184325f},
-std::array<float,2>{0.349493891f, 0.321872592f},
-std::array<float,2>{0.792075574f, 0.967377663f},
-std::array<float,2>{0.147927746f, 0.674511373f},
-std::array<float,2>{0.576709628f, 0.0583042353f},
-std::array<float,2>{0.082483381f, 0.305552959f},
-std::array<float,2>{0.666633487f, 0.914565504f},
-std::array<float,2>{0.384165734f, 0.716328919f},
-std::array<float,2>{0.926832557f, 0.0643636808f},
-std::array<float,2>{0.262335926f, 0.184359029f},
-std::array<float,2>{0.865184784f, 0.556047678f},
-std::array<float,2>{0.248753458f, 0.827537715f},
-std::array<float,2>{0.561345577f, 0.448109776f},
-std::array<float,2>{0.176098406f, 0.0182824265f},
-std::array<float,2>{0.594689369f, 0.65612334f},
-std::array<float,2>{0.321202606f, 0.990115762f},
-std::array<float,2>{0.766213894f, 0.348331064f},
-std::array<float,2>{0.493953317f, 0.431885988f},
-std::array<float,2>{0.994339824f, 0.767124832f},
-std::array<float,2>{0.0452452712f, 0.612619579f},
-std::array<float,2>{0.721903503f, 0.241559386f},
-std::array<float,2>{0.238222346f, 0.264452755f},
-std::array<float,2>{0.54903543f, 0.894076526f},
-std::array<float,2>{0.253348887f, 0.737190187f},
-std::array<float,2>{0.873983562f, 0.105675288f},
-std::array<float,2>{0.37573877f, 0.149372846f},
-std::array<float,2>{0.934737325f, 0.504944503f},
-std::array<float,2>{0.0912603587f, 0.84578985f},
-std::array<float,2>{0.661831141f, 0.490332991f},
-std::array<float,2>{0.0370447226f, 0.0478155091f},
-std::array<float,2>{0.729905009f, 0.686990798f},
-std::array<float,2>{0.490709782f, 0.953264832f},
-std::array<float,2>{0.987713277f, 0.318367273f},
-std::array<float,2>{0.312528074f, 0.405905008f},
-std::array<float,2>{0.773791611f, 0.802952826f},
-std::array<float,2>{0.184879243f, 0.578219295f},
-std::array<float,2>{0.605493307f, 0.218519479f},
-std::array<float,2>{0.099569343f, 0.440216154f},
-std::array<float,2>{0.654286802f, 0.818432391f},
-std::array<float,2>{0.434199274f, 0.551016331f},
-std::array<float,2>{0.896421552f, 0.179316208f},
-std::array<float,2>{0.292634666f, 0.0777642578f},
-std::array<float,2>{0.830126703f, 0.709147632f},
-std::array<float,2>{0.208591148f, 0.906549394f},
-std::array<float,2>{0.506409764f, 0.30073294f},
-std::array<float,2>{0.149069294f, 0.247721076f},
-std::array<float,2>{0.562595725f, 0.622047007f},
-std::array<float,2>{0.355753988f, 0.779720008f},
-std::array<float,2>{0.789015532f, 0.429405123f},
-std::array<float,2>{0.465115547f, 0.355490476f},
-std::array<float,2>{0.944046855f, 0.998973548f},
-std::array<float,2>{0.018786205f, 0.645559132f},
-std::array<float,2>{0.693709612f, 0.0304669663f},
-std::array<float,2>{0.164890334f, 0.416202605f},
-std::array<float,2>{0.621674061f, 0.759518445f},
-std::array<float,2>{0.338380635f, 0.59910965f},
-std::array<float,2>{0.753093302f, 0.226817325f},
-std::array<float,2>{0.483609378f, 0.00122980226f},
-std::array<float,2>{0.975181878f, 0.639179289f},
-std::array<float,2>{0.049985636f, 0.969305038f},
-std::array<float,2>{0.740399539f, 0.366060197f},
-std::array<float,2>{0.062596187f, 0.171851113f},
-std::array<float,2>{0.680554152f, 0.534155071f},
-std::array<float,2>{0.403314769f, 0.829666913f},
-std::array<float,2>{0.91119498f, 0.461257666f},
-std::array<float,2>{0.268626362f, 0.296051294f},
-std::array<float,2>{0.84733218f, 0.933268726f},
-std::array<float,2>{0.230253175f, 0.699093044f},
-std::array<float,2>{0.532148659f, 0.0836157352f},
-std::array<float,2>{0.0133854216f, 0.333710045f},
-std::array<float,2>{0.711722076f, 0.938242137f},
-std::array<float,2>{0.443512678f, 0.66344285f},
-std::array<float,2>{0.965130031f, 0.0363193527f},
-std::array<float,2>{0.366084814f, 0.193378851f},
-std::array<float,2>{0.810095906f, 0.566781521f},
-std::array<float,2>{0.134290844f, 0.785779953f},
-std::array<float,2>{0.580798268f, 0.379618376f},
-std::array<float,2>{0.201846182f, 0.119124494f},
-std::array<float,2>{0.520852923f, 0.719369113f},
-std::array<float,2>{0.297440618f, 0.87889123f},
-std::array<float,2>{0.818836749f, 0.275675684f},
-std::array<float,2>{0.418956548f, 0.469153672f},
-std::array<float,2>{0.883752286f, 0.869017184f},
-std::array<float,2>{0.115968704f, 0.528406084f},
-std::array<float,2>{0.634480834f, 0.132530913f},
-std::array<float,2>{0.2202259f, 0.354612738f},
-std::array<float,2>{0.545334935f, 0.994902849f},
-std::array<float,2>{0.276334763f, 0.643657267f},
-std::array<float,2>{0.855452836f, 0.024964245f},
-std::array<float,2>{0.39454031f, 0.242636114f},
-std::array<float,2>{0.921512961f, 0.620996058f},
-std::array<float,2>{0.0756004974f, 0.776011884f},
-std::array<float,2>{0.675378025f, 0.422424912f},
-std::array<float,2>{0.0569791943f, 0.0730736926f},
-std::array<float,2>{0.745210946f, 0.706321776f},
-std::array<float,2>{0.469013482f, 0.912361979f},
-std::array<float,2>{0.976881623f, 0.304143608f},
-std::array<float,2>{0.329577148f, 0.441880763f},
-std::array<float,2>{0.76471132f, 0.814398408f},
-std::array<float,2>{0.156580105f, 0.550381958f},
-std::array<float,2>{0.612537384f, 0.175634712f},
-std::array<float,2>{0.118244171f, 0.402040273f},
-std::array<float,2>{0.632770658f, 0.799426019f},
-std::array<float,2>{0.408494562f, 0.582896829f},
-std::array<float,2>{0.875788569f, 0.213589862f},
-std::array<float,2>{0.31223157f, 0.0531982072f},
-std::array<float,2>{0.825152755f, 0.681080401f},
-std::array<float,2>{0.191073596f, 0.960062981f},
-std::array<float,2>{0.526510358f, 0.313534766f},
-std::array<float,2>{0.132186279f, 0.153717026f},
-std::array<float,2>{0.592415631f, 0.502409637f},
-std::array<float,2>{0.371357024f, 0.850347161f},
-std::array<float,2>{0.798888505f, 0.484702736f},
-std::array<float,2>{0.450986654f, 0.26156795f},
-std::array<float,2>{0.959033966f, 0.89798069f},
-std::array<float,2>{0.00643757638f, 0.739530683f},
-std::array<float,2>{0.708044827f, 0.102292575f},
-std::array<float,2>{0.172554404f, 0.474722683f},
-std::array<float,2>{0.600482345f, 0.87311101f},
-std::array<float,2>{0.328100115f, 0.524868846f},
-std::array<float,2>{0.771609187f, 0.125286296f},
-std::array<float,2>{0.498428762f, 0.124196418f},
-std::array<float,2>{0.997244835f, 0.724304318f},
-std::array<float,2>{0.0402218699f, 0.880073547f},
-std::array<float,2>{0.724892795f, 0.281202823f},
-std::array<float,2>{0.0816638991f, 0.18957451f},
-std::array<float,2>{0.670921028f, 0.562522531f},
-std::array<float,2>{0.388828337f, 0.781894147f},
-std::array<float,2>{0.922480881f, 0.375463068f},
-std::array<float,2>{0.258613169f, 0.331286401f},
-std::array<float,2>{0.862383664f, 0.942481995f},
-std::array<float,2>{0.245446995f, 0.657848895f},
-std::array<float,2>{0.554689765f, 0.0350969657f},
-std::array<float,2>{0.0294786692f, 0.290830046f},
-std::array<float,2>{0.701209426f, 0.93497932f},
-std::array<float,2>{0.453322828f, 0.700824797f},
-std::array<float,2>{0.951728344f, 0.0817666873f},
-std::array<float,2>{0.34622249f, 0.167243108f},
-std::array<float,2>{0.796518683f, 0.537563264f},
-std::array<float,2>{0.141401842f, 0.833115041f},
-std::array<float,2>{0.573182225f, 0.46857515f},
-std::array<float,2>{0.216539308f, 0.00501754228f},
-std::array<float,2>{0.513661325f, 0.635453463f},
-std::array<float,2>{0.281978577f, 0.974950552f},
-std::array<float,2>{0.841696918f, 0.362001389f},
-std::array<float,2>{0.427791059f, 0.418643326f},
-std::array<float,2>{0.900883198f, 0.765049398f},
-std::array<float,2>{0.108061239f, 0.595956802f},
-std::array<float,2>{0.64368099f, 0.233812496f},
-std::array<float,2>{0.154228911f, 0.273195744f},
-std::array<float,2>{0.566850901f, 0.883154333f},
-std::array<float,2>{0.35514614f, 0.730422735f},
-std::array<float,2>{0.784987748f, 0.110568225f},
-std::array<float,2>{0.463785082f, 0.135088861f},
-std::array<float,2>{0.941251218f, 0.523360968f},
-std::array<float,2>{0.0196124651f, 0.863284051f},
-std::array<float,2>{0.689658046f, 0.479589164f},
-std::array<float,2>{0.0950893387f, 0.0453068465f},
-std::array<float,2>{0.651241422f, 0.668118596f},
-std::array<float,2>{0.430472076f, 0.946862936f},
-std::array<float,2>{0.891103446f, 0.339978337f},
-std::array<float,2>{0.294374526f, 0.383045584f},
-std::array<float,2>{0.834057689f, 0.78940177f},
-std::array<float,2>{0.20527643f, 0.575598836f},
-std::array<float,2>{0.501262367f, 0.199050397f},
-std::array<float,2>{0.0319145955f, 0.460538149f},
-std::array<float,2>{0.731075585f, 0.836593091f},
-std::array<float,2>{0.48783043f, 0.545378208f},
-std::array<float,2>{0.990322232f, 0.162915155f},
-std::array<float,2>{0.31675905f, 0.0872212052f},
-std::array<float,2>{0.780506015f, 0.688771844f},
-std::array<float,2>{0.182213634f, 0.922705233f},
-std::array<float,2>{0.603175282f, 0.285482466f},
-std::array<float,2>{0.241537377f, 0.224722415f},
-std::array<float,2>{0.554685831f, 0.605690777f},
-std::array<float,2>{0.25454545f, 0.75404197f},
-std::array<float,2>{0.867705226f, 0.413736641f},
-std::array<float,2>{0.378961384f, 0.373114675f},
-std::array<float,2>{0.933159769f, 0.981863678f},
-std::array<float,2>{0.0874792561f, 0.63030082f},
-std::array<float,2>{0.656279624f, 0.00957178976f},
-std::array<float,2>{0.198598117f, 0.435885519f},
-std::array<float,2>{0.515690088f, 0.773424268f},
-std::array<float,2>{0.302291065f, 0.615850449f},
-std::array<float,2>{0.813707173f, 0.234438106f},
-std::array<float,2>{0.416311949f, 0.0226182286f},
-std::array<float,2>{0.889116466f, 0.649907589f},
-std::array<float,2>{0.110255137f, 0.987915993f},
-std::array<float,2>{0.638997376f, 0.346907198f},
-std::array<float,2>{0.00802089833f, 0.182856604f},
-std::array<float,2>{0.714883864f, 0.559068382f},
-std::array<float,2>{0.439343452f, 0.82195127f},
-std::array<float,2>{0.961556613f, 0.450321853f},
-std::array<float,2>{0.36145559f, 0.308887333f},
-std::array<float,2>{0.806483448f, 0.921793699f},
-std::array<float,2>{0.139002606f, 0.710937619f},
-std::array<float,2>{0.584401309f, 0.0701487586f},
-std::array<float,2>{0.0690570772f, 0.324446678f},
-std::array<float,2>{0.687381506f, 0.963349044f},
-std::array<float,2>{0.400715679f, 0.678435385f},
-std::array<float,2>{0.906857431f, 0.0618658736f},
-std::array<float,2>{0.271529973f, 0.205899388f},
-std::array<float,2>{0.851360798f, 0.593344569f},
-std::array<float,2>{0.23293525f, 0.804972172f},
-std::array<float,2>{0.538785219f, 0.391357452f},
-std::array<float,2>{0.16857788f, 0.0993271843f},
-std::array<float,2>{0.619252503f, 0.743763447f},
-std::array<float,2>{0.343257427f, 0.903847277f},
-std::array<float,2>{0.754698455f, 0.251589864f},
-std::array<float,2>{0.477896631f, 0.498817891f},
-std::array<float,2>{0.970023811f, 0.857367456f},
-std::array<float,2>{0.0538489185f, 0.509555757f},
-std::array<float,2>{0.73613137f, 0.143003747f},
-std::array<float,2>{0.161556542f, 0.338104904f},
-std::array<float,2>{0.616141319f, 0.951017618f},
-std::array<float,2>{0.33569324f, 0.667068779f},
-std::array<float,2>{0.760833025f, 0.042068664f},
-std::array<float,2>{0.476405174f, 0.200703174f},
-std::array<float,2>{0.982909441f, 0.57393527f},
-std::array<float,2>{0.0591883324f, 0.795838714f},
-std::array<float,2>{0.747735023f, 0.390439898f},
-std::array<float,2>{0.0727832615f, 0.117108688f},
-std::array<float,2>{0.677594602f, 0.732354462f},
-std::array<float,2>{0.392637879f, 0.89021498f},
-std::array<float,2>{0.915778756f, 0.26649794f},
-std::array<float,2>{0.279291689f, 0.48377043f},
-std::array<float,2>{0.858807027f, 0.862917066f},
-std::array<float,2>{0.224990726f, 0.519185543f},
-std::array<float,2>{0.540988266f, 0.137625813f},
-std::array<float,2>{0.00373430597f, 0.409122586f},
-std::array<float,2>{0.703300297f, 0.751624584f},
-std::array<float,2>{0.445979118f, 0.605254948f},
-std::array<float,2>{0.955665529f, 0.222194046f},
-std::array<float,2>{0.368772894f, 0.0143145267f},
-std::array<float,2>{0.801547527f, 0.62741524f},
-std::array<float,2>{0.125254437f, 0.978819311f},
-std::array<float,2>{0.586805582f, 0.370794982f},
-std::array<float,2>{0.193287149f, 0.159496218f},
-std::array<float,2>{0.527422547f, 0.542295158f},
-std::array<float,2>{0.305203825f, 0.840095222f},
-std::array<float,2>{0.821609914f, 0.455218077f},
-std::array<float,2>{0.411352426f, 0.283202261f},
-std::array<float,2>{0.879973054f, 0.927878082f},
-std::array<float,2>{0.122347578f, 0.692888737f},
-std::array<float,2>{0.627945364f, 0.0904489756f},
-std::array<float,2>{0.247521982f, 0.446610481f},
-std::array<float,2>{0.560058355f, 0.825343251f},
-std::array<float,2>{0.263755202f, 0.557468772f},
-std::array<float,2>{0.865773201f, 0.186319605f},
-std::array<float,2>{0.384813666f, 0.0650710389f},
-std::array<float,2>{0.928517878f, 0.716998637f},
-std::array<float,2>{0.0843403339f, 0.917052448f},
-std::array<float,2>{0.66527611f, 0.306833833f},
-std::array<float,2>{0.0434611291f, 0.238286436f},
-std::array<float,2>{0.719359398f, 0.609386683f},
-std::array<float,2>{0.494410902f, 0.767766535f},
-std::array<float,2>{0.992338538f, 0.430875123f},
-std::array<float,2>{0.323055685f, 0.350608706f},
-std::array<float,2>{0.768125117f, 0.990275621f},
-std::array<float,2>{0.178109139f, 0.653255463f},
-std::array<float,2>{0.596014678f, 0.0172195174f},
-std::array<float,2>{0.101853549f, 0.255644709f},
-std::array<float,2>{0.646710515f, 0.900818765f},
-std::array<float,2>{0.423763961f, 0.748649776f},
-std::array<float,2>{0.903712571f, 0.0948562324f},
-std::array<float,2>{0.287109464f, 0.146476194f},
-std::array<float,2>{0.838065565f, 0.511921644f},
-std::array<float,2>{0.211834669f, 0.853731513f},
-std::array<float,2>{0.508510888f, 0.49498716f},
-std::array<float,2>{0.144932821f, 0.0559932552f},
-std::array<float,2>{0.5757671f, 0.672564328f},
-std::array<float,2>{0.350690842f, 0.966236115f},
-std::array<float,2>{0.789607048f, 0.324172735f},
-std::array<float,2>{0.46046859f, 0.396748632f},
-std::array<float,2>{0.948684931f, 0.809003413f},
-std::array<float,2>{0.0250997748f, 0.588496447f},
-std::array<float,2>{0.698696613f, 0.209661931f},
-std::array<float,2>{0.210215449f, 0.29867661f},
-std::array<float,2>{0.505226612f, 0.909843862f},
-std::array<float,2>{0.290126771f, 0.708543599f},
-std::array<float,2>{0.828362882f, 0.0760122091f},
-std::array<float,2>{0.437393636f, 0.177329943f},
-std::array<float,2>{0.897420228f, 0.554649472f},
-std::array<float,2>{0.100675963f, 0.81796664f},
-std::array<float,2>{0.654605329f, 0.437882423f},
-std::array<float,2>{0.0165590197f, 0.0286478251f},
-std::array<float,2>{0.692506194f, 0.647708893f},
-std::array<float,2>{0.468623102f, 0.997027814f},
-std::array<float,2>{0.942138731f, 0.357561678f},
-std::array<float,2>{0.358019412f, 0.426386178f},
-std::array<float,2>{0.786629498f, 0.778552413f},
-std::array<float,2>{0.150775224f, 0.623635828f},
-std::array<float,2>{0.566373348f, 0.248773918f},
-std::array<float,2>{0.0936147496f, 0.490004003f},
-std::array<float,2>{0.662302434f, 0.844973445f},
-std::array<float,2>{0.377835244f, 0.506787241f},
-std::array<float,2>{0.935651243f, 0.151790828f},
-std::array<float,2>{0.2504372f, 0.107689783f},
-std::array<float,2>{0.871314704f, 0.735560417f},
-std::array<float,2>{0.235317722f, 0.892564297f},
-std::array<float,2>{0.548504829f, 0.262077689f},
-std::array<float,2>{0.186243251f, 0.215358317f},
-std::array<float,2>{0.608781934f, 0.581481516f},
-std::array<float,2>{0.316343278f, 0.802369714f},
-std::array<float,2>{0.775744975f, 0.402815789f},
-std::array<float,2>{0.488628864f, 0.316653997f},
-std::array<float,2>{0.98603189f, 0.955973089f},
-std::array<float,2>{0.0376363695f, 0.684903264f},
-std::array<float,2>{0.726955175f, 0.0490130708f},
-std::array<float,2>{0.136235178f, 0.381486267f},
-std::array<float,2>{0.578353167f, 0.78878051f},
-std::array<float,2>{0.363733917f, 0.568383574f},
-std::array<float,2>{0.811681688f, 0.191815525f},
-std::array<float,2>{0.442090929f, 0.0386337303f},
-std::array<float,2>{0.96709913f, 0.660215497f},
-std::array<float,2>{0.0140766203f, 0.939939916f},
-std::array<float,2>{0.714819193f, 0.334262073f},
-std::array<float,2>{0.115205459f, 0.130762681f},
-std::array<float,2>{0.635391951f, 0.531064987f},
-std::array<float,2>{0.421612501f, 0.870695174f},
-std::array<float,2>{0.885865629f, 0.470873535f},
-std::array<float,2>{0.299255878f, 0.274220467f},
-std::array<float,2>{0.816639125f, 0.875549376f},
-std::array<float,2>{0.200854853f, 0.721460044f},
-std::array<float,2>{0.521857023f, 0.119624235f},
-std::array<float,2>{0.0485695675f, 0.364776015f},
-std::array<float,2>{0.739428997f, 0.972416282f},
-std::array<float,2>{0.480992019f, 0.638645768f},
-std::array<float,2>{0.974573016f, 0.00389953889f},
-std::array<float,2>{0.337699801f, 0.22891961f},
-std::array<float,2>{0.751033127f, 0.600895345f},
-std::array<float,2>{0.167786896f, 0.760756552f},
-std::array<float,2>{0.624859333f, 0.41460821f},
-std::array<float,2>{0.228403792f, 0.0843145996f},
-std::array<float,2>{0.534109175f, 0.696676314f},
-std::array<float,2>{0.266684264f, 0.930621684f},
-std::array<float,2>{0.84446764f, 0.294447541f},
-std::array<float,2>{0.404455632f, 0.463955611f},
-std::array<float,2>{0.912368417f, 0.83136338f},
-std::array<float,2>{0.0663554221f, 0.531660616f},
-std::array<float,2>{0.681894958f, 0.168393686f},
-std::array<float,2>{0.197072461f, 0.347205848f},
-std::array<float,2>{0.518836498f, 0.987497628f},
-std::array<float,2>{0.302989393f, 0.649420798f},
-std::array<float,2>{0.81502074f, 0.0230438802f},
-std::array<float,2>{0.415017933f, 0.235325485f},
-std::array<float,2>{0.888273299f, 0.61539489f},
-std::array<float,2>{0.111508816f, 0.772573829f},
-std::array<float,2>{0.638450503f, 0.436433703f},
-std::array<float,2>{0.0110314796f, 0.0695940629f},
-std::array<float,2>{0.717504442f, 0.711737752f},
-std::array<float,2>{0.440002203f, 0.920979381f},
-std::array<float,2>{0.964665174f, 0.309346884f},
-std::array<float,2>{0.359574795f, 0.450692207f},
-std::array<float,2>{0.807727098f, 0.821293473f},
-std::array<float,2>{0.137726963f, 0.559500873f},
-std::array<float,2>{0.583831072f, 0.183217943f},
-std::array<float,2>{0.0672656968f, 0.3909235f},
-std::array<float,2>{0.684963167f, 0.805266023f},
-std::array<float,2>{0.398771673f, 0.59278518f},
-std::array<float,2>{0.908806682f, 0.205492973f},
-std::array<float,2>{0.270235419f, 0.062435139f},
-std::array<float,2>{0.848886967f, 0.678150177f},
-std::array<float,2>{0.232316807f, 0.963470936f},
-std::array<float,2>{0.535158992f, 0.324777454f},
-std::array<float,2>{0.170119375f, 0.14336893f},
-std::array<float,2>{0.617987394f, 0.508846164f},
-std::array<float,2>{0.340931773f, 0.856697679f},
-std::array<float,2>{0.756509483f, 0.498211473f},
-std::array<float,2>{0.478639513f, 0.251217812f},
-std::array<float,2>{0.972218096f, 0.903718531f},
-std::array<float,2>{0.0524166934f, 0.743215203f},
-std::array<float,2>{0.737403631f, 0.0988029242f},
-std::array<float,2>{0.154698104f, 0.480188161f},
-std::array<float,2>{0.569067895f, 0.863851905f},
-std::array<float,2>{0.353261262f, 0.52264142f},
-std::array<float,2>{0.782461286f, 0.135355473f},
-std::array<float,2>{0.461719036f, 0.11096935f},
-std::array<float,2>{0.938889325f, 0.729750097f},
-std::array<float,2>{0.0220289566f, 0.883634806f},
-std::array<float,2>{0.689271331f, 0.272732496f},
-std::array<float,2>{0.0959904715f, 0.198523536f},
-std::array<float,2>{0.649303555f, 0.575910389f},
-std::array<float,2>{0.431977779f, 0.78988117f},
-std::array<float,2>{0.894323885f, 0.383562267f},
-std::array<float,2>{0.296338856f, 0.340772182f},
-std::array<float,2>{0.83289057f, 0.946333528f},
-std::array<float,2>{0.203773886f, 0.668882251f},
-std::array<float,2>{0.503558457f, 0.0455443598f},
-std::array<float,2>{0.03385178f, 0.285803795f},
-std::array<float,2>{0.734054863f, 0.921901822f},
-std::array<float,2>{0.484564334f, 0.689351678f},
-std::array<float,2>{0.990037084f, 0.0876530111f},
-std::array<float,2>{0.319534451f, 0.162351668f},
-std::array<float,2>{0.778336704f, 0.545640111f},
-std::array<float,2>{0.180285364f, 0.836352289f},
-std::array<float,2>{0.604444921f, 0.460330158f},
-std::array<float,2>{0.238326907f, 0.0090113664f},
-std::array<float,2>{0.552308261f, 0.630553305f},
-std::array<float,2>{0.256893367f, 0.982384682f},
-std::array<float,2>{0.869827449f, 0.373748809f},
-std::array<float,2>{0.381364912f, 0.413113773f},
-std::array<float,2>{0.930852413f, 0.754400134f},
-std::array<float,2>{0.0886227861f, 0.606021702f},
-std::array<float,2>{0.659865975f, 0.22519426f},
-std::array<float,2>{0.174236536f, 0.280496359f},
-std::array<float,2>{0.599244833f, 0.880475581f},
-std::array<float,2>{0.325453192f, 0.723756433f},
-std::array<float,2>{0.771285474f, 0.124797255f},
-std::array<float,2>{0.496610671f, 0.125877634f},
-std::array<float,2>{0.998706043f, 0.524938762f},
-std::array<float,2>{0.0428124033f, 0.873591065f},
-std::array<float,2>{0.72430402f, 0.475378156f},
-std::array<float,2>{0.0793256611f, 0.0344624445f},
-std::array<float,2>{0.668848038f, 0.657592535f},
-std::array<float,2>{0.38822329f, 0.943096697f},
-std::array<float,2>{0.924312949f, 0.331651449f},
-std::array<float,2>{0.260055572f, 0.375912935f},
-std::array<float,2>{0.860557914f, 0.781397104f},
-std::array<float,2>{0.243396804f, 0.563336074f},
-std::array<float,2>{0.557805061f, 0.190373957f},
-std::array<float,2>{0.0291379411f, 0.46811375f},
-std::array<float,2>{0.700512052f, 0.833687007f},
-std::array<float,2>{0.456004679f, 0.537720382f},
-std::array<float,2>{0.950861871f, 0.167784005f},
-std::array<float,2>{0.345218688f, 0.08122091f},
-std::array<float,2>{0.793501019f, 0.700313389f},
-std::array<float,2>{0.143156394f, 0.935515106f},
-std::array<float,2>{0.571294069f, 0.290088385f},
-std::array<float,2>{0.21721898f, 0.234015122f},
-std::array<float,2>{0.514680266f, 0.596303761f},
-std::array<float,2>{0.284819305f, 0.765372515f},
-std::array<float,2>{0.843410075f, 0.418020368f},
-std::array<float,2>{0.427444875f, 0.361465544f},
-std::array<float,2>{0.899275362f, 0.975443125f},
-std::array<float,2>{0.106285021f, 0.63501519f},
-std::array<float,2>{0.642395437f, 0.00554506108f},
-std::array<float,2>{0.220732465f, 0.4221614f},
-std::array<float,2>{0.544387162f, 0.775641203f},
-std::array<float,2>{0.274048477f, 0.620529175f},
-std::array<float,2>{0.853097618f, 0.242848188f},
-std::array<float,2>{0.397846878f, 0.0247975197f},
-std::array<float,2>{0.91838342f, 0.644159794f},
-std::array<float,2>{0.0770852566f, 0.994176865f},
-std::array<float,2>{0.67194593f, 0.355189294f},
-std::array<float,2>{0.0548197068f, 0.175065622f},
-std::array<float,2>{0.743216097f, 0.550197899f},
-std::array<float,2>{0.472569704f, 0.813791513f},
-std::array<float,2>{0.97999382f, 0.442146778f},
-std::array<float,2>{0.331586123f, 0.30440408f},
-std::array<float,2>{0.761781573f, 0.912853479f},
-std::array<float,2>{0.158317864f, 0.70682168f},
-std::array<float,2>{0.61124593f, 0.0723970011f},
-std::array<float,2>{0.119284667f, 0.314031422f},
-std::array<float,2>{0.630331695f, 0.960910618f},
-std::array<float,2>{0.408026934f, 0.681395292f},
-std::array<float,2>{0.876985788f, 0.0534891412f},
-std::array<float,2>{0.309844255f, 0.213064238f},
-std::array<float,2>{0.826363981f, 0.582413495f},
-std::array<float,2>{0.188678265f, 0.7991063f},
-std::array<float,2>{0.523900628f, 0.401421309f},
-std::array<float,2>{0.129229635f, 0.101975508f},
-std::array<float,2>{0.590156078f, 0.739760697f},
-std::array<float,2>{0.373668998f, 0.897470355f},
-std::array<float,2>{0.798529208f, 0.261124045f},
-std::array<float,2>{0.451457173f, 0.484867394f},
-std::array<float,2>{0.958574891f, 0.849726498f},
-std::array<float,2>{0.00403794786f, 0.502844334f},
-std::array<float,2>{0.710801184f, 0.153812483f},
-std::array<float,2>{0.134233668f, 0.334879547f},
-std::array<float,2>{0.580389857f, 0.940207601f},
-std::array<float,2>{0.365431458f, 0.66109854f},
-std::array<float,2>{0.809937239f, 0.0385336205f},
-std::array<float,2>{0.44388926f, 0.192247316f},
-std::array<float,2>{0.965535223f, 0.569204986f},
-std::array<float,2>{0.012920591f, 0.788254201f},
-std::array<float,2>{0.711073875f, 0.380884409f},
-std::array<float,2>{0.115514204f, 0.119670264f},
-std::array<float,2>{0.634165823f, 0.720853388f},
-std::array<float,2>{0.419579357f, 0.875299096f},
-std::array<float,2>{0.883139849f, 0.273461282f},
-std::array<float,2>{0.297122478f, 0.471368104f},
-std::array<float,2>{0.819112003f, 0.870539844f},
-std::array<float,2>{0.201268256f, 0.530364513f},
-std::array<float,2>{0.521064878f, 0.129910395f},
-std::array<float,2>{0.0507786311f, 0.41453737f},
-std::array<float,2>{0.740751803f, 0.761394918f},
-std::array<float,2>{0.484088898f, 0.601257861f},
-std::array<float,2>{0.974637091f, 0.229255468f},
-std::array<float,2>{0.338169873f, 0.00323524582f},
-std::array<float,2>{0.753755212f, 0.637796879f},
-std::array<float,2>{0.164112732f, 0.972059369f},
-std::array<float,2>{0.621096253f, 0.36433816f},
-std::array<float,2>{0.229745805f, 0.16854389f},
-std::array<float,2>{0.531521857f, 0.531922102f},
-std::array<float,2>{0.269299924f, 0.831712186f},
-std::array<float,2>{0.846806467f, 0.464603633f},
-std::array<float,2>{0.402597249f, 0.293976128f},
-std::array<float,2>{0.911778808f, 0.930084407f},
-std::array<float,2>{0.0630732849f, 0.697235703f},
-std::array<float,2>{0.680047631f, 0.0846143961f},
-std::array<float,2>{0.208238751f, 0.438289046f},
-std::array<float,2>{0.506075442f, 0.817385197f},
-std::array<float,2>{0.292332202f, 0.553903341f},
-std::array<float,2>{0.830882907f, 0.176810965f},
-std::array<float,2>{0.434073299f, 0.0754609406f},
-std::array<float,2>{0.895983279f, 0.708491445f},
-std::array<float,2>{0.0988935307f, 0.90949744f},
-std::array<float,2>{0.653475881f, 0.298119605f},
-std::array<float,2>{0.0191990566f, 0.248203993f},
-std::array<float,2>{0.694008291f, 0.623198748f},
-std::array<float,2>{0.465747088f, 0.779130578f},
-std::array<float,2>{0.94340533f, 0.425939381f},
-std::array<float,2>{0.356323808f, 0.358134985f},
-std::array<float,2>{0.788234055f, 0.996464133f},
-std::array<float,2>{0.148863181f, 0.648142993f},
-std::array<float,2>{0.56333214f, 0.0289116353f},
-std::array<float,2>{0.0917951912f, 0.262615234f},
-std::array<float,2>{0.661500812f, 0.891745329f},
-std::array<float,2>{0.375109255f, 0.735902727f},
-std::array<float,2>{0.935193598f, 0.108247027f},
-std::array<float,2>{0.253835201f, 0.151863009f},
-std::array<float,2>{0.873183548f, 0.505959749f},
-std::array<float,2>{0.237566844f, 0.84567517f},
-std::array<float,2>{0.549452126f, 0.489283621f},
-std::array<float,2>{0.185393363f, 0.0497745425f},
-std::array<float,2>{0.60595721f, 0.68529886f},
-std::array<float,2>{0.313169837f, 0.955545008f},
-std::array<float,2>{0.773944438f, 0.317144185f},
-std::array<float,2>{0.491086453f, 0.403033167f},
-std::array<float,2>{0.987860799f, 0.801925004f},
-std::array<float,2>{0.0363736115f, 0.581720591f},
-std::array<float,2>{0.730227411f, 0.215021327f},
-std::array<float,2>{0.248188078f, 0.307518572f},
-std::array<float,2>{0.560662389f, 0.917691886f},
-std::array<float,2>{0.262120783f, 0.717761755f},
-std::array<float,2>{0.864539921f, 0.0645230711f},
-std::array<float,2>{0.384357691f, 0.185974494f},
-std::array<float,2>{0.927665234f, 0.556796312f},
-std::array<float,2>{0.0825813413f, 0.826033354f},
-std::array<float,2>{0.666404784f, 0.446963698f},
-std::array<float,2>{0.0455731302f, 0.0170059595f},
-std::array<float,2>{0.722236574f, 0.652393818f},
-std::array<float,2>{0.493414015f, 0.991006076f},
-std::array<float,2>{0.994836986f, 0.351126105f},
-std::array<float,2>{0.320611328f, 0.43119058f},
-std::array<float,2>{0.765827715f, 0.768220127f},
-std::array<float,2>{0.17630899f, 0.610102952f},
-std::array<float,2>{0.593973398f, 0.239076614f},
-std::array<float,2>{0.10396564f, 0.494525403f},
-std::array<float,2>{0.645401299f, 0.854082286f},
-std::array<float,2>{0.424533695f, 0.512223065f},
-std::array<float,2>{0.905275762f, 0.145819008f},
-std::array<float,2>{0.28602463f, 0.0955593213f},
-std::array<float,2>{0.837125123f, 0.748175621f},
-std::array<float,2>{0.213966548f, 0.901184916f},
-std::array<float,2>{0.510875344f, 0.255128682f},
-std::array<float,2>{0.14828296f, 0.209399074f},
-std::array<float,2>{0.576639235f, 0.588102281f},
-std::array<float,2>{0.34894523f, 0.809382856f},
-std::array<float,2>{0.792925894f, 0.397090405f},
-std::array<float,2>{0.458466232f, 0.323294878f},
-std::array<float,2>{0.946425855f, 0.966592431f},
-std::array<float,2>{0.0254961234f, 0.672241628f},
-std::array<float,2>{0.697205842f, 0.0563762113f},
-std::array<float,2>{0.163120702f, 0.389977455f},
-std::array<float,2>{0.614528477f, 0.795269608f},
-std::array<float,2>{0.333013237f, 0.573530316f},
-std::array<float,2>{0.759461045f, 0.200274646f},
-std::array<float,2>{0.473430812f, 0.0425320826f},
-std::array<float,2>{0.981412649f, 0.667856872f},
-std::array<float,2>{0.0621426105f, 0.950229704f},
-std::array<float,2>{0.748942137f, 0.338661134f},
-std::array<float,2>{0.0707145929f, 0.13701643f},
-std::array<float,2>{0.678357601f, 0.51877284f},
-std::array<float,2>{0.392354012f, 0.862466872f},
-std::array<float,2>{0.917550504f, 0.484020591f},
-std::array<float,2>{0.28080073f, 0.266050398f},
-std::array<float,2>{0.856955409f, 0.889859974f},
-std::array<float,2>{0.22304067f, 0.731814802f},
-std::array<float,2>{0.541080952f, 0.116319843f},
-std::array<float,2>{0.00128077704f, 0.370588213f},
-std::array<float,2>{0.706492364f, 0.979066849f},
-std::array<float,2>{0.448108822f, 0.627928913f},
-std::array<float,2>{0.954947829f, 0.0138068218f},
-std::array<float,2>{0.369976699f, 0.221774474f},
-std::array<float,2>{0.80447197f, 0.604927778f},
-std::array<float,2>{0.128509402f, 0.751345515f},
-std::array<float,2>{0.58915621f, 0.408542603f},
-std::array<float,2>{0.193987682f, 0.0900330693f},
-std::array<float,2>{0.531171918f, 0.692776561f},
-std::array<float,2>{0.3071509f, 0.92857635f},
-std::array<float,2>{0.822300017f, 0.282576412f},
-std::array<float,2>{0.413375109f, 0.455658227f},
-std::array<float,2>{0.88217926f, 0.840574443f},
-std::array<float,2>{0.123433404f, 0.542685091f},
-std::array<float,2>{0.626275539f, 0.160009295f},
-std::array<float,2>{0.232673109f, 0.32788834f},
-std::array<float,2>{0.538233101f, 0.961282015f},
-std::array<float,2>{0.272211581f, 0.676452279f},
-std::array<float,2>{0.850782633f, 0.0595646836f},
-std::array<float,2>{0.401082873f, 0.20321703f},
-std::array<float,2>{0.906458497f, 0.590048373f},
-std::array<float,2>{0.068776682f, 0.806999266f},
-std::array<float,2>{0.686543345f, 0.393443227f},
-std::array<float,2>{0.0545917638f, 0.101444453f},
-std::array<float,2>{0.735365868f, 0.744214714f},
-std::array<float,2>{0.478182107f, 0.905521393f},
-std::array<float,2>{0.970444739f, 0.253363132f},
-std::array<float,2>{0.343528688f, 0.497478932f},
-std::array<float,2>{0.754370749f, 0.859129012f},
-std::array<float,2>{0.168326795f, 0.511033416f},
-std::array<float,2>{0.619806528f, 0.142283738f},
-std::array<float,2>{0.109751567f, 0.434629589f},
-std::array<float,2>{0.639579177f, 0.771150351f},
-std::array<float,2>{0.416540653f, 0.614678621f},
-std::array<float,2>{0.889517367f, 0.236736834f},
-std::array<float,2>{0.302031726f, 0.0200955141f},
-std::array<float,2>{0.814169824f, 0.651358783f},
-std::array<float,2>{0.199064121f, 0.984407246f},
-std::array<float,2>{0.516437948f, 0.344793856f},
-std::array<float,2>{0.139329672f, 0.180933297f},
-std::array<float,2>{0.584503829f, 0.562164903f},
-std::array<float,2>{0.362262517f, 0.824179113f},
-std::array<float,2>{0.805820465f, 0.45216766f},
-std::array<float,2>{0.438668966f, 0.311906606f},
-std::array<float,2>{0.961185813f, 0.918891788f},
-std::array<float,2>{0.00875256862f, 0.712920547f},
-std::array<float,2>{0.715771973f, 0.0668078512f},
-std::array<float,2>{0.181999713f, 0.457747549f},
-std::array<float,2>{0.602610826f, 0.838415802f},
-std::array<float,2>{0.317142516f, 0.543372869f},
-std::array<float,2>{0.780844212f, 0.16158545f},
-std::array<float,2>{0.487463176f, 0.0897395834f},
-std::array<float,2>{0.991008878f, 0.690251112f},
-std::array<float,2>{0.0313552842f, 0.923913181f},
-std::array<float,2>{0.730507076f, 0.288715929f},
-std::array<float,2>{0.0871539339f, 0.223334149f},
-std::array<float,2>{0.656849742f, 0.607448101f},
-std::array<float,2>{0.379654467f, 0.75603193f},
-std::array<float,2>{0.9330073f, 0.41129756f},
-std::array<float,2>{0.254202068f, 0.371841878f},
-std::array<float,2>{0.867219269f, 0.983256578f},
-std::array<float,2>{0.242171198f, 0.631443918f},
-std::array<float,2>{0.554062426f, 0.00991944317f},
-std::array<float,2>{0.0204128791f, 0.269810289f},
-std::array<float,2>{0.690390348f, 0.885552168f},
-std::array<float,2>{0.463080019f, 0.727771878f},
-std::array<float,2>{0.940544367f, 0.113233499f},
-std::array<float,2>{0.354764014f, 0.134593666f},
-std::array<float,2>{0.784487665f, 0.521159649f},
-std::array<float,2>{0.153543487f, 0.865663528f},
-std::array<float,2>{0.567008972f, 0.4765912f},
-std::array<float,2>{0.205912605f, 0.0448054373f},
-std::array<float,2>{0.501646936f, 0.670294344f},
-std::array<float,2>{0.29456982f, 0.949121714f},
-std::array<float,2>{0.834814012f, 0.343621463f},
-std::array<float,2>{0.429705173f, 0.385401726f},
-std::array<float,2>{0.891370535f, 0.792480946f},
-std::array<float,2>{0.095664911f, 0.576845825f},
-std::array<float,2>{0.650528848f, 0.196420357f},
-std::array<float,2>{0.140842378f, 0.291591853f},
-std::array<float,2>{0.572548389f, 0.93640995f},
-std::array<float,2>{0.346019566f, 0.702058673f},
-std::array<float,2>{0.796175003f, 0.0795261785f},
-std::array<float,2>{0.453955352f, 0.164732143f},
-std::array<float,2>{0.951558411f, 0.535179079f},
-std::array<float,2>{0.0298788436f, 0.834670067f},
-std::array<float,2>{0.701862097f, 0.466789186f},
-std::array<float,2>{0.107826255f, 0.00606157118f},
-std::array<float,2>{0.644122601f, 0.63332957f},
-std::array<float,2>{0.428373843f, 0.973320603f},
-std::array<float,2>{0.900867343f, 0.359489501f},
-std::array<float,2>{0.281466931f, 0.420161068f},
-std::array<float,2>{0.841224849f, 0.76339817f},
-std::array<float,2>{0.21585761f, 0.594121456f},
-std::array<float,2>{0.512903929f, 0.231970415f},
-std::array<float,2>{0.0405799598f, 0.473726004f},
-std::array<float,2>{0.725215971f, 0.872146845f},
-std::array<float,2>{0.498703897f, 0.525741518f},
-std::array<float,2>{0.997752666f, 0.127531022f},
-std::array<float,2>{0.327305615f, 0.122741483f},
-std::array<float,2>{0.772193372f, 0.725979745f},
-std::array<float,2>{0.172278345f, 0.882525802f},
-std::array<float,2>{0.599632323f, 0.278790593f},
-std::array<float,2>{0.245894581f, 0.18769522f},
-std::array<float,2>{0.555254221f, 0.564552307f},
-std::array<float,2>{0.258216411f, 0.784239113f},
-std::array<float,2>{0.863167822f, 0.377429217f},
-std::array<float,2>{0.389342397f, 0.329104662f},
-std::array<float,2>{0.9220981f, 0.943602741f},
-std::array<float,2>{0.0815221742f, 0.660152733f},
-std::array<float,2>{0.671865702f, 0.0323293991f},
-std::array<float,2>{0.190596268f, 0.39843896f},
-std::array<float,2>{0.526964605f, 0.79878062f},
-std::array<float,2>{0.311562866f, 0.585452855f},
-std::array<float,2>{0.824672759f, 0.211550608f},
-std::array<float,2>{0.408766866f, 0.0526196882f},
-std::array<float,2>{0.875191808f, 0.682266533f},
-std::array<float,2>{0.119140141f, 0.957743943f},
-std::array<float,2>{0.632191479f, 0.316006988f},
-std::array<float,2>{0.00632718159f, 0.154630363f},
-std::array<float,2>{0.708556175f, 0.501566589f},
-std::array<float,2>{0.450369954f, 0.847862601f},
-std::array<float,2>{0.959487617f, 0.487730116f},
-std::array<float,2>{0.371914059f, 0.258050948f},
-std::array<float,2>{0.799395621f, 0.896438181f},
-std::array<float,2>{0.132430628f, 0.740752518f},
-std::array<float,2>{0.59196341f, 0.105449714f},
-std::array<float,2>{0.075695999f, 0.353009969f},
-std::array<float,2>{0.675185263f, 0.992699504f},
-std::array<float,2>{0.395222217f, 0.641510963f},
-std::array<float,2>{0.921087265f, 0.0264678951f},
-std::array<float,2>{0.275708944f, 0.244146526f},
-std::array<float,2>{0.854941726f, 0.618355274f},
-std::array<float,2>{0.219914839f, 0.77362293f},
-std::array<float,2>{0.545655489f, 0.424885482f},
-std::array<float,2>{0.156934232f, 0.0712630227f},
-std::array<float,2>{0.613055646f, 0.703817844f},
-std::array<float,2>{0.329934448f, 0.911664248f},
-std::array<float,2>{0.765334189f, 0.301859051f},
-std::array<float,2>{0.469666004f, 0.443978399f},
-std::array<float,2>{0.977448344f, 0.815318882f},
-std::array<float,2>{0.0572163835f, 0.548555017f},
-std::array<float,2>{0.745805502f, 0.172250271f},
-std::array<float,2>{0.167328283f, 0.365299463f},
-std::array<float,2>{0.624235868f, 0.968786299f},
-std::array<float,2>{0.33738187f, 0.638901293f},
-std::array<float,2>{0.751653612f, 0.00149217725f},
-std::array<float,2>{0.480481923f, 0.227440849f},
-std::array<float,2>{0.973814547f, 0.599542618f},
-std::array<float,2>{0.047854837f, 0.75898248f},
-std::array<float,2>{0.740159094f, 0.416505575f},
-std::array<float,2>{0.0656294301f, 0.0831637606f},
-std::array<float,2>{0.682612479f, 0.698487997f},
-std::array<float,2>{0.404924661f, 0.932938755f},
-std::array<float,2>{0.912971556f, 0.296477169f},
-std::array<float,2>{0.267114252f, 0.461776137f},
-std::array<float,2>{0.843914628f, 0.829149723f},
-std::array<float,2>{0.22776787f, 0.533304989f},
-std::array<float,2>{0.533422232f, 0.170930699f},
-std::array<float,2>{0.0146238673f, 0.378991723f},
-std::array<float,2>{0.714193165f, 0.785507441f},
-std::array<float,2>{0.441499203f, 0.567306459f},
-std::array<float,2>{0.967501462f, 0.194083765f},
-std::array<float,2>{0.364157498f, 0.0368036814f},
-std::array<float,2>{0.812440038f, 0.663951337f},
-std::array<float,2>{0.136154696f, 0.937751949f},
-std::array<float,2>{0.578742027f, 0.333342046f},
-std::array<float,2>{0.200557008f, 0.132056549f},
-std::array<float,2>{0.522071123f, 0.529294848f},
-std::array<float,2>{0.299735427f, 0.868508339f},
-std::array<float,2>{0.817364156f, 0.469330668f},
-std::array<float,2>{0.421331733f, 0.27616182f},
-std::array<float,2>{0.886496067f, 0.878223002f},
-std::array<float,2>{0.11463955f, 0.71890521f},
-std::array<float,2>{0.635178566f, 0.118233681f},
-std::array<float,2>{0.234763756f, 0.49081707f},
-std::array<float,2>{0.54824996f, 0.846505523f},
-std::array<float,2>{0.250824302f, 0.505428493f},
-std::array<float,2>{0.871956468f, 0.148715958f},
-std::array<float,2>{0.3771047f, 0.106247544f},
-std::array<float,2>{0.936208844f, 0.736489058f},
-std::array<float,2>{0.0930928886f, 0.893769622f},
-std::array<float,2>{0.662702799f, 0.26368615f},
-std::array<float,2>{0.0375089385f, 0.218031242f},
-std::array<float,2>{0.727314174f, 0.578850269f},
-std::array<float,2>{0.488976032f, 0.803299606f},
-std::array<float,2>{0.985466957f, 0.405641764f},
-std::array<float,2>{0.315476537f, 0.319090992f},
-std::array<float,2>{0.775883913f, 0.953697205f},
-std::array<float,2>{0.185772538f, 0.687406361f},
-std::array<float,2>{0.609141231f, 0.0472592115f},
-std::array<float,2>{0.101411588f, 0.300290644f},
-std::array<float,2>{0.654951632f, 0.906985044f},
-std::array<float,2>{0.436541766f, 0.709876895f},
-std::array<float,2>{0.896802664f, 0.0774821341f},
-std::array<float,2>{0.290589154f, 0.178780109f},
-std::array<float,2>{0.829084575f, 0.551384389f},
-std::array<float,2>{0.210629791f, 0.819032431f},
-std::array<float,2>{0.505606055f, 0.439576358f},
-std::array<float,2>{0.151126161f, 0.031088816f},
-std::array<float,2>{0.565906107f, 0.646179914f},
-std::array<float,2>{0.357884258f, 0.998167276f},
-std::array<float,2>{0.786379933f, 0.356111974f},
-std::array<float,2>{0.467879146f, 0.428899139f},
-std::array<float,2>{0.941546381f, 0.779959619f},
-std::array<float,2>{0.0159042273f, 0.621399999f},
-std::array<float,2>{0.693137825f, 0.247484758f},
-std::array<float,2>{0.211018547f, 0.257750899f},
-std::array<float,2>{0.507830381f, 0.899601877f},
-std::array<float,2>{0.28763929f, 0.746978462f},
-std::array<float,2>{0.838549376f, 0.0975428f},
-std::array<float,2>{0.422856301f, 0.147682562f},
-std::array<float,2>{0.904039145f, 0.515203238f},
-std::array<float,2>{0.102398902f, 0.852450192f},
-std::array<float,2>{0.647400975f, 0.492639601f},
-std::array<float,2>{0.0245948825f, 0.0577330664f},
-std::array<float,2>{0.698853612f, 0.674112856f},
-std::array<float,2>{0.459987044f, 0.966872931f},
-std::array<float,2>{0.948992372f, 0.32156983f},
-std::array<float,2>{0.351444453f, 0.395554304f},
-std::array<float,2>{0.789450645f, 0.812444687f},
-std::array<float,2>{0.145154878f, 0.587017119f},
-std::array<float,2>{0.575561702f, 0.207535982f},
-std::array<float,2>{0.0845092013f, 0.447582573f},
-std::array<float,2>{0.665649414f, 0.827928007f},
-std::array<float,2>{0.385454327f, 0.556198061f},
-std::array<float,2>{0.927924395f, 0.183930978f},
-std::array<float,2>{0.264177889f, 0.0639423802f},
-std::array<float,2>{0.865273356f, 0.716262817f},
-std::array<float,2>{0.24802947f, 0.914200008f},
-std::array<float,2>{0.560097516f, 0.304770827f},
-std::array<float,2>{0.178333372f, 0.242146686f},
-std::array<float,2>{0.596572876f, 0.612794161f},
-std::array<float,2>{0.322753042f, 0.766712666f},
-std::array<float,2>{0.767835319f, 0.432483375f},
-std::array<float,2>{0.495050132f, 0.347956598f},
-std::array<float,2>{0.993041337f, 0.989525616f},
-std::array<float,2>{0.0433171988f, 0.655600011f},
-std::array<float,2>{0.718999207f, 0.0179112516f},
-std::array<float,2>{0.12553063f, 0.406885594f},
-std::array<float,2>{0.58637172f, 0.752839923f},
-std::array<float,2>{0.36855033f, 0.602341831f},
-std::array<float,2>{0.801254272f, 0.220572725f},
-std::array<float,2>{0.445764095f, 0.0128709404f},
-std::array<float,2>{0.955328822f, 0.625459313f},
-std::array<float,2>{0.00305020506f, 0.977788985f},
-std::array<float,2>{0.704044521f, 0.36846599f},
-std::array<float,2>{0.122828729f, 0.157177493f},
-std::array<float,2>{0.628615499f, 0.539170086f},
-std::array<float,2>{0.411722213f, 0.843017101f},
-std::array<float,2>{0.88039428f, 0.454977691f},
-std::array<float,2>{0.30472368f, 0.284035534f},
-std::array<float,2>{0.821903288f, 0.926380098f},
-std::array<float,2>{0.192824602f, 0.695245922f},
-std::array<float,2>{0.528212368f, 0.0921800807f},
-std::array<float,2>{0.0586054437f, 0.33689782f},
-std::array<float,2>{0.747153163f, 0.952011228f},
-std::array<float,2>{0.475742459f, 0.665628135f},
-std::array<float,2>{0.983347058f, 0.0390714072f},
-std::array<float,2>{0.33514142f, 0.201762646f},
-std::array<float,2>{0.761237621f, 0.570562303f},
-std::array<float,2>{0.161787555f, 0.793599427f},
-std::array<float,2>{0.615503788f, 0.387709469f},
-std::array<float,2>{0.225233957f, 0.115072429f},
-std::array<float,2>{0.540305495f, 0.732868373f},
-std::array<float,2>{0.278619587f, 0.888448715f},
-std::array<float,2>{0.859111309f, 0.269081891f},
-std::array<float,2>{0.393283486f, 0.482279599f},
-std::array<float,2>{0.915414035f, 0.860446155f},
-std::array<float,2>{0.072540842f, 0.517564297f},
-std::array<float,2>{0.676823139f, 0.139113471f},
-std::array<float,2>{0.204727292f, 0.342564046f},
-std::array<float,2>{0.502626598f, 0.947829247f},
-std::array<float,2>{0.295329303f, 0.67149061f},
-std::array<float,2>{0.833371818f, 0.0432984792f},
-std::array<float,2>{0.432987571f, 0.195498958f},
-std::array<float,2>{0.892625272f, 0.577374876f},
-std::array<float,2>{0.0971248075f, 0.791901171f},
-std::array<float,2>{0.650389016f, 0.385903776f},
-std::array<float,2>{0.0225400664f, 0.111636072f},
-std::array<float,2>{0.687633514f, 0.727416635f},
-std::array<float,2>{0.462759554f, 0.886051416f},
-std::array<float,2>{0.937925339f, 0.270871103f},
-std::array<float,2>{0.352028817f, 0.477639884f},
-std::array<float,2>{0.781864405f, 0.866905689f},
-std::array<float,2>{0.1557381f, 0.520162463f},
-std::array<float,2>{0.569583356f, 0.133083731f},
-std::array<float,2>{0.0890431851f, 0.410213232f},
-std::array<float,2>{0.658869863f, 0.757782757f},
-std::array<float,2>{0.382381082f, 0.60894841f},
-std::array<float,2>{0.930061936f, 0.223664239f},
-std::array<float,2>{0.256304622f, 0.0113146519f},
-std::array<float,2>{0.870462596f, 0.63222599f},
-std::array<float,2>{0.239567444f, 0.984068036f},
-std::array<float,2>{0.551098704f, 0.372160614f},
-std::array<float,2>{0.181162149f, 0.160818145f},
-std::array<float,2>{0.605005383f, 0.544574976f},
-std::array<float,2>{0.318689466f, 0.839548588f},
-std::array<float,2>{0.77822423f, 0.458918244f},
-std::array<float,2>{0.485955596f, 0.287803888f},
-std::array<float,2>{0.988951087f, 0.925741911f},
-std::array<float,2>{0.0349231251f, 0.690711677f},
-std::array<float,2>{0.732508004f, 0.0883046538f},
-std::array<float,2>{0.136896625f, 0.451228499f},
-std::array<float,2>{0.582095683f, 0.823152304f},
-std::array<float,2>{0.360767245f, 0.560756683f},
-std::array<float,2>{0.807561636f, 0.180117279f},
-std::array<float,2>{0.440583348f, 0.0680577308f},
-std::array<float,2>{0.963142157f, 0.714765131f},
-std::array<float,2>{0.00989714917f, 0.919694424f},
-std::array<float,2>{0.718191624f, 0.310663044f},
-std::array<float,2>{0.113056034f, 0.238176644f},
-std::array<float,2>{0.637222528f, 0.613883138f},
-std::array<float,2>{0.415672749f, 0.769849122f},
-std::array<float,2>{0.886940479f, 0.433913499f},
-std::array<float,2>{0.303860754f, 0.344618261f},
-std::array<float,2>{0.815804005f, 0.98566854f},
-std::array<float,2>{0.195962906f, 0.651864648f},
-std::array<float,2>{0.517912388f, 0.0208400134f},
-std::array<float,2>{0.0515555628f, 0.252614886f},
-std::array<float,2>{0.736772776f, 0.905258656f},
-std::array<float,2>{0.480026633f, 0.745747209f},
-std::array<float,2>{0.97134465f, 0.0996169671f},
-std::array<float,2>{0.340209365f, 0.14122504f},
-std::array<float,2>{0.757524967f, 0.510371387f},
-std::array<float,2>{0.170930654f, 0.857491493f},
-std::array<float,2>{0.618846655f, 0.496523529f},
-std::array<float,2>{0.230486706f, 0.0601685829f},
-std::array<float,2>{0.536339581f, 0.67716372f},
-std::array<float,2>{0.271069497f, 0.962332249f},
-std::array<float,2>{0.84824121f, 0.326321632f},
-std::array<float,2>{0.399637967f, 0.394117951f},
-std::array<float,2>{0.909879506f, 0.807943106f},
-std::array<float,2>{0.0678976923f, 0.591207206f},
-std::array<float,2>{0.683719218f, 0.205035254f},
-std::array<float,2>{0.159459382f, 0.300789356f},
-std::array<float,2>{0.609684289f, 0.91018635f},
-std::array<float,2>{0.330758065f, 0.704553843f},
-std::array<float,2>{0.763284624f, 0.0722324997f},
-std::array<float,2>{0.471101373f, 0.173322365f},
-std::array<float,2>{0.978898406f, 0.547099113f},
-std::array<float,2>{0.0558951423f, 0.815692902f},
-std::array<float,2>{0.742421806f, 0.444409758f},
-std::array<float,2>{0.0778378323f, 0.0261843819f},
-std::array<float,2>{0.672926605f, 0.642353654f},
-std::array<float,2>{0.39681688f, 0.993368089f},
-std::array<float,2>{0.918996334f, 0.352073699f},
-std::array<float,2>{0.274602175f, 0.424335629f},
-std::array<float,2>{0.851723135f, 0.775140941f},
-std::array<float,2>{0.221867427f, 0.617935181f},
-std::array<float,2>{0.543120265f, 0.245809883f},
-std::array<float,2>{0.0053142379f, 0.48682332f},
-std::array<float,2>{0.708988905f, 0.849180579f},
-std::array<float,2>{0.45236814f, 0.500903785f},
-std::array<float,2>{0.957275927f, 0.155307159f},
-std::array<float,2>{0.374435335f, 0.104047835f},
-std::array<float,2>{0.796935022f, 0.741333663f},
-std::array<float,2>{0.130042538f, 0.895088315f},
-std::array<float,2>{0.591056645f, 0.259638816f},
-std::array<float,2>{0.187693536f, 0.212210253f},
-std::array<float,2>{0.525083721f, 0.584529757f},
-std::array<float,2>{0.308750719f, 0.797703564f},
-std::array<float,2>{0.827566862f, 0.3995049f},
-std::array<float,2>{0.407149166f, 0.315190047f},
-std::array<float,2>{0.878645837f, 0.958495677f},
-std::array<float,2>{0.12040174f, 0.682890117f},
-std::array<float,2>{0.629294872f, 0.051518593f},
-std::array<float,2>{0.243080869f, 0.378819942f},
-std::array<float,2>{0.557056487f, 0.78377074f},
-std::array<float,2>{0.261394471f, 0.566293299f},
-std::array<float,2>{0.859726012f, 0.188565731f},
-std::array<float,2>{0.386792988f, 0.0320310667f},
-std::array<float,2>{0.925117612f, 0.658940434f},
-std::array<float,2>{0.0785039216f, 0.944719613f},
-std::array<float,2>{0.669046521f, 0.328498304f},
-std::array<float,2>{0.041658096f, 0.128188729f},
-std::array<float,2>{0.723520994f, 0.52721858f},
-std::array<float,2>{0.497380763f, 0.871124208f},
-std::array<float,2>{0.99974519f, 0.472935706f},
-std::array<float,2>{0.324550152f, 0.277880877f},
-std::array<float,2>{0.770187378f, 0.881483912f},
-std::array<float,2>{0.174989045f, 0.725293815f},
-std::array<float,2>{0.597953737f, 0.121726952f},
-std::array<float,2>{0.107288122f, 0.361150146f},
-std::array<float,2>{0.641425431f, 0.97405684f},
-std::array<float,2>{0.426562965f, 0.634629726f},
-std::array<float,2>{0.900337696f, 0.00708995899f},
-std::array<float,2>{0.283605307f, 0.230692849f},
-std::array<float,2>{0.842418432f, 0.595526338f},
-std::array<float,2>{0.218553156f, 0.762223959f},
-std::array<float,2>{0.514435112f, 0.421239674f},
-std::array<float,2>{0.143668875f, 0.0784053057f},
-std::array<float,2>{0.570486128f, 0.702370107f},
-std::array<float,2>{0.344171554f, 0.937395811f},
-std::array<float,2>{0.794600487f, 0.292384148f},
-std::array<float,2>{0.456555963f, 0.465058714f},
-std::array<float,2>{0.949347973f, 0.835126519f},
-std::array<float,2>{0.0281044822f, 0.536746562f},
-std::array<float,2>{0.699841201f, 0.165920943f},
-std::array<float,2>{0.14945972f, 0.357245296f},
-std::array<float,2>{0.564449072f, 0.999262035f},
-std::array<float,2>{0.357310236f, 0.645278335f},
-std::array<float,2>{0.787288547f, 0.0298039075f},
-std::array<float,2>{0.46607542f, 0.246467501f},
-std::array<float,2>{0.945067227f, 0.622498393f},
-std::array<float,2>{0.0176747702f, 0.780583382f},
-std::array<float,2>{0.695031166f, 0.427914381f},
-std::array<float,2>{0.0977917239f, 0.0770157948f},
-std::array<float,2>{0.652818739f, 0.709999204f},
-std::array<float,2>{0.435418189f, 0.907297075f},
-std::array<float,2>{0.894683361f, 0.298941433f},
-std::array<float,2>{0.291115582f, 0.441319793f},
-std::array<float,2>{0.83157295f, 0.819366515f},
-std::array<float,2>{0.207112223f, 0.552412748f},
-std::array<float,2>{0.507060468f, 0.177987039f},
-std::array<float,2>{0.0354940556f, 0.405250847f},
-std::array<float,2>{0.729115784f, 0.804617524f},
-std::array<float,2>{0.491266429f, 0.579283476f},
-std::array<float,2>{0.986468375f, 0.216807857f},
-std::array<float,2>{0.313665152f, 0.0480079539f},
-std::array<float,2>{0.774434686f, 0.6855793f},
-std::array<float,2>{0.183907509f, 0.954726756f},
-std::array<float,2>{0.606753349f, 0.319802463f},
-std::array<float,2>{0.236457556f, 0.150105938f},
-std::array<float,2>{0.549971879f, 0.504562438f},
-std::array<float,2>{0.252593428f, 0.847246587f},
-std::array<float,2>{0.874085009f, 0.491875142f},
-std::array<float,2>{0.376815259f, 0.265098244f},
-std::array<float,2>{0.934453428f, 0.893322349f},
-std::array<float,2>{0.0904644057f, 0.737391472f},
-std::array<float,2>{0.660553217f, 0.107379287f},
-std::array<float,2>{0.202858344f, 0.470698774f},
-std::array<float,2>{0.520051777f, 0.867749631f},
-std::array<float,2>{0.298702925f, 0.527831614f},
-std::array<float,2>{0.820309579f, 0.131367311f},
-std::array<float,2>{0.41882351f, 0.117781147f},
-std::array<float,2>{0.884038925f, 0.720410705f},
-std::array<float,2>{0.116918728f, 0.877160609f},
-std::array<float,2>{0.63298291f, 0.276488006f},
-std::array<float,2>{0.0121690221f, 0.194751784f},
-std::array<float,2>{0.712624431f, 0.567399561f},
-std::array<float,2>{0.444954693f, 0.786190808f},
-std::array<float,2>{0.96663487f, 0.380621016f},
-std::array<float,2>{0.366295457f, 0.332179517f},
-std::array<float,2>{0.809086502f, 0.939066887f},
-std::array<float,2>{0.13340722f, 0.662685335f},
-std::array<float,2>{0.581160069f, 0.0358775519f},
-std::array<float,2>{0.0639797822f, 0.295310706f},
-std::array<float,2>{0.681096435f, 0.931787074f},
-std::array<float,2>{0.404187858f, 0.697536528f},
-std::array<float,2>{0.911101222f, 0.082627587f},
-std::array<float,2>{0.268327564f, 0.17061615f},
-std::array<float,2>{0.845976353f, 0.534599066f},
-std::array<float,2>{0.228770629f, 0.828559756f},
-std::array<float,2>{0.532244861f, 0.462734371f},
-std::array<float,2>{0.165175691f, 0.000918987324f},
-std::array<float,2>{0.622110069f, 0.640273869f},
-std::array<float,2>{0.339302897f, 0.97029829f},
-std::array<float,2>{0.752496719f, 0.366277277f},
-std::array<float,2>{0.482910037f, 0.417824f},
-std::array<float,2>{0.976444066f, 0.758282125f},
-std::array<float,2>{0.0488560647f, 0.598184705f},
-std::array<float,2>{0.74196732f, 0.228223279f},
-std::array<float,2>{0.223648667f, 0.267811686f},
-std::array<float,2>{0.542382717f, 0.887557566f},
-std::array<float,2>{0.279935211f, 0.733427882f},
-std::array<float,2>{0.85551995f, 0.113904163f},
-std::array<float,2>{0.391241163f, 0.139849216f},
-std::array<float,2>{0.91619432f, 0.515739441f},
-std::array<float,2>{0.0721804202f, 0.860187531f},
-std::array<float,2>{0.678938568f, 0.480510563f},
-std::array<float,2>{0.0614121445f, 0.0401817113f},
-std::array<float,2>{0.749383628f, 0.664991498f},
-std::array<float,2>{0.474556595f, 0.952872515f},
-std::array<float,2>{0.982342243f, 0.337700069f},
-std::array<float,2>{0.332760602f, 0.387417495f},
-std::array<float,2>{0.757969975f, 0.794132531f},
-std::array<float,2>{0.162368312f, 0.572180271f},
-std::array<float,2>{0.613890231f, 0.202702418f},
-std::array<float,2>{0.124288946f, 0.453953475f},
-std::array<float,2>{0.625434995f, 0.842358589f},
-std::array<float,2>{0.41277948f, 0.540262878f},
-std::array<float,2>{0.881011724f, 0.157710791f},
-std::array<float,2>{0.307851821f, 0.0933987275f},
-std::array<float,2>{0.824027777f, 0.693540215f},
-std::array<float,2>{0.194948405f, 0.926964819f},
-std::array<float,2>{0.529940128f, 0.284382671f},
-std::array<float,2>{0.127013221f, 0.219108149f},
-std::array<float,2>{0.588292539f, 0.603240073f},
-std::array<float,2>{0.370794445f, 0.753543437f},
-std::array<float,2>{0.802944243f, 0.407473236f},
-std::array<float,2>{0.448402941f, 0.367382258f},
-std::array<float,2>{0.953304768f, 0.976760685f},
-std::array<float,2>{0.000115960967f, 0.626098812f},
-std::array<float,2>{0.705756247f, 0.012539587f},
-std::array<float,2>{0.177395582f, 0.432670712f},
-std::array<float,2>{0.595346749f, 0.766424716f},
-std::array<float,2>{0.321828842f, 0.611866176f},
-std::array<float,2>{0.767492235f, 0.240877837f},
-std::array<float,2>{0.492927283f, 0.0190002657f},
-std::array<float,2>{0.995515645f, 0.65460968f},
-std::array<float,2>{0.0465563349f, 0.988770008f},
-std::array<float,2>{0.721481323f, 0.349578291f},
-std::array<float,2>{0.0833517686f, 0.18463625f},
-std::array<float,2>{0.667936027f, 0.554773092f},
-std::array<float,2>{0.382953465f, 0.826898158f},
-std::array<float,2>{0.926386058f, 0.449100673f},
-std::array<float,2>{0.263309866f, 0.306140661f},
-std::array<float,2>{0.863484442f, 0.915616989f},
-std::array<float,2>{0.249273583f, 0.715454578f},
-std::array<float,2>{0.561765611f, 0.0630641356f},
-std::array<float,2>{0.0267822146f, 0.320842624f},
-std::array<float,2>{0.696137786f, 0.968470037f},
-std::array<float,2>{0.457487643f, 0.67570895f},
-std::array<float,2>{0.945766568f, 0.0571302734f},
-std::array<float,2>{0.347949684f, 0.20819582f},
-std::array<float,2>{0.791809022f, 0.586660802f},
-std::array<float,2>{0.146827966f, 0.810594797f},
-std::array<float,2>{0.577299595f, 0.394805461f},
-std::array<float,2>{0.212967589f, 0.0964603275f},
-std::array<float,2>{0.510175288f, 0.747514606f},
-std::array<float,2>{0.286519378f, 0.899000347f},
-std::array<float,2>{0.836329162f, 0.256349415f},
-std::array<float,2>{0.425132006f, 0.493599743f},
-std::array<float,2>{0.905207276f, 0.853076398f},
-std::array<float,2>{0.105283715f, 0.513690591f},
-std::array<float,2>{0.645681083f, 0.146667182f},
-std::array<float,2>{0.240530089f, 0.374280602f},
-std::array<float,2>{0.553641558f, 0.980653405f},
-std::array<float,2>{0.255545914f, 0.629280388f},
-std::array<float,2>{0.869110167f, 0.00822699815f},
-std::array<float,2>{0.380676925f, 0.226405635f},
-std::array<float,2>{0.932126939f, 0.607153773f},
-std::array<float,2>{0.0867747515f, 0.7557652f},
-std::array<float,2>{0.658089638f, 0.412604183f},
-std::array<float,2>{0.0324653611f, 0.0863060728f},
-std::array<float,2>{0.732301652f, 0.687527418f},
-std::array<float,2>{0.486400336f, 0.923045635f},
-std::array<float,2>{0.991320372f, 0.286559194f},
-std::array<float,2>{0.317700714f, 0.459392846f},
-std::array<float,2>{0.779893935f, 0.837367356f},
-std::array<float,2>{0.183234796f, 0.546203554f},
-std::array<float,2>{0.602480829f, 0.163265079f},
-std::array<float,2>{0.0941710919f, 0.384126633f},
-std::array<float,2>{0.651989579f, 0.790922046f},
-std::array<float,2>{0.430787802f, 0.575119495f},
-std::array<float,2>{0.892083347f, 0.197860762f},
-std::array<float,2>{0.293220222f, 0.0463713966f},
-std::array<float,2>{0.835207164f, 0.669636786f},
-std::array<float,2>{0.206894621f, 0.946032763f},
-std::array<float,2>{0.500196755f, 0.341550469f},
-std::array<float,2>{0.153256908f, 0.136646166f},
-std::array<float,2>{0.568120539f, 0.522193372f},
-std::array<float,2>{0.353629589f, 0.865195274f},
-std::array<float,2>{0.783561289f, 0.479076028f},
-std::array<float,2>{0.464027822f, 0.271607429f},
-std::array<float,2>{0.940316141f, 0.884465098f},
-std::array<float,2>{0.0211642608f, 0.729150236f},
-std::array<float,2>{0.690682352f, 0.109518401f},
-std::array<float,2>{0.169185027f, 0.499765515f},
-std::array<float,2>{0.620679379f, 0.856179178f},
-std::array<float,2>{0.342672855f, 0.508569777f},
-std::array<float,2>{0.755556166f, 0.144416928f},
-std::array<float,2>{0.47673285f, 0.0979005247f},
-std::array<float,2>{0.969623268f, 0.742326379f},
-std::array<float,2>{0.0534766503f, 0.903141379f},
-std::array<float,2>{0.734602988f, 0.250325948f},
-std::array<float,2>{0.0702602193f, 0.206676453f},
-std::array<float,2>{0.686187804f, 0.592523932f},
-std::array<float,2>{0.402002662f, 0.805945814f},
-std::array<float,2>{0.907527506f, 0.391684681f},
-std::array<float,2>{0.272522837f, 0.325266123f},
-std::array<float,2>{0.850008965f, 0.96410656f},
-std::array<float,2>{0.233429134f, 0.678963304f},
-std::array<float,2>{0.538050294f, 0.0605607815f},
-std::array<float,2>{0.00960220955f, 0.310005844f},
-std::array<float,2>{0.716733277f, 0.920879245f},
-std::array<float,2>{0.437959909f, 0.712053418f},
-std::array<float,2>{0.962257206f, 0.0690636262f},
-std::array<float,2>{0.362865239f, 0.181945905f},
-std::array<float,2>{0.805626452f, 0.559782922f},
-std::array<float,2>{0.139816239f, 0.821195841f},
-std::array<float,2>{0.585189164f, 0.449912727f},
-std::array<float,2>{0.197924495f, 0.0220966917f},
-std::array<float,2>{0.51679647f, 0.648645878f},
-std::array<float,2>{0.301528066f, 0.986840248f},
-std::array<float,2>{0.812636733f, 0.346391857f},
-std::array<float,2>{0.41778335f, 0.437149286f},
-std::array<float,2>{0.889855623f, 0.771787167f},
-std::array<float,2>{0.111286573f, 0.616349101f},
-std::array<float,2>{0.639965713f, 0.236020193f},
-std::array<float,2>{0.131106198f, 0.260151505f},
-std::array<float,2>{0.593224883f, 0.896823764f},
-std::array<float,2>{0.372687012f, 0.738461196f},
-std::array<float,2>{0.800522327f, 0.102966033f},
-std::array<float,2>{0.449935824f, 0.152401015f},
-std::array<float,2>{0.960397124f, 0.503513813f},
-std::array<float,2>{0.00726067042f, 0.850824952f},
-std::array<float,2>{0.707283139f, 0.486011267f},
-std::array<float,2>{0.117493019f, 0.0544881783f},
-std::array<float,2>{0.630974233f, 0.680557311f},
-std::array<float,2>{0.409206927f, 0.959708214f},
-std::array<float,2>{0.876853943f, 0.313292742f},
-std::array<float,2>{0.311350524f, 0.400891274f},
-std::array<float,2>{0.82540369f, 0.800651491f},
-std::array<float,2>{0.189629242f, 0.583212674f},
-std::array<float,2>{0.525532722f, 0.214695588f},
-std::array<float,2>{0.0577419102f, 0.442681462f},
-std::array<float,2>{0.744647443f, 0.813386381f},
-std::array<float,2>{0.470260322f, 0.548843682f},
-std::array<float,2>{0.977975368f, 0.174138054f},
-std::array<float,2>{0.328380793f, 0.0735457763f},
-std::array<float,2>{0.763867736f, 0.705304444f},
-std::array<float,2>{0.157573506f, 0.913537264f},
-std::array<float,2>{0.612266719f, 0.302953154f},
-std::array<float,2>{0.218807444f, 0.243990526f},
-std::array<float,2>{0.546554863f, 0.620059729f},
-std::array<float,2>{0.276921213f, 0.776504755f},
-std::array<float,2>{0.854224563f, 0.423332393f},
-std::array<float,2>{0.395774305f, 0.354385644f},
-std::array<float,2>{0.920471132f, 0.995308518f},
-std::array<float,2>{0.0751274824f, 0.64335382f},
-std::array<float,2>{0.674674988f, 0.0234917197f},
-std::array<float,2>{0.215149343f, 0.41967389f},
-std::array<float,2>{0.512641609f, 0.764396071f},
-std::array<float,2>{0.282370716f, 0.596851349f},
-std::array<float,2>{0.840642452f, 0.232502386f},
-std::array<float,2>{0.429283947f, 0.00443109544f},
-std::array<float,2>{0.901432931f, 0.636360288f},
-std::array<float,2>{0.108714595f, 0.975952804f},
-std::array<float,2>{0.643112779f, 0.362588704f},
-std::array<float,2>{0.0311414823f, 0.166936308f},
-std::array<float,2>{0.70233655f, 0.538621902f},
-std::array<float,2>{0.454762518f, 0.832418799f},
-std::array<float,2>{0.95275712f, 0.467387319f},
-std::array<float,2>{0.347388297f, 0.289953023f},
-std::array<float,2>{0.795844555f, 0.934139013f},
-std::array<float,2>{0.142041057f, 0.699549854f},
-std::array<float,2>{0.573299468f, 0.0803500563f},
-std::array<float,2>{0.0802579075f, 0.33020246f},
-std::array<float,2>{0.670539081f, 0.94198066f},
-std::array<float,2>{0.390247464f, 0.656740189f},
-std::array<float,2>{0.923795462f, 0.0333561525f},
-std::array<float,2>{0.25959006f, 0.190644115f},
-std::array<float,2>{0.862031996f, 0.563775063f},
-std::array<float,2>{0.245036766f, 0.782449782f},
-std::array<float,2>{0.556167424f, 0.375988305f},
-std::array<float,2>{0.172909051f, 0.123795629f},
-std::array<float,2>{0.601534426f, 0.722809911f},
-std::array<float,2>{0.326637954f, 0.879347265f},
-std::array<float,2>{0.7727198f, 0.280026048f},
-std::array<float,2>{0.499413341f, 0.475628138f},
-std::array<float,2>{0.996598899f, 0.874221742f},
-std::array<float,2>{0.0396385267f, 0.524146676f},
-std::array<float,2>{0.72595638f, 0.126271054f},
-std::array<float,2>{0.187143967f, 0.317479283f},
-std::array<float,2>{0.608292341f, 0.956318259f},
-std::array<float,2>{0.315302879f, 0.683880806f},
-std::array<float,2>{0.777234018f, 0.0504368991f},
-std::array<float,2>{0.489515096f, 0.216461927f},
-std::array<float,2>{0.984473825f, 0.580651164f},
-std::array<float,2>{0.0389022492f, 0.800820053f},
-std::array<float,2>{0.728220701f, 0.403886408f},
-std::array<float,2>{0.0927591324f, 0.108995363f},
-std::array<float,2>{0.663973868f, 0.735322654f},
-std::array<float,2>{0.378406525f, 0.890670598f},
-std::array<float,2>{0.937101364f, 0.263462454f},
-std::array<float,2>{0.251602411f, 0.489027441f},
-std::array<float,2>{0.872117937f, 0.843881369f},
-std::array<float,2>{0.236219183f, 0.507133067f},
-std::array<float,2>{0.547064841f, 0.150398999f},
-std::array<float,2>{0.017345624f, 0.426943719f},
-std::array<float,2>{0.691568136f, 0.777827144f},
-std::array<float,2>{0.467406482f, 0.624669373f},
-std::array<float,2>{0.943114638f, 0.249213606f},
-std::array<float,2>{0.359005213f, 0.0274748486f},
-std::array<float,2>{0.78521663f, 0.647376299f},
-std::array<float,2>{0.151835099f, 0.99780333f},
-std::array<float,2>{0.56464684f, 0.358493298f},
-std::array<float,2>{0.209497318f, 0.176516116f},
-std::array<float,2>{0.504032612f, 0.553676784f},
-std::array<float,2>{0.289279759f, 0.817037523f},
-std::array<float,2>{0.829202473f, 0.439153641f},
-std::array<float,2>{0.435944885f, 0.297629863f},
-std::array<float,2>{0.897628069f, 0.90903604f},
-std::array<float,2>{0.100175843f, 0.707778752f},
-std::array<float,2>{0.655397177f, 0.0744245425f},
-std::array<float,2>{0.227233976f, 0.463197201f},
-std::array<float,2>{0.534399748f, 0.830833614f},
-std::array<float,2>{0.265674531f, 0.532454371f},
-std::array<float,2>{0.845649481f, 0.169786155f},
-std::array<float,2>{0.40569821f, 0.0851582736f},
-std::array<float,2>{0.913688362f, 0.695430279f},
-std::array<float,2>{0.0649150163f, 0.930845261f},
-std::array<float,2>{0.682825625f, 0.293423355f},
-std::array<float,2>{0.0472823903f, 0.23020938f},
-std::array<float,2>{0.739037097f, 0.599900007f},
-std::array<float,2>{0.481840611f, 0.760543168f},
-std::array<float,2>{0.97339052f, 0.415560603f},
-std::array<float,2>{0.336892068f, 0.363726854f},
-std::array<float,2>{0.750075579f, 0.970745325f},
-std::array<float,2>{0.166754052f, 0.637353361f},
-std::array<float,2>{0.62382257f, 0.00205141958f},
-std::array<float,2>{0.113883175f, 0.274797857f},
-std::array<float,2>{0.636181176f, 0.87667805f},
-std::array<float,2>{0.420460045f, 0.722235501f},
-std::array<float,2>{0.88499856f, 0.120303772f},
-std::array<float,2>{0.299807101f, 0.129106358f},
-std::array<float,2>{0.81781584f, 0.529751241f},
-std::array<float,2>{0.200146005f, 0.870077848f},
-std::array<float,2>{0.523026347f, 0.472082347f},
-std::array<float,2>{0.135569841f, 0.0379077718f},
-std::array<float,2>{0.579280376f, 0.66141057f},
-std::array<float,2>{0.36479494f, 0.940661848f},
-std::array<float,2>{0.810785174f, 0.335175097f},
-std::array<float,2>{0.443284929f, 0.382031202f},
-std::array<float,2>{0.968556821f, 0.787820756f},
-std::array<float,2>{0.0154541116f, 0.569720984f},
-std::array<float,2>{0.713546813f, 0.192592174f},
-std::array<float,2>{0.191887006f, 0.281841308f},
-std::array<float,2>{0.528564334f, 0.928784192f},
-std::array<float,2>{0.30642581f, 0.692288339f},
-std::array<float,2>{0.820904434f, 0.0915930122f},
-std::array<float,2>{0.410608828f, 0.158419862f},
-std::array<float,2>{0.879503191f, 0.541991234f},
-std::array<float,2>{0.1218886f, 0.840829909f},
-std::array<float,2>{0.627306223f, 0.456795692f},
-std::array<float,2>{0.00196406827f, 0.0151688671f},
-std::array<float,2>{0.704540431f, 0.628369093f},
-std::array<float,2>{0.446772069f, 0.980384111f},
-std::array<float,2>{0.9568367f, 0.36987561f},
-std::array<float,2>{0.367579013f, 0.40929392f},
-std::array<float,2>{0.801852405f, 0.750761986f},
-std::array<float,2>{0.126948193f, 0.603977025f},
-std::array<float,2>{0.587616205f, 0.221190751f},
-std::array<float,2>{0.0734134093f, 0.483226925f},
-std::array<float,2>{0.676175833f, 0.861549139f},
-std::array<float,2>{0.393921435f, 0.518262684f},
-std::array<float,2>{0.914811432f, 0.138375849f},
-std::array<float,2>{0.277661771f, 0.116092697f},
-std::array<float,2>{0.857868671f, 0.730566561f},
-std::array<float,2>{0.226510659f, 0.889112055f},
-std::array<float,2>{0.539219737f, 0.267096996f},
-std::array<float,2>{0.160929054f, 0.199520752f},
-std::array<float,2>{0.616801262f, 0.572871923f},
-std::array<float,2>{0.334733754f, 0.796543539f},
-std::array<float,2>{0.760514975f, 0.38932088f},
-std::array<float,2>{0.475116193f, 0.339646548f},
-std::array<float,2>{0.984103918f, 0.949259102f},
-std::array<float,2>{0.0597104505f, 0.666878462f},
-std::array<float,2>{0.746438801f, 0.0415868647f},
-std::array<float,2>{0.146021411f, 0.398204416f},
-std::array<float,2>{0.575107932f, 0.809680521f},
-std::array<float,2>{0.350143045f, 0.589586079f},
-std::array<float,2>{0.790853024f, 0.210215718f},
-std::array<float,2>{0.459219456f, 0.0555321015f},
-std::array<float,2>{0.947957873f, 0.673651457f},
-std::array<float,2>{0.023941122f, 0.965785742f},
-std::array<float,2>{0.697432041f, 0.323082179f},
-std::array<float,2>{0.103360772f, 0.145141378f},
-std::array<float,2>{0.647568405f, 0.513191342f},
-std::array<float,2>{0.421875298f, 0.854815364f},
-std::array<float,2>{0.902766526f, 0.495139688f},
-std::array<float,2>{0.288386613f, 0.254664063f},
-std::array<float,2>{0.839253187f, 0.901413321f},
-std::array<float,2>{0.212214932f, 0.749319911f},
-std::array<float,2>{0.509072542f, 0.09396898f},
-std::array<float,2>{0.0442168079f, 0.349729985f},
-std::array<float,2>{0.720414221f, 0.99175024f},
-std::array<float,2>{0.49560532f, 0.653444111f},
-std::array<float,2>{0.994096875f, 0.0164548997f},
-std::array<float,2>{0.323381484f, 0.240057155f},
-std::array<float,2>{0.769412994f, 0.610578239f},
-std::array<float,2>{0.179565102f, 0.769466162f},
-std::array<float,2>{0.597010672f, 0.43023628f},
-std::array<float,2>{0.246929526f, 0.0654678941f},
-std::array<float,2>{0.559360266f, 0.717987299f},
-std::array<float,2>{0.264662772f, 0.916667879f},
-std::array<float,2>{0.866738677f, 0.307959884f},
-std::array<float,2>{0.386541694f, 0.446054041f},
-std::array<float,2>{0.92933619f, 0.824845254f},
-std::array<float,2>{0.0856945217f, 0.558578193f},
-std::array<float,2>{0.66452831f, 0.186908513f},
-std::array<float,2>{0.193447322f, 0.369689882f},
-std::array<float,2>{0.530734658f, 0.979990423f},
-std::array<float,2>{0.30683583f, 0.62802273f},
-std::array<float,2>{0.822760403f, 0.0154586071f},
-std::array<float,2>{0.413651705f, 0.220851198f},
-std::array<float,2>{0.882510722f, 0.603634894f},
-std::array<float,2>{0.12393675f, 0.750663877f},
-std::array<float,2>{0.626662612f, 0.409528345f},
-std::array<float,2>{0.00175793318f, 0.0914111808f},
-std::array<float,2>{0.706699133f, 0.691993296f},
-std::array<float,2>{0.447431356f, 0.92919153f},
-std::array<float,2>{0.954437554f, 0.282152534f},
-std::array<float,2>{0.369321555f, 0.456695765f},
-std::array<float,2>{0.803828895f, 0.841217458f},
-std::array<float,2>{0.128125191f, 0.541509569f},
-std::array<float,2>{0.589836895f, 0.158577546f},
-std::array<float,2>{0.0710856393f, 0.38941592f},
-std::array<float,2>{0.677829444f, 0.796868563f},
-std::array<float,2>{0.39187485f, 0.573147416f},
-std::array<float,2>{0.917213559f, 0.199409783f},
-std::array<float,2>{0.280412614f, 0.0419342034f},
-std::array<float,2>{0.85657692f, 0.666534126f},
-std::array<float,2>{0.223534003f, 0.949499428f},
-std::array<float,2>{0.541707098f, 0.339376241f},
-std::array<float,2>{0.163620457f, 0.138660759f},
-std::array<float,2>{0.61511749f, 0.518432379f},
-std::array<float,2>{0.33350727f, 0.861586571f},
-std::array<float,2>{0.759260654f, 0.483087093f},
-std::array<float,2>{0.472670734f, 0.267494619f},
-std::array<float,2>{0.980671763f, 0.888909221f},
-std::array<float,2>{0.0617406256f, 0.730864346f},
-std::array<float,2>{0.748271048f, 0.115789957f},
-std::array<float,2>{0.147606149f, 0.495451391f},
-std::array<float,2>{0.577093363f, 0.854707837f},
-std::array<float,2>{0.349264473f, 0.513511121f},
-std::array<float,2>{0.792345226f, 0.145349607f},
-std::array<float,2>{0.458906114f, 0.094189927f},
-std::array<float,2>{0.946877599f, 0.749154031f},
-std::array<float,2>{0.0259663258f, 0.901839316f},
-std::array<float,2>{0.696475685f, 0.254620105f},
-std::array<float,2>{0.104320712f, 0.210098803f},
-std::array<float,2>{0.644662261f, 0.589748204f},
-std::array<float,2>{0.424215049f, 0.810036421f},
-std::array<float,2>{0.90620333f, 0.398011267f},
-std::array<float,2>{0.285398364f, 0.32278654f},
-std::array<float,2>{0.837797701f, 0.965467274f},
-std::array<float,2>{0.21475631f, 0.673431635f},
-std::array<float,2>{0.511351526f, 0.0552682132f},
-std::array<float,2>{0.0450259186f, 0.307625711f},
-std::array<float,2>{0.722147703f, 0.916928828f},
-std::array<float,2>{0.493839622f, 0.718112946f},
-std::array<float,2>{0.994595528f, 0.0658896342f},
-std::array<float,2>{0.32094124f, 0.186747864f},
-std::array<float,2>{0.766583383f, 0.558154225f},
-std::array<float,2>{0.175951764f, 0.825097263f},
-std::array<float,2>{0.594475925f, 0.445978343f},
-std::array<float,2>{0.248959541f, 0.0161556788f},
-std::array<float,2>{0.561258376f, 0.65357399f},
-std::array<float,2>{0.262595147f, 0.991970658f},
-std::array<float,2>{0.864916801f, 0.34988302f},
-std::array<float,2>{0.383907974f, 0.430446029f},
-std::array<float,2>{0.927169859f, 0.769213796f},
-std::array<float,2>{0.0820429549f, 0.610770226f},
-std::array<float,2>{0.666939497f, 0.2398808f},
-std::array<float,2>{0.184759423f, 0.263200432f},
-std::array<float,2>{0.605731189f, 0.890877426f},
-std::array<float,2>{0.31287992f, 0.734908283f},
-std::array<float,2>{0.773535788f, 0.10920465f},
-std::array<float,2>{0.490236044f, 0.150702313f},
-std::array<float,2>{0.987353444f, 0.507008612f},
-std::array<float,2>{0.0366825648f, 0.844135106f},
-std::array<float,2>{0.729658842f, 0.48890993f},
-std::array<float,2>{0.0909381732f, 0.0506019294f},
-std::array<float,2>{0.662073791f, 0.683790088f},
-std::array<float,2>{0.37566641f, 0.956091464f},
-std::array<float,2>{0.934869349f, 0.317844003f},
-std::array<float,2>{0.252954185f, 0.404117435f},
-std::array<float,2>{0.873649359f, 0.801042199f},
-std::array<float,2>{0.237910569f, 0.581039906f},
-std::array<float,2>{0.549138486f, 0.216755137f},
-std::array<float,2>{0.0188838802f, 0.439275235f},
-std::array<float,2>{0.693376541f, 0.81733489f},
-std::array<float,2>{0.465053201f, 0.553273678f},
-std::array<float,2>{0.944176078f, 0.176379636f},
-std::array<float,2>{0.355585814f, 0.0747019351f},
-std::array<float,2>{0.788609624f, 0.707585335f},
-std::array<float,2>{0.149310037f, 0.908762097f},
-std::array<float,2>{0.562945724f, 0.297564924f},
-std::array<float,2>{0.208939821f, 0.249292031f},
-std::array<float,2>{0.506757915f, 0.624985456f},
-std::array<float,2>{0.292870462f, 0.777509689f},
-std::array<float,2>{0.830335796f, 0.427009821f},
-std::array<float,2>{0.434475034f, 0.358835101f},
-std::array<float,2>{0.89622426f, 0.997614264f},
-std::array<float,2>{0.099347122f, 0.647110522f},
-std::array<float,2>{0.653927863f, 0.0278213229f},
-std::array<float,2>{0.230206326f, 0.415861964f},
-std::array<float,2>{0.53194958f, 0.760467708f},
-std::array<float,2>{0.268960685f, 0.599781871f},
-std::array<float,2>{0.847631037f, 0.230338186f},
-std::array<float,2>{0.402966201f, 0.00238189497f},
-std::array<float,2>{0.911521256f, 0.637569368f},
-std::array<float,2>{0.0629192442f, 0.971006632f},
-std::array<float,2>{0.680256009f, 0.363381356f},
-std::array<float,2>{0.0502457283f, 0.16955635f},
-std::array<float,2>{0.740612864f, 0.532509148f},
-std::array<float,2>{0.483800381f, 0.830683291f},
-std::array<float,2>{0.975391269f, 0.463084996f},
-std::array<float,2>{0.338769764f, 0.293192238f},
-std::array<float,2>{0.753259182f, 0.931077659f},
-std::array<float,2>{0.164687723f, 0.695569813f},
-std::array<float,2>{0.621906221f, 0.0852737576f},
-std::array<float,2>{0.11584045f, 0.335226566f},
-std::array<float,2>{0.634694099f, 0.940886855f},
-std::array<float,2>{0.419313043f, 0.661273479f},
-std::array<float,2>{0.883307159f, 0.0378087386f},
-std::array<float,2>{0.297783703f, 0.192772806f},
-std::array<float,2>{0.818474054f, 0.569411635f},
-std::array<float,2>{0.202126145f, 0.788030922f},
-std::array<float,2>{0.520724237f, 0.382226318f},
-std::array<float,2>{0.134552851f, 0.120504938f},
-std::array<float,2>{0.580825388f, 0.722636878f},
-std::array<float,2>{0.365731239f, 0.876749218f},
-std::array<float,2>{0.81030947f, 0.274575412f},
-std::array<float,2>{0.443642288f, 0.471696675f},
-std::array<float,2>{0.964861691f, 0.869674265f},
-std::array<float,2>{0.0136488229f, 0.529428542f},
-std::array<float,2>{0.711621225f, 0.129240125f},
-std::array<float,2>{0.129882097f, 0.313178688f},
-std::array<float,2>{0.590413868f, 0.959944785f},
-std::array<float,2>{0.37318036f, 0.680207253f},
-std::array<float,2>{0.798310995f, 0.0543619394f},
-std::array<float,2>{0.451766372f, 0.214404464f},
-std::array<float,2>{0.958449125f, 0.583272099f},
-std::array<float,2>{0.00467870897f, 0.800429165f},
-std::array<float,2>{0.710074008f, 0.40124163f},
-std::array<float,2>{0.119990893f, 0.102751799f},
-std::array<float,2>{0.6305269f, 0.738547564f},
-std::array<float,2>{0.407560557f, 0.896602392f},
-std::array<float,2>{0.877918482f, 0.259854883f},
-std::array<float,2>{0.31026873f, 0.486266613f},
-std::array<float,2>{0.827080429f, 0.850876451f},
-std::array<float,2>{0.189382255f, 0.503740251f},
-std::array<float,2>{0.524010956f, 0.152764052f},
-std::array<float,2>{0.0554333106f, 0.42296201f},
-std::array<float,2>{0.744021714f, 0.776652873f},
-std::array<float,2>{0.471983612f, 0.619655788f},
-std::array<float,2>{0.979542851f, 0.243841991f},
-std::array<float,2>{0.33142671f, 0.0239238907f},
-std::array<float,2>{0.762437403f, 0.643090367f},
-std::array<float,2>{0.158922136f, 0.99555099f},
-std::array<float,2>{0.610551953f, 0.354105055f},
-std::array<float,2>{0.221517369f, 0.174064964f},
-std::array<float,2>{0.544482052f, 0.549300432f},
-std::array<float,2>{0.273442835f, 0.813224971f},
-std::array<float,2>{0.853023887f, 0.442440987f},
-std::array<float,2>{0.398039192f, 0.303124845f},
-std::array<float,2>{0.918479621f, 0.913175344f},
-std::array<float,2>{0.0766103566f, 0.70550245f},
-std::array<float,2>{0.672807455f, 0.0732817575f},
-std::array<float,2>{0.217764512f, 0.467529595f},
-std::array<float,2>{0.515562952f, 0.832265615f},
-std::array<float,2>{0.284607142f, 0.538833857f},
-std::array<float,2>{0.84306401f, 0.166589916f},
-std::array<float,2>{0.426847517f, 0.0802398324f},
-std::array<float,2>{0.898741663f, 0.699288607f},
-std::array<float,2>{0.105737276f, 0.934562385f},
-std::array<float,2>{0.642040253f, 0.289769471f},
-std::array<float,2>{0.028490765f, 0.232694566f},
-std::array<float,2>{0.700749636f, 0.597043097f},
-std::array<float,2>{0.455533594f, 0.764526308f},
-std::array<float,2>{0.950395823f, 0.419752538f},
-std::array<float,2>{0.345198244f, 0.362395406f},
-std::array<float,2>{0.793172479f, 0.975619674f},
-std::array<float,2>{0.142942593f, 0.636590421f},
-std::array<float,2>{0.572261214f, 0.00466130022f},
-std::array<float,2>{0.0797355771f, 0.280046791f},
-std::array<float,2>{0.668280602f, 0.878928065f},
-std::array<float,2>{0.387794614f, 0.722932279f},
-std::array<float,2>{0.924804032f, 0.123668373f},
-std::array<float,2>{0.26066649f, 0.126073152f},
-std::array<float,2>{0.861298978f, 0.524237275f},
-std::array<float,2>{0.244007975f, 0.874357462f},
-std::array<float,2>{0.558587015f, 0.475999266f},
-std::array<float,2>{0.174484506f, 0.0335583761f},
-std::array<float,2>{0.59888339f, 0.65717262f},
-std::array<float,2>{0.325718939f, 0.942378283f},
-std::array<float,2>{0.770976305f, 0.330414891f},
-std::array<float,2>{0.496386886f, 0.376362473f},
-std::array<float,2>{0.998300493f, 0.782648683f},
-std::array<float,2>{0.0420549437f, 0.563672602f},
-std::array<float,2>{0.723674834f, 0.190863177f},
-std::array<float,2>{0.238812968f, 0.286314905f},
-std::array<float,2>{0.552179039f, 0.923143685f},
-std::array<float,2>{0.257503122f, 0.687746763f},
-std::array<float,2>{0.869437099f, 0.0860930905f},
-std::array<float,2>{0.381068617f, 0.163458779f},
-std::array<float,2>{0.931315124f, 0.545901299f},
-std::array<float,2>{0.0883476809f, 0.837148726f},
-std::array<float,2>{0.659221768f, 0.458985686f},
-std::array<float,2>{0.0333435126f, 0.00798012502f},
-std::array<float,2>{0.733819544f, 0.629066765f},
-std::array<float,2>{0.485048294f, 0.980730236f},
-std::array<float,2>{0.989645243f, 0.37411952f},
-std::array<float,2>{0.320007771f, 0.413075894f},
-std::array<float,2>{0.779003799f, 0.755535007f},
-std::array<float,2>{0.180043384f, 0.607288241f},
-std::array<float,2>{0.60376215f, 0.226264253f},
-std::array<float,2>{0.0965719223f, 0.479277164f},
-std::array<float,2>{0.648680568f, 0.864853799f},
-std::array<float,2>{0.432275534f, 0.522456169f},
-std::array<float,2>{0.893562138f, 0.136460334f},
-std::array<float,2>{0.296851188f, 0.109715827f},
-std::array<float,2>{0.832101583f, 0.729348123f},
-std::array<float,2>{0.203516498f, 0.884602547f},
-std::array<float,2>{0.503248572f, 0.271759719f},
-std::array<float,2>{0.155201793f, 0.198191613f},
-std::array<float,2>{0.568752468f, 0.574775219f},
-std::array<float,2>{0.352945954f, 0.790688753f},
-std::array<float,2>{0.783017099f, 0.384032547f},
-std::array<float,2>{0.461379379f, 0.341603905f},
-std::array<float,2>{0.939053416f, 0.946062863f},
-std::array<float,2>{0.0218480621f, 0.669792116f},
-std::array<float,2>{0.688917696f, 0.0460269563f},
-std::array<float,2>{0.170778036f, 0.39198786f},
-std::array<float,2>{0.617370665f, 0.805895865f},
-std::array<float,2>{0.341551721f, 0.592636824f},
-std::array<float,2>{0.75612551f, 0.206881091f},
-std::array<float,2>{0.479073137f, 0.0609597117f},
-std::array<float,2>{0.971708715f, 0.678874433f},
-std::array<float,2>{0.0521665551f, 0.964293718f},
-std::array<float,2>{0.738228917f, 0.325576454f},
-std::array<float,2>{0.0665849894f, 0.144183561f},
-std::array<float,2>{0.685222685f, 0.508426726f},
-std::array<float,2>{0.399317294f, 0.856419742f},
-std::array<float,2>{0.908233762f, 0.499552906f},
-std::array<float,2>{0.269596815f, 0.250183135f},
-std::array<float,2>{0.849160433f, 0.903051496f},
-std::array<float,2>{0.231587097f, 0.742444336f},
-std::array<float,2>{0.53591764f, 0.0977468714f},
-std::array<float,2>{0.0116301635f, 0.346476227f},
-std::array<float,2>{0.717275977f, 0.987182856f},
-std::array<float,2>{0.43987608f, 0.648822963f},
-std::array<float,2>{0.96412015f, 0.0223200563f},
-std::array<float,2>{0.360343367f, 0.236142278f},
-std::array<float,2>{0.808301449f, 0.616462052f},
-std::array<float,2>{0.138377771f, 0.771486998f},
-std::array<float,2>{0.583332241f, 0.437369704f},
-std::array<float,2>{0.19637455f, 0.0691137686f},
-std::array<float,2>{0.519095659f, 0.712309241f},
-std::array<float,2>{0.30338648f, 0.920646489f},
-std::array<float,2>{0.814918876f, 0.309612006f},
-std::array<float,2>{0.414489537f, 0.450092882f},
-std::array<float,2>{0.887968004f, 0.821014941f},
-std::array<float,2>{0.112056546f, 0.559959233f},
-std::array<float,2>{0.637997448f, 0.181665346f},
-std::array<float,2>{0.224697277f, 0.337544322f},
-std::array<float,2>{0.540648282f, 0.952931762f},
-std::array<float,2>{0.278881073f, 0.664762199f},
-std::array<float,2>{0.858527601f, 0.0404389054f},
-std::array<float,2>{0.392849684f, 0.202913091f},
-std::array<float,2>{0.915569067f, 0.571999788f},
-std::array<float,2>{0.073149763f, 0.794273853f},
-std::array<float,2>{0.677253067f, 0.387658775f},
-std::array<float,2>{0.0595227666f, 0.114079118f},
-std::array<float,2>{0.747888207f, 0.733754396f},
-std::array<float,2>{0.476148129f, 0.88736701f},
-std::array<float,2>{0.982506335f, 0.267899543f},
-std::array<float,2>{0.335912853f, 0.480885625f},
-std::array<float,2>{0.761089504f, 0.85992986f},
-std::array<float,2>{0.161248341f, 0.51592958f},
-std::array<float,2>{0.615735352f, 0.139928192f},
-std::array<float,2>{0.122073852f, 0.407241553f},
-std::array<float,2>{0.628356636f, 0.753898859f},
-std::array<float,2>{0.411479831f, 0.603423476f},
-std::array<float,2>{0.880331933f, 0.218780696f},
-std::array<float,2>{0.305460393f, 0.0123219704f},
-std::array<float,2>{0.821521044f, 0.626275718f},
-std::array<float,2>{0.193088502f, 0.976878285f},
-std::array<float,2>{0.527760983f, 0.367580146f},
-std::array<float,2>{0.1251553f, 0.157351196f},
-std::array<float,2>{0.586581349f, 0.540360153f},
-std::array<float,2>{0.368909359f, 0.84267211f},
-std::array<float,2>{0.801371872f, 0.453734666f},
-std::array<float,2>{0.446229517f, 0.284585923f},
-std::array<float,2>{0.955864489f, 0.927030504f},
-std::array<float,2>{0.00355161214f, 0.693712473f},
-std::array<float,2>{0.703577638f, 0.0936823934f},
-std::array<float,2>{0.1778097f, 0.448900878f},
-std::array<float,2>{0.59575659f, 0.827036202f},
-std::array<float,2>{0.322938979f, 0.554961801f},
-std::array<float,2>{0.768312693f, 0.184841529f},
-std::array<float,2>{0.494354695f, 0.0633328781f},
-std::array<float,2>{0.992484391f, 0.71577692f},
-std::array<float,2>{0.0438710302f, 0.915916502f},
-std::array<float,2>{0.719541371f, 0.305845201f},
-std::array<float,2>{0.0840042904f, 0.241100445f},
-std::array<float,2>{0.665350556f, 0.612085819f},
-std::array<float,2>{0.385170937f, 0.766166329f},
-std::array<float,2>{0.928407967f, 0.432970345f},
-std::array<float,2>{0.263979316f, 0.34922567f},
-std::array<float,2>{0.866208255f, 0.989097774f},
-std::array<float,2>{0.24712716f, 0.654477f},
-std::array<float,2>{0.559783459f, 0.0187268108f},
-std::array<float,2>{0.0251963343f, 0.25672251f},
-std::array<float,2>{0.698265016f, 0.899187326f},
-std::array<float,2>{0.460884273f, 0.747270584f},
-std::array<float,2>{0.948255062f, 0.0962598398f},
-std::array<float,2>{0.35097298f, 0.146847516f},
-std::array<float,2>{0.789974809f, 0.51398766f},
-std::array<float,2>{0.144684508f, 0.85334301f},
-std::array<float,2>{0.575961292f, 0.493234158f},
-std::array<float,2>{0.211536586f, 0.0574252754f},
-std::array<float,2>{0.508708119f, 0.675535023f},
-std::array<float,2>{0.287596166f, 0.968543231f},
-std::array<float,2>{0.838272333f, 0.321132898f},
-std::array<float,2>{0.42334035f, 0.394761235f},
-std::array<float,2>{0.903341293f, 0.810931385f},
-std::array<float,2>{0.101697586f, 0.586703956f},
-std::array<float,2>{0.646809638f, 0.208434761f},
-std::array<float,2>{0.150528282f, 0.299226463f},
-std::array<float,2>{0.566116273f, 0.907518506f},
-std::array<float,2>{0.358349323f, 0.710293591f},
-std::array<float,2>{0.787084222f, 0.0766812488f},
-std::array<float,2>{0.468421221f, 0.177867085f},
-std::array<float,2>{0.942015469f, 0.552521706f},
-std::array<float,2>{0.0161189549f, 0.819727123f},
-std::array<float,2>{0.692722678f, 0.441010386f},
-std::array<float,2>{0.100950941f, 0.0300790779f},
-std::array<float,2>{0.654488802f, 0.645151675f},
-std::array<float,2>{0.437178671f, 0.999348581f},
-std::array<float,2>{0.89703083f, 0.357019931f},
-std::array<float,2>{0.290315121f, 0.428165257f},
-std::array<float,2>{0.828403771f, 0.780442953f},
-std::array<float,2>{0.210135788f, 0.622292519f},
-std::array<float,2>{0.504890382f, 0.246214435f},
-std::array<float,2>{0.037987493f, 0.491976559f},
-std::array<float,2>{0.72674799f, 0.847633898f},
-std::array<float,2>{0.488429099f, 0.504872382f},
-std::array<float,2>{0.986282766f, 0.150265545f},
-std::array<float,2>{0.315972328f, 0.1071207f},
-std::array<float,2>{0.775469542f, 0.73769486f},
-std::array<float,2>{0.186335459f, 0.893139243f},
-std::array<float,2>{0.608448088f, 0.264703929f},
-std::array<float,2>{0.235072941f, 0.217174441f},
-std::array<float,2>{0.548641503f, 0.579382777f},
-std::array<float,2>{0.250107557f, 0.804442763f},
-std::array<float,2>{0.871348441f, 0.40485391f},
-std::array<float,2>{0.377625316f, 0.319426328f},
-std::array<float,2>{0.935904026f, 0.954917371f},
-std::array<float,2>{0.0934690088f, 0.68599695f},
-std::array<float,2>{0.662573159f, 0.0482174493f},
-std::array<float,2>{0.201035038f, 0.380426139f},
-std::array<float,2>{0.521663845f, 0.786600113f},
-std::array<float,2>{0.298862517f, 0.567640245f},
-std::array<float,2>{0.816680968f, 0.194496378f},
-std::array<float,2>{0.421823859f, 0.0359885879f},
-std::array<float,2>{0.886125922f, 0.663083136f},
-std::array<float,2>{0.114767134f, 0.939218283f},
-std::array<float,2>{0.635550797f, 0.332371503f},
-std::array<float,2>{0.0139120761f, 0.131733447f},
-std::array<float,2>{0.714537203f, 0.527376771f},
-std::array<float,2>{0.442381203f, 0.868031859f},
-std::array<float,2>{0.966994882f, 0.470222294f},
-std::array<float,2>{0.363478512f, 0.276802242f},
-std::array<float,2>{0.811808169f, 0.877441347f},
-std::array<float,2>{0.136629775f, 0.720657885f},
-std::array<float,2>{0.578401983f, 0.118065394f},
-std::array<float,2>{0.0661356226f, 0.366548806f},
-std::array<float,2>{0.681829274f, 0.970480084f},
-std::array<float,2>{0.404657036f, 0.640435755f},
-std::array<float,2>{0.912305236f, 0.000669726811f},
-std::array<float,2>{0.266973972f, 0.228396535f},
-std::array<float,2>{0.844618797f, 0.598479033f},
-std::array<float,2>{0.22813952f, 0.758001208f},
-std::array<float,2>{0.533842027f, 0.417707115f},
-std::array<float,2>{0.167694658f, 0.0829006955f},
-std::array<float,2>{0.624518156f, 0.697409511f},
-std::array<float,2>{0.337409437f, 0.931985021f},
-std::array<float,2>{0.751270711f, 0.295097202f},
-std::array<float,2>{0.481289059f, 0.462556064f},
-std::array<float,2>{0.974351645f, 0.828334808f},
-std::array<float,2>{0.0487630591f, 0.534235895f},
-std::array<float,2>{0.739531279f, 0.170852795f},
-std::array<float,2>{0.156446144f, 0.352377325f},
-std::array<float,2>{0.612718701f, 0.99342382f},
-std::array<float,2>{0.329328954f, 0.642331421f},
-std::array<float,2>{0.765102327f, 0.0260413028f},
-std::array<float,2>{0.468993306f, 0.246083498f},
-std::array<float,2>{0.976671338f, 0.617696941f},
-std::array<float,2>{0.0567324795f, 0.775355995f},
-std::array<float,2>{0.74549675f, 0.424653858f},
-std::array<float,2>{0.0752525777f, 0.0717914328f},
-std::array<float,2>{0.675686479f, 0.704345107f},
-std::array<float,2>{0.39493221f, 0.910613418f},
-std::array<float,2>{0.92167151f, 0.301119506f},
-std::array<float,2>{0.276057422f, 0.444730133f},
-std::array<float,2>{0.855077744f, 0.815641344f},
-std::array<float,2>{0.220698148f, 0.547152877f},
-std::array<float,2>{0.545004427f, 0.172882855f},
-std::array<float,2>{0.00669041229f, 0.399846941f},
-std::array<float,2>{0.708441138f, 0.797450006f},
-std::array<float,2>{0.450793624f, 0.584873319f},
-std::array<float,2>{0.959388256f, 0.212139174f},
-std::array<float,2>{0.371127516f, 0.0515069924f},
-std::array<float,2>{0.799246073f, 0.682775795f},
-std::array<float,2>{0.131961539f, 0.958225906f},
-std::array<float,2>{0.592658103f, 0.315102577f},
-std::array<float,2>{0.19118087f, 0.155524999f},
-std::array<float,2>{0.526725054f, 0.500657201f},
-std::array<float,2>{0.312362492f, 0.849482894f},
-std::array<float,2>{0.824913144f, 0.487172395f},
-std::array<float,2>{0.408281654f, 0.259447604f},
-std::array<float,2>{0.875492334f, 0.895436049f},
-std::array<float,2>{0.118611947f, 0.741587877f},
-std::array<float,2>{0.632532775f, 0.104291737f},
-std::array<float,2>{0.245310068f, 0.472850978f},
-std::array<float,2>{0.555132329f, 0.871486306f},
-std::array<float,2>{0.258499324f, 0.526856661f},
-std::array<float,2>{0.862676203f, 0.128173649f},
-std::array<float,2>{0.389078587f, 0.121909492f},
-std::array<float,2>{0.922786891f, 0.72550869f},
-std::array<float,2>{0.0818590969f, 0.881679654f},
-std::array<float,2>{0.67126143f, 0.278210312f},
-std::array<float,2>{0.0403488129f, 0.18873544f},
-std::array<float,2>{0.724650145f, 0.565953791f},
-std::array<float,2>{0.498133838f, 0.784100652f},
-std::array<float,2>{0.997432709f, 0.378655642f},
-std::array<float,2>{0.327848256f, 0.328283578f},
-std::array<float,2>{0.771936774f, 0.944477022f},
-std::array<float,2>{0.172640219f, 0.658749998f},
-std::array<float,2>{0.600325167f, 0.0319246463f},
-std::array<float,2>{0.108314574f, 0.292043328f},
-std::array<float,2>{0.643972039f, 0.93705523f},
-std::array<float,2>{0.428068429f, 0.702631116f},
-std::array<float,2>{0.901145875f, 0.0781810433f},
-std::array<float,2>{0.282185256f, 0.165750012f},
-std::array<float,2>{0.841424346f, 0.537012339f},
-std::array<float,2>{0.216678411f, 0.835418403f},
-std::array<float,2>{0.51319617f, 0.465331078f},
-std::array<float,2>{0.141178176f, 0.0068691764f},
-std::array<float,2>{0.572881699f, 0.634462178f},
-std::array<float,2>{0.346617401f, 0.973653436f},
-std::array<float,2>{0.796665728f, 0.360991448f},
-std::array<float,2>{0.453486353f, 0.421034127f},
-std::array<float,2>{0.952112317f, 0.762452066f},
-std::array<float,2>{0.0295488629f, 0.595401585f},
-std::array<float,2>{0.701444685f, 0.230785772f},
-std::array<float,2>{0.205467477f, 0.270629287f},
-std::array<float,2>{0.501049757f, 0.885944128f},
-std::array<float,2>{0.294044584f, 0.72711724f},
-std::array<float,2>{0.834325016f, 0.111528948f},
-std::array<float,2>{0.430336446f, 0.132896841f},
-std::array<float,2>{0.890684545f, 0.520461619f},
-std::array<float,2>{0.0948913619f, 0.86714679f},
-std::array<float,2>{0.65093267f, 0.477878213f},
-std::array<float,2>{0.0199171938f, 0.0430502929f},
-std::array<float,2>{0.689744055f, 0.671679258f},
-std::array<float,2>{0.46338293f, 0.948240221f},
-std::array<float,2>{0.94097352f, 0.342483371f},
-std::array<float,2>{0.35539189f, 0.386216283f},
-std::array<float,2>{0.784732997f, 0.79166609f},
-std::array<float,2>{0.154034764f, 0.577615798f},
-std::array<float,2>{0.56644702f, 0.195623025f},
-std::array<float,2>{0.0878642946f, 0.458651274f},
-std::array<float,2>{0.656691313f, 0.839707136f},
-std::array<float,2>{0.379163533f, 0.544815481f},
-std::array<float,2>{0.933488667f, 0.161075905f},
-std::array<float,2>{0.254846096f, 0.0880001411f},
-std::array<float,2>{0.867935359f, 0.690480709f},
-std::array<float,2>{0.241402134f, 0.925392687f},
-std::array<float,2>{0.55435586f, 0.287996739f},
-std::array<float,2>{0.182472154f, 0.224060237f},
-std::array<float,2>{0.603487968f, 0.609319568f},
-std::array<float,2>{0.316483766f, 0.757543802f},
-std::array<float,2>{0.780563593f, 0.4104895f},
-std::array<float,2>{0.488219529f, 0.372479498f},
-std::array<float,2>{0.99067992f, 0.98435998f},
-std::array<float,2>{0.0320724994f, 0.63190645f},
-std::array<float,2>{0.731293678f, 0.011644219f},
-std::array<float,2>{0.138742149f, 0.433736384f},
-std::array<float,2>{0.584197044f, 0.769587815f},
-std::array<float,2>{0.361601532f, 0.614174902f},
-std::array<float,2>{0.806264222f, 0.237942457f},
-std::array<float,2>{0.439143211f, 0.0206368472f},
-std::array<float,2>{0.961790264f, 0.652339041f},
-std::array<float,2>{0.00809376594f, 0.985430539f},
-std::array<float,2>{0.71529758f, 0.344479889f},
-std::array<float,2>{0.109917723f, 0.179812998f},
-std::array<float,2>{0.638742745f, 0.560990095f},
-std::array<float,2>{0.41623196f, 0.822922409f},
-std::array<float,2>{0.888724625f, 0.451531291f},
-std::array<float,2>{0.30262062f, 0.310840547f},
-std::array<float,2>{0.813762069f, 0.919623911f},
-std::array<float,2>{0.198281556f, 0.71442908f},
-std::array<float,2>{0.515882373f, 0.0681870207f},
-std::array<float,2>{0.0539732389f, 0.326617092f},
-std::array<float,2>{0.736003637f, 0.962130487f},
-std::array<float,2>{0.477724642f, 0.676996231f},
-std::array<float,2>{0.969774842f, 0.0604214706f},
-std::array<float,2>{0.3429344f, 0.204655468f},
-std::array<float,2>{0.754435837f, 0.591013193f},
-std::array<float,2>{0.168741152f, 0.807757795f},
-std::array<float,2>{0.619386911f, 0.394466728f},
-std::array<float,2>{0.233359829f, 0.100069411f},
-std::array<float,2>{0.538880825f, 0.746048868f},
-std::array<float,2>{0.271775365f, 0.904868364f},
-std::array<float,2>{0.85130477f, 0.252918452f},
-std::array<float,2>{0.400425315f, 0.496180415f},
-std::array<float,2>{0.907200456f, 0.857821524f},
-std::array<float,2>{0.0691896826f, 0.510615706f},
-std::array<float,2>{0.68711412f, 0.141488761f},
-std::array<float,2>{0.213387012f, 0.321356446f},
-std::array<float,2>{0.510642767f, 0.967186391f},
-std::array<float,2>{0.286932051f, 0.67388469f},
-std::array<float,2>{0.836810648f, 0.0580608137f},
-std::array<float,2>{0.425744414f, 0.207980141f},
-std::array<float,2>{0.904713511f, 0.587303817f},
-std::array<float,2>{0.10450837f, 0.812238634f},
-std::array<float,2>{0.646093249f, 0.39586696f},
-std::array<float,2>{0.0270822179f, 0.0972384065f},
-std::array<float,2>{0.695411384f, 0.746623516f},
-std::array<float,2>{0.457595825f, 0.899712741f},
-std::array<float,2>{0.94611007f, 0.257419646f},
-std::array<float,2>{0.348236382f, 0.492261022f},
-std::array<float,2>{0.791412473f, 0.852261245f},
-std::array<float,2>{0.146989807f, 0.515481353f},
-std::array<float,2>{0.577998161f, 0.147786379f},
-std::array<float,2>{0.083873421f, 0.432236582f},
-std::array<float,2>{0.667001843f, 0.766955078f},
-std::array<float,2>{0.383783072f, 0.61318773f},
-std::array<float,2>{0.92591083f, 0.241779819f},
-std::array<float,2>{0.262867033f, 0.0177833177f},
-std::array<float,2>{0.863788486f, 0.655487776f},
-std::array<float,2>{0.249669805f, 0.989434123f},
-std::array<float,2>{0.562454522f, 0.347729504f},
-std::array<float,2>{0.176945373f, 0.183822721f},
-std::array<float,2>{0.594797432f, 0.556639075f},
-std::array<float,2>{0.321558595f, 0.827792346f},
-std::array<float,2>{0.766824841f, 0.447390288f},
-std::array<float,2>{0.492570311f, 0.305149645f},
-std::array<float,2>{0.995921373f, 0.914443552f},
-std::array<float,2>{0.0459588058f, 0.715880692f},
-std::array<float,2>{0.720974207f, 0.0635364875f},
-std::array<float,2>{0.127767757f, 0.45468834f},
-std::array<float,2>{0.588474035f, 0.843054593f},
-std::array<float,2>{0.370544732f, 0.539374053f},
-std::array<float,2>{0.803299546f, 0.156798035f},
-std::array<float,2>{0.449106216f, 0.09189713f},
-std::array<float,2>{0.953879416f, 0.695018768f},
-std::array<float,2>{0.00061990117f, 0.926671326f},
-std::array<float,2>{0.705511868f, 0.283820689f},
-std::array<float,2>{0.124768838f, 0.220430493f},
-std::array<float,2>{0.625687897f, 0.602060735f},
-std::array<float,2>{0.412525296f, 0.752672195f},
-std::array<float,2>{0.881690741f, 0.407028288f},
-std::array<float,2>{0.308313102f, 0.368390799f},
-std::array<float,2>{0.823700428f, 0.977601767f},
-std::array<float,2>{0.194461286f, 0.625015318f},
-std::array<float,2>{0.529479861f, 0.0129514737f},
-std::array<float,2>{0.0608545914f, 0.269456297f},
-std::array<float,2>{0.749813676f, 0.888338089f},
-std::array<float,2>{0.473965108f, 0.732647836f},
-std::array<float,2>{0.981564403f, 0.114918046f},
-std::array<float,2>{0.332088411f, 0.138777599f},
-std::array<float,2>{0.758785367f, 0.517253101f},
-std::array<float,2>{0.1628602f, 0.860818624f},
-std::array<float,2>{0.613295853f, 0.482088387f},
-std::array<float,2>{0.224295452f, 0.0394282751f},
-std::array<float,2>{0.542527795f, 0.665946186f},
-std::array<float,2>{0.279504776f, 0.951742828f},
-std::array<float,2>{0.856368124f, 0.336551428f},
-std::array<float,2>{0.390980244f, 0.387995631f},
-std::array<float,2>{0.916767478f, 0.79376334f},
-std::array<float,2>{0.0712925568f, 0.570425451f},
-std::array<float,2>{0.679645658f, 0.201973736f},
-std::array<float,2>{0.165941328f, 0.296700239f},
-std::array<float,2>{0.622819602f, 0.932652354f},
-std::array<float,2>{0.339362174f, 0.698465407f},
-std::array<float,2>{0.752227128f, 0.0833239257f},
-std::array<float,2>{0.483235061f, 0.171179786f},
-std::array<float,2>{0.976060033f, 0.53349185f},
-std::array<float,2>{0.0495288856f, 0.829452872f},
-std::array<float,2>{0.741333544f, 0.46142751f},
-std::array<float,2>{0.0639098883f, 0.00192586344f},
-std::array<float,2>{0.681387186f, 0.639109969f},
-std::array<float,2>{0.403496027f, 0.969218493f},
-std::array<float,2>{0.910346031f, 0.36566633f},
-std::array<float,2>{0.267639458f, 0.416921943f},
-std::array<float,2>{0.846328974f, 0.759206831f},
-std::array<float,2>{0.229283899f, 0.599250436f},
-std::array<float,2>{0.53311938f, 0.227074832f},
-std::array<float,2>{0.0125178182f, 0.469520897f},
-std::array<float,2>{0.712172449f, 0.868356526f},
-std::array<float,2>{0.44459483f, 0.528943717f},
-std::array<float,2>{0.965836585f, 0.132149041f},
-std::array<float,2>{0.367008805f, 0.118425719f},
-std::array<float,2>{0.809022188f, 0.719187021f},
-std::array<float,2>{0.132921472f, 0.877967179f},
-std::array<float,2>{0.581867397f, 0.276061982f},
-std::array<float,2>{0.202238083f, 0.194127977f},
-std::array<float,2>{0.519536495f, 0.567033768f},
-std::array<float,2>{0.298225522f, 0.785323977f},
-std::array<float,2>{0.819391966f, 0.37933442f},
-std::array<float,2>{0.418287158f, 0.333081663f},
-std::array<float,2>{0.884423733f, 0.937628806f},
-std::array<float,2>{0.116642877f, 0.663624167f},
-std::array<float,2>{0.633755147f, 0.0371080562f},
-std::array<float,2>{0.236998841f, 0.405464798f},
-std::array<float,2>{0.550681353f, 0.803505182f},
-std::array<float,2>{0.252426028f, 0.578978717f},
-std::array<float,2>{0.874727666f, 0.217823714f},
-std::array<float,2>{0.376049995f, 0.0469173081f},
-std::array<float,2>{0.933852851f, 0.687080562f},
-std::array<float,2>{0.0901856124f, 0.953997433f},
-std::array<float,2>{0.660975754f, 0.31932649f},
-std::array<float,2>{0.0360288136f, 0.14854674f},
-std::array<float,2>{0.728552759f, 0.505836308f},
-std::array<float,2>{0.491734713f, 0.846318603f},
-std::array<float,2>{0.987116337f, 0.491090119f},
-std::array<float,2>{0.314022332f, 0.263950706f},
-std::array<float,2>{0.775226414f, 0.894028902f},
-std::array<float,2>{0.184495285f, 0.73665446f},
-std::array<float,2>{0.607103169f, 0.10603182f},
-std::array<float,2>{0.0982808694f, 0.356298238f},
-std::array<float,2>{0.652993143f, 0.998341858f},
-std::array<float,2>{0.434742153f, 0.64632839f},
-std::array<float,2>{0.895458043f, 0.0309642851f},
-std::array<float,2>{0.291753709f, 0.247080609f},
-std::array<float,2>{0.83133173f, 0.621320844f},
-std::array<float,2>{0.207644925f, 0.780140519f},
-std::array<float,2>{0.507385552f, 0.429041028f},
-std::array<float,2>{0.149951324f, 0.0772851929f},
-std::array<float,2>{0.563489854f, 0.709632814f},
-std::array<float,2>{0.356781721f, 0.90679878f},
-std::array<float,2>{0.787872076f, 0.299846083f},
-std::array<float,2>{0.4666574f, 0.439913392f},
-std::array<float,2>{0.944482028f, 0.819285214f},
-std::array<float,2>{0.0185220037f, 0.551518202f},
-std::array<float,2>{0.694795609f, 0.179007992f},
-std::array<float,2>{0.14443776f, 0.359619528f},
-std::array<float,2>{0.571154952f, 0.973497212f},
-std::array<float,2>{0.344539583f, 0.633607328f},
-std::array<float,2>{0.793966115f, 0.00634522503f},
-std::array<float,2>{0.456537187f, 0.232377142f},
-std::array<float,2>{0.94977361f, 0.593752146f},
-std::array<float,2>{0.0274518691f, 0.763547838f},
-std::array<float,2>{0.699415147f, 0.420296699f},
-std::array<float,2>{0.106699333f, 0.0791363865f},
-std::array<float,2>{0.640981555f, 0.701894641f},
-std::array<float,2>{0.425902218f, 0.936116517f},
-std::array<float,2>{0.899543166f, 0.291776717f},
-std::array<float,2>{0.28372854f, 0.466322541f},
-std::array<float,2>{0.841828048f, 0.834911346f},
-std::array<float,2>{0.218071178f, 0.535527289f},
-std::array<float,2>{0.514131069f, 0.165001139f},
-std::array<float,2>{0.041503612f, 0.377164334f},
-std::array<float,2>{0.722946703f, 0.784614205f},
-std::array<float,2>{0.497751892f, 0.564913511f},
-std::array<float,2>{0.9992311f, 0.187797993f},
-std::array<float,2>{0.324939609f, 0.0325651318f},
-std::array<float,2>{0.769850791f, 0.659864962f},
-std::array<float,2>{0.175416529f, 0.943627834f},
-std::array<float,2>{0.598309338f, 0.329388082f},
-std::array<float,2>{0.242584616f, 0.127891749f},
-std::array<float,2>{0.557291925f, 0.525584042f},
-std::array<float,2>{0.261173815f, 0.872425914f},
-std::array<float,2>{0.860132515f, 0.474119574f},
-std::array<float,2>{0.387593955f, 0.278466433f},
-std::array<float,2>{0.925372899f, 0.882684469f},
-std::array<float,2>{0.0788233504f, 0.725820124f},
-std::array<float,2>{0.66961807f, 0.122859962f},
-std::array<float,2>{0.188301176f, 0.487453997f},
-std::array<float,2>{0.524778485f, 0.848026574f},
-std::array<float,2>{0.309512019f, 0.501907468f},
-std::array<float,2>{0.827722192f, 0.154452145f},
-std::array<float,2>{0.406395227f, 0.105134912f},
-std::array<float,2>{0.878053784f, 0.741086483f},
-std::array<float,2>{0.120952703f, 0.896184266f},
-std::array<float,2>{0.629434824f, 0.258165359f},
-std::array<float,2>{0.00557876658f, 0.211725295f},
-std::array<float,2>{0.709488034f, 0.585849702f},
-std::array<float,2>{0.452682883f, 0.798350394f},
-std::array<float,2>{0.95789355f, 0.398781419f},
-std::array<float,2>{0.374711037f, 0.316182435f},
-std::array<float,2>{0.797383785f, 0.95780772f},
-std::array<float,2>{0.130545735f, 0.682381868f},
-std::array<float,2>{0.591712296f, 0.0523615554f},
-std::array<float,2>{0.0771602243f, 0.302222073f},
-std::array<float,2>{0.6737625f, 0.912046552f},
-std::array<float,2>{0.397247583f, 0.703891516f},
-std::array<float,2>{0.919829965f, 0.0708786324f},
-std::array<float,2>{0.2752316f, 0.171909243f},
-std::array<float,2>{0.852202952f, 0.548783898f},
-std::array<float,2>{0.222325549f, 0.815094054f},
-std::array<float,2>{0.543585718f, 0.44418636f},
-std::array<float,2>{0.16007033f, 0.0267685335f},
-std::array<float,2>{0.609915078f, 0.641282916f},
-std::array<float,2>{0.330113381f, 0.992973089f},
-std::array<float,2>{0.762915075f, 0.352676153f},
-std::array<float,2>{0.471353233f, 0.425188988f},
-std::array<float,2>{0.979377806f, 0.773736894f},
-std::array<float,2>{0.0563426651f, 0.618492544f},
-std::array<float,2>{0.742901981f, 0.244498894f},
-std::array<float,2>{0.231000274f, 0.253172398f},
-std::array<float,2>{0.536685824f, 0.905315638f},
-std::array<float,2>{0.270555735f, 0.744610488f},
-std::array<float,2>{0.847804785f, 0.101264454f},
-std::array<float,2>{0.400255024f, 0.142534494f},
-std::array<float,2>{0.909238756f, 0.510845363f},
-std::array<float,2>{0.067674458f, 0.859216571f},
-std::array<float,2>{0.684534371f, 0.497256935f},
-std::array<float,2>{0.051083643f, 0.0592443794f},
-std::array<float,2>{0.73695761f, 0.676749229f},
-std::array<float,2>{0.479915112f, 0.961051822f},
-std::array<float,2>{0.970923483f, 0.327747375f},
-std::array<float,2>{0.340399623f, 0.393287838f},
-std::array<float,2>{0.756872475f, 0.806801736f},
-std::array<float,2>{0.17147398f, 0.590309501f},
-std::array<float,2>{0.61854142f, 0.203613162f},
-std::array<float,2>{0.11234574f, 0.452398807f},
-std::array<float,2>{0.636938691f, 0.823850453f},
-std::array<float,2>{0.415252328f, 0.562364459f},
-std::array<float,2>{0.88765949f, 0.180666775f},
-std::array<float,2>{0.304605931f, 0.0665985569f},
-std::array<float,2>{0.816360593f, 0.713304281f},
-std::array<float,2>{0.19556959f, 0.91852206f},
-std::array<float,2>{0.518340409f, 0.311592937f},
-std::array<float,2>{0.137601048f, 0.236393511f},
-std::array<float,2>{0.582977176f, 0.614397645f},
-std::array<float,2>{0.361020982f, 0.771359682f},
-std::array<float,2>{0.806846738f, 0.434978187f},
-std::array<float,2>{0.441339642f, 0.345094562f},
-std::array<float,2>{0.963793576f, 0.984812617f},
-std::array<float,2>{0.0106883934f, 0.651099682f},
-std::array<float,2>{0.718715131f, 0.0203445256f},
-std::array<float,2>{0.181011558f, 0.411505431f},
-std::array<float,2>{0.604625225f, 0.756112874f},
-std::array<float,2>{0.319229722f, 0.607800007f},
-std::array<float,2>{0.777573228f, 0.223626435f},
-std::array<float,2>{0.485767812f, 0.0101728318f},
-std::array<float,2>{0.988418877f, 0.631667733f},
-std::array<float,2>{0.0343210921f, 0.98298949f},
-std::array<float,2>{0.733017862f, 0.371695399f},
-std::array<float,2>{0.0896385014f, 0.161322445f},
-std::array<float,2>{0.658460855f, 0.543023646f},
-std::array<float,2>{0.382004112f, 0.838747382f},
-std::array<float,2>{0.93043077f, 0.457877815f},
-std::array<float,2>{0.256650209f, 0.288976461f},
-std::array<float,2>{0.870918214f, 0.924245834f},
-std::array<float,2>{0.240093365f, 0.690083802f},
-std::array<float,2>{0.551391721f, 0.0895368978f},
-std::array<float,2>{0.0230088178f, 0.343316764f},
-std::array<float,2>{0.688084781f, 0.948846161f},
-std::array<float,2>{0.462392539f, 0.669959486f},
-std::array<float,2>{0.938086808f, 0.0445443466f},
-std::array<float,2>{0.352439016f, 0.196615756f},
-std::array<float,2>{0.781493366f, 0.576955795f},
-std::array<float,2>{0.155944571f, 0.79275918f},
-std::array<float,2>{0.56998235f, 0.385626733f},
-std::array<float,2>{0.204466924f, 0.11294964f},
-std::array<float,2>{0.502248347f, 0.727897048f},
-std::array<float,2>{0.295589268f, 0.885286272f},
-std::array<float,2>{0.833924413f, 0.269701332f},
-std::array<float,2>{0.433240533f, 0.476830244f},
-std::array<float,2>{0.893232405f, 0.86539799f},
-std::array<float,2>{0.0974344611f, 0.521482289f},
-std::array<float,2>{0.649725258f, 0.134491846f},
-std::array<float,2>{0.246576697f, 0.351332992f},
-std::array<float,2>{0.55863893f, 0.99076587f},
-std::array<float,2>{0.265234321f, 0.652682066f},
-std::array<float,2>{0.866381645f, 0.0166163966f},
-std::array<float,2>{0.386179596f, 0.238999814f},
-std::array<float,2>{0.928994298f, 0.610128582f},
-std::array<float,2>{0.0851884559f, 0.768502772f},
-std::array<float,2>{0.66486156f, 0.431404561f},
-std::array<float,2>{0.044778429f, 0.0648973957f},
-std::array<float,2>{0.719904244f, 0.717458546f},
-std::array<float,2>{0.495878011f, 0.917885602f},
-std::array<float,2>{0.993601799f, 0.307268292f},
-std::array<float,2>{0.324130297f, 0.447202355f},
-std::array<float,2>{0.768942416f, 0.825841248f},
-std::array<float,2>{0.178794682f, 0.557101846f},
-std::array<float,2>{0.597252905f, 0.185655251f},
-std::array<float,2>{0.102736026f, 0.39731884f},
-std::array<float,2>{0.648332119f, 0.809304714f},
-std::array<float,2>{0.422585011f, 0.588263035f},
-std::array<float,2>{0.903099656f, 0.209032699f},
-std::array<float,2>{0.288610667f, 0.0564523116f},
-std::array<float,2>{0.839387476f, 0.672003448f},
-std::array<float,2>{0.212586269f, 0.966537774f},
-std::array<float,2>{0.509479463f, 0.323674798f},
-std::array<float,2>{0.14590998f, 0.145704791f},
-std::array<float,2>{0.574611962f, 0.512672305f},
-std::array<float,2>{0.349823385f, 0.854283154f},
-std::array<float,2>{0.790478587f, 0.494366556f},
-std::array<float,2>{0.459861219f, 0.255113006f},
-std::array<float,2>{0.947720289f, 0.900969565f},
-std::array<float,2>{0.0235133898f, 0.748398066f},
-std::array<float,2>{0.697860539f, 0.0954297259f},
-std::array<float,2>{0.160321176f, 0.484159827f},
-std::array<float,2>{0.616456568f, 0.862551868f},
-std::array<float,2>{0.334325701f, 0.518830299f},
-std::array<float,2>{0.760217786f, 0.136928797f},
-std::array<float,2>{0.474693924f, 0.116660208f},
-std::array<float,2>{0.983404577f, 0.731467307f},
-std::array<float,2>{0.0604140721f, 0.889971733f},
-std::array<float,2>{0.746636987f, 0.265634f},
-std::array<float,2>{0.0740147978f, 0.200565055f},
-std::array<float,2>{0.676282763f, 0.573266983f},
-std::array<float,2>{0.394509882f, 0.79510659f},
-std::array<float,2>{0.914541423f, 0.389706492f},
-std::array<float,2>{0.278063715f, 0.338442773f},
-std::array<float,2>{0.858038604f, 0.950675666f},
-std::array<float,2>{0.226004675f, 0.667550087f},
-std::array<float,2>{0.539631844f, 0.042838037f},
-std::array<float,2>{0.00244461722f, 0.28223747f},
-std::array<float,2>{0.704907656f, 0.928435147f},
-std::array<float,2>{0.446929544f, 0.692501366f},
-std::array<float,2>{0.956484556f, 0.090307042f},
-std::array<float,2>{0.367780268f, 0.159678921f},
-std::array<float,2>{0.802711606f, 0.542783201f},
-std::array<float,2>{0.126314238f, 0.840800583f},
-std::array<float,2>{0.586976111f, 0.456030607f},
-std::array<float,2>{0.192002937f, 0.0140664009f},
-std::array<float,2>{0.529253542f, 0.627500057f},
-std::array<float,2>{0.305801004f, 0.979315341f},
-std::array<float,2>{0.820714831f, 0.37032038f},
-std::array<float,2>{0.410810292f, 0.40833509f},
-std::array<float,2>{0.879224479f, 0.751089573f},
-std::array<float,2>{0.121104717f, 0.604601502f},
-std::array<float,2>{0.627444923f, 0.221943423f},
-std::array<float,2>{0.134851784f, 0.273699999f},
-std::array<float,2>{0.579678118f, 0.875011086f},
-std::array<float,2>{0.364456505f, 0.721010804f},
-std::array<float,2>{0.811175942f, 0.120072193f},
-std::array<float,2>{0.442492157f, 0.130228162f},
-std::array<float,2>{0.967840791f, 0.530678332f},
-std::array<float,2>{0.0148392711f, 0.87018162f},
-std::array<float,2>{0.713320792f, 0.471623212f},
-std::array<float,2>{0.11372932f, 0.0381208956f},
-std::array<float,2>{0.63640058f, 0.660858452f},
-std::array<float,2>{0.420162767f, 0.940010726f},
-std::array<float,2>{0.885472894f, 0.334684163f},
-std::array<float,2>{0.300589859f, 0.381168902f},
-std::array<float,2>{0.818191051f, 0.788394153f},
-std::array<float,2>{0.199462801f, 0.569001377f},
-std::array<float,2>{0.522563875f, 0.192016736f},
-std::array<float,2>{0.0477359407f, 0.464561313f},
-std::array<float,2>{0.738418877f, 0.831799567f},
-std::array<float,2>{0.482388049f, 0.532092512f},
-std::array<float,2>{0.972987711f, 0.168927073f},
-std::array<float,2>{0.336054534f, 0.084958382f},
-std::array<float,2>{0.750578225f, 0.6968171f},
-std::array<float,2>{0.166187555f, 0.929863214f},
-std::array<float,2>{0.623160005f, 0.294406295f},
-std::array<float,2>{0.226930439f, 0.229084805f},
-std::array<float,2>{0.53478843f, 0.601420701f},
-std::array<float,2>{0.266157478f, 0.761532247f},
-std::array<float,2>{0.844932258f, 0.41420117f},
-std::array<float,2>{0.405948013f, 0.3645311f},
-std::array<float,2>{0.913121462f, 0.971814334f},
-std::array<float,2>{0.065172717f, 0.637941718f},
-std::array<float,2>{0.683253884f, 0.0030262915f},
-std::array<float,2>{0.209108531f, 0.426108867f},
-std::array<float,2>{0.504707038f, 0.779008389f},
-std::array<float,2>{0.289938003f, 0.623385668f},
-std::array<float,2>{0.82974714f, 0.248473883f},
-std::array<float,2>{0.436481923f, 0.0292019695f},
-std::array<float,2>{0.898352027f, 0.648234248f},
-std::array<float,2>{0.099689573f, 0.996150374f},
-std::array<float,2>{0.656114101f, 0.358299822f},
-std::array<float,2>{0.0167865884f, 0.177240968f},
-std::array<float,2>{0.692211866f, 0.554058611f},
-std::array<float,2>{0.466810584f, 0.817863941f},
-std::array<float,2>{0.942805171f, 0.438214749f},
-std::array<float,2>{0.358494639f, 0.298067689f},
-std::array<float,2>{0.785870373f, 0.909417868f},
-std::array<float,2>{0.151989177f, 0.708199024f},
-std::array<float,2>{0.565289438f, 0.0752542913f},
-std::array<float,2>{0.0921668187f, 0.316951543f},
-std::array<float,2>{0.663301408f, 0.955117524f},
-std::array<float,2>{0.378766239f, 0.685520053f},
-std::array<float,2>{0.936656237f, 0.0493260883f},
-std::array<float,2>{0.251025856f, 0.215300709f},
-std::array<float,2>{0.873001158f, 0.581935525f},
-std::array<float,2>{0.235420004f, 0.802073777f},
-std::array<float,2>{0.547558784f, 0.403196305f},
-std::array<float,2>{0.186695501f, 0.108054258f},
-std::array<float,2>{0.607611239f, 0.736176908f},
-std::array<float,2>{0.314888686f, 0.891892076f},
-std::array<float,2>{0.776840448f, 0.262388855f},
-std::array<float,2>{0.490120888f, 0.489524096f},
-std::array<float,2>{0.985263944f, 0.845308006f},
-std::array<float,2>{0.0384894051f, 0.50616616f},
-std::array<float,2>{0.727889359f, 0.152292356f},
-std::array<float,2>{0.173428446f, 0.331965417f},
-std::array<float,2>{0.600821018f, 0.943268895f},
-std::array<float,2>{0.326911479f, 0.657314241f},
-std::array<float,2>{0.773420572f, 0.0342329517f},
-std::array<float,2>{0.499649763f, 0.190122977f},
-std::array<float,2>{0.996332228f, 0.563134849f},
-std::array<float,2>{0.0394157581f, 0.78170526f},
-std::array<float,2>{0.72638762f, 0.375725061f},
-std::array<float,2>{0.0808460861f, 0.12454664f},
-std::array<float,2>{0.670123696f, 0.724120736f},
-std::array<float,2>{0.390024483f, 0.880649269f},
-std::array<float,2>{0.922901392f, 0.280548424f},
-std::array<float,2>{0.258918911f, 0.475277662f},
-std::array<float,2>{0.861698627f, 0.87381047f},
-std::array<float,2>{0.244627953f, 0.525241137f},
-std::array<float,2>{0.555977941f, 0.125571921f},
-std::array<float,2>{0.0303493682f, 0.418365568f},
-std::array<float,2>{0.702823937f, 0.765449703f},
-std::array<float,2>{0.454484344f, 0.596646905f},
-std::array<float,2>{0.952332616f, 0.234175161f},
-std::array<float,2>{0.347128779f, 0.00565816276f},
-std::array<float,2>{0.795056164f, 0.634767652f},
-std::array<float,2>{0.142386645f, 0.975333154f},
-std::array<float,2>{0.574058831f, 0.361801594f},
-std::array<float,2>{0.21573025f, 0.167595983f},
-std::array<float,2>{0.512109995f, 0.538037241f},
-std::array<float,2>{0.282866776f, 0.833812356f},
-std::array<float,2>{0.840140224f, 0.467952818f},
-std::array<float,2>{0.429185867f, 0.290450215f},
-std::array<float,2>{0.902214825f, 0.935212731f},
-std::array<float,2>{0.109129205f, 0.700648308f},
-std::array<float,2>{0.642716289f, 0.0814042166f},
-std::array<float,2>{0.219544321f, 0.441897541f},
-std::array<float,2>{0.546056211f, 0.813525617f},
-std::array<float,2>{0.276851207f, 0.54985249f},
-std::array<float,2>{0.853626251f, 0.174988121f},
-std::array<float,2>{0.396437049f, 0.0726270676f},
-std::array<float,2>{0.920139134f, 0.706719995f},
-std::array<float,2>{0.0745273083f, 0.912602007f},
-std::array<float,2>{0.6742962f, 0.304621011f},
-std::array<float,2>{0.0583756045f, 0.243000835f},
-std::array<float,2>{0.744212151f, 0.620142162f},
-std::array<float,2>{0.469799638f, 0.775614917f},
-std::array<float,2>{0.978430808f, 0.421879619f},
-std::array<float,2>{0.329048246f, 0.355456293f},
-std::array<float,2>{0.764254808f, 0.994433045f},
-std::array<float,2>{0.158018291f, 0.644442439f},
-std::array<float,2>{0.611709833f, 0.0245386045f},
-std::array<float,2>{0.118071705f, 0.260936737f},
-std::array<float,2>{0.631729543f, 0.897838414f},
-std::array<float,2>{0.409699678f, 0.740042567f},
-std::array<float,2>{0.876427054f, 0.101669975f},
-std::array<float,2>{0.310583025f, 0.154090688f},
-std::array<float,2>{0.825777233f, 0.502564847f},
-std::array<float,2>{0.190119684f, 0.849948347f},
-std::array<float,2>{0.526333392f, 0.485312551f},
-std::array<float,2>{0.131525666f, 0.0534422286f},
-std::array<float,2>{0.59349972f, 0.681435645f},
-std::array<float,2>{0.372097045f, 0.960585415f},
-std::array<float,2>{0.800267696f, 0.314355373f},
-std::array<float,2>{0.449457258f, 0.40173912f},
-std::array<float,2>{0.960808277f, 0.798875511f},
-std::array<float,2>{0.00733029237f, 0.582264781f},
-std::array<float,2>{0.707856536f, 0.213226482f},
-std::array<float,2>{0.197515711f, 0.309129059f},
-std::array<float,2>{0.517103791f, 0.921377897f},
-std::array<float,2>{0.300803959f, 0.71144402f},
-std::array<float,2>{0.813260257f, 0.0694735944f},
-std::array<float,2>{0.417277098f, 0.183517069f},
-std::array<float,2>{0.890560329f, 0.559162855f},
-std::array<float,2>{0.110630929f, 0.821703911f},
-std::array<float,2>{0.640474141f, 0.451000005f},
-std::array<float,2>{0.00895180088f, 0.023241194f},
-std::array<float,2>{0.716184139f, 0.649733841f},
-std::array<float,2>{0.438123047f, 0.987654567f},
-std::array<float,2>{0.962825239f, 0.347441554f},
-std::array<float,2>{0.362420231f, 0.436214358f},
-std::array<float,2>{0.804813445f, 0.772706628f},
-std::array<float,2>{0.140568197f, 0.615648329f},
-std::array<float,2>{0.5857777f, 0.235084012f},
-std::array<float,2>{0.0697475895f, 0.498421222f},
-std::array<float,2>{0.685579777f, 0.856482148f},
-std::array<float,2>{0.401377976f, 0.509227097f},
-std::array<float,2>{0.908002019f, 0.143247604f},
-std::array<float,2>{0.27302894f, 0.099116765f},
-std::array<float,2>{0.850144327f, 0.743466616f},
-std::array<float,2>{0.234279633f, 0.903463483f},
-std::array<float,2>{0.537231624f, 0.251300991f},
-std::array<float,2>{0.169628412f, 0.205221266f},
-std::array<float,2>{0.62012583f, 0.593167365f},
-std::array<float,2>{0.341998488f, 0.805464804f},
-std::array<float,2>{0.755208433f, 0.390865058f},
-std::array<float,2>{0.477482527f, 0.32518217f},
-std::array<float,2>{0.969067693f, 0.963849247f},
-std::array<float,2>{0.0531381331f, 0.677767277f},
-std::array<float,2>{0.735121667f, 0.0620727912f},
-std::array<float,2>{0.152676001f, 0.383360386f},
-std::array<float,2>{0.567489564f, 0.789711118f},
-std::array<float,2>{0.354472578f, 0.57615149f},
-std::array<float,2>{0.784101844f, 0.198482722f},
-std::array<float,2>{0.464476407f, 0.0457791127f},
-std::array<float,2>{0.939935327f, 0.668519616f},
-std::array<float,2>{0.0208098255f, 0.946706116f},
-std::array<float,2>{0.691219747f, 0.340364069f},
-std::array<float,2>{0.0944887027f, 0.135610491f},
-std::array<float,2>{0.651825309f, 0.522904873f},
-std::array<float,2>{0.431400746f, 0.864242136f},
-std::array<float,2>{0.89222306f, 0.480272114f},
-std::array<float,2>{0.293513387f, 0.272614539f},
-std::array<float,2>{0.835818231f, 0.883541942f},
-std::array<float,2>{0.206138313f, 0.729628623f},
-std::array<float,2>{0.500507832f, 0.111116953f},
-std::array<float,2>{0.0327748582f, 0.37381354f},
-std::array<float,2>{0.731576145f, 0.982061863f},
-std::array<float,2>{0.487208575f, 0.63071835f},
-std::array<float,2>{0.992051899f, 0.00919181667f},
-std::array<float,2>{0.317915887f, 0.225463137f},
-std::array<float,2>{0.779647112f, 0.606337249f},
-std::array<float,2>{0.183023706f, 0.754696965f},
-std::array<float,2>{0.601567388f, 0.413380295f},
-std::array<float,2>{0.240953669f, 0.0875946954f},
-std::array<float,2>{0.553188026f, 0.689208031f},
-std::array<float,2>{0.255241305f, 0.922324181f},
-std::array<float,2>{0.868382275f, 0.28593415f},
-std::array<float,2>{0.379989296f, 0.460165232f},
-std::array<float,2>{0.932157874f, 0.836049914f},
-std::array<float,2>{0.0859820396f, 0.545746207f},
-std::array<float,2>{0.657427907f, 0.162359953f},
-std::array<float,2>{0.207452983f, 0.357784927f},
-std::array<float,2>{0.507096589f, 0.996608734f},
-std::array<float,2>{0.291458517f, 0.647691965f},
-std::array<float,2>{0.831979871f, 0.0283584986f},
-std::array<float,2>{0.435245186f, 0.248827457f},
-std::array<float,2>{0.894842684f, 0.623925269f},
-std::array<float,2>{0.0980114937f, 0.778747737f},
-std::array<float,2>{0.652557731f, 0.426742554f},
-std::array<float,2>{0.0180283524f, 0.0757531151f},
-std::array<float,2>{0.695226848f, 0.708802283f},
-std::array<float,2>{0.466030478f, 0.910061061f},
-std::array<float,2>{0.945238352f, 0.298582494f},
-std::array<float,2>{0.35704881f, 0.437640101f},
-std::array<float,2>{0.787405074f, 0.818182111f},
-std::array<float,2>{0.149787128f, 0.554390609f},
-std::array<float,2>{0.564096153f, 0.177584887f},
-std::array<float,2>{0.090730004f, 0.402408332f},
-std::array<float,2>{0.660281897f, 0.802518845f},
-std::array<float,2>{0.376521558f, 0.581241548f},
-std::array<float,2>{0.93430084f, 0.215587273f},
-std::array<float,2>{0.252785712f, 0.0491620079f},
-std::array<float,2>{0.874486387f, 0.68472594f},
-std::array<float,2>{0.236697882f, 0.955703676f},
-std::array<float,2>{0.550216794f, 0.316601515f},
-std::array<float,2>{0.183680326f, 0.15160206f},
-std::array<float,2>{0.606598377f, 0.50654012f},
-std::array<float,2>{0.313896507f, 0.844846129f},
-std::array<float,2>{0.77467525f, 0.489871383f},
-std::array<float,2>{0.491618067f, 0.261822879f},
-std::array<float,2>{0.986800194f, 0.892320812f},
-std::array<float,2>{0.0352143086f, 0.735656559f},
-std::array<float,2>{0.729403198f, 0.10750331f},
-std::array<float,2>{0.133611724f, 0.471033126f},
-std::array<float,2>{0.581381202f, 0.870959997f},
-std::array<float,2>{0.366607577f, 0.530782461f},
-std::array<float,2>{0.809535086f, 0.130484134f},
-std::array<float,2>{0.445286691f, 0.119364478f},
-std::array<float,2>{0.96640414f, 0.721237838f},
-std::array<float,2>{0.0118047437f, 0.875927567f},
-std::array<float,2>{0.712752044f, 0.273931235f},
-std::array<float,2>{0.117039539f, 0.191551402f},
-std::array<float,2>{0.63312763f, 0.568826139f},
-std::array<float,2>{0.418670386f, 0.788848937f},
-std::array<float,2>{0.883844137f, 0.381710082f},
-std::array<float,2>{0.298421979f, 0.334065259f},
-std::array<float,2>{0.819940746f, 0.939497471f},
-std::array<float,2>{0.202991784f, 0.660536468f},
-std::array<float,2>{0.520302057f, 0.0389807671f},
-std::array<float,2>{0.0492057689f, 0.294797242f},
-std::array<float,2>{0.741745114f, 0.93025732f},
-std::array<float,2>{0.482541502f, 0.696295857f},
-std::array<float,2>{0.976221204f, 0.0840829909f},
-std::array<float,2>{0.339080811f, 0.168075934f},
-std::array<float,2>{0.752811968f, 0.531409085f},
-std::array<float,2>{0.165514082f, 0.831163764f},
-std::array<float,2>{0.622515857f, 0.464336067f},
-std::array<float,2>{0.228631571f, 0.00341971335f},
-std::array<float,2>{0.532513797f, 0.638340354f},
-std::array<float,2>{0.268186599f, 0.972250044f},
-std::array<float,2>{0.845727682f, 0.365066737f},
-std::array<float,2>{0.403974533f, 0.414846569f},
-std::array<float,2>{0.91074127f, 0.761088133f},
-std::array<float,2>{0.0643992871f, 0.600610614f},
-std::array<float,2>{0.680687666f, 0.22874625f},
-std::array<float,2>{0.162238836f, 0.266160011f},
-std::array<float,2>{0.61424762f, 0.890580773f},
-std::array<float,2>{0.332867414f, 0.732133865f},
-std::array<float,2>{0.758253574f, 0.116823278f},
-std::array<float,2>{0.474161774f, 0.137351289f},
-std::array<float,2>{0.982133627f, 0.519391179f},
-std::array<float,2>{0.0612601973f, 0.863263607f},
-std::array<float,2>{0.749205887f, 0.483580112f},
-std::array<float,2>{0.071862869f, 0.0422667824f},
-std::array<float,2>{0.679020464f, 0.667357266f},
-std::array<float,2>{0.391546905f, 0.950766742f},
-std::array<float,2>{0.916334629f, 0.338300198f},
-std::array<float,2>{0.280080259f, 0.390218228f},
-std::array<float,2>{0.855729461f, 0.795410335f},
-std::array<float,2>{0.224018902f, 0.574106812f},
-std::array<float,2>{0.542105198f, 0.200964183f},
-std::array<float,2>{0.000364517386f, 0.455543518f},
-std::array<float,2>{0.70587641f, 0.839914024f},
-std::array<float,2>{0.448494971f, 0.542055428f},
-std::array<float,2>{0.953413188f, 0.159204647f},
-std::array<float,2>{0.370938689f, 0.0906261876f},
-std::array<float,2>{0.803104281f, 0.693193197f},
-std::array<float,2>{0.127207443f, 0.92805922f},
-std::array<float,2>{0.588089764f, 0.282849938f},
-std::array<float,2>{0.195210606f, 0.222565994f},
-std::array<float,2>{0.530259848f, 0.605040252f},
-std::array<float,2>{0.308037966f, 0.751899123f},
-std::array<float,2>{0.823800802f, 0.408698469f},
-std::array<float,2>{0.412985027f, 0.371022314f},
-std::array<float,2>{0.881117821f, 0.978658855f},
-std::array<float,2>{0.124093927f, 0.62704283f},
-std::array<float,2>{0.62517035f, 0.0146132801f},
-std::array<float,2>{0.249259159f, 0.431079775f},
-std::array<float,2>{0.561980784f, 0.767986119f},
-std::array<float,2>{0.263429791f, 0.609671295f},
-std::array<float,2>{0.863575757f, 0.238607347f},
-std::array<float,2>{0.383154899f, 0.0175438635f},
-std::array<float,2>{0.926713049f, 0.653002918f},
-std::array<float,2>{0.0832110047f, 0.990619183f},
-std::array<float,2>{0.667500913f, 0.351069272f},
-std::array<float,2>{0.0466793738f, 0.186186433f},
-std::array<float,2>{0.721361518f, 0.557176411f},
-std::array<float,2>{0.492898822f, 0.825492501f},
-std::array<float,2>{0.995307446f, 0.4464764f},
-std::array<float,2>{0.322111636f, 0.30700174f},
-std::array<float,2>{0.76713562f, 0.917347908f},
-std::array<float,2>{0.177604526f, 0.717057526f},
-std::array<float,2>{0.595672309f, 0.0653202236f},
-std::array<float,2>{0.10506162f, 0.323781997f},
-std::array<float,2>{0.645929754f, 0.965930283f},
-std::array<float,2>{0.424953938f, 0.672810316f},
-std::array<float,2>{0.904949784f, 0.0557607934f},
-std::array<float,2>{0.286285073f, 0.209793121f},
-std::array<float,2>{0.836042047f, 0.588629663f},
-std::array<float,2>{0.213186428f, 0.808667243f},
-std::array<float,2>{0.50988239f, 0.396709621f},
-std::array<float,2>{0.146628395f, 0.0950112268f},
-std::array<float,2>{0.577617049f, 0.748806119f},
-std::array<float,2>{0.347886831f, 0.900523901f},
-std::array<float,2>{0.791598439f, 0.255589366f},
-std::array<float,2>{0.457185835f, 0.494636744f},
-std::array<float,2>{0.945448101f, 0.853992701f},
-std::array<float,2>{0.0265920255f, 0.512112975f},
-std::array<float,2>{0.695899189f, 0.146134317f},
-std::array<float,2>{0.155293122f, 0.340199322f},
-std::array<float,2>{0.56957376f, 0.947140753f},
-std::array<float,2>{0.351728648f, 0.668433368f},
-std::array<float,2>{0.782090545f, 0.045129817f},
-std::array<float,2>{0.46249491f, 0.198755607f},
-std::array<float,2>{0.937617064f, 0.575358212f},
-std::array<float,2>{0.0227873623f, 0.789283812f},
-std::array<float,2>{0.687916815f, 0.383276075f},
-std::array<float,2>{0.0968522057f, 0.11064028f},
-std::array<float,2>{0.649986088f, 0.730026424f},
-std::array<float,2>{0.432818562f, 0.882953107f},
-std::array<float,2>{0.892929673f, 0.273141474f},
-std::array<float,2>{0.295115322f, 0.479807436f},
-std::array<float,2>{0.833138347f, 0.863764584f},
-std::array<float,2>{0.205013484f, 0.523152351f},
-std::array<float,2>{0.502920568f, 0.13486585f},
-std::array<float,2>{0.0347481035f, 0.414006382f},
-std::array<float,2>{0.732677102f, 0.754171014f},
-std::array<float,2>{0.486263126f, 0.605898499f},
-std::array<float,2>{0.98903507f, 0.225050315f},
-std::array<float,2>{0.318458945f, 0.00934519991f},
-std::array<float,2>{0.77797544f, 0.63010788f},
-std::array<float,2>{0.181396529f, 0.981462121f},
-std::array<float,2>{0.605372429f, 0.373368591f},
-std::array<float,2>{0.239345208f, 0.162731662f},
-std::array<float,2>{0.550901651f, 0.545054615f},
-std::array<float,2>{0.255972803f, 0.836784661f},
-std::array<float,2>{0.870279372f, 0.460708737f},
-std::array<float,2>{0.382568568f, 0.285247445f},
-std::array<float,2>{0.929783285f, 0.922597706f},
-std::array<float,2>{0.089190349f, 0.688659966f},
-std::array<float,2>{0.659146011f, 0.0869313702f},
-std::array<float,2>{0.196078092f, 0.450631171f},
-std::array<float,2>{0.517755926f, 0.822170079f},
-std::array<float,2>{0.304006636f, 0.558628082f},
-std::array<float,2>{0.815672636f, 0.18300648f},
-std::array<float,2>{0.415852636f, 0.0700028762f},
-std::array<float,2>{0.88716644f, 0.711293161f},
-std::array<float,2>{0.112862952f, 0.921535134f},
-std::array<float,2>{0.637613535f, 0.308815479f},
-std::array<float,2>{0.0102334172f, 0.234661773f},
-std::array<float,2>{0.717844665f, 0.616178215f},
-std::array<float,2>{0.440837651f, 0.772976816f},
-std::array<float,2>{0.963117599f, 0.435734332f},
-std::array<float,2>{0.360375732f, 0.34702301f},
-std::array<float,2>{0.807140529f, 0.988263607f},
-std::array<float,2>{0.137205824f, 0.650294423f},
-std::array<float,2>{0.582481146f, 0.0228343867f},
-std::array<float,2>{0.0681550428f, 0.251829982f},
-std::array<float,2>{0.68405658f, 0.904221773f},
-std::array<float,2>{0.3997868f, 0.744128346f},
-std::array<float,2>{0.909935474f, 0.0995827317f},
-std::array<float,2>{0.271289676f, 0.142670885f},
-std::array<float,2>{0.848430276f, 0.509422243f},
-std::array<float,2>{0.230869293f, 0.857171118f},
-std::array<float,2>{0.536381662f, 0.498554438f},
-std::array<float,2>{0.171236709f, 0.0616580807f},
-std::array<float,2>{0.619017303f, 0.678593695f},
-std::array<float,2>{0.339990616f, 0.962962091f},
-std::array<float,2>{0.757740378f, 0.324673206f},
-std::array<float,2>{0.480386734f, 0.391202509f},
-std::array<float,2>{0.971667707f, 0.804804504f},
-std::array<float,2>{0.0514603704f, 0.593513548f},
-std::array<float,2>{0.736395478f, 0.205735788f},
-std::array<float,2>{0.221982211f, 0.303801388f},
-std::array<float,2>{0.543264508f, 0.912207067f},
-std::array<float,2>{0.274896741f, 0.706210792f},
-std::array<float,2>{0.851891637f, 0.0727842823f},
-std::array<float,2>{0.39669475f, 0.175347507f},
-std::array<float,2>{0.919383824f, 0.550720155f},
-std::array<float,2>{0.0780444071f, 0.814094901f},
-std::array<float,2>{0.673152328f, 0.441501975f},
-std::array<float,2>{0.0559239835f, 0.02521405f},
-std::array<float,2>{0.742480874f, 0.644032419f},
-std::array<float,2>{0.470853001f, 0.99482435f},
-std::array<float,2>{0.978533268f, 0.354963452f},
-std::array<float,2>{0.33095336f, 0.422616601f},
-std::array<float,2>{0.76361686f, 0.776285112f},
-std::array<float,2>{0.159369156f, 0.620828688f},
-std::array<float,2>{0.609565675f, 0.242366448f},
-std::array<float,2>{0.120182782f, 0.484575212f},
-std::array<float,2>{0.629086077f, 0.850208342f},
-std::array<float,2>{0.406907946f, 0.50207603f},
-std::array<float,2>{0.878828228f, 0.153431922f},
-std::array<float,2>{0.308839947f, 0.102380462f},
-std::array<float,2>{0.827361763f, 0.739372313f},
-std::array<float,2>{0.187792435f, 0.898222446f},
-std::array<float,2>{0.525314391f, 0.261335105f},
-std::array<float,2>{0.130210966f, 0.213741213f},
-std::array<float,2>{0.591199696f, 0.582750559f},
-std::array<float,2>{0.37408787f, 0.799756169f},
-std::array<float,2>{0.797245502f, 0.402212143f},
-std::array<float,2>{0.452527165f, 0.313790888f},
-std::array<float,2>{0.957042873f, 0.960430801f},
-std::array<float,2>{0.00504668336f, 0.680735588f},
-std::array<float,2>{0.709270239f, 0.0528160557f},
-std::array<float,2>{0.175233811f, 0.375064313f},
-std::array<float,2>{0.597892761f, 0.782057583f},
-std::array<float,2>{0.324279845f, 0.562858641f},
-std::array<float,2>{0.770496309f, 0.18971996f},
-std::array<float,2>{0.497234583f, 0.0348072909f},
-std::array<float,2>{0.999995172f, 0.658067942f},
-std::array<float,2>{0.0418726765f, 0.942852855f},
-std::array<float,2>{0.72318095f, 0.331487834f},
-std::array<float,2>{0.0783291161f, 0.12513487f},
-std::array<float,2>{0.669343412f, 0.524638236f},
-std::array<float,2>{0.387201518f, 0.873483717f},
-std::array<float,2>{0.924918652f, 0.474933833f},
-std::array<float,2>{0.261559337f, 0.28098911f},
-std::array<float,2>{0.859537542f, 0.880278468f},
-std::array<float,2>{0.242747799f, 0.724560559f},
-std::array<float,2>{0.556752682f, 0.124492601f},
-std::array<float,2>{0.0279033259f, 0.362216294f},
-std::array<float,2>{0.700140297f, 0.974820673f},
-std::array<float,2>{0.456791848f, 0.635725081f},
-std::array<float,2>{0.949588656f, 0.00521070044f},
-std::array<float,2>{0.343764365f, 0.233627945f},
-std::array<float,2>{0.79490906f, 0.595809877f},
-std::array<float,2>{0.144011378f, 0.764836431f},
-std::array<float,2>{0.570720971f, 0.418759346f},
-std::array<float,2>{0.21841f, 0.0820242241f},
-std::array<float,2>{0.514218271f, 0.700933635f},
-std::array<float,2>{0.283443272f, 0.934579849f},
-std::array<float,2>{0.842764318f, 0.290647835f},
-std::array<float,2>{0.426413864f, 0.468266129f},
-std::array<float,2>{0.900067985f, 0.833449066f},
-std::array<float,2>{0.106961183f, 0.537169039f},
-std::array<float,2>{0.641292572f, 0.167121634f},
-std::array<float,2>{0.235952988f, 0.318691194f},
-std::array<float,2>{0.547256708f, 0.953582048f},
-std::array<float,2>{0.251709938f, 0.68672806f},
-std::array<float,2>{0.872354686f, 0.0474595949f},
-std::array<float,2>{0.378066897f, 0.218288526f},
-std::array<float,2>{0.937364757f, 0.578590214f},
-std::array<float,2>{0.0924557969f, 0.803127885f},
-std::array<float,2>{0.663648963f, 0.406121373f},
-std::array<float,2>{0.0386433452f, 0.105950147f},
-std::array<float,2>{0.728305995f, 0.736868739f},
-std::array<float,2>{0.489424646f, 0.894479215f},
-std::array<float,2>{0.984838426f, 0.264185965f},
-std::array<float,2>{0.315106183f, 0.490554094f},
-std::array<float,2>{0.777080834f, 0.845964313f},
-std::array<float,2>{0.187398657f, 0.505332828f},
-std::array<float,2>{0.608002365f, 0.149069518f},
-std::array<float,2>{0.100395873f, 0.429510087f},
-std::array<float,2>{0.65556854f, 0.779519379f},
-std::array<float,2>{0.435615361f, 0.621784568f},
-std::array<float,2>{0.897936523f, 0.247875094f},
-std::array<float,2>{0.289374024f, 0.0306172688f},
-std::array<float,2>{0.82950294f, 0.645912945f},
-std::array<float,2>{0.209777638f, 0.998645186f},
-std::array<float,2>{0.504322112f, 0.355927348f},
-std::array<float,2>{0.151558533f, 0.179606214f},
-std::array<float,2>{0.564733446f, 0.551068664f},
-std::array<float,2>{0.359259605f, 0.818620682f},
-std::array<float,2>{0.785434783f, 0.440063715f},
-std::array<float,2>{0.467669249f, 0.300524235f},
-std::array<float,2>{0.943312645f, 0.906447947f},
-std::array<float,2>{0.0171875544f, 0.709242284f},
-std::array<float,2>{0.691738188f, 0.0778827742f},
-std::array<float,2>{0.166617483f, 0.461043537f},
-std::array<float,2>{0.623656988f, 0.829964101f},
-std::array<float,2>{0.336625665f, 0.533743262f},
-std::array<float,2>{0.750407219f, 0.171419933f},
-std::array<float,2>{0.481459469f, 0.0838976949f},
-std::array<float,2>{0.973288536f, 0.698940575f},
-std::array<float,2>{0.0470259562f, 0.933356524f},
-std::array<float,2>{0.738885045f, 0.296218902f},
-std::array<float,2>{0.0646397322f, 0.226719469f},
-std::array<float,2>{0.682971179f, 0.598828256f},
-std::array<float,2>{0.405334085f, 0.759713948f},
-std::array<float,2>{0.913819373f, 0.41630426f},
-std::array<float,2>{0.265978187f, 0.365752935f},
-std::array<float,2>{0.845250309f, 0.969552994f},
-std::array<float,2>{0.227297664f, 0.639415324f},
-std::array<float,2>{0.534542739f, 0.00103504816f},
-std::array<float,2>{0.0151377553f, 0.275397569f},
-std::array<float,2>{0.713865042f, 0.87858969f},
-std::array<float,2>{0.442912221f, 0.719648898f},
-std::array<float,2>{0.968372464f, 0.118669242f},
-std::array<float,2>{0.365012556f, 0.132677525f},
-std::array<float,2>{0.810862482f, 0.528712749f},
-std::array<float,2>{0.135283113f, 0.868806541f},
-std::array<float,2>{0.579399645f, 0.468895882f},
-std::array<float,2>{0.199936777f, 0.0365279876f},
-std::array<float,2>{0.523426831f, 0.663279355f},
-std::array<float,2>{0.300153077f, 0.93805474f},
-std::array<float,2>{0.817398727f, 0.333796293f},
-std::array<float,2>{0.420839608f, 0.379710257f},
-std::array<float,2>{0.885221183f, 0.786061227f},
-std::array<float,2>{0.114099547f, 0.566632628f},
-std::array<float,2>{0.635864794f, 0.193644673f},
-std::array<float,2>{0.12669985f, 0.283362687f},
-std::array<float,2>{0.587750256f, 0.925918996f},
-std::array<float,2>{0.367299318f, 0.694548607f},
-std::array<float,2>{0.802015305f, 0.0924011767f},
-std::array<float,2>{0.446507573f, 0.156672105f},
-std::array<float,2>{0.956549704f, 0.539894819f},
-std::array<float,2>{0.00234625256f, 0.843510628f},
-std::array<float,2>{0.704324841f, 0.45445931f},
-std::array<float,2>{0.121750146f, 0.0132831661f},
-std::array<float,2>{0.627111435f, 0.625495493f},
-std::array<float,2>{0.41037029f, 0.978062749f},
-std::array<float,2>{0.87974298f, 0.369022727f},
-std::array<float,2>{0.306161255f, 0.4064551f},
-std::array<float,2>{0.821113169f, 0.752191961f},
-std::array<float,2>{0.191477403f, 0.601989627f},
-std::array<float,2>{0.528654695f, 0.220125616f},
-std::array<float,2>{0.0600429289f, 0.48169589f},
-std::array<float,2>{0.74619323f, 0.861060619f},
-std::array<float,2>{0.475456297f, 0.516627371f},
-std::array<float,2>{0.984332085f, 0.139315352f},
-std::array<float,2>{0.334690422f, 0.114362203f},
-std::array<float,2>{0.760411918f, 0.73322016f},
-std::array<float,2>{0.16088216f, 0.887732685f},
-std::array<float,2>{0.617143154f, 0.268626541f},
-std::array<float,2>{0.226274192f, 0.201207429f},
-std::array<float,2>{0.539527953f, 0.571055233f},
-std::array<float,2>{0.277537555f, 0.793161094f},
-std::array<float,2>{0.85753274f, 0.388646662f},
-std::array<float,2>{0.393614352f, 0.335957199f},
-std::array<float,2>{0.914708912f, 0.951630473f},
-std::array<float,2>{0.0737279207f, 0.665340006f},
-std::array<float,2>{0.675820768f, 0.039685633f},
-std::array<float,2>{0.212135598f, 0.396483094f},
-std::array<float,2>{0.508923352f, 0.811916351f},
-std::array<float,2>{0.288274348f, 0.587468922f},
-std::array<float,2>{0.838895202f, 0.207183033f},
-std::array<float,2>{0.422340631f, 0.0584126562f},
-std::array<float,2>{0.902536571f, 0.674650311f},
-std::array<float,2>{0.103134319f, 0.967757761f},
-std::array<float,2>{0.647901177f, 0.322231174f},
-std::array<float,2>{0.0242203102f, 0.148050398f},
-std::array<float,2>{0.697572649f, 0.51488328f},
-std::array<float,2>{0.459308684f, 0.851689219f},
-std::array<float,2>{0.948168993f, 0.492911071f},
-std::array<float,2>{0.350477546f, 0.257208496f},
-std::array<float,2>{0.790594757f, 0.900342047f},
-std::array<float,2>{0.146260768f, 0.746123135f},
-std::array<float,2>{0.574726939f, 0.0968540683f},
-std::array<float,2>{0.0855064243f, 0.348501861f},
-std::array<float,2>{0.664115965f, 0.989846706f},
-std::array<float,2>{0.386426151f, 0.655957401f},
-std::array<float,2>{0.92962569f, 0.0184890702f},
-std::array<float,2>{0.264954031f, 0.241402909f},
-std::array<float,2>{0.867043793f, 0.612415433f},
-std::array<float,2>{0.246817842f, 0.767501712f},
-std::array<float,2>{0.559311986f, 0.431834996f},
-std::array<float,2>{0.179266781f, 0.0639866516f},
-std::array<float,2>{0.596699059f, 0.716700017f},
-std::array<float,2>{0.323643982f, 0.914870977f},
-std::array<float,2>{0.769219398f, 0.305192173f},
-std::array<float,2>{0.495173693f, 0.447851896f},
-std::array<float,2>{0.993767321f, 0.827255309f},
-std::array<float,2>{0.0440474749f, 0.555852413f},
-std::array<float,2>{0.720697224f, 0.184240565f},
-std::array<float,2>{0.1834905f, 0.371377468f},
-std::array<float,2>{0.602230489f, 0.9826563f},
-std::array<float,2>{0.317460477f, 0.630912423f},
-std::array<float,2>{0.780037463f, 0.0107094329f},
-std::array<float,2>{0.486617416f, 0.223073348f},
-std::array<float,2>{0.991569459f, 0.60811621f},
-std::array<float,2>{0.0324767083f, 0.756410658f},
-std::array<float,2>{0.732130349f, 0.411909938f},
-std::array<float,2>{0.0866697431f, 0.0890392736f},
-std::array<float,2>{0.657883584f, 0.689534664f},
-std::array<float,2>{0.380511343f, 0.924726665f},
-std::array<float,2>{0.931660175f, 0.288320512f},
-std::array<float,2>{0.255619645f, 0.45750013f},
-std::array<float,2>{0.868715465f, 0.838281393f},
-std::array<float,2>{0.240268201f, 0.543921947f},
-std::array<float,2>{0.553287685f, 0.161801159f},
-std::array<float,2>{0.0214460157f, 0.385117859f},
-std::array<float,2>{0.690597177f, 0.792222559f},
-std::array<float,2>{0.464257836f, 0.576452732f},
-std::array<float,2>{0.940064728f, 0.197251424f},
-std::array<float,2>{0.353828281f, 0.0439682677f},
-std::array<float,2>{0.783269703f, 0.67057097f},
-std::array<float,2>{0.153022081f, 0.948707879f},
-std::array<float,2>{0.568107069f, 0.342787057f},
-std::array<float,2>{0.206630126f, 0.133814201f},
-std::array<float,2>{0.500299871f, 0.520586431f},
-std::array<float,2>{0.293174267f, 0.865743339f},
-std::array<float,2>{0.835120201f, 0.477390826f},
-std::array<float,2>{0.431077152f, 0.270310551f},
-std::array<float,2>{0.891839743f, 0.884951234f},
-std::array<float,2>{0.0939523727f, 0.72813201f},
-std::array<float,2>{0.652126372f, 0.11266236f},
-std::array<float,2>{0.233647093f, 0.498016268f},
-std::array<float,2>{0.537747562f, 0.858512044f},
-std::array<float,2>{0.272899896f, 0.511510551f},
-std::array<float,2>{0.849615395f, 0.141885206f},
-std::array<float,2>{0.402202904f, 0.100887395f},
-std::array<float,2>{0.907418549f, 0.745006859f},
-std::array<float,2>{0.0700074881f, 0.905769885f},
-std::array<float,2>{0.686367631f, 0.253594905f},
-std::array<float,2>{0.0533883572f, 0.203880891f},
-std::array<float,2>{0.734757245f, 0.590533614f},
-std::array<float,2>{0.476937205f, 0.807257175f},
-std::array<float,2>{0.969282448f, 0.39286834f},
-std::array<float,2>{0.342467368f, 0.327516437f},
-std::array<float,2>{0.7557109f, 0.96160835f},
-std::array<float,2>{0.169258505f, 0.676229f},
-std::array<float,2>{0.621071339f, 0.0587024428f},
-std::array<float,2>{0.111049198f, 0.312053263f},
-std::array<float,2>{0.639802992f, 0.918349743f},
-std::array<float,2>{0.417720556f, 0.713700414f},
-std::array<float,2>{0.890094042f, 0.0671324357f},
-std::array<float,2>{0.301360726f, 0.181577474f},
-std::array<float,2>{0.812867999f, 0.561998188f},
-std::array<float,2>{0.198001683f, 0.82359302f},
-std::array<float,2>{0.517050266f, 0.452823639f},
-std::array<float,2>{0.139960632f, 0.0199238788f},
-std::array<float,2>{0.585309088f, 0.650433183f},
-std::array<float,2>{0.363151222f, 0.985102117f},
-std::array<float,2>{0.805259883f, 0.345299155f},
-std::array<float,2>{0.4375301f, 0.435429752f},
-std::array<float,2>{0.962080538f, 0.770946383f},
-std::array<float,2>{0.00943293516f, 0.614751995f},
-std::array<float,2>{0.716511905f, 0.237090871f},
-std::array<float,2>{0.189733475f, 0.258624613f},
-std::array<float,2>{0.525819123f, 0.895877063f},
-std::array<float,2>{0.311095983f, 0.740590334f},
-std::array<float,2>{0.825604916f, 0.104792923f},
-std::array<float,2>{0.409577876f, 0.155197084f},
-std::array<float,2>{0.876629412f, 0.501219869f},
-std::array<float,2>{0.117332056f, 0.848589659f},
-std::array<float,2>{0.63124907f, 0.488124132f},
-std::array<float,2>{0.0068580471f, 0.05203446f},
-std::array<float,2>{0.707237899f, 0.681924939f},
-std::array<float,2>{0.450019747f, 0.957056224f},
-std::array<float,2>{0.960095823f, 0.315487027f},
-std::array<float,2>{0.372958362f, 0.399353504f},
-std::array<float,2>{0.800780416f, 0.798104525f},
-std::array<float,2>{0.130941167f, 0.58536458f},
-std::array<float,2>{0.59280324f, 0.210971996f},
-std::array<float,2>{0.0747959018f, 0.443406701f},
-std::array<float,2>{0.674463391f, 0.814528108f},
-std::array<float,2>{0.395707339f, 0.548030198f},
-std::array<float,2>{0.920888245f, 0.172808826f},
-std::array<float,2>{0.277126968f, 0.0706223249f},
-std::array<float,2>{0.85435909f, 0.703593671f},
-std::array<float,2>{0.219170198f, 0.911227584f},
-std::array<float,2>{0.546804667f, 0.302580237f},
-std::array<float,2>{0.157229155f, 0.245006293f},
-std::array<float,2>{0.612045288f, 0.618889689f},
-std::array<float,2>{0.328290045f, 0.774056077f},
-std::array<float,2>{0.764060259f, 0.425699919f},
-std::array<float,2>{0.470522344f, 0.353324771f},
-std::array<float,2>{0.977578759f, 0.992386818f},
-std::array<float,2>{0.0579409041f, 0.640957654f},
-std::array<float,2>{0.744972825f, 0.0270141419f},
-std::array<float,2>{0.141823351f, 0.420440286f},
-std::array<float,2>{0.573711812f, 0.76311183f},
-std::array<float,2>{0.347614318f, 0.594264388f},
-std::array<float,2>{0.795425594f, 0.23161763f},
-std::array<float,2>{0.454957515f, 0.0063821082f},
-std::array<float,2>{0.952898085f, 0.633286119f},
-std::array<float,2>{0.0309848096f, 0.972676396f},
-std::array<float,2>{0.702632189f, 0.360067159f},
-std::array<float,2>{0.108529389f, 0.164113909f},
-std::array<float,2>{0.643413782f, 0.536075056f},
-std::array<float,2>{0.429616064f, 0.834225655f},
-std::array<float,2>{0.90171802f, 0.46582818f},
-std::array<float,2>{0.282674581f, 0.291128188f},
-std::array<float,2>{0.840433657f, 0.935827792f},
-std::array<float,2>{0.214950144f, 0.70138061f},
-std::array<float,2>{0.512429357f, 0.0799087286f},
-std::array<float,2>{0.0399379954f, 0.329999328f},
-std::array<float,2>{0.725600958f, 0.943898618f},
-std::array<float,2>{0.499100685f, 0.659412086f},
-std::array<float,2>{0.996980906f, 0.0328688174f},
-std::array<float,2>{0.326238841f, 0.188015208f},
-std::array<float,2>{0.772624612f, 0.565260589f},
-std::array<float,2>{0.173184678f, 0.784907222f},
-std::array<float,2>{0.601175904f, 0.377783448f},
-std::array<float,2>{0.244835824f, 0.122182898f},
-std::array<float,2>{0.556592524f, 0.726203263f},
-std::array<float,2>{0.259376585f, 0.88210243f},
-std::array<float,2>{0.862134576f, 0.279074103f},
-std::array<float,2>{0.390457362f, 0.47458148f},
-std::array<float,2>{0.923542321f, 0.87291795f},
-std::array<float,2>{0.0803752318f, 0.525990129f},
-std::array<float,2>{0.670666099f, 0.127276123f},
-std::array<float,2>{0.201587558f, 0.332752258f},
-std::array<float,2>{0.521297038f, 0.938695312f},
-std::array<float,2>{0.296890289f, 0.662143886f},
-std::array<float,2>{0.818987787f, 0.0351782963f},
-std::array<float,2>{0.419760108f, 0.194953606f},
-std::array<float,2>{0.882973433f, 0.568020344f},
-std::array<float,2>{0.115404107f, 0.786837399f},
-std::array<float,2>{0.633793056f, 0.379905611f},
-std::array<float,2>{0.0131300688f, 0.117549732f},
-std::array<float,2>{0.711265266f, 0.719867051f},
-std::array<float,2>{0.444249868f, 0.87788868f},
-std::array<float,2>{0.965750217f, 0.277338028f},
-std::array<float,2>{0.365497112f, 0.470080554f},
-std::array<float,2>{0.809634387f, 0.867478848f},
-std::array<float,2>{0.13379702f, 0.527977407f},
-std::array<float,2>{0.580262005f, 0.131108895f},
-std::array<float,2>{0.0634007975f, 0.417321384f},
-std::array<float,2>{0.679726183f, 0.758599579f},
-std::array<float,2>{0.402538419f, 0.597738147f},
-std::array<float,2>{0.911874175f, 0.228015929f},
-std::array<float,2>{0.269105583f, 0.000307132606f},
-std::array<float,2>{0.847148478f, 0.639949322f},
-std::array<float,2>{0.229587838f, 0.969789267f},
-std::array<float,2>{0.531446993f, 0.366726726f},
-std::array<float,2>{0.164459035f, 0.170209602f},
-std::array<float,2>{0.621439397f, 0.534815907f},
-std::array<float,2>{0.338051707f, 0.829035223f},
-std::array<float,2>{0.753460407f, 0.462263435f},
-std::array<float,2>{0.484235674f, 0.295644104f},
-std::array<float,2>{0.975064576f, 0.932375371f},
-std::array<float,2>{0.0503682308f, 0.697978675f},
-std::array<float,2>{0.741103709f, 0.0823233128f},
-std::array<float,2>{0.148584723f, 0.440580487f},
-std::array<float,2>{0.563027382f, 0.820185602f},
-std::array<float,2>{0.356030464f, 0.552038074f},
-std::array<float,2>{0.78839004f, 0.178564712f},
-std::array<float,2>{0.465560585f, 0.0763435811f},
-std::array<float,2>{0.943795323f, 0.710639179f},
-std::array<float,2>{0.0194086991f, 0.908026934f},
-std::array<float,2>{0.694269657f, 0.299627542f},
-std::array<float,2>{0.0987724364f, 0.246925846f},
-std::array<float,2>{0.653755784f, 0.622876883f},
-std::array<float,2>{0.433805227f, 0.780810535f},
-std::array<float,2>{0.895552278f, 0.428615868f},
-std::array<float,2>{0.292088658f, 0.356882632f},
-std::array<float,2>{0.830567598f, 0.99964726f},
-std::array<float,2>{0.208300605f, 0.644633412f},
-std::array<float,2>{0.506341517f, 0.0296747852f},
-std::array<float,2>{0.0366186164f, 0.265607029f},
-std::array<float,2>{0.730181932f, 0.892956197f},
-std::array<float,2>{0.490921229f, 0.73815304f},
-std::array<float,2>{0.988061905f, 0.106782347f},
-std::array<float,2>{0.313281775f, 0.149779439f},
-std::array<float,2>{0.774207234f, 0.504116476f},
-std::array<float,2>{0.185160786f, 0.846863806f},
-std::array<float,2>{0.606384814f, 0.49157995f},
-std::array<float,2>{0.23744534f, 0.0485526994f},
-std::array<float,2>{0.549764574f, 0.686351836f},
-std::array<float,2>{0.253477931f, 0.954440475f},
-std::array<float,2>{0.873331308f, 0.320041984f},
-std::array<float,2>{0.375312716f, 0.404533774f},
-std::array<float,2>{0.935462594f, 0.804187834f},
-std::array<float,2>{0.0913116932f, 0.579899251f},
-std::array<float,2>{0.66128552f, 0.217552274f},
-std::array<float,2>{0.176598862f, 0.306354433f},
-std::array<float,2>{0.594151199f, 0.915228426f},
-std::array<float,2>{0.320530146f, 0.714879274f},
-std::array<float,2>{0.766001523f, 0.0628192574f},
-std::array<float,2>{0.493361056f, 0.18527028f},
-std::array<float,2>{0.995056093f, 0.555577576f},
-std::array<float,2>{0.0458066314f, 0.826444268f},
-std::array<float,2>{0.722653985f, 0.448692024f},
-std::array<float,2>{0.0828109682f, 0.0192155428f},
-std::array<float,2>{0.666128337f, 0.65525502f},
-std::array<float,2>{0.384532541f, 0.988570452f},
-std::array<float,2>{0.927452624f, 0.348938376f},
-std::array<float,2>{0.261796027f, 0.433451384f},
-std::array<float,2>{0.864379048f, 0.766064405f},
-std::array<float,2>{0.248515308f, 0.611512899f},
-std::array<float,2>{0.56093806f, 0.240534648f},
-std::array<float,2>{0.0257573761f, 0.493687838f},
-std::array<float,2>{0.696982443f, 0.85294193f},
-std::array<float,2>{0.458112597f, 0.514455974f},
-std::array<float,2>{0.946632147f, 0.14704968f},
-std::array<float,2>{0.348639399f, 0.0957339108f},
-std::array<float,2>{0.792575598f, 0.747796655f},
-std::array<float,2>{0.147999182f, 0.898455381f},
-std::array<float,2>{0.576409817f, 0.256153524f},
-std::array<float,2>{0.214293033f, 0.208957642f},
-std::array<float,2>{0.511047661f, 0.586128652f},
-std::array<float,2>{0.285791516f, 0.811427712f},
-std::array<float,2>{0.83722192f, 0.395263642f},
-std::array<float,2>{0.424686074f, 0.320792645f},
-std::array<float,2>{0.905697942f, 0.967970967f},
-std::array<float,2>{0.103704549f, 0.674889863f},
-std::array<float,2>{0.645217121f, 0.0571051091f},
-std::array<float,2>{0.222895458f, 0.386837989f},
-std::array<float,2>{0.54126364f, 0.794807076f},
-std::array<float,2>{0.281058639f, 0.571410477f},
-std::array<float,2>{0.857355714f, 0.202537507f},
-std::array<float,2>{0.392134756f, 0.0407616124f},
-std::array<float,2>{0.917949617f, 0.664160728f},
-std::array<float,2>{0.070551075f, 0.952426136f},
-std::array<float,2>{0.678613365f, 0.337067366f},
-std::array<float,2>{0.0622758828f, 0.140278652f},
-std::array<float,2>{0.748574376f, 0.516336739f},
-std::array<float,2>{0.473150194f, 0.859474659f},
-std::array<float,2>{0.981027901f, 0.48115468f},
-std::array<float,2>{0.333450109f, 0.268377155f},
-std::array<float,2>{0.759549201f, 0.886978328f},
-std::array<float,2>{0.163408652f, 0.734179139f},
-std::array<float,2>{0.614275396f, 0.113758206f},
-std::array<float,2>{0.123233475f, 0.367769003f},
-std::array<float,2>{0.625986278f, 0.97720933f},
-std::array<float,2>{0.413294286f, 0.626945317f},
-std::array<float,2>{0.881872654f, 0.0120489364f},
-std::array<float,2>{0.307445973f, 0.219462931f},
-std::array<float,2>{0.822709858f, 0.602796674f},
-std::array<float,2>{0.194107011f, 0.75333339f},
-std::array<float,2>{0.530891478f, 0.40787667f},
-std::array<float,2>{0.128728777f, 0.093104817f},
-std::array<float,2>{0.589028776f, 0.694167256f},
-std::array<float,2>{0.369758397f, 0.927383304f},
-std::array<float,2>{0.804237604f, 0.285137385f},
-std::array<float,2>{0.447913766f, 0.453272402f},
-std::array<float,2>{0.954782546f, 0.842014611f},
-std::array<float,2>{0.00114197319f, 0.540555298f},
-std::array<float,2>{0.706221163f, 0.157742321f},
-std::array<float,2>{0.138120994f, 0.343884826f},
-std::array<float,2>{0.583562672f, 0.986210942f},
-std::array<float,2>{0.359799683f, 0.651376128f},
-std::array<float,2>{0.807988942f, 0.0211129189f},
-std::array<float,2>{0.440285295f, 0.237667948f},
-std::array<float,2>{0.964427948f, 0.613479078f},
-std::array<float,2>{0.0108162407f, 0.770132244f},
-std::array<float,2>{0.717728138f, 0.434088558f},
-std::array<float,2>{0.111780502f, 0.0677534193f},
-std::array<float,2>{0.638395071f, 0.714253545f},
-std::array<float,2>{0.414703935f, 0.919028759f},
-std::array<float,2>{0.888433158f, 0.311464876f},
-std::array<float,2>{0.302795082f, 0.451670796f},
-std::array<float,2>{0.815368593f, 0.822730422f},
-std::array<float,2>{0.197020665f, 0.56130743f},
-std::array<float,2>{0.518795848f, 0.180279955f},
-std::array<float,2>{0.0526878536f, 0.393972248f},
-std::array<float,2>{0.737590492f, 0.808359325f},
-std::array<float,2>{0.478963286f, 0.591394305f},
-std::array<float,2>{0.972621381f, 0.204325885f},
-std::array<float,2>{0.341207594f, 0.060035117f},
-std::array<float,2>{0.756772995f, 0.677370489f},
-std::array<float,2>{0.170195132f, 0.96256423f},
-std::array<float,2>{0.617869556f, 0.326743722f},
-std::array<float,2>{0.232024357f, 0.140656278f},
-std::array<float,2>{0.535540223f, 0.509973943f},
-std::array<float,2>{0.270398974f, 0.85835433f},
-std::array<float,2>{0.848654449f, 0.496883005f},
-std::array<float,2>{0.398589671f, 0.252308577f},
-std::array<float,2>{0.909162164f, 0.90467298f},
-std::array<float,2>{0.0669646859f, 0.7455163f},
-std::array<float,2>{0.684690535f, 0.100374654f},
-std::array<float,2>{0.203891411f, 0.478484511f},
-std::array<float,2>{0.503792882f, 0.866242707f},
-std::array<float,2>{0.296020269f, 0.519553006f},
-std::array<float,2>{0.832635283f, 0.133458272f},
-std::array<float,2>{0.431788951f, 0.111918516f},
-std::array<float,2>{0.894162297f, 0.726681232f},
-std::array<float,2>{0.095706977f, 0.886514068f},
-std::array<float,2>{0.649168015f, 0.27147463f},
-std::array<float,2>{0.0224277787f, 0.196238473f},
-std::array<float,2>{0.6890499f, 0.577965856f},
-std::array<float,2>{0.461568326f, 0.791229308f},
-std::array<float,2>{0.938486755f, 0.386682987f},
-std::array<float,2>{0.353422642f, 0.342053801f},
-std::array<float,2>{0.782683432f, 0.947468758f},
-std::array<float,2>{0.154407084f, 0.671063721f},
-std::array<float,2>{0.569219589f, 0.0435587764f},
-std::array<float,2>{0.088830635f, 0.287359476f},
-std::array<float,2>{0.660071015f, 0.924808919f},
-std::array<float,2>{0.381821156f, 0.691405594f},
-std::array<float,2>{0.931107879f, 0.0885144398f},
-std::array<float,2>{0.257220685f, 0.160592183f},
-std::array<float,2>{0.869963765f, 0.544103563f},
-std::array<float,2>{0.238713279f, 0.839245737f},
-std::array<float,2>{0.552594244f, 0.458192557f},
-std::array<float,2>{0.180495441f, 0.0110630579f},
-std::array<float,2>{0.604231715f, 0.632725239f},
-std::array<float,2>{0.31960988f, 0.983518958f},
-std::array<float,2>{0.778758824f, 0.372691274f},
-std::array<float,2>{0.484766513f, 0.41089493f},
-std::array<float,2>{0.989757895f, 0.757260978f},
-std::array<float,2>{0.0341210812f, 0.60884726f},
-std::array<float,2>{0.734356701f, 0.224130198f},
-std::array<float,2>{0.243480772f, 0.277354628f},
-std::array<float,2>{0.558012724f, 0.881089687f},
-std::array<float,2>{0.259895027f, 0.724913657f},
-std::array<float,2>{0.860699415f, 0.12118531f},
-std::array<float,2>{0.388541311f, 0.128434986f},
-std::array<float,2>{0.923926115f, 0.52672869f},
-std::array<float,2>{0.0795019493f, 0.871906161f},
-std::array<float,2>{0.668564141f, 0.47342658f},
-std::array<float,2>{0.0426383615f, 0.0315691158f},
-std::array<float,2>{0.724451125f, 0.658339262f},
-std::array<float,2>{0.49700579f, 0.945295155f},
-std::array<float,2>{0.998785496f, 0.32900846f},
-std::array<float,2>{0.325372636f, 0.378068238f},
-std::array<float,2>{0.771030605f, 0.783252478f},
-std::array<float,2>{0.173912078f, 0.565446377f},
-std::array<float,2>{0.599438369f, 0.189433485f},
-std::array<float,2>{0.106100507f, 0.465350717f},
-std::array<float,2>{0.642295003f, 0.835745811f},
-std::array<float,2>{0.42759639f, 0.5362252f},
-std::array<float,2>{0.899034977f, 0.165117189f},
-std::array<float,2>{0.285103232f, 0.0790147409f},
-std::array<float,2>{0.843661189f, 0.702826321f},
-std::array<float,2>{0.216945961f, 0.936621726f},
-std::array<float,2>{0.51491946f, 0.292846709f},
-std::array<float,2>{0.143417388f, 0.231191024f},
-std::array<float,2>{0.57168138f, 0.594892502f},
-std::array<float,2>{0.345568359f, 0.76203227f},
-std::array<float,2>{0.79371959f, 0.421661794f},
-std::array<float,2>{0.455772787f, 0.360486865f},
-std::array<float,2>{0.950952947f, 0.974397123f},
-std::array<float,2>{0.0289727878f, 0.633930385f},
-std::array<float,2>{0.700265944f, 0.00753007643f},
-std::array<float,2>{0.158690631f, 0.42427969f},
-std::array<float,2>{0.610937178f, 0.774708807f},
-std::array<float,2>{0.331878126f, 0.617349148f},
-std::array<float,2>{0.761998057f, 0.245216072f},
-std::array<float,2>{0.472405672f, 0.0255078208f},
-std::array<float,2>{0.980258882f, 0.641608477f},
-std::array<float,2>{0.0551445298f, 0.993752658f},
-std::array<float,2>{0.743455827f, 0.352006733f},
-std::array<float,2>{0.0767711475f, 0.173700765f},
-std::array<float,2>{0.672259808f, 0.547535896f},
-std::array<float,2>{0.397505581f, 0.816403508f},
-std::array<float,2>{0.918083191f, 0.444855273f},
-std::array<float,2>{0.274278045f, 0.301754832f},
-std::array<float,2>{0.853450537f, 0.910752058f},
-std::array<float,2>{0.220960081f, 0.70495075f},
-std::array<float,2>{0.544067264f, 0.0717362091f},
-std::array<float,2>{0.00432834774f, 0.314734161f},
-std::array<float,2>{0.710500538f, 0.958806634f},
-std::array<float,2>{0.451239735f, 0.683207035f},
-std::array<float,2>{0.958970964f, 0.051000081f},
-std::array<float,2>{0.373911679f, 0.212736651f},
-std::array<float,2>{0.798724234f, 0.584365427f},
-std::array<float,2>{0.128921792f, 0.796997011f},
-std::array<float,2>{0.5900653f, 0.400297821f},
-std::array<float,2>{0.188841239f, 0.103684567f},
-std::array<float,2>{0.523590505f, 0.742040455f},
-std::array<float,2>{0.309603512f, 0.894904017f},
-std::array<float,2>{0.826545954f, 0.259016693f},
-std::array<float,2>{0.407887787f, 0.486579627f},
-std::array<float,2>{0.877433479f, 0.848876595f},
-std::array<float,2>{0.119464479f, 0.500396729f},
-std::array<float,2>{0.629921973f, 0.155971736f},
-std::array<float,2>{0.227805868f, 0.364159048f},
-std::array<float,2>{0.533470571f, 0.971191585f},
-std::array<float,2>{0.267561883f, 0.63700974f},
-std::array<float,2>{0.844210923f, 0.00251945644f},
-std::array<float,2>{0.405149639f, 0.229749769f},
-std::array<float,2>{0.912744761f, 0.600399911f},
-std::array<float,2>{0.0657506287f, 0.760161459f},
-std::array<float,2>{0.682320714f, 0.415321052f},
-std::array<float,2>{0.0482679978f, 0.0854701772f},
-std::array<float,2>{0.739925027f, 0.696192801f},
-std::array<float,2>{0.480782717f, 0.931563199f},
-std::array<float,2>{0.973885477f, 0.293856055f},
-std::array<float,2>{0.3371557f, 0.463747501f},
-std::array<float,2>{0.751784861f, 0.830139518f},
-std::array<float,2>{0.167208672f, 0.532868922f},
-std::array<float,2>{0.624510229f, 0.169069827f},
-std::array<float,2>{0.11448139f, 0.382601738f},
-std::array<float,2>{0.634866536f, 0.787471414f},
-std::array<float,2>{0.4209297f, 0.570075214f},
-std::array<float,2>{0.886318862f, 0.193172619f},
-std::array<float,2>{0.299487859f, 0.0374607705f},
-std::array<float,2>{0.817078233f, 0.661735475f},
-std::array<float,2>{0.200309142f, 0.941087604f},
-std::array<float,2>{0.522247791f, 0.3357566f},
-std::array<float,2>{0.135859102f, 0.129844993f},
-std::array<float,2>{0.57889986f, 0.530015528f},
-std::array<float,2>{0.363977194f, 0.869576931f},
-std::array<float,2>{0.812244833f, 0.472508848f},
-std::array<float,2>{0.441795498f, 0.275323898f},
-std::array<float,2>{0.967565477f, 0.87643528f},
-std::array<float,2>{0.0143929804f, 0.722133934f},
-std::array<float,2>{0.714057386f, 0.121078297f},
-std::array<float,2>{0.185935751f, 0.488625765f},
-std::array<float,2>{0.608921945f, 0.844329476f},
-std::array<float,2>{0.31574586f, 0.50771445f},
-std::array<float,2>{0.776347756f, 0.151220739f},
-std::array<float,2>{0.48918128f, 0.108476035f},
-std::array<float,2>{0.985616386f, 0.734473109f},
-std::array<float,2>{0.0371538773f, 0.891379297f},
-std::array<float,2>{0.72722584f, 0.263017446f},
-std::array<float,2>{0.0927767381f, 0.216173515f},
-std::array<float,2>{0.662942946f, 0.580337763f},
-std::array<float,2>{0.377346158f, 0.801576614f},
-std::array<float,2>{0.936425209f, 0.403776795f},
-std::array<float,2>{0.250541091f, 0.318034619f},
-std::array<float,2>{0.871677697f, 0.95656538f},
-std::array<float,2>{0.234517962f, 0.684342802f},
-std::array<float,2>{0.54809159f, 0.0499096513f},
-std::array<float,2>{0.0157796703f, 0.297242135f},
-std::array<float,2>{0.69304657f, 0.908538759f},
-std::array<float,2>{0.468053162f, 0.707227111f},
-std::array<float,2>{0.94183588f, 0.0750422031f},
-std::array<float,2>{0.357536018f, 0.176118985f},
-std::array<float,2>{0.786263049f, 0.552852571f},
-std::array<float,2>{0.150964499f, 0.816424012f},
-std::array<float,2>{0.565619349f, 0.43878147f},
-std::array<float,2>{0.210699722f, 0.0282528121f},
-std::array<float,2>{0.50577718f, 0.646507204f},
-std::array<float,2>{0.290916204f, 0.997340858f},
-std::array<float,2>{0.828614056f, 0.359252512f},
-std::array<float,2>{0.436967522f, 0.427269369f},
-std::array<float,2>{0.896494508f, 0.7779755f},
-std::array<float,2>{0.101230621f, 0.624380887f},
-std::array<float,2>{0.655267417f, 0.249986827f},
-std::array<float,2>{0.145305365f, 0.253973573f},
-std::array<float,2>{0.575300992f, 0.901878357f},
-std::array<float,2>{0.351114541f, 0.749600291f},
-std::array<float,2>{0.78916198f, 0.0944364518f},
-std::array<float,2>{0.460248291f, 0.14469327f},
-std::array<float,2>{0.948913932f, 0.512732923f},
-std::array<float,2>{0.0247275811f, 0.855327785f},
-std::array<float,2>{0.699028432f, 0.495747834f},
-std::array<float,2>{0.102089427f, 0.0548002757f},
-std::array<float,2>{0.647141695f, 0.672889829f},
-std::array<float,2>{0.423318148f, 0.965055227f},
-std::array<float,2>{0.904198647f, 0.322611213f},
-std::array<float,2>{0.288010687f, 0.397639871f},
-std::array<float,2>{0.838744164f, 0.810139596f},
-std::array<float,2>{0.211214006f, 0.589147031f},
-std::array<float,2>{0.508193314f, 0.210715353f},
-std::array<float,2>{0.0429944582f, 0.445574045f},
-std::array<float,2>{0.718951046f, 0.824249148f},
-std::array<float,2>{0.494688869f, 0.557664514f},
-std::array<float,2>{0.992677212f, 0.187279403f},
-std::array<float,2>{0.322420657f, 0.0660016909f},
-std::array<float,2>{0.767747402f, 0.718342245f},
-std::array<float,2>{0.178595826f, 0.916384637f},
-std::array<float,2>{0.59625423f, 0.308382004f},
-std::array<float,2>{0.247768924f, 0.239593446f},
-std::array<float,2>{0.560463667f, 0.610857248f},
-std::array<float,2>{0.264623374f, 0.76884371f},
-std::array<float,2>{0.865487754f, 0.430142522f},
-std::array<float,2>{0.385559499f, 0.350500256f},
-std::array<float,2>{0.928182602f, 0.991646111f},
-std::array<float,2>{0.0849008039f, 0.654227257f},
-std::array<float,2>{0.665973902f, 0.0158525314f},
-std::array<float,2>{0.192466646f, 0.409963071f},
-std::array<float,2>{0.527903974f, 0.750288427f},
-std::array<float,2>{0.305017591f, 0.604207635f},
-std::array<float,2>{0.822232127f, 0.22131215f},
-std::array<float,2>{0.412083685f, 0.0148281725f},
-std::array<float,2>{0.880832851f, 0.628420532f},
-std::array<float,2>{0.122686259f, 0.979739666f},
-std::array<float,2>{0.628875256f, 0.36937502f},
-std::array<float,2>{0.00324968458f, 0.15877305f},
-std::array<float,2>{0.703631461f, 0.541069388f},
-std::array<float,2>{0.445445567f, 0.841402471f},
-std::array<float,2>{0.955258191f, 0.456539065f},
-std::array<float,2>{0.36840263f, 0.281725973f},
-std::array<float,2>{0.800924599f, 0.9294523f},
-std::array<float,2>{0.125830203f, 0.691883266f},
-std::array<float,2>{0.586126685f, 0.0911273211f},
-std::array<float,2>{0.0724960342f, 0.338939071f},
-std::array<float,2>{0.677188039f, 0.950045228f},
-std::array<float,2>{0.393443346f, 0.666225314f},
-std::array<float,2>{0.915168226f, 0.0413115583f},
-std::array<float,2>{0.278380841f, 0.199982703f},
-std::array<float,2>{0.859278142f, 0.572466314f},
-std::array<float,2>{0.225564614f, 0.796258986f},
-std::array<float,2>{0.54023397f, 0.388959408f},
-std::array<float,2>{0.162051156f, 0.115502536f},
-std::array<float,2>{0.615457833f, 0.731113434f},
-std::array<float,2>{0.335262775f, 0.889511466f},
-std::array<float,2>{0.761547506f, 0.266638398f},
-std::array<float,2>{0.47598815f, 0.482499361f},
-std::array<float,2>{0.983052075f, 0.86196512f},
-std::array<float,2>{0.059029419f, 0.517705202f},
-std::array<float,2>{0.747489572f, 0.138076961f},
-std::array<float,2>{0.168212339f, 0.325722545f},
-std::array<float,2>{0.619981766f, 0.9648f},
-std::array<float,2>{0.343316853f, 0.67958051f},
-std::array<float,2>{0.753981888f, 0.0612621941f},
-std::array<float,2>{0.478360355f, 0.206431031f},
-std::array<float,2>{0.970526755f, 0.592192888f},
-std::array<float,2>{0.0543512106f, 0.806376994f},
-std::array<float,2>{0.735830069f, 0.392149955f},
-std::array<float,2>{0.0685764626f, 0.0983593985f},
-std::array<float,2>{0.686984897f, 0.742997706f},
-std::array<float,2>{0.401350915f, 0.902788043f},
-std::array<float,2>{0.90656203f, 0.250920415f},
-std::array<float,2>{0.272367388f, 0.49923563f},
-std::array<float,2>{0.850960553f, 0.85570991f},
-std::array<float,2>{0.23255977f, 0.508293211f},
-std::array<float,2>{0.53848666f, 0.14402847f},
-std::array<float,2>{0.00838512462f, 0.436728716f},
-std::array<float,2>{0.71552062f, 0.772291958f},
-std::array<float,2>{0.438728452f, 0.617040515f},
-std::array<float,2>{0.96113956f, 0.235600322f},
-std::array<float,2>{0.362046033f, 0.0218160041f},
-std::array<float,2>{0.805971503f, 0.649273098f},
-std::array<float,2>{0.139608175f, 0.986459672f},
-std::array<float,2>{0.584862351f, 0.346102655f},
-std::array<float,2>{0.198820591f, 0.182230949f},
-std::array<float,2>{0.516197622f, 0.560509622f},
-std::array<float,2>{0.302001268f, 0.820560277f},
-std::array<float,2>{0.814413249f, 0.449225307f},
-std::array<float,2>{0.416853219f, 0.310209692f},
-std::array<float,2>{0.889239848f, 0.920290828f},
-std::array<float,2>{0.109404616f, 0.712861657f},
-std::array<float,2>{0.639190614f, 0.0685846061f},
-std::array<float,2>{0.24175936f, 0.459953994f},
-std::array<float,2>{0.553851902f, 0.837491393f},
-std::array<float,2>{0.254086584f, 0.546776295f},
-std::array<float,2>{0.867507339f, 0.163741037f},
-std::array<float,2>{0.379527986f, 0.0865249932f},
-std::array<float,2>{0.93278271f, 0.688407898f},
-std::array<float,2>{0.0872621909f, 0.923557162f},
-std::array<float,2>{0.65700084f, 0.286662132f},
-std::array<float,2>{0.0317143425f, 0.225684807f},
-std::array<float,2>{0.73084259f, 0.606495857f},
-std::array<float,2>{0.487565607f, 0.754963756f},
-std::array<float,2>{0.990920544f, 0.412304491f},
-std::array<float,2>{0.31692037f, 0.374641776f},
-std::array<float,2>{0.781081557f, 0.981019258f},
-std::array<float,2>{0.181663632f, 0.629619062f},
-std::array<float,2>{0.602906764f, 0.00844267569f},
-std::array<float,2>{0.0954501256f, 0.272414446f},
-std::array<float,2>{0.650658309f, 0.883796692f},
-std::array<float,2>{0.430068761f, 0.728984237f},
-std::array<float,2>{0.891166687f, 0.110096075f},
-std::array<float,2>{0.294783205f, 0.13579376f},
-std::array<float,2>{0.834675312f, 0.521956563f},
-std::array<float,2>{0.205635056f, 0.864357829f},
-std::array<float,2>{0.501778126f, 0.478988647f},
-std::array<float,2>{0.153759658f, 0.0466771834f},
-std::array<float,2>{0.567328453f, 0.66925329f},
-std::array<float,2>{0.354590327f, 0.945352554f},
-std::array<float,2>{0.784358561f, 0.340861917f},
-std::array<float,2>{0.463319749f, 0.38434878f},
-std::array<float,2>{0.940896153f, 0.790231466f},
-std::array<float,2>{0.0201921668f, 0.57426554f},
-std::array<float,2>{0.690152824f, 0.197328955f},
-std::array<float,2>{0.216282859f, 0.289447695f},
-std::array<float,2>{0.513042808f, 0.934043705f},
-std::array<float,2>{0.28157267f, 0.700124621f},
-std::array<float,2>{0.840870678f, 0.080983147f},
-std::array<float,2>{0.428570807f, 0.166325465f},
-std::array<float,2>{0.900432289f, 0.538262546f},
-std::array<float,2>{0.10749393f, 0.83271873f},
-std::array<float,2>{0.644374073f, 0.467129081f},
-std::array<float,2>{0.0300905947f, 0.00433969405f},
-std::array<float,2>{0.702071309f, 0.635950267f},
-std::array<float,2>{0.453798324f, 0.97630924f},
-std::array<float,2>{0.951222897f, 0.363044202f},
-std::array<float,2>{0.345784068f, 0.419143498f},
-std::array<float,2>{0.795951068f, 0.763919771f},
-std::array<float,2>{0.140974149f, 0.597191989f},
-std::array<float,2>{0.572462201f, 0.23321408f},
-std::array<float,2>{0.0812898502f, 0.476422548f},
-std::array<float,2>{0.671421587f, 0.874722362f},
-std::array<float,2>{0.389503181f, 0.523635864f},
-std::array<float,2>{0.922154665f, 0.126737103f},
-std::array<float,2>{0.258043736f, 0.123309277f},
-std::array<float,2>{0.862952828f, 0.723191679f},
-std::array<float,2>{0.245766118f, 0.879476428f},
-std::array<float,2>{0.55559057f, 0.279695928f},
-std::array<float,2>{0.172108576f, 0.19111073f},
-std::array<float,2>{0.600019991f, 0.564100206f},
-std::array<float,2>{0.327433199f, 0.782727122f},
-std::array<float,2>{0.772333622f, 0.37673527f},
-std::array<float,2>{0.498954147f, 0.331036061f},
-std::array<float,2>{0.99789232f, 0.941454649f},
-std::array<float,2>{0.0408220328f, 0.656408906f},
-std::array<float,2>{0.725388944f, 0.0340414718f},
-std::array<float,2>{0.132767782f, 0.400521129f},
-std::array<float,2>{0.592226803f, 0.799830675f},
-std::array<float,2>{0.371748447f, 0.583808184f},
-std::array<float,2>{0.799738109f, 0.213909864f},
-std::array<float,2>{0.45049727f, 0.0539163202f},
-std::array<float,2>{0.959826887f, 0.680153728f},
-std::array<float,2>{0.00607016776f, 0.959170043f},
-std::array<float,2>{0.70897609f, 0.312629431f},
-std::array<float,2>{0.118724503f, 0.153035566f},
-std::array<float,2>{0.631925285f, 0.503148317f},
-std::array<float,2>{0.40899086f, 0.851275623f},
-std::array<float,2>{0.875319541f, 0.485684782f},
-std::array<float,2>{0.311819106f, 0.260501623f},
-std::array<float,2>{0.824252129f, 0.897372365f},
-std::array<float,2>{0.190907657f, 0.739130557f},
-std::array<float,2>{0.527262032f, 0.103230529f},
-std::array<float,2>{0.0573823042f, 0.353525221f},
-std::array<float,2>{0.745886266f, 0.99581784f},
-std::array<float,2>{0.469371706f, 0.642591834f},
-std::array<float,2>{0.977211058f, 0.0243619122f},
-std::array<float,2>{0.329738528f, 0.243187696f},
-std::array<float,2>{0.765431046f, 0.619225323f},
-std::array<float,2>{0.157095239f, 0.77693665f},
-std::array<float,2>{0.612859428f, 0.42367208f},
-std::array<float,2>{0.220010862f, 0.0739999041f},
-std::array<float,2>{0.545633256f, 0.705894351f},
-std::array<float,2>{0.275416195f, 0.914047599f},
-std::array<float,2>{0.854727566f, 0.303224742f},
-std::array<float,2>{0.395470083f, 0.44324705f},
-std::array<float,2>{0.921285808f, 0.812877178f},
-std::array<float,2>{0.0760121569f, 0.549471974f},
-std::array<float,2>{0.674979925f, 0.174554497f}}
\ No newline at end of file
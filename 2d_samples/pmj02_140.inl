@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.881357372f, 0.541243613f},
-std::array<float,2>{0.169344202f, 0.467748702f},
-std::array<float,2>{0.584648132f, 0.186394542f},
-std::array<float,2>{0.264180809f, 0.937084556f},
-std::array<float,2>{0.686826289f, 0.786802471f},
-std::array<float,2>{0.378938675f, 0.0716487467f},
-std::array<float,2>{0.8258183f, 0.285699397f},
-std::array<float,2>{0.11094594f, 0.658556938f},
-std::array<float,2>{0.516463697f, 0.72414726f},
-std::array<float,2>{0.322077513f, 0.317994952f},
-std::array<float,2>{0.947333694f, 0.00331895729f},
-std::array<float,2>{0.243997052f, 0.815369546f},
-std::array<float,2>{0.784532487f, 0.93898356f},
-std::array<float,2>{0.0385282934f, 0.227439538f},
-std::array<float,2>{0.731600821f, 0.432860285f},
-std::array<float,2>{0.449862123f, 0.588083327f},
-std::array<float,2>{0.848009646f, 0.628420949f},
-std::array<float,2>{0.0769655928f, 0.273269713f},
-std::array<float,2>{0.636043251f, 0.106902324f},
-std::array<float,2>{0.431075424f, 0.775236487f},
-std::array<float,2>{0.594523013f, 0.88466543f},
-std::array<float,2>{0.291776568f, 0.130197704f},
-std::array<float,2>{0.9127689f, 0.496366829f},
-std::array<float,2>{0.127077311f, 0.518030524f},
-std::array<float,2>{0.715211511f, 0.613087177f},
-std::array<float,2>{0.471450388f, 0.404407531f},
-std::array<float,2>{0.75456959f, 0.203954458f},
-std::array<float,2>{0.0165585149f, 0.990603209f},
-std::array<float,2>{0.982255757f, 0.865653694f},
-std::array<float,2>{0.201999903f, 0.0572350994f},
-std::array<float,2>{0.546138704f, 0.3695333f},
-std::array<float,2>{0.373876959f, 0.702510357f},
-std::array<float,2>{0.766686976f, 0.576930046f},
-std::array<float,2>{0.0154382056f, 0.409751236f},
-std::array<float,2>{0.695517719f, 0.237908289f},
-std::array<float,2>{0.490428358f, 0.953973413f},
-std::array<float,2>{0.550201416f, 0.834521472f},
-std::array<float,2>{0.344999015f, 0.0172791053f},
-std::array<float,2>{0.984985769f, 0.339782983f},
-std::array<float,2>{0.206589565f, 0.739052355f},
-std::array<float,2>{0.649077177f, 0.682191133f},
-std::array<float,2>{0.417446911f, 0.297626704f},
-std::array<float,2>{0.860824108f, 0.085013561f},
-std::array<float,2>{0.0901089534f, 0.800780177f},
-std::array<float,2>{0.932799101f, 0.921657979f},
-std::array<float,2>{0.153657928f, 0.16013363f},
-std::array<float,2>{0.613362551f, 0.445431381f},
-std::array<float,2>{0.302060217f, 0.55841887f},
-std::array<float,2>{0.95726186f, 0.705707848f},
-std::array<float,2>{0.225704804f, 0.349629074f},
-std::array<float,2>{0.509621143f, 0.0365211703f},
-std::array<float,2>{0.335422516f, 0.844668567f},
-std::array<float,2>{0.747474074f, 0.971420646f},
-std::array<float,2>{0.461138546f, 0.200215057f},
-std::array<float,2>{0.808146834f, 0.38076061f},
-std::array<float,2>{0.0526948795f, 0.598744869f},
-std::array<float,2>{0.573375404f, 0.500629008f},
-std::array<float,2>{0.2746135f, 0.476009071f},
-std::array<float,2>{0.904186666f, 0.150309145f},
-std::array<float,2>{0.18423453f, 0.898876548f},
-std::array<float,2>{0.835466325f, 0.7546134f},
-std::array<float,2>{0.0981445387f, 0.118426859f},
-std::array<float,2>{0.662397206f, 0.250704467f},
-std::array<float,2>{0.39765051f, 0.647296548f},
-std::array<float,2>{0.992930949f, 0.60753864f},
-std::array<float,2>{0.216164976f, 0.387775809f},
-std::array<float,2>{0.562402129f, 0.189011842f},
-std::array<float,2>{0.358243614f, 0.982751787f},
-std::array<float,2>{0.693250299f, 0.853729725f},
-std::array<float,2>{0.498363227f, 0.0402567238f},
-std::array<float,2>{0.777445614f, 0.355463266f},
-std::array<float,2>{0.00605601352f, 0.711524963f},
-std::array<float,2>{0.620227277f, 0.64946264f},
-std::array<float,2>{0.30915916f, 0.261307001f},
-std::array<float,2>{0.928297162f, 0.109875061f},
-std::array<float,2>{0.145578399f, 0.764888823f},
-std::array<float,2>{0.872478426f, 0.89290601f},
-std::array<float,2>{0.0851774141f, 0.141877085f},
-std::array<float,2>{0.642779946f, 0.482197434f},
-std::array<float,2>{0.413848728f, 0.51243341f},
-std::array<float,2>{0.797485411f, 0.746536374f},
-std::array<float,2>{0.057863228f, 0.331635147f},
-std::array<float,2>{0.738087177f, 0.0286596119f},
-std::array<float,2>{0.453204185f, 0.841371238f},
-std::array<float,2>{0.500697374f, 0.967509925f},
-std::array<float,2>{0.340214819f, 0.242980346f},
-std::array<float,2>{0.96210885f, 0.421784818f},
-std::array<float,2>{0.229230076f, 0.564830065f},
-std::array<float,2>{0.667456567f, 0.553612471f},
-std::array<float,2>{0.399683237f, 0.440772623f},
-std::array<float,2>{0.836133718f, 0.170892045f},
-std::array<float,2>{0.106514305f, 0.914027929f},
-std::array<float,2>{0.8934623f, 0.811078012f},
-std::array<float,2>{0.173842609f, 0.0893836915f},
-std::array<float,2>{0.569229782f, 0.304868311f},
-std::array<float,2>{0.271013379f, 0.673267961f},
-std::array<float,2>{0.814080834f, 0.526723683f},
-std::array<float,2>{0.123736218f, 0.492105007f},
-std::array<float,2>{0.677843451f, 0.138688341f},
-std::array<float,2>{0.383980215f, 0.878058136f},
-std::array<float,2>{0.588544488f, 0.770270586f},
-std::array<float,2>{0.250320494f, 0.0957270414f},
-std::array<float,2>{0.886289597f, 0.274650723f},
-std::array<float,2>{0.162455142f, 0.634546518f},
-std::array<float,2>{0.71971035f, 0.693769217f},
-std::array<float,2>{0.441772968f, 0.359768629f},
-std::array<float,2>{0.792411268f, 0.0545221865f},
-std::array<float,2>{0.0466430485f, 0.869823813f},
-std::array<float,2>{0.944815457f, 0.995042861f},
-std::array<float,2>{0.241112307f, 0.21438244f},
-std::array<float,2>{0.528222263f, 0.397477537f},
-std::array<float,2>{0.319255471f, 0.621020675f},
-std::array<float,2>{0.920411944f, 0.669551909f},
-std::array<float,2>{0.139291272f, 0.295919716f},
-std::array<float,2>{0.608037055f, 0.0662903786f},
-std::array<float,2>{0.284005404f, 0.790308297f},
-std::array<float,2>{0.627196491f, 0.926496148f},
-std::array<float,2>{0.423536092f, 0.172059566f},
-std::array<float,2>{0.858251333f, 0.453181177f},
-std::array<float,2>{0.0657380745f, 0.534065068f},
-std::array<float,2>{0.535638511f, 0.581067026f},
-std::array<float,2>{0.362133682f, 0.425840616f},
-std::array<float,2>{0.969076753f, 0.2229601f},
-std::array<float,2>{0.189965099f, 0.949415743f},
-std::array<float,2>{0.759498715f, 0.822393596f},
-std::array<float,2>{0.0302915536f, 0.0129308878f},
-std::array<float,2>{0.709233344f, 0.322118074f},
-std::array<float,2>{0.479167461f, 0.730448663f},
-std::array<float,2>{0.92372632f, 0.59158963f},
-std::array<float,2>{0.144326374f, 0.434543252f},
-std::array<float,2>{0.624029934f, 0.232579425f},
-std::array<float,2>{0.305690855f, 0.942508042f},
-std::array<float,2>{0.645288646f, 0.817565203f},
-std::array<float,2>{0.408112586f, 0.00764290337f},
-std::array<float,2>{0.870229065f, 0.314680099f},
-std::array<float,2>{0.0800848082f, 0.720925808f},
-std::array<float,2>{0.557584226f, 0.661442339f},
-std::array<float,2>{0.35343805f, 0.282855839f},
-std::array<float,2>{0.998202562f, 0.0756764933f},
-std::array<float,2>{0.211672574f, 0.784073114f},
-std::array<float,2>{0.776662827f, 0.93033433f},
-std::array<float,2>{0.00125052244f, 0.182607323f},
-std::array<float,2>{0.690634727f, 0.463007867f},
-std::array<float,2>{0.494789481f, 0.544717312f},
-std::array<float,2>{0.841402054f, 0.697913408f},
-std::array<float,2>{0.104513347f, 0.371812463f},
-std::array<float,2>{0.669303238f, 0.0600924157f},
-std::array<float,2>{0.406057447f, 0.860968649f},
-std::array<float,2>{0.56636411f, 0.987784863f},
-std::array<float,2>{0.269430965f, 0.210644305f},
-std::array<float,2>{0.896332502f, 0.402306587f},
-std::array<float,2>{0.178152815f, 0.614034295f},
-std::array<float,2>{0.741748273f, 0.521104813f},
-std::array<float,2>{0.459051728f, 0.49317202f},
-std::array<float,2>{0.804454327f, 0.12820445f},
-std::array<float,2>{0.0607609451f, 0.889111578f},
-std::array<float,2>{0.966277719f, 0.781023443f},
-std::array<float,2>{0.234319314f, 0.103676826f},
-std::array<float,2>{0.504122555f, 0.266820133f},
-std::array<float,2>{0.33959505f, 0.631682575f},
-std::array<float,2>{0.796594501f, 0.562484622f},
-std::array<float,2>{0.0427168049f, 0.449548244f},
-std::array<float,2>{0.72411716f, 0.160981312f},
-std::array<float,2>{0.441336155f, 0.917813838f},
-std::array<float,2>{0.524017632f, 0.80312711f},
-std::array<float,2>{0.313338548f, 0.0789296627f},
-std::array<float,2>{0.941329718f, 0.304040849f},
-std::array<float,2>{0.237490445f, 0.684301257f},
-std::array<float,2>{0.673835993f, 0.735048831f},
-std::array<float,2>{0.387528479f, 0.341545075f},
-std::array<float,2>{0.819510996f, 0.0220831167f},
-std::array<float,2>{0.117624119f, 0.831212163f},
-std::array<float,2>{0.887202263f, 0.957660377f},
-std::array<float,2>{0.157898277f, 0.240944505f},
-std::array<float,2>{0.591798961f, 0.410697848f},
-std::array<float,2>{0.255690098f, 0.573922575f},
-std::array<float,2>{0.975658357f, 0.642461479f},
-std::array<float,2>{0.193658665f, 0.257694811f},
-std::array<float,2>{0.53426367f, 0.123799756f},
-std::array<float,2>{0.36380145f, 0.751447737f},
-std::array<float,2>{0.70428592f, 0.902631879f},
-std::array<float,2>{0.482956201f, 0.153112784f},
-std::array<float,2>{0.763185918f, 0.471695721f},
-std::array<float,2>{0.0259046946f, 0.505979538f},
-std::array<float,2>{0.605426311f, 0.597589672f},
-std::array<float,2>{0.288138241f, 0.377871335f},
-std::array<float,2>{0.916124165f, 0.197421938f},
-std::array<float,2>{0.13389124f, 0.975450456f},
-std::array<float,2>{0.852164507f, 0.851116955f},
-std::array<float,2>{0.0664210469f, 0.0324752741f},
-std::array<float,2>{0.629195571f, 0.344271272f},
-std::array<float,2>{0.429072052f, 0.709816158f},
-std::array<float,2>{0.950889349f, 0.509698033f},
-std::array<float,2>{0.24930948f, 0.476562887f},
-std::array<float,2>{0.521200955f, 0.146997005f},
-std::array<float,2>{0.326683849f, 0.896967411f},
-std::array<float,2>{0.729807496f, 0.761552691f},
-std::array<float,2>{0.44607076f, 0.114941947f},
-std::array<float,2>{0.786714494f, 0.265455902f},
-std::array<float,2>{0.0334950648f, 0.655809939f},
-std::array<float,2>{0.580645919f, 0.717926741f},
-std::array<float,2>{0.260731906f, 0.358716697f},
-std::array<float,2>{0.875516534f, 0.0435792096f},
-std::array<float,2>{0.16660215f, 0.856296837f},
-std::array<float,2>{0.822257161f, 0.98005116f},
-std::array<float,2>{0.114652522f, 0.19436422f},
-std::array<float,2>{0.683396935f, 0.383573622f},
-std::array<float,2>{0.376338631f, 0.604398072f},
-std::array<float,2>{0.751167655f, 0.67888236f},
-std::array<float,2>{0.0215498004f, 0.312230825f},
-std::array<float,2>{0.713797927f, 0.0905614048f},
-std::array<float,2>{0.473205805f, 0.806108356f},
-std::array<float,2>{0.541306615f, 0.908091664f},
-std::array<float,2>{0.368611276f, 0.164116696f},
-std::array<float,2>{0.97974956f, 0.444064349f},
-std::array<float,2>{0.196006104f, 0.547500134f},
-std::array<float,2>{0.637937427f, 0.567556143f},
-std::array<float,2>{0.434952885f, 0.414218724f},
-std::array<float,2>{0.845307827f, 0.246220291f},
-std::array<float,2>{0.0730812252f, 0.963806629f},
-std::array<float,2>{0.909434676f, 0.839652777f},
-std::array<float,2>{0.131842464f, 0.0256937277f},
-std::array<float,2>{0.601054192f, 0.332063168f},
-std::array<float,2>{0.296697557f, 0.743078768f},
-std::array<float,2>{0.86362505f, 0.62217778f},
-std::array<float,2>{0.0897849128f, 0.392249733f},
-std::array<float,2>{0.65438205f, 0.216925487f},
-std::array<float,2>{0.419109166f, 0.999349892f},
-std::array<float,2>{0.611010969f, 0.871627808f},
-std::array<float,2>{0.299903095f, 0.0472457781f},
-std::array<float,2>{0.933793247f, 0.364087582f},
-std::array<float,2>{0.149999782f, 0.6883443f},
-std::array<float,2>{0.702691913f, 0.640469491f},
-std::array<float,2>{0.487700105f, 0.278855175f},
-std::array<float,2>{0.769549429f, 0.101041555f},
-std::array<float,2>{0.00988651067f, 0.767498374f},
-std::array<float,2>{0.988667309f, 0.879927456f},
-std::array<float,2>{0.207354844f, 0.134989858f},
-std::array<float,2>{0.553155184f, 0.486236334f},
-std::array<float,2>{0.348441303f, 0.529782712f},
-std::array<float,2>{0.899506986f, 0.73087585f},
-std::array<float,2>{0.181612402f, 0.327442586f},
-std::array<float,2>{0.577518463f, 0.00822522398f},
-std::array<float,2>{0.279600024f, 0.824478388f},
-std::array<float,2>{0.656656265f, 0.946545482f},
-std::array<float,2>{0.391512126f, 0.221259177f},
-std::array<float,2>{0.831279278f, 0.42471543f},
-std::array<float,2>{0.0976296514f, 0.583619237f},
-std::array<float,2>{0.514426947f, 0.535239637f},
-std::array<float,2>{0.329621851f, 0.458503991f},
-std::array<float,2>{0.956726372f, 0.176165879f},
-std::array<float,2>{0.219005749f, 0.922866285f},
-std::array<float,2>{0.809994876f, 0.794303954f},
-std::array<float,2>{0.0489428379f, 0.067916669f},
-std::array<float,2>{0.743103743f, 0.289497703f},
-std::array<float,2>{0.468384355f, 0.664127052f},
-std::array<float,2>{0.911256671f, 0.516497195f},
-std::array<float,2>{0.125693679f, 0.499908119f},
-std::array<float,2>{0.597527981f, 0.131490678f},
-std::array<float,2>{0.289963096f, 0.885356724f},
-std::array<float,2>{0.632970095f, 0.775834382f},
-std::array<float,2>{0.432770401f, 0.10754355f},
-std::array<float,2>{0.851548553f, 0.269959092f},
-std::array<float,2>{0.0756837055f, 0.626371861f},
-std::array<float,2>{0.543460727f, 0.700319946f},
-std::array<float,2>{0.372201979f, 0.368144393f},
-std::array<float,2>{0.98251605f, 0.0561309122f},
-std::array<float,2>{0.199787632f, 0.863828957f},
-std::array<float,2>{0.757076263f, 0.989990175f},
-std::array<float,2>{0.0188660491f, 0.205829903f},
-std::array<float,2>{0.717731059f, 0.403987557f},
-std::array<float,2>{0.46946916f, 0.611214221f},
-std::array<float,2>{0.827938378f, 0.657969713f},
-std::array<float,2>{0.113276109f, 0.288211733f},
-std::array<float,2>{0.685458243f, 0.0736323968f},
-std::array<float,2>{0.381382704f, 0.788034081f},
-std::array<float,2>{0.582518339f, 0.93469739f},
-std::array<float,2>{0.262412667f, 0.185329303f},
-std::array<float,2>{0.879487336f, 0.465512723f},
-std::array<float,2>{0.170585006f, 0.541012347f},
-std::array<float,2>{0.733747602f, 0.585965037f},
-std::array<float,2>{0.453089774f, 0.431491107f},
-std::array<float,2>{0.783070385f, 0.230278075f},
-std::array<float,2>{0.0370491073f, 0.939835727f},
-std::array<float,2>{0.946952164f, 0.813665032f},
-std::array<float,2>{0.245588452f, 0.000183970711f},
-std::array<float,2>{0.518697202f, 0.318476021f},
-std::array<float,2>{0.323925942f, 0.724896669f},
-std::array<float,2>{0.805228412f, 0.600019574f},
-std::array<float,2>{0.0528723262f, 0.382426143f},
-std::array<float,2>{0.748732746f, 0.202120468f},
-std::array<float,2>{0.464489371f, 0.969644368f},
-std::array<float,2>{0.511503935f, 0.847517669f},
-std::array<float,2>{0.332629889f, 0.037203148f},
-std::array<float,2>{0.960759878f, 0.349558502f},
-std::array<float,2>{0.22457768f, 0.703341782f},
-std::array<float,2>{0.661201656f, 0.646047831f},
-std::array<float,2>{0.395785391f, 0.252828687f},
-std::array<float,2>{0.832793951f, 0.120707057f},
-std::array<float,2>{0.100189008f, 0.757157981f},
-std::array<float,2>{0.90443331f, 0.901320815f},
-std::array<float,2>{0.18667838f, 0.150443658f},
-std::array<float,2>{0.570407629f, 0.472755313f},
-std::array<float,2>{0.276696861f, 0.502304077f},
-std::array<float,2>{0.986722231f, 0.740932584f},
-std::array<float,2>{0.203301921f, 0.336327791f},
-std::array<float,2>{0.548407853f, 0.018491175f},
-std::array<float,2>{0.347133934f, 0.83300072f},
-std::array<float,2>{0.698321283f, 0.955573797f},
-std::array<float,2>{0.489248037f, 0.234490693f},
-std::array<float,2>{0.76877892f, 0.406748444f},
-std::array<float,2>{0.013258378f, 0.575238943f},
-std::array<float,2>{0.615743935f, 0.555259764f},
-std::array<float,2>{0.303551912f, 0.44746694f},
-std::array<float,2>{0.930954814f, 0.156562045f},
-std::array<float,2>{0.154337287f, 0.91840142f},
-std::array<float,2>{0.862866402f, 0.798159063f},
-std::array<float,2>{0.0936222449f, 0.0832569748f},
-std::array<float,2>{0.652111709f, 0.300046116f},
-std::array<float,2>{0.415726423f, 0.680959463f},
-std::array<float,2>{0.964766741f, 0.563685238f},
-std::array<float,2>{0.228229269f, 0.419285208f},
-std::array<float,2>{0.501992702f, 0.24466297f},
-std::array<float,2>{0.342976809f, 0.965822041f},
-std::array<float,2>{0.735594094f, 0.843654156f},
-std::array<float,2>{0.45647049f, 0.0299109071f},
-std::array<float,2>{0.799834549f, 0.329905868f},
-std::array<float,2>{0.0550681949f, 0.748619199f},
-std::array<float,2>{0.567707062f, 0.67524302f},
-std::array<float,2>{0.271959156f, 0.308369935f},
-std::array<float,2>{0.891890585f, 0.0871988907f},
-std::array<float,2>{0.172042087f, 0.810038149f},
-std::array<float,2>{0.839581072f, 0.912088335f},
-std::array<float,2>{0.108352832f, 0.169129387f},
-std::array<float,2>{0.664672315f, 0.438781142f},
-std::array<float,2>{0.402324498f, 0.551801741f},
-std::array<float,2>{0.780233502f, 0.714630067f},
-std::array<float,2>{0.00538046844f, 0.353446275f},
-std::array<float,2>{0.694452047f, 0.0427569374f},
-std::array<float,2>{0.496523023f, 0.853134692f},
-std::array<float,2>{0.559636295f, 0.981829166f},
-std::array<float,2>{0.355621606f, 0.189553648f},
-std::array<float,2>{0.995586038f, 0.388695955f},
-std::array<float,2>{0.217062563f, 0.606452823f},
-std::array<float,2>{0.640960515f, 0.51494056f},
-std::array<float,2>{0.411726147f, 0.483718216f},
-std::array<float,2>{0.873640358f, 0.143056333f},
-std::array<float,2>{0.0835833326f, 0.890705287f},
-std::array<float,2>{0.926239729f, 0.763497889f},
-std::array<float,2>{0.147144929f, 0.112534046f},
-std::array<float,2>{0.61798358f, 0.257993251f},
-std::array<float,2>{0.312496424f, 0.651717126f},
-std::array<float,2>{0.857000887f, 0.53232038f},
-std::array<float,2>{0.0636476353f, 0.455857992f},
-std::array<float,2>{0.625705063f, 0.175204739f},
-std::array<float,2>{0.424716979f, 0.927847743f},
-std::array<float,2>{0.605930746f, 0.792166471f},
-std::array<float,2>{0.281952649f, 0.062696062f},
-std::array<float,2>{0.919353247f, 0.294632435f},
-std::array<float,2>{0.137574553f, 0.671202958f},
-std::array<float,2>{0.707832754f, 0.728473067f},
-std::array<float,2>{0.476590335f, 0.324072629f},
-std::array<float,2>{0.760749876f, 0.0150921494f},
-std::array<float,2>{0.0287171472f, 0.821576536f},
-std::array<float,2>{0.971585989f, 0.952310205f},
-std::array<float,2>{0.187978581f, 0.226545155f},
-std::array<float,2>{0.537974834f, 0.428037941f},
-std::array<float,2>{0.359807402f, 0.579296827f},
-std::array<float,2>{0.884500742f, 0.635161519f},
-std::array<float,2>{0.160395473f, 0.276756257f},
-std::array<float,2>{0.586624801f, 0.0946388841f},
-std::array<float,2>{0.252032012f, 0.772316992f},
-std::array<float,2>{0.676893532f, 0.875884473f},
-std::array<float,2>{0.38559112f, 0.136904642f},
-std::array<float,2>{0.815280914f, 0.488324881f},
-std::array<float,2>{0.121436387f, 0.524374127f},
-std::array<float,2>{0.530547738f, 0.618080974f},
-std::array<float,2>{0.318111986f, 0.394826591f},
-std::array<float,2>{0.941786349f, 0.212357968f},
-std::array<float,2>{0.239990592f, 0.992333651f},
-std::array<float,2>{0.78980732f, 0.8684811f},
-std::array<float,2>{0.0432730056f, 0.0519614778f},
-std::array<float,2>{0.720929384f, 0.3618249f},
-std::array<float,2>{0.444932729f, 0.693060279f},
-std::array<float,2>{0.896640539f, 0.616987884f},
-std::array<float,2>{0.176887348f, 0.399235457f},
-std::array<float,2>{0.563549042f, 0.207330108f},
-std::array<float,2>{0.265916616f, 0.985640049f},
-std::array<float,2>{0.671212018f, 0.863194406f},
-std::array<float,2>{0.402880222f, 0.0613986924f},
-std::array<float,2>{0.843028188f, 0.373757094f},
-std::array<float,2>{0.103182875f, 0.696975589f},
-std::array<float,2>{0.506719649f, 0.629232228f},
-std::array<float,2>{0.33600387f, 0.268427849f},
-std::array<float,2>{0.968046486f, 0.102038942f},
-std::array<float,2>{0.232307106f, 0.778543293f},
-std::array<float,2>{0.802015305f, 0.888211608f},
-std::array<float,2>{0.0591633841f, 0.126766443f},
-std::array<float,2>{0.7394135f, 0.494257718f},
-std::array<float,2>{0.457080096f, 0.522621155f},
-std::array<float,2>{0.868535042f, 0.718765855f},
-std::array<float,2>{0.0794670433f, 0.314392209f},
-std::array<float,2>{0.647533774f, 0.00499376422f},
-std::array<float,2>{0.410092711f, 0.820130348f},
-std::array<float,2>{0.622013927f, 0.944876134f},
-std::array<float,2>{0.308266461f, 0.232365161f},
-std::array<float,2>{0.924810827f, 0.43676278f},
-std::array<float,2>{0.141682744f, 0.593306959f},
-std::array<float,2>{0.68822825f, 0.546571255f},
-std::array<float,2>{0.494104534f, 0.462723553f},
-std::array<float,2>{0.773711562f, 0.179831177f},
-std::array<float,2>{0.00250669941f, 0.933418334f},
-std::array<float,2>{0.9965505f, 0.783100665f},
-std::array<float,2>{0.214467958f, 0.0777876228f},
-std::array<float,2>{0.556305289f, 0.28481257f},
-std::array<float,2>{0.353848875f, 0.662254572f},
-std::array<float,2>{0.765314519f, 0.503997564f},
-std::array<float,2>{0.0245852042f, 0.470142335f},
-std::array<float,2>{0.705936015f, 0.154627278f},
-std::array<float,2>{0.480506718f, 0.90550524f},
-std::array<float,2>{0.531496406f, 0.752005756f},
-std::array<float,2>{0.366232008f, 0.121197358f},
-std::array<float,2>{0.974300623f, 0.255824178f},
-std::array<float,2>{0.191579938f, 0.6426422f},
-std::array<float,2>{0.63155371f, 0.708830595f},
-std::array<float,2>{0.427175552f, 0.346589595f},
-std::array<float,2>{0.854750514f, 0.0344008133f},
-std::array<float,2>{0.0685787722f, 0.848996639f},
-std::array<float,2>{0.914640963f, 0.974276662f},
-std::array<float,2>{0.136415109f, 0.197119862f},
-std::array<float,2>{0.603122175f, 0.375471741f},
-std::array<float,2>{0.285719514f, 0.594220757f},
-std::array<float,2>{0.93800211f, 0.686444402f},
-std::array<float,2>{0.234490514f, 0.302057981f},
-std::array<float,2>{0.5256055f, 0.0800827518f},
-std::array<float,2>{0.314617664f, 0.802325189f},
-std::array<float,2>{0.726512372f, 0.915423512f},
-std::array<float,2>{0.437603533f, 0.162788361f},
-std::array<float,2>{0.793167889f, 0.452148676f},
-std::array<float,2>{0.0395863727f, 0.559843004f},
-std::array<float,2>{0.590774536f, 0.571701467f},
-std::array<float,2>{0.257796228f, 0.413758308f},
-std::array<float,2>{0.890012205f, 0.240174964f},
-std::array<float,2>{0.15841496f, 0.959642351f},
-std::array<float,2>{0.817855835f, 0.82923913f},
-std::array<float,2>{0.120604418f, 0.0214816015f},
-std::array<float,2>{0.673214853f, 0.342104644f},
-std::array<float,2>{0.389201045f, 0.737478256f},
-std::array<float,2>{0.977554381f, 0.550204039f},
-std::array<float,2>{0.198160365f, 0.443335265f},
-std::array<float,2>{0.540213048f, 0.167445794f},
-std::array<float,2>{0.371013582f, 0.909205556f},
-std::array<float,2>{0.711070001f, 0.806971312f},
-std::array<float,2>{0.47549367f, 0.0932990387f},
-std::array<float,2>{0.752045631f, 0.308860511f},
-std::array<float,2>{0.0212025773f, 0.677005529f},
-std::array<float,2>{0.598526001f, 0.745793283f},
-std::array<float,2>{0.293540239f, 0.335260898f},
-std::array<float,2>{0.908131897f, 0.025381241f},
-std::array<float,2>{0.129985258f, 0.836863577f},
-std::array<float,2>{0.846832097f, 0.961629868f},
-std::array<float,2>{0.071098648f, 0.249538422f},
-std::array<float,2>{0.639778078f, 0.417260319f},
-std::array<float,2>{0.436843485f, 0.570242763f},
-std::array<float,2>{0.789041698f, 0.653245211f},
-std::array<float,2>{0.0316231437f, 0.262779027f},
-std::array<float,2>{0.726745844f, 0.117117144f},
-std::array<float,2>{0.448281199f, 0.758639872f},
-std::array<float,2>{0.523181438f, 0.895122647f},
-std::array<float,2>{0.325997889f, 0.144596845f},
-std::array<float,2>{0.951560497f, 0.47929579f},
-std::array<float,2>{0.247676462f, 0.510032713f},
-std::array<float,2>{0.680914342f, 0.602005243f},
-std::array<float,2>{0.377998322f, 0.386381716f},
-std::array<float,2>{0.823221624f, 0.192046866f},
-std::array<float,2>{0.116515495f, 0.977656245f},
-std::array<float,2>{0.877044082f, 0.85760349f},
-std::array<float,2>{0.16423139f, 0.0465016812f},
-std::array<float,2>{0.578808308f, 0.357245088f},
-std::array<float,2>{0.258432269f, 0.716483653f},
-std::array<float,2>{0.82830435f, 0.585019052f},
-std::array<float,2>{0.0939417183f, 0.423353761f},
-std::array<float,2>{0.659211755f, 0.220618501f},
-std::array<float,2>{0.393303126f, 0.948936641f},
-std::array<float,2>{0.575033784f, 0.827532947f},
-std::array<float,2>{0.27791658f, 0.0109369205f},
-std::array<float,2>{0.902259469f, 0.325826705f},
-std::array<float,2>{0.182513177f, 0.733450413f},
-std::array<float,2>{0.744282365f, 0.6676054f},
-std::array<float,2>{0.46661365f, 0.29217276f},
-std::array<float,2>{0.810553908f, 0.0700518563f},
-std::array<float,2>{0.0487329215f, 0.795086563f},
-std::array<float,2>{0.954058111f, 0.925081372f},
-std::array<float,2>{0.222082227f, 0.178783506f},
-std::array<float,2>{0.512484848f, 0.460908234f},
-std::array<float,2>{0.331691563f, 0.5387429f},
-std::array<float,2>{0.93574959f, 0.690414906f},
-std::array<float,2>{0.152340457f, 0.365556449f},
-std::array<float,2>{0.611941516f, 0.0490669645f},
-std::array<float,2>{0.298180372f, 0.874794185f},
-std::array<float,2>{0.65320009f, 0.997565269f},
-std::array<float,2>{0.420071483f, 0.216772303f},
-std::array<float,2>{0.866538048f, 0.39435631f},
-std::array<float,2>{0.0877845064f, 0.623148441f},
-std::array<float,2>{0.551151872f, 0.527656198f},
-std::array<float,2>{0.351161867f, 0.487960905f},
-std::array<float,2>{0.991977215f, 0.134629875f},
-std::array<float,2>{0.210077673f, 0.882118344f},
-std::array<float,2>{0.773078799f, 0.768333972f},
-std::array<float,2>{0.00906984415f, 0.098080188f},
-std::array<float,2>{0.700813711f, 0.281209767f},
-std::array<float,2>{0.484925956f, 0.638332367f},
-std::array<float,2>{0.90290916f, 0.503827453f},
-std::array<float,2>{0.184600696f, 0.47446239f},
-std::array<float,2>{0.572777808f, 0.152001515f},
-std::array<float,2>{0.273975104f, 0.902150393f},
-std::array<float,2>{0.663370967f, 0.75619626f},
-std::array<float,2>{0.397346556f, 0.119897135f},
-std::array<float,2>{0.83466506f, 0.253610313f},
-std::array<float,2>{0.0986434892f, 0.644896686f},
-std::array<float,2>{0.507832646f, 0.70426023f},
-std::array<float,2>{0.334229589f, 0.347753525f},
-std::array<float,2>{0.95824784f, 0.0385825858f},
-std::array<float,2>{0.224770114f, 0.846239924f},
-std::array<float,2>{0.807509959f, 0.970539272f},
-std::array<float,2>{0.0509950742f, 0.202767804f},
-std::array<float,2>{0.746121883f, 0.380863577f},
-std::array<float,2>{0.462565213f, 0.601399243f},
-std::array<float,2>{0.86018151f, 0.680532157f},
-std::array<float,2>{0.0913974941f, 0.299752653f},
-std::array<float,2>{0.649991155f, 0.0821707621f},
-std::array<float,2>{0.416933864f, 0.797622442f},
-std::array<float,2>{0.614313185f, 0.919733167f},
-std::array<float,2>{0.301008821f, 0.157515064f},
-std::array<float,2>{0.93247211f, 0.449100196f},
-std::array<float,2>{0.152461275f, 0.55591172f},
-std::array<float,2>{0.69659102f, 0.574451745f},
-std::array<float,2>{0.491625071f, 0.407241464f},
-std::array<float,2>{0.766458631f, 0.236197188f},
-std::array<float,2>{0.0140006309f, 0.956566989f},
-std::array<float,2>{0.986032844f, 0.833109558f},
-std::array<float,2>{0.205805123f, 0.0191560052f},
-std::array<float,2>{0.549145758f, 0.33768481f},
-std::array<float,2>{0.344536573f, 0.741695285f},
-std::array<float,2>{0.755507469f, 0.610271752f},
-std::array<float,2>{0.0170224365f, 0.402452648f},
-std::array<float,2>{0.716458797f, 0.206195131f},
-std::array<float,2>{0.47169584f, 0.988672435f},
-std::array<float,2>{0.54576534f, 0.864318073f},
-std::array<float,2>{0.374127507f, 0.0555012077f},
-std::array<float,2>{0.980543375f, 0.368728161f},
-std::array<float,2>{0.202758521f, 0.700001776f},
-std::array<float,2>{0.635314226f, 0.625184f},
-std::array<float,2>{0.430243045f, 0.271478355f},
-std::array<float,2>{0.849062502f, 0.108972318f},
-std::array<float,2>{0.0774103999f, 0.776522517f},
-std::array<float,2>{0.913670599f, 0.88639009f},
-std::array<float,2>{0.128844112f, 0.132298544f},
-std::array<float,2>{0.595056117f, 0.498769999f},
-std::array<float,2>{0.292962015f, 0.517387986f},
-std::array<float,2>{0.948969781f, 0.725851715f},
-std::array<float,2>{0.242951006f, 0.31953457f},
-std::array<float,2>{0.517040789f, 0.00180098705f},
-std::array<float,2>{0.320615858f, 0.81316781f},
-std::array<float,2>{0.730961323f, 0.940929174f},
-std::array<float,2>{0.450196594f, 0.228558809f},
-std::array<float,2>{0.783925891f, 0.430522025f},
-std::array<float,2>{0.0377928466f, 0.58734715f},
-std::array<float,2>{0.58525002f, 0.539384544f},
-std::array<float,2>{0.264859945f, 0.465888143f},
-std::array<float,2>{0.882601976f, 0.184236869f},
-std::array<float,2>{0.168797374f, 0.934469104f},
-std::array<float,2>{0.824243009f, 0.78810966f},
-std::array<float,2>{0.109523356f, 0.0725588948f},
-std::array<float,2>{0.686265469f, 0.287207603f},
-std::array<float,2>{0.380404085f, 0.656345546f},
-std::array<float,2>{0.970677257f, 0.578722835f},
-std::array<float,2>{0.19050552f, 0.429677546f},
-std::array<float,2>{0.536164999f, 0.2251008f},
-std::array<float,2>{0.363134742f, 0.951233447f},
-std::array<float,2>{0.710334957f, 0.820938468f},
-std::array<float,2>{0.480020106f, 0.0140020205f},
-std::array<float,2>{0.758614004f, 0.32299754f},
-std::array<float,2>{0.0297973622f, 0.727361441f},
-std::array<float,2>{0.609178305f, 0.669950485f},
-std::array<float,2>{0.284254789f, 0.293235064f},
-std::array<float,2>{0.920931756f, 0.0639239922f},
-std::array<float,2>{0.14060837f, 0.791861236f},
-std::array<float,2>{0.858508646f, 0.929643869f},
-std::array<float,2>{0.0649948493f, 0.174142212f},
-std::array<float,2>{0.62834394f, 0.456596702f},
-std::array<float,2>{0.422330588f, 0.532156527f},
-std::array<float,2>{0.791684568f, 0.691412687f},
-std::array<float,2>{0.0455372408f, 0.362570703f},
-std::array<float,2>{0.720006645f, 0.0508080311f},
-std::array<float,2>{0.44330892f, 0.867772698f},
-std::array<float,2>{0.528930426f, 0.994112074f},
-std::array<float,2>{0.31935066f, 0.211884215f},
-std::array<float,2>{0.94432795f, 0.39620468f},
-std::array<float,2>{0.241341323f, 0.618852615f},
-std::array<float,2>{0.679041445f, 0.524629712f},
-std::array<float,2>{0.383686781f, 0.4896909f},
-std::array<float,2>{0.81331867f, 0.138629213f},
-std::array<float,2>{0.124466561f, 0.876763821f},
-std::array<float,2>{0.884870589f, 0.772824585f},
-std::array<float,2>{0.163274407f, 0.0953449011f},
-std::array<float,2>{0.589440525f, 0.275786281f},
-std::array<float,2>{0.251474053f, 0.635863245f},
-std::array<float,2>{0.837460756f, 0.55090332f},
-std::array<float,2>{0.105677858f, 0.437782109f},
-std::array<float,2>{0.666208923f, 0.168095693f},
-std::array<float,2>{0.399091125f, 0.910350263f},
-std::array<float,2>{0.57012409f, 0.808711112f},
-std::array<float,2>{0.269639134f, 0.0867314264f},
-std::array<float,2>{0.894093037f, 0.307172239f},
-std::array<float,2>{0.175278544f, 0.674702168f},
-std::array<float,2>{0.736397624f, 0.749109685f},
-std::array<float,2>{0.454554141f, 0.328941584f},
-std::array<float,2>{0.79798758f, 0.031135479f},
-std::array<float,2>{0.0568999611f, 0.842720807f},
-std::array<float,2>{0.961764812f, 0.965703428f},
-std::array<float,2>{0.230087042f, 0.245259881f},
-std::array<float,2>{0.501939654f, 0.418050081f},
-std::array<float,2>{0.341281742f, 0.563363194f},
-std::array<float,2>{0.929082751f, 0.651171625f},
-std::array<float,2>{0.144736364f, 0.259534955f},
-std::array<float,2>{0.619872332f, 0.111810163f},
-std::array<float,2>{0.310178161f, 0.762479067f},
-std::array<float,2>{0.643810391f, 0.89254123f},
-std::array<float,2>{0.412315667f, 0.143798232f},
-std::array<float,2>{0.871450126f, 0.482910305f},
-std::array<float,2>{0.0848133713f, 0.513858557f},
-std::array<float,2>{0.561473906f, 0.606271923f},
-std::array<float,2>{0.359332711f, 0.390383661f},
-std::array<float,2>{0.993812442f, 0.190735579f},
-std::array<float,2>{0.215356514f, 0.980500519f},
-std::array<float,2>{0.778520226f, 0.8522802f},
-std::array<float,2>{0.00695829093f, 0.0418923758f},
-std::array<float,2>{0.691721022f, 0.352172345f},
-std::array<float,2>{0.499879837f, 0.713254273f},
-std::array<float,2>{0.917442262f, 0.595013499f},
-std::array<float,2>{0.133396491f, 0.376569748f},
-std::array<float,2>{0.60393697f, 0.196088895f},
-std::array<float,2>{0.287911564f, 0.973398268f},
-std::array<float,2>{0.630590141f, 0.847971559f},
-std::array<float,2>{0.428145587f, 0.0337227769f},
-std::array<float,2>{0.853285193f, 0.347044349f},
-std::array<float,2>{0.0675054118f, 0.70777905f},
-std::array<float,2>{0.533760309f, 0.643738627f},
-std::array<float,2>{0.364296079f, 0.253995329f},
-std::array<float,2>{0.975260377f, 0.122425951f},
-std::array<float,2>{0.194740638f, 0.753102779f},
-std::array<float,2>{0.76212436f, 0.904967248f},
-std::array<float,2>{0.0264738221f, 0.155637473f},
-std::array<float,2>{0.703309119f, 0.468892545f},
-std::array<float,2>{0.48429957f, 0.50516504f},
-std::array<float,2>{0.818767011f, 0.736973464f},
-std::array<float,2>{0.118386425f, 0.34284851f},
-std::array<float,2>{0.674909294f, 0.0196256414f},
-std::array<float,2>{0.388633698f, 0.828643441f},
-std::array<float,2>{0.592856765f, 0.960356593f},
-std::array<float,2>{0.254023224f, 0.238509774f},
-std::array<float,2>{0.888459623f, 0.41222772f},
-std::array<float,2>{0.156262785f, 0.57074672f},
-std::array<float,2>{0.723217547f, 0.559037745f},
-std::array<float,2>{0.440099001f, 0.451634079f},
-std::array<float,2>{0.795155108f, 0.163654745f},
-std::array<float,2>{0.041586902f, 0.914163351f},
-std::array<float,2>{0.939778745f, 0.801506162f},
-std::array<float,2>{0.236536875f, 0.0818613768f},
-std::array<float,2>{0.524901807f, 0.301656842f},
-std::array<float,2>{0.313937485f, 0.6866467f},
-std::array<float,2>{0.803079009f, 0.521759152f},
-std::array<float,2>{0.0622937717f, 0.495732248f},
-std::array<float,2>{0.74065274f, 0.125067458f},
-std::array<float,2>{0.460744023f, 0.887383282f},
-std::array<float,2>{0.505479515f, 0.777707636f},
-std::array<float,2>{0.338184267f, 0.102613665f},
-std::array<float,2>{0.965092778f, 0.269210458f},
-std::array<float,2>{0.233128563f, 0.629888177f},
-std::array<float,2>{0.668363869f, 0.695488632f},
-std::array<float,2>{0.404501051f, 0.374376088f},
-std::array<float,2>{0.84026581f, 0.0622206591f},
-std::array<float,2>{0.104077019f, 0.861650229f},
-std::array<float,2>{0.894753158f, 0.985274732f},
-std::array<float,2>{0.178957924f, 0.208388969f},
-std::array<float,2>{0.56467998f, 0.399976164f},
-std::array<float,2>{0.268477708f, 0.61603421f},
-std::array<float,2>{0.999652982f, 0.664002836f},
-std::array<float,2>{0.212275296f, 0.283943951f},
-std::array<float,2>{0.558576703f, 0.0769342482f},
-std::array<float,2>{0.351727337f, 0.78221643f},
-std::array<float,2>{0.689792752f, 0.931772947f},
-std::array<float,2>{0.495122343f, 0.181347549f},
-std::array<float,2>{0.776299894f, 0.460947573f},
-std::array<float,2>{0.000285117043f, 0.545541525f},
-std::array<float,2>{0.623323202f, 0.59235698f},
-std::array<float,2>{0.305127472f, 0.435559005f},
-std::array<float,2>{0.922123194f, 0.231094569f},
-std::array<float,2>{0.143131956f, 0.943464577f},
-std::array<float,2>{0.8695696f, 0.819072366f},
-std::array<float,2>{0.0817946419f, 0.00483980123f},
-std::array<float,2>{0.646029115f, 0.313362151f},
-std::array<float,2>{0.406587809f, 0.720574558f},
-std::array<float,2>{0.955663681f, 0.537603438f},
-std::array<float,2>{0.220501274f, 0.459588587f},
-std::array<float,2>{0.514987707f, 0.17832464f},
-std::array<float,2>{0.328995585f, 0.923971355f},
-std::array<float,2>{0.74323833f, 0.796575963f},
-std::array<float,2>{0.467522979f, 0.0691670403f},
-std::array<float,2>{0.809184015f, 0.291769683f},
-std::array<float,2>{0.0501385629f, 0.666879654f},
-std::array<float,2>{0.576768279f, 0.732644677f},
-std::array<float,2>{0.280820966f, 0.324243844f},
-std::array<float,2>{0.898470581f, 0.0106418338f},
-std::array<float,2>{0.180627182f, 0.826238453f},
-std::array<float,2>{0.830489993f, 0.94776094f},
-std::array<float,2>{0.0962525308f, 0.218815207f},
-std::array<float,2>{0.658183813f, 0.422023565f},
-std::array<float,2>{0.391990244f, 0.584362328f},
-std::array<float,2>{0.771368086f, 0.637151897f},
-std::array<float,2>{0.0113725225f, 0.279581994f},
-std::array<float,2>{0.701622128f, 0.0994761661f},
-std::array<float,2>{0.486989975f, 0.768881142f},
-std::array<float,2>{0.554047227f, 0.881466925f},
-std::array<float,2>{0.348876446f, 0.133119717f},
-std::array<float,2>{0.989418626f, 0.487096578f},
-std::array<float,2>{0.208275571f, 0.528488338f},
-std::array<float,2>{0.655911326f, 0.624251127f},
-std::array<float,2>{0.418283463f, 0.393347681f},
-std::array<float,2>{0.864300907f, 0.215155646f},
-std::array<float,2>{0.0883150026f, 0.997025073f},
-std::array<float,2>{0.935040653f, 0.873656571f},
-std::array<float,2>{0.148771018f, 0.0502473935f},
-std::array<float,2>{0.60954386f, 0.366658479f},
-std::array<float,2>{0.299690664f, 0.691202164f},
-std::array<float,2>{0.844550669f, 0.568581164f},
-std::array<float,2>{0.0737526938f, 0.416986138f},
-std::array<float,2>{0.637049258f, 0.24844946f},
-std::array<float,2>{0.434040338f, 0.962454379f},
-std::array<float,2>{0.599659324f, 0.837106943f},
-std::array<float,2>{0.295302004f, 0.023741845f},
-std::array<float,2>{0.908985198f, 0.334902346f},
-std::array<float,2>{0.13128081f, 0.744459152f},
-std::array<float,2>{0.713953853f, 0.676467955f},
-std::array<float,2>{0.473745584f, 0.310536981f},
-std::array<float,2>{0.750025928f, 0.0921053067f},
-std::array<float,2>{0.0233838297f, 0.80785197f},
-std::array<float,2>{0.979000986f, 0.908649921f},
-std::array<float,2>{0.196776792f, 0.166571558f},
-std::array<float,2>{0.542896152f, 0.442342043f},
-std::array<float,2>{0.367995203f, 0.549535513f},
-std::array<float,2>{0.876839697f, 0.715363264f},
-std::array<float,2>{0.16761899f, 0.355480015f},
-std::array<float,2>{0.581641614f, 0.0454224534f},
-std::array<float,2>{0.261038691f, 0.859361649f},
-std::array<float,2>{0.681922853f, 0.976826251f},
-std::array<float,2>{0.375488192f, 0.193084359f},
-std::array<float,2>{0.820910454f, 0.384945571f},
-std::array<float,2>{0.113977641f, 0.603268683f},
-std::array<float,2>{0.520247459f, 0.511390209f},
-std::array<float,2>{0.327981889f, 0.480249435f},
-std::array<float,2>{0.949564517f, 0.146462753f},
-std::array<float,2>{0.248208642f, 0.895836353f},
-std::array<float,2>{0.786061645f, 0.758846998f},
-std::array<float,2>{0.0348990262f, 0.11536029f},
-std::array<float,2>{0.728589833f, 0.26232484f},
-std::array<float,2>{0.446593076f, 0.653490067f},
-std::array<float,2>{0.929725051f, 0.557033002f},
-std::array<float,2>{0.15611738f, 0.44631356f},
-std::array<float,2>{0.616389036f, 0.158758774f},
-std::array<float,2>{0.30403319f, 0.920531511f},
-std::array<float,2>{0.650821626f, 0.79902792f},
-std::array<float,2>{0.414838612f, 0.0843817443f},
-std::array<float,2>{0.861515999f, 0.298065662f},
-std::array<float,2>{0.0925052166f, 0.683111191f},
-std::array<float,2>{0.547526002f, 0.739830017f},
-std::array<float,2>{0.346127599f, 0.338483274f},
-std::array<float,2>{0.987886131f, 0.0161343776f},
-std::array<float,2>{0.204890475f, 0.835280538f},
-std::array<float,2>{0.768204749f, 0.954302132f},
-std::array<float,2>{0.0122148162f, 0.236785516f},
-std::array<float,2>{0.697403789f, 0.408891857f},
-std::array<float,2>{0.489809245f, 0.578008354f},
-std::array<float,2>{0.833295643f, 0.647504807f},
-std::array<float,2>{0.100897707f, 0.2518498f},
-std::array<float,2>{0.660336494f, 0.1174156f},
-std::array<float,2>{0.39489159f, 0.755796909f},
-std::array<float,2>{0.572084069f, 0.899862766f},
-std::array<float,2>{0.275626689f, 0.148750782f},
-std::array<float,2>{0.906048596f, 0.475039542f},
-std::array<float,2>{0.185657382f, 0.501726508f},
-std::array<float,2>{0.749850094f, 0.59786129f},
-std::array<float,2>{0.463700622f, 0.379006088f},
-std::array<float,2>{0.806426644f, 0.200014725f},
-std::array<float,2>{0.0545261428f, 0.97185123f},
-std::array<float,2>{0.959876001f, 0.845691144f},
-std::array<float,2>{0.223537147f, 0.0357933901f},
-std::array<float,2>{0.510163367f, 0.350667506f},
-std::array<float,2>{0.333928198f, 0.706746101f},
-std::array<float,2>{0.781863391f, 0.589732289f},
-std::array<float,2>{0.0355056599f, 0.432079643f},
-std::array<float,2>{0.732892752f, 0.228072196f},
-std::array<float,2>{0.451580197f, 0.938079417f},
-std::array<float,2>{0.517990828f, 0.816017509f},
-std::array<float,2>{0.322574496f, 0.00221215351f},
-std::array<float,2>{0.945830941f, 0.316698283f},
-std::array<float,2>{0.245085359f, 0.723343492f},
-std::array<float,2>{0.684017181f, 0.659254253f},
-std::array<float,2>{0.382274896f, 0.28691873f},
-std::array<float,2>{0.826859593f, 0.0703837648f},
-std::array<float,2>{0.11188066f, 0.785528898f},
-std::array<float,2>{0.880576253f, 0.936340153f},
-std::array<float,2>{0.17150338f, 0.186536402f},
-std::array<float,2>{0.583672762f, 0.468104243f},
-std::array<float,2>{0.26291737f, 0.542784393f},
-std::array<float,2>{0.984144032f, 0.701856911f},
-std::array<float,2>{0.200373113f, 0.370745569f},
-std::array<float,2>{0.544091702f, 0.0585277863f},
-std::array<float,2>{0.371546596f, 0.866472661f},
-std::array<float,2>{0.718053102f, 0.991927087f},
-std::array<float,2>{0.470464438f, 0.204981402f},
-std::array<float,2>{0.756285012f, 0.406074971f},
-std::array<float,2>{0.0175827909f, 0.611457288f},
-std::array<float,2>{0.596191049f, 0.518646955f},
-std::array<float,2>{0.290800035f, 0.497737229f},
-std::array<float,2>{0.910706043f, 0.129645869f},
-std::array<float,2>{0.126069799f, 0.883176684f},
-std::array<float,2>{0.850290716f, 0.774319589f},
-std::array<float,2>{0.0748894364f, 0.106428832f},
-std::array<float,2>{0.633931637f, 0.27204743f},
-std::array<float,2>{0.432046771f, 0.627596259f},
-std::array<float,2>{0.942458034f, 0.619951487f},
-std::array<float,2>{0.238431096f, 0.397437751f},
-std::array<float,2>{0.530124605f, 0.21368815f},
-std::array<float,2>{0.317034274f, 0.995307565f},
-std::array<float,2>{0.722421229f, 0.87070787f},
-std::array<float,2>{0.443583548f, 0.053616412f},
-std::array<float,2>{0.790295839f, 0.360450625f},
-std::array<float,2>{0.0443346575f, 0.694469929f},
-std::array<float,2>{0.587878287f, 0.633054972f},
-std::array<float,2>{0.25341624f, 0.274093688f},
-std::array<float,2>{0.883076668f, 0.0966800824f},
-std::array<float,2>{0.162083402f, 0.771028221f},
-std::array<float,2>{0.816102922f, 0.877191961f},
-std::array<float,2>{0.122567974f, 0.140013784f},
-std::array<float,2>{0.676690876f, 0.490395814f},
-std::array<float,2>{0.386598587f, 0.526211143f},
-std::array<float,2>{0.760225177f, 0.729096889f},
-std::array<float,2>{0.0275275819f, 0.32069248f},
-std::array<float,2>{0.708633423f, 0.0122787543f},
-std::array<float,2>{0.477812111f, 0.823376775f},
-std::array<float,2>{0.53843677f, 0.951048851f},
-std::array<float,2>{0.360417396f, 0.223969996f},
-std::array<float,2>{0.972146809f, 0.427235276f},
-std::array<float,2>{0.188740715f, 0.580977321f},
-std::array<float,2>{0.626053154f, 0.535052001f},
-std::array<float,2>{0.425204694f, 0.454327732f},
-std::array<float,2>{0.856267333f, 0.173551112f},
-std::array<float,2>{0.0630990267f, 0.926873565f},
-std::array<float,2>{0.918324292f, 0.789828598f},
-std::array<float,2>{0.138336822f, 0.0653091595f},
-std::array<float,2>{0.606756508f, 0.295214087f},
-std::array<float,2>{0.282654196f, 0.668360114f},
-std::array<float,2>{0.874397337f, 0.513361216f},
-std::array<float,2>{0.0828847587f, 0.480864465f},
-std::array<float,2>{0.642351985f, 0.141403705f},
-std::array<float,2>{0.411132127f, 0.893998265f},
-std::array<float,2>{0.618243992f, 0.7637133f},
-std::array<float,2>{0.311000466f, 0.110930219f},
-std::array<float,2>{0.927656829f, 0.260719061f},
-std::array<float,2>{0.148312613f, 0.649104655f},
-std::array<float,2>{0.69407475f, 0.712458909f},
-std::array<float,2>{0.49769339f, 0.354161233f},
-std::array<float,2>{0.781093061f, 0.03978239f},
-std::array<float,2>{0.00443704054f, 0.85463202f},
-std::array<float,2>{0.994625747f, 0.983833849f},
-std::array<float,2>{0.217843577f, 0.187615022f},
-std::array<float,2>{0.558784902f, 0.387039602f},
-std::array<float,2>{0.357144386f, 0.608664036f},
-std::array<float,2>{0.891505122f, 0.672123551f},
-std::array<float,2>{0.173739344f, 0.305728644f},
-std::array<float,2>{0.56727761f, 0.0883365348f},
-std::array<float,2>{0.272825986f, 0.812029541f},
-std::array<float,2>{0.66580689f, 0.913009346f},
-std::array<float,2>{0.400769234f, 0.170943826f},
-std::array<float,2>{0.838824987f, 0.439950824f},
-std::array<float,2>{0.108500078f, 0.553744316f},
-std::array<float,2>{0.503265917f, 0.566223979f},
-std::array<float,2>{0.341922253f, 0.420123577f},
-std::array<float,2>{0.963014543f, 0.243819013f},
-std::array<float,2>{0.227390856f, 0.968271494f},
-std::array<float,2>{0.799640119f, 0.840377212f},
-std::array<float,2>{0.0556667522f, 0.0279279891f},
-std::array<float,2>{0.734909356f, 0.3306683f},
-std::array<float,2>{0.455412954f, 0.747455955f},
-std::array<float,2>{0.888673365f, 0.573053539f},
-std::array<float,2>{0.159274101f, 0.412097186f},
-std::array<float,2>{0.591738522f, 0.241577581f},
-std::array<float,2>{0.256227195f, 0.958532989f},
-std::array<float,2>{0.67222029f, 0.830709755f},
-std::array<float,2>{0.390296817f, 0.0230665207f},
-std::array<float,2>{0.81706804f, 0.339868605f},
-std::array<float,2>{0.119421028f, 0.735566974f},
-std::array<float,2>{0.526411533f, 0.685277343f},
-std::array<float,2>{0.315813124f, 0.303598911f},
-std::array<float,2>{0.939329565f, 0.0799463019f},
-std::array<float,2>{0.236199111f, 0.804605782f},
-std::array<float,2>{0.794235528f, 0.916819215f},
-std::array<float,2>{0.0402245969f, 0.161646426f},
-std::array<float,2>{0.724699497f, 0.451007187f},
-std::array<float,2>{0.438989669f, 0.560651839f},
-std::array<float,2>{0.853773952f, 0.710666955f},
-std::array<float,2>{0.0693957955f, 0.345522732f},
-std::array<float,2>{0.631856561f, 0.0319408737f},
-std::array<float,2>{0.426728606f, 0.850446522f},
-std::array<float,2>{0.601808608f, 0.975853264f},
-std::array<float,2>{0.286692113f, 0.198332027f},
-std::array<float,2>{0.915887296f, 0.378489524f},
-std::array<float,2>{0.135717437f, 0.596399426f},
-std::array<float,2>{0.706290841f, 0.507274449f},
-std::array<float,2>{0.481614739f, 0.471257091f},
-std::array<float,2>{0.764264762f, 0.154269889f},
-std::array<float,2>{0.0243585389f, 0.903659105f},
-std::array<float,2>{0.973518252f, 0.750427902f},
-std::array<float,2>{0.193241522f, 0.124453209f},
-std::array<float,2>{0.5331949f, 0.255993485f},
-std::array<float,2>{0.365505755f, 0.640677035f},
-std::array<float,2>{0.775118291f, 0.543836772f},
-std::array<float,2>{0.00301236636f, 0.46411705f},
-std::array<float,2>{0.689376533f, 0.183215499f},
-std::array<float,2>{0.492482126f, 0.930902064f},
-std::array<float,2>{0.554812431f, 0.784778416f},
-std::array<float,2>{0.354796022f, 0.0743531659f},
-std::array<float,2>{0.997077405f, 0.28144598f},
-std::array<float,2>{0.213359758f, 0.66049695f},
-std::array<float,2>{0.646658242f, 0.722623229f},
-std::array<float,2>{0.408341259f, 0.315509737f},
-std::array<float,2>{0.867903054f, 0.00586726656f},
-std::array<float,2>{0.0788701326f, 0.817156792f},
-std::array<float,2>{0.92456001f, 0.942253172f},
-std::array<float,2>{0.141107038f, 0.23362042f},
-std::array<float,2>{0.622076929f, 0.435527891f},
-std::array<float,2>{0.30739978f, 0.590222478f},
-std::array<float,2>{0.967528701f, 0.632294118f},
-std::array<float,2>{0.230896071f, 0.265838534f},
-std::array<float,2>{0.507514298f, 0.105305836f},
-std::array<float,2>{0.337686986f, 0.779607713f},
-std::array<float,2>{0.739207387f, 0.889889359f},
-std::array<float,2>{0.458458126f, 0.127322882f},
-std::array<float,2>{0.801395833f, 0.492709637f},
-std::array<float,2>{0.0599443987f, 0.519822001f},
-std::array<float,2>{0.563219011f, 0.614784658f},
-std::array<float,2>{0.267185837f, 0.401329041f},
-std::array<float,2>{0.897501469f, 0.209916368f},
-std::array<float,2>{0.17594479f, 0.986573875f},
-std::array<float,2>{0.841945112f, 0.860324144f},
-std::array<float,2>{0.101849765f, 0.0591634624f},
-std::array<float,2>{0.67084676f, 0.372421622f},
-std::array<float,2>{0.403348804f, 0.698548853f},
-std::array<float,2>{0.991119146f, 0.531028748f},
-std::array<float,2>{0.209791273f, 0.48444587f},
-std::array<float,2>{0.552044511f, 0.135872319f},
-std::array<float,2>{0.35033381f, 0.878996491f},
-std::array<float,2>{0.699412584f, 0.765981019f},
-std::array<float,2>{0.48548454f, 0.0997193307f},
-std::array<float,2>{0.772454619f, 0.278294355f},
-std::array<float,2>{0.00833341572f, 0.638961017f},
-std::array<float,2>{0.612827361f, 0.688667119f},
-std::array<float,2>{0.297631413f, 0.365199298f},
-std::array<float,2>{0.937210321f, 0.0481588468f},
-std::array<float,2>{0.150747031f, 0.872584164f},
-std::array<float,2>{0.865548372f, 0.998436332f},
-std::array<float,2>{0.0865630507f, 0.217978597f},
-std::array<float,2>{0.653468668f, 0.390939653f},
-std::array<float,2>{0.421813309f, 0.621964693f},
-std::array<float,2>{0.812409043f, 0.665924489f},
-std::array<float,2>{0.0478258692f, 0.290883571f},
-std::array<float,2>{0.745389938f, 0.0669168681f},
-std::array<float,2>{0.465488791f, 0.793907046f},
-std::array<float,2>{0.512911201f, 0.922444403f},
-std::array<float,2>{0.330892354f, 0.176889643f},
-std::array<float,2>{0.954290867f, 0.457389653f},
-std::array<float,2>{0.221476749f, 0.536201f},
-std::array<float,2>{0.658606172f, 0.583007634f},
-std::array<float,2>{0.393993795f, 0.425106019f},
-std::array<float,2>{0.830048323f, 0.221716613f},
-std::array<float,2>{0.095189698f, 0.94590652f},
-std::array<float,2>{0.900648236f, 0.825383544f},
-std::array<float,2>{0.182879865f, 0.00926602632f},
-std::array<float,2>{0.576006889f, 0.326220781f},
-std::array<float,2>{0.279174387f, 0.731899142f},
-std::array<float,2>{0.823773801f, 0.60463804f},
-std::array<float,2>{0.116121553f, 0.384144366f},
-std::array<float,2>{0.680411637f, 0.19357951f},
-std::array<float,2>{0.377124548f, 0.979358852f},
-std::array<float,2>{0.57916522f, 0.856834769f},
-std::array<float,2>{0.259250253f, 0.044421088f},
-std::array<float,2>{0.878230095f, 0.358358622f},
-std::array<float,2>{0.165952355f, 0.717480898f},
-std::array<float,2>{0.72835809f, 0.654802442f},
-std::array<float,2>{0.447703749f, 0.264256209f},
-std::array<float,2>{0.787566841f, 0.113324292f},
-std::array<float,2>{0.0329218805f, 0.760501981f},
-std::array<float,2>{0.952630401f, 0.897767842f},
-std::array<float,2>{0.246734083f, 0.147696033f},
-std::array<float,2>{0.521896362f, 0.47802341f},
-std::array<float,2>{0.324571162f, 0.508390784f},
-std::array<float,2>{0.906734705f, 0.743230581f},
-std::array<float,2>{0.129842982f, 0.333832949f},
-std::array<float,2>{0.598775923f, 0.0272832513f},
-std::array<float,2>{0.294630885f, 0.838441968f},
-std::array<float,2>{0.639224052f, 0.964357197f},
-std::array<float,2>{0.43607527f, 0.247773156f},
-std::array<float,2>{0.846626163f, 0.415064216f},
-std::array<float,2>{0.0721300617f, 0.566655099f},
-std::array<float,2>{0.539177239f, 0.548240006f},
-std::array<float,2>{0.369353205f, 0.445101202f},
-std::array<float,2>{0.977506757f, 0.165094152f},
-std::array<float,2>{0.198424414f, 0.90713799f},
-std::array<float,2>{0.75311619f, 0.80520767f},
-std::array<float,2>{0.0201016534f, 0.0916805193f},
-std::array<float,2>{0.712552905f, 0.311091185f},
-std::array<float,2>{0.475918055f, 0.677886605f},
-std::array<float,2>{0.893972814f, 0.554354846f},
-std::array<float,2>{0.175741643f, 0.439893156f},
-std::array<float,2>{0.569541693f, 0.171769187f},
-std::array<float,2>{0.270294964f, 0.912377238f},
-std::array<float,2>{0.666811109f, 0.811631799f},
-std::array<float,2>{0.398629397f, 0.0885719955f},
-std::array<float,2>{0.836949885f, 0.306411922f},
-std::array<float,2>{0.106225006f, 0.672379255f},
-std::array<float,2>{0.501375377f, 0.747753799f},
-std::array<float,2>{0.341718286f, 0.330373406f},
-std::array<float,2>{0.961396456f, 0.027704563f},
-std::array<float,2>{0.229553133f, 0.840311468f},
-std::array<float,2>{0.79859978f, 0.967898309f},
-std::array<float,2>{0.0573100783f, 0.243404999f},
-std::array<float,2>{0.73708719f, 0.420714915f},
-std::array<float,2>{0.45483318f, 0.565542042f},
-std::array<float,2>{0.871955395f, 0.648569524f},
-std::array<float,2>{0.0842162818f, 0.259996355f},
-std::array<float,2>{0.644507289f, 0.110389739f},
-std::array<float,2>{0.412600338f, 0.76442337f},
-std::array<float,2>{0.619144797f, 0.894050956f},
-std::array<float,2>{0.31001839f, 0.141091049f},
-std::array<float,2>{0.929314911f, 0.48104772f},
-std::array<float,2>{0.145304158f, 0.512726724f},
-std::array<float,2>{0.691995919f, 0.609322488f},
-std::array<float,2>{0.499131054f, 0.387213111f},
-std::array<float,2>{0.779102683f, 0.188213557f},
-std::array<float,2>{0.00756767625f, 0.9839499f},
-std::array<float,2>{0.993252456f, 0.855457962f},
-std::array<float,2>{0.215010792f, 0.0391383097f},
-std::array<float,2>{0.560595036f, 0.353751957f},
-std::array<float,2>{0.358506829f, 0.711927295f},
-std::array<float,2>{0.758006155f, 0.580143809f},
-std::array<float,2>{0.0296636634f, 0.427482188f},
-std::array<float,2>{0.710719526f, 0.224206492f},
-std::array<float,2>{0.479753494f, 0.950586319f},
-std::array<float,2>{0.536652744f, 0.823870897f},
-std::array<float,2>{0.362727731f, 0.0121800732f},
-std::array<float,2>{0.969886482f, 0.32118848f},
-std::array<float,2>{0.191401571f, 0.728986561f},
-std::array<float,2>{0.628607094f, 0.668474257f},
-std::array<float,2>{0.422509879f, 0.29588896f},
-std::array<float,2>{0.859030485f, 0.0648087338f},
-std::array<float,2>{0.0648899153f, 0.789096296f},
-std::array<float,2>{0.921720505f, 0.927450299f},
-std::array<float,2>{0.140042484f, 0.173087046f},
-std::array<float,2>{0.608552814f, 0.454849005f},
-std::array<float,2>{0.284989029f, 0.53462857f},
-std::array<float,2>{0.943520129f, 0.695011258f},
-std::array<float,2>{0.242172346f, 0.361106008f},
-std::array<float,2>{0.528759301f, 0.053087268f},
-std::array<float,2>{0.319943517f, 0.870212555f},
-std::array<float,2>{0.72027272f, 0.996069372f},
-std::array<float,2>{0.442804605f, 0.213148087f},
-std::array<float,2>{0.791390002f, 0.396813214f},
-std::array<float,2>{0.0453595631f, 0.61961627f},
-std::array<float,2>{0.589109123f, 0.525479853f},
-std::array<float,2>{0.251200706f, 0.491138488f},
-std::array<float,2>{0.885720193f, 0.140258148f},
-std::array<float,2>{0.163702309f, 0.877681196f},
-std::array<float,2>{0.812662363f, 0.7708444f},
-std::array<float,2>{0.124720991f, 0.0975318775f},
-std::array<float,2>{0.679319024f, 0.273624301f},
-std::array<float,2>{0.38294664f, 0.633468211f},
-std::array<float,2>{0.981162965f, 0.611905277f},
-std::array<float,2>{0.202398002f, 0.405429512f},
-std::array<float,2>{0.545077324f, 0.204160213f},
-std::array<float,2>{0.374582052f, 0.991236091f},
-std::array<float,2>{0.716150939f, 0.866769969f},
-std::array<float,2>{0.472401589f, 0.0578428917f},
-std::array<float,2>{0.755311012f, 0.370236427f},
-std::array<float,2>{0.0174264703f, 0.701470494f},
-std::array<float,2>{0.595686495f, 0.627429366f},
-std::array<float,2>{0.292188883f, 0.271892726f},
-std::array<float,2>{0.91356498f, 0.105845831f},
-std::array<float,2>{0.128059134f, 0.773790538f},
-std::array<float,2>{0.849211991f, 0.883377016f},
-std::array<float,2>{0.0777912661f, 0.128957689f},
-std::array<float,2>{0.634929657f, 0.497400135f},
-std::array<float,2>{0.430057138f, 0.519278526f},
-std::array<float,2>{0.783482015f, 0.722860813f},
-std::array<float,2>{0.0373057425f, 0.317171693f},
-std::array<float,2>{0.730679631f, 0.00261766813f},
-std::array<float,2>{0.450926781f, 0.815826893f},
-std::array<float,2>{0.517525792f, 0.937861145f},
-std::array<float,2>{0.321228534f, 0.227661878f},
-std::array<float,2>{0.948434055f, 0.432509184f},
-std::array<float,2>{0.242544323f, 0.589059651f},
-std::array<float,2>{0.686028361f, 0.542395115f},
-std::array<float,2>{0.380243331f, 0.468711495f},
-std::array<float,2>{0.824833751f, 0.187497318f},
-std::array<float,2>{0.110063314f, 0.935882032f},
-std::array<float,2>{0.882018149f, 0.786127269f},
-std::array<float,2>{0.168187603f, 0.0711596981f},
-std::array<float,2>{0.585629165f, 0.286167145f},
-std::array<float,2>{0.265568465f, 0.660152793f},
-std::array<float,2>{0.83420372f, 0.501295626f},
-std::array<float,2>{0.099438943f, 0.475451618f},
-std::array<float,2>{0.663660407f, 0.149388924f},
-std::array<float,2>{0.396865904f, 0.899944723f},
-std::array<float,2>{0.572484195f, 0.755176425f},
-std::array<float,2>{0.273750007f, 0.117918089f},
-std::array<float,2>{0.902561843f, 0.25146383f},
-std::array<float,2>{0.185413957f, 0.648282766f},
-std::array<float,2>{0.746725917f, 0.706399143f},
-std::array<float,2>{0.462302208f, 0.351548254f},
-std::array<float,2>{0.806730568f, 0.0355036668f},
-std::array<float,2>{0.0515436418f, 0.845058203f},
-std::array<float,2>{0.958794832f, 0.972625315f},
-std::array<float,2>{0.225232705f, 0.199494645f},
-std::array<float,2>{0.508514643f, 0.379399449f},
-std::array<float,2>{0.334824294f, 0.59819442f},
-std::array<float,2>{0.931732893f, 0.682743609f},
-std::array<float,2>{0.152854308f, 0.298542023f},
-std::array<float,2>{0.615152836f, 0.0846421719f},
-std::array<float,2>{0.301673114f, 0.799663842f},
-std::array<float,2>{0.649795234f, 0.920204282f},
-std::array<float,2>{0.416328222f, 0.158233538f},
-std::array<float,2>{0.859761953f, 0.447053999f},
-std::array<float,2>{0.0910543725f, 0.557201624f},
-std::array<float,2>{0.549597919f, 0.577512801f},
-std::array<float,2>{0.344070852f, 0.408495933f},
-std::array<float,2>{0.985378981f, 0.237195149f},
-std::array<float,2>{0.205152333f, 0.954631329f},
-std::array<float,2>{0.765834808f, 0.835817456f},
-std::array<float,2>{0.014624224f, 0.0157050397f},
-std::array<float,2>{0.696958303f, 0.338306934f},
-std::array<float,2>{0.491952837f, 0.739371359f},
-std::array<float,2>{0.908576131f, 0.567092538f},
-std::array<float,2>{0.13146539f, 0.415589333f},
-std::array<float,2>{0.600209236f, 0.247301027f},
-std::array<float,2>{0.295657605f, 0.96428895f},
-std::array<float,2>{0.637417197f, 0.838179827f},
-std::array<float,2>{0.434384167f, 0.0264280662f},
-std::array<float,2>{0.84392333f, 0.333305925f},
-std::array<float,2>{0.0737229064f, 0.743914366f},
-std::array<float,2>{0.542325854f, 0.678660631f},
-std::array<float,2>{0.367467344f, 0.310703069f},
-std::array<float,2>{0.97902751f, 0.0908460543f},
-std::array<float,2>{0.197048306f, 0.804819405f},
-std::array<float,2>{0.750737607f, 0.906370461f},
-std::array<float,2>{0.0226609334f, 0.165593967f},
-std::array<float,2>{0.714538157f, 0.444593132f},
-std::array<float,2>{0.474340618f, 0.548629999f},
-std::array<float,2>{0.820547283f, 0.717105031f},
-std::array<float,2>{0.113501199f, 0.357432336f},
-std::array<float,2>{0.682378709f, 0.0444466844f},
-std::array<float,2>{0.375680238f, 0.857167542f},
-std::array<float,2>{0.581417143f, 0.978952765f},
-std::array<float,2>{0.261337608f, 0.193885788f},
-std::array<float,2>{0.876075566f, 0.384531558f},
-std::array<float,2>{0.167215854f, 0.605065882f},
-std::array<float,2>{0.729295611f, 0.508228004f},
-std::array<float,2>{0.446905971f, 0.478343248f},
-std::array<float,2>{0.785603166f, 0.148225561f},
-std::array<float,2>{0.0342622958f, 0.898322046f},
-std::array<float,2>{0.950119674f, 0.760094106f},
-std::array<float,2>{0.248539239f, 0.113886319f},
-std::array<float,2>{0.51986897f, 0.263973325f},
-std::array<float,2>{0.327218235f, 0.654708147f},
-std::array<float,2>{0.808827341f, 0.537037075f},
-std::array<float,2>{0.0507432558f, 0.457675785f},
-std::array<float,2>{0.743872941f, 0.177373856f},
-std::array<float,2>{0.467191517f, 0.922024071f},
-std::array<float,2>{0.515337348f, 0.793314278f},
-std::array<float,2>{0.328522593f, 0.0666584149f},
-std::array<float,2>{0.955399394f, 0.290211111f},
-std::array<float,2>{0.219738156f, 0.665252388f},
-std::array<float,2>{0.657407224f, 0.732277751f},
-std::array<float,2>{0.392389208f, 0.327142775f},
-std::array<float,2>{0.830985844f, 0.00958520453f},
-std::array<float,2>{0.0961257741f, 0.825966179f},
-std::array<float,2>{0.899169922f, 0.945354104f},
-std::array<float,2>{0.18015115f, 0.222518086f},
-std::array<float,2>{0.576227665f, 0.425350606f},
-std::array<float,2>{0.280401409f, 0.58203721f},
-std::array<float,2>{0.990207136f, 0.639504015f},
-std::array<float,2>{0.208577618f, 0.27751103f},
-std::array<float,2>{0.554563165f, 0.100101121f},
-std::array<float,2>{0.349413365f, 0.766161919f},
-std::array<float,2>{0.701684833f, 0.879452348f},
-std::array<float,2>{0.486470073f, 0.136565357f},
-std::array<float,2>{0.770808995f, 0.485100895f},
-std::array<float,2>{0.011174988f, 0.5303635f},
-std::array<float,2>{0.609955251f, 0.621142805f},
-std::array<float,2>{0.299088001f, 0.391257018f},
-std::array<float,2>{0.935483575f, 0.218426958f},
-std::array<float,2>{0.148967579f, 0.99898535f},
-std::array<float,2>{0.86482054f, 0.872151554f},
-std::array<float,2>{0.0885924026f, 0.0485230945f},
-std::array<float,2>{0.655732334f, 0.364332259f},
-std::array<float,2>{0.418477476f, 0.68929857f},
-std::array<float,2>{0.965494454f, 0.520336747f},
-std::array<float,2>{0.232513979f, 0.492479712f},
-std::array<float,2>{0.50501442f, 0.127658501f},
-std::array<float,2>{0.338589042f, 0.890197694f},
-std::array<float,2>{0.740824342f, 0.779803455f},
-std::array<float,2>{0.460125029f, 0.104778565f},
-std::array<float,2>{0.803636253f, 0.266284883f},
-std::array<float,2>{0.0617770515f, 0.632790864f},
-std::array<float,2>{0.564949393f, 0.698845327f},
-std::array<float,2>{0.267878652f, 0.372745454f},
-std::array<float,2>{0.895271957f, 0.0588842258f},
-std::array<float,2>{0.17956683f, 0.859412968f},
-std::array<float,2>{0.840664685f, 0.986859739f},
-std::array<float,2>{0.103665233f, 0.209031194f},
-std::array<float,2>{0.668932855f, 0.400648534f},
-std::array<float,2>{0.404876083f, 0.614616811f},
-std::array<float,2>{0.775714219f, 0.66084969f},
-std::array<float,2>{0.000929570349f, 0.281841576f},
-std::array<float,2>{0.690312743f, 0.0747600645f},
-std::array<float,2>{0.495856911f, 0.784535706f},
-std::array<float,2>{0.557986975f, 0.93154192f},
-std::array<float,2>{0.352315128f, 0.18273741f},
-std::array<float,2>{0.999267817f, 0.464411795f},
-std::array<float,2>{0.212612689f, 0.543442428f},
-std::array<float,2>{0.645527124f, 0.590739787f},
-std::array<float,2>{0.4070099f, 0.435006082f},
-std::array<float,2>{0.870070577f, 0.233954519f},
-std::array<float,2>{0.0812333748f, 0.941813827f},
-std::array<float,2>{0.922607243f, 0.816621125f},
-std::array<float,2>{0.142651126f, 0.00675385213f},
-std::array<float,2>{0.623671651f, 0.315954924f},
-std::array<float,2>{0.305195719f, 0.722163439f},
-std::array<float,2>{0.852693141f, 0.595748305f},
-std::array<float,2>{0.0679391325f, 0.378237605f},
-std::array<float,2>{0.630153239f, 0.198990405f},
-std::array<float,2>{0.428679883f, 0.976242602f},
-std::array<float,2>{0.604264975f, 0.850018144f},
-std::array<float,2>{0.287465215f, 0.031373661f},
-std::array<float,2>{0.917920351f, 0.344874024f},
-std::array<float,2>{0.132986739f, 0.710003912f},
-std::array<float,2>{0.70396024f, 0.641165733f},
-std::array<float,2>{0.483836293f, 0.256557554f},
-std::array<float,2>{0.762213171f, 0.124639265f},
-std::array<float,2>{0.0271521974f, 0.750566542f},
-std::array<float,2>{0.974747956f, 0.904035807f},
-std::array<float,2>{0.195271358f, 0.153466687f},
-std::array<float,2>{0.533316493f, 0.470911384f},
-std::array<float,2>{0.365097702f, 0.507385492f},
-std::array<float,2>{0.888081849f, 0.736039102f},
-std::array<float,2>{0.157003254f, 0.340441555f},
-std::array<float,2>{0.593448162f, 0.0229065958f},
-std::array<float,2>{0.254611671f, 0.830223739f},
-std::array<float,2>{0.675380528f, 0.958201408f},
-std::array<float,2>{0.387978733f, 0.242031291f},
-std::array<float,2>{0.819199085f, 0.411291063f},
-std::array<float,2>{0.119117647f, 0.57231003f},
-std::array<float,2>{0.525148571f, 0.561044812f},
-std::array<float,2>{0.314154238f, 0.450666428f},
-std::array<float,2>{0.939958215f, 0.161400989f},
-std::array<float,2>{0.237243041f, 0.916423798f},
-std::array<float,2>{0.795778751f, 0.803954661f},
-std::array<float,2>{0.0414443016f, 0.0794243291f},
-std::array<float,2>{0.722761214f, 0.302997738f},
-std::array<float,2>{0.439544976f, 0.684801817f},
-std::array<float,2>{0.926808059f, 0.514575362f},
-std::array<float,2>{0.147564575f, 0.482720852f},
-std::array<float,2>{0.618762672f, 0.144106224f},
-std::array<float,2>{0.311469764f, 0.891904652f},
-std::array<float,2>{0.641732216f, 0.762175858f},
-std::array<float,2>{0.410183758f, 0.111875944f},
-std::array<float,2>{0.874521792f, 0.259115964f},
-std::array<float,2>{0.0825188607f, 0.650521755f},
-std::array<float,2>{0.559180081f, 0.713501751f},
-std::array<float,2>{0.356661588f, 0.351600856f},
-std::array<float,2>{0.994731009f, 0.0410471112f},
-std::array<float,2>{0.218440697f, 0.851994634f},
-std::array<float,2>{0.780673623f, 0.981420517f},
-std::array<float,2>{0.00421311939f, 0.191102356f},
-std::array<float,2>{0.693734884f, 0.389759958f},
-std::array<float,2>{0.497473091f, 0.605507076f},
-std::array<float,2>{0.838333488f, 0.67399323f},
-std::array<float,2>{0.109179795f, 0.306698263f},
-std::array<float,2>{0.665207684f, 0.086076878f},
-std::array<float,2>{0.401338458f, 0.809226036f},
-std::array<float,2>{0.566661596f, 0.910787165f},
-std::array<float,2>{0.273248523f, 0.16864565f},
-std::array<float,2>{0.890867174f, 0.438263506f},
-std::array<float,2>{0.173045784f, 0.551633358f},
-std::array<float,2>{0.734740496f, 0.562640607f},
-std::array<float,2>{0.455654591f, 0.418738782f},
-std::array<float,2>{0.799230933f, 0.245754108f},
-std::array<float,2>{0.0563785657f, 0.964947343f},
-std::array<float,2>{0.963507056f, 0.842271447f},
-std::array<float,2>{0.226624638f, 0.0305199828f},
-std::array<float,2>{0.503511369f, 0.328438997f},
-std::array<float,2>{0.342691571f, 0.749673903f},
-std::array<float,2>{0.790883958f, 0.618534684f},
-std::array<float,2>{0.0445773043f, 0.395749152f},
-std::array<float,2>{0.721882701f, 0.211353868f},
-std::array<float,2>{0.444255143f, 0.993211448f},
-std::array<float,2>{0.529514432f, 0.867534876f},
-std::array<float,2>{0.316443563f, 0.0514732823f},
-std::array<float,2>{0.943231046f, 0.363219082f},
-std::array<float,2>{0.239051998f, 0.691996455f},
-std::array<float,2>{0.676176071f, 0.636530817f},
-std::array<float,2>{0.385769159f, 0.275889039f},
-std::array<float,2>{0.815882325f, 0.0949202478f},
-std::array<float,2>{0.122345261f, 0.773222387f},
-std::array<float,2>{0.883526802f, 0.876327097f},
-std::array<float,2>{0.161427021f, 0.137944639f},
-std::array<float,2>{0.587272048f, 0.489818722f},
-std::array<float,2>{0.253481746f, 0.525207102f},
-std::array<float,2>{0.972623765f, 0.726807237f},
-std::array<float,2>{0.189108104f, 0.322619408f},
-std::array<float,2>{0.538612664f, 0.0142618278f},
-std::array<float,2>{0.36124441f, 0.820792735f},
-std::array<float,2>{0.70839107f, 0.95205164f},
-std::array<float,2>{0.478170365f, 0.224963948f},
-std::array<float,2>{0.760698855f, 0.429158092f},
-std::array<float,2>{0.0282878764f, 0.578592122f},
-std::array<float,2>{0.607072949f, 0.531538367f},
-std::array<float,2>{0.283036202f, 0.456258416f},
-std::array<float,2>{0.918872654f, 0.174463525f},
-std::array<float,2>{0.138127491f, 0.928895175f},
-std::array<float,2>{0.855799735f, 0.791222692f},
-std::array<float,2>{0.0626678988f, 0.0644396245f},
-std::array<float,2>{0.626602829f, 0.293711543f},
-std::array<float,2>{0.425382167f, 0.670688987f},
-std::array<float,2>{0.945487618f, 0.587696373f},
-std::array<float,2>{0.244370982f, 0.42997092f},
-std::array<float,2>{0.518302917f, 0.229006663f},
-std::array<float,2>{0.322981745f, 0.940806508f},
-std::array<float,2>{0.732986987f, 0.812610745f},
-std::array<float,2>{0.451707155f, 0.00113039068f},
-std::array<float,2>{0.781614065f, 0.31991449f},
-std::array<float,2>{0.0359055549f, 0.726318598f},
-std::array<float,2>{0.583310783f, 0.65678978f},
-std::array<float,2>{0.26325956f, 0.287725806f},
-std::array<float,2>{0.880230844f, 0.0732069761f},
-std::array<float,2>{0.170905158f, 0.789060652f},
-std::array<float,2>{0.826608181f, 0.933935344f},
-std::array<float,2>{0.111607015f, 0.1837565f},
-std::array<float,2>{0.684426486f, 0.466795653f},
-std::array<float,2>{0.382381558f, 0.539583385f},
-std::array<float,2>{0.756811798f, 0.69940865f},
-std::array<float,2>{0.0183402374f, 0.368320018f},
-std::array<float,2>{0.718331039f, 0.0551019646f},
-std::array<float,2>{0.469993562f, 0.865219057f},
-std::array<float,2>{0.544598699f, 0.988844693f},
-std::array<float,2>{0.371655136f, 0.206715494f},
-std::array<float,2>{0.983509421f, 0.403288037f},
-std::array<float,2>{0.200813711f, 0.609422028f},
-std::array<float,2>{0.634663641f, 0.516750216f},
-std::array<float,2>{0.432311267f, 0.4983567f},
-std::array<float,2>{0.849767506f, 0.132390901f},
-std::array<float,2>{0.074471198f, 0.886009574f},
-std::array<float,2>{0.910255432f, 0.777158201f},
-std::array<float,2>{0.126496166f, 0.108733386f},
-std::array<float,2>{0.596301138f, 0.270565718f},
-std::array<float,2>{0.290315717f, 0.625847161f},
-std::array<float,2>{0.861861467f, 0.556491196f},
-std::array<float,2>{0.0921552181f, 0.448453665f},
-std::array<float,2>{0.650889575f, 0.15804182f},
-std::array<float,2>{0.414099842f, 0.919063509f},
-std::array<float,2>{0.616915286f, 0.797109962f},
-std::array<float,2>{0.304484665f, 0.0828125104f},
-std::array<float,2>{0.930652142f, 0.299037725f},
-std::array<float,2>{0.155287504f, 0.679808795f},
-std::array<float,2>{0.698204875f, 0.741701305f},
-std::array<float,2>{0.489484042f, 0.337047219f},
-std::array<float,2>{0.767988086f, 0.0189503282f},
-std::array<float,2>{0.0119673545f, 0.833724499f},
-std::array<float,2>{0.987566352f, 0.956349373f},
-std::array<float,2>{0.204259783f, 0.235432833f},
-std::array<float,2>{0.547136188f, 0.407924831f},
-std::array<float,2>{0.346517086f, 0.575117707f},
-std::array<float,2>{0.90543896f, 0.64507097f},
-std::array<float,2>{0.18613939f, 0.25336802f},
-std::array<float,2>{0.571403146f, 0.119154587f},
-std::array<float,2>{0.276349097f, 0.75663799f},
-std::array<float,2>{0.660932779f, 0.901632011f},
-std::array<float,2>{0.395426095f, 0.151526034f},
-std::array<float,2>{0.833609641f, 0.47397837f},
-std::array<float,2>{0.101166785f, 0.503003597f},
-std::array<float,2>{0.51070112f, 0.60060823f},
-std::array<float,2>{0.333233386f, 0.381507933f},
-std::array<float,2>{0.959208071f, 0.202183172f},
-std::array<float,2>{0.222921953f, 0.969921887f},
-std::array<float,2>{0.805992067f, 0.846157789f},
-std::array<float,2>{0.053750474f, 0.0384410508f},
-std::array<float,2>{0.749343872f, 0.348374873f},
-std::array<float,2>{0.463131905f, 0.704615772f},
-std::array<float,2>{0.878876328f, 0.602689981f},
-std::array<float,2>{0.165505186f, 0.385729849f},
-std::array<float,2>{0.579781711f, 0.192778245f},
-std::array<float,2>{0.259445071f, 0.977408707f},
-std::array<float,2>{0.679740191f, 0.858634233f},
-std::array<float,2>{0.377747416f, 0.0452197082f},
-std::array<float,2>{0.823723853f, 0.356161028f},
-std::array<float,2>{0.115392685f, 0.715222716f},
-std::array<float,2>{0.522394538f, 0.653999746f},
-std::array<float,2>{0.324745148f, 0.261722237f},
-std::array<float,2>{0.9527089f, 0.11593353f},
-std::array<float,2>{0.246430472f, 0.759561181f},
-std::array<float,2>{0.787974894f, 0.89627409f},
-std::array<float,2>{0.0323695131f, 0.145871997f},
-std::array<float,2>{0.727719843f, 0.479940891f},
-std::array<float,2>{0.447759598f, 0.511145353f},
-std::array<float,2>{0.845941007f, 0.744789541f},
-std::array<float,2>{0.0717532411f, 0.33441475f},
-std::array<float,2>{0.638922751f, 0.0239538494f},
-std::array<float,2>{0.435855478f, 0.837873757f},
-std::array<float,2>{0.599167347f, 0.96214962f},
-std::array<float,2>{0.294341117f, 0.248680279f},
-std::array<float,2>{0.906897902f, 0.416343957f},
-std::array<float,2>{0.128969625f, 0.568984032f},
-std::array<float,2>{0.712003469f, 0.548848987f},
-std::array<float,2>{0.476161301f, 0.441646606f},
-std::array<float,2>{0.753755808f, 0.166356936f},
-std::array<float,2>{0.0199830476f, 0.908803582f},
-std::array<float,2>{0.976634204f, 0.808566749f},
-std::array<float,2>{0.199084535f, 0.092703484f},
-std::array<float,2>{0.539893031f, 0.309776098f},
-std::array<float,2>{0.369663596f, 0.675832212f},
-std::array<float,2>{0.771849632f, 0.528913736f},
-std::array<float,2>{0.00785702839f, 0.486592025f},
-std::array<float,2>{0.699760139f, 0.133526489f},
-std::array<float,2>{0.486285865f, 0.881156683f},
-std::array<float,2>{0.552677274f, 0.76930058f},
-std::array<float,2>{0.349845082f, 0.0989492685f},
-std::array<float,2>{0.990333438f, 0.280022502f},
-std::array<float,2>{0.209028155f, 0.63740325f},
-std::array<float,2>{0.654021561f, 0.690868795f},
-std::array<float,2>{0.421137631f, 0.367165595f},
-std::array<float,2>{0.866089582f, 0.0504972376f},
-std::array<float,2>{0.0861592218f, 0.873407066f},
-std::array<float,2>{0.936575651f, 0.996357977f},
-std::array<float,2>{0.151187271f, 0.215790913f},
-std::array<float,2>{0.612771451f, 0.392914772f},
-std::array<float,2>{0.296943456f, 0.624560654f},
-std::array<float,2>{0.954974174f, 0.666236937f},
-std::array<float,2>{0.221125051f, 0.291109204f},
-std::array<float,2>{0.513454258f, 0.0687307641f},
-std::array<float,2>{0.330520153f, 0.795985937f},
-std::array<float,2>{0.745681047f, 0.924741387f},
-std::array<float,2>{0.465296835f, 0.177856699f},
-std::array<float,2>{0.81183362f, 0.459470809f},
-std::array<float,2>{0.047329545f, 0.537554026f},
-std::array<float,2>{0.575298011f, 0.584762156f},
-std::array<float,2>{0.278466642f, 0.422732264f},
-std::array<float,2>{0.901196003f, 0.219339401f},
-std::array<float,2>{0.183567509f, 0.947378516f},
-std::array<float,2>{0.829536021f, 0.826979101f},
-std::array<float,2>{0.0957029015f, 0.00984985847f},
-std::array<float,2>{0.658700466f, 0.324799269f},
-std::array<float,2>{0.394189775f, 0.733023286f},
-std::array<float,2>{0.997781217f, 0.545345008f},
-std::array<float,2>{0.21363394f, 0.461790293f},
-std::array<float,2>{0.555513024f, 0.181005508f},
-std::array<float,2>{0.355228722f, 0.932281435f},
-std::array<float,2>{0.68876183f, 0.781287313f},
-std::array<float,2>{0.493135691f, 0.076350823f},
-std::array<float,2>{0.774809718f, 0.283237666f},
-std::array<float,2>{0.00364735397f, 0.663109481f},
-std::array<float,2>{0.622965217f, 0.719772816f},
-std::array<float,2>{0.306853175f, 0.312950999f},
-std::array<float,2>{0.924012661f, 0.00413376326f},
-std::array<float,2>{0.141442552f, 0.818644226f},
-std::array<float,2>{0.867635787f, 0.944206774f},
-std::array<float,2>{0.0785033628f, 0.230729192f},
-std::array<float,2>{0.647307694f, 0.43610099f},
-std::array<float,2>{0.409071833f, 0.591820955f},
-std::array<float,2>{0.800867736f, 0.630618453f},
-std::array<float,2>{0.0600666255f, 0.268904001f},
-std::array<float,2>{0.738436043f, 0.103093423f},
-std::array<float,2>{0.458759576f, 0.778305233f},
-std::array<float,2>{0.506951869f, 0.887001038f},
-std::array<float,2>{0.337388009f, 0.125878736f},
-std::array<float,2>{0.967244267f, 0.495327353f},
-std::array<float,2>{0.231310949f, 0.522164166f},
-std::array<float,2>{0.669997811f, 0.615669847f},
-std::array<float,2>{0.404007733f, 0.399749458f},
-std::array<float,2>{0.842770815f, 0.208542034f},
-std::array<float,2>{0.102217726f, 0.98451364f},
-std::array<float,2>{0.897986829f, 0.862275064f},
-std::array<float,2>{0.176559567f, 0.061975427f},
-std::array<float,2>{0.562646866f, 0.374617815f},
-std::array<float,2>{0.266756833f, 0.69624263f},
-std::array<float,2>{0.816431999f, 0.570825815f},
-std::array<float,2>{0.11965058f, 0.412647277f},
-std::array<float,2>{0.672829807f, 0.238998741f},
-std::array<float,2>{0.389952242f, 0.960829496f},
-std::array<float,2>{0.591302872f, 0.82846868f},
-std::array<float,2>{0.256717175f, 0.0205052402f},
-std::array<float,2>{0.889394701f, 0.343733847f},
-std::array<float,2>{0.159767777f, 0.736345768f},
-std::array<float,2>{0.725301921f, 0.687411904f},
-std::array<float,2>{0.438599974f, 0.301070243f},
-std::array<float,2>{0.794758201f, 0.0815235004f},
-std::array<float,2>{0.0408873968f, 0.800791264f},
-std::array<float,2>{0.938850343f, 0.914731622f},
-std::array<float,2>{0.235460833f, 0.163441554f},
-std::array<float,2>{0.527115107f, 0.45186463f},
-std::array<float,2>{0.316025078f, 0.559207976f},
-std::array<float,2>{0.915416956f, 0.707422376f},
-std::array<float,2>{0.134837493f, 0.347586006f},
-std::array<float,2>{0.602130771f, 0.0335033275f},
-std::array<float,2>{0.286486357f, 0.848429739f},
-std::array<float,2>{0.632521152f, 0.972784817f},
-std::array<float,2>{0.426163018f, 0.195537895f},
-std::array<float,2>{0.854252815f, 0.37636289f},
-std::array<float,2>{0.0698292255f, 0.595443904f},
-std::array<float,2>{0.532331944f, 0.505531073f},
-std::array<float,2>{0.366164118f, 0.469247401f},
-std::array<float,2>{0.972748756f, 0.156234294f},
-std::array<float,2>{0.192726016f, 0.904316962f},
-std::array<float,2>{0.76402992f, 0.753464878f},
-std::array<float,2>{0.0238182452f, 0.123036623f},
-std::array<float,2>{0.706643939f, 0.254622579f},
-std::array<float,2>{0.482011825f, 0.644334257f},
-std::array<float,2>{0.885908723f, 0.523709059f},
-std::array<float,2>{0.162666395f, 0.488974303f},
-std::array<float,2>{0.588352323f, 0.137503579f},
-std::array<float,2>{0.250857502f, 0.875126481f},
-std::array<float,2>{0.67844063f, 0.771698415f},
-std::array<float,2>{0.384743541f, 0.0942223817f},
-std::array<float,2>{0.813719809f, 0.277267992f},
-std::array<float,2>{0.123061687f, 0.635451794f},
-std::array<float,2>{0.5277704f, 0.69284445f},
-std::array<float,2>{0.318517327f, 0.361679226f},
-std::array<float,2>{0.944936693f, 0.0525875092f},
-std::array<float,2>{0.240594596f, 0.86901319f},
-std::array<float,2>{0.792591333f, 0.993087709f},
-std::array<float,2>{0.0463554263f, 0.212599397f},
-std::array<float,2>{0.718803346f, 0.395293176f},
-std::array<float,2>{0.442208081f, 0.617286623f},
-std::array<float,2>{0.857699752f, 0.671760976f},
-std::array<float,2>{0.0659254938f, 0.293958515f},
-std::array<float,2>{0.627907813f, 0.0630327314f},
-std::array<float,2>{0.422872424f, 0.792636693f},
-std::array<float,2>{0.60751003f, 0.928473711f},
-std::array<float,2>{0.28368035f, 0.17554079f},
-std::array<float,2>{0.919996023f, 0.455318898f},
-std::array<float,2>{0.138968289f, 0.532836139f},
-std::array<float,2>{0.709499776f, 0.579817712f},
-std::array<float,2>{0.478593469f, 0.428514391f},
-std::array<float,2>{0.759133518f, 0.225791261f},
-std::array<float,2>{0.0309606027f, 0.952833474f},
-std::array<float,2>{0.969672084f, 0.822106421f},
-std::array<float,2>{0.189837322f, 0.0152223324f},
-std::array<float,2>{0.535705149f, 0.32360211f},
-std::array<float,2>{0.361771286f, 0.727565527f},
-std::array<float,2>{0.778250992f, 0.607409894f},
-std::array<float,2>{0.00638389587f, 0.389540523f},
-std::array<float,2>{0.692752421f, 0.189966485f},
-std::array<float,2>{0.49862662f, 0.982381701f},
-std::array<float,2>{0.561827064f, 0.85269165f},
-std::array<float,2>{0.357568562f, 0.0422295555f},
-std::array<float,2>{0.992218375f, 0.352762967f},
-std::array<float,2>{0.216437623f, 0.714146554f},
-std::array<float,2>{0.643369496f, 0.652098954f},
-std::array<float,2>{0.413172632f, 0.258435965f},
-std::array<float,2>{0.872745931f, 0.113244057f},
-std::array<float,2>{0.0858766884f, 0.763172984f},
-std::array<float,2>{0.92784363f, 0.891576111f},
-std::array<float,2>{0.146124929f, 0.143234029f},
-std::array<float,2>{0.620626807f, 0.484007865f},
-std::array<float,2>{0.308670431f, 0.515209198f},
-std::array<float,2>{0.962812662f, 0.748255372f},
-std::array<float,2>{0.228908777f, 0.329161882f},
-std::array<float,2>{0.500360489f, 0.0296417028f},
-std::array<float,2>{0.340548038f, 0.843259692f},
-std::array<float,2>{0.737381101f, 0.96657598f},
-std::array<float,2>{0.453876346f, 0.24421154f},
-std::array<float,2>{0.797129929f, 0.419892251f},
-std::array<float,2>{0.0585087202f, 0.564447999f},
-std::array<float,2>{0.568603933f, 0.552274227f},
-std::array<float,2>{0.270700306f, 0.43914181f},
-std::array<float,2>{0.892829478f, 0.169770092f},
-std::array<float,2>{0.174549282f, 0.911230266f},
-std::array<float,2>{0.8367396f, 0.810338676f},
-std::array<float,2>{0.107345805f, 0.0875492617f},
-std::array<float,2>{0.667829037f, 0.308001041f},
-std::array<float,2>{0.399913847f, 0.675491393f},
-std::array<float,2>{0.98447144f, 0.576075852f},
-std::array<float,2>{0.206540376f, 0.406593502f},
-std::array<float,2>{0.550517082f, 0.235337526f},
-std::array<float,2>{0.345659018f, 0.955501974f},
-std::array<float,2>{0.695930183f, 0.83212316f},
-std::array<float,2>{0.491118371f, 0.0176562443f},
-std::array<float,2>{0.767265081f, 0.336755157f},
-std::array<float,2>{0.0148402974f, 0.740601778f},
-std::array<float,2>{0.614067495f, 0.681182563f},
-std::array<float,2>{0.302683949f, 0.300418735f},
-std::array<float,2>{0.933198869f, 0.0839218423f},
-std::array<float,2>{0.154214546f, 0.798696518f},
-std::array<float,2>{0.861280739f, 0.918711722f},
-std::array<float,2>{0.090584442f, 0.157012016f},
-std::array<float,2>{0.648629367f, 0.448057115f},
-std::array<float,2>{0.417800605f, 0.554888248f},
-std::array<float,2>{0.807881474f, 0.703936994f},
-std::array<float,2>{0.0517928377f, 0.349000633f},
-std::array<float,2>{0.747864544f, 0.037815772f},
-std::array<float,2>{0.461509615f, 0.846779108f},
-std::array<float,2>{0.508879006f, 0.969005227f},
-std::array<float,2>{0.335531533f, 0.201593474f},
-std::array<float,2>{0.957966983f, 0.38223961f},
-std::array<float,2>{0.226377547f, 0.600122988f},
-std::array<float,2>{0.662941575f, 0.502878606f},
-std::array<float,2>{0.398042083f, 0.473284423f},
-std::array<float,2>{0.835235298f, 0.150928885f},
-std::array<float,2>{0.0976906195f, 0.90040195f},
-std::array<float,2>{0.903563499f, 0.757665753f},
-std::array<float,2>{0.183617085f, 0.120425232f},
-std::array<float,2>{0.574134946f, 0.252021909f},
-std::array<float,2>{0.274969131f, 0.645508349f},
-std::array<float,2>{0.825321078f, 0.540458918f},
-std::array<float,2>{0.110677995f, 0.465315908f},
-std::array<float,2>{0.687172115f, 0.184844553f},
-std::array<float,2>{0.379786104f, 0.935405314f},
-std::array<float,2>{0.584385812f, 0.78728205f},
-std::array<float,2>{0.263817638f, 0.0740882456f},
-std::array<float,2>{0.881149769f, 0.288597345f},
-std::array<float,2>{0.169450238f, 0.657409728f},
-std::array<float,2>{0.732201219f, 0.72554183f},
-std::array<float,2>{0.449282616f, 0.319172919f},
-std::array<float,2>{0.784953892f, 0.000841077126f},
-std::array<float,2>{0.0388349071f, 0.814344883f},
-std::array<float,2>{0.947791159f, 0.940213144f},
-std::array<float,2>{0.243528172f, 0.22955209f},
-std::array<float,2>{0.515892029f, 0.430713981f},
-std::array<float,2>{0.321428508f, 0.586818218f},
-std::array<float,2>{0.912592709f, 0.626505315f},
-std::array<float,2>{0.127813846f, 0.270173848f},
-std::array<float,2>{0.594045401f, 0.107916102f},
-std::array<float,2>{0.291427523f, 0.77614069f},
-std::array<float,2>{0.636407971f, 0.885196626f},
-std::array<float,2>{0.43159762f, 0.130963117f},
-std::array<float,2>{0.848228931f, 0.499041438f},
-std::array<float,2>{0.0762513503f, 0.516011477f},
-std::array<float,2>{0.546827614f, 0.610676646f},
-std::array<float,2>{0.373389244f, 0.40376991f},
-std::array<float,2>{0.981610179f, 0.205090597f},
-std::array<float,2>{0.201220438f, 0.989284396f},
-std::array<float,2>{0.753940642f, 0.863520503f},
-std::array<float,2>{0.0158940107f, 0.0564919934f},
-std::array<float,2>{0.715411484f, 0.367525041f},
-std::array<float,2>{0.471179366f, 0.701136947f},
-std::array<float,2>{0.934281647f, 0.624020517f},
-std::array<float,2>{0.149698034f, 0.393809885f},
-std::array<float,2>{0.61081624f, 0.215942085f},
-std::array<float,2>{0.30032289f, 0.997275829f},
-std::array<float,2>{0.655204058f, 0.874332905f},
-std::array<float,2>{0.41986683f, 0.0495390706f},
-std::array<float,2>{0.864255667f, 0.365860283f},
-std::array<float,2>{0.0892934278f, 0.689662397f},
-std::array<float,2>{0.553355455f, 0.637979865f},
-std::array<float,2>{0.347690254f, 0.28035444f},
-std::array<float,2>{0.988776386f, 0.0982641578f},
-std::array<float,2>{0.20763582f, 0.76771313f},
-std::array<float,2>{0.770271063f, 0.882463694f},
-std::array<float,2>{0.0105569614f, 0.134167522f},
-std::array<float,2>{0.70244509f, 0.487754822f},
-std::array<float,2>{0.487956434f, 0.528015435f},
-std::array<float,2>{0.831613421f, 0.734085619f},
-std::array<float,2>{0.0970745087f, 0.325426608f},
-std::array<float,2>{0.657199085f, 0.0116725452f},
-std::array<float,2>{0.390738636f, 0.827834845f},
-std::array<float,2>{0.57781595f, 0.948452294f},
-std::array<float,2>{0.280142844f, 0.219994366f},
-std::array<float,2>{0.899948061f, 0.422962815f},
-std::array<float,2>{0.180686578f, 0.585616887f},
-std::array<float,2>{0.742582619f, 0.538537443f},
-std::array<float,2>{0.468147695f, 0.460291356f},
-std::array<float,2>{0.81054008f, 0.179614961f},
-std::array<float,2>{0.0493248738f, 0.925363481f},
-std::array<float,2>{0.956407964f, 0.795841515f},
-std::array<float,2>{0.219373062f, 0.0696541741f},
-std::array<float,2>{0.513937354f, 0.292785883f},
-std::array<float,2>{0.329431623f, 0.667460203f},
-std::array<float,2>{0.786242902f, 0.510738194f},
-std::array<float,2>{0.0339797921f, 0.478708386f},
-std::array<float,2>{0.730072618f, 0.145414308f},
-std::array<float,2>{0.445559591f, 0.894944489f},
-std::array<float,2>{0.520648539f, 0.757882595f},
-std::array<float,2>{0.32623893f, 0.116236873f},
-std::array<float,2>{0.950273454f, 0.26349467f},
-std::array<float,2>{0.249731153f, 0.652547777f},
-std::array<float,2>{0.682729006f, 0.715844035f},
-std::array<float,2>{0.376605451f, 0.356751978f},
-std::array<float,2>{0.821461141f, 0.0459974036f},
-std::array<float,2>{0.114941388f, 0.858384013f},
-std::array<float,2>{0.87536633f, 0.978222311f},
-std::array<float,2>{0.16645284f, 0.191629216f},
-std::array<float,2>{0.580296576f, 0.385758221f},
-std::array<float,2>{0.260168552f, 0.602300882f},
-std::array<float,2>{0.980059206f, 0.677628696f},
-std::array<float,2>{0.195443407f, 0.309088916f},
-std::array<float,2>{0.541692972f, 0.0931697115f},
-std::array<float,2>{0.369048506f, 0.80761379f},
-std::array<float,2>{0.713287294f, 0.910024822f},
-std::array<float,2>{0.472928762f, 0.167702734f},
-std::array<float,2>{0.751508176f, 0.44250837f},
-std::array<float,2>{0.0220019389f, 0.550780356f},
-std::array<float,2>{0.601109207f, 0.569820225f},
-std::array<float,2>{0.296314806f, 0.417778432f},
-std::array<float,2>{0.910007238f, 0.249342725f},
-std::array<float,2>{0.132440701f, 0.961097479f},
-std::array<float,2>{0.845024705f, 0.836085975f},
-std::array<float,2>{0.072609216f, 0.0244506057f},
-std::array<float,2>{0.638199627f, 0.335642904f},
-std::array<float,2>{0.43517527f, 0.745469034f},
-std::array<float,2>{0.940527916f, 0.560099185f},
-std::array<float,2>{0.238134846f, 0.452654034f},
-std::array<float,2>{0.523768842f, 0.162234083f},
-std::array<float,2>{0.31291005f, 0.916005969f},
-std::array<float,2>{0.72414422f, 0.80217427f},
-std::array<float,2>{0.440817833f, 0.0806441382f},
-std::array<float,2>{0.796216607f, 0.302462459f},
-std::array<float,2>{0.0421942323f, 0.686029196f},
-std::array<float,2>{0.592295229f, 0.738022685f},
-std::array<float,2>{0.255082428f, 0.342491448f},
-std::array<float,2>{0.887664557f, 0.0205440763f},
-std::array<float,2>{0.157306209f, 0.829885662f},
-std::array<float,2>{0.819935083f, 0.959167838f},
-std::array<float,2>{0.118113063f, 0.239562571f},
-std::array<float,2>{0.674712777f, 0.41333431f},
-std::array<float,2>{0.386924624f, 0.571791649f},
-std::array<float,2>{0.762798071f, 0.643444955f},
-std::array<float,2>{0.0257460382f, 0.254962444f},
-std::array<float,2>{0.704712749f, 0.121720813f},
-std::array<float,2>{0.482496291f, 0.752659857f},
-std::array<float,2>{0.534806907f, 0.905885577f},
-std::array<float,2>{0.363542348f, 0.155229151f},
-std::array<float,2>{0.976249278f, 0.470587313f},
-std::array<float,2>{0.194294065f, 0.504603803f},
-std::array<float,2>{0.629569113f, 0.594349623f},
-std::array<float,2>{0.429207265f, 0.375561327f},
-std::array<float,2>{0.851774693f, 0.196746767f},
-std::array<float,2>{0.0670163482f, 0.974120736f},
-std::array<float,2>{0.916980028f, 0.849608541f},
-std::array<float,2>{0.134316415f, 0.0350714549f},
-std::array<float,2>{0.604773521f, 0.345978856f},
-std::array<float,2>{0.288582951f, 0.708261073f},
-std::array<float,2>{0.870621204f, 0.593113959f},
-std::array<float,2>{0.0806407332f, 0.437201947f},
-std::array<float,2>{0.644851625f, 0.231489629f},
-std::array<float,2>{0.407467991f, 0.944379508f},
-std::array<float,2>{0.624718666f, 0.819723248f},
-std::array<float,2>{0.306287885f, 0.00573524693f},
-std::array<float,2>{0.923281312f, 0.313632697f},
-std::array<float,2>{0.143887371f, 0.71965605f},
-std::array<float,2>{0.691326976f, 0.662944436f},
-std::array<float,2>{0.49442029f, 0.284305573f},
-std::array<float,2>{0.776936233f, 0.0772140101f},
-std::array<float,2>{0.00191867526f, 0.782664299f},
-std::array<float,2>{0.998594582f, 0.93269372f},
-std::array<float,2>{0.210986823f, 0.180342451f},
-std::array<float,2>{0.556729198f, 0.462052137f},
-std::array<float,2>{0.352935165f, 0.546017587f},
-std::array<float,2>{0.895961106f, 0.696736693f},
-std::array<float,2>{0.178429917f, 0.373255342f},
-std::array<float,2>{0.565440297f, 0.0605477318f},
-std::array<float,2>{0.268563449f, 0.862539828f},
-std::array<float,2>{0.669453382f, 0.986009419f},
-std::array<float,2>{0.405534387f, 0.207622945f},
-std::array<float,2>{0.840878665f, 0.398681402f},
-std::array<float,2>{0.105088688f, 0.616654515f},
-std::array<float,2>{0.504872561f, 0.523368776f},
-std::array<float,2>{0.339233667f, 0.494855136f},
-std::array<float,2>{0.966375232f, 0.126064867f},
-std::array<float,2>{0.233613461f, 0.887960315f},
-std::array<float,2>{0.803850055f, 0.779266238f},
-std::array<float,2>{0.0611176528f, 0.102467746f},
-std::array<float,2>{0.741500556f, 0.268016547f},
-std::array<float,2>{0.459812999f, 0.629741251f},
-std::array<float,2>{0.919484496f, 0.533362269f},
-std::array<float,2>{0.136887282f, 0.453696311f},
-std::array<float,2>{0.606218338f, 0.172444195f},
-std::array<float,2>{0.281538099f, 0.92613852f},
-std::array<float,2>{0.625469148f, 0.79056865f},
-std::array<float,2>{0.423975855f, 0.0658693761f},
-std::array<float,2>{0.856558979f, 0.296405077f},
-std::array<float,2>{0.0639877021f, 0.66930145f},
-std::array<float,2>{0.537253022f, 0.729537845f},
-std::array<float,2>{0.360102355f, 0.321672648f},
-std::array<float,2>{0.970863342f, 0.01336536f},
-std::array<float,2>{0.188385397f, 0.82306546f},
-std::array<float,2>{0.761533558f, 0.949806094f},
-std::array<float,2>{0.0291883014f, 0.223621324f},
-std::array<float,2>{0.707365453f, 0.426463932f},
-std::array<float,2>{0.477135479f, 0.581897914f},
-std::array<float,2>{0.814930916f, 0.634237945f},
-std::array<float,2>{0.121898323f, 0.274922758f},
-std::array<float,2>{0.677408755f, 0.0964370668f},
-std::array<float,2>{0.385073066f, 0.769866109f},
-std::array<float,2>{0.586122572f, 0.878622651f},
-std::array<float,2>{0.252521008f, 0.139295042f},
-std::array<float,2>{0.88390547f, 0.491475105f},
-std::array<float,2>{0.160689056f, 0.527219117f},
-std::array<float,2>{0.721194386f, 0.620377302f},
-std::array<float,2>{0.444732159f, 0.398298442f},
-std::array<float,2>{0.78928113f, 0.21432732f},
-std::array<float,2>{0.0438003354f, 0.994276464f},
-std::array<float,2>{0.942265987f, 0.869616032f},
-std::array<float,2>{0.239711121f, 0.0538709424f},
-std::array<float,2>{0.531043887f, 0.359920293f},
-std::array<float,2>{0.317436695f, 0.693847895f},
-std::array<float,2>{0.800303757f, 0.565069497f},
-std::array<float,2>{0.0555979237f, 0.42109257f},
-std::array<float,2>{0.736039996f, 0.242505342f},
-std::array<float,2>{0.456831187f, 0.967179477f},
-std::array<float,2>{0.502496958f, 0.840911627f},
-std::array<float,2>{0.343544811f, 0.029044399f},
-std::array<float,2>{0.964104891f, 0.331360608f},
-std::array<float,2>{0.228016004f, 0.747001648f},
-std::array<float,2>{0.664308131f, 0.67379868f},
-std::array<float,2>{0.401739776f, 0.305418789f},
-std::array<float,2>{0.839190841f, 0.0890053064f},
-std::array<float,2>{0.107887805f, 0.810806513f},
-std::array<float,2>{0.892498314f, 0.913475335f},
-std::array<float,2>{0.172595158f, 0.170355022f},
-std::array<float,2>{0.567977011f, 0.441186607f},
-std::array<float,2>{0.272027612f, 0.552805424f},
-std::array<float,2>{0.995646596f, 0.711221397f},
-std::array<float,2>{0.217473805f, 0.35457173f},
-std::array<float,2>{0.560311675f, 0.0406048633f},
-std::array<float,2>{0.356117636f, 0.854287386f},
-std::array<float,2>{0.69496268f, 0.9832955f},
-std::array<float,2>{0.496887952f, 0.188847348f},
-std::array<float,2>{0.779536724f, 0.38863951f},
-std::array<float,2>{0.00497273263f, 0.608052254f},
-std::array<float,2>{0.617480099f, 0.5119766f},
-std::array<float,2>{0.311799824f, 0.481496155f},
-std::array<float,2>{0.926586926f, 0.142391443f},
-std::array<float,2>{0.146561503f, 0.893528998f},
-std::array<float,2>{0.8734321f, 0.765601814f},
-std::array<float,2>{0.0832735971f, 0.109410271f},
-std::array<float,2>{0.641310096f, 0.261108935f},
-std::array<float,2>{0.411358207f, 0.650033534f},
-std::array<float,2>{0.960141599f, 0.599390745f},
-std::array<float,2>{0.223647878f, 0.380251557f},
-std::array<float,2>{0.510923684f, 0.200785294f},
-std::array<float,2>{0.332199395f, 0.971028686f},
-std::array<float,2>{0.748462021f, 0.843853176f},
-std::array<float,2>{0.464231819f, 0.0371012725f},
-std::array<float,2>{0.805020392f, 0.350347251f},
-std::array<float,2>{0.0534303598f, 0.705333829f},
-std::array<float,2>{0.571001709f, 0.646900058f},
-std::array<float,2>{0.276891768f, 0.250219584f},
-std::array<float,2>{0.905195057f, 0.118723698f},
-std::array<float,2>{0.187018067f, 0.75392729f},
-std::array<float,2>{0.832343519f, 0.899086058f},
-std::array<float,2>{0.0996553823f, 0.149816737f},
-std::array<float,2>{0.662008762f, 0.476383835f},
-std::array<float,2>{0.396085918f, 0.500000715f},
-std::array<float,2>{0.769331455f, 0.738420188f},
-std::array<float,2>{0.0131594995f, 0.338972837f},
-std::array<float,2>{0.698895872f, 0.0166859087f},
-std::array<float,2>{0.488475829f, 0.834303617f},
-std::array<float,2>{0.548321068f, 0.953269958f},
-std::array<float,2>{0.347221911f, 0.237323821f},
-std::array<float,2>{0.986873329f, 0.409482628f},
-std::array<float,2>{0.204090074f, 0.576214075f},
-std::array<float,2>{0.651428461f, 0.557721734f},
-std::array<float,2>{0.415407866f, 0.446244299f},
-std::array<float,2>{0.862442315f, 0.159607127f},
-std::array<float,2>{0.0930132866f, 0.920916855f},
-std::array<float,2>{0.931373775f, 0.800168693f},
-std::array<float,2>{0.154893249f, 0.0856079012f},
-std::array<float,2>{0.615367353f, 0.297193319f},
-std::array<float,2>{0.303128988f, 0.681765139f},
-std::array<float,2>{0.850639522f, 0.518262863f},
-std::array<float,2>{0.0756061599f, 0.496704072f},
-std::array<float,2>{0.633772135f, 0.130852476f},
-std::array<float,2>{0.433477253f, 0.884124696f},
-std::array<float,2>{0.596937537f, 0.774609685f},
-std::array<float,2>{0.289399892f, 0.107065558f},
-std::array<float,2>{0.911825001f, 0.272859961f},
-std::array<float,2>{0.125487417f, 0.628240705f},
-std::array<float,2>{0.716986477f, 0.702655554f},
-std::array<float,2>{0.468933254f, 0.36987865f},
-std::array<float,2>{0.757442951f, 0.0566630028f},
-std::array<float,2>{0.0190441925f, 0.86610806f},
-std::array<float,2>{0.98305124f, 0.991208732f},
-std::array<float,2>{0.199275061f, 0.203528538f},
-std::array<float,2>{0.543325782f, 0.404819369f},
-std::array<float,2>{0.372856736f, 0.612532139f},
-std::array<float,2>{0.878926516f, 0.658824325f},
-std::array<float,2>{0.170393944f, 0.285546929f},
-std::array<float,2>{0.582923949f, 0.0719232783f},
-std::array<float,2>{0.262140393f, 0.786597908f},
-std::array<float,2>{0.68498987f, 0.937003136f},
-std::array<float,2>{0.380936086f, 0.185845822f},
-std::array<float,2>{0.82715559f, 0.466820508f},
-std::array<float,2>{0.112592839f, 0.541666269f},
-std::array<float,2>{0.519155502f, 0.588491738f},
-std::array<float,2>{0.323632091f, 0.433410197f},
-std::array<float,2>{0.946455956f, 0.226766005f},
-std::array<float,2>{0.245969728f, 0.93847692f},
-std::array<float,2>{0.782407641f, 0.814609587f},
-std::array<float,2>{0.0365592539f, 0.0038262778f},
-std::array<float,2>{0.734250665f, 0.317569882f},
-std::array<float,2>{0.452585012f, 0.724015057f},
-std::array<float,2>{0.901833236f, 0.583157659f},
-std::array<float,2>{0.181879237f, 0.423931211f},
-std::array<float,2>{0.574640751f, 0.220740497f},
-std::array<float,2>{0.277657598f, 0.946955979f},
-std::array<float,2>{0.660075366f, 0.8249259f},
-std::array<float,2>{0.392967492f, 0.00833603926f},
-std::array<float,2>{0.828802347f, 0.327737898f},
-std::array<float,2>{0.094400622f, 0.730964363f},
-std::array<float,2>{0.51173383f, 0.664883792f},
-std::array<float,2>{0.33122319f, 0.289947927f},
-std::array<float,2>{0.953410208f, 0.0673986524f},
-std::array<float,2>{0.222577721f, 0.79444313f},
-std::array<float,2>{0.811224222f, 0.923343241f},
-std::array<float,2>{0.0479019359f, 0.17652908f},
-std::array<float,2>{0.744987547f, 0.458246857f},
-std::array<float,2>{0.466262549f, 0.536049664f},
-std::array<float,2>{0.867031932f, 0.687527001f},
-std::array<float,2>{0.0870003924f, 0.363380253f},
-std::array<float,2>{0.652772784f, 0.0477668382f},
-std::array<float,2>{0.420589745f, 0.871497214f},
-std::array<float,2>{0.611616492f, 0.999602199f},
-std::array<float,2>{0.298430741f, 0.217682749f},
-std::array<float,2>{0.936199546f, 0.391886622f},
-std::array<float,2>{0.151746094f, 0.62287581f},
-std::array<float,2>{0.700215876f, 0.530173838f},
-std::array<float,2>{0.484777749f, 0.485503405f},
-std::array<float,2>{0.772919476f, 0.1353174f},
-std::array<float,2>{0.00940294191f, 0.880759716f},
-std::array<float,2>{0.99138087f, 0.767018735f},
-std::array<float,2>{0.210840568f, 0.10124965f},
-std::array<float,2>{0.551294267f, 0.278321892f},
-std::array<float,2>{0.350611776f, 0.639854074f},
-std::array<float,2>{0.752575278f, 0.547222674f},
-std::array<float,2>{0.0206806678f, 0.443359464f},
-std::array<float,2>{0.711591959f, 0.164666221f},
-std::array<float,2>{0.474744469f, 0.907240391f},
-std::array<float,2>{0.541015446f, 0.80644536f},
-std::array<float,2>{0.37058571f, 0.0899944454f},
-std::array<float,2>{0.978192866f, 0.312007695f},
-std::array<float,2>{0.197561786f, 0.67965126f},
-std::array<float,2>{0.640296102f, 0.742440403f},
-std::array<float,2>{0.437430561f, 0.332999855f},
-std::array<float,2>{0.84742415f, 0.0260772333f},
-std::array<float,2>{0.0707446784f, 0.838999808f},
-std::array<float,2>{0.907233953f, 0.962925136f},
-std::array<float,2>{0.130616054f, 0.24700278f},
-std::array<float,2>{0.597898424f, 0.415014952f},
-std::array<float,2>{0.293440193f, 0.567914724f},
-std::array<float,2>{0.952071011f, 0.655720353f},
-std::array<float,2>{0.247478783f, 0.264658153f},
-std::array<float,2>{0.522718012f, 0.114520431f},
-std::array<float,2>{0.325209618f, 0.760891199f},
-std::array<float,2>{0.727356791f, 0.897027075f},
-std::array<float,2>{0.448790073f, 0.146859676f},
-std::array<float,2>{0.788208783f, 0.477284759f},
-std::array<float,2>{0.0319440439f, 0.50882864f},
-std::array<float,2>{0.57847172f, 0.603694558f},
-std::array<float,2>{0.257849216f, 0.38307187f},
-std::array<float,2>{0.877747893f, 0.195217744f},
-std::array<float,2>{0.16499345f, 0.979606271f},
-std::array<float,2>{0.822379231f, 0.855517447f},
-std::array<float,2>{0.116769828f, 0.0434541143f},
-std::array<float,2>{0.681577265f, 0.35906142f},
-std::array<float,2>{0.378885955f, 0.718575358f},
-std::array<float,2>{0.974091887f, 0.506571889f},
-std::array<float,2>{0.192174792f, 0.472203076f},
-std::array<float,2>{0.532059908f, 0.152592108f},
-std::array<float,2>{0.366973758f, 0.903315365f},
-std::array<float,2>{0.705550551f, 0.751821697f},
-std::array<float,2>{0.481058031f, 0.123049699f},
-std::array<float,2>{0.764801741f, 0.256858408f},
-std::array<float,2>{0.024971405f, 0.642023087f},
-std::array<float,2>{0.602789104f, 0.709204376f},
-std::array<float,2>{0.285191476f, 0.343826145f},
-std::array<float,2>{0.914393544f, 0.0329790264f},
-std::array<float,2>{0.136218473f, 0.850596547f},
-std::array<float,2>{0.855243444f, 0.974937975f},
-std::array<float,2>{0.0688766614f, 0.197961718f},
-std::array<float,2>{0.630881906f, 0.377276242f},
-std::array<float,2>{0.427719891f, 0.596823096f},
-std::array<float,2>{0.793847084f, 0.683989823f},
-std::array<float,2>{0.0391993038f, 0.304327726f},
-std::array<float,2>{0.725830197f, 0.078281343f},
-std::array<float,2>{0.438079625f, 0.803548694f},
-std::array<float,2>{0.526136577f, 0.917105317f},
-std::array<float,2>{0.314981699f, 0.160427794f},
-std::array<float,2>{0.93783462f, 0.449947715f},
-std::array<float,2>{0.234956816f, 0.561989069f},
-std::array<float,2>{0.673678279f, 0.573489368f},
-std::array<float,2>{0.388723314f, 0.410306007f},
-std::array<float,2>{0.818169713f, 0.240419522f},
-std::array<float,2>{0.120802566f, 0.957345068f},
-std::array<float,2>{0.890438378f, 0.831712425f},
-std::array<float,2>{0.15908657f, 0.0216403436f},
-std::array<float,2>{0.590209723f, 0.341105074f},
-std::array<float,2>{0.257234395f, 0.734862685f},
-std::array<float,2>{0.843366921f, 0.613638222f},
-std::array<float,2>{0.102940507f, 0.401506305f},
-std::array<float,2>{0.671549022f, 0.210069969f},
-std::array<float,2>{0.402587473f, 0.987990439f},
-std::array<float,2>{0.564396679f, 0.860377133f},
-std::array<float,2>{0.266590565f, 0.0599377267f},
-std::array<float,2>{0.897185445f, 0.371170044f},
-std::array<float,2>{0.177453518f, 0.697623193f},
-std::array<float,2>{0.739934325f, 0.631199479f},
-std::array<float,2>{0.457999766f, 0.267307371f},
-std::array<float,2>{0.802479565f, 0.104165681f},
-std::array<float,2>{0.0590139069f, 0.780626595f},
-std::array<float,2>{0.968635082f, 0.889617264f},
-std::array<float,2>{0.231853336f, 0.128779322f},
-std::array<float,2>{0.50622046f, 0.494036764f},
-std::array<float,2>{0.336689115f, 0.520511389f},
-std::array<float,2>{0.925467253f, 0.721274555f},
-std::array<float,2>{0.142102614f, 0.3150087f},
-std::array<float,2>{0.621375382f, 0.00724253245f},
-std::array<float,2>{0.308040112f, 0.818021595f},
-std::array<float,2>{0.648384094f, 0.943151593f},
-std::array<float,2>{0.409442961f, 0.233313382f},
-std::array<float,2>{0.868895471f, 0.433711976f},
-std::array<float,2>{0.0796938464f, 0.590917051f},
-std::array<float,2>{0.555778801f, 0.544155538f},
-std::array<float,2>{0.354272038f, 0.463401318f},
-std::array<float,2>{0.996781528f, 0.182038799f},
-std::array<float,2>{0.214100361f, 0.929826975f},
-std::array<float,2>{0.774049282f, 0.783668816f},
-std::array<float,2>{0.00234402763f, 0.0758816302f},
-std::array<float,2>{0.687643349f, 0.28251034f},
-std::array<float,2>{0.49344644f, 0.662016094f},
-std::array<float,2>{0.887350142f, 0.560908794f},
-std::array<float,2>{0.157700747f, 0.450713277f},
-std::array<float,2>{0.592692435f, 0.161965162f},
-std::array<float,2>{0.255293041f, 0.916744947f},
-std::array<float,2>{0.674465179f, 0.804413915f},
-std::array<float,2>{0.387088776f, 0.0796429589f},
-std::array<float,2>{0.820225239f, 0.303457797f},
-std::array<float,2>{0.117883138f, 0.685500741f},
-std::array<float,2>{0.523497701f, 0.735782504f},
-std::array<float,2>{0.312577635f, 0.340280116f},
-std::array<float,2>{0.940791667f, 0.0234341528f},
-std::array<float,2>{0.237955183f, 0.831046641f},
-std::array<float,2>{0.796099961f, 0.958760738f},
-std::array<float,2>{0.0423859023f, 0.241243482f},
-std::array<float,2>{0.724492848f, 0.411675394f},
-std::array<float,2>{0.440467924f, 0.572973669f},
-std::array<float,2>{0.851916969f, 0.640969753f},
-std::array<float,2>{0.0672391132f, 0.256162733f},
-std::array<float,2>{0.629658461f, 0.124097489f},
-std::array<float,2>{0.429554254f, 0.750002742f},
-std::array<float,2>{0.604603469f, 0.90347296f},
-std::array<float,2>{0.288866341f, 0.153980434f},
-std::array<float,2>{0.916740358f, 0.471519917f},
-std::array<float,2>{0.134683862f, 0.506981373f},
-std::array<float,2>{0.704917252f, 0.596586525f},
-std::array<float,2>{0.482899636f, 0.378905058f},
-std::array<float,2>{0.763091981f, 0.198585555f},
-std::array<float,2>{0.0255361386f, 0.975823045f},
-std::array<float,2>{0.976546228f, 0.850182831f},
-std::array<float,2>{0.194020167f, 0.0321963131f},
-std::array<float,2>{0.535021007f, 0.345429361f},
-std::array<float,2>{0.363356709f, 0.710883558f},
-std::array<float,2>{0.777264595f, 0.590081036f},
-std::array<float,2>{0.00154043268f, 0.435232699f},
-std::array<float,2>{0.691070497f, 0.233786047f},
-std::array<float,2>{0.494256914f, 0.941965222f},
-std::array<float,2>{0.557112157f, 0.816933036f},
-std::array<float,2>{0.352666855f, 0.00613274239f},
-std::array<float,2>{0.998984635f, 0.315839559f},
-std::array<float,2>{0.211409405f, 0.722334743f},
-std::array<float,2>{0.644732714f, 0.660396218f},
-std::array<float,2>{0.407659203f, 0.281616241f},
-std::array<float,2>{0.871031106f, 0.0744691938f},
-std::array<float,2>{0.0808975548f, 0.784998298f},
-std::array<float,2>{0.923031986f, 0.930948198f},
-std::array<float,2>{0.143720686f, 0.183499679f},
-std::array<float,2>{0.624800622f, 0.463950336f},
-std::array<float,2>{0.30655542f, 0.543473065f},
-std::array<float,2>{0.966577888f, 0.69827038f},
-std::array<float,2>{0.233788803f, 0.372234821f},
-std::array<float,2>{0.504411101f, 0.0595260262f},
-std::array<float,2>{0.338876814f, 0.859966755f},
-std::array<float,2>{0.741421044f, 0.986408532f},
-std::array<float,2>{0.459598064f, 0.209476382f},
-std::array<float,2>{0.804031968f, 0.401112974f},
-std::array<float,2>{0.0614558384f, 0.615044773f},
-std::array<float,2>{0.565849721f, 0.519597828f},
-std::array<float,2>{0.269007623f, 0.493143171f},
-std::array<float,2>{0.895557582f, 0.127101392f},
-std::array<float,2>{0.178468883f, 0.889920294f},
-std::array<float,2>{0.841174543f, 0.779343843f},
-std::array<float,2>{0.105261818f, 0.10511782f},
-std::array<float,2>{0.669901013f, 0.266103387f},
-std::array<float,2>{0.40544647f, 0.631878674f},
-std::array<float,2>{0.989034891f, 0.621683657f},
-std::array<float,2>{0.207844213f, 0.390697122f},
-std::array<float,2>{0.553625822f, 0.21818459f},
-std::array<float,2>{0.348102123f, 0.998072803f},
-std::array<float,2>{0.702342272f, 0.872821569f},
-std::array<float,2>{0.488155276f, 0.047953181f},
-std::array<float,2>{0.770199716f, 0.364966094f},
-std::array<float,2>{0.0104242777f, 0.688919008f},
-std::array<float,2>{0.610499918f, 0.638773322f},
-std::array<float,2>{0.30073452f, 0.277970791f},
-std::array<float,2>{0.934396982f, 0.0999273881f},
-std::array<float,2>{0.149463996f, 0.765762329f},
-std::array<float,2>{0.863870502f, 0.879269838f},
-std::array<float,2>{0.0888901204f, 0.136009201f},
-std::array<float,2>{0.65491581f, 0.484731048f},
-std::array<float,2>{0.419663936f, 0.53092736f},
-std::array<float,2>{0.810164332f, 0.731454194f},
-std::array<float,2>{0.0496811494f, 0.326518357f},
-std::array<float,2>{0.742430985f, 0.00885096099f},
-std::array<float,2>{0.467844844f, 0.825442135f},
-std::array<float,2>{0.513905942f, 0.946141422f},
-std::array<float,2>{0.329229325f, 0.22197853f},
-std::array<float,2>{0.956227958f, 0.424889535f},
-std::array<float,2>{0.219513297f, 0.582577586f},
-std::array<float,2>{0.656885505f, 0.536407232f},
-std::array<float,2>{0.390923917f, 0.45717141f},
-std::array<float,2>{0.831975937f, 0.177233204f},
-std::array<float,2>{0.0968316197f, 0.922801197f},
-std::array<float,2>{0.90035069f, 0.793583393f},
-std::array<float,2>{0.181012079f, 0.0672698095f},
-std::array<float,2>{0.577888012f, 0.290559024f},
-std::array<float,2>{0.279852241f, 0.665647805f},
-std::array<float,2>{0.821573675f, 0.508658111f},
-std::array<float,2>{0.115021937f, 0.477575183f},
-std::array<float,2>{0.682927907f, 0.147872835f},
-std::array<float,2>{0.376832128f, 0.897561669f},
-std::array<float,2>{0.580530882f, 0.760296524f},
-std::array<float,2>{0.259795457f, 0.113583736f},
-std::array<float,2>{0.875166476f, 0.26444611f},
-std::array<float,2>{0.166116208f, 0.655090988f},
-std::array<float,2>{0.730244398f, 0.717659712f},
-std::array<float,2>{0.445434123f, 0.357977688f},
-std::array<float,2>{0.786378205f, 0.0441068932f},
-std::array<float,2>{0.0337698981f, 0.856511354f},
-std::array<float,2>{0.950453639f, 0.979222894f},
-std::array<float,2>{0.249902785f, 0.19367224f},
-std::array<float,2>{0.520810246f, 0.383848786f},
-std::array<float,2>{0.326589227f, 0.604957283f},
-std::array<float,2>{0.909884751f, 0.678133905f},
-std::array<float,2>{0.132593319f, 0.31143406f},
-std::array<float,2>{0.601328135f, 0.0914886221f},
-std::array<float,2>{0.295949459f, 0.805442929f},
-std::array<float,2>{0.638541758f, 0.906766057f},
-std::array<float,2>{0.435518295f, 0.16542469f},
-std::array<float,2>{0.844824493f, 0.444928944f},
-std::array<float,2>{0.0724210963f, 0.548039973f},
-std::array<float,2>{0.541977227f, 0.566441178f},
-std::array<float,2>{0.368891507f, 0.415453315f},
-std::array<float,2>{0.980230987f, 0.247861281f},
-std::array<float,2>{0.195645615f, 0.964794338f},
-std::array<float,2>{0.751929998f, 0.838808954f},
-std::array<float,2>{0.0224493444f, 0.0270779468f},
-std::array<float,2>{0.713094532f, 0.333504111f},
-std::array<float,2>{0.47274217f, 0.743499875f},
-std::array<float,2>{0.933506727f, 0.577725768f},
-std::array<float,2>{0.154030859f, 0.408947676f},
-std::array<float,2>{0.613890588f, 0.236557275f},
-std::array<float,2>{0.3024064f, 0.954552948f},
-std::array<float,2>{0.648913562f, 0.835204899f},
-std::array<float,2>{0.417666197f, 0.0164018925f},
-std::array<float,2>{0.860923886f, 0.338695318f},
-std::array<float,2>{0.0904618651f, 0.740027606f},
-std::array<float,2>{0.550721049f, 0.683553815f},
-std::array<float,2>{0.345424682f, 0.298314631f},
-std::array<float,2>{0.984724164f, 0.084094204f},
-std::array<float,2>{0.206222251f, 0.799205959f},
-std::array<float,2>{0.767406046f, 0.920693398f},
-std::array<float,2>{0.0150826471f, 0.159069568f},
-std::array<float,2>{0.696066797f, 0.446563393f},
-std::array<float,2>{0.490795791f, 0.55674237f},
-std::array<float,2>{0.835040987f, 0.706867039f},
-std::array<float,2>{0.0979574919f, 0.350862235f},
-std::array<float,2>{0.662652254f, 0.0361023881f},
-std::array<float,2>{0.398399651f, 0.845331728f},
-std::array<float,2>{0.573972285f, 0.972081423f},
-std::array<float,2>{0.275201678f, 0.199904516f},
-std::array<float,2>{0.903573275f, 0.37921384f},
-std::array<float,2>{0.183950275f, 0.597985327f},
-std::array<float,2>{0.747682631f, 0.501643062f},
-std::array<float,2>{0.461735904f, 0.474615455f},
-std::array<float,2>{0.807689071f, 0.148638204f},
-std::array<float,2>{0.0520165451f, 0.899584711f},
-std::array<float,2>{0.957579494f, 0.755391836f},
-std::array<float,2>{0.226184368f, 0.117566198f},
-std::array<float,2>{0.509152532f, 0.251498044f},
-std::array<float,2>{0.33593294f, 0.647777736f},
-std::array<float,2>{0.784886301f, 0.542721033f},
-std::array<float,2>{0.0388153456f, 0.467876047f},
-std::array<float,2>{0.731979489f, 0.186998799f},
-std::array<float,2>{0.449557841f, 0.936038136f},
-std::array<float,2>{0.515633821f, 0.785397768f},
-std::array<float,2>{0.321641713f, 0.0707537234f},
-std::array<float,2>{0.948219121f, 0.286859334f},
-std::array<float,2>{0.24332501f, 0.659469247f},
-std::array<float,2>{0.687406123f, 0.723540723f},
-std::array<float,2>{0.379478335f, 0.316546172f},
-std::array<float,2>{0.825440466f, 0.00208056136f},
-std::array<float,2>{0.110388525f, 0.816179693f},
-std::array<float,2>{0.881013274f, 0.938391447f},
-std::array<float,2>{0.169779584f, 0.2284365f},
-std::array<float,2>{0.584031761f, 0.431686431f},
-std::array<float,2>{0.264028221f, 0.589553714f},
-std::array<float,2>{0.981825531f, 0.627925336f},
-std::array<float,2>{0.201488853f, 0.272304416f},
-std::array<float,2>{0.54655689f, 0.106164552f},
-std::array<float,2>{0.37305516f, 0.774152994f},
-std::array<float,2>{0.715748191f, 0.882817626f},
-std::array<float,2>{0.470831215f, 0.129562646f},
-std::array<float,2>{0.754259586f, 0.497911721f},
-std::array<float,2>{0.0158019159f, 0.518967569f},
-std::array<float,2>{0.593880713f, 0.611593962f},
-std::array<float,2>{0.291035384f, 0.405828923f},
-std::array<float,2>{0.912334502f, 0.204674691f},
-std::array<float,2>{0.127447948f, 0.992087781f},
-std::array<float,2>{0.848461986f, 0.86624527f},
-std::array<float,2>{0.0765432045f, 0.0582522862f},
-std::array<float,2>{0.636523128f, 0.371017516f},
-std::array<float,2>{0.431173205f, 0.702091277f},
-std::array<float,2>{0.945145488f, 0.525887489f},
-std::array<float,2>{0.240379974f, 0.490719199f},
-std::array<float,2>{0.527466893f, 0.139670148f},
-std::array<float,2>{0.318755805f, 0.877407372f},
-std::array<float,2>{0.719083071f, 0.771286488f},
-std::array<float,2>{0.442068815f, 0.0969276354f},
-std::array<float,2>{0.792772174f, 0.274260283f},
-std::array<float,2>{0.0461305678f, 0.633232057f},
-std::array<float,2>{0.587975442f, 0.694788456f},
-std::array<float,2>{0.250630707f, 0.360828966f},
-std::array<float,2>{0.885990024f, 0.0532426052f},
-std::array<float,2>{0.162984565f, 0.870887101f},
-std::array<float,2>{0.813867927f, 0.995556176f},
-std::array<float,2>{0.123313673f, 0.21354869f},
-std::array<float,2>{0.67862612f, 0.397112548f},
-std::array<float,2>{0.384343892f, 0.619765639f},
-std::array<float,2>{0.75883472f, 0.668174386f},
-std::array<float,2>{0.0312333424f, 0.295104116f},
-std::array<float,2>{0.709812641f, 0.0650579631f},
-std::array<float,2>{0.478763998f, 0.789731383f},
-std::array<float,2>{0.535936475f, 0.927169502f},
-std::array<float,2>{0.361430943f, 0.17371197f},
-std::array<float,2>{0.969255686f, 0.454553604f},
-std::array<float,2>{0.189683467f, 0.534820378f},
-std::array<float,2>{0.62747401f, 0.580699444f},
-std::array<float,2>{0.423143536f, 0.426843584f},
-std::array<float,2>{0.857487857f, 0.223736525f},
-std::array<float,2>{0.0663394332f, 0.950728297f},
-std::array<float,2>{0.920206487f, 0.823503733f},
-std::array<float,2>{0.138746843f, 0.0125325918f},
-std::array<float,2>{0.607698023f, 0.32039392f},
-std::array<float,2>{0.283279777f, 0.72947067f},
-std::array<float,2>{0.872967243f, 0.608520985f},
-std::array<float,2>{0.085679017f, 0.386863351f},
-std::array<float,2>{0.643186688f, 0.187943101f},
-std::array<float,2>{0.413336515f, 0.983569145f},
-std::array<float,2>{0.621061146f, 0.854796231f},
-std::array<float,2>{0.308936745f, 0.0399478674f},
-std::array<float,2>{0.927989542f, 0.354343593f},
-std::array<float,2>{0.146311328f, 0.712705076f},
-std::array<float,2>{0.692526639f, 0.649389863f},
-std::array<float,2>{0.498844385f, 0.260370404f},
-std::array<float,2>{0.777872384f, 0.111123718f},
-std::array<float,2>{0.00666345097f, 0.76405102f},
-std::array<float,2>{0.992478549f, 0.893796563f},
-std::array<float,2>{0.216654673f, 0.141297862f},
-std::array<float,2>{0.561569095f, 0.480564266f},
-std::array<float,2>{0.357743621f, 0.513505757f},
-std::array<float,2>{0.892727971f, 0.747077465f},
-std::array<float,2>{0.174566075f, 0.33091262f},
-std::array<float,2>{0.568586588f, 0.0281684473f},
-std::array<float,2>{0.270927012f, 0.840782106f},
-std::array<float,2>{0.667698324f, 0.968611777f},
-std::array<float,2>{0.400282055f, 0.243950948f},
-std::array<float,2>{0.836545527f, 0.420316517f},
-std::array<float,2>{0.10705737f, 0.56609875f},
-std::array<float,2>{0.500145733f, 0.554135919f},
-std::array<float,2>{0.340589434f, 0.440427214f},
-std::array<float,2>{0.962568879f, 0.171364367f},
-std::array<float,2>{0.228572935f, 0.912617028f},
-std::array<float,2>{0.796984255f, 0.812286258f},
-std::array<float,2>{0.0583253987f, 0.0879134685f},
-std::array<float,2>{0.737786055f, 0.306054145f},
-std::array<float,2>{0.45372653f, 0.671958268f},
-std::array<float,2>{0.914127231f, 0.505124331f},
-std::array<float,2>{0.135760665f, 0.469052732f},
-std::array<float,2>{0.602708638f, 0.155376166f},
-std::array<float,2>{0.285416126f, 0.905166566f},
-std::array<float,2>{0.631197929f, 0.753339946f},
-std::array<float,2>{0.427323848f, 0.122111812f},
-std::array<float,2>{0.855015934f, 0.254242718f},
-std::array<float,2>{0.0691898912f, 0.643849552f},
-std::array<float,2>{0.531917274f, 0.707574189f},
-std::array<float,2>{0.366735876f, 0.346684098f},
-std::array<float,2>{0.973676383f, 0.0340015702f},
-std::array<float,2>{0.19207041f, 0.847700119f},
-std::array<float,2>{0.765032232f, 0.973343968f},
-std::array<float,2>{0.025324326f, 0.196014836f},
-std::array<float,2>{0.70511061f, 0.37672025f},
-std::array<float,2>{0.481240839f, 0.594742715f},
-std::array<float,2>{0.817924976f, 0.68682009f},
-std::array<float,2>{0.121004865f, 0.301381946f},
-std::array<float,2>{0.673557401f, 0.081769757f},
-std::array<float,2>{0.389152765f, 0.801650643f},
-std::array<float,2>{0.589969754f, 0.91433835f},
-std::array<float,2>{0.256930262f, 0.163832545f},
-std::array<float,2>{0.890183389f, 0.451351225f},
-std::array<float,2>{0.15889141f, 0.558700562f},
-std::array<float,2>{0.725704253f, 0.570429623f},
-std::array<float,2>{0.43839404f, 0.412594169f},
-std::array<float,2>{0.793630302f, 0.23854816f},
-std::array<float,2>{0.0395236276f, 0.959970534f},
-std::array<float,2>{0.937604427f, 0.82903558f},
-std::array<float,2>{0.23516196f, 0.019887723f},
-std::array<float,2>{0.525940418f, 0.34311375f},
-std::array<float,2>{0.315353185f, 0.737144887f},
-std::array<float,2>{0.802532017f, 0.615781605f},
-std::array<float,2>{0.0587343723f, 0.400321305f},
-std::array<float,2>{0.740136385f, 0.208072692f},
-std::array<float,2>{0.457682967f, 0.985063434f},
-std::array<float,2>{0.505875289f, 0.861344993f},
-std::array<float,2>{0.336654663f, 0.0624842271f},
-std::array<float,2>{0.968369722f, 0.374066085f},
-std::array<float,2>{0.231594831f, 0.695710838f},
-std::array<float,2>{0.671723127f, 0.630318344f},
-std::array<float,2>{0.402760506f, 0.26948148f},
-std::array<float,2>{0.84359324f, 0.102824412f},
-std::array<float,2>{0.102772698f, 0.777540982f},
-std::array<float,2>{0.897373796f, 0.887460053f},
-std::array<float,2>{0.177623734f, 0.125308529f},
-std::array<float,2>{0.564053535f, 0.496021092f},
-std::array<float,2>{0.266165018f, 0.521701694f},
-std::array<float,2>{0.996874511f, 0.720359147f},
-std::array<float,2>{0.214165136f, 0.313047618f},
-std::array<float,2>{0.555941284f, 0.00441969093f},
-std::array<float,2>{0.354208887f, 0.819198847f},
-std::array<float,2>{0.687939048f, 0.94363755f},
-std::array<float,2>{0.493393749f, 0.231410176f},
-std::array<float,2>{0.774289429f, 0.435984552f},
-std::array<float,2>{0.00218395167f, 0.592621505f},
-std::array<float,2>{0.621260166f, 0.545738399f},
-std::array<float,2>{0.307851583f, 0.461240441f},
-std::array<float,2>{0.925692022f, 0.181468651f},
-std::array<float,2>{0.142464504f, 0.932044864f},
-std::array<float,2>{0.869058371f, 0.781838238f},
-std::array<float,2>{0.0799754709f, 0.0768267065f},
-std::array<float,2>{0.648115098f, 0.283820957f},
-std::array<float,2>{0.409319013f, 0.663714528f},
-std::array<float,2>{0.953204274f, 0.583985209f},
-std::array<float,2>{0.222396851f, 0.422333121f},
-std::array<float,2>{0.512118459f, 0.219203919f},
-std::array<float,2>{0.33137396f, 0.948053896f},
-std::array<float,2>{0.744638383f, 0.826444507f},
-std::array<float,2>{0.465903521f, 0.0102854529f},
-std::array<float,2>{0.811411977f, 0.324630827f},
-std::array<float,2>{0.0481307916f, 0.732788682f},
-std::array<float,2>{0.57423377f, 0.66668731f},
-std::array<float,2>{0.277405381f, 0.29164654f},
-std::array<float,2>{0.901545167f, 0.0690082684f},
-std::array<float,2>{0.182082057f, 0.796849251f},
-std::array<float,2>{0.828968644f, 0.924216032f},
-std::array<float,2>{0.0946378261f, 0.178575829f},
-std::array<float,2>{0.659730673f, 0.459909528f},
-std::array<float,2>{0.392794043f, 0.537865341f},
-std::array<float,2>{0.772632122f, 0.691061914f},
-std::array<float,2>{0.00959677622f, 0.366433173f},
-std::array<float,2>{0.700586438f, 0.0498855263f},
-std::array<float,2>{0.484530449f, 0.873932481f},
-std::array<float,2>{0.551613986f, 0.996671438f},
-std::array<float,2>{0.350912362f, 0.214882776f},
-std::array<float,2>{0.991553307f, 0.393155873f},
-std::array<float,2>{0.210534185f, 0.624478877f},
-std::array<float,2>{0.652528524f, 0.528622568f},
-std::array<float,2>{0.420773953f, 0.487011582f},
-std::array<float,2>{0.866912186f, 0.13293612f},
-std::array<float,2>{0.0872176215f, 0.881740749f},
-std::array<float,2>{0.936455488f, 0.768748701f},
-std::array<float,2>{0.151381135f, 0.0991311446f},
-std::array<float,2>{0.611500025f, 0.279526085f},
-std::array<float,2>{0.298703581f, 0.636859298f},
-std::array<float,2>{0.84723568f, 0.549653769f},
-std::array<float,2>{0.070549801f, 0.442015141f},
-std::array<float,2>{0.640580118f, 0.166784316f},
-std::array<float,2>{0.437128693f, 0.90820545f},
-std::array<float,2>{0.598073244f, 0.807878256f},
-std::array<float,2>{0.293029934f, 0.0919950455f},
-std::array<float,2>{0.907559931f, 0.310147583f},
-std::array<float,2>{0.130424485f, 0.67661345f},
-std::array<float,2>{0.711729288f, 0.744181395f},
-std::array<float,2>{0.474910051f, 0.334531069f},
-std::array<float,2>{0.752793312f, 0.0236099251f},
-std::array<float,2>{0.020775903f, 0.83733803f},
-std::array<float,2>{0.978275597f, 0.962803841f},
-std::array<float,2>{0.197299451f, 0.248209342f},
-std::array<float,2>{0.540738165f, 0.4165999f},
-std::array<float,2>{0.370262146f, 0.568831205f},
-std::array<float,2>{0.877564311f, 0.653750598f},
-std::array<float,2>{0.164685443f, 0.262582451f},
-std::array<float,2>{0.578284383f, 0.115604229f},
-std::array<float,2>{0.2582497f, 0.75903666f},
-std::array<float,2>{0.681230545f, 0.895593941f},
-std::array<float,2>{0.378442824f, 0.146016598f},
-std::array<float,2>{0.822538972f, 0.480198354f},
-std::array<float,2>{0.117030717f, 0.511601269f},
-std::array<float,2>{0.522544682f, 0.603432953f},
-std::array<float,2>{0.325598001f, 0.385197133f},
-std::array<float,2>{0.951857269f, 0.19323948f},
-std::array<float,2>{0.247213811f, 0.976578772f},
-std::array<float,2>{0.7884776f, 0.858947158f},
-std::array<float,2>{0.0320447497f, 0.0457405224f},
-std::array<float,2>{0.727134585f, 0.355877727f},
-std::array<float,2>{0.449042082f, 0.71563673f},
-std::array<float,2>{0.904989481f, 0.601291537f},
-std::array<float,2>{0.187301382f, 0.381174415f},
-std::array<float,2>{0.571231186f, 0.202899501f},
-std::array<float,2>{0.277275831f, 0.970377147f},
-std::array<float,2>{0.661831439f, 0.846675277f},
-std::array<float,2>{0.39627558f, 0.038994845f},
-std::array<float,2>{0.832121432f, 0.347948939f},
-std::array<float,2>{0.0999701321f, 0.704574406f},
-std::array<float,2>{0.511058331f, 0.644616544f},
-std::array<float,2>{0.332505256f, 0.253788024f},
-std::array<float,2>{0.960282862f, 0.119733982f},
-std::array<float,2>{0.22389853f, 0.755943239f},
-std::array<float,2>{0.804696798f, 0.901911378f},
-std::array<float,2>{0.0536673591f, 0.152166516f},
-std::array<float,2>{0.748121381f, 0.474243373f},
-std::array<float,2>{0.463934273f, 0.503433287f},
-std::array<float,2>{0.862610757f, 0.741369486f},
-std::array<float,2>{0.0932487026f, 0.337564141f},
-std::array<float,2>{0.651652634f, 0.0194170009f},
-std::array<float,2>{0.415112853f, 0.833272934f},
-std::array<float,2>{0.615701497f, 0.957017303f},
-std::array<float,2>{0.302977949f, 0.236067712f},
-std::array<float,2>{0.931596279f, 0.407691151f},
-std::array<float,2>{0.155182332f, 0.574650049f},
-std::array<float,2>{0.699211061f, 0.555753469f},
-std::array<float,2>{0.488645166f, 0.448948205f},
-std::array<float,2>{0.769080102f, 0.157419086f},
-std::array<float,2>{0.0127982637f, 0.919442713f},
-std::array<float,2>{0.987268269f, 0.797495842f},
-std::array<float,2>{0.203692511f, 0.0823002383f},
-std::array<float,2>{0.548080623f, 0.299327016f},
-std::array<float,2>{0.347469836f, 0.680343032f},
-std::array<float,2>{0.757619381f, 0.517216802f},
-std::array<float,2>{0.0193400588f, 0.498934329f},
-std::array<float,2>{0.717056632f, 0.132030904f},
-std::array<float,2>{0.469191551f, 0.886554718f},
-std::array<float,2>{0.543150783f, 0.776614547f},
-std::array<float,2>{0.372766167f, 0.109273337f},
-std::array<float,2>{0.98329407f, 0.27115497f},
-std::array<float,2>{0.199681416f, 0.625418663f},
-std::array<float,2>{0.633325517f, 0.699911058f},
-std::array<float,2>{0.433111787f, 0.369018078f},
-std::array<float,2>{0.850864708f, 0.055245176f},
-std::array<float,2>{0.0752737895f, 0.864735007f},
-std::array<float,2>{0.911988974f, 0.988351524f},
-std::array<float,2>{0.125012621f, 0.206330165f},
-std::array<float,2>{0.596786439f, 0.402718127f},
-std::array<float,2>{0.289266199f, 0.609883428f},
-std::array<float,2>{0.946665168f, 0.656623125f},
-std::array<float,2>{0.245770752f, 0.287540257f},
-std::array<float,2>{0.519394457f, 0.0723957866f},
-std::array<float,2>{0.323312849f, 0.788401723f},
-std::array<float,2>{0.734084129f, 0.934086561f},
-std::array<float,2>{0.452226073f, 0.184442148f},
-std::array<float,2>{0.782508433f, 0.466286987f},
-std::array<float,2>{0.0361492336f, 0.539171815f},
-std::array<float,2>{0.582681239f, 0.587031722f},
-std::array<float,2>{0.261920124f, 0.430247903f},
-std::array<float,2>{0.879299462f, 0.228836179f},
-std::array<float,2>{0.170130759f, 0.94121325f},
-std::array<float,2>{0.827578783f, 0.813406467f},
-std::array<float,2>{0.112362586f, 0.00158719649f},
-std::array<float,2>{0.684682667f, 0.319747567f},
-std::array<float,2>{0.381298274f, 0.725708723f},
-std::array<float,2>{0.971107662f, 0.531772673f},
-std::array<float,2>{0.188203409f, 0.457016855f},
-std::array<float,2>{0.537560821f, 0.174051136f},
-std::array<float,2>{0.36018461f, 0.929266691f},
-std::array<float,2>{0.707149863f, 0.791575253f},
-std::array<float,2>{0.477469146f, 0.0635831282f},
-std::array<float,2>{0.761471927f, 0.293094277f},
-std::array<float,2>{0.0289643779f, 0.670251846f},
-std::array<float,2>{0.606053293f, 0.727210045f},
-std::array<float,2>{0.281352907f, 0.323091418f},
-std::array<float,2>{0.919918656f, 0.013769255f},
-std::array<float,2>{0.137123838f, 0.82119149f},
-std::array<float,2>{0.856738985f, 0.951536179f},
-std::array<float,2>{0.0642932057f, 0.225519896f},
-std::array<float,2>{0.62517494f, 0.429250956f},
-std::array<float,2>{0.424210042f, 0.579097092f},
-std::array<float,2>{0.789339364f, 0.635991454f},
-std::array<float,2>{0.0434616208f, 0.275610417f},
-std::array<float,2>{0.721482575f, 0.0956636667f},
-std::array<float,2>{0.444516599f, 0.772492826f},
-std::array<float,2>{0.530886889f, 0.876572728f},
-std::array<float,2>{0.317762762f, 0.138396397f},
-std::array<float,2>{0.941929936f, 0.489358872f},
-std::array<float,2>{0.239285782f, 0.524685562f},
-std::array<float,2>{0.677503884f, 0.619013846f},
-std::array<float,2>{0.384810477f, 0.396454453f},
-std::array<float,2>{0.814608574f, 0.211633325f},
-std::array<float,2>{0.121583089f, 0.993653476f},
-std::array<float,2>{0.884218335f, 0.868158281f},
-std::array<float,2>{0.161059469f, 0.0512158796f},
-std::array<float,2>{0.586317837f, 0.362516552f},
-std::array<float,2>{0.25280714f, 0.691762567f},
-std::array<float,2>{0.838985741f, 0.563182354f},
-std::array<float,2>{0.107433535f, 0.418230742f},
-std::array<float,2>{0.664133489f, 0.245439157f},
-std::array<float,2>{0.401581734f, 0.965380013f},
-std::array<float,2>{0.568241715f, 0.842296958f},
-std::array<float,2>{0.27232793f, 0.030767506f},
-std::array<float,2>{0.892239392f, 0.328854978f},
-std::array<float,2>{0.172818244f, 0.749278903f},
-std::array<float,2>{0.736162007f, 0.674345255f},
-std::array<float,2>{0.456687093f, 0.307614505f},
-std::array<float,2>{0.800673425f, 0.0865382627f},
-std::array<float,2>{0.0552707016f, 0.809031785f},
-std::array<float,2>{0.964154482f, 0.910489857f},
-std::array<float,2>{0.227640688f, 0.168442026f},
-std::array<float,2>{0.50275749f, 0.437510937f},
-std::array<float,2>{0.343489081f, 0.551069915f},
-std::array<float,2>{0.926466107f, 0.713033736f},
-std::array<float,2>{0.146949977f, 0.352322251f},
-std::array<float,2>{0.617413402f, 0.041518867f},
-std::array<float,2>{0.311598182f, 0.852342546f},
-std::array<float,2>{0.641564429f, 0.980746925f},
-std::array<float,2>{0.411462307f, 0.190453142f},
-std::array<float,2>{0.873241246f, 0.390175551f},
-std::array<float,2>{0.0830428079f, 0.605989695f},
-std::array<float,2>{0.560147762f, 0.514072537f},
-std::array<float,2>{0.356224924f, 0.483386219f},
-std::array<float,2>{0.995996475f, 0.143964663f},
-std::array<float,2>{0.217640877f, 0.892331064f},
-std::array<float,2>{0.779578865f, 0.762244642f},
-std::array<float,2>{0.00528890174f, 0.111479431f},
-std::array<float,2>{0.695201159f, 0.259395182f},
-std::array<float,2>{0.496621758f, 0.650997341f},
-std::array<float,2>{0.895118952f, 0.5229491f},
-std::array<float,2>{0.179405734f, 0.494617343f},
-std::array<float,2>{0.565195739f, 0.126607791f},
-std::array<float,2>{0.267633319f, 0.888477325f},
-std::array<float,2>{0.668464839f, 0.778623164f},
-std::array<float,2>{0.405112177f, 0.101584524f},
-std::array<float,2>{0.840374172f, 0.26828599f},
-std::array<float,2>{0.103805132f, 0.629050672f},
-std::array<float,2>{0.505209267f, 0.697217107f},
-std::array<float,2>{0.338831991f, 0.373787522f},
-std::array<float,2>{0.965579689f, 0.0610514842f},
-std::array<float,2>{0.232852936f, 0.862860084f},
-std::array<float,2>{0.80343461f, 0.985417902f},
-std::array<float,2>{0.0616452806f, 0.207113788f},
-std::array<float,2>{0.741054773f, 0.399004877f},
-std::array<float,2>{0.460319132f, 0.616789162f},
-std::array<float,2>{0.869854212f, 0.662369192f},
-std::array<float,2>{0.0815178826f, 0.285029411f},
-std::array<float,2>{0.645892262f, 0.0780362859f},
-std::array<float,2>{0.406904072f, 0.782751441f},
-std::array<float,2>{0.623940051f, 0.933210433f},
-std::array<float,2>{0.305611849f, 0.180026934f},
-std::array<float,2>{0.922679782f, 0.462534368f},
-std::array<float,2>{0.142911762f, 0.54669255f},
-std::array<float,2>{0.690142274f, 0.593508422f},
-std::array<float,2>{0.49562639f, 0.436914951f},
-std::array<float,2>{0.77543807f, 0.232145876f},
-std::array<float,2>{0.000525967218f, 0.945102692f},
-std::array<float,2>{0.99914825f, 0.820043564f},
-std::array<float,2>{0.212764561f, 0.00525504909f},
-std::array<float,2>{0.557747543f, 0.314131796f},
-std::array<float,2>{0.352250576f, 0.719177186f},
-std::array<float,2>{0.76248461f, 0.593993127f},
-std::array<float,2>{0.0268711876f, 0.375056505f},
-std::array<float,2>{0.703790903f, 0.196983501f},
-std::array<float,2>{0.483418196f, 0.974595189f},
-std::array<float,2>{0.533668101f, 0.848839939f},
-std::array<float,2>{0.364792466f, 0.0345802642f},
-std::array<float,2>{0.974963069f, 0.346266389f},
-std::array<float,2>{0.1949967f, 0.708641529f},
-std::array<float,2>{0.630086005f, 0.6429497f},
-std::array<float,2>{0.428395867f, 0.255545646f},
-std::array<float,2>{0.852908194f, 0.121525101f},
-std::array<float,2>{0.0682803169f, 0.752289176f},
-std::array<float,2>{0.917491555f, 0.905635536f},
-std::array<float,2>{0.133073136f, 0.154439881f},
-std::array<float,2>{0.604022563f, 0.469765902f},
-std::array<float,2>{0.287311673f, 0.50434953f},
-std::array<float,2>{0.940365791f, 0.737763584f},
-std::array<float,2>{0.237019643f, 0.3420358f},
-std::array<float,2>{0.524909317f, 0.0210086182f},
-std::array<float,2>{0.314335912f, 0.829408109f},
-std::array<float,2>{0.722953618f, 0.959879279f},
-std::array<float,2>{0.43970716f, 0.239882231f},
-std::array<float,2>{0.795650005f, 0.413818777f},
-std::array<float,2>{0.0412262082f, 0.571457982f},
-std::array<float,2>{0.59351182f, 0.559653461f},
-std::array<float,2>{0.254880071f, 0.452465683f},
-std::array<float,2>{0.887737632f, 0.162862703f},
-std::array<float,2>{0.156976238f, 0.915263653f},
-std::array<float,2>{0.819036961f, 0.802497029f},
-std::array<float,2>{0.118849866f, 0.0803420544f},
-std::array<float,2>{0.675766945f, 0.301962376f},
-std::array<float,2>{0.387937754f, 0.686117887f},
-std::array<float,2>{0.979274035f, 0.570031881f},
-std::array<float,2>{0.196925864f, 0.41702956f},
-std::array<float,2>{0.542182088f, 0.249995977f},
-std::array<float,2>{0.367277473f, 0.961852133f},
-std::array<float,2>{0.714840829f, 0.836427748f},
-std::array<float,2>{0.47457689f, 0.0249841791f},
-std::array<float,2>{0.750567973f, 0.33502087f},
-std::array<float,2>{0.0228574723f, 0.745873094f},
-std::array<float,2>{0.600539446f, 0.676924944f},
-std::array<float,2>{0.295472115f, 0.308721364f},
-std::array<float,2>{0.908305347f, 0.0935871676f},
-std::array<float,2>{0.131830961f, 0.806797743f},
-std::array<float,2>{0.844181418f, 0.909465671f},
-std::array<float,2>{0.073371008f, 0.167233258f},
-std::array<float,2>{0.637516201f, 0.443078727f},
-std::array<float,2>{0.43408516f, 0.550032973f},
-std::array<float,2>{0.785194159f, 0.716747642f},
-std::array<float,2>{0.0345271155f, 0.356953561f},
-std::array<float,2>{0.729227841f, 0.0466961712f},
-std::array<float,2>{0.447093755f, 0.857809782f},
-std::array<float,2>{0.519631207f, 0.977968633f},
-std::array<float,2>{0.327578217f, 0.1922791f},
-std::array<float,2>{0.949937999f, 0.386587739f},
-std::array<float,2>{0.248788118f, 0.601572514f},
-std::array<float,2>{0.68221432f, 0.509925961f},
-std::array<float,2>{0.375746697f, 0.479023427f},
-std::array<float,2>{0.820679188f, 0.144867152f},
-std::array<float,2>{0.113632411f, 0.895286024f},
-std::array<float,2>{0.876451015f, 0.758506119f},
-std::array<float,2>{0.167362213f, 0.116763949f},
-std::array<float,2>{0.581134021f, 0.263014287f},
-std::array<float,2>{0.261599332f, 0.653017223f},
-std::array<float,2>{0.830609024f, 0.53894645f},
-std::array<float,2>{0.0959303528f, 0.460561424f},
-std::array<float,2>{0.657562315f, 0.179116607f},
-std::array<float,2>{0.392249018f, 0.924867094f},
-std::array<float,2>{0.576543093f, 0.795223773f},
-std::array<float,2>{0.280711889f, 0.0701342896f},
-std::array<float,2>{0.899200857f, 0.292393267f},
-std::array<float,2>{0.179717422f, 0.667935073f},
-std::array<float,2>{0.743939281f, 0.733645976f},
-std::array<float,2>{0.466986716f, 0.326032937f},
-std::array<float,2>{0.809081316f, 0.0112105468f},
-std::array<float,2>{0.050469365f, 0.827352583f},
-std::array<float,2>{0.955281675f, 0.949156702f},
-std::array<float,2>{0.219972685f, 0.220411167f},
-std::array<float,2>{0.515457332f, 0.423772842f},
-std::array<float,2>{0.328319341f, 0.585343301f},
-std::array<float,2>{0.935249686f, 0.638552845f},
-std::array<float,2>{0.14918986f, 0.280795932f},
-std::array<float,2>{0.610179961f, 0.0978816748f},
-std::array<float,2>{0.298923582f, 0.768186867f},
-std::array<float,2>{0.655365586f, 0.88196671f},
-std::array<float,2>{0.418809116f, 0.134390846f},
-std::array<float,2>{0.865034103f, 0.488157988f},
-std::array<float,2>{0.0888363048f, 0.527412355f},
-std::array<float,2>{0.554398894f, 0.623341441f},
-std::array<float,2>{0.349319249f, 0.394048542f},
-std::array<float,2>{0.989983261f, 0.216514528f},
-std::array<float,2>{0.208902285f, 0.99804014f},
-std::array<float,2>{0.770737827f, 0.874608457f},
-std::array<float,2>{0.010837839f, 0.049125202f},
-std::array<float,2>{0.702007055f, 0.365298629f},
-std::array<float,2>{0.486725956f, 0.690051436f},
-std::array<float,2>{0.913196921f, 0.610939205f},
-std::array<float,2>{0.128354564f, 0.404058814f},
-std::array<float,2>{0.595358014f, 0.205769494f},
-std::array<float,2>{0.292465031f, 0.990099609f},
-std::array<float,2>{0.635253489f, 0.864060044f},
-std::array<float,2>{0.429866433f, 0.0556859337f},
-std::array<float,2>{0.849590838f, 0.367866188f},
-std::array<float,2>{0.0779480115f, 0.700489819f},
-std::array<float,2>{0.545220196f, 0.625984967f},
-std::array<float,2>{0.374834597f, 0.26964435f},
-std::array<float,2>{0.981314659f, 0.107701391f},
-std::array<float,2>{0.202163875f, 0.775574982f},
-std::array<float,2>{0.755009651f, 0.885658205f},
-std::array<float,2>{0.0171267446f, 0.131722212f},
-std::array<float,2>{0.715910912f, 0.499702036f},
-std::array<float,2>{0.472483158f, 0.516216516f},
-std::array<float,2>{0.825032711f, 0.724624515f},
-std::array<float,2>{0.110145718f, 0.31877926f},
-std::array<float,2>{0.685616732f, 0.000374209805f},
-std::array<float,2>{0.379955143f, 0.813894331f},
-std::array<float,2>{0.585801125f, 0.939511418f},
-std::array<float,2>{0.265175492f, 0.230125293f},
-std::array<float,2>{0.882243633f, 0.431333184f},
-std::array<float,2>{0.168267742f, 0.586324215f},
-std::array<float,2>{0.730773449f, 0.54076308f},
-std::array<float,2>{0.450951457f, 0.465810448f},
-std::array<float,2>{0.783222556f, 0.185218632f},
-std::array<float,2>{0.0375969782f, 0.935027063f},
-std::array<float,2>{0.94863385f, 0.787754416f},
-std::array<float,2>{0.242273599f, 0.0734510645f},
-std::array<float,2>{0.517301321f, 0.28848359f},
-std::array<float,2>{0.320925713f, 0.65775311f},
-std::array<float,2>{0.806952238f, 0.502043784f},
-std::array<float,2>{0.0514398217f, 0.472992152f},
-std::array<float,2>{0.746996939f, 0.150858149f},
-std::array<float,2>{0.46215257f, 0.900921881f},
-std::array<float,2>{0.508660614f, 0.756953537f},
-std::array<float,2>{0.33455199f, 0.120902866f},
-std::array<float,2>{0.958677232f, 0.252643913f},
-std::array<float,2>{0.225415736f, 0.646455109f},
-std::array<float,2>{0.663915873f, 0.703410208f},
-std::array<float,2>{0.396490514f, 0.34934938f},
-std::array<float,2>{0.834381104f, 0.0374532454f},
-std::array<float,2>{0.0992886871f, 0.847361088f},
-std::array<float,2>{0.902605355f, 0.969318449f},
-std::array<float,2>{0.185225353f, 0.201883003f},
-std::array<float,2>{0.572583437f, 0.382570446f},
-std::array<float,2>{0.273614228f, 0.599692583f},
-std::array<float,2>{0.985615373f, 0.680784225f},
-std::array<float,2>{0.205352336f, 0.300080359f},
-std::array<float,2>{0.54944247f, 0.0830483213f},
-std::array<float,2>{0.343983054f, 0.798040628f},
-std::array<float,2>{0.697218418f, 0.918207645f},
-std::array<float,2>{0.491715848f, 0.156305373f},
-std::array<float,2>{0.7659868f, 0.447685003f},
-std::array<float,2>{0.0142861959f, 0.5554685f},
-std::array<float,2>{0.61492157f, 0.575440228f},
-std::array<float,2>{0.301461875f, 0.407004982f},
-std::array<float,2>{0.932053626f, 0.234642416f},
-std::array<float,2>{0.153096989f, 0.95584619f},
-std::array<float,2>{0.859490514f, 0.832583249f},
-std::array<float,2>{0.0912762657f, 0.0180931929f},
-std::array<float,2>{0.649519682f, 0.336174428f},
-std::array<float,2>{0.416116744f, 0.741176188f},
-std::array<float,2>{0.961045504f, 0.552022994f},
-std::array<float,2>{0.22973679f, 0.438621461f},
-std::array<float,2>{0.501191616f, 0.169301942f},
-std::array<float,2>{0.341429472f, 0.911723912f},
-std::array<float,2>{0.736999571f, 0.809769273f},
-std::array<float,2>{0.45499295f, 0.0869188234f},
-std::array<float,2>{0.798537493f, 0.308126032f},
-std::array<float,2>{0.0574886873f, 0.67495352f},
-std::array<float,2>{0.569811106f, 0.748893559f},
-std::array<float,2>{0.270240068f, 0.329791993f},
-std::array<float,2>{0.893671989f, 0.0300812516f},
-std::array<float,2>{0.175501689f, 0.843504012f},
-std::array<float,2>{0.837394774f, 0.966212034f},
-std::array<float,2>{0.106163487f, 0.244903728f},
-std::array<float,2>{0.666607082f, 0.419062644f},
-std::array<float,2>{0.398822278f, 0.563795328f},
-std::array<float,2>{0.778925002f, 0.651561797f},
-std::array<float,2>{0.00762038492f, 0.258237571f},
-std::array<float,2>{0.692352712f, 0.112622052f},
-std::array<float,2>{0.499438018f, 0.763186753f},
-std::array<float,2>{0.560997784f, 0.891082168f},
-std::array<float,2>{0.358720869f, 0.142633155f},
-std::array<float,2>{0.993537605f, 0.483517438f},
-std::array<float,2>{0.215261266f, 0.514884293f},
-std::array<float,2>{0.644107521f, 0.606857598f},
-std::array<float,2>{0.412947476f, 0.389062703f},
-std::array<float,2>{0.871674716f, 0.189879403f},
-std::array<float,2>{0.0843707547f, 0.981648207f},
-std::array<float,2>{0.929674029f, 0.85343039f},
-std::array<float,2>{0.145249099f, 0.0425525308f},
-std::array<float,2>{0.619479716f, 0.353203356f},
-std::array<float,2>{0.309576929f, 0.714397907f},
-std::array<float,2>{0.859163523f, 0.579384863f},
-std::array<float,2>{0.0646909103f, 0.427886873f},
-std::array<float,2>{0.628708303f, 0.226172432f},
-std::array<float,2>{0.422836572f, 0.952426791f},
-std::array<float,2>{0.608673513f, 0.821362078f},
-std::array<float,2>{0.284805864f, 0.0148163186f},
-std::array<float,2>{0.921498716f, 0.323972255f},
-std::array<float,2>{0.139807105f, 0.728198946f},
-std::array<float,2>{0.710451245f, 0.671126962f},
-std::array<float,2>{0.479516864f, 0.294695884f},
-std::array<float,2>{0.758269727f, 0.0627812073f},
-std::array<float,2>{0.0293248519f, 0.79234004f},
-std::array<float,2>{0.970016181f, 0.928184032f},
-std::array<float,2>{0.190942809f, 0.17481795f},
-std::array<float,2>{0.537045062f, 0.455616027f},
-std::array<float,2>{0.36230737f, 0.532543004f},
-std::array<float,2>{0.885354877f, 0.693156898f},
-std::array<float,2>{0.16384165f, 0.362144828f},
-std::array<float,2>{0.589191735f, 0.0521213524f},
-std::array<float,2>{0.251392305f, 0.868366241f},
-std::array<float,2>{0.679534018f, 0.992636263f},
-std::array<float,2>{0.383265197f, 0.212099046f},
-std::array<float,2>{0.812924683f, 0.394551873f},
-std::array<float,2>{0.124969393f, 0.617730141f},
-std::array<float,2>{0.528404891f, 0.524059594f},
-std::array<float,2>{0.320145369f, 0.488656849f},
-std::array<float,2>{0.94383055f, 0.137135834f},
-std::array<float,2>{0.241858259f, 0.87557447f},
-std::array<float,2>{0.791229606f, 0.772065282f},
-std::array<float,2>{0.0451246463f, 0.0942495912f},
-std::array<float,2>{0.72054249f, 0.276571184f},
-std::array<float,2>{0.442470551f, 0.634871542f},
-std::array<float,2>{0.9242118f, 0.544535577f},
-std::array<float,2>{0.141349047f, 0.463135332f},
-std::array<float,2>{0.622594893f, 0.182188883f},
-std::array<float,2>{0.306934536f, 0.930532277f},
-std::array<float,2>{0.647191644f, 0.783805728f},
-std::array<float,2>{0.40877673f, 0.0753208101f},
-std::array<float,2>{0.867376387f, 0.283146977f},
-std::array<float,2>{0.0782735422f, 0.661259532f},
-std::array<float,2>{0.55518657f, 0.72109741f},
-std::array<float,2>{0.355127245f, 0.314841241f},
-std::array<float,2>{0.997904599f, 0.00733487168f},
-std::array<float,2>{0.213484079f, 0.817822039f},
-std::array<float,2>{0.774505258f, 0.942677736f},
-std::array<float,2>{0.00387195731f, 0.232709065f},
-std::array<float,2>{0.688587129f, 0.434094548f},
-std::array<float,2>{0.49282679f, 0.591440856f},
-std::array<float,2>{0.842494071f, 0.631362796f},
-std::array<float,2>{0.102410987f, 0.267006427f},
-std::array<float,2>{0.670360446f, 0.103977047f},
-std::array<float,2>{0.404170215f, 0.780959964f},
-std::array<float,2>{0.562853098f, 0.888816655f},
-std::array<float,2>{0.266914725f, 0.128132924f},
-std::array<float,2>{0.898202956f, 0.493649215f},
-std::array<float,2>{0.176469758f, 0.521442592f},
-std::array<float,2>{0.738606155f, 0.613804102f},
-std::array<float,2>{0.45871982f, 0.401856244f},
-std::array<float,2>{0.801127732f, 0.210779145f},
-std::array<float,2>{0.0605292097f, 0.987352014f},
-std::array<float,2>{0.967008412f, 0.861133695f},
-std::array<float,2>{0.231056094f, 0.0603102334f},
-std::array<float,2>{0.507090151f, 0.371945411f},
-std::array<float,2>{0.337135673f, 0.698074102f},
-std::array<float,2>{0.794449985f, 0.574158728f},
-std::array<float,2>{0.0405487679f, 0.411123484f},
-std::array<float,2>{0.725579858f, 0.241188645f},
-std::array<float,2>{0.438937306f, 0.957855821f},
-std::array<float,2>{0.526857734f, 0.831524134f},
-std::array<float,2>{0.316390395f, 0.0224067606f},
-std::array<float,2>{0.938629389f, 0.341717958f},
-std::array<float,2>{0.23580499f, 0.735255539f},
-std::array<float,2>{0.672471464f, 0.684440613f},
-std::array<float,2>{0.389837623f, 0.303891003f},
-std::array<float,2>{0.816785336f, 0.078790836f},
-std::array<float,2>{0.120109849f, 0.802950561f},
-std::array<float,2>{0.889582574f, 0.917608917f},
-std::array<float,2>{0.15999423f, 0.160823345f},
-std::array<float,2>{0.590874612f, 0.449294448f},
-std::array<float,2>{0.256426096f, 0.562231719f},
-std::array<float,2>{0.972949982f, 0.709482074f},
-std::array<float,2>{0.192587912f, 0.344662964f},
-std::array<float,2>{0.532532215f, 0.0323195793f},
-std::array<float,2>{0.365896583f, 0.851431191f},
-std::array<float,2>{0.707010925f, 0.975228012f},
-std::array<float,2>{0.48238951f, 0.197566733f},
-std::array<float,2>{0.763905823f, 0.377500415f},
-std::array<float,2>{0.0234517306f, 0.597335756f},
-std::array<float,2>{0.602477789f, 0.50631398f},
-std::array<float,2>{0.286208123f, 0.47193101f},
-std::array<float,2>{0.9151631f, 0.15284875f},
-std::array<float,2>{0.135076702f, 0.902436376f},
-std::array<float,2>{0.854085088f, 0.751130164f},
-std::array<float,2>{0.0701375231f, 0.123542018f},
-std::array<float,2>{0.632624805f, 0.257450819f},
-std::array<float,2>{0.425881326f, 0.642127216f},
-std::array<float,2>{0.952988267f, 0.604171813f},
-std::array<float,2>{0.246150061f, 0.383326143f},
-std::array<float,2>{0.521984935f, 0.194751993f},
-std::array<float,2>{0.325058103f, 0.980228722f},
-std::array<float,2>{0.727798939f, 0.856143355f},
-std::array<float,2>{0.448183f, 0.043762546f},
-std::array<float,2>{0.787716866f, 0.358458221f},
-std::array<float,2>{0.0326423645f, 0.718029857f},
-std::array<float,2>{0.579968512f, 0.656198144f},
-std::array<float,2>{0.25952819f, 0.265289903f},
-std::array<float,2>{0.878619552f, 0.115043633f},
-std::array<float,2>{0.165169671f, 0.761357605f},
-std::array<float,2>{0.823476017f, 0.896685898f},
-std::array<float,2>{0.115484156f, 0.147403449f},
-std::array<float,2>{0.680160403f, 0.476891845f},
-std::array<float,2>{0.377482682f, 0.509490669f},
-std::array<float,2>{0.753479242f, 0.742735267f},
-std::array<float,2>{0.0195489824f, 0.332430452f},
-std::array<float,2>{0.712264895f, 0.0255315006f},
-std::array<float,2>{0.476534069f, 0.839366853f},
-std::array<float,2>{0.539736271f, 0.963544011f},
-std::array<float,2>{0.369928002f, 0.246370524f},
-std::array<float,2>{0.976883292f, 0.414494634f},
-std::array<float,2>{0.198740736f, 0.56779176f},
-std::array<float,2>{0.638797939f, 0.547722816f},
-std::array<float,2>{0.435608536f, 0.44426927f},
-std::array<float,2>{0.846187234f, 0.164454103f},
-std::array<float,2>{0.0713625401f, 0.907816827f},
-std::array<float,2>{0.907122612f, 0.805669606f},
-std::array<float,2>{0.129223078f, 0.090755254f},
-std::array<float,2>{0.599371374f, 0.312373757f},
-std::array<float,2>{0.294155359f, 0.679151893f},
-std::array<float,2>{0.865847647f, 0.529311359f},
-std::array<float,2>{0.08628463f, 0.486026496f},
-std::array<float,2>{0.654137909f, 0.135235906f},
-std::array<float,2>{0.421253681f, 0.880266964f},
-std::array<float,2>{0.612404466f, 0.767182589f},
-std::array<float,2>{0.297146648f, 0.100656092f},
-std::array<float,2>{0.936851025f, 0.279150277f},
-std::array<float,2>{0.15090318f, 0.640367091f},
-std::array<float,2>{0.700154126f, 0.688053966f},
-std::array<float,2>{0.486026675f, 0.363844901f},
-std::array<float,2>{0.771534383f, 0.0471039936f},
-std::array<float,2>{0.00813837349f, 0.871900916f},
-std::array<float,2>{0.990491748f, 0.999110579f},
-std::array<float,2>{0.20929341f, 0.217050046f},
-std::array<float,2>{0.552412152f, 0.392514139f},
-std::array<float,2>{0.349998891f, 0.622541547f},
-std::array<float,2>{0.901063681f, 0.664460421f},
-std::array<float,2>{0.183193475f, 0.28928113f},
-std::array<float,2>{0.575493753f, 0.0682541355f},
-std::array<float,2>{0.278722137f, 0.794124424f},
-std::array<float,2>{0.659008443f, 0.923303246f},
-std::array<float,2>{0.394526303f, 0.175896645f},
-std::array<float,2>{0.829293013f, 0.45892629f},
-std::array<float,2>{0.0952347443f, 0.535553873f},
-std::array<float,2>{0.513226628f, 0.583967388f},
-std::array<float,2>{0.330268681f, 0.424535334f},
-std::array<float,2>{0.954606771f, 0.221509531f},
-std::array<float,2>{0.22088562f, 0.94651401f},
-std::array<float,2>{0.811555624f, 0.82434243f},
-std::array<float,2>{0.0470418185f, 0.00791470148f},
-std::array<float,2>{0.745975554f, 0.327313781f},
-std::array<float,2>{0.464950055f, 0.730514526f},
-std::array<float,2>{0.880070329f, 0.588267148f},
-std::array<float,2>{0.171265811f, 0.43309167f},
-std::array<float,2>{0.583183944f, 0.227110893f},
-std::array<float,2>{0.263486207f, 0.939258873f},
-std::array<float,2>{0.684166729f, 0.81515491f},
-std::array<float,2>{0.382701337f, 0.00295294914f},
-std::array<float,2>{0.826400459f, 0.318240643f},
-std::array<float,2>{0.111352965f, 0.724445403f},
-std::array<float,2>{0.518347561f, 0.658377886f},
-std::array<float,2>{0.323087782f, 0.285911649f},
-std::array<float,2>{0.945797682f, 0.0715035051f},
-std::array<float,2>{0.244576231f, 0.786910713f},
-std::array<float,2>{0.781474292f, 0.937296927f},
-std::array<float,2>{0.0356506296f, 0.186137781f},
-std::array<float,2>{0.733186483f, 0.46730417f},
-std::array<float,2>{0.451970369f, 0.541416109f},
-std::array<float,2>{0.849937022f, 0.702300847f},
-std::array<float,2>{0.0744582638f, 0.369161904f},
-std::array<float,2>{0.634425879f, 0.0576001592f},
-std::array<float,2>{0.432465345f, 0.865314782f},
-std::array<float,2>{0.596478164f, 0.990339041f},
-std::array<float,2>{0.29004389f, 0.203661665f},
-std::array<float,2>{0.910585821f, 0.404608071f},
-std::array<float,2>{0.126889452f, 0.612957776f},
-std::array<float,2>{0.718637884f, 0.517653584f},
-std::array<float,2>{0.46974656f, 0.496177047f},
-std::array<float,2>{0.756544232f, 0.130125791f},
-std::array<float,2>{0.0182496812f, 0.884282351f},
-std::array<float,2>{0.983832955f, 0.774971306f},
-std::array<float,2>{0.200990185f, 0.106660105f},
-std::array<float,2>{0.544690728f, 0.273147494f},
-std::array<float,2>{0.371938974f, 0.628785253f},
-std::array<float,2>{0.7677266f, 0.55816555f},
-std::array<float,2>{0.0118089281f, 0.445683241f},
-std::array<float,2>{0.697997093f, 0.159757897f},
-std::array<float,2>{0.489689857f, 0.921623588f},
-std::array<float,2>{0.546997607f, 0.800450742f},
-std::array<float,2>{0.346390754f, 0.0852946267f},
-std::array<float,2>{0.987318575f, 0.297593623f},
-std::array<float,2>{0.204550609f, 0.682488441f},
-std::array<float,2>{0.65117979f, 0.738915563f},
-std::array<float,2>{0.414543092f, 0.339402288f},
-std::array<float,2>{0.862065434f, 0.0175586268f},
-std::array<float,2>{0.091940701f, 0.83480376f},
-std::array<float,2>{0.930372238f, 0.953628004f},
-std::array<float,2>{0.155714273f, 0.238104716f},
-std::array<float,2>{0.61714679f, 0.410147369f},
-std::array<float,2>{0.304234147f, 0.576900899f},
-std::array<float,2>{0.95941931f, 0.647075951f},
-std::array<float,2>{0.222828463f, 0.250839412f},
-std::array<float,2>{0.510481179f, 0.118290909f},
-std::array<float,2>{0.33328554f, 0.75467968f},
-std::array<float,2>{0.749054015f, 0.898545682f},
-std::array<float,2>{0.463180095f, 0.150034651f},
-std::array<float,2>{0.805695534f, 0.475750327f},
-std::array<float,2>{0.0541820526f, 0.500787914f},
-std::array<float,2>{0.571572304f, 0.598999619f},
-std::array<float,2>{0.276095927f, 0.38058576f},
-std::array<float,2>{0.905666888f, 0.200617746f},
-std::array<float,2>{0.186491728f, 0.971553981f},
-std::array<float,2>{0.833817184f, 0.84423995f},
-std::array<float,2>{0.101490669f, 0.0362381302f},
-std::array<float,2>{0.660723507f, 0.349972546f},
-std::array<float,2>{0.395137906f, 0.706036627f},
-std::array<float,2>{0.995016217f, 0.51259923f},
-std::array<float,2>{0.218733326f, 0.482092112f},
-std::array<float,2>{0.559440196f, 0.141796485f},
-std::array<float,2>{0.356755495f, 0.892790914f},
-std::array<float,2>{0.693522513f, 0.764971197f},
-std::array<float,2>{0.497156352f, 0.110165723f},
-std::array<float,2>{0.780314028f, 0.261537522f},
-std::array<float,2>{0.00397382537f, 0.649797857f},
-std::array<float,2>{0.619078994f, 0.711783171f},
-std::array<float,2>{0.311066777f, 0.355219871f},
-std::array<float,2>{0.927218318f, 0.040295288f},
-std::array<float,2>{0.147787213f, 0.853979349f},
-std::array<float,2>{0.87495172f, 0.9824332f},
-std::array<float,2>{0.0820368752f, 0.189416409f},
-std::array<float,2>{0.641923904f, 0.387969524f},
-std::array<float,2>{0.410464108f, 0.607841671f},
-std::array<float,2>{0.798850119f, 0.673062682f},
-std::array<float,2>{0.0566197187f, 0.305029243f},
-std::array<float,2>{0.734425008f, 0.0896246508f},
-std::array<float,2>{0.455956906f, 0.811499774f},
-std::array<float,2>{0.503772378f, 0.913811147f},
-std::array<float,2>{0.342413574f, 0.170438737f},
-std::array<float,2>{0.963705778f, 0.440641999f},
-std::array<float,2>{0.226870671f, 0.553290904f},
-std::array<float,2>{0.665362298f, 0.564639807f},
-std::array<float,2>{0.400999427f, 0.421427369f},
-std::array<float,2>{0.837966442f, 0.242693797f},
-std::array<float,2>{0.108966127f, 0.967559814f},
-std::array<float,2>{0.891071558f, 0.841778696f},
-std::array<float,2>{0.173154816f, 0.0283655673f},
-std::array<float,2>{0.566578388f, 0.331972629f},
-std::array<float,2>{0.273027956f, 0.746120691f},
-std::array<float,2>{0.81558603f, 0.620726764f},
-std::array<float,2>{0.122314058f, 0.397939205f},
-std::array<float,2>{0.675916076f, 0.214650631f},
-std::array<float,2>{0.386200726f, 0.994715452f},
-std::array<float,2>{0.58705318f, 0.869924903f},
-std::array<float,2>{0.253722817f, 0.0544431992f},
-std::array<float,2>{0.883663118f, 0.359394312f},
-std::array<float,2>{0.161258593f, 0.693432629f},
-std::array<float,2>{0.721930563f, 0.634370148f},
-std::array<float,2>{0.443941981f, 0.274893671f},
-std::array<float,2>{0.790739119f, 0.0959994942f},
-std::array<float,2>{0.0448931679f, 0.770129204f},
-std::array<float,2>{0.94299829f, 0.878294587f},
-std::array<float,2>{0.238951907f, 0.138917923f},
-std::array<float,2>{0.529703319f, 0.491859436f},
-std::array<float,2>{0.316729248f, 0.526597559f},
-std::array<float,2>{0.918642104f, 0.730118871f},
-std::array<float,2>{0.137916997f, 0.321957976f},
-std::array<float,2>{0.60732305f, 0.0131312506f},
-std::array<float,2>{0.282723337f, 0.822512567f},
-std::array<float,2>{0.626772165f, 0.949529648f},
-std::array<float,2>{0.425715268f, 0.222686261f},
-std::array<float,2>{0.85562098f, 0.426195383f},
-std::array<float,2>{0.0627554357f, 0.581315219f},
-std::array<float,2>{0.538902462f, 0.533709049f},
-std::array<float,2>{0.361000031f, 0.453396231f},
-std::array<float,2>{0.972405195f, 0.172212437f},
-std::array<float,2>{0.189417288f, 0.926611543f},
-std::array<float,2>{0.760324299f, 0.790269613f},
-std::array<float,2>{0.0278409906f, 0.0660603419f},
-std::array<float,2>{0.708175778f, 0.296321303f},
-std::array<float,2>{0.478433132f, 0.66980958f},
-std::array<float,2>{0.898866236f, 0.535768867f},
-std::array<float,2>{0.180241987f, 0.45849368f},
-std::array<float,2>{0.576945841f, 0.176388338f},
-std::array<float,2>{0.281183004f, 0.923809171f},
-std::array<float,2>{0.657748342f, 0.794793367f},
-std::array<float,2>{0.391692668f, 0.0678708851f},
-std::array<float,2>{0.830245316f, 0.28965953f},
-std::array<float,2>{0.0965510607f, 0.664732754f},
-std::array<float,2>{0.514841914f, 0.73126322f},
-std::array<float,2>{0.328769505f, 0.328018695f},
-std::array<float,2>{0.955829501f, 0.00865124445f},
-std::array<float,2>{0.220391259f, 0.825181842f},
-std::array<float,2>{0.809569538f, 0.947201133f},
-std::array<float,2>{0.0498086959f, 0.221089706f},
-std::array<float,2>{0.743430972f, 0.424312472f},
-std::array<float,2>{0.467686325f, 0.58335954f},
-std::array<float,2>{0.864670753f, 0.639953613f},
-std::array<float,2>{0.0880559608f, 0.278601915f},
-std::array<float,2>{0.656124234f, 0.101508766f},
-std::array<float,2>{0.418037474f, 0.766805232f},
-std::array<float,2>{0.609822989f, 0.880385399f},
-std::array<float,2>{0.299389541f, 0.135588542f},
-std::array<float,2>{0.934757233f, 0.485755086f},
-std::array<float,2>{0.148632661f, 0.52996099f},
-std::array<float,2>{0.701224506f, 0.622627974f},
-std::array<float,2>{0.487188399f, 0.391768515f},
-std::array<float,2>{0.771206081f, 0.217481807f},
-std::array<float,2>{0.0116497874f, 0.999840379f},
-std::array<float,2>{0.989578068f, 0.871272266f},
-std::array<float,2>{0.20815827f, 0.0475629903f},
-std::array<float,2>{0.553909481f, 0.363764167f},
-std::array<float,2>{0.34892422f, 0.687746167f},
-std::array<float,2>{0.750279129f, 0.568223536f},
-std::array<float,2>{0.0229610335f, 0.414761454f},
-std::array<float,2>{0.714199126f, 0.246657923f},
-std::array<float,2>{0.473941058f, 0.963352799f},
-std::array<float,2>{0.54254812f, 0.839331925f},
-std::array<float,2>{0.367802262f, 0.0263171289f},
-std::array<float,2>{0.978570998f, 0.332735509f},
-std::array<float,2>{0.196410671f, 0.742314398f},
-std::array<float,2>{0.636883557f, 0.679396331f},
-std::array<float,2>{0.433775276f, 0.311633825f},
-std::array<float,2>{0.844345093f, 0.0901129171f},
-std::array<float,2>{0.0740386322f, 0.806392491f},
-std::array<float,2>{0.908707201f, 0.907668173f},
-std::array<float,2>{0.131040752f, 0.165008172f},
-std::array<float,2>{0.600078881f, 0.443821967f},
-std::array<float,2>{0.295078754f, 0.546920061f},
-std::array<float,2>{0.949271858f, 0.718356073f},
-std::array<float,2>{0.248431817f, 0.359271586f},
-std::array<float,2>{0.520490885f, 0.0431193747f},
-std::array<float,2>{0.327661574f, 0.855897367f},
-std::array<float,2>{0.72876507f, 0.979929626f},
-std::array<float,2>{0.446403563f, 0.19504711f},
-std::array<float,2>{0.785785794f, 0.382957369f},
-std::array<float,2>{0.0351477116f, 0.603919983f},
-std::array<float,2>{0.581853032f, 0.509194195f},
-std::array<float,2>{0.260976017f, 0.477295905f},
-std::array<float,2>{0.876494706f, 0.146606594f},
-std::array<float,2>{0.167919219f, 0.897381306f},
-std::array<float,2>{0.821085811f, 0.761218071f},
-std::array<float,2>{0.11415413f, 0.114499316f},
-std::array<float,2>{0.68186605f, 0.265084863f},
-std::array<float,2>{0.375160664f, 0.655455947f},
-std::array<float,2>{0.975458682f, 0.596931219f},
-std::array<float,2>{0.194530532f, 0.377104998f},
-std::array<float,2>{0.534140408f, 0.198070034f},
-std::array<float,2>{0.364548445f, 0.974624097f},
-std::array<float,2>{0.703517914f, 0.850851059f},
-std::array<float,2>{0.484029859f, 0.0327908918f},
-std::array<float,2>{0.761843264f, 0.344004989f},
-std::array<float,2>{0.0267158896f, 0.709439218f},
-std::array<float,2>{0.603541374f, 0.64171207f},
-std::array<float,2>{0.287765443f, 0.257132947f},
-std::array<float,2>{0.917038321f, 0.123528041f},
-std::array<float,2>{0.133766308f, 0.751590431f},
-std::array<float,2>{0.853258848f, 0.903042972f},
-std::array<float,2>{0.0676468611f, 0.152425036f},
-std::array<float,2>{0.630827308f, 0.472644001f},
-std::array<float,2>{0.427953213f, 0.50665158f},
-std::array<float,2>{0.795328498f, 0.734591067f},
-std::array<float,2>{0.0419883728f, 0.340840667f},
-std::array<float,2>{0.723425508f, 0.021816073f},
-std::array<float,2>{0.440186799f, 0.831899047f},
-std::array<float,2>{0.524576962f, 0.957228899f},
-std::array<float,2>{0.313641995f, 0.240694448f},
-std::array<float,2>{0.939630508f, 0.410472363f},
-std::array<float,2>{0.236764893f, 0.573274374f},
-std::array<float,2>{0.67511034f, 0.561550379f},
-std::array<float,2>{0.388270706f, 0.450008452f},
-std::array<float,2>{0.818376005f, 0.160276145f},
-std::array<float,2>{0.118606158f, 0.917433977f},
-std::array<float,2>{0.888298512f, 0.803354979f},
-std::array<float,2>{0.15668343f, 0.0783800706f},
-std::array<float,2>{0.593157828f, 0.304528624f},
-std::array<float,2>{0.254228383f, 0.683740973f},
-std::array<float,2>{0.839877069f, 0.520869374f},
-std::array<float,2>{0.104357205f, 0.493733257f},
-std::array<float,2>{0.668067098f, 0.128521234f},
-std::array<float,2>{0.404666394f, 0.889334619f},
-std::array<float,2>{0.564760387f, 0.780399561f},
-std::array<float,2>{0.268274724f, 0.104410566f},
-std::array<float,2>{0.894846559f, 0.267555982f},
-std::array<float,2>{0.178868294f, 0.630989313f},
-std::array<float,2>{0.74032557f, 0.697266519f},
-std::array<float,2>{0.460650772f, 0.371457726f},
-std::array<float,2>{0.802748621f, 0.0597060919f},
-std::array<float,2>{0.0621273443f, 0.86076653f},
-std::array<float,2>{0.965027273f, 0.988268614f},
-std::array<float,2>{0.233158186f, 0.210320398f},
-std::array<float,2>{0.505836368f, 0.401793331f},
-std::array<float,2>{0.337904394f, 0.61331284f},
-std::array<float,2>{0.922108412f, 0.661642075f},
-std::array<float,2>{0.143367827f, 0.282307386f},
-std::array<float,2>{0.623107135f, 0.0760218799f},
-std::array<float,2>{0.304748446f, 0.78320533f},
-std::array<float,2>{0.646437049f, 0.930048525f},
-std::array<float,2>{0.406455189f, 0.181699827f},
-std::array<float,2>{0.869321704f, 0.463827282f},
-std::array<float,2>{0.0815470666f, 0.544417679f},
-std::array<float,2>{0.558236003f, 0.591209054f},
-std::array<float,2>{0.351903528f, 0.43394804f},
-std::array<float,2>{0.999912798f, 0.2330378f},
-std::array<float,2>{0.211981148f, 0.942936122f},
-std::array<float,2>{0.776022136f, 0.81828928f},
-std::array<float,2>{0.000105605934f, 0.00686652539f},
-std::array<float,2>{0.689552665f, 0.315281689f},
-std::array<float,2>{0.49555856f, 0.721556902f},
-std::array<float,2>{0.921178818f, 0.581626236f},
-std::array<float,2>{0.140301079f, 0.426666737f},
-std::array<float,2>{0.609113634f, 0.223215774f},
-std::array<float,2>{0.284663528f, 0.949981153f},
-std::array<float,2>{0.62808609f, 0.822981238f},
-std::array<float,2>{0.422023892f, 0.0135766082f},
-std::array<float,2>{0.858747721f, 0.321290314f},
-std::array<float,2>{0.0653433949f, 0.729890347f},
-std::array<float,2>{0.53651154f, 0.669069231f},
-std::array<float,2>{0.362815708f, 0.296788305f},
-std::array<float,2>{0.970390141f, 0.0656083226f},
-std::array<float,2>{0.190737918f, 0.790890038f},
-std::array<float,2>{0.758530557f, 0.925900817f},
-std::array<float,2>{0.0301700775f, 0.172776803f},
-std::array<float,2>{0.710057259f, 0.453990459f},
-std::array<float,2>{0.480393678f, 0.533635616f},
-std::array<float,2>{0.813130558f, 0.694127202f},
-std::array<float,2>{0.124144368f, 0.360275388f},
-std::array<float,2>{0.67890507f, 0.0541233569f},
-std::array<float,2>{0.383440018f, 0.869269013f},
-std::array<float,2>{0.589646339f, 0.994508266f},
-std::array<float,2>{0.251863241f, 0.213974983f},
-std::array<float,2>{0.885160327f, 0.398010939f},
-std::array<float,2>{0.163485527f, 0.620337605f},
-std::array<float,2>{0.719885409f, 0.526865661f},
-std::array<float,2>{0.442883164f, 0.491402358f},
-std::array<float,2>{0.791991293f, 0.139623821f},
-std::array<float,2>{0.045825731f, 0.878839672f},
-std::array<float,2>{0.943966269f, 0.769774318f},
-std::array<float,2>{0.241513327f, 0.0963148177f},
-std::array<float,2>{0.52921617f, 0.275297135f},
-std::array<float,2>{0.319605112f, 0.633823752f},
-std::array<float,2>{0.798326015f, 0.553113818f},
-std::array<float,2>{0.0568693615f, 0.441067964f},
-std::array<float,2>{0.736801445f, 0.169957548f},
-std::array<float,2>{0.454256326f, 0.913234651f},
-std::array<float,2>{0.501567781f, 0.810625553f},
-std::array<float,2>{0.340986073f, 0.0891262591f},
-std::array<float,2>{0.961625576f, 0.305559367f},
-std::array<float,2>{0.230294079f, 0.673520803f},
-std::array<float,2>{0.66648972f, 0.746644974f},
-std::array<float,2>{0.39931941f, 0.331267923f},
-std::array<float,2>{0.837720275f, 0.0290905684f},
-std::array<float,2>{0.105787873f, 0.841270506f},
-std::array<float,2>{0.894289255f, 0.966999829f},
-std::array<float,2>{0.174978912f, 0.242273286f},
-std::array<float,2>{0.569831192f, 0.421303481f},
-std::array<float,2>{0.269796073f, 0.565250754f},
-std::array<float,2>{0.994082689f, 0.650365114f},
-std::array<float,2>{0.215587884f, 0.260799229f},
-std::array<float,2>{0.561257362f, 0.109710969f},
-std::array<float,2>{0.359116077f, 0.765370071f},
-std::array<float,2>{0.6916309f, 0.893183887f},
-std::array<float,2>{0.499564469f, 0.142112792f},
-std::array<float,2>{0.778700829f, 0.481801569f},
-std::array<float,2>{0.00726842554f, 0.511796534f},
-std::array<float,2>{0.620047748f, 0.608239114f},
-std::array<float,2>{0.310366124f, 0.38832128f},
-std::array<float,2>{0.928714216f, 0.188719928f},
-std::array<float,2>{0.144833222f, 0.982959449f},
-std::array<float,2>{0.871121645f, 0.854229748f},
-std::array<float,2>{0.0846917257f, 0.0409915559f},
-std::array<float,2>{0.643785894f, 0.354890853f},
-std::array<float,2>{0.412405849f, 0.710973799f},
-std::array<float,2>{0.958258271f, 0.500405014f},
-std::array<float,2>{0.225028664f, 0.476294845f},
-std::array<float,2>{0.508284271f, 0.149605826f},
-std::array<float,2>{0.334025115f, 0.899193227f},
-std::array<float,2>{0.746414661f, 0.754167259f},
-std::array<float,2>{0.462662786f, 0.118912823f},
-std::array<float,2>{0.807369053f, 0.250244468f},
-std::array<float,2>{0.0510375537f, 0.646676958f},
-std::array<float,2>{0.573140204f, 0.705293655f},
-std::array<float,2>{0.274323583f, 0.350312948f},
-std::array<float,2>{0.903300166f, 0.0367213972f},
-std::array<float,2>{0.184902683f, 0.844216049f},
-std::array<float,2>{0.83489877f, 0.970786393f},
-std::array<float,2>{0.0989630297f, 0.201004326f},
-std::array<float,2>{0.663244247f, 0.37995097f},
-std::array<float,2>{0.396986842f, 0.599166811f},
-std::array<float,2>{0.76620841f, 0.682071209f},
-std::array<float,2>{0.0138941137f, 0.297053277f},
-std::array<float,2>{0.696457684f, 0.0857707709f},
-std::array<float,2>{0.491319925f, 0.799998045f},
-std::array<float,2>{0.548949718f, 0.921333969f},
-std::array<float,2>{0.344457477f, 0.159365758f},
-std::array<float,2>{0.986305833f, 0.445965916f},
-std::array<float,2>{0.206036434f, 0.557888687f},
-std::array<float,2>{0.650162518f, 0.576506376f},
-std::array<float,2>{0.416612178f, 0.40940699f},
-std::array<float,2>{0.860058427f, 0.237788931f},
-std::array<float,2>{0.0917456225f, 0.953431845f},
-std::array<float,2>{0.932143331f, 0.834019005f},
-std::array<float,2>{0.152699143f, 0.0169351678f},
-std::array<float,2>{0.614614785f, 0.339327067f},
-std::array<float,2>{0.301175684f, 0.738758326f},
-std::array<float,2>{0.848712087f, 0.612682998f},
-std::array<float,2>{0.0771634206f, 0.405261219f},
-std::array<float,2>{0.635701418f, 0.203208655f},
-std::array<float,2>{0.43053481f, 0.990828693f},
-std::array<float,2>{0.594861209f, 0.865921259f},
-std::array<float,2>{0.292630672f, 0.0569341853f},
-std::array<float,2>{0.913964033f, 0.369760692f},
-std::array<float,2>{0.128490105f, 0.703053474f},
-std::array<float,2>{0.716585159f, 0.627975166f},
-std::array<float,2>{0.47197631f, 0.272603244f},
-std::array<float,2>{0.755715132f, 0.107213467f},
-std::array<float,2>{0.016765397f, 0.774796009f},
-std::array<float,2>{0.980798423f, 0.883812547f},
-std::array<float,2>{0.202964813f, 0.130473405f},
-std::array<float,2>{0.545648754f, 0.496897668f},
-std::array<float,2>{0.374496669f, 0.518389583f},
-std::array<float,2>{0.882341385f, 0.723821938f},
-std::array<float,2>{0.16852808f, 0.317751229f},
-std::array<float,2>{0.585201859f, 0.00346539658f},
-std::array<float,2>{0.264897853f, 0.814718127f},
-std::array<float,2>{0.686301649f, 0.938801765f},
-std::array<float,2>{0.380647033f, 0.226807073f},
-std::array<float,2>{0.82467258f, 0.433277756f},
-std::array<float,2>{0.109679237f, 0.588635266f},
-std::array<float,2>{0.516644478f, 0.541750968f},
-std::array<float,2>{0.320385039f, 0.467187196f},
-std::array<float,2>{0.949095249f, 0.185733706f},
-std::array<float,2>{0.242888227f, 0.936661959f},
-std::array<float,2>{0.784012079f, 0.786222994f},
-std::array<float,2>{0.038072072f, 0.0720527545f},
-std::array<float,2>{0.731268167f, 0.285169601f},
-std::array<float,2>{0.45056209f, 0.658995032f},
-std::array<float,2>{0.93743217f, 0.528231084f},
-std::array<float,2>{0.150549665f, 0.487500191f},
-std::array<float,2>{0.613280058f, 0.133952811f},
-std::array<float,2>{0.297432065f, 0.882762849f},
-std::array<float,2>{0.653712273f, 0.767933905f},
-std::array<float,2>{0.421443969f, 0.098548919f},
-std::array<float,2>{0.865317881f, 0.28064996f},
-std::array<float,2>{0.0868895575f, 0.637815535f},
-std::array<float,2>{0.551776886f, 0.689882994f},
-std::array<float,2>{0.35050422f, 0.366084695f},
-std::array<float,2>{0.990844071f, 0.0498036668f},
-std::array<float,2>{0.209658056f, 0.874068379f},
-std::array<float,2>{0.772211134f, 0.997524679f},
-std::array<float,2>{0.00866484642f, 0.216178268f},
-std::array<float,2>{0.699675441f, 0.393588603f},
-std::array<float,2>{0.485727668f, 0.623604774f},
-std::array<float,2>{0.82976687f, 0.667003095f},
-std::array<float,2>{0.0948309228f, 0.292681366f},
-std::array<float,2>{0.658207297f, 0.0694081411f},
-std::array<float,2>{0.393613905f, 0.795602679f},
-std::array<float,2>{0.575880289f, 0.925578773f},
-std::array<float,2>{0.278850049f, 0.17941092f},
-std::array<float,2>{0.900482357f, 0.460016012f},
-std::array<float,2>{0.182663724f, 0.538143635f},
-std::array<float,2>{0.745313466f, 0.585801244f},
-std::array<float,2>{0.465768129f, 0.423097789f},
-std::array<float,2>{0.812104583f, 0.219903126f},
-std::array<float,2>{0.0474363342f, 0.948669493f},
-std::array<float,2>{0.954564333f, 0.827975392f},
-std::array<float,2>{0.221408755f, 0.011417971f},
-std::array<float,2>{0.512954652f, 0.325634599f},
-std::array<float,2>{0.330666095f, 0.734169364f},
-std::array<float,2>{0.787295163f, 0.602204502f},
-std::array<float,2>{0.0331591181f, 0.386221588f},
-std::array<float,2>{0.728130698f, 0.191819891f},
-std::array<float,2>{0.447492003f, 0.978495657f},
-std::array<float,2>{0.521684408f, 0.858091056f},
-std::array<float,2>{0.324349105f, 0.0463325903f},
-std::array<float,2>{0.952209055f, 0.356509954f},
-std::array<float,2>{0.246849284f, 0.716232657f},
-std::array<float,2>{0.6804533f, 0.652640939f},
-std::array<float,2>{0.377326459f, 0.263392627f},
-std::array<float,2>{0.824053824f, 0.116546229f},
-std::array<float,2>{0.115899891f, 0.758117616f},
-std::array<float,2>{0.878096819f, 0.894632101f},
-std::array<float,2>{0.165597051f, 0.14518632f},
-std::array<float,2>{0.579374492f, 0.478964418f},
-std::array<float,2>{0.258989483f, 0.510377288f},
-std::array<float,2>{0.977135897f, 0.745325267f},
-std::array<float,2>{0.198649749f, 0.335829794f},
-std::array<float,2>{0.539402008f, 0.0248754378f},
-std::array<float,2>{0.369477212f, 0.836346447f},
-std::array<float,2>{0.71281749f, 0.961278439f},
-std::array<float,2>{0.475766331f, 0.249068484f},
-std::array<float,2>{0.753193915f, 0.417506337f},
-std::array<float,2>{0.0204498414f, 0.569503427f},
-std::array<float,2>{0.59903425f, 0.550438523f},
-std::array<float,2>{0.294697344f, 0.442696512f},
-std::array<float,2>{0.906484067f, 0.167745739f},
-std::array<float,2>{0.129447147f, 0.909789383f},
-std::array<float,2>{0.846193671f, 0.807281554f},
-std::array<float,2>{0.0717775747f, 0.0928306207f},
-std::array<float,2>{0.639589489f, 0.309473813f},
-std::array<float,2>{0.436464936f, 0.677309573f},
-std::array<float,2>{0.93910557f, 0.572145402f},
-std::array<float,2>{0.235983655f, 0.413193733f},
-std::array<float,2>{0.526663721f, 0.239400178f},
-std::array<float,2>{0.315467f, 0.959362507f},
-std::array<float,2>{0.725085318f, 0.829671621f},
-std::array<float,2>{0.43925938f, 0.0209373366f},
-std::array<float,2>{0.793969393f, 0.342577487f},
-std::array<float,2>{0.0404016711f, 0.738127708f},
-std::array<float,2>{0.591388941f, 0.685721755f},
-std::array<float,2>{0.256059289f, 0.302506179f},
-std::array<float,2>{0.889120817f, 0.081042774f},
-std::array<float,2>{0.159482434f, 0.801894248f},
-std::array<float,2>{0.817228556f, 0.915651321f},
-std::array<float,2>{0.119384401f, 0.162467465f},
-std::array<float,2>{0.67191714f, 0.453053713f},
-std::array<float,2>{0.390403032f, 0.560472727f},
-std::array<float,2>{0.764488399f, 0.708212018f},
-std::array<float,2>{0.0240258221f, 0.345944017f},
-std::array<float,2>{0.706345379f, 0.0347676165f},
-std::array<float,2>{0.481807679f, 0.849274755f},
-std::array<float,2>{0.532808185f, 0.973784029f},
-std::array<float,2>{0.365455747f, 0.196441844f},
-std::array<float,2>{0.973201156f, 0.375790447f},
-std::array<float,2>{0.19306162f, 0.594682932f},
-std::array<float,2>{0.632238448f, 0.504703641f},
-std::array<float,2>{0.426475137f, 0.47029379f},
-std::array<float,2>{0.853573322f, 0.154950142f},
-std::array<float,2>{0.0697218254f, 0.906026125f},
-std::array<float,2>{0.915709078f, 0.752842128f},
-std::array<float,2>{0.135263652f, 0.12182758f},
-std::array<float,2>{0.601771832f, 0.255307913f},
-std::array<float,2>{0.286909163f, 0.643147171f},
-std::array<float,2>{0.868136406f, 0.546271861f},
-std::array<float,2>{0.0787496939f, 0.462226003f},
-std::array<float,2>{0.646901906f, 0.180441856f},
-std::array<float,2>{0.408579022f, 0.93301636f},
-std::array<float,2>{0.622456193f, 0.782299578f},
-std::array<float,2>{0.307210177f, 0.0774951279f},
-std::array<float,2>{0.924669266f, 0.28443718f},
-std::array<float,2>{0.140843108f, 0.662661493f},
-std::array<float,2>{0.689098477f, 0.71942848f},
-std::array<float,2>{0.492380857f, 0.313959062f},
-std::array<float,2>{0.77523917f, 0.00546145206f},
-std::array<float,2>{0.00323212193f, 0.819366038f},
-std::array<float,2>{0.997536004f, 0.94460541f},
-std::array<float,2>{0.213067904f, 0.231819034f},
-std::array<float,2>{0.554946542f, 0.437312841f},
-std::array<float,2>{0.354712307f, 0.592867076f},
-std::array<float,2>{0.897821009f, 0.629507184f},
-std::array<float,2>{0.176180303f, 0.267607898f},
-std::array<float,2>{0.563265383f, 0.102193668f},
-std::array<float,2>{0.26739952f, 0.778931797f},
-std::array<float,2>{0.670425296f, 0.887699723f},
-std::array<float,2>{0.403603792f, 0.126398757f},
-std::array<float,2>{0.842247367f, 0.495077848f},
-std::array<float,2>{0.101775795f, 0.52308017f},
-std::array<float,2>{0.507692993f, 0.616281331f},
-std::array<float,2>{0.337422609f, 0.398864269f},
-std::array<float,2>{0.967724502f, 0.207873419f},
-std::array<float,2>{0.230693877f, 0.986275434f},
-std::array<float,2>{0.801629901f, 0.862624049f},
-std::array<float,2>{0.0596567951f, 0.0609050542f},
-std::array<float,2>{0.738914073f, 0.373431414f},
-std::array<float,2>{0.458176047f, 0.696324408f},
-std::array<float,2>{0.88288033f, 0.617651463f},
-std::array<float,2>{0.161737666f, 0.395193815f},
-std::array<float,2>{0.58745724f, 0.212746292f},
-std::array<float,2>{0.253119588f, 0.992681146f},
-std::array<float,2>{0.676512599f, 0.868653417f},
-std::array<float,2>{0.386276007f, 0.0523332544f},
-std::array<float,2>{0.816364527f, 0.361521572f},
-std::array<float,2>{0.123008028f, 0.692409694f},
-std::array<float,2>{0.529823601f, 0.635625422f},
-std::array<float,2>{0.317344785f, 0.27704829f},
-std::array<float,2>{0.942640662f, 0.0937900096f},
-std::array<float,2>{0.238738894f, 0.771803141f},
-std::array<float,2>{0.790260911f, 0.875251889f},
-std::array<float,2>{0.0440116376f, 0.137406096f},
-std::array<float,2>{0.722398162f, 0.489057869f},
-std::array<float,2>{0.443750739f, 0.523568869f},
-std::array<float,2>{0.856117547f, 0.727851987f},
-std::array<float,2>{0.0634405389f, 0.323395044f},
-std::array<float,2>{0.626403749f, 0.0154327322f},
-std::array<float,2>{0.424850047f, 0.821938336f},
-std::array<float,2>{0.606521308f, 0.953103602f},
-std::array<float,2>{0.282378793f, 0.226020008f},
-std::array<float,2>{0.917991281f, 0.428396255f},
-std::array<float,2>{0.13862066f, 0.579950631f},
-std::array<float,2>{0.708940208f, 0.533032477f},
-std::array<float,2>{0.477633148f, 0.455342442f},
-std::array<float,2>{0.759944022f, 0.175345153f},
-std::array<float,2>{0.0278073382f, 0.928360045f},
-std::array<float,2>{0.9718678f, 0.792957783f},
-std::array<float,2>{0.188570142f, 0.0634562671f},
-std::array<float,2>{0.538162708f, 0.29429394f},
-std::array<float,2>{0.360823095f, 0.671584666f},
-std::array<float,2>{0.780928969f, 0.515418887f},
-std::array<float,2>{0.00482121389f, 0.484337926f},
-std::array<float,2>{0.694129348f, 0.143315911f},
-std::array<float,2>{0.49798578f, 0.891163707f},
-std::array<float,2>{0.559029579f, 0.76278615f},
-std::array<float,2>{0.357406497f, 0.112905212f},
-std::array<float,2>{0.994198322f, 0.258639306f},
-std::array<float,2>{0.218185455f, 0.652115345f},
-std::array<float,2>{0.64219743f, 0.713933945f},
-std::array<float,2>{0.410848171f, 0.352818996f},
-std::array<float,2>{0.874244034f, 0.0423323289f},
-std::array<float,2>{0.0825469494f, 0.852838933f},
-std::array<float,2>{0.927347898f, 0.981993258f},
-std::array<float,2>{0.148031712f, 0.190213323f},
-std::array<float,2>{0.618503094f, 0.389336795f},
-std::array<float,2>{0.310579628f, 0.607114315f},
-std::array<float,2>{0.963342309f, 0.675689578f},
-std::array<float,2>{0.227222458f, 0.307746977f},
-std::array<float,2>{0.503121734f, 0.0878726617f},
-std::array<float,2>{0.342281908f, 0.810293376f},
-std::array<float,2>{0.735147715f, 0.911583364f},
-std::array<float,2>{0.455210537f, 0.169433773f},
-std::array<float,2>{0.799362242f, 0.439342171f},
-std::array<float,2>{0.0559424981f, 0.5527215f},
-std::array<float,2>{0.567011297f, 0.564081669f},
-std::array<float,2>{0.272663862f, 0.419439465f},
-std::array<float,2>{0.891337335f, 0.244478002f},
-std::array<float,2>{0.173559576f, 0.966420949f},
-std::array<float,2>{0.838496804f, 0.842807531f},
-std::array<float,2>{0.108691275f, 0.029493317f},
-std::array<float,2>{0.665722072f, 0.329555869f},
-std::array<float,2>{0.400435984f, 0.748308063f},
-std::array<float,2>{0.988173068f, 0.554947436f},
-std::array<float,2>{0.20466195f, 0.447769582f},
-std::array<float,2>{0.547816038f, 0.156825244f},
-std::array<float,2>{0.345750183f, 0.918592632f},
-std::array<float,2>{0.69760257f, 0.798409402f},
-std::array<float,2>{0.490143448f, 0.0835134983f},
-std::array<float,2>{0.768453062f, 0.300582528f},
-std::array<float,2>{0.0126466341f, 0.681540906f},
-std::array<float,2>{0.616502762f, 0.740441442f},
-std::array<float,2>{0.303864747f, 0.336584806f},
-std::array<float,2>{0.929994583f, 0.0178255178f},
-std::array<float,2>{0.155867368f, 0.832455873f},
-std::array<float,2>{0.861721754f, 0.955224872f},
-std::array<float,2>{0.0925912336f, 0.235084727f},
-std::array<float,2>{0.650444865f, 0.406462401f},
-std::array<float,2>{0.414788604f, 0.575866401f},
-std::array<float,2>{0.806172252f, 0.645994842f},
-std::array<float,2>{0.0543889552f, 0.252379924f},
-std::array<float,2>{0.749614358f, 0.120131284f},
-std::array<float,2>{0.463545442f, 0.757564366f},
-std::array<float,2>{0.50998044f, 0.900776029f},
-std::array<float,2>{0.333566219f, 0.151242986f},
-std::array<float,2>{0.959505975f, 0.473614126f},
-std::array<float,2>{0.223163396f, 0.502560616f},
-std::array<float,2>{0.660410643f, 0.600424945f},
-std::array<float,2>{0.394685f, 0.381926984f},
-std::array<float,2>{0.833156765f, 0.201177061f},
-std::array<float,2>{0.100676075f, 0.968828201f},
-std::array<float,2>{0.905840576f, 0.846987724f},
-std::array<float,2>{0.185974523f, 0.0380475782f},
-std::array<float,2>{0.571957171f, 0.348685414f},
-std::array<float,2>{0.275707453f, 0.703704774f},
-std::array<float,2>{0.827083349f, 0.586447895f},
-std::array<float,2>{0.112101622f, 0.430919558f},
-std::array<float,2>{0.683806717f, 0.229856074f},
-std::array<float,2>{0.382007658f, 0.940040231f},
-std::array<float,2>{0.58384639f, 0.813973248f},
-std::array<float,2>{0.263085485f, 0.00060623209f},
-std::array<float,2>{0.88084811f, 0.319016367f},
-std::array<float,2>{0.171650171f, 0.725269198f},
-std::array<float,2>{0.732640088f, 0.657670259f},
-std::array<float,2>{0.451243013f, 0.289021105f},
-std::array<float,2>{0.782118201f, 0.0739173889f},
-std::array<float,2>{0.0351802595f, 0.787372589f},
-std::array<float,2>{0.946129143f, 0.935106874f},
-std::array<float,2>{0.244761139f, 0.184748799f},
-std::array<float,2>{0.51776278f, 0.464990765f},
-std::array<float,2>{0.32233566f, 0.540063858f},
-std::array<float,2>{0.910990298f, 0.700698316f},
-std::array<float,2>{0.126344427f, 0.367356271f},
-std::array<float,2>{0.595845342f, 0.0562632754f},
-std::array<float,2>{0.290670723f, 0.863590956f},
-std::array<float,2>{0.634203315f, 0.989725769f},
-std::array<float,2>{0.431729496f, 0.205514893f},
-std::array<float,2>{0.85041368f, 0.403526098f},
-std::array<float,2>{0.0750597566f, 0.610480785f},
-std::array<float,2>{0.544211864f, 0.515723944f},
-std::array<float,2>{0.371265531f, 0.499483705f},
-std::array<float,2>{0.983902991f, 0.131194368f},
-std::array<float,2>{0.200513273f, 0.884919286f},
-std::array<float,2>{0.756090641f, 0.775905907f},
-std::array<float,2>{0.0178735144f, 0.108393043f},
-std::array<float,2>{0.71801579f, 0.270360798f},
-std::array<float,2>{0.47044462f, 0.626922011f},
-std::array<float,2>{0.875789464f, 0.510912836f},
-std::array<float,2>{0.16689457f, 0.479675561f},
-std::array<float,2>{0.580828607f, 0.145586893f},
-std::array<float,2>{0.260278255f, 0.896086812f},
-std::array<float,2>{0.683109164f, 0.759283781f},
-std::array<float,2>{0.376167625f, 0.116122961f},
-std::array<float,2>{0.821964979f, 0.261988252f},
-std::array<float,2>{0.114449829f, 0.654243886f},
-std::array<float,2>{0.521252334f, 0.715073287f},
-std::array<float,2>{0.326950639f, 0.356293559f},
-std::array<float,2>{0.951055169f, 0.0450269952f},
-std::array<float,2>{0.249049753f, 0.858847797f},
-std::array<float,2>{0.787076294f, 0.977236867f},
-std::array<float,2>{0.033262454f, 0.192547634f},
-std::array<float,2>{0.729639888f, 0.385309696f},
-std::array<float,2>{0.445911855f, 0.602836788f},
-std::array<float,2>{0.845523775f, 0.676166415f},
-std::array<float,2>{0.0729382485f, 0.309932977f},
-std::array<float,2>{0.638150334f, 0.0923438296f},
-std::array<float,2>{0.434617341f, 0.808261216f},
-std::array<float,2>{0.600745976f, 0.909111619f},
-std::array<float,2>{0.29653725f, 0.166095167f},
-std::array<float,2>{0.909220099f, 0.44179818f},
-std::array<float,2>{0.132198155f, 0.549103916f},
-std::array<float,2>{0.71351552f, 0.569121599f},
-std::array<float,2>{0.473531634f, 0.416101962f},
-std::array<float,2>{0.751384556f, 0.248863935f},
-std::array<float,2>{0.0217538998f, 0.962253511f},
-std::array<float,2>{0.97962755f, 0.837552845f},
-std::array<float,2>{0.196282431f, 0.0243655778f},
-std::array<float,2>{0.541207612f, 0.334176719f},
-std::array<float,2>{0.368317813f, 0.745032132f},
-std::array<float,2>{0.769993126f, 0.624862075f},
-std::array<float,2>{0.0100496318f, 0.392727286f},
-std::array<float,2>{0.702985704f, 0.215389296f},
-std::array<float,2>{0.487335712f, 0.996230841f},
-std::array<float,2>{0.552747965f, 0.873221099f},
-std::array<float,2>{0.348202616f, 0.0507330969f},
-std::array<float,2>{0.988379776f, 0.366710663f},
-std::array<float,2>{0.207101077f, 0.690437317f},
-std::array<float,2>{0.654633999f, 0.637473941f},
-std::array<float,2>{0.419432729f, 0.280141771f},
-std::array<float,2>{0.863331914f, 0.0986957252f},
-std::array<float,2>{0.0894438326f, 0.769123912f},
-std::array<float,2>{0.933838129f, 0.880953133f},
-std::array<float,2>{0.150216326f, 0.133551165f},
-std::array<float,2>{0.611112535f, 0.486430883f},
-std::array<float,2>{0.300077796f, 0.529149592f},
-std::array<float,2>{0.956884921f, 0.733225942f},
-std::array<float,2>{0.218955353f, 0.324992299f},
-std::array<float,2>{0.514295161f, 0.0102240806f},
-std::array<float,2>{0.329920143f, 0.826682091f},
-std::array<float,2>{0.742899954f, 0.947557807f},
-std::array<float,2>{0.46859622f, 0.219695538f},
-std::array<float,2>{0.809740245f, 0.422517747f},
-std::array<float,2>{0.0492652133f, 0.584538281f},
-std::array<float,2>{0.57735008f, 0.537205696f},
-std::array<float,2>{0.279477119f, 0.459038377f},
-std::array<float,2>{0.89984256f, 0.178045303f},
-std::array<float,2>{0.181305185f, 0.924409389f},
-std::array<float,2>{0.831529796f, 0.796337068f},
-std::array<float,2>{0.0973735973f, 0.0683964491f},
-std::array<float,2>{0.656323552f, 0.291365653f},
-std::array<float,2>{0.391122103f, 0.666381061f},
-std::array<float,2>{0.998322845f, 0.59228313f},
-std::array<float,2>{0.211666137f, 0.436450571f},
-std::array<float,2>{0.557175517f, 0.230528772f},
-std::array<float,2>{0.353089899f, 0.943955302f},
-std::array<float,2>{0.690785587f, 0.818503916f},
-std::array<float,2>{0.494892716f, 0.00433493499f},
-std::array<float,2>{0.776447296f, 0.312665999f},
-std::array<float,2>{0.000982282218f, 0.720145285f},
-std::array<float,2>{0.624486685f, 0.663567185f},
-std::array<float,2>{0.306036741f, 0.283671111f},
-std::array<float,2>{0.9235304f, 0.0765244067f},
-std::array<float,2>{0.144121587f, 0.781589389f},
-std::array<float,2>{0.870548666f, 0.932542026f},
-std::array<float,2>{0.0805533901f, 0.180863723f},
-std::array<float,2>{0.645172238f, 0.461560845f},
-std::array<float,2>{0.407821268f, 0.54514879f},
-std::array<float,2>{0.804398179f, 0.695923746f},
-std::array<float,2>{0.0610305071f, 0.374854445f},
-std::array<float,2>{0.741969466f, 0.0617082343f},
-std::array<float,2>{0.459443629f, 0.862012386f},
-std::array<float,2>{0.504272938f, 0.984759986f},
-std::array<float,2>{0.339662731f, 0.208820924f},
-std::array<float,2>{0.966041803f, 0.399439335f},
-std::array<float,2>{0.23402302f, 0.615369141f},
-std::array<float,2>{0.668985367f, 0.522341549f},
-std::array<float,2>{0.405772895f, 0.495584339f},
-std::array<float,2>{0.84177494f, 0.125491574f},
-std::array<float,2>{0.104834653f, 0.886937439f},
-std::array<float,2>{0.896036386f, 0.77797097f},
-std::array<float,2>{0.177895203f, 0.1035055f},
-std::array<float,2>{0.566159785f, 0.268569916f},
-std::array<float,2>{0.269202352f, 0.630434215f},
-std::array<float,2>{0.819708228f, 0.55950278f},
-std::array<float,2>{0.117384717f, 0.4520621f},
-std::array<float,2>{0.674237132f, 0.163090497f},
-std::array<float,2>{0.387232572f, 0.914828598f},
-std::array<float,2>{0.592204034f, 0.801163256f},
-std::array<float,2>{0.255397737f, 0.0811670274f},
-std::array<float,2>{0.886874914f, 0.300950289f},
-std::array<float,2>{0.158175811f, 0.68702507f},
-std::array<float,2>{0.723868608f, 0.736702859f},
-std::array<float,2>{0.441041321f, 0.343354464f},
-std::array<float,2>{0.796658874f, 0.0201155748f},
-std::array<float,2>{0.0428249016f, 0.82813108f},
-std::array<float,2>{0.941142976f, 0.960606694f},
-std::array<float,2>{0.237611011f, 0.239253998f},
-std::array<float,2>{0.524404109f, 0.413020521f},
-std::array<float,2>{0.313165367f, 0.571130097f},
-std::array<float,2>{0.916345179f, 0.644153178f},
-std::array<float,2>{0.134243399f, 0.254681021f},
-std::array<float,2>{0.605010688f, 0.122675642f},
-std::array<float,2>{0.288548768f, 0.753687382f},
-std::array<float,2>{0.629108965f, 0.904558539f},
-std::array<float,2>{0.428870887f, 0.155889466f},
-std::array<float,2>{0.852308989f, 0.469674498f},
-std::array<float,2>{0.066742979f, 0.505812347f},
-std::array<float,2>{0.534431517f, 0.59554255f},
-std::array<float,2>{0.364136815f, 0.375981927f},
-std::array<float,2>{0.976071537f, 0.195656359f},
-std::array<float,2>{0.193452388f, 0.972962976f},
-std::array<float,2>{0.763515055f, 0.848212302f},
-std::array<float,2>{0.026147848f, 0.033320263f},
-std::array<float,2>{0.704550385f, 0.347314417f},
-std::array<float,2>{0.483348161f, 0.707113087f},
-std::array<float,2>{0.928581357f, 0.605856955f},
-std::array<float,2>{0.145763889f, 0.390112638f},
-std::array<float,2>{0.620389581f, 0.191318154f},
-std::array<float,2>{0.309377044f, 0.981075168f},
-std::array<float,2>{0.642905056f, 0.851763666f},
-std::array<float,2>{0.413627058f, 0.0413752049f},
-std::array<float,2>{0.872280598f, 0.351977944f},
-std::array<float,2>{0.0852195844f, 0.713754058f},
-std::array<float,2>{0.562110424f, 0.650866985f},
-std::array<float,2>{0.358111858f, 0.259028465f},
-std::array<float,2>{0.992756903f, 0.112096637f},
-std::array<float,2>{0.215972781f, 0.761739373f},
-std::array<float,2>{0.777597606f, 0.89168936f},
-std::array<float,2>{0.00624978822f, 0.144290671f},
-std::array<float,2>{0.692915976f, 0.482480586f},
-std::array<float,2>{0.498201221f, 0.514322698f},
-std::array<float,2>{0.836200118f, 0.749879241f},
-std::array<float,2>{0.106771655f, 0.328193367f},
-std::array<float,2>{0.667182565f, 0.0304874722f},
-std::array<float,2>{0.39951852f, 0.842003584f},
-std::array<float,2>{0.569023013f, 0.965306282f},
-std::array<float,2>{0.271243036f, 0.24588792f},
-std::array<float,2>{0.893306375f, 0.41864574f},
-std::array<float,2>{0.174310282f, 0.562943697f},
-std::array<float,2>{0.737835169f, 0.551447988f},
-std::array<float,2>{0.453579426f, 0.438196421f},
-std::array<float,2>{0.797656238f, 0.168907762f},
-std::array<float,2>{0.0577486083f, 0.911059797f},
-std::array<float,2>{0.962219417f, 0.809480131f},
-std::array<float,2>{0.229453743f, 0.086249955f},
-std::array<float,2>{0.500950396f, 0.307123333f},
-std::array<float,2>{0.34005782f, 0.674158275f},
-std::array<float,2>{0.792193532f, 0.524957061f},
-std::array<float,2>{0.046411287f, 0.490140378f},
-std::array<float,2>{0.719442725f, 0.137703329f},
-std::array<float,2>{0.44144088f, 0.876165152f},
-std::array<float,2>{0.527909935f, 0.772991419f},
-std::array<float,2>{0.319027066f, 0.09506955f},
-std::array<float,2>{0.944526136f, 0.27624765f},
-std::array<float,2>{0.240855157f, 0.636236668f},
-std::array<float,2>{0.67798382f, 0.692355275f},
-std::array<float,2>{0.384078532f, 0.362902075f},
-std::array<float,2>{0.814219236f, 0.0517167114f},
-std::array<float,2>{0.123961128f, 0.867191613f},
-std::array<float,2>{0.886587739f, 0.993440032f},
-std::array<float,2>{0.162326738f, 0.211049318f},
-std::array<float,2>{0.588723063f, 0.395765543f},
-std::array<float,2>{0.250208288f, 0.618180394f},
-std::array<float,2>{0.96877718f, 0.670608163f},
-std::array<float,2>{0.190405294f, 0.293618441f},
-std::array<float,2>{0.535330296f, 0.0640542358f},
-std::array<float,2>{0.361919194f, 0.791417718f},
-std::array<float,2>{0.708994448f, 0.929067552f},
-std::array<float,2>{0.479436666f, 0.174697652f},
-std::array<float,2>{0.759728193f, 0.456471086f},
-std::array<float,2>{0.030743612f, 0.531281471f},
-std::array<float,2>{0.608266115f, 0.578194976f},
-std::array<float,2>{0.283737689f, 0.42884469f},
-std::array<float,2>{0.920851529f, 0.224631384f},
-std::array<float,2>{0.13961561f, 0.951763749f},
-std::array<float,2>{0.857969344f, 0.820404828f},
-std::array<float,2>{0.0655888617f, 0.0145147452f},
-std::array<float,2>{0.627348542f, 0.322361141f},
-std::array<float,2>{0.423742115f, 0.726749539f},
-std::array<float,2>{0.947629273f, 0.540038645f},
-std::array<float,2>{0.243701324f, 0.466405421f},
-std::array<float,2>{0.516287923f, 0.183838084f},
-std::array<float,2>{0.321790844f, 0.933599055f},
-std::array<float,2>{0.73184824f, 0.788583398f},
-std::array<float,2>{0.450018317f, 0.072796464f},
-std::array<float,2>{0.78440243f, 0.288037896f},
-std::array<float,2>{0.0382675827f, 0.657133043f},
-std::array<float,2>{0.584815502f, 0.726103723f},
-std::array<float,2>{0.264505953f, 0.32012549f},
-std::array<float,2>{0.881709814f, 0.0014264324f},
-std::array<float,2>{0.169052348f, 0.812890112f},
-std::array<float,2>{0.826146841f, 0.940446377f},
-std::array<float,2>{0.111266375f, 0.229272947f},
-std::array<float,2>{0.686620772f, 0.429692864f},
-std::array<float,2>{0.379333287f, 0.587426245f},
-std::array<float,2>{0.754751563f, 0.625691891f},
-std::array<float,2>{0.0162290335f, 0.27079314f},
-std::array<float,2>{0.714927912f, 0.108475998f},
-std::array<float,2>{0.471376032f, 0.777041852f},
-std::array<float,2>{0.546332479f, 0.885945261f},
-std::array<float,2>{0.373695016f, 0.132624015f},
-std::array<float,2>{0.982083261f, 0.498114496f},
-std::array<float,2>{0.201866165f, 0.516900897f},
-std::array<float,2>{0.635756671f, 0.609660804f},
-std::array<float,2>{0.430712879f, 0.40287143f},
-std::array<float,2>{0.847827494f, 0.206967995f},
-std::array<float,2>{0.076706484f, 0.989147961f},
-std::array<float,2>{0.912998617f, 0.864794433f},
-std::array<float,2>{0.127435431f, 0.0547455959f},
-std::array<float,2>{0.594321072f, 0.368585348f},
-std::array<float,2>{0.291514456f, 0.699636698f},
-std::array<float,2>{0.860405266f, 0.574767113f},
-std::array<float,2>{0.0899180248f, 0.408076912f},
-std::array<float,2>{0.649219275f, 0.235602781f},
-std::array<float,2>{0.417014301f, 0.956251383f},
-std::array<float,2>{0.613584697f, 0.833928168f},
-std::array<float,2>{0.301951319f, 0.0187619235f},
-std::array<float,2>{0.932948887f, 0.337400287f},
-std::array<float,2>{0.153498217f, 0.741961122f},
-std::array<float,2>{0.69570154f, 0.680006504f},
-std::array<float,2>{0.490699857f, 0.299120367f},
-std::array<float,2>{0.766901433f, 0.0826844797f},
-std::array<float,2>{0.0152533166f, 0.797173142f},
-std::array<float,2>{0.985319138f, 0.919234335f},
-std::array<float,2>{0.206999183f, 0.157787189f},
-std::array<float,2>{0.549928963f, 0.448514998f},
-std::array<float,2>{0.344776958f, 0.556209326f},
-std::array<float,2>{0.903895259f, 0.704951584f},
-std::array<float,2>{0.184511423f, 0.348563015f},
-std::array<float,2>{0.573701262f, 0.038228441f},
-std::array<float,2>{0.274785519f, 0.845821619f},
-std::array<float,2>{0.662147284f, 0.970049202f},
-std::array<float,2>{0.397735536f, 0.202400059f},
-std::array<float,2>{0.835717916f, 0.381782442f},
-std::array<float,2>{0.0985127985f, 0.600977242f},
-std::array<float,2>{0.509474695f, 0.503245831f},
-std::array<float,2>{0.334991753f, 0.473842353f},
-std::array<float,2>{0.957341194f, 0.151744649f},
-std::array<float,2>{0.226073593f, 0.901489139f},
-std::array<float,2>{0.808479786f, 0.75658679f},
-std::array<float,2>{0.0523075573f, 0.119531356f},
-std::array<float,2>{0.74729377f, 0.253038287f},
-std::array<float,2>{0.461357385f, 0.645405412f},
-std::array<float,2>{0.907766163f, 0.548348844f},
-std::array<float,2>{0.130229369f, 0.444573969f},
-std::array<float,2>{0.598164558f, 0.165794089f},
-std::array<float,2>{0.293923646f, 0.906675577f},
-std::array<float,2>{0.640058696f, 0.805040598f},
-std::array<float,2>{0.436557949f, 0.0910795778f},
-std::array<float,2>{0.847118497f, 0.310962588f},
-std::array<float,2>{0.0710308775f, 0.678276896f},
-std::array<float,2>{0.540410578f, 0.743680775f},
-std::array<float,2>{0.370729715f, 0.333197981f},
-std::array<float,2>{0.977997124f, 0.0266135726f},
-std::array<float,2>{0.197764978f, 0.838044703f},
-std::array<float,2>{0.752285242f, 0.96411103f},
-std::array<float,2>{0.0213837028f, 0.247394904f},
-std::array<float,2>{0.711330533f, 0.415917575f},
-std::array<float,2>{0.475154579f, 0.567202151f},
-std::array<float,2>{0.822903991f, 0.654392242f},
-std::array<float,2>{0.116417654f, 0.263820976f},
-std::array<float,2>{0.680673242f, 0.114195324f},
-std::array<float,2>{0.378388047f, 0.759782374f},
-std::array<float,2>{0.578945339f, 0.897959232f},
-std::array<float,2>{0.258611917f, 0.148127422f},
-std::array<float,2>{0.877331078f, 0.478097886f},
-std::array<float,2>{0.164368272f, 0.508049309f},
-std::array<float,2>{0.726863801f, 0.605361283f},
-std::array<float,2>{0.448641688f, 0.384443849f},
-std::array<float,2>{0.788691521f, 0.194093958f},
-std::array<float,2>{0.0312912092f, 0.978619277f},
-std::array<float,2>{0.951236069f, 0.857326329f},
-std::array<float,2>{0.248020202f, 0.0447949506f},
-std::array<float,2>{0.523341656f, 0.357883036f},
-std::array<float,2>{0.325722873f, 0.716835678f},
-std::array<float,2>{0.811012089f, 0.582449555f},
-std::array<float,2>{0.0485801212f, 0.425608397f},
-std::array<float,2>{0.744529545f, 0.222214311f},
-std::array<float,2>{0.46643579f, 0.945766032f},
-std::array<float,2>{0.512286007f, 0.825866222f},
-std::array<float,2>{0.332020551f, 0.00932033639f},
-std::array<float,2>{0.953653336f, 0.32675308f},
-std::array<float,2>{0.221745178f, 0.732007027f},
-std::array<float,2>{0.659548938f, 0.665299118f},
-std::array<float,2>{0.393542856f, 0.290313005f},
-std::array<float,2>{0.828483999f, 0.066557765f},
-std::array<float,2>{0.0942241848f, 0.793073297f},
-std::array<float,2>{0.902098894f, 0.922324181f},
-std::array<float,2>{0.182266518f, 0.177705824f},
-std::array<float,2>{0.574915469f, 0.457877368f},
-std::array<float,2>{0.278200269f, 0.536654174f},
-std::array<float,2>{0.991717935f, 0.689162672f},
-std::array<float,2>{0.210257009f, 0.364571363f},
-std::array<float,2>{0.550902128f, 0.048641596f},
-std::array<float,2>{0.351535439f, 0.872523665f},
-std::array<float,2>{0.701111853f, 0.99865675f},
-std::array<float,2>{0.485342592f, 0.218560115f},
-std::array<float,2>{0.773426414f, 0.391361237f},
-std::array<float,2>{0.00881050155f, 0.62154299f},
-std::array<float,2>{0.612161994f, 0.530518055f},
-std::array<float,2>{0.298041821f, 0.485154539f},
-std::array<float,2>{0.935931921f, 0.136233598f},
-std::array<float,2>{0.152040988f, 0.879788756f},
-std::array<float,2>{0.866233587f, 0.766484141f},
-std::array<float,2>{0.0876002088f, 0.100580618f},
-std::array<float,2>{0.652921796f, 0.277770162f},
-std::array<float,2>{0.420221806f, 0.63924104f},
-std::array<float,2>{0.967940986f, 0.614386022f},
-std::array<float,2>{0.231971517f, 0.400504768f},
-std::array<float,2>{0.506491244f, 0.209397927f},
-std::array<float,2>{0.336321294f, 0.987229705f},
-std::array<float,2>{0.739744961f, 0.859850228f},
-std::array<float,2>{0.45728901f, 0.0588101782f},
-std::array<float,2>{0.801932633f, 0.372929364f},
-std::array<float,2>{0.0594255663f, 0.699217319f},
-std::array<float,2>{0.563791811f, 0.632412374f},
-std::array<float,2>{0.265863448f, 0.26641646f},
-std::array<float,2>{0.89692235f, 0.104616523f},
-std::array<float,2>{0.177116051f, 0.780270755f},
-std::array<float,2>{0.842851937f, 0.890502989f},
-std::array<float,2>{0.103379138f, 0.127746373f},
-std::array<float,2>{0.670957088f, 0.49227795f},
-std::array<float,2>{0.403189749f, 0.520217597f},
-std::array<float,2>{0.773442328f, 0.721747816f},
-std::array<float,2>{0.00288426387f, 0.316261232f},
-std::array<float,2>{0.68836683f, 0.00640758174f},
-std::array<float,2>{0.493871093f, 0.816764593f},
-std::array<float,2>{0.556574762f, 0.94151336f},
-std::array<float,2>{0.353666067f, 0.234263346f},
-std::array<float,2>{0.996325135f, 0.434618473f},
-std::array<float,2>{0.214816019f, 0.590524077f},
-std::array<float,2>{0.647885859f, 0.543099701f},
-std::array<float,2>{0.409687966f, 0.464775234f},
-std::array<float,2>{0.86839658f, 0.182970494f},
-std::array<float,2>{0.0792230368f, 0.931164026f},
-std::array<float,2>{0.925247848f, 0.784265518f},
-std::array<float,2>{0.141917452f, 0.0751129016f},
-std::array<float,2>{0.621691585f, 0.282209337f},
-std::array<float,2>{0.308559358f, 0.660918593f},
-std::array<float,2>{0.854573667f, 0.507738888f},
-std::array<float,2>{0.0686308295f, 0.47100845f},
-std::array<float,2>{0.631704867f, 0.153798774f},
-std::array<float,2>{0.426912457f, 0.90427357f},
-std::array<float,2>{0.603470683f, 0.750824869f},
-std::array<float,2>{0.286038697f, 0.12499173f},
-std::array<float,2>{0.914905787f, 0.256656826f},
-std::array<float,2>{0.136622459f, 0.641588867f},
-std::array<float,2>{0.705681741f, 0.710263848f},
-std::array<float,2>{0.480831474f, 0.345021695f},
-std::array<float,2>{0.765427291f, 0.0317113958f},
-std::array<float,2>{0.0248154029f, 0.849656999f},
-std::array<float,2>{0.974390805f, 0.976456106f},
-std::array<float,2>{0.191821456f, 0.198801175f},
-std::array<float,2>{0.531371772f, 0.378154606f},
-std::array<float,2>{0.366457105f, 0.596105337f},
-std::array<float,2>{0.889738083f, 0.684982896f},
-std::array<float,2>{0.158659369f, 0.302918673f},
-std::array<float,2>{0.590339899f, 0.0791254863f},
-std::array<float,2>{0.257485151f, 0.804048121f},
-std::array<float,2>{0.672944963f, 0.916219354f},
-std::array<float,2>{0.389499366f, 0.161205009f},
-std::array<float,2>{0.817458391f, 0.450352818f},
-std::array<float,2>{0.120354362f, 0.561520576f},
-std::array<float,2>{0.525856912f, 0.572517514f},
-std::array<float,2>{0.314752519f, 0.411618888f},
-std::array<float,2>{0.938394189f, 0.241764337f},
-std::array<float,2>{0.234725356f, 0.958454847f},
-std::array<float,2>{0.793222964f, 0.830528021f},
-std::array<float,2>{0.039850302f, 0.0225886442f},
-std::array<float,2>{0.726260781f, 0.34069556f},
-std::array<float,2>{0.437784642f, 0.736133397f},
-std::array<float,2>{0.891827941f, 0.565840781f},
-std::array<float,2>{0.172307745f, 0.420574695f},
-std::array<float,2>{0.56750834f, 0.243416265f},
-std::array<float,2>{0.271506518f, 0.96824789f},
-std::array<float,2>{0.66485399f, 0.839868903f},
-std::array<float,2>{0.40196985f, 0.0274004247f},
-std::array<float,2>{0.839717567f, 0.33016023f},
-std::array<float,2>{0.108108975f, 0.747823298f},
-std::array<float,2>{0.502367258f, 0.672620952f},
-std::array<float,2>{0.343095332f, 0.306340396f},
-std::array<float,2>{0.964444757f, 0.0888078362f},
-std::array<float,2>{0.22847639f, 0.811992824f},
-std::array<float,2>{0.800054133f, 0.912291944f},
-std::array<float,2>{0.0547081791f, 0.171600848f},
-std::array<float,2>{0.735658824f, 0.439468831f},
-std::array<float,2>{0.456291378f, 0.554686308f},
-std::array<float,2>{0.873790681f, 0.712372482f},
-std::array<float,2>{0.0838425905f, 0.353853762f},
-std::array<float,2>{0.640706956f, 0.0395063423f},
-std::array<float,2>{0.412059039f, 0.85514003f},
-std::array<float,2>{0.617833734f, 0.984310091f},
-std::array<float,2>{0.312041253f, 0.188475952f},
-std::array<float,2>{0.925997674f, 0.38759762f},
-std::array<float,2>{0.147292495f, 0.608945727f},
-std::array<float,2>{0.694620132f, 0.513055205f},
-std::array<float,2>{0.496265054f, 0.481397033f},
-std::array<float,2>{0.780028582f, 0.140857458f},
-std::array<float,2>{0.00584814046f, 0.894320488f},
-std::array<float,2>{0.995182335f, 0.764336526f},
-std::array<float,2>{0.216958329f, 0.110620104f},
-std::array<float,2>{0.559982836f, 0.260076702f},
-std::array<float,2>{0.355873972f, 0.64875114f},
-std::array<float,2>{0.761037111f, 0.534263909f},
-std::array<float,2>{0.0284320917f, 0.454607666f},
-std::array<float,2>{0.707705259f, 0.173117638f},
-std::array<float,2>{0.47697857f, 0.927663088f},
-std::array<float,2>{0.537673116f, 0.789476335f},
-std::array<float,2>{0.359431535f, 0.0646866038f},
-std::array<float,2>{0.971256554f, 0.295532256f},
-std::array<float,2>{0.1877058f, 0.668728888f},
-std::array<float,2>{0.625888884f, 0.728668332f},
-std::array<float,2>{0.424501538f, 0.320855558f},
-std::array<float,2>{0.857230186f, 0.0118253483f},
-std::array<float,2>{0.0637774467f, 0.82413888f},
-std::array<float,2>{0.919173598f, 0.950216889f},
-std::array<float,2>{0.137391239f, 0.224569529f},
-std::array<float,2>{0.605581462f, 0.4275662f},
-std::array<float,2>{0.282191038f, 0.58048147f},
-std::array<float,2>{0.941554248f, 0.633709192f},
-std::array<float,2>{0.239759177f, 0.273695171f},
-std::array<float,2>{0.530420005f, 0.0972952619f},
-std::array<float,2>{0.31819585f, 0.770726204f},
-std::array<float,2>{0.720954657f, 0.877716064f},
-std::array<float,2>{0.445280343f, 0.140388981f},
-std::array<float,2>{0.789693773f, 0.490778148f},
-std::array<float,2>{0.0430016033f, 0.525798917f},
-std::array<float,2>{0.586747348f, 0.619323909f},
-std::array<float,2>{0.252267331f, 0.396670967f},
-std::array<float,2>{0.884631097f, 0.212960318f},
-std::array<float,2>{0.160442248f, 0.995693684f},
-std::array<float,2>{0.815179884f, 0.870372355f},
-std::array<float,2>{0.121174313f, 0.0528402068f},
-std::array<float,2>{0.677105963f, 0.360975355f},
-std::array<float,2>{0.385392517f, 0.695244312f},
-std::array<float,2>{0.982807159f, 0.519390345f},
-std::array<float,2>{0.200089574f, 0.49728334f},
-std::array<float,2>{0.543709576f, 0.129317954f},
-std::array<float,2>{0.372348785f, 0.883589745f},
-std::array<float,2>{0.717314839f, 0.773563564f},
-std::array<float,2>{0.469682753f, 0.105708718f},
-std::array<float,2>{0.757085204f, 0.271700144f},
-std::array<float,2>{0.0187344942f, 0.627174616f},
-std::array<float,2>{0.597261131f, 0.701214612f},
-std::array<float,2>{0.289724022f, 0.370439172f},
-std::array<float,2>{0.911438167f, 0.0579067506f},
-std::array<float,2>{0.125961363f, 0.867049575f},
-std::array<float,2>{0.851287186f, 0.991567254f},
-std::array<float,2>{0.076102443f, 0.204415441f},
-std::array<float,2>{0.633109033f, 0.405739933f},
-std::array<float,2>{0.432923466f, 0.612187862f},
-std::array<float,2>{0.782729149f, 0.659716368f},
-std::array<float,2>{0.0366613902f, 0.286499947f},
-std::array<float,2>{0.733534753f, 0.0709838271f},
-std::array<float,2>{0.452679634f, 0.785809517f},
-std::array<float,2>{0.518967628f, 0.935697258f},
-std::array<float,2>{0.323987603f, 0.187198654f},
-std::array<float,2>{0.947086275f, 0.468389243f},
-std::array<float,2>{0.245300248f, 0.542211771f},
-std::array<float,2>{0.68512696f, 0.589269161f},
-std::array<float,2>{0.381596893f, 0.432267517f},
-std::array<float,2>{0.827667952f, 0.227800652f},
-std::array<float,2>{0.113005117f, 0.937579513f},
-std::array<float,2>{0.879789829f, 0.815542579f},
-std::array<float,2>{0.170716181f, 0.00286670635f},
-std::array<float,2>{0.582125962f, 0.317081451f},
-std::array<float,2>{0.262530774f, 0.723027468f},
-std::array<float,2>{0.832576394f, 0.598491669f},
-std::array<float,2>{0.100381747f, 0.379660785f},
-std::array<float,2>{0.661614418f, 0.199249133f},
-std::array<float,2>{0.395565569f, 0.97219032f},
-std::array<float,2>{0.57078737f, 0.844964921f},
-std::array<float,2>{0.276528776f, 0.0352365039f},
-std::array<float,2>{0.904546022f, 0.351301014f},
-std::array<float,2>{0.186922818f, 0.706085324f},
-std::array<float,2>{0.748811543f, 0.648043215f},
-std::array<float,2>{0.464785874f, 0.251054764f},
-std::array<float,2>{0.805583596f, 0.118017226f},
-std::array<float,2>{0.0530631989f, 0.755004466f},
-std::array<float,2>{0.96056813f, 0.900315344f},
-std::array<float,2>{0.22435081f, 0.149008512f},
-std::array<float,2>{0.511356115f, 0.475097924f},
-std::array<float,2>{0.332863331f, 0.501064599f},
-std::array<float,2>{0.930671751f, 0.739528418f},
-std::array<float,2>{0.154607624f, 0.337932765f},
-std::array<float,2>{0.616106212f, 0.0159916803f},
-std::array<float,2>{0.303263426f, 0.835507154f},
-std::array<float,2>{0.651963949f, 0.954949737f},
-std::array<float,2>{0.415798903f, 0.237010852f},
-std::array<float,2>{0.863278449f, 0.408347279f},
-std::array<float,2>{0.093419008f, 0.577333331f},
-std::array<float,2>{0.5486902f, 0.557442844f},
-std::array<float,2>{0.346775889f, 0.44700411f},
-std::array<float,2>{0.986329436f, 0.158521324f},
-std::array<float,2>{0.203410015f, 0.919986486f},
-std::array<float,2>{0.768859684f, 0.799475849f},
-std::array<float,2>{0.0134449909f, 0.0848229453f},
-std::array<float,2>{0.698722005f, 0.2986013f},
-std::array<float,2>{0.488782287f, 0.682895958f}}
\ No newline at end of file
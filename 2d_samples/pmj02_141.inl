@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.13143988f, 0.797164023f},
-std::array<float,2>{0.72225529f, 0.0619326495f},
-std::array<float,2>{0.814863086f, 0.531561673f},
-std::array<float,2>{0.292635769f, 0.338211179f},
-std::array<float,2>{0.437678576f, 0.635562718f},
-std::array<float,2>{0.904856026f, 0.406215489f},
-std::array<float,2>{0.55886507f, 0.926536083f},
-std::array<float,2>{0.0576748513f, 0.207526848f},
-std::array<float,2>{0.342691869f, 0.947164834f},
-std::array<float,2>{0.766195536f, 0.12542221f},
-std::array<float,2>{0.646977246f, 0.723565102f},
-std::array<float,2>{0.225536987f, 0.478075355f},
-std::array<float,2>{0.113321654f, 0.619465828f},
-std::array<float,2>{0.616445005f, 0.266505837f},
-std::array<float,2>{0.991258204f, 0.847399414f},
-std::array<float,2>{0.429015845f, 0.0859222263f},
-std::array<float,2>{0.029202126f, 0.875023663f},
-std::array<float,2>{0.518934608f, 0.233870924f},
-std::array<float,2>{0.933899581f, 0.681758046f},
-std::array<float,2>{0.473309696f, 0.40989992f},
-std::array<float,2>{0.273472041f, 0.522907376f},
-std::array<float,2>{0.859967113f, 0.350431234f},
-std::array<float,2>{0.702101529f, 0.780192733f},
-std::array<float,2>{0.158333346f, 0.0146469455f},
-std::array<float,2>{0.394759923f, 0.841809213f},
-std::array<float,2>{0.965046942f, 0.0937920511f},
-std::array<float,2>{0.566750824f, 0.585831583f},
-std::array<float,2>{0.083294712f, 0.296875507f},
-std::array<float,2>{0.193534076f, 0.714031279f},
-std::array<float,2>{0.681846559f, 0.460047275f},
-std::array<float,2>{0.800910652f, 0.997583687f},
-std::array<float,2>{0.364794254f, 0.172232121f},
-std::array<float,2>{0.244604498f, 0.977044642f},
-std::array<float,2>{0.628034592f, 0.167692229f},
-std::array<float,2>{0.759243429f, 0.695553362f},
-std::array<float,2>{0.326354057f, 0.438189566f},
-std::array<float,2>{0.408021599f, 0.571319461f},
-std::array<float,2>{0.977195799f, 0.293446928f},
-std::array<float,2>{0.598314106f, 0.81452173f},
-std::array<float,2>{0.0950551555f, 0.114858449f},
-std::array<float,2>{0.302055478f, 0.751938403f},
-std::array<float,2>{0.842270195f, 0.0164590329f},
-std::array<float,2>{0.736741483f, 0.513110816f},
-std::array<float,2>{0.143012866f, 0.373765081f},
-std::array<float,2>{0.0377851203f, 0.666474104f},
-std::array<float,2>{0.53813839f, 0.432018757f},
-std::array<float,2>{0.884189427f, 0.901998878f},
-std::array<float,2>{0.467060834f, 0.243498623f},
-std::array<float,2>{0.0748653114f, 0.874266982f},
-std::array<float,2>{0.582391143f, 0.0682881102f},
-std::array<float,2>{0.951499164f, 0.603206396f},
-std::array<float,2>{0.387552172f, 0.262533069f},
-std::array<float,2>{0.355559081f, 0.735330939f},
-std::array<float,2>{0.790024996f, 0.498673648f},
-std::array<float,2>{0.665469646f, 0.95608139f},
-std::array<float,2>{0.20523265f, 0.145604551f},
-std::array<float,2>{0.491384178f, 0.91930902f},
-std::array<float,2>{0.906283498f, 0.202037618f},
-std::array<float,2>{0.514432847f, 0.655047894f},
-std::array<float,2>{0.0058422708f, 0.376196593f},
-std::array<float,2>{0.181832775f, 0.555304885f},
-std::array<float,2>{0.716690004f, 0.317184627f},
-std::array<float,2>{0.850074351f, 0.783198178f},
-std::array<float,2>{0.262620986f, 0.0411400162f},
-std::array<float,2>{0.211145476f, 0.822360575f},
-std::array<float,2>{0.657788754f, 0.123626366f},
-std::array<float,2>{0.783829093f, 0.569156826f},
-std::array<float,2>{0.344467491f, 0.287047923f},
-std::array<float,2>{0.377764344f, 0.687661171f},
-std::array<float,2>{0.940788031f, 0.449007839f},
-std::array<float,2>{0.591636062f, 0.970604777f},
-std::array<float,2>{0.0688754916f, 0.156538248f},
-std::array<float,2>{0.250695556f, 0.8954162f},
-std::array<float,2>{0.855676353f, 0.237491116f},
-std::array<float,2>{0.708106518f, 0.662625849f},
-std::array<float,2>{0.176999375f, 0.422376841f},
-std::array<float,2>{0.0134486454f, 0.500134349f},
-std::array<float,2>{0.506180167f, 0.360455334f},
-std::array<float,2>{0.917034864f, 0.765033364f},
-std::array<float,2>{0.498729855f, 0.0266742744f},
-std::array<float,2>{0.103664666f, 0.96188271f},
-std::array<float,2>{0.601874709f, 0.150490075f},
-std::array<float,2>{0.976529777f, 0.74590677f},
-std::array<float,2>{0.416068226f, 0.488845676f},
-std::array<float,2>{0.316761643f, 0.594082475f},
-std::array<float,2>{0.754963636f, 0.253406852f},
-std::array<float,2>{0.635013223f, 0.866460323f},
-std::array<float,2>{0.235083967f, 0.073568441f},
-std::array<float,2>{0.459631115f, 0.794880211f},
-std::array<float,2>{0.877962232f, 0.0373729505f},
-std::array<float,2>{0.5422014f, 0.551240265f},
-std::array<float,2>{0.0395223387f, 0.325952411f},
-std::array<float,2>{0.155461028f, 0.644103646f},
-std::array<float,2>{0.748128831f, 0.385234773f},
-std::array<float,2>{0.833841741f, 0.914030552f},
-std::array<float,2>{0.306534261f, 0.195169568f},
-std::array<float,2>{0.164487168f, 0.934500217f},
-std::array<float,2>{0.691325724f, 0.211646229f},
-std::array<float,2>{0.867630482f, 0.632719994f},
-std::array<float,2>{0.273190975f, 0.394843102f},
-std::array<float,2>{0.480071306f, 0.54383564f},
-std::array<float,2>{0.928816199f, 0.33421731f},
-std::array<float,2>{0.527055085f, 0.807389915f},
-std::array<float,2>{0.0229733195f, 0.0475989804f},
-std::array<float,2>{0.37472564f, 0.857996941f},
-std::array<float,2>{0.809190035f, 0.0870083198f},
-std::array<float,2>{0.673477471f, 0.61482656f},
-std::array<float,2>{0.19808358f, 0.273844302f},
-std::array<float,2>{0.0904182345f, 0.730458856f},
-std::array<float,2>{0.574019849f, 0.472110629f},
-std::array<float,2>{0.953698039f, 0.943482161f},
-std::array<float,2>{0.400095463f, 0.132837057f},
-std::array<float,2>{0.0515815392f, 0.768790185f},
-std::array<float,2>{0.551038384f, 0.00308207609f},
-std::array<float,2>{0.893463194f, 0.530331135f},
-std::array<float,2>{0.450298071f, 0.352317423f},
-std::array<float,2>{0.285051674f, 0.673405349f},
-std::array<float,2>{0.826079071f, 0.416324019f},
-std::array<float,2>{0.729335129f, 0.88552624f},
-std::array<float,2>{0.13453415f, 0.221163899f},
-std::array<float,2>{0.432600617f, 0.990501761f},
-std::array<float,2>{0.995177269f, 0.185938001f},
-std::array<float,2>{0.624064207f, 0.704516947f},
-std::array<float,2>{0.118748501f, 0.464537948f},
-std::array<float,2>{0.233464256f, 0.587688744f},
-std::array<float,2>{0.649872184f, 0.310905457f},
-std::array<float,2>{0.777396739f, 0.829706907f},
-std::array<float,2>{0.334994197f, 0.109369196f},
-std::array<float,2>{0.219577432f, 0.759385109f},
-std::array<float,2>{0.641647995f, 0.0280721504f},
-std::array<float,2>{0.772025883f, 0.504892766f},
-std::array<float,2>{0.339730948f, 0.365157217f},
-std::array<float,2>{0.423588276f, 0.657562673f},
-std::array<float,2>{0.987758219f, 0.428005695f},
-std::array<float,2>{0.611995101f, 0.890644908f},
-std::array<float,2>{0.110133059f, 0.238833025f},
-std::array<float,2>{0.295097113f, 0.974237442f},
-std::array<float,2>{0.817535937f, 0.16079843f},
-std::array<float,2>{0.723054767f, 0.692495346f},
-std::array<float,2>{0.127450481f, 0.451472938f},
-std::array<float,2>{0.0589009859f, 0.565516293f},
-std::array<float,2>{0.554775536f, 0.284282446f},
-std::array<float,2>{0.902280629f, 0.827139854f},
-std::array<float,2>{0.443653852f, 0.120858245f},
-std::array<float,2>{0.0785807818f, 0.906986058f},
-std::array<float,2>{0.56283468f, 0.190755472f},
-std::array<float,2>{0.962331891f, 0.646440268f},
-std::array<float,2>{0.391837597f, 0.387908846f},
-std::array<float,2>{0.359888315f, 0.547308505f},
-std::array<float,2>{0.798710525f, 0.324017137f},
-std::array<float,2>{0.686547339f, 0.791226387f},
-std::array<float,2>{0.18863529f, 0.0315492004f},
-std::array<float,2>{0.472027332f, 0.861720979f},
-std::array<float,2>{0.932056546f, 0.0760967582f},
-std::array<float,2>{0.522261262f, 0.600685358f},
-std::array<float,2>{0.0236343462f, 0.255863219f},
-std::array<float,2>{0.162961617f, 0.749493778f},
-std::array<float,2>{0.698506117f, 0.485807449f},
-std::array<float,2>{0.863770664f, 0.968082547f},
-std::array<float,2>{0.279526442f, 0.153520867f},
-std::array<float,2>{0.147803083f, 0.939709842f},
-std::array<float,2>{0.741846025f, 0.138598815f},
-std::array<float,2>{0.836607635f, 0.730921626f},
-std::array<float,2>{0.299702018f, 0.476126939f},
-std::array<float,2>{0.463597506f, 0.612097025f},
-std::array<float,2>{0.889966667f, 0.278902471f},
-std::array<float,2>{0.533286154f, 0.854193807f},
-std::array<float,2>{0.031975951f, 0.0915270746f},
-std::array<float,2>{0.323324203f, 0.809646904f},
-std::array<float,2>{0.764715374f, 0.0531402603f},
-std::array<float,2>{0.632385671f, 0.542238533f},
-std::array<float,2>{0.247364134f, 0.329723805f},
-std::array<float,2>{0.100583829f, 0.628539026f},
-std::array<float,2>{0.594996631f, 0.394305438f},
-std::array<float,2>{0.983630776f, 0.930945456f},
-std::array<float,2>{0.412525594f, 0.217618123f},
-std::array<float,2>{0.00284873601f, 0.833573461f},
-std::array<float,2>{0.511153281f, 0.102279566f},
-std::array<float,2>{0.913110673f, 0.593547642f},
-std::array<float,2>{0.485857278f, 0.305713743f},
-std::array<float,2>{0.258696944f, 0.708125949f},
-std::array<float,2>{0.847005486f, 0.465354472f},
-std::array<float,2>{0.714363873f, 0.987828016f},
-std::array<float,2>{0.185179397f, 0.183004096f},
-std::array<float,2>{0.384404451f, 0.889820695f},
-std::array<float,2>{0.946935594f, 0.223701373f},
-std::array<float,2>{0.580444098f, 0.678305507f},
-std::array<float,2>{0.0716202706f, 0.421706349f},
-std::array<float,2>{0.209589541f, 0.525560856f},
-std::array<float,2>{0.6699875f, 0.357997209f},
-std::array<float,2>{0.795660555f, 0.770557284f},
-std::array<float,2>{0.354582876f, 0.00409921585f},
-std::array<float,2>{0.174611241f, 0.85019362f},
-std::array<float,2>{0.705474555f, 0.0811468884f},
-std::array<float,2>{0.853081167f, 0.624706626f},
-std::array<float,2>{0.255828679f, 0.270458043f},
-std::array<float,2>{0.495979846f, 0.719157815f},
-std::array<float,2>{0.92107296f, 0.482895225f},
-std::array<float,2>{0.500464678f, 0.950551808f},
-std::array<float,2>{0.00896381773f, 0.132645667f},
-std::array<float,2>{0.351562411f, 0.923789918f},
-std::array<float,2>{0.786479175f, 0.204543203f},
-std::array<float,2>{0.663525581f, 0.63760972f},
-std::array<float,2>{0.215067446f, 0.400471419f},
-std::array<float,2>{0.0640833005f, 0.538414359f},
-std::array<float,2>{0.587033868f, 0.341263711f},
-std::array<float,2>{0.942273319f, 0.804348826f},
-std::array<float,2>{0.380303949f, 0.0548493341f},
-std::array<float,2>{0.0448293872f, 0.995602012f},
-std::array<float,2>{0.546752334f, 0.178879932f},
-std::array<float,2>{0.882654846f, 0.716112018f},
-std::array<float,2>{0.45544225f, 0.456166714f},
-std::array<float,2>{0.310720682f, 0.579597533f},
-std::array<float,2>{0.829774559f, 0.301899642f},
-std::array<float,2>{0.745328784f, 0.83769685f},
-std::array<float,2>{0.151655078f, 0.100351542f},
-std::array<float,2>{0.418693513f, 0.775963902f},
-std::array<float,2>{0.971562922f, 0.00874926802f},
-std::array<float,2>{0.60902369f, 0.518542707f},
-std::array<float,2>{0.107747242f, 0.344189495f},
-std::array<float,2>{0.241400957f, 0.685722291f},
-std::array<float,2>{0.639395893f, 0.413280129f},
-std::array<float,2>{0.751171768f, 0.881450355f},
-std::array<float,2>{0.312867433f, 0.228425413f},
-std::array<float,2>{0.202122867f, 0.904448628f},
-std::array<float,2>{0.67687577f, 0.247449234f},
-std::array<float,2>{0.80521071f, 0.670275807f},
-std::array<float,2>{0.367207766f, 0.435686499f},
-std::array<float,2>{0.405875117f, 0.510408938f},
-std::array<float,2>{0.958365977f, 0.369364738f},
-std::array<float,2>{0.57777226f, 0.753956199f},
-std::array<float,2>{0.087573573f, 0.0231550299f},
-std::array<float,2>{0.266717643f, 0.819846988f},
-std::array<float,2>{0.872388184f, 0.112856716f},
-std::array<float,2>{0.69502008f, 0.574725568f},
-std::array<float,2>{0.169478968f, 0.290235817f},
-std::array<float,2>{0.0181114804f, 0.701518714f},
-std::array<float,2>{0.529439569f, 0.44430083f},
-std::array<float,2>{0.924638689f, 0.982015789f},
-std::array<float,2>{0.481613457f, 0.168584034f},
-std::array<float,2>{0.123074628f, 0.787855566f},
-std::array<float,2>{0.618329763f, 0.0447233208f},
-std::array<float,2>{0.99826014f, 0.560661793f},
-std::array<float,2>{0.433826119f, 0.314504355f},
-std::array<float,2>{0.331944644f, 0.649374127f},
-std::array<float,2>{0.77394557f, 0.381173313f},
-std::array<float,2>{0.652763367f, 0.915399909f},
-std::array<float,2>{0.230190381f, 0.195918024f},
-std::array<float,2>{0.445620209f, 0.960532427f},
-std::array<float,2>{0.896934628f, 0.141592577f},
-std::array<float,2>{0.550023377f, 0.741165638f},
-std::array<float,2>{0.0506691001f, 0.492430866f},
-std::array<float,2>{0.137298495f, 0.608094871f},
-std::array<float,2>{0.730873406f, 0.259317845f},
-std::array<float,2>{0.820653915f, 0.870483518f},
-std::array<float,2>{0.288609594f, 0.063908793f},
-std::array<float,2>{0.157011881f, 0.779272139f},
-std::array<float,2>{0.699818671f, 0.0122728683f},
-std::array<float,2>{0.861427903f, 0.520516098f},
-std::array<float,2>{0.276852757f, 0.348086536f},
-std::array<float,2>{0.475373834f, 0.67989409f},
-std::array<float,2>{0.936888993f, 0.406850934f},
-std::array<float,2>{0.517542839f, 0.877410889f},
-std::array<float,2>{0.0296915043f, 0.230761796f},
-std::array<float,2>{0.366107434f, 0.999575913f},
-std::array<float,2>{0.803456187f, 0.174742833f},
-std::array<float,2>{0.681287467f, 0.712172747f},
-std::array<float,2>{0.192784414f, 0.458934635f},
-std::array<float,2>{0.0852487385f, 0.583600044f},
-std::array<float,2>{0.569332004f, 0.299069375f},
-std::array<float,2>{0.968472898f, 0.840890765f},
-std::array<float,2>{0.397907555f, 0.09597864f},
-std::array<float,2>{0.0565369129f, 0.92926693f},
-std::array<float,2>{0.56143856f, 0.210620016f},
-std::array<float,2>{0.902413368f, 0.633215547f},
-std::array<float,2>{0.439946979f, 0.402855426f},
-std::array<float,2>{0.290762037f, 0.535147309f},
-std::array<float,2>{0.814166963f, 0.337311119f},
-std::array<float,2>{0.719829679f, 0.800089419f},
-std::array<float,2>{0.129876167f, 0.05997492f},
-std::array<float,2>{0.426954269f, 0.844632328f},
-std::array<float,2>{0.990171194f, 0.0827840045f},
-std::array<float,2>{0.615002275f, 0.617261231f},
-std::array<float,2>{0.117133364f, 0.268176168f},
-std::array<float,2>{0.224105805f, 0.725560427f},
-std::array<float,2>{0.6446805f, 0.480284214f},
-std::array<float,2>{0.768678606f, 0.947789669f},
-std::array<float,2>{0.340138257f, 0.128560543f},
-std::array<float,2>{0.20353514f, 0.954159319f},
-std::array<float,2>{0.667378545f, 0.148069203f},
-std::array<float,2>{0.791908741f, 0.736573994f},
-std::array<float,2>{0.357629061f, 0.496774137f},
-std::array<float,2>{0.390427798f, 0.604897976f},
-std::array<float,2>{0.951008022f, 0.264132231f},
-std::array<float,2>{0.585837126f, 0.872949243f},
-std::array<float,2>{0.077770941f, 0.0690518618f},
-std::array<float,2>{0.263878942f, 0.785114765f},
-std::array<float,2>{0.848155797f, 0.0395818315f},
-std::array<float,2>{0.717775702f, 0.557313919f},
-std::array<float,2>{0.180780262f, 0.31871435f},
-std::array<float,2>{0.00758699467f, 0.653299451f},
-std::array<float,2>{0.513052762f, 0.377027929f},
-std::array<float,2>{0.909667432f, 0.92038101f},
-std::array<float,2>{0.490069985f, 0.199929997f},
-std::array<float,2>{0.0961796194f, 0.812866151f},
-std::array<float,2>{0.601445556f, 0.116983861f},
-std::array<float,2>{0.97978282f, 0.574011624f},
-std::array<float,2>{0.408803701f, 0.295767069f},
-std::array<float,2>{0.325082332f, 0.697926521f},
-std::array<float,2>{0.759902656f, 0.440370172f},
-std::array<float,2>{0.625151157f, 0.978996873f},
-std::array<float,2>{0.243148401f, 0.165749982f},
-std::array<float,2>{0.465693027f, 0.899858415f},
-std::array<float,2>{0.885059476f, 0.246062621f},
-std::array<float,2>{0.535156786f, 0.665029883f},
-std::array<float,2>{0.0356628262f, 0.430728316f},
-std::array<float,2>{0.141010165f, 0.515039444f},
-std::array<float,2>{0.73568815f, 0.372228354f},
-std::array<float,2>{0.840032339f, 0.752794981f},
-std::array<float,2>{0.303642541f, 0.0177928265f},
-std::array<float,2>{0.237675712f, 0.86427635f},
-std::array<float,2>{0.634728789f, 0.0707240254f},
-std::array<float,2>{0.757498622f, 0.596838176f},
-std::array<float,2>{0.320008159f, 0.251001149f},
-std::array<float,2>{0.415714204f, 0.74318099f},
-std::array<float,2>{0.973595202f, 0.490486205f},
-std::array<float,2>{0.60437876f, 0.963555813f},
-std::array<float,2>{0.102200598f, 0.149853751f},
-std::array<float,2>{0.307303548f, 0.911512196f},
-std::array<float,2>{0.834507942f, 0.192931339f},
-std::array<float,2>{0.747525454f, 0.642383695f},
-std::array<float,2>{0.152512506f, 0.38459298f},
-std::array<float,2>{0.0428339317f, 0.554328382f},
-std::array<float,2>{0.539218903f, 0.326560795f},
-std::array<float,2>{0.875699878f, 0.796249926f},
-std::array<float,2>{0.457958519f, 0.0368305221f},
-std::array<float,2>{0.0668557286f, 0.970764697f},
-std::array<float,2>{0.591892898f, 0.158707023f},
-std::array<float,2>{0.93766582f, 0.689853013f},
-std::array<float,2>{0.37515381f, 0.44599247f},
-std::array<float,2>{0.346057653f, 0.567173958f},
-std::array<float,2>{0.781984985f, 0.288042009f},
-std::array<float,2>{0.659675539f, 0.821798682f},
-std::array<float,2>{0.212924287f, 0.122261152f},
-std::array<float,2>{0.496222645f, 0.762268007f},
-std::array<float,2>{0.914795876f, 0.024989713f},
-std::array<float,2>{0.504035532f, 0.502465546f},
-std::array<float,2>{0.0143536106f, 0.362609059f},
-std::array<float,2>{0.178282857f, 0.660433531f},
-std::array<float,2>{0.709826767f, 0.424422473f},
-std::array<float,2>{0.857778192f, 0.897524118f},
-std::array<float,2>{0.253750533f, 0.235991299f},
-std::array<float,2>{0.13605842f, 0.884295464f},
-std::array<float,2>{0.72771287f, 0.219164923f},
-std::array<float,2>{0.827762485f, 0.674886286f},
-std::array<float,2>{0.281874746f, 0.415932477f},
-std::array<float,2>{0.451676667f, 0.52908808f},
-std::array<float,2>{0.89183557f, 0.354031861f},
-std::array<float,2>{0.553527355f, 0.767071664f},
-std::array<float,2>{0.0534027517f, 0.000942035054f},
-std::array<float,2>{0.33260259f, 0.831873536f},
-std::array<float,2>{0.781082332f, 0.105815895f},
-std::array<float,2>{0.650611937f, 0.589342594f},
-std::array<float,2>{0.232010484f, 0.308717042f},
-std::array<float,2>{0.120956458f, 0.705125749f},
-std::array<float,2>{0.622400284f, 0.461728424f},
-std::array<float,2>{0.99269563f, 0.989612877f},
-std::array<float,2>{0.430847019f, 0.185392603f},
-std::array<float,2>{0.0205580201f, 0.806375921f},
-std::array<float,2>{0.524040639f, 0.0491387844f},
-std::array<float,2>{0.926348448f, 0.54555589f},
-std::array<float,2>{0.47710672f, 0.333422333f},
-std::array<float,2>{0.270519167f, 0.629636526f},
-std::array<float,2>{0.869754553f, 0.396719128f},
-std::array<float,2>{0.688390613f, 0.937371552f},
-std::array<float,2>{0.167691246f, 0.21449329f},
-std::array<float,2>{0.401528448f, 0.94270438f},
-std::array<float,2>{0.956583858f, 0.13482514f},
-std::array<float,2>{0.570851445f, 0.727869511f},
-std::array<float,2>{0.0923410952f, 0.469283074f},
-std::array<float,2>{0.19644253f, 0.615312338f},
-std::array<float,2>{0.675581217f, 0.27677235f},
-std::array<float,2>{0.812371969f, 0.856300473f},
-std::array<float,2>{0.371641636f, 0.0886221081f},
-std::array<float,2>{0.190323114f, 0.790359199f},
-std::array<float,2>{0.684999824f, 0.0333163626f},
-std::array<float,2>{0.800105572f, 0.550595939f},
-std::array<float,2>{0.362425178f, 0.320679486f},
-std::array<float,2>{0.393989235f, 0.647289753f},
-std::array<float,2>{0.963745475f, 0.389482915f},
-std::array<float,2>{0.564549267f, 0.90979296f},
-std::array<float,2>{0.0819886401f, 0.189290777f},
-std::array<float,2>{0.27915439f, 0.966101587f},
-std::array<float,2>{0.865670145f, 0.155141324f},
-std::array<float,2>{0.695910454f, 0.74611938f},
-std::array<float,2>{0.161226645f, 0.488062978f},
-std::array<float,2>{0.026054401f, 0.599062502f},
-std::array<float,2>{0.520902216f, 0.254062325f},
-std::array<float,2>{0.930223882f, 0.860952139f},
-std::array<float,2>{0.469777048f, 0.0770982131f},
-std::array<float,2>{0.112935275f, 0.894062698f},
-std::array<float,2>{0.610022306f, 0.240699664f},
-std::array<float,2>{0.985710979f, 0.65958041f},
-std::array<float,2>{0.425676018f, 0.426638156f},
-std::array<float,2>{0.336179554f, 0.507750332f},
-std::array<float,2>{0.771192253f, 0.366514206f},
-std::array<float,2>{0.644521773f, 0.760521889f},
-std::array<float,2>{0.221032307f, 0.0304196924f},
-std::array<float,2>{0.441848248f, 0.825882196f},
-std::array<float,2>{0.899619818f, 0.117395319f},
-std::array<float,2>{0.557890415f, 0.563506246f},
-std::array<float,2>{0.0611015633f, 0.282749474f},
-std::array<float,2>{0.125842229f, 0.693773746f},
-std::array<float,2>{0.726331592f, 0.450674951f},
-std::array<float,2>{0.818848252f, 0.975770712f},
-std::array<float,2>{0.293597132f, 0.163704678f},
-std::array<float,2>{0.185593933f, 0.986260056f},
-std::array<float,2>{0.711164057f, 0.180677921f},
-std::array<float,2>{0.844426751f, 0.709338367f},
-std::array<float,2>{0.260273755f, 0.467930466f},
-std::array<float,2>{0.486560702f, 0.591535389f},
-std::array<float,2>{0.910187006f, 0.308196008f},
-std::array<float,2>{0.509162843f, 0.835895181f},
-std::array<float,2>{0.00137532724f, 0.10433948f},
-std::array<float,2>{0.352956027f, 0.771954834f},
-std::array<float,2>{0.793641329f, 0.00655680289f},
-std::array<float,2>{0.668337882f, 0.523677647f},
-std::array<float,2>{0.208192095f, 0.355745047f},
-std::array<float,2>{0.0728513524f, 0.677256048f},
-std::array<float,2>{0.578842819f, 0.41925928f},
-std::array<float,2>{0.948862493f, 0.887069583f},
-std::array<float,2>{0.386173218f, 0.225663736f},
-std::array<float,2>{0.0350994878f, 0.853188694f},
-std::array<float,2>{0.531367004f, 0.0919039547f},
-std::array<float,2>{0.888573587f, 0.611092627f},
-std::array<float,2>{0.461391658f, 0.279932946f},
-std::array<float,2>{0.298122555f, 0.732696414f},
-std::array<float,2>{0.83931917f, 0.473719716f},
-std::array<float,2>{0.738651276f, 0.939016461f},
-std::array<float,2>{0.146148592f, 0.140387997f},
-std::array<float,2>{0.410591841f, 0.931750119f},
-std::array<float,2>{0.982304454f, 0.215402603f},
-std::array<float,2>{0.597084641f, 0.626481533f},
-std::array<float,2>{0.0987940878f, 0.392286152f},
-std::array<float,2>{0.249670222f, 0.539430678f},
-std::array<float,2>{0.630277932f, 0.331704736f},
-std::array<float,2>{0.763274074f, 0.811750591f},
-std::array<float,2>{0.320795119f, 0.0511909276f},
-std::array<float,2>{0.148960486f, 0.839255333f},
-std::array<float,2>{0.743303359f, 0.0979413614f},
-std::array<float,2>{0.831319809f, 0.581880331f},
-std::array<float,2>{0.309372097f, 0.303501666f},
-std::array<float,2>{0.453281701f, 0.717190921f},
-std::array<float,2>{0.878991008f, 0.45331791f},
-std::array<float,2>{0.543044984f, 0.993529379f},
-std::array<float,2>{0.0454687588f, 0.17650184f},
-std::array<float,2>{0.315897882f, 0.880602896f},
-std::array<float,2>{0.753510475f, 0.230378225f},
-std::array<float,2>{0.638364911f, 0.684160888f},
-std::array<float,2>{0.238380745f, 0.410294205f},
-std::array<float,2>{0.107097648f, 0.516527236f},
-std::array<float,2>{0.60736233f, 0.34667626f},
-std::array<float,2>{0.968927681f, 0.774153411f},
-std::array<float,2>{0.421719134f, 0.00983754825f},
-std::array<float,2>{0.0107012903f, 0.95161736f},
-std::array<float,2>{0.502802908f, 0.13020283f},
-std::array<float,2>{0.918878973f, 0.722112954f},
-std::array<float,2>{0.493496627f, 0.481410235f},
-std::array<float,2>{0.257119864f, 0.622454762f},
-std::array<float,2>{0.853914917f, 0.271832794f},
-std::array<float,2>{0.704823911f, 0.848592639f},
-std::array<float,2>{0.172704667f, 0.079018876f},
-std::array<float,2>{0.382512867f, 0.80203712f},
-std::array<float,2>{0.943710387f, 0.0583082773f},
-std::array<float,2>{0.589434803f, 0.536677539f},
-std::array<float,2>{0.0646580383f, 0.342898101f},
-std::array<float,2>{0.217304543f, 0.640559494f},
-std::array<float,2>{0.660746515f, 0.399384618f},
-std::array<float,2>{0.787609398f, 0.925723314f},
-std::array<float,2>{0.349249065f, 0.206300676f},
-std::array<float,2>{0.227561519f, 0.916693509f},
-std::array<float,2>{0.655897319f, 0.198141202f},
-std::array<float,2>{0.776628852f, 0.650837243f},
-std::array<float,2>{0.328167796f, 0.37957865f},
-std::array<float,2>{0.435785234f, 0.559433341f},
-std::array<float,2>{0.997540951f, 0.312949985f},
-std::array<float,2>{0.620365441f, 0.785918474f},
-std::array<float,2>{0.122486822f, 0.0454632044f},
-std::array<float,2>{0.285698563f, 0.868850946f},
-std::array<float,2>{0.822706997f, 0.0661934093f},
-std::array<float,2>{0.733933866f, 0.606100917f},
-std::array<float,2>{0.14059715f, 0.260641366f},
-std::array<float,2>{0.047470741f, 0.740222752f},
-std::array<float,2>{0.547345161f, 0.495515466f},
-std::array<float,2>{0.895631313f, 0.957949638f},
-std::array<float,2>{0.448783576f, 0.142674223f},
-std::array<float,2>{0.0888381973f, 0.757453382f},
-std::array<float,2>{0.575561881f, 0.021124173f},
-std::array<float,2>{0.959603727f, 0.508204639f},
-std::array<float,2>{0.403826326f, 0.36766845f},
-std::array<float,2>{0.369379908f, 0.668485761f},
-std::array<float,2>{0.807631791f, 0.433644086f},
-std::array<float,2>{0.677913487f, 0.903490841f},
-std::array<float,2>{0.200102359f, 0.249840811f},
-std::array<float,2>{0.48276785f, 0.984125435f},
-std::array<float,2>{0.923080444f, 0.171241716f},
-std::array<float,2>{0.528760314f, 0.700605571f},
-std::array<float,2>{0.016820807f, 0.442736387f},
-std::array<float,2>{0.170832381f, 0.576312482f},
-std::array<float,2>{0.691750526f, 0.291358292f},
-std::array<float,2>{0.873259127f, 0.818076253f},
-std::array<float,2>{0.268688798f, 0.109964617f},
-std::array<float,2>{0.180415317f, 0.781754851f},
-std::array<float,2>{0.717429221f, 0.0425415598f},
-std::array<float,2>{0.84948647f, 0.556127131f},
-std::array<float,2>{0.265069604f, 0.317716628f},
-std::array<float,2>{0.488593489f, 0.655956507f},
-std::array<float,2>{0.909046471f, 0.375714451f},
-std::array<float,2>{0.511768818f, 0.918636858f},
-std::array<float,2>{0.00662820041f, 0.202735156f},
-std::array<float,2>{0.359369069f, 0.955201805f},
-std::array<float,2>{0.791999102f, 0.144704565f},
-std::array<float,2>{0.666106462f, 0.735773206f},
-std::array<float,2>{0.204418868f, 0.499130875f},
-std::array<float,2>{0.0770864263f, 0.602471352f},
-std::array<float,2>{0.584178269f, 0.262758285f},
-std::array<float,2>{0.949814439f, 0.873394012f},
-std::array<float,2>{0.388740152f, 0.0664149374f},
-std::array<float,2>{0.037059579f, 0.900481284f},
-std::array<float,2>{0.536367834f, 0.24234885f},
-std::array<float,2>{0.885926962f, 0.667273283f},
-std::array<float,2>{0.46630308f, 0.433415174f},
-std::array<float,2>{0.304206789f, 0.512139499f},
-std::array<float,2>{0.841051817f, 0.374332726f},
-std::array<float,2>{0.735050321f, 0.750018954f},
-std::array<float,2>{0.141849726f, 0.0169708524f},
-std::array<float,2>{0.409555614f, 0.815853f},
-std::array<float,2>{0.97946012f, 0.1136228f},
-std::array<float,2>{0.600486457f, 0.571125925f},
-std::array<float,2>{0.0969340205f, 0.294444978f},
-std::array<float,2>{0.243193507f, 0.696723223f},
-std::array<float,2>{0.626065671f, 0.438547879f},
-std::array<float,2>{0.761226654f, 0.97761184f},
-std::array<float,2>{0.325714499f, 0.166808695f},
-std::array<float,2>{0.191804945f, 0.996562183f},
-std::array<float,2>{0.680620313f, 0.173234642f},
-std::array<float,2>{0.804039598f, 0.712903559f},
-std::array<float,2>{0.366696805f, 0.459578693f},
-std::array<float,2>{0.396770775f, 0.584365427f},
-std::array<float,2>{0.967763186f, 0.298752189f},
-std::array<float,2>{0.569462776f, 0.843204677f},
-std::array<float,2>{0.0845410004f, 0.0947342291f},
-std::array<float,2>{0.275557518f, 0.781156659f},
-std::array<float,2>{0.86240375f, 0.0147779267f},
-std::array<float,2>{0.700539291f, 0.521983802f},
-std::array<float,2>{0.157521918f, 0.350902915f},
-std::array<float,2>{0.0306037702f, 0.68305558f},
-std::array<float,2>{0.516424119f, 0.408632427f},
-std::array<float,2>{0.93555057f, 0.876191914f},
-std::array<float,2>{0.475893319f, 0.233026892f},
-std::array<float,2>{0.115544744f, 0.846063077f},
-std::array<float,2>{0.614053011f, 0.0840337425f},
-std::array<float,2>{0.988889813f, 0.620352507f},
-std::array<float,2>{0.42647016f, 0.266878545f},
-std::array<float,2>{0.341043383f, 0.72437501f},
-std::array<float,2>{0.767765045f, 0.477171093f},
-std::array<float,2>{0.645648658f, 0.945697427f},
-std::array<float,2>{0.222989067f, 0.126589254f},
-std::array<float,2>{0.440638691f, 0.927241564f},
-std::array<float,2>{0.904060006f, 0.20870541f},
-std::array<float,2>{0.562143624f, 0.636219561f},
-std::array<float,2>{0.0552875847f, 0.40441379f},
-std::array<float,2>{0.130564347f, 0.532518327f},
-std::array<float,2>{0.719430804f, 0.339239568f},
-std::array<float,2>{0.812652588f, 0.79863286f},
-std::array<float,2>{0.289741576f, 0.0611441508f},
-std::array<float,2>{0.230548352f, 0.82886225f},
-std::array<float,2>{0.651745021f, 0.108027853f},
-std::array<float,2>{0.78026253f, 0.586480677f},
-std::array<float,2>{0.333423853f, 0.31193006f},
-std::array<float,2>{0.430414677f, 0.704070091f},
-std::array<float,2>{0.993624449f, 0.463733524f},
-std::array<float,2>{0.621314883f, 0.99152261f},
-std::array<float,2>{0.120085485f, 0.186688393f},
-std::array<float,2>{0.28273955f, 0.885918379f},
-std::array<float,2>{0.826567709f, 0.222376719f},
-std::array<float,2>{0.727065206f, 0.672124863f},
-std::array<float,2>{0.134833381f, 0.417208314f},
-std::array<float,2>{0.0543656759f, 0.530188978f},
-std::array<float,2>{0.553989649f, 0.353288352f},
-std::array<float,2>{0.890864074f, 0.767759621f},
-std::array<float,2>{0.45255968f, 0.00196521403f},
-std::array<float,2>{0.0929958671f, 0.945162654f},
-std::array<float,2>{0.571522892f, 0.133912295f},
-std::array<float,2>{0.955511987f, 0.728994727f},
-std::array<float,2>{0.401195884f, 0.47125718f},
-std::array<float,2>{0.372906446f, 0.61377269f},
-std::array<float,2>{0.810774624f, 0.274803787f},
-std::array<float,2>{0.674152851f, 0.859130502f},
-std::array<float,2>{0.195399657f, 0.0866225511f},
-std::array<float,2>{0.47813791f, 0.808478177f},
-std::array<float,2>{0.927387893f, 0.0480762832f},
-std::array<float,2>{0.524759531f, 0.544416845f},
-std::array<float,2>{0.0196463261f, 0.335148215f},
-std::array<float,2>{0.166616321f, 0.631379843f},
-std::array<float,2>{0.689392626f, 0.396449804f},
-std::array<float,2>{0.870278597f, 0.93513602f},
-std::array<float,2>{0.270182312f, 0.212519333f},
-std::array<float,2>{0.153786153f, 0.912635207f},
-std::array<float,2>{0.747018099f, 0.194244862f},
-std::array<float,2>{0.835088193f, 0.642882407f},
-std::array<float,2>{0.307983667f, 0.386445403f},
-std::array<float,2>{0.458982617f, 0.55255419f},
-std::array<float,2>{0.876473725f, 0.324268252f},
-std::array<float,2>{0.540150046f, 0.79371959f},
-std::array<float,2>{0.041973222f, 0.0386817828f},
-std::array<float,2>{0.318540603f, 0.865648448f},
-std::array<float,2>{0.756796062f, 0.0727620721f},
-std::array<float,2>{0.633090913f, 0.594991922f},
-std::array<float,2>{0.237006292f, 0.252808839f},
-std::array<float,2>{0.103324905f, 0.744576156f},
-std::array<float,2>{0.604873061f, 0.489811718f},
-std::array<float,2>{0.973823726f, 0.96234715f},
-std::array<float,2>{0.414511323f, 0.152038991f},
-std::array<float,2>{0.0147218565f, 0.763928771f},
-std::array<float,2>{0.505283892f, 0.0257757027f},
-std::array<float,2>{0.915886879f, 0.501027286f},
-std::array<float,2>{0.497504681f, 0.359641671f},
-std::array<float,2>{0.252652586f, 0.66321677f},
-std::array<float,2>{0.859026611f, 0.42312482f},
-std::array<float,2>{0.710547984f, 0.895778537f},
-std::array<float,2>{0.179107368f, 0.237061545f},
-std::array<float,2>{0.376545936f, 0.969650567f},
-std::array<float,2>{0.939305782f, 0.157654464f},
-std::array<float,2>{0.593317032f, 0.688558519f},
-std::array<float,2>{0.068342559f, 0.447518677f},
-std::array<float,2>{0.214178681f, 0.57015425f},
-std::array<float,2>{0.658661067f, 0.286072373f},
-std::array<float,2>{0.782572567f, 0.824129462f},
-std::array<float,2>{0.346874624f, 0.12485873f},
-std::array<float,2>{0.207317457f, 0.770403862f},
-std::array<float,2>{0.669248939f, 0.0053563104f},
-std::array<float,2>{0.794318795f, 0.527003169f},
-std::array<float,2>{0.35189864f, 0.358662218f},
-std::array<float,2>{0.38523227f, 0.678843021f},
-std::array<float,2>{0.947410941f, 0.420279413f},
-std::array<float,2>{0.579235852f, 0.889205754f},
-std::array<float,2>{0.0741665959f, 0.223518133f},
-std::array<float,2>{0.261613876f, 0.98643744f},
-std::array<float,2>{0.845243454f, 0.181957901f},
-std::array<float,2>{0.712464869f, 0.707375705f},
-std::array<float,2>{0.187063172f, 0.46674189f},
-std::array<float,2>{0.000562790781f, 0.591863334f},
-std::array<float,2>{0.508587539f, 0.30493167f},
-std::array<float,2>{0.912028551f, 0.832095146f},
-std::array<float,2>{0.487962276f, 0.102740616f},
-std::array<float,2>{0.0985282287f, 0.92993474f},
-std::array<float,2>{0.595938087f, 0.218328744f},
-std::array<float,2>{0.981430173f, 0.627580047f},
-std::array<float,2>{0.411922216f, 0.393547118f},
-std::array<float,2>{0.321541399f, 0.541223764f},
-std::array<float,2>{0.762486577f, 0.328926325f},
-std::array<float,2>{0.629178703f, 0.809122562f},
-std::array<float,2>{0.24829565f, 0.053801544f},
-std::array<float,2>{0.462837428f, 0.855020702f},
-std::array<float,2>{0.886726141f, 0.0899104923f},
-std::array<float,2>{0.532228231f, 0.612583458f},
-std::array<float,2>{0.0333022363f, 0.278199345f},
-std::array<float,2>{0.145476282f, 0.731482565f},
-std::array<float,2>{0.739661157f, 0.474982083f},
-std::array<float,2>{0.838476777f, 0.940866888f},
-std::array<float,2>{0.297734469f, 0.137536377f},
-std::array<float,2>{0.160943717f, 0.96687454f},
-std::array<float,2>{0.697114944f, 0.152696222f},
-std::array<float,2>{0.866283059f, 0.748164177f},
-std::array<float,2>{0.277575731f, 0.4847323f},
-std::array<float,2>{0.469246298f, 0.600215256f},
-std::array<float,2>{0.93115586f, 0.257064462f},
-std::array<float,2>{0.519561648f, 0.863139629f},
-std::array<float,2>{0.0272791106f, 0.0744935945f},
-std::array<float,2>{0.361837894f, 0.79199779f},
-std::array<float,2>{0.79922992f, 0.0328846984f},
-std::array<float,2>{0.684009373f, 0.548810422f},
-std::array<float,2>{0.191337943f, 0.322504908f},
-std::array<float,2>{0.0809017494f, 0.644694567f},
-std::array<float,2>{0.566008568f, 0.387583166f},
-std::array<float,2>{0.963927031f, 0.908063114f},
-std::array<float,2>{0.392593712f, 0.19015272f},
-std::array<float,2>{0.0618068203f, 0.82747072f},
-std::array<float,2>{0.556993484f, 0.119715333f},
-std::array<float,2>{0.898937821f, 0.564912558f},
-std::array<float,2>{0.443354338f, 0.283608913f},
-std::array<float,2>{0.294834793f, 0.69235307f},
-std::array<float,2>{0.819785714f, 0.452996612f},
-std::array<float,2>{0.725178957f, 0.972796857f},
-std::array<float,2>{0.126886308f, 0.161714196f},
-std::array<float,2>{0.424353302f, 0.892174006f},
-std::array<float,2>{0.984601855f, 0.239549816f},
-std::array<float,2>{0.610482693f, 0.657056689f},
-std::array<float,2>{0.112025954f, 0.428880244f},
-std::array<float,2>{0.222572893f, 0.504441619f},
-std::array<float,2>{0.642763555f, 0.364083052f},
-std::array<float,2>{0.770394146f, 0.758622825f},
-std::array<float,2>{0.337041885f, 0.0287836529f},
-std::array<float,2>{0.139021918f, 0.869948506f},
-std::array<float,2>{0.732607424f, 0.0628241599f},
-std::array<float,2>{0.823289216f, 0.60876447f},
-std::array<float,2>{0.286618948f, 0.258726805f},
-std::array<float,2>{0.447406709f, 0.741247773f},
-std::array<float,2>{0.89511925f, 0.493802637f},
-std::array<float,2>{0.548569322f, 0.959066451f},
-std::array<float,2>{0.0484235473f, 0.141941547f},
-std::array<float,2>{0.329280049f, 0.914269626f},
-std::array<float,2>{0.775675535f, 0.196833804f},
-std::array<float,2>{0.654694676f, 0.650051832f},
-std::array<float,2>{0.227001145f, 0.381917417f},
-std::array<float,2>{0.121612869f, 0.561834037f},
-std::array<float,2>{0.619850993f, 0.315931439f},
-std::array<float,2>{0.99616158f, 0.788311064f},
-std::array<float,2>{0.436586946f, 0.0437502563f},
-std::array<float,2>{0.0159190875f, 0.981045842f},
-std::array<float,2>{0.527726769f, 0.169361025f},
-std::array<float,2>{0.922409296f, 0.703095078f},
-std::array<float,2>{0.483863175f, 0.444724411f},
-std::array<float,2>{0.267836452f, 0.575640082f},
-std::array<float,2>{0.874878645f, 0.289672643f},
-std::array<float,2>{0.692983389f, 0.818794668f},
-std::array<float,2>{0.171872765f, 0.111369126f},
-std::array<float,2>{0.402742475f, 0.755411565f},
-std::array<float,2>{0.960572004f, 0.0216317847f},
-std::array<float,2>{0.574892819f, 0.51082623f},
-std::array<float,2>{0.0893404782f, 0.371081144f},
-std::array<float,2>{0.201030061f, 0.670989335f},
-std::array<float,2>{0.678717434f, 0.436699271f},
-std::array<float,2>{0.807536781f, 0.905798614f},
-std::array<float,2>{0.370857209f, 0.24705264f},
-std::array<float,2>{0.239754632f, 0.882224679f},
-std::array<float,2>{0.636825979f, 0.227255553f},
-std::array<float,2>{0.752240181f, 0.686739802f},
-std::array<float,2>{0.314742118f, 0.412768811f},
-std::array<float,2>{0.420038491f, 0.518670201f},
-std::array<float,2>{0.970300317f, 0.345348775f},
-std::array<float,2>{0.605508149f, 0.776765823f},
-std::array<float,2>{0.106437773f, 0.00972006936f},
-std::array<float,2>{0.310517251f, 0.836606562f},
-std::array<float,2>{0.830338717f, 0.101178423f},
-std::array<float,2>{0.743056536f, 0.578424335f},
-std::array<float,2>{0.150041208f, 0.300904274f},
-std::array<float,2>{0.0466921665f, 0.715764403f},
-std::array<float,2>{0.544478297f, 0.455932885f},
-std::array<float,2>{0.880402446f, 0.994170249f},
-std::array<float,2>{0.454867035f, 0.177844688f},
-std::array<float,2>{0.0661363304f, 0.802756846f},
-std::array<float,2>{0.58884877f, 0.0565788336f},
-std::array<float,2>{0.945055664f, 0.537227809f},
-std::array<float,2>{0.38162604f, 0.340345114f},
-std::array<float,2>{0.347828358f, 0.638660371f},
-std::array<float,2>{0.788670003f, 0.40178588f},
-std::array<float,2>{0.661319911f, 0.922572732f},
-std::array<float,2>{0.217785999f, 0.203322634f},
-std::array<float,2>{0.492589206f, 0.949389815f},
-std::array<float,2>{0.919467032f, 0.131541371f},
-std::array<float,2>{0.503817201f, 0.720174134f},
-std::array<float,2>{0.0115815941f, 0.483846903f},
-std::array<float,2>{0.173068851f, 0.623910964f},
-std::array<float,2>{0.703868449f, 0.270988464f},
-std::array<float,2>{0.854520559f, 0.850645185f},
-std::array<float,2>{0.25641346f, 0.080828093f},
-std::array<float,2>{0.14401415f, 0.753554583f},
-std::array<float,2>{0.738087952f, 0.0187668204f},
-std::array<float,2>{0.843265355f, 0.514600933f},
-std::array<float,2>{0.301458806f, 0.371121377f},
-std::array<float,2>{0.468605489f, 0.665520728f},
-std::array<float,2>{0.88290298f, 0.430102825f},
-std::array<float,2>{0.537705064f, 0.898686945f},
-std::array<float,2>{0.0390167795f, 0.245021895f},
-std::array<float,2>{0.327709764f, 0.980053365f},
-std::array<float,2>{0.757962763f, 0.164405107f},
-std::array<float,2>{0.627342224f, 0.698727489f},
-std::array<float,2>{0.245226294f, 0.440797508f},
-std::array<float,2>{0.0944891423f, 0.573126972f},
-std::array<float,2>{0.598764122f, 0.295934349f},
-std::array<float,2>{0.978451371f, 0.814230025f},
-std::array<float,2>{0.406514943f, 0.115359403f},
-std::array<float,2>{0.00480296602f, 0.921493113f},
-std::array<float,2>{0.514855266f, 0.200303242f},
-std::array<float,2>{0.90785569f, 0.653387606f},
-std::array<float,2>{0.490463167f, 0.378366232f},
-std::array<float,2>{0.263116777f, 0.558576286f},
-std::array<float,2>{0.851417899f, 0.319375306f},
-std::array<float,2>{0.715429962f, 0.783645213f},
-std::array<float,2>{0.182882369f, 0.0401026942f},
-std::array<float,2>{0.387812346f, 0.87168771f},
-std::array<float,2>{0.952558935f, 0.07019265f},
-std::array<float,2>{0.583528399f, 0.604374468f},
-std::array<float,2>{0.0759807304f, 0.26465711f},
-std::array<float,2>{0.206175923f, 0.738257527f},
-std::array<float,2>{0.664511621f, 0.497155875f},
-std::array<float,2>{0.790676534f, 0.953583479f},
-std::array<float,2>{0.356741786f, 0.147431791f},
-std::array<float,2>{0.226080358f, 0.948547542f},
-std::array<float,2>{0.64836657f, 0.127393365f},
-std::array<float,2>{0.766605556f, 0.725748956f},
-std::array<float,2>{0.342867136f, 0.478657454f},
-std::array<float,2>{0.42790243f, 0.618854046f},
-std::array<float,2>{0.990647495f, 0.269304007f},
-std::array<float,2>{0.61551106f, 0.844864309f},
-std::array<float,2>{0.115153134f, 0.0831403434f},
-std::array<float,2>{0.291920006f, 0.79951793f},
-std::array<float,2>{0.815461576f, 0.0595353432f},
-std::array<float,2>{0.721068025f, 0.5337767f},
-std::array<float,2>{0.131903872f, 0.336006433f},
-std::array<float,2>{0.057094153f, 0.634685934f},
-std::array<float,2>{0.559848726f, 0.403939039f},
-std::array<float,2>{0.905335069f, 0.927832305f},
-std::array<float,2>{0.438897431f, 0.209032714f},
-std::array<float,2>{0.0825698003f, 0.84010154f},
-std::array<float,2>{0.567671061f, 0.0969032496f},
-std::array<float,2>{0.966207743f, 0.582922339f},
-std::array<float,2>{0.395542115f, 0.300576568f},
-std::array<float,2>{0.363803923f, 0.71178174f},
-std::array<float,2>{0.802473128f, 0.457787842f},
-std::array<float,2>{0.682770252f, 0.999019861f},
-std::array<float,2>{0.194789767f, 0.174883902f},
-std::array<float,2>{0.473988712f, 0.87881273f},
-std::array<float,2>{0.935379505f, 0.231709838f},
-std::array<float,2>{0.518299282f, 0.680863678f},
-std::array<float,2>{0.0276522283f, 0.408081412f},
-std::array<float,2>{0.159687147f, 0.52017504f},
-std::array<float,2>{0.703103244f, 0.348672479f},
-std::array<float,2>{0.861141384f, 0.777823985f},
-std::array<float,2>{0.274862826f, 0.013133592f},
-std::array<float,2>{0.1985071f, 0.856714427f},
-std::array<float,2>{0.672364414f, 0.0889213011f},
-std::array<float,2>{0.809782326f, 0.61669457f},
-std::array<float,2>{0.373815238f, 0.276302457f},
-std::array<float,2>{0.399406731f, 0.727113783f},
-std::array<float,2>{0.954205096f, 0.469983131f},
-std::array<float,2>{0.57285893f, 0.941904545f},
-std::array<float,2>{0.0915176347f, 0.13634181f},
-std::array<float,2>{0.272073954f, 0.936079979f},
-std::array<float,2>{0.868920803f, 0.213150159f},
-std::array<float,2>{0.689791322f, 0.630647182f},
-std::array<float,2>{0.165478736f, 0.397763789f},
-std::array<float,2>{0.0220894404f, 0.546308756f},
-std::array<float,2>{0.525497139f, 0.332241207f},
-std::array<float,2>{0.928468704f, 0.804882646f},
-std::array<float,2>{0.478861064f, 0.0506891757f},
-std::array<float,2>{0.117740393f, 0.988690555f},
-std::array<float,2>{0.623952806f, 0.183729827f},
-std::array<float,2>{0.994612634f, 0.706774175f},
-std::array<float,2>{0.433486253f, 0.462734699f},
-std::array<float,2>{0.334715247f, 0.588636756f},
-std::array<float,2>{0.77929455f, 0.310403824f},
-std::array<float,2>{0.648947477f, 0.830683708f},
-std::array<float,2>{0.233092457f, 0.107348524f},
-std::array<float,2>{0.450008065f, 0.765950143f},
-std::array<float,2>{0.89410454f, 0.00109212322f},
-std::array<float,2>{0.55250752f, 0.527920246f},
-std::array<float,2>{0.0523052998f, 0.354864925f},
-std::array<float,2>{0.133730546f, 0.674797058f},
-std::array<float,2>{0.729596198f, 0.414663523f},
-std::array<float,2>{0.825106561f, 0.883178353f},
-std::array<float,2>{0.283863425f, 0.220339894f},
-std::array<float,2>{0.176352441f, 0.896807969f},
-std::array<float,2>{0.707419574f, 0.235320956f},
-std::array<float,2>{0.856465816f, 0.66151011f},
-std::array<float,2>{0.25189352f, 0.425224423f},
-std::array<float,2>{0.499048263f, 0.503478467f},
-std::array<float,2>{0.91663307f, 0.361988723f},
-std::array<float,2>{0.507549763f, 0.763091445f},
-std::array<float,2>{0.0122343367f, 0.0242895987f},
-std::array<float,2>{0.344884247f, 0.820661306f},
-std::array<float,2>{0.784578085f, 0.121844746f},
-std::array<float,2>{0.656965911f, 0.56742543f},
-std::array<float,2>{0.212461561f, 0.288523406f},
-std::array<float,2>{0.0694707632f, 0.691260457f},
-std::array<float,2>{0.590180755f, 0.447222531f},
-std::array<float,2>{0.939694464f, 0.971758366f},
-std::array<float,2>{0.378805101f, 0.159237489f},
-std::array<float,2>{0.0404715315f, 0.795025766f},
-std::array<float,2>{0.541729867f, 0.0358931571f},
-std::array<float,2>{0.877519429f, 0.553177714f},
-std::array<float,2>{0.460854828f, 0.327452451f},
-std::array<float,2>{0.305149555f, 0.641304076f},
-std::array<float,2>{0.832077026f, 0.383548409f},
-std::array<float,2>{0.749267817f, 0.910746336f},
-std::array<float,2>{0.154725268f, 0.192105129f},
-std::array<float,2>{0.417122453f, 0.964541316f},
-std::array<float,2>{0.975238919f, 0.148992807f},
-std::array<float,2>{0.602684796f, 0.742557168f},
-std::array<float,2>{0.105346121f, 0.491274029f},
-std::array<float,2>{0.235788122f, 0.595817447f},
-std::array<float,2>{0.636697471f, 0.250705808f},
-std::array<float,2>{0.754222095f, 0.863919199f},
-std::array<float,2>{0.317539454f, 0.0713975802f},
-std::array<float,2>{0.24648279f, 0.810582221f},
-std::array<float,2>{0.631579041f, 0.0523704477f},
-std::array<float,2>{0.764122248f, 0.540913582f},
-std::array<float,2>{0.32252875f, 0.330215037f},
-std::array<float,2>{0.413586885f, 0.625973821f},
-std::array<float,2>{0.98262012f, 0.390752614f},
-std::array<float,2>{0.594450295f, 0.933433294f},
-std::array<float,2>{0.101559341f, 0.216528967f},
-std::array<float,2>{0.300114334f, 0.93773967f},
-std::array<float,2>{0.837355733f, 0.139123827f},
-std::array<float,2>{0.740741849f, 0.733725607f},
-std::array<float,2>{0.146692723f, 0.472849697f},
-std::array<float,2>{0.0325644128f, 0.609441936f},
-std::array<float,2>{0.534352481f, 0.28040567f},
-std::array<float,2>{0.888905942f, 0.85233146f},
-std::array<float,2>{0.464551538f, 0.0932258144f},
-std::array<float,2>{0.0712501332f, 0.888509452f},
-std::array<float,2>{0.58155334f, 0.224761546f},
-std::array<float,2>{0.945480168f, 0.67655468f},
-std::array<float,2>{0.383758515f, 0.418099314f},
-std::array<float,2>{0.354238719f, 0.525072873f},
-std::array<float,2>{0.795981765f, 0.357069701f},
-std::array<float,2>{0.671203136f, 0.772715509f},
-std::array<float,2>{0.210836157f, 0.00684221135f},
-std::array<float,2>{0.484846979f, 0.834112167f},
-std::array<float,2>{0.912548363f, 0.10457474f},
-std::array<float,2>{0.509877622f, 0.590332329f},
-std::array<float,2>{0.0031095501f, 0.307577729f},
-std::array<float,2>{0.184051245f, 0.710831046f},
-std::array<float,2>{0.713305295f, 0.466962427f},
-std::array<float,2>{0.846333563f, 0.984390378f},
-std::array<float,2>{0.259271443f, 0.180374533f},
-std::array<float,2>{0.128412828f, 0.974916935f},
-std::array<float,2>{0.724444211f, 0.162115768f},
-std::array<float,2>{0.817241848f, 0.694426775f},
-std::array<float,2>{0.296229571f, 0.449421942f},
-std::array<float,2>{0.44444117f, 0.563225448f},
-std::array<float,2>{0.901354611f, 0.281494498f},
-std::array<float,2>{0.556052625f, 0.824784756f},
-std::array<float,2>{0.0601109639f, 0.118295416f},
-std::array<float,2>{0.338440478f, 0.761394858f},
-std::array<float,2>{0.773222446f, 0.0302574858f},
-std::array<float,2>{0.641445577f, 0.506546736f},
-std::array<float,2>{0.220541343f, 0.366194129f},
-std::array<float,2>{0.110606261f, 0.659097254f},
-std::array<float,2>{0.613069117f, 0.426775455f},
-std::array<float,2>{0.986362696f, 0.893076241f},
-std::array<float,2>{0.422164917f, 0.241380692f},
-std::array<float,2>{0.0253169779f, 0.859609485f},
-std::array<float,2>{0.523156464f, 0.0778432116f},
-std::array<float,2>{0.933379114f, 0.597817659f},
-std::array<float,2>{0.471154541f, 0.25500387f},
-std::array<float,2>{0.280395865f, 0.7471053f},
-std::array<float,2>{0.864765406f, 0.48673299f},
-std::array<float,2>{0.697418988f, 0.965574324f},
-std::array<float,2>{0.163527817f, 0.155765429f},
-std::array<float,2>{0.390770525f, 0.908866942f},
-std::array<float,2>{0.961346507f, 0.187581122f},
-std::array<float,2>{0.563730896f, 0.647795916f},
-std::array<float,2>{0.0797339752f, 0.390339196f},
-std::array<float,2>{0.188090891f, 0.549115717f},
-std::array<float,2>{0.685900271f, 0.32158339f},
-std::array<float,2>{0.796957791f, 0.789113045f},
-std::array<float,2>{0.361257434f, 0.0346610732f},
-std::array<float,2>{0.168102264f, 0.816816211f},
-std::array<float,2>{0.693877816f, 0.111054793f},
-std::array<float,2>{0.872001827f, 0.577843964f},
-std::array<float,2>{0.266319484f, 0.292475849f},
-std::array<float,2>{0.481070489f, 0.69992274f},
-std::array<float,2>{0.925671697f, 0.441698313f},
-std::array<float,2>{0.530709743f, 0.982558787f},
-std::array<float,2>{0.0191558991f, 0.169999361f},
-std::array<float,2>{0.369120777f, 0.90290767f},
-std::array<float,2>{0.806108236f, 0.248747036f},
-std::array<float,2>{0.67636317f, 0.669766247f},
-std::array<float,2>{0.203018591f, 0.435373455f},
-std::array<float,2>{0.0863785967f, 0.509203374f},
-std::array<float,2>{0.576994717f, 0.368661493f},
-std::array<float,2>{0.957136929f, 0.756090045f},
-std::array<float,2>{0.404601187f, 0.0202953033f},
-std::array<float,2>{0.0492768288f, 0.958953381f},
-std::array<float,2>{0.549440145f, 0.144425988f},
-std::array<float,2>{0.897665322f, 0.739053965f},
-std::array<float,2>{0.446758866f, 0.494308263f},
-std::array<float,2>{0.287808627f, 0.607110381f},
-std::array<float,2>{0.821909308f, 0.260920346f},
-std::array<float,2>{0.731656015f, 0.867566824f},
-std::array<float,2>{0.138479367f, 0.0645622239f},
-std::array<float,2>{0.435251713f, 0.786198199f},
-std::array<float,2>{0.999242544f, 0.045991417f},
-std::array<float,2>{0.617258608f, 0.560346723f},
-std::array<float,2>{0.124762259f, 0.314116865f},
-std::array<float,2>{0.229195327f, 0.651955366f},
-std::array<float,2>{0.654027224f, 0.380375326f},
-std::array<float,2>{0.775387466f, 0.917215168f},
-std::array<float,2>{0.330964029f, 0.1988222f},
-std::array<float,2>{0.216584295f, 0.924251378f},
-std::array<float,2>{0.662734509f, 0.205926999f},
-std::array<float,2>{0.785939276f, 0.639125586f},
-std::array<float,2>{0.349798858f, 0.399820864f},
-std::array<float,2>{0.379444391f, 0.535673976f},
-std::array<float,2>{0.942914963f, 0.342401057f},
-std::array<float,2>{0.586737514f, 0.801033676f},
-std::array<float,2>{0.0626526028f, 0.0574305207f},
-std::array<float,2>{0.254385114f, 0.849021852f},
-std::array<float,2>{0.852375627f, 0.0798412636f},
-std::array<float,2>{0.706248641f, 0.621698856f},
-std::array<float,2>{0.174843833f, 0.273169249f},
-std::array<float,2>{0.00870923605f, 0.720982432f},
-std::array<float,2>{0.501655459f, 0.481787086f},
-std::array<float,2>{0.919996023f, 0.952376068f},
-std::array<float,2>{0.494315654f, 0.12970984f},
-std::array<float,2>{0.108919419f, 0.774541736f},
-std::array<float,2>{0.608283401f, 0.0107708042f},
-std::array<float,2>{0.972427666f, 0.516715527f},
-std::array<float,2>{0.419376135f, 0.347111076f},
-std::array<float,2>{0.314368993f, 0.685383737f},
-std::array<float,2>{0.750751376f, 0.411440104f},
-std::array<float,2>{0.640494704f, 0.879583895f},
-std::array<float,2>{0.240759432f, 0.228982478f},
-std::array<float,2>{0.456441134f, 0.992223024f},
-std::array<float,2>{0.881474078f, 0.177418739f},
-std::array<float,2>{0.545556247f, 0.718083918f},
-std::array<float,2>{0.0432405882f, 0.454743862f},
-std::array<float,2>{0.150569916f, 0.581032634f},
-std::array<float,2>{0.744648099f, 0.304107904f},
-std::array<float,2>{0.829025209f, 0.838235319f},
-std::array<float,2>{0.312469006f, 0.0988648757f},
-std::array<float,2>{0.155109912f, 0.793428242f},
-std::array<float,2>{0.749815941f, 0.038172327f},
-std::array<float,2>{0.832671106f, 0.551896214f},
-std::array<float,2>{0.305178702f, 0.325115293f},
-std::array<float,2>{0.460161448f, 0.643346906f},
-std::array<float,2>{0.877369881f, 0.38618499f},
-std::array<float,2>{0.541052401f, 0.912580252f},
-std::array<float,2>{0.0408973135f, 0.193762034f},
-std::array<float,2>{0.318082958f, 0.962535381f},
-std::array<float,2>{0.754832387f, 0.151432529f},
-std::array<float,2>{0.635823965f, 0.744639874f},
-std::array<float,2>{0.236116529f, 0.48939985f},
-std::array<float,2>{0.104898065f, 0.595334232f},
-std::array<float,2>{0.603349328f, 0.25207594f},
-std::array<float,2>{0.974842966f, 0.865936399f},
-std::array<float,2>{0.417940736f, 0.0722702742f},
-std::array<float,2>{0.0120207965f, 0.896295965f},
-std::array<float,2>{0.507275224f, 0.236399516f},
-std::array<float,2>{0.916225672f, 0.663962364f},
-std::array<float,2>{0.499644548f, 0.423807055f},
-std::array<float,2>{0.251033783f, 0.501909018f},
-std::array<float,2>{0.857320189f, 0.35999009f},
-std::array<float,2>{0.707845926f, 0.764230371f},
-std::array<float,2>{0.17613554f, 0.0259157326f},
-std::array<float,2>{0.378221005f, 0.823616385f},
-std::array<float,2>{0.94021976f, 0.124445237f},
-std::array<float,2>{0.590545177f, 0.569383681f},
-std::array<float,2>{0.0701386258f, 0.285634309f},
-std::array<float,2>{0.212234959f, 0.689028442f},
-std::array<float,2>{0.65636903f, 0.447984993f},
-std::array<float,2>{0.785047531f, 0.968981028f},
-std::array<float,2>{0.345314175f, 0.157855093f},
-std::array<float,2>{0.23264955f, 0.991701901f},
-std::array<float,2>{0.648482919f, 0.187401637f},
-std::array<float,2>{0.778445601f, 0.703312755f},
-std::array<float,2>{0.334244102f, 0.463166773f},
-std::array<float,2>{0.432744414f, 0.586301327f},
-std::array<float,2>{0.99493742f, 0.31230545f},
-std::array<float,2>{0.623159528f, 0.828589737f},
-std::array<float,2>{0.117493689f, 0.107473195f},
-std::array<float,2>{0.283325404f, 0.768342733f},
-std::array<float,2>{0.824544311f, 0.00262876321f},
-std::array<float,2>{0.730241418f, 0.529426217f},
-std::array<float,2>{0.133122087f, 0.352731466f},
-std::array<float,2>{0.0519498736f, 0.672764242f},
-std::array<float,2>{0.551871955f, 0.417876989f},
-std::array<float,2>{0.893737376f, 0.886698544f},
-std::array<float,2>{0.449684173f, 0.222122565f},
-std::array<float,2>{0.0909455717f, 0.858806729f},
-std::array<float,2>{0.572735131f, 0.085984312f},
-std::array<float,2>{0.95475316f, 0.613327861f},
-std::array<float,2>{0.398844808f, 0.275328577f},
-std::array<float,2>{0.373152256f, 0.729196131f},
-std::array<float,2>{0.810394466f, 0.470850885f},
-std::array<float,2>{0.672112584f, 0.944481492f},
-std::array<float,2>{0.199006721f, 0.134677842f},
-std::array<float,2>{0.479308397f, 0.934800625f},
-std::array<float,2>{0.928139746f, 0.212204486f},
-std::array<float,2>{0.526070178f, 0.631191194f},
-std::array<float,2>{0.021679718f, 0.395709962f},
-std::array<float,2>{0.165691987f, 0.544854164f},
-std::array<float,2>{0.689946175f, 0.335495859f},
-std::array<float,2>{0.868469596f, 0.807950258f},
-std::array<float,2>{0.27166152f, 0.0485361405f},
-std::array<float,2>{0.195306733f, 0.843421221f},
-std::array<float,2>{0.683429122f, 0.0956530049f},
-std::array<float,2>{0.801990151f, 0.58465749f},
-std::array<float,2>{0.363409936f, 0.29806459f},
-std::array<float,2>{0.396351188f, 0.713485003f},
-std::array<float,2>{0.966751158f, 0.459267944f},
-std::array<float,2>{0.568191528f, 0.996862769f},
-std::array<float,2>{0.0821005329f, 0.173473656f},
-std::array<float,2>{0.274993271f, 0.876838863f},
-std::array<float,2>{0.860374153f, 0.232824281f},
-std::array<float,2>{0.702497125f, 0.683401704f},
-std::array<float,2>{0.159555823f, 0.408953607f},
-std::array<float,2>{0.028259838f, 0.521717846f},
-std::array<float,2>{0.517644048f, 0.351091653f},
-std::array<float,2>{0.935033202f, 0.780588627f},
-std::array<float,2>{0.474203408f, 0.0152964937f},
-std::array<float,2>{0.114568733f, 0.945881426f},
-std::array<float,2>{0.615950704f, 0.126057625f},
-std::array<float,2>{0.991071105f, 0.723883331f},
-std::array<float,2>{0.42841655f, 0.476725817f},
-std::array<float,2>{0.343616217f, 0.621064842f},
-std::array<float,2>{0.767267227f, 0.267514229f},
-std::array<float,2>{0.647759199f, 0.846541107f},
-std::array<float,2>{0.22593838f, 0.0847831219f},
-std::array<float,2>{0.439196825f, 0.79800117f},
-std::array<float,2>{0.905894041f, 0.0606964752f},
-std::array<float,2>{0.560307503f, 0.533046424f},
-std::array<float,2>{0.0575825088f, 0.339562744f},
-std::array<float,2>{0.132490873f, 0.636274099f},
-std::array<float,2>{0.721281886f, 0.404904336f},
-std::array<float,2>{0.816154361f, 0.927437246f},
-std::array<float,2>{0.291098475f, 0.20812729f},
-std::array<float,2>{0.18354319f, 0.918429315f},
-std::array<float,2>{0.715197384f, 0.202613667f},
-std::array<float,2>{0.85105592f, 0.655699492f},
-std::array<float,2>{0.263548493f, 0.375314265f},
-std::array<float,2>{0.491109788f, 0.556491733f},
-std::array<float,2>{0.907566905f, 0.318135202f},
-std::array<float,2>{0.515594244f, 0.78166455f},
-std::array<float,2>{0.00437713042f, 0.0423939638f},
-std::array<float,2>{0.357162505f, 0.873772204f},
-std::array<float,2>{0.790089965f, 0.0672862604f},
-std::array<float,2>{0.664772272f, 0.601615727f},
-std::array<float,2>{0.206711382f, 0.263384342f},
-std::array<float,2>{0.075313881f, 0.736225724f},
-std::array<float,2>{0.583122373f, 0.499535412f},
-std::array<float,2>{0.953093588f, 0.95577234f},
-std::array<float,2>{0.38853991f, 0.145304501f},
-std::array<float,2>{0.0382764116f, 0.750488758f},
-std::array<float,2>{0.5373438f, 0.0173248202f},
-std::array<float,2>{0.883369803f, 0.512593031f},
-std::array<float,2>{0.468195498f, 0.37477392f},
-std::array<float,2>{0.300976932f, 0.667653441f},
-std::array<float,2>{0.842838109f, 0.432904512f},
-std::array<float,2>{0.73759079f, 0.901138484f},
-std::array<float,2>{0.144206256f, 0.242802963f},
-std::array<float,2>{0.407034189f, 0.978149354f},
-std::array<float,2>{0.977569818f, 0.166481793f},
-std::array<float,2>{0.599602282f, 0.697163165f},
-std::array<float,2>{0.094110325f, 0.438978046f},
-std::array<float,2>{0.24577792f, 0.570653141f},
-std::array<float,2>{0.627555132f, 0.294320703f},
-std::array<float,2>{0.75835526f, 0.815935075f},
-std::array<float,2>{0.327448279f, 0.114186622f},
-std::array<float,2>{0.240261033f, 0.777237415f},
-std::array<float,2>{0.640088797f, 0.00921702478f},
-std::array<float,2>{0.750157714f, 0.519380569f},
-std::array<float,2>{0.313942224f, 0.345133483f},
-std::array<float,2>{0.419522583f, 0.687173188f},
-std::array<float,2>{0.971788347f, 0.412423551f},
-std::array<float,2>{0.607565999f, 0.88280803f},
-std::array<float,2>{0.108423755f, 0.226825133f},
-std::array<float,2>{0.311852336f, 0.994934738f},
-std::array<float,2>{0.828342497f, 0.1784399f},
-std::array<float,2>{0.744379997f, 0.714989483f},
-std::array<float,2>{0.150944427f, 0.455544412f},
-std::array<float,2>{0.0435633734f, 0.579079807f},
-std::array<float,2>{0.545001268f, 0.301505297f},
-std::array<float,2>{0.880925953f, 0.836013258f},
-std::array<float,2>{0.456651866f, 0.100650832f},
-std::array<float,2>{0.0632163361f, 0.921960413f},
-std::array<float,2>{0.586360097f, 0.203929588f},
-std::array<float,2>{0.942444861f, 0.638013065f},
-std::array<float,2>{0.379259855f, 0.402207673f},
-std::array<float,2>{0.350401521f, 0.537828147f},
-std::array<float,2>{0.785502136f, 0.339933366f},
-std::array<float,2>{0.662451267f, 0.803477228f},
-std::array<float,2>{0.21607247f, 0.0557945371f},
-std::array<float,2>{0.494664431f, 0.85125339f},
-std::array<float,2>{0.920425296f, 0.080466941f},
-std::array<float,2>{0.501349211f, 0.623180449f},
-std::array<float,2>{0.00812554453f, 0.271258801f},
-std::array<float,2>{0.175368041f, 0.720355332f},
-std::array<float,2>{0.706891358f, 0.48404327f},
-std::array<float,2>{0.851868629f, 0.950108767f},
-std::array<float,2>{0.25447017f, 0.131210819f},
-std::array<float,2>{0.13793166f, 0.959949195f},
-std::array<float,2>{0.732288182f, 0.14250429f},
-std::array<float,2>{0.821356595f, 0.742005408f},
-std::array<float,2>{0.287459075f, 0.493357062f},
-std::array<float,2>{0.446876526f, 0.609364033f},
-std::array<float,2>{0.898326933f, 0.258138508f},
-std::array<float,2>{0.549241543f, 0.869413793f},
-std::array<float,2>{0.049480062f, 0.0634464175f},
-std::array<float,2>{0.330084175f, 0.788763165f},
-std::array<float,2>{0.774735808f, 0.0431300737f},
-std::array<float,2>{0.653563976f, 0.562055767f},
-std::array<float,2>{0.228947714f, 0.315543622f},
-std::array<float,2>{0.124034218f, 0.649528503f},
-std::array<float,2>{0.617692232f, 0.382511824f},
-std::array<float,2>{0.999683201f, 0.91461277f},
-std::array<float,2>{0.434728682f, 0.19671835f},
-std::array<float,2>{0.0186238904f, 0.819010317f},
-std::array<float,2>{0.530793786f, 0.112289488f},
-std::array<float,2>{0.924827337f, 0.576146722f},
-std::array<float,2>{0.480509013f, 0.289363176f},
-std::array<float,2>{0.265946299f, 0.70251894f},
-std::array<float,2>{0.871548712f, 0.44511795f},
-std::array<float,2>{0.693439424f, 0.980939806f},
-std::array<float,2>{0.16853483f, 0.169547737f},
-std::array<float,2>{0.405239224f, 0.905507982f},
-std::array<float,2>{0.957806051f, 0.24621135f},
-std::array<float,2>{0.576355457f, 0.671755672f},
-std::array<float,2>{0.0864877924f, 0.437434435f},
-std::array<float,2>{0.202152312f, 0.511254251f},
-std::array<float,2>{0.675977707f, 0.37051931f},
-std::array<float,2>{0.806527436f, 0.755291998f},
-std::array<float,2>{0.368513435f, 0.0223998055f},
-std::array<float,2>{0.163739577f, 0.862392783f},
-std::array<float,2>{0.698052168f, 0.0747773945f},
-std::array<float,2>{0.864721298f, 0.600057185f},
-std::array<float,2>{0.281146139f, 0.257336587f},
-std::array<float,2>{0.471478939f, 0.748911858f},
-std::array<float,2>{0.93300879f, 0.485227734f},
-std::array<float,2>{0.522868812f, 0.96734488f},
-std::array<float,2>{0.0246888585f, 0.15295738f},
-std::array<float,2>{0.360512763f, 0.907304108f},
-std::array<float,2>{0.797491252f, 0.189590663f},
-std::array<float,2>{0.686456263f, 0.645310044f},
-std::array<float,2>{0.18766886f, 0.386788607f},
-std::array<float,2>{0.0795799121f, 0.548233747f},
-std::array<float,2>{0.56422317f, 0.323157042f},
-std::array<float,2>{0.961646318f, 0.792770147f},
-std::array<float,2>{0.39117381f, 0.0325108021f},
-std::array<float,2>{0.0596592836f, 0.973334849f},
-std::array<float,2>{0.556355059f, 0.161515996f},
-std::array<float,2>{0.900530338f, 0.691883504f},
-std::array<float,2>{0.445111632f, 0.452334851f},
-std::array<float,2>{0.296459019f, 0.565107524f},
-std::array<float,2>{0.816659093f, 0.284099847f},
-std::array<float,2>{0.723822474f, 0.827686012f},
-std::array<float,2>{0.12857841f, 0.119427711f},
-std::array<float,2>{0.422417998f, 0.757957637f},
-std::array<float,2>{0.987151742f, 0.0290898979f},
-std::array<float,2>{0.612519681f, 0.504267991f},
-std::array<float,2>{0.111057796f, 0.363597929f},
-std::array<float,2>{0.220015645f, 0.65631175f},
-std::array<float,2>{0.640782773f, 0.429506212f},
-std::array<float,2>{0.772540927f, 0.89167428f},
-std::array<float,2>{0.3381477f, 0.2399275f},
-std::array<float,2>{0.210019439f, 0.889019907f},
-std::array<float,2>{0.67144841f, 0.223108098f},
-std::array<float,2>{0.796826124f, 0.679330468f},
-std::array<float,2>{0.353773803f, 0.42069757f},
-std::array<float,2>{0.382888287f, 0.526402473f},
-std::array<float,2>{0.946126044f, 0.359319389f},
-std::array<float,2>{0.581506252f, 0.769775033f},
-std::array<float,2>{0.0704491958f, 0.00545980502f},
-std::array<float,2>{0.259694636f, 0.832787037f},
-std::array<float,2>{0.845710516f, 0.103497952f},
-std::array<float,2>{0.713527858f, 0.59234482f},
-std::array<float,2>{0.184432179f, 0.305605441f},
-std::array<float,2>{0.00357622933f, 0.707711101f},
-std::array<float,2>{0.510696411f, 0.466144741f},
-std::array<float,2>{0.912939131f, 0.987278998f},
-std::array<float,2>{0.485119313f, 0.182450399f},
-std::array<float,2>{0.10082978f, 0.80901593f},
-std::array<float,2>{0.593883038f, 0.0545710251f},
-std::array<float,2>{0.982917845f, 0.541697979f},
-std::array<float,2>{0.413101256f, 0.328263134f},
-std::array<float,2>{0.322970539f, 0.62696439f},
-std::array<float,2>{0.764217615f, 0.392732829f},
-std::array<float,2>{0.631292105f, 0.930458307f},
-std::array<float,2>{0.246779308f, 0.218226612f},
-std::array<float,2>{0.463965088f, 0.94135654f},
-std::array<float,2>{0.889588416f, 0.13682346f},
-std::array<float,2>{0.534933925f, 0.73197639f},
-std::array<float,2>{0.032822825f, 0.475502938f},
-std::array<float,2>{0.147142664f, 0.61288619f},
-std::array<float,2>{0.74058187f, 0.277800769f},
-std::array<float,2>{0.837834477f, 0.854547799f},
-std::array<float,2>{0.300338835f, 0.0905095637f},
-std::array<float,2>{0.179338992f, 0.763238966f},
-std::array<float,2>{0.71003437f, 0.0236359928f},
-std::array<float,2>{0.858699083f, 0.503397644f},
-std::array<float,2>{0.252218693f, 0.361431539f},
-std::array<float,2>{0.497946352f, 0.661780357f},
-std::array<float,2>{0.915174603f, 0.425671518f},
-std::array<float,2>{0.505753219f, 0.897449911f},
-std::array<float,2>{0.0155438017f, 0.234646991f},
-std::array<float,2>{0.347171426f, 0.972433507f},
-std::array<float,2>{0.783083916f, 0.159712553f},
-std::array<float,2>{0.658726871f, 0.690856814f},
-std::array<float,2>{0.214763716f, 0.446313143f},
-std::array<float,2>{0.0678283423f, 0.568017244f},
-std::array<float,2>{0.593138754f, 0.288662642f},
-std::array<float,2>{0.938719928f, 0.820949733f},
-std::array<float,2>{0.37598297f, 0.121455953f},
-std::array<float,2>{0.0414060429f, 0.910604417f},
-std::array<float,2>{0.540877163f, 0.191809162f},
-std::array<float,2>{0.87644577f, 0.640946567f},
-std::array<float,2>{0.458249778f, 0.382887006f},
-std::array<float,2>{0.30814901f, 0.55328232f},
-std::array<float,2>{0.835620403f, 0.327971041f},
-std::array<float,2>{0.746124625f, 0.79552263f},
-std::array<float,2>{0.153992206f, 0.0355388336f},
-std::array<float,2>{0.414850771f, 0.863451362f},
-std::array<float,2>{0.974151433f, 0.0720233247f},
-std::array<float,2>{0.605347931f, 0.596262395f},
-std::array<float,2>{0.102555484f, 0.250457972f},
-std::array<float,2>{0.236444324f, 0.742686987f},
-std::array<float,2>{0.63364929f, 0.492087543f},
-std::array<float,2>{0.756101906f, 0.96431154f},
-std::array<float,2>{0.319023758f, 0.148531452f},
-std::array<float,2>{0.196243003f, 0.941860497f},
-std::array<float,2>{0.674699843f, 0.135785028f},
-std::array<float,2>{0.811280191f, 0.726624012f},
-std::array<float,2>{0.372313917f, 0.470243275f},
-std::array<float,2>{0.400557399f, 0.616919935f},
-std::array<float,2>{0.95604831f, 0.275497109f},
-std::array<float,2>{0.571824431f, 0.857327759f},
-std::array<float,2>{0.0936909914f, 0.0898319334f},
-std::array<float,2>{0.270005286f, 0.805632055f},
-std::array<float,2>{0.87084502f, 0.0501327589f},
-std::array<float,2>{0.68848139f, 0.546395957f},
-std::array<float,2>{0.166068345f, 0.332949728f},
-std::array<float,2>{0.0203744657f, 0.630329013f},
-std::array<float,2>{0.525380909f, 0.397988349f},
-std::array<float,2>{0.927046955f, 0.935761571f},
-std::array<float,2>{0.477571577f, 0.213821739f},
-std::array<float,2>{0.119297236f, 0.830269456f},
-std::array<float,2>{0.621695638f, 0.106525473f},
-std::array<float,2>{0.993995309f, 0.588121116f},
-std::array<float,2>{0.429761291f, 0.309586555f},
-std::array<float,2>{0.333658576f, 0.706162632f},
-std::array<float,2>{0.779568255f, 0.46195668f},
-std::array<float,2>{0.652154863f, 0.988997459f},
-std::array<float,2>{0.231137604f, 0.18440938f},
-std::array<float,2>{0.452990413f, 0.883532882f},
-std::array<float,2>{0.891360164f, 0.219762191f},
-std::array<float,2>{0.554357469f, 0.673949838f},
-std::array<float,2>{0.0537821613f, 0.414464802f},
-std::array<float,2>{0.135473654f, 0.52760756f},
-std::array<float,2>{0.726871192f, 0.355207294f},
-std::array<float,2>{0.826672912f, 0.766275227f},
-std::array<float,2>{0.282256544f, 0.0018335213f},
-std::array<float,2>{0.22356379f, 0.845375657f},
-std::array<float,2>{0.646104932f, 0.0839687511f},
-std::array<float,2>{0.768382072f, 0.618597507f},
-std::array<float,2>{0.341402173f, 0.268879116f},
-std::array<float,2>{0.426049441f, 0.726209283f},
-std::array<float,2>{0.988579988f, 0.479366958f},
-std::array<float,2>{0.613666117f, 0.949106753f},
-std::array<float,2>{0.115832649f, 0.127798542f},
-std::array<float,2>{0.289157152f, 0.928238392f},
-std::array<float,2>{0.813137949f, 0.209841743f},
-std::array<float,2>{0.718847096f, 0.634051025f},
-std::array<float,2>{0.130256072f, 0.403531104f},
-std::array<float,2>{0.0550280474f, 0.533420503f},
-std::array<float,2>{0.561803401f, 0.336895496f},
-std::array<float,2>{0.903559268f, 0.799087703f},
-std::array<float,2>{0.441340476f, 0.0590527654f},
-std::array<float,2>{0.0841391385f, 0.998216867f},
-std::array<float,2>{0.570191085f, 0.175681025f},
-std::array<float,2>{0.967134833f, 0.711018443f},
-std::array<float,2>{0.397259206f, 0.457302809f},
-std::array<float,2>{0.367098093f, 0.582344174f},
-std::array<float,2>{0.804298878f, 0.300034195f},
-std::array<float,2>{0.68015945f, 0.840387642f},
-std::array<float,2>{0.192242146f, 0.0971715972f},
-std::array<float,2>{0.476471722f, 0.778265297f},
-std::array<float,2>{0.936470687f, 0.0134380851f},
-std::array<float,2>{0.515939713f, 0.519980788f},
-std::array<float,2>{0.0310734436f, 0.349168688f},
-std::array<float,2>{0.158011124f, 0.681588471f},
-std::array<float,2>{0.700891972f, 0.407374442f},
-std::array<float,2>{0.863280535f, 0.878024578f},
-std::array<float,2>{0.276068807f, 0.232116193f},
-std::array<float,2>{0.142511219f, 0.89903599f},
-std::array<float,2>{0.734600484f, 0.244311273f},
-std::array<float,2>{0.841447234f, 0.665637076f},
-std::array<float,2>{0.303997546f, 0.430252224f},
-std::array<float,2>{0.466638923f, 0.514131963f},
-std::array<float,2>{0.886333346f, 0.371595383f},
-std::array<float,2>{0.53678441f, 0.753032863f},
-std::array<float,2>{0.0365038589f, 0.0194472633f},
-std::array<float,2>{0.32528618f, 0.81348598f},
-std::array<float,2>{0.76128906f, 0.116169803f},
-std::array<float,2>{0.626568675f, 0.572527349f},
-std::array<float,2>{0.243705884f, 0.296805352f},
-std::array<float,2>{0.0974648073f, 0.698742568f},
-std::array<float,2>{0.600093782f, 0.44126597f},
-std::array<float,2>{0.978699028f, 0.979854643f},
-std::array<float,2>{0.409746408f, 0.164822042f},
-std::array<float,2>{0.0063302177f, 0.78416276f},
-std::array<float,2>{0.512645602f, 0.0410075821f},
-std::array<float,2>{0.908547223f, 0.557945311f},
-std::array<float,2>{0.489078343f, 0.320144266f},
-std::array<float,2>{0.26520893f, 0.653810561f},
-std::array<float,2>{0.849009216f, 0.37872237f},
-std::array<float,2>{0.716946244f, 0.921291649f},
-std::array<float,2>{0.179758385f, 0.201085448f},
-std::array<float,2>{0.389260441f, 0.953802705f},
-std::array<float,2>{0.949385524f, 0.146541372f},
-std::array<float,2>{0.584609747f, 0.737457991f},
-std::array<float,2>{0.0762541145f, 0.497965157f},
-std::array<float,2>{0.204613149f, 0.603894532f},
-std::array<float,2>{0.66673398f, 0.26524812f},
-std::array<float,2>{0.792937577f, 0.871346235f},
-std::array<float,2>{0.358886033f, 0.0698206797f},
-std::array<float,2>{0.218668386f, 0.801418841f},
-std::array<float,2>{0.662027001f, 0.0570394881f},
-std::array<float,2>{0.788460553f, 0.535176814f},
-std::array<float,2>{0.348274827f, 0.341845721f},
-std::array<float,2>{0.380894661f, 0.639568806f},
-std::array<float,2>{0.94466579f, 0.399947047f},
-std::array<float,2>{0.588271141f, 0.924651265f},
-std::array<float,2>{0.0655701607f, 0.205496192f},
-std::array<float,2>{0.25595507f, 0.953032434f},
-std::array<float,2>{0.854995847f, 0.129171014f},
-std::array<float,2>{0.703281045f, 0.721645951f},
-std::array<float,2>{0.173507899f, 0.48222208f},
-std::array<float,2>{0.010910796f, 0.621246755f},
-std::array<float,2>{0.503383994f, 0.272558302f},
-std::array<float,2>{0.919412315f, 0.849188149f},
-std::array<float,2>{0.492772549f, 0.0792026073f},
-std::array<float,2>{0.105571486f, 0.87929213f},
-std::array<float,2>{0.606266022f, 0.229159087f},
-std::array<float,2>{0.969819188f, 0.684794664f},
-std::array<float,2>{0.420764685f, 0.411673963f},
-std::array<float,2>{0.31528151f, 0.517568946f},
-std::array<float,2>{0.752835333f, 0.347607255f},
-std::array<float,2>{0.637449026f, 0.775187969f},
-std::array<float,2>{0.239381731f, 0.0114702173f},
-std::array<float,2>{0.454494804f, 0.838501513f},
-std::array<float,2>{0.880338252f, 0.0992851257f},
-std::array<float,2>{0.543981731f, 0.580501139f},
-std::array<float,2>{0.0459553152f, 0.304223359f},
-std::array<float,2>{0.149767712f, 0.718719006f},
-std::array<float,2>{0.742382824f, 0.454418033f},
-std::array<float,2>{0.830887258f, 0.992822766f},
-std::array<float,2>{0.309956461f, 0.176773414f},
-std::array<float,2>{0.171095639f, 0.983344376f},
-std::array<float,2>{0.692421615f, 0.170796633f},
-std::array<float,2>{0.874272406f, 0.699267268f},
-std::array<float,2>{0.268335879f, 0.442272604f},
-std::array<float,2>{0.484294176f, 0.57748872f},
-std::array<float,2>{0.922182798f, 0.292604417f},
-std::array<float,2>{0.528191566f, 0.817043424f},
-std::array<float,2>{0.0162168499f, 0.110396788f},
-std::array<float,2>{0.370346189f, 0.756828129f},
-std::array<float,2>{0.807045043f, 0.0200159755f},
-std::array<float,2>{0.679331601f, 0.509392977f},
-std::array<float,2>{0.20055519f, 0.368308872f},
-std::array<float,2>{0.0897601768f, 0.669284165f},
-std::array<float,2>{0.574697495f, 0.434766501f},
-std::array<float,2>{0.960358202f, 0.902766168f},
-std::array<float,2>{0.403317124f, 0.248497799f},
-std::array<float,2>{0.0481738523f, 0.867862582f},
-std::array<float,2>{0.548084974f, 0.0650310591f},
-std::array<float,2>{0.894935429f, 0.60679847f},
-std::array<float,2>{0.447886795f, 0.261377156f},
-std::array<float,2>{0.287082195f, 0.738580644f},
-std::array<float,2>{0.823979855f, 0.494967848f},
-std::array<float,2>{0.733372331f, 0.958378971f},
-std::array<float,2>{0.139492288f, 0.143851623f},
-std::array<float,2>{0.437327266f, 0.917708337f},
-std::array<float,2>{0.996700108f, 0.198584765f},
-std::array<float,2>{0.619560242f, 0.651843548f},
-std::array<float,2>{0.121185414f, 0.380239934f},
-std::array<float,2>{0.227316678f, 0.559825122f},
-std::array<float,2>{0.655079424f, 0.313854694f},
-std::array<float,2>{0.776137054f, 0.786912858f},
-std::array<float,2>{0.329625696f, 0.0467074774f},
-std::array<float,2>{0.12643528f, 0.824234605f},
-std::array<float,2>{0.724631965f, 0.11900726f},
-std::array<float,2>{0.820172727f, 0.562575459f},
-std::array<float,2>{0.294255227f, 0.282169878f},
-std::array<float,2>{0.442409724f, 0.694885015f},
-std::array<float,2>{0.898810625f, 0.450119227f},
-std::array<float,2>{0.557189643f, 0.975192428f},
-std::array<float,2>{0.0622193627f, 0.163011447f},
-std::array<float,2>{0.337631941f, 0.892801166f},
-std::array<float,2>{0.769767225f, 0.242154852f},
-std::array<float,2>{0.643172622f, 0.65829438f},
-std::array<float,2>{0.222161427f, 0.427672297f},
-std::array<float,2>{0.111540534f, 0.506276011f},
-std::array<float,2>{0.610977471f, 0.365387738f},
-std::array<float,2>{0.98492974f, 0.761200964f},
-std::array<float,2>{0.423851699f, 0.0293179471f},
-std::array<float,2>{0.0265184734f, 0.964879155f},
-std::array<float,2>{0.52003932f, 0.15547207f},
-std::array<float,2>{0.930814981f, 0.748001218f},
-std::array<float,2>{0.469213277f, 0.486923128f},
-std::array<float,2>{0.277875602f, 0.598217309f},
-std::array<float,2>{0.866869271f, 0.255408406f},
-std::array<float,2>{0.69671005f, 0.859980643f},
-std::array<float,2>{0.160231218f, 0.0774282217f},
-std::array<float,2>{0.393341541f, 0.790025473f},
-std::array<float,2>{0.964468122f, 0.035063982f},
-std::array<float,2>{0.56581068f, 0.549743712f},
-std::array<float,2>{0.0805428773f, 0.322070926f},
-std::array<float,2>{0.190868586f, 0.648032963f},
-std::array<float,2>{0.684293687f, 0.389893621f},
-std::array<float,2>{0.799338341f, 0.908283412f},
-std::array<float,2>{0.361798167f, 0.188386023f},
-std::array<float,2>{0.248724714f, 0.932621956f},
-std::array<float,2>{0.629763246f, 0.215959892f},
-std::array<float,2>{0.762164414f, 0.625224352f},
-std::array<float,2>{0.321907282f, 0.391463161f},
-std::array<float,2>{0.411579639f, 0.540455639f},
-std::array<float,2>{0.980881035f, 0.330778897f},
-std::array<float,2>{0.596209288f, 0.811071098f},
-std::array<float,2>{0.097750932f, 0.0518496819f},
-std::array<float,2>{0.297230631f, 0.851770997f},
-std::array<float,2>{0.838088393f, 0.093677938f},
-std::array<float,2>{0.739971042f, 0.610312939f},
-std::array<float,2>{0.144533694f, 0.281182289f},
-std::array<float,2>{0.0337190069f, 0.733910143f},
-std::array<float,2>{0.533180773f, 0.473504484f},
-std::array<float,2>{0.887436688f, 0.938203275f},
-std::array<float,2>{0.462092698f, 0.139545724f},
-std::array<float,2>{0.073358193f, 0.77324295f},
-std::array<float,2>{0.579685032f, 0.00742701674f},
-std::array<float,2>{0.947875679f, 0.524442375f},
-std::array<float,2>{0.385552883f, 0.356608778f},
-std::array<float,2>{0.352288961f, 0.676028728f},
-std::array<float,2>{0.794462621f, 0.418829083f},
-std::array<float,2>{0.669833601f, 0.888055503f},
-std::array<float,2>{0.207819775f, 0.225562528f},
-std::array<float,2>{0.487790763f, 0.985194743f},
-std::array<float,2>{0.911439419f, 0.180092633f},
-std::array<float,2>{0.508162856f, 0.710357964f},
-std::array<float,2>{0.000268340547f, 0.467464387f},
-std::array<float,2>{0.186699763f, 0.590149403f},
-std::array<float,2>{0.712185919f, 0.306851566f},
-std::array<float,2>{0.84493643f, 0.834659338f},
-std::array<float,2>{0.261102468f, 0.105182484f},
-std::array<float,2>{0.167185634f, 0.806989789f},
-std::array<float,2>{0.687719643f, 0.0470508263f},
-std::array<float,2>{0.869494855f, 0.543079376f},
-std::array<float,2>{0.271261275f, 0.334573179f},
-std::array<float,2>{0.476945072f, 0.631860971f},
-std::array<float,2>{0.925912261f, 0.395261884f},
-std::array<float,2>{0.523569942f, 0.933993161f},
-std::array<float,2>{0.0210418906f, 0.211014152f},
-std::array<float,2>{0.371243954f, 0.944069147f},
-std::array<float,2>{0.811721087f, 0.133366883f},
-std::array<float,2>{0.674839377f, 0.72953707f},
-std::array<float,2>{0.196966052f, 0.472345442f},
-std::array<float,2>{0.0919836462f, 0.614665747f},
-std::array<float,2>{0.570675075f, 0.274302542f},
-std::array<float,2>{0.956088006f, 0.857764304f},
-std::array<float,2>{0.402326077f, 0.0874479413f},
-std::array<float,2>{0.0529016443f, 0.884777486f},
-std::array<float,2>{0.553065717f, 0.221256569f},
-std::array<float,2>{0.892557621f, 0.67330718f},
-std::array<float,2>{0.451230317f, 0.416732639f},
-std::array<float,2>{0.281700194f, 0.531009793f},
-std::array<float,2>{0.827562451f, 0.351593614f},
-std::array<float,2>{0.728042305f, 0.769340456f},
-std::array<float,2>{0.136716917f, 0.00353986234f},
-std::array<float,2>{0.431417257f, 0.829453707f},
-std::array<float,2>{0.992511392f, 0.108597673f},
-std::array<float,2>{0.622813582f, 0.587220013f},
-std::array<float,2>{0.120579489f, 0.311389178f},
-std::array<float,2>{0.231672764f, 0.704657853f},
-std::array<float,2>{0.650964797f, 0.464065492f},
-std::array<float,2>{0.780524075f, 0.990875125f},
-std::array<float,2>{0.332449049f, 0.186246395f},
-std::array<float,2>{0.21344772f, 0.969770968f},
-std::array<float,2>{0.659449697f, 0.157171011f},
-std::array<float,2>{0.781586647f, 0.687991619f},
-std::array<float,2>{0.346214056f, 0.448571384f},
-std::array<float,2>{0.375695676f, 0.568530858f},
-std::array<float,2>{0.93799597f, 0.286354214f},
-std::array<float,2>{0.59238708f, 0.822966039f},
-std::array<float,2>{0.0671914667f, 0.123422652f},
-std::array<float,2>{0.253134429f, 0.765366614f},
-std::array<float,2>{0.858184159f, 0.0270723905f},
-std::array<float,2>{0.709197342f, 0.50089246f},
-std::array<float,2>{0.178208441f, 0.360866785f},
-std::array<float,2>{0.0141134681f, 0.662550867f},
-std::array<float,2>{0.504668295f, 0.422309995f},
-std::array<float,2>{0.914134383f, 0.894769907f},
-std::array<float,2>{0.496617675f, 0.238137767f},
-std::array<float,2>{0.101967238f, 0.867176831f},
-std::array<float,2>{0.603622079f, 0.0737550035f},
-std::array<float,2>{0.972818971f, 0.594398499f},
-std::array<float,2>{0.415039301f, 0.253889412f},
-std::array<float,2>{0.319438279f, 0.745155871f},
-std::array<float,2>{0.757171214f, 0.488483459f},
-std::array<float,2>{0.634056151f, 0.961298168f},
-std::array<float,2>{0.238246679f, 0.15133737f},
-std::array<float,2>{0.457494736f, 0.913526177f},
-std::array<float,2>{0.875482261f, 0.194465071f},
-std::array<float,2>{0.539802313f, 0.643586457f},
-std::array<float,2>{0.0424770974f, 0.385498703f},
-std::array<float,2>{0.153184742f, 0.55163604f},
-std::array<float,2>{0.748004079f, 0.325599492f},
-std::array<float,2>{0.834016621f, 0.794276118f},
-std::array<float,2>{0.306719393f, 0.0379405469f},
-std::array<float,2>{0.242519781f, 0.815058529f},
-std::array<float,2>{0.625763834f, 0.114712387f},
-std::array<float,2>{0.760451853f, 0.571935475f},
-std::array<float,2>{0.324282378f, 0.293641984f},
-std::array<float,2>{0.408571482f, 0.69596982f},
-std::array<float,2>{0.980296135f, 0.437815398f},
-std::array<float,2>{0.600707769f, 0.977415383f},
-std::array<float,2>{0.0964467302f, 0.167060539f},
-std::array<float,2>{0.303201228f, 0.901482999f},
-std::array<float,2>{0.840747833f, 0.244112656f},
-std::array<float,2>{0.735899985f, 0.666900694f},
-std::array<float,2>{0.141455188f, 0.432456702f},
-std::array<float,2>{0.0351605415f, 0.513474047f},
-std::array<float,2>{0.535926163f, 0.37321794f},
-std::array<float,2>{0.88552916f, 0.751463711f},
-std::array<float,2>{0.464948624f, 0.0158967711f},
-std::array<float,2>{0.0775559768f, 0.956802309f},
-std::array<float,2>{0.585274696f, 0.146436468f},
-std::array<float,2>{0.950351715f, 0.734443307f},
-std::array<float,2>{0.390022695f, 0.498327464f},
-std::array<float,2>{0.358129591f, 0.602586627f},
-std::array<float,2>{0.791097581f, 0.26215151f},
-std::array<float,2>{0.667616785f, 0.87465626f},
-std::array<float,2>{0.203713194f, 0.0673867464f},
-std::array<float,2>{0.489280283f, 0.782570481f},
-std::array<float,2>{0.909803927f, 0.0415381342f},
-std::array<float,2>{0.513613224f, 0.554812193f},
-std::array<float,2>{0.00701857265f, 0.316749394f},
-std::array<float,2>{0.181178287f, 0.654378116f},
-std::array<float,2>{0.718531251f, 0.376846224f},
-std::array<float,2>{0.848141491f, 0.919784307f},
-std::array<float,2>{0.264437973f, 0.201415405f},
-std::array<float,2>{0.129190728f, 0.92601043f},
-std::array<float,2>{0.720272481f, 0.207233682f},
-std::array<float,2>{0.813927174f, 0.635133266f},
-std::array<float,2>{0.290044159f, 0.405503899f},
-std::array<float,2>{0.439501613f, 0.531837523f},
-std::array<float,2>{0.902867496f, 0.338789493f},
-std::array<float,2>{0.56059885f, 0.797446489f},
-std::array<float,2>{0.05608337f, 0.0623598248f},
-std::array<float,2>{0.340493202f, 0.846867204f},
-std::array<float,2>{0.76932174f, 0.0854156092f},
-std::array<float,2>{0.6454404f, 0.619847536f},
-std::array<float,2>{0.224336028f, 0.265938491f},
-std::array<float,2>{0.116699129f, 0.722977281f},
-std::array<float,2>{0.614725411f, 0.477975368f},
-std::array<float,2>{0.989456713f, 0.946640909f},
-std::array<float,2>{0.427340895f, 0.125614986f},
-std::array<float,2>{0.0302675031f, 0.779687405f},
-std::array<float,2>{0.517054081f, 0.0141101154f},
-std::array<float,2>{0.93736732f, 0.523320019f},
-std::array<float,2>{0.474843293f, 0.350086719f},
-std::array<float,2>{0.276905864f, 0.682290971f},
-std::array<float,2>{0.862207472f, 0.409304351f},
-std::array<float,2>{0.699416697f, 0.875975132f},
-std::array<float,2>{0.156711772f, 0.233901992f},
-std::array<float,2>{0.398234636f, 0.99736166f},
-std::array<float,2>{0.968001127f, 0.172651753f},
-std::array<float,2>{0.568375826f, 0.714473784f},
-std::array<float,2>{0.0857703313f, 0.460672945f},
-std::array<float,2>{0.19325763f, 0.585036993f},
-std::array<float,2>{0.680964291f, 0.297757387f},
-std::array<float,2>{0.802949488f, 0.842429757f},
-std::array<float,2>{0.365477651f, 0.0943750814f},
-std::array<float,2>{0.199353784f, 0.754502356f},
-std::array<float,2>{0.678421855f, 0.0225893315f},
-std::array<float,2>{0.808453679f, 0.509885252f},
-std::array<float,2>{0.370004654f, 0.369708806f},
-std::array<float,2>{0.403341472f, 0.670435667f},
-std::array<float,2>{0.959397674f, 0.436247319f},
-std::array<float,2>{0.576110184f, 0.905208111f},
-std::array<float,2>{0.0880784243f, 0.247871846f},
-std::array<float,2>{0.269287556f, 0.981815279f},
-std::array<float,2>{0.873683572f, 0.168191373f},
-std::array<float,2>{0.69209516f, 0.701985955f},
-std::array<float,2>{0.16997391f, 0.4435606f},
-std::array<float,2>{0.0173519719f, 0.574457169f},
-std::array<float,2>{0.529241085f, 0.290597737f},
-std::array<float,2>{0.923634052f, 0.819402695f},
-std::array<float,2>{0.483326882f, 0.11249204f},
-std::array<float,2>{0.122680642f, 0.915689349f},
-std::array<float,2>{0.620780706f, 0.195363253f},
-std::array<float,2>{0.997874916f, 0.64862442f},
-std::array<float,2>{0.436198473f, 0.381564111f},
-std::array<float,2>{0.329021484f, 0.561063349f},
-std::array<float,2>{0.77699846f, 0.315246969f},
-std::array<float,2>{0.655695617f, 0.787163079f},
-std::array<float,2>{0.228306174f, 0.0443016998f},
-std::array<float,2>{0.448707908f, 0.870851696f},
-std::array<float,2>{0.896389961f, 0.0641665682f},
-std::array<float,2>{0.547684133f, 0.607827127f},
-std::array<float,2>{0.0469217785f, 0.259010911f},
-std::array<float,2>{0.139657035f, 0.740571976f},
-std::array<float,2>{0.733535349f, 0.493020952f},
-std::array<float,2>{0.822977364f, 0.96042347f},
-std::array<float,2>{0.285280585f, 0.141047493f},
-std::array<float,2>{0.171954677f, 0.951104105f},
-std::array<float,2>{0.704262197f, 0.132109165f},
-std::array<float,2>{0.854360938f, 0.719660997f},
-std::array<float,2>{0.257605791f, 0.483291179f},
-std::array<float,2>{0.493968278f, 0.62440294f},
-std::array<float,2>{0.918370068f, 0.269999087f},
-std::array<float,2>{0.5023067f, 0.849699795f},
-std::array<float,2>{0.0099629201f, 0.0819172561f},
-std::array<float,2>{0.349105775f, 0.804120064f},
-std::array<float,2>{0.787466943f, 0.0556297041f},
-std::array<float,2>{0.660412252f, 0.538838565f},
-std::array<float,2>{0.217061535f, 0.341714412f},
-std::array<float,2>{0.0651553199f, 0.637026131f},
-std::array<float,2>{0.588978529f, 0.401271582f},
-std::array<float,2>{0.94424665f, 0.923219681f},
-std::array<float,2>{0.382163078f, 0.204707056f},
-std::array<float,2>{0.045260489f, 0.837307453f},
-std::array<float,2>{0.543927014f, 0.0998912454f},
-std::array<float,2>{0.879596472f, 0.579478443f},
-std::array<float,2>{0.454045534f, 0.302345365f},
-std::array<float,2>{0.308865249f, 0.716475308f},
-std::array<float,2>{0.831960857f, 0.456624061f},
-std::array<float,2>{0.743839681f, 0.995622694f},
-std::array<float,2>{0.148919716f, 0.179457694f},
-std::array<float,2>{0.421028793f, 0.881315112f},
-std::array<float,2>{0.969588816f, 0.227632731f},
-std::array<float,2>{0.606702387f, 0.686340511f},
-std::array<float,2>{0.106479809f, 0.413996071f},
-std::array<float,2>{0.238932833f, 0.517723203f},
-std::array<float,2>{0.637924671f, 0.344399184f},
-std::array<float,2>{0.753311276f, 0.775632262f},
-std::array<float,2>{0.316247135f, 0.00824793708f},
-std::array<float,2>{0.145637318f, 0.853654683f},
-std::array<float,2>{0.739150286f, 0.0909554809f},
-std::array<float,2>{0.839626729f, 0.611558199f},
-std::array<float,2>{0.298663318f, 0.278682679f},
-std::array<float,2>{0.461512208f, 0.731189907f},
-std::array<float,2>{0.88775295f, 0.475970268f},
-std::array<float,2>{0.532039404f, 0.940077007f},
-std::array<float,2>{0.0342306197f, 0.138076425f},
-std::array<float,2>{0.321158767f, 0.931322873f},
-std::array<float,2>{0.762776494f, 0.21685712f},
-std::array<float,2>{0.630372465f, 0.628024876f},
-std::array<float,2>{0.249220654f, 0.39360559f},
-std::array<float,2>{0.099550277f, 0.54259944f},
-std::array<float,2>{0.597332478f, 0.329174548f},
-std::array<float,2>{0.981631577f, 0.810436428f},
-std::array<float,2>{0.410928041f, 0.0533242561f},
-std::array<float,2>{0.00168772507f, 0.987323582f},
-std::array<float,2>{0.509357452f, 0.183536515f},
-std::array<float,2>{0.910824656f, 0.708699167f},
-std::array<float,2>{0.487216324f, 0.464930207f},
-std::array<float,2>{0.259784877f, 0.592818677f},
-std::array<float,2>{0.844065547f, 0.306432784f},
-std::array<float,2>{0.71161443f, 0.833273649f},
-std::array<float,2>{0.186174124f, 0.101772413f},
-std::array<float,2>{0.386532605f, 0.771246552f},
-std::array<float,2>{0.948546886f, 0.00460639223f},
-std::array<float,2>{0.578231335f, 0.526261091f},
-std::array<float,2>{0.0726493225f, 0.3575629f},
-std::array<float,2>{0.208875418f, 0.677939057f},
-std::array<float,2>{0.668842077f, 0.42116335f},
-std::array<float,2>{0.79316169f, 0.890596151f},
-std::array<float,2>{0.353289366f, 0.224465504f},
-std::array<float,2>{0.221195206f, 0.891319871f},
-std::array<float,2>{0.643677354f, 0.238321379f},
-std::array<float,2>{0.770742238f, 0.657901883f},
-std::array<float,2>{0.336696655f, 0.428319395f},
-std::array<float,2>{0.424905598f, 0.505723298f},
-std::array<float,2>{0.986315727f, 0.364741206f},
-std::array<float,2>{0.609513879f, 0.758850336f},
-std::array<float,2>{0.112631984f, 0.0273542628f},
-std::array<float,2>{0.293075293f, 0.826266348f},
-std::array<float,2>{0.818517208f, 0.120600216f},
-std::array<float,2>{0.725710213f, 0.566259086f},
-std::array<float,2>{0.125119299f, 0.284756362f},
-std::array<float,2>{0.060696438f, 0.693345964f},
-std::array<float,2>{0.558580399f, 0.452056736f},
-std::array<float,2>{0.899917722f, 0.974030554f},
-std::array<float,2>{0.442319363f, 0.16044955f},
-std::array<float,2>{0.0814495012f, 0.791970193f},
-std::array<float,2>{0.565241754f, 0.0321751535f},
-std::array<float,2>{0.962896287f, 0.547696531f},
-std::array<float,2>{0.394492388f, 0.323473036f},
-std::array<float,2>{0.363246381f, 0.645982921f},
-std::array<float,2>{0.80075711f, 0.38841188f},
-std::array<float,2>{0.685186088f, 0.906432748f},
-std::array<float,2>{0.189471528f, 0.190979898f},
-std::array<float,2>{0.470491022f, 0.968475342f},
-std::array<float,2>{0.930159211f, 0.154092193f},
-std::array<float,2>{0.521450877f, 0.749670506f},
-std::array<float,2>{0.0257549454f, 0.48607403f},
-std::array<float,2>{0.161671177f, 0.60148263f},
-std::array<float,2>{0.695380688f, 0.25649792f},
-std::array<float,2>{0.865801394f, 0.861983001f},
-std::array<float,2>{0.278455496f, 0.0755761638f},
-std::array<float,2>{0.133944005f, 0.767449379f},
-std::array<float,2>{0.728893757f, 0.000443408848f},
-std::array<float,2>{0.825475693f, 0.528411984f},
-std::array<float,2>{0.284342766f, 0.353583246f},
-std::array<float,2>{0.450701237f, 0.675529301f},
-std::array<float,2>{0.892600656f, 0.415157259f},
-std::array<float,2>{0.551508248f, 0.88380444f},
-std::array<float,2>{0.0508687571f, 0.219280288f},
-std::array<float,2>{0.33591494f, 0.990206003f},
-std::array<float,2>{0.778073609f, 0.184575066f},
-std::array<float,2>{0.650281489f, 0.70576489f},
-std::array<float,2>{0.233946338f, 0.461040556f},
-std::array<float,2>{0.118456885f, 0.58938539f},
-std::array<float,2>{0.624741316f, 0.309311539f},
-std::array<float,2>{0.996061265f, 0.831168354f},
-std::array<float,2>{0.431895018f, 0.10620515f},
-std::array<float,2>{0.0226841196f, 0.936875165f},
-std::array<float,2>{0.526849151f, 0.21411629f},
-std::array<float,2>{0.929532945f, 0.629124403f},
-std::array<float,2>{0.479773581f, 0.397222281f},
-std::array<float,2>{0.272704601f, 0.544940114f},
-std::array<float,2>{0.867762089f, 0.333669186f},
-std::array<float,2>{0.690733969f, 0.806065857f},
-std::array<float,2>{0.164770544f, 0.0497203842f},
-std::array<float,2>{0.399719298f, 0.855805576f},
-std::array<float,2>{0.953297675f, 0.0881358311f},
-std::array<float,2>{0.573444128f, 0.616128564f},
-std::array<float,2>{0.0903034508f, 0.277142078f},
-std::array<float,2>{0.197403431f, 0.728284001f},
-std::array<float,2>{0.673023582f, 0.469019264f},
-std::array<float,2>{0.809022486f, 0.943080604f},
-std::array<float,2>{0.374076247f, 0.135659948f},
-std::array<float,2>{0.234557673f, 0.96318239f},
-std::array<float,2>{0.635423303f, 0.150029719f},
-std::array<float,2>{0.755836606f, 0.744045556f},
-std::array<float,2>{0.317250609f, 0.490805566f},
-std::array<float,2>{0.416813642f, 0.597284555f},
-std::array<float,2>{0.975794196f, 0.251495063f},
-std::array<float,2>{0.602336526f, 0.864894748f},
-std::array<float,2>{0.104115695f, 0.0711133555f},
-std::array<float,2>{0.305790842f, 0.796844304f},
-std::array<float,2>{0.83305645f, 0.0365332998f},
-std::array<float,2>{0.7487275f, 0.553998053f},
-std::array<float,2>{0.15599817f, 0.326908648f},
-std::array<float,2>{0.0397764668f, 0.641772509f},
-std::array<float,2>{0.542886496f, 0.384011894f},
-std::array<float,2>{0.878886461f, 0.912030578f},
-std::array<float,2>{0.459241122f, 0.192844853f},
-std::array<float,2>{0.0685091987f, 0.821613371f},
-std::array<float,2>{0.590964854f, 0.122770973f},
-std::array<float,2>{0.941254616f, 0.566557944f},
-std::array<float,2>{0.377255678f, 0.287367165f},
-std::array<float,2>{0.343994319f, 0.69020474f},
-std::array<float,2>{0.783649862f, 0.445315152f},
-std::array<float,2>{0.657552838f, 0.971577942f},
-std::array<float,2>{0.211519226f, 0.158344641f},
-std::array<float,2>{0.498435646f, 0.898093641f},
-std::array<float,2>{0.917861462f, 0.235736847f},
-std::array<float,2>{0.506569028f, 0.660952449f},
-std::array<float,2>{0.0131625431f, 0.423966467f},
-std::array<float,2>{0.177350089f, 0.502428651f},
-std::array<float,2>{0.708630204f, 0.36310634f},
-std::array<float,2>{0.856036663f, 0.761885762f},
-std::array<float,2>{0.250150561f, 0.0244770944f},
-std::array<float,2>{0.205776632f, 0.872288823f},
-std::array<float,2>{0.665769577f, 0.0687250644f},
-std::array<float,2>{0.789202273f, 0.605089486f},
-std::array<float,2>{0.3560974f, 0.264337182f},
-std::array<float,2>{0.387125134f, 0.737052798f},
-std::array<float,2>{0.951722085f, 0.496391326f},
-std::array<float,2>{0.582630217f, 0.954843283f},
-std::array<float,2>{0.0744806156f, 0.147696346f},
-std::array<float,2>{0.262126923f, 0.920446813f},
-std::array<float,2>{0.850463986f, 0.199371934f},
-std::array<float,2>{0.715977669f, 0.652622163f},
-std::array<float,2>{0.182299018f, 0.377903283f},
-std::array<float,2>{0.00529852556f, 0.557111084f},
-std::array<float,2>{0.514156461f, 0.319100708f},
-std::array<float,2>{0.906982183f, 0.784322739f},
-std::array<float,2>{0.491939217f, 0.0393475629f},
-std::array<float,2>{0.0954218507f, 0.979213238f},
-std::array<float,2>{0.598086357f, 0.165262654f},
-std::array<float,2>{0.976747155f, 0.697695851f},
-std::array<float,2>{0.407626092f, 0.439885885f},
-std::array<float,2>{0.326719433f, 0.573687196f},
-std::array<float,2>{0.759574771f, 0.294987112f},
-std::array<float,2>{0.628533721f, 0.813186228f},
-std::array<float,2>{0.24466683f, 0.11650151f},
-std::array<float,2>{0.467683882f, 0.752408385f},
-std::array<float,2>{0.884402633f, 0.0184615813f},
-std::array<float,2>{0.538853586f, 0.515209377f},
-std::array<float,2>{0.0373034067f, 0.372879744f},
-std::array<float,2>{0.143127277f, 0.664190292f},
-std::array<float,2>{0.737050653f, 0.431210101f},
-std::array<float,2>{0.842362583f, 0.899912357f},
-std::array<float,2>{0.30243206f, 0.245192394f},
-std::array<float,2>{0.158967227f, 0.877907395f},
-std::array<float,2>{0.701656282f, 0.231186211f},
-std::array<float,2>{0.859850705f, 0.680348814f},
-std::array<float,2>{0.274098903f, 0.40657115f},
-std::array<float,2>{0.472757429f, 0.52116847f},
-std::array<float,2>{0.934395611f, 0.348207593f},
-std::array<float,2>{0.519507647f, 0.778621197f},
-std::array<float,2>{0.0286072772f, 0.0118763661f},
-std::array<float,2>{0.364424258f, 0.841599703f},
-std::array<float,2>{0.801634073f, 0.0962481126f},
-std::array<float,2>{0.682485044f, 0.583103776f},
-std::array<float,2>{0.193876639f, 0.299396902f},
-std::array<float,2>{0.0839401409f, 0.712763965f},
-std::array<float,2>{0.567171991f, 0.4581303f},
-std::array<float,2>{0.965383589f, 0.999431551f},
-std::array<float,2>{0.395458877f, 0.173841059f},
-std::array<float,2>{0.0585828647f, 0.800528884f},
-std::array<float,2>{0.559248984f, 0.0604069829f},
-std::array<float,2>{0.904364407f, 0.534465492f},
-std::array<float,2>{0.438032746f, 0.337797046f},
-std::array<float,2>{0.292437106f, 0.633502722f},
-std::array<float,2>{0.815096259f, 0.402693838f},
-std::array<float,2>{0.722134709f, 0.929091811f},
-std::array<float,2>{0.131250247f, 0.210010514f},
-std::array<float,2>{0.429660439f, 0.947358251f},
-std::array<float,2>{0.991912663f, 0.12811996f},
-std::array<float,2>{0.616943717f, 0.724625647f},
-std::array<float,2>{0.113793992f, 0.479560554f},
-std::array<float,2>{0.224700361f, 0.617730319f},
-std::array<float,2>{0.646586835f, 0.267606139f},
-std::array<float,2>{0.766075432f, 0.843869627f},
-std::array<float,2>{0.341982514f, 0.082519263f},
-std::array<float,2>{0.229819879f, 0.785350144f},
-std::array<float,2>{0.65307498f, 0.0449294895f},
-std::array<float,2>{0.773604691f, 0.558963239f},
-std::array<float,2>{0.331525236f, 0.312988818f},
-std::array<float,2>{0.434341162f, 0.651234388f},
-std::array<float,2>{0.99858737f, 0.378959626f},
-std::array<float,2>{0.619065583f, 0.916473687f},
-std::array<float,2>{0.123673521f, 0.197275028f},
-std::array<float,2>{0.288086027f, 0.957461476f},
-std::array<float,2>{0.821210563f, 0.143167987f},
-std::array<float,2>{0.73115927f, 0.739390969f},
-std::array<float,2>{0.137202486f, 0.496088952f},
-std::array<float,2>{0.0502592549f, 0.60562253f},
-std::array<float,2>{0.550483286f, 0.260149747f},
-std::array<float,2>{0.897350073f, 0.868320584f},
-std::array<float,2>{0.446126878f, 0.0654966459f},
-std::array<float,2>{0.0872114897f, 0.904146433f},
-std::array<float,2>{0.577275217f, 0.249436453f},
-std::array<float,2>{0.958600461f, 0.668140173f},
-std::array<float,2>{0.405561745f, 0.434089363f},
-std::array<float,2>{0.36788246f, 0.508354247f},
-std::array<float,2>{0.805132568f, 0.368004352f},
-std::array<float,2>{0.677523494f, 0.757033706f},
-std::array<float,2>{0.201297283f, 0.0207617152f},
-std::array<float,2>{0.482282639f, 0.817436039f},
-std::array<float,2>{0.924140275f, 0.109634079f},
-std::array<float,2>{0.529879153f, 0.577020407f},
-std::array<float,2>{0.0179034807f, 0.29184109f},
-std::array<float,2>{0.16904375f, 0.701037765f},
-std::array<float,2>{0.694669664f, 0.443060398f},
-std::array<float,2>{0.872700751f, 0.983422875f},
-std::array<float,2>{0.267428279f, 0.171473131f},
-std::array<float,2>{0.152022317f, 0.99398309f},
-std::array<float,2>{0.74593097f, 0.1762297f},
-std::array<float,2>{0.829464078f, 0.717422903f},
-std::array<float,2>{0.311374336f, 0.45366329f},
-std::array<float,2>{0.45580104f, 0.58118856f},
-std::array<float,2>{0.882234275f, 0.303117484f},
-std::array<float,2>{0.546297312f, 0.839791894f},
-std::array<float,2>{0.044040069f, 0.0984308645f},
-std::array<float,2>{0.31310904f, 0.773886979f},
-std::array<float,2>{0.751701832f, 0.0104649318f},
-std::array<float,2>{0.638770521f, 0.516017556f},
-std::array<float,2>{0.24218604f, 0.345892638f},
-std::array<float,2>{0.108343408f, 0.684019148f},
-std::array<float,2>{0.608419001f, 0.411017627f},
-std::array<float,2>{0.970909476f, 0.880253851f},
-std::array<float,2>{0.418235213f, 0.229692325f},
-std::array<float,2>{0.00971603487f, 0.84811461f},
-std::array<float,2>{0.500595272f, 0.0781946704f},
-std::array<float,2>{0.921450257f, 0.622750163f},
-std::array<float,2>{0.495266408f, 0.272110343f},
-std::array<float,2>{0.255322605f, 0.722224176f},
-std::array<float,2>{0.852552116f, 0.480803847f},
-std::array<float,2>{0.705965877f, 0.95183605f},
-std::array<float,2>{0.173900634f, 0.130498469f},
-std::array<float,2>{0.380650014f, 0.924909294f},
-std::array<float,2>{0.941850483f, 0.206549004f},
-std::array<float,2>{0.587604702f, 0.639814854f},
-std::array<float,2>{0.0637675673f, 0.398657531f},
-std::array<float,2>{0.215359926f, 0.536268294f},
-std::array<float,2>{0.663741589f, 0.343438327f},
-std::array<float,2>{0.786784172f, 0.802552342f},
-std::array<float,2>{0.350772709f, 0.0579058491f},
-std::array<float,2>{0.184740767f, 0.835441947f},
-std::array<float,2>{0.714323401f, 0.10395743f},
-std::array<float,2>{0.847233891f, 0.591212213f},
-std::array<float,2>{0.258076489f, 0.307722569f},
-std::array<float,2>{0.485440135f, 0.709764183f},
-std::array<float,2>{0.91388613f, 0.46843496f},
-std::array<float,2>{0.511491597f, 0.985775709f},
-std::array<float,2>{0.0020686686f, 0.181193337f},
-std::array<float,2>{0.35539636f, 0.887477756f},
-std::array<float,2>{0.795285344f, 0.226078376f},
-std::array<float,2>{0.67085892f, 0.677014709f},
-std::array<float,2>{0.209407881f, 0.419518262f},
-std::array<float,2>{0.0720173717f, 0.523987889f},
-std::array<float,2>{0.580639362f, 0.356090486f},
-std::array<float,2>{0.94641f, 0.772239983f},
-std::array<float,2>{0.383975774f, 0.00626644772f},
-std::array<float,2>{0.0312525742f, 0.938699245f},
-std::array<float,2>{0.53376478f, 0.139773056f},
-std::array<float,2>{0.89048028f, 0.733320534f},
-std::array<float,2>{0.463279486f, 0.474157602f},
-std::array<float,2>{0.299044877f, 0.610508025f},
-std::array<float,2>{0.836156666f, 0.279688865f},
-std::array<float,2>{0.741417885f, 0.852594078f},
-std::array<float,2>{0.148417532f, 0.092618987f},
-std::array<float,2>{0.413024843f, 0.81209439f},
-std::array<float,2>{0.984159887f, 0.051364731f},
-std::array<float,2>{0.595477223f, 0.540026963f},
-std::array<float,2>{0.0996302068f, 0.331150323f},
-std::array<float,2>{0.247959733f, 0.626266062f},
-std::array<float,2>{0.632134736f, 0.391936928f},
-std::array<float,2>{0.76544565f, 0.932579815f},
-std::array<float,2>{0.323926032f, 0.215036437f},
-std::array<float,2>{0.189138219f, 0.909202158f},
-std::array<float,2>{0.687191129f, 0.18894884f},
-std::array<float,2>{0.79820019f, 0.646779001f},
-std::array<float,2>{0.359640181f, 0.38880527f},
-std::array<float,2>{0.392319947f, 0.549805045f},
-std::array<float,2>{0.962774456f, 0.320938349f},
-std::array<float,2>{0.563077152f, 0.790554821f},
-std::array<float,2>{0.0789210796f, 0.0337227955f},
-std::array<float,2>{0.280038744f, 0.860385478f},
-std::array<float,2>{0.863323152f, 0.0765656084f},
-std::array<float,2>{0.699022233f, 0.599249125f},
-std::array<float,2>{0.162164778f, 0.254576057f},
-std::array<float,2>{0.0240375306f, 0.74666357f},
-std::array<float,2>{0.521877646f, 0.487749308f},
-std::array<float,2>{0.932463586f, 0.966629565f},
-std::array<float,2>{0.472195119f, 0.154684037f},
-std::array<float,2>{0.10943529f, 0.759938836f},
-std::array<float,2>{0.611406803f, 0.0310833789f},
-std::array<float,2>{0.988008499f, 0.506901979f},
-std::array<float,2>{0.423279583f, 0.366730839f},
-std::array<float,2>{0.339354783f, 0.659838259f},
-std::array<float,2>{0.771509647f, 0.426002681f},
-std::array<float,2>{0.64222312f, 0.89363426f},
-std::array<float,2>{0.21882765f, 0.240769982f},
-std::array<float,2>{0.443938732f, 0.976465881f},
-std::array<float,2>{0.901375055f, 0.163119704f},
-std::array<float,2>{0.555509508f, 0.694210351f},
-std::array<float,2>{0.0594491176f, 0.450854152f},
-std::array<float,2>{0.127081886f, 0.564352632f},
-std::array<float,2>{0.723407447f, 0.282522738f},
-std::array<float,2>{0.81829375f, 0.825340092f},
-std::array<float,2>{0.295536876f, 0.117756449f},
-std::array<float,2>{0.146785364f, 0.810225904f},
-std::array<float,2>{0.741207182f, 0.0536276996f},
-std::array<float,2>{0.837048948f, 0.54293704f},
-std::array<float,2>{0.299914926f, 0.329372376f},
-std::array<float,2>{0.464710623f, 0.628203452f},
-std::array<float,2>{0.889048219f, 0.393917084f},
-std::array<float,2>{0.534645379f, 0.931449592f},
-std::array<float,2>{0.0323714241f, 0.217236653f},
-std::array<float,2>{0.322431684f, 0.940268576f},
-std::array<float,2>{0.763711095f, 0.137767941f},
-std::array<float,2>{0.631735206f, 0.73125881f},
-std::array<float,2>{0.246203408f, 0.475721568f},
-std::array<float,2>{0.101160854f, 0.611577988f},
-std::array<float,2>{0.594542146f, 0.278548717f},
-std::array<float,2>{0.98272866f, 0.853948593f},
-std::array<float,2>{0.414005458f, 0.0910739303f},
-std::array<float,2>{0.00331209484f, 0.890249968f},
-std::array<float,2>{0.510138869f, 0.224346131f},
-std::array<float,2>{0.912294626f, 0.678221881f},
-std::array<float,2>{0.484512091f, 0.421100318f},
-std::array<float,2>{0.258862615f, 0.525978029f},
-std::array<float,2>{0.846622169f, 0.357698232f},
-std::array<float,2>{0.712991595f, 0.771131456f},
-std::array<float,2>{0.183652893f, 0.00474642031f},
-std::array<float,2>{0.383493662f, 0.833042026f},
-std::array<float,2>{0.945717037f, 0.102029532f},
-std::array<float,2>{0.581837058f, 0.593149602f},
-std::array<float,2>{0.0709785149f, 0.306381106f},
-std::array<float,2>{0.210467398f, 0.708964825f},
-std::array<float,2>{0.670908332f, 0.465308428f},
-std::array<float,2>{0.796311557f, 0.987781286f},
-std::array<float,2>{0.354280204f, 0.183162928f},
-std::array<float,2>{0.220251814f, 0.973851562f},
-std::array<float,2>{0.641268194f, 0.160312012f},
-std::array<float,2>{0.773074865f, 0.692879558f},
-std::array<float,2>{0.338734031f, 0.451665431f},
-std::array<float,2>{0.422078729f, 0.566000342f},
-std::array<float,2>{0.986652732f, 0.285107911f},
-std::array<float,2>{0.613033056f, 0.826567709f},
-std::array<float,2>{0.110537134f, 0.120275564f},
-std::array<float,2>{0.296095014f, 0.75921309f},
-std::array<float,2>{0.816926539f, 0.027719574f},
-std::array<float,2>{0.724132121f, 0.505455852f},
-std::array<float,2>{0.128114432f, 0.364446282f},
-std::array<float,2>{0.0604976751f, 0.658139169f},
-std::array<float,2>{0.555766642f, 0.428513139f},
-std::array<float,2>{0.901014924f, 0.891410589f},
-std::array<float,2>{0.44463861f, 0.238526285f},
-std::array<float,2>{0.079929471f, 0.862219095f},
-std::array<float,2>{0.563648105f, 0.07523375f},
-std::array<float,2>{0.961030602f, 0.601089656f},
-std::array<float,2>{0.391075104f, 0.256715387f},
-std::array<float,2>{0.360844791f, 0.749976039f},
-std::array<float,2>{0.797256589f, 0.486102223f},
-std::array<float,2>{0.685608149f, 0.968634367f},
-std::array<float,2>{0.188336909f, 0.154026881f},
-std::array<float,2>{0.470858991f, 0.906620443f},
-std::array<float,2>{0.933247507f, 0.191191003f},
-std::array<float,2>{0.523320735f, 0.64568615f},
-std::array<float,2>{0.0249247272f, 0.388604581f},
-std::array<float,2>{0.163204566f, 0.547510207f},
-std::array<float,2>{0.697700322f, 0.32367751f},
-std::array<float,2>{0.865221441f, 0.791526377f},
-std::array<float,2>{0.2806364f, 0.0319276452f},
-std::array<float,2>{0.202763885f, 0.819628417f},
-std::array<float,2>{0.676676631f, 0.112665012f},
-std::array<float,2>{0.80572319f, 0.574698985f},
-std::array<float,2>{0.368698627f, 0.290906638f},
-std::array<float,2>{0.404539138f, 0.701751471f},
-std::array<float,2>{0.957326472f, 0.443797797f},
-std::array<float,2>{0.576845109f, 0.981460094f},
-std::array<float,2>{0.086037904f, 0.168396845f},
-std::array<float,2>{0.266447365f, 0.904970825f},
-std::array<float,2>{0.871740699f, 0.247693673f},
-std::array<float,2>{0.694161952f, 0.670756042f},
-std::array<float,2>{0.168264315f, 0.436396062f},
-std::array<float,2>{0.0193519685f, 0.51008451f},
-std::array<float,2>{0.530513048f, 0.370112836f},
-std::array<float,2>{0.925313354f, 0.754839063f},
-std::array<float,2>{0.481360018f, 0.0227834154f},
-std::array<float,2>{0.124520577f, 0.960094988f},
-std::array<float,2>{0.617468536f, 0.140641108f},
-std::array<float,2>{0.999377191f, 0.740313828f},
-std::array<float,2>{0.43533662f, 0.492680967f},
-std::array<float,2>{0.330782443f, 0.60763073f},
-std::array<float,2>{0.775102019f, 0.259134054f},
-std::array<float,2>{0.654188514f, 0.870665729f},
-std::array<float,2>{0.229386508f, 0.0644241348f},
-std::array<float,2>{0.446305573f, 0.787509382f},
-std::array<float,2>{0.897825599f, 0.0440095924f},
-std::array<float,2>{0.549757898f, 0.561367452f},
-std::array<float,2>{0.0488663167f, 0.315121591f},
-std::array<float,2>{0.138332784f, 0.648721695f},
-std::array<float,2>{0.731806576f, 0.381771356f},
-std::array<float,2>{0.822067559f, 0.916006505f},
-std::array<float,2>{0.288056135f, 0.195593044f},
-std::array<float,2>{0.175116941f, 0.922903955f},
-std::array<float,2>{0.706462204f, 0.204858929f},
-std::array<float,2>{0.852078915f, 0.636953831f},
-std::array<float,2>{0.253993839f, 0.401034594f},
-std::array<float,2>{0.49442786f, 0.538587451f},
-std::array<float,2>{0.920255065f, 0.34132126f},
-std::array<float,2>{0.50189352f, 0.803715706f},
-std::array<float,2>{0.00833373796f, 0.0553674363f},
-std::array<float,2>{0.350073814f, 0.850004315f},
-std::array<float,2>{0.785777748f, 0.0815998986f},
-std::array<float,2>{0.663085699f, 0.624052107f},
-std::array<float,2>{0.216394484f, 0.269685745f},
-std::array<float,2>{0.0629597232f, 0.71941793f},
-std::array<float,2>{0.586654723f, 0.483017355f},
-std::array<float,2>{0.943227828f, 0.950816333f},
-std::array<float,2>{0.37975499f, 0.131975234f},
-std::array<float,2>{0.0430449694f, 0.77580744f},
-std::array<float,2>{0.545798659f, 0.00797456317f},
-std::array<float,2>{0.881819427f, 0.518053532f},
-std::array<float,2>{0.456158519f, 0.344703227f},
-std::array<float,2>{0.312186152f, 0.686225593f},
-std::array<float,2>{0.828702211f, 0.41366294f},
-std::array<float,2>{0.745088995f, 0.880861521f},
-std::array<float,2>{0.150759175f, 0.227929384f},
-std::array<float,2>{0.418977052f, 0.995871842f},
-std::array<float,2>{0.972266436f, 0.179234415f},
-std::array<float,2>{0.608086407f, 0.716662169f},
-std::array<float,2>{0.109287798f, 0.456939787f},
-std::array<float,2>{0.241154179f, 0.579243839f},
-std::array<float,2>{0.640377522f, 0.302500635f},
-std::array<float,2>{0.750521243f, 0.836935401f},
-std::array<float,2>{0.314204365f, 0.0998310447f},
-std::array<float,2>{0.245602801f, 0.751094401f},
-std::array<float,2>{0.62714529f, 0.0158388242f},
-std::array<float,2>{0.758088887f, 0.513279915f},
-std::array<float,2>{0.32797417f, 0.373419642f},
-std::array<float,2>{0.40645808f, 0.666644871f},
-std::array<float,2>{0.978118777f, 0.432301283f},
-std::array<float,2>{0.599003792f, 0.901700914f},
-std::array<float,2>{0.0944691002f, 0.243765324f},
-std::array<float,2>{0.301701605f, 0.977200329f},
-std::array<float,2>{0.843550026f, 0.167328209f},
-std::array<float,2>{0.737933099f, 0.696184874f},
-std::array<float,2>{0.143737823f, 0.437637746f},
-std::array<float,2>{0.0387714952f, 0.572064936f},
-std::array<float,2>{0.537901103f, 0.293902934f},
-std::array<float,2>{0.883163393f, 0.81520319f},
-std::array<float,2>{0.46849978f, 0.114404462f},
-std::array<float,2>{0.0756982192f, 0.919593275f},
-std::array<float,2>{0.583750427f, 0.201475739f},
-std::array<float,2>{0.952354908f, 0.654724896f},
-std::array<float,2>{0.388006657f, 0.376601219f},
-std::array<float,2>{0.35650298f, 0.555167437f},
-std::array<float,2>{0.790923834f, 0.316501826f},
-std::array<float,2>{0.664245784f, 0.782282591f},
-std::array<float,2>{0.206454292f, 0.0418602899f},
-std::array<float,2>{0.490502864f, 0.874857426f},
-std::array<float,2>{0.90813297f, 0.0678643584f},
-std::array<float,2>{0.515046775f, 0.602918386f},
-std::array<float,2>{0.00444548344f, 0.261943668f},
-std::array<float,2>{0.182792857f, 0.734831274f},
-std::array<float,2>{0.715790272f, 0.498100936f},
-std::array<float,2>{0.851134181f, 0.956594467f},
-std::array<float,2>{0.26271373f, 0.146013841f},
-std::array<float,2>{0.132254228f, 0.94632709f},
-std::array<float,2>{0.72070533f, 0.125908628f},
-std::array<float,2>{0.815804958f, 0.722796082f},
-std::array<float,2>{0.291627795f, 0.477566421f},
-std::array<float,2>{0.438661605f, 0.620004058f},
-std::array<float,2>{0.905588746f, 0.265754163f},
-std::array<float,2>{0.559632182f, 0.847136319f},
-std::array<float,2>{0.0568731241f, 0.0851187259f},
-std::array<float,2>{0.343202293f, 0.79770726f},
-std::array<float,2>{0.767007351f, 0.0621528141f},
-std::array<float,2>{0.64804697f, 0.532093883f},
-std::array<float,2>{0.226480514f, 0.338584363f},
-std::array<float,2>{0.114891827f, 0.634965599f},
-std::array<float,2>{0.615360498f, 0.405739248f},
-std::array<float,2>{0.990341187f, 0.926168561f},
-std::array<float,2>{0.42800355f, 0.207368508f},
-std::array<float,2>{0.0275067892f, 0.842566729f},
-std::array<float,2>{0.518386841f, 0.0945461169f},
-std::array<float,2>{0.935131371f, 0.585307896f},
-std::array<float,2>{0.473762274f, 0.297384411f},
-std::array<float,2>{0.27452296f, 0.714783907f},
-std::array<float,2>{0.860909522f, 0.460920304f},
-std::array<float,2>{0.702737033f, 0.99720031f},
-std::array<float,2>{0.159970194f, 0.172469735f},
-std::array<float,2>{0.395939261f, 0.87555629f},
-std::array<float,2>{0.965957463f, 0.234156832f},
-std::array<float,2>{0.567436159f, 0.682557583f},
-std::array<float,2>{0.0829103366f, 0.409441143f},
-std::array<float,2>{0.194499299f, 0.522966743f},
-std::array<float,2>{0.683041155f, 0.349617064f},
-std::array<float,2>{0.802716196f, 0.779476583f},
-std::array<float,2>{0.36418578f, 0.0138884643f},
-std::array<float,2>{0.165128529f, 0.857524931f},
-std::array<float,2>{0.689479589f, 0.0878100842f},
-std::array<float,2>{0.868858278f, 0.614303529f},
-std::array<float,2>{0.27235651f, 0.274044365f},
-std::array<float,2>{0.478653163f, 0.729960442f},
-std::array<float,2>{0.928350985f, 0.47242704f},
-std::array<float,2>{0.52579993f, 0.944109201f},
-std::array<float,2>{0.0224018823f, 0.133570448f},
-std::array<float,2>{0.373599589f, 0.9337551f},
-std::array<float,2>{0.810055733f, 0.211366266f},
-std::array<float,2>{0.6728338f, 0.632230341f},
-std::array<float,2>{0.198418558f, 0.395302951f},
-std::array<float,2>{0.0917332172f, 0.543405831f},
-std::array<float,2>{0.573157012f, 0.334728092f},
-std::array<float,2>{0.954455674f, 0.806671858f},
-std::array<float,2>{0.398997486f, 0.047193855f},
-std::array<float,2>{0.0526214093f, 0.991083026f},
-std::array<float,2>{0.55240345f, 0.186283678f},
-std::array<float,2>{0.894297838f, 0.705059171f},
-std::array<float,2>{0.449915707f, 0.464164734f},
-std::array<float,2>{0.284045517f, 0.587079346f},
-std::array<float,2>{0.824867606f, 0.311210304f},
-std::array<float,2>{0.729781985f, 0.829109371f},
-std::array<float,2>{0.133458719f, 0.108779296f},
-std::array<float,2>{0.433139533f, 0.769134164f},
-std::array<float,2>{0.994300187f, 0.0038971398f},
-std::array<float,2>{0.623647869f, 0.530805826f},
-std::array<float,2>{0.118103214f, 0.351848036f},
-std::array<float,2>{0.233383f, 0.6730178f},
-std::array<float,2>{0.64927423f, 0.416966707f},
-std::array<float,2>{0.778954685f, 0.885193467f},
-std::array<float,2>{0.334878176f, 0.221454903f},
-std::array<float,2>{0.212662607f, 0.894871294f},
-std::array<float,2>{0.657108963f, 0.237994105f},
-std::array<float,2>{0.784379065f, 0.662235856f},
-std::array<float,2>{0.345169574f, 0.422094643f},
-std::array<float,2>{0.378580093f, 0.500520587f},
-std::array<float,2>{0.93994081f, 0.361165196f},
-std::array<float,2>{0.590022862f, 0.765477538f},
-std::array<float,2>{0.0697658211f, 0.0272926129f},
-std::array<float,2>{0.251576215f, 0.823157549f},
-std::array<float,2>{0.85687393f, 0.123047315f},
-std::array<float,2>{0.707115769f, 0.568815649f},
-std::array<float,2>{0.176538721f, 0.286512852f},
-std::array<float,2>{0.0126442881f, 0.688408732f},
-std::array<float,2>{0.507727206f, 0.448331743f},
-std::array<float,2>{0.916944683f, 0.970004737f},
-std::array<float,2>{0.499290466f, 0.156776756f},
-std::array<float,2>{0.10517396f, 0.793962896f},
-std::array<float,2>{0.602852285f, 0.0376188196f},
-std::array<float,2>{0.975367546f, 0.551358163f},
-std::array<float,2>{0.417319298f, 0.325371176f},
-std::array<float,2>{0.317628413f, 0.643991232f},
-std::array<float,2>{0.754144251f, 0.385462672f},
-std::array<float,2>{0.636400819f, 0.913262725f},
-std::array<float,2>{0.235471383f, 0.194663182f},
-std::array<float,2>{0.460641384f, 0.961168885f},
-std::array<float,2>{0.877891839f, 0.150912151f},
-std::array<float,2>{0.541916072f, 0.745392144f},
-std::array<float,2>{0.0401891284f, 0.488768756f},
-std::array<float,2>{0.154379949f, 0.594693244f},
-std::array<float,2>{0.749067843f, 0.253628016f},
-std::array<float,2>{0.832335293f, 0.866812229f},
-std::array<float,2>{0.304896772f, 0.0741667897f},
-std::array<float,2>{0.1874111f, 0.772212505f},
-std::array<float,2>{0.712851226f, 0.00604462437f},
-std::array<float,2>{0.845638156f, 0.524216175f},
-std::array<float,2>{0.261295825f, 0.356363088f},
-std::array<float,2>{0.488218606f, 0.676971257f},
-std::array<float,2>{0.911678016f, 0.419856608f},
-std::array<float,2>{0.508495986f, 0.887430787f},
-std::array<float,2>{0.000908196205f, 0.226523399f},
-std::array<float,2>{0.351794302f, 0.985432029f},
-std::array<float,2>{0.793981791f, 0.181606486f},
-std::array<float,2>{0.669179916f, 0.709570289f},
-std::array<float,2>{0.207166478f, 0.46863547f},
-std::array<float,2>{0.0738610178f, 0.591061294f},
-std::array<float,2>{0.579445958f, 0.308065355f},
-std::array<float,2>{0.947553754f, 0.835190475f},
-std::array<float,2>{0.384883851f, 0.103576265f},
-std::array<float,2>{0.0335902683f, 0.932306528f},
-std::array<float,2>{0.532505214f, 0.215090245f},
-std::array<float,2>{0.88706547f, 0.626017213f},
-std::array<float,2>{0.462449282f, 0.391686559f},
-std::array<float,2>{0.297522306f, 0.539601326f},
-std::array<float,2>{0.838733673f, 0.331367642f},
-std::array<float,2>{0.739401519f, 0.812452495f},
-std::array<float,2>{0.145117909f, 0.0516212583f},
-std::array<float,2>{0.411824942f, 0.852912724f},
-std::array<float,2>{0.980992436f, 0.0923432261f},
-std::array<float,2>{0.596155882f, 0.610612929f},
-std::array<float,2>{0.0983861163f, 0.279394448f},
-std::array<float,2>{0.248182654f, 0.73309648f},
-std::array<float,2>{0.628976047f, 0.47439748f},
-std::array<float,2>{0.762403905f, 0.938813567f},
-std::array<float,2>{0.321398407f, 0.140019566f},
-std::array<float,2>{0.190919071f, 0.96645093f},
-std::array<float,2>{0.683638573f, 0.154497579f},
-std::array<float,2>{0.798967183f, 0.746929288f},
-std::array<float,2>{0.36213693f, 0.487501711f},
-std::array<float,2>{0.39289543f, 0.599479496f},
-std::array<float,2>{0.964255452f, 0.254773706f},
-std::array<float,2>{0.56636411f, 0.86060226f},
-std::array<float,2>{0.0808048025f, 0.0763000995f},
-std::array<float,2>{0.277771682f, 0.790910482f},
-std::array<float,2>{0.866680622f, 0.0339641869f},
-std::array<float,2>{0.696866572f, 0.550239027f},
-std::array<float,2>{0.160663933f, 0.321168959f},
-std::array<float,2>{0.0269135274f, 0.646508992f},
-std::array<float,2>{0.519800961f, 0.389107376f},
-std::array<float,2>{0.931548357f, 0.909566224f},
-std::array<float,2>{0.469581306f, 0.188599318f},
-std::array<float,2>{0.11223685f, 0.825514257f},
-std::array<float,2>{0.610767424f, 0.117980123f},
-std::array<float,2>{0.984834909f, 0.564119875f},
-std::array<float,2>{0.424585968f, 0.282399207f},
-std::array<float,2>{0.337286443f, 0.69388634f},
-std::array<float,2>{0.770150065f, 0.451055139f},
-std::array<float,2>{0.643033564f, 0.976155877f},
-std::array<float,2>{0.222406834f, 0.163574204f},
-std::array<float,2>{0.442982137f, 0.893995583f},
-std::array<float,2>{0.899344087f, 0.24112764f},
-std::array<float,2>{0.556845129f, 0.659934759f},
-std::array<float,2>{0.0616945811f, 0.426075876f},
-std::array<float,2>{0.126475349f, 0.507192492f},
-std::array<float,2>{0.725472331f, 0.367078274f},
-std::array<float,2>{0.819381654f, 0.760228693f},
-std::array<float,2>{0.294599831f, 0.0309549551f},
-std::array<float,2>{0.226605907f, 0.868602574f},
-std::array<float,2>{0.654417276f, 0.0658765733f},
-std::array<float,2>{0.775447369f, 0.605832517f},
-std::array<float,2>{0.329378039f, 0.259964556f},
-std::array<float,2>{0.43681848f, 0.739705682f},
-std::array<float,2>{0.996530294f, 0.495641649f},
-std::array<float,2>{0.62010473f, 0.957158446f},
-std::array<float,2>{0.121942624f, 0.143468857f},
-std::array<float,2>{0.286213458f, 0.916099668f},
-std::array<float,2>{0.823507011f, 0.19755581f},
-std::array<float,2>{0.732871473f, 0.650933146f},
-std::array<float,2>{0.138910279f, 0.379386514f},
-std::array<float,2>{0.04858917f, 0.558814824f},
-std::array<float,2>{0.54863447f, 0.313287973f},
-std::array<float,2>{0.895448506f, 0.785496771f},
-std::array<float,2>{0.447719783f, 0.0452782251f},
-std::array<float,2>{0.0889692754f, 0.983708382f},
-std::array<float,2>{0.575193703f, 0.171833813f},
-std::array<float,2>{0.960926294f, 0.700738072f},
-std::array<float,2>{0.402513593f, 0.443183124f},
-std::array<float,2>{0.370675027f, 0.576845765f},
-std::array<float,2>{0.807231188f, 0.291680098f},
-std::array<float,2>{0.679021358f, 0.817717731f},
-std::array<float,2>{0.200804889f, 0.10939049f},
-std::array<float,2>{0.48350516f, 0.757112265f},
-std::array<float,2>{0.922801137f, 0.0206798911f},
-std::array<float,2>{0.527557969f, 0.508746207f},
-std::array<float,2>{0.0158513822f, 0.367781222f},
-std::array<float,2>{0.17159082f, 0.668435574f},
-std::array<float,2>{0.693353415f, 0.434488595f},
-std::array<float,2>{0.874612272f, 0.904049754f},
-std::array<float,2>{0.26762718f, 0.249113023f},
-std::array<float,2>{0.150247216f, 0.879997909f},
-std::array<float,2>{0.742829382f, 0.229887396f},
-std::array<float,2>{0.83021009f, 0.68362391f},
-std::array<float,2>{0.310069263f, 0.410721809f},
-std::array<float,2>{0.454709172f, 0.515710592f},
-std::array<float,2>{0.880740225f, 0.345980197f},
-std::array<float,2>{0.544891f, 0.773477852f},
-std::array<float,2>{0.0465465896f, 0.0107074678f},
-std::array<float,2>{0.314605951f, 0.839464605f},
-std::array<float,2>{0.752000093f, 0.0983104929f},
-std::array<float,2>{0.637015224f, 0.58150661f},
-std::array<float,2>{0.240150288f, 0.302826852f},
-std::array<float,2>{0.106039278f, 0.71773088f},
-std::array<float,2>{0.605800152f, 0.453949153f},
-std::array<float,2>{0.970539749f, 0.993857086f},
-std::array<float,2>{0.420367181f, 0.175790593f},
-std::array<float,2>{0.011418392f, 0.802312195f},
-std::array<float,2>{0.503498256f, 0.057682585f},
-std::array<float,2>{0.919844151f, 0.536523104f},
-std::array<float,2>{0.492271274f, 0.343603224f},
-std::array<float,2>{0.256812423f, 0.640095115f},
-std::array<float,2>{0.854943395f, 0.398714513f},
-std::array<float,2>{0.703663647f, 0.925050497f},
-std::array<float,2>{0.173169002f, 0.206829131f},
-std::array<float,2>{0.381407261f, 0.952066422f},
-std::array<float,2>{0.945262074f, 0.130833566f},
-std::array<float,2>{0.588578343f, 0.722436607f},
-std::array<float,2>{0.0663106963f, 0.480492383f},
-std::array<float,2>{0.218215972f, 0.622835517f},
-std::array<float,2>{0.661436558f, 0.2723912f},
-std::array<float,2>{0.788952172f, 0.847801924f},
-std::array<float,2>{0.347909093f, 0.0784663782f},
-std::array<float,2>{0.204228535f, 0.784600317f},
-std::array<float,2>{0.666368067f, 0.0390900634f},
-std::array<float,2>{0.792341173f, 0.556844234f},
-std::array<float,2>{0.359014541f, 0.318974733f},
-std::array<float,2>{0.388931245f, 0.652405322f},
-std::array<float,2>{0.950026989f, 0.377470225f},
-std::array<float,2>{0.584315717f, 0.92075187f},
-std::array<float,2>{0.0768686384f, 0.199602276f},
-std::array<float,2>{0.26472789f, 0.954755604f},
-std::array<float,2>{0.849195063f, 0.14791888f},
-std::array<float,2>{0.717604578f, 0.737257004f},
-std::array<float,2>{0.180579364f, 0.496258199f},
-std::array<float,2>{0.0065313275f, 0.605259836f},
-std::array<float,2>{0.512206316f, 0.264491826f},
-std::array<float,2>{0.908822119f, 0.872447729f},
-std::array<float,2>{0.488304645f, 0.0685730353f},
-std::array<float,2>{0.096867308f, 0.9002226f},
-std::array<float,2>{0.600261927f, 0.245593756f},
-std::array<float,2>{0.979187131f, 0.664415717f},
-std::array<float,2>{0.409241289f, 0.431567788f},
-std::array<float,2>{0.325982362f, 0.515396476f},
-std::array<float,2>{0.760768056f, 0.372602642f},
-std::array<float,2>{0.626227558f, 0.752035499f},
-std::array<float,2>{0.243545726f, 0.018270202f},
-std::array<float,2>{0.465851098f, 0.813280821f},
-std::array<float,2>{0.886119843f, 0.116445206f},
-std::array<float,2>{0.53657192f, 0.573289335f},
-std::array<float,2>{0.0368001759f, 0.295276672f},
-std::array<float,2>{0.141609192f, 0.697504103f},
-std::array<float,2>{0.735326946f, 0.439562112f},
-std::array<float,2>{0.841170788f, 0.979474187f},
-std::array<float,2>{0.304519087f, 0.165344715f},
-std::array<float,2>{0.157390043f, 0.999225557f},
-std::array<float,2>{0.700223505f, 0.174273595f},
-std::array<float,2>{0.862742126f, 0.712513208f},
-std::array<float,2>{0.275715262f, 0.458312243f},
-std::array<float,2>{0.475694358f, 0.58329016f},
-std::array<float,2>{0.935804963f, 0.299691439f},
-std::array<float,2>{0.516182601f, 0.841332436f},
-std::array<float,2>{0.0303210765f, 0.0966061652f},
-std::array<float,2>{0.366225213f, 0.778513849f},
-std::array<float,2>{0.803821206f, 0.0121884514f},
-std::array<float,2>{0.680212021f, 0.52129513f},
-std::array<float,2>{0.19148013f, 0.348539889f},
-std::array<float,2>{0.0847926363f, 0.680514157f},
-std::array<float,2>{0.569595516f, 0.406295776f},
-std::array<float,2>{0.967452168f, 0.877447486f},
-std::array<float,2>{0.396632284f, 0.231225729f},
-std::array<float,2>{0.0554786399f, 0.844210207f},
-std::array<float,2>{0.562497437f, 0.0821547061f},
-std::array<float,2>{0.90401274f, 0.618106246f},
-std::array<float,2>{0.440873802f, 0.267859519f},
-std::array<float,2>{0.29002285f, 0.724862158f},
-std::array<float,2>{0.812968671f, 0.479754448f},
-std::array<float,2>{0.719725132f, 0.947570264f},
-std::array<float,2>{0.130822495f, 0.1283416f},
-std::array<float,2>{0.426575363f, 0.92886281f},
-std::array<float,2>{0.989104927f, 0.210324928f},
-std::array<float,2>{0.613987863f, 0.633742571f},
-std::array<float,2>{0.115270078f, 0.402482599f},
-std::array<float,2>{0.222707048f, 0.534370959f},
-std::array<float,2>{0.645809233f, 0.337431014f},
-std::array<float,2>{0.767938197f, 0.800606132f},
-std::array<float,2>{0.341268241f, 0.0602103248f},
-std::array<float,2>{0.135155797f, 0.83149761f},
-std::array<float,2>{0.727515578f, 0.106059045f},
-std::array<float,2>{0.826182246f, 0.589778662f},
-std::array<float,2>{0.282967716f, 0.309423327f},
-std::array<float,2>{0.452311993f, 0.705883265f},
-std::array<float,2>{0.891035795f, 0.461220741f},
-std::array<float,2>{0.553891718f, 0.989866078f},
-std::array<float,2>{0.054444544f, 0.18494153f},
-std::array<float,2>{0.333161086f, 0.884173214f},
-std::array<float,2>{0.779800773f, 0.219652474f},
-std::array<float,2>{0.651452839f, 0.675555885f},
-std::array<float,2>{0.230892748f, 0.415376961f},
-std::array<float,2>{0.119734727f, 0.528718412f},
-std::array<float,2>{0.62145555f, 0.353886187f},
-std::array<float,2>{0.993266404f, 0.767264485f},
-std::array<float,2>{0.430608779f, 7.1322138e-05f},
-std::array<float,2>{0.0200025737f, 0.94317466f},
-std::array<float,2>{0.524466157f, 0.135411605f},
-std::array<float,2>{0.927623034f, 0.728210032f},
-std::array<float,2>{0.478311062f, 0.468891144f},
-std::array<float,2>{0.270457715f, 0.615891337f},
-std::array<float,2>{0.870443702f, 0.276989222f},
-std::array<float,2>{0.689069867f, 0.855491936f},
-std::array<float,2>{0.166839704f, 0.0880846605f},
-std::array<float,2>{0.401001483f, 0.805691659f},
-std::array<float,2>{0.955119312f, 0.0494625196f},
-std::array<float,2>{0.571654022f, 0.545302212f},
-std::array<float,2>{0.0931689516f, 0.333801001f},
-std::array<float,2>{0.195754245f, 0.629163027f},
-std::array<float,2>{0.673832476f, 0.397137612f},
-std::array<float,2>{0.81087625f, 0.93672657f},
-std::array<float,2>{0.372735828f, 0.214068115f},
-std::array<float,2>{0.23709172f, 0.911653578f},
-std::array<float,2>{0.632911742f, 0.192459226f},
-std::array<float,2>{0.756405056f, 0.642071962f},
-std::array<float,2>{0.318635345f, 0.384201884f},
-std::array<float,2>{0.414297849f, 0.553769112f},
-std::array<float,2>{0.97408855f, 0.326886952f},
-std::array<float,2>{0.604516864f, 0.79648751f},
-std::array<float,2>{0.103121966f, 0.0361645706f},
-std::array<float,2>{0.307705283f, 0.865224481f},
-std::array<float,2>{0.835429072f, 0.0709414333f},
-std::array<float,2>{0.746723175f, 0.597494721f},
-std::array<float,2>{0.153379187f, 0.251753509f},
-std::array<float,2>{0.0415372737f, 0.743682504f},
-std::array<float,2>{0.540315032f, 0.491131991f},
-std::array<float,2>{0.876783609f, 0.963021636f},
-std::array<float,2>{0.458546132f, 0.150299758f},
-std::array<float,2>{0.0680387691f, 0.762006283f},
-std::array<float,2>{0.593663156f, 0.0247005504f},
-std::array<float,2>{0.939114869f, 0.502077878f},
-std::array<float,2>{0.376762718f, 0.362888515f},
-std::array<float,2>{0.347086281f, 0.660859704f},
-std::array<float,2>{0.782252133f, 0.424091756f},
-std::array<float,2>{0.658252597f, 0.898387194f},
-std::array<float,2>{0.213936076f, 0.235579148f},
-std::array<float,2>{0.497140259f, 0.971332729f},
-std::array<float,2>{0.915584445f, 0.158459872f},
-std::array<float,2>{0.505045772f, 0.689985275f},
-std::array<float,2>{0.0151089123f, 0.445582181f},
-std::array<float,2>{0.17894046f, 0.566883922f},
-std::array<float,2>{0.710701227f, 0.287292004f},
-std::array<float,2>{0.859243691f, 0.82150799f},
-std::array<float,2>{0.252797335f, 0.122972362f},
-std::array<float,2>{0.161489129f, 0.792568862f},
-std::array<float,2>{0.696222603f, 0.0322916657f},
-std::array<float,2>{0.865466952f, 0.547852159f},
-std::array<float,2>{0.279030889f, 0.322938681f},
-std::array<float,2>{0.470197916f, 0.645166874f},
-std::array<float,2>{0.930492997f, 0.38713944f},
-std::array<float,2>{0.52072382f, 0.90748632f},
-std::array<float,2>{0.0263208821f, 0.189838022f},
-std::array<float,2>{0.362616748f, 0.967641234f},
-std::array<float,2>{0.799985051f, 0.15312627f},
-std::array<float,2>{0.68473053f, 0.748609722f},
-std::array<float,2>{0.190110028f, 0.485009193f},
-std::array<float,2>{0.0815985054f, 0.599668384f},
-std::array<float,2>{0.564770877f, 0.257692128f},
-std::array<float,2>{0.963538408f, 0.862741649f},
-std::array<float,2>{0.393634379f, 0.0749779567f},
-std::array<float,2>{0.0612936243f, 0.891901255f},
-std::array<float,2>{0.557759583f, 0.240060106f},
-std::array<float,2>{0.899843156f, 0.656530678f},
-std::array<float,2>{0.441434324f, 0.429407835f},
-std::array<float,2>{0.293848962f, 0.504054487f},
-std::array<float,2>{0.819327235f, 0.363373458f},
-std::array<float,2>{0.726089239f, 0.75817281f},
-std::array<float,2>{0.125678524f, 0.0288682953f},
-std::array<float,2>{0.425354779f, 0.828107297f},
-std::array<float,2>{0.985498369f, 0.119252056f},
-std::array<float,2>{0.61012125f, 0.565294981f},
-std::array<float,2>{0.113102451f, 0.283880085f},
-std::array<float,2>{0.220808357f, 0.691445947f},
-std::array<float,2>{0.644203067f, 0.452409893f},
-std::array<float,2>{0.77145946f, 0.973559439f},
-std::array<float,2>{0.336294591f, 0.161232516f},
-std::array<float,2>{0.208488151f, 0.986886024f},
-std::array<float,2>{0.668003559f, 0.182292357f},
-std::array<float,2>{0.793887198f, 0.70800072f},
-std::array<float,2>{0.3526164f, 0.465892464f},
-std::array<float,2>{0.385881752f, 0.592550397f},
-std::array<float,2>{0.949201167f, 0.305315137f},
-std::array<float,2>{0.578983307f, 0.832580149f},
-std::array<float,2>{0.0731840059f, 0.103110097f},
-std::array<float,2>{0.260619074f, 0.76996243f},
-std::array<float,2>{0.844572306f, 0.00567509979f},
-std::array<float,2>{0.711414397f, 0.526682913f},
-std::array<float,2>{0.186008379f, 0.359077126f},
-std::array<float,2>{0.000995007227f, 0.67960155f},
-std::array<float,2>{0.508968592f, 0.42048341f},
-std::array<float,2>{0.910564721f, 0.888788164f},
-std::array<float,2>{0.486717612f, 0.222899869f},
-std::array<float,2>{0.0990285054f, 0.854949772f},
-std::array<float,2>{0.596896231f, 0.0907415152f},
-std::array<float,2>{0.982177019f, 0.613168001f},
-std::array<float,2>{0.410158306f, 0.277456462f},
-std::array<float,2>{0.320531636f, 0.732282639f},
-std::array<float,2>{0.763642073f, 0.475115925f},
-std::array<float,2>{0.630023837f, 0.940939724f},
-std::array<float,2>{0.249761626f, 0.137030095f},
-std::array<float,2>{0.461165786f, 0.930315554f},
-std::array<float,2>{0.88835907f, 0.217969686f},
-std::array<float,2>{0.531731784f, 0.627423465f},
-std::array<float,2>{0.0347318687f, 0.392959654f},
-std::array<float,2>{0.146466076f, 0.541920245f},
-std::array<float,2>{0.738423944f, 0.328577638f},
-std::array<float,2>{0.839023471f, 0.808661222f},
-std::array<float,2>{0.297899097f, 0.054259669f},
-std::array<float,2>{0.238736853f, 0.836334884f},
-std::array<float,2>{0.638459861f, 0.100841455f},
-std::array<float,2>{0.753801048f, 0.578814805f},
-std::array<float,2>{0.315469682f, 0.301726848f},
-std::array<float,2>{0.4214513f, 0.715225279f},
-std::array<float,2>{0.969066739f, 0.455217212f},
-std::array<float,2>{0.606995463f, 0.994857192f},
-std::array<float,2>{0.107369013f, 0.178553328f},
-std::array<float,2>{0.309089452f, 0.882534623f},
-std::array<float,2>{0.831102788f, 0.226565242f},
-std::array<float,2>{0.743599474f, 0.687268496f},
-std::array<float,2>{0.149293557f, 0.41226396f},
-std::array<float,2>{0.0457548238f, 0.519145072f},
-std::array<float,2>{0.543272674f, 0.344805598f},
-std::array<float,2>{0.879324973f, 0.777063429f},
-std::array<float,2>{0.453558296f, 0.00901852641f},
-std::array<float,2>{0.0647615865f, 0.949905872f},
-std::array<float,2>{0.589637697f, 0.13094683f},
-std::array<float,2>{0.943493664f, 0.720476866f},
-std::array<float,2>{0.38264665f, 0.484323382f},
-std::array<float,2>{0.349439681f, 0.623347938f},
-std::array<float,2>{0.787985981f, 0.271095812f},
-std::array<float,2>{0.661018968f, 0.851492763f},
-std::array<float,2>{0.217760086f, 0.0802487284f},
-std::array<float,2>{0.493406713f, 0.803363085f},
-std::array<float,2>{0.918552339f, 0.0559946895f},
-std::array<float,2>{0.502670884f, 0.53789264f},
-std::array<float,2>{0.0102579715f, 0.34024629f},
-std::array<float,2>{0.172470927f, 0.637831986f},
-std::array<float,2>{0.705051005f, 0.401914567f},
-std::array<float,2>{0.853711009f, 0.922276497f},
-std::array<float,2>{0.256951958f, 0.203716099f},
-std::array<float,2>{0.140370697f, 0.914860129f},
-std::array<float,2>{0.734157205f, 0.196317956f},
-std::array<float,2>{0.82242918f, 0.649878442f},
-std::array<float,2>{0.286073297f, 0.38275528f},
-std::array<float,2>{0.449074566f, 0.562467694f},
-std::array<float,2>{0.895755649f, 0.315708458f},
-std::array<float,2>{0.547081113f, 0.788932264f},
-std::array<float,2>{0.0476831906f, 0.0433272608f},
-std::array<float,2>{0.328612f, 0.869191229f},
-std::array<float,2>{0.776605248f, 0.0630241707f},
-std::array<float,2>{0.656007767f, 0.608957469f},
-std::array<float,2>{0.227889717f, 0.257890135f},
-std::array<float,2>{0.122237429f, 0.741747677f},
-std::array<float,2>{0.620328486f, 0.493554235f},
-std::array<float,2>{0.997088194f, 0.959639728f},
-std::array<float,2>{0.435966998f, 0.142185658f},
-std::array<float,2>{0.0169319268f, 0.754926443f},
-std::array<float,2>{0.528538942f, 0.0221084412f},
-std::array<float,2>{0.923110723f, 0.511712492f},
-std::array<float,2>{0.482640386f, 0.370358974f},
-std::array<float,2>{0.26884982f, 0.671504617f},
-std::array<float,2>{0.873516977f, 0.437051654f},
-std::array<float,2>{0.691511214f, 0.905518413f},
-std::array<float,2>{0.170501515f, 0.246362537f},
-std::array<float,2>{0.404147238f, 0.980473697f},
-std::array<float,2>{0.959717393f, 0.169827461f},
-std::array<float,2>{0.575229108f, 0.702376664f},
-std::array<float,2>{0.0885246173f, 0.444981545f},
-std::array<float,2>{0.19974187f, 0.575924158f},
-std::array<float,2>{0.678013027f, 0.289275318f},
-std::array<float,2>{0.80798775f, 0.819307268f},
-std::array<float,2>{0.369576037f, 0.111983009f},
-std::array<float,2>{0.192519382f, 0.780356586f},
-std::array<float,2>{0.681525469f, 0.0153969452f},
-std::array<float,2>{0.803521395f, 0.521795511f},
-std::array<float,2>{0.365726709f, 0.351457417f},
-std::array<float,2>{0.397667438f, 0.683324933f},
-std::array<float,2>{0.968715191f, 0.408797085f},
-std::array<float,2>{0.568981051f, 0.876609266f},
-std::array<float,2>{0.084996663f, 0.232507333f},
-std::array<float,2>{0.276562095f, 0.996791184f},
-std::array<float,2>{0.861685038f, 0.17380698f},
-std::array<float,2>{0.699968934f, 0.713780522f},
-std::array<float,2>{0.156902716f, 0.459089369f},
-std::array<float,2>{0.0294815376f, 0.584749818f},
-std::array<float,2>{0.517121077f, 0.298332155f},
-std::array<float,2>{0.936648488f, 0.843721032f},
-std::array<float,2>{0.475290745f, 0.0954276547f},
-std::array<float,2>{0.116779119f, 0.927634537f},
-std::array<float,2>{0.614749551f, 0.208305746f},
-std::array<float,2>{0.989848375f, 0.636574507f},
-std::array<float,2>{0.427129924f, 0.405083388f},
-std::array<float,2>{0.339872956f, 0.532852292f},
-std::array<float,2>{0.768929899f, 0.339761406f},
-std::array<float,2>{0.644881785f, 0.798218846f},
-std::array<float,2>{0.22380361f, 0.0608548559f},
-std::array<float,2>{0.440371603f, 0.846348345f},
-std::array<float,2>{0.902601779f, 0.0845849589f},
-std::array<float,2>{0.561169326f, 0.620697975f},
-std::array<float,2>{0.0562436506f, 0.26723361f},
-std::array<float,2>{0.129441023f, 0.723757565f},
-std::array<float,2>{0.719989777f, 0.476948649f},
-std::array<float,2>{0.814387918f, 0.946068525f},
-std::array<float,2>{0.290995091f, 0.126386702f},
-std::array<float,2>{0.181042105f, 0.955887496f},
-std::array<float,2>{0.71820128f, 0.145189852f},
-std::array<float,2>{0.848527133f, 0.735962093f},
-std::array<float,2>{0.264071494f, 0.499828249f},
-std::array<float,2>{0.489877015f, 0.601879478f},
-std::array<float,2>{0.90929091f, 0.263666391f},
-std::array<float,2>{0.512894988f, 0.873882473f},
-std::array<float,2>{0.00733695971f, 0.0670545697f},
-std::array<float,2>{0.357721388f, 0.781473696f},
-std::array<float,2>{0.791695714f, 0.0421429873f},
-std::array<float,2>{0.667027235f, 0.556185246f},
-std::array<float,2>{0.203253165f, 0.317875594f},
-std::array<float,2>{0.0779594928f, 0.655412853f},
-std::array<float,2>{0.585578382f, 0.375202119f},
-std::array<float,2>{0.950822234f, 0.918063998f},
-std::array<float,2>{0.390168667f, 0.202358618f},
-std::array<float,2>{0.0361103155f, 0.816377401f},
-std::array<float,2>{0.535627782f, 0.113823414f},
-std::array<float,2>{0.884984195f, 0.570399821f},
-std::array<float,2>{0.465413898f, 0.294035763f},
-std::array<float,2>{0.303312123f, 0.696779966f},
-std::array<float,2>{0.840304911f, 0.439343661f},
-std::array<float,2>{0.735586762f, 0.978309274f},
-std::array<float,2>{0.140626714f, 0.166175112f},
-std::array<float,2>{0.409076005f, 0.901006341f},
-std::array<float,2>{0.979642272f, 0.242946297f},
-std::array<float,2>{0.601312578f, 0.667968333f},
-std::array<float,2>{0.0957460701f, 0.432673842f},
-std::array<float,2>{0.242904663f, 0.512438118f},
-std::array<float,2>{0.625348747f, 0.374641478f},
-std::array<float,2>{0.760195076f, 0.750902832f},
-std::array<float,2>{0.324757963f, 0.0173985008f},
-std::array<float,2>{0.152728692f, 0.866041839f},
-std::array<float,2>{0.74716264f, 0.072577171f},
-std::array<float,2>{0.834895253f, 0.595607042f},
-std::array<float,2>{0.307433188f, 0.252369106f},
-std::array<float,2>{0.457711935f, 0.744957209f},
-std::array<float,2>{0.875882804f, 0.48966527f},
-std::array<float,2>{0.539372027f, 0.962886274f},
-std::array<float,2>{0.0427122526f, 0.151680067f},
-std::array<float,2>{0.320281297f, 0.912117183f},
-std::array<float,2>{0.757612288f, 0.193490833f},
-std::array<float,2>{0.634347856f, 0.643267393f},
-std::array<float,2>{0.237379551f, 0.385860085f},
-std::array<float,2>{0.102427393f, 0.552187026f},
-std::array<float,2>{0.604241312f, 0.324811041f},
-std::array<float,2>{0.973286808f, 0.793093383f},
-std::array<float,2>{0.415865719f, 0.0385244638f},
-std::array<float,2>{0.0144053167f, 0.969095886f},
-std::array<float,2>{0.504331112f, 0.15812318f},
-std::array<float,2>{0.914771199f, 0.6893031f},
-std::array<float,2>{0.496350616f, 0.448112994f},
-std::array<float,2>{0.253634155f, 0.569771469f},
-std::array<float,2>{0.857647955f, 0.285195678f},
-std::array<float,2>{0.709491491f, 0.823384821f},
-std::array<float,2>{0.178598285f, 0.124267332f},
-std::array<float,2>{0.375449866f, 0.764470875f},
-std::array<float,2>{0.937823176f, 0.026366286f},
-std::array<float,2>{0.592075706f, 0.501465976f},
-std::array<float,2>{0.0665287301f, 0.360211253f},
-std::array<float,2>{0.213213891f, 0.663621485f},
-std::array<float,2>{0.659999132f, 0.423433602f},
-std::array<float,2>{0.781900644f, 0.896103799f},
-std::array<float,2>{0.345896602f, 0.236605152f},
-std::array<float,2>{0.23223637f, 0.886441469f},
-std::array<float,2>{0.650870323f, 0.221919224f},
-std::array<float,2>{0.780770063f, 0.672478855f},
-std::array<float,2>{0.332997829f, 0.41771245f},
-std::array<float,2>{0.43107444f, 0.529574037f},
-std::array<float,2>{0.993152261f, 0.353021026f},
-std::array<float,2>{0.622128904f, 0.768294752f},
-std::array<float,2>{0.120662138f, 0.00291189365f},
-std::array<float,2>{0.28216958f, 0.828159869f},
-std::array<float,2>{0.827986062f, 0.107771315f},
-std::array<float,2>{0.727961898f, 0.585964262f},
-std::array<float,2>{0.135870725f, 0.312053561f},
-std::array<float,2>{0.053518597f, 0.703487337f},
-std::array<float,2>{0.553456128f, 0.463102818f},
-std::array<float,2>{0.892001331f, 0.992035866f},
-std::array<float,2>{0.452020019f, 0.187128007f},
-std::array<float,2>{0.0926916674f, 0.807680905f},
-std::array<float,2>{0.571111858f, 0.0487046316f},
-std::array<float,2>{0.956989706f, 0.544543266f},
-std::array<float,2>{0.40171212f, 0.335876197f},
-std::array<float,2>{0.371853858f, 0.630954564f},
-std::array<float,2>{0.812163234f, 0.395786405f},
-std::array<float,2>{0.675521255f, 0.934938848f},
-std::array<float,2>{0.196772903f, 0.212099403f},
-std::array<float,2>{0.477440536f, 0.94463706f},
-std::array<float,2>{0.926555991f, 0.134317338f},
-std::array<float,2>{0.524242222f, 0.729368508f},
-std::array<float,2>{0.0208941009f, 0.471062809f},
-std::array<float,2>{0.167813063f, 0.613601267f},
-std::array<float,2>{0.688134611f, 0.275092393f},
-std::array<float,2>{0.869970739f, 0.858579993f},
-std::array<float,2>{0.270846605f, 0.0863129646f},
-std::array<float,2>{0.127910614f, 0.760883451f},
-std::array<float,2>{0.722831607f, 0.0295644552f},
-std::array<float,2>{0.817762315f, 0.505931079f},
-std::array<float,2>{0.295345157f, 0.365478605f},
-std::array<float,2>{0.443521231f, 0.658587277f},
-std::array<float,2>{0.901970088f, 0.42737475f},
-std::array<float,2>{0.555039048f, 0.892860234f},
-std::array<float,2>{0.0586180501f, 0.24171406f},
-std::array<float,2>{0.339524418f, 0.975403607f},
-std::array<float,2>{0.772298038f, 0.162774175f},
-std::array<float,2>{0.642080128f, 0.695081294f},
-std::array<float,2>{0.219333038f, 0.449716806f},
-std::array<float,2>{0.109885179f, 0.562969267f},
-std::array<float,2>{0.612222791f, 0.281944841f},
-std::array<float,2>{0.98741591f, 0.824533582f},
-std::array<float,2>{0.423464775f, 0.118698731f},
-std::array<float,2>{0.0237366986f, 0.908505857f},
-std::array<float,2>{0.522047997f, 0.188046247f},
-std::array<float,2>{0.931865156f, 0.648303211f},
-std::array<float,2>{0.471812576f, 0.389889032f},
-std::array<float,2>{0.27971223f, 0.549524188f},
-std::array<float,2>{0.8641451f, 0.321995705f},
-std::array<float,2>{0.698423862f, 0.789769948f},
-std::array<float,2>{0.162703201f, 0.0346807092f},
-std::array<float,2>{0.392079443f, 0.860182703f},
-std::array<float,2>{0.961943924f, 0.0773863792f},
-std::array<float,2>{0.562598109f, 0.598630369f},
-std::array<float,2>{0.0781944096f, 0.255696297f},
-std::array<float,2>{0.18879509f, 0.74765116f},
-std::array<float,2>{0.686907411f, 0.487126142f},
-std::array<float,2>{0.798443377f, 0.965326667f},
-std::array<float,2>{0.360142589f, 0.155539677f},
-std::array<float,2>{0.247145757f, 0.938446164f},
-std::array<float,2>{0.632581532f, 0.139234617f},
-std::array<float,2>{0.764984667f, 0.73436588f},
-std::array<float,2>{0.32362476f, 0.473289907f},
-std::array<float,2>{0.412165433f, 0.609933913f},
-std::array<float,2>{0.983777463f, 0.280943096f},
-std::array<float,2>{0.594756246f, 0.851927102f},
-std::array<float,2>{0.100328229f, 0.0934021771f},
-std::array<float,2>{0.299333364f, 0.811479211f},
-std::array<float,2>{0.836743891f, 0.0521993376f},
-std::array<float,2>{0.741972387f, 0.54014492f},
-std::array<float,2>{0.147651359f, 0.33093214f},
-std::array<float,2>{0.0321305171f, 0.625343561f},
-std::array<float,2>{0.533450007f, 0.391192496f},
-std::array<float,2>{0.889797628f, 0.93298471f},
-std::array<float,2>{0.463708192f, 0.21622254f},
-std::array<float,2>{0.071431227f, 0.834808648f},
-std::array<float,2>{0.580196679f, 0.105356991f},
-std::array<float,2>{0.947187304f, 0.589924991f},
-std::array<float,2>{0.384558797f, 0.306949675f},
-std::array<float,2>{0.354780287f, 0.710083306f},
-std::array<float,2>{0.795425713f, 0.467726767f},
-std::array<float,2>{0.670391917f, 0.984911799f},
-std::array<float,2>{0.209812805f, 0.179751292f},
-std::array<float,2>{0.486243874f, 0.887931228f},
-std::array<float,2>{0.913451672f, 0.225258857f},
-std::array<float,2>{0.510932982f, 0.67592597f},
-std::array<float,2>{0.00264380197f, 0.418545663f},
-std::array<float,2>{0.185438305f, 0.52465862f},
-std::array<float,2>{0.714776874f, 0.356901944f},
-std::array<float,2>{0.84689784f, 0.773094296f},
-std::array<float,2>{0.258313984f, 0.0077629257f},
-std::array<float,2>{0.215133965f, 0.849514902f},
-std::array<float,2>{0.66313076f, 0.0795482695f},
-std::array<float,2>{0.786293685f, 0.621365905f},
-std::array<float,2>{0.351264238f, 0.272774279f},
-std::array<float,2>{0.380045623f, 0.721246541f},
-std::array<float,2>{0.94206053f, 0.482153445f},
-std::array<float,2>{0.587247312f, 0.952690482f},
-std::array<float,2>{0.0643547103f, 0.129066154f},
-std::array<float,2>{0.255543351f, 0.92445451f},
-std::array<float,2>{0.853397846f, 0.205222279f},
-std::array<float,2>{0.705224931f, 0.639289498f},
-std::array<float,2>{0.174385101f, 0.400247604f},
-std::array<float,2>{0.00926241837f, 0.535482466f},
-std::array<float,2>{0.500011027f, 0.342180669f},
-std::array<float,2>{0.921313524f, 0.801698565f},
-std::array<float,2>{0.495772302f, 0.0566413887f},
-std::array<float,2>{0.10749992f, 0.993078232f},
-std::array<float,2>{0.609157324f, 0.17707178f},
-std::array<float,2>{0.971412957f, 0.718441486f},
-std::array<float,2>{0.418718666f, 0.454189092f},
-std::array<float,2>{0.312665731f, 0.580232739f},
-std::array<float,2>{0.751268148f, 0.304500401f},
-std::array<float,2>{0.639647365f, 0.838775337f},
-std::array<float,2>{0.241560027f, 0.0993727967f},
-std::array<float,2>{0.45514971f, 0.775109231f},
-std::array<float,2>{0.882465124f, 0.0117157744f},
-std::array<float,2>{0.546458066f, 0.51726979f},
-std::array<float,2>{0.0444361009f, 0.347219557f},
-std::array<float,2>{0.151536524f, 0.684970438f},
-std::array<float,2>{0.745449543f, 0.411975294f},
-std::array<float,2>{0.829962611f, 0.879139245f},
-std::array<float,2>{0.310862601f, 0.229315698f},
-std::array<float,2>{0.169691667f, 0.902544796f},
-std::array<float,2>{0.695282221f, 0.24817802f},
-std::array<float,2>{0.87209326f, 0.669098377f},
-std::array<float,2>{0.266963422f, 0.434927285f},
-std::array<float,2>{0.481891751f, 0.509672403f},
-std::array<float,2>{0.924386263f, 0.36846897f},
-std::array<float,2>{0.529595196f, 0.756451726f},
-std::array<float,2>{0.0184749402f, 0.0196754821f},
-std::array<float,2>{0.367433906f, 0.817316532f},
-std::array<float,2>{0.805475056f, 0.110726573f},
-std::array<float,2>{0.677116036f, 0.577221751f},
-std::array<float,2>{0.201817527f, 0.292784452f},
-std::array<float,2>{0.0877512991f, 0.699631035f},
-std::array<float,2>{0.577960193f, 0.442075849f},
-std::array<float,2>{0.958248675f, 0.982999623f},
-std::array<float,2>{0.406067342f, 0.170578852f},
-std::array<float,2>{0.0504733995f, 0.786673546f},
-std::array<float,2>{0.55009371f, 0.046621982f},
-std::array<float,2>{0.896592796f, 0.559577584f},
-std::array<float,2>{0.445430934f, 0.313699037f},
-std::array<float,2>{0.288919181f, 0.651536644f},
-std::array<float,2>{0.820404768f, 0.379929274f},
-std::array<float,2>{0.730534971f, 0.917857468f},
-std::array<float,2>{0.137562007f, 0.198314533f},
-std::array<float,2>{0.433916837f, 0.958208799f},
-std::array<float,2>{0.998346329f, 0.143745333f},
-std::array<float,2>{0.618554354f, 0.738365412f},
-std::array<float,2>{0.123367384f, 0.494752318f},
-std::array<float,2>{0.230280817f, 0.606503189f},
-std::array<float,2>{0.652394474f, 0.261530161f},
-std::array<float,2>{0.774377882f, 0.86795491f},
-std::array<float,2>{0.331577539f, 0.0653444678f},
-std::array<float,2>{0.225106582f, 0.798911095f},
-std::array<float,2>{0.647309184f, 0.0587837212f},
-std::array<float,2>{0.766596138f, 0.533557713f},
-std::array<float,2>{0.342293262f, 0.336445987f},
-std::array<float,2>{0.428885907f, 0.634027123f},
-std::array<float,2>{0.991546571f, 0.403654605f},
-std::array<float,2>{0.616663098f, 0.928606093f},
-std::array<float,2>{0.113734946f, 0.209554851f},
-std::array<float,2>{0.292871565f, 0.94892782f},
-std::array<float,2>{0.814675987f, 0.127567589f},
-std::array<float,2>{0.722572267f, 0.726527572f},
-std::array<float,2>{0.13162148f, 0.479006261f},
-std::array<float,2>{0.0579502024f, 0.618308246f},
-std::array<float,2>{0.558712184f, 0.268556386f},
-std::array<float,2>{0.905181527f, 0.84547776f},
-std::array<float,2>{0.437746584f, 0.0835435912f},
-std::array<float,2>{0.0830277577f, 0.878359616f},
-std::array<float,2>{0.566533089f, 0.232186526f},
-std::array<float,2>{0.965195417f, 0.681344867f},
-std::array<float,2>{0.394886464f, 0.407681137f},
-std::array<float,2>{0.365118474f, 0.519560039f},
-std::array<float,2>{0.801129341f, 0.3495543f},
-std::array<float,2>{0.68190527f, 0.777988732f},
-std::array<float,2>{0.193694323f, 0.0132645955f},
-std::array<float,2>{0.473407716f, 0.840700924f},
-std::array<float,2>{0.933613837f, 0.0976346731f},
-std::array<float,2>{0.518598914f, 0.582240462f},
-std::array<float,2>{0.0288459696f, 0.300115019f},
-std::array<float,2>{0.158490136f, 0.711290121f},
-std::array<float,2>{0.701852322f, 0.457047373f},
-std::array<float,2>{0.860311031f, 0.998351634f},
-std::array<float,2>{0.273776025f, 0.175479576f},
-std::array<float,2>{0.142763183f, 0.979631424f},
-std::array<float,2>{0.736338556f, 0.164717749f},
-std::array<float,2>{0.841842115f, 0.699069679f},
-std::array<float,2>{0.301784515f, 0.441145569f},
-std::array<float,2>{0.466929406f, 0.572429657f},
-std::array<float,2>{0.883943498f, 0.296443433f},
-std::array<float,2>{0.53850311f, 0.813722432f},
-std::array<float,2>{0.038024608f, 0.115925707f},
-std::array<float,2>{0.32660082f, 0.753324747f},
-std::array<float,2>{0.758871913f, 0.0191586297f},
-std::array<float,2>{0.62834096f, 0.513867736f},
-std::array<float,2>{0.244269863f, 0.371885777f},
-std::array<float,2>{0.094957523f, 0.666005313f},
-std::array<float,2>{0.59845078f, 0.430512547f},
-std::array<float,2>{0.97746557f, 0.899407327f},
-std::array<float,2>{0.407742858f, 0.2444942f},
-std::array<float,2>{0.0054713767f, 0.871155441f},
-std::array<float,2>{0.514266312f, 0.0695023984f},
-std::array<float,2>{0.90664649f, 0.603551209f},
-std::array<float,2>{0.491538912f, 0.265603304f},
-std::array<float,2>{0.262222916f, 0.73760879f},
-std::array<float,2>{0.849833965f, 0.497800022f},
-std::array<float,2>{0.716455638f, 0.953895807f},
-std::array<float,2>{0.182036445f, 0.146867082f},
-std::array<float,2>{0.387305975f, 0.921079636f},
-std::array<float,2>{0.951238036f, 0.200769886f},
-std::array<float,2>{0.582268357f, 0.654186189f},
-std::array<float,2>{0.0749958605f, 0.378612638f},
-std::array<float,2>{0.20553194f, 0.557831645f},
-std::array<float,2>{0.665231884f, 0.319934398f},
-std::array<float,2>{0.789561927f, 0.78377521f},
-std::array<float,2>{0.355727375f, 0.0406162515f},
-std::array<float,2>{0.177141011f, 0.821226776f},
-std::array<float,2>{0.708270431f, 0.121168442f},
-std::array<float,2>{0.855879068f, 0.568116546f},
-std::array<float,2>{0.250909328f, 0.288980812f},
-std::array<float,2>{0.498922616f, 0.690508366f},
-std::array<float,2>{0.917376041f, 0.44674322f},
-std::array<float,2>{0.505982697f, 0.97226125f},
-std::array<float,2>{0.0133656962f, 0.160044804f},
-std::array<float,2>{0.344501466f, 0.897186339f},
-std::array<float,2>{0.784152567f, 0.234420717f},
-std::array<float,2>{0.658188641f, 0.662079036f},
-std::array<float,2>{0.211234614f, 0.425428092f},
-std::array<float,2>{0.0692479163f, 0.503059208f},
-std::array<float,2>{0.591432035f, 0.36173737f},
-std::array<float,2>{0.940590084f, 0.763562679f},
-std::array<float,2>{0.377531737f, 0.0238183904f},
-std::array<float,2>{0.0391284637f, 0.964082003f},
-std::array<float,2>{0.54231149f, 0.148759335f},
-std::array<float,2>{0.878311157f, 0.74293226f},
-std::array<float,2>{0.459796101f, 0.491875499f},
-std::array<float,2>{0.306347549f, 0.596461713f},
-std::array<float,2>{0.833573401f, 0.250073165f},
-std::array<float,2>{0.748312891f, 0.863549411f},
-std::array<float,2>{0.155588493f, 0.0718841031f},
-std::array<float,2>{0.416340321f, 0.795659661f},
-std::array<float,2>{0.97622025f, 0.0353984311f},
-std::array<float,2>{0.601764083f, 0.553495049f},
-std::array<float,2>{0.103990458f, 0.327737331f},
-std::array<float,2>{0.235196769f, 0.640656352f},
-std::array<float,2>{0.634883821f, 0.383229494f},
-std::array<float,2>{0.755253553f, 0.9102844f},
-std::array<float,2>{0.316558152f, 0.191612899f},
-std::array<float,2>{0.197867379f, 0.935820878f},
-std::array<float,2>{0.673729777f, 0.213425949f},
-std::array<float,2>{0.809340179f, 0.630067706f},
-std::array<float,2>{0.374867827f, 0.398368478f},
-std::array<float,2>{0.400331914f, 0.546750128f},
-std::array<float,2>{0.953873575f, 0.332689703f},
-std::array<float,2>{0.57393688f, 0.80540508f},
-std::array<float,2>{0.090595603f, 0.0498058498f},
-std::array<float,2>{0.273348242f, 0.857168853f},
-std::array<float,2>{0.867251456f, 0.0893665627f},
-std::array<float,2>{0.691151083f, 0.617072463f},
-std::array<float,2>{0.164109498f, 0.27581647f},
-std::array<float,2>{0.0234346315f, 0.726887822f},
-std::array<float,2>{0.527335703f, 0.470492035f},
-std::array<float,2>{0.929097414f, 0.941433966f},
-std::array<float,2>{0.480375558f, 0.136071637f},
-std::array<float,2>{0.119133525f, 0.766374171f},
-std::array<float,2>{0.624394f, 0.00160337728f},
-std::array<float,2>{0.995511651f, 0.527350366f},
-std::array<float,2>{0.432244927f, 0.355350047f},
-std::array<float,2>{0.335383415f, 0.674281061f},
-std::array<float,2>{0.777754307f, 0.414076596f},
-std::array<float,2>{0.649603009f, 0.883768797f},
-std::array<float,2>{0.233831361f, 0.220139131f},
-std::array<float,2>{0.450468153f, 0.989165783f},
-std::array<float,2>{0.893129468f, 0.184219077f},
-std::array<float,2>{0.550791919f, 0.706467032f},
-std::array<float,2>{0.0514947921f, 0.462271094f},
-std::array<float,2>{0.134420723f, 0.588357151f},
-std::array<float,2>{0.729154646f, 0.309974492f},
-std::array<float,2>{0.825801313f, 0.830530524f},
-std::array<float,2>{0.28474924f, 0.106764346f},
-std::array<float,2>{0.136864334f, 0.788348138f},
-std::array<float,2>{0.731353879f, 0.043675147f},
-std::array<float,2>{0.820824504f, 0.561602831f},
-std::array<float,2>{0.288462818f, 0.316162318f},
-std::array<float,2>{0.446022689f, 0.650160313f},
-std::array<float,2>{0.89699626f, 0.382306337f},
-std::array<float,2>{0.5507074f, 0.914518058f},
-std::array<float,2>{0.0498462878f, 0.197096258f},
-std::array<float,2>{0.331213921f, 0.959317088f},
-std::array<float,2>{0.773886025f, 0.141800746f},
-std::array<float,2>{0.653083861f, 0.741642535f},
-std::array<float,2>{0.229704961f, 0.493949741f},
-std::array<float,2>{0.123858079f, 0.608402014f},
-std::array<float,2>{0.618860602f, 0.258525133f},
-std::array<float,2>{0.998925328f, 0.869819224f},
-std::array<float,2>{0.434134066f, 0.0626231208f},
-std::array<float,2>{0.0175931491f, 0.906147957f},
-std::array<float,2>{0.530229807f, 0.246817634f},
-std::array<float,2>{0.924042404f, 0.671370625f},
-std::array<float,2>{0.481962293f, 0.436990619f},
-std::array<float,2>{0.267095864f, 0.511173725f},
-std::array<float,2>{0.873007059f, 0.370664537f},
-std::array<float,2>{0.694376171f, 0.75570935f},
-std::array<float,2>{0.169259489f, 0.0217717849f},
-std::array<float,2>{0.405320764f, 0.818468094f},
-std::array<float,2>{0.958835721f, 0.111719452f},
-std::array<float,2>{0.577554822f, 0.575211525f},
-std::array<float,2>{0.0871332288f, 0.28980419f},
-std::array<float,2>{0.201433986f, 0.702771008f},
-std::array<float,2>{0.677438319f, 0.44445166f},
-std::array<float,2>{0.80484426f, 0.981258452f},
-std::array<float,2>{0.36807093f, 0.169115961f},
-std::array<float,2>{0.241914526f, 0.994452477f},
-std::array<float,2>{0.63912642f, 0.178176716f},
-std::array<float,2>{0.751865864f, 0.715381444f},
-std::array<float,2>{0.313317746f, 0.455797762f},
-std::array<float,2>{0.418136656f, 0.578281939f},
-std::array<float,2>{0.97102958f, 0.301040769f},
-std::array<float,2>{0.608734429f, 0.83689177f},
-std::array<float,2>{0.108125553f, 0.101424821f},
-std::array<float,2>{0.311148107f, 0.776550412f},
-std::array<float,2>{0.8292436f, 0.00930521544f},
-std::array<float,2>{0.745636344f, 0.518952727f},
-std::array<float,2>{0.152235836f, 0.345688045f},
-std::array<float,2>{0.0443645455f, 0.686867476f},
-std::array<float,2>{0.546031713f, 0.412984043f},
-std::array<float,2>{0.881891429f, 0.882078588f},
-std::array<float,2>{0.455844343f, 0.227437347f},
-std::array<float,2>{0.063674897f, 0.850925505f},
-std::array<float,2>{0.587665439f, 0.080803141f},
-std::array<float,2>{0.941537619f, 0.623697221f},
-std::array<float,2>{0.380613863f, 0.270597339f},
-std::array<float,2>{0.350919813f, 0.719872713f},
-std::array<float,2>{0.786915064f, 0.483591348f},
-std::array<float,2>{0.663842201f, 0.949603736f},
-std::array<float,2>{0.215754971f, 0.1317458f},
-std::array<float,2>{0.495536387f, 0.92280519f},
-std::array<float,2>{0.92167604f, 0.203509301f},
-std::array<float,2>{0.500806868f, 0.638237059f},
-std::array<float,2>{0.00942761637f, 0.40159294f},
-std::array<float,2>{0.174102157f, 0.537541628f},
-std::array<float,2>{0.705784321f, 0.34073028f},
-std::array<float,2>{0.852970123f, 0.803191662f},
-std::array<float,2>{0.254932106f, 0.0563448556f},
-std::array<float,2>{0.209043249f, 0.832284331f},
-std::array<float,2>{0.670605898f, 0.10293366f},
-std::array<float,2>{0.794983208f, 0.592154682f},
-std::array<float,2>{0.355207711f, 0.304768056f},
-std::array<float,2>{0.38415134f, 0.707107067f},
-std::array<float,2>{0.946726739f, 0.466329902f},
-std::array<float,2>{0.58095026f, 0.986598969f},
-std::array<float,2>{0.072183609f, 0.181739584f},
-std::array<float,2>{0.258033484f, 0.88945502f},
-std::array<float,2>{0.847511888f, 0.223305732f},
-std::array<float,2>{0.714052022f, 0.67898488f},
-std::array<float,2>{0.184972838f, 0.420101017f},
-std::array<float,2>{0.00226431829f, 0.527232409f},
-std::array<float,2>{0.511319637f, 0.358451843f},
-std::array<float,2>{0.913817644f, 0.770196795f},
-std::array<float,2>{0.485759467f, 0.00503793964f},
-std::array<float,2>{0.0999428257f, 0.940444291f},
-std::array<float,2>{0.595336914f, 0.1373941f},
-std::array<float,2>{0.983960807f, 0.731867611f},
-std::array<float,2>{0.412647396f, 0.474617273f},
-std::array<float,2>{0.324202538f, 0.612385094f},
-std::array<float,2>{0.765260756f, 0.277873933f},
-std::array<float,2>{0.631855428f, 0.855372488f},
-std::array<float,2>{0.247622415f, 0.0901718065f},
-std::array<float,2>{0.462995648f, 0.809361875f},
-std::array<float,2>{0.890262246f, 0.0540373325f},
-std::array<float,2>{0.534150422f, 0.541455269f},
-std::array<float,2>{0.031579081f, 0.328704208f},
-std::array<float,2>{0.148007691f, 0.627805948f},
-std::array<float,2>{0.741598606f, 0.393075943f},
-std::array<float,2>{0.836425424f, 0.929794788f},
-std::array<float,2>{0.299085945f, 0.218566388f},
-std::array<float,2>{0.162407622f, 0.907809079f},
-std::array<float,2>{0.698972523f, 0.190298721f},
-std::array<float,2>{0.863710165f, 0.644815385f},
-std::array<float,2>{0.279989511f, 0.38737759f},
-std::array<float,2>{0.472500086f, 0.548349202f},
-std::array<float,2>{0.932148278f, 0.322621763f},
-std::array<float,2>{0.521523952f, 0.792445898f},
-std::array<float,2>{0.0242243968f, 0.0330865048f},
-std::array<float,2>{0.359524876f, 0.862988472f},
-std::array<float,2>{0.798030615f, 0.0744595453f},
-std::array<float,2>{0.687320352f, 0.600439191f},
-std::array<float,2>{0.189241484f, 0.257249743f},
-std::array<float,2>{0.0787724033f, 0.748517692f},
-std::array<float,2>{0.563437998f, 0.484384835f},
-std::array<float,2>{0.962513983f, 0.967225194f},
-std::array<float,2>{0.392557502f, 0.152522355f},
-std::array<float,2>{0.0590904877f, 0.758322537f},
-std::array<float,2>{0.555206418f, 0.0285207275f},
-std::array<float,2>{0.901775479f, 0.504839718f},
-std::array<float,2>{0.444309056f, 0.363867879f},
-std::array<float,2>{0.295866877f, 0.656961083f},
-std::array<float,2>{0.817896247f, 0.429106981f},
-std::array<float,2>{0.723364532f, 0.89255482f},
-std::array<float,2>{0.127363533f, 0.239311025f},
-std::array<float,2>{0.422990054f, 0.973140419f},
-std::array<float,2>{0.988078237f, 0.161997512f},
-std::array<float,2>{0.611700058f, 0.692035854f},
-std::array<float,2>{0.109628581f, 0.452766746f},
-std::array<float,2>{0.219003692f, 0.564559817f},
-std::array<float,2>{0.642451584f, 0.283341259f},
-std::array<float,2>{0.771918833f, 0.827337801f},
-std::array<float,2>{0.339074016f, 0.12002597f},
-std::array<float,2>{0.234364629f, 0.767878532f},
-std::array<float,2>{0.64992708f, 0.00226208312f},
-std::array<float,2>{0.778207183f, 0.529983342f},
-std::array<float,2>{0.335554898f, 0.35311386f},
-std::array<float,2>{0.431742311f, 0.672061861f},
-std::array<float,2>{0.995653331f, 0.417413175f},
-std::array<float,2>{0.624797702f, 0.886134863f},
-std::array<float,2>{0.118225932f, 0.222612709f},
-std::array<float,2>{0.284653097f, 0.991452336f},
-std::array<float,2>{0.825416923f, 0.186865479f},
-std::array<float,2>{0.728697538f, 0.703820705f},
-std::array<float,2>{0.134276003f, 0.463386744f},
-std::array<float,2>{0.0512246788f, 0.586816192f},
-std::array<float,2>{0.551543891f, 0.311753631f},
-std::array<float,2>{0.892982304f, 0.828677893f},
-std::array<float,2>{0.451167136f, 0.108204894f},
-std::array<float,2>{0.0899434015f, 0.935418427f},
-std::array<float,2>{0.573560357f, 0.212648511f},
-std::array<float,2>{0.953388512f, 0.631665528f},
-std::array<float,2>{0.399469912f, 0.396196365f},
-std::array<float,2>{0.374483287f, 0.54414767f},
-std::array<float,2>{0.808741689f, 0.335275948f},
-std::array<float,2>{0.673156917f, 0.808155477f},
-std::array<float,2>{0.197658136f, 0.0481230021f},
-std::array<float,2>{0.479582995f, 0.859211326f},
-std::array<float,2>{0.929372787f, 0.0867927745f},
-std::array<float,2>{0.526583433f, 0.614120543f},
-std::array<float,2>{0.0229096524f, 0.274564356f},
-std::array<float,2>{0.164895564f, 0.728581965f},
-std::array<float,2>{0.690481007f, 0.471643567f},
-std::array<float,2>{0.86792171f, 0.945019245f},
-std::array<float,2>{0.272774816f, 0.134202942f},
-std::array<float,2>{0.156075567f, 0.962121189f},
-std::array<float,2>{0.748796523f, 0.152130201f},
-std::array<float,2>{0.833458483f, 0.744377494f},
-std::array<float,2>{0.306032389f, 0.490078419f},
-std::array<float,2>{0.459034681f, 0.594742239f},
-std::array<float,2>{0.878502429f, 0.25244391f},
-std::array<float,2>{0.542494953f, 0.865386903f},
-std::array<float,2>{0.0400071517f, 0.0730400905f},
-std::array<float,2>{0.317138076f, 0.793597996f},
-std::array<float,2>{0.755539894f, 0.0388645828f},
-std::array<float,2>{0.63557297f, 0.55230242f},
-std::array<float,2>{0.234768316f, 0.324584275f},
-std::array<float,2>{0.104314536f, 0.642585218f},
-std::array<float,2>{0.602091312f, 0.386595398f},
-std::array<float,2>{0.975972891f, 0.912931442f},
-std::array<float,2>{0.416603118f, 0.193884432f},
-std::array<float,2>{0.0128421644f, 0.823847711f},
-std::array<float,2>{0.506689489f, 0.124738157f},
-std::array<float,2>{0.917644322f, 0.569995224f},
-std::array<float,2>{0.498265147f, 0.285812646f},
-std::array<float,2>{0.25041309f, 0.68893677f},
-std::array<float,2>{0.856380522f, 0.447308809f},
-std::array<float,2>{0.708833873f, 0.969461262f},
-std::array<float,2>{0.177642897f, 0.157336593f},
-std::array<float,2>{0.3769885f, 0.895514607f},
-std::array<float,2>{0.940938711f, 0.237032071f},
-std::array<float,2>{0.591150343f, 0.663490534f},
-std::array<float,2>{0.0686319917f, 0.422901869f},
-std::array<float,2>{0.211750939f, 0.501462519f},
-std::array<float,2>{0.657265902f, 0.359463215f},
-std::array<float,2>{0.783387244f, 0.763689697f},
-std::array<float,2>{0.343932301f, 0.0254746061f},
-std::array<float,2>{0.182564721f, 0.873072922f},
-std::array<float,2>{0.716242909f, 0.0667605251f},
-std::array<float,2>{0.850180805f, 0.602054417f},
-std::array<float,2>{0.261928856f, 0.263016075f},
-std::array<float,2>{0.491999358f, 0.735472023f},
-std::array<float,2>{0.907127619f, 0.499484211f},
-std::array<float,2>{0.513774395f, 0.955487311f},
-std::array<float,2>{0.00501897f, 0.14494811f},
-std::array<float,2>{0.356330842f, 0.918735802f},
-std::array<float,2>{0.789543033f, 0.202910841f},
-std::array<float,2>{0.666014612f, 0.656106591f},
-std::array<float,2>{0.205845818f, 0.375949681f},
-std::array<float,2>{0.07442341f, 0.555736601f},
-std::array<float,2>{0.582898378f, 0.317577064f},
-std::array<float,2>{0.952046096f, 0.782095194f},
-std::array<float,2>{0.386752725f, 0.0428022519f},
-std::array<float,2>{0.0374632627f, 0.977791548f},
-std::array<float,2>{0.538715899f, 0.166633472f},
-std::array<float,2>{0.884630859f, 0.696432292f},
-std::array<float,2>{0.467324972f, 0.438871831f},
-std::array<float,2>{0.302518964f, 0.570835233f},
-std::array<float,2>{0.842569292f, 0.294871926f},
-std::array<float,2>{0.737181246f, 0.815445423f},
-std::array<float,2>{0.143462345f, 0.113424495f},
-std::array<float,2>{0.407231331f, 0.750416696f},
-std::array<float,2>{0.976835907f, 0.0166758113f},
-std::array<float,2>{0.597658694f, 0.511848092f},
-std::array<float,2>{0.095697619f, 0.374248028f},
-std::array<float,2>{0.244927406f, 0.66715467f},
-std::array<float,2>{0.628873646f, 0.433336705f},
-std::array<float,2>{0.759369671f, 0.90085578f},
-std::array<float,2>{0.326936245f, 0.242641404f},
-std::array<float,2>{0.194178715f, 0.876243055f},
-std::array<float,2>{0.682211101f, 0.233297274f},
-std::array<float,2>{0.801390529f, 0.68271935f},
-std::array<float,2>{0.364632279f, 0.408240587f},
-std::array<float,2>{0.395039111f, 0.522392571f},
-std::array<float,2>{0.965650737f, 0.35078004f},
-std::array<float,2>{0.567083836f, 0.780838132f},
-std::array<float,2>{0.0837161839f, 0.0150457136f},
-std::array<float,2>{0.274316192f, 0.842955887f},
-std::array<float,2>{0.859430552f, 0.0952111408f},
-std::array<float,2>{0.701303124f, 0.584147096f},
-std::array<float,2>{0.158931091f, 0.298571944f},
-std::array<float,2>{0.0285299793f, 0.713188946f},
-std::array<float,2>{0.51913327f, 0.459909081f},
-std::array<float,2>{0.934163511f, 0.996182382f},
-std::array<float,2>{0.472946763f, 0.172907397f},
-std::array<float,2>{0.114061967f, 0.798576057f},
-std::array<float,2>{0.616746604f, 0.0614363067f},
-std::array<float,2>{0.992053568f, 0.532392085f},
-std::array<float,2>{0.429232627f, 0.338913888f},
-std::array<float,2>{0.342119366f, 0.635907412f},
-std::array<float,2>{0.765819609f, 0.404644936f},
-std::array<float,2>{0.646830797f, 0.926911235f},
-std::array<float,2>{0.224887028f, 0.208759189f},
-std::array<float,2>{0.438445747f, 0.94537431f},
-std::array<float,2>{0.904625118f, 0.126813203f},
-std::array<float,2>{0.559429944f, 0.724335015f},
-std::array<float,2>{0.0581435412f, 0.477384746f},
-std::array<float,2>{0.131025419f, 0.620581925f},
-std::array<float,2>{0.721853256f, 0.266771287f},
-std::array<float,2>{0.815390706f, 0.845909715f},
-std::array<float,2>{0.292019993f, 0.0844566301f},
-std::array<float,2>{0.17018649f, 0.756156087f},
-std::array<float,2>{0.692230165f, 0.0201625787f},
-std::array<float,2>{0.873836458f, 0.508860052f},
-std::array<float,2>{0.26928401f, 0.368967742f},
-std::array<float,2>{0.483115852f, 0.669468284f},
-std::array<float,2>{0.923427939f, 0.435268134f},
-std::array<float,2>{0.528911412f, 0.903136015f},
-std::array<float,2>{0.0171361994f, 0.248861775f},
-std::array<float,2>{0.369844913f, 0.982791185f},
-std::array<float,2>{0.808274329f, 0.170246944f},
-std::array<float,2>{0.678648889f, 0.700157464f},
-std::array<float,2>{0.199510589f, 0.441466093f},
-std::array<float,2>{0.0883084983f, 0.578078151f},
-std::array<float,2>{0.575846791f, 0.29207781f},
-std::array<float,2>{0.959070265f, 0.816644073f},
-std::array<float,2>{0.403575957f, 0.11112155f},
-std::array<float,2>{0.0471686088f, 0.917373657f},
-std::array<float,2>{0.547599733f, 0.199043036f},
-std::array<float,2>{0.896118879f, 0.652232707f},
-std::array<float,2>{0.44834435f, 0.380768567f},
-std::array<float,2>{0.285573423f, 0.560281813f},
-std::array<float,2>{0.823137581f, 0.314421684f},
-std::array<float,2>{0.733659863f, 0.786378503f},
-std::array<float,2>{0.13990058f, 0.0462496132f},
-std::array<float,2>{0.436371922f, 0.867320955f},
-std::array<float,2>{0.997765303f, 0.0647661388f},
-std::array<float,2>{0.621011317f, 0.607344687f},
-std::array<float,2>{0.122935474f, 0.261191756f},
-std::array<float,2>{0.228198424f, 0.738885105f},
-std::array<float,2>{0.655308545f, 0.49439621f},
-std::array<float,2>{0.77712518f, 0.958734989f},
-std::array<float,2>{0.32874158f, 0.144177899f},
-std::array<float,2>{0.216971681f, 0.952399373f},
-std::array<float,2>{0.66017282f, 0.129611313f},
-std::array<float,2>{0.787232339f, 0.720821083f},
-std::array<float,2>{0.348660946f, 0.481470942f},
-std::array<float,2>{0.382007897f, 0.621865392f},
-std::array<float,2>{0.94398421f, 0.273389012f},
-std::array<float,2>{0.589349985f, 0.848804355f},
-std::array<float,2>{0.0652380139f, 0.0798297077f},
-std::array<float,2>{0.257546633f, 0.800978541f},
-std::array<float,2>{0.854196429f, 0.0571846031f},
-std::array<float,2>{0.704386473f, 0.535906434f},
-std::array<float,2>{0.172354266f, 0.342770547f},
-std::array<float,2>{0.0102517437f, 0.638681173f},
-std::array<float,2>{0.502097726f, 0.399451643f},
-std::array<float,2>{0.918105423f, 0.924054861f},
-std::array<float,2>{0.493771911f, 0.205782726f},
-std::array<float,2>{0.106929466f, 0.838042617f},
-std::array<float,2>{0.606454492f, 0.0989836976f},
-std::array<float,2>{0.969243228f, 0.580680549f},
-std::array<float,2>{0.421348184f, 0.303791255f},
-std::array<float,2>{0.31604439f, 0.717991829f},
-std::array<float,2>{0.753145635f, 0.454891503f},
-std::array<float,2>{0.638075233f, 0.992541373f},
-std::array<float,2>{0.239194497f, 0.17760092f},
-std::array<float,2>{0.453618646f, 0.879771352f},
-std::array<float,2>{0.87965548f, 0.22866796f},
-std::array<float,2>{0.543697178f, 0.685234725f},
-std::array<float,2>{0.0449446663f, 0.411290139f},
-std::array<float,2>{0.148657992f, 0.516943276f},
-std::array<float,2>{0.743982911f, 0.346853107f},
-std::array<float,2>{0.831606865f, 0.774862051f},
-std::array<float,2>{0.308695763f, 0.0110504869f},
-std::array<float,2>{0.249363571f, 0.852162659f},
-std::array<float,2>{0.630702496f, 0.0927892551f},
-std::array<float,2>{0.763030589f, 0.609804153f},
-std::array<float,2>{0.321032763f, 0.280563146f},
-std::array<float,2>{0.410859376f, 0.733627617f},
-std::array<float,2>{0.981756926f, 0.47302714f},
-std::array<float,2>{0.597463489f, 0.937871516f},
-std::array<float,2>{0.0992903039f, 0.138673916f},
-std::array<float,2>{0.298428804f, 0.933181822f},
-std::array<float,2>{0.839426935f, 0.216751084f},
-std::array<float,2>{0.738967478f, 0.625617564f},
-std::array<float,2>{0.1458828f, 0.39103359f},
-std::array<float,2>{0.0346616991f, 0.540647984f},
-std::array<float,2>{0.53174752f, 0.330485016f},
-std::array<float,2>{0.888066947f, 0.811014712f},
-std::array<float,2>{0.461672932f, 0.0525378808f},
-std::array<float,2>{0.0722762942f, 0.984795749f},
-std::array<float,2>{0.578558505f, 0.180663198f},
-std::array<float,2>{0.948338628f, 0.71050477f},
-std::array<float,2>{0.386446625f, 0.467199653f},
-std::array<float,2>{0.353197217f, 0.590623558f},
-std::array<float,2>{0.793389082f, 0.307294011f},
-std::array<float,2>{0.668531716f, 0.834279418f},
-std::array<float,2>{0.208719313f, 0.104813054f},
-std::array<float,2>{0.487050146f, 0.772509813f},
-std::array<float,2>{0.910907924f, 0.00727447728f},
-std::array<float,2>{0.509616435f, 0.525185704f},
-std::array<float,2>{0.0019247625f, 0.357256174f},
-std::array<float,2>{0.186485708f, 0.676322818f},
-std::array<float,2>{0.711786211f, 0.418397844f},
-std::array<float,2>{0.843761384f, 0.888356984f},
-std::array<float,2>{0.260060936f, 0.225087047f},
-std::array<float,2>{0.12533085f, 0.893516064f},
-std::array<float,2>{0.725975037f, 0.241596773f},
-std::array<float,2>{0.818611205f, 0.658863366f},
-std::array<float,2>{0.293347687f, 0.427181244f},
-std::array<float,2>{0.441995621f, 0.506720126f},
-std::array<float,2>{0.90018791f, 0.365838796f},
-std::array<float,2>{0.558177173f, 0.761648655f},
-std::array<float,2>{0.0609115958f, 0.029912807f},
-std::array<float,2>{0.33662203f, 0.825005591f},
-std::array<float,2>{0.770787716f, 0.118499883f},
-std::array<float,2>{0.644020915f, 0.563264072f},
-std::array<float,2>{0.221555293f, 0.281386018f},
-std::array<float,2>{0.11250177f, 0.694780052f},
-std::array<float,2>{0.609657288f, 0.449659854f},
-std::array<float,2>{0.985957086f, 0.974789679f},
-std::array<float,2>{0.425198972f, 0.162499353f},
-std::array<float,2>{0.0254008528f, 0.789345622f},
-std::array<float,2>{0.521119893f, 0.0342187136f},
-std::array<float,2>{0.929823756f, 0.548899293f},
-std::array<float,2>{0.470445156f, 0.321432173f},
-std::array<float,2>{0.278799921f, 0.647527099f},
-std::array<float,2>{0.866193116f, 0.390494108f},
-std::array<float,2>{0.695752323f, 0.909140885f},
-std::array<float,2>{0.161904961f, 0.187821224f},
-std::array<float,2>{0.394049913f, 0.965608954f},
-std::array<float,2>{0.963276327f, 0.156111225f},
-std::array<float,2>{0.564966261f, 0.747433782f},
-std::array<float,2>{0.0811900496f, 0.486543924f},
-std::array<float,2>{0.189869255f, 0.598073483f},
-std::array<float,2>{0.685364544f, 0.255360037f},
-std::array<float,2>{0.800322056f, 0.859755814f},
-std::array<float,2>{0.362936109f, 0.0780241713f},
-std::array<float,2>{0.19704324f, 0.805058897f},
-std::array<float,2>{0.675218105f, 0.0504668504f},
-std::array<float,2>{0.811982691f, 0.546123743f},
-std::array<float,2>{0.371354789f, 0.332330972f},
-std::array<float,2>{0.402052492f, 0.630378425f},
-std::array<float,2>{0.95647645f, 0.397550344f},
-std::array<float,2>{0.57038182f, 0.936425209f},
-std::array<float,2>{0.0920418799f, 0.213032052f},
-std::array<float,2>{0.271132141f, 0.942191362f},
-std::array<float,2>{0.869260192f, 0.136631459f},
-std::array<float,2>{0.687960327f, 0.727315784f},
-std::array<float,2>{0.16740723f, 0.469726712f},
-std::array<float,2>{0.0214587878f, 0.616244197f},
-std::array<float,2>{0.523767233f, 0.276096553f},
-std::array<float,2>{0.926091492f, 0.856674612f},
-std::array<float,2>{0.476743132f, 0.0891732648f},
-std::array<float,2>{0.120306067f, 0.88301456f},
-std::array<float,2>{0.622755051f, 0.220623791f},
-std::array<float,2>{0.992193222f, 0.674383044f},
-std::array<float,2>{0.431345671f, 0.414829403f},
-std::array<float,2>{0.332217634f, 0.528084815f},
-std::array<float,2>{0.780445933f, 0.354501188f},
-std::array<float,2>{0.651304483f, 0.765812278f},
-std::array<float,2>{0.231711075f, 0.00143103127f},
-std::array<float,2>{0.451638907f, 0.831050992f},
-std::array<float,2>{0.892227769f, 0.107026264f},
-std::array<float,2>{0.552976787f, 0.588435054f},
-std::array<float,2>{0.0531754345f, 0.310118586f},
-std::array<float,2>{0.136255756f, 0.707027614f},
-std::array<float,2>{0.728373408f, 0.462486774f},
-std::array<float,2>{0.827304125f, 0.988376021f},
-std::array<float,2>{0.281293362f, 0.183977559f},
-std::array<float,2>{0.177787974f, 0.971949041f},
-std::array<float,2>{0.70943743f, 0.159649357f},
-std::array<float,2>{0.858121037f, 0.690989673f},
-std::array<float,2>{0.253314167f, 0.446900427f},
-std::array<float,2>{0.496829718f, 0.56779182f},
-std::array<float,2>{0.914444685f, 0.288199514f},
-std::array<float,2>{0.504513621f, 0.820406556f},
-std::array<float,2>{0.0137820793f, 0.121784829f},
-std::array<float,2>{0.346576631f, 0.762742758f},
-std::array<float,2>{0.78129071f, 0.0241217948f},
-std::array<float,2>{0.659360349f, 0.503812969f},
-std::array<float,2>{0.213800177f, 0.362075925f},
-std::array<float,2>{0.0670551658f, 0.661336303f},
-std::array<float,2>{0.592626989f, 0.425029308f},
-std::array<float,2>{0.938300192f, 0.896550655f},
-std::array<float,2>{0.37579757f, 0.235031113f},
-std::array<float,2>{0.0420968905f, 0.86406219f},
-std::array<float,2>{0.53957516f, 0.0715481937f},
-std::array<float,2>{0.875161707f, 0.596045911f},
-std::array<float,2>{0.457090765f, 0.250773013f},
-std::array<float,2>{0.306888878f, 0.742412448f},
-std::array<float,2>{0.834461033f, 0.491526544f},
-std::array<float,2>{0.747739792f, 0.964757919f},
-std::array<float,2>{0.152976155f, 0.149301901f},
-std::array<float,2>{0.41535607f, 0.910908639f},
-std::array<float,2>{0.972916007f, 0.192178071f},
-std::array<float,2>{0.603953779f, 0.641371131f},
-std::array<float,2>{0.101634376f, 0.383328378f},
-std::array<float,2>{0.238010779f, 0.552815855f},
-std::array<float,2>{0.633991778f, 0.327312499f},
-std::array<float,2>{0.756898046f, 0.795294464f},
-std::array<float,2>{0.319666058f, 0.0358271338f},
-std::array<float,2>{0.141258121f, 0.81411171f},
-std::array<float,2>{0.736091912f, 0.115606494f},
-std::array<float,2>{0.840334296f, 0.572942853f},
-std::array<float,2>{0.302786827f, 0.296143025f},
-std::array<float,2>{0.465249181f, 0.698420525f},
-std::array<float,2>{0.885267138f, 0.440521747f},
-std::array<float,2>{0.535887182f, 0.980356634f},
-std::array<float,2>{0.0354734734f, 0.164194494f},
-std::array<float,2>{0.324517488f, 0.898651838f},
-std::array<float,2>{0.760531723f, 0.244740367f},
-std::array<float,2>{0.62566489f, 0.665279329f},
-std::array<float,2>{0.242206991f, 0.429852813f},
-std::array<float,2>{0.0962302238f, 0.514371991f},
-std::array<float,2>{0.600862861f, 0.371559262f},
-std::array<float,2>{0.980061769f, 0.753772974f},
-std::array<float,2>{0.408424407f, 0.0188418049f},
-std::array<float,2>{0.00716092717f, 0.953262746f},
-std::array<float,2>{0.513267398f, 0.147212595f},
-std::array<float,2>{0.909988999f, 0.737915635f},
-std::array<float,2>{0.489613742f, 0.497352481f},
-std::array<float,2>{0.264308959f, 0.60419023f},
-std::array<float,2>{0.847752929f, 0.264995307f},
-std::array<float,2>{0.718313813f, 0.871887803f},
-std::array<float,2>{0.181530342f, 0.0699768215f},
-std::array<float,2>{0.389774114f, 0.783306181f},
-std::array<float,2>{0.950603068f, 0.0404029377f},
-std::array<float,2>{0.58504039f, 0.558140755f},
-std::array<float,2>{0.0772307888f, 0.319757015f},
-std::array<float,2>{0.204062566f, 0.653696358f},
-std::array<float,2>{0.667834759f, 0.377937585f},
-std::array<float,2>{0.79132241f, 0.921673477f},
-std::array<float,2>{0.358160943f, 0.20051077f},
-std::array<float,2>{0.224482447f, 0.928102076f},
-std::array<float,2>{0.645103633f, 0.209384799f},
-std::array<float,2>{0.769234121f, 0.634376109f},
-std::array<float,2>{0.340729833f, 0.404234737f},
-std::array<float,2>{0.427591115f, 0.534092069f},
-std::array<float,2>{0.989579499f, 0.336295009f},
-std::array<float,2>{0.614436507f, 0.799753428f},
-std::array<float,2>{0.116441928f, 0.0593012646f},
-std::array<float,2>{0.290436924f, 0.845034063f},
-std::array<float,2>{0.813503087f, 0.0833253488f},
-std::array<float,2>{0.720595181f, 0.619107664f},
-std::array<float,2>{0.129033893f, 0.269051611f},
-std::array<float,2>{0.0558810271f, 0.725885272f},
-std::array<float,2>{0.560879052f, 0.478840858f},
-std::array<float,2>{0.903128445f, 0.94828099f},
-std::array<float,2>{0.439697742f, 0.12699829f},
-std::array<float,2>{0.0855509564f, 0.777568161f},
-std::array<float,2>{0.568706691f, 0.0127187315f},
-std::array<float,2>{0.96814698f, 0.520267725f},
-std::array<float,2>{0.397997171f, 0.348922014f},
-std::array<float,2>{0.365661472f, 0.681020081f},
-std::array<float,2>{0.803164124f, 0.407760024f},
-std::array<float,2>{0.680760086f, 0.87859416f},
-std::array<float,2>{0.192903042f, 0.231538132f},
-std::array<float,2>{0.474903822f, 0.998601496f},
-std::array<float,2>{0.937177062f, 0.175112352f},
-std::array<float,2>{0.516814113f, 0.711642742f},
-std::array<float,2>{0.0298199058f, 0.457640678f},
-std::array<float,2>{0.156446993f, 0.582535923f},
-std::array<float,2>{0.699677169f, 0.300441265f},
-std::array<float,2>{0.861883879f, 0.839867413f},
-std::array<float,2>{0.277309418f, 0.0969450101f},
-std::array<float,2>{0.173723757f, 0.804631233f},
-std::array<float,2>{0.703529239f, 0.0550866947f},
-std::array<float,2>{0.85532552f, 0.538296223f},
-std::array<float,2>{0.256126642f, 0.340924621f},
-std::array<float,2>{0.492959648f, 0.637437701f},
-std::array<float,2>{0.9190467f, 0.400746018f},
-std::array<float,2>{0.503029466f, 0.923495591f},
-std::array<float,2>{0.0111435112f, 0.204145059f},
-std::array<float,2>{0.348562896f, 0.950269759f},
-std::array<float,2>{0.788094342f, 0.132534996f},
-std::array<float,2>{0.661690116f, 0.718934774f},
-std::array<float,2>{0.218328789f, 0.482552171f},
-std::array<float,2>{0.0657267645f, 0.62477994f},
-std::array<float,2>{0.587953031f, 0.27003926f},
-std::array<float,2>{0.944415629f, 0.850479126f},
-std::array<float,2>{0.381342381f, 0.0814781711f},
-std::array<float,2>{0.0462904535f, 0.881627202f},
-std::array<float,2>{0.544383943f, 0.228174046f},
-std::array<float,2>{0.879930913f, 0.685821235f},
-std::array<float,2>{0.454271883f, 0.413540214f},
-std::array<float,2>{0.30967015f, 0.518261492f},
-std::array<float,2>{0.830585659f, 0.343832731f},
-std::array<float,2>{0.742448568f, 0.776359081f},
-std::array<float,2>{0.1495713f, 0.00836084597f},
-std::array<float,2>{0.42059657f, 0.837636888f},
-std::array<float,2>{0.970111668f, 0.100224532f},
-std::array<float,2>{0.606001496f, 0.580001295f},
-std::array<float,2>{0.105752595f, 0.302086264f},
-std::array<float,2>{0.239609823f, 0.715921819f},
-std::array<float,2>{0.637680829f, 0.456508964f},
-std::array<float,2>{0.752631485f, 0.99529475f},
-std::array<float,2>{0.314997166f, 0.179093778f},
-std::array<float,2>{0.200233757f, 0.982379496f},
-std::array<float,2>{0.679524958f, 0.168794692f},
-std::array<float,2>{0.806732774f, 0.701270044f},
-std::array<float,2>{0.370431602f, 0.44406724f},
-std::array<float,2>{0.403035015f, 0.574972034f},
-std::array<float,2>{0.959961534f, 0.290464729f},
-std::array<float,2>{0.574379086f, 0.820073307f},
-std::array<float,2>{0.0895188302f, 0.113067292f},
-std::array<float,2>{0.268302739f, 0.754333675f},
-std::array<float,2>{0.874108911f, 0.0234091822f},
-std::array<float,2>{0.692803383f, 0.510611117f},
-std::array<float,2>{0.171263844f, 0.369558513f},
-std::array<float,2>{0.0165188983f, 0.669976294f},
-std::array<float,2>{0.527911544f, 0.435898513f},
-std::array<float,2>{0.921876609f, 0.904676318f},
-std::array<float,2>{0.484019011f, 0.247186705f},
-std::array<float,2>{0.121411987f, 0.870159149f},
-std::array<float,2>{0.619254768f, 0.0636605024f},
-std::array<float,2>{0.996843636f, 0.608284235f},
-std::array<float,2>{0.437231779f, 0.259642303f},
-std::array<float,2>{0.329931945f, 0.740869462f},
-std::array<float,2>{0.776040316f, 0.492488503f},
-std::array<float,2>{0.654898584f, 0.960808754f},
-std::array<float,2>{0.22710593f, 0.141308159f},
-std::array<float,2>{0.448083401f, 0.91528219f},
-std::array<float,2>{0.894743264f, 0.196147874f},
-std::array<float,2>{0.548303485f, 0.648976326f},
-std::array<float,2>{0.0480002649f, 0.380893111f},
-std::array<float,2>{0.139391974f, 0.560826421f},
-std::array<float,2>{0.733054817f, 0.314846247f},
-std::array<float,2>{0.823916972f, 0.787823796f},
-std::array<float,2>{0.286835819f, 0.0446578972f},
-std::array<float,2>{0.221846595f, 0.82689774f},
-std::array<float,2>{0.643312514f, 0.120829396f},
-std::array<float,2>{0.769983649f, 0.565806985f},
-std::array<float,2>{0.337774694f, 0.284647435f},
-std::array<float,2>{0.424267232f, 0.692816556f},
-std::array<float,2>{0.985210478f, 0.451227576f},
-std::array<float,2>{0.611292481f, 0.974373221f},
-std::array<float,2>{0.111732669f, 0.161067784f},
-std::array<float,2>{0.293963373f, 0.891011596f},
-std::array<float,2>{0.819881737f, 0.239182666f},
-std::array<float,2>{0.724917114f, 0.657429934f},
-std::array<float,2>{0.126008689f, 0.427741706f},
-std::array<float,2>{0.0623929054f, 0.50528872f},
-std::array<float,2>{0.557551742f, 0.364791721f},
-std::array<float,2>{0.898562491f, 0.759748518f},
-std::array<float,2>{0.442869455f, 0.0282954946f},
-std::array<float,2>{0.0801411048f, 0.967819929f},
-std::array<float,2>{0.565493643f, 0.153627932f},
-std::array<float,2>{0.964713812f, 0.74922353f},
-std::array<float,2>{0.393248439f, 0.48555553f},
-std::array<float,2>{0.361486971f, 0.601056218f},
-std::array<float,2>{0.799615502f, 0.256189167f},
-std::array<float,2>{0.684489787f, 0.8614465f},
-std::array<float,2>{0.190634966f, 0.0758920237f},
-std::array<float,2>{0.46881929f, 0.791423917f},
-std::array<float,2>{0.930948019f, 0.0313902646f},
-std::array<float,2>{0.520465255f, 0.54701364f},
-std::array<float,2>{0.0267156269f, 0.323865682f},
-std::array<float,2>{0.160463154f, 0.64606142f},
-std::array<float,2>{0.696527541f, 0.388142645f},
-std::array<float,2>{0.86698401f, 0.906892657f},
-std::array<float,2>{0.278101742f, 0.190509304f},
-std::array<float,2>{0.145011663f, 0.930713713f},
-std::array<float,2>{0.740175247f, 0.217311993f},
-std::array<float,2>{0.838246286f, 0.628760636f},
-std::array<float,2>{0.296932638f, 0.394242018f},
-std::array<float,2>{0.462380558f, 0.542135715f},
-std::array<float,2>{0.887656093f, 0.329997867f},
-std::array<float,2>{0.53288424f, 0.809884787f},
-std::array<float,2>{0.0340917557f, 0.0528974645f},
-std::array<float,2>{0.32206735f, 0.854310453f},
-std::array<float,2>{0.761729717f, 0.0917408913f},
-std::array<float,2>{0.629536092f, 0.61199981f},
-std::array<float,2>{0.248961911f, 0.279134125f},
-std::array<float,2>{0.0980704948f, 0.730604529f},
-std::array<float,2>{0.596575439f, 0.476406366f},
-std::array<float,2>{0.98061353f, 0.939612031f},
-std::array<float,2>{0.4111709f, 0.138404682f},
-std::array<float,2>{8.08393743e-05f, 0.770832658f},
-std::array<float,2>{0.508050561f, 0.00424214825f},
-std::array<float,2>{0.911287189f, 0.525828481f},
-std::array<float,2>{0.487354428f, 0.358319879f},
-std::array<float,2>{0.260916978f, 0.678622961f},
-std::array<float,2>{0.845081747f, 0.421544939f},
-std::array<float,2>{0.712053835f, 0.889918089f},
-std::array<float,2>{0.186970949f, 0.223994896f},
-std::array<float,2>{0.385257185f, 0.988270521f},
-std::array<float,2>{0.948034644f, 0.182795539f},
-std::array<float,2>{0.579885483f, 0.708292186f},
-std::array<float,2>{0.0734936073f, 0.465752482f},
-std::array<float,2>{0.207624242f, 0.593317211f},
-std::array<float,2>{0.669531882f, 0.30609417f},
-std::array<float,2>{0.794755459f, 0.833910644f},
-std::array<float,2>{0.352426171f, 0.102487907f},
-std::array<float,2>{0.21440959f, 0.764844596f},
-std::array<float,2>{0.658973157f, 0.0265484974f},
-std::array<float,2>{0.782791376f, 0.500433087f},
-std::array<float,2>{0.347616345f, 0.360600024f},
-std::array<float,2>{0.376392931f, 0.662902117f},
-std::array<float,2>{0.938938856f, 0.422787249f},
-std::array<float,2>{0.592968941f, 0.895254612f},
-std::array<float,2>{0.0674394444f, 0.237594977f},
-std::array<float,2>{0.252017796f, 0.970423818f},
-std::array<float,2>{0.858576f, 0.156446397f},
-std::array<float,2>{0.710309029f, 0.687853754f},
-std::array<float,2>{0.179589987f, 0.448919296f},
-std::array<float,2>{0.015220332f, 0.568896711f},
-std::array<float,2>{0.505455136f, 0.286719918f},
-std::array<float,2>{0.915373206f, 0.822576463f},
-std::array<float,2>{0.49767822f, 0.123918943f},
-std::array<float,2>{0.102896616f, 0.913750231f},
-std::array<float,2>{0.605217278f, 0.194947198f},
-std::array<float,2>{0.974522054f, 0.644287169f},
-std::array<float,2>{0.414775401f, 0.38492766f},
-std::array<float,2>{0.319263965f, 0.550920844f},
-std::array<float,2>{0.756318867f, 0.325686783f},
-std::array<float,2>{0.633480549f, 0.794599056f},
-std::array<float,2>{0.236604229f, 0.0373102799f},
-std::array<float,2>{0.458355069f, 0.866384566f},
-std::array<float,2>{0.87612462f, 0.0734262913f},
-std::array<float,2>{0.54053998f, 0.593893766f},
-std::array<float,2>{0.0410320796f, 0.252956271f},
-std::array<float,2>{0.154166266f, 0.745647371f},
-std::array<float,2>{0.746343076f, 0.489127636f},
-std::array<float,2>{0.835884333f, 0.961440086f},
-std::array<float,2>{0.308507025f, 0.15064016f},
-std::array<float,2>{0.166352019f, 0.943619668f},
-std::array<float,2>{0.688958466f, 0.133170113f},
-std::array<float,2>{0.870897532f, 0.72999984f},
-std::array<float,2>{0.269553483f, 0.471848547f},
-std::array<float,2>{0.477930099f, 0.615113437f},
-std::array<float,2>{0.926972926f, 0.273624271f},
-std::array<float,2>{0.52502346f, 0.858317018f},
-std::array<float,2>{0.0202005487f, 0.0872211978f},
-std::array<float,2>{0.372386694f, 0.807299137f},
-std::array<float,2>{0.811059594f, 0.0476505496f},
-std::array<float,2>{0.674433172f, 0.543584228f},
-std::array<float,2>{0.195906833f, 0.334303379f},
-std::array<float,2>{0.0934740901f, 0.632455111f},
-std::array<float,2>{0.572239637f, 0.394590646f},
-std::array<float,2>{0.955728054f, 0.934287608f},
-std::array<float,2>{0.400680393f, 0.211834699f},
-std::array<float,2>{0.0540323369f, 0.829848528f},
-std::array<float,2>{0.554591417f, 0.109073542f},
-std::array<float,2>{0.891198874f, 0.587646127f},
-std::array<float,2>{0.45276159f, 0.310784668f},
-std::array<float,2>{0.282519609f, 0.704306483f},
-std::array<float,2>{0.827074468f, 0.464628607f},
-std::array<float,2>{0.726597011f, 0.990287781f},
-std::array<float,2>{0.13560228f, 0.185764179f},
-std::array<float,2>{0.430130273f, 0.88536483f},
-std::array<float,2>{0.99387151f, 0.2207876f},
-std::array<float,2>{0.621881604f, 0.673619032f},
-std::array<float,2>{0.11939127f, 0.416063428f},
-std::array<float,2>{0.231422484f, 0.530675232f},
-std::array<float,2>{0.651923001f, 0.352206528f},
-std::array<float,2>{0.779408097f, 0.768848419f},
-std::array<float,2>{0.333899289f, 0.0032712135f},
-std::array<float,2>{0.130109265f, 0.847545028f},
-std::array<float,2>{0.719082892f, 0.0856119618f},
-std::array<float,2>{0.813373685f, 0.619231999f},
-std::array<float,2>{0.289406538f, 0.266119838f},
-std::array<float,2>{0.441034794f, 0.723307014f},
-std::array<float,2>{0.903671563f, 0.47836557f},
-std::array<float,2>{0.561585665f, 0.946960568f},
-std::array<float,2>{0.0548200756f, 0.125031456f},
-std::array<float,2>{0.341643214f, 0.926454663f},
-std::array<float,2>{0.768262506f, 0.207864597f},
-std::array<float,2>{0.646426737f, 0.635336876f},
-std::array<float,2>{0.223276749f, 0.405933589f},
-std::array<float,2>{0.116172448f, 0.531330168f},
-std::array<float,2>{0.613396943f, 0.338043898f},
-std::array<float,2>{0.988443494f, 0.79692328f},
-std::array<float,2>{0.426024914f, 0.0616538376f},
-std::array<float,2>{0.0308144707f, 0.997887731f},
-std::array<float,2>{0.515743077f, 0.172022671f},
-std::array<float,2>{0.936193705f, 0.714334428f},
-std::array<float,2>{0.476272523f, 0.460271984f},
-std::array<float,2>{0.276361048f, 0.585687578f},
-std::array<float,2>{0.862941921f, 0.297214806f},
-std::array<float,2>{0.701146007f, 0.842140734f},
-std::array<float,2>{0.157746911f, 0.094000347f},
-std::array<float,2>{0.397130251f, 0.780020833f},
-std::array<float,2>{0.966985881f, 0.0142110605f},
-std::array<float,2>{0.569930494f, 0.522492945f},
-std::array<float,2>{0.0843908638f, 0.350200355f},
-std::array<float,2>{0.192090809f, 0.681965888f},
-std::array<float,2>{0.679909468f, 0.410025746f},
-std::array<float,2>{0.804487944f, 0.875422359f},
-std::array<float,2>{0.366847217f, 0.233400434f},
-std::array<float,2>{0.244074494f, 0.90221715f},
-std::array<float,2>{0.626909435f, 0.243219227f},
-std::array<float,2>{0.761511266f, 0.666186273f},
-std::array<float,2>{0.325593144f, 0.431693882f},
-std::array<float,2>{0.410100132f, 0.512908995f},
-std::array<float,2>{0.978891611f, 0.373842716f},
-std::array<float,2>{0.599666417f, 0.751584649f},
-std::array<float,2>{0.0972807258f, 0.0162944999f},
-std::array<float,2>{0.303848892f, 0.814919174f},
-std::array<float,2>{0.841638565f, 0.11499884f},
-std::array<float,2>{0.73477149f, 0.571768522f},
-std::array<float,2>{0.14211987f, 0.292980552f},
-std::array<float,2>{0.0362766646f, 0.695693851f},
-std::array<float,2>{0.536893904f, 0.438279182f},
-std::array<float,2>{0.886595488f, 0.976731718f},
-std::array<float,2>{0.466426075f, 0.167855844f},
-std::array<float,2>{0.0764310881f, 0.782885969f},
-std::array<float,2>{0.584814847f, 0.041435115f},
-std::array<float,2>{0.949691594f, 0.555592239f},
-std::array<float,2>{0.389435619f, 0.317001373f},
-std::array<float,2>{0.358506888f, 0.654825747f},
-std::array<float,2>{0.792575836f, 0.376299858f},
-std::array<float,2>{0.666776597f, 0.919181526f},
-std::array<float,2>{0.205043897f, 0.201688692f},
-std::array<float,2>{0.488839597f, 0.956466496f},
-std::array<float,2>{0.908287227f, 0.145863891f},
-std::array<float,2>{0.512285173f, 0.735021293f},
-std::array<float,2>{0.00588370999f, 0.498813659f},
-std::array<float,2>{0.179932013f, 0.603357732f},
-std::array<float,2>{0.717101336f, 0.26240468f},
-std::array<float,2>{0.848728299f, 0.874337196f},
-std::array<float,2>{0.265580267f, 0.0679915547f},
-std::array<float,2>{0.151144475f, 0.774255872f},
-std::array<float,2>{0.744503915f, 0.0102397343f},
-std::array<float,2>{0.828563154f, 0.516346097f},
-std::array<float,2>{0.311558872f, 0.346271366f},
-std::array<float,2>{0.456908464f, 0.684343994f},
-std::array<float,2>{0.881114185f, 0.410471797f},
-std::array<float,2>{0.545260668f, 0.880802214f},
-std::array<float,2>{0.0437408686f, 0.230011821f},
-std::array<float,2>{0.31348139f, 0.993195772f},
-std::array<float,2>{0.750386238f, 0.176570892f},
-std::array<float,2>{0.639890194f, 0.716905415f},
-std::array<float,2>{0.240492523f, 0.453500569f},
-std::array<float,2>{0.108698495f, 0.581776798f},
-std::array<float,2>{0.607724488f, 0.303354114f},
-std::array<float,2>{0.972100139f, 0.838980615f},
-std::array<float,2>{0.419747442f, 0.0976586193f},
-std::array<float,2>{0.00800249726f, 0.925474763f},
-std::array<float,2>{0.501173854f, 0.206123635f},
-std::array<float,2>{0.920837581f, 0.640210807f},
-std::array<float,2>{0.49509111f, 0.399055809f},
-std::array<float,2>{0.254662216f, 0.537100255f},
-std::array<float,2>{0.851661682f, 0.343027532f},
-std::array<float,2>{0.706553042f, 0.801933408f},
-std::array<float,2>{0.175769448f, 0.0584904738f},
-std::array<float,2>{0.379056782f, 0.848337591f},
-std::array<float,2>{0.942678869f, 0.0787422881f},
-std::array<float,2>{0.585953295f, 0.622182667f},
-std::array<float,2>{0.0634335876f, 0.271499842f},
-std::array<float,2>{0.216041744f, 0.721813738f},
-std::array<float,2>{0.662277222f, 0.481124997f},
-std::array<float,2>{0.78537339f, 0.951393247f},
-std::array<float,2>{0.350186378f, 0.129948571f},
-std::array<float,2>{0.22864984f, 0.957728863f},
-std::array<float,2>{0.653632164f, 0.143055573f},
-std::array<float,2>{0.774554193f, 0.739981055f},
-std::array<float,2>{0.330455005f, 0.495284677f},
-std::array<float,2>{0.434925705f, 0.6064412f},
-std::array<float,2>{0.999917865f, 0.260446995f},
-std::array<float,2>{0.618050933f, 0.869107783f},
-std::array<float,2>{0.12446887f, 0.0659932718f},
-std::array<float,2>{0.287182093f, 0.785673976f},
-std::array<float,2>{0.8216995f, 0.0457562394f},
-std::array<float,2>{0.732010782f, 0.55919522f},
-std::array<float,2>{0.138118163f, 0.312668532f},
-std::array<float,2>{0.0497867987f, 0.650533199f},
-std::array<float,2>{0.54893738f, 0.379665226f},
-std::array<float,2>{0.898158789f, 0.916889787f},
-std::array<float,2>{0.447170973f, 0.197847635f},
-std::array<float,2>{0.0867934078f, 0.818270743f},
-std::array<float,2>{0.576485634f, 0.110171765f},
-std::array<float,2>{0.957586586f, 0.576593518f},
-std::array<float,2>{0.404878855f, 0.291136652f},
-std::array<float,2>{0.368304104f, 0.700392962f},
-std::array<float,2>{0.806205094f, 0.442506671f},
-std::array<float,2>{0.676249146f, 0.984261811f},
-std::array<float,2>{0.202448726f, 0.171051264f},
-std::array<float,2>{0.480715215f, 0.903761744f},
-std::array<float,2>{0.925147295f, 0.249667034f},
-std::array<float,2>{0.53101331f, 0.668922246f},
-std::array<float,2>{0.0189192984f, 0.433921486f},
-std::array<float,2>{0.168807045f, 0.507962465f},
-std::array<float,2>{0.693652809f, 0.367371529f},
-std::array<float,2>{0.871243238f, 0.757803977f},
-std::array<float,2>{0.265851676f, 0.0212569628f},
-std::array<float,2>{0.187823161f, 0.861198902f},
-std::array<float,2>{0.68621093f, 0.0767929107f},
-std::array<float,2>{0.797827542f, 0.598853707f},
-std::array<float,2>{0.360608459f, 0.25418812f},
-std::array<float,2>{0.391578853f, 0.746501207f},
-std::array<float,2>{0.961707413f, 0.487992406f},
-std::array<float,2>{0.564158618f, 0.965916753f},
-std::array<float,2>{0.0792512f, 0.154978648f},
-std::array<float,2>{0.280945182f, 0.910153449f},
-std::array<float,2>{0.864416122f, 0.189188898f},
-std::array<float,2>{0.697984576f, 0.647158444f},
-std::array<float,2>{0.163973853f, 0.389351904f},
-std::array<float,2>{0.0245704651f, 0.550389826f},
-std::array<float,2>{0.522558093f, 0.320523202f},
-std::array<float,2>{0.932841361f, 0.790149629f},
-std::array<float,2>{0.47139287f, 0.0335773081f},
-std::array<float,2>{0.111154921f, 0.976057231f},
-std::array<float,2>{0.612682521f, 0.163975954f},
-std::array<float,2>{0.986934543f, 0.693392336f},
-std::array<float,2>{0.422803193f, 0.450328737f},
-std::array<float,2>{0.337902039f, 0.563955545f},
-std::array<float,2>{0.772818089f, 0.283081174f},
-std::array<float,2>{0.641026139f, 0.826135814f},
-std::array<float,2>{0.219949007f, 0.117521591f},
-std::array<float,2>{0.444960296f, 0.760299325f},
-std::array<float,2>{0.900646985f, 0.0306670759f},
-std::array<float,2>{0.556462288f, 0.507380366f},
-std::array<float,2>{0.0599965304f, 0.366213799f},
-std::array<float,2>{0.128906146f, 0.659287989f},
-std::array<float,2>{0.72396189f, 0.426397771f},
-std::array<float,2>{0.816436946f, 0.894393206f},
-std::array<float,2>{0.296820164f, 0.240358621f},
-std::array<float,2>{0.184250921f, 0.886865556f},
-std::array<float,2>{0.713714302f, 0.226001501f},
-std::array<float,2>{0.84616214f, 0.677692711f},
-std::array<float,2>{0.259420067f, 0.41906774f},
-std::array<float,2>{0.484945238f, 0.523764551f},
-std::array<float,2>{0.912807763f, 0.3556104f},
-std::array<float,2>{0.510484099f, 0.771518469f},
-std::array<float,2>{0.00370408129f, 0.00678534387f},
-std::array<float,2>{0.35371691f, 0.835645258f},
-std::array<float,2>{0.796451449f, 0.104064465f},
-std::array<float,2>{0.671836138f, 0.591684103f},
-std::array<float,2>{0.210389376f, 0.308369726f},
-std::array<float,2>{0.0706582889f, 0.708985269f},
-std::array<float,2>{0.581193089f, 0.468252391f},
-std::array<float,2>{0.945823967f, 0.985872865f},
-std::array<float,2>{0.383143663f, 0.180992186f},
-std::array<float,2>{0.033110939f, 0.81179744f},
-std::array<float,2>{0.534863889f, 0.0508974269f},
-std::array<float,2>{0.889207721f, 0.539122999f},
-std::array<float,2>{0.464294881f, 0.331794888f},
-std::array<float,2>{0.300644159f, 0.626767635f},
-std::array<float,2>{0.837532222f, 0.39245683f},
-std::array<float,2>{0.740435302f, 0.932078481f},
-std::array<float,2>{0.14741452f, 0.215588078f},
-std::array<float,2>{0.413407296f, 0.939333498f},
-std::array<float,2>{0.983204722f, 0.140263081f},
-std::array<float,2>{0.594219565f, 0.732572079f},
-std::array<float,2>{0.100999869f, 0.473908216f},
-std::array<float,2>{0.246840969f, 0.610914171f},
-std::array<float,2>{0.631063879f, 0.280263335f},
-std::array<float,2>{0.76442802f, 0.853299856f},
-std::array<float,2>{0.323161393f, 0.0921086445f},
-std::array<float,2>{0.235995814f, 0.796003878f},
-std::array<float,2>{0.636091888f, 0.0370904617f},
-std::array<float,2>{0.754479468f, 0.554573178f},
-std::array<float,2>{0.318323582f, 0.326253653f},
-std::array<float,2>{0.417565048f, 0.642249763f},
-std::array<float,2>{0.974867702f, 0.384520262f},
-std::array<float,2>{0.603215277f, 0.911299825f},
-std::array<float,2>{0.104689918f, 0.193150103f},
-std::array<float,2>{0.305581629f, 0.963635266f},
-std::array<float,2>{0.832994819f, 0.149435565f},
-std::array<float,2>{0.749616683f, 0.743580461f},
-std::array<float,2>{0.154822588f, 0.490358829f},
-std::array<float,2>{0.0406621732f, 0.597149849f},
-std::array<float,2>{0.541375518f, 0.251272827f},
-std::array<float,2>{0.8769539f, 0.864581704f},
-std::array<float,2>{0.460447788f, 0.070488207f},
-std::array<float,2>{0.0700044334f, 0.897940397f},
-std::array<float,2>{0.590656698f, 0.236203969f},
-std::array<float,2>{0.940083504f, 0.660184801f},
-std::array<float,2>{0.378138691f, 0.424616754f},
-std::array<float,2>{0.345580339f, 0.502770126f},
-std::array<float,2>{0.784744442f, 0.362545907f},
-std::array<float,2>{0.656596363f, 0.762655616f},
-std::array<float,2>{0.212129802f, 0.0252691992f},
-std::array<float,2>{0.499947041f, 0.822207868f},
-std::array<float,2>{0.916366398f, 0.12237858f},
-std::array<float,2>{0.506873071f, 0.56691879f},
-std::array<float,2>{0.0118962238f, 0.287690014f},
-std::array<float,2>{0.175825506f, 0.689528167f},
-std::array<float,2>{0.707730532f, 0.446206391f},
-std::array<float,2>{0.857025445f, 0.970984042f},
-std::array<float,2>{0.251416564f, 0.158982426f},
-std::array<float,2>{0.133036494f, 0.98947531f},
-std::array<float,2>{0.730037689f, 0.18517679f},
-std::array<float,2>{0.824322164f, 0.705375493f},
-std::array<float,2>{0.283487082f, 0.461494535f},
-std::array<float,2>{0.449316621f, 0.589035988f},
-std::array<float,2>{0.893878162f, 0.308983684f},
-std::array<float,2>{0.552061081f, 0.831727862f},
-std::array<float,2>{0.0521993302f, 0.105704032f},
-std::array<float,2>{0.334088713f, 0.766685128f},
-std::array<float,2>{0.778685451f, 0.000661682978f},
-std::array<float,2>{0.648797095f, 0.528971791f},
-std::array<float,2>{0.232758582f, 0.354266465f},
-std::array<float,2>{0.117305093f, 0.675150931f},
-std::array<float,2>{0.623365819f, 0.415603012f},
-std::array<float,2>{0.994724095f, 0.884555817f},
-std::array<float,2>{0.433069825f, 0.21884653f},
-std::array<float,2>{0.0217833146f, 0.856023431f},
-std::array<float,2>{0.526253998f, 0.0888100117f},
-std::array<float,2>{0.927930713f, 0.615532935f},
-std::array<float,2>{0.479181886f, 0.276573002f},
-std::array<float,2>{0.271948934f, 0.72763741f},
-std::array<float,2>{0.868361652f, 0.469550818f},
-std::array<float,2>{0.690273345f, 0.942593157f},
-std::array<float,2>{0.165918261f, 0.135013089f},
-std::array<float,2>{0.398452222f, 0.937220633f},
-std::array<float,2>{0.954865098f, 0.214633897f},
-std::array<float,2>{0.572410107f, 0.629679918f},
-std::array<float,2>{0.0911314115f, 0.396742493f},
-std::array<float,2>{0.198795393f, 0.545722485f},
-std::array<float,2>{0.672225058f, 0.333015054f},
-std::array<float,2>{0.810172081f, 0.806427062f},
-std::array<float,2>{0.373507291f, 0.0489357673f},
-std::array<float,2>{0.15926227f, 0.841126025f},
-std::array<float,2>{0.702289641f, 0.0959327146f},
-std::array<float,2>{0.860645413f, 0.583860278f},
-std::array<float,2>{0.275302082f, 0.299119085f},
-std::array<float,2>{0.474530578f, 0.712096155f},
-std::array<float,2>{0.934630334f, 0.458569616f},
-std::array<float,2>{0.517895579f, 0.999881387f},
-std::array<float,2>{0.0279050879f, 0.174522594f},
-std::array<float,2>{0.363631696f, 0.87714082f},
-std::array<float,2>{0.802023768f, 0.230572164f},
-std::array<float,2>{0.68321234f, 0.680044472f},
-std::array<float,2>{0.195037141f, 0.407139778f},
-std::array<float,2>{0.0823624134f, 0.520876646f},
-std::array<float,2>{0.568024695f, 0.347780049f},
-std::array<float,2>{0.966429412f, 0.778815746f},
-std::array<float,2>{0.396057993f, 0.0126567408f},
-std::array<float,2>{0.057206966f, 0.94805479f},
-std::array<float,2>{0.56007576f, 0.128733158f},
-std::array<float,2>{0.906182408f, 0.725236833f},
-std::array<float,2>{0.439450741f, 0.480102599f},
-std::array<float,2>{0.291280419f, 0.617494524f},
-std::array<float,2>{0.816387415f, 0.268327773f},
-std::array<float,2>{0.721604109f, 0.844254434f},
-std::array<float,2>{0.13257134f, 0.0825602412f},
-std::array<float,2>{0.428662688f, 0.800043762f},
-std::array<float,2>{0.990853071f, 0.0596295819f},
-std::array<float,2>{0.615997076f, 0.534764111f},
-std::array<float,2>{0.114375375f, 0.337156683f},
-std::array<float,2>{0.225781098f, 0.632902801f},
-std::array<float,2>{0.647525549f, 0.40320757f},
-std::array<float,2>{0.767434537f, 0.929503262f},
-std::array<float,2>{0.343263984f, 0.210781232f},
-std::array<float,2>{0.207030624f, 0.920022428f},
-std::array<float,2>{0.665019274f, 0.1999681f},
-std::array<float,2>{0.790413737f, 0.652836859f},
-std::array<float,2>{0.35730207f, 0.377293319f},
-std::array<float,2>{0.388265848f, 0.557564855f},
-std::array<float,2>{0.952820122f, 0.31855303f},
-std::array<float,2>{0.583460391f, 0.784713328f},
-std::array<float,2>{0.0755021274f, 0.0399133563f},
-std::array<float,2>{0.263312042f, 0.872709274f},
-std::array<float,2>{0.850595117f, 0.0692796186f},
-std::array<float,2>{0.714895785f, 0.604688406f},
-std::array<float,2>{0.183184341f, 0.26378262f},
-std::array<float,2>{0.00399151025f, 0.736548662f},
-std::array<float,2>{0.515144944f, 0.496879995f},
-std::array<float,2>{0.907417715f, 0.954476774f},
-std::array<float,2>{0.490891159f, 0.148288727f},
-std::array<float,2>{0.0939427838f, 0.752671063f},
-std::array<float,2>{0.599254429f, 0.0179647896f},
-std::array<float,2>{0.97798425f, 0.514674664f},
-std::array<float,2>{0.406952173f, 0.372365862f},
-std::array<float,2>{0.327201664f, 0.664697945f},
-std::array<float,2>{0.758583426f, 0.431071192f},
-std::array<float,2>{0.627885401f, 0.899439752f},
-std::array<float,2>{0.245897844f, 0.245673999f},
-std::array<float,2>{0.467918187f, 0.978694677f},
-std::array<float,2>{0.883672833f, 0.165933028f},
-std::array<float,2>{0.537386537f, 0.698110104f},
-std::array<float,2>{0.0385388471f, 0.440094799f},
-std::array<float,2>{0.144481778f, 0.573857963f},
-std::array<float,2>{0.737354279f, 0.295435965f},
-std::array<float,2>{0.843189418f, 0.812530935f},
-std::array<float,2>{0.301158875f, 0.116839945f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.923565865f, 0.86565429f},
-std::array<float,2>{0.062399175f, 0.140370145f},
-std::array<float,2>{0.403898716f, 0.549891055f},
-std::array<float,2>{0.554180741f, 0.407222778f},
-std::array<float,2>{0.659938097f, 0.69112891f},
-std::array<float,2>{0.313359708f, 0.259017974f},
-std::array<float,2>{0.203820676f, 0.930355787f},
-std::array<float,2>{0.779442012f, 0.0179217067f},
-std::array<float,2>{0.836544096f, 0.605002761f},
-std::array<float,2>{0.136041403f, 0.495378256f},
-std::array<float,2>{0.270574421f, 0.764206111f},
-std::array<float,2>{0.728318989f, 0.188189715f},
-std::array<float,2>{0.592636704f, 0.970345199f},
-std::array<float,2>{0.444806904f, 0.108632587f},
-std::array<float,2>{0.112134486f, 0.650271237f},
-std::array<float,2>{0.976855874f, 0.364175946f},
-std::array<float,2>{0.790521502f, 0.896653771f},
-std::array<float,2>{0.231199518f, 0.0369396694f},
-std::array<float,2>{0.361421317f, 0.721795082f},
-std::array<float,2>{0.650486588f, 0.306527734f},
-std::array<float,2>{0.512847185f, 0.51736486f},
-std::array<float,2>{0.416426063f, 0.382245988f},
-std::array<float,2>{0.0188708548f, 0.828664184f},
-std::array<float,2>{0.902154028f, 0.175679833f},
-std::array<float,2>{0.958344936f, 0.68397963f},
-std::array<float,2>{0.0734600723f, 0.326489151f},
-std::array<float,2>{0.482558519f, 0.953021705f},
-std::array<float,2>{0.616449833f, 0.0698255301f},
-std::array<float,2>{0.717939258f, 0.781688988f},
-std::array<float,2>{0.311292738f, 0.222928479f},
-std::array<float,2>{0.168789223f, 0.564881682f},
-std::array<float,2>{0.846015513f, 0.450691611f},
-std::array<float,2>{0.87410903f, 0.770121098f},
-std::array<float,2>{0.180514634f, 0.2155637f},
-std::array<float,2>{0.29216668f, 0.609393775f},
-std::array<float,2>{0.697038412f, 0.472168148f},
-std::array<float,2>{0.595923364f, 0.632884622f},
-std::array<float,2>{0.485461861f, 0.352871925f},
-std::array<float,2>{0.0823993906f, 0.991104901f},
-std::array<float,2>{0.942085028f, 0.112352148f},
-std::array<float,2>{0.87636137f, 0.532058716f},
-std::array<float,2>{0.000471480686f, 0.436602712f},
-std::array<float,2>{0.423589587f, 0.844164073f},
-std::array<float,2>{0.519683182f, 0.144728482f},
-std::array<float,2>{0.625300348f, 0.912888467f},
-std::array<float,2>{0.358379722f, 0.0113277128f},
-std::array<float,2>{0.245252788f, 0.713724792f},
-std::array<float,2>{0.799143672f, 0.270070016f},
-std::array<float,2>{0.997300327f, 0.960563481f},
-std::array<float,2>{0.103230402f, 0.0787632242f},
-std::array<float,2>{0.462018341f, 0.660680771f},
-std::array<float,2>{0.563109219f, 0.339517385f},
-std::array<float,2>{0.73936367f, 0.586413205f},
-std::array<float,2>{0.2652044f, 0.460043162f},
-std::array<float,2>{0.152012572f, 0.809862912f},
-std::array<float,2>{0.813869298f, 0.236332074f},
-std::array<float,2>{0.75614351f, 0.735415399f},
-std::array<float,2>{0.188290656f, 0.284882784f},
-std::array<float,2>{0.336098492f, 0.885768056f},
-std::array<float,2>{0.672962904f, 0.0624959432f},
-std::array<float,2>{0.536465108f, 0.821679056f},
-std::array<float,2>{0.375768572f, 0.161766276f},
-std::array<float,2>{0.033931803f, 0.500725031f},
-std::array<float,2>{0.910369933f, 0.399354875f},
-std::array<float,2>{0.952173829f, 0.802851856f},
-std::array<float,2>{0.0888670981f, 0.249209553f},
-std::array<float,2>{0.49965325f, 0.581527829f},
-std::array<float,2>{0.601829827f, 0.461062074f},
-std::array<float,2>{0.689606667f, 0.66778928f},
-std::array<float,2>{0.282665521f, 0.332538694f},
-std::array<float,2>{0.177161425f, 0.963935494f},
-std::array<float,2>{0.86260134f, 0.0932420045f},
-std::array<float,2>{0.811141133f, 0.510059714f},
-std::array<float,2>{0.238987282f, 0.393687695f},
-std::array<float,2>{0.350022584f, 0.817384779f},
-std::array<float,2>{0.634882152f, 0.168518424f},
-std::array<float,2>{0.530250549f, 0.881208062f},
-std::array<float,2>{0.435560554f, 0.0539329462f},
-std::array<float,2>{0.0091638118f, 0.747729421f},
-std::array<float,2>{0.888524473f, 0.289883465f},
-std::array<float,2>{0.826278329f, 0.99983263f},
-std::array<float,2>{0.141386017f, 0.123379365f},
-std::array<float,2>{0.255254209f, 0.628117383f},
-std::array<float,2>{0.742429316f, 0.348559052f},
-std::array<float,2>{0.57504046f, 0.624743998f},
-std::array<float,2>{0.45887962f, 0.481490165f},
-std::array<float,2>{0.0993612707f, 0.780201852f},
-std::array<float,2>{0.992148519f, 0.209068283f},
-std::array<float,2>{0.916947067f, 0.709777415f},
-std::array<float,2>{0.0414712764f, 0.27836287f},
-std::array<float,2>{0.387129813f, 0.921727896f},
-std::array<float,2>{0.542571723f, 0.00161796936f},
-std::array<float,2>{0.684164166f, 0.857141554f},
-std::array<float,2>{0.331393749f, 0.14876613f},
-std::array<float,2>{0.196452811f, 0.541808903f},
-std::array<float,2>{0.75861299f, 0.424952269f},
-std::array<float,2>{0.772908509f, 0.836485922f},
-std::array<float,2>{0.211413041f, 0.18113108f},
-std::array<float,2>{0.323187649f, 0.531140387f},
-std::array<float,2>{0.66745317f, 0.389434725f},
-std::array<float,2>{0.562105179f, 0.732470274f},
-std::array<float,2>{0.394835174f, 0.297243685f},
-std::array<float,2>{0.0518450662f, 0.89930743f},
-std::array<float,2>{0.936288953f, 0.0439052656f},
-std::array<float,2>{0.972195327f, 0.575819016f},
-std::array<float,2>{0.119072132f, 0.440925628f},
-std::array<float,2>{0.452138573f, 0.791857898f},
-std::array<float,2>{0.580585063f, 0.230492771f},
-std::array<float,2>{0.726217985f, 0.943012178f},
-std::array<float,2>{0.279442221f, 0.0773118362f},
-std::array<float,2>{0.128413334f, 0.673775852f},
-std::array<float,2>{0.835056007f, 0.319826722f},
-std::array<float,2>{0.891467214f, 0.926518559f},
-std::array<float,2>{0.0300664194f, 0.0245447829f},
-std::array<float,2>{0.410762757f, 0.697674572f},
-std::array<float,2>{0.506385624f, 0.255112082f},
-std::array<float,2>{0.642407596f, 0.561660469f},
-std::array<float,2>{0.372390062f, 0.42154035f},
-std::array<float,2>{0.224756673f, 0.872190237f},
-std::array<float,2>{0.787346721f, 0.125204533f},
-std::array<float,2>{0.858241498f, 0.644665003f},
-std::array<float,2>{0.162635729f, 0.374773324f},
-std::array<float,2>{0.300868899f, 0.981261849f},
-std::array<float,2>{0.709624231f, 0.0969755948f},
-std::array<float,2>{0.621002376f, 0.755678833f},
-std::array<float,2>{0.46995753f, 0.196595013f},
-std::array<float,2>{0.0631200373f, 0.599420547f},
-std::array<float,2>{0.964959264f, 0.486597985f},
-std::array<float,2>{0.983814538f, 0.815283716f},
-std::array<float,2>{0.115116939f, 0.167301223f},
-std::array<float,2>{0.44004643f, 0.512677729f},
-std::array<float,2>{0.588836789f, 0.396077335f},
-std::array<float,2>{0.731696188f, 0.74265635f},
-std::array<float,2>{0.269435376f, 0.296494871f},
-std::array<float,2>{0.139310583f, 0.876169682f},
-std::array<float,2>{0.843056381f, 0.0469035916f},
-std::array<float,2>{0.774999857f, 0.583756566f},
-std::array<float,2>{0.209785521f, 0.46636641f},
-std::array<float,2>{0.317579567f, 0.797605753f},
-std::array<float,2>{0.660689116f, 0.245207384f},
-std::array<float,2>{0.547436595f, 0.968561172f},
-std::array<float,2>{0.400968611f, 0.089286603f},
-std::array<float,2>{0.0550026f, 0.671277344f},
-std::array<float,2>{0.929008782f, 0.329386979f},
-std::array<float,2>{0.848206162f, 0.916813374f},
-std::array<float,2>{0.167033225f, 0.00466397591f},
-std::array<float,2>{0.308472633f, 0.705262184f},
-std::array<float,2>{0.714008093f, 0.27572152f},
-std::array<float,2>{0.613045752f, 0.543795288f},
-std::array<float,2>{0.480334193f, 0.426490396f},
-std::array<float,2>{0.0742746666f, 0.852691472f},
-std::array<float,2>{0.956402481f, 0.153131261f},
-std::array<float,2>{0.90452677f, 0.632653773f},
-std::array<float,2>{0.0224695746f, 0.346847296f},
-std::array<float,2>{0.418971658f, 0.993751168f},
-std::array<float,2>{0.508405507f, 0.117363289f},
-std::array<float,2>{0.655369937f, 0.774457991f},
-std::array<float,2>{0.365806788f, 0.203472227f},
-std::array<float,2>{0.228605777f, 0.618800282f},
-std::array<float,2>{0.794588983f, 0.477852523f},
-std::array<float,2>{0.802445531f, 0.793292761f},
-std::array<float,2>{0.249604821f, 0.227253854f},
-std::array<float,2>{0.355404556f, 0.572181582f},
-std::array<float,2>{0.63267529f, 0.443752855f},
-std::array<float,2>{0.517174542f, 0.676624477f},
-std::array<float,2>{0.427708924f, 0.313692033f},
-std::array<float,2>{0.00778346742f, 0.939829946f},
-std::array<float,2>{0.881993055f, 0.0718300119f},
-std::array<float,2>{0.939809144f, 0.526402652f},
-std::array<float,2>{0.0818977132f, 0.383841008f},
-std::array<float,2>{0.490774393f, 0.842911422f},
-std::array<float,2>{0.598174989f, 0.18739453f},
-std::array<float,2>{0.699384868f, 0.904609025f},
-std::array<float,2>{0.293980122f, 0.0413277894f},
-std::array<float,2>{0.186713174f, 0.727111995f},
-std::array<float,2>{0.869094729f, 0.301013052f},
-std::array<float,2>{0.907814443f, 0.980459452f},
-std::array<float,2>{0.0354328901f, 0.100402258f},
-std::array<float,2>{0.382424384f, 0.643724799f},
-std::array<float,2>{0.532006919f, 0.370540142f},
-std::array<float,2>{0.679546952f, 0.593963146f},
-std::array<float,2>{0.341933936f, 0.49117887f},
-std::array<float,2>{0.19529441f, 0.753688276f},
-std::array<float,2>{0.751553476f, 0.199617282f},
-std::array<float,2>{0.81679827f, 0.699916422f},
-std::array<float,2>{0.155853629f, 0.250212312f},
-std::array<float,2>{0.260167748f, 0.922305107f},
-std::array<float,2>{0.736294866f, 0.0310806185f},
-std::array<float,2>{0.570135653f, 0.868934929f},
-std::array<float,2>{0.466620088f, 0.131007165f},
-std::array<float,2>{0.108181953f, 0.557884157f},
-std::array<float,2>{0.994961143f, 0.417344242f},
-std::array<float,2>{0.884828985f, 0.760148108f},
-std::array<float,2>{0.0128882183f, 0.192618161f},
-std::array<float,2>{0.431696653f, 0.608588517f},
-std::array<float,2>{0.527327716f, 0.4989748f},
-std::array<float,2>{0.639772654f, 0.65258795f},
-std::array<float,2>{0.345932513f, 0.360621363f},
-std::array<float,2>{0.235666171f, 0.973454058f},
-std::array<float,2>{0.806463063f, 0.104317285f},
-std::array<float,2>{0.865228891f, 0.554642558f},
-std::array<float,2>{0.175331131f, 0.410469532f},
-std::array<float,2>{0.286131322f, 0.859387219f},
-std::array<float,2>{0.694711208f, 0.135379717f},
-std::array<float,2>{0.6071527f, 0.93609345f},
-std::array<float,2>{0.494401634f, 0.0201306734f},
-std::array<float,2>{0.0908607543f, 0.69214344f},
-std::array<float,2>{0.947627127f, 0.262447923f},
-std::array<float,2>{0.763139367f, 0.948695838f},
-std::array<float,2>{0.201049551f, 0.0628312081f},
-std::array<float,2>{0.334431559f, 0.681529224f},
-std::array<float,2>{0.681485057f, 0.321837425f},
-std::array<float,2>{0.543713629f, 0.567972779f},
-std::array<float,2>{0.38576737f, 0.448717386f},
-std::array<float,2>{0.045232866f, 0.788621008f},
-std::array<float,2>{0.917970121f, 0.219778702f},
-std::array<float,2>{0.988017023f, 0.723016322f},
-std::array<float,2>{0.0972687751f, 0.312104106f},
-std::array<float,2>{0.454336703f, 0.893114269f},
-std::array<float,2>{0.572318733f, 0.0338818058f},
-std::array<float,2>{0.747127116f, 0.833010852f},
-std::array<float,2>{0.251790047f, 0.179073349f},
-std::array<float,2>{0.14838396f, 0.520354271f},
-std::array<float,2>{0.821832359f, 0.377610952f},
-std::array<float,2>{0.831541836f, 0.851505458f},
-std::array<float,2>{0.128950313f, 0.141088381f},
-std::array<float,2>{0.276202828f, 0.536569834f},
-std::array<float,2>{0.722331226f, 0.43285656f},
-std::array<float,2>{0.582559228f, 0.715293825f},
-std::array<float,2>{0.44654122f, 0.266072989f},
-std::array<float,2>{0.12427254f, 0.908295929f},
-std::array<float,2>{0.97584486f, 0.0139607396f},
-std::array<float,2>{0.930133998f, 0.61358434f},
-std::array<float,2>{0.0506413542f, 0.476154894f},
-std::array<float,2>{0.390940547f, 0.767265916f},
-std::array<float,2>{0.555585325f, 0.212355345f},
-std::array<float,2>{0.670802772f, 0.987212479f},
-std::array<float,2>{0.326538563f, 0.117113166f},
-std::array<float,2>{0.216157272f, 0.638263702f},
-std::array<float,2>{0.769201696f, 0.358224273f},
-std::array<float,2>{0.964733362f, 0.890114188f},
-std::array<float,2>{0.0691092461f, 0.0547388084f},
-std::array<float,2>{0.475304663f, 0.740497231f},
-std::array<float,2>{0.622517765f, 0.285591871f},
-std::array<float,2>{0.704077542f, 0.505954862f},
-std::array<float,2>{0.297768831f, 0.402609587f},
-std::array<float,2>{0.159682661f, 0.827241063f},
-std::array<float,2>{0.853710592f, 0.16002652f},
-std::array<float,2>{0.783764541f, 0.659667611f},
-std::array<float,2>{0.220951006f, 0.340733528f},
-std::array<float,2>{0.370036155f, 0.953214169f},
-std::array<float,2>{0.645043254f, 0.0821799189f},
-std::array<float,2>{0.500730455f, 0.808421493f},
-std::array<float,2>{0.407321483f, 0.240977451f},
-std::array<float,2>{0.0239680782f, 0.591984689f},
-std::array<float,2>{0.895446479f, 0.454696685f},
-std::array<float,2>{0.89948386f, 0.83120954f},
-std::array<float,2>{0.016403595f, 0.172136232f},
-std::array<float,2>{0.414634943f, 0.519082189f},
-std::array<float,2>{0.515377283f, 0.380699664f},
-std::array<float,2>{0.649234593f, 0.720288932f},
-std::array<float,2>{0.360034227f, 0.306708664f},
-std::array<float,2>{0.232800692f, 0.896355689f},
-std::array<float,2>{0.791750789f, 0.038345132f},
-std::array<float,2>{0.844797909f, 0.563773453f},
-std::array<float,2>{0.170747086f, 0.452118754f},
-std::array<float,2>{0.30887267f, 0.783648849f},
-std::array<float,2>{0.716144681f, 0.224777207f},
-std::array<float,2>{0.613882303f, 0.950002611f},
-std::array<float,2>{0.481590003f, 0.0668003634f},
-std::array<float,2>{0.0704589188f, 0.685911119f},
-std::array<float,2>{0.959564984f, 0.324598372f},
-std::array<float,2>{0.779214978f, 0.931854069f},
-std::array<float,2>{0.205295533f, 0.0170942862f},
-std::array<float,2>{0.315180749f, 0.688096285f},
-std::array<float,2>{0.657916307f, 0.26090762f},
-std::array<float,2>{0.552689135f, 0.547811329f},
-std::array<float,2>{0.404533714f, 0.408917218f},
-std::array<float,2>{0.0602816045f, 0.864338875f},
-std::array<float,2>{0.924082756f, 0.138192758f},
-std::array<float,2>{0.979258299f, 0.651618659f},
-std::array<float,2>{0.109910421f, 0.366644353f},
-std::array<float,2>{0.442102939f, 0.971295238f},
-std::array<float,2>{0.59132117f, 0.105772026f},
-std::array<float,2>{0.730015874f, 0.763218105f},
-std::array<float,2>{0.272385806f, 0.190854743f},
-std::array<float,2>{0.133045003f, 0.602107227f},
-std::array<float,2>{0.839229941f, 0.492545009f},
-std::array<float,2>{0.815473139f, 0.811395943f},
-std::array<float,2>{0.148629487f, 0.235261276f},
-std::array<float,2>{0.263630986f, 0.589725077f},
-std::array<float,2>{0.740377247f, 0.457997471f},
-std::array<float,2>{0.565101445f, 0.662985861f},
-std::array<float,2>{0.464605331f, 0.336574644f},
-std::array<float,2>{0.104363464f, 0.958436191f},
-std::array<float,2>{0.998248219f, 0.0806655884f},
-std::array<float,2>{0.913121343f, 0.503183603f},
-std::array<float,2>{0.0318633728f, 0.400709599f},
-std::array<float,2>{0.378325254f, 0.823684037f},
-std::array<float,2>{0.537232399f, 0.162592694f},
-std::array<float,2>{0.675643861f, 0.884052753f},
-std::array<float,2>{0.339151889f, 0.0594972298f},
-std::array<float,2>{0.190640286f, 0.737403631f},
-std::array<float,2>{0.753965676f, 0.28134504f},
-std::array<float,2>{0.943906248f, 0.988370657f},
-std::array<float,2>{0.0844626427f, 0.110125333f},
-std::array<float,2>{0.486537665f, 0.634864092f},
-std::array<float,2>{0.594778836f, 0.353818685f},
-std::array<float,2>{0.697288275f, 0.6115399f},
-std::array<float,2>{0.290397733f, 0.470334381f},
-std::array<float,2>{0.181804657f, 0.772337973f},
-std::array<float,2>{0.872321665f, 0.217901573f},
-std::array<float,2>{0.798576057f, 0.711515188f},
-std::array<float,2>{0.243286505f, 0.27304557f},
-std::array<float,2>{0.355704755f, 0.911780357f},
-std::array<float,2>{0.627467811f, 0.00814248342f},
-std::array<float,2>{0.521647573f, 0.845731318f},
-std::array<float,2>{0.424041092f, 0.147227257f},
-std::array<float,2>{0.00286488491f, 0.533608377f},
-std::array<float,2>{0.877871335f, 0.434290588f},
-std::array<float,2>{0.988506258f, 0.778769553f},
-std::array<float,2>{0.101485103f, 0.207832173f},
-std::array<float,2>{0.459020019f, 0.622386038f},
-std::array<float,2>{0.577420175f, 0.482710451f},
-std::array<float,2>{0.745830715f, 0.62587148f},
-std::array<float,2>{0.256818742f, 0.350211769f},
-std::array<float,2>{0.143486783f, 0.99718076f},
-std::array<float,2>{0.82494539f, 0.1215536f},
-std::array<float,2>{0.760056973f, 0.540714145f},
-std::array<float,2>{0.198844805f, 0.423534483f},
-std::array<float,2>{0.329538047f, 0.858327746f},
-std::array<float,2>{0.685722172f, 0.152139992f},
-std::array<float,2>{0.540615737f, 0.919161022f},
-std::array<float,2>{0.389158458f, 0.00386837707f},
-std::array<float,2>{0.0407151692f, 0.708081365f},
-std::array<float,2>{0.915630043f, 0.281036049f},
-std::array<float,2>{0.861007392f, 0.961914182f},
-std::array<float,2>{0.179604352f, 0.0900473446f},
-std::array<float,2>{0.285096735f, 0.664214969f},
-std::array<float,2>{0.687829852f, 0.335510135f},
-std::array<float,2>{0.603718579f, 0.579834819f},
-std::array<float,2>{0.496875674f, 0.463339329f},
-std::array<float,2>{0.0876522064f, 0.80134666f},
-std::array<float,2>{0.950582325f, 0.246196702f},
-std::array<float,2>{0.888773441f, 0.749632418f},
-std::array<float,2>{0.0100338683f, 0.291112065f},
-std::array<float,2>{0.434821755f, 0.880205452f},
-std::array<float,2>{0.528016269f, 0.0525250211f},
-std::array<float,2>{0.634148538f, 0.818447053f},
-std::array<float,2>{0.349324137f, 0.170817599f},
-std::array<float,2>{0.240934476f, 0.508262157f},
-std::array<float,2>{0.808831453f, 0.391491681f},
-std::array<float,2>{0.786380649f, 0.873734951f},
-std::array<float,2>{0.223220065f, 0.127298921f},
-std::array<float,2>{0.374362975f, 0.560276866f},
-std::array<float,2>{0.642854214f, 0.418487072f},
-std::array<float,2>{0.504934788f, 0.69714272f},
-std::array<float,2>{0.413499534f, 0.255898088f},
-std::array<float,2>{0.0286924783f, 0.927915096f},
-std::array<float,2>{0.893087804f, 0.026948737f},
-std::array<float,2>{0.967290163f, 0.600901365f},
-std::array<float,2>{0.0657289401f, 0.485274136f},
-std::array<float,2>{0.471044332f, 0.757360756f},
-std::array<float,2>{0.618621767f, 0.197499067f},
-std::array<float,2>{0.707930148f, 0.98262018f},
-std::array<float,2>{0.304581285f, 0.0947400779f},
-std::array<float,2>{0.161817804f, 0.6478194f},
-std::array<float,2>{0.856886029f, 0.372085243f},
-std::array<float,2>{0.933987677f, 0.90156424f},
-std::array<float,2>{0.0546674132f, 0.0454691797f},
-std::array<float,2>{0.39749667f, 0.73224932f},
-std::array<float,2>{0.560528398f, 0.300707668f},
-std::array<float,2>{0.665169418f, 0.528574646f},
-std::array<float,2>{0.321988016f, 0.387647301f},
-std::array<float,2>{0.214321166f, 0.838334441f},
-std::array<float,2>{0.771064579f, 0.183283001f},
-std::array<float,2>{0.832762837f, 0.673848152f},
-std::array<float,2>{0.126902297f, 0.316424936f},
-std::array<float,2>{0.277700365f, 0.945189834f},
-std::array<float,2>{0.723893344f, 0.0752930716f},
-std::array<float,2>{0.579765737f, 0.790425479f},
-std::array<float,2>{0.451019615f, 0.233008161f},
-std::array<float,2>{0.1197102f, 0.577359974f},
-std::array<float,2>{0.969453156f, 0.439309925f},
-std::array<float,2>{0.954255462f, 0.854121506f},
-std::array<float,2>{0.0762620196f, 0.154613242f},
-std::array<float,2>{0.476646721f, 0.545316815f},
-std::array<float,2>{0.61027652f, 0.42905125f},
-std::array<float,2>{0.711340904f, 0.704941332f},
-std::array<float,2>{0.306568354f, 0.274265558f},
-std::array<float,2>{0.165145442f, 0.915025771f},
-std::array<float,2>{0.849819779f, 0.00722738355f},
-std::array<float,2>{0.795171916f, 0.619640589f},
-std::array<float,2>{0.227377772f, 0.479022235f},
-std::array<float,2>{0.364610195f, 0.776683748f},
-std::array<float,2>{0.654139519f, 0.20526439f},
-std::array<float,2>{0.511675656f, 0.994934857f},
-std::array<float,2>{0.421041399f, 0.120510787f},
-std::array<float,2>{0.0201421268f, 0.630667984f},
-std::array<float,2>{0.9032529f, 0.345336825f},
-std::array<float,2>{0.841046751f, 0.877719939f},
-std::array<float,2>{0.137796238f, 0.048892837f},
-std::array<float,2>{0.267492294f, 0.745033741f},
-std::array<float,2>{0.734328449f, 0.293292493f},
-std::array<float,2>{0.585958242f, 0.515391171f},
-std::array<float,2>{0.439100504f, 0.397376388f},
-std::array<float,2>{0.115572698f, 0.813148379f},
-std::array<float,2>{0.980871677f, 0.16534768f},
-std::array<float,2>{0.927300751f, 0.66878587f},
-std::array<float,2>{0.057040453f, 0.331478179f},
-std::array<float,2>{0.398501456f, 0.965154827f},
-std::array<float,2>{0.549835384f, 0.0870691761f},
-std::array<float,2>{0.662527859f, 0.799334228f},
-std::array<float,2>{0.318799019f, 0.242801249f},
-std::array<float,2>{0.207565367f, 0.585194409f},
-std::array<float,2>{0.77605933f, 0.467948765f},
-std::array<float,2>{0.752118468f, 0.75005728f},
-std::array<float,2>{0.192393988f, 0.201612681f},
-std::array<float,2>{0.340539366f, 0.595773578f},
-std::array<float,2>{0.67601651f, 0.489252329f},
-std::array<float,2>{0.534609318f, 0.642020106f},
-std::array<float,2>{0.380375892f, 0.36780107f},
-std::array<float,2>{0.0373968966f, 0.976624787f},
-std::array<float,2>{0.909013629f, 0.0985433012f},
-std::array<float,2>{0.994065464f, 0.555327535f},
-std::array<float,2>{0.106950171f, 0.414982915f},
-std::array<float,2>{0.466974258f, 0.870030522f},
-std::array<float,2>{0.568114102f, 0.129810542f},
-std::array<float,2>{0.736742854f, 0.924231231f},
-std::array<float,2>{0.258013487f, 0.0284966156f},
-std::array<float,2>{0.153679729f, 0.703111529f},
-std::array<float,2>{0.820151448f, 0.252432406f},
-std::array<float,2>{0.880478382f, 0.939047754f},
-std::array<float,2>{0.00391345937f, 0.0726783946f},
-std::array<float,2>{0.427974224f, 0.679529428f},
-std::array<float,2>{0.518277884f, 0.315197617f},
-std::array<float,2>{0.629383206f, 0.572892547f},
-std::array<float,2>{0.352814943f, 0.443261236f},
-std::array<float,2>{0.246961966f, 0.795577586f},
-std::array<float,2>{0.803171217f, 0.229214832f},
-std::array<float,2>{0.869170845f, 0.729779005f},
-std::array<float,2>{0.184661791f, 0.304234952f},
-std::array<float,2>{0.296657324f, 0.904174805f},
-std::array<float,2>{0.701896071f, 0.0395231172f},
-std::array<float,2>{0.599964321f, 0.841007888f},
-std::array<float,2>{0.488358915f, 0.183923632f},
-std::array<float,2>{0.0789549798f, 0.52458626f},
-std::array<float,2>{0.939236283f, 0.38509652f},
-std::array<float,2>{0.920770764f, 0.78575331f},
-std::array<float,2>{0.0437383875f, 0.22099252f},
-std::array<float,2>{0.383409798f, 0.568567693f},
-std::array<float,2>{0.546140671f, 0.44561711f},
-std::array<float,2>{0.681938171f, 0.682089508f},
-std::array<float,2>{0.33252725f, 0.32356593f},
-std::array<float,2>{0.201333195f, 0.94555527f},
-std::array<float,2>{0.765550613f, 0.0651035607f},
-std::array<float,2>{0.823489785f, 0.523216844f},
-std::array<float,2>{0.146171927f, 0.376416206f},
-std::array<float,2>{0.25339666f, 0.835232496f},
-std::array<float,2>{0.748328805f, 0.176369235f},
-std::array<float,2>{0.571904778f, 0.891920984f},
-std::array<float,2>{0.455363452f, 0.0318766832f},
-std::array<float,2>{0.0956968591f, 0.726240575f},
-std::array<float,2>{0.984883189f, 0.309296519f},
-std::array<float,2>{0.807050586f, 0.976373911f},
-std::array<float,2>{0.236784533f, 0.101874895f},
-std::array<float,2>{0.344999999f, 0.654855192f},
-std::array<float,2>{0.637696922f, 0.362335145f},
-std::array<float,2>{0.523549557f, 0.607313156f},
-std::array<float,2>{0.431623101f, 0.496913224f},
-std::array<float,2>{0.0137007413f, 0.75782913f},
-std::array<float,2>{0.883108735f, 0.194782957f},
-std::array<float,2>{0.946582735f, 0.693946719f},
-std::array<float,2>{0.0919668674f, 0.264728189f},
-std::array<float,2>{0.493482411f, 0.934006393f},
-std::array<float,2>{0.60876292f, 0.0229070932f},
-std::array<float,2>{0.693110108f, 0.862386465f},
-std::array<float,2>{0.288013667f, 0.133666366f},
-std::array<float,2>{0.172387317f, 0.551586628f},
-std::array<float,2>{0.866382778f, 0.41277197f},
-std::array<float,2>{0.853225291f, 0.826078713f},
-std::array<float,2>{0.158094853f, 0.156874195f},
-std::array<float,2>{0.29930678f, 0.50512296f},
-std::array<float,2>{0.705808282f, 0.405596554f},
-std::array<float,2>{0.624946594f, 0.738945544f},
-std::array<float,2>{0.474370837f, 0.28810513f},
-std::array<float,2>{0.0676349401f, 0.887287974f},
-std::array<float,2>{0.962328613f, 0.0573842935f},
-std::array<float,2>{0.898296237f, 0.59029454f},
-std::array<float,2>{0.026739886f, 0.455977648f},
-std::array<float,2>{0.409804404f, 0.805761039f},
-std::array<float,2>{0.503879368f, 0.238783509f},
-std::array<float,2>{0.647258341f, 0.955850661f},
-std::array<float,2>{0.369058311f, 0.0853067189f},
-std::array<float,2>{0.219737962f, 0.656312346f},
-std::array<float,2>{0.781757116f, 0.343409032f},
-std::array<float,2>{0.973647237f, 0.906490862f},
-std::array<float,2>{0.122753091f, 0.0120017044f},
-std::array<float,2>{0.448308676f, 0.718067348f},
-std::array<float,2>{0.584744275f, 0.269014388f},
-std::array<float,2>{0.718798161f, 0.538430989f},
-std::array<float,2>{0.274117529f, 0.431028455f},
-std::array<float,2>{0.131972253f, 0.84921366f},
-std::array<float,2>{0.830000401f, 0.143570721f},
-std::array<float,2>{0.766745687f, 0.640410721f},
-std::array<float,2>{0.218547553f, 0.356698871f},
-std::array<float,2>{0.324250042f, 0.985874593f},
-std::array<float,2>{0.669254124f, 0.114857465f},
-std::array<float,2>{0.556739688f, 0.768630326f},
-std::array<float,2>{0.393691689f, 0.213876724f},
-std::array<float,2>{0.0470806174f, 0.615283728f},
-std::array<float,2>{0.932452261f, 0.473851025f},
-std::array<float,2>{0.911386549f, 0.822793365f},
-std::array<float,2>{0.0349378958f, 0.163613528f},
-std::array<float,2>{0.376285136f, 0.502399027f},
-std::array<float,2>{0.535629153f, 0.401443839f},
-std::array<float,2>{0.672485411f, 0.736629963f},
-std::array<float,2>{0.336950243f, 0.282965034f},
-std::array<float,2>{0.188622355f, 0.883469522f},
-std::array<float,2>{0.757447124f, 0.0600836277f},
-std::array<float,2>{0.812777817f, 0.588173866f},
-std::array<float,2>{0.150633007f, 0.458551526f},
-std::array<float,2>{0.264263988f, 0.812177181f},
-std::array<float,2>{0.739015579f, 0.236234486f},
-std::array<float,2>{0.563964725f, 0.957346082f},
-std::array<float,2>{0.46184364f, 0.0818345696f},
-std::array<float,2>{0.102287859f, 0.664043844f},
-std::array<float,2>{0.996180534f, 0.337038994f},
-std::array<float,2>{0.800051451f, 0.910652399f},
-std::array<float,2>{0.24426131f, 0.00879838225f},
-std::array<float,2>{0.359115511f, 0.711939752f},
-std::array<float,2>{0.62664789f, 0.272236794f},
-std::array<float,2>{0.520944059f, 0.535075843f},
-std::array<float,2>{0.422795564f, 0.434621632f},
-std::array<float,2>{0.00100040319f, 0.846746743f},
-std::array<float,2>{0.87584573f, 0.147481844f},
-std::array<float,2>{0.942992806f, 0.636695743f},
-std::array<float,2>{0.0834478065f, 0.354945511f},
-std::array<float,2>{0.484887987f, 0.989531338f},
-std::array<float,2>{0.596939743f, 0.110485114f},
-std::array<float,2>{0.695627272f, 0.772544205f},
-std::array<float,2>{0.291015953f, 0.216821328f},
-std::array<float,2>{0.181517243f, 0.612325907f},
-std::array<float,2>{0.873614669f, 0.468854666f},
-std::array<float,2>{0.847507417f, 0.784819126f},
-std::array<float,2>{0.169781074f, 0.225907996f},
-std::array<float,2>{0.311554104f, 0.56251353f},
-std::array<float,2>{0.716948867f, 0.452842116f},
-std::array<float,2>{0.616123736f, 0.687116802f},
-std::array<float,2>{0.484373987f, 0.325623959f},
-std::array<float,2>{0.0727038383f, 0.950784326f},
-std::array<float,2>{0.957234204f, 0.0677909553f},
-std::array<float,2>{0.900561929f, 0.517830968f},
-std::array<float,2>{0.018537309f, 0.379595399f},
-std::array<float,2>{0.417266548f, 0.830771387f},
-std::array<float,2>{0.512461662f, 0.173617378f},
-std::array<float,2>{0.652242541f, 0.895246029f},
-std::array<float,2>{0.362384319f, 0.0376738831f},
-std::array<float,2>{0.232261211f, 0.719672978f},
-std::array<float,2>{0.789327562f, 0.307639241f},
-std::array<float,2>{0.97762984f, 0.972299814f},
-std::array<float,2>{0.112834893f, 0.107260451f},
-std::array<float,2>{0.444144666f, 0.651305676f},
-std::array<float,2>{0.593355298f, 0.366199166f},
-std::array<float,2>{0.726650894f, 0.602707386f},
-std::array<float,2>{0.269748867f, 0.493231446f},
-std::array<float,2>{0.135274887f, 0.762541533f},
-std::array<float,2>{0.837340772f, 0.190343156f},
-std::array<float,2>{0.781085014f, 0.688688099f},
-std::array<float,2>{0.204222009f, 0.260603994f},
-std::array<float,2>{0.314060003f, 0.933164418f},
-std::array<float,2>{0.658508003f, 0.0164073464f},
-std::array<float,2>{0.553215027f, 0.863540351f},
-std::array<float,2>{0.402666509f, 0.136888653f},
-std::array<float,2>{0.0607239716f, 0.54787606f},
-std::array<float,2>{0.922032475f, 0.409318477f},
-std::array<float,2>{0.966521621f, 0.756150007f},
-std::array<float,2>{0.0639199391f, 0.199113846f},
-std::array<float,2>{0.469502032f, 0.600076258f},
-std::array<float,2>{0.619407535f, 0.485804051f},
-std::array<float,2>{0.710149586f, 0.646880507f},
-std::array<float,2>{0.302682012f, 0.371915132f},
-std::array<float,2>{0.163247973f, 0.984350383f},
-std::array<float,2>{0.858527243f, 0.0938207284f},
-std::array<float,2>{0.788879871f, 0.559554517f},
-std::array<float,2>{0.225817353f, 0.419005692f},
-std::array<float,2>{0.371919215f, 0.874530315f},
-std::array<float,2>{0.641587019f, 0.128735736f},
-std::array<float,2>{0.507593632f, 0.928879321f},
-std::array<float,2>{0.41145438f, 0.0256685596f},
-std::array<float,2>{0.0306380577f, 0.696045578f},
-std::array<float,2>{0.892004251f, 0.257392108f},
-std::array<float,2>{0.8345173f, 0.944262445f},
-std::array<float,2>{0.127176479f, 0.0749639645f},
-std::array<float,2>{0.280385733f, 0.674867749f},
-std::array<float,2>{0.725138962f, 0.318249553f},
-std::array<float,2>{0.581841528f, 0.576932669f},
-std::array<float,2>{0.452239007f, 0.438335389f},
-std::array<float,2>{0.117692985f, 0.789534092f},
-std::array<float,2>{0.971145153f, 0.23433347f},
-std::array<float,2>{0.936918139f, 0.730581999f},
-std::array<float,2>{0.0515367389f, 0.299716294f},
-std::array<float,2>{0.395788044f, 0.900444746f},
-std::array<float,2>{0.561506033f, 0.0465670601f},
-std::array<float,2>{0.66643852f, 0.839252472f},
-std::array<float,2>{0.323385149f, 0.18167147f},
-std::array<float,2>{0.212781802f, 0.527914524f},
-std::array<float,2>{0.771789491f, 0.387732029f},
-std::array<float,2>{0.759433746f, 0.859013736f},
-std::array<float,2>{0.195503697f, 0.150555566f},
-std::array<float,2>{0.330397248f, 0.539822638f},
-std::array<float,2>{0.685322642f, 0.42233488f},
-std::array<float,2>{0.541458786f, 0.707184911f},
-std::array<float,2>{0.388634771f, 0.280201614f},
-std::array<float,2>{0.0422556065f, 0.918887019f},
-std::array<float,2>{0.917915523f, 0.00228633243f},
-std::array<float,2>{0.991183758f, 0.621510267f},
-std::array<float,2>{0.0978166163f, 0.483572334f},
-std::array<float,2>{0.45754987f, 0.777797997f},
-std::array<float,2>{0.575264633f, 0.208170101f},
-std::array<float,2>{0.743998528f, 0.996899068f},
-std::array<float,2>{0.254164577f, 0.122613229f},
-std::array<float,2>{0.14190428f, 0.626227081f},
-std::array<float,2>{0.827796519f, 0.350836307f},
-std::array<float,2>{0.887233555f, 0.879204035f},
-std::array<float,2>{0.0081719961f, 0.051359836f},
-std::array<float,2>{0.436599374f, 0.748567224f},
-std::array<float,2>{0.530824661f, 0.292486429f},
-std::array<float,2>{0.636482239f, 0.508855045f},
-std::array<float,2>{0.351091981f, 0.391621947f},
-std::array<float,2>{0.239962578f, 0.820119798f},
-std::array<float,2>{0.812251806f, 0.171712458f},
-std::array<float,2>{0.861752093f, 0.665269852f},
-std::array<float,2>{0.175969347f, 0.334545016f},
-std::array<float,2>{0.281681567f, 0.961442351f},
-std::array<float,2>{0.690688908f, 0.091180779f},
-std::array<float,2>{0.603038251f, 0.801977873f},
-std::array<float,2>{0.498299688f, 0.247822434f},
-std::array<float,2>{0.0890033543f, 0.57902056f},
-std::array<float,2>{0.951232255f, 0.464003235f},
-std::array<float,2>{0.995493829f, 0.870668054f},
-std::array<float,2>{0.109230831f, 0.130510062f},
-std::array<float,2>{0.465681881f, 0.555814445f},
-std::array<float,2>{0.568688214f, 0.415924877f},
-std::array<float,2>{0.735185921f, 0.701824546f},
-std::array<float,2>{0.261491537f, 0.253759086f},
-std::array<float,2>{0.15520373f, 0.925525248f},
-std::array<float,2>{0.817705393f, 0.027531052f},
-std::array<float,2>{0.750000119f, 0.597312272f},
-std::array<float,2>{0.193634421f, 0.48959589f},
-std::array<float,2>{0.343707204f, 0.751864195f},
-std::array<float,2>{0.677872837f, 0.202689186f},
-std::array<float,2>{0.532826006f, 0.97837323f},
-std::array<float,2>{0.381247669f, 0.0990501046f},
-std::array<float,2>{0.0363410413f, 0.641486168f},
-std::array<float,2>{0.907201946f, 0.368775904f},
-std::array<float,2>{0.868046582f, 0.902574301f},
-std::array<float,2>{0.186031476f, 0.0405092724f},
-std::array<float,2>{0.293385595f, 0.729397178f},
-std::array<float,2>{0.700344741f, 0.302875489f},
-std::array<float,2>{0.598666906f, 0.523491204f},
-std::array<float,2>{0.491787553f, 0.386423677f},
-std::array<float,2>{0.0803051367f, 0.8406865f},
-std::array<float,2>{0.940750659f, 0.185063124f},
-std::array<float,2>{0.881451964f, 0.67791301f},
-std::array<float,2>{0.00630973605f, 0.315829307f},
-std::array<float,2>{0.425953031f, 0.937934458f},
-std::array<float,2>{0.516321659f, 0.0741422176f},
-std::array<float,2>{0.630921423f, 0.796070874f},
-std::array<float,2>{0.35367319f, 0.229529947f},
-std::array<float,2>{0.248945951f, 0.573759913f},
-std::array<float,2>{0.801200211f, 0.442251533f},
-std::array<float,2>{0.793058157f, 0.776025474f},
-std::array<float,2>{0.229831889f, 0.206888914f},
-std::array<float,2>{0.367117971f, 0.620983005f},
-std::array<float,2>{0.654321074f, 0.480459899f},
-std::array<float,2>{0.508883536f, 0.629194021f},
-std::array<float,2>{0.418296427f, 0.3438676f},
-std::array<float,2>{0.0222116951f, 0.995635569f},
-std::array<float,2>{0.905686438f, 0.120051049f},
-std::array<float,2>{0.955665231f, 0.546127915f},
-std::array<float,2>{0.0760007501f, 0.428322166f},
-std::array<float,2>{0.479239076f, 0.85477227f},
-std::array<float,2>{0.611459672f, 0.155383572f},
-std::array<float,2>{0.713027239f, 0.915462852f},
-std::array<float,2>{0.307387263f, 0.00620911736f},
-std::array<float,2>{0.166025296f, 0.7040959f},
-std::array<float,2>{0.848763645f, 0.275357753f},
-std::array<float,2>{0.927851439f, 0.966121733f},
-std::array<float,2>{0.0562792979f, 0.0868647024f},
-std::array<float,2>{0.40202862f, 0.669005156f},
-std::array<float,2>{0.548702896f, 0.330884933f},
-std::array<float,2>{0.661140084f, 0.584830046f},
-std::array<float,2>{0.317240536f, 0.467359602f},
-std::array<float,2>{0.210653409f, 0.800130665f},
-std::array<float,2>{0.773833811f, 0.243926004f},
-std::array<float,2>{0.842459738f, 0.745779693f},
-std::array<float,2>{0.140171245f, 0.294506639f},
-std::array<float,2>{0.268350512f, 0.878783226f},
-std::array<float,2>{0.730944932f, 0.0504717827f},
-std::array<float,2>{0.589553297f, 0.813490331f},
-std::array<float,2>{0.440846264f, 0.164546147f},
-std::array<float,2>{0.113712974f, 0.514600039f},
-std::array<float,2>{0.98339361f, 0.397937328f},
-std::array<float,2>{0.895803869f, 0.804770827f},
-std::array<float,2>{0.0246665478f, 0.239301667f},
-std::array<float,2>{0.406481445f, 0.591536522f},
-std::array<float,2>{0.501478612f, 0.456791013f},
-std::array<float,2>{0.645832956f, 0.657337189f},
-std::array<float,2>{0.370506465f, 0.341991007f},
-std::array<float,2>{0.222265854f, 0.956928313f},
-std::array<float,2>{0.784371257f, 0.0849462077f},
-std::array<float,2>{0.855180621f, 0.504478514f},
-std::array<float,2>{0.158820421f, 0.404553711f},
-std::array<float,2>{0.298658758f, 0.824927509f},
-std::array<float,2>{0.70440948f, 0.157809019f},
-std::array<float,2>{0.62117815f, 0.887847722f},
-std::array<float,2>{0.476204097f, 0.0585213937f},
-std::array<float,2>{0.0693939924f, 0.740186095f},
-std::array<float,2>{0.96323961f, 0.287610441f},
-std::array<float,2>{0.767972708f, 0.984572172f},
-std::array<float,2>{0.215784669f, 0.113824993f},
-std::array<float,2>{0.327522933f, 0.639637351f},
-std::array<float,2>{0.670930088f, 0.356123596f},
-std::array<float,2>{0.55573827f, 0.61658293f},
-std::array<float,2>{0.392294675f, 0.473159462f},
-std::array<float,2>{0.0497591421f, 0.767883599f},
-std::array<float,2>{0.930932045f, 0.212900296f},
-std::array<float,2>{0.97535634f, 0.717511594f},
-std::array<float,2>{0.123675436f, 0.267626166f},
-std::array<float,2>{0.445960462f, 0.90726018f},
-std::array<float,2>{0.583338976f, 0.0135708274f},
-std::array<float,2>{0.72098732f, 0.847690463f},
-std::array<float,2>{0.276878268f, 0.142683983f},
-std::array<float,2>{0.130416542f, 0.538084686f},
-std::array<float,2>{0.830996871f, 0.430333883f},
-std::array<float,2>{0.821117282f, 0.834922075f},
-std::array<float,2>{0.147241205f, 0.177200004f},
-std::array<float,2>{0.250475526f, 0.522392273f},
-std::array<float,2>{0.746647835f, 0.375392973f},
-std::array<float,2>{0.5739972f, 0.725224853f},
-std::array<float,2>{0.453248888f, 0.310473531f},
-std::array<float,2>{0.0960924476f, 0.89136827f},
-std::array<float,2>{0.986625195f, 0.0329483561f},
-std::array<float,2>{0.91983217f, 0.57021445f},
-std::array<float,2>{0.0467526391f, 0.446580559f},
-std::array<float,2>{0.385368824f, 0.787007868f},
-std::array<float,2>{0.544604599f, 0.221828699f},
-std::array<float,2>{0.680447876f, 0.946805894f},
-std::array<float,2>{0.335013092f, 0.0654684007f},
-std::array<float,2>{0.199961051f, 0.682918966f},
-std::array<float,2>{0.762044609f, 0.322708368f},
-std::array<float,2>{0.948642194f, 0.934847116f},
-std::array<float,2>{0.0900897309f, 0.0220917724f},
-std::array<float,2>{0.495209247f, 0.694436193f},
-std::array<float,2>{0.606428683f, 0.264522105f},
-std::array<float,2>{0.694268823f, 0.552570164f},
-std::array<float,2>{0.286971509f, 0.413530678f},
-std::array<float,2>{0.174746528f, 0.861895382f},
-std::array<float,2>{0.863352239f, 0.134675965f},
-std::array<float,2>{0.804731965f, 0.655484915f},
-std::array<float,2>{0.23460497f, 0.362067312f},
-std::array<float,2>{0.346799135f, 0.97462815f},
-std::array<float,2>{0.638781905f, 0.103274472f},
-std::array<float,2>{0.525495768f, 0.759268641f},
-std::array<float,2>{0.432632178f, 0.193745419f},
-std::array<float,2>{0.0117254378f, 0.605502367f},
-std::array<float,2>{0.886587083f, 0.497549921f},
-std::array<float,2>{0.878088117f, 0.84508121f},
-std::array<float,2>{0.00321370526f, 0.146123827f},
-std::array<float,2>{0.424877852f, 0.532491565f},
-std::array<float,2>{0.523207128f, 0.435631305f},
-std::array<float,2>{0.627964854f, 0.714346826f},
-std::array<float,2>{0.357398599f, 0.270801038f},
-std::array<float,2>{0.242826775f, 0.913610041f},
-std::array<float,2>{0.79728806f, 0.010069659f},
-std::array<float,2>{0.871696174f, 0.61074394f},
-std::array<float,2>{0.183285117f, 0.471016109f},
-std::array<float,2>{0.289330393f, 0.770662606f},
-std::array<float,2>{0.698784709f, 0.216498628f},
-std::array<float,2>{0.594056606f, 0.991553009f},
-std::array<float,2>{0.487779111f, 0.111952625f},
-std::array<float,2>{0.0854569972f, 0.634728968f},
-std::array<float,2>{0.944953859f, 0.351969004f},
-std::array<float,2>{0.755542159f, 0.885143995f},
-std::array<float,2>{0.190401927f, 0.060838867f},
-std::array<float,2>{0.337980539f, 0.734936237f},
-std::array<float,2>{0.673861802f, 0.283800244f},
-std::array<float,2>{0.538957536f, 0.50156045f},
-std::array<float,2>{0.377431929f, 0.399545491f},
-std::array<float,2>{0.0325382128f, 0.821175158f},
-std::array<float,2>{0.912935555f, 0.160269126f},
-std::array<float,2>{0.999928832f, 0.662095845f},
-std::array<float,2>{0.104561597f, 0.338683009f},
-std::array<float,2>{0.463619709f, 0.959124923f},
-std::array<float,2>{0.565645397f, 0.0795005858f},
-std::array<float,2>{0.741763175f, 0.809046626f},
-std::array<float,2>{0.262689203f, 0.237995565f},
-std::array<float,2>{0.149914518f, 0.587847114f},
-std::array<float,2>{0.815166891f, 0.459031403f},
-std::array<float,2>{0.838152349f, 0.765193939f},
-std::array<float,2>{0.134114683f, 0.188577875f},
-std::array<float,2>{0.272582114f, 0.603691697f},
-std::array<float,2>{0.729006648f, 0.495092869f},
-std::array<float,2>{0.590699494f, 0.648732483f},
-std::array<float,2>{0.443086892f, 0.364959419f},
-std::array<float,2>{0.110988423f, 0.968896866f},
-std::array<float,2>{0.979707003f, 0.107997328f},
-std::array<float,2>{0.924807608f, 0.548857749f},
-std::array<float,2>{0.0589147545f, 0.407971054f},
-std::array<float,2>{0.405524164f, 0.866489053f},
-std::array<float,2>{0.551436901f, 0.138699502f},
-std::array<float,2>{0.656392932f, 0.931620359f},
-std::array<float,2>{0.316372037f, 0.0189895481f},
-std::array<float,2>{0.206843898f, 0.689643383f},
-std::array<float,2>{0.777352214f, 0.25876984f},
-std::array<float,2>{0.960457683f, 0.95205164f},
-std::array<float,2>{0.0716627091f, 0.0687405095f},
-std::array<float,2>{0.480645806f, 0.685045004f},
-std::array<float,2>{0.614759624f, 0.327860981f},
-std::array<float,2>{0.715275764f, 0.565711021f},
-std::array<float,2>{0.309878916f, 0.449856222f},
-std::array<float,2>{0.171437487f, 0.782238364f},
-std::array<float,2>{0.844574749f, 0.224497348f},
-std::array<float,2>{0.792562962f, 0.720800996f},
-std::array<float,2>{0.23402606f, 0.304765105f},
-std::array<float,2>{0.361216664f, 0.897827685f},
-std::array<float,2>{0.64978832f, 0.0351592302f},
-std::array<float,2>{0.514509022f, 0.829779088f},
-std::array<float,2>{0.415580928f, 0.174036995f},
-std::array<float,2>{0.0167847686f, 0.515896618f},
-std::array<float,2>{0.899335563f, 0.381507486f},
-std::array<float,2>{0.96994108f, 0.792030513f},
-std::array<float,2>{0.120946489f, 0.231954157f},
-std::array<float,2>{0.449916065f, 0.574297428f},
-std::array<float,2>{0.578632772f, 0.4403584f},
-std::array<float,2>{0.723040342f, 0.672790468f},
-std::array<float,2>{0.279211909f, 0.318499058f},
-std::array<float,2>{0.125818893f, 0.942206442f},
-std::array<float,2>{0.83304882f, 0.0765474215f},
-std::array<float,2>{0.769863605f, 0.52956903f},
-std::array<float,2>{0.213087618f, 0.39022845f},
-std::array<float,2>{0.320839643f, 0.83727324f},
-std::array<float,2>{0.66489619f, 0.180531308f},
-std::array<float,2>{0.558830976f, 0.900143445f},
-std::array<float,2>{0.396966815f, 0.0443435907f},
-std::array<float,2>{0.0532830954f, 0.733621955f},
-std::array<float,2>{0.934913933f, 0.298590928f},
-std::array<float,2>{0.856096804f, 0.981738508f},
-std::array<float,2>{0.161097363f, 0.0957895517f},
-std::array<float,2>{0.303172708f, 0.645985186f},
-std::array<float,2>{0.708293378f, 0.373194426f},
-std::array<float,2>{0.618051052f, 0.597920418f},
-std::array<float,2>{0.472100377f, 0.4875305f},
-std::array<float,2>{0.0653955638f, 0.75412631f},
-std::array<float,2>{0.968071163f, 0.195652172f},
-std::array<float,2>{0.893812597f, 0.698892891f},
-std::array<float,2>{0.0277969316f, 0.254731566f},
-std::array<float,2>{0.412257493f, 0.927080274f},
-std::array<float,2>{0.504030287f, 0.023652669f},
-std::array<float,2>{0.643870115f, 0.871612191f},
-std::array<float,2>{0.373679191f, 0.126674339f},
-std::array<float,2>{0.22374244f, 0.560970247f},
-std::array<float,2>{0.786122024f, 0.419966161f},
-std::array<float,2>{0.809688509f, 0.816809237f},
-std::array<float,2>{0.241330609f, 0.169274345f},
-std::array<float,2>{0.348276317f, 0.510964632f},
-std::array<float,2>{0.63284415f, 0.392832249f},
-std::array<float,2>{0.529251933f, 0.746984601f},
-std::array<float,2>{0.433841199f, 0.290465295f},
-std::array<float,2>{0.0114890244f, 0.882366776f},
-std::array<float,2>{0.889682651f, 0.0528197251f},
-std::array<float,2>{0.949384153f, 0.580497742f},
-std::array<float,2>{0.0862811208f, 0.462541997f},
-std::array<float,2>{0.497866869f, 0.804431736f},
-std::array<float,2>{0.60482645f, 0.248111859f},
-std::array<float,2>{0.688669443f, 0.96343267f},
-std::array<float,2>{0.284178913f, 0.0926770568f},
-std::array<float,2>{0.178010955f, 0.666707456f},
-std::array<float,2>{0.860328674f, 0.333231658f},
-std::array<float,2>{0.914458752f, 0.920809388f},
-std::array<float,2>{0.0395541154f, 0.000837685249f},
-std::array<float,2>{0.390310466f, 0.710018933f},
-std::array<float,2>{0.539427817f, 0.277669042f},
-std::array<float,2>{0.687276721f, 0.542663693f},
-std::array<float,2>{0.328380078f, 0.423936665f},
-std::array<float,2>{0.198036432f, 0.855492115f},
-std::array<float,2>{0.761037111f, 0.149436742f},
-std::array<float,2>{0.82572794f, 0.627349615f},
-std::array<float,2>{0.144037142f, 0.349226952f},
-std::array<float,2>{0.257221609f, 0.998575985f},
-std::array<float,2>{0.744497001f, 0.124623634f},
-std::array<float,2>{0.576320648f, 0.780439138f},
-std::array<float,2>{0.460566282f, 0.210408345f},
-std::array<float,2>{0.100556634f, 0.623097122f},
-std::array<float,2>{0.990106165f, 0.480660081f},
-std::array<float,2>{0.938394964f, 0.842377543f},
-std::array<float,2>{0.0798662081f, 0.185646057f},
-std::array<float,2>{0.489752203f, 0.525686085f},
-std::array<float,2>{0.600641131f, 0.383096009f},
-std::array<float,2>{0.702839315f, 0.727678895f},
-std::array<float,2>{0.295553267f, 0.302316278f},
-std::array<float,2>{0.183819279f, 0.906204402f},
-std::array<float,2>{0.870541811f, 0.0425849892f},
-std::array<float,2>{0.80456382f, 0.570670784f},
-std::array<float,2>{0.247994199f, 0.444347769f},
-std::array<float,2>{0.352344215f, 0.79428947f},
-std::array<float,2>{0.630600393f, 0.227921322f},
-std::array<float,2>{0.519262791f, 0.940802038f},
-std::array<float,2>{0.429221332f, 0.0703507811f},
-std::array<float,2>{0.0053528971f, 0.676908135f},
-std::array<float,2>{0.879765689f, 0.312888145f},
-std::array<float,2>{0.819122851f, 0.923782408f},
-std::array<float,2>{0.15257515f, 0.0298639704f},
-std::array<float,2>{0.259488076f, 0.700700462f},
-std::array<float,2>{0.738100708f, 0.251572192f},
-std::array<float,2>{0.566411555f, 0.557204843f},
-std::array<float,2>{0.468071491f, 0.416674852f},
-std::array<float,2>{0.105852067f, 0.867593825f},
-std::array<float,2>{0.992470503f, 0.13243334f},
-std::array<float,2>{0.909288526f, 0.643069863f},
-std::array<float,2>{0.0387552902f, 0.370086938f},
-std::array<float,2>{0.379190505f, 0.979189932f},
-std::array<float,2>{0.53386122f, 0.100990348f},
-std::array<float,2>{0.677232146f, 0.752401352f},
-std::array<float,2>{0.341644108f, 0.200799972f},
-std::array<float,2>{0.191605091f, 0.594933093f},
-std::array<float,2>{0.752935946f, 0.491381049f},
-std::array<float,2>{0.776703775f, 0.79849273f},
-std::array<float,2>{0.208341077f, 0.245019183f},
-std::array<float,2>{0.319597274f, 0.582269728f},
-std::array<float,2>{0.663751006f, 0.46548748f},
-std::array<float,2>{0.549738288f, 0.670421302f},
-std::array<float,2>{0.39988929f, 0.328889906f},
-std::array<float,2>{0.0580150634f, 0.967484474f},
-std::array<float,2>{0.925856173f, 0.0880039036f},
-std::array<float,2>{0.981453001f, 0.512904823f},
-std::array<float,2>{0.11634291f, 0.394760907f},
-std::array<float,2>{0.438029945f, 0.816371202f},
-std::array<float,2>{0.587704539f, 0.166990519f},
-std::array<float,2>{0.732866049f, 0.875878036f},
-std::array<float,2>{0.26641804f, 0.0488028042f},
-std::array<float,2>{0.137612194f, 0.743810773f},
-std::array<float,2>{0.840351582f, 0.2954849f},
-std::array<float,2>{0.903584898f, 0.99254775f},
-std::array<float,2>{0.0206497889f, 0.118361279f},
-std::array<float,2>{0.420568317f, 0.631744385f},
-std::array<float,2>{0.510604441f, 0.346434385f},
-std::array<float,2>{0.652627468f, 0.617716193f},
-std::array<float,2>{0.363298804f, 0.477213025f},
-std::array<float,2>{0.227838829f, 0.774127245f},
-std::array<float,2>{0.795903683f, 0.204963729f},
-std::array<float,2>{0.851457536f, 0.706113994f},
-std::array<float,2>{0.164947197f, 0.276388437f},
-std::array<float,2>{0.305214554f, 0.917285204f},
-std::array<float,2>{0.712772608f, 0.00572986575f},
-std::array<float,2>{0.611115158f, 0.852479577f},
-std::array<float,2>{0.477687597f, 0.1534338f},
-std::array<float,2>{0.0778874084f, 0.544604063f},
-std::array<float,2>{0.953831375f, 0.427258462f},
-std::array<float,2>{0.933492005f, 0.76635915f},
-std::array<float,2>{0.048283767f, 0.211791739f},
-std::array<float,2>{0.393131584f, 0.615142584f},
-std::array<float,2>{0.558250606f, 0.47494182f},
-std::array<float,2>{0.668830812f, 0.636963129f},
-std::array<float,2>{0.325619519f, 0.359109044f},
-std::array<float,2>{0.21771723f, 0.987706184f},
-std::array<float,2>{0.76602757f, 0.115844406f},
-std::array<float,2>{0.828253686f, 0.535581291f},
-std::array<float,2>{0.1308911f, 0.432007909f},
-std::array<float,2>{0.274950504f, 0.849871039f},
-std::array<float,2>{0.720214844f, 0.141772091f},
-std::array<float,2>{0.585241854f, 0.909302235f},
-std::array<float,2>{0.448022425f, 0.0155272083f},
-std::array<float,2>{0.121735968f, 0.71593523f},
-std::array<float,2>{0.973019838f, 0.267352521f},
-std::array<float,2>{0.782467663f, 0.954265118f},
-std::array<float,2>{0.219587564f, 0.0834827945f},
-std::array<float,2>{0.367862791f, 0.659130633f},
-std::array<float,2>{0.648421109f, 0.341228008f},
-std::array<float,2>{0.502601743f, 0.592864275f},
-std::array<float,2>{0.409024775f, 0.453282237f},
-std::array<float,2>{0.0263432153f, 0.807207763f},
-std::array<float,2>{0.896955431f, 0.24166812f},
-std::array<float,2>{0.96151036f, 0.741346717f},
-std::array<float,2>{0.0667309463f, 0.286209732f},
-std::array<float,2>{0.472714484f, 0.888912618f},
-std::array<float,2>{0.623111606f, 0.0556860417f},
-std::array<float,2>{0.70668155f, 0.826900423f},
-std::array<float,2>{0.299902141f, 0.159177557f},
-std::array<float,2>{0.156774074f, 0.507719278f},
-std::array<float,2>{0.852111697f, 0.403492242f},
-std::array<float,2>{0.865881443f, 0.860431731f},
-std::array<float,2>{0.173584327f, 0.135906264f},
-std::array<float,2>{0.288258731f, 0.553044796f},
-std::array<float,2>{0.691645145f, 0.411513597f},
-std::array<float,2>{0.607491374f, 0.693081617f},
-std::array<float,2>{0.492866039f, 0.263220787f},
-std::array<float,2>{0.0934147388f, 0.937294066f},
-std::array<float,2>{0.945642829f, 0.0212996397f},
-std::array<float,2>{0.884229898f, 0.608097374f},
-std::array<float,2>{0.0154238436f, 0.499281287f},
-std::array<float,2>{0.43004334f, 0.761000514f},
-std::array<float,2>{0.524553895f, 0.191794172f},
-std::array<float,2>{0.637399793f, 0.974335194f},
-std::array<float,2>{0.344315052f, 0.104967602f},
-std::array<float,2>{0.237879083f, 0.654052377f},
-std::array<float,2>{0.807849824f, 0.359701961f},
-std::array<float,2>{0.98560369f, 0.894435406f},
-std::array<float,2>{0.094322145f, 0.0351443887f},
-std::array<float,2>{0.456171393f, 0.723810911f},
-std::array<float,2>{0.570523262f, 0.310841382f},
-std::array<float,2>{0.749049008f, 0.520936012f},
-std::array<float,2>{0.252329856f, 0.378816038f},
-std::array<float,2>{0.144829094f, 0.832471967f},
-std::array<float,2>{0.82243371f, 0.17791599f},
-std::array<float,2>{0.764085531f, 0.680564582f},
-std::array<float,2>{0.202536419f, 0.320783913f},
-std::array<float,2>{0.333491296f, 0.947906077f},
-std::array<float,2>{0.683219612f, 0.0641745925f},
-std::array<float,2>{0.545330167f, 0.787608325f},
-std::array<float,2>{0.384676695f, 0.218750447f},
-std::array<float,2>{0.0446535721f, 0.567317843f},
-std::array<float,2>{0.920970917f, 0.447299123f},
-std::array<float,2>{0.91748035f, 0.856240094f},
-std::array<float,2>{0.0429548174f, 0.15009369f},
-std::array<float,2>{0.388037682f, 0.542312682f},
-std::array<float,2>{0.54154706f, 0.424473733f},
-std::array<float,2>{0.684901834f, 0.710646451f},
-std::array<float,2>{0.330715567f, 0.278188586f},
-std::array<float,2>{0.196057558f, 0.920068741f},
-std::array<float,2>{0.758903444f, 0.000156448252f},
-std::array<float,2>{0.827565908f, 0.623897493f},
-std::array<float,2>{0.142497897f, 0.481313229f},
-std::array<float,2>{0.25477773f, 0.781079888f},
-std::array<float,2>{0.743176222f, 0.210869566f},
-std::array<float,2>{0.575850427f, 0.998389304f},
-std::array<float,2>{0.45739311f, 0.124391831f},
-std::array<float,2>{0.0985530317f, 0.627862453f},
-std::array<float,2>{0.990366817f, 0.348822117f},
-std::array<float,2>{0.811685324f, 0.882270098f},
-std::array<float,2>{0.239698201f, 0.0534855798f},
-std::array<float,2>{0.351019531f, 0.746561944f},
-std::array<float,2>{0.635973215f, 0.290809304f},
-std::array<float,2>{0.530411601f, 0.511644006f},
-std::array<float,2>{0.437212557f, 0.39325425f},
-std::array<float,2>{0.00851549394f, 0.817264438f},
-std::array<float,2>{0.886776328f, 0.169892401f},
-std::array<float,2>{0.951696932f, 0.666419625f},
-std::array<float,2>{0.0895391628f, 0.33398211f},
-std::array<float,2>{0.498867512f, 0.963078797f},
-std::array<float,2>{0.602857828f, 0.0922081843f},
-std::array<float,2>{0.691035151f, 0.803831577f},
-std::array<float,2>{0.282170832f, 0.248597994f},
-std::array<float,2>{0.1766164f, 0.580593765f},
-std::array<float,2>{0.862287462f, 0.46230638f},
-std::array<float,2>{0.858956456f, 0.75451839f},
-std::array<float,2>{0.16394724f, 0.196065247f},
-std::array<float,2>{0.3019346f, 0.59853524f},
-std::array<float,2>{0.710467756f, 0.487879455f},
-std::array<float,2>{0.619656563f, 0.646427393f},
-std::array<float,2>{0.468948931f, 0.373811394f},
-std::array<float,2>{0.0642005354f, 0.982079089f},
-std::array<float,2>{0.965924144f, 0.0966393799f},
-std::array<float,2>{0.892418563f, 0.561495245f},
-std::array<float,2>{0.0311726723f, 0.420469195f},
-std::array<float,2>{0.411978066f, 0.871507406f},
-std::array<float,2>{0.507237673f, 0.126025409f},
-std::array<float,2>{0.640853524f, 0.927396119f},
-std::array<float,2>{0.371355802f, 0.0240069553f},
-std::array<float,2>{0.226480439f, 0.698652446f},
-std::array<float,2>{0.788252354f, 0.25403136f},
-std::array<float,2>{0.971596599f, 0.941842914f},
-std::array<float,2>{0.117512621f, 0.0769516304f},
-std::array<float,2>{0.452888489f, 0.672104537f},
-std::array<float,2>{0.581169903f, 0.318872809f},
-std::array<float,2>{0.724909663f, 0.575046957f},
-std::array<float,2>{0.281030178f, 0.439505279f},
-std::array<float,2>{0.127712801f, 0.792936027f},
-std::array<float,2>{0.834226906f, 0.231928736f},
-std::array<float,2>{0.772321284f, 0.734229445f},
-std::array<float,2>{0.21230875f, 0.298080206f},
-std::array<float,2>{0.32384488f, 0.899544179f},
-std::array<float,2>{0.6667732f, 0.0446880274f},
-std::array<float,2>{0.560588717f, 0.837801695f},
-std::array<float,2>{0.396154106f, 0.179774314f},
-std::array<float,2>{0.0511620902f, 0.529994309f},
-std::array<float,2>{0.937229395f, 0.389801264f},
-std::array<float,2>{0.957779169f, 0.783177018f},
-std::array<float,2>{0.0731388032f, 0.224118009f},
-std::array<float,2>{0.483441412f, 0.566343009f},
-std::array<float,2>{0.615310609f, 0.449600726f},
-std::array<float,2>{0.717299819f, 0.685243726f},
-std::array<float,2>{0.312254518f, 0.327588528f},
-std::array<float,2>{0.169045851f, 0.951653063f},
-std::array<float,2>{0.847072065f, 0.0693167374f},
-std::array<float,2>{0.789963424f, 0.516408443f},
-std::array<float,2>{0.231887594f, 0.381334037f},
-std::array<float,2>{0.362954795f, 0.829185545f},
-std::array<float,2>{0.651832521f, 0.174346209f},
-std::array<float,2>{0.512171686f, 0.898132086f},
-std::array<float,2>{0.417614967f, 0.0359964594f},
-std::array<float,2>{0.0178222358f, 0.721256375f},
-std::array<float,2>{0.900924981f, 0.305497915f},
-std::array<float,2>{0.837817729f, 0.969450533f},
-std::array<float,2>{0.135098234f, 0.107879736f},
-std::array<float,2>{0.270491898f, 0.649086654f},
-std::array<float,2>{0.727166176f, 0.364641637f},
-std::array<float,2>{0.593210161f, 0.604111314f},
-std::array<float,2>{0.44369483f, 0.494251519f},
-std::array<float,2>{0.11267145f, 0.765029132f},
-std::array<float,2>{0.97846508f, 0.18901661f},
-std::array<float,2>{0.92260915f, 0.690047085f},
-std::array<float,2>{0.0610440858f, 0.257989377f},
-std::array<float,2>{0.403268039f, 0.930915594f},
-std::array<float,2>{0.553560078f, 0.0191128161f},
-std::array<float,2>{0.659101903f, 0.867050648f},
-std::array<float,2>{0.313842863f, 0.139521405f},
-std::array<float,2>{0.204605803f, 0.549447656f},
-std::array<float,2>{0.780383348f, 0.407296747f},
-std::array<float,2>{0.757087469f, 0.820571244f},
-std::array<float,2>{0.188995317f, 0.160930768f},
-std::array<float,2>{0.33782956f, 0.501014292f},
-std::array<float,2>{0.671962798f, 0.400344491f},
-std::array<float,2>{0.535657525f, 0.734430373f},
-std::array<float,2>{0.376794368f, 0.28350538f},
-std::array<float,2>{0.0343143158f, 0.885661542f},
-std::array<float,2>{0.912056565f, 0.061391782f},
-std::array<float,2>{0.996869862f, 0.587305903f},
-std::array<float,2>{0.101636715f, 0.459765673f},
-std::array<float,2>{0.461214006f, 0.809372127f},
-std::array<float,2>{0.564267099f, 0.237591356f},
-std::array<float,2>{0.73850286f, 0.959835887f},
-std::array<float,2>{0.264119744f, 0.0799745396f},
-std::array<float,2>{0.151270479f, 0.661374569f},
-std::array<float,2>{0.813388705f, 0.338239849f},
-std::array<float,2>{0.875202775f, 0.913499236f},
-std::array<float,2>{0.00154481735f, 0.0105164042f},
-std::array<float,2>{0.421945214f, 0.714452267f},
-std::array<float,2>{0.521354854f, 0.271250755f},
-std::array<float,2>{0.626309991f, 0.532793462f},
-std::array<float,2>{0.358483046f, 0.436153054f},
-std::array<float,2>{0.245112717f, 0.845377266f},
-std::array<float,2>{0.800378859f, 0.145804554f},
-std::array<float,2>{0.87306577f, 0.63422966f},
-std::array<float,2>{0.180752009f, 0.352329791f},
-std::array<float,2>{0.291906297f, 0.991700709f},
-std::array<float,2>{0.696127713f, 0.111522354f},
-std::array<float,2>{0.597437322f, 0.771002769f},
-std::array<float,2>{0.484858543f, 0.216079742f},
-std::array<float,2>{0.0838282183f, 0.611296713f},
-std::array<float,2>{0.942534983f, 0.471534699f},
-std::array<float,2>{0.987225533f, 0.832792342f},
-std::array<float,2>{0.0963573679f, 0.178543344f},
-std::array<float,2>{0.453944385f, 0.521478534f},
-std::array<float,2>{0.573696494f, 0.377974629f},
-std::array<float,2>{0.74609679f, 0.724131823f},
-std::array<float,2>{0.250940055f, 0.311475188f},
-std::array<float,2>{0.146929845f, 0.893666446f},
-std::array<float,2>{0.820478439f, 0.0346007086f},
-std::array<float,2>{0.762380898f, 0.566858411f},
-std::array<float,2>{0.199464291f, 0.448002726f},
-std::array<float,2>{0.335600108f, 0.787435293f},
-std::array<float,2>{0.679887354f, 0.219364837f},
-std::array<float,2>{0.5441131f, 0.947387755f},
-std::array<float,2>{0.385051489f, 0.063705042f},
-std::array<float,2>{0.0463524982f, 0.679757953f},
-std::array<float,2>{0.919140518f, 0.321019411f},
-std::array<float,2>{0.863780141f, 0.936852276f},
-std::array<float,2>{0.174314141f, 0.0205272883f},
-std::array<float,2>{0.286246955f, 0.692670941f},
-std::array<float,2>{0.693519235f, 0.263076395f},
-std::array<float,2>{0.605721593f, 0.553537905f},
-std::array<float,2>{0.4957425f, 0.411685288f},
-std::array<float,2>{0.0904720202f, 0.860853493f},
-std::array<float,2>{0.948827922f, 0.136556417f},
-std::array<float,2>{0.885764778f, 0.653687596f},
-std::array<float,2>{0.0122913588f, 0.360199004f},
-std::array<float,2>{0.43316403f, 0.973847806f},
-std::array<float,2>{0.526093543f, 0.105237454f},
-std::array<float,2>{0.639468908f, 0.761513412f},
-std::array<float,2>{0.347628266f, 0.19200556f},
-std::array<float,2>{0.235337332f, 0.607644916f},
-std::array<float,2>{0.805409312f, 0.49954468f},
-std::array<float,2>{0.784669697f, 0.806796074f},
-std::array<float,2>{0.221878618f, 0.241876587f},
-std::array<float,2>{0.370999455f, 0.593465924f},
-std::array<float,2>{0.646086752f, 0.453886092f},
-std::array<float,2>{0.501269042f, 0.658415675f},
-std::array<float,2>{0.406951457f, 0.341446549f},
-std::array<float,2>{0.0250995755f, 0.954736829f},
-std::array<float,2>{0.896290779f, 0.0837420821f},
-std::array<float,2>{0.963761449f, 0.50695467f},
-std::array<float,2>{0.0700943097f, 0.404054672f},
-std::array<float,2>{0.47571826f, 0.826183736f},
-std::array<float,2>{0.621911407f, 0.158267409f},
-std::array<float,2>{0.7048136f, 0.889459372f},
-std::array<float,2>{0.298187047f, 0.0566291176f},
-std::array<float,2>{0.158562765f, 0.741755724f},
-std::array<float,2>{0.854821384f, 0.286789834f},
-std::array<float,2>{0.931221366f, 0.987896144f},
-std::array<float,2>{0.0491133668f, 0.11562179f},
-std::array<float,2>{0.391793251f, 0.637336791f},
-std::array<float,2>{0.556225538f, 0.358420521f},
-std::array<float,2>{0.671827435f, 0.614454925f},
-std::array<float,2>{0.327668399f, 0.475554317f},
-std::array<float,2>{0.215070739f, 0.765660703f},
-std::array<float,2>{0.768082559f, 0.211106226f},
-std::array<float,2>{0.830454469f, 0.716479778f},
-std::array<float,2>{0.130120188f, 0.266911566f},
-std::array<float,2>{0.276435465f, 0.909924388f},
-std::array<float,2>{0.721440017f, 0.0149399471f},
-std::array<float,2>{0.583579898f, 0.850230038f},
-std::array<float,2>{0.445613503f, 0.142405286f},
-std::array<float,2>{0.123206772f, 0.535911322f},
-std::array<float,2>{0.974712551f, 0.432140201f},
-std::array<float,2>{0.905993104f, 0.773652315f},
-std::array<float,2>{0.021864865f, 0.204111144f},
-std::array<float,2>{0.418937504f, 0.617655218f},
-std::array<float,2>{0.509344816f, 0.476665676f},
-std::array<float,2>{0.654905379f, 0.630981803f},
-std::array<float,2>{0.366303563f, 0.345817953f},
-std::array<float,2>{0.230218843f, 0.992851555f},
-std::array<float,2>{0.793879688f, 0.118972674f},
-std::array<float,2>{0.849517465f, 0.544293761f},
-std::array<float,2>{0.166505039f, 0.426843256f},
-std::array<float,2>{0.306929171f, 0.851965487f},
-std::array<float,2>{0.713473678f, 0.154157281f},
-std::array<float,2>{0.612251341f, 0.917642713f},
-std::array<float,2>{0.478622139f, 0.00509117451f},
-std::array<float,2>{0.0753821805f, 0.706676245f},
-std::array<float,2>{0.955122948f, 0.277076483f},
-std::array<float,2>{0.774086118f, 0.966853678f},
-std::array<float,2>{0.209996343f, 0.08865235f},
-std::array<float,2>{0.316737026f, 0.670212924f},
-std::array<float,2>{0.661942005f, 0.328520507f},
-std::array<float,2>{0.547960281f, 0.582947552f},
-std::array<float,2>{0.401854545f, 0.465240389f},
-std::array<float,2>{0.055958759f, 0.797871888f},
-std::array<float,2>{0.928630471f, 0.244349465f},
-std::array<float,2>{0.982804954f, 0.743627846f},
-std::array<float,2>{0.113900103f, 0.295263499f},
-std::array<float,2>{0.441207618f, 0.875122547f},
-std::array<float,2>{0.589005947f, 0.04832251f},
-std::array<float,2>{0.731422663f, 0.815513551f},
-std::array<float,2>{0.268049568f, 0.166048095f},
-std::array<float,2>{0.139689803f, 0.513409138f},
-std::array<float,2>{0.842113554f, 0.39517504f},
-std::array<float,2>{0.818326473f, 0.868002892f},
-std::array<float,2>{0.154419422f, 0.131891534f},
-std::array<float,2>{0.261015534f, 0.557083964f},
-std::array<float,2>{0.734587491f, 0.416335434f},
-std::array<float,2>{0.569267869f, 0.700288057f},
-std::array<float,2>{0.465182811f, 0.251042187f},
-std::array<float,2>{0.108607583f, 0.923172176f},
-std::array<float,2>{0.995887101f, 0.0294660181f},
-std::array<float,2>{0.906459332f, 0.595310748f},
-std::array<float,2>{0.0368130244f, 0.491878182f},
-std::array<float,2>{0.381455034f, 0.752754748f},
-std::array<float,2>{0.532448709f, 0.200361297f},
-std::array<float,2>{0.678451002f, 0.97872144f},
-std::array<float,2>{0.342978776f, 0.101163849f},
-std::array<float,2>{0.193861946f, 0.642788827f},
-std::array<float,2>{0.750660539f, 0.369160414f},
-std::array<float,2>{0.941251934f, 0.905304313f},
-std::array<float,2>{0.0806220025f, 0.0421338864f},
-std::array<float,2>{0.491391003f, 0.728483498f},
-std::array<float,2>{0.599304736f, 0.301943123f},
-std::array<float,2>{0.700999439f, 0.526088178f},
-std::array<float,2>{0.293538749f, 0.383386791f},
-std::array<float,2>{0.186460897f, 0.84193325f},
-std::array<float,2>{0.867352188f, 0.18614164f},
-std::array<float,2>{0.801448286f, 0.677539706f},
-std::array<float,2>{0.248285651f, 0.313020885f},
-std::array<float,2>{0.354071766f, 0.941162229f},
-std::array<float,2>{0.631579995f, 0.0708139539f},
-std::array<float,2>{0.515691221f, 0.794752002f},
-std::array<float,2>{0.426590592f, 0.228092119f},
-std::array<float,2>{0.00653679343f, 0.571186602f},
-std::array<float,2>{0.881067395f, 0.44497326f},
-std::array<float,2>{0.8904953f, 0.819738448f},
-std::array<float,2>{0.0111159654f, 0.170972854f},
-std::array<float,2>{0.434378475f, 0.509696066f},
-std::array<float,2>{0.528705657f, 0.392117918f},
-std::array<float,2>{0.633670807f, 0.748430789f},
-std::array<float,2>{0.348101974f, 0.292066127f},
-std::array<float,2>{0.24193725f, 0.879835665f},
-std::array<float,2>{0.810436666f, 0.0510728993f},
-std::array<float,2>{0.859392226f, 0.578269899f},
-std::array<float,2>{0.1784897f, 0.464455187f},
-std::array<float,2>{0.283505708f, 0.802427471f},
-std::array<float,2>{0.689347208f, 0.247316763f},
-std::array<float,2>{0.605276287f, 0.961129487f},
-std::array<float,2>{0.497330189f, 0.0917920694f},
-std::array<float,2>{0.0865986571f, 0.665944278f},
-std::array<float,2>{0.950068712f, 0.334396392f},
-std::array<float,2>{0.761231422f, 0.918354988f},
-std::array<float,2>{0.197361544f, 0.00267398055f},
-std::array<float,2>{0.328910679f, 0.707805037f},
-std::array<float,2>{0.686779857f, 0.279711008f},
-std::array<float,2>{0.539686561f, 0.539093256f},
-std::array<float,2>{0.390088022f, 0.422614872f},
-std::array<float,2>{0.0395483412f, 0.858714938f},
-std::array<float,2>{0.914551318f, 0.151249796f},
-std::array<float,2>{0.989485681f, 0.626645386f},
-std::array<float,2>{0.0998059586f, 0.351149023f},
-std::array<float,2>{0.460193038f, 0.996574104f},
-std::array<float,2>{0.576964378f, 0.122211464f},
-std::array<float,2>{0.744880557f, 0.777837753f},
-std::array<float,2>{0.257371068f, 0.208633676f},
-std::array<float,2>{0.144386262f, 0.621691883f},
-std::array<float,2>{0.825547814f, 0.484198302f},
-std::array<float,2>{0.833776414f, 0.789766788f},
-std::array<float,2>{0.12526609f, 0.233671844f},
-std::array<float,2>{0.27856186f, 0.576647758f},
-std::array<float,2>{0.723166943f, 0.437952727f},
-std::array<float,2>{0.578570127f, 0.67548269f},
-std::array<float,2>{0.449627638f, 0.317714512f},
-std::array<float,2>{0.120583504f, 0.943563521f},
-std::array<float,2>{0.97031498f, 0.0744656697f},
-std::array<float,2>{0.935438931f, 0.527474463f},
-std::array<float,2>{0.0528098941f, 0.388391763f},
-std::array<float,2>{0.397328287f, 0.839725137f},
-std::array<float,2>{0.559558272f, 0.182302147f},
-std::array<float,2>{0.664262831f, 0.901108086f},
-std::array<float,2>{0.320740938f, 0.0461848825f},
-std::array<float,2>{0.213760197f, 0.731208086f},
-std::array<float,2>{0.770057976f, 0.299189717f},
-std::array<float,2>{0.96862936f, 0.983452559f},
-std::array<float,2>{0.0647631511f, 0.0945178494f},
-std::array<float,2>{0.472198606f, 0.647394896f},
-std::array<float,2>{0.617281616f, 0.371267408f},
-std::array<float,2>{0.708600104f, 0.600342035f},
-std::array<float,2>{0.303550124f, 0.485873461f},
-std::array<float,2>{0.160630569f, 0.756645024f},
-std::array<float,2>{0.855655849f, 0.198415682f},
-std::array<float,2>{0.785383523f, 0.695547402f},
-std::array<float,2>{0.224295631f, 0.257003158f},
-std::array<float,2>{0.373409569f, 0.929222345f},
-std::array<float,2>{0.644357324f, 0.0260421727f},
-std::array<float,2>{0.504624128f, 0.874102652f},
-std::array<float,2>{0.412914068f, 0.128172308f},
-std::array<float,2>{0.0279113036f, 0.559028924f},
-std::array<float,2>{0.89411658f, 0.41950354f},
-std::array<float,2>{0.980375111f, 0.761819839f},
-std::array<float,2>{0.110809773f, 0.189800322f},
-std::array<float,2>{0.44279772f, 0.603274941f},
-std::array<float,2>{0.589975119f, 0.493803799f},
-std::array<float,2>{0.728767872f, 0.650416851f},
-std::array<float,2>{0.273393065f, 0.36558035f},
-std::array<float,2>{0.134510741f, 0.97215873f},
-std::array<float,2>{0.838683128f, 0.106829777f},
-std::array<float,2>{0.778279901f, 0.548370004f},
-std::array<float,2>{0.206100464f, 0.409770429f},
-std::array<float,2>{0.315749198f, 0.863949835f},
-std::array<float,2>{0.657070041f, 0.137366086f},
-std::array<float,2>{0.551010728f, 0.932897925f},
-std::array<float,2>{0.405979156f, 0.0158256292f},
-std::array<float,2>{0.0595543943f, 0.689128578f},
-std::array<float,2>{0.925580382f, 0.259789407f},
-std::array<float,2>{0.843815982f, 0.950348496f},
-std::array<float,2>{0.17092675f, 0.0680563226f},
-std::array<float,2>{0.31009534f, 0.686781585f},
-std::array<float,2>{0.715760291f, 0.326026171f},
-std::array<float,2>{0.614490151f, 0.562997937f},
-std::array<float,2>{0.481164962f, 0.452307999f},
-std::array<float,2>{0.0722530708f, 0.784449458f},
-std::array<float,2>{0.960327029f, 0.226522967f},
-std::array<float,2>{0.898479998f, 0.719138443f},
-std::array<float,2>{0.0172113869f, 0.308307111f},
-std::array<float,2>{0.415158033f, 0.894865751f},
-std::array<float,2>{0.513831735f, 0.0373533741f},
-std::array<float,2>{0.649928689f, 0.830499887f},
-std::array<float,2>{0.360800773f, 0.172907546f},
-std::array<float,2>{0.233610228f, 0.518300891f},
-std::array<float,2>{0.792015314f, 0.379067838f},
-std::array<float,2>{0.797379076f, 0.84764111f},
-std::array<float,2>{0.242440149f, 0.148223773f},
-std::array<float,2>{0.356571674f, 0.534238756f},
-std::array<float,2>{0.628724456f, 0.435075939f},
-std::array<float,2>{0.522772133f, 0.712759614f},
-std::array<float,2>{0.42530328f, 0.271564931f},
-std::array<float,2>{0.00355712348f, 0.910369039f},
-std::array<float,2>{0.878587186f, 0.00949297193f},
-std::array<float,2>{0.944656491f, 0.612820864f},
-std::array<float,2>{0.0851113349f, 0.469655871f},
-std::array<float,2>{0.487821698f, 0.773173153f},
-std::array<float,2>{0.594450474f, 0.217450649f},
-std::array<float,2>{0.698469937f, 0.990143895f},
-std::array<float,2>{0.289765179f, 0.110894553f},
-std::array<float,2>{0.182692289f, 0.63619113f},
-std::array<float,2>{0.871143699f, 0.355392098f},
-std::array<float,2>{0.912485003f, 0.883057415f},
-std::array<float,2>{0.0329030454f, 0.0598530732f},
-std::array<float,2>{0.377841145f, 0.737184167f},
-std::array<float,2>{0.538188815f, 0.282651067f},
-std::array<float,2>{0.674772024f, 0.502616405f},
-std::array<float,2>{0.338400096f, 0.402159244f},
-std::array<float,2>{0.189621329f, 0.822492838f},
-std::array<float,2>{0.75497067f, 0.163353145f},
-std::array<float,2>{0.814463794f, 0.66346103f},
-std::array<float,2>{0.149877921f, 0.337832868f},
-std::array<float,2>{0.261751711f, 0.957675457f},
-std::array<float,2>{0.741426766f, 0.0810633078f},
-std::array<float,2>{0.56596297f, 0.811786771f},
-std::array<float,2>{0.463067055f, 0.235540584f},
-std::array<float,2>{0.105032228f, 0.588842213f},
-std::array<float,2>{0.999385059f, 0.458289444f},
-std::array<float,2>{0.94619292f, 0.861641049f},
-std::array<float,2>{0.0927967653f, 0.134060591f},
-std::array<float,2>{0.492629945f, 0.552021146f},
-std::array<float,2>{0.607951105f, 0.413866907f},
-std::array<float,2>{0.692220271f, 0.695067883f},
-std::array<float,2>{0.288584143f, 0.263998151f},
-std::array<float,2>{0.173239365f, 0.935405433f},
-std::array<float,2>{0.865527928f, 0.0215098336f},
-std::array<float,2>{0.808578789f, 0.606293201f},
-std::array<float,2>{0.237751991f, 0.497567475f},
-std::array<float,2>{0.343968183f, 0.759481549f},
-std::array<float,2>{0.637057841f, 0.194067121f},
-std::array<float,2>{0.52513957f, 0.975315154f},
-std::array<float,2>{0.430380702f, 0.102641955f},
-std::array<float,2>{0.0150994305f, 0.656118214f},
-std::array<float,2>{0.884410679f, 0.361380935f},
-std::array<float,2>{0.822807968f, 0.891037405f},
-std::array<float,2>{0.145283043f, 0.0324251093f},
-std::array<float,2>{0.252749264f, 0.72493583f},
-std::array<float,2>{0.74961859f, 0.309895545f},
-std::array<float,2>{0.570821762f, 0.521896303f},
-std::array<float,2>{0.456875354f, 0.375930488f},
-std::array<float,2>{0.0941029266f, 0.834422827f},
-std::array<float,2>{0.986245632f, 0.177373156f},
-std::array<float,2>{0.92154628f, 0.683586001f},
-std::array<float,2>{0.0443063304f, 0.322844565f},
-std::array<float,2>{0.38400656f, 0.946504414f},
-std::array<float,2>{0.545620203f, 0.0660499707f},
-std::array<float,2>{0.682959557f, 0.786401391f},
-std::array<float,2>{0.33393383f, 0.222194925f},
-std::array<float,2>{0.202772051f, 0.569739759f},
-std::array<float,2>{0.764258981f, 0.44692111f},
-std::array<float,2>{0.766578972f, 0.768149018f},
-std::array<float,2>{0.217200831f, 0.213445425f},
-std::array<float,2>{0.326156199f, 0.617023528f},
-std::array<float,2>{0.668283165f, 0.472836345f},
-std::array<float,2>{0.557936549f, 0.638760448f},
-std::array<float,2>{0.393004209f, 0.355842024f},
-std::array<float,2>{0.0486344881f, 0.985138714f},
-std::array<float,2>{0.932681143f, 0.113408633f},
-std::array<float,2>{0.973598778f, 0.537178099f},
-std::array<float,2>{0.121324718f, 0.429724962f},
-std::array<float,2>{0.447275341f, 0.848603725f},
-std::array<float,2>{0.585472822f, 0.143172264f},
-std::array<float,2>{0.720270753f, 0.907966673f},
-std::array<float,2>{0.274681389f, 0.0131758293f},
-std::array<float,2>{0.131361976f, 0.7170856f},
-std::array<float,2>{0.828982115f, 0.268237948f},
-std::array<float,2>{0.897358f, 0.956099451f},
-std::array<float,2>{0.0258006807f, 0.0841786191f},
-std::array<float,2>{0.408593863f, 0.657785237f},
-std::array<float,2>{0.501998961f, 0.342377603f},
-std::array<float,2>{0.647680759f, 0.591039598f},
-std::array<float,2>{0.367192984f, 0.456498653f},
-std::array<float,2>{0.218789011f, 0.805303812f},
-std::array<float,2>{0.78278935f, 0.240210578f},
-std::array<float,2>{0.851960063f, 0.739378214f},
-std::array<float,2>{0.156546444f, 0.28739059f},
-std::array<float,2>{0.300683796f, 0.888228297f},
-std::array<float,2>{0.70619601f, 0.057688944f},
-std::array<float,2>{0.623768389f, 0.824406028f},
-std::array<float,2>{0.473466396f, 0.157481253f},
-std::array<float,2>{0.067369923f, 0.504092276f},
-std::array<float,2>{0.960996747f, 0.405064255f},
-std::array<float,2>{0.926719487f, 0.800706387f},
-std::array<float,2>{0.0583422892f, 0.243197441f},
-std::array<float,2>{0.400103748f, 0.584062874f},
-std::array<float,2>{0.549076617f, 0.467244893f},
-std::array<float,2>{0.663496196f, 0.669485629f},
-std::array<float,2>{0.319873303f, 0.330284834f},
-std::array<float,2>{0.2085035f, 0.966613472f},
-std::array<float,2>{0.776961446f, 0.0863941237f},
-std::array<float,2>{0.839955866f, 0.513849616f},
-std::array<float,2>{0.137204394f, 0.398046225f},
-std::array<float,2>{0.265953779f, 0.814178467f},
-std::array<float,2>{0.732929111f, 0.165003061f},
-std::array<float,2>{0.58697623f, 0.878359437f},
-std::array<float,2>{0.437961012f, 0.0500954837f},
-std::array<float,2>{0.116798036f, 0.745512486f},
-std::array<float,2>{0.982100248f, 0.294052839f},
-std::array<float,2>{0.796721518f, 0.995485604f},
-std::array<float,2>{0.228353873f, 0.119289517f},
-std::array<float,2>{0.363899529f, 0.629632533f},
-std::array<float,2>{0.652855635f, 0.344474226f},
-std::array<float,2>{0.510002255f, 0.620425344f},
-std::array<float,2>{0.419980496f, 0.47989291f},
-std::array<float,2>{0.0212490428f, 0.775456727f},
-std::array<float,2>{0.904177785f, 0.206122056f},
-std::array<float,2>{0.953177392f, 0.703184545f},
-std::array<float,2>{0.0774223879f, 0.27455771f},
-std::array<float,2>{0.478130996f, 0.915653169f},
-std::array<float,2>{0.610391974f, 0.00652127853f},
-std::array<float,2>{0.712399423f, 0.85512501f},
-std::array<float,2>{0.304938227f, 0.155984208f},
-std::array<float,2>{0.164075434f, 0.546388686f},
-std::array<float,2>{0.850865662f, 0.428089738f},
-std::array<float,2>{0.870825231f, 0.83984834f},
-std::array<float,2>{0.184372336f, 0.184737191f},
-std::array<float,2>{0.295234263f, 0.524409533f},
-std::array<float,2>{0.702440679f, 0.38617152f},
-std::array<float,2>{0.60147661f, 0.728753805f},
-std::array<float,2>{0.489290029f, 0.303390294f},
-std::array<float,2>{0.0794252157f, 0.902985454f},
-std::array<float,2>{0.937703848f, 0.0406159908f},
-std::array<float,2>{0.879107714f, 0.573472381f},
-std::array<float,2>{0.00552559132f, 0.441682637f},
-std::array<float,2>{0.42882967f, 0.796545267f},
-std::array<float,2>{0.518622696f, 0.230043545f},
-std::array<float,2>{0.630216122f, 0.938090622f},
-std::array<float,2>{0.35164696f, 0.0732821375f},
-std::array<float,2>{0.24749285f, 0.678269386f},
-std::array<float,2>{0.804112494f, 0.315984935f},
-std::array<float,2>{0.993136466f, 0.925120533f},
-std::array<float,2>{0.106159329f, 0.0281161871f},
-std::array<float,2>{0.468425184f, 0.701386213f},
-std::array<float,2>{0.56694442f, 0.253382802f},
-std::array<float,2>{0.737594247f, 0.556514442f},
-std::array<float,2>{0.25900501f, 0.415173203f},
-std::array<float,2>{0.153256819f, 0.87015748f},
-std::array<float,2>{0.818701386f, 0.130143836f},
-std::array<float,2>{0.753470838f, 0.640958428f},
-std::array<float,2>{0.192241803f, 0.368187457f},
-std::array<float,2>{0.340988308f, 0.977544427f},
-std::array<float,2>{0.677460432f, 0.0994732305f},
-std::array<float,2>{0.533399582f, 0.751398206f},
-std::array<float,2>{0.379570812f, 0.202443019f},
-std::array<float,2>{0.038192559f, 0.596817672f},
-std::array<float,2>{0.909978151f, 0.490007252f},
-std::array<float,2>{0.935719371f, 0.838436365f},
-std::array<float,2>{0.0525520667f, 0.182706907f},
-std::array<float,2>{0.395162731f, 0.528994143f},
-std::array<float,2>{0.561611593f, 0.387013465f},
-std::array<float,2>{0.667939901f, 0.731455803f},
-std::array<float,2>{0.322464556f, 0.300230682f},
-std::array<float,2>{0.211821944f, 0.902211249f},
-std::array<float,2>{0.772996068f, 0.045318909f},
-std::array<float,2>{0.835897207f, 0.577894747f},
-std::array<float,2>{0.128825366f, 0.438495576f},
-std::array<float,2>{0.279865772f, 0.790866435f},
-std::array<float,2>{0.725676775f, 0.232701868f},
-std::array<float,2>{0.580428004f, 0.944715917f},
-std::array<float,2>{0.451224536f, 0.0757986903f},
-std::array<float,2>{0.118214518f, 0.674488306f},
-std::array<float,2>{0.971992016f, 0.317144185f},
-std::array<float,2>{0.78806591f, 0.928625882f},
-std::array<float,2>{0.225166515f, 0.0265154857f},
-std::array<float,2>{0.372757941f, 0.696411014f},
-std::array<float,2>{0.642020822f, 0.256515771f},
-std::array<float,2>{0.506220818f, 0.559715211f},
-std::array<float,2>{0.410594851f, 0.418202668f},
-std::array<float,2>{0.0295739342f, 0.873119414f},
-std::array<float,2>{0.891041517f, 0.127908766f},
-std::array<float,2>{0.965637684f, 0.648351192f},
-std::array<float,2>{0.0629103184f, 0.372605324f},
-std::array<float,2>{0.470679671f, 0.983127892f},
-std::array<float,2>{0.620137572f, 0.0954067111f},
-std::array<float,2>{0.709146857f, 0.757272184f},
-std::array<float,2>{0.301727891f, 0.198181406f},
-std::array<float,2>{0.162182882f, 0.601547122f},
-std::array<float,2>{0.857864022f, 0.48448649f},
-std::array<float,2>{0.86294651f, 0.800838113f},
-std::array<float,2>{0.177484751f, 0.246636584f},
-std::array<float,2>{0.283170521f, 0.57927388f},
-std::array<float,2>{0.690343559f, 0.463498563f},
-std::array<float,2>{0.602123141f, 0.664998293f},
-std::array<float,2>{0.499343276f, 0.335047454f},
-std::array<float,2>{0.0883314088f, 0.962840855f},
-std::array<float,2>{0.953011751f, 0.0907813609f},
-std::array<float,2>{0.887770474f, 0.508699894f},
-std::array<float,2>{0.00969123468f, 0.390949041f},
-std::array<float,2>{0.436284184f, 0.819224656f},
-std::array<float,2>{0.529704154f, 0.170304582f},
-std::array<float,2>{0.635572731f, 0.88068217f},
-std::array<float,2>{0.350292712f, 0.0520939827f},
-std::array<float,2>{0.238518938f, 0.749290049f},
-std::array<float,2>{0.810719848f, 0.291918606f},
-std::array<float,2>{0.991239965f, 0.997787118f},
-std::array<float,2>{0.0990662277f, 0.121635519f},
-std::array<float,2>{0.458263904f, 0.625256419f},
-std::array<float,2>{0.574544549f, 0.349824041f},
-std::array<float,2>{0.743039012f, 0.622827947f},
-std::array<float,2>{0.255657017f, 0.483203679f},
-std::array<float,2>{0.14086841f, 0.778961241f},
-std::array<float,2>{0.826733887f, 0.207199499f},
-std::array<float,2>{0.757857323f, 0.708894789f},
-std::array<float,2>{0.196954951f, 0.280502647f},
-std::array<float,2>{0.331988156f, 0.919557989f},
-std::array<float,2>{0.683632731f, 0.00301277637f},
-std::array<float,2>{0.542277038f, 0.857620597f},
-std::array<float,2>{0.387465f, 0.151723579f},
-std::array<float,2>{0.0418186486f, 0.540058672f},
-std::array<float,2>{0.916421413f, 0.423338056f},
-std::array<float,2>{0.941659272f, 0.771779239f},
-std::array<float,2>{0.0827712789f, 0.218736112f},
-std::array<float,2>{0.486051202f, 0.611991405f},
-std::array<float,2>{0.596658587f, 0.47018525f},
-std::array<float,2>{0.696352541f, 0.635540485f},
-std::array<float,2>{0.292963326f, 0.354257107f},
-std::array<float,2>{0.180043548f, 0.989118695f},
-std::array<float,2>{0.874885857f, 0.109821156f},
-std::array<float,2>{0.799460113f, 0.534007132f},
-std::array<float,2>{0.245935678f, 0.433999658f},
-std::array<float,2>{0.357517332f, 0.846378386f},
-std::array<float,2>{0.625874043f, 0.146743029f},
-std::array<float,2>{0.520448387f, 0.911341012f},
-std::array<float,2>{0.423226446f, 0.00859410968f},
-std::array<float,2>{0.000924983935f, 0.710950732f},
-std::array<float,2>{0.876467228f, 0.272679865f},
-std::array<float,2>{0.814116836f, 0.958497226f},
-std::array<float,2>{0.151387364f, 0.0802891627f},
-std::array<float,2>{0.264901698f, 0.662486136f},
-std::array<float,2>{0.739754617f, 0.336344689f},
-std::array<float,2>{0.562945485f, 0.58905822f},
-std::array<float,2>{0.462458193f, 0.457350254f},
-std::array<float,2>{0.102556057f, 0.810997069f},
-std::array<float,2>{0.997612417f, 0.234433517f},
-std::array<float,2>{0.911056757f, 0.738279343f},
-std::array<float,2>{0.0336048715f, 0.282006711f},
-std::array<float,2>{0.375020385f, 0.884443045f},
-std::array<float,2>{0.536775231f, 0.0590009615f},
-std::array<float,2>{0.673565745f, 0.82418102f},
-std::array<float,2>{0.336844027f, 0.163037434f},
-std::array<float,2>{0.187572554f, 0.503462672f},
-std::array<float,2>{0.756424665f, 0.400948048f},
-std::array<float,2>{0.780021787f, 0.864930391f},
-std::array<float,2>{0.203480825f, 0.137794793f},
-std::array<float,2>{0.312668473f, 0.5473212f},
-std::array<float,2>{0.659655333f, 0.40838331f},
-std::array<float,2>{0.554299951f, 0.687653899f},
-std::array<float,2>{0.403630197f, 0.26156047f},
-std::array<float,2>{0.0618463531f, 0.932270348f},
-std::array<float,2>{0.923300922f, 0.0167610981f},
-std::array<float,2>{0.977422059f, 0.601960897f},
-std::array<float,2>{0.111499093f, 0.492805481f},
-std::array<float,2>{0.445153236f, 0.762877882f},
-std::array<float,2>{0.592000306f, 0.19110918f},
-std::array<float,2>{0.727831185f, 0.970963895f},
-std::array<float,2>{0.27142629f, 0.106369562f},
-std::array<float,2>{0.136509672f, 0.651961148f},
-std::array<float,2>{0.836034775f, 0.366784513f},
-std::array<float,2>{0.901782274f, 0.895691574f},
-std::array<float,2>{0.0193865336f, 0.0390624888f},
-std::array<float,2>{0.416581482f, 0.720126867f},
-std::array<float,2>{0.513339579f, 0.307459831f},
-std::array<float,2>{0.651185036f, 0.519024134f},
-std::array<float,2>{0.361881047f, 0.380192548f},
-std::array<float,2>{0.230719462f, 0.831549346f},
-std::array<float,2>{0.790845573f, 0.17269206f},
-std::array<float,2>{0.846322656f, 0.686480761f},
-std::array<float,2>{0.1684324f, 0.324898839f},
-std::array<float,2>{0.310999513f, 0.949392736f},
-std::array<float,2>{0.718388975f, 0.0672986805f},
-std::array<float,2>{0.616920948f, 0.783948421f},
-std::array<float,2>{0.483235955f, 0.225214109f},
-std::array<float,2>{0.0738544762f, 0.56441021f},
-std::array<float,2>{0.958664715f, 0.451282293f},
-std::array<float,2>{0.976252437f, 0.848660648f},
-std::array<float,2>{0.124657154f, 0.144319072f},
-std::array<float,2>{0.44707641f, 0.538579524f},
-std::array<float,2>{0.582320273f, 0.431351334f},
-std::array<float,2>{0.721762896f, 0.718509376f},
-std::array<float,2>{0.275761068f, 0.269485205f},
-std::array<float,2>{0.129806221f, 0.906958401f},
-std::array<float,2>{0.831885457f, 0.0124471337f},
-std::array<float,2>{0.768698812f, 0.615993619f},
-std::array<float,2>{0.216624483f, 0.47459659f},
-std::array<float,2>{0.32692039f, 0.76923883f},
-std::array<float,2>{0.670017779f, 0.214372039f},
-std::array<float,2>{0.554836512f, 0.985496998f},
-std::array<float,2>{0.39119035f, 0.114733487f},
-std::array<float,2>{0.0499691218f, 0.640034556f},
-std::array<float,2>{0.930593789f, 0.357339501f},
-std::array<float,2>{0.854214728f, 0.886854708f},
-std::array<float,2>{0.159638777f, 0.0570883006f},
-std::array<float,2>{0.297177911f, 0.738717258f},
-std::array<float,2>{0.703192055f, 0.288765967f},
-std::array<float,2>{0.622570157f, 0.505547762f},
-std::array<float,2>{0.474610567f, 0.405842274f},
-std::array<float,2>{0.0684659332f, 0.825313985f},
-std::array<float,2>{0.96412015f, 0.156396553f},
-std::array<float,2>{0.894631982f, 0.656865299f},
-std::array<float,2>{0.0238417611f, 0.343040407f},
-std::array<float,2>{0.408047765f, 0.955414116f},
-std::array<float,2>{0.500300646f, 0.0855086818f},
-std::array<float,2>{0.644872069f, 0.806263328f},
-std::array<float,2>{0.369378328f, 0.238674119f},
-std::array<float,2>{0.221266896f, 0.590449572f},
-std::array<float,2>{0.783677816f, 0.45522809f},
-std::array<float,2>{0.805785716f, 0.758417368f},
-std::array<float,2>{0.235871375f, 0.195007682f},
-std::array<float,2>{0.346619576f, 0.606932163f},
-std::array<float,2>{0.640559793f, 0.496207237f},
-std::array<float,2>{0.526661456f, 0.654517293f},
-std::array<float,2>{0.432197183f, 0.362915039f},
-std::array<float,2>{0.0132678654f, 0.976011872f},
-std::array<float,2>{0.885347784f, 0.102504559f},
-std::array<float,2>{0.94823736f, 0.551091373f},
-std::array<float,2>{0.0917052925f, 0.412543595f},
-std::array<float,2>{0.494992197f, 0.862816274f},
-std::array<float,2>{0.606787026f, 0.132827997f},
-std::array<float,2>{0.695231318f, 0.934306264f},
-std::array<float,2>{0.285181016f, 0.0232077073f},
-std::array<float,2>{0.174838871f, 0.693538487f},
-std::array<float,2>{0.864742935f, 0.265208215f},
-std::array<float,2>{0.918927372f, 0.946282864f},
-std::array<float,2>{0.0456080101f, 0.0648357496f},
-std::array<float,2>{0.386603296f, 0.682155669f},
-std::array<float,2>{0.543075502f, 0.324006677f},
-std::array<float,2>{0.681051373f, 0.569319248f},
-std::array<float,2>{0.334750354f, 0.446181178f},
-std::array<float,2>{0.200452074f, 0.785475552f},
-std::array<float,2>{0.763210356f, 0.221308187f},
-std::array<float,2>{0.821517527f, 0.725924969f},
-std::array<float,2>{0.14749451f, 0.308853269f},
-std::array<float,2>{0.251161605f, 0.89220047f},
-std::array<float,2>{0.747911751f, 0.0314276554f},
-std::array<float,2>{0.57294476f, 0.835550547f},
-std::array<float,2>{0.454649001f, 0.176212251f},
-std::array<float,2>{0.0967322141f, 0.522505224f},
-std::array<float,2>{0.987443149f, 0.376491994f},
-std::array<float,2>{0.882642925f, 0.795145631f},
-std::array<float,2>{0.00701458473f, 0.228827104f},
-std::array<float,2>{0.426998556f, 0.572561145f},
-std::array<float,2>{0.516656578f, 0.442485124f},
-std::array<float,2>{0.631940842f, 0.678981185f},
-std::array<float,2>{0.354709387f, 0.31476897f},
-std::array<float,2>{0.249224097f, 0.938603163f},
-std::array<float,2>{0.802194297f, 0.0731565431f},
-std::array<float,2>{0.868446887f, 0.524906337f},
-std::array<float,2>{0.187054366f, 0.385601372f},
-std::array<float,2>{0.294461221f, 0.841494024f},
-std::array<float,2>{0.700086415f, 0.184469759f},
-std::array<float,2>{0.597993851f, 0.903354406f},
-std::array<float,2>{0.490236402f, 0.0397780612f},
-std::array<float,2>{0.0812785104f, 0.7303828f},
-std::array<float,2>{0.940371275f, 0.304044634f},
-std::array<float,2>{0.751010597f, 0.97746855f},
-std::array<float,2>{0.194660798f, 0.0978281423f},
-std::array<float,2>{0.342359066f, 0.642405748f},
-std::array<float,2>{0.678953886f, 0.367552847f},
-std::array<float,2>{0.531477213f, 0.596625745f},
-std::array<float,2>{0.382032692f, 0.488620251f},
-std::array<float,2>{0.0360002555f, 0.750710428f},
-std::array<float,2>{0.907417297f, 0.202106059f},
-std::array<float,2>{0.994206786f, 0.702629805f},
-std::array<float,2>{0.107480519f, 0.25277555f},
-std::array<float,2>{0.466246486f, 0.924326777f},
-std::array<float,2>{0.569709003f, 0.0290335827f},
-std::array<float,2>{0.735732079f, 0.86938405f},
-std::array<float,2>{0.260543019f, 0.129292101f},
-std::array<float,2>{0.155365705f, 0.55491966f},
-std::array<float,2>{0.816937685f, 0.414225072f},
-std::array<float,2>{0.843461573f, 0.812537789f},
-std::array<float,2>{0.139104247f, 0.16557999f},
-std::array<float,2>{0.268652797f, 0.515024662f},
-std::array<float,2>{0.732185781f, 0.396557063f},
-std::array<float,2>{0.588275671f, 0.74450624f},
-std::array<float,2>{0.43967846f, 0.29367578f},
-std::array<float,2>{0.114609495f, 0.87712723f},
-std::array<float,2>{0.984039307f, 0.04973704f},
-std::array<float,2>{0.929456949f, 0.585450113f},
-std::array<float,2>{0.0555648468f, 0.468329608f},
-std::array<float,2>{0.400394082f, 0.798918486f},
-std::array<float,2>{0.547002733f, 0.24243778f},
-std::array<float,2>{0.66031462f, 0.965468168f},
-std::array<float,2>{0.318161756f, 0.0878760517f},
-std::array<float,2>{0.209008709f, 0.668102443f},
-std::array<float,2>{0.77482754f, 0.331877887f},
-std::array<float,2>{0.956846297f, 0.914202809f},
-std::array<float,2>{0.0748548508f, 0.00776125351f},
-std::array<float,2>{0.479771972f, 0.704140902f},
-std::array<float,2>{0.612587392f, 0.273629904f},
-std::array<float,2>{0.71475637f, 0.54573369f},
-std::array<float,2>{0.307862759f, 0.429378062f},
-std::array<float,2>{0.167683825f, 0.853919446f},
-std::array<float,2>{0.84805119f, 0.154966161f},
-std::array<float,2>{0.794369817f, 0.630332768f},
-std::array<float,2>{0.229339778f, 0.344925433f},
-std::array<float,2>{0.365526289f, 0.994491637f},
-std::array<float,2>{0.655783713f, 0.121036239f},
-std::array<float,2>{0.508081436f, 0.776890635f},
-std::array<float,2>{0.41950658f, 0.205577552f},
-std::array<float,2>{0.0232286826f, 0.619475007f},
-std::array<float,2>{0.905133128f, 0.478661269f},
-std::array<float,2>{0.892980814f, 0.872748315f},
-std::array<float,2>{0.0291718915f, 0.12589635f},
-std::array<float,2>{0.41361919f, 0.562447667f},
-std::array<float,2>{0.505530953f, 0.420958459f},
-std::array<float,2>{0.643088043f, 0.698060215f},
-std::array<float,2>{0.374915242f, 0.255718917f},
-std::array<float,2>{0.222813874f, 0.925988019f},
-std::array<float,2>{0.786855876f, 0.0252489857f},
-std::array<float,2>{0.856990039f, 0.599112868f},
-std::array<float,2>{0.161403745f, 0.486878604f},
-std::array<float,2>{0.303907365f, 0.75500989f},
-std::array<float,2>{0.707036316f, 0.19714509f},
-std::array<float,2>{0.618929684f, 0.980692267f},
-std::array<float,2>{0.471587062f, 0.0973395705f},
-std::array<float,2>{0.0661609843f, 0.645497799f},
-std::array<float,2>{0.966979384f, 0.374105901f},
-std::array<float,2>{0.770544052f, 0.89846462f},
-std::array<float,2>{0.214522123f, 0.0433876961f},
-std::array<float,2>{0.321318954f, 0.733323753f},
-std::array<float,2>{0.665759623f, 0.297369421f},
-std::array<float,2>{0.560033679f, 0.530654311f},
-std::array<float,2>{0.398125589f, 0.388679236f},
-std::array<float,2>{0.0539359562f, 0.836086869f},
-std::array<float,2>{0.934087873f, 0.181256548f},
-std::array<float,2>{0.96910429f, 0.673194647f},
-std::array<float,2>{0.119598694f, 0.319499344f},
-std::array<float,2>{0.450355828f, 0.94274056f},
-std::array<float,2>{0.579498172f, 0.07794898f},
-std::array<float,2>{0.724565506f, 0.791145325f},
-std::array<float,2>{0.277926713f, 0.231297791f},
-std::array<float,2>{0.126274377f, 0.575584352f},
-std::array<float,2>{0.832043409f, 0.440697908f},
-std::array<float,2>{0.824223459f, 0.779665232f},
-std::array<float,2>{0.143029168f, 0.209949926f},
-std::array<float,2>{0.256093562f, 0.624308527f},
-std::array<float,2>{0.745462954f, 0.481986612f},
-std::array<float,2>{0.577766776f, 0.62867409f},
-std::array<float,2>{0.459896743f, 0.347661525f},
-std::array<float,2>{0.100804053f, 0.999172926f},
-std::array<float,2>{0.98893106f, 0.123996273f},
-std::array<float,2>{0.915199161f, 0.541315854f},
-std::array<float,2>{0.0403046571f, 0.425779581f},
-std::array<float,2>{0.389419973f, 0.856579483f},
-std::array<float,2>{0.540222526f, 0.149099752f},
-std::array<float,2>{0.686260641f, 0.921294928f},
-std::array<float,2>{0.329920471f, 0.00102185411f},
-std::array<float,2>{0.198244274f, 0.709468186f},
-std::array<float,2>{0.760335267f, 0.279096186f},
-std::array<float,2>{0.950938761f, 0.964636981f},
-std::array<float,2>{0.0873870626f, 0.0934236944f},
-std::array<float,2>{0.496435195f, 0.667089641f},
-std::array<float,2>{0.604224741f, 0.332068205f},
-std::array<float,2>{0.688203454f, 0.58177793f},
-std::array<float,2>{0.284286588f, 0.461806417f},
-std::array<float,2>{0.179159403f, 0.8035025f},
-std::array<float,2>{0.860451102f, 0.249853536f},
-std::array<float,2>{0.809301913f, 0.747120202f},
-std::array<float,2>{0.240381405f, 0.289181739f},
-std::array<float,2>{0.348802328f, 0.881614327f},
-std::array<float,2>{0.634738982f, 0.0544230789f},
-std::array<float,2>{0.52752018f, 0.818154931f},
-std::array<float,2>{0.435237408f, 0.168168366f},
-std::array<float,2>{0.0106438845f, 0.510658801f},
-std::array<float,2>{0.889548421f, 0.394060135f},
-std::array<float,2>{0.998609483f, 0.81008935f},
-std::array<float,2>{0.103902929f, 0.237303704f},
-std::array<float,2>{0.464087397f, 0.58665818f},
-std::array<float,2>{0.564658403f, 0.460855335f},
-std::array<float,2>{0.74116683f, 0.660208106f},
-std::array<float,2>{0.262786657f, 0.339181423f},
-std::array<float,2>{0.14923504f, 0.960235715f},
-std::array<float,2>{0.816035748f, 0.0782371908f},
-std::array<float,2>{0.75447607f, 0.500299215f},
-std::array<float,2>{0.191377819f, 0.398730725f},
-std::array<float,2>{0.339427441f, 0.821860969f},
-std::array<float,2>{0.675285041f, 0.161137611f},
-std::array<float,2>{0.537769377f, 0.886473775f},
-std::array<float,2>{0.378687173f, 0.061643742f},
-std::array<float,2>{0.031708248f, 0.735995948f},
-std::array<float,2>{0.913895488f, 0.284186423f},
-std::array<float,2>{0.872570515f, 0.990575016f},
-std::array<float,2>{0.18236196f, 0.113186114f},
-std::array<float,2>{0.290716678f, 0.633765459f},
-std::array<float,2>{0.697916508f, 0.353101999f},
-std::array<float,2>{0.595550478f, 0.609988272f},
-std::array<float,2>{0.487013131f, 0.471804112f},
-std::array<float,2>{0.0846292749f, 0.76957494f},
-std::array<float,2>{0.943739951f, 0.215321943f},
-std::array<float,2>{0.877370059f, 0.713291109f},
-std::array<float,2>{0.00203697989f, 0.269848377f},
-std::array<float,2>{0.424396902f, 0.912471235f},
-std::array<float,2>{0.522331417f, 0.0109386807f},
-std::array<float,2>{0.627302349f, 0.844466627f},
-std::array<float,2>{0.356016278f, 0.145483091f},
-std::array<float,2>{0.243674994f, 0.531386435f},
-std::array<float,2>{0.798060834f, 0.437262326f},
-std::array<float,2>{0.791457474f, 0.828185856f},
-std::array<float,2>{0.232912123f, 0.174949422f},
-std::array<float,2>{0.359760225f, 0.516620874f},
-std::array<float,2>{0.648645997f, 0.382755131f},
-std::array<float,2>{0.514894664f, 0.722182155f},
-std::array<float,2>{0.414526284f, 0.306125343f},
-std::array<float,2>{0.0157489851f, 0.896988153f},
-std::array<float,2>{0.900201619f, 0.0365714058f},
-std::array<float,2>{0.959309161f, 0.565211356f},
-std::array<float,2>{0.0711329058f, 0.450304419f},
-std::array<float,2>{0.482103974f, 0.781777799f},
-std::array<float,2>{0.613319635f, 0.223550037f},
-std::array<float,2>{0.716559649f, 0.95229286f},
-std::array<float,2>{0.309114307f, 0.0696787015f},
-std::array<float,2>{0.170022368f, 0.684474289f},
-std::array<float,2>{0.845699489f, 0.326757729f},
-std::array<float,2>{0.924772263f, 0.929900944f},
-std::array<float,2>{0.0595898777f, 0.0184767377f},
-std::array<float,2>{0.404878557f, 0.690744102f},
-std::array<float,2>{0.552192509f, 0.259424776f},
-std::array<float,2>{0.657528281f, 0.550344348f},
-std::array<float,2>{0.314642131f, 0.406374931f},
-std::array<float,2>{0.205674842f, 0.866205573f},
-std::array<float,2>{0.778644621f, 0.13988407f},
-std::array<float,2>{0.839691639f, 0.649739087f},
-std::array<float,2>{0.133704513f, 0.363428652f},
-std::array<float,2>{0.271836668f, 0.970009983f},
-std::array<float,2>{0.729936481f, 0.10903345f},
-std::array<float,2>{0.591288507f, 0.763915479f},
-std::array<float,2>{0.441546082f, 0.187827051f},
-std::array<float,2>{0.109506249f, 0.604650438f},
-std::array<float,2>{0.978673577f, 0.495934039f},
-std::array<float,2>{0.96275872f, 0.828059793f},
-std::array<float,2>{0.0680717677f, 0.159634411f},
-std::array<float,2>{0.473879784f, 0.506684721f},
-std::array<float,2>{0.624119282f, 0.402922869f},
-std::array<float,2>{0.705547631f, 0.740996718f},
-std::array<float,2>{0.299369574f, 0.285904109f},
-std::array<float,2>{0.157396153f, 0.890173733f},
-std::array<float,2>{0.852599502f, 0.0552229956f},
-std::array<float,2>{0.781702161f, 0.592307389f},
-std::array<float,2>{0.220374703f, 0.454134226f},
-std::array<float,2>{0.368344337f, 0.807999671f},
-std::array<float,2>{0.646843076f, 0.240439221f},
-std::array<float,2>{0.503183722f, 0.953816295f},
-std::array<float,2>{0.409197092f, 0.0826768652f},
-std::array<float,2>{0.0270867627f, 0.660021067f},
-std::array<float,2>{0.897808373f, 0.340005428f},
-std::array<float,2>{0.829191983f, 0.909013629f},
-std::array<float,2>{0.132766113f, 0.0145214396f},
-std::array<float,2>{0.273761243f, 0.715576768f},
-std::array<float,2>{0.719549596f, 0.266463339f},
-std::array<float,2>{0.584015489f, 0.536746144f},
-std::array<float,2>{0.449102342f, 0.433133781f},
-std::array<float,2>{0.12208131f, 0.851023734f},
-std::array<float,2>{0.974358082f, 0.141517252f},
-std::array<float,2>{0.931915998f, 0.637788951f},
-std::array<float,2>{0.04781048f, 0.357601613f},
-std::array<float,2>{0.394311965f, 0.986668468f},
-std::array<float,2>{0.557183027f, 0.116529278f},
-std::array<float,2>{0.66985029f, 0.767040253f},
-std::array<float,2>{0.325067699f, 0.212425441f},
-std::array<float,2>{0.218080804f, 0.613939047f},
-std::array<float,2>{0.767275035f, 0.475973725f},
-std::array<float,2>{0.764930248f, 0.788238823f},
-std::array<float,2>{0.202025875f, 0.220633209f},
-std::array<float,2>{0.332414299f, 0.567830026f},
-std::array<float,2>{0.68220222f, 0.449216247f},
-std::array<float,2>{0.546803415f, 0.680703521f},
-std::array<float,2>{0.383138806f, 0.321772873f},
-std::array<float,2>{0.0434169322f, 0.949097157f},
-std::array<float,2>{0.920193613f, 0.0634091198f},
-std::array<float,2>{0.984687686f, 0.519867718f},
-std::array<float,2>{0.0948823914f, 0.377345204f},
-std::array<float,2>{0.455727279f, 0.833614528f},
-std::array<float,2>{0.571422219f, 0.179508358f},
-std::array<float,2>{0.74890846f, 0.892800391f},
-std::array<float,2>{0.253706783f, 0.0333284661f},
-std::array<float,2>{0.14559713f, 0.723487318f},
-std::array<float,2>{0.823958814f, 0.311739743f},
-std::array<float,2>{0.883404016f, 0.97271955f},
-std::array<float,2>{0.0146059152f, 0.103551812f},
-std::array<float,2>{0.43096292f, 0.652837574f},
-std::array<float,2>{0.524040282f, 0.360910892f},
-std::array<float,2>{0.638201535f, 0.609205425f},
-std::array<float,2>{0.345500112f, 0.4984366f},
-std::array<float,2>{0.23729381f, 0.760487318f},
-std::array<float,2>{0.807466149f, 0.192906573f},
-std::array<float,2>{0.867092848f, 0.691662133f},
-std::array<float,2>{0.172180876f, 0.262029439f},
-std::array<float,2>{0.287200034f, 0.935726047f},
-std::array<float,2>{0.692656755f, 0.0199751761f},
-std::array<float,2>{0.608972013f, 0.860072017f},
-std::array<float,2>{0.493997306f, 0.13497594f},
-std::array<float,2>{0.0927727744f, 0.553858995f},
-std::array<float,2>{0.94714582f, 0.410913169f},
-std::array<float,2>{0.908656001f, 0.753340483f},
-std::array<float,2>{0.0380094051f, 0.199741274f},
-std::array<float,2>{0.380017161f, 0.594611824f},
-std::array<float,2>{0.534903824f, 0.490477264f},
-std::array<float,2>{0.676412284f, 0.64447403f},
-std::array<float,2>{0.340162992f, 0.370625854f},
-std::array<float,2>{0.193075225f, 0.979885101f},
-std::array<float,2>{0.75288403f, 0.0997069627f},
-std::array<float,2>{0.819519222f, 0.558499932f},
-std::array<float,2>{0.154015347f, 0.417654514f},
-std::array<float,2>{0.258371204f, 0.868183553f},
-std::array<float,2>{0.736908674f, 0.131596103f},
-std::array<float,2>{0.567734718f, 0.922568083f},
-std::array<float,2>{0.467417479f, 0.0304180849f},
-std::array<float,2>{0.106673367f, 0.699614406f},
-std::array<float,2>{0.993302405f, 0.250895768f},
-std::array<float,2>{0.803370118f, 0.940137208f},
-std::array<float,2>{0.246094033f, 0.0715030059f},
-std::array<float,2>{0.353106081f, 0.676240623f},
-std::array<float,2>{0.629783452f, 0.314227015f},
-std::array<float,2>{0.517991304f, 0.571493566f},
-std::array<float,2>{0.428299159f, 0.444068253f},
-std::array<float,2>{0.00483899144f, 0.793625176f},
-std::array<float,2>{0.879975498f, 0.226633117f},
-std::array<float,2>{0.938510776f, 0.726976752f},
-std::array<float,2>{0.0782262236f, 0.301273972f},
-std::array<float,2>{0.488791198f, 0.904975057f},
-std::array<float,2>{0.600100398f, 0.0419538021f},
-std::array<float,2>{0.701617241f, 0.843576968f},
-std::array<float,2>{0.29620564f, 0.186975345f},
-std::array<float,2>{0.185528204f, 0.527282178f},
-std::array<float,2>{0.869991243f, 0.384319335f},
-std::array<float,2>{0.850112915f, 0.85340327f},
-std::array<float,2>{0.166009218f, 0.152462661f},
-std::array<float,2>{0.306124508f, 0.543049932f},
-std::array<float,2>{0.711450458f, 0.425837934f},
-std::array<float,2>{0.609645128f, 0.705816865f},
-std::array<float,2>{0.477278829f, 0.276100665f},
-std::array<float,2>{0.0767022148f, 0.916485786f},
-std::array<float,2>{0.954950452f, 0.00438840128f},
-std::array<float,2>{0.902513564f, 0.618589997f},
-std::array<float,2>{0.0195802432f, 0.47808975f},
-std::array<float,2>{0.421714902f, 0.77522701f},
-std::array<float,2>{0.511126518f, 0.203633949f},
-std::array<float,2>{0.653589964f, 0.993462265f},
-std::array<float,2>{0.364790529f, 0.11789088f},
-std::array<float,2>{0.22684662f, 0.632071435f},
-std::array<float,2>{0.795697391f, 0.34738639f},
-std::array<float,2>{0.981118858f, 0.876832426f},
-std::array<float,2>{0.115802616f, 0.0474700369f},
-std::array<float,2>{0.438665837f, 0.742843986f},
-std::array<float,2>{0.586710453f, 0.296129555f},
-std::array<float,2>{0.733423471f, 0.512109935f},
-std::array<float,2>{0.26663819f, 0.395621926f},
-std::array<float,2>{0.138453096f, 0.814524472f},
-std::array<float,2>{0.841652334f, 0.167872086f},
-std::array<float,2>{0.775533855f, 0.671575248f},
-std::array<float,2>{0.207106531f, 0.329708129f},
-std::array<float,2>{0.319006145f, 0.968197703f},
-std::array<float,2>{0.663014174f, 0.0897237882f},
-std::array<float,2>{0.550326645f, 0.796950519f},
-std::array<float,2>{0.39924404f, 0.245825499f},
-std::array<float,2>{0.0575747751f, 0.583278179f},
-std::array<float,2>{0.926971197f, 0.466108501f},
-std::array<float,2>{0.930210114f, 0.849834681f},
-std::array<float,2>{0.0500635244f, 0.141907766f},
-std::array<float,2>{0.391479641f, 0.535348773f},
-std::array<float,2>{0.555147767f, 0.431773752f},
-std::array<float,2>{0.670273125f, 0.71629101f},
-std::array<float,2>{0.326771349f, 0.267190129f},
-std::array<float,2>{0.216504425f, 0.909569323f},
-std::array<float,2>{0.768992305f, 0.0152565632f},
-std::array<float,2>{0.83161968f, 0.614975095f},
-std::array<float,2>{0.129396006f, 0.474670589f},
-std::array<float,2>{0.275482744f, 0.766311228f},
-std::array<float,2>{0.722079456f, 0.211660013f},
-std::array<float,2>{0.582157552f, 0.987436712f},
-std::array<float,2>{0.447002292f, 0.116106465f},
-std::array<float,2>{0.124997526f, 0.636822343f},
-std::array<float,2>{0.976464093f, 0.359135866f},
-std::array<float,2>{0.783408046f, 0.888992131f},
-std::array<float,2>{0.221607834f, 0.0561252199f},
-std::array<float,2>{0.369429767f, 0.74164629f},
-std::array<float,2>{0.644687593f, 0.286620885f},
-std::array<float,2>{0.500045717f, 0.507486403f},
-std::array<float,2>{0.407768995f, 0.403650135f},
-std::array<float,2>{0.0235669427f, 0.827029586f},
-std::array<float,2>{0.894909382f, 0.158875003f},
-std::array<float,2>{0.963922143f, 0.658741415f},
-std::array<float,2>{0.0688014925f, 0.340951324f},
-std::array<float,2>{0.475043744f, 0.954509318f},
-std::array<float,2>{0.622834623f, 0.0832181796f},
-std::array<float,2>{0.703478992f, 0.80755049f},
-std::array<float,2>{0.2970635f, 0.241422936f},
-std::array<float,2>{0.159232974f, 0.593206584f},
-std::array<float,2>{0.854348361f, 0.453454345f},
-std::array<float,2>{0.864304781f, 0.760870278f},
-std::array<float,2>{0.175107956f, 0.191578403f},
-std::array<float,2>{0.285516381f, 0.608358562f},
-std::array<float,2>{0.694986641f, 0.499247968f},
-std::array<float,2>{0.606602371f, 0.654235184f},
-std::array<float,2>{0.494638234f, 0.359402597f},
-std::array<float,2>{0.0914746299f, 0.974414408f},
-std::array<float,2>{0.94799751f, 0.104701541f},
-std::array<float,2>{0.885555387f, 0.552829087f},
-std::array<float,2>{0.0135896085f, 0.411234647f},
-std::array<float,2>{0.43249014f, 0.860597014f},
-std::array<float,2>{0.526382565f, 0.13608779f},
-std::array<float,2>{0.640284956f, 0.937016845f},
-std::array<float,2>{0.346379727f, 0.021085158f},
-std::array<float,2>{0.236108765f, 0.693285763f},
-std::array<float,2>{0.805957019f, 0.263550282f},
-std::array<float,2>{0.987654626f, 0.948042095f},
-std::array<float,2>{0.0971325934f, 0.0644503161f},
-std::array<float,2>{0.454865634f, 0.680223405f},
-std::array<float,2>{0.573141694f, 0.320485651f},
-std::array<float,2>{0.747795761f, 0.567036629f},
-std::array<float,2>{0.251414865f, 0.447742015f},
-std::array<float,2>{0.147930712f, 0.787854254f},
-std::array<float,2>{0.821723819f, 0.219205588f},
-std::array<float,2>{0.763559878f, 0.724050522f},
-std::array<float,2>{0.200251475f, 0.310672164f},
-std::array<float,2>{0.33455503f, 0.894044995f},
-std::array<float,2>{0.680874348f, 0.0347480178f},
-std::array<float,2>{0.543385863f, 0.832233369f},
-std::array<float,2>{0.3864384f, 0.178110063f},
-std::array<float,2>{0.0456611179f, 0.520624936f},
-std::array<float,2>{0.918490708f, 0.378489375f},
-std::array<float,2>{0.940141678f, 0.793996036f},
-std::array<float,2>{0.0813081935f, 0.227751672f},
-std::array<float,2>{0.490630746f, 0.570515215f},
-std::array<float,2>{0.597667575f, 0.444660217f},
-std::array<float,2>{0.699707448f, 0.677146196f},
-std::array<float,2>{0.294795424f, 0.31258449f},
-std::array<float,2>{0.187493399f, 0.940665007f},
-std::array<float,2>{0.868243992f, 0.070779942f},
-std::array<float,2>{0.80189085f, 0.525522768f},
-std::array<float,2>{0.249484017f, 0.382846624f},
-std::array<float,2>{0.354895979f, 0.842690587f},
-std::array<float,2>{0.632129669f, 0.18593967f},
-std::array<float,2>{0.517028272f, 0.905939877f},
-std::array<float,2>{0.427088469f, 0.0427648313f},
-std::array<float,2>{0.00728187989f, 0.727837741f},
-std::array<float,2>{0.882381976f, 0.302675158f},
-std::array<float,2>{0.817299306f, 0.979486465f},
-std::array<float,2>{0.155586928f, 0.100694388f},
-std::array<float,2>{0.260435164f, 0.643526852f},
-std::array<float,2>{0.735530436f, 0.36981377f},
-std::array<float,2>{0.569351852f, 0.595187187f},
-std::array<float,2>{0.465887815f, 0.491638035f},
-std::array<float,2>{0.107853979f, 0.751966476f},
-std::array<float,2>{0.994398832f, 0.20096612f},
-std::array<float,2>{0.907646239f, 0.7009902f},
-std::array<float,2>{0.0356957279f, 0.251796454f},
-std::array<float,2>{0.38227582f, 0.92345655f},
-std::array<float,2>{0.531509399f, 0.0300342347f},
-std::array<float,2>{0.679015577f, 0.867359698f},
-std::array<float,2>{0.342584133f, 0.132577658f},
-std::array<float,2>{0.194428712f, 0.557513535f},
-std::array<float,2>{0.751335025f, 0.41678831f},
-std::array<float,2>{0.774431765f, 0.816030443f},
-std::array<float,2>{0.209246144f, 0.166713014f},
-std::array<float,2>{0.317972779f, 0.513102889f},
-std::array<float,2>{0.660509646f, 0.394795775f},
-std::array<float,2>{0.547212481f, 0.743990898f},
-std::array<float,2>{0.400730997f, 0.295850158f},
-std::array<float,2>{0.0552686863f, 0.875497699f},
-std::array<float,2>{0.92920351f, 0.0484851003f},
-std::array<float,2>{0.984232783f, 0.582424998f},
-std::array<float,2>{0.114439353f, 0.465657443f},
-std::array<float,2>{0.439896971f, 0.798719466f},
-std::array<float,2>{0.587978542f, 0.24479197f},
-std::array<float,2>{0.731941998f, 0.967683256f},
-std::array<float,2>{0.268838286f, 0.088254109f},
-std::array<float,2>{0.138808936f, 0.670840442f},
-std::array<float,2>{0.843600094f, 0.328782767f},
-std::array<float,2>{0.904983222f, 0.917011559f},
-std::array<float,2>{0.0230929498f, 0.00550457463f},
-std::array<float,2>{0.419833571f, 0.706305683f},
-std::array<float,2>{0.507926762f, 0.276838958f},
-std::array<float,2>{0.656019807f, 0.544786096f},
-std::array<float,2>{0.365345418f, 0.427524507f},
-std::array<float,2>{0.229221329f, 0.85220933f},
-std::array<float,2>{0.793995619f, 0.15371123f},
-std::array<float,2>{0.847709f, 0.631479859f},
-std::array<float,2>{0.167770445f, 0.34656176f},
-std::array<float,2>{0.307665825f, 0.99223882f},
-std::array<float,2>{0.714586556f, 0.118507221f},
-std::array<float,2>{0.612480998f, 0.774285614f},
-std::array<float,2>{0.479584962f, 0.204806983f},
-std::array<float,2>{0.0749717429f, 0.618136585f},
-std::array<float,2>{0.956736743f, 0.477353245f},
-std::array<float,2>{0.97168231f, 0.836937726f},
-std::array<float,2>{0.118423015f, 0.180379018f},
-std::array<float,2>{0.451502383f, 0.529310167f},
-std::array<float,2>{0.580110431f, 0.39060533f},
-std::array<float,2>{0.725992084f, 0.733806551f},
-std::array<float,2>{0.280264974f, 0.298423469f},
-std::array<float,2>{0.128431633f, 0.900232255f},
-std::array<float,2>{0.83551842f, 0.0439896658f},
-std::array<float,2>{0.773237407f, 0.574690044f},
-std::array<float,2>{0.211504787f, 0.440170914f},
-std::array<float,2>{0.322628945f, 0.792370856f},
-std::array<float,2>{0.667625666f, 0.232178107f},
-std::array<float,2>{0.562010884f, 0.941901207f},
-std::array<float,2>{0.39550525f, 0.0763023198f},
-std::array<float,2>{0.0522863567f, 0.672442973f},
-std::array<float,2>{0.935800016f, 0.318801105f},
-std::array<float,2>{0.857480586f, 0.926943958f},
-std::array<float,2>{0.16249162f, 0.023831442f},
-std::array<float,2>{0.301286072f, 0.699153066f},
-std::array<float,2>{0.709380627f, 0.254415274f},
-std::array<float,2>{0.62037462f, 0.560712337f},
-std::array<float,2>{0.470388383f, 0.420210361f},
-std::array<float,2>{0.0626505166f, 0.872039437f},
-std::array<float,2>{0.965447009f, 0.126783162f},
-std::array<float,2>{0.890703321f, 0.645676136f},
-std::array<float,2>{0.029459212f, 0.373360902f},
-std::array<float,2>{0.410202801f, 0.981482863f},
-std::array<float,2>{0.505862534f, 0.0961623266f},
-std::array<float,2>{0.641784728f, 0.754163921f},
-std::array<float,2>{0.372809827f, 0.195546597f},
-std::array<float,2>{0.225557953f, 0.597669482f},
-std::array<float,2>{0.787726402f, 0.487607867f},
-std::array<float,2>{0.810801983f, 0.80450803f},
-std::array<float,2>{0.238625586f, 0.248355344f},
-std::array<float,2>{0.350442171f, 0.580094039f},
-std::array<float,2>{0.635389447f, 0.462829024f},
-std::array<float,2>{0.52938813f, 0.666794538f},
-std::array<float,2>{0.436116159f, 0.333332598f},
-std::array<float,2>{0.00946088694f, 0.963797212f},
-std::array<float,2>{0.888072729f, 0.0924386755f},
-std::array<float,2>{0.952664912f, 0.511145651f},
-std::array<float,2>{0.087927565f, 0.392816156f},
-std::array<float,2>{0.499202013f, 0.816582263f},
-std::array<float,2>{0.602520883f, 0.169002473f},
-std::array<float,2>{0.690171778f, 0.882708371f},
-std::array<float,2>{0.282864392f, 0.0531091578f},
-std::array<float,2>{0.177539587f, 0.74673754f},
-std::array<float,2>{0.863206923f, 0.290132552f},
-std::array<float,2>{0.916019797f, 0.99894315f},
-std::array<float,2>{0.0415888391f, 0.124871552f},
-std::array<float,2>{0.387209266f, 0.626966357f},
-std::array<float,2>{0.542228758f, 0.349564761f},
-std::array<float,2>{0.683963716f, 0.623526335f},
-std::array<float,2>{0.331608504f, 0.480714619f},
-std::array<float,2>{0.197121412f, 0.780667603f},
-std::array<float,2>{0.758106828f, 0.210007936f},
-std::array<float,2>{0.827103615f, 0.710428178f},
-std::array<float,2>{0.141014442f, 0.277453333f},
-std::array<float,2>{0.255421907f, 0.920545042f},
-std::array<float,2>{0.742775977f, 0.000658945064f},
-std::array<float,2>{0.574393213f, 0.855739117f},
-std::array<float,2>{0.458020478f, 0.149844125f},
-std::array<float,2>{0.0986455083f, 0.542935014f},
-std::array<float,2>{0.99169755f, 0.424173921f},
-std::array<float,2>{0.876772404f, 0.770895481f},
-std::array<float,2>{0.000558200292f, 0.21662347f},
-std::array<float,2>{0.423079908f, 0.610540688f},
-std::array<float,2>{0.520155787f, 0.470721573f},
-std::array<float,2>{0.625540435f, 0.634418309f},
-std::array<float,2>{0.35789001f, 0.351788551f},
-std::array<float,2>{0.245681778f, 0.991265535f},
-std::array<float,2>{0.79958272f, 0.112293266f},
-std::array<float,2>{0.874652207f, 0.532444119f},
-std::array<float,2>{0.179761112f, 0.435815901f},
-std::array<float,2>{0.292516559f, 0.844910741f},
-std::array<float,2>{0.696543694f, 0.14647907f},
-std::array<float,2>{0.596335232f, 0.913962424f},
-std::array<float,2>{0.486203671f, 0.00981263258f},
-std::array<float,2>{0.0825592875f, 0.713935137f},
-std::array<float,2>{0.941535711f, 0.270725042f},
-std::array<float,2>{0.756641984f, 0.959318817f},
-std::array<float,2>{0.187937438f, 0.0791350901f},
-std::array<float,2>{0.336540431f, 0.661732674f},
-std::array<float,2>{0.673783362f, 0.338491708f},
-std::array<float,2>{0.536998332f, 0.587478995f},
-std::array<float,2>{0.375336409f, 0.459369034f},
-std::array<float,2>{0.0333646573f, 0.808836162f},
-std::array<float,2>{0.910731733f, 0.23820582f},
-std::array<float,2>{0.997990966f, 0.73533994f},
-std::array<float,2>{0.102908812f, 0.284061432f},
-std::array<float,2>{0.46269536f, 0.884775639f},
-std::array<float,2>{0.562518835f, 0.0607298017f},
-std::array<float,2>{0.740081131f, 0.820853949f},
-std::array<float,2>{0.264843136f, 0.160507157f},
-std::array<float,2>{0.151833087f, 0.501934052f},
-std::array<float,2>{0.814446986f, 0.399734139f},
-std::array<float,2>{0.836247981f, 0.866245985f},
-std::array<float,2>{0.136452317f, 0.138984829f},
-std::array<float,2>{0.271030426f, 0.549233973f},
-std::array<float,2>{0.727744102f, 0.407767385f},
-std::array<float,2>{0.592068493f, 0.689748406f},
-std::array<float,2>{0.44486478f, 0.25845778f},
-std::array<float,2>{0.111723162f, 0.93120718f},
-std::array<float,2>{0.97708267f, 0.0186456814f},
-std::array<float,2>{0.922859609f, 0.603900313f},
-std::array<float,2>{0.0616534241f, 0.494673848f},
-std::array<float,2>{0.403372437f, 0.765516758f},
-std::array<float,2>{0.554646432f, 0.188801512f},
-std::array<float,2>{0.659372449f, 0.96910578f},
-std::array<float,2>{0.312859386f, 0.10830266f},
-std::array<float,2>{0.203198791f, 0.648465812f},
-std::array<float,2>{0.780201674f, 0.365134627f},
-std::array<float,2>{0.958774567f, 0.897524059f},
-std::array<float,2>{0.0740294829f, 0.0354072675f},
-std::array<float,2>{0.482922733f, 0.721017659f},
-std::array<float,2>{0.617058992f, 0.30499658f},
-std::array<float,2>{0.718669474f, 0.515864909f},
-std::array<float,2>{0.31056729f, 0.3816576f},
-std::array<float,2>{0.16820845f, 0.829987645f},
-std::array<float,2>{0.846677482f, 0.174117804f},
-std::array<float,2>{0.790614367f, 0.684660137f},
-std::array<float,2>{0.230706736f, 0.328077048f},
-std::array<float,2>{0.362069041f, 0.951841056f},
-std::array<float,2>{0.651106f, 0.0685254186f},
-std::array<float,2>{0.513630331f, 0.78260982f},
-std::array<float,2>{0.416774482f, 0.224284694f},
-std::array<float,2>{0.0191799272f, 0.565607131f},
-std::array<float,2>{0.9014377f, 0.450169295f},
-std::array<float,2>{0.89756012f, 0.825067937f},
-std::array<float,2>{0.0273045581f, 0.158003464f},
-std::array<float,2>{0.409500092f, 0.504666984f},
-std::array<float,2>{0.503160596f, 0.404351741f},
-std::array<float,2>{0.646595895f, 0.739837229f},
-std::array<float,2>{0.368556261f, 0.288006097f},
-std::array<float,2>{0.220529243f, 0.888059378f},
-std::array<float,2>{0.781433165f, 0.0582897402f},
-std::array<float,2>{0.85289818f, 0.591575921f},
-std::array<float,2>{0.157626018f, 0.456568897f},
-std::array<float,2>{0.299771309f, 0.805024326f},
-std::array<float,2>{0.705172181f, 0.239686534f},
-std::array<float,2>{0.624479353f, 0.956600368f},
-std::array<float,2>{0.47367239f, 0.0846889317f},
-std::array<float,2>{0.0682380572f, 0.657555223f},
-std::array<float,2>{0.962459683f, 0.342267096f},
-std::array<float,2>{0.767564416f, 0.907601714f},
-std::array<float,2>{0.217778906f, 0.0133578843f},
-std::array<float,2>{0.324936062f, 0.717615128f},
-std::array<float,2>{0.66965121f, 0.268021137f},
-std::array<float,2>{0.557405829f, 0.537736416f},
-std::array<float,2>{0.394153386f, 0.430639029f},
-std::array<float,2>{0.0474586412f, 0.84802562f},
-std::array<float,2>{0.931742489f, 0.14293538f},
-std::array<float,2>{0.974545956f, 0.639246345f},
-std::array<float,2>{0.122471713f, 0.356290728f},
-std::array<float,2>{0.448875993f, 0.984712541f},
-std::array<float,2>{0.584280968f, 0.114089131f},
-std::array<float,2>{0.719407856f, 0.767703235f},
-std::array<float,2>{0.273510277f, 0.213171154f},
-std::array<float,2>{0.132538736f, 0.616394639f},
-std::array<float,2>{0.829484701f, 0.473575652f},
-std::array<float,2>{0.824215055f, 0.786762059f},
-std::array<float,2>{0.145925164f, 0.221996605f},
-std::array<float,2>{0.253602356f, 0.569971561f},
-std::array<float,2>{0.748573482f, 0.446310759f},
-std::array<float,2>{0.571546078f, 0.682812691f},
-std::array<float,2>{0.455980211f, 0.322320104f},
-std::array<float,2>{0.0951816589f, 0.947244644f},
-std::array<float,2>{0.984461069f, 0.0657836869f},
-std::array<float,2>{0.919948399f, 0.522156656f},
-std::array<float,2>{0.0430713594f, 0.375028551f},
-std::array<float,2>{0.382842094f, 0.834648609f},
-std::array<float,2>{0.546610117f, 0.176966056f},
-std::array<float,2>{0.682481289f, 0.891306639f},
-std::array<float,2>{0.332123101f, 0.0330187604f},
-std::array<float,2>{0.201837257f, 0.725540221f},
-std::array<float,2>{0.764677465f, 0.31022954f},
-std::array<float,2>{0.94690758f, 0.975026846f},
-std::array<float,2>{0.0923860669f, 0.103267521f},
-std::array<float,2>{0.493887633f, 0.65561533f},
-std::array<float,2>{0.609140933f, 0.361995697f},
-std::array<float,2>{0.692583442f, 0.605840862f},
-std::array<float,2>{0.287450016f, 0.497278363f},
-std::array<float,2>{0.171884954f, 0.758825421f},
-std::array<float,2>{0.866918325f, 0.193596169f},
-std::array<float,2>{0.807212055f, 0.694745302f},
-std::array<float,2>{0.237059027f, 0.264272511f},
-std::array<float,2>{0.345307916f, 0.934604168f},
-std::array<float,2>{0.638480365f, 0.0223712921f},
-std::array<float,2>{0.524194062f, 0.862079442f},
-std::array<float,2>{0.430707544f, 0.134281948f},
-std::array<float,2>{0.0142804449f, 0.552395701f},
-std::array<float,2>{0.883582175f, 0.413111776f},
-std::array<float,2>{0.993447304f, 0.751597643f},
-std::array<float,2>{0.10675481f, 0.203093395f},
-std::array<float,2>{0.467739016f, 0.597413719f},
-std::array<float,2>{0.567555428f, 0.489496797f},
-std::array<float,2>{0.737174034f, 0.641156971f},
-std::array<float,2>{0.258707196f, 0.368978322f},
-std::array<float,2>{0.15410459f, 0.978058517f},
-std::array<float,2>{0.819823563f, 0.0986725613f},
-std::array<float,2>{0.752606392f, 0.555918574f},
-std::array<float,2>{0.193285197f, 0.41571191f},
-std::array<float,2>{0.340060741f, 0.870857954f},
-std::array<float,2>{0.676574111f, 0.130623251f},
-std::array<float,2>{0.535049617f, 0.925663769f},
-std::array<float,2>{0.380129665f, 0.0276673306f},
-std::array<float,2>{0.0377220847f, 0.702102661f},
-std::array<float,2>{0.908319056f, 0.253551126f},
-std::array<float,2>{0.869830966f, 0.9377262f},
-std::array<float,2>{0.185299888f, 0.0738777518f},
-std::array<float,2>{0.296004057f, 0.678034544f},
-std::array<float,2>{0.701336145f, 0.315458685f},
-std::array<float,2>{0.600580573f, 0.57408452f},
-std::array<float,2>{0.489043087f, 0.441954017f},
-std::array<float,2>{0.078406401f, 0.79630363f},
-std::array<float,2>{0.938910782f, 0.229902938f},
-std::array<float,2>{0.880137026f, 0.729126692f},
-std::array<float,2>{0.00453898218f, 0.303220272f},
-std::array<float,2>{0.428612709f, 0.902674437f},
-std::array<float,2>{0.517639458f, 0.0401983112f},
-std::array<float,2>{0.629487038f, 0.840373874f},
-std::array<float,2>{0.353473663f, 0.185460046f},
-std::array<float,2>{0.246349707f, 0.523822248f},
-std::array<float,2>{0.803528428f, 0.386594146f},
-std::array<float,2>{0.795469224f, 0.854715884f},
-std::array<float,2>{0.226779252f, 0.1556409f},
-std::array<float,2>{0.365013272f, 0.546254277f},
-std::array<float,2>{0.653494298f, 0.42866531f},
-std::array<float,2>{0.510940194f, 0.703807712f},
-std::array<float,2>{0.421616673f, 0.275054991f},
-std::array<float,2>{0.0198546033f, 0.915077627f},
-std::array<float,2>{0.902670979f, 0.00598504394f},
-std::array<float,2>{0.954728305f, 0.620797515f},
-std::array<float,2>{0.0769997463f, 0.480137169f},
-std::array<float,2>{0.477489799f, 0.776176512f},
-std::array<float,2>{0.609583139f, 0.2066091f},
-std::array<float,2>{0.711867392f, 0.996036947f},
-std::array<float,2>{0.305691898f, 0.119771607f},
-std::array<float,2>{0.165678307f, 0.629143894f},
-std::array<float,2>{0.850545466f, 0.344033778f},
-std::array<float,2>{0.927168429f, 0.878604412f},
-std::array<float,2>{0.0571291856f, 0.0505531244f},
-std::array<float,2>{0.399109095f, 0.74600774f},
-std::array<float,2>{0.550628066f, 0.29490909f},
-std::array<float,2>{0.662816763f, 0.514161944f},
-std::array<float,2>{0.319167614f, 0.397644222f},
-std::array<float,2>{0.207454428f, 0.813892901f},
-std::array<float,2>{0.775678456f, 0.16412136f},
-std::array<float,2>{0.841462314f, 0.669415176f},
-std::array<float,2>{0.138360411f, 0.330725372f},
-std::array<float,2>{0.267030358f, 0.965826809f},
-std::array<float,2>{0.733854532f, 0.0866526738f},
-std::array<float,2>{0.586483657f, 0.799898565f},
-std::array<float,2>{0.438959569f, 0.243697032f},
-std::array<float,2>{0.116044745f, 0.584697545f},
-std::array<float,2>{0.981290817f, 0.467593998f},
-std::array<float,2>{0.967235804f, 0.874925196f},
-std::array<float,2>{0.0662080422f, 0.128641427f},
-std::array<float,2>{0.471229255f, 0.559161544f},
-std::array<float,2>{0.618709266f, 0.419202894f},
-std::array<float,2>{0.707325578f, 0.695817232f},
-std::array<float,2>{0.303984851f, 0.257583797f},
-std::array<float,2>{0.161351874f, 0.929116368f},
-std::array<float,2>{0.857348979f, 0.0255668405f},
-std::array<float,2>{0.787097514f, 0.599642873f},
-std::array<float,2>{0.22296837f, 0.485556722f},
-std::array<float,2>{0.374736309f, 0.756060183f},
-std::array<float,2>{0.643377483f, 0.198822036f},
-std::array<float,2>{0.505623579f, 0.984000027f},
-std::array<float,2>{0.41399166f, 0.0939997733f},
-std::array<float,2>{0.0289938543f, 0.646594644f},
-std::array<float,2>{0.892606676f, 0.371606231f},
-std::array<float,2>{0.83230859f, 0.900640249f},
-std::array<float,2>{0.126164287f, 0.0467328504f},
-std::array<float,2>{0.278232604f, 0.730876625f},
-std::array<float,2>{0.72421211f, 0.299510658f},
-std::array<float,2>{0.579102337f, 0.52818954f},
-std::array<float,2>{0.450549513f, 0.387983292f},
-std::array<float,2>{0.119167939f, 0.838921487f},
-std::array<float,2>{0.968849421f, 0.182065666f},
-std::array<float,2>{0.934500754f, 0.67528367f},
-std::array<float,2>{0.0540540665f, 0.318080783f},
-std::array<float,2>{0.398426622f, 0.943858087f},
-std::array<float,2>{0.559693813f, 0.0749425143f},
-std::array<float,2>{0.665789604f, 0.789107323f},
-std::array<float,2>{0.321554244f, 0.234079972f},
-std::array<float,2>{0.214706555f, 0.576673031f},
-std::array<float,2>{0.770807385f, 0.438042283f},
-std::array<float,2>{0.760636628f, 0.777529061f},
-std::array<float,2>{0.198552415f, 0.20834139f},
-std::array<float,2>{0.329744101f, 0.621241629f},
-std::array<float,2>{0.686463237f, 0.48378396f},
-std::array<float,2>{0.540316164f, 0.626191139f},
-std::array<float,2>{0.389175534f, 0.350740254f},
-std::array<float,2>{0.0402740501f, 0.996824384f},
-std::array<float,2>{0.915440679f, 0.123020932f},
-std::array<float,2>{0.989029527f, 0.539619684f},
-std::array<float,2>{0.10093417f, 0.422078818f},
-std::array<float,2>{0.459631026f, 0.859209001f},
-std::array<float,2>{0.578090668f, 0.150693431f},
-std::array<float,2>{0.745347679f, 0.918509483f},
-std::array<float,2>{0.256204754f, 0.00198235526f},
-std::array<float,2>{0.142676979f, 0.707505286f},
-std::array<float,2>{0.824498653f, 0.279929101f},
-std::array<float,2>{0.889190018f, 0.961805642f},
-std::array<float,2>{0.0102788126f, 0.0909133479f},
-std::array<float,2>{0.435490161f, 0.665322423f},
-std::array<float,2>{0.527745306f, 0.334886551f},
-std::array<float,2>{0.634408355f, 0.578674197f},
-std::array<float,2>{0.349074394f, 0.464302748f},
-std::array<float,2>{0.240706012f, 0.802150071f},
-std::array<float,2>{0.80946821f, 0.24778837f},
-std::array<float,2>{0.860773444f, 0.748825371f},
-std::array<float,2>{0.178901821f, 0.29290694f},
-std::array<float,2>{0.284489185f, 0.878908336f},
-std::array<float,2>{0.688352644f, 0.0516716801f},
-std::array<float,2>{0.60444504f, 0.819896817f},
-std::array<float,2>{0.496257424f, 0.171583161f},
-std::array<float,2>{0.0870127827f, 0.509119153f},
-std::array<float,2>{0.950885415f, 0.392074049f},
-std::array<float,2>{0.913704574f, 0.812400877f},
-std::array<float,2>{0.0313198902f, 0.235961825f},
-std::array<float,2>{0.378422141f, 0.587922096f},
-std::array<float,2>{0.538037062f, 0.458875299f},
-std::array<float,2>{0.674876332f, 0.663738847f},
-std::array<float,2>{0.339818627f, 0.337367445f},
-std::array<float,2>{0.191069141f, 0.95705092f},
-std::array<float,2>{0.754866183f, 0.0817055926f},
-std::array<float,2>{0.816287816f, 0.502081811f},
-std::array<float,2>{0.149153337f, 0.401667267f},
-std::array<float,2>{0.263175964f, 0.823218703f},
-std::array<float,2>{0.740815282f, 0.163964495f},
-std::array<float,2>{0.564776599f, 0.88366282f},
-std::array<float,2>{0.464312643f, 0.0603473894f},
-std::array<float,2>{0.103624187f, 0.7364555f},
-std::array<float,2>{0.998871267f, 0.282891035f},
-std::array<float,2>{0.798327684f, 0.989440382f},
-std::array<float,2>{0.244049519f, 0.110740311f},
-std::array<float,2>{0.356401294f, 0.636388958f},
-std::array<float,2>{0.626966298f, 0.354637653f},
-std::array<float,2>{0.522146463f, 0.612769783f},
-std::array<float,2>{0.424615294f, 0.469149441f},
-std::array<float,2>{0.00232713413f, 0.772805333f},
-std::array<float,2>{0.877110779f, 0.217244357f},
-std::array<float,2>{0.943389535f, 0.712264836f},
-std::array<float,2>{0.0847191662f, 0.272088557f},
-std::array<float,2>{0.487280607f, 0.910952628f},
-std::array<float,2>{0.595273614f, 0.00919268001f},
-std::array<float,2>{0.69809854f, 0.847132325f},
-std::array<float,2>{0.290856957f, 0.147892207f},
-std::array<float,2>{0.182577983f, 0.534780145f},
-std::array<float,2>{0.87283349f, 0.434988976f},
-std::array<float,2>{0.845303476f, 0.830811203f},
-std::array<float,2>{0.170344099f, 0.173413739f},
-std::array<float,2>{0.309454173f, 0.517774522f},
-std::array<float,2>{0.716326296f, 0.379762858f},
-std::array<float,2>{0.613596678f, 0.719378054f},
-std::array<float,2>{0.482309967f, 0.308049589f},
-std::array<float,2>{0.0708398595f, 0.895507395f},
-std::array<float,2>{0.959157169f, 0.0380659364f},
-std::array<float,2>{0.899995685f, 0.562769353f},
-std::array<float,2>{0.0160171539f, 0.45304662f},
-std::array<float,2>{0.414278924f, 0.784997463f},
-std::array<float,2>{0.51465708f, 0.225619212f},
-std::array<float,2>{0.648794293f, 0.951099634f},
-std::array<float,2>{0.359552115f, 0.0674957931f},
-std::array<float,2>{0.233256757f, 0.687477589f},
-std::array<float,2>{0.791146576f, 0.325223744f},
-std::array<float,2>{0.979000092f, 0.933570266f},
-std::array<float,2>{0.109656349f, 0.0162460729f},
-std::array<float,2>{0.441804707f, 0.688747287f},
-std::array<float,2>{0.591038823f, 0.260470867f},
-std::array<float,2>{0.729562819f, 0.548187375f},
-std::array<float,2>{0.271671623f, 0.409622878f},
-std::array<float,2>{0.133380339f, 0.86340344f},
-std::array<float,2>{0.839491606f, 0.137092188f},
-std::array<float,2>{0.778408647f, 0.650897682f},
-std::array<float,2>{0.205965564f, 0.365729839f},
-std::array<float,2>{0.314823776f, 0.972639263f},
-std::array<float,2>{0.657227516f, 0.106975049f},
-std::array<float,2>{0.551775157f, 0.762346029f},
-std::array<float,2>{0.405217052f, 0.190008685f},
-std::array<float,2>{0.0598413758f, 0.6029073f},
-std::array<float,2>{0.924404323f, 0.493481666f},
-std::array<float,2>{0.919383228f, 0.834996879f},
-std::array<float,2>{0.0459051505f, 0.176717654f},
-std::array<float,2>{0.384781539f, 0.523167014f},
-std::array<float,2>{0.544300854f, 0.376113445f},
-std::array<float,2>{0.680111468f, 0.72654599f},
-std::array<float,2>{0.335701793f, 0.309467345f},
-std::array<float,2>{0.199246898f, 0.891708374f},
-std::array<float,2>{0.762506902f, 0.0321873166f},
-std::array<float,2>{0.820724845f, 0.568716645f},
-std::array<float,2>{0.146611884f, 0.445400089f},
-std::array<float,2>{0.250496656f, 0.786110163f},
-std::array<float,2>{0.746538281f, 0.220719904f},
-std::array<float,2>{0.573443353f, 0.945672989f},
-std::array<float,2>{0.453743517f, 0.0652792156f},
-std::array<float,2>{0.0966215804f, 0.681708813f},
-std::array<float,2>{0.987013042f, 0.323476762f},
-std::array<float,2>{0.805642486f, 0.933640003f},
-std::array<float,2>{0.23501946f, 0.0225279164f},
-std::array<float,2>{0.347295552f, 0.694270492f},
-std::array<float,2>{0.63918978f, 0.265015185f},
-std::array<float,2>{0.526212037f, 0.551411569f},
-std::array<float,2>{0.43352589f, 0.412928581f},
-std::array<float,2>{0.0126122013f, 0.862679422f},
-std::array<float,2>{0.885986745f, 0.133430913f},
-std::array<float,2>{0.949041188f, 0.655092418f},
-std::array<float,2>{0.0907501578f, 0.362579256f},
-std::array<float,2>{0.495881379f, 0.976272404f},
-std::array<float,2>{0.605585515f, 0.101616435f},
-std::array<float,2>{0.693768263f, 0.758272767f},
-std::array<float,2>{0.286421597f, 0.194449529f},
-std::array<float,2>{0.173998117f, 0.606966436f},
-std::array<float,2>{0.864092469f, 0.496712238f},
-std::array<float,2>{0.85472697f, 0.805928349f},
-std::array<float,2>{0.158210456f, 0.239170223f},
-std::array<float,2>{0.297929138f, 0.590028107f},
-std::array<float,2>{0.704912603f, 0.455702752f},
-std::array<float,2>{0.621811152f, 0.656504154f},
-std::array<float,2>{0.475963801f, 0.343609005f},
-std::array<float,2>{0.0700405166f, 0.955788493f},
-std::array<float,2>{0.963549018f, 0.0850341767f},
-std::array<float,2>{0.896112144f, 0.50535512f},
-std::array<float,2>{0.0253102779f, 0.405451715f},
-std::array<float,2>{0.407189757f, 0.825917423f},
-std::array<float,2>{0.501138091f, 0.157074064f},
-std::array<float,2>{0.646287739f, 0.887661934f},
-std::array<float,2>{0.370661467f, 0.0572295859f},
-std::array<float,2>{0.222156808f, 0.739129245f},
-std::array<float,2>{0.784989834f, 0.288459331f},
-std::array<float,2>{0.974887073f, 0.986207664f},
-std::array<float,2>{0.123366512f, 0.115218826f},
-std::array<float,2>{0.445316166f, 0.640167415f},
-std::array<float,2>{0.583907843f, 0.356623292f},
-std::array<float,2>{0.721347511f, 0.615657926f},
-std::array<float,2>{0.27683872f, 0.474100858f},
-std::array<float,2>{0.130173266f, 0.768914938f},
-std::array<float,2>{0.830187261f, 0.214165971f},
-std::array<float,2>{0.768349946f, 0.717930913f},
-std::array<float,2>{0.215119153f, 0.268671632f},
-std::array<float,2>{0.328010529f, 0.906642914f},
-std::array<float,2>{0.671589911f, 0.0118669895f},
-std::array<float,2>{0.556460083f, 0.849479496f},
-std::array<float,2>{0.391967982f, 0.143880561f},
-std::array<float,2>{0.0489186905f, 0.53820008f},
-std::array<float,2>{0.931506813f, 0.430833966f},
-std::array<float,2>{0.955338597f, 0.776449621f},
-std::array<float,2>{0.0756255984f, 0.205330521f},
-std::array<float,2>{0.478791595f, 0.620033264f},
-std::array<float,2>{0.611843348f, 0.479447871f},
-std::array<float,2>{0.713712335f, 0.630505085f},
-std::array<float,2>{0.306779563f, 0.345647275f},
-std::array<float,2>{0.166844085f, 0.994735777f},
-std::array<float,2>{0.849192977f, 0.120208696f},
-std::array<float,2>{0.79354167f, 0.545077503f},
-std::array<float,2>{0.23025845f, 0.428855866f},
-std::array<float,2>{0.366682231f, 0.854472339f},
-std::array<float,2>{0.655225873f, 0.154396534f},
-std::array<float,2>{0.509554446f, 0.91479218f},
-std::array<float,2>{0.418520957f, 0.00694089988f},
-std::array<float,2>{0.021554403f, 0.704619646f},
-std::array<float,2>{0.906131566f, 0.27410385f},
-std::array<float,2>{0.841816187f, 0.964856565f},
-std::array<float,2>{0.140055627f, 0.0872515962f},
-std::array<float,2>{0.267743468f, 0.668508053f},
-std::array<float,2>{0.73102504f, 0.331258535f},
-std::array<float,2>{0.589163065f, 0.585410297f},
-std::array<float,2>{0.441082239f, 0.468183815f},
-std::array<float,2>{0.114146702f, 0.799754381f},
-std::array<float,2>{0.982578814f, 0.243092313f},
-std::array<float,2>{0.928339362f, 0.744701505f},
-std::array<float,2>{0.0556884147f, 0.293086112f},
-std::array<float,2>{0.401442975f, 0.87744534f},
-std::array<float,2>{0.548130393f, 0.0492920764f},
-std::array<float,2>{0.661653042f, 0.813342035f},
-std::array<float,2>{0.316420406f, 0.165084302f},
-std::array<float,2>{0.210224479f, 0.515160382f},
-std::array<float,2>{0.77440989f, 0.397189736f},
-std::array<float,2>{0.750823259f, 0.869768977f},
-std::array<float,2>{0.194103301f, 0.129409924f},
-std::array<float,2>{0.343031555f, 0.555551291f},
-std::array<float,2>{0.678559124f, 0.414736569f},
-std::array<float,2>{0.532493174f, 0.702748716f},
-std::array<float,2>{0.381715089f, 0.252155036f},
-std::array<float,2>{0.0369154438f, 0.923903167f},
-std::array<float,2>{0.90673542f, 0.028719645f},
-std::array<float,2>{0.995810449f, 0.596009016f},
-std::array<float,2>{0.108750828f, 0.488850743f},
-std::array<float,2>{0.465057403f, 0.75038296f},
-std::array<float,2>{0.568997145f, 0.201190099f},
-std::array<float,2>{0.734754443f, 0.976932347f},
-std::array<float,2>{0.260898113f, 0.0981946439f},
-std::array<float,2>{0.154670775f, 0.641818583f},
-std::array<float,2>{0.817886412f, 0.368138611f},
-std::array<float,2>{0.881124914f, 0.903874338f},
-std::array<float,2>{0.0068176128f, 0.0392302163f},
-std::array<float,2>{0.426379859f, 0.729626417f},
-std::array<float,2>{0.516016603f, 0.304580092f},
-std::array<float,2>{0.631832063f, 0.524703443f},
-std::array<float,2>{0.354469597f, 0.384999961f},
-std::array<float,2>{0.248448193f, 0.841205597f},
-std::array<float,2>{0.801624417f, 0.183619037f},
-std::array<float,2>{0.867503047f, 0.679230273f},
-std::array<float,2>{0.186096251f, 0.315161198f},
-std::array<float,2>{0.293774784f, 0.939331293f},
-std::array<float,2>{0.700830221f, 0.0724239275f},
-std::array<float,2>{0.599390149f, 0.795808911f},
-std::array<float,2>{0.49159801f, 0.22942172f},
-std::array<float,2>{0.080894731f, 0.573083341f},
-std::array<float,2>{0.940961957f, 0.443015248f},
-std::array<float,2>{0.990490615f, 0.858028471f},
-std::array<float,2>{0.0983282402f, 0.151995629f},
-std::array<float,2>{0.457177877f, 0.540985823f},
-std::array<float,2>{0.576009452f, 0.423719049f},
-std::array<float,2>{0.743592083f, 0.708292663f},
-std::array<float,2>{0.254570365f, 0.280832529f},
-std::array<float,2>{0.142115608f, 0.919385016f},
-std::array<float,2>{0.827260792f, 0.00349703291f},
-std::array<float,2>{0.759078681f, 0.622198939f},
-std::array<float,2>{0.19598268f, 0.482429206f},
-std::array<float,2>{0.330949843f, 0.778511941f},
-std::array<float,2>{0.684785724f, 0.207708493f},
-std::array<float,2>{0.541803837f, 0.997550786f},
-std::array<float,2>{0.387812287f, 0.121172138f},
-std::array<float,2>{0.0425290354f, 0.625681877f},
-std::array<float,2>{0.917025387f, 0.35057947f},
-std::array<float,2>{0.861891091f, 0.879933298f},
-std::array<float,2>{0.176343948f, 0.0523466356f},
-std::array<float,2>{0.281910866f, 0.749952495f},
-std::array<float,2>{0.691193044f, 0.291275471f},
-std::array<float,2>{0.602706194f, 0.508049488f},
-std::array<float,2>{0.498710334f, 0.3911753f},
-std::array<float,2>{0.089667961f, 0.818746984f},
-std::array<float,2>{0.951966703f, 0.170637786f},
-std::array<float,2>{0.887050629f, 0.664374113f},
-std::array<float,2>{0.00874362048f, 0.335927755f},
-std::array<float,2>{0.437303543f, 0.962190568f},
-std::array<float,2>{0.530743361f, 0.0902164131f},
-std::array<float,2>{0.63616699f, 0.801555812f},
-std::array<float,2>{0.350763768f, 0.246564165f},
-std::array<float,2>{0.239327133f, 0.579814255f},
-std::array<float,2>{0.811929822f, 0.463061273f},
-std::array<float,2>{0.788345337f, 0.757801592f},
-std::array<float,2>{0.226199552f, 0.19752112f},
-std::array<float,2>{0.371146917f, 0.600659847f},
-std::array<float,2>{0.64108336f, 0.485014766f},
-std::array<float,2>{0.506896019f, 0.647550046f},
-std::array<float,2>{0.411857516f, 0.372530997f},
-std::array<float,2>{0.0308307782f, 0.982900321f},
-std::array<float,2>{0.892294109f, 0.0951423943f},
-std::array<float,2>{0.966123998f, 0.560477197f},
-std::array<float,2>{0.0643448755f, 0.418924093f},
-std::array<float,2>{0.469035983f, 0.873943448f},
-std::array<float,2>{0.620002091f, 0.12719284f},
-std::array<float,2>{0.710865438f, 0.928097069f},
-std::array<float,2>{0.302144796f, 0.0272391289f},
-std::array<float,2>{0.163762391f, 0.696883678f},
-std::array<float,2>{0.859306574f, 0.256314129f},
-std::array<float,2>{0.937366784f, 0.945019722f},
-std::array<float,2>{0.050967101f, 0.0754979253f},
-std::array<float,2>{0.396340102f, 0.674126863f},
-std::array<float,2>{0.560924411f, 0.316761822f},
-std::array<float,2>{0.666721225f, 0.577526331f},
-std::array<float,2>{0.324058235f, 0.438980252f},
-std::array<float,2>{0.212143555f, 0.790209711f},
-std::array<float,2>{0.772114336f, 0.23320733f},
-std::array<float,2>{0.834268272f, 0.731984079f},
-std::array<float,2>{0.127463534f, 0.300385296f},
-std::array<float,2>{0.280979633f, 0.901745141f},
-std::array<float,2>{0.724655747f, 0.0457940437f},
-std::array<float,2>{0.581365049f, 0.837955773f},
-std::array<float,2>{0.452870488f, 0.183438793f},
-std::array<float,2>{0.117272697f, 0.528503716f},
-std::array<float,2>{0.971400559f, 0.387287945f},
-std::array<float,2>{0.901354074f, 0.783278823f},
-std::array<float,2>{0.0179803986f, 0.225053832f},
-std::array<float,2>{0.417859137f, 0.563527942f},
-std::array<float,2>{0.511862814f, 0.451770186f},
-std::array<float,2>{0.651570201f, 0.685701072f},
-std::array<float,2>{0.363065809f, 0.324368894f},
-std::array<float,2>{0.231450975f, 0.949747622f},
-std::array<float,2>{0.789687395f, 0.0665094554f},
-std::array<float,2>{0.846786797f, 0.519463778f},
-std::array<float,2>{0.169382676f, 0.380372226f},
-std::array<float,2>{0.312418818f, 0.831444323f},
-std::array<float,2>{0.717734516f, 0.17211467f},
-std::array<float,2>{0.615512311f, 0.896139324f},
-std::array<float,2>{0.483664036f, 0.0382517986f},
-std::array<float,2>{0.0729043037f, 0.720655739f},
-std::array<float,2>{0.95774591f, 0.307045132f},
-std::array<float,2>{0.780722857f, 0.971643925f},
-std::array<float,2>{0.204901084f, 0.105583601f},
-std::array<float,2>{0.313558161f, 0.651425064f},
-std::array<float,2>{0.65882647f, 0.366372436f},
-std::array<float,2>{0.553316772f, 0.602497518f},
-std::array<float,2>{0.402935535f, 0.49226445f},
-std::array<float,2>{0.0614913739f, 0.763455451f},
-std::array<float,2>{0.92245084f, 0.190600082f},
-std::array<float,2>{0.978151977f, 0.688294649f},
-std::array<float,2>{0.112492077f, 0.26109466f},
-std::array<float,2>{0.443527162f, 0.932097971f},
-std::array<float,2>{0.593012452f, 0.0175571181f},
-std::array<float,2>{0.727509439f, 0.86474359f},
-std::array<float,2>{0.270022124f, 0.138508871f},
-std::array<float,2>{0.134858787f, 0.547576308f},
-std::array<float,2>{0.837473512f, 0.408991009f},
-std::array<float,2>{0.813050449f, 0.823415935f},
-std::array<float,2>{0.151115239f, 0.162289828f},
-std::array<float,2>{0.263687551f, 0.503063619f},
-std::array<float,2>{0.73860538f, 0.400437713f},
-std::array<float,2>{0.564020514f, 0.737701774f},
-std::array<float,2>{0.46113342f, 0.281673878f},
-std::array<float,2>{0.102039225f, 0.883956969f},
-std::array<float,2>{0.996597886f, 0.0591411255f},
-std::array<float,2>{0.911783755f, 0.589593887f},
-std::array<float,2>{0.0346538574f, 0.457581431f},
-std::array<float,2>{0.376701921f, 0.811050653f},
-std::array<float,2>{0.535990596f, 0.234898582f},
-std::array<float,2>{0.672163844f, 0.958213329f},
-std::array<float,2>{0.337595195f, 0.0809019879f},
-std::array<float,2>{0.189232349f, 0.662728369f},
-std::array<float,2>{0.75692445f, 0.336844146f},
-std::array<float,2>{0.942826569f, 0.911884785f},
-std::array<float,2>{0.0836704969f, 0.00785087515f},
-std::array<float,2>{0.484392017f, 0.711880684f},
-std::array<float,2>{0.597367287f, 0.273409724f},
-std::array<float,2>{0.695977688f, 0.533380628f},
-std::array<float,2>{0.291540921f, 0.434556603f},
-std::array<float,2>{0.180941582f, 0.846146107f},
-std::array<float,2>{0.87351644f, 0.147150546f},
-std::array<float,2>{0.800616264f, 0.635101557f},
-std::array<float,2>{0.244835466f, 0.353698134f},
-std::array<float,2>{0.358809024f, 0.988539636f},
-std::array<float,2>{0.625981808f, 0.10989783f},
-std::array<float,2>{0.521102548f, 0.772141337f},
-std::array<float,2>{0.422315687f, 0.218101457f},
-std::array<float,2>{0.0018282095f, 0.611580729f},
-std::array<float,2>{0.875469863f, 0.470620364f},
-std::array<float,2>{0.884542108f, 0.859791934f},
-std::array<float,2>{0.0147254542f, 0.135538101f},
-std::array<float,2>{0.430622518f, 0.554285407f},
-std::array<float,2>{0.525160313f, 0.410290331f},
-std::array<float,2>{0.636756778f, 0.692055464f},
-std::array<float,2>{0.34422788f, 0.262595445f},
-std::array<float,2>{0.237535223f, 0.936416566f},
-std::array<float,2>{0.808137238f, 0.0202985983f},
-std::array<float,2>{0.865285158f, 0.60869503f},
-std::array<float,2>{0.17288962f, 0.498777121f},
-std::array<float,2>{0.288993835f, 0.759934485f},
-std::array<float,2>{0.692077875f, 0.192786038f},
-std::array<float,2>{0.608336329f, 0.973151445f},
-std::array<float,2>{0.492340773f, 0.10405542f},
-std::array<float,2>{0.0931484774f, 0.652548432f},
-std::array<float,2>{0.945904493f, 0.360474139f},
-std::array<float,2>{0.764514625f, 0.893348336f},
-std::array<float,2>{0.20310232f, 0.034169361f},
-std::array<float,2>{0.333544046f, 0.722756445f},
-std::array<float,2>{0.682699323f, 0.312453687f},
-std::array<float,2>{0.545685947f, 0.520094991f},
-std::array<float,2>{0.384078771f, 0.377767712f},
-std::array<float,2>{0.0440140143f, 0.83333534f},
-std::array<float,2>{0.921671867f, 0.178863451f},
-std::array<float,2>{0.986047745f, 0.681305289f},
-std::array<float,2>{0.0939562842f, 0.322162151f},
-std::array<float,2>{0.456765443f, 0.948415339f},
-std::array<float,2>{0.571246982f, 0.0626878738f},
-std::array<float,2>{0.749893904f, 0.788899362f},
-std::array<float,2>{0.252458394f, 0.220136076f},
-std::array<float,2>{0.145173937f, 0.568126142f},
-std::array<float,2>{0.823018253f, 0.448329121f},
-std::array<float,2>{0.828627944f, 0.767510891f},
-std::array<float,2>{0.131666258f, 0.212033585f},
-std::array<float,2>{0.274557531f, 0.61329484f},
-std::array<float,2>{0.720638871f, 0.476336271f},
-std::array<float,2>{0.585811913f, 0.638555527f},
-std::array<float,2>{0.447710901f, 0.357942045f},
-std::array<float,2>{0.121418424f, 0.986959159f},
-std::array<float,2>{0.973223686f, 0.116936021f},
-std::array<float,2>{0.933019459f, 0.536266923f},
-std::array<float,2>{0.0484359637f, 0.433003455f},
-std::array<float,2>{0.392605931f, 0.851272941f},
-std::array<float,2>{0.557642043f, 0.140650421f},
-std::array<float,2>{0.66801554f, 0.908645689f},
-std::array<float,2>{0.325848341f, 0.0137826614f},
-std::array<float,2>{0.216833755f, 0.715048671f},
-std::array<float,2>{0.766239703f, 0.265795767f},
-std::array<float,2>{0.961386621f, 0.953412771f},
-std::array<float,2>{0.0669852719f, 0.0822856501f},
-std::array<float,2>{0.473212034f, 0.659224451f},
-std::array<float,2>{0.624017358f, 0.340503901f},
-std::array<float,2>{0.706348956f, 0.592179537f},
-std::array<float,2>{0.300345838f, 0.454894483f},
-std::array<float,2>{0.15635699f, 0.80821687f},
-std::array<float,2>{0.851652026f, 0.24093689f},
-std::array<float,2>{0.783025563f, 0.740266144f},
-std::array<float,2>{0.219107717f, 0.285162598f},
-std::array<float,2>{0.367541224f, 0.889786601f},
-std::array<float,2>{0.647872984f, 0.0551507324f},
-std::array<float,2>{0.502422631f, 0.82745719f},
-std::array<float,2>{0.408430994f, 0.159879252f},
-std::array<float,2>{0.0254729856f, 0.506199658f},
-std::array<float,2>{0.896985769f, 0.402386963f},
-std::array<float,2>{0.982236147f, 0.79780674f},
-std::array<float,2>{0.117180705f, 0.245549664f},
-std::array<float,2>{0.437684089f, 0.583573461f},
-std::array<float,2>{0.58735472f, 0.466567039f},
-std::array<float,2>{0.733354092f, 0.671025872f},
-std::array<float,2>{0.265652388f, 0.329211295f},
-std::array<float,2>{0.13691245f, 0.968329787f},
-std::array<float,2>{0.840227485f, 0.0890167877f},
-std::array<float,2>{0.777214289f, 0.512412906f},
-std::array<float,2>{0.208767295f, 0.39641571f},
-std::array<float,2>{0.32016924f, 0.815082371f},
-std::array<float,2>{0.663167298f, 0.167039827f},
-std::array<float,2>{0.548997104f, 0.876244068f},
-std::array<float,2>{0.400188059f, 0.0473092012f},
-std::array<float,2>{0.0585377552f, 0.74232769f},
-std::array<float,2>{0.926324606f, 0.296862215f},
-std::array<float,2>{0.850614846f, 0.994056225f},
-std::array<float,2>{0.164355248f, 0.117508069f},
-std::array<float,2>{0.304738879f, 0.632481515f},
-std::array<float,2>{0.711924374f, 0.346954882f},
-std::array<float,2>{0.610777318f, 0.619033158f},
-std::array<float,2>{0.478319168f, 0.47775656f},
-std::array<float,2>{0.0772431344f, 0.774897754f},
-std::array<float,2>{0.953570843f, 0.203297988f},
-std::array<float,2>{0.903875828f, 0.705429912f},
-std::array<float,2>{0.0211512558f, 0.27549386f},
-std::array<float,2>{0.420297086f, 0.916744828f},
-std::array<float,2>{0.510158539f, 0.0045041265f},
-std::array<float,2>{0.653253615f, 0.852832317f},
-std::array<float,2>{0.364253312f, 0.152983814f},
-std::array<float,2>{0.228040859f, 0.543672919f},
-std::array<float,2>{0.796491027f, 0.42657277f},
-std::array<float,2>{0.803873241f, 0.843023002f},
-std::array<float,2>{0.247179583f, 0.18712382f},
-std::array<float,2>{0.351966679f, 0.526623726f},
-std::array<float,2>{0.630003631f, 0.384132892f},
-std::array<float,2>{0.518807471f, 0.727406919f},
-std::array<float,2>{0.429131389f, 0.301216096f},
-std::array<float,2>{0.00579273142f, 0.904445767f},
-std::array<float,2>{0.879228234f, 0.0411429964f},
-std::array<float,2>{0.937950909f, 0.571846962f},
-std::array<float,2>{0.0793133453f, 0.443558156f},
-std::array<float,2>{0.489706695f, 0.793164074f},
-std::array<float,2>{0.601268232f, 0.227482826f},
-std::array<float,2>{0.702184439f, 0.93959558f},
-std::array<float,2>{0.2951352f, 0.0720878989f},
-std::array<float,2>{0.184187785f, 0.676341116f},
-std::array<float,2>{0.870852411f, 0.313882738f},
-std::array<float,2>{0.909820437f, 0.922071517f},
-std::array<float,2>{0.0383644253f, 0.0308695957f},
-std::array<float,2>{0.379854113f, 0.700006783f},
-std::array<float,2>{0.533495367f, 0.250296474f},
-std::array<float,2>{0.677514315f, 0.557790875f},
-std::array<float,2>{0.341146082f, 0.417094886f},
-std::array<float,2>{0.19192028f, 0.868766427f},
-std::array<float,2>{0.75382489f, 0.131173611f},
-std::array<float,2>{0.818428695f, 0.64388299f},
-std::array<float,2>{0.152889118f, 0.37016499f},
-std::array<float,2>{0.259218484f, 0.980062068f},
-std::array<float,2>{0.737383425f, 0.100237273f},
-std::array<float,2>{0.567339242f, 0.753447056f},
-std::array<float,2>{0.468578786f, 0.199226841f},
-std::array<float,2>{0.106354594f, 0.594108999f},
-std::array<float,2>{0.992700338f, 0.490808249f},
-std::array<float,2>{0.949812949f, 0.817667961f},
-std::array<float,2>{0.0868648961f, 0.168858528f},
-std::array<float,2>{0.497306913f, 0.509800255f},
-std::array<float,2>{0.605138242f, 0.393857896f},
-std::array<float,2>{0.689021587f, 0.74783814f},
-std::array<float,2>{0.283304393f, 0.289615005f},
-std::array<float,2>{0.178287879f, 0.880905688f},
-std::array<float,2>{0.859798074f, 0.0540213622f},
-std::array<float,2>{0.810265958f, 0.581088066f},
-std::array<float,2>{0.24215813f, 0.461225539f},
-std::array<float,2>{0.347686738f, 0.803097725f},
-std::array<float,2>{0.63349694f, 0.249284953f},
-std::array<float,2>{0.528560162f, 0.964213371f},
-std::array<float,2>{0.434168488f, 0.0927939862f},
-std::array<float,2>{0.0108531583f, 0.667611897f},
-std::array<float,2>{0.89020735f, 0.332865566f},
-std::array<float,2>{0.825228572f, 0.921555281f},
-std::array<float,2>{0.144186914f, 0.00192838232f},
-std::array<float,2>{0.257601112f, 0.709665775f},
-std::array<float,2>{0.744827151f, 0.278805137f},
-std::array<float,2>{0.576746881f, 0.541542828f},
-std::array<float,2>{0.460409582f, 0.425127953f},
-std::array<float,2>{0.099883981f, 0.85735476f},
-std::array<float,2>{0.989518523f, 0.148549035f},
-std::array<float,2>{0.914954364f, 0.62833333f},
-std::array<float,2>{0.0392597765f, 0.34830007f},
-std::array<float,2>{0.389733255f, 0.99962759f},
-std::array<float,2>{0.539803505f, 0.123263866f},
-std::array<float,2>{0.686540365f, 0.779956758f},
-std::array<float,2>{0.328809768f, 0.209323198f},
-std::array<float,2>{0.197713003f, 0.624872208f},
-std::array<float,2>{0.761609733f, 0.481699646f},
-std::array<float,2>{0.770460963f, 0.791684866f},
-std::array<float,2>{0.213608131f, 0.230729863f},
-std::array<float,2>{0.320428967f, 0.57614392f},
-std::array<float,2>{0.66435951f, 0.441404223f},
-std::array<float,2>{0.559226453f, 0.673398733f},
-std::array<float,2>{0.397127479f, 0.320105493f},
-std::array<float,2>{0.0531209782f, 0.943342686f},
-std::array<float,2>{0.935063541f, 0.0775473788f},
-std::array<float,2>{0.970465004f, 0.530826628f},
-std::array<float,2>{0.120194808f, 0.389354169f},
-std::array<float,2>{0.449219555f, 0.836899996f},
-std::array<float,2>{0.578189909f, 0.180897459f},
-std::array<float,2>{0.723420978f, 0.899082959f},
-std::array<float,2>{0.278639823f, 0.0436174683f},
-std::array<float,2>{0.125154942f, 0.732730031f},
-std::array<float,2>{0.833647609f, 0.297089964f},
-std::array<float,2>{0.894507885f, 0.981134117f},
-std::array<float,2>{0.0281662699f, 0.0968835354f},
-std::array<float,2>{0.412712902f, 0.644846261f},
-std::array<float,2>{0.504828215f, 0.374706447f},
-std::array<float,2>{0.644048452f, 0.599131346f},
-std::array<float,2>{0.37322554f, 0.48650977f},
-std::array<float,2>{0.22438477f, 0.75546211f},
-std::array<float,2>{0.785577774f, 0.196383491f},
-std::array<float,2>{0.855827332f, 0.697370231f},
-std::array<float,2>{0.16027157f, 0.255286366f},
-std::array<float,2>{0.303439081f, 0.926292717f},
-std::array<float,2>{0.708857477f, 0.0247589368f},
-std::array<float,2>{0.61758095f, 0.872318745f},
-std::array<float,2>{0.472480893f, 0.125463903f},
-std::array<float,2>{0.0646311492f, 0.561790705f},
-std::array<float,2>{0.968391418f, 0.421808362f},
-std::array<float,2>{0.925340712f, 0.764588952f},
-std::array<float,2>{0.0591143407f, 0.188457593f},
-std::array<float,2>{0.406077981f, 0.605362475f},
-std::array<float,2>{0.551161528f, 0.495322943f},
-std::array<float,2>{0.656940281f, 0.650026798f},
-std::array<float,2>{0.315589279f, 0.363913f},
-std::array<float,2>{0.206314832f, 0.970599651f},
-std::array<float,2>{0.777919829f, 0.108644038f},
-std::array<float,2>{0.838503957f, 0.550049067f},
-std::array<float,2>{0.134581f, 0.406755179f},
-std::array<float,2>{0.273181319f, 0.865453601f},
-std::array<float,2>{0.728578389f, 0.140427783f},
-std::array<float,2>{0.590307653f, 0.930471659f},
-std::array<float,2>{0.442616969f, 0.017618876f},
-std::array<float,2>{0.110446557f, 0.691339195f},
-std::array<float,2>{0.980066478f, 0.259270757f},
-std::array<float,2>{0.792396426f, 0.952796698f},
-std::array<float,2>{0.233883679f, 0.0700901449f},
-std::array<float,2>{0.360469818f, 0.683792949f},
-std::array<float,2>{0.650261223f, 0.326237589f},
-std::array<float,2>{0.514041364f, 0.564664423f},
-std::array<float,2>{0.415486068f, 0.45115903f},
-std::array<float,2>{0.0174206104f, 0.781375527f},
-std::array<float,2>{0.898729503f, 0.222736821f},
-std::array<float,2>{0.960123241f, 0.721924841f},
-std::array<float,2>{0.0718178526f, 0.306238174f},
-std::array<float,2>{0.48138842f, 0.896829665f},
-std::array<float,2>{0.614624381f, 0.0368612446f},
-std::array<float,2>{0.715370297f, 0.828977883f},
-std::array<float,2>{0.310308635f, 0.175395921f},
-std::array<float,2>{0.171284199f, 0.517313838f},
-std::array<float,2>{0.844178438f, 0.382018209f},
-std::array<float,2>{0.871545553f, 0.84389323f},
-std::array<float,2>{0.182948157f, 0.144930035f},
-std::array<float,2>{0.28980419f, 0.531747818f},
-std::array<float,2>{0.698612213f, 0.436904907f},
-std::array<float,2>{0.594512343f, 0.71340847f},
-std::array<float,2>{0.488177568f, 0.270387053f},
-std::array<float,2>{0.0854382291f, 0.912619889f},
-std::array<float,2>{0.944505453f, 0.0115449913f},
-std::array<float,2>{0.878744483f, 0.609735012f},
-std::array<float,2>{0.00385726709f, 0.472652584f},
-std::array<float,2>{0.425587207f, 0.770369112f},
-std::array<float,2>{0.522499323f, 0.215670913f},
-std::array<float,2>{0.628485084f, 0.990937054f},
-std::array<float,2>{0.356782198f, 0.112699509f},
-std::array<float,2>{0.242187604f, 0.633190036f},
-std::array<float,2>{0.797816455f, 0.352560401f},
-std::array<float,2>{0.999259353f, 0.886066079f},
-std::array<float,2>{0.105241358f, 0.0622331612f},
-std::array<float,2>{0.463298142f, 0.73573035f},
-std::array<float,2>{0.566298068f, 0.285155058f},
-std::array<float,2>{0.741647124f, 0.500933588f},
-std::array<float,2>{0.262017816f, 0.398926288f},
-std::array<float,2>{0.149525404f, 0.821330249f},
-std::array<float,2>{0.814930081f, 0.162060037f},
-std::array<float,2>{0.755231738f, 0.661091864f},
-std::array<float,2>{0.189748228f, 0.339657813f},
-std::array<float,2>{0.338864684f, 0.960816324f},
-std::array<float,2>{0.674558997f, 0.0788774639f},
-std::array<float,2>{0.538451791f, 0.809744835f},
-std::array<float,2>{0.377595842f, 0.236583367f},
-std::array<float,2>{0.0331912935f, 0.586171091f},
-std::array<float,2>{0.912320733f, 0.460322112f},
-std::array<float,2>{0.906754673f, 0.868637621f},
-std::array<float,2>{0.0365603082f, 0.131397977f},
-std::array<float,2>{0.380906492f, 0.558126807f},
-std::array<float,2>{0.533122718f, 0.417966425f},
-std::array<float,2>{0.678160906f, 0.699455678f},
-std::array<float,2>{0.3433927f, 0.250656992f},
-std::array<float,2>{0.193410322f, 0.922699451f},
-std::array<float,2>{0.750400662f, 0.0306514762f},
-std::array<float,2>{0.817566276f, 0.594256699f},
-std::array<float,2>{0.154845938f, 0.490515947f},
-std::array<float,2>{0.261341751f, 0.753054261f},
-std::array<float,2>{0.734919965f, 0.200114578f},
-std::array<float,2>{0.568510473f, 0.979577243f},
-std::array<float,2>{0.465403646f, 0.0999184325f},
-std::array<float,2>{0.108950332f, 0.6442191f},
-std::array<float,2>{0.99524039f, 0.370880306f},
-std::array<float,2>{0.800990701f, 0.905055046f},
-std::array<float,2>{0.248543963f, 0.0415742621f},
-std::array<float,2>{0.353969634f, 0.726586282f},
-std::array<float,2>{0.631208718f, 0.301694721f},
-std::array<float,2>{0.516503036f, 0.526886582f},
-std::array<float,2>{0.426186562f, 0.384643435f},
-std::array<float,2>{0.00610340061f, 0.843351185f},
-std::array<float,2>{0.881797493f, 0.18674624f},
-std::array<float,2>{0.940636218f, 0.675897956f},
-std::array<float,2>{0.0805590451f, 0.314013094f},
-std::array<float,2>{0.492103875f, 0.940419376f},
-std::array<float,2>{0.598943651f, 0.0716365278f},
-std::array<float,2>{0.700663269f, 0.793832242f},
-std::array<float,2>{0.293090731f, 0.226809651f},
-std::array<float,2>{0.185606405f, 0.571729839f},
-std::array<float,2>{0.867698669f, 0.444212168f},
-std::array<float,2>{0.849096656f, 0.775053561f},
-std::array<float,2>{0.166472495f, 0.204074711f},
-std::array<float,2>{0.30722785f, 0.618393123f},
-std::array<float,2>{0.713244379f, 0.478308946f},
-std::array<float,2>{0.611677706f, 0.63210088f},
-std::array<float,2>{0.479256243f, 0.347611934f},
-std::array<float,2>{0.0756870732f, 0.993349671f},
-std::array<float,2>{0.955908656f, 0.118103258f},
-std::array<float,2>{0.905305743f, 0.543261409f},
-std::array<float,2>{0.0222766716f, 0.426041007f},
-std::array<float,2>{0.417970598f, 0.853231668f},
-std::array<float,2>{0.509179711f, 0.152814671f},
-std::array<float,2>{0.654699266f, 0.916229486f},
-std::array<float,2>{0.366907269f, 0.00392429298f},
-std::array<float,2>{0.229597539f, 0.705781639f},
-std::array<float,2>{0.793318033f, 0.276206046f},
-std::array<float,2>{0.983113408f, 0.967974484f},
-std::array<float,2>{0.113464043f, 0.0894417837f},
-std::array<float,2>{0.440644681f, 0.671847105f},
-std::array<float,2>{0.589820385f, 0.329959005f},
-std::array<float,2>{0.730654359f, 0.583031178f},
-std::array<float,2>{0.268263876f, 0.465995491f},
-std::array<float,2>{0.14048478f, 0.797194958f},
-std::array<float,2>{0.842575967f, 0.246022791f},
-std::array<float,2>{0.773555636f, 0.74306345f},
-std::array<float,2>{0.210745797f, 0.296174496f},
-std::array<float,2>{0.317102343f, 0.876577139f},
-std::array<float,2>{0.661378086f, 0.0477326512f},
-std::array<float,2>{0.548348606f, 0.814865172f},
-std::array<float,2>{0.402302891f, 0.167652085f},
-std::array<float,2>{0.0564503595f, 0.511847019f},
-std::array<float,2>{0.928133965f, 0.395802617f},
-std::array<float,2>{0.963092744f, 0.807759345f},
-std::array<float,2>{0.0695979893f, 0.240533069f},
-std::array<float,2>{0.476441741f, 0.592603922f},
-std::array<float,2>{0.621537805f, 0.454502076f},
-std::array<float,2>{0.704315841f, 0.659880519f},
-std::array<float,2>{0.298570305f, 0.340155065f},
-std::array<float,2>{0.159155995f, 0.953975081f},
-std::array<float,2>{0.855402946f, 0.0829616711f},
-std::array<float,2>{0.784585655f, 0.506522059f},
-std::array<float,2>{0.222419471f, 0.403186738f},
-std::array<float,2>{0.37028721f, 0.827819228f},
-std::array<float,2>{0.645566463f, 0.159383744f},
-std::array<float,2>{0.501759887f, 0.890596569f},
-std::array<float,2>{0.406526476f, 0.0554561093f},
-std::array<float,2>{0.0245230682f, 0.740738869f},
-std::array<float,2>{0.895534039f, 0.285650402f},
-std::array<float,2>{0.830665648f, 0.986501157f},
-std::array<float,2>{0.130765513f, 0.116358474f},
-std::array<float,2>{0.277197421f, 0.63803941f},
-std::array<float,2>{0.720809698f, 0.357793987f},
-std::array<float,2>{0.583203018f, 0.614164054f},
-std::array<float,2>{0.446258724f, 0.47574994f},
-std::array<float,2>{0.123939961f, 0.766603827f},
-std::array<float,2>{0.975307226f, 0.212783426f},
-std::array<float,2>{0.930839002f, 0.715517282f},
-std::array<float,2>{0.04937049f, 0.266283721f},
-std::array<float,2>{0.392417312f, 0.908890247f},
-std::array<float,2>{0.555964887f, 0.0143105211f},
-std::array<float,2>{0.671323001f, 0.850778759f},
-std::array<float,2>{0.327150136f, 0.141300142f},
-std::array<float,2>{0.215530008f, 0.537043035f},
-std::array<float,2>{0.767678678f, 0.433550745f},
-std::array<float,2>{0.761787176f, 0.833751023f},
-std::array<float,2>{0.199937701f, 0.17933996f},
-std::array<float,2>{0.335226774f, 0.519711316f},
-std::array<float,2>{0.68024236f, 0.377016693f},
-std::array<float,2>{0.544920862f, 0.723182917f},
-std::array<float,2>{0.385524631f, 0.311807394f},
-std::array<float,2>{0.0464491248f, 0.892960608f},
-std::array<float,2>{0.919451118f, 0.0335093774f},
-std::array<float,2>{0.986424863f, 0.567443252f},
-std::array<float,2>{0.0957741886f, 0.448792815f},
-std::array<float,2>{0.453438193f, 0.788458169f},
-std::array<float,2>{0.573864996f, 0.220230713f},
-std::array<float,2>{0.746925116f, 0.9488222f},
-std::array<float,2>{0.250103325f, 0.0630015135f},
-std::array<float,2>{0.147117555f, 0.680916548f},
-std::array<float,2>{0.820968509f, 0.321292073f},
-std::array<float,2>{0.886274636f, 0.935855091f},
-std::array<float,2>{0.0120559055f, 0.0196090098f},
-std::array<float,2>{0.432996243f, 0.691522777f},
-std::array<float,2>{0.525790513f, 0.261846989f},
-std::array<float,2>{0.639063418f, 0.554097235f},
-std::array<float,2>{0.347008675f, 0.41078338f},
-std::array<float,2>{0.23477678f, 0.860218942f},
-std::array<float,2>{0.805169284f, 0.135183915f},
-std::array<float,2>{0.863574088f, 0.653180242f},
-std::array<float,2>{0.17432031f, 0.36110875f},
-std::array<float,2>{0.286624789f, 0.972926617f},
-std::array<float,2>{0.693955123f, 0.103934228f},
-std::array<float,2>{0.606104314f, 0.7605654f},
-std::array<float,2>{0.495592684f, 0.193159238f},
-std::array<float,2>{0.0900075212f, 0.608906031f},
-std::array<float,2>{0.948286593f, 0.498158365f},
-std::array<float,2>{0.996563911f, 0.822184503f},
-std::array<float,2>{0.10238295f, 0.161533073f},
-std::array<float,2>{0.461451918f, 0.500145555f},
-std::array<float,2>{0.563549161f, 0.398614347f},
-std::array<float,2>{0.739010513f, 0.73609823f},
-std::array<float,2>{0.264436096f, 0.284480661f},
-std::array<float,2>{0.150704816f, 0.886707425f},
-std::array<float,2>{0.812676489f, 0.0619848929f},
-std::array<float,2>{0.757575333f, 0.586854875f},
-std::array<float,2>{0.188866407f, 0.460679621f},
-std::array<float,2>{0.337222517f, 0.810427904f},
-std::array<float,2>{0.672783375f, 0.236957356f},
-std::array<float,2>{0.535244048f, 0.959984481f},
-std::array<float,2>{0.376192927f, 0.0784222335f},
-std::array<float,2>{0.0347218253f, 0.660449505f},
-std::array<float,2>{0.911239266f, 0.339020669f},
-std::array<float,2>{0.873987377f, 0.912146688f},
-std::array<float,2>{0.181228682f, 0.0111930743f},
-std::array<float,2>{0.291382939f, 0.713018f},
-std::array<float,2>{0.695486724f, 0.269607812f},
-std::array<float,2>{0.596841335f, 0.531630158f},
-std::array<float,2>{0.485310078f, 0.437036276f},
-std::array<float,2>{0.0831285939f, 0.844655812f},
-std::array<float,2>{0.943233371f, 0.145061299f},
-std::array<float,2>{0.875535548f, 0.63353008f},
-std::array<float,2>{0.00126174605f, 0.353450269f},
-std::array<float,2>{0.422393501f, 0.990449786f},
-std::array<float,2>{0.520736694f, 0.112812921f},
-std::array<float,2>{0.626867712f, 0.769778252f},
-std::array<float,2>{0.359313726f, 0.214951456f},
-std::array<float,2>{0.244445562f, 0.610128403f},
-std::array<float,2>{0.79987067f, 0.472135842f},
-std::array<float,2>{0.789260507f, 0.782064855f},
-std::array<float,2>{0.231984228f, 0.223207146f},
-std::array<float,2>{0.362789661f, 0.565145612f},
-std::array<float,2>{0.651962638f, 0.450621426f},
-std::array<float,2>{0.512390256f, 0.684281111f},
-std::array<float,2>{0.417026728f, 0.326910287f},
-std::array<float,2>{0.0181200244f, 0.952409625f},
-std::array<float,2>{0.90064317f, 0.0694502369f},
-std::array<float,2>{0.957500041f, 0.51696372f},
-std::array<float,2>{0.0724273846f, 0.382443875f},
-std::array<float,2>{0.48395732f, 0.828521848f},
-std::array<float,2>{0.615821838f, 0.175254315f},
-std::array<float,2>{0.717094243f, 0.897267759f},
-std::array<float,2>{0.311993271f, 0.0362044051f},
-std::array<float,2>{0.169610351f, 0.722512841f},
-std::array<float,2>{0.847213387f, 0.305800974f},
-std::array<float,2>{0.922352016f, 0.969795704f},
-std::array<float,2>{0.0609713718f, 0.109302245f},
-std::array<float,2>{0.402409315f, 0.64948386f},
-std::array<float,2>{0.552779555f, 0.363739491f},
-std::array<float,2>{0.658244193f, 0.604797125f},
-std::array<float,2>{0.31444177f, 0.495786816f},
-std::array<float,2>{0.204551443f, 0.76402247f},
-std::array<float,2>{0.780935466f, 0.187637195f},
-std::array<float,2>{0.83698523f, 0.69058913f},
-std::array<float,2>{0.135560408f, 0.259629816f},
-std::array<float,2>{0.269858122f, 0.929969072f},
-std::array<float,2>{0.726828456f, 0.0181145277f},
-std::array<float,2>{0.593667209f, 0.86596626f},
-std::array<float,2>{0.443968654f, 0.139960781f},
-std::array<float,2>{0.113141686f, 0.550773561f},
-std::array<float,2>{0.977820218f, 0.406505197f},
-std::array<float,2>{0.891731441f, 0.755244315f},
-std::array<float,2>{0.0304929931f, 0.19680281f},
-std::array<float,2>{0.41129148f, 0.598699927f},
-std::array<float,2>{0.507487953f, 0.48725301f},
-std::array<float,2>{0.641246974f, 0.645115435f},
-std::array<float,2>{0.371643543f, 0.374269933f},
-std::array<float,2>{0.225869238f, 0.980928302f},
-std::array<float,2>{0.788800836f, 0.0975815877f},
-std::array<float,2>{0.858860433f, 0.562193513f},
-std::array<float,2>{0.163333714f, 0.421319723f},
-std::array<float,2>{0.302427649f, 0.873012304f},
-std::array<float,2>{0.710359335f, 0.125627756f},
-std::array<float,2>{0.619164646f, 0.926175833f},
-std::array<float,2>{0.469296426f, 0.0250222925f},
-std::array<float,2>{0.0635737926f, 0.697962821f},
-std::array<float,2>{0.966658592f, 0.255459338f},
-std::array<float,2>{0.771597385f, 0.942589939f},
-std::array<float,2>{0.212529615f, 0.0777230114f},
-std::array<float,2>{0.323674947f, 0.672947526f},
-std::array<float,2>{0.666054785f, 0.319608778f},
-std::array<float,2>{0.561272264f, 0.575412393f},
-std::array<float,2>{0.395676762f, 0.440486431f},
-std::array<float,2>{0.0515083894f, 0.791350245f},
-std::array<float,2>{0.936723948f, 0.230957732f},
-std::array<float,2>{0.970739007f, 0.732934833f},
-std::array<float,2>{0.118020535f, 0.297680438f},
-std::array<float,2>{0.452635765f, 0.898883581f},
-std::array<float,2>{0.581655204f, 0.0430073291f},
-std::array<float,2>{0.725455403f, 0.83627671f},
-std::array<float,2>{0.28055951f, 0.18161492f},
-std::array<float,2>{0.127365991f, 0.530339479f},
-std::array<float,2>{0.834752202f, 0.388996631f},
-std::array<float,2>{0.828108013f, 0.856813788f},
-std::array<float,2>{0.141609326f, 0.149365291f},
-std::array<float,2>{0.253977537f, 0.54102999f},
-std::array<float,2>{0.743668795f, 0.425408512f},
-std::array<float,2>{0.57544452f, 0.709042072f},
-std::array<float,2>{0.457907975f, 0.278879493f},
-std::array<float,2>{0.097956188f, 0.92104286f},
-std::array<float,2>{0.990938485f, 0.00135374756f},
-std::array<float,2>{0.91766113f, 0.624136746f},
-std::array<float,2>{0.0421787351f, 0.482297599f},
-std::array<float,2>{0.388391078f, 0.779539168f},
-std::array<float,2>{0.541228831f, 0.20966804f},
-std::array<float,2>{0.685242712f, 0.999450147f},
-std::array<float,2>{0.330258757f, 0.123725042f},
-std::array<float,2>{0.195678249f, 0.628577411f},
-std::array<float,2>{0.759527087f, 0.347987592f},
-std::array<float,2>{0.951493919f, 0.881435692f},
-std::array<float,2>{0.0892669559f, 0.0545029193f},
-std::array<float,2>{0.498175293f, 0.747341752f},
-std::array<float,2>{0.603359699f, 0.289394259f},
-std::array<float,2>{0.690590441f, 0.510296524f},
-std::array<float,2>{0.281417042f, 0.394337505f},
-std::array<float,2>{0.176137879f, 0.817944169f},
-std::array<float,2>{0.86147505f, 0.168452397f},
-std::array<float,2>{0.812401652f, 0.667300463f},
-std::array<float,2>{0.240106046f, 0.332378119f},
-std::array<float,2>{0.351366758f, 0.964562356f},
-std::array<float,2>{0.636230946f, 0.0936665908f},
-std::array<float,2>{0.531175494f, 0.803346694f},
-std::array<float,2>{0.43677634f, 0.249718934f},
-std::array<float,2>{0.00794538856f, 0.581799746f},
-std::array<float,2>{0.887606144f, 0.461592168f},
-std::array<float,2>{0.879544199f, 0.841746807f},
-std::array<float,2>{0.00493014744f, 0.18424201f},
-std::array<float,2>{0.429669648f, 0.525205135f},
-std::array<float,2>{0.51949352f, 0.385409951f},
-std::array<float,2>{0.630727649f, 0.729990721f},
-std::array<float,2>{0.352100223f, 0.303726017f},
-std::array<float,2>{0.247586727f, 0.903652728f},
-std::array<float,2>{0.804296255f, 0.0400285907f},
-std::array<float,2>{0.870189011f, 0.572436333f},
-std::array<float,2>{0.184054166f, 0.442687064f},
-std::array<float,2>{0.295722753f, 0.79519558f},
-std::array<float,2>{0.702965021f, 0.228744611f},
-std::array<float,2>{0.600896657f, 0.938876688f},
-std::array<float,2>{0.490179062f, 0.0727995932f},
-std::array<float,2>{0.079791896f, 0.678779662f},
-std::array<float,2>{0.938144088f, 0.314519435f},
-std::array<float,2>{0.75319463f, 0.924667478f},
-std::array<float,2>{0.191699311f, 0.0291404705f},
-std::array<float,2>{0.341508746f, 0.702347219f},
-std::array<float,2>{0.676760554f, 0.25256303f},
-std::array<float,2>{0.534150958f, 0.554999292f},
-std::array<float,2>{0.378999621f, 0.414413452f},
-std::array<float,2>{0.038947273f, 0.869597614f},
-std::array<float,2>{0.909516931f, 0.128963053f},
-std::array<float,2>{0.992348313f, 0.642116129f},
-std::array<float,2>{0.105663843f, 0.367292255f},
-std::array<float,2>{0.468012959f, 0.977108121f},
-std::array<float,2>{0.566868186f, 0.097934857f},
-std::array<float,2>{0.737807631f, 0.750771523f},
-std::array<float,2>{0.259688318f, 0.201734617f},
-std::array<float,2>{0.15270336f, 0.596400082f},
-std::array<float,2>{0.819020689f, 0.488460481f},
-std::array<float,2>{0.840685785f, 0.799198091f},
-std::array<float,2>{0.137268171f, 0.242398143f},
-std::array<float,2>{0.266149163f, 0.585857689f},
-std::array<float,2>{0.732647538f, 0.468681425f},
-std::array<float,2>{0.58763963f, 0.668337882f},
-std::array<float,2>{0.438473582f, 0.331638128f},
-std::array<float,2>{0.116485931f, 0.965743065f},
-std::array<float,2>{0.981786668f, 0.0876017809f},
-std::array<float,2>{0.926139474f, 0.514722168f},
-std::array<float,2>{0.0577909574f, 0.396795452f},
-std::array<float,2>{0.399506271f, 0.812978208f},
-std::array<float,2>{0.549372613f, 0.165864095f},
-std::array<float,2>{0.663998604f, 0.877292514f},
-std::array<float,2>{0.319546998f, 0.0494721904f},
-std::array<float,2>{0.208093524f, 0.744377017f},
-std::array<float,2>{0.776479423f, 0.293868154f},
-std::array<float,2>{0.953961253f, 0.994167089f},
-std::array<float,2>{0.0778634399f, 0.120759949f},
-std::array<float,2>{0.477786064f, 0.629910231f},
-std::array<float,2>{0.610861242f, 0.345033169f},
-std::array<float,2>{0.712454796f, 0.619378507f},
-std::array<float,2>{0.305451602f, 0.478929639f},
-std::array<float,2>{0.164610252f, 0.777113497f},
-std::array<float,2>{0.85111469f, 0.205869406f},
-std::array<float,2>{0.796219826f, 0.704507411f},
-std::array<float,2>{0.227554291f, 0.273683906f},
-std::array<float,2>{0.3637366f, 0.914377987f},
-std::array<float,2>{0.652368486f, 0.00746416906f},
-std::array<float,2>{0.510340571f, 0.853596985f},
-std::array<float,2>{0.420793802f, 0.155198991f},
-std::array<float,2>{0.0208089389f, 0.545625985f},
-std::array<float,2>{0.903443575f, 0.429472327f},
-std::array<float,2>{0.972890437f, 0.769359529f},
-std::array<float,2>{0.122061566f, 0.214643568f},
-std::array<float,2>{0.447791815f, 0.615859926f},
-std::array<float,2>{0.585016966f, 0.474266917f},
-std::array<float,2>{0.71982789f, 0.639785111f},
-std::array<float,2>{0.27537635f, 0.357018799f},
-std::array<float,2>{0.131114095f, 0.985666037f},
-std::array<float,2>{0.828559577f, 0.114381373f},
-std::array<float,2>{0.765712202f, 0.538828492f},
-std::array<float,2>{0.217492476f, 0.431451589f},
-std::array<float,2>{0.32534194f, 0.849106848f},
-std::array<float,2>{0.668480158f, 0.144130901f},
-std::array<float,2>{0.558559179f, 0.907004893f},
-std::array<float,2>{0.393348575f, 0.012551344f},
-std::array<float,2>{0.0480863377f, 0.71848911f},
-std::array<float,2>{0.93323648f, 0.269217074f},
-std::array<float,2>{0.852455318f, 0.955208838f},
-std::array<float,2>{0.157091096f, 0.0858818516f},
-std::array<float,2>{0.300268322f, 0.657001913f},
-std::array<float,2>{0.706976771f, 0.343016654f},
-std::array<float,2>{0.623294532f, 0.590656996f},
-std::array<float,2>{0.473023474f, 0.455408782f},
-std::array<float,2>{0.0664258599f, 0.806443989f},
-std::array<float,2>{0.961854577f, 0.238450348f},
-std::array<float,2>{0.896702766f, 0.738493204f},
-std::array<float,2>{0.0260863863f, 0.288906783f},
-std::array<float,2>{0.408903539f, 0.887200892f},
-std::array<float,2>{0.502686262f, 0.056651637f},
-std::array<float,2>{0.648026645f, 0.825447977f},
-std::array<float,2>{0.367964029f, 0.156737372f},
-std::array<float,2>{0.219304398f, 0.505765617f},
-std::array<float,2>{0.782714546f, 0.406048208f},
-std::array<float,2>{0.807870865f, 0.863192558f},
-std::array<float,2>{0.238249332f, 0.133076891f},
-std::array<float,2>{0.344535887f, 0.550952911f},
-std::array<float,2>{0.637467206f, 0.412245482f},
-std::array<float,2>{0.524828851f, 0.69370532f},
-std::array<float,2>{0.429818064f, 0.265510738f},
-std::array<float,2>{0.0153283561f, 0.934425116f},
-std::array<float,2>{0.883813918f, 0.0230581239f},
-std::array<float,2>{0.945357561f, 0.606510222f},
-std::array<float,2>{0.0936317593f, 0.49649927f},
-std::array<float,2>{0.493132949f, 0.758563757f},
-std::array<float,2>{0.607906461f, 0.195101574f},
-std::array<float,2>{0.691708684f, 0.975740433f},
-std::array<float,2>{0.288488209f, 0.102110185f},
-std::array<float,2>{0.173511788f, 0.654768467f},
-std::array<float,2>{0.865974486f, 0.363121837f},
-std::array<float,2>{0.921259046f, 0.892348647f},
-std::array<float,2>{0.0447304547f, 0.0314989462f},
-std::array<float,2>{0.384395123f, 0.725721061f},
-std::array<float,2>{0.54492861f, 0.308600008f},
-std::array<float,2>{0.683369219f, 0.52287215f},
-std::array<float,2>{0.333117992f, 0.376870245f},
-std::array<float,2>{0.202346399f, 0.835878909f},
-std::array<float,2>{0.763742507f, 0.175793007f},
-std::array<float,2>{0.822704554f, 0.682550848f},
-std::array<float,2>{0.144595072f, 0.323774964f},
-std::array<float,2>{0.252061784f, 0.945939302f},
-std::array<float,2>{0.749293745f, 0.0645515993f},
-std::array<float,2>{0.570738077f, 0.785243809f},
-std::array<float,2>{0.456351221f, 0.221516654f},
-std::array<float,2>{0.0946247205f, 0.568867207f},
-std::array<float,2>{0.985386729f, 0.445866287f},
-std::array<float,2>{0.945261359f, 0.846461833f},
-std::array<float,2>{0.0859354213f, 0.146516994f},
-std::array<float,2>{0.487425596f, 0.533931792f},
-std::array<float,2>{0.593928993f, 0.43361944f},
-std::array<float,2>{0.699135303f, 0.711390436f},
-std::array<float,2>{0.289180279f, 0.272834152f},
-std::array<float,2>{0.183416456f, 0.911582947f},
-std::array<float,2>{0.872059464f, 0.00830178056f},
-std::array<float,2>{0.797047675f, 0.612276375f},
-std::array<float,2>{0.242973641f, 0.469807595f},
-std::array<float,2>{0.357128501f, 0.771695971f},
-std::array<float,2>{0.628286242f, 0.2183806f},
-std::array<float,2>{0.522958219f, 0.988945305f},
-std::array<float,2>{0.425154001f, 0.109503023f},
-std::array<float,2>{0.0030613998f, 0.635412157f},
-std::array<float,2>{0.878218889f, 0.35421744f},
-std::array<float,2>{0.815396905f, 0.884559393f},
-std::array<float,2>{0.150204301f, 0.0587221533f},
-std::array<float,2>{0.262384892f, 0.737874866f},
-std::array<float,2>{0.742160499f, 0.281906992f},
-std::array<float,2>{0.565766275f, 0.503740311f},
-std::array<float,2>{0.463833243f, 0.40123862f},
-std::array<float,2>{0.104812294f, 0.823808849f},
-std::array<float,2>{0.999746084f, 0.162818968f},
-std::array<float,2>{0.912719011f, 0.66234982f},
-std::array<float,2>{0.03239806f, 0.336121857f},
-std::array<float,2>{0.377058566f, 0.958832145f},
-std::array<float,2>{0.538666308f, 0.080557324f},
-std::array<float,2>{0.674194455f, 0.810580671f},
-std::array<float,2>{0.338373184f, 0.234809175f},
-std::array<float,2>{0.190006688f, 0.589114368f},
-std::array<float,2>{0.755634904f, 0.457265615f},
-std::array<float,2>{0.777632117f, 0.763050556f},
-std::array<float,2>{0.20660156f, 0.191236913f},
-std::array<float,2>{0.315961897f, 0.601755798f},
-std::array<float,2>{0.656578422f, 0.492981941f},
-std::array<float,2>{0.551531315f, 0.652194083f},
-std::array<float,2>{0.405307889f, 0.367158711f},
-std::array<float,2>{0.0586681552f, 0.970712721f},
-std::array<float,2>{0.925146699f, 0.105983026f},
-std::array<float,2>{0.979911864f, 0.54695791f},
-std::array<float,2>{0.111144677f, 0.408447593f},
-std::array<float,2>{0.443293989f, 0.864994764f},
-std::array<float,2>{0.590488672f, 0.138055131f},
-std::array<float,2>{0.729442179f, 0.932382345f},
-std::array<float,2>{0.272808433f, 0.0170323849f},
-std::array<float,2>{0.133947223f, 0.687842786f},
-std::array<float,2>{0.838028789f, 0.261439264f},
-std::array<float,2>{0.899092913f, 0.949597239f},
-std::array<float,2>{0.0170323104f, 0.0669689626f},
-std::array<float,2>{0.415786922f, 0.686057806f},
-std::array<float,2>{0.514380217f, 0.325168788f},
-std::array<float,2>{0.649443626f, 0.564193726f},
-std::array<float,2>{0.361014605f, 0.45160228f},
-std::array<float,2>{0.234291717f, 0.78385365f},
-std::array<float,2>{0.792746603f, 0.22553663f},
-std::array<float,2>{0.844473362f, 0.719766915f},
-std::array<float,2>{0.171746105f, 0.307257593f},
-std::array<float,2>{0.309717983f, 0.895833194f},
-std::array<float,2>{0.715057015f, 0.038655933f},
-std::array<float,2>{0.615227461f, 0.832002223f},
-std::array<float,2>{0.480904371f, 0.172452241f},
-std::array<float,2>{0.071495533f, 0.518637359f},
-std::array<float,2>{0.960767686f, 0.380027503f},
-std::array<float,2>{0.934570372f, 0.790544331f},
-std::array<float,2>{0.0535761267f, 0.232463345f},
-std::array<float,2>{0.396706134f, 0.577850938f},
-std::array<float,2>{0.559076667f, 0.438780218f},
-std::array<float,2>{0.664649963f, 0.674709916f},
-std::array<float,2>{0.321184307f, 0.3170968f},
-std::array<float,2>{0.213164553f, 0.94452256f},
-std::array<float,2>{0.769680023f, 0.0761469081f},
-std::array<float,2>{0.83328861f, 0.529283106f},
-std::array<float,2>{0.125502437f, 0.386735708f},
-std::array<float,2>{0.278880626f, 0.838713884f},
-std::array<float,2>{0.72281605f, 0.182997957f},
-std::array<float,2>{0.578984022f, 0.902021587f},
-std::array<float,2>{0.450113326f, 0.0449865013f},
-std::array<float,2>{0.120653175f, 0.731806278f},
-std::array<float,2>{0.970043898f, 0.299840808f},
-std::array<float,2>{0.785848081f, 0.983394682f},
-std::array<float,2>{0.22392872f, 0.0956557319f},
-std::array<float,2>{0.373843938f, 0.64800483f},
-std::array<float,2>{0.643761575f, 0.372860044f},
-std::array<float,2>{0.504293263f, 0.601248205f},
-std::array<float,2>{0.412444323f, 0.484817564f},
-std::array<float,2>{0.0275632143f, 0.756882191f},
-std::array<float,2>{0.893654048f, 0.197795942f},
-std::array<float,2>{0.967964172f, 0.69675523f},
-std::array<float,2>{0.064953573f, 0.256675899f},
-std::array<float,2>{0.471904367f, 0.928415596f},
-std::array<float,2>{0.617894173f, 0.0268240999f},
-std::array<float,2>{0.708228886f, 0.873487175f},
-std::array<float,2>{0.302885264f, 0.127673268f},
-std::array<float,2>{0.16065672f, 0.559895396f},
-std::array<float,2>{0.856352627f, 0.418438166f},
-std::array<float,2>{0.859878361f, 0.818892539f},
-std::array<float,2>{0.177804217f, 0.170063987f},
-std::array<float,2>{0.283801496f, 0.508412182f},
-std::array<float,2>{0.688760638f, 0.390656501f},
-std::array<float,2>{0.604539692f, 0.749025881f},
-std::array<float,2>{0.497637361f, 0.291691393f},
-std::array<float,2>{0.0861094669f, 0.880471945f},
-std::array<float,2>{0.949679732f, 0.0519682132f},
-std::array<float,2>{0.89003402f, 0.579381824f},
-std::array<float,2>{0.0113842459f, 0.463714838f},
-std::array<float,2>{0.433697075f, 0.80119884f},
-std::array<float,2>{0.529011905f, 0.247018501f},
-std::array<float,2>{0.633110583f, 0.96242404f},
-std::array<float,2>{0.348434508f, 0.0904239789f},
-std::array<float,2>{0.241569176f, 0.664628685f},
-std::array<float,2>{0.809879482f, 0.335424125f},
-std::array<float,2>{0.989940345f, 0.919726551f},
-std::array<float,2>{0.100171871f, 0.00334988115f},
-std::array<float,2>{0.460834295f, 0.708739221f},
-std::array<float,2>{0.576529801f, 0.280560583f},
-std::array<float,2>{0.744160175f, 0.540512025f},
-std::array<float,2>{0.256873697f, 0.422994882f},
-std::array<float,2>{0.143641651f, 0.857697904f},
-std::array<float,2>{0.825969636f, 0.151461974f},
-std::array<float,2>{0.760942519f, 0.625039339f},
-std::array<float,2>{0.197973505f, 0.349860758f},
-std::array<float,2>{0.328340441f, 0.997978687f},
-std::array<float,2>{0.68706882f, 0.122052647f},
-std::array<float,2>{0.539259374f, 0.779284835f},
-std::array<float,2>{0.390490234f, 0.207478076f},
-std::array<float,2>{0.0400199927f, 0.622617364f},
-std::array<float,2>{0.914207995f, 0.483011782f},
-std::array<float,2>{0.928801596f, 0.81441319f},
-std::array<float,2>{0.0548678748f, 0.164722636f},
-std::array<float,2>{0.401283652f, 0.514027238f},
-std::array<float,2>{0.547840118f, 0.398278028f},
-std::array<float,2>{0.661014259f, 0.745270252f},
-std::array<float,2>{0.317708403f, 0.294429302f},
-std::array<float,2>{0.209547177f, 0.87807709f},
-std::array<float,2>{0.775220037f, 0.0500263087f},
-std::array<float,2>{0.842860937f, 0.584314585f},
-std::array<float,2>{0.139639571f, 0.466987908f},
-std::array<float,2>{0.269178897f, 0.800452113f},
-std::array<float,2>{0.731482863f, 0.243615225f},
-std::array<float,2>{0.5885396f, 0.966483474f},
-std::array<float,2>{0.440261453f, 0.0861260742f},
-std::array<float,2>{0.114937849f, 0.669853926f},
-std::array<float,2>{0.983437777f, 0.330470413f},
-std::array<float,2>{0.79481709f, 0.915891945f},
-std::array<float,2>{0.228975296f, 0.00660998002f},
-std::array<float,2>{0.366186917f, 0.703417778f},
-std::array<float,2>{0.655714869f, 0.274707615f},
-std::array<float,2>{0.508649468f, 0.546697259f},
-std::array<float,2>{0.419359803f, 0.427799016f},
-std::array<float,2>{0.0228659473f, 0.855268359f},
-std::array<float,2>{0.904603779f, 0.156069025f},
-std::array<float,2>{0.956080794f, 0.629705131f},
-std::array<float,2>{0.0744694099f, 0.344688684f},
-std::array<float,2>{0.48022449f, 0.995199621f},
-std::array<float,2>{0.612942934f, 0.119416043f},
-std::array<float,2>{0.714196026f, 0.775728226f},
-std::array<float,2>{0.308210313f, 0.206443861f},
-std::array<float,2>{0.16744414f, 0.620316923f},
-std::array<float,2>{0.848398566f, 0.479546368f},
-std::array<float,2>{0.868691742f, 0.796816051f},
-std::array<float,2>{0.186844796f, 0.230288371f},
-std::array<float,2>{0.294275314f, 0.57353574f},
-std::array<float,2>{0.699576199f, 0.441650093f},
-std::array<float,2>{0.598519742f, 0.678611517f},
-std::array<float,2>{0.491176844f, 0.316394001f},
-std::array<float,2>{0.0816858634f, 0.93843019f},
-std::array<float,2>{0.939502001f, 0.0736222491f},
-std::array<float,2>{0.882247448f, 0.523993254f},
-std::array<float,2>{0.00747999037f, 0.385842472f},
-std::array<float,2>{0.427467912f, 0.840099692f},
-std::array<float,2>{0.517465532f, 0.184937835f},
-std::array<float,2>{0.632495224f, 0.903158307f},
-std::array<float,2>{0.355220109f, 0.0408151932f},
-std::array<float,2>{0.24986507f, 0.728976905f},
-std::array<float,2>{0.802578032f, 0.303545028f},
-std::array<float,2>{0.994763553f, 0.977905333f},
-std::array<float,2>{0.108089708f, 0.0991686881f},
-std::array<float,2>{0.466464013f, 0.640862167f},
-std::array<float,2>{0.569890857f, 0.368441075f},
-std::array<float,2>{0.73594898f, 0.596995771f},
-std::array<float,2>{0.26000151f, 0.489988267f},
-std::array<float,2>{0.156197637f, 0.751166821f},
-std::array<float,2>{0.816531181f, 0.202374145f},
-std::array<float,2>{0.751824439f, 0.701569438f},
-std::array<float,2>{0.194985032f, 0.253148705f},
-std::array<float,2>{0.342117041f, 0.925038815f},
-std::array<float,2>{0.679370582f, 0.0279381461f},
-std::array<float,2>{0.531934917f, 0.870460808f},
-std::array<float,2>{0.382594764f, 0.129976287f},
-std::array<float,2>{0.0353454128f, 0.556254208f},
-std::array<float,2>{0.908073604f, 0.41538161f},
-std::array<float,2>{0.947360754f, 0.759657562f},
-std::array<float,2>{0.0912059471f, 0.194139406f},
-std::array<float,2>{0.49422437f, 0.606012166f},
-std::array<float,2>{0.607239604f, 0.497901708f},
-std::array<float,2>{0.694456995f, 0.655913413f},
-std::array<float,2>{0.285793751f, 0.361709476f},
-std::array<float,2>{0.175649628f, 0.975578845f},
-std::array<float,2>{0.864773452f, 0.102862529f},
-std::array<float,2>{0.80629158f, 0.551813781f},
-std::array<float,2>{0.235541463f, 0.413703829f},
-std::array<float,2>{0.346124679f, 0.861348808f},
-std::array<float,2>{0.63991791f, 0.133992657f},
-std::array<float,2>{0.527096391f, 0.935066164f},
-std::array<float,2>{0.431999803f, 0.0219480749f},
-std::array<float,2>{0.0129676713f, 0.69519496f},
-std::array<float,2>{0.885088623f, 0.263774902f},
-std::array<float,2>{0.822124779f, 0.946720839f},
-std::array<float,2>{0.148117557f, 0.0661899596f},
-std::array<float,2>{0.251510262f, 0.683116317f},
-std::array<float,2>{0.747429907f, 0.323074162f},
-std::array<float,2>{0.572731614f, 0.569573641f},
-std::array<float,2>{0.454571605f, 0.447076946f},
-std::array<float,2>{0.0975324437f, 0.786350012f},
-std::array<float,2>{0.98817414f, 0.222500131f},
-std::array<float,2>{0.91843909f, 0.72464031f},
-std::array<float,2>{0.0449369103f, 0.309682131f},
-std::array<float,2>{0.386075616f, 0.89086777f},
-std::array<float,2>{0.543516934f, 0.0325673446f},
-std::array<float,2>{0.681290507f, 0.834195733f},
-std::array<float,2>{0.334144831f, 0.177519158f},
-std::array<float,2>{0.200780839f, 0.521631718f},
-std::array<float,2>{0.76278013f, 0.375501245f},
-std::array<float,2>{0.769322991f, 0.848366797f},
-std::array<float,2>{0.215882704f, 0.143412888f},
-std::array<float,2>{0.326202989f, 0.537559748f},
-std::array<float,2>{0.670475304f, 0.430088341f},
-std::array<float,2>{0.5554111f, 0.716874182f},
-std::array<float,2>{0.390834332f, 0.268314809f},
-std::array<float,2>{0.0504128113f, 0.907936335f},
-std::array<float,2>{0.929874897f, 0.0128616225f},
-std::array<float,2>{0.975647449f, 0.616729319f},
-std::array<float,2>{0.1241678f, 0.473002106f},
-std::array<float,2>{0.446297467f, 0.76850456f},
-std::array<float,2>{0.582928061f, 0.213768423f},
-std::array<float,2>{0.722450674f, 0.98491323f},
-std::array<float,2>{0.275940835f, 0.113661453f},
-std::array<float,2>{0.129368365f, 0.639003277f},
-std::array<float,2>{0.831112504f, 0.355627537f},
-std::array<float,2>{0.895225942f, 0.888488233f},
-std::array<float,2>{0.0243882183f, 0.0580210537f},
-std::array<float,2>{0.407605648f, 0.739513338f},
-std::array<float,2>{0.500948429f, 0.287228465f},
-std::array<float,2>{0.645382941f, 0.50426805f},
-std::array<float,2>{0.369830877f, 0.405023754f},
-std::array<float,2>{0.22093913f, 0.824671388f},
-std::array<float,2>{0.784040749f, 0.157410994f},
-std::array<float,2>{0.853988469f, 0.658061028f},
-std::array<float,2>{0.160145059f, 0.342637867f},
-std::array<float,2>{0.297535896f, 0.956422329f},
-std::array<float,2>{0.703768551f, 0.0842914581f},
-std::array<float,2>{0.622276664f, 0.805607855f},
-std::array<float,2>{0.475508511f, 0.239918768f},
-std::array<float,2>{0.0689084157f, 0.591135323f},
-std::array<float,2>{0.964368403f, 0.456166327f},
-std::array<float,2>{0.976641238f, 0.864153802f},
-std::array<float,2>{0.111931339f, 0.137622461f},
-std::array<float,2>{0.444356799f, 0.548592687f},
-std::array<float,2>{0.592496216f, 0.410035133f},
-std::array<float,2>{0.728209734f, 0.689423203f},
-std::array<float,2>{0.270772904f, 0.260131955f},
-std::array<float,2>{0.135871455f, 0.932858288f},
-std::array<float,2>{0.83671236f, 0.0160299279f},
-std::array<float,2>{0.779706717f, 0.603235483f},
-std::array<float,2>{0.204043746f, 0.494090468f},
-std::array<float,2>{0.313004941f, 0.762157917f},
-std::array<float,2>{0.659901202f, 0.189502195f},
-std::array<float,2>{0.553925991f, 0.971905828f},
-std::array<float,2>{0.404240042f, 0.106579483f},
-std::array<float,2>{0.0620582737f, 0.650772512f},
-std::array<float,2>{0.923598647f, 0.365375072f},
-std::array<float,2>{0.845902801f, 0.894616485f},
-std::array<float,2>{0.168682665f, 0.0375338793f},
-std::array<float,2>{0.311235994f, 0.718767226f},
-std::array<float,2>{0.718067408f, 0.308517188f},
-std::array<float,2>{0.616518617f, 0.518370032f},
-std::array<float,2>{0.482782692f, 0.37937811f},
-std::array<float,2>{0.0736061037f, 0.830086172f},
-std::array<float,2>{0.958138883f, 0.17316325f},
-std::array<float,2>{0.902069628f, 0.686577022f},
-std::array<float,2>{0.0187176596f, 0.32581982f},
-std::array<float,2>{0.416239917f, 0.950457752f},
-std::array<float,2>{0.513012826f, 0.0681430548f},
-std::array<float,2>{0.650821865f, 0.784386575f},
-std::array<float,2>{0.361664742f, 0.226134881f},
-std::array<float,2>{0.231377229f, 0.563252687f},
-std::array<float,2>{0.790042579f, 0.452421039f},
-std::array<float,2>{0.798890591f, 0.773432016f},
-std::array<float,2>{0.245455205f, 0.217677444f},
-std::array<float,2>{0.357970297f, 0.613206685f},
-std::array<float,2>{0.625034809f, 0.469298601f},
-std::array<float,2>{0.519875586f, 0.635900915f},
-std::array<float,2>{0.423462629f, 0.355222911f},
-std::array<float,2>{0.0001461996f, 0.989931941f},
-std::array<float,2>{0.876041949f, 0.111149512f},
-std::array<float,2>{0.942168415f, 0.534651101f},
-std::array<float,2>{0.0821600184f, 0.435499609f},
-std::array<float,2>{0.48578763f, 0.847266555f},
-std::array<float,2>{0.596017718f, 0.148151383f},
-std::array<float,2>{0.696845412f, 0.910555482f},
-std::array<float,2>{0.292254925f, 0.00959615875f},
-std::array<float,2>{0.18037346f, 0.712420821f},
-std::array<float,2>{0.874382794f, 0.271950006f},
-std::array<float,2>{0.910568118f, 0.95795542f},
-std::array<float,2>{0.0341201276f, 0.0814632624f},
-std::array<float,2>{0.375636339f, 0.663274765f},
-std::array<float,2>{0.536199391f, 0.337513477f},
-std::array<float,2>{0.673096955f, 0.588471174f},
-std::array<float,2>{0.336307555f, 0.458189249f},
-std::array<float,2>{0.188209504f, 0.811653554f},
-std::array<float,2>{0.755877614f, 0.235598192f},
-std::array<float,2>{0.8135252f, 0.737033129f},
-std::array<float,2>{0.152105719f, 0.282258272f},
-std::array<float,2>{0.265447557f, 0.882947206f},
-std::array<float,2>{0.739663661f, 0.0596224293f},
-std::array<float,2>{0.563428104f, 0.82272172f},
-std::array<float,2>{0.462353349f, 0.163239762f},
-std::array<float,2>{0.103368297f, 0.502926469f},
-std::array<float,2>{0.997421086f, 0.402049452f},
-std::array<float,2>{0.888223708f, 0.802508295f},
-std::array<float,2>{0.00879270304f, 0.24719952f},
-std::array<float,2>{0.435964614f, 0.578373551f},
-std::array<float,2>{0.529849827f, 0.46464172f},
-std::array<float,2>{0.635146618f, 0.665761709f},
-std::array<float,2>{0.349634945f, 0.334143937f},
-std::array<float,2>{0.239153162f, 0.961327612f},
-std::array<float,2>{0.811339378f, 0.0913972929f},
-std::array<float,2>{0.862463474f, 0.509435296f},
-std::array<float,2>{0.176793188f, 0.392454684f},
-std::array<float,2>{0.282303184f, 0.819413364f},
-std::array<float,2>{0.689762592f, 0.171173736f},
-std::array<float,2>{0.601705968f, 0.879578531f},
-std::array<float,2>{0.499884337f, 0.0509376377f},
-std::array<float,2>{0.088604182f, 0.748139381f},
-std::array<float,2>{0.952635169f, 0.292286664f},
-std::array<float,2>{0.758307815f, 0.996205747f},
-std::array<float,2>{0.196692795f, 0.122404516f},
-std::array<float,2>{0.331249148f, 0.626951635f},
-std::array<float,2>{0.684456885f, 0.351326793f},
-std::array<float,2>{0.542828262f, 0.621932566f},
-std::array<float,2>{0.386876255f, 0.484122574f},
-std::array<float,2>{0.0410433002f, 0.778315783f},
-std::array<float,2>{0.916632414f, 0.208954796f},
-std::array<float,2>{0.99172914f, 0.707685411f},
-std::array<float,2>{0.0995983332f, 0.279368579f},
-std::array<float,2>{0.4585132f, 0.918008029f},
-std::array<float,2>{0.574866831f, 0.00272273808f},
-std::array<float,2>{0.742605388f, 0.85844934f},
-std::array<float,2>{0.255064458f, 0.150905013f},
-std::array<float,2>{0.141211852f, 0.539473295f},
-std::array<float,2>{0.826593339f, 0.422421157f},
-std::array<float,2>{0.835292757f, 0.839459419f},
-std::array<float,2>{0.128128886f, 0.182442054f},
-std::array<float,2>{0.279611647f, 0.52761966f},
-std::array<float,2>{0.726537347f, 0.388639987f},
-std::array<float,2>{0.580863714f, 0.731064558f},
-std::array<float,2>{0.451699853f, 0.298891068f},
-std::array<float,2>{0.118887722f, 0.901152551f},
-std::array<float,2>{0.972587883f, 0.0460617393f},
-std::array<float,2>{0.936267793f, 0.576197088f},
-std::array<float,2>{0.0521799512f, 0.437562644f},
-std::array<float,2>{0.394677758f, 0.789863527f},
-std::array<float,2>{0.562456191f, 0.233596832f},
-std::array<float,2>{0.667196095f, 0.943666935f},
-std::array<float,2>{0.322942525f, 0.0742761493f},
-std::array<float,2>{0.211173385f, 0.675553262f},
-std::array<float,2>{0.772572279f, 0.317487031f},
-std::array<float,2>{0.965197742f, 0.92956084f},
-std::array<float,2>{0.0633891001f, 0.0262753274f},
-std::array<float,2>{0.470067918f, 0.69558543f},
-std::array<float,2>{0.620815873f, 0.257269055f},
-std::array<float,2>{0.709899366f, 0.558820784f},
-std::array<float,2>{0.301137716f, 0.419913232f},
-std::array<float,2>{0.163063362f, 0.87431848f},
-std::array<float,2>{0.857935071f, 0.128385082f},
-std::array<float,2>{0.787450552f, 0.647167683f},
-std::array<float,2>{0.225092992f, 0.371479362f},
-std::array<float,2>{0.372143686f, 0.983760715f},
-std::array<float,2>{0.642202854f, 0.0944302902f},
-std::array<float,2>{0.506666064f, 0.75658983f},
-std::array<float,2>{0.411050975f, 0.198572189f},
-std::array<float,2>{0.0298808794f, 0.600341499f},
-std::array<float,2>{0.891303301f, 0.486185372f},
-std::array<float,2>{0.902836502f, 0.85175544f},
-std::array<float,2>{0.0203232281f, 0.153925776f},
-std::array<float,2>{0.421195984f, 0.54396224f},
-std::array<float,2>{0.511409223f, 0.427016795f},
-std::array<float,2>{0.653858781f, 0.707022011f},
-std::array<float,2>{0.364478648f, 0.27725786f},
-std::array<float,2>{0.227147698f, 0.917942762f},
-std::array<float,2>{0.795084298f, 0.00515642855f},
-std::array<float,2>{0.850035429f, 0.617352366f},
-std::array<float,2>{0.165502682f, 0.477011859f},
-std::array<float,2>{0.306238204f, 0.773836136f},
-std::array<float,2>{0.711172402f, 0.204403922f},
-std::array<float,2>{0.61005336f, 0.992936492f},
-std::array<float,2>{0.476925999f, 0.118695825f},
-std::array<float,2>{0.0765276924f, 0.631123364f},
-std::array<float,2>{0.954427242f, 0.346100867f},
-std::array<float,2>{0.776284456f, 0.875246227f},
-std::array<float,2>{0.207808256f, 0.0479563065f},
-std::array<float,2>{0.31853354f, 0.743397951f},
-std::array<float,2>{0.662127078f, 0.294974595f},
-std::array<float,2>{0.550286531f, 0.51360321f},
-std::array<float,2>{0.398906738f, 0.395506978f},
-std::array<float,2>{0.0568794459f, 0.815714717f},
-std::array<float,2>{0.927564204f, 0.166325971f},
-std::array<float,2>{0.980607808f, 0.670022905f},
-std::array<float,2>{0.115442634f, 0.328147501f},
-std::array<float,2>{0.439367503f, 0.967247725f},
-std::array<float,2>{0.586236835f, 0.088585563f},
-std::array<float,2>{0.733917236f, 0.798193932f},
-std::array<float,2>{0.267155796f, 0.244602799f},
-std::array<float,2>{0.138154596f, 0.582621038f},
-std::array<float,2>{0.841159225f, 0.464969635f},
-std::array<float,2>{0.819849849f, 0.752636254f},
-std::array<float,2>{0.153499559f, 0.200578079f},
-std::array<float,2>{0.258058101f, 0.595678449f},
-std::array<float,2>{0.736479282f, 0.492052883f},
-std::array<float,2>{0.568260729f, 0.643013537f},
-std::array<float,2>{0.467200011f, 0.369412661f},
-std::array<float,2>{0.107352518f, 0.978979826f},
-std::array<float,2>{0.993694782f, 0.101557627f},
-std::array<float,2>{0.908702314f, 0.55675447f},
-std::array<float,2>{0.0372063406f, 0.416216791f},
-std::array<float,2>{0.380662143f, 0.867885649f},
-std::array<float,2>{0.534341216f, 0.132217303f},
-std::array<float,2>{0.676131785f, 0.923044205f},
-std::array<float,2>{0.340592176f, 0.0295571554f},
-std::array<float,2>{0.192840427f, 0.700636387f},
-std::array<float,2>{0.752240181f, 0.251376748f},
-std::array<float,2>{0.939117491f, 0.941003382f},
-std::array<float,2>{0.0786812529f, 0.0711399466f},
-std::array<float,2>{0.488763511f, 0.677468359f},
-std::array<float,2>{0.599628508f, 0.313470721f},
-std::array<float,2>{0.702115774f, 0.57091403f},
-std::array<float,2>{0.296552271f, 0.44529739f},
-std::array<float,2>{0.184892938f, 0.794484019f},
-std::array<float,2>{0.869412363f, 0.22838144f},
-std::array<float,2>{0.802945912f, 0.728175938f},
-std::array<float,2>{0.246632531f, 0.302113742f},
-std::array<float,2>{0.352756172f, 0.905613601f},
-std::array<float,2>{0.629038274f, 0.0424657874f},
-std::array<float,2>{0.518449008f, 0.842054546f},
-std::array<float,2>{0.428218424f, 0.186475903f},
-std::array<float,2>{0.00426600501f, 0.526218116f},
-std::array<float,2>{0.880706012f, 0.383713782f},
-std::array<float,2>{0.985236466f, 0.78723371f},
-std::array<float,2>{0.0953644142f, 0.219522789f},
-std::array<float,2>{0.455131859f, 0.566474497f},
-std::array<float,2>{0.572124302f, 0.447834581f},
-std::array<float,2>{0.748220265f, 0.680081248f},
-std::array<float,2>{0.252970338f, 0.321242809f},
-std::array<float,2>{0.146331802f, 0.947516441f},
-std::array<float,2>{0.82330364f, 0.0638292208f},
-std::array<float,2>{0.765269101f, 0.521163106f},
-std::array<float,2>{0.201499149f, 0.378341585f},
-std::array<float,2>{0.332957536f, 0.832625568f},
-std::array<float,2>{0.68187815f, 0.178419843f},
-std::array<float,2>{0.546300232f, 0.894001603f},
-std::array<float,2>{0.383623093f, 0.0343488045f},
-std::array<float,2>{0.0435303338f, 0.724608123f},
-std::array<float,2>{0.920429707f, 0.311268866f},
-std::array<float,2>{0.866584599f, 0.973964393f},
-std::array<float,2>{0.172641993f, 0.105109125f},
-std::array<float,2>{0.287746996f, 0.653527141f},
-std::array<float,2>{0.69322592f, 0.359987766f},
-std::array<float,2>{0.608505249f, 0.60786128f},
-std::array<float,2>{0.493302315f, 0.499767303f},
-std::array<float,2>{0.0922682062f, 0.761389017f},
-std::array<float,2>{0.946439028f, 0.192146108f},
-std::array<float,2>{0.883029342f, 0.692397654f},
-std::array<float,2>{0.0140798306f, 0.262796849f},
-std::array<float,2>{0.431219012f, 0.936753809f},
-std::array<float,2>{0.523910642f, 0.0209184568f},
-std::array<float,2>{0.638003886f, 0.861231267f},
-std::array<float,2>{0.344825327f, 0.13641949f},
-std::array<float,2>{0.236392006f, 0.553313911f},
-std::array<float,2>{0.806722105f, 0.411970884f},
-std::array<float,2>{0.78205198f, 0.826599538f},
-std::array<float,2>{0.219999433f, 0.158666477f},
-std::array<float,2>{0.368895471f, 0.507097602f},
-std::array<float,2>{0.647082984f, 0.403875232f},
-std::array<float,2>{0.503534555f, 0.742158234f},
-std::array<float,2>{0.410109401f, 0.286897302f},
-std::array<float,2>{0.0263687875f, 0.88920033f},
-std::array<float,2>{0.89795965f, 0.0561811477f},
-std::array<float,2>{0.962061048f, 0.593610108f},
-std::array<float,2>{0.0674175769f, 0.453739315f},
-std::array<float,2>{0.474344283f, 0.806904435f},
-std::array<float,2>{0.624523222f, 0.242119119f},
-std::array<float,2>{0.705833495f, 0.955069005f},
-std::array<float,2>{0.298849523f, 0.0836395696f},
-std::array<float,2>{0.157724053f, 0.658454895f},
-std::array<float,2>{0.853357136f, 0.341632158f},
-std::array<float,2>{0.932344198f, 0.909846842f},
-std::array<float,2>{0.0472135432f, 0.0147615923f},
-std::array<float,2>{0.393799305f, 0.716585755f},
-std::array<float,2>{0.557100236f, 0.266798586f},
-std::array<float,2>{0.669169486f, 0.53572005f},
-std::array<float,2>{0.324649632f, 0.432547241f},
-std::array<float,2>{0.218455344f, 0.850419819f},
-std::array<float,2>{0.766898811f, 0.142296612f},
-std::array<float,2>{0.829595089f, 0.637604117f},
-std::array<float,2>{0.132138193f, 0.358861029f},
-std::array<float,2>{0.274346173f, 0.988129914f},
-std::array<float,2>{0.719087481f, 0.115320534f},
-std::array<float,2>{0.584649861f, 0.766083896f},
-std::array<float,2>{0.448667318f, 0.211423948f},
-std::array<float,2>{0.122954682f, 0.6146456f},
-std::array<float,2>{0.973948002f, 0.475211233f},
-std::array<float,2>{0.959935904f, 0.829507947f},
-std::array<float,2>{0.070696488f, 0.174625605f},
-std::array<float,2>{0.481932521f, 0.516116738f},
-std::array<float,2>{0.614143789f, 0.380878061f},
-std::array<float,2>{0.716050565f, 0.721641481f},
-std::array<float,2>{0.308718801f, 0.305195183f},
-std::array<float,2>{0.170436203f, 0.898375154f},
-std::array<float,2>{0.845135033f, 0.0357277989f},
-std::array<float,2>{0.791584313f, 0.565972269f},
-std::array<float,2>{0.232653648f, 0.449369162f},
-std::array<float,2>{0.360245258f, 0.78277868f},
-std::array<float,2>{0.649145961f, 0.223799288f},
-std::array<float,2>{0.515456378f, 0.95138073f},
-std::array<float,2>{0.414892942f, 0.0689321011f},
-std::array<float,2>{0.016243536f, 0.685320318f},
-std::array<float,2>{0.899843812f, 0.327375919f},
-std::array<float,2>{0.839040935f, 0.930681467f},
-std::array<float,2>{0.133169845f, 0.0195171218f},
-std::array<float,2>{0.271987975f, 0.690288246f},
-std::array<float,2>{0.730349839f, 0.25823155f},
-std::array<float,2>{0.59156543f, 0.549658597f},
-std::array<float,2>{0.442298293f, 0.407621473f},
-std::array<float,2>{0.110119186f, 0.866788387f},
-std::array<float,2>{0.979241014f, 0.139172271f},
-std::array<float,2>{0.924017966f, 0.649348795f},
-std::array<float,2>{0.0605157726f, 0.364326f},
-std::array<float,2>{0.404586077f, 0.969628751f},
-std::array<float,2>{0.552298963f, 0.107514136f},
-std::array<float,2>{0.65819335f, 0.764742553f},
-std::array<float,2>{0.315233827f, 0.189242452f},
-std::array<float,2>{0.205460995f, 0.604466081f},
-std::array<float,2>{0.778948307f, 0.494455993f},
-std::array<float,2>{0.754169643f, 0.809325099f},
-std::array<float,2>{0.190804005f, 0.237314448f},
-std::array<float,2>{0.33895123f, 0.587079525f},
-std::array<float,2>{0.675451875f, 0.459483087f},
-std::array<float,2>{0.537492752f, 0.661435246f},
-std::array<float,2>{0.378088892f, 0.338056087f},
-std::array<float,2>{0.0321167745f, 0.959546506f},
-std::array<float,2>{0.913448095f, 0.0796963349f},
-std::array<float,2>{0.998516262f, 0.501434147f},
-std::array<float,2>{0.104232147f, 0.399975508f},
-std::array<float,2>{0.464452356f, 0.820392013f},
-std::array<float,2>{0.565404117f, 0.160687268f},
-std::array<float,2>{0.740494728f, 0.885406673f},
-std::array<float,2>{0.263311863f, 0.0611283705f},
-std::array<float,2>{0.148811042f, 0.734752536f},
-std::array<float,2>{0.815886736f, 0.283356786f},
-std::array<float,2>{0.877575219f, 0.992042303f},
-std::array<float,2>{0.00267534377f, 0.11158435f},
-std::array<float,2>{0.424305081f, 0.633995771f},
-std::array<float,2>{0.521729112f, 0.352272898f},
-std::array<float,2>{0.627877414f, 0.610952139f},
-std::array<float,2>{0.355946958f, 0.471233189f},
-std::array<float,2>{0.243538141f, 0.771473944f},
-std::array<float,2>{0.798734486f, 0.215911523f},
-std::array<float,2>{0.872073948f, 0.714637756f},
-std::array<float,2>{0.182044834f, 0.271160334f},
-std::array<float,2>{0.290238023f, 0.913099766f},
-std::array<float,2>{0.697559059f, 0.0104421992f},
-std::array<float,2>{0.59507817f, 0.84565872f},
-std::array<float,2>{0.486655116f, 0.145529121f},
-std::array<float,2>{0.0841206387f, 0.533121824f},
-std::array<float,2>{0.944171488f, 0.436307788f},
-std::array<float,2>{0.915846288f, 0.780966699f},
-std::array<float,2>{0.0409875512f, 0.21058619f},
-std::array<float,2>{0.388712883f, 0.623657763f},
-std::array<float,2>{0.54097271f, 0.481143147f},
-std::array<float,2>{0.685935497f, 0.627555072f},
-std::array<float,2>{0.329146892f, 0.34905386f},
-std::array<float,2>{0.19899866f, 0.998091459f},
-std::array<float,2>{0.75987488f, 0.124097236f},
-std::array<float,2>{0.825167298f, 0.542118907f},
-std::array<float,2>{0.143231243f, 0.424790919f},
-std::array<float,2>{0.256431878f, 0.855995357f},
-std::array<float,2>{0.745957375f, 0.150226623f},
-std::array<float,2>{0.577288151f, 0.920327306f},
-std::array<float,2>{0.459329277f, 0.000334725832f},
-std::array<float,2>{0.101117596f, 0.710772991f},
-std::array<float,2>{0.988710701f, 0.277902246f},
-std::array<float,2>{0.809026718f, 0.963344038f},
-std::array<float,2>{0.240998447f, 0.0918862745f},
-std::array<float,2>{0.34937039f, 0.666179717f},
-std::array<float,2>{0.634009957f, 0.333542913f},
-std::array<float,2>{0.528230965f, 0.580843151f},
-std::array<float,2>{0.434723377f, 0.461929947f},
-std::array<float,2>{0.00995726604f, 0.804035127f},
-std::array<float,2>{0.888949692f, 0.249014542f},
-std::array<float,2>{0.950264096f, 0.746285141f},
-std::array<float,2>{0.0876349956f, 0.290729702f},
-std::array<float,2>{0.496608078f, 0.88185674f},
-std::array<float,2>{0.603957593f, 0.0532600582f},
-std::array<float,2>{0.687526107f, 0.816975892f},
-std::array<float,2>{0.284824044f, 0.169588327f},
-std::array<float,2>{0.179312915f, 0.511246145f},
-std::array<float,2>{0.8612082f, 0.39349243f},
-std::array<float,2>{0.856470227f, 0.871325552f},
-std::array<float,2>{0.16201584f, 0.126334548f},
-std::array<float,2>{0.304295927f, 0.561269581f},
-std::array<float,2>{0.707636237f, 0.420730323f},
-std::array<float,2>{0.618289769f, 0.698375106f},
-std::array<float,2>{0.470945597f, 0.254332632f},
-std::array<float,2>{0.0654646084f, 0.927497268f},
-std::array<float,2>{0.96758461f, 0.0243409127f},
-std::array<float,2>{0.893548846f, 0.598226249f},
-std::array<float,2>{0.0285325088f, 0.488045365f},
-std::array<float,2>{0.413172573f, 0.754845977f},
-std::array<float,2>{0.505143881f, 0.195915505f},
-std::array<float,2>{0.642715991f, 0.982190251f},
-std::array<float,2>{0.374035388f, 0.0962903053f},
-std::array<float,2>{0.223424613f, 0.646009266f},
-std::array<float,2>{0.786293983f, 0.373667151f},
-std::array<float,2>{0.969486356f, 0.899817288f},
-std::array<float,2>{0.119882986f, 0.0445112027f},
-std::array<float,2>{0.45085305f, 0.733955503f},
-std::array<float,2>{0.580021501f, 0.29820931f},
-std::array<float,2>{0.723780036f, 0.530068398f},
-std::array<float,2>{0.277382344f, 0.390125602f},
-std::array<float,2>{0.126587823f, 0.837592483f},
-std::array<float,2>{0.832779825f, 0.180083811f},
-std::array<float,2>{0.771314204f, 0.67225641f},
-std::array<float,2>{0.213877112f, 0.319112688f},
-std::array<float,2>{0.322098047f, 0.941518068f},
-std::array<float,2>{0.665348649f, 0.0768427029f},
-std::array<float,2>{0.56016171f, 0.792497277f},
-std::array<float,2>{0.397790819f, 0.2316477f},
-std::array<float,2>{0.0543276966f, 0.574757636f},
-std::array<float,2>{0.933800161f, 0.439941406f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.929264963f, 0.944922328f},
-std::array<float,2>{0.415205002f, 0.110211968f},
-std::array<float,2>{0.559538603f, 0.31441012f},
-std::array<float,2>{0.0284454376f, 0.591630161f},
-std::array<float,2>{0.717103183f, 0.64859128f},
-std::array<float,2>{0.154315412f, 0.412199944f},
-std::array<float,2>{0.758507788f, 0.212049991f},
-std::array<float,2>{0.329220146f, 0.852692008f},
-std::array<float,2>{0.814739108f, 0.528059423f},
-std::array<float,2>{0.275476396f, 0.262302846f},
-std::array<float,2>{0.650005043f, 0.00119802658f},
-std::array<float,2>{0.215695694f, 0.930616617f},
-std::array<float,2>{0.571253359f, 0.795578539f},
-std::array<float,2>{0.107757851f, 0.138819471f},
-std::array<float,2>{0.950353444f, 0.446689576f},
-std::array<float,2>{0.459232092f, 0.699252307f},
-std::array<float,2>{0.799812019f, 0.832017004f},
-std::array<float,2>{0.361451507f, 0.220569819f},
-std::array<float,2>{0.719877481f, 0.405016541f},
-std::array<float,2>{0.172642902f, 0.670635462f},
-std::array<float,2>{0.517455697f, 0.617875457f},
-std::array<float,2>{0.032033693f, 0.358669043f},
-std::array<float,2>{0.879871964f, 0.0833827704f},
-std::array<float,2>{0.395913601f, 0.973298848f},
-std::array<float,2>{0.981334329f, 0.721627533f},
-std::array<float,2>{0.47437489f, 0.495710909f},
-std::array<float,2>{0.612485051f, 0.164642707f},
-std::array<float,2>{0.0788620636f, 0.777335882f},
-std::array<float,2>{0.675198317f, 0.900370121f},
-std::array<float,2>{0.238601357f, 0.0526601113f},
-std::array<float,2>{0.844986558f, 0.290218353f},
-std::array<float,2>{0.299675047f, 0.539131403f},
-std::array<float,2>{0.95553422f, 0.757236123f},
-std::array<float,2>{0.452996969f, 0.184729204f},
-std::array<float,2>{0.58241266f, 0.477080971f},
-std::array<float,2>{0.121488132f, 0.7344383f},
-std::array<float,2>{0.635505497f, 0.55496043f},
-std::array<float,2>{0.188220635f, 0.30610162f},
-std::array<float,2>{0.841648996f, 0.046378646f},
-std::array<float,2>{0.263955444f, 0.879796386f},
-std::array<float,2>{0.779090643f, 0.677238941f},
-std::array<float,2>{0.326101422f, 0.380050153f},
-std::array<float,2>{0.694314897f, 0.243645892f},
-std::array<float,2>{0.133585557f, 0.813962698f},
-std::array<float,2>{0.538739741f, 0.99619323f},
-std::array<float,2>{0.00330975652f, 0.0772529766f},
-std::array<float,2>{0.920416594f, 0.362261593f},
-std::array<float,2>{0.423169017f, 0.60667479f},
-std::array<float,2>{0.871865034f, 0.915584028f},
-std::array<float,2>{0.287074655f, 0.0187866874f},
-std::array<float,2>{0.666699171f, 0.27709958f},
-std::array<float,2>{0.221730575f, 0.508100331f},
-std::array<float,2>{0.594515443f, 0.718392313f},
-std::array<float,2>{0.0705412999f, 0.459376723f},
-std::array<float,2>{0.988055468f, 0.142955303f},
-std::array<float,2>{0.492119431f, 0.79946655f},
-std::array<float,2>{0.897818089f, 0.576862216f},
-std::array<float,2>{0.3877092f, 0.334017247f},
-std::array<float,2>{0.507908285f, 0.100678846f},
-std::array<float,2>{0.0616738796f, 0.967651784f},
-std::array<float,2>{0.749910057f, 0.868113041f},
-std::array<float,2>{0.163005784f, 0.198916942f},
-std::array<float,2>{0.796141207f, 0.43215251f},
-std::array<float,2>{0.353319824f, 0.627597511f},
-std::array<float,2>{0.99580121f, 0.882837951f},
-std::array<float,2>{0.494104713f, 0.0340677761f},
-std::array<float,2>{0.602621317f, 0.299948484f},
-std::array<float,2>{0.0637219027f, 0.554506123f},
-std::array<float,2>{0.662482679f, 0.746132731f},
-std::array<float,2>{0.232018083f, 0.470035642f},
-std::array<float,2>{0.863275647f, 0.175271466f},
-std::array<float,2>{0.291259795f, 0.761063516f},
-std::array<float,2>{0.785393059f, 0.600048542f},
-std::array<float,2>{0.345126182f, 0.373552382f},
-std::array<float,2>{0.737371802f, 0.0702955201f},
-std::array<float,2>{0.167398557f, 0.98872894f},
-std::array<float,2>{0.500716686f, 0.821910799f},
-std::array<float,2>{0.053571362f, 0.24027434f},
-std::array<float,2>{0.899057627f, 0.38492018f},
-std::array<float,2>{0.379082263f, 0.684071541f},
-std::array<float,2>{0.834296703f, 0.805165291f},
-std::array<float,2>{0.250586778f, 0.149870187f},
-std::array<float,2>{0.628546357f, 0.468069047f},
-std::array<float,2>{0.199067414f, 0.706525862f},
-std::array<float,2>{0.589578986f, 0.50138557f},
-std::array<float,2>{0.115754478f, 0.269606978f},
-std::array<float,2>{0.962090373f, 0.0264320225f},
-std::array<float,2>{0.44384551f, 0.912244976f},
-std::array<float,2>{0.906513393f, 0.639243364f},
-std::array<float,2>{0.433030277f, 0.423047036f},
-std::array<float,2>{0.541302621f, 0.189653873f},
-std::array<float,2>{0.0133599611f, 0.866026342f},
-std::array<float,2>{0.697998583f, 0.953622639f},
-std::array<float,2>{0.125557691f, 0.10199447f},
-std::array<float,2>{0.765827537f, 0.338772476f},
-std::array<float,2>{0.313461989f, 0.569343328f},
-std::array<float,2>{0.883445501f, 0.844618499f},
-std::array<float,2>{0.401030451f, 0.208000064f},
-std::array<float,2>{0.525646389f, 0.418625891f},
-std::array<float,2>{0.0442905277f, 0.642894387f},
-std::array<float,2>{0.728431284f, 0.579403818f},
-std::array<float,2>{0.18130143f, 0.327167749f},
-std::array<float,2>{0.809917331f, 0.117229968f},
-std::array<float,2>{0.373361468f, 0.946525931f},
-std::array<float,2>{0.853618622f, 0.69310838f},
-std::array<float,2>{0.308692068f, 0.439261913f},
-std::array<float,2>{0.686968088f, 0.12700589f},
-std::array<float,2>{0.249703839f, 0.78545028f},
-std::array<float,2>{0.619256794f, 0.924122393f},
-std::array<float,2>{0.0909721851f, 0.0152238188f},
-std::array<float,2>{0.970452189f, 0.250111073f},
-std::array<float,2>{0.482676655f, 0.516863644f},
-std::array<float,2>{0.756336689f, 0.982894123f},
-std::array<float,2>{0.343479782f, 0.086982049f},
-std::array<float,2>{0.709914684f, 0.347348541f},
-std::array<float,2>{0.143822625f, 0.61579293f},
-std::array<float,2>{0.553716779f, 0.659269035f},
-std::array<float,2>{0.0230346303f, 0.397003412f},
-std::array<float,2>{0.933669865f, 0.232356906f},
-std::array<float,2>{0.407357097f, 0.836157501f},
-std::array<float,2>{0.941684783f, 0.537576735f},
-std::array<float,2>{0.464808643f, 0.281555474f},
-std::array<float,2>{0.563446879f, 0.0552571379f},
-std::array<float,2>{0.0938478112f, 0.890753925f},
-std::array<float,2>{0.640918255f, 0.767132282f},
-std::array<float,2>{0.206436411f, 0.161007181f},
-std::array<float,2>{0.827802479f, 0.489317864f},
-std::array<float,2>{0.272059977f, 0.730047524f},
-std::array<float,2>{0.903946102f, 0.934818447f},
-std::array<float,2>{0.3753694f, 0.00718041416f},
-std::array<float,2>{0.504468083f, 0.257971734f},
-std::array<float,2>{0.0486788824f, 0.526659369f},
-std::array<float,2>{0.740464032f, 0.697875857f},
-std::array<float,2>{0.169701651f, 0.452439874f},
-std::array<float,2>{0.783503354f, 0.133744046f},
-std::array<float,2>{0.350316346f, 0.790663719f},
-std::array<float,2>{0.866970837f, 0.587151229f},
-std::array<float,2>{0.296808779f, 0.318835109f},
-std::array<float,2>{0.657822669f, 0.114791691f},
-std::array<float,2>{0.229185224f, 0.940947235f},
-std::array<float,2>{0.6092062f, 0.857155442f},
-std::array<float,2>{0.06710805f, 0.216305926f},
-std::array<float,2>{0.999007404f, 0.407628417f},
-std::array<float,2>{0.497302532f, 0.655106127f},
-std::array<float,2>{0.771092236f, 0.780673027f},
-std::array<float,2>{0.317225635f, 0.168685615f},
-std::array<float,2>{0.701579392f, 0.499526829f},
-std::array<float,2>{0.129924342f, 0.725699425f},
-std::array<float,2>{0.543950737f, 0.545367062f},
-std::array<float,2>{0.00798135251f, 0.295217544f},
-std::array<float,2>{0.913055122f, 0.0477539785f},
-std::array<float,2>{0.435608774f, 0.904158831f},
-std::array<float,2>{0.966663897f, 0.664953172f},
-std::array<float,2>{0.441038638f, 0.399993509f},
-std::array<float,2>{0.592865944f, 0.22655791f},
-std::array<float,2>{0.112918414f, 0.832181752f},
-std::array<float,2>{0.629816949f, 0.972637296f},
-std::array<float,2>{0.20203726f, 0.0792659596f},
-std::array<float,2>{0.83000052f, 0.35400033f},
-std::array<float,2>{0.256464809f, 0.621678054f},
-std::array<float,2>{0.974124849f, 0.81872195f},
-std::array<float,2>{0.478162199f, 0.24782756f},
-std::array<float,2>{0.621327937f, 0.375635475f},
-std::array<float,2>{0.0880608782f, 0.673398495f},
-std::array<float,2>{0.681451678f, 0.605341971f},
-std::array<float,2>{0.244353592f, 0.365377903f},
-std::array<float,2>{0.857424736f, 0.0706285536f},
-std::array<float,2>{0.3048639f, 0.994281948f},
-std::array<float,2>{0.805255234f, 0.741633713f},
-std::array<float,2>{0.367351413f, 0.480485231f},
-std::array<float,2>{0.731802106f, 0.179913983f},
-std::array<float,2>{0.18598415f, 0.752843142f},
-std::array<float,2>{0.529948711f, 0.877949417f},
-std::array<float,2>{0.0391604751f, 0.0425338559f},
-std::array<float,2>{0.887531817f, 0.311303139f},
-std::array<float,2>{0.403694063f, 0.560622573f},
-std::array<float,2>{0.821782053f, 0.961335897f},
-std::array<float,2>{0.267124027f, 0.0943823904f},
-std::array<float,2>{0.648266912f, 0.328947306f},
-std::array<float,2>{0.207479075f, 0.573185146f},
-std::array<float,2>{0.569255769f, 0.630711436f},
-std::array<float,2>{0.0989874005f, 0.436845511f},
-std::array<float,2>{0.940965652f, 0.20297204f},
-std::array<float,2>{0.468565732f, 0.873586595f},
-std::array<float,2>{0.931248009f, 0.515129209f},
-std::array<float,2>{0.413029641f, 0.278743863f},
-std::array<float,2>{0.548433483f, 0.021217458f},
-std::array<float,2>{0.0188577995f, 0.918693066f},
-std::array<float,2>{0.704656184f, 0.804446816f},
-std::array<float,2>{0.145971283f, 0.147148356f},
-std::array<float,2>{0.753282011f, 0.455024511f},
-std::array<float,2>{0.337855488f, 0.712273777f},
-std::array<float,2>{0.947309673f, 0.985671163f},
-std::array<float,2>{0.455007195f, 0.0640660673f},
-std::array<float,2>{0.577897668f, 0.370420367f},
-std::array<float,2>{0.103282534f, 0.596163273f},
-std::array<float,2>{0.654839516f, 0.68226546f},
-std::array<float,2>{0.213240415f, 0.388103336f},
-std::array<float,2>{0.818997979f, 0.234489962f},
-std::array<float,2>{0.280684233f, 0.825581133f},
-std::array<float,2>{0.762353778f, 0.549345851f},
-std::array<float,2>{0.334571928f, 0.303745538f},
-std::array<float,2>{0.713301718f, 0.0353469774f},
-std::array<float,2>{0.151323274f, 0.890098751f},
-std::array<float,2>{0.555374444f, 0.764921963f},
-std::array<float,2>{0.0239845719f, 0.175797597f},
-std::array<float,2>{0.922507167f, 0.475040048f},
-std::array<float,2>{0.420301676f, 0.742631853f},
-std::array<float,2>{0.847674549f, 0.863162875f},
-std::array<float,2>{0.303629994f, 0.19153446f},
-std::array<float,2>{0.677939415f, 0.427854627f},
-std::array<float,2>{0.237069443f, 0.635906935f},
-std::array<float,2>{0.614214957f, 0.565035045f},
-std::array<float,2>{0.08354339f, 0.342488021f},
-std::array<float,2>{0.980398118f, 0.108637542f},
-std::array<float,2>{0.472209334f, 0.957285881f},
-std::array<float,2>{0.875991702f, 0.707310557f},
-std::array<float,2>{0.394009054f, 0.46430555f},
-std::array<float,2>{0.521934867f, 0.155217469f},
-std::array<float,2>{0.0382623933f, 0.81109488f},
-std::array<float,2>{0.722904503f, 0.909786165f},
-std::array<float,2>{0.179169178f, 0.0304510687f},
-std::array<float,2>{0.804484487f, 0.267596334f},
-std::array<float,2>{0.363746643f, 0.507464826f},
-std::array<float,2>{0.915163994f, 0.782673001f},
-std::array<float,2>{0.426163614f, 0.130638823f},
-std::array<float,2>{0.533079803f, 0.441736817f},
-std::array<float,2>{0.0071124956f, 0.689458847f},
-std::array<float,2>{0.688574433f, 0.519558549f},
-std::array<float,2>{0.137742728f, 0.25745672f},
-std::array<float,2>{0.776557565f, 0.0109015061f},
-std::array<float,2>{0.324187696f, 0.927107036f},
-std::array<float,2>{0.836534321f, 0.645718575f},
-std::array<float,2>{0.259793431f, 0.417112082f},
-std::array<float,2>{0.636773467f, 0.206852108f},
-std::array<float,2>{0.193162233f, 0.847856283f},
-std::array<float,2>{0.581713676f, 0.949805439f},
-std::array<float,2>{0.120450787f, 0.124011137f},
-std::array<float,2>{0.958456993f, 0.3212955f},
-std::array<float,2>{0.446529359f, 0.583599091f},
-std::array<float,2>{0.789705694f, 0.896477818f},
-std::array<float,2>{0.356408894f, 0.0611961894f},
-std::array<float,2>{0.744658887f, 0.28601101f},
-std::array<float,2>{0.157586157f, 0.534473717f},
-std::array<float,2>{0.513403535f, 0.730650842f},
-std::array<float,2>{0.0559073538f, 0.487099975f},
-std::array<float,2>{0.891514182f, 0.157357261f},
-std::array<float,2>{0.383145899f, 0.772932649f},
-std::array<float,2>{0.988333225f, 0.612259924f},
-std::array<float,2>{0.485804766f, 0.35009411f},
-std::array<float,2>{0.599596024f, 0.0926995352f},
-std::array<float,2>{0.0762368217f, 0.978112161f},
-std::array<float,2>{0.670652986f, 0.842360616f},
-std::array<float,2>{0.223197341f, 0.228151664f},
-std::array<float,2>{0.867503107f, 0.392767191f},
-std::array<float,2>{0.281669199f, 0.66086781f},
-std::array<float,2>{0.881146133f, 0.975541353f},
-std::array<float,2>{0.396858275f, 0.0858822316f},
-std::array<float,2>{0.517890275f, 0.355963945f},
-std::array<float,2>{0.034421578f, 0.620489776f},
-std::array<float,2>{0.721096516f, 0.668887258f},
-std::array<float,2>{0.174309731f, 0.404276103f},
-std::array<float,2>{0.798020542f, 0.220729887f},
-std::array<float,2>{0.35941571f, 0.829260886f},
-std::array<float,2>{0.847013354f, 0.542086661f},
-std::array<float,2>{0.297303051f, 0.291224808f},
-std::array<float,2>{0.673687637f, 0.0529526956f},
-std::array<float,2>{0.240607724f, 0.90186131f},
-std::array<float,2>{0.610106707f, 0.774728239f},
-std::array<float,2>{0.0801939741f, 0.167885289f},
-std::array<float,2>{0.982578099f, 0.493969649f},
-std::array<float,2>{0.474875987f, 0.719486594f},
-std::array<float,2>{0.759897709f, 0.853536248f},
-std::array<float,2>{0.331131846f, 0.214186564f},
-std::array<float,2>{0.715828359f, 0.411112577f},
-std::array<float,2>{0.15320006f, 0.651179969f},
-std::array<float,2>{0.561620235f, 0.593283355f},
-std::array<float,2>{0.0297871772f, 0.315370142f},
-std::array<float,2>{0.927044153f, 0.11143703f},
-std::array<float,2>{0.417042196f, 0.942421138f},
-std::array<float,2>{0.952480912f, 0.701386571f},
-std::array<float,2>{0.457401842f, 0.447868824f},
-std::array<float,2>{0.572755933f, 0.137636527f},
-std::array<float,2>{0.106224634f, 0.79394573f},
-std::array<float,2>{0.651833415f, 0.932760477f},
-std::array<float,2>{0.21742253f, 0.0027792193f},
-std::array<float,2>{0.814115226f, 0.264033109f},
-std::array<float,2>{0.273459703f, 0.531082213f},
-std::array<float,2>{0.985364437f, 0.798014283f},
-std::array<float,2>{0.488903463f, 0.141908959f},
-std::array<float,2>{0.596481442f, 0.457911581f},
-std::array<float,2>{0.0730980933f, 0.716609836f},
-std::array<float,2>{0.665625334f, 0.510403633f},
-std::array<float,2>{0.22034514f, 0.273861587f},
-std::array<float,2>{0.87349689f, 0.015962502f},
-std::array<float,2>{0.288775295f, 0.917620301f},
-std::array<float,2>{0.79359442f, 0.625718236f},
-std::array<float,2>{0.354751319f, 0.430136532f},
-std::array<float,2>{0.746768951f, 0.196735814f},
-std::array<float,2>{0.160164535f, 0.869534552f},
-std::array<float,2>{0.510054588f, 0.964886546f},
-std::array<float,2>{0.0591353141f, 0.0978107527f},
-std::array<float,2>{0.89613688f, 0.332566679f},
-std::array<float,2>{0.390122771f, 0.575965583f},
-std::array<float,2>{0.843491435f, 0.881366134f},
-std::array<float,2>{0.262741953f, 0.044247862f},
-std::array<float,2>{0.63331604f, 0.306664497f},
-std::array<float,2>{0.190442681f, 0.558422089f},
-std::array<float,2>{0.58563298f, 0.736620724f},
-std::array<float,2>{0.123443224f, 0.47912389f},
-std::array<float,2>{0.954954028f, 0.18573834f},
-std::array<float,2>{0.449835449f, 0.754244387f},
-std::array<float,2>{0.919483185f, 0.608316064f},
-std::array<float,2>{0.425726026f, 0.359861135f},
-std::array<float,2>{0.535317242f, 0.07603883f},
-std::array<float,2>{0.00034008568f, 0.998583376f},
-std::array<float,2>{0.692635536f, 0.815580606f},
-std::array<float,2>{0.1366328f, 0.24607031f},
-std::array<float,2>{0.780614376f, 0.381810904f},
-std::array<float,2>{0.327821016f, 0.679680109f},
-std::array<float,2>{0.96308732f, 0.910927713f},
-std::array<float,2>{0.441757709f, 0.0234847944f},
-std::array<float,2>{0.586864233f, 0.273400396f},
-std::array<float,2>{0.114627823f, 0.503605127f},
-std::array<float,2>{0.625859797f, 0.704251349f},
-std::array<float,2>{0.195520669f, 0.465332478f},
-std::array<float,2>{0.832703769f, 0.150880054f},
-std::array<float,2>{0.252041936f, 0.808360636f},
-std::array<float,2>{0.768214822f, 0.568209648f},
-std::array<float,2>{0.314869165f, 0.337028205f},
-std::array<float,2>{0.697023094f, 0.104349308f},
-std::array<float,2>{0.128476039f, 0.956258535f},
-std::array<float,2>{0.540715456f, 0.864869297f},
-std::array<float,2>{0.0153386053f, 0.187884271f},
-std::array<float,2>{0.909113765f, 0.424868792f},
-std::array<float,2>{0.430118531f, 0.637354314f},
-std::array<float,2>{0.860704541f, 0.75967592f},
-std::array<float,2>{0.290086836f, 0.172201633f},
-std::array<float,2>{0.661708176f, 0.470887333f},
-std::array<float,2>{0.233144864f, 0.748624504f},
-std::array<float,2>{0.605389595f, 0.551211655f},
-std::array<float,2>{0.0653768182f, 0.297124267f},
-std::array<float,2>{0.993700624f, 0.0322271585f},
-std::array<float,2>{0.495114774f, 0.884962857f},
-std::array<float,2>{0.901496232f, 0.685762882f},
-std::array<float,2>{0.381019562f, 0.383058786f},
-std::array<float,2>{0.502274394f, 0.23890616f},
-std::array<float,2>{0.0527181402f, 0.822959602f},
-std::array<float,2>{0.735417068f, 0.991888046f},
-std::array<float,2>{0.164126351f, 0.0665870085f},
-std::array<float,2>{0.78833133f, 0.37168178f},
-std::array<float,2>{0.347453207f, 0.59809339f},
-std::array<float,2>{0.936041415f, 0.838934422f},
-std::array<float,2>{0.409172565f, 0.232831866f},
-std::array<float,2>{0.550963283f, 0.396444321f},
-std::array<float,2>{0.0207893439f, 0.657248795f},
-std::array<float,2>{0.707892954f, 0.614841521f},
-std::array<float,2>{0.14226301f, 0.343896449f},
-std::array<float,2>{0.754876494f, 0.0882556364f},
-std::array<float,2>{0.341216743f, 0.982402623f},
-std::array<float,2>{0.825036883f, 0.726566255f},
-std::array<float,2>{0.270105809f, 0.492079675f},
-std::array<float,2>{0.644467831f, 0.16324307f},
-std::array<float,2>{0.203659698f, 0.768271506f},
-std::array<float,2>{0.565651059f, 0.893801451f},
-std::array<float,2>{0.0973757058f, 0.0585639738f},
-std::array<float,2>{0.944353044f, 0.283405423f},
-std::array<float,2>{0.461955756f, 0.53663069f},
-std::array<float,2>{0.812453985f, 0.947807014f},
-std::array<float,2>{0.371764451f, 0.119238257f},
-std::array<float,2>{0.728590608f, 0.325060099f},
-std::array<float,2>{0.18261227f, 0.580433846f},
-std::array<float,2>{0.524987817f, 0.641282678f},
-std::array<float,2>{0.0450644307f, 0.420407027f},
-std::array<float,2>{0.885812044f, 0.210303813f},
-std::array<float,2>{0.398440808f, 0.847294748f},
-std::array<float,2>{0.972633719f, 0.519242048f},
-std::array<float,2>{0.481288701f, 0.253071755f},
-std::array<float,2>{0.619032741f, 0.0130740246f},
-std::array<float,2>{0.0926616266f, 0.923435509f},
-std::array<float,2>{0.684809029f, 0.78772217f},
-std::array<float,2>{0.24658969f, 0.126627848f},
-std::array<float,2>{0.85248661f, 0.440357417f},
-std::array<float,2>{0.310781837f, 0.693775117f},
-std::array<float,2>{0.911502302f, 0.906213939f},
-std::array<float,2>{0.435040832f, 0.0498658456f},
-std::array<float,2>{0.545850933f, 0.293252319f},
-std::array<float,2>{0.0111100376f, 0.543023169f},
-std::array<float,2>{0.700865269f, 0.724149942f},
-std::array<float,2>{0.130962133f, 0.496680498f},
-std::array<float,2>{0.771795273f, 0.171542257f},
-std::array<float,2>{0.319205403f, 0.778551996f},
-std::array<float,2>{0.831388354f, 0.624940932f},
-std::array<float,2>{0.254794866f, 0.352237672f},
-std::array<float,2>{0.631247282f, 0.0806800127f},
-std::array<float,2>{0.200231388f, 0.969772696f},
-std::array<float,2>{0.590479791f, 0.83565259f},
-std::array<float,2>{0.110827066f, 0.222876087f},
-std::array<float,2>{0.966971278f, 0.401595414f},
-std::array<float,2>{0.437622726f, 0.667718112f},
-std::array<float,2>{0.782385349f, 0.791625023f},
-std::array<float,2>{0.348560721f, 0.134781137f},
-std::array<float,2>{0.739053607f, 0.450183123f},
-std::array<float,2>{0.170396775f, 0.69649452f},
-std::array<float,2>{0.50658977f, 0.525344133f},
-std::array<float,2>{0.0502575524f, 0.261648327f},
-std::array<float,2>{0.904584706f, 0.00462715607f},
-std::array<float,2>{0.378225893f, 0.937027633f},
-std::array<float,2>{0.996678352f, 0.652477205f},
-std::array<float,2>{0.499051899f, 0.409704208f},
-std::array<float,2>{0.606081545f, 0.218439683f},
-std::array<float,2>{0.0694792718f, 0.858912587f},
-std::array<float,2>{0.659608066f, 0.938512385f},
-std::array<float,2>{0.227243245f, 0.116228186f},
-std::array<float,2>{0.865193188f, 0.317324877f},
-std::array<float,2>{0.293297052f, 0.58953923f},
-std::array<float,2>{0.93882972f, 0.872043073f},
-std::array<float,2>{0.466073155f, 0.199897394f},
-std::array<float,2>{0.567560256f, 0.433950186f},
-std::array<float,2>{0.100512296f, 0.631810367f},
-std::array<float,2>{0.645747602f, 0.570846438f},
-std::array<float,2>{0.210879594f, 0.330674887f},
-std::array<float,2>{0.824161232f, 0.0967788249f},
-std::array<float,2>{0.269495875f, 0.964310467f},
-std::array<float,2>{0.7514292f, 0.713053107f},
-std::array<float,2>{0.33926785f, 0.455224156f},
-std::array<float,2>{0.705949128f, 0.145449817f},
-std::array<float,2>{0.146568269f, 0.802360475f},
-std::array<float,2>{0.549832523f, 0.921046317f},
-std::array<float,2>{0.0169778243f, 0.0217436366f},
-std::array<float,2>{0.933309913f, 0.280200213f},
-std::array<float,2>{0.41137284f, 0.513647616f},
-std::array<float,2>{0.856218815f, 0.994021535f},
-std::array<float,2>{0.307823479f, 0.0729541928f},
-std::array<float,2>{0.682501197f, 0.365046054f},
-std::array<float,2>{0.242784172f, 0.601926506f},
-std::array<float,2>{0.624755979f, 0.674554825f},
-std::array<float,2>{0.0859852582f, 0.377792001f},
-std::array<float,2>{0.975789368f, 0.249629021f},
-std::array<float,2>{0.478607893f, 0.8181687f},
-std::array<float,2>{0.890087605f, 0.559680164f},
-std::array<float,2>{0.405754268f, 0.309572488f},
-std::array<float,2>{0.528994501f, 0.0405426882f},
-std::array<float,2>{0.0427535251f, 0.876155436f},
-std::array<float,2>{0.733211517f, 0.750142217f},
-std::array<float,2>{0.185052514f, 0.183524698f},
-std::array<float,2>{0.808341861f, 0.483378857f},
-std::array<float,2>{0.371049166f, 0.739103496f},
-std::array<float,2>{0.976760983f, 0.960080862f},
-std::array<float,2>{0.47039181f, 0.107098453f},
-std::array<float,2>{0.615725935f, 0.34040913f},
-std::array<float,2>{0.0851839781f, 0.564127743f},
-std::array<float,2>{0.677424788f, 0.634101748f},
-std::array<float,2>{0.235165328f, 0.426020384f},
-std::array<float,2>{0.850899339f, 0.194281891f},
-std::array<float,2>{0.301990718f, 0.860644102f},
-std::array<float,2>{0.801163793f, 0.50447166f},
-std::array<float,2>{0.365493596f, 0.266507357f},
-std::array<float,2>{0.72490716f, 0.0289727561f},
-std::array<float,2>{0.177127033f, 0.906707525f},
-std::array<float,2>{0.521241784f, 0.810003221f},
-std::array<float,2>{0.0354627185f, 0.152398869f},
-std::array<float,2>{0.877950013f, 0.461269498f},
-std::array<float,2>{0.391547292f, 0.709715188f},
-std::array<float,2>{0.816923797f, 0.828113437f},
-std::array<float,2>{0.278203398f, 0.237956107f},
-std::array<float,2>{0.652460158f, 0.389569759f},
-std::array<float,2>{0.211128682f, 0.681017697f},
-std::array<float,2>{0.57586664f, 0.593905985f},
-std::array<float,2>{0.104800388f, 0.367869526f},
-std::array<float,2>{0.946945608f, 0.0661193654f},
-std::array<float,2>{0.456057161f, 0.987958848f},
-std::array<float,2>{0.924851656f, 0.745187521f},
-std::array<float,2>{0.418037534f, 0.473395407f},
-std::array<float,2>{0.558228672f, 0.178869382f},
-std::array<float,2>{0.0264608115f, 0.763090014f},
-std::array<float,2>{0.712016225f, 0.886814356f},
-std::array<float,2>{0.149108365f, 0.0371950939f},
-std::array<float,2>{0.763893485f, 0.302153289f},
-std::array<float,2>{0.333868355f, 0.548353434f},
-std::array<float,2>{0.893805444f, 0.770198047f},
-std::array<float,2>{0.386086792f, 0.158342183f},
-std::array<float,2>{0.513723969f, 0.486058772f},
-std::array<float,2>{0.0583590306f, 0.734267116f},
-std::array<float,2>{0.743380308f, 0.531932652f},
-std::array<float,2>{0.158850864f, 0.288014144f},
-std::array<float,2>{0.792568803f, 0.059900932f},
-std::array<float,2>{0.358843654f, 0.897316575f},
-std::array<float,2>{0.870857835f, 0.663860977f},
-std::array<float,2>{0.285090774f, 0.390959948f},
-std::array<float,2>{0.669716179f, 0.229191974f},
-std::array<float,2>{0.226209268f, 0.8404302f},
-std::array<float,2>{0.601195395f, 0.980222344f},
-std::array<float,2>{0.0751749128f, 0.0902977958f},
-std::array<float,2>{0.990821064f, 0.34785825f},
-std::array<float,2>{0.486355394f, 0.609398901f},
-std::array<float,2>{0.773881495f, 0.929443121f},
-std::array<float,2>{0.320396721f, 0.0087439185f},
-std::array<float,2>{0.689634681f, 0.253999352f},
-std::array<float,2>{0.140283808f, 0.522256672f},
-std::array<float,2>{0.535056353f, 0.689081252f},
-std::array<float,2>{0.00545335235f, 0.445006311f},
-std::array<float,2>{0.916499615f, 0.132468328f},
-std::array<float,2>{0.429089367f, 0.78378123f},
-std::array<float,2>{0.960116208f, 0.585295558f},
-std::array<float,2>{0.44747591f, 0.323727161f},
-std::array<float,2>{0.578838527f, 0.122106425f},
-std::array<float,2>{0.119079769f, 0.952050328f},
-std::array<float,2>{0.639448762f, 0.850431204f},
-std::array<float,2>{0.194188863f, 0.20490469f},
-std::array<float,2>{0.839223862f, 0.414069831f},
-std::array<float,2>{0.259286284f, 0.647850215f},
-std::array<float,2>{0.921508253f, 0.99942863f},
-std::array<float,2>{0.422049433f, 0.0748029128f},
-std::array<float,2>{0.537512422f, 0.360400915f},
-std::array<float,2>{0.00206692913f, 0.608558357f},
-std::array<float,2>{0.695068598f, 0.678667545f},
-std::array<float,2>{0.134400114f, 0.382482916f},
-std::array<float,2>{0.778101265f, 0.244238332f},
-std::array<float,2>{0.324755222f, 0.814787924f},
-std::array<float,2>{0.84071213f, 0.557607889f},
-std::array<float,2>{0.265196055f, 0.308401793f},
-std::array<float,2>{0.63657707f, 0.0436710529f},
-std::array<float,2>{0.188648105f, 0.88215369f},
-std::array<float,2>{0.583851337f, 0.755534947f},
-std::array<float,2>{0.122522905f, 0.186983585f},
-std::array<float,2>{0.956761956f, 0.479790181f},
-std::array<float,2>{0.451574564f, 0.738055527f},
-std::array<float,2>{0.79509294f, 0.870557547f},
-std::array<float,2>{0.351590574f, 0.19584775f},
-std::array<float,2>{0.748709619f, 0.431483269f},
-std::array<float,2>{0.163541615f, 0.626868546f},
-std::array<float,2>{0.509533644f, 0.574516833f},
-std::array<float,2>{0.0608065911f, 0.333016068f},
-std::array<float,2>{0.897176147f, 0.0991432592f},
-std::array<float,2>{0.387066811f, 0.966393769f},
-std::array<float,2>{0.986949444f, 0.715512037f},
-std::array<float,2>{0.49113512f, 0.458779186f},
-std::array<float,2>{0.595462918f, 0.141292334f},
-std::array<float,2>{0.072167553f, 0.797694623f},
-std::array<float,2>{0.667904019f, 0.916392088f},
-std::array<float,2>{0.2211833f, 0.0169324614f},
-std::array<float,2>{0.872087121f, 0.275247514f},
-std::array<float,2>{0.285384923f, 0.511614919f},
-std::array<float,2>{0.949221373f, 0.793037236f},
-std::array<float,2>{0.460343957f, 0.138267338f},
-std::array<float,2>{0.572010159f, 0.448973835f},
-std::array<float,2>{0.109304301f, 0.702967525f},
-std::array<float,2>{0.649078906f, 0.529409409f},
-std::array<float,2>{0.215844572f, 0.265242726f},
-std::array<float,2>{0.815880954f, 0.00323111517f},
-std::array<float,2>{0.277278602f, 0.932125688f},
-std::array<float,2>{0.759674191f, 0.651448667f},
-std::array<float,2>{0.328563422f, 0.411239982f},
-std::array<float,2>{0.718289196f, 0.212969661f},
-std::array<float,2>{0.156160176f, 0.855283737f},
-std::array<float,2>{0.560330868f, 0.942144871f},
-std::array<float,2>{0.0278802328f, 0.11284975f},
-std::array<float,2>{0.927895248f, 0.316268504f},
-std::array<float,2>{0.41448918f, 0.592253208f},
-std::array<float,2>{0.844185948f, 0.900472164f},
-std::array<float,2>{0.300618559f, 0.0541694574f},
-std::array<float,2>{0.674297094f, 0.292434186f},
-std::array<float,2>{0.239272654f, 0.541419566f},
-std::array<float,2>{0.612014353f, 0.720426381f},
-std::array<float,2>{0.0797803923f, 0.492321938f},
-std::array<float,2>{0.982061207f, 0.166713625f},
-std::array<float,2>{0.473144114f, 0.774073899f},
-std::array<float,2>{0.880449772f, 0.619912088f},
-std::array<float,2>{0.394589692f, 0.356789231f},
-std::array<float,2>{0.516522467f, 0.0844887793f},
-std::array<float,2>{0.033156842f, 0.976147532f},
-std::array<float,2>{0.719477713f, 0.828295648f},
-std::array<float,2>{0.173787117f, 0.221752539f},
-std::array<float,2>{0.799617589f, 0.402992845f},
-std::array<float,2>{0.362380564f, 0.669665694f},
-std::array<float,2>{0.969567001f, 0.922195733f},
-std::array<float,2>{0.483684331f, 0.0118776159f},
-std::array<float,2>{0.620912254f, 0.251982033f},
-std::array<float,2>{0.090071626f, 0.517885327f},
-std::array<float,2>{0.686108768f, 0.6951406f},
-std::array<float,2>{0.248551935f, 0.440530539f},
-std::array<float,2>{0.8548702f, 0.125245512f},
-std::array<float,2>{0.309667856f, 0.788341522f},
-std::array<float,2>{0.809464574f, 0.581921458f},
-std::array<float,2>{0.374551058f, 0.325545698f},
-std::array<float,2>{0.727008104f, 0.121001065f},
-std::array<float,2>{0.180522531f, 0.948505759f},
-std::array<float,2>{0.526762247f, 0.846157491f},
-std::array<float,2>{0.0430653356f, 0.209688485f},
-std::array<float,2>{0.883822083f, 0.421667039f},
-std::array<float,2>{0.40157029f, 0.642056167f},
-std::array<float,2>{0.826674104f, 0.768624604f},
-std::array<float,2>{0.273085088f, 0.162680224f},
-std::array<float,2>{0.641887605f, 0.491100371f},
-std::array<float,2>{0.20572938f, 0.728224993f},
-std::array<float,2>{0.564255297f, 0.535196662f},
-std::array<float,2>{0.0947301462f, 0.284964114f},
-std::array<float,2>{0.94289273f, 0.0572459362f},
-std::array<float,2>{0.462911278f, 0.892825842f},
-std::array<float,2>{0.935531139f, 0.656312764f},
-std::array<float,2>{0.406451553f, 0.395307243f},
-std::array<float,2>{0.553156793f, 0.234004244f},
-std::array<float,2>{0.0221866295f, 0.838667035f},
-std::array<float,2>{0.710837066f, 0.98079741f},
-std::array<float,2>{0.142877951f, 0.0890220776f},
-std::array<float,2>{0.75756681f, 0.344930708f},
-std::array<float,2>{0.341981292f, 0.614120781f},
-std::array<float,2>{0.900211632f, 0.823336601f},
-std::array<float,2>{0.379897565f, 0.239645913f},
-std::array<float,2>{0.501861811f, 0.38470906f},
-std::array<float,2>{0.053855747f, 0.687133968f},
-std::array<float,2>{0.737062395f, 0.599119723f},
-std::array<float,2>{0.166387945f, 0.372431576f},
-std::array<float,2>{0.786528885f, 0.0679698363f},
-std::array<float,2>{0.34440133f, 0.99111712f},
-std::array<float,2>{0.861738145f, 0.749576688f},
-std::array<float,2>{0.29227379f, 0.472385883f},
-std::array<float,2>{0.663575947f, 0.173493788f},
-std::array<float,2>{0.230546102f, 0.758702815f},
-std::array<float,2>{0.601818204f, 0.886234462f},
-std::array<float,2>{0.0625360161f, 0.0314041972f},
-std::array<float,2>{0.995104611f, 0.298807144f},
-std::array<float,2>{0.492714345f, 0.552079737f},
-std::array<float,2>{0.766766429f, 0.955532491f},
-std::array<float,2>{0.314381957f, 0.104649246f},
-std::array<float,2>{0.698491573f, 0.336405307f},
-std::array<float,2>{0.126237765f, 0.56660521f},
-std::array<float,2>{0.542198002f, 0.638621688f},
-std::array<float,2>{0.0117444601f, 0.424411684f},
-std::array<float,2>{0.907905817f, 0.188516766f},
-std::array<float,2>{0.431995511f, 0.863300383f},
-std::array<float,2>{0.960995793f, 0.50243324f},
-std::array<float,2>{0.444794297f, 0.27222079f},
-std::array<float,2>{0.588408113f, 0.024931578f},
-std::array<float,2>{0.116215989f, 0.911924958f},
-std::array<float,2>{0.627016127f, 0.807569981f},
-std::array<float,2>{0.197773531f, 0.151844829f},
-std::array<float,2>{0.835167944f, 0.466077745f},
-std::array<float,2>{0.250987738f, 0.704030812f},
-std::array<float,2>{0.887997568f, 0.875489712f},
-std::array<float,2>{0.402489245f, 0.0395005904f},
-std::array<float,2>{0.530587137f, 0.309018165f},
-std::array<float,2>{0.0405344144f, 0.558974922f},
-std::array<float,2>{0.731156349f, 0.740227401f},
-std::array<float,2>{0.186808094f, 0.483764499f},
-std::array<float,2>{0.806297004f, 0.182522669f},
-std::array<float,2>{0.368357539f, 0.751434505f},
-std::array<float,2>{0.858996212f, 0.602982759f},
-std::array<float,2>{0.306310862f, 0.364231735f},
-std::array<float,2>{0.680518806f, 0.0735551417f},
-std::array<float,2>{0.245741501f, 0.993081093f},
-std::array<float,2>{0.622156858f, 0.816875339f},
-std::array<float,2>{0.089032352f, 0.248762682f},
-std::array<float,2>{0.972732723f, 0.377958566f},
-std::array<float,2>{0.476753563f, 0.675478816f},
-std::array<float,2>{0.752693653f, 0.801392674f},
-std::array<float,2>{0.336187333f, 0.146303102f},
-std::array<float,2>{0.703999519f, 0.456422567f},
-std::array<float,2>{0.14519988f, 0.714278698f},
-std::array<float,2>{0.54722476f, 0.512165844f},
-std::array<float,2>{0.0183354467f, 0.281190634f},
-std::array<float,2>{0.929933012f, 0.0231277775f},
-std::array<float,2>{0.413792223f, 0.920684576f},
-std::array<float,2>{0.940229952f, 0.632319808f},
-std::array<float,2>{0.466834337f, 0.434912384f},
-std::array<float,2>{0.569777429f, 0.200442255f},
-std::array<float,2>{0.0984487087f, 0.87217164f},
-std::array<float,2>{0.647451282f, 0.963863075f},
-std::array<float,2>{0.208915278f, 0.0959979668f},
-std::array<float,2>{0.820335686f, 0.331269532f},
-std::array<float,2>{0.266503483f, 0.571673989f},
-std::array<float,2>{0.999141753f, 0.857425094f},
-std::array<float,2>{0.496146798f, 0.216902897f},
-std::array<float,2>{0.608021617f, 0.408839166f},
-std::array<float,2>{0.0675805211f, 0.653913617f},
-std::array<float,2>{0.657072425f, 0.588399768f},
-std::array<float,2>{0.229867831f, 0.317827761f},
-std::array<float,2>{0.865940154f, 0.115404584f},
-std::array<float,2>{0.295378685f, 0.938301682f},
-std::array<float,2>{0.784947395f, 0.695425749f},
-std::array<float,2>{0.350921571f, 0.450947285f},
-std::array<float,2>{0.742044091f, 0.135973886f},
-std::array<float,2>{0.168164149f, 0.792480469f},
-std::array<float,2>{0.505765378f, 0.936086118f},
-std::array<float,2>{0.0476873964f, 0.00522411801f},
-std::array<float,2>{0.903059542f, 0.260148913f},
-std::array<float,2>{0.376392871f, 0.524152875f},
-std::array<float,2>{0.82830286f, 0.969596446f},
-std::array<float,2>{0.256857067f, 0.0813217461f},
-std::array<float,2>{0.630131781f, 0.352886289f},
-std::array<float,2>{0.202424258f, 0.623303533f},
-std::array<float,2>{0.591890335f, 0.666982114f},
-std::array<float,2>{0.112021916f, 0.400710046f},
-std::array<float,2>{0.965057731f, 0.223990873f},
-std::array<float,2>{0.440018773f, 0.834640145f},
-std::array<float,2>{0.9138574f, 0.544135392f},
-std::array<float,2>{0.436747432f, 0.294676632f},
-std::array<float,2>{0.543752193f, 0.0491430163f},
-std::array<float,2>{0.00913243275f, 0.905246854f},
-std::array<float,2>{0.702761173f, 0.777698874f},
-std::array<float,2>{0.129842892f, 0.170321256f},
-std::array<float,2>{0.769678712f, 0.497535169f},
-std::array<float,2>{0.317505628f, 0.723491907f},
-std::array<float,2>{0.95727855f, 0.952887118f},
-std::array<float,2>{0.445627868f, 0.121733628f},
-std::array<float,2>{0.580123186f, 0.322574109f},
-std::array<float,2>{0.119154215f, 0.584826112f},
-std::array<float,2>{0.638468683f, 0.647379398f},
-std::array<float,2>{0.191669747f, 0.415628433f},
-std::array<float,2>{0.837215602f, 0.203147411f},
-std::array<float,2>{0.261320621f, 0.851143122f},
-std::array<float,2>{0.775398254f, 0.523211837f},
-std::array<float,2>{0.322425246f, 0.255096436f},
-std::array<float,2>{0.688286662f, 0.00953387562f},
-std::array<float,2>{0.136995152f, 0.927991927f},
-std::array<float,2>{0.532223165f, 0.784888268f},
-std::array<float,2>{0.00615543267f, 0.131389186f},
-std::array<float,2>{0.914828837f, 0.443510175f},
-std::array<float,2>{0.427719682f, 0.687977254f},
-std::array<float,2>{0.869073808f, 0.840983391f},
-std::array<float,2>{0.282279938f, 0.230099127f},
-std::array<float,2>{0.671243548f, 0.392471969f},
-std::array<float,2>{0.224277973f, 0.662451446f},
-std::array<float,2>{0.598471582f, 0.6107651f},
-std::array<float,2>{0.0780485719f, 0.349364966f},
-std::array<float,2>{0.990058899f, 0.091380626f},
-std::array<float,2>{0.484444231f, 0.979445696f},
-std::array<float,2>{0.891991556f, 0.732913852f},
-std::array<float,2>{0.384374022f, 0.485166967f},
-std::array<float,2>{0.512441814f, 0.159594297f},
-std::array<float,2>{0.0548943616f, 0.770680845f},
-std::array<float,2>{0.7453807f, 0.89777261f},
-std::array<float,2>{0.156629428f, 0.0586351492f},
-std::array<float,2>{0.790542305f, 0.288880587f},
-std::array<float,2>{0.357327521f, 0.532428443f},
-std::array<float,2>{0.923710406f, 0.762323022f},
-std::array<float,2>{0.421598196f, 0.178578705f},
-std::array<float,2>{0.556080222f, 0.473671108f},
-std::array<float,2>{0.0251878966f, 0.745103896f},
-std::array<float,2>{0.714650273f, 0.547494471f},
-std::array<float,2>{0.151492313f, 0.30086571f},
-std::array<float,2>{0.76308614f, 0.0384349003f},
-std::array<float,2>{0.335486919f, 0.888048947f},
-std::array<float,2>{0.819496036f, 0.679758251f},
-std::array<float,2>{0.280247539f, 0.390114516f},
-std::array<float,2>{0.655890107f, 0.236374184f},
-std::array<float,2>{0.213973299f, 0.827139795f},
-std::array<float,2>{0.576630235f, 0.986564696f},
-std::array<float,2>{0.102232881f, 0.0649657175f},
-std::array<float,2>{0.948536277f, 0.368469656f},
-std::array<float,2>{0.45349133f, 0.59560293f},
-std::array<float,2>{0.802879632f, 0.907915175f},
-std::array<float,2>{0.365036964f, 0.0276777148f},
-std::array<float,2>{0.724139035f, 0.266741723f},
-std::array<float,2>{0.178199619f, 0.505058467f},
-std::array<float,2>{0.523370266f, 0.710758388f},
-std::array<float,2>{0.0378938317f, 0.462873757f},
-std::array<float,2>{0.875818849f, 0.154012203f},
-std::array<float,2>{0.392953217f, 0.809544742f},
-std::array<float,2>{0.978972733f, 0.563451529f},
-std::array<float,2>{0.471455663f, 0.341426969f},
-std::array<float,2>{0.614365101f, 0.106185861f},
-std::array<float,2>{0.0829209313f, 0.959754229f},
-std::array<float,2>{0.679613352f, 0.860318959f},
-std::array<float,2>{0.237581164f, 0.194792539f},
-std::array<float,2>{0.848920524f, 0.427325934f},
-std::array<float,2>{0.304326028f, 0.633682787f},
-std::array<float,2>{0.894802511f, 0.968726456f},
-std::array<float,2>{0.389561713f, 0.100275643f},
-std::array<float,2>{0.511143804f, 0.335144609f},
-std::array<float,2>{0.0602342784f, 0.577543139f},
-std::array<float,2>{0.747869968f, 0.628582537f},
-std::array<float,2>{0.162005827f, 0.433017105f},
-std::array<float,2>{0.794263661f, 0.197861522f},
-std::array<float,2>{0.353544414f, 0.868847847f},
-std::array<float,2>{0.87446022f, 0.509177148f},
-std::array<float,2>{0.287231773f, 0.276123852f},
-std::array<float,2>{0.664449453f, 0.0180709213f},
-std::array<float,2>{0.21884644f, 0.914555848f},
-std::array<float,2>{0.597600222f, 0.800600708f},
-std::array<float,2>{0.0732780546f, 0.144433007f},
-std::array<float,2>{0.985073388f, 0.460700691f},
-std::array<float,2>{0.48951304f, 0.717096686f},
-std::array<float,2>{0.779609084f, 0.81307137f},
-std::array<float,2>{0.32622838f, 0.242622524f},
-std::array<float,2>{0.691707075f, 0.379487038f},
-std::array<float,2>{0.135034069f, 0.67593354f},
-std::array<float,2>{0.536679149f, 0.606216788f},
-std::array<float,2>{0.00119671645f, 0.363257527f},
-std::array<float,2>{0.918542624f, 0.0768598616f},
-std::array<float,2>{0.423958689f, 0.997671783f},
-std::array<float,2>{0.95340991f, 0.735815227f},
-std::array<float,2>{0.450534165f, 0.478116632f},
-std::array<float,2>{0.584836185f, 0.183785841f},
-std::array<float,2>{0.124759451f, 0.756195545f},
-std::array<float,2>{0.634008706f, 0.880327523f},
-std::array<float,2>{0.189454198f, 0.0456568934f},
-std::array<float,2>{0.841903508f, 0.305446476f},
-std::array<float,2>{0.262258798f, 0.556620538f},
-std::array<float,2>{0.983423769f, 0.775978088f},
-std::array<float,2>{0.475617528f, 0.165290326f},
-std::array<float,2>{0.611186266f, 0.495037973f},
-std::array<float,2>{0.0817848668f, 0.722262263f},
-std::array<float,2>{0.672109187f, 0.540311813f},
-std::array<float,2>{0.241225109f, 0.289473921f},
-std::array<float,2>{0.846337259f, 0.0512905978f},
-std::array<float,2>{0.298280239f, 0.898561954f},
-std::array<float,2>{0.797487497f, 0.671689749f},
-std::array<float,2>{0.361234695f, 0.405767381f},
-std::array<float,2>{0.722073376f, 0.219101965f},
-std::array<float,2>{0.17499128f, 0.830205202f},
-std::array<float,2>{0.519059002f, 0.974508941f},
-std::array<float,2>{0.0336953886f, 0.0828525349f},
-std::array<float,2>{0.88259083f, 0.357523471f},
-std::array<float,2>{0.397585362f, 0.618677557f},
-std::array<float,2>{0.812603056f, 0.931069791f},
-std::array<float,2>{0.2750974f, 0.000581890286f},
-std::array<float,2>{0.650413275f, 0.263317317f},
-std::array<float,2>{0.217875391f, 0.528875113f},
-std::array<float,2>{0.573588192f, 0.700476468f},
-std::array<float,2>{0.107167572f, 0.44576481f},
-std::array<float,2>{0.951498926f, 0.14021942f},
-std::array<float,2>{0.45861578f, 0.796836436f},
-std::array<float,2>{0.926557958f, 0.590589404f},
-std::array<float,2>{0.416677505f, 0.313276678f},
-std::array<float,2>{0.560874879f, 0.110480741f},
-std::array<float,2>{0.0308035202f, 0.94350338f},
-std::array<float,2>{0.714947283f, 0.851680279f},
-std::array<float,2>{0.153485864f, 0.211589426f},
-std::array<float,2>{0.761246383f, 0.414055735f},
-std::array<float,2>{0.330754429f, 0.649474502f},
-std::array<float,2>{0.944173574f, 0.891711175f},
-std::array<float,2>{0.461850524f, 0.0562558919f},
-std::array<float,2>{0.564972222f, 0.283119887f},
-std::array<float,2>{0.0960153714f, 0.539048493f},
-std::array<float,2>{0.643009424f, 0.729139864f},
-std::array<float,2>{0.204601794f, 0.488471359f},
-std::array<float,2>{0.82603538f, 0.161263704f},
-std::array<float,2>{0.270568937f, 0.766420066f},
-std::array<float,2>{0.755499423f, 0.616945088f},
-std::array<float,2>{0.340359539f, 0.346326083f},
-std::array<float,2>{0.708812535f, 0.0863273442f},
-std::array<float,2>{0.141271651f, 0.983614266f},
-std::array<float,2>{0.552416146f, 0.837569594f},
-std::array<float,2>{0.0200596116f, 0.231408015f},
-std::array<float,2>{0.937136412f, 0.397839814f},
-std::array<float,2>{0.409277976f, 0.658637822f},
-std::array<float,2>{0.852952421f, 0.786344826f},
-std::array<float,2>{0.31229642f, 0.128405899f},
-std::array<float,2>{0.684403658f, 0.437909573f},
-std::array<float,2>{0.247851312f, 0.691751301f},
-std::array<float,2>{0.617254436f, 0.516384542f},
-std::array<float,2>{0.0930511802f, 0.251069158f},
-std::array<float,2>{0.971146584f, 0.0143658472f},
-std::array<float,2>{0.482042521f, 0.925251007f},
-std::array<float,2>{0.885649621f, 0.643929064f},
-std::array<float,2>{0.400075704f, 0.418990493f},
-std::array<float,2>{0.523848414f, 0.208939821f},
-std::array<float,2>{0.0459068976f, 0.845493734f},
-std::array<float,2>{0.730237842f, 0.946115732f},
-std::array<float,2>{0.183053106f, 0.118346289f},
-std::array<float,2>{0.810698152f, 0.326973259f},
-std::array<float,2>{0.372515708f, 0.578970551f},
-std::array<float,2>{0.910089672f, 0.867067277f},
-std::array<float,2>{0.431363821f, 0.19110626f},
-std::array<float,2>{0.539227724f, 0.422516286f},
-std::array<float,2>{0.0140900742f, 0.639844f},
-std::array<float,2>{0.696042061f, 0.568597198f},
-std::array<float,2>{0.127386898f, 0.33942011f},
-std::array<float,2>{0.769417703f, 0.103165299f},
-std::array<float,2>{0.316052139f, 0.954960942f},
-std::array<float,2>{0.833929718f, 0.705230355f},
-std::array<float,2>{0.253679723f, 0.46747601f},
-std::array<float,2>{0.626440287f, 0.149277464f},
-std::array<float,2>{0.196412846f, 0.80648303f},
-std::array<float,2>{0.587401032f, 0.913341403f},
-std::array<float,2>{0.11328958f, 0.0263268966f},
-std::array<float,2>{0.964799941f, 0.270848155f},
-std::array<float,2>{0.443080425f, 0.50068152f},
-std::array<float,2>{0.787371993f, 0.989322126f},
-std::array<float,2>{0.346373796f, 0.0688777864f},
-std::array<float,2>{0.734631002f, 0.374908119f},
-std::array<float,2>{0.165206149f, 0.601198196f},
-std::array<float,2>{0.50376147f, 0.685237408f},
-std::array<float,2>{0.0508940592f, 0.386514336f},
-std::array<float,2>{0.901187301f, 0.242167398f},
-std::array<float,2>{0.382062167f, 0.820676565f},
-std::array<float,2>{0.992584586f, 0.553615808f},
-std::array<float,2>{0.495473117f, 0.299369872f},
-std::array<float,2>{0.604059577f, 0.0350299291f},
-std::array<float,2>{0.0660712197f, 0.884634674f},
-std::array<float,2>{0.660773993f, 0.760665059f},
-std::array<float,2>{0.233925208f, 0.174353659f},
-std::array<float,2>{0.860341668f, 0.469537288f},
-std::array<float,2>{0.290032655f, 0.747919619f},
-std::array<float,2>{0.93173933f, 0.91927284f},
-std::array<float,2>{0.410540134f, 0.0196968336f},
-std::array<float,2>{0.549561322f, 0.277546465f},
-std::array<float,2>{0.0159602482f, 0.514012396f},
-std::array<float,2>{0.706944942f, 0.71165365f},
-std::array<float,2>{0.147865385f, 0.453990847f},
-std::array<float,2>{0.75092572f, 0.14827162f},
-std::array<float,2>{0.338814288f, 0.803037167f},
-std::array<float,2>{0.822574317f, 0.573792875f},
-std::array<float,2>{0.268308133f, 0.329230815f},
-std::array<float,2>{0.645399153f, 0.095192492f},
-std::array<float,2>{0.209476128f, 0.962062895f},
-std::array<float,2>{0.566434562f, 0.874629319f},
-std::array<float,2>{0.101050973f, 0.20149146f},
-std::array<float,2>{0.937868118f, 0.436291307f},
-std::array<float,2>{0.465448081f, 0.629799962f},
-std::array<float,2>{0.806774139f, 0.753416598f},
-std::array<float,2>{0.369607419f, 0.180914536f},
-std::array<float,2>{0.733948529f, 0.4817788f},
-std::array<float,2>{0.184192643f, 0.740301251f},
-std::array<float,2>{0.528115153f, 0.561627448f},
-std::array<float,2>{0.0419168882f, 0.311932564f},
-std::array<float,2>{0.888677299f, 0.0410614833f},
-std::array<float,2>{0.404601276f, 0.877780735f},
-std::array<float,2>{0.975280881f, 0.672451258f},
-std::array<float,2>{0.479598612f, 0.376298845f},
-std::array<float,2>{0.623514175f, 0.247026309f},
-std::array<float,2>{0.0876901522f, 0.820204139f},
-std::array<float,2>{0.68293649f, 0.995655179f},
-std::array<float,2>{0.243656427f, 0.0720716938f},
-std::array<float,2>{0.856948674f, 0.366611928f},
-std::array<float,2>{0.307348907f, 0.604003131f},
-std::array<float,2>{0.968023777f, 0.833353102f},
-std::array<float,2>{0.438775718f, 0.224772379f},
-std::array<float,2>{0.59094888f, 0.399030983f},
-std::array<float,2>{0.110036485f, 0.66547066f},
-std::array<float,2>{0.632647872f, 0.6222893f},
-std::array<float,2>{0.199504644f, 0.355186313f},
-std::array<float,2>{0.831038535f, 0.0789610893f},
-std::array<float,2>{0.25537017f, 0.970835507f},
-std::array<float,2>{0.773344398f, 0.724782348f},
-std::array<float,2>{0.320236981f, 0.498959631f},
-std::array<float,2>{0.699662805f, 0.169835359f},
-std::array<float,2>{0.132633075f, 0.779875278f},
-std::array<float,2>{0.546827495f, 0.903310537f},
-std::array<float,2>{0.0101912776f, 0.0486702174f},
-std::array<float,2>{0.910281003f, 0.296378344f},
-std::array<float,2>{0.434357136f, 0.546702445f},
-std::array<float,2>{0.864173055f, 0.939670622f},
-std::array<float,2>{0.294722378f, 0.113463514f},
-std::array<float,2>{0.65832305f, 0.319399148f},
-std::array<float,2>{0.228108466f, 0.585958838f},
-std::array<float,2>{0.607306659f, 0.655829489f},
-std::array<float,2>{0.0690557659f, 0.406718224f},
-std::array<float,2>{0.99756217f, 0.215017468f},
-std::array<float,2>{0.498794705f, 0.856444061f},
-std::array<float,2>{0.905370712f, 0.525945842f},
-std::array<float,2>{0.377851844f, 0.259092897f},
-std::array<float,2>{0.507533073f, 0.00641950127f},
-std::array<float,2>{0.0493541919f, 0.933796823f},
-std::array<float,2>{0.740216374f, 0.789086401f},
-std::array<float,2>{0.171638578f, 0.133848801f},
-std::array<float,2>{0.781928122f, 0.452106476f},
-std::array<float,2>{0.349196285f, 0.698244631f},
-std::array<float,2>{0.991807759f, 0.977157235f},
-std::array<float,2>{0.487947106f, 0.0935647339f},
-std::array<float,2>{0.599806845f, 0.350837708f},
-std::array<float,2>{0.0753903911f, 0.612373292f},
-std::array<float,2>{0.668610036f, 0.661616206f},
-std::array<float,2>{0.224920183f, 0.394133091f},
-std::array<float,2>{0.870115221f, 0.226791933f},
-std::array<float,2>{0.284083664f, 0.843590558f},
-std::array<float,2>{0.79167676f, 0.533594251f},
-std::array<float,2>{0.357889473f, 0.286226451f},
-std::array<float,2>{0.742780447f, 0.0623020232f},
-std::array<float,2>{0.159335613f, 0.894985437f},
-std::array<float,2>{0.515420377f, 0.772090554f},
-std::array<float,2>{0.0574392825f, 0.156549633f},
-std::array<float,2>{0.892809153f, 0.487858295f},
-std::array<float,2>{0.38525176f, 0.731692493f},
-std::array<float,2>{0.838531911f, 0.849298418f},
-std::array<float,2>{0.257890165f, 0.205441535f},
-std::array<float,2>{0.63997364f, 0.416436583f},
-std::array<float,2>{0.194654018f, 0.644687831f},
-std::array<float,2>{0.580023527f, 0.582297623f},
-std::array<float,2>{0.117259167f, 0.321166933f},
-std::array<float,2>{0.959432721f, 0.12496902f},
-std::array<float,2>{0.449051231f, 0.950495124f},
-std::array<float,2>{0.917850494f, 0.690918446f},
-std::array<float,2>{0.428275704f, 0.442760766f},
-std::array<float,2>{0.533495069f, 0.129535392f},
-std::array<float,2>{0.00416704873f, 0.781597197f},
-std::array<float,2>{0.690931618f, 0.926472425f},
-std::array<float,2>{0.139411271f, 0.0103726508f},
-std::array<float,2>{0.775380731f, 0.256389111f},
-std::array<float,2>{0.32160306f, 0.520609915f},
-std::array<float,2>{0.877318144f, 0.812021494f},
-std::array<float,2>{0.392539889f, 0.155775547f},
-std::array<float,2>{0.519688606f, 0.463242382f},
-std::array<float,2>{0.0367907397f, 0.708089828f},
-std::array<float,2>{0.725640535f, 0.506264985f},
-std::array<float,2>{0.175926998f, 0.268788934f},
-std::array<float,2>{0.802130461f, 0.0301865507f},
-std::array<float,2>{0.366273433f, 0.908637643f},
-std::array<float,2>{0.850143492f, 0.634961486f},
-std::array<float,2>{0.301018238f, 0.429258972f},
-std::array<float,2>{0.676367939f, 0.192829221f},
-std::array<float,2>{0.235982373f, 0.861973226f},
-std::array<float,2>{0.616369009f, 0.958582819f},
-std::array<float,2>{0.0849396661f, 0.108277239f},
-std::array<float,2>{0.977998078f, 0.343645781f},
-std::array<float,2>{0.468808532f, 0.565602601f},
-std::array<float,2>{0.764888346f, 0.889161229f},
-std::array<float,2>{0.332130462f, 0.0368360803f},
-std::array<float,2>{0.711901128f, 0.3034361f},
-std::array<float,2>{0.150258839f, 0.550761044f},
-std::array<float,2>{0.557011902f, 0.743470907f},
-std::array<float,2>{0.0253918562f, 0.476242959f},
-std::array<float,2>{0.92422688f, 0.176765189f},
-std::array<float,2>{0.419134498f, 0.76418817f},
-std::array<float,2>{0.946217775f, 0.596870303f},
-std::array<float,2>{0.455661356f, 0.369632363f},
-std::array<float,2>{0.574388206f, 0.0632120147f},
-std::array<float,2>{0.104206152f, 0.985244393f},
-std::array<float,2>{0.654266119f, 0.824938178f},
-std::array<float,2>{0.212754861f, 0.236150801f},
-std::array<float,2>{0.817419589f, 0.386791736f},
-std::array<float,2>{0.279033571f, 0.683485031f},
-std::array<float,2>{0.907629311f, 0.954476535f},
-std::array<float,2>{0.432540983f, 0.102960698f},
-std::array<float,2>{0.542901516f, 0.339256614f},
-std::array<float,2>{0.0125443703f, 0.569110215f},
-std::array<float,2>{0.699018419f, 0.640229702f},
-std::array<float,2>{0.126674861f, 0.422194242f},
-std::array<float,2>{0.767133772f, 0.190749526f},
-std::array<float,2>{0.313827097f, 0.866486251f},
-std::array<float,2>{0.835730672f, 0.500368655f},
-std::array<float,2>{0.251571476f, 0.271404475f},
-std::array<float,2>{0.627612591f, 0.025687648f},
-std::array<float,2>{0.197308078f, 0.913833559f},
-std::array<float,2>{0.588210821f, 0.805807173f},
-std::array<float,2>{0.116760373f, 0.148878038f},
-std::array<float,2>{0.961612642f, 0.467045873f},
-std::array<float,2>{0.445088714f, 0.705744028f},
-std::array<float,2>{0.78677845f, 0.820880234f},
-std::array<float,2>{0.343938947f, 0.2414193f},
-std::array<float,2>{0.736482024f, 0.38587147f},
-std::array<float,2>{0.166675583f, 0.684962809f},
-std::array<float,2>{0.501016438f, 0.600714266f},
-std::array<float,2>{0.054551363f, 0.374421597f},
-std::array<float,2>{0.899491847f, 0.0686159283f},
-std::array<float,2>{0.380651087f, 0.99004072f},
-std::array<float,2>{0.994297504f, 0.747472048f},
-std::array<float,2>{0.492377281f, 0.468939334f},
-std::array<float,2>{0.602173448f, 0.174148053f},
-std::array<float,2>{0.0630840063f, 0.760053694f},
-std::array<float,2>{0.663449049f, 0.884255648f},
-std::array<float,2>{0.231289253f, 0.0342032164f},
-std::array<float,2>{0.861995816f, 0.299134761f},
-std::array<float,2>{0.292517304f, 0.552775443f},
-std::array<float,2>{0.942797601f, 0.76608634f},
-std::array<float,2>{0.463684767f, 0.161827013f},
-std::array<float,2>{0.563583493f, 0.489101142f},
-std::array<float,2>{0.0955869555f, 0.728899717f},
-std::array<float,2>{0.642233133f, 0.538366318f},
-std::array<float,2>{0.205117017f, 0.282708108f},
-std::array<float,2>{0.826449275f, 0.0557208247f},
-std::array<float,2>{0.272694737f, 0.892500103f},
-std::array<float,2>{0.756850183f, 0.658787608f},
-std::array<float,2>{0.342419356f, 0.398246944f},
-std::array<float,2>{0.710089684f, 0.230949357f},
-std::array<float,2>{0.143398851f, 0.837366283f},
-std::array<float,2>{0.553630292f, 0.984074235f},
-std::array<float,2>{0.0216687303f, 0.0868488476f},
-std::array<float,2>{0.934903681f, 0.345757365f},
-std::array<float,2>{0.406899691f, 0.616604447f},
-std::array<float,2>{0.855293393f, 0.925581694f},
-std::array<float,2>{0.310175985f, 0.0140440362f},
-std::array<float,2>{0.68579489f, 0.25170958f},
-std::array<float,2>{0.248248056f, 0.516099215f},
-std::array<float,2>{0.620151579f, 0.692037106f},
-std::array<float,2>{0.0904060602f, 0.438332438f},
-std::array<float,2>{0.969155729f, 0.128615737f},
-std::array<float,2>{0.484196514f, 0.787109137f},
-std::array<float,2>{0.884491265f, 0.578281462f},
-std::array<float,2>{0.402216285f, 0.326309323f},
-std::array<float,2>{0.526975334f, 0.118683837f},
-std::array<float,2>{0.0436611809f, 0.945589721f},
-std::array<float,2>{0.727433026f, 0.844804049f},
-std::array<float,2>{0.180006385f, 0.208400935f},
-std::array<float,2>{0.80873245f, 0.419861287f},
-std::array<float,2>{0.374420822f, 0.644136667f},
-std::array<float,2>{0.981663764f, 0.89931643f},
-std::array<float,2>{0.473550975f, 0.0510463528f},
-std::array<float,2>{0.611723006f, 0.28961277f},
-std::array<float,2>{0.0791060701f, 0.540907204f},
-std::array<float,2>{0.674592555f, 0.722129345f},
-std::array<float,2>{0.240146279f, 0.494598746f},
-std::array<float,2>{0.844373465f, 0.165687606f},
-std::array<float,2>{0.299827218f, 0.775438011f},
-std::array<float,2>{0.798864901f, 0.618593276f},
-std::array<float,2>{0.36313051f, 0.35831669f},
-std::array<float,2>{0.718794584f, 0.0820651501f},
-std::array<float,2>{0.173191532f, 0.973801315f},
-std::array<float,2>{0.516020834f, 0.830568016f},
-std::array<float,2>{0.032344237f, 0.219669253f},
-std::array<float,2>{0.879939795f, 0.405456543f},
-std::array<float,2>{0.395151258f, 0.671158433f},
-std::array<float,2>{0.816030562f, 0.796116233f},
-std::array<float,2>{0.276827097f, 0.139888987f},
-std::array<float,2>{0.648860693f, 0.446093351f},
-std::array<float,2>{0.216677442f, 0.700796008f},
-std::array<float,2>{0.571584105f, 0.528777778f},
-std::array<float,2>{0.108578503f, 0.262793958f},
-std::array<float,2>{0.949755609f, 0.000404367398f},
-std::array<float,2>{0.460551739f, 0.931595564f},
-std::array<float,2>{0.928314686f, 0.650290132f},
-std::array<float,2>{0.414652735f, 0.413194358f},
-std::array<float,2>{0.559598327f, 0.211425766f},
-std::array<float,2>{0.0276580602f, 0.85217011f},
-std::array<float,2>{0.717921555f, 0.944198668f},
-std::array<float,2>{0.155474201f, 0.111148149f},
-std::array<float,2>{0.759058893f, 0.312638968f},
-std::array<float,2>{0.328750998f, 0.590144753f},
-std::array<float,2>{0.896697044f, 0.868578374f},
-std::array<float,2>{0.38753289f, 0.19740288f},
-std::array<float,2>{0.509261787f, 0.433512002f},
-std::array<float,2>{0.0614870116f, 0.628159165f},
-std::array<float,2>{0.748139441f, 0.578033268f},
-std::array<float,2>{0.163916096f, 0.335666776f},
-std::array<float,2>{0.795560062f, 0.0999810025f},
-std::array<float,2>{0.352451563f, 0.967947543f},
-std::array<float,2>{0.872787714f, 0.717487037f},
-std::array<float,2>{0.286104888f, 0.460041165f},
-std::array<float,2>{0.66735363f, 0.143774003f},
-std::array<float,2>{0.221496999f, 0.800132811f},
-std::array<float,2>{0.594799101f, 0.914409578f},
-std::array<float,2>{0.0716244504f, 0.0176923536f},
-std::array<float,2>{0.986473501f, 0.275752634f},
-std::array<float,2>{0.490638703f, 0.509702742f},
-std::array<float,2>{0.777482212f, 0.997514725f},
-std::array<float,2>{0.324341744f, 0.0763573721f},
-std::array<float,2>{0.694788635f, 0.362782955f},
-std::array<float,2>{0.133836493f, 0.605622709f},
-std::array<float,2>{0.537661731f, 0.676616251f},
-std::array<float,2>{0.00255625066f, 0.379178703f},
-std::array<float,2>{0.921095848f, 0.24310267f},
-std::array<float,2>{0.42260161f, 0.812725067f},
-std::array<float,2>{0.956179678f, 0.55607909f},
-std::array<float,2>{0.451860666f, 0.304978371f},
-std::array<float,2>{0.583393455f, 0.045318678f},
-std::array<float,2>{0.122584306f, 0.880735755f},
-std::array<float,2>{0.63590312f, 0.756425917f},
-std::array<float,2>{0.188967913f, 0.184276775f},
-std::array<float,2>{0.840138912f, 0.477801889f},
-std::array<float,2>{0.264786243f, 0.736203015f},
-std::array<float,2>{0.875264466f, 0.909124911f},
-std::array<float,2>{0.393523723f, 0.0293562897f},
-std::array<float,2>{0.522638679f, 0.269114405f},
-std::array<float,2>{0.0372595862f, 0.506677389f},
-std::array<float,2>{0.723894119f, 0.708706737f},
-std::array<float,2>{0.178463057f, 0.463813275f},
-std::array<float,2>{0.803412199f, 0.15575929f},
-std::array<float,2>{0.364500791f, 0.811704099f},
-std::array<float,2>{0.849452913f, 0.566113591f},
-std::array<float,2>{0.30409193f, 0.343207091f},
-std::array<float,2>{0.679139495f, 0.10764645f},
-std::array<float,2>{0.237802595f, 0.958261847f},
-std::array<float,2>{0.614807487f, 0.86169225f},
-std::array<float,2>{0.0823266357f, 0.193013087f},
-std::array<float,2>{0.979103863f, 0.428876132f},
-std::array<float,2>{0.471040785f, 0.635676622f},
-std::array<float,2>{0.76333493f, 0.763899922f},
-std::array<float,2>{0.335112214f, 0.177547574f},
-std::array<float,2>{0.713955641f, 0.475794137f},
-std::array<float,2>{0.152233422f, 0.743770719f},
-std::array<float,2>{0.556529403f, 0.550138175f},
-std::array<float,2>{0.0245087761f, 0.30295527f},
-std::array<float,2>{0.923223615f, 0.0361389741f},
-std::array<float,2>{0.421136886f, 0.888908803f},
-std::array<float,2>{0.949032068f, 0.682919443f},
-std::array<float,2>{0.453694046f, 0.387334853f},
-std::array<float,2>{0.576690316f, 0.235741556f},
-std::array<float,2>{0.102027759f, 0.824394584f},
-std::array<float,2>{0.655522525f, 0.984745026f},
-std::array<float,2>{0.214357764f, 0.0625709966f},
-std::array<float,2>{0.819838285f, 0.369578511f},
-std::array<float,2>{0.279747754f, 0.597477138f},
-std::array<float,2>{0.989287674f, 0.842890263f},
-std::array<float,2>{0.485170126f, 0.227314755f},
-std::array<float,2>{0.597715259f, 0.394022286f},
-std::array<float,2>{0.0772445127f, 0.66206032f},
-std::array<float,2>{0.671800256f, 0.612818658f},
-std::array<float,2>{0.223911554f, 0.351559639f},
-std::array<float,2>{0.868172705f, 0.0931065306f},
-std::array<float,2>{0.283156157f, 0.976685822f},
-std::array<float,2>{0.790313184f, 0.7320683f},
-std::array<float,2>{0.356628954f, 0.487361699f},
-std::array<float,2>{0.746092618f, 0.157001927f},
-std::array<float,2>{0.156970248f, 0.771738052f},
-std::array<float,2>{0.511974037f, 0.895360291f},
-std::array<float,2>{0.0552705377f, 0.0619814247f},
-std::array<float,2>{0.892135322f, 0.286684573f},
-std::array<float,2>{0.384260178f, 0.534173906f},
-std::array<float,2>{0.837806642f, 0.951075375f},
-std::array<float,2>{0.260899216f, 0.124086969f},
-std::array<float,2>{0.637992322f, 0.320596069f},
-std::array<float,2>{0.192144364f, 0.582666874f},
-std::array<float,2>{0.580666661f, 0.645392001f},
-std::array<float,2>{0.119892128f, 0.41663301f},
-std::array<float,2>{0.957552552f, 0.205803245f},
-std::array<float,2>{0.446155161f, 0.848948836f},
-std::array<float,2>{0.914436519f, 0.52126044f},
-std::array<float,2>{0.426872343f, 0.256124735f},
-std::array<float,2>{0.531402826f, 0.00995814428f},
-std::array<float,2>{0.00653263042f, 0.926206291f},
-std::array<float,2>{0.687778175f, 0.782178521f},
-std::array<float,2>{0.137605309f, 0.129026085f},
-std::array<float,2>{0.776116371f, 0.44299975f},
-std::array<float,2>{0.323079914f, 0.690536857f},
-std::array<float,2>{0.965697169f, 0.971441984f},
-std::array<float,2>{0.439820409f, 0.0784724802f},
-std::array<float,2>{0.592390239f, 0.354659706f},
-std::array<float,2>{0.11151842f, 0.622592568f},
-std::array<float,2>{0.630803645f, 0.665861785f},
-std::array<float,2>{0.203034788f, 0.398513913f},
-std::array<float,2>{0.82895422f, 0.225231037f},
-std::array<float,2>{0.25735265f, 0.833842516f},
-std::array<float,2>{0.770449042f, 0.546126425f},
-std::array<float,2>{0.318347931f, 0.296622753f},
-std::array<float,2>{0.702387273f, 0.0483132452f},
-std::array<float,2>{0.129275396f, 0.902721882f},
-std::array<float,2>{0.543014586f, 0.779737413f},
-std::array<float,2>{0.00968349818f, 0.169003084f},
-std::array<float,2>{0.913129389f, 0.498115838f},
-std::array<float,2>{0.437460452f, 0.725493729f},
-std::array<float,2>{0.865457773f, 0.855669916f},
-std::array<float,2>{0.295447618f, 0.215616643f},
-std::array<float,2>{0.656682014f, 0.407115698f},
-std::array<float,2>{0.230199754f, 0.655705869f},
-std::array<float,2>{0.607600391f, 0.58690995f},
-std::array<float,2>{0.0679487735f, 0.319987267f},
-std::array<float,2>{0.999678373f, 0.11387068f},
-std::array<float,2>{0.496649832f, 0.940139413f},
-std::array<float,2>{0.902391732f, 0.698860347f},
-std::array<float,2>{0.376837552f, 0.451250821f},
-std::array<float,2>{0.505046606f, 0.134292483f},
-std::array<float,2>{0.0470433831f, 0.789687812f},
-std::array<float,2>{0.741530478f, 0.934349f},
-std::array<float,2>{0.168905675f, 0.00619704509f},
-std::array<float,2>{0.784577668f, 0.259745926f},
-std::array<float,2>{0.351405323f, 0.525693893f},
-std::array<float,2>{0.930198789f, 0.803633928f},
-std::array<float,2>{0.413351715f, 0.147825122f},
-std::array<float,2>{0.547792673f, 0.453349441f},
-std::array<float,2>{0.0180521589f, 0.711367428f},
-std::array<float,2>{0.703392625f, 0.514418066f},
-std::array<float,2>{0.144868538f, 0.277961373f},
-std::array<float,2>{0.752230167f, 0.0204266384f},
-std::array<float,2>{0.336605728f, 0.91968739f},
-std::array<float,2>{0.821187735f, 0.629079044f},
-std::array<float,2>{0.265822202f, 0.435572535f},
-std::array<float,2>{0.646935999f, 0.201896369f},
-std::array<float,2>{0.208182186f, 0.8743276f},
-std::array<float,2>{0.569950521f, 0.962742925f},
-std::array<float,2>{0.0980940461f, 0.0954542682f},
-std::array<float,2>{0.939848423f, 0.330052108f},
-std::array<float,2>{0.467665404f, 0.573722899f},
-std::array<float,2>{0.806137979f, 0.877017796f},
-std::array<float,2>{0.369116634f, 0.0418618135f},
-std::array<float,2>{0.730499446f, 0.312393486f},
-std::array<float,2>{0.187113121f, 0.562477052f},
-std::array<float,2>{0.531112313f, 0.740948439f},
-std::array<float,2>{0.0402588956f, 0.482290924f},
-std::array<float,2>{0.888452947f, 0.181546867f},
-std::array<float,2>{0.40327695f, 0.753881931f},
-std::array<float,2>{0.973362982f, 0.604340553f},
-std::array<float,2>{0.477314651f, 0.36703229f},
-std::array<float,2>{0.622922063f, 0.0715204477f},
-std::array<float,2>{0.0893735215f, 0.995357931f},
-std::array<float,2>{0.679875553f, 0.819553316f},
-std::array<float,2>{0.245271161f, 0.246295333f},
-std::array<float,2>{0.858444393f, 0.376840919f},
-std::array<float,2>{0.305703133f, 0.67220813f},
-std::array<float,2>{0.900513291f, 0.990654349f},
-std::array<float,2>{0.382385105f, 0.0678132623f},
-std::array<float,2>{0.50306344f, 0.373037994f},
-std::array<float,2>{0.0512991026f, 0.599352717f},
-std::array<float,2>{0.734947503f, 0.686711907f},
-std::array<float,2>{0.165973306f, 0.384135067f},
-std::array<float,2>{0.788021147f, 0.240111575f},
-std::array<float,2>{0.346099824f, 0.824033856f},
-std::array<float,2>{0.859591544f, 0.552499175f},
-std::array<float,2>{0.289392292f, 0.298004806f},
-std::array<float,2>{0.660166025f, 0.0320828594f},
-std::array<float,2>{0.233487308f, 0.885841131f},
-std::array<float,2>{0.603535593f, 0.757855356f},
-std::array<float,2>{0.0657774284f, 0.173200831f},
-std::array<float,2>{0.992948413f, 0.471981764f},
-std::array<float,2>{0.495754421f, 0.749023557f},
-std::array<float,2>{0.768825054f, 0.863839805f},
-std::array<float,2>{0.31567362f, 0.189229846f},
-std::array<float,2>{0.69550997f, 0.424252272f},
-std::array<float,2>{0.127817675f, 0.637886465f},
-std::array<float,2>{0.539615393f, 0.567263067f},
-std::array<float,2>{0.0143481046f, 0.336607367f},
-std::array<float,2>{0.909619272f, 0.105185784f},
-std::array<float,2>{0.430791527f, 0.95577395f},
-std::array<float,2>{0.964034736f, 0.703134239f},
-std::array<float,2>{0.442491293f, 0.466374099f},
-std::array<float,2>{0.587857902f, 0.152129441f},
-std::array<float,2>{0.114148453f, 0.807052076f},
-std::array<float,2>{0.626777649f, 0.911355913f},
-std::array<float,2>{0.196913436f, 0.0246836655f},
-std::array<float,2>{0.833383083f, 0.271912575f},
-std::array<float,2>{0.253321171f, 0.502819359f},
-std::array<float,2>{0.971458316f, 0.78866291f},
-std::array<float,2>{0.481864274f, 0.12569195f},
-std::array<float,2>{0.618045211f, 0.441324443f},
-std::array<float,2>{0.0936277807f, 0.694621742f},
-std::array<float,2>{0.683844686f, 0.518306494f},
-std::array<float,2>{0.247475073f, 0.252517551f},
-std::array<float,2>{0.853192627f, 0.0123071149f},
-std::array<float,2>{0.311933547f, 0.922851145f},
-std::array<float,2>{0.811131775f, 0.642363846f},
-std::array<float,2>{0.3727974f, 0.421167225f},
-std::array<float,2>{0.729690969f, 0.20913963f},
-std::array<float,2>{0.183328107f, 0.846242011f},
-std::array<float,2>{0.524011135f, 0.949142516f},
-std::array<float,2>{0.0467484482f, 0.12040136f},
-std::array<float,2>{0.884972751f, 0.326020181f},
-std::array<float,2>{0.399592787f, 0.581255257f},
-std::array<float,2>{0.825499713f, 0.893536925f},
-std::array<float,2>{0.271332771f, 0.0568282045f},
-std::array<float,2>{0.643285334f, 0.28428182f},
-std::array<float,2>{0.204385489f, 0.53605032f},
-std::array<float,2>{0.56487447f, 0.728002012f},
-std::array<float,2>{0.0963118076f, 0.490342647f},
-std::array<float,2>{0.943609893f, 0.162380084f},
-std::array<float,2>{0.461221635f, 0.769142687f},
-std::array<float,2>{0.936703444f, 0.613638997f},
-std::array<float,2>{0.410096139f, 0.345533311f},
-std::array<float,2>{0.552189648f, 0.0896741003f},
-std::array<float,2>{0.0197741091f, 0.981136143f},
-std::array<float,2>{0.708103716f, 0.838098168f},
-std::array<float,2>{0.140794516f, 0.233517915f},
-std::array<float,2>{0.755187988f, 0.394539356f},
-std::array<float,2>{0.340229064f, 0.656767905f},
-std::array<float,2>{0.952037632f, 0.932507813f},
-std::array<float,2>{0.458368778f, 0.00360915554f},
-std::array<float,2>{0.574083328f, 0.264938176f},
-std::array<float,2>{0.106725551f, 0.530002713f},
-std::array<float,2>{0.650915802f, 0.702533543f},
-std::array<float,2>{0.218591169f, 0.448657155f},
-std::array<float,2>{0.813372433f, 0.137848988f},
-std::array<float,2>{0.27473703f, 0.793478191f},
-std::array<float,2>{0.760841727f, 0.592689276f},
-std::array<float,2>{0.330132514f, 0.315459222f},
-std::array<float,2>{0.715556741f, 0.112464592f},
-std::array<float,2>{0.154068694f, 0.941825688f},
-std::array<float,2>{0.561142683f, 0.854886472f},
-std::array<float,2>{0.030526815f, 0.21343866f},
-std::array<float,2>{0.925953269f, 0.411895603f},
-std::array<float,2>{0.416480333f, 0.652164638f},
-std::array<float,2>{0.846041381f, 0.77357322f},
-std::array<float,2>{0.298811018f, 0.166332975f},
-std::array<float,2>{0.672527194f, 0.49308756f},
-std::array<float,2>{0.242128223f, 0.719813406f},
-std::array<float,2>{0.610556841f, 0.541968524f},
-std::array<float,2>{0.0813370273f, 0.292686254f},
-std::array<float,2>{0.983958781f, 0.0546719208f},
-std::array<float,2>{0.476310641f, 0.901170015f},
-std::array<float,2>{0.882122636f, 0.668958366f},
-std::array<float,2>{0.398205638f, 0.402430803f},
-std::array<float,2>{0.518717229f, 0.222327322f},
-std::array<float,2>{0.0334453806f, 0.828822553f},
-std::array<float,2>{0.722344637f, 0.975915968f},
-std::array<float,2>{0.175671488f, 0.084189117f},
-std::array<float,2>{0.797004342f, 0.357283562f},
-std::array<float,2>{0.360672206f, 0.619544387f},
-std::array<float,2>{0.918289244f, 0.81537509f},
-std::array<float,2>{0.424596041f, 0.244872808f},
-std::array<float,2>{0.536155105f, 0.381938577f},
-std::array<float,2>{0.00187893561f, 0.677944064f},
-std::array<float,2>{0.692134082f, 0.60899663f},
-std::array<float,2>{0.135476574f, 0.361128777f},
-std::array<float,2>{0.779931962f, 0.0743949339f},
-std::array<float,2>{0.326821089f, 0.999909043f},
-std::array<float,2>{0.842638373f, 0.737421751f},
-std::array<float,2>{0.261764735f, 0.479987144f},
-std::array<float,2>{0.634549201f, 0.187367752f},
-std::array<float,2>{0.19000943f, 0.755178928f},
-std::array<float,2>{0.584198892f, 0.882387936f},
-std::array<float,2>{0.124322578f, 0.0430144258f},
-std::array<float,2>{0.953813553f, 0.307911545f},
-std::array<float,2>{0.450759232f, 0.557104468f},
-std::array<float,2>{0.794751644f, 0.965853333f},
-std::array<float,2>{0.354130536f, 0.0988801122f},
-std::array<float,2>{0.747215271f, 0.333545357f},
-std::array<float,2>{0.161164746f, 0.575165153f},
-std::array<float,2>{0.511306465f, 0.626335919f},
-std::array<float,2>{0.0597465485f, 0.431052774f},
-std::array<float,2>{0.895452619f, 0.195431724f},
-std::array<float,2>{0.388721138f, 0.870638371f},
-std::array<float,2>{0.984832942f, 0.511031568f},
-std::array<float,2>{0.489799976f, 0.27487731f},
-std::array<float,2>{0.597011924f, 0.0174201652f},
-std::array<float,2>{0.0738274604f, 0.916644156f},
-std::array<float,2>{0.664594352f, 0.797069311f},
-std::array<float,2>{0.219627917f, 0.140634239f},
-std::array<float,2>{0.874613702f, 0.458097875f},
-std::array<float,2>{0.287651151f, 0.714886546f},
-std::array<float,2>{0.924548626f, 0.88866955f},
-std::array<float,2>{0.419681996f, 0.0389418788f},
-std::array<float,2>{0.557439685f, 0.301552802f},
-std::array<float,2>{0.0260860603f, 0.547014832f},
-std::array<float,2>{0.711188316f, 0.744476259f},
-std::array<float,2>{0.149696633f, 0.474452406f},
-std::array<float,2>{0.765229642f, 0.177941993f},
-std::array<float,2>{0.332851857f, 0.76183939f},
-std::array<float,2>{0.818233192f, 0.594900608f},
-std::array<float,2>{0.278321326f, 0.368771404f},
-std::array<float,2>{0.653574884f, 0.0646268874f},
-std::array<float,2>{0.212277263f, 0.98687309f},
-std::array<float,2>{0.575081468f, 0.826328099f},
-std::array<float,2>{0.103832141f, 0.237140477f},
-std::array<float,2>{0.945784628f, 0.390613049f},
-std::array<float,2>{0.45531261f, 0.680626929f},
-std::array<float,2>{0.802504718f, 0.809051931f},
-std::array<float,2>{0.366768926f, 0.153611854f},
-std::array<float,2>{0.726158202f, 0.461996883f},
-std::array<float,2>{0.176416576f, 0.710084796f},
-std::array<float,2>{0.520302117f, 0.505823553f},
-std::array<float,2>{0.0363482647f, 0.267115951f},
-std::array<float,2>{0.877534807f, 0.0281310342f},
-std::array<float,2>{0.391743332f, 0.907244682f},
-std::array<float,2>{0.978293598f, 0.632833242f},
-std::array<float,2>{0.469709605f, 0.426830888f},
-std::array<float,2>{0.616851568f, 0.195181102f},
-std::array<float,2>{0.0843437016f, 0.859765887f},
-std::array<float,2>{0.675799906f, 0.959384143f},
-std::array<float,2>{0.23572126f, 0.105916873f},
-std::array<float,2>{0.849855781f, 0.340909094f},
-std::array<float,2>{0.301581502f, 0.5625422f},
-std::array<float,2>{0.959920466f, 0.850927591f},
-std::array<float,2>{0.448354989f, 0.203680232f},
-std::array<float,2>{0.579521179f, 0.415527225f},
-std::array<float,2>{0.117913693f, 0.646861732f},
-std::array<float,2>{0.640379965f, 0.584238648f},
-std::array<float,2>{0.19498226f, 0.32308355f},
-std::array<float,2>{0.837923169f, 0.121231429f},
-std::array<float,2>{0.258590609f, 0.952245355f},
-std::array<float,2>{0.774463654f, 0.688078046f},
-std::array<float,2>{0.322176367f, 0.444298565f},
-std::array<float,2>{0.690894544f, 0.130886689f},
-std::array<float,2>{0.139010027f, 0.784477055f},
-std::array<float,2>{0.534116328f, 0.928318262f},
-std::array<float,2>{0.00484588835f, 0.00893344916f},
-std::array<float,2>{0.91722393f, 0.255623519f},
-std::array<float,2>{0.428035498f, 0.522839189f},
-std::array<float,2>{0.869512081f, 0.978543043f},
-std::array<float,2>{0.283647001f, 0.090890415f},
-std::array<float,2>{0.66815871f, 0.348986685f},
-std::array<float,2>{0.225125253f, 0.61119324f},
-std::array<float,2>{0.600517333f, 0.66274184f},
-std::array<float,2>{0.075822182f, 0.391664833f},
-std::array<float,2>{0.991295934f, 0.229709476f},
-std::array<float,2>{0.487412065f, 0.841644585f},
-std::array<float,2>{0.893231928f, 0.532846272f},
-std::array<float,2>{0.385267854f, 0.288559228f},
-std::array<float,2>{0.514944077f, 0.0595060661f},
-std::array<float,2>{0.0567375012f, 0.897993803f},
-std::array<float,2>{0.742507577f, 0.771428764f},
-std::array<float,2>{0.159818858f, 0.159821436f},
-std::array<float,2>{0.791249335f, 0.484606445f},
-std::array<float,2>{0.35814923f, 0.732585669f},
-std::array<float,2>{0.997094393f, 0.937982857f},
-std::array<float,2>{0.498375833f, 0.115768597f},
-std::array<float,2>{0.60661602f, 0.31811282f},
-std::array<float,2>{0.0688401163f, 0.587902784f},
-std::array<float,2>{0.658710182f, 0.653490663f},
-std::array<float,2>{0.227770165f, 0.408600658f},
-std::array<float,2>{0.863391697f, 0.217706844f},
-std::array<float,2>{0.294262171f, 0.858177364f},
-std::array<float,2>{0.781728923f, 0.523859501f},
-std::array<float,2>{0.349093556f, 0.260430813f},
-std::array<float,2>{0.739417315f, 0.00561929913f},
-std::array<float,2>{0.170924813f, 0.935558259f},
-std::array<float,2>{0.507034242f, 0.792745709f},
-std::array<float,2>{0.0490844026f, 0.136252403f},
-std::array<float,2>{0.90615195f, 0.450373739f},
-std::array<float,2>{0.377394587f, 0.69611603f},
-std::array<float,2>{0.830096364f, 0.834264278f},
-std::array<float,2>{0.25585258f, 0.224222437f},
-std::array<float,2>{0.632003069f, 0.401088446f},
-std::array<float,2>{0.200173095f, 0.666185617f},
-std::array<float,2>{0.591424167f, 0.623895764f},
-std::array<float,2>{0.109593078f, 0.353124052f},
-std::array<float,2>{0.968685925f, 0.0818243474f},
-std::array<float,2>{0.439076275f, 0.969173849f},
-std::array<float,2>{0.910971761f, 0.723030448f},
-std::array<float,2>{0.433732212f, 0.497608721f},
-std::array<float,2>{0.546235979f, 0.17060867f},
-std::array<float,2>{0.0102936011f, 0.777953863f},
-std::array<float,2>{0.70009917f, 0.904555619f},
-std::array<float,2>{0.131957561f, 0.04970745f},
-std::array<float,2>{0.772502661f, 0.293946505f},
-std::array<float,2>{0.319501102f, 0.544704318f},
-std::array<float,2>{0.889489591f, 0.751844406f},
-std::array<float,2>{0.404820889f, 0.182045862f},
-std::array<float,2>{0.527553856f, 0.484274477f},
-std::array<float,2>{0.0413268358f, 0.739644527f},
-std::array<float,2>{0.733623803f, 0.559271634f},
-std::array<float,2>{0.183676958f, 0.309086889f},
-std::array<float,2>{0.807183027f, 0.0400267243f},
-std::array<float,2>{0.36975804f, 0.87519908f},
-std::array<float,2>{0.856548309f, 0.675208986f},
-std::array<float,2>{0.306825995f, 0.378704458f},
-std::array<float,2>{0.683141947f, 0.248108581f},
-std::array<float,2>{0.243640378f, 0.816969633f},
-std::array<float,2>{0.62375468f, 0.992564321f},
-std::array<float,2>{0.0872355625f, 0.0738061965f},
-std::array<float,2>{0.974945188f, 0.363673091f},
-std::array<float,2>{0.480203897f, 0.603417516f},
-std::array<float,2>{0.750435174f, 0.920121372f},
-std::array<float,2>{0.338239849f, 0.0228279177f},
-std::array<float,2>{0.706537306f, 0.280484736f},
-std::array<float,2>{0.148248494f, 0.512296736f},
-std::array<float,2>{0.549305916f, 0.714636266f},
-std::array<float,2>{0.0164772775f, 0.456888527f},
-std::array<float,2>{0.932614088f, 0.145848259f},
-std::array<float,2>{0.410897464f, 0.800835609f},
-std::array<float,2>{0.938095093f, 0.572176278f},
-std::array<float,2>{0.464963317f, 0.331596375f},
-std::array<float,2>{0.567006409f, 0.0962868631f},
-std::array<float,2>{0.101157375f, 0.963055909f},
-std::array<float,2>{0.644600749f, 0.872860551f},
-std::array<float,2>{0.209423944f, 0.200928941f},
-std::array<float,2>{0.82309103f, 0.435139447f},
-std::array<float,2>{0.26758942f, 0.632404566f},
-std::array<float,2>{0.934496522f, 0.981863201f},
-std::array<float,2>{0.40809378f, 0.0887225792f},
-std::array<float,2>{0.55459404f, 0.344483405f},
-std::array<float,2>{0.0226284228f, 0.614577651f},
-std::array<float,2>{0.709060371f, 0.657918572f},
-std::array<float,2>{0.144381434f, 0.395767927f},
-std::array<float,2>{0.756395578f, 0.233020455f},
-std::array<float,2>{0.342789769f, 0.839792788f},
-std::array<float,2>{0.827462316f, 0.536216259f},
-std::array<float,2>{0.271583945f, 0.284107178f},
-std::array<float,2>{0.641234219f, 0.0579777174f},
-std::array<float,2>{0.206866279f, 0.894292653f},
-std::array<float,2>{0.562693417f, 0.767862439f},
-std::array<float,2>{0.0945570096f, 0.164062455f},
-std::array<float,2>{0.942181528f, 0.491561055f},
-std::array<float,2>{0.464061826f, 0.727255166f},
-std::array<float,2>{0.810416758f, 0.846905351f},
-std::array<float,2>{0.373867601f, 0.2108417f},
-std::array<float,2>{0.7278108f, 0.420561045f},
-std::array<float,2>{0.18112047f, 0.640898764f},
-std::array<float,2>{0.526044667f, 0.580750465f},
-std::array<float,2>{0.0446176305f, 0.324538887f},
-std::array<float,2>{0.88289392f, 0.119799592f},
-std::array<float,2>{0.400401801f, 0.947424591f},
-std::array<float,2>{0.969834447f, 0.69410038f},
-std::array<float,2>{0.483371198f, 0.439732134f},
-std::array<float,2>{0.619794548f, 0.126222849f},
-std::array<float,2>{0.0917482823f, 0.787220478f},
-std::array<float,2>{0.687227905f, 0.923299372f},
-std::array<float,2>{0.249072284f, 0.0136309816f},
-std::array<float,2>{0.854028642f, 0.253750235f},
-std::array<float,2>{0.309494585f, 0.519035101f},
-std::array<float,2>{0.962671518f, 0.808023036f},
-std::array<float,2>{0.444076747f, 0.150839031f},
-std::array<float,2>{0.589145303f, 0.465293586f},
-std::array<float,2>{0.115499578f, 0.704592824f},
-std::array<float,2>{0.628017724f, 0.503132999f},
-std::array<float,2>{0.198482305f, 0.272730082f},
-std::array<float,2>{0.834689856f, 0.0243287198f},
-std::array<float,2>{0.250238091f, 0.910632908f},
-std::array<float,2>{0.766577542f, 0.636995614f},
-std::array<float,2>{0.312516898f, 0.4257707f},
-std::array<float,2>{0.697689831f, 0.188014299f},
-std::array<float,2>{0.125224859f, 0.864427686f},
-std::array<float,2>{0.541956663f, 0.9569363f},
-std::array<float,2>{0.0127198193f, 0.103518501f},
-std::array<float,2>{0.906753838f, 0.337738723f},
-std::array<float,2>{0.433412969f, 0.567412794f},
-std::array<float,2>{0.862554371f, 0.885614634f},
-std::array<float,2>{0.291657835f, 0.0330320895f},
-std::array<float,2>{0.662880242f, 0.297797263f},
-std::array<float,2>{0.231559172f, 0.551680923f},
-std::array<float,2>{0.603179336f, 0.748421431f},
-std::array<float,2>{0.0641316921f, 0.471566439f},
-std::array<float,2>{0.995470524f, 0.172535479f},
-std::array<float,2>{0.493637592f, 0.759165764f},
-std::array<float,2>{0.898701847f, 0.598144889f},
-std::array<float,2>{0.379682988f, 0.371332705f},
-std::array<float,2>{0.500383973f, 0.067042172f},
-std::array<float,2>{0.0529105663f, 0.99133873f},
-std::array<float,2>{0.737898648f, 0.822558284f},
-std::array<float,2>{0.167726502f, 0.238531694f},
-std::array<float,2>{0.785954773f, 0.383444786f},
-std::array<float,2>{0.345332474f, 0.686443031f},
-std::array<float,2>{0.987467408f, 0.917171419f},
-std::array<float,2>{0.491306633f, 0.0165819172f},
-std::array<float,2>{0.593882918f, 0.274372965f},
-std::array<float,2>{0.0711469054f, 0.50979948f},
-std::array<float,2>{0.66623795f, 0.716028631f},
-std::array<float,2>{0.222601667f, 0.457284361f},
-std::array<float,2>{0.871162176f, 0.142166108f},
-std::array<float,2>{0.286274552f, 0.798627377f},
-std::array<float,2>{0.796683073f, 0.575643659f},
-std::array<float,2>{0.352913558f, 0.332350224f},
-std::array<float,2>{0.749075592f, 0.0983956456f},
-std::array<float,2>{0.162334949f, 0.965742111f},
-std::array<float,2>{0.508695304f, 0.86968416f},
-std::array<float,2>{0.0623890571f, 0.196872905f},
-std::array<float,2>{0.898239434f, 0.430555075f},
-std::array<float,2>{0.388359785f, 0.625289977f},
-std::array<float,2>{0.841095448f, 0.754441977f},
-std::array<float,2>{0.264603287f, 0.186091319f},
-std::array<float,2>{0.634790957f, 0.478796244f},
-std::array<float,2>{0.187721536f, 0.737103641f},
-std::array<float,2>{0.582606494f, 0.557836354f},
-std::array<float,2>{0.121656783f, 0.307359934f},
-std::array<float,2>{0.95567441f, 0.0447978973f},
-std::array<float,2>{0.45255968f, 0.881022215f},
-std::array<float,2>{0.920195818f, 0.678769171f},
-std::array<float,2>{0.42373848f, 0.380957901f},
-std::array<float,2>{0.538416386f, 0.245176733f},
-std::array<float,2>{0.00348160043f, 0.81608367f},
-std::array<float,2>{0.693782628f, 0.998502016f},
-std::array<float,2>{0.133058742f, 0.075251177f},
-std::array<float,2>{0.778610051f, 0.359871864f},
-std::array<float,2>{0.325223565f, 0.607653081f},
-std::array<float,2>{0.879202068f, 0.82999146f},
-std::array<float,2>{0.39626652f, 0.221658275f},
-std::array<float,2>{0.516755342f, 0.403383255f},
-std::array<float,2>{0.0312828422f, 0.668329358f},
-std::array<float,2>{0.720243633f, 0.620735347f},
-std::array<float,2>{0.172163039f, 0.355927587f},
-std::array<float,2>{0.800390542f, 0.0853867605f},
-std::array<float,2>{0.362075418f, 0.975037575f},
-std::array<float,2>{0.845579922f, 0.71899277f},
-std::array<float,2>{0.298963696f, 0.493257731f},
-std::array<float,2>{0.675681055f, 0.167464331f},
-std::array<float,2>{0.239105344f, 0.775364757f},
-std::array<float,2>{0.613093495f, 0.901498079f},
-std::array<float,2>{0.0785217211f, 0.0536978655f},
-std::array<float,2>{0.980674744f, 0.29180339f},
-std::array<float,2>{0.473730206f, 0.542682946f},
-std::array<float,2>{0.758052826f, 0.943108618f},
-std::array<float,2>{0.329937279f, 0.112218559f},
-std::array<float,2>{0.717558861f, 0.314663768f},
-std::array<float,2>{0.154902548f, 0.593044102f},
-std::array<float,2>{0.55866909f, 0.650503933f},
-std::array<float,2>{0.0291980579f, 0.410217255f},
-std::array<float,2>{0.928835094f, 0.214776799f},
-std::array<float,2>{0.415917665f, 0.854400039f},
-std::array<float,2>{0.950780213f, 0.530665278f},
-std::array<float,2>{0.459762782f, 0.26463598f},
-std::array<float,2>{0.570778012f, 0.00228672079f},
-std::array<float,2>{0.108119696f, 0.933505237f},
-std::array<float,2>{0.649567008f, 0.794433832f},
-std::array<float,2>{0.21501191f, 0.137128308f},
-std::array<float,2>{0.815318704f, 0.447395027f},
-std::array<float,2>{0.276335597f, 0.701678813f},
-std::array<float,2>{0.890670538f, 0.896594524f},
-std::array<float,2>{0.383517802f, 0.0600654557f},
-std::array<float,2>{0.513071001f, 0.287184566f},
-std::array<float,2>{0.056161359f, 0.531536818f},
-std::array<float,2>{0.744560003f, 0.733652115f},
-std::array<float,2>{0.157899991f, 0.485835195f},
-std::array<float,2>{0.789200842f, 0.158829868f},
-std::array<float,2>{0.355881006f, 0.769634724f},
-std::array<float,2>{0.867747664f, 0.609954059f},
-std::array<float,2>{0.282215029f, 0.348150313f},
-std::array<float,2>{0.670277119f, 0.0903581977f},
-std::array<float,2>{0.223088354f, 0.979726136f},
-std::array<float,2>{0.598862112f, 0.839901626f},
-std::array<float,2>{0.0770678669f, 0.228647187f},
-std::array<float,2>{0.988807976f, 0.391358912f},
-std::array<float,2>{0.485916704f, 0.663272798f},
-std::array<float,2>{0.777009547f, 0.783593655f},
-std::array<float,2>{0.323679447f, 0.13216038f},
-std::array<float,2>{0.689272225f, 0.444570035f},
-std::array<float,2>{0.138566375f, 0.688894451f},
-std::array<float,2>{0.532544672f, 0.521848202f},
-std::array<float,2>{0.00740104308f, 0.254495233f},
-std::array<float,2>{0.915704727f, 0.00797786471f},
-std::array<float,2>{0.426635474f, 0.92914474f},
-std::array<float,2>{0.958675802f, 0.648091435f},
-std::array<float,2>{0.447205275f, 0.414628625f},
-std::array<float,2>{0.581085205f, 0.204240963f},
-std::array<float,2>{0.120966882f, 0.849618256f},
-std::array<float,2>{0.637286425f, 0.951553881f},
-std::array<float,2>{0.192790121f, 0.122931242f},
-std::array<float,2>{0.836066306f, 0.323768198f},
-std::array<float,2>{0.260303348f, 0.58570528f},
-std::array<float,2>{0.979736388f, 0.861116648f},
-std::array<float,2>{0.471727222f, 0.193363518f},
-std::array<float,2>{0.613591552f, 0.426304758f},
-std::array<float,2>{0.0834186748f, 0.634310067f},
-std::array<float,2>{0.6786291f, 0.563531697f},
-std::array<float,2>{0.236568257f, 0.340233117f},
-std::array<float,2>{0.848606169f, 0.106546178f},
-std::array<float,2>{0.303124696f, 0.960797846f},
-std::array<float,2>{0.803824604f, 0.709200919f},
-std::array<float,2>{0.363921434f, 0.461669356f},
-std::array<float,2>{0.723213851f, 0.15284048f},
-std::array<float,2>{0.179403409f, 0.810154378f},
-std::array<float,2>{0.522423148f, 0.906807244f},
-std::array<float,2>{0.0388243906f, 0.0283564031f},
-std::array<float,2>{0.876661479f, 0.265865386f},
-std::array<float,2>{0.394298673f, 0.504145861f},
-std::array<float,2>{0.818639755f, 0.987401068f},
-std::array<float,2>{0.281035662f, 0.0658710077f},
-std::array<float,2>{0.654485643f, 0.367271334f},
-std::array<float,2>{0.213807553f, 0.594717145f},
-std::array<float,2>{0.577614129f, 0.681496084f},
-std::array<float,2>{0.102610037f, 0.38868162f},
-std::array<float,2>{0.947885573f, 0.237468332f},
-std::array<float,2>{0.454118222f, 0.827392101f},
-std::array<float,2>{0.922313511f, 0.548158705f},
-std::array<float,2>{0.420735925f, 0.30231902f},
-std::array<float,2>{0.555093884f, 0.0377860516f},
-std::array<float,2>{0.0237786435f, 0.88765043f},
-std::array<float,2>{0.71383965f, 0.763195634f},
-std::array<float,2>{0.150600314f, 0.179215834f},
-std::array<float,2>{0.762075424f, 0.47313714f},
-std::array<float,2>{0.334255636f, 0.746026456f},
-std::array<float,2>{0.940530658f, 0.964842081f},
-std::array<float,2>{0.468123436f, 0.0976430699f},
-std::array<float,2>{0.56839329f, 0.330177397f},
-std::array<float,2>{0.0994938165f, 0.570654511f},
-std::array<float,2>{0.64785254f, 0.631119728f},
-std::array<float,2>{0.207735673f, 0.43427071f},
-std::array<float,2>{0.82174319f, 0.199592412f},
-std::array<float,2>{0.267017365f, 0.871279776f},
-std::array<float,2>{0.753455102f, 0.512839198f},
-std::array<float,2>{0.337019235f, 0.279430717f},
-std::array<float,2>{0.704327822f, 0.0221037585f},
-std::array<float,2>{0.146380916f, 0.921448648f},
-std::array<float,2>{0.548180342f, 0.802155256f},
-std::array<float,2>{0.0195053518f, 0.144844174f},
-std::array<float,2>{0.930945694f, 0.455601126f},
-std::array<float,2>{0.412345886f, 0.71382463f},
-std::array<float,2>{0.858029842f, 0.817634761f},
-std::array<float,2>{0.305561304f, 0.249072239f},
-std::array<float,2>{0.680911958f, 0.377287924f},
-std::array<float,2>{0.244647786f, 0.674138725f},
-std::array<float,2>{0.621868014f, 0.602535963f},
-std::array<float,2>{0.0885337517f, 0.364451975f},
-std::array<float,2>{0.97404325f, 0.0726827979f},
-std::array<float,2>{0.477806658f, 0.993492246f},
-std::array<float,2>{0.887141407f, 0.73854363f},
-std::array<float,2>{0.404291898f, 0.482830703f},
-std::array<float,2>{0.529431581f, 0.182914674f},
-std::array<float,2>{0.0397945307f, 0.750539899f},
-std::array<float,2>{0.732115388f, 0.876868725f},
-std::array<float,2>{0.186275244f, 0.0401394144f},
-std::array<float,2>{0.804786265f, 0.310102195f},
-std::array<float,2>{0.367889911f, 0.560404837f},
-std::array<float,2>{0.91226238f, 0.779038191f},
-std::array<float,2>{0.436161458f, 0.17116639f},
-std::array<float,2>{0.544670224f, 0.496167779f},
-std::array<float,2>{0.00878727157f, 0.724068344f},
-std::array<float,2>{0.70209074f, 0.543774366f},
-std::array<float,2>{0.130795017f, 0.29364717f},
-std::array<float,2>{0.770524323f, 0.0504442453f},
-std::array<float,2>{0.316839695f, 0.905410647f},
-std::array<float,2>{0.82938844f, 0.667024434f},
-std::array<float,2>{0.256138891f, 0.401924133f},
-std::array<float,2>{0.629360199f, 0.223325059f},
-std::array<float,2>{0.201300591f, 0.834968865f},
-std::array<float,2>{0.593706608f, 0.970590293f},
-std::array<float,2>{0.112734042f, 0.0803408325f},
-std::array<float,2>{0.965891838f, 0.351859659f},
-std::array<float,2>{0.440707028f, 0.624399483f},
-std::array<float,2>{0.784017265f, 0.936758995f},
-std::array<float,2>{0.349815786f, 0.00409126468f},
-std::array<float,2>{0.740875542f, 0.261068106f},
-std::array<float,2>{0.169098377f, 0.524599552f},
-std::array<float,2>{0.504000664f, 0.69709748f},
-std::array<float,2>{0.0480240583f, 0.449694633f},
-std::array<float,2>{0.903652966f, 0.135597438f},
-std::array<float,2>{0.37569049f, 0.791125715f},
-std::array<float,2>{0.998384714f, 0.58923012f},
-std::array<float,2>{0.497804463f, 0.316458642f},
-std::array<float,2>{0.60885042f, 0.116972052f},
-std::array<float,2>{0.0666941702f, 0.93900913f},
-std::array<float,2>{0.65768075f, 0.858548939f},
-std::array<float,2>{0.228863955f, 0.218253523f},
-std::array<float,2>{0.866556406f, 0.409270823f},
-std::array<float,2>{0.296025276f, 0.653166652f},
-std::array<float,2>{0.886538327f, 0.946854711f},
-std::array<float,2>{0.399301171f, 0.117949232f},
-std::array<float,2>{0.524686992f, 0.327958614f},
-std::array<float,2>{0.0454451628f, 0.580016673f},
-std::array<float,2>{0.729204297f, 0.643534303f},
-std::array<float,2>{0.182120264f, 0.418247372f},
-std::array<float,2>{0.811726809f, 0.207257435f},
-std::array<float,2>{0.371310085f, 0.843954206f},
-std::array<float,2>{0.851712167f, 0.517255485f},
-std::array<float,2>{0.311218888f, 0.250879854f},
-std::array<float,2>{0.685393393f, 0.0149885425f},
-std::array<float,2>{0.246427625f, 0.924648345f},
-std::array<float,2>{0.618623197f, 0.7858482f},
-std::array<float,2>{0.0918902829f, 0.127626762f},
-std::array<float,2>{0.971885145f, 0.438899279f},
-std::array<float,2>{0.480817884f, 0.692641497f},
-std::array<float,2>{0.753914118f, 0.836495101f},
-std::array<float,2>{0.341734856f, 0.231759727f},
-std::array<float,2>{0.707046926f, 0.396587998f},
-std::array<float,2>{0.14189072f, 0.659763038f},
-std::array<float,2>{0.551318288f, 0.615679562f},
-std::array<float,2>{0.0214578453f, 0.346979529f},
-std::array<float,2>{0.935940146f, 0.0876045451f},
-std::array<float,2>{0.408273369f, 0.983262062f},
-std::array<float,2>{0.945067346f, 0.729714274f},
-std::array<float,2>{0.46276468f, 0.490083814f},
-std::array<float,2>{0.56598264f, 0.160509974f},
-std::array<float,2>{0.0967128649f, 0.766739368f},
-std::array<float,2>{0.643835366f, 0.891173184f},
-std::array<float,2>{0.203162313f, 0.0550272875f},
-std::array<float,2>{0.824671149f, 0.282210261f},
-std::array<float,2>{0.269803524f, 0.53790307f},
-std::array<float,2>{0.993465126f, 0.761598945f},
-std::array<float,2>{0.494603813f, 0.175560892f},
-std::array<float,2>{0.60479039f, 0.470576704f},
-std::array<float,2>{0.0646831021f, 0.746680915f},
-std::array<float,2>{0.661354721f, 0.553749621f},
-std::array<float,2>{0.2324301f, 0.300678909f},
-std::array<float,2>{0.861152947f, 0.033277072f},
-std::array<float,2>{0.290839642f, 0.883460224f},
-std::array<float,2>{0.788976789f, 0.684379518f},
-std::array<float,2>{0.347065181f, 0.385511577f},
-std::array<float,2>{0.73617059f, 0.241139889f},
-std::array<float,2>{0.16489017f, 0.821579695f},
-std::array<float,2>{0.50261271f, 0.989094675f},
-std::array<float,2>{0.0521027707f, 0.0695762113f},
-std::array<float,2>{0.902278781f, 0.373425603f},
-std::array<float,2>{0.381732166f, 0.600569129f},
-std::array<float,2>{0.832508624f, 0.912826598f},
-std::array<float,2>{0.252532184f, 0.0270114597f},
-std::array<float,2>{0.625268161f, 0.270379812f},
-std::array<float,2>{0.195886716f, 0.501816094f},
-std::array<float,2>{0.586131632f, 0.706999481f},
-std::array<float,2>{0.115215339f, 0.468705177f},
-std::array<float,2>{0.963457823f, 0.150369108f},
-std::array<float,2>{0.44223541f, 0.805534065f},
-std::array<float,2>{0.908554077f, 0.570252538f},
-std::array<float,2>{0.430431753f, 0.338262916f},
-std::array<float,2>{0.540139019f, 0.102133632f},
-std::array<float,2>{0.0149971778f, 0.953369617f},
-std::array<float,2>{0.696746111f, 0.865410686f},
-std::array<float,2>{0.128114387f, 0.19036369f},
-std::array<float,2>{0.767589092f, 0.423826903f},
-std::array<float,2>{0.315072179f, 0.638897657f},
-std::array<float,2>{0.954587102f, 0.8791821f},
-std::array<float,2>{0.449657887f, 0.0466186292f},
-std::array<float,2>{0.585244298f, 0.306455731f},
-std::array<float,2>{0.123674184f, 0.555316448f},
-std::array<float,2>{0.633255899f, 0.734952807f},
-std::array<float,2>{0.191092938f, 0.47689712f},
-std::array<float,2>{0.84323734f, 0.185088068f},
-std::array<float,2>{0.263555348f, 0.757657588f},
-std::array<float,2>{0.780854344f, 0.607260704f},
-std::array<float,2>{0.327582031f, 0.361618221f},
-std::array<float,2>{0.693065166f, 0.0780279338f},
-std::array<float,2>{0.136221871f, 0.997018874f},
-std::array<float,2>{0.536094189f, 0.814400792f},
-std::array<float,2>{0.00092148059f, 0.243803158f},
-std::array<float,2>{0.919286668f, 0.380857855f},
-std::array<float,2>{0.424873799f, 0.677247465f},
-std::array<float,2>{0.873679936f, 0.798888624f},
-std::array<float,2>{0.288476288f, 0.143234447f},
-std::array<float,2>{0.665077507f, 0.459657133f},
-std::array<float,2>{0.22006239f, 0.718203187f},
-std::array<float,2>{0.59582293f, 0.508712828f},
-std::array<float,2>{0.0727505609f, 0.276601702f},
-std::array<float,2>{0.986305594f, 0.0194451585f},
-std::array<float,2>{0.488687485f, 0.915413857f},
-std::array<float,2>{0.895678639f, 0.627349555f},
-std::array<float,2>{0.390211821f, 0.431652218f},
-std::array<float,2>{0.510353744f, 0.198272318f},
-std::array<float,2>{0.0587986112f, 0.867297828f},
-std::array<float,2>{0.74611336f, 0.966930211f},
-std::array<float,2>{0.16069153f, 0.101297453f},
-std::array<float,2>{0.793241262f, 0.33492288f},
-std::array<float,2>{0.355047613f, 0.576427639f},
-std::array<float,2>{0.927599072f, 0.853132248f},
-std::array<float,2>{0.41771704f, 0.212467924f},
-std::array<float,2>{0.562229455f, 0.413085192f},
-std::array<float,2>{0.0297440868f, 0.649049044f},
-std::array<float,2>{0.716566682f, 0.591158569f},
-std::array<float,2>{0.152770296f, 0.313627303f},
-std::array<float,2>{0.760443807f, 0.109769084f},
-std::array<float,2>{0.33195889f, 0.944342911f},
-std::array<float,2>{0.813646197f, 0.699752033f},
-std::array<float,2>{0.274106175f, 0.447040528f},
-std::array<float,2>{0.651985705f, 0.139524192f},
-std::array<float,2>{0.217134222f, 0.795360208f},
-std::array<float,2>{0.572352231f, 0.930024207f},
-std::array<float,2>{0.105542101f, 0.0016405246f},
-std::array<float,2>{0.953111947f, 0.261793107f},
-std::array<float,2>{0.457837075f, 0.527567387f},
-std::array<float,2>{0.798676908f, 0.973064899f},
-std::array<float,2>{0.360112637f, 0.0837908015f},
-std::array<float,2>{0.721350312f, 0.358972907f},
-std::array<float,2>{0.174449429f, 0.617217481f},
-std::array<float,2>{0.518073022f, 0.670402408f},
-std::array<float,2>{0.0348243937f, 0.404507339f},
-std::array<float,2>{0.881599486f, 0.220203772f},
-std::array<float,2>{0.397334695f, 0.831157982f},
-std::array<float,2>{0.983012378f, 0.539834797f},
-std::array<float,2>{0.475333512f, 0.290914357f},
-std::array<float,2>{0.609712839f, 0.0519169308f},
-std::array<float,2>{0.0806255564f, 0.899893105f},
-std::array<float,2>{0.673134744f, 0.776409805f},
-std::array<float,2>{0.240843818f, 0.16409421f},
-std::array<float,2>{0.847188294f, 0.495361537f},
-std::array<float,2>{0.297789574f, 0.720713437f},
-std::array<float,2>{0.916969717f, 0.927539706f},
-std::array<float,2>{0.429320216f, 0.0113363722f},
-std::array<float,2>{0.534399807f, 0.257029563f},
-std::array<float,2>{0.00507477112f, 0.520099521f},
-std::array<float,2>{0.6903404f, 0.69000715f},
-std::array<float,2>{0.13974081f, 0.441978693f},
-std::array<float,2>{0.773932576f, 0.130273655f},
-std::array<float,2>{0.321230173f, 0.782787561f},
-std::array<float,2>{0.83962667f, 0.583336473f},
-std::array<float,2>{0.2592659f, 0.322168618f},
-std::array<float,2>{0.639085948f, 0.123060659f},
-std::array<float,2>{0.193587676f, 0.949341476f},
-std::array<float,2>{0.57834518f, 0.848419428f},
-std::array<float,2>{0.118210874f, 0.20646508f},
-std::array<float,2>{0.960844457f, 0.417793244f},
-std::array<float,2>{0.447790921f, 0.6462484f},
-std::array<float,2>{0.792438388f, 0.773154616f},
-std::array<float,2>{0.358913809f, 0.157954171f},
-std::array<float,2>{0.743938446f, 0.486478955f},
-std::array<float,2>{0.158399209f, 0.731357813f},
-std::array<float,2>{0.514468789f, 0.534769773f},
-std::array<float,2>{0.0579024404f, 0.285450906f},
-std::array<float,2>{0.894408166f, 0.0608587079f},
-std::array<float,2>{0.386283189f, 0.89575392f},
-std::array<float,2>{0.99037379f, 0.660427809f},
-std::array<float,2>{0.487069786f, 0.393349141f},
-std::array<float,2>{0.600586593f, 0.22783798f},
-std::array<float,2>{0.0747021958f, 0.842258811f},
-std::array<float,2>{0.669374943f, 0.978003263f},
-std::array<float,2>{0.225666821f, 0.0921867415f},
-std::array<float,2>{0.870424151f, 0.350289702f},
-std::array<float,2>{0.284554482f, 0.61149013f},
-std::array<float,2>{0.946384847f, 0.826094151f},
-std::array<float,2>{0.456956536f, 0.234910026f},
-std::array<float,2>{0.575663626f, 0.388624072f},
-std::array<float,2>{0.105252832f, 0.681869447f},
-std::array<float,2>{0.652877688f, 0.596479535f},
-std::array<float,2>{0.211699218f, 0.370848984f},
-std::array<float,2>{0.816439271f, 0.0635698438f},
-std::array<float,2>{0.277595997f, 0.985868931f},
-std::array<float,2>{0.764272809f, 0.742916584f},
-std::array<float,2>{0.333013445f, 0.47549057f},
-std::array<float,2>{0.712882161f, 0.176535353f},
-std::array<float,2>{0.148603961f, 0.765233219f},
-std::array<float,2>{0.557823122f, 0.890377223f},
-std::array<float,2>{0.027133571f, 0.035731934f},
-std::array<float,2>{0.925737798f, 0.304459602f},
-std::array<float,2>{0.418847829f, 0.549075544f},
-std::array<float,2>{0.851352155f, 0.957662821f},
-std::array<float,2>{0.302632213f, 0.109287679f},
-std::array<float,2>{0.677024245f, 0.341921002f},
-std::array<float,2>{0.234788567f, 0.564664423f},
-std::array<float,2>{0.615706146f, 0.636418641f},
-std::array<float,2>{0.085884206f, 0.428653926f},
-std::array<float,2>{0.977395952f, 0.192372814f},
-std::array<float,2>{0.470037371f, 0.862724006f},
-std::array<float,2>{0.878687561f, 0.507043064f},
-std::array<float,2>{0.390663266f, 0.26834181f},
-std::array<float,2>{0.520685494f, 0.0307751894f},
-std::array<float,2>{0.035782557f, 0.909534633f},
-std::array<float,2>{0.725126565f, 0.811018527f},
-std::array<float,2>{0.17750746f, 0.154302821f},
-std::array<float,2>{0.801582813f, 0.464399964f},
-std::array<float,2>{0.365934432f, 0.707726896f},
-std::array<float,2>{0.976456225f, 0.994791031f},
-std::array<float,2>{0.479213834f, 0.0712121353f},
-std::array<float,2>{0.624246001f, 0.366131067f},
-std::array<float,2>{0.0866527259f, 0.604582071f},
-std::array<float,2>{0.681977808f, 0.673276603f},
-std::array<float,2>{0.242651224f, 0.375288785f},
-std::array<float,2>{0.855787694f, 0.247539133f},
-std::array<float,2>{0.308490783f, 0.819241941f},
-std::array<float,2>{0.8079952f, 0.561258614f},
-std::array<float,2>{0.370424539f, 0.310667664f},
-std::array<float,2>{0.732752323f, 0.0421202667f},
-std::array<float,2>{0.185129046f, 0.878811061f},
-std::array<float,2>{0.528387368f, 0.752426386f},
-std::array<float,2>{0.0421502665f, 0.180263862f},
-std::array<float,2>{0.890417516f, 0.48130548f},
-std::array<float,2>{0.405884415f, 0.741750658f},
-std::array<float,2>{0.823674142f, 0.873516142f},
-std::array<float,2>{0.268623471f, 0.202187255f},
-std::array<float,2>{0.64607048f, 0.437045455f},
-std::array<float,2>{0.210404351f, 0.630306065f},
-std::array<float,2>{0.568103731f, 0.572568119f},
-std::array<float,2>{0.099826403f, 0.328336596f},
-std::array<float,2>{0.939214051f, 0.0942244828f},
-std::array<float,2>{0.466516107f, 0.961552143f},
-std::array<float,2>{0.932878494f, 0.712660074f},
-std::array<float,2>{0.411986053f, 0.454308987f},
-std::array<float,2>{0.550748825f, 0.146533534f},
-std::array<float,2>{0.0171534624f, 0.803783894f},
-std::array<float,2>{0.705102623f, 0.918260157f},
-std::array<float,2>{0.147028014f, 0.0205112323f},
-std::array<float,2>{0.751653492f, 0.278835475f},
-std::array<float,2>{0.33948648f, 0.515168309f},
-std::array<float,2>{0.90517956f, 0.790073752f},
-std::array<float,2>{0.378685385f, 0.133116722f},
-std::array<float,2>{0.506027579f, 0.452796966f},
-std::array<float,2>{0.0504417904f, 0.69763428f},
-std::array<float,2>{0.738668621f, 0.52694267f},
-std::array<float,2>{0.170868829f, 0.258487076f},
-std::array<float,2>{0.782738566f, 0.00763010746f},
-std::array<float,2>{0.347780436f, 0.935331702f},
-std::array<float,2>{0.864693165f, 0.654603899f},
-std::array<float,2>{0.293919265f, 0.408146054f},
-std::array<float,2>{0.659693241f, 0.216672912f},
-std::array<float,2>{0.22696732f, 0.856589854f},
-std::array<float,2>{0.605804384f, 0.940861881f},
-std::array<float,2>{0.0703024045f, 0.114663623f},
-std::array<float,2>{0.996545255f, 0.319311917f},
-std::array<float,2>{0.499959111f, 0.587708831f},
-std::array<float,2>{0.772185862f, 0.90360266f},
-std::array<float,2>{0.318629354f, 0.047065679f},
-std::array<float,2>{0.700250506f, 0.295817554f},
-std::array<float,2>{0.13177149f, 0.545773923f},
-std::array<float,2>{0.545202076f, 0.72654742f},
-std::array<float,2>{0.0114896195f, 0.49907884f},
-std::array<float,2>{0.911792994f, 0.168260887f},
-std::array<float,2>{0.43537882f, 0.780855894f},
-std::array<float,2>{0.967489421f, 0.621476352f},
-std::array<float,2>{0.438118249f, 0.354283035f},
-std::array<float,2>{0.590163946f, 0.0800109431f},
-std::array<float,2>{0.11097616f, 0.972001553f},
-std::array<float,2>{0.631718397f, 0.832750142f},
-std::array<float,2>{0.200907752f, 0.225728333f},
-std::array<float,2>{0.831728816f, 0.399422944f},
-std::array<float,2>{0.254165769f, 0.664111376f},
-std::array<float,2>{0.9147138f, 0.949621558f},
-std::array<float,2>{0.427301764f, 0.123341382f},
-std::array<float,2>{0.531876862f, 0.321801275f},
-std::array<float,2>{0.00606419938f, 0.583185434f},
-std::array<float,2>{0.688008249f, 0.646009862f},
-std::array<float,2>{0.136792704f, 0.417593092f},
-std::array<float,2>{0.775838673f, 0.206184402f},
-std::array<float,2>{0.322593898f, 0.848223507f},
-std::array<float,2>{0.836932838f, 0.520453215f},
-std::array<float,2>{0.261700392f, 0.257209092f},
-std::array<float,2>{0.638302326f, 0.0116430921f},
-std::array<float,2>{0.1915223f, 0.927419543f},
-std::array<float,2>{0.580521584f, 0.782978117f},
-std::array<float,2>{0.119446412f, 0.129973754f},
-std::array<float,2>{0.957063019f, 0.442314684f},
-std::array<float,2>{0.445344418f, 0.690404236f},
-std::array<float,2>{0.790947676f, 0.841941714f},
-std::array<float,2>{0.35703972f, 0.227665052f},
-std::array<float,2>{0.745219588f, 0.393071026f},
-std::array<float,2>{0.156374559f, 0.660287559f},
-std::array<float,2>{0.512504756f, 0.611748934f},
-std::array<float,2>{0.0551010743f, 0.350354999f},
-std::array<float,2>{0.891842246f, 0.0919885933f},
-std::array<float,2>{0.384747207f, 0.977698088f},
-std::array<float,2>{0.989962816f, 0.731087565f},
-std::array<float,2>{0.484858125f, 0.48673901f},
-std::array<float,2>{0.598326504f, 0.158047438f},
-std::array<float,2>{0.0778104737f, 0.773227215f},
-std::array<float,2>{0.670938611f, 0.89570874f},
-std::array<float,2>{0.224569708f, 0.060641434f},
-std::array<float,2>{0.868757367f, 0.28527981f},
-std::array<float,2>{0.282546133f, 0.535067737f},
-std::array<float,2>{0.94843787f, 0.765441954f},
-std::array<float,2>{0.453327805f, 0.176433697f},
-std::array<float,2>{0.576361179f, 0.475099862f},
-std::array<float,2>{0.102409534f, 0.742920816f},
-std::array<float,2>{0.656046212f, 0.54903692f},
-std::array<float,2>{0.21433273f, 0.304236472f},
-std::array<float,2>{0.819682896f, 0.0360715203f},
-std::array<float,2>{0.279804826f, 0.890480518f},
-std::array<float,2>{0.762790024f, 0.68196702f},
-std::array<float,2>{0.335706592f, 0.388204753f},
-std::array<float,2>{0.714357316f, 0.235254332f},
-std::array<float,2>{0.15161711f, 0.825698853f},
-std::array<float,2>{0.555755675f, 0.986230671f},
-std::array<float,2>{0.024930222f, 0.0637792721f},
-std::array<float,2>{0.923448026f, 0.370921612f},
-std::array<float,2>{0.421678483f, 0.596348286f},
-std::array<float,2>{0.848797262f, 0.909419477f},
-std::array<float,2>{0.304651856f, 0.0312127545f},
-std::array<float,2>{0.679371893f, 0.268139511f},
-std::array<float,2>{0.237334147f, 0.507316589f},
-std::array<float,2>{0.614638925f, 0.708006501f},
-std::array<float,2>{0.0825579837f, 0.464673281f},
-std::array<float,2>{0.978531003f, 0.154564813f},
-std::array<float,2>{0.471233726f, 0.810587168f},
-std::array<float,2>{0.875652134f, 0.564722359f},
-std::array<float,2>{0.392688215f, 0.342052847f},
-std::array<float,2>{0.523103952f, 0.109100007f},
-std::array<float,2>{0.0377915353f, 0.957964778f},
-std::array<float,2>{0.724516988f, 0.862513542f},
-std::array<float,2>{0.177952364f, 0.192031085f},
-std::array<float,2>{0.803147495f, 0.428452104f},
-std::array<float,2>{0.364784718f, 0.636497855f},
-std::array<float,2>{0.973101139f, 0.878622591f},
-std::array<float,2>{0.476984888f, 0.0424246788f},
-std::array<float,2>{0.622450769f, 0.310919285f},
-std::array<float,2>{0.0892262906f, 0.561453402f},
-std::array<float,2>{0.680332124f, 0.741946876f},
-std::array<float,2>{0.245988443f, 0.480986625f},
-std::array<float,2>{0.859351099f, 0.180469587f},
-std::array<float,2>{0.306428164f, 0.751998603f},
-std::array<float,2>{0.806555927f, 0.604849517f},
-std::array<float,2>{0.36864385f, 0.365822852f},
-std::array<float,2>{0.731428981f, 0.0709295273f},
-std::array<float,2>{0.186545655f, 0.994908392f},
-std::array<float,2>{0.53050822f, 0.818957269f},
-std::array<float,2>{0.0408707745f, 0.247313634f},
-std::array<float,2>{0.887700975f, 0.375035971f},
-std::array<float,2>{0.402733028f, 0.672910154f},
-std::array<float,2>{0.820573211f, 0.803990126f},
-std::array<float,2>{0.26633215f, 0.146836832f},
-std::array<float,2>{0.647063017f, 0.454397619f},
-std::array<float,2>{0.208651036f, 0.712434232f},
-std::array<float,2>{0.569514692f, 0.515576422f},
-std::array<float,2>{0.0981710553f, 0.279193908f},
-std::array<float,2>{0.940007448f, 0.0209471099f},
-std::array<float,2>{0.467169851f, 0.918014765f},
-std::array<float,2>{0.929719388f, 0.62997669f},
-std::array<float,2>{0.413979053f, 0.437429845f},
-std::array<float,2>{0.546992183f, 0.202558398f},
-std::array<float,2>{0.0182284918f, 0.873188257f},
-std::array<float,2>{0.703788638f, 0.961906016f},
-std::array<float,2>{0.145276204f, 0.093874909f},
-std::array<float,2>{0.752560019f, 0.328385174f},
-std::array<float,2>{0.33611241f, 0.572324038f},
-std::array<float,2>{0.903107941f, 0.856744111f},
-std::array<float,2>{0.376001924f, 0.216419682f},
-std::array<float,2>{0.505515754f, 0.407773495f},
-std::array<float,2>{0.0475475714f, 0.654524982f},
-std::array<float,2>{0.741859555f, 0.587494254f},
-std::array<float,2>{0.168416902f, 0.318973929f},
-std::array<float,2>{0.784869194f, 0.114476122f},
-std::array<float,2>{0.350828022f, 0.940443039f},
-std::array<float,2>{0.866182387f, 0.697427452f},
-std::array<float,2>{0.295158327f, 0.452946961f},
-std::array<float,2>{0.656900227f, 0.132960394f},
-std::array<float,2>{0.229676306f, 0.790411174f},
-std::array<float,2>{0.608172596f, 0.935144663f},
-std::array<float,2>{0.0676794425f, 0.00738419406f},
-std::array<float,2>{0.999356091f, 0.25878492f},
-std::array<float,2>{0.496533632f, 0.527231991f},
-std::array<float,2>{0.769885957f, 0.971778631f},
-std::array<float,2>{0.317706317f, 0.0797660947f},
-std::array<float,2>{0.702882588f, 0.35419783f},
-std::array<float,2>{0.129446119f, 0.621119857f},
-std::array<float,2>{0.543689728f, 0.664440572f},
-std::array<float,2>{0.00895376224f, 0.399758339f},
-std::array<float,2>{0.913763523f, 0.225859329f},
-std::array<float,2>{0.436849028f, 0.832872152f},
-std::array<float,2>{0.96529603f, 0.545599639f},
-std::array<float,2>{0.440285504f, 0.295564741f},
-std::array<float,2>{0.592259169f, 0.0471927673f},
-std::array<float,2>{0.112166919f, 0.903548896f},
-std::array<float,2>{0.630092621f, 0.781044364f},
-std::array<float,2>{0.202353477f, 0.168143407f},
-std::array<float,2>{0.828463852f, 0.499341875f},
-std::array<float,2>{0.257296145f, 0.726157844f},
-std::array<float,2>{0.884068787f, 0.924414456f},
-std::array<float,2>{0.401791394f, 0.0146831563f},
-std::array<float,2>{0.52646178f, 0.250489384f},
-std::array<float,2>{0.0432453081f, 0.517475605f},
-std::array<float,2>{0.726688147f, 0.692483962f},
-std::array<float,2>{0.180360526f, 0.438562006f},
-std::array<float,2>{0.809318244f, 0.127689153f},
-std::array<float,2>{0.37476325f, 0.785908103f},
-std::array<float,2>{0.854710042f, 0.579711676f},
-std::array<float,2>{0.309978843f, 0.327875584f},
-std::array<float,2>{0.686457932f, 0.117698193f},
-std::array<float,2>{0.248894811f, 0.947076976f},
-std::array<float,2>{0.620666146f, 0.844234169f},
-std::array<float,2>{0.0901644081f, 0.207375497f},
-std::array<float,2>{0.969375789f, 0.418062776f},
-std::array<float,2>{0.483632207f, 0.643197894f},
-std::array<float,2>{0.757783294f, 0.767081141f},
-std::array<float,2>{0.342131495f, 0.160188287f},
-std::array<float,2>{0.710572779f, 0.489780337f},
-std::array<float,2>{0.142745808f, 0.729977071f},
-std::array<float,2>{0.55284369f, 0.537782252f},
-std::array<float,2>{0.0224555079f, 0.281819999f},
-std::array<float,2>{0.935108244f, 0.0548351705f},
-std::array<float,2>{0.406571805f, 0.891432643f},
-std::array<float,2>{0.94320184f, 0.659992218f},
-std::array<float,2>{0.463275462f, 0.396884203f},
-std::array<float,2>{0.564014494f, 0.231613874f},
-std::array<float,2>{0.0951807797f, 0.836844862f},
-std::array<float,2>{0.641783834f, 0.982945561f},
-std::array<float,2>{0.205942065f, 0.087839663f},
-std::array<float,2>{0.827019453f, 0.346763343f},
-std::array<float,2>{0.273431748f, 0.615264833f},
-std::array<float,2>{0.994771779f, 0.821381629f},
-std::array<float,2>{0.493103057f, 0.240868777f},
-std::array<float,2>{0.601721704f, 0.38537845f},
-std::array<float,2>{0.0627982393f, 0.684278667f},
-std::array<float,2>{0.663923979f, 0.600136697f},
-std::array<float,2>{0.230748773f, 0.373100042f},
-std::array<float,2>{0.861478388f, 0.0695974007f},
-std::array<float,2>{0.292149186f, 0.988930762f},
-std::array<float,2>{0.786212564f, 0.746884644f},
-std::array<float,2>{0.344614565f, 0.470303327f},
-std::array<float,2>{0.736955881f, 0.175293386f},
-std::array<float,2>{0.166023746f, 0.76129359f},
-std::array<float,2>{0.501479566f, 0.883577704f},
-std::array<float,2>{0.0540593714f, 0.033688128f},
-std::array<float,2>{0.900025725f, 0.300442308f},
-std::array<float,2>{0.380285501f, 0.554082334f},
-std::array<float,2>{0.835352063f, 0.953279734f},
-std::array<float,2>{0.251256645f, 0.102304436f},
-std::array<float,2>{0.627251446f, 0.338065058f},
-std::array<float,2>{0.198145747f, 0.569992423f},
-std::array<float,2>{0.588792145f, 0.639030278f},
-std::array<float,2>{0.116545737f, 0.423367143f},
-std::array<float,2>{0.961371005f, 0.190016434f},
-std::array<float,2>{0.444487482f, 0.865522444f},
-std::array<float,2>{0.908125401f, 0.501641035f},
-std::array<float,2>{0.431871057f, 0.270134687f},
-std::array<float,2>{0.542333484f, 0.0273245871f},
-std::array<float,2>{0.0120049799f, 0.91298306f},
-std::array<float,2>{0.698411167f, 0.805306792f},
-std::array<float,2>{0.126116723f, 0.149961799f},
-std::array<float,2>{0.76701659f, 0.468450546f},
-std::array<float,2>{0.3141087f, 0.706728101f},
-std::array<float,2>{0.956888318f, 0.996596694f},
-std::array<float,2>{0.451178253f, 0.0777665377f},
-std::array<float,2>{0.583717585f, 0.361362785f},
-std::array<float,2>{0.122295149f, 0.607124507f},
-std::array<float,2>{0.636278927f, 0.677592814f},
-std::array<float,2>{0.188749909f, 0.38047424f},
-std::array<float,2>{0.840502679f, 0.244051471f},
-std::array<float,2>{0.265616715f, 0.814179003f},
-std::array<float,2>{0.777881861f, 0.555653214f},
-std::array<float,2>{0.325122774f, 0.306299776f},
-std::array<float,2>{0.694897652f, 0.0466755107f},
-std::array<float,2>{0.134576917f, 0.878928542f},
-std::array<float,2>{0.53719151f, 0.757500231f},
-std::array<float,2>{0.00223769643f, 0.185524762f},
-std::array<float,2>{0.921688914f, 0.476780683f},
-std::array<float,2>{0.422317654f, 0.735159636f},
-std::array<float,2>{0.872399211f, 0.867657959f},
-std::array<float,2>{0.285501927f, 0.1986036f},
-std::array<float,2>{0.667689204f, 0.431922317f},
-std::array<float,2>{0.220703825f, 0.626976013f},
-std::array<float,2>{0.595234275f, 0.576289475f},
-std::array<float,2>{0.0719823614f, 0.334670186f},
-std::array<float,2>{0.987199783f, 0.101463579f},
-std::array<float,2>{0.490766615f, 0.96704942f},
-std::array<float,2>{0.897346377f, 0.717936277f},
-std::array<float,2>{0.386794269f, 0.459882975f},
-std::array<float,2>{0.509460509f, 0.143423796f},
-std::array<float,2>{0.0607403554f, 0.799251974f},
-std::array<float,2>{0.748847902f, 0.915266931f},
-std::array<float,2>{0.16317898f, 0.0190499369f},
-std::array<float,2>{0.795362473f, 0.27674827f},
-std::array<float,2>{0.351854503f, 0.50847429f},
-std::array<float,2>{0.92802012f, 0.794950962f},
-std::array<float,2>{0.414187521f, 0.139184937f},
-std::array<float,2>{0.560159504f, 0.446969509f},
-std::array<float,2>{0.0281108655f, 0.70000124f},
-std::array<float,2>{0.718660712f, 0.527797759f},
-std::array<float,2>{0.155848056f, 0.262126088f},
-std::array<float,2>{0.759463727f, 0.00192615413f},
-std::array<float,2>{0.328224301f, 0.929839611f},
-std::array<float,2>{0.815604627f, 0.649349034f},
-std::array<float,2>{0.277032048f, 0.412681252f},
-std::array<float,2>{0.649304628f, 0.212704271f},
-std::array<float,2>{0.216089845f, 0.853486657f},
-std::array<float,2>{0.572224617f, 0.944795132f},
-std::array<float,2>{0.109046072f, 0.109393477f},
-std::array<float,2>{0.949550986f, 0.313839555f},
-std::array<float,2>{0.459994555f, 0.590923548f},
-std::array<float,2>{0.799515903f, 0.899604917f},
-std::array<float,2>{0.362678707f, 0.0521526448f},
-std::array<float,2>{0.719519734f, 0.29068926f},
-std::array<float,2>{0.173462868f, 0.539678812f},
-std::array<float,2>{0.516129553f, 0.72109133f},
-std::array<float,2>{0.0328929499f, 0.49517709f},
-std::array<float,2>{0.880838513f, 0.164506108f},
-std::array<float,2>{0.394794136f, 0.776731133f},
-std::array<float,2>{0.982282758f, 0.617605031f},
-std::array<float,2>{0.47279045f, 0.359189123f},
-std::array<float,2>{0.612232506f, 0.0835999548f},
-std::array<float,2>{0.079909943f, 0.972819746f},
-std::array<float,2>{0.673999608f, 0.831394792f},
-std::array<float,2>{0.239506587f, 0.219935834f},
-std::array<float,2>{0.843766928f, 0.404747128f},
-std::array<float,2>{0.300306916f, 0.670128822f},
-std::array<float,2>{0.892938316f, 0.979907215f},
-std::array<float,2>{0.384781271f, 0.0906355679f},
-std::array<float,2>{0.515161395f, 0.348632544f},
-std::array<float,2>{0.057239309f, 0.610135436f},
-std::array<float,2>{0.742971003f, 0.663531959f},
-std::array<float,2>{0.159494847f, 0.391115963f},
-std::array<float,2>{0.791991949f, 0.228935257f},
-std::array<float,2>{0.357657522f, 0.840128779f},
-std::array<float,2>{0.86977917f, 0.531277955f},
-std::array<float,2>{0.283814132f, 0.287443757f},
-std::array<float,2>{0.668889284f, 0.0604815483f},
-std::array<float,2>{0.224730134f, 0.896917105f},
-std::array<float,2>{0.59985894f, 0.769995511f},
-std::array<float,2>{0.0756188184f, 0.158948615f},
-std::array<float,2>{0.992150664f, 0.485424161f},
-std::array<float,2>{0.488130838f, 0.733610809f},
-std::array<float,2>{0.774928153f, 0.849930286f},
-std::array<float,2>{0.321445346f, 0.204562262f},
-std::array<float,2>{0.691367507f, 0.414967269f},
-std::array<float,2>{0.139279813f, 0.648342073f},
-std::array<float,2>{0.533364058f, 0.585484147f},
-std::array<float,2>{0.00398859708f, 0.324116528f},
-std::array<float,2>{0.917491317f, 0.122741491f},
-std::array<float,2>{0.428495497f, 0.95138222f},
-std::array<float,2>{0.959183335f, 0.688555717f},
-std::array<float,2>{0.448801398f, 0.444586605f},
-std::array<float,2>{0.579806209f, 0.131908834f},
-std::array<float,2>{0.117435381f, 0.783392787f},
-std::array<float,2>{0.639760852f, 0.928772688f},
-std::array<float,2>{0.194545329f, 0.00820917077f},
-std::array<float,2>{0.838769078f, 0.254839003f},
-std::array<float,2>{0.258075178f, 0.521609724f},
-std::array<float,2>{0.977546513f, 0.810442686f},
-std::array<float,2>{0.469079226f, 0.153111592f},
-std::array<float,2>{0.616550982f, 0.461861581f},
-std::array<float,2>{0.0845026225f, 0.70931077f},
-std::array<float,2>{0.676699996f, 0.504278958f},
-std::array<float,2>{0.236179978f, 0.265960664f},
-std::array<float,2>{0.850470185f, 0.0285841431f},
-std::array<float,2>{0.301239252f, 0.907116055f},
-std::array<float,2>{0.801882505f, 0.634644628f},
-std::array<float,2>{0.366660088f, 0.426609159f},
-std::array<float,2>{0.72602421f, 0.19367294f},
-std::array<float,2>{0.176044405f, 0.860942841f},
-std::array<float,2>{0.519821525f, 0.960584879f},
-std::array<float,2>{0.036906492f, 0.106776223f},
-std::array<float,2>{0.87701273f, 0.33996281f},
-std::array<float,2>{0.39232862f, 0.563732445f},
-std::array<float,2>{0.817667782f, 0.887381136f},
-std::array<float,2>{0.279279172f, 0.037923824f},
-std::array<float,2>{0.654001176f, 0.302715212f},
-std::array<float,2>{0.212538227f, 0.548084259f},
-std::array<float,2>{0.574507535f, 0.745758653f},
-std::array<float,2>{0.104276851f, 0.472731233f},
-std::array<float,2>{0.945916653f, 0.179457858f},
-std::array<float,2>{0.455839068f, 0.763563573f},
-std::array<float,2>{0.923837006f, 0.594272614f},
-std::array<float,2>{0.419245303f, 0.367556661f},
-std::array<float,2>{0.556881189f, 0.0654447228f},
-std::array<float,2>{0.0258060619f, 0.987712622f},
-std::array<float,2>{0.711572766f, 0.827596605f},
-std::array<float,2>{0.150057033f, 0.237717822f},
-std::array<float,2>{0.765120864f, 0.389134645f},
-std::array<float,2>{0.332472771f, 0.681375921f},
-std::array<float,2>{0.937634528f, 0.921669245f},
-std::array<float,2>{0.465667754f, 0.0223821905f},
-std::array<float,2>{0.566815495f, 0.279623091f},
-std::array<float,2>{0.100771606f, 0.51301223f},
-std::array<float,2>{0.645137966f, 0.713496804f},
-std::array<float,2>{0.209752426f, 0.45598948f},
-std::array<float,2>{0.822394848f, 0.144742116f},
-std::array<float,2>{0.268474013f, 0.801947653f},
-std::array<float,2>{0.750541925f, 0.570530236f},
-std::array<float,2>{0.338606298f, 0.330532253f},
-std::array<float,2>{0.706748009f, 0.0973879471f},
-std::array<float,2>{0.147575676f, 0.964535773f},
-std::array<float,2>{0.549362719f, 0.871445f},
-std::array<float,2>{0.0157232489f, 0.199275866f},
-std::array<float,2>{0.931949437f, 0.434375286f},
-std::array<float,2>{0.410297126f, 0.630946338f},
-std::array<float,2>{0.857353151f, 0.750872791f},
-std::array<float,2>{0.307431132f, 0.182808816f},
-std::array<float,2>{0.682828724f, 0.482449502f},
-std::array<float,2>{0.243911758f, 0.738352597f},
-std::array<float,2>{0.623235285f, 0.560211539f},
-std::array<float,2>{0.0875082389f, 0.310541004f},
-std::array<float,2>{0.975432754f, 0.0403824933f},
-std::array<float,2>{0.479816347f, 0.876621008f},
-std::array<float,2>{0.889034867f, 0.673961818f},
-std::array<float,2>{0.404477209f, 0.37708652f},
-std::array<float,2>{0.527942002f, 0.249376044f},
-std::array<float,2>{0.0416737124f, 0.817438006f},
-std::array<float,2>{0.734263122f, 0.993321657f},
-std::array<float,2>{0.1844237f, 0.0724411979f},
-std::array<float,2>{0.806938052f, 0.364525378f},
-std::array<float,2>{0.369217396f, 0.602104664f},
-std::array<float,2>{0.910640419f, 0.835393429f},
-std::array<float,2>{0.434183329f, 0.223527461f},
-std::array<float,2>{0.546551347f, 0.402199268f},
-std::array<float,2>{0.0100081619f, 0.667388499f},
-std::array<float,2>{0.699228764f, 0.624125957f},
-std::array<float,2>{0.132335499f, 0.351631284f},
-std::array<float,2>{0.773115456f, 0.0800877437f},
-std::array<float,2>{0.319998771f, 0.970392764f},
-std::array<float,2>{0.830577612f, 0.723771513f},
-std::array<float,2>{0.254982531f, 0.496486276f},
-std::array<float,2>{0.632387698f, 0.171080515f},
-std::array<float,2>{0.199326605f, 0.779158354f},
-std::array<float,2>{0.591137886f, 0.905702233f},
-std::array<float,2>{0.110118255f, 0.0507373139f},
-std::array<float,2>{0.967814744f, 0.293869555f},
-std::array<float,2>{0.438527852f, 0.543695271f},
-std::array<float,2>{0.782020152f, 0.939317942f},
-std::array<float,2>{0.349382967f, 0.116767243f},
-std::array<float,2>{0.739908934f, 0.316736817f},
-std::array<float,2>{0.171462581f, 0.588925362f},
-std::array<float,2>{0.507580221f, 0.652983367f},
-std::array<float,2>{0.0496364944f, 0.409556001f},
-std::array<float,2>{0.905757666f, 0.217886984f},
-std::array<float,2>{0.377678812f, 0.858747005f},
-std::array<float,2>{0.997995853f, 0.524846137f},
-std::array<float,2>{0.498773456f, 0.260830671f},
-std::array<float,2>{0.607052743f, 0.0043391739f},
-std::array<float,2>{0.0692956746f, 0.936800718f},
-std::array<float,2>{0.658495486f, 0.791335523f},
-std::array<float,2>{0.228410721f, 0.135294005f},
-std::array<float,2>{0.863785386f, 0.44925493f},
-std::array<float,2>{0.294579595f, 0.696846187f},
-std::array<float,2>{0.937338948f, 0.894132793f},
-std::array<float,2>{0.409576029f, 0.0576465353f},
-std::array<float,2>{0.552535772f, 0.283858836f},
-std::array<float,2>{0.0203308277f, 0.536595821f},
-std::array<float,2>{0.708523273f, 0.727362871f},
-std::array<float,2>{0.141449243f, 0.491316855f},
-std::array<float,2>{0.755761325f, 0.16376324f},
-std::array<float,2>{0.340653211f, 0.767643511f},
-std::array<float,2>{0.825850844f, 0.614314675f},
-std::array<float,2>{0.270931959f, 0.344320327f},
-std::array<float,2>{0.642672598f, 0.0884472951f},
-std::array<float,2>{0.205025777f, 0.981487513f},
-std::array<float,2>{0.565207183f, 0.839564919f},
-std::array<float,2>{0.095711343f, 0.233365998f},
-std::array<float,2>{0.943923354f, 0.39572224f},
-std::array<float,2>{0.461556166f, 0.658044696f},
-std::array<float,2>{0.810841441f, 0.787442982f},
-std::array<float,2>{0.372152716f, 0.126066253f},
-std::array<float,2>{0.730034113f, 0.439461589f},
-std::array<float,2>{0.182833359f, 0.694014847f},
-std::array<float,2>{0.523514688f, 0.518751681f},
-std::array<float,2>{0.0463112779f, 0.25354892f},
-std::array<float,2>{0.885440707f, 0.0134065952f},
-std::array<float,2>{0.400333852f, 0.923069119f},
-std::array<float,2>{0.970784664f, 0.640741587f},
-std::array<float,2>{0.482381135f, 0.420872629f},
-std::array<float,2>{0.617459536f, 0.21066694f},
-std::array<float,2>{0.0929328725f, 0.847052395f},
-std::array<float,2>{0.684195518f, 0.947524726f},
-std::array<float,2>{0.247581691f, 0.119939014f},
-std::array<float,2>{0.852742314f, 0.324461222f},
-std::array<float,2>{0.312223494f, 0.581000328f},
-std::array<float,2>{0.96451813f, 0.86459887f},
-std::array<float,2>{0.443171531f, 0.188299447f},
-std::array<float,2>{0.586984515f, 0.425522357f},
-std::array<float,2>{0.113578886f, 0.636835456f},
-std::array<float,2>{0.626164615f, 0.567804039f},
-std::array<float,2>{0.196697727f, 0.337599874f},
-std::array<float,2>{0.833669722f, 0.10381636f},
-std::array<float,2>{0.253482908f, 0.956594348f},
-std::array<float,2>{0.769113004f, 0.704982936f},
-std::array<float,2>{0.316208839f, 0.464984983f},
-std::array<float,2>{0.696258247f, 0.150414258f},
-std::array<float,2>{0.127070889f, 0.807694912f},
-std::array<float,2>{0.539481342f, 0.910202026f},
-std::array<float,2>{0.0139090177f, 0.0241330788f},
-std::array<float,2>{0.909814835f, 0.272650093f},
-std::array<float,2>{0.431530327f, 0.503275514f},
-std::array<float,2>{0.859869063f, 0.991649091f},
-std::array<float,2>{0.289705634f, 0.0672865063f},
-std::array<float,2>{0.660919189f, 0.371501952f},
-std::array<float,2>{0.234232709f, 0.598592043f},
-std::array<float,2>{0.604413629f, 0.686136544f},
-std::array<float,2>{0.0662199631f, 0.383765697f},
-std::array<float,2>{0.992339015f, 0.238488019f},
-std::array<float,2>{0.495360017f, 0.822431505f},
-std::array<float,2>{0.900894165f, 0.551512361f},
-std::array<float,2>{0.382323176f, 0.297384769f},
-std::array<float,2>{0.503478408f, 0.032754343f},
-std::array<float,2>{0.0511061922f, 0.885334253f},
-std::array<float,2>{0.734478235f, 0.758959949f},
-std::array<float,2>{0.165367246f, 0.172630593f},
-std::array<float,2>{0.78724122f, 0.471213788f},
-std::array<float,2>{0.34646824f, 0.74806428f},
-std::array<float,2>{0.985227287f, 0.965366781f},
-std::array<float,2>{0.489289045f, 0.0982773528f},
-std::array<float,2>{0.597288668f, 0.332108706f},
-std::array<float,2>{0.0735979974f, 0.575327516f},
-std::array<float,2>{0.664154708f, 0.625008762f},
-std::array<float,2>{0.219069391f, 0.43028754f},
-std::array<float,2>{0.874105036f, 0.197187066f},
-std::array<float,2>{0.287466884f, 0.870066524f},
-std::array<float,2>{0.794057071f, 0.510019541f},
-std::array<float,2>{0.353781492f, 0.273969918f},
-std::array<float,2>{0.747689962f, 0.0162274744f},
-std::array<float,2>{0.161861286f, 0.91739738f},
-std::array<float,2>{0.510769188f, 0.79851532f},
-std::array<float,2>{0.0605335198f, 0.142478421f},
-std::array<float,2>{0.894708633f, 0.457224578f},
-std::array<float,2>{0.389324874f, 0.716148019f},
-std::array<float,2>{0.842221498f, 0.816202879f},
-std::array<float,2>{0.26256302f, 0.245384872f},
-std::array<float,2>{0.634152293f, 0.381272972f},
-std::array<float,2>{0.18989338f, 0.679163218f},
-std::array<float,2>{0.584706962f, 0.607771337f},
-std::array<float,2>{0.124651901f, 0.360205203f},
-std::array<float,2>{0.953365743f, 0.0755444244f},
-std::array<float,2>{0.450306565f, 0.998271883f},
-std::array<float,2>{0.918914676f, 0.736988962f},
-std::array<float,2>{0.424081475f, 0.478550404f},
-std::array<float,2>{0.536881328f, 0.186514348f},
-std::array<float,2>{0.0013956757f, 0.754817724f},
-std::array<float,2>{0.691432238f, 0.881245494f},
-std::array<float,2>{0.134900898f, 0.0445288941f},
-std::array<float,2>{0.77930361f, 0.307481468f},
-std::array<float,2>{0.326503426f, 0.55790031f},
-std::array<float,2>{0.882533669f, 0.774978757f},
-std::array<float,2>{0.397751868f, 0.16723296f},
-std::array<float,2>{0.519424558f, 0.493411809f},
-std::array<float,2>{0.0340927653f, 0.719226778f},
-std::array<float,2>{0.72174412f, 0.542800546f},
-std::array<float,2>{0.175069943f, 0.291693836f},
-std::array<float,2>{0.797820747f, 0.0532679856f},
-std::array<float,2>{0.361008793f, 0.901750624f},
-std::array<float,2>{0.846626878f, 0.668034256f},
-std::array<float,2>{0.29791379f, 0.403764009f},
-std::array<float,2>{0.672242045f, 0.221329406f},
-std::array<float,2>{0.241682678f, 0.829753757f},
-std::array<float,2>{0.610857069f, 0.974826634f},
-std::array<float,2>{0.0818808228f, 0.0851317793f},
-std::array<float,2>{0.983869374f, 0.355686635f},
-std::array<float,2>{0.47595343f, 0.620984495f},
-std::array<float,2>{0.761645079f, 0.933228314f},
-std::array<float,2>{0.330878526f, 0.00206081243f},
-std::array<float,2>{0.715256691f, 0.264255553f},
-std::array<float,2>{0.153600961f, 0.530392766f},
-std::array<float,2>{0.560639203f, 0.701987803f},
-std::array<float,2>{0.0312153585f, 0.447612584f},
-std::array<float,2>{0.926403344f, 0.136743903f},
-std::array<float,2>{0.416886419f, 0.79485023f},
-std::array<float,2>{0.95122385f, 0.592968404f},
-std::array<float,2>{0.458815873f, 0.314932615f},
-std::array<float,2>{0.573290944f, 0.111952476f},
-std::array<float,2>{0.107207142f, 0.943195105f},
-std::array<float,2>{0.650783598f, 0.854186833f},
-std::array<float,2>{0.218230128f, 0.214475229f},
-std::array<float,2>{0.812814772f, 0.410537004f},
-std::array<float,2>{0.275206119f, 0.650834858f},
-std::array<float,2>{0.922792256f, 0.987230361f},
-std::array<float,2>{0.420019567f, 0.0649148598f},
-std::array<float,2>{0.555553675f, 0.368912399f},
-std::array<float,2>{0.0242647827f, 0.595020056f},
-std::array<float,2>{0.713050127f, 0.680199325f},
-std::array<float,2>{0.151085094f, 0.390330851f},
-std::array<float,2>{0.76262629f, 0.237006396f},
-std::array<float,2>{0.334819883f, 0.826618969f},
-std::array<float,2>{0.819134235f, 0.547217965f},
-std::array<float,2>{0.280419976f, 0.301339954f},
-std::array<float,2>{0.655246019f, 0.0386649445f},
-std::array<float,2>{0.212937176f, 0.888236642f},
-std::array<float,2>{0.577846825f, 0.762093544f},
-std::array<float,2>{0.103099026f, 0.178066626f},
-std::array<float,2>{0.947564602f, 0.474280059f},
-std::array<float,2>{0.45479995f, 0.744203091f},
-std::array<float,2>{0.804323435f, 0.859593868f},
-std::array<float,2>{0.363386899f, 0.194886968f},
-std::array<float,2>{0.722766399f, 0.42712909f},
-std::array<float,2>{0.178764552f, 0.633101881f},
-std::array<float,2>{0.5215078f, 0.562816203f},
-std::array<float,2>{0.0384428315f, 0.34127146f},
-std::array<float,2>{0.876433313f, 0.105691992f},
-std::array<float,2>{0.39360711f, 0.959187567f},
-std::array<float,2>{0.980035245f, 0.710388899f},
-std::array<float,2>{0.472444445f, 0.462181687f},
-std::array<float,2>{0.6138919f, 0.153479278f},
-std::array<float,2>{0.0839172155f, 0.808654487f},
-std::array<float,2>{0.67798245f, 0.90760988f},
-std::array<float,2>{0.236833408f, 0.0279411916f},
-std::array<float,2>{0.848055899f, 0.267495394f},
-std::array<float,2>{0.303442031f, 0.505435705f},
-std::array<float,2>{0.958127797f, 0.784268975f},
-std::array<float,2>{0.4465819f, 0.131347448f},
-std::array<float,2>{0.582023859f, 0.443991154f},
-std::array<float,2>{0.120144695f, 0.688446939f},
-std::array<float,2>{0.637091041f, 0.52251941f},
-std::array<float,2>{0.192993179f, 0.255407363f},
-std::array<float,2>{0.836708724f, 0.00911484007f},
-std::array<float,2>{0.26020059f, 0.928624153f},
-std::array<float,2>{0.776768148f, 0.646674395f},
-std::array<float,2>{0.323873699f, 0.415111244f},
-std::array<float,2>{0.688851178f, 0.204070881f},
-std::array<float,2>{0.137943134f, 0.850640535f},
-std::array<float,2>{0.532884896f, 0.952423453f},
-std::array<float,2>{0.006965084f, 0.121429533f},
-std::array<float,2>{0.915485561f, 0.322947592f},
-std::array<float,2>{0.425851196f, 0.584205508f},
-std::array<float,2>{0.867366016f, 0.898303688f},
-std::array<float,2>{0.281282932f, 0.0592597723f},
-std::array<float,2>{0.670891285f, 0.288170666f},
-std::array<float,2>{0.223623559f, 0.53310591f},
-std::array<float,2>{0.599178851f, 0.732783914f},
-std::array<float,2>{0.0765710324f, 0.484630823f},
-std::array<float,2>{0.988654077f, 0.160046652f},
-std::array<float,2>{0.485552877f, 0.771161795f},
-std::array<float,2>{0.891286135f, 0.61102432f},
-std::array<float,2>{0.382950306f, 0.348825306f},
-std::array<float,2>{0.51358217f, 0.0911364853f},
-std::array<float,2>{0.0560364053f, 0.978867233f},
-std::array<float,2>{0.745034099f, 0.841361582f},
-std::array<float,2>{0.157259986f, 0.229809329f},
-std::array<float,2>{0.78997314f, 0.391979396f},
-std::array<float,2>{0.356051356f, 0.662919939f},
-std::array<float,2>{0.998715341f, 0.935878515f},
-std::array<float,2>{0.497544527f, 0.00542793563f},
-std::array<float,2>{0.608998716f, 0.260670334f},
-std::array<float,2>{0.0672844574f, 0.523641765f},
-std::array<float,2>{0.658175468f, 0.695955634f},
-std::array<float,2>{0.229284778f, 0.450617671f},
-std::array<float,2>{0.866792977f, 0.136638895f},
-std::array<float,2>{0.296442121f, 0.792698383f},
-std::array<float,2>{0.783269227f, 0.588211894f},
-std::array<float,2>{0.35036242f, 0.318287253f},
-std::array<float,2>{0.740658224f, 0.115972869f},
-std::array<float,2>{0.169634521f, 0.93751359f},
-std::array<float,2>{0.504647315f, 0.857977331f},
-std::array<float,2>{0.048472859f, 0.217469618f},
-std::array<float,2>{0.904185593f, 0.408354133f},
-std::array<float,2>{0.37522319f, 0.653751194f},
-std::array<float,2>{0.829748571f, 0.778142691f},
-std::array<float,2>{0.256705731f, 0.170724332f},
-std::array<float,2>{0.629607201f, 0.497838795f},
-std::array<float,2>{0.201715395f, 0.722894788f},
-std::array<float,2>{0.593169272f, 0.544485271f},
-std::array<float,2>{0.11315044f, 0.294296831f},
-std::array<float,2>{0.966544807f, 0.049485404f},
-std::array<float,2>{0.441342354f, 0.90445286f},
-std::array<float,2>{0.912717342f, 0.666264236f},
-std::array<float,2>{0.435912758f, 0.401201725f},
-std::array<float,2>{0.544370115f, 0.224599302f},
-std::array<float,2>{0.00812006462f, 0.834176958f},
-std::array<float,2>{0.701329112f, 0.968976915f},
-std::array<float,2>{0.130328193f, 0.0817060992f},
-std::array<float,2>{0.771266937f, 0.353319436f},
-std::array<float,2>{0.317051351f, 0.623737514f},
-std::array<float,2>{0.887274325f, 0.817214966f},
-std::array<float,2>{0.403536767f, 0.248483434f},
-std::array<float,2>{0.530070722f, 0.378519118f},
-std::array<float,2>{0.039513614f, 0.674871564f},
-std::array<float,2>{0.731520116f, 0.60322392f},
-std::array<float,2>{0.185717046f, 0.363479614f},
-std::array<float,2>{0.805539906f, 0.0740700439f},
-std::array<float,2>{0.36759007f, 0.99229604f},
-std::array<float,2>{0.857893705f, 0.739439249f},
-std::array<float,2>{0.305166185f, 0.484064102f},
-std::array<float,2>{0.681291699f, 0.181860253f},
-std::array<float,2>{0.244581938f, 0.751468301f},
-std::array<float,2>{0.62151736f, 0.875346899f},
-std::array<float,2>{0.0883376673f, 0.0397941284f},
-std::array<float,2>{0.974394023f, 0.309498012f},
-std::array<float,2>{0.478461981f, 0.559519708f},
-std::array<float,2>{0.753117323f, 0.963281035f},
-std::array<float,2>{0.337410033f, 0.0966131017f},
-std::array<float,2>{0.70505029f, 0.331852674f},
-std::array<float,2>{0.14552328f, 0.57189101f},
-std::array<float,2>{0.548719764f, 0.632685363f},
-std::array<float,2>{0.0187021084f, 0.435373157f},
-std::array<float,2>{0.931608856f, 0.200738177f},
-std::array<float,2>{0.412718385f, 0.872589052f},
-std::array<float,2>{0.941193402f, 0.512544274f},
-std::array<float,2>{0.468375146f, 0.280695438f},
-std::array<float,2>{0.56906867f, 0.0226856079f},
-std::array<float,2>{0.09884727f, 0.920181274f},
-std::array<float,2>{0.648185074f, 0.801220119f},
-std::array<float,2>{0.207156211f, 0.145630419f},
-std::array<float,2>{0.822138488f, 0.456647277f},
-std::array<float,2>{0.267385334f, 0.714364111f},
-std::array<float,2>{0.899182856f, 0.886159718f},
-std::array<float,2>{0.379348308f, 0.0318038538f},
-std::array<float,2>{0.500823319f, 0.298124522f},
-std::array<float,2>{0.0533749424f, 0.552480876f},
-std::array<float,2>{0.737744987f, 0.749339283f},
-std::array<float,2>{0.167026266f, 0.471757799f},
-std::array<float,2>{0.785464466f, 0.173069924f},
-std::array<float,2>{0.34479335f, 0.758273661f},
-std::array<float,2>{0.862922251f, 0.599395454f},
-std::array<float,2>{0.291155457f, 0.372601837f},
-std::array<float,2>{0.662262321f, 0.0674419105f},
-std::array<float,2>{0.23229292f, 0.990469038f},
-std::array<float,2>{0.602849603f, 0.823900282f},
-std::array<float,2>{0.0635749474f, 0.239758372f},
-std::array<float,2>{0.996019661f, 0.383884698f},
-std::array<float,2>{0.493809223f, 0.686783254f},
-std::array<float,2>{0.766091228f, 0.806711733f},
-std::array<float,2>{0.313187301f, 0.152056411f},
-std::array<float,2>{0.697866261f, 0.466562808f},
-std::array<float,2>{0.12591283f, 0.70357269f},
-std::array<float,2>{0.541118681f, 0.502509594f},
-std::array<float,2>{0.0136323366f, 0.271613151f},
-std::array<float,2>{0.906352282f, 0.0246289894f},
-std::array<float,2>{0.432715863f, 0.911484063f},
-std::array<float,2>{0.962191403f, 0.63806355f},
-std::array<float,2>{0.443587035f, 0.423929125f},
-std::array<float,2>{0.589709997f, 0.188974038f},
-std::array<float,2>{0.116032094f, 0.864130318f},
-std::array<float,2>{0.628783703f, 0.955822289f},
-std::array<float,2>{0.198905125f, 0.105308674f},
-std::array<float,2>{0.834219098f, 0.336725593f},
-std::array<float,2>{0.250783741f, 0.566919208f},
-std::array<float,2>{0.970600784f, 0.846539319f},
-std::array<float,2>{0.482628852f, 0.20943521f},
-std::array<float,2>{0.619583786f, 0.42095679f},
-std::array<float,2>{0.0911000893f, 0.642163932f},
-std::array<float,2>{0.686545312f, 0.581443787f},
-std::array<float,2>{0.249832839f, 0.325841963f},
-std::array<float,2>{0.853926718f, 0.120221026f},
-std::array<float,2>{0.309049219f, 0.948907495f},
-std::array<float,2>{0.809701145f, 0.694388211f},
-std::array<float,2>{0.373226851f, 0.441152453f},
-std::array<float,2>{0.728123903f, 0.125806898f},
-std::array<float,2>{0.181538537f, 0.788826168f},
-std::array<float,2>{0.525405884f, 0.922505498f},
-std::array<float,2>{0.044056192f, 0.0126605202f},
-std::array<float,2>{0.883547187f, 0.252784789f},
-std::array<float,2>{0.401134968f, 0.518416524f},
-std::array<float,2>{0.828047752f, 0.981268525f},
-std::array<float,2>{0.272292793f, 0.089484185f},
-std::array<float,2>{0.640737951f, 0.345251471f},
-std::array<float,2>{0.206101969f, 0.61343807f},
-std::array<float,2>{0.563106775f, 0.657045066f},
-std::array<float,2>{0.0941595957f, 0.394919872f},
-std::array<float,2>{0.941649973f, 0.233753279f},
-std::array<float,2>{0.464578032f, 0.838324606f},
-std::array<float,2>{0.934050083f, 0.535880446f},
-std::array<float,2>{0.407520652f, 0.284497172f},
-std::array<float,2>{0.554077327f, 0.0569618195f},
-std::array<float,2>{0.0232331026f, 0.893224359f},
-std::array<float,2>{0.709497571f, 0.769420087f},
-std::array<float,2>{0.143739954f, 0.162272915f},
-std::array<float,2>{0.756058931f, 0.490709275f},
-std::array<float,2>{0.343529344f, 0.727662683f},
-std::array<float,2>{0.950633883f, 0.941597939f},
-std::array<float,2>{0.459190845f, 0.112780862f},
-std::array<float,2>{0.570992291f, 0.315810144f},
-std::array<float,2>{0.107562862f, 0.592438519f},
-std::array<float,2>{0.650324166f, 0.651862442f},
-std::array<float,2>{0.215449229f, 0.411673546f},
-std::array<float,2>{0.814668298f, 0.21375528f},
-std::array<float,2>{0.275764912f, 0.854654014f},
-std::array<float,2>{0.758597434f, 0.530148268f},
-std::array<float,2>{0.329539478f, 0.264716029f},
-std::array<float,2>{0.716948211f, 0.00389429484f},
-std::array<float,2>{0.154687777f, 0.932252526f},
-std::array<float,2>{0.559270203f, 0.79387188f},
-std::array<float,2>{0.02870203f, 0.138021499f},
-std::array<float,2>{0.92957288f, 0.448289126f},
-std::array<float,2>{0.415474474f, 0.702150881f},
-std::array<float,2>{0.84478575f, 0.828887582f},
-std::array<float,2>{0.299450845f, 0.222414955f},
-std::array<float,2>{0.674977779f, 0.402783096f},
-std::array<float,2>{0.238448963f, 0.669216514f},
-std::array<float,2>{0.612780333f, 0.619327426f},
-std::array<float,2>{0.0786661878f, 0.356942832f},
-std::array<float,2>{0.981162369f, 0.0844392031f},
-std::array<float,2>{0.474309385f, 0.975772619f},
-std::array<float,2>{0.879562318f, 0.7200526f},
-std::array<float,2>{0.395638496f, 0.492746145f},
-std::array<float,2>{0.517289042f, 0.166028485f},
-std::array<float,2>{0.0319380313f, 0.773727477f},
-std::array<float,2>{0.720189273f, 0.901062131f},
-std::array<float,2>{0.172467604f, 0.0543666035f},
-std::array<float,2>{0.800060809f, 0.292797357f},
-std::array<float,2>{0.361695737f, 0.541567802f},
-std::array<float,2>{0.9207111f, 0.754929125f},
-std::array<float,2>{0.423068404f, 0.187166125f},
-std::array<float,2>{0.539032042f, 0.480321914f},
-std::array<float,2>{0.00295329909f, 0.737728775f},
-std::array<float,2>{0.693984389f, 0.556645215f},
-std::array<float,2>{0.133441925f, 0.307791114f},
-std::array<float,2>{0.778826296f, 0.0434381627f},
-std::array<float,2>{0.325899363f, 0.882582247f},
-std::array<float,2>{0.841476738f, 0.678182304f},
-std::array<float,2>{0.263884485f, 0.38231954f},
-std::array<float,2>{0.635395527f, 0.245064393f},
-std::array<float,2>{0.188395172f, 0.815125048f},
-std::array<float,2>{0.58204639f, 0.999664187f},
-std::array<float,2>{0.121217199f, 0.0745065808f},
-std::array<float,2>{0.955111563f, 0.360848367f},
-std::array<float,2>{0.452748746f, 0.609269619f},
-std::array<float,2>{0.796163976f, 0.916927993f},
-std::array<float,2>{0.353084534f, 0.0171166174f},
-std::array<float,2>{0.749526024f, 0.274645716f},
-std::array<float,2>{0.162771225f, 0.51098007f},
-std::array<float,2>{0.508185506f, 0.715179563f},
-std::array<float,2>{0.0619984083f, 0.458385587f},
-std::array<float,2>{0.897509038f, 0.141070485f},
-std::array<float,2>{0.388115853f, 0.797155917f},
-std::array<float,2>{0.987830818f, 0.574907124f},
-std::array<float,2>{0.491721183f, 0.333852172f},
-std::array<float,2>{0.594456077f, 0.0987888798f},
-std::array<float,2>{0.0707318336f, 0.966073334f},
-std::array<float,2>{0.666751981f, 0.870931506f},
-std::array<float,2>{0.221933588f, 0.195566654f},
-std::array<float,2>{0.871667504f, 0.430893809f},
-std::array<float,2>{0.286738724f, 0.626010656f},
-std::array<float,2>{0.878183126f, 0.958181977f},
-std::array<float,2>{0.391252428f, 0.107689202f},
-std::array<float,2>{0.521000564f, 0.342925161f},
-std::array<float,2>{0.0352417417f, 0.566219032f},
-std::array<float,2>{0.72481221f, 0.635375857f},
-std::array<float,2>{0.176959604f, 0.429012477f},
-std::array<float,2>{0.800900161f, 0.19335933f},
-std::array<float,2>{0.36528331f, 0.861345053f},
-std::array<float,2>{0.850718558f, 0.506553113f},
-std::array<float,2>{0.302060902f, 0.269483328f},
-std::array<float,2>{0.677654445f, 0.0297650546f},
-std::array<float,2>{0.234886616f, 0.908809543f},
-std::array<float,2>{0.616053641f, 0.81184423f},
-std::array<float,2>{0.0853415728f, 0.155343622f},
-std::array<float,2>{0.976947546f, 0.463513017f},
-std::array<float,2>{0.470665485f, 0.708811522f},
-std::array<float,2>{0.763920844f, 0.824684083f},
-std::array<float,2>{0.333611399f, 0.235536247f},
-std::array<float,2>{0.712172508f, 0.387635976f},
-std::array<float,2>{0.149392173f, 0.682822764f},
-std::array<float,2>{0.55846715f, 0.597282887f},
-std::array<float,2>{0.0267565753f, 0.369196177f},
-std::array<float,2>{0.925125837f, 0.062868081f},
-std::array<float,2>{0.418319404f, 0.984481931f},
-std::array<float,2>{0.947167933f, 0.744139433f},
-std::array<float,2>{0.456436425f, 0.475896955f},
-std::array<float,2>{0.576124847f, 0.177446812f},
-std::array<float,2>{0.104641721f, 0.763952196f},
-std::array<float,2>{0.652823448f, 0.889133811f},
-std::array<float,2>{0.211261332f, 0.036533948f},
-std::array<float,2>{0.817204654f, 0.303041905f},
-std::array<float,2>{0.277986407f, 0.549967229f},
-std::array<float,2>{0.991088569f, 0.771560133f},
-std::array<float,2>{0.486711085f, 0.156763867f},
-std::array<float,2>{0.601379752f, 0.487643689f},
-std::array<float,2>{0.074872233f, 0.732376397f},
-std::array<float,2>{0.669454813f, 0.533840895f},
-std::array<float,2>{0.226530463f, 0.286907434f},
-std::array<float,2>{0.870738029f, 0.0616163015f},
-std::array<float,2>{0.284813821f, 0.895154715f},
-std::array<float,2>{0.792928696f, 0.661864638f},
-std::array<float,2>{0.358594745f, 0.393646926f},
-std::array<float,2>{0.743614674f, 0.227094024f},
-std::array<float,2>{0.159128532f, 0.843251348f},
-std::array<float,2>{0.513980806f, 0.976869106f},
-std::array<float,2>{0.0582359694f, 0.092976436f},
-std::array<float,2>{0.893633664f, 0.351159871f},
-std::array<float,2>{0.38583529f, 0.613267124f},
-std::array<float,2>{0.839104354f, 0.925879896f},
-std::array<float,2>{0.259728163f, 0.0101330252f},
-std::array<float,2>{0.639347315f, 0.256090343f},
-std::array<float,2>{0.193889976f, 0.521090209f},
-std::array<float,2>{0.578980803f, 0.690745175f},
-std::array<float,2>{0.118858464f, 0.443334907f},
-std::array<float,2>{0.960300684f, 0.129291207f},
-std::array<float,2>{0.44767952f, 0.781939387f},
-std::array<float,2>{0.916103244f, 0.582835555f},
-std::array<float,2>{0.428752333f, 0.320329458f},
-std::array<float,2>{0.53468895f, 0.124371834f},
-std::array<float,2>{0.00578210782f, 0.950841188f},
-std::array<float,2>{0.689785123f, 0.848716199f},
-std::array<float,2>{0.140622556f, 0.205984741f},
-std::array<float,2>{0.773629248f, 0.416853309f},
-std::array<float,2>{0.320729405f, 0.645130217f},
-std::array<float,2>{0.967059374f, 0.902524173f},
-std::array<float,2>{0.437877208f, 0.0479342565f},
-std::array<float,2>{0.590578139f, 0.29664886f},
-std::array<float,2>{0.110490903f, 0.546256244f},
-std::array<float,2>{0.630988181f, 0.725242138f},
-std::array<float,2>{0.200487956f, 0.49834609f},
-std::array<float,2>{0.831064463f, 0.169193193f},
-std::array<float,2>{0.25453788f, 0.779467702f},
-std::array<float,2>{0.771556735f, 0.622933507f},
-std::array<float,2>{0.318965226f, 0.354751408f},
-std::array<float,2>{0.70093596f, 0.0783152729f},
-std::array<float,2>{0.131285235f, 0.971405923f},
-std::array<float,2>{0.545567334f, 0.833543181f},
-std::array<float,2>{0.0107619064f, 0.225391001f},
-std::array<float,2>{0.911331892f, 0.398882121f},
-std::array<float,2>{0.434767455f, 0.665677488f},
-std::array<float,2>{0.86479336f, 0.78980732f},
-std::array<float,2>{0.293143481f, 0.134582087f},
-std::array<float,2>{0.659251332f, 0.451598406f},
-std::array<float,2>{0.227378353f, 0.699145198f},
-std::array<float,2>{0.606333256f, 0.525630474f},
-std::array<float,2>{0.0697294995f, 0.259389907f},
-std::array<float,2>{0.997065365f, 0.00585940294f},
-std::array<float,2>{0.499382645f, 0.934283018f},
-std::array<float,2>{0.904428899f, 0.655358493f},
-std::array<float,2>{0.378163189f, 0.406939417f},
-std::array<float,2>{0.506754518f, 0.215416357f},
-std::array<float,2>{0.0499023907f, 0.85576129f},
-std::array<float,2>{0.738897562f, 0.940337002f},
-std::array<float,2>{0.170085445f, 0.114081472f},
-std::array<float,2>{0.782531619f, 0.320108026f},
-std::array<float,2>{0.348386824f, 0.586523116f},
-std::array<float,2>{0.933417022f, 0.874247074f},
-std::array<float,2>{0.41159007f, 0.202051505f},
-std::array<float,2>{0.550127864f, 0.435880095f},
-std::array<float,2>{0.016734872f, 0.629316568f},
-std::array<float,2>{0.705604911f, 0.573242903f},
-std::array<float,2>{0.146849141f, 0.329719573f},
-std::array<float,2>{0.751078725f, 0.0956995264f},
-std::array<float,2>{0.338967979f, 0.962533653f},
-std::array<float,2>{0.823760509f, 0.711121798f},
-std::array<float,2>{0.269051999f, 0.453442603f},
-std::array<float,2>{0.645949543f, 0.147622272f},
-std::array<float,2>{0.210668087f, 0.803305745f},
-std::array<float,2>{0.56771189f, 0.919457316f},
-std::array<float,2>{0.100337394f, 0.0200857595f},
-std::array<float,2>{0.938586235f, 0.278155833f},
-std::array<float,2>{0.465917915f, 0.514175534f},
-std::array<float,2>{0.808477044f, 0.995386124f},
-std::array<float,2>{0.370794922f, 0.0716143772f},
-std::array<float,2>{0.732980311f, 0.366796911f},
-std::array<float,2>{0.184585363f, 0.604024708f},
-std::array<float,2>{0.529099584f, 0.671954036f},
-std::array<float,2>{0.0426392257f, 0.376618564f},
-std::array<float,2>{0.889754891f, 0.246511191f},
-std::array<float,2>{0.405511022f, 0.819726169f},
-std::array<float,2>{0.975978673f, 0.562137365f},
-std::array<float,2>{0.478926986f, 0.312104434f},
-std::array<float,2>{0.624586582f, 0.0415302813f},
-std::array<float,2>{0.0862271041f, 0.877400815f},
-std::array<float,2>{0.682157576f, 0.7536304f},
-std::array<float,2>{0.243027836f, 0.181184605f},
-std::array<float,2>{0.855992377f, 0.482008517f},
-std::array<float,2>{0.308066934f, 0.741168916f},
-std::array<float,2>{0.908813894f, 0.913695812f},
-std::array<float,2>{0.429863483f, 0.0256094113f},
-std::array<float,2>{0.540976107f, 0.27123794f},
-std::array<float,2>{0.0155256344f, 0.500157297f},
-std::array<float,2>{0.697011054f, 0.705825567f},
-std::array<float,2>{0.128683597f, 0.46681264f},
-std::array<float,2>{0.768404603f, 0.148651987f},
-std::array<float,2>{0.314621001f, 0.805980921f},
-std::array<float,2>{0.832815886f, 0.568909407f},
-std::array<float,2>{0.252350897f, 0.338996112f},
-std::array<float,2>{0.625576258f, 0.102756672f},
-std::array<float,2>{0.195628434f, 0.954268396f},
-std::array<float,2>{0.586506903f, 0.866265535f},
-std::array<float,2>{0.114262529f, 0.190458f},
-std::array<float,2>{0.96328491f, 0.421919227f},
-std::array<float,2>{0.441411495f, 0.640554547f},
-std::array<float,2>{0.788268805f, 0.759785652f},
-std::array<float,2>{0.347285509f, 0.173895761f},
-std::array<float,2>{0.735724866f, 0.469114989f},
-std::array<float,2>{0.164406642f, 0.747168899f},
-std::array<float,2>{0.50209409f, 0.553042948f},
-std::array<float,2>{0.0523149334f, 0.299058765f},
-std::array<float,2>{0.901723146f, 0.0344946906f},
-std::array<float,2>{0.381219268f, 0.88379842f},
-std::array<float,2>{0.993939221f, 0.684634745f},
-std::array<float,2>{0.494757593f, 0.386065364f},
-std::array<float,2>{0.605012357f, 0.241598874f},
-std::array<float,2>{0.0650372282f, 0.821112514f},
-std::array<float,2>{0.662074745f, 0.989882052f},
-std::array<float,2>{0.233376727f, 0.0685510784f},
-std::array<float,2>{0.860531449f, 0.374089003f},
-std::array<float,2>{0.290309519f, 0.600991488f},
-std::array<float,2>{0.944694698f, 0.837103724f},
-std::array<float,2>{0.462301433f, 0.230710536f},
-std::array<float,2>{0.565894246f, 0.397996455f},
-std::array<float,2>{0.0976123512f, 0.6589607f},
-std::array<float,2>{0.644083142f, 0.616416991f},
-std::array<float,2>{0.20394522f, 0.346122682f},
-std::array<float,2>{0.824820876f, 0.0864937901f},
-std::array<float,2>{0.270362765f, 0.984142125f},
-std::array<float,2>{0.75440526f, 0.728594065f},
-std::array<float,2>{0.340998769f, 0.488993555f},
-std::array<float,2>{0.707700551f, 0.161903545f},
-std::array<float,2>{0.142364606f, 0.765710533f},
-std::array<float,2>{0.551096261f, 0.892127931f},
-std::array<float,2>{0.0205158126f, 0.0560522638f},
-std::array<float,2>{0.936405301f, 0.282466829f},
-std::array<float,2>{0.408877045f, 0.538275003f},
-std::array<float,2>{0.852268755f, 0.945473015f},
-std::array<float,2>{0.310859084f, 0.119026415f},
-std::array<float,2>{0.685013652f, 0.326638401f},
-std::array<float,2>{0.24688679f, 0.578418612f},
-std::array<float,2>{0.618793488f, 0.64434433f},
-std::array<float,2>{0.0924008936f, 0.419442266f},
-std::array<float,2>{0.972311318f, 0.208198279f},
-std::array<float,2>{0.481182396f, 0.845037878f},
-std::array<float,2>{0.886078417f, 0.515717089f},
-std::array<float,2>{0.398838729f, 0.251663238f},
-std::array<float,2>{0.525283575f, 0.0137306917f},
-std::array<float,2>{0.0451742038f, 0.925378203f},
-std::array<float,2>{0.728800416f, 0.786710143f},
-std::array<float,2>{0.182171538f, 0.128896907f},
-std::array<float,2>{0.812230587f, 0.43799904f},
-std::array<float,2>{0.371924132f, 0.692220867f},
-std::array<float,2>{0.982738495f, 0.973923504f},
-std::array<float,2>{0.474713355f, 0.0823647156f},
-std::array<float,2>{0.610258698f, 0.357934624f},
-std::array<float,2>{0.0803954005f, 0.618165672f},
-std::array<float,2>{0.673549294f, 0.671072483f},
-std::array<float,2>{0.240387604f, 0.405536294f},
-std::array<float,2>{0.846709192f, 0.219294682f},
-std::array<float,2>{0.296982318f, 0.831017196f},
-std::array<float,2>{0.798247755f, 0.540697753f},
-std::array<float,2>{0.359622717f, 0.289945841f},
-std::array<float,2>{0.720839679f, 0.0508562475f},
-std::array<float,2>{0.173879102f, 0.898933649f},
-std::array<float,2>{0.517739117f, 0.775843322f},
-std::array<float,2>{0.0345067009f, 0.165784776f},
-std::array<float,2>{0.880998433f, 0.494378865f},
-std::array<float,2>{0.396584719f, 0.721736789f},
-std::array<float,2>{0.81429261f, 0.852532148f},
-std::array<float,2>{0.273749739f, 0.211078599f},
-std::array<float,2>{0.651465952f, 0.413446426f},
-std::array<float,2>{0.217701733f, 0.650013149f},
-std::array<float,2>{0.573076963f, 0.589991987f},
-std::array<float,2>{0.105984725f, 0.312909067f},
-std::array<float,2>{0.952225924f, 0.110903263f},
-std::array<float,2>{0.45708853f, 0.944026768f},
-std::array<float,2>{0.926779807f, 0.701149166f},
-std::array<float,2>{0.417349935f, 0.446034342f},
-std::array<float,2>{0.561775625f, 0.140022308f},
-std::array<float,2>{0.0301676113f, 0.79625988f},
-std::array<float,2>{0.716247201f, 0.931239903f},
-std::array<float,2>{0.153019845f, 0.000224695657f},
-std::array<float,2>{0.760120094f, 0.263067305f},
-std::array<float,2>{0.331438452f, 0.528520107f},
-std::array<float,2>{0.896303177f, 0.799962819f},
-std::array<float,2>{0.38987413f, 0.143822953f},
-std::array<float,2>{0.509770274f, 0.460424811f},
-std::array<float,2>{0.059443187f, 0.717536211f},
-std::array<float,2>{0.746942222f, 0.509415686f},
-std::array<float,2>{0.160498977f, 0.275519162f},
-std::array<float,2>{0.79392612f, 0.0179089978f},
-std::array<float,2>{0.354641587f, 0.914168298f},
-std::array<float,2>{0.873271465f, 0.628395796f},
-std::array<float,2>{0.28889963f, 0.43325758f},
-std::array<float,2>{0.666000068f, 0.197546899f},
-std::array<float,2>{0.220586464f, 0.868276179f},
-std::array<float,2>{0.596329391f, 0.968161225f},
-std::array<float,2>{0.0727872178f, 0.0997551233f},
-std::array<float,2>{0.985689938f, 0.335746557f},
-std::array<float,2>{0.489173383f, 0.577692866f},
-std::array<float,2>{0.780505896f, 0.88058567f},
-std::array<float,2>{0.328053027f, 0.0449421443f},
-std::array<float,2>{0.692464173f, 0.304863185f},
-std::array<float,2>{0.136322573f, 0.555688083f},
-std::array<float,2>{0.535420954f, 0.735947073f},
-std::array<float,2>{7.87182871e-05f, 0.47761938f},
-std::array<float,2>{0.919685662f, 0.184540227f},
-std::array<float,2>{0.42537719f, 0.756609917f},
-std::array<float,2>{0.954821646f, 0.605713546f},
-std::array<float,2>{0.45016098f, 0.362368524f},
-std::array<float,2>{0.585863054f, 0.0765613392f},
-std::array<float,2>{0.123063669f, 0.997092605f},
-std::array<float,2>{0.633573294f, 0.812979341f},
-std::array<float,2>{0.190911621f, 0.242915899f},
-std::array<float,2>{0.843721151f, 0.379013151f},
-std::array<float,2>{0.263010532f, 0.676447392f},
-std::array<float,2>{0.930721402f, 0.962217629f},
-std::array<float,2>{0.41257146f, 0.0949155688f},
-std::array<float,2>{0.547911227f, 0.329351723f},
-std::array<float,2>{0.0191782843f, 0.574152946f},
-std::array<float,2>{0.704468846f, 0.629415512f},
-std::array<float,2>{0.146032706f, 0.436272651f},
-std::array<float,2>{0.753772795f, 0.201403081f},
-std::array<float,2>{0.337401778f, 0.874786615f},
-std::array<float,2>{0.821481109f, 0.513912559f},
-std::array<float,2>{0.266628146f, 0.277811646f},
-std::array<float,2>{0.647571027f, 0.0198918954f},
-std::array<float,2>{0.20777829f, 0.919059813f},
-std::array<float,2>{0.56883359f, 0.802763999f},
-std::array<float,2>{0.0992057249f, 0.147986963f},
-std::array<float,2>{0.940809071f, 0.453821063f},
-std::array<float,2>{0.467879057f, 0.71186173f},
-std::array<float,2>{0.805094659f, 0.819910347f},
-std::array<float,2>{0.36803475f, 0.246815786f},
-std::array<float,2>{0.732356668f, 0.375982046f},
-std::array<float,2>{0.186427325f, 0.672634244f},
-std::array<float,2>{0.529551089f, 0.603739262f},
-std::array<float,2>{0.0399180502f, 0.366242409f},
-std::array<float,2>{0.886893094f, 0.0718550757f},
-std::array<float,2>{0.404002547f, 0.995884657f},
-std::array<float,2>{0.973757684f, 0.740533113f},
-std::array<float,2>{0.477711797f, 0.4816567f},
-std::array<float,2>{0.621640146f, 0.180748418f},
-std::array<float,2>{0.0888491794f, 0.753136635f},
-std::array<float,2>{0.680753112f, 0.877611876f},
-std::array<float,2>{0.244932532f, 0.0413981378f},
-std::array<float,2>{0.858187437f, 0.311572582f},
-std::array<float,2>{0.305248886f, 0.561862588f},
-std::array<float,2>{0.966107249f, 0.780036867f},
-std::array<float,2>{0.440573037f, 0.169676334f},
-std::array<float,2>{0.593275607f, 0.498583645f},
-std::array<float,2>{0.112340823f, 0.724993229f},
-std::array<float,2>{0.629046917f, 0.546513617f},
-std::array<float,2>{0.201432854f, 0.296049476f},
-std::array<float,2>{0.829118252f, 0.0485689268f},
-std::array<float,2>{0.255930305f, 0.902882457f},
-std::array<float,2>{0.770950735f, 0.665265381f},
-std::array<float,2>{0.316573083f, 0.399358332f},
-std::array<float,2>{0.701712191f, 0.225048363f},
-std::array<float,2>{0.130499542f, 0.83325094f},
-std::array<float,2>{0.544846594f, 0.970975518f},
-std::array<float,2>{0.00847567432f, 0.0787878036f},
-std::array<float,2>{0.912385702f, 0.355293632f},
-std::array<float,2>{0.436327964f, 0.622541964f},
-std::array<float,2>{0.866423905f, 0.933996737f},
-std::array<float,2>{0.296230763f, 0.006717104f},
-std::array<float,2>{0.657327473f, 0.258957088f},
-std::array<float,2>{0.22856833f, 0.526355922f},
-std::array<float,2>{0.608445346f, 0.698543072f},
-std::array<float,2>{0.0664564893f, 0.451757282f},
-std::array<float,2>{0.998287141f, 0.134060994f},
-std::array<float,2>{0.497717917f, 0.789355993f},
-std::array<float,2>{0.90338558f, 0.586289167f},
-std::array<float,2>{0.375777423f, 0.319716215f},
-std::array<float,2>{0.504218221f, 0.11376141f},
-std::array<float,2>{0.0483359545f, 0.939915895f},
-std::array<float,2>{0.741042197f, 0.856128931f},
-std::array<float,2>{0.16925928f, 0.215153873f},
-std::array<float,2>{0.78377521f, 0.406487226f},
-std::array<float,2>{0.349922031f, 0.656035364f},
-std::array<float,2>{0.989057064f, 0.894709647f},
-std::array<float,2>{0.48627013f, 0.0620223843f},
-std::array<float,2>{0.598985791f, 0.286379904f},
-std::array<float,2>{0.0768613294f, 0.533334017f},
-std::array<float,2>{0.670107841f, 0.731561422f},
-std::array<float,2>{0.222860634f, 0.488044351f},
-std::array<float,2>{0.868137658f, 0.156362593f},
-std::array<float,2>{0.28189683f, 0.772372007f},
-std::array<float,2>{0.789329827f, 0.612760544f},
-std::array<float,2>{0.35561353f, 0.350666404f},
-std::array<float,2>{0.744343221f, 0.0934990272f},
-std::array<float,2>{0.158015952f, 0.97751683f},
-std::array<float,2>{0.512728274f, 0.84341228f},
-std::array<float,2>{0.0566085018f, 0.2269945f},
-std::array<float,2>{0.890901983f, 0.394306809f},
-std::array<float,2>{0.383687258f, 0.66133678f},
-std::array<float,2>{0.836365998f, 0.781273663f},
-std::array<float,2>{0.260693848f, 0.129692003f},
-std::array<float,2>{0.637490451f, 0.442415863f},
-std::array<float,2>{0.192420095f, 0.691194355f},
-std::array<float,2>{0.581302822f, 0.52095902f},
-std::array<float,2>{0.120652616f, 0.25683549f},
-std::array<float,2>{0.958866656f, 0.0105242869f},
-std::array<float,2>{0.446877331f, 0.926757753f},
-std::array<float,2>{0.915771842f, 0.644994974f},
-std::array<float,2>{0.4263978f, 0.416026533f},
-std::array<float,2>{0.532350957f, 0.205138177f},
-std::array<float,2>{0.00770624774f, 0.849602044f},
-std::array<float,2>{0.689126968f, 0.950394809f},
-std::array<float,2>{0.138276488f, 0.124514058f},
-std::array<float,2>{0.777308464f, 0.320893973f},
-std::array<float,2>{0.323358923f, 0.582266867f},
-std::array<float,2>{0.876763701f, 0.862258852f},
-std::array<float,2>{0.394109428f, 0.192528725f},
-std::array<float,2>{0.522024751f, 0.429534078f},
-std::array<float,2>{0.0386345871f, 0.635146737f},
-std::array<float,2>{0.723620772f, 0.565778911f},
-std::array<float,2>{0.179685637f, 0.34349376f},
-std::array<float,2>{0.804118216f, 0.108005673f},
-std::array<float,2>{0.364110917f, 0.958982944f},
-std::array<float,2>{0.848151267f, 0.708295763f},
-std::array<float,2>{0.302797407f, 0.46292612f},
-std::array<float,2>{0.678462684f, 0.156163678f},
-std::array<float,2>{0.236687899f, 0.812313557f},
-std::array<float,2>{0.613339543f, 0.90826875f},
-std::array<float,2>{0.0831551179f, 0.0299531724f},
-std::array<float,2>{0.979501009f, 0.269018382f},
-std::array<float,2>{0.472010881f, 0.506070971f},
-std::array<float,2>{0.761843085f, 0.985043764f},
-std::array<float,2>{0.33400321f, 0.063284643f},
-std::array<float,2>{0.713556588f, 0.370021164f},
-std::array<float,2>{0.150876999f, 0.596957147f},
-std::array<float,2>{0.55488354f, 0.683212101f},
-std::array<float,2>{0.0235644653f, 0.387177557f},
-std::array<float,2>{0.922015309f, 0.236050949f},
-std::array<float,2>{0.42051959f, 0.825163603f},
-std::array<float,2>{0.948143184f, 0.550361335f},
-std::array<float,2>{0.454425335f, 0.303608418f},
-std::array<float,2>{0.577203035f, 0.036894571f},
-std::array<float,2>{0.102788918f, 0.889621794f},
-std::array<float,2>{0.654714882f, 0.764422417f},
-std::array<float,2>{0.213440195f, 0.177161679f},
-std::array<float,2>{0.81851989f, 0.476462066f},
-std::array<float,2>{0.280923247f, 0.74318558f},
-std::array<float,2>{0.898151219f, 0.914948523f},
-std::array<float,2>{0.388474137f, 0.0185309947f},
-std::array<float,2>{0.508465528f, 0.275981247f},
-std::array<float,2>{0.0621651299f, 0.509009957f},
-std::array<float,2>{0.749373496f, 0.716862857f},
-std::array<float,2>{0.162470922f, 0.460501879f},
-std::array<float,2>{0.796421885f, 0.144073814f},
-std::array<float,2>{0.352769345f, 0.800332725f},
-std::array<float,2>{0.871393859f, 0.577391684f},
-std::array<float,2>{0.286534965f, 0.335408956f},
-std::array<float,2>{0.66646117f, 0.100345612f},
-std::array<float,2>{0.222209349f, 0.968361259f},
-std::array<float,2>{0.594123542f, 0.868984759f},
-std::array<float,2>{0.0710432231f, 0.1980564f},
-std::array<float,2>{0.987678587f, 0.432795852f},
-std::array<float,2>{0.491660893f, 0.628832102f},
-std::array<float,2>{0.778436065f, 0.756009996f},
-std::array<float,2>{0.325622499f, 0.184026003f},
-std::array<float,2>{0.693476915f, 0.478386849f},
-std::array<float,2>{0.132863417f, 0.735561371f},
-std::array<float,2>{0.538090289f, 0.556334555f},
-std::array<float,2>{0.00369207817f, 0.305374742f},
-std::array<float,2>{0.920161843f, 0.0456029698f},
-std::array<float,2>{0.423543155f, 0.879981816f},
-std::array<float,2>{0.955899894f, 0.676115692f},
-std::array<float,2>{0.452222437f, 0.379840791f},
-std::array<float,2>{0.582769215f, 0.242313877f},
-std::array<float,2>{0.122062549f, 0.813262761f},
-std::array<float,2>{0.635014355f, 0.997838497f},
-std::array<float,2>{0.18784456f, 0.0770617798f},
-std::array<float,2>{0.840933025f, 0.362875909f},
-std::array<float,2>{0.264380306f, 0.606085539f},
-std::array<float,2>{0.980939269f, 0.830533326f},
-std::array<float,2>{0.474055558f, 0.218905672f},
-std::array<float,2>{0.612822533f, 0.406221747f},
-std::array<float,2>{0.0782214254f, 0.671594918f},
-std::array<float,2>{0.675467372f, 0.618957698f},
-std::array<float,2>{0.238809615f, 0.357775658f},
-std::array<float,2>{0.845322669f, 0.082668893f},
-std::array<float,2>{0.299269885f, 0.974231362f},
-std::array<float,2>{0.800708175f, 0.722472548f},
-std::array<float,2>{0.361973792f, 0.494726419f},
-std::array<float,2>{0.720557868f, 0.165239468f},
-std::array<float,2>{0.171882883f, 0.776239932f},
-std::array<float,2>{0.516989291f, 0.898755193f},
-std::array<float,2>{0.0317286588f, 0.0516135991f},
-std::array<float,2>{0.879030049f, 0.289106548f},
-std::array<float,2>{0.396044672f, 0.540242612f},
-std::array<float,2>{0.815141022f, 0.943621159f},
-std::array<float,2>{0.275902539f, 0.110667564f},
-std::array<float,2>{0.649894953f, 0.313127577f},
-std::array<float,2>{0.215316609f, 0.590546787f},
-std::array<float,2>{0.570547879f, 0.649717927f},
-std::array<float,2>{0.10824015f, 0.413593054f},
-std::array<float,2>{0.951022029f, 0.211682513f},
-std::array<float,2>{0.459620297f, 0.851822376f},
-std::array<float,2>{0.929172337f, 0.529196143f},
-std::array<float,2>{0.415697426f, 0.26362446f},
-std::array<float,2>{0.558986604f, 0.000840628345f},
-std::array<float,2>{0.0289213713f, 0.930848956f},
-std::array<float,2>{0.717460275f, 0.796491921f},
-std::array<float,2>{0.155205175f, 0.140533507f},
-std::array<float,2>{0.758140922f, 0.44540441f},
-std::array<float,2>{0.329800129f, 0.700216234f},
-std::array<float,2>{0.942087948f, 0.983866096f},
-std::array<float,2>{0.464149296f, 0.0859811082f},
-std::array<float,2>{0.562950552f, 0.346461773f},
-std::array<float,2>{0.0944186896f, 0.616933167f},
-std::array<float,2>{0.641513765f, 0.658377349f},
-std::array<float,2>{0.20666182f, 0.397632331f},
-std::array<float,2>{0.827188432f, 0.231041595f},
-std::array<float,2>{0.271960855f, 0.837736249f},
-std::array<float,2>{0.756782651f, 0.538763523f},
-std::array<float,2>{0.343247145f, 0.282956123f},
-std::array<float,2>{0.709328175f, 0.056502983f},
-std::array<float,2>{0.144114658f, 0.891907752f},
-std::array<float,2>{0.554395378f, 0.766222954f},
-std::array<float,2>{0.0227410328f, 0.161478624f},
-std::array<float,2>{0.934210777f, 0.488574266f},
-std::array<float,2>{0.407835633f, 0.729358196f},
-std::array<float,2>{0.854371846f, 0.845333159f},
-std::array<float,2>{0.309142649f, 0.208521441f},
-std::array<float,2>{0.687485933f, 0.419402897f},
-std::array<float,2>{0.249452591f, 0.643606246f},
-std::array<float,2>{0.619956195f, 0.578750134f},
-std::array<float,2>{0.0913843885f, 0.326757759f},
-std::array<float,2>{0.97008419f, 0.118514195f},
-std::array<float,2>{0.483005971f, 0.945925355f},
-std::array<float,2>{0.883138716f, 0.691413641f},
-std::array<float,2>{0.400838643f, 0.43761149f},
-std::array<float,2>{0.52619487f, 0.128033027f},
-std::array<float,2>{0.0448396765f, 0.786440432f},
-std::array<float,2>{0.727725208f, 0.925048649f},
-std::array<float,2>{0.180716664f, 0.0144727686f},
-std::array<float,2>{0.810106218f, 0.251439989f},
-std::array<float,2>{0.373733163f, 0.516141772f},
-std::array<float,2>{0.907171369f, 0.806360543f},
-std::array<float,2>{0.433110774f, 0.148981333f},
-std::array<float,2>{0.541652739f, 0.46763888f},
-std::array<float,2>{0.0130750136f, 0.705414712f},
-std::array<float,2>{0.697345197f, 0.500761509f},
-std::array<float,2>{0.125422239f, 0.270609528f},
-std::array<float,2>{0.76634866f, 0.0260109156f},
-std::array<float,2>{0.312746018f, 0.913317084f},
-std::array<float,2>{0.834801137f, 0.639973044f},
-std::array<float,2>{0.250421524f, 0.422845185f},
-std::array<float,2>{0.628296673f, 0.191320762f},
-std::array<float,2>{0.198505133f, 0.866802514f},
-std::array<float,2>{0.588947415f, 0.954607427f},
-std::array<float,2>{0.115431599f, 0.103395186f},
-std::array<float,2>{0.96254456f, 0.339821219f},
-std::array<float,2>{0.444146782f, 0.568617761f},
-std::array<float,2>{0.785732627f, 0.884480774f},
-std::array<float,2>{0.345471233f, 0.0347697213f},
-std::array<float,2>{0.738128483f, 0.299743116f},
-std::array<float,2>{0.167675853f, 0.553381741f},
-std::array<float,2>{0.50020659f, 0.747761428f},
-std::array<float,2>{0.0531694889f, 0.46940574f},
-std::array<float,2>{0.898639619f, 0.174731299f},
-std::array<float,2>{0.379580528f, 0.760403752f},
-std::array<float,2>{0.995124638f, 0.601340413f},
-std::array<float,2>{0.493339866f, 0.374754161f},
-std::array<float,2>{0.603492916f, 0.069140777f},
-std::array<float,2>{0.0644451007f, 0.989583671f},
-std::array<float,2>{0.662714243f, 0.820447624f},
-std::array<float,2>{0.231756732f, 0.241854951f},
-std::array<float,2>{0.862472355f, 0.386337548f},
-std::array<float,2>{0.291979611f, 0.68534857f},
-std::array<float,2>{0.890190482f, 0.992727697f},
-std::array<float,2>{0.406129152f, 0.0732883886f},
-std::array<float,2>{0.528767109f, 0.363821954f},
-std::array<float,2>{0.0422806107f, 0.60276562f},
-std::array<float,2>{0.732460141f, 0.675771594f},
-std::array<float,2>{0.185334623f, 0.378369331f},
-std::array<float,2>{0.807836652f, 0.248997524f},
-std::array<float,2>{0.370293081f, 0.816572726f},
-std::array<float,2>{0.855553389f, 0.558825135f},
-std::array<float,2>{0.308216959f, 0.308595836f},
-std::array<float,2>{0.681716323f, 0.0391303934f},
-std::array<float,2>{0.242385626f, 0.87586683f},
-std::array<float,2>{0.624362707f, 0.751040339f},
-std::array<float,2>{0.0868686065f, 0.182213053f},
-std::array<float,2>{0.976278305f, 0.483410388f},
-std::array<float,2>{0.479270667f, 0.739859939f},
-std::array<float,2>{0.751709282f, 0.872420609f},
-std::array<float,2>{0.339735508f, 0.200368702f},
-std::array<float,2>{0.705472231f, 0.434571207f},
-std::array<float,2>{0.147299796f, 0.631918192f},
-std::array<float,2>{0.55045557f, 0.571433902f},
-std::array<float,2>{0.0175732952f, 0.331486493f},
-std::array<float,2>{0.932782948f, 0.095869787f},
-std::array<float,2>{0.41170311f, 0.96339047f},
-std::array<float,2>{0.939071536f, 0.713948429f},
-std::array<float,2>{0.466664791f, 0.456273526f},
-std::array<float,2>{0.568170249f, 0.1461294f},
-std::array<float,2>{0.099883005f, 0.801709056f},
-std::array<float,2>{0.646443069f, 0.920653641f},
-std::array<float,2>{0.21001336f, 0.0233424176f},
-std::array<float,2>{0.823310316f, 0.280785322f},
-std::array<float,2>{0.268882096f, 0.511730015f},
-std::array<float,2>{0.996117175f, 0.792159677f},
-std::array<float,2>{0.499651849f, 0.136009619f},
-std::array<float,2>{0.605554163f, 0.450744182f},
-std::array<float,2>{0.0699273124f, 0.695759296f},
-std::array<float,2>{0.659931779f, 0.524288237f},
-std::array<float,2>{0.226715907f, 0.259809196f},
-std::array<float,2>{0.864317656f, 0.00511559844f},
-std::array<float,2>{0.293486536f, 0.936364412f},
-std::array<float,2>{0.783117235f, 0.654284298f},
-std::array<float,2>{0.348114878f, 0.409084827f},
-std::array<float,2>{0.738515615f, 0.217267975f},
-std::array<float,2>{0.170630291f, 0.857803464f},
-std::array<float,2>{0.506173968f, 0.938143671f},
-std::array<float,2>{0.050629288f, 0.115655318f},
-std::array<float,2>{0.904860973f, 0.317587793f},
-std::array<float,2>{0.378587037f, 0.588777483f},
-std::array<float,2>{0.831970394f, 0.904831588f},
-std::array<float,2>{0.254042864f, 0.0490211993f},
-std::array<float,2>{0.631392121f, 0.294733763f},
-std::array<float,2>{0.201040477f, 0.544258893f},
-std::array<float,2>{0.590025187f, 0.72327888f},
-std::array<float,2>{0.111281082f, 0.497294933f},
-std::array<float,2>{0.967652082f, 0.170066223f},
-std::array<float,2>{0.438254625f, 0.777385056f},
-std::array<float,2>{0.911959112f, 0.623117268f},
-std::array<float,2>{0.435274065f, 0.352573097f},
-std::array<float,2>{0.544935048f, 0.0811221749f},
-std::array<float,2>{0.0113562206f, 0.969416022f},
-std::array<float,2>{0.700653315f, 0.834753811f},
-std::array<float,2>{0.131383806f, 0.223724008f},
-std::array<float,2>{0.772459924f, 0.400576472f},
-std::array<float,2>{0.318439305f, 0.666709542f},
-std::array<float,2>{0.960528553f, 0.927739084f},
-std::array<float,2>{0.448029995f, 0.0094221374f},
-std::array<float,2>{0.578577697f, 0.255330503f},
-std::array<float,2>{0.118565619f, 0.523157716f},
-std::array<float,2>{0.638907433f, 0.687672913f},
-std::array<float,2>{0.193606526f, 0.443604141f},
-std::array<float,2>{0.839499712f, 0.131806538f},
-std::array<float,2>{0.258947104f, 0.785029709f},
-std::array<float,2>{0.774272025f, 0.584671378f},
-std::array<float,2>{0.32086578f, 0.322480261f},
-std::array<float,2>{0.689998031f, 0.121952549f},
-std::array<float,2>{0.140094057f, 0.952772439f},
-std::array<float,2>{0.534592509f, 0.851508558f},
-std::array<float,2>{0.00529338466f, 0.2035359f},
-std::array<float,2>{0.91667372f, 0.415975988f},
-std::array<float,2>{0.429457188f, 0.64717257f},
-std::array<float,2>{0.870150328f, 0.770847619f},
-std::array<float,2>{0.284239262f, 0.159422621f},
-std::array<float,2>{0.669058979f, 0.485052705f},
-std::array<float,2>{0.225986853f, 0.733263314f},
-std::array<float,2>{0.60097456f, 0.532600224f},
-std::array<float,2>{0.0744541883f, 0.28873989f},
-std::array<float,2>{0.990670621f, 0.0589435734f},
-std::array<float,2>{0.48687309f, 0.897668779f},
-std::array<float,2>{0.894167244f, 0.662258804f},
-std::array<float,2>{0.386485696f, 0.392104983f},
-std::array<float,2>{0.514197707f, 0.23034367f},
-std::array<float,2>{0.0577699356f, 0.841104627f},
-std::array<float,2>{0.743882358f, 0.979195893f},
-std::array<float,2>{0.158548743f, 0.0917730257f},
-std::array<float,2>{0.792235911f, 0.349376023f},
-std::array<float,2>{0.359374255f, 0.610580862f},
-std::array<float,2>{0.925386846f, 0.826840878f},
-std::array<float,2>{0.418562412f, 0.2367246f},
-std::array<float,2>{0.558078945f, 0.389890224f},
-std::array<float,2>{0.0269914307f, 0.679987848f},
-std::array<float,2>{0.712486684f, 0.595249951f},
-std::array<float,2>{0.14869912f, 0.368210077f},
-std::array<float,2>{0.76445049f, 0.0652242973f},
-std::array<float,2>{0.333437979f, 0.986596763f},
-std::array<float,2>{0.816881955f, 0.744685948f},
-std::array<float,2>{0.277444363f, 0.474053234f},
-std::array<float,2>{0.653316975f, 0.178232923f},
-std::array<float,2>{0.211518809f, 0.762652755f},
-std::array<float,2>{0.575389087f, 0.887844086f},
-std::array<float,2>{0.104997151f, 0.0383229442f},
-std::array<float,2>{0.946691573f, 0.301103473f},
-std::array<float,2>{0.456728041f, 0.547782838f},
-std::array<float,2>{0.801342785f, 0.95947355f},
-std::array<float,2>{0.36617285f, 0.106293999f},
-std::array<float,2>{0.72555691f, 0.34155935f},
-std::array<float,2>{0.177411601f, 0.563106298f},
-std::array<float,2>{0.520991623f, 0.633313477f},
-std::array<float,2>{0.036038924f, 0.427698135f},
-std::array<float,2>{0.878532708f, 0.194429785f},
-std::array<float,2>{0.391075224f, 0.859945297f},
-std::array<float,2>{0.977217257f, 0.505287886f},
-std::array<float,2>{0.469836295f, 0.266889423f},
-std::array<float,2>{0.615309238f, 0.0275234003f},
-std::array<float,2>{0.085506171f, 0.90811497f},
-std::array<float,2>{0.676984847f, 0.809247732f},
-std::array<float,2>{0.234551355f, 0.154283851f},
-std::array<float,2>{0.85118866f, 0.462463796f},
-std::array<float,2>{0.302339792f, 0.71056217f},
-std::array<float,2>{0.919174135f, 0.882078528f},
-std::array<float,2>{0.425269157f, 0.0438097268f},
-std::array<float,2>{0.535791218f, 0.308151513f},
-std::array<float,2>{0.000602727756f, 0.557362616f},
-std::array<float,2>{0.693144798f, 0.737913072f},
-std::array<float,2>{0.135790557f, 0.47949937f},
-std::array<float,2>{0.781216025f, 0.186659694f},
-std::array<float,2>{0.327159792f, 0.755852222f},
-std::array<float,2>{0.842933059f, 0.608782291f},
-std::array<float,2>{0.26342389f, 0.360626519f},
-std::array<float,2>{0.63290745f, 0.0751548707f},
-std::array<float,2>{0.191180289f, 0.999172688f},
-std::array<float,2>{0.584962368f, 0.814580321f},
-std::array<float,2>{0.123850428f, 0.244615197f},
-std::array<float,2>{0.95432198f, 0.382675499f},
-std::array<float,2>{0.449290425f, 0.678465009f},
-std::array<float,2>{0.79304105f, 0.797486722f},
-std::array<float,2>{0.355361402f, 0.141413242f},
-std::array<float,2>{0.746542215f, 0.458563447f},
-std::array<float,2>{0.161011204f, 0.715805054f},
-std::array<float,2>{0.510697246f, 0.51128149f},
-std::array<float,2>{0.0588749833f, 0.27493304f},
-std::array<float,2>{0.895988822f, 0.0167535897f},
-std::array<float,2>{0.390405178f, 0.916248918f},
-std::array<float,2>{0.985951364f, 0.626536012f},
-std::array<float,2>{0.488380402f, 0.431364089f},
-std::array<float,2>{0.596171677f, 0.196193382f},
-std::array<float,2>{0.0722661316f, 0.870188832f},
-std::array<float,2>{0.665525794f, 0.96670562f},
-std::array<float,2>{0.21976088f, 0.0994382203f},
-std::array<float,2>{0.87383914f, 0.333297163f},
-std::array<float,2>{0.288200676f, 0.57445097f},
-std::array<float,2>{0.952762723f, 0.855162621f},
-std::array<float,2>{0.457579017f, 0.213303581f},
-std::array<float,2>{0.57255429f, 0.411603361f},
-std::array<float,2>{0.105859168f, 0.651854873f},
-std::array<float,2>{0.652180195f, 0.591890097f},
-std::array<float,2>{0.217014432f, 0.316130519f},
-std::array<float,2>{0.813810527f, 0.113079868f},
-std::array<float,2>{0.27421695f, 0.941946626f},
-std::array<float,2>{0.760608613f, 0.702763021f},
-std::array<float,2>{0.331702441f, 0.449035168f},
-std::array<float,2>{0.716459811f, 0.138521463f},
-std::array<float,2>{0.152542353f, 0.793453574f},
-std::array<float,2>{0.562305748f, 0.931661069f},
-std::array<float,2>{0.0294094868f, 0.00301627908f},
-std::array<float,2>{0.927405238f, 0.265535563f},
-std::array<float,2>{0.417785436f, 0.529662788f},
-std::array<float,2>{0.847523451f, 0.976411104f},
-std::array<float,2>{0.297531456f, 0.0848370343f},
-std::array<float,2>{0.672942221f, 0.356599987f},
-std::array<float,2>{0.24120675f, 0.619798005f},
-std::array<float,2>{0.609416962f, 0.669861913f},
-std::array<float,2>{0.0810017362f, 0.403306127f},
-std::array<float,2>{0.983316302f, 0.222024351f},
-std::array<float,2>{0.475507766f, 0.828485191f},
-std::array<float,2>{0.881355762f, 0.541253567f},
-std::array<float,2>{0.397057503f, 0.292190582f},
-std::array<float,2>{0.518501818f, 0.0538475886f},
-std::array<float,2>{0.0350441076f, 0.900835216f},
-std::array<float,2>{0.721648574f, 0.774342358f},
-std::array<float,2>{0.174616814f, 0.166803524f},
-std::array<float,2>{0.798443794f, 0.492564261f},
-std::array<float,2>{0.360012531f, 0.720511019f},
-std::array<float,2>{0.972050846f, 0.948465109f},
-std::array<float,2>{0.4806346f, 0.120733343f},
-std::array<float,2>{0.61831063f, 0.325420499f},
-std::array<float,2>{0.0921552405f, 0.581628382f},
-std::array<float,2>{0.685161591f, 0.641607285f},
-std::array<float,2>{0.246185139f, 0.421514452f},
-std::array<float,2>{0.851862133f, 0.209919766f},
-std::array<float,2>{0.311502576f, 0.845733523f},
-std::array<float,2>{0.811850548f, 0.517628789f},
-std::array<float,2>{0.371578515f, 0.25237909f},
-std::array<float,2>{0.72932446f, 0.0121363932f},
-std::array<float,2>{0.181723684f, 0.921954274f},
-std::array<float,2>{0.524562836f, 0.788139939f},
-std::array<float,2>{0.0457417704f, 0.125058174f},
-std::array<float,2>{0.886233568f, 0.440804839f},
-std::array<float,2>{0.399101526f, 0.694927394f},
-std::array<float,2>{0.824298978f, 0.838388264f},
-std::array<float,2>{0.269580513f, 0.2342069f},
-std::array<float,2>{0.643736422f, 0.395148605f},
-std::array<float,2>{0.203462109f, 0.656527638f},
-std::array<float,2>{0.566307724f, 0.613919497f},
-std::array<float,2>{0.0971348956f, 0.345167071f},
-std::array<float,2>{0.945304036f, 0.0891246274f},
-std::array<float,2>{0.462424099f, 0.980507791f},
-std::array<float,2>{0.935729444f, 0.728336096f},
-std::array<float,2>{0.408453435f, 0.490885496f},
-std::array<float,2>{0.551673651f, 0.162930682f},
-std::array<float,2>{0.0210153814f, 0.768804669f},
-std::array<float,2>{0.707380652f, 0.892639995f},
-std::array<float,2>{0.141743422f, 0.0574615821f},
-std::array<float,2>{0.754151821f, 0.284739703f},
-std::array<float,2>{0.341373891f, 0.535434723f},
-std::array<float,2>{0.901991427f, 0.758333981f},
-std::array<float,2>{0.381577641f, 0.173676088f},
-std::array<float,2>{0.502775669f, 0.472637117f},
-std::array<float,2>{0.0518540256f, 0.749981225f},
-std::array<float,2>{0.735884249f, 0.551781476f},
-std::array<float,2>{0.164612919f, 0.298352242f},
-std::array<float,2>{0.788734019f, 0.0315911286f},
-std::array<float,2>{0.346728027f, 0.886516631f},
-std::array<float,2>{0.861065626f, 0.687344611f},
-std::array<float,2>{0.290544659f, 0.384466648f},
-std::array<float,2>{0.661600053f, 0.239355385f},
-std::array<float,2>{0.232773766f, 0.823663294f},
-std::array<float,2>{0.604596734f, 0.99089992f},
-std::array<float,2>{0.0647633076f, 0.068170473f},
-std::array<float,2>{0.993332088f, 0.37214309f},
-std::array<float,2>{0.494317949f, 0.598735273f},
-std::array<float,2>{0.767971396f, 0.911745548f},
-std::array<float,2>{0.31541115f, 0.0253628511f},
-std::array<float,2>{0.696510613f, 0.272201896f},
-std::array<float,2>{0.12831755f, 0.502065778f},
-std::array<float,2>{0.54043889f, 0.703761578f},
-std::array<float,2>{0.0148157123f, 0.465863496f},
-std::array<float,2>{0.908417404f, 0.151547402f},
-std::array<float,2>{0.430263281f, 0.807202935f},
-std::array<float,2>{0.963781893f, 0.566686094f},
-std::array<float,2>{0.442006797f, 0.336044997f},
-std::array<float,2>{0.586376667f, 0.104862064f},
-std::array<float,2>{0.114810325f, 0.955155313f},
-std::array<float,2>{0.625026941f, 0.863741398f},
-std::array<float,2>{0.196080238f, 0.188801736f},
-std::array<float,2>{0.832038045f, 0.424592465f},
-std::array<float,2>{0.252928227f, 0.638251185f},
-std::array<float,2>{0.913560748f, 0.970078945f},
-std::array<float,2>{0.437240958f, 0.0809957981f},
-std::array<float,2>{0.543361366f, 0.352363527f},
-std::array<float,2>{0.00937480107f, 0.624568701f},
-std::array<float,2>{0.70252192f, 0.667906463f},
-std::array<float,2>{0.128946707f, 0.401694477f},
-std::array<float,2>{0.770098269f, 0.222939283f},
-std::array<float,2>{0.317937076f, 0.835916758f},
-std::array<float,2>{0.828819513f, 0.543411434f},
-std::array<float,2>{0.257701606f, 0.293060154f},
-std::array<float,2>{0.630556226f, 0.0501709059f},
-std::array<float,2>{0.20268859f, 0.905814767f},
-std::array<float,2>{0.592746794f, 0.778656244f},
-std::array<float,2>{0.111796826f, 0.171662718f},
-std::array<float,2>{0.965367496f, 0.496950209f},
-std::array<float,2>{0.439694822f, 0.724510193f},
-std::array<float,2>{0.784379184f, 0.859373689f},
-std::array<float,2>{0.351252586f, 0.218630731f},
-std::array<float,2>{0.741290629f, 0.409929067f},
-std::array<float,2>{0.168484747f, 0.652765989f},
-std::array<float,2>{0.505187213f, 0.589714825f},
-std::array<float,2>{0.0471857376f, 0.316969335f},
-std::array<float,2>{0.9027403f, 0.116553456f},
-std::array<float,2>{0.376490027f, 0.938726068f},
-std::array<float,2>{0.999825358f, 0.696592033f},
-std::array<float,2>{0.496985704f, 0.449763566f},
-std::array<float,2>{0.607815564f, 0.135252088f},
-std::array<float,2>{0.0683027282f, 0.791852176f},
-std::array<float,2>{0.656489193f, 0.937437952f},
-std::array<float,2>{0.230399981f, 0.00473284768f},
-std::array<float,2>{0.865481377f, 0.261308402f},
-std::array<float,2>{0.295764089f, 0.524905324f},
-std::array<float,2>{0.93950069f, 0.802730858f},
-std::array<float,2>{0.467318892f, 0.145042434f},
-std::array<float,2>{0.570271134f, 0.455407083f},
-std::array<float,2>{0.0978350788f, 0.713275909f},
-std::array<float,2>{0.646714687f, 0.513243616f},
-std::array<float,2>{0.208476499f, 0.279975235f},
-std::array<float,2>{0.82103622f, 0.0215397179f},
-std::array<float,2>{0.265969157f, 0.921302915f},
-std::array<float,2>{0.752134681f, 0.631519437f},
-std::array<float,2>{0.33668384f, 0.433648646f},
-std::array<float,2>{0.703325093f, 0.199981079f},
-std::array<float,2>{0.14466919f, 0.871817231f},
-std::array<float,2>{0.547459781f, 0.964038253f},
-std::array<float,2>{0.0177214909f, 0.0971506909f},
-std::array<float,2>{0.930477142f, 0.331014425f},
-std::array<float,2>{0.413201034f, 0.571257472f},
-std::array<float,2>{0.858831465f, 0.876226544f},
-std::array<float,2>{0.306109399f, 0.0409140587f},
-std::array<float,2>{0.679958344f, 0.309934139f},
-std::array<float,2>{0.245440215f, 0.559874535f},
-std::array<float,2>{0.622601628f, 0.73890245f},
-std::array<float,2>{0.089745447f, 0.482977986f},
-std::array<float,2>{0.973591089f, 0.18313697f},
-std::array<float,2>{0.477202982f, 0.750310957f},
-std::array<float,2>{0.888262808f, 0.601704419f},
-std::array<float,2>{0.402972996f, 0.364797652f},
-std::array<float,2>{0.530816972f, 0.0731947348f},
-std::array<float,2>{0.0404303111f, 0.993888199f},
-std::array<float,2>{0.730771601f, 0.817933023f},
-std::array<float,2>{0.187271416f, 0.249870166f},
-std::array<float,2>{0.805776834f, 0.377567559f},
-std::array<float,2>{0.368736297f, 0.674586594f},
-std::array<float,2>{0.979440928f, 0.906387329f},
-std::array<float,2>{0.470773846f, 0.0290617347f},
-std::array<float,2>{0.615044415f, 0.266173035f},
-std::array<float,2>{0.0820472836f, 0.504824042f},
-std::array<float,2>{0.678730249f, 0.70972836f},
-std::array<float,2>{0.238224015f, 0.46106708f},
-std::array<float,2>{0.849159062f, 0.152820468f},
-std::array<float,2>{0.303758919f, 0.809793353f},
-std::array<float,2>{0.803530693f, 0.564265311f},
-std::array<float,2>{0.364638746f, 0.340737522f},
-std::array<float,2>{0.72381705f, 0.10721758f},
-std::array<float,2>{0.178520247f, 0.960242331f},
-std::array<float,2>{0.522900879f, 0.860402882f},
-std::array<float,2>{0.0374279134f, 0.193908662f},
-std::array<float,2>{0.875053465f, 0.426068306f},
-std::array<float,2>{0.393242657f, 0.633795738f},
-std::array<float,2>{0.820128024f, 0.762882411f},
-std::array<float,2>{0.27946052f, 0.17900908f},
-std::array<float,2>{0.655421317f, 0.47331804f},
-std::array<float,2>{0.214785814f, 0.745585144f},
-std::array<float,2>{0.577019811f, 0.548737764f},
-std::array<float,2>{0.101803191f, 0.301847517f},
-std::array<float,2>{0.94891113f, 0.0374118537f},
-std::array<float,2>{0.453911394f, 0.887061954f},
-std::array<float,2>{0.923022568f, 0.680885315f},
-std::array<float,2>{0.421298355f, 0.389184803f},
-std::array<float,2>{0.556183636f, 0.238254786f},
-std::array<float,2>{0.0247354023f, 0.82772541f},
-std::array<float,2>{0.714292705f, 0.988280475f},
-std::array<float,2>{0.151909173f, 0.06619066f},
-std::array<float,2>{0.763590932f, 0.368119001f},
-std::array<float,2>{0.335427195f, 0.594128251f},
-std::array<float,2>{0.892406762f, 0.840744436f},
-std::array<float,2>{0.383959621f, 0.22939156f},
-std::array<float,2>{0.511879325f, 0.390750557f},
-std::array<float,2>{0.0556135178f, 0.66378653f},
-std::array<float,2>{0.745844305f, 0.609654188f},
-std::array<float,2>{0.15708451f, 0.348068833f},
-std::array<float,2>{0.790100276f, 0.0899630263f},
-std::array<float,2>{0.356902122f, 0.980411589f},
-std::array<float,2>{0.868462384f, 0.734025598f},
-std::array<float,2>{0.282761484f, 0.486249804f},
-std::array<float,2>{0.671624243f, 0.158600658f},
-std::array<float,2>{0.223869339f, 0.770329773f},
-std::array<float,2>{0.597918391f, 0.89708966f},
-std::array<float,2>{0.0775647163f, 0.0596112423f},
-std::array<float,2>{0.989633739f, 0.287674069f},
-std::array<float,2>{0.485044718f, 0.53219831f},
-std::array<float,2>{0.77631712f, 0.951827168f},
-std::array<float,2>{0.322890043f, 0.122539513f},
-std::array<float,2>{0.68767947f, 0.323296756f},
-std::array<float,2>{0.137446925f, 0.585008681f},
-std::array<float,2>{0.531548798f, 0.647660255f},
-std::array<float,2>{0.00671257917f, 0.414359838f},
-std::array<float,2>{0.914065301f, 0.204703256f},
-std::array<float,2>{0.427221209f, 0.85018158f},
-std::array<float,2>{0.957856536f, 0.522186458f},
-std::array<float,2>{0.445806205f, 0.25423044f},
-std::array<float,2>{0.58089143f, 0.00831103884f},
-std::array<float,2>{0.119806141f, 0.929627001f},
-std::array<float,2>{0.637762368f, 0.784121454f},
-std::array<float,2>{0.192044809f, 0.132727981f},
-std::array<float,2>{0.837460577f, 0.445159286f},
-std::array<float,2>{0.261086285f, 0.689397454f},
-std::array<float,2>{0.880174994f, 0.902148485f},
-std::array<float,2>{0.395274311f, 0.0532113053f},
-std::array<float,2>{0.515794873f, 0.291435808f},
-std::array<float,2>{0.0325920507f, 0.542351186f},
-std::array<float,2>{0.719213009f, 0.719329059f},
-std::array<float,2>{0.173027009f, 0.493756592f},
-std::array<float,2>{0.799253702f, 0.167497918f},
-std::array<float,2>{0.363035262f, 0.774456024f},
-std::array<float,2>{0.844712853f, 0.62027514f},
-std::array<float,2>{0.300271809f, 0.356428623f},
-std::array<float,2>{0.674399912f, 0.0854921415f},
-std::array<float,2>{0.239842579f, 0.975274444f},
-std::array<float,2>{0.611500263f, 0.829423189f},
-std::array<float,2>{0.0793664381f, 0.221015722f},
-std::array<float,2>{0.981817842f, 0.403841257f},
-std::array<float,2>{0.473228067f, 0.668558896f},
-std::array<float,2>{0.758923113f, 0.794203699f},
-std::array<float,2>{0.328876525f, 0.137232646f},
-std::array<float,2>{0.71810019f, 0.448213398f},
-std::array<float,2>{0.155645862f, 0.701547623f},
-std::array<float,2>{0.560056746f, 0.530883312f},
-std::array<float,2>{0.0275320671f, 0.263864547f},
-std::array<float,2>{0.928679824f, 0.00263210223f},
-std::array<float,2>{0.414989203f, 0.93297869f},
-std::array<float,2>{0.950073183f, 0.651032984f},
-std::array<float,2>{0.460697114f, 0.410837978f},
-std::array<float,2>{0.571523607f, 0.214057162f},
-std::array<float,2>{0.108791083f, 0.853949547f},
-std::array<float,2>{0.648626328f, 0.942645729f},
-std::array<float,2>{0.216524363f, 0.111675806f},
-std::array<float,2>{0.816395402f, 0.314985633f},
-std::array<float,2>{0.276505589f, 0.593749225f},
-std::array<float,2>{0.986594141f, 0.869325399f},
-std::array<float,2>{0.490243554f, 0.196421638f},
-std::array<float,2>{0.594972849f, 0.429884046f},
-std::array<float,2>{0.0713531971f, 0.625834942f},
-std::array<float,2>{0.667044818f, 0.575733364f},
-std::array<float,2>{0.221344844f, 0.332809269f},
-std::array<float,2>{0.87288779f, 0.0979507267f},
-std::array<float,2>{0.285763085f, 0.965263605f},
-std::array<float,2>{0.795676291f, 0.71643579f},
-std::array<float,2>{0.352088273f, 0.457556963f},
-std::array<float,2>{0.748471379f, 0.141645297f},
-std::array<float,2>{0.163722277f, 0.798099875f},
-std::array<float,2>{0.508920431f, 0.917961717f},
-std::array<float,2>{0.0610936768f, 0.0157560669f},
-std::array<float,2>{0.896849751f, 0.273570389f},
-std::array<float,2>{0.387442023f, 0.51060015f},
-std::array<float,2>{0.839978933f, 0.998826146f},
-std::array<float,2>{0.26496923f, 0.0758999139f},
-std::array<float,2>{0.636088192f, 0.359447688f},
-std::array<float,2>{0.189277455f, 0.607979953f},
-std::array<float,2>{0.583049178f, 0.679432273f},
-std::array<float,2>{0.122900069f, 0.381461471f},
-std::array<float,2>{0.95631969f, 0.24565585f},
-std::array<float,2>{0.452055365f, 0.815884769f},
-std::array<float,2>{0.921283007f, 0.558114588f},
-std::array<float,2>{0.422744483f, 0.307081908f},
-std::array<float,2>{0.537884891f, 0.0441169739f},
-std::array<float,2>{0.00278331945f, 0.88171804f},
-std::array<float,2>{0.694367945f, 0.754104853f},
-std::array<float,2>{0.134213284f, 0.185991049f},
-std::array<float,2>{0.777724147f, 0.479294747f},
-std::array<float,2>{0.324528098f, 0.736558974f},
-std::array<float,2>{0.961805463f, 0.956445992f},
-std::array<float,2>{0.444837034f, 0.104091249f},
-std::array<float,2>{0.588051438f, 0.337390304f},
-std::array<float,2>{0.116989158f, 0.568035662f},
-std::array<float,2>{0.627741575f, 0.637488961f},
-std::array<float,2>{0.19770138f, 0.425147206f},
-std::array<float,2>{0.835523069f, 0.187605321f},
-std::array<float,2>{0.251935333f, 0.865143955f},
-std::array<float,2>{0.767438591f, 0.503662467f},
-std::array<float,2>{0.31368193f, 0.273043633f},
-std::array<float,2>{0.698930085f, 0.0238948278f},
-std::array<float,2>{0.12682946f, 0.910798609f},
-std::array<float,2>{0.542659104f, 0.808141649f},
-std::array<float,2>{0.0123013668f, 0.151173845f},
-std::array<float,2>{0.907343924f, 0.465790033f},
-std::array<float,2>{0.432194084f, 0.704488397f},
-std::array<float,2>{0.862162113f, 0.82303977f},
-std::array<float,2>{0.292961299f, 0.23916091f},
-std::array<float,2>{0.663309574f, 0.382930458f},
-std::array<float,2>{0.231044263f, 0.685968339f},
-std::array<float,2>{0.60248512f, 0.597751737f},
-std::array<float,2>{0.0632739142f, 0.372060418f},
-std::array<float,2>{0.994594097f, 0.0668756366f},
-std::array<float,2>{0.492441058f, 0.992034435f},
-std::array<float,2>{0.899659812f, 0.74887836f},
-std::array<float,2>{0.380526513f, 0.470955163f},
-std::array<float,2>{0.501280904f, 0.171875224f},
-std::array<float,2>{0.0542832166f, 0.759320974f},
-std::array<float,2>{0.736763f, 0.885018349f},
-std::array<float,2>{0.166852355f, 0.0325645804f},
-std::array<float,2>{0.786964655f, 0.296986997f},
-std::array<float,2>{0.344003618f, 0.55082792f},
-std::array<float,2>{0.934570968f, 0.768416047f},
-std::array<float,2>{0.40719837f, 0.163450539f},
-std::array<float,2>{0.553364277f, 0.491835982f},
-std::array<float,2>{0.0218903199f, 0.726907074f},
-std::array<float,2>{0.710429609f, 0.536878824f},
-std::array<float,2>{0.143292844f, 0.283572912f},
-std::array<float,2>{0.757171035f, 0.0582076423f},
-std::array<float,2>{0.342544705f, 0.893711627f},
-std::array<float,2>{0.826336801f, 0.657471955f},
-std::array<float,2>{0.272825211f, 0.396056175f},
-std::array<float,2>{0.642577887f, 0.23255749f},
-std::array<float,2>{0.205397755f, 0.839289546f},
-std::array<float,2>{0.563853383f, 0.981993616f},
-std::array<float,2>{0.0953102037f, 0.0879895613f},
-std::array<float,2>{0.942415059f, 0.344061524f},
-std::array<float,2>{0.463468403f, 0.615152836f},
-std::array<float,2>{0.809057295f, 0.923709214f},
-std::array<float,2>{0.374256343f, 0.0127886729f},
-std::array<float,2>{0.727196097f, 0.253305227f},
-std::array<float,2>{0.179783285f, 0.51945436f},
-std::array<float,2>{0.527305126f, 0.693375707f},
-std::array<float,2>{0.0438938178f, 0.440085262f},
-std::array<float,2>{0.884569526f, 0.126808956f},
-std::array<float,2>{0.401902199f, 0.788063347f},
-std::array<float,2>{0.968984127f, 0.580108285f},
-std::array<float,2>{0.483965307f, 0.324787378f},
-std::array<float,2>{0.620364666f, 0.119549058f},
-std::array<float,2>{0.0907809585f, 0.948192179f},
-std::array<float,2>{0.685584128f, 0.847464979f},
-std::array<float,2>{0.248373434f, 0.210186332f},
-std::array<float,2>{0.855211318f, 0.420081496f},
-std::array<float,2>{0.310432136f, 0.64143604f},
-std::array<float,2>{0.905948758f, 0.941167891f},
-std::array<float,2>{0.37715736f, 0.115228325f},
-std::array<float,2>{0.50708133f, 0.318366587f},
-std::array<float,2>{0.0490676649f, 0.587353766f},
-std::array<float,2>{0.739626646f, 0.654798388f},
-std::array<float,2>{0.171169773f, 0.407309562f},
-std::array<float,2>{0.781460345f, 0.215955272f},
-std::array<float,2>{0.348711431f, 0.857201993f},
-std::array<float,2>{0.863697767f, 0.526606381f},
-std::array<float,2>{0.294014245f, 0.258192062f},
-std::array<float,2>{0.659053683f, 0.00690591335f},
-std::array<float,2>{0.22781007f, 0.934767246f},
-std::array<float,2>{0.606839836f, 0.791005075f},
-std::array<float,2>{0.0683641285f, 0.133530706f},
-std::array<float,2>{0.997519851f, 0.452208102f},
-std::array<float,2>{0.498213708f, 0.69821322f},
-std::array<float,2>{0.772891641f, 0.832390487f},
-std::array<float,2>{0.319690496f, 0.226304993f},
-std::array<float,2>{0.699758232f, 0.400261581f},
-std::array<float,2>{0.132220536f, 0.664746046f},
-std::array<float,2>{0.545959055f, 0.621957958f},
-std::array<float,2>{0.010532381f, 0.353643209f},
-std::array<float,2>{0.910739839f, 0.0795303434f},
-std::array<float,2>{0.433899939f, 0.972367227f},
-std::array<float,2>{0.96842593f, 0.725861847f},
-std::array<float,2>{0.439294726f, 0.499938309f},
-std::array<float,2>{0.591616213f, 0.168903887f},
-std::array<float,2>{0.10984309f, 0.780436873f},
-std::array<float,2>{0.632318318f, 0.904025733f},
-std::array<float,2>{0.199863672f, 0.0474378914f},
-std::array<float,2>{0.830466151f, 0.295039475f},
-std::array<float,2>{0.25553301f, 0.544933081f},
-std::array<float,2>{0.974766076f, 0.752443135f},
-std::array<float,2>{0.480401754f, 0.179996774f},
-std::array<float,2>{0.623844922f, 0.480894178f},
-std::array<float,2>{0.0869199559f, 0.741227448f},
-std::array<float,2>{0.683514416f, 0.560859442f},
-std::array<float,2>{0.243408024f, 0.311040491f},
-std::array<float,2>{0.856749892f, 0.0427912399f},
-std::array<float,2>{0.307063818f, 0.878396869f},
-std::array<float,2>{0.807607472f, 0.673804164f},
-std::array<float,2>{0.369912028f, 0.37573871f},
-std::array<float,2>{0.733712435f, 0.247608885f},
-std::array<float,2>{0.184067324f, 0.818519354f},
-std::array<float,2>{0.527813137f, 0.994610071f},
-std::array<float,2>{0.0411104895f, 0.0704157725f},
-std::array<float,2>{0.889211535f, 0.365523368f},
-std::array<float,2>{0.405035347f, 0.605129778f},
-std::array<float,2>{0.822783291f, 0.918933213f},
-std::array<float,2>{0.268012881f, 0.0213435348f},
-std::array<float,2>{0.645008564f, 0.278562486f},
-std::array<float,2>{0.208994329f, 0.514776409f},
-std::array<float,2>{0.567373812f, 0.712152123f},
-std::array<float,2>{0.101320311f, 0.454822451f},
-std::array<float,2>{0.938356698f, 0.147243366f},
-std::array<float,2>{0.465229183f, 0.804331005f},
-std::array<float,2>{0.932326078f, 0.572787642f},
-std::array<float,2>{0.410776079f, 0.328744501f},
-std::array<float,2>{0.548977852f, 0.0946072489f},
-std::array<float,2>{0.016255701f, 0.961090565f},
-std::array<float,2>{0.706131279f, 0.873816311f},
-std::array<float,2>{0.148188323f, 0.202852264f},
-std::array<float,2>{0.750187635f, 0.43672955f},
-std::array<float,2>{0.338050485f, 0.630417883f},
-std::array<float,2>{0.945375085f, 0.889887094f},
-std::array<float,2>{0.455462635f, 0.0355549641f},
-std::array<float,2>{0.57480669f, 0.304071426f},
-std::array<float,2>{0.1035804f, 0.549682856f},
-std::array<float,2>{0.653416812f, 0.742355883f},
-std::array<float,2>{0.212136075f, 0.474611789f},
-std::array<float,2>{0.817929626f, 0.176186562f},
-std::array<float,2>{0.278697938f, 0.764717996f},
-std::array<float,2>{0.765442073f, 0.595873475f},
-std::array<float,2>{0.332608014f, 0.370178312f},
-std::array<float,2>{0.711057067f, 0.0642188042f},
-std::array<float,2>{0.149641529f, 0.985381007f},
-std::array<float,2>{0.557323396f, 0.825362146f},
-std::array<float,2>{0.0261427257f, 0.234620258f},
-std::array<float,2>{0.924694479f, 0.387863189f},
-std::array<float,2>{0.419447929f, 0.682469845f},
-std::array<float,2>{0.849847376f, 0.811334312f},
-std::array<float,2>{0.301287323f, 0.154850036f},
-std::array<float,2>{0.676152766f, 0.463997543f},
-std::array<float,2>{0.23537451f, 0.707053602f},
-std::array<float,2>{0.617011249f, 0.507645726f},
-std::array<float,2>{0.0842256397f, 0.267863095f},
-std::array<float,2>{0.978123248f, 0.0306328591f},
-std::array<float,2>{0.469339639f, 0.91013062f},
-std::array<float,2>{0.877779245f, 0.636013389f},
-std::array<float,2>{0.391967952f, 0.42819488f},
-std::array<float,2>{0.520260572f, 0.19174929f},
-std::array<float,2>{0.0365995318f, 0.863001883f},
-std::array<float,2>{0.726345539f, 0.957068205f},
-std::array<float,2>{0.176630229f, 0.108655602f},
-std::array<float,2>{0.802432179f, 0.34259364f},
-std::array<float,2>{0.366957814f, 0.565362692f},
-std::array<float,2>{0.917434037f, 0.848098814f},
-std::array<float,2>{0.427761048f, 0.206593856f},
-std::array<float,2>{0.533869684f, 0.417374253f},
-std::array<float,2>{0.00446731644f, 0.645795047f},
-std::array<float,2>{0.690631926f, 0.583978713f},
-std::array<float,2>{0.138785809f, 0.321534038f},
-std::array<float,2>{0.77472806f, 0.123558708f},
-std::array<float,2>{0.321894944f, 0.949997008f},
-std::array<float,2>{0.838257968f, 0.689919591f},
-std::array<float,2>{0.25840646f, 0.441540003f},
-std::array<float,2>{0.640530825f, 0.130527481f},
-std::array<float,2>{0.195122376f, 0.782403111f},
-std::array<float,2>{0.579119265f, 0.926989436f},
-std::array<float,2>{0.117942408f, 0.0110440552f},
-std::array<float,2>{0.959525406f, 0.257759392f},
-std::array<float,2>{0.44852975f, 0.519922376f},
-std::array<float,2>{0.791290879f, 0.978300571f},
-std::array<float,2>{0.35817343f, 0.0923296735f},
-std::array<float,2>{0.742391467f, 0.349618137f},
-std::array<float,2>{0.1601322f, 0.612013698f},
-std::array<float,2>{0.514728963f, 0.661015451f},
-std::array<float,2>{0.0569941625f, 0.392876834f},
-std::array<float,2>{0.893497884f, 0.228498921f},
-std::array<float,2>{0.385686666f, 0.842758477f},
-std::array<float,2>{0.991612554f, 0.534280062f},
-std::array<float,2>{0.487638175f, 0.285874933f},
-std::array<float,2>{0.600155115f, 0.0614979528f},
-std::array<float,2>{0.0760434344f, 0.896226227f},
-std::array<float,2>{0.668421388f, 0.772492468f},
-std::array<float,2>{0.225576267f, 0.157542348f},
-std::array<float,2>{0.869324446f, 0.486828089f},
-std::array<float,2>{0.283419043f, 0.7308864f},
-std::array<float,2>{0.926199079f, 0.93040204f},
-std::array<float,2>{0.416219175f, 0.00140573212f},
-std::array<float,2>{0.561299503f, 0.262599796f},
-std::array<float,2>{0.0302867815f, 0.528187573f},
-std::array<float,2>{0.715754628f, 0.699512601f},
-std::array<float,2>{0.153896302f, 0.446477771f},
-std::array<float,2>{0.761128962f, 0.139146924f},
-std::array<float,2>{0.330412865f, 0.795817792f},
-std::array<float,2>{0.81321305f, 0.591504514f},
-std::array<float,2>{0.274500489f, 0.314069808f},
-std::array<float,2>{0.65135771f, 0.109965004f},
-std::array<float,2>{0.218459204f, 0.945083261f},
-std::array<float,2>{0.573827565f, 0.85280472f},
-std::array<float,2>{0.106521152f, 0.212211967f},
-std::array<float,2>{0.951858044f, 0.412578523f},
-std::array<float,2>{0.458108097f, 0.648768663f},
-std::array<float,2>{0.797121108f, 0.77709645f},
-std::array<float,2>{0.360526025f, 0.164893553f},
-std::array<float,2>{0.722578526f, 0.496030271f},
-std::array<float,2>{0.175534084f, 0.721264601f},
-std::array<float,2>{0.518891037f, 0.539439499f},
-std::array<float,2>{0.0335827246f, 0.290479809f},
-std::array<float,2>{0.881852269f, 0.0523113571f},
-std::array<float,2>{0.398157209f, 0.900001824f},
-std::array<float,2>{0.984354317f, 0.670855403f},
-std::array<float,2>{0.476343066f, 0.405136734f},
-std::array<float,2>{0.610753298f, 0.22041516f},
-std::array<float,2>{0.0812675208f, 0.831681073f},
-std::array<float,2>{0.672814667f, 0.973551929f},
-std::array<float,2>{0.241839379f, 0.0831544995f},
-std::array<float,2>{0.845770717f, 0.358610719f},
-std::array<float,2>{0.298380524f, 0.618079662f},
-std::array<float,2>{0.953939676f, 0.813594043f},
-std::array<float,2>{0.451108724f, 0.243248478f},
-std::array<float,2>{0.584236681f, 0.380225867f},
-std::array<float,2>{0.12410631f, 0.676977813f},
-std::array<float,2>{0.63432467f, 0.606884956f},
-std::array<float,2>{0.190234378f, 0.36203745f},
-std::array<float,2>{0.842435718f, 0.0774527192f},
-std::array<float,2>{0.262096822f, 0.996535897f},
-std::array<float,2>{0.780112803f, 0.734814823f},
-std::array<float,2>{0.326910764f, 0.477444142f},
-std::array<float,2>{0.692259371f, 0.184870586f},
-std::array<float,2>{0.135679156f, 0.757072031f},
-std::array<float,2>{0.536437571f, 0.879597306f},
-std::array<float,2>{0.00167763256f, 0.0460535996f},
-std::array<float,2>{0.918049574f, 0.305696279f},
-std::array<float,2>{0.424435258f, 0.554700077f},
-std::array<float,2>{0.874758899f, 0.967487156f},
-std::array<float,2>{0.287962556f, 0.101060793f},
-std::array<float,2>{0.664857805f, 0.334439784f},
-std::array<float,2>{0.219348729f, 0.577024758f},
-std::array<float,2>{0.596851826f, 0.627726555f},
-std::array<float,2>{0.0740021318f, 0.432535261f},
-std::array<float,2>{0.984558761f, 0.199042752f},
-std::array<float,2>{0.490198582f, 0.867718399f},
-std::array<float,2>{0.895119786f, 0.507983685f},
-std::array<float,2>{0.389145821f, 0.277259886f},
-std::array<float,2>{0.511717081f, 0.0188150201f},
-std::array<float,2>{0.0598986149f, 0.915937066f},
-std::array<float,2>{0.747546852f, 0.799726248f},
-std::array<float,2>{0.161596268f, 0.14273265f},
-std::array<float,2>{0.794648945f, 0.459039271f},
-std::array<float,2>{0.35446319f, 0.718586862f},
-std::array<float,2>{0.992887974f, 0.988458693f},
-std::array<float,2>{0.496013999f, 0.0700195059f},
-std::array<float,2>{0.603920698f, 0.373804778f},
-std::array<float,2>{0.065641664f, 0.599689603f},
-std::array<float,2>{0.660529137f, 0.683754385f},
-std::array<float,2>{0.233694032f, 0.385174066f},
-std::array<float,2>{0.859683156f, 0.240595981f},
-std::array<float,2>{0.289257944f, 0.822129965f},
-std::array<float,2>{0.787839651f, 0.554414809f},
-std::array<float,2>{0.34587732f, 0.300073057f},
-std::array<float,2>{0.735249221f, 0.0337860398f},
-std::array<float,2>{0.165684715f, 0.883083045f},
-std::array<float,2>{0.503250062f, 0.76095885f},
-std::array<float,2>{0.0516932607f, 0.174876839f},
-std::array<float,2>{0.900788784f, 0.469732225f},
-std::array<float,2>{0.382580608f, 0.746376634f},
-std::array<float,2>{0.833014727f, 0.865843952f},
-std::array<float,2>{0.252943963f, 0.189817801f},
-std::array<float,2>{0.626588762f, 0.423236698f},
-std::array<float,2>{0.197093502f, 0.639545679f},
-std::array<float,2>{0.58754617f, 0.569770932f},
-std::array<float,2>{0.113968365f, 0.338384479f},
-std::array<float,2>{0.964225352f, 0.101685978f},
-std::array<float,2>{0.442835629f, 0.953905582f},
-std::array<float,2>{0.909276128f, 0.706226289f},
-std::array<float,2>{0.431057125f, 0.46792841f},
-std::array<float,2>{0.539804578f, 0.149441659f},
-std::array<float,2>{0.0144948093f, 0.80474472f},
-std::array<float,2>{0.695616841f, 0.912491918f},
-std::array<float,2>{0.127549484f, 0.026704153f},
-std::array<float,2>{0.768579543f, 0.269796461f},
-std::array<float,2>{0.315810949f, 0.501141012f},
-std::array<float,2>{0.885240018f, 0.785346091f},
-std::array<float,2>{0.399897397f, 0.127415076f},
-std::array<float,2>{0.524338961f, 0.439129114f},
-std::array<float,2>{0.0465556011f, 0.693349302f},
-std::array<float,2>{0.729844749f, 0.51678741f},
-std::array<float,2>{0.183577374f, 0.250348568f},
-std::array<float,2>{0.811346114f, 0.0154129118f},
-std::array<float,2>{0.372837514f, 0.92384547f},
-std::array<float,2>{0.853392005f, 0.642612219f},
-std::array<float,2>{0.311631143f, 0.418940634f},
-std::array<float,2>{0.683810294f, 0.207575575f},
-std::array<float,2>{0.247222558f, 0.844312608f},
-std::array<float,2>{0.617899299f, 0.946697354f},
-std::array<float,2>{0.0933306739f, 0.117532603f},
-std::array<float,2>{0.971215725f, 0.32755962f},
-std::array<float,2>{0.481530249f, 0.579269528f},
-std::array<float,2>{0.75489831f, 0.891013026f},
-std::array<float,2>{0.339893997f, 0.0554980226f},
-std::array<float,2>{0.708290219f, 0.28134498f},
-std::array<float,2>{0.140872657f, 0.537237048f},
-std::array<float,2>{0.551939666f, 0.730240881f},
-std::array<float,2>{0.0198726822f, 0.489718199f},
-std::array<float,2>{0.936781049f, 0.160662413f},
-std::array<float,2>{0.409825057f, 0.767513275f},
-std::array<float,2>{0.943570793f, 0.61612761f},
-std::array<float,2>{0.461063206f, 0.347550005f},
-std::array<float,2>{0.564620614f, 0.0871965438f},
-std::array<float,2>{0.0966576189f, 0.982581556f},
-std::array<float,2>{0.643516898f, 0.836416125f},
-std::array<float,2>{0.204345077f, 0.232078239f},
-std::array<float,2>{0.825390339f, 0.397346288f},
-std::array<float,2>{0.271069586f, 0.659482956f}}
\ No newline at end of file
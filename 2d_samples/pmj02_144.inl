@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.372117341f, 0.165244848f},
-std::array<float,2>{0.626266778f, 0.961071432f},
-std::array<float,2>{0.0813398436f, 0.669402182f},
-std::array<float,2>{0.982902586f, 0.277531415f},
-std::array<float,2>{0.149799109f, 0.376240253f},
-std::array<float,2>{0.856478214f, 0.513552606f},
-std::array<float,2>{0.431955338f, 0.794068754f},
-std::array<float,2>{0.525101721f, 0.0119700059f},
-std::array<float,2>{0.477357566f, 0.368889362f},
-std::array<float,2>{0.565294683f, 0.690884054f},
-std::array<float,2>{0.194717586f, 0.875397682f},
-std::array<float,2>{0.810780883f, 0.227301419f},
-std::array<float,2>{0.0168337468f, 0.0826863721f},
-std::array<float,2>{0.935171723f, 0.85326761f},
-std::array<float,2>{0.26387617f, 0.603950799f},
-std::array<float,2>{0.746141553f, 0.491387576f},
-std::array<float,2>{0.38666591f, 0.0321088843f},
-std::array<float,2>{0.56074363f, 0.773011088f},
-std::array<float,2>{0.160652488f, 0.549619973f},
-std::array<float,2>{0.814632595f, 0.435363024f},
-std::array<float,2>{0.100739606f, 0.297031224f},
-std::array<float,2>{0.959082603f, 0.642368555f},
-std::array<float,2>{0.316729873f, 0.982514024f},
-std::array<float,2>{0.680915833f, 0.145835996f},
-std::array<float,2>{0.303360075f, 0.449391216f},
-std::array<float,2>{0.704428792f, 0.575665832f},
-std::array<float,2>{0.0489633679f, 0.823231339f},
-std::array<float,2>{0.890617967f, 0.10760273f},
-std::array<float,2>{0.235066116f, 0.189229324f},
-std::array<float,2>{0.774317145f, 0.927908838f},
-std::array<float,2>{0.460200131f, 0.722173393f},
-std::array<float,2>{0.59698689f, 0.335179985f},
-std::array<float,2>{0.452115893f, 0.248696148f},
-std::array<float,2>{0.616957784f, 0.895224273f},
-std::array<float,2>{0.221922174f, 0.710479081f},
-std::array<float,2>{0.755017757f, 0.343825161f},
-std::array<float,2>{0.0431698523f, 0.476976365f},
-std::array<float,2>{0.905569196f, 0.621138215f},
-std::array<float,2>{0.286244482f, 0.859546781f},
-std::array<float,2>{0.689591289f, 0.0755723342f},
-std::array<float,2>{0.340013802f, 0.263397813f},
-std::array<float,2>{0.669647634f, 0.678771138f},
-std::array<float,2>{0.124615736f, 0.950442612f},
-std::array<float,2>{0.938898683f, 0.182832226f},
-std::array<float,2>{0.174237058f, 0.018252695f},
-std::array<float,2>{0.832243562f, 0.811323941f},
-std::array<float,2>{0.392601132f, 0.530692101f},
-std::array<float,2>{0.53887552f, 0.399843454f},
-std::array<float,2>{0.26743865f, 0.124686144f},
-std::array<float,2>{0.728711009f, 0.841314077f},
-std::array<float,2>{0.0144164842f, 0.592628777f},
-std::array<float,2>{0.915622354f, 0.460684359f},
-std::array<float,2>{0.207360581f, 0.319664121f},
-std::array<float,2>{0.789705932f, 0.745668113f},
-std::array<float,2>{0.499663889f, 0.913248301f},
-std::array<float,2>{0.590736568f, 0.213237077f},
-std::array<float,2>{0.415959597f, 0.415296942f},
-std::array<float,2>{0.515278339f, 0.535431266f},
-std::array<float,2>{0.131271079f, 0.750930488f},
-std::array<float,2>{0.861423314f, 0.0580674857f},
-std::array<float,2>{0.0688585117f, 0.136996001f},
-std::array<float,2>{0.995295227f, 0.994541883f},
-std::array<float,2>{0.352138042f, 0.633759797f},
-std::array<float,2>{0.643722773f, 0.296654016f},
-std::array<float,2>{0.290415764f, 0.207478225f},
-std::array<float,2>{0.702746332f, 0.914404988f},
-std::array<float,2>{0.0335184745f, 0.736541212f},
-std::array<float,2>{0.896696687f, 0.322492361f},
-std::array<float,2>{0.226736143f, 0.463514835f},
-std::array<float,2>{0.759757102f, 0.581109583f},
-std::array<float,2>{0.438504666f, 0.828426659f},
-std::array<float,2>{0.618226826f, 0.112408467f},
-std::array<float,2>{0.40364483f, 0.281473994f},
-std::array<float,2>{0.546588004f, 0.62666738f},
-std::array<float,2>{0.180694833f, 0.990240395f},
-std::array<float,2>{0.8408553f, 0.129433483f},
-std::array<float,2>{0.114001974f, 0.0516222268f},
-std::array<float,2>{0.951777756f, 0.761021495f},
-std::array<float,2>{0.331502467f, 0.545549512f},
-std::array<float,2>{0.66212666f, 0.408116788f},
-std::array<float,2>{0.48681435f, 0.0655620471f},
-std::array<float,2>{0.578958333f, 0.870070636f},
-std::array<float,2>{0.217711091f, 0.616339147f},
-std::array<float,2>{0.784756124f, 0.47572279f},
-std::array<float,2>{0.00612459099f, 0.356675774f},
-std::array<float,2>{0.911951959f, 0.718628109f},
-std::array<float,2>{0.277730346f, 0.904159725f},
-std::array<float,2>{0.724608421f, 0.23681514f},
-std::array<float,2>{0.346769035f, 0.396636099f},
-std::array<float,2>{0.651286781f, 0.515861273f},
-std::array<float,2>{0.0703134537f, 0.798177302f},
-std::array<float,2>{0.985186219f, 0.0259361751f},
-std::array<float,2>{0.137911484f, 0.17448923f},
-std::array<float,2>{0.869961858f, 0.943124235f},
-std::array<float,2>{0.410229057f, 0.682398438f},
-std::array<float,2>{0.500372171f, 0.253779233f},
-std::array<float,2>{0.422483712f, 0.152913615f},
-std::array<float,2>{0.519267738f, 0.972503364f},
-std::array<float,2>{0.146869987f, 0.652295589f},
-std::array<float,2>{0.845695734f, 0.309101373f},
-std::array<float,2>{0.088844195f, 0.427060395f},
-std::array<float,2>{0.971384287f, 0.557064235f},
-std::array<float,2>{0.365752041f, 0.777713358f},
-std::array<float,2>{0.635136843f, 0.0437196344f},
-std::array<float,2>{0.252681404f, 0.34210372f},
-std::array<float,2>{0.735669017f, 0.731655717f},
-std::array<float,2>{0.0278602615f, 0.933716774f},
-std::array<float,2>{0.927536428f, 0.200485781f},
-std::array<float,2>{0.200294286f, 0.10080985f},
-std::array<float,2>{0.799262047f, 0.81302774f},
-std::array<float,2>{0.471023381f, 0.56855619f},
-std::array<float,2>{0.57192719f, 0.4443551f},
-std::array<float,2>{0.321276426f, 0.00225301506f},
-std::array<float,2>{0.677573621f, 0.783204556f},
-std::array<float,2>{0.107391156f, 0.504882753f},
-std::array<float,2>{0.966108203f, 0.389108121f},
-std::array<float,2>{0.171508342f, 0.267871141f},
-std::array<float,2>{0.827159762f, 0.660524726f},
-std::array<float,2>{0.375006706f, 0.958219945f},
-std::array<float,2>{0.547015071f, 0.162425488f},
-std::array<float,2>{0.46731016f, 0.493547887f},
-std::array<float,2>{0.602720857f, 0.595888436f},
-std::array<float,2>{0.24998872f, 0.848507643f},
-std::array<float,2>{0.771224439f, 0.0913105458f},
-std::array<float,2>{0.0552953482f, 0.222154826f},
-std::array<float,2>{0.881441295f, 0.885566473f},
-std::array<float,2>{0.307298243f, 0.695395529f},
-std::array<float,2>{0.717587113f, 0.366955936f},
-std::array<float,2>{0.33300674f, 0.230596393f},
-std::array<float,2>{0.659226894f, 0.879422128f},
-std::array<float,2>{0.111553624f, 0.693696141f},
-std::array<float,2>{0.945339501f, 0.371819794f},
-std::array<float,2>{0.18728359f, 0.48711729f},
-std::array<float,2>{0.836380661f, 0.60608995f},
-std::array<float,2>{0.399346828f, 0.857261837f},
-std::array<float,2>{0.541749418f, 0.0794551373f},
-std::array<float,2>{0.444050997f, 0.277197123f},
-std::array<float,2>{0.621170223f, 0.666315556f},
-std::array<float,2>{0.232685238f, 0.968347549f},
-std::array<float,2>{0.763561904f, 0.167969078f},
-std::array<float,2>{0.0377758034f, 0.0107879797f},
-std::array<float,2>{0.891465127f, 0.792135537f},
-std::array<float,2>{0.295250446f, 0.508612096f},
-std::array<float,2>{0.697170079f, 0.381910831f},
-std::array<float,2>{0.408334464f, 0.104254499f},
-std::array<float,2>{0.507373095f, 0.827378392f},
-std::array<float,2>{0.133473039f, 0.573623002f},
-std::array<float,2>{0.872946322f, 0.446593493f},
-std::array<float,2>{0.0768796578f, 0.328905582f},
-std::array<float,2>{0.98855418f, 0.725616813f},
-std::array<float,2>{0.351338595f, 0.92534256f},
-std::array<float,2>{0.655946195f, 0.191767395f},
-std::array<float,2>{0.27459082f, 0.431925237f},
-std::array<float,2>{0.720382094f, 0.552568853f},
-std::array<float,2>{0.000832609949f, 0.76683569f},
-std::array<float,2>{0.908915162f, 0.0353654213f},
-std::array<float,2>{0.213644654f, 0.142236829f},
-std::array<float,2>{0.786367714f, 0.980298817f},
-std::array<float,2>{0.489489675f, 0.645341933f},
-std::array<float,2>{0.58575207f, 0.30432272f},
-std::array<float,2>{0.474115729f, 0.185563549f},
-std::array<float,2>{0.574323475f, 0.947482526f},
-std::array<float,2>{0.196538016f, 0.672345221f},
-std::array<float,2>{0.802781105f, 0.259779871f},
-std::array<float,2>{0.0263302103f, 0.403618693f},
-std::array<float,2>{0.92218411f, 0.526827097f},
-std::array<float,2>{0.256059736f, 0.807024777f},
-std::array<float,2>{0.740020633f, 0.0218173135f},
-std::array<float,2>{0.362564623f, 0.351293206f},
-std::array<float,2>{0.636753261f, 0.705966175f},
-std::array<float,2>{0.0924905837f, 0.892817497f},
-std::array<float,2>{0.97331953f, 0.245970637f},
-std::array<float,2>{0.144496799f, 0.0727537647f},
-std::array<float,2>{0.850191534f, 0.865379333f},
-std::array<float,2>{0.428655863f, 0.619902074f},
-std::array<float,2>{0.523183823f, 0.484373361f},
-std::array<float,2>{0.312304944f, 0.0623324402f},
-std::array<float,2>{0.712913096f, 0.757433355f},
-std::array<float,2>{0.0616157018f, 0.534001052f},
-std::array<float,2>{0.878876626f, 0.418804199f},
-std::array<float,2>{0.244702876f, 0.289090365f},
-std::array<float,2>{0.76794529f, 0.637814999f},
-std::array<float,2>{0.461296141f, 0.996546328f},
-std::array<float,2>{0.607860148f, 0.134412602f},
-std::array<float,2>{0.379525989f, 0.453170419f},
-std::array<float,2>{0.551677287f, 0.58947289f},
-std::array<float,2>{0.166125566f, 0.8386783f},
-std::array<float,2>{0.821320117f, 0.118500963f},
-std::array<float,2>{0.103499196f, 0.215244904f},
-std::array<float,2>{0.964588404f, 0.907833636f},
-std::array<float,2>{0.324569762f, 0.747154295f},
-std::array<float,2>{0.674810529f, 0.314423084f},
-std::array<float,2>{0.260157824f, 0.128687784f},
-std::array<float,2>{0.745556712f, 0.984864712f},
-std::array<float,2>{0.0196178947f, 0.630199552f},
-std::array<float,2>{0.932435155f, 0.286639541f},
-std::array<float,2>{0.189575374f, 0.411352277f},
-std::array<float,2>{0.807406604f, 0.539972186f},
-std::array<float,2>{0.48290208f, 0.765374362f},
-std::array<float,2>{0.569859326f, 0.0486802347f},
-std::array<float,2>{0.43580085f, 0.327816069f},
-std::array<float,2>{0.530471444f, 0.741150141f},
-std::array<float,2>{0.155354396f, 0.918160021f},
-std::array<float,2>{0.852536201f, 0.204339385f},
-std::array<float,2>{0.084193401f, 0.115393832f},
-std::array<float,2>{0.980241477f, 0.835512102f},
-std::array<float,2>{0.369345993f, 0.583203554f},
-std::array<float,2>{0.630258262f, 0.466427118f},
-std::array<float,2>{0.455754757f, 0.0312301405f},
-std::array<float,2>{0.599079669f, 0.80263406f},
-std::array<float,2>{0.241432592f, 0.521279335f},
-std::array<float,2>{0.779475868f, 0.391965002f},
-std::array<float,2>{0.0525361784f, 0.253952771f},
-std::array<float,2>{0.884996474f, 0.68367517f},
-std::array<float,2>{0.299353421f, 0.941282153f},
-std::array<float,2>{0.71077019f, 0.176265985f},
-std::array<float,2>{0.315377504f, 0.470776558f},
-std::array<float,2>{0.685152769f, 0.611490905f},
-std::array<float,2>{0.0945775732f, 0.873080909f},
-std::array<float,2>{0.953279495f, 0.0698393583f},
-std::array<float,2>{0.156637013f, 0.241482094f},
-std::array<float,2>{0.818746567f, 0.902301431f},
-std::array<float,2>{0.389378041f, 0.712547481f},
-std::array<float,2>{0.556505859f, 0.353884399f},
-std::array<float,2>{0.396128953f, 0.197303087f},
-std::array<float,2>{0.531511128f, 0.930670917f},
-std::array<float,2>{0.178497359f, 0.727729082f},
-std::array<float,2>{0.831494987f, 0.339076102f},
-std::array<float,2>{0.11760103f, 0.439115733f},
-std::array<float,2>{0.942675054f, 0.562558353f},
-std::array<float,2>{0.338343859f, 0.818511426f},
-std::array<float,2>{0.66623801f, 0.096422039f},
-std::array<float,2>{0.281392485f, 0.306369334f},
-std::array<float,2>{0.692367315f, 0.656084001f},
-std::array<float,2>{0.0407416783f, 0.973776937f},
-std::array<float,2>{0.899551868f, 0.148523986f},
-std::array<float,2>{0.224231765f, 0.0423953123f},
-std::array<float,2>{0.751149297f, 0.774610937f},
-std::array<float,2>{0.447176576f, 0.561122835f},
-std::array<float,2>{0.612901807f, 0.425706744f},
-std::array<float,2>{0.357931435f, 0.0875421315f},
-std::array<float,2>{0.647733867f, 0.846777856f},
-std::array<float,2>{0.062587589f, 0.599295616f},
-std::array<float,2>{0.997374415f, 0.496565104f},
-std::array<float,2>{0.127717704f, 0.363037705f},
-std::array<float,2>{0.86501056f, 0.700993061f},
-std::array<float,2>{0.419970691f, 0.887971878f},
-std::array<float,2>{0.509691954f, 0.22538133f},
-std::array<float,2>{0.493054241f, 0.383269906f},
-std::array<float,2>{0.587706625f, 0.503225088f},
-std::array<float,2>{0.203334063f, 0.786417961f},
-std::array<float,2>{0.79529798f, 0.00569141936f},
-std::array<float,2>{0.011567086f, 0.158207983f},
-std::array<float,2>{0.919562638f, 0.956958115f},
-std::array<float,2>{0.270657897f, 0.657923639f},
-std::array<float,2>{0.732349694f, 0.271803528f},
-std::array<float,2>{0.31912902f, 0.148180768f},
-std::array<float,2>{0.68326062f, 0.98067987f},
-std::array<float,2>{0.098527208f, 0.642832935f},
-std::array<float,2>{0.957759738f, 0.298961282f},
-std::array<float,2>{0.162477389f, 0.436186254f},
-std::array<float,2>{0.812563062f, 0.547934234f},
-std::array<float,2>{0.384232283f, 0.770961285f},
-std::array<float,2>{0.560396552f, 0.034337759f},
-std::array<float,2>{0.458726764f, 0.333146632f},
-std::array<float,2>{0.593987584f, 0.719310641f},
-std::array<float,2>{0.236951187f, 0.926601052f},
-std::array<float,2>{0.776453018f, 0.189611644f},
-std::array<float,2>{0.047802113f, 0.106886536f},
-std::array<float,2>{0.887248158f, 0.821807742f},
-std::array<float,2>{0.301852405f, 0.57764852f},
-std::array<float,2>{0.706967115f, 0.452721894f},
-std::array<float,2>{0.430497289f, 0.0138838459f},
-std::array<float,2>{0.526698828f, 0.796475947f},
-std::array<float,2>{0.150760502f, 0.515074849f},
-std::array<float,2>{0.859197378f, 0.378564f},
-std::array<float,2>{0.0790173039f, 0.280143112f},
-std::array<float,2>{0.980671525f, 0.670440495f},
-std::array<float,2>{0.374812305f, 0.963232994f},
-std::array<float,2>{0.627467096f, 0.166923046f},
-std::array<float,2>{0.262299985f, 0.490046233f},
-std::array<float,2>{0.749593019f, 0.601623952f},
-std::array<float,2>{0.0176645741f, 0.8544873f},
-std::array<float,2>{0.935917914f, 0.0845734254f},
-std::array<float,2>{0.191611975f, 0.229089797f},
-std::array<float,2>{0.810320616f, 0.878862023f},
-std::array<float,2>{0.480248123f, 0.68805939f},
-std::array<float,2>{0.564048052f, 0.371032596f},
-std::array<float,2>{0.497489423f, 0.211433768f},
-std::array<float,2>{0.592562199f, 0.911325395f},
-std::array<float,2>{0.210038707f, 0.742485881f},
-std::array<float,2>{0.791887462f, 0.318072498f},
-std::array<float,2>{0.0122018363f, 0.457398474f},
-std::array<float,2>{0.917696238f, 0.591557622f},
-std::array<float,2>{0.268326908f, 0.843204081f},
-std::array<float,2>{0.727664292f, 0.12141069f},
-std::array<float,2>{0.353817523f, 0.294805974f},
-std::array<float,2>{0.640703619f, 0.635335445f},
-std::array<float,2>{0.0674215406f, 0.993238568f},
-std::array<float,2>{0.992213845f, 0.139657229f},
-std::array<float,2>{0.129909188f, 0.0552431643f},
-std::array<float,2>{0.860603452f, 0.752215564f},
-std::array<float,2>{0.41697669f, 0.537686467f},
-std::array<float,2>{0.512931406f, 0.417021513f},
-std::array<float,2>{0.287600845f, 0.0779231489f},
-std::array<float,2>{0.68763411f, 0.861564696f},
-std::array<float,2>{0.0467052385f, 0.623713791f},
-std::array<float,2>{0.9034549f, 0.478813767f},
-std::array<float,2>{0.218793929f, 0.346109688f},
-std::array<float,2>{0.756629944f, 0.708701134f},
-std::array<float,2>{0.450864762f, 0.896889627f},
-std::array<float,2>{0.613409042f, 0.247621492f},
-std::array<float,2>{0.391886324f, 0.401094228f},
-std::array<float,2>{0.536103666f, 0.528347194f},
-std::array<float,2>{0.173614413f, 0.809012175f},
-std::array<float,2>{0.835489511f, 0.0164384954f},
-std::array<float,2>{0.122265399f, 0.180922762f},
-std::array<float,2>{0.94036597f, 0.952499032f},
-std::array<float,2>{0.341830432f, 0.677265346f},
-std::array<float,2>{0.67044425f, 0.265079945f},
-std::array<float,2>{0.279384404f, 0.235148087f},
-std::array<float,2>{0.725810945f, 0.905043125f},
-std::array<float,2>{0.00396728143f, 0.715244234f},
-std::array<float,2>{0.913062751f, 0.359373987f},
-std::array<float,2>{0.215075746f, 0.473677278f},
-std::array<float,2>{0.782796621f, 0.613352597f},
-std::array<float,2>{0.486319631f, 0.867471397f},
-std::array<float,2>{0.580530941f, 0.0625855476f},
-std::array<float,2>{0.413538665f, 0.251463771f},
-std::array<float,2>{0.50288254f, 0.680053592f},
-std::array<float,2>{0.140085757f, 0.944034517f},
-std::array<float,2>{0.867807984f, 0.172965854f},
-std::array<float,2>{0.0732693747f, 0.0237897877f},
-std::array<float,2>{0.987316072f, 0.799631059f},
-std::array<float,2>{0.344433933f, 0.519073248f},
-std::array<float,2>{0.649912715f, 0.395755798f},
-std::array<float,2>{0.44077453f, 0.109386548f},
-std::array<float,2>{0.619642615f, 0.830348492f},
-std::array<float,2>{0.229456961f, 0.579119503f},
-std::array<float,2>{0.761372209f, 0.461690336f},
-std::array<float,2>{0.032473933f, 0.320863366f},
-std::array<float,2>{0.896456957f, 0.734588861f},
-std::array<float,2>{0.292241156f, 0.917066216f},
-std::array<float,2>{0.701046884f, 0.209800288f},
-std::array<float,2>{0.328591138f, 0.408605188f},
-std::array<float,2>{0.662062585f, 0.544187963f},
-std::array<float,2>{0.115638651f, 0.758017957f},
-std::array<float,2>{0.949818909f, 0.0537056029f},
-std::array<float,2>{0.183128282f, 0.132131204f},
-std::array<float,2>{0.843259871f, 0.988413513f},
-std::array<float,2>{0.405423284f, 0.628866553f},
-std::array<float,2>{0.544576049f, 0.284972847f},
-std::array<float,2>{0.377687603f, 0.161546454f},
-std::array<float,2>{0.548962653f, 0.96035099f},
-std::array<float,2>{0.169843242f, 0.663209558f},
-std::array<float,2>{0.825355172f, 0.266696185f},
-std::array<float,2>{0.10908629f, 0.388431817f},
-std::array<float,2>{0.967050314f, 0.50691539f},
-std::array<float,2>{0.323286653f, 0.781264782f},
-std::array<float,2>{0.679430366f, 0.00187050633f},
-std::array<float,2>{0.305715919f, 0.363580763f},
-std::array<float,2>{0.715533912f, 0.697842956f},
-std::array<float,2>{0.0578249805f, 0.884753883f},
-std::array<float,2>{0.88056922f, 0.220348686f},
-std::array<float,2>{0.246217594f, 0.0920445621f},
-std::array<float,2>{0.772769451f, 0.850399375f},
-std::array<float,2>{0.465084732f, 0.593776822f},
-std::array<float,2>{0.604834378f, 0.49601087f},
-std::array<float,2>{0.364430994f, 0.045699738f},
-std::array<float,2>{0.63372761f, 0.780382395f},
-std::array<float,2>{0.0864204168f, 0.555315435f},
-std::array<float,2>{0.968838692f, 0.429533243f},
-std::array<float,2>{0.145388469f, 0.31132853f},
-std::array<float,2>{0.846575201f, 0.648623049f},
-std::array<float,2>{0.424250811f, 0.970195472f},
-std::array<float,2>{0.517256618f, 0.155280933f},
-std::array<float,2>{0.469883531f, 0.442625999f},
-std::array<float,2>{0.573248088f, 0.567089617f},
-std::array<float,2>{0.20211719f, 0.815084457f},
-std::array<float,2>{0.797771096f, 0.0986972377f},
-std::array<float,2>{0.0306139365f, 0.20297958f},
-std::array<float,2>{0.928645372f, 0.937486708f},
-std::array<float,2>{0.250388443f, 0.732513249f},
-std::array<float,2>{0.737229049f, 0.339881271f},
-std::array<float,2>{0.349451482f, 0.195275083f},
-std::array<float,2>{0.652472317f, 0.922065973f},
-std::array<float,2>{0.0748973712f, 0.72349602f},
-std::array<float,2>{0.992123902f, 0.33159709f},
-std::array<float,2>{0.135287434f, 0.447715044f},
-std::array<float,2>{0.874819636f, 0.571465194f},
-std::array<float,2>{0.406622052f, 0.824759603f},
-std::array<float,2>{0.50489676f, 0.103380904f},
-std::array<float,2>{0.491722882f, 0.302666456f},
-std::array<float,2>{0.58304733f, 0.647897184f},
-std::array<float,2>{0.212123558f, 0.977270067f},
-std::array<float,2>{0.788817406f, 0.143969879f},
-std::array<float,2>{0.00321312388f, 0.037783999f},
-std::array<float,2>{0.908102393f, 0.767764509f},
-std::array<float,2>{0.276248783f, 0.553281426f},
-std::array<float,2>{0.721355319f, 0.43066147f},
-std::array<float,2>{0.40233165f, 0.0805906504f},
-std::array<float,2>{0.539113522f, 0.858287394f},
-std::array<float,2>{0.184697732f, 0.609104514f},
-std::array<float,2>{0.837968707f, 0.485825449f},
-std::array<float,2>{0.110564455f, 0.374293536f},
-std::array<float,2>{0.949055314f, 0.693196237f},
-std::array<float,2>{0.334894538f, 0.88155216f},
-std::array<float,2>{0.656487167f, 0.233517557f},
-std::array<float,2>{0.293670028f, 0.37920323f},
-std::array<float,2>{0.698832035f, 0.510572553f},
-std::array<float,2>{0.0363148786f, 0.789376915f},
-std::array<float,2>{0.894124091f, 0.00886139646f},
-std::array<float,2>{0.230739012f, 0.170558989f},
-std::array<float,2>{0.764540553f, 0.966252267f},
-std::array<float,2>{0.442752749f, 0.664971888f},
-std::array<float,2>{0.623048365f, 0.275176138f},
-std::array<float,2>{0.463968605f, 0.135808915f},
-std::array<float,2>{0.605974913f, 0.999862373f},
-std::array<float,2>{0.243298277f, 0.638681233f},
-std::array<float,2>{0.767351031f, 0.291154623f},
-std::array<float,2>{0.0588140339f, 0.420118332f},
-std::array<float,2>{0.875747204f, 0.53134495f},
-std::array<float,2>{0.310260773f, 0.755505025f},
-std::array<float,2>{0.712507963f, 0.0600148402f},
-std::array<float,2>{0.327760726f, 0.315872252f},
-std::array<float,2>{0.672663271f, 0.749677479f},
-std::array<float,2>{0.104134321f, 0.910018086f},
-std::array<float,2>{0.962403059f, 0.21784319f},
-std::array<float,2>{0.165635675f, 0.120087311f},
-std::array<float,2>{0.822845042f, 0.836354434f},
-std::array<float,2>{0.381455779f, 0.587366045f},
-std::array<float,2>{0.553977609f, 0.456800699f},
-std::array<float,2>{0.255740315f, 0.0204211082f},
-std::array<float,2>{0.740699649f, 0.80538404f},
-std::array<float,2>{0.0240328982f, 0.524475515f},
-std::array<float,2>{0.923898876f, 0.404920429f},
-std::array<float,2>{0.198309734f, 0.258132488f},
-std::array<float,2>{0.801472247f, 0.673958123f},
-std::array<float,2>{0.474678934f, 0.94707346f},
-std::array<float,2>{0.577635467f, 0.185256869f},
-std::array<float,2>{0.426903307f, 0.481469303f},
-std::array<float,2>{0.519862294f, 0.618965983f},
-std::array<float,2>{0.140876934f, 0.865062475f},
-std::array<float,2>{0.84795326f, 0.0713811889f},
-std::array<float,2>{0.0916493312f, 0.242524087f},
-std::array<float,2>{0.975533605f, 0.891966164f},
-std::array<float,2>{0.359678268f, 0.704917014f},
-std::array<float,2>{0.639125347f, 0.349383026f},
-std::array<float,2>{0.298036128f, 0.178199738f},
-std::array<float,2>{0.708830595f, 0.938917935f},
-std::array<float,2>{0.0535433851f, 0.686486602f},
-std::array<float,2>{0.883150697f, 0.256433964f},
-std::array<float,2>{0.238518462f, 0.393056571f},
-std::array<float,2>{0.778164327f, 0.522884667f},
-std::array<float,2>{0.454229981f, 0.804054976f},
-std::array<float,2>{0.600768924f, 0.0278773662f},
-std::array<float,2>{0.38829717f, 0.35286656f},
-std::array<float,2>{0.55768162f, 0.713491201f},
-std::array<float,2>{0.160028502f, 0.899131f},
-std::array<float,2>{0.817336142f, 0.240065396f},
-std::array<float,2>{0.096643053f, 0.0672403276f},
-std::array<float,2>{0.955084801f, 0.871855974f},
-std::array<float,2>{0.314050913f, 0.609834075f},
-std::array<float,2>{0.687189877f, 0.470652193f},
-std::array<float,2>{0.481978565f, 0.0499843508f},
-std::array<float,2>{0.566909015f, 0.763226926f},
-std::array<float,2>{0.187785581f, 0.541974604f},
-std::array<float,2>{0.806119323f, 0.413655013f},
-std::array<float,2>{0.0223245304f, 0.288758695f},
-std::array<float,2>{0.929962099f, 0.631636441f},
-std::array<float,2>{0.259369701f, 0.987163126f},
-std::array<float,2>{0.742578685f, 0.125467241f},
-std::array<float,2>{0.368626386f, 0.466872483f},
-std::array<float,2>{0.631671727f, 0.584179878f},
-std::array<float,2>{0.0826022699f, 0.833338618f},
-std::array<float,2>{0.978371084f, 0.113738157f},
-std::array<float,2>{0.15368095f, 0.20689857f},
-std::array<float,2>{0.855430484f, 0.920174837f},
-std::array<float,2>{0.435234874f, 0.738820732f},
-std::array<float,2>{0.529278219f, 0.325777501f},
-std::array<float,2>{0.418325752f, 0.224485695f},
-std::array<float,2>{0.511579454f, 0.88883698f},
-std::array<float,2>{0.125337422f, 0.702900529f},
-std::array<float,2>{0.866299927f, 0.360004604f},
-std::array<float,2>{0.0660055727f, 0.499321222f},
-std::array<float,2>{0.999434412f, 0.60017544f},
-std::array<float,2>{0.35592106f, 0.845207036f},
-std::array<float,2>{0.645338655f, 0.0885499418f},
-std::array<float,2>{0.273413152f, 0.270016462f},
-std::array<float,2>{0.733662784f, 0.658540487f},
-std::array<float,2>{0.00871150661f, 0.954009116f},
-std::array<float,2>{0.921519041f, 0.157436758f},
-std::array<float,2>{0.205768958f, 0.00601440156f},
-std::array<float,2>{0.7931422f, 0.787671089f},
-std::array<float,2>{0.495789826f, 0.500367105f},
-std::array<float,2>{0.588497341f, 0.385994881f},
-std::array<float,2>{0.337482184f, 0.0946198404f},
-std::array<float,2>{0.66555047f, 0.818293631f},
-std::array<float,2>{0.120191365f, 0.564646423f},
-std::array<float,2>{0.944929242f, 0.440547258f},
-std::array<float,2>{0.177139595f, 0.337590784f},
-std::array<float,2>{0.829788268f, 0.7296983f},
-std::array<float,2>{0.398216575f, 0.932410836f},
-std::array<float,2>{0.533311963f, 0.197254285f},
-std::array<float,2>{0.448274881f, 0.423720658f},
-std::array<float,2>{0.609637499f, 0.559211195f},
-std::array<float,2>{0.225668848f, 0.777173042f},
-std::array<float,2>{0.753064156f, 0.0391573906f},
-std::array<float,2>{0.0424602441f, 0.152219921f},
-std::array<float,2>{0.901949406f, 0.9761976f},
-std::array<float,2>{0.284894139f, 0.653243959f},
-std::array<float,2>{0.694152474f, 0.307548821f},
-std::array<float,2>{0.343431145f, 0.181986779f},
-std::array<float,2>{0.67165643f, 0.949769616f},
-std::array<float,2>{0.121276781f, 0.677949846f},
-std::array<float,2>{0.941239238f, 0.262459874f},
-std::array<float,2>{0.172203451f, 0.398863912f},
-std::array<float,2>{0.834925115f, 0.529642761f},
-std::array<float,2>{0.391182184f, 0.812117338f},
-std::array<float,2>{0.536929369f, 0.0193940885f},
-std::array<float,2>{0.4493725f, 0.345507115f},
-std::array<float,2>{0.614883184f, 0.709806681f},
-std::array<float,2>{0.219772458f, 0.896341085f},
-std::array<float,2>{0.756974936f, 0.249405295f},
-std::array<float,2>{0.045553416f, 0.0750768036f},
-std::array<float,2>{0.902675569f, 0.860875726f},
-std::array<float,2>{0.288602501f, 0.622696519f},
-std::array<float,2>{0.68923384f, 0.477779716f},
-std::array<float,2>{0.417378247f, 0.0569640324f},
-std::array<float,2>{0.51192224f, 0.751479924f},
-std::array<float,2>{0.129866496f, 0.536507905f},
-std::array<float,2>{0.860322714f, 0.414111853f},
-std::array<float,2>{0.0669582263f, 0.295314372f},
-std::array<float,2>{0.993526459f, 0.633874714f},
-std::array<float,2>{0.355077088f, 0.995290935f},
-std::array<float,2>{0.64208591f, 0.137950525f},
-std::array<float,2>{0.268560857f, 0.45937705f},
-std::array<float,2>{0.726570129f, 0.593007565f},
-std::array<float,2>{0.0131719327f, 0.840460181f},
-std::array<float,2>{0.916248679f, 0.123439349f},
-std::array<float,2>{0.209594786f, 0.214226633f},
-std::array<float,2>{0.792324066f, 0.912855446f},
-std::array<float,2>{0.496466219f, 0.744747937f},
-std::array<float,2>{0.593228221f, 0.318404853f},
-std::array<float,2>{0.478926748f, 0.22800687f},
-std::array<float,2>{0.563156664f, 0.876365304f},
-std::array<float,2>{0.192863747f, 0.690052986f},
-std::array<float,2>{0.809104681f, 0.367285073f},
-std::array<float,2>{0.0194176566f, 0.490441233f},
-std::array<float,2>{0.937051654f, 0.604629695f},
-std::array<float,2>{0.263275862f, 0.851656079f},
-std::array<float,2>{0.748191476f, 0.0838002041f},
-std::array<float,2>{0.373159915f, 0.27878812f},
-std::array<float,2>{0.628725111f, 0.668474257f},
-std::array<float,2>{0.0799133107f, 0.962448061f},
-std::array<float,2>{0.981662929f, 0.164358184f},
-std::array<float,2>{0.151921973f, 0.0127462661f},
-std::array<float,2>{0.857641637f, 0.793037474f},
-std::array<float,2>{0.431102067f, 0.512274623f},
-std::array<float,2>{0.525461495f, 0.375274211f},
-std::array<float,2>{0.301089853f, 0.109312981f},
-std::array<float,2>{0.705173254f, 0.823477268f},
-std::array<float,2>{0.0481295511f, 0.574856758f},
-std::array<float,2>{0.88863045f, 0.45026204f},
-std::array<float,2>{0.237925187f, 0.334763378f},
-std::array<float,2>{0.77607739f, 0.721455812f},
-std::array<float,2>{0.45800367f, 0.928990662f},
-std::array<float,2>{0.594734967f, 0.188450247f},
-std::array<float,2>{0.382830739f, 0.434006542f},
-std::array<float,2>{0.559070826f, 0.550460517f},
-std::array<float,2>{0.163950965f, 0.771798432f},
-std::array<float,2>{0.81417799f, 0.0330263041f},
-std::array<float,2>{0.0995927975f, 0.145079151f},
-std::array<float,2>{0.958895564f, 0.984049022f},
-std::array<float,2>{0.319604963f, 0.641070187f},
-std::array<float,2>{0.682263613f, 0.298240542f},
-std::array<float,2>{0.251101851f, 0.199225321f},
-std::array<float,2>{0.738030791f, 0.935432494f},
-std::array<float,2>{0.0301375259f, 0.730885148f},
-std::array<float,2>{0.92904985f, 0.343027502f},
-std::array<float,2>{0.203066409f, 0.443375438f},
-std::array<float,2>{0.79806298f, 0.569728613f},
-std::array<float,2>{0.468835562f, 0.814178348f},
-std::array<float,2>{0.573049247f, 0.100165844f},
-std::array<float,2>{0.425487638f, 0.310233146f},
-std::array<float,2>{0.516471326f, 0.651292622f},
-std::array<float,2>{0.145765901f, 0.970943987f},
-std::array<float,2>{0.847394705f, 0.153571993f},
-std::array<float,2>{0.0869488865f, 0.0444077477f},
-std::array<float,2>{0.970163226f, 0.77909869f},
-std::array<float,2>{0.364134341f, 0.557625294f},
-std::array<float,2>{0.634334207f, 0.426226676f},
-std::array<float,2>{0.466342479f, 0.0907603577f},
-std::array<float,2>{0.603834927f, 0.849601328f},
-std::array<float,2>{0.24768196f, 0.597243667f},
-std::array<float,2>{0.772019506f, 0.492328763f},
-std::array<float,2>{0.0570898242f, 0.365395695f},
-std::array<float,2>{0.879323661f, 0.696858287f},
-std::array<float,2>{0.304809093f, 0.886582553f},
-std::array<float,2>{0.71654135f, 0.221517041f},
-std::array<float,2>{0.322314769f, 0.390094727f},
-std::array<float,2>{0.678520501f, 0.505642951f},
-std::array<float,2>{0.107587673f, 0.785115004f},
-std::array<float,2>{0.968118548f, 0.00319474051f},
-std::array<float,2>{0.168832049f, 0.163118482f},
-std::array<float,2>{0.824569464f, 0.957088232f},
-std::array<float,2>{0.378061473f, 0.66148603f},
-std::array<float,2>{0.550441206f, 0.268656284f},
-std::array<float,2>{0.405187786f, 0.130829439f},
-std::array<float,2>{0.543473482f, 0.991791308f},
-std::array<float,2>{0.18203938f, 0.625896692f},
-std::array<float,2>{0.841853738f, 0.282525927f},
-std::array<float,2>{0.116525836f, 0.406493813f},
-std::array<float,2>{0.950979531f, 0.546785474f},
-std::array<float,2>{0.329970241f, 0.760087907f},
-std::array<float,2>{0.66075623f, 0.0524108447f},
-std::array<float,2>{0.291871518f, 0.323422521f},
-std::array<float,2>{0.699241817f, 0.73742789f},
-std::array<float,2>{0.0315410309f, 0.915066659f},
-std::array<float,2>{0.894576311f, 0.208330438f},
-std::array<float,2>{0.230402425f, 0.11228168f},
-std::array<float,2>{0.760226965f, 0.829834223f},
-std::array<float,2>{0.440013677f, 0.580560982f},
-std::array<float,2>{0.620428085f, 0.464127839f},
-std::array<float,2>{0.345242411f, 0.0265466645f},
-std::array<float,2>{0.649264157f, 0.797803581f},
-std::array<float,2>{0.0724744126f, 0.517083108f},
-std::array<float,2>{0.98658818f, 0.397594929f},
-std::array<float,2>{0.139189184f, 0.252679795f},
-std::array<float,2>{0.868587494f, 0.682963908f},
-std::array<float,2>{0.412122339f, 0.942180932f},
-std::array<float,2>{0.503016114f, 0.175675988f},
-std::array<float,2>{0.48492682f, 0.474752426f},
-std::array<float,2>{0.582022667f, 0.615291595f},
-std::array<float,2>{0.216430694f, 0.870362878f},
-std::array<float,2>{0.781808853f, 0.0652760118f},
-std::array<float,2>{0.00542388344f, 0.238018766f},
-std::array<float,2>{0.913879693f, 0.902715743f},
-std::array<float,2>{0.280794799f, 0.717236876f},
-std::array<float,2>{0.725488007f, 0.356260329f},
-std::array<float,2>{0.360593736f, 0.244603902f},
-std::array<float,2>{0.639936388f, 0.893914521f},
-std::array<float,2>{0.0903552845f, 0.706391752f},
-std::array<float,2>{0.975957513f, 0.350508273f},
-std::array<float,2>{0.14191772f, 0.483387709f},
-std::array<float,2>{0.849209189f, 0.620785773f},
-std::array<float,2>{0.426269352f, 0.866311371f},
-std::array<float,2>{0.521232188f, 0.0738194659f},
-std::array<float,2>{0.476542324f, 0.261617064f},
-std::array<float,2>{0.576389551f, 0.673704386f},
-std::array<float,2>{0.197666258f, 0.948590696f},
-std::array<float,2>{0.802208006f, 0.186982498f},
-std::array<float,2>{0.0252008922f, 0.0233346745f},
-std::array<float,2>{0.925695777f, 0.808274865f},
-std::array<float,2>{0.254588515f, 0.526357293f},
-std::array<float,2>{0.741519332f, 0.402869731f},
-std::array<float,2>{0.381979436f, 0.117659509f},
-std::array<float,2>{0.552801251f, 0.839415133f},
-std::array<float,2>{0.164332539f, 0.588265002f},
-std::array<float,2>{0.823278368f, 0.454193741f},
-std::array<float,2>{0.104783349f, 0.312598735f},
-std::array<float,2>{0.961000204f, 0.74649322f},
-std::array<float,2>{0.326715499f, 0.906578839f},
-std::array<float,2>{0.673315406f, 0.216487437f},
-std::array<float,2>{0.309250385f, 0.419041216f},
-std::array<float,2>{0.711661577f, 0.53467685f},
-std::array<float,2>{0.0605194531f, 0.756155312f},
-std::array<float,2>{0.876655221f, 0.0609003119f},
-std::array<float,2>{0.242639557f, 0.133012444f},
-std::array<float,2>{0.76613754f, 0.997305453f},
-std::array<float,2>{0.46299696f, 0.637019455f},
-std::array<float,2>{0.606918216f, 0.290116608f},
-std::array<float,2>{0.442314267f, 0.169687808f},
-std::array<float,2>{0.624670208f, 0.967239857f},
-std::array<float,2>{0.231567815f, 0.667518318f},
-std::array<float,2>{0.765603483f, 0.275996685f},
-std::array<float,2>{0.0355152525f, 0.381663769f},
-std::array<float,2>{0.893096626f, 0.509640634f},
-std::array<float,2>{0.294156939f, 0.791583955f},
-std::array<float,2>{0.697358966f, 0.0103721628f},
-std::array<float,2>{0.335642308f, 0.372383416f},
-std::array<float,2>{0.657234192f, 0.694485605f},
-std::array<float,2>{0.109450437f, 0.880378783f},
-std::array<float,2>{0.947982967f, 0.232318178f},
-std::array<float,2>{0.183754474f, 0.0785272047f},
-std::array<float,2>{0.839539707f, 0.855774105f},
-std::array<float,2>{0.400866091f, 0.606850266f},
-std::array<float,2>{0.540335f, 0.487450451f},
-std::array<float,2>{0.276793927f, 0.036285013f},
-std::array<float,2>{0.722398162f, 0.766125619f},
-std::array<float,2>{0.00210829545f, 0.55121702f},
-std::array<float,2>{0.906443179f, 0.433499753f},
-std::array<float,2>{0.211314082f, 0.303526878f},
-std::array<float,2>{0.787317157f, 0.645892501f},
-std::array<float,2>{0.490903437f, 0.979327977f},
-std::array<float,2>{0.5824067f, 0.141258508f},
-std::array<float,2>{0.407569826f, 0.445729911f},
-std::array<float,2>{0.50481993f, 0.572528064f},
-std::array<float,2>{0.136096612f, 0.826768279f},
-std::array<float,2>{0.873054802f, 0.104502015f},
-std::array<float,2>{0.075221397f, 0.193029478f},
-std::array<float,2>{0.990676463f, 0.924558103f},
-std::array<float,2>{0.348276436f, 0.725404739f},
-std::array<float,2>{0.654130101f, 0.329326689f},
-std::array<float,2>{0.283311963f, 0.149556383f},
-std::array<float,2>{0.695125639f, 0.973529577f},
-std::array<float,2>{0.0414701439f, 0.654873729f},
-std::array<float,2>{0.900696933f, 0.305066675f},
-std::array<float,2>{0.225372434f, 0.424481779f},
-std::array<float,2>{0.752309024f, 0.562217474f},
-std::array<float,2>{0.447868586f, 0.774002552f},
-std::array<float,2>{0.611073136f, 0.041953817f},
-std::array<float,2>{0.396625221f, 0.338219106f},
-std::array<float,2>{0.534355283f, 0.727113843f},
-std::array<float,2>{0.175866395f, 0.929702163f},
-std::array<float,2>{0.828687787f, 0.199072897f},
-std::array<float,2>{0.11977423f, 0.0967443287f},
-std::array<float,2>{0.944113195f, 0.819798887f},
-std::array<float,2>{0.336171448f, 0.563920379f},
-std::array<float,2>{0.664320886f, 0.438116997f},
-std::array<float,2>{0.494402736f, 0.00444506807f},
-std::array<float,2>{0.589576066f, 0.785226285f},
-std::array<float,2>{0.206515059f, 0.502869546f},
-std::array<float,2>{0.794886708f, 0.383924186f},
-std::array<float,2>{0.00939678214f, 0.272860765f},
-std::array<float,2>{0.919979811f, 0.657073796f},
-std::array<float,2>{0.272454023f, 0.955854237f},
-std::array<float,2>{0.733132958f, 0.159579024f},
-std::array<float,2>{0.356900781f, 0.497450978f},
-std::array<float,2>{0.646370649f, 0.597939253f},
-std::array<float,2>{0.0651009753f, 0.846066177f},
-std::array<float,2>{0.998148263f, 0.086411342f},
-std::array<float,2>{0.126533329f, 0.226102099f},
-std::array<float,2>{0.865749717f, 0.886725843f},
-std::array<float,2>{0.41958952f, 0.699382961f},
-std::array<float,2>{0.509984791f, 0.361738473f},
-std::array<float,2>{0.434179723f, 0.203223825f},
-std::array<float,2>{0.527574003f, 0.919643641f},
-std::array<float,2>{0.152511552f, 0.741536975f},
-std::array<float,2>{0.854429305f, 0.32643792f},
-std::array<float,2>{0.0830120519f, 0.465282291f},
-std::array<float,2>{0.976908624f, 0.582517207f},
-std::array<float,2>{0.368041724f, 0.834319353f},
-std::array<float,2>{0.632371843f, 0.116593823f},
-std::array<float,2>{0.258770406f, 0.285387307f},
-std::array<float,2>{0.743257284f, 0.629784763f},
-std::array<float,2>{0.0232535955f, 0.986089468f},
-std::array<float,2>{0.931547761f, 0.127657697f},
-std::array<float,2>{0.188796669f, 0.0468854569f},
-std::array<float,2>{0.805219948f, 0.76383245f},
-std::array<float,2>{0.480714709f, 0.540706635f},
-std::array<float,2>{0.568026185f, 0.410863608f},
-std::array<float,2>{0.313034594f, 0.0691648498f},
-std::array<float,2>{0.685888231f, 0.874197602f},
-std::array<float,2>{0.0971065313f, 0.612585783f},
-std::array<float,2>{0.956746638f, 0.472122222f},
-std::array<float,2>{0.159048513f, 0.355253309f},
-std::array<float,2>{0.817506135f, 0.711408615f},
-std::array<float,2>{0.387162566f, 0.901264071f},
-std::array<float,2>{0.55692178f, 0.241047055f},
-std::array<float,2>{0.453218132f, 0.390733868f},
-std::array<float,2>{0.599975824f, 0.520116448f},
-std::array<float,2>{0.239970461f, 0.801311433f},
-std::array<float,2>{0.778371215f, 0.029608082f},
-std::array<float,2>{0.0540890023f, 0.177271456f},
-std::array<float,2>{0.884430051f, 0.940294862f},
-std::array<float,2>{0.296993881f, 0.685124934f},
-std::array<float,2>{0.707258463f, 0.255620241f},
-std::array<float,2>{0.352921665f, 0.139012724f},
-std::array<float,2>{0.64265269f, 0.99271065f},
-std::array<float,2>{0.070208624f, 0.635818243f},
-std::array<float,2>{0.994609952f, 0.293462664f},
-std::array<float,2>{0.132366821f, 0.416026473f},
-std::array<float,2>{0.862833917f, 0.539001644f},
-std::array<float,2>{0.414535731f, 0.753844559f},
-std::array<float,2>{0.514195442f, 0.0558996126f},
-std::array<float,2>{0.49864018f, 0.317211747f},
-std::array<float,2>{0.591035366f, 0.743483841f},
-std::array<float,2>{0.208315924f, 0.91108191f},
-std::array<float,2>{0.790967107f, 0.212693229f},
-std::array<float,2>{0.014875046f, 0.12268953f},
-std::array<float,2>{0.914994419f, 0.842226982f},
-std::array<float,2>{0.266252458f, 0.59071368f},
-std::array<float,2>{0.729999244f, 0.458420545f},
-std::array<float,2>{0.39379856f, 0.0168514401f},
-std::array<float,2>{0.537319422f, 0.809846997f},
-std::array<float,2>{0.175060853f, 0.528082371f},
-std::array<float,2>{0.833525062f, 0.401851565f},
-std::array<float,2>{0.123530634f, 0.264433056f},
-std::array<float,2>{0.938281238f, 0.676002741f},
-std::array<float,2>{0.341253996f, 0.951561332f},
-std::array<float,2>{0.668777287f, 0.180164739f},
-std::array<float,2>{0.286021888f, 0.479802579f},
-std::array<float,2>{0.690493226f, 0.624713242f},
-std::array<float,2>{0.0443706959f, 0.862385392f},
-std::array<float,2>{0.905123591f, 0.0765393749f},
-std::array<float,2>{0.221485078f, 0.24661763f},
-std::array<float,2>{0.75428617f, 0.89805156f},
-std::array<float,2>{0.452484131f, 0.707141936f},
-std::array<float,2>{0.615446687f, 0.347124815f},
-std::array<float,2>{0.459131807f, 0.190919966f},
-std::array<float,2>{0.596119642f, 0.927104592f},
-std::array<float,2>{0.23593311f, 0.720290899f},
-std::array<float,2>{0.77532059f, 0.33213824f},
-std::array<float,2>{0.0498783365f, 0.451994002f},
-std::array<float,2>{0.88873148f, 0.576607049f},
-std::array<float,2>{0.304294646f, 0.82042259f},
-std::array<float,2>{0.70346123f, 0.106277108f},
-std::array<float,2>{0.317582995f, 0.300011873f},
-std::array<float,2>{0.679865241f, 0.644361079f},
-std::array<float,2>{0.100070015f, 0.981755018f},
-std::array<float,2>{0.960530758f, 0.146643534f},
-std::array<float,2>{0.16177699f, 0.0334669389f},
-std::array<float,2>{0.815807223f, 0.769804418f},
-std::array<float,2>{0.384808958f, 0.547809482f},
-std::array<float,2>{0.562000871f, 0.437184751f},
-std::array<float,2>{0.265483886f, 0.085214071f},
-std::array<float,2>{0.747179151f, 0.854784906f},
-std::array<float,2>{0.0160335992f, 0.603004515f},
-std::array<float,2>{0.933950126f, 0.488940835f},
-std::array<float,2>{0.193804994f, 0.36976108f},
-std::array<float,2>{0.811758399f, 0.688701034f},
-std::array<float,2>{0.478216916f, 0.877076209f},
-std::array<float,2>{0.565914571f, 0.229713291f},
-std::array<float,2>{0.433464497f, 0.377419889f},
-std::array<float,2>{0.523742914f, 0.513761044f},
-std::array<float,2>{0.149004921f, 0.795435607f},
-std::array<float,2>{0.855564654f, 0.0151050258f},
-std::array<float,2>{0.0809105039f, 0.167007267f},
-std::array<float,2>{0.983542025f, 0.964026988f},
-std::array<float,2>{0.371630818f, 0.671024859f},
-std::array<float,2>{0.625782907f, 0.281018108f},
-std::array<float,2>{0.308082372f, 0.219691172f},
-std::array<float,2>{0.718554974f, 0.882973313f},
-std::array<float,2>{0.055757612f, 0.699032187f},
-std::array<float,2>{0.882573724f, 0.364348471f},
-std::array<float,2>{0.24810946f, 0.494491369f},
-std::array<float,2>{0.769540131f, 0.595124304f},
-std::array<float,2>{0.468746305f, 0.851222396f},
-std::array<float,2>{0.602184117f, 0.0933555961f},
-std::array<float,2>{0.376793921f, 0.266566724f},
-std::array<float,2>{0.54865855f, 0.662558496f},
-std::array<float,2>{0.170892432f, 0.959338903f},
-std::array<float,2>{0.82703042f, 0.160414681f},
-std::array<float,2>{0.106152907f, 0.000575769169f},
-std::array<float,2>{0.964885473f, 0.782446265f},
-std::array<float,2>{0.321638852f, 0.506543577f},
-std::array<float,2>{0.676715255f, 0.387438416f},
-std::array<float,2>{0.472014904f, 0.0977239683f},
-std::array<float,2>{0.570638776f, 0.815498352f},
-std::array<float,2>{0.200023279f, 0.567613482f},
-std::array<float,2>{0.799939394f, 0.442282945f},
-std::array<float,2>{0.0285742506f, 0.341035664f},
-std::array<float,2>{0.926510811f, 0.733871877f},
-std::array<float,2>{0.253547668f, 0.935652375f},
-std::array<float,2>{0.734781265f, 0.201701894f},
-std::array<float,2>{0.366832405f, 0.428244144f},
-std::array<float,2>{0.636252761f, 0.556424856f},
-std::array<float,2>{0.0890369117f, 0.779446602f},
-std::array<float,2>{0.972409606f, 0.0463884808f},
-std::array<float,2>{0.148014456f, 0.154420361f},
-std::array<float,2>{0.843825877f, 0.968903601f},
-std::array<float,2>{0.423011392f, 0.649833024f},
-std::array<float,2>{0.518544614f, 0.3119241f},
-std::array<float,2>{0.411675215f, 0.171952918f},
-std::array<float,2>{0.501147628f, 0.945172787f},
-std::array<float,2>{0.137078017f, 0.680752754f},
-std::array<float,2>{0.8710109f, 0.250534862f},
-std::array<float,2>{0.071961537f, 0.394837201f},
-std::array<float,2>{0.985995173f, 0.518535435f},
-std::array<float,2>{0.34656623f, 0.800099432f},
-std::array<float,2>{0.651920915f, 0.0246480592f},
-std::array<float,2>{0.279182494f, 0.358133465f},
-std::array<float,2>{0.723089159f, 0.716157913f},
-std::array<float,2>{0.00724792341f, 0.906169593f},
-std::array<float,2>{0.910334766f, 0.235462487f},
-std::array<float,2>{0.217829317f, 0.0642976314f},
-std::array<float,2>{0.783546388f, 0.868806124f},
-std::array<float,2>{0.48796013f, 0.614491522f},
-std::array<float,2>{0.57961756f, 0.472821891f},
-std::array<float,2>{0.330748796f, 0.0544073433f},
-std::array<float,2>{0.663931608f, 0.759634078f},
-std::array<float,2>{0.115118243f, 0.543018222f},
-std::array<float,2>{0.952263653f, 0.40919143f},
-std::array<float,2>{0.180324391f, 0.283883959f},
-std::array<float,2>{0.839951992f, 0.627788842f},
-std::array<float,2>{0.40299505f, 0.990228236f},
-std::array<float,2>{0.545331001f, 0.130889654f},
-std::array<float,2>{0.438113511f, 0.462760031f},
-std::array<float,2>{0.617437303f, 0.578900695f},
-std::array<float,2>{0.227913111f, 0.832022071f},
-std::array<float,2>{0.758205831f, 0.110972941f},
-std::array<float,2>{0.0345096812f, 0.21051912f},
-std::array<float,2>{0.8977139f, 0.916119933f},
-std::array<float,2>{0.289855242f, 0.735560834f},
-std::array<float,2>{0.702136159f, 0.321519762f},
-std::array<float,2>{0.325991899f, 0.217098087f},
-std::array<float,2>{0.67418015f, 0.908993125f},
-std::array<float,2>{0.101791404f, 0.748403132f},
-std::array<float,2>{0.963555157f, 0.315416843f},
-std::array<float,2>{0.167036653f, 0.455818713f},
-std::array<float,2>{0.821090519f, 0.586559892f},
-std::array<float,2>{0.380449742f, 0.836970329f},
-std::array<float,2>{0.552651465f, 0.121038385f},
-std::array<float,2>{0.462501466f, 0.292862028f},
-std::array<float,2>{0.608413875f, 0.639999151f},
-std::array<float,2>{0.245705873f, 0.998517334f},
-std::array<float,2>{0.769384146f, 0.135416493f},
-std::array<float,2>{0.0605691709f, 0.059301611f},
-std::array<float,2>{0.877770483f, 0.754663229f},
-std::array<float,2>{0.311284214f, 0.532267094f},
-std::array<float,2>{0.714055717f, 0.421682686f},
-std::array<float,2>{0.429551274f, 0.0711683556f},
-std::array<float,2>{0.522374272f, 0.863453329f},
-std::array<float,2>{0.143296063f, 0.617974579f},
-std::array<float,2>{0.851158917f, 0.480715036f},
-std::array<float,2>{0.0936561748f, 0.347753972f},
-std::array<float,2>{0.974494696f, 0.704095066f},
-std::array<float,2>{0.361935288f, 0.891579032f},
-std::array<float,2>{0.638128936f, 0.243310288f},
-std::array<float,2>{0.257484794f, 0.40610382f},
-std::array<float,2>{0.738849521f, 0.524166346f},
-std::array<float,2>{0.0270860922f, 0.806278169f},
-std::array<float,2>{0.922956944f, 0.0206952114f},
-std::array<float,2>{0.195662066f, 0.183826983f},
-std::array<float,2>{0.80457896f, 0.946117878f},
-std::array<float,2>{0.472698122f, 0.675525427f},
-std::array<float,2>{0.575225651f, 0.25926137f},
-std::array<float,2>{0.488439053f, 0.143524095f},
-std::array<float,2>{0.584034145f, 0.977774382f},
-std::array<float,2>{0.2146779f, 0.647295952f},
-std::array<float,2>{0.785310686f, 0.301284671f},
-std::array<float,2>{0.00186683726f, 0.431168646f},
-std::array<float,2>{0.909912229f, 0.554288805f},
-std::array<float,2>{0.273660958f, 0.768892825f},
-std::array<float,2>{0.719543219f, 0.0382657982f},
-std::array<float,2>{0.350549132f, 0.330756634f},
-std::array<float,2>{0.654585898f, 0.723636568f},
-std::array<float,2>{0.0779973716f, 0.922922909f},
-std::array<float,2>{0.989576519f, 0.193619788f},
-std::array<float,2>{0.134659037f, 0.102149606f},
-std::array<float,2>{0.871592462f, 0.825541675f},
-std::array<float,2>{0.409897417f, 0.571181178f},
-std::array<float,2>{0.506813765f, 0.449106276f},
-std::array<float,2>{0.296624035f, 0.00820033718f},
-std::array<float,2>{0.696138382f, 0.790351212f},
-std::array<float,2>{0.0383138023f, 0.51100862f},
-std::array<float,2>{0.89242208f, 0.380244702f},
-std::array<float,2>{0.234359384f, 0.274000764f},
-std::array<float,2>{0.762331724f, 0.665648043f},
-std::array<float,2>{0.44484669f, 0.964850724f},
-std::array<float,2>{0.622075379f, 0.171485454f},
-std::array<float,2>{0.399887234f, 0.484393805f},
-std::array<float,2>{0.542634368f, 0.607814014f},
-std::array<float,2>{0.185905427f, 0.859048247f},
-std::array<float,2>{0.837383687f, 0.0811748281f},
-std::array<float,2>{0.113003388f, 0.232489392f},
-std::array<float,2>{0.94665432f, 0.882121503f},
-std::array<float,2>{0.333048046f, 0.691957176f},
-std::array<float,2>{0.658532083f, 0.373695999f},
-std::array<float,2>{0.269636989f, 0.156861469f},
-std::array<float,2>{0.731437147f, 0.95415175f},
-std::array<float,2>{0.010096617f, 0.659782112f},
-std::array<float,2>{0.918763876f, 0.270654976f},
-std::array<float,2>{0.204738244f, 0.384784549f},
-std::array<float,2>{0.796389759f, 0.501161754f},
-std::array<float,2>{0.493256509f, 0.789035439f},
-std::array<float,2>{0.586031437f, 0.00699518761f},
-std::array<float,2>{0.42156148f, 0.360398442f},
-std::array<float,2>{0.508430243f, 0.701464474f},
-std::array<float,2>{0.128071338f, 0.890488148f},
-std::array<float,2>{0.863632441f, 0.223006353f},
-std::array<float,2>{0.0642441809f, 0.0893160626f},
-std::array<float,2>{0.99694407f, 0.844205499f},
-std::array<float,2>{0.359240711f, 0.6015535f},
-std::array<float,2>{0.646793365f, 0.49886024f},
-std::array<float,2>{0.446281403f, 0.040938884f},
-std::array<float,2>{0.612110138f, 0.776170313f},
-std::array<float,2>{0.22327818f, 0.560539961f},
-std::array<float,2>{0.750140429f, 0.422221571f},
-std::array<float,2>{0.0396073535f, 0.308294058f},
-std::array<float,2>{0.89920032f, 0.654191375f},
-std::array<float,2>{0.283084124f, 0.97468251f},
-std::array<float,2>{0.693175197f, 0.151014715f},
-std::array<float,2>{0.339336276f, 0.439887851f},
-std::array<float,2>{0.667784989f, 0.565552115f},
-std::array<float,2>{0.118695349f, 0.816829979f},
-std::array<float,2>{0.941690207f, 0.0947830454f},
-std::array<float,2>{0.178906396f, 0.195593402f},
-std::array<float,2>{0.830573499f, 0.933539271f},
-std::array<float,2>{0.395487279f, 0.729102135f},
-std::array<float,2>{0.532285452f, 0.336853802f},
-std::array<float,2>{0.390102535f, 0.238578379f},
-std::array<float,2>{0.555060506f, 0.899502575f},
-std::array<float,2>{0.157623887f, 0.714415908f},
-std::array<float,2>{0.819639802f, 0.352291226f},
-std::array<float,2>{0.0951743573f, 0.469101042f},
-std::array<float,2>{0.954352379f, 0.610764265f},
-std::array<float,2>{0.316359729f, 0.872984588f},
-std::array<float,2>{0.683996499f, 0.0682531744f},
-std::array<float,2>{0.300764024f, 0.257404447f},
-std::array<float,2>{0.709765136f, 0.687240005f},
-std::array<float,2>{0.0515607297f, 0.937958419f},
-std::array<float,2>{0.886593461f, 0.179248109f},
-std::array<float,2>{0.240406841f, 0.0287453216f},
-std::array<float,2>{0.780736804f, 0.803595781f},
-std::array<float,2>{0.456554562f, 0.521970749f},
-std::array<float,2>{0.597768664f, 0.394229531f},
-std::array<float,2>{0.370192558f, 0.114826977f},
-std::array<float,2>{0.629452884f, 0.832578421f},
-std::array<float,2>{0.0852121934f, 0.584992588f},
-std::array<float,2>{0.9794752f, 0.468308359f},
-std::array<float,2>{0.154485956f, 0.324772388f},
-std::array<float,2>{0.852950692f, 0.739812136f},
-std::array<float,2>{0.437257051f, 0.921198905f},
-std::array<float,2>{0.529579461f, 0.205472767f},
-std::array<float,2>{0.483414799f, 0.412964672f},
-std::array<float,2>{0.569046021f, 0.542508125f},
-std::array<float,2>{0.191246942f, 0.7623263f},
-std::array<float,2>{0.807643294f, 0.0489311181f},
-std::array<float,2>{0.0211785994f, 0.126553774f},
-std::array<float,2>{0.932834446f, 0.988265038f},
-std::array<float,2>{0.26128456f, 0.632561982f},
-std::array<float,2>{0.744257808f, 0.287310869f},
-std::array<float,2>{0.345768124f, 0.175245985f},
-std::array<float,2>{0.651770294f, 0.941839814f},
-std::array<float,2>{0.071501568f, 0.683212399f},
-std::array<float,2>{0.985720396f, 0.252317965f},
-std::array<float,2>{0.137485445f, 0.398206353f},
-std::array<float,2>{0.870154798f, 0.517520308f},
-std::array<float,2>{0.411365807f, 0.796952188f},
-std::array<float,2>{0.501882553f, 0.0269784797f},
-std::array<float,2>{0.487509221f, 0.355778933f},
-std::array<float,2>{0.579330146f, 0.717735171f},
-std::array<float,2>{0.218490273f, 0.902832389f},
-std::array<float,2>{0.783943653f, 0.237333447f},
-std::array<float,2>{0.00771193765f, 0.0648923218f},
-std::array<float,2>{0.910774827f, 0.870709062f},
-std::array<float,2>{0.278791249f, 0.615972877f},
-std::array<float,2>{0.723373055f, 0.475458235f},
-std::array<float,2>{0.402425468f, 0.0518305451f},
-std::array<float,2>{0.545581043f, 0.760472f},
-std::array<float,2>{0.179861173f, 0.546013355f},
-std::array<float,2>{0.840727746f, 0.406839818f},
-std::array<float,2>{0.114525348f, 0.283160388f},
-std::array<float,2>{0.953032672f, 0.625285149f},
-std::array<float,2>{0.330230147f, 0.991494894f},
-std::array<float,2>{0.663242936f, 0.129968628f},
-std::array<float,2>{0.289319754f, 0.464775443f},
-std::array<float,2>{0.701171875f, 0.580750525f},
-std::array<float,2>{0.0349588469f, 0.829355121f},
-std::array<float,2>{0.898136675f, 0.111805953f},
-std::array<float,2>{0.228113249f, 0.208544284f},
-std::array<float,2>{0.758369207f, 0.915883303f},
-std::array<float,2>{0.437528819f, 0.738005698f},
-std::array<float,2>{0.6177122f, 0.324190378f},
-std::array<float,2>{0.467897981f, 0.220953017f},
-std::array<float,2>{0.601581752f, 0.885744989f},
-std::array<float,2>{0.248731717f, 0.696624398f},
-std::array<float,2>{0.770436645f, 0.365775794f},
-std::array<float,2>{0.0565799512f, 0.492835671f},
-std::array<float,2>{0.88225013f, 0.597165525f},
-std::array<float,2>{0.308268458f, 0.848939836f},
-std::array<float,2>{0.718214452f, 0.0898522958f},
-std::array<float,2>{0.322042614f, 0.269182891f},
-std::array<float,2>{0.675809801f, 0.662012279f},
-std::array<float,2>{0.105593428f, 0.957546532f},
-std::array<float,2>{0.965574622f, 0.164052024f},
-std::array<float,2>{0.170335323f, 0.00368947466f},
-std::array<float,2>{0.826416075f, 0.784236133f},
-std::array<float,2>{0.376190871f, 0.505078435f},
-std::array<float,2>{0.548086941f, 0.390158981f},
-std::array<float,2>{0.253076494f, 0.0998554081f},
-std::array<float,2>{0.735051274f, 0.813554823f},
-std::array<float,2>{0.0292206183f, 0.569998503f},
-std::array<float,2>{0.926213801f, 0.444116712f},
-std::array<float,2>{0.199539155f, 0.343319565f},
-std::array<float,2>{0.800768018f, 0.731137633f},
-std::array<float,2>{0.472484827f, 0.935015023f},
-std::array<float,2>{0.57097429f, 0.199785799f},
-std::array<float,2>{0.423390508f, 0.426609278f},
-std::array<float,2>{0.517759085f, 0.558130503f},
-std::array<float,2>{0.147511914f, 0.778616309f},
-std::array<float,2>{0.844556034f, 0.044477161f},
-std::array<float,2>{0.0898352787f, 0.153973818f},
-std::array<float,2>{0.972093582f, 0.97121191f},
-std::array<float,2>{0.366331786f, 0.65050602f},
-std::array<float,2>{0.635900021f, 0.309683204f},
-std::array<float,2>{0.303948998f, 0.187691927f},
-std::array<float,2>{0.703950107f, 0.929288983f},
-std::array<float,2>{0.0503551997f, 0.720789671f},
-std::array<float,2>{0.889578462f, 0.334419787f},
-std::array<float,2>{0.235670537f, 0.450891674f},
-std::array<float,2>{0.774620652f, 0.57458812f},
-std::array<float,2>{0.459751308f, 0.823737442f},
-std::array<float,2>{0.596563995f, 0.108811945f},
-std::array<float,2>{0.385378838f, 0.298379123f},
-std::array<float,2>{0.562466025f, 0.64131844f},
-std::array<float,2>{0.161209255f, 0.983826518f},
-std::array<float,2>{0.816112995f, 0.144877717f},
-std::array<float,2>{0.10030625f, 0.0323150493f},
-std::array<float,2>{0.96034354f, 0.772204936f},
-std::array<float,2>{0.31804955f, 0.550023794f},
-std::array<float,2>{0.680243552f, 0.434492499f},
-std::array<float,2>{0.477702707f, 0.0834930912f},
-std::array<float,2>{0.566296458f, 0.852088988f},
-std::array<float,2>{0.193939775f, 0.604982078f},
-std::array<float,2>{0.812041819f, 0.491049707f},
-std::array<float,2>{0.0163326263f, 0.368013829f},
-std::array<float,2>{0.934359848f, 0.689824045f},
-std::array<float,2>{0.265036255f, 0.876544833f},
-std::array<float,2>{0.74800235f, 0.228145733f},
-std::array<float,2>{0.371537894f, 0.375838637f},
-std::array<float,2>{0.625338376f, 0.512018919f},
-std::array<float,2>{0.0803421289f, 0.793895423f},
-std::array<float,2>{0.984372258f, 0.0132922838f},
-std::array<float,2>{0.14857237f, 0.164767563f},
-std::array<float,2>{0.856331825f, 0.962071717f},
-std::array<float,2>{0.432722747f, 0.668171108f},
-std::array<float,2>{0.524153292f, 0.278977364f},
-std::array<float,2>{0.414819717f, 0.138299093f},
-std::array<float,2>{0.513936698f, 0.996053874f},
-std::array<float,2>{0.131997332f, 0.634479105f},
-std::array<float,2>{0.862570703f, 0.295677125f},
-std::array<float,2>{0.0693876445f, 0.414858907f},
-std::array<float,2>{0.994705558f, 0.536692381f},
-std::array<float,2>{0.353253871f, 0.751138449f},
-std::array<float,2>{0.643108547f, 0.0572503135f},
-std::array<float,2>{0.266044259f, 0.319292516f},
-std::array<float,2>{0.72992146f, 0.744590461f},
-std::array<float,2>{0.0154688321f, 0.912493944f},
-std::array<float,2>{0.914448142f, 0.214528948f},
-std::array<float,2>{0.208503544f, 0.123597555f},
-std::array<float,2>{0.79037112f, 0.840143442f},
-std::array<float,2>{0.498445928f, 0.593717456f},
-std::array<float,2>{0.591607094f, 0.459877014f},
-std::array<float,2>{0.341359377f, 0.0187788215f},
-std::array<float,2>{0.668186426f, 0.811695635f},
-std::array<float,2>{0.12386702f, 0.530107081f},
-std::array<float,2>{0.937813699f, 0.398985028f},
-std::array<float,2>{0.175731525f, 0.262159526f},
-std::array<float,2>{0.833334029f, 0.678265333f},
-std::array<float,2>{0.394163787f, 0.949303567f},
-std::array<float,2>{0.537986994f, 0.18246536f},
-std::array<float,2>{0.452784419f, 0.478422999f},
-std::array<float,2>{0.615825832f, 0.622340798f},
-std::array<float,2>{0.221144378f, 0.86035341f},
-std::array<float,2>{0.754881382f, 0.074634634f},
-std::array<float,2>{0.0447475091f, 0.249659613f},
-std::array<float,2>{0.904658377f, 0.895534992f},
-std::array<float,2>{0.28537184f, 0.709016323f},
-std::array<float,2>{0.690972924f, 0.344739676f},
-std::array<float,2>{0.315671712f, 0.240414709f},
-std::array<float,2>{0.68428874f, 0.900734127f},
-std::array<float,2>{0.0952340662f, 0.711594045f},
-std::array<float,2>{0.954859197f, 0.354966998f},
-std::array<float,2>{0.157970861f, 0.472450465f},
-std::array<float,2>{0.820160151f, 0.612960398f},
-std::array<float,2>{0.390614569f, 0.874650776f},
-std::array<float,2>{0.555346549f, 0.0686848685f},
-std::array<float,2>{0.4561297f, 0.255225956f},
-std::array<float,2>{0.598502398f, 0.684652567f},
-std::array<float,2>{0.240834013f, 0.939777434f},
-std::array<float,2>{0.781195045f, 0.176830679f},
-std::array<float,2>{0.0509328656f, 0.0299751274f},
-std::array<float,2>{0.886085927f, 0.800919294f},
-std::array<float,2>{0.299856097f, 0.519952416f},
-std::array<float,2>{0.709301651f, 0.391193956f},
-std::array<float,2>{0.436841965f, 0.11670655f},
-std::array<float,2>{0.530130863f, 0.83452332f},
-std::array<float,2>{0.155263886f, 0.582787097f},
-std::array<float,2>{0.853345215f, 0.465594351f},
-std::array<float,2>{0.0855355933f, 0.326745331f},
-std::array<float,2>{0.978551805f, 0.742043138f},
-std::array<float,2>{0.370767832f, 0.919014752f},
-std::array<float,2>{0.62893641f, 0.203643739f},
-std::array<float,2>{0.261002094f, 0.410549521f},
-std::array<float,2>{0.744835198f, 0.540385425f},
-std::array<float,2>{0.0205755234f, 0.764632642f},
-std::array<float,2>{0.933172047f, 0.0476335809f},
-std::array<float,2>{0.190897286f, 0.127316505f},
-std::array<float,2>{0.808537364f, 0.985728681f},
-std::array<float,2>{0.483991534f, 0.629195511f},
-std::array<float,2>{0.568839729f, 0.285728455f},
-std::array<float,2>{0.493885845f, 0.15974842f},
-std::array<float,2>{0.586831987f, 0.955108583f},
-std::array<float,2>{0.204196304f, 0.656469762f},
-std::array<float,2>{0.795916975f, 0.273269981f},
-std::array<float,2>{0.0104066739f, 0.384617984f},
-std::array<float,2>{0.918011785f, 0.502244234f},
-std::array<float,2>{0.270125389f, 0.786049187f},
-std::array<float,2>{0.73070848f, 0.00420339638f},
-std::array<float,2>{0.358469397f, 0.362104297f},
-std::array<float,2>{0.647229016f, 0.700006783f},
-std::array<float,2>{0.0635032579f, 0.887535453f},
-std::array<float,2>{0.996282279f, 0.225730672f},
-std::array<float,2>{0.128539711f, 0.0868746713f},
-std::array<float,2>{0.863986969f, 0.846272171f},
-std::array<float,2>{0.421231985f, 0.598542392f},
-std::array<float,2>{0.508075774f, 0.498036355f},
-std::array<float,2>{0.282356054f, 0.0410718173f},
-std::array<float,2>{0.692544103f, 0.773617148f},
-std::array<float,2>{0.0392347388f, 0.561527789f},
-std::array<float,2>{0.898517132f, 0.42397511f},
-std::array<float,2>{0.223086908f, 0.305593938f},
-std::array<float,2>{0.750964165f, 0.654522598f},
-std::array<float,2>{0.445530772f, 0.972964942f},
-std::array<float,2>{0.611689568f, 0.150228664f},
-std::array<float,2>{0.394817829f, 0.437829077f},
-std::array<float,2>{0.532740474f, 0.564148962f},
-std::array<float,2>{0.179398656f, 0.820250571f},
-std::array<float,2>{0.830299377f, 0.0975698382f},
-std::array<float,2>{0.118191689f, 0.198546365f},
-std::array<float,2>{0.941953719f, 0.930642307f},
-std::array<float,2>{0.339616686f, 0.726695001f},
-std::array<float,2>{0.667222917f, 0.338834107f},
-std::array<float,2>{0.274214923f, 0.140652701f},
-std::array<float,2>{0.718960583f, 0.978602409f},
-std::array<float,2>{0.00146164931f, 0.646053851f},
-std::array<float,2>{0.909467876f, 0.302783489f},
-std::array<float,2>{0.213888794f, 0.432683021f},
-std::array<float,2>{0.785864532f, 0.551296413f},
-std::array<float,2>{0.488913149f, 0.765891314f},
-std::array<float,2>{0.584826946f, 0.0367830284f},
-std::array<float,2>{0.409265071f, 0.329699159f},
-std::array<float,2>{0.506194651f, 0.724758565f},
-std::array<float,2>{0.134034902f, 0.924171329f},
-std::array<float,2>{0.871427953f, 0.192638278f},
-std::array<float,2>{0.0771526694f, 0.105430692f},
-std::array<float,2>{0.99005121f, 0.82663095f},
-std::array<float,2>{0.349838346f, 0.573215306f},
-std::array<float,2>{0.654958427f, 0.445875585f},
-std::array<float,2>{0.44437027f, 0.0101149455f},
-std::array<float,2>{0.622830093f, 0.791257024f},
-std::array<float,2>{0.233737186f, 0.508829534f},
-std::array<float,2>{0.761932492f, 0.380930841f},
-std::array<float,2>{0.0388987437f, 0.275611311f},
-std::array<float,2>{0.891847789f, 0.667231441f},
-std::array<float,2>{0.295902014f, 0.967297912f},
-std::array<float,2>{0.695364714f, 0.169097722f},
-std::array<float,2>{0.333776981f, 0.487946749f},
-std::array<float,2>{0.659092247f, 0.607046127f},
-std::array<float,2>{0.112611778f, 0.856390834f},
-std::array<float,2>{0.947113097f, 0.078644231f},
-std::array<float,2>{0.186445653f, 0.231599629f},
-std::array<float,2>{0.83756721f, 0.880243719f},
-std::array<float,2>{0.399915904f, 0.694913983f},
-std::array<float,2>{0.542057633f, 0.372693807f},
-std::array<float,2>{0.380230099f, 0.216285974f},
-std::array<float,2>{0.551759064f, 0.906780481f},
-std::array<float,2>{0.16789265f, 0.746610343f},
-std::array<float,2>{0.820749044f, 0.313020408f},
-std::array<float,2>{0.102227814f, 0.454676479f},
-std::array<float,2>{0.963138282f, 0.58883816f},
-std::array<float,2>{0.32561177f, 0.838867784f},
-std::array<float,2>{0.674349427f, 0.117717676f},
-std::array<float,2>{0.310606778f, 0.290684104f},
-std::array<float,2>{0.714470804f, 0.637330413f},
-std::array<float,2>{0.0612242818f, 0.997947335f},
-std::array<float,2>{0.876989007f, 0.133336902f},
-std::array<float,2>{0.245530427f, 0.0613418519f},
-std::array<float,2>{0.76857233f, 0.756664097f},
-std::array<float,2>{0.462186217f, 0.534405708f},
-std::array<float,2>{0.609078288f, 0.419633806f},
-std::array<float,2>{0.36171031f, 0.0733895078f},
-std::array<float,2>{0.638307929f, 0.867123425f},
-std::array<float,2>{0.0930006206f, 0.620555758f},
-std::array<float,2>{0.973692715f, 0.482823282f},
-std::array<float,2>{0.142772272f, 0.349906713f},
-std::array<float,2>{0.850900829f, 0.706677496f},
-std::array<float,2>{0.42876175f, 0.894481242f},
-std::array<float,2>{0.521492124f, 0.244863898f},
-std::array<float,2>{0.473576993f, 0.402427703f},
-std::array<float,2>{0.575897217f, 0.525820136f},
-std::array<float,2>{0.195978627f, 0.807984114f},
-std::array<float,2>{0.803833067f, 0.0228912719f},
-std::array<float,2>{0.0263719447f, 0.187286392f},
-std::array<float,2>{0.923469126f, 0.949199736f},
-std::array<float,2>{0.25721097f, 0.672870457f},
-std::array<float,2>{0.738379002f, 0.260818392f},
-std::array<float,2>{0.329349875f, 0.131835073f},
-std::array<float,2>{0.660616219f, 0.989497542f},
-std::array<float,2>{0.117020853f, 0.627063274f},
-std::array<float,2>{0.950614572f, 0.283558369f},
-std::array<float,2>{0.182316646f, 0.409779251f},
-std::array<float,2>{0.8423118f, 0.543501079f},
-std::array<float,2>{0.404532433f, 0.758846939f},
-std::array<float,2>{0.543238699f, 0.0537198856f},
-std::array<float,2>{0.439531088f, 0.322145492f},
-std::array<float,2>{0.621087492f, 0.736079216f},
-std::array<float,2>{0.229780316f, 0.916570365f},
-std::array<float,2>{0.760290205f, 0.210306197f},
-std::array<float,2>{0.0318437703f, 0.110360309f},
-std::array<float,2>{0.895131946f, 0.831486642f},
-std::array<float,2>{0.291235f, 0.578128934f},
-std::array<float,2>{0.699989438f, 0.462100178f},
-std::array<float,2>{0.412956774f, 0.0250271726f},
-std::array<float,2>{0.503870845f, 0.800539911f},
-std::array<float,2>{0.138971075f, 0.517932117f},
-std::array<float,2>{0.868732691f, 0.395418853f},
-std::array<float,2>{0.0731803998f, 0.250338733f},
-std::array<float,2>{0.987207353f, 0.681467772f},
-std::array<float,2>{0.345185518f, 0.944471717f},
-std::array<float,2>{0.648569286f, 0.172393948f},
-std::array<float,2>{0.280632555f, 0.473540813f},
-std::array<float,2>{0.724614263f, 0.615032732f},
-std::array<float,2>{0.00514794141f, 0.86846298f},
-std::array<float,2>{0.913348079f, 0.0635588691f},
-std::array<float,2>{0.216038212f, 0.235944927f},
-std::array<float,2>{0.781722844f, 0.905344129f},
-std::array<float,2>{0.484531432f, 0.71674192f},
-std::array<float,2>{0.581412613f, 0.35786435f},
-std::array<float,2>{0.469439536f, 0.201379716f},
-std::array<float,2>{0.572713137f, 0.93627131f},
-std::array<float,2>{0.202233315f, 0.734180272f},
-std::array<float,2>{0.798564792f, 0.341513932f},
-std::array<float,2>{0.0297390763f, 0.441505939f},
-std::array<float,2>{0.92926687f, 0.568241477f},
-std::array<float,2>{0.251831323f, 0.816074312f},
-std::array<float,2>{0.737688422f, 0.0983047262f},
-std::array<float,2>{0.363500357f, 0.312361121f},
-std::array<float,2>{0.63407892f, 0.649929941f},
-std::array<float,2>{0.0876188129f, 0.969535291f},
-std::array<float,2>{0.97028172f, 0.154969499f},
-std::array<float,2>{0.146208376f, 0.0460047424f},
-std::array<float,2>{0.846888304f, 0.780031919f},
-std::array<float,2>{0.425173372f, 0.555722535f},
-std::array<float,2>{0.515639544f, 0.428034991f},
-std::array<float,2>{0.305186003f, 0.0932406262f},
-std::array<float,2>{0.71629405f, 0.850636542f},
-std::array<float,2>{0.0572965369f, 0.595484912f},
-std::array<float,2>{0.879550874f, 0.494781911f},
-std::array<float,2>{0.247174725f, 0.365128994f},
-std::array<float,2>{0.771623135f, 0.698387384f},
-std::array<float,2>{0.466034025f, 0.883370161f},
-std::array<float,2>{0.604051471f, 0.21906431f},
-std::array<float,2>{0.378721476f, 0.386785984f},
-std::array<float,2>{0.550121427f, 0.506210148f},
-std::array<float,2>{0.168275818f, 0.782743692f},
-std::array<float,2>{0.824961364f, 0.000452258944f},
-std::array<float,2>{0.108158894f, 0.160695627f},
-std::array<float,2>{0.968672276f, 0.959804952f},
-std::array<float,2>{0.323074132f, 0.662797868f},
-std::array<float,2>{0.677921057f, 0.265652895f},
-std::array<float,2>{0.262809336f, 0.230107084f},
-std::array<float,2>{0.74864608f, 0.877730966f},
-std::array<float,2>{0.0188584439f, 0.689210951f},
-std::array<float,2>{0.936798692f, 0.369260788f},
-std::array<float,2>{0.193186611f, 0.488383502f},
-std::array<float,2>{0.808999062f, 0.603386998f},
-std::array<float,2>{0.479389489f, 0.855447531f},
-std::array<float,2>{0.562679827f, 0.085626848f},
-std::array<float,2>{0.431494385f, 0.280467004f},
-std::array<float,2>{0.525990248f, 0.671660483f},
-std::array<float,2>{0.151793852f, 0.964540184f},
-std::array<float,2>{0.85803467f, 0.167617634f},
-std::array<float,2>{0.079176493f, 0.0155007774f},
-std::array<float,2>{0.982194602f, 0.795365155f},
-std::array<float,2>{0.373918205f, 0.51455611f},
-std::array<float,2>{0.628294945f, 0.377830803f},
-std::array<float,2>{0.457497507f, 0.105543278f},
-std::array<float,2>{0.595495939f, 0.82113874f},
-std::array<float,2>{0.237622634f, 0.576694965f},
-std::array<float,2>{0.775808632f, 0.451251894f},
-std::array<float,2>{0.0484708957f, 0.332524389f},
-std::array<float,2>{0.887874663f, 0.71991092f},
-std::array<float,2>{0.301303416f, 0.927605629f},
-std::array<float,2>{0.705938876f, 0.190653503f},
-std::array<float,2>{0.319957316f, 0.43685326f},
-std::array<float,2>{0.681663096f, 0.547110856f},
-std::array<float,2>{0.0988365561f, 0.770153642f},
-std::array<float,2>{0.958495855f, 0.0338825099f},
-std::array<float,2>{0.16347596f, 0.147109702f},
-std::array<float,2>{0.813489556f, 0.982419133f},
-std::array<float,2>{0.38345468f, 0.643791258f},
-std::array<float,2>{0.559273601f, 0.300318152f},
-std::array<float,2>{0.390991896f, 0.180277303f},
-std::array<float,2>{0.536266863f, 0.952004492f},
-std::array<float,2>{0.172841698f, 0.676578343f},
-std::array<float,2>{0.834204614f, 0.263721138f},
-std::array<float,2>{0.121753216f, 0.401902854f},
-std::array<float,2>{0.940815568f, 0.527825296f},
-std::array<float,2>{0.343231261f, 0.810229421f},
-std::array<float,2>{0.671268106f, 0.0173618123f},
-std::array<float,2>{0.288352668f, 0.34749037f},
-std::array<float,2>{0.688834906f, 0.707634509f},
-std::array<float,2>{0.0449397974f, 0.897584677f},
-std::array<float,2>{0.903167069f, 0.246565357f},
-std::array<float,2>{0.220496461f, 0.0768941492f},
-std::array<float,2>{0.757785082f, 0.863272429f},
-std::array<float,2>{0.450166255f, 0.624193072f},
-std::array<float,2>{0.614488006f, 0.480291456f},
-std::array<float,2>{0.354784846f, 0.0563482828f},
-std::array<float,2>{0.64226979f, 0.753112197f},
-std::array<float,2>{0.0664961636f, 0.53838706f},
-std::array<float,2>{0.993912041f, 0.416535228f},
-std::array<float,2>{0.129096389f, 0.293175012f},
-std::array<float,2>{0.859799087f, 0.636395752f},
-std::array<float,2>{0.41775462f, 0.992290199f},
-std::array<float,2>{0.512558937f, 0.139643043f},
-std::array<float,2>{0.496725112f, 0.458940774f},
-std::array<float,2>{0.593615294f, 0.590272248f},
-std::array<float,2>{0.209061861f, 0.842576385f},
-std::array<float,2>{0.79289037f, 0.122505911f},
-std::array<float,2>{0.0136590805f, 0.212061286f},
-std::array<float,2>{0.916537285f, 0.910608649f},
-std::array<float,2>{0.269511908f, 0.743933558f},
-std::array<float,2>{0.727411091f, 0.316475511f},
-std::array<float,2>{0.367252231f, 0.205611572f},
-std::array<float,2>{0.632301092f, 0.921395659f},
-std::array<float,2>{0.0839291289f, 0.73959887f},
-std::array<float,2>{0.977407455f, 0.324399322f},
-std::array<float,2>{0.152947426f, 0.467941612f},
-std::array<float,2>{0.853810608f, 0.585745931f},
-std::array<float,2>{0.433850437f, 0.832121253f},
-std::array<float,2>{0.528135061f, 0.114587389f},
-std::array<float,2>{0.481082559f, 0.287727237f},
-std::array<float,2>{0.567628801f, 0.632171631f},
-std::array<float,2>{0.189053103f, 0.987324178f},
-std::array<float,2>{0.804781556f, 0.126002297f},
-std::array<float,2>{0.0225799233f, 0.0494792759f},
-std::array<float,2>{0.930929422f, 0.761783242f},
-std::array<float,2>{0.258145601f, 0.542437255f},
-std::array<float,2>{0.743935943f, 0.41237995f},
-std::array<float,2>{0.387544334f, 0.067536965f},
-std::array<float,2>{0.557279885f, 0.872295976f},
-std::array<float,2>{0.158465832f, 0.610948503f},
-std::array<float,2>{0.817986965f, 0.469432324f},
-std::array<float,2>{0.0972743407f, 0.351985306f},
-std::array<float,2>{0.956115305f, 0.713962734f},
-std::array<float,2>{0.312740237f, 0.900386155f},
-std::array<float,2>{0.686389267f, 0.239093468f},
-std::array<float,2>{0.297424108f, 0.39400506f},
-std::array<float,2>{0.70761162f, 0.522392213f},
-std::array<float,2>{0.0546492152f, 0.803029716f},
-std::array<float,2>{0.8838799f, 0.0292005371f},
-std::array<float,2>{0.239456654f, 0.179057837f},
-std::array<float,2>{0.779134154f, 0.938295782f},
-std::array<float,2>{0.453953028f, 0.686935961f},
-std::array<float,2>{0.600289583f, 0.257278681f},
-std::array<float,2>{0.447506696f, 0.150761768f},
-std::array<float,2>{0.61058712f, 0.975187123f},
-std::array<float,2>{0.224979773f, 0.653623521f},
-std::array<float,2>{0.75285089f, 0.307914734f},
-std::array<float,2>{0.0418522283f, 0.422631234f},
-std::array<float,2>{0.901055098f, 0.559789896f},
-std::array<float,2>{0.283807844f, 0.775582314f},
-std::array<float,2>{0.694342971f, 0.0402723961f},
-std::array<float,2>{0.33656913f, 0.336356997f},
-std::array<float,2>{0.664727569f, 0.728844225f},
-std::array<float,2>{0.119479701f, 0.932980478f},
-std::array<float,2>{0.943638682f, 0.195845976f},
-std::array<float,2>{0.176594034f, 0.0955573246f},
-std::array<float,2>{0.828309119f, 0.816996634f},
-std::array<float,2>{0.397033423f, 0.56607312f},
-std::array<float,2>{0.535063744f, 0.440263659f},
-std::array<float,2>{0.271903872f, 0.00738157239f},
-std::array<float,2>{0.73278302f, 0.788224697f},
-std::array<float,2>{0.00915147085f, 0.501897275f},
-std::array<float,2>{0.920550287f, 0.385709554f},
-std::array<float,2>{0.206557661f, 0.271230221f},
-std::array<float,2>{0.794073164f, 0.659244359f},
-std::array<float,2>{0.495106548f, 0.95492363f},
-std::array<float,2>{0.588985443f, 0.156374454f},
-std::array<float,2>{0.419331521f, 0.498086363f},
-std::array<float,2>{0.510455787f, 0.60092926f},
-std::array<float,2>{0.126059353f, 0.84424758f},
-std::array<float,2>{0.865701616f, 0.0897607356f},
-std::array<float,2>{0.0644822493f, 0.22360608f},
-std::array<float,2>{0.998660684f, 0.889692485f},
-std::array<float,2>{0.357407868f, 0.701668262f},
-std::array<float,2>{0.645643651f, 0.361043751f},
-std::array<float,2>{0.294799179f, 0.171225011f},
-std::array<float,2>{0.698102176f, 0.965491474f},
-std::array<float,2>{0.0357029513f, 0.66530472f},
-std::array<float,2>{0.892895937f, 0.273917288f},
-std::array<float,2>{0.232375726f, 0.380641133f},
-std::array<float,2>{0.765054822f, 0.511393964f},
-std::array<float,2>{0.441623867f, 0.790903389f},
-std::array<float,2>{0.624449492f, 0.00855989289f},
-std::array<float,2>{0.400982887f, 0.373504877f},
-std::array<float,2>{0.540842295f, 0.69187969f},
-std::array<float,2>{0.184146971f, 0.882596731f},
-std::array<float,2>{0.838885009f, 0.233178318f},
-std::array<float,2>{0.110171892f, 0.0820230842f},
-std::array<float,2>{0.947430015f, 0.85884279f},
-std::array<float,2>{0.33504048f, 0.60806936f},
-std::array<float,2>{0.657732606f, 0.485251755f},
-std::array<float,2>{0.49026674f, 0.0390174091f},
-std::array<float,2>{0.58271265f, 0.769109726f},
-std::array<float,2>{0.211503863f, 0.553941429f},
-std::array<float,2>{0.787730455f, 0.431046218f},
-std::array<float,2>{0.00272275298f, 0.301148206f},
-std::array<float,2>{0.906993985f, 0.646715105f},
-std::array<float,2>{0.276871204f, 0.978413641f},
-std::array<float,2>{0.722148716f, 0.142905876f},
-std::array<float,2>{0.347773075f, 0.44845888f},
-std::array<float,2>{0.653785229f, 0.57049644f},
-std::array<float,2>{0.075873293f, 0.82615459f},
-std::array<float,2>{0.99120903f, 0.101819545f},
-std::array<float,2>{0.136434272f, 0.194052145f},
-std::array<float,2>{0.873663664f, 0.92340821f},
-std::array<float,2>{0.407850355f, 0.724305511f},
-std::array<float,2>{0.504278362f, 0.330527067f},
-std::array<float,2>{0.426565349f, 0.243737027f},
-std::array<float,2>{0.520786583f, 0.890688837f},
-std::array<float,2>{0.142196447f, 0.703418553f},
-std::array<float,2>{0.848866701f, 0.348259717f},
-std::array<float,2>{0.090304181f, 0.481223643f},
-std::array<float,2>{0.9760831f, 0.617243946f},
-std::array<float,2>{0.3610892f, 0.863993704f},
-std::array<float,2>{0.64039278f, 0.0703395829f},
-std::array<float,2>{0.254067451f, 0.259673089f},
-std::array<float,2>{0.741940081f, 0.675246f},
-std::array<float,2>{0.0245689135f, 0.94574362f},
-std::array<float,2>{0.924922764f, 0.184215069f},
-std::array<float,2>{0.197771624f, 0.0212238319f},
-std::array<float,2>{0.802651882f, 0.805883229f},
-std::array<float,2>{0.475627512f, 0.523677945f},
-std::array<float,2>{0.576665521f, 0.40544948f},
-std::array<float,2>{0.326181442f, 0.120445915f},
-std::array<float,2>{0.673588753f, 0.837587655f},
-std::array<float,2>{0.10533198f, 0.586087346f},
-std::array<float,2>{0.961620569f, 0.455250859f},
-std::array<float,2>{0.164931431f, 0.314864248f},
-std::array<float,2>{0.824012756f, 0.74866724f},
-std::array<float,2>{0.382800788f, 0.908347011f},
-std::array<float,2>{0.55368638f, 0.2175356f},
-std::array<float,2>{0.463811994f, 0.421061546f},
-std::array<float,2>{0.607096553f, 0.532754838f},
-std::array<float,2>{0.243034378f, 0.754348516f},
-std::array<float,2>{0.76598686f, 0.0589054413f},
-std::array<float,2>{0.0599655509f, 0.134953856f},
-std::array<float,2>{0.876297355f, 0.998804092f},
-std::array<float,2>{0.308754265f, 0.640398681f},
-std::array<float,2>{0.711255908f, 0.292180717f},
-std::array<float,2>{0.324158043f, 0.162995905f},
-std::array<float,2>{0.67888099f, 0.958750308f},
-std::array<float,2>{0.108708225f, 0.660741925f},
-std::array<float,2>{0.967348456f, 0.268332899f},
-std::array<float,2>{0.169374287f, 0.389285415f},
-std::array<float,2>{0.825994134f, 0.504026115f},
-std::array<float,2>{0.377357215f, 0.783854723f},
-std::array<float,2>{0.549644589f, 0.00250713504f},
-std::array<float,2>{0.465362489f, 0.36661604f},
-std::array<float,2>{0.605319858f, 0.69612056f},
-std::array<float,2>{0.246617466f, 0.88511759f},
-std::array<float,2>{0.773074687f, 0.222629383f},
-std::array<float,2>{0.058457125f, 0.0910569802f},
-std::array<float,2>{0.880184054f, 0.847817004f},
-std::array<float,2>{0.30661118f, 0.596366048f},
-std::array<float,2>{0.715007782f, 0.493964493f},
-std::array<float,2>{0.42479375f, 0.0430975147f},
-std::array<float,2>{0.516974449f, 0.777863741f},
-std::array<float,2>{0.14479661f, 0.557133377f},
-std::array<float,2>{0.845717311f, 0.42728737f},
-std::array<float,2>{0.0866704285f, 0.308720469f},
-std::array<float,2>{0.969539165f, 0.651849389f},
-std::array<float,2>{0.364777416f, 0.971889734f},
-std::array<float,2>{0.633199334f, 0.152577162f},
-std::array<float,2>{0.25086695f, 0.444833785f},
-std::array<float,2>{0.736756861f, 0.569053888f},
-std::array<float,2>{0.0310638901f, 0.812547147f},
-std::array<float,2>{0.927932203f, 0.101332366f},
-std::array<float,2>{0.201589599f, 0.201031551f},
-std::array<float,2>{0.797286093f, 0.934281826f},
-std::array<float,2>{0.470652997f, 0.732063949f},
-std::array<float,2>{0.573900998f, 0.342351764f},
-std::array<float,2>{0.485360503f, 0.237173289f},
-std::array<float,2>{0.580679417f, 0.903567255f},
-std::array<float,2>{0.215566784f, 0.717937768f},
-std::array<float,2>{0.782350481f, 0.357237339f},
-std::array<float,2>{0.00455675693f, 0.476323307f},
-std::array<float,2>{0.912291288f, 0.617029071f},
-std::array<float,2>{0.280004084f, 0.869560182f},
-std::array<float,2>{0.726313531f, 0.0662099123f},
-std::array<float,2>{0.343766719f, 0.253351331f},
-std::array<float,2>{0.64971751f, 0.681968987f},
-std::array<float,2>{0.073795937f, 0.942722261f},
-std::array<float,2>{0.987858593f, 0.174017966f},
-std::array<float,2>{0.14038223f, 0.0258197691f},
-std::array<float,2>{0.867449999f, 0.798656762f},
-std::array<float,2>{0.413666785f, 0.516150653f},
-std::array<float,2>{0.502438307f, 0.397189528f},
-std::array<float,2>{0.292680174f, 0.113245368f},
-std::array<float,2>{0.700618982f, 0.828960121f},
-std::array<float,2>{0.033152312f, 0.581592381f},
-std::array<float,2>{0.895574927f, 0.462929636f},
-std::array<float,2>{0.228945404f, 0.322787732f},
-std::array<float,2>{0.761134505f, 0.737210274f},
-std::array<float,2>{0.440972507f, 0.914716065f},
-std::array<float,2>{0.619526744f, 0.207851574f},
-std::array<float,2>{0.406062037f, 0.407250524f},
-std::array<float,2>{0.544106781f, 0.545090616f},
-std::array<float,2>{0.182925999f, 0.76136601f},
-std::array<float,2>{0.843479455f, 0.051020734f},
-std::array<float,2>{0.115901314f, 0.129365146f},
-std::array<float,2>{0.949228942f, 0.99106735f},
-std::array<float,2>{0.328671008f, 0.626005888f},
-std::array<float,2>{0.661595523f, 0.282205939f},
-std::array<float,2>{0.267583638f, 0.213803485f},
-std::array<float,2>{0.728125453f, 0.913668334f},
-std::array<float,2>{0.0125037171f, 0.745200634f},
-std::array<float,2>{0.917427003f, 0.320046425f},
-std::array<float,2>{0.210586056f, 0.460190415f},
-std::array<float,2>{0.791178465f, 0.591806829f},
-std::array<float,2>{0.497968316f, 0.841210425f},
-std::array<float,2>{0.592167795f, 0.124381438f},
-std::array<float,2>{0.416122079f, 0.296074361f},
-std::array<float,2>{0.513335943f, 0.63327229f},
-std::array<float,2>{0.130775079f, 0.994677722f},
-std::array<float,2>{0.860856533f, 0.137345642f},
-std::array<float,2>{0.0683171824f, 0.0583678f},
-std::array<float,2>{0.99277842f, 0.750171721f},
-std::array<float,2>{0.354202241f, 0.535996079f},
-std::array<float,2>{0.64159584f, 0.415535003f},
-std::array<float,2>{0.45060882f, 0.0761389807f},
-std::array<float,2>{0.614227116f, 0.860296071f},
-std::array<float,2>{0.219343916f, 0.621812284f},
-std::array<float,2>{0.756249309f, 0.477177411f},
-std::array<float,2>{0.0462865382f, 0.344578475f},
-std::array<float,2>{0.904186189f, 0.710414231f},
-std::array<float,2>{0.287430078f, 0.894885302f},
-std::array<float,2>{0.68836534f, 0.2484736f},
-std::array<float,2>{0.342415303f, 0.400062829f},
-std::array<float,2>{0.670386434f, 0.530954659f},
-std::array<float,2>{0.122749634f, 0.810755432f},
-std::array<float,2>{0.939891756f, 0.0180048291f},
-std::array<float,2>{0.173339814f, 0.183458433f},
-std::array<float,2>{0.835193753f, 0.950826168f},
-std::array<float,2>{0.392240614f, 0.679211259f},
-std::array<float,2>{0.535463274f, 0.262754679f},
-std::array<float,2>{0.384398878f, 0.146371543f},
-std::array<float,2>{0.559598327f, 0.983134866f},
-std::array<float,2>{0.162918329f, 0.641686141f},
-std::array<float,2>{0.813107014f, 0.297801763f},
-std::array<float,2>{0.0979254991f, 0.434807301f},
-std::array<float,2>{0.957228065f, 0.549075127f},
-std::array<float,2>{0.318366587f, 0.772523284f},
-std::array<float,2>{0.682858288f, 0.0314047039f},
-std::array<float,2>{0.302298576f, 0.335935175f},
-std::array<float,2>{0.706163466f, 0.721786797f},
-std::array<float,2>{0.0472646542f, 0.928234398f},
-std::array<float,2>{0.886788189f, 0.188671857f},
-std::array<float,2>{0.236343712f, 0.108241051f},
-std::array<float,2>{0.77726233f, 0.822734058f},
-std::array<float,2>{0.458076119f, 0.575843394f},
-std::array<float,2>{0.594276905f, 0.449769616f},
-std::array<float,2>{0.374088198f, 0.0125560341f},
-std::array<float,2>{0.627082109f, 0.794590771f},
-std::array<float,2>{0.07834775f, 0.512822151f},
-std::array<float,2>{0.981306732f, 0.376693934f},
-std::array<float,2>{0.151225835f, 0.277959675f},
-std::array<float,2>{0.858867228f, 0.669633508f},
-std::array<float,2>{0.429764628f, 0.961610019f},
-std::array<float,2>{0.52732873f, 0.165853009f},
-std::array<float,2>{0.479546696f, 0.491823673f},
-std::array<float,2>{0.563764155f, 0.604263067f},
-std::array<float,2>{0.191974908f, 0.852675736f},
-std::array<float,2>{0.809782326f, 0.0823648572f},
-std::array<float,2>{0.0184976589f, 0.226863429f},
-std::array<float,2>{0.936399281f, 0.875696242f},
-std::array<float,2>{0.261837453f, 0.691355705f},
-std::array<float,2>{0.749341607f, 0.368432283f},
-std::array<float,2>{0.356278569f, 0.225046188f},
-std::array<float,2>{0.644873619f, 0.888336658f},
-std::array<float,2>{0.0656866729f, 0.70038569f},
-std::array<float,2>{0.99953562f, 0.362333655f},
-std::array<float,2>{0.125839695f, 0.496913254f},
-std::array<float,2>{0.867178261f, 0.598889649f},
-std::array<float,2>{0.418838918f, 0.847601712f},
-std::array<float,2>{0.510888994f, 0.0871616527f},
-std::array<float,2>{0.49513638f, 0.272008181f},
-std::array<float,2>{0.58800751f, 0.657441199f},
-std::array<float,2>{0.205175981f, 0.95645237f},
-std::array<float,2>{0.793734968f, 0.159144625f},
-std::array<float,2>{0.00796140265f, 0.00498036714f},
-std::array<float,2>{0.92126745f, 0.786687374f},
-std::array<float,2>{0.272761583f, 0.503739774f},
-std::array<float,2>{0.734259009f, 0.383538067f},
-std::array<float,2>{0.397835612f, 0.0961159691f},
-std::array<float,2>{0.533992946f, 0.819091201f},
-std::array<float,2>{0.177591652f, 0.563277185f},
-std::array<float,2>{0.829131484f, 0.43896395f},
-std::array<float,2>{0.120689303f, 0.339417487f},
-std::array<float,2>{0.94466114f, 0.728435516f},
-std::array<float,2>{0.337323964f, 0.931304574f},
-std::array<float,2>{0.665353656f, 0.19820939f},
-std::array<float,2>{0.284555614f, 0.42492336f},
-std::array<float,2>{0.693660855f, 0.560648739f},
-std::array<float,2>{0.0426691212f, 0.775116265f},
-std::array<float,2>{0.901814818f, 0.0428345948f},
-std::array<float,2>{0.226277351f, 0.149182603f},
-std::array<float,2>{0.753514051f, 0.974237323f},
-std::array<float,2>{0.449083567f, 0.655758798f},
-std::array<float,2>{0.610322893f, 0.306030214f},
-std::array<float,2>{0.455045581f, 0.176509023f},
-std::array<float,2>{0.601097345f, 0.940882027f},
-std::array<float,2>{0.238990128f, 0.684146523f},
-std::array<float,2>{0.777531147f, 0.254476875f},
-std::array<float,2>{0.0531112552f, 0.392488033f},
-std::array<float,2>{0.88347429f, 0.520921826f},
-std::array<float,2>{0.298533142f, 0.801951408f},
-std::array<float,2>{0.708378673f, 0.0302974619f},
-std::array<float,2>{0.313804626f, 0.354076505f},
-std::array<float,2>{0.686625302f, 0.712036252f},
-std::array<float,2>{0.0957366154f, 0.901385665f},
-std::array<float,2>{0.95565778f, 0.241996363f},
-std::array<float,2>{0.15926154f, 0.0698228627f},
-std::array<float,2>{0.816839814f, 0.873979807f},
-std::array<float,2>{0.387967229f, 0.612219989f},
-std::array<float,2>{0.558560967f, 0.471261233f},
-std::array<float,2>{0.258821636f, 0.0479020923f},
-std::array<float,2>{0.742723703f, 0.764790952f},
-std::array<float,2>{0.0219521802f, 0.539318383f},
-std::array<float,2>{0.930609643f, 0.411979407f},
-std::array<float,2>{0.188174441f, 0.286476046f},
-std::array<float,2>{0.806494355f, 0.630469859f},
-std::array<float,2>{0.4817954f, 0.984809458f},
-std::array<float,2>{0.566711962f, 0.128384188f},
-std::array<float,2>{0.434885502f, 0.465887308f},
-std::array<float,2>{0.528722882f, 0.583825827f},
-std::array<float,2>{0.153950796f, 0.83507663f},
-std::array<float,2>{0.854679823f, 0.116043039f},
-std::array<float,2>{0.0823559612f, 0.204874113f},
-std::array<float,2>{0.977702856f, 0.918707967f},
-std::array<float,2>{0.368686676f, 0.740413904f},
-std::array<float,2>{0.630908549f, 0.327593893f},
-std::array<float,2>{0.309751421f, 0.134189129f},
-std::array<float,2>{0.711934686f, 0.996620715f},
-std::array<float,2>{0.0591853261f, 0.638569891f},
-std::array<float,2>{0.875377297f, 0.290034384f},
-std::array<float,2>{0.244028792f, 0.418397993f},
-std::array<float,2>{0.766940773f, 0.533220887f},
-std::array<float,2>{0.464818388f, 0.756878376f},
-std::array<float,2>{0.605664849f, 0.0618715286f},
-std::array<float,2>{0.381267369f, 0.313726366f},
-std::array<float,2>{0.554350078f, 0.747619748f},
-std::array<float,2>{0.16515179f, 0.907584071f},
-std::array<float,2>{0.822360635f, 0.215479434f},
-std::array<float,2>{0.103731722f, 0.118746631f},
-std::array<float,2>{0.962002635f, 0.838218868f},
-std::array<float,2>{0.327601016f, 0.589114368f},
-std::array<float,2>{0.672068179f, 0.454063296f},
-std::array<float,2>{0.47523728f, 0.0220373496f},
-std::array<float,2>{0.578002691f, 0.80713433f},
-std::array<float,2>{0.199080661f, 0.52705574f},
-std::array<float,2>{0.800906241f, 0.404007018f},
-std::array<float,2>{0.0239086617f, 0.260431588f},
-std::array<float,2>{0.924471259f, 0.6725927f},
-std::array<float,2>{0.255103856f, 0.948153019f},
-std::array<float,2>{0.740788639f, 0.186381832f},
-std::array<float,2>{0.360283911f, 0.483805388f},
-std::array<float,2>{0.639216721f, 0.619431138f},
-std::array<float,2>{0.0908677503f, 0.866123378f},
-std::array<float,2>{0.974990427f, 0.0729913116f},
-std::array<float,2>{0.141524106f, 0.245457694f},
-std::array<float,2>{0.848389566f, 0.893419802f},
-std::array<float,2>{0.427428842f, 0.705422461f},
-std::array<float,2>{0.520244479f, 0.350891441f},
-std::array<float,2>{0.407066077f, 0.192377701f},
-std::array<float,2>{0.505443811f, 0.925076246f},
-std::array<float,2>{0.135162741f, 0.726336718f},
-std::array<float,2>{0.874213398f, 0.328494817f},
-std::array<float,2>{0.0746021345f, 0.446778387f},
-std::array<float,2>{0.991580248f, 0.574045658f},
-std::array<float,2>{0.348807484f, 0.827803552f},
-std::array<float,2>{0.653082907f, 0.103584379f},
-std::array<float,2>{0.275778234f, 0.303979009f},
-std::array<float,2>{0.720857203f, 0.64481467f},
-std::array<float,2>{0.00349572115f, 0.979497313f},
-std::array<float,2>{0.907399058f, 0.141916707f},
-std::array<float,2>{0.212727875f, 0.0360660776f},
-std::array<float,2>{0.788222432f, 0.767367959f},
-std::array<float,2>{0.49141264f, 0.552067041f},
-std::array<float,2>{0.583669841f, 0.432275057f},
-std::array<float,2>{0.334101886f, 0.079736948f},
-std::array<float,2>{0.657042384f, 0.856452048f},
-std::array<float,2>{0.111133419f, 0.605625272f},
-std::array<float,2>{0.948711872f, 0.486639529f},
-std::array<float,2>{0.185068414f, 0.371304214f},
-std::array<float,2>{0.838815689f, 0.69396764f},
-std::array<float,2>{0.401425809f, 0.879274726f},
-std::array<float,2>{0.539993227f, 0.231230333f},
-std::array<float,2>{0.443265587f, 0.382506758f},
-std::array<float,2>{0.623942494f, 0.508036077f},
-std::array<float,2>{0.231403485f, 0.792954624f},
-std::array<float,2>{0.763914347f, 0.0116857514f},
-std::array<float,2>{0.0370415747f, 0.168494433f},
-std::array<float,2>{0.893961728f, 0.968202829f},
-std::array<float,2>{0.293437183f, 0.666649222f},
-std::array<float,2>{0.698687494f, 0.27650556f},
-std::array<float,2>{0.365625799f, 0.156223625f},
-std::array<float,2>{0.635263324f, 0.970547736f},
-std::array<float,2>{0.0881637633f, 0.649033606f},
-std::array<float,2>{0.970907867f, 0.310685962f},
-std::array<float,2>{0.1471183f, 0.428759724f},
-std::array<float,2>{0.845192194f, 0.555091739f},
-std::array<float,2>{0.422290951f, 0.780860126f},
-std::array<float,2>{0.51859951f, 0.0449553616f},
-std::array<float,2>{0.471290648f, 0.340476692f},
-std::array<float,2>{0.571528316f, 0.733321011f},
-std::array<float,2>{0.200909287f, 0.936523497f},
-std::array<float,2>{0.799649835f, 0.20263508f},
-std::array<float,2>{0.0274259746f, 0.0991492197f},
-std::array<float,2>{0.92705667f, 0.81457597f},
-std::array<float,2>{0.252346486f, 0.566495776f},
-std::array<float,2>{0.73615545f, 0.442899406f},
-std::array<float,2>{0.375831395f, 0.00116543239f},
-std::array<float,2>{0.547557712f, 0.782160819f},
-std::array<float,2>{0.171227619f, 0.507785082f},
-std::array<float,2>{0.828021348f, 0.388076574f},
-std::array<float,2>{0.106749833f, 0.267231882f},
-std::array<float,2>{0.966669202f, 0.663938224f},
-std::array<float,2>{0.320673913f, 0.960587561f},
-std::array<float,2>{0.676879704f, 0.161973894f},
-std::array<float,2>{0.306962758f, 0.495524824f},
-std::array<float,2>{0.717048526f, 0.59435761f},
-std::array<float,2>{0.0549846888f, 0.849660814f},
-std::array<float,2>{0.881130099f, 0.0924921408f},
-std::array<float,2>{0.249260113f, 0.220148623f},
-std::array<float,2>{0.770901024f, 0.883835733f},
-std::array<float,2>{0.467111081f, 0.697534382f},
-std::array<float,2>{0.603473127f, 0.363816112f},
-std::array<float,2>{0.439094901f, 0.209151566f},
-std::array<float,2>{0.61895591f, 0.917675436f},
-std::array<float,2>{0.227400213f, 0.734959126f},
-std::array<float,2>{0.75891161f, 0.320506275f},
-std::array<float,2>{0.0341791883f, 0.461006939f},
-std::array<float,2>{0.89738977f, 0.579940438f},
-std::array<float,2>{0.29058823f, 0.830643237f},
-std::array<float,2>{0.702539206f, 0.110263057f},
-std::array<float,2>{0.331565887f, 0.284207702f},
-std::array<float,2>{0.663053513f, 0.628088117f},
-std::array<float,2>{0.113650143f, 0.989192545f},
-std::array<float,2>{0.951335728f, 0.132773176f},
-std::array<float,2>{0.181526423f, 0.0529301278f},
-std::array<float,2>{0.841349781f, 0.758470953f},
-std::array<float,2>{0.403925419f, 0.54444921f},
-std::array<float,2>{0.54601711f, 0.408703476f},
-std::array<float,2>{0.278068811f, 0.0630240664f},
-std::array<float,2>{0.723827302f, 0.867739439f},
-std::array<float,2>{0.00635580579f, 0.614116311f},
-std::array<float,2>{0.911595821f, 0.474587381f},
-std::array<float,2>{0.21703659f, 0.358642548f},
-std::array<float,2>{0.784633696f, 0.715744913f},
-std::array<float,2>{0.48727116f, 0.904605448f},
-std::array<float,2>{0.578380942f, 0.234657228f},
-std::array<float,2>{0.411025286f, 0.396445096f},
-std::array<float,2>{0.500912368f, 0.51880306f},
-std::array<float,2>{0.138595611f, 0.799259603f},
-std::array<float,2>{0.869605243f, 0.0241107084f},
-std::array<float,2>{0.0711625144f, 0.173583001f},
-std::array<float,2>{0.984442651f, 0.943635166f},
-std::array<float,2>{0.347508699f, 0.68042922f},
-std::array<float,2>{0.650469244f, 0.25166294f},
-std::array<float,2>{0.286912292f, 0.247115612f},
-std::array<float,2>{0.69042784f, 0.897136033f},
-std::array<float,2>{0.0435907133f, 0.708320975f},
-std::array<float,2>{0.906203747f, 0.346303642f},
-std::array<float,2>{0.222302333f, 0.479063839f},
-std::array<float,2>{0.755837202f, 0.623144388f},
-std::array<float,2>{0.451174587f, 0.861967802f},
-std::array<float,2>{0.61660713f, 0.0771714002f},
-std::array<float,2>{0.393473715f, 0.265265107f},
-std::array<float,2>{0.538286746f, 0.677198052f},
-std::array<float,2>{0.174766108f, 0.952923f},
-std::array<float,2>{0.832607329f, 0.1812765f},
-std::array<float,2>{0.124491543f, 0.0160424542f},
-std::array<float,2>{0.939439416f, 0.809153378f},
-std::array<float,2>{0.340447903f, 0.529239714f},
-std::array<float,2>{0.669404626f, 0.40065369f},
-std::array<float,2>{0.499384165f, 0.1216437f},
-std::array<float,2>{0.590153456f, 0.843748033f},
-std::array<float,2>{0.207845941f, 0.590909839f},
-std::array<float,2>{0.789078057f, 0.457851171f},
-std::array<float,2>{0.0140749663f, 0.317487925f},
-std::array<float,2>{0.915380597f, 0.74307245f},
-std::array<float,2>{0.266938955f, 0.911999762f},
-std::array<float,2>{0.729288161f, 0.211343899f},
-std::array<float,2>{0.352030277f, 0.417681366f},
-std::array<float,2>{0.644527137f, 0.537395358f},
-std::array<float,2>{0.0684627444f, 0.752715945f},
-std::array<float,2>{0.995983481f, 0.0549208671f},
-std::array<float,2>{0.131490082f, 0.140224606f},
-std::array<float,2>{0.862175822f, 0.993953884f},
-std::array<float,2>{0.415405989f, 0.635092735f},
-std::array<float,2>{0.514774442f, 0.294245064f},
-std::array<float,2>{0.43242234f, 0.166193381f},
-std::array<float,2>{0.524640739f, 0.963434219f},
-std::array<float,2>{0.150289014f, 0.670188844f},
-std::array<float,2>{0.857127607f, 0.279407591f},
-std::array<float,2>{0.0818273351f, 0.378354222f},
-std::array<float,2>{0.983068645f, 0.515401244f},
-std::array<float,2>{0.372904211f, 0.796010494f},
-std::array<float,2>{0.626564205f, 0.0143683255f},
-std::array<float,2>{0.264265269f, 0.370472819f},
-std::array<float,2>{0.746941388f, 0.687608898f},
-std::array<float,2>{0.0171424076f, 0.878205478f},
-std::array<float,2>{0.935049236f, 0.228853285f},
-std::array<float,2>{0.195109606f, 0.0843334347f},
-std::array<float,2>{0.811227262f, 0.853936076f},
-std::array<float,2>{0.476867348f, 0.602185965f},
-std::array<float,2>{0.56470418f, 0.489547729f},
-std::array<float,2>{0.317340076f, 0.0348625779f},
-std::array<float,2>{0.681462646f, 0.77123791f},
-std::array<float,2>{0.101235062f, 0.548815608f},
-std::array<float,2>{0.95980525f, 0.435706526f},
-std::array<float,2>{0.160312951f, 0.299741775f},
-std::array<float,2>{0.815240383f, 0.64345932f},
-std::array<float,2>{0.385921299f, 0.981017351f},
-std::array<float,2>{0.5614838f, 0.147690982f},
-std::array<float,2>{0.460874349f, 0.45258972f},
-std::array<float,2>{0.597189248f, 0.577542603f},
-std::array<float,2>{0.234856516f, 0.821514666f},
-std::array<float,2>{0.773916543f, 0.107065737f},
-std::array<float,2>{0.0497022644f, 0.190220177f},
-std::array<float,2>{0.88999325f, 0.925892591f},
-std::array<float,2>{0.303016335f, 0.718983471f},
-std::array<float,2>{0.704919934f, 0.333577543f},
-std::array<float,2>{0.338838339f, 0.196328804f},
-std::array<float,2>{0.66677779f, 0.931664288f},
-std::array<float,2>{0.118032008f, 0.730117321f},
-std::array<float,2>{0.943080604f, 0.337057084f},
-std::array<float,2>{0.177859783f, 0.441031307f},
-std::array<float,2>{0.831699491f, 0.565128505f},
-std::array<float,2>{0.395712733f, 0.817844272f},
-std::array<float,2>{0.532144427f, 0.0939049348f},
-std::array<float,2>{0.446323484f, 0.306905657f},
-std::array<float,2>{0.612461388f, 0.652547002f},
-std::array<float,2>{0.22395964f, 0.97593087f},
-std::array<float,2>{0.751877844f, 0.151817977f},
-std::array<float,2>{0.0403888971f, 0.0395549908f},
-std::array<float,2>{0.900163591f, 0.77672869f},
-std::array<float,2>{0.28205815f, 0.558858573f},
-std::array<float,2>{0.691742301f, 0.423164457f},
-std::array<float,2>{0.420690686f, 0.0882110074f},
-std::array<float,2>{0.508927226f, 0.845325649f},
-std::array<float,2>{0.127020001f, 0.599792659f},
-std::array<float,2>{0.864275634f, 0.499924868f},
-std::array<float,2>{0.0633936822f, 0.35971576f},
-std::array<float,2>{0.997625232f, 0.702556431f},
-std::array<float,2>{0.357718676f, 0.889478505f},
-std::array<float,2>{0.64830333f, 0.224041238f},
-std::array<float,2>{0.271129102f, 0.386249453f},
-std::array<float,2>{0.731674016f, 0.500937045f},
-std::array<float,2>{0.0107507715f, 0.787550509f},
-std::array<float,2>{0.919333816f, 0.00660448102f},
-std::array<float,2>{0.203686029f, 0.157914996f},
-std::array<float,2>{0.795880258f, 0.953581095f},
-std::array<float,2>{0.492639005f, 0.658850133f},
-std::array<float,2>{0.587092042f, 0.270082504f},
-std::array<float,2>{0.482998729f, 0.125663176f},
-std::array<float,2>{0.56942755f, 0.986809492f},
-std::array<float,2>{0.190015733f, 0.631347477f},
-std::array<float,2>{0.806659102f, 0.288409948f},
-std::array<float,2>{0.0203724299f, 0.413107544f},
-std::array<float,2>{0.931896091f, 0.541490555f},
-std::array<float,2>{0.260457277f, 0.762741745f},
-std::array<float,2>{0.746016026f, 0.0503626056f},
-std::array<float,2>{0.369764626f, 0.325368941f},
-std::array<float,2>{0.630800426f, 0.738558412f},
-std::array<float,2>{0.0845029429f, 0.920506716f},
-std::array<float,2>{0.979492843f, 0.206373513f},
-std::array<float,2>{0.156173542f, 0.114193052f},
-std::array<float,2>{0.851721883f, 0.833760262f},
-std::array<float,2>{0.43611151f, 0.584680021f},
-std::array<float,2>{0.530918717f, 0.467367619f},
-std::array<float,2>{0.298956007f, 0.0276305676f},
-std::array<float,2>{0.710432351f, 0.804236829f},
-std::array<float,2>{0.0519749075f, 0.523422956f},
-std::array<float,2>{0.885388374f, 0.393133491f},
-std::array<float,2>{0.241772771f, 0.255937219f},
-std::array<float,2>{0.780187607f, 0.685951471f},
-std::array<float,2>{0.455212116f, 0.939006329f},
-std::array<float,2>{0.599155605f, 0.178432584f},
-std::array<float,2>{0.38912636f, 0.469819784f},
-std::array<float,2>{0.556014478f, 0.610315859f},
-std::array<float,2>{0.156941801f, 0.871405065f},
-std::array<float,2>{0.819326341f, 0.0667640194f},
-std::array<float,2>{0.0941483751f, 0.239426807f},
-std::array<float,2>{0.953878105f, 0.898514152f},
-std::array<float,2>{0.314722896f, 0.713304341f},
-std::array<float,2>{0.684871078f, 0.353102148f},
-std::array<float,2>{0.256555706f, 0.184956521f},
-std::array<float,2>{0.739707112f, 0.946768582f},
-std::array<float,2>{0.0254630465f, 0.674568057f},
-std::array<float,2>{0.922609746f, 0.258630902f},
-std::array<float,2>{0.197228253f, 0.404727399f},
-std::array<float,2>{0.803476334f, 0.525159359f},
-std::array<float,2>{0.47440058f, 0.804802656f},
-std::array<float,2>{0.57510221f, 0.019731408f},
-std::array<float,2>{0.427855015f, 0.348868757f},
-std::array<float,2>{0.522464991f, 0.704266667f},
-std::array<float,2>{0.143688709f, 0.89225477f},
-std::array<float,2>{0.849892795f, 0.242871359f},
-std::array<float,2>{0.092143774f, 0.0720409676f},
-std::array<float,2>{0.973142087f, 0.864424646f},
-std::array<float,2>{0.362897635f, 0.618318617f},
-std::array<float,2>{0.637300849f, 0.48219502f},
-std::array<float,2>{0.461885422f, 0.0600658022f},
-std::array<float,2>{0.608229756f, 0.75531286f},
-std::array<float,2>{0.24417235f, 0.531907618f},
-std::array<float,2>{0.768185794f, 0.420708776f},
-std::array<float,2>{0.062324997f, 0.29179284f},
-std::array<float,2>{0.878118992f, 0.63921982f},
-std::array<float,2>{0.311819643f, 0.999258578f},
-std::array<float,2>{0.713535607f, 0.136667281f},
-std::array<float,2>{0.324764788f, 0.456496358f},
-std::array<float,2>{0.675584435f, 0.587507904f},
-std::array<float,2>{0.102751568f, 0.836698413f},
-std::array<float,2>{0.964027345f, 0.119480066f},
-std::array<float,2>{0.166847661f, 0.218460679f},
-std::array<float,2>{0.822217226f, 0.909364045f},
-std::array<float,2>{0.379277289f, 0.749305904f},
-std::array<float,2>{0.550873876f, 0.316219062f},
-std::array<float,2>{0.39882198f, 0.234090209f},
-std::array<float,2>{0.541472316f, 0.881011844f},
-std::array<float,2>{0.186846972f, 0.692822218f},
-std::array<float,2>{0.836779118f, 0.374653071f},
-std::array<float,2>{0.112269685f, 0.485904753f},
-std::array<float,2>{0.946177244f, 0.608494401f},
-std::array<float,2>{0.332063645f, 0.85751617f},
-std::array<float,2>{0.660014093f, 0.0801557228f},
-std::array<float,2>{0.295520127f, 0.274881005f},
-std::array<float,2>{0.696736634f, 0.664257288f},
-std::array<float,2>{0.0371169932f, 0.966324389f},
-std::array<float,2>{0.890736461f, 0.170407042f},
-std::array<float,2>{0.233013183f, 0.00937425625f},
-std::array<float,2>{0.763175666f, 0.789581716f},
-std::array<float,2>{0.443562984f, 0.510049999f},
-std::array<float,2>{0.62166059f, 0.379666954f},
-std::array<float,2>{0.350707352f, 0.102845073f},
-std::array<float,2>{0.655515313f, 0.824242234f},
-std::array<float,2>{0.0764405206f, 0.571914732f},
-std::array<float,2>{0.989010811f, 0.448188752f},
-std::array<float,2>{0.133137926f, 0.331457824f},
-std::array<float,2>{0.872240484f, 0.72286737f},
-std::array<float,2>{0.408830374f, 0.922532141f},
-std::array<float,2>{0.506854475f, 0.194766775f},
-std::array<float,2>{0.48978743f, 0.430093765f},
-std::array<float,2>{0.585378766f, 0.553164721f},
-std::array<float,2>{0.212923095f, 0.768135309f},
-std::array<float,2>{0.78696394f, 0.0374939665f},
-std::array<float,2>{0.000209090329f, 0.144355863f},
-std::array<float,2>{0.908448875f, 0.976791859f},
-std::array<float,2>{0.275228888f, 0.648266077f},
-std::array<float,2>{0.719804466f, 0.302060336f},
-std::array<float,2>{0.363269418f, 0.186674699f},
-std::array<float,2>{0.637524188f, 0.948354959f},
-std::array<float,2>{0.0919675082f, 0.673431396f},
-std::array<float,2>{0.972741663f, 0.261358649f},
-std::array<float,2>{0.143985495f, 0.403229445f},
-std::array<float,2>{0.849754333f, 0.526014686f},
-std::array<float,2>{0.428012013f, 0.808358252f},
-std::array<float,2>{0.522878647f, 0.023048833f},
-std::array<float,2>{0.474339753f, 0.350255221f},
-std::array<float,2>{0.574931622f, 0.706084669f},
-std::array<float,2>{0.196959943f, 0.893647015f},
-std::array<float,2>{0.803313553f, 0.244195789f},
-std::array<float,2>{0.0257675499f, 0.0740581304f},
-std::array<float,2>{0.922435105f, 0.866694152f},
-std::array<float,2>{0.256648034f, 0.620874584f},
-std::array<float,2>{0.739340603f, 0.482971549f},
-std::array<float,2>{0.378926277f, 0.0607747994f},
-std::array<float,2>{0.551225007f, 0.756009042f},
-std::array<float,2>{0.166663215f, 0.535146236f},
-std::array<float,2>{0.82180804f, 0.41930306f},
-std::array<float,2>{0.10288009f, 0.290330172f},
-std::array<float,2>{0.964211583f, 0.636721253f},
-std::array<float,2>{0.325193942f, 0.997394681f},
-std::array<float,2>{0.675474942f, 0.133255154f},
-std::array<float,2>{0.311616838f, 0.454573929f},
-std::array<float,2>{0.713787615f, 0.587983668f},
-std::array<float,2>{0.062153507f, 0.839815795f},
-std::array<float,2>{0.878396988f, 0.117254063f},
-std::array<float,2>{0.244449601f, 0.216618791f},
-std::array<float,2>{0.768515825f, 0.906410575f},
-std::array<float,2>{0.46151939f, 0.746296823f},
-std::array<float,2>{0.607946157f, 0.312904567f},
-std::array<float,2>{0.443815887f, 0.231944889f},
-std::array<float,2>{0.622001469f, 0.880674779f},
-std::array<float,2>{0.233288869f, 0.694684803f},
-std::array<float,2>{0.762936294f, 0.372151285f},
-std::array<float,2>{0.0373575576f, 0.487724036f},
-std::array<float,2>{0.891058862f, 0.606530428f},
-std::array<float,2>{0.295713961f, 0.855561554f},
-std::array<float,2>{0.696323931f, 0.078198269f},
-std::array<float,2>{0.332513213f, 0.276206255f},
-std::array<float,2>{0.659715474f, 0.667820215f},
-std::array<float,2>{0.111913547f, 0.966857433f},
-std::array<float,2>{0.945930898f, 0.169522434f},
-std::array<float,2>{0.186685264f, 0.0106680281f},
-std::array<float,2>{0.836444914f, 0.791762412f},
-std::array<float,2>{0.398642153f, 0.50950563f},
-std::array<float,2>{0.54123342f, 0.381541729f},
-std::array<float,2>{0.275033027f, 0.104978584f},
-std::array<float,2>{0.720169008f, 0.827129602f},
-std::array<float,2>{0.000342393498f, 0.57250905f},
-std::array<float,2>{0.908233285f, 0.445462257f},
-std::array<float,2>{0.213239387f, 0.329410285f},
-std::array<float,2>{0.786761284f, 0.725158811f},
-std::array<float,2>{0.490167856f, 0.92471981f},
-std::array<float,2>{0.585060656f, 0.193141654f},
-std::array<float,2>{0.408988923f, 0.433119744f},
-std::array<float,2>{0.507180512f, 0.550900757f},
-std::array<float,2>{0.132858858f, 0.766382039f},
-std::array<float,2>{0.872355044f, 0.0365830176f},
-std::array<float,2>{0.07619185f, 0.14135772f},
-std::array<float,2>{0.989211142f, 0.979097903f},
-std::array<float,2>{0.35086748f, 0.645685673f},
-std::array<float,2>{0.655748129f, 0.303297341f},
-std::array<float,2>{0.281938672f, 0.198810726f},
-std::array<float,2>{0.691504061f, 0.929961085f},
-std::array<float,2>{0.0402771756f, 0.727447927f},
-std::array<float,2>{0.900113106f, 0.337975264f},
-std::array<float,2>{0.223669395f, 0.438374817f},
-std::array<float,2>{0.751517117f, 0.563476861f},
-std::array<float,2>{0.446610093f, 0.819559038f},
-std::array<float,2>{0.612634599f, 0.0970225334f},
-std::array<float,2>{0.39580515f, 0.304871142f},
-std::array<float,2>{0.531930208f, 0.655241013f},
-std::array<float,2>{0.178196773f, 0.973346531f},
-std::array<float,2>{0.831910789f, 0.149729803f},
-std::array<float,2>{0.117735364f, 0.0417444594f},
-std::array<float,2>{0.943357348f, 0.774299085f},
-std::array<float,2>{0.338514149f, 0.56235534f},
-std::array<float,2>{0.666717947f, 0.424728394f},
-std::array<float,2>{0.492420375f, 0.0859490857f},
-std::array<float,2>{0.587296724f, 0.845788777f},
-std::array<float,2>{0.204071373f, 0.597679973f},
-std::array<float,2>{0.795436919f, 0.497093439f},
-std::array<float,2>{0.0111241462f, 0.36153084f},
-std::array<float,2>{0.91912657f, 0.699619889f},
-std::array<float,2>{0.271353394f, 0.887053013f},
-std::array<float,2>{0.731838465f, 0.226433173f},
-std::array<float,2>{0.357446671f, 0.384099603f},
-std::array<float,2>{0.648178279f, 0.502619147f},
-std::array<float,2>{0.0630921721f, 0.785527408f},
-std::array<float,2>{0.998015583f, 0.00474133343f},
-std::array<float,2>{0.12721321f, 0.159237534f},
-std::array<float,2>{0.864703655f, 0.955774486f},
-std::array<float,2>{0.420464218f, 0.656900465f},
-std::array<float,2>{0.509140551f, 0.272516429f},
-std::array<float,2>{0.436481833f, 0.127798662f},
-std::array<float,2>{0.531184316f, 0.986054122f},
-std::array<float,2>{0.15596579f, 0.629477262f},
-std::array<float,2>{0.851886034f, 0.285435498f},
-std::array<float,2>{0.0847386196f, 0.411038667f},
-std::array<float,2>{0.979854524f, 0.540887594f},
-std::array<float,2>{0.369994998f, 0.7640782f},
-std::array<float,2>{0.630431175f, 0.0472045839f},
-std::array<float,2>{0.260612488f, 0.326197445f},
-std::array<float,2>{0.745717108f, 0.741322517f},
-std::array<float,2>{0.0201332327f, 0.919693112f},
-std::array<float,2>{0.93166995f, 0.20344691f},
-std::array<float,2>{0.190248787f, 0.116242521f},
-std::array<float,2>{0.806903064f, 0.834156394f},
-std::array<float,2>{0.483325213f, 0.582088649f},
-std::array<float,2>{0.569737017f, 0.465079993f},
-std::array<float,2>{0.314464658f, 0.0293171145f},
-std::array<float,2>{0.684764266f, 0.801580131f},
-std::array<float,2>{0.0938202366f, 0.520356059f},
-std::array<float,2>{0.953788221f, 0.391111225f},
-std::array<float,2>{0.157178938f, 0.255509138f},
-std::array<float,2>{0.818879247f, 0.685535789f},
-std::array<float,2>{0.388807207f, 0.939986885f},
-std::array<float,2>{0.555809021f, 0.177671969f},
-std::array<float,2>{0.455547214f, 0.471813768f},
-std::array<float,2>{0.599441588f, 0.612392426f},
-std::array<float,2>{0.242173567f, 0.87427038f},
-std::array<float,2>{0.779916286f, 0.0690248087f},
-std::array<float,2>{0.0521701425f, 0.240859255f},
-std::array<float,2>{0.885697424f, 0.901053846f},
-std::array<float,2>{0.299288154f, 0.710945845f},
-std::array<float,2>{0.710009098f, 0.355024636f},
-std::array<float,2>{0.340633124f, 0.249230087f},
-std::array<float,2>{0.669043601f, 0.896034896f},
-std::array<float,2>{0.124066211f, 0.709596336f},
-std::array<float,2>{0.939043045f, 0.345286995f},
-std::array<float,2>{0.174447343f, 0.477878839f},
-std::array<float,2>{0.832960308f, 0.622897804f},
-std::array<float,2>{0.393256396f, 0.861145198f},
-std::array<float,2>{0.538513839f, 0.0748100653f},
-std::array<float,2>{0.451528311f, 0.262387514f},
-std::array<float,2>{0.61631602f, 0.678148031f},
-std::array<float,2>{0.222537205f, 0.950006485f},
-std::array<float,2>{0.755415857f, 0.181685165f},
-std::array<float,2>{0.0438513942f, 0.01926402f},
-std::array<float,2>{0.90599674f, 0.812493801f},
-std::array<float,2>{0.286786169f, 0.529501677f},
-std::array<float,2>{0.690057039f, 0.39854601f},
-std::array<float,2>{0.415121436f, 0.12319275f},
-std::array<float,2>{0.515033245f, 0.840697169f},
-std::array<float,2>{0.131713971f, 0.593245566f},
-std::array<float,2>{0.862013042f, 0.459128946f},
-std::array<float,2>{0.0687702969f, 0.31861943f},
-std::array<float,2>{0.995627761f, 0.744883597f},
-std::array<float,2>{0.351663262f, 0.912721336f},
-std::array<float,2>{0.644092083f, 0.213917717f},
-std::array<float,2>{0.266693473f, 0.414459169f},
-std::array<float,2>{0.729122758f, 0.536323786f},
-std::array<float,2>{0.0137357255f, 0.751716256f},
-std::array<float,2>{0.915165901f, 0.0568367578f},
-std::array<float,2>{0.20766969f, 0.137918025f},
-std::array<float,2>{0.789381385f, 0.995572329f},
-std::array<float,2>{0.499232948f, 0.634205163f},
-std::array<float,2>{0.589938581f, 0.295161247f},
-std::array<float,2>{0.476720273f, 0.164208546f},
-std::array<float,2>{0.564683974f, 0.962680995f},
-std::array<float,2>{0.194830373f, 0.668792725f},
-std::array<float,2>{0.81144768f, 0.27834487f},
-std::array<float,2>{0.0174620934f, 0.375059158f},
-std::array<float,2>{0.934808969f, 0.512666047f},
-std::array<float,2>{0.264606535f, 0.793300092f},
-std::array<float,2>{0.746818364f, 0.0130692786f},
-std::array<float,2>{0.372790188f, 0.367533267f},
-std::array<float,2>{0.626917422f, 0.690416694f},
-std::array<float,2>{0.0816803947f, 0.876065433f},
-std::array<float,2>{0.983363748f, 0.227597862f},
-std::array<float,2>{0.150070727f, 0.0837133005f},
-std::array<float,2>{0.857230723f, 0.852035999f},
-std::array<float,2>{0.432361126f, 0.604817867f},
-std::array<float,2>{0.524853528f, 0.49048546f},
-std::array<float,2>{0.302885026f, 0.0327188261f},
-std::array<float,2>{0.704731584f, 0.771715701f},
-std::array<float,2>{0.0495116711f, 0.550601363f},
-std::array<float,2>{0.889712691f, 0.433666408f},
-std::array<float,2>{0.234416932f, 0.297961533f},
-std::array<float,2>{0.773444593f, 0.640668452f},
-std::array<float,2>{0.460549325f, 0.984208941f},
-std::array<float,2>{0.597636342f, 0.145483896f},
-std::array<float,2>{0.386056751f, 0.450644761f},
-std::array<float,2>{0.56118077f, 0.574963212f},
-std::array<float,2>{0.160482198f, 0.823506415f},
-std::array<float,2>{0.815047383f, 0.108921111f},
-std::array<float,2>{0.101518311f, 0.188155562f},
-std::array<float,2>{0.959543407f, 0.928780258f},
-std::array<float,2>{0.316928089f, 0.721421838f},
-std::array<float,2>{0.681211889f, 0.334510982f},
-std::array<float,2>{0.252109468f, 0.153434321f},
-std::array<float,2>{0.735853553f, 0.971098959f},
-std::array<float,2>{0.0277987365f, 0.651098609f},
-std::array<float,2>{0.926861525f, 0.310356289f},
-std::array<float,2>{0.201036245f, 0.425791442f},
-std::array<float,2>{0.799525321f, 0.558103859f},
-std::array<float,2>{0.471536189f, 0.778860807f},
-std::array<float,2>{0.571713984f, 0.0440590605f},
-std::array<float,2>{0.421883583f, 0.342862219f},
-std::array<float,2>{0.519026935f, 0.730539382f},
-std::array<float,2>{0.147258773f, 0.935275793f},
-std::array<float,2>{0.844968736f, 0.199582726f},
-std::array<float,2>{0.0879815891f, 0.100579493f},
-std::array<float,2>{0.97112143f, 0.814391017f},
-std::array<float,2>{0.365235925f, 0.569386542f},
-std::array<float,2>{0.635704219f, 0.443812847f},
-std::array<float,2>{0.466835558f, 0.00306973211f},
-std::array<float,2>{0.603028059f, 0.784708142f},
-std::array<float,2>{0.249403939f, 0.505577207f},
-std::array<float,2>{0.770732164f, 0.389680028f},
-std::array<float,2>{0.0548437312f, 0.268840641f},
-std::array<float,2>{0.880931139f, 0.661275983f},
-std::array<float,2>{0.306800216f, 0.957281768f},
-std::array<float,2>{0.716799378f, 0.163476378f},
-std::array<float,2>{0.320549518f, 0.492656529f},
-std::array<float,2>{0.677123666f, 0.597505987f},
-std::array<float,2>{0.106469139f, 0.849276423f},
-std::array<float,2>{0.96651721f, 0.0904750302f},
-std::array<float,2>{0.170899153f, 0.221299276f},
-std::array<float,2>{0.827808261f, 0.88624084f},
-std::array<float,2>{0.375502825f, 0.697215557f},
-std::array<float,2>{0.547808051f, 0.365510702f},
-std::array<float,2>{0.404101074f, 0.208042786f},
-std::array<float,2>{0.546263158f, 0.915379107f},
-std::array<float,2>{0.181278259f, 0.737754881f},
-std::array<float,2>{0.841741264f, 0.323556095f},
-std::array<float,2>{0.113401122f, 0.464091718f},
-std::array<float,2>{0.951466918f, 0.580303133f},
-std::array<float,2>{0.331907898f, 0.82971698f},
-std::array<float,2>{0.662658513f, 0.111911394f},
-std::array<float,2>{0.290928006f, 0.282364339f},
-std::array<float,2>{0.702219725f, 0.625528932f},
-std::array<float,2>{0.033747334f, 0.992181897f},
-std::array<float,2>{0.897016287f, 0.13054584f},
-std::array<float,2>{0.227237046f, 0.0525557511f},
-std::array<float,2>{0.759205878f, 0.759872258f},
-std::array<float,2>{0.439340353f, 0.546541572f},
-std::array<float,2>{0.618674755f, 0.406667233f},
-std::array<float,2>{0.34722048f, 0.0651604384f},
-std::array<float,2>{0.650643229f, 0.870350718f},
-std::array<float,2>{0.0710240677f, 0.615660071f},
-std::array<float,2>{0.984820604f, 0.475070894f},
-std::array<float,2>{0.138381451f, 0.356117517f},
-std::array<float,2>{0.869236887f, 0.716902256f},
-std::array<float,2>{0.410805106f, 0.902436376f},
-std::array<float,2>{0.500561178f, 0.238257423f},
-std::array<float,2>{0.487041146f, 0.397771657f},
-std::array<float,2>{0.578130186f, 0.516755402f},
-std::array<float,2>{0.217156678f, 0.797479212f},
-std::array<float,2>{0.784243822f, 0.0266434848f},
-std::array<float,2>{0.00677820807f, 0.175382257f},
-std::array<float,2>{0.911316693f, 0.942099929f},
-std::array<float,2>{0.278182387f, 0.6828596f},
-std::array<float,2>{0.724117935f, 0.252831817f},
-std::array<float,2>{0.327228874f, 0.135604337f},
-std::array<float,2>{0.672157586f, 0.998192906f},
-std::array<float,2>{0.103823394f, 0.639665246f},
-std::array<float,2>{0.962169945f, 0.292588085f},
-std::array<float,2>{0.165359348f, 0.421585083f},
-std::array<float,2>{0.822620988f, 0.532611012f},
-std::array<float,2>{0.380911231f, 0.754438639f},
-std::array<float,2>{0.554625273f, 0.0595023595f},
-std::array<float,2>{0.464504629f, 0.314956456f},
-std::array<float,2>{0.605850518f, 0.74819684f},
-std::array<float,2>{0.243788332f, 0.908888757f},
-std::array<float,2>{0.766773462f, 0.216961712f},
-std::array<float,2>{0.0594377182f, 0.120784461f},
-std::array<float,2>{0.875029087f, 0.837255538f},
-std::array<float,2>{0.309965611f, 0.586770535f},
-std::array<float,2>{0.712241232f, 0.455630541f},
-std::array<float,2>{0.42751497f, 0.0207721964f},
-std::array<float,2>{0.520466626f, 0.806477189f},
-std::array<float,2>{0.141132548f, 0.524345577f},
-std::array<float,2>{0.848286033f, 0.40593189f},
-std::array<float,2>{0.0910975263f, 0.2590096f},
-std::array<float,2>{0.974708974f, 0.675689936f},
-std::array<float,2>{0.360028714f, 0.945970953f},
-std::array<float,2>{0.639511764f, 0.183918655f},
-std::array<float,2>{0.255211502f, 0.480545253f},
-std::array<float,2>{0.741026759f, 0.617814124f},
-std::array<float,2>{0.0235384665f, 0.863602817f},
-std::array<float,2>{0.924728215f, 0.070868887f},
-std::array<float,2>{0.198901415f, 0.243417636f},
-std::array<float,2>{0.801034629f, 0.89127481f},
-std::array<float,2>{0.475430697f, 0.70369941f},
-std::array<float,2>{0.57774961f, 0.348089069f},
-std::array<float,2>{0.491475046f, 0.193386868f},
-std::array<float,2>{0.58382839f, 0.923221707f},
-std::array<float,2>{0.212516591f, 0.723999143f},
-std::array<float,2>{0.788414717f, 0.330863118f},
-std::array<float,2>{0.00370387384f, 0.448792785f},
-std::array<float,2>{0.907481432f, 0.570903242f},
-std::array<float,2>{0.275527388f, 0.825259328f},
-std::array<float,2>{0.721114457f, 0.10241212f},
-std::array<float,2>{0.349048018f, 0.30155617f},
-std::array<float,2>{0.652833343f, 0.64721024f},
-std::array<float,2>{0.0742429271f, 0.977828145f},
-std::array<float,2>{0.991376698f, 0.143187225f},
-std::array<float,2>{0.134871408f, 0.0383809246f},
-std::array<float,2>{0.874436021f, 0.768733203f},
-std::array<float,2>{0.406894624f, 0.554580808f},
-std::array<float,2>{0.505758941f, 0.431459635f},
-std::array<float,2>{0.293120652f, 0.0813087374f},
-std::array<float,2>{0.6983428f, 0.859260142f},
-std::array<float,2>{0.0367084406f, 0.607579648f},
-std::array<float,2>{0.893590093f, 0.484854579f},
-std::array<float,2>{0.231141835f, 0.373799652f},
-std::array<float,2>{0.763991058f, 0.692356944f},
-std::array<float,2>{0.442974865f, 0.881958961f},
-std::array<float,2>{0.623722255f, 0.232800588f},
-std::array<float,2>{0.401681244f, 0.380039692f},
-std::array<float,2>{0.539611578f, 0.510937274f},
-std::array<float,2>{0.185403943f, 0.79007417f},
-std::array<float,2>{0.838543296f, 0.00796370581f},
-std::array<float,2>{0.111010641f, 0.171693087f},
-std::array<float,2>{0.948380828f, 0.96518892f},
-std::array<float,2>{0.334462613f, 0.665796161f},
-std::array<float,2>{0.65697211f, 0.27421245f},
-std::array<float,2>{0.272677928f, 0.222668231f},
-std::array<float,2>{0.73412621f, 0.890225828f},
-std::array<float,2>{0.00826308597f, 0.701218605f},
-std::array<float,2>{0.920961618f, 0.360722333f},
-std::array<float,2>{0.205434233f, 0.498739928f},
-std::array<float,2>{0.793479025f, 0.601186633f},
-std::array<float,2>{0.495571941f, 0.843901157f},
-std::array<float,2>{0.58823216f, 0.089010939f},
-std::array<float,2>{0.418674052f, 0.270872533f},
-std::array<float,2>{0.511140347f, 0.659977853f},
-std::array<float,2>{0.125543103f, 0.954509318f},
-std::array<float,2>{0.866715908f, 0.157029003f},
-std::array<float,2>{0.0654700994f, 0.00732032023f},
-std::array<float,2>{0.999872267f, 0.78864193f},
-std::array<float,2>{0.356107295f, 0.501283705f},
-std::array<float,2>{0.644671917f, 0.385039121f},
-std::array<float,2>{0.44886452f, 0.0950987935f},
-std::array<float,2>{0.610066235f, 0.816436112f},
-std::array<float,2>{0.226368427f, 0.565854192f},
-std::array<float,2>{0.753719389f, 0.439629406f},
-std::array<float,2>{0.042791836f, 0.336551577f},
-std::array<float,2>{0.901548445f, 0.729444981f},
-std::array<float,2>{0.284420878f, 0.933239698f},
-std::array<float,2>{0.69342196f, 0.195436373f},
-std::array<float,2>{0.337020397f, 0.422050208f},
-std::array<float,2>{0.665243328f, 0.560100436f},
-std::array<float,2>{0.120864235f, 0.775886655f},
-std::array<float,2>{0.944560468f, 0.0405751839f},
-std::array<float,2>{0.177258685f, 0.151329771f},
-std::array<float,2>{0.829561591f, 0.974955559f},
-std::array<float,2>{0.397506267f, 0.653902829f},
-std::array<float,2>{0.533769369f, 0.308392644f},
-std::array<float,2>{0.387704432f, 0.179523349f},
-std::array<float,2>{0.558170378f, 0.937704206f},
-std::array<float,2>{0.159539342f, 0.687357485f},
-std::array<float,2>{0.816618741f, 0.257747471f},
-std::array<float,2>{0.0960254744f, 0.394478142f},
-std::array<float,2>{0.95583427f, 0.521523118f},
-std::array<float,2>{0.31349048f, 0.803302646f},
-std::array<float,2>{0.686998844f, 0.0284745991f},
-std::array<float,2>{0.298603982f, 0.35236606f},
-std::array<float,2>{0.708115995f, 0.714743972f},
-std::array<float,2>{0.0528796799f, 0.899853587f},
-std::array<float,2>{0.883692503f, 0.238304272f},
-std::array<float,2>{0.239037126f, 0.067887567f},
-std::array<float,2>{0.777796865f, 0.872678518f},
-std::array<float,2>{0.454757452f, 0.610566199f},
-std::array<float,2>{0.601448357f, 0.468950182f},
-std::array<float,2>{0.368994743f, 0.0492348f},
-std::array<float,2>{0.631329775f, 0.762550056f},
-std::array<float,2>{0.0822088346f, 0.54294008f},
-std::array<float,2>{0.977917194f, 0.41273576f},
-std::array<float,2>{0.154248834f, 0.287408769f},
-std::array<float,2>{0.854743302f, 0.632706463f},
-std::array<float,2>{0.434701353f, 0.987862349f},
-std::array<float,2>{0.528537929f, 0.126742855f},
-std::array<float,2>{0.481627017f, 0.468566716f},
-std::array<float,2>{0.566648543f, 0.585410953f},
-std::array<float,2>{0.188253924f, 0.832899213f},
-std::array<float,2>{0.8062464f, 0.115035012f},
-std::array<float,2>{0.0217096135f, 0.205310255f},
-std::array<float,2>{0.930393934f, 0.921008825f},
-std::array<float,2>{0.259201884f, 0.740167856f},
-std::array<float,2>{0.743012607f, 0.325140923f},
-std::array<float,2>{0.354386181f, 0.212484121f},
-std::array<float,2>{0.641118109f, 0.910856307f},
-std::array<float,2>{0.0679408535f, 0.743399501f},
-std::array<float,2>{0.993121326f, 0.316957474f},
-std::array<float,2>{0.130410299f, 0.458030552f},
-std::array<float,2>{0.861234069f, 0.59045577f},
-std::array<float,2>{0.416374296f, 0.841943502f},
-std::array<float,2>{0.513484538f, 0.123040028f},
-std::array<float,2>{0.497788489f, 0.293712914f},
-std::array<float,2>{0.591821849f, 0.636038363f},
-std::array<float,2>{0.210935056f, 0.993135154f},
-std::array<float,2>{0.791380227f, 0.138743937f},
-std::array<float,2>{0.0123389792f, 0.0560609624f},
-std::array<float,2>{0.917133868f, 0.753486872f},
-std::array<float,2>{0.26797241f, 0.538673103f},
-std::array<float,2>{0.728470206f, 0.416387051f},
-std::array<float,2>{0.392392099f, 0.0761874095f},
-std::array<float,2>{0.535333455f, 0.862669289f},
-std::array<float,2>{0.172854319f, 0.624971986f},
-std::array<float,2>{0.835433245f, 0.479585528f},
-std::array<float,2>{0.122832432f, 0.346784621f},
-std::array<float,2>{0.939618707f, 0.707426071f},
-std::array<float,2>{0.342561722f, 0.898354411f},
-std::array<float,2>{0.67014122f, 0.24695906f},
-std::array<float,2>{0.287142307f, 0.401506782f},
-std::array<float,2>{0.688205063f, 0.527983367f},
-std::array<float,2>{0.0459171981f, 0.809796035f},
-std::array<float,2>{0.903852999f, 0.0168365296f},
-std::array<float,2>{0.21959269f, 0.17983827f},
-std::array<float,2>{0.756099343f, 0.95121038f},
-std::array<float,2>{0.450237066f, 0.676156878f},
-std::array<float,2>{0.613995135f, 0.264398724f},
-std::array<float,2>{0.458294898f, 0.146914423f},
-std::array<float,2>{0.594653606f, 0.981475711f},
-std::array<float,2>{0.23665975f, 0.644268095f},
-std::array<float,2>{0.77709502f, 0.300239682f},
-std::array<float,2>{0.0470382422f, 0.437454045f},
-std::array<float,2>{0.88697046f, 0.547440767f},
-std::array<float,2>{0.302670002f, 0.769592643f},
-std::array<float,2>{0.706421793f, 0.0332901403f},
-std::array<float,2>{0.318808168f, 0.332516164f},
-std::array<float,2>{0.683033347f, 0.720573008f},
-std::array<float,2>{0.0978128761f, 0.926913142f},
-std::array<float,2>{0.957474768f, 0.191237941f},
-std::array<float,2>{0.162802681f, 0.105984345f},
-std::array<float,2>{0.813266277f, 0.820585608f},
-std::array<float,2>{0.384679407f, 0.576206684f},
-std::array<float,2>{0.559900224f, 0.451901615f},
-std::array<float,2>{0.262085497f, 0.0148327909f},
-std::array<float,2>{0.74918294f, 0.795773149f},
-std::array<float,2>{0.018260112f, 0.514081836f},
-std::array<float,2>{0.936143637f, 0.377025634f},
-std::array<float,2>{0.192327201f, 0.280920863f},
-std::array<float,2>{0.810040176f, 0.671299875f},
-std::array<float,2>{0.479893774f, 0.964214802f},
-std::array<float,2>{0.563602507f, 0.167328849f},
-std::array<float,2>{0.430077463f, 0.489245534f},
-std::array<float,2>{0.526914656f, 0.602670372f},
-std::array<float,2>{0.151034236f, 0.854604304f},
-std::array<float,2>{0.858479381f, 0.0850990489f},
-std::array<float,2>{0.0784092695f, 0.229810029f},
-std::array<float,2>{0.981179714f, 0.877331138f},
-std::array<float,2>{0.374269515f, 0.688960671f},
-std::array<float,2>{0.627289236f, 0.370002598f},
-std::array<float,2>{0.306179285f, 0.160314977f},
-std::array<float,2>{0.715211809f, 0.959046066f},
-std::array<float,2>{0.0581702963f, 0.662345052f},
-std::array<float,2>{0.879891932f, 0.266178846f},
-std::array<float,2>{0.247031137f, 0.387486577f},
-std::array<float,2>{0.773199618f, 0.506655216f},
-std::array<float,2>{0.465687722f, 0.782552958f},
-std::array<float,2>{0.604985535f, 0.000839493237f},
-std::array<float,2>{0.377125829f, 0.364657193f},
-std::array<float,2>{0.549370229f, 0.698925853f},
-std::array<float,2>{0.168986961f, 0.883242249f},
-std::array<float,2>{0.825877249f, 0.219287857f},
-std::array<float,2>{0.108520202f, 0.0937099531f},
-std::array<float,2>{0.967534423f, 0.851356924f},
-std::array<float,2>{0.323941737f, 0.594754815f},
-std::array<float,2>{0.679124951f, 0.494287252f},
-std::array<float,2>{0.470375061f, 0.0467747785f},
-std::array<float,2>{0.574061334f, 0.779759467f},
-std::array<float,2>{0.201352f, 0.556227982f},
-std::array<float,2>{0.796936035f, 0.428481072f},
-std::array<float,2>{0.0308471322f, 0.311696053f},
-std::array<float,2>{0.928058803f, 0.649635553f},
-std::array<float,2>{0.250675648f, 0.969085038f},
-std::array<float,2>{0.736357331f, 0.154556364f},
-std::array<float,2>{0.36506477f, 0.442133158f},
-std::array<float,2>{0.632984638f, 0.567689538f},
-std::array<float,2>{0.0864721388f, 0.815681398f},
-std::array<float,2>{0.969427824f, 0.0980993509f},
-std::array<float,2>{0.144602239f, 0.201992378f},
-std::array<float,2>{0.845973551f, 0.935940623f},
-std::array<float,2>{0.424445003f, 0.733466148f},
-std::array<float,2>{0.516841173f, 0.34127447f},
-std::array<float,2>{0.413886964f, 0.235635266f},
-std::array<float,2>{0.502015829f, 0.90591526f},
-std::array<float,2>{0.140247807f, 0.715864182f},
-std::array<float,2>{0.867214084f, 0.358288229f},
-std::array<float,2>{0.0741614103f, 0.472920835f},
-std::array<float,2>{0.988048196f, 0.614733696f},
-std::array<float,2>{0.344096541f, 0.86913085f},
-std::array<float,2>{0.649483085f, 0.0640110075f},
-std::array<float,2>{0.280046225f, 0.250884563f},
-std::array<float,2>{0.726418853f, 0.680949688f},
-std::array<float,2>{0.00486622471f, 0.945032656f},
-std::array<float,2>{0.912377119f, 0.172334671f},
-std::array<float,2>{0.215805456f, 0.0248586908f},
-std::array<float,2>{0.782504559f, 0.799911678f},
-std::array<float,2>{0.485773802f, 0.518243074f},
-std::array<float,2>{0.580812156f, 0.394694149f},
-std::array<float,2>{0.329064667f, 0.111198716f},
-std::array<float,2>{0.661367774f, 0.831659853f},
-std::array<float,2>{0.115999721f, 0.578798711f},
-std::array<float,2>{0.949499011f, 0.462571472f},
-std::array<float,2>{0.182738289f, 0.321753711f},
-std::array<float,2>{0.843615949f, 0.73577261f},
-std::array<float,2>{0.405780464f, 0.916428208f},
-std::array<float,2>{0.544376075f, 0.210871667f},
-std::array<float,2>{0.441278964f, 0.40950039f},
-std::array<float,2>{0.619230568f, 0.543421924f},
-std::array<float,2>{0.228664368f, 0.759482265f},
-std::array<float,2>{0.760751128f, 0.0544830039f},
-std::array<float,2>{0.0327489264f, 0.131176293f},
-std::array<float,2>{0.895831525f, 0.989778161f},
-std::array<float,2>{0.292740345f, 0.627568364f},
-std::array<float,2>{0.700297236f, 0.28413561f},
-std::array<float,2>{0.335228711f, 0.168429509f},
-std::array<float,2>{0.658195555f, 0.968561649f},
-std::array<float,2>{0.109886758f, 0.666054606f},
-std::array<float,2>{0.947651207f, 0.276903629f},
-std::array<float,2>{0.184544712f, 0.382293314f},
-std::array<float,2>{0.839130878f, 0.508453846f},
-std::array<float,2>{0.401229382f, 0.792365491f},
-std::array<float,2>{0.540604532f, 0.0112164356f},
-std::array<float,2>{0.441820562f, 0.372038722f},
-std::array<float,2>{0.624256968f, 0.693398893f},
-std::array<float,2>{0.232049793f, 0.879876077f},
-std::array<float,2>{0.764718235f, 0.230922043f},
-std::array<float,2>{0.0360387899f, 0.0792796761f},
-std::array<float,2>{0.892790258f, 0.856995821f},
-std::array<float,2>{0.294537783f, 0.606271863f},
-std::array<float,2>{0.697976053f, 0.487025827f},
-std::array<float,2>{0.408010155f, 0.0354672223f},
-std::array<float,2>{0.504047155f, 0.766956091f},
-std::array<float,2>{0.136615485f, 0.552266181f},
-std::array<float,2>{0.873844802f, 0.431877255f},
-std::array<float,2>{0.0759347901f, 0.304641008f},
-std::array<float,2>{0.990791798f, 0.645194709f},
-std::array<float,2>{0.347903758f, 0.98019588f},
-std::array<float,2>{0.653503239f, 0.142420709f},
-std::array<float,2>{0.277148515f, 0.44645232f},
-std::array<float,2>{0.721878827f, 0.573298693f},
-std::array<float,2>{0.00252423598f, 0.827410042f},
-std::array<float,2>{0.906959832f, 0.104177132f},
-std::array<float,2>{0.211695597f, 0.19148694f},
-std::array<float,2>{0.787910223f, 0.92577076f},
-std::array<float,2>{0.490647495f, 0.72594893f},
-std::array<float,2>{0.582941353f, 0.32884872f},
-std::array<float,2>{0.47597447f, 0.245666906f},
-std::array<float,2>{0.57694912f, 0.893045723f},
-std::array<float,2>{0.198238656f, 0.70566541f},
-std::array<float,2>{0.802449405f, 0.351338506f},
-std::array<float,2>{0.0246634167f, 0.483964264f},
-std::array<float,2>{0.925069273f, 0.619765222f},
-std::array<float,2>{0.254286528f, 0.865480602f},
-std::array<float,2>{0.742019951f, 0.0723451227f},
-std::array<float,2>{0.360933512f, 0.260113776f},
-std::array<float,2>{0.640268564f, 0.671934247f},
-std::array<float,2>{0.0900172666f, 0.947538376f},
-std::array<float,2>{0.976351976f, 0.186010286f},
-std::array<float,2>{0.14234148f, 0.021547189f},
-std::array<float,2>{0.849114776f, 0.806822538f},
-std::array<float,2>{0.426276922f, 0.526408434f},
-std::array<float,2>{0.520550072f, 0.40348649f},
-std::array<float,2>{0.308928609f, 0.118179657f},
-std::array<float,2>{0.711142182f, 0.838391542f},
-std::array<float,2>{0.0597605109f, 0.589763284f},
-std::array<float,2>{0.876007378f, 0.453429312f},
-std::array<float,2>{0.242750183f, 0.314164877f},
-std::array<float,2>{0.765813947f, 0.74745506f},
-std::array<float,2>{0.463564187f, 0.90815872f},
-std::array<float,2>{0.607331634f, 0.214860752f},
-std::array<float,2>{0.382406741f, 0.41865316f},
-std::array<float,2>{0.55337441f, 0.533819973f},
-std::array<float,2>{0.164710432f, 0.757631063f},
-std::array<float,2>{0.823882639f, 0.0621374734f},
-std::array<float,2>{0.105112106f, 0.134762198f},
-std::array<float,2>{0.961833894f, 0.9962098f},
-std::array<float,2>{0.32647422f, 0.638073802f},
-std::array<float,2>{0.673491836f, 0.289366812f},
-std::array<float,2>{0.257939041f, 0.204527617f},
-std::array<float,2>{0.743783951f, 0.918306231f},
-std::array<float,2>{0.0228167642f, 0.740816116f},
-std::array<float,2>{0.930872262f, 0.328009725f},
-std::array<float,2>{0.189413503f, 0.46668008f},
-std::array<float,2>{0.80508858f, 0.583478272f},
-std::array<float,2>{0.481259316f, 0.83580488f},
-std::array<float,2>{0.567389965f, 0.115526564f},
-std::array<float,2>{0.433735102f, 0.286949754f},
-std::array<float,2>{0.527935863f, 0.630007088f},
-std::array<float,2>{0.153217003f, 0.985316038f},
-std::array<float,2>{0.85360837f, 0.128455117f},
-std::array<float,2>{0.0836330876f, 0.0483843014f},
-std::array<float,2>{0.977159142f, 0.765445709f},
-std::array<float,2>{0.367555112f, 0.539774418f},
-std::array<float,2>{0.631879807f, 0.411549985f},
-std::array<float,2>{0.453763276f, 0.0700732917f},
-std::array<float,2>{0.600544989f, 0.873354614f},
-std::array<float,2>{0.239683688f, 0.611729622f},
-std::array<float,2>{0.778864026f, 0.471119106f},
-std::array<float,2>{0.0542072169f, 0.353649288f},
-std::array<float,2>{0.884034395f, 0.712679625f},
-std::array<float,2>{0.297834456f, 0.901960492f},
-std::array<float,2>{0.7079916f, 0.24122563f},
-std::array<float,2>{0.312939763f, 0.391764909f},
-std::array<float,2>{0.686227143f, 0.521235108f},
-std::array<float,2>{0.0976320356f, 0.802486479f},
-std::array<float,2>{0.956466198f, 0.0309594739f},
-std::array<float,2>{0.158430994f, 0.175883308f},
-std::array<float,2>{0.818158031f, 0.941052377f},
-std::array<float,2>{0.387413561f, 0.683974981f},
-std::array<float,2>{0.55749464f, 0.25420332f},
-std::array<float,2>{0.397309452f, 0.148869753f},
-std::array<float,2>{0.534752131f, 0.973992109f},
-std::array<float,2>{0.176507175f, 0.655766308f},
-std::array<float,2>{0.828406394f, 0.306484818f},
-std::array<float,2>{0.119222984f, 0.425380468f},
-std::array<float,2>{0.943536103f, 0.561397314f},
-std::array<float,2>{0.336781621f, 0.7747159f},
-std::array<float,2>{0.664828658f, 0.042186588f},
-std::array<float,2>{0.284166187f, 0.339313537f},
-std::array<float,2>{0.694823802f, 0.727994382f},
-std::array<float,2>{0.0417145342f, 0.930941999f},
-std::array<float,2>{0.901155651f, 0.197684363f},
-std::array<float,2>{0.224645376f, 0.0965672657f},
-std::array<float,2>{0.75246197f, 0.818814337f},
-std::array<float,2>{0.447509974f, 0.562766552f},
-std::array<float,2>{0.610794246f, 0.439448714f},
-std::array<float,2>{0.356961191f, 0.00553999795f},
-std::array<float,2>{0.645905197f, 0.786283255f},
-std::array<float,2>{0.0647107437f, 0.503098309f},
-std::array<float,2>{0.998945951f, 0.383026958f},
-std::array<float,2>{0.126267582f, 0.27172637f},
-std::array<float,2>{0.865356803f, 0.6581375f},
-std::array<float,2>{0.419044167f, 0.956668437f},
-std::array<float,2>{0.510713816f, 0.158499792f},
-std::array<float,2>{0.494862705f, 0.496254742f},
-std::array<float,2>{0.589300454f, 0.599420965f},
-std::array<float,2>{0.206815347f, 0.847051799f},
-std::array<float,2>{0.794264019f, 0.0877454281f},
-std::array<float,2>{0.00888767652f, 0.225187302f},
-std::array<float,2>{0.920866072f, 0.887923241f},
-std::array<float,2>{0.271626413f, 0.700691164f},
-std::array<float,2>{0.732644558f, 0.362864465f},
-std::array<float,2>{0.373718649f, 0.227206424f},
-std::array<float,2>{0.628080606f, 0.875198185f},
-std::array<float,2>{0.0795313418f, 0.690455914f},
-std::array<float,2>{0.98198694f, 0.369076341f},
-std::array<float,2>{0.151375994f, 0.491647482f},
-std::array<float,2>{0.858162522f, 0.603679299f},
-std::array<float,2>{0.431275874f, 0.853327572f},
-std::array<float,2>{0.526258171f, 0.082901597f},
-std::array<float,2>{0.479185343f, 0.277674437f},
-std::array<float,2>{0.562960327f, 0.669113576f},
-std::array<float,2>{0.192944869f, 0.961378157f},
-std::array<float,2>{0.808754981f, 0.165480003f},
-std::array<float,2>{0.0187004786f, 0.0118262861f},
-std::array<float,2>{0.936531961f, 0.794227421f},
-std::array<float,2>{0.263177842f, 0.51325804f},
-std::array<float,2>{0.748815358f, 0.376053423f},
-std::array<float,2>{0.383750468f, 0.107795037f},
-std::array<float,2>{0.559444845f, 0.822836041f},
-std::array<float,2>{0.163218766f, 0.575239778f},
-std::array<float,2>{0.813729823f, 0.449588329f},
-std::array<float,2>{0.0990996659f, 0.335272759f},
-std::array<float,2>{0.958054185f, 0.722450256f},
-std::array<float,2>{0.320178986f, 0.928007543f},
-std::array<float,2>{0.682022095f, 0.188979581f},
-std::array<float,2>{0.301662475f, 0.435205013f},
-std::array<float,2>{0.705763161f, 0.549451828f},
-std::array<float,2>{0.0487551279f, 0.773396313f},
-std::array<float,2>{0.888051093f, 0.0319198593f},
-std::array<float,2>{0.237338021f, 0.145543903f},
-std::array<float,2>{0.775543928f, 0.982736647f},
-std::array<float,2>{0.457072824f, 0.642203271f},
-std::array<float,2>{0.595344007f, 0.297301322f},
-std::array<float,2>{0.449929088f, 0.183000982f},
-std::array<float,2>{0.614592552f, 0.950204849f},
-std::array<float,2>{0.220444977f, 0.679167092f},
-std::array<float,2>{0.757477105f, 0.263566196f},
-std::array<float,2>{0.0452333018f, 0.399525225f},
-std::array<float,2>{0.90302968f, 0.530334294f},
-std::array<float,2>{0.28814587f, 0.811276019f},
-std::array<float,2>{0.688670278f, 0.0183176734f},
-std::array<float,2>{0.342822492f, 0.34407118f},
-std::array<float,2>{0.671077132f, 0.710923254f},
-std::array<float,2>{0.121982992f, 0.895475984f},
-std::array<float,2>{0.940570891f, 0.248999432f},
-std::array<float,2>{0.17239432f, 0.075333491f},
-std::array<float,2>{0.834385991f, 0.859779119f},
-std::array<float,2>{0.390681297f, 0.621502459f},
-std::array<float,2>{0.536387086f, 0.476760805f},
-std::array<float,2>{0.269171476f, 0.0576994494f},
-std::array<float,2>{0.72710073f, 0.750598431f},
-std::array<float,2>{0.0133099649f, 0.535386145f},
-std::array<float,2>{0.916767895f, 0.415085286f},
-std::array<float,2>{0.209461167f, 0.296464562f},
-std::array<float,2>{0.792506337f, 0.633458734f},
-std::array<float,2>{0.496855527f, 0.994178772f},
-std::array<float,2>{0.593501627f, 0.136942491f},
-std::array<float,2>{0.417484552f, 0.460771143f},
-std::array<float,2>{0.512416422f, 0.592315912f},
-std::array<float,2>{0.129311159f, 0.841677845f},
-std::array<float,2>{0.859599888f, 0.124845661f},
-std::array<float,2>{0.066657804f, 0.213043511f},
-std::array<float,2>{0.99387157f, 0.913390398f},
-std::array<float,2>{0.354668885f, 0.746047735f},
-std::array<float,2>{0.642364025f, 0.319416523f},
-std::array<float,2>{0.291495621f, 0.129697189f},
-std::array<float,2>{0.699942708f, 0.990595222f},
-std::array<float,2>{0.0320781954f, 0.626778543f},
-std::array<float,2>{0.89531213f, 0.281571656f},
-std::array<float,2>{0.229687005f, 0.407725334f},
-std::array<float,2>{0.760561943f, 0.545836031f},
-std::array<float,2>{0.439776748f, 0.760921717f},
-std::array<float,2>{0.620681942f, 0.0514627844f},
-std::array<float,2>{0.404663324f, 0.32262665f},
-std::array<float,2>{0.543189228f, 0.736809969f},
-std::array<float,2>{0.182506472f, 0.914081216f},
-std::array<float,2>{0.842633009f, 0.207240224f},
-std::array<float,2>{0.11681094f, 0.112688154f},
-std::array<float,2>{0.950288475f, 0.828184545f},
-std::array<float,2>{0.329239756f, 0.581505775f},
-std::array<float,2>{0.660351157f, 0.463850111f},
-std::array<float,2>{0.484630942f, 0.0263008475f},
-std::array<float,2>{0.581191719f, 0.797971845f},
-std::array<float,2>{0.216244221f, 0.516006112f},
-std::array<float,2>{0.781310618f, 0.396865875f},
-std::array<float,2>{0.00512126787f, 0.253506929f},
-std::array<float,2>{0.913113356f, 0.682165563f},
-std::array<float,2>{0.280307561f, 0.943106949f},
-std::array<float,2>{0.724905431f, 0.174605325f},
-std::array<float,2>{0.344755262f, 0.475851506f},
-std::array<float,2>{0.648895979f, 0.616477728f},
-std::array<float,2>{0.0729270428f, 0.869815528f},
-std::array<float,2>{0.986924171f, 0.0657417327f},
-std::array<float,2>{0.138690785f, 0.236418709f},
-std::array<float,2>{0.8689484f, 0.903956473f},
-std::array<float,2>{0.412635803f, 0.718348563f},
-std::array<float,2>{0.50351423f, 0.356835037f},
-std::array<float,2>{0.424994528f, 0.200415581f},
-std::array<float,2>{0.515941262f, 0.933945239f},
-std::array<float,2>{0.146272495f, 0.731844604f},
-std::array<float,2>{0.847030938f, 0.341813654f},
-std::array<float,2>{0.0876546204f, 0.444823593f},
-std::array<float,2>{0.970652223f, 0.56865561f},
-std::array<float,2>{0.363689929f, 0.813345313f},
-std::array<float,2>{0.63384527f, 0.100952551f},
-std::array<float,2>{0.251671046f, 0.309510976f},
-std::array<float,2>{0.737538636f, 0.651947677f},
-std::array<float,2>{0.0293223504f, 0.972311378f},
-std::array<float,2>{0.929484844f, 0.153266996f},
-std::array<float,2>{0.202530473f, 0.043471586f},
-std::array<float,2>{0.798628628f, 0.77737689f},
-std::array<float,2>{0.469535947f, 0.556810319f},
-std::array<float,2>{0.572293341f, 0.426881969f},
-std::array<float,2>{0.322800696f, 0.0917496383f},
-std::array<float,2>{0.678093731f, 0.848359406f},
-std::array<float,2>{0.108021483f, 0.596125364f},
-std::array<float,2>{0.968308985f, 0.49330005f},
-std::array<float,2>{0.16802153f, 0.366718352f},
-std::array<float,2>{0.8247751f, 0.695691526f},
-std::array<float,2>{0.37846598f, 0.885291636f},
-std::array<float,2>{0.549904943f, 0.221702278f},
-std::array<float,2>{0.466200292f, 0.388904959f},
-std::array<float,2>{0.604362726f, 0.504517496f},
-std::array<float,2>{0.247523308f, 0.783554375f},
-std::array<float,2>{0.771904767f, 0.00205144798f},
-std::array<float,2>{0.057473626f, 0.16215308f},
-std::array<float,2>{0.879803479f, 0.958440423f},
-std::array<float,2>{0.305653244f, 0.660338402f},
-std::array<float,2>{0.715884924f, 0.26772061f},
-std::array<float,2>{0.349905103f, 0.143666103f},
-std::array<float,2>{0.655133665f, 0.977327943f},
-std::array<float,2>{0.0775908977f, 0.64760375f},
-std::array<float,2>{0.989760697f, 0.302388787f},
-std::array<float,2>{0.133900881f, 0.430232227f},
-std::array<float,2>{0.87129575f, 0.553616703f},
-std::array<float,2>{0.409483671f, 0.76786679f},
-std::array<float,2>{0.505983293f, 0.0379816405f},
-std::array<float,2>{0.489137411f, 0.331859082f},
-std::array<float,2>{0.584545672f, 0.723353148f},
-std::array<float,2>{0.214122444f, 0.922300994f},
-std::array<float,2>{0.786128104f, 0.195016548f},
-std::array<float,2>{0.00109109597f, 0.103048094f},
-std::array<float,2>{0.909420371f, 0.825050771f},
-std::array<float,2>{0.274121076f, 0.57155174f},
-std::array<float,2>{0.719037056f, 0.4474307f},
-std::array<float,2>{0.400152981f, 0.00920112431f},
-std::array<float,2>{0.542273879f, 0.789098382f},
-std::array<float,2>{0.186209157f, 0.510452807f},
-std::array<float,2>{0.837670624f, 0.379014701f},
-std::array<float,2>{0.112320803f, 0.275118142f},
-std::array<float,2>{0.946801722f, 0.664745212f},
-std::array<float,2>{0.333544105f, 0.966025352f},
-std::array<float,2>{0.658828378f, 0.170861408f},
-std::array<float,2>{0.296347648f, 0.485469699f},
-std::array<float,2>{0.695649087f, 0.60922581f},
-std::array<float,2>{0.0386384539f, 0.858113647f},
-std::array<float,2>{0.891656816f, 0.0810318738f},
-std::array<float,2>{0.233477458f, 0.233800068f},
-std::array<float,2>{0.762025476f, 0.881612957f},
-std::array<float,2>{0.444586039f, 0.693062603f},
-std::array<float,2>{0.622727096f, 0.37407586f},
-std::array<float,2>{0.461965978f, 0.218046188f},
-std::array<float,2>{0.609309196f, 0.909877956f},
-std::array<float,2>{0.245253265f, 0.749795139f},
-std::array<float,2>{0.768808722f, 0.315612078f},
-std::array<float,2>{0.0614204518f, 0.456753194f},
-std::array<float,2>{0.877403796f, 0.586968899f},
-std::array<float,2>{0.310991496f, 0.836018741f},
-std::array<float,2>{0.714787662f, 0.119688325f},
-std::array<float,2>{0.325351626f, 0.291287482f},
-std::array<float,2>{0.674776077f, 0.63893652f},
-std::array<float,2>{0.102471635f, 0.999628365f},
-std::array<float,2>{0.963071167f, 0.136054948f},
-std::array<float,2>{0.167558908f, 0.05972597f},
-std::array<float,2>{0.820472419f, 0.755848885f},
-std::array<float,2>{0.379962951f, 0.531523824f},
-std::array<float,2>{0.552098036f, 0.420312852f},
-std::array<float,2>{0.256905735f, 0.0717211589f},
-std::array<float,2>{0.738577306f, 0.864978254f},
-std::array<float,2>{0.0268462282f, 0.618773878f},
-std::array<float,2>{0.923754573f, 0.481755614f},
-std::array<float,2>{0.196141809f, 0.349357188f},
-std::array<float,2>{0.804003537f, 0.70468998f},
-std::array<float,2>{0.473208457f, 0.891648769f},
-std::array<float,2>{0.576094568f, 0.242380947f},
-std::array<float,2>{0.429082841f, 0.405238122f},
-std::array<float,2>{0.521968663f, 0.524787843f},
-std::array<float,2>{0.142981112f, 0.805532336f},
-std::array<float,2>{0.850828171f, 0.0200304985f},
-std::array<float,2>{0.0931479633f, 0.185487524f},
-std::array<float,2>{0.973919868f, 0.946931064f},
-std::array<float,2>{0.361404806f, 0.674214125f},
-std::array<float,2>{0.638488412f, 0.257837355f},
-std::array<float,2>{0.300257266f, 0.239891961f},
-std::array<float,2>{0.709080279f, 0.899288476f},
-std::array<float,2>{0.0511280112f, 0.713650823f},
-std::array<float,2>{0.885883093f, 0.35270381f},
-std::array<float,2>{0.241152525f, 0.470393777f},
-std::array<float,2>{0.780867159f, 0.609425187f},
-std::array<float,2>{0.456329405f, 0.871804237f},
-std::array<float,2>{0.598326504f, 0.0670001134f},
-std::array<float,2>{0.390136749f, 0.256742567f},
-std::array<float,2>{0.555627465f, 0.686224341f},
-std::array<float,2>{0.157774448f, 0.938657522f},
-std::array<float,2>{0.819984317f, 0.17794311f},
-std::array<float,2>{0.0954774842f, 0.0281667225f},
-std::array<float,2>{0.954736471f, 0.803757191f},
-std::array<float,2>{0.31568718f, 0.522512674f},
-std::array<float,2>{0.684558094f, 0.392722428f},
-std::array<float,2>{0.484262496f, 0.113377109f},
-std::array<float,2>{0.568495452f, 0.833124578f},
-std::array<float,2>{0.190542206f, 0.584427297f},
-std::array<float,2>{0.80814594f, 0.4671278f},
-std::array<float,2>{0.0209838506f, 0.32601428f},
-std::array<float,2>{0.933535933f, 0.739128172f},
-std::array<float,2>{0.26087001f, 0.920159817f},
-std::array<float,2>{0.744997919f, 0.20667237f},
-std::array<float,2>{0.370879948f, 0.413825572f},
-std::array<float,2>{0.629212081f, 0.541671097f},
-std::array<float,2>{0.0857408345f, 0.763587236f},
-std::array<float,2>{0.978822589f, 0.0500583015f},
-std::array<float,2>{0.154848725f, 0.125218391f},
-std::array<float,2>{0.853095055f, 0.986929178f},
-std::array<float,2>{0.436533004f, 0.631518364f},
-std::array<float,2>{0.52995038f, 0.288895041f},
-std::array<float,2>{0.4209719f, 0.157654092f},
-std::array<float,2>{0.507854819f, 0.953694344f},
-std::array<float,2>{0.128673807f, 0.658390343f},
-std::array<float,2>{0.864112139f, 0.269554943f},
-std::array<float,2>{0.0639368743f, 0.385937661f},
-std::array<float,2>{0.996408761f, 0.500192046f},
-std::array<float,2>{0.358836621f, 0.787968934f},
-std::array<float,2>{0.64702481f, 0.00629045162f},
-std::array<float,2>{0.270403802f, 0.360113919f},
-std::array<float,2>{0.730773151f, 0.702666938f},
-std::array<float,2>{0.0107007427f, 0.889110923f},
-std::array<float,2>{0.918298483f, 0.224300414f},
-std::array<float,2>{0.204388201f, 0.0887543038f},
-std::array<float,2>{0.796300948f, 0.844908535f},
-std::array<float,2>{0.494118214f, 0.600375891f},
-std::array<float,2>{0.586478651f, 0.499121457f},
-std::array<float,2>{0.339579076f, 0.0393161029f},
-std::array<float,2>{0.667459726f, 0.77697283f},
-std::array<float,2>{0.118611664f, 0.559385359f},
-std::array<float,2>{0.942260742f, 0.423354208f},
-std::array<float,2>{0.179603875f, 0.307266176f},
-std::array<float,2>{0.830412388f, 0.652843714f},
-std::array<float,2>{0.39462626f, 0.976439297f},
-std::array<float,2>{0.532971919f, 0.152035832f},
-std::array<float,2>{0.445557415f, 0.440698832f},
-std::array<float,2>{0.611520231f, 0.564806998f},
-std::array<float,2>{0.22280626f, 0.818092942f},
-std::array<float,2>{0.750572801f, 0.094409354f},
-std::array<float,2>{0.0395481624f, 0.196855485f},
-std::array<float,2>{0.898888111f, 0.932343125f},
-std::array<float,2>{0.282700896f, 0.729932427f},
-std::array<float,2>{0.692736089f, 0.337827504f},
-std::array<float,2>{0.318191737f, 0.189820156f},
-std::array<float,2>{0.680440605f, 0.926420748f},
-std::array<float,2>{0.100481808f, 0.719694614f},
-std::array<float,2>{0.960182309f, 0.333300412f},
-std::array<float,2>{0.161393225f, 0.453040928f},
-std::array<float,2>{0.816359341f, 0.577952206f},
-std::array<float,2>{0.385536581f, 0.822072148f},
-std::array<float,2>{0.562020302f, 0.10668873f},
-std::array<float,2>{0.459536761f, 0.299176693f},
-std::array<float,2>{0.596336722f, 0.64277035f},
-std::array<float,2>{0.23555173f, 0.980826616f},
-std::array<float,2>{0.774808824f, 0.14819698f},
-std::array<float,2>{0.0507182889f, 0.0346600376f},
-std::array<float,2>{0.889274836f, 0.770554721f},
-std::array<float,2>{0.304192483f, 0.54816258f},
-std::array<float,2>{0.703614593f, 0.436462343f},
-std::array<float,2>{0.432928622f, 0.0849286318f},
-std::array<float,2>{0.524175107f, 0.854190946f},
-std::array<float,2>{0.148792356f, 0.602030754f},
-std::array<float,2>{0.856062114f, 0.489877999f},
-std::array<float,2>{0.0802575275f, 0.370767951f},
-std::array<float,2>{0.983981192f, 0.688324094f},
-std::array<float,2>{0.371244341f, 0.878463984f},
-std::array<float,2>{0.62522912f, 0.229483902f},
-std::array<float,2>{0.264676422f, 0.37871024f},
-std::array<float,2>{0.747711122f, 0.514838934f},
-std::array<float,2>{0.0165036414f, 0.796761274f},
-std::array<float,2>{0.934164107f, 0.0141076734f},
-std::array<float,2>{0.19423604f, 0.166626424f},
-std::array<float,2>{0.812371612f, 0.962896526f},
-std::array<float,2>{0.477866501f, 0.67065686f},
-std::array<float,2>{0.566102982f, 0.279950231f},
-std::array<float,2>{0.498207122f, 0.139951453f},
-std::array<float,2>{0.591432452f, 0.99341166f},
-std::array<float,2>{0.20882611f, 0.635734558f},
-std::array<float,2>{0.790067971f, 0.294568747f},
-std::array<float,2>{0.0152406087f, 0.417451173f},
-std::array<float,2>{0.914211214f, 0.537990391f},
-std::array<float,2>{0.265705824f, 0.752179384f},
-std::array<float,2>{0.729676843f, 0.0555076711f},
-std::array<float,2>{0.353480101f, 0.318165839f},
-std::array<float,2>{0.643418312f, 0.742288888f},
-std::array<float,2>{0.0695835873f, 0.911378205f},
-std::array<float,2>{0.995007098f, 0.211865008f},
-std::array<float,2>{0.132190838f, 0.121165477f},
-std::array<float,2>{0.862547576f, 0.842985034f},
-std::array<float,2>{0.414782226f, 0.591357768f},
-std::array<float,2>{0.513786912f, 0.457065761f},
-std::array<float,2>{0.285412461f, 0.016351914f},
-std::array<float,2>{0.691270828f, 0.80880636f},
-std::array<float,2>{0.044582624f, 0.528804898f},
-std::array<float,2>{0.90436244f, 0.40130192f},
-std::array<float,2>{0.220723242f, 0.264852256f},
-std::array<float,2>{0.754633844f, 0.677694857f},
-std::array<float,2>{0.452945948f, 0.952252328f},
-std::array<float,2>{0.616163611f, 0.180671468f},
-std::array<float,2>{0.394336253f, 0.478602022f},
-std::array<float,2>{0.537809253f, 0.623997569f},
-std::array<float,2>{0.175401688f, 0.861744821f},
-std::array<float,2>{0.833145916f, 0.0776593164f},
-std::array<float,2>{0.123752929f, 0.247941121f},
-std::array<float,2>{0.937671959f, 0.896589398f},
-std::array<float,2>{0.34174037f, 0.708854735f},
-std::array<float,2>{0.668353438f, 0.345793307f},
-std::array<float,2>{0.278470367f, 0.173207164f},
-std::array<float,2>{0.723581314f, 0.944283605f},
-std::array<float,2>{0.00749742752f, 0.679784119f},
-std::array<float,2>{0.910903215f, 0.251163036f},
-std::array<float,2>{0.218748257f, 0.395700574f},
-std::array<float,2>{0.783702552f, 0.519385815f},
-std::array<float,2>{0.48772797f, 0.799559295f},
-std::array<float,2>{0.579380751f, 0.0234558284f},
-std::array<float,2>{0.411439627f, 0.358974785f},
-std::array<float,2>{0.501469076f, 0.714880228f},
-std::array<float,2>{0.137425482f, 0.904877543f},
-std::array<float,2>{0.870387495f, 0.234925643f},
-std::array<float,2>{0.0716582686f, 0.0629364401f},
-std::array<float,2>{0.985549569f, 0.867374897f},
-std::array<float,2>{0.345968843f, 0.61370492f},
-std::array<float,2>{0.651423514f, 0.47399056f},
-std::array<float,2>{0.437986135f, 0.0533536263f},
-std::array<float,2>{0.617956221f, 0.758145869f},
-std::array<float,2>{0.228388727f, 0.544271111f},
-std::array<float,2>{0.7585513f, 0.408276737f},
-std::array<float,2>{0.0346690156f, 0.284687102f},
-std::array<float,2>{0.898328066f, 0.628555715f},
-std::array<float,2>{0.289289117f, 0.988743782f},
-std::array<float,2>{0.701537132f, 0.131865889f},
-std::array<float,2>{0.330497205f, 0.461504042f},
-std::array<float,2>{0.663421452f, 0.579459786f},
-std::array<float,2>{0.114482947f, 0.830143273f},
-std::array<float,2>{0.952656865f, 0.109698921f},
-std::array<float,2>{0.180109918f, 0.209602669f},
-std::array<float,2>{0.840446472f, 0.917265534f},
-std::array<float,2>{0.402639776f, 0.734635055f},
-std::array<float,2>{0.545807183f, 0.32120803f},
-std::array<float,2>{0.37624678f, 0.220459163f},
-std::array<float,2>{0.548111975f, 0.884288251f},
-std::array<float,2>{0.17004621f, 0.6982373f},
-std::array<float,2>{0.826338828f, 0.363330662f},
-std::array<float,2>{0.105815805f, 0.495794863f},
-std::array<float,2>{0.965737402f, 0.594087303f},
-std::array<float,2>{0.321896225f, 0.850233555f},
-std::array<float,2>{0.676241815f, 0.092029199f},
-std::array<float,2>{0.30852747f, 0.267069519f},
-std::array<float,2>{0.718007684f, 0.663418353f},
-std::array<float,2>{0.0561821237f, 0.960118115f},
-std::array<float,2>{0.881932139f, 0.161162674f},
-std::array<float,2>{0.248828992f, 0.00148050766f},
-std::array<float,2>{0.770235837f, 0.781573951f},
-std::array<float,2>{0.468118697f, 0.507236481f},
-std::array<float,2>{0.601975083f, 0.388232619f},
-std::array<float,2>{0.366679639f, 0.0988964215f},
-std::array<float,2>{0.636031091f, 0.815221369f},
-std::array<float,2>{0.0894379914f, 0.567374468f},
-std::array<float,2>{0.971866727f, 0.442772686f},
-std::array<float,2>{0.147849753f, 0.340270489f},
-std::array<float,2>{0.844341695f, 0.732777834f},
-std::array<float,2>{0.42358467f, 0.937030494f},
-std::array<float,2>{0.517975211f, 0.202729598f},
-std::array<float,2>{0.472184032f, 0.429389447f},
-std::array<float,2>{0.571061373f, 0.555662274f},
-std::array<float,2>{0.199429899f, 0.780601382f},
-std::array<float,2>{0.800390005f, 0.0454675257f},
-std::array<float,2>{0.02898461f, 0.155570149f},
-std::array<float,2>{0.925913572f, 0.969748616f},
-std::array<float,2>{0.25321272f, 0.648801267f},
-std::array<float,2>{0.735312104f, 0.311166316f},
-std::array<float,2>{0.358990967f, 0.158830568f},
-std::array<float,2>{0.646570325f, 0.956150413f},
-std::array<float,2>{0.06400235f, 0.657674611f},
-std::array<float,2>{0.996683359f, 0.27226311f},
-std::array<float,2>{0.128356308f, 0.3837201f},
-std::array<float,2>{0.863327742f, 0.503661692f},
-std::array<float,2>{0.421712786f, 0.786958933f},
-std::array<float,2>{0.508596003f, 0.0052825138f},
-std::array<float,2>{0.493583262f, 0.362653255f},
-std::array<float,2>{0.586399853f, 0.700468481f},
-std::array<float,2>{0.205055505f, 0.888589919f},
-std::array<float,2>{0.796800017f, 0.224623978f},
-std::array<float,2>{0.00997438468f, 0.0870854333f},
-std::array<float,2>{0.918655038f, 0.847373784f},
-std::array<float,2>{0.26999861f, 0.598668218f},
-std::array<float,2>{0.731017649f, 0.49676165f},
-std::array<float,2>{0.395041347f, 0.0425751284f},
-std::array<float,2>{0.532602429f, 0.775154412f},
-std::array<float,2>{0.179010272f, 0.560931861f},
-std::array<float,2>{0.830923438f, 0.425131261f},
-std::array<float,2>{0.119000539f, 0.305711687f},
-std::array<float,2>{0.941470385f, 0.655439973f},
-std::array<float,2>{0.338901728f, 0.974440694f},
-std::array<float,2>{0.667685688f, 0.149124727f},
-std::array<float,2>{0.282907277f, 0.438640416f},
-std::array<float,2>{0.692966521f, 0.563002229f},
-std::array<float,2>{0.0399515554f, 0.819245398f},
-std::array<float,2>{0.899085164f, 0.0958746001f},
-std::array<float,2>{0.22344175f, 0.197860539f},
-std::array<float,2>{0.750248551f, 0.931479573f},
-std::array<float,2>{0.445839494f, 0.728040159f},
-std::array<float,2>{0.612022638f, 0.339733124f},
-std::array<float,2>{0.456803232f, 0.241767153f},
-std::array<float,2>{0.598056078f, 0.90179795f},
-std::array<float,2>{0.240645677f, 0.712315321f},
-std::array<float,2>{0.780275583f, 0.354361683f},
-std::array<float,2>{0.0514959656f, 0.471646875f},
-std::array<float,2>{0.886303008f, 0.611883104f},
-std::array<float,2>{0.300329983f, 0.873594105f},
-std::array<float,2>{0.709665298f, 0.0694993287f},
-std::array<float,2>{0.316136241f, 0.254720569f},
-std::array<float,2>{0.683787107f, 0.684467256f},
-std::array<float,2>{0.0948700532f, 0.940559626f},
-std::array<float,2>{0.954311252f, 0.176716164f},
-std::array<float,2>{0.157292381f, 0.0305209123f},
-std::array<float,2>{0.819518387f, 0.802096665f},
-std::array<float,2>{0.389674008f, 0.520563602f},
-std::array<float,2>{0.554826856f, 0.392266393f},
-std::array<float,2>{0.261500776f, 0.115853392f},
-std::array<float,2>{0.744425118f, 0.835441172f},
-std::array<float,2>{0.0214148499f, 0.583704293f},
-std::array<float,2>{0.933104515f, 0.466131181f},
-std::array<float,2>{0.191138357f, 0.327386618f},
-std::array<float,2>{0.807887316f, 0.740551114f},
-std::array<float,2>{0.48375535f, 0.918628335f},
-std::array<float,2>{0.569238663f, 0.204619423f},
-std::array<float,2>{0.437173754f, 0.411738873f},
-std::array<float,2>{0.52937752f, 0.53922379f},
-std::array<float,2>{0.154728532f, 0.765087306f},
-std::array<float,2>{0.852720439f, 0.0483048484f},
-std::array<float,2>{0.0850489065f, 0.128128171f},
-std::array<float,2>{0.979082167f, 0.984437466f},
-std::array<float,2>{0.370526224f, 0.630799472f},
-std::array<float,2>{0.629731476f, 0.28631869f},
-std::array<float,2>{0.311065227f, 0.215808213f},
-std::array<float,2>{0.714205682f, 0.907458961f},
-std::array<float,2>{0.0608855598f, 0.747846544f},
-std::array<float,2>{0.877635956f, 0.31360054f},
-std::array<float,2>{0.246055499f, 0.453825235f},
-std::array<float,2>{0.769281924f, 0.588928819f},
-std::array<float,2>{0.462704659f, 0.837899148f},
-std::array<float,2>{0.608873963f, 0.118960567f},
-std::array<float,2>{0.380859256f, 0.289560795f},
-std::array<float,2>{0.552281022f, 0.638193548f},
-std::array<float,2>{0.167428195f, 0.996891141f},
-std::array<float,2>{0.820889652f, 0.133882403f},
-std::array<float,2>{0.101879515f, 0.0617611185f},
-std::array<float,2>{0.963862598f, 0.757154047f},
-std::array<float,2>{0.325743526f, 0.533598423f},
-std::array<float,2>{0.673977077f, 0.418164223f},
-std::array<float,2>{0.473020196f, 0.073202081f},
-std::array<float,2>{0.575500071f, 0.865941286f},
-std::array<float,2>{0.195486248f, 0.619273841f},
-std::array<float,2>{0.804305136f, 0.483623624f},
-std::array<float,2>{0.0271714162f, 0.350681424f},
-std::array<float,2>{0.923202455f, 0.705113947f},
-std::array<float,2>{0.257609874f, 0.89323467f},
-std::array<float,2>{0.739057779f, 0.245161951f},
-std::array<float,2>{0.362301886f, 0.404258728f},
-std::array<float,2>{0.637836218f, 0.527222753f},
-std::array<float,2>{0.0935022607f, 0.807612896f},
-std::array<float,2>{0.974223375f, 0.022259986f},
-std::array<float,2>{0.143353194f, 0.186221108f},
-std::array<float,2>{0.851323247f, 0.947797596f},
-std::array<float,2>{0.429353446f, 0.672757328f},
-std::array<float,2>{0.522048295f, 0.260581851f},
-std::array<float,2>{0.409924865f, 0.141654775f},
-std::array<float,2>{0.506459892f, 0.979935765f},
-std::array<float,2>{0.134478912f, 0.644631922f},
-std::array<float,2>{0.871848047f, 0.303892523f},
-std::array<float,2>{0.0778715685f, 0.432406723f},
-std::array<float,2>{0.989284813f, 0.551974177f},
-std::array<float,2>{0.350337774f, 0.767138064f},
-std::array<float,2>{0.654309392f, 0.0357093103f},
-std::array<float,2>{0.273815632f, 0.328356445f},
-std::array<float,2>{0.719456017f, 0.726195157f},
-std::array<float,2>{0.00155517005f, 0.924874067f},
-std::array<float,2>{0.909877479f, 0.192050472f},
-std::array<float,2>{0.21435906f, 0.103891991f},
-std::array<float,2>{0.785605073f, 0.827986836f},
-std::array<float,2>{0.488726437f, 0.573887765f},
-std::array<float,2>{0.584420443f, 0.447131366f},
-std::array<float,2>{0.333335936f, 0.0113720326f},
-std::array<float,2>{0.658324122f, 0.792647898f},
-std::array<float,2>{0.113180391f, 0.508168519f},
-std::array<float,2>{0.946396947f, 0.382674992f},
-std::array<float,2>{0.185652241f, 0.276813507f},
-std::array<float,2>{0.837015152f, 0.666788638f},
-std::array<float,2>{0.399426222f, 0.968001485f},
-std::array<float,2>{0.542900085f, 0.168928981f},
-std::array<float,2>{0.445289135f, 0.486352593f},
-std::array<float,2>{0.622418284f, 0.605896592f},
-std::array<float,2>{0.234037399f, 0.856729805f},
-std::array<float,2>{0.762635529f, 0.0800518617f},
-std::array<float,2>{0.0384271443f, 0.231046841f},
-std::array<float,2>{0.892288387f, 0.878926158f},
-std::array<float,2>{0.296765298f, 0.694167435f},
-std::array<float,2>{0.695850432f, 0.371489435f},
-std::array<float,2>{0.321414709f, 0.222407863f},
-std::array<float,2>{0.67642504f, 0.884770393f},
-std::array<float,2>{0.106230333f, 0.695950508f},
-std::array<float,2>{0.965148151f, 0.366255939f},
-std::array<float,2>{0.170478418f, 0.493706971f},
-std::array<float,2>{0.826676011f, 0.59659332f},
-std::array<float,2>{0.376516312f, 0.848138928f},
-std::array<float,2>{0.548412681f, 0.0912646204f},
-std::array<float,2>{0.468419015f, 0.268082261f},
-std::array<float,2>{0.602452576f, 0.660949349f},
-std::array<float,2>{0.248379886f, 0.958681822f},
-std::array<float,2>{0.769779861f, 0.162815213f},
-std::array<float,2>{0.0559189655f, 0.00284708012f},
-std::array<float,2>{0.882342637f, 0.784065247f},
-std::array<float,2>{0.307793111f, 0.504153192f},
-std::array<float,2>{0.718362987f, 0.38944602f},
-std::array<float,2>{0.423289806f, 0.101215921f},
-std::array<float,2>{0.518165827f, 0.812874973f},
-std::array<float,2>{0.148238078f, 0.56926918f},
-std::array<float,2>{0.844202101f, 0.445124805f},
-std::array<float,2>{0.0892991945f, 0.342621624f},
-std::array<float,2>{0.972589791f, 0.732218087f},
-std::array<float,2>{0.36695683f, 0.934333086f},
-std::array<float,2>{0.636685014f, 0.200910017f},
-std::array<float,2>{0.253687948f, 0.42762655f},
-std::array<float,2>{0.734434783f, 0.557422936f},
-std::array<float,2>{0.028473774f, 0.778098106f},
-std::array<float,2>{0.926672995f, 0.0432978012f},
-std::array<float,2>{0.199888542f, 0.152631298f},
-std::array<float,2>{0.800220966f, 0.971939623f},
-std::array<float,2>{0.471736163f, 0.651585281f},
-std::array<float,2>{0.570324302f, 0.308997154f},
-std::array<float,2>{0.488253176f, 0.17426081f},
-std::array<float,2>{0.579898477f, 0.942449749f},
-std::array<float,2>{0.218065709f, 0.681816697f},
-std::array<float,2>{0.783273101f, 0.253014207f},
-std::array<float,2>{0.00689799851f, 0.397220165f},
-std::array<float,2>{0.910545886f, 0.516529381f},
-std::array<float,2>{0.278963357f, 0.798442364f},
-std::array<float,2>{0.722861111f, 0.0254869182f},
-std::array<float,2>{0.346429825f, 0.357106924f},
-std::array<float,2>{0.652106464f, 0.718049407f},
-std::array<float,2>{0.0720761195f, 0.903351068f},
-std::array<float,2>{0.986184299f, 0.236876607f},
-std::array<float,2>{0.136915401f, 0.0660022944f},
-std::array<float,2>{0.870759666f, 0.869261265f},
-std::array<float,2>{0.411948621f, 0.61692059f},
-std::array<float,2>{0.501239061f, 0.476141602f},
-std::array<float,2>{0.28972438f, 0.0510614067f},
-std::array<float,2>{0.701756358f, 0.761670709f},
-std::array<float,2>{0.0342598557f, 0.545200646f},
-std::array<float,2>{0.897623062f, 0.407709628f},
-std::array<float,2>{0.227589637f, 0.281908542f},
-std::array<float,2>{0.758029282f, 0.626463354f},
-std::array<float,2>{0.438304663f, 0.990842521f},
-std::array<float,2>{0.617337704f, 0.129023388f},
-std::array<float,2>{0.403126925f, 0.463367283f},
-std::array<float,2>{0.545082152f, 0.581945539f},
-std::array<float,2>{0.180616215f, 0.828761041f},
-std::array<float,2>{0.840329289f, 0.112804867f},
-std::array<float,2>{0.114796542f, 0.207656369f},
-std::array<float,2>{0.952439547f, 0.914905965f},
-std::array<float,2>{0.330850899f, 0.736966431f},
-std::array<float,2>{0.663738966f, 0.323012352f},
-std::array<float,2>{0.266389757f, 0.137691006f},
-std::array<float,2>{0.730371952f, 0.99506551f},
-std::array<float,2>{0.0149149867f, 0.633040845f},
-std::array<float,2>{0.914553106f, 0.296364278f},
-std::array<float,2>{0.208212227f, 0.41587171f},
-std::array<float,2>{0.790734231f, 0.535676241f},
-std::array<float,2>{0.498897165f, 0.75039959f},
-std::array<float,2>{0.59118408f, 0.0582280159f},
-std::array<float,2>{0.4142344f, 0.320196956f},
-std::array<float,2>{0.514459431f, 0.745435715f},
-std::array<float,2>{0.132686526f, 0.913878858f},
-std::array<float,2>{0.863179862f, 0.213403016f},
-std::array<float,2>{0.0699519292f, 0.124095775f},
-std::array<float,2>{0.994226575f, 0.84104073f},
-std::array<float,2>{0.352716684f, 0.592158735f},
-std::array<float,2>{0.642906845f, 0.460246056f},
-std::array<float,2>{0.452263236f, 0.0177230611f},
-std::array<float,2>{0.615617573f, 0.810853601f},
-std::array<float,2>{0.221215725f, 0.53109467f},
-std::array<float,2>{0.753987014f, 0.400346875f},
-std::array<float,2>{0.0441250578f, 0.263128012f},
-std::array<float,2>{0.904868186f, 0.679618955f},
-std::array<float,2>{0.28569442f, 0.951029241f},
-std::array<float,2>{0.690871298f, 0.183285728f},
-std::array<float,2>{0.34100315f, 0.477367967f},
-std::array<float,2>{0.668684006f, 0.621930122f},
-std::array<float,2>{0.123156622f, 0.859981477f},
-std::array<float,2>{0.938039839f, 0.0758763254f},
-std::array<float,2>{0.174850926f, 0.248279005f},
-std::array<float,2>{0.833760381f, 0.894738019f},
-std::array<float,2>{0.393983305f, 0.710060358f},
-std::array<float,2>{0.537520766f, 0.344373584f},
-std::array<float,2>{0.385035992f, 0.188886508f},
-std::array<float,2>{0.561638892f, 0.928504229f},
-std::array<float,2>{0.162022382f, 0.722138286f},
-std::array<float,2>{0.815545261f, 0.335650295f},
-std::array<float,2>{0.0997781977f, 0.450145066f},
-std::array<float,2>{0.960840166f, 0.576003969f},
-std::array<float,2>{0.3177948f, 0.822375059f},
-std::array<float,2>{0.680100799f, 0.108061709f},
-std::array<float,2>{0.304538757f, 0.29757151f},
-std::array<float,2>{0.703164697f, 0.642056346f},
-std::array<float,2>{0.0500849895f, 0.983264148f},
-std::array<float,2>{0.88912648f, 0.146141112f},
-std::array<float,2>{0.236280888f, 0.0315845497f},
-std::array<float,2>{0.775027156f, 0.772897542f},
-std::array<float,2>{0.459264696f, 0.548855424f},
-std::array<float,2>{0.59587723f, 0.434854895f},
-std::array<float,2>{0.371916056f, 0.082150124f},
-std::array<float,2>{0.625546634f, 0.852964282f},
-std::array<float,2>{0.0807913467f, 0.604244471f},
-std::array<float,2>{0.98380053f, 0.492123246f},
-std::array<float,2>{0.149262354f, 0.368379384f},
-std::array<float,2>{0.855900109f, 0.691103756f},
-std::array<float,2>{0.433143139f, 0.875835478f},
-std::array<float,2>{0.523663819f, 0.226687759f},
-std::array<float,2>{0.478501618f, 0.376896739f},
-std::array<float,2>{0.565652013f, 0.513174117f},
-std::array<float,2>{0.19355312f, 0.794763744f},
-std::array<float,2>{0.811946154f, 0.0123972222f},
-std::array<float,2>{0.0158612728f, 0.16554831f},
-std::array<float,2>{0.933650374f, 0.961752951f},
-std::array<float,2>{0.265321851f, 0.669869184f},
-std::array<float,2>{0.747409225f, 0.278082043f},
-std::array<float,2>{0.33625558f, 0.151424631f},
-std::array<float,2>{0.664218724f, 0.975765288f},
-std::array<float,2>{0.119900689f, 0.652741015f},
-std::array<float,2>{0.943900347f, 0.306880742f},
-std::array<float,2>{0.176162437f, 0.422904968f},
-std::array<float,2>{0.829073489f, 0.558669925f},
-std::array<float,2>{0.396821052f, 0.776552379f},
-std::array<float,2>{0.534649611f, 0.0399397798f},
-std::array<float,2>{0.448108912f, 0.337161452f},
-std::array<float,2>{0.611143947f, 0.730359435f},
-std::array<float,2>{0.225325137f, 0.932114005f},
-std::array<float,2>{0.752079904f, 0.196643397f},
-std::array<float,2>{0.0412290245f, 0.094045639f},
-std::array<float,2>{0.90063417f, 0.817557037f},
-std::array<float,2>{0.283626199f, 0.565301299f},
-std::array<float,2>{0.694966376f, 0.441221416f},
-std::array<float,2>{0.419889927f, 0.00640501129f},
-std::array<float,2>{0.510128856f, 0.787143707f},
-std::array<float,2>{0.126789704f, 0.500617981f},
-std::array<float,2>{0.866091728f, 0.386602879f},
-std::array<float,2>{0.065355055f, 0.270446867f},
-std::array<float,2>{0.998296201f, 0.658999503f},
-std::array<float,2>{0.356543958f, 0.953149199f},
-std::array<float,2>{0.646074355f, 0.158156335f},
-std::array<float,2>{0.272097886f, 0.499517918f},
-std::array<float,2>{0.733271241f, 0.599873662f},
-std::array<float,2>{0.00955024175f, 0.845630705f},
-std::array<float,2>{0.920169234f, 0.0880370215f},
-std::array<float,2>{0.206127971f, 0.2236619f},
-std::array<float,2>{0.794459045f, 0.889322281f},
-std::array<float,2>{0.494147211f, 0.702242196f},
-std::array<float,2>{0.589783549f, 0.359563679f},
-std::array<float,2>{0.480559736f, 0.20613277f},
-std::array<float,2>{0.56819284f, 0.920728028f},
-std::array<float,2>{0.188577011f, 0.738350034f},
-std::array<float,2>{0.805470347f, 0.325682819f},
-std::array<float,2>{0.0230725333f, 0.467665136f},
-std::array<float,2>{0.931328773f, 0.584851623f},
-std::array<float,2>{0.258341223f, 0.833643854f},
-std::array<float,2>{0.743588626f, 0.114002869f},
-std::array<float,2>{0.367894143f, 0.288140714f},
-std::array<float,2>{0.632617533f, 0.630955935f},
-std::array<float,2>{0.0833386332f, 0.986539543f},
-std::array<float,2>{0.97662127f, 0.125947773f},
-std::array<float,2>{0.15269576f, 0.0506875031f},
-std::array<float,2>{0.854229271f, 0.763150096f},
-std::array<float,2>{0.434408545f, 0.541154444f},
-std::array<float,2>{0.5277794f, 0.413439333f},
-std::array<float,2>{0.297244728f, 0.0666125268f},
-std::array<float,2>{0.707456827f, 0.871106386f},
-std::array<float,2>{0.0539175421f, 0.609917343f},
-std::array<float,2>{0.88456136f, 0.470111489f},
-std::array<float,2>{0.240140617f, 0.353364378f},
-std::array<float,2>{0.778773367f, 0.713098764f},
-std::array<float,2>{0.453386664f, 0.898686767f},
-std::array<float,2>{0.59984535f, 0.23969698f},
-std::array<float,2>{0.386840969f, 0.39354071f},
-std::array<float,2>{0.556821704f, 0.523097932f},
-std::array<float,2>{0.158709958f, 0.80453217f},
-std::array<float,2>{0.817744493f, 0.0275298394f},
-std::array<float,2>{0.096876733f, 0.178494915f},
-std::array<float,2>{0.956878841f, 0.939222217f},
-std::array<float,2>{0.313289344f, 0.685778022f},
-std::array<float,2>{0.685789764f, 0.256297857f},
-std::array<float,2>{0.254859686f, 0.243060321f},
-std::array<float,2>{0.741431892f, 0.892535985f},
-std::array<float,2>{0.0250141565f, 0.704459012f},
-std::array<float,2>{0.925366402f, 0.349027067f},
-std::array<float,2>{0.197458997f, 0.482021511f},
-std::array<float,2>{0.80188632f, 0.618522048f},
-std::array<float,2>{0.476244986f, 0.864691019f},
-std::array<float,2>{0.57662636f, 0.0718233883f},
-std::array<float,2>{0.425917804f, 0.258357733f},
-std::array<float,2>{0.521468461f, 0.674417138f},
-std::array<float,2>{0.141659275f, 0.946342528f},
-std::array<float,2>{0.849521697f, 0.184605017f},
-std::array<float,2>{0.0908154622f, 0.0199037865f},
-std::array<float,2>{0.975818217f, 0.805000544f},
-std::array<float,2>{0.3607153f, 0.525071323f},
-std::array<float,2>{0.639659405f, 0.404370874f},
-std::array<float,2>{0.463329911f, 0.11923454f},
-std::array<float,2>{0.606559873f, 0.836624563f},
-std::array<float,2>{0.242276892f, 0.587655783f},
-std::array<float,2>{0.766474783f, 0.456215024f},
-std::array<float,2>{0.0601794533f, 0.316150278f},
-std::array<float,2>{0.876854002f, 0.749046862f},
-std::array<float,2>{0.309467435f, 0.909491062f},
-std::array<float,2>{0.711768448f, 0.218600422f},
-std::array<float,2>{0.327026933f, 0.420494646f},
-std::array<float,2>{0.673095524f, 0.532185793f},
-std::array<float,2>{0.104666509f, 0.75491035f},
-std::array<float,2>{0.961203516f, 0.060442172f},
-std::array<float,2>{0.164304301f, 0.136307716f},
-std::array<float,2>{0.82369715f, 0.999468446f},
-std::array<float,2>{0.382263571f, 0.6395576f},
-std::array<float,2>{0.553043842f, 0.291592479f},
-std::array<float,2>{0.40043807f, 0.169973701f},
-std::array<float,2>{0.540237546f, 0.966582596f},
-std::array<float,2>{0.183937535f, 0.664541185f},
-std::array<float,2>{0.839624465f, 0.274427444f},
-std::array<float,2>{0.109677628f, 0.37945652f},
-std::array<float,2>{0.948000193f, 0.509863198f},
-std::array<float,2>{0.335868329f, 0.790022731f},
-std::array<float,2>{0.657472968f, 0.00960396789f},
-std::array<float,2>{0.294274181f, 0.374988496f},
-std::array<float,2>{0.697693348f, 0.692400634f},
-std::array<float,2>{0.0351684131f, 0.881140769f},
-std::array<float,2>{0.893461347f, 0.234188467f},
-std::array<float,2>{0.231803879f, 0.0804630369f},
-std::array<float,2>{0.76521486f, 0.857906461f},
-std::array<float,2>{0.441964716f, 0.608766079f},
-std::array<float,2>{0.624768317f, 0.48613143f},
-std::array<float,2>{0.348632574f, 0.0372416005f},
-std::array<float,2>{0.654022455f, 0.768367648f},
-std::array<float,2>{0.0756203979f, 0.552823126f},
-std::array<float,2>{0.990263879f, 0.429879248f},
-std::array<float,2>{0.13576068f, 0.301852763f},
-std::array<float,2>{0.873304248f, 0.64795053f},
-std::array<float,2>{0.407297909f, 0.976907849f},
-std::array<float,2>{0.504524708f, 0.144074902f},
-std::array<float,2>{0.491128296f, 0.447854161f},
-std::array<float,2>{0.582175314f, 0.572052777f},
-std::array<float,2>{0.211076915f, 0.824570358f},
-std::array<float,2>{0.787551045f, 0.102668814f},
-std::array<float,2>{0.00229200069f, 0.194384784f},
-std::array<float,2>{0.906501353f, 0.922755182f},
-std::array<float,2>{0.27642414f, 0.722907305f},
-std::array<float,2>{0.722648025f, 0.331189603f},
-std::array<float,2>{0.3639296f, 0.202211708f},
-std::array<float,2>{0.634530962f, 0.936932504f},
-std::array<float,2>{0.0872436762f, 0.733059049f},
-std::array<float,2>{0.969955385f, 0.34076789f},
-std::array<float,2>{0.14555347f, 0.4432019f},
-std::array<float,2>{0.847566068f, 0.566780984f},
-std::array<float,2>{0.425763667f, 0.814815819f},
-std::array<float,2>{0.51616168f, 0.0993762985f},
-std::array<float,2>{0.469050169f, 0.311020732f},
-std::array<float,2>{0.572919369f, 0.649225593f},
-std::array<float,2>{0.202828839f, 0.970376611f},
-std::array<float,2>{0.798161983f, 0.155925959f},
-std::array<float,2>{0.0298200138f, 0.0453203395f},
-std::array<float,2>{0.928797841f, 0.781017125f},
-std::array<float,2>{0.251405656f, 0.554713786f},
-std::array<float,2>{0.738173783f, 0.429093808f},
-std::array<float,2>{0.378253192f, 0.0926109701f},
-std::array<float,2>{0.550601363f, 0.849891365f},
-std::array<float,2>{0.168477982f, 0.594600379f},
-std::array<float,2>{0.824324489f, 0.495209247f},
-std::array<float,2>{0.107701913f, 0.364100605f},
-std::array<float,2>{0.967974126f, 0.697281003f},
-std::array<float,2>{0.322693408f, 0.884124458f},
-std::array<float,2>{0.67836684f, 0.219813421f},
-std::array<float,2>{0.304964364f, 0.387734056f},
-std::array<float,2>{0.7166484f, 0.507383347f},
-std::array<float,2>{0.0567823388f, 0.781875134f},
-std::array<float,2>{0.879099488f, 0.00133137743f},
-std::array<float,2>{0.247852892f, 0.161821336f},
-std::array<float,2>{0.772290885f, 0.960766435f},
-std::array<float,2>{0.466718584f, 0.663584948f},
-std::array<float,2>{0.603622198f, 0.267438471f},
-std::array<float,2>{0.440332562f, 0.132371366f},
-std::array<float,2>{0.620357931f, 0.988849103f},
-std::array<float,2>{0.230121613f, 0.628179371f},
-std::array<float,2>{0.759860992f, 0.284506261f},
-std::array<float,2>{0.0313143097f, 0.409037203f},
-std::array<float,2>{0.894945025f, 0.544916272f},
-std::array<float,2>{0.291534573f, 0.758606791f},
-std::array<float,2>{0.699495137f, 0.0531490557f},
-std::array<float,2>{0.329642534f, 0.320722461f},
-std::array<float,2>{0.661044896f, 0.735195696f},
-std::array<float,2>{0.116315357f, 0.91786164f},
-std::array<float,2>{0.950689912f, 0.209317043f},
-std::array<float,2>{0.181737259f, 0.109951884f},
-std::array<float,2>{0.842077374f, 0.83086884f},
-std::array<float,2>{0.404953212f, 0.579800367f},
-std::array<float,2>{0.543790519f, 0.461190581f},
-std::array<float,2>{0.281212121f, 0.024380628f},
-std::array<float,2>{0.725151658f, 0.799003124f},
-std::array<float,2>{0.00583605142f, 0.518696904f},
-std::array<float,2>{0.913709998f, 0.396054775f},
-std::array<float,2>{0.216708347f, 0.251875103f},
-std::array<float,2>{0.782015085f, 0.680351436f},
-std::array<float,2>{0.485300303f, 0.943361044f},
-std::array<float,2>{0.58155489f, 0.173599735f},
-std::array<float,2>{0.412577391f, 0.474129945f},
-std::array<float,2>{0.503265142f, 0.613889754f},
-std::array<float,2>{0.139590785f, 0.867957354f},
-std::array<float,2>{0.868378162f, 0.0634700581f},
-std::array<float,2>{0.0726988092f, 0.234582469f},
-std::array<float,2>{0.986348212f, 0.904487908f},
-std::array<float,2>{0.34559533f, 0.715361536f},
-std::array<float,2>{0.648960352f, 0.358880103f},
-std::array<float,2>{0.288913488f, 0.18161118f},
-std::array<float,2>{0.689200044f, 0.952688634f},
-std::array<float,2>{0.0458093435f, 0.676984966f},
-std::array<float,2>{0.902568936f, 0.265448898f},
-std::array<float,2>{0.220040381f, 0.400495648f},
-std::array<float,2>{0.75728333f, 0.52888912f},
-std::array<float,2>{0.449701101f, 0.809552073f},
-std::array<float,2>{0.615090728f, 0.015731588f},
-std::array<float,2>{0.391570985f, 0.346541673f},
-std::array<float,2>{0.536861658f, 0.70802021f},
-std::array<float,2>{0.17192927f, 0.897267699f},
-std::array<float,2>{0.834524393f, 0.24747391f},
-std::array<float,2>{0.121478543f, 0.0776298344f},
-std::array<float,2>{0.941132188f, 0.862214446f},
-std::array<float,2>{0.343562305f, 0.623320639f},
-std::array<float,2>{0.671620667f, 0.479423106f},
-std::array<float,2>{0.496281624f, 0.0551404133f},
-std::array<float,2>{0.592802405f, 0.752572358f},
-std::array<float,2>{0.209884495f, 0.537204325f},
-std::array<float,2>{0.792223573f, 0.41790694f},
-std::array<float,2>{0.0127414111f, 0.293997407f},
-std::array<float,2>{0.916385353f, 0.634783924f},
-std::array<float,2>{0.268881232f, 0.993845761f},
-std::array<float,2>{0.726896942f, 0.1404991f},
-std::array<float,2>{0.355288923f, 0.457656235f},
-std::array<float,2>{0.641628921f, 0.59109962f},
-std::array<float,2>{0.0672856346f, 0.843305171f},
-std::array<float,2>{0.993322372f, 0.121894181f},
-std::array<float,2>{0.129610822f, 0.211089268f},
-std::array<float,2>{0.860060811f, 0.911770284f},
-std::array<float,2>{0.417182684f, 0.742833614f},
-std::array<float,2>{0.512095571f, 0.317651629f},
-std::array<float,2>{0.43070361f, 0.228733525f},
-std::array<float,2>{0.525701642f, 0.878117681f},
-std::array<float,2>{0.152124196f, 0.687856436f},
-std::array<float,2>{0.857681692f, 0.370173216f},
-std::array<float,2>{0.0796530321f, 0.489327729f},
-std::array<float,2>{0.981879592f, 0.60248524f},
-std::array<float,2>{0.373356104f, 0.853561759f},
-std::array<float,2>{0.62842977f, 0.0841159895f},
-std::array<float,2>{0.2634978f, 0.279541582f},
-std::array<float,2>{0.748336434f, 0.669946551f},
-std::array<float,2>{0.0191319417f, 0.9636271f},
-std::array<float,2>{0.937319994f, 0.166487798f},
-std::array<float,2>{0.192416951f, 0.0146271084f},
-std::array<float,2>{0.809445024f, 0.796334565f},
-std::array<float,2>{0.478699684f, 0.515152514f},
-std::array<float,2>{0.5632357f, 0.378020167f},
-std::array<float,2>{0.319501996f, 0.107234038f},
-std::array<float,2>{0.682490706f, 0.821584761f},
-std::array<float,2>{0.0993637145f, 0.577205896f},
-std::array<float,2>{0.958648264f, 0.452314168f},
-std::array<float,2>{0.16373387f, 0.333783895f},
-std::array<float,2>{0.814223588f, 0.71922183f},
-std::array<float,2>{0.383147389f, 0.926192164f},
-std::array<float,2>{0.558782518f, 0.190039679f},
-std::array<float,2>{0.457616657f, 0.435979098f},
-std::array<float,2>{0.595139682f, 0.548481941f},
-std::array<float,2>{0.238113329f, 0.771361887f},
-std::array<float,2>{0.776294887f, 0.034914203f},
-std::array<float,2>{0.0479446426f, 0.147739485f},
-std::array<float,2>{0.888367772f, 0.981286347f},
-std::array<float,2>{0.300938547f, 0.643095076f},
-std::array<float,2>{0.705349445f, 0.299408019f},
-std::array<float,2>{0.314325482f, 0.177164257f},
-std::array<float,2>{0.687366426f, 0.939694524f},
-std::array<float,2>{0.0964118987f, 0.684996247f},
-std::array<float,2>{0.955540895f, 0.255084068f},
-std::array<float,2>{0.159766138f, 0.391374409f},
-std::array<float,2>{0.81693089f, 0.519623876f},
-std::array<float,2>{0.388567001f, 0.80107069f},
-std::array<float,2>{0.557987571f, 0.0300729182f},
-std::array<float,2>{0.454497635f, 0.354678482f},
-std::array<float,2>{0.600996614f, 0.711681783f},
-std::array<float,2>{0.23875162f, 0.90048939f},
-std::array<float,2>{0.778051317f, 0.240713343f},
-std::array<float,2>{0.0532908738f, 0.0684615374f},
-std::array<float,2>{0.882891834f, 0.874774873f},
-std::array<float,2>{0.298292816f, 0.613220751f},
-std::array<float,2>{0.708634377f, 0.472298712f},
-std::array<float,2>{0.435515553f, 0.047457058f},
-std::array<float,2>{0.52900511f, 0.764184833f},
-std::array<float,2>{0.15335229f, 0.540262103f},
-std::array<float,2>{0.85506314f, 0.410351813f},
-std::array<float,2>{0.0829798505f, 0.285891324f},
-std::array<float,2>{0.978169978f, 0.629007518f},
-std::array<float,2>{0.368314236f, 0.985409141f},
-std::array<float,2>{0.631452918f, 0.127179369f},
-std::array<float,2>{0.259648472f, 0.46550262f},
-std::array<float,2>{0.742200077f, 0.582702994f},
-std::array<float,2>{0.0221339948f, 0.83495152f},
-std::array<float,2>{0.929810584f, 0.117135413f},
-std::array<float,2>{0.187510327f, 0.203949466f},
-std::array<float,2>{0.805701911f, 0.919292688f},
-std::array<float,2>{0.482217431f, 0.741812348f},
-std::array<float,2>{0.567237377f, 0.327094555f},
-std::array<float,2>{0.495943308f, 0.225847825f},
-std::array<float,2>{0.588780463f, 0.887341499f},
-std::array<float,2>{0.205983683f, 0.699799776f},
-std::array<float,2>{0.793362081f, 0.361842483f},
-std::array<float,2>{0.00833359081f, 0.497748077f},
-std::array<float,2>{0.921718001f, 0.598238409f},
-std::array<float,2>{0.273170024f, 0.846492946f},
-std::array<float,2>{0.733401537f, 0.0866516829f},
-std::array<float,2>{0.355513483f, 0.273186862f},
-std::array<float,2>{0.645193875f, 0.656599879f},
-std::array<float,2>{0.0662688538f, 0.95554769f},
-std::array<float,2>{0.999202788f, 0.159932733f},
-std::array<float,2>{0.125220314f, 0.00393114099f},
-std::array<float,2>{0.866569996f, 0.78573668f},
-std::array<float,2>{0.418019146f, 0.502126813f},
-std::array<float,2>{0.511234224f, 0.384328783f},
-std::array<float,2>{0.284951955f, 0.0973131284f},
-std::array<float,2>{0.694075406f, 0.819966137f},
-std::array<float,2>{0.042137865f, 0.564371645f},
-std::array<float,2>{0.902117848f, 0.437532574f},
-std::array<float,2>{0.225880176f, 0.338460267f},
-std::array<float,2>{0.753328085f, 0.727024972f},
-std::array<float,2>{0.448681623f, 0.930179775f},
-std::array<float,2>{0.609481573f, 0.198260412f},
-std::array<float,2>{0.397961378f, 0.424107939f},
-std::array<float,2>{0.533519506f, 0.561912596f},
-std::array<float,2>{0.176929533f, 0.773722291f},
-std::array<float,2>{0.829936564f, 0.0413230509f},
-std::array<float,2>{0.120595776f, 0.149952784f},
-std::array<float,2>{0.945257127f, 0.97273016f},
-std::array<float,2>{0.337847412f, 0.6547001f},
-std::array<float,2>{0.665997744f, 0.305206329f},
-std::array<float,2>{0.275880933f, 0.192414999f},
-std::array<float,2>{0.721456289f, 0.923836112f},
-std::array<float,2>{0.00314321578f, 0.725001335f},
-std::array<float,2>{0.907738328f, 0.33004716f},
-std::array<float,2>{0.212240204f, 0.4461959f},
-std::array<float,2>{0.788967252f, 0.572776914f},
-std::array<float,2>{0.492102146f, 0.826359808f},
-std::array<float,2>{0.583259702f, 0.105193235f},
-std::array<float,2>{0.406457603f, 0.30316934f},
-std::array<float,2>{0.505180418f, 0.64624238f},
-std::array<float,2>{0.135658652f, 0.978861272f},
-std::array<float,2>{0.874655664f, 0.140995219f},
-std::array<float,2>{0.0750300288f, 0.0369827934f},
-std::array<float,2>{0.991922736f, 0.765841961f},
-std::array<float,2>{0.3493478f, 0.551587999f},
-std::array<float,2>{0.65262711f, 0.4329817f},
-std::array<float,2>{0.442611456f, 0.0788577422f},
-std::array<float,2>{0.623372495f, 0.855959594f},
-std::array<float,2>{0.230710715f, 0.607310414f},
-std::array<float,2>{0.764394462f, 0.488123864f},
-std::array<float,2>{0.0365175046f, 0.372934461f},
-std::array<float,2>{0.894456625f, 0.695298731f},
-std::array<float,2>{0.293936431f, 0.879965603f},
-std::array<float,2>{0.699110329f, 0.231804863f},
-std::array<float,2>{0.334553182f, 0.381295234f},
-std::array<float,2>{0.656627119f, 0.509059787f},
-std::array<float,2>{0.110680416f, 0.791501641f},
-std::array<float,2>{0.948755085f, 0.00991902873f},
-std::array<float,2>{0.185028881f, 0.169245735f},
-std::array<float,2>{0.838349819f, 0.967670262f},
-std::array<float,2>{0.402063698f, 0.667322934f},
-std::array<float,2>{0.539384723f, 0.275665462f},
-std::array<float,2>{0.38161701f, 0.133635774f},
-std::array<float,2>{0.55394268f, 0.997760117f},
-std::array<float,2>{0.165891469f, 0.6376248f},
-std::array<float,2>{0.823070288f, 0.290779352f},
-std::array<float,2>{0.104248062f, 0.419693649f},
-std::array<float,2>{0.962801099f, 0.534666598f},
-std::array<float,2>{0.328026056f, 0.756374598f},
-std::array<float,2>{0.672478497f, 0.0610801391f},
-std::array<float,2>{0.31044969f, 0.313244343f},
-std::array<float,2>{0.712789416f, 0.746844888f},
-std::array<float,2>{0.0590599701f, 0.907097995f},
-std::array<float,2>{0.875686228f, 0.215902805f},
-std::array<float,2>{0.243483499f, 0.118137829f},
-std::array<float,2>{0.767318666f, 0.839351654f},
-std::array<float,2>{0.464293391f, 0.58858335f},
-std::array<float,2>{0.606321752f, 0.454926431f},
-std::array<float,2>{0.3596026f, 0.0226844624f},
-std::array<float,2>{0.638793766f, 0.807805121f},
-std::array<float,2>{0.0913989842f, 0.525555134f},
-std::array<float,2>{0.975284994f, 0.40280053f},
-std::array<float,2>{0.14078787f, 0.261213362f},
-std::array<float,2>{0.847809672f, 0.67324996f},
-std::array<float,2>{0.427126229f, 0.94890976f},
-std::array<float,2>{0.519549072f, 0.187237844f},
-std::array<float,2>{0.474952877f, 0.482567966f},
-std::array<float,2>{0.577234209f, 0.620153666f},
-std::array<float,2>{0.198650226f, 0.866790354f},
-std::array<float,2>{0.801643968f, 0.0737138018f},
-std::array<float,2>{0.0242145192f, 0.244922474f},
-std::array<float,2>{0.924305201f, 0.894052804f},
-std::array<float,2>{0.255400956f, 0.707016468f},
-std::array<float,2>{0.740246654f, 0.349614322f},
-std::array<float,2>{0.344634801f, 0.237748846f},
-std::array<float,2>{0.650325119f, 0.90329957f},
-std::array<float,2>{0.0737071633f, 0.717502654f},
-std::array<float,2>{0.987743676f, 0.355572313f},
-std::array<float,2>{0.139706925f, 0.475203186f},
-std::array<float,2>{0.868154824f, 0.6158005f},
-std::array<float,2>{0.4131473f, 0.870979369f},
-std::array<float,2>{0.502479255f, 0.064472571f},
-std::array<float,2>{0.486021966f, 0.25207296f},
-std::array<float,2>{0.58029002f, 0.683489919f},
-std::array<float,2>{0.215114892f, 0.941500366f},
-std::array<float,2>{0.782988727f, 0.175004885f},
-std::array<float,2>{0.00416061981f, 0.0273412243f},
-std::array<float,2>{0.912831068f, 0.79729712f},
-std::array<float,2>{0.279714674f, 0.517240703f},
-std::array<float,2>{0.726043284f, 0.398048252f},
-std::array<float,2>{0.405553162f, 0.111507758f},
-std::array<float,2>{0.544754624f, 0.829109609f},
-std::array<float,2>{0.183469534f, 0.580979407f},
-std::array<float,2>{0.842849612f, 0.464520007f},
-std::array<float,2>{0.115377083f, 0.323897183f},
-std::array<float,2>{0.950113654f, 0.738116682f},
-std::array<float,2>{0.328284323f, 0.91566813f},
-std::array<float,2>{0.661680758f, 0.208983839f},
-std::array<float,2>{0.292054921f, 0.4070355f},
-std::array<float,2>{0.700851798f, 0.546254516f},
-std::array<float,2>{0.0323424488f, 0.76063168f},
-std::array<float,2>{0.896098316f, 0.0521267056f},
-std::array<float,2>{0.229107901f, 0.130317971f},
-std::array<float,2>{0.76168263f, 0.991411746f},
-std::array<float,2>{0.440584958f, 0.625078559f},
-std::array<float,2>{0.619890749f, 0.282907993f},
-std::array<float,2>{0.465089917f, 0.163796097f},
-std::array<float,2>{0.604534626f, 0.957975864f},
-std::array<float,2>{0.246528044f, 0.66174233f},
-std::array<float,2>{0.772547901f, 0.269289762f},
-std::array<float,2>{0.0580949858f, 0.390467763f},
-std::array<float,2>{0.88081038f, 0.505354345f},
-std::array<float,2>{0.306037992f, 0.784644365f},
-std::array<float,2>{0.715743601f, 0.00354105164f},
-std::array<float,2>{0.323705286f, 0.366062731f},
-std::array<float,2>{0.679523826f, 0.696346283f},
-std::array<float,2>{0.109334797f, 0.88621521f},
-std::array<float,2>{0.967020869f, 0.220804766f},
-std::array<float,2>{0.169621646f, 0.0902478397f},
-std::array<float,2>{0.825445235f, 0.848750353f},
-std::array<float,2>{0.377492219f, 0.596922696f},
-std::array<float,2>{0.549172521f, 0.492952913f},
-std::array<float,2>{0.250149786f, 0.0448047332f},
-std::array<float,2>{0.736904562f, 0.778504074f},
-std::array<float,2>{0.0303544421f, 0.558381081f},
-std::array<float,2>{0.928234935f, 0.426436901f},
-std::array<float,2>{0.201762825f, 0.309834003f},
-std::array<float,2>{0.797389686f, 0.650874138f},
-std::array<float,2>{0.469998121f, 0.971632361f},
-std::array<float,2>{0.573591769f, 0.154140443f},
-std::array<float,2>{0.423834294f, 0.443976104f},
-std::array<float,2>{0.517367899f, 0.570247412f},
-std::array<float,2>{0.1451426f, 0.81395185f},
-std::array<float,2>{0.846331179f, 0.0996270701f},
-std::array<float,2>{0.0860512927f, 0.199957341f},
-std::array<float,2>{0.969109476f, 0.934671223f},
-std::array<float,2>{0.364697427f, 0.731338143f},
-std::array<float,2>{0.633408666f, 0.343511283f},
-std::array<float,2>{0.302195191f, 0.144616053f},
-std::array<float,2>{0.706688285f, 0.98345238f},
-std::array<float,2>{0.047374703f, 0.641452968f},
-std::array<float,2>{0.887608171f, 0.298671305f},
-std::array<float,2>{0.237299472f, 0.434191525f},
-std::array<float,2>{0.776747286f, 0.550092638f},
-std::array<float,2>{0.458827347f, 0.772225022f},
-std::array<float,2>{0.594034255f, 0.0325035118f},
-std::array<float,2>{0.383999258f, 0.333987027f},
-std::array<float,2>{0.560156763f, 0.721027374f},
-std::array<float,2>{0.162230417f, 0.929534614f},
-std::array<float,2>{0.812802076f, 0.187986627f},
-std::array<float,2>{0.0983055979f, 0.108410202f},
-std::array<float,2>{0.957957447f, 0.824068487f},
-std::array<float,2>{0.318981469f, 0.57441169f},
-std::array<float,2>{0.683592737f, 0.45114249f},
-std::array<float,2>{0.480061024f, 0.0136161223f},
-std::array<float,2>{0.564452589f, 0.79367739f},
-std::array<float,2>{0.191783398f, 0.511807978f},
-std::array<float,2>{0.81007272f, 0.375569791f},
-std::array<float,2>{0.0178861953f, 0.279202849f},
-std::array<float,2>{0.935740113f, 0.66836375f},
-std::array<float,2>{0.262482017f, 0.962158322f},
-std::array<float,2>{0.749756575f, 0.164985493f},
-std::array<float,2>{0.374697179f, 0.490940928f},
-std::array<float,2>{0.627834022f, 0.605335534f},
-std::array<float,2>{0.0787597001f, 0.852529645f},
-std::array<float,2>{0.980865955f, 0.0831527486f},
-std::array<float,2>{0.150525436f, 0.228391632f},
-std::array<float,2>{0.859031975f, 0.876842856f},
-std::array<float,2>{0.430281699f, 0.689672053f},
-std::array<float,2>{0.526466668f, 0.367789626f},
-std::array<float,2>{0.416512758f, 0.214681461f},
-std::array<float,2>{0.512949169f, 0.912148833f},
-std::array<float,2>{0.130244493f, 0.744314671f},
-std::array<float,2>{0.86053443f, 0.318950027f},
-std::array<float,2>{0.0678516328f, 0.459687889f},
-std::array<float,2>{0.992487729f, 0.593263745f},
-std::array<float,2>{0.353638411f, 0.839981437f},
-std::array<float,2>{0.640909135f, 0.124014594f},
-std::array<float,2>{0.268137336f, 0.295564741f},
-std::array<float,2>{0.727813542f, 0.634698629f},
-std::array<float,2>{0.0119200842f, 0.995798528f},
-std::array<float,2>{0.917776525f, 0.138575494f},
-std::array<float,2>{0.210368857f, 0.0575809553f},
-std::array<float,2>{0.791704774f, 0.751362681f},
-std::array<float,2>{0.497187287f, 0.537105381f},
-std::array<float,2>{0.592422247f, 0.414729387f},
-std::array<float,2>{0.34224388f, 0.0743329376f},
-std::array<float,2>{0.670738637f, 0.860639989f},
-std::array<float,2>{0.122376241f, 0.622229218f},
-std::array<float,2>{0.940140128f, 0.478168398f},
-std::array<float,2>{0.173445642f, 0.345121861f},
-std::array<float,2>{0.835827231f, 0.709451914f},
-std::array<float,2>{0.391810983f, 0.895959854f},
-std::array<float,2>{0.535813749f, 0.249925762f},
-std::array<float,2>{0.451127946f, 0.399227172f},
-std::array<float,2>{0.613687813f, 0.529836833f},
-std::array<float,2>{0.219183579f, 0.811820865f},
-std::array<float,2>{0.75637275f, 0.0189184677f},
-std::array<float,2>{0.0464993455f, 0.182311922f},
-std::array<float,2>{0.903748572f, 0.949611485f},
-std::array<float,2>{0.287878245f, 0.678697765f},
-std::array<float,2>{0.687800229f, 0.261853009f},
-std::array<float,2>{0.36950469f, 0.126243427f},
-std::array<float,2>{0.630032361f, 0.987697065f},
-std::array<float,2>{0.0842369497f, 0.631917179f},
-std::array<float,2>{0.98016727f, 0.287926197f},
-std::array<float,2>{0.155668691f, 0.412187874f},
-std::array<float,2>{0.852245569f, 0.542036533f},
-std::array<float,2>{0.43567729f, 0.762003183f},
-std::array<float,2>{0.530572772f, 0.0496783443f},
-std::array<float,2>{0.482455671f, 0.324697167f},
-std::array<float,2>{0.570131242f, 0.739409328f},
-std::array<float,2>{0.189882576f, 0.92180866f},
-std::array<float,2>{0.807207763f, 0.205851465f},
-std::array<float,2>{0.0199819449f, 0.114445515f},
-std::array<float,2>{0.932363629f, 0.832396209f},
-std::array<float,2>{0.259766459f, 0.585691631f},
-std::array<float,2>{0.745342731f, 0.468166322f},
-std::array<float,2>{0.389424831f, 0.0288632736f},
-std::array<float,2>{0.55619818f, 0.802930892f},
-std::array<float,2>{0.156275585f, 0.522081435f},
-std::array<float,2>{0.818375945f, 0.393745691f},
-std::array<float,2>{0.0944468603f, 0.257067114f},
-std::array<float,2>{0.95342952f, 0.68658185f},
-std::array<float,2>{0.314987391f, 0.938180864f},
-std::array<float,2>{0.685508609f, 0.178954974f},
-std::array<float,2>{0.299578637f, 0.469542891f},
-std::array<float,2>{0.710581601f, 0.611294448f},
-std::array<float,2>{0.052339267f, 0.872425139f},
-std::array<float,2>{0.885196924f, 0.0677277669f},
-std::array<float,2>{0.241669595f, 0.23879917f},
-std::array<float,2>{0.779580951f, 0.900009751f},
-std::array<float,2>{0.455893874f, 0.714223564f},
-std::array<float,2>{0.598700762f, 0.351614028f},
-std::array<float,2>{0.447003126f, 0.196058691f},
-std::array<float,2>{0.613179564f, 0.932762802f},
-std::array<float,2>{0.224468768f, 0.728661239f},
-std::array<float,2>{0.751303136f, 0.335999429f},
-std::array<float,2>{0.040964257f, 0.440007806f},
-std::array<float,2>{0.899698675f, 0.566335738f},
-std::array<float,2>{0.281509578f, 0.817199945f},
-std::array<float,2>{0.691921175f, 0.0954003707f},
-std::array<float,2>{0.338039666f, 0.307774603f},
-std::array<float,2>{0.666315556f, 0.653494358f},
-std::array<float,2>{0.117308758f, 0.975364089f},
-std::array<float,2>{0.942413747f, 0.150613993f},
-std::array<float,2>{0.178274065f, 0.0405109152f},
-std::array<float,2>{0.831192613f, 0.775637031f},
-std::array<float,2>{0.396376014f, 0.560021102f},
-std::array<float,2>{0.531413078f, 0.422472775f},
-std::array<float,2>{0.270876437f, 0.0894539431f},
-std::array<float,2>{0.732031882f, 0.84462589f},
-std::array<float,2>{0.0113171302f, 0.600709558f},
-std::array<float,2>{0.919781268f, 0.498365611f},
-std::array<float,2>{0.203525886f, 0.361141086f},
-std::array<float,2>{0.795093119f, 0.701922297f},
-std::array<float,2>{0.492905945f, 0.889932513f},
-std::array<float,2>{0.587422729f, 0.223174453f},
-std::array<float,2>{0.42026335f, 0.385291606f},
-std::array<float,2>{0.509405315f, 0.501544118f},
-std::array<float,2>{0.127561018f, 0.788531363f},
-std::array<float,2>{0.864829004f, 0.00769001432f},
-std::array<float,2>{0.0628985688f, 0.156702682f},
-std::array<float,2>{0.997210562f, 0.954708636f},
-std::array<float,2>{0.358223379f, 0.659664512f},
-std::array<float,2>{0.647638679f, 0.271264791f},
-std::array<float,2>{0.29492721f, 0.232914969f},
-std::array<float,2>{0.696832299f, 0.882495522f},
-std::array<float,2>{0.0378988348f, 0.691470265f},
-std::array<float,2>{0.891234934f, 0.373118818f},
-std::array<float,2>{0.232538268f, 0.485085458f},
-std::array<float,2>{0.763349235f, 0.608307004f},
-std::array<float,2>{0.444314033f, 0.858624995f},
-std::array<float,2>{0.621505082f, 0.0817713067f},
-std::array<float,2>{0.399088323f, 0.273536533f},
-std::array<float,2>{0.541659236f, 0.665208101f},
-std::array<float,2>{0.187153414f, 0.965601623f},
-std::array<float,2>{0.836127162f, 0.171071962f},
-std::array<float,2>{0.111716539f, 0.0084087979f},
-std::array<float,2>{0.94560492f, 0.790748954f},
-std::array<float,2>{0.332551897f, 0.51169461f},
-std::array<float,2>{0.659583747f, 0.380599767f},
-std::array<float,2>{0.489706546f, 0.101781555f},
-std::array<float,2>{0.585615993f, 0.825881958f},
-std::array<float,2>{0.213444501f, 0.570561528f},
-std::array<float,2>{0.78645891f, 0.448573947f},
-std::array<float,2>{0.000493062777f, 0.330225766f},
-std::array<float,2>{0.909124196f, 0.724561751f},
-std::array<float,2>{0.274886668f, 0.923810184f},
-std::array<float,2>{0.720490158f, 0.19416295f},
-std::array<float,2>{0.351214558f, 0.430751681f},
-std::array<float,2>{0.656108439f, 0.554104626f},
-std::array<float,2>{0.0771238804f, 0.76936233f},
-std::array<float,2>{0.988467515f, 0.0386941917f},
-std::array<float,2>{0.133634642f, 0.142673209f},
-std::array<float,2>{0.872667015f, 0.978161156f},
-std::array<float,2>{0.408499539f, 0.646929204f},
-std::array<float,2>{0.507658541f, 0.300926805f},
-std::array<float,2>{0.428341985f, 0.184547618f},
-std::array<float,2>{0.523193479f, 0.945393503f},
-std::array<float,2>{0.144248366f, 0.67489624f},
-std::array<float,2>{0.850350082f, 0.259483695f},
-std::array<float,2>{0.0925710946f, 0.405716449f},
-std::array<float,2>{0.973623514f, 0.523732781f},
-std::array<float,2>{0.362489551f, 0.805956841f},
-std::array<float,2>{0.637084484f, 0.0214265194f},
-std::array<float,2>{0.256165177f, 0.348543227f},
-std::array<float,2>{0.739831686f, 0.703310549f},
-std::array<float,2>{0.0260055512f, 0.890985072f},
-std::array<float,2>{0.921982586f, 0.244017422f},
-std::array<float,2>{0.196351424f, 0.0706101954f},
-std::array<float,2>{0.803160191f, 0.864027619f},
-std::array<float,2>{0.47370103f, 0.617567897f},
-std::array<float,2>{0.574579954f, 0.480964482f},
-std::array<float,2>{0.324412763f, 0.0587000996f},
-std::array<float,2>{0.675087929f, 0.754078388f},
-std::array<float,2>{0.103152432f, 0.532960176f},
-std::array<float,2>{0.964612544f, 0.421358973f},
-std::array<float,2>{0.166307122f, 0.292262644f},
-std::array<float,2>{0.821767807f, 0.640220463f},
-std::array<float,2>{0.379775643f, 0.998609424f},
-std::array<float,2>{0.551400542f, 0.13520883f},
-std::array<float,2>{0.461090177f, 0.45542255f},
-std::array<float,2>{0.607583582f, 0.586213171f},
-std::array<float,2>{0.245074049f, 0.837753415f},
-std::array<float,2>{0.767665565f, 0.120356418f},
-std::array<float,2>{0.061776422f, 0.217457891f},
-std::array<float,2>{0.878419459f, 0.908489645f},
-std::array<float,2>{0.312168747f, 0.748815656f},
-std::array<float,2>{0.713315248f, 0.314649343f},
-std::array<float,2>{0.33107841f, 0.210111469f},
-std::array<float,2>{0.662427187f, 0.916895866f},
-std::array<float,2>{0.114020996f, 0.736208141f},
-std::array<float,2>{0.952004552f, 0.321906358f},
-std::array<float,2>{0.181138486f, 0.462179303f},
-std::array<float,2>{0.841184318f, 0.578509927f},
-std::array<float,2>{0.403524339f, 0.831142187f},
-std::array<float,2>{0.546861947f, 0.110783093f},
-std::array<float,2>{0.438963413f, 0.283361465f},
-std::array<float,2>{0.618588686f, 0.62738657f},
-std::array<float,2>{0.226858705f, 0.989527822f},
-std::array<float,2>{0.759456217f, 0.131403565f},
-std::array<float,2>{0.0332542844f, 0.0539803915f},
-std::array<float,2>{0.896971464f, 0.759193718f},
-std::array<float,2>{0.290119559f, 0.54371953f},
-std::array<float,2>{0.703106105f, 0.410094202f},
-std::array<float,2>{0.410529524f, 0.063796401f},
-std::array<float,2>{0.500083268f, 0.868349254f},
-std::array<float,2>{0.138131216f, 0.614974439f},
-std::array<float,2>{0.86976856f, 0.473298937f},
-std::array<float,2>{0.070692122f, 0.357598454f},
-std::array<float,2>{0.984904885f, 0.716384888f},
-std::array<float,2>{0.347156197f, 0.905758202f},
-std::array<float,2>{0.651073992f, 0.236241087f},
-std::array<float,2>{0.277438521f, 0.395114332f},
-std::array<float,2>{0.724281192f, 0.517605901f},
-std::array<float,2>{0.00589688309f, 0.80046922f},
-std::array<float,2>{0.911855042f, 0.0253051668f},
-std::array<float,2>{0.217361078f, 0.172812641f},
-std::array<float,2>{0.785140693f, 0.944583356f},
-std::array<float,2>{0.486487985f, 0.681252658f},
-std::array<float,2>{0.578803003f, 0.250125438f},
-std::array<float,2>{0.470828593f, 0.155139029f},
-std::array<float,2>{0.572245479f, 0.969337761f},
-std::array<float,2>{0.200628087f, 0.65031302f},
-std::array<float,2>{0.798880935f, 0.312168598f},
-std::array<float,2>{0.0282702707f, 0.427852988f},
-std::array<float,2>{0.927298665f, 0.555981517f},
-std::array<float,2>{0.25271827f, 0.77979666f},
-std::array<float,2>{0.73544687f, 0.0462508276f},
-std::array<float,2>{0.366081983f, 0.341699481f},
-std::array<float,2>{0.63498646f, 0.734113574f},
-std::array<float,2>{0.088419266f, 0.936345041f},
-std::array<float,2>{0.971537948f, 0.201476723f},
-std::array<float,2>{0.146492735f, 0.0984180272f},
-std::array<float,2>{0.845336795f, 0.816188693f},
-std::array<float,2>{0.422729224f, 0.567954242f},
-std::array<float,2>{0.519443154f, 0.441796541f},
-std::array<float,2>{0.307503045f, 9.73300266e-05f},
-std::array<float,2>{0.717344224f, 0.782980025f},
-std::array<float,2>{0.0556001849f, 0.505873322f},
-std::array<float,2>{0.881825566f, 0.387145638f},
-std::array<float,2>{0.249677852f, 0.266022891f},
-std::array<float,2>{0.771414936f, 0.662876904f},
-std::array<float,2>{0.467762947f, 0.959495246f},
-std::array<float,2>{0.602915406f, 0.161069542f},
-std::array<float,2>{0.375426173f, 0.494894534f},
-std::array<float,2>{0.54729706f, 0.595404208f},
-std::array<float,2>{0.171786413f, 0.850976825f},
-std::array<float,2>{0.827506721f, 0.0928049237f},
-std::array<float,2>{0.106964946f, 0.218797073f},
-std::array<float,2>{0.966057479f, 0.88354975f},
-std::array<float,2>{0.320845753f, 0.698562622f},
-std::array<float,2>{0.677421987f, 0.364764035f},
-std::array<float,2>{0.263958335f, 0.167879447f},
-std::array<float,2>{0.746537685f, 0.964750886f},
-std::array<float,2>{0.0170152579f, 0.671497822f},
-std::array<float,2>{0.935490072f, 0.280679733f},
-std::array<float,2>{0.194512635f, 0.377530098f},
-std::array<float,2>{0.810970545f, 0.514291525f},
-std::array<float,2>{0.477288544f, 0.795057535f},
-std::array<float,2>{0.56500864f, 0.0152946552f},
-std::array<float,2>{0.431745231f, 0.369555622f},
-std::array<float,2>{0.525324106f, 0.68917495f},
-std::array<float,2>{0.149598017f, 0.877449393f},
-std::array<float,2>{0.856747031f, 0.230262101f},
-std::array<float,2>{0.0811755583f, 0.0859328583f},
-std::array<float,2>{0.982520521f, 0.855086386f},
-std::array<float,2>{0.37253809f, 0.603052497f},
-std::array<float,2>{0.626043618f, 0.488620043f},
-std::array<float,2>{0.460254729f, 0.0341769792f},
-std::array<float,2>{0.596745908f, 0.770366192f},
-std::array<float,2>{0.235251054f, 0.547236443f},
-std::array<float,2>{0.773975015f, 0.436552405f},
-std::array<float,2>{0.0493003279f, 0.300647289f},
-std::array<float,2>{0.890278339f, 0.643858671f},
-std::array<float,2>{0.303508162f, 0.982122064f},
-std::array<float,2>{0.704164326f, 0.147277504f},
-std::array<float,2>{0.316459626f, 0.451554f},
-std::array<float,2>{0.680738211f, 0.577083111f},
-std::array<float,2>{0.100963213f, 0.821025491f},
-std::array<float,2>{0.959348917f, 0.105734937f},
-std::array<float,2>{0.161045417f, 0.190899998f},
-std::array<float,2>{0.814712822f, 0.927358985f},
-std::array<float,2>{0.386470258f, 0.720148146f},
-std::array<float,2>{0.560822487f, 0.332769841f},
-std::array<float,2>{0.392913848f, 0.246224806f},
-std::array<float,2>{0.538794994f, 0.897919774f},
-std::array<float,2>{0.174035802f, 0.70779258f},
-std::array<float,2>{0.832278013f, 0.347231477f},
-std::array<float,2>{0.124840587f, 0.48019439f},
-std::array<float,2>{0.938686311f, 0.624387622f},
-std::array<float,2>{0.3401649f, 0.862841427f},
-std::array<float,2>{0.669715464f, 0.0770792887f},
-std::array<float,2>{0.286433011f, 0.263928086f},
-std::array<float,2>{0.68991977f, 0.676368237f},
-std::array<float,2>{0.0433350056f, 0.951854706f},
-std::array<float,2>{0.905290723f, 0.180483058f},
-std::array<float,2>{0.222097099f, 0.0172472466f},
-std::array<float,2>{0.755158961f, 0.810539067f},
-std::array<float,2>{0.451703042f, 0.527478218f},
-std::array<float,2>{0.616782308f, 0.40217191f},
-std::array<float,2>{0.352382809f, 0.122081615f},
-std::array<float,2>{0.643963456f, 0.842352092f},
-std::array<float,2>{0.0693352893f, 0.589866102f},
-std::array<float,2>{0.995565295f, 0.458678007f},
-std::array<float,2>{0.131092384f, 0.31681928f},
-std::array<float,2>{0.861659825f, 0.743667603f},
-std::array<float,2>{0.415611207f, 0.910224378f},
-std::array<float,2>{0.515571892f, 0.212375149f},
-std::array<float,2>{0.499762803f, 0.41696921f},
-std::array<float,2>{0.590494335f, 0.538088024f},
-std::array<float,2>{0.207067117f, 0.753381014f},
-std::array<float,2>{0.790014088f, 0.0565706119f},
-std::array<float,2>{0.0141775198f, 0.139299497f},
-std::array<float,2>{0.915816426f, 0.992541671f},
-std::array<float,2>{0.267140746f, 0.636658847f},
-std::array<float,2>{0.728803575f, 0.293411314f}}
\ No newline at end of file
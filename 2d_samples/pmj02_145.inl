@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.577687025f, 0.379061252f},
-std::array<float,2>{0.377156764f, 0.765437126f},
-std::array<float,2>{0.840422511f, 0.563017309f},
-std::array<float,2>{0.0176091027f, 0.191343203f},
-std::array<float,2>{0.93256247f, 0.0964590237f},
-std::array<float,2>{0.143930271f, 0.678493857f},
-std::array<float,2>{0.70751375f, 0.928728342f},
-std::array<float,2>{0.347115189f, 0.303817689f},
-std::array<float,2>{0.683186471f, 0.172123685f},
-std::array<float,2>{0.283020496f, 0.540719628f},
-std::array<float,2>{0.990193248f, 0.832551122f},
-std::array<float,2>{0.220191076f, 0.44333598f},
-std::array<float,2>{0.779302597f, 0.335265577f},
-std::array<float,2>{0.0792076215f, 0.987092257f},
-std::array<float,2>{0.508281767f, 0.743088424f},
-std::array<float,2>{0.472385913f, 0.0606383346f},
-std::array<float,2>{0.735156119f, 0.256829381f},
-std::array<float,2>{0.335783541f, 0.876212716f},
-std::array<float,2>{0.876648903f, 0.641220629f},
-std::array<float,2>{0.166753367f, 0.093054004f},
-std::array<float,2>{0.847994447f, 0.243117765f},
-std::array<float,2>{0.0538839512f, 0.604666591f},
-std::array<float,2>{0.604753196f, 0.800296605f},
-std::array<float,2>{0.408694595f, 0.415191084f},
-std::array<float,2>{0.53368479f, 0.0267502256f},
-std::array<float,2>{0.455471903f, 0.691104889f},
-std::array<float,2>{0.796711683f, 0.958417416f},
-std::array<float,2>{0.11262469f, 0.359410733f},
-std::array<float,2>{0.952871025f, 0.49758473f},
-std::array<float,2>{0.215629786f, 0.854869545f},
-std::array<float,2>{0.631538332f, 0.503072917f},
-std::array<float,2>{0.277923316f, 0.143047199f},
-std::array<float,2>{0.526551008f, 0.355786443f},
-std::array<float,2>{0.494755417f, 0.947808206f},
-std::array<float,2>{0.764633417f, 0.709001362f},
-std::array<float,2>{0.074517794f, 0.00684018247f},
-std::array<float,2>{0.979479253f, 0.136378452f},
-std::array<float,2>{0.236372516f, 0.521374404f},
-std::array<float,2>{0.668717742f, 0.867806375f},
-std::array<float,2>{0.31059432f, 0.475848138f},
-std::array<float,2>{0.691749036f, 0.0759140328f},
-std::array<float,2>{0.374815136f, 0.631936312f},
-std::array<float,2>{0.91924721f, 0.895612359f},
-std::array<float,2>{0.128052413f, 0.276316375f},
-std::array<float,2>{0.826953351f, 0.428846627f},
-std::array<float,2>{0.00198954646f, 0.783374906f},
-std::array<float,2>{0.585942984f, 0.623745382f},
-std::array<float,2>{0.393890589f, 0.23019205f},
-std::array<float,2>{0.642642736f, 0.458871216f},
-std::array<float,2>{0.265060574f, 0.8163445f},
-std::array<float,2>{0.957047284f, 0.548866868f},
-std::array<float,2>{0.194337875f, 0.165614694f},
-std::array<float,2>{0.807098091f, 0.0348631926f},
-std::array<float,2>{0.0949496329f, 0.721298516f},
-std::array<float,2>{0.548086584f, 0.976978302f},
-std::array<float,2>{0.441423178f, 0.315318108f},
-std::array<float,2>{0.611377835f, 0.217680708f},
-std::array<float,2>{0.431670696f, 0.586781144f},
-std::array<float,2>{0.86961925f, 0.779313684f},
-std::array<float,2>{0.0409939922f, 0.401237845f},
-std::array<float,2>{0.898519754f, 0.285332173f},
-std::array<float,2>{0.185948908f, 0.907435298f},
-std::array<float,2>{0.732076883f, 0.671375811f},
-std::array<float,2>{0.322402626f, 0.116503246f},
-std::array<float,2>{0.561447203f, 0.477301627f},
-std::array<float,2>{0.449388713f, 0.862619758f},
-std::array<float,2>{0.802892387f, 0.529634655f},
-std::array<float,2>{0.102908775f, 0.12782073f},
-std::array<float,2>{0.966104925f, 0.0152239604f},
-std::array<float,2>{0.196265429f, 0.714519918f},
-std::array<float,2>{0.650808513f, 0.940184653f},
-std::array<float,2>{0.252357364f, 0.345443487f},
-std::array<float,2>{0.725757539f, 0.223101839f},
-std::array<float,2>{0.31834957f, 0.609540462f},
-std::array<float,2>{0.895445406f, 0.793013334f},
-std::array<float,2>{0.175677314f, 0.433173895f},
-std::array<float,2>{0.862262845f, 0.271427482f},
-std::array<float,2>{0.0315344296f, 0.901807129f},
-std::array<float,2>{0.620179534f, 0.636171222f},
-std::array<float,2>{0.423110276f, 0.0645468608f},
-std::array<float,2>{0.659419298f, 0.323579222f},
-std::array<float,2>{0.298364282f, 0.972657919f},
-std::array<float,2>{0.969887257f, 0.731310308f},
-std::array<float,2>{0.248358995f, 0.0464564748f},
-std::array<float,2>{0.757058918f, 0.158963591f},
-std::array<float,2>{0.069553107f, 0.556032479f},
-std::array<float,2>{0.519604385f, 0.822677612f},
-std::array<float,2>{0.490485102f, 0.466085404f},
-std::array<float,2>{0.582784951f, 0.123106301f},
-std::array<float,2>{0.402391583f, 0.65963912f},
-std::array<float,2>{0.815439224f, 0.919905424f},
-std::array<float,2>{0.0152014242f, 0.294837385f},
-std::array<float,2>{0.909537613f, 0.396578372f},
-std::array<float,2>{0.132820696f, 0.772500932f},
-std::array<float,2>{0.70294565f, 0.583213091f},
-std::array<float,2>{0.361095726f, 0.208928034f},
-std::array<float,2>{0.598022997f, 0.305232674f},
-std::array<float,2>{0.415077955f, 0.93653667f},
-std::array<float,2>{0.852362096f, 0.68068409f},
-std::array<float,2>{0.0605253167f, 0.106206894f},
-std::array<float,2>{0.883736253f, 0.196060762f},
-std::array<float,2>{0.159967288f, 0.571157694f},
-std::array<float,2>{0.745292425f, 0.753454626f},
-std::array<float,2>{0.342984796f, 0.383071154f},
-std::array<float,2>{0.6397053f, 0.0525046401f},
-std::array<float,2>{0.270167112f, 0.735842586f},
-std::array<float,2>{0.939554274f, 0.998933077f},
-std::array<float,2>{0.203890666f, 0.336389363f},
-std::array<float,2>{0.783650875f, 0.449994057f},
-std::array<float,2>{0.122582115f, 0.84254992f},
-std::array<float,2>{0.542421579f, 0.5376333f},
-std::array<float,2>{0.462633699f, 0.179970726f},
-std::array<float,2>{0.714546919f, 0.410567433f},
-std::array<float,2>{0.358688533f, 0.811116338f},
-std::array<float,2>{0.925043523f, 0.600049675f},
-std::array<float,2>{0.152645737f, 0.240830079f},
-std::array<float,2>{0.829839647f, 0.0818967298f},
-std::array<float,2>{0.0306248106f, 0.656035841f},
-std::array<float,2>{0.563189149f, 0.890292168f},
-std::array<float,2>{0.388004839f, 0.262373149f},
-std::array<float,2>{0.503276765f, 0.150923058f},
-std::array<float,2>{0.477018237f, 0.512495458f},
-std::array<float,2>{0.769396305f, 0.844515145f},
-std::array<float,2>{0.0917290598f, 0.487695456f},
-std::array<float,2>{0.992313623f, 0.374157578f},
-std::array<float,2>{0.227009013f, 0.963235319f},
-std::array<float,2>{0.676919222f, 0.695551515f},
-std::array<float,2>{0.294040471f, 0.0158086047f},
-std::array<float,2>{0.62331003f, 0.439141661f},
-std::array<float,2>{0.427784652f, 0.83105576f},
-std::array<float,2>{0.864869297f, 0.544922173f},
-std::array<float,2>{0.0375354849f, 0.178664118f},
-std::array<float,2>{0.890668094f, 0.0581621937f},
-std::array<float,2>{0.17863372f, 0.747476399f},
-std::array<float,2>{0.722379565f, 0.991865993f},
-std::array<float,2>{0.314013571f, 0.331602991f},
-std::array<float,2>{0.653966606f, 0.194860831f},
-std::array<float,2>{0.254431248f, 0.567792058f},
-std::array<float,2>{0.964095473f, 0.758176804f},
-std::array<float,2>{0.200532988f, 0.37593773f},
-std::array<float,2>{0.799926043f, 0.300653607f},
-std::array<float,2>{0.107133195f, 0.924372077f},
-std::array<float,2>{0.557386577f, 0.672752619f},
-std::array<float,2>{0.446951747f, 0.0982398614f},
-std::array<float,2>{0.699124455f, 0.366676748f},
-std::array<float,2>{0.366040021f, 0.953126252f},
-std::array<float,2>{0.913159847f, 0.695059776f},
-std::array<float,2>{0.138419807f, 0.0284972675f},
-std::array<float,2>{0.818973422f, 0.146714315f},
-std::array<float,2>{0.0101368548f, 0.505060375f},
-std::array<float,2>{0.580221891f, 0.859319687f},
-std::array<float,2>{0.400917977f, 0.494519562f},
-std::array<float,2>{0.51884836f, 0.0874654949f},
-std::array<float,2>{0.487947643f, 0.647605419f},
-std::array<float,2>{0.752692699f, 0.879744649f},
-std::array<float,2>{0.0640611276f, 0.250224978f},
-std::array<float,2>{0.974007308f, 0.418491989f},
-std::array<float,2>{0.244405791f, 0.801699579f},
-std::array<float,2>{0.66320473f, 0.609284043f},
-std::array<float,2>{0.302982479f, 0.246706799f},
-std::array<float,2>{0.5453071f, 0.280046433f},
-std::array<float,2>{0.468340576f, 0.893584132f},
-std::array<float,2>{0.786310554f, 0.628523469f},
-std::array<float,2>{0.117605492f, 0.0710915551f},
-std::array<float,2>{0.943213284f, 0.230660737f},
-std::array<float,2>{0.208258256f, 0.617469668f},
-std::array<float,2>{0.633182168f, 0.785556197f},
-std::array<float,2>{0.267178565f, 0.423278511f},
-std::array<float,2>{0.746201217f, 0.00149455236f},
-std::array<float,2>{0.33719486f, 0.705892265f},
-std::array<float,2>{0.890344024f, 0.949903667f},
-std::array<float,2>{0.161272585f, 0.355034024f},
-std::array<float,2>{0.858029604f, 0.469990253f},
-std::array<float,2>{0.0552272722f, 0.874038517f},
-std::array<float,2>{0.596097529f, 0.515909553f},
-std::array<float,2>{0.419420123f, 0.137421072f},
-std::array<float,2>{0.673809469f, 0.403764129f},
-std::array<float,2>{0.290781677f, 0.777143538f},
-std::array<float,2>{0.998718381f, 0.592261374f},
-std::array<float,2>{0.233772159f, 0.214289352f},
-std::array<float,2>{0.771747351f, 0.112849548f},
-std::array<float,2>{0.0894277096f, 0.667701244f},
-std::array<float,2>{0.505521536f, 0.910207272f},
-std::array<float,2>{0.4818573f, 0.282945812f},
-std::array<float,2>{0.570254862f, 0.17073445f},
-std::array<float,2>{0.384702116f, 0.554502845f},
-std::array<float,2>{0.832373202f, 0.819667876f},
-std::array<float,2>{0.0250086375f, 0.455126375f},
-std::array<float,2>{0.928240955f, 0.319715142f},
-std::array<float,2>{0.151030526f, 0.980935037f},
-std::array<float,2>{0.717135012f, 0.725887537f},
-std::array<float,2>{0.352629244f, 0.0375737585f},
-std::array<float,2>{0.512930214f, 0.435926318f},
-std::array<float,2>{0.472913176f, 0.792899787f},
-std::array<float,2>{0.774070799f, 0.616872549f},
-std::array<float,2>{0.0828526169f, 0.219553903f},
-std::array<float,2>{0.986270189f, 0.0700389966f},
-std::array<float,2>{0.225855157f, 0.63761127f},
-std::array<float,2>{0.685183346f, 0.905015469f},
-std::array<float,2>{0.287665516f, 0.267426103f},
-std::array<float,2>{0.703828573f, 0.132544428f},
-std::array<float,2>{0.35005638f, 0.526126504f},
-std::array<float,2>{0.935335517f, 0.866953194f},
-std::array<float,2>{0.144672796f, 0.4805516f},
-std::array<float,2>{0.836198628f, 0.348012567f},
-std::array<float,2>{0.0225831047f, 0.943831742f},
-std::array<float,2>{0.572750628f, 0.716396391f},
-std::array<float,2>{0.37917307f, 0.00892463047f},
-std::array<float,2>{0.627806067f, 0.29077962f},
-std::array<float,2>{0.276269943f, 0.916124642f},
-std::array<float,2>{0.947099328f, 0.662123799f},
-std::array<float,2>{0.21428436f, 0.120204471f},
-std::array<float,2>{0.789573193f, 0.206303433f},
-std::array<float,2>{0.115161203f, 0.578991175f},
-std::array<float,2>{0.538424313f, 0.76938194f},
-std::array<float,2>{0.457512796f, 0.393002808f},
-std::array<float,2>{0.606679857f, 0.0405507982f},
-std::array<float,2>{0.41234538f, 0.728265226f},
-std::array<float,2>{0.843943238f, 0.970090449f},
-std::array<float,2>{0.0505314693f, 0.327987641f},
-std::array<float,2>{0.881943107f, 0.463269532f},
-std::array<float,2>{0.168117613f, 0.827217102f},
-std::array<float,2>{0.740816712f, 0.561928332f},
-std::array<float,2>{0.331382632f, 0.163141534f},
-std::array<float,2>{0.591683865f, 0.342608333f},
-std::array<float,2>{0.394816399f, 0.993661106f},
-std::array<float,2>{0.823889792f, 0.740858197f},
-std::array<float,2>{0.0067476593f, 0.0492410623f},
-std::array<float,2>{0.916504681f, 0.187334567f},
-std::array<float,2>{0.130377501f, 0.531531751f},
-std::array<float,2>{0.691379011f, 0.839562058f},
-std::array<float,2>{0.370548487f, 0.44859758f},
-std::array<float,2>{0.666815221f, 0.102658257f},
-std::array<float,2>{0.30654487f, 0.685037613f},
-std::array<float,2>{0.980712712f, 0.931661963f},
-std::array<float,2>{0.240145132f, 0.310215622f},
-std::array<float,2>{0.759233892f, 0.387758553f},
-std::array<float,2>{0.0732638836f, 0.755359054f},
-std::array<float,2>{0.5285936f, 0.577216625f},
-std::array<float,2>{0.497941345f, 0.20281823f},
-std::array<float,2>{0.729021072f, 0.490197271f},
-std::array<float,2>{0.326072007f, 0.850862801f},
-std::array<float,2>{0.903256834f, 0.507960439f},
-std::array<float,2>{0.18290849f, 0.155061454f},
-std::array<float,2>{0.874320984f, 0.0220399778f},
-std::array<float,2>{0.044802729f, 0.699311078f},
-std::array<float,2>{0.614173234f, 0.967084289f},
-std::array<float,2>{0.435136259f, 0.370117664f},
-std::array<float,2>{0.5545187f, 0.234455466f},
-std::array<float,2>{0.441043675f, 0.596156538f},
-std::array<float,2>{0.810886741f, 0.804898679f},
-std::array<float,2>{0.100507073f, 0.40759024f},
-std::array<float,2>{0.956530452f, 0.260167688f},
-std::array<float,2>{0.188082859f, 0.884148955f},
-std::array<float,2>{0.644677043f, 0.651302874f},
-std::array<float,2>{0.261655092f, 0.0820434093f},
-std::array<float,2>{0.602669537f, 0.416740924f},
-std::array<float,2>{0.406284869f, 0.797663987f},
-std::array<float,2>{0.850163043f, 0.603086948f},
-std::array<float,2>{0.0510541536f, 0.244941711f},
-std::array<float,2>{0.878695846f, 0.0914504528f},
-std::array<float,2>{0.164606631f, 0.642942846f},
-std::array<float,2>{0.738075554f, 0.878015399f},
-std::array<float,2>{0.333266348f, 0.253922313f},
-std::array<float,2>{0.630573153f, 0.141765282f},
-std::array<float,2>{0.280791879f, 0.500233352f},
-std::array<float,2>{0.950581193f, 0.852869093f},
-std::array<float,2>{0.218192101f, 0.499616444f},
-std::array<float,2>{0.794573367f, 0.362407833f},
-std::array<float,2>{0.109937012f, 0.960310578f},
-std::array<float,2>{0.532706559f, 0.689061403f},
-std::array<float,2>{0.454543471f, 0.0246749036f},
-std::array<float,2>{0.709017873f, 0.302578658f},
-std::array<float,2>{0.345239788f, 0.926189244f},
-std::array<float,2>{0.930071712f, 0.677508593f},
-std::array<float,2>{0.14097552f, 0.0943196267f},
-std::array<float,2>{0.843453765f, 0.189002156f},
-std::array<float,2>{0.0171698425f, 0.565570176f},
-std::array<float,2>{0.574639142f, 0.762516618f},
-std::array<float,2>{0.375062585f, 0.38137874f},
-std::array<float,2>{0.510370255f, 0.058853209f},
-std::array<float,2>{0.469842881f, 0.744623125f},
-std::array<float,2>{0.778011441f, 0.984464824f},
-std::array<float,2>{0.0810092464f, 0.333473861f},
-std::array<float,2>{0.991987348f, 0.444646955f},
-std::array<float,2>{0.221865803f, 0.835460484f},
-std::array<float,2>{0.680452764f, 0.542791665f},
-std::array<float,2>{0.284947991f, 0.174840406f},
-std::array<float,2>{0.550605893f, 0.314406902f},
-std::array<float,2>{0.444928199f, 0.980442822f},
-std::array<float,2>{0.805427194f, 0.720473409f},
-std::array<float,2>{0.0963246301f, 0.0328836143f},
-std::array<float,2>{0.959541857f, 0.167742997f},
-std::array<float,2>{0.191887423f, 0.547880113f},
-std::array<float,2>{0.642454982f, 0.813787699f},
-std::array<float,2>{0.262299895f, 0.459050596f},
-std::array<float,2>{0.734092474f, 0.115133174f},
-std::array<float,2>{0.321258038f, 0.669567168f},
-std::array<float,2>{0.900914729f, 0.909203887f},
-std::array<float,2>{0.184344441f, 0.28784126f},
-std::array<float,2>{0.867949247f, 0.399046957f},
-std::array<float,2>{0.0426269062f, 0.778324485f},
-std::array<float,2>{0.609390616f, 0.588208199f},
-std::array<float,2>{0.431031138f, 0.215621307f},
-std::array<float,2>{0.67144686f, 0.474216104f},
-std::array<float,2>{0.308952987f, 0.869845271f},
-std::array<float,2>{0.977460802f, 0.522686005f},
-std::array<float,2>{0.235031039f, 0.134377211f},
-std::array<float,2>{0.762326002f, 0.00555842184f},
-std::array<float,2>{0.0772507936f, 0.708127022f},
-std::array<float,2>{0.523700178f, 0.9458884f},
-std::array<float,2>{0.492640704f, 0.359371156f},
-std::array<float,2>{0.58960861f, 0.2283732f},
-std::array<float,2>{0.391094774f, 0.622310817f},
-std::array<float,2>{0.825426936f, 0.781874359f},
-std::array<float,2>{0.00100357214f, 0.426518977f},
-std::array<float,2>{0.920251667f, 0.274779052f},
-std::array<float,2>{0.126798481f, 0.898128629f},
-std::array<float,2>{0.6937114f, 0.630640447f},
-std::array<float,2>{0.372439206f, 0.0769687742f},
-std::array<float,2>{0.522348046f, 0.468749166f},
-std::array<float,2>{0.488402039f, 0.821344316f},
-std::array<float,2>{0.754601002f, 0.556658685f},
-std::array<float,2>{0.0683480501f, 0.158048704f},
-std::array<float,2>{0.972396493f, 0.0439960212f},
-std::array<float,2>{0.246365294f, 0.733806312f},
-std::array<float,2>{0.657802582f, 0.976457059f},
-std::array<float,2>{0.300434828f, 0.322208673f},
-std::array<float,2>{0.699742496f, 0.209941849f},
-std::array<float,2>{0.361452907f, 0.585213482f},
-std::array<float,2>{0.906744957f, 0.769804001f},
-std::array<float,2>{0.136689946f, 0.394567817f},
-std::array<float,2>{0.813128829f, 0.295076609f},
-std::array<float,2>{0.0121049723f, 0.920553029f},
-std::array<float,2>{0.584867954f, 0.657448113f},
-std::array<float,2>{0.404682964f, 0.121182442f},
-std::array<float,2>{0.648969471f, 0.346833706f},
-std::array<float,2>{0.250545591f, 0.938579142f},
-std::array<float,2>{0.967337608f, 0.711551428f},
-std::array<float,2>{0.197912708f, 0.0134999398f},
-std::array<float,2>{0.801515818f, 0.12603794f},
-std::array<float,2>{0.105063528f, 0.527476788f},
-std::array<float,2>{0.560371161f, 0.859386444f},
-std::array<float,2>{0.451904267f, 0.478826821f},
-std::array<float,2>{0.617410421f, 0.0637359321f},
-std::array<float,2>{0.424442291f, 0.634748697f},
-std::array<float,2>{0.860745788f, 0.900275946f},
-std::array<float,2>{0.0340240933f, 0.272833616f},
-std::array<float,2>{0.896520734f, 0.430822372f},
-std::array<float,2>{0.172279269f, 0.79524219f},
-std::array<float,2>{0.723795891f, 0.612805545f},
-std::array<float,2>{0.319801837f, 0.224949315f},
-std::array<float,2>{0.565061808f, 0.265309513f},
-std::array<float,2>{0.389631867f, 0.887031615f},
-std::array<float,2>{0.83144033f, 0.653317928f},
-std::array<float,2>{0.0277310293f, 0.0792584345f},
-std::array<float,2>{0.922136784f, 0.240221038f},
-std::array<float,2>{0.156178117f, 0.59870851f},
-std::array<float,2>{0.711926222f, 0.809535325f},
-std::array<float,2>{0.357167393f, 0.413241446f},
-std::array<float,2>{0.679213285f, 0.0189098623f},
-std::array<float,2>{0.296011716f, 0.697614849f},
-std::array<float,2>{0.995848477f, 0.962363005f},
-std::array<float,2>{0.229386687f, 0.372195542f},
-std::array<float,2>{0.766427279f, 0.4855946f},
-std::array<float,2>{0.0920557231f, 0.845856905f},
-std::array<float,2>{0.501832306f, 0.515062273f},
-std::array<float,2>{0.478850067f, 0.149870008f},
-std::array<float,2>{0.744011581f, 0.386658877f},
-std::array<float,2>{0.341737181f, 0.750915289f},
-std::array<float,2>{0.886484087f, 0.57301867f},
-std::array<float,2>{0.158051535f, 0.198008776f},
-std::array<float,2>{0.853787839f, 0.109086342f},
-std::array<float,2>{0.0607903264f, 0.682215214f},
-std::array<float,2>{0.600239396f, 0.935532212f},
-std::array<float,2>{0.417477667f, 0.306986362f},
-std::array<float,2>{0.540023446f, 0.182984874f},
-std::array<float,2>{0.463369966f, 0.536581993f},
-std::array<float,2>{0.781290531f, 0.841492593f},
-std::array<float,2>{0.124867223f, 0.452588469f},
-std::array<float,2>{0.938539028f, 0.338117898f},
-std::array<float,2>{0.206670478f, 0.997791409f},
-std::array<float,2>{0.637588739f, 0.737568259f},
-std::array<float,2>{0.27287516f, 0.0527468733f},
-std::array<float,2>{0.579370141f, 0.493622929f},
-std::array<float,2>{0.399663001f, 0.857301712f},
-std::array<float,2>{0.816875637f, 0.506295145f},
-std::array<float,2>{0.00958763622f, 0.144752711f},
-std::array<float,2>{0.910683036f, 0.0299228169f},
-std::array<float,2>{0.140524626f, 0.691975296f},
-std::array<float,2>{0.695339739f, 0.955344558f},
-std::array<float,2>{0.364787698f, 0.364132583f},
-std::array<float,2>{0.660231411f, 0.248135105f},
-std::array<float,2>{0.301188737f, 0.606022835f},
-std::array<float,2>{0.976554692f, 0.803965688f},
-std::array<float,2>{0.243984446f, 0.420971692f},
-std::array<float,2>{0.751267135f, 0.252037615f},
-std::array<float,2>{0.0656182617f, 0.88248235f},
-std::array<float,2>{0.51750958f, 0.646163285f},
-std::array<float,2>{0.484760672f, 0.0889540985f},
-std::array<float,2>{0.720118582f, 0.328806788f},
-std::array<float,2>{0.314591557f, 0.989120483f},
-std::array<float,2>{0.894104362f, 0.749082386f},
-std::array<float,2>{0.177018523f, 0.0555082709f},
-std::array<float,2>{0.865417838f, 0.17637971f},
-std::array<float,2>{0.0354621746f, 0.543499529f},
-std::array<float,2>{0.622374833f, 0.829777598f},
-std::array<float,2>{0.42626971f, 0.439660311f},
-std::array<float,2>{0.554965436f, 0.101400271f},
-std::array<float,2>{0.447717875f, 0.675424635f},
-std::array<float,2>{0.798824728f, 0.923454762f},
-std::array<float,2>{0.108192079f, 0.297285497f},
-std::array<float,2>{0.962011337f, 0.377153248f},
-std::array<float,2>{0.202500805f, 0.761107802f},
-std::array<float,2>{0.655199051f, 0.569816947f},
-std::array<float,2>{0.256736547f, 0.192381471f},
-std::array<float,2>{0.507780313f, 0.283262134f},
-std::array<float,2>{0.483635336f, 0.912312448f},
-std::array<float,2>{0.769699216f, 0.664154112f},
-std::array<float,2>{0.0861046985f, 0.109507792f},
-std::array<float,2>{0.996934414f, 0.211531818f},
-std::array<float,2>{0.231612414f, 0.59077388f},
-std::array<float,2>{0.67493403f, 0.773794055f},
-std::array<float,2>{0.292078912f, 0.405356616f},
-std::array<float,2>{0.71674639f, 0.0366946943f},
-std::array<float,2>{0.354298055f, 0.723970354f},
-std::array<float,2>{0.925889194f, 0.983969033f},
-std::array<float,2>{0.148469478f, 0.317556351f},
-std::array<float,2>{0.835456133f, 0.45473972f},
-std::array<float,2>{0.0269615781f, 0.818046153f},
-std::array<float,2>{0.567243338f, 0.551422596f},
-std::array<float,2>{0.385633796f, 0.169773385f},
-std::array<float,2>{0.634910345f, 0.424883306f},
-std::array<float,2>{0.26786527f, 0.788878024f},
-std::array<float,2>{0.94479841f, 0.620437384f},
-std::array<float,2>{0.210624516f, 0.233063355f},
-std::array<float,2>{0.788375676f, 0.0727576837f},
-std::array<float,2>{0.120006405f, 0.62529093f},
-std::array<float,2>{0.544726372f, 0.892272949f},
-std::array<float,2>{0.466391295f, 0.279015958f},
-std::array<float,2>{0.594700873f, 0.139884591f},
-std::array<float,2>{0.421494722f, 0.518568397f},
-std::array<float,2>{0.856328607f, 0.872557998f},
-std::array<float,2>{0.0571375601f, 0.471419513f},
-std::array<float,2>{0.887937725f, 0.352168739f},
-std::array<float,2>{0.162385657f, 0.951521993f},
-std::array<float,2>{0.749874294f, 0.704387903f},
-std::array<float,2>{0.339755446f, 0.00245681079f},
-std::array<float,2>{0.535491824f, 0.392053068f},
-std::array<float,2>{0.459001124f, 0.765790164f},
-std::array<float,2>{0.792612612f, 0.580147088f},
-std::array<float,2>{0.116291061f, 0.204677418f},
-std::array<float,2>{0.947600543f, 0.11784254f},
-std::array<float,2>{0.212137327f, 0.661531448f},
-std::array<float,2>{0.62671864f, 0.914078772f},
-std::array<float,2>{0.274480134f, 0.292309999f},
-std::array<float,2>{0.740150213f, 0.161361784f},
-std::array<float,2>{0.329195768f, 0.560543537f},
-std::array<float,2>{0.880441248f, 0.825947464f},
-std::array<float,2>{0.170814961f, 0.462156415f},
-std::array<float,2>{0.846273243f, 0.324990004f},
-std::array<float,2>{0.04856712f, 0.971786439f},
-std::array<float,2>{0.609366f, 0.729826152f},
-std::array<float,2>{0.410665751f, 0.0415860415f},
-std::array<float,2>{0.6857692f, 0.26885125f},
-std::array<float,2>{0.285202384f, 0.903246701f},
-std::array<float,2>{0.986415148f, 0.639366329f},
-std::array<float,2>{0.223506823f, 0.0675048605f},
-std::array<float,2>{0.777053654f, 0.220886603f},
-std::array<float,2>{0.0851532072f, 0.613883495f},
-std::array<float,2>{0.514143646f, 0.79050523f},
-std::array<float,2>{0.475814283f, 0.435331732f},
-std::array<float,2>{0.571592808f, 0.0110854888f},
-std::array<float,2>{0.382695973f, 0.71857965f},
-std::array<float,2>{0.838417292f, 0.943308413f},
-std::array<float,2>{0.0214422885f, 0.349970788f},
-std::array<float,2>{0.937111378f, 0.483223855f},
-std::array<float,2>{0.148340285f, 0.864470065f},
-std::array<float,2>{0.705941975f, 0.52520442f},
-std::array<float,2>{0.347754687f, 0.129581273f},
-std::array<float,2>{0.61572814f, 0.368451655f},
-std::array<float,2>{0.437216729f, 0.965206504f},
-std::array<float,2>{0.872951329f, 0.701878905f},
-std::array<float,2>{0.045964323f, 0.0197399855f},
-std::array<float,2>{0.905694604f, 0.153826475f},
-std::array<float,2>{0.180761769f, 0.511183977f},
-std::array<float,2>{0.728184223f, 0.849552155f},
-std::array<float,2>{0.326877743f, 0.49097389f},
-std::array<float,2>{0.647901595f, 0.0851998627f},
-std::array<float,2>{0.259031594f, 0.649702847f},
-std::array<float,2>{0.954551816f, 0.885187447f},
-std::array<float,2>{0.189662293f, 0.259362549f},
-std::array<float,2>{0.810349822f, 0.408289254f},
-std::array<float,2>{0.0979358628f, 0.807801902f},
-std::array<float,2>{0.551820993f, 0.595123529f},
-std::array<float,2>{0.438473135f, 0.236580789f},
-std::array<float,2>{0.688677788f, 0.445557833f},
-std::array<float,2>{0.368152648f, 0.837479532f},
-std::array<float,2>{0.915581942f, 0.533307731f},
-std::array<float,2>{0.131111234f, 0.185430795f},
-std::array<float,2>{0.821742594f, 0.0472793318f},
-std::array<float,2>{0.00395574607f, 0.738452256f},
-std::array<float,2>{0.593089283f, 0.995723486f},
-std::array<float,2>{0.398059189f, 0.340569347f},
-std::array<float,2>{0.529960454f, 0.200771257f},
-std::array<float,2>{0.498559982f, 0.575621665f},
-std::array<float,2>{0.76016289f, 0.757789314f},
-std::array<float,2>{0.0721321553f, 0.390158504f},
-std::array<float,2>{0.983991981f, 0.311853886f},
-std::array<float,2>{0.241171628f, 0.930102348f},
-std::array<float,2>{0.664067864f, 0.68581742f},
-std::array<float,2>{0.308089048f, 0.104168653f},
-std::array<float,2>{0.587447047f, 0.427651942f},
-std::array<float,2>{0.393285573f, 0.783101201f},
-std::array<float,2>{0.827686846f, 0.621427655f},
-std::array<float,2>{0.00327720144f, 0.227166086f},
-std::array<float,2>{0.918748319f, 0.0778302699f},
-std::array<float,2>{0.127119496f, 0.628974199f},
-std::array<float,2>{0.692739844f, 0.897280514f},
-std::array<float,2>{0.373627812f, 0.274008244f},
-std::array<float,2>{0.66950655f, 0.132889152f},
-std::array<float,2>{0.31185475f, 0.521524906f},
-std::array<float,2>{0.979569972f, 0.871062219f},
-std::array<float,2>{0.237411872f, 0.473464668f},
-std::array<float,2>{0.765492439f, 0.357562423f},
-std::array<float,2>{0.0760817006f, 0.946675897f},
-std::array<float,2>{0.526161611f, 0.70749259f},
-std::array<float,2>{0.495606065f, 0.00434185471f},
-std::array<float,2>{0.730913758f, 0.288572848f},
-std::array<float,2>{0.32407546f, 0.908328295f},
-std::array<float,2>{0.900113046f, 0.668106556f},
-std::array<float,2>{0.186974913f, 0.113964953f},
-std::array<float,2>{0.870252907f, 0.216496989f},
-std::array<float,2>{0.0398618653f, 0.588871419f},
-std::array<float,2>{0.612327039f, 0.777543485f},
-std::array<float,2>{0.432940543f, 0.400262654f},
-std::array<float,2>{0.547211289f, 0.03133367f},
-std::array<float,2>{0.442908257f, 0.719269395f},
-std::array<float,2>{0.808244944f, 0.979299068f},
-std::array<float,2>{0.0945347473f, 0.312518626f},
-std::array<float,2>{0.958349824f, 0.460880041f},
-std::array<float,2>{0.194299132f, 0.812667131f},
-std::array<float,2>{0.643781722f, 0.547104001f},
-std::array<float,2>{0.263994217f, 0.166750282f},
-std::array<float,2>{0.509169221f, 0.332236558f},
-std::array<float,2>{0.471602559f, 0.985852122f},
-std::array<float,2>{0.781063676f, 0.745688915f},
-std::array<float,2>{0.0783873796f, 0.0600604825f},
-std::array<float,2>{0.988516629f, 0.174566045f},
-std::array<float,2>{0.219225571f, 0.541638434f},
-std::array<float,2>{0.682366192f, 0.834344864f},
-std::array<float,2>{0.282090425f, 0.443500608f},
-std::array<float,2>{0.708253741f, 0.0949916244f},
-std::array<float,2>{0.346669048f, 0.675971687f},
-std::array<float,2>{0.933543265f, 0.927690208f},
-std::array<float,2>{0.143061996f, 0.300893664f},
-std::array<float,2>{0.840893626f, 0.38257122f},
-std::array<float,2>{0.019462429f, 0.763598144f},
-std::array<float,2>{0.577132404f, 0.564974546f},
-std::array<float,2>{0.378476858f, 0.187694252f},
-std::array<float,2>{0.632541776f, 0.498271406f},
-std::array<float,2>{0.278773725f, 0.851623297f},
-std::array<float,2>{0.95192641f, 0.501912832f},
-std::array<float,2>{0.216584936f, 0.141506448f},
-std::array<float,2>{0.795158863f, 0.023756193f},
-std::array<float,2>{0.111391008f, 0.687652946f},
-std::array<float,2>{0.534768224f, 0.959039688f},
-std::array<float,2>{0.457003653f, 0.362015456f},
-std::array<float,2>{0.604211628f, 0.246071681f},
-std::array<float,2>{0.409568012f, 0.602222919f},
-std::array<float,2>{0.849538445f, 0.798684001f},
-std::array<float,2>{0.053208448f, 0.417002439f},
-std::array<float,2>{0.875706971f, 0.255565435f},
-std::array<float,2>{0.167123094f, 0.877683401f},
-std::array<float,2>{0.736010551f, 0.643836737f},
-std::array<float,2>{0.333988994f, 0.0903984457f},
-std::array<float,2>{0.541274965f, 0.451890528f},
-std::array<float,2>{0.461280018f, 0.839907944f},
-std::array<float,2>{0.784895122f, 0.535737097f},
-std::array<float,2>{0.121257037f, 0.182042956f},
-std::array<float,2>{0.940802991f, 0.054244183f},
-std::array<float,2>{0.204676583f, 0.736883283f},
-std::array<float,2>{0.639022589f, 0.996751606f},
-std::array<float,2>{0.27083981f, 0.33914417f},
-std::array<float,2>{0.74468869f, 0.19891268f},
-std::array<float,2>{0.341861486f, 0.573667884f},
-std::array<float,2>{0.884399295f, 0.751018345f},
-std::array<float,2>{0.158652186f, 0.385585278f},
-std::array<float,2>{0.852905512f, 0.307707608f},
-std::array<float,2>{0.0591187812f, 0.933768213f},
-std::array<float,2>{0.599297106f, 0.683478296f},
-std::array<float,2>{0.414221108f, 0.108050503f},
-std::array<float,2>{0.675791562f, 0.371215343f},
-std::array<float,2>{0.293421686f, 0.961380959f},
-std::array<float,2>{0.993649244f, 0.698558152f},
-std::array<float,2>{0.228176445f, 0.0182600003f},
-std::array<float,2>{0.768363714f, 0.149209186f},
-std::array<float,2>{0.0899005681f, 0.51412648f},
-std::array<float,2>{0.502329111f, 0.846695304f},
-std::array<float,2>{0.477959424f, 0.484435439f},
-std::array<float,2>{0.564091504f, 0.0789882243f},
-std::array<float,2>{0.387044728f, 0.653530002f},
-std::array<float,2>{0.828201115f, 0.888543606f},
-std::array<float,2>{0.0299148876f, 0.26378566f},
-std::array<float,2>{0.924545944f, 0.41300112f},
-std::array<float,2>{0.153650731f, 0.810459733f},
-std::array<float,2>{0.713449836f, 0.598059952f},
-std::array<float,2>{0.357728034f, 0.238954633f},
-std::array<float,2>{0.619579434f, 0.271847069f},
-std::array<float,2>{0.422259092f, 0.898578167f},
-std::array<float,2>{0.863145053f, 0.633241296f},
-std::array<float,2>{0.0324059762f, 0.0632392094f},
-std::array<float,2>{0.895811796f, 0.225789294f},
-std::array<float,2>{0.17462562f, 0.611486971f},
-std::array<float,2>{0.724885881f, 0.796442032f},
-std::array<float,2>{0.316559345f, 0.430247903f},
-std::array<float,2>{0.651602983f, 0.0117765684f},
-std::array<float,2>{0.253819674f, 0.712613821f},
-std::array<float,2>{0.965261459f, 0.937611461f},
-std::array<float,2>{0.196973458f, 0.345715731f},
-std::array<float,2>{0.804363489f, 0.479998887f},
-std::array<float,2>{0.101650439f, 0.860771894f},
-std::array<float,2>{0.562396407f, 0.528840601f},
-std::array<float,2>{0.450639755f, 0.125833541f},
-std::array<float,2>{0.701326549f, 0.396102101f},
-std::array<float,2>{0.359652102f, 0.770596027f},
-std::array<float,2>{0.908478379f, 0.584390402f},
-std::array<float,2>{0.134699628f, 0.210204288f},
-std::array<float,2>{0.81512177f, 0.122312099f},
-std::array<float,2>{0.0137735149f, 0.656588793f},
-std::array<float,2>{0.583471358f, 0.921068728f},
-std::array<float,2>{0.403365642f, 0.296272933f},
-std::array<float,2>{0.520729244f, 0.156273261f},
-std::array<float,2>{0.49204585f, 0.558399916f},
-std::array<float,2>{0.756334662f, 0.821035743f},
-std::array<float,2>{0.0687486157f, 0.466956317f},
-std::array<float,2>{0.969061315f, 0.320532858f},
-std::array<float,2>{0.249558344f, 0.97535497f},
-std::array<float,2>{0.659069598f, 0.733251929f},
-std::array<float,2>{0.29775703f, 0.0436250269f},
-std::array<float,2>{0.597059667f, 0.471817434f},
-std::array<float,2>{0.418332487f, 0.871644497f},
-std::array<float,2>{0.858576119f, 0.517721295f},
-std::array<float,2>{0.056175936f, 0.138803601f},
-std::array<float,2>{0.88964361f, 0.00365605834f},
-std::array<float,2>{0.160229519f, 0.703639865f},
-std::array<float,2>{0.747658551f, 0.953110635f},
-std::array<float,2>{0.336555481f, 0.353459537f},
-std::array<float,2>{0.634430647f, 0.233632714f},
-std::array<float,2>{0.266443849f, 0.619683564f},
-std::array<float,2>{0.942081809f, 0.787963033f},
-std::array<float,2>{0.207753375f, 0.424403936f},
-std::array<float,2>{0.78608036f, 0.277375191f},
-std::array<float,2>{0.118943393f, 0.891001225f},
-std::array<float,2>{0.546246469f, 0.626567364f},
-std::array<float,2>{0.467288762f, 0.0734544843f},
-std::array<float,2>{0.718622565f, 0.316812754f},
-std::array<float,2>{0.351828456f, 0.982598841f},
-std::array<float,2>{0.929148793f, 0.723388016f},
-std::array<float,2>{0.152172089f, 0.0357281826f},
-std::array<float,2>{0.83348614f, 0.168415859f},
-std::array<float,2>{0.0236934777f, 0.552127361f},
-std::array<float,2>{0.568603635f, 0.816421688f},
-std::array<float,2>{0.383726358f, 0.453900009f},
-std::array<float,2>{0.504354f, 0.110687815f},
-std::array<float,2>{0.480570972f, 0.665918589f},
-std::array<float,2>{0.773030698f, 0.913424075f},
-std::array<float,2>{0.0885657966f, 0.284647077f},
-std::array<float,2>{0.999261737f, 0.404828817f},
-std::array<float,2>{0.233004272f, 0.774785399f},
-std::array<float,2>{0.672617435f, 0.591291368f},
-std::array<float,2>{0.289571822f, 0.212046564f},
-std::array<float,2>{0.558514535f, 0.297865629f},
-std::array<float,2>{0.446187258f, 0.922724187f},
-std::array<float,2>{0.799244881f, 0.674330354f},
-std::array<float,2>{0.106336042f, 0.0996587723f},
-std::array<float,2>{0.963138402f, 0.19302018f},
-std::array<float,2>{0.199435771f, 0.569288194f},
-std::array<float,2>{0.653034687f, 0.760125279f},
-std::array<float,2>{0.255558014f, 0.378006816f},
-std::array<float,2>{0.721445084f, 0.0560835861f},
-std::array<float,2>{0.313383818f, 0.748833239f},
-std::array<float,2>{0.892527759f, 0.989599288f},
-std::array<float,2>{0.178791314f, 0.32993266f},
-std::array<float,2>{0.863888323f, 0.440981716f},
-std::array<float,2>{0.0382787548f, 0.828512669f},
-std::array<float,2>{0.624839604f, 0.544265509f},
-std::array<float,2>{0.429175168f, 0.177261993f},
-std::array<float,2>{0.662837744f, 0.420774698f},
-std::array<float,2>{0.304657847f, 0.803491235f},
-std::array<float,2>{0.973372042f, 0.606724203f},
-std::array<float,2>{0.245556518f, 0.249732316f},
-std::array<float,2>{0.753794611f, 0.0885948539f},
-std::array<float,2>{0.0634632856f, 0.645440042f},
-std::array<float,2>{0.518206954f, 0.880913019f},
-std::array<float,2>{0.487157136f, 0.253017336f},
-std::array<float,2>{0.581122518f, 0.145893514f},
-std::array<float,2>{0.401693672f, 0.506847858f},
-std::array<float,2>{0.820160031f, 0.855578125f},
-std::array<float,2>{0.0113775497f, 0.492967069f},
-std::array<float,2>{0.912758946f, 0.364313364f},
-std::array<float,2>{0.13762036f, 0.956080556f},
-std::array<float,2>{0.697935462f, 0.692687094f},
-std::array<float,2>{0.366825521f, 0.0303462278f},
-std::array<float,2>{0.527855814f, 0.389190018f},
-std::array<float,2>{0.496796131f, 0.756677628f},
-std::array<float,2>{0.75785464f, 0.57458806f},
-std::array<float,2>{0.0725143477f, 0.199708208f},
-std::array<float,2>{0.98149693f, 0.105209775f},
-std::array<float,2>{0.23837994f, 0.686601281f},
-std::array<float,2>{0.667026758f, 0.930959225f},
-std::array<float,2>{0.305027723f, 0.310817629f},
-std::array<float,2>{0.689865768f, 0.183658555f},
-std::array<float,2>{0.369237036f, 0.534475446f},
-std::array<float,2>{0.917691588f, 0.836526573f},
-std::array<float,2>{0.129691049f, 0.447000176f},
-std::array<float,2>{0.822388351f, 0.341665268f},
-std::array<float,2>{0.00736933947f, 0.994231462f},
-std::array<float,2>{0.59007144f, 0.740029752f},
-std::array<float,2>{0.39638561f, 0.0479858331f},
-std::array<float,2>{0.646229565f, 0.258512199f},
-std::array<float,2>{0.26058957f, 0.886479914f},
-std::array<float,2>{0.955619276f, 0.649126291f},
-std::array<float,2>{0.189277977f, 0.0841844082f},
-std::array<float,2>{0.811559618f, 0.237875f},
-std::array<float,2>{0.10103967f, 0.5946275f},
-std::array<float,2>{0.553072274f, 0.807113826f},
-std::array<float,2>{0.4399257f, 0.409935176f},
-std::array<float,2>{0.614973783f, 0.0208019335f},
-std::array<float,2>{0.434246719f, 0.702697456f},
-std::array<float,2>{0.873768926f, 0.966219246f},
-std::array<float,2>{0.0434888378f, 0.367228925f},
-std::array<float,2>{0.903639436f, 0.491981626f},
-std::array<float,2>{0.182387769f, 0.847824633f},
-std::array<float,2>{0.729685307f, 0.51071763f},
-std::array<float,2>{0.324731648f, 0.152680129f},
-std::array<float,2>{0.573513329f, 0.35059765f},
-std::array<float,2>{0.380711973f, 0.942179739f},
-std::array<float,2>{0.837493658f, 0.717640102f},
-std::array<float,2>{0.0223221462f, 0.0106239244f},
-std::array<float,2>{0.934535205f, 0.13019307f},
-std::array<float,2>{0.146105438f, 0.523459136f},
-std::array<float,2>{0.704690754f, 0.864116967f},
-std::array<float,2>{0.351066887f, 0.484188706f},
-std::array<float,2>{0.683666646f, 0.0665956959f},
-std::array<float,2>{0.288664788f, 0.640543699f},
-std::array<float,2>{0.984607816f, 0.903517842f},
-std::array<float,2>{0.225146383f, 0.267595559f},
-std::array<float,2>{0.774906814f, 0.434152126f},
-std::array<float,2>{0.0837921649f, 0.789287746f},
-std::array<float,2>{0.512450874f, 0.614892304f},
-std::array<float,2>{0.47426644f, 0.221729025f},
-std::array<float,2>{0.741768718f, 0.461005956f},
-std::array<float,2>{0.330571681f, 0.825116515f},
-std::array<float,2>{0.88182348f, 0.558604777f},
-std::array<float,2>{0.169478565f, 0.160598859f},
-std::array<float,2>{0.844925702f, 0.0424807556f},
-std::array<float,2>{0.0489842221f, 0.729023397f},
-std::array<float,2>{0.606271446f, 0.970798731f},
-std::array<float,2>{0.413501024f, 0.325918615f},
-std::array<float,2>{0.537251353f, 0.203533709f},
-std::array<float,2>{0.458343387f, 0.581784904f},
-std::array<float,2>{0.790043235f, 0.766915441f},
-std::array<float,2>{0.113700099f, 0.391124189f},
-std::array<float,2>{0.945851266f, 0.291816205f},
-std::array<float,2>{0.213354558f, 0.915166914f},
-std::array<float,2>{0.628887177f, 0.660785496f},
-std::array<float,2>{0.277312398f, 0.119056925f},
-std::array<float,2>{0.611162186f, 0.402230203f},
-std::array<float,2>{0.430657864f, 0.781173468f},
-std::array<float,2>{0.868442118f, 0.58780843f},
-std::array<float,2>{0.0413843691f, 0.217795014f},
-std::array<float,2>{0.901382983f, 0.115421645f},
-std::array<float,2>{0.184739992f, 0.67001158f},
-std::array<float,2>{0.733176887f, 0.90712148f},
-std::array<float,2>{0.322016299f, 0.286711305f},
-std::array<float,2>{0.641072869f, 0.164548591f},
-std::array<float,2>{0.263513446f, 0.550106645f},
-std::array<float,2>{0.960416675f, 0.814503849f},
-std::array<float,2>{0.193230152f, 0.457649261f},
-std::array<float,2>{0.806604326f, 0.315524191f},
-std::array<float,2>{0.097599417f, 0.978386939f},
-std::array<float,2>{0.549149275f, 0.722297192f},
-std::array<float,2>{0.444275379f, 0.033620812f},
-std::array<float,2>{0.694911957f, 0.277020007f},
-std::array<float,2>{0.37179324f, 0.894896507f},
-std::array<float,2>{0.921662688f, 0.631051302f},
-std::array<float,2>{0.125823334f, 0.0747887492f},
-std::array<float,2>{0.824262261f, 0.229071245f},
-std::array<float,2>{0.000482071016f, 0.624970376f},
-std::array<float,2>{0.588191926f, 0.785013735f},
-std::array<float,2>{0.392025113f, 0.42813468f},
-std::array<float,2>{0.525158942f, 0.00653877482f},
-std::array<float,2>{0.493267119f, 0.710739613f},
-std::array<float,2>{0.76326263f, 0.948443353f},
-std::array<float,2>{0.0770814121f, 0.356470257f},
-std::array<float,2>{0.977818489f, 0.474756956f},
-std::array<float,2>{0.236299276f, 0.869048536f},
-std::array<float,2>{0.670035481f, 0.519683897f},
-std::array<float,2>{0.309600234f, 0.135407016f},
-std::array<float,2>{0.531959832f, 0.360954821f},
-std::array<float,2>{0.453454643f, 0.957058311f},
-std::array<float,2>{0.793561876f, 0.689850271f},
-std::array<float,2>{0.110561885f, 0.025582388f},
-std::array<float,2>{0.949422419f, 0.143563777f},
-std::array<float,2>{0.217252001f, 0.50271368f},
-std::array<float,2>{0.629829347f, 0.853792369f},
-std::array<float,2>{0.279525012f, 0.496481568f},
-std::array<float,2>{0.737190187f, 0.0921830982f},
-std::array<float,2>{0.33231771f, 0.642400801f},
-std::array<float,2>{0.877707303f, 0.875008047f},
-std::array<float,2>{0.165063694f, 0.257291675f},
-std::array<float,2>{0.85150528f, 0.414179325f},
-std::array<float,2>{0.0518907718f, 0.799283743f},
-std::array<float,2>{0.602048218f, 0.604460299f},
-std::array<float,2>{0.40784049f, 0.243351638f},
-std::array<float,2>{0.681318223f, 0.441536546f},
-std::array<float,2>{0.283972055f, 0.833942413f},
-std::array<float,2>{0.991122603f, 0.539364576f},
-std::array<float,2>{0.221360967f, 0.172974408f},
-std::array<float,2>{0.778434455f, 0.062356364f},
-std::array<float,2>{0.0813094005f, 0.743893087f},
-std::array<float,2>{0.510792971f, 0.98757571f},
-std::array<float,2>{0.468913615f, 0.33414939f},
-std::array<float,2>{0.575887322f, 0.189996898f},
-std::array<float,2>{0.376375109f, 0.564068854f},
-std::array<float,2>{0.842294574f, 0.764131367f},
-std::array<float,2>{0.0163880084f, 0.380203098f},
-std::array<float,2>{0.930966794f, 0.303001255f},
-std::array<float,2>{0.142481044f, 0.928080142f},
-std::array<float,2>{0.710225224f, 0.678958774f},
-std::array<float,2>{0.344725847f, 0.0971539542f},
-std::array<float,2>{0.500730217f, 0.487185985f},
-std::array<float,2>{0.479586661f, 0.844826937f},
-std::array<float,2>{0.766956449f, 0.51285696f},
-std::array<float,2>{0.092814967f, 0.151487708f},
-std::array<float,2>{0.994869649f, 0.0167431273f},
-std::array<float,2>{0.22974284f, 0.69650054f},
-std::array<float,2>{0.678595245f, 0.964662015f},
-std::array<float,2>{0.295003444f, 0.37337178f},
-std::array<float,2>{0.711601079f, 0.242042318f},
-std::array<float,2>{0.355530828f, 0.601424098f},
-std::array<float,2>{0.923536122f, 0.811947405f},
-std::array<float,2>{0.154848754f, 0.411954939f},
-std::array<float,2>{0.830567598f, 0.263149709f},
-std::array<float,2>{0.0286168307f, 0.888684869f},
-std::array<float,2>{0.565584838f, 0.654539764f},
-std::array<float,2>{0.390265018f, 0.0807395279f},
-std::array<float,2>{0.637775302f, 0.33735624f},
-std::array<float,2>{0.272285372f, 0.999620378f},
-std::array<float,2>{0.93831414f, 0.734594762f},
-std::array<float,2>{0.205993637f, 0.0507865287f},
-std::array<float,2>{0.783004999f, 0.180771992f},
-std::array<float,2>{0.123584926f, 0.538178325f},
-std::array<float,2>{0.540106952f, 0.843621314f},
-std::array<float,2>{0.464817941f, 0.450857788f},
-std::array<float,2>{0.601453185f, 0.106467165f},
-std::array<float,2>{0.416587353f, 0.679941177f},
-std::array<float,2>{0.855459094f, 0.936125278f},
-std::array<float,2>{0.0620068237f, 0.30568862f},
-std::array<float,2>{0.884902954f, 0.383986771f},
-std::array<float,2>{0.15631789f, 0.751990616f},
-std::array<float,2>{0.74263531f, 0.571814358f},
-std::array<float,2>{0.340014696f, 0.196531668f},
-std::array<float,2>{0.585580587f, 0.293317735f},
-std::array<float,2>{0.405809134f, 0.918891907f},
-std::array<float,2>{0.813497365f, 0.658741355f},
-std::array<float,2>{0.0131664667f, 0.124651648f},
-std::array<float,2>{0.908151984f, 0.207995594f},
-std::array<float,2>{0.135331407f, 0.582225025f},
-std::array<float,2>{0.700368881f, 0.771643341f},
-std::array<float,2>{0.362435281f, 0.397781461f},
-std::array<float,2>{0.656649113f, 0.0451743789f},
-std::array<float,2>{0.298856437f, 0.73222369f},
-std::array<float,2>{0.970979571f, 0.974442184f},
-std::array<float,2>{0.247489572f, 0.322654665f},
-std::array<float,2>{0.755437136f, 0.465564936f},
-std::array<float,2>{0.0664280802f, 0.82338959f},
-std::array<float,2>{0.52273643f, 0.555345893f},
-std::array<float,2>{0.489337087f, 0.159836248f},
-std::array<float,2>{0.723086536f, 0.431764036f},
-std::array<float,2>{0.318987846f, 0.794920564f},
-std::array<float,2>{0.89839977f, 0.610435545f},
-std::array<float,2>{0.173540875f, 0.224415362f},
-std::array<float,2>{0.859501898f, 0.0657158718f},
-std::array<float,2>{0.0348160192f, 0.635382891f},
-std::array<float,2>{0.618977666f, 0.900929809f},
-std::array<float,2>{0.425753236f, 0.269537687f},
-std::array<float,2>{0.558927178f, 0.12859945f},
-std::array<float,2>{0.453019857f, 0.530466318f},
-std::array<float,2>{0.80199492f, 0.861982524f},
-std::array<float,2>{0.10441222f, 0.47813347f},
-std::array<float,2>{0.96833688f, 0.344645828f},
-std::array<float,2>{0.198756918f, 0.940498352f},
-std::array<float,2>{0.650282264f, 0.713397026f},
-std::array<float,2>{0.251950145f, 0.0142824501f},
-std::array<float,2>{0.568030298f, 0.456803232f},
-std::array<float,2>{0.386342257f, 0.819131494f},
-std::array<float,2>{0.834617257f, 0.553091109f},
-std::array<float,2>{0.0260840673f, 0.171433643f},
-std::array<float,2>{0.927605331f, 0.0380882025f},
-std::array<float,2>{0.149597466f, 0.724838495f},
-std::array<float,2>{0.71578455f, 0.982329369f},
-std::array<float,2>{0.354989022f, 0.319168657f},
-std::array<float,2>{0.674671292f, 0.21350868f},
-std::array<float,2>{0.291115671f, 0.5931499f},
-std::array<float,2>{0.997148752f, 0.776283383f},
-std::array<float,2>{0.231034234f, 0.402414322f},
-std::array<float,2>{0.771296561f, 0.282041162f},
-std::array<float,2>{0.0870743319f, 0.911348045f},
-std::array<float,2>{0.506059289f, 0.666927814f},
-std::array<float,2>{0.483132988f, 0.111987643f},
-std::array<float,2>{0.748893678f, 0.354475826f},
-std::array<float,2>{0.338050157f, 0.950582504f},
-std::array<float,2>{0.886878431f, 0.706358552f},
-std::array<float,2>{0.163090855f, 0.000864259084f},
-std::array<float,2>{0.85697341f, 0.138546601f},
-std::array<float,2>{0.0579160824f, 0.51747781f},
-std::array<float,2>{0.594968557f, 0.873084605f},
-std::array<float,2>{0.420863688f, 0.469425678f},
-std::array<float,2>{0.543045521f, 0.0721108019f},
-std::array<float,2>{0.465000898f, 0.62778455f},
-std::array<float,2>{0.787753999f, 0.893108666f},
-std::array<float,2>{0.120952182f, 0.280611575f},
-std::array<float,2>{0.94417423f, 0.422423512f},
-std::array<float,2>{0.209047914f, 0.78636992f},
-std::array<float,2>{0.636466622f, 0.61864531f},
-std::array<float,2>{0.268804669f, 0.232117593f},
-std::array<float,2>{0.515692055f, 0.25162977f},
-std::array<float,2>{0.485745907f, 0.880434871f},
-std::array<float,2>{0.750712216f, 0.646995664f},
-std::array<float,2>{0.0654184222f, 0.0866076499f},
-std::array<float,2>{0.975336254f, 0.247448981f},
-std::array<float,2>{0.24231723f, 0.607679784f},
-std::array<float,2>{0.661755323f, 0.802559495f},
-std::array<float,2>{0.302371293f, 0.419156909f},
-std::array<float,2>{0.696538031f, 0.0278954487f},
-std::array<float,2>{0.363894939f, 0.694128692f},
-std::array<float,2>{0.911396205f, 0.954415023f},
-std::array<float,2>{0.138807043f, 0.365628511f},
-std::array<float,2>{0.817403257f, 0.495486021f},
-std::array<float,2>{0.0086973682f, 0.85777688f},
-std::array<float,2>{0.578482032f, 0.504439175f},
-std::array<float,2>{0.398642182f, 0.147928968f},
-std::array<float,2>{0.655445039f, 0.375978291f},
-std::array<float,2>{0.257436961f, 0.759577513f},
-std::array<float,2>{0.961210251f, 0.566731274f},
-std::array<float,2>{0.201905712f, 0.193657771f},
-std::array<float,2>{0.796889842f, 0.0992206112f},
-std::array<float,2>{0.108719222f, 0.673182905f},
-std::array<float,2>{0.556564689f, 0.925554276f},
-std::array<float,2>{0.448592484f, 0.298988968f},
-std::array<float,2>{0.621459246f, 0.179572105f},
-std::array<float,2>{0.427539587f, 0.546789825f},
-std::array<float,2>{0.866702676f, 0.830419302f},
-std::array<float,2>{0.0367267542f, 0.438399374f},
-std::array<float,2>{0.893387794f, 0.330352575f},
-std::array<float,2>{0.176011726f, 0.990359008f},
-std::array<float,2>{0.719030499f, 0.746764839f},
-std::array<float,2>{0.315986246f, 0.0571773946f},
-std::array<float,2>{0.551633716f, 0.406376272f},
-std::array<float,2>{0.438972771f, 0.806058168f},
-std::array<float,2>{0.809051871f, 0.597435534f},
-std::array<float,2>{0.0989832208f, 0.23614499f},
-std::array<float,2>{0.953460097f, 0.0831790119f},
-std::array<float,2>{0.190878227f, 0.651389599f},
-std::array<float,2>{0.647207916f, 0.883511484f},
-std::array<float,2>{0.258218646f, 0.261361629f},
-std::array<float,2>{0.72742933f, 0.155913338f},
-std::array<float,2>{0.327579081f, 0.509706855f},
-std::array<float,2>{0.904716432f, 0.850188553f},
-std::array<float,2>{0.180436641f, 0.489243716f},
-std::array<float,2>{0.871670961f, 0.369641572f},
-std::array<float,2>{0.0449759737f, 0.968646646f},
-std::array<float,2>{0.616278112f, 0.700652063f},
-std::array<float,2>{0.436181575f, 0.0232260264f},
-std::array<float,2>{0.665057063f, 0.309347749f},
-std::array<float,2>{0.30686605f, 0.932744026f},
-std::array<float,2>{0.983345807f, 0.684293628f},
-std::array<float,2>{0.241563693f, 0.101786502f},
-std::array<float,2>{0.761456311f, 0.20199658f},
-std::array<float,2>{0.0705852658f, 0.576950371f},
-std::array<float,2>{0.530506611f, 0.754723668f},
-std::array<float,2>{0.499345064f, 0.3869102f},
-std::array<float,2>{0.592055798f, 0.0498244576f},
-std::array<float,2>{0.397449344f, 0.741894662f},
-std::array<float,2>{0.821125865f, 0.992867112f},
-std::array<float,2>{0.00571348052f, 0.343639821f},
-std::array<float,2>{0.914257228f, 0.448159963f},
-std::array<float,2>{0.132457048f, 0.838179767f},
-std::array<float,2>{0.688030064f, 0.532435834f},
-std::array<float,2>{0.368736655f, 0.185948431f},
-std::array<float,2>{0.607646585f, 0.326292008f},
-std::array<float,2>{0.411413431f, 0.969199061f},
-std::array<float,2>{0.84738481f, 0.726742327f},
-std::array<float,2>{0.0471952781f, 0.0392934531f},
-std::array<float,2>{0.879375637f, 0.162644744f},
-std::array<float,2>{0.171352074f, 0.561374307f},
-std::array<float,2>{0.738896608f, 0.827013314f},
-std::array<float,2>{0.328754514f, 0.46469453f},
-std::array<float,2>{0.625743508f, 0.119523115f},
-std::array<float,2>{0.27382049f, 0.663322926f},
-std::array<float,2>{0.948693871f, 0.917110384f},
-std::array<float,2>{0.211269259f, 0.289908856f},
-std::array<float,2>{0.791697383f, 0.394043416f},
-std::array<float,2>{0.115297385f, 0.768521607f},
-std::array<float,2>{0.536913395f, 0.579766631f},
-std::array<float,2>{0.460276663f, 0.205327094f},
-std::array<float,2>{0.706285357f, 0.481684536f},
-std::array<float,2>{0.34883368f, 0.865999877f},
-std::array<float,2>{0.936321378f, 0.527074039f},
-std::array<float,2>{0.146661073f, 0.130895734f},
-std::array<float,2>{0.8393206f, 0.00792008732f},
-std::array<float,2>{0.0199067257f, 0.71495682f},
-std::array<float,2>{0.571034729f, 0.944819748f},
-std::array<float,2>{0.381007075f, 0.349326491f},
-std::array<float,2>{0.515583396f, 0.220401123f},
-std::array<float,2>{0.475223839f, 0.615769148f},
-std::array<float,2>{0.77552402f, 0.791564882f},
-std::array<float,2>{0.0847801417f, 0.436775893f},
-std::array<float,2>{0.987731099f, 0.266056687f},
-std::array<float,2>{0.224196598f, 0.905934513f},
-std::array<float,2>{0.686911404f, 0.637958705f},
-std::array<float,2>{0.286748886f, 0.068447575f},
-std::array<float,2>{0.58379823f, 0.39796865f},
-std::array<float,2>{0.404029191f, 0.772452176f},
-std::array<float,2>{0.81464535f, 0.58259207f},
-std::array<float,2>{0.0143264038f, 0.207170784f},
-std::array<float,2>{0.908848524f, 0.12441051f},
-std::array<float,2>{0.133874014f, 0.65849191f},
-std::array<float,2>{0.702127039f, 0.918308437f},
-std::array<float,2>{0.359917074f, 0.293894142f},
-std::array<float,2>{0.658404291f, 0.159433752f},
-std::array<float,2>{0.297284961f, 0.554724574f},
-std::array<float,2>{0.969684422f, 0.824186146f},
-std::array<float,2>{0.249040961f, 0.465316206f},
-std::array<float,2>{0.756356597f, 0.323135853f},
-std::array<float,2>{0.0689508617f, 0.973765194f},
-std::array<float,2>{0.521382213f, 0.731757522f},
-std::array<float,2>{0.491625816f, 0.0458165891f},
-std::array<float,2>{0.725368083f, 0.270371914f},
-std::array<float,2>{0.317354381f, 0.900484383f},
-std::array<float,2>{0.896374822f, 0.63522929f},
-std::array<float,2>{0.174182788f, 0.0661906749f},
-std::array<float,2>{0.862514555f, 0.22389321f},
-std::array<float,2>{0.0329974368f, 0.611133814f},
-std::array<float,2>{0.619879723f, 0.794359028f},
-std::array<float,2>{0.422840208f, 0.432311565f},
-std::array<float,2>{0.561596751f, 0.0139386216f},
-std::array<float,2>{0.450882971f, 0.712921023f},
-std::array<float,2>{0.804059386f, 0.941216111f},
-std::array<float,2>{0.102509424f, 0.344128072f},
-std::array<float,2>{0.965561748f, 0.477858961f},
-std::array<float,2>{0.196761355f, 0.861655593f},
-std::array<float,2>{0.651930511f, 0.531114578f},
-std::array<float,2>{0.253135473f, 0.128414199f},
-std::array<float,2>{0.502593219f, 0.373954743f},
-std::array<float,2>{0.478140503f, 0.964255631f},
-std::array<float,2>{0.767944038f, 0.697206378f},
-std::array<float,2>{0.0906157643f, 0.0171416048f},
-std::array<float,2>{0.994041741f, 0.151981547f},
-std::array<float,2>{0.227626428f, 0.513480365f},
-std::array<float,2>{0.676339328f, 0.845651805f},
-std::array<float,2>{0.293909311f, 0.486539125f},
-std::array<float,2>{0.713188052f, 0.0801442042f},
-std::array<float,2>{0.358340532f, 0.655036807f},
-std::array<float,2>{0.924066067f, 0.88921088f},
-std::array<float,2>{0.154059783f, 0.263527662f},
-std::array<float,2>{0.828877032f, 0.41123876f},
-std::array<float,2>{0.0295379907f, 0.812301278f},
-std::array<float,2>{0.563483f, 0.600683212f},
-std::array<float,2>{0.387691051f, 0.24155204f},
-std::array<float,2>{0.639301121f, 0.450609952f},
-std::array<float,2>{0.271355033f, 0.842966437f},
-std::array<float,2>{0.94118768f, 0.538882256f},
-std::array<float,2>{0.204533935f, 0.181348309f},
-std::array<float,2>{0.784401357f, 0.0516582243f},
-std::array<float,2>{0.121826909f, 0.734924674f},
-std::array<float,2>{0.541871846f, 0.999078512f},
-std::array<float,2>{0.461567312f, 0.337611049f},
-std::array<float,2>{0.598669231f, 0.197248593f},
-std::array<float,2>{0.414657801f, 0.571593761f},
-std::array<float,2>{0.853349924f, 0.752459526f},
-std::array<float,2>{0.0586601719f, 0.384436607f},
-std::array<float,2>{0.88385725f, 0.306193948f},
-std::array<float,2>{0.159013763f, 0.935557902f},
-std::array<float,2>{0.744468033f, 0.680584669f},
-std::array<float,2>{0.342440635f, 0.107009679f},
-std::array<float,2>{0.534202516f, 0.496629149f},
-std::array<float,2>{0.45628342f, 0.854062498f},
-std::array<float,2>{0.795591176f, 0.50240624f},
-std::array<float,2>{0.112079777f, 0.14429307f},
-std::array<float,2>{0.951514721f, 0.0259952359f},
-std::array<float,2>{0.216275454f, 0.690053523f},
-std::array<float,2>{0.632081211f, 0.957730711f},
-std::array<float,2>{0.278849781f, 0.360826254f},
-std::array<float,2>{0.735663891f, 0.243965164f},
-std::array<float,2>{0.334784657f, 0.603900671f},
-std::array<float,2>{0.875056088f, 0.79946202f},
-std::array<float,2>{0.167716265f, 0.415019602f},
-std::array<float,2>{0.849025667f, 0.257724285f},
-std::array<float,2>{0.0532916524f, 0.875574231f},
-std::array<float,2>{0.603751779f, 0.64161855f},
-std::array<float,2>{0.410118252f, 0.0927480906f},
-std::array<float,2>{0.681735635f, 0.334634066f},
-std::array<float,2>{0.281474143f, 0.98808074f},
-std::array<float,2>{0.989157796f, 0.74345392f},
-std::array<float,2>{0.219528064f, 0.0618619099f},
-std::array<float,2>{0.780281246f, 0.173667699f},
-std::array<float,2>{0.0789541677f, 0.539930642f},
-std::array<float,2>{0.509461164f, 0.833077729f},
-std::array<float,2>{0.471111864f, 0.441928208f},
-std::array<float,2>{0.576348066f, 0.0975026786f},
-std::array<float,2>{0.378273934f, 0.67932117f},
-std::array<float,2>{0.841444194f, 0.928406656f},
-std::array<float,2>{0.018685868f, 0.303703517f},
-std::array<float,2>{0.93290621f, 0.380834043f},
-std::array<float,2>{0.143324256f, 0.76445353f},
-std::array<float,2>{0.708498001f, 0.56390214f},
-std::array<float,2>{0.346044928f, 0.189719692f},
-std::array<float,2>{0.613019228f, 0.286400199f},
-std::array<float,2>{0.43346253f, 0.906485498f},
-std::array<float,2>{0.871015549f, 0.670668602f},
-std::array<float,2>{0.0393924527f, 0.115865365f},
-std::array<float,2>{0.899711251f, 0.218337417f},
-std::array<float,2>{0.187276408f, 0.5873698f},
-std::array<float,2>{0.73107183f, 0.780606568f},
-std::array<float,2>{0.323627651f, 0.401688695f},
-std::array<float,2>{0.644245863f, 0.0340060778f},
-std::array<float,2>{0.264545083f, 0.721934736f},
-std::array<float,2>{0.958524585f, 0.977591157f},
-std::array<float,2>{0.193536311f, 0.316048235f},
-std::array<float,2>{0.807640433f, 0.457348377f},
-std::array<float,2>{0.094178021f, 0.815212786f},
-std::array<float,2>{0.547754109f, 0.550319374f},
-std::array<float,2>{0.442829251f, 0.164892748f},
-std::array<float,2>{0.693176568f, 0.428450078f},
-std::array<float,2>{0.373368621f, 0.784374356f},
-std::array<float,2>{0.918101251f, 0.624393523f},
-std::array<float,2>{0.127696052f, 0.228901938f},
-std::array<float,2>{0.827296257f, 0.0746994317f},
-std::array<float,2>{0.00371014467f, 0.631560683f},
-std::array<float,2>{0.587374151f, 0.89520365f},
-std::array<float,2>{0.392730564f, 0.276650757f},
-std::array<float,2>{0.525451601f, 0.134907335f},
-std::array<float,2>{0.495193988f, 0.520311952f},
-std::array<float,2>{0.765094221f, 0.868545115f},
-std::array<float,2>{0.0752587244f, 0.475122541f},
-std::array<float,2>{0.980438471f, 0.357376039f},
-std::array<float,2>{0.237887278f, 0.948744237f},
-std::array<float,2>{0.669135749f, 0.710031509f},
-std::array<float,2>{0.312053949f, 0.00586790452f},
-std::array<float,2>{0.605810404f, 0.464016855f},
-std::array<float,2>{0.413921654f, 0.826381087f},
-std::array<float,2>{0.845563412f, 0.56068486f},
-std::array<float,2>{0.049646087f, 0.162211612f},
-std::array<float,2>{0.881345868f, 0.0396015272f},
-std::array<float,2>{0.169276953f, 0.72707206f},
-std::array<float,2>{0.741284072f, 0.969424188f},
-std::array<float,2>{0.330388159f, 0.326743543f},
-std::array<float,2>{0.628200591f, 0.205699518f},
-std::array<float,2>{0.276518315f, 0.579284966f},
-std::array<float,2>{0.945787966f, 0.767924368f},
-std::array<float,2>{0.213475183f, 0.393817812f},
-std::array<float,2>{0.790869296f, 0.289518297f},
-std::array<float,2>{0.114243388f, 0.91781193f},
-std::array<float,2>{0.537761033f, 0.663681328f},
-std::array<float,2>{0.458631426f, 0.120018497f},
-std::array<float,2>{0.704228759f, 0.349030346f},
-std::array<float,2>{0.351316839f, 0.945042253f},
-std::array<float,2>{0.93404007f, 0.71580559f},
-std::array<float,2>{0.145872116f, 0.00862163864f},
-std::array<float,2>{0.837012053f, 0.131822243f},
-std::array<float,2>{0.0218959711f, 0.526560724f},
-std::array<float,2>{0.574128687f, 0.865640461f},
-std::array<float,2>{0.379889399f, 0.482347369f},
-std::array<float,2>{0.512007296f, 0.0690702125f},
-std::array<float,2>{0.473931938f, 0.638239264f},
-std::array<float,2>{0.774699032f, 0.905295432f},
-std::array<float,2>{0.0830643997f, 0.266160339f},
-std::array<float,2>{0.984878004f, 0.437492758f},
-std::array<float,2>{0.224927515f, 0.791188002f},
-std::array<float,2>{0.684471428f, 0.615662456f},
-std::array<float,2>{0.288569272f, 0.219930381f},
-std::array<float,2>{0.553376138f, 0.260840446f},
-std::array<float,2>{0.44012621f, 0.883263171f},
-std::array<float,2>{0.812280178f, 0.652097642f},
-std::array<float,2>{0.10151165f, 0.0838171467f},
-std::array<float,2>{0.955516815f, 0.235724509f},
-std::array<float,2>{0.188923717f, 0.596878231f},
-std::array<float,2>{0.645770967f, 0.806168199f},
-std::array<float,2>{0.260127038f, 0.406815708f},
-std::array<float,2>{0.730339885f, 0.0228428598f},
-std::array<float,2>{0.324287027f, 0.701147616f},
-std::array<float,2>{0.904233873f, 0.967985809f},
-std::array<float,2>{0.181852967f, 0.369296879f},
-std::array<float,2>{0.873186588f, 0.488476485f},
-std::array<float,2>{0.0431759208f, 0.849891424f},
-std::array<float,2>{0.614704609f, 0.509250045f},
-std::array<float,2>{0.433945715f, 0.155672133f},
-std::array<float,2>{0.66763562f, 0.387326896f},
-std::array<float,2>{0.305526555f, 0.75392276f},
-std::array<float,2>{0.982156634f, 0.576186001f},
-std::array<float,2>{0.238846511f, 0.201531291f},
-std::array<float,2>{0.758395553f, 0.102400728f},
-std::array<float,2>{0.0731725842f, 0.683808625f},
-std::array<float,2>{0.52767545f, 0.933457851f},
-std::array<float,2>{0.496123791f, 0.308962405f},
-std::array<float,2>{0.590775073f, 0.186152235f},
-std::array<float,2>{0.395532072f, 0.5329054f},
-std::array<float,2>{0.823206425f, 0.838756919f},
-std::array<float,2>{0.0068616569f, 0.447711557f},
-std::array<float,2>{0.917283237f, 0.342822582f},
-std::array<float,2>{0.129143372f, 0.99262625f},
-std::array<float,2>{0.689947784f, 0.741611063f},
-std::array<float,2>{0.369732797f, 0.0503262356f},
-std::array<float,2>{0.517779827f, 0.419675022f},
-std::array<float,2>{0.486332238f, 0.801809251f},
-std::array<float,2>{0.753394186f, 0.608285666f},
-std::array<float,2>{0.0627462193f, 0.24797678f},
-std::array<float,2>{0.972921073f, 0.0860705972f},
-std::array<float,2>{0.245696887f, 0.646496892f},
-std::array<float,2>{0.662190914f, 0.880328417f},
-std::array<float,2>{0.304049194f, 0.251321137f},
-std::array<float,2>{0.697606802f, 0.148421958f},
-std::array<float,2>{0.366295189f, 0.504326046f},
-std::array<float,2>{0.912319183f, 0.85812223f},
-std::array<float,2>{0.137021974f, 0.49565497f},
-std::array<float,2>{0.819813311f, 0.3661246f},
-std::array<float,2>{0.010883498f, 0.954791725f},
-std::array<float,2>{0.581986845f, 0.693581522f},
-std::array<float,2>{0.402171016f, 0.0277823918f},
-std::array<float,2>{0.652580619f, 0.299665868f},
-std::array<float,2>{0.255333513f, 0.925090075f},
-std::array<float,2>{0.963644922f, 0.673585296f},
-std::array<float,2>{0.199863493f, 0.0990976766f},
-std::array<float,2>{0.799402654f, 0.194232568f},
-std::array<float,2>{0.105956964f, 0.567038417f},
-std::array<float,2>{0.557740986f, 0.759150505f},
-std::array<float,2>{0.445531517f, 0.376537859f},
-std::array<float,2>{0.624045491f, 0.0567878596f},
-std::array<float,2>{0.42950955f, 0.746243298f},
-std::array<float,2>{0.863405228f, 0.991126239f},
-std::array<float,2>{0.0387834199f, 0.331017166f},
-std::array<float,2>{0.891878963f, 0.437909096f},
-std::array<float,2>{0.179269627f, 0.830950499f},
-std::array<float,2>{0.721170127f, 0.546211123f},
-std::array<float,2>{0.312575251f, 0.178762376f},
-std::array<float,2>{0.569017768f, 0.31856066f},
-std::array<float,2>{0.382916123f, 0.981708884f},
-std::array<float,2>{0.833509624f, 0.725529194f},
-std::array<float,2>{0.0239319317f, 0.0385774598f},
-std::array<float,2>{0.929300189f, 0.17119053f},
-std::array<float,2>{0.151541367f, 0.553347766f},
-std::array<float,2>{0.717801332f, 0.818363428f},
-std::array<float,2>{0.35234639f, 0.456240773f},
-std::array<float,2>{0.672037661f, 0.111684777f},
-std::array<float,2>{0.289067626f, 0.666424274f},
-std::array<float,2>{0.999855459f, 0.911638558f},
-std::array<float,2>{0.23276417f, 0.28157866f},
-std::array<float,2>{0.772643149f, 0.403104872f},
-std::array<float,2>{0.0883118585f, 0.775707066f},
-std::array<float,2>{0.50473088f, 0.593366742f},
-std::array<float,2>{0.481199056f, 0.212984756f},
-std::array<float,2>{0.747293949f, 0.468901813f},
-std::array<float,2>{0.336236477f, 0.873724222f},
-std::array<float,2>{0.888810396f, 0.516715288f},
-std::array<float,2>{0.161082149f, 0.137965575f},
-std::array<float,2>{0.858966231f, 0.000423094461f},
-std::array<float,2>{0.0558886826f, 0.706767797f},
-std::array<float,2>{0.597593367f, 0.950840354f},
-std::array<float,2>{0.418590516f, 0.353669345f},
-std::array<float,2>{0.546475708f, 0.231792033f},
-std::array<float,2>{0.467184395f, 0.618952632f},
-std::array<float,2>{0.785516381f, 0.786628723f},
-std::array<float,2>{0.118476056f, 0.421902448f},
-std::array<float,2>{0.941781044f, 0.281105042f},
-std::array<float,2>{0.207084566f, 0.892821312f},
-std::array<float,2>{0.633919179f, 0.626998603f},
-std::array<float,2>{0.266042382f, 0.0716881305f},
-std::array<float,2>{0.618353426f, 0.429698884f},
-std::array<float,2>{0.424861491f, 0.795938015f},
-std::array<float,2>{0.860204279f, 0.611919045f},
-std::array<float,2>{0.0342697836f, 0.226098523f},
-std::array<float,2>{0.897463977f, 0.0626880378f},
-std::array<float,2>{0.17300193f, 0.633621633f},
-std::array<float,2>{0.723621309f, 0.899047852f},
-std::array<float,2>{0.318775475f, 0.272312164f},
-std::array<float,2>{0.649787128f, 0.125350669f},
-std::array<float,2>{0.251442015f, 0.528410137f},
-std::array<float,2>{0.968141198f, 0.861228287f},
-std::array<float,2>{0.19843626f, 0.479807138f},
-std::array<float,2>{0.802455246f, 0.346300632f},
-std::array<float,2>{0.103693157f, 0.938034952f},
-std::array<float,2>{0.55937928f, 0.712248445f},
-std::array<float,2>{0.452620745f, 0.0122329406f},
-std::array<float,2>{0.700945973f, 0.296629786f},
-std::array<float,2>{0.363102555f, 0.921592236f},
-std::array<float,2>{0.9074862f, 0.657010436f},
-std::array<float,2>{0.135244727f, 0.122585341f},
-std::array<float,2>{0.814192474f, 0.210849836f},
-std::array<float,2>{0.0134105422f, 0.584774911f},
-std::array<float,2>{0.585170686f, 0.771438479f},
-std::array<float,2>{0.405290157f, 0.395977378f},
-std::array<float,2>{0.522951901f, 0.0430071615f},
-std::array<float,2>{0.490105271f, 0.73275125f},
-std::array<float,2>{0.755351186f, 0.974727929f},
-std::array<float,2>{0.0669954717f, 0.321130931f},
-std::array<float,2>{0.971419036f, 0.467556536f},
-std::array<float,2>{0.247698009f, 0.820418119f},
-std::array<float,2>{0.656748474f, 0.557884216f},
-std::array<float,2>{0.299328387f, 0.157192394f},
-std::array<float,2>{0.540976405f, 0.339585274f},
-std::array<float,2>{0.464353383f, 0.996227026f},
-std::array<float,2>{0.78261739f, 0.736661315f},
-std::array<float,2>{0.123083927f, 0.0541791692f},
-std::array<float,2>{0.937677324f, 0.182454661f},
-std::array<float,2>{0.205330342f, 0.535402358f},
-std::array<float,2>{0.638593733f, 0.840793967f},
-std::array<float,2>{0.27171272f, 0.451439857f},
-std::array<float,2>{0.743154407f, 0.107724652f},
-std::array<float,2>{0.340597838f, 0.682765365f},
-std::array<float,2>{0.885726392f, 0.934381783f},
-std::array<float,2>{0.156950638f, 0.308348447f},
-std::array<float,2>{0.854884267f, 0.385119706f},
-std::array<float,2>{0.0621163398f, 0.751749873f},
-std::array<float,2>{0.60060674f, 0.574049771f},
-std::array<float,2>{0.416136146f, 0.198679343f},
-std::array<float,2>{0.677821994f, 0.485060334f},
-std::array<float,2>{0.295683414f, 0.847428918f},
-std::array<float,2>{0.994338632f, 0.514313996f},
-std::array<float,2>{0.230342254f, 0.148852691f},
-std::array<float,2>{0.767484844f, 0.0176170785f},
-std::array<float,2>{0.0934089124f, 0.698884189f},
-std::array<float,2>{0.500130415f, 0.961552858f},
-std::array<float,2>{0.480313838f, 0.371920019f},
-std::array<float,2>{0.566360891f, 0.238531962f},
-std::array<float,2>{0.390092194f, 0.598248243f},
-std::array<float,2>{0.830081463f, 0.809669197f},
-std::array<float,2>{0.028959401f, 0.412269056f},
-std::array<float,2>{0.923257411f, 0.264206797f},
-std::array<float,2>{0.154740125f, 0.887805521f},
-std::array<float,2>{0.711142182f, 0.653854728f},
-std::array<float,2>{0.356250048f, 0.078168869f},
-std::array<float,2>{0.511576056f, 0.444028616f},
-std::array<float,2>{0.469441533f, 0.834573328f},
-std::array<float,2>{0.778965712f, 0.54118371f},
-std::array<float,2>{0.0820130333f, 0.173888132f},
-std::array<float,2>{0.990458131f, 0.0598072708f},
-std::array<float,2>{0.220707208f, 0.745347381f},
-std::array<float,2>{0.680737913f, 0.985812366f},
-std::array<float,2>{0.283439368f, 0.33261171f},
-std::array<float,2>{0.710784495f, 0.188270405f},
-std::array<float,2>{0.34409672f, 0.564920008f},
-std::array<float,2>{0.931372523f, 0.763063967f},
-std::array<float,2>{0.141649738f, 0.381969452f},
-std::array<float,2>{0.841903746f, 0.301424861f},
-std::array<float,2>{0.0159978792f, 0.927099288f},
-std::array<float,2>{0.575272858f, 0.676294982f},
-std::array<float,2>{0.376782864f, 0.0955034047f},
-std::array<float,2>{0.629052937f, 0.361453444f},
-std::array<float,2>{0.27980116f, 0.959882438f},
-std::array<float,2>{0.949931324f, 0.68842268f},
-std::array<float,2>{0.21756959f, 0.0241312608f},
-std::array<float,2>{0.793269336f, 0.140810966f},
-std::array<float,2>{0.110977776f, 0.501207352f},
-std::array<float,2>{0.531543374f, 0.852123499f},
-std::array<float,2>{0.453703225f, 0.498842567f},
-std::array<float,2>{0.602427006f, 0.0903200805f},
-std::array<float,2>{0.407620937f, 0.644321263f},
-std::array<float,2>{0.850813091f, 0.877328813f},
-std::array<float,2>{0.0526990443f, 0.255116016f},
-std::array<float,2>{0.877100527f, 0.417756706f},
-std::array<float,2>{0.165822566f, 0.798259854f},
-std::array<float,2>{0.736382544f, 0.601943076f},
-std::array<float,2>{0.332635909f, 0.245387957f},
-std::array<float,2>{0.588639021f, 0.273779184f},
-std::array<float,2>{0.392437667f, 0.896534562f},
-std::array<float,2>{0.824975371f, 0.629699767f},
-std::array<float,2>{0.000908963848f, 0.0771673545f},
-std::array<float,2>{0.921006441f, 0.226595387f},
-std::array<float,2>{0.1251726f, 0.622024775f},
-std::array<float,2>{0.694476962f, 0.782367468f},
-std::array<float,2>{0.371217281f, 0.427064061f},
-std::array<float,2>{0.670607746f, 0.0046519395f},
-std::array<float,2>{0.310288191f, 0.707638741f},
-std::array<float,2>{0.978058755f, 0.946926773f},
-std::array<float,2>{0.235625669f, 0.358327866f},
-std::array<float,2>{0.763071716f, 0.472809345f},
-std::array<float,2>{0.0766263753f, 0.870127499f},
-std::array<float,2>{0.524431109f, 0.522145331f},
-std::array<float,2>{0.493872374f, 0.133334458f},
-std::array<float,2>{0.732845783f, 0.399602592f},
-std::array<float,2>{0.32152161f, 0.778050125f},
-std::array<float,2>{0.90222615f, 0.589802742f},
-std::array<float,2>{0.185207754f, 0.215957433f},
-std::array<float,2>{0.869052887f, 0.113342851f},
-std::array<float,2>{0.041667901f, 0.668826997f},
-std::array<float,2>{0.610440552f, 0.908932388f},
-std::array<float,2>{0.430077732f, 0.288926184f},
-std::array<float,2>{0.549460292f, 0.166330189f},
-std::array<float,2>{0.443650484f, 0.547802269f},
-std::array<float,2>{0.805872917f, 0.813187778f},
-std::array<float,2>{0.0969736427f, 0.459970891f},
-std::array<float,2>{0.960587442f, 0.313116193f},
-std::array<float,2>{0.192845196f, 0.978634298f},
-std::array<float,2>{0.641494691f, 0.71892637f},
-std::array<float,2>{0.263127059f, 0.0319148526f},
-std::array<float,2>{0.570514262f, 0.48376444f},
-std::array<float,2>{0.381365001f, 0.863533199f},
-std::array<float,2>{0.839549959f, 0.524035931f},
-std::array<float,2>{0.0204959456f, 0.130438864f},
-std::array<float,2>{0.935774267f, 0.00982143357f},
-std::array<float,2>{0.147402242f, 0.716968238f},
-std::array<float,2>{0.706585228f, 0.941653967f},
-std::array<float,2>{0.349152654f, 0.351348072f},
-std::array<float,2>{0.687303483f, 0.222410381f},
-std::array<float,2>{0.286381006f, 0.614543319f},
-std::array<float,2>{0.987987638f, 0.789984643f},
-std::array<float,2>{0.224061012f, 0.433646023f},
-std::array<float,2>{0.776222765f, 0.26853171f},
-std::array<float,2>{0.0842266157f, 0.904015243f},
-std::array<float,2>{0.514691949f, 0.639970243f},
-std::array<float,2>{0.474755943f, 0.067189604f},
-std::array<float,2>{0.73863554f, 0.325593263f},
-std::array<float,2>{0.328612149f, 0.971241832f},
-std::array<float,2>{0.879553199f, 0.7285344f},
-std::array<float,2>{0.171773478f, 0.0424439274f},
-std::array<float,2>{0.847049117f, 0.161109731f},
-std::array<float,2>{0.0478065126f, 0.559147477f},
-std::array<float,2>{0.608153284f, 0.824548244f},
-std::array<float,2>{0.411968917f, 0.461793482f},
-std::array<float,2>{0.536180258f, 0.118317708f},
-std::array<float,2>{0.460743189f, 0.66054517f},
-std::array<float,2>{0.791345477f, 0.915572107f},
-std::array<float,2>{0.115765564f, 0.291020066f},
-std::array<float,2>{0.948795497f, 0.391021073f},
-std::array<float,2>{0.211604595f, 0.767262042f},
-std::array<float,2>{0.625077546f, 0.581092954f},
-std::array<float,2>{0.274197161f, 0.204062372f},
-std::array<float,2>{0.530937135f, 0.311398f},
-std::array<float,2>{0.499857396f, 0.931239903f},
-std::array<float,2>{0.760860443f, 0.687406301f},
-std::array<float,2>{0.0710392669f, 0.104858562f},
-std::array<float,2>{0.982660651f, 0.199434325f},
-std::array<float,2>{0.242018446f, 0.574861228f},
-std::array<float,2>{0.665871739f, 0.756300926f},
-std::array<float,2>{0.307419717f, 0.389134079f},
-std::array<float,2>{0.687813163f, 0.0488255545f},
-std::array<float,2>{0.368296027f, 0.739471614f},
-std::array<float,2>{0.914875627f, 0.995104134f},
-std::array<float,2>{0.132113025f, 0.341113955f},
-std::array<float,2>{0.820315421f, 0.446351767f},
-std::array<float,2>{0.00508386781f, 0.836322546f},
-std::array<float,2>{0.592525423f, 0.534888864f},
-std::array<float,2>{0.396522731f, 0.184567407f},
-std::array<float,2>{0.646862209f, 0.409454435f},
-std::array<float,2>{0.258718133f, 0.807243943f},
-std::array<float,2>{0.953802586f, 0.594069064f},
-std::array<float,2>{0.191105813f, 0.237328485f},
-std::array<float,2>{0.80953145f, 0.0846138969f},
-std::array<float,2>{0.0992340297f, 0.648483098f},
-std::array<float,2>{0.55091244f, 0.886198223f},
-std::array<float,2>{0.438648671f, 0.258118778f},
-std::array<float,2>{0.616909742f, 0.153003737f},
-std::array<float,2>{0.435575217f, 0.510241389f},
-std::array<float,2>{0.871150255f, 0.84824729f},
-std::array<float,2>{0.0457297489f, 0.491443008f},
-std::array<float,2>{0.905040741f, 0.367907792f},
-std::array<float,2>{0.179777101f, 0.966627359f},
-std::array<float,2>{0.726737499f, 0.702465951f},
-std::array<float,2>{0.327759057f, 0.0214574318f},
-std::array<float,2>{0.556128561f, 0.378512591f},
-std::array<float,2>{0.449073672f, 0.760415375f},
-std::array<float,2>{0.797389627f, 0.568606675f},
-std::array<float,2>{0.10937465f, 0.192676783f},
-std::array<float,2>{0.961503088f, 0.10031829f},
-std::array<float,2>{0.201633394f, 0.674160063f},
-std::array<float,2>{0.656166971f, 0.921899319f},
-std::array<float,2>{0.25718841f, 0.298690468f},
-std::array<float,2>{0.719684482f, 0.176823556f},
-std::array<float,2>{0.315660805f, 0.544850111f},
-std::array<float,2>{0.892906725f, 0.82907939f},
-std::array<float,2>{0.176559806f, 0.440743387f},
-std::array<float,2>{0.866642892f, 0.329548985f},
-std::array<float,2>{0.0365512595f, 0.990217268f},
-std::array<float,2>{0.621738076f, 0.748298407f},
-std::array<float,2>{0.426825702f, 0.0563282147f},
-std::array<float,2>{0.66122514f, 0.253454268f},
-std::array<float,2>{0.30214709f, 0.881585658f},
-std::array<float,2>{0.974844515f, 0.644935727f},
-std::array<float,2>{0.242833182f, 0.0882039219f},
-std::array<float,2>{0.750027776f, 0.249072671f},
-std::array<float,2>{0.0646844134f, 0.606998324f},
-std::array<float,2>{0.516347945f, 0.802892506f},
-std::array<float,2>{0.486270905f, 0.420255125f},
-std::array<float,2>{0.578662694f, 0.0309590157f},
-std::array<float,2>{0.39915517f, 0.693081617f},
-std::array<float,2>{0.818252385f, 0.95697099f},
-std::array<float,2>{0.00784181338f, 0.365232408f},
-std::array<float,2>{0.912072659f, 0.492537558f},
-std::array<float,2>{0.139227852f, 0.855987012f},
-std::array<float,2>{0.697245002f, 0.507698536f},
-std::array<float,2>{0.363682508f, 0.146132126f},
-std::array<float,2>{0.595385194f, 0.352837473f},
-std::array<float,2>{0.42036128f, 0.952193558f},
-std::array<float,2>{0.856756985f, 0.703598261f},
-std::array<float,2>{0.0581625588f, 0.00336911529f},
-std::array<float,2>{0.887544692f, 0.139226526f},
-std::array<float,2>{0.163866624f, 0.518252134f},
-std::array<float,2>{0.748375833f, 0.871368587f},
-std::array<float,2>{0.3385804f, 0.4722417f},
-std::array<float,2>{0.635896981f, 0.0738503188f},
-std::array<float,2>{0.269210041f, 0.626267731f},
-std::array<float,2>{0.943495333f, 0.891295195f},
-std::array<float,2>{0.209917128f, 0.278086424f},
-std::array<float,2>{0.78744334f, 0.424117863f},
-std::array<float,2>{0.12052004f, 0.787444174f},
-std::array<float,2>{0.543579936f, 0.619455636f},
-std::array<float,2>{0.46539253f, 0.234326363f},
-std::array<float,2>{0.715073526f, 0.453264654f},
-std::array<float,2>{0.354698122f, 0.817337334f},
-std::array<float,2>{0.927062511f, 0.552374363f},
-std::array<float,2>{0.149967238f, 0.168928653f},
-std::array<float,2>{0.833985507f, 0.0354761928f},
-std::array<float,2>{0.0258066431f, 0.722711027f},
-std::array<float,2>{0.567505777f, 0.983026505f},
-std::array<float,2>{0.385821849f, 0.316955209f},
-std::array<float,2>{0.506767333f, 0.212518141f},
-std::array<float,2>{0.48270753f, 0.591703415f},
-std::array<float,2>{0.770942509f, 0.775267184f},
-std::array<float,2>{0.08788573f, 0.404307425f},
-std::array<float,2>{0.99797833f, 0.284978598f},
-std::array<float,2>{0.230670348f, 0.913809955f},
-std::array<float,2>{0.67385149f, 0.66546303f},
-std::array<float,2>{0.291719496f, 0.111042775f},
-std::array<float,2>{0.562930882f, 0.413995415f},
-std::array<float,2>{0.388393372f, 0.809035182f},
-std::array<float,2>{0.829302549f, 0.5991835f},
-std::array<float,2>{0.0309931953f, 0.23950313f},
-std::array<float,2>{0.925672233f, 0.0797809139f},
-std::array<float,2>{0.153092995f, 0.652697384f},
-std::array<float,2>{0.713918209f, 0.887496173f},
-std::array<float,2>{0.35927695f, 0.264789581f},
-std::array<float,2>{0.677630365f, 0.150196299f},
-std::array<float,2>{0.29461357f, 0.515551865f},
-std::array<float,2>{0.99276489f, 0.846527874f},
-std::array<float,2>{0.227099821f, 0.4860093f},
-std::array<float,2>{0.768915594f, 0.37295115f},
-std::array<float,2>{0.0910548195f, 0.962806344f},
-std::array<float,2>{0.503829479f, 0.697891593f},
-std::array<float,2>{0.477162927f, 0.0192346852f},
-std::array<float,2>{0.745634496f, 0.3074314f},
-std::array<float,2>{0.343467087f, 0.934920728f},
-std::array<float,2>{0.883164823f, 0.681812704f},
-std::array<float,2>{0.159584001f, 0.108656034f},
-std::array<float,2>{0.85191673f, 0.197680607f},
-std::array<float,2>{0.0599814691f, 0.572408557f},
-std::array<float,2>{0.598405957f, 0.750294864f},
-std::array<float,2>{0.415687293f, 0.386221558f},
-std::array<float,2>{0.542886734f, 0.053580679f},
-std::array<float,2>{0.462115824f, 0.737871051f},
-std::array<float,2>{0.78386724f, 0.997153759f},
-std::array<float,2>{0.12251506f, 0.338447571f},
-std::array<float,2>{0.940315247f, 0.452840984f},
-std::array<float,2>{0.20353961f, 0.841163337f},
-std::array<float,2>{0.640362561f, 0.536746323f},
-std::array<float,2>{0.269725859f, 0.183515981f},
-std::array<float,2>{0.520101607f, 0.321296394f},
-std::array<float,2>{0.491107106f, 0.975868642f},
-std::array<float,2>{0.757466376f, 0.7343328f},
-std::array<float,2>{0.0699485615f, 0.0449113473f},
-std::array<float,2>{0.970633686f, 0.157558769f},
-std::array<float,2>{0.248864353f, 0.557348788f},
-std::array<float,2>{0.659959137f, 0.821801066f},
-std::array<float,2>{0.298223317f, 0.468255758f},
-std::array<float,2>{0.70239234f, 0.12162897f},
-std::array<float,2>{0.360818595f, 0.65799731f},
-std::array<float,2>{0.910035431f, 0.920405269f},
-std::array<float,2>{0.133449152f, 0.295745462f},
-std::array<float,2>{0.815972388f, 0.395215839f},
-std::array<float,2>{0.0149664497f, 0.770205021f},
-std::array<float,2>{0.582395494f, 0.585679829f},
-std::array<float,2>{0.402963251f, 0.209444195f},
-std::array<float,2>{0.651146293f, 0.479226887f},
-std::array<float,2>{0.252776325f, 0.860325515f},
-std::array<float,2>{0.966793954f, 0.528205097f},
-std::array<float,2>{0.195404634f, 0.126673967f},
-std::array<float,2>{0.803438067f, 0.0127218384f},
-std::array<float,2>{0.10309507f, 0.711342752f},
-std::array<float,2>{0.560665727f, 0.939139307f},
-std::array<float,2>{0.449741691f, 0.347402126f},
-std::array<float,2>{0.620766103f, 0.225322053f},
-std::array<float,2>{0.42339465f, 0.612525225f},
-std::array<float,2>{0.861391485f, 0.795804918f},
-std::array<float,2>{0.0317681357f, 0.431551039f},
-std::array<float,2>{0.894922554f, 0.273285806f},
-std::array<float,2>{0.175269142f, 0.899465322f},
-std::array<float,2>{0.726428747f, 0.634207547f},
-std::array<float,2>{0.317410052f, 0.0641936585f},
-std::array<float,2>{0.548371315f, 0.459908098f},
-std::array<float,2>{0.442148656f, 0.814252436f},
-std::array<float,2>{0.807384372f, 0.548401296f},
-std::array<float,2>{0.0957028493f, 0.167027086f},
-std::array<float,2>{0.957643211f, 0.0323313996f},
-std::array<float,2>{0.195118785f, 0.7201581f},
-std::array<float,2>{0.643170476f, 0.979959071f},
-std::array<float,2>{0.265572369f, 0.313845426f},
-std::array<float,2>{0.731716633f, 0.214914113f},
-std::array<float,2>{0.32302168f, 0.588662624f},
-std::array<float,2>{0.899273515f, 0.778848708f},
-std::array<float,2>{0.186502427f, 0.398489982f},
-std::array<float,2>{0.869687796f, 0.287554383f},
-std::array<float,2>{0.0400904231f, 0.909806192f},
-std::array<float,2>{0.612007439f, 0.669286013f},
-std::array<float,2>{0.432384014f, 0.114677273f},
-std::array<float,2>{0.668195546f, 0.358422607f},
-std::array<float,2>{0.311111212f, 0.945463419f},
-std::array<float,2>{0.978613734f, 0.70877552f},
-std::array<float,2>{0.237297162f, 0.0050158673f},
-std::array<float,2>{0.763873219f, 0.134237111f},
-std::array<float,2>{0.0748410299f, 0.523309052f},
-std::array<float,2>{0.527121365f, 0.869533241f},
-std::array<float,2>{0.494468331f, 0.474114358f},
-std::array<float,2>{0.586798251f, 0.0764235929f},
-std::array<float,2>{0.394209176f, 0.630212545f},
-std::array<float,2>{0.826383233f, 0.897675693f},
-std::array<float,2>{0.00268360926f, 0.275238752f},
-std::array<float,2>{0.91983372f, 0.425834358f},
-std::array<float,2>{0.128602818f, 0.781713188f},
-std::array<float,2>{0.69205606f, 0.622641385f},
-std::array<float,2>{0.374121487f, 0.227741092f},
-std::array<float,2>{0.605333865f, 0.254837245f},
-std::array<float,2>{0.408404529f, 0.878592789f},
-std::array<float,2>{0.84824568f, 0.643206298f},
-std::array<float,2>{0.0543278046f, 0.0909962803f},
-std::array<float,2>{0.87623781f, 0.244322285f},
-std::array<float,2>{0.166204765f, 0.602829874f},
-std::array<float,2>{0.734782815f, 0.797064662f},
-std::array<float,2>{0.335312903f, 0.416063517f},
-std::array<float,2>{0.631017685f, 0.0252725184f},
-std::array<float,2>{0.277643055f, 0.688848555f},
-std::array<float,2>{0.952586293f, 0.960762084f},
-std::array<float,2>{0.214924753f, 0.362989455f},
-std::array<float,2>{0.796245754f, 0.499135256f},
-std::array<float,2>{0.113147989f, 0.853282571f},
-std::array<float,2>{0.533790469f, 0.500511289f},
-std::array<float,2>{0.456046015f, 0.142529681f},
-std::array<float,2>{0.707893789f, 0.380973011f},
-std::array<float,2>{0.347612351f, 0.761739075f},
-std::array<float,2>{0.93192035f, 0.566264868f},
-std::array<float,2>{0.144422159f, 0.188631818f},
-std::array<float,2>{0.839895666f, 0.0941408575f},
-std::array<float,2>{0.018550016f, 0.67678988f},
-std::array<float,2>{0.577175617f, 0.92630589f},
-std::array<float,2>{0.377459675f, 0.302025139f},
-std::array<float,2>{0.508418322f, 0.175543442f},
-std::array<float,2>{0.471964419f, 0.542438388f},
-std::array<float,2>{0.779981792f, 0.835224807f},
-std::array<float,2>{0.0800197721f, 0.445169657f},
-std::array<float,2>{0.989691973f, 0.333862931f},
-std::array<float,2>{0.220272407f, 0.985299468f},
-std::array<float,2>{0.682800949f, 0.744891524f},
-std::array<float,2>{0.28244397f, 0.0591773279f},
-std::array<float,2>{0.613326311f, 0.490413517f},
-std::array<float,2>{0.434789002f, 0.848908067f},
-std::array<float,2>{0.874613285f, 0.511576533f},
-std::array<float,2>{0.0441042408f, 0.153538749f},
-std::array<float,2>{0.902686954f, 0.0200499445f},
-std::array<float,2>{0.183227941f, 0.701568365f},
-std::array<float,2>{0.728842974f, 0.965744197f},
-std::array<float,2>{0.325344473f, 0.368937165f},
-std::array<float,2>{0.645480096f, 0.237163901f},
-std::array<float,2>{0.260967165f, 0.595469773f},
-std::array<float,2>{0.956666231f, 0.808518589f},
-std::array<float,2>{0.187979028f, 0.409070045f},
-std::array<float,2>{0.811064541f, 0.259267569f},
-std::array<float,2>{0.099868238f, 0.88548404f},
-std::array<float,2>{0.554172635f, 0.650117755f},
-std::array<float,2>{0.44082588f, 0.0857292265f},
-std::array<float,2>{0.690475345f, 0.339880317f},
-std::array<float,2>{0.370958537f, 0.995498002f},
-std::array<float,2>{0.91621846f, 0.738957644f},
-std::array<float,2>{0.130044475f, 0.0477559902f},
-std::array<float,2>{0.823690653f, 0.184936598f},
-std::array<float,2>{0.0060432679f, 0.534058332f},
-std::array<float,2>{0.590971947f, 0.837104261f},
-std::array<float,2>{0.395365626f, 0.446169555f},
-std::array<float,2>{0.529044092f, 0.103689574f},
-std::array<float,2>{0.497162133f, 0.686243415f},
-std::array<float,2>{0.759284854f, 0.930241346f},
-std::array<float,2>{0.0739444792f, 0.312496126f},
-std::array<float,2>{0.981003642f, 0.389819086f},
-std::array<float,2>{0.239740774f, 0.757137299f},
-std::array<float,2>{0.666211188f, 0.575710058f},
-std::array<float,2>{0.305677861f, 0.200673342f},
-std::array<float,2>{0.538971901f, 0.292578816f},
-std::array<float,2>{0.457729191f, 0.914856851f},
-std::array<float,2>{0.789169133f, 0.661686242f},
-std::array<float,2>{0.114654899f, 0.117358878f},
-std::array<float,2>{0.946313798f, 0.204539403f},
-std::array<float,2>{0.214838296f, 0.580843389f},
-std::array<float,2>{0.627216697f, 0.766204238f},
-std::array<float,2>{0.275663465f, 0.392131507f},
-std::array<float,2>{0.740532279f, 0.0414377525f},
-std::array<float,2>{0.33200103f, 0.730268538f},
-std::array<float,2>{0.882351637f, 0.972178698f},
-std::array<float,2>{0.1685756f, 0.32445243f},
-std::array<float,2>{0.844474494f, 0.46284762f},
-std::array<float,2>{0.0498201177f, 0.825550437f},
-std::array<float,2>{0.607372761f, 0.559612215f},
-std::array<float,2>{0.412616044f, 0.161968037f},
-std::array<float,2>{0.684974015f, 0.434901386f},
-std::array<float,2>{0.287160635f, 0.791000128f},
-std::array<float,2>{0.985587656f, 0.613503635f},
-std::array<float,2>{0.226297334f, 0.221467212f},
-std::array<float,2>{0.773709238f, 0.0681125298f},
-std::array<float,2>{0.0824609548f, 0.638857305f},
-std::array<float,2>{0.513255656f, 0.902384996f},
-std::array<float,2>{0.473170519f, 0.269072592f},
-std::array<float,2>{0.573149502f, 0.129357889f},
-std::array<float,2>{0.379546344f, 0.524891973f},
-std::array<float,2>{0.836794317f, 0.864889562f},
-std::array<float,2>{0.0231369548f, 0.48265475f},
-std::array<float,2>{0.934853077f, 0.350491166f},
-std::array<float,2>{0.145125896f, 0.942796648f},
-std::array<float,2>{0.703516781f, 0.718028486f},
-std::array<float,2>{0.350280225f, 0.011564062f},
-std::array<float,2>{0.504972637f, 0.405903161f},
-std::array<float,2>{0.48218894f, 0.774056911f},
-std::array<float,2>{0.772132397f, 0.589853227f},
-std::array<float,2>{0.0892325565f, 0.211130857f},
-std::array<float,2>{0.998284876f, 0.109869145f},
-std::array<float,2>{0.234187156f, 0.664768934f},
-std::array<float,2>{0.672960877f, 0.913025498f},
-std::array<float,2>{0.290471733f, 0.284020245f},
-std::array<float,2>{0.717694461f, 0.168959945f},
-std::array<float,2>{0.353438497f, 0.55079174f},
-std::array<float,2>{0.92784363f, 0.817780316f},
-std::array<float,2>{0.150844112f, 0.454525173f},
-std::array<float,2>{0.832772136f, 0.318327516f},
-std::array<float,2>{0.024620939f, 0.983686388f},
-std::array<float,2>{0.569528162f, 0.724347711f},
-std::array<float,2>{0.38403067f, 0.0366119184f},
-std::array<float,2>{0.633624732f, 0.27878955f},
-std::array<float,2>{0.266719401f, 0.891880929f},
-std::array<float,2>{0.942822576f, 0.625681639f},
-std::array<float,2>{0.208832517f, 0.0727172717f},
-std::array<float,2>{0.787003458f, 0.232602313f},
-std::array<float,2>{0.118099898f, 0.620934486f},
-std::array<float,2>{0.545502305f, 0.788384736f},
-std::array<float,2>{0.46816799f, 0.425456405f},
-std::array<float,2>{0.596238673f, 0.00218558521f},
-std::array<float,2>{0.419552177f, 0.704625547f},
-std::array<float,2>{0.857759476f, 0.95206511f},
-std::array<float,2>{0.0550688319f, 0.351842552f},
-std::array<float,2>{0.890136063f, 0.470895946f},
-std::array<float,2>{0.16195114f, 0.873032153f},
-std::array<float,2>{0.746980071f, 0.519129932f},
-std::array<float,2>{0.337623984f, 0.140198275f},
-std::array<float,2>{0.580610037f, 0.363366544f},
-std::array<float,2>{0.400453746f, 0.955932617f},
-std::array<float,2>{0.818440974f, 0.691892922f},
-std::array<float,2>{0.0107318824f, 0.0296464395f},
-std::array<float,2>{0.913603604f, 0.14547044f},
-std::array<float,2>{0.138134256f, 0.506379426f},
-std::array<float,2>{0.698390305f, 0.856482863f},
-std::array<float,2>{0.365601003f, 0.493745655f},
-std::array<float,2>{0.663645685f, 0.089754276f},
-std::array<float,2>{0.303416818f, 0.645730317f},
-std::array<float,2>{0.974282682f, 0.882296145f},
-std::array<float,2>{0.244629309f, 0.252525806f},
-std::array<float,2>{0.752234817f, 0.421481371f},
-std::array<float,2>{0.063836351f, 0.804678917f},
-std::array<float,2>{0.51921767f, 0.605490863f},
-std::array<float,2>{0.487626791f, 0.248876989f},
-std::array<float,2>{0.722130775f, 0.440108448f},
-std::array<float,2>{0.31376493f, 0.829322934f},
-std::array<float,2>{0.891533792f, 0.543085098f},
-std::array<float,2>{0.178108543f, 0.176125079f},
-std::array<float,2>{0.864639163f, 0.0547014214f},
-std::array<float,2>{0.0377434418f, 0.749922395f},
-std::array<float,2>{0.623620987f, 0.988517523f},
-std::array<float,2>{0.428322256f, 0.328331053f},
-std::array<float,2>{0.557127595f, 0.191759393f},
-std::array<float,2>{0.446329653f, 0.569842458f},
-std::array<float,2>{0.800515175f, 0.761266828f},
-std::array<float,2>{0.106450476f, 0.377540022f},
-std::array<float,2>{0.964519083f, 0.297664434f},
-std::array<float,2>{0.200969085f, 0.923306406f},
-std::array<float,2>{0.653768122f, 0.675145149f},
-std::array<float,2>{0.253949374f, 0.100874826f},
-std::array<float,2>{0.599901021f, 0.383444697f},
-std::array<float,2>{0.41771698f, 0.753188848f},
-std::array<float,2>{0.854375124f, 0.570349813f},
-std::array<float,2>{0.06111563f, 0.195335135f},
-std::array<float,2>{0.885867238f, 0.105574638f},
-std::array<float,2>{0.157553196f, 0.681457937f},
-std::array<float,2>{0.743335068f, 0.937282562f},
-std::array<float,2>{0.341090679f, 0.304912657f},
-std::array<float,2>{0.636933327f, 0.180458158f},
-std::array<float,2>{0.273338616f, 0.537520409f},
-std::array<float,2>{0.939020693f, 0.842218816f},
-std::array<float,2>{0.206398159f, 0.449366331f},
-std::array<float,2>{0.782015383f, 0.336827964f},
-std::array<float,2>{0.124410763f, 0.998413622f},
-std::array<float,2>{0.539091885f, 0.735402167f},
-std::array<float,2>{0.463436544f, 0.05198735f},
-std::array<float,2>{0.712593079f, 0.262176782f},
-std::array<float,2>{0.356772006f, 0.889860749f},
-std::array<float,2>{0.922735512f, 0.655488014f},
-std::array<float,2>{0.155278653f, 0.0812712684f},
-std::array<float,2>{0.831557989f, 0.240692765f},
-std::array<float,2>{0.0281087104f, 0.600478709f},
-std::array<float,2>{0.564918697f, 0.810911477f},
-std::array<float,2>{0.388798714f, 0.411041051f},
-std::array<float,2>{0.501036882f, 0.0162503142f},
-std::array<float,2>{0.479394108f, 0.695964158f},
-std::array<float,2>{0.765795231f, 0.963639379f},
-std::array<float,2>{0.0927138776f, 0.374810457f},
-std::array<float,2>{0.995305896f, 0.488117248f},
-std::array<float,2>{0.228875726f, 0.844056368f},
-std::array<float,2>{0.678829193f, 0.512119055f},
-std::array<float,2>{0.296810001f, 0.150588736f},
-std::array<float,2>{0.559911609f, 0.345012397f},
-std::array<float,2>{0.45127967f, 0.939567447f},
-std::array<float,2>{0.80080384f, 0.714151204f},
-std::array<float,2>{0.104787074f, 0.0150648551f},
-std::array<float,2>{0.967097282f, 0.126997903f},
-std::array<float,2>{0.197668254f, 0.53004545f},
-std::array<float,2>{0.648793936f, 0.863084197f},
-std::array<float,2>{0.250324398f, 0.476997733f},
-std::array<float,2>{0.724337935f, 0.0653660521f},
-std::array<float,2>{0.319829941f, 0.636502266f},
-std::array<float,2>{0.897153854f, 0.902209222f},
-std::array<float,2>{0.172408506f, 0.270868361f},
-std::array<float,2>{0.860945523f, 0.432633221f},
-std::array<float,2>{0.0336525105f, 0.793795466f},
-std::array<float,2>{0.617888987f, 0.610006154f},
-std::array<float,2>{0.423863351f, 0.223278925f},
-std::array<float,2>{0.657638669f, 0.466646135f},
-std::array<float,2>{0.300113082f, 0.822903454f},
-std::array<float,2>{0.971850693f, 0.556441188f},
-std::array<float,2>{0.24671486f, 0.158486888f},
-std::array<float,2>{0.753937662f, 0.0463762544f},
-std::array<float,2>{0.0674675256f, 0.730751276f},
-std::array<float,2>{0.521786988f, 0.973182559f},
-std::array<float,2>{0.488938034f, 0.3241404f},
-std::array<float,2>{0.584468186f, 0.208334371f},
-std::array<float,2>{0.405259132f, 0.583964705f},
-std::array<float,2>{0.812774181f, 0.773190081f},
-std::array<float,2>{0.0122635262f, 0.397425801f},
-std::array<float,2>{0.906264961f, 0.294169307f},
-std::array<float,2>{0.13608703f, 0.91906786f},
-std::array<float,2>{0.699640095f, 0.66015029f},
-std::array<float,2>{0.361910075f, 0.123900458f},
-std::array<float,2>{0.524077713f, 0.47648719f},
-std::array<float,2>{0.49306187f, 0.867542148f},
-std::array<float,2>{0.762078345f, 0.520689487f},
-std::array<float,2>{0.0776889622f, 0.136154056f},
-std::array<float,2>{0.976642668f, 0.00757473568f},
-std::array<float,2>{0.234540254f, 0.709489167f},
-std::array<float,2>{0.671099246f, 0.947639525f},
-std::array<float,2>{0.309431881f, 0.356345296f},
-std::array<float,2>{0.694035351f, 0.229498744f},
-std::array<float,2>{0.372745633f, 0.623490453f},
-std::array<float,2>{0.920681f, 0.78403616f},
-std::array<float,2>{0.126255497f, 0.429447502f},
-std::array<float,2>{0.825761259f, 0.275471568f},
-std::array<float,2>{0.00155237957f, 0.896025479f},
-std::array<float,2>{0.589046299f, 0.63239181f},
-std::array<float,2>{0.391167164f, 0.0755936205f},
-std::array<float,2>{0.64186722f, 0.314704597f},
-std::array<float,2>{0.261966974f, 0.977320671f},
-std::array<float,2>{0.959357023f, 0.721031785f},
-std::array<float,2>{0.192246154f, 0.0343166776f},
-std::array<float,2>{0.805045247f, 0.165131956f},
-std::array<float,2>{0.0958606675f, 0.549527705f},
-std::array<float,2>{0.550184548f, 0.815808535f},
-std::array<float,2>{0.44456923f, 0.458477616f},
-std::array<float,2>{0.609932482f, 0.116989285f},
-std::array<float,2>{0.431545973f, 0.671738029f},
-std::array<float,2>{0.867268085f, 0.908035278f},
-std::array<float,2>{0.0424050204f, 0.285877377f},
-std::array<float,2>{0.90077734f, 0.400580078f},
-std::array<float,2>{0.183746621f, 0.779875219f},
-std::array<float,2>{0.733435929f, 0.586319983f},
-std::array<float,2>{0.320725352f, 0.217040509f},
-std::array<float,2>{0.574770331f, 0.304587036f},
-std::array<float,2>{0.37557745f, 0.929385722f},
-std::array<float,2>{0.843094349f, 0.677960515f},
-std::array<float,2>{0.0170560889f, 0.0959548801f},
-std::array<float,2>{0.930497408f, 0.19089365f},
-std::array<float,2>{0.141408995f, 0.562558949f},
-std::array<float,2>{0.70966363f, 0.76485467f},
-std::array<float,2>{0.344948262f, 0.379397541f},
-std::array<float,2>{0.67988658f, 0.0614882931f},
-std::array<float,2>{0.284613162f, 0.74230665f},
-std::array<float,2>{0.991362154f, 0.986529171f},
-std::array<float,2>{0.222613513f, 0.335737467f},
-std::array<float,2>{0.777717769f, 0.442549437f},
-std::array<float,2>{0.0802765414f, 0.832374573f},
-std::array<float,2>{0.510096133f, 0.540053964f},
-std::array<float,2>{0.470414013f, 0.172491357f},
-std::array<float,2>{0.737439692f, 0.415845364f},
-std::array<float,2>{0.333508223f, 0.800083578f},
-std::array<float,2>{0.877941966f, 0.604990363f},
-std::array<float,2>{0.164537877f, 0.242663696f},
-std::array<float,2>{0.849911749f, 0.0935168937f},
-std::array<float,2>{0.0513501242f, 0.641068935f},
-std::array<float,2>{0.603489041f, 0.876689315f},
-std::array<float,2>{0.406891614f, 0.255936086f},
-std::array<float,2>{0.532905042f, 0.143206164f},
-std::array<float,2>{0.454651684f, 0.503503382f},
-std::array<float,2>{0.794093013f, 0.855378687f},
-std::array<float,2>{0.109550945f, 0.497503519f},
-std::array<float,2>{0.950763285f, 0.360161841f},
-std::array<float,2>{0.218731746f, 0.958924592f},
-std::array<float,2>{0.629950583f, 0.690855265f},
-std::array<float,2>{0.280325353f, 0.0269647427f},
-std::array<float,2>{0.593394339f, 0.448758423f},
-std::array<float,2>{0.397654444f, 0.839164197f},
-std::array<float,2>{0.822036684f, 0.531965733f},
-std::array<float,2>{0.00443591038f, 0.18693395f},
-std::array<float,2>{0.915068626f, 0.049636662f},
-std::array<float,2>{0.131384403f, 0.740587652f},
-std::array<float,2>{0.689313829f, 0.993212819f},
-std::array<float,2>{0.367298394f, 0.34184435f},
-std::array<float,2>{0.664917231f, 0.202551469f},
-std::array<float,2>{0.308356524f, 0.577933013f},
-std::array<float,2>{0.983835757f, 0.755607367f},
-std::array<float,2>{0.240585342f, 0.388447434f},
-std::array<float,2>{0.760405481f, 0.309747726f},
-std::array<float,2>{0.0714665204f, 0.932165504f},
-std::array<float,2>{0.529670537f, 0.685525537f},
-std::array<float,2>{0.498064786f, 0.1033841f},
-std::array<float,2>{0.727931559f, 0.371076226f},
-std::array<float,2>{0.326390266f, 0.967601836f},
-std::array<float,2>{0.905961514f, 0.700154066f},
-std::array<float,2>{0.181230277f, 0.0215814076f},
-std::array<float,2>{0.872503638f, 0.154648304f},
-std::array<float,2>{0.0466139577f, 0.508665264f},
-std::array<float,2>{0.615350246f, 0.85130918f},
-std::array<float,2>{0.436702579f, 0.489441097f},
-std::array<float,2>{0.552390516f, 0.0828607157f},
-std::array<float,2>{0.437682658f, 0.650449932f},
-std::array<float,2>{0.810026705f, 0.884507418f},
-std::array<float,2>{0.098474212f, 0.260302067f},
-std::array<float,2>{0.954806864f, 0.408120215f},
-std::array<float,2>{0.1902325f, 0.805594683f},
-std::array<float,2>{0.648089588f, 0.596406281f},
-std::array<float,2>{0.259369254f, 0.235062361f},
-std::array<float,2>{0.514580667f, 0.266885936f},
-std::array<float,2>{0.476555407f, 0.904697478f},
-std::array<float,2>{0.77679193f, 0.636951625f},
-std::array<float,2>{0.0854730308f, 0.0694569796f},
-std::array<float,2>{0.987217307f, 0.219156072f},
-std::array<float,2>{0.222931683f, 0.61655575f},
-std::array<float,2>{0.68603909f, 0.792019367f},
-std::array<float,2>{0.285794079f, 0.436044395f},
-std::array<float,2>{0.70525974f, 0.00975607708f},
-std::array<float,2>{0.348606467f, 0.716307282f},
-std::array<float,2>{0.936797202f, 0.944327712f},
-std::array<float,2>{0.147914037f, 0.348350286f},
-std::array<float,2>{0.838009834f, 0.481150746f},
-std::array<float,2>{0.0208326112f, 0.866665244f},
-std::array<float,2>{0.571959555f, 0.525651872f},
-std::array<float,2>{0.382287532f, 0.132044449f},
-std::array<float,2>{0.626021028f, 0.39307794f},
-std::array<float,2>{0.275146186f, 0.768718123f},
-std::array<float,2>{0.947993517f, 0.578212678f},
-std::array<float,2>{0.212611228f, 0.206704929f},
-std::array<float,2>{0.792121291f, 0.120794185f},
-std::array<float,2>{0.117138751f, 0.662611127f},
-std::array<float,2>{0.536131442f, 0.916700065f},
-std::array<float,2>{0.459624797f, 0.290119857f},
-std::array<float,2>{0.608405948f, 0.163725093f},
-std::array<float,2>{0.41036132f, 0.562242866f},
-std::array<float,2>{0.845976651f, 0.827916503f},
-std::array<float,2>{0.0480359755f, 0.463694751f},
-std::array<float,2>{0.880233049f, 0.327403456f},
-std::array<float,2>{0.170284614f, 0.970561206f},
-std::array<float,2>{0.739572823f, 0.727704227f},
-std::array<float,2>{0.329835266f, 0.0404845998f},
-std::array<float,2>{0.544056058f, 0.423377126f},
-std::array<float,2>{0.465976775f, 0.786097825f},
-std::array<float,2>{0.788867116f, 0.617990553f},
-std::array<float,2>{0.119547375f, 0.231084391f},
-std::array<float,2>{0.944911063f, 0.0704632401f},
-std::array<float,2>{0.210140571f, 0.627957344f},
-std::array<float,2>{0.635531604f, 0.894486308f},
-std::array<float,2>{0.268377602f, 0.279726833f},
-std::array<float,2>{0.749103785f, 0.137083083f},
-std::array<float,2>{0.339102656f, 0.516214252f},
-std::array<float,2>{0.888486862f, 0.874601066f},
-std::array<float,2>{0.162770689f, 0.47067982f},
-std::array<float,2>{0.855543077f, 0.354868174f},
-std::array<float,2>{0.0567604154f, 0.949376822f},
-std::array<float,2>{0.594153583f, 0.705261409f},
-std::array<float,2>{0.420945257f, 0.00102192373f},
-std::array<float,2>{0.675468087f, 0.282438397f},
-std::array<float,2>{0.292558581f, 0.911077678f},
-std::array<float,2>{0.996550262f, 0.667074382f},
-std::array<float,2>{0.232369006f, 0.112472065f},
-std::array<float,2>{0.77018249f, 0.214730456f},
-std::array<float,2>{0.0866364911f, 0.592344582f},
-std::array<float,2>{0.506841123f, 0.776719987f},
-std::array<float,2>{0.483905971f, 0.40428704f},
-std::array<float,2>{0.566698968f, 0.0380272418f},
-std::array<float,2>{0.384980112f, 0.726481318f},
-std::array<float,2>{0.835337579f, 0.981311977f},
-std::array<float,2>{0.0266549177f, 0.320308119f},
-std::array<float,2>{0.926707268f, 0.455764383f},
-std::array<float,2>{0.149008945f, 0.820049167f},
-std::array<float,2>{0.71614188f, 0.554186046f},
-std::array<float,2>{0.35363856f, 0.170323208f},
-std::array<float,2>{0.622873306f, 0.331102431f},
-std::array<float,2>{0.426016003f, 0.991479278f},
-std::array<float,2>{0.866085649f, 0.747701705f},
-std::array<float,2>{0.0360962823f, 0.0579993539f},
-std::array<float,2>{0.893626809f, 0.178017169f},
-std::array<float,2>{0.177527308f, 0.545894921f},
-std::array<float,2>{0.720484853f, 0.831714749f},
-std::array<float,2>{0.315333605f, 0.438595831f},
-std::array<float,2>{0.654351652f, 0.0977061018f},
-std::array<float,2>{0.256110549f, 0.672359228f},
-std::array<float,2>{0.962539911f, 0.923996925f},
-std::array<float,2>{0.20309487f, 0.300051242f},
-std::array<float,2>{0.798087776f, 0.375429034f},
-std::array<float,2>{0.107455537f, 0.758321106f},
-std::array<float,2>{0.555329144f, 0.568349302f},
-std::array<float,2>{0.448020935f, 0.194812864f},
-std::array<float,2>{0.696171045f, 0.494721085f},
-std::array<float,2>{0.364386648f, 0.858577669f},
-std::array<float,2>{0.910306454f, 0.505536616f},
-std::array<float,2>{0.139661357f, 0.147159964f},
-std::array<float,2>{0.816900253f, 0.0291363187f},
-std::array<float,2>{0.00882798806f, 0.694372833f},
-std::array<float,2>{0.580017388f, 0.95363605f},
-std::array<float,2>{0.400113434f, 0.366871089f},
-std::array<float,2>{0.516803384f, 0.246536762f},
-std::array<float,2>{0.485255092f, 0.608428419f},
-std::array<float,2>{0.751802266f, 0.801023602f},
-std::array<float,2>{0.0662773997f, 0.418169796f},
-std::array<float,2>{0.975952983f, 0.250721276f},
-std::array<float,2>{0.243437111f, 0.878935575f},
-std::array<float,2>{0.660703778f, 0.648254335f},
-std::array<float,2>{0.301334113f, 0.0873488411f},
-std::array<float,2>{0.569706976f, 0.402627438f},
-std::array<float,2>{0.384236485f, 0.775952876f},
-std::array<float,2>{0.832762718f, 0.593009233f},
-std::array<float,2>{0.0248369705f, 0.21376434f},
-std::array<float,2>{0.928067863f, 0.112093881f},
-std::array<float,2>{0.150634006f, 0.666519225f},
-std::array<float,2>{0.717394471f, 0.911477625f},
-std::array<float,2>{0.353027552f, 0.281758964f},
-std::array<float,2>{0.673268259f, 0.171777412f},
-std::array<float,2>{0.290149659f, 0.55290848f},
-std::array<float,2>{0.998485327f, 0.819087684f},
-std::array<float,2>{0.234054953f, 0.456597239f},
-std::array<float,2>{0.772309124f, 0.31909126f},
-std::array<float,2>{0.0890812501f, 0.982076228f},
-std::array<float,2>{0.505216777f, 0.725016654f},
-std::array<float,2>{0.482037961f, 0.0384515859f},
-std::array<float,2>{0.746599495f, 0.280440807f},
-std::array<float,2>{0.337736815f, 0.89352423f},
-std::array<float,2>{0.889677882f, 0.627653122f},
-std::array<float,2>{0.161852866f, 0.0718845129f},
-std::array<float,2>{0.857533634f, 0.232368499f},
-std::array<float,2>{0.05483431f, 0.618369639f},
-std::array<float,2>{0.596660852f, 0.786481321f},
-std::array<float,2>{0.419806331f, 0.422782689f},
-std::array<float,2>{0.545746207f, 0.000490480801f},
-std::array<float,2>{0.467791677f, 0.706075966f},
-std::array<float,2>{0.786770523f, 0.95023942f},
-std::array<float,2>{0.117795408f, 0.354055852f},
-std::array<float,2>{0.942573369f, 0.469489723f},
-std::array<float,2>{0.208548516f, 0.873453736f},
-std::array<float,2>{0.633365929f, 0.517332375f},
-std::array<float,2>{0.267023981f, 0.138217211f},
-std::array<float,2>{0.519483149f, 0.365449458f},
-std::array<float,2>{0.487506151f, 0.954253912f},
-std::array<float,2>{0.75203383f, 0.693984687f},
-std::array<float,2>{0.0635434091f, 0.0282460935f},
-std::array<float,2>{0.974396944f, 0.147657603f},
-std::array<float,2>{0.244974688f, 0.504880846f},
-std::array<float,2>{0.664044976f, 0.857423782f},
-std::array<float,2>{0.303509057f, 0.495213687f},
-std::array<float,2>{0.698641479f, 0.0866998285f},
-std::array<float,2>{0.365291625f, 0.647413671f},
-std::array<float,2>{0.914044678f, 0.880661547f},
-std::array<float,2>{0.137748688f, 0.251794338f},
-std::array<float,2>{0.818825483f, 0.419383645f},
-std::array<float,2>{0.0104001332f, 0.802479625f},
-std::array<float,2>{0.580890179f, 0.607456684f},
-std::array<float,2>{0.400703251f, 0.247212693f},
-std::array<float,2>{0.653384328f, 0.438055515f},
-std::array<float,2>{0.254231989f, 0.83030349f},
-std::array<float,2>{0.96478653f, 0.54641515f},
-std::array<float,2>{0.20068568f, 0.17933327f},
-std::array<float,2>{0.800576091f, 0.0575212687f},
-std::array<float,2>{0.10687536f, 0.746886969f},
-std::array<float,2>{0.556834817f, 0.9906376f},
-std::array<float,2>{0.446693927f, 0.330222756f},
-std::array<float,2>{0.623918235f, 0.193480879f},
-std::array<float,2>{0.428493887f, 0.566604197f},
-std::array<float,2>{0.864497662f, 0.759307086f},
-std::array<float,2>{0.0379929394f, 0.37639451f},
-std::array<float,2>{0.891273141f, 0.299226463f},
-std::array<float,2>{0.177768484f, 0.925506234f},
-std::array<float,2>{0.72181201f, 0.672880173f},
-std::array<float,2>{0.313522369f, 0.0994530469f},
-std::array<float,2>{0.553795099f, 0.488969088f},
-std::array<float,2>{0.440482408f, 0.850526035f},
-std::array<float,2>{0.81132853f, 0.509430885f},
-std::array<float,2>{0.0998473689f, 0.156117007f},
-std::array<float,2>{0.95690912f, 0.0231721401f},
-std::array<float,2>{0.187705472f, 0.700228989f},
-std::array<float,2>{0.645166636f, 0.96832329f},
-std::array<float,2>{0.261228055f, 0.370113254f},
-std::array<float,2>{0.728559673f, 0.235957384f},
-std::array<float,2>{0.325649589f, 0.597294331f},
-std::array<float,2>{0.902557492f, 0.80578506f},
-std::array<float,2>{0.183367014f, 0.406545937f},
-std::array<float,2>{0.87495774f, 0.261565596f},
-std::array<float,2>{0.0443481393f, 0.883694053f},
-std::array<float,2>{0.613716543f, 0.651808679f},
-std::array<float,2>{0.434939712f, 0.0834204033f},
-std::array<float,2>{0.66628176f, 0.343468279f},
-std::array<float,2>{0.306062609f, 0.993026078f},
-std::array<float,2>{0.981221795f, 0.742158115f},
-std::array<float,2>{0.239273936f, 0.0501732267f},
-std::array<float,2>{0.75968492f, 0.185752362f},
-std::array<float,2>{0.0741889998f, 0.532507002f},
-std::array<float,2>{0.529280066f, 0.837914288f},
-std::array<float,2>{0.497553885f, 0.44790116f},
-std::array<float,2>{0.591290355f, 0.101993762f},
-std::array<float,2>{0.395036578f, 0.684354424f},
-std::array<float,2>{0.823274434f, 0.932865024f},
-std::array<float,2>{0.00611457042f, 0.309323967f},
-std::array<float,2>{0.916396439f, 0.387154788f},
-std::array<float,2>{0.130353585f, 0.754489303f},
-std::array<float,2>{0.690681458f, 0.576726437f},
-std::array<float,2>{0.370673031f, 0.201844722f},
-std::array<float,2>{0.60712719f, 0.28963545f},
-std::array<float,2>{0.412888914f, 0.917255104f},
-std::array<float,2>{0.844543219f, 0.663486421f},
-std::array<float,2>{0.0500518829f, 0.119274393f},
-std::array<float,2>{0.882576108f, 0.205264553f},
-std::array<float,2>{0.168714315f, 0.579854667f},
-std::array<float,2>{0.740464747f, 0.768195927f},
-std::array<float,2>{0.331577331f, 0.394411445f},
-std::array<float,2>{0.62711817f, 0.0393833704f},
-std::array<float,2>{0.275507838f, 0.726835549f},
-std::array<float,2>{0.946674347f, 0.96898967f},
-std::array<float,2>{0.214563996f, 0.326464474f},
-std::array<float,2>{0.789444864f, 0.46446988f},
-std::array<float,2>{0.114341475f, 0.82670486f},
-std::array<float,2>{0.538798213f, 0.561089635f},
-std::array<float,2>{0.457783133f, 0.16297856f},
-std::array<float,2>{0.703234375f, 0.436628401f},
-std::array<float,2>{0.350425899f, 0.791763306f},
-std::array<float,2>{0.934610486f, 0.616044343f},
-std::array<float,2>{0.145375296f, 0.220521107f},
-std::array<float,2>{0.836458325f, 0.0687778369f},
-std::array<float,2>{0.0232172348f, 0.637702286f},
-std::array<float,2>{0.572778463f, 0.906055927f},
-std::array<float,2>{0.379730582f, 0.265776426f},
-std::array<float,2>{0.513516724f, 0.131116942f},
-std::array<float,2>{0.47350806f, 0.527205706f},
-std::array<float,2>{0.773528159f, 0.865843892f},
-std::array<float,2>{0.0820909366f, 0.481815308f},
-std::array<float,2>{0.985703051f, 0.349500418f},
-std::array<float,2>{0.226404488f, 0.94454813f},
-std::array<float,2>{0.684699357f, 0.715137303f},
-std::array<float,2>{0.287449628f, 0.00823130365f},
-std::array<float,2>{0.612276495f, 0.457832724f},
-std::array<float,2>{0.432181656f, 0.814886153f},
-std::array<float,2>{0.870019257f, 0.550004542f},
-std::array<float,2>{0.0403824933f, 0.164110795f},
-std::array<float,2>{0.898959637f, 0.0334209725f},
-std::array<float,2>{0.186140031f, 0.722463965f},
-std::array<float,2>{0.731447756f, 0.978216231f},
-std::array<float,2>{0.32284227f, 0.315796971f},
-std::array<float,2>{0.643439353f, 0.218047976f},
-std::array<float,2>{0.265239984f, 0.587483346f},
-std::array<float,2>{0.957797408f, 0.781003416f},
-std::array<float,2>{0.195018277f, 0.401963651f},
-std::array<float,2>{0.807267368f, 0.287097424f},
-std::array<float,2>{0.0952426195f, 0.906799555f},
-std::array<float,2>{0.548727214f, 0.670354307f},
-std::array<float,2>{0.441975057f, 0.115699008f},
-std::array<float,2>{0.692210853f, 0.356709957f},
-std::array<float,2>{0.374488503f, 0.948493361f},
-std::array<float,2>{0.919456303f, 0.710457802f},
-std::array<float,2>{0.128704399f, 0.00675112056f},
-std::array<float,2>{0.826541543f, 0.135571748f},
-std::array<float,2>{0.00281358301f, 0.519800186f},
-std::array<float,2>{0.586483359f, 0.868656218f},
-std::array<float,2>{0.394514769f, 0.474947304f},
-std::array<float,2>{0.526914299f, 0.0749650151f},
-std::array<float,2>{0.494206458f, 0.631304085f},
-std::array<float,2>{0.763954699f, 0.894695401f},
-std::array<float,2>{0.0750500336f, 0.277337581f},
-std::array<float,2>{0.978959501f, 0.427856117f},
-std::array<float,2>{0.236886844f, 0.78486228f},
-std::array<float,2>{0.668317199f, 0.624613404f},
-std::array<float,2>{0.311496288f, 0.229345262f},
-std::array<float,2>{0.534171462f, 0.25698334f},
-std::array<float,2>{0.455725878f, 0.875383556f},
-std::array<float,2>{0.796087623f, 0.642106235f},
-std::array<float,2>{0.113025114f, 0.0919589847f},
-std::array<float,2>{0.952231109f, 0.243476897f},
-std::array<float,2>{0.215203315f, 0.604044795f},
-std::array<float,2>{0.631326556f, 0.799068034f},
-std::array<float,2>{0.277359009f, 0.4144077f},
-std::array<float,2>{0.734467745f, 0.0257709548f},
-std::array<float,2>{0.335125774f, 0.689579904f},
-std::array<float,2>{0.876176953f, 0.95741111f},
-std::array<float,2>{0.166402191f, 0.36125502f},
-std::array<float,2>{0.848483682f, 0.496170461f},
-std::array<float,2>{0.0546382368f, 0.853644013f},
-std::array<float,2>{0.605126917f, 0.502658963f},
-std::array<float,2>{0.408637434f, 0.143940553f},
-std::array<float,2>{0.683064342f, 0.379978061f},
-std::array<float,2>{0.282568485f, 0.763892233f},
-std::array<float,2>{0.989466906f, 0.564318419f},
-std::array<float,2>{0.220470771f, 0.190315366f},
-std::array<float,2>{0.78007549f, 0.0969153717f},
-std::array<float,2>{0.0796199664f, 0.678924203f},
-std::array<float,2>{0.508609593f, 0.927812815f},
-std::array<float,2>{0.471688181f, 0.302740753f},
-std::array<float,2>{0.577568114f, 0.17318739f},
-std::array<float,2>{0.377690196f, 0.539066911f},
-std::array<float,2>{0.8402614f, 0.833504617f},
-std::array<float,2>{0.0181220155f, 0.441681147f},
-std::array<float,2>{0.931678772f, 0.334372699f},
-std::array<float,2>{0.144186333f, 0.987394094f},
-std::array<float,2>{0.70771879f, 0.744003236f},
-std::array<float,2>{0.347307086f, 0.0621928871f},
-std::array<float,2>{0.50358665f, 0.411811501f},
-std::array<float,2>{0.477421731f, 0.811748028f},
-std::array<float,2>{0.768579245f, 0.6011374f},
-std::array<float,2>{0.0911970809f, 0.241754442f},
-std::array<float,2>{0.993070841f, 0.0809516236f},
-std::array<float,2>{0.227385238f, 0.654658496f},
-std::array<float,2>{0.677424908f, 0.889024734f},
-std::array<float,2>{0.294736028f, 0.26274547f},
-std::array<float,2>{0.714257121f, 0.151646212f},
-std::array<float,2>{0.358915538f, 0.513005972f},
-std::array<float,2>{0.925498486f, 0.845033705f},
-std::array<float,2>{0.153025299f, 0.486856639f},
-std::array<float,2>{0.829437137f, 0.373169094f},
-std::array<float,2>{0.0310886726f, 0.964385092f},
-std::array<float,2>{0.562573314f, 0.696677625f},
-std::array<float,2>{0.388664037f, 0.0170461237f},
-std::array<float,2>{0.640494883f, 0.306040138f},
-std::array<float,2>{0.269959092f, 0.936502039f},
-std::array<float,2>{0.940082371f, 0.679833472f},
-std::array<float,2>{0.203228518f, 0.106901966f},
-std::array<float,2>{0.784041882f, 0.196557209f},
-std::array<float,2>{0.122242048f, 0.572110295f},
-std::array<float,2>{0.542684793f, 0.752426565f},
-std::array<float,2>{0.462276995f, 0.384276181f},
-std::array<float,2>{0.598285854f, 0.0510514304f},
-std::array<float,2>{0.415788591f, 0.734728098f},
-std::array<float,2>{0.851693392f, 0.999768913f},
-std::array<float,2>{0.0596702658f, 0.337059051f},
-std::array<float,2>{0.883034348f, 0.451160282f},
-std::array<float,2>{0.159261048f, 0.843413949f},
-std::array<float,2>{0.746070981f, 0.538404047f},
-std::array<float,2>{0.343611658f, 0.181128517f},
-std::array<float,2>{0.582183063f, 0.322377115f},
-std::array<float,2>{0.403247267f, 0.974328578f},
-std::array<float,2>{0.816171467f, 0.732164145f},
-std::array<float,2>{0.0147900376f, 0.0451475866f},
-std::array<float,2>{0.909862101f, 0.160075977f},
-std::array<float,2>{0.133607805f, 0.555433214f},
-std::array<float,2>{0.702612877f, 0.82361716f},
-std::array<float,2>{0.360440195f, 0.465813994f},
-std::array<float,2>{0.659681857f, 0.124834709f},
-std::array<float,2>{0.298000097f, 0.658939302f},
-std::array<float,2>{0.970357835f, 0.918591738f},
-std::array<float,2>{0.248573929f, 0.293195277f},
-std::array<float,2>{0.757763386f, 0.397633463f},
-std::array<float,2>{0.0701805502f, 0.771907568f},
-std::array<float,2>{0.520446002f, 0.582290292f},
-std::array<float,2>{0.490762055f, 0.20754844f},
-std::array<float,2>{0.726165831f, 0.478443384f},
-std::array<float,2>{0.317808568f, 0.862067521f},
-std::array<float,2>{0.894670665f, 0.530663967f},
-std::array<float,2>{0.174809039f, 0.128662243f},
-std::array<float,2>{0.86158061f, 0.0144393193f},
-std::array<float,2>{0.0321988687f, 0.71365726f},
-std::array<float,2>{0.621010423f, 0.940706372f},
-std::array<float,2>{0.423725605f, 0.344263315f},
-std::array<float,2>{0.560860872f, 0.224363044f},
-std::array<float,2>{0.45012632f, 0.610665083f},
-std::array<float,2>{0.803602755f, 0.794460833f},
-std::array<float,2>{0.103357308f, 0.43202126f},
-std::array<float,2>{0.966551781f, 0.269789189f},
-std::array<float,2>{0.195680574f, 0.901202142f},
-std::array<float,2>{0.651048958f, 0.635537267f},
-std::array<float,2>{0.252493829f, 0.065628998f},
-std::array<float,2>{0.593855679f, 0.424670666f},
-std::array<float,2>{0.421377599f, 0.787616551f},
-std::array<float,2>{0.85575211f, 0.620043039f},
-std::array<float,2>{0.0571214743f, 0.233663648f},
-std::array<float,2>{0.888323128f, 0.0735521093f},
-std::array<float,2>{0.163035125f, 0.626904428f},
-std::array<float,2>{0.749383807f, 0.890818119f},
-std::array<float,2>{0.339223146f, 0.277659267f},
-std::array<float,2>{0.635303259f, 0.138946146f},
-std::array<float,2>{0.268262357f, 0.518040836f},
-std::array<float,2>{0.945261419f, 0.872068286f},
-std::array<float,2>{0.210390136f, 0.472076863f},
-std::array<float,2>{0.788590372f, 0.353157014f},
-std::array<float,2>{0.119301461f, 0.952696443f},
-std::array<float,2>{0.5442788f, 0.704048753f},
-std::array<float,2>{0.46607852f, 0.00388987432f},
-std::array<float,2>{0.716063619f, 0.284361929f},
-std::array<float,2>{0.35393858f, 0.913249075f},
-std::array<float,2>{0.926345825f, 0.665768921f},
-std::array<float,2>{0.149296746f, 0.110453337f},
-std::array<float,2>{0.835183442f, 0.212328166f},
-std::array<float,2>{0.0265238937f, 0.590941906f},
-std::array<float,2>{0.56651026f, 0.774524033f},
-std::array<float,2>{0.385128736f, 0.405219257f},
-std::array<float,2>{0.507276893f, 0.036042694f},
-std::array<float,2>{0.484289825f, 0.723551631f},
-std::array<float,2>{0.770413935f, 0.982878745f},
-std::array<float,2>{0.0868194476f, 0.316526175f},
-std::array<float,2>{0.996305227f, 0.453766048f},
-std::array<float,2>{0.232057884f, 0.816702306f},
-std::array<float,2>{0.675546288f, 0.551818609f},
-std::array<float,2>{0.292774647f, 0.16811277f},
-std::array<float,2>{0.555624962f, 0.329600632f},
-std::array<float,2>{0.44780156f, 0.989376426f},
-std::array<float,2>{0.798238873f, 0.748698354f},
-std::array<float,2>{0.107735589f, 0.0558447391f},
-std::array<float,2>{0.962738812f, 0.177530557f},
-std::array<float,2>{0.202723399f, 0.544133365f},
-std::array<float,2>{0.654776394f, 0.828351617f},
-std::array<float,2>{0.25592038f, 0.441202193f},
-std::array<float,2>{0.720237195f, 0.0999909937f},
-std::array<float,2>{0.314944237f, 0.67471844f},
-std::array<float,2>{0.893940866f, 0.922504187f},
-std::array<float,2>{0.177323654f, 0.298109204f},
-std::array<float,2>{0.865928769f, 0.378316909f},
-std::array<float,2>{0.0357446373f, 0.759805083f},
-std::array<float,2>{0.622655749f, 0.569087088f},
-std::array<float,2>{0.426147878f, 0.193197027f},
-std::array<float,2>{0.660932481f, 0.492898434f},
-std::array<float,2>{0.301682413f, 0.855838537f},
-std::array<float,2>{0.975600183f, 0.507317126f},
-std::array<float,2>{0.243301541f, 0.145714909f},
-std::array<float,2>{0.751553833f, 0.0305374023f},
-std::array<float,2>{0.0660409182f, 0.692536592f},
-std::array<float,2>{0.517009616f, 0.956529677f},
-std::array<float,2>{0.484917641f, 0.36463201f},
-std::array<float,2>{0.579805791f, 0.24998714f},
-std::array<float,2>{0.400295556f, 0.606603563f},
-std::array<float,2>{0.81723386f, 0.80332166f},
-std::array<float,2>{0.00911666639f, 0.42043978f},
-std::array<float,2>{0.910517275f, 0.253316879f},
-std::array<float,2>{0.140067443f, 0.881186426f},
-std::array<float,2>{0.695805073f, 0.645109177f},
-std::array<float,2>{0.364674091f, 0.0886800587f},
-std::array<float,2>{0.529315591f, 0.447049677f},
-std::array<float,2>{0.498364925f, 0.836880684f},
-std::array<float,2>{0.760687172f, 0.534267306f},
-std::array<float,2>{0.0717534572f, 0.183920622f},
-std::array<float,2>{0.983528316f, 0.0482644513f},
-std::array<float,2>{0.240265533f, 0.739757597f},
-std::array<float,2>{0.664698184f, 0.994532704f},
-std::array<float,2>{0.308137566f, 0.341434032f},
-std::array<float,2>{0.688968241f, 0.200008348f},
-std::array<float,2>{0.36759001f, 0.574450076f},
-std::array<float,2>{0.915498912f, 0.756381989f},
-std::array<float,2>{0.131655291f, 0.389496505f},
-std::array<float,2>{0.821994126f, 0.310591221f},
-std::array<float,2>{0.00473769708f, 0.93069613f},
-std::array<float,2>{0.593643427f, 0.686968923f},
-std::array<float,2>{0.397857934f, 0.105246216f},
-std::array<float,2>{0.648412287f, 0.367567837f},
-std::array<float,2>{0.259538651f, 0.965880752f},
-std::array<float,2>{0.954902828f, 0.702921093f},
-std::array<float,2>{0.190170795f, 0.0207180679f},
-std::array<float,2>{0.809653461f, 0.15244621f},
-std::array<float,2>{0.0982619151f, 0.510456741f},
-std::array<float,2>{0.552709818f, 0.84802115f},
-std::array<float,2>{0.437833369f, 0.491819918f},
-std::array<float,2>{0.615633428f, 0.0842775404f},
-std::array<float,2>{0.436837137f, 0.649245083f},
-std::array<float,2>{0.872304201f, 0.886467338f},
-std::array<float,2>{0.0467688851f, 0.258569717f},
-std::array<float,2>{0.906122804f, 0.409858555f},
-std::array<float,2>{0.18160826f, 0.806777894f},
-std::array<float,2>{0.72764957f, 0.594328701f},
-std::array<float,2>{0.326528847f, 0.238089442f},
-std::array<float,2>{0.572261691f, 0.267825484f},
-std::array<float,2>{0.381870836f, 0.903786957f},
-std::array<float,2>{0.838168144f, 0.640327454f},
-std::array<float,2>{0.0205315799f, 0.0668110028f},
-std::array<float,2>{0.936580896f, 0.222084552f},
-std::array<float,2>{0.147689357f, 0.61509794f},
-std::array<float,2>{0.705443621f, 0.789319515f},
-std::array<float,2>{0.348164499f, 0.434384435f},
-std::array<float,2>{0.686355472f, 0.0104475673f},
-std::array<float,2>{0.286049217f, 0.71743834f},
-std::array<float,2>{0.987015009f, 0.942058861f},
-std::array<float,2>{0.222876444f, 0.350833595f},
-std::array<float,2>{0.776414633f, 0.484036028f},
-std::array<float,2>{0.0859282464f, 0.863809943f},
-std::array<float,2>{0.514403999f, 0.52371937f},
-std::array<float,2>{0.476188064f, 0.130101338f},
-std::array<float,2>{0.739338338f, 0.391600072f},
-std::array<float,2>{0.329716802f, 0.766750813f},
-std::array<float,2>{0.879964828f, 0.581830323f},
-std::array<float,2>{0.170051649f, 0.203309536f},
-std::array<float,2>{0.845719635f, 0.118887804f},
-std::array<float,2>{0.048105225f, 0.661091506f},
-std::array<float,2>{0.608685851f, 0.915449679f},
-std::array<float,2>{0.410575479f, 0.29156515f},
-std::array<float,2>{0.53584224f, 0.16028896f},
-std::array<float,2>{0.459742039f, 0.558952689f},
-std::array<float,2>{0.792263985f, 0.824800849f},
-std::array<float,2>{0.116773389f, 0.461384028f},
-std::array<float,2>{0.948188126f, 0.325971574f},
-std::array<float,2>{0.212685674f, 0.971011579f},
-std::array<float,2>{0.626351476f, 0.729300976f},
-std::array<float,2>{0.275287032f, 0.0429124497f},
-std::array<float,2>{0.589232385f, 0.473263025f},
-std::array<float,2>{0.391525567f, 0.870689869f},
-std::array<float,2>{0.82599014f, 0.521791697f},
-std::array<float,2>{0.00181383372f, 0.133098289f},
-std::array<float,2>{0.920424521f, 0.00398362754f},
-std::array<float,2>{0.126171455f, 0.707250178f},
-std::array<float,2>{0.694310606f, 0.946481347f},
-std::array<float,2>{0.372851759f, 0.357844591f},
-std::array<float,2>{0.671301484f, 0.227506891f},
-std::array<float,2>{0.309266686f, 0.621273458f},
-std::array<float,2>{0.976827264f, 0.782757938f},
-std::array<float,2>{0.234623417f, 0.427427411f},
-std::array<float,2>{0.761897326f, 0.274271488f},
-std::array<float,2>{0.0779882073f, 0.897063076f},
-std::array<float,2>{0.524188042f, 0.62919414f},
-std::array<float,2>{0.49290365f, 0.0780239925f},
-std::array<float,2>{0.733876526f, 0.312789977f},
-std::array<float,2>{0.320328981f, 0.979130626f},
-std::array<float,2>{0.900463045f, 0.719665349f},
-std::array<float,2>{0.184021398f, 0.031675525f},
-std::array<float,2>{0.867448568f, 0.166693553f},
-std::array<float,2>{0.0421673246f, 0.547129929f},
-std::array<float,2>{0.610139489f, 0.812961638f},
-std::array<float,2>{0.431168795f, 0.460664093f},
-std::array<float,2>{0.549983025f, 0.114209332f},
-std::array<float,2>{0.444583148f, 0.668248057f},
-std::array<float,2>{0.804796815f, 0.908676863f},
-std::array<float,2>{0.0960432738f, 0.288207293f},
-std::array<float,2>{0.959112942f, 0.399950236f},
-std::array<float,2>{0.192107871f, 0.777644455f},
-std::array<float,2>{0.641835749f, 0.589291751f},
-std::array<float,2>{0.261803508f, 0.216789454f},
-std::array<float,2>{0.509854317f, 0.301041305f},
-std::array<float,2>{0.470507443f, 0.927369118f},
-std::array<float,2>{0.777451217f, 0.676209569f},
-std::array<float,2>{0.0804507807f, 0.0948829427f},
-std::array<float,2>{0.991497576f, 0.187860236f},
-std::array<float,2>{0.222381979f, 0.565299034f},
-std::array<float,2>{0.680153906f, 0.763392448f},
-std::array<float,2>{0.284340531f, 0.38239342f},
-std::array<float,2>{0.709919572f, 0.0604055822f},
-std::array<float,2>{0.345075548f, 0.74587816f},
-std::array<float,2>{0.930396736f, 0.986240804f},
-std::array<float,2>{0.141314864f, 0.332410961f},
-std::array<float,2>{0.842778802f, 0.443674922f},
-std::array<float,2>{0.0167383235f, 0.834011495f},
-std::array<float,2>{0.575095832f, 0.541795671f},
-std::array<float,2>{0.375903398f, 0.174507603f},
-std::array<float,2>{0.630272686f, 0.417373598f},
-std::array<float,2>{0.280680925f, 0.798571706f},
-std::array<float,2>{0.951118112f, 0.60234648f},
-std::array<float,2>{0.218410432f, 0.245743826f},
-std::array<float,2>{0.794320941f, 0.0906363949f},
-std::array<float,2>{0.109682776f, 0.643588006f},
-std::array<float,2>{0.533155859f, 0.877791524f},
-std::array<float,2>{0.455015242f, 0.255746871f},
-std::array<float,2>{0.603253305f, 0.141151652f},
-std::array<float,2>{0.407073319f, 0.501559913f},
-std::array<float,2>{0.849798083f, 0.851838589f},
-std::array<float,2>{0.0516053662f, 0.498350292f},
-std::array<float,2>{0.878271699f, 0.362196565f},
-std::array<float,2>{0.16426532f, 0.959347486f},
-std::array<float,2>{0.737650454f, 0.687859595f},
-std::array<float,2>{0.333972573f, 0.0236505121f},
-std::array<float,2>{0.539441884f, 0.385374039f},
-std::array<float,2>{0.463827372f, 0.751388013f},
-std::array<float,2>{0.781805515f, 0.573375344f},
-std::array<float,2>{0.124184273f, 0.19900851f},
-std::array<float,2>{0.939293563f, 0.108174413f},
-std::array<float,2>{0.206112415f, 0.683229625f},
-std::array<float,2>{0.636968613f, 0.933934212f},
-std::array<float,2>{0.273024261f, 0.308045089f},
-std::array<float,2>{0.743454576f, 0.181812719f},
-std::array<float,2>{0.341029406f, 0.53597486f},
-std::array<float,2>{0.886112452f, 0.840243518f},
-std::array<float,2>{0.157313392f, 0.452020168f},
-std::array<float,2>{0.854233444f, 0.338911027f},
-std::array<float,2>{0.0612880401f, 0.996882677f},
-std::array<float,2>{0.599700391f, 0.737275243f},
-std::array<float,2>{0.417845696f, 0.0545386523f},
-std::array<float,2>{0.679033279f, 0.264114976f},
-std::array<float,2>{0.296429157f, 0.88832593f},
-std::array<float,2>{0.99538666f, 0.653724134f},
-std::array<float,2>{0.228743911f, 0.0787888542f},
-std::array<float,2>{0.766012609f, 0.239183858f},
-std::array<float,2>{0.0924777985f, 0.597680032f},
-std::array<float,2>{0.501340687f, 0.810277343f},
-std::array<float,2>{0.479092807f, 0.412790984f},
-std::array<float,2>{0.564477205f, 0.0183911417f},
-std::array<float,2>{0.388935357f, 0.69840312f},
-std::array<float,2>{0.831962228f, 0.961017072f},
-std::array<float,2>{0.0278559551f, 0.371507555f},
-std::array<float,2>{0.92259866f, 0.484746903f},
-std::array<float,2>{0.15555729f, 0.847029507f},
-std::array<float,2>{0.712695718f, 0.513741612f},
-std::array<float,2>{0.356628746f, 0.14906767f},
-std::array<float,2>{0.618041337f, 0.345982343f},
-std::array<float,2>{0.42422688f, 0.937843561f},
-std::array<float,2>{0.861181974f, 0.712673843f},
-std::array<float,2>{0.0333982445f, 0.0119700655f},
-std::array<float,2>{0.897357523f, 0.125612319f},
-std::array<float,2>{0.172786787f, 0.529115856f},
-std::array<float,2>{0.72449708f, 0.860427082f},
-std::array<float,2>{0.32006973f, 0.480440021f},
-std::array<float,2>{0.648651123f, 0.0631207228f},
-std::array<float,2>{0.250229776f, 0.632912636f},
-std::array<float,2>{0.966860056f, 0.898714602f},
-std::array<float,2>{0.197406307f, 0.271672547f},
-std::array<float,2>{0.801219046f, 0.430480748f},
-std::array<float,2>{0.104686677f, 0.796748638f},
-std::array<float,2>{0.55964148f, 0.611603856f},
-std::array<float,2>{0.45165655f, 0.226015314f},
-std::array<float,2>{0.699289918f, 0.467078239f},
-std::array<float,2>{0.362259954f, 0.821285486f},
-std::array<float,2>{0.906706095f, 0.558261454f},
-std::array<float,2>{0.135914072f, 0.156699851f},
-std::array<float,2>{0.812731564f, 0.0438809432f},
-std::array<float,2>{0.0126195848f, 0.733130753f},
-std::array<float,2>{0.584158242f, 0.975165367f},
-std::array<float,2>{0.404995412f, 0.320756853f},
-std::array<float,2>{0.521571457f, 0.210226133f},
-std::array<float,2>{0.489075929f, 0.584101796f},
-std::array<float,2>{0.754364192f, 0.770861566f},
-std::array<float,2>{0.0677200705f, 0.396277577f},
-std::array<float,2>{0.971969366f, 0.29599297f},
-std::array<float,2>{0.246840328f, 0.921185851f},
-std::array<float,2>{0.657347858f, 0.656357765f},
-std::array<float,2>{0.299814969f, 0.12248788f},
-std::array<float,2>{0.581601143f, 0.421290845f},
-std::array<float,2>{0.402066857f, 0.803905845f},
-std::array<float,2>{0.819339037f, 0.606212974f},
-std::array<float,2>{0.0111518502f, 0.248512998f},
-std::array<float,2>{0.912455857f, 0.0892105177f},
-std::array<float,2>{0.136765733f, 0.646322131f},
-std::array<float,2>{0.697323501f, 0.882749915f},
-std::array<float,2>{0.366681457f, 0.25238961f},
-std::array<float,2>{0.662581027f, 0.144839332f},
-std::array<float,2>{0.303929448f, 0.50607115f},
-std::array<float,2>{0.97277683f, 0.857132375f},
-std::array<float,2>{0.246029794f, 0.493228853f},
-std::array<float,2>{0.752946377f, 0.363827467f},
-std::array<float,2>{0.0626337081f, 0.955198109f},
-std::array<float,2>{0.517983019f, 0.692244828f},
-std::array<float,2>{0.48671025f, 0.0301377419f},
-std::array<float,2>{0.720775425f, 0.297034502f},
-std::array<float,2>{0.312778115f, 0.923814893f},
-std::array<float,2>{0.891696811f, 0.675736487f},
-std::array<float,2>{0.179665595f, 0.101112597f},
-std::array<float,2>{0.863743961f, 0.192070737f},
-std::array<float,2>{0.0389949977f, 0.569419444f},
-std::array<float,2>{0.624446452f, 0.760784984f},
-std::array<float,2>{0.429380745f, 0.377261281f},
-std::array<float,2>{0.55796349f, 0.0553175844f},
-std::array<float,2>{0.445755631f, 0.749277353f},
-std::array<float,2>{0.799623191f, 0.988851547f},
-std::array<float,2>{0.105666324f, 0.329052478f},
-std::array<float,2>{0.963412523f, 0.439829081f},
-std::array<float,2>{0.200101599f, 0.830059648f},
-std::array<float,2>{0.652829945f, 0.543805659f},
-std::array<float,2>{0.255034477f, 0.176596746f},
-std::array<float,2>{0.504632711f, 0.317793131f},
-std::array<float,2>{0.481230319f, 0.98420763f},
-std::array<float,2>{0.77274245f, 0.723697066f},
-std::array<float,2>{0.0879363269f, 0.0369948037f},
-std::array<float,2>{0.999521613f, 0.169470489f},
-std::array<float,2>{0.232478842f, 0.551663578f},
-std::array<float,2>{0.67215246f, 0.818314672f},
-std::array<float,2>{0.289321661f, 0.454994857f},
-std::array<float,2>{0.718125224f, 0.109661534f},
-std::array<float,2>{0.352258474f, 0.664476871f},
-std::array<float,2>{0.929677844f, 0.91248703f},
-std::array<float,2>{0.151708916f, 0.283567131f},
-std::array<float,2>{0.833836019f, 0.405526072f},
-std::array<float,2>{0.0241965894f, 0.773617566f},
-std::array<float,2>{0.569194019f, 0.590352535f},
-std::array<float,2>{0.383092284f, 0.211845398f},
-std::array<float,2>{0.634153545f, 0.471539021f},
-std::array<float,2>{0.265831023f, 0.872142017f},
-std::array<float,2>{0.941441417f, 0.518807113f},
-std::array<float,2>{0.207495645f, 0.140120044f},
-std::array<float,2>{0.785240769f, 0.00285879802f},
-std::array<float,2>{0.118324451f, 0.704243064f},
-std::array<float,2>{0.546782911f, 0.95138973f},
-std::array<float,2>{0.466970414f, 0.352521688f},
-std::array<float,2>{0.597274661f, 0.233276904f},
-std::array<float,2>{0.41880247f, 0.620322824f},
-std::array<float,2>{0.859363437f, 0.788648903f},
-std::array<float,2>{0.0561165698f, 0.425056785f},
-std::array<float,2>{0.88892442f, 0.27922371f},
-std::array<float,2>{0.160852373f, 0.892490029f},
-std::array<float,2>{0.747404516f, 0.625004947f},
-std::array<float,2>{0.336178005f, 0.0730230212f},
-std::array<float,2>{0.537969589f, 0.462241888f},
-std::array<float,2>{0.458973348f, 0.825690627f},
-std::array<float,2>{0.790548086f, 0.560212016f},
-std::array<float,2>{0.113810129f, 0.161463737f},
-std::array<float,2>{0.945384502f, 0.0418526009f},
-std::array<float,2>{0.213755146f, 0.729685545f},
-std::array<float,2>{0.628050685f, 0.97195971f},
-std::array<float,2>{0.276694477f, 0.324875236f},
-std::array<float,2>{0.74165684f, 0.204896465f},
-std::array<float,2>{0.330264181f, 0.580557585f},
-std::array<float,2>{0.881056011f, 0.765973389f},
-std::array<float,2>{0.16906558f, 0.391723275f},
-std::array<float,2>{0.845253289f, 0.292130083f},
-std::array<float,2>{0.0494730994f, 0.914501905f},
-std::array<float,2>{0.60550797f, 0.661246777f},
-std::array<float,2>{0.413574457f, 0.117995307f},
-std::array<float,2>{0.684295475f, 0.349655896f},
-std::array<float,2>{0.288095832f, 0.942910314f},
-std::array<float,2>{0.985228419f, 0.718377054f},
-std::array<float,2>{0.224692285f, 0.0109087005f},
-std::array<float,2>{0.77463448f, 0.129659489f},
-std::array<float,2>{0.0833168104f, 0.525003672f},
-std::array<float,2>{0.511779785f, 0.864556491f},
-std::array<float,2>{0.473678619f, 0.483070105f},
-std::array<float,2>{0.573910058f, 0.0678505376f},
-std::array<float,2>{0.380147964f, 0.63963449f},
-std::array<float,2>{0.837312341f, 0.903069794f},
-std::array<float,2>{0.0215279013f, 0.268740177f},
-std::array<float,2>{0.933662772f, 0.435122579f},
-std::array<float,2>{0.145616174f, 0.790079117f},
-std::array<float,2>{0.704424262f, 0.614204228f},
-std::array<float,2>{0.351527601f, 0.22117199f},
-std::array<float,2>{0.614409745f, 0.259660453f},
-std::array<float,2>{0.433664531f, 0.884874523f},
-std::array<float,2>{0.873473883f, 0.649476826f},
-std::array<float,2>{0.0434238762f, 0.0853031054f},
-std::array<float,2>{0.903968334f, 0.236461729f},
-std::array<float,2>{0.181949869f, 0.594924092f},
-std::array<float,2>{0.730103374f, 0.807973325f},
-std::array<float,2>{0.324674845f, 0.408646852f},
-std::array<float,2>{0.645589888f, 0.0198643245f},
-std::array<float,2>{0.259909332f, 0.702095926f},
-std::array<float,2>{0.955126643f, 0.964970827f},
-std::array<float,2>{0.188517272f, 0.368191898f},
-std::array<float,2>{0.812196016f, 0.490948528f},
-std::array<float,2>{0.101211362f, 0.849270284f},
-std::array<float,2>{0.553671002f, 0.510818124f},
-std::array<float,2>{0.440325826f, 0.154123619f},
-std::array<float,2>{0.690417767f, 0.390602976f},
-std::array<float,2>{0.369882315f, 0.757360339f},
-std::array<float,2>{0.91719979f, 0.575286865f},
-std::array<float,2>{0.129342437f, 0.201026142f},
-std::array<float,2>{0.822920263f, 0.104292803f},
-std::array<float,2>{0.00714481017f, 0.685709774f},
-std::array<float,2>{0.59039551f, 0.929712236f},
-std::array<float,2>{0.395760506f, 0.311674178f},
-std::array<float,2>{0.527567327f, 0.185282812f},
-std::array<float,2>{0.496359199f, 0.533576965f},
-std::array<float,2>{0.758684814f, 0.837877631f},
-std::array<float,2>{0.0728822872f, 0.445432872f},
-std::array<float,2>{0.982393801f, 0.34079051f},
-std::array<float,2>{0.239175439f, 0.995995998f},
-std::array<float,2>{0.667938352f, 0.738621056f},
-std::array<float,2>{0.305220932f, 0.047111474f},
-std::array<float,2>{0.603941798f, 0.499817431f},
-std::array<float,2>{0.409702957f, 0.852770329f},
-std::array<float,2>{0.848699629f, 0.500308096f},
-std::array<float,2>{0.0534762256f, 0.142057225f},
-std::array<float,2>{0.875309646f, 0.0244932733f},
-std::array<float,2>{0.167774379f, 0.689377546f},
-std::array<float,2>{0.735474825f, 0.959967256f},
-std::array<float,2>{0.334679574f, 0.362554133f},
-std::array<float,2>{0.631871164f, 0.244861364f},
-std::array<float,2>{0.279200613f, 0.603506446f},
-std::array<float,2>{0.951270521f, 0.797405362f},
-std::array<float,2>{0.215854585f, 0.416818231f},
-std::array<float,2>{0.795841098f, 0.254389554f},
-std::array<float,2>{0.111854151f, 0.878202856f},
-std::array<float,2>{0.534583628f, 0.642678082f},
-std::array<float,2>{0.456421345f, 0.091775313f},
-std::array<float,2>{0.708978891f, 0.333083183f},
-std::array<float,2>{0.345919073f, 0.984783471f},
-std::array<float,2>{0.932826221f, 0.744222283f},
-std::array<float,2>{0.143183753f, 0.0586871356f},
-std::array<float,2>{0.841695905f, 0.175165042f},
-std::array<float,2>{0.0189848635f, 0.542625844f},
-std::array<float,2>{0.57647413f, 0.835780978f},
-std::array<float,2>{0.378081828f, 0.444489479f},
-std::array<float,2>{0.509620607f, 0.0945729464f},
-std::array<float,2>{0.470849007f, 0.677372694f},
-std::array<float,2>{0.78057462f, 0.925980687f},
-std::array<float,2>{0.0788462758f, 0.302409649f},
-std::array<float,2>{0.98892951f, 0.381827056f},
-std::array<float,2>{0.219457477f, 0.762211084f},
-std::array<float,2>{0.681953907f, 0.565793395f},
-std::array<float,2>{0.281639904f, 0.18942745f},
-std::array<float,2>{0.547521234f, 0.288064301f},
-std::array<float,2>{0.442589998f, 0.909660161f},
-std::array<float,2>{0.808016777f, 0.669709444f},
-std::array<float,2>{0.0938738436f, 0.114929639f},
-std::array<float,2>{0.958787024f, 0.215436518f},
-std::array<float,2>{0.193788141f, 0.588059604f},
-std::array<float,2>{0.644493401f, 0.778616846f},
-std::array<float,2>{0.264184088f, 0.399240732f},
-std::array<float,2>{0.731392682f, 0.0330742598f},
-std::array<float,2>{0.323353916f, 0.720283568f},
-std::array<float,2>{0.899571061f, 0.980074883f},
-std::array<float,2>{0.187056869f, 0.314198494f},
-std::array<float,2>{0.870648861f, 0.459312022f},
-std::array<float,2>{0.0391011238f, 0.813512802f},
-std::array<float,2>{0.613064408f, 0.54818964f},
-std::array<float,2>{0.433172405f, 0.167688444f},
-std::array<float,2>{0.669240415f, 0.426472574f},
-std::array<float,2>{0.312331825f, 0.782056212f},
-std::array<float,2>{0.980217934f, 0.622451603f},
-std::array<float,2>{0.238172531f, 0.228127122f},
-std::array<float,2>{0.764844835f, 0.0766742453f},
-std::array<float,2>{0.0755603313f, 0.630554855f},
-std::array<float,2>{0.525799334f, 0.898324311f},
-std::array<float,2>{0.495430768f, 0.274480969f},
-std::array<float,2>{0.587030888f, 0.13465108f},
-std::array<float,2>{0.392899096f, 0.522847474f},
-std::array<float,2>{0.827429295f, 0.869980037f},
-std::array<float,2>{0.00356525392f, 0.474377215f},
-std::array<float,2>{0.918286741f, 0.359096289f},
-std::array<float,2>{0.127542436f, 0.946193576f},
-std::array<float,2>{0.692943335f, 0.708271563f},
-std::array<float,2>{0.373283416f, 0.00575442053f},
-std::array<float,2>{0.521134973f, 0.394995362f},
-std::array<float,2>{0.491379321f, 0.769598544f},
-std::array<float,2>{0.75673157f, 0.584998131f},
-std::array<float,2>{0.0691488609f, 0.209506258f},
-std::array<float,2>{0.969428241f, 0.121444963f},
-std::array<float,2>{0.249377117f, 0.657555044f},
-std::array<float,2>{0.658617854f, 0.920815587f},
-std::array<float,2>{0.29709807f, 0.295379013f},
-std::array<float,2>{0.701739788f, 0.157774329f},
-std::array<float,2>{0.360251933f, 0.556951761f},
-std::array<float,2>{0.908940554f, 0.821662247f},
-std::array<float,2>{0.134056181f, 0.468487859f},
-std::array<float,2>{0.814757407f, 0.32190606f},
-std::array<float,2>{0.0144341849f, 0.97609216f},
-std::array<float,2>{0.583546221f, 0.733478725f},
-std::array<float,2>{0.404271871f, 0.0444039889f},
-std::array<float,2>{0.65219897f, 0.272477716f},
-std::array<float,2>{0.253356963f, 0.900046825f},
-std::array<float,2>{0.965714872f, 0.634313405f},
-std::array<float,2>{0.196378157f, 0.0635764673f},
-std::array<float,2>{0.803746104f, 0.224763751f},
-std::array<float,2>{0.102129832f, 0.613074481f},
-std::array<float,2>{0.561952651f, 0.795013368f},
-std::array<float,2>{0.451025039f, 0.431008935f},
-std::array<float,2>{0.619733751f, 0.0132383341f},
-std::array<float,2>{0.422503322f, 0.71168673f},
-std::array<float,2>{0.862598062f, 0.938817322f},
-std::array<float,2>{0.0328835584f, 0.34709698f},
-std::array<float,2>{0.896173835f, 0.478610903f},
-std::array<float,2>{0.173930019f, 0.859668791f},
-std::array<float,2>{0.725301147f, 0.527614713f},
-std::array<float,2>{0.317011386f, 0.126278415f},
-std::array<float,2>{0.563863635f, 0.372383773f},
-std::array<float,2>{0.387422949f, 0.961977839f},
-std::array<float,2>{0.828695357f, 0.697351456f},
-std::array<float,2>{0.0297019128f, 0.0185748525f},
-std::array<float,2>{0.924150229f, 0.149509624f},
-std::array<float,2>{0.153809637f, 0.514861524f},
-std::array<float,2>{0.712963045f, 0.846080422f},
-std::array<float,2>{0.358128518f, 0.485653877f},
-std::array<float,2>{0.676611543f, 0.0794291049f},
-std::array<float,2>{0.293628067f, 0.652973235f},
-std::array<float,2>{0.993807077f, 0.886950433f},
-std::array<float,2>{0.227947474f, 0.265594006f},
-std::array<float,2>{0.767802298f, 0.413425803f},
-std::array<float,2>{0.09033335f, 0.809312046f},
-std::array<float,2>{0.502837658f, 0.598989308f},
-std::array<float,2>{0.478284597f, 0.239801243f},
-std::array<float,2>{0.744171202f, 0.452379555f},
-std::array<float,2>{0.342736036f, 0.841745973f},
-std::array<float,2>{0.884186387f, 0.536174655f},
-std::array<float,2>{0.158727929f, 0.182635397f},
-std::array<float,2>{0.853094578f, 0.0530355796f},
-std::array<float,2>{0.0589606352f, 0.737458408f},
-std::array<float,2>{0.598957479f, 0.997977376f},
-std::array<float,2>{0.414844602f, 0.338376492f},
-std::array<float,2>{0.541597366f, 0.19794251f},
-std::array<float,2>{0.461835861f, 0.572935224f},
-std::array<float,2>{0.784451365f, 0.750495136f},
-std::array<float,2>{0.121817507f, 0.386463791f},
-std::array<float,2>{0.940963566f, 0.30672437f},
-std::array<float,2>{0.204199493f, 0.935225308f},
-std::array<float,2>{0.639543593f, 0.682437003f},
-std::array<float,2>{0.271097153f, 0.109250352f},
-std::array<float,2>{0.622023582f, 0.375625253f},
-std::array<float,2>{0.427216679f, 0.757864475f},
-std::array<float,2>{0.86641711f, 0.567513764f},
-std::array<float,2>{0.0362328552f, 0.195216462f},
-std::array<float,2>{0.892592728f, 0.0983996466f},
-std::array<float,2>{0.176458761f, 0.672575235f},
-std::array<float,2>{0.719352424f, 0.924765766f},
-std::array<float,2>{0.315809906f, 0.300362825f},
-std::array<float,2>{0.655768037f, 0.178314045f},
-std::array<float,2>{0.257005692f, 0.545291901f},
-std::array<float,2>{0.961796403f, 0.831482828f},
-std::array<float,2>{0.201227471f, 0.439244717f},
-std::array<float,2>{0.797784686f, 0.33183673f},
-std::array<float,2>{0.109089747f, 0.992150247f},
-std::array<float,2>{0.55569464f, 0.747184813f},
-std::array<float,2>{0.448781371f, 0.0583974682f},
-std::array<float,2>{0.696858585f, 0.250441879f},
-std::array<float,2>{0.363373101f, 0.879525065f},
-std::array<float,2>{0.911856055f, 0.647730768f},
-std::array<float,2>{0.139490351f, 0.0878386199f},
-std::array<float,2>{0.81798321f, 0.247013643f},
-std::array<float,2>{0.00824169815f, 0.609033287f},
-std::array<float,2>{0.579016209f, 0.801438689f},
-std::array<float,2>{0.399340391f, 0.418937266f},
-std::array<float,2>{0.516581893f, 0.028659936f},
-std::array<float,2>{0.485840648f, 0.695266724f},
-std::array<float,2>{0.750455856f, 0.953570485f},
-std::array<float,2>{0.064898327f, 0.366339833f},
-std::array<float,2>{0.974932373f, 0.494170576f},
-std::array<float,2>{0.243142128f, 0.859082103f},
-std::array<float,2>{0.661444962f, 0.505350888f},
-std::array<float,2>{0.301794022f, 0.14681673f},
-std::array<float,2>{0.543897092f, 0.355413556f},
-std::array<float,2>{0.465627193f, 0.950176537f},
-std::array<float,2>{0.787128568f, 0.705675304f},
-std::array<float,2>{0.120271258f, 0.00182732288f},
-std::array<float,2>{0.943809628f, 0.13765648f},
-std::array<float,2>{0.209554613f, 0.515637338f},
-std::array<float,2>{0.636035383f, 0.874322712f},
-std::array<float,2>{0.269385368f, 0.469940901f},
-std::array<float,2>{0.748188198f, 0.0710056499f},
-std::array<float,2>{0.338846505f, 0.628841281f},
-std::array<float,2>{0.887411416f, 0.893813908f},
-std::array<float,2>{0.163683698f, 0.279827595f},
-std::array<float,2>{0.856681049f, 0.423055023f},
-std::array<float,2>{0.0583590828f, 0.785399258f},
-std::array<float,2>{0.595650733f, 0.617385089f},
-std::array<float,2>{0.419950992f, 0.230940774f},
-std::array<float,2>{0.674312949f, 0.455372602f},
-std::array<float,2>{0.291862458f, 0.819422841f},
-std::array<float,2>{0.997747004f, 0.554223537f},
-std::array<float,2>{0.230941489f, 0.170416787f},
-std::array<float,2>{0.770732462f, 0.0373360217f},
-std::array<float,2>{0.0875689164f, 0.725750446f},
-std::array<float,2>{0.506574214f, 0.980615079f},
-std::array<float,2>{0.482521683f, 0.319542646f},
-std::array<float,2>{0.567835271f, 0.213895619f},
-std::array<float,2>{0.386194497f, 0.591973841f},
-std::array<float,2>{0.834376454f, 0.776902139f},
-std::array<float,2>{0.0254096035f, 0.403435588f},
-std::array<float,2>{0.926862299f, 0.282991588f},
-std::array<float,2>{0.150229678f, 0.910633445f},
-std::array<float,2>{0.715182066f, 0.667912304f},
-std::array<float,2>{0.354950696f, 0.11324925f},
-std::array<float,2>{0.514977753f, 0.480947584f},
-std::array<float,2>{0.474856764f, 0.866811275f},
-std::array<float,2>{0.776019752f, 0.526018739f},
-std::array<float,2>{0.0842336565f, 0.132789746f},
-std::array<float,2>{0.988240421f, 0.00904485211f},
-std::array<float,2>{0.223831907f, 0.716593027f},
-std::array<float,2>{0.687194586f, 0.943547785f},
-std::array<float,2>{0.286337286f, 0.347870588f},
-std::array<float,2>{0.706926525f, 0.21927622f},
-std::array<float,2>{0.349485457f, 0.617071033f},
-std::array<float,2>{0.935985327f, 0.792607903f},
-std::array<float,2>{0.147083715f, 0.43578127f},
-std::array<float,2>{0.839794755f, 0.267250389f},
-std::array<float,2>{0.020211475f, 0.905222476f},
-std::array<float,2>{0.57070452f, 0.637406886f},
-std::array<float,2>{0.381692827f, 0.070228003f},
-std::array<float,2>{0.625403941f, 0.327873051f},
-std::array<float,2>{0.273972243f, 0.96994853f},
-std::array<float,2>{0.949128747f, 0.728368402f},
-std::array<float,2>{0.21173805f, 0.0409489609f},
-std::array<float,2>{0.79104948f, 0.163563415f},
-std::array<float,2>{0.116049603f, 0.56169641f},
-std::array<float,2>{0.536538363f, 0.827559292f},
-std::array<float,2>{0.460655332f, 0.463045567f},
-std::array<float,2>{0.60817492f, 0.120581955f},
-std::array<float,2>{0.411715657f, 0.662555456f},
-std::array<float,2>{0.846802056f, 0.916448534f},
-std::array<float,2>{0.0474458374f, 0.290658772f},
-std::array<float,2>{0.879718721f, 0.392741829f},
-std::array<float,2>{0.171464905f, 0.769166231f},
-std::array<float,2>{0.738290071f, 0.578660309f},
-std::array<float,2>{0.328175992f, 0.206087574f},
-std::array<float,2>{0.592657983f, 0.310534865f},
-std::array<float,2>{0.396933019f, 0.932092249f},
-std::array<float,2>{0.820734203f, 0.684621751f},
-std::array<float,2>{0.00516421581f, 0.102982819f},
-std::array<float,2>{0.914678514f, 0.202896997f},
-std::array<float,2>{0.132022053f, 0.577582419f},
-std::array<float,2>{0.687585235f, 0.754913747f},
-std::array<float,2>{0.368467867f, 0.388055921f},
-std::array<float,2>{0.665633202f, 0.0490200035f},
-std::array<float,2>{0.307276338f, 0.741018116f},
-std::array<float,2>{0.982758045f, 0.994098485f},
-std::array<float,2>{0.241707027f, 0.34232828f},
-std::array<float,2>{0.761047125f, 0.44840917f},
-std::array<float,2>{0.0711288378f, 0.839620769f},
-std::array<float,2>{0.531211197f, 0.531357467f},
-std::array<float,2>{0.499632537f, 0.187071696f},
-std::array<float,2>{0.726983309f, 0.407298654f},
-std::array<float,2>{0.32802242f, 0.805085719f},
-std::array<float,2>{0.904866934f, 0.595909238f},
-std::array<float,2>{0.179949f, 0.234700665f},
-std::array<float,2>{0.871420383f, 0.0823654681f},
-std::array<float,2>{0.0456374884f, 0.650969982f},
-std::array<float,2>{0.617171586f, 0.883992136f},
-std::array<float,2>{0.435992986f, 0.259913206f},
-std::array<float,2>{0.551166177f, 0.15482907f},
-std::array<float,2>{0.438917339f, 0.50827837f},
-std::array<float,2>{0.809310257f, 0.850720942f},
-std::array<float,2>{0.0995177999f, 0.489887476f},
-std::array<float,2>{0.953934729f, 0.370503366f},
-std::array<float,2>{0.191404f, 0.966849923f},
-std::array<float,2>{0.646562696f, 0.699632943f},
-std::array<float,2>{0.258302033f, 0.0222699959f},
-std::array<float,2>{0.575514495f, 0.442944944f},
-std::array<float,2>{0.376640975f, 0.832779944f},
-std::array<float,2>{0.842270911f, 0.540809095f},
-std::array<float,2>{0.0157838799f, 0.172112003f},
-std::array<float,2>{0.931430399f, 0.0608364157f},
-std::array<float,2>{0.141905025f, 0.742808521f},
-std::array<float,2>{0.710550964f, 0.986823142f},
-std::array<float,2>{0.343906909f, 0.335072041f},
-std::array<float,2>{0.680973887f, 0.191139162f},
-std::array<float,2>{0.283624291f, 0.563371956f},
-std::array<float,2>{0.990677536f, 0.765329838f},
-std::array<float,2>{0.221172228f, 0.379364043f},
-std::array<float,2>{0.779260039f, 0.304132015f},
-std::array<float,2>{0.0816608667f, 0.929197967f},
-std::array<float,2>{0.511431992f, 0.678303778f},
-std::array<float,2>{0.469688952f, 0.0962438956f},
-std::array<float,2>{0.736720502f, 0.359740943f},
-std::array<float,2>{0.332934707f, 0.958187759f},
-std::array<float,2>{0.877396286f, 0.691388249f},
-std::array<float,2>{0.165561214f, 0.0265479144f},
-std::array<float,2>{0.850999415f, 0.142714992f},
-std::array<float,2>{0.052374281f, 0.50330174f},
-std::array<float,2>{0.602065384f, 0.854721069f},
-std::array<float,2>{0.407348216f, 0.49804619f},
-std::array<float,2>{0.531306028f, 0.0928778574f},
-std::array<float,2>{0.454057664f, 0.641526163f},
-std::array<float,2>{0.793126225f, 0.876403034f},
-std::array<float,2>{0.111140445f, 0.256465375f},
-std::array<float,2>{0.950064242f, 0.415488631f},
-std::array<float,2>{0.217389822f, 0.800701857f},
-std::array<float,2>{0.629340887f, 0.604912817f},
-std::array<float,2>{0.280240029f, 0.24275659f},
-std::array<float,2>{0.524874747f, 0.275989205f},
-std::array<float,2>{0.494062245f, 0.89594698f},
-std::array<float,2>{0.762814105f, 0.632130802f},
-std::array<float,2>{0.0762370005f, 0.0760197937f},
-std::array<float,2>{0.978280187f, 0.230255097f},
-std::array<float,2>{0.235507399f, 0.623987675f},
-std::array<float,2>{0.670678377f, 0.783599854f},
-std::array<float,2>{0.310523987f, 0.429110467f},
-std::array<float,2>{0.694792092f, 0.00730809756f},
-std::array<float,2>{0.371451557f, 0.709261358f},
-std::array<float,2>{0.92119956f, 0.948232472f},
-std::array<float,2>{0.125317484f, 0.35569033f},
-std::array<float,2>{0.824829519f, 0.475801617f},
-std::array<float,2>{0.000632559648f, 0.868067563f},
-std::array<float,2>{0.588513017f, 0.521186411f},
-std::array<float,2>{0.392156422f, 0.136507779f},
-std::array<float,2>{0.641126692f, 0.401045531f},
-std::array<float,2>{0.262916267f, 0.779689908f},
-std::array<float,2>{0.960792363f, 0.586572349f},
-std::array<float,2>{0.192619741f, 0.217504218f},
-std::array<float,2>{0.80606848f, 0.116318703f},
-std::array<float,2>{0.0967725143f, 0.67090708f},
-std::array<float,2>{0.54964906f, 0.907693148f},
-std::array<float,2>{0.443514496f, 0.285498857f},
-std::array<float,2>{0.610815704f, 0.16596058f},
-std::array<float,2>{0.429771423f, 0.549082696f},
-std::array<float,2>{0.868816614f, 0.816017509f},
-std::array<float,2>{0.0417982079f, 0.458690852f},
-std::array<float,2>{0.902001977f, 0.315025151f},
-std::array<float,2>{0.185303167f, 0.976610124f},
-std::array<float,2>{0.732518852f, 0.721450269f},
-std::array<float,2>{0.32159844f, 0.0349166766f},
-std::array<float,2>{0.559086561f, 0.433500916f},
-std::array<float,2>{0.452153087f, 0.793227971f},
-std::array<float,2>{0.802590787f, 0.609827399f},
-std::array<float,2>{0.10383229f, 0.222728923f},
-std::array<float,2>{0.967966378f, 0.0647178292f},
-std::array<float,2>{0.19855848f, 0.635960281f},
-std::array<float,2>{0.649608552f, 0.901409566f},
-std::array<float,2>{0.251063943f, 0.271096587f},
-std::array<float,2>{0.723387837f, 0.127533078f},
-std::array<float,2>{0.318382114f, 0.52932781f},
-std::array<float,2>{0.89784646f, 0.862508118f},
-std::array<float,2>{0.17310752f, 0.477051675f},
-std::array<float,2>{0.860016942f, 0.34557128f},
-std::array<float,2>{0.0344481915f, 0.940336645f},
-std::array<float,2>{0.618469834f, 0.714838922f},
-std::array<float,2>{0.425070137f, 0.0154232569f},
-std::array<float,2>{0.657106161f, 0.294584244f},
-std::array<float,2>{0.299786389f, 0.919613838f},
-std::array<float,2>{0.971662581f, 0.659397781f},
-std::array<float,2>{0.247933269f, 0.12340644f},
-std::array<float,2>{0.754967034f, 0.208715051f},
-std::array<float,2>{0.0673046783f, 0.583262861f},
-std::array<float,2>{0.523315549f, 0.772868693f},
-std::array<float,2>{0.489920616f, 0.396884084f},
-std::array<float,2>{0.585417271f, 0.0467095748f},
-std::array<float,2>{0.405562907f, 0.730998158f},
-std::array<float,2>{0.81421721f, 0.973058581f},
-std::array<float,2>{0.0136581138f, 0.323365152f},
-std::array<float,2>{0.907352924f, 0.465823263f},
-std::array<float,2>{0.134834558f, 0.822438121f},
-std::array<float,2>{0.700901806f, 0.555897057f},
-std::array<float,2>{0.362797052f, 0.158710033f},
-std::array<float,2>{0.600831866f, 0.336129159f},
-std::array<float,2>{0.41638723f, 0.998681545f},
-std::array<float,2>{0.854677618f, 0.736103117f},
-std::array<float,2>{0.0624735504f, 0.0523618869f},
-std::array<float,2>{0.885450125f, 0.17984809f},
-std::array<float,2>{0.157016754f, 0.537927568f},
-std::array<float,2>{0.742830992f, 0.842416704f},
-std::array<float,2>{0.340379506f, 0.449724138f},
-std::array<float,2>{0.63834399f, 0.106165588f},
-std::array<float,2>{0.271923959f, 0.681120217f},
-std::array<float,2>{0.937764585f, 0.936856151f},
-std::array<float,2>{0.20512794f, 0.305573285f},
-std::array<float,2>{0.782295883f, 0.38304767f},
-std::array<float,2>{0.123473927f, 0.753811896f},
-std::array<float,2>{0.540616691f, 0.571012437f},
-std::array<float,2>{0.464016378f, 0.19581832f},
-std::array<float,2>{0.711268425f, 0.487371147f},
-std::array<float,2>{0.35596019f, 0.844287872f},
-std::array<float,2>{0.922882318f, 0.512356997f},
-std::array<float,2>{0.15439871f, 0.151361257f},
-std::array<float,2>{0.830343246f, 0.0160247367f},
-std::array<float,2>{0.0292869359f, 0.695762098f},
-std::array<float,2>{0.565932751f, 0.96311146f},
-std::array<float,2>{0.389877647f, 0.374361128f},
-std::array<float,2>{0.500432372f, 0.241080955f},
-std::array<float,2>{0.480009317f, 0.599748552f},
-std::array<float,2>{0.767111599f, 0.811460078f},
-std::array<float,2>{0.0936645269f, 0.41018042f},
-std::array<float,2>{0.994540989f, 0.262617648f},
-std::array<float,2>{0.23017399f, 0.890521109f},
-std::array<float,2>{0.678101301f, 0.655799747f},
-std::array<float,2>{0.295453012f, 0.0817477033f},
-std::array<float,2>{0.590153158f, 0.388408631f},
-std::array<float,2>{0.396158725f, 0.755686522f},
-std::array<float,2>{0.82257849f, 0.577780426f},
-std::array<float,2>{0.00779851899f, 0.202387512f},
-std::array<float,2>{0.917744458f, 0.103220612f},
-std::array<float,2>{0.129416913f, 0.685284019f},
-std::array<float,2>{0.68960923f, 0.932546794f},
-std::array<float,2>{0.369514495f, 0.310047448f},
-std::array<float,2>{0.667419136f, 0.186645895f},
-std::array<float,2>{0.304809421f, 0.532023549f},
-std::array<float,2>{0.98185724f, 0.839043975f},
-std::array<float,2>{0.238700345f, 0.449039131f},
-std::array<float,2>{0.758205831f, 0.342265308f},
-std::array<float,2>{0.0723048374f, 0.993410051f},
-std::array<float,2>{0.528315425f, 0.740424395f},
-std::array<float,2>{0.496890247f, 0.0495386086f},
-std::array<float,2>{0.729973614f, 0.260738581f},
-std::array<float,2>{0.324997842f, 0.884571612f},
-std::array<float,2>{0.903405964f, 0.650793791f},
-std::array<float,2>{0.182157978f, 0.0827301294f},
-std::array<float,2>{0.87392664f, 0.235325411f},
-std::array<float,2>{0.0438614525f, 0.596619487f},
-std::array<float,2>{0.615169585f, 0.805176139f},
-std::array<float,2>{0.43456623f, 0.407780886f},
-std::array<float,2>{0.552865088f, 0.021920627f},
-std::array<float,2>{0.439454824f, 0.69981873f},
-std::array<float,2>{0.811976552f, 0.967429638f},
-std::array<float,2>{0.100775622f, 0.370628506f},
-std::array<float,2>{0.956026137f, 0.489623576f},
-std::array<float,2>{0.189148456f, 0.851488948f},
-std::array<float,2>{0.646337748f, 0.508386433f},
-std::array<float,2>{0.26037845f, 0.154463693f},
-std::array<float,2>{0.512572408f, 0.34841758f},
-std::array<float,2>{0.474589169f, 0.943970978f},
-std::array<float,2>{0.775343776f, 0.71586895f},
-std::array<float,2>{0.0836774558f, 0.00952048041f},
-std::array<float,2>{0.98483932f, 0.132287249f},
-std::array<float,2>{0.225358635f, 0.525603771f},
-std::array<float,2>{0.683999777f, 0.866329253f},
-std::array<float,2>{0.288926959f, 0.481424421f},
-std::array<float,2>{0.704834402f, 0.0697808415f},
-std::array<float,2>{0.35068664f, 0.637148142f},
-std::array<float,2>{0.93426615f, 0.904502928f},
-std::array<float,2>{0.146293774f, 0.266790837f},
-std::array<float,2>{0.837885261f, 0.436408103f},
-std::array<float,2>{0.0222158041f, 0.792269468f},
-std::array<float,2>{0.573411226f, 0.616238177f},
-std::array<float,2>{0.380560815f, 0.218829721f},
-std::array<float,2>{0.628418922f, 0.463600814f},
-std::array<float,2>{0.27691251f, 0.827852428f},
-std::array<float,2>{0.946213424f, 0.562447906f},
-std::array<float,2>{0.212903023f, 0.16394566f},
-std::array<float,2>{0.790352702f, 0.0401672833f},
-std::array<float,2>{0.113524541f, 0.72781527f},
-std::array<float,2>{0.537409186f, 0.970339537f},
-std::array<float,2>{0.458027303f, 0.327356726f},
-std::array<float,2>{0.606135726f, 0.207021922f},
-std::array<float,2>{0.413207591f, 0.578561187f},
-std::array<float,2>{0.845181882f, 0.768983305f},
-std::array<float,2>{0.0490876883f, 0.39331907f},
-std::array<float,2>{0.88155961f, 0.290342182f},
-std::array<float,2>{0.169839308f, 0.916872203f},
-std::array<float,2>{0.742149055f, 0.662944376f},
-std::array<float,2>{0.330936193f, 0.120850012f},
-std::array<float,2>{0.545975566f, 0.470434129f},
-std::array<float,2>{0.467638731f, 0.87495625f},
-std::array<float,2>{0.785770178f, 0.516432643f},
-std::array<float,2>{0.118894666f, 0.136834651f},
-std::array<float,2>{0.942256212f, 0.00138983468f},
-std::array<float,2>{0.207927942f, 0.705510139f},
-std::array<float,2>{0.634558439f, 0.949487925f},
-std::array<float,2>{0.266281158f, 0.354537427f},
-std::array<float,2>{0.748036087f, 0.231207877f},
-std::array<float,2>{0.336676955f, 0.617731929f},
-std::array<float,2>{0.889285505f, 0.785825312f},
-std::array<float,2>{0.160640195f, 0.4238123f},
-std::array<float,2>{0.858821809f, 0.279357523f},
-std::array<float,2>{0.0564219318f, 0.894098639f},
-std::array<float,2>{0.596714377f, 0.628338397f},
-std::array<float,2>{0.417995989f, 0.0705786198f},
-std::array<float,2>{0.672516465f, 0.320043713f},
-std::array<float,2>{0.289927304f, 0.980972648f},
-std::array<float,2>{0.999399841f, 0.726132035f},
-std::array<float,2>{0.233205155f, 0.0377320014f},
-std::array<float,2>{0.77341485f, 0.170156732f},
-std::array<float,2>{0.0887975842f, 0.553786218f},
-std::array<float,2>{0.504002035f, 0.82024914f},
-std::array<float,2>{0.480763674f, 0.455988824f},
-std::array<float,2>{0.568555593f, 0.112632014f},
-std::array<float,2>{0.383371353f, 0.667457581f},
-std::array<float,2>{0.833155692f, 0.910789907f},
-std::array<float,2>{0.0235387664f, 0.282662511f},
-std::array<float,2>{0.928928018f, 0.404026568f},
-std::array<float,2>{0.1518922f, 0.776490748f},
-std::array<float,2>{0.718317866f, 0.592749f},
-std::array<float,2>{0.351712316f, 0.214523911f},
-std::array<float,2>{0.624717236f, 0.299810916f},
-std::array<float,2>{0.428939223f, 0.924298048f},
-std::array<float,2>{0.864215136f, 0.671916366f},
-std::array<float,2>{0.0384269096f, 0.0980627313f},
-std::array<float,2>{0.892231882f, 0.194539353f},
-std::array<float,2>{0.179003924f, 0.56793195f},
-std::array<float,2>{0.721221328f, 0.758679807f},
-std::array<float,2>{0.313079327f, 0.375169784f},
-std::array<float,2>{0.653316259f, 0.0576887019f},
-std::array<float,2>{0.255624205f, 0.747910798f},
-std::array<float,2>{0.962969124f, 0.991341233f},
-std::array<float,2>{0.199599102f, 0.331322402f},
-std::array<float,2>{0.799010813f, 0.438953698f},
-std::array<float,2>{0.106089137f, 0.831986368f},
-std::array<float,2>{0.558142543f, 0.545541108f},
-std::array<float,2>{0.445867479f, 0.177734762f},
-std::array<float,2>{0.698177218f, 0.418441892f},
-std::array<float,2>{0.367067337f, 0.801045418f},
-std::array<float,2>{0.913069069f, 0.608780861f},
-std::array<float,2>{0.137373671f, 0.246131182f},
-std::array<float,2>{0.819913387f, 0.0870000571f},
-std::array<float,2>{0.0116525907f, 0.648012221f},
-std::array<float,2>{0.581341207f, 0.879235148f},
-std::array<float,2>{0.401438802f, 0.250825256f},
-std::array<float,2>{0.51854831f, 0.147384733f},
-std::array<float,2>{0.486922055f, 0.505698562f},
-std::array<float,2>{0.753435552f, 0.858817637f},
-std::array<float,2>{0.0632296056f, 0.494984925f},
-std::array<float,2>{0.973390102f, 0.366978884f},
-std::array<float,2>{0.245337889f, 0.954024374f},
-std::array<float,2>{0.662868381f, 0.694586515f},
-std::array<float,2>{0.304346055f, 0.0288697332f},
-std::array<float,2>{0.599426448f, 0.449521422f},
-std::array<float,2>{0.414500982f, 0.841972113f},
-std::array<float,2>{0.852607489f, 0.537116051f},
-std::array<float,2>{0.0594302453f, 0.180368617f},
-std::array<float,2>{0.884630978f, 0.0520809293f},
-std::array<float,2>{0.15820621f, 0.735650063f},
-std::array<float,2>{0.744922101f, 0.998201907f},
-std::array<float,2>{0.342179626f, 0.336435854f},
-std::array<float,2>{0.638808548f, 0.195604667f},
-std::array<float,2>{0.270517975f, 0.570681691f},
-std::array<float,2>{0.940647066f, 0.753075957f},
-std::array<float,2>{0.205012932f, 0.38368839f},
-std::array<float,2>{0.785130441f, 0.305104673f},
-std::array<float,2>{0.12155889f, 0.937020361f},
-std::array<float,2>{0.541184902f, 0.681251943f},
-std::array<float,2>{0.461125493f, 0.105910882f},
-std::array<float,2>{0.713827312f, 0.374712437f},
-std::array<float,2>{0.357631624f, 0.963543773f},
-std::array<float,2>{0.924749732f, 0.696239889f},
-std::array<float,2>{0.153546765f, 0.0164152086f},
-std::array<float,2>{0.828497887f, 0.150780872f},
-std::array<float,2>{0.0300326496f, 0.51194942f},
-std::array<float,2>{0.564352393f, 0.843765736f},
-std::array<float,2>{0.386960328f, 0.488033891f},
-std::array<float,2>{0.502181292f, 0.0813967511f},
-std::array<float,2>{0.477682769f, 0.655525982f},
-std::array<float,2>{0.768171012f, 0.890035987f},
-std::array<float,2>{0.0901520401f, 0.261894375f},
-std::array<float,2>{0.993321478f, 0.410657823f},
-std::array<float,2>{0.228284523f, 0.810753763f},
-std::array<float,2>{0.676113367f, 0.600332618f},
-std::array<float,2>{0.293143481f, 0.240427479f},
-std::array<float,2>{0.56225282f, 0.270598263f},
-std::array<float,2>{0.450213909f, 0.902067482f},
-std::array<float,2>{0.804621518f, 0.636455953f},
-std::array<float,2>{0.101858981f, 0.0651618689f},
-std::array<float,2>{0.96502167f, 0.223439217f},
-std::array<float,2>{0.197115928f, 0.610266626f},
-std::array<float,2>{0.651624978f, 0.793465674f},
-std::array<float,2>{0.253593445f, 0.433045745f},
-std::array<float,2>{0.724769533f, 0.0147784427f},
-std::array<float,2>{0.316711724f, 0.713874578f},
-std::array<float,2>{0.895535171f, 0.939709127f},
-std::array<float,2>{0.174471095f, 0.344888061f},
-std::array<float,2>{0.862941623f, 0.476737827f},
-std::array<float,2>{0.0327052251f, 0.862845898f},
-std::array<float,2>{0.619343221f, 0.5299986f},
-std::array<float,2>{0.42190823f, 0.127331525f},
-std::array<float,2>{0.658813655f, 0.397133738f},
-std::array<float,2>{0.297479212f, 0.773429871f},
-std::array<float,2>{0.968920708f, 0.583723247f},
-std::array<float,2>{0.249773264f, 0.208143875f},
-std::array<float,2>{0.75603646f, 0.123738945f},
-std::array<float,2>{0.0685471967f, 0.659706831f},
-std::array<float,2>{0.520922959f, 0.919361889f},
-std::array<float,2>{0.491918504f, 0.294397205f},
-std::array<float,2>{0.583216608f, 0.158339292f},
-std::array<float,2>{0.40378648f, 0.556382656f},
-std::array<float,2>{0.815247357f, 0.823079228f},
-std::array<float,2>{0.0141507806f, 0.466438502f},
-std::array<float,2>{0.908263266f, 0.323837817f},
-std::array<float,2>{0.134380981f, 0.973399818f},
-std::array<float,2>{0.701538622f, 0.730520546f},
-std::array<float,2>{0.359488696f, 0.0461182706f},
-std::array<float,2>{0.526021361f, 0.429396212f},
-std::array<float,2>{0.495968997f, 0.783727348f},
-std::array<float,2>{0.765155852f, 0.623118281f},
-std::array<float,2>{0.0758468732f, 0.229770809f},
-std::array<float,2>{0.979894936f, 0.0754083693f},
-std::array<float,2>{0.237617388f, 0.63272357f},
-std::array<float,2>{0.669706106f, 0.896484256f},
-std::array<float,2>{0.311650425f, 0.275766104f},
-std::array<float,2>{0.692608893f, 0.135909572f},
-std::array<float,2>{0.373910427f, 0.520845115f},
-std::array<float,2>{0.918601811f, 0.867246389f},
-std::array<float,2>{0.127258301f, 0.476174802f},
-std::array<float,2>{0.827989161f, 0.356165975f},
-std::array<float,2>{0.00315785478f, 0.947421134f},
-std::array<float,2>{0.587685823f, 0.70972383f},
-std::array<float,2>{0.393428028f, 0.0074719456f},
-std::array<float,2>{0.643995762f, 0.286102802f},
-std::array<float,2>{0.263881356f, 0.90776366f},
-std::array<float,2>{0.958041012f, 0.671408594f},
-std::array<float,2>{0.194039792f, 0.116935186f},
-std::array<float,2>{0.80855912f, 0.217124909f},
-std::array<float,2>{0.0942853168f, 0.585953414f},
-std::array<float,2>{0.547003388f, 0.780223906f},
-std::array<float,2>{0.443290561f, 0.400670081f},
-std::array<float,2>{0.612733603f, 0.0345020331f},
-std::array<float,2>{0.432779402f, 0.720849514f},
-std::array<float,2>{0.870583653f, 0.977200449f},
-std::array<float,2>{0.039677348f, 0.314681947f},
-std::array<float,2>{0.900307953f, 0.458195657f},
-std::array<float,2>{0.186677366f, 0.815533221f},
-std::array<float,2>{0.730561554f, 0.549790323f},
-std::array<float,2>{0.32386893f, 0.165454954f},
-std::array<float,2>{0.576684892f, 0.335606754f},
-std::array<float,2>{0.378884226f, 0.986589253f},
-std::array<float,2>{0.841112316f, 0.742440581f},
-std::array<float,2>{0.0192726068f, 0.0610436536f},
-std::array<float,2>{0.933229685f, 0.172669604f},
-std::array<float,2>{0.142719314f, 0.54051435f},
-std::array<float,2>{0.708038151f, 0.832151055f},
-std::array<float,2>{0.346372634f, 0.442815691f},
-std::array<float,2>{0.682399511f, 0.0957265869f},
-std::array<float,2>{0.281973541f, 0.678191841f},
-std::array<float,2>{0.988697886f, 0.929507673f},
-std::array<float,2>{0.218854472f, 0.304393888f},
-std::array<float,2>{0.780845523f, 0.379740357f},
-std::array<float,2>{0.078321971f, 0.764975965f},
-std::array<float,2>{0.50887233f, 0.562744617f},
-std::array<float,2>{0.4714351f, 0.190634757f},
-std::array<float,2>{0.736325562f, 0.497070909f},
-std::array<float,2>{0.334288418f, 0.855144382f},
-std::array<float,2>{0.875870109f, 0.503792048f},
-std::array<float,2>{0.167238519f, 0.143526629f},
-std::array<float,2>{0.849279106f, 0.0271711461f},
-std::array<float,2>{0.0528610088f, 0.690448105f},
-std::array<float,2>{0.604334235f, 0.958595753f},
-std::array<float,2>{0.409199029f, 0.360001385f},
-std::array<float,2>{0.535010397f, 0.242189303f},
-std::array<float,2>{0.456784725f, 0.605235457f},
-std::array<float,2>{0.795232713f, 0.799913228f},
-std::array<float,2>{0.111642942f, 0.415571004f},
-std::array<float,2>{0.951901853f, 0.256299078f},
-std::array<float,2>{0.216380328f, 0.876758873f},
-std::array<float,2>{0.63272351f, 0.640848458f},
-std::array<float,2>{0.278543025f, 0.0934468657f},
-std::array<float,2>{0.616685748f, 0.40875569f},
-std::array<float,2>{0.436332524f, 0.80833298f},
-std::array<float,2>{0.871860743f, 0.595222116f},
-std::array<float,2>{0.0452260487f, 0.236936271f},
-std::array<float,2>{0.904410362f, 0.0856922492f},
-std::array<float,2>{0.180380881f, 0.650373101f},
-std::array<float,2>{0.72718662f, 0.885646105f},
-std::array<float,2>{0.327159375f, 0.258921444f},
-std::array<float,2>{0.647218764f, 0.153774157f},
-std::array<float,2>{0.258007288f, 0.511416554f},
-std::array<float,2>{0.953358352f, 0.848869145f},
-std::array<float,2>{0.190587476f, 0.490716875f},
-std::array<float,2>{0.808719635f, 0.368777484f},
-std::array<float,2>{0.0987086669f, 0.965371966f},
-std::array<float,2>{0.551497221f, 0.70118016f},
-std::array<float,2>{0.439216524f, 0.0204201378f},
-std::array<float,2>{0.688248098f, 0.312133849f},
-std::array<float,2>{0.368950635f, 0.930465639f},
-std::array<float,2>{0.914331734f, 0.686344624f},
-std::array<float,2>{0.132779106f, 0.103880875f},
-std::array<float,2>{0.820846558f, 0.200411335f},
-std::array<float,2>{0.00557957543f, 0.575986266f},
-std::array<float,2>{0.591933727f, 0.756980419f},
-std::array<float,2>{0.397209346f, 0.390037209f},
-std::array<float,2>{0.530703843f, 0.0475806966f},
-std::array<float,2>{0.499081701f, 0.739157081f},
-std::array<float,2>{0.761693478f, 0.995131135f},
-std::array<float,2>{0.0704149455f, 0.340213656f},
-std::array<float,2>{0.982966959f, 0.445901632f},
-std::array<float,2>{0.241312623f, 0.837266266f},
-std::array<float,2>{0.665444791f, 0.533793271f},
-std::array<float,2>{0.306927979f, 0.18473731f},
-std::array<float,2>{0.53666836f, 0.324549228f},
-std::array<float,2>{0.460171163f, 0.972620308f},
-std::array<float,2>{0.791802108f, 0.730003417f},
-std::array<float,2>{0.115711667f, 0.0410537794f},
-std::array<float,2>{0.948307097f, 0.161728725f},
-std::array<float,2>{0.211138725f, 0.560054004f},
-std::array<float,2>{0.625728607f, 0.825373828f},
-std::array<float,2>{0.273492545f, 0.462622881f},
-std::array<float,2>{0.739199162f, 0.117583938f},
-std::array<float,2>{0.328908533f, 0.662002027f},
-std::array<float,2>{0.879074216f, 0.914579332f},
-std::array<float,2>{0.17098543f, 0.29292956f},
-std::array<float,2>{0.847443283f, 0.392423153f},
-std::array<float,2>{0.0469606258f, 0.766455173f},
-std::array<float,2>{0.607720315f, 0.580722213f},
-std::array<float,2>{0.411336184f, 0.204277128f},
-std::array<float,2>{0.68671912f, 0.482682616f},
-std::array<float,2>{0.28699699f, 0.865177214f},
-std::array<float,2>{0.98739326f, 0.52450788f},
-std::array<float,2>{0.224391505f, 0.129116729f},
-std::array<float,2>{0.775740921f, 0.0112523409f},
-std::array<float,2>{0.0847048163f, 0.717853844f},
-std::array<float,2>{0.515379429f, 0.942431092f},
-std::array<float,2>{0.475561708f, 0.350097746f},
-std::array<float,2>{0.571241915f, 0.221392959f},
-std::array<float,2>{0.381136119f, 0.613589048f},
-std::array<float,2>{0.838906467f, 0.790744424f},
-std::array<float,2>{0.019728221f, 0.43476516f},
-std::array<float,2>{0.936113417f, 0.269446135f},
-std::array<float,2>{0.146914124f, 0.902597725f},
-std::array<float,2>{0.706319749f, 0.639088452f},
-std::array<float,2>{0.348982453f, 0.068175137f},
-std::array<float,2>{0.506326318f, 0.454206854f},
-std::array<float,2>{0.483364701f, 0.817496598f},
-std::array<float,2>{0.771033585f, 0.551238f},
-std::array<float,2>{0.087220706f, 0.169285357f},
-std::array<float,2>{0.997419655f, 0.0361545384f},
-std::array<float,2>{0.231395513f, 0.724371552f},
-std::array<float,2>{0.674418032f, 0.983416557f},
-std::array<float,2>{0.291318178f, 0.317974359f},
-std::array<float,2>{0.715504885f, 0.211399108f},
-std::array<float,2>{0.355344415f, 0.590301991f},
-std::array<float,2>{0.92726028f, 0.774234533f},
-std::array<float,2>{0.149756312f, 0.406071991f},
-std::array<float,2>{0.834947884f, 0.283830762f},
-std::array<float,2>{0.026188856f, 0.912692487f},
-std::array<float,2>{0.5681867f, 0.664961338f},
-std::array<float,2>{0.386484772f, 0.110199176f},
-std::array<float,2>{0.636484921f, 0.351663291f},
-std::array<float,2>{0.268796742f, 0.951662779f},
-std::array<float,2>{0.944018781f, 0.705060422f},
-std::array<float,2>{0.209231332f, 0.00232288451f},
-std::array<float,2>{0.787843049f, 0.140577957f},
-std::array<float,2>{0.120823801f, 0.519301057f},
-std::array<float,2>{0.543419421f, 0.872588277f},
-std::array<float,2>{0.465231359f, 0.471114814f},
-std::array<float,2>{0.595084012f, 0.0724601075f},
-std::array<float,2>{0.420415968f, 0.625779033f},
-std::array<float,2>{0.85739547f, 0.891685188f},
-std::array<float,2>{0.0576427244f, 0.278523713f},
-std::array<float,2>{0.886992216f, 0.425746858f},
-std::array<float,2>{0.163362309f, 0.788198769f},
-std::array<float,2>{0.748699605f, 0.620680094f},
-std::array<float,2>{0.338150054f, 0.232672811f},
-std::array<float,2>{0.578211665f, 0.252888203f},
-std::array<float,2>{0.39887929f, 0.881998718f},
-std::array<float,2>{0.817630827f, 0.645953238f},
-std::array<float,2>{0.00842736661f, 0.0893916115f},
-std::array<float,2>{0.911133826f, 0.248575553f},
-std::array<float,2>{0.139040366f, 0.605748951f},
-std::array<float,2>{0.696391165f, 0.804432988f},
-std::array<float,2>{0.364081502f, 0.421823233f},
-std::array<float,2>{0.662085593f, 0.0294692796f},
-std::array<float,2>{0.302703857f, 0.691520512f},
-std::array<float,2>{0.975413144f, 0.955575883f},
-std::array<float,2>{0.242480189f, 0.363650084f},
-std::array<float,2>{0.750768185f, 0.493961036f},
-std::array<float,2>{0.0651641786f, 0.856913447f},
-std::array<float,2>{0.515885115f, 0.506598592f},
-std::array<float,2>{0.485399038f, 0.145241424f},
-std::array<float,2>{0.718920529f, 0.377691388f},
-std::array<float,2>{0.316320479f, 0.761562765f},
-std::array<float,2>{0.893121064f, 0.570232213f},
-std::array<float,2>{0.176096767f, 0.191551849f},
-std::array<float,2>{0.866986573f, 0.100780897f},
-std::array<float,2>{0.0369553901f, 0.675029099f},
-std::array<float,2>{0.62130475f, 0.922958374f},
-std::array<float,2>{0.427472413f, 0.29757607f},
-std::array<float,2>{0.556229949f, 0.175849453f},
-std::array<float,2>{0.448385954f, 0.543275654f},
-std::array<float,2>{0.797231197f, 0.82955271f},
-std::array<float,2>{0.108615778f, 0.440333366f},
-std::array<float,2>{0.961104512f, 0.328412801f},
-std::array<float,2>{0.20166333f, 0.988646626f},
-std::array<float,2>{0.655538023f, 0.749544322f},
-std::array<float,2>{0.257697999f, 0.0549908355f},
-std::array<float,2>{0.565710723f, 0.486244619f},
-std::array<float,2>{0.390420288f, 0.846426904f},
-std::array<float,2>{0.831004024f, 0.515321314f},
-std::array<float,2>{0.0285139084f, 0.150008202f},
-std::array<float,2>{0.923820734f, 0.0194702409f},
-std::array<float,2>{0.155166239f, 0.698193312f},
-std::array<float,2>{0.711897433f, 0.962449193f},
-std::array<float,2>{0.355940551f, 0.37264958f},
-std::array<float,2>{0.67831707f, 0.239463449f},
-std::array<float,2>{0.295225203f, 0.599523962f},
-std::array<float,2>{0.994963288f, 0.80868113f},
-std::array<float,2>{0.229505867f, 0.413776308f},
-std::array<float,2>{0.766838193f, 0.264941752f},
-std::array<float,2>{0.0931277946f, 0.8873083f},
-std::array<float,2>{0.500920177f, 0.652376533f},
-std::array<float,2>{0.479808062f, 0.0800534561f},
-std::array<float,2>{0.742318571f, 0.338627934f},
-std::array<float,2>{0.340209275f, 0.997402668f},
-std::array<float,2>{0.88523519f, 0.738164663f},
-std::array<float,2>{0.156537801f, 0.0533120558f},
-std::array<float,2>{0.855181098f, 0.183219597f},
-std::array<float,2>{0.0616087615f, 0.537105918f},
-std::array<float,2>{0.601260722f, 0.840993941f},
-std::array<float,2>{0.416771889f, 0.452884108f},
-std::array<float,2>{0.540352285f, 0.108401336f},
-std::array<float,2>{0.464400172f, 0.682070673f},
-std::array<float,2>{0.782784879f, 0.934648097f},
-std::array<float,2>{0.123880751f, 0.307233214f},
-std::array<float,2>{0.938068032f, 0.385877997f},
-std::array<float,2>{0.205606341f, 0.750213087f},
-std::array<float,2>{0.638010263f, 0.572676361f},
-std::array<float,2>{0.272200763f, 0.197334632f},
-std::array<float,2>{0.522573829f, 0.295513093f},
-std::array<float,2>{0.489633888f, 0.92004323f},
-std::array<float,2>{0.755682409f, 0.657732248f},
-std::array<float,2>{0.0667182654f, 0.12192367f},
-std::array<float,2>{0.970818043f, 0.209083229f},
-std::array<float,2>{0.247212738f, 0.585808218f},
-std::array<float,2>{0.656395614f, 0.770292222f},
-std::array<float,2>{0.29923591f, 0.395329744f},
-std::array<float,2>{0.700593889f, 0.0444440283f},
-std::array<float,2>{0.362748414f, 0.734071255f},
-std::array<float,2>{0.907763898f, 0.975714266f},
-std::array<float,2>{0.135692522f, 0.321688265f},
-std::array<float,2>{0.813757598f, 0.467852116f},
-std::array<float,2>{0.0129193179f, 0.822217345f},
-std::array<float,2>{0.585866094f, 0.557510734f},
-std::array<float,2>{0.406228691f, 0.157331809f},
-std::array<float,2>{0.650140882f, 0.431355804f},
-std::array<float,2>{0.251521826f, 0.795606494f},
-std::array<float,2>{0.968706369f, 0.612551212f},
-std::array<float,2>{0.19905591f, 0.225554496f},
-std::array<float,2>{0.802149892f, 0.0644458383f},
-std::array<float,2>{0.104033098f, 0.633970141f},
-std::array<float,2>{0.558737099f, 0.899777472f},
-std::array<float,2>{0.452751249f, 0.27304855f},
-std::array<float,2>{0.618754327f, 0.12681891f},
-std::array<float,2>{0.425348014f, 0.527866066f},
-std::array<float,2>{0.859829307f, 0.860055804f},
-std::array<float,2>{0.0351310074f, 0.479344338f},
-std::array<float,2>{0.898130894f, 0.347539961f},
-std::array<float,2>{0.17364265f, 0.93923831f},
-std::array<float,2>{0.722771645f, 0.711006045f},
-std::array<float,2>{0.319313318f, 0.0129485885f},
-std::array<float,2>{0.549006522f, 0.39889124f},
-std::array<float,2>{0.444062173f, 0.779230773f},
-std::array<float,2>{0.806192577f, 0.588424742f},
-std::array<float,2>{0.0972653255f, 0.215257823f},
-std::array<float,2>{0.960147381f, 0.114489824f},
-std::array<float,2>{0.193071708f, 0.669122696f},
-std::array<float,2>{0.640860617f, 0.910057366f},
-std::array<float,2>{0.263251573f, 0.287204355f},
-std::array<float,2>{0.733008444f, 0.167344913f},
-std::array<float,2>{0.3222076f, 0.548741341f},
-std::array<float,2>{0.901628911f, 0.814116418f},
-std::array<float,2>{0.184962317f, 0.459597141f},
-std::array<float,2>{0.868357658f, 0.313717961f},
-std::array<float,2>{0.0412508547f, 0.979585826f},
-std::array<float,2>{0.611058652f, 0.719743848f},
-std::array<float,2>{0.430224597f, 0.0325648747f},
-std::array<float,2>{0.670360923f, 0.274937689f},
-std::array<float,2>{0.309832096f, 0.897861958f},
-std::array<float,2>{0.97761786f, 0.629958928f},
-std::array<float,2>{0.236061096f, 0.0763085112f},
-std::array<float,2>{0.763671279f, 0.227936685f},
-std::array<float,2>{0.0768089518f, 0.622830272f},
-std::array<float,2>{0.525026619f, 0.781477034f},
-std::array<float,2>{0.493632853f, 0.426091194f},
-std::array<float,2>{0.588113368f, 0.00528886542f},
-std::array<float,2>{0.391785294f, 0.708537698f},
-std::array<float,2>{0.824691653f, 0.945719302f},
-std::array<float,2>{3.41912018e-05f, 0.358709276f},
-std::array<float,2>{0.921397626f, 0.473767191f},
-std::array<float,2>{0.125657186f, 0.869177341f},
-std::array<float,2>{0.695236683f, 0.522970915f},
-std::array<float,2>{0.37192294f, 0.133795485f},
-std::array<float,2>{0.601701856f, 0.363233507f},
-std::array<float,2>{0.408044636f, 0.960667312f},
-std::array<float,2>{0.851145089f, 0.688651204f},
-std::array<float,2>{0.0522317663f, 0.0249736309f},
-std::array<float,2>{0.877488017f, 0.142216831f},
-std::array<float,2>{0.165292278f, 0.500855386f},
-std::array<float,2>{0.736968338f, 0.853037417f},
-std::array<float,2>{0.332058907f, 0.499304533f},
-std::array<float,2>{0.62945956f, 0.0912301615f},
-std::array<float,2>{0.279553533f, 0.643541157f},
-std::array<float,2>{0.949549675f, 0.878853977f},
-std::array<float,2>{0.216926724f, 0.254561007f},
-std::array<float,2>{0.793857455f, 0.416492879f},
-std::array<float,2>{0.110615186f, 0.797325432f},
-std::array<float,2>{0.532085419f, 0.602732778f},
-std::array<float,2>{0.453277647f, 0.24456431f},
-std::array<float,2>{0.709982336f, 0.444830954f},
-std::array<float,2>{0.344473928f, 0.835015297f},
-std::array<float,2>{0.930908024f, 0.542071402f},
-std::array<float,2>{0.142320201f, 0.175344199f},
-std::array<float,2>{0.842741132f, 0.0593439825f},
-std::array<float,2>{0.0161349718f, 0.74481076f},
-std::array<float,2>{0.575975239f, 0.985073209f},
-std::array<float,2>{0.376039475f, 0.333734065f},
-std::array<float,2>{0.511202216f, 0.188744694f},
-std::array<float,2>{0.469131142f, 0.566117525f},
-std::array<float,2>{0.778577924f, 0.762069523f},
-std::array<float,2>{0.0812763199f, 0.381143808f},
-std::array<float,2>{0.990914285f, 0.301765025f},
-std::array<float,2>{0.221497983f, 0.926618814f},
-std::array<float,2>{0.681414664f, 0.677066624f},
-std::array<float,2>{0.283887297f, 0.0939331949f},
-std::array<float,2>{0.572342515f, 0.43386516f},
-std::array<float,2>{0.379020751f, 0.789723158f},
-std::array<float,2>{0.836096883f, 0.614397764f},
-std::array<float,2>{0.0228266772f, 0.22257112f},
-std::array<float,2>{0.935239196f, 0.0669737756f},
-std::array<float,2>{0.14485845f, 0.639650702f},
-std::array<float,2>{0.704067409f, 0.90427202f},
-std::array<float,2>{0.349640876f, 0.268247694f},
-std::array<float,2>{0.685338855f, 0.130755991f},
-std::array<float,2>{0.287857324f, 0.524183035f},
-std::array<float,2>{0.986016691f, 0.863333762f},
-std::array<float,2>{0.225798666f, 0.483475775f},
-std::array<float,2>{0.774225235f, 0.35113439f},
-std::array<float,2>{0.0826396048f, 0.94164151f},
-std::array<float,2>{0.512988985f, 0.717271686f},
-std::array<float,2>{0.472766042f, 0.0102236727f},
-std::array<float,2>{0.741056859f, 0.29145956f},
-std::array<float,2>{0.331103474f, 0.915795743f},
-std::array<float,2>{0.882124066f, 0.660320163f},
-std::array<float,2>{0.168306082f, 0.118520759f},
-std::array<float,2>{0.844165504f, 0.203815773f},
-std::array<float,2>{0.0505651124f, 0.58134371f},
-std::array<float,2>{0.606740654f, 0.767474115f},
-std::array<float,2>{0.412389636f, 0.390720248f},
-std::array<float,2>{0.53829968f, 0.0421448424f},
-std::array<float,2>{0.457128584f, 0.728860795f},
-std::array<float,2>{0.789918363f, 0.971553624f},
-std::array<float,2>{0.114944436f, 0.325232834f},
-std::array<float,2>{0.946802616f, 0.461576551f},
-std::array<float,2>{0.213955447f, 0.824376166f},
-std::array<float,2>{0.627661526f, 0.559544921f},
-std::array<float,2>{0.276059031f, 0.16074203f},
-std::array<float,2>{0.528405845f, 0.340866089f},
-std::array<float,2>{0.497583479f, 0.994744897f},
-std::array<float,2>{0.758816719f, 0.739700854f},
-std::array<float,2>{0.0736551583f, 0.0483892336f},
-std::array<float,2>{0.980903149f, 0.184251025f},
-std::array<float,2>{0.239864752f, 0.53511095f},
-std::array<float,2>{0.666685998f, 0.835940659f},
-std::array<float,2>{0.306239605f, 0.446628928f},
-std::array<float,2>{0.691036046f, 0.104510561f},
-std::array<float,2>{0.370277435f, 0.687207282f},
-std::array<float,2>{0.916887462f, 0.931548059f},
-std::array<float,2>{0.130828679f, 0.311189502f},
-std::array<float,2>{0.824166059f, 0.38871339f},
-std::array<float,2>{0.00656806771f, 0.75599283f},
-std::array<float,2>{0.591476798f, 0.574962497f},
-std::array<float,2>{0.394753635f, 0.19950074f},
-std::array<float,2>{0.644924045f, 0.491640538f},
-std::array<float,2>{0.261264861f, 0.848572075f},
-std::array<float,2>{0.956170201f, 0.509804249f},
-std::array<float,2>{0.188258305f, 0.153119773f},
-std::array<float,2>{0.810592055f, 0.0211842582f},
-std::array<float,2>{0.100231789f, 0.702229857f},
-std::array<float,2>{0.55433619f, 0.966445506f},
-std::array<float,2>{0.441356927f, 0.368039757f},
-std::array<float,2>{0.614011884f, 0.237600043f},
-std::array<float,2>{0.435324848f, 0.59397018f},
-std::array<float,2>{0.874115944f, 0.807430804f},
-std::array<float,2>{0.04449898f, 0.409339458f},
-std::array<float,2>{0.902933538f, 0.257858306f},
-std::array<float,2>{0.182713747f, 0.885759234f},
-std::array<float,2>{0.729429066f, 0.648687303f},
-std::array<float,2>{0.325761497f, 0.0849440694f},
-std::array<float,2>{0.557151377f, 0.440606117f},
-std::array<float,2>{0.447039992f, 0.828839779f},
-std::array<float,2>{0.800175965f, 0.544557512f},
-std::array<float,2>{0.10727296f, 0.177128971f},
-std::array<float,2>{0.964308858f, 0.0564817525f},
-std::array<float,2>{0.20034039f, 0.748071313f},
-std::array<float,2>{0.654260516f, 0.989859164f},
-std::array<float,2>{0.254665107f, 0.329124302f},
-std::array<float,2>{0.722467124f, 0.192616627f},
-std::array<float,2>{0.314363241f, 0.568501234f},
-std::array<float,2>{0.891070187f, 0.760732353f},
-std::array<float,2>{0.178273767f, 0.378854692f},
-std::array<float,2>{0.865233123f, 0.298363149f},
-std::array<float,2>{0.0372190624f, 0.922340631f},
-std::array<float,2>{0.623221815f, 0.673915446f},
-std::array<float,2>{0.428166777f, 0.100388199f},
-std::array<float,2>{0.663489342f, 0.364774674f},
-std::array<float,2>{0.302935004f, 0.956772149f},
-std::array<float,2>{0.973703921f, 0.693126202f},
-std::array<float,2>{0.244357407f, 0.0310693923f},
-std::array<float,2>{0.752631843f, 0.146289587f},
-std::array<float,2>{0.0644240528f, 0.50735414f},
-std::array<float,2>{0.518733859f, 0.856401026f},
-std::array<float,2>{0.488280743f, 0.492313325f},
-std::array<float,2>{0.580463111f, 0.0879271328f},
-std::array<float,2>{0.401291788f, 0.644532442f},
-std::array<float,2>{0.819254279f, 0.881614149f},
-std::array<float,2>{0.00977577921f, 0.253750026f},
-std::array<float,2>{0.913340867f, 0.419969529f},
-std::array<float,2>{0.138504252f, 0.803054631f},
-std::array<float,2>{0.698736548f, 0.607377291f},
-std::array<float,2>{0.365828454f, 0.249287531f},
-std::array<float,2>{0.595817983f, 0.278036922f},
-std::array<float,2>{0.419092536f, 0.891495585f},
-std::array<float,2>{0.858388543f, 0.626034915f},
-std::array<float,2>{0.0555623434f, 0.0740405545f},
-std::array<float,2>{0.890439272f, 0.233940542f},
-std::array<float,2>{0.161549404f, 0.619147182f},
-std::array<float,2>{0.746554017f, 0.787240744f},
-std::array<float,2>{0.336931854f, 0.423832774f},
-std::array<float,2>{0.632927299f, 0.00316478987f},
-std::array<float,2>{0.267418057f, 0.703358114f},
-std::array<float,2>{0.94310075f, 0.952413678f},
-std::array<float,2>{0.208129406f, 0.352565348f},
-std::array<float,2>{0.786477208f, 0.472570956f},
-std::array<float,2>{0.117250197f, 0.871155918f},
-std::array<float,2>{0.545113802f, 0.51832515f},
-std::array<float,2>{0.468551874f, 0.139594778f},
-std::array<float,2>{0.716860414f, 0.404659867f},
-std::array<float,2>{0.353003293f, 0.775020123f},
-std::array<float,2>{0.928678751f, 0.591534913f},
-std::array<float,2>{0.151195511f, 0.212652653f},
-std::array<float,2>{0.832219839f, 0.111160725f},
-std::array<float,2>{0.0253705308f, 0.665085256f},
-std::array<float,2>{0.570013046f, 0.913937092f},
-std::array<float,2>{0.38443023f, 0.284831136f},
-std::array<float,2>{0.50571239f, 0.168646842f},
-std::array<float,2>{0.481563956f, 0.552712619f},
-std::array<float,2>{0.771649063f, 0.817060173f},
-std::array<float,2>{0.0897537097f, 0.453480005f},
-std::array<float,2>{0.999009073f, 0.317253053f},
-std::array<float,2>{0.233574167f, 0.983197391f},
-std::array<float,2>{0.673572063f, 0.723011434f},
-std::array<float,2>{0.290627986f, 0.0353314392f},
-std::array<float,2>{0.620549798f, 0.479707211f},
-std::array<float,2>{0.422970444f, 0.860942483f},
-std::array<float,2>{0.861965656f, 0.528592944f},
-std::array<float,2>{0.0314932317f, 0.12517935f},
-std::array<float,2>{0.895220876f, 0.0124684684f},
-std::array<float,2>{0.175312832f, 0.712134361f},
-std::array<float,2>{0.726052761f, 0.938465476f},
-std::array<float,2>{0.317953706f, 0.346479744f},
-std::array<float,2>{0.650394499f, 0.226437569f},
-std::array<float,2>{0.252099633f, 0.612088025f},
-std::array<float,2>{0.965885222f, 0.796232224f},
-std::array<float,2>{0.195800781f, 0.430155069f},
-std::array<float,2>{0.802990377f, 0.272057354f},
-std::array<float,2>{0.102606371f, 0.899231732f},
-std::array<float,2>{0.561191618f, 0.633337319f},
-std::array<float,2>{0.449626029f, 0.0628845692f},
-std::array<float,2>{0.702821434f, 0.321027786f},
-std::array<float,2>{0.360934705f, 0.974871695f},
-std::array<float,2>{0.909307957f, 0.732647359f},
-std::array<float,2>{0.133170262f, 0.0433192626f},
-std::array<float,2>{0.81568414f, 0.156739935f},
-std::array<float,2>{0.015448668f, 0.557757199f},
-std::array<float,2>{0.582533956f, 0.820755899f},
-std::array<float,2>{0.402733952f, 0.467404634f},
-std::array<float,2>{0.519951344f, 0.122903794f},
-std::array<float,2>{0.490467429f, 0.656950653f},
-std::array<float,2>{0.757081032f, 0.921763659f},
-std::array<float,2>{0.0697573423f, 0.296871632f},
-std::array<float,2>{0.969976068f, 0.395687401f},
-std::array<float,2>{0.24806653f, 0.771059275f},
-std::array<float,2>{0.659478068f, 0.584652483f},
-std::array<float,2>{0.298597068f, 0.210628241f},
-std::array<float,2>{0.54203856f, 0.308533996f},
-std::array<float,2>{0.462837636f, 0.934268475f},
-std::array<float,2>{0.783223689f, 0.682983756f},
-std::array<float,2>{0.123011962f, 0.107474558f},
-std::array<float,2>{0.939896166f, 0.198293641f},
-std::array<float,2>{0.203748986f, 0.573887169f},
-std::array<float,2>{0.639968634f, 0.751644731f},
-std::array<float,2>{0.270410717f, 0.3849231f},
-std::array<float,2>{0.745496273f, 0.0537981093f},
-std::array<float,2>{0.343223095f, 0.736529589f},
-std::array<float,2>{0.883407533f, 0.996504843f},
-std::array<float,2>{0.159890831f, 0.339768797f},
-std::array<float,2>{0.852132559f, 0.451193362f},
-std::array<float,2>{0.0601256639f, 0.840334058f},
-std::array<float,2>{0.597769737f, 0.535381913f},
-std::array<float,2>{0.415435851f, 0.182308659f},
-std::array<float,2>{0.67710191f, 0.412387609f},
-std::array<float,2>{0.294268399f, 0.810045242f},
-std::array<float,2>{0.992606521f, 0.598483145f},
-std::array<float,2>{0.22673218f, 0.238339365f},
-std::array<float,2>{0.769284606f, 0.0785369948f},
-std::array<float,2>{0.0914224163f, 0.65420258f},
-std::array<float,2>{0.503064573f, 0.888041079f},
-std::array<float,2>{0.476791233f, 0.264439911f},
-std::array<float,2>{0.563421547f, 0.148639098f},
-std::array<float,2>{0.387912393f, 0.51459074f},
-std::array<float,2>{0.829611123f, 0.847242236f},
-std::array<float,2>{0.0303353444f, 0.485290945f},
-std::array<float,2>{0.925199091f, 0.371683747f},
-std::array<float,2>{0.152434036f, 0.961736202f},
-std::array<float,2>{0.714679897f, 0.699171901f},
-std::array<float,2>{0.358498305f, 0.0178501513f},
-std::array<float,2>{0.507963002f, 0.382146865f},
-std::array<float,2>{0.47251305f, 0.762765765f},
-std::array<float,2>{0.779696047f, 0.564645886f},
-std::array<float,2>{0.0794028044f, 0.188217729f},
-std::array<float,2>{0.989834368f, 0.0954069644f},
-std::array<float,2>{0.219820291f, 0.676521957f},
-std::array<float,2>{0.68350023f, 0.926888466f},
-std::array<float,2>{0.282847553f, 0.301578522f},
-std::array<float,2>{0.70713985f, 0.174297258f},
-std::array<float,2>{0.346872807f, 0.541390657f},
-std::array<float,2>{0.932282627f, 0.834724486f},
-std::array<float,2>{0.143721551f, 0.444335192f},
-std::array<float,2>{0.840654254f, 0.332799554f},
-std::array<float,2>{0.0178619865f, 0.98537004f},
-std::array<float,2>{0.577990413f, 0.745544851f},
-std::array<float,2>{0.377288342f, 0.0598816313f},
-std::array<float,2>{0.63165307f, 0.255361915f},
-std::array<float,2>{0.278319269f, 0.877181649f},
-std::array<float,2>{0.953085363f, 0.644163609f},
-std::array<float,2>{0.215435624f, 0.0898582339f},
-std::array<float,2>{0.796394467f, 0.245330036f},
-std::array<float,2>{0.112510175f, 0.601669192f},
-std::array<float,2>{0.533354938f, 0.797914445f},
-std::array<float,2>{0.455304086f, 0.417597234f},
-std::array<float,2>{0.604602396f, 0.024403289f},
-std::array<float,2>{0.409042865f, 0.688021958f},
-std::array<float,2>{0.84767288f, 0.959533691f},
-std::array<float,2>{0.0541597381f, 0.361638457f},
-std::array<float,2>{0.876945555f, 0.498711318f},
-std::array<float,2>{0.166662186f, 0.852322221f},
-std::array<float,2>{0.735019743f, 0.501238167f},
-std::array<float,2>{0.335574836f, 0.141108513f},
-std::array<float,2>{0.58638835f, 0.357960641f},
-std::array<float,2>{0.393723398f, 0.947098255f},
-std::array<float,2>{0.826765656f, 0.707868934f},
-std::array<float,2>{0.00226806314f, 0.00445733685f},
-std::array<float,2>{0.919123769f, 0.133626908f},
-std::array<float,2>{0.128313944f, 0.522386253f},
-std::array<float,2>{0.691452682f, 0.87052232f},
-std::array<float,2>{0.374736488f, 0.473001152f},
-std::array<float,2>{0.668529153f, 0.0775236711f},
-std::array<float,2>{0.310845822f, 0.629521906f},
-std::array<float,2>{0.979173839f, 0.896858454f},
-std::array<float,2>{0.236789212f, 0.273568571f},
-std::array<float,2>{0.764371037f, 0.426817417f},
-std::array<float,2>{0.0743299127f, 0.782678783f},
-std::array<float,2>{0.526646674f, 0.621816993f},
-std::array<float,2>{0.495004684f, 0.226986393f},
-std::array<float,2>{0.732225358f, 0.460431367f},
-std::array<float,2>{0.32260859f, 0.81337738f},
-std::array<float,2>{0.898888946f, 0.54736644f},
-std::array<float,2>{0.185664281f, 0.166149929f},
-std::array<float,2>{0.869326591f, 0.0321246944f},
-std::array<float,2>{0.040594846f, 0.719121397f},
-std::array<float,2>{0.611805797f, 0.978769362f},
-std::array<float,2>{0.431992203f, 0.313425779f},
-std::array<float,2>{0.548314691f, 0.216179684f},
-std::array<float,2>{0.441865444f, 0.589474082f},
-std::array<float,2>{0.806855142f, 0.778148234f},
-std::array<float,2>{0.0950081497f, 0.399785846f},
-std::array<float,2>{0.957392097f, 0.288765758f},
-std::array<float,2>{0.194725364f, 0.909072816f},
-std::array<float,2>{0.642992079f, 0.668596268f},
-std::array<float,2>{0.26478374f, 0.113731958f},
-std::array<float,2>{0.609126031f, 0.393673718f},
-std::array<float,2>{0.411043227f, 0.767662942f},
-std::array<float,2>{0.846468925f, 0.57941848f},
-std::array<float,2>{0.0486458056f, 0.205905318f},
-std::array<float,2>{0.880715847f, 0.11964266f},
-std::array<float,2>{0.170452163f, 0.663910449f},
-std::array<float,2>{0.739830732f, 0.917501271f},
-std::array<float,2>{0.329355717f, 0.289277703f},
-std::array<float,2>{0.626550555f, 0.162497014f},
-std::array<float,2>{0.274706244f, 0.560869336f},
-std::array<float,2>{0.947354674f, 0.826627433f},
-std::array<float,2>{0.212263569f, 0.464286923f},
-std::array<float,2>{0.792782724f, 0.32696408f},
-std::array<float,2>{0.116640747f, 0.969720066f},
-std::array<float,2>{0.535383821f, 0.727336764f},
-std::array<float,2>{0.459310681f, 0.0400139354f},
-std::array<float,2>{0.705708146f, 0.266601115f},
-std::array<float,2>{0.34812507f, 0.905643463f},
-std::array<float,2>{0.93732661f, 0.638487935f},
-std::array<float,2>{0.148081556f, 0.0692783892f},
-std::array<float,2>{0.838845074f, 0.220047429f},
-std::array<float,2>{0.0210043844f, 0.615476072f},
-std::array<float,2>{0.571296334f, 0.791271508f},
-std::array<float,2>{0.382460952f, 0.437065452f},
-std::array<float,2>{0.513874531f, 0.00831847358f},
-std::array<float,2>{0.475928724f, 0.715401351f},
-std::array<float,2>{0.777198851f, 0.945096314f},
-std::array<float,2>{0.0852142945f, 0.348725379f},
-std::array<float,2>{0.98679924f, 0.482077897f},
-std::array<float,2>{0.223247141f, 0.865284085f},
-std::array<float,2>{0.685877919f, 0.52671057f},
-std::array<float,2>{0.28555131f, 0.131579846f},
-std::array<float,2>{0.552143455f, 0.369626015f},
-std::array<float,2>{0.438013911f, 0.968027055f},
-std::array<float,2>{0.810103118f, 0.700846016f},
-std::array<float,2>{0.0977356434f, 0.0226432066f},
-std::array<float,2>{0.954337895f, 0.155463293f},
-std::array<float,2>{0.18982847f, 0.508918583f},
-std::array<float,2>{0.647533357f, 0.849640608f},
-std::array<float,2>{0.259245336f, 0.488637686f},
-std::array<float,2>{0.728279829f, 0.083540976f},
-std::array<float,2>{0.327037483f, 0.652181208f},
-std::array<float,2>{0.905506134f, 0.882952869f},
-std::array<float,2>{0.181015104f, 0.261110514f},
-std::array<float,2>{0.872605562f, 0.40705815f},
-std::array<float,2>{0.0462476276f, 0.80641228f},
-std::array<float,2>{0.616038144f, 0.596986115f},
-std::array<float,2>{0.437410474f, 0.235592037f},
-std::array<float,2>{0.664516807f, 0.447368711f},
-std::array<float,2>{0.307837754f, 0.838411987f},
-std::array<float,2>{0.984197497f, 0.533171773f},
-std::array<float,2>{0.240828007f, 0.186516181f},
-std::array<float,2>{0.759954274f, 0.0506885983f},
-std::array<float,2>{0.0719515458f, 0.74142158f},
-std::array<float,2>{0.530111909f, 0.992220521f},
-std::array<float,2>{0.498799771f, 0.343113214f},
-std::array<float,2>{0.592806995f, 0.201365292f},
-std::array<float,2>{0.39834106f, 0.576516569f},
-std::array<float,2>{0.821448743f, 0.754277647f},
-std::array<float,2>{0.00423010439f, 0.38757357f},
-std::array<float,2>{0.915990889f, 0.308772296f},
-std::array<float,2>{0.131083831f, 0.933140218f},
-std::array<float,2>{0.688821495f, 0.68396616f},
-std::array<float,2>{0.367815435f, 0.102209017f},
-std::array<float,2>{0.517224848f, 0.496079355f},
-std::array<float,2>{0.484582096f, 0.858157039f},
-std::array<float,2>{0.751129806f, 0.503929615f},
-std::array<float,2>{0.0657659695f, 0.147967845f},
-std::array<float,2>{0.976299584f, 0.0274307746f},
-std::array<float,2>{0.24388358f, 0.693751216f},
-std::array<float,2>{0.660410166f, 0.954981565f},
-std::array<float,2>{0.301016241f, 0.365738809f},
-std::array<float,2>{0.695687413f, 0.247660339f},
-std::array<float,2>{0.365052193f, 0.607953489f},
-std::array<float,2>{0.911050081f, 0.802054584f},
-std::array<float,2>{0.140334159f, 0.419757754f},
-std::array<float,2>{0.816446245f, 0.251060963f},
-std::array<float,2>{0.0094494801f, 0.880106091f},
-std::array<float,2>{0.579225004f, 0.646948576f},
-std::array<float,2>{0.399604708f, 0.086319007f},
-std::array<float,2>{0.654965699f, 0.330728829f},
-std::array<float,2>{0.256535172f, 0.990896583f},
-std::array<float,2>{0.962247014f, 0.746536076f},
-std::array<float,2>{0.202324301f, 0.0570828095f},
-std::array<float,2>{0.798392534f, 0.179023355f},
-std::array<float,2>{0.108035274f, 0.546043575f},
-std::array<float,2>{0.554862142f, 0.83063966f},
-std::array<float,2>{0.447363377f, 0.437502772f},
-std::array<float,2>{0.622110426f, 0.0987578332f},
-std::array<float,2>{0.426625222f, 0.673434436f},
-std::array<float,2>{0.865482867f, 0.925022721f},
-std::array<float,2>{0.0352079645f, 0.299424082f},
-std::array<float,2>{0.894355714f, 0.3769252f},
-std::array<float,2>{0.176921025f, 0.758811712f},
-std::array<float,2>{0.719758093f, 0.567237973f},
-std::array<float,2>{0.314824432f, 0.193897322f},
-std::array<float,2>{0.567001402f, 0.28129521f},
-std::array<float,2>{0.385411233f, 0.911945403f},
-std::array<float,2>{0.835749447f, 0.666091084f},
-std::array<float,2>{0.0272025391f, 0.111479409f},
-std::array<float,2>{0.926062167f, 0.213136196f},
-std::array<float,2>{0.148830816f, 0.593572795f},
-std::array<float,2>{0.716525912f, 0.775615633f},
-std::array<float,2>{0.354101121f, 0.402896941f},
-std::array<float,2>{0.675200582f, 0.0389163345f},
-std::array<float,2>{0.292353272f, 0.725189149f},
-std::array<float,2>{0.996760488f, 0.981495559f},
-std::array<float,2>{0.231755942f, 0.318725049f},
-std::array<float,2>{0.769980848f, 0.456378102f},
-std::array<float,2>{0.0862381384f, 0.818604469f},
-std::array<float,2>{0.507449269f, 0.553520858f},
-std::array<float,2>{0.483715415f, 0.171140507f},
-std::array<float,2>{0.74971348f, 0.422283739f},
-std::array<float,2>{0.339507133f, 0.78692615f},
-std::array<float,2>{0.88797009f, 0.618691921f},
-std::array<float,2>{0.162207067f, 0.231568694f},
-std::array<float,2>{0.856113672f, 0.0714160576f},
-std::array<float,2>{0.0575927533f, 0.627340317f},
-std::array<float,2>{0.594277382f, 0.892895758f},
-std::array<float,2>{0.421802461f, 0.280783832f},
-std::array<float,2>{0.544638574f, 0.13789466f},
-std::array<float,2>{0.466642708f, 0.516970336f},
-std::array<float,2>{0.788141191f, 0.873936653f},
-std::array<float,2>{0.11980772f, 0.469171435f},
-std::array<float,2>{0.944446206f, 0.353949308f},
-std::array<float,2>{0.21088089f, 0.951163232f},
-std::array<float,2>{0.635096073f, 0.706804395f},
-std::array<float,2>{0.267765969f, 7.67736128e-06f},
-std::array<float,2>{0.584582329f, 0.465023369f},
-std::array<float,2>{0.404540241f, 0.823815346f},
-std::array<float,2>{0.813444972f, 0.555067837f},
-std::array<float,2>{0.0118120806f, 0.15939492f},
-std::array<float,2>{0.907190025f, 0.0454778969f},
-std::array<float,2>{0.136442944f, 0.731678307f},
-std::array<float,2>{0.700006068f, 0.973908722f},
-std::array<float,2>{0.361751437f, 0.322970659f},
-std::array<float,2>{0.657985866f, 0.207453012f},
-std::array<float,2>{0.30070585f, 0.582905829f},
-std::array<float,2>{0.972645879f, 0.772047997f},
-std::array<float,2>{0.246323764f, 0.398390502f},
-std::array<float,2>{0.754675031f, 0.293636739f},
-std::array<float,2>{0.0679262802f, 0.918195069f},
-std::array<float,2>{0.522144377f, 0.658231735f},
-std::array<float,2>{0.488533258f, 0.124230899f},
-std::array<float,2>{0.723992825f, 0.34380126f},
-std::array<float,2>{0.319366395f, 0.941157341f},
-std::array<float,2>{0.896759212f, 0.713219106f},
-std::array<float,2>{0.172072098f, 0.0137646077f},
-std::array<float,2>{0.860422552f, 0.128006503f},
-std::array<float,2>{0.0337332077f, 0.530988634f},
-std::array<float,2>{0.617524505f, 0.861456752f},
-std::array<float,2>{0.424571782f, 0.477610141f},
-std::array<float,2>{0.560144663f, 0.0661620945f},
-std::array<float,2>{0.452022046f, 0.634792507f},
-std::array<float,2>{0.801470697f, 0.900795937f},
-std::array<float,2>{0.105273448f, 0.27021125f},
-std::array<float,2>{0.967709124f, 0.432505578f},
-std::array<float,2>{0.198169619f, 0.794021606f},
-std::array<float,2>{0.649320662f, 0.610925674f},
-std::array<float,2>{0.250853211f, 0.22373648f},
-std::array<float,2>{0.501541972f, 0.263210088f},
-std::array<float,2>{0.478569865f, 0.889549553f},
-std::array<float,2>{0.766317427f, 0.654902577f},
-std::array<float,2>{0.0919693261f, 0.0804798901f},
-std::array<float,2>{0.99585402f, 0.241358027f},
-std::array<float,2>{0.229094431f, 0.600942791f},
-std::array<float,2>{0.679467559f, 0.812145412f},
-std::array<float,2>{0.296175033f, 0.411420971f},
-std::array<float,2>{0.712189317f, 0.0173911434f},
-std::array<float,2>{0.357183993f, 0.696913123f},
-std::array<float,2>{0.921985388f, 0.963869095f},
-std::array<float,2>{0.155891716f, 0.373765022f},
-std::array<float,2>{0.83105737f, 0.486690134f},
-std::array<float,2>{0.0275540967f, 0.845217764f},
-std::array<float,2>{0.565292895f, 0.513349414f},
-std::array<float,2>{0.389302969f, 0.152338341f},
-std::array<float,2>{0.637300611f, 0.384572327f},
-std::array<float,2>{0.27269268f, 0.752770782f},
-std::array<float,2>{0.938925028f, 0.571302533f},
-std::array<float,2>{0.206890956f, 0.196992606f},
-std::array<float,2>{0.781696796f, 0.107400797f},
-std::array<float,2>{0.12463595f, 0.680324912f},
-std::array<float,2>{0.53979069f, 0.935942352f},
-std::array<float,2>{0.463107735f, 0.306554615f},
-std::array<float,2>{0.600584626f, 0.181431085f},
-std::array<float,2>{0.417180866f, 0.538703799f},
-std::array<float,2>{0.853724539f, 0.843171f},
-std::array<float,2>{0.0609473176f, 0.450265706f},
-std::array<float,2>{0.886452258f, 0.337884486f},
-std::array<float,2>{0.157757983f, 0.999304891f},
-std::array<float,2>{0.743687987f, 0.735170245f},
-std::array<float,2>{0.341371834f, 0.051281102f},
-std::array<float,2>{0.532460511f, 0.414554894f},
-std::array<float,2>{0.454179078f, 0.799777389f},
-std::array<float,2>{0.794902444f, 0.603621423f},
-std::array<float,2>{0.110109933f, 0.243672118f},
-std::array<float,2>{0.950219989f, 0.0924477354f},
-std::array<float,2>{0.217918366f, 0.641906738f},
-std::array<float,2>{0.630779326f, 0.87593925f},
-std::array<float,2>{0.281143278f, 0.257497549f},
-std::array<float,2>{0.737942219f, 0.144189596f},
-std::array<float,2>{0.333239049f, 0.502169073f},
-std::array<float,2>{0.878506362f, 0.854355812f},
-std::array<float,2>{0.164848134f, 0.496976137f},
-std::array<float,2>{0.850520015f, 0.360426575f},
-std::array<float,2>{0.0508436598f, 0.957946241f},
-std::array<float,2>{0.602806032f, 0.690381587f},
-std::array<float,2>{0.406502962f, 0.0262090992f},
-std::array<float,2>{0.68034333f, 0.303276062f},
-std::array<float,2>{0.284673125f, 0.928653419f},
-std::array<float,2>{0.991908431f, 0.679674506f},
-std::array<float,2>{0.222036332f, 0.0972477272f},
-std::array<float,2>{0.778268814f, 0.18957153f},
-std::array<float,2>{0.0806648508f, 0.56360209f},
-std::array<float,2>{0.510592461f, 0.764193833f},
-std::array<float,2>{0.470086545f, 0.38060832f},
-std::array<float,2>{0.574260652f, 0.0615627952f},
-std::array<float,2>{0.37546441f, 0.743312776f},
-std::array<float,2>{0.843664408f, 0.987983882f},
-std::array<float,2>{0.0175380241f, 0.334836394f},
-std::array<float,2>{0.929811895f, 0.442349344f},
-std::array<float,2>{0.140676633f, 0.833451033f},
-std::array<float,2>{0.709454834f, 0.539568424f},
-std::array<float,2>{0.345613033f, 0.173520043f},
-std::array<float,2>{0.609644294f, 0.316301823f},
-std::array<float,2>{0.430777371f, 0.977960765f},
-std::array<float,2>{0.86770916f, 0.721731603f},
-std::array<float,2>{0.0427486375f, 0.0338881053f},
-std::array<float,2>{0.901295543f, 0.164751798f},
-std::array<float,2>{0.184181511f, 0.550634861f},
-std::array<float,2>{0.734176397f, 0.815058589f},
-std::array<float,2>{0.320845425f, 0.457124949f},
-std::array<float,2>{0.642235696f, 0.116174489f},
-std::array<float,2>{0.262597233f, 0.670620501f},
-std::array<float,2>{0.959908247f, 0.906582236f},
-std::array<float,2>{0.191424936f, 0.286154121f},
-std::array<float,2>{0.805246711f, 0.40138036f},
-std::array<float,2>{0.0966417193f, 0.780485272f},
-std::array<float,2>{0.550417423f, 0.587100983f},
-std::array<float,2>{0.445188999f, 0.21867907f},
-std::array<float,2>{0.693546891f, 0.475360066f},
-std::array<float,2>{0.372126698f, 0.868279159f},
-std::array<float,2>{0.919970453f, 0.520168662f},
-std::array<float,2>{0.126631409f, 0.135118738f},
-std::array<float,2>{0.825455725f, 0.0062052398f},
-std::array<float,2>{0.00143788767f, 0.71037817f},
-std::array<float,2>{0.58949101f, 0.948989809f},
-std::array<float,2>{0.390709698f, 0.356962442f},
-std::array<float,2>{0.523501873f, 0.228517711f},
-std::array<float,2>{0.492289245f, 0.624195278f},
-std::array<float,2>{0.762524784f, 0.784518838f},
-std::array<float,2>{0.0775333643f, 0.428669512f},
-std::array<float,2>{0.977097154f, 0.276389509f},
-std::array<float,2>{0.235145345f, 0.895283759f},
-std::array<float,2>{0.671816826f, 0.631688178f},
-std::array<float,2>{0.308801055f, 0.0743055269f}}
\ No newline at end of file
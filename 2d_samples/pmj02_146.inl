@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.484127998f, 0.131452411f},
-std::array<float,2>{0.836059809f, 0.551750183f},
-std::array<float,2>{0.0822933391f, 0.838235438f},
-std::array<float,2>{0.629930079f, 0.356814772f},
-std::array<float,2>{0.22010237f, 0.433291495f},
-std::array<float,2>{0.594201267f, 0.956588745f},
-std::array<float,2>{0.30005914f, 0.647778034f},
-std::array<float,2>{0.918790638f, 0.124178424f},
-std::array<float,2>{0.0403737612f, 0.0562964901f},
-std::array<float,2>{0.748180032f, 0.744137824f},
-std::array<float,2>{0.406033099f, 0.893428266f},
-std::array<float,2>{0.762463212f, 0.479997635f},
-std::array<float,2>{0.37402916f, 0.299948454f},
-std::array<float,2>{0.978091776f, 0.785488725f},
-std::array<float,2>{0.12592274f, 0.601195335f},
-std::array<float,2>{0.502250135f, 0.216666549f},
-std::array<float,2>{0.255719811f, 0.0717440918f},
-std::array<float,2>{0.882047951f, 0.682352602f},
-std::array<float,2>{0.21672453f, 0.975061715f},
-std::array<float,2>{0.59335506f, 0.399997324f},
-std::array<float,2>{0.114279054f, 0.327586472f},
-std::array<float,2>{0.657264531f, 0.852659345f},
-std::array<float,2>{0.439519495f, 0.513812244f},
-std::array<float,2>{0.854903579f, 0.169697657f},
-std::array<float,2>{0.177974641f, 0.221922621f},
-std::array<float,2>{0.557301641f, 0.592169881f},
-std::array<float,2>{0.320805341f, 0.756526053f},
-std::array<float,2>{0.959907949f, 0.262111694f},
-std::array<float,2>{0.421160519f, 0.462225616f},
-std::array<float,2>{0.787670195f, 0.927075803f},
-std::array<float,2>{0.0225106422f, 0.702047884f},
-std::array<float,2>{0.688595533f, 0.0120494226f},
-std::array<float,2>{0.342673212f, 0.190998957f},
-std::array<float,2>{0.947517097f, 0.622161627f},
-std::array<float,2>{0.158737645f, 0.799997866f},
-std::array<float,2>{0.538300395f, 0.293943614f},
-std::array<float,2>{0.0112926457f, 0.497649223f},
-std::array<float,2>{0.712115765f, 0.886062443f},
-std::array<float,2>{0.428501278f, 0.719611883f},
-std::array<float,2>{0.800204992f, 0.0463580936f},
-std::array<float,2>{0.188688353f, 0.1066572f},
-std::array<float,2>{0.568460763f, 0.633641064f},
-std::array<float,2>{0.272535592f, 0.942351639f},
-std::array<float,2>{0.896296203f, 0.408433348f},
-std::array<float,2>{0.456782848f, 0.373903394f},
-std::array<float,2>{0.871870697f, 0.825554013f},
-std::array<float,2>{0.103531197f, 0.531696439f},
-std::array<float,2>{0.681279659f, 0.142993823f},
-std::array<float,2>{0.382973909f, 0.0218707584f},
-std::array<float,2>{0.771411359f, 0.718207896f},
-std::array<float,2>{0.0508923084f, 0.917470515f},
-std::array<float,2>{0.721441209f, 0.439028919f},
-std::array<float,2>{0.145627156f, 0.275628358f},
-std::array<float,2>{0.521095157f, 0.767297149f},
-std::array<float,2>{0.348758072f, 0.573253274f},
-std::array<float,2>{0.993777215f, 0.249346361f},
-std::array<float,2>{0.0661373436f, 0.17578876f},
-std::array<float,2>{0.642465174f, 0.518915057f},
-std::array<float,2>{0.496881425f, 0.866385221f},
-std::array<float,2>{0.824865878f, 0.335465908f},
-std::array<float,2>{0.291661501f, 0.382726282f},
-std::array<float,2>{0.926377356f, 0.99927175f},
-std::array<float,2>{0.240416795f, 0.660765111f},
-std::array<float,2>{0.61451292f, 0.093393892f},
-std::array<float,2>{0.43174538f, 0.238580942f},
-std::array<float,2>{0.810154855f, 0.568921566f},
-std::array<float,2>{0.00449570408f, 0.779543519f},
-std::array<float,2>{0.705583334f, 0.270141691f},
-std::array<float,2>{0.167203143f, 0.452049375f},
-std::array<float,2>{0.54149127f, 0.907864809f},
-std::array<float,2>{0.332355231f, 0.70750469f},
-std::array<float,2>{0.943334162f, 0.02668662f},
-std::array<float,2>{0.0947178081f, 0.0846836343f},
-std::array<float,2>{0.674414396f, 0.669620812f},
-std::array<float,2>{0.462310374f, 0.987941384f},
-std::array<float,2>{0.861086905f, 0.383627534f},
-std::array<float,2>{0.275371671f, 0.338344932f},
-std::array<float,2>{0.904469907f, 0.873675942f},
-std::array<float,2>{0.19783558f, 0.528249443f},
-std::array<float,2>{0.576782525f, 0.182050616f},
-std::array<float,2>{0.35271889f, 0.0347100534f},
-std::array<float,2>{0.986145735f, 0.727782607f},
-std::array<float,2>{0.154833496f, 0.878997266f},
-std::array<float,2>{0.530491769f, 0.486399293f},
-std::array<float,2>{0.0572706237f, 0.282475978f},
-std::array<float,2>{0.730225444f, 0.80778718f},
-std::array<float,2>{0.375483692f, 0.614398956f},
-std::array<float,2>{0.778039813f, 0.20068045f},
-std::array<float,2>{0.247289717f, 0.150510192f},
-std::array<float,2>{0.618164897f, 0.53981626f},
-std::array<float,2>{0.284411222f, 0.818787038f},
-std::array<float,2>{0.937482774f, 0.363585085f},
-std::array<float,2>{0.487807006f, 0.419621676f},
-std::array<float,2>{0.814115763f, 0.948028803f},
-std::array<float,2>{0.0711272061f, 0.627443135f},
-std::array<float,2>{0.655672669f, 0.0955794901f},
-std::array<float,2>{0.309626639f, 0.157640561f},
-std::array<float,2>{0.909335732f, 0.50724113f},
-std::array<float,2>{0.227264687f, 0.846812606f},
-std::array<float,2>{0.603368878f, 0.314810902f},
-std::array<float,2>{0.0914908051f, 0.392683923f},
-std::array<float,2>{0.640021384f, 0.982938528f},
-std::array<float,2>{0.473661482f, 0.674262285f},
-std::array<float,2>{0.833108068f, 0.0639272556f},
-std::array<float,2>{0.133792892f, 0.00488466443f},
-std::array<float,2>{0.515119255f, 0.690208673f},
-std::array<float,2>{0.364264041f, 0.932034492f},
-std::array<float,2>{0.974785805f, 0.457566887f},
-std::array<float,2>{0.39452526f, 0.256282836f},
-std::array<float,2>{0.755051494f, 0.75791198f},
-std::array<float,2>{0.0375550948f, 0.57822144f},
-std::array<float,2>{0.737550437f, 0.229968339f},
-std::array<float,2>{0.446022809f, 0.116718806f},
-std::array<float,2>{0.845831156f, 0.654857278f},
-std::array<float,2>{0.122185938f, 0.961537242f},
-std::array<float,2>{0.666061342f, 0.426771015f},
-std::array<float,2>{0.209641084f, 0.349693805f},
-std::array<float,2>{0.584919691f, 0.831524551f},
-std::array<float,2>{0.265282869f, 0.559068978f},
-std::array<float,2>{0.887622416f, 0.140061557f},
-std::array<float,2>{0.0262048244f, 0.208199129f},
-std::array<float,2>{0.698771536f, 0.601687372f},
-std::array<float,2>{0.407318771f, 0.796246588f},
-std::array<float,2>{0.792401254f, 0.307293445f},
-std::array<float,2>{0.316874117f, 0.473273456f},
-std::array<float,2>{0.966979384f, 0.90182215f},
-std::array<float,2>{0.181663662f, 0.734406054f},
-std::array<float,2>{0.553655267f, 0.0481312647f},
-std::array<float,2>{0.401085138f, 0.183955088f},
-std::array<float,2>{0.760244131f, 0.52514559f},
-std::array<float,2>{0.045724865f, 0.867589831f},
-std::array<float,2>{0.742636919f, 0.342322916f},
-std::array<float,2>{0.131490797f, 0.387868732f},
-std::array<float,2>{0.504901707f, 0.989116251f},
-std::array<float,2>{0.370330513f, 0.666842759f},
-std::array<float,2>{0.983985126f, 0.0792342648f},
-std::array<float,2>{0.0812166259f, 0.0307139587f},
-std::array<float,2>{0.626791656f, 0.705813527f},
-std::array<float,2>{0.480290115f, 0.912590981f},
-std::array<float,2>{0.840256929f, 0.446730882f},
-std::array<float,2>{0.30278343f, 0.266406536f},
-std::array<float,2>{0.916959167f, 0.775317252f},
-std::array<float,2>{0.223018721f, 0.563535213f},
-std::array<float,2>{0.599619925f, 0.23624666f},
-std::array<float,2>{0.324924707f, 0.097895287f},
-std::array<float,2>{0.954970241f, 0.630817354f},
-std::array<float,2>{0.172756582f, 0.949941278f},
-std::array<float,2>{0.558715343f, 0.414258808f},
-std::array<float,2>{0.0193797946f, 0.362468302f},
-std::array<float,2>{0.69250083f, 0.813767433f},
-std::array<float,2>{0.417464375f, 0.543360114f},
-std::array<float,2>{0.782392979f, 0.154440761f},
-std::array<float,2>{0.211237937f, 0.195333689f},
-std::array<float,2>{0.588495612f, 0.610482097f},
-std::array<float,2>{0.251365691f, 0.809005618f},
-std::array<float,2>{0.878170371f, 0.2872504f},
-std::array<float,2>{0.443783849f, 0.490810812f},
-std::array<float,2>{0.856730998f, 0.878762364f},
-std::array<float,2>{0.110844359f, 0.7313779f},
-std::array<float,2>{0.663075686f, 0.0353800729f},
-std::array<float,2>{0.268142194f, 0.233340457f},
-std::array<float,2>{0.893089414f, 0.584183156f},
-std::array<float,2>{0.195303351f, 0.763744175f},
-std::array<float,2>{0.563279212f, 0.25317356f},
-std::array<float,2>{0.109346978f, 0.455821306f},
-std::array<float,2>{0.685314476f, 0.936190605f},
-std::array<float,2>{0.458956659f, 0.694743395f},
-std::array<float,2>{0.868626237f, 0.00110153144f},
-std::array<float,2>{0.16266042f, 0.0700594559f},
-std::array<float,2>{0.534406185f, 0.679336488f},
-std::array<float,2>{0.337656677f, 0.980427384f},
-std::array<float,2>{0.950547755f, 0.398049116f},
-std::array<float,2>{0.42446211f, 0.319143862f},
-std::array<float,2>{0.804537177f, 0.850974023f},
-std::array<float,2>{0.014149365f, 0.501272976f},
-std::array<float,2>{0.71733284f, 0.1639117f},
-std::array<float,2>{0.492422074f, 0.0511741042f},
-std::array<float,2>{0.821193576f, 0.739814281f},
-std::array<float,2>{0.0679417774f, 0.905383825f},
-std::array<float,2>{0.646404564f, 0.470022917f},
-std::array<float,2>{0.236580685f, 0.308764577f},
-std::array<float,2>{0.611643434f, 0.789855361f},
-std::array<float,2>{0.293481916f, 0.606514633f},
-std::array<float,2>{0.922279596f, 0.20650436f},
-std::array<float,2>{0.0471845567f, 0.135273382f},
-std::array<float,2>{0.724221826f, 0.558403015f},
-std::array<float,2>{0.387640595f, 0.834257185f},
-std::array<float,2>{0.768983483f, 0.346607804f},
-std::array<float,2>{0.345910788f, 0.42463845f},
-std::array<float,2>{0.997798979f, 0.968729854f},
-std::array<float,2>{0.14436245f, 0.652091384f},
-std::array<float,2>{0.516035855f, 0.111922219f},
-std::array<float,2>{0.466439009f, 0.21207431f},
-std::array<float,2>{0.864912093f, 0.595713377f},
-std::array<float,2>{0.0985964313f, 0.784480035f},
-std::array<float,2>{0.67888093f, 0.302257895f},
-std::array<float,2>{0.200462133f, 0.482744187f},
-std::array<float,2>{0.571688414f, 0.895624518f},
-std::array<float,2>{0.279158175f, 0.746998608f},
-std::array<float,2>{0.899890602f, 0.0603223518f},
-std::array<float,2>{0.000877770479f, 0.118797414f},
-std::array<float,2>{0.707238078f, 0.642284214f},
-std::array<float,2>{0.436877728f, 0.960067034f},
-std::array<float,2>{0.805904686f, 0.436338544f},
-std::array<float,2>{0.331620604f, 0.355187237f},
-std::array<float,2>{0.937775791f, 0.842838883f},
-std::array<float,2>{0.169635311f, 0.547518313f},
-std::array<float,2>{0.543551087f, 0.127149358f},
-std::array<float,2>{0.286166966f, 0.011618875f},
-std::array<float,2>{0.932755351f, 0.698792398f},
-std::array<float,2>{0.242487803f, 0.925730586f},
-std::array<float,2>{0.621362269f, 0.467116922f},
-std::array<float,2>{0.0744828284f, 0.259210438f},
-std::array<float,2>{0.649930418f, 0.750836551f},
-std::array<float,2>{0.48938027f, 0.588869512f},
-std::array<float,2>{0.818327069f, 0.225309134f},
-std::array<float,2>{0.149247408f, 0.165255517f},
-std::array<float,2>{0.524572849f, 0.508870184f},
-std::array<float,2>{0.358230591f, 0.85788846f},
-std::array<float,2>{0.991535723f, 0.32125771f},
-std::array<float,2>{0.380839169f, 0.405080408f},
-std::array<float,2>{0.775731146f, 0.968769908f},
-std::array<float,2>{0.0608079731f, 0.684137046f},
-std::array<float,2>{0.731427968f, 0.0743160248f},
-std::array<float,2>{0.361895174f, 0.14701286f},
-std::array<float,2>{0.968855798f, 0.537097454f},
-std::array<float,2>{0.137883753f, 0.820490539f},
-std::array<float,2>{0.511485815f, 0.369689077f},
-std::array<float,2>{0.0335780829f, 0.412133723f},
-std::array<float,2>{0.742155671f, 0.940144658f},
-std::array<float,2>{0.39539662f, 0.639065444f},
-std::array<float,2>{0.751900077f, 0.102819614f},
-std::array<float,2>{0.231212527f, 0.0394639485f},
-std::array<float,2>{0.606369555f, 0.725784898f},
-std::array<float,2>{0.30725798f, 0.889132798f},
-std::array<float,2>{0.913172603f, 0.493433118f},
-std::array<float,2>{0.470968336f, 0.289848804f},
-std::array<float,2>{0.830027878f, 0.804039955f},
-std::array<float,2>{0.0860262811f, 0.619440317f},
-std::array<float,2>{0.635385096f, 0.19514896f},
-std::array<float,2>{0.413816541f, 0.0885916203f},
-std::array<float,2>{0.794722617f, 0.657588482f},
-std::array<float,2>{0.030102836f, 0.994436264f},
-std::array<float,2>{0.701499224f, 0.376086652f},
-std::array<float,2>{0.187102512f, 0.329321444f},
-std::array<float,2>{0.54732728f, 0.860083222f},
-std::array<float,2>{0.312909335f, 0.52123481f},
-std::array<float,2>{0.964445531f, 0.172826752f},
-std::array<float,2>{0.119008958f, 0.245920137f},
-std::array<float,2>{0.670719743f, 0.576742113f},
-std::array<float,2>{0.452522576f, 0.772413731f},
-std::array<float,2>{0.847966194f, 0.279793441f},
-std::array<float,2>{0.261246592f, 0.44501704f},
-std::array<float,2>{0.886269391f, 0.918094456f},
-std::array<float,2>{0.204653889f, 0.711915374f},
-std::array<float,2>{0.581426084f, 0.0186587237f},
-std::array<float,2>{0.439264029f, 0.171482518f},
-std::array<float,2>{0.853337288f, 0.511741877f},
-std::array<float,2>{0.116519548f, 0.855009377f},
-std::array<float,2>{0.658689201f, 0.325724572f},
-std::array<float,2>{0.217875376f, 0.402111322f},
-std::array<float,2>{0.590860784f, 0.974020064f},
-std::array<float,2>{0.257605731f, 0.680977225f},
-std::array<float,2>{0.879168451f, 0.0727426708f},
-std::array<float,2>{0.0203847345f, 0.0153203793f},
-std::array<float,2>{0.690894723f, 0.700966001f},
-std::array<float,2>{0.41897881f, 0.928516626f},
-std::array<float,2>{0.786101818f, 0.463479578f},
-std::array<float,2>{0.32321763f, 0.26477024f},
-std::array<float,2>{0.957628906f, 0.754770935f},
-std::array<float,2>{0.176970407f, 0.591110408f},
-std::array<float,2>{0.554968059f, 0.219803035f},
-std::array<float,2>{0.296969354f, 0.122321747f},
-std::array<float,2>{0.920885265f, 0.645055354f},
-std::array<float,2>{0.222123787f, 0.955054522f},
-std::array<float,2>{0.597105324f, 0.431554824f},
-std::array<float,2>{0.0843164027f, 0.358661234f},
-std::array<float,2>{0.630954087f, 0.837749004f},
-std::array<float,2>{0.481762588f, 0.554391563f},
-std::array<float,2>{0.839651942f, 0.129940435f},
-std::array<float,2>{0.127538607f, 0.216968462f},
-std::array<float,2>{0.500449717f, 0.598154426f},
-std::array<float,2>{0.37266925f, 0.787115455f},
-std::array<float,2>{0.978872955f, 0.297824144f},
-std::array<float,2>{0.402417094f, 0.477647454f},
-std::array<float,2>{0.764025092f, 0.891410232f},
-std::array<float,2>{0.0413988084f, 0.745058417f},
-std::array<float,2>{0.748021662f, 0.0584681295f},
-std::array<float,2>{0.349707246f, 0.247572735f},
-std::array<float,2>{0.99456358f, 0.570417643f},
-std::array<float,2>{0.147865012f, 0.767680585f},
-std::array<float,2>{0.522727609f, 0.274423927f},
-std::array<float,2>{0.052846007f, 0.440687954f},
-std::array<float,2>{0.720336199f, 0.914073288f},
-std::array<float,2>{0.385745645f, 0.716788292f},
-std::array<float,2>{0.772092998f, 0.0204255544f},
-std::array<float,2>{0.239621431f, 0.0916479602f},
-std::array<float,2>{0.615888417f, 0.662366092f},
-std::array<float,2>{0.290340304f, 0.997210026f},
-std::array<float,2>{0.928530693f, 0.380780339f},
-std::array<float,2>{0.498207957f, 0.332297444f},
-std::array<float,2>{0.826699018f, 0.8648476f},
-std::array<float,2>{0.062757127f, 0.516945362f},
-std::array<float,2>{0.643335521f, 0.178257659f},
-std::array<float,2>{0.426484883f, 0.0433171913f},
-std::array<float,2>{0.797434747f, 0.720747888f},
-std::array<float,2>{0.00970022753f, 0.883458436f},
-std::array<float,2>{0.713100433f, 0.499110967f},
-std::array<float,2>{0.158041596f, 0.295092672f},
-std::array<float,2>{0.535943687f, 0.796980083f},
-std::array<float,2>{0.341003627f, 0.624886632f},
-std::array<float,2>{0.945345998f, 0.188901678f},
-std::array<float,2>{0.102807671f, 0.141916856f},
-std::array<float,2>{0.682374656f, 0.533863544f},
-std::array<float,2>{0.454337031f, 0.826504171f},
-std::array<float,2>{0.874518454f, 0.371691942f},
-std::array<float,2>{0.269967109f, 0.406786025f},
-std::array<float,2>{0.89831239f, 0.944382787f},
-std::array<float,2>{0.189906284f, 0.634796798f},
-std::array<float,2>{0.567917287f, 0.107829571f},
-std::array<float,2>{0.377818197f, 0.20249173f},
-std::array<float,2>{0.78010571f, 0.6163432f},
-std::array<float,2>{0.0552427992f, 0.805266023f},
-std::array<float,2>{0.72775209f, 0.283468068f},
-std::array<float,2>{0.154263332f, 0.484447658f},
-std::array<float,2>{0.527600288f, 0.881475031f},
-std::array<float,2>{0.353681922f, 0.729383111f},
-std::array<float,2>{0.986453056f, 0.0315070003f},
-std::array<float,2>{0.0741451159f, 0.0970687643f},
-std::array<float,2>{0.652644038f, 0.626373053f},
-std::array<float,2>{0.485308319f, 0.945758045f},
-std::array<float,2>{0.815598488f, 0.421143204f},
-std::array<float,2>{0.28229633f, 0.366708487f},
-std::array<float,2>{0.934388995f, 0.816838026f},
-std::array<float,2>{0.248524994f, 0.541027784f},
-std::array<float,2>{0.619295061f, 0.149740025f},
-std::array<float,2>{0.335644782f, 0.0242732689f},
-std::array<float,2>{0.944436789f, 0.710200787f},
-std::array<float,2>{0.164744869f, 0.908647716f},
-std::array<float,2>{0.540768385f, 0.450628847f},
-std::array<float,2>{0.00649946928f, 0.273063809f},
-std::array<float,2>{0.70416081f, 0.778009295f},
-std::array<float,2>{0.431453079f, 0.56774646f},
-std::array<float,2>{0.812388837f, 0.240719989f},
-std::array<float,2>{0.195347905f, 0.179688498f},
-std::array<float,2>{0.57438159f, 0.531131983f},
-std::array<float,2>{0.276184797f, 0.87231642f},
-std::array<float,2>{0.9027403f, 0.337240756f},
-std::array<float,2>{0.463323772f, 0.386138082f},
-std::array<float,2>{0.86134851f, 0.984434009f},
-std::array<float,2>{0.0965863317f, 0.670396626f},
-std::array<float,2>{0.673696101f, 0.082977362f},
-std::array<float,2>{0.263260722f, 0.137274072f},
-std::array<float,2>{0.888694346f, 0.561403155f},
-std::array<float,2>{0.208447337f, 0.828627765f},
-std::array<float,2>{0.583409309f, 0.347862273f},
-std::array<float,2>{0.124462523f, 0.428504884f},
-std::array<float,2>{0.664343536f, 0.963428974f},
-std::array<float,2>{0.448725045f, 0.654129684f},
-std::array<float,2>{0.844555497f, 0.113408379f},
-std::array<float,2>{0.179719195f, 0.050703533f},
-std::array<float,2>{0.551987946f, 0.737448454f},
-std::array<float,2>{0.319134831f, 0.899247348f},
-std::array<float,2>{0.964929879f, 0.47530666f},
-std::array<float,2>{0.409010619f, 0.305136174f},
-std::array<float,2>{0.78916055f, 0.793373227f},
-std::array<float,2>{0.0242413878f, 0.60441792f},
-std::array<float,2>{0.696540475f, 0.209909916f},
-std::array<float,2>{0.475276947f, 0.0650727525f},
-std::array<float,2>{0.834973335f, 0.673737705f},
-std::array<float,2>{0.0931761786f, 0.980946839f},
-std::array<float,2>{0.63675195f, 0.392113537f},
-std::array<float,2>{0.229444683f, 0.314359158f},
-std::array<float,2>{0.603854239f, 0.844696999f},
-std::array<float,2>{0.311279416f, 0.504023075f},
-std::array<float,2>{0.906736374f, 0.159141347f},
-std::array<float,2>{0.0352636166f, 0.227183789f},
-std::array<float,2>{0.734446704f, 0.581040025f},
-std::array<float,2>{0.391676426f, 0.761675656f},
-std::array<float,2>{0.757069767f, 0.254251838f},
-std::array<float,2>{0.366427809f, 0.46050337f},
-std::array<float,2>{0.973982275f, 0.930828869f},
-std::array<float,2>{0.135867655f, 0.689092278f},
-std::array<float,2>{0.512010396f, 0.00736229448f},
-std::array<float,2>{0.414914757f, 0.154034451f},
-std::array<float,2>{0.784009933f, 0.546292722f},
-std::array<float,2>{0.0174500849f, 0.816372633f},
-std::array<float,2>{0.694629014f, 0.360078901f},
-std::array<float,2>{0.17495048f, 0.416327983f},
-std::array<float,2>{0.560670972f, 0.952013314f},
-std::array<float,2>{0.326951236f, 0.631322384f},
-std::array<float,2>{0.955265582f, 0.101414502f},
-std::array<float,2>{0.112168014f, 0.0390226208f},
-std::array<float,2>{0.66135335f, 0.73281908f},
-std::array<float,2>{0.441960126f, 0.875590444f},
-std::array<float,2>{0.858582258f, 0.488599181f},
-std::array<float,2>{0.253660738f, 0.28674221f},
-std::array<float,2>{0.876030147f, 0.810856819f},
-std::array<float,2>{0.214728251f, 0.612878621f},
-std::array<float,2>{0.587588429f, 0.199072868f},
-std::array<float,2>{0.368389159f, 0.080360949f},
-std::array<float,2>{0.981311679f, 0.665522456f},
-std::array<float,2>{0.13030605f, 0.990982294f},
-std::array<float,2>{0.506283998f, 0.389994979f},
-std::array<float,2>{0.0440427549f, 0.340928972f},
-std::array<float,2>{0.745046377f, 0.86999315f},
-std::array<float,2>{0.398866296f, 0.526958525f},
-std::array<float,2>{0.758687258f, 0.186507732f},
-std::array<float,2>{0.224776059f, 0.238240808f},
-std::array<float,2>{0.599144101f, 0.564976871f},
-std::array<float,2>{0.302225828f, 0.776034713f},
-std::array<float,2>{0.915112436f, 0.268295199f},
-std::array<float,2>{0.47705701f, 0.448954374f},
-std::array<float,2>{0.84201324f, 0.910170913f},
-std::array<float,2>{0.0795393959f, 0.703208685f},
-std::array<float,2>{0.628512979f, 0.0289663933f},
-std::array<float,2>{0.296029657f, 0.20421505f},
-std::array<float,2>{0.924276114f, 0.608638823f},
-std::array<float,2>{0.23593542f, 0.791584373f},
-std::array<float,2>{0.610500991f, 0.311803192f},
-std::array<float,2>{0.0691610575f, 0.470745713f},
-std::array<float,2>{0.647400558f, 0.902631819f},
-std::array<float,2>{0.495173484f, 0.741427839f},
-std::array<float,2>{0.823667884f, 0.0540702902f},
-std::array<float,2>{0.141396821f, 0.110356331f},
-std::array<float,2>{0.518847048f, 0.649989307f},
-std::array<float,2>{0.343852222f, 0.9653669f},
-std::array<float,2>{0.999643981f, 0.422834992f},
-std::array<float,2>{0.38970539f, 0.345290601f},
-std::array<float,2>{0.766661644f, 0.832591593f},
-std::array<float,2>{0.0496931672f, 0.555362463f},
-std::array<float,2>{0.72500962f, 0.133091241f},
-std::array<float,2>{0.460479945f, 0.00372151984f},
-std::array<float,2>{0.870424211f, 0.693040609f},
-std::array<float,2>{0.105752058f, 0.934783936f},
-std::array<float,2>{0.686943412f, 0.455027014f},
-std::array<float,2>{0.193014741f, 0.250379533f},
-std::array<float,2>{0.565823317f, 0.763269842f},
-std::array<float,2>{0.266321689f, 0.582391441f},
-std::array<float,2>{0.89132297f, 0.230855599f},
-std::array<float,2>{0.0128521891f, 0.162037477f},
-std::array<float,2>{0.715971231f, 0.503637373f},
-std::array<float,2>{0.423369914f, 0.847671747f},
-std::array<float,2>{0.802690625f, 0.317498147f},
-std::array<float,2>{0.338872164f, 0.395135224f},
-std::array<float,2>{0.952272415f, 0.976901233f},
-std::array<float,2>{0.160884067f, 0.676376224f},
-std::array<float,2>{0.532950222f, 0.0669412687f},
-std::array<float,2>{0.490568966f, 0.224573731f},
-std::array<float,2>{0.819503844f, 0.586407721f},
-std::array<float,2>{0.0764464065f, 0.753247201f},
-std::array<float,2>{0.652142823f, 0.260628492f},
-std::array<float,2>{0.244287223f, 0.466613114f},
-std::array<float,2>{0.623935103f, 0.923415065f},
-std::array<float,2>{0.288555235f, 0.696965098f},
-std::array<float,2>{0.930337846f, 0.00963703915f},
-std::array<float,2>{0.0588943511f, 0.0774330199f},
-std::array<float,2>{0.733231664f, 0.687194228f},
-std::array<float,2>{0.381532997f, 0.971828043f},
-std::array<float,2>{0.774326444f, 0.40357998f},
-std::array<float,2>{0.355559736f, 0.323163241f},
-std::array<float,2>{0.989151359f, 0.856675148f},
-std::array<float,2>{0.151619479f, 0.510181606f},
-std::array<float,2>{0.526533127f, 0.167338386f},
-std::array<float,2>{0.279377609f, 0.0612259842f},
-std::array<float,2>{0.901817322f, 0.748988628f},
-std::array<float,2>{0.201259613f, 0.898246348f},
-std::array<float,2>{0.573067904f, 0.481871784f},
-std::array<float,2>{0.101343684f, 0.30414176f},
-std::array<float,2>{0.676254988f, 0.782810092f},
-std::array<float,2>{0.467997223f, 0.594705582f},
-std::array<float,2>{0.865935087f, 0.213451609f},
-std::array<float,2>{0.170973331f, 0.125705108f},
-std::array<float,2>{0.545996428f, 0.549633205f},
-std::array<float,2>{0.329706043f, 0.841330767f},
-std::array<float,2>{0.939884901f, 0.353498966f},
-std::array<float,2>{0.435251147f, 0.433610916f},
-std::array<float,2>{0.807563245f, 0.958016813f},
-std::array<float,2>{0.00298358826f, 0.643073082f},
-std::array<float,2>{0.709331095f, 0.119551495f},
-std::array<float,2>{0.314978868f, 0.174185842f},
-std::array<float,2>{0.962153971f, 0.521824479f},
-std::array<float,2>{0.185374171f, 0.861657858f},
-std::array<float,2>{0.549773216f, 0.330817968f},
-std::array<float,2>{0.0292732026f, 0.378269881f},
-std::array<float,2>{0.700678527f, 0.993024528f},
-std::array<float,2>{0.410453528f, 0.658241868f},
-std::array<float,2>{0.796753824f, 0.0876478031f},
-std::array<float,2>{0.206427276f, 0.0164319985f},
-std::array<float,2>{0.579572737f, 0.712960184f},
-std::array<float,2>{0.257893115f, 0.921825051f},
-std::array<float,2>{0.883863866f, 0.44242537f},
-std::array<float,2>{0.449411392f, 0.278119862f},
-std::array<float,2>{0.850531042f, 0.769731343f},
-std::array<float,2>{0.11980436f, 0.57500273f},
-std::array<float,2>{0.668181777f, 0.243339404f},
-std::array<float,2>{0.398192614f, 0.104637295f},
-std::array<float,2>{0.753421605f, 0.63728869f},
-std::array<float,2>{0.032871142f, 0.937977433f},
-std::array<float,2>{0.738952696f, 0.412106633f},
-std::array<float,2>{0.139312297f, 0.367567331f},
-std::array<float,2>{0.508183658f, 0.822832108f},
-std::array<float,2>{0.360055089f, 0.537137926f},
-std::array<float,2>{0.972299099f, 0.145678118f},
-std::array<float,2>{0.0886614546f, 0.191597089f},
-std::array<float,2>{0.633564711f, 0.619078755f},
-std::array<float,2>{0.469299793f, 0.80154258f},
-std::array<float,2>{0.830940008f, 0.292428702f},
-std::array<float,2>{0.30504021f, 0.495398819f},
-std::array<float,2>{0.910890579f, 0.887966394f},
-std::array<float,2>{0.233321518f, 0.723845363f},
-std::array<float,2>{0.608579695f, 0.0425447971f},
-std::array<float,2>{0.497977197f, 0.179036528f},
-std::array<float,2>{0.825742841f, 0.516587675f},
-std::array<float,2>{0.0652192533f, 0.863928437f},
-std::array<float,2>{0.641078174f, 0.333719939f},
-std::array<float,2>{0.241250917f, 0.379624456f},
-std::array<float,2>{0.613795698f, 0.996921003f},
-std::array<float,2>{0.292279661f, 0.663331389f},
-std::array<float,2>{0.927692711f, 0.0899370089f},
-std::array<float,2>{0.0520485528f, 0.0205948874f},
-std::array<float,2>{0.722597599f, 0.715744674f},
-std::array<float,2>{0.384376794f, 0.915141344f},
-std::array<float,2>{0.770245731f, 0.440297216f},
-std::array<float,2>{0.348314047f, 0.274303049f},
-std::array<float,2>{0.993004858f, 0.768993258f},
-std::array<float,2>{0.144826338f, 0.572064281f},
-std::array<float,2>{0.520155311f, 0.246441439f},
-std::array<float,2>{0.272068322f, 0.108590513f},
-std::array<float,2>{0.89472121f, 0.636706412f},
-std::array<float,2>{0.188229337f, 0.943578899f},
-std::array<float,2>{0.57001406f, 0.407827467f},
-std::array<float,2>{0.104645237f, 0.372085154f},
-std::array<float,2>{0.679771841f, 0.827864408f},
-std::array<float,2>{0.455791712f, 0.534585536f},
-std::array<float,2>{0.87285912f, 0.14086847f},
-std::array<float,2>{0.15950118f, 0.188314289f},
-std::array<float,2>{0.537627101f, 0.62339896f},
-std::array<float,2>{0.343613893f, 0.79822439f},
-std::array<float,2>{0.949168503f, 0.296546906f},
-std::array<float,2>{0.429414809f, 0.498625696f},
-std::array<float,2>{0.798970878f, 0.884693205f},
-std::array<float,2>{0.010428655f, 0.722404838f},
-std::array<float,2>{0.710959792f, 0.0448191129f},
-std::array<float,2>{0.322097987f, 0.219405964f},
-std::array<float,2>{0.960514307f, 0.59039557f},
-std::array<float,2>{0.179175213f, 0.75555855f},
-std::array<float,2>{0.557936966f, 0.263976544f},
-std::array<float,2>{0.0223932788f, 0.464263737f},
-std::array<float,2>{0.68847388f, 0.929223359f},
-std::array<float,2>{0.42064935f, 0.699360609f},
-std::array<float,2>{0.788384736f, 0.0143965753f},
-std::array<float,2>{0.214992598f, 0.0733348206f},
-std::array<float,2>{0.59205246f, 0.679693401f},
-std::array<float,2>{0.254001379f, 0.97334677f},
-std::array<float,2>{0.880922079f, 0.400800139f},
-std::array<float,2>{0.440507352f, 0.324561775f},
-std::array<float,2>{0.854122818f, 0.854229212f},
-std::array<float,2>{0.113484211f, 0.513473094f},
-std::array<float,2>{0.656754494f, 0.170461461f},
-std::array<float,2>{0.404480487f, 0.0574395284f},
-std::array<float,2>{0.762876332f, 0.74546051f},
-std::array<float,2>{0.0398483574f, 0.892257869f},
-std::array<float,2>{0.749409974f, 0.476669014f},
-std::array<float,2>{0.126612917f, 0.298325092f},
-std::array<float,2>{0.503638804f, 0.788595736f},
-std::array<float,2>{0.373061657f, 0.598862946f},
-std::array<float,2>{0.977500737f, 0.217954934f},
-std::array<float,2>{0.0830524117f, 0.129602447f},
-std::array<float,2>{0.629256546f, 0.553114772f},
-std::array<float,2>{0.482701719f, 0.83642906f},
-std::array<float,2>{0.837192237f, 0.358246267f},
-std::array<float,2>{0.298952758f, 0.430434912f},
-std::array<float,2>{0.919412434f, 0.953149259f},
-std::array<float,2>{0.21891275f, 0.645982265f},
-std::array<float,2>{0.595701635f, 0.121131927f},
-std::array<float,2>{0.407164693f, 0.21004124f},
-std::array<float,2>{0.79119271f, 0.604713023f},
-std::array<float,2>{0.026654521f, 0.794368863f},
-std::array<float,2>{0.698222101f, 0.306014508f},
-std::array<float,2>{0.183008865f, 0.475944102f},
-std::array<float,2>{0.554116607f, 0.900218129f},
-std::array<float,2>{0.317526609f, 0.736983657f},
-std::array<float,2>{0.968688607f, 0.049769707f},
-std::array<float,2>{0.121338733f, 0.115232304f},
-std::array<float,2>{0.667615414f, 0.65301007f},
-std::array<float,2>{0.447184414f, 0.964719892f},
-std::array<float,2>{0.846838474f, 0.428927571f},
-std::array<float,2>{0.264303893f, 0.349122316f},
-std::array<float,2>{0.888659477f, 0.829769194f},
-std::array<float,2>{0.210532784f, 0.562217474f},
-std::array<float,2>{0.585680366f, 0.138606608f},
-std::array<float,2>{0.364042729f, 0.00634304062f},
-std::array<float,2>{0.976274848f, 0.6884619f},
-std::array<float,2>{0.133219332f, 0.930091321f},
-std::array<float,2>{0.514344871f, 0.459432483f},
-std::array<float,2>{0.0380985215f, 0.255557835f},
-std::array<float,2>{0.736590743f, 0.760538995f},
-std::array<float,2>{0.393299609f, 0.581281841f},
-std::array<float,2>{0.754029095f, 0.227914259f},
-std::array<float,2>{0.227623805f, 0.159548506f},
-std::array<float,2>{0.601594508f, 0.505616188f},
-std::array<float,2>{0.3090657f, 0.844881833f},
-std::array<float,2>{0.908700705f, 0.312532037f},
-std::array<float,2>{0.473129779f, 0.390905052f},
-std::array<float,2>{0.832352281f, 0.981566906f},
-std::array<float,2>{0.0906311423f, 0.672284245f},
-std::array<float,2>{0.639136314f, 0.0659526885f},
-std::array<float,2>{0.283369273f, 0.149118513f},
-std::array<float,2>{0.935888708f, 0.54199934f},
-std::array<float,2>{0.246985435f, 0.818029702f},
-std::array<float,2>{0.61722666f, 0.365390748f},
-std::array<float,2>{0.0717975423f, 0.420611739f},
-std::array<float,2>{0.654573441f, 0.946612716f},
-std::array<float,2>{0.487156153f, 0.625902712f},
-std::array<float,2>{0.812736273f, 0.0959047228f},
-std::array<float,2>{0.156071261f, 0.0324390456f},
-std::array<float,2>{0.529694915f, 0.729725897f},
-std::array<float,2>{0.351828367f, 0.882758737f},
-std::array<float,2>{0.985070884f, 0.485733837f},
-std::array<float,2>{0.375995964f, 0.28491509f},
-std::array<float,2>{0.778406501f, 0.805783927f},
-std::array<float,2>{0.0585386194f, 0.615957797f},
-std::array<float,2>{0.729215026f, 0.201979086f},
-std::array<float,2>{0.461321592f, 0.0834907144f},
-std::array<float,2>{0.859694064f, 0.67131263f},
-std::array<float,2>{0.0953606069f, 0.986162484f},
-std::array<float,2>{0.675456703f, 0.385108829f},
-std::array<float,2>{0.198717728f, 0.336819917f},
-std::array<float,2>{0.577150643f, 0.871948183f},
-std::array<float,2>{0.273698121f, 0.529657066f},
-std::array<float,2>{0.905891955f, 0.181174174f},
-std::array<float,2>{0.00551138679f, 0.242179602f},
-std::array<float,2>{0.706335068f, 0.567100883f},
-std::array<float,2>{0.432721555f, 0.779282153f},
-std::array<float,2>{0.808634818f, 0.271560937f},
-std::array<float,2>{0.333570331f, 0.450053543f},
-std::array<float,2>{0.942119658f, 0.909513652f},
-std::array<float,2>{0.166622669f, 0.709311008f},
-std::array<float,2>{0.542554557f, 0.024575064f},
-std::array<float,2>{0.387823939f, 0.134754881f},
-std::array<float,2>{0.767865062f, 0.555826783f},
-std::array<float,2>{0.0481873564f, 0.833580613f},
-std::array<float,2>{0.722701371f, 0.344118029f},
-std::array<float,2>{0.143525749f, 0.422917336f},
-std::array<float,2>{0.51753521f, 0.966577649f},
-std::array<float,2>{0.347015619f, 0.648877382f},
-std::array<float,2>{0.99663198f, 0.110053532f},
-std::array<float,2>{0.0668447465f, 0.0527576134f},
-std::array<float,2>{0.644999087f, 0.740994215f},
-std::array<float,2>{0.49390617f, 0.903427601f},
-std::array<float,2>{0.821331143f, 0.472502738f},
-std::array<float,2>{0.294403255f, 0.31119138f},
-std::array<float,2>{0.923443198f, 0.792126775f},
-std::array<float,2>{0.237712085f, 0.608276248f},
-std::array<float,2>{0.61253649f, 0.203545898f},
-std::array<float,2>{0.336883992f, 0.0674031228f},
-std::array<float,2>{0.949273467f, 0.677455723f},
-std::array<float,2>{0.163719788f, 0.97780931f},
-std::array<float,2>{0.533702612f, 0.396412551f},
-std::array<float,2>{0.0147413006f, 0.316969395f},
-std::array<float,2>{0.718258619f, 0.849033058f},
-std::array<float,2>{0.424810767f, 0.502534091f},
-std::array<float,2>{0.803072274f, 0.160744086f},
-std::array<float,2>{0.193583995f, 0.231715128f},
-std::array<float,2>{0.564369142f, 0.583833694f},
-std::array<float,2>{0.268674493f, 0.762409866f},
-std::array<float,2>{0.894210279f, 0.251671135f},
-std::array<float,2>{0.457456678f, 0.453982979f},
-std::array<float,2>{0.868050098f, 0.934311152f},
-std::array<float,2>{0.107756808f, 0.692365825f},
-std::array<float,2>{0.684378266f, 0.00205768598f},
-std::array<float,2>{0.25084275f, 0.197559625f},
-std::array<float,2>{0.877513587f, 0.611389875f},
-std::array<float,2>{0.21224986f, 0.812370777f},
-std::array<float,2>{0.589172125f, 0.285590827f},
-std::array<float,2>{0.110011593f, 0.489982039f},
-std::array<float,2>{0.663814425f, 0.876049042f},
-std::array<float,2>{0.445034146f, 0.733633459f},
-std::array<float,2>{0.855769634f, 0.0378544703f},
-std::array<float,2>{0.173045978f, 0.0996322259f},
-std::array<float,2>{0.559983134f, 0.631854951f},
-std::array<float,2>{0.3257837f, 0.952371001f},
-std::array<float,2>{0.953420818f, 0.417105913f},
-std::array<float,2>{0.416543484f, 0.361229181f},
-std::array<float,2>{0.782169759f, 0.814882934f},
-std::array<float,2>{0.0178020019f, 0.545668125f},
-std::array<float,2>{0.69169265f, 0.153085932f},
-std::array<float,2>{0.479081959f, 0.0280510709f},
-std::array<float,2>{0.841080189f, 0.704166412f},
-std::array<float,2>{0.0810006857f, 0.911371589f},
-std::array<float,2>{0.625551999f, 0.448160261f},
-std::array<float,2>{0.223998874f, 0.268735141f},
-std::array<float,2>{0.601554036f, 0.776826024f},
-std::array<float,2>{0.303899467f, 0.565821946f},
-std::array<float,2>{0.917280853f, 0.237221688f},
-std::array<float,2>{0.0461887754f, 0.186607614f},
-std::array<float,2>{0.743893921f, 0.526208818f},
-std::array<float,2>{0.402240843f, 0.870375037f},
-std::array<float,2>{0.761113644f, 0.340304673f},
-std::array<float,2>{0.369736105f, 0.388991356f},
-std::array<float,2>{0.982740581f, 0.992145538f},
-std::array<float,2>{0.13245593f, 0.664927185f},
-std::array<float,2>{0.504365861f, 0.0812356398f},
-std::array<float,2>{0.451714545f, 0.242337853f},
-std::array<float,2>{0.848835588f, 0.575540304f},
-std::array<float,2>{0.117308177f, 0.771418154f},
-std::array<float,2>{0.671418607f, 0.278578401f},
-std::array<float,2>{0.203980371f, 0.441674799f},
-std::array<float,2>{0.580344796f, 0.920788527f},
-std::array<float,2>{0.260422587f, 0.714673638f},
-std::array<float,2>{0.885185242f, 0.0174709875f},
-std::array<float,2>{0.0310574174f, 0.0860152692f},
-std::array<float,2>{0.702699363f, 0.659446716f},
-std::array<float,2>{0.41254577f, 0.993807495f},
-std::array<float,2>{0.793297231f, 0.377471834f},
-std::array<float,2>{0.313507974f, 0.331827968f},
-std::array<float,2>{0.962985814f, 0.862444937f},
-std::array<float,2>{0.186491713f, 0.522870004f},
-std::array<float,2>{0.547922432f, 0.175559253f},
-std::array<float,2>{0.307788849f, 0.0416129008f},
-std::array<float,2>{0.912936985f, 0.723470449f},
-std::array<float,2>{0.232158333f, 0.887419701f},
-std::array<float,2>{0.606702983f, 0.494635135f},
-std::array<float,2>{0.0874510258f, 0.291151404f},
-std::array<float,2>{0.636183202f, 0.802194357f},
-std::array<float,2>{0.47203663f, 0.617590547f},
-std::array<float,2>{0.828944802f, 0.193132535f},
-std::array<float,2>{0.136746794f, 0.144626334f},
-std::array<float,2>{0.510168552f, 0.538603067f},
-std::array<float,2>{0.36267212f, 0.824183941f},
-std::array<float,2>{0.970661938f, 0.368339896f},
-std::array<float,2>{0.395790875f, 0.410373151f},
-std::array<float,2>{0.750047445f, 0.939337015f},
-std::array<float,2>{0.0346648842f, 0.637920201f},
-std::array<float,2>{0.740667939f, 0.104020081f},
-std::array<float,2>{0.35887298f, 0.166267902f},
-std::array<float,2>{0.991148531f, 0.511151135f},
-std::array<float,2>{0.14989756f, 0.856086373f},
-std::array<float,2>{0.52389437f, 0.324182481f},
-std::array<float,2>{0.0616864488f, 0.403058618f},
-std::array<float,2>{0.732010722f, 0.971381426f},
-std::array<float,2>{0.379370809f, 0.686109245f},
-std::array<float,2>{0.776385784f, 0.076203011f},
-std::array<float,2>{0.243274271f, 0.00797600299f},
-std::array<float,2>{0.622685075f, 0.695971549f},
-std::array<float,2>{0.285303354f, 0.922038734f},
-std::array<float,2>{0.932580471f, 0.465125829f},
-std::array<float,2>{0.489060938f, 0.261298835f},
-std::array<float,2>{0.816658258f, 0.751995027f},
-std::array<float,2>{0.075962007f, 0.587842345f},
-std::array<float,2>{0.648683369f, 0.223196685f},
-std::array<float,2>{0.435714722f, 0.120119818f},
-std::array<float,2>{0.805542588f, 0.644217908f},
-std::array<float,2>{0.00175749045f, 0.957476258f},
-std::array<float,2>{0.708895802f, 0.434804618f},
-std::array<float,2>{0.168783277f, 0.351953655f},
-std::array<float,2>{0.544014156f, 0.840378702f},
-std::array<float,2>{0.330420792f, 0.550469756f},
-std::array<float,2>{0.939315081f, 0.125990272f},
-std::array<float,2>{0.0988631994f, 0.214224249f},
-std::array<float,2>{0.678230941f, 0.595095873f},
-std::array<float,2>{0.465542942f, 0.781744421f},
-std::array<float,2>{0.86366117f, 0.303391606f},
-std::array<float,2>{0.277917117f, 0.481176674f},
-std::array<float,2>{0.898951292f, 0.896614969f},
-std::array<float,2>{0.199858695f, 0.749370813f},
-std::array<float,2>{0.570839584f, 0.0624225661f},
-std::array<float,2>{0.453365892f, 0.144472361f},
-std::array<float,2>{0.873950303f, 0.532591939f},
-std::array<float,2>{0.102091976f, 0.8250072f},
-std::array<float,2>{0.683458745f, 0.37438634f},
-std::array<float,2>{0.191166446f, 0.409993947f},
-std::array<float,2>{0.566411555f, 0.943329871f},
-std::array<float,2>{0.270869076f, 0.634275794f},
-std::array<float,2>{0.897358179f, 0.106081277f},
-std::array<float,2>{0.00861846562f, 0.0458549708f},
-std::array<float,2>{0.714330912f, 0.719741702f},
-std::array<float,2>{0.42713818f, 0.885620594f},
-std::array<float,2>{0.798247099f, 0.496685863f},
-std::array<float,2>{0.340411544f, 0.294839472f},
-std::array<float,2>{0.947105587f, 0.799684823f},
-std::array<float,2>{0.157079205f, 0.621973693f},
-std::array<float,2>{0.536729693f, 0.190325901f},
-std::array<float,2>{0.289816856f, 0.092302978f},
-std::array<float,2>{0.929132342f, 0.661292195f},
-std::array<float,2>{0.238708183f, 0.998879492f},
-std::array<float,2>{0.616921067f, 0.381397843f},
-std::array<float,2>{0.063660875f, 0.334927052f},
-std::array<float,2>{0.64442265f, 0.865773499f},
-std::array<float,2>{0.499435216f, 0.517602026f},
-std::array<float,2>{0.827763617f, 0.176931918f},
-std::array<float,2>{0.146809071f, 0.248088866f},
-std::array<float,2>{0.521822631f, 0.572711349f},
-std::array<float,2>{0.350634992f, 0.766310811f},
-std::array<float,2>{0.995453417f, 0.276600838f},
-std::array<float,2>{0.385606408f, 0.437565356f},
-std::array<float,2>{0.773022532f, 0.916859925f},
-std::array<float,2>{0.0542138778f, 0.717004657f},
-std::array<float,2>{0.719278097f, 0.0232955404f},
-std::array<float,2>{0.371948421f, 0.21577923f},
-std::array<float,2>{0.979536474f, 0.599614024f},
-std::array<float,2>{0.128383115f, 0.786353528f},
-std::array<float,2>{0.501369834f, 0.299209625f},
-std::array<float,2>{0.0425046943f, 0.479487181f},
-std::array<float,2>{0.746954679f, 0.893707693f},
-std::array<float,2>{0.403481901f, 0.742303908f},
-std::array<float,2>{0.765437901f, 0.0554085448f},
-std::array<float,2>{0.220852792f, 0.123926118f},
-std::array<float,2>{0.59634316f, 0.647433043f},
-std::array<float,2>{0.297972769f, 0.955282927f},
-std::array<float,2>{0.92181474f, 0.432049215f},
-std::array<float,2>{0.481258303f, 0.356178939f},
-std::array<float,2>{0.838282168f, 0.838958502f},
-std::array<float,2>{0.0859037414f, 0.551831007f},
-std::array<float,2>{0.632001996f, 0.132111579f},
-std::array<float,2>{0.4188416f, 0.0132200718f},
-std::array<float,2>{0.786236048f, 0.702882111f},
-std::array<float,2>{0.0210600365f, 0.925800741f},
-std::array<float,2>{0.690375268f, 0.461568594f},
-std::array<float,2>{0.176096916f, 0.263620794f},
-std::array<float,2>{0.555723786f, 0.757063329f},
-std::array<float,2>{0.323554695f, 0.593472481f},
-std::array<float,2>{0.958329916f, 0.221477076f},
-std::array<float,2>{0.115788788f, 0.168332621f},
-std::array<float,2>{0.659200132f, 0.515071452f},
-std::array<float,2>{0.438385516f, 0.851888955f},
-std::array<float,2>{0.852347732f, 0.32639873f},
-std::array<float,2>{0.256233454f, 0.398688406f},
-std::array<float,2>{0.880121112f, 0.976265132f},
-std::array<float,2>{0.217365816f, 0.683133006f},
-std::array<float,2>{0.590792358f, 0.0710493922f},
-std::array<float,2>{0.390977651f, 0.229018092f},
-std::array<float,2>{0.756216407f, 0.579470992f},
-std::array<float,2>{0.0366659686f, 0.759538889f},
-std::array<float,2>{0.735601723f, 0.257744908f},
-std::array<float,2>{0.135676235f, 0.458815485f},
-std::array<float,2>{0.51319778f, 0.933323145f},
-std::array<float,2>{0.365392089f, 0.690441132f},
-std::array<float,2>{0.97326982f, 0.00441215187f},
-std::array<float,2>{0.0922384709f, 0.0627040341f},
-std::array<float,2>{0.638357878f, 0.674965382f},
-std::array<float,2>{0.476126134f, 0.984106839f},
-std::array<float,2>{0.834780514f, 0.393591285f},
-std::array<float,2>{0.312310129f, 0.315774411f},
-std::array<float,2>{0.907612324f, 0.845900893f},
-std::array<float,2>{0.229715452f, 0.506252885f},
-std::array<float,2>{0.605011165f, 0.156538069f},
-std::array<float,2>{0.319603652f, 0.0468998142f},
-std::array<float,2>{0.966461539f, 0.736256659f},
-std::array<float,2>{0.181483477f, 0.900943279f},
-std::array<float,2>{0.551275969f, 0.474087119f},
-std::array<float,2>{0.02456397f, 0.30772227f},
-std::array<float,2>{0.696190596f, 0.795314908f},
-std::array<float,2>{0.410116017f, 0.603096366f},
-std::array<float,2>{0.790210247f, 0.207860529f},
-std::array<float,2>{0.207398221f, 0.13899748f},
-std::array<float,2>{0.582431614f, 0.560402811f},
-std::array<float,2>{0.262322217f, 0.830743492f},
-std::array<float,2>{0.890147328f, 0.351347089f},
-std::array<float,2>{0.448009849f, 0.426309824f},
-std::array<float,2>{0.845540166f, 0.962515652f},
-std::array<float,2>{0.123270676f, 0.6557675f},
-std::array<float,2>{0.665404379f, 0.115388185f},
-std::array<float,2>{0.277176499f, 0.182784706f},
-std::array<float,2>{0.904169142f, 0.528635323f},
-std::array<float,2>{0.196879312f, 0.874373317f},
-std::array<float,2>{0.575312853f, 0.339419335f},
-std::array<float,2>{0.0970868319f, 0.384495199f},
-std::array<float,2>{0.672174811f, 0.986351013f},
-std::array<float,2>{0.46471718f, 0.668110549f},
-std::array<float,2>{0.863180518f, 0.0852039754f},
-std::array<float,2>{0.165972874f, 0.0258839093f},
-std::array<float,2>{0.539852202f, 0.708927155f},
-std::array<float,2>{0.334123969f, 0.90670079f},
-std::array<float,2>{0.943943501f, 0.452970982f},
-std::array<float,2>{0.429854363f, 0.270671487f},
-std::array<float,2>{0.811146736f, 0.78053081f},
-std::array<float,2>{0.00759747485f, 0.569692969f},
-std::array<float,2>{0.703722f, 0.239694893f},
-std::array<float,2>{0.485841095f, 0.0941493139f},
-std::array<float,2>{0.814589322f, 0.628731966f},
-std::array<float,2>{0.072985284f, 0.948399186f},
-std::array<float,2>{0.653379202f, 0.41870454f},
-std::array<float,2>{0.249027967f, 0.364358962f},
-std::array<float,2>{0.620558619f, 0.819662631f},
-std::array<float,2>{0.281996995f, 0.540456951f},
-std::array<float,2>{0.93517673f, 0.151882485f},
-std::array<float,2>{0.0564394854f, 0.199862093f},
-std::array<float,2>{0.727495432f, 0.613994002f},
-std::array<float,2>{0.378068089f, 0.806692779f},
-std::array<float,2>{0.780956507f, 0.28206715f},
-std::array<float,2>{0.354599178f, 0.488169402f},
-std::array<float,2>{0.987896621f, 0.880010962f},
-std::array<float,2>{0.152592316f, 0.727437019f},
-std::array<float,2>{0.528548181f, 0.0336614214f},
-std::array<float,2>{0.422770381f, 0.162603676f},
-std::array<float,2>{0.800813019f, 0.500479043f},
-std::array<float,2>{0.012155789f, 0.850462794f},
-std::array<float,2>{0.714900553f, 0.319470495f},
-std::array<float,2>{0.161228836f, 0.396878451f},
-std::array<float,2>{0.531925321f, 0.978956163f},
-std::array<float,2>{0.337963462f, 0.678196371f},
-std::array<float,2>{0.952060521f, 0.0686339065f},
-std::array<float,2>{0.106559329f, 0.000250570301f},
-std::array<float,2>{0.685747921f, 0.693991303f},
-std::array<float,2>{0.459124476f, 0.93654567f},
-std::array<float,2>{0.869633853f, 0.456962764f},
-std::array<float,2>{0.267443448f, 0.252805531f},
-std::array<float,2>{0.892415226f, 0.765472412f},
-std::array<float,2>{0.192054272f, 0.585000038f},
-std::array<float,2>{0.565334678f, 0.234072328f},
-std::array<float,2>{0.344907463f, 0.113004126f},
-std::array<float,2>{0.998269558f, 0.651082516f},
-std::array<float,2>{0.141750932f, 0.967748046f},
-std::array<float,2>{0.518351495f, 0.425004303f},
-std::array<float,2>{0.0504532345f, 0.347001314f},
-std::array<float,2>{0.726101995f, 0.835555136f},
-std::array<float,2>{0.389602572f, 0.557608426f},
-std::array<float,2>{0.76621449f, 0.136637419f},
-std::array<float,2>{0.234418109f, 0.205593586f},
-std::array<float,2>{0.610175431f, 0.605902314f},
-std::array<float,2>{0.295633107f, 0.790420473f},
-std::array<float,2>{0.925755024f, 0.310443282f},
-std::array<float,2>{0.494247854f, 0.469218314f},
-std::array<float,2>{0.823043227f, 0.904814899f},
-std::array<float,2>{0.0693741888f, 0.738408267f},
-std::array<float,2>{0.647511423f, 0.0523567162f},
-std::array<float,2>{0.301027596f, 0.235028088f},
-std::array<float,2>{0.914093971f, 0.562793553f},
-std::array<float,2>{0.226016596f, 0.773826122f},
-std::array<float,2>{0.597850323f, 0.266906232f},
-std::array<float,2>{0.0781567991f, 0.446127594f},
-std::array<float,2>{0.627634585f, 0.913431585f},
-std::array<float,2>{0.478073865f, 0.706952989f},
-std::array<float,2>{0.842894495f, 0.0301299021f},
-std::array<float,2>{0.128923714f, 0.0788702965f},
-std::array<float,2>{0.507582903f, 0.66727072f},
-std::array<float,2>{0.368006647f, 0.989659309f},
-std::array<float,2>{0.982096255f, 0.387030393f},
-std::array<float,2>{0.399730682f, 0.342819363f},
-std::array<float,2>{0.759579837f, 0.868780553f},
-std::array<float,2>{0.0436220765f, 0.523896515f},
-std::array<float,2>{0.745120764f, 0.185100198f},
-std::array<float,2>{0.44280231f, 0.0371033661f},
-std::array<float,2>{0.857715487f, 0.732154131f},
-std::array<float,2>{0.112863958f, 0.877620161f},
-std::array<float,2>{0.660378575f, 0.492041886f},
-std::array<float,2>{0.213062733f, 0.288406283f},
-std::array<float,2>{0.586810052f, 0.809838474f},
-std::array<float,2>{0.252062738f, 0.60992223f},
-std::array<float,2>{0.875470698f, 0.196452647f},
-std::array<float,2>{0.0157728065f, 0.15545626f},
-std::array<float,2>{0.694250226f, 0.544151485f},
-std::array<float,2>{0.415470004f, 0.813442767f},
-std::array<float,2>{0.784187913f, 0.362271547f},
-std::array<float,2>{0.327840954f, 0.415985376f},
-std::array<float,2>{0.956131935f, 0.950969756f},
-std::array<float,2>{0.174012303f, 0.62942487f},
-std::array<float,2>{0.561940849f, 0.098958537f},
-std::array<float,2>{0.469740093f, 0.194201127f},
-std::array<float,2>{0.831750512f, 0.620632887f},
-std::array<float,2>{0.0895857736f, 0.803624153f},
-std::array<float,2>{0.633805811f, 0.290762812f},
-std::array<float,2>{0.234209761f, 0.49287945f},
-std::array<float,2>{0.607723117f, 0.890265644f},
-std::array<float,2>{0.305891186f, 0.724677801f},
-std::array<float,2>{0.911527991f, 0.0409735031f},
-std::array<float,2>{0.0317817554f, 0.102364801f},
-std::array<float,2>{0.740080476f, 0.640009761f},
-std::array<float,2>{0.39665854f, 0.941018701f},
-std::array<float,2>{0.752432227f, 0.413529545f},
-std::array<float,2>{0.36108008f, 0.370865881f},
-std::array<float,2>{0.971574664f, 0.822255552f},
-std::array<float,2>{0.140349224f, 0.535721183f},
-std::array<float,2>{0.509421885f, 0.147714555f},
-std::array<float,2>{0.259213835f, 0.0175982472f},
-std::array<float,2>{0.883507609f, 0.71140182f},
-std::array<float,2>{0.20566307f, 0.919766307f},
-std::array<float,2>{0.578959465f, 0.443818867f},
-std::array<float,2>{0.12036074f, 0.280324638f},
-std::array<float,2>{0.669251084f, 0.77301693f},
-std::array<float,2>{0.450935066f, 0.577407777f},
-std::array<float,2>{0.850823104f, 0.244248122f},
-std::array<float,2>{0.184510306f, 0.172857016f},
-std::array<float,2>{0.550521195f, 0.52036494f},
-std::array<float,2>{0.31557712f, 0.860378981f},
-std::array<float,2>{0.961555362f, 0.328779191f},
-std::array<float,2>{0.411520332f, 0.37558952f},
-std::array<float,2>{0.795769751f, 0.995515764f},
-std::array<float,2>{0.0281086378f, 0.656616151f},
-std::array<float,2>{0.700118601f, 0.0896909535f},
-std::array<float,2>{0.328979045f, 0.128481865f},
-std::array<float,2>{0.940434754f, 0.548368812f},
-std::array<float,2>{0.170129284f, 0.842383504f},
-std::array<float,2>{0.545457244f, 0.35374862f},
-std::array<float,2>{0.00230182405f, 0.437424809f},
-std::array<float,2>{0.710026264f, 0.959013045f},
-std::array<float,2>{0.433994532f, 0.641585529f},
-std::array<float,2>{0.807897389f, 0.118107468f},
-std::array<float,2>{0.203104451f, 0.0591232292f},
-std::array<float,2>{0.573478937f, 0.747606337f},
-std::array<float,2>{0.280381888f, 0.894830525f},
-std::array<float,2>{0.900953591f, 0.484219581f},
-std::array<float,2>{0.467015326f, 0.301493913f},
-std::array<float,2>{0.866709471f, 0.784040511f},
-std::array<float,2>{0.100395218f, 0.597166061f},
-std::array<float,2>{0.676870227f, 0.211181179f},
-std::array<float,2>{0.381929278f, 0.0754822344f},
-std::array<float,2>{0.774652302f, 0.685031712f},
-std::array<float,2>{0.0598603226f, 0.970185578f},
-std::array<float,2>{0.73385793f, 0.405511022f},
-std::array<float,2>{0.150810644f, 0.321315348f},
-std::array<float,2>{0.525975645f, 0.858786702f},
-std::array<float,2>{0.356849164f, 0.508507073f},
-std::array<float,2>{0.989408016f, 0.164261058f},
-std::array<float,2>{0.0773939863f, 0.226465881f},
-std::array<float,2>{0.651294947f, 0.588803291f},
-std::array<float,2>{0.492019862f, 0.751399398f},
-std::array<float,2>{0.818911076f, 0.258656114f},
-std::array<float,2>{0.287975341f, 0.46778366f},
-std::array<float,2>{0.93126303f, 0.924322486f},
-std::array<float,2>{0.245597243f, 0.697773695f},
-std::array<float,2>{0.62403965f, 0.0100002941f},
-std::array<float,2>{0.486475825f, 0.151368409f},
-std::array<float,2>{0.813181102f, 0.540965378f},
-std::array<float,2>{0.0715288818f, 0.820109904f},
-std::array<float,2>{0.655052364f, 0.364773244f},
-std::array<float,2>{0.246178374f, 0.418315917f},
-std::array<float,2>{0.617921889f, 0.948925555f},
-std::array<float,2>{0.28380242f, 0.628254712f},
-std::array<float,2>{0.936343372f, 0.0944241434f},
-std::array<float,2>{0.0577926002f, 0.0338226631f},
-std::array<float,2>{0.728699386f, 0.726677716f},
-std::array<float,2>{0.376897782f, 0.880672097f},
-std::array<float,2>{0.778993964f, 0.48742491f},
-std::array<float,2>{0.352394402f, 0.281623125f},
-std::array<float,2>{0.98473686f, 0.807555139f},
-std::array<float,2>{0.155704543f, 0.613379419f},
-std::array<float,2>{0.530240297f, 0.199571446f},
-std::array<float,2>{0.274298608f, 0.0857461318f},
-std::array<float,2>{0.905628204f, 0.668935716f},
-std::array<float,2>{0.198776215f, 0.986840487f},
-std::array<float,2>{0.577860475f, 0.383846134f},
-std::array<float,2>{0.0951419547f, 0.339058131f},
-std::array<float,2>{0.67506814f, 0.874831021f},
-std::array<float,2>{0.461881459f, 0.528958917f},
-std::array<float,2>{0.860053718f, 0.183390662f},
-std::array<float,2>{0.166278318f, 0.240133017f},
-std::array<float,2>{0.542138219f, 0.570162058f},
-std::array<float,2>{0.333013266f, 0.781025767f},
-std::array<float,2>{0.941544592f, 0.271122634f},
-std::array<float,2>{0.433579952f, 0.452548355f},
-std::array<float,2>{0.809171975f, 0.907125056f},
-std::array<float,2>{0.00497899996f, 0.708310902f},
-std::array<float,2>{0.706707239f, 0.0256785713f},
-std::array<float,2>{0.31794855f, 0.207277626f},
-std::array<float,2>{0.967918396f, 0.60258615f},
-std::array<float,2>{0.183566004f, 0.795513213f},
-std::array<float,2>{0.554386258f, 0.308174312f},
-std::array<float,2>{0.0269593298f, 0.474359959f},
-std::array<float,2>{0.697517753f, 0.9008044f},
-std::array<float,2>{0.406364471f, 0.735721111f},
-std::array<float,2>{0.791715086f, 0.0477331504f},
-std::array<float,2>{0.210083187f, 0.115806051f},
-std::array<float,2>{0.585169852f, 0.655660987f},
-std::array<float,2>{0.263739169f, 0.962123394f},
-std::array<float,2>{0.887832046f, 0.42617026f},
-std::array<float,2>{0.446634382f, 0.350945801f},
-std::array<float,2>{0.847212315f, 0.830146492f},
-std::array<float,2>{0.12171419f, 0.559619009f},
-std::array<float,2>{0.667029679f, 0.139575481f},
-std::array<float,2>{0.392847091f, 0.0043920842f},
-std::array<float,2>{0.75441879f, 0.691244304f},
-std::array<float,2>{0.0386221074f, 0.932843864f},
-std::array<float,2>{0.736998916f, 0.458327621f},
-std::array<float,2>{0.133720294f, 0.257044703f},
-std::array<float,2>{0.513816178f, 0.759266913f},
-std::array<float,2>{0.363296121f, 0.579716206f},
-std::array<float,2>{0.976027429f, 0.228649125f},
-std::array<float,2>{0.0902289301f, 0.157220066f},
-std::array<float,2>{0.639274478f, 0.50646615f},
-std::array<float,2>{0.473368645f, 0.846314788f},
-std::array<float,2>{0.832945287f, 0.315959692f},
-std::array<float,2>{0.309315503f, 0.394238859f},
-std::array<float,2>{0.908675969f, 0.983485162f},
-std::array<float,2>{0.228498787f, 0.675316393f},
-std::array<float,2>{0.602365196f, 0.0633398816f},
-std::array<float,2>{0.420146614f, 0.221050218f},
-std::array<float,2>{0.788972616f, 0.593121469f},
-std::array<float,2>{0.0219460875f, 0.757451653f},
-std::array<float,2>{0.687750638f, 0.263020426f},
-std::array<float,2>{0.179280072f, 0.461223096f},
-std::array<float,2>{0.558484972f, 0.92670989f},
-std::array<float,2>{0.321688801f, 0.702271402f},
-std::array<float,2>{0.960300982f, 0.0131321345f},
-std::array<float,2>{0.113842137f, 0.0705122501f},
-std::array<float,2>{0.656523705f, 0.682940483f},
-std::array<float,2>{0.441233337f, 0.975968242f},
-std::array<float,2>{0.853919864f, 0.399164975f},
-std::array<float,2>{0.254446864f, 0.327033937f},
-std::array<float,2>{0.881353021f, 0.852443397f},
-std::array<float,2>{0.215391546f, 0.515319467f},
-std::array<float,2>{0.592762589f, 0.168776065f},
-std::array<float,2>{0.373732448f, 0.0550067648f},
-std::array<float,2>{0.976995468f, 0.742700219f},
-std::array<float,2>{0.126432016f, 0.894063234f},
-std::array<float,2>{0.502930403f, 0.478589147f},
-std::array<float,2>{0.0391370095f, 0.299677789f},
-std::array<float,2>{0.7496472f, 0.786625445f},
-std::array<float,2>{0.404916644f, 0.600472212f},
-std::array<float,2>{0.76361984f, 0.215089083f},
-std::array<float,2>{0.219517961f, 0.132791653f},
-std::array<float,2>{0.595006168f, 0.55227679f},
-std::array<float,2>{0.299570829f, 0.839762986f},
-std::array<float,2>{0.919781327f, 0.355592936f},
-std::array<float,2>{0.483330995f, 0.432429016f},
-std::array<float,2>{0.837833464f, 0.955994844f},
-std::array<float,2>{0.0837460309f, 0.646559417f},
-std::array<float,2>{0.629507065f, 0.123488054f},
-std::array<float,2>{0.292560488f, 0.17766878f},
-std::array<float,2>{0.926978946f, 0.518471599f},
-std::array<float,2>{0.241834417f, 0.86558336f},
-std::array<float,2>{0.613662601f, 0.334314942f},
-std::array<float,2>{0.0645214915f, 0.38114202f},
-std::array<float,2>{0.641308069f, 0.998109937f},
-std::array<float,2>{0.497399211f, 0.661736429f},
-std::array<float,2>{0.825618446f, 0.0922072157f},
-std::array<float,2>{0.145030782f, 0.022595102f},
-std::array<float,2>{0.520008445f, 0.717513323f},
-std::array<float,2>{0.347849309f, 0.916249216f},
-std::array<float,2>{0.992509365f, 0.438458055f},
-std::array<float,2>{0.384100288f, 0.276995808f},
-std::array<float,2>{0.769790471f, 0.766006112f},
-std::array<float,2>{0.0526851118f, 0.573238134f},
-std::array<float,2>{0.722131073f, 0.248998672f},
-std::array<float,2>{0.455154717f, 0.105542205f},
-std::array<float,2>{0.872532785f, 0.634343803f},
-std::array<float,2>{0.10512194f, 0.942383409f},
-std::array<float,2>{0.680628657f, 0.40949434f},
-std::array<float,2>{0.187566549f, 0.374685824f},
-std::array<float,2>{0.569460332f, 0.824589849f},
-std::array<float,2>{0.271638721f, 0.533013284f},
-std::array<float,2>{0.895401359f, 0.14372617f},
-std::array<float,2>{0.0098399343f, 0.189572692f},
-std::array<float,2>{0.711464584f, 0.62130475f},
-std::array<float,2>{0.428948522f, 0.799124539f},
-std::array<float,2>{0.799435496f, 0.294292986f},
-std::array<float,2>{0.3429088f, 0.496461213f},
-std::array<float,2>{0.948443711f, 0.885048151f},
-std::array<float,2>{0.160129532f, 0.720367432f},
-std::array<float,2>{0.537149906f, 0.0451941527f},
-std::array<float,2>{0.379650682f, 0.16467011f},
-std::array<float,2>{0.777298987f, 0.507886529f},
-std::array<float,2>{0.0622617193f, 0.859289467f},
-std::array<float,2>{0.731852055f, 0.322123975f},
-std::array<float,2>{0.150253996f, 0.405820161f},
-std::array<float,2>{0.524177015f, 0.970607638f},
-std::array<float,2>{0.359074175f, 0.685536683f},
-std::array<float,2>{0.990511894f, 0.0758775473f},
-std::array<float,2>{0.0752946064f, 0.0106477207f},
-std::array<float,2>{0.649314046f, 0.697692156f},
-std::array<float,2>{0.488547772f, 0.923880935f},
-std::array<float,2>{0.817013323f, 0.468413442f},
-std::array<float,2>{0.285761446f, 0.257961124f},
-std::array<float,2>{0.93181324f, 0.751520753f},
-std::array<float,2>{0.243983269f, 0.588208497f},
-std::array<float,2>{0.622421801f, 0.225903779f},
-std::array<float,2>{0.33067891f, 0.117501989f},
-std::array<float,2>{0.938565612f, 0.640970051f},
-std::array<float,2>{0.168032452f, 0.959717095f},
-std::array<float,2>{0.544684052f, 0.436814189f},
-std::array<float,2>{0.00100195024f, 0.354436755f},
-std::array<float,2>{0.70840466f, 0.841879606f},
-std::array<float,2>{0.436496079f, 0.548201025f},
-std::array<float,2>{0.804712594f, 0.128002569f},
-std::array<float,2>{0.199602798f, 0.211613759f},
-std::array<float,2>{0.570378304f, 0.597247005f},
-std::array<float,2>{0.277597338f, 0.783460557f},
-std::array<float,2>{0.898493409f, 0.300820708f},
-std::array<float,2>{0.465161115f, 0.483426541f},
-std::array<float,2>{0.864047885f, 0.895458877f},
-std::array<float,2>{0.0991620272f, 0.747224867f},
-std::array<float,2>{0.67778331f, 0.0590096377f},
-std::array<float,2>{0.260221571f, 0.244899407f},
-std::array<float,2>{0.885362387f, 0.57774514f},
-std::array<float,2>{0.203443989f, 0.772757888f},
-std::array<float,2>{0.580704272f, 0.281026334f},
-std::array<float,2>{0.117976353f, 0.444111496f},
-std::array<float,2>{0.671213388f, 0.919051588f},
-std::array<float,2>{0.451404512f, 0.711672962f},
-std::array<float,2>{0.849297941f, 0.0184512753f},
-std::array<float,2>{0.185780793f, 0.0891099721f},
-std::array<float,2>{0.548516631f, 0.657177389f},
-std::array<float,2>{0.31408307f, 0.995738983f},
-std::array<float,2>{0.963689923f, 0.375095338f},
-std::array<float,2>{0.412946343f, 0.328605145f},
-std::array<float,2>{0.793695807f, 0.861326516f},
-std::array<float,2>{0.0305422377f, 0.519538224f},
-std::array<float,2>{0.702187777f, 0.173532277f},
-std::array<float,2>{0.472444922f, 0.0400462709f},
-std::array<float,2>{0.828401268f, 0.725400567f},
-std::array<float,2>{0.0871776789f, 0.890041649f},
-std::array<float,2>{0.636649966f, 0.492250293f},
-std::array<float,2>{0.23183839f, 0.290053457f},
-std::array<float,2>{0.607140064f, 0.803049028f},
-std::array<float,2>{0.308305442f, 0.620456755f},
-std::array<float,2>{0.912432313f, 0.193775699f},
-std::array<float,2>{0.0351471715f, 0.148133099f},
-std::array<float,2>{0.741056144f, 0.535464227f},
-std::array<float,2>{0.396116406f, 0.821644664f},
-std::array<float,2>{0.750864625f, 0.370412171f},
-std::array<float,2>{0.363193452f, 0.413586527f},
-std::array<float,2>{0.969897628f, 0.940454364f},
-std::array<float,2>{0.137208238f, 0.640244424f},
-std::array<float,2>{0.510717928f, 0.10178528f},
-std::array<float,2>{0.444502234f, 0.197120577f},
-std::array<float,2>{0.856326878f, 0.609592021f},
-std::array<float,2>{0.109615102f, 0.810250282f},
-std::array<float,2>{0.663367271f, 0.289013952f},
-std::array<float,2>{0.21255818f, 0.491654158f},
-std::array<float,2>{0.589394331f, 0.877239168f},
-std::array<float,2>{0.25015679f, 0.731707752f},
-std::array<float,2>{0.877329648f, 0.0364399776f},
-std::array<float,2>{0.0180782266f, 0.0994366482f},
-std::array<float,2>{0.692214549f, 0.628928304f},
-std::array<float,2>{0.416386336f, 0.950637996f},
-std::array<float,2>{0.781636834f, 0.415142268f},
-std::array<float,2>{0.325404108f, 0.361360341f},
-std::array<float,2>{0.954041481f, 0.812784135f},
-std::array<float,2>{0.173404843f, 0.544769883f},
-std::array<float,2>{0.560079932f, 0.156241417f},
-std::array<float,2>{0.304216057f, 0.0294227004f},
-std::array<float,2>{0.917934835f, 0.706343532f},
-std::array<float,2>{0.224123016f, 0.913720608f},
-std::array<float,2>{0.601058364f, 0.445504338f},
-std::array<float,2>{0.0800806358f, 0.267547667f},
-std::array<float,2>{0.625291467f, 0.774363518f},
-std::array<float,2>{0.478933036f, 0.563127398f},
-std::array<float,2>{0.84167254f, 0.234604806f},
-std::array<float,2>{0.132254139f, 0.184979916f},
-std::array<float,2>{0.504795671f, 0.524347484f},
-std::array<float,2>{0.369535476f, 0.868231237f},
-std::array<float,2>{0.983111978f, 0.343545645f},
-std::array<float,2>{0.401793867f, 0.387331426f},
-std::array<float,2>{0.761386514f, 0.989756763f},
-std::array<float,2>{0.0465096384f, 0.667644501f},
-std::array<float,2>{0.743177235f, 0.0785248354f},
-std::array<float,2>{0.347524583f, 0.135785058f},
-std::array<float,2>{0.996272385f, 0.556984246f},
-std::array<float,2>{0.142715335f, 0.835262954f},
-std::array<float,2>{0.517022371f, 0.347355306f},
-std::array<float,2>{0.0487362854f, 0.425770313f},
-std::array<float,2>{0.723151326f, 0.967103124f},
-std::array<float,2>{0.388459086f, 0.650849283f},
-std::array<float,2>{0.768101573f, 0.112770744f},
-std::array<float,2>{0.237934023f, 0.0520899557f},
-std::array<float,2>{0.613014698f, 0.738871217f},
-std::array<float,2>{0.294517398f, 0.904560924f},
-std::array<float,2>{0.922873974f, 0.469260931f},
-std::array<float,2>{0.493363261f, 0.309637755f},
-std::array<float,2>{0.82188338f, 0.790943027f},
-std::array<float,2>{0.0672245249f, 0.60613662f},
-std::array<float,2>{0.645216703f, 0.205120414f},
-std::array<float,2>{0.425709277f, 0.0693035647f},
-std::array<float,2>{0.803379774f, 0.678290188f},
-std::array<float,2>{0.0152733689f, 0.979351699f},
-std::array<float,2>{0.718510151f, 0.397252947f},
-std::array<float,2>{0.163167655f, 0.32009998f},
-std::array<float,2>{0.53335166f, 0.849837065f},
-std::array<float,2>{0.336094797f, 0.500624657f},
-std::array<float,2>{0.949866235f, 0.162192658f},
-std::array<float,2>{0.108299889f, 0.233719796f},
-std::array<float,2>{0.6837551f, 0.585906744f},
-std::array<float,2>{0.457730353f, 0.765133142f},
-std::array<float,2>{0.867261171f, 0.252186656f},
-std::array<float,2>{0.26929f, 0.456442833f},
-std::array<float,2>{0.893911481f, 0.937212706f},
-std::array<float,2>{0.194176137f, 0.693578124f},
-std::array<float,2>{0.563724339f, 0.000802629569f},
-std::array<float,2>{0.464314163f, 0.180894062f},
-std::array<float,2>{0.862633348f, 0.530185461f},
-std::array<float,2>{0.0972147658f, 0.871555507f},
-std::array<float,2>{0.672546327f, 0.336035937f},
-std::array<float,2>{0.196643546f, 0.385380834f},
-std::array<float,2>{0.576105416f, 0.985789478f},
-std::array<float,2>{0.276576012f, 0.671709895f},
-std::array<float,2>{0.903680444f, 0.0839618444f},
-std::array<float,2>{0.00727021741f, 0.0252904706f},
-std::array<float,2>{0.703404844f, 0.709473312f},
-std::array<float,2>{0.430221915f, 0.909904897f},
-std::array<float,2>{0.81090039f, 0.449648142f},
-std::array<float,2>{0.334871113f, 0.272284061f},
-std::array<float,2>{0.943618238f, 0.778604627f},
-std::array<float,2>{0.165370256f, 0.566711485f},
-std::array<float,2>{0.539097846f, 0.241534606f},
-std::array<float,2>{0.28164947f, 0.0962094292f},
-std::array<float,2>{0.934792578f, 0.625155985f},
-std::array<float,2>{0.249646947f, 0.946932852f},
-std::array<float,2>{0.620960236f, 0.419927716f},
-std::array<float,2>{0.072709851f, 0.365877718f},
-std::array<float,2>{0.654082656f, 0.817510128f},
-std::array<float,2>{0.485422105f, 0.54258126f},
-std::array<float,2>{0.814987659f, 0.148563251f},
-std::array<float,2>{0.153057814f, 0.201574743f},
-std::array<float,2>{0.528819799f, 0.615624189f},
-std::array<float,2>{0.355122894f, 0.806370854f},
-std::array<float,2>{0.987365365f, 0.284665167f},
-std::array<float,2>{0.378522366f, 0.486214787f},
-std::array<float,2>{0.780679584f, 0.882294655f},
-std::array<float,2>{0.0559515469f, 0.730352581f},
-std::array<float,2>{0.72675705f, 0.0330359526f},
-std::array<float,2>{0.366206318f, 0.228496656f},
-std::array<float,2>{0.972726047f, 0.581596971f},
-std::array<float,2>{0.134844914f, 0.759998977f},
-std::array<float,2>{0.512783587f, 0.255262643f},
-std::array<float,2>{0.0364888422f, 0.459739685f},
-std::array<float,2>{0.735891819f, 0.93021208f},
-std::array<float,2>{0.391403794f, 0.687906802f},
-std::array<float,2>{0.756439149f, 0.0066051092f},
-std::array<float,2>{0.230081022f, 0.0655342713f},
-std::array<float,2>{0.604664624f, 0.672700763f},
-std::array<float,2>{0.311632693f, 0.982021272f},
-std::array<float,2>{0.908029139f, 0.391320229f},
-std::array<float,2>{0.475888073f, 0.313142478f},
-std::array<float,2>{0.834244907f, 0.845519423f},
-std::array<float,2>{0.0927554518f, 0.50490129f},
-std::array<float,2>{0.63777113f, 0.160093233f},
-std::array<float,2>{0.409588367f, 0.0490455441f},
-std::array<float,2>{0.790591776f, 0.736767232f},
-std::array<float,2>{0.0253734514f, 0.899896741f},
-std::array<float,2>{0.695787907f, 0.476376683f},
-std::array<float,2>{0.180980012f, 0.3065705f},
-std::array<float,2>{0.551006377f, 0.794880033f},
-std::array<float,2>{0.320037663f, 0.605229139f},
-std::array<float,2>{0.966279328f, 0.210651204f},
-std::array<float,2>{0.123876572f, 0.137793928f},
-std::array<float,2>{0.66560477f, 0.561955452f},
-std::array<float,2>{0.44735834f, 0.829189479f},
-std::array<float,2>{0.845089674f, 0.349100798f},
-std::array<float,2>{0.262054265f, 0.429551631f},
-std::array<float,2>{0.889676809f, 0.964157283f},
-std::array<float,2>{0.207667068f, 0.652595282f},
-std::array<float,2>{0.582708955f, 0.114463031f},
-std::array<float,2>{0.404058158f, 0.218347773f},
-std::array<float,2>{0.764697075f, 0.599321246f},
-std::array<float,2>{0.0421249419f, 0.788144231f},
-std::array<float,2>{0.74610734f, 0.298549861f},
-std::array<float,2>{0.128551558f, 0.47733441f},
-std::array<float,2>{0.501753986f, 0.891862214f},
-std::array<float,2>{0.371271461f, 0.745867372f},
-std::array<float,2>{0.980094731f, 0.0569043159f},
-std::array<float,2>{0.085185051f, 0.12176162f},
-std::array<float,2>{0.63247031f, 0.646291494f},
-std::array<float,2>{0.48075977f, 0.954018891f},
-std::array<float,2>{0.838425517f, 0.429844171f},
-std::array<float,2>{0.298455596f, 0.357543468f},
-std::array<float,2>{0.921362638f, 0.836217165f},
-std::array<float,2>{0.221313387f, 0.553584099f},
-std::array<float,2>{0.596152246f, 0.129245505f},
-std::array<float,2>{0.324212492f, 0.0138796372f},
-std::array<float,2>{0.958782732f, 0.70005846f},
-std::array<float,2>{0.176490009f, 0.929046869f},
-std::array<float,2>{0.556196868f, 0.464584768f},
-std::array<float,2>{0.0208025463f, 0.264275759f},
-std::array<float,2>{0.689586103f, 0.755334914f},
-std::array<float,2>{0.418359548f, 0.590258002f},
-std::array<float,2>{0.787074089f, 0.218964353f},
-std::array<float,2>{0.216898322f, 0.169967443f},
-std::array<float,2>{0.589934587f, 0.512798309f},
-std::array<float,2>{0.256669879f, 0.853937387f},
-std::array<float,2>{0.880788028f, 0.325088412f},
-std::array<float,2>{0.437520593f, 0.400989503f},
-std::array<float,2>{0.851885736f, 0.97282815f},
-std::array<float,2>{0.115592554f, 0.680581152f},
-std::array<float,2>{0.659700871f, 0.074200049f},
-std::array<float,2>{0.271117151f, 0.141247541f},
-std::array<float,2>{0.896886647f, 0.535026073f},
-std::array<float,2>{0.190477759f, 0.827578843f},
-std::array<float,2>{0.56696099f, 0.372589052f},
-std::array<float,2>{0.101631775f, 0.407390594f},
-std::array<float,2>{0.682790279f, 0.943953633f},
-std::array<float,2>{0.453773111f, 0.635958612f},
-std::array<float,2>{0.87314558f, 0.109296381f},
-std::array<float,2>{0.156299859f, 0.0443173684f},
-std::array<float,2>{0.536378443f, 0.721726716f},
-std::array<float,2>{0.340329915f, 0.884165704f},
-std::array<float,2>{0.946448028f, 0.498305768f},
-std::array<float,2>{0.427537054f, 0.295913517f},
-std::array<float,2>{0.798644543f, 0.798359334f},
-std::array<float,2>{0.00823078211f, 0.624021173f},
-std::array<float,2>{0.714367092f, 0.187766105f},
-std::array<float,2>{0.499735087f, 0.0904191136f},
-std::array<float,2>{0.827298641f, 0.663736701f},
-std::array<float,2>{0.0642292723f, 0.996208668f},
-std::array<float,2>{0.643909395f, 0.378922135f},
-std::array<float,2>{0.239190713f, 0.333076715f},
-std::array<float,2>{0.616380155f, 0.863485694f},
-std::array<float,2>{0.289381385f, 0.515684664f},
-std::array<float,2>{0.9293859f, 0.179591104f},
-std::array<float,2>{0.053994935f, 0.246819511f},
-std::array<float,2>{0.718803942f, 0.571381271f},
-std::array<float,2>{0.384836912f, 0.769269109f},
-std::array<float,2>{0.772808731f, 0.273748726f},
-std::array<float,2>{0.351515085f, 0.439747125f},
-std::array<float,2>{0.995613217f, 0.915960491f},
-std::array<float,2>{0.147275925f, 0.715276003f},
-std::array<float,2>{0.522440135f, 0.0214469898f},
-std::array<float,2>{0.434334189f, 0.126594558f},
-std::array<float,2>{0.808297455f, 0.549884677f},
-std::array<float,2>{0.00281682331f, 0.839897454f},
-std::array<float,2>{0.710476398f, 0.352448016f},
-std::array<float,2>{0.17089732f, 0.435332656f},
-std::array<float,2>{0.545311987f, 0.957642198f},
-std::array<float,2>{0.328215986f, 0.64358604f},
-std::array<float,2>{0.941388607f, 0.120825313f},
-std::array<float,2>{0.0999871939f, 0.0616715774f},
-std::array<float,2>{0.67770046f, 0.749659777f},
-std::array<float,2>{0.467298687f, 0.896982729f},
-std::array<float,2>{0.866654992f, 0.480505347f},
-std::array<float,2>{0.280914843f, 0.302793115f},
-std::array<float,2>{0.900442541f, 0.781369805f},
-std::array<float,2>{0.202604905f, 0.595503092f},
-std::array<float,2>{0.574029505f, 0.214452997f},
-std::array<float,2>{0.357169181f, 0.0771072581f},
-std::array<float,2>{0.990133405f, 0.685626686f},
-std::array<float,2>{0.151325643f, 0.970836222f},
-std::array<float,2>{0.525560081f, 0.402386576f},
-std::array<float,2>{0.0604693182f, 0.323568195f},
-std::array<float,2>{0.734372675f, 0.855640113f},
-std::array<float,2>{0.382720679f, 0.511364937f},
-std::array<float,2>{0.775369823f, 0.166630298f},
-std::array<float,2>{0.246071324f, 0.22285758f},
-std::array<float,2>{0.624856114f, 0.587331414f},
-std::array<float,2>{0.287586868f, 0.752791286f},
-std::array<float,2>{0.930737734f, 0.261070311f},
-std::array<float,2>{0.491444945f, 0.465433449f},
-std::array<float,2>{0.818760514f, 0.922676563f},
-std::array<float,2>{0.0777507052f, 0.695697725f},
-std::array<float,2>{0.650558293f, 0.0085467305f},
-std::array<float,2>{0.306340665f, 0.192529842f},
-std::array<float,2>{0.912096679f, 0.618075609f},
-std::array<float,2>{0.233815685f, 0.802360773f},
-std::array<float,2>{0.607963383f, 0.291535676f},
-std::array<float,2>{0.0890241265f, 0.494489282f},
-std::array<float,2>{0.634744883f, 0.886975586f},
-std::array<float,2>{0.470371217f, 0.722976387f},
-std::array<float,2>{0.831082821f, 0.0412274227f},
-std::array<float,2>{0.139781535f, 0.10380096f},
-std::array<float,2>{0.508972824f, 0.638192117f},
-std::array<float,2>{0.360666126f, 0.938858807f},
-std::array<float,2>{0.9710989f, 0.410986841f},
-std::array<float,2>{0.397408843f, 0.36911574f},
-std::array<float,2>{0.752619207f, 0.823622167f},
-std::array<float,2>{0.0315406658f, 0.538346291f},
-std::array<float,2>{0.739387333f, 0.145256504f},
-std::array<float,2>{0.45053333f, 0.0170791764f},
-std::array<float,2>{0.851124287f, 0.713877499f},
-std::array<float,2>{0.120831698f, 0.920358121f},
-std::array<float,2>{0.669723988f, 0.442240506f},
-std::array<float,2>{0.205243409f, 0.279046208f},
-std::array<float,2>{0.578185439f, 0.770737946f},
-std::array<float,2>{0.259539753f, 0.576128125f},
-std::array<float,2>{0.883214772f, 0.242998928f},
-std::array<float,2>{0.0277644284f, 0.175076231f},
-std::array<float,2>{0.699648082f, 0.52298677f},
-std::array<float,2>{0.411690146f, 0.862930298f},
-std::array<float,2>{0.795068562f, 0.331392795f},
-std::array<float,2>{0.316140294f, 0.377416939f},
-std::array<float,2>{0.960950315f, 0.993263423f},
-std::array<float,2>{0.184002131f, 0.65999788f},
-std::array<float,2>{0.550283551f, 0.0867509469f},
-std::array<float,2>{0.478015333f, 0.236694142f},
-std::array<float,2>{0.843475342f, 0.566245615f},
-std::array<float,2>{0.0788031742f, 0.776977062f},
-std::array<float,2>{0.62708056f, 0.269382298f},
-std::array<float,2>{0.226356894f, 0.447478026f},
-std::array<float,2>{0.598181367f, 0.911731958f},
-std::array<float,2>{0.301567346f, 0.70497328f},
-std::array<float,2>{0.914978325f, 0.0277484413f},
-std::array<float,2>{0.0430230312f, 0.0819692686f},
-std::array<float,2>{0.745720387f, 0.664218545f},
-std::array<float,2>{0.40014866f, 0.991494477f},
-std::array<float,2>{0.758904636f, 0.38918668f},
-std::array<float,2>{0.36737141f, 0.340542555f},
-std::array<float,2>{0.981580079f, 0.871081889f},
-std::array<float,2>{0.129860982f, 0.525805414f},
-std::array<float,2>{0.507134676f, 0.187456936f},
-std::array<float,2>{0.252468646f, 0.0371918157f},
-std::array<float,2>{0.875533819f, 0.733912945f},
-std::array<float,2>{0.21361655f, 0.876888216f},
-std::array<float,2>{0.586293161f, 0.489707917f},
-std::array<float,2>{0.11259637f, 0.285734981f},
-std::array<float,2>{0.660878837f, 0.811748147f},
-std::array<float,2>{0.443158269f, 0.611863077f},
-std::array<float,2>{0.85811913f, 0.197964311f},
-std::array<float,2>{0.174330309f, 0.152784586f},
-std::array<float,2>{0.562113762f, 0.545191944f},
-std::array<float,2>{0.327322066f, 0.81531173f},
-std::array<float,2>{0.95676285f, 0.360505372f},
-std::array<float,2>{0.415831745f, 0.417881876f},
-std::array<float,2>{0.785027564f, 0.952714741f},
-std::array<float,2>{0.0161761753f, 0.632587671f},
-std::array<float,2>{0.693703473f, 0.100399442f},
-std::array<float,2>{0.338806152f, 0.160230234f},
-std::array<float,2>{0.951395869f, 0.502440214f},
-std::array<float,2>{0.162024781f, 0.849239528f},
-std::array<float,2>{0.531695127f, 0.316793203f},
-std::array<float,2>{0.0123184314f, 0.395705074f},
-std::array<float,2>{0.715371907f, 0.978305876f},
-std::array<float,2>{0.422147065f, 0.677189231f},
-std::array<float,2>{0.801623046f, 0.0683373064f},
-std::array<float,2>{0.19159919f, 0.00271770242f},
-std::array<float,2>{0.564848781f, 0.691651106f},
-std::array<float,2>{0.2670376f, 0.933775425f},
-std::array<float,2>{0.892049611f, 0.453306198f},
-std::array<float,2>{0.459624261f, 0.251040667f},
-std::array<float,2>{0.869556367f, 0.762204409f},
-std::array<float,2>{0.107343212f, 0.583206654f},
-std::array<float,2>{0.686073244f, 0.231992483f},
-std::array<float,2>{0.388797194f, 0.109778136f},
-std::array<float,2>{0.766101658f, 0.64916122f},
-std::array<float,2>{0.0498597659f, 0.966151893f},
-std::array<float,2>{0.725980222f, 0.423344105f},
-std::array<float,2>{0.142104641f, 0.344432205f},
-std::array<float,2>{0.517722249f, 0.83301729f},
-std::array<float,2>{0.345622361f, 0.55633986f},
-std::array<float,2>{0.998940766f, 0.133973584f},
-std::array<float,2>{0.0699391067f, 0.203651831f},
-std::array<float,2>{0.648088574f, 0.607626021f},
-std::array<float,2>{0.494740695f, 0.792709529f},
-std::array<float,2>{0.82270813f, 0.31072396f},
-std::array<float,2>{0.295263797f, 0.472120523f},
-std::array<float,2>{0.925218165f, 0.904144406f},
-std::array<float,2>{0.235128418f, 0.740408599f},
-std::array<float,2>{0.60945183f, 0.0532349646f},
-std::array<float,2>{0.474201977f, 0.158375174f},
-std::array<float,2>{0.833646834f, 0.504576921f},
-std::array<float,2>{0.0911370888f, 0.844027221f},
-std::array<float,2>{0.64024204f, 0.313604712f},
-std::array<float,2>{0.226718277f, 0.391625434f},
-std::array<float,2>{0.602894664f, 0.981062651f},
-std::array<float,2>{0.310179293f, 0.672898471f},
-std::array<float,2>{0.909771383f, 0.06491445f},
-std::array<float,2>{0.0378728062f, 0.00708562043f},
-std::array<float,2>{0.737944305f, 0.688644886f},
-std::array<float,2>{0.393761545f, 0.931632578f},
-std::array<float,2>{0.755649269f, 0.460259676f},
-std::array<float,2>{0.365052193f, 0.254871815f},
-std::array<float,2>{0.975286245f, 0.761003673f},
-std::array<float,2>{0.134647533f, 0.580273747f},
-std::array<float,2>{0.515372872f, 0.226950303f},
-std::array<float,2>{0.26486063f, 0.113783225f},
-std::array<float,2>{0.886997521f, 0.653545678f},
-std::array<float,2>{0.209163278f, 0.963343501f},
-std::array<float,2>{0.584382296f, 0.428062916f},
-std::array<float,2>{0.122759812f, 0.348155797f},
-std::array<float,2>{0.666971922f, 0.828359663f},
-std::array<float,2>{0.445591629f, 0.560929596f},
-std::array<float,2>{0.846646845f, 0.13691324f},
-std::array<float,2>{0.182157293f, 0.209245667f},
-std::array<float,2>{0.553222358f, 0.603763402f},
-std::array<float,2>{0.316970646f, 0.793687105f},
-std::array<float,2>{0.967612922f, 0.305495739f},
-std::array<float,2>{0.408185124f, 0.47471723f},
-std::array<float,2>{0.792894363f, 0.898573279f},
-std::array<float,2>{0.0254598297f, 0.738029897f},
-std::array<float,2>{0.698487461f, 0.0499927215f},
-std::array<float,2>{0.332621247f, 0.241037309f},
-std::array<float,2>{0.942749441f, 0.567965925f},
-std::array<float,2>{0.16766715f, 0.777551353f},
-std::array<float,2>{0.541699111f, 0.272795081f},
-std::array<float,2>{0.00411922159f, 0.45099318f},
-std::array<float,2>{0.705520034f, 0.908848882f},
-std::array<float,2>{0.432616472f, 0.710839987f},
-std::array<float,2>{0.80991292f, 0.0237874556f},
-std::array<float,2>{0.197670534f, 0.082245253f},
-std::array<float,2>{0.576644242f, 0.670762897f},
-std::array<float,2>{0.274656087f, 0.984958112f},
-std::array<float,2>{0.905166328f, 0.386311591f},
-std::array<float,2>{0.462839633f, 0.337773293f},
-std::array<float,2>{0.860744476f, 0.873003662f},
-std::array<float,2>{0.0939120427f, 0.530320525f},
-std::array<float,2>{0.67427361f, 0.180324808f},
-std::array<float,2>{0.375956684f, 0.031842526f},
-std::array<float,2>{0.777391315f, 0.728565753f},
-std::array<float,2>{0.0570339784f, 0.88094449f},
-std::array<float,2>{0.7298733f, 0.484974325f},
-std::array<float,2>{0.154304132f, 0.283907741f},
-std::array<float,2>{0.530775011f, 0.804942369f},
-std::array<float,2>{0.353515416f, 0.616930306f},
-std::array<float,2>{0.98558569f, 0.202694282f},
-std::array<float,2>{0.0706003979f, 0.150096968f},
-std::array<float,2>{0.656163812f, 0.541798353f},
-std::array<float,2>{0.487422198f, 0.816947758f},
-std::array<float,2>{0.813875914f, 0.366354793f},
-std::array<float,2>{0.285093218f, 0.421867967f},
-std::array<float,2>{0.936688066f, 0.94614464f},
-std::array<float,2>{0.247830197f, 0.626633763f},
-std::array<float,2>{0.618923604f, 0.0975878611f},
-std::array<float,2>{0.427886158f, 0.189420208f},
-std::array<float,2>{0.800386906f, 0.624325812f},
-std::array<float,2>{0.011206043f, 0.797395229f},
-std::array<float,2>{0.712681174f, 0.295515001f},
-std::array<float,2>{0.158640921f, 0.499537379f},
-std::array<float,2>{0.538902342f, 0.88314569f},
-std::array<float,2>{0.342219442f, 0.721299112f},
-std::array<float,2>{0.947978318f, 0.043828655f},
-std::array<float,2>{0.104335405f, 0.108270891f},
-std::array<float,2>{0.680972815f, 0.63538444f},
-std::array<float,2>{0.456382662f, 0.94500941f},
-std::array<float,2>{0.871257901f, 0.406559378f},
-std::array<float,2>{0.273244113f, 0.371391982f},
-std::array<float,2>{0.895672798f, 0.826709986f},
-std::array<float,2>{0.18930544f, 0.533210635f},
-std::array<float,2>{0.569153726f, 0.142479286f},
-std::array<float,2>{0.349306017f, 0.0197845642f},
-std::array<float,2>{0.993435621f, 0.716168642f},
-std::array<float,2>{0.146210521f, 0.915023029f},
-std::array<float,2>{0.520510077f, 0.441306174f},
-std::array<float,2>{0.0516495481f, 0.274916768f},
-std::array<float,2>{0.72109133f, 0.768348336f},
-std::array<float,2>{0.383453429f, 0.57087779f},
-std::array<float,2>{0.770909548f, 0.247458026f},
-std::array<float,2>{0.240881369f, 0.177861035f},
-std::array<float,2>{0.614847839f, 0.517416f},
-std::array<float,2>{0.291498214f, 0.864519775f},
-std::array<float,2>{0.926267803f, 0.332633793f},
-std::array<float,2>{0.496237248f, 0.379969865f},
-std::array<float,2>{0.824457526f, 0.997840643f},
-std::array<float,2>{0.0656702444f, 0.662799954f},
-std::array<float,2>{0.642053008f, 0.0908594579f},
-std::array<float,2>{0.300416201f, 0.13045609f},
-std::array<float,2>{0.918316722f, 0.553925991f},
-std::array<float,2>{0.220433429f, 0.837339282f},
-std::array<float,2>{0.594517469f, 0.358986437f},
-std::array<float,2>{0.0828123987f, 0.430685192f},
-std::array<float,2>{0.63048476f, 0.954422653f},
-std::array<float,2>{0.483753115f, 0.644585609f},
-std::array<float,2>{0.836821139f, 0.1228894f},
-std::array<float,2>{0.125478506f, 0.0576405898f},
-std::array<float,2>{0.502712488f, 0.744480193f},
-std::array<float,2>{0.374783248f, 0.89071691f},
-std::array<float,2>{0.977840185f, 0.47832337f},
-std::array<float,2>{0.40560019f, 0.29692167f},
-std::array<float,2>{0.762129903f, 0.787710547f},
-std::array<float,2>{0.0407325476f, 0.597973645f},
-std::array<float,2>{0.748807132f, 0.217390195f},
-std::array<float,2>{0.440380126f, 0.0727545694f},
-std::array<float,2>{0.855236709f, 0.681617141f},
-std::array<float,2>{0.115152679f, 0.974145532f},
-std::array<float,2>{0.657801747f, 0.401639491f},
-std::array<float,2>{0.216211125f, 0.325360477f},
-std::array<float,2>{0.592862546f, 0.85489589f},
-std::array<float,2>{0.255299121f, 0.512304127f},
-std::array<float,2>{0.882654965f, 0.17130664f},
-std::array<float,2>{0.02330143f, 0.220247939f},
-std::array<float,2>{0.689151704f, 0.59147191f},
-std::array<float,2>{0.421425402f, 0.754391372f},
-std::array<float,2>{0.787320018f, 0.265542835f},
-std::array<float,2>{0.320653409f, 0.463267058f},
-std::array<float,2>{0.959337831f, 0.927756071f},
-std::array<float,2>{0.178279445f, 0.700285673f},
-std::array<float,2>{0.556646407f, 0.0151170772f},
-std::array<float,2>{0.394769609f, 0.146172702f},
-std::array<float,2>{0.751462162f, 0.53785497f},
-std::array<float,2>{0.0341151394f, 0.822552443f},
-std::array<float,2>{0.741305888f, 0.367797673f},
-std::array<float,2>{0.138634861f, 0.411341071f},
-std::array<float,2>{0.511127651f, 0.938233376f},
-std::array<float,2>{0.361561537f, 0.63714695f},
-std::array<float,2>{0.969725013f, 0.105461448f},
-std::array<float,2>{0.0865801796f, 0.0424565859f},
-std::array<float,2>{0.634863794f, 0.724551082f},
-std::array<float,2>{0.471332192f, 0.888329148f},
-std::array<float,2>{0.829161286f, 0.495738834f},
-std::array<float,2>{0.306830913f, 0.292858452f},
-std::array<float,2>{0.913861036f, 0.801223814f},
-std::array<float,2>{0.230839893f, 0.618575275f},
-std::array<float,2>{0.605745554f, 0.1922663f},
-std::array<float,2>{0.31315276f, 0.0872048661f},
-std::array<float,2>{0.964224637f, 0.658824027f},
-std::array<float,2>{0.18672201f, 0.992305756f},
-std::array<float,2>{0.547582209f, 0.378423989f},
-std::array<float,2>{0.0295861755f, 0.330343127f},
-std::array<float,2>{0.701783359f, 0.862018764f},
-std::array<float,2>{0.413177103f, 0.522237957f},
-std::array<float,2>{0.793992698f, 0.174558118f},
-std::array<float,2>{0.204293832f, 0.243978113f},
-std::array<float,2>{0.581581473f, 0.57435751f},
-std::array<float,2>{0.261133045f, 0.770066321f},
-std::array<float,2>{0.886143267f, 0.277764648f},
-std::array<float,2>{0.452884674f, 0.443143785f},
-std::array<float,2>{0.848148584f, 0.920967519f},
-std::array<float,2>{0.118208885f, 0.713410735f},
-std::array<float,2>{0.67028451f, 0.0158047527f},
-std::array<float,2>{0.278477401f, 0.213016406f},
-std::array<float,2>{0.90013504f, 0.593916297f},
-std::array<float,2>{0.201109454f, 0.782289386f},
-std::array<float,2>{0.572260916f, 0.304628164f},
-std::array<float,2>{0.0978600159f, 0.482048362f},
-std::array<float,2>{0.679684043f, 0.897904754f},
-std::array<float,2>{0.466106594f, 0.74826616f},
-std::array<float,2>{0.864646018f, 0.0608798116f},
-std::array<float,2>{0.169016764f, 0.119931087f},
-std::array<float,2>{0.543387234f, 0.642692685f},
-std::array<float,2>{0.33122921f, 0.958671927f},
-std::array<float,2>{0.938028038f, 0.434337974f},
-std::array<float,2>{0.437140137f, 0.352578521f},
-std::array<float,2>{0.806255937f, 0.841193199f},
-std::array<float,2>{0.000363959989f, 0.549277604f},
-std::array<float,2>{0.707574666f, 0.125099167f},
-std::array<float,2>{0.489823133f, 0.00919204019f},
-std::array<float,2>{0.817644894f, 0.696650565f},
-std::array<float,2>{0.0750309899f, 0.922914684f},
-std::array<float,2>{0.649449766f, 0.465878755f},
-std::array<float,2>{0.243139163f, 0.260144383f},
-std::array<float,2>{0.621956944f, 0.753585935f},
-std::array<float,2>{0.286629021f, 0.586714268f},
-std::array<float,2>{0.933418036f, 0.224024892f},
-std::array<float,2>{0.0614289306f, 0.167867362f},
-std::array<float,2>{0.730474412f, 0.510699451f},
-std::array<float,2>{0.380280465f, 0.85709691f},
-std::array<float,2>{0.776107788f, 0.322682261f},
-std::array<float,2>{0.357884973f, 0.403850973f},
-std::array<float,2>{0.992110789f, 0.972631931f},
-std::array<float,2>{0.148528814f, 0.686761975f},
-std::array<float,2>{0.524926364f, 0.0776994601f},
-std::array<float,2>{0.458222747f, 0.231120661f},
-std::array<float,2>{0.869119763f, 0.582778811f},
-std::array<float,2>{0.10845533f, 0.762876153f},
-std::array<float,2>{0.684956193f, 0.25076732f},
-std::array<float,2>{0.194719657f, 0.454332918f},
-std::array<float,2>{0.562667608f, 0.935428202f},
-std::array<float,2>{0.267826051f, 0.692586601f},
-std::array<float,2>{0.892874002f, 0.00298184319f},
-std::array<float,2>{0.0142627256f, 0.0667941198f},
-std::array<float,2>{0.717246711f, 0.676029921f},
-std::array<float,2>{0.424095482f, 0.977539062f},
-std::array<float,2>{0.803905189f, 0.395006865f},
-std::array<float,2>{0.337102801f, 0.318168342f},
-std::array<float,2>{0.951133907f, 0.848233461f},
-std::array<float,2>{0.162171379f, 0.503390789f},
-std::array<float,2>{0.534938455f, 0.161592737f},
-std::array<float,2>{0.293152064f, 0.0545039549f},
-std::array<float,2>{0.922461867f, 0.741716683f},
-std::array<float,2>{0.23695305f, 0.903092563f},
-std::array<float,2>{0.61206162f, 0.471268475f},
-std::array<float,2>{0.0674424693f, 0.312067211f},
-std::array<float,2>{0.645802736f, 0.791125119f},
-std::array<float,2>{0.492910117f, 0.609240413f},
-std::array<float,2>{0.820366502f, 0.204673648f},
-std::array<float,2>{0.143852323f, 0.133433834f},
-std::array<float,2>{0.516315401f, 0.554955244f},
-std::array<float,2>{0.346239209f, 0.832398236f},
-std::array<float,2>{0.997137368f, 0.345174342f},
-std::array<float,2>{0.38692072f, 0.42229414f},
-std::array<float,2>{0.769065022f, 0.964900255f},
-std::array<float,2>{0.0477882959f, 0.649733603f},
-std::array<float,2>{0.723973989f, 0.111021928f},
-std::array<float,2>{0.371001154f, 0.185997695f},
-std::array<float,2>{0.983655155f, 0.526623189f},
-std::array<float,2>{0.131053016f, 0.869410336f},
-std::array<float,2>{0.505552828f, 0.341617376f},
-std::array<float,2>{0.0452798344f, 0.390288085f},
-std::array<float,2>{0.742818236f, 0.99054724f},
-std::array<float,2>{0.400459737f, 0.665939867f},
-std::array<float,2>{0.760622263f, 0.081018813f},
-std::array<float,2>{0.223210186f, 0.0287625473f},
-std::array<float,2>{0.600548208f, 0.703980267f},
-std::array<float,2>{0.303313047f, 0.9108513f},
-std::array<float,2>{0.916040123f, 0.448395312f},
-std::array<float,2>{0.479877174f, 0.267758131f},
-std::array<float,2>{0.840654552f, 0.775780439f},
-std::array<float,2>{0.0815631822f, 0.564657927f},
-std::array<float,2>{0.625997365f, 0.237532452f},
-std::array<float,2>{0.417667896f, 0.100945421f},
-std::array<float,2>{0.783187866f, 0.631547749f},
-std::array<float,2>{0.0185668003f, 0.951417267f},
-std::array<float,2>{0.693218291f, 0.416682065f},
-std::array<float,2>{0.172230527f, 0.359548867f},
-std::array<float,2>{0.559353292f, 0.815588236f},
-std::array<float,2>{0.324427962f, 0.546407282f},
-std::array<float,2>{0.954335153f, 0.153469056f},
-std::array<float,2>{0.110465653f, 0.198428899f},
-std::array<float,2>{0.662408292f, 0.612572372f},
-std::array<float,2>{0.444228142f, 0.811317503f},
-std::array<float,2>{0.857070267f, 0.286439657f},
-std::array<float,2>{0.251595348f, 0.489133209f},
-std::array<float,2>{0.878506184f, 0.875091791f},
-std::array<float,2>{0.211486265f, 0.733155489f},
-std::array<float,2>{0.588198602f, 0.0382230654f},
-std::array<float,2>{0.448798865f, 0.140547201f},
-std::array<float,2>{0.843999028f, 0.559522569f},
-std::array<float,2>{0.124988854f, 0.831586421f},
-std::array<float,2>{0.664856851f, 0.35041526f},
-std::array<float,2>{0.208871812f, 0.427334517f},
-std::array<float,2>{0.583753586f, 0.961176157f},
-std::array<float,2>{0.262968451f, 0.654453576f},
-std::array<float,2>{0.88961339f, 0.116617426f},
-std::array<float,2>{0.0236835554f, 0.0483931974f},
-std::array<float,2>{0.696892738f, 0.7349177f},
-std::array<float,2>{0.408305794f, 0.902341425f},
-std::array<float,2>{0.78980118f, 0.472997576f},
-std::array<float,2>{0.318795532f, 0.30667159f},
-std::array<float,2>{0.965735316f, 0.796703041f},
-std::array<float,2>{0.180488557f, 0.602290154f},
-std::array<float,2>{0.552538037f, 0.208837941f},
-std::array<float,2>{0.310859114f, 0.0640789047f},
-std::array<float,2>{0.906843245f, 0.674629807f},
-std::array<float,2>{0.228536278f, 0.982789755f},
-std::array<float,2>{0.604309976f, 0.393262208f},
-std::array<float,2>{0.0933101922f, 0.315257967f},
-std::array<float,2>{0.637434781f, 0.8471843f},
-std::array<float,2>{0.474832594f, 0.507560194f},
-std::array<float,2>{0.835834205f, 0.158054546f},
-std::array<float,2>{0.13650997f, 0.230302215f},
-std::array<float,2>{0.512277067f, 0.578633487f},
-std::array<float,2>{0.367122293f, 0.758439124f},
-std::array<float,2>{0.974373221f, 0.256732464f},
-std::array<float,2>{0.392411262f, 0.457284659f},
-std::array<float,2>{0.757425487f, 0.932143986f},
-std::array<float,2>{0.0357665531f, 0.689841449f},
-std::array<float,2>{0.735119104f, 0.00568241952f},
-std::array<float,2>{0.354448497f, 0.200776726f},
-std::array<float,2>{0.986958086f, 0.614948452f},
-std::array<float,2>{0.153500885f, 0.80840373f},
-std::array<float,2>{0.528304398f, 0.282874644f},
-std::array<float,2>{0.0547375679f, 0.487032533f},
-std::array<float,2>{0.72825259f, 0.87981081f},
-std::array<float,2>{0.377420187f, 0.728462517f},
-std::array<float,2>{0.779323697f, 0.0342086181f},
-std::array<float,2>{0.248813882f, 0.0949364379f},
-std::array<float,2>{0.620020151f, 0.627378047f},
-std::array<float,2>{0.283155084f, 0.94761914f},
-std::array<float,2>{0.933953047f, 0.419412702f},
-std::array<float,2>{0.484681517f, 0.363984525f},
-std::array<float,2>{0.816112697f, 0.819081426f},
-std::array<float,2>{0.0734046698f, 0.539288282f},
-std::array<float,2>{0.653141737f, 0.151251316f},
-std::array<float,2>{0.431105554f, 0.0270535983f},
-std::array<float,2>{0.811555564f, 0.707829714f},
-std::array<float,2>{0.00617242185f, 0.907530963f},
-std::array<float,2>{0.704863012f, 0.451211512f},
-std::array<float,2>{0.164359719f, 0.269896805f},
-std::array<float,2>{0.540043473f, 0.780053198f},
-std::array<float,2>{0.33522439f, 0.568793118f},
-std::array<float,2>{0.945165277f, 0.23910442f},
-std::array<float,2>{0.0959535837f, 0.182550892f},
-std::array<float,2>{0.672884107f, 0.527816951f},
-std::array<float,2>{0.463391989f, 0.873096228f},
-std::array<float,2>{0.862143874f, 0.338379294f},
-std::array<float,2>{0.27550745f, 0.383060098f},
-std::array<float,2>{0.90330863f, 0.98753351f},
-std::array<float,2>{0.196158543f, 0.66927737f},
-std::array<float,2>{0.574958801f, 0.084462285f},
-std::array<float,2>{0.386384279f, 0.249647334f},
-std::array<float,2>{0.771817505f, 0.573803365f},
-std::array<float,2>{0.053526178f, 0.766709268f},
-std::array<float,2>{0.719898522f, 0.276089907f},
-std::array<float,2>{0.148060009f, 0.438785166f},
-std::array<float,2>{0.523004055f, 0.917538404f},
-std::array<float,2>{0.350490332f, 0.718617797f},
-std::array<float,2>{0.994777322f, 0.0222463962f},
-std::array<float,2>{0.0632733628f, 0.0932274163f},
-std::array<float,2>{0.642916799f, 0.660194218f},
-std::array<float,2>{0.498901755f, 0.999768853f},
-std::array<float,2>{0.826556027f, 0.381909043f},
-std::array<float,2>{0.290901363f, 0.335440814f},
-std::array<float,2>{0.927803397f, 0.866728127f},
-std::array<float,2>{0.239863321f, 0.519383311f},
-std::array<float,2>{0.615256667f, 0.176486135f},
-std::array<float,2>{0.341689318f, 0.0465332307f},
-std::array<float,2>{0.946123242f, 0.719203055f},
-std::array<float,2>{0.157339916f, 0.886233449f},
-std::array<float,2>{0.535266101f, 0.497162461f},
-std::array<float,2>{0.0092607243f, 0.293384671f},
-std::array<float,2>{0.713576913f, 0.800652087f},
-std::array<float,2>{0.426255703f, 0.622929156f},
-std::array<float,2>{0.797104836f, 0.190525442f},
-std::array<float,2>{0.190210149f, 0.143484101f},
-std::array<float,2>{0.567847431f, 0.531821668f},
-std::array<float,2>{0.270354867f, 0.825854599f},
-std::array<float,2>{0.897724867f, 0.373210937f},
-std::array<float,2>{0.454970449f, 0.409045815f},
-std::array<float,2>{0.874460161f, 0.941564679f},
-std::array<float,2>{0.103206247f, 0.633069634f},
-std::array<float,2>{0.682061911f, 0.107296325f},
-std::array<float,2>{0.257003784f, 0.169402152f},
-std::array<float,2>{0.879547358f, 0.51430887f},
-std::array<float,2>{0.218591228f, 0.85347271f},
-std::array<float,2>{0.591357946f, 0.327865511f},
-std::array<float,2>{0.117168583f, 0.399634868f},
-std::array<float,2>{0.659086287f, 0.975117624f},
-std::array<float,2>{0.438549459f, 0.682052851f},
-std::array<float,2>{0.852782905f, 0.0721736401f},
-std::array<float,2>{0.177448481f, 0.0123711713f},
-std::array<float,2>{0.555585623f, 0.701374948f},
-std::array<float,2>{0.322685927f, 0.927611053f},
-std::array<float,2>{0.957086623f, 0.462780178f},
-std::array<float,2>{0.419584662f, 0.262316793f},
-std::array<float,2>{0.785158575f, 0.755967796f},
-std::array<float,2>{0.019882299f, 0.592427671f},
-std::array<float,2>{0.6912117f, 0.222534686f},
-std::array<float,2>{0.482384324f, 0.124632902f},
-std::array<float,2>{0.839220405f, 0.648145556f},
-std::array<float,2>{0.084737502f, 0.95651114f},
-std::array<float,2>{0.631818235f, 0.43294996f},
-std::array<float,2>{0.222447112f, 0.357339144f},
-std::array<float,2>{0.597493768f, 0.838690639f},
-std::array<float,2>{0.297399104f, 0.550829649f},
-std::array<float,2>{0.91998899f, 0.130948424f},
-std::array<float,2>{0.0418087393f, 0.216055766f},
-std::array<float,2>{0.747112393f, 0.600778699f},
-std::array<float,2>{0.403171718f, 0.785985053f},
-std::array<float,2>{0.76434046f, 0.300346076f},
-std::array<float,2>{0.372475713f, 0.479717702f},
-std::array<float,2>{0.97942555f, 0.893048167f},
-std::array<float,2>{0.127232254f, 0.743287027f},
-std::array<float,2>{0.500526905f, 0.0558177456f},
-std::array<float,2>{0.410715252f, 0.1722195f},
-std::array<float,2>{0.796283603f, 0.520856023f},
-std::array<float,2>{0.0285633504f, 0.859537482f},
-std::array<float,2>{0.700785041f, 0.330031633f},
-std::array<float,2>{0.184893236f, 0.376588255f},
-std::array<float,2>{0.549240708f, 0.995048225f},
-std::array<float,2>{0.314529568f, 0.657764614f},
-std::array<float,2>{0.962786973f, 0.0882555917f},
-std::array<float,2>{0.119609699f, 0.0193976536f},
-std::array<float,2>{0.668539822f, 0.712527573f},
-std::array<float,2>{0.449778914f, 0.91854763f},
-std::array<float,2>{0.849739611f, 0.44435814f},
-std::array<float,2>{0.258409023f, 0.279428691f},
-std::array<float,2>{0.884397566f, 0.771758497f},
-std::array<float,2>{0.20690079f, 0.576589644f},
-std::array<float,2>{0.579944968f, 0.245184615f},
-std::array<float,2>{0.359382927f, 0.103229322f},
-std::array<float,2>{0.972047627f, 0.639187336f},
-std::array<float,2>{0.139154464f, 0.939881623f},
-std::array<float,2>{0.508413613f, 0.41300711f},
-std::array<float,2>{0.0323552936f, 0.369461298f},
-std::array<float,2>{0.73828882f, 0.821137547f},
-std::array<float,2>{0.397577554f, 0.536390126f},
-std::array<float,2>{0.753367722f, 0.146574825f},
-std::array<float,2>{0.232515797f, 0.19475317f},
-std::array<float,2>{0.609347999f, 0.619744003f},
-std::array<float,2>{0.305291653f, 0.804367065f},
-std::array<float,2>{0.910568297f, 0.289286375f},
-std::array<float,2>{0.469076693f, 0.494106054f},
-std::array<float,2>{0.830083787f, 0.889229238f},
-std::array<float,2>{0.0882619843f, 0.726119578f},
-std::array<float,2>{0.632989526f, 0.039721556f},
-std::array<float,2>{0.288650721f, 0.224912852f},
-std::array<float,2>{0.929824352f, 0.589777768f},
-std::array<float,2>{0.245048121f, 0.750446498f},
-std::array<float,2>{0.623182535f, 0.259281069f},
-std::array<float,2>{0.0770218596f, 0.46766001f},
-std::array<float,2>{0.651605725f, 0.925086319f},
-std::array<float,2>{0.490841955f, 0.698446453f},
-std::array<float,2>{0.820251584f, 0.0112070534f},
-std::array<float,2>{0.151873454f, 0.0747844949f},
-std::array<float,2>{0.527305424f, 0.683722973f},
-std::array<float,2>{0.356060326f, 0.969467044f},
-std::array<float,2>{0.988617182f, 0.404468268f},
-std::array<float,2>{0.381137848f, 0.32038188f},
-std::array<float,2>{0.773495853f, 0.857999504f},
-std::array<float,2>{0.0593554303f, 0.50955832f},
-std::array<float,2>{0.732888639f, 0.1656041f},
-std::array<float,2>{0.468313336f, 0.0596222691f},
-std::array<float,2>{0.865574121f, 0.746445239f},
-std::array<float,2>{0.100972265f, 0.896179676f},
-std::array<float,2>{0.676567793f, 0.483323038f},
-std::array<float,2>{0.201793939f, 0.301848441f},
-std::array<float,2>{0.572647214f, 0.78478992f},
-std::array<float,2>{0.279803604f, 0.59643352f},
-std::array<float,2>{0.902155161f, 0.212594986f},
-std::array<float,2>{0.00354573037f, 0.127713859f},
-std::array<float,2>{0.709952652f, 0.54694593f},
-std::array<float,2>{0.434602022f, 0.843512177f},
-std::array<float,2>{0.806909263f, 0.354675084f},
-std::array<float,2>{0.329309285f, 0.43560192f},
-std::array<float,2>{0.940205097f, 0.960808694f},
-std::array<float,2>{0.171667904f, 0.64207989f},
-std::array<float,2>{0.54674232f, 0.118240997f},
-std::array<float,2>{0.495651662f, 0.206797108f},
-std::array<float,2>{0.82395041f, 0.607240856f},
-std::array<float,2>{0.068639949f, 0.789363503f},
-std::array<float,2>{0.646757007f, 0.309237868f},
-std::array<float,2>{0.235602871f, 0.470250219f},
-std::array<float,2>{0.611180604f, 0.905920804f},
-std::array<float,2>{0.296663612f, 0.739433587f},
-std::array<float,2>{0.924456894f, 0.0516401045f},
-std::array<float,2>{0.0489086956f, 0.111757874f},
-std::array<float,2>{0.725189745f, 0.651669502f},
-std::array<float,2>{0.390374571f, 0.967862308f},
-std::array<float,2>{0.767125428f, 0.424212009f},
-std::array<float,2>{0.344662637f, 0.345971227f},
-std::array<float,2>{0.999086857f, 0.834827125f},
-std::array<float,2>{0.140924722f, 0.557945311f},
-std::array<float,2>{0.519269228f, 0.135189742f},
-std::array<float,2>{0.266005665f, 0.00174349255f},
-std::array<float,2>{0.891015351f, 0.694954276f},
-std::array<float,2>{0.192557126f, 0.935988426f},
-std::array<float,2>{0.565989077f, 0.455203116f},
-std::array<float,2>{0.105970547f, 0.25383535f},
-std::array<float,2>{0.687211931f, 0.764320135f},
-std::array<float,2>{0.460108697f, 0.58452177f},
-std::array<float,2>{0.870910704f, 0.232435241f},
-std::array<float,2>{0.160577759f, 0.16315943f},
-std::array<float,2>{0.532251477f, 0.501604438f},
-std::array<float,2>{0.339645565f, 0.851118863f},
-std::array<float,2>{0.952876985f, 0.318616718f},
-std::array<float,2>{0.4229379f, 0.39747718f},
-std::array<float,2>{0.8020643f, 0.979674995f},
-std::array<float,2>{0.0135592101f, 0.678884983f},
-std::array<float,2>{0.71677649f, 0.0696335435f},
-std::array<float,2>{0.326345921f, 0.154909566f},
-std::array<float,2>{0.955604255f, 0.543846726f},
-std::array<float,2>{0.175602287f, 0.813971639f},
-std::array<float,2>{0.561261654f, 0.363274902f},
-std::array<float,2>{0.0168461427f, 0.414890975f},
-std::array<float,2>{0.694955289f, 0.949583888f},
-std::array<float,2>{0.414260775f, 0.629970372f},
-std::array<float,2>{0.78320545f, 0.0985990316f},
-std::array<float,2>{0.214020282f, 0.0357937925f},
-std::array<float,2>{0.586917698f, 0.730844319f},
-std::array<float,2>{0.252959698f, 0.878311932f},
-std::array<float,2>{0.876468122f, 0.49023962f},
-std::array<float,2>{0.441759944f, 0.287694365f},
-std::array<float,2>{0.859284699f, 0.80921483f},
-std::array<float,2>{0.11153768f, 0.611140192f},
-std::array<float,2>{0.661710441f, 0.195860863f},
-std::array<float,2>{0.399372429f, 0.0796935856f},
-std::array<float,2>{0.757878661f, 0.666461706f},
-std::array<float,2>{0.0447138213f, 0.988424122f},
-std::array<float,2>{0.744553447f, 0.388393968f},
-std::array<float,2>{0.130756453f, 0.341917813f},
-std::array<float,2>{0.506793797f, 0.868126452f},
-std::array<float,2>{0.36907053f, 0.524650276f},
-std::array<float,2>{0.980896533f, 0.184474349f},
-std::array<float,2>{0.0798787698f, 0.235427454f},
-std::array<float,2>{0.628282368f, 0.56413573f},
-std::array<float,2>{0.476867765f, 0.77474767f},
-std::array<float,2>{0.842348039f, 0.266013294f},
-std::array<float,2>{0.302543193f, 0.446876168f},
-std::array<float,2>{0.915692508f, 0.91307956f},
-std::array<float,2>{0.225535408f, 0.705260158f},
-std::array<float,2>{0.598872244f, 0.030806968f},
-std::array<float,2>{0.471446574f, 0.147477463f},
-std::array<float,2>{0.829466879f, 0.536078334f},
-std::array<float,2>{0.0868288204f, 0.821971118f},
-std::array<float,2>{0.635134935f, 0.370785475f},
-std::array<float,2>{0.230502158f, 0.413140833f},
-std::array<float,2>{0.60566169f, 0.941224813f},
-std::array<float,2>{0.306918681f, 0.639750004f},
-std::array<float,2>{0.913740933f, 0.102080651f},
-std::array<float,2>{0.0336957537f, 0.0407258198f},
-std::array<float,2>{0.741493583f, 0.724894345f},
-std::array<float,2>{0.394946665f, 0.890600979f},
-std::array<float,2>{0.751184881f, 0.49314028f},
-std::array<float,2>{0.361666143f, 0.290886819f},
-std::array<float,2>{0.969399333f, 0.803287327f},
-std::array<float,2>{0.138306037f, 0.620871305f},
-std::array<float,2>{0.510804534f, 0.194024831f},
-std::array<float,2>{0.260778189f, 0.0895879269f},
-std::array<float,2>{0.885816574f, 0.656392217f},
-std::array<float,2>{0.204354942f, 0.995205224f},
-std::array<float,2>{0.581963539f, 0.375829905f},
-std::array<float,2>{0.11857634f, 0.329044372f},
-std::array<float,2>{0.669950187f, 0.86059624f},
-std::array<float,2>{0.452670395f, 0.520197332f},
-std::array<float,2>{0.848596334f, 0.173309907f},
-std::array<float,2>{0.18695651f, 0.244554117f},
-std::array<float,2>{0.547773778f, 0.57729882f},
-std::array<float,2>{0.313438445f, 0.773342431f},
-std::array<float,2>{0.964027405f, 0.280683041f},
-std::array<float,2>{0.413422763f, 0.443518043f},
-std::array<float,2>{0.794420004f, 0.919447422f},
-std::array<float,2>{0.0293937884f, 0.711033106f},
-std::array<float,2>{0.701998055f, 0.0180549044f},
-std::array<float,2>{0.331419051f, 0.211241677f},
-std::array<float,2>{0.93835175f, 0.596879244f},
-std::array<float,2>{0.169383332f, 0.7837075f},
-std::array<float,2>{0.543042004f, 0.301632881f},
-std::array<float,2>{0.000166104874f, 0.484107852f},
-std::array<float,2>{0.707828104f, 0.894559085f},
-std::array<float,2>{0.437268883f, 0.747850239f},
-std::array<float,2>{0.806538522f, 0.0593596287f},
-std::array<float,2>{0.200769067f, 0.117748588f},
-std::array<float,2>{0.572013199f, 0.641336858f},
-std::array<float,2>{0.278759897f, 0.959408104f},
-std::array<float,2>{0.90019387f, 0.437178433f},
-std::array<float,2>{0.465881705f, 0.353819549f},
-std::array<float,2>{0.864463151f, 0.842612982f},
-std::array<float,2>{0.0979533941f, 0.548787594f},
-std::array<float,2>{0.679234147f, 0.128667206f},
-std::array<float,2>{0.380093753f, 0.01019968f},
-std::array<float,2>{0.776249468f, 0.698017776f},
-std::array<float,2>{0.0611185096f, 0.924663484f},
-std::array<float,2>{0.730834365f, 0.468148082f},
-std::array<float,2>{0.148859531f, 0.258515567f},
-std::array<float,2>{0.525351703f, 0.751094759f},
-std::array<float,2>{0.357551277f, 0.588495672f},
-std::array<float,2>{0.991897881f, 0.226234749f},
-std::array<float,2>{0.0749192834f, 0.164422601f},
-std::array<float,2>{0.649670482f, 0.508755445f},
-std::array<float,2>{0.490186661f, 0.858560145f},
-std::array<float,2>{0.817534626f, 0.321741998f},
-std::array<float,2>{0.287073642f, 0.405704349f},
-std::array<float,2>{0.933312833f, 0.969823182f},
-std::array<float,2>{0.242709577f, 0.684677958f},
-std::array<float,2>{0.621743262f, 0.0754034147f},
-std::array<float,2>{0.424053222f, 0.234306946f},
-std::array<float,2>{0.804017127f, 0.585355639f},
-std::array<float,2>{0.0145599581f, 0.765221059f},
-std::array<float,2>{0.716978908f, 0.25249666f},
-std::array<float,2>{0.162409604f, 0.45663771f},
-std::array<float,2>{0.534893572f, 0.937002122f},
-std::array<float,2>{0.337247819f, 0.694321573f},
-std::array<float,2>{0.950821936f, 0.000120643104f},
-std::array<float,2>{0.108822495f, 0.068555221f},
-std::array<float,2>{0.684795618f, 0.677861989f},
-std::array<float,2>{0.458309382f, 0.978716135f},
-std::array<float,2>{0.86874944f, 0.396493345f},
-std::array<float,2>{0.267605007f, 0.319784254f},
-std::array<float,2>{0.892657459f, 0.850251555f},
-std::array<float,2>{0.194566563f, 0.500035286f},
-std::array<float,2>{0.562910616f, 0.162957504f},
-std::array<float,2>{0.34662208f, 0.0526789501f},
-std::array<float,2>{0.997440755f, 0.738662362f},
-std::array<float,2>{0.143663809f, 0.905246496f},
-std::array<float,2>{0.516492367f, 0.468845367f},
-std::array<float,2>{0.0475155786f, 0.310170472f},
-std::array<float,2>{0.723651469f, 0.790154457f},
-std::array<float,2>{0.386982739f, 0.605560124f},
-std::array<float,2>{0.769292355f, 0.206045926f},
-std::array<float,2>{0.237279743f, 0.136468589f},
-std::array<float,2>{0.612019062f, 0.557243288f},
-std::array<float,2>{0.293429166f, 0.835811377f},
-std::array<float,2>{0.922685683f, 0.346690536f},
-std::array<float,2>{0.492939711f, 0.425147593f},
-std::array<float,2>{0.820650995f, 0.967332184f},
-std::array<float,2>{0.0677889511f, 0.651261866f},
-std::array<float,2>{0.64569509f, 0.113229819f},
-std::array<float,2>{0.303613842f, 0.185322762f},
-std::array<float,2>{0.91642493f, 0.523668647f},
-std::array<float,2>{0.223522708f, 0.869081557f},
-std::array<float,2>{0.600131214f, 0.343234241f},
-std::array<float,2>{0.0819775611f, 0.386924803f},
-std::array<float,2>{0.626269996f, 0.989443779f},
-std::array<float,2>{0.479635566f, 0.667007208f},
-std::array<float,2>{0.840503097f, 0.0787935928f},
-std::array<float,2>{0.131263092f, 0.0300064143f},
-std::array<float,2>{0.505729735f, 0.706741035f},
-std::array<float,2>{0.370845824f, 0.913228571f},
-std::array<float,2>{0.983567297f, 0.445855618f},
-std::array<float,2>{0.400833279f, 0.266662061f},
-std::array<float,2>{0.76047051f, 0.773572028f},
-std::array<float,2>{0.0450914018f, 0.562600553f},
-std::array<float,2>{0.743085563f, 0.235349566f},
-std::array<float,2>{0.443971366f, 0.0986647084f},
-std::array<float,2>{0.857221544f, 0.629684806f},
-std::array<float,2>{0.110664129f, 0.950877428f},
-std::array<float,2>{0.662184834f, 0.415623486f},
-std::array<float,2>{0.211903155f, 0.362014085f},
-std::array<float,2>{0.587982416f, 0.813108981f},
-std::array<float,2>{0.251838833f, 0.544207692f},
-std::array<float,2>{0.878902078f, 0.155634955f},
-std::array<float,2>{0.0190312583f, 0.196613118f},
-std::array<float,2>{0.693031311f, 0.610169172f},
-std::array<float,2>{0.417753696f, 0.809651792f},
-std::array<float,2>{0.782794178f, 0.288139433f},
-std::array<float,2>{0.324535668f, 0.491791368f},
-std::array<float,2>{0.95454371f, 0.877889693f},
-std::array<float,2>{0.171937793f, 0.732282996f},
-std::array<float,2>{0.559175372f, 0.0368516967f},
-std::array<float,2>{0.393980026f, 0.156340212f},
-std::array<float,2>{0.755581856f, 0.50590539f},
-std::array<float,2>{0.0376373082f, 0.846056521f},
-std::array<float,2>{0.738087714f, 0.315483153f},
-std::array<float,2>{0.134377018f, 0.393876433f},
-std::array<float,2>{0.515585363f, 0.984357357f},
-std::array<float,2>{0.364962161f, 0.675179362f},
-std::array<float,2>{0.975467384f, 0.062838003f},
-std::array<float,2>{0.0910534561f, 0.00475366414f},
-std::array<float,2>{0.640511274f, 0.690887392f},
-std::array<float,2>{0.474518389f, 0.933439791f},
-std::array<float,2>{0.833874226f, 0.458512038f},
-std::array<float,2>{0.310450971f, 0.257451177f},
-std::array<float,2>{0.910118103f, 0.759413719f},
-std::array<float,2>{0.226880059f, 0.579196513f},
-std::array<float,2>{0.602550328f, 0.229304492f},
-std::array<float,2>{0.317160398f, 0.115712263f},
-std::array<float,2>{0.967364013f, 0.656151354f},
-std::array<float,2>{0.182418928f, 0.962769389f},
-std::array<float,2>{0.552782893f, 0.42666176f},
-std::array<float,2>{0.0258541312f, 0.351257056f},
-std::array<float,2>{0.698354542f, 0.831035078f},
-std::array<float,2>{0.407811254f, 0.560069501f},
-std::array<float,2>{0.792639434f, 0.138699308f},
-std::array<float,2>{0.209231913f, 0.207685322f},
-std::array<float,2>{0.584010839f, 0.603445172f},
-std::array<float,2>{0.265086442f, 0.795141876f},
-std::array<float,2>{0.886770248f, 0.3079696f},
-std::array<float,2>{0.445407867f, 0.473788738f},
-std::array<float,2>{0.846206963f, 0.901158869f},
-std::array<float,2>{0.122933708f, 0.735929906f},
-std::array<float,2>{0.666668653f, 0.0473455191f},
-std::array<float,2>{0.274872631f, 0.239309147f},
-std::array<float,2>{0.904841721f, 0.569476604f},
-std::array<float,2>{0.197283804f, 0.780317605f},
-std::array<float,2>{0.57634747f, 0.270950228f},
-std::array<float,2>{0.0941657722f, 0.452650428f},
-std::array<float,2>{0.673976541f, 0.906410754f},
-std::array<float,2>{0.462574154f, 0.708727479f},
-std::array<float,2>{0.860359609f, 0.0262158364f},
-std::array<float,2>{0.167835027f, 0.085220255f},
-std::array<float,2>{0.541903853f, 0.668322444f},
-std::array<float,2>{0.332783639f, 0.986584902f},
-std::array<float,2>{0.942446232f, 0.384579271f},
-std::array<float,2>{0.432349473f, 0.339737594f},
-std::array<float,2>{0.80962497f, 0.874182403f},
-std::array<float,2>{0.00431820797f, 0.528537691f},
-std::array<float,2>{0.705097675f, 0.182895437f},
-std::array<float,2>{0.487561226f, 0.0332518667f},
-std::array<float,2>{0.813687921f, 0.72715193f},
-std::array<float,2>{0.0705205128f, 0.880187809f},
-std::array<float,2>{0.655895948f, 0.488024831f},
-std::array<float,2>{0.247785747f, 0.281854272f},
-std::array<float,2>{0.618671298f, 0.807031691f},
-std::array<float,2>{0.284685582f, 0.614042342f},
-std::array<float,2>{0.936955273f, 0.2001241f},
-std::array<float,2>{0.0566862188f, 0.152134776f},
-std::array<float,2>{0.729659081f, 0.540142536f},
-std::array<float,2>{0.375644326f, 0.819344103f},
-std::array<float,2>{0.777789652f, 0.36462298f},
-std::array<float,2>{0.353267729f, 0.418484539f},
-std::array<float,2>{0.985678732f, 0.948536694f},
-std::array<float,2>{0.15475902f, 0.628563464f},
-std::array<float,2>{0.531183541f, 0.0939276591f},
-std::array<float,2>{0.456109822f, 0.18999061f},
-std::array<float,2>{0.871362448f, 0.621595442f},
-std::array<float,2>{0.104126222f, 0.799336374f},
-std::array<float,2>{0.680742085f, 0.294530064f},
-std::array<float,2>{0.189149573f, 0.496911407f},
-std::array<float,2>{0.568913758f, 0.885283768f},
-std::array<float,2>{0.27308926f, 0.72018826f},
-std::array<float,2>{0.895927787f, 0.0454501398f},
-std::array<float,2>{0.0109261638f, 0.106416166f},
-std::array<float,2>{0.712551296f, 0.633878946f},
-std::array<float,2>{0.428039849f, 0.943040431f},
-std::array<float,2>{0.800635934f, 0.409800768f},
-std::array<float,2>{0.341930836f, 0.374133468f},
-std::array<float,2>{0.948103786f, 0.824934959f},
-std::array<float,2>{0.158416316f, 0.532429814f},
-std::array<float,2>{0.538744688f, 0.1441129f},
-std::array<float,2>{0.291196793f, 0.0230857488f},
-std::array<float,2>{0.925937474f, 0.717274904f},
-std::array<float,2>{0.241045848f, 0.916719675f},
-std::array<float,2>{0.615201771f, 0.437800914f},
-std::array<float,2>{0.0657897815f, 0.276620686f},
-std::array<float,2>{0.641716897f, 0.76640594f},
-std::array<float,2>{0.49654901f, 0.572351396f},
-std::array<float,2>{0.824548423f, 0.248332456f},
-std::array<float,2>{0.146465257f, 0.177219078f},
-std::array<float,2>{0.520964086f, 0.517917335f},
-std::array<float,2>{0.349430889f, 0.86609304f},
-std::array<float,2>{0.993267655f, 0.334629238f},
-std::array<float,2>{0.383607537f, 0.381728858f},
-std::array<float,2>{0.770688355f, 0.998736441f},
-std::array<float,2>{0.0513379015f, 0.661412716f},
-std::array<float,2>{0.720894814f, 0.0925666317f},
-std::array<float,2>{0.374742478f, 0.132075116f},
-std::array<float,2>{0.97769165f, 0.552111864f},
-std::array<float,2>{0.125233069f, 0.839118659f},
-std::array<float,2>{0.502535284f, 0.356342435f},
-std::array<float,2>{0.0410041474f, 0.431660652f},
-std::array<float,2>{0.748537302f, 0.955408752f},
-std::array<float,2>{0.40543291f, 0.647114217f},
-std::array<float,2>{0.761748195f, 0.12358059f},
-std::array<float,2>{0.220680684f, 0.0555368699f},
-std::array<float,2>{0.594400823f, 0.742594182f},
-std::array<float,2>{0.300740778f, 0.893972695f},
-std::array<float,2>{0.918009043f, 0.479028523f},
-std::array<float,2>{0.483631074f, 0.298952103f},
-std::array<float,2>{0.836637855f, 0.786558092f},
-std::array<float,2>{0.0825379863f, 0.600039363f},
-std::array<float,2>{0.630818129f, 0.215518162f},
-std::array<float,2>{0.42179656f, 0.0708485693f},
-std::array<float,2>{0.787580311f, 0.683485389f},
-std::array<float,2>{0.023050515f, 0.97651577f},
-std::array<float,2>{0.689358175f, 0.398471355f},
-std::array<float,2>{0.178510547f, 0.326438844f},
-std::array<float,2>{0.556903839f, 0.851740122f},
-std::array<float,2>{0.320510924f, 0.514810443f},
-std::array<float,2>{0.959021807f, 0.16817674f},
-std::array<float,2>{0.114885673f, 0.22122252f},
-std::array<float,2>{0.658098221f, 0.593712628f},
-std::array<float,2>{0.439941883f, 0.757156909f},
-std::array<float,2>{0.855147183f, 0.263223827f},
-std::array<float,2>{0.25505051f, 0.461832702f},
-std::array<float,2>{0.882487714f, 0.926213145f},
-std::array<float,2>{0.215995118f, 0.702824116f},
-std::array<float,2>{0.593089044f, 0.0136199351f},
-std::array<float,2>{0.450062871f, 0.175353453f},
-std::array<float,2>{0.849889338f, 0.522503018f},
-std::array<float,2>{0.119359054f, 0.862665296f},
-std::array<float,2>{0.668792069f, 0.331652969f},
-std::array<float,2>{0.206610188f, 0.37769857f},
-std::array<float,2>{0.579736471f, 0.993898153f},
-std::array<float,2>{0.258787125f, 0.659300983f},
-std::array<float,2>{0.884747028f, 0.0863229558f},
-std::array<float,2>{0.028625926f, 0.0173084307f},
-std::array<float,2>{0.701051891f, 0.714568377f},
-std::array<float,2>{0.410989851f, 0.920414746f},
-std::array<float,2>{0.796069562f, 0.441631705f},
-std::array<float,2>{0.314908087f, 0.278511167f},
-std::array<float,2>{0.962622643f, 0.771102488f},
-std::array<float,2>{0.18463695f, 0.575345755f},
-std::array<float,2>{0.549057066f, 0.242488056f},
-std::array<float,2>{0.305614978f, 0.104480296f},
-std::array<float,2>{0.910160303f, 0.638127267f},
-std::array<float,2>{0.232745573f, 0.939144492f},
-std::array<float,2>{0.608914018f, 0.410457551f},
-std::array<float,2>{0.0879060328f, 0.368495077f},
-std::array<float,2>{0.633146942f, 0.823907971f},
-std::array<float,2>{0.468961716f, 0.538885951f},
-std::array<float,2>{0.830503583f, 0.144846648f},
-std::array<float,2>{0.138774469f, 0.192952067f},
-std::array<float,2>{0.508580327f, 0.617342591f},
-std::array<float,2>{0.359784305f, 0.801921844f},
-std::array<float,2>{0.971829414f, 0.291452825f},
-std::array<float,2>{0.397735655f, 0.494948953f},
-std::array<float,2>{0.753017128f, 0.887588143f},
-std::array<float,2>{0.0325966179f, 0.723261714f},
-std::array<float,2>{0.738602042f, 0.04175134f},
-std::array<float,2>{0.356228799f, 0.223501846f},
-std::array<float,2>{0.988427401f, 0.587520242f},
-std::array<float,2>{0.152124137f, 0.752272427f},
-std::array<float,2>{0.52691716f, 0.261482656f},
-std::array<float,2>{0.0593257956f, 0.464874148f},
-std::array<float,2>{0.732581794f, 0.922345817f},
-std::array<float,2>{0.380950689f, 0.696155488f},
-std::array<float,2>{0.77382344f, 0.00814143382f},
-std::array<float,2>{0.244670466f, 0.076579161f},
-std::array<float,2>{0.62352407f, 0.686311007f},
-std::array<float,2>{0.288869709f, 0.971657336f},
-std::array<float,2>{0.93015331f, 0.403255373f},
-std::array<float,2>{0.49119392f, 0.323845267f},
-std::array<float,2>{0.819945455f, 0.856230199f},
-std::array<float,2>{0.0769002587f, 0.510970175f},
-std::array<float,2>{0.651757717f, 0.166072533f},
-std::array<float,2>{0.434888661f, 0.0620233491f},
-std::array<float,2>{0.806656659f, 0.749070823f},
-std::array<float,2>{0.00368759362f, 0.896822989f},
-std::array<float,2>{0.709690511f, 0.481267959f},
-std::array<float,2>{0.17141965f, 0.303590894f},
-std::array<float,2>{0.546564281f, 0.782205343f},
-std::array<float,2>{0.329403371f, 0.594926834f},
-std::array<float,2>{0.939961433f, 0.213887408f},
-std::array<float,2>{0.10074959f, 0.126287848f},
-std::array<float,2>{0.676431239f, 0.55064702f},
-std::array<float,2>{0.468695074f, 0.840692639f},
-std::array<float,2>{0.865246773f, 0.351806462f},
-std::array<float,2>{0.280196548f, 0.435019851f},
-std::array<float,2>{0.90194881f, 0.957148254f},
-std::array<float,2>{0.201999649f, 0.644495249f},
-std::array<float,2>{0.572482586f, 0.120543666f},
-std::array<float,2>{0.390493631f, 0.203273669f},
-std::array<float,2>{0.767440736f, 0.607932627f},
-std::array<float,2>{0.0491353609f, 0.792249024f},
-std::array<float,2>{0.725349188f, 0.311322391f},
-std::array<float,2>{0.140669763f, 0.472380489f},
-std::array<float,2>{0.519530356f, 0.903786957f},
-std::array<float,2>{0.344281733f, 0.740765393f},
-std::array<float,2>{0.99948436f, 0.0531022958f},
-std::array<float,2>{0.0685161352f, 0.110233948f},
-std::array<float,2>{0.64669317f, 0.648585021f},
-std::array<float,2>{0.495965958f, 0.966330647f},
-std::array<float,2>{0.823990405f, 0.423153728f},
-std::array<float,2>{0.296510726f, 0.343843877f},
-std::array<float,2>{0.92478776f, 0.833826661f},
-std::array<float,2>{0.235421196f, 0.55609715f},
-std::array<float,2>{0.61087054f, 0.134393632f},
-std::array<float,2>{0.339484423f, 0.00232151197f},
-std::array<float,2>{0.953039825f, 0.691947401f},
-std::array<float,2>{0.160189927f, 0.93436861f},
-std::array<float,2>{0.532626212f, 0.453703225f},
-std::array<float,2>{0.013229426f, 0.251729488f},
-std::array<float,2>{0.716393352f, 0.762460113f},
-std::array<float,2>{0.42323181f, 0.58350867f},
-std::array<float,2>{0.801810741f, 0.231588587f},
-std::array<float,2>{0.192769557f, 0.161080092f},
-std::array<float,2>{0.566399276f, 0.502839446f},
-std::array<float,2>{0.265839577f, 0.848827004f},
-std::array<float,2>{0.890741706f, 0.317239672f},
-std::array<float,2>{0.460380167f, 0.396232843f},
-std::array<float,2>{0.870768309f, 0.97760576f},
-std::array<float,2>{0.106431656f, 0.677719712f},
-std::array<float,2>{0.687410414f, 0.0677036345f},
-std::array<float,2>{0.253250837f, 0.153037727f},
-std::array<float,2>{0.876784563f, 0.54555124f},
-std::array<float,2>{0.214233369f, 0.814463437f},
-std::array<float,2>{0.58726728f, 0.360919803f},
-std::array<float,2>{0.111618072f, 0.417349041f},
-std::array<float,2>{0.662053525f, 0.952564716f},
-std::array<float,2>{0.441607475f, 0.632092357f},
-std::array<float,2>{0.858970463f, 0.0999851674f},
-std::array<float,2>{0.175386772f, 0.0377499647f},
-std::array<float,2>{0.561436892f, 0.733736455f},
-std::array<float,2>{0.326477349f, 0.876436472f},
-std::array<float,2>{0.955901146f, 0.490094215f},
-std::array<float,2>{0.414481729f, 0.285187542f},
-std::array<float,2>{0.783502698f, 0.812225223f},
-std::array<float,2>{0.0166667625f, 0.611585319f},
-std::array<float,2>{0.695149899f, 0.197449461f},
-std::array<float,2>{0.47678262f, 0.0814812481f},
-std::array<float,2>{0.84257108f, 0.664554f},
-std::array<float,2>{0.0798147172f, 0.9918437f},
-std::array<float,2>{0.628016591f, 0.388726026f},
-std::array<float,2>{0.225138366f, 0.340076268f},
-std::array<float,2>{0.598993838f, 0.870256245f},
-std::array<float,2>{0.302425653f, 0.526076972f},
-std::array<float,2>{0.91590184f, 0.186809227f},
-std::array<float,2>{0.044554159f, 0.237060159f},
-std::array<float,2>{0.74432981f, 0.565625906f},
-std::array<float,2>{0.399056315f, 0.776509345f},
-std::array<float,2>{0.758100092f, 0.268834174f},
-std::array<float,2>{0.368700266f, 0.44788155f},
-std::array<float,2>{0.980691254f, 0.911576629f},
-std::array<float,2>{0.130488157f, 0.704406679f},
-std::array<float,2>{0.506511748f, 0.0281542428f},
-std::array<float,2>{0.408466339f, 0.138387486f},
-std::array<float,2>{0.789601564f, 0.562430978f},
-std::array<float,2>{0.0236250293f, 0.829956412f},
-std::array<float,2>{0.69717294f, 0.349525988f},
-std::array<float,2>{0.18038924f, 0.429033756f},
-std::array<float,2>{0.552483737f, 0.964486182f},
-std::array<float,2>{0.3185969f, 0.653109014f},
-std::array<float,2>{0.965507865f, 0.114822194f},
-std::array<float,2>{0.124572471f, 0.049433548f},
-std::array<float,2>{0.664594114f, 0.737151563f},
-std::array<float,2>{0.449129373f, 0.900143206f},
-std::array<float,2>{0.843760729f, 0.475730032f},
-std::array<float,2>{0.262772977f, 0.305777848f},
-std::array<float,2>{0.889226437f, 0.794047892f},
-std::array<float,2>{0.208653912f, 0.604853213f},
-std::array<float,2>{0.583630502f, 0.210435078f},
-std::array<float,2>{0.366882533f, 0.0663797781f},
-std::array<float,2>{0.974185467f, 0.672013938f},
-std::array<float,2>{0.136407942f, 0.981875896f},
-std::array<float,2>{0.51247561f, 0.3908512f},
-std::array<float,2>{0.0359868258f, 0.312957168f},
-std::array<float,2>{0.734945297f, 0.845099807f},
-std::array<float,2>{0.392275602f, 0.505386174f},
-std::array<float,2>{0.757759094f, 0.159243256f},
-std::array<float,2>{0.228791192f, 0.227627173f},
-std::array<float,2>{0.604231298f, 0.581510305f},
-std::array<float,2>{0.310691714f, 0.7604509f},
-std::array<float,2>{0.907073021f, 0.255776584f},
-std::array<float,2>{0.474860609f, 0.45922032f},
-std::array<float,2>{0.835531235f, 0.929860771f},
-std::array<float,2>{0.0935344025f, 0.68821758f},
-std::array<float,2>{0.637596846f, 0.00588295935f},
-std::array<float,2>{0.282755703f, 0.20166029f},
-std::array<float,2>{0.933675408f, 0.615999937f},
-std::array<float,2>{0.248549223f, 0.805933118f},
-std::array<float,2>{0.619722605f, 0.28490141f},
-std::array<float,2>{0.0736317411f, 0.48558116f},
-std::array<float,2>{0.653072476f, 0.88233006f},
-std::array<float,2>{0.484455407f, 0.729808688f},
-std::array<float,2>{0.816191971f, 0.0326101519f},
-std::array<float,2>{0.153704941f, 0.0960136726f},
-std::array<float,2>{0.527971148f, 0.625689268f},
-std::array<float,2>{0.354071915f, 0.946424365f},
-std::array<float,2>{0.987144113f, 0.420849741f},
-std::array<float,2>{0.377076775f, 0.365705073f},
-std::array<float,2>{0.779596031f, 0.818256438f},
-std::array<float,2>{0.0550346151f, 0.542403996f},
-std::array<float,2>{0.728469729f, 0.149192482f},
-std::array<float,2>{0.463755578f, 0.0248283576f},
-std::array<float,2>{0.862008691f, 0.708998322f},
-std::array<float,2>{0.0958236605f, 0.909305632f},
-std::array<float,2>{0.673330367f, 0.449947208f},
-std::array<float,2>{0.196034476f, 0.271917284f},
-std::array<float,2>{0.574878395f, 0.779003322f},
-std::array<float,2>{0.275651723f, 0.567378104f},
-std::array<float,2>{0.903026164f, 0.241740108f},
-std::array<float,2>{0.00609755656f, 0.181473255f},
-std::array<float,2>{0.704822838f, 0.529381692f},
-std::array<float,2>{0.430745274f, 0.871592939f},
-std::array<float,2>{0.811960101f, 0.336490691f},
-std::array<float,2>{0.33498463f, 0.384872645f},
-std::array<float,2>{0.944996297f, 0.985876143f},
-std::array<float,2>{0.16425316f, 0.670937538f},
-std::array<float,2>{0.54032892f, 0.0832325742f},
-std::array<float,2>{0.498772353f, 0.246247798f},
-std::array<float,2>{0.826245725f, 0.571889043f},
-std::array<float,2>{0.0632181764f, 0.768756032f},
-std::array<float,2>{0.642756045f, 0.274035752f},
-std::array<float,2>{0.240190282f, 0.440040022f},
-std::array<float,2>{0.615542591f, 0.915348351f},
-std::array<float,2>{0.290710747f, 0.715432167f},
-std::array<float,2>{0.928123295f, 0.0208377037f},
-std::array<float,2>{0.0533043407f, 0.0902377889f},
-std::array<float,2>{0.719989002f, 0.663129628f},
-std::array<float,2>{0.386661917f, 0.996618748f},
-std::array<float,2>{0.771688104f, 0.379814297f},
-std::array<float,2>{0.350163072f, 0.33389619f},
-std::array<float,2>{0.995081544f, 0.864186108f},
-std::array<float,2>{0.148249626f, 0.51620537f},
-std::array<float,2>{0.523326039f, 0.178949296f},
-std::array<float,2>{0.270192921f, 0.0446274281f},
-std::array<float,2>{0.897671342f, 0.722531557f},
-std::array<float,2>{0.190122843f, 0.88429898f},
-std::array<float,2>{0.567498088f, 0.498784602f},
-std::array<float,2>{0.103509076f, 0.296656042f},
-std::array<float,2>{0.681809962f, 0.797920883f},
-std::array<float,2>{0.45480442f, 0.623260617f},
-std::array<float,2>{0.874042511f, 0.188087061f},
-std::array<float,2>{0.157557979f, 0.141078874f},
-std::array<float,2>{0.535644412f, 0.534315526f},
-std::array<float,2>{0.34144032f, 0.827952564f},
-std::array<float,2>{0.945916295f, 0.372368604f},
-std::array<float,2>{0.425863594f, 0.408185869f},
-std::array<float,2>{0.797354162f, 0.943802774f},
-std::array<float,2>{0.00883998536f, 0.636366546f},
-std::array<float,2>{0.713858843f, 0.108692557f},
-std::array<float,2>{0.322493821f, 0.170896426f},
-std::array<float,2>{0.957390606f, 0.513374388f},
-std::array<float,2>{0.1775572f, 0.854407251f},
-std::array<float,2>{0.555277467f, 0.32442078f},
-std::array<float,2>{0.0196417496f, 0.400577605f},
-std::array<float,2>{0.691117108f, 0.973451555f},
-std::array<float,2>{0.41975233f, 0.679990709f},
-std::array<float,2>{0.78541851f, 0.0736815631f},
-std::array<float,2>{0.21827811f, 0.0144307977f},
-std::array<float,2>{0.59171015f, 0.699573457f},
-std::array<float,2>{0.257221878f, 0.929603815f},
-std::array<float,2>{0.879779398f, 0.464066446f},
-std::array<float,2>{0.43883431f, 0.263899595f},
-std::array<float,2>{0.852841914f, 0.755681157f},
-std::array<float,2>{0.116714478f, 0.590680897f},
-std::array<float,2>{0.658707261f, 0.219693705f},
-std::array<float,2>{0.403033197f, 0.121541291f},
-std::array<float,2>{0.764417052f, 0.645632327f},
-std::array<float,2>{0.0416142307f, 0.953571558f},
-std::array<float,2>{0.747469544f, 0.430327207f},
-std::array<float,2>{0.127153412f, 0.358121872f},
-std::array<float,2>{0.500961006f, 0.836706996f},
-std::array<float,2>{0.372240782f, 0.552953303f},
-std::array<float,2>{0.979093313f, 0.12988241f},
-std::array<float,2>{0.084585093f, 0.21810475f},
-std::array<float,2>{0.631422937f, 0.599090636f},
-std::array<float,2>{0.481955975f, 0.788961112f},
-std::array<float,2>{0.839089036f, 0.298029751f},
-std::array<float,2>{0.29766959f, 0.476889282f},
-std::array<float,2>{0.9202016f, 0.89234817f},
-std::array<float,2>{0.222260222f, 0.745248735f},
-std::array<float,2>{0.597310007f, 0.0573510267f},
-std::array<float,2>{0.488429725f, 0.167009205f},
-std::array<float,2>{0.817190051f, 0.509800196f},
-std::array<float,2>{0.0755229443f, 0.856912196f},
-std::array<float,2>{0.648967922f, 0.322906911f},
-std::array<float,2>{0.243840769f, 0.403486222f},
-std::array<float,2>{0.62210387f, 0.97198236f},
-std::array<float,2>{0.286041558f, 0.687478244f},
-std::array<float,2>{0.932107747f, 0.0773691237f},
-std::array<float,2>{0.0621956624f, 0.00928435847f},
-std::array<float,2>{0.731672108f, 0.697178721f},
-std::array<float,2>{0.379473746f, 0.92363888f},
-std::array<float,2>{0.776904106f, 0.466413409f},
-std::array<float,2>{0.359249234f, 0.260373145f},
-std::array<float,2>{0.990255713f, 0.753022194f},
-std::array<float,2>{0.150120646f, 0.586099684f},
-std::array<float,2>{0.524114132f, 0.224207312f},
-std::array<float,2>{0.277424634f, 0.119259708f},
-std::array<float,2>{0.898889661f, 0.6435377f},
-std::array<float,2>{0.199446872f, 0.95835948f},
-std::array<float,2>{0.570734143f, 0.433998913f},
-std::array<float,2>{0.0995508954f, 0.353104025f},
-std::array<float,2>{0.678109467f, 0.841601074f},
-std::array<float,2>{0.464925408f, 0.549385786f},
-std::array<float,2>{0.863955081f, 0.125848219f},
-std::array<float,2>{0.168381631f, 0.213678554f},
-std::array<float,2>{0.544642031f, 0.594325483f},
-std::array<float,2>{0.330896109f, 0.783082008f},
-std::array<float,2>{0.938754559f, 0.303854585f},
-std::array<float,2>{0.436092526f, 0.481685221f},
-std::array<float,2>{0.805124938f, 0.898152351f},
-std::array<float,2>{0.00131548755f, 0.748589516f},
-std::array<float,2>{0.708040714f, 0.0613013543f},
-std::array<float,2>{0.314273536f, 0.243596077f},
-std::array<float,2>{0.963559091f, 0.574937284f},
-std::array<float,2>{0.185883939f, 0.769900322f},
-std::array<float,2>{0.548719585f, 0.278012544f},
-std::array<float,2>{0.0304730572f, 0.442703098f},
-std::array<float,2>{0.702418864f, 0.92140013f},
-std::array<float,2>{0.412748814f, 0.713177681f},
-std::array<float,2>{0.793814301f, 0.0162500888f},
-std::array<float,2>{0.203210086f, 0.0874066725f},
-std::array<float,2>{0.58083868f, 0.658672631f},
-std::array<float,2>{0.259813935f, 0.992918372f},
-std::array<float,2>{0.88550812f, 0.378111631f},
-std::array<float,2>{0.451549798f, 0.330680698f},
-std::array<float,2>{0.849492967f, 0.86142236f},
-std::array<float,2>{0.117915437f, 0.521722078f},
-std::array<float,2>{0.671020687f, 0.173875421f},
-std::array<float,2>{0.396282047f, 0.0428757742f},
-std::array<float,2>{0.750641227f, 0.72394079f},
-std::array<float,2>{0.0348747298f, 0.887936771f},
-std::array<float,2>{0.740754962f, 0.495225072f},
-std::array<float,2>{0.137460649f, 0.292210251f},
-std::array<float,2>{0.510411382f, 0.801324666f},
-std::array<float,2>{0.362928033f, 0.618654847f},
-std::array<float,2>{0.970085859f, 0.191829368f},
-std::array<float,2>{0.0870712176f, 0.145830005f},
-std::array<float,2>{0.636331856f, 0.537459135f},
-std::array<float,2>{0.472282976f, 0.823065042f},
-std::array<float,2>{0.82819283f, 0.367327392f},
-std::array<float,2>{0.308412462f, 0.4117226f},
-std::array<float,2>{0.912346363f, 0.93771863f},
-std::array<float,2>{0.231456995f, 0.637526929f},
-std::array<float,2>{0.607303798f, 0.104923725f},
-std::array<float,2>{0.416244715f, 0.198846206f},
-std::array<float,2>{0.781370223f, 0.613260686f},
-std::array<float,2>{0.018332528f, 0.810580432f},
-std::array<float,2>{0.692016661f, 0.286870152f},
-std::array<float,2>{0.173767909f, 0.488337517f},
-std::array<float,2>{0.560405016f, 0.875766814f},
-std::array<float,2>{0.325633883f, 0.732467294f},
-std::array<float,2>{0.953826368f, 0.038733799f},
-std::array<float,2>{0.109678097f, 0.101179428f},
-std::array<float,2>{0.663212001f, 0.63105315f},
-std::array<float,2>{0.444806337f, 0.95185703f},
-std::array<float,2>{0.856013298f, 0.416016132f},
-std::array<float,2>{0.250257581f, 0.360120118f},
-std::array<float,2>{0.877076209f, 0.816102684f},
-std::array<float,2>{0.212680444f, 0.546136796f},
-std::array<float,2>{0.589618564f, 0.154070184f},
-std::array<float,2>{0.369186789f, 0.0290560704f},
-std::array<float,2>{0.983285427f, 0.703474402f},
-std::array<float,2>{0.132043228f, 0.910524428f},
-std::array<float,2>{0.504544973f, 0.449100018f},
-std::array<float,2>{0.046643097f, 0.268313497f},
-std::array<float,2>{0.743435323f, 0.776264369f},
-std::array<float,2>{0.40139389f, 0.565420926f},
-std::array<float,2>{0.761538506f, 0.237794235f},
-std::array<float,2>{0.224554554f, 0.186180428f},
-std::array<float,2>{0.600758314f, 0.527269721f},
-std::array<float,2>{0.304531872f, 0.869699419f},
-std::array<float,2>{0.917692959f, 0.341235965f},
-std::array<float,2>{0.478536576f, 0.389692843f},
-std::array<float,2>{0.841342568f, 0.990889609f},
-std::array<float,2>{0.080524914f, 0.665102959f},
-std::array<float,2>{0.62512356f, 0.0801221728f},
-std::array<float,2>{0.294900984f, 0.13304311f},
-std::array<float,2>{0.923112273f, 0.555459619f},
-std::array<float,2>{0.238188386f, 0.832914412f},
-std::array<float,2>{0.613129973f, 0.34568733f},
-std::array<float,2>{0.0669395775f, 0.422570437f},
-std::array<float,2>{0.645470381f, 0.965660393f},
-std::array<float,2>{0.493601412f, 0.65018791f},
-std::array<float,2>{0.822205126f, 0.110601969f},
-std::array<float,2>{0.14306277f, 0.0537943169f},
-std::array<float,2>{0.516684651f, 0.741518974f},
-std::array<float,2>{0.347203463f, 0.902477801f},
-std::array<float,2>{0.996519148f, 0.471127033f},
-std::array<float,2>{0.388316602f, 0.31152916f},
-std::array<float,2>{0.768543661f, 0.791751564f},
-std::array<float,2>{0.0483837351f, 0.608751297f},
-std::array<float,2>{0.72357589f, 0.204517365f},
-std::array<float,2>{0.458007187f, 0.0671603233f},
-std::array<float,2>{0.867493212f, 0.676727653f},
-std::array<float,2>{0.108031161f, 0.976696908f},
-std::array<float,2>{0.683985174f, 0.39529863f},
-std::array<float,2>{0.193860814f, 0.317815125f},
-std::array<float,2>{0.563541591f, 0.848108411f},
-std::array<float,2>{0.26904422f, 0.50370872f},
-std::array<float,2>{0.89372921f, 0.161690265f},
-std::array<float,2>{0.0153893828f, 0.230646759f},
-std::array<float,2>{0.718351245f, 0.582125247f},
-std::array<float,2>{0.425534636f, 0.763593376f},
-std::array<float,2>{0.803697467f, 0.250020862f},
-std::array<float,2>{0.336244106f, 0.454753011f},
-std::array<float,2>{0.949953556f, 0.934980452f},
-std::array<float,2>{0.163419873f, 0.69331336f},
-std::array<float,2>{0.533673823f, 0.00363694644f},
-std::array<float,2>{0.376670092f, 0.149434313f},
-std::array<float,2>{0.779210985f, 0.541439176f},
-std::array<float,2>{0.0579712875f, 0.816632092f},
-std::array<float,2>{0.728819132f, 0.367108017f},
-std::array<float,2>{0.155486658f, 0.420929849f},
-std::array<float,2>{0.529990017f, 0.945536375f},
-std::array<float,2>{0.352135658f, 0.626025915f},
-std::array<float,2>{0.984437466f, 0.0967211574f},
-std::array<float,2>{0.07177414f, 0.0312841088f},
-std::array<float,2>{0.655009866f, 0.729051113f},
-std::array<float,2>{0.486612797f, 0.881755471f},
-std::array<float,2>{0.813410699f, 0.484636128f},
-std::array<float,2>{0.284144193f, 0.283392459f},
-std::array<float,2>{0.936129808f, 0.80558008f},
-std::array<float,2>{0.24651511f, 0.616467535f},
-std::array<float,2>{0.617867827f, 0.20238933f},
-std::array<float,2>{0.333276689f, 0.0825685412f},
-std::array<float,2>{0.941765606f, 0.670029163f},
-std::array<float,2>{0.166112214f, 0.984813273f},
-std::array<float,2>{0.542301953f, 0.385846347f},
-std::array<float,2>{0.00531453732f, 0.337121636f},
-std::array<float,2>{0.706955433f, 0.872290194f},
-std::array<float,2>{0.433193654f, 0.53083539f},
-std::array<float,2>{0.80951643f, 0.180092305f},
-std::array<float,2>{0.199142098f, 0.240424231f},
-std::array<float,2>{0.577990413f, 0.567516863f},
-std::array<float,2>{0.274083018f, 0.778295457f},
-std::array<float,2>{0.905447602f, 0.273376763f},
-std::array<float,2>{0.461515367f, 0.450422049f},
-std::array<float,2>{0.86034888f, 0.90835911f},
-std::array<float,2>{0.0949701592f, 0.710209012f},
-std::array<float,2>{0.674971879f, 0.0239557866f},
-std::array<float,2>{0.264097869f, 0.209611386f},
-std::array<float,2>{0.888153672f, 0.604191244f},
-std::array<float,2>{0.21044609f, 0.793175101f},
-std::array<float,2>{0.585233569f, 0.304689109f},
-std::array<float,2>{0.121876128f, 0.475530237f},
-std::array<float,2>{0.667342246f, 0.898933113f},
-std::array<float,2>{0.446457416f, 0.737657428f},
-std::array<float,2>{0.847424805f, 0.0504873283f},
-std::array<float,2>{0.183158845f, 0.113579124f},
-std::array<float,2>{0.554561734f, 0.653969407f},
-std::array<float,2>{0.3183496f, 0.963638783f},
-std::array<float,2>{0.968229353f, 0.428338408f},
-std::array<float,2>{0.406498641f, 0.348053575f},
-std::array<float,2>{0.791991711f, 0.829074144f},
-std::array<float,2>{0.0272549205f, 0.561124742f},
-std::array<float,2>{0.69735378f, 0.137543529f},
-std::array<float,2>{0.473441929f, 0.00780186756f},
-std::array<float,2>{0.832637012f, 0.689364493f},
-std::array<float,2>{0.0899485126f, 0.930947542f},
-std::array<float,2>{0.639583468f, 0.460899681f},
-std::array<float,2>{0.22805199f, 0.253979743f},
-std::array<float,2>{0.602109373f, 0.761383891f},
-std::array<float,2>{0.309383154f, 0.580617726f},
-std::array<float,2>{0.908426166f, 0.227312267f},
-std::array<float,2>{0.0390214399f, 0.158747271f},
-std::array<float,2>{0.737291157f, 0.50421524f},
-std::array<float,2>{0.392692983f, 0.8443501f},
-std::array<float,2>{0.754871011f, 0.314119577f},
-std::array<float,2>{0.363595665f, 0.392520219f},
-std::array<float,2>{0.975606501f, 0.980606377f},
-std::array<float,2>{0.133465126f, 0.673533082f},
-std::array<float,2>{0.514036596f, 0.065187946f},
-std::array<float,2>{0.441014588f, 0.220057085f},
-std::array<float,2>{0.853710592f, 0.590978324f},
-std::array<float,2>{0.114100136f, 0.754529715f},
-std::array<float,2>{0.656372249f, 0.264988005f},
-std::array<float,2>{0.215605602f, 0.463671654f},
-std::array<float,2>{0.592343569f, 0.928396046f},
-std::array<float,2>{0.254858136f, 0.700851381f},
-std::array<float,2>{0.881769836f, 0.0156192342f},
-std::array<float,2>{0.0214876346f, 0.0724020377f},
-std::array<float,2>{0.687541366f, 0.680722237f},
-std::array<float,2>{0.420217931f, 0.97374326f},
-std::array<float,2>{0.788608789f, 0.401918501f},
-std::array<float,2>{0.321439028f, 0.326031595f},
-std::array<float,2>{0.960198343f, 0.855371892f},
-std::array<float,2>{0.179553613f, 0.512136519f},
-std::array<float,2>{0.558295369f, 0.171782792f},
-std::array<float,2>{0.299506813f, 0.0582633838f},
-std::array<float,2>{0.919460714f, 0.74464494f},
-std::array<float,2>{0.219394401f, 0.891175032f},
-std::array<float,2>{0.594923377f, 0.477947563f},
-std::array<float,2>{0.0837239027f, 0.29750514f},
-std::array<float,2>{0.629671514f, 0.787586153f},
-std::array<float,2>{0.483079374f, 0.598590851f},
-std::array<float,2>{0.83764112f, 0.217239916f},
-std::array<float,2>{0.125977024f, 0.130198359f},
-std::array<float,2>{0.503247321f, 0.554556489f},
-std::array<float,2>{0.373812467f, 0.837635279f},
-std::array<float,2>{0.976759553f, 0.358519316f},
-std::array<float,2>{0.405085206f, 0.431264162f},
-std::array<float,2>{0.763305008f, 0.954611003f},
-std::array<float,2>{0.039310284f, 0.64528203f},
-std::array<float,2>{0.74995321f, 0.122154027f},
-std::array<float,2>{0.347950459f, 0.17852287f},
-std::array<float,2>{0.992296457f, 0.51670289f},
-std::array<float,2>{0.145360231f, 0.86507374f},
-std::array<float,2>{0.51960355f, 0.332134396f},
-std::array<float,2>{0.0523035862f, 0.380405009f},
-std::array<float,2>{0.721703112f, 0.997546196f},
-std::array<float,2>{0.383993119f, 0.66211313f},
-std::array<float,2>{0.769674718f, 0.0915300995f},
-std::array<float,2>{0.24197109f, 0.0200692732f},
-std::array<float,2>{0.613285899f, 0.716523707f},
-std::array<float,2>{0.292869449f, 0.914391637f},
-std::array<float,2>{0.927232742f, 0.440579921f},
-std::array<float,2>{0.497201294f, 0.274804652f},
-std::array<float,2>{0.825343013f, 0.767940104f},
-std::array<float,2>{0.064801693f, 0.570679724f},
-std::array<float,2>{0.641499877f, 0.247917041f},
-std::array<float,2>{0.42910251f, 0.107422791f},
-std::array<float,2>{0.799775124f, 0.635058403f},
-std::array<float,2>{0.0101271216f, 0.944684267f},
-std::array<float,2>{0.71178329f, 0.407098353f},
-std::array<float,2>{0.159804031f, 0.372028083f},
-std::array<float,2>{0.537353575f, 0.826227725f},
-std::array<float,2>{0.343246609f, 0.534015596f},
-std::array<float,2>{0.948596537f, 0.141671374f},
-std::array<float,2>{0.105337851f, 0.188701972f},
-std::array<float,2>{0.680409372f, 0.624729812f},
-std::array<float,2>{0.455369532f, 0.797339737f},
-std::array<float,2>{0.872276008f, 0.295353562f},
-std::array<float,2>{0.27192235f, 0.499303222f},
-std::array<float,2>{0.895224094f, 0.883728445f},
-std::array<float,2>{0.187871024f, 0.720978498f},
-std::array<float,2>{0.569591165f, 0.0430448614f},
-std::array<float,2>{0.467599273f, 0.127348542f},
-std::array<float,2>{0.866396844f, 0.547848821f},
-std::array<float,2>{0.0997401774f, 0.843210399f},
-std::array<float,2>{0.67748189f, 0.355466813f},
-std::array<float,2>{0.20217441f, 0.436099261f},
-std::array<float,2>{0.573791862f, 0.960433066f},
-std::array<float,2>{0.281035572f, 0.642438293f},
-std::array<float,2>{0.900865555f, 0.118910983f},
-std::array<float,2>{0.00247273408f, 0.0601890683f},
-std::array<float,2>{0.710716844f, 0.746732235f},
-std::array<float,2>{0.434117317f, 0.895853162f},
-std::array<float,2>{0.808467746f, 0.482538402f},
-std::array<float,2>{0.32840845f, 0.30259648f},
-std::array<float,2>{0.941012859f, 0.784395516f},
-std::array<float,2>{0.170631677f, 0.595965207f},
-std::array<float,2>{0.544956088f, 0.212353006f},
-std::array<float,2>{0.287213445f, 0.0746064931f},
-std::array<float,2>{0.931110978f, 0.684427142f},
-std::array<float,2>{0.24581866f, 0.969045401f},
-std::array<float,2>{0.624565303f, 0.405002385f},
-std::array<float,2>{0.0781174526f, 0.320883572f},
-std::array<float,2>{0.650650024f, 0.857430696f},
-std::array<float,2>{0.491471052f, 0.509245634f},
-std::array<float,2>{0.818592846f, 0.165385649f},
-std::array<float,2>{0.151058033f, 0.225496367f},
-std::array<float,2>{0.525797009f, 0.589351714f},
-std::array<float,2>{0.357272774f, 0.750682294f},
-std::array<float,2>{0.989881098f, 0.258978426f},
-std::array<float,2>{0.382356703f, 0.466825664f},
-std::array<float,2>{0.775102079f, 0.925434887f},
-std::array<float,2>{0.0601963699f, 0.699003398f},
-std::array<float,2>{0.733913481f, 0.0114097847f},
-std::array<float,2>{0.360530883f, 0.194937721f},
-std::array<float,2>{0.970808089f, 0.619261026f},
-std::array<float,2>{0.140062258f, 0.8037256f},
-std::array<float,2>{0.509177625f, 0.289690733f},
-std::array<float,2>{0.0313756578f, 0.493242502f},
-std::array<float,2>{0.739614367f, 0.888750255f},
-std::array<float,2>{0.397024214f, 0.725855172f},
-std::array<float,2>{0.752721727f, 0.039175041f},
-std::array<float,2>{0.233614087f, 0.102549821f},
-std::array<float,2>{0.608350992f, 0.638821781f},
-std::array<float,2>{0.306482315f, 0.940419078f},
-std::array<float,2>{0.911713302f, 0.412400365f},
-std::array<float,2>{0.470499605f, 0.370084256f},
-std::array<float,2>{0.831311882f, 0.8205567f},
-std::array<float,2>{0.0892672837f, 0.536705315f},
-std::array<float,2>{0.634456694f, 0.147400379f},
-std::array<float,2>{0.412079275f, 0.0187991671f},
-std::array<float,2>{0.795400798f, 0.712237656f},
-std::array<float,2>{0.027447911f, 0.918348789f},
-std::array<float,2>{0.699401081f, 0.445107222f},
-std::array<float,2>{0.183725789f, 0.280251324f},
-std::array<float,2>{0.550007641f, 0.772162139f},
-std::array<float,2>{0.316301405f, 0.577048361f},
-std::array<float,2>{0.96138078f, 0.2457131f},
-std::array<float,2>{0.120890088f, 0.172516599f},
-std::array<float,2>{0.669500947f, 0.521377444f},
-std::array<float,2>{0.450266898f, 0.860123098f},
-std::array<float,2>{0.851428986f, 0.329481632f},
-std::array<float,2>{0.259421378f, 0.376332581f},
-std::array<float,2>{0.882881284f, 0.994238615f},
-std::array<float,2>{0.205325648f, 0.657287359f},
-std::array<float,2>{0.578445077f, 0.0887085721f},
-std::array<float,2>{0.400033176f, 0.236037239f},
-std::array<float,2>{0.759200335f, 0.563862085f},
-std::array<float,2>{0.0433185734f, 0.775037885f},
-std::array<float,2>{0.745978296f, 0.26612255f},
-std::array<float,2>{0.129554197f, 0.446338683f},
-std::array<float,2>{0.506976426f, 0.912348032f},
-std::array<float,2>{0.367518514f, 0.70575273f},
-std::array<float,2>{0.98177886f, 0.0302764326f},
-std::array<float,2>{0.0789992809f, 0.0795411393f},
-std::array<float,2>{0.627395809f, 0.666737974f},
-std::array<float,2>{0.477650642f, 0.988773704f},
-std::array<float,2>{0.843544602f, 0.388055712f},
-std::array<float,2>{0.301325172f, 0.342760295f},
-std::array<float,2>{0.914732397f, 0.867208719f},
-std::array<float,2>{0.226310089f, 0.525163531f},
-std::array<float,2>{0.598592103f, 0.183651641f},
-std::array<float,2>{0.327546924f, 0.0355295055f},
-std::array<float,2>{0.956933975f, 0.731044054f},
-std::array<float,2>{0.174748167f, 0.878544748f},
-std::array<float,2>{0.562313914f, 0.491150409f},
-std::array<float,2>{0.0163619146f, 0.28756851f},
-std::array<float,2>{0.693457544f, 0.808735013f},
-std::array<float,2>{0.415736914f, 0.610640526f},
-std::array<float,2>{0.784816802f, 0.195734829f},
-std::array<float,2>{0.213851556f, 0.154767677f},
-std::array<float,2>{0.586033642f, 0.543130636f},
-std::array<float,2>{0.252885908f, 0.813643813f},
-std::array<float,2>{0.875843883f, 0.362734854f},
-std::array<float,2>{0.443090081f, 0.414488286f},
-std::array<float,2>{0.858383238f, 0.94999826f},
-std::array<float,2>{0.112516522f, 0.630604684f},
-std::array<float,2>{0.661048949f, 0.0981190205f},
-std::array<float,2>{0.266715795f, 0.163659737f},
-std::array<float,2>{0.891614318f, 0.501123428f},
-std::array<float,2>{0.19173491f, 0.850735962f},
-std::array<float,2>{0.564593375f, 0.31896174f},
-std::array<float,2>{0.107150823f, 0.398321658f},
-std::array<float,2>{0.686461985f, 0.980029762f},
-std::array<float,2>{0.459745407f, 0.679610729f},
-std::array<float,2>{0.869217753f, 0.0701249689f},
-std::array<float,2>{0.16184786f, 0.00141720963f},
-std::array<float,2>{0.531279206f, 0.694504738f},
-std::array<float,2>{0.338525236f, 0.93630898f},
-std::array<float,2>{0.951534927f, 0.455567062f},
-std::array<float,2>{0.422093183f, 0.253398091f},
-std::array<float,2>{0.801403761f, 0.764131308f},
-std::array<float,2>{0.0124598779f, 0.584412277f},
-std::array<float,2>{0.715782166f, 0.233044386f},
-std::array<float,2>{0.494942844f, 0.112244882f},
-std::array<float,2>{0.822389126f, 0.652189255f},
-std::array<float,2>{0.0702966675f, 0.968323112f},
-std::array<float,2>{0.64837116f, 0.424518526f},
-std::array<float,2>{0.235026747f, 0.346423179f},
-std::array<float,2>{0.609651685f, 0.834165931f},
-std::array<float,2>{0.294992894f, 0.558246434f},
-std::array<float,2>{0.925043643f, 0.135671183f},
-std::array<float,2>{0.0501580313f, 0.206177935f},
-std::array<float,2>{0.725760341f, 0.606882036f},
-std::array<float,2>{0.38897419f, 0.789710164f},
-std::array<float,2>{0.765741289f, 0.308994174f},
-std::array<float,2>{0.345300049f, 0.469783276f},
-std::array<float,2>{0.998574734f, 0.90570575f},
-std::array<float,2>{0.142557949f, 0.740218639f},
-std::array<float,2>{0.518003464f, 0.0508240387f},
-std::array<float,2>{0.430541396f, 0.181757122f},
-std::array<float,2>{0.810548902f, 0.527866244f},
-std::array<float,2>{0.00705820089f, 0.873886764f},
-std::array<float,2>{0.703149676f, 0.337961853f},
-std::array<float,2>{0.165131629f, 0.383373737f},
-std::array<float,2>{0.539400399f, 0.988095045f},
-std::array<float,2>{0.334669143f, 0.669840753f},
-std::array<float,2>{0.943456352f, 0.0847327635f},
-std::array<float,2>{0.0974352062f, 0.0263909269f},
-std::array<float,2>{0.672644436f, 0.707053483f},
-std::array<float,2>{0.464064389f, 0.908201635f},
-std::array<float,2>{0.862319291f, 0.451796114f},
-std::array<float,2>{0.276731133f, 0.270376027f},
-std::array<float,2>{0.903443336f, 0.779367089f},
-std::array<float,2>{0.196518287f, 0.56929189f},
-std::array<float,2>{0.575819135f, 0.238378599f},
-std::array<float,2>{0.355234623f, 0.0953836516f},
-std::array<float,2>{0.987565339f, 0.627694845f},
-std::array<float,2>{0.153219178f, 0.947982728f},
-std::array<float,2>{0.529215872f, 0.419786364f},
-std::array<float,2>{0.0558525957f, 0.36337927f},
-std::array<float,2>{0.726924479f, 0.818468213f},
-std::array<float,2>{0.378842413f, 0.539793611f},
-std::array<float,2>{0.780504882f, 0.150687724f},
-std::array<float,2>{0.249813393f, 0.200392827f},
-std::array<float,2>{0.62067157f, 0.614625573f},
-std::array<float,2>{0.281309724f, 0.807965875f},
-std::array<float,2>{0.934903204f, 0.282418817f},
-std::array<float,2>{0.485714316f, 0.486711293f},
-std::array<float,2>{0.815291822f, 0.879297197f},
-std::array<float,2>{0.0723350644f, 0.727900863f},
-std::array<float,2>{0.654022574f, 0.0349353403f},
-std::array<float,2>{0.311916649f, 0.229722768f},
-std::array<float,2>{0.907775521f, 0.578481793f},
-std::array<float,2>{0.230311811f, 0.758114159f},
-std::array<float,2>{0.604785621f, 0.255860746f},
-std::array<float,2>{0.0924007967f, 0.457780242f},
-std::array<float,2>{0.63803345f, 0.931784093f},
-std::array<float,2>{0.475694597f, 0.690134168f},
-std::array<float,2>{0.834149957f, 0.00513246143f},
-std::array<float,2>{0.135097921f, 0.0636212677f},
-std::array<float,2>{0.513175905f, 0.673984587f},
-std::array<float,2>{0.365783602f, 0.983319938f},
-std::array<float,2>{0.973007441f, 0.392896801f},
-std::array<float,2>{0.391287953f, 0.314683616f},
-std::array<float,2>{0.75681901f, 0.847083211f},
-std::array<float,2>{0.0362629369f, 0.507072985f},
-std::array<float,2>{0.736193299f, 0.157368973f},
-std::array<float,2>{0.447723061f, 0.0480047911f},
-std::array<float,2>{0.844949186f, 0.734862447f},
-std::array<float,2>{0.123593777f, 0.901600599f},
-std::array<float,2>{0.665860891f, 0.473522127f},
-std::array<float,2>{0.207866967f, 0.307438433f},
-std::array<float,2>{0.582779765f, 0.795902312f},
-std::array<float,2>{0.261739612f, 0.601997674f},
-std::array<float,2>{0.890012503f, 0.208322972f},
-std::array<float,2>{0.0249590222f, 0.139729232f},
-std::array<float,2>{0.695519686f, 0.558726609f},
-std::array<float,2>{0.409353554f, 0.831208229f},
-std::array<float,2>{0.790994585f, 0.350084305f},
-std::array<float,2>{0.320152402f, 0.427080631f},
-std::array<float,2>{0.965873182f, 0.961824894f},
-std::array<float,2>{0.18066971f, 0.65514195f},
-std::array<float,2>{0.551072359f, 0.117072769f},
-std::array<float,2>{0.480632216f, 0.216496438f},
-std::array<float,2>{0.83876127f, 0.601365447f},
-std::array<float,2>{0.085218206f, 0.785336912f},
-std::array<float,2>{0.632604182f, 0.300192982f},
-std::array<float,2>{0.221597999f, 0.48026666f},
-std::array<float,2>{0.595783532f, 0.893104434f},
-std::array<float,2>{0.298735052f, 0.743865252f},
-std::array<float,2>{0.920967162f, 0.0564883463f},
-std::array<float,2>{0.0424115583f, 0.124314882f},
-std::array<float,2>{0.746553779f, 0.647594094f},
-std::array<float,2>{0.403990448f, 0.957015812f},
-std::array<float,2>{0.76492703f, 0.433590025f},
-std::array<float,2>{0.371432662f, 0.356507212f},
-std::array<float,2>{0.980282247f, 0.838115156f},
-std::array<float,2>{0.12878041f, 0.551424801f},
-std::array<float,2>{0.501673579f, 0.131733239f},
-std::array<float,2>{0.256551802f, 0.0118976999f},
-std::array<float,2>{0.880431294f, 0.701717973f},
-std::array<float,2>{0.217107683f, 0.926912904f},
-std::array<float,2>{0.590117037f, 0.461988062f},
-std::array<float,2>{0.115452535f, 0.261883825f},
-std::array<float,2>{0.659923732f, 0.756759465f},
-std::array<float,2>{0.437756121f, 0.591996133f},
-std::array<float,2>{0.851708055f, 0.221956924f},
-std::array<float,2>{0.176590145f, 0.169509992f},
-std::array<float,2>{0.556441367f, 0.51401931f},
-std::array<float,2>{0.323796749f, 0.852923751f},
-std::array<float,2>{0.958708465f, 0.327317595f},
-std::array<float,2>{0.418006003f, 0.400211304f},
-std::array<float,2>{0.786762714f, 0.97473526f},
-std::array<float,2>{0.0205336418f, 0.68259865f},
-std::array<float,2>{0.689776778f, 0.0713648871f},
-std::array<float,2>{0.339975089f, 0.142607957f},
-std::array<float,2>{0.946587265f, 0.531266987f},
-std::array<float,2>{0.156631485f, 0.82541728f},
-std::array<float,2>{0.536329091f, 0.373658359f},
-std::array<float,2>{0.00794456434f, 0.408593714f},
-std::array<float,2>{0.714644432f, 0.942017794f},
-std::array<float,2>{0.427341878f, 0.633543193f},
-std::array<float,2>{0.798511803f, 0.106905177f},
-std::array<float,2>{0.190822542f, 0.0460070446f},
-std::array<float,2>{0.567210913f, 0.719268143f},
-std::array<float,2>{0.271460474f, 0.885887384f},
-std::array<float,2>{0.896487534f, 0.497889727f},
-std::array<float,2>{0.453870177f, 0.293486655f},
-std::array<float,2>{0.873494685f, 0.800077319f},
-std::array<float,2>{0.101886466f, 0.622497082f},
-std::array<float,2>{0.683105409f, 0.191402361f},
-std::array<float,2>{0.385225207f, 0.0937080383f},
-std::array<float,2>{0.772597313f, 0.661117554f},
-std::array<float,2>{0.0538292117f, 0.99918431f},
-std::array<float,2>{0.719222963f, 0.382328331f},
-std::array<float,2>{0.147119761f, 0.335794568f},
-std::array<float,2>{0.522156119f, 0.866661012f},
-std::array<float,2>{0.351215363f, 0.518626988f},
-std::array<float,2>{0.995962262f, 0.176166102f},
-std::array<float,2>{0.0641333535f, 0.249144435f},
-std::array<float,2>{0.643688679f, 0.573605001f},
-std::array<float,2>{0.499859273f, 0.767535567f},
-std::array<float,2>{0.827417612f, 0.275680572f},
-std::array<float,2>{0.289148092f, 0.43928811f},
-std::array<float,2>{0.929571211f, 0.917211533f},
-std::array<float,2>{0.238905668f, 0.717980981f},
-std::array<float,2>{0.616505682f, 0.021514032f},
-std::array<float,2>{0.493727177f, 0.134849563f},
-std::array<float,2>{0.821547389f, 0.557632685f},
-std::array<float,2>{0.0665266663f, 0.834580481f},
-std::array<float,2>{0.644682527f, 0.345771074f},
-std::array<float,2>{0.237466499f, 0.424051136f},
-std::array<float,2>{0.612707555f, 0.968235195f},
-std::array<float,2>{0.294183165f, 0.651399314f},
-std::array<float,2>{0.923649251f, 0.111341879f},
-std::array<float,2>{0.0479273833f, 0.0514732003f},
-std::array<float,2>{0.723041594f, 0.739625692f},
-std::array<float,2>{0.38809824f, 0.906175911f},
-std::array<float,2>{0.767661035f, 0.47065559f},
-std::array<float,2>{0.346744537f, 0.309540689f},
-std::array<float,2>{0.997034013f, 0.789182961f},
-std::array<float,2>{0.143301561f, 0.607048154f},
-std::array<float,2>{0.517131209f, 0.20677495f},
-std::array<float,2>{0.268942684f, 0.0695292205f},
-std::array<float,2>{0.894436121f, 0.679055214f},
-std::array<float,2>{0.193695053f, 0.979918063f},
-std::array<float,2>{0.563967466f, 0.397895843f},
-std::array<float,2>{0.10743019f, 0.318493664f},
-std::array<float,2>{0.684247911f, 0.851547241f},
-std::array<float,2>{0.457122296f, 0.50182122f},
-std::array<float,2>{0.867812753f, 0.16350852f},
-std::array<float,2>{0.163929418f, 0.232680321f},
-std::array<float,2>{0.534089029f, 0.584717274f},
-std::array<float,2>{0.33660391f, 0.764432251f},
-std::array<float,2>{0.949507058f, 0.253574759f},
-std::array<float,2>{0.42508027f, 0.455437243f},
-std::array<float,2>{0.802910388f, 0.935684085f},
-std::array<float,2>{0.0149788111f, 0.695170879f},
-std::array<float,2>{0.717847705f, 0.00166770467f},
-std::array<float,2>{0.325946361f, 0.196240425f},
-std::array<float,2>{0.95324713f, 0.611080706f},
-std::array<float,2>{0.173122972f, 0.809339941f},
-std::array<float,2>{0.559578896f, 0.287968993f},
-std::array<float,2>{0.0179878771f, 0.49070552f},
-std::array<float,2>{0.691642582f, 0.878055274f},
-std::array<float,2>{0.416978806f, 0.730471492f},
-std::array<float,2>{0.781820118f, 0.0360306166f},
-std::array<float,2>{0.211979598f, 0.0981579944f},
-std::array<float,2>{0.58889395f, 0.630215287f},
-std::array<float,2>{0.250616461f, 0.94941777f},
-std::array<float,2>{0.877756119f, 0.414669424f},
-std::array<float,2>{0.445139498f, 0.362931877f},
-std::array<float,2>{0.855656028f, 0.814241469f},
-std::array<float,2>{0.110257432f, 0.543560863f},
-std::array<float,2>{0.663824618f, 0.155060768f},
-std::array<float,2>{0.401958913f, 0.0310158152f},
-std::array<float,2>{0.760755897f, 0.705517948f},
-std::array<float,2>{0.045922935f, 0.912805557f},
-std::array<float,2>{0.744125545f, 0.44706279f},
-std::array<float,2>{0.132658079f, 0.26565659f},
-std::array<float,2>{0.504065335f, 0.774633944f},
-std::array<float,2>{0.370054126f, 0.564330518f},
-std::array<float,2>{0.982518554f, 0.235795826f},
-std::array<float,2>{0.0806882828f, 0.184311271f},
-std::array<float,2>{0.625756085f, 0.524825394f},
-std::array<float,2>{0.47929281f, 0.867765665f},
-std::array<float,2>{0.840947568f, 0.342261195f},
-std::array<float,2>{0.304068893f, 0.388589054f},
-std::array<float,2>{0.917140782f, 0.988747835f},
-std::array<float,2>{0.223652005f, 0.666222215f},
-std::array<float,2>{0.601096034f, 0.0799790919f},
-std::array<float,2>{0.412159532f, 0.245517477f},
-std::array<float,2>{0.793133378f, 0.576183856f},
-std::array<float,2>{0.0307867769f, 0.771488428f},
-std::array<float,2>{0.703070641f, 0.279761344f},
-std::array<float,2>{0.186116979f, 0.444609284f},
-std::array<float,2>{0.548258901f, 0.918760478f},
-std::array<float,2>{0.313897103f, 0.712736905f},
-std::array<float,2>{0.963372946f, 0.0191246532f},
-std::array<float,2>{0.117499329f, 0.0880074874f},
-std::array<float,2>{0.67183578f, 0.658001661f},
-std::array<float,2>{0.45195657f, 0.994676054f},
-std::array<float,2>{0.848923326f, 0.376936913f},
-std::array<float,2>{0.260520816f, 0.329597324f},
-std::array<float,2>{0.884911597f, 0.85972017f},
-std::array<float,2>{0.20365946f, 0.520688236f},
-std::array<float,2>{0.580181003f, 0.171919554f},
-std::array<float,2>{0.362372369f, 0.0399758779f},
-std::array<float,2>{0.970312536f, 0.726433873f},
-std::array<float,2>{0.137095541f, 0.889604449f},
-std::array<float,2>{0.510003626f, 0.493732184f},
-std::array<float,2>{0.0342854485f, 0.289483577f},
-std::array<float,2>{0.740316987f, 0.804637611f},
-std::array<float,2>{0.395672411f, 0.620104969f},
-std::array<float,2>{0.750371933f, 0.194370121f},
-std::array<float,2>{0.232201815f, 0.146758944f},
-std::array<float,2>{0.606585264f, 0.536237657f},
-std::array<float,2>{0.307981879f, 0.820916653f},
-std::array<float,2>{0.912691712f, 0.369180799f},
-std::array<float,2>{0.471856385f, 0.412650853f},
-std::array<float,2>{0.828629375f, 0.939624548f},
-std::array<float,2>{0.0878709033f, 0.639554083f},
-std::array<float,2>{0.635804951f, 0.103457965f},
-std::array<float,2>{0.285410762f, 0.165857568f},
-std::array<float,2>{0.932293713f, 0.509364426f},
-std::array<float,2>{0.24358502f, 0.858306706f},
-std::array<float,2>{0.622823477f, 0.320679873f},
-std::array<float,2>{0.0757668391f, 0.404776096f},
-std::array<float,2>{0.648592412f, 0.969721973f},
-std::array<float,2>{0.488851696f, 0.683930635f},
-std::array<float,2>{0.816431463f, 0.0751706287f},
-std::array<float,2>{0.14948982f, 0.0107531557f},
-std::array<float,2>{0.523471832f, 0.698697329f},
-std::array<float,2>{0.358551055f, 0.924857974f},
-std::array<float,2>{0.990833938f, 0.46750024f},
-std::array<float,2>{0.379086733f, 0.259572953f},
-std::array<float,2>{0.776611567f, 0.750005722f},
-std::array<float,2>{0.0618120879f, 0.589488387f},
-std::array<float,2>{0.732206583f, 0.224714369f},
-std::array<float,2>{0.465802133f, 0.118551217f},
-std::array<float,2>{0.8634848f, 0.641620636f},
-std::array<float,2>{0.099065803f, 0.960597157f},
-std::array<float,2>{0.678493738f, 0.435847074f},
-std::array<float,2>{0.200054139f, 0.354838341f},
-std::array<float,2>{0.571045935f, 0.84348768f},
-std::array<float,2>{0.278280526f, 0.547227859f},
-std::array<float,2>{0.89926666f, 0.127667814f},
-std::array<float,2>{0.00149628252f, 0.212751105f},
-std::array<float,2>{0.708706498f, 0.596574128f},
-std::array<float,2>{0.435882032f, 0.784936428f},
-std::array<float,2>{0.805281043f, 0.302089483f},
-std::array<float,2>{0.330183744f, 0.482965767f},
-std::array<float,2>{0.939135313f, 0.896340191f},
-std::array<float,2>{0.168663248f, 0.746106923f},
-std::array<float,2>{0.544314802f, 0.059921924f},
-std::array<float,2>{0.384737074f, 0.176715493f},
-std::array<float,2>{0.770459294f, 0.519259989f},
-std::array<float,2>{0.051870469f, 0.867073834f},
-std::array<float,2>{0.722410738f, 0.335172087f},
-std::array<float,2>{0.144609377f, 0.38231954f},
-std::array<float,2>{0.520363271f, 0.999641299f},
-std::array<float,2>{0.348526418f, 0.660426438f},
-std::array<float,2>{0.992675781f, 0.0929428712f},
-std::array<float,2>{0.0650323182f, 0.0220193304f},
-std::array<float,2>{0.640631199f, 0.718295097f},
-std::array<float,2>{0.497720242f, 0.917820811f},
-std::array<float,2>{0.826075673f, 0.438668072f},
-std::array<float,2>{0.292185158f, 0.276352644f},
-std::array<float,2>{0.927454054f, 0.76708436f},
-std::array<float,2>{0.241470948f, 0.574175477f},
-std::array<float,2>{0.614151418f, 0.249775723f},
-std::array<float,2>{0.343287289f, 0.107037254f},
-std::array<float,2>{0.948821843f, 0.632965982f},
-std::array<float,2>{0.159219414f, 0.941814363f},
-std::array<float,2>{0.538043141f, 0.408779979f},
-std::array<float,2>{0.0106159477f, 0.373295009f},
-std::array<float,2>{0.711251497f, 0.826093495f},
-std::array<float,2>{0.42944482f, 0.532219291f},
-std::array<float,2>{0.799305975f, 0.143173441f},
-std::array<float,2>{0.188297123f, 0.19077003f},
-std::array<float,2>{0.570234954f, 0.622788012f},
-std::array<float,2>{0.272312075f, 0.800336242f},
-std::array<float,2>{0.894913256f, 0.293205708f},
-std::array<float,2>{0.455835015f, 0.497442663f},
-std::array<float,2>{0.872664034f, 0.886606097f},
-std::array<float,2>{0.104885176f, 0.718937099f},
-std::array<float,2>{0.680070937f, 0.0466487221f},
-std::array<float,2>{0.254345953f, 0.222397655f},
-std::array<float,2>{0.881257474f, 0.592657745f},
-std::array<float,2>{0.21523878f, 0.756187856f},
-std::array<float,2>{0.591988981f, 0.262566239f},
-std::array<float,2>{0.113568366f, 0.46262002f},
-std::array<float,2>{0.657093942f, 0.927393496f},
-std::array<float,2>{0.440831542f, 0.701501906f},
-std::array<float,2>{0.854285479f, 0.0124750184f},
-std::array<float,2>{0.178857654f, 0.0719501004f},
-std::array<float,2>{0.557856023f, 0.681855023f},
-std::array<float,2>{0.321904361f, 0.975370824f},
-std::array<float,2>{0.960817158f, 0.39966023f},
-std::array<float,2>{0.420886308f, 0.328103036f},
-std::array<float,2>{0.788173199f, 0.853265107f},
-std::array<float,2>{0.0220972318f, 0.514451563f},
-std::array<float,2>{0.688145339f, 0.169008672f},
-std::array<float,2>{0.482574731f, 0.0559794717f},
-std::array<float,2>{0.836926043f, 0.743553996f},
-std::array<float,2>{0.0832694024f, 0.892790496f},
-std::array<float,2>{0.629131377f, 0.479895681f},
-std::array<float,2>{0.219223723f, 0.300743937f},
-std::array<float,2>{0.595235705f, 0.785837352f},
-std::array<float,2>{0.299303204f, 0.600995064f},
-std::array<float,2>{0.919012129f, 0.216277406f},
-std::array<float,2>{0.0395836569f, 0.131108597f},
-std::array<float,2>{0.749059498f, 0.551262319f},
-std::array<float,2>{0.404770523f, 0.838398457f},
-std::array<float,2>{0.763144493f, 0.357078612f},
-std::array<float,2>{0.373461038f, 0.432679504f},
-std::array<float,2>{0.977211356f, 0.956118882f},
-std::array<float,2>{0.126872972f, 0.648272812f},
-std::array<float,2>{0.503672302f, 0.124905907f},
-std::array<float,2>{0.446944058f, 0.208505049f},
-std::array<float,2>{0.846960247f, 0.602425456f},
-std::array<float,2>{0.121214442f, 0.796461642f},
-std::array<float,2>{0.667862356f, 0.3069731f},
-std::array<float,2>{0.210761145f, 0.472761184f},
-std::array<float,2>{0.585770428f, 0.902045727f},
-std::array<float,2>{0.26461187f, 0.735234618f},
-std::array<float,2>{0.888190746f, 0.0486932956f},
-std::array<float,2>{0.0266057383f, 0.116237015f},
-std::array<float,2>{0.697969198f, 0.65454334f},
-std::array<float,2>{0.406836599f, 0.961277187f},
-std::array<float,2>{0.791319191f, 0.42753011f},
-std::array<float,2>{0.317679793f, 0.350165486f},
-std::array<float,2>{0.968280435f, 0.832017422f},
-std::array<float,2>{0.182760477f, 0.559259117f},
-std::array<float,2>{0.553733945f, 0.140377015f},
-std::array<float,2>{0.308795452f, 0.00556145795f},
-std::array<float,2>{0.909017563f, 0.689568162f},
-std::array<float,2>{0.227993101f, 0.9324736f},
-std::array<float,2>{0.601970971f, 0.457107604f},
-std::array<float,2>{0.090536505f, 0.256384999f},
-std::array<float,2>{0.638723493f, 0.758723319f},
-std::array<float,2>{0.472885787f, 0.578936994f},
-std::array<float,2>{0.832044482f, 0.230179161f},
-std::array<float,2>{0.132991776f, 0.157723173f},
-std::array<float,2>{0.514592886f, 0.507747412f},
-std::array<float,2>{0.363881886f, 0.847546458f},
-std::array<float,2>{0.976458907f, 0.314981729f},
-std::array<float,2>{0.393416822f, 0.393508643f},
-std::array<float,2>{0.754223824f, 0.982458651f},
-std::array<float,2>{0.038391564f, 0.67436254f},
-std::array<float,2>{0.736556053f, 0.0643569157f},
-std::array<float,2>{0.351745218f, 0.151016042f},
-std::array<float,2>{0.985169888f, 0.539404929f},
-std::array<float,2>{0.155990109f, 0.819290459f},
-std::array<float,2>{0.529441297f, 0.364095449f},
-std::array<float,2>{0.0581403412f, 0.419021577f},
-std::array<float,2>{0.729284704f, 0.947428524f},
-std::array<float,2>{0.376362324f, 0.627022862f},
-std::array<float,2>{0.77878505f, 0.0951232761f},
-std::array<float,2>{0.246736676f, 0.0345554091f},
-std::array<float,2>{0.617586374f, 0.728175819f},
-std::array<float,2>{0.283518761f, 0.879469931f},
-std::array<float,2>{0.935755551f, 0.487249434f},
-std::array<float,2>{0.486856997f, 0.283072591f},
-std::array<float,2>{0.812952816f, 0.808179557f},
-std::array<float,2>{0.0720938295f, 0.615009487f},
-std::array<float,2>{0.654366672f, 0.201027587f},
-std::array<float,2>{0.432920247f, 0.0841059238f},
-std::array<float,2>{0.809027374f, 0.669058979f},
-std::array<float,2>{0.00581338815f, 0.987615585f},
-std::array<float,2>{0.706086755f, 0.382926553f},
-std::array<float,2>{0.16698727f, 0.338836133f},
-std::array<float,2>{0.54287523f, 0.873478055f},
-std::array<float,2>{0.333947212f, 0.527546346f},
-std::array<float,2>{0.942311049f, 0.182264253f},
-std::array<float,2>{0.0954760537f, 0.238868609f},
-std::array<float,2>{0.675724149f, 0.568413436f},
-std::array<float,2>{0.461056471f, 0.779800475f},
-std::array<float,2>{0.859428704f, 0.2696715f},
-std::array<float,2>{0.27348721f, 0.45144698f},
-std::array<float,2>{0.906124711f, 0.907383382f},
-std::array<float,2>{0.198483393f, 0.707521617f},
-std::array<float,2>{0.57750535f, 0.0272998046f},
-std::array<float,2>{0.459337324f, 0.161171705f},
-std::array<float,2>{0.87010783f, 0.502940476f},
-std::array<float,2>{0.106793217f, 0.848514795f},
-std::array<float,2>{0.685846984f, 0.318096906f},
-std::array<float,2>{0.192294702f, 0.394667685f},
-std::array<float,2>{0.564986825f, 0.97710669f},
-std::array<float,2>{0.267281145f, 0.676017106f},
-std::array<float,2>{0.892104745f, 0.0664452538f},
-std::array<float,2>{0.0119580766f, 0.0032671981f},
-std::array<float,2>{0.715229213f, 0.692699194f},
-std::array<float,2>{0.422458082f, 0.935143113f},
-std::array<float,2>{0.80104363f, 0.454581201f},
-std::array<float,2>{0.338210791f, 0.250509381f},
-std::array<float,2>{0.951719701f, 0.763018668f},
-std::array<float,2>{0.16159527f, 0.582566082f},
-std::array<float,2>{0.532157719f, 0.23122862f},
-std::array<float,2>{0.295738697f, 0.111222476f},
-std::array<float,2>{0.925400913f, 0.649546385f},
-std::array<float,2>{0.234687373f, 0.965295315f},
-std::array<float,2>{0.609948218f, 0.421997458f},
-std::array<float,2>{0.0696183816f, 0.344934046f},
-std::array<float,2>{0.6478948f, 0.832271457f},
-std::array<float,2>{0.494487315f, 0.554858565f},
-std::array<float,2>{0.822930992f, 0.13369298f},
-std::array<float,2>{0.141934901f, 0.204893991f},
-std::array<float,2>{0.518224418f, 0.60909605f},
-std::array<float,2>{0.344973892f, 0.791438699f},
-std::array<float,2>{0.998411477f, 0.312407583f},
-std::array<float,2>{0.389175683f, 0.471443206f},
-std::array<float,2>{0.76644963f, 0.902980208f},
-std::array<float,2>{0.0505792983f, 0.742134154f},
-std::array<float,2>{0.726409554f, 0.0543604381f},
-std::array<float,2>{0.367764831f, 0.237603277f},
-std::array<float,2>{0.982382953f, 0.564901471f},
-std::array<float,2>{0.129374608f, 0.775492787f},
-std::array<float,2>{0.507526159f, 0.268048018f},
-std::array<float,2>{0.0437213033f, 0.448617548f},
-std::array<float,2>{0.745417774f, 0.91111666f},
-std::array<float,2>{0.399421126f, 0.703637958f},
-std::array<float,2>{0.759351969f, 0.0284058377f},
-std::array<float,2>{0.225658894f, 0.0807553753f},
-std::array<float,2>{0.59813267f, 0.665748358f},
-std::array<float,2>{0.300823152f, 0.99026674f},
-std::array<float,2>{0.914332509f, 0.390611768f},
-std::array<float,2>{0.478397995f, 0.341500372f},
-std::array<float,2>{0.843206882f, 0.869301021f},
-std::array<float,2>{0.0784211829f, 0.526382625f},
-std::array<float,2>{0.627808392f, 0.185563847f},
-std::array<float,2>{0.415106416f, 0.0383849703f},
-std::array<float,2>{0.784586132f, 0.732960165f},
-std::array<float,2>{0.0161077157f, 0.875338972f},
-std::array<float,2>{0.694067836f, 0.488852352f},
-std::array<float,2>{0.174138576f, 0.286221713f},
-std::array<float,2>{0.561756372f, 0.811272919f},
-std::array<float,2>{0.328058064f, 0.612457037f},
-std::array<float,2>{0.956349492f, 0.198654175f},
-std::array<float,2>{0.113139413f, 0.153625026f},
-std::array<float,2>{0.660411656f, 0.546734095f},
-std::array<float,2>{0.44242242f, 0.815814674f},
-std::array<float,2>{0.857528627f, 0.359772533f},
-std::array<float,2>{0.252415776f, 0.416763037f},
-std::array<float,2>{0.875039935f, 0.951263726f},
-std::array<float,2>{0.213222772f, 0.631600142f},
-std::array<float,2>{0.586669266f, 0.100658499f},
-std::array<float,2>{0.396879673f, 0.192122683f},
-std::array<float,2>{0.752105176f, 0.618204236f},
-std::array<float,2>{0.0322182961f, 0.80080384f},
-std::array<float,2>{0.739753485f, 0.292518616f},
-std::array<float,2>{0.140572533f, 0.49586919f},
-std::array<float,2>{0.509621024f, 0.888655424f},
-std::array<float,2>{0.361131579f, 0.724270284f},
-std::array<float,2>{0.971365273f, 0.0421763621f},
-std::array<float,2>{0.0897600576f, 0.105118074f},
-std::array<float,2>{0.63405782f, 0.636747837f},
-std::array<float,2>{0.470103383f, 0.938066602f},
-std::array<float,2>{0.83184737f, 0.411483288f},
-std::array<float,2>{0.306060851f, 0.367976129f},
-std::array<float,2>{0.911361337f, 0.822496057f},
-std::array<float,2>{0.23395665f, 0.537751377f},
-std::array<float,2>{0.607520163f, 0.146320477f},
-std::array<float,2>{0.315875888f, 0.0159881804f},
-std::array<float,2>{0.9617365f, 0.713783562f},
-std::array<float,2>{0.184302017f, 0.921384394f},
-std::array<float,2>{0.550543249f, 0.44287768f},
-std::array<float,2>{0.0279752128f, 0.277439922f},
-std::array<float,2>{0.69990325f, 0.770458698f},
-std::array<float,2>{0.41118899f, 0.574544251f},
-std::array<float,2>{0.79546392f, 0.243654966f},
-std::array<float,2>{0.205837756f, 0.174741596f},
-std::array<float,2>{0.578765869f, 0.522209704f},
-std::array<float,2>{0.258920938f, 0.862104952f},
-std::array<float,2>{0.883681893f, 0.330276668f},
-std::array<float,2>{0.450790942f, 0.378809541f},
-std::array<float,2>{0.851047754f, 0.992542446f},
-std::array<float,2>{0.120461419f, 0.659053385f},
-std::array<float,2>{0.669115543f, 0.0869824067f},
-std::array<float,2>{0.280676514f, 0.125309363f},
-std::array<float,2>{0.901239812f, 0.548894882f},
-std::array<float,2>{0.202747241f, 0.840864003f},
-std::array<float,2>{0.57370609f, 0.352808744f},
-std::array<float,2>{0.100285918f, 0.434270501f},
-std::array<float,2>{0.677052617f, 0.958839357f},
-std::array<float,2>{0.467149228f, 0.64287442f},
-std::array<float,2>{0.867153049f, 0.119864479f},
-std::array<float,2>{0.170345128f, 0.0606348366f},
-std::array<float,2>{0.545734763f, 0.748431444f},
-std::array<float,2>{0.328620672f, 0.897671342f},
-std::array<float,2>{0.94075948f, 0.482247829f},
-std::array<float,2>{0.433596909f, 0.304312915f},
-std::array<float,2>{0.807819188f, 0.782533407f},
-std::array<float,2>{0.00212275982f, 0.594197989f},
-std::array<float,2>{0.710250318f, 0.213159919f},
-std::array<float,2>{0.491909593f, 0.0780331865f},
-std::array<float,2>{0.819288433f, 0.686779499f},
-std::array<float,2>{0.0772629231f, 0.972346246f},
-std::array<float,2>{0.651031733f, 0.404234588f},
-std::array<float,2>{0.245161146f, 0.322413713f},
-std::array<float,2>{0.624337316f, 0.857382596f},
-std::array<float,2>{0.287737042f, 0.510467052f},
-std::array<float,2>{0.931500852f, 0.167518273f},
-std::array<float,2>{0.0596485399f, 0.223726615f},
-std::array<float,2>{0.733559072f, 0.58665508f},
-std::array<float,2>{0.382129878f, 0.753785074f},
-std::array<float,2>{0.77484417f, 0.259931207f},
-std::array<float,2>{0.356599629f, 0.46630317f},
-std::array<float,2>{0.989743471f, 0.923124969f},
-std::array<float,2>{0.15046367f, 0.696466327f},
-std::array<float,2>{0.526172757f, 0.0090099033f},
-std::array<float,2>{0.426783472f, 0.142157689f},
-std::array<float,2>{0.797887027f, 0.53355211f},
-std::array<float,2>{0.00837467797f, 0.827019095f},
-std::array<float,2>{0.7139166f, 0.371312976f},
-std::array<float,2>{0.156913698f, 0.406395018f},
-std::array<float,2>{0.536967576f, 0.945305467f},
-std::array<float,2>{0.340641588f, 0.635687113f},
-std::array<float,2>{0.946979821f, 0.108047478f},
-std::array<float,2>{0.102469347f, 0.0435438231f},
-std::array<float,2>{0.683164179f, 0.721597254f},
-std::array<float,2>{0.453555107f, 0.882949173f},
-std::array<float,2>{0.873777092f, 0.49975872f},
-std::array<float,2>{0.270615399f, 0.295766085f},
-std::array<float,2>{0.896989703f, 0.797614157f},
-std::array<float,2>{0.191080883f, 0.624217331f},
-std::array<float,2>{0.566863716f, 0.189061075f},
-std::array<float,2>{0.350879073f, 0.0912462249f},
-std::array<float,2>{0.995177269f, 0.662900805f},
-std::array<float,2>{0.146596745f, 0.997591257f},
-std::array<float,2>{0.521631718f, 0.380307972f},
-std::array<float,2>{0.0546413139f, 0.332786232f},
-std::array<float,2>{0.719541073f, 0.864349484f},
-std::array<float,2>{0.38547805f, 0.517332852f},
-std::array<float,2>{0.773375928f, 0.178063437f},
-std::array<float,2>{0.238381699f, 0.247244343f},
-std::array<float,2>{0.617141306f, 0.571101308f},
-std::array<float,2>{0.289738268f, 0.768246233f},
-std::array<float,2>{0.928823292f, 0.275337249f},
-std::array<float,2>{0.49924916f, 0.441140205f},
-std::array<float,2>{0.827898324f, 0.914556324f},
-std::array<float,2>{0.063751407f, 0.715884268f},
-std::array<float,2>{0.644182265f, 0.019536892f},
-std::array<float,2>{0.29826203f, 0.217634648f},
-std::array<float,2>{0.921515882f, 0.597711623f},
-std::array<float,2>{0.220959917f, 0.787999928f},
-std::array<float,2>{0.596579671f, 0.297326565f},
-std::array<float,2>{0.0854930654f, 0.47803849f},
-std::array<float,2>{0.632194161f, 0.890952647f},
-std::array<float,2>{0.481016278f, 0.744188905f},
-std::array<float,2>{0.838079274f, 0.0580475703f},
-std::array<float,2>{0.127988264f, 0.122630805f},
-std::array<float,2>{0.501196086f, 0.644967318f},
-std::array<float,2>{0.371718556f, 0.954117179f},
-std::array<float,2>{0.97995162f, 0.431038022f},
-std::array<float,2>{0.403698444f, 0.359296381f},
-std::array<float,2>{0.765286088f, 0.837105513f},
-std::array<float,2>{0.0429285094f, 0.554120183f},
-std::array<float,2>{0.746801496f, 0.130815536f},
-std::array<float,2>{0.43811363f, 0.0147125255f},
-std::array<float,2>{0.852075636f, 0.700554967f},
-std::array<float,2>{0.116173655f, 0.928086638f},
-std::array<float,2>{0.659532666f, 0.463104546f},
-std::array<float,2>{0.217710614f, 0.26526925f},
-std::array<float,2>{0.590451241f, 0.753998697f},
-std::array<float,2>{0.25599882f, 0.59162885f},
-std::array<float,2>{0.880336225f, 0.220660344f},
-std::array<float,2>{0.0213064663f, 0.171076119f},
-std::array<float,2>{0.690039694f, 0.51251775f},
-std::array<float,2>{0.418673873f, 0.854642451f},
-std::array<float,2>{0.786381066f, 0.325665236f},
-std::array<float,2>{0.323293537f, 0.401375622f},
-std::array<float,2>{0.958216369f, 0.974461913f},
-std::array<float,2>{0.176019207f, 0.681320727f},
-std::array<float,2>{0.55614382f, 0.0730674043f},
-std::array<float,2>{0.476380587f, 0.226742461f},
-std::array<float,2>{0.834709287f, 0.58035779f},
-std::array<float,2>{0.0920047909f, 0.760798275f},
-std::array<float,2>{0.638613105f, 0.254562974f},
-std::array<float,2>{0.229748234f, 0.460089862f},
-std::array<float,2>{0.605267227f, 0.931369543f},
-std::array<float,2>{0.312122017f, 0.688763201f},
-std::array<float,2>{0.907230914f, 0.00706971856f},
-std::array<float,2>{0.0370832086f, 0.0646281764f},
-std::array<float,2>{0.735372126f, 0.673267782f},
-std::array<float,2>{0.390711069f, 0.981420875f},
-std::array<float,2>{0.755890429f, 0.392050415f},
-std::array<float,2>{0.365685523f, 0.313736528f},
-std::array<float,2>{0.973446846f, 0.843780637f},
-std::array<float,2>{0.135415345f, 0.504679203f},
-std::array<float,2>{0.513481975f, 0.158559918f},
-std::array<float,2>{0.262469232f, 0.0501358621f},
-std::array<float,2>{0.890427113f, 0.738214672f},
-std::array<float,2>{0.207114995f, 0.898812056f},
-std::array<float,2>{0.582220972f, 0.474921435f},
-std::array<float,2>{0.123533927f, 0.305380404f},
-std::array<float,2>{0.665055811f, 0.793775856f},
-std::array<float,2>{0.44776544f, 0.603679776f},
-std::array<float,2>{0.845270276f, 0.209195599f},
-std::array<float,2>{0.181271836f, 0.137196273f},
-std::array<float,2>{0.551703453f, 0.560608625f},
-std::array<float,2>{0.319471329f, 0.828521311f},
-std::array<float,2>{0.966649473f, 0.348624319f},
-std::array<float,2>{0.409715712f, 0.427834272f},
-std::array<float,2>{0.790307641f, 0.962919116f},
-std::array<float,2>{0.0248395763f, 0.653722882f},
-std::array<float,2>{0.696022868f, 0.114162311f},
-std::array<float,2>{0.334410667f, 0.180573314f},
-std::array<float,2>{0.944229186f, 0.530566335f},
-std::array<float,2>{0.165548414f, 0.872734725f},
-std::array<float,2>{0.539568901f, 0.337625712f},
-std::array<float,2>{0.00743643334f, 0.386577308f},
-std::array<float,2>{0.704004765f, 0.985295057f},
-std::array<float,2>{0.430166602f, 0.670595706f},
-std::array<float,2>{0.811344862f, 0.0824705884f},
-std::array<float,2>{0.197025552f, 0.0235372111f},
-std::array<float,2>{0.575678706f, 0.71054405f},
-std::array<float,2>{0.276982546f, 0.909130692f},
-std::array<float,2>{0.904049039f, 0.450862527f},
-std::array<float,2>{0.464530468f, 0.272585183f},
-std::array<float,2>{0.86287272f, 0.777794361f},
-std::array<float,2>{0.0967075825f, 0.568116188f},
-std::array<float,2>{0.671935976f, 0.240920499f},
-std::array<float,2>{0.378342986f, 0.0973961651f},
-std::array<float,2>{0.781083763f, 0.626890242f},
-std::array<float,2>{0.0562714711f, 0.945892572f},
-std::array<float,2>{0.727228224f, 0.421442956f},
-std::array<float,2>{0.152473569f, 0.366588533f},
-std::array<float,2>{0.528655767f, 0.817182422f},
-std::array<float,2>{0.354836047f, 0.541647136f},
-std::array<float,2>{0.988061368f, 0.150238693f},
-std::array<float,2>{0.0731274411f, 0.203096002f},
-std::array<float,2>{0.653659284f, 0.617046237f},
-std::array<float,2>{0.486198515f, 0.804721355f},
-std::array<float,2>{0.814857125f, 0.284014076f},
-std::array<float,2>{0.281769067f, 0.485120267f},
-std::array<float,2>{0.935438454f, 0.881315649f},
-std::array<float,2>{0.249418333f, 0.72878778f},
-std::array<float,2>{0.620248616f, 0.0320987515f},
-std::array<float,2>{0.480175108f, 0.187198386f},
-std::array<float,2>{0.840008378f, 0.525619388f},
-std::array<float,2>{0.0813696086f, 0.870783567f},
-std::array<float,2>{0.626591504f, 0.340807617f},
-std::array<float,2>{0.222714528f, 0.389633387f},
-std::array<float,2>{0.59994328f, 0.991336584f},
-std::array<float,2>{0.303042531f, 0.664326727f},
-std::array<float,2>{0.91653502f, 0.0817425698f},
-std::array<float,2>{0.0455199741f, 0.0274177063f},
-std::array<float,2>{0.74221462f, 0.704742134f},
-std::array<float,2>{0.401221216f, 0.91193372f},
-std::array<float,2>{0.759991109f, 0.447728664f},
-std::array<float,2>{0.370560795f, 0.269044936f},
-std::array<float,2>{0.984139383f, 0.777335405f},
-std::array<float,2>{0.131797612f, 0.565963745f},
-std::array<float,2>{0.505128741f, 0.236466005f},
-std::array<float,2>{0.251219809f, 0.100276746f},
-std::array<float,2>{0.878225505f, 0.632368684f},
-std::array<float,2>{0.211011708f, 0.952957392f},
-std::array<float,2>{0.588630319f, 0.417527795f},
-std::array<float,2>{0.111240111f, 0.360815704f},
-std::array<float,2>{0.66268903f, 0.814985573f},
-std::array<float,2>{0.443399221f, 0.545031488f},
-std::array<float,2>{0.856553614f, 0.152566537f},
-std::array<float,2>{0.172557369f, 0.198236808f},
-std::array<float,2>{0.558865905f, 0.612220585f},
-std::array<float,2>{0.325053811f, 0.811828077f},
-std::array<float,2>{0.95461905f, 0.286086291f},
-std::array<float,2>{0.417168051f, 0.489349663f},
-std::array<float,2>{0.78254509f, 0.876595676f},
-std::array<float,2>{0.0190622583f, 0.734291553f},
-std::array<float,2>{0.692815721f, 0.0373697355f},
-std::array<float,2>{0.337453693f, 0.232200101f},
-std::array<float,2>{0.950352669f, 0.583358467f},
-std::array<float,2>{0.163065553f, 0.761724889f},
-std::array<float,2>{0.534460187f, 0.251269251f},
-std::array<float,2>{0.013825343f, 0.453584641f},
-std::array<float,2>{0.717686296f, 0.93392396f},
-std::array<float,2>{0.424574912f, 0.691418529f},
-std::array<float,2>{0.804347873f, 0.00264508324f},
-std::array<float,2>{0.194890097f, 0.0679366291f},
-std::array<float,2>{0.562996686f, 0.676816404f},
-std::array<float,2>{0.268318355f, 0.978196979f},
-std::array<float,2>{0.893470764f, 0.395834923f},
-std::array<float,2>{0.458538502f, 0.31661433f},
-std::array<float,2>{0.868353307f, 0.849380672f},
-std::array<float,2>{0.10897857f, 0.501994252f},
-std::array<float,2>{0.685287774f, 0.160490319f},
-std::array<float,2>{0.38724947f, 0.0536778942f},
-std::array<float,2>{0.768710732f, 0.740532875f},
-std::array<float,2>{0.0469134636f, 0.903888464f},
-std::array<float,2>{0.724561512f, 0.471729785f},
-std::array<float,2>{0.144103691f, 0.310852081f},
-std::array<float,2>{0.515856564f, 0.792797029f},
-std::array<float,2>{0.346002162f, 0.607742071f},
-std::array<float,2>{0.99783659f, 0.204015434f},
-std::array<float,2>{0.0681862533f, 0.134157449f},
-std::array<float,2>{0.64606595f, 0.556501448f},
-std::array<float,2>{0.492515802f, 0.833408058f},
-std::array<float,2>{0.820977867f, 0.344560683f},
-std::array<float,2>{0.293807417f, 0.423696965f},
-std::array<float,2>{0.922017694f, 0.965948939f},
-std::array<float,2>{0.236399397f, 0.649335802f},
-std::array<float,2>{0.611469686f, 0.109526247f},
-std::array<float,2>{0.436661184f, 0.214782149f},
-std::array<float,2>{0.805915475f, 0.595385492f},
-std::array<float,2>{0.000628642912f, 0.781733751f},
-std::array<float,2>{0.707280874f, 0.303147674f},
-std::array<float,2>{0.169894516f, 0.480892479f},
-std::array<float,2>{0.543924391f, 0.897287369f},
-std::array<float,2>{0.331979752f, 0.749892116f},
-std::array<float,2>{0.937578022f, 0.0617779642f},
-std::array<float,2>{0.098365657f, 0.121047288f},
-std::array<float,2>{0.678999603f, 0.643917561f},
-std::array<float,2>{0.466764927f, 0.957925439f},
-std::array<float,2>{0.865021765f, 0.435092539f},
-std::array<float,2>{0.278894633f, 0.35221529f},
-std::array<float,2>{0.899600744f, 0.840319514f},
-std::array<float,2>{0.200296104f, 0.550222099f},
-std::array<float,2>{0.571480811f, 0.126833484f},
-std::array<float,2>{0.358035535f, 0.00848621875f},
-std::array<float,2>{0.991227269f, 0.695330083f},
-std::array<float,2>{0.149137855f, 0.92241019f},
-std::array<float,2>{0.524862945f, 0.46558103f},
-std::array<float,2>{0.0607724041f, 0.260890603f},
-std::array<float,2>{0.731001019f, 0.752577782f},
-std::array<float,2>{0.380613089f, 0.586999476f},
-std::array<float,2>{0.775404572f, 0.223141193f},
-std::array<float,2>{0.242290437f, 0.166809261f},
-std::array<float,2>{0.621262908f, 0.511705756f},
-std::array<float,2>{0.286560327f, 0.855903506f},
-std::array<float,2>{0.933081448f, 0.323348612f},
-std::array<float,2>{0.489529401f, 0.40266028f},
-std::array<float,2>{0.817894697f, 0.971091866f},
-std::array<float,2>{0.0742576867f, 0.685985804f},
-std::array<float,2>{0.650237083f, 0.0768164918f},
-std::array<float,2>{0.307425946f, 0.145410553f},
-std::array<float,2>{0.913526833f, 0.53826195f},
-std::array<float,2>{0.231117874f, 0.823351622f},
-std::array<float,2>{0.605979264f, 0.368722796f},
-std::array<float,2>{0.0862731636f, 0.410861015f},
-std::array<float,2>{0.635603309f, 0.938495457f},
-std::array<float,2>{0.470899791f, 0.638447821f},
-std::array<float,2>{0.829732895f, 0.103656657f},
-std::array<float,2>{0.137972206f, 0.0413400307f},
-std::array<float,2>{0.511292934f, 0.72280556f},
-std::array<float,2>{0.36216256f, 0.886742294f},
-std::array<float,2>{0.969001472f, 0.494255066f},
-std::array<float,2>{0.395168722f, 0.291954935f},
-std::array<float,2>{0.751692414f, 0.802734017f},
-std::array<float,2>{0.0334127881f, 0.617692113f},
-std::array<float,2>{0.741765201f, 0.192654878f},
-std::array<float,2>{0.452192158f, 0.0866292268f},
-std::array<float,2>{0.847772121f, 0.659777641f},
-std::array<float,2>{0.118755452f, 0.993635476f},
-std::array<float,2>{0.67053479f, 0.377047569f},
-std::array<float,2>{0.204888925f, 0.331090152f},
-std::array<float,2>{0.581064522f, 0.863176584f},
-std::array<float,2>{0.261572719f, 0.523387432f},
-std::array<float,2>{0.886718094f, 0.174869642f},
-std::array<float,2>{0.0299705956f, 0.242703646f},
-std::array<float,2>{0.701358259f, 0.575721562f},
-std::array<float,2>{0.413865834f, 0.770825028f},
-std::array<float,2>{0.794618547f, 0.279241771f},
-std::array<float,2>{0.312650651f, 0.442100197f},
-std::array<float,2>{0.964813709f, 0.919963062f},
-std::array<float,2>{0.187427998f, 0.714187264f},
-std::array<float,2>{0.547015011f, 0.0166952088f},
-std::array<float,2>{0.406002313f, 0.128923059f},
-std::array<float,2>{0.762413979f, 0.55340153f},
-std::array<float,2>{0.0402339548f, 0.836040497f},
-std::array<float,2>{0.748473942f, 0.357818991f},
-std::array<float,2>{0.125547722f, 0.430102795f},
-std::array<float,2>{0.502099216f, 0.953628361f},
-std::array<float,2>{0.374275297f, 0.646063626f},
-std::array<float,2>{0.978391767f, 0.121931635f},
-std::array<float,2>{0.0822751075f, 0.0567697622f},
-std::array<float,2>{0.630299747f, 0.745722771f},
-std::array<float,2>{0.484269142f, 0.891624451f},
-std::array<float,2>{0.836381674f, 0.477063298f},
-std::array<float,2>{0.299939543f, 0.298601538f},
-std::array<float,2>{0.918606281f, 0.788331747f},
-std::array<float,2>{0.219776139f, 0.599412858f},
-std::array<float,2>{0.593824685f, 0.218671262f},
-std::array<float,2>{0.321210504f, 0.073909834f},
-std::array<float,2>{0.959708691f, 0.680387437f},
-std::array<float,2>{0.178161368f, 0.972913861f},
-std::array<float,2>{0.557590067f, 0.401186019f},
-std::array<float,2>{0.0229107793f, 0.324745476f},
-std::array<float,2>{0.688924491f, 0.853670657f},
-std::array<float,2>{0.421122164f, 0.51317662f},
-std::array<float,2>{0.787863195f, 0.170372099f},
-std::array<float,2>{0.216423586f, 0.219095439f},
-std::array<float,2>{0.593522251f, 0.590012372f},
-std::array<float,2>{0.255590886f, 0.755034268f},
-std::array<float,2>{0.882125437f, 0.264481127f},
-std::array<float,2>{0.439757347f, 0.464624107f},
-std::array<float,2>{0.854547262f, 0.92876482f},
-std::array<float,2>{0.114596441f, 0.699855149f},
-std::array<float,2>{0.657545209f, 0.0140954247f},
-std::array<float,2>{0.272736162f, 0.187598228f},
-std::array<float,2>{0.896025717f, 0.623595238f},
-std::array<float,2>{0.188957825f, 0.798770487f},
-std::array<float,2>{0.568660975f, 0.296304047f},
-std::array<float,2>{0.103805952f, 0.4981924f},
-std::array<float,2>{0.681622386f, 0.883879423f},
-std::array<float,2>{0.456833959f, 0.722112834f},
-std::array<float,2>{0.87167877f, 0.044000838f},
-std::array<float,2>{0.159129828f, 0.109016135f},
-std::array<float,2>{0.53850925f, 0.63617301f},
-std::array<float,2>{0.342351466f, 0.944183409f},
-std::array<float,2>{0.947335958f, 0.407587081f},
-std::array<float,2>{0.42822814f, 0.372965485f},
-std::array<float,2>{0.800037205f, 0.827158928f},
-std::array<float,2>{0.011585637f, 0.534782529f},
-std::array<float,2>{0.712362945f, 0.141400233f},
-std::array<float,2>{0.496790946f, 0.0210350752f},
-std::array<float,2>{0.825114667f, 0.715076208f},
-std::array<float,2>{0.066257529f, 0.915680707f},
-std::array<float,2>{0.642131627f, 0.439633429f},
-std::array<float,2>{0.240679473f, 0.273654699f},
-std::array<float,2>{0.614309132f, 0.769419849f},
-std::array<float,2>{0.29198131f, 0.57171768f},
-std::array<float,2>{0.926550746f, 0.246987745f},
-std::array<float,2>{0.0511025004f, 0.179408088f},
-std::array<float,2>{0.721390009f, 0.515939653f},
-std::array<float,2>{0.383171052f, 0.863710165f},
-std::array<float,2>{0.771108329f, 0.333252341f},
-std::array<float,2>{0.349082202f, 0.379315108f},
-std::array<float,2>{0.994061887f, 0.996376038f},
-std::array<float,2>{0.145960301f, 0.66389215f},
-std::array<float,2>{0.521433055f, 0.0905968994f},
-std::array<float,2>{0.462038636f, 0.241262466f},
-std::array<float,2>{0.860909581f, 0.566549599f},
-std::array<float,2>{0.0944125503f, 0.778442264f},
-std::array<float,2>{0.674663842f, 0.27208972f},
-std::array<float,2>{0.198225886f, 0.4493922f},
-std::array<float,2>{0.576996744f, 0.909928024f},
-std::array<float,2>{0.275109231f, 0.709931612f},
-std::array<float,2>{0.904745698f, 0.0249290448f},
-std::array<float,2>{0.00482401997f, 0.0836970136f},
-std::array<float,2>{0.705828846f, 0.671587646f},
-std::array<float,2>{0.432036996f, 0.985513091f},
-std::array<float,2>{0.810418665f, 0.385552227f},
-std::array<float,2>{0.332137108f, 0.336235553f},
-std::array<float,2>{0.942875266f, 0.871157587f},
-std::array<float,2>{0.167451933f, 0.529838264f},
-std::array<float,2>{0.541131139f, 0.181044057f},
-std::array<float,2>{0.284587085f, 0.0327347666f},
-std::array<float,2>{0.937073648f, 0.73017627f},
-std::array<float,2>{0.247389808f, 0.881875753f},
-std::array<float,2>{0.618450701f, 0.485846996f},
-std::array<float,2>{0.0708538517f, 0.284336835f},
-std::array<float,2>{0.65533179f, 0.806608021f},
-std::array<float,2>{0.488158375f, 0.615421772f},
-std::array<float,2>{0.81427604f, 0.20122683f},
-std::array<float,2>{0.15510492f, 0.148713231f},
-std::array<float,2>{0.530645072f, 0.542754829f},
-std::array<float,2>{0.352882177f, 0.817696989f},
-std::array<float,2>{0.986074865f, 0.36611107f},
-std::array<float,2>{0.375081927f, 0.420351177f},
-std::array<float,2>{0.778268039f, 0.947093427f},
-std::array<float,2>{0.0573863052f, 0.625465989f},
-std::array<float,2>{0.730136871f, 0.0966433808f},
-std::array<float,2>{0.364617348f, 0.159693316f},
-std::array<float,2>{0.974989891f, 0.505260825f},
-std::array<float,2>{0.134050176f, 0.845254183f},
-std::array<float,2>{0.514684319f, 0.31334427f},
-std::array<float,2>{0.0371355712f, 0.391533315f},
-std::array<float,2>{0.737480164f, 0.98226887f},
-std::array<float,2>{0.39408043f, 0.672496676f},
-std::array<float,2>{0.755175829f, 0.0658905879f},
-std::array<float,2>{0.227503821f, 0.00652734749f},
-std::array<float,2>{0.603047848f, 0.687589526f},
-std::array<float,2>{0.30997479f, 0.93065995f},
-std::array<float,2>{0.909482777f, 0.459697992f},
-std::array<float,2>{0.474006474f, 0.255036712f},
-std::array<float,2>{0.833398342f, 0.760223866f},
-std::array<float,2>{0.0916164666f, 0.581869543f},
-std::array<float,2>{0.639752209f, 0.228090346f},
-std::array<float,2>{0.407479674f, 0.114524499f},
-std::array<float,2>{0.792210698f, 0.65239954f},
-std::array<float,2>{0.026032377f, 0.964021146f},
-std::array<float,2>{0.699139595f, 0.429226726f},
-std::array<float,2>{0.182083264f, 0.348733485f},
-std::array<float,2>{0.553446949f, 0.82946372f},
-std::array<float,2>{0.316486418f, 0.561747849f},
-std::array<float,2>{0.967120588f, 0.137980074f},
-std::array<float,2>{0.12234395f, 0.210933462f},
-std::array<float,2>{0.666310191f, 0.605132401f},
-std::array<float,2>{0.446232915f, 0.794435501f},
-std::array<float,2>{0.845949888f, 0.306335449f},
-std::array<float,2>{0.265405178f, 0.47630775f},
-std::array<float,2>{0.887312353f, 0.89944911f},
-std::array<float,2>{0.209791929f, 0.736493468f},
-std::array<float,2>{0.584713399f, 0.0491803735f},
-std::array<float,2>{0.442228556f, 0.155996874f},
-std::array<float,2>{0.858647764f, 0.544631541f},
-std::array<float,2>{0.111928567f, 0.812545717f},
-std::array<float,2>{0.661407411f, 0.361672193f},
-std::array<float,2>{0.21443972f, 0.415289342f},
-std::array<float,2>{0.58775568f, 0.950438797f},
-std::array<float,2>{0.253828228f, 0.629262269f},
-std::array<float,2>{0.876222968f, 0.0993532389f},
-std::array<float,2>{0.0170973372f, 0.0363050103f},
-std::array<float,2>{0.69446826f, 0.731617212f},
-std::array<float,2>{0.414618015f, 0.876979172f},
-std::array<float,2>{0.783916354f, 0.491434842f},
-std::array<float,2>{0.326888829f, 0.288796604f},
-std::array<float,2>{0.955529749f, 0.810529232f},
-std::array<float,2>{0.175237566f, 0.609728754f},
-std::array<float,2>{0.560832798f, 0.197008669f},
-std::array<float,2>{0.301835597f, 0.078150332f},
-std::array<float,2>{0.915510237f, 0.667934239f},
-std::array<float,2>{0.224958554f, 0.990195811f},
-std::array<float,2>{0.599525034f, 0.387529701f},
-std::array<float,2>{0.0792310834f, 0.34342131f},
-std::array<float,2>{0.628730834f, 0.868509412f},
-std::array<float,2>{0.477366239f, 0.52413094f},
-std::array<float,2>{0.842105806f, 0.184596062f},
-std::array<float,2>{0.129984483f, 0.234751225f},
-std::array<float,2>{0.506101787f, 0.563277245f},
-std::array<float,2>{0.368530214f, 0.774022758f},
-std::array<float,2>{0.980957985f, 0.267254889f},
-std::array<float,2>{0.398443639f, 0.445751131f},
-std::array<float,2>{0.7583009f, 0.913845778f},
-std::array<float,2>{0.0442343727f, 0.706109285f},
-std::array<float,2>{0.744774997f, 0.0296973009f},
-std::array<float,2>{0.344014049f, 0.205433697f},
-std::array<float,2>{0.999895215f, 0.60633415f},
-std::array<float,2>{0.14112173f, 0.790661156f},
-std::array<float,2>{0.51869154f, 0.309831142f},
-std::array<float,2>{0.0495590717f, 0.469611257f},
-std::array<float,2>{0.724827468f, 0.904427767f},
-std::array<float,2>{0.390039474f, 0.739031196f},
-std::array<float,2>{0.767077506f, 0.0518073961f},
-std::array<float,2>{0.236223862f, 0.112456098f},
-std::array<float,2>{0.610826313f, 0.650412381f},
-std::array<float,2>{0.296322852f, 0.966975033f},
-std::array<float,2>{0.923898458f, 0.425484061f},
-std::array<float,2>{0.495515734f, 0.347638875f},
-std::array<float,2>{0.823364437f, 0.835160494f},
-std::array<float,2>{0.0690400004f, 0.556697071f},
-std::array<float,2>{0.646985531f, 0.136012316f},
-std::array<float,2>{0.423669159f, 0.000713654503f},
-std::array<float,2>{0.802456617f, 0.693754196f},
-std::array<float,2>{0.0130438423f, 0.937460303f},
-std::array<float,2>{0.716264904f, 0.456253529f},
-std::array<float,2>{0.16094479f, 0.252396494f},
-std::array<float,2>{0.532976687f, 0.76482892f},
-std::array<float,2>{0.33931607f, 0.585456848f},
-std::array<float,2>{0.95260179f, 0.233477756f},
-std::array<float,2>{0.105480507f, 0.16244109f},
-std::array<float,2>{0.68672061f, 0.500805378f},
-std::array<float,2>{0.460787803f, 0.850010753f},
-std::array<float,2>{0.870188534f, 0.319938898f},
-std::array<float,2>{0.26650387f, 0.397136897f},
-std::array<float,2>{0.891518474f, 0.979136884f},
-std::array<float,2>{0.193306804f, 0.678708196f},
-std::array<float,2>{0.565649331f, 0.068924807f},
-std::array<float,2>{0.381802261f, 0.225624338f},
-std::array<float,2>{0.773937643f, 0.58797127f},
-std::array<float,2>{0.0587431081f, 0.751832724f},
-std::array<float,2>{0.733131528f, 0.258202076f},
-std::array<float,2>{0.151390478f, 0.46854797f},
-std::array<float,2>{0.526840687f, 0.924161017f},
-std::array<float,2>{0.35572812f, 0.69748795f},
-std::array<float,2>{0.988996625f, 0.0104239322f},
-std::array<float,2>{0.0761869699f, 0.0759753436f},
-std::array<float,2>{0.65197134f, 0.685089171f},
-std::array<float,2>{0.490393996f, 0.970302463f},
-std::array<float,2>{0.819725513f, 0.406035095f},
-std::array<float,2>{0.28813678f, 0.321822941f},
-std::array<float,2>{0.930500507f, 0.859003544f},
-std::array<float,2>{0.244506493f, 0.508090496f},
-std::array<float,2>{0.623717546f, 0.164962694f},
-std::array<float,2>{0.329837292f, 0.0587113313f},
-std::array<float,2>{0.939592719f, 0.747361183f},
-std::array<float,2>{0.171340585f, 0.895186841f},
-std::array<float,2>{0.546216249f, 0.483828396f},
-std::array<float,2>{0.00338828447f, 0.301255465f},
-std::array<float,2>{0.709207535f, 0.78329736f},
-std::array<float,2>{0.435380161f, 0.597518981f},
-std::array<float,2>{0.807169139f, 0.211880416f},
-std::array<float,2>{0.201522216f, 0.128368199f},
-std::array<float,2>{0.572885692f, 0.547924399f},
-std::array<float,2>{0.279621035f, 0.842276156f},
-std::array<float,2>{0.901582122f, 0.354093641f},
-std::array<float,2>{0.468021601f, 0.436724752f},
-std::array<float,2>{0.866146445f, 0.959670067f},
-std::array<float,2>{0.101102196f, 0.640731692f},
-std::array<float,2>{0.675823569f, 0.117382593f},
-std::array<float,2>{0.258155584f, 0.173671111f},
-std::array<float,2>{0.884255767f, 0.519840956f},
-std::array<float,2>{0.206169054f, 0.860958338f},
-std::array<float,2>{0.579104245f, 0.328298569f},
-std::array<float,2>{0.119934589f, 0.375270545f},
-std::array<float,2>{0.668339491f, 0.995918691f},
-std::array<float,2>{0.449511617f, 0.656957328f},
-std::array<float,2>{0.850157201f, 0.0892247632f},
-std::array<float,2>{0.18510285f, 0.0180734862f},
-std::array<float,2>{0.549499452f, 0.71150893f},
-std::array<float,2>{0.315377384f, 0.919316173f},
-std::array<float,2>{0.962228417f, 0.443857849f},
-std::array<float,2>{0.410235912f, 0.280827433f},
-std::array<float,2>{0.796501338f, 0.772704422f},
-std::array<float,2>{0.0289532319f, 0.577881455f},
-std::array<float,2>{0.700427711f, 0.24476257f},
-std::array<float,2>{0.469703138f, 0.101873487f},
-std::array<float,2>{0.83069551f, 0.640514016f},
-std::array<float,2>{0.0885629803f, 0.940730691f},
-std::array<float,2>{0.633507073f, 0.414042532f},
-std::array<float,2>{0.233088031f, 0.370266199f},
-std::array<float,2>{0.60877949f, 0.821442902f},
-std::array<float,2>{0.304742903f, 0.53526777f},
-std::array<float,2>{0.910740912f, 0.148390621f},
-std::array<float,2>{0.0330253094f, 0.193447098f},
-std::array<float,2>{0.739077985f, 0.620241761f},
-std::array<float,2>{0.398215145f, 0.802866578f},
-std::array<float,2>{0.753906012f, 0.290327787f},
-std::array<float,2>{0.360267282f, 0.492438436f},
-std::array<float,2>{0.972596228f, 0.889882505f},
-std::array<float,2>{0.139526501f, 0.725242198f},
-std::array<float,2>{0.507831275f, 0.0403240323f},
-std::array<float,2>{0.419190973f, 0.168529779f},
-std::array<float,2>{0.785707474f, 0.515564919f},
-std::array<float,2>{0.0201834645f, 0.852127254f},
-std::array<float,2>{0.690618217f, 0.326708198f},
-std::array<float,2>{0.177025363f, 0.399204582f},
-std::array<float,2>{0.554886997f, 0.975593209f},
-std::array<float,2>{0.322839528f, 0.682675421f},
-std::array<float,2>{0.957910776f, 0.0707680881f},
-std::array<float,2>{0.116286322f, 0.0128874388f},
-std::array<float,2>{0.658281088f, 0.702562869f},
-std::array<float,2>{0.43920207f, 0.926359534f},
-std::array<float,2>{0.853153646f, 0.461107671f},
-std::array<float,2>{0.257489741f, 0.262800127f},
-std::array<float,2>{0.879053593f, 0.757582486f},
-std::array<float,2>{0.218133956f, 0.592811227f},
-std::array<float,2>{0.591239095f, 0.220928058f},
-std::array<float,2>{0.372875273f, 0.123290338f},
-std::array<float,2>{0.978727341f, 0.646829426f},
-std::array<float,2>{0.127725452f, 0.955796838f},
-std::array<float,2>{0.500116706f, 0.432187498f},
-std::array<float,2>{0.0410480201f, 0.35577625f},
-std::array<float,2>{0.747715473f, 0.839507103f},
-std::array<float,2>{0.402790517f, 0.552639008f},
-std::array<float,2>{0.763708651f, 0.132356346f},
-std::array<float,2>{0.221757621f, 0.215038925f},
-std::array<float,2>{0.596873522f, 0.6002298f},
-std::array<float,2>{0.297293872f, 0.786929727f},
-std::array<float,2>{0.92052865f, 0.29951328f},
-std::array<float,2>{0.481562167f, 0.478877604f},
-std::array<float,2>{0.839376509f, 0.894449532f},
-std::array<float,2>{0.0840322673f, 0.743163824f},
-std::array<float,2>{0.631254494f, 0.054743167f},
-std::array<float,2>{0.290267467f, 0.248682395f},
-std::array<float,2>{0.928367317f, 0.572840691f},
-std::array<float,2>{0.239492655f, 0.765801013f},
-std::array<float,2>{0.616038084f, 0.277314693f},
-std::array<float,2>{0.06258706f, 0.438063055f},
-std::array<float,2>{0.643254817f, 0.916295171f},
-std::array<float,2>{0.498436183f, 0.717531204f},
-std::array<float,2>{0.827074349f, 0.0228045825f},
-std::array<float,2>{0.147685215f, 0.0918279141f},
-std::array<float,2>{0.522638202f, 0.662030041f},
-std::array<float,2>{0.350012213f, 0.998310626f},
-std::array<float,2>{0.994205415f, 0.380956322f},
-std::array<float,2>{0.38619563f, 0.334101021f},
-std::array<float,2>{0.77238071f, 0.86546123f},
-std::array<float,2>{0.0532009527f, 0.518193126f},
-std::array<float,2>{0.720699251f, 0.177441359f},
-std::array<float,2>{0.454400897f, 0.0451012067f},
-std::array<float,2>{0.874834299f, 0.720536411f},
-std::array<float,2>{0.102744281f, 0.884833038f},
-std::array<float,2>{0.682142854f, 0.496128112f},
-std::array<float,2>{0.189484641f, 0.294070125f},
-std::array<float,2>{0.568231881f, 0.798941016f},
-std::array<float,2>{0.26977402f, 0.621525824f},
-std::array<float,2>{0.898190081f, 0.189857826f},
-std::array<float,2>{0.0093958322f, 0.144035384f},
-std::array<float,2>{0.713375032f, 0.532868743f},
-std::array<float,2>{0.426624894f, 0.824295402f},
-std::array<float,2>{0.797831357f, 0.374845833f},
-std::array<float,2>{0.341300905f, 0.409266979f},
-std::array<float,2>{0.945702791f, 0.942668498f},
-std::array<float,2>{0.15782246f, 0.634522676f},
-std::array<float,2>{0.535721064f, 0.1059357f},
-std::array<float,2>{0.485072792f, 0.199274287f},
-std::array<float,2>{0.815775514f, 0.613720477f},
-std::array<float,2>{0.0737551749f, 0.807166815f},
-std::array<float,2>{0.652424991f, 0.281382173f},
-std::array<float,2>{0.24822548f, 0.487727374f},
-std::array<float,2>{0.619386792f, 0.880534351f},
-std::array<float,2>{0.282670617f, 0.727010429f},
-std::array<float,2>{0.934130788f, 0.033977665f},
-std::array<float,2>{0.0554467253f, 0.0945144594f},
-std::array<float,2>{0.727827609f, 0.628006399f},
-std::array<float,2>{0.377543092f, 0.949193239f},
-std::array<float,2>{0.779915214f, 0.417972118f},
-std::array<float,2>{0.353850722f, 0.365019679f},
-std::array<float,2>{0.986804783f, 0.820048392f},
-std::array<float,2>{0.153828621f, 0.54074055f},
-std::array<float,2>{0.527408957f, 0.151739106f},
-std::array<float,2>{0.276007295f, 0.0254937746f},
-std::array<float,2>{0.902357996f, 0.708070099f},
-std::array<float,2>{0.19558762f, 0.906827807f},
-std::array<float,2>{0.574500978f, 0.452291936f},
-std::array<float,2>{0.0963587984f, 0.27125442f},
-std::array<float,2>{0.673468769f, 0.780874729f},
-std::array<float,2>{0.462984353f, 0.569835961f},
-std::array<float,2>{0.861712575f, 0.239861429f},
-std::array<float,2>{0.164923936f, 0.183134913f},
-std::array<float,2>{0.540891767f, 0.529088199f},
-std::array<float,2>{0.33589825f, 0.874744534f},
-std::array<float,2>{0.944604874f, 0.33918485f},
-std::array<float,2>{0.431256503f, 0.38423121f},
-std::array<float,2>{0.812167108f, 0.987112224f},
-std::array<float,2>{0.00673004659f, 0.668536901f},
-std::array<float,2>{0.704569936f, 0.0854528844f},
-std::array<float,2>{0.319073707f, 0.139265999f},
-std::array<float,2>{0.965326965f, 0.559873939f},
-std::array<float,2>{0.180154189f, 0.830351472f},
-std::array<float,2>{0.552123189f, 0.350763351f},
-std::array<float,2>{0.0240403563f, 0.425889313f},
-std::array<float,2>{0.696363151f, 0.962361932f},
-std::array<float,2>{0.408760697f, 0.655295253f},
-std::array<float,2>{0.78930968f, 0.115980893f},
-std::array<float,2>{0.208046794f, 0.0475413054f},
-std::array<float,2>{0.58318311f, 0.73536849f},
-std::array<float,2>{0.263455033f, 0.900591075f},
-std::array<float,2>{0.88911736f, 0.474422097f},
-std::array<float,2>{0.448406965f, 0.308540791f},
-std::array<float,2>{0.844339073f, 0.795665741f},
-std::array<float,2>{0.1240438f, 0.602971196f},
-std::array<float,2>{0.664127409f, 0.2070411f},
-std::array<float,2>{0.392052174f, 0.0630273297f},
-std::array<float,2>{0.757297993f, 0.675733387f},
-std::array<float,2>{0.0356061496f, 0.983873487f},
-std::array<float,2>{0.734752178f, 0.39450857f},
-std::array<float,2>{0.136176229f, 0.316404074f},
-std::array<float,2>{0.511911154f, 0.846444845f},
-std::array<float,2>{0.366498321f, 0.506682575f},
-std::array<float,2>{0.9736678f, 0.156768575f},
-std::array<float,2>{0.0928716063f, 0.228764206f},
-std::array<float,2>{0.637015939f, 0.57998991f},
-std::array<float,2>{0.475437999f, 0.758848011f},
-std::array<float,2>{0.8354339f, 0.257130742f},
-std::array<float,2>{0.311152637f, 0.458117455f},
-std::array<float,2>{0.90636766f, 0.93289578f},
-std::array<float,2>{0.229153335f, 0.691080391f},
-std::array<float,2>{0.603695333f, 0.00408351747f}}
\ No newline at end of file
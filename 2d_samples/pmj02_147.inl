@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.648885548f, 0.20388703f},
-std::array<float,2>{0.0043749162f, 0.543410122f},
-std::array<float,2>{0.96286279f, 0.886815369f},
-std::array<float,2>{0.293652117f, 0.314047813f},
-std::array<float,2>{0.849715829f, 0.38144058f},
-std::array<float,2>{0.377019376f, 0.759963632f},
-std::array<float,2>{0.519231319f, 0.625404716f},
-std::array<float,2>{0.164138317f, 0.0242815427f},
-std::array<float,2>{0.60051769f, 0.305012584f},
-std::array<float,2>{0.196732074f, 0.941745996f},
-std::array<float,2>{0.758650243f, 0.568966687f},
-std::array<float,2>{0.492903471f, 0.135998994f},
-std::array<float,2>{0.882539272f, 0.114166833f},
-std::array<float,2>{0.357076406f, 0.697763205f},
-std::array<float,2>{0.731380701f, 0.818808854f},
-std::array<float,2>{0.121941306f, 0.456272751f},
-std::array<float,2>{0.546391249f, 0.0538818501f},
-std::array<float,2>{0.140775144f, 0.670000792f},
-std::array<float,2>{0.832421958f, 0.783666611f},
-std::array<float,2>{0.412572086f, 0.43577531f},
-std::array<float,2>{0.997487068f, 0.348836273f},
-std::array<float,2>{0.280037314f, 0.929623246f},
-std::array<float,2>{0.675982773f, 0.508140385f},
-std::array<float,2>{0.0433449782f, 0.222850382f},
-std::array<float,2>{0.70027703f, 0.497729242f},
-std::array<float,2>{0.0664956123f, 0.874394298f},
-std::array<float,2>{0.910824597f, 0.725631297f},
-std::array<float,2>{0.3302342f, 0.0845104456f},
-std::array<float,2>{0.782814503f, 0.172501028f},
-std::array<float,2>{0.466959f, 0.611887991f},
-std::array<float,2>{0.578558385f, 0.981751144f},
-std::array<float,2>{0.238942251f, 0.262451082f},
-std::array<float,2>{0.572199821f, 0.140729293f},
-std::array<float,2>{0.224476144f, 0.586127043f},
-std::array<float,2>{0.804067791f, 0.964892089f},
-std::array<float,2>{0.448597521f, 0.293756038f},
-std::array<float,2>{0.934039414f, 0.44935444f},
-std::array<float,2>{0.318689466f, 0.841031134f},
-std::array<float,2>{0.705767155f, 0.714482784f},
-std::array<float,2>{0.0783149078f, 0.0948602483f},
-std::array<float,2>{0.671828449f, 0.343266755f},
-std::array<float,2>{0.0471007451f, 0.904859662f},
-std::array<float,2>{0.976814628f, 0.54996413f},
-std::array<float,2>{0.261005253f, 0.196649611f},
-std::array<float,2>{0.822761178f, 0.00955099147f},
-std::array<float,2>{0.423076451f, 0.645494103f},
-std::array<float,2>{0.562442899f, 0.777938962f},
-std::array<float,2>{0.129408792f, 0.399939448f},
-std::array<float,2>{0.742536843f, 0.0735158697f},
-std::array<float,2>{0.100286834f, 0.745793998f},
-std::array<float,2>{0.902240694f, 0.847160518f},
-std::array<float,2>{0.368439108f, 0.472843826f},
-std::array<float,2>{0.774313509f, 0.272127748f},
-std::array<float,2>{0.480906636f, 0.996368647f},
-std::array<float,2>{0.616197705f, 0.600578606f},
-std::array<float,2>{0.212156758f, 0.170158565f},
-std::array<float,2>{0.514299691f, 0.409877986f},
-std::array<float,2>{0.175816f, 0.797549248f},
-std::array<float,2>{0.870737731f, 0.676301718f},
-std::array<float,2>{0.405054003f, 0.0395163633f},
-std::array<float,2>{0.948701143f, 0.2345566f},
-std::array<float,2>{0.306523919f, 0.530603766f},
-std::array<float,2>{0.626892567f, 0.912821531f},
-std::array<float,2>{0.0271314029f, 0.364938766f},
-std::array<float,2>{0.718564987f, 0.162032932f},
-std::array<float,2>{0.0893886089f, 0.603666186f},
-std::array<float,2>{0.92825222f, 0.985479355f},
-std::array<float,2>{0.325219065f, 0.276984811f},
-std::array<float,2>{0.807679832f, 0.478069991f},
-std::array<float,2>{0.437769085f, 0.853287458f},
-std::array<float,2>{0.567839086f, 0.737619936f},
-std::array<float,2>{0.226962402f, 0.0626536757f},
-std::array<float,2>{0.553243399f, 0.373122722f},
-std::array<float,2>{0.133190483f, 0.915918708f},
-std::array<float,2>{0.812619567f, 0.519303858f},
-std::array<float,2>{0.43312943f, 0.242209867f},
-std::array<float,2>{0.969152689f, 0.033362329f},
-std::array<float,2>{0.250502467f, 0.68550998f},
-std::array<float,2>{0.657141149f, 0.806991577f},
-std::array<float,2>{0.0607998818f, 0.416592568f},
-std::array<float,2>{0.61922735f, 0.108626962f},
-std::array<float,2>{0.204879537f, 0.703760207f},
-std::array<float,2>{0.76770246f, 0.829498589f},
-std::array<float,2>{0.476060063f, 0.441388905f},
-std::array<float,2>{0.896586359f, 0.28634423f},
-std::array<float,2>{0.365945995f, 0.957823575f},
-std::array<float,2>{0.739982963f, 0.578937709f},
-std::array<float,2>{0.10187012f, 0.150332376f},
-std::array<float,2>{0.635373116f, 0.392742902f},
-std::array<float,2>{0.0232207458f, 0.766556144f},
-std::array<float,2>{0.93865639f, 0.655803084f},
-std::array<float,2>{0.302448213f, 0.00610843068f},
-std::array<float,2>{0.860867679f, 0.19373849f},
-std::array<float,2>{0.396596313f, 0.56159389f},
-std::array<float,2>{0.501717091f, 0.891817868f},
-std::array<float,2>{0.185109437f, 0.334159762f},
-std::array<float,2>{0.527577817f, 0.231288254f},
-std::array<float,2>{0.15809384f, 0.505749404f},
-std::array<float,2>{0.859085262f, 0.932096243f},
-std::array<float,2>{0.385006011f, 0.354626596f},
-std::array<float,2>{0.960840166f, 0.422645062f},
-std::array<float,2>{0.28735882f, 0.795060396f},
-std::array<float,2>{0.644729614f, 0.658685267f},
-std::array<float,2>{0.0106594097f, 0.0623414852f},
-std::array<float,2>{0.718871295f, 0.255920649f},
-std::array<float,2>{0.110836774f, 0.973690927f},
-std::array<float,2>{0.885426462f, 0.618383765f},
-std::array<float,2>{0.349977493f, 0.182536379f},
-std::array<float,2>{0.753372967f, 0.0933206454f},
-std::array<float,2>{0.486452579f, 0.733972967f},
-std::array<float,2>{0.607719898f, 0.859460652f},
-std::array<float,2>{0.189075276f, 0.485483378f},
-std::array<float,2>{0.686842561f, 0.0164849684f},
-std::array<float,2>{0.0361531936f, 0.63566488f},
-std::array<float,2>{0.991465926f, 0.751995087f},
-std::array<float,2>{0.271268785f, 0.386793643f},
-std::array<float,2>{0.841559291f, 0.324659824f},
-std::array<float,2>{0.414700955f, 0.882283092f},
-std::array<float,2>{0.534595132f, 0.534493744f},
-std::array<float,2>{0.151741713f, 0.211031452f},
-std::array<float,2>{0.586372495f, 0.464131743f},
-std::array<float,2>{0.243278429f, 0.826288164f},
-std::array<float,2>{0.790784359f, 0.689345837f},
-std::array<float,2>{0.459411442f, 0.119211584f},
-std::array<float,2>{0.915978849f, 0.130397081f},
-std::array<float,2>{0.340830773f, 0.574276388f},
-std::array<float,2>{0.691967905f, 0.951818347f},
-std::array<float,2>{0.0732702389f, 0.304285109f},
-std::array<float,2>{0.729565799f, 0.249760821f},
-std::array<float,2>{0.118364222f, 0.521859288f},
-std::array<float,2>{0.878663778f, 0.921153307f},
-std::array<float,2>{0.354622334f, 0.370998025f},
-std::array<float,2>{0.76420188f, 0.41869247f},
-std::array<float,2>{0.499169648f, 0.812432885f},
-std::array<float,2>{0.593986392f, 0.680711806f},
-std::array<float,2>{0.200150236f, 0.0366294906f},
-std::array<float,2>{0.520059764f, 0.278627366f},
-std::array<float,2>{0.170647889f, 0.990079284f},
-std::array<float,2>{0.844771683f, 0.606039643f},
-std::array<float,2>{0.382109255f, 0.158243433f},
-std::array<float,2>{0.965711832f, 0.0684637129f},
-std::array<float,2>{0.290896565f, 0.738560081f},
-std::array<float,2>{0.655763447f, 0.858686864f},
-std::array<float,2>{0.000796701177f, 0.482501537f},
-std::array<float,2>{0.58544898f, 0.000360717066f},
-std::array<float,2>{0.235000208f, 0.651247025f},
-std::array<float,2>{0.785338402f, 0.770067275f},
-std::array<float,2>{0.464085877f, 0.39811179f},
-std::array<float,2>{0.909259558f, 0.331326872f},
-std::array<float,2>{0.335001379f, 0.897630453f},
-std::array<float,2>{0.697907209f, 0.55803138f},
-std::array<float,2>{0.0641507059f, 0.189897135f},
-std::array<float,2>{0.673367262f, 0.444796473f},
-std::array<float,2>{0.0407942533f, 0.8345474f},
-std::array<float,2>{0.994648457f, 0.708729386f},
-std::array<float,2>{0.277220219f, 0.103956796f},
-std::array<float,2>{0.828588963f, 0.154913813f},
-std::array<float,2>{0.408866644f, 0.582423329f},
-std::array<float,2>{0.540186107f, 0.956078947f},
-std::array<float,2>{0.144891962f, 0.283731848f},
-std::array<float,2>{0.558352411f, 0.184396252f},
-std::array<float,2>{0.125935212f, 0.623702705f},
-std::array<float,2>{0.82528913f, 0.969252229f},
-std::array<float,2>{0.429291844f, 0.253474772f},
-std::array<float,2>{0.981566191f, 0.489401281f},
-std::array<float,2>{0.262232661f, 0.865807056f},
-std::array<float,2>{0.665647805f, 0.727429032f},
-std::array<float,2>{0.0534136407f, 0.0890023261f},
-std::array<float,2>{0.710255742f, 0.359013677f},
-std::array<float,2>{0.0821167454f, 0.936075211f},
-std::array<float,2>{0.931644082f, 0.502607226f},
-std::array<float,2>{0.312811673f, 0.229632795f},
-std::array<float,2>{0.79770124f, 0.0550993532f},
-std::array<float,2>{0.450031906f, 0.662734568f},
-std::array<float,2>{0.576351583f, 0.790390074f},
-std::array<float,2>{0.219964132f, 0.426657259f},
-std::array<float,2>{0.629728377f, 0.12358132f},
-std::array<float,2>{0.027694108f, 0.691600919f},
-std::array<float,2>{0.95224613f, 0.822156847f},
-std::array<float,2>{0.310189486f, 0.46703288f},
-std::array<float,2>{0.871804237f, 0.297334015f},
-std::array<float,2>{0.399180114f, 0.946146131f},
-std::array<float,2>{0.510573387f, 0.572382629f},
-std::array<float,2>{0.175647527f, 0.128482834f},
-std::array<float,2>{0.612550378f, 0.386622488f},
-std::array<float,2>{0.215434611f, 0.755295873f},
-std::array<float,2>{0.780885756f, 0.637643099f},
-std::array<float,2>{0.47870335f, 0.0199085698f},
-std::array<float,2>{0.905002952f, 0.2184183f},
-std::array<float,2>{0.372137249f, 0.536449969f},
-std::array<float,2>{0.748532176f, 0.877554715f},
-std::array<float,2>{0.093988739f, 0.321103841f},
-std::array<float,2>{0.661990821f, 0.140448585f},
-std::array<float,2>{0.0567623116f, 0.565263331f},
-std::array<float,2>{0.975033343f, 0.939275265f},
-std::array<float,2>{0.256615222f, 0.312259942f},
-std::array<float,2>{0.818444192f, 0.459601372f},
-std::array<float,2>{0.436103642f, 0.813545585f},
-std::array<float,2>{0.54851079f, 0.702314913f},
-std::array<float,2>{0.13711746f, 0.112092577f},
-std::array<float,2>{0.562589705f, 0.3189964f},
-std::array<float,2>{0.231120586f, 0.886336803f},
-std::array<float,2>{0.808963299f, 0.539188147f},
-std::array<float,2>{0.443242013f, 0.207312584f},
-std::array<float,2>{0.922185898f, 0.0293933935f},
-std::array<float,2>{0.322546065f, 0.62942791f},
-std::array<float,2>{0.714095533f, 0.76372534f},
-std::array<float,2>{0.0919904262f, 0.377351999f},
-std::array<float,2>{0.503970861f, 0.082011506f},
-std::array<float,2>{0.182305619f, 0.720062554f},
-std::array<float,2>{0.864044964f, 0.870510519f},
-std::array<float,2>{0.393387407f, 0.494184732f},
-std::array<float,2>{0.943959296f, 0.259118408f},
-std::array<float,2>{0.299525946f, 0.978695095f},
-std::array<float,2>{0.640118837f, 0.614119112f},
-std::array<float,2>{0.0156427231f, 0.179085538f},
-std::array<float,2>{0.737989366f, 0.429806739f},
-std::array<float,2>{0.105769202f, 0.788877785f},
-std::array<float,2>{0.894375741f, 0.664928734f},
-std::array<float,2>{0.362988263f, 0.0505423769f},
-std::array<float,2>{0.771478891f, 0.219445571f},
-std::array<float,2>{0.470249206f, 0.515196502f},
-std::array<float,2>{0.624867558f, 0.925070524f},
-std::array<float,2>{0.209415734f, 0.344418466f},
-std::array<float,2>{0.601763844f, 0.202299148f},
-std::array<float,2>{0.192560926f, 0.554545105f},
-std::array<float,2>{0.754465401f, 0.900979161f},
-std::array<float,2>{0.489814311f, 0.336667597f},
-std::array<float,2>{0.887578249f, 0.403006762f},
-std::array<float,2>{0.343758285f, 0.776561201f},
-std::array<float,2>{0.72618556f, 0.642806351f},
-std::array<float,2>{0.11597845f, 0.0141437482f},
-std::array<float,2>{0.640768945f, 0.290260226f},
-std::array<float,2>{0.0129164364f, 0.964833498f},
-std::array<float,2>{0.955225348f, 0.5918383f},
-std::array<float,2>{0.284247965f, 0.148307741f},
-std::array<float,2>{0.853700757f, 0.100442208f},
-std::array<float,2>{0.388816655f, 0.717767894f},
-std::array<float,2>{0.525040269f, 0.83953011f},
-std::array<float,2>{0.160750836f, 0.446252227f},
-std::array<float,2>{0.689329982f, 0.0438062027f},
-std::array<float,2>{0.0766237602f, 0.675012887f},
-std::array<float,2>{0.92135632f, 0.80256927f},
-std::array<float,2>{0.336633176f, 0.41233471f},
-std::array<float,2>{0.795975387f, 0.362735361f},
-std::array<float,2>{0.454981625f, 0.908424735f},
-std::array<float,2>{0.593129575f, 0.5265764f},
-std::array<float,2>{0.249128357f, 0.23915188f},
-std::array<float,2>{0.535424888f, 0.47169894f},
-std::array<float,2>{0.15361549f, 0.848987758f},
-std::array<float,2>{0.839465618f, 0.747017443f},
-std::array<float,2>{0.420626551f, 0.0770557821f},
-std::array<float,2>{0.98735708f, 0.167490348f},
-std::array<float,2>{0.266800702f, 0.595525682f},
-std::array<float,2>{0.681932151f, 0.994989991f},
-std::array<float,2>{0.0332529917f, 0.268212795f},
-std::array<float,2>{0.678308606f, 0.224632457f},
-std::array<float,2>{0.0454518571f, 0.510835171f},
-std::array<float,2>{0.999687672f, 0.926439285f},
-std::array<float,2>{0.278899014f, 0.350948364f},
-std::array<float,2>{0.834341526f, 0.433786213f},
-std::array<float,2>{0.411890358f, 0.782535076f},
-std::array<float,2>{0.543456316f, 0.668051243f},
-std::array<float,2>{0.142987072f, 0.0520122349f},
-std::array<float,2>{0.580841184f, 0.264060318f},
-std::array<float,2>{0.241103068f, 0.982966065f},
-std::array<float,2>{0.784635544f, 0.610009193f},
-std::array<float,2>{0.466373682f, 0.175766408f},
-std::array<float,2>{0.913134098f, 0.0822988451f},
-std::array<float,2>{0.328869164f, 0.724522293f},
-std::array<float,2>{0.70269078f, 0.871641159f},
-std::array<float,2>{0.0698093995f, 0.498072088f},
-std::array<float,2>{0.51737386f, 0.0259376559f},
-std::array<float,2>{0.166742042f, 0.628464401f},
-std::array<float,2>{0.847962797f, 0.758969486f},
-std::array<float,2>{0.376152635f, 0.379622906f},
-std::array<float,2>{0.964800715f, 0.315456837f},
-std::array<float,2>{0.295918465f, 0.890401363f},
-std::array<float,2>{0.650985837f, 0.544973433f},
-std::array<float,2>{0.00733782863f, 0.206684574f},
-std::array<float,2>{0.732789695f, 0.454139769f},
-std::array<float,2>{0.123924322f, 0.817480087f},
-std::array<float,2>{0.879058242f, 0.696132362f},
-std::array<float,2>{0.357589781f, 0.116582721f},
-std::array<float,2>{0.760631084f, 0.133316457f},
-std::array<float,2>{0.495166063f, 0.567474842f},
-std::array<float,2>{0.598012149f, 0.945196927f},
-std::array<float,2>{0.198230863f, 0.307323873f},
-std::array<float,2>{0.613832533f, 0.169889435f},
-std::array<float,2>{0.214547083f, 0.597734869f},
-std::array<float,2>{0.775684595f, 0.99902463f},
-std::array<float,2>{0.482527912f, 0.271128953f},
-std::array<float,2>{0.898630679f, 0.475890726f},
-std::array<float,2>{0.370310366f, 0.844237328f},
-std::array<float,2>{0.744565487f, 0.742866457f},
-std::array<float,2>{0.0994328037f, 0.0717823729f},
-std::array<float,2>{0.627934694f, 0.366399914f},
-std::array<float,2>{0.0245935749f, 0.910838544f},
-std::array<float,2>{0.946844459f, 0.527810335f},
-std::array<float,2>{0.308149129f, 0.236341208f},
-std::array<float,2>{0.868198395f, 0.0429136194f},
-std::array<float,2>{0.402398765f, 0.679686606f},
-std::array<float,2>{0.511755049f, 0.79906559f},
-std::array<float,2>{0.177925006f, 0.406334519f},
-std::array<float,2>{0.704313576f, 0.0965744555f},
-std::array<float,2>{0.0802850276f, 0.712520719f},
-std::array<float,2>{0.935945034f, 0.843721449f},
-std::array<float,2>{0.318301529f, 0.451250106f},
-std::array<float,2>{0.8024894f, 0.295719832f},
-std::array<float,2>{0.44595179f, 0.967417479f},
-std::array<float,2>{0.572671413f, 0.587909639f},
-std::array<float,2>{0.224914119f, 0.14408192f},
-std::array<float,2>{0.559684455f, 0.401681155f},
-std::array<float,2>{0.131928444f, 0.779753506f},
-std::array<float,2>{0.821360409f, 0.647690952f},
-std::array<float,2>{0.424406916f, 0.0108945528f},
-std::array<float,2>{0.97963661f, 0.198672831f},
-std::array<float,2>{0.259331405f, 0.547277272f},
-std::array<float,2>{0.668418407f, 0.902844787f},
-std::array<float,2>{0.0494763739f, 0.339930892f},
-std::array<float,2>{0.741254687f, 0.151747584f},
-std::array<float,2>{0.103827961f, 0.581531942f},
-std::array<float,2>{0.896016777f, 0.960177064f},
-std::array<float,2>{0.365103215f, 0.288109303f},
-std::array<float,2>{0.766614556f, 0.43870303f},
-std::array<float,2>{0.473695099f, 0.831438899f},
-std::array<float,2>{0.61902684f, 0.705402017f},
-std::array<float,2>{0.207020342f, 0.106286511f},
-std::array<float,2>{0.502323568f, 0.332452953f},
-std::array<float,2>{0.185672566f, 0.893401623f},
-std::array<float,2>{0.861676753f, 0.559545398f},
-std::array<float,2>{0.396280557f, 0.193328649f},
-std::array<float,2>{0.939829469f, 0.00408595288f},
-std::array<float,2>{0.303971797f, 0.652451575f},
-std::array<float,2>{0.634293556f, 0.767807126f},
-std::array<float,2>{0.0211668368f, 0.392161846f},
-std::array<float,2>{0.568897605f, 0.0658175126f},
-std::array<float,2>{0.229357898f, 0.735097766f},
-std::array<float,2>{0.805730522f, 0.855096459f},
-std::array<float,2>{0.439758837f, 0.480460078f},
-std::array<float,2>{0.927306414f, 0.273672193f},
-std::array<float,2>{0.32654056f, 0.988080084f},
-std::array<float,2>{0.716138721f, 0.602513909f},
-std::array<float,2>{0.0869906247f, 0.162959456f},
-std::array<float,2>{0.658457816f, 0.414391637f},
-std::array<float,2>{0.0593734048f, 0.80617553f},
-std::array<float,2>{0.971507311f, 0.686309993f},
-std::array<float,2>{0.251970768f, 0.0328030251f},
-std::array<float,2>{0.815968335f, 0.244612455f},
-std::array<float,2>{0.431340426f, 0.517546177f},
-std::array<float,2>{0.552552342f, 0.917563438f},
-std::array<float,2>{0.135971487f, 0.371575058f},
-std::array<float,2>{0.531894505f, 0.21410349f},
-std::array<float,2>{0.149673462f, 0.531504989f},
-std::array<float,2>{0.842727482f, 0.880560279f},
-std::array<float,2>{0.416587472f, 0.327509016f},
-std::array<float,2>{0.989743471f, 0.390484452f},
-std::array<float,2>{0.272883773f, 0.751487434f},
-std::array<float,2>{0.68421942f, 0.634386361f},
-std::array<float,2>{0.0374096334f, 0.0187320262f},
-std::array<float,2>{0.694322646f, 0.301235795f},
-std::array<float,2>{0.0722244382f, 0.949423075f},
-std::array<float,2>{0.917674601f, 0.577067196f},
-std::array<float,2>{0.343482018f, 0.131718785f},
-std::array<float,2>{0.791894078f, 0.118022643f},
-std::array<float,2>{0.457554251f, 0.689875603f},
-std::array<float,2>{0.589732707f, 0.825881541f},
-std::array<float,2>{0.244885743f, 0.46274361f},
-std::array<float,2>{0.648013592f, 0.0592958778f},
-std::array<float,2>{0.00917598605f, 0.657015681f},
-std::array<float,2>{0.958741367f, 0.794864655f},
-std::array<float,2>{0.28605631f, 0.424072921f},
-std::array<float,2>{0.855605662f, 0.353340954f},
-std::array<float,2>{0.384475708f, 0.931399584f},
-std::array<float,2>{0.530028522f, 0.507073879f},
-std::array<float,2>{0.15870221f, 0.233434439f},
-std::array<float,2>{0.605772436f, 0.487311572f},
-std::array<float,2>{0.18954356f, 0.862389982f},
-std::array<float,2>{0.751848578f, 0.73237133f},
-std::array<float,2>{0.486213356f, 0.0899588242f},
-std::array<float,2>{0.883576691f, 0.180955827f},
-std::array<float,2>{0.348083019f, 0.619691789f},
-std::array<float,2>{0.721539557f, 0.976097107f},
-std::array<float,2>{0.112526029f, 0.255568832f},
-std::array<float,2>{0.69677943f, 0.187616542f},
-std::array<float,2>{0.0655602291f, 0.556535661f},
-std::array<float,2>{0.906524718f, 0.895169973f},
-std::array<float,2>{0.333333284f, 0.328313649f},
-std::array<float,2>{0.788993001f, 0.3964037f},
-std::array<float,2>{0.46258828f, 0.773407817f},
-std::array<float,2>{0.582516849f, 0.649627507f},
-std::array<float,2>{0.237537384f, 0.00228604674f},
-std::array<float,2>{0.54102695f, 0.283015281f},
-std::array<float,2>{0.14696005f, 0.954014003f},
-std::array<float,2>{0.831991196f, 0.584677875f},
-std::array<float,2>{0.407372415f, 0.154079512f},
-std::array<float,2>{0.993045211f, 0.102711469f},
-std::array<float,2>{0.274810046f, 0.709617317f},
-std::array<float,2>{0.675540864f, 0.833864093f},
-std::array<float,2>{0.0422546528f, 0.441930592f},
-std::array<float,2>{0.596303403f, 0.0379755981f},
-std::array<float,2>{0.202850193f, 0.681783795f},
-std::array<float,2>{0.763006747f, 0.810517192f},
-std::array<float,2>{0.497234404f, 0.421643347f},
-std::array<float,2>{0.875366092f, 0.367578864f},
-std::array<float,2>{0.352249444f, 0.918878973f},
-std::array<float,2>{0.728333831f, 0.52115041f},
-std::array<float,2>{0.121001273f, 0.246397749f},
-std::array<float,2>{0.653152287f, 0.481142133f},
-std::array<float,2>{0.00353347301f, 0.857388973f},
-std::array<float,2>{0.967447221f, 0.742127836f},
-std::array<float,2>{0.291908383f, 0.0675599054f},
-std::array<float,2>{0.847541451f, 0.158198059f},
-std::array<float,2>{0.38066715f, 0.608986259f},
-std::array<float,2>{0.521567941f, 0.99045521f},
-std::array<float,2>{0.168561488f, 0.280087024f},
-std::array<float,2>{0.508471072f, 0.126806408f},
-std::array<float,2>{0.173636258f, 0.570400238f},
-std::array<float,2>{0.874708056f, 0.948247075f},
-std::array<float,2>{0.402031869f, 0.300172508f},
-std::array<float,2>{0.949931741f, 0.4664478f},
-std::array<float,2>{0.312325627f, 0.822454393f},
-std::array<float,2>{0.632584214f, 0.694930255f},
-std::array<float,2>{0.0310714375f, 0.122194678f},
-std::array<float,2>{0.747464895f, 0.322449267f},
-std::array<float,2>{0.0969225094f, 0.875362933f},
-std::array<float,2>{0.903012037f, 0.538711905f},
-std::array<float,2>{0.373177439f, 0.215728596f},
-std::array<float,2>{0.779194057f, 0.0227708463f},
-std::array<float,2>{0.476941854f, 0.63899368f},
-std::array<float,2>{0.610602379f, 0.756779671f},
-std::array<float,2>{0.218113154f, 0.383904904f},
-std::array<float,2>{0.66733402f, 0.0862287208f},
-std::array<float,2>{0.0515568405f, 0.72871834f},
-std::array<float,2>{0.983839393f, 0.863446712f},
-std::array<float,2>{0.265238464f, 0.490788937f},
-std::array<float,2>{0.827156067f, 0.250187755f},
-std::array<float,2>{0.426275879f, 0.970754087f},
-std::array<float,2>{0.554935455f, 0.622949481f},
-std::array<float,2>{0.127991751f, 0.186152384f},
-std::array<float,2>{0.574630916f, 0.428350389f},
-std::array<float,2>{0.221448541f, 0.792114615f},
-std::array<float,2>{0.799250424f, 0.661258519f},
-std::array<float,2>{0.45148614f, 0.0583194643f},
-std::array<float,2>{0.929904342f, 0.226672247f},
-std::array<float,2>{0.315774292f, 0.501230597f},
-std::array<float,2>{0.70884037f, 0.93430084f},
-std::array<float,2>{0.0854014233f, 0.355748564f},
-std::array<float,2>{0.637919903f, 0.176118046f},
-std::array<float,2>{0.0176158473f, 0.61547482f},
-std::array<float,2>{0.942961872f, 0.977218688f},
-std::array<float,2>{0.297011971f, 0.26069361f},
-std::array<float,2>{0.866942048f, 0.493563026f},
-std::array<float,2>{0.390917242f, 0.868460119f},
-std::array<float,2>{0.50732857f, 0.721158504f},
-std::array<float,2>{0.181252852f, 0.0785902664f},
-std::array<float,2>{0.622053087f, 0.347566336f},
-std::array<float,2>{0.207376465f, 0.923482299f},
-std::array<float,2>{0.772230864f, 0.513224065f},
-std::array<float,2>{0.470864087f, 0.220703661f},
-std::array<float,2>{0.892103136f, 0.0482179597f},
-std::array<float,2>{0.360333532f, 0.666953564f},
-std::array<float,2>{0.735628843f, 0.786678076f},
-std::array<float,2>{0.109014913f, 0.432035357f},
-std::array<float,2>{0.549578726f, 0.110663459f},
-std::array<float,2>{0.139003381f, 0.700791955f},
-std::array<float,2>{0.816768229f, 0.815649867f},
-std::array<float,2>{0.434253961f, 0.458244503f},
-std::array<float,2>{0.973267555f, 0.308736831f},
-std::array<float,2>{0.25549832f, 0.940514028f},
-std::array<float,2>{0.662610531f, 0.563534439f},
-std::array<float,2>{0.0559154637f, 0.138546497f},
-std::array<float,2>{0.712888896f, 0.375695318f},
-std::array<float,2>{0.0915152356f, 0.762971878f},
-std::array<float,2>{0.924891293f, 0.632560432f},
-std::array<float,2>{0.320607454f, 0.028107537f},
-std::array<float,2>{0.81080091f, 0.210756749f},
-std::array<float,2>{0.445014447f, 0.541981757f},
-std::array<float,2>{0.565784693f, 0.883224189f},
-std::array<float,2>{0.23303251f, 0.317574382f},
-std::array<float,2>{0.590828478f, 0.24071677f},
-std::array<float,2>{0.246408001f, 0.524525642f},
-std::array<float,2>{0.793341279f, 0.907533169f},
-std::array<float,2>{0.456265152f, 0.360745966f},
-std::array<float,2>{0.918862104f, 0.411171436f},
-std::array<float,2>{0.339234024f, 0.804207683f},
-std::array<float,2>{0.691087484f, 0.672734499f},
-std::array<float,2>{0.0744250938f, 0.0458558239f},
-std::array<float,2>{0.680730879f, 0.266525954f},
-std::array<float,2>{0.0313549004f, 0.992528558f},
-std::array<float,2>{0.985846102f, 0.597148895f},
-std::array<float,2>{0.268955857f, 0.166010842f},
-std::array<float,2>{0.837569118f, 0.075179778f},
-std::array<float,2>{0.418672532f, 0.749726951f},
-std::array<float,2>{0.538413763f, 0.850639284f},
-std::array<float,2>{0.154758409f, 0.46937716f},
-std::array<float,2>{0.724336565f, 0.0121647194f},
-std::array<float,2>{0.114036985f, 0.64077723f},
-std::array<float,2>{0.889635265f, 0.774198592f},
-std::array<float,2>{0.346280724f, 0.404764026f},
-std::array<float,2>{0.756685793f, 0.339632481f},
-std::array<float,2>{0.490887493f, 0.899379253f},
-std::array<float,2>{0.604222357f, 0.552053452f},
-std::array<float,2>{0.193513915f, 0.199902073f},
-std::array<float,2>{0.526945293f, 0.448821187f},
-std::array<float,2>{0.163018271f, 0.837584496f},
-std::array<float,2>{0.853453934f, 0.715689063f},
-std::array<float,2>{0.388596654f, 0.0978413299f},
-std::array<float,2>{0.954473436f, 0.146177649f},
-std::array<float,2>{0.282531768f, 0.591700137f},
-std::array<float,2>{0.642691553f, 0.962090135f},
-std::array<float,2>{0.0142733371f, 0.291129559f},
-std::array<float,2>{0.669397295f, 0.195840359f},
-std::array<float,2>{0.0501553193f, 0.549233794f},
-std::array<float,2>{0.979429841f, 0.906172037f},
-std::array<float,2>{0.2579723f, 0.342547715f},
-std::array<float,2>{0.820483387f, 0.398818046f},
-std::array<float,2>{0.425034046f, 0.779260933f},
-std::array<float,2>{0.558927f, 0.645649433f},
-std::array<float,2>{0.131294802f, 0.00842550583f},
-std::array<float,2>{0.57416147f, 0.294541746f},
-std::array<float,2>{0.225813568f, 0.96648246f},
-std::array<float,2>{0.801006913f, 0.587816656f},
-std::array<float,2>{0.447149336f, 0.142420307f},
-std::array<float,2>{0.937300742f, 0.0940346941f},
-std::array<float,2>{0.316889346f, 0.713544726f},
-std::array<float,2>{0.703581631f, 0.840569794f},
-std::array<float,2>{0.081276536f, 0.450312793f},
-std::array<float,2>{0.513535082f, 0.040915329f},
-std::array<float,2>{0.178934634f, 0.677517772f},
-std::array<float,2>{0.8681072f, 0.79832828f},
-std::array<float,2>{0.403345793f, 0.408750862f},
-std::array<float,2>{0.946171701f, 0.3633793f},
-std::array<float,2>{0.306723624f, 0.91384244f},
-std::array<float,2>{0.627073467f, 0.530255616f},
-std::array<float,2>{0.0236737411f, 0.235393286f},
-std::array<float,2>{0.7458933f, 0.473969251f},
-std::array<float,2>{0.0984710231f, 0.846343637f},
-std::array<float,2>{0.89984107f, 0.744770944f},
-std::array<float,2>{0.369183421f, 0.0726816878f},
-std::array<float,2>{0.777124763f, 0.171759143f},
-std::array<float,2>{0.48434338f, 0.601277232f},
-std::array<float,2>{0.615007341f, 0.997285426f},
-std::array<float,2>{0.213446006f, 0.272510499f},
-std::array<float,2>{0.599072397f, 0.135229632f},
-std::array<float,2>{0.199218035f, 0.569683492f},
-std::array<float,2>{0.760864019f, 0.942660987f},
-std::array<float,2>{0.494974166f, 0.305877209f},
-std::array<float,2>{0.879919291f, 0.455695093f},
-std::array<float,2>{0.358706236f, 0.819440007f},
-std::array<float,2>{0.733982325f, 0.698455215f},
-std::array<float,2>{0.12454246f, 0.114893101f},
-std::array<float,2>{0.652042329f, 0.313254446f},
-std::array<float,2>{0.00631908979f, 0.888358414f},
-std::array<float,2>{0.963435471f, 0.544450343f},
-std::array<float,2>{0.295886755f, 0.204165012f},
-std::array<float,2>{0.848663926f, 0.0246778056f},
-std::array<float,2>{0.375657558f, 0.626936853f},
-std::array<float,2>{0.516601026f, 0.761363387f},
-std::array<float,2>{0.167549938f, 0.382371604f},
-std::array<float,2>{0.701415539f, 0.0855698436f},
-std::array<float,2>{0.0689545646f, 0.724623382f},
-std::array<float,2>{0.91226989f, 0.873385251f},
-std::array<float,2>{0.329710007f, 0.496397853f},
-std::array<float,2>{0.78401494f, 0.262833983f},
-std::array<float,2>{0.464928985f, 0.981002748f},
-std::array<float,2>{0.58158654f, 0.612710774f},
-std::array<float,2>{0.242137283f, 0.173599243f},
-std::array<float,2>{0.544222414f, 0.436755866f},
-std::array<float,2>{0.143573359f, 0.784202993f},
-std::array<float,2>{0.835801244f, 0.671007216f},
-std::array<float,2>{0.410558939f, 0.0531089082f},
-std::array<float,2>{0.998951137f, 0.223859876f},
-std::array<float,2>{0.27809301f, 0.509227931f},
-std::array<float,2>{0.679501534f, 0.928153872f},
-std::array<float,2>{0.0464080647f, 0.348259926f},
-std::array<float,2>{0.722502947f, 0.183190078f},
-std::array<float,2>{0.111726321f, 0.617875636f},
-std::array<float,2>{0.884248018f, 0.972837865f},
-std::array<float,2>{0.349079728f, 0.257245213f},
-std::array<float,2>{0.750389993f, 0.4853203f},
-std::array<float,2>{0.484936625f, 0.861164927f},
-std::array<float,2>{0.606594622f, 0.732644022f},
-std::array<float,2>{0.190797776f, 0.0925836042f},
-std::array<float,2>{0.530336201f, 0.353564203f},
-std::array<float,2>{0.159804001f, 0.93357563f},
-std::array<float,2>{0.857379198f, 0.50462842f},
-std::array<float,2>{0.383480519f, 0.231626868f},
-std::array<float,2>{0.957526505f, 0.0612346232f},
-std::array<float,2>{0.286552578f, 0.659859478f},
-std::array<float,2>{0.647031903f, 0.795949161f},
-std::array<float,2>{0.00842342339f, 0.42302078f},
-std::array<float,2>{0.588597357f, 0.120855339f},
-std::array<float,2>{0.245305181f, 0.688144505f},
-std::array<float,2>{0.792518854f, 0.827973068f},
-std::array<float,2>{0.458541989f, 0.463309139f},
-std::array<float,2>{0.91627264f, 0.303103566f},
-std::array<float,2>{0.342206806f, 0.952701151f},
-std::array<float,2>{0.694401801f, 0.575436652f},
-std::array<float,2>{0.0704045743f, 0.128987089f},
-std::array<float,2>{0.685223579f, 0.388614625f},
-std::array<float,2>{0.0383336283f, 0.752968013f},
-std::array<float,2>{0.988970399f, 0.636166334f},
-std::array<float,2>{0.272352815f, 0.0173921455f},
-std::array<float,2>{0.843278766f, 0.212869883f},
-std::array<float,2>{0.417321146f, 0.533868849f},
-std::array<float,2>{0.532267034f, 0.88171196f},
-std::array<float,2>{0.148697987f, 0.325721622f},
-std::array<float,2>{0.55111146f, 0.243387729f},
-std::array<float,2>{0.135468587f, 0.51765573f},
-std::array<float,2>{0.815115511f, 0.91456598f},
-std::array<float,2>{0.429891378f, 0.374938369f},
-std::array<float,2>{0.972260237f, 0.417274088f},
-std::array<float,2>{0.252961665f, 0.808375359f},
-std::array<float,2>{0.659777164f, 0.683684349f},
-std::array<float,2>{0.0598350056f, 0.0348649956f},
-std::array<float,2>{0.71578145f, 0.276032567f},
-std::array<float,2>{0.0861433893f, 0.984799266f},
-std::array<float,2>{0.926336944f, 0.604593039f},
-std::array<float,2>{0.327204406f, 0.160857305f},
-std::array<float,2>{0.805124462f, 0.0640815943f},
-std::array<float,2>{0.440822035f, 0.737060249f},
-std::array<float,2>{0.57015264f, 0.851652384f},
-std::array<float,2>{0.229704335f, 0.476677477f},
-std::array<float,2>{0.633558452f, 0.00772312563f},
-std::array<float,2>{0.019908376f, 0.6546821f},
-std::array<float,2>{0.940867543f, 0.76727128f},
-std::array<float,2>{0.303141475f, 0.393942595f},
-std::array<float,2>{0.863194764f, 0.334963292f},
-std::array<float,2>{0.394803584f, 0.891010284f},
-std::array<float,2>{0.503831029f, 0.561244726f},
-std::array<float,2>{0.186876625f, 0.195251837f},
-std::array<float,2>{0.617209554f, 0.440353215f},
-std::array<float,2>{0.205441028f, 0.828998804f},
-std::array<float,2>{0.766340971f, 0.704508543f},
-std::array<float,2>{0.473150402f, 0.108327016f},
-std::array<float,2>{0.894869804f, 0.148441613f},
-std::array<float,2>{0.363672435f, 0.579558015f},
-std::array<float,2>{0.740478039f, 0.958438516f},
-std::array<float,2>{0.10525047f, 0.285273552f},
-std::array<float,2>{0.707170844f, 0.229160458f},
-std::array<float,2>{0.0844514519f, 0.503634751f},
-std::array<float,2>{0.931571126f, 0.937071621f},
-std::array<float,2>{0.314702481f, 0.358221173f},
-std::array<float,2>{0.799829245f, 0.427530646f},
-std::array<float,2>{0.453100145f, 0.789626002f},
-std::array<float,2>{0.575631499f, 0.663828075f},
-std::array<float,2>{0.222600028f, 0.0564871058f},
-std::array<float,2>{0.55660969f, 0.252628446f},
-std::array<float,2>{0.127434447f, 0.970549762f},
-std::array<float,2>{0.826458871f, 0.624350309f},
-std::array<float,2>{0.426886111f, 0.185389578f},
-std::array<float,2>{0.98282522f, 0.0881265402f},
-std::array<float,2>{0.264421016f, 0.728410482f},
-std::array<float,2>{0.666784704f, 0.866898298f},
-std::array<float,2>{0.0525871739f, 0.488315284f},
-std::array<float,2>{0.609520853f, 0.0209389348f},
-std::array<float,2>{0.216843963f, 0.638409555f},
-std::array<float,2>{0.777373254f, 0.754765391f},
-std::array<float,2>{0.478328735f, 0.385578543f},
-std::array<float,2>{0.904006243f, 0.321789265f},
-std::array<float,2>{0.374164999f, 0.878360987f},
-std::array<float,2>{0.746578097f, 0.535603166f},
-std::array<float,2>{0.0960164592f, 0.217594877f},
-std::array<float,2>{0.631801724f, 0.467936724f},
-std::array<float,2>{0.0301941745f, 0.820390224f},
-std::array<float,2>{0.950466573f, 0.693132102f},
-std::array<float,2>{0.310682118f, 0.124380879f},
-std::array<float,2>{0.873514056f, 0.127771467f},
-std::array<float,2>{0.401221097f, 0.57401067f},
-std::array<float,2>{0.509544551f, 0.946875274f},
-std::array<float,2>{0.172581121f, 0.298593223f},
-std::array<float,2>{0.522482216f, 0.159384966f},
-std::array<float,2>{0.169812173f, 0.607160985f},
-std::array<float,2>{0.846614838f, 0.98874855f},
-std::array<float,2>{0.379551113f, 0.278276116f},
-std::array<float,2>{0.96787715f, 0.484095901f},
-std::array<float,2>{0.292781621f, 0.858390093f},
-std::array<float,2>{0.653486073f, 0.740005195f},
-std::array<float,2>{0.00214010943f, 0.0695354268f},
-std::array<float,2>{0.726733208f, 0.369516253f},
-std::array<float,2>{0.119675674f, 0.920257211f},
-std::array<float,2>{0.876428962f, 0.523283958f},
-std::array<float,2>{0.353230059f, 0.248164505f},
-std::array<float,2>{0.761792302f, 0.0357850529f},
-std::array<float,2>{0.496451378f, 0.679748952f},
-std::array<float,2>{0.597364724f, 0.810598552f},
-std::array<float,2>{0.20199199f, 0.419831991f},
-std::array<float,2>{0.674636126f, 0.104815453f},
-std::array<float,2>{0.041053921f, 0.707629383f},
-std::array<float,2>{0.993995905f, 0.835562646f},
-std::array<float,2>{0.274272919f, 0.443586886f},
-std::array<float,2>{0.830310225f, 0.284618139f},
-std::array<float,2>{0.406315178f, 0.955332279f},
-std::array<float,2>{0.542676926f, 0.58372128f},
-std::array<float,2>{0.14802146f, 0.15559566f},
-std::array<float,2>{0.583971918f, 0.396692544f},
-std::array<float,2>{0.237185329f, 0.77056551f},
-std::array<float,2>{0.787403524f, 0.651504219f},
-std::array<float,2>{0.46143961f, 0.00178522465f},
-std::array<float,2>{0.908043146f, 0.191081718f},
-std::array<float,2>{0.332161248f, 0.556735098f},
-std::array<float,2>{0.695485651f, 0.896550059f},
-std::array<float,2>{0.0646010116f, 0.330184549f},
-std::array<float,2>{0.644239604f, 0.14686501f},
-std::array<float,2>{0.0152040757f, 0.59330672f},
-std::array<float,2>{0.953146756f, 0.962949991f},
-std::array<float,2>{0.281732321f, 0.289897323f},
-std::array<float,2>{0.852247536f, 0.446340948f},
-std::array<float,2>{0.387457281f, 0.838662207f},
-std::array<float,2>{0.526212335f, 0.718549609f},
-std::array<float,2>{0.163099021f, 0.101255491f},
-std::array<float,2>{0.604893982f, 0.337060064f},
-std::array<float,2>{0.194387972f, 0.901398301f},
-std::array<float,2>{0.757142246f, 0.553108394f},
-std::array<float,2>{0.491402328f, 0.201757565f},
-std::array<float,2>{0.890226543f, 0.0147430785f},
-std::array<float,2>{0.346849382f, 0.644032776f},
-std::array<float,2>{0.722923577f, 0.775484622f},
-std::array<float,2>{0.114720397f, 0.403743714f},
-std::array<float,2>{0.537491202f, 0.078047514f},
-std::array<float,2>{0.156216457f, 0.747106314f},
-std::array<float,2>{0.836868584f, 0.848393619f},
-std::array<float,2>{0.419802755f, 0.471111387f},
-std::array<float,2>{0.984520197f, 0.268772751f},
-std::array<float,2>{0.268049508f, 0.996052206f},
-std::array<float,2>{0.680462182f, 0.594268203f},
-std::array<float,2>{0.0325247459f, 0.16631113f},
-std::array<float,2>{0.689705789f, 0.413389802f},
-std::array<float,2>{0.0760979801f, 0.801285863f},
-std::array<float,2>{0.919462264f, 0.674117863f},
-std::array<float,2>{0.338597894f, 0.0440794379f},
-std::array<float,2>{0.794594646f, 0.239338085f},
-std::array<float,2>{0.455115139f, 0.525641918f},
-std::array<float,2>{0.590605378f, 0.909836054f},
-std::array<float,2>{0.24762693f, 0.361912936f},
-std::array<float,2>{0.564574897f, 0.208798289f},
-std::array<float,2>{0.233584613f, 0.540112376f},
-std::array<float,2>{0.812305987f, 0.885074615f},
-std::array<float,2>{0.444290012f, 0.320299089f},
-std::array<float,2>{0.924061239f, 0.378356814f},
-std::array<float,2>{0.322251886f, 0.765063882f},
-std::array<float,2>{0.711447477f, 0.630544722f},
-std::array<float,2>{0.0903230086f, 0.0308982134f},
-std::array<float,2>{0.664019704f, 0.311034709f},
-std::array<float,2>{0.0552322045f, 0.93769592f},
-std::array<float,2>{0.974166155f, 0.565995276f},
-std::array<float,2>{0.254685432f, 0.139091358f},
-std::array<float,2>{0.817744732f, 0.112630002f},
-std::array<float,2>{0.434670091f, 0.7019279f},
-std::array<float,2>{0.550730526f, 0.812564492f},
-std::array<float,2>{0.140322566f, 0.459973216f},
-std::array<float,2>{0.735075831f, 0.0489723794f},
-std::array<float,2>{0.108282603f, 0.665434659f},
-std::array<float,2>{0.890962422f, 0.787768841f},
-std::array<float,2>{0.361250818f, 0.431333214f},
-std::array<float,2>{0.772869945f, 0.345271587f},
-std::array<float,2>{0.472361594f, 0.924102306f},
-std::array<float,2>{0.622093916f, 0.514261782f},
-std::array<float,2>{0.208811402f, 0.220507234f},
-std::array<float,2>{0.505892634f, 0.495129496f},
-std::array<float,2>{0.179879189f, 0.869618297f},
-std::array<float,2>{0.865239918f, 0.719239712f},
-std::array<float,2>{0.392211735f, 0.0803256556f},
-std::array<float,2>{0.942314446f, 0.178479195f},
-std::array<float,2>{0.298074514f, 0.615042984f},
-std::array<float,2>{0.637323737f, 0.979559124f},
-std::array<float,2>{0.0189964455f, 0.258178353f},
-std::array<float,2>{0.625346065f, 0.237534463f},
-std::array<float,2>{0.0254476555f, 0.528533876f},
-std::array<float,2>{0.948129416f, 0.911780238f},
-std::array<float,2>{0.305254102f, 0.366016895f},
-std::array<float,2>{0.869210541f, 0.407896638f},
-std::array<float,2>{0.406185895f, 0.800666094f},
-std::array<float,2>{0.515168607f, 0.678233206f},
-std::array<float,2>{0.177026719f, 0.0419842787f},
-std::array<float,2>{0.616379499f, 0.269531488f},
-std::array<float,2>{0.211839974f, 0.998956561f},
-std::array<float,2>{0.774497986f, 0.59927696f},
-std::array<float,2>{0.481989503f, 0.168502405f},
-std::array<float,2>{0.901017666f, 0.0709943548f},
-std::array<float,2>{0.367845058f, 0.74352169f},
-std::array<float,2>{0.744046211f, 0.844846487f},
-std::array<float,2>{0.101088226f, 0.474712789f},
-std::array<float,2>{0.561049163f, 0.0100394618f},
-std::array<float,2>{0.130539179f, 0.646679163f},
-std::array<float,2>{0.824157953f, 0.781086922f},
-std::array<float,2>{0.422510147f, 0.400998861f},
-std::array<float,2>{0.978407741f, 0.341550916f},
-std::array<float,2>{0.259806335f, 0.904134035f},
-std::array<float,2>{0.670731127f, 0.548653305f},
-std::array<float,2>{0.0482923053f, 0.197619304f},
-std::array<float,2>{0.706320643f, 0.452777028f},
-std::array<float,2>{0.0798634291f, 0.842442691f},
-std::array<float,2>{0.935377955f, 0.711796641f},
-std::array<float,2>{0.320270538f, 0.0969863459f},
-std::array<float,2>{0.803489268f, 0.143263027f},
-std::array<float,2>{0.447831243f, 0.58936578f},
-std::array<float,2>{0.571055651f, 0.967947185f},
-std::array<float,2>{0.223020062f, 0.296764314f},
-std::array<float,2>{0.580003262f, 0.174077347f},
-std::array<float,2>{0.239961103f, 0.611135781f},
-std::array<float,2>{0.781889021f, 0.983412683f},
-std::array<float,2>{0.468512267f, 0.264926463f},
-std::array<float,2>{0.911187828f, 0.499194443f},
-std::array<float,2>{0.331345052f, 0.87234813f},
-std::array<float,2>{0.699474275f, 0.722819924f},
-std::array<float,2>{0.0682076514f, 0.0830141529f},
-std::array<float,2>{0.677307248f, 0.349940628f},
-std::array<float,2>{0.0445366576f, 0.927339017f},
-std::array<float,2>{0.996338964f, 0.510289252f},
-std::array<float,2>{0.28070721f, 0.22559987f},
-std::array<float,2>{0.833036005f, 0.0514464565f},
-std::array<float,2>{0.41342172f, 0.669000566f},
-std::array<float,2>{0.545395315f, 0.781765461f},
-std::array<float,2>{0.142446175f, 0.435475141f},
-std::array<float,2>{0.732221901f, 0.115462154f},
-std::array<float,2>{0.122191966f, 0.696684778f},
-std::array<float,2>{0.880990565f, 0.817069471f},
-std::array<float,2>{0.356299102f, 0.453999341f},
-std::array<float,2>{0.759027541f, 0.307895154f},
-std::array<float,2>{0.494100034f, 0.94412142f},
-std::array<float,2>{0.601468682f, 0.567089081f},
-std::array<float,2>{0.195700556f, 0.134060293f},
-std::array<float,2>{0.518333554f, 0.38004458f},
-std::array<float,2>{0.165320337f, 0.758234501f},
-std::array<float,2>{0.851208448f, 0.627819896f},
-std::array<float,2>{0.378620505f, 0.0272110682f},
-std::array<float,2>{0.961577237f, 0.205265298f},
-std::array<float,2>{0.294854492f, 0.546756923f},
-std::array<float,2>{0.650087655f, 0.889371574f},
-std::array<float,2>{0.00562609825f, 0.314829409f},
-std::array<float,2>{0.692889869f, 0.132209674f},
-std::array<float,2>{0.0730447173f, 0.577963889f},
-std::array<float,2>{0.91470772f, 0.950300872f},
-std::array<float,2>{0.340117365f, 0.302221f},
-std::array<float,2>{0.789404035f, 0.461533815f},
-std::array<float,2>{0.460763991f, 0.824487627f},
-std::array<float,2>{0.587245107f, 0.690437555f},
-std::array<float,2>{0.242778644f, 0.119029902f},
-std::array<float,2>{0.534110785f, 0.327018291f},
-std::array<float,2>{0.150720641f, 0.87959969f},
-std::array<float,2>{0.840612411f, 0.532571912f},
-std::array<float,2>{0.415085256f, 0.212952986f},
-std::array<float,2>{0.990652621f, 0.0180138499f},
-std::array<float,2>{0.26978159f, 0.63375932f},
-std::array<float,2>{0.685891807f, 0.750053823f},
-std::array<float,2>{0.0360333361f, 0.389116526f},
-std::array<float,2>{0.60844928f, 0.09175881f},
-std::array<float,2>{0.187598243f, 0.730921328f},
-std::array<float,2>{0.752512813f, 0.861506104f},
-std::array<float,2>{0.487852186f, 0.486551821f},
-std::array<float,2>{0.886504591f, 0.254568458f},
-std::array<float,2>{0.350739986f, 0.975541532f},
-std::array<float,2>{0.720307946f, 0.620436609f},
-std::array<float,2>{0.109857939f, 0.180048883f},
-std::array<float,2>{0.645579159f, 0.424902827f},
-std::array<float,2>{0.0116811469f, 0.793528974f},
-std::array<float,2>{0.95956409f, 0.657403708f},
-std::array<float,2>{0.288650602f, 0.0604733452f},
-std::array<float,2>{0.858202934f, 0.232437283f},
-std::array<float,2>{0.385892302f, 0.506598473f},
-std::array<float,2>{0.52884233f, 0.930632472f},
-std::array<float,2>{0.156834736f, 0.351743847f},
-std::array<float,2>{0.500110865f, 0.191527531f},
-std::array<float,2>{0.183697611f, 0.560248911f},
-std::array<float,2>{0.860241413f, 0.893795311f},
-std::array<float,2>{0.397703677f, 0.333118886f},
-std::array<float,2>{0.937537611f, 0.39088729f},
-std::array<float,2>{0.301147908f, 0.76868242f},
-std::array<float,2>{0.636385202f, 0.65373832f},
-std::array<float,2>{0.0222809073f, 0.00528367655f},
-std::array<float,2>{0.738881946f, 0.288074523f},
-std::array<float,2>{0.10302119f, 0.959076464f},
-std::array<float,2>{0.897687376f, 0.580841959f},
-std::array<float,2>{0.366417259f, 0.151244491f},
-std::array<float,2>{0.76914835f, 0.107244395f},
-std::array<float,2>{0.474635661f, 0.706904292f},
-std::array<float,2>{0.620707273f, 0.830777466f},
-std::array<float,2>{0.203990802f, 0.438367158f},
-std::array<float,2>{0.657527387f, 0.032028161f},
-std::array<float,2>{0.0616212897f, 0.687231183f},
-std::array<float,2>{0.969855607f, 0.804793477f},
-std::array<float,2>{0.251314938f, 0.415520012f},
-std::array<float,2>{0.814153731f, 0.372257501f},
-std::array<float,2>{0.431981117f, 0.916277468f},
-std::array<float,2>{0.554104865f, 0.516450822f},
-std::array<float,2>{0.134643272f, 0.245125636f},
-std::array<float,2>{0.566687584f, 0.478792578f},
-std::array<float,2>{0.228150934f, 0.853703141f},
-std::array<float,2>{0.807182252f, 0.735974729f},
-std::array<float,2>{0.438697934f, 0.0646801442f},
-std::array<float,2>{0.92913878f, 0.163928613f},
-std::array<float,2>{0.324847966f, 0.60296464f},
-std::array<float,2>{0.717415392f, 0.987130463f},
-std::array<float,2>{0.0888090134f, 0.275348395f},
-std::array<float,2>{0.749675274f, 0.216627866f},
-std::array<float,2>{0.0949927941f, 0.538045824f},
-std::array<float,2>{0.905339062f, 0.876240909f},
-std::array<float,2>{0.371752679f, 0.323310673f},
-std::array<float,2>{0.779877424f, 0.383550376f},
-std::array<float,2>{0.480272919f, 0.757293344f},
-std::array<float,2>{0.611996651f, 0.640410781f},
-std::array<float,2>{0.216592655f, 0.0215353053f},
-std::array<float,2>{0.511374831f, 0.299333841f},
-std::array<float,2>{0.174556091f, 0.947551548f},
-std::array<float,2>{0.872956872f, 0.571672261f},
-std::array<float,2>{0.400062352f, 0.125741035f},
-std::array<float,2>{0.951368392f, 0.121735409f},
-std::array<float,2>{0.308962315f, 0.6935184f},
-std::array<float,2>{0.630359471f, 0.823868573f},
-std::array<float,2>{0.0286854319f, 0.465420395f},
-std::array<float,2>{0.577232122f, 0.0574529655f},
-std::array<float,2>{0.219411537f, 0.66043514f},
-std::array<float,2>{0.79789865f, 0.791619539f},
-std::array<float,2>{0.450609326f, 0.429346681f},
-std::array<float,2>{0.933424294f, 0.357394218f},
-std::array<float,2>{0.313868523f, 0.935075641f},
-std::array<float,2>{0.709730029f, 0.500800967f},
-std::array<float,2>{0.0831796005f, 0.227761805f},
-std::array<float,2>{0.66428256f, 0.49127382f},
-std::array<float,2>{0.0538528673f, 0.864358127f},
-std::array<float,2>{0.980812311f, 0.730149269f},
-std::array<float,2>{0.263173133f, 0.0872248635f},
-std::array<float,2>{0.824624002f, 0.186613053f},
-std::array<float,2>{0.427762181f, 0.621188402f},
-std::array<float,2>{0.557343841f, 0.971898437f},
-std::array<float,2>{0.126565754f, 0.251177669f},
-std::array<float,2>{0.539120972f, 0.152791694f},
-std::array<float,2>{0.146437898f, 0.585832417f},
-std::array<float,2>{0.830058336f, 0.954912841f},
-std::array<float,2>{0.409696281f, 0.281928062f},
-std::array<float,2>{0.995886445f, 0.443196654f},
-std::array<float,2>{0.275873423f, 0.832802951f},
-std::array<float,2>{0.672816455f, 0.710275471f},
-std::array<float,2>{0.0394309089f, 0.101954579f},
-std::array<float,2>{0.698629797f, 0.329235405f},
-std::array<float,2>{0.0629436374f, 0.895834625f},
-std::array<float,2>{0.908434987f, 0.554840744f},
-std::array<float,2>{0.334818244f, 0.18909131f},
-std::array<float,2>{0.786831975f, 0.00345125678f},
-std::array<float,2>{0.463840842f, 0.648637593f},
-std::array<float,2>{0.584871292f, 0.772360981f},
-std::array<float,2>{0.236238986f, 0.395443201f},
-std::array<float,2>{0.654376507f, 0.0666512772f},
-std::array<float,2>{0.00175819884f, 0.740514338f},
-std::array<float,2>{0.96645236f, 0.855719447f},
-std::array<float,2>{0.289999515f, 0.482021242f},
-std::array<float,2>{0.84377718f, 0.281229585f},
-std::array<float,2>{0.38166666f, 0.991563797f},
-std::array<float,2>{0.520824015f, 0.608087063f},
-std::array<float,2>{0.171579048f, 0.15663074f},
-std::array<float,2>{0.595676363f, 0.420876086f},
-std::array<float,2>{0.200811923f, 0.80906558f},
-std::array<float,2>{0.765007973f, 0.68319881f},
-std::array<float,2>{0.498551041f, 0.0384057947f},
-std::array<float,2>{0.877561331f, 0.247627944f},
-std::array<float,2>{0.353969127f, 0.519794345f},
-std::array<float,2>{0.729068875f, 0.919762015f},
-std::array<float,2>{0.117314935f, 0.368176311f},
-std::array<float,2>{0.683331013f, 0.164545953f},
-std::array<float,2>{0.0343370996f, 0.596471786f},
-std::array<float,2>{0.987005293f, 0.993993163f},
-std::array<float,2>{0.266311586f, 0.266814411f},
-std::array<float,2>{0.838659525f, 0.470668703f},
-std::array<float,2>{0.421155363f, 0.849638522f},
-std::array<float,2>{0.53642875f, 0.748088002f},
-std::array<float,2>{0.152707219f, 0.0757410377f},
-std::array<float,2>{0.591871321f, 0.359704167f},
-std::array<float,2>{0.248593315f, 0.907143772f},
-std::array<float,2>{0.79568696f, 0.523454249f},
-std::array<float,2>{0.453534812f, 0.241747111f},
-std::array<float,2>{0.92006582f, 0.0468082316f},
-std::array<float,2>{0.337011904f, 0.673609972f},
-std::array<float,2>{0.688160539f, 0.803594351f},
-std::array<float,2>{0.0772154108f, 0.410585076f},
-std::array<float,2>{0.524038494f, 0.0995653421f},
-std::array<float,2>{0.161411226f, 0.716502428f},
-std::array<float,2>{0.854780674f, 0.836378455f},
-std::array<float,2>{0.390005112f, 0.44758898f},
-std::array<float,2>{0.956596553f, 0.292063206f},
-std::array<float,2>{0.283484012f, 0.961475551f},
-std::array<float,2>{0.641709507f, 0.590670466f},
-std::array<float,2>{0.0125950957f, 0.144850269f},
-std::array<float,2>{0.724906981f, 0.405997425f},
-std::array<float,2>{0.116235912f, 0.774759471f},
-std::array<float,2>{0.888634205f, 0.642351329f},
-std::array<float,2>{0.344858795f, 0.0130179217f},
-std::array<float,2>{0.755403519f, 0.200822517f},
-std::array<float,2>{0.488692105f, 0.551322997f},
-std::array<float,2>{0.60291326f, 0.899843991f},
-std::array<float,2>{0.191826642f, 0.338819683f},
-std::array<float,2>{0.623101592f, 0.222006008f},
-std::array<float,2>{0.210324764f, 0.511812985f},
-std::array<float,2>{0.769996822f, 0.922303736f},
-std::array<float,2>{0.469069719f, 0.346156567f},
-std::array<float,2>{0.892794907f, 0.43345958f},
-std::array<float,2>{0.361392051f, 0.785235107f},
-std::array<float,2>{0.736426473f, 0.667342603f},
-std::array<float,2>{0.106453478f, 0.0472308248f},
-std::array<float,2>{0.639487803f, 0.260874748f},
-std::array<float,2>{0.0172213968f, 0.978338003f},
-std::array<float,2>{0.944794714f, 0.616501391f},
-std::array<float,2>{0.299874216f, 0.177252233f},
-std::array<float,2>{0.864383399f, 0.0793751925f},
-std::array<float,2>{0.393554926f, 0.722199976f},
-std::array<float,2>{0.505179882f, 0.867558777f},
-std::array<float,2>{0.182935089f, 0.492900848f},
-std::array<float,2>{0.71363616f, 0.0289771184f},
-std::array<float,2>{0.0935671628f, 0.631473422f},
-std::array<float,2>{0.922860503f, 0.762247205f},
-std::array<float,2>{0.323578954f, 0.376899064f},
-std::array<float,2>{0.809704185f, 0.31655699f},
-std::array<float,2>{0.442227483f, 0.884494126f},
-std::array<float,2>{0.564232707f, 0.542092383f},
-std::array<float,2>{0.232341662f, 0.20970434f},
-std::array<float,2>{0.547770023f, 0.457470685f},
-std::array<float,2>{0.13801755f, 0.814576626f},
-std::array<float,2>{0.820033073f, 0.69924593f},
-std::array<float,2>{0.436963171f, 0.109458059f},
-std::array<float,2>{0.976435781f, 0.13701649f},
-std::array<float,2>{0.25697726f, 0.563000262f},
-std::array<float,2>{0.660591185f, 0.940422475f},
-std::array<float,2>{0.0582865886f, 0.309697717f},
-std::array<float,2>{0.636098683f, 0.194605619f},
-std::array<float,2>{0.0214942135f, 0.560762942f},
-std::array<float,2>{0.938039839f, 0.891507804f},
-std::array<float,2>{0.301331162f, 0.335566252f},
-std::array<float,2>{0.859805346f, 0.394363075f},
-std::array<float,2>{0.398127258f, 0.767067611f},
-std::array<float,2>{0.500629127f, 0.654957533f},
-std::array<float,2>{0.184462532f, 0.00725377025f},
-std::array<float,2>{0.620406151f, 0.286037832f},
-std::array<float,2>{0.203273937f, 0.958560884f},
-std::array<float,2>{0.768661261f, 0.57989186f},
-std::array<float,2>{0.475387037f, 0.149173498f},
-std::array<float,2>{0.898292363f, 0.107848518f},
-std::array<float,2>{0.366999835f, 0.704639494f},
-std::array<float,2>{0.738730967f, 0.828522027f},
-std::array<float,2>{0.103047349f, 0.439736128f},
-std::array<float,2>{0.554319441f, 0.0343780592f},
-std::array<float,2>{0.134145483f, 0.684195101f},
-std::array<float,2>{0.813886464f, 0.807776392f},
-std::array<float,2>{0.432291627f, 0.417535394f},
-std::array<float,2>{0.970282674f, 0.37442103f},
-std::array<float,2>{0.251485884f, 0.914472222f},
-std::array<float,2>{0.657729566f, 0.518070281f},
-std::array<float,2>{0.0621658713f, 0.243889898f},
-std::array<float,2>{0.716880143f, 0.4773947f},
-std::array<float,2>{0.088030003f, 0.852271557f},
-std::array<float,2>{0.929497361f, 0.736426771f},
-std::array<float,2>{0.324614286f, 0.0639515817f},
-std::array<float,2>{0.806740403f, 0.160558954f},
-std::array<float,2>{0.439261824f, 0.605152249f},
-std::array<float,2>{0.567344725f, 0.984866023f},
-std::array<float,2>{0.227830648f, 0.275642842f},
-std::array<float,2>{0.587526023f, 0.129816249f},
-std::array<float,2>{0.242215514f, 0.576002419f},
-std::array<float,2>{0.790030241f, 0.952443361f},
-std::array<float,2>{0.460304737f, 0.303399265f},
-std::array<float,2>{0.914170027f, 0.463563353f},
-std::array<float,2>{0.340420008f, 0.827400804f},
-std::array<float,2>{0.692583144f, 0.687528431f},
-std::array<float,2>{0.0724836737f, 0.120574854f},
-std::array<float,2>{0.686155915f, 0.325631887f},
-std::array<float,2>{0.0352440327f, 0.881084144f},
-std::array<float,2>{0.990958333f, 0.533441782f},
-std::array<float,2>{0.270436227f, 0.212242454f},
-std::array<float,2>{0.840085447f, 0.0167118888f},
-std::array<float,2>{0.415656567f, 0.636373103f},
-std::array<float,2>{0.53344816f, 0.753790081f},
-std::array<float,2>{0.15094392f, 0.38774696f},
-std::array<float,2>{0.720106781f, 0.0922215581f},
-std::array<float,2>{0.110193044f, 0.733209372f},
-std::array<float,2>{0.885832131f, 0.86073482f},
-std::array<float,2>{0.351327091f, 0.484752625f},
-std::array<float,2>{0.752129138f, 0.257460743f},
-std::array<float,2>{0.487564653f, 0.973158538f},
-std::array<float,2>{0.609305799f, 0.617285073f},
-std::array<float,2>{0.188042134f, 0.182672128f},
-std::array<float,2>{0.528768718f, 0.423665673f},
-std::array<float,2>{0.156303257f, 0.796820462f},
-std::array<float,2>{0.857681692f, 0.659550369f},
-std::array<float,2>{0.386392266f, 0.0610247441f},
-std::array<float,2>{0.959168077f, 0.232263774f},
-std::array<float,2>{0.288257807f, 0.503938437f},
-std::array<float,2>{0.646086395f, 0.932843149f},
-std::array<float,2>{0.0111397132f, 0.354025424f},
-std::array<float,2>{0.700056255f, 0.173189834f},
-std::array<float,2>{0.0677455738f, 0.613111138f},
-std::array<float,2>{0.911788702f, 0.980923295f},
-std::array<float,2>{0.331751645f, 0.263281018f},
-std::array<float,2>{0.781607032f, 0.496650547f},
-std::array<float,2>{0.468150228f, 0.873738945f},
-std::array<float,2>{0.579469144f, 0.72521311f},
-std::array<float,2>{0.23941876f, 0.0850979164f},
-std::array<float,2>{0.545894742f, 0.347773135f},
-std::array<float,2>{0.141718522f, 0.928298473f},
-std::array<float,2>{0.833777189f, 0.509387612f},
-std::array<float,2>{0.413601875f, 0.224582478f},
-std::array<float,2>{0.996759832f, 0.0535295531f},
-std::array<float,2>{0.281190693f, 0.671749651f},
-std::array<float,2>{0.677161574f, 0.785025954f},
-std::array<float,2>{0.0443453193f, 0.437391371f},
-std::array<float,2>{0.600902379f, 0.114347242f},
-std::array<float,2>{0.196026951f, 0.699187815f},
-std::array<float,2>{0.759344161f, 0.820259988f},
-std::array<float,2>{0.493216813f, 0.45541364f},
-std::array<float,2>{0.881657481f, 0.306363583f},
-std::array<float,2>{0.355868667f, 0.943139732f},
-std::array<float,2>{0.731667936f, 0.57007587f},
-std::array<float,2>{0.122815907f, 0.135667935f},
-std::array<float,2>{0.649739027f, 0.381913841f},
-std::array<float,2>{0.00529080722f, 0.760890603f},
-std::array<float,2>{0.96121043f, 0.626311302f},
-std::array<float,2>{0.294107944f, 0.0251713209f},
-std::array<float,2>{0.850804806f, 0.204960212f},
-std::array<float,2>{0.378341734f, 0.544283271f},
-std::array<float,2>{0.517776906f, 0.888093531f},
-std::array<float,2>{0.165993288f, 0.312668711f},
-std::array<float,2>{0.514749885f, 0.236280873f},
-std::array<float,2>{0.177336141f, 0.529412031f},
-std::array<float,2>{0.869940937f, 0.913090229f},
-std::array<float,2>{0.405298054f, 0.363843828f},
-std::array<float,2>{0.947406471f, 0.408416241f},
-std::array<float,2>{0.304977119f, 0.798483014f},
-std::array<float,2>{0.625811934f, 0.677210629f},
-std::array<float,2>{0.0262400657f, 0.0405131429f},
-std::array<float,2>{0.743202448f, 0.273379683f},
-std::array<float,2>{0.100760438f, 0.997776389f},
-std::array<float,2>{0.900820076f, 0.600886762f},
-std::array<float,2>{0.367295623f, 0.171184763f},
-std::array<float,2>{0.775063694f, 0.0732069314f},
-std::array<float,2>{0.481738895f, 0.744265258f},
-std::array<float,2>{0.616853297f, 0.846050739f},
-std::array<float,2>{0.211008042f, 0.474189132f},
-std::array<float,2>{0.670125008f, 0.00806157757f},
-std::array<float,2>{0.0487293005f, 0.646180272f},
-std::array<float,2>{0.977726936f, 0.778548062f},
-std::array<float,2>{0.260642976f, 0.399054766f},
-std::array<float,2>{0.823606312f, 0.341958433f},
-std::array<float,2>{0.422187984f, 0.905671775f},
-std::array<float,2>{0.560602129f, 0.549660027f},
-std::array<float,2>{0.130105495f, 0.195715323f},
-std::array<float,2>{0.570679843f, 0.450725406f},
-std::array<float,2>{0.223631978f, 0.839872479f},
-std::array<float,2>{0.802736044f, 0.713205218f},
-std::array<float,2>{0.447474629f, 0.094533205f},
-std::array<float,2>{0.934716761f, 0.141944826f},
-std::array<float,2>{0.319679797f, 0.587314546f},
-std::array<float,2>{0.706555307f, 0.966275871f},
-std::array<float,2>{0.0792105421f, 0.294039667f},
-std::array<float,2>{0.736977875f, 0.219825745f},
-std::array<float,2>{0.107413501f, 0.513694644f},
-std::array<float,2>{0.893243611f, 0.924656093f},
-std::array<float,2>{0.362100065f, 0.344745696f},
-std::array<float,2>{0.770456016f, 0.430743515f},
-std::array<float,2>{0.46967113f, 0.787269294f},
-std::array<float,2>{0.6239748f, 0.665974736f},
-std::array<float,2>{0.21076563f, 0.0494837202f},
-std::array<float,2>{0.505735457f, 0.258443952f},
-std::array<float,2>{0.183339074f, 0.980252564f},
-std::array<float,2>{0.865231633f, 0.614533186f},
-std::array<float,2>{0.394326925f, 0.177779436f},
-std::array<float,2>{0.945153356f, 0.0809289739f},
-std::array<float,2>{0.300440401f, 0.71917516f},
-std::array<float,2>{0.639079809f, 0.869999886f},
-std::array<float,2>{0.0167671796f, 0.495671362f},
-std::array<float,2>{0.56375283f, 0.030326616f},
-std::array<float,2>{0.231871679f, 0.630361855f},
-std::array<float,2>{0.81048882f, 0.765473783f},
-std::array<float,2>{0.44152531f, 0.378589571f},
-std::array<float,2>{0.923661172f, 0.319351733f},
-std::array<float,2>{0.323759943f, 0.885719061f},
-std::array<float,2>{0.713010967f, 0.540919781f},
-std::array<float,2>{0.0930497646f, 0.208269373f},
-std::array<float,2>{0.660708368f, 0.460461676f},
-std::array<float,2>{0.0578305759f, 0.813235641f},
-std::array<float,2>{0.975826621f, 0.701305866f},
-std::array<float,2>{0.257345527f, 0.112981379f},
-std::array<float,2>{0.819687307f, 0.139524117f},
-std::array<float,2>{0.437013358f, 0.565822363f},
-std::array<float,2>{0.547095478f, 0.938186049f},
-std::array<float,2>{0.138600901f, 0.311241031f},
-std::array<float,2>{0.536738634f, 0.166508809f},
-std::array<float,2>{0.153129682f, 0.593978882f},
-std::array<float,2>{0.838300049f, 0.99552238f},
-std::array<float,2>{0.421531409f, 0.269356251f},
-std::array<float,2>{0.986753523f, 0.471212149f},
-std::array<float,2>{0.265681058f, 0.847997487f},
-std::array<float,2>{0.683061719f, 0.747833669f},
-std::array<float,2>{0.0351547785f, 0.0775735974f},
-std::array<float,2>{0.687863588f, 0.361377329f},
-std::array<float,2>{0.0779334977f, 0.909191728f},
-std::array<float,2>{0.920857787f, 0.525905132f},
-std::array<float,2>{0.337545723f, 0.240182519f},
-std::array<float,2>{0.795216382f, 0.0448822118f},
-std::array<float,2>{0.454043716f, 0.674662113f},
-std::array<float,2>{0.592432499f, 0.80122602f},
-std::array<float,2>{0.248421416f, 0.413789362f},
-std::array<float,2>{0.642432332f, 0.100929834f},
-std::array<float,2>{0.0120996311f, 0.718141317f},
-std::array<float,2>{0.956476033f, 0.838258147f},
-std::array<float,2>{0.284067273f, 0.446798593f},
-std::array<float,2>{0.855449736f, 0.289086014f},
-std::array<float,2>{0.390448123f, 0.963458717f},
-std::array<float,2>{0.523833871f, 0.593043625f},
-std::array<float,2>{0.161860049f, 0.147041231f},
-std::array<float,2>{0.603033602f, 0.40392974f},
-std::array<float,2>{0.192199707f, 0.776347995f},
-std::array<float,2>{0.755319238f, 0.644279182f},
-std::array<float,2>{0.488866597f, 0.0154092805f},
-std::array<float,2>{0.887856722f, 0.201186389f},
-std::array<float,2>{0.345680356f, 0.553347349f},
-std::array<float,2>{0.725209117f, 0.901995182f},
-std::array<float,2>{0.116824381f, 0.337747931f},
-std::array<float,2>{0.672023356f, 0.155822188f},
-std::array<float,2>{0.0398936942f, 0.583108485f},
-std::array<float,2>{0.995399773f, 0.955853939f},
-std::array<float,2>{0.276335806f, 0.284733683f},
-std::array<float,2>{0.829104364f, 0.443848431f},
-std::array<float,2>{0.409361243f, 0.835047781f},
-std::array<float,2>{0.539557755f, 0.707346499f},
-std::array<float,2>{0.145626798f, 0.105337925f},
-std::array<float,2>{0.584255636f, 0.33090958f},
-std::array<float,2>{0.235617489f, 0.897036254f},
-std::array<float,2>{0.786535501f, 0.557616353f},
-std::array<float,2>{0.463375807f, 0.190629244f},
-std::array<float,2>{0.909164608f, 0.00115552254f},
-std::array<float,2>{0.33439678f, 0.651937306f},
-std::array<float,2>{0.699101031f, 0.77121532f},
-std::array<float,2>{0.0633134991f, 0.39702937f},
-std::array<float,2>{0.521348476f, 0.0700322092f},
-std::array<float,2>{0.171318293f, 0.739394903f},
-std::array<float,2>{0.84450978f, 0.857442081f},
-std::array<float,2>{0.381179392f, 0.483590394f},
-std::array<float,2>{0.965839088f, 0.277368635f},
-std::array<float,2>{0.289215893f, 0.988801181f},
-std::array<float,2>{0.65502888f, 0.606627405f},
-std::array<float,2>{0.00117561803f, 0.159953818f},
-std::array<float,2>{0.728724182f, 0.419352353f},
-std::array<float,2>{0.117833823f, 0.811171114f},
-std::array<float,2>{0.877391279f, 0.680311501f},
-std::array<float,2>{0.354367703f, 0.0353911258f},
-std::array<float,2>{0.76534307f, 0.248719305f},
-std::array<float,2>{0.498175383f, 0.522607028f},
-std::array<float,2>{0.594774485f, 0.920476079f},
-std::array<float,2>{0.200209394f, 0.369734108f},
-std::array<float,2>{0.611328602f, 0.217228636f},
-std::array<float,2>{0.215872809f, 0.536053419f},
-std::array<float,2>{0.779734731f, 0.878430426f},
-std::array<float,2>{0.479572028f, 0.321614653f},
-std::array<float,2>{0.906180739f, 0.385001332f},
-std::array<float,2>{0.371178985f, 0.754182875f},
-std::array<float,2>{0.749140143f, 0.637824357f},
-std::array<float,2>{0.0956630483f, 0.0212807655f},
-std::array<float,2>{0.630600452f, 0.298034132f},
-std::array<float,2>{0.0292726848f, 0.946421087f},
-std::array<float,2>{0.952094078f, 0.573725343f},
-std::array<float,2>{0.309176236f, 0.127369717f},
-std::array<float,2>{0.872090816f, 0.124622807f},
-std::array<float,2>{0.399472922f, 0.692421436f},
-std::array<float,2>{0.511029422f, 0.821260571f},
-std::array<float,2>{0.174006164f, 0.468482107f},
-std::array<float,2>{0.709415615f, 0.0560482368f},
-std::array<float,2>{0.0839098766f, 0.663108528f},
-std::array<float,2>{0.932874858f, 0.789535582f},
-std::array<float,2>{0.314344317f, 0.42679882f},
-std::array<float,2>{0.798677266f, 0.357894868f},
-std::array<float,2>{0.450694472f, 0.936817408f},
-std::array<float,2>{0.577654898f, 0.503091455f},
-std::array<float,2>{0.21899496f, 0.228718981f},
-std::array<float,2>{0.55664736f, 0.488851428f},
-std::array<float,2>{0.126099497f, 0.86657542f},
-std::array<float,2>{0.824876726f, 0.727902532f},
-std::array<float,2>{0.428608835f, 0.0884565711f},
-std::array<float,2>{0.981162906f, 0.184735447f},
-std::array<float,2>{0.263664871f, 0.624805748f},
-std::array<float,2>{0.664717674f, 0.969836414f},
-std::array<float,2>{0.0542630851f, 0.25214538f},
-std::array<float,2>{0.659495831f, 0.245716199f},
-std::array<float,2>{0.0602457784f, 0.516030431f},
-std::array<float,2>{0.971976876f, 0.91689378f},
-std::array<float,2>{0.253689528f, 0.372847944f},
-std::array<float,2>{0.814611852f, 0.415945411f},
-std::array<float,2>{0.430405438f, 0.805439711f},
-std::array<float,2>{0.551580489f, 0.68655163f},
-std::array<float,2>{0.135026619f, 0.0315416045f},
-std::array<float,2>{0.56975919f, 0.274558634f},
-std::array<float,2>{0.230031163f, 0.986629367f},
-std::array<float,2>{0.805475116f, 0.603403211f},
-std::array<float,2>{0.441038191f, 0.163394436f},
-std::array<float,2>{0.925948858f, 0.0651732907f},
-std::array<float,2>{0.327750236f, 0.735493124f},
-std::array<float,2>{0.715265512f, 0.854252279f},
-std::array<float,2>{0.0867224708f, 0.479306936f},
-std::array<float,2>{0.503225088f, 0.00577719882f},
-std::array<float,2>{0.187015459f, 0.653989375f},
-std::array<float,2>{0.862440765f, 0.769128561f},
-std::array<float,2>{0.39546743f, 0.391372859f},
-std::array<float,2>{0.94095844f, 0.333834499f},
-std::array<float,2>{0.303591281f, 0.894062996f},
-std::array<float,2>{0.63282907f, 0.559652746f},
-std::array<float,2>{0.0202933289f, 0.192336544f},
-std::array<float,2>{0.741107345f, 0.437814355f},
-std::array<float,2>{0.104642838f, 0.83052665f},
-std::array<float,2>{0.89513588f, 0.706235051f},
-std::array<float,2>{0.364151031f, 0.10679803f},
-std::array<float,2>{0.765802324f, 0.150625229f},
-std::array<float,2>{0.473018676f, 0.580465257f},
-std::array<float,2>{0.617785156f, 0.959750235f},
-std::array<float,2>{0.205584496f, 0.287438422f},
-std::array<float,2>{0.607418239f, 0.180380479f},
-std::array<float,2>{0.190924689f, 0.620853364f},
-std::array<float,2>{0.750495255f, 0.975003302f},
-std::array<float,2>{0.484613448f, 0.254329354f},
-std::array<float,2>{0.884643316f, 0.487100929f},
-std::array<float,2>{0.349136442f, 0.861942947f},
-std::array<float,2>{0.721836388f, 0.731036365f},
-std::array<float,2>{0.112250976f, 0.0910047963f},
-std::array<float,2>{0.646627665f, 0.352077246f},
-std::array<float,2>{0.00804326031f, 0.929890394f},
-std::array<float,2>{0.957395196f, 0.506120861f},
-std::array<float,2>{0.287008405f, 0.233299926f},
-std::array<float,2>{0.856538713f, 0.0597518347f},
-std::array<float,2>{0.38312912f, 0.658181369f},
-std::array<float,2>{0.531249464f, 0.793308556f},
-std::array<float,2>{0.159320071f, 0.425398797f},
-std::array<float,2>{0.69495517f, 0.118184604f},
-std::array<float,2>{0.0712580159f, 0.690984368f},
-std::array<float,2>{0.916979134f, 0.824732304f},
-std::array<float,2>{0.342504561f, 0.461177081f},
-std::array<float,2>{0.792189956f, 0.302310854f},
-std::array<float,2>{0.458297819f, 0.950803757f},
-std::array<float,2>{0.588090956f, 0.577345848f},
-std::array<float,2>{0.245830178f, 0.132615089f},
-std::array<float,2>{0.532820642f, 0.389396995f},
-std::array<float,2>{0.149159566f, 0.750617862f},
-std::array<float,2>{0.843162239f, 0.63301152f},
-std::array<float,2>{0.417798072f, 0.0182281286f},
-std::array<float,2>{0.98834759f, 0.213749349f},
-std::array<float,2>{0.271516562f, 0.532855868f},
-std::array<float,2>{0.684820771f, 0.879156172f},
-std::array<float,2>{0.0388989821f, 0.326219499f},
-std::array<float,2>{0.733756065f, 0.13459602f},
-std::array<float,2>{0.124243639f, 0.566595197f},
-std::array<float,2>{0.880536139f, 0.943411469f},
-std::array<float,2>{0.359284967f, 0.308111906f},
-std::array<float,2>{0.76169306f, 0.453392953f},
-std::array<float,2>{0.494527727f, 0.816494405f},
-std::array<float,2>{0.599242151f, 0.697024167f},
-std::array<float,2>{0.198341176f, 0.115826875f},
-std::array<float,2>{0.515877306f, 0.315289527f},
-std::array<float,2>{0.167074427f, 0.889137089f},
-std::array<float,2>{0.849451661f, 0.546029627f},
-std::array<float,2>{0.375062168f, 0.20582588f},
-std::array<float,2>{0.962911725f, 0.0264735296f},
-std::array<float,2>{0.295071214f, 0.62725389f},
-std::array<float,2>{0.651687086f, 0.758405685f},
-std::array<float,2>{0.00650289701f, 0.380815685f},
-std::array<float,2>{0.581469536f, 0.0837446898f},
-std::array<float,2>{0.241553724f, 0.723578691f},
-std::array<float,2>{0.783336341f, 0.873034716f},
-std::array<float,2>{0.465465426f, 0.499527812f},
-std::array<float,2>{0.912831664f, 0.265216053f},
-std::array<float,2>{0.329430729f, 0.984025776f},
-std::array<float,2>{0.701985061f, 0.610369861f},
-std::array<float,2>{0.0686594173f, 0.174538836f},
-std::array<float,2>{0.678749323f, 0.434607506f},
-std::array<float,2>{0.0460344441f, 0.781719804f},
-std::array<float,2>{0.998347998f, 0.669545829f},
-std::array<float,2>{0.277622998f, 0.0507870615f},
-std::array<float,2>{0.835112572f, 0.226293385f},
-std::array<float,2>{0.410912752f, 0.509775996f},
-std::array<float,2>{0.544859052f, 0.927013099f},
-std::array<float,2>{0.1440804f, 0.350463957f},
-std::array<float,2>{0.559396982f, 0.198014498f},
-std::array<float,2>{0.131658018f, 0.548180759f},
-std::array<float,2>{0.820840299f, 0.903540134f},
-std::array<float,2>{0.425334334f, 0.341181219f},
-std::array<float,2>{0.978842497f, 0.400741637f},
-std::array<float,2>{0.258569956f, 0.780367017f},
-std::array<float,2>{0.669493675f, 0.647385716f},
-std::array<float,2>{0.0503326133f, 0.0105767054f},
-std::array<float,2>{0.704095483f, 0.29616949f},
-std::array<float,2>{0.0816780925f, 0.968582094f},
-std::array<float,2>{0.936836421f, 0.588939011f},
-std::array<float,2>{0.317366391f, 0.142764285f},
-std::array<float,2>{0.801344037f, 0.0972354785f},
-std::array<float,2>{0.446709931f, 0.711029291f},
-std::array<float,2>{0.573347688f, 0.842153788f},
-std::array<float,2>{0.226265445f, 0.452549309f},
-std::array<float,2>{0.627463162f, 0.0411694385f},
-std::array<float,2>{0.0243219491f, 0.678015649f},
-std::array<float,2>{0.94566226f, 0.800178766f},
-std::array<float,2>{0.307366341f, 0.4076868f},
-std::array<float,2>{0.867633998f, 0.365545541f},
-std::array<float,2>{0.404130578f, 0.911370218f},
-std::array<float,2>{0.513169169f, 0.529024959f},
-std::array<float,2>{0.179347858f, 0.23784107f},
-std::array<float,2>{0.614515007f, 0.475539595f},
-std::array<float,2>{0.213263452f, 0.845581889f},
-std::array<float,2>{0.776482582f, 0.74388051f},
-std::array<float,2>{0.48358646f, 0.070726417f},
-std::array<float,2>{0.90003562f, 0.168227598f},
-std::array<float,2>{0.369630367f, 0.598888695f},
-std::array<float,2>{0.745285153f, 0.99807471f},
-std::array<float,2>{0.0978115723f, 0.270106375f},
-std::array<float,2>{0.711223722f, 0.209432408f},
-std::array<float,2>{0.0903357416f, 0.542493582f},
-std::array<float,2>{0.924328387f, 0.884190977f},
-std::array<float,2>{0.32139045f, 0.317134798f},
-std::array<float,2>{0.811944902f, 0.376253545f},
-std::array<float,2>{0.443678409f, 0.761859238f},
-std::array<float,2>{0.565034449f, 0.631299555f},
-std::array<float,2>{0.234325975f, 0.0287784301f},
-std::array<float,2>{0.550041914f, 0.31036514f},
-std::array<float,2>{0.139756829f, 0.939759254f},
-std::array<float,2>{0.817987204f, 0.562571347f},
-std::array<float,2>{0.435257047f, 0.137354627f},
-std::array<float,2>{0.973687828f, 0.110259868f},
-std::array<float,2>{0.254257351f, 0.700108469f},
-std::array<float,2>{0.663131297f, 0.815087557f},
-std::array<float,2>{0.0546957515f, 0.457567215f},
-std::array<float,2>{0.622621596f, 0.0474688821f},
-std::array<float,2>{0.208409503f, 0.667574883f},
-std::array<float,2>{0.773042977f, 0.785999954f},
-std::array<float,2>{0.471781641f, 0.432779878f},
-std::array<float,2>{0.891337752f, 0.346476853f},
-std::array<float,2>{0.360439956f, 0.922581196f},
-std::array<float,2>{0.734432995f, 0.512524247f},
-std::array<float,2>{0.107498616f, 0.222532064f},
-std::array<float,2>{0.636893809f, 0.492611676f},
-std::array<float,2>{0.0193914324f, 0.867869675f},
-std::array<float,2>{0.941746175f, 0.722034931f},
-std::array<float,2>{0.298527092f, 0.0796618536f},
-std::array<float,2>{0.865984142f, 0.177198559f},
-std::array<float,2>{0.391927868f, 0.616886914f},
-std::array<float,2>{0.506670952f, 0.977918684f},
-std::array<float,2>{0.180332467f, 0.261601239f},
-std::array<float,2>{0.525821984f, 0.145260155f},
-std::array<float,2>{0.163733393f, 0.589986145f},
-std::array<float,2>{0.851752102f, 0.961028039f},
-std::array<float,2>{0.38716495f, 0.29287371f},
-std::array<float,2>{0.953776956f, 0.44791466f},
-std::array<float,2>{0.281895965f, 0.836470366f},
-std::array<float,2>{0.643916965f, 0.716140926f},
-std::array<float,2>{0.0149285896f, 0.0990983173f},
-std::array<float,2>{0.723245323f, 0.337903261f},
-std::array<float,2>{0.114942566f, 0.900320172f},
-std::array<float,2>{0.890041411f, 0.551121354f},
-std::array<float,2>{0.347428113f, 0.200454116f},
-std::array<float,2>{0.757704437f, 0.0133391833f},
-std::array<float,2>{0.491891474f, 0.642022192f},
-std::array<float,2>{0.605044842f, 0.77536267f},
-std::array<float,2>{0.195145056f, 0.405568659f},
-std::array<float,2>{0.679791927f, 0.0754167512f},
-std::array<float,2>{0.0327191055f, 0.748751819f},
-std::array<float,2>{0.984925568f, 0.850447953f},
-std::array<float,2>{0.268351763f, 0.469869673f},
-std::array<float,2>{0.836240172f, 0.267267734f},
-std::array<float,2>{0.419041485f, 0.993585467f},
-std::array<float,2>{0.537665069f, 0.595713079f},
-std::array<float,2>{0.155502111f, 0.165036574f},
-std::array<float,2>{0.589930773f, 0.410888255f},
-std::array<float,2>{0.247178137f, 0.802790105f},
-std::array<float,2>{0.794155538f, 0.673294067f},
-std::array<float,2>{0.45601666f, 0.0462863594f},
-std::array<float,2>{0.91932559f, 0.241498962f},
-std::array<float,2>{0.337899685f, 0.524213731f},
-std::array<float,2>{0.690196037f, 0.906698823f},
-std::array<float,2>{0.075263761f, 0.359979421f},
-std::array<float,2>{0.654194415f, 0.15699017f},
-std::array<float,2>{0.00292575918f, 0.607626379f},
-std::array<float,2>{0.968463361f, 0.992065668f},
-std::array<float,2>{0.292319208f, 0.280661643f},
-std::array<float,2>{0.845879197f, 0.481779039f},
-std::array<float,2>{0.379068822f, 0.856318891f},
-std::array<float,2>{0.523067713f, 0.741177797f},
-std::array<float,2>{0.169269174f, 0.0672868565f},
-std::array<float,2>{0.596978068f, 0.368965656f},
-std::array<float,2>{0.201222882f, 0.919196248f},
-std::array<float,2>{0.762455523f, 0.520058274f},
-std::array<float,2>{0.496767908f, 0.2473097f},
-std::array<float,2>{0.87650913f, 0.0388979986f},
-std::array<float,2>{0.352639496f, 0.682965338f},
-std::array<float,2>{0.727062225f, 0.809311628f},
-std::array<float,2>{0.119324192f, 0.420368314f},
-std::array<float,2>{0.542233109f, 0.102286503f},
-std::array<float,2>{0.147511601f, 0.71077317f},
-std::array<float,2>{0.830944598f, 0.832352757f},
-std::array<float,2>{0.406861365f, 0.442773879f},
-std::array<float,2>{0.993370593f, 0.281571954f},
-std::array<float,2>{0.273851484f, 0.954356194f},
-std::array<float,2>{0.673863471f, 0.585358977f},
-std::array<float,2>{0.0416648313f, 0.152942568f},
-std::array<float,2>{0.695803583f, 0.394922137f},
-std::array<float,2>{0.0650580451f, 0.771917105f},
-std::array<float,2>{0.907594264f, 0.649211168f},
-std::array<float,2>{0.332664371f, 0.00305561535f},
-std::array<float,2>{0.788042068f, 0.188651145f},
-std::array<float,2>{0.461264968f, 0.555626154f},
-std::array<float,2>{0.583047271f, 0.896210849f},
-std::array<float,2>{0.236664653f, 0.329712838f},
-std::array<float,2>{0.575926244f, 0.228349105f},
-std::array<float,2>{0.221708804f, 0.500179112f},
-std::array<float,2>{0.800492823f, 0.934673309f},
-std::array<float,2>{0.452273369f, 0.356775761f},
-std::array<float,2>{0.930947125f, 0.428838521f},
-std::array<float,2>{0.315068066f, 0.791208744f},
-std::array<float,2>{0.707810163f, 0.660781562f},
-std::array<float,2>{0.0845727026f, 0.0567297302f},
-std::array<float,2>{0.666360557f, 0.251863599f},
-std::array<float,2>{0.0519091487f, 0.972275794f},
-std::array<float,2>{0.983083844f, 0.621991634f},
-std::array<float,2>{0.263976306f, 0.18733266f},
-std::array<float,2>{0.826793551f, 0.0874542221f},
-std::array<float,2>{0.427308172f, 0.729947925f},
-std::array<float,2>{0.555945933f, 0.865074575f},
-std::array<float,2>{0.127808109f, 0.492167383f},
-std::array<float,2>{0.747025132f, 0.0220259111f},
-std::array<float,2>{0.0963049307f, 0.639696121f},
-std::array<float,2>{0.903805077f, 0.757430792f},
-std::array<float,2>{0.37466678f, 0.383221745f},
-std::array<float,2>{0.778300405f, 0.324128509f},
-std::array<float,2>{0.477677435f, 0.87651515f},
-std::array<float,2>{0.610280335f, 0.537541211f},
-std::array<float,2>{0.217353389f, 0.215820804f},
-std::array<float,2>{0.508982718f, 0.464873016f},
-std::array<float,2>{0.172155231f, 0.823701978f},
-std::array<float,2>{0.873954594f, 0.694206178f},
-std::array<float,2>{0.400680184f, 0.12111596f},
-std::array<float,2>{0.950934231f, 0.125400811f},
-std::array<float,2>{0.311461389f, 0.572176278f},
-std::array<float,2>{0.63090843f, 0.9482131f},
-std::array<float,2>{0.0294619016f, 0.299102575f},
-std::array<float,2>{0.684035242f, 0.211879134f},
-std::array<float,2>{0.0379852466f, 0.534900069f},
-std::array<float,2>{0.990160108f, 0.882801116f},
-std::array<float,2>{0.27319774f, 0.325134933f},
-std::array<float,2>{0.841956019f, 0.387270123f},
-std::array<float,2>{0.416491628f, 0.752671719f},
-std::array<float,2>{0.531575203f, 0.635237753f},
-std::array<float,2>{0.150218934f, 0.0156960264f},
-std::array<float,2>{0.589196444f, 0.304102123f},
-std::array<float,2>{0.244158536f, 0.951185584f},
-std::array<float,2>{0.791453481f, 0.574846089f},
-std::array<float,2>{0.4572182f, 0.129934251f},
-std::array<float,2>{0.917035758f, 0.120032035f},
-std::array<float,2>{0.343041688f, 0.6889081f},
-std::array<float,2>{0.693589807f, 0.826801538f},
-std::array<float,2>{0.0716139823f, 0.46444729f},
-std::array<float,2>{0.529714942f, 0.0617332086f},
-std::array<float,2>{0.158508137f, 0.658911526f},
-std::array<float,2>{0.856315374f, 0.795597136f},
-std::array<float,2>{0.384153992f, 0.421930164f},
-std::array<float,2>{0.95818305f, 0.355176657f},
-std::array<float,2>{0.285169512f, 0.932551265f},
-std::array<float,2>{0.647726536f, 0.50530225f},
-std::array<float,2>{0.00961100589f, 0.230651259f},
-std::array<float,2>{0.720786452f, 0.486136049f},
-std::array<float,2>{0.112884894f, 0.859908819f},
-std::array<float,2>{0.883289218f, 0.733518064f},
-std::array<float,2>{0.348347902f, 0.0928575024f},
-std::array<float,2>{0.751352072f, 0.181969985f},
-std::array<float,2>{0.48539868f, 0.618688285f},
-std::array<float,2>{0.606392741f, 0.974484026f},
-std::array<float,2>{0.190217048f, 0.256570965f},
-std::array<float,2>{0.618551195f, 0.1496263f},
-std::array<float,2>{0.206446722f, 0.578306556f},
-std::array<float,2>{0.767490625f, 0.957184374f},
-std::array<float,2>{0.474326342f, 0.28677091f},
-std::array<float,2>{0.895974278f, 0.440724015f},
-std::array<float,2>{0.364615351f, 0.829613805f},
-std::array<float,2>{0.742019117f, 0.703417182f},
-std::array<float,2>{0.104172699f, 0.109344803f},
-std::array<float,2>{0.633906305f, 0.33489269f},
-std::array<float,2>{0.0205472223f, 0.892280638f},
-std::array<float,2>{0.940137804f, 0.562245369f},
-std::array<float,2>{0.304668874f, 0.194243193f},
-std::array<float,2>{0.862166941f, 0.00641439948f},
-std::array<float,2>{0.395730138f, 0.655502021f},
-std::array<float,2>{0.502894163f, 0.766026616f},
-std::array<float,2>{0.186104372f, 0.39313668f},
-std::array<float,2>{0.716641426f, 0.0632313266f},
-std::array<float,2>{0.0878653452f, 0.738080919f},
-std::array<float,2>{0.926835656f, 0.852558672f},
-std::array<float,2>{0.326690704f, 0.47763893f},
-std::array<float,2>{0.80629158f, 0.276430428f},
-std::array<float,2>{0.440128982f, 0.986057937f},
-std::array<float,2>{0.568493366f, 0.604431748f},
-std::array<float,2>{0.228899762f, 0.161427781f},
-std::array<float,2>{0.551804841f, 0.416039854f},
-std::array<float,2>{0.136287406f, 0.807254434f},
-std::array<float,2>{0.815478563f, 0.684749722f},
-std::array<float,2>{0.430950195f, 0.0339308903f},
-std::array<float,2>{0.970935702f, 0.243098915f},
-std::array<float,2>{0.252823442f, 0.51863569f},
-std::array<float,2>{0.658952117f, 0.915071845f},
-std::array<float,2>{0.0590476766f, 0.373972297f},
-std::array<float,2>{0.744879544f, 0.170841366f},
-std::array<float,2>{0.0988617539f, 0.599931538f},
-std::array<float,2>{0.899070919f, 0.996979713f},
-std::array<float,2>{0.370884627f, 0.271933585f},
-std::array<float,2>{0.775911689f, 0.473578483f},
-std::array<float,2>{0.48332122f, 0.847404599f},
-std::array<float,2>{0.613681555f, 0.745471597f},
-std::array<float,2>{0.214176744f, 0.0737912431f},
-std::array<float,2>{0.512279689f, 0.364287317f},
-std::array<float,2>{0.178605095f, 0.91258204f},
-std::array<float,2>{0.869123459f, 0.531150818f},
-std::array<float,2>{0.403181314f, 0.235039249f},
-std::array<float,2>{0.946729839f, 0.0395881124f},
-std::array<float,2>{0.307694107f, 0.676118076f},
-std::array<float,2>{0.628666103f, 0.797050059f},
-std::array<float,2>{0.02500364f, 0.409580678f},
-std::array<float,2>{0.57280153f, 0.0953391716f},
-std::array<float,2>{0.225379437f, 0.71426028f},
-std::array<float,2>{0.802154005f, 0.841659307f},
-std::array<float,2>{0.445600927f, 0.449875563f},
-std::array<float,2>{0.936131358f, 0.293246895f},
-std::array<float,2>{0.317531109f, 0.965422153f},
-std::array<float,2>{0.704868138f, 0.586882591f},
-std::array<float,2>{0.0809016153f, 0.141286358f},
-std::array<float,2>{0.668545783f, 0.39948532f},
-std::array<float,2>{0.0491524786f, 0.777703226f},
-std::array<float,2>{0.979989469f, 0.644690692f},
-std::array<float,2>{0.259074897f, 0.00926921237f},
-std::array<float,2>{0.822012067f, 0.197050229f},
-std::array<float,2>{0.423832923f, 0.550723135f},
-std::array<float,2>{0.560341895f, 0.904536903f},
-std::array<float,2>{0.132677317f, 0.3430911f},
-std::array<float,2>{0.543495774f, 0.223554164f},
-std::array<float,2>{0.143093318f, 0.50876081f},
-std::array<float,2>{0.83448422f, 0.928842664f},
-std::array<float,2>{0.41158098f, 0.349307448f},
-std::array<float,2>{0.999306023f, 0.436079711f},
-std::array<float,2>{0.278344661f, 0.78372401f},
-std::array<float,2>{0.677874327f, 0.670585155f},
-std::array<float,2>{0.0452785157f, 0.0543687865f},
-std::array<float,2>{0.702485919f, 0.261855125f},
-std::array<float,2>{0.0699713901f, 0.981972694f},
-std::array<float,2>{0.913967609f, 0.611685991f},
-std::array<float,2>{0.328138739f, 0.172301412f},
-std::array<float,2>{0.784673095f, 0.0842860192f},
-std::array<float,2>{0.46628195f, 0.726181626f},
-std::array<float,2>{0.580494761f, 0.874923348f},
-std::array<float,2>{0.240357876f, 0.49728018f},
-std::array<float,2>{0.650806308f, 0.0235508401f},
-std::array<float,2>{0.00705444394f, 0.625520885f},
-std::array<float,2>{0.96419847f, 0.760290384f},
-std::array<float,2>{0.296596915f, 0.381141245f},
-std::array<float,2>{0.84827143f, 0.313812017f},
-std::array<float,2>{0.376698166f, 0.887373269f},
-std::array<float,2>{0.517054677f, 0.543929994f},
-std::array<float,2>{0.166075274f, 0.203412697f},
-std::array<float,2>{0.598281205f, 0.456688881f},
-std::array<float,2>{0.197752416f, 0.8189556f},
-std::array<float,2>{0.759999692f, 0.697677374f},
-std::array<float,2>{0.495942026f, 0.113467716f},
-std::array<float,2>{0.879831791f, 0.136616305f},
-std::array<float,2>{0.358090043f, 0.568594992f},
-std::array<float,2>{0.733103096f, 0.942258537f},
-std::array<float,2>{0.123525567f, 0.305243522f},
-std::array<float,2>{0.690879703f, 0.238390863f},
-std::array<float,2>{0.0747145936f, 0.527226329f},
-std::array<float,2>{0.918047726f, 0.90885824f},
-std::array<float,2>{0.339583963f, 0.363061249f},
-std::array<float,2>{0.793654382f, 0.412679762f},
-std::array<float,2>{0.456885427f, 0.802137733f},
-std::array<float,2>{0.591427386f, 0.675655246f},
-std::array<float,2>{0.24676165f, 0.0434470177f},
-std::array<float,2>{0.538964331f, 0.2677086f},
-std::array<float,2>{0.1548796f, 0.994376898f},
-std::array<float,2>{0.837143958f, 0.594964206f},
-std::array<float,2>{0.418321401f, 0.167148396f},
-std::array<float,2>{0.985620379f, 0.0763964579f},
-std::array<float,2>{0.269236147f, 0.746553361f},
-std::array<float,2>{0.681303203f, 0.849260271f},
-std::array<float,2>{0.0317421667f, 0.472625732f},
-std::array<float,2>{0.603859782f, 0.0145179639f},
-std::array<float,2>{0.194023296f, 0.643518567f},
-std::array<float,2>{0.755859613f, 0.777148724f},
-std::array<float,2>{0.490706265f, 0.40244624f},
-std::array<float,2>{0.888760924f, 0.336329579f},
-std::array<float,2>{0.345930159f, 0.900597811f},
-std::array<float,2>{0.723922074f, 0.553903103f},
-std::array<float,2>{0.11375796f, 0.203099459f},
-std::array<float,2>{0.643527806f, 0.445423573f},
-std::array<float,2>{0.0141486181f, 0.839341521f},
-std::array<float,2>{0.954829574f, 0.717232943f},
-std::array<float,2>{0.282927722f, 0.0999683738f},
-std::array<float,2>{0.852810204f, 0.147914737f},
-std::array<float,2>{0.387996167f, 0.59239012f},
-std::array<float,2>{0.52655232f, 0.963872075f},
-std::array<float,2>{0.1623815f, 0.290843308f},
-std::array<float,2>{0.50697875f, 0.179362029f},
-std::array<float,2>{0.181031495f, 0.613407195f},
-std::array<float,2>{0.866359711f, 0.979050219f},
-std::array<float,2>{0.391171604f, 0.259522706f},
-std::array<float,2>{0.942659795f, 0.494871855f},
-std::array<float,2>{0.297621638f, 0.871087313f},
-std::array<float,2>{0.638620496f, 0.720304906f},
-std::array<float,2>{0.0185166877f, 0.0812765658f},
-std::array<float,2>{0.736101687f, 0.343937427f},
-std::array<float,2>{0.108582333f, 0.925297856f},
-std::array<float,2>{0.891634166f, 0.514885604f},
-std::array<float,2>{0.359833986f, 0.218788758f},
-std::array<float,2>{0.771758676f, 0.0502399243f},
-std::array<float,2>{0.471350819f, 0.664542973f},
-std::array<float,2>{0.621561885f, 0.788157761f},
-std::array<float,2>{0.207783833f, 0.430292517f},
-std::array<float,2>{0.662357509f, 0.111489065f},
-std::array<float,2>{0.0563789308f, 0.703026235f},
-std::array<float,2>{0.972775877f, 0.814220905f},
-std::array<float,2>{0.255142093f, 0.459230363f},
-std::array<float,2>{0.816921353f, 0.311900467f},
-std::array<float,2>{0.433609307f, 0.938714564f},
-std::array<float,2>{0.549029768f, 0.564841092f},
-std::array<float,2>{0.139175951f, 0.139919385f},
-std::array<float,2>{0.56630969f, 0.37757808f},
-std::array<float,2>{0.232709751f, 0.764606178f},
-std::array<float,2>{0.811331689f, 0.629308879f},
-std::array<float,2>{0.444522649f, 0.0298155472f},
-std::array<float,2>{0.925512135f, 0.207543716f},
-std::array<float,2>{0.321161985f, 0.539898276f},
-std::array<float,2>{0.712340176f, 0.885869265f},
-std::array<float,2>{0.090869382f, 0.318529367f},
-std::array<float,2>{0.632214546f, 0.128172681f},
-std::array<float,2>{0.0305125006f, 0.572871566f},
-std::array<float,2>{0.949314713f, 0.945583344f},
-std::array<float,2>{0.311610013f, 0.297675639f},
-std::array<float,2>{0.874057472f, 0.467599988f},
-std::array<float,2>{0.401716143f, 0.821482956f},
-std::array<float,2>{0.507863224f, 0.692096889f},
-std::array<float,2>{0.173171684f, 0.123145051f},
-std::array<float,2>{0.6109972f, 0.320706964f},
-std::array<float,2>{0.218574286f, 0.877355158f},
-std::array<float,2>{0.778663278f, 0.536755383f},
-std::array<float,2>{0.477308452f, 0.217987061f},
-std::array<float,2>{0.902489424f, 0.0203868914f},
-std::array<float,2>{0.373737633f, 0.636781216f},
-std::array<float,2>{0.747823775f, 0.755567253f},
-std::array<float,2>{0.0974953026f, 0.385778636f},
-std::array<float,2>{0.555327058f, 0.0894378871f},
-std::array<float,2>{0.128884941f, 0.726631224f},
-std::array<float,2>{0.827784061f, 0.865618706f},
-std::array<float,2>{0.425976485f, 0.489775598f},
-std::array<float,2>{0.98409766f, 0.253025323f},
-std::array<float,2>{0.26503545f, 0.969186366f},
-std::array<float,2>{0.667626321f, 0.623383582f},
-std::array<float,2>{0.0512028784f, 0.183835164f},
-std::array<float,2>{0.708096981f, 0.426066071f},
-std::array<float,2>{0.0857942626f, 0.790838361f},
-std::array<float,2>{0.930276453f, 0.662129164f},
-std::array<float,2>{0.31620118f, 0.0554186851f},
-std::array<float,2>{0.799712241f, 0.230468452f},
-std::array<float,2>{0.451886177f, 0.502162695f},
-std::array<float,2>{0.574840784f, 0.93579036f},
-std::array<float,2>{0.221113995f, 0.358605623f},
-std::array<float,2>{0.582642019f, 0.190096661f},
-std::array<float,2>{0.238132089f, 0.558287203f},
-std::array<float,2>{0.788353801f, 0.898296595f},
-std::array<float,2>{0.462291062f, 0.331618756f},
-std::array<float,2>{0.907049894f, 0.397777379f},
-std::array<float,2>{0.333851993f, 0.769592047f},
-std::array<float,2>{0.696526408f, 0.650444508f},
-std::array<float,2>{0.0661484078f, 0.000577799161f},
-std::array<float,2>{0.674964964f, 0.283672571f},
-std::array<float,2>{0.0426565595f, 0.956891f},
-std::array<float,2>{0.992289543f, 0.582836986f},
-std::array<float,2>{0.274970591f, 0.154398084f},
-std::array<float,2>{0.831325889f, 0.104436956f},
-std::array<float,2>{0.40799439f, 0.708235681f},
-std::array<float,2>{0.54172951f, 0.833987176f},
-std::array<float,2>{0.147144347f, 0.444900244f},
-std::array<float,2>{0.727766275f, 0.036489483f},
-std::array<float,2>{0.120291792f, 0.681439877f},
-std::array<float,2>{0.87589556f, 0.81168294f},
-std::array<float,2>{0.351753503f, 0.4182401f},
-std::array<float,2>{0.763581753f, 0.370299369f},
-std::array<float,2>{0.498026103f, 0.921426415f},
-std::array<float,2>{0.595878065f, 0.522257984f},
-std::array<float,2>{0.202184856f, 0.249130726f},
-std::array<float,2>{0.522374392f, 0.48309195f},
-std::array<float,2>{0.168283179f, 0.858927011f},
-std::array<float,2>{0.846970677f, 0.738831997f},
-std::array<float,2>{0.380327404f, 0.0692364872f},
-std::array<float,2>{0.966813684f, 0.158701658f},
-std::array<float,2>{0.291246086f, 0.605632722f},
-std::array<float,2>{0.652545273f, 0.989503026f},
-std::array<float,2>{0.00337922643f, 0.279096007f},
-std::array<float,2>{0.645131469f, 0.234232619f},
-std::array<float,2>{0.00977502018f, 0.507597268f},
-std::array<float,2>{0.960033476f, 0.93079114f},
-std::array<float,2>{0.288052738f, 0.352751076f},
-std::array<float,2>{0.858451664f, 0.424601346f},
-std::array<float,2>{0.385642052f, 0.794335246f},
-std::array<float,2>{0.528114736f, 0.656409025f},
-std::array<float,2>{0.157624766f, 0.0587551408f},
-std::array<float,2>{0.607960403f, 0.255225599f},
-std::array<float,2>{0.188731954f, 0.975669682f},
-std::array<float,2>{0.753515422f, 0.619160056f},
-std::array<float,2>{0.487128168f, 0.181521103f},
-std::array<float,2>{0.885069609f, 0.0907152444f},
-std::array<float,2>{0.350187063f, 0.73185879f},
-std::array<float,2>{0.719242871f, 0.863229573f},
-std::array<float,2>{0.110869229f, 0.488036066f},
-std::array<float,2>{0.534837544f, 0.0190991033f},
-std::array<float,2>{0.151871666f, 0.634173214f},
-std::array<float,2>{0.841282427f, 0.751225412f},
-std::array<float,2>{0.41441527f, 0.389787585f},
-std::array<float,2>{0.992037594f, 0.327802271f},
-std::array<float,2>{0.270949334f, 0.879977763f},
-std::array<float,2>{0.687386155f, 0.532068908f},
-std::array<float,2>{0.0367246047f, 0.214759946f},
-std::array<float,2>{0.691534877f, 0.462251037f},
-std::array<float,2>{0.0739238411f, 0.825582862f},
-std::array<float,2>{0.915295064f, 0.690148354f},
-std::array<float,2>{0.341471195f, 0.117599361f},
-std::array<float,2>{0.790277839f, 0.131178036f},
-std::array<float,2>{0.459481746f, 0.576584637f},
-std::array<float,2>{0.586764753f, 0.949778736f},
-std::array<float,2>{0.244097963f, 0.301474899f},
-std::array<float,2>{0.567926943f, 0.162173718f},
-std::array<float,2>{0.227461278f, 0.601791024f},
-std::array<float,2>{0.808515728f, 0.987659454f},
-std::array<float,2>{0.438354224f, 0.274085581f},
-std::array<float,2>{0.928136468f, 0.479950339f},
-std::array<float,2>{0.3260234f, 0.854883909f},
-std::array<float,2>{0.718044996f, 0.73441118f},
-std::array<float,2>{0.0889085978f, 0.0661308244f},
-std::array<float,2>{0.656548917f, 0.371995717f},
-std::array<float,2>{0.0614034757f, 0.917132974f},
-std::array<float,2>{0.969498932f, 0.516898334f},
-std::array<float,2>{0.25012508f, 0.244934157f},
-std::array<float,2>{0.813163042f, 0.0324782394f},
-std::array<float,2>{0.432641745f, 0.685894608f},
-std::array<float,2>{0.55291903f, 0.806106448f},
-std::array<float,2>{0.133631632f, 0.414706737f},
-std::array<float,2>{0.739424765f, 0.105784483f},
-std::array<float,2>{0.10237208f, 0.705710292f},
-std::array<float,2>{0.896987557f, 0.831715286f},
-std::array<float,2>{0.365302801f, 0.439427137f},
-std::array<float,2>{0.768206894f, 0.288864583f},
-std::array<float,2>{0.476287901f, 0.960769415f},
-std::array<float,2>{0.619753301f, 0.581620753f},
-std::array<float,2>{0.204107255f, 0.151981056f},
-std::array<float,2>{0.501038432f, 0.391852379f},
-std::array<float,2>{0.184715673f, 0.768469393f},
-std::array<float,2>{0.860742688f, 0.653292477f},
-std::array<float,2>{0.397292167f, 0.00439605955f},
-std::array<float,2>{0.939360321f, 0.192749262f},
-std::array<float,2>{0.301862359f, 0.558657229f},
-std::array<float,2>{0.634868264f, 0.892644942f},
-std::array<float,2>{0.0226712041f, 0.332924873f},
-std::array<float,2>{0.705254078f, 0.143825963f},
-std::array<float,2>{0.0789517537f, 0.588463426f},
-std::array<float,2>{0.934213161f, 0.96714741f},
-std::array<float,2>{0.319312841f, 0.295084029f},
-std::array<float,2>{0.804401636f, 0.452065706f},
-std::array<float,2>{0.448773772f, 0.842831016f},
-std::array<float,2>{0.571587205f, 0.712107778f},
-std::array<float,2>{0.223850131f, 0.0957933441f},
-std::array<float,2>{0.561962605f, 0.340364218f},
-std::array<float,2>{0.129068106f, 0.902509809f},
-std::array<float,2>{0.822420776f, 0.547555804f},
-std::array<float,2>{0.423708916f, 0.198963881f},
-std::array<float,2>{0.977473021f, 0.011563126f},
-std::array<float,2>{0.261651993f, 0.648166716f},
-std::array<float,2>{0.671342134f, 0.780147135f},
-std::array<float,2>{0.0475842878f, 0.402328819f},
-std::array<float,2>{0.615659654f, 0.0714657083f},
-std::array<float,2>{0.212571532f, 0.74222815f},
-std::array<float,2>{0.773641586f, 0.844317317f},
-std::array<float,2>{0.481018752f, 0.476537108f},
-std::array<float,2>{0.901842713f, 0.270698309f},
-std::array<float,2>{0.368730187f, 0.999998093f},
-std::array<float,2>{0.742993951f, 0.598349631f},
-std::array<float,2>{0.0999560505f, 0.169030383f},
-std::array<float,2>{0.626030922f, 0.406755447f},
-std::array<float,2>{0.0267721452f, 0.799358487f},
-std::array<float,2>{0.949071527f, 0.679070532f},
-std::array<float,2>{0.305784076f, 0.0421341136f},
-std::array<float,2>{0.870315969f, 0.236979723f},
-std::array<float,2>{0.40439418f, 0.52794838f},
-std::array<float,2>{0.513888121f, 0.910200298f},
-std::array<float,2>{0.176565051f, 0.366829336f},
-std::array<float,2>{0.518555999f, 0.206112087f},
-std::array<float,2>{0.164741889f, 0.545757532f},
-std::array<float,2>{0.850170612f, 0.889814198f},
-std::array<float,2>{0.377682567f, 0.316128254f},
-std::array<float,2>{0.962282479f, 0.379166454f},
-std::array<float,2>{0.293144286f, 0.759473205f},
-std::array<float,2>{0.64914602f, 0.628214836f},
-std::array<float,2>{0.00484898454f, 0.0255002137f},
-std::array<float,2>{0.730538487f, 0.306744069f},
-std::array<float,2>{0.121131361f, 0.944391072f},
-std::array<float,2>{0.882305861f, 0.568179905f},
-std::array<float,2>{0.356589258f, 0.133197486f},
-std::array<float,2>{0.758086026f, 0.116956241f},
-std::array<float,2>{0.492622048f, 0.695746183f},
-std::array<float,2>{0.599824071f, 0.818022192f},
-std::array<float,2>{0.197015733f, 0.454657584f},
-std::array<float,2>{0.676622272f, 0.052385699f},
-std::array<float,2>{0.04362363f, 0.668613791f},
-std::array<float,2>{0.997819364f, 0.783183992f},
-std::array<float,2>{0.279618561f, 0.434143394f},
-std::array<float,2>{0.832651734f, 0.351404935f},
-std::array<float,2>{0.412762791f, 0.92606914f},
-std::array<float,2>{0.546261787f, 0.511314571f},
-std::array<float,2>{0.141183153f, 0.22549513f},
-std::array<float,2>{0.578667104f, 0.498762757f},
-std::array<float,2>{0.23847647f, 0.87140727f},
-std::array<float,2>{0.782422364f, 0.723731399f},
-std::array<float,2>{0.467345536f, 0.0828087404f},
-std::array<float,2>{0.910547495f, 0.175081953f},
-std::array<float,2>{0.330632627f, 0.609612525f},
-std::array<float,2>{0.700971603f, 0.982669175f},
-std::array<float,2>{0.0672578141f, 0.264584571f},
-std::array<float,2>{0.725793302f, 0.199637696f},
-std::array<float,2>{0.115318686f, 0.552599788f},
-std::array<float,2>{0.887074292f, 0.898776352f},
-std::array<float,2>{0.344640255f, 0.339337945f},
-std::array<float,2>{0.754250646f, 0.405097246f},
-std::array<float,2>{0.489641607f, 0.773909152f},
-std::array<float,2>{0.602178037f, 0.641379118f},
-std::array<float,2>{0.19331716f, 0.0125831459f},
-std::array<float,2>{0.524709046f, 0.291974694f},
-std::array<float,2>{0.160360903f, 0.962502539f},
-std::array<float,2>{0.854353368f, 0.591126561f},
-std::array<float,2>{0.389295876f, 0.145776436f},
-std::array<float,2>{0.955957234f, 0.0981853679f},
-std::array<float,2>{0.2850582f, 0.715239942f},
-std::array<float,2>{0.641285062f, 0.836952388f},
-std::array<float,2>{0.0135857398f, 0.448431849f},
-std::array<float,2>{0.59339571f, 0.0450717285f},
-std::array<float,2>{0.249859482f, 0.671990037f},
-std::array<float,2>{0.796510637f, 0.804091692f},
-std::array<float,2>{0.454341263f, 0.411919415f},
-std::array<float,2>{0.921778977f, 0.361022472f},
-std::array<float,2>{0.336006254f, 0.908180654f},
-std::array<float,2>{0.688751578f, 0.525201321f},
-std::array<float,2>{0.0766964853f, 0.240989938f},
-std::array<float,2>{0.682487547f, 0.468849838f},
-std::array<float,2>{0.0338302739f, 0.851185203f},
-std::array<float,2>{0.988132715f, 0.749153316f},
-std::array<float,2>{0.267170906f, 0.0745412037f},
-std::array<float,2>{0.839353561f, 0.16529496f},
-std::array<float,2>{0.419948459f, 0.597236574f},
-std::array<float,2>{0.535897732f, 0.992924809f},
-std::array<float,2>{0.154135004f, 0.266006529f},
-std::array<float,2>{0.548193395f, 0.137951553f},
-std::array<float,2>{0.137569934f, 0.564279914f},
-std::array<float,2>{0.819230616f, 0.941299319f},
-std::array<float,2>{0.435615182f, 0.309522867f},
-std::array<float,2>{0.975463212f, 0.458745807f},
-std::array<float,2>{0.25610435f, 0.816204011f},
-std::array<float,2>{0.661333025f, 0.700478256f},
-std::array<float,2>{0.057589855f, 0.111013807f},
-std::array<float,2>{0.714498281f, 0.318205595f},
-std::array<float,2>{0.0925988778f, 0.883673191f},
-std::array<float,2>{0.922590673f, 0.541096568f},
-std::array<float,2>{0.322767317f, 0.21000737f},
-std::array<float,2>{0.809225321f, 0.0276037678f},
-std::array<float,2>{0.44263494f, 0.631953657f},
-std::array<float,2>{0.563175738f, 0.763259709f},
-std::array<float,2>{0.230619773f, 0.375159919f},
-std::array<float,2>{0.640476525f, 0.0790991634f},
-std::array<float,2>{0.016466273f, 0.721491158f},
-std::array<float,2>{0.943442881f, 0.868934751f},
-std::array<float,2>{0.29929772f, 0.494054407f},
-std::array<float,2>{0.863666475f, 0.260218084f},
-std::array<float,2>{0.39267984f, 0.976796687f},
-std::array<float,2>{0.504496217f, 0.61608994f},
-std::array<float,2>{0.182054043f, 0.176331356f},
-std::array<float,2>{0.624502301f, 0.432352155f},
-std::array<float,2>{0.209741533f, 0.786415696f},
-std::array<float,2>{0.770827413f, 0.666160703f},
-std::array<float,2>{0.469957709f, 0.0485873222f},
-std::array<float,2>{0.893741131f, 0.221355766f},
-std::array<float,2>{0.362392664f, 0.512905359f},
-std::array<float,2>{0.73764199f, 0.923150182f},
-std::array<float,2>{0.106004432f, 0.346911281f},
-std::array<float,2>{0.665340126f, 0.185740039f},
-std::array<float,2>{0.0529302992f, 0.622301161f},
-std::array<float,2>{0.982105434f, 0.971334279f},
-std::array<float,2>{0.262048692f, 0.250792474f},
-std::array<float,2>{0.825756073f, 0.490252316f},
-std::array<float,2>{0.428718805f, 0.864159167f},
-std::array<float,2>{0.557927847f, 0.729482949f},
-std::array<float,2>{0.125252381f, 0.0867553949f},
-std::array<float,2>{0.577068925f, 0.356417954f},
-std::array<float,2>{0.220348969f, 0.933730185f},
-std::array<float,2>{0.797299325f, 0.501481354f},
-std::array<float,2>{0.449628443f, 0.227404416f},
-std::array<float,2>{0.932139874f, 0.0579938293f},
-std::array<float,2>{0.313376456f, 0.661965907f},
-std::array<float,2>{0.710604548f, 0.792601228f},
-std::array<float,2>{0.0825895146f, 0.427823424f},
-std::array<float,2>{0.51014185f, 0.122919843f},
-std::array<float,2>{0.175184309f, 0.694555223f},
-std::array<float,2>{0.871442735f, 0.823181927f},
-std::array<float,2>{0.398647785f, 0.466023058f},
-std::array<float,2>{0.952656865f, 0.300579309f},
-std::array<float,2>{0.309607238f, 0.949079156f},
-std::array<float,2>{0.629217863f, 0.571119368f},
-std::array<float,2>{0.0278518628f, 0.126028657f},
-std::array<float,2>{0.748551607f, 0.384453297f},
-std::array<float,2>{0.0943432003f, 0.75607866f},
-std::array<float,2>{0.904356599f, 0.639499664f},
-std::array<float,2>{0.372694463f, 0.023246998f},
-std::array<float,2>{0.780582607f, 0.21522288f},
-std::array<float,2>{0.47948122f, 0.538258731f},
-std::array<float,2>{0.612810612f, 0.875859141f},
-std::array<float,2>{0.215271607f, 0.323207885f},
-std::array<float,2>{0.594699085f, 0.246619016f},
-std::array<float,2>{0.199498206f, 0.520657063f},
-std::array<float,2>{0.76394546f, 0.918220878f},
-std::array<float,2>{0.49974072f, 0.367813081f},
-std::array<float,2>{0.878237426f, 0.421160519f},
-std::array<float,2>{0.355365008f, 0.809974313f},
-std::array<float,2>{0.730103374f, 0.6823771f},
-std::array<float,2>{0.118784778f, 0.0371715389f},
-std::array<float,2>{0.655295551f, 0.279433042f},
-std::array<float,2>{0.000465915538f, 0.990972579f},
-std::array<float,2>{0.964915991f, 0.608873844f},
-std::array<float,2>{0.290230513f, 0.157564446f},
-std::array<float,2>{0.845640898f, 0.0683124065f},
-std::array<float,2>{0.382653177f, 0.741531193f},
-std::array<float,2>{0.519632399f, 0.856815457f},
-std::array<float,2>{0.170260832f, 0.480843395f},
-std::array<float,2>{0.697748601f, 0.0027911386f},
-std::array<float,2>{0.0638859197f, 0.650244474f},
-std::array<float,2>{0.909699857f, 0.772685945f},
-std::array<float,2>{0.335936457f, 0.395591766f},
-std::array<float,2>{0.785771906f, 0.329079896f},
-std::array<float,2>{0.464782089f, 0.894707799f},
-std::array<float,2>{0.585526824f, 0.555921733f},
-std::array<float,2>{0.234550014f, 0.188002631f},
-std::array<float,2>{0.540633738f, 0.441448748f},
-std::array<float,2>{0.145350128f, 0.83327812f},
-std::array<float,2>{0.828720808f, 0.709454775f},
-std::array<float,2>{0.408395648f, 0.103120439f},
-std::array<float,2>{0.99453336f, 0.153764367f},
-std::array<float,2>{0.27679047f, 0.584170938f},
-std::array<float,2>{0.673031747f, 0.95357579f},
-std::array<float,2>{0.0404255874f, 0.282495856f},
-std::array<float,2>{0.629944921f, 0.218115181f},
-std::array<float,2>{0.0284957606f, 0.53689909f},
-std::array<float,2>{0.951622605f, 0.876997232f},
-std::array<float,2>{0.308708102f, 0.320445895f},
-std::array<float,2>{0.872691393f, 0.386013538f},
-std::array<float,2>{0.400191456f, 0.755649984f},
-std::array<float,2>{0.511504233f, 0.63711381f},
-std::array<float,2>{0.174607694f, 0.0201664679f},
-std::array<float,2>{0.612239301f, 0.297412097f},
-std::array<float,2>{0.216502741f, 0.945317924f},
-std::array<float,2>{0.780221283f, 0.573150456f},
-std::array<float,2>{0.48007831f, 0.128384471f},
-std::array<float,2>{0.905715466f, 0.12333288f},
-std::array<float,2>{0.372068554f, 0.692176759f},
-std::array<float,2>{0.749984801f, 0.821777046f},
-std::array<float,2>{0.0949201435f, 0.46729058f},
-std::array<float,2>{0.557598054f, 0.0555308089f},
-std::array<float,2>{0.12679112f, 0.662419379f},
-std::array<float,2>{0.824387848f, 0.790729225f},
-std::array<float,2>{0.428077996f, 0.425946832f},
-std::array<float,2>{0.980501175f, 0.358878076f},
-std::array<float,2>{0.262852669f, 0.935963571f},
-std::array<float,2>{0.664481521f, 0.502334535f},
-std::array<float,2>{0.0541311353f, 0.230193347f},
-std::array<float,2>{0.709562421f, 0.489993244f},
-std::array<float,2>{0.0834172145f, 0.865284741f},
-std::array<float,2>{0.933148086f, 0.726889789f},
-std::array<float,2>{0.313688368f, 0.0896069184f},
-std::array<float,2>{0.798311949f, 0.183954269f},
-std::array<float,2>{0.450264752f, 0.623247266f},
-std::array<float,2>{0.577554822f, 0.968824089f},
-std::array<float,2>{0.219689906f, 0.253236473f},
-std::array<float,2>{0.584506869f, 0.154553294f},
-std::array<float,2>{0.235986561f, 0.582638383f},
-std::array<float,2>{0.786989629f, 0.956636071f},
-std::array<float,2>{0.463550568f, 0.283284277f},
-std::array<float,2>{0.908610344f, 0.44507426f},
-std::array<float,2>{0.334569097f, 0.834449291f},
-std::array<float,2>{0.698268771f, 0.708368242f},
-std::array<float,2>{0.0625265688f, 0.104205459f},
-std::array<float,2>{0.672552884f, 0.331883878f},
-std::array<float,2>{0.0390970632f, 0.897966266f},
-std::array<float,2>{0.995789826f, 0.558383405f},
-std::array<float,2>{0.275630325f, 0.190397233f},
-std::array<float,2>{0.829616904f, 0.000819247798f},
-std::array<float,2>{0.410121709f, 0.650662422f},
-std::array<float,2>{0.539531291f, 0.769923806f},
-std::array<float,2>{0.146140143f, 0.397496998f},
-std::array<float,2>{0.729374707f, 0.0690756217f},
-std::array<float,2>{0.117672272f, 0.739162445f},
-std::array<float,2>{0.877885282f, 0.859347165f},
-std::array<float,2>{0.353527993f, 0.483366102f},
-std::array<float,2>{0.764812589f, 0.278855562f},
-std::array<float,2>{0.498944759f, 0.989272773f},
-std::array<float,2>{0.595325768f, 0.605784595f},
-std::array<float,2>{0.200927898f, 0.158969507f},
-std::array<float,2>{0.520550072f, 0.418041795f},
-std::array<float,2>{0.171694711f, 0.811859429f},
-std::array<float,2>{0.844201803f, 0.681393325f},
-std::array<float,2>{0.381410867f, 0.036327064f},
-std::array<float,2>{0.966564417f, 0.249296367f},
-std::array<float,2>{0.289634019f, 0.522188306f},
-std::array<float,2>{0.654603243f, 0.921772599f},
-std::array<float,2>{0.0015650494f, 0.370361835f},
-std::array<float,2>{0.688456357f, 0.167465508f},
-std::array<float,2>{0.0776226744f, 0.59516716f},
-std::array<float,2>{0.920398891f, 0.994498253f},
-std::array<float,2>{0.337363273f, 0.267943442f},
-std::array<float,2>{0.795574725f, 0.472331434f},
-std::array<float,2>{0.453225613f, 0.849387407f},
-std::array<float,2>{0.59218055f, 0.746219277f},
-std::array<float,2>{0.249001086f, 0.0765064657f},
-std::array<float,2>{0.536154807f, 0.362943351f},
-std::array<float,2>{0.152391627f, 0.909106374f},
-std::array<float,2>{0.838438034f, 0.527069032f},
-std::array<float,2>{0.420903593f, 0.238719478f},
-std::array<float,2>{0.987093508f, 0.0429930612f},
-std::array<float,2>{0.266400188f, 0.675455749f},
-std::array<float,2>{0.683470249f, 0.801886916f},
-std::array<float,2>{0.0345609821f, 0.413023412f},
-std::array<float,2>{0.60258615f, 0.0996595025f},
-std::array<float,2>{0.1915887f, 0.717028797f},
-std::array<float,2>{0.755830884f, 0.839108586f},
-std::array<float,2>{0.488388628f, 0.445760876f},
-std::array<float,2>{0.888190985f, 0.290592909f},
-std::array<float,2>{0.345104873f, 0.964195013f},
-std::array<float,2>{0.724739432f, 0.592658281f},
-std::array<float,2>{0.116522253f, 0.147596002f},
-std::array<float,2>{0.642073393f, 0.402730763f},
-std::array<float,2>{0.0123897651f, 0.776914775f},
-std::array<float,2>{0.957015634f, 0.643136024f},
-std::array<float,2>{0.283275545f, 0.014348574f},
-std::array<float,2>{0.854599118f, 0.202646062f},
-std::array<float,2>{0.389651835f, 0.554101706f},
-std::array<float,2>{0.524173796f, 0.900687337f},
-std::array<float,2>{0.161149159f, 0.335969716f},
-std::array<float,2>{0.505125999f, 0.219117522f},
-std::array<float,2>{0.182664782f, 0.5149436f},
-std::array<float,2>{0.864561439f, 0.925777555f},
-std::array<float,2>{0.393817991f, 0.344141811f},
-std::array<float,2>{0.944483697f, 0.430581212f},
-std::array<float,2>{0.300075352f, 0.788565576f},
-std::array<float,2>{0.639285088f, 0.664164126f},
-std::array<float,2>{0.0173625611f, 0.0498500802f},
-std::array<float,2>{0.73658973f, 0.259392709f},
-std::array<float,2>{0.106725805f, 0.979482889f},
-std::array<float,2>{0.892857313f, 0.613739848f},
-std::array<float,2>{0.361766756f, 0.179474771f},
-std::array<float,2>{0.7697106f, 0.0814198554f},
-std::array<float,2>{0.46889922f, 0.720604599f},
-std::array<float,2>{0.623325765f, 0.870772064f},
-std::array<float,2>{0.210025415f, 0.494906932f},
-std::array<float,2>{0.66028136f, 0.0302138515f},
-std::array<float,2>{0.0584786199f, 0.628947914f},
-std::array<float,2>{0.976186156f, 0.764252603f},
-std::array<float,2>{0.257253766f, 0.377890378f},
-std::array<float,2>{0.820152998f, 0.318695098f},
-std::array<float,2>{0.436606407f, 0.885990202f},
-std::array<float,2>{0.54753232f, 0.539618731f},
-std::array<float,2>{0.137795269f, 0.207963079f},
-std::array<float,2>{0.564035892f, 0.458999008f},
-std::array<float,2>{0.23195827f, 0.814172983f},
-std::array<float,2>{0.810026884f, 0.702702343f},
-std::array<float,2>{0.441982597f, 0.111737877f},
-std::array<float,2>{0.923215926f, 0.139826939f},
-std::array<float,2>{0.323444486f, 0.564521372f},
-std::array<float,2>{0.713590801f, 0.938798845f},
-std::array<float,2>{0.0933209509f, 0.311672181f},
-std::array<float,2>{0.743890345f, 0.235189125f},
-std::array<float,2>{0.101487756f, 0.530820251f},
-std::array<float,2>{0.901235223f, 0.912298501f},
-std::array<float,2>{0.368009567f, 0.364544749f},
-std::array<float,2>{0.7746768f, 0.409225762f},
-std::array<float,2>{0.48224932f, 0.797215223f},
-std::array<float,2>{0.616527259f, 0.675949395f},
-std::array<float,2>{0.211517453f, 0.0399286933f},
-std::array<float,2>{0.515617788f, 0.271581113f},
-std::array<float,2>{0.176981911f, 0.996583104f},
-std::array<float,2>{0.869546235f, 0.599686861f},
-std::array<float,2>{0.405893415f, 0.17064254f},
-std::array<float,2>{0.947981894f, 0.074015148f},
-std::array<float,2>{0.30560115f, 0.745301127f},
-std::array<float,2>{0.625112295f, 0.847616732f},
-std::array<float,2>{0.0256616939f, 0.473229915f},
-std::array<float,2>{0.571022987f, 0.00892724562f},
-std::array<float,2>{0.222830057f, 0.645018578f},
-std::array<float,2>{0.803376377f, 0.777361751f},
-std::array<float,2>{0.448032469f, 0.399771094f},
-std::array<float,2>{0.935289681f, 0.342913836f},
-std::array<float,2>{0.319898278f, 0.904669285f},
-std::array<float,2>{0.70622611f, 0.550353229f},
-std::array<float,2>{0.079742603f, 0.196898088f},
-std::array<float,2>{0.670558989f, 0.45000577f},
-std::array<float,2>{0.0479310006f, 0.841365159f},
-std::array<float,2>{0.978068113f, 0.714085758f},
-std::array<float,2>{0.260171562f, 0.0955937728f},
-std::array<float,2>{0.823956251f, 0.141400546f},
-std::array<float,2>{0.422754109f, 0.586621225f},
-std::array<float,2>{0.561391532f, 0.965709686f},
-std::array<float,2>{0.130836591f, 0.293158799f},
-std::array<float,2>{0.545162499f, 0.17194663f},
-std::array<float,2>{0.142315298f, 0.611510277f},
-std::array<float,2>{0.83337301f, 0.982335329f},
-std::array<float,2>{0.413319081f, 0.262182295f},
-std::array<float,2>{0.996117175f, 0.497432828f},
-std::array<float,2>{0.280301541f, 0.874711812f},
-std::array<float,2>{0.677614748f, 0.726368845f},
-std::array<float,2>{0.0448154807f, 0.0841350704f},
-std::array<float,2>{0.699440539f, 0.34952876f},
-std::array<float,2>{0.0679881051f, 0.92917496f},
-std::array<float,2>{0.911472559f, 0.508469045f},
-std::array<float,2>{0.331227094f, 0.223311022f},
-std::array<float,2>{0.782111406f, 0.0544867963f},
-std::array<float,2>{0.468473911f, 0.670768678f},
-std::array<float,2>{0.579607308f, 0.784146786f},
-std::array<float,2>{0.240075827f, 0.43634221f},
-std::array<float,2>{0.650237799f, 0.113541171f},
-std::array<float,2>{0.0054815691f, 0.697477639f},
-std::array<float,2>{0.961886108f, 0.819251657f},
-std::array<float,2>{0.294474274f, 0.456984937f},
-std::array<float,2>{0.851457298f, 0.305638999f},
-std::array<float,2>{0.37870416f, 0.9418962f},
-std::array<float,2>{0.518099368f, 0.568831921f},
-std::array<float,2>{0.165093616f, 0.136469752f},
-std::array<float,2>{0.601226985f, 0.380932659f},
-std::array<float,2>{0.195494637f, 0.760698259f},
-std::array<float,2>{0.759092748f, 0.62582469f},
-std::array<float,2>{0.493742526f, 0.023745738f},
-std::array<float,2>{0.881246448f, 0.203125939f},
-std::array<float,2>{0.356166214f, 0.543502748f},
-std::array<float,2>{0.73194021f, 0.887662053f},
-std::array<float,2>{0.122451223f, 0.313701034f},
-std::array<float,2>{0.685610235f, 0.130166695f},
-std::array<float,2>{0.0357830003f, 0.575004399f},
-std::array<float,2>{0.990478456f, 0.951501071f},
-std::array<float,2>{0.269638181f, 0.303928912f},
-std::array<float,2>{0.840363383f, 0.464785427f},
-std::array<float,2>{0.415510446f, 0.826951146f},
-std::array<float,2>{0.53373456f, 0.688608348f},
-std::array<float,2>{0.150626168f, 0.119827271f},
-std::array<float,2>{0.587046266f, 0.324919403f},
-std::array<float,2>{0.242976472f, 0.8823753f},
-std::array<float,2>{0.789121985f, 0.53507936f},
-std::array<float,2>{0.460654974f, 0.21160613f},
-std::array<float,2>{0.914894462f, 0.0159909204f},
-std::array<float,2>{0.339947671f, 0.63496393f},
-std::array<float,2>{0.693208992f, 0.752755582f},
-std::array<float,2>{0.0728451386f, 0.387692213f},
-std::array<float,2>{0.529067576f, 0.0932533741f},
-std::array<float,2>{0.157130226f, 0.733750224f},
-std::array<float,2>{0.857942939f, 0.86014986f},
-std::array<float,2>{0.386009544f, 0.486079633f},
-std::array<float,2>{0.959924042f, 0.256598294f},
-std::array<float,2>{0.288889647f, 0.974340498f},
-std::array<float,2>{0.645760417f, 0.619039178f},
-std::array<float,2>{0.0114608454f, 0.181669071f},
-std::array<float,2>{0.720585465f, 0.422252625f},
-std::array<float,2>{0.109575652f, 0.795893669f},
-std::array<float,2>{0.886415541f, 0.659116387f},
-std::array<float,2>{0.351026654f, 0.0618903637f},
-std::array<float,2>{0.752909482f, 0.230770677f},
-std::array<float,2>{0.488050103f, 0.505012035f},
-std::array<float,2>{0.608776271f, 0.93227458f},
-std::array<float,2>{0.18776001f, 0.355278105f},
-std::array<float,2>{0.620885611f, 0.194043592f},
-std::array<float,2>{0.203775123f, 0.562394023f},
-std::array<float,2>{0.769528389f, 0.892430067f},
-std::array<float,2>{0.474888474f, 0.334518552f},
-std::array<float,2>{0.89783603f, 0.393514156f},
-std::array<float,2>{0.366463512f, 0.765845478f},
-std::array<float,2>{0.739198446f, 0.655600488f},
-std::array<float,2>{0.102636866f, 0.0067639146f},
-std::array<float,2>{0.636523902f, 0.286991477f},
-std::array<float,2>{0.0219909288f, 0.957325816f},
-std::array<float,2>{0.937865376f, 0.578525901f},
-std::array<float,2>{0.300842106f, 0.149666026f},
-std::array<float,2>{0.860098422f, 0.109082945f},
-std::array<float,2>{0.397778869f, 0.703282595f},
-std::array<float,2>{0.500311553f, 0.830025673f},
-std::array<float,2>{0.18404378f, 0.440466464f},
-std::array<float,2>{0.717558086f, 0.0340595692f},
-std::array<float,2>{0.0884787887f, 0.685032725f},
-std::array<float,2>{0.928899884f, 0.807525694f},
-std::array<float,2>{0.324979544f, 0.416442782f},
-std::array<float,2>{0.807472825f, 0.373729557f},
-std::array<float,2>{0.438958764f, 0.91546154f},
-std::array<float,2>{0.566508412f, 0.518852413f},
-std::array<float,2>{0.228301004f, 0.242844045f},
-std::array<float,2>{0.553780198f, 0.477865875f},
-std::array<float,2>{0.13434495f, 0.852864325f},
-std::array<float,2>{0.814310253f, 0.737902462f},
-std::array<float,2>{0.431726992f, 0.0632907599f},
-std::array<float,2>{0.970015347f, 0.161199972f},
-std::array<float,2>{0.251001984f, 0.604067743f},
-std::array<float,2>{0.657438099f, 0.986131549f},
-std::array<float,2>{0.0617907643f, 0.276640415f},
-std::array<float,2>{0.666563332f, 0.227242991f},
-std::array<float,2>{0.0523257256f, 0.501945138f},
-std::array<float,2>{0.982491493f, 0.933942199f},
-std::array<float,2>{0.264304578f, 0.356010884f},
-std::array<float,2>{0.826204836f, 0.42815569f},
-std::array<float,2>{0.427012742f, 0.792921185f},
-std::array<float,2>{0.556330681f, 0.66185981f},
-std::array<float,2>{0.126978919f, 0.0578490756f},
-std::array<float,2>{0.575327694f, 0.250719965f},
-std::array<float,2>{0.222404584f, 0.9716205f},
-std::array<float,2>{0.800292194f, 0.622553945f},
-std::array<float,2>{0.452750832f, 0.185901836f},
-std::array<float,2>{0.931255221f, 0.0864411965f},
-std::array<float,2>{0.314526558f, 0.729210377f},
-std::array<float,2>{0.70740217f, 0.863975465f},
-std::array<float,2>{0.0840640664f, 0.490688533f},
-std::array<float,2>{0.509322703f, 0.0230733771f},
-std::array<float,2>{0.172721252f, 0.639402986f},
-std::array<float,2>{0.873060048f, 0.756299257f},
-std::array<float,2>{0.40108183f, 0.38453418f},
-std::array<float,2>{0.95036298f, 0.32288903f},
-std::array<float,2>{0.310998797f, 0.875581205f},
-std::array<float,2>{0.631460488f, 0.538478017f},
-std::array<float,2>{0.0299291722f, 0.214863539f},
-std::array<float,2>{0.746174097f, 0.466194838f},
-std::array<float,2>{0.0958620608f, 0.822987437f},
-std::array<float,2>{0.904284298f, 0.694694877f},
-std::array<float,2>{0.374313444f, 0.122716241f},
-std::array<float,2>{0.777592838f, 0.126353949f},
-std::array<float,2>{0.478108019f, 0.570827603f},
-std::array<float,2>{0.609823048f, 0.948958814f},
-std::array<float,2>{0.217227921f, 0.300449342f},
-std::array<float,2>{0.597465217f, 0.157259628f},
-std::array<float,2>{0.201666102f, 0.608558118f},
-std::array<float,2>{0.762097478f, 0.990878701f},
-std::array<float,2>{0.496262401f, 0.279772401f},
-std::array<float,2>{0.875999629f, 0.48047182f},
-std::array<float,2>{0.353319228f, 0.85664618f},
-std::array<float,2>{0.727035701f, 0.741293848f},
-std::array<float,2>{0.120044567f, 0.0679721758f},
-std::array<float,2>{0.65373522f, 0.367939323f},
-std::array<float,2>{0.00231445394f, 0.918197751f},
-std::array<float,2>{0.968133092f, 0.520794094f},
-std::array<float,2>{0.292592794f, 0.246861264f},
-std::array<float,2>{0.846358716f, 0.0374870896f},
-std::array<float,2>{0.379655182f, 0.68228519f},
-std::array<float,2>{0.522890449f, 0.809753239f},
-std::array<float,2>{0.169521704f, 0.421050668f},
-std::array<float,2>{0.695783436f, 0.103330038f},
-std::array<float,2>{0.0648994297f, 0.709045112f},
-std::array<float,2>{0.907953262f, 0.833061934f},
-std::array<float,2>{0.33247751f, 0.441827625f},
-std::array<float,2>{0.787338793f, 0.282268703f},
-std::array<float,2>{0.461690038f, 0.953211486f},
-std::array<float,2>{0.583631814f, 0.584274352f},
-std::array<float,2>{0.236928016f, 0.153341383f},
-std::array<float,2>{0.542889714f, 0.395766824f},
-std::array<float,2>{0.148304358f, 0.772717655f},
-std::array<float,2>{0.830374241f, 0.650002778f},
-std::array<float,2>{0.406623781f, 0.00247002835f},
-std::array<float,2>{0.993875682f, 0.188432544f},
-std::array<float,2>{0.274134457f, 0.555692136f},
-std::array<float,2>{0.674439132f, 0.894891918f},
-std::array<float,2>{0.0412992872f, 0.328627139f},
-std::array<float,2>{0.722816765f, 0.145648912f},
-std::array<float,2>{0.114339985f, 0.591012537f},
-std::array<float,2>{0.890468717f, 0.962872148f},
-std::array<float,2>{0.347099036f, 0.291614681f},
-std::array<float,2>{0.757002175f, 0.448711455f},
-std::array<float,2>{0.491618454f, 0.837183774f},
-std::array<float,2>{0.604699373f, 0.714942932f},
-std::array<float,2>{0.194593892f, 0.0985904112f},
-std::array<float,2>{0.525938153f, 0.339021206f},
-std::array<float,2>{0.163363203f, 0.898574233f},
-std::array<float,2>{0.852499366f, 0.552338243f},
-std::array<float,2>{0.387429655f, 0.199237883f},
-std::array<float,2>{0.953575671f, 0.0122119235f},
-std::array<float,2>{0.281381935f, 0.641153753f},
-std::array<float,2>{0.644442856f, 0.773534417f},
-std::array<float,2>{0.0155302724f, 0.404825985f},
-std::array<float,2>{0.590388954f, 0.0742215887f},
-std::array<float,2>{0.247805402f, 0.749302685f},
-std::array<float,2>{0.794875264f, 0.851507723f},
-std::array<float,2>{0.455331177f, 0.469220459f},
-std::array<float,2>{0.91987431f, 0.265732586f},
-std::array<float,2>{0.338724077f, 0.992850006f},
-std::array<float,2>{0.689617097f, 0.597541273f},
-std::array<float,2>{0.0758330077f, 0.165056646f},
-std::array<float,2>{0.680269599f, 0.411730826f},
-std::array<float,2>{0.0324059278f, 0.803942144f},
-std::array<float,2>{0.984795749f, 0.672266006f},
-std::array<float,2>{0.267710418f, 0.0453467704f},
-std::array<float,2>{0.836431563f, 0.240957424f},
-std::array<float,2>{0.419513762f, 0.525131226f},
-std::array<float,2>{0.537236273f, 0.907819033f},
-std::array<float,2>{0.155901223f, 0.361142546f},
-std::array<float,2>{0.550400376f, 0.210321039f},
-std::array<float,2>{0.140510187f, 0.541480005f},
-std::array<float,2>{0.817579031f, 0.883506894f},
-std::array<float,2>{0.43489486f, 0.318033576f},
-std::array<float,2>{0.974525094f, 0.375342637f},
-std::array<float,2>{0.254595727f, 0.763562143f},
-std::array<float,2>{0.663782179f, 0.632152915f},
-std::array<float,2>{0.0556314848f, 0.0274486411f},
-std::array<float,2>{0.711861849f, 0.309196085f},
-std::array<float,2>{0.0900641233f, 0.941145539f},
-std::array<float,2>{0.924161494f, 0.564153016f},
-std::array<float,2>{0.321873754f, 0.137803987f},
-std::array<float,2>{0.812246025f, 0.111241981f},
-std::array<float,2>{0.443880886f, 0.700300395f},
-std::array<float,2>{0.564730525f, 0.815930843f},
-std::array<float,2>{0.233694941f, 0.458665013f},
-std::array<float,2>{0.637456179f, 0.0483756885f},
-std::array<float,2>{0.0186507255f, 0.666342914f},
-std::array<float,2>{0.942095459f, 0.786371768f},
-std::array<float,2>{0.29822731f, 0.432584077f},
-std::array<float,2>{0.865501463f, 0.346957117f},
-std::array<float,2>{0.392336667f, 0.922903717f},
-std::array<float,2>{0.506328523f, 0.513145804f},
-std::array<float,2>{0.180025056f, 0.221666515f},
-std::array<float,2>{0.622463763f, 0.493826479f},
-std::array<float,2>{0.208641112f, 0.868797123f},
-std::array<float,2>{0.772638798f, 0.721316874f},
-std::array<float,2>{0.472425491f, 0.0788291246f},
-std::array<float,2>{0.890745103f, 0.176551774f},
-std::array<float,2>{0.36087513f, 0.615790844f},
-std::array<float,2>{0.735272586f, 0.976953089f},
-std::array<float,2>{0.108050309f, 0.259809375f},
-std::array<float,2>{0.703258693f, 0.199137688f},
-std::array<float,2>{0.0814015418f, 0.547791839f},
-std::array<float,2>{0.937070966f, 0.902710378f},
-std::array<float,2>{0.316576868f, 0.340633571f},
-std::array<float,2>{0.801231086f, 0.402088344f},
-std::array<float,2>{0.446838498f, 0.779901028f},
-std::array<float,2>{0.573864162f, 0.648254454f},
-std::array<float,2>{0.226066306f, 0.0113734081f},
-std::array<float,2>{0.558828175f, 0.295187771f},
-std::array<float,2>{0.131054193f, 0.967008054f},
-std::array<float,2>{0.820637345f, 0.588829219f},
-std::array<float,2>{0.425193906f, 0.143730268f},
-std::array<float,2>{0.979177415f, 0.0959850848f},
-std::array<float,2>{0.258214116f, 0.712242305f},
-std::array<float,2>{0.669002414f, 0.843177855f},
-std::array<float,2>{0.0499405488f, 0.451660812f},
-std::array<float,2>{0.61478442f, 0.0423143655f},
-std::array<float,2>{0.213841319f, 0.678925812f},
-std::array<float,2>{0.776901364f, 0.799663961f},
-std::array<float,2>{0.483981371f, 0.40721935f},
-std::array<float,2>{0.89948684f, 0.367025316f},
-std::array<float,2>{0.369398981f, 0.910604537f},
-std::array<float,2>{0.745678186f, 0.528275371f},
-std::array<float,2>{0.0982954428f, 0.237176001f},
-std::array<float,2>{0.62743783f, 0.476276964f},
-std::array<float,2>{0.0237451717f, 0.844630361f},
-std::array<float,2>{0.945837677f, 0.742614865f},
-std::array<float,2>{0.307009369f, 0.0717157423f},
-std::array<float,2>{0.867708564f, 0.169402018f},
-std::array<float,2>{0.403668314f, 0.598617315f},
-std::array<float,2>{0.513363779f, 0.999684393f},
-std::array<float,2>{0.179174945f, 0.270956337f},
-std::array<float,2>{0.516190886f, 0.132957891f},
-std::array<float,2>{0.167864248f, 0.568112195f},
-std::array<float,2>{0.848968923f, 0.944604456f},
-std::array<float,2>{0.375774354f, 0.306906074f},
-std::array<float,2>{0.963639915f, 0.454917282f},
-std::array<float,2>{0.295626134f, 0.818129897f},
-std::array<float,2>{0.652249396f, 0.695540369f},
-std::array<float,2>{0.00594450487f, 0.116861515f},
-std::array<float,2>{0.734335244f, 0.316376418f},
-std::array<float,2>{0.124972448f, 0.889933109f},
-std::array<float,2>{0.880335748f, 0.545419574f},
-std::array<float,2>{0.35861972f, 0.206313342f},
-std::array<float,2>{0.761078775f, 0.0256355274f},
-std::array<float,2>{0.494845182f, 0.62801379f},
-std::array<float,2>{0.598648846f, 0.759563088f},
-std::array<float,2>{0.198878571f, 0.379088402f},
-std::array<float,2>{0.679337442f, 0.0827315673f},
-std::array<float,2>{0.0466520488f, 0.724050581f},
-std::array<float,2>{0.9986884f, 0.871174514f},
-std::array<float,2>{0.278022826f, 0.498864412f},
-std::array<float,2>{0.83548671f, 0.264160603f},
-std::array<float,2>{0.410359174f, 0.982587039f},
-std::array<float,2>{0.543946326f, 0.609811366f},
-std::array<float,2>{0.143844232f, 0.17486769f},
-std::array<float,2>{0.5819996f, 0.434453189f},
-std::array<float,2>{0.241923422f, 0.782948911f},
-std::array<float,2>{0.783921421f, 0.668766201f},
-std::array<float,2>{0.465098113f, 0.0527333878f},
-std::array<float,2>{0.912582695f, 0.225236744f},
-std::array<float,2>{0.330059588f, 0.511670589f},
-std::array<float,2>{0.701560378f, 0.925828576f},
-std::array<float,2>{0.0692004487f, 0.351290494f},
-std::array<float,2>{0.647388697f, 0.181304425f},
-std::array<float,2>{0.00869021099f, 0.61949116f},
-std::array<float,2>{0.957940102f, 0.97586906f},
-std::array<float,2>{0.28619495f, 0.254931718f},
-std::array<float,2>{0.856990874f, 0.488176793f},
-std::array<float,2>{0.383579075f, 0.862923741f},
-std::array<float,2>{0.530570626f, 0.731478751f},
-std::array<float,2>{0.160068765f, 0.0903637111f},
-std::array<float,2>{0.606692493f, 0.352943867f},
-std::array<float,2>{0.19063656f, 0.930986881f},
-std::array<float,2>{0.750091732f, 0.507339001f},
-std::array<float,2>{0.485324681f, 0.234082848f},
-std::array<float,2>{0.883942604f, 0.0588381104f},
-std::array<float,2>{0.348806739f, 0.656646609f},
-std::array<float,2>{0.722333431f, 0.79406929f},
-std::array<float,2>{0.111467749f, 0.424556762f},
-std::array<float,2>{0.532542706f, 0.117346957f},
-std::array<float,2>{0.14846006f, 0.690267563f},
-std::array<float,2>{0.843639851f, 0.825420082f},
-std::array<float,2>{0.417002946f, 0.462079704f},
-std::array<float,2>{0.98921144f, 0.301592112f},
-std::array<float,2>{0.272068232f, 0.950074852f},
-std::array<float,2>{0.685436249f, 0.576395929f},
-std::array<float,2>{0.0381433815f, 0.130968764f},
-std::array<float,2>{0.694714189f, 0.39001292f},
-std::array<float,2>{0.0707670227f, 0.751089811f},
-std::array<float,2>{0.916153789f, 0.633848727f},
-std::array<float,2>{0.342012644f, 0.019514272f},
-std::array<float,2>{0.792777717f, 0.214562014f},
-std::array<float,2>{0.458972275f, 0.531915307f},
-std::array<float,2>{0.588640034f, 0.880216599f},
-std::array<float,2>{0.24551332f, 0.32789728f},
-std::array<float,2>{0.570033014f, 0.244845718f},
-std::array<float,2>{0.229970738f, 0.51671809f},
-std::array<float,2>{0.804784417f, 0.917334497f},
-std::array<float,2>{0.440574765f, 0.37180534f},
-std::array<float,2>{0.926597118f, 0.414915711f},
-std::array<float,2>{0.327421844f, 0.805744231f},
-std::array<float,2>{0.715518355f, 0.685783327f},
-std::array<float,2>{0.086224854f, 0.0324585475f},
-std::array<float,2>{0.659951806f, 0.274371564f},
-std::array<float,2>{0.0597590879f, 0.987514853f},
-std::array<float,2>{0.972471118f, 0.601870775f},
-std::array<float,2>{0.253258377f, 0.162406281f},
-std::array<float,2>{0.815359473f, 0.0662423596f},
-std::array<float,2>{0.430053264f, 0.734848738f},
-std::array<float,2>{0.550867975f, 0.854585886f},
-std::array<float,2>{0.135546669f, 0.479676753f},
-std::array<float,2>{0.740520298f, 0.00470160507f},
-std::array<float,2>{0.105135888f, 0.652958691f},
-std::array<float,2>{0.894606829f, 0.768119693f},
-std::array<float,2>{0.363387793f, 0.391841859f},
-std::array<float,2>{0.76657939f, 0.332664579f},
-std::array<float,2>{0.473408818f, 0.892961025f},
-std::array<float,2>{0.617634475f, 0.558921218f},
-std::array<float,2>{0.205290467f, 0.192523777f},
-std::array<float,2>{0.503463745f, 0.439083934f},
-std::array<float,2>{0.186597958f, 0.831999183f},
-std::array<float,2>{0.863020003f, 0.706049383f},
-std::array<float,2>{0.394668221f, 0.105688259f},
-std::array<float,2>{0.940541506f, 0.152204275f},
-std::array<float,2>{0.302815557f, 0.582002997f},
-std::array<float,2>{0.633333564f, 0.960449457f},
-std::array<float,2>{0.0197453965f, 0.288712144f},
-std::array<float,2>{0.675429046f, 0.190838724f},
-std::array<float,2>{0.0420998074f, 0.557341814f},
-std::array<float,2>{0.992794394f, 0.897234976f},
-std::array<float,2>{0.274417311f, 0.330675751f},
-std::array<float,2>{0.831606567f, 0.397367328f},
-std::array<float,2>{0.407507509f, 0.771472871f},
-std::array<float,2>{0.541282415f, 0.652230501f},
-std::array<float,2>{0.146718681f, 0.00127651473f},
-std::array<float,2>{0.58219564f, 0.284989089f},
-std::array<float,2>{0.237573177f, 0.955725729f},
-std::array<float,2>{0.788632095f, 0.583447099f},
-std::array<float,2>{0.462837547f, 0.156200916f},
-std::array<float,2>{0.906317532f, 0.105177872f},
-std::array<float,2>{0.333192348f, 0.707099676f},
-std::array<float,2>{0.697153389f, 0.835318267f},
-std::array<float,2>{0.0658985004f, 0.444322348f},
-std::array<float,2>{0.521938801f, 0.035596136f},
-std::array<float,2>{0.168892577f, 0.680469215f},
-std::array<float,2>{0.847399235f, 0.811518133f},
-std::array<float,2>{0.380546123f, 0.419024855f},
-std::array<float,2>{0.967664838f, 0.370101541f},
-std::array<float,2>{0.291740417f, 0.920736074f},
-std::array<float,2>{0.653039932f, 0.52287358f},
-std::array<float,2>{0.00377646391f, 0.248966813f},
-std::array<float,2>{0.728154302f, 0.4837026f},
-std::array<float,2>{0.120772175f, 0.857778966f},
-std::array<float,2>{0.875131309f, 0.739740849f},
-std::array<float,2>{0.352354646f, 0.070158273f},
-std::array<float,2>{0.76270777f, 0.159871727f},
-std::array<float,2>{0.497436464f, 0.606844008f},
-std::array<float,2>{0.596562207f, 0.989149868f},
-std::array<float,2>{0.202983886f, 0.277601153f},
-std::array<float,2>{0.610593677f, 0.127069637f},
-std::array<float,2>{0.217894122f, 0.573338985f},
-std::array<float,2>{0.779004157f, 0.946559072f},
-std::array<float,2>{0.476690948f, 0.298238933f},
-std::array<float,2>{0.90324235f, 0.468533665f},
-std::array<float,2>{0.37345168f, 0.82100457f},
-std::array<float,2>{0.747214496f, 0.692816257f},
-std::array<float,2>{0.096975036f, 0.124795564f},
-std::array<float,2>{0.632374465f, 0.321345538f},
-std::array<float,2>{0.0308691822f, 0.878714323f},
-std::array<float,2>{0.950128973f, 0.53566432f},
-std::array<float,2>{0.312247068f, 0.216957927f},
-std::array<float,2>{0.874952972f, 0.0211575683f},
-std::array<float,2>{0.402221769f, 0.638158977f},
-std::array<float,2>{0.508743942f, 0.754042268f},
-std::array<float,2>{0.173507258f, 0.385082126f},
-std::array<float,2>{0.708735108f, 0.0888609439f},
-std::array<float,2>{0.085091494f, 0.727619827f},
-std::array<float,2>{0.929988563f, 0.866436541f},
-std::array<float,2>{0.315613747f, 0.489127785f},
-std::array<float,2>{0.799014688f, 0.252336979f},
-std::array<float,2>{0.451191634f, 0.97004503f},
-std::array<float,2>{0.574319005f, 0.624616861f},
-std::array<float,2>{0.221249461f, 0.18488352f},
-std::array<float,2>{0.554930329f, 0.427013487f},
-std::array<float,2>{0.128265157f, 0.789155126f},
-std::array<float,2>{0.827465415f, 0.663395762f},
-std::array<float,2>{0.426719546f, 0.055748336f},
-std::array<float,2>{0.983590782f, 0.228986174f},
-std::array<float,2>{0.265445143f, 0.503234684f},
-std::array<float,2>{0.667051435f, 0.936683059f},
-std::array<float,2>{0.0512918048f, 0.357508808f},
-std::array<float,2>{0.735430419f, 0.178011417f},
-std::array<float,2>{0.109286346f, 0.614369869f},
-std::array<float,2>{0.892546415f, 0.980132759f},
-std::array<float,2>{0.359904647f, 0.258575082f},
-std::array<float,2>{0.772024691f, 0.495928854f},
-std::array<float,2>{0.471176594f, 0.869649351f},
-std::array<float,2>{0.621638894f, 0.718849599f},
-std::array<float,2>{0.207161114f, 0.0805999786f},
-std::array<float,2>{0.507706583f, 0.345031619f},
-std::array<float,2>{0.181420788f, 0.924464464f},
-std::array<float,2>{0.867046714f, 0.51392287f},
-std::array<float,2>{0.390738547f, 0.220002174f},
-std::array<float,2>{0.943209708f, 0.0497608706f},
-std::array<float,2>{0.297223985f, 0.66566664f},
-std::array<float,2>{0.638031244f, 0.787401438f},
-std::array<float,2>{0.0179486554f, 0.431005687f},
-std::array<float,2>{0.565589964f, 0.113053352f},
-std::array<float,2>{0.233339712f, 0.701436222f},
-std::array<float,2>{0.810630798f, 0.813211679f},
-std::array<float,2>{0.445216447f, 0.460712105f},
-std::array<float,2>{0.925276875f, 0.311289549f},
-std::array<float,2>{0.320364207f, 0.938234746f},
-std::array<float,2>{0.712509513f, 0.565555334f},
-std::array<float,2>{0.0916175023f, 0.139236465f},
-std::array<float,2>{0.662900567f, 0.378664762f},
-std::array<float,2>{0.0557505786f, 0.765258789f},
-std::array<float,2>{0.973568201f, 0.629959404f},
-std::array<float,2>{0.255669117f, 0.0306563489f},
-std::array<float,2>{0.816428423f, 0.208175451f},
-std::array<float,2>{0.43455267f, 0.540726602f},
-std::array<float,2>{0.549385726f, 0.885411143f},
-std::array<float,2>{0.138858482f, 0.319753587f},
-std::array<float,2>{0.538231432f, 0.2398974f},
-std::array<float,2>{0.154385999f, 0.526147187f},
-std::array<float,2>{0.837810576f, 0.909653664f},
-std::array<float,2>{0.418875694f, 0.361664981f},
-std::array<float,2>{0.986189187f, 0.413967013f},
-std::array<float,2>{0.268764824f, 0.800957859f},
-std::array<float,2>{0.681136966f, 0.674445868f},
-std::array<float,2>{0.0317084678f, 0.0445238613f},
-std::array<float,2>{0.691307008f, 0.269177198f},
-std::array<float,2>{0.0746004656f, 0.995217562f},
-std::array<float,2>{0.918547213f, 0.594159126f},
-std::array<float,2>{0.33907479f, 0.166961759f},
-std::array<float,2>{0.793165803f, 0.0772845522f},
-std::array<float,2>{0.45648402f, 0.747764587f},
-std::array<float,2>{0.591172159f, 0.847766042f},
-std::array<float,2>{0.24632901f, 0.471607119f},
-std::array<float,2>{0.643049419f, 0.0153246503f},
-std::array<float,2>{0.0145239113f, 0.644316137f},
-std::array<float,2>{0.954245269f, 0.776038051f},
-std::array<float,2>{0.282323569f, 0.404192746f},
-std::array<float,2>{0.853111684f, 0.337444901f},
-std::array<float,2>{0.38826564f, 0.902227521f},
-std::array<float,2>{0.527326524f, 0.553528786f},
-std::array<float,2>{0.162645563f, 0.20164679f},
-std::array<float,2>{0.604395926f, 0.447212815f},
-std::array<float,2>{0.193751141f, 0.838026762f},
-std::array<float,2>{0.756420076f, 0.717915058f},
-std::array<float,2>{0.491129011f, 0.100717828f},
-std::array<float,2>{0.889383733f, 0.147262082f},
-std::array<float,2>{0.346486002f, 0.592845023f},
-std::array<float,2>{0.72441107f, 0.963665664f},
-std::array<float,2>{0.113998324f, 0.289369255f},
-std::array<float,2>{0.703018725f, 0.22418572f},
-std::array<float,2>{0.0694761053f, 0.509527981f},
-std::array<float,2>{0.913531363f, 0.928488851f},
-std::array<float,2>{0.328853726f, 0.347924978f},
-std::array<float,2>{0.784279048f, 0.437138051f},
-std::array<float,2>{0.466671526f, 0.784734607f},
-std::array<float,2>{0.580721498f, 0.671498418f},
-std::array<float,2>{0.240911365f, 0.0534013025f},
-std::array<float,2>{0.543202639f, 0.263535649f},
-std::array<float,2>{0.142625555f, 0.980488181f},
-std::array<float,2>{0.834190428f, 0.612806082f},
-std::array<float,2>{0.411846071f, 0.173067629f},
-std::array<float,2>{0.999845564f, 0.0852423087f},
-std::array<float,2>{0.279283673f, 0.725491285f},
-std::array<float,2>{0.678487957f, 0.873881042f},
-std::array<float,2>{0.0456637554f, 0.496945888f},
-std::array<float,2>{0.597844422f, 0.0249855276f},
-std::array<float,2>{0.197982669f, 0.626154602f},
-std::array<float,2>{0.760490596f, 0.761142015f},
-std::array<float,2>{0.495419085f, 0.382108718f},
-std::array<float,2>{0.879169524f, 0.312837541f},
-std::array<float,2>{0.357861429f, 0.887815297f},
-std::array<float,2>{0.73243016f, 0.544082224f},
-std::array<float,2>{0.123750232f, 0.204725266f},
-std::array<float,2>{0.651275635f, 0.455311865f},
-std::array<float,2>{0.00768060749f, 0.819898486f},
-std::array<float,2>{0.964425206f, 0.69882828f},
-std::array<float,2>{0.296294481f, 0.114531353f},
-std::array<float,2>{0.84774524f, 0.13535057f},
-std::array<float,2>{0.376367182f, 0.569911063f},
-std::array<float,2>{0.517120481f, 0.943058491f},
-std::array<float,2>{0.166796207f, 0.306580007f},
-std::array<float,2>{0.511968434f, 0.171023265f},
-std::array<float,2>{0.178066328f, 0.600657344f},
-std::array<float,2>{0.868534684f, 0.997876108f},
-std::array<float,2>{0.402739376f, 0.273153007f},
-std::array<float,2>{0.947209299f, 0.474501163f},
-std::array<float,2>{0.308387905f, 0.845853269f},
-std::array<float,2>{0.628404737f, 0.744428039f},
-std::array<float,2>{0.0247816239f, 0.0728482902f},
-std::array<float,2>{0.744295835f, 0.36410594f},
-std::array<float,2>{0.0992367268f, 0.913449943f},
-std::array<float,2>{0.898914158f, 0.529756725f},
-std::array<float,2>{0.370563447f, 0.236009777f},
-std::array<float,2>{0.775585711f, 0.0401313677f},
-std::array<float,2>{0.482858777f, 0.676770687f},
-std::array<float,2>{0.614071131f, 0.798629701f},
-std::array<float,2>{0.214811161f, 0.408655941f},
-std::array<float,2>{0.668066144f, 0.0943642482f},
-std::array<float,2>{0.0496473499f, 0.71293366f},
-std::array<float,2>{0.979895651f, 0.840154827f},
-std::array<float,2>{0.259696335f, 0.45093745f},
-std::array<float,2>{0.821538031f, 0.294380009f},
-std::array<float,2>{0.424662143f, 0.965841174f},
-std::array<float,2>{0.559815586f, 0.586953402f},
-std::array<float,2>{0.132245839f, 0.141838029f},
-std::array<float,2>{0.572375834f, 0.399256796f},
-std::array<float,2>{0.224810332f, 0.778680265f},
-std::array<float,2>{0.802500188f, 0.646304607f},
-std::array<float,2>{0.446260631f, 0.00788098481f},
-std::array<float,2>{0.935685635f, 0.195460513f},
-std::array<float,2>{0.317896605f, 0.549384534f},
-std::array<float,2>{0.704423964f, 0.90549922f},
-std::array<float,2>{0.0804412365f, 0.342251599f},
-std::array<float,2>{0.634720385f, 0.149085253f},
-std::array<float,2>{0.0212661605f, 0.579717875f},
-std::array<float,2>{0.939629674f, 0.958959579f},
-std::array<float,2>{0.303750724f, 0.285735875f},
-std::array<float,2>{0.861416519f, 0.439611435f},
-std::array<float,2>{0.396235526f, 0.828156233f},
-std::array<float,2>{0.502118409f, 0.704854369f},
-std::array<float,2>{0.185905382f, 0.107635222f},
-std::array<float,2>{0.618776619f, 0.33580792f},
-std::array<float,2>{0.206737474f, 0.891263902f},
-std::array<float,2>{0.766967654f, 0.561019361f},
-std::array<float,2>{0.474064708f, 0.194499671f},
-std::array<float,2>{0.896367431f, 0.00703282608f},
-std::array<float,2>{0.364771903f, 0.655200958f},
-std::array<float,2>{0.741635144f, 0.766811371f},
-std::array<float,2>{0.103749327f, 0.394280344f},
-std::array<float,2>{0.552378595f, 0.0636852086f},
-std::array<float,2>{0.136114001f, 0.736658454f},
-std::array<float,2>{0.816331208f, 0.852390051f},
-std::array<float,2>{0.431440979f, 0.477189094f},
-std::array<float,2>{0.971382201f, 0.275590956f},
-std::array<float,2>{0.252288461f, 0.985293806f},
-std::array<float,2>{0.658282518f, 0.605345905f},
-std::array<float,2>{0.0591761693f, 0.160178736f},
-std::array<float,2>{0.716043591f, 0.417835772f},
-std::array<float,2>{0.0873912275f, 0.808071852f},
-std::array<float,2>{0.927697361f, 0.684422493f},
-std::array<float,2>{0.326173723f, 0.0346676745f},
-std::array<float,2>{0.805998504f, 0.243956894f},
-std::array<float,2>{0.439685017f, 0.518402874f},
-std::array<float,2>{0.569316745f, 0.914165735f},
-std::array<float,2>{0.229151309f, 0.37404567f},
-std::array<float,2>{0.589383304f, 0.212095261f},
-std::array<float,2>{0.244730368f, 0.533474386f},
-std::array<float,2>{0.791538298f, 0.88125968f},
-std::array<float,2>{0.457809955f, 0.325386852f},
-std::array<float,2>{0.91782403f, 0.388107985f},
-std::array<float,2>{0.343604773f, 0.753528953f},
-std::array<float,2>{0.693994999f, 0.636536837f},
-std::array<float,2>{0.0720191374f, 0.0170336608f},
-std::array<float,2>{0.684375465f, 0.303586692f},
-std::array<float,2>{0.0372068211f, 0.952374756f},
-std::array<float,2>{0.989271462f, 0.57577014f},
-std::array<float,2>{0.272507012f, 0.129468992f},
-std::array<float,2>{0.842472076f, 0.120168015f},
-std::array<float,2>{0.416810453f, 0.687976778f},
-std::array<float,2>{0.532135189f, 0.827374041f},
-std::array<float,2>{0.149483189f, 0.463633716f},
-std::array<float,2>{0.721224666f, 0.060676422f},
-std::array<float,2>{0.112690344f, 0.659403026f},
-std::array<float,2>{0.883435965f, 0.796464145f},
-std::array<float,2>{0.347789615f, 0.423582703f},
-std::array<float,2>{0.751531243f, 0.354322135f},
-std::array<float,2>{0.48604393f, 0.933085799f},
-std::array<float,2>{0.605498433f, 0.504327834f},
-std::array<float,2>{0.189845696f, 0.232073769f},
-std::array<float,2>{0.530106604f, 0.484448582f},
-std::array<float,2>{0.159111544f, 0.860419154f},
-std::array<float,2>{0.855815232f, 0.733096838f},
-std::array<float,2>{0.38452664f, 0.0918561667f},
-std::array<float,2>{0.958535433f, 0.182878673f},
-std::array<float,2>{0.285842627f, 0.617564261f},
-std::array<float,2>{0.648305476f, 0.973466158f},
-std::array<float,2>{0.00902217627f, 0.257757813f},
-std::array<float,2>{0.656085968f, 0.247357473f},
-std::array<float,2>{0.000646710105f, 0.520423651f},
-std::array<float,2>{0.965364814f, 0.919167221f},
-std::array<float,2>{0.290575624f, 0.368689984f},
-std::array<float,2>{0.844978094f, 0.419969767f},
-std::array<float,2>{0.381878734f, 0.809487104f},
-std::array<float,2>{0.520472229f, 0.682740271f},
-std::array<float,2>{0.17087163f, 0.0386853293f},
-std::array<float,2>{0.594069958f, 0.280288637f},
-std::array<float,2>{0.199791864f, 0.991754651f},
-std::array<float,2>{0.764547467f, 0.60779953f},
-std::array<float,2>{0.499482334f, 0.156981215f},
-std::array<float,2>{0.878465056f, 0.0670063496f},
-std::array<float,2>{0.354860365f, 0.740754724f},
-std::array<float,2>{0.729944527f, 0.856087148f},
-std::array<float,2>{0.118489921f, 0.481445521f},
-std::array<float,2>{0.540295959f, 0.00329855504f},
-std::array<float,2>{0.144559979f, 0.649013102f},
-std::array<float,2>{0.828293741f, 0.771600425f},
-std::array<float,2>{0.409110636f, 0.394570231f},
-std::array<float,2>{0.994915783f, 0.329903662f},
-std::array<float,2>{0.276974976f, 0.896262825f},
-std::array<float,2>{0.67374754f, 0.555355072f},
-std::array<float,2>{0.0407660194f, 0.1888953f},
-std::array<float,2>{0.698210835f, 0.442465931f},
-std::array<float,2>{0.0643288344f, 0.832085729f},
-std::array<float,2>{0.90943712f, 0.710513234f},
-std::array<float,2>{0.335360914f, 0.102499165f},
-std::array<float,2>{0.785523653f, 0.153119981f},
-std::array<float,2>{0.46415621f, 0.585052252f},
-std::array<float,2>{0.584973335f, 0.954164863f},
-std::array<float,2>{0.235250935f, 0.281336665f},
-std::array<float,2>{0.57643944f, 0.187198669f},
-std::array<float,2>{0.220133528f, 0.621656775f},
-std::array<float,2>{0.797495246f, 0.972458482f},
-std::array<float,2>{0.44988215f, 0.251637131f},
-std::array<float,2>{0.931905091f, 0.491758078f},
-std::array<float,2>{0.312584966f, 0.86488235f},
-std::array<float,2>{0.710015833f, 0.729706585f},
-std::array<float,2>{0.0824280977f, 0.0877484605f},
-std::array<float,2>{0.665825844f, 0.356639057f},
-std::array<float,2>{0.0535699166f, 0.934939384f},
-std::array<float,2>{0.981853783f, 0.500371039f},
-std::array<float,2>{0.262585849f, 0.228211984f},
-std::array<float,2>{0.825520456f, 0.056905482f},
-std::array<float,2>{0.429656446f, 0.661026716f},
-std::array<float,2>{0.558254123f, 0.791316211f},
-std::array<float,2>{0.125597671f, 0.42907092f},
-std::array<float,2>{0.748220682f, 0.1214099f},
-std::array<float,2>{0.0942342132f, 0.693947196f},
-std::array<float,2>{0.905090868f, 0.823410153f},
-std::array<float,2>{0.372524619f, 0.465265065f},
-std::array<float,2>{0.781139433f, 0.29887104f},
-std::array<float,2>{0.478772819f, 0.947855115f},
-std::array<float,2>{0.612390101f, 0.57199657f},
-std::array<float,2>{0.21580857f, 0.125028238f},
-std::array<float,2>{0.510293663f, 0.382950991f},
-std::array<float,2>{0.175424263f, 0.757663608f},
-std::array<float,2>{0.872044921f, 0.640040994f},
-std::array<float,2>{0.398998737f, 0.0224526525f},
-std::array<float,2>{0.952525616f, 0.216122091f},
-std::array<float,2>{0.310306817f, 0.537181079f},
-std::array<float,2>{0.629603744f, 0.876821995f},
-std::array<float,2>{0.0275381319f, 0.32384789f},
-std::array<float,2>{0.714183033f, 0.137570053f},
-std::array<float,2>{0.0922592208f, 0.562802553f},
-std::array<float,2>{0.921912432f, 0.939677179f},
-std::array<float,2>{0.322350234f, 0.310109735f},
-std::array<float,2>{0.808603168f, 0.457968682f},
-std::array<float,2>{0.443015724f, 0.815231323f},
-std::array<float,2>{0.56287384f, 0.699906409f},
-std::array<float,2>{0.231421918f, 0.109943844f},
-std::array<float,2>{0.548766196f, 0.317202806f},
-std::array<float,2>{0.13675487f, 0.883947909f},
-std::array<float,2>{0.818773091f, 0.542729795f},
-std::array<float,2>{0.436310142f, 0.209024489f},
-std::array<float,2>{0.97479403f, 0.0283228513f},
-std::array<float,2>{0.256353438f, 0.630891144f},
-std::array<float,2>{0.661756992f, 0.76208818f},
-std::array<float,2>{0.0569051206f, 0.376154244f},
-std::array<float,2>{0.624541163f, 0.0800151005f},
-std::array<float,2>{0.209185332f, 0.721793771f},
-std::array<float,2>{0.771091878f, 0.868138254f},
-std::array<float,2>{0.470609069f, 0.492246211f},
-std::array<float,2>{0.894275784f, 0.261358798f},
-std::array<float,2>{0.363175392f, 0.977782071f},
-std::array<float,2>{0.738071322f, 0.616977274f},
-std::array<float,2>{0.105488189f, 0.176851183f},
-std::array<float,2>{0.639864981f, 0.433058918f},
-std::array<float,2>{0.0160822719f, 0.785776734f},
-std::array<float,2>{0.944276094f, 0.667727947f},
-std::array<float,2>{0.299689859f, 0.0478229374f},
-std::array<float,2>{0.863770843f, 0.222170725f},
-std::array<float,2>{0.393124282f, 0.512230039f},
-std::array<float,2>{0.504284024f, 0.922619343f},
-std::array<float,2>{0.182526067f, 0.346374333f},
-std::array<float,2>{0.525286257f, 0.20035018f},
-std::array<float,2>{0.160997882f, 0.551018536f},
-std::array<float,2>{0.853856862f, 0.899990976f},
-std::array<float,2>{0.388995379f, 0.338331163f},
-std::array<float,2>{0.955559134f, 0.405288965f},
-std::array<float,2>{0.284569383f, 0.77505523f},
-std::array<float,2>{0.641087532f, 0.641706049f},
-std::array<float,2>{0.0130205341f, 0.0134664653f},
-std::array<float,2>{0.726435065f, 0.292616129f},
-std::array<float,2>{0.115757346f, 0.961396754f},
-std::array<float,2>{0.887349546f, 0.590261936f},
-std::array<float,2>{0.344201326f, 0.145476714f},
-std::array<float,2>{0.754847109f, 0.098666735f},
-std::array<float,2>{0.490183294f, 0.715820909f},
-std::array<float,2>{0.601837575f, 0.836752236f},
-std::array<float,2>{0.192754373f, 0.448165923f},
-std::array<float,2>{0.681677043f, 0.0460548103f},
-std::array<float,2>{0.0336867757f, 0.672905862f},
-std::array<float,2>{0.987696648f, 0.802993774f},
-std::array<float,2>{0.267026424f, 0.410947353f},
-std::array<float,2>{0.839748681f, 0.360254794f},
-std::array<float,2>{0.420881331f, 0.906458318f},
-std::array<float,2>{0.535329163f, 0.523964226f},
-std::array<float,2>{0.153414428f, 0.241288841f},
-std::array<float,2>{0.592897117f, 0.470004231f},
-std::array<float,2>{0.249495298f, 0.850113869f},
-std::array<float,2>{0.796318352f, 0.748837709f},
-std::array<float,2>{0.454693526f, 0.0754987374f},
-std::array<float,2>{0.920901358f, 0.164574638f},
-std::array<float,2>{0.336792052f, 0.596100211f},
-std::array<float,2>{0.689197123f, 0.993186414f},
-std::array<float,2>{0.0764157325f, 0.267452061f},
-std::array<float,2>{0.73095721f, 0.205710322f},
-std::array<float,2>{0.121817186f, 0.546189487f},
-std::array<float,2>{0.882642269f, 0.888845563f},
-std::array<float,2>{0.357395828f, 0.315123886f},
-std::array<float,2>{0.758379757f, 0.380602807f},
-std::array<float,2>{0.493143857f, 0.758730352f},
-std::array<float,2>{0.600116313f, 0.627166867f},
-std::array<float,2>{0.196441755f, 0.026772473f},
-std::array<float,2>{0.519510269f, 0.30843696f},
-std::array<float,2>{0.164426476f, 0.943613172f},
-std::array<float,2>{0.849914849f, 0.566710353f},
-std::array<float,2>{0.377238095f, 0.13432233f},
-std::array<float,2>{0.962409019f, 0.116064548f},
-std::array<float,2>{0.29384622f, 0.696955144f},
-std::array<float,2>{0.648509324f, 0.816750646f},
-std::array<float,2>{0.00408756733f, 0.45331046f},
-std::array<float,2>{0.578298807f, 0.0510761067f},
-std::array<float,2>{0.239093125f, 0.669908583f},
-std::array<float,2>{0.783149064f, 0.781309187f},
-std::array<float,2>{0.467279524f, 0.434984475f},
-std::array<float,2>{0.910997748f, 0.350244701f},
-std::array<float,2>{0.330555588f, 0.926867723f},
-std::array<float,2>{0.700655878f, 0.51014632f},
-std::array<float,2>{0.0667456985f, 0.226529121f},
-std::array<float,2>{0.676138759f, 0.499846905f},
-std::array<float,2>{0.0430727191f, 0.872667372f},
-std::array<float,2>{0.997134566f, 0.723301589f},
-std::array<float,2>{0.279955149f, 0.0836818963f},
-std::array<float,2>{0.832194388f, 0.174798265f},
-std::array<float,2>{0.412339002f, 0.610646665f},
-std::array<float,2>{0.546777308f, 0.984340668f},
-std::array<float,2>{0.140956834f, 0.265498728f},
-std::array<float,2>{0.562014639f, 0.142964184f},
-std::array<float,2>{0.129647672f, 0.589160562f},
-std::array<float,2>{0.82313174f, 0.968372107f},
-std::array<float,2>{0.423256904f, 0.295964032f},
-std::array<float,2>{0.976681769f, 0.452364892f},
-std::array<float,2>{0.260759979f, 0.841943264f},
-std::array<float,2>{0.671443224f, 0.711292207f},
-std::array<float,2>{0.0471216924f, 0.0975921005f},
-std::array<float,2>{0.705996931f, 0.340875089f},
-std::array<float,2>{0.0784569085f, 0.903601408f},
-std::array<float,2>{0.933630526f, 0.547967076f},
-std::array<float,2>{0.318578601f, 0.197919399f},
-std::array<float,2>{0.803880274f, 0.0104341563f},
-std::array<float,2>{0.44847706f, 0.647113085f},
-std::array<float,2>{0.571929276f, 0.780563414f},
-std::array<float,2>{0.22413823f, 0.400580496f},
-std::array<float,2>{0.626516938f, 0.0703840852f},
-std::array<float,2>{0.0269299243f, 0.744017839f},
-std::array<float,2>{0.948411703f, 0.845286787f},
-std::array<float,2>{0.306305796f, 0.475253522f},
-std::array<float,2>{0.871058941f, 0.27029416f},
-std::array<float,2>{0.404807985f, 0.998477161f},
-std::array<float,2>{0.514546871f, 0.598650932f},
-std::array<float,2>{0.176245168f, 0.168080345f},
-std::array<float,2>{0.615844429f, 0.407351941f},
-std::array<float,2>{0.21234706f, 0.800023973f},
-std::array<float,2>{0.774130404f, 0.677786529f},
-std::array<float,2>{0.480485201f, 0.0413051583f},
-std::array<float,2>{0.902062237f, 0.238061681f},
-std::array<float,2>{0.368184984f, 0.529105484f},
-std::array<float,2>{0.742190957f, 0.911497533f},
-std::array<float,2>{0.100467756f, 0.365359068f},
-std::array<float,2>{0.656863511f, 0.163247928f},
-std::array<float,2>{0.0607877895f, 0.603070021f},
-std::array<float,2>{0.968817413f, 0.98654598f},
-std::array<float,2>{0.250800312f, 0.274664789f},
-std::array<float,2>{0.81275326f, 0.479047537f},
-std::array<float,2>{0.433398813f, 0.854188919f},
-std::array<float,2>{0.553495228f, 0.735662639f},
-std::array<float,2>{0.13296473f, 0.0653385445f},
-std::array<float,2>{0.567530155f, 0.372655779f},
-std::array<float,2>{0.226629555f, 0.916544378f},
-std::array<float,2>{0.808090925f, 0.515822053f},
-std::array<float,2>{0.437696636f, 0.245868489f},
-std::array<float,2>{0.928647578f, 0.0312663093f},
-std::array<float,2>{0.325654656f, 0.686939776f},
-std::array<float,2>{0.718310118f, 0.805221677f},
-std::array<float,2>{0.0897972211f, 0.415712118f},
-std::array<float,2>{0.501572847f, 0.106639393f},
-std::array<float,2>{0.185322449f, 0.706416667f},
-std::array<float,2>{0.861142576f, 0.830268621f},
-std::array<float,2>{0.396939367f, 0.437649071f},
-std::array<float,2>{0.938794613f, 0.287174255f},
-std::array<float,2>{0.302692682f, 0.95957303f},
-std::array<float,2>{0.635686338f, 0.58029145f},
-std::array<float,2>{0.022971807f, 0.15068157f},
-std::array<float,2>{0.740023434f, 0.391238153f},
-std::array<float,2>{0.101679973f, 0.769305408f},
-std::array<float,2>{0.896912038f, 0.654068649f},
-std::array<float,2>{0.366034448f, 0.00545817381f},
-std::array<float,2>{0.767873168f, 0.191977218f},
-std::array<float,2>{0.475702167f, 0.559815407f},
-std::array<float,2>{0.619612932f, 0.894294918f},
-std::array<float,2>{0.204715386f, 0.333548486f},
-std::array<float,2>{0.60756129f, 0.232970595f},
-std::array<float,2>{0.189257294f, 0.506053865f},
-std::array<float,2>{0.753145754f, 0.930020511f},
-std::array<float,2>{0.486751378f, 0.352362245f},
-std::array<float,2>{0.885710895f, 0.425753176f},
-std::array<float,2>{0.34980014f, 0.793168366f},
-std::array<float,2>{0.719179332f, 0.657872438f},
-std::array<float,2>{0.110540181f, 0.0600484125f},
-std::array<float,2>{0.644797564f, 0.254024118f},
-std::array<float,2>{0.0102937147f, 0.974763513f},
-std::array<float,2>{0.960554302f, 0.620625675f},
-std::array<float,2>{0.287120551f, 0.180438995f},
-std::array<float,2>{0.859272599f, 0.0912765041f},
-std::array<float,2>{0.385157675f, 0.731261075f},
-std::array<float,2>{0.527805686f, 0.862137973f},
-std::array<float,2>{0.157809138f, 0.487005085f},
-std::array<float,2>{0.692214251f, 0.0185140613f},
-std::array<float,2>{0.0735160038f, 0.633069336f},
-std::array<float,2>{0.915605426f, 0.750887275f},
-std::array<float,2>{0.341243267f, 0.389415234f},
-std::array<float,2>{0.790656567f, 0.326422721f},
-std::array<float,2>{0.459183216f, 0.879043639f},
-std::array<float,2>{0.586089313f, 0.533094645f},
-std::array<float,2>{0.243606433f, 0.213559702f},
-std::array<float,2>{0.534206688f, 0.461259514f},
-std::array<float,2>{0.151446372f, 0.825161517f},
-std::array<float,2>{0.841440082f, 0.691364288f},
-std::array<float,2>{0.414863884f, 0.118599229f},
-std::array<float,2>{0.991312563f, 0.132421598f},
-std::array<float,2>{0.271059424f, 0.577624261f},
-std::array<float,2>{0.686703503f, 0.95092839f},
-std::array<float,2>{0.0366038047f, 0.302539319f},
-std::array<float,2>{0.641522765f, 0.202010632f},
-std::array<float,2>{0.0132541107f, 0.552969635f},
-std::array<float,2>{0.955652297f, 0.901687562f},
-std::array<float,2>{0.284720123f, 0.337189645f},
-std::array<float,2>{0.854020298f, 0.403450847f},
-std::array<float,2>{0.389464229f, 0.775676489f},
-std::array<float,2>{0.524636149f, 0.643788099f},
-std::array<float,2>{0.16044949f, 0.0149787581f},
-std::array<float,2>{0.602454603f, 0.289764851f},
-std::array<float,2>{0.193101019f, 0.963334858f},
-std::array<float,2>{0.75405854f, 0.593606532f},
-std::array<float,2>{0.489316732f, 0.146560356f},
-std::array<float,2>{0.886860073f, 0.101522245f},
-std::array<float,2>{0.344398677f, 0.718294561f},
-std::array<float,2>{0.725950539f, 0.838556588f},
-std::array<float,2>{0.11560645f, 0.446546853f},
-std::array<float,2>{0.535741091f, 0.0443036184f},
-std::array<float,2>{0.154027879f, 0.674026012f},
-std::array<float,2>{0.838952661f, 0.801669836f},
-std::array<float,2>{0.420372188f, 0.413309455f},
-std::array<float,2>{0.987967849f, 0.362194866f},
-std::array<float,2>{0.267416567f, 0.91006583f},
-std::array<float,2>{0.682244599f, 0.525497615f},
-std::array<float,2>{0.0341395736f, 0.239666536f},
-std::array<float,2>{0.688537896f, 0.470921665f},
-std::array<float,2>{0.0771012157f, 0.848254502f},
-std::array<float,2>{0.921547294f, 0.747407734f},
-std::array<float,2>{0.336314112f, 0.0778734535f},
-std::array<float,2>{0.796832681f, 0.166061774f},
-std::array<float,2>{0.45449096f, 0.594631791f},
-std::array<float,2>{0.593685448f, 0.995809019f},
-std::array<float,2>{0.249728993f, 0.269010395f},
-std::array<float,2>{0.563406885f, 0.138900056f},
-std::array<float,2>{0.230753005f, 0.566392481f},
-std::array<float,2>{0.809444368f, 0.937841356f},
-std::array<float,2>{0.4423953f, 0.310649633f},
-std::array<float,2>{0.922777593f, 0.460327953f},
-std::array<float,2>{0.32309857f, 0.812981009f},
-std::array<float,2>{0.71475625f, 0.701726437f},
-std::array<float,2>{0.0924359336f, 0.112484492f},
-std::array<float,2>{0.661381125f, 0.319828063f},
-std::array<float,2>{0.057211563f, 0.8848629f},
-std::array<float,2>{0.975271404f, 0.540500522f},
-std::array<float,2>{0.256016791f, 0.20863764f},
-std::array<float,2>{0.818964601f, 0.0310429521f},
-std::array<float,2>{0.435966581f, 0.630679548f},
-std::array<float,2>{0.547963321f, 0.764850497f},
-std::array<float,2>{0.137288854f, 0.378012478f},
-std::array<float,2>{0.737307847f, 0.0801615193f},
-std::array<float,2>{0.106411301f, 0.719672024f},
-std::array<float,2>{0.893838108f, 0.869264007f},
-std::array<float,2>{0.362759322f, 0.495361954f},
-std::array<float,2>{0.770562232f, 0.258001208f},
-std::array<float,2>{0.470005691f, 0.979936063f},
-std::array<float,2>{0.62417382f, 0.614823818f},
-std::array<float,2>{0.209684566f, 0.178333551f},
-std::array<float,2>{0.504818559f, 0.43157205f},
-std::array<float,2>{0.181836128f, 0.787992954f},
-std::array<float,2>{0.863415658f, 0.665119827f},
-std::array<float,2>{0.392903537f, 0.0492248647f},
-std::array<float,2>{0.943609834f, 0.220263764f},
-std::array<float,2>{0.298894972f, 0.514480352f},
-std::array<float,2>{0.640140057f, 0.92390871f},
-std::array<float,2>{0.0162185188f, 0.345464945f},
-std::array<float,2>{0.710802078f, 0.185143888f},
-std::array<float,2>{0.0828459263f, 0.624058187f},
-std::array<float,2>{0.932486475f, 0.970372796f},
-std::array<float,2>{0.313158184f, 0.252901435f},
-std::array<float,2>{0.796928525f, 0.48861444f},
-std::array<float,2>{0.449272841f, 0.867126822f},
-std::array<float,2>{0.576688409f, 0.728057086f},
-std::array<float,2>{0.220562175f, 0.0881497189f},
-std::array<float,2>{0.557832956f, 0.358007401f},
-std::array<float,2>{0.125218987f, 0.937389672f},
-std::array<float,2>{0.826127231f, 0.503813326f},
-std::array<float,2>{0.42904526f, 0.229275987f},
-std::array<float,2>{0.982200861f, 0.0561571941f},
-std::array<float,2>{0.261824876f, 0.663596213f},
-std::array<float,2>{0.665195942f, 0.790005684f},
-std::array<float,2>{0.0530714169f, 0.427448511f},
-std::array<float,2>{0.613103151f, 0.124127649f},
-std::array<float,2>{0.214986086f, 0.69298166f},
-std::array<float,2>{0.780480266f, 0.820771694f},
-std::array<float,2>{0.479103208f, 0.468217105f},
-std::array<float,2>{0.904580534f, 0.298543304f},
-std::array<float,2>{0.372903138f, 0.94710505f},
-std::array<float,2>{0.74881351f, 0.573803067f},
-std::array<float,2>{0.0945245624f, 0.127629265f},
-std::array<float,2>{0.629147887f, 0.385411799f},
-std::array<float,2>{0.0280967988f, 0.754521966f},
-std::array<float,2>{0.952995956f, 0.638430059f},
-std::array<float,2>{0.3099204f, 0.0205738805f},
-std::array<float,2>{0.871194065f, 0.21750854f},
-std::array<float,2>{0.398713976f, 0.535360098f},
-std::array<float,2>{0.509811521f, 0.878035843f},
-std::array<float,2>{0.174875528f, 0.322072625f},
-std::array<float,2>{0.519887388f, 0.248502403f},
-std::array<float,2>{0.170132637f, 0.523044348f},
-std::array<float,2>{0.845392346f, 0.920131922f},
-std::array<float,2>{0.382528365f, 0.369233161f},
-std::array<float,2>{0.965291798f, 0.419570982f},
-std::array<float,2>{0.290525585f, 0.810940683f},
-std::array<float,2>{0.65558666f, 0.67997998f},
-std::array<float,2>{8.85905683e-05f, 0.0361020043f},
-std::array<float,2>{0.730341017f, 0.278038532f},
-std::array<float,2>{0.119085148f, 0.988281608f},
-std::array<float,2>{0.878046751f, 0.607245207f},
-std::array<float,2>{0.355077267f, 0.159541368f},
-std::array<float,2>{0.763887763f, 0.0695966184f},
-std::array<float,2>{0.499957263f, 0.739905298f},
-std::array<float,2>{0.594470143f, 0.85794872f},
-std::array<float,2>{0.199459434f, 0.484269768f},
-std::array<float,2>{0.67329061f, 0.00161491567f},
-std::array<float,2>{0.040118508f, 0.651676834f},
-std::array<float,2>{0.994358897f, 0.77083981f},
-std::array<float,2>{0.276583225f, 0.396900266f},
-std::array<float,2>{0.828865528f, 0.330530018f},
-std::array<float,2>{0.40850693f, 0.896868825f},
-std::array<float,2>{0.54101187f, 0.556989193f},
-std::array<float,2>{0.145062819f, 0.191226095f},
-std::array<float,2>{0.585755229f, 0.443734199f},
-std::array<float,2>{0.234769657f, 0.83591485f},
-std::array<float,2>{0.786079526f, 0.708006084f},
-std::array<float,2>{0.464425743f, 0.104579687f},
-std::array<float,2>{0.910061002f, 0.155484334f},
-std::array<float,2>{0.335529476f, 0.583866298f},
-std::array<float,2>{0.697406232f, 0.955257893f},
-std::array<float,2>{0.0635026097f, 0.284188658f},
-std::array<float,2>{0.719679236f, 0.231859773f},
-std::array<float,2>{0.111105293f, 0.504800498f},
-std::array<float,2>{0.885008454f, 0.933303714f},
-std::array<float,2>{0.350366563f, 0.353848606f},
-std::array<float,2>{0.75378269f, 0.423206806f},
-std::array<float,2>{0.486996382f, 0.796335995f},
-std::array<float,2>{0.608291924f, 0.660097063f},
-std::array<float,2>{0.188606814f, 0.0614385381f},
-std::array<float,2>{0.528072238f, 0.256875843f},
-std::array<float,2>{0.15728052f, 0.97305572f},
-std::array<float,2>{0.858700633f, 0.617987633f},
-std::array<float,2>{0.385359138f, 0.183411554f},
-std::array<float,2>{0.960322261f, 0.0924556106f},
-std::array<float,2>{0.287742615f, 0.732829332f},
-std::array<float,2>{0.645321488f, 0.860930145f},
-std::array<float,2>{0.0102384333f, 0.484957248f},
-std::array<float,2>{0.586529136f, 0.0173047036f},
-std::array<float,2>{0.243771806f, 0.635863781f},
-std::array<float,2>{0.790435791f, 0.753245771f},
-std::array<float,2>{0.459786803f, 0.388335079f},
-std::array<float,2>{0.91512841f, 0.326064795f},
-std::array<float,2>{0.341596067f, 0.881373227f},
-std::array<float,2>{0.691855431f, 0.534056187f},
-std::array<float,2>{0.0741074383f, 0.212443799f},
-std::array<float,2>{0.687191784f, 0.463013619f},
-std::array<float,2>{0.036941234f, 0.827679694f},
-std::array<float,2>{0.99172616f, 0.688453019f},
-std::array<float,2>{0.270554096f, 0.120798066f},
-std::array<float,2>{0.840973139f, 0.12926437f},
-std::array<float,2>{0.41417104f, 0.575626791f},
-std::array<float,2>{0.535103559f, 0.952890635f},
-std::array<float,2>{0.152227014f, 0.302969217f},
-std::array<float,2>{0.55317539f, 0.16089341f},
-std::array<float,2>{0.13352783f, 0.604849696f},
-std::array<float,2>{0.813248158f, 0.984517097f},
-std::array<float,2>{0.432987154f, 0.276143581f},
-std::array<float,2>{0.969402552f, 0.476843625f},
-std::array<float,2>{0.250351012f, 0.851827502f},
-std::array<float,2>{0.656422913f, 0.737120748f},
-std::array<float,2>{0.0611182041f, 0.0643630475f},
-std::array<float,2>{0.718001246f, 0.374555469f},
-std::array<float,2>{0.0893224105f, 0.914951265f},
-std::array<float,2>{0.927909791f, 0.51803267f},
-std::array<float,2>{0.325768948f, 0.243462235f},
-std::array<float,2>{0.808113396f, 0.0351555832f},
-std::array<float,2>{0.438098162f, 0.684077919f},
-std::array<float,2>{0.568275094f, 0.808329999f},
-std::array<float,2>{0.227228597f, 0.417071998f},
-std::array<float,2>{0.635232866f, 0.10811802f},
-std::array<float,2>{0.0228714254f, 0.704101622f},
-std::array<float,2>{0.939142346f, 0.828716218f},
-std::array<float,2>{0.302216321f, 0.440072924f},
-std::array<float,2>{0.860412538f, 0.285498738f},
-std::array<float,2>{0.397152334f, 0.958015263f},
-std::array<float,2>{0.50144732f, 0.579333723f},
-std::array<float,2>{0.185020834f, 0.148914576f},
-std::array<float,2>{0.620060623f, 0.393592775f},
-std::array<float,2>{0.204477996f, 0.767348051f},
-std::array<float,2>{0.768545806f, 0.6545403f},
-std::array<float,2>{0.476494491f, 0.00754658552f},
-std::array<float,2>{0.897427619f, 0.195043802f},
-std::array<float,2>{0.365513325f, 0.561471522f},
-std::array<float,2>{0.739653945f, 0.890851259f},
-std::array<float,2>{0.102153964f, 0.335261881f},
-std::array<float,2>{0.671045661f, 0.142217457f},
-std::array<float,2>{0.0476328656f, 0.587430835f},
-std::array<float,2>{0.977251709f, 0.966603339f},
-std::array<float,2>{0.261367232f, 0.294781327f},
-std::array<float,2>{0.822714329f, 0.450657994f},
-std::array<float,2>{0.423397601f, 0.840677798f},
-std::array<float,2>{0.561654806f, 0.713831484f},
-std::array<float,2>{0.129321486f, 0.0939540118f},
-std::array<float,2>{0.571415305f, 0.342466682f},
-std::array<float,2>{0.223903313f, 0.905780196f},
-std::array<float,2>{0.804498315f, 0.548952818f},
-std::array<float,2>{0.44901824f, 0.196272597f},
-std::array<float,2>{0.934505641f, 0.00854512397f},
-std::array<float,2>{0.318988919f, 0.645950198f},
-std::array<float,2>{0.70546335f, 0.778968513f},
-std::array<float,2>{0.0788067132f, 0.398623794f},
-std::array<float,2>{0.513971031f, 0.072460793f},
-std::array<float,2>{0.176320329f, 0.745046139f},
-std::array<float,2>{0.870435476f, 0.846477389f},
-std::array<float,2>{0.40474236f, 0.473664492f},
-std::array<float,2>{0.94885546f, 0.272783965f},
-std::array<float,2>{0.306106389f, 0.997547626f},
-std::array<float,2>{0.626339376f, 0.601372778f},
-std::array<float,2>{0.0266099535f, 0.171493381f},
-std::array<float,2>{0.742698431f, 0.409106344f},
-std::array<float,2>{0.0996327549f, 0.798049748f},
-std::array<float,2>{0.901427329f, 0.677402735f},
-std::array<float,2>{0.369069308f, 0.0406803563f},
-std::array<float,2>{0.773795426f, 0.235716149f},
-std::array<float,2>{0.48139742f, 0.530021846f},
-std::array<float,2>{0.615360677f, 0.913691163f},
-std::array<float,2>{0.212848634f, 0.363743722f},
-std::array<float,2>{0.599877357f, 0.204489782f},
-std::array<float,2>{0.197119713f, 0.544867575f},
-std::array<float,2>{0.758010149f, 0.888670146f},
-std::array<float,2>{0.492431074f, 0.313019603f},
-std::array<float,2>{0.881933689f, 0.38268432f},
-std::array<float,2>{0.356699973f, 0.761655688f},
-std::array<float,2>{0.730878294f, 0.626665771f},
-std::array<float,2>{0.121422477f, 0.0245183278f},
-std::array<float,2>{0.649209261f, 0.306118608f},
-std::array<float,2>{0.00443511037f, 0.942573905f},
-std::array<float,2>{0.962148964f, 0.569441438f},
-std::array<float,2>{0.293430924f, 0.134939194f},
-std::array<float,2>{0.850395858f, 0.115162157f},
-std::array<float,2>{0.377831221f, 0.698521018f},
-std::array<float,2>{0.518924057f, 0.819806755f},
-std::array<float,2>{0.164993539f, 0.456009835f},
-std::array<float,2>{0.700778723f, 0.0528242067f},
-std::array<float,2>{0.0669862404f, 0.671360135f},
-std::array<float,2>{0.910277784f, 0.784453392f},
-std::array<float,2>{0.330905467f, 0.436824948f},
-std::array<float,2>{0.782593131f, 0.348468959f},
-std::array<float,2>{0.467652589f, 0.927858591f},
-std::array<float,2>{0.579011381f, 0.508843064f},
-std::array<float,2>{0.238585547f, 0.223895878f},
-std::array<float,2>{0.546047509f, 0.49630937f},
-std::array<float,2>{0.141487807f, 0.873111546f},
-std::array<float,2>{0.832898855f, 0.724910676f},
-std::array<float,2>{0.412957221f, 0.0856937766f},
-std::array<float,2>{0.997659683f, 0.173397303f},
-std::array<float,2>{0.279309452f, 0.612400949f},
-std::array<float,2>{0.676488936f, 0.981284142f},
-std::array<float,2>{0.0438485295f, 0.262958884f},
-std::array<float,2>{0.681459785f, 0.24210012f},
-std::array<float,2>{0.0321521051f, 0.523895562f},
-std::array<float,2>{0.98537308f, 0.906903803f},
-std::array<float,2>{0.269301772f, 0.359444916f},
-std::array<float,2>{0.837373197f, 0.410199702f},
-std::array<float,2>{0.418141365f, 0.8032884f},
-std::array<float,2>{0.538768232f, 0.673498213f},
-std::array<float,2>{0.155259997f, 0.0466020778f},
-std::array<float,2>{0.591791153f, 0.267086804f},
-std::array<float,2>{0.247003824f, 0.993684888f},
-std::array<float,2>{0.793932557f, 0.596215248f},
-std::array<float,2>{0.456700772f, 0.164270952f},
-std::array<float,2>{0.918306291f, 0.0760247037f},
-std::array<float,2>{0.339834362f, 0.74853462f},
-std::array<float,2>{0.690649927f, 0.850015819f},
-std::array<float,2>{0.0749753863f, 0.470345408f},
-std::array<float,2>{0.526702821f, 0.0127686774f},
-std::array<float,2>{0.162329972f, 0.6422382f},
-std::array<float,2>{0.852585196f, 0.774605095f},
-std::array<float,2>{0.387806892f, 0.406086266f},
-std::array<float,2>{0.954961479f, 0.338536173f},
-std::array<float,2>{0.283124417f, 0.899571061f},
-std::array<float,2>{0.643290162f, 0.551605701f},
-std::array<float,2>{0.0136996722f, 0.201044127f},
-std::array<float,2>{0.723676324f, 0.447445959f},
-std::array<float,2>{0.113487445f, 0.836165607f},
-std::array<float,2>{0.888937294f, 0.716794729f},
-std::array<float,2>{0.346072972f, 0.0993520543f},
-std::array<float,2>{0.756307542f, 0.144694179f},
-std::array<float,2>{0.490283668f, 0.590512753f},
-std::array<float,2>{0.603542268f, 0.961710989f},
-std::array<float,2>{0.194119751f, 0.292454749f},
-std::array<float,2>{0.621166706f, 0.17752023f},
-std::array<float,2>{0.207696423f, 0.616423309f},
-std::array<float,2>{0.771582186f, 0.978094459f},
-std::array<float,2>{0.471553773f, 0.261091352f},
-std::array<float,2>{0.891856432f, 0.493132323f},
-std::array<float,2>{0.359503418f, 0.867360115f},
-std::array<float,2>{0.736043394f, 0.722451627f},
-std::array<float,2>{0.108838744f, 0.0791130438f},
-std::array<float,2>{0.638235271f, 0.345808744f},
-std::array<float,2>{0.0182442199f, 0.922110617f},
-std::array<float,2>{0.942507267f, 0.512093306f},
-std::array<float,2>{0.297412753f, 0.221733242f},
-std::array<float,2>{0.866590798f, 0.0468840599f},
-std::array<float,2>{0.391459584f, 0.667037189f},
-std::array<float,2>{0.507294834f, 0.785543501f},
-std::array<float,2>{0.180875167f, 0.433297932f},
-std::array<float,2>{0.711915791f, 0.109752238f},
-std::array<float,2>{0.0911642686f, 0.699596167f},
-std::array<float,2>{0.92555654f, 0.814730167f},
-std::array<float,2>{0.32086581f, 0.457216591f},
-std::array<float,2>{0.811116755f, 0.30987978f},
-std::array<float,2>{0.444715142f, 0.940177977f},
-std::array<float,2>{0.566152751f, 0.563350856f},
-std::array<float,2>{0.232658699f, 0.136770487f},
-std::array<float,2>{0.54926765f, 0.376567453f},
-std::array<float,2>{0.139546201f, 0.762472987f},
-std::array<float,2>{0.817340195f, 0.631609976f},
-std::array<float,2>{0.433909357f, 0.0290923882f},
-std::array<float,2>{0.973062515f, 0.209862649f},
-std::array<float,2>{0.255068988f, 0.542402565f},
-std::array<float,2>{0.662286222f, 0.884569824f},
-std::array<float,2>{0.0564287826f, 0.316879839f},
-std::array<float,2>{0.747771442f, 0.125566691f},
-std::array<float,2>{0.0971888453f, 0.571436226f},
-std::array<float,2>{0.902631879f, 0.947341084f},
-std::array<float,2>{0.373841554f, 0.299620599f},
-std::array<float,2>{0.778426826f, 0.465596557f},
-std::array<float,2>{0.477123618f, 0.824055195f},
-std::array<float,2>{0.61115545f, 0.693756819f},
-std::array<float,2>{0.218440905f, 0.121930026f},
-std::array<float,2>{0.50826174f, 0.323646814f},
-std::array<float,2>{0.173045918f, 0.876194298f},
-std::array<float,2>{0.8744573f, 0.537815034f},
-std::array<float,2>{0.401370317f, 0.216323748f},
-std::array<float,2>{0.949658871f, 0.0217485651f},
-std::array<float,2>{0.311859399f, 0.640218198f},
-std::array<float,2>{0.631907225f, 0.756936729f},
-std::array<float,2>{0.0305581223f, 0.383323878f},
-std::array<float,2>{0.574952006f, 0.0870262906f},
-std::array<float,2>{0.220830828f, 0.730275393f},
-std::array<float,2>{0.799549103f, 0.864563704f},
-std::array<float,2>{0.451932579f, 0.491536349f},
-std::array<float,2>{0.930421889f, 0.251271814f},
-std::array<float,2>{0.31592977f, 0.972077489f},
-std::array<float,2>{0.708272517f, 0.621343672f},
-std::array<float,2>{0.0855455995f, 0.186781704f},
-std::array<float,2>{0.667803049f, 0.42950663f},
-std::array<float,2>{0.0508072637f, 0.791958451f},
-std::array<float,2>{0.984355688f, 0.6602211f},
-std::array<float,2>{0.264865607f, 0.0571672395f},
-std::array<float,2>{0.828036726f, 0.227846771f},
-std::array<float,2>{0.426256239f, 0.500656962f},
-std::array<float,2>{0.555546284f, 0.935532868f},
-std::array<float,2>{0.128645509f, 0.357020885f},
-std::array<float,2>{0.541904032f, 0.189433947f},
-std::array<float,2>{0.147363096f, 0.55507952f},
-std::array<float,2>{0.831133544f, 0.895671606f},
-std::array<float,2>{0.407725751f, 0.329448074f},
-std::array<float,2>{0.992525697f, 0.39517194f},
-std::array<float,2>{0.275325179f, 0.772137225f},
-std::array<float,2>{0.67520231f, 0.648776233f},
-std::array<float,2>{0.0428518578f, 0.00371244433f},
-std::array<float,2>{0.696714997f, 0.28219378f},
-std::array<float,2>{0.0661730692f, 0.954828024f},
-std::array<float,2>{0.9068892f, 0.585454941f},
-std::array<float,2>{0.333697826f, 0.152406886f},
-std::array<float,2>{0.78811425f, 0.101565383f},
-std::array<float,2>{0.461977422f, 0.710020125f},
-std::array<float,2>{0.582789361f, 0.832643986f},
-std::array<float,2>{0.237866387f, 0.442882746f},
-std::array<float,2>{0.652818203f, 0.0382737257f},
-std::array<float,2>{0.00298795896f, 0.683440924f},
-std::array<float,2>{0.967245698f, 0.808752418f},
-std::array<float,2>{0.291494757f, 0.420594484f},
-std::array<float,2>{0.846776724f, 0.368484259f},
-std::array<float,2>{0.380101413f, 0.919552147f},
-std::array<float,2>{0.522014916f, 0.519655704f},
-std::array<float,2>{0.168030173f, 0.24784027f},
-std::array<float,2>{0.595996737f, 0.482236534f},
-std::array<float,2>{0.20259878f, 0.855633676f},
-std::array<float,2>{0.763239622f, 0.740325511f},
-std::array<float,2>{0.497714758f, 0.0665064976f},
-std::array<float,2>{0.875533581f, 0.156345874f},
-std::array<float,2>{0.351938397f, 0.608219743f},
-std::array<float,2>{0.727953434f, 0.991222978f},
-std::array<float,2>{0.12057396f, 0.280796856f},
-std::array<float,2>{0.693701029f, 0.213284463f},
-std::array<float,2>{0.0715214536f, 0.532449484f},
-std::array<float,2>{0.917420805f, 0.879747331f},
-std::array<float,2>{0.342804372f, 0.326737106f},
-std::array<float,2>{0.791124046f, 0.388841361f},
-std::array<float,2>{0.457348228f, 0.750482321f},
-std::array<float,2>{0.588938117f, 0.63334924f},
-std::array<float,2>{0.244576737f, 0.0176594686f},
-std::array<float,2>{0.531347811f, 0.301818639f},
-std::array<float,2>{0.149982601f, 0.950649917f},
-std::array<float,2>{0.842122495f, 0.577810347f},
-std::array<float,2>{0.41613999f, 0.132065147f},
-std::array<float,2>{0.989977837f, 0.118772484f},
-std::array<float,2>{0.273147821f, 0.690893352f},
-std::array<float,2>{0.683765888f, 0.824309051f},
-std::array<float,2>{0.0377427265f, 0.461869299f},
-std::array<float,2>{0.606110215f, 0.0601780452f},
-std::array<float,2>{0.190135404f, 0.657583356f},
-std::array<float,2>{0.750983655f, 0.793721497f},
-std::array<float,2>{0.485714614f, 0.42522648f},
-std::array<float,2>{0.882856071f, 0.351945788f},
-std::array<float,2>{0.348562837f, 0.930247545f},
-std::array<float,2>{0.721065402f, 0.506462753f},
-std::array<float,2>{0.113101132f, 0.232805103f},
-std::array<float,2>{0.64755708f, 0.486772865f},
-std::array<float,2>{0.00946172513f, 0.861616433f},
-std::array<float,2>{0.958297074f, 0.73053658f},
-std::array<float,2>{0.285593092f, 0.0915059149f},
-std::array<float,2>{0.856179595f, 0.179886654f},
-std::array<float,2>{0.38380152f, 0.620187044f},
-std::array<float,2>{0.529311836f, 0.975172281f},
-std::array<float,2>{0.158376992f, 0.254834771f},
-std::array<float,2>{0.502604067f, 0.150998965f},
-std::array<float,2>{0.186400756f, 0.580635548f},
-std::array<float,2>{0.86199379f, 0.959327161f},
-std::array<float,2>{0.395989776f, 0.287659973f},
-std::array<float,2>{0.940275908f, 0.438088f},
-std::array<float,2>{0.304300785f, 0.831030905f},
-std::array<float,2>{0.634198666f, 0.706645072f},
-std::array<float,2>{0.0208712947f, 0.107059665f},
-std::array<float,2>{0.741766572f, 0.333474189f},
-std::array<float,2>{0.104259901f, 0.893951416f},
-std::array<float,2>{0.895513713f, 0.560308576f},
-std::array<float,2>{0.364361167f, 0.191682145f},
-std::array<float,2>{0.767266572f, 0.00489201862f},
-std::array<float,2>{0.474389195f, 0.653416455f},
-std::array<float,2>{0.618338645f, 0.76880151f},
-std::array<float,2>{0.20610851f, 0.390848875f},
-std::array<float,2>{0.658796787f, 0.064854607f},
-std::array<float,2>{0.0586171746f, 0.736278355f},
-std::array<float,2>{0.971171498f, 0.853933156f},
-std::array<float,2>{0.252685428f, 0.478540987f},
-std::array<float,2>{0.815709174f, 0.275146306f},
-std::array<float,2>{0.43066898f, 0.986929357f},
-std::array<float,2>{0.552149534f, 0.602631092f},
-std::array<float,2>{0.136580527f, 0.163764626f},
-std::array<float,2>{0.568757594f, 0.415122807f},
-std::array<float,2>{0.228608385f, 0.804957747f},
-std::array<float,2>{0.806424439f, 0.687399805f},
-std::array<float,2>{0.440320462f, 0.0319727361f},
-std::array<float,2>{0.927036881f, 0.245576009f},
-std::array<float,2>{0.327042848f, 0.516118824f},
-std::array<float,2>{0.71635586f, 0.916099191f},
-std::array<float,2>{0.087536335f, 0.372467309f},
-std::array<float,2>{0.628614068f, 0.168941379f},
-std::array<float,2>{0.0253782049f, 0.599435985f},
-std::array<float,2>{0.946310759f, 0.9985618f},
-std::array<float,2>{0.30806917f, 0.269919157f},
-std::array<float,2>{0.868710876f, 0.47495684f},
-std::array<float,2>{0.402920246f, 0.845068872f},
-std::array<float,2>{0.512553871f, 0.743186355f},
-std::array<float,2>{0.178451225f, 0.0711259618f},
-std::array<float,2>{0.613422275f, 0.365872741f},
-std::array<float,2>{0.213917822f, 0.91200465f},
-std::array<float,2>{0.776350856f, 0.528568327f},
-std::array<float,2>{0.482938409f, 0.237792313f},
-std::array<float,2>{0.899203658f, 0.0415175222f},
-std::array<float,2>{0.370770335f, 0.67865634f},
-std::array<float,2>{0.744660914f, 0.800536871f},
-std::array<float,2>{0.0988791734f, 0.408083081f},
-std::array<float,2>{0.560214341f, 0.0969097465f},
-std::array<float,2>{0.132353127f, 0.711605668f},
-std::array<float,2>{0.822145045f, 0.842773139f},
-std::array<float,2>{0.424143851f, 0.4529531f},
-std::array<float,2>{0.980264485f, 0.296444476f},
-std::array<float,2>{0.259006023f, 0.968118548f},
-std::array<float,2>{0.668839693f, 0.589821219f},
-std::array<float,2>{0.0488580838f, 0.143380135f},
-std::array<float,2>{0.704764783f, 0.401232153f},
-std::array<float,2>{0.0807125121f, 0.78099966f},
-std::array<float,2>{0.936304867f, 0.646770298f},
-std::array<float,2>{0.317800254f, 0.00992162619f},
-std::array<float,2>{0.801813602f, 0.197328836f},
-std::array<float,2>{0.445415556f, 0.548512697f},
-std::array<float,2>{0.573173404f, 0.903907716f},
-std::array<float,2>{0.225221261f, 0.341619372f},
-std::array<float,2>{0.580227554f, 0.225987554f},
-std::array<float,2>{0.240709528f, 0.510590911f},
-std::array<float,2>{0.785081565f, 0.927561164f},
-std::array<float,2>{0.466034144f, 0.349683791f},
-std::array<float,2>{0.913733304f, 0.435293347f},
-std::array<float,2>{0.328582585f, 0.782016814f},
-std::array<float,2>{0.702236593f, 0.66921109f},
-std::array<float,2>{0.070287466f, 0.0516469702f},
-std::array<float,2>{0.678042412f, 0.264651835f},
-std::array<float,2>{0.0450384654f, 0.983685613f},
-std::array<float,2>{0.999255061f, 0.61102587f},
-std::array<float,2>{0.278713882f, 0.174025238f},
-std::array<float,2>{0.83487767f, 0.0833324566f},
-std::array<float,2>{0.411197543f, 0.723067105f},
-std::array<float,2>{0.543749154f, 0.87218678f},
-std::array<float,2>{0.143458307f, 0.499441564f},
-std::array<float,2>{0.733228743f, 0.0269996803f},
-std::array<float,2>{0.123067372f, 0.62753582f},
-std::array<float,2>{0.879425049f, 0.75783056f},
-std::array<float,2>{0.358359843f, 0.380174071f},
-std::array<float,2>{0.76007539f, 0.314678371f},
-std::array<float,2>{0.495779872f, 0.889505923f},
-std::array<float,2>{0.598494709f, 0.546450555f},
-std::array<float,2>{0.197300091f, 0.205412358f},
-std::array<float,2>{0.516702175f, 0.453713179f},
-std::array<float,2>{0.166359007f, 0.817141891f},
-std::array<float,2>{0.848552048f, 0.696401656f},
-std::array<float,2>{0.376760036f, 0.115635149f},
-std::array<float,2>{0.963957965f, 0.133802444f},
-std::array<float,2>{0.29681468f, 0.567229986f},
-std::array<float,2>{0.650464356f, 0.944058895f},
-std::array<float,2>{0.00718091568f, 0.307665139f},
-std::array<float,2>{0.663351238f, 0.207214311f},
-std::array<float,2>{0.0550389774f, 0.539362431f},
-std::array<float,2>{0.974025846f, 0.886583328f},
-std::array<float,2>{0.254080087f, 0.319122434f},
-std::array<float,2>{0.818190932f, 0.377178282f},
-std::array<float,2>{0.435500056f, 0.764043093f},
-std::array<float,2>{0.550118446f, 0.629866421f},
-std::array<float,2>{0.139899895f, 0.0296268426f},
-std::array<float,2>{0.565376222f, 0.312095016f},
-std::array<float,2>{0.233904317f, 0.9391734f},
-std::array<float,2>{0.811551511f, 0.565026164f},
-std::array<float,2>{0.443388045f, 0.140379325f},
-std::array<float,2>{0.924754918f, 0.111958236f},
-std::array<float,2>{0.321565688f, 0.702547312f},
-std::array<float,2>{0.711138427f, 0.813753963f},
-std::array<float,2>{0.0906604826f, 0.45977354f},
-std::array<float,2>{0.506516397f, 0.0503975786f},
-std::array<float,2>{0.180545688f, 0.664750814f},
-std::array<float,2>{0.865782797f, 0.788667381f},
-std::array<float,2>{0.391747534f, 0.430007696f},
-std::array<float,2>{0.941540778f, 0.344595492f},
-std::array<float,2>{0.298810542f, 0.924978793f},
-std::array<float,2>{0.637026906f, 0.515482008f},
-std::array<float,2>{0.0192394797f, 0.219705775f},
-std::array<float,2>{0.734760046f, 0.494578242f},
-std::array<float,2>{0.107772656f, 0.870345414f},
-std::array<float,2>{0.891504169f, 0.71983856f},
-std::array<float,2>{0.360796899f, 0.0816229507f},
-std::array<float,2>{0.773373544f, 0.178942487f},
-std::array<float,2>{0.472098291f, 0.613887846f},
-std::array<float,2>{0.622911334f, 0.978782833f},
-std::array<float,2>{0.208100513f, 0.258790076f},
-std::array<float,2>{0.60536319f, 0.147950381f},
-std::array<float,2>{0.194886655f, 0.592200041f},
-std::array<float,2>{0.757411659f, 0.964385271f},
-std::array<float,2>{0.492184967f, 0.290475875f},
-std::array<float,2>{0.889784575f, 0.445905626f},
-std::array<float,2>{0.347182631f, 0.839680314f},
-std::array<float,2>{0.72354269f, 0.7174716f},
-std::array<float,2>{0.11519406f, 0.100207433f},
-std::array<float,2>{0.643615484f, 0.336913496f},
-std::array<float,2>{0.0147504518f, 0.901323617f},
-std::array<float,2>{0.954090178f, 0.554237545f},
-std::array<float,2>{0.282141209f, 0.202401921f},
-std::array<float,2>{0.851854444f, 0.013828923f},
-std::array<float,2>{0.386867702f, 0.642992437f},
-std::array<float,2>{0.525632918f, 0.776685476f},
-std::array<float,2>{0.163951755f, 0.403179288f},
-std::array<float,2>{0.690104246f, 0.0768325552f},
-std::array<float,2>{0.0756380334f, 0.746771038f},
-std::array<float,2>{0.91912967f, 0.84880209f},
-std::array<float,2>{0.338271827f, 0.472149879f},
-std::array<float,2>{0.794312716f, 0.268461078f},
-std::array<float,2>{0.455725461f, 0.99472177f},
-std::array<float,2>{0.590199232f, 0.595294058f},
-std::array<float,2>{0.247428685f, 0.167917207f},
-std::array<float,2>{0.537951767f, 0.41235885f},
-std::array<float,2>{0.155567214f, 0.802383006f},
-std::array<float,2>{0.836127818f, 0.675075829f},
-std::array<float,2>{0.419216841f, 0.0435355678f},
-std::array<float,2>{0.98535049f, 0.238941729f},
-std::array<float,2>{0.268290102f, 0.52664572f},
-std::array<float,2>{0.680103481f, 0.908472419f},
-std::array<float,2>{0.0331915021f, 0.362521052f},
-std::array<float,2>{0.727381349f, 0.158529788f},
-std::array<float,2>{0.11945685f, 0.606402099f},
-std::array<float,2>{0.87677151f, 0.989947915f},
-std::array<float,2>{0.352881551f, 0.278338373f},
-std::array<float,2>{0.762251079f, 0.482746542f},
-std::array<float,2>{0.496899694f, 0.858437717f},
-std::array<float,2>{0.596782982f, 0.738340378f},
-std::array<float,2>{0.201570615f, 0.0686948523f},
-std::array<float,2>{0.523345649f, 0.370621562f},
-std::array<float,2>{0.169151321f, 0.921062171f},
-std::array<float,2>{0.846113801f, 0.521591961f},
-std::array<float,2>{0.37930429f, 0.24954845f},
-std::array<float,2>{0.968742549f, 0.0368690081f},
-std::array<float,2>{0.292210519f, 0.68099016f},
-std::array<float,2>{0.654004335f, 0.812146306f},
-std::array<float,2>{0.00263752975f, 0.418944508f},
-std::array<float,2>{0.583412945f, 0.103523105f},
-std::array<float,2>{0.236541152f, 0.708847702f},
-std::array<float,2>{0.787826121f, 0.834904969f},
-std::array<float,2>{0.461165816f, 0.444471508f},
-std::array<float,2>{0.907392621f, 0.284010172f},
-std::array<float,2>{0.332910717f, 0.956392527f},
-std::array<float,2>{0.696278751f, 0.582169473f},
-std::array<float,2>{0.0653849691f, 0.15509215f},
-std::array<float,2>{0.674313188f, 0.398239136f},
-std::array<float,2>{0.0419435576f, 0.770290017f},
-std::array<float,2>{0.993588507f, 0.65101248f},
-std::array<float,2>{0.273501247f, 1.14259828e-05f},
-std::array<float,2>{0.83060354f, 0.189491585f},
-std::array<float,2>{0.407101333f, 0.557777226f},
-std::array<float,2>{0.542451024f, 0.897838235f},
-std::array<float,2>{0.147733629f, 0.331083566f},
-std::array<float,2>{0.555824339f, 0.229738772f},
-std::array<float,2>{0.127617925f, 0.502759814f},
-std::array<float,2>{0.827048182f, 0.936493754f},
-std::array<float,2>{0.427574039f, 0.359295368f},
-std::array<float,2>{0.983324885f, 0.426379979f},
-std::array<float,2>{0.263894528f, 0.790155947f},
-std::array<float,2>{0.666092217f, 0.662894845f},
-std::array<float,2>{0.0521054417f, 0.0547767282f},
-std::array<float,2>{0.70764482f, 0.253893912f},
-std::array<float,2>{0.0847988501f, 0.969490528f},
-std::array<float,2>{0.93069309f, 0.623829067f},
-std::array<float,2>{0.315365344f, 0.184313282f},
-std::array<float,2>{0.800664246f, 0.0892439634f},
-std::array<float,2>{0.452628553f, 0.727220535f},
-std::array<float,2>{0.576007962f, 0.866035342f},
-std::array<float,2>{0.221999884f, 0.489545822f},
-std::array<float,2>{0.631153882f, 0.0197535418f},
-std::array<float,2>{0.0295821093f, 0.637313187f},
-std::array<float,2>{0.950737536f, 0.755054295f},
-std::array<float,2>{0.311150044f, 0.386314303f},
-std::array<float,2>{0.873737514f, 0.320973665f},
-std::array<float,2>{0.400528193f, 0.877794027f},
-std::array<float,2>{0.509129226f, 0.536210358f},
-std::array<float,2>{0.172082573f, 0.218633279f},
-std::array<float,2>{0.609941542f, 0.467060983f},
-std::array<float,2>{0.21768263f, 0.821913898f},
-std::array<float,2>{0.77797544f, 0.691815555f},
-std::array<float,2>{0.477845162f, 0.123976171f},
-std::array<float,2>{0.903494358f, 0.128775641f},
-std::array<float,2>{0.3748869f, 0.572547138f},
-std::array<float,2>{0.746645153f, 0.945982099f},
-std::array<float,2>{0.0965613276f, 0.297068119f},
-std::array<float,2>{0.71485585f, 0.24263142f},
-std::array<float,2>{0.0866043121f, 0.519076228f},
-std::array<float,2>{0.926227093f, 0.915739954f},
-std::array<float,2>{0.328053325f, 0.37346223f},
-std::array<float,2>{0.80525136f, 0.41683349f},
-std::array<float,2>{0.44121787f, 0.806644142f},
-std::array<float,2>{0.569442868f, 0.685064375f},
-std::array<float,2>{0.230260894f, 0.0334779695f},
-std::array<float,2>{0.551419497f, 0.27725774f},
-std::array<float,2>{0.134955361f, 0.985784352f},
-std::array<float,2>{0.814825773f, 0.603787839f},
-std::array<float,2>{0.43051967f, 0.16173923f},
-std::array<float,2>{0.971746087f, 0.0629578382f},
-std::array<float,2>{0.253594428f, 0.737361848f},
-std::array<float,2>{0.659302413f, 0.853226125f},
-std::array<float,2>{0.0603826679f, 0.478376746f},
-std::array<float,2>{0.61800909f, 0.00593599863f},
-std::array<float,2>{0.205876306f, 0.656028569f},
-std::array<float,2>{0.765912831f, 0.766273677f},
-std::array<float,2>{0.472881615f, 0.393004268f},
-std::array<float,2>{0.895323098f, 0.334453136f},
-std::array<float,2>{0.363880277f, 0.892071962f},
-std::array<float,2>{0.740758359f, 0.561968803f},
-std::array<float,2>{0.104893856f, 0.193368942f},
-std::array<float,2>{0.633098423f, 0.44109866f},
-std::array<float,2>{0.0201873071f, 0.829308271f},
-std::array<float,2>{0.941262007f, 0.704080582f},
-std::array<float,2>{0.303465664f, 0.108699851f},
-std::array<float,2>{0.862787843f, 0.150065556f},
-std::array<float,2>{0.395083904f, 0.578853548f},
-std::array<float,2>{0.503062546f, 0.957595468f},
-std::array<float,2>{0.187338471f, 0.286619961f},
-std::array<float,2>{0.530956388f, 0.18223612f},
-std::array<float,2>{0.159618899f, 0.618561387f},
-std::array<float,2>{0.856794178f, 0.973903239f},
-std::array<float,2>{0.382956296f, 0.256194472f},
-std::array<float,2>{0.95726496f, 0.485668212f},
-std::array<float,2>{0.28677687f, 0.859628797f},
-std::array<float,2>{0.646883428f, 0.734207451f},
-std::array<float,2>{0.00822473317f, 0.0935914144f},
-std::array<float,2>{0.722139657f, 0.354979187f},
-std::array<float,2>{0.111881115f, 0.931783676f},
-std::array<float,2>{0.884452224f, 0.505550861f},
-std::array<float,2>{0.34941414f, 0.231003016f},
-std::array<float,2>{0.750861287f, 0.062059544f},
-std::array<float,2>{0.484625548f, 0.658232689f},
-std::array<float,2>{0.607020974f, 0.795206904f},
-std::array<float,2>{0.191221237f, 0.422488183f},
-std::array<float,2>{0.684699297f, 0.119426906f},
-std::array<float,2>{0.0387767963f, 0.688993156f},
-std::array<float,2>{0.988613248f, 0.826454282f},
-std::array<float,2>{0.271832049f, 0.463931024f},
-std::array<float,2>{0.842958868f, 0.304594696f},
-std::array<float,2>{0.417666227f, 0.952132523f},
-std::array<float,2>{0.533003509f, 0.574463189f},
-std::array<float,2>{0.149245396f, 0.130729407f},
-std::array<float,2>{0.588274598f, 0.387197256f},
-std::array<float,2>{0.246045828f, 0.752245784f},
-std::array<float,2>{0.792272031f, 0.635392964f},
-std::array<float,2>{0.45807597f, 0.016280422f},
-std::array<float,2>{0.916602314f, 0.211339116f},
-std::array<float,2>{0.342669487f, 0.534325123f},
-std::array<float,2>{0.695156634f, 0.881857038f},
-std::array<float,2>{0.0708896071f, 0.324271619f},
-std::array<float,2>{0.651427746f, 0.135744214f},
-std::array<float,2>{0.00660906406f, 0.569191217f},
-std::array<float,2>{0.96337527f, 0.941496193f},
-std::array<float,2>{0.295275331f, 0.304842293f},
-std::array<float,2>{0.849241257f, 0.456410706f},
-std::array<float,2>{0.375380635f, 0.818494976f},
-std::array<float,2>{0.515716672f, 0.698186338f},
-std::array<float,2>{0.167431056f, 0.11390534f},
-std::array<float,2>{0.599446893f, 0.314334333f},
-std::array<float,2>{0.198513493f, 0.887110651f},
-std::array<float,2>{0.7614007f, 0.543065488f},
-std::array<float,2>{0.494205236f, 0.203836069f},
-std::array<float,2>{0.880633831f, 0.0241089202f},
-std::array<float,2>{0.359078258f, 0.625053942f},
-std::array<float,2>{0.733521521f, 0.760184646f},
-std::array<float,2>{0.124414876f, 0.381733447f},
-std::array<float,2>{0.544508159f, 0.0849056765f},
-std::array<float,2>{0.144443601f, 0.726034164f},
-std::array<float,2>{0.835208297f, 0.874247015f},
-std::array<float,2>{0.410748065f, 0.49785006f},
-std::array<float,2>{0.998283803f, 0.262487441f},
-std::array<float,2>{0.277495861f, 0.981674373f},
-std::array<float,2>{0.679126203f, 0.612066269f},
-std::array<float,2>{0.0462033041f, 0.172765076f},
-std::array<float,2>{0.701878071f, 0.4358491f},
-std::array<float,2>{0.0685991272f, 0.783208966f},
-std::array<float,2>{0.912874281f, 0.670378387f},
-std::array<float,2>{0.329163671f, 0.0541748442f},
-std::array<float,2>{0.783631861f, 0.223133296f},
-std::array<float,2>{0.465736449f, 0.508024037f},
-std::array<float,2>{0.581148744f, 0.929327488f},
-std::array<float,2>{0.241368875f, 0.349034727f},
-std::array<float,2>{0.573515236f, 0.196380779f},
-std::array<float,2>{0.22651124f, 0.550139666f},
-std::array<float,2>{0.801621616f, 0.905118644f},
-std::array<float,2>{0.446506858f, 0.343574435f},
-std::array<float,2>{0.93659842f, 0.400252163f},
-std::array<float,2>{0.317013055f, 0.778286636f},
-std::array<float,2>{0.70370239f, 0.645228863f},
-std::array<float,2>{0.0819900855f, 0.00941054244f},
-std::array<float,2>{0.669758916f, 0.293567985f},
-std::array<float,2>{0.0506215282f, 0.965293467f},
-std::array<float,2>{0.978625f, 0.586379409f},
-std::array<float,2>{0.25837487f, 0.141044319f},
-std::array<float,2>{0.821173072f, 0.0950958356f},
-std::array<float,2>{0.425728083f, 0.714823782f},
-std::array<float,2>{0.559140384f, 0.841064692f},
-std::array<float,2>{0.131584272f, 0.449609727f},
-std::array<float,2>{0.745415688f, 0.039203383f},
-std::array<float,2>{0.0980047733f, 0.676692307f},
-std::array<float,2>{0.900277555f, 0.797628164f},
-std::array<float,2>{0.369932801f, 0.410144448f},
-std::array<float,2>{0.776662886f, 0.365097433f},
-std::array<float,2>{0.483810544f, 0.913054824f},
-std::array<float,2>{0.614444435f, 0.530418992f},
-std::array<float,2>{0.212985739f, 0.234759822f},
-std::array<float,2>{0.512855172f, 0.472960025f},
-std::array<float,2>{0.179676563f, 0.846867323f},
-std::array<float,2>{0.867297709f, 0.746006727f},
-std::array<float,2>{0.403919756f, 0.0733593032f},
-std::array<float,2>{0.945353746f, 0.170376658f},
-std::array<float,2>{0.307581842f, 0.600317121f},
-std::array<float,2>{0.627848685f, 0.996335149f},
-std::array<float,2>{0.0240247641f, 0.272408098f},
-std::array<float,2>{0.638736844f, 0.221007839f},
-std::array<float,2>{0.0170860812f, 0.51344794f},
-std::array<float,2>{0.944960058f, 0.923769414f},
-std::array<float,2>{0.300678492f, 0.347316474f},
-std::array<float,2>{0.864891052f, 0.431764841f},
-std::array<float,2>{0.394248754f, 0.78696382f},
-std::array<float,2>{0.50547576f, 0.666530192f},
-std::array<float,2>{0.183454528f, 0.0480249077f},
-std::array<float,2>{0.623583019f, 0.260461092f},
-std::array<float,2>{0.210642278f, 0.97749722f},
-std::array<float,2>{0.770100296f, 0.615536749f},
-std::array<float,2>{0.46938777f, 0.17599158f},
-std::array<float,2>{0.893349946f, 0.0783431008f},
-std::array<float,2>{0.36189273f, 0.720861912f},
-std::array<float,2>{0.737253129f, 0.868277252f},
-std::array<float,2>{0.106957056f, 0.49330017f},
-std::array<float,2>{0.547305346f, 0.0280110389f},
-std::array<float,2>{0.138227895f, 0.632570446f},
-std::array<float,2>{0.81936276f, 0.76283443f},
-std::array<float,2>{0.437328577f, 0.375771463f},
-std::array<float,2>{0.975996912f, 0.317703426f},
-std::array<float,2>{0.257774621f, 0.883023679f},
-std::array<float,2>{0.661056995f, 0.541598856f},
-std::array<float,2>{0.0579866245f, 0.210615575f},
-std::array<float,2>{0.7133618f, 0.458313614f},
-std::array<float,2>{0.0930172056f, 0.81577903f},
-std::array<float,2>{0.923490703f, 0.701125264f},
-std::array<float,2>{0.324084342f, 0.110521808f},
-std::array<float,2>{0.810147941f, 0.138243616f},
-std::array<float,2>{0.441873401f, 0.563825309f},
-std::array<float,2>{0.563708544f, 0.940778017f},
-std::array<float,2>{0.231552169f, 0.308876842f},
-std::array<float,2>{0.59275192f, 0.165693253f},
-std::array<float,2>{0.248061091f, 0.596902251f},
-std::array<float,2>{0.795071423f, 0.992362261f},
-std::array<float,2>{0.453792542f, 0.266345739f},
-std::array<float,2>{0.920486331f, 0.469636023f},
-std::array<float,2>{0.33773917f, 0.850847423f},
-std::array<float,2>{0.68766439f, 0.74985373f},
-std::array<float,2>{0.0778591558f, 0.0748789683f},
-std::array<float,2>{0.682846189f, 0.360586792f},
-std::array<float,2>{0.0348221138f, 0.90727371f},
-std::array<float,2>{0.986506343f, 0.524819314f},
-std::array<float,2>{0.266021073f, 0.240334973f},
-std::array<float,2>{0.837946415f, 0.0454437472f},
-std::array<float,2>{0.421755433f, 0.672589362f},
-std::array<float,2>{0.536867261f, 0.804541349f},
-std::array<float,2>{0.152936056f, 0.411582679f},
-std::array<float,2>{0.725486338f, 0.0979412049f},
-std::array<float,2>{0.117074676f, 0.71545732f},
-std::array<float,2>{0.888118804f, 0.837880909f},
-std::array<float,2>{0.345386207f, 0.448992103f},
-std::array<float,2>{0.754999995f, 0.291474134f},
-std::array<float,2>{0.489015251f, 0.962172389f},
-std::array<float,2>{0.603406072f, 0.591486752f},
-std::array<float,2>{0.191939384f, 0.146297008f},
-std::array<float,2>{0.523472071f, 0.404405385f},
-std::array<float,2>{0.161927834f, 0.773959219f},
-std::array<float,2>{0.855038345f, 0.640991092f},
-std::array<float,2>{0.390210003f, 0.0118289329f},
-std::array<float,2>{0.956137955f, 0.200023323f},
-std::array<float,2>{0.283737659f, 0.551763594f},
-std::array<float,2>{0.64230144f, 0.899017453f},
-std::array<float,2>{0.0119442046f, 0.339501381f},
-std::array<float,2>{0.698928416f, 0.154036641f},
-std::array<float,2>{0.06308119f, 0.58487618f},
-std::array<float,2>{0.908832669f, 0.953677833f},
-std::array<float,2>{0.334020734f, 0.282781482f},
-std::array<float,2>{0.786313415f, 0.442381799f},
-std::array<float,2>{0.463023961f, 0.833681464f},
-std::array<float,2>{0.584091783f, 0.709900796f},
-std::array<float,2>{0.235594839f, 0.103016473f},
-std::array<float,2>{0.539850533f, 0.328584522f},
-std::array<float,2>{0.145759791f, 0.895338058f},
-std::array<float,2>{0.829588473f, 0.556275189f},
-std::array<float,2>{0.409524858f, 0.187831044f},
-std::array<float,2>{0.995326281f, 0.0020254124f},
-std::array<float,2>{0.276097208f, 0.64979881f},
-std::array<float,2>{0.672195017f, 0.773159564f},
-std::array<float,2>{0.0397001728f, 0.396175474f},
-std::array<float,2>{0.595026076f, 0.067757301f},
-std::array<float,2>{0.200666711f, 0.741918623f},
-std::array<float,2>{0.76544404f, 0.857076705f},
-std::array<float,2>{0.498310655f, 0.481254131f},
-std::array<float,2>{0.876959026f, 0.279980034f},
-std::array<float,2>{0.354187578f, 0.990667582f},
-std::array<float,2>{0.728924572f, 0.609207511f},
-std::array<float,2>{0.117923595f, 0.157764837f},
-std::array<float,2>{0.655113161f, 0.421443313f},
-std::array<float,2>{0.0014107977f, 0.810094655f},
-std::array<float,2>{0.966179729f, 0.681984425f},
-std::array<float,2>{0.289331108f, 0.0376279764f},
-std::array<float,2>{0.844382286f, 0.246209726f},
-std::array<float,2>{0.381050438f, 0.521396816f},
-std::array<float,2>{0.521051764f, 0.918597221f},
-std::array<float,2>{0.171036676f, 0.367320389f},
-std::array<float,2>{0.510779023f, 0.215343297f},
-std::array<float,2>{0.174196556f, 0.538917243f},
-std::array<float,2>{0.872356713f, 0.875138581f},
-std::array<float,2>{0.399819076f, 0.3227081f},
-std::array<float,2>{0.951751411f, 0.384035379f},
-std::array<float,2>{0.309483677f, 0.756590903f},
-std::array<float,2>{0.630854726f, 0.638770342f},
-std::array<float,2>{0.0288227648f, 0.0227024369f},
-std::array<float,2>{0.749468386f, 0.299998552f},
-std::array<float,2>{0.0953812301f, 0.948662519f},
-std::array<float,2>{0.905882299f, 0.570780814f},
-std::array<float,2>{0.371560246f, 0.126628533f},
-std::array<float,2>{0.779400289f, 0.122391753f},
-std::array<float,2>{0.479790419f, 0.695205331f},
-std::array<float,2>{0.611732364f, 0.822577417f},
-std::array<float,2>{0.216254607f, 0.466719061f},
-std::array<float,2>{0.664873779f, 0.0584102869f},
-std::array<float,2>{0.0545438491f, 0.66147697f},
-std::array<float,2>{0.9813658f, 0.792445481f},
-std::array<float,2>{0.263215393f, 0.428516686f},
-std::array<float,2>{0.825157106f, 0.355690598f},
-std::array<float,2>{0.428251624f, 0.934414923f},
-std::array<float,2>{0.556987345f, 0.500991523f},
-std::array<float,2>{0.126423225f, 0.227044284f},
-std::array<float,2>{0.577894866f, 0.491040081f},
-std::array<float,2>{0.218775496f, 0.863602519f},
-std::array<float,2>{0.79842788f, 0.728832841f},
-std::array<float,2>{0.450985968f, 0.0860349312f},
-std::array<float,2>{0.932706892f, 0.186397374f},
-std::array<float,2>{0.31407702f, 0.622705758f},
-std::array<float,2>{0.709115505f, 0.971055031f},
-std::array<float,2>{0.0836676583f, 0.250246018f},
-std::array<float,2>{0.738325179f, 0.192996159f},
-std::array<float,2>{0.103456736f, 0.559176981f},
-std::array<float,2>{0.898108602f, 0.8931638f},
-std::array<float,2>{0.366713554f, 0.33204183f},
-std::array<float,2>{0.768939734f, 0.392389119f},
-std::array<float,2>{0.475341469f, 0.767840505f},
-std::array<float,2>{0.620238304f, 0.652733505f},
-std::array<float,2>{0.203605473f, 0.00418271031f},
-std::array<float,2>{0.500798523f, 0.288407415f},
-std::array<float,2>{0.184310347f, 0.960418165f},
-std::array<float,2>{0.859478056f, 0.581207871f},
-std::array<float,2>{0.398270577f, 0.151370719f},
-std::array<float,2>{0.938290596f, 0.106149837f},
-std::array<float,2>{0.301661819f, 0.705141246f},
-std::array<float,2>{0.63596499f, 0.831280351f},
-std::array<float,2>{0.0219210256f, 0.438797086f},
-std::array<float,2>{0.567045927f, 0.0329950228f},
-std::array<float,2>{0.227555349f, 0.686065733f},
-std::array<float,2>{0.807027698f, 0.806491017f},
-std::array<float,2>{0.439055979f, 0.414234728f},
-std::array<float,2>{0.929325163f, 0.371197164f},
-std::array<float,2>{0.324259609f, 0.917814553f},
-std::array<float,2>{0.717069685f, 0.517203212f},
-std::array<float,2>{0.0881426856f, 0.244239017f},
-std::array<float,2>{0.658008575f, 0.480039835f},
-std::array<float,2>{0.0624025874f, 0.855237365f},
-std::array<float,2>{0.970675111f, 0.735274613f},
-std::array<float,2>{0.251766801f, 0.0655318499f},
-std::array<float,2>{0.813514888f, 0.162803695f},
-std::array<float,2>{0.43248865f, 0.602204978f},
-std::array<float,2>{0.55444479f, 0.987800062f},
-std::array<float,2>{0.13394399f, 0.273764849f},
-std::array<float,2>{0.533423424f, 0.131529689f},
-std::array<float,2>{0.151297227f, 0.576681137f},
-std::array<float,2>{0.84031117f, 0.949483514f},
-std::array<float,2>{0.415847331f, 0.300953567f},
-std::array<float,2>{0.991203547f, 0.462483108f},
-std::array<float,2>{0.270150959f, 0.82599926f},
-std::array<float,2>{0.686432719f, 0.689466655f},
-std::array<float,2>{0.0355535224f, 0.117729425f},
-std::array<float,2>{0.692845106f, 0.327204943f},
-std::array<float,2>{0.0726521537f, 0.880690396f},
-std::array<float,2>{0.914549172f, 0.53128624f},
-std::array<float,2>{0.340734184f, 0.214301094f},
-std::array<float,2>{0.789636493f, 0.0190185718f},
-std::array<float,2>{0.460142881f, 0.634552896f},
-std::array<float,2>{0.587754965f, 0.751784801f},
-std::array<float,2>{0.242480636f, 0.390301645f},
-std::array<float,2>{0.646325648f, 0.0900959596f},
-std::array<float,2>{0.0108340783f, 0.732124567f},
-std::array<float,2>{0.959279537f, 0.862584651f},
-std::array<float,2>{0.288373888f, 0.487725109f},
-std::array<float,2>{0.857601047f, 0.255819052f},
-std::array<float,2>{0.386650115f, 0.976472378f},
-std::array<float,2>{0.528330505f, 0.62007165f},
-std::array<float,2>{0.15649718f, 0.180806682f},
-std::array<float,2>{0.609057844f, 0.423856407f},
-std::array<float,2>{0.188383833f, 0.794549882f},
-std::array<float,2>{0.752319157f, 0.656838894f},
-std::array<float,2>{0.48751989f, 0.0594020188f},
-std::array<float,2>{0.886064768f, 0.23374477f},
-std::array<float,2>{0.351261884f, 0.507257879f},
-std::array<float,2>{0.719925046f, 0.931210995f},
-std::array<float,2>{0.110098965f, 0.353259683f},
-std::array<float,2>{0.676863432f, 0.175438061f},
-std::array<float,2>{0.0441657752f, 0.61012125f},
-std::array<float,2>{0.996875286f, 0.983369172f},
-std::array<float,2>{0.280809581f, 0.263673514f},
-std::array<float,2>{0.833683789f, 0.498504996f},
-std::array<float,2>{0.414017439f, 0.871977448f},
-std::array<float,2>{0.545650005f, 0.724341691f},
-std::array<float,2>{0.142053857f, 0.0821031854f},
-std::array<float,2>{0.579134464f, 0.350756884f},
-std::array<float,2>{0.239524215f, 0.926617026f},
-std::array<float,2>{0.781268716f, 0.511146367f},
-std::array<float,2>{0.467941999f, 0.225022435f},
-std::array<float,2>{0.912061036f, 0.0519885272f},
-std::array<float,2>{0.332023025f, 0.668264866f},
-std::array<float,2>{0.699831665f, 0.782432973f},
-std::array<float,2>{0.067526564f, 0.43395099f},
-std::array<float,2>{0.51800096f, 0.116277054f},
-std::array<float,2>{0.165669441f, 0.696029484f},
-std::array<float,2>{0.850909233f, 0.817815542f},
-std::array<float,2>{0.377957135f, 0.454513341f},
-std::array<float,2>{0.961057246f, 0.307509035f},
-std::array<float,2>{0.294432819f, 0.944842279f},
-std::array<float,2>{0.649641514f, 0.567739666f},
-std::array<float,2>{0.00490110135f, 0.133715197f},
-std::array<float,2>{0.731698871f, 0.379866809f},
-std::array<float,2>{0.122581318f, 0.759215415f},
-std::array<float,2>{0.881451607f, 0.628772199f},
-std::array<float,2>{0.355599582f, 0.0262841973f},
-std::array<float,2>{0.759563327f, 0.206927747f},
-std::array<float,2>{0.493458867f, 0.545379758f},
-std::array<float,2>{0.600732327f, 0.890364349f},
-std::array<float,2>{0.196272299f, 0.31584695f},
-std::array<float,2>{0.616977453f, 0.236586228f},
-std::array<float,2>{0.211255118f, 0.527548552f},
-std::array<float,2>{0.775385082f, 0.911010027f},
-std::array<float,2>{0.481577188f, 0.366455674f},
-std::array<float,2>{0.900489271f, 0.406520367f},
-std::array<float,2>{0.36760059f, 0.799300015f},
-std::array<float,2>{0.743603587f, 0.67934984f},
-std::array<float,2>{0.100898258f, 0.0426271781f},
-std::array<float,2>{0.625492334f, 0.271421343f},
-std::array<float,2>{0.0259245913f, 0.999302328f},
-std::array<float,2>{0.947542131f, 0.597999275f},
-std::array<float,2>{0.304792732f, 0.169561848f},
-std::array<float,2>{0.86986202f, 0.0722294003f},
-std::array<float,2>{0.405699313f, 0.743065953f},
-std::array<float,2>{0.514992416f, 0.8438344f},
-std::array<float,2>{0.177497938f, 0.475695133f},
-std::array<float,2>{0.706992447f, 0.0111166574f},
-std::array<float,2>{0.0793508664f, 0.647937655f},
-std::array<float,2>{0.934989393f, 0.779326081f},
-std::array<float,2>{0.319371253f, 0.401398063f},
-std::array<float,2>{0.803074718f, 0.340207011f},
-std::array<float,2>{0.447534949f, 0.903167546f},
-std::array<float,2>{0.570538104f, 0.546970725f},
-std::array<float,2>{0.223353654f, 0.198411569f},
-std::array<float,2>{0.560899198f, 0.451612413f},
-std::array<float,2>{0.130169243f, 0.843276739f},
-std::array<float,2>{0.82337904f, 0.712743342f},
-std::array<float,2>{0.421981245f, 0.0962302685f},
-std::array<float,2>{0.977975309f, 0.144338578f},
-std::array<float,2>{0.26032275f, 0.588311136f},
-std::array<float,2>{0.670249164f, 0.967545927f},
-std::array<float,2>{0.0483647436f, 0.295614183f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.88174206f, 0.0680637211f},
-std::array<float,2>{0.0683181733f, 0.888568521f},
-std::array<float,2>{0.390337408f, 0.38272059f},
-std::array<float,2>{0.738335252f, 0.743459582f},
-std::array<float,2>{0.619684756f, 0.343173593f},
-std::array<float,2>{0.274724454f, 0.567476153f},
-std::array<float,2>{0.246955678f, 0.195483848f},
-std::array<float,2>{0.871043026f, 0.787086666f},
-std::array<float,2>{0.789527357f, 0.489498466f},
-std::array<float,2>{0.145839676f, 0.633097589f},
-std::array<float,2>{0.355020016f, 0.0316112526f},
-std::array<float,2>{0.511252105f, 0.99368763f},
-std::array<float,2>{0.631083071f, 0.174894691f},
-std::array<float,2>{0.464639753f, 0.860229492f},
-std::array<float,2>{0.0522565916f, 0.26410681f},
-std::array<float,2>{0.994561493f, 0.549068689f},
-std::array<float,2>{0.813366115f, 0.228621364f},
-std::array<float,2>{0.211752519f, 0.772885203f},
-std::array<float,2>{0.281283855f, 0.354246259f},
-std::array<float,2>{0.586179554f, 0.624574542f},
-std::array<float,2>{0.692071855f, 0.417635649f},
-std::array<float,2>{0.413622856f, 0.716867268f},
-std::array<float,2>{0.123371422f, 0.100814253f},
-std::array<float,2>{0.925523281f, 0.933705926f},
-std::array<float,2>{0.947254896f, 0.283913493f},
-std::array<float,2>{0.00379470945f, 0.51466167f},
-std::array<float,2>{0.499635249f, 0.127018854f},
-std::array<float,2>{0.660011292f, 0.840276241f},
-std::array<float,2>{0.546808183f, 0.0153252054f},
-std::array<float,2>{0.321483433f, 0.953217268f},
-std::array<float,2>{0.164108396f, 0.447571665f},
-std::array<float,2>{0.765931427f, 0.666221619f},
-std::array<float,2>{0.759462416f, 0.0554771982f},
-std::array<float,2>{0.179837346f, 0.973359823f},
-std::array<float,2>{0.342399985f, 0.477892965f},
-std::array<float,2>{0.551668108f, 0.644839704f},
-std::array<float,2>{0.672018051f, 0.276214361f},
-std::array<float,2>{0.47486195f, 0.542219102f},
-std::array<float,2>{0.0279622711f, 0.166566238f},
-std::array<float,2>{0.963083982f, 0.855014682f},
-std::array<float,2>{0.911760092f, 0.395834059f},
-std::array<float,2>{0.10644915f, 0.729093134f},
-std::array<float,2>{0.436849147f, 0.0845277607f},
-std::array<float,2>{0.718061268f, 0.903220952f},
-std::array<float,2>{0.568080902f, 0.213895559f},
-std::array<float,2>{0.303254694f, 0.805178344f},
-std::array<float,2>{0.187526882f, 0.319874048f},
-std::array<float,2>{0.830176473f, 0.584586143f},
-std::array<float,2>{0.983103156f, 0.148719609f},
-std::array<float,2>{0.038427908f, 0.817164183f},
-std::array<float,2>{0.44174698f, 0.299497396f},
-std::array<float,2>{0.649179757f, 0.517572999f},
-std::array<float,2>{0.525734127f, 0.466973573f},
-std::array<float,2>{0.370976985f, 0.672709048f},
-std::array<float,2>{0.135600194f, 0.0163025465f},
-std::array<float,2>{0.805859923f, 0.945099473f},
-std::array<float,2>{0.857068717f, 0.367528617f},
-std::array<float,2>{0.22563006f, 0.59675473f},
-std::array<float,2>{0.255219311f, 0.237364054f},
-std::array<float,2>{0.594641089f, 0.756492972f},
-std::array<float,2>{0.730350554f, 0.116442211f},
-std::array<float,2>{0.405890107f, 0.918370068f},
-std::array<float,2>{0.0892401785f, 0.432249784f},
-std::array<float,2>{0.894743443f, 0.693311274f},
-std::array<float,2>{0.954931557f, 0.0279770698f},
-std::array<float,2>{0.0213531554f, 0.949289382f},
-std::array<float,2>{0.481006384f, 0.456516683f},
-std::array<float,2>{0.680530667f, 0.681433141f},
-std::array<float,2>{0.555701852f, 0.30634287f},
-std::array<float,2>{0.330550045f, 0.526981294f},
-std::array<float,2>{0.172301605f, 0.14811936f},
-std::array<float,2>{0.751443148f, 0.826518297f},
-std::array<float,2>{0.8392542f, 0.429228187f},
-std::array<float,2>{0.200503334f, 0.695480406f},
-std::array<float,2>{0.312339246f, 0.121999688f},
-std::array<float,2>{0.576695383f, 0.90672791f},
-std::array<float,2>{0.710446298f, 0.247548848f},
-std::array<float,2>{0.427350342f, 0.763155878f},
-std::array<float,2>{0.0973434299f, 0.364799529f},
-std::array<float,2>{0.919752359f, 0.603717566f},
-std::array<float,2>{0.799111426f, 0.162647232f},
-std::array<float,2>{0.126602039f, 0.8445611f},
-std::array<float,2>{0.361869425f, 0.271095723f},
-std::array<float,2>{0.518788338f, 0.53753984f},
-std::array<float,2>{0.644572735f, 0.470349759f},
-std::array<float,2>{0.449861377f, 0.654081643f},
-std::array<float,2>{0.0430330634f, 0.0500205643f},
-std::array<float,2>{0.972480893f, 0.978603303f},
-std::array<float,2>{0.904096007f, 0.327947676f},
-std::array<float,2>{0.082308054f, 0.587063611f},
-std::array<float,2>{0.396046311f, 0.206406549f},
-std::array<float,2>{0.724019468f, 0.800393105f},
-std::array<float,2>{0.601581514f, 0.0874420181f},
-std::array<float,2>{0.259846359f, 0.896776021f},
-std::array<float,2>{0.228361502f, 0.401652873f},
-std::array<float,2>{0.850046337f, 0.723534405f},
-std::array<float,2>{0.860017478f, 0.106460296f},
-std::array<float,2>{0.234894529f, 0.923039615f},
-std::array<float,2>{0.272842288f, 0.409106672f},
-std::array<float,2>{0.616704404f, 0.708297491f},
-std::array<float,2>{0.747785866f, 0.343825191f},
-std::array<float,2>{0.382526785f, 0.616212845f},
-std::array<float,2>{0.0741863176f, 0.222243786f},
-std::array<float,2>{0.884672165f, 0.776426911f},
-std::array<float,2>{0.985076725f, 0.444578707f},
-std::array<float,2>{0.0572782606f, 0.659704506f},
-std::array<float,2>{0.456016898f, 0.00213345769f},
-std::array<float,2>{0.637908101f, 0.964333892f},
-std::array<float,2>{0.500615954f, 0.13760744f},
-std::array<float,2>{0.348949581f, 0.830054522f},
-std::array<float,2>{0.151643127f, 0.293234795f},
-std::array<float,2>{0.787029266f, 0.505144715f},
-std::array<float,2>{0.93324399f, 0.189849347f},
-std::array<float,2>{0.116320558f, 0.79075408f},
-std::array<float,2>{0.420445681f, 0.333363026f},
-std::array<float,2>{0.70162046f, 0.57728225f},
-std::array<float,2>{0.584341526f, 0.384855092f},
-std::array<float,2>{0.290997207f, 0.741035163f},
-std::array<float,2>{0.20853287f, 0.0723425597f},
-std::array<float,2>{0.820888758f, 0.878441334f},
-std::array<float,2>{0.777386189f, 0.253468543f},
-std::array<float,2>{0.156446323f, 0.559629202f},
-std::array<float,2>{0.320209742f, 0.184249714f},
-std::array<float,2>{0.532874882f, 0.870245814f},
-std::array<float,2>{0.667935252f, 0.041236043f},
-std::array<float,2>{0.488679707f, 0.984777927f},
-std::array<float,2>{0.00945432577f, 0.492316067f},
-std::array<float,2>{0.943448126f, 0.631029665f},
-std::array<float,2>{0.916332841f, 0.0371498056f},
-std::array<float,2>{0.0997006968f, 0.996307671f},
-std::array<float,2>{0.423462123f, 0.484927148f},
-std::array<float,2>{0.70680666f, 0.638926923f},
-std::array<float,2>{0.571173728f, 0.26040566f},
-std::array<float,2>{0.307169884f, 0.552782655f},
-std::array<float,2>{0.195477828f, 0.177689001f},
-std::array<float,2>{0.841694772f, 0.866756022f},
-std::array<float,2>{0.75669533f, 0.375504345f},
-std::array<float,2>{0.176538542f, 0.749153197f},
-std::array<float,2>{0.334724307f, 0.0653137043f},
-std::array<float,2>{0.561126888f, 0.886459708f},
-std::array<float,2>{0.684440196f, 0.199587822f},
-std::array<float,2>{0.476566792f, 0.782520771f},
-std::array<float,2>{0.0185206551f, 0.3359721f},
-std::array<float,2>{0.95907867f, 0.564899445f},
-std::array<float,2>{0.847397506f, 0.129034415f},
-std::array<float,2>{0.23078616f, 0.836973488f},
-std::array<float,2>{0.265210003f, 0.285419703f},
-std::array<float,2>{0.608367324f, 0.509271502f},
-std::array<float,2>{0.718983173f, 0.452913523f},
-std::array<float,2>{0.392181963f, 0.668663323f},
-std::array<float,2>{0.0814250037f, 0.011324388f},
-std::array<float,2>{0.8999874f, 0.957445621f},
-std::array<float,2>{0.976544559f, 0.356530219f},
-std::array<float,2>{0.0404105522f, 0.62075448f},
-std::array<float,2>{0.446432054f, 0.232673258f},
-std::array<float,2>{0.641687512f, 0.767686129f},
-std::array<float,2>{0.523433387f, 0.0972438753f},
-std::array<float,2>{0.365483999f, 0.930730581f},
-std::array<float,2>{0.130115315f, 0.420979738f},
-std::array<float,2>{0.802764535f, 0.714082718f},
-std::array<float,2>{0.783066332f, 0.0784572661f},
-std::array<float,2>{0.156069666f, 0.901852608f},
-std::array<float,2>{0.344854534f, 0.393044114f},
-std::array<float,2>{0.504297256f, 0.733001947f},
-std::array<float,2>{0.634505093f, 0.313940912f},
-std::array<float,2>{0.457309067f, 0.580560207f},
-std::array<float,2>{0.0589806139f, 0.215801522f},
-std::array<float,2>{0.988732696f, 0.811898887f},
-std::array<float,2>{0.887103498f, 0.482519031f},
-std::array<float,2>{0.0752355903f, 0.642922342f},
-std::array<float,2>{0.376847953f, 0.060438931f},
-std::array<float,2>{0.743509412f, 0.971782029f},
-std::array<float,2>{0.610198081f, 0.169264436f},
-std::array<float,2>{0.266797632f, 0.856889069f},
-std::array<float,2>{0.24179174f, 0.277709603f},
-std::array<float,2>{0.86648953f, 0.54300487f},
-std::array<float,2>{0.937697947f, 0.239996746f},
-std::array<float,2>{0.0147814443f, 0.753340304f},
-std::array<float,2>{0.487056613f, 0.374925494f},
-std::array<float,2>{0.67100805f, 0.600770712f},
-std::array<float,2>{0.538409293f, 0.433819115f},
-std::array<float,2>{0.313303888f, 0.688648582f},
-std::array<float,2>{0.163481981f, 0.110447146f},
-std::array<float,2>{0.77549541f, 0.917164147f},
-std::array<float,2>{0.824770808f, 0.302030891f},
-std::array<float,2>{0.206678897f, 0.521108806f},
-std::array<float,2>{0.293857664f, 0.153164864f},
-std::array<float,2>{0.581966698f, 0.815690935f},
-std::array<float,2>{0.69598043f, 0.0205300134f},
-std::array<float,2>{0.417177796f, 0.940607846f},
-std::array<float,2>{0.109587125f, 0.462879866f},
-std::array<float,2>{0.93492794f, 0.677126706f},
-std::array<float,2>{0.996322453f, 0.118666954f},
-std::array<float,2>{0.04961605f, 0.911851764f},
-std::array<float,2>{0.466093838f, 0.425403625f},
-std::array<float,2>{0.627096355f, 0.700656593f},
-std::array<float,2>{0.513579667f, 0.361323297f},
-std::array<float,2>{0.358342081f, 0.608183622f},
-std::array<float,2>{0.140970737f, 0.243709937f},
-std::array<float,2>{0.794867992f, 0.759013891f},
-std::array<float,2>{0.873292208f, 0.46046558f},
-std::array<float,2>{0.243265927f, 0.686601102f},
-std::array<float,2>{0.278340816f, 0.0264767036f},
-std::array<float,2>{0.624724209f, 0.949122548f},
-std::array<float,2>{0.736226678f, 0.140881568f},
-std::array<float,2>{0.386120439f, 0.822824776f},
-std::array<float,2>{0.0636176839f, 0.312017918f},
-std::array<float,2>{0.876066983f, 0.531097889f},
-std::array<float,2>{0.77319473f, 0.207981616f},
-std::array<float,2>{0.168061584f, 0.801516235f},
-std::array<float,2>{0.32511273f, 0.320646763f},
-std::array<float,2>{0.539499402f, 0.593747377f},
-std::array<float,2>{0.660442233f, 0.404914469f},
-std::array<float,2>{0.492503136f, 0.719108403f},
-std::array<float,2>{0.00569614163f, 0.0903600156f},
-std::array<float,2>{0.94964236f, 0.891266823f},
-std::array<float,2>{0.925798357f, 0.266793042f},
-std::array<float,2>{0.12093401f, 0.531660259f},
-std::array<float,2>{0.407542735f, 0.156799868f},
-std::array<float,2>{0.688720524f, 0.848891973f},
-std::array<float,2>{0.591682673f, 0.0511720404f},
-std::array<float,2>{0.286397487f, 0.981794477f},
-std::array<float,2>{0.215661794f, 0.475185901f},
-std::array<float,2>{0.818739116f, 0.651077747f},
-std::array<float,2>{0.834815681f, 0.00603001006f},
-std::array<float,2>{0.194895446f, 0.967935026f},
-std::array<float,2>{0.298657775f, 0.440969944f},
-std::array<float,2>{0.563883364f, 0.660272956f},
-std::array<float,2>{0.711681306f, 0.289609492f},
-std::array<float,2>{0.432982892f, 0.502058804f},
-std::array<float,2>{0.103198119f, 0.134958863f},
-std::array<float,2>{0.907747567f, 0.834530473f},
-std::array<float,2>{0.967867911f, 0.410387188f},
-std::array<float,2>{0.0254188478f, 0.706289649f},
-std::array<float,2>{0.470988721f, 0.101879135f},
-std::array<float,2>{0.678114295f, 0.928452134f},
-std::array<float,2>{0.547548294f, 0.224223405f},
-std::array<float,2>{0.33715573f, 0.78057164f},
-std::array<float,2>{0.184689775f, 0.350102454f},
-std::array<float,2>{0.762315571f, 0.611292541f},
-std::array<float,2>{0.894324124f, 0.180325016f},
-std::array<float,2>{0.0916185156f, 0.873438716f},
-std::array<float,2>{0.399362564f, 0.254882276f},
-std::array<float,2>{0.731412053f, 0.555941761f},
-std::array<float,2>{0.598466814f, 0.49659884f},
-std::array<float,2>{0.251411229f, 0.627790987f},
-std::array<float,2>{0.218974769f, 0.0448803119f},
-std::array<float,2>{0.853042245f, 0.991431236f},
-std::array<float,2>{0.812151492f, 0.33109054f},
-std::array<float,2>{0.137197524f, 0.574004114f},
-std::array<float,2>{0.37141186f, 0.194976449f},
-std::array<float,2>{0.529030621f, 0.79625088f},
-std::array<float,2>{0.653085887f, 0.0766447559f},
-std::array<float,2>{0.438130409f, 0.879400074f},
-std::array<float,2>{0.0323597826f, 0.387614578f},
-std::array<float,2>{0.980298519f, 0.735355675f},
-std::array<float,2>{0.92359376f, 0.0995157585f},
-std::array<float,2>{0.122082695f, 0.935714841f},
-std::array<float,2>{0.410217613f, 0.415855527f},
-std::array<float,2>{0.694448113f, 0.71582365f},
-std::array<float,2>{0.589047611f, 0.351600558f},
-std::array<float,2>{0.285137892f, 0.621182919f},
-std::array<float,2>{0.213427812f, 0.228157237f},
-std::array<float,2>{0.816079915f, 0.770590067f},
-std::array<float,2>{0.769262075f, 0.446642309f},
-std::array<float,2>{0.166880429f, 0.665204704f},
-std::array<float,2>{0.323374897f, 0.0132395662f},
-std::array<float,2>{0.543002069f, 0.955724299f},
-std::array<float,2>{0.657874882f, 0.125073731f},
-std::array<float,2>{0.49682489f, 0.843158305f},
-std::array<float,2>{0.000690740591f, 0.282283694f},
-std::array<float,2>{0.948335648f, 0.513355672f},
-std::array<float,2>{0.867650151f, 0.199191093f},
-std::array<float,2>{0.249296963f, 0.788559258f},
-std::array<float,2>{0.275752276f, 0.341130465f},
-std::array<float,2>{0.619039536f, 0.569208264f},
-std::array<float,2>{0.740600944f, 0.380429715f},
-std::array<float,2>{0.387842536f, 0.745558679f},
-std::array<float,2>{0.0700735599f, 0.0700606182f},
-std::array<float,2>{0.879786372f, 0.889003098f},
-std::array<float,2>{0.993475258f, 0.262433201f},
-std::array<float,2>{0.0537184812f, 0.547990382f},
-std::array<float,2>{0.461865216f, 0.173750803f},
-std::array<float,2>{0.629830241f, 0.862823606f},
-std::array<float,2>{0.50952661f, 0.033409819f},
-std::array<float,2>{0.352027148f, 0.995470762f},
-std::array<float,2>{0.148227155f, 0.490556329f},
-std::array<float,2>{0.791624069f, 0.635166943f},
-std::array<float,2>{0.808525503f, 0.0184028279f},
-std::array<float,2>{0.134573713f, 0.941787064f},
-std::array<float,2>{0.36727196f, 0.466228127f},
-std::array<float,2>{0.524077892f, 0.673934162f},
-std::array<float,2>{0.650390685f, 0.29763031f},
-std::array<float,2>{0.4438999f, 0.518686533f},
-std::array<float,2>{0.0364718847f, 0.15187721f},
-std::array<float,2>{0.981426835f, 0.819813371f},
-std::array<float,2>{0.897957385f, 0.431605011f},
-std::array<float,2>{0.0860279724f, 0.694141209f},
-std::array<float,2>{0.402939171f, 0.113954447f},
-std::array<float,2>{0.727598548f, 0.92063576f},
-std::array<float,2>{0.59674716f, 0.234511986f},
-std::array<float,2>{0.256924778f, 0.755439222f},
-std::array<float,2>{0.223539948f, 0.370212108f},
-std::array<float,2>{0.857991457f, 0.594851673f},
-std::array<float,2>{0.96212852f, 0.164728299f},
-std::array<float,2>{0.0301776938f, 0.851816237f},
-std::array<float,2>{0.473811954f, 0.275025338f},
-std::array<float,2>{0.674941838f, 0.539575815f},
-std::array<float,2>{0.553680837f, 0.479501694f},
-std::array<float,2>{0.340398163f, 0.64653337f},
-std::array<float,2>{0.183036849f, 0.0583561808f},
-std::array<float,2>{0.760919452f, 0.975878716f},
-std::array<float,2>{0.829097331f, 0.317956626f},
-std::array<float,2>{0.190514058f, 0.583655179f},
-std::array<float,2>{0.302055895f, 0.211363211f},
-std::array<float,2>{0.570246518f, 0.807465911f},
-std::array<float,2>{0.715896726f, 0.0834035128f},
-std::array<float,2>{0.434218973f, 0.904469609f},
-std::array<float,2>{0.107924461f, 0.398178577f},
-std::array<float,2>{0.912340403f, 0.728224695f},
-std::array<float,2>{0.969788134f, 0.0471329987f},
-std::array<float,2>{0.0465344377f, 0.977044582f},
-std::array<float,2>{0.451206684f, 0.471461266f},
-std::array<float,2>{0.648177028f, 0.655025601f},
-std::array<float,2>{0.516357601f, 0.273034871f},
-std::array<float,2>{0.360826135f, 0.536119223f},
-std::array<float,2>{0.128732383f, 0.161606744f},
-std::array<float,2>{0.798382461f, 0.845971167f},
-std::array<float,2>{0.848316491f, 0.398871779f},
-std::array<float,2>{0.228569329f, 0.725141346f},
-std::array<float,2>{0.259687096f, 0.0889588296f},
-std::array<float,2>{0.605179727f, 0.894982219f},
-std::array<float,2>{0.725699902f, 0.204835281f},
-std::array<float,2>{0.397531211f, 0.796982408f},
-std::array<float,2>{0.0848543942f, 0.324725032f},
-std::array<float,2>{0.90518868f, 0.589626908f},
-std::array<float,2>{0.753834188f, 0.144956216f},
-std::array<float,2>{0.175737023f, 0.824926198f},
-std::array<float,2>{0.329522908f, 0.30726856f},
-std::array<float,2>{0.557257473f, 0.524243236f},
-std::array<float,2>{0.682910264f, 0.454080254f},
-std::array<float,2>{0.484019488f, 0.682673931f},
-std::array<float,2>{0.022056181f, 0.0309235379f},
-std::array<float,2>{0.955967724f, 0.952960014f},
-std::array<float,2>{0.920252085f, 0.367070377f},
-std::array<float,2>{0.0948763788f, 0.602568805f},
-std::array<float,2>{0.429645896f, 0.248098999f},
-std::array<float,2>{0.707193315f, 0.765241981f},
-std::array<float,2>{0.576066077f, 0.12351042f},
-std::array<float,2>{0.309933722f, 0.908587873f},
-std::array<float,2>{0.202153072f, 0.426600456f},
-std::array<float,2>{0.836617172f, 0.697985113f},
-std::array<float,2>{0.822839916f, 0.0721617416f},
-std::array<float,2>{0.210041717f, 0.875984311f},
-std::array<float,2>{0.292926699f, 0.383806586f},
-std::array<float,2>{0.582601547f, 0.738326311f},
-std::array<float,2>{0.700039268f, 0.334481299f},
-std::array<float,2>{0.419070899f, 0.574928761f},
-std::array<float,2>{0.113895543f, 0.189192563f},
-std::array<float,2>{0.93017596f, 0.792661607f},
-std::array<float,2>{0.941422224f, 0.494941294f},
-std::array<float,2>{0.0110568916f, 0.629315436f},
-std::array<float,2>{0.49143517f, 0.0409300588f},
-std::array<float,2>{0.664644241f, 0.987447619f},
-std::array<float,2>{0.534479201f, 0.186872274f},
-std::array<float,2>{0.31821084f, 0.868213058f},
-std::array<float,2>{0.159221336f, 0.250050217f},
-std::array<float,2>{0.780796766f, 0.56124109f},
-std::array<float,2>{0.884788334f, 0.218819261f},
-std::array<float,2>{0.0709161982f, 0.773965538f},
-std::array<float,2>{0.379245669f, 0.347317457f},
-std::array<float,2>{0.749421299f, 0.614255428f},
-std::array<float,2>{0.613955855f, 0.407440305f},
-std::array<float,2>{0.269945115f, 0.709325135f},
-std::array<float,2>{0.237324908f, 0.107446991f},
-std::array<float,2>{0.861579716f, 0.924787164f},
-std::array<float,2>{0.787960947f, 0.295184404f},
-std::array<float,2>{0.149787679f, 0.505939782f},
-std::array<float,2>{0.351417661f, 0.139116153f},
-std::array<float,2>{0.503392279f, 0.830661893f},
-std::array<float,2>{0.640482366f, 0.000114140443f},
-std::array<float,2>{0.454819888f, 0.961969376f},
-std::array<float,2>{0.0552155785f, 0.443097293f},
-std::array<float,2>{0.98740083f, 0.657663405f},
-std::array<float,2>{0.902099669f, 0.00830354262f},
-std::array<float,2>{0.0789219663f, 0.959005833f},
-std::array<float,2>{0.394525915f, 0.449417651f},
-std::array<float,2>{0.721497476f, 0.671453834f},
-std::array<float,2>{0.60592705f, 0.287301123f},
-std::array<float,2>{0.263496459f, 0.511718392f},
-std::array<float,2>{0.232810766f, 0.131289303f},
-std::array<float,2>{0.844467938f, 0.837915182f},
-std::array<float,2>{0.801819444f, 0.418450415f},
-std::array<float,2>{0.131017089f, 0.711329579f},
-std::array<float,2>{0.364365101f, 0.0950490013f},
-std::array<float,2>{0.521218181f, 0.932485461f},
-std::array<float,2>{0.643553555f, 0.231990084f},
-std::array<float,2>{0.448760271f, 0.766496539f},
-std::array<float,2>{0.0419462658f, 0.358902663f},
-std::array<float,2>{0.972809672f, 0.618783534f},
-std::array<float,2>{0.842842102f, 0.179570273f},
-std::array<float,2>{0.198114738f, 0.864259243f},
-std::array<float,2>{0.306560516f, 0.25792855f},
-std::array<float,2>{0.574197531f, 0.550891578f},
-std::array<float,2>{0.704281569f, 0.487141073f},
-std::array<float,2>{0.425017416f, 0.638343215f},
-std::array<float,2>{0.0980940163f, 0.036441423f},
-std::array<float,2>{0.91549319f, 0.998664141f},
-std::array<float,2>{0.957666993f, 0.339020014f},
-std::array<float,2>{0.0173042286f, 0.562581956f},
-std::array<float,2>{0.479356915f, 0.202454269f},
-std::array<float,2>{0.687209427f, 0.784188092f},
-std::array<float,2>{0.560060024f, 0.0632212982f},
-std::array<float,2>{0.333421558f, 0.882859528f},
-std::array<float,2>{0.178814232f, 0.377747834f},
-std::array<float,2>{0.753935099f, 0.747773767f},
-std::array<float,2>{0.774435163f, 0.111938775f},
-std::array<float,2>{0.161635712f, 0.915175378f},
-std::array<float,2>{0.316116542f, 0.437332869f},
-std::array<float,2>{0.535348475f, 0.69132328f},
-std::array<float,2>{0.668325186f, 0.371215343f},
-std::array<float,2>{0.486081779f, 0.597886145f},
-std::array<float,2>{0.0128882872f, 0.240998566f},
-std::array<float,2>{0.941300511f, 0.75043726f},
-std::array<float,2>{0.936721683f, 0.464042693f},
-std::array<float,2>{0.112841927f, 0.678052843f},
-std::array<float,2>{0.415617794f, 0.0219528377f},
-std::array<float,2>{0.697437465f, 0.938055158f},
-std::array<float,2>{0.579352617f, 0.154907495f},
-std::array<float,2>{0.295729607f, 0.812654793f},
-std::array<float,2>{0.203844637f, 0.304009706f},
-std::array<float,2>{0.827331781f, 0.522072017f},
-std::array<float,2>{0.990674257f, 0.218734875f},
-std::array<float,2>{0.0612180904f, 0.810322046f},
-std::array<float,2>{0.460916996f, 0.316367388f},
-std::array<float,2>{0.636520982f, 0.578248501f},
-std::array<float,2>{0.507549584f, 0.392572284f},
-std::array<float,2>{0.346007854f, 0.731052577f},
-std::array<float,2>{0.153359383f, 0.0811570585f},
-std::array<float,2>{0.783508658f, 0.900326371f},
-std::array<float,2>{0.864886045f, 0.2811535f},
-std::array<float,2>{0.239330977f, 0.54623431f},
-std::array<float,2>{0.268134922f, 0.170792088f},
-std::array<float,2>{0.611408293f, 0.858021557f},
-std::array<float,2>{0.74593842f, 0.0607120134f},
-std::array<float,2>{0.378697783f, 0.970116735f},
-std::array<float,2>{0.0765117779f, 0.481232941f},
-std::array<float,2>{0.888741195f, 0.641670883f},
-std::array<float,2>{0.952459276f, 0.0930812657f},
-std::array<float,2>{0.00613838155f, 0.892732263f},
-std::array<float,2>{0.494266182f, 0.403583944f},
-std::array<float,2>{0.663061619f, 0.720908821f},
-std::array<float,2>{0.542074978f, 0.324100524f},
-std::array<float,2>{0.327432632f, 0.591685534f},
-std::array<float,2>{0.170662686f, 0.210108578f},
-std::array<float,2>{0.770709395f, 0.803197324f},
-std::array<float,2>{0.81796062f, 0.473819196f},
-std::array<float,2>{0.217961699f, 0.649792969f},
-std::array<float,2>{0.287456572f, 0.0541953705f},
-std::array<float,2>{0.593044043f, 0.984221399f},
-std::array<float,2>{0.691386998f, 0.158964127f},
-std::array<float,2>{0.408348888f, 0.851506948f},
-std::array<float,2>{0.118063673f, 0.269426078f},
-std::array<float,2>{0.928927779f, 0.534323037f},
-std::array<float,2>{0.796362221f, 0.244567841f},
-std::array<float,2>{0.144501373f, 0.760144472f},
-std::array<float,2>{0.356059849f, 0.36281389f},
-std::array<float,2>{0.515262365f, 0.60730958f},
-std::array<float,2>{0.62615031f, 0.423182756f},
-std::array<float,2>{0.466945618f, 0.702389061f},
-std::array<float,2>{0.0486403853f, 0.119673438f},
-std::array<float,2>{0.99958545f, 0.912808299f},
-std::array<float,2>{0.878155887f, 0.309627563f},
-std::array<float,2>{0.0652164668f, 0.529275477f},
-std::array<float,2>{0.383607656f, 0.143006921f},
-std::array<float,2>{0.736666203f, 0.821019411f},
-std::array<float,2>{0.623018563f, 0.0243934765f},
-std::array<float,2>{0.281145751f, 0.946286619f},
-std::array<float,2>{0.244805798f, 0.458287627f},
-std::array<float,2>{0.872961402f, 0.683596075f},
-std::array<float,2>{0.85431093f, 0.0454048514f},
-std::array<float,2>{0.221545503f, 0.990058005f},
-std::array<float,2>{0.253375351f, 0.499378979f},
-std::array<float,2>{0.600426197f, 0.626093924f},
-std::array<float,2>{0.732890904f, 0.255994201f},
-std::array<float,2>{0.402230024f, 0.557221413f},
-std::array<float,2>{0.093160212f, 0.183317468f},
-std::array<float,2>{0.891319275f, 0.872295737f},
-std::array<float,2>{0.977668643f, 0.390216529f},
-std::array<float,2>{0.0335130356f, 0.736733615f},
-std::array<float,2>{0.43998155f, 0.0743946359f},
-std::array<float,2>{0.655258596f, 0.882522643f},
-std::array<float,2>{0.530328333f, 0.193222776f},
-std::array<float,2>{0.374545872f, 0.793947101f},
-std::array<float,2>{0.139931515f, 0.328138053f},
-std::array<float,2>{0.808837235f, 0.572086215f},
-std::array<float,2>{0.909481227f, 0.134232357f},
-std::array<float,2>{0.103844956f, 0.833153427f},
-std::array<float,2>{0.430877984f, 0.291193008f},
-std::array<float,2>{0.714077592f, 0.500507891f},
-std::array<float,2>{0.565553665f, 0.437652469f},
-std::array<float,2>{0.300410002f, 0.662200391f},
-std::array<float,2>{0.192649305f, 0.00478434842f},
-std::array<float,2>{0.833423138f, 0.965322256f},
-std::array<float,2>{0.764991641f, 0.348020613f},
-std::array<float,2>{0.185836881f, 0.613257647f},
-std::array<float,2>{0.33936736f, 0.225896403f},
-std::array<float,2>{0.548925221f, 0.778558433f},
-std::array<float,2>{0.677180409f, 0.105161145f},
-std::array<float,2>{0.470479429f, 0.926876724f},
-std::array<float,2>{0.0237761158f, 0.413845658f},
-std::array<float,2>{0.965539157f, 0.704681158f},
-std::array<float,2>{0.89555943f, 0.11522378f},
-std::array<float,2>{0.088264592f, 0.921458304f},
-std::array<float,2>{0.405168176f, 0.429893821f},
-std::array<float,2>{0.729132295f, 0.695298195f},
-std::array<float,2>{0.595064044f, 0.370031893f},
-std::array<float,2>{0.254199892f, 0.594038725f},
-std::array<float,2>{0.225001052f, 0.235657424f},
-std::array<float,2>{0.855720282f, 0.754315853f},
-std::array<float,2>{0.805393279f, 0.465318322f},
-std::array<float,2>{0.136063173f, 0.67560935f},
-std::array<float,2>{0.370050222f, 0.0193094909f},
-std::array<float,2>{0.526833057f, 0.943305612f},
-std::array<float,2>{0.650261343f, 0.150393397f},
-std::array<float,2>{0.442583263f, 0.819094598f},
-std::array<float,2>{0.0380157344f, 0.298356295f},
-std::array<float,2>{0.984169543f, 0.518548727f},
-std::array<float,2>{0.83121711f, 0.212626547f},
-std::array<float,2>{0.188565552f, 0.807690859f},
-std::array<float,2>{0.304136515f, 0.316941381f},
-std::array<float,2>{0.566449463f, 0.582634091f},
-std::array<float,2>{0.71732986f, 0.397035241f},
-std::array<float,2>{0.436297357f, 0.72736299f},
-std::array<float,2>{0.106279857f, 0.0828354433f},
-std::array<float,2>{0.910573006f, 0.906193852f},
-std::array<float,2>{0.96465987f, 0.273907304f},
-std::array<float,2>{0.028415503f, 0.540928066f},
-std::array<float,2>{0.476472735f, 0.165171117f},
-std::array<float,2>{0.673081338f, 0.852557302f},
-std::array<float,2>{0.551847458f, 0.0573010966f},
-std::array<float,2>{0.342852771f, 0.97484988f},
-std::array<float,2>{0.180688784f, 0.479427636f},
-std::array<float,2>{0.758435607f, 0.647959888f},
-std::array<float,2>{0.766794145f, 0.0125616053f},
-std::array<float,2>{0.165294975f, 0.956630588f},
-std::array<float,2>{0.320680767f, 0.445572078f},
-std::array<float,2>{0.544937432f, 0.664084494f},
-std::array<float,2>{0.658363879f, 0.281855762f},
-std::array<float,2>{0.498118877f, 0.512502909f},
-std::array<float,2>{0.00266950903f, 0.126153231f},
-std::array<float,2>{0.946225286f, 0.842372894f},
-std::array<float,2>{0.924193263f, 0.414235473f},
-std::array<float,2>{0.124656953f, 0.715089917f},
-std::array<float,2>{0.412478715f, 0.0979972482f},
-std::array<float,2>{0.693092525f, 0.937034428f},
-std::array<float,2>{0.587206423f, 0.226628959f},
-std::array<float,2>{0.28299576f, 0.769669175f},
-std::array<float,2>{0.211987257f, 0.352570564f},
-std::array<float,2>{0.813665926f, 0.622704148f},
-std::array<float,2>{0.99568671f, 0.172189549f},
-std::array<float,2>{0.0509784073f, 0.861617684f},
-std::array<float,2>{0.463693202f, 0.263503313f},
-std::array<float,2>{0.63185215f, 0.547727764f},
-std::array<float,2>{0.509783268f, 0.491317898f},
-std::array<float,2>{0.353781819f, 0.636515975f},
-std::array<float,2>{0.145485222f, 0.0349297263f},
-std::array<float,2>{0.791012049f, 0.995097995f},
-std::array<float,2>{0.869638681f, 0.340072751f},
-std::array<float,2>{0.247843087f, 0.570118368f},
-std::array<float,2>{0.273682237f, 0.19778201f},
-std::array<float,2>{0.620776772f, 0.7880072f},
-std::array<float,2>{0.739853442f, 0.0685064346f},
-std::array<float,2>{0.389024854f, 0.890088081f},
-std::array<float,2>{0.0672862604f, 0.379874587f},
-std::array<float,2>{0.882291615f, 0.744231641f},
-std::array<float,2>{0.94502753f, 0.0395313725f},
-std::array<float,2>{0.00816426426f, 0.986418009f},
-std::array<float,2>{0.489712894f, 0.496007651f},
-std::array<float,2>{0.666215658f, 0.63011986f},
-std::array<float,2>{0.53168565f, 0.251245648f},
-std::array<float,2>{0.318865716f, 0.561864078f},
-std::array<float,2>{0.15796265f, 0.185898945f},
-std::array<float,2>{0.778844178f, 0.867645442f},
-std::array<float,2>{0.822169483f, 0.383691549f},
-std::array<float,2>{0.207513392f, 0.739932537f},
-std::array<float,2>{0.289669484f, 0.0703786165f},
-std::array<float,2>{0.585475802f, 0.875436366f},
-std::array<float,2>{0.702591598f, 0.18818593f},
-std::array<float,2>{0.421329945f, 0.791745484f},
-std::array<float,2>{0.115515076f, 0.335450441f},
-std::array<float,2>{0.932568908f, 0.575920999f},
-std::array<float,2>{0.785258532f, 0.140506968f},
-std::array<float,2>{0.150846407f, 0.831460893f},
-std::array<float,2>{0.347880214f, 0.296734244f},
-std::array<float,2>{0.501048625f, 0.507651567f},
-std::array<float,2>{0.637225807f, 0.442215323f},
-std::array<float,2>{0.456603795f, 0.656298816f},
-std::array<float,2>{0.057808958f, 0.00152920734f},
-std::array<float,2>{0.985553801f, 0.96133405f},
-std::array<float,2>{0.883012295f, 0.345861912f},
-std::array<float,2>{0.0728159472f, 0.615062654f},
-std::array<float,2>{0.381440103f, 0.220573604f},
-std::array<float,2>{0.746351957f, 0.77503705f},
-std::array<float,2>{0.615483165f, 0.108629011f},
-std::array<float,2>{0.272165298f, 0.924840868f},
-std::array<float,2>{0.235995695f, 0.406957269f},
-std::array<float,2>{0.860509276f, 0.710490048f},
-std::array<float,2>{0.85101223f, 0.0887192786f},
-std::array<float,2>{0.226850957f, 0.896192372f},
-std::array<float,2>{0.261447936f, 0.400206238f},
-std::array<float,2>{0.60284996f, 0.726298153f},
-std::array<float,2>{0.723130345f, 0.325391799f},
-std::array<float,2>{0.394964993f, 0.588713348f},
-std::array<float,2>{0.0834861323f, 0.203832f},
-std::array<float,2>{0.902724087f, 0.798575938f},
-std::array<float,2>{0.971227527f, 0.472016573f},
-std::array<float,2>{0.0442141555f, 0.656131387f},
-std::array<float,2>{0.450773686f, 0.0486102886f},
-std::array<float,2>{0.64577359f, 0.978366375f},
-std::array<float,2>{0.517830133f, 0.16093643f},
-std::array<float,2>{0.363001317f, 0.847088635f},
-std::array<float,2>{0.125238538f, 0.272356629f},
-std::array<float,2>{0.80031234f, 0.536919475f},
-std::array<float,2>{0.918868721f, 0.249741644f},
-std::array<float,2>{0.0961667448f, 0.764575064f},
-std::array<float,2>{0.426471263f, 0.36567387f},
-std::array<float,2>{0.709853053f, 0.602007747f},
-std::array<float,2>{0.57779479f, 0.427729666f},
-std::array<float,2>{0.310872108f, 0.698270679f},
-std::array<float,2>{0.199729189f, 0.124084048f},
-std::array<float,2>{0.838075876f, 0.909748733f},
-std::array<float,2>{0.750912726f, 0.308339894f},
-std::array<float,2>{0.173202589f, 0.524982393f},
-std::array<float,2>{0.331967622f, 0.146361753f},
-std::array<float,2>{0.555091441f, 0.825304568f},
-std::array<float,2>{0.681141853f, 0.0296606049f},
-std::array<float,2>{0.481759936f, 0.951310754f},
-std::array<float,2>{0.0200147852f, 0.4547593f},
-std::array<float,2>{0.953370154f, 0.682210505f},
-std::array<float,2>{0.934181452f, 0.0224911869f},
-std::array<float,2>{0.111146972f, 0.939055443f},
-std::array<float,2>{0.416239679f, 0.463442057f},
-std::array<float,2>{0.696606398f, 0.679021716f},
-std::array<float,2>{0.580977023f, 0.303493917f},
-std::array<float,2>{0.294711769f, 0.522462904f},
-std::array<float,2>{0.205833137f, 0.155684158f},
-std::array<float,2>{0.825583398f, 0.813772798f},
-std::array<float,2>{0.777334452f, 0.436220497f},
-std::array<float,2>{0.162512273f, 0.689581096f},
-std::array<float,2>{0.314137548f, 0.112740524f},
-std::array<float,2>{0.53749299f, 0.914804757f},
-std::array<float,2>{0.67084986f, 0.242153585f},
-std::array<float,2>{0.487843603f, 0.751883805f},
-std::array<float,2>{0.0138436677f, 0.372440457f},
-std::array<float,2>{0.938618779f, 0.5992589f},
-std::array<float,2>{0.866012514f, 0.171804115f},
-std::array<float,2>{0.240400776f, 0.859344423f},
-std::array<float,2>{0.266284764f, 0.279785156f},
-std::array<float,2>{0.611308098f, 0.545004904f},
-std::array<float,2>{0.743056118f, 0.482231319f},
-std::array<float,2>{0.37577337f, 0.640925586f},
-std::array<float,2>{0.0747471079f, 0.0619972907f},
-std::array<float,2>{0.887780666f, 0.969070196f},
-std::array<float,2>{0.990159392f, 0.314551651f},
-std::array<float,2>{0.0598540865f, 0.57948029f},
-std::array<float,2>{0.458015442f, 0.216976345f},
-std::array<float,2>{0.633468866f, 0.809026182f},
-std::array<float,2>{0.505076528f, 0.080934085f},
-std::array<float,2>{0.344246119f, 0.898718834f},
-std::array<float,2>{0.154621214f, 0.390906274f},
-std::array<float,2>{0.781967878f, 0.73203063f},
-std::array<float,2>{0.804274797f, 0.093861632f},
-std::array<float,2>{0.129346684f, 0.933162928f},
-std::array<float,2>{0.366529733f, 0.419659883f},
-std::array<float,2>{0.522035003f, 0.712417424f},
-std::array<float,2>{0.640995979f, 0.357760012f},
-std::array<float,2>{0.445383042f, 0.618020535f},
-std::array<float,2>{0.0397377983f, 0.23116523f},
-std::array<float,2>{0.974721968f, 0.766659915f},
-std::array<float,2>{0.898934186f, 0.450956076f},
-std::array<float,2>{0.080915764f, 0.670596778f},
-std::array<float,2>{0.390852094f, 0.00919472612f},
-std::array<float,2>{0.720534563f, 0.960800707f},
-std::array<float,2>{0.609225094f, 0.132170424f},
-std::array<float,2>{0.264197409f, 0.839718759f},
-std::array<float,2>{0.231987759f, 0.288373679f},
-std::array<float,2>{0.846108556f, 0.510522306f},
-std::array<float,2>{0.960116982f, 0.202139512f},
-std::array<float,2>{0.0194892772f, 0.78345263f},
-std::array<float,2>{0.477620035f, 0.338598609f},
-std::array<float,2>{0.68544209f, 0.564027309f},
-std::array<float,2>{0.561780632f, 0.378368229f},
-std::array<float,2>{0.334991544f, 0.746888876f},
-std::array<float,2>{0.176944375f, 0.0635862201f},
-std::array<float,2>{0.756845653f, 0.884220123f},
-std::array<float,2>{0.840808451f, 0.259152532f},
-std::array<float,2>{0.196460307f, 0.551789701f},
-std::array<float,2>{0.308071494f, 0.178373307f},
-std::array<float,2>{0.572190583f, 0.864137948f},
-std::array<float,2>{0.705783844f, 0.0360327512f},
-std::array<float,2>{0.422543913f, 0.999567807f},
-std::array<float,2>{0.100886755f, 0.487494469f},
-std::array<float,2>{0.917600155f, 0.636918604f},
-std::array<float,2>{0.979237616f, 0.0760569125f},
-std::array<float,2>{0.0312673599f, 0.881254256f},
-std::array<float,2>{0.439140648f, 0.389461428f},
-std::array<float,2>{0.65395987f, 0.73762846f},
-std::array<float,2>{0.527697802f, 0.329985946f},
-std::array<float,2>{0.372488886f, 0.571247697f},
-std::array<float,2>{0.138657913f, 0.191803753f},
-std::array<float,2>{0.811353087f, 0.793187618f},
-std::array<float,2>{0.851830304f, 0.498892784f},
-std::array<float,2>{0.220663697f, 0.625833094f},
-std::array<float,2>{0.250769377f, 0.0463645346f},
-std::array<float,2>{0.599301994f, 0.988896787f},
-std::array<float,2>{0.73220706f, 0.182183519f},
-std::array<float,2>{0.399596006f, 0.871738076f},
-std::array<float,2>{0.0900633037f, 0.257541269f},
-std::array<float,2>{0.892837346f, 0.558191836f},
-std::array<float,2>{0.762816727f, 0.224688917f},
-std::array<float,2>{0.183606371f, 0.777793288f},
-std::array<float,2>{0.336862326f, 0.349298f},
-std::array<float,2>{0.547901571f, 0.611827254f},
-std::array<float,2>{0.679533243f, 0.412764192f},
-std::array<float,2>{0.472431988f, 0.70400697f},
-std::array<float,2>{0.0268675778f, 0.103895642f},
-std::array<float,2>{0.96740967f, 0.926146686f},
-std::array<float,2>{0.906807005f, 0.292005777f},
-std::array<float,2>{0.102207795f, 0.501517117f},
-std::array<float,2>{0.431860626f, 0.133537233f},
-std::array<float,2>{0.712726176f, 0.832408011f},
-std::array<float,2>{0.562569857f, 0.00513640977f},
-std::array<float,2>{0.297437161f, 0.965989411f},
-std::array<float,2>{0.193910688f, 0.438544482f},
-std::array<float,2>{0.835933328f, 0.663377166f},
-std::array<float,2>{0.819498897f, 0.0536089353f},
-std::array<float,2>{0.216548949f, 0.983048439f},
-std::array<float,2>{0.285595089f, 0.472886473f},
-std::array<float,2>{0.590725243f, 0.648485124f},
-std::array<float,2>{0.687522352f, 0.268384486f},
-std::array<float,2>{0.407207996f, 0.533567727f},
-std::array<float,2>{0.119442925f, 0.159800559f},
-std::array<float,2>{0.927110553f, 0.850570142f},
-std::array<float,2>{0.950739324f, 0.402529716f},
-std::array<float,2>{0.00436621113f, 0.722352982f},
-std::array<float,2>{0.493820161f, 0.0921049267f},
-std::array<float,2>{0.661390364f, 0.894198895f},
-std::array<float,2>{0.540912569f, 0.20991227f},
-std::array<float,2>{0.325451225f, 0.804142475f},
-std::array<float,2>{0.169742092f, 0.322358757f},
-std::array<float,2>{0.772352397f, 0.590400755f},
-std::array<float,2>{0.875743151f, 0.143793419f},
-std::array<float,2>{0.0626701638f, 0.821850181f},
-std::array<float,2>{0.385623574f, 0.308848232f},
-std::array<float,2>{0.734499931f, 0.527729213f},
-std::array<float,2>{0.623660386f, 0.45784986f},
-std::array<float,2>{0.277805924f, 0.685356975f},
-std::array<float,2>{0.24263449f, 0.0252201669f},
-std::array<float,2>{0.874172926f, 0.947237313f},
-std::array<float,2>{0.793404639f, 0.361928999f},
-std::array<float,2>{0.141712919f, 0.605665743f},
-std::array<float,2>{0.358773559f, 0.245983705f},
-std::array<float,2>{0.511882186f, 0.76144284f},
-std::array<float,2>{0.628425539f, 0.120191053f},
-std::array<float,2>{0.465773851f, 0.913530469f},
-std::array<float,2>{0.0507049561f, 0.422668129f},
-std::array<float,2>{0.997442782f, 0.701376081f},
-std::array<float,2>{0.913191855f, 0.0856568515f},
-std::array<float,2>{0.109265164f, 0.904122472f},
-std::array<float,2>{0.434748679f, 0.395071715f},
-std::array<float,2>{0.714875996f, 0.72954762f},
-std::array<float,2>{0.56848973f, 0.318374366f},
-std::array<float,2>{0.301512688f, 0.585894108f},
-std::array<float,2>{0.189540818f, 0.213551462f},
-std::array<float,2>{0.829240978f, 0.806573987f},
-std::array<float,2>{0.75995177f, 0.476825386f},
-std::array<float,2>{0.18192853f, 0.645938218f},
-std::array<float,2>{0.341576636f, 0.056000974f},
-std::array<float,2>{0.554534614f, 0.974352777f},
-std::array<float,2>{0.673959911f, 0.167198434f},
-std::array<float,2>{0.472704142f, 0.853567004f},
-std::array<float,2>{0.0311868079f, 0.276794076f},
-std::array<float,2>{0.961075127f, 0.541745126f},
-std::array<float,2>{0.858780384f, 0.237301365f},
-std::array<float,2>{0.224182665f, 0.757084668f},
-std::array<float,2>{0.256430507f, 0.368567228f},
-std::array<float,2>{0.596583664f, 0.596313536f},
-std::array<float,2>{0.727400303f, 0.433330774f},
-std::array<float,2>{0.403631896f, 0.691574275f},
-std::array<float,2>{0.0871749297f, 0.115671277f},
-std::array<float,2>{0.89710331f, 0.919515908f},
-std::array<float,2>{0.981688619f, 0.300733238f},
-std::array<float,2>{0.0356129557f, 0.516077757f},
-std::array<float,2>{0.444922894f, 0.149975866f},
-std::array<float,2>{0.65225035f, 0.817677438f},
-std::array<float,2>{0.525256634f, 0.0172244981f},
-std::array<float,2>{0.368429631f, 0.943688989f},
-std::array<float,2>{0.132947445f, 0.468031079f},
-std::array<float,2>{0.807120562f, 0.673481107f},
-std::array<float,2>{0.792793393f, 0.0324357711f},
-std::array<float,2>{0.146793485f, 0.99228847f},
-std::array<float,2>{0.352930278f, 0.48905161f},
-std::array<float,2>{0.508718908f, 0.633893907f},
-std::array<float,2>{0.630574107f, 0.265574545f},
-std::array<float,2>{0.462081283f, 0.550691664f},
-std::array<float,2>{0.0537016578f, 0.1740468f},
-std::array<float,2>{0.99299109f, 0.860817611f},
-std::array<float,2>{0.880431533f, 0.381254524f},
-std::array<float,2>{0.0688879564f, 0.742924511f},
-std::array<float,2>{0.387473434f, 0.0668360367f},
-std::array<float,2>{0.74124217f, 0.887557149f},
-std::array<float,2>{0.617359579f, 0.197173208f},
-std::array<float,2>{0.277025729f, 0.786115348f},
-std::array<float,2>{0.2481554f, 0.342008293f},
-std::array<float,2>{0.868960202f, 0.567046702f},
-std::array<float,2>{0.948039591f, 0.128515974f},
-std::array<float,2>{0.00133535499f, 0.841717601f},
-std::array<float,2>{0.497075081f, 0.284818262f},
-std::array<float,2>{0.656635225f, 0.513977408f},
-std::array<float,2>{0.544654429f, 0.448752224f},
-std::array<float,2>{0.322289139f, 0.667419553f},
-std::array<float,2>{0.167763457f, 0.0141829886f},
-std::array<float,2>{0.767888784f, 0.954706252f},
-std::array<float,2>{0.814844191f, 0.354603022f},
-std::array<float,2>{0.213984117f, 0.623492062f},
-std::array<float,2>{0.283587039f, 0.230042055f},
-std::array<float,2>{0.588804245f, 0.772167861f},
-std::array<float,2>{0.693430245f, 0.0997032225f},
-std::array<float,2>{0.411491066f, 0.934809923f},
-std::array<float,2>{0.121161252f, 0.416284919f},
-std::array<float,2>{0.922279537f, 0.718331993f},
-std::array<float,2>{0.986854315f, 0.00298019103f},
-std::array<float,2>{0.0558538027f, 0.963563681f},
-std::array<float,2>{0.453551859f, 0.443513215f},
-std::array<float,2>{0.639456332f, 0.658620596f},
-std::array<float,2>{0.5027349f, 0.294706851f},
-std::array<float,2>{0.349967927f, 0.504089713f},
-std::array<float,2>{0.149333894f, 0.13787736f},
-std::array<float,2>{0.788577139f, 0.828668118f},
-std::array<float,2>{0.862459123f, 0.409559786f},
-std::array<float,2>{0.237120152f, 0.707708061f},
-std::array<float,2>{0.271272451f, 0.106342472f},
-std::array<float,2>{0.614428997f, 0.922763646f},
-std::array<float,2>{0.748512864f, 0.221301541f},
-std::array<float,2>{0.38083446f, 0.776160061f},
-std::array<float,2>{0.0720124543f, 0.344966441f},
-std::array<float,2>{0.886713386f, 0.615375161f},
-std::array<float,2>{0.780005932f, 0.185372353f},
-std::array<float,2>{0.158537686f, 0.86980325f},
-std::array<float,2>{0.316453487f, 0.252511322f},
-std::array<float,2>{0.533420742f, 0.558674037f},
-std::array<float,2>{0.665316761f, 0.49335444f},
-std::array<float,2>{0.49027133f, 0.631866693f},
-std::array<float,2>{0.00996670872f, 0.0422377512f},
-std::array<float,2>{0.942853034f, 0.985992432f},
-std::array<float,2>{0.930994153f, 0.332759857f},
-std::array<float,2>{0.115000598f, 0.576603889f},
-std::array<float,2>{0.418725908f, 0.191386908f},
-std::array<float,2>{0.701054633f, 0.789312601f},
-std::array<float,2>{0.583537221f, 0.0737685189f},
-std::array<float,2>{0.291193247f, 0.877417028f},
-std::array<float,2>{0.209909976f, 0.385956794f},
-std::array<float,2>{0.823693573f, 0.741532922f},
-std::array<float,2>{0.837647021f, 0.122396529f},
-std::array<float,2>{0.201966286f, 0.907779276f},
-std::array<float,2>{0.309028655f, 0.428576142f},
-std::array<float,2>{0.57460618f, 0.696297169f},
-std::array<float,2>{0.708428502f, 0.364074916f},
-std::array<float,2>{0.42851305f, 0.605094135f},
-std::array<float,2>{0.0938862488f, 0.246736079f},
-std::array<float,2>{0.921080351f, 0.761833251f},
-std::array<float,2>{0.956887186f, 0.455423415f},
-std::array<float,2>{0.0231028888f, 0.680229545f},
-std::array<float,2>{0.482531726f, 0.0285487548f},
-std::array<float,2>{0.681893051f, 0.951057732f},
-std::array<float,2>{0.557978809f, 0.146952972f},
-std::array<float,2>{0.328371286f, 0.827607989f},
-std::array<float,2>{0.174772844f, 0.305311114f},
-std::array<float,2>{0.7522313f, 0.526213884f},
-std::array<float,2>{0.905762911f, 0.20513612f},
-std::array<float,2>{0.0856705606f, 0.799014747f},
-std::array<float,2>{0.396497726f, 0.326685756f},
-std::array<float,2>{0.725389123f, 0.586014986f},
-std::array<float,2>{0.604180932f, 0.400920898f},
-std::array<float,2>{0.258576244f, 0.72375232f},
-std::array<float,2>{0.229534641f, 0.0867831558f},
-std::array<float,2>{0.848983347f, 0.898213327f},
-std::array<float,2>{0.797094643f, 0.270030409f},
-std::array<float,2>{0.127329335f, 0.538886666f},
-std::array<float,2>{0.360138506f, 0.163284943f},
-std::array<float,2>{0.516787291f, 0.845008492f},
-std::array<float,2>{0.646995842f, 0.049548395f},
-std::array<float,2>{0.452299356f, 0.980297387f},
-std::array<float,2>{0.04554547f, 0.469648749f},
-std::array<float,2>{0.969238698f, 0.652635455f},
-std::array<float,2>{0.890448689f, 0.059107963f},
-std::array<float,2>{0.0780038387f, 0.971107244f},
-std::array<float,2>{0.377240956f, 0.483493388f},
-std::array<float,2>{0.7445153f, 0.6439237f},
-std::array<float,2>{0.612927079f, 0.278622001f},
-std::array<float,2>{0.268881798f, 0.544588029f},
-std::array<float,2>{0.238343492f, 0.168765351f},
-std::array<float,2>{0.863467097f, 0.855929136f},
-std::array<float,2>{0.784597516f, 0.394102871f},
-std::array<float,2>{0.153130874f, 0.733901799f},
-std::array<float,2>{0.347272128f, 0.079591237f},
-std::array<float,2>{0.506647289f, 0.900910258f},
-std::array<float,2>{0.634907186f, 0.216077507f},
-std::array<float,2>{0.459316313f, 0.810890913f},
-std::array<float,2>{0.0622363202f, 0.312873334f},
-std::array<float,2>{0.991423726f, 0.58194834f},
-std::array<float,2>{0.82653892f, 0.154175654f},
-std::array<float,2>{0.204271987f, 0.815099895f},
-std::array<float,2>{0.295954525f, 0.300982267f},
-std::array<float,2>{0.578826845f, 0.519625127f},
-std::array<float,2>{0.698324442f, 0.461055964f},
-std::array<float,2>{0.414500207f, 0.675788403f},
-std::array<float,2>{0.112272769f, 0.0202780776f},
-std::array<float,2>{0.936017692f, 0.940152287f},
-std::array<float,2>{0.940171182f, 0.373509794f},
-std::array<float,2>{0.0125123309f, 0.599712551f},
-std::array<float,2>{0.484872699f, 0.239153177f},
-std::array<float,2>{0.669457495f, 0.752152443f},
-std::array<float,2>{0.536388636f, 0.109378316f},
-std::array<float,2>{0.315239608f, 0.9165048f},
-std::array<float,2>{0.160857335f, 0.434773147f},
-std::array<float,2>{0.774173558f, 0.688259661f},
-std::array<float,2>{0.754941463f, 0.0662356913f},
-std::array<float,2>{0.178602561f, 0.885417759f},
-std::array<float,2>{0.33243528f, 0.376402825f},
-std::array<float,2>{0.559426963f, 0.748354435f},
-std::array<float,2>{0.685595334f, 0.337291598f},
-std::array<float,2>{0.479602933f, 0.565651953f},
-std::array<float,2>{0.0159740113f, 0.201034725f},
-std::array<float,2>{0.958162189f, 0.781547606f},
-std::array<float,2>{0.914205074f, 0.485548288f},
-std::array<float,2>{0.098957628f, 0.639752686f},
-std::array<float,2>{0.424788445f, 0.0385405235f},
-std::array<float,2>{0.703743517f, 0.997542739f},
-std::array<float,2>{0.57272476f, 0.175909266f},
-std::array<float,2>{0.305014133f, 0.865618765f},
-std::array<float,2>{0.198597386f, 0.261511117f},
-std::array<float,2>{0.84267199f, 0.554143488f},
-std::array<float,2>{0.974009991f, 0.233637393f},
-std::array<float,2>{0.0427239053f, 0.768986762f},
-std::array<float,2>{0.447660834f, 0.356185287f},
-std::array<float,2>{0.643596888f, 0.619771123f},
-std::array<float,2>{0.519535482f, 0.420743227f},
-std::array<float,2>{0.363905668f, 0.712943256f},
-std::array<float,2>{0.132675186f, 0.0961710811f},
-std::array<float,2>{0.801455438f, 0.929775357f},
-std::array<float,2>{0.845379293f, 0.286815226f},
-std::array<float,2>{0.233889893f, 0.50850141f},
-std::array<float,2>{0.26259923f, 0.130816534f},
-std::array<float,2>{0.607388914f, 0.836277962f},
-std::array<float,2>{0.72232151f, 0.0102775767f},
-std::array<float,2>{0.393289506f, 0.958929896f},
-std::array<float,2>{0.0798387229f, 0.451586306f},
-std::array<float,2>{0.90048486f, 0.669339836f},
-std::array<float,2>{0.965928137f, 0.102900654f},
-std::array<float,2>{0.0253047906f, 0.928892255f},
-std::array<float,2>{0.468766809f, 0.411757618f},
-std::array<float,2>{0.67644769f, 0.705589414f},
-std::array<float,2>{0.549873233f, 0.351179242f},
-std::array<float,2>{0.338662297f, 0.609644055f},
-std::array<float,2>{0.186646193f, 0.223510519f},
-std::array<float,2>{0.764582157f, 0.779917121f},
-std::array<float,2>{0.832667649f, 0.440295845f},
-std::array<float,2>{0.191712782f, 0.661562264f},
-std::array<float,2>{0.299537957f, 0.00694620376f},
-std::array<float,2>{0.564656734f, 0.967737436f},
-std::array<float,2>{0.713605285f, 0.136128932f},
-std::array<float,2>{0.429845482f, 0.835259497f},
-std::array<float,2>{0.10511294f, 0.290713787f},
-std::array<float,2>{0.908513546f, 0.503464699f},
-std::array<float,2>{0.810379148f, 0.194031179f},
-std::array<float,2>{0.138965443f, 0.795519531f},
-std::array<float,2>{0.373262912f, 0.330602765f},
-std::array<float,2>{0.52993685f, 0.572697997f},
-std::array<float,2>{0.655944169f, 0.388436586f},
-std::array<float,2>{0.440929532f, 0.73501724f},
-std::array<float,2>{0.0344741717f, 0.0781233758f},
-std::array<float,2>{0.976710796f, 0.880400479f},
-std::array<float,2>{0.892005622f, 0.255819172f},
-std::array<float,2>{0.0918393135f, 0.555563331f},
-std::array<float,2>{0.400487781f, 0.181174189f},
-std::array<float,2>{0.733412266f, 0.874238372f},
-std::array<float,2>{0.601153791f, 0.0429977924f},
-std::array<float,2>{0.252295732f, 0.99061203f},
-std::array<float,2>{0.221848741f, 0.497191668f},
-std::array<float,2>{0.855427921f, 0.628554821f},
-std::array<float,2>{0.871347189f, 0.0260031391f},
-std::array<float,2>{0.245794401f, 0.947922111f},
-std::array<float,2>{0.280159295f, 0.45975101f},
-std::array<float,2>{0.621537149f, 0.685690701f},
-std::array<float,2>{0.737605155f, 0.311186671f},
-std::array<float,2>{0.384469569f, 0.529356599f},
-std::array<float,2>{0.0660469159f, 0.141723022f},
-std::array<float,2>{0.877399325f, 0.82360357f},
-std::array<float,2>{0.998490691f, 0.423894674f},
-std::array<float,2>{0.0478172563f, 0.700060844f},
-std::array<float,2>{0.468686342f, 0.11781013f},
-std::array<float,2>{0.625769258f, 0.910901427f},
-std::array<float,2>{0.514349997f, 0.243082032f},
-std::array<float,2>{0.357112914f, 0.758315802f},
-std::array<float,2>{0.143491238f, 0.359714419f},
-std::array<float,2>{0.795038342f, 0.608627975f},
-std::array<float,2>{0.928502381f, 0.158001855f},
-std::array<float,2>{0.118693389f, 0.847982585f},
-std::array<float,2>{0.41002056f, 0.266349912f},
-std::array<float,2>{0.690025449f, 0.532912433f},
-std::array<float,2>{0.592662096f, 0.476010114f},
-std::array<float,2>{0.28845489f, 0.651927054f},
-std::array<float,2>{0.217712104f, 0.0524916686f},
-std::array<float,2>{0.816883326f, 0.981289029f},
-std::array<float,2>{0.770485699f, 0.321564585f},
-std::array<float,2>{0.171665311f, 0.592510998f},
-std::array<float,2>{0.32710138f, 0.208628714f},
-std::array<float,2>{0.541414559f, 0.80192852f},
-std::array<float,2>{0.663316846f, 0.0915525779f},
-std::array<float,2>{0.495504886f, 0.892164052f},
-std::array<float,2>{0.00729456265f, 0.405665696f},
-std::array<float,2>{0.951938868f, 0.719739556f},
-std::array<float,2>{0.903027058f, 0.0861119628f},
-std::array<float,2>{0.0835903659f, 0.897657573f},
-std::array<float,2>{0.395357847f, 0.400725633f},
-std::array<float,2>{0.723504663f, 0.724442124f},
-std::array<float,2>{0.603038013f, 0.326434076f},
-std::array<float,2>{0.261098057f, 0.586694121f},
-std::array<float,2>{0.227099031f, 0.205644161f},
-std::array<float,2>{0.851525784f, 0.799525082f},
-std::array<float,2>{0.800105155f, 0.468976885f},
-std::array<float,2>{0.125821292f, 0.652982116f},
-std::array<float,2>{0.362435997f, 0.0492106862f},
-std::array<float,2>{0.518271387f, 0.979913175f},
-std::array<float,2>{0.646203041f, 0.16406028f},
-std::array<float,2>{0.450213373f, 0.845577776f},
-std::array<float,2>{0.0448696576f, 0.269636124f},
-std::array<float,2>{0.971084654f, 0.53822726f},
-std::array<float,2>{0.838712394f, 0.246101201f},
-std::array<float,2>{0.199561566f, 0.762209475f},
-std::array<float,2>{0.311185867f, 0.3636702f},
-std::array<float,2>{0.577385128f, 0.604795456f},
-std::array<float,2>{0.709089041f, 0.427955419f},
-std::array<float,2>{0.425811619f, 0.697264493f},
-std::array<float,2>{0.0964654014f, 0.122814588f},
-std::array<float,2>{0.91825527f, 0.907300234f},
-std::array<float,2>{0.954012394f, 0.305057079f},
-std::array<float,2>{0.0203867368f, 0.525670171f},
-std::array<float,2>{0.482161224f, 0.147275537f},
-std::array<float,2>{0.681516945f, 0.827951729f},
-std::array<float,2>{0.555192769f, 0.0290550236f},
-std::array<float,2>{0.331233591f, 0.950210214f},
-std::array<float,2>{0.173522621f, 0.455714583f},
-std::array<float,2>{0.750144839f, 0.679907262f},
-std::array<float,2>{0.778557658f, 0.0425497442f},
-std::array<float,2>{0.157270268f, 0.985837281f},
-std::array<float,2>{0.318763196f, 0.493707448f},
-std::array<float,2>{0.532122672f, 0.632647872f},
-std::array<float,2>{0.666649878f, 0.252047271f},
-std::array<float,2>{0.490129203f, 0.559172571f},
-std::array<float,2>{0.00837957859f, 0.184614867f},
-std::array<float,2>{0.944599807f, 0.869540334f},
-std::array<float,2>{0.931867659f, 0.386351138f},
-std::array<float,2>{0.115776904f, 0.741708398f},
-std::array<float,2>{0.421518832f, 0.0735866278f},
-std::array<float,2>{0.70281595f, 0.877526462f},
-std::array<float,2>{0.585309505f, 0.190734923f},
-std::array<float,2>{0.28906846f, 0.790007949f},
-std::array<float,2>{0.207894012f, 0.332045823f},
-std::array<float,2>{0.821347952f, 0.576894581f},
-std::array<float,2>{0.98584348f, 0.13822557f},
-std::array<float,2>{0.0584243648f, 0.82852298f},
-std::array<float,2>{0.456063569f, 0.294151068f},
-std::array<float,2>{0.637018561f, 0.504798293f},
-std::array<float,2>{0.501619399f, 0.444309622f},
-std::array<float,2>{0.348579019f, 0.659088194f},
-std::array<float,2>{0.151316136f, 0.00370550225f},
-std::array<float,2>{0.785823882f, 0.963053465f},
-std::array<float,2>{0.860963523f, 0.345497698f},
-std::array<float,2>{0.235388339f, 0.616128206f},
-std::array<float,2>{0.271873593f, 0.220822006f},
-std::array<float,2>{0.615875363f, 0.775567174f},
-std::array<float,2>{0.746755183f, 0.105566546f},
-std::array<float,2>{0.380912334f, 0.92225486f},
-std::array<float,2>{0.0725479275f, 0.409688681f},
-std::array<float,2>{0.883662045f, 0.707207084f},
-std::array<float,2>{0.94569999f, 0.0138605637f},
-std::array<float,2>{0.00237185648f, 0.954436421f},
-std::array<float,2>{0.498797178f, 0.448532045f},
-std::array<float,2>{0.658750236f, 0.667587936f},
-std::array<float,2>{0.54581821f, 0.284633279f},
-std::array<float,2>{0.32110858f, 0.51424861f},
-std::array<float,2>{0.165945023f, 0.128284678f},
-std::array<float,2>{0.767469406f, 0.840910435f},
-std::array<float,2>{0.814116538f, 0.416565388f},
-std::array<float,2>{0.212594837f, 0.717882693f},
-std::array<float,2>{0.282435179f, 0.100541078f},
-std::array<float,2>{0.587503076f, 0.935156226f},
-std::array<float,2>{0.692584991f, 0.229527354f},
-std::array<float,2>{0.412622869f, 0.771748185f},
-std::array<float,2>{0.124086246f, 0.355145931f},
-std::array<float,2>{0.924468577f, 0.62396735f},
-std::array<float,2>{0.79010427f, 0.174355716f},
-std::array<float,2>{0.144969583f, 0.860932112f},
-std::array<float,2>{0.354022503f, 0.264854521f},
-std::array<float,2>{0.510312676f, 0.550201952f},
-std::array<float,2>{0.632686853f, 0.488342106f},
-std::array<float,2>{0.462991446f, 0.634362161f},
-std::array<float,2>{0.0516175069f, 0.0331129245f},
-std::array<float,2>{0.995479584f, 0.993141413f},
-std::array<float,2>{0.882479906f, 0.342361569f},
-std::array<float,2>{0.0666277185f, 0.566886544f},
-std::array<float,2>{0.389595926f, 0.196567118f},
-std::array<float,2>{0.739700019f, 0.785575926f},
-std::array<float,2>{0.620152831f, 0.0669242144f},
-std::array<float,2>{0.274247706f, 0.887060225f},
-std::array<float,2>{0.247469082f, 0.38162902f},
-std::array<float,2>{0.869229972f, 0.742490888f},
-std::array<float,2>{0.856066465f, 0.116182923f},
-std::array<float,2>{0.22525306f, 0.919417858f},
-std::array<float,2>{0.254505336f, 0.432911992f},
-std::array<float,2>{0.595371485f, 0.692347586f},
-std::array<float,2>{0.728539944f, 0.36876297f},
-std::array<float,2>{0.404678583f, 0.596186042f},
-std::array<float,2>{0.0886965394f, 0.236449942f},
-std::array<float,2>{0.896345437f, 0.757431686f},
-std::array<float,2>{0.983503401f, 0.468496442f},
-std::array<float,2>{0.0371868536f, 0.673191607f},
-std::array<float,2>{0.443292826f, 0.0169329736f},
-std::array<float,2>{0.649674356f, 0.944309533f},
-std::array<float,2>{0.527273893f, 0.149857298f},
-std::array<float,2>{0.369271994f, 0.817957103f},
-std::array<float,2>{0.136467397f, 0.300014019f},
-std::array<float,2>{0.805103123f, 0.516531467f},
-std::array<float,2>{0.910828412f, 0.213234022f},
-std::array<float,2>{0.105928071f, 0.805781901f},
-std::array<float,2>{0.435601979f, 0.318857402f},
-std::array<float,2>{0.717245519f, 0.585359037f},
-std::array<float,2>{0.567127883f, 0.39488852f},
-std::array<float,2>{0.304449201f, 0.730421424f},
-std::array<float,2>{0.189061627f, 0.0852992684f},
-std::array<float,2>{0.83179456f, 0.903328359f},
-std::array<float,2>{0.757854402f, 0.277334392f},
-std::array<float,2>{0.181475997f, 0.541436255f},
-std::array<float,2>{0.343537152f, 0.167544708f},
-std::array<float,2>{0.552560151f, 0.854064286f},
-std::array<float,2>{0.673614502f, 0.056565091f},
-std::array<float,2>{0.475684673f, 0.973920286f},
-std::array<float,2>{0.0292042587f, 0.477537006f},
-std::array<float,2>{0.963900149f, 0.646143019f},
-std::array<float,2>{0.927382171f, 0.0518727303f},
-std::array<float,2>{0.119799212f, 0.980738759f},
-std::array<float,2>{0.406318039f, 0.476528138f},
-std::array<float,2>{0.688108802f, 0.651693225f},
-std::array<float,2>{0.590136766f, 0.266013443f},
-std::array<float,2>{0.285952419f, 0.532678425f},
-std::array<float,2>{0.215820506f, 0.157252461f},
-std::array<float,2>{0.819893003f, 0.848521233f},
-std::array<float,2>{0.771559119f, 0.406072885f},
-std::array<float,2>{0.169234186f, 0.720518768f},
-std::array<float,2>{0.326072842f, 0.091054447f},
-std::array<float,2>{0.540454149f, 0.891729772f},
-std::array<float,2>{0.661891997f, 0.208027571f},
-std::array<float,2>{0.493477911f, 0.802367151f},
-std::array<float,2>{0.00460518105f, 0.322079599f},
-std::array<float,2>{0.950385451f, 0.591801882f},
-std::array<float,2>{0.874662578f, 0.142419741f},
-std::array<float,2>{0.242775202f, 0.823878348f},
-std::array<float,2>{0.277914912f, 0.310841203f},
-std::array<float,2>{0.623336434f, 0.530200601f},
-std::array<float,2>{0.735008299f, 0.459374368f},
-std::array<float,2>{0.384894818f, 0.686276019f},
-std::array<float,2>{0.0634035394f, 0.0254743174f},
-std::array<float,2>{0.875357211f, 0.947355807f},
-std::array<float,2>{0.997721493f, 0.360061318f},
-std::array<float,2>{0.0498951897f, 0.609351754f},
-std::array<float,2>{0.465322971f, 0.242486805f},
-std::array<float,2>{0.628116965f, 0.7582497f},
-std::array<float,2>{0.512303829f, 0.117374711f},
-std::array<float,2>{0.358966142f, 0.910279036f},
-std::array<float,2>{0.142470151f, 0.424362212f},
-std::array<float,2>{0.79367733f, 0.699534953f},
-std::array<float,2>{0.810856283f, 0.0775413811f},
-std::array<float,2>{0.137834772f, 0.880098045f},
-std::array<float,2>{0.372667909f, 0.387738138f},
-std::array<float,2>{0.528172016f, 0.734443963f},
-std::array<float,2>{0.653402865f, 0.330379039f},
-std::array<float,2>{0.438920736f, 0.572981f},
-std::array<float,2>{0.0320839249f, 0.193833455f},
-std::array<float,2>{0.978826642f, 0.7952075f},
-std::array<float,2>{0.893437147f, 0.497587442f},
-std::array<float,2>{0.0904547274f, 0.628245473f},
-std::array<float,2>{0.400094151f, 0.0436251536f},
-std::array<float,2>{0.731488526f, 0.990852237f},
-std::array<float,2>{0.598828256f, 0.181034639f},
-std::array<float,2>{0.250468045f, 0.87463361f},
-std::array<float,2>{0.219910875f, 0.254924834f},
-std::array<float,2>{0.852496386f, 0.555042982f},
-std::array<float,2>{0.966837049f, 0.222823441f},
-std::array<float,2>{0.0266234931f, 0.779683828f},
-std::array<float,2>{0.472023398f, 0.351003468f},
-std::array<float,2>{0.679081619f, 0.610044062f},
-std::array<float,2>{0.548583567f, 0.41149056f},
-std::array<float,2>{0.336083561f, 0.705534756f},
-std::array<float,2>{0.184382632f, 0.103027739f},
-std::array<float,2>{0.763593197f, 0.929226935f},
-std::array<float,2>{0.835251093f, 0.290326655f},
-std::array<float,2>{0.193537533f, 0.503253639f},
-std::array<float,2>{0.297175258f, 0.13647218f},
-std::array<float,2>{0.563116491f, 0.835768342f},
-std::array<float,2>{0.712095618f, 0.00751673523f},
-std::array<float,2>{0.432599872f, 0.966916382f},
-std::array<float,2>{0.101564921f, 0.439740449f},
-std::array<float,2>{0.906404436f, 0.661750913f},
-std::array<float,2>{0.975333393f, 0.0962557495f},
-std::array<float,2>{0.0390945859f, 0.930630505f},
-std::array<float,2>{0.44626829f, 0.420315415f},
-std::array<float,2>{0.641246378f, 0.713413358f},
-std::array<float,2>{0.521623492f, 0.355504423f},
-std::array<float,2>{0.367096633f, 0.619194746f},
-std::array<float,2>{0.129567116f, 0.234369487f},
-std::array<float,2>{0.803947687f, 0.769221127f},
-std::array<float,2>{0.846274197f, 0.451985598f},
-std::array<float,2>{0.231649756f, 0.669601202f},
-std::array<float,2>{0.263803095f, 0.00981837697f},
-std::array<float,2>{0.608621597f, 0.958031774f},
-std::array<float,2>{0.719817519f, 0.129947603f},
-std::array<float,2>{0.391218841f, 0.836554587f},
-std::array<float,2>{0.0805231854f, 0.2862885f},
-std::array<float,2>{0.898782849f, 0.507843316f},
-std::array<float,2>{0.757413447f, 0.200346798f},
-std::array<float,2>{0.177438363f, 0.78192836f},
-std::array<float,2>{0.335653663f, 0.337453038f},
-std::array<float,2>{0.562197745f, 0.565988958f},
-std::array<float,2>{0.684731364f, 0.376751751f},
-std::array<float,2>{0.478500694f, 0.748867333f},
-std::array<float,2>{0.0186593123f, 0.0655734241f},
-std::array<float,2>{0.960662007f, 0.885224283f},
-std::array<float,2>{0.917473197f, 0.261181504f},
-std::array<float,2>{0.10136757f, 0.5546785f},
-std::array<float,2>{0.421967864f, 0.176425219f},
-std::array<float,2>{0.705140293f, 0.865731001f},
-std::array<float,2>{0.571394324f, 0.0388468616f},
-std::array<float,2>{0.308454275f, 0.997917056f},
-std::array<float,2>{0.19691509f, 0.486247361f},
-std::array<float,2>{0.84030813f, 0.640163481f},
-std::array<float,2>{0.826170743f, 0.0195397492f},
-std::array<float,2>{0.205272987f, 0.939713657f},
-std::array<float,2>{0.294026464f, 0.461605668f},
-std::array<float,2>{0.580239534f, 0.676400185f},
-std::array<float,2>{0.696879804f, 0.301288873f},
-std::array<float,2>{0.416614681f, 0.52022469f},
-std::array<float,2>{0.110733405f, 0.153778926f},
-std::array<float,2>{0.933956444f, 0.814460039f},
-std::array<float,2>{0.939058781f, 0.435135812f},
-std::array<float,2>{0.0145441946f, 0.687913597f},
-std::array<float,2>{0.487758189f, 0.110261552f},
-std::array<float,2>{0.670100272f, 0.916310489f},
-std::array<float,2>{0.53785789f, 0.2383468f},
-std::array<float,2>{0.31380257f, 0.752524436f},
-std::array<float,2>{0.162659213f, 0.373805493f},
-std::array<float,2>{0.776762545f, 0.600363791f},
-std::array<float,2>{0.888520479f, 0.168197215f},
-std::array<float,2>{0.0746422112f, 0.85602212f},
-std::array<float,2>{0.375219226f, 0.279203296f},
-std::array<float,2>{0.742265344f, 0.544245303f},
-std::array<float,2>{0.610450327f, 0.484341353f},
-std::array<float,2>{0.265707761f, 0.644474804f},
-std::array<float,2>{0.240922615f, 0.0587025769f},
-std::array<float,2>{0.865587473f, 0.971586049f},
-std::array<float,2>{0.781663001f, 0.313231766f},
-std::array<float,2>{0.155104741f, 0.581127644f},
-std::array<float,2>{0.344003916f, 0.216745734f},
-std::array<float,2>{0.505577803f, 0.811227202f},
-std::array<float,2>{0.63309598f, 0.0793872923f},
-std::array<float,2>{0.458605319f, 0.900576353f},
-std::array<float,2>{0.0601580329f, 0.393732429f},
-std::array<float,2>{0.989682972f, 0.733878016f},
-std::array<float,2>{0.921592891f, 0.124808319f},
-std::array<float,2>{0.0946071595f, 0.909474432f},
-std::array<float,2>{0.42813623f, 0.427073181f},
-std::array<float,2>{0.708774567f, 0.698795438f},
-std::array<float,2>{0.574861109f, 0.365817487f},
-std::array<float,2>{0.309560448f, 0.602165699f},
-std::array<float,2>{0.201597512f, 0.249146357f},
-std::array<float,2>{0.836920261f, 0.763776064f},
-std::array<float,2>{0.752622247f, 0.454539895f},
-std::array<float,2>{0.174185723f, 0.681774855f},
-std::array<float,2>{0.328710169f, 0.0300493613f},
-std::array<float,2>{0.558460414f, 0.951958299f},
-std::array<float,2>{0.682136416f, 0.145765796f},
-std::array<float,2>{0.48320812f, 0.825883925f},
-std::array<float,2>{0.0228396505f, 0.307862252f},
-std::array<float,2>{0.956532121f, 0.524680912f},
-std::array<float,2>{0.849237561f, 0.203260794f},
-std::array<float,2>{0.230228677f, 0.798004389f},
-std::array<float,2>{0.258089274f, 0.32587263f},
-std::array<float,2>{0.603880584f, 0.588312566f},
-std::array<float,2>{0.724778116f, 0.399509579f},
-std::array<float,2>{0.3970671f, 0.726038635f},
-std::array<float,2>{0.0849931762f, 0.08808963f},
-std::array<float,2>{0.905634999f, 0.895823479f},
-std::array<float,2>{0.968846321f, 0.271679372f},
-std::array<float,2>{0.0450638533f, 0.536152542f},
-std::array<float,2>{0.452803522f, 0.160623327f},
-std::array<float,2>{0.646674395f, 0.847487986f},
-std::array<float,2>{0.517447829f, 0.0478559695f},
-std::array<float,2>{0.359645158f, 0.977906346f},
-std::array<float,2>{0.127640456f, 0.472195625f},
-std::array<float,2>{0.797603548f, 0.655610621f},
-std::array<float,2>{0.788559496f, 0.00145089207f},
-std::array<float,2>{0.148871824f, 0.961765289f},
-std::array<float,2>{0.350451976f, 0.441599399f},
-std::array<float,2>{0.502080679f, 0.657178104f},
-std::array<float,2>{0.638702989f, 0.296032459f},
-std::array<float,2>{0.453668952f, 0.506938159f},
-std::array<float,2>{0.0565663204f, 0.139880016f},
-std::array<float,2>{0.986346662f, 0.831834137f},
-std::array<float,2>{0.885774493f, 0.406473935f},
-std::array<float,2>{0.0714989603f, 0.710215271f},
-std::array<float,2>{0.380264312f, 0.109325945f},
-std::array<float,2>{0.749016285f, 0.925390482f},
-std::array<float,2>{0.61493963f, 0.219857261f},
-std::array<float,2>{0.270564616f, 0.774753034f},
-std::array<float,2>{0.236749068f, 0.346244365f},
-std::array<float,2>{0.863025308f, 0.614325523f},
-std::array<float,2>{0.943226516f, 0.186205551f},
-std::array<float,2>{0.0103524746f, 0.867956936f},
-std::array<float,2>{0.490887493f, 0.251781553f},
-std::array<float,2>{0.665771067f, 0.562460959f},
-std::array<float,2>{0.533955693f, 0.495412111f},
-std::array<float,2>{0.317078531f, 0.630519748f},
-std::array<float,2>{0.158966362f, 0.0395539068f},
-std::array<float,2>{0.779363215f, 0.986920655f},
-std::array<float,2>{0.823964894f, 0.335122496f},
-std::array<float,2>{0.209329113f, 0.575601637f},
-std::array<float,2>{0.291548401f, 0.187824026f},
-std::array<float,2>{0.583308876f, 0.791176558f},
-std::array<float,2>{0.700634539f, 0.0711736009f},
-std::array<float,2>{0.418283671f, 0.875728011f},
-std::array<float,2>{0.114602424f, 0.38312304f},
-std::array<float,2>{0.931232274f, 0.739349961f},
-std::array<float,2>{0.992505968f, 0.0346301012f},
-std::array<float,2>{0.0529309139f, 0.99455291f},
-std::array<float,2>{0.46285814f, 0.492100239f},
-std::array<float,2>{0.63026005f, 0.635905027f},
-std::array<float,2>{0.507934093f, 0.263089746f},
-std::array<float,2>{0.353342503f, 0.54725647f},
-std::array<float,2>{0.147091821f, 0.172638923f},
-std::array<float,2>{0.792346358f, 0.862143457f},
-std::array<float,2>{0.868558586f, 0.379163802f},
-std::array<float,2>{0.248573318f, 0.744868338f},
-std::array<float,2>{0.276370078f, 0.0690451637f},
-std::array<float,2>{0.617763877f, 0.890376806f},
-std::array<float,2>{0.741733789f, 0.197499663f},
-std::array<float,2>{0.387072682f, 0.787472844f},
-std::array<float,2>{0.0687023103f, 0.340685129f},
-std::array<float,2>{0.880271494f, 0.569470346f},
-std::array<float,2>{0.76832372f, 0.126500368f},
-std::array<float,2>{0.167121604f, 0.842152536f},
-std::array<float,2>{0.322764874f, 0.281463176f},
-std::array<float,2>{0.54408133f, 0.512165129f},
-std::array<float,2>{0.656932175f, 0.446051717f},
-std::array<float,2>{0.497776717f, 0.664995253f},
-std::array<float,2>{0.00175685703f, 0.0119795157f},
-std::array<float,2>{0.947375f, 0.956293881f},
-std::array<float,2>{0.922794521f, 0.353135645f},
-std::array<float,2>{0.121997535f, 0.622123957f},
-std::array<float,2>{0.41200009f, 0.227431178f},
-std::array<float,2>{0.693856239f, 0.770093143f},
-std::array<float,2>{0.588067949f, 0.0981831402f},
-std::array<float,2>{0.283777982f, 0.936929405f},
-std::array<float,2>{0.214653313f, 0.414784431f},
-std::array<float,2>{0.814965487f, 0.715676665f},
-std::array<float,2>{0.829736531f, 0.0822417289f},
-std::array<float,2>{0.190180764f, 0.905702889f},
-std::array<float,2>{0.301143289f, 0.39655301f},
-std::array<float,2>{0.568941891f, 0.726975918f},
-std::array<float,2>{0.715791166f, 0.316561729f},
-std::array<float,2>{0.435467631f, 0.582321346f},
-std::array<float,2>{0.108542316f, 0.212192401f},
-std::array<float,2>{0.913750708f, 0.808155417f},
-std::array<float,2>{0.9615767f, 0.478903562f},
-std::array<float,2>{0.0305894949f, 0.647676289f},
-std::array<float,2>{0.473502129f, 0.057121966f},
-std::array<float,2>{0.67432785f, 0.975560367f},
-std::array<float,2>{0.55411762f, 0.165875927f},
-std::array<float,2>{0.341267854f, 0.853455603f},
-std::array<float,2>{0.18249549f, 0.27418682f},
-std::array<float,2>{0.760264397f, 0.540360928f},
-std::array<float,2>{0.896756291f, 0.235930383f},
-std::array<float,2>{0.087578699f, 0.754468024f},
-std::array<float,2>{0.403933227f, 0.369263649f},
-std::array<float,2>{0.72671777f, 0.594378889f},
-std::array<float,2>{0.59597671f, 0.430355161f},
-std::array<float,2>{0.256203234f, 0.694494128f},
-std::array<float,2>{0.223774448f, 0.114263713f},
-std::array<float,2>{0.859100759f, 0.921072483f},
-std::array<float,2>{0.807431817f, 0.298308671f},
-std::array<float,2>{0.133716688f, 0.517661393f},
-std::array<float,2>{0.369060278f, 0.15097262f},
-std::array<float,2>{0.524593294f, 0.818793297f},
-std::array<float,2>{0.65162307f, 0.0186946038f},
-std::array<float,2>{0.444415241f, 0.942704797f},
-std::array<float,2>{0.035984356f, 0.465473384f},
-std::array<float,2>{0.982345879f, 0.67497766f},
-std::array<float,2>{0.877572477f, 0.0245343931f},
-std::array<float,2>{0.0656370968f, 0.946772575f},
-std::array<float,2>{0.383789152f, 0.457375616f},
-std::array<float,2>{0.737959564f, 0.685003519f},
-std::array<float,2>{0.621796429f, 0.309168905f},
-std::array<float,2>{0.279664159f, 0.528163016f},
-std::array<float,2>{0.245154411f, 0.14421986f},
-std::array<float,2>{0.871958792f, 0.821761131f},
-std::array<float,2>{0.795669436f, 0.42198357f},
-std::array<float,2>{0.143027723f, 0.702073514f},
-std::array<float,2>{0.356674701f, 0.120951287f},
-std::array<float,2>{0.513996601f, 0.913897395f},
-std::array<float,2>{0.62508893f, 0.24518016f},
-std::array<float,2>{0.467879206f, 0.760752797f},
-std::array<float,2>{0.0472540557f, 0.361489713f},
-std::array<float,2>{0.998832285f, 0.606429935f},
-std::array<float,2>{0.816985369f, 0.159436554f},
-std::array<float,2>{0.21680297f, 0.849686861f},
-std::array<float,2>{0.288851589f, 0.267751694f},
-std::array<float,2>{0.592010081f, 0.533742011f},
-std::array<float,2>{0.68953526f, 0.473608375f},
-std::array<float,2>{0.409300268f, 0.649311602f},
-std::array<float,2>{0.118264012f, 0.0530959554f},
-std::array<float,2>{0.927902877f, 0.982556045f},
-std::array<float,2>{0.951425076f, 0.322838545f},
-std::array<float,2>{0.00752040697f, 0.590206265f},
-std::array<float,2>{0.49588871f, 0.209064409f},
-std::array<float,2>{0.663955033f, 0.804476976f},
-std::array<float,2>{0.541672409f, 0.0924301818f},
-std::array<float,2>{0.326374918f, 0.893610299f},
-std::array<float,2>{0.171048075f, 0.402876019f},
-std::array<float,2>{0.769994318f, 0.721745849f},
-std::array<float,2>{0.763777912f, 0.104338415f},
-std::array<float,2>{0.187239602f, 0.926588893f},
-std::array<float,2>{0.338323712f, 0.412247658f},
-std::array<float,2>{0.550650775f, 0.703514636f},
-std::array<float,2>{0.676031947f, 0.348845452f},
-std::array<float,2>{0.469536453f, 0.611653864f},
-std::array<float,2>{0.0246865097f, 0.225420088f},
-std::array<float,2>{0.966534317f, 0.778125644f},
-std::array<float,2>{0.908808053f, 0.439113587f},
-std::array<float,2>{0.104950361f, 0.663935542f},
-std::array<float,2>{0.430609494f, 0.00538901333f},
-std::array<float,2>{0.71337539f, 0.966675043f},
-std::array<float,2>{0.565167069f, 0.133153498f},
-std::array<float,2>{0.29897055f, 0.832769036f},
-std::array<float,2>{0.192216501f, 0.292771369f},
-std::array<float,2>{0.832255661f, 0.501110613f},
-std::array<float,2>{0.977110803f, 0.192111462f},
-std::array<float,2>{0.0350380167f, 0.793858826f},
-std::array<float,2>{0.440449685f, 0.329228103f},
-std::array<float,2>{0.655454099f, 0.570743918f},
-std::array<float,2>{0.529468358f, 0.388987839f},
-std::array<float,2>{0.373675913f, 0.738182485f},
-std::array<float,2>{0.139620841f, 0.0753064379f},
-std::array<float,2>{0.810028195f, 0.88173449f},
-std::array<float,2>{0.854537189f, 0.256937295f},
-std::array<float,2>{0.222321346f, 0.558040977f},
-std::array<float,2>{0.252905548f, 0.181909397f},
-std::array<float,2>{0.60095799f, 0.87153405f},
-std::array<float,2>{0.734169662f, 0.0468083769f},
-std::array<float,2>{0.401150256f, 0.988339663f},
-std::array<float,2>{0.0923421532f, 0.498310387f},
-std::array<float,2>{0.892288685f, 0.625293911f},
-std::array<float,2>{0.958815336f, 0.0640000328f},
-std::array<float,2>{0.0161905698f, 0.884618759f},
-std::array<float,2>{0.480207026f, 0.378575414f},
-std::array<float,2>{0.686050534f, 0.746117651f},
-std::array<float,2>{0.558637142f, 0.338074178f},
-std::array<float,2>{0.332606167f, 0.563606679f},
-std::array<float,2>{0.177911431f, 0.201333553f},
-std::array<float,2>{0.755423844f, 0.783848047f},
-std::array<float,2>{0.842247725f, 0.488158405f},
-std::array<float,2>{0.199188396f, 0.63741529f},
-std::array<float,2>{0.305439532f, 0.035233207f},
-std::array<float,2>{0.573111653f, 0.99937278f},
-std::array<float,2>{0.703202248f, 0.178088397f},
-std::array<float,2>{0.424020648f, 0.863601923f},
-std::array<float,2>{0.0993264541f, 0.259429604f},
-std::array<float,2>{0.914666533f, 0.552661121f},
-std::array<float,2>{0.801024318f, 0.230800197f},
-std::array<float,2>{0.131929085f, 0.767131448f},
-std::array<float,2>{0.363732189f, 0.358190209f},
-std::array<float,2>{0.520084262f, 0.61731869f},
-std::array<float,2>{0.644321144f, 0.419144332f},
-std::array<float,2>{0.448209077f, 0.7119596f},
-std::array<float,2>{0.0422580205f, 0.094367899f},
-std::array<float,2>{0.97450918f, 0.93285948f},
-std::array<float,2>{0.901077807f, 0.288979381f},
-std::array<float,2>{0.0795233846f, 0.509835839f},
-std::array<float,2>{0.392945558f, 0.132550269f},
-std::array<float,2>{0.721914172f, 0.839290977f},
-std::array<float,2>{0.606634498f, 0.00970704202f},
-std::array<float,2>{0.262124419f, 0.959974587f},
-std::array<float,2>{0.233828068f, 0.450538814f},
-std::array<float,2>{0.845208108f, 0.670389175f},
-std::array<float,2>{0.864247918f, 0.0623140335f},
-std::array<float,2>{0.239053801f, 0.969536841f},
-std::array<float,2>{0.269511938f, 0.481864423f},
-std::array<float,2>{0.612717986f, 0.641562223f},
-std::array<float,2>{0.744920015f, 0.279629737f},
-std::array<float,2>{0.37781617f, 0.545891464f},
-std::array<float,2>{0.0771987811f, 0.171286151f},
-std::array<float,2>{0.889816225f, 0.858795106f},
-std::array<float,2>{0.991879106f, 0.391511291f},
-std::array<float,2>{0.0617590807f, 0.731781185f},
-std::array<float,2>{0.459764212f, 0.0804660991f},
-std::array<float,2>{0.635736465f, 0.899324834f},
-std::array<float,2>{0.506282032f, 0.217474848f},
-std::array<float,2>{0.347054183f, 0.809505701f},
-std::array<float,2>{0.152609676f, 0.315012634f},
-std::array<float,2>{0.785123527f, 0.579630077f},
-std::array<float,2>{0.93648088f, 0.155795917f},
-std::array<float,2>{0.111791126f, 0.814039946f},
-std::array<float,2>{0.414592236f, 0.30277124f},
-std::array<float,2>{0.699045718f, 0.523372471f},
-std::array<float,2>{0.578586578f, 0.463256717f},
-std::array<float,2>{0.296477079f, 0.679624736f},
-std::array<float,2>{0.204762533f, 0.0230686516f},
-std::array<float,2>{0.82708478f, 0.938899636f},
-std::array<float,2>{0.773691654f, 0.372600853f},
-std::array<float,2>{0.160586283f, 0.598644197f},
-std::array<float,2>{0.314494133f, 0.241649523f},
-std::array<float,2>{0.536807775f, 0.751365364f},
-std::array<float,2>{0.669070125f, 0.112849094f},
-std::array<float,2>{0.484811097f, 0.914519072f},
-std::array<float,2>{0.0119688297f, 0.435591966f},
-std::array<float,2>{0.939797997f, 0.690299511f},
-std::array<float,2>{0.884044051f, 0.108225651f},
-std::array<float,2>{0.0736555755f, 0.923867047f},
-std::array<float,2>{0.381934613f, 0.408164948f},
-std::array<float,2>{0.747487247f, 0.709716976f},
-std::array<float,2>{0.616325438f, 0.346693397f},
-std::array<float,2>{0.273243815f, 0.613380253f},
-std::array<float,2>{0.234717175f, 0.219263881f},
-std::array<float,2>{0.859584033f, 0.773691356f},
-std::array<float,2>{0.786408603f, 0.442827523f},
-std::array<float,2>{0.151973709f, 0.658076644f},
-std::array<float,2>{0.349159271f, 0.000859585474f},
-std::array<float,2>{0.500214934f, 0.962537825f},
-std::array<float,2>{0.638495088f, 0.139441952f},
-std::array<float,2>{0.455378413f, 0.830355823f},
-std::array<float,2>{0.0567821339f, 0.295796663f},
-std::array<float,2>{0.984402895f, 0.506678939f},
-std::array<float,2>{0.820693195f, 0.188502267f},
-std::array<float,2>{0.20803158f, 0.79203105f},
-std::array<float,2>{0.290294111f, 0.334018379f},
-std::array<float,2>{0.584617019f, 0.574243248f},
-std::array<float,2>{0.701874852f, 0.384364307f},
-std::array<float,2>{0.420021147f, 0.739203453f},
-std::array<float,2>{0.11701332f, 0.0716815516f},
-std::array<float,2>{0.932769775f, 0.876548409f},
-std::array<float,2>{0.944015265f, 0.250611216f},
-std::array<float,2>{0.00921482872f, 0.56077075f},
-std::array<float,2>{0.489245176f, 0.187115386f},
-std::array<float,2>{0.667179286f, 0.868722498f},
-std::array<float,2>{0.532488406f, 0.0405004323f},
-std::array<float,2>{0.31980297f, 0.988015711f},
-std::array<float,2>{0.156786948f, 0.494150579f},
-std::array<float,2>{0.778054595f, 0.629872322f},
-std::array<float,2>{0.751746595f, 0.0302942302f},
-std::array<float,2>{0.172514588f, 0.952398121f},
-std::array<float,2>{0.33103025f, 0.453289449f},
-std::array<float,2>{0.556185424f, 0.683420002f},
-std::array<float,2>{0.680139363f, 0.307087094f},
-std::array<float,2>{0.480753481f, 0.523509383f},
-std::array<float,2>{0.0209077597f, 0.145103544f},
-std::array<float,2>{0.954441786f, 0.824597239f},
-std::array<float,2>{0.919023216f, 0.426009774f},
-std::array<float,2>{0.0967245549f, 0.697712243f},
-std::array<float,2>{0.427092969f, 0.123984128f},
-std::array<float,2>{0.710497499f, 0.909030259f},
-std::array<float,2>{0.576602459f, 0.248649254f},
-std::array<float,2>{0.311760902f, 0.76512599f},
-std::array<float,2>{0.200757667f, 0.366216302f},
-std::array<float,2>{0.8396613f, 0.6031214f},
-std::array<float,2>{0.971926868f, 0.161906779f},
-std::array<float,2>{0.0437654741f, 0.846385002f},
-std::array<float,2>{0.44955954f, 0.272922397f},
-std::array<float,2>{0.645354927f, 0.535327315f},
-std::array<float,2>{0.519304872f, 0.470999271f},
-std::array<float,2>{0.361488044f, 0.654727519f},
-std::array<float,2>{0.126054794f, 0.047694996f},
-std::array<float,2>{0.799652159f, 0.977500975f},
-std::array<float,2>{0.850468695f, 0.324550122f},
-std::array<float,2>{0.227710247f, 0.588876128f},
-std::array<float,2>{0.260665596f, 0.204321235f},
-std::array<float,2>{0.602199316f, 0.797715187f},
-std::array<float,2>{0.724538565f, 0.0898358151f},
-std::array<float,2>{0.395689726f, 0.895153642f},
-std::array<float,2>{0.0828607231f, 0.398982227f},
-std::array<float,2>{0.903553724f, 0.724778652f},
-std::array<float,2>{0.9638623f, 0.0577137247f},
-std::array<float,2>{0.0277679693f, 0.976302028f},
-std::array<float,2>{0.475239068f, 0.480160564f},
-std::array<float,2>{0.672391534f, 0.647086501f},
-std::array<float,2>{0.551058471f, 0.274692506f},
-std::array<float,2>{0.34215042f, 0.53919661f},
-std::array<float,2>{0.180520967f, 0.164102435f},
-std::array<float,2>{0.759168446f, 0.852266729f},
-std::array<float,2>{0.830624104f, 0.397630543f},
-std::array<float,2>{0.188277602f, 0.727557182f},
-std::array<float,2>{0.302826583f, 0.0835272521f},
-std::array<float,2>{0.567694902f, 0.9049775f},
-std::array<float,2>{0.71851778f, 0.211776689f},
-std::array<float,2>{0.437098473f, 0.806820035f},
-std::array<float,2>{0.106966078f, 0.317553341f},
-std::array<float,2>{0.911323726f, 0.583070636f},
-std::array<float,2>{0.80622232f, 0.151791155f},
-std::array<float,2>{0.135140091f, 0.819917679f},
-std::array<float,2>{0.370297879f, 0.296917528f},
-std::array<float,2>{0.526161373f, 0.519267321f},
-std::array<float,2>{0.648768663f, 0.466408789f},
-std::array<float,2>{0.44232288f, 0.674660563f},
-std::array<float,2>{0.0386917181f, 0.0179122891f},
-std::array<float,2>{0.982790947f, 0.942107141f},
-std::array<float,2>{0.895437479f, 0.370674044f},
-std::array<float,2>{0.0894069299f, 0.595485926f},
-std::array<float,2>{0.405492455f, 0.235005021f},
-std::array<float,2>{0.729592144f, 0.75516808f},
-std::array<float,2>{0.59386307f, 0.113315269f},
-std::array<float,2>{0.255823314f, 0.920032263f},
-std::array<float,2>{0.226238102f, 0.431067735f},
-std::array<float,2>{0.856687665f, 0.693418205f},
-std::array<float,2>{0.870401919f, 0.0697572306f},
-std::array<float,2>{0.24640353f, 0.889239967f},
-std::array<float,2>{0.275124878f, 0.380165219f},
-std::array<float,2>{0.619222164f, 0.746073067f},
-std::array<float,2>{0.738809645f, 0.341343492f},
-std::array<float,2>{0.389954805f, 0.568641245f},
-std::array<float,2>{0.0675031468f, 0.198608875f},
-std::array<float,2>{0.881308377f, 0.788817704f},
-std::array<float,2>{0.995038867f, 0.490828991f},
-std::array<float,2>{0.0518262759f, 0.635443211f},
-std::array<float,2>{0.464037329f, 0.033893913f},
-std::array<float,2>{0.631374836f, 0.996020377f},
-std::array<float,2>{0.511214197f, 0.172868595f},
-std::array<float,2>{0.354678571f, 0.862431765f},
-std::array<float,2>{0.146308482f, 0.262002736f},
-std::array<float,2>{0.789936602f, 0.548371017f},
-std::array<float,2>{0.925206065f, 0.227755859f},
-std::array<float,2>{0.123596653f, 0.771165192f},
-std::array<float,2>{0.41348502f, 0.352153659f},
-std::array<float,2>{0.691766739f, 0.621760488f},
-std::array<float,2>{0.586675704f, 0.41508761f},
-std::array<float,2>{0.282171309f, 0.716365635f},
-std::array<float,2>{0.211027488f, 0.0987709537f},
-std::array<float,2>{0.812716722f, 0.936233878f},
-std::array<float,2>{0.7662642f, 0.28300482f},
-std::array<float,2>{0.164903194f, 0.513089955f},
-std::array<float,2>{0.322218895f, 0.125612557f},
-std::array<float,2>{0.546003878f, 0.843381345f},
-std::array<float,2>{0.659518898f, 0.0127703287f},
-std::array<float,2>{0.499394596f, 0.955156624f},
-std::array<float,2>{0.00299910828f, 0.447121531f},
-std::array<float,2>{0.946440756f, 0.665888727f},
-std::array<float,2>{0.907471299f, 0.00420418894f},
-std::array<float,2>{0.102646269f, 0.965563178f},
-std::array<float,2>{0.433456779f, 0.438455015f},
-std::array<float,2>{0.711422324f, 0.662937462f},
-std::array<float,2>{0.564018607f, 0.291794598f},
-std::array<float,2>{0.297937691f, 0.500319421f},
-std::array<float,2>{0.194649354f, 0.134723678f},
-std::array<float,2>{0.834097028f, 0.833877444f},
-std::array<float,2>{0.762162149f, 0.413495183f},
-std::array<float,2>{0.185192823f, 0.704386532f},
-std::array<float,2>{0.337500364f, 0.104865447f},
-std::array<float,2>{0.546995759f, 0.92730391f},
-std::array<float,2>{0.678633034f, 0.226136595f},
-std::array<float,2>{0.471607536f, 0.779089451f},
-std::array<float,2>{0.0259061772f, 0.34849751f},
-std::array<float,2>{0.968484581f, 0.612427652f},
-std::array<float,2>{0.852841079f, 0.182842046f},
-std::array<float,2>{0.219291672f, 0.872808099f},
-std::array<float,2>{0.251750231f, 0.256539494f},
-std::array<float,2>{0.598050356f, 0.556961536f},
-std::array<float,2>{0.730603576f, 0.499871105f},
-std::array<float,2>{0.39855665f, 0.626567483f},
-std::array<float,2>{0.0912982449f, 0.0458612442f},
-std::array<float,2>{0.893763185f, 0.989318371f},
-std::array<float,2>{0.979880035f, 0.328658581f},
-std::array<float,2>{0.0327764265f, 0.571317136f},
-std::array<float,2>{0.437902153f, 0.192584589f},
-std::array<float,2>{0.652693093f, 0.794646502f},
-std::array<float,2>{0.528583705f, 0.074764125f},
-std::array<float,2>{0.371627599f, 0.882016063f},
-std::array<float,2>{0.137341604f, 0.390087098f},
-std::array<float,2>{0.811989963f, 0.737061679f},
-std::array<float,2>{0.794174731f, 0.119201951f},
-std::array<float,2>{0.141579792f, 0.912282228f},
-std::array<float,2>{0.357620209f, 0.423725694f},
-std::array<float,2>{0.512951136f, 0.703057528f},
-std::array<float,2>{0.627911806f, 0.362450868f},
-std::array<float,2>{0.466548413f, 0.606929719f},
-std::array<float,2>{0.0492032617f, 0.244692579f},
-std::array<float,2>{0.996824443f, 0.760427713f},
-std::array<float,2>{0.876706421f, 0.45888719f},
-std::array<float,2>{0.0639687255f, 0.684482276f},
-std::array<float,2>{0.386543572f, 0.0237816609f},
-std::array<float,2>{0.735597849f, 0.945356011f},
-std::array<float,2>{0.624074161f, 0.143069565f},
-std::array<float,2>{0.279231161f, 0.820628405f},
-std::array<float,2>{0.243754879f, 0.310071021f},
-std::array<float,2>{0.873918533f, 0.528617024f},
-std::array<float,2>{0.950119138f, 0.210831419f},
-std::array<float,2>{0.0051096417f, 0.803288817f},
-std::array<float,2>{0.493102998f, 0.323680848f},
-std::array<float,2>{0.660800099f, 0.591039538f},
-std::array<float,2>{0.539587498f, 0.404200315f},
-std::array<float,2>{0.32435903f, 0.721553564f},
-std::array<float,2>{0.168679386f, 0.0934199393f},
-std::array<float,2>{0.772686243f, 0.893444002f},
-std::array<float,2>{0.818994224f, 0.26868856f},
-std::array<float,2>{0.215141058f, 0.53501457f},
-std::array<float,2>{0.286764681f, 0.158489391f},
-std::array<float,2>{0.591148138f, 0.850865662f},
-std::array<float,2>{0.68917793f, 0.0545351394f},
-std::array<float,2>{0.408191234f, 0.98377198f},
-std::array<float,2>{0.120448463f, 0.474447817f},
-std::array<float,2>{0.926667035f, 0.650357604f},
-std::array<float,2>{0.989165127f, 0.082003504f},
-std::array<float,2>{0.0595220588f, 0.899614096f},
-std::array<float,2>{0.457758158f, 0.392033786f},
-std::array<float,2>{0.634056687f, 0.730685532f},
-std::array<float,2>{0.504680276f, 0.315579861f},
-std::array<float,2>{0.345289111f, 0.578708887f},
-std::array<float,2>{0.155744329f, 0.217952624f},
-std::array<float,2>{0.782373309f, 0.809728682f},
-std::array<float,2>{0.866939485f, 0.480760187f},
-std::array<float,2>{0.241487697f, 0.642120302f},
-std::array<float,2>{0.267294317f, 0.0610423945f},
-std::array<float,2>{0.609604776f, 0.970277667f},
-std::array<float,2>{0.74393785f, 0.169951543f},
-std::array<float,2>{0.376132607f, 0.857763946f},
-std::array<float,2>{0.0759850144f, 0.280744553f},
-std::array<float,2>{0.887586474f, 0.546633601f},
-std::array<float,2>{0.776359439f, 0.240446255f},
-std::array<float,2>{0.163698882f, 0.750729859f},
-std::array<float,2>{0.312818944f, 0.37170282f},
-std::array<float,2>{0.538854957f, 0.598257482f},
-std::array<float,2>{0.671826243f, 0.436955303f},
-std::array<float,2>{0.486514688f, 0.690684021f},
-std::array<float,2>{0.0152129149f, 0.111766741f},
-std::array<float,2>{0.938201129f, 0.915761709f},
-std::array<float,2>{0.935531557f, 0.30467996f},
-std::array<float,2>{0.109928757f, 0.521781504f},
-std::array<float,2>{0.417539001f, 0.154509783f},
-std::array<float,2>{0.695450246f, 0.813332915f},
-std::array<float,2>{0.581058264f, 0.0223667081f},
-std::array<float,2>{0.293351978f, 0.937613666f},
-std::array<float,2>{0.206172079f, 0.464595228f},
-std::array<float,2>{0.824306011f, 0.678303123f},
-std::array<float,2>{0.841106892f, 0.0369962379f},
-std::array<float,2>{0.196167439f, 0.998364091f},
-std::array<float,2>{0.307120204f, 0.486743182f},
-std::array<float,2>{0.570384681f, 0.63789165f},
-std::array<float,2>{0.706183016f, 0.258536458f},
-std::array<float,2>{0.423065245f, 0.551706731f},
-std::array<float,2>{0.100266181f, 0.178861484f},
-std::array<float,2>{0.916599154f, 0.865017056f},
-std::array<float,2>{0.959934056f, 0.377185702f},
-std::array<float,2>{0.0177947693f, 0.747295201f},
-std::array<float,2>{0.477179646f, 0.0629520714f},
-std::array<float,2>{0.683787525f, 0.883346558f},
-std::array<float,2>{0.560862958f, 0.202752441f},
-std::array<float,2>{0.334282547f, 0.784889162f},
-std::array<float,2>{0.175874487f, 0.339390874f},
-std::array<float,2>{0.75631249f, 0.56313473f},
-std::array<float,2>{0.899752617f, 0.13168557f},
-std::array<float,2>{0.0817315653f, 0.838419616f},
-std::array<float,2>{0.391705871f, 0.287857085f},
-std::array<float,2>{0.719624758f, 0.511224449f},
-std::array<float,2>{0.607612789f, 0.450106621f},
-std::array<float,2>{0.264922291f, 0.6711061f},
-std::array<float,2>{0.231066123f, 0.00800389051f},
-std::array<float,2>{0.846911967f, 0.959959328f},
-std::array<float,2>{0.803514659f, 0.358859301f},
-std::array<float,2>{0.130447388f, 0.618577302f},
-std::array<float,2>{0.365885049f, 0.23147431f},
-std::array<float,2>{0.522902727f, 0.766089559f},
-std::array<float,2>{0.642425954f, 0.0953130051f},
-std::array<float,2>{0.447076261f, 0.931766272f},
-std::array<float,2>{0.0407594033f, 0.418512642f},
-std::array<float,2>{0.975746989f, 0.711844683f},
-std::array<float,2>{0.930164218f, 0.072763145f},
-std::array<float,2>{0.113763623f, 0.878276944f},
-std::array<float,2>{0.419811666f, 0.385679632f},
-std::array<float,2>{0.699522734f, 0.74041748f},
-std::array<float,2>{0.582267642f, 0.333571643f},
-std::array<float,2>{0.29215014f, 0.577716291f},
-std::array<float,2>{0.210751519f, 0.190215707f},
-std::array<float,2>{0.822499812f, 0.790513575f},
-std::array<float,2>{0.780311704f, 0.49296698f},
-std::array<float,2>{0.160113141f, 0.631540835f},
-std::array<float,2>{0.317383587f, 0.0415885448f},
-std::array<float,2>{0.534800172f, 0.984939754f},
-std::array<float,2>{0.66435039f, 0.184048533f},
-std::array<float,2>{0.491722554f, 0.870951653f},
-std::array<float,2>{0.0113959461f, 0.252970457f},
-std::array<float,2>{0.941906989f, 0.560077071f},
-std::array<float,2>{0.861885548f, 0.221875533f},
-std::array<float,2>{0.238266304f, 0.777291715f},
-std::array<float,2>{0.270072848f, 0.344403267f},
-std::array<float,2>{0.613350153f, 0.617131114f},
-std::array<float,2>{0.74998188f, 0.408605397f},
-std::array<float,2>{0.379402608f, 0.708714128f},
-std::array<float,2>{0.0704236105f, 0.107070021f},
-std::array<float,2>{0.885711372f, 0.923463047f},
-std::array<float,2>{0.987899065f, 0.293605298f},
-std::array<float,2>{0.0549221896f, 0.505632699f},
-std::array<float,2>{0.454496026f, 0.136957645f},
-std::array<float,2>{0.639672995f, 0.829319596f},
-std::array<float,2>{0.503602922f, 0.00283841696f},
-std::array<float,2>{0.350727528f, 0.964662015f},
-std::array<float,2>{0.150317565f, 0.444849312f},
-std::array<float,2>{0.787241101f, 0.659563065f},
-std::array<float,2>{0.798281848f, 0.0506646335f},
-std::array<float,2>{0.128256842f, 0.979040146f},
-std::array<float,2>{0.361063719f, 0.469768763f},
-std::array<float,2>{0.515681386f, 0.653807342f},
-std::array<float,2>{0.6478616f, 0.270752996f},
-std::array<float,2>{0.45192349f, 0.537600935f},
-std::array<float,2>{0.0463694148f, 0.162535027f},
-std::array<float,2>{0.970685065f, 0.843779445f},
-std::array<float,2>{0.904707372f, 0.40204823f},
-std::array<float,2>{0.0841772035f, 0.72272557f},
-std::array<float,2>{0.398389876f, 0.0872927383f},
-std::array<float,2>{0.72623986f, 0.897230089f},
-std::array<float,2>{0.604759276f, 0.206940636f},
-std::array<float,2>{0.258979231f, 0.800125003f},
-std::array<float,2>{0.229194745f, 0.327200741f},
-std::array<float,2>{0.847737789f, 0.587596059f},
-std::array<float,2>{0.955351591f, 0.147821128f},
-std::array<float,2>{0.0216065757f, 0.827051997f},
-std::array<float,2>{0.48353675f, 0.305978894f},
-std::array<float,2>{0.683499575f, 0.52652359f},
-std::array<float,2>{0.557000041f, 0.456771016f},
-std::array<float,2>{0.329653859f, 0.68069917f},
-std::array<float,2>{0.175222084f, 0.0278285779f},
-std::array<float,2>{0.753037214f, 0.950035572f},
-std::array<float,2>{0.836067915f, 0.364700735f},
-std::array<float,2>{0.202920005f, 0.604100943f},
-std::array<float,2>{0.310402393f, 0.247574463f},
-std::array<float,2>{0.575577557f, 0.763485491f},
-std::array<float,2>{0.707767069f, 0.121142447f},
-std::array<float,2>{0.429162115f, 0.90677923f},
-std::array<float,2>{0.0956204683f, 0.428961605f},
-std::array<float,2>{0.920835614f, 0.695866108f},
-std::array<float,2>{0.980574548f, 0.015708711f},
-std::array<float,2>{0.0369845591f, 0.944442153f},
-std::array<float,2>{0.443813443f, 0.467763305f},
-std::array<float,2>{0.65133822f, 0.67193532f},
-std::array<float,2>{0.523667991f, 0.299273044f},
-std::array<float,2>{0.367969811f, 0.516962707f},
-std::array<float,2>{0.134174123f, 0.148926795f},
-std::array<float,2>{0.808046401f, 0.816873133f},
-std::array<float,2>{0.857869506f, 0.431844801f},
-std::array<float,2>{0.223062307f, 0.692583919f},
-std::array<float,2>{0.25768885f, 0.117018349f},
-std::array<float,2>{0.597325742f, 0.918650925f},
-std::array<float,2>{0.728203654f, 0.237865806f},
-std::array<float,2>{0.402545273f, 0.756124258f},
-std::array<float,2>{0.0866874233f, 0.367857963f},
-std::array<float,2>{0.897722363f, 0.597509086f},
-std::array<float,2>{0.761649847f, 0.16602473f},
-std::array<float,2>{0.183317304f, 0.854803503f},
-std::array<float,2>{0.339871258f, 0.275822908f},
-std::array<float,2>{0.553069174f, 0.542528033f},
-std::array<float,2>{0.675597131f, 0.478358567f},
-std::array<float,2>{0.474476397f, 0.645177364f},
-std::array<float,2>{0.0297022536f, 0.0546896048f},
-std::array<float,2>{0.96269387f, 0.972855806f},
-std::array<float,2>{0.912895799f, 0.319552094f},
-std::array<float,2>{0.107427493f, 0.584271848f},
-std::array<float,2>{0.433977485f, 0.214512318f},
-std::array<float,2>{0.716344595f, 0.804968953f},
-std::array<float,2>{0.569491088f, 0.0843720362f},
-std::array<float,2>{0.30272907f, 0.902530372f},
-std::array<float,2>{0.191096887f, 0.396025985f},
-std::array<float,2>{0.828153133f, 0.728920281f},
-std::array<float,2>{0.815489948f, 0.101300113f},
-std::array<float,2>{0.213082805f, 0.934182703f},
-std::array<float,2>{0.284441561f, 0.417263687f},
-std::array<float,2>{0.58965224f, 0.717474103f},
-std::array<float,2>{0.694873393f, 0.35375753f},
-std::array<float,2>{0.410899282f, 0.624187589f},
-std::array<float,2>{0.122904383f, 0.229452074f},
-std::array<float,2>{0.923301101f, 0.773083806f},
-std::array<float,2>{0.949178696f, 0.44796735f},
-std::array<float,2>{0.000450805179f, 0.666737556f},
-std::array<float,2>{0.496184677f, 0.0150809167f},
-std::array<float,2>{0.65753907f, 0.953792036f},
-std::array<float,2>{0.543596625f, 0.127512798f},
-std::array<float,2>{0.323890477f, 0.840615809f},
-std::array<float,2>{0.166464791f, 0.28338331f},
-std::array<float,2>{0.768835127f, 0.51549983f},
-std::array<float,2>{0.8790344f, 0.196261644f},
-std::array<float,2>{0.0696957558f, 0.786600232f},
-std::array<float,2>{0.388231128f, 0.34373492f},
-std::array<float,2>{0.741102874f, 0.567937553f},
-std::array<float,2>{0.618362546f, 0.382229269f},
-std::array<float,2>{0.275970548f, 0.744032741f},
-std::array<float,2>{0.249964461f, 0.0677461252f},
-std::array<float,2>{0.867796779f, 0.887746453f},
-std::array<float,2>{0.791288435f, 0.264512211f},
-std::array<float,2>{0.147754192f, 0.549568772f},
-std::array<float,2>{0.352260292f, 0.175620869f},
-std::array<float,2>{0.508850992f, 0.859659135f},
-std::array<float,2>{0.629323363f, 0.0319215991f},
-std::array<float,2>{0.460986525f, 0.993399978f},
-std::array<float,2>{0.0543589555f, 0.490083784f},
-std::array<float,2>{0.993901312f, 0.633695424f},
-std::array<float,2>{0.891055703f, 0.0443164222f},
-std::array<float,2>{0.0932990238f, 0.991833508f},
-std::array<float,2>{0.401797116f, 0.496504039f},
-std::array<float,2>{0.733053744f, 0.627280414f},
-std::array<float,2>{0.599816442f, 0.254351407f},
-std::array<float,2>{0.253576517f, 0.556570292f},
-std::array<float,2>{0.221156031f, 0.180069044f},
-std::array<float,2>{0.853828788f, 0.873959661f},
-std::array<float,2>{0.809191167f, 0.387135983f},
-std::array<float,2>{0.140202016f, 0.736220002f},
-std::array<float,2>{0.374449492f, 0.0767976642f},
-std::array<float,2>{0.531151593f, 0.878949523f},
-std::array<float,2>{0.654370487f, 0.194435045f},
-std::array<float,2>{0.439544231f, 0.796743691f},
-std::array<float,2>{0.0339278914f, 0.331589401f},
-std::array<float,2>{0.978411674f, 0.573551536f},
-std::array<float,2>{0.833687425f, 0.135703087f},
-std::array<float,2>{0.193108872f, 0.834265947f},
-std::array<float,2>{0.300289899f, 0.289533764f},
-std::array<float,2>{0.566356421f, 0.502455711f},
-std::array<float,2>{0.714734972f, 0.440540671f},
-std::array<float,2>{0.431323349f, 0.660715222f},
-std::array<float,2>{0.104423508f, 0.00653525768f},
-std::array<float,2>{0.910106838f, 0.968630075f},
-std::array<float,2>{0.965016901f, 0.349706173f},
-std::array<float,2>{0.0242705587f, 0.61068213f},
-std::array<float,2>{0.469984919f, 0.223823801f},
-std::array<float,2>{0.6774351f, 0.780972183f},
-std::array<float,2>{0.549654722f, 0.102450259f},
-std::array<float,2>{0.339091331f, 0.927979112f},
-std::array<float,2>{0.186448053f, 0.410943151f},
-std::array<float,2>{0.765515506f, 0.70690012f},
-std::array<float,2>{0.771075428f, 0.0900036842f},
-std::array<float,2>{0.170393586f, 0.890838921f},
-std::array<float,2>{0.327700973f, 0.404620111f},
-std::array<float,2>{0.542574406f, 0.719263315f},
-std::array<float,2>{0.662337244f, 0.320951968f},
-std::array<float,2>{0.494935393f, 0.59306699f},
-std::array<float,2>{0.00654993299f, 0.207362473f},
-std::array<float,2>{0.952741861f, 0.800820172f},
-std::array<float,2>{0.929317653f, 0.474917531f},
-std::array<float,2>{0.117204338f, 0.650827944f},
-std::array<float,2>{0.408899009f, 0.0516369492f},
-std::array<float,2>{0.690859973f, 0.982083797f},
-std::array<float,2>{0.593371928f, 0.156381294f},
-std::array<float,2>{0.287608266f, 0.849447548f},
-std::array<float,2>{0.218631953f, 0.26756525f},
-std::array<float,2>{0.817794442f, 0.532001436f},
-std::array<float,2>{0.999188364f, 0.243425414f},
-std::array<float,2>{0.0479112566f, 0.759596884f},
-std::array<float,2>{0.467447281f, 0.360587358f},
-std::array<float,2>{0.626796067f, 0.607543409f},
-std::array<float,2>{0.514855742f, 0.424925268f},
-std::array<float,2>{0.355508059f, 0.700899422f},
-std::array<float,2>{0.143588349f, 0.118313164f},
-std::array<float,2>{0.796523988f, 0.911255181f},
-std::array<float,2>{0.872141302f, 0.311773509f},
-std::array<float,2>{0.244184628f, 0.53036505f},
-std::array<float,2>{0.280507684f, 0.141147822f},
-std::array<float,2>{0.62236315f, 0.822441757f},
-std::array<float,2>{0.737272859f, 0.0270574708f},
-std::array<float,2>{0.382915437f, 0.948276758f},
-std::array<float,2>{0.0647180229f, 0.460425854f},
-std::array<float,2>{0.878440976f, 0.687187791f},
-std::array<float,2>{0.940584719f, 0.111304566f},
-std::array<float,2>{0.0134362243f, 0.917908549f},
-std::array<float,2>{0.485529214f, 0.434175432f},
-std::array<float,2>{0.668788612f, 0.689262092f},
-std::array<float,2>{0.535812616f, 0.374457181f},
-std::array<float,2>{0.315574914f, 0.601215601f},
-std::array<float,2>{0.161580816f, 0.239464656f},
-std::array<float,2>{0.775059581f, 0.753894091f},
-std::array<float,2>{0.827649117f, 0.462306529f},
-std::array<float,2>{0.20351097f, 0.677537918f},
-std::array<float,2>{0.295306534f, 0.0213004611f},
-std::array<float,2>{0.579617023f, 0.940960944f},
-std::array<float,2>{0.698116839f, 0.152602851f},
-std::array<float,2>{0.415093243f, 0.816173375f},
-std::array<float,2>{0.112406954f, 0.302623034f},
-std::array<float,2>{0.937276483f, 0.520937502f},
-std::array<float,2>{0.783871412f, 0.215303063f},
-std::array<float,2>{0.154041693f, 0.812208414f},
-std::array<float,2>{0.34630689f, 0.31437993f},
-std::array<float,2>{0.50693208f, 0.581005991f},
-std::array<float,2>{0.635788321f, 0.393201768f},
-std::array<float,2>{0.460075021f, 0.732907832f},
-std::array<float,2>{0.0608912036f, 0.0788099095f},
-std::array<float,2>{0.990787983f, 0.902209878f},
-std::array<float,2>{0.889376104f, 0.277953148f},
-std::array<float,2>{0.0769227743f, 0.543633819f},
-std::array<float,2>{0.378284127f, 0.169820875f},
-std::array<float,2>{0.745452821f, 0.857039571f},
-std::array<float,2>{0.611863911f, 0.059762761f},
-std::array<float,2>{0.26758638f, 0.972309768f},
-std::array<float,2>{0.239967868f, 0.483226091f},
-std::array<float,2>{0.864396274f, 0.643387198f},
-std::array<float,2>{0.844170332f, 0.0110450918f},
-std::array<float,2>{0.233391553f, 0.957687557f},
-std::array<float,2>{0.263112903f, 0.452399969f},
-std::array<float,2>{0.606022418f, 0.668001354f},
-std::array<float,2>{0.720829368f, 0.285912395f},
-std::array<float,2>{0.393610448f, 0.509759068f},
-std::array<float,2>{0.0781460628f, 0.129557297f},
-std::array<float,2>{0.901574612f, 0.837729335f},
-std::array<float,2>{0.973222315f, 0.421521366f},
-std::array<float,2>{0.0414135158f, 0.714589894f},
-std::array<float,2>{0.448680371f, 0.0968444571f},
-std::array<float,2>{0.642930806f, 0.931329131f},
-std::array<float,2>{0.520658255f, 0.233365476f},
-std::array<float,2>{0.365103543f, 0.768090904f},
-std::array<float,2>{0.131646231f, 0.356942385f},
-std::array<float,2>{0.80230844f, 0.620408177f},
-std::array<float,2>{0.915546f, 0.176857248f},
-std::array<float,2>{0.0983819291f, 0.866418242f},
-std::array<float,2>{0.425310314f, 0.259839743f},
-std::array<float,2>{0.704816401f, 0.553484797f},
-std::array<float,2>{0.57351011f, 0.484408677f},
-std::array<float,2>{0.305709898f, 0.639311969f},
-std::array<float,2>{0.197545871f, 0.0378443114f},
-std::array<float,2>{0.843407989f, 0.996655881f},
-std::array<float,2>{0.754539967f, 0.336795121f},
-std::array<float,2>{0.179267123f, 0.565024436f},
-std::array<float,2>{0.33384791f, 0.20013912f},
-std::array<float,2>{0.559841931f, 0.78288877f},
-std::array<float,2>{0.686615527f, 0.0648149103f},
-std::array<float,2>{0.478856862f, 0.886202455f},
-std::array<float,2>{0.0166166443f, 0.375485629f},
-std::array<float,2>{0.957220256f, 0.749796867f},
-std::array<float,2>{0.887250841f, 0.0798938423f},
-std::array<float,2>{0.0757286549f, 0.901262879f},
-std::array<float,2>{0.376394659f, 0.394518822f},
-std::array<float,2>{0.743807733f, 0.734149873f},
-std::array<float,2>{0.609664798f, 0.312635809f},
-std::array<float,2>{0.267507493f, 0.581588566f},
-std::array<float,2>{0.241433218f, 0.215888828f},
-std::array<float,2>{0.866975307f, 0.810788035f},
-std::array<float,2>{0.782552481f, 0.483748198f},
-std::array<float,2>{0.155371606f, 0.64368844f},
-std::array<float,2>{0.345621079f, 0.0593624935f},
-std::array<float,2>{0.504609704f, 0.970929205f},
-std::array<float,2>{0.633851767f, 0.168655142f},
-std::array<float,2>{0.457928628f, 0.855688453f},
-std::array<float,2>{0.0592813827f, 0.278520167f},
-std::array<float,2>{0.988795817f, 0.544885218f},
-std::array<float,2>{0.8244766f, 0.238910362f},
-std::array<float,2>{0.206423163f, 0.752343535f},
-std::array<float,2>{0.293185323f, 0.373122692f},
-std::array<float,2>{0.581459045f, 0.599892497f},
-std::array<float,2>{0.695763826f, 0.434890211f},
-std::array<float,2>{0.417944044f, 0.688008666f},
-std::array<float,2>{0.110324487f, 0.109837085f},
-std::array<float,2>{0.935141504f, 0.91696173f},
-std::array<float,2>{0.938308537f, 0.301145315f},
-std::array<float,2>{0.0156114167f, 0.519775748f},
-std::array<float,2>{0.486690581f, 0.153811365f},
-std::array<float,2>{0.671462059f, 0.815257847f},
-std::array<float,2>{0.538789809f, 0.0201797895f},
-std::array<float,2>{0.312554628f, 0.940358818f},
-std::array<float,2>{0.163906112f, 0.461287707f},
-std::array<float,2>{0.776036859f, 0.676253438f},
-std::array<float,2>{0.755927622f, 0.0381926708f},
-std::array<float,2>{0.176085517f, 0.997278094f},
-std::array<float,2>{0.334030807f, 0.485810786f},
-std::array<float,2>{0.560655117f, 0.639929175f},
-std::array<float,2>{0.683971703f, 0.261432052f},
-std::array<float,2>{0.477398008f, 0.553862929f},
-std::array<float,2>{0.0179147404f, 0.176042348f},
-std::array<float,2>{0.959683597f, 0.865321279f},
-std::array<float,2>{0.916873753f, 0.376135081f},
-std::array<float,2>{0.100488901f, 0.748228848f},
-std::array<float,2>{0.42315501f, 0.0660890266f},
-std::array<float,2>{0.70652312f, 0.885693789f},
-std::array<float,2>{0.57076329f, 0.200838879f},
-std::array<float,2>{0.306722939f, 0.781400025f},
-std::array<float,2>{0.195947587f, 0.336957186f},
-std::array<float,2>{0.84103936f, 0.565730393f},
-std::array<float,2>{0.97603488f, 0.130466312f},
-std::array<float,2>{0.0408423394f, 0.836140931f},
-std::array<float,2>{0.446795732f, 0.28698194f},
-std::array<float,2>{0.642160535f, 0.508602262f},
-std::array<float,2>{0.522516847f, 0.451365829f},
-std::array<float,2>{0.36610499f, 0.669080675f},
-std::array<float,2>{0.130669907f, 0.0106218662f},
-std::array<float,2>{0.803263843f, 0.958545268f},
-std::array<float,2>{0.847158134f, 0.356202096f},
-std::array<float,2>{0.231436431f, 0.620087922f},
-std::array<float,2>{0.26481241f, 0.23377867f},
-std::array<float,2>{0.607718349f, 0.7687729f},
-std::array<float,2>{0.71925211f, 0.0957912058f},
-std::array<float,2>{0.392071813f, 0.929982185f},
-std::array<float,2>{0.0817904398f, 0.420482427f},
-std::array<float,2>{0.899449825f, 0.713190079f},
-std::array<float,2>{0.968628347f, 0.00720711658f},
-std::array<float,2>{0.0261546001f, 0.967369676f},
-std::array<float,2>{0.471348763f, 0.439973027f},
-std::array<float,2>{0.67840153f, 0.66129601f},
-std::array<float,2>{0.547281742f, 0.29086414f},
-std::array<float,2>{0.337752193f, 0.503665447f},
-std::array<float,2>{0.185520425f, 0.135773286f},
-std::array<float,2>{0.761897504f, 0.83496815f},
-std::array<float,2>{0.834297776f, 0.411966354f},
-std::array<float,2>{0.194395512f, 0.706047833f},
-std::array<float,2>{0.298113883f, 0.102542728f},
-std::array<float,2>{0.564216375f, 0.929152846f},
-std::array<float,2>{0.711161315f, 0.223237664f},
-std::array<float,2>{0.433235347f, 0.780146897f},
-std::array<float,2>{0.102834128f, 0.351360053f},
-std::array<float,2>{0.907329202f, 0.609589756f},
-std::array<float,2>{0.811680913f, 0.181627646f},
-std::array<float,2>{0.13753885f, 0.874375939f},
-std::array<float,2>{0.371854395f, 0.255571932f},
-std::array<float,2>{0.528392911f, 0.555400133f},
-std::array<float,2>{0.652382553f, 0.497506201f},
-std::array<float,2>{0.437513947f, 0.628672242f},
-std::array<float,2>{0.0330212116f, 0.0432442464f},
-std::array<float,2>{0.979718685f, 0.990472317f},
-std::array<float,2>{0.893880069f, 0.330990195f},
-std::array<float,2>{0.0908656493f, 0.572273672f},
-std::array<float,2>{0.39880991f, 0.194093287f},
-std::array<float,2>{0.73087883f, 0.795850039f},
-std::array<float,2>{0.597731948f, 0.0778282806f},
-std::array<float,2>{0.251489431f, 0.880822659f},
-std::array<float,2>{0.219658643f, 0.388300627f},
-std::array<float,2>{0.85262084f, 0.735193491f},
-std::array<float,2>{0.873638511f, 0.118147671f},
-std::array<float,2>{0.243937105f, 0.91064775f},
-std::array<float,2>{0.278960824f, 0.424163252f},
-std::array<float,2>{0.624412835f, 0.699739873f},
-std::array<float,2>{0.735451877f, 0.359383315f},
-std::array<float,2>{0.386430174f, 0.608875394f},
-std::array<float,2>{0.0643676296f, 0.24272418f},
-std::array<float,2>{0.876792371f, 0.75865984f},
-std::array<float,2>{0.996899486f, 0.459578276f},
-std::array<float,2>{0.0489039458f, 0.685895324f},
-std::array<float,2>{0.466785163f, 0.0261375476f},
-std::array<float,2>{0.627493858f, 0.948090553f},
-std::array<float,2>{0.512731016f, 0.141939297f},
-std::array<float,2>{0.357714087f, 0.823338151f},
-std::array<float,2>{0.141324908f, 0.311514258f},
-std::array<float,2>{0.794379294f, 0.529735029f},
-std::array<float,2>{0.926496744f, 0.20895116f},
-std::array<float,2>{0.120171994f, 0.802064478f},
-std::array<float,2>{0.407812864f, 0.321516871f},
-std::array<float,2>{0.689362764f, 0.592562318f},
-std::array<float,2>{0.590935707f, 0.405348033f},
-std::array<float,2>{0.28697288f, 0.720089436f},
-std::array<float,2>{0.214934796f, 0.0917025581f},
-std::array<float,2>{0.81909585f, 0.892370999f},
-std::array<float,2>{0.772810459f, 0.266519964f},
-std::array<float,2>{0.168746606f, 0.533197761f},
-std::array<float,2>{0.324493468f, 0.15793623f},
-std::array<float,2>{0.540012836f, 0.847671688f},
-std::array<float,2>{0.660888731f, 0.0523785613f},
-std::array<float,2>{0.492838949f, 0.981114805f},
-std::array<float,2>{0.00533833541f, 0.475798428f},
-std::array<float,2>{0.94981432f, 0.652218223f},
-std::array<float,2>{0.911606908f, 0.0556972735f},
-std::array<float,2>{0.107313119f, 0.974460125f},
-std::array<float,2>{0.43739593f, 0.476650536f},
-std::array<float,2>{0.7182886f, 0.645613492f},
-std::array<float,2>{0.567451894f, 0.276561201f},
-std::array<float,2>{0.30319652f, 0.541898966f},
-std::array<float,2>{0.187999964f, 0.167379722f},
-std::array<float,2>{0.830973923f, 0.853835583f},
-std::array<float,2>{0.758954167f, 0.395481169f},
-std::array<float,2>{0.180275008f, 0.72993505f},
-std::array<float,2>{0.341829151f, 0.0857556015f},
-std::array<float,2>{0.550835967f, 0.903986931f},
-std::array<float,2>{0.67263341f, 0.213650823f},
-std::array<float,2>{0.475417644f, 0.806283891f},
-std::array<float,2>{0.027583167f, 0.318723768f},
-std::array<float,2>{0.963445365f, 0.585651457f},
-std::array<float,2>{0.856829703f, 0.15022096f},
-std::array<float,2>{0.226376787f, 0.817456961f},
-std::array<float,2>{0.25560993f, 0.300409377f},
-std::array<float,2>{0.594078958f, 0.515771151f},
-std::array<float,2>{0.729913235f, 0.467873394f},
-std::array<float,2>{0.405556291f, 0.673684359f},
-std::array<float,2>{0.0896565169f, 0.0175753515f},
-std::array<float,2>{0.895025671f, 0.943543851f},
-std::array<float,2>{0.982497454f, 0.368362218f},
-std::array<float,2>{0.0389560759f, 0.596630514f},
-std::array<float,2>{0.442055911f, 0.23695682f},
-std::array<float,2>{0.648635209f, 0.756996632f},
-std::array<float,2>{0.526098728f, 0.115334921f},
-std::array<float,2>{0.370424628f, 0.919854164f},
-std::array<float,2>{0.134786099f, 0.433431715f},
-std::array<float,2>{0.806414783f, 0.691889584f},
-std::array<float,2>{0.789565146f, 0.0664359406f},
-std::array<float,2>{0.14604339f, 0.887281597f},
-std::array<float,2>{0.354901522f, 0.380915582f},
-std::array<float,2>{0.510973811f, 0.742717206f},
-std::array<float,2>{0.631653309f, 0.342267871f},
-std::array<float,2>{0.464184672f, 0.567255497f},
-std::array<float,2>{0.0520676672f, 0.196843818f},
-std::array<float,2>{0.994792461f, 0.785841286f},
-std::array<float,2>{0.880896747f, 0.488790125f},
-std::array<float,2>{0.0678012669f, 0.63422507f},
-std::array<float,2>{0.389762849f, 0.0325896703f},
-std::array<float,2>{0.739088774f, 0.992568552f},
-std::array<float,2>{0.619434834f, 0.17424421f},
-std::array<float,2>{0.275284797f, 0.860553622f},
-std::array<float,2>{0.246117592f, 0.265367746f},
-std::array<float,2>{0.870134532f, 0.550409853f},
-std::array<float,2>{0.946713507f, 0.230368644f},
-std::array<float,2>{0.00320755038f, 0.772325456f},
-std::array<float,2>{0.499216437f, 0.354773641f},
-std::array<float,2>{0.659400702f, 0.623276472f},
-std::array<float,2>{0.546290696f, 0.416153908f},
-std::array<float,2>{0.321920186f, 0.718652427f},
-std::array<float,2>{0.164584965f, 0.0999634117f},
-std::array<float,2>{0.766567469f, 0.934876442f},
-std::array<float,2>{0.812884092f, 0.284942389f},
-std::array<float,2>{0.211403951f, 0.51387167f},
-std::array<float,2>{0.281817317f, 0.128760412f},
-std::array<float,2>{0.586476564f, 0.841351211f},
-std::array<float,2>{0.691644788f, 0.0146345105f},
-std::array<float,2>{0.413311899f, 0.955006719f},
-std::array<float,2>{0.123874329f, 0.449036956f},
-std::array<float,2>{0.924909532f, 0.667223334f},
-std::array<float,2>{0.984816432f, 0.106077775f},
-std::array<float,2>{0.0571089126f, 0.9226017f},
-std::array<float,2>{0.455184251f, 0.409184337f},
-std::array<float,2>{0.638401031f, 0.707801878f},
-std::array<float,2>{0.500244558f, 0.345164746f},
-std::array<float,2>{0.349439561f, 0.615635574f},
-std::array<float,2>{0.152217343f, 0.22150512f},
-std::array<float,2>{0.786278963f, 0.775961936f},
-std::array<float,2>{0.85973227f, 0.443668276f},
-std::array<float,2>{0.234503329f, 0.658391058f},
-std::array<float,2>{0.273050785f, 0.00321266195f},
-std::array<float,2>{0.616592884f, 0.963671684f},
-std::array<float,2>{0.747180402f, 0.138162345f},
-std::array<float,2>{0.382205337f, 0.828871548f},
-std::array<float,2>{0.073295027f, 0.294605792f},
-std::array<float,2>{0.883938432f, 0.504346848f},
-std::array<float,2>{0.778276265f, 0.191100895f},
-std::array<float,2>{0.157172382f, 0.789154172f},
-std::array<float,2>{0.319472998f, 0.332975715f},
-std::array<float,2>{0.532434344f, 0.576253414f},
-std::array<float,2>{0.66747421f, 0.386193186f},
-std::array<float,2>{0.488845795f, 0.741422951f},
-std::array<float,2>{0.00880720746f, 0.0742098317f},
-std::array<float,2>{0.944269598f, 0.877173901f},
-std::array<float,2>{0.933053493f, 0.252900094f},
-std::array<float,2>{0.116820119f, 0.558967352f},
-std::array<float,2>{0.420253545f, 0.18524003f},
-std::array<float,2>{0.701904595f, 0.869907856f},
-std::array<float,2>{0.584799886f, 0.0420566723f},
-std::array<float,2>{0.290120095f, 0.986207008f},
-std::array<float,2>{0.208494335f, 0.493626177f},
-std::array<float,2>{0.820450604f, 0.632131875f},
-std::array<float,2>{0.839432061f, 0.0286622494f},
-std::array<float,2>{0.201154113f, 0.95078212f},
-std::array<float,2>{0.311947256f, 0.45517531f},
-std::array<float,2>{0.576263607f, 0.680470586f},
-std::array<float,2>{0.710869014f, 0.305633277f},
-std::array<float,2>{0.426792055f, 0.525915682f},
-std::array<float,2>{0.0969722196f, 0.146636948f},
-std::array<float,2>{0.919208527f, 0.827251136f},
-std::array<float,2>{0.954235852f, 0.428418994f},
-std::array<float,2>{0.0207103584f, 0.696631789f},
-std::array<float,2>{0.480553836f, 0.122222699f},
-std::array<float,2>{0.679892123f, 0.907986104f},
-std::array<float,2>{0.556556046f, 0.246917084f},
-std::array<float,2>{0.33063668f, 0.762060523f},
-std::array<float,2>{0.172707736f, 0.363986433f},
-std::array<float,2>{0.751567781f, 0.605344355f},
-std::array<float,2>{0.903651476f, 0.163439244f},
-std::array<float,2>{0.0827499852f, 0.844842136f},
-std::array<float,2>{0.395941973f, 0.270480722f},
-std::array<float,2>{0.724148273f, 0.538747787f},
-std::array<float,2>{0.602481902f, 0.469240248f},
-std::array<float,2>{0.260476679f, 0.65252912f},
-std::array<float,2>{0.227863625f, 0.0498019345f},
-std::array<float,2>{0.850114882f, 0.980074525f},
-std::array<float,2>{0.799480855f, 0.327105701f},
-std::array<float,2>{0.126254916f, 0.586376727f},
-std::array<float,2>{0.361798078f, 0.205537379f},
-std::array<float,2>{0.519266307f, 0.799120128f},
-std::array<float,2>{0.645194888f, 0.0865841582f},
-std::array<float,2>{0.449359745f, 0.897971153f},
-std::array<float,2>{0.0434951261f, 0.401155412f},
-std::array<float,2>{0.971806169f, 0.724033237f},
-std::array<float,2>{0.937217057f, 0.112526201f},
-std::array<float,2>{0.11262238f, 0.914701581f},
-std::array<float,2>{0.415364414f, 0.43642354f},
-std::array<float,2>{0.697847545f, 0.689766407f},
-std::array<float,2>{0.580069542f, 0.372080535f},
-std::array<float,2>{0.294944197f, 0.599476933f},
-std::array<float,2>{0.203330591f, 0.241789699f},
-std::array<float,2>{0.828008235f, 0.751490593f},
-std::array<float,2>{0.77515471f, 0.463634253f},
-std::array<float,2>{0.161361784f, 0.678874671f},
-std::array<float,2>{0.315850109f, 0.0228407774f},
-std::array<float,2>{0.536128283f, 0.939291537f},
-std::array<float,2>{0.668484688f, 0.155419752f},
-std::array<float,2>{0.485598236f, 0.81349498f},
-std::array<float,2>{0.0132073667f, 0.303294033f},
-std::array<float,2>{0.940778255f, 0.522896051f},
-std::array<float,2>{0.864506662f, 0.217086479f},
-std::array<float,2>{0.24001193f, 0.80863899f},
-std::array<float,2>{0.267829657f, 0.314813077f},
-std::array<float,2>{0.61206454f, 0.579284668f},
-std::array<float,2>{0.745227456f, 0.3907125f},
-std::array<float,2>{0.377989292f, 0.732361019f},
-std::array<float,2>{0.0766929388f, 0.0807414353f},
-std::array<float,2>{0.889479816f, 0.898514926f},
-std::array<float,2>{0.991043448f, 0.280108631f},
-std::array<float,2>{0.0606749542f, 0.545361042f},
-std::array<float,2>{0.46043703f, 0.171619236f},
-std::array<float,2>{0.636169255f, 0.859098673f},
-std::array<float,2>{0.507221043f, 0.061565958f},
-std::array<float,2>{0.346621811f, 0.968902826f},
-std::array<float,2>{0.154203936f, 0.482081234f},
-std::array<float,2>{0.783988357f, 0.640847504f},
-std::array<float,2>{0.802602947f, 0.00889223535f},
-std::array<float,2>{0.131415859f, 0.960511684f},
-std::array<float,2>{0.364977241f, 0.450795233f},
-std::array<float,2>{0.520852566f, 0.670676589f},
-std::array<float,2>{0.642795205f, 0.288095564f},
-std::array<float,2>{0.448384494f, 0.510415792f},
-std::array<float,2>{0.0411456749f, 0.131851703f},
-std::array<float,2>{0.97347784f, 0.839589834f},
-std::array<float,2>{0.901687384f, 0.419876993f},
-std::array<float,2>{0.0784044117f, 0.712809145f},
-std::array<float,2>{0.393873423f, 0.0942138955f},
-std::array<float,2>{0.720967114f, 0.933434248f},
-std::array<float,2>{0.606256425f, 0.231421217f},
-std::array<float,2>{0.262920737f, 0.766898215f},
-std::array<float,2>{0.232937962f, 0.357475728f},
-std::array<float,2>{0.843793273f, 0.617764115f},
-std::array<float,2>{0.957321584f, 0.178645387f},
-std::array<float,2>{0.0170441326f, 0.863896906f},
-std::array<float,2>{0.478517145f, 0.25898093f},
-std::array<float,2>{0.686961234f, 0.552092969f},
-std::array<float,2>{0.559771597f, 0.487563789f},
-std::array<float,2>{0.333498091f, 0.637063682f},
-std::array<float,2>{0.179636493f, 0.0358107686f},
-std::array<float,2>{0.754840732f, 0.999772012f},
-std::array<float,2>{0.843709528f, 0.33867985f},
-std::array<float,2>{0.197405845f, 0.564442813f},
-std::array<float,2>{0.305931777f, 0.201842293f},
-std::array<float,2>{0.573362112f, 0.783333719f},
-std::array<float,2>{0.70486629f, 0.0637305155f},
-std::array<float,2>{0.425586075f, 0.883960366f},
-std::array<float,2>{0.0983980075f, 0.378017187f},
-std::array<float,2>{0.915870309f, 0.746627808f},
-std::array<float,2>{0.978030324f, 0.0460883193f},
-std::array<float,2>{0.0340129435f, 0.989085674f},
-std::array<float,2>{0.439706743f, 0.498615503f},
-std::array<float,2>{0.654689848f, 0.625567436f},
-std::array<float,2>{0.530939698f, 0.257662475f},
-std::array<float,2>{0.374147594f, 0.558456004f},
-std::array<float,2>{0.140424997f, 0.182475537f},
-std::array<float,2>{0.809566438f, 0.871976197f},
-std::array<float,2>{0.853613317f, 0.389372468f},
-std::array<float,2>{0.220770687f, 0.737542331f},
-std::array<float,2>{0.253663033f, 0.0757084638f},
-std::array<float,2>{0.600072801f, 0.880887628f},
-std::array<float,2>{0.733326137f, 0.1915223f},
-std::array<float,2>{0.401587218f, 0.793298662f},
-std::array<float,2>{0.0935277268f, 0.329757214f},
-std::array<float,2>{0.890693545f, 0.570889533f},
-std::array<float,2>{0.765198529f, 0.133612573f},
-std::array<float,2>{0.186220288f, 0.832122803f},
-std::array<float,2>{0.339294851f, 0.292460173f},
-std::array<float,2>{0.549475014f, 0.501893938f},
-std::array<float,2>{0.677560985f, 0.438928872f},
-std::array<float,2>{0.469851404f, 0.663226604f},
-std::array<float,2>{0.0241384618f, 0.00499461964f},
-std::array<float,2>{0.96524018f, 0.96625495f},
-std::array<float,2>{0.909798563f, 0.349429578f},
-std::array<float,2>{0.104189962f, 0.612271428f},
-std::array<float,2>{0.431636691f, 0.225055337f},
-std::array<float,2>{0.714597046f, 0.777512312f},
-std::array<float,2>{0.566154838f, 0.10353855f},
-std::array<float,2>{0.299921215f, 0.925992489f},
-std::array<float,2>{0.193213016f, 0.413033009f},
-std::array<float,2>{0.833814144f, 0.703728497f},
-std::array<float,2>{0.817555189f, 0.0919588506f},
-std::array<float,2>{0.218305588f, 0.89449954f},
-std::array<float,2>{0.288037717f, 0.402751744f},
-std::array<float,2>{0.593747318f, 0.722435057f},
-std::array<float,2>{0.690611959f, 0.3225694f},
-std::array<float,2>{0.409005165f, 0.59076196f},
-std::array<float,2>{0.117518127f, 0.209662914f},
-std::array<float,2>{0.929523945f, 0.803866625f},
-std::array<float,2>{0.953013659f, 0.472959965f},
-std::array<float,2>{0.00674843136f, 0.64888072f},
-std::array<float,2>{0.494632065f, 0.05342751f},
-std::array<float,2>{0.662571251f, 0.983350635f},
-std::array<float,2>{0.542962313f, 0.159982532f},
-std::array<float,2>{0.328080148f, 0.850145996f},
-std::array<float,2>{0.170060515f, 0.268111199f},
-std::array<float,2>{0.771452785f, 0.533328116f},
-std::array<float,2>{0.8787269f, 0.245640963f},
-std::array<float,2>{0.0646381453f, 0.76152581f},
-std::array<float,2>{0.383206248f, 0.362141788f},
-std::array<float,2>{0.737039745f, 0.605799496f},
-std::array<float,2>{0.622251272f, 0.422542721f},
-std::array<float,2>{0.280680835f, 0.701571286f},
-std::array<float,2>{0.244534269f, 0.120455295f},
-std::array<float,2>{0.872386515f, 0.913293242f},
-std::array<float,2>{0.796766818f, 0.308673322f},
-std::array<float,2>{0.143980742f, 0.52756238f},
-std::array<float,2>{0.355904698f, 0.143990263f},
-std::array<float,2>{0.514973283f, 0.822189152f},
-std::array<float,2>{0.626579642f, 0.0251039602f},
-std::array<float,2>{0.467636466f, 0.94691658f},
-std::array<float,2>{0.0482661501f, 0.457590371f},
-std::array<float,2>{0.99944824f, 0.685268521f},
-std::array<float,2>{0.897527277f, 0.0192128625f},
-std::array<float,2>{0.0864487812f, 0.943041682f},
-std::array<float,2>{0.40268302f, 0.465078056f},
-std::array<float,2>{0.728454232f, 0.675498843f},
-std::array<float,2>{0.597633123f, 0.298722476f},
-std::array<float,2>{0.25753203f, 0.518122077f},
-std::array<float,2>{0.222862557f, 0.150675118f},
-std::array<float,2>{0.857652187f, 0.818980694f},
-std::array<float,2>{0.807632387f, 0.430073678f},
-std::array<float,2>{0.133892074f, 0.695035338f},
-std::array<float,2>{0.367917567f, 0.114833869f},
-std::array<float,2>{0.523853838f, 0.921662092f},
-std::array<float,2>{0.651010156f, 0.235460371f},
-std::array<float,2>{0.44352442f, 0.754140615f},
-std::array<float,2>{0.0367581993f, 0.369791061f},
-std::array<float,2>{0.980919957f, 0.59375298f},
-std::array<float,2>{0.828608513f, 0.165450662f},
-std::array<float,2>{0.191270217f, 0.852800071f},
-std::array<float,2>{0.302405119f, 0.273636252f},
-std::array<float,2>{0.569726348f, 0.540587485f},
-std::array<float,2>{0.716751635f, 0.479133755f},
-std::array<float,2>{0.433690667f, 0.648420095f},
-std::array<float,2>{0.10768301f, 0.0575513057f},
-std::array<float,2>{0.912764668f, 0.97496438f},
-std::array<float,2>{0.962521076f, 0.317342877f},
-std::array<float,2>{0.0294335019f, 0.582974613f},
-std::array<float,2>{0.474301189f, 0.212812647f},
-std::array<float,2>{0.675427258f, 0.808056295f},
-std::array<float,2>{0.552863896f, 0.082675375f},
-std::array<float,2>{0.340238839f, 0.905855179f},
-std::array<float,2>{0.183354855f, 0.397328883f},
-std::array<float,2>{0.761419177f, 0.727207065f},
-std::array<float,2>{0.768653989f, 0.097729899f},
-std::array<float,2>{0.166153908f, 0.937313914f},
-std::array<float,2>{0.324078709f, 0.414387375f},
-std::array<float,2>{0.543709874f, 0.714901805f},
-std::array<float,2>{0.657290697f, 0.35290882f},
-std::array<float,2>{0.496386826f, 0.622958481f},
-std::array<float,2>{0.00011624804f, 0.226836562f},
-std::array<float,2>{0.948781848f, 0.769822061f},
-std::array<float,2>{0.922895491f, 0.445526183f},
-std::array<float,2>{0.122594148f, 0.664520144f},
-std::array<float,2>{0.410685778f, 0.0122714387f},
-std::array<float,2>{0.695142865f, 0.956914425f},
-std::array<float,2>{0.589517593f, 0.12637271f},
-std::array<float,2>{0.284314424f, 0.8427279f},
-std::array<float,2>{0.213362634f, 0.282139122f},
-std::array<float,2>{0.815777838f, 0.512298048f},
-std::array<float,2>{0.993829608f, 0.198115692f},
-std::array<float,2>{0.0546776056f, 0.787838221f},
-std::array<float,2>{0.461350054f, 0.340172261f},
-std::array<float,2>{0.629148841f, 0.569957316f},
-std::array<float,2>{0.509137034f, 0.3794218f},
-std::array<float,2>{0.35247919f, 0.744446635f},
-std::array<float,2>{0.147645563f, 0.0687893108f},
-std::array<float,2>{0.791257799f, 0.88980329f},
-std::array<float,2>{0.86801064f, 0.263387859f},
-std::array<float,2>{0.249706179f, 0.547562599f},
-std::array<float,2>{0.276199609f, 0.171927586f},
-std::array<float,2>{0.618531704f, 0.861362219f},
-std::array<float,2>{0.740824521f, 0.0348143727f},
-std::array<float,2>{0.388479888f, 0.994814217f},
-std::array<float,2>{0.0694060698f, 0.491571724f},
-std::array<float,2>{0.87923193f, 0.636448026f},
-std::array<float,2>{0.942368209f, 0.0707423016f},
-std::array<float,2>{0.0115681654f, 0.875001013f},
-std::array<float,2>{0.492023766f, 0.383358896f},
-std::array<float,2>{0.664156199f, 0.740129411f},
-std::array<float,2>{0.535096526f, 0.335929334f},
-std::array<float,2>{0.317640632f, 0.576136529f},
-std::array<float,2>{0.159877181f, 0.188375011f},
-std::array<float,2>{0.780576408f, 0.791759908f},
-std::array<float,2>{0.822701037f, 0.49565804f},
-std::array<float,2>{0.210567504f, 0.630178452f},
-std::array<float,2>{0.292310417f, 0.0391812883f},
-std::array<float,2>{0.582470119f, 0.986579418f},
-std::array<float,2>{0.699458539f, 0.185674846f},
-std::array<float,2>{0.419617355f, 0.867252648f},
-std::array<float,2>{0.113370255f, 0.251170754f},
-std::array<float,2>{0.929865181f, 0.561525524f},
-std::array<float,2>{0.787483215f, 0.220237389f},
-std::array<float,2>{0.149923503f, 0.775329709f},
-std::array<float,2>{0.350838542f, 0.34612143f},
-std::array<float,2>{0.503840148f, 0.614833713f},
-std::array<float,2>{0.639904678f, 0.407000393f},
-std::array<float,2>{0.454327464f, 0.710877478f},
-std::array<float,2>{0.0551229492f, 0.108867861f},
-std::array<float,2>{0.988160551f, 0.925087571f},
-std::array<float,2>{0.885311663f, 0.296615511f},
-std::array<float,2>{0.0707513392f, 0.507357359f},
-std::array<float,2>{0.379786491f, 0.140143201f},
-std::array<float,2>{0.749714077f, 0.831269324f},
-std::array<float,2>{0.613692284f, 0.00179553719f},
-std::array<float,2>{0.270270795f, 0.960968912f},
-std::array<float,2>{0.237984523f, 0.442020684f},
-std::array<float,2>{0.862113595f, 0.656727314f},
-std::array<float,2>{0.847971976f, 0.0485762022f},
-std::array<float,2>{0.229290992f, 0.978237212f},
-std::array<float,2>{0.259148657f, 0.47176674f},
-std::array<float,2>{0.604649901f, 0.655880213f},
-std::array<float,2>{0.726319313f, 0.272170991f},
-std::array<float,2>{0.39806661f, 0.536781251f},
-std::array<float,2>{0.0842815638f, 0.160677418f},
-std::array<float,2>{0.90452081f, 0.846896589f},
-std::array<float,2>{0.970249951f, 0.400099367f},
-std::array<float,2>{0.0459115505f, 0.726477563f},
-std::array<float,2>{0.451817989f, 0.088446334f},
-std::array<float,2>{0.647617579f, 0.89633739f},
-std::array<float,2>{0.516103625f, 0.203961536f},
-std::array<float,2>{0.361224771f, 0.798622251f},
-std::array<float,2>{0.127997383f, 0.325597286f},
-std::array<float,2>{0.797884107f, 0.588492274f},
-std::array<float,2>{0.920435905f, 0.146082863f},
-std::array<float,2>{0.0952685401f, 0.825573683f},
-std::array<float,2>{0.428914398f, 0.308359772f},
-std::array<float,2>{0.707665086f, 0.525317907f},
-std::array<float,2>{0.575368106f, 0.455020398f},
-std::array<float,2>{0.310131997f, 0.682576656f},
-std::array<float,2>{0.202663481f, 0.0294981357f},
-std::array<float,2>{0.836356461f, 0.951509476f},
-std::array<float,2>{0.753257692f, 0.365368038f},
-std::array<float,2>{0.174913138f, 0.601648629f},
-std::array<float,2>{0.330008656f, 0.249845624f},
-std::array<float,2>{0.556869924f, 0.764198601f},
-std::array<float,2>{0.683302164f, 0.124359675f},
-std::array<float,2>{0.483785361f, 0.909976363f},
-std::array<float,2>{0.0218833946f, 0.427368879f},
-std::array<float,2>{0.955130219f, 0.698526859f},
-std::array<float,2>{0.898664713f, 0.094869636f},
-std::array<float,2>{0.0802008137f, 0.932186007f},
-std::array<float,2>{0.391570866f, 0.418061256f},
-std::array<float,2>{0.720178545f, 0.711040735f},
-std::array<float,2>{0.608728707f, 0.359338373f},
-std::array<float,2>{0.26407817f, 0.619091392f},
-std::array<float,2>{0.231870532f, 0.232347816f},
-std::array<float,2>{0.846620202f, 0.766319633f},
-std::array<float,2>{0.80414021f, 0.449655831f},
-std::array<float,2>{0.129695833f, 0.671691775f},
-std::array<float,2>{0.366703868f, 0.00855262112f},
-std::array<float,2>{0.521918356f, 0.959251821f},
-std::array<float,2>{0.641486526f, 0.130931079f},
-std::array<float,2>{0.445972443f, 0.838348448f},
-std::array<float,2>{0.0394563824f, 0.287535191f},
-std::array<float,2>{0.975344837f, 0.51131165f},
-std::array<float,2>{0.8398875f, 0.202347249f},
-std::array<float,2>{0.197196364f, 0.784468293f},
-std::array<float,2>{0.308242083f, 0.339118838f},
-std::array<float,2>{0.571765423f, 0.562983692f},
-std::array<float,2>{0.70550549f, 0.377449274f},
-std::array<float,2>{0.422344863f, 0.747897446f},
-std::array<float,2>{0.101076409f, 0.0634408668f},
-std::array<float,2>{0.917173684f, 0.883099973f},
-std::array<float,2>{0.960932076f, 0.258191317f},
-std::array<float,2>{0.0188718643f, 0.551030517f},
-std::array<float,2>{0.478126168f, 0.179416686f},
-std::array<float,2>{0.685050845f, 0.864556849f},
-std::array<float,2>{0.562363267f, 0.0363395549f},
-std::array<float,2>{0.33573705f, 0.998846292f},
-std::array<float,2>{0.17773056f, 0.486828953f},
-std::array<float,2>{0.757602751f, 0.638488472f},
-std::array<float,2>{0.77647537f, 0.0215404164f},
-std::array<float,2>{0.16296494f, 0.938335299f},
-std::array<float,2>{0.313504994f, 0.464154214f},
-std::array<float,2>{0.537620485f, 0.677860796f},
-std::array<float,2>{0.670406044f, 0.303864479f},
-std::array<float,2>{0.487385988f, 0.522297502f},
-std::array<float,2>{0.0142896473f, 0.155139461f},
-std::array<float,2>{0.939322412f, 0.812818468f},
-std::array<float,2>{0.933745921f, 0.437057018f},
-std::array<float,2>{0.110501148f, 0.691132486f},
-std::array<float,2>{0.416911215f, 0.112124793f},
-std::array<float,2>{0.697261631f, 0.915444255f},
-std::array<float,2>{0.580413699f, 0.240932882f},
-std::array<float,2>{0.29429099f, 0.750236332f},
-std::array<float,2>{0.205407873f, 0.371360511f},
-std::array<float,2>{0.82583487f, 0.597957611f},
-std::array<float,2>{0.989265561f, 0.17050685f},
-std::array<float,2>{0.0604474284f, 0.858156979f},
-std::array<float,2>{0.45876351f, 0.280851066f},
-std::array<float,2>{0.632934153f, 0.545975566f},
-std::array<float,2>{0.505741835f, 0.480973423f},
-std::array<float,2>{0.343933553f, 0.641958773f},
-std::array<float,2>{0.154977322f, 0.0609492846f},
-std::array<float,2>{0.781362236f, 0.969868362f},
-std::array<float,2>{0.865465045f, 0.316157341f},
-std::array<float,2>{0.241182819f, 0.578572929f},
-std::array<float,2>{0.265994102f, 0.218282565f},
-std::array<float,2>{0.610730171f, 0.810194254f},
-std::array<float,2>{0.742515206f, 0.0813431591f},
-std::array<float,2>{0.375358999f, 0.900125206f},
-std::array<float,2>{0.0742661953f, 0.392298162f},
-std::array<float,2>{0.888385057f, 0.731342912f},
-std::array<float,2>{0.950484455f, 0.0538726114f},
-std::array<float,2>{0.00466170674f, 0.984073997f},
-std::array<float,2>{0.49323374f, 0.473952889f},
-std::array<float,2>{0.661767721f, 0.649562597f},
-std::array<float,2>{0.540224552f, 0.269090146f},
-std::array<float,2>{0.325824946f, 0.534530044f},
-std::array<float,2>{0.169043392f, 0.158715084f},
-std::array<float,2>{0.771943748f, 0.851276577f},
-std::array<float,2>{0.820080757f, 0.403372794f},
-std::array<float,2>{0.216166615f, 0.721116662f},
-std::array<float,2>{0.285690457f, 0.0929210261f},
-std::array<float,2>{0.589959741f, 0.892844319f},
-std::array<float,2>{0.688353896f, 0.210421905f},
-std::array<float,2>{0.406609982f, 0.802949846f},
-std::array<float,2>{0.119945422f, 0.323788494f},
-std::array<float,2>{0.927492619f, 0.591372013f},
-std::array<float,2>{0.793703437f, 0.142697737f},
-std::array<float,2>{0.142236009f, 0.821223021f},
-std::array<float,2>{0.35920015f, 0.309819669f},
-std::array<float,2>{0.512480915f, 0.528824389f},
-std::array<float,2>{0.628266096f, 0.458135039f},
-std::array<float,2>{0.465006351f, 0.683923841f},
-std::array<float,2>{0.0501776375f, 0.0239464156f},
-std::array<float,2>{0.99796772f, 0.945899606f},
-std::array<float,2>{0.875173986f, 0.36306265f},
-std::array<float,2>{0.0632112101f, 0.60713321f},
-std::array<float,2>{0.385195524f, 0.244191751f},
-std::array<float,2>{0.735307157f, 0.760007262f},
-std::array<float,2>{0.623064756f, 0.120078243f},
-std::array<float,2>{0.27821213f, 0.912997603f},
-std::array<float,2>{0.243042171f, 0.422974765f},
-std::array<float,2>{0.874772191f, 0.702629924f},
-std::array<float,2>{0.852221429f, 0.0745717511f},
-std::array<float,2>{0.220016047f, 0.882625878f},
-std::array<float,2>{0.250200838f, 0.390444785f},
-std::array<float,2>{0.599084377f, 0.736551285f},
-std::array<float,2>{0.73180151f, 0.328374326f},
-std::array<float,2>{0.400253713f, 0.571866453f},
-std::array<float,2>{0.090728581f, 0.19288753f},
-std::array<float,2>{0.893207371f, 0.794231117f},
-std::array<float,2>{0.978589594f, 0.499165922f},
-std::array<float,2>{0.0317735076f, 0.626241326f},
-std::array<float,2>{0.438597322f, 0.0451414548f},
-std::array<float,2>{0.653669834f, 0.989967227f},
-std::array<float,2>{0.52802223f, 0.183420867f},
-std::array<float,2>{0.372952402f, 0.872374177f},
-std::array<float,2>{0.138122559f, 0.256137878f},
-std::array<float,2>{0.810615122f, 0.55757302f},
-std::array<float,2>{0.906609178f, 0.225800246f},
-std::array<float,2>{0.102001034f, 0.778662622f},
-std::array<float,2>{0.432325393f, 0.347891361f},
-std::array<float,2>{0.712317228f, 0.61292696f},
-std::array<float,2>{0.563346744f, 0.413793117f},
-std::array<float,2>{0.296875209f, 0.70483613f},
-std::array<float,2>{0.193634629f, 0.10542354f},
-std::array<float,2>{0.835190713f, 0.927052617f},
-std::array<float,2>{0.763193607f, 0.291325092f},
-std::array<float,2>{0.184311613f, 0.500818014f},
-std::array<float,2>{0.336410165f, 0.133860946f},
-std::array<float,2>{0.548637629f, 0.833454311f},
-std::array<float,2>{0.678732514f, 0.0045601516f},
-std::array<float,2>{0.471844137f, 0.964865565f},
-std::array<float,2>{0.026565617f, 0.437819213f},
-std::array<float,2>{0.967181981f, 0.662440538f},
-std::array<float,2>{0.924597442f, 0.0135419061f},
-std::array<float,2>{0.124509804f, 0.955813169f},
-std::array<float,2>{0.413055301f, 0.446332693f},
-std::array<float,2>{0.692659616f, 0.665364921f},
-std::array<float,2>{0.58780545f, 0.282595724f},
-std::array<float,2>{0.282534271f, 0.513553381f},
-std::array<float,2>{0.212864041f, 0.125310719f},
-std::array<float,2>{0.814451873f, 0.842977464f},
-std::array<float,2>{0.767125487f, 0.415647805f},
-std::array<float,2>{0.16559267f, 0.716282308f},
-std::array<float,2>{0.321003526f, 0.0993596539f},
-std::array<float,2>{0.545428574f, 0.935903728f},
-std::array<float,2>{0.659014225f, 0.228399307f},
-std::array<float,2>{0.498710901f, 0.770957708f},
-std::array<float,2>{0.00210580626f, 0.351933151f},
-std::array<float,2>{0.945415854f, 0.621551573f},
-std::array<float,2>{0.869388282f, 0.173377052f},
-std::array<float,2>{0.247149825f, 0.863093197f},
-std::array<float,2>{0.2740933f, 0.262494445f},
-std::array<float,2>{0.620475173f, 0.5481776f},
-std::array<float,2>{0.739455223f, 0.490298003f},
-std::array<float,2>{0.389233351f, 0.634783387f},
-std::array<float,2>{0.0668254495f, 0.0336073525f},
-std::array<float,2>{0.882570028f, 0.995179594f},
-std::array<float,2>{0.995249331f, 0.340978235f},
-std::array<float,2>{0.0513702743f, 0.56896472f},
-std::array<float,2>{0.463200569f, 0.198824823f},
-std::array<float,2>{0.632357717f, 0.788101137f},
-std::array<float,2>{0.510676324f, 0.0700868592f},
-std::array<float,2>{0.354387909f, 0.888815463f},
-std::array<float,2>{0.144637793f, 0.380713165f},
-std::array<float,2>{0.790418863f, 0.745334744f},
-std::array<float,2>{0.804775476f, 0.114231817f},
-std::array<float,2>{0.136601657f, 0.920738935f},
-std::array<float,2>{0.369526476f, 0.431265861f},
-std::array<float,2>{0.526867211f, 0.693917274f},
-std::array<float,2>{0.649607778f, 0.370383829f},
-std::array<float,2>{0.443110973f, 0.595102847f},
-std::array<float,2>{0.0374715999f, 0.234671205f},
-std::array<float,2>{0.98371017f, 0.755739808f},
-std::array<float,2>{0.896091223f, 0.466005325f},
-std::array<float,2>{0.0883968025f, 0.674244761f},
-std::array<float,2>{0.404493034f, 0.018275965f},
-std::array<float,2>{0.728901625f, 0.941488624f},
-std::array<float,2>{0.595489323f, 0.152305067f},
-std::array<float,2>{0.254698128f, 0.819536865f},
-std::array<float,2>{0.225577384f, 0.297575653f},
-std::array<float,2>{0.856349051f, 0.518805146f},
-std::array<float,2>{0.964321256f, 0.211031616f},
-std::array<float,2>{0.0290166605f, 0.807153761f},
-std::array<float,2>{0.47601673f, 0.318164706f},
-std::array<float,2>{0.673477113f, 0.58381778f},
-std::array<float,2>{0.552392006f, 0.398406774f},
-std::array<float,2>{0.34349376f, 0.728438795f},
-std::array<float,2>{0.181343973f, 0.0830174536f},
-std::array<float,2>{0.75812304f, 0.904675484f},
-std::array<float,2>{0.831656456f, 0.275251091f},
-std::array<float,2>{0.18934679f, 0.539963007f},
-std::array<float,2>{0.304267108f, 0.16501686f},
-std::array<float,2>{0.5671978f, 0.851784229f},
-std::array<float,2>{0.717031777f, 0.0581554547f},
-std::array<float,2>{0.435996622f, 0.975652695f},
-std::array<float,2>{0.105695061f, 0.479958892f},
-std::array<float,2>{0.911060512f, 0.646759987f},
-std::array<float,2>{0.97084558f, 0.0893517733f},
-std::array<float,2>{0.0445361324f, 0.894542694f},
-std::array<float,2>{0.450637162f, 0.39851284f},
-std::array<float,2>{0.646306515f, 0.725531697f},
-std::array<float,2>{0.518433988f, 0.324952841f},
-std::array<float,2>{0.36278078f, 0.589588165f},
-std::array<float,2>{0.125514239f, 0.204607785f},
-std::array<float,2>{0.799997091f, 0.79713726f},
-std::array<float,2>{0.851193726f, 0.471283227f},
-std::array<float,2>{0.227473319f, 0.65507859f},
-std::array<float,2>{0.260930508f, 0.0469038598f},
-std::array<float,2>{0.603454649f, 0.97656405f},
-std::array<float,2>{0.723250449f, 0.161315411f},
-std::array<float,2>{0.3950679f, 0.845779777f},
-std::array<float,2>{0.0838084295f, 0.27322188f},
-std::array<float,2>{0.903257847f, 0.535726845f},
-std::array<float,2>{0.750371873f, 0.248446167f},
-std::array<float,2>{0.173783988f, 0.765527248f},
-std::array<float,2>{0.331485689f, 0.36677438f},
-std::array<float,2>{0.555631161f, 0.602851391f},
-std::array<float,2>{0.681286693f, 0.42639035f},
-std::array<float,2>{0.482258916f, 0.698108077f},
-std::array<float,2>{0.0201011673f, 0.123223692f},
-std::array<float,2>{0.953818798f, 0.908405125f},
-std::array<float,2>{0.918032825f, 0.307544887f},
-std::array<float,2>{0.0963135958f, 0.52395153f},
-std::array<float,2>{0.426243931f, 0.144746467f},
-std::array<float,2>{0.70943445f, 0.82499814f},
-std::array<float,2>{0.57752794f, 0.0311551671f},
-std::array<float,2>{0.311355561f, 0.952863812f},
-std::array<float,2>{0.199258685f, 0.453835905f},
-std::array<float,2>{0.838420093f, 0.68307972f},
-std::array<float,2>{0.821593642f, 0.0406437106f},
-std::array<float,2>{0.207726091f, 0.987608492f},
-std::array<float,2>{0.28954193f, 0.494736224f},
-std::array<float,2>{0.585154355f, 0.629036486f},
-std::array<float,2>{0.702995002f, 0.250406981f},
-std::array<float,2>{0.421745867f, 0.561316907f},
-std::array<float,2>{0.116118677f, 0.186604455f},
-std::array<float,2>{0.931969225f, 0.868575752f},
-std::array<float,2>{0.944479108f, 0.384141743f},
-std::array<float,2>{0.00867161993f, 0.738691092f},
-std::array<float,2>{0.48978135f, 0.0719262362f},
-std::array<float,2>{0.666842699f, 0.876294971f},
-std::array<float,2>{0.531910121f, 0.189342409f},
-std::array<float,2>{0.3184264f, 0.792830646f},
-std::array<float,2>{0.157619908f, 0.33483237f},
-std::array<float,2>{0.778642952f, 0.575165212f},
-std::array<float,2>{0.883370936f, 0.138701633f},
-std::array<float,2>{0.0724077448f, 0.831044376f},
-std::array<float,2>{0.381278962f, 0.295090497f},
-std::array<float,2>{0.746943593f, 0.506203115f},
-std::array<float,2>{0.616035044f, 0.443223834f},
-std::array<float,2>{0.271581352f, 0.657320619f},
-std::array<float,2>{0.235782057f, 0.000478780625f},
-std::array<float,2>{0.861107707f, 0.962242544f},
-std::array<float,2>{0.785942256f, 0.347595364f},
-std::array<float,2>{0.151109025f, 0.613929868f},
-std::array<float,2>{0.348382413f, 0.219235957f},
-std::array<float,2>{0.501787007f, 0.774216354f},
-std::array<float,2>{0.636733711f, 0.107842237f},
-std::array<float,2>{0.456421822f, 0.924365819f},
-std::array<float,2>{0.0583022796f, 0.407561153f},
-std::array<float,2>{0.98631829f, 0.709151506f},
-std::array<float,2>{0.914930522f, 0.0649834648f},
-std::array<float,2>{0.0995287523f, 0.886593103f},
-std::array<float,2>{0.424193561f, 0.37583223f},
-std::array<float,2>{0.703399479f, 0.749282956f},
-std::array<float,2>{0.572817266f, 0.336344182f},
-std::array<float,2>{0.305288404f, 0.56452018f},
-std::array<float,2>{0.198737815f, 0.199308261f},
-std::array<float,2>{0.841975212f, 0.782391787f},
-std::array<float,2>{0.755709171f, 0.485255837f},
-std::array<float,2>{0.178035796f, 0.638732791f},
-std::array<float,2>{0.332937419f, 0.0374427401f},
-std::array<float,2>{0.558840871f, 0.996418715f},
-std::array<float,2>{0.686316073f, 0.17741546f},
-std::array<float,2>{0.480448633f, 0.867039263f},
-std::array<float,2>{0.0164575335f, 0.260595888f},
-std::array<float,2>{0.958637834f, 0.553123057f},
-std::array<float,2>{0.844792068f, 0.23264654f},
-std::array<float,2>{0.233582959f, 0.768002689f},
-std::array<float,2>{0.261820227f, 0.356732666f},
-std::array<float,2>{0.606739938f, 0.620971262f},
-std::array<float,2>{0.721942604f, 0.421299696f},
-std::array<float,2>{0.392617911f, 0.714175165f},
-std::array<float,2>{0.0791506693f, 0.0974995196f},
-std::array<float,2>{0.901206195f, 0.931057334f},
-std::array<float,2>{0.974151969f, 0.285170496f},
-std::array<float,2>{0.0420161411f, 0.508855522f},
-std::array<float,2>{0.447833687f, 0.12937668f},
-std::array<float,2>{0.644230485f, 0.837215602f},
-std::array<float,2>{0.520343184f, 0.0115239238f},
-std::array<float,2>{0.363374949f, 0.957112849f},
-std::array<float,2>{0.13209036f, 0.452790022f},
-std::array<float,2>{0.801038802f, 0.668848932f},
-std::array<float,2>{0.784911752f, 0.0601450317f},
-std::array<float,2>{0.152457342f, 0.972122788f},
-std::array<float,2>{0.34684971f, 0.482717425f},
-std::array<float,2>{0.505862474f, 0.64259547f},
-std::array<float,2>{0.635353506f, 0.277493656f},
-std::array<float,2>{0.459558576f, 0.543379247f},
-std::array<float,2>{0.0618918613f, 0.169055939f},
-std::array<float,2>{0.992137134f, 0.856671512f},
-std::array<float,2>{0.890001118f, 0.392759442f},
-std::array<float,2>{0.0775280222f, 0.733227372f},
-std::array<float,2>{0.377582967f, 0.0781871006f},
-std::array<float,2>{0.744834125f, 0.901573956f},
-std::array<float,2>{0.612385511f, 0.215470374f},
-std::array<float,2>{0.269221842f, 0.811525822f},
-std::array<float,2>{0.238846391f, 0.313612938f},
-std::array<float,2>{0.863853574f, 0.580200732f},
-std::array<float,2>{0.939671218f, 0.152872637f},
-std::array<float,2>{0.0119160665f, 0.815477908f},
-std::array<float,2>{0.484390557f, 0.301923454f},
-std::array<float,2>{0.669270694f, 0.521295369f},
-std::array<float,2>{0.537017941f, 0.462417126f},
-std::array<float,2>{0.31489262f, 0.676967561f},
-std::array<float,2>{0.160343662f, 0.0207746793f},
-std::array<float,2>{0.773519456f, 0.940764129f},
-std::array<float,2>{0.826879919f, 0.374685138f},
-std::array<float,2>{0.205035031f, 0.601029336f},
-std::array<float,2>{0.296743602f, 0.239751548f},
-std::array<float,2>{0.578319073f, 0.752998888f},
-std::array<float,2>{0.69873625f, 0.110667937f},
-std::array<float,2>{0.414809614f, 0.917478025f},
-std::array<float,2>{0.111461505f, 0.433982283f},
-std::array<float,2>{0.936117172f, 0.688868403f},
-std::array<float,2>{0.998675168f, 0.0267362464f},
-std::array<float,2>{0.0468888134f, 0.948943436f},
-std::array<float,2>{0.468138725f, 0.460933119f},
-std::array<float,2>{0.625421047f, 0.686771631f},
-std::array<float,2>{0.513836741f, 0.312359959f},
-std::array<float,2>{0.356715262f, 0.530844033f},
-std::array<float,2>{0.142758846f, 0.140837684f},
-std::array<float,2>{0.795418441f, 0.823114276f},
-std::array<float,2>{0.871826112f, 0.425551683f},
-std::array<float,2>{0.245396525f, 0.700216889f},
-std::array<float,2>{0.279393524f, 0.118933268f},
-std::array<float,2>{0.622020662f, 0.912091315f},
-std::array<float,2>{0.738163352f, 0.244049907f},
-std::array<float,2>{0.384271324f, 0.759076297f},
-std::array<float,2>{0.0657434687f, 0.361017525f},
-std::array<float,2>{0.877853274f, 0.60802865f},
-std::array<float,2>{0.769606769f, 0.157056838f},
-std::array<float,2>{0.171195507f, 0.848755181f},
-std::array<float,2>{0.326655239f, 0.266976029f},
-std::array<float,2>{0.541863263f, 0.53130126f},
-std::array<float,2>{0.663727939f, 0.475391567f},
-std::array<float,2>{0.495758772f, 0.651167989f},
-std::array<float,2>{0.00771932723f, 0.0509572029f},
-std::array<float,2>{0.951380193f, 0.981505811f},
-std::array<float,2>{0.928034663f, 0.320384443f},
-std::array<float,2>{0.118530311f, 0.593395293f},
-std::array<float,2>{0.409522623f, 0.207630679f},
-std::array<float,2>{0.689721882f, 0.801277637f},
-std::array<float,2>{0.59222728f, 0.0907655135f},
-std::array<float,2>{0.288748711f, 0.891361952f},
-std::array<float,2>{0.217165962f, 0.405251443f},
-std::array<float,2>{0.817202151f, 0.718968153f},
-std::array<float,2>{0.832470775f, 0.101664253f},
-std::array<float,2>{0.191985264f, 0.928557634f},
-std::array<float,2>{0.299278975f, 0.41056779f},
-std::array<float,2>{0.56541127f, 0.706360459f},
-std::array<float,2>{0.712909639f, 0.350413263f},
-std::array<float,2>{0.430405498f, 0.611014187f},
-std::array<float,2>{0.104629569f, 0.224477455f},
-std::array<float,2>{0.909094095f, 0.78040725f},
-std::array<float,2>{0.966685057f, 0.441385031f},
-std::array<float,2>{0.0244849492f, 0.660471022f},
-std::array<float,2>{0.469347328f, 0.00627712207f},
-std::array<float,2>{0.675940275f, 0.968100607f},
-std::array<float,2>{0.55053252f, 0.135253608f},
-std::array<float,2>{0.33799243f, 0.83495307f},
-std::array<float,2>{0.187417254f, 0.290035963f},
-std::array<float,2>{0.764086902f, 0.502421975f},
-std::array<float,2>{0.892573714f, 0.195118859f},
-std::array<float,2>{0.0927049518f, 0.795932591f},
-std::array<float,2>{0.401066869f, 0.331499368f},
-std::array<float,2>{0.734022856f, 0.573830009f},
-std::array<float,2>{0.600809753f, 0.387366176f},
-std::array<float,2>{0.252664417f, 0.735770166f},
-std::array<float,2>{0.222506687f, 0.0764135644f},
-std::array<float,2>{0.854968309f, 0.879745483f},
-std::array<float,2>{0.809733927f, 0.254428834f},
-std::array<float,2>{0.139297947f, 0.555788755f},
-std::array<float,2>{0.37383604f, 0.180548728f},
-std::array<float,2>{0.529571354f, 0.873052299f},
-std::array<float,2>{0.655531764f, 0.0445797071f},
-std::array<float,2>{0.440884978f, 0.991627991f},
-std::array<float,2>{0.0346985757f, 0.497037411f},
-std::array<float,2>{0.97750771f, 0.627488136f},
-std::array<float,2>{0.879911721f, 0.0314226262f},
-std::array<float,2>{0.0684926286f, 0.993952334f},
-std::array<float,2>{0.386837184f, 0.489705741f},
-std::array<float,2>{0.742051065f, 0.632961452f},
-std::array<float,2>{0.618115902f, 0.263820112f},
-std::array<float,2>{0.276801825f, 0.549167633f},
-std::array<float,2>{0.248836443f, 0.175111905f},
-std::array<float,2>{0.868382096f, 0.859941661f},
-std::array<float,2>{0.792082369f, 0.382501692f},
-std::array<float,2>{0.147306696f, 0.743390441f},
-std::array<float,2>{0.353206873f, 0.0682507381f},
-std::array<float,2>{0.508087695f, 0.888314366f},
-std::array<float,2>{0.629890859f, 0.195571154f},
-std::array<float,2>{0.462410599f, 0.786783755f},
-std::array<float,2>{0.0532121994f, 0.34295398f},
-std::array<float,2>{0.992305577f, 0.5677315f},
-std::array<float,2>{0.815409541f, 0.12724255f},
-std::array<float,2>{0.214391768f, 0.839947045f},
-std::array<float,2>{0.284013569f, 0.283970326f},
-std::array<float,2>{0.588141263f, 0.515050173f},
-std::array<float,2>{0.694093883f, 0.447472751f},
-std::array<float,2>{0.411789566f, 0.666289568f},
-std::array<float,2>{0.121728159f, 0.0155113684f},
-std::array<float,2>{0.922567844f, 0.953412712f},
-std::array<float,2>{0.947633982f, 0.354349315f},
-std::array<float,2>{0.00170539261f, 0.624961972f},
-std::array<float,2>{0.498025715f, 0.228991523f},
-std::array<float,2>{0.65716368f, 0.772581697f},
-std::array<float,2>{0.544219315f, 0.10084819f},
-std::array<float,2>{0.323177248f, 0.933924973f},
-std::array<float,2>{0.167422831f, 0.417793334f},
-std::array<float,2>{0.768178523f, 0.717110932f},
-std::array<float,2>{0.760577261f, 0.0849342048f},
-std::array<float,2>{0.182319388f, 0.902936935f},
-std::array<float,2>{0.341004819f, 0.395537734f},
-std::array<float,2>{0.553766429f, 0.729297161f},
-std::array<float,2>{0.674698889f, 0.320255935f},
-std::array<float,2>{0.473287046f, 0.584823251f},
-std::array<float,2>{0.0304314289f, 0.214213714f},
-std::array<float,2>{0.961740494f, 0.805493116f},
-std::array<float,2>{0.913963974f, 0.47759223f},
-std::array<float,2>{0.108697169f, 0.644768238f},
-std::array<float,2>{0.435242087f, 0.0552132353f},
-std::array<float,2>{0.715557218f, 0.973535717f},
-std::array<float,2>{0.569302857f, 0.166937426f},
-std::array<float,2>{0.300887108f, 0.855326951f},
-std::array<float,2>{0.190215245f, 0.276026249f},
-std::array<float,2>{0.829974473f, 0.542329133f},
-std::array<float,2>{0.982044578f, 0.237575829f},
-std::array<float,2>{0.0358683802f, 0.756606996f},
-std::array<float,2>{0.444683492f, 0.367406011f},
-std::array<float,2>{0.651421666f, 0.597098649f},
-std::array<float,2>{0.524804831f, 0.432380587f},
-std::array<float,2>{0.368847281f, 0.692983687f},
-std::array<float,2>{0.133324087f, 0.116684265f},
-std::array<float,2>{0.807243705f, 0.91802609f},
-std::array<float,2>{0.859310448f, 0.299802363f},
-std::array<float,2>{0.223902673f, 0.517206848f},
-std::array<float,2>{0.256016701f, 0.148475766f},
-std::array<float,2>{0.595719039f, 0.816954672f},
-std::array<float,2>{0.727019608f, 0.0165301114f},
-std::array<float,2>{0.404148906f, 0.944933653f},
-std::array<float,2>{0.0877463818f, 0.467271626f},
-std::array<float,2>{0.89648658f, 0.67245096f},
-std::array<float,2>{0.95618391f, 0.121720858f},
-std::array<float,2>{0.0224805567f, 0.906269491f},
-std::array<float,2>{0.483148694f, 0.429516047f},
-std::array<float,2>{0.682415724f, 0.695707679f},
-std::array<float,2>{0.558123708f, 0.365160853f},
-std::array<float,2>{0.329041153f, 0.603871882f},
-std::array<float,2>{0.174028605f, 0.247188225f},
-std::array<float,2>{0.752835691f, 0.762769461f},
-std::array<float,2>{0.837396979f, 0.456177562f},
-std::array<float,2>{0.201319322f, 0.68134141f},
-std::array<float,2>{0.309307575f, 0.0281344745f},
-std::array<float,2>{0.575136185f, 0.949607551f},
-std::array<float,2>{0.708736241f, 0.148201615f},
-std::array<float,2>{0.427753448f, 0.82621789f},
-std::array<float,2>{0.0943592936f, 0.306604087f},
-std::array<float,2>{0.921777606f, 0.527277827f},
-std::array<float,2>{0.797691107f, 0.206279024f},
-std::array<float,2>{0.127768144f, 0.800733924f},
-std::array<float,2>{0.359528512f, 0.32765767f},
-std::array<float,2>{0.517099082f, 0.587228119f},
-std::array<float,2>{0.646756351f, 0.401512116f},
-std::array<float,2>{0.4530904f, 0.723342955f},
-std::array<float,2>{0.0452231392f, 0.0877551362f},
-std::array<float,2>{0.969233394f, 0.896505117f},
-std::array<float,2>{0.905342519f, 0.271460742f},
-std::array<float,2>{0.0853767619f, 0.537350953f},
-std::array<float,2>{0.39734599f, 0.163060725f},
-std::array<float,2>{0.725096881f, 0.844332159f},
-std::array<float,2>{0.603758454f, 0.0502774008f},
-std::array<float,2>{0.258010954f, 0.978764117f},
-std::array<float,2>{0.230149671f, 0.47062555f},
-std::array<float,2>{0.849473774f, 0.654016316f},
-std::array<float,2>{0.863163769f, 0.00221903319f},
-std::array<float,2>{0.23634249f, 0.963962734f},
-std::array<float,2>{0.270983756f, 0.444720656f},
-std::array<float,2>{0.614997268f, 0.660123408f},
-std::array<float,2>{0.748566806f, 0.293062508f},
-std::array<float,2>{0.38006869f, 0.505048275f},
-std::array<float,2>{0.0717474967f, 0.137409776f},
-std::array<float,2>{0.886012852f, 0.829774857f},
-std::array<float,2>{0.98660022f, 0.408829749f},
-std::array<float,2>{0.0562218502f, 0.708251297f},
-std::array<float,2>{0.453870505f, 0.106783874f},
-std::array<float,2>{0.638965368f, 0.923120677f},
-std::array<float,2>{0.502232373f, 0.222643822f},
-std::array<float,2>{0.350160748f, 0.776814044f},
-std::array<float,2>{0.148457244f, 0.3441872f},
-std::array<float,2>{0.788315415f, 0.616693497f},
-std::array<float,2>{0.931605697f, 0.184399679f},
-std::array<float,2>{0.114342824f, 0.870463192f},
-std::array<float,2>{0.417997688f, 0.253691643f},
-std::array<float,2>{0.70019567f, 0.56005466f},
-std::array<float,2>{0.58321017f, 0.492571563f},
-std::array<float,2>{0.291952044f, 0.631301939f},
-std::array<float,2>{0.209124044f, 0.0413429029f},
-std::array<float,2>{0.824179828f, 0.984510839f},
-std::array<float,2>{0.779662848f, 0.333200514f},
-std::array<float,2>{0.158784121f, 0.577394783f},
-std::array<float,2>{0.317151278f, 0.18958801f},
-std::array<float,2>{0.533785224f, 0.790784597f},
-std::array<float,2>{0.66582793f, 0.072624892f},
-std::array<float,2>{0.491194069f, 0.878842533f},
-std::array<float,2>{0.0106835086f, 0.38506496f},
-std::array<float,2>{0.943044007f, 0.740837634f},
-std::array<float,2>{0.892642975f, 0.076956138f},
-std::array<float,2>{0.0901269466f, 0.879338145f},
-std::array<float,2>{0.399711728f, 0.386788666f},
-std::array<float,2>{0.731979072f, 0.735957503f},
-std::array<float,2>{0.599450946f, 0.33179909f},
-std::array<float,2>{0.250609517f, 0.573307753f},
-std::array<float,2>{0.220412672f, 0.194724172f},
-std::array<float,2>{0.851630628f, 0.796618104f},
-std::array<float,2>{0.811152339f, 0.496319681f},
-std::array<float,2>{0.138228074f, 0.627076924f},
-std::array<float,2>{0.372181743f, 0.0441390537f},
-std::array<float,2>{0.527426302f, 0.991999984f},
-std::array<float,2>{0.654282749f, 0.179900065f},
-std::array<float,2>{0.439381391f, 0.873657048f},
-std::array<float,2>{0.0315047354f, 0.254011124f},
-std::array<float,2>{0.979491591f, 0.556337535f},
-std::array<float,2>{0.835654438f, 0.223913819f},
-std::array<float,2>{0.194241732f, 0.781100333f},
-std::array<float,2>{0.297684133f, 0.350093156f},
-std::array<float,2>{0.56295228f, 0.610358536f},
-std::array<float,2>{0.712534249f, 0.410674423f},
-std::array<float,2>{0.4320274f, 0.706742644f},
-std::array<float,2>{0.102355354f, 0.10207814f},
-std::array<float,2>{0.90715009f, 0.927819908f},
-std::array<float,2>{0.96769464f, 0.28929469f},
-std::array<float,2>{0.0271669813f, 0.502713501f},
-std::array<float,2>{0.47228387f, 0.135437429f},
-std::array<float,2>{0.679260254f, 0.833986878f},
-std::array<float,2>{0.548282325f, 0.00669951458f},
-std::array<float,2>{0.336522371f, 0.968299389f},
-std::array<float,2>{0.1839834f, 0.440861762f},
-std::array<float,2>{0.763072431f, 0.660979927f},
-std::array<float,2>{0.772187173f, 0.0513003133f},
-std::array<float,2>{0.169517368f, 0.982273877f},
-std::array<float,2>{0.325213939f, 0.474792749f},
-std::array<float,2>{0.540701926f, 0.650552571f},
-std::array<float,2>{0.661234736f, 0.267108083f},
-std::array<float,2>{0.494055718f, 0.531852603f},
-std::array<float,2>{0.00391856441f, 0.156616583f},
-std::array<float,2>{0.950947225f, 0.849289775f},
-std::array<float,2>{0.926800191f, 0.404339403f},
-std::array<float,2>{0.119348146f, 0.71969527f},
-std::array<float,2>{0.406769902f, 0.0902964994f},
-std::array<float,2>{0.6877864f, 0.890881777f},
-std::array<float,2>{0.590345562f, 0.207223207f},
-std::array<float,2>{0.285387337f, 0.801217437f},
-std::array<float,2>{0.21674712f, 0.321124315f},
-std::array<float,2>{0.819724202f, 0.592804432f},
-std::array<float,2>{0.997263372f, 0.1414693f},
-std::array<float,2>{0.0504951403f, 0.822579026f},
-std::array<float,2>{0.465555161f, 0.311674029f},
-std::array<float,2>{0.628795564f, 0.530573428f},
-std::array<float,2>{0.51197201f, 0.460134238f},
-std::array<float,2>{0.358501077f, 0.687421083f},
-std::array<float,2>{0.141937077f, 0.0272417832f},
-std::array<float,2>{0.793020725f, 0.948528111f},
-std::array<float,2>{0.874439418f, 0.360685438f},
-std::array<float,2>{0.242255136f, 0.607726693f},
-std::array<float,2>{0.277552873f, 0.243368417f},
-std::array<float,2>{0.623930097f, 0.759330928f},
-std::array<float,2>{0.734707952f, 0.118525095f},
-std::array<float,2>{0.385480404f, 0.911503315f},
-std::array<float,2>{0.0628023595f, 0.425231338f},
-std::array<float,2>{0.875684917f, 0.701019645f},
-std::array<float,2>{0.938864231f, 0.0210849307f},
-std::array<float,2>{0.014030274f, 0.941316724f},
-std::array<float,2>{0.488251805f, 0.462047726f},
-std::array<float,2>{0.670445502f, 0.677325368f},
-std::array<float,2>{0.537182689f, 0.302309275f},
-std::array<float,2>{0.314424932f, 0.520656228f},
-std::array<float,2>{0.16218318f, 0.15252158f},
-std::array<float,2>{0.776957989f, 0.816153467f},
-std::array<float,2>{0.825294495f, 0.434466213f},
-std::array<float,2>{0.205791429f, 0.689064622f},
-std::array<float,2>{0.294519514f, 0.110942185f},
-std::array<float,2>{0.580723763f, 0.917554736f},
-std::array<float,2>{0.696532249f, 0.239706725f},
-std::array<float,2>{0.416266501f, 0.753434658f},
-std::array<float,2>{0.110949837f, 0.374069393f},
-std::array<float,2>{0.934407592f, 0.601506829f},
-std::array<float,2>{0.782093644f, 0.169503182f},
-std::array<float,2>{0.154346794f, 0.857378662f},
-std::array<float,2>{0.344683379f, 0.278295249f},
-std::array<float,2>{0.50526464f, 0.543765664f},
-std::array<float,2>{0.633687675f, 0.483074218f},
-std::array<float,2>{0.458351374f, 0.643156171f},
-std::array<float,2>{0.0596023574f, 0.0599233583f},
-std::array<float,2>{0.989824474f, 0.972638309f},
-std::array<float,2>{0.887960076f, 0.314112544f},
-std::array<float,2>{0.074992843f, 0.580808997f},
-std::array<float,2>{0.375629872f, 0.215087831f},
-std::array<float,2>{0.742741227f, 0.812368751f},
-std::array<float,2>{0.611022592f, 0.0790661424f},
-std::array<float,2>{0.266491264f, 0.901916683f},
-std::array<float,2>{0.240533441f, 0.393508762f},
-std::array<float,2>{0.86579597f, 0.732429683f},
-std::array<float,2>{0.845705569f, 0.0970374793f},
-std::array<float,2>{0.232187629f, 0.931624055f},
-std::array<float,2>{0.264499843f, 0.421796948f},
-std::array<float,2>{0.608960688f, 0.71470964f},
-std::array<float,2>{0.720438361f, 0.357324958f},
-std::array<float,2>{0.391110688f, 0.620188236f},
-std::array<float,2>{0.0807634965f, 0.232995063f},
-std::array<float,2>{0.899223387f, 0.768399119f},
-std::array<float,2>{0.974975944f, 0.452172071f},
-std::array<float,2>{0.0400221497f, 0.668384016f},
-std::array<float,2>{0.445777178f, 0.0107433582f},
-std::array<float,2>{0.640804887f, 0.957856953f},
-std::array<float,2>{0.522387981f, 0.129837885f},
-std::array<float,2>{0.366309226f, 0.837412715f},
-std::array<float,2>{0.129009068f, 0.28574279f},
-std::array<float,2>{0.804557443f, 0.509435952f},
-std::array<float,2>{0.91776222f, 0.199932814f},
-std::array<float,2>{0.100688361f, 0.782968938f},
-std::array<float,2>{0.422758579f, 0.336644292f},
-std::array<float,2>{0.705925465f, 0.565361917f},
-std::array<float,2>{0.571938455f, 0.375029534f},
-std::array<float,2>{0.307735831f, 0.749628663f},
-std::array<float,2>{0.196678311f, 0.0644947514f},
-std::array<float,2>{0.84035337f, 0.885760188f},
-std::array<float,2>{0.757300198f, 0.260230958f},
-std::array<float,2>{0.177037537f, 0.553240955f},
-std::array<float,2>{0.335419625f, 0.177192107f},
-std::array<float,2>{0.561717749f, 0.866512477f},
-std::array<float,2>{0.685269415f, 0.0376620255f},
-std::array<float,2>{0.477984726f, 0.996918797f},
-std::array<float,2>{0.0190836359f, 0.484799325f},
-std::array<float,2>{0.96042794f, 0.639560342f},
-std::array<float,2>{0.932349503f, 0.0418588668f},
-std::array<float,2>{0.115443654f, 0.985118508f},
-std::array<float,2>{0.421068311f, 0.492902696f},
-std::array<float,2>{0.702279866f, 0.631724656f},
-std::array<float,2>{0.585802078f, 0.253175199f},
-std::array<float,2>{0.289836526f, 0.560458422f},
-std::array<float,2>{0.207078308f, 0.183834851f},
-std::array<float,2>{0.821834981f, 0.870686114f},
-std::array<float,2>{0.779110551f, 0.385420591f},
-std::array<float,2>{0.15778397f, 0.740661502f},
-std::array<float,2>{0.319182575f, 0.0730317831f},
-std::array<float,2>{0.531362593f, 0.87806648f},
-std::array<float,2>{0.666327417f, 0.190168917f},
-std::array<float,2>{0.489390314f, 0.79019779f},
-std::array<float,2>{0.00799424667f, 0.333860785f},
-std::array<float,2>{0.945222914f, 0.578124285f},
-std::array<float,2>{0.860755146f, 0.137150019f},
-std::array<float,2>{0.236172229f, 0.829400897f},
-std::array<float,2>{0.272229224f, 0.29371807f},
-std::array<float,2>{0.615312934f, 0.505456984f},
-std::array<float,2>{0.746316195f, 0.445183307f},
-std::array<float,2>{0.381829888f, 0.659357667f},
-std::array<float,2>{0.0730129406f, 0.00247969432f},
-std::array<float,2>{0.883222282f, 0.964405f},
-std::array<float,2>{0.985599816f, 0.344633728f},
-std::array<float,2>{0.0579252951f, 0.616838753f},
-std::array<float,2>{0.457009286f, 0.222078308f},
-std::array<float,2>{0.63764751f, 0.776995838f},
-std::array<float,2>{0.50129658f, 0.107393004f},
-std::array<float,2>{0.348010302f, 0.923609614f},
-std::array<float,2>{0.150411919f, 0.408276141f},
-std::array<float,2>{0.785610855f, 0.708868086f},
-std::array<float,2>{0.80061084f, 0.0871308446f},
-std::array<float,2>{0.125438273f, 0.897157073f},
-std::array<float,2>{0.363249391f, 0.402111501f},
-std::array<float,2>{0.517783761f, 0.723015428f},
-std::array<float,2>{0.645507932f, 0.327616751f},
-std::array<float,2>{0.451039344f, 0.5877527f},
-std::array<float,2>{0.0439485796f, 0.206585705f},
-std::array<float,2>{0.971646488f, 0.799865961f},
-std::array<float,2>{0.902435839f, 0.470087886f},
-std::array<float,2>{0.0832197368f, 0.653383076f},
-std::array<float,2>{0.394540668f, 0.0503784567f},
-std::array<float,2>{0.722748458f, 0.979337275f},
-std::array<float,2>{0.602567375f, 0.162202686f},
-std::array<float,2>{0.261709154f, 0.844153762f},
-std::array<float,2>{0.22666204f, 0.270690203f},
-std::array<float,2>{0.85077703f, 0.537982821f},
-std::array<float,2>{0.953291953f, 0.247990891f},
-std::array<float,2>{0.0196512174f, 0.76335454f},
-std::array<float,2>{0.481588721f, 0.364412814f},
-std::array<float,2>{0.680736899f, 0.604399443f},
-std::array<float,2>{0.554857731f, 0.428714246f},
-std::array<float,2>{0.331584781f, 0.696086705f},
-std::array<float,2>{0.172938883f, 0.1214692f},
-std::array<float,2>{0.750714064f, 0.907130182f},
-std::array<float,2>{0.838139176f, 0.305711448f},
-std::array<float,2>{0.200141311f, 0.526735127f},
-std::array<float,2>{0.310634583f, 0.14750272f},
-std::array<float,2>{0.57802856f, 0.826870382f},
-std::array<float,2>{0.709675491f, 0.02749989f},
-std::array<float,2>{0.426732689f, 0.949752033f},
-std::array<float,2>{0.0958972499f, 0.456807464f},
-std::array<float,2>{0.918580174f, 0.681070447f},
-std::array<float,2>{0.984121799f, 0.116856582f},
-std::array<float,2>{0.0376000181f, 0.918743372f},
-std::array<float,2>{0.442859024f, 0.431943834f},
-std::array<float,2>{0.650072396f, 0.692637026f},
-std::array<float,2>{0.526482284f, 0.368062824f},
-std::array<float,2>{0.369705915f, 0.597394526f},
-std::array<float,2>{0.135829687f, 0.238042802f},
-std::array<float,2>{0.805521548f, 0.755897582f},
-std::array<float,2>{0.85562557f, 0.467351645f},
-std::array<float,2>{0.224698365f, 0.672167122f},
-std::array<float,2>{0.253999114f, 0.0160686504f},
-std::array<float,2>{0.594868898f, 0.944717407f},
-std::array<float,2>{0.729451776f, 0.149240837f},
-std::array<float,2>{0.404991686f, 0.816594899f},
-std::array<float,2>{0.0879291743f, 0.298889756f},
-std::array<float,2>{0.895810425f, 0.516778111f},
-std::array<float,2>{0.758681953f, 0.214670211f},
-std::array<float,2>{0.180925936f, 0.80469048f},
-std::array<float,2>{0.343101948f, 0.319616467f},
-std::array<float,2>{0.552139878f, 0.584185541f},
-std::array<float,2>{0.673300803f, 0.396475136f},
-std::array<float,2>{0.476116061f, 0.728516459f},
-std::array<float,2>{0.0287382994f, 0.0840475485f},
-std::array<float,2>{0.964385986f, 0.902755439f},
-std::array<float,2>{0.910303652f, 0.275562763f},
-std::array<float,2>{0.106194966f, 0.542854726f},
-std::array<float,2>{0.436075062f, 0.166354626f},
-std::array<float,2>{0.717537761f, 0.854721367f},
-std::array<float,2>{0.566651225f, 0.0551271997f},
-std::array<float,2>{0.303928167f, 0.973098755f},
-std::array<float,2>{0.188787624f, 0.478079319f},
-std::array<float,2>{0.831353605f, 0.645405233f},
-std::array<float,2>{0.813764334f, 0.014855871f},
-std::array<float,2>{0.212192833f, 0.953894913f},
-std::array<float,2>{0.282768995f, 0.448047251f},
-std::array<float,2>{0.586984754f, 0.666782141f},
-std::array<float,2>{0.693154216f, 0.283597082f},
-std::array<float,2>{0.41213721f, 0.515226841f},
-std::array<float,2>{0.12482129f, 0.127766505f},
-std::array<float,2>{0.923967123f, 0.840506196f},
-std::array<float,2>{0.945995331f, 0.417092323f},
-std::array<float,2>{0.00269561657f, 0.717533052f},
-std::array<float,2>{0.498343647f, 0.101319686f},
-std::array<float,2>{0.658628941f, 0.934467196f},
-std::array<float,2>{0.545199811f, 0.229240388f},
-std::array<float,2>{0.320339441f, 0.773320258f},
-std::array<float,2>{0.165079564f, 0.353879541f},
-std::array<float,2>{0.76701355f, 0.624501884f},
-std::array<float,2>{0.882031262f, 0.175515324f},
-std::array<float,2>{0.0669759884f, 0.859409451f},
-std::array<float,2>{0.388900399f, 0.264220953f},
-std::array<float,2>{0.740127206f, 0.549551368f},
-std::array<float,2>{0.621000648f, 0.489779204f},
-std::array<float,2>{0.273479789f, 0.63354212f},
-std::array<float,2>{0.24761577f, 0.0321974121f},
-std::array<float,2>{0.870033801f, 0.993629754f},
-std::array<float,2>{0.790741682f, 0.343355238f},
-std::array<float,2>{0.145223826f, 0.568343163f},
-std::array<float,2>{0.353603214f, 0.195813552f},
-std::array<float,2>{0.510132849f, 0.786222696f},
-std::array<float,2>{0.63222158f, 0.0674467608f},
-std::array<float,2>{0.463407815f, 0.887944996f},
-std::array<float,2>{0.0510706156f, 0.381975323f},
-std::array<float,2>{0.99589026f, 0.743757665f},
-std::array<float,2>{0.908268273f, 0.104624175f},
-std::array<float,2>{0.105365634f, 0.927698255f},
-std::array<float,2>{0.43010509f, 0.413325012f},
-std::array<float,2>{0.713729858f, 0.704324901f},
-std::array<float,2>{0.564937651f, 0.348233491f},
-std::array<float,2>{0.299614102f, 0.612729847f},
-std::array<float,2>{0.191520751f, 0.226383626f},
-std::array<float,2>{0.832792461f, 0.778939903f},
-std::array<float,2>{0.764195442f, 0.438065439f},
-std::array<float,2>{0.187000573f, 0.662659705f},
-std::array<float,2>{0.338436037f, 0.00408434449f},
-std::array<float,2>{0.550222456f, 0.965746224f},
-std::array<float,2>{0.676581562f, 0.134294108f},
-std::array<float,2>{0.469110578f, 0.833554745f},
-std::array<float,2>{0.0249438975f, 0.291628629f},
-std::array<float,2>{0.966238379f, 0.500222445f},
-std::array<float,2>{0.855174243f, 0.192791432f},
-std::array<float,2>{0.221970156f, 0.794851661f},
-std::array<float,2>{0.25205487f, 0.32909891f},
-std::array<float,2>{0.6014781f, 0.571590304f},
-std::array<float,2>{0.733873606f, 0.389730424f},
-std::array<float,2>{0.400775999f, 0.736826301f},
-std::array<float,2>{0.0921956673f, 0.0750822127f},
-std::array<float,2>{0.891602099f, 0.882219791f},
-std::array<float,2>{0.977034271f, 0.256688237f},
-std::array<float,2>{0.0343318619f, 0.556783259f},
-std::array<float,2>{0.441332936f, 0.182915732f},
-std::array<float,2>{0.65623033f, 0.872623742f},
-std::array<float,2>{0.530156493f, 0.0454329327f},
-std::array<float,2>{0.373530149f, 0.98971194f},
-std::array<float,2>{0.138914734f, 0.499689937f},
-std::array<float,2>{0.810237765f, 0.626822531f},
-std::array<float,2>{0.795391023f, 0.0236604307f},
-std::array<float,2>{0.143163383f, 0.945680797f},
-std::array<float,2>{0.357251525f, 0.458543003f},
-std::array<float,2>{0.514522433f, 0.684285581f},
-std::array<float,2>{0.625550926f, 0.310487449f},
-std::array<float,2>{0.468468457f, 0.528469026f},
-std::array<float,2>{0.047428105f, 0.143364519f},
-std::array<float,2>{0.998242259f, 0.820436656f},
-std::array<float,2>{0.877039611f, 0.423522443f},
-std::array<float,2>{0.0661984608f, 0.702774048f},
-std::array<float,2>{0.384657741f, 0.119408883f},
-std::array<float,2>{0.737473905f, 0.912580252f},
-std::array<float,2>{0.621311605f, 0.245017648f},
-std::array<float,2>{0.279919863f, 0.760634959f},
-std::array<float,2>{0.245929316f, 0.362728566f},
-std::array<float,2>{0.871261239f, 0.60650456f},
-std::array<float,2>{0.95169735f, 0.158432931f},
-std::array<float,2>{0.00688975817f, 0.850624979f},
-std::array<float,2>{0.495132327f, 0.26882568f},
-std::array<float,2>{0.663569748f, 0.534758389f},
-std::array<float,2>{0.541019022f, 0.474271059f},
-std::array<float,2>{0.326835394f, 0.650016844f},
-std::array<float,2>{0.171505153f, 0.0542720109f},
-std::array<float,2>{0.770236373f, 0.983573854f},
-std::array<float,2>{0.816566348f, 0.323472619f},
-std::array<float,2>{0.217438698f, 0.591102064f},
-std::array<float,2>{0.288250357f, 0.21053201f},
-std::array<float,2>{0.592347205f, 0.803653002f},
-std::array<float,2>{0.690321922f, 0.0935389474f},
-std::array<float,2>{0.409891337f, 0.893069685f},
-std::array<float,2>{0.119059972f, 0.403964043f},
-std::array<float,2>{0.928276122f, 0.721285641f},
-std::array<float,2>{0.991553545f, 0.0613968484f},
-std::array<float,2>{0.0624391884f, 0.970474899f},
-std::array<float,2>{0.459005326f, 0.480605185f},
-std::array<float,2>{0.635170937f, 0.642438889f},
-std::array<float,2>{0.50654912f, 0.28038457f},
-std::array<float,2>{0.34750697f, 0.546457469f},
-std::array<float,2>{0.153015748f, 0.170353383f},
-std::array<float,2>{0.784230471f, 0.857602715f},
-std::array<float,2>{0.863676131f, 0.391633779f},
-std::array<float,2>{0.238734141f, 0.730913043f},
-std::array<float,2>{0.268629521f, 0.0817851946f},
-std::array<float,2>{0.613070607f, 0.899677932f},
-std::array<float,2>{0.744293213f, 0.218042135f},
-std::array<float,2>{0.377124101f, 0.809885383f},
-std::array<float,2>{0.0776455253f, 0.315738618f},
-std::array<float,2>{0.890139282f, 0.578936577f},
-std::array<float,2>{0.774030268f, 0.154581651f},
-std::array<float,2>{0.161060616f, 0.813092351f},
-std::array<float,2>{0.315039009f, 0.304227918f},
-std::array<float,2>{0.536205351f, 0.5214867f},
-std::array<float,2>{0.669707835f, 0.464603037f},
-std::array<float,2>{0.485296935f, 0.678611755f},
-std::array<float,2>{0.0123387119f, 0.0221059751f},
-std::array<float,2>{0.940374792f, 0.937902331f},
-std::array<float,2>{0.935788691f, 0.372042209f},
-std::array<float,2>{0.112020575f, 0.598586917f},
-std::array<float,2>{0.414237887f, 0.240502939f},
-std::array<float,2>{0.698677361f, 0.750805795f},
-std::array<float,2>{0.578872979f, 0.111359306f},
-std::array<float,2>{0.296347648f, 0.916001856f},
-std::array<float,2>{0.204570249f, 0.436677456f},
-std::array<float,2>{0.826319754f, 0.690488875f},
-std::array<float,2>{0.842367887f, 0.0625099465f},
-std::array<float,2>{0.198472023f, 0.883749545f},
-std::array<float,2>{0.304761142f, 0.377358943f},
-std::array<float,2>{0.572497964f, 0.747511148f},
-std::array<float,2>{0.704047501f, 0.339769363f},
-std::array<float,2>{0.42453742f, 0.56335932f},
-std::array<float,2>{0.0987804607f, 0.203060359f},
-std::array<float,2>{0.914307415f, 0.78495121f},
-std::array<float,2>{0.958307981f, 0.486377239f},
-std::array<float,2>{0.015780801f, 0.63814801f},
-std::array<float,2>{0.479774475f, 0.0367942043f},
-std::array<float,2>{0.685815573f, 0.998271286f},
-std::array<float,2>{0.559252262f, 0.178966835f},
-std::array<float,2>{0.332151204f, 0.864970565f},
-std::array<float,2>{0.178316772f, 0.25857684f},
-std::array<float,2>{0.755293548f, 0.551283658f},
-std::array<float,2>{0.900659502f, 0.231797859f},
-std::array<float,2>{0.0796203092f, 0.765850604f},
-std::array<float,2>{0.39333123f, 0.358630747f},
-std::array<float,2>{0.72263366f, 0.618270457f},
-std::array<float,2>{0.606940806f, 0.418852359f},
-std::array<float,2>{0.26232338f, 0.711519539f},
-std::array<float,2>{0.234204099f, 0.0956339389f},
-std::array<float,2>{0.845475256f, 0.931951344f},
-std::array<float,2>{0.801731169f, 0.2878111f},
-std::array<float,2>{0.132552177f, 0.510856628f},
-std::array<float,2>{0.364200115f, 0.131540224f},
-std::array<float,2>{0.519892395f, 0.838846207f},
-std::array<float,2>{0.644015074f, 0.00812599063f},
-std::array<float,2>{0.447434336f, 0.959599197f},
-std::array<float,2>{0.0427931994f, 0.449858278f},
-std::array<float,2>{0.97383368f, 0.67124474f},
-std::array<float,2>{0.886410952f, 0.000620766019f},
-std::array<float,2>{0.0722193047f, 0.962710738f},
-std::array<float,2>{0.380475849f, 0.442609638f},
-std::array<float,2>{0.748165488f, 0.657936275f},
-std::array<float,2>{0.614659488f, 0.295441478f},
-std::array<float,2>{0.271217138f, 0.50642556f},
-std::array<float,2>{0.236970544f, 0.139395401f},
-std::array<float,2>{0.862728238f, 0.830110788f},
-std::array<float,2>{0.788981915f, 0.407936245f},
-std::array<float,2>{0.148974627f, 0.709655166f},
-std::array<float,2>{0.349684656f, 0.108056404f},
-std::array<float,2>{0.502524495f, 0.924204648f},
-std::array<float,2>{0.639175475f, 0.219660208f},
-std::array<float,2>{0.453210205f, 0.773629069f},
-std::array<float,2>{0.0560587533f, 0.347126693f},
-std::array<float,2>{0.987176657f, 0.613667011f},
-std::array<float,2>{0.823373318f, 0.187266603f},
-std::array<float,2>{0.209588736f, 0.868904769f},
-std::array<float,2>{0.291368157f, 0.250841945f},
-std::array<float,2>{0.583981216f, 0.560991347f},
-std::array<float,2>{0.700755f, 0.494540632f},
-std::array<float,2>{0.418548584f, 0.629574418f},
-std::array<float,2>{0.11490982f, 0.0402534194f},
-std::array<float,2>{0.930756569f, 0.988251626f},
-std::array<float,2>{0.942552447f, 0.334333599f},
-std::array<float,2>{0.0100240875f, 0.574596941f},
-std::array<float,2>{0.490641415f, 0.188800082f},
-std::array<float,2>{0.665234745f, 0.792395115f},
-std::array<float,2>{0.533531725f, 0.0713190809f},
-std::array<float,2>{0.316749454f, 0.876816511f},
-std::array<float,2>{0.158406436f, 0.384643644f},
-std::array<float,2>{0.780129075f, 0.738993287f},
-std::array<float,2>{0.752149999f, 0.123662964f},
-std::array<float,2>{0.174423218f, 0.908763528f},
-std::array<float,2>{0.328262985f, 0.426087081f},
-std::array<float,2>{0.557850182f, 0.697333097f},
-std::array<float,2>{0.681740403f, 0.366608769f},
-std::array<float,2>{0.482680857f, 0.603433907f},
-std::array<float,2>{0.0233254414f, 0.248911083f},
-std::array<float,2>{0.956631005f, 0.764875054f},
-std::array<float,2>{0.921190858f, 0.453449398f},
-std::array<float,2>{0.0940626115f, 0.683211684f},
-std::array<float,2>{0.428285122f, 0.030558249f},
-std::array<float,2>{0.708219051f, 0.952179492f},
-std::array<float,2>{0.57436806f, 0.145451918f},
-std::array<float,2>{0.308617681f, 0.824292243f},
-std::array<float,2>{0.201700881f, 0.306884676f},
-std::array<float,2>{0.837619066f, 0.523848355f},
-std::array<float,2>{0.969581068f, 0.204585314f},
-std::array<float,2>{0.0457278155f, 0.797381759f},
-std::array<float,2>{0.452475369f, 0.324390501f},
-std::array<float,2>{0.647427857f, 0.589131474f},
-std::array<float,2>{0.516947865f, 0.39927572f},
-std::array<float,2>{0.359938234f, 0.724943042f},
-std::array<float,2>{0.127109349f, 0.0895352364f},
-std::array<float,2>{0.797353566f, 0.895489156f},
-std::array<float,2>{0.848799229f, 0.272541165f},
-std::array<float,2>{0.22994642f, 0.535522759f},
-std::array<float,2>{0.258377105f, 0.16171518f},
-std::array<float,2>{0.604318321f, 0.846632361f},
-std::array<float,2>{0.725234568f, 0.0473784357f},
-std::array<float,2>{0.396869212f, 0.977199197f},
-std::array<float,2>{0.0857538283f, 0.470833868f},
-std::array<float,2>{0.90605408f, 0.654336572f},
-std::array<float,2>{0.961187184f, 0.0839382261f},
-std::array<float,2>{0.0309844278f, 0.905259013f},
-std::array<float,2>{0.473013937f, 0.397730678f},
-std::array<float,2>{0.67430228f, 0.727983236f},
-std::array<float,2>{0.5542925f, 0.317732364f},
-std::array<float,2>{0.34139213f, 0.583479226f},
-std::array<float,2>{0.181874454f, 0.21158953f},
-std::array<float,2>{0.760095537f, 0.807002664f},
-std::array<float,2>{0.829516113f, 0.480242729f},
-std::array<float,2>{0.189745948f, 0.64727056f},
-std::array<float,2>{0.301588535f, 0.0580913648f},
-std::array<float,2>{0.568801343f, 0.976506352f},
-std::array<float,2>{0.715166509f, 0.164320722f},
-std::array<float,2>{0.434944957f, 0.852487803f},
-std::array<float,2>{0.108944394f, 0.274419427f},
-std::array<float,2>{0.913390219f, 0.539452016f},
-std::array<float,2>{0.806778312f, 0.235169962f},
-std::array<float,2>{0.133160383f, 0.755111277f},
-std::array<float,2>{0.368165284f, 0.371081591f},
-std::array<float,2>{0.524952352f, 0.595298886f},
-std::array<float,2>{0.652003884f, 0.430731863f},
-std::array<float,2>{0.445246845f, 0.693754435f},
-std::array<float,2>{0.0352702104f, 0.113611788f},
-std::array<float,2>{0.98176676f, 0.920222402f},
-std::array<float,2>{0.89724797f, 0.297196895f},
-std::array<float,2>{0.0870719999f, 0.519442916f},
-std::array<float,2>{0.403543562f, 0.15145123f},
-std::array<float,2>{0.727223217f, 0.820175648f},
-std::array<float,2>{0.596248448f, 0.0177417118f},
-std::array<float,2>{0.256781578f, 0.942221463f},
-std::array<float,2>{0.224533066f, 0.466772765f},
-std::array<float,2>{0.858584464f, 0.674508929f},
-std::array<float,2>{0.868773758f, 0.033988867f},
-std::array<float,2>{0.248419061f, 0.995762944f},
-std::array<float,2>{0.277112752f, 0.491010785f},
-std::array<float,2>{0.617459536f, 0.635582864f},
-std::array<float,2>{0.741587758f, 0.261924446f},
-std::array<float,2>{0.387436211f, 0.548726022f},
-std::array<float,2>{0.0692926347f, 0.173137158f},
-std::array<float,2>{0.880745053f, 0.862662733f},
-std::array<float,2>{0.992689431f, 0.380069107f},
-std::array<float,2>{0.0533101112f, 0.745660663f},
-std::array<float,2>{0.462319344f, 0.0695524365f},
-std::array<float,2>{0.630820334f, 0.889417768f},
-std::array<float,2>{0.508358121f, 0.198304176f},
-std::array<float,2>{0.352636337f, 0.788849592f},
-std::array<float,2>{0.146645084f, 0.341564208f},
-std::array<float,2>{0.792565644f, 0.568416059f},
-std::array<float,2>{0.922089875f, 0.125780314f},
-std::array<float,2>{0.121417761f, 0.843605161f},
-std::array<float,2>{0.411340147f, 0.282808393f},
-std::array<float,2>{0.693747997f, 0.512927115f},
-std::array<float,2>{0.588457465f, 0.446874946f},
-std::array<float,2>{0.283437312f, 0.665616274f},
-std::array<float,2>{0.214219898f, 0.0130195441f},
-std::array<float,2>{0.81456244f, 0.955469728f},
-std::array<float,2>{0.767710149f, 0.352302909f},
-std::array<float,2>{0.167565465f, 0.622032583f},
-std::array<float,2>{0.322603911f, 0.227803275f},
-std::array<float,2>{0.544885218f, 0.771316051f},
-std::array<float,2>{0.656355143f, 0.0989599228f},
-std::array<float,2>{0.49733156f, 0.936332345f},
-std::array<float,2>{0.00121194171f, 0.415357351f},
-std::array<float,2>{0.947809458f, 0.716659248f},
-std::array<float,2>{0.876373947f, 0.120702058f},
-std::array<float,2>{0.0638434887f, 0.913592756f},
-std::array<float,2>{0.385956883f, 0.422254831f},
-std::array<float,2>{0.735919714f, 0.701679707f},
-std::array<float,2>{0.62487936f, 0.361635447f},
-std::array<float,2>{0.27865088f, 0.606155992f},
-std::array<float,2>{0.243544504f, 0.245552003f},
-std::array<float,2>{0.873100638f, 0.761019468f},
-std::array<float,2>{0.794477761f, 0.457122177f},
-std::array<float,2>{0.140727878f, 0.684625328f},
-std::array<float,2>{0.358032763f, 0.0247279033f},
-std::array<float,2>{0.513229609f, 0.946397603f},
-std::array<float,2>{0.627411008f, 0.144526362f},
-std::array<float,2>{0.466032237f, 0.821303189f},
-std::array<float,2>{0.0494808443f, 0.309534192f},
-std::array<float,2>{0.99651891f, 0.527836978f},
-std::array<float,2>{0.818466902f, 0.209364295f},
-std::array<float,2>{0.215518072f, 0.804411948f},
-std::array<float,2>{0.286235601f, 0.32316041f},
-std::array<float,2>{0.591456294f, 0.589878678f},
-std::array<float,2>{0.688782096f, 0.403253585f},
-std::array<float,2>{0.407405525f, 0.722149014f},
-std::array<float,2>{0.120778866f, 0.0926811546f},
-std::array<float,2>{0.926231146f, 0.893893123f},
-std::array<float,2>{0.949288964f, 0.267899454f},
-std::array<float,2>{0.00537796598f, 0.534137905f},
-std::array<float,2>{0.492381155f, 0.159379289f},
-std::array<float,2>{0.660302103f, 0.850039899f},
-std::array<float,2>{0.539284527f, 0.0527430475f},
-std::array<float,2>{0.324929267f, 0.982807994f},
-std::array<float,2>{0.16843681f, 0.473148257f},
-std::array<float,2>{0.773073494f, 0.649051785f},
-std::array<float,2>{0.762552857f, 0.00570689002f},
-std::array<float,2>{0.184845775f, 0.966462255f},
-std::array<float,2>{0.337306112f, 0.439300805f},
-std::array<float,2>{0.547819316f, 0.663668573f},
-std::array<float,2>{0.677829146f, 0.292654693f},
-std::array<float,2>{0.470856428f, 0.501336038f},
-std::array<float,2>{0.0257034823f, 0.132827505f},
-std::array<float,2>{0.968242347f, 0.832691312f},
-std::array<float,2>{0.908142865f, 0.412421197f},
-std::array<float,2>{0.103370123f, 0.703297436f},
-std::array<float,2>{0.432692379f, 0.104219161f},
-std::array<float,2>{0.711514771f, 0.926374674f},
-std::array<float,2>{0.563514113f, 0.225257352f},
-std::array<float,2>{0.298488766f, 0.777961493f},
-std::array<float,2>{0.195271328f, 0.349061847f},
-std::array<float,2>{0.834699988f, 0.611423671f},
-std::array<float,2>{0.979986131f, 0.181845903f},
-std::array<float,2>{0.0325151049f, 0.871290445f},
-std::array<float,2>{0.438355774f, 0.257238299f},
-std::array<float,2>{0.652920544f, 0.557686269f},
-std::array<float,2>{0.529090941f, 0.498163253f},
-std::array<float,2>{0.371269733f, 0.625211656f},
-std::array<float,2>{0.136861235f, 0.0464984328f},
-std::array<float,2>{0.812460601f, 0.988555372f},
-std::array<float,2>{0.853305578f, 0.329518467f},
-std::array<float,2>{0.219008803f, 0.570536256f},
-std::array<float,2>{0.251123756f, 0.192243308f},
-std::array<float,2>{0.598356485f, 0.793565273f},
-std::array<float,2>{0.731036186f, 0.07558579f},
-std::array<float,2>{0.399012893f, 0.881350398f},
-std::array<float,2>{0.091318883f, 0.388913184f},
-std::array<float,2>{0.894066632f, 0.737852693f},
-std::array<float,2>{0.959445715f, 0.0355813541f},
-std::array<float,2>{0.0181571096f, 0.999069333f},
-std::array<float,2>{0.476973057f, 0.488000095f},
-std::array<float,2>{0.684105873f, 0.637644649f},
-std::array<float,2>{0.561493039f, 0.259636492f},
-std::array<float,2>{0.334663182f, 0.552371919f},
-std::array<float,2>{0.176384404f, 0.177764878f},
-std::array<float,2>{0.756509125f, 0.863439381f},
-std::array<float,2>{0.841402113f, 0.378829181f},
-std::array<float,2>{0.195770591f, 0.746457994f},
-std::array<float,2>{0.307562351f, 0.0642903596f},
-std::array<float,2>{0.57103312f, 0.884343624f},
-std::array<float,2>{0.706552207f, 0.201599076f},
-std::array<float,2>{0.423656374f, 0.784100056f},
-std::array<float,2>{0.0999870971f, 0.338307947f},
-std::array<float,2>{0.91606313f, 0.563784182f},
-std::array<float,2>{0.803147912f, 0.13279359f},
-std::array<float,2>{0.130291492f, 0.839087129f},
-std::array<float,2>{0.365453333f, 0.288740128f},
-std::array<float,2>{0.523026764f, 0.510250807f},
-std::array<float,2>{0.642037511f, 0.450345248f},
-std::array<float,2>{0.446711749f, 0.66997838f},
-std::array<float,2>{0.0401587225f, 0.00947105326f},
-std::array<float,2>{0.976160288f, 0.960241854f},
-std::array<float,2>{0.900341511f, 0.358119488f},
-std::array<float,2>{0.081239976f, 0.617631793f},
-std::array<float,2>{0.392565638f, 0.230516464f},
-std::array<float,2>{0.719035506f, 0.767415047f},
-std::array<float,2>{0.608009875f, 0.0946191475f},
-std::array<float,2>{0.265481144f, 0.932908952f},
-std::array<float,2>{0.230534613f, 0.419406623f},
-std::array<float,2>{0.847423136f, 0.712358832f},
-std::array<float,2>{0.866315424f, 0.0801763609f},
-std::array<float,2>{0.242041022f, 0.898979068f},
-std::array<float,2>{0.267083645f, 0.391181409f},
-std::array<float,2>{0.609900117f, 0.731541872f},
-std::array<float,2>{0.743339598f, 0.315420747f},
-std::array<float,2>{0.376500666f, 0.579907835f},
-std::array<float,2>{0.0754529834f, 0.217609555f},
-std::array<float,2>{0.886907339f, 0.809216917f},
-std::array<float,2>{0.988439977f, 0.481540501f},
-std::array<float,2>{0.058794193f, 0.641170442f},
-std::array<float,2>{0.45725435f, 0.0620763116f},
-std::array<float,2>{0.634704173f, 0.969311714f},
-std::array<float,2>{0.504093349f, 0.17110911f},
-std::array<float,2>{0.344972312f, 0.85847193f},
-std::array<float,2>{0.155870587f, 0.279351383f},
-std::array<float,2>{0.782771826f, 0.545470357f},
-std::array<float,2>{0.93460089f, 0.241283372f},
-std::array<float,2>{0.109790117f, 0.751158476f},
-std::array<float,2>{0.417369932f, 0.372861922f},
-std::array<float,2>{0.696084917f, 0.598980904f},
-std::array<float,2>{0.581579685f, 0.436000526f},
-std::array<float,2>{0.293586403f, 0.690002382f},
-std::array<float,2>{0.206851587f, 0.113263451f},
-std::array<float,2>{0.825070977f, 0.914282203f},
-std::array<float,2>{0.77571106f, 0.303078741f},
-std::array<float,2>{0.163212195f, 0.523075819f},
-std::array<float,2>{0.312998384f, 0.156077266f},
-std::array<float,2>{0.538285673f, 0.81423384f},
-std::array<float,2>{0.671379268f, 0.0232532863f},
-std::array<float,2>{0.487256199f, 0.938508034f},
-std::array<float,2>{0.0150446696f, 0.463040233f},
-std::array<float,2>{0.937941372f, 0.679240108f},
-std::array<float,2>{0.919668376f, 0.0300134532f},
-std::array<float,2>{0.0976459756f, 0.951860011f},
-std::array<float,2>{0.427617371f, 0.454125494f},
-std::array<float,2>{0.710128665f, 0.681908846f},
-std::array<float,2>{0.57706815f, 0.307806194f},
-std::array<float,2>{0.31211403f, 0.524540782f},
-std::array<float,2>{0.200269699f, 0.145682469f},
-std::array<float,2>{0.838879526f, 0.826132417f},
-std::array<float,2>{0.751024783f, 0.426983982f},
-std::array<float,2>{0.171982691f, 0.699124694f},
-std::array<float,2>{0.330085605f, 0.124654718f},
-std::array<float,2>{0.556066573f, 0.909189641f},
-std::array<float,2>{0.680343509f, 0.24949947f},
-std::array<float,2>{0.481314987f, 0.763973892f},
-std::array<float,2>{0.0211931895f, 0.36601755f},
-std::array<float,2>{0.954591632f, 0.602339745f},
-std::array<float,2>{0.849744081f, 0.160331324f},
-std::array<float,2>{0.228039116f, 0.847262204f},
-std::array<float,2>{0.260044038f, 0.271914631f},
-std::array<float,2>{0.601876616f, 0.536385536f},
-std::array<float,2>{0.723759055f, 0.472546816f},
-std::array<float,2>{0.39645949f, 0.655478835f},
-std::array<float,2>{0.0821812227f, 0.0481175631f},
-std::array<float,2>{0.90402621f, 0.977770329f},
-std::array<float,2>{0.972384453f, 0.326110274f},
-std::array<float,2>{0.0432654023f, 0.588092923f},
-std::array<float,2>{0.45019263f, 0.20338349f},
-std::array<float,2>{0.644845009f, 0.798195362f},
-std::array<float,2>{0.518892527f, 0.088204518f},
-std::array<float,2>{0.362177312f, 0.895663619f},
-std::array<float,2>{0.126708984f, 0.399849802f},
-std::array<float,2>{0.798966348f, 0.725644648f},
-std::array<float,2>{0.78680402f, 0.108890347f},
-std::array<float,2>{0.151388958f, 0.925712764f},
-std::array<float,2>{0.348779231f, 0.406612098f},
-std::array<float,2>{0.500894189f, 0.709999144f},
-std::array<float,2>{0.638048708f, 0.346573263f},
-std::array<float,2>{0.455656826f, 0.614575386f},
-std::array<float,2>{0.057541661f, 0.220003739f},
-std::array<float,2>{0.985115349f, 0.774644732f},
-std::array<float,2>{0.884471476f, 0.441797286f},
-std::array<float,2>{0.0739175901f, 0.656826377f},
-std::array<float,2>{0.382739067f, 0.00104257779f},
-std::array<float,2>{0.747956812f, 0.961531043f},
-std::array<float,2>{0.617141128f, 0.139922008f},
-std::array<float,2>{0.272491843f, 0.831560671f},
-std::array<float,2>{0.235147998f, 0.296377331f},
-std::array<float,2>{0.860167503f, 0.50727731f},
-std::array<float,2>{0.943697095f, 0.187691242f},
-std::array<float,2>{0.00972081907f, 0.791368663f},
-std::array<float,2>{0.488497347f, 0.335270703f},
-std::array<float,2>{0.667635322f, 0.575290143f},
-std::array<float,2>{0.532983184f, 0.382948399f},
-std::array<float,2>{0.319907725f, 0.739634216f},
-std::array<float,2>{0.156694323f, 0.0708610192f},
-std::array<float,2>{0.777664185f, 0.875850081f},
-std::array<float,2>{0.821248412f, 0.251521558f},
-std::array<float,2>{0.208943427f, 0.562248647f},
-std::array<float,2>{0.290554285f, 0.186386302f},
-std::array<float,2>{0.584176064f, 0.867830098f},
-std::array<float,2>{0.701262891f, 0.0399802588f},
-std::array<float,2>{0.420832455f, 0.987157464f},
-std::array<float,2>{0.116570927f, 0.495131701f},
-std::array<float,2>{0.933403909f, 0.630812407f},
-std::array<float,2>{0.994172931f, 0.0691396073f},
-std::array<float,2>{0.0526205152f, 0.890599787f},
-std::array<float,2>{0.464401394f, 0.379048049f},
-std::array<float,2>{0.631170154f, 0.745078444f},
-std::array<float,2>{0.511654258f, 0.340394706f},
-std::array<float,2>{0.355368674f, 0.569598734f},
-std::array<float,2>{0.145655155f, 0.197720498f},
-std::array<float,2>{0.789271295f, 0.787294924f},
-std::array<float,2>{0.870848298f, 0.491925061f},
-std::array<float,2>{0.246788189f, 0.636037052f},
-std::array<float,2>{0.274651527f, 0.0343517028f},
-std::array<float,2>{0.620024025f, 0.994192898f},
-std::array<float,2>{0.738727748f, 0.172573864f},
-std::array<float,2>{0.390565217f, 0.861958027f},
-std::array<float,2>{0.0679031163f, 0.262728244f},
-std::array<float,2>{0.881426692f, 0.546915472f},
-std::array<float,2>{0.765789688f, 0.22708635f},
-std::array<float,2>{0.164550066f, 0.770351648f},
-std::array<float,2>{0.321676105f, 0.353494644f},
-std::array<float,2>{0.546462715f, 0.622343779f},
-std::array<float,2>{0.659895778f, 0.414978504f},
-std::array<float,2>{0.499761999f, 0.715342402f},
-std::array<float,2>{0.00349714374f, 0.0984650776f},
-std::array<float,2>{0.946965277f, 0.936743557f},
-std::array<float,2>{0.925720751f, 0.281528413f},
-std::array<float,2>{0.123230338f, 0.511915267f},
-std::array<float,2>{0.414008588f, 0.126789495f},
-std::array<float,2>{0.692361832f, 0.841958284f},
-std::array<float,2>{0.586215377f, 0.0119441804f},
-std::array<float,2>{0.28168714f, 0.956437707f},
-std::array<float,2>{0.211561427f, 0.445827514f},
-std::array<float,2>{0.813013852f, 0.66458714f},
-std::array<float,2>{0.830436707f, 0.0567094684f},
-std::array<float,2>{0.187896952f, 0.975287795f},
-std::array<float,2>{0.303680182f, 0.478639275f},
-std::array<float,2>{0.568309009f, 0.647750139f},
-std::array<float,2>{0.717948079f, 0.274007529f},
-std::array<float,2>{0.43657583f, 0.540187597f},
-std::array<float,2>{0.106777549f, 0.165739968f},
-std::array<float,2>{0.911925077f, 0.853197336f},
-std::array<float,2>{0.963372409f, 0.396829039f},
-std::array<float,2>{0.0282574091f, 0.726652682f},
-std::array<float,2>{0.474840641f, 0.0823222771f},
-std::array<float,2>{0.672324598f, 0.905285001f},
-std::array<float,2>{0.551390886f, 0.212107763f},
-std::array<float,2>{0.342682898f, 0.80838275f},
-std::array<float,2>{0.180009127f, 0.316734374f},
-std::array<float,2>{0.759685099f, 0.582130075f},
-std::array<float,2>{0.894906223f, 0.151213124f},
-std::array<float,2>{0.0889928192f, 0.818479776f},
-std::array<float,2>{0.406184196f, 0.298006594f},
-std::array<float,2>{0.730189562f, 0.517839432f},
-std::array<float,2>{0.594289422f, 0.465674579f},
-std::array<float,2>{0.254953057f, 0.675266862f},
-std::array<float,2>{0.225893095f, 0.0188835226f},
-std::array<float,2>{0.857264221f, 0.942401111f},
-std::array<float,2>{0.806121945f, 0.369603932f},
-std::array<float,2>{0.135336131f, 0.594704509f},
-std::array<float,2>{0.370765686f, 0.236189365f},
-std::array<float,2>{0.525458992f, 0.754861236f},
-std::array<float,2>{0.648997307f, 0.114537992f},
-std::array<float,2>{0.441548675f, 0.921360016f},
-std::array<float,2>{0.0382609889f, 0.430458784f},
-std::array<float,2>{0.98317647f, 0.694683671f},
-std::array<float,2>{0.929096341f, 0.0912857205f},
-std::array<float,2>{0.117880851f, 0.891892374f},
-std::array<float,2>{0.408655554f, 0.40594089f},
-std::array<float,2>{0.691025853f, 0.720291793f},
-std::array<float,2>{0.592882097f, 0.321843952f},
-std::array<float,2>{0.287186414f, 0.592132926f},
-std::array<float,2>{0.218182653f, 0.208377585f},
-std::array<float,2>{0.818212092f, 0.802624285f},
-std::array<float,2>{0.770892859f, 0.476165891f},
-std::array<float,2>{0.170505151f, 0.651610076f},
-std::array<float,2>{0.327310234f, 0.0520764031f},
-std::array<float,2>{0.54239893f, 0.980699897f},
-std::array<float,2>{0.662699699f, 0.157552257f},
-std::array<float,2>{0.494624645f, 0.848277509f},
-std::array<float,2>{0.00608139532f, 0.265852988f},
-std::array<float,2>{0.952218235f, 0.532465875f},
-std::array<float,2>{0.872712314f, 0.242279544f},
-std::array<float,2>{0.244947433f, 0.757899582f},
-std::array<float,2>{0.280816913f, 0.360268652f},
-std::array<float,2>{0.622735739f, 0.608994842f},
-std::array<float,2>{0.736399174f, 0.42468369f},
-std::array<float,2>{0.383345187f, 0.699251711f},
-std::array<float,2>{0.0651102886f, 0.117479622f},
-std::array<float,2>{0.878380358f, 0.910523713f},
-std::array<float,2>{0.999761999f, 0.310718209f},
-std::array<float,2>{0.0483672209f, 0.529962778f},
-std::array<float,2>{0.467188299f, 0.1420912f},
-std::array<float,2>{0.626408398f, 0.824007154f},
-std::array<float,2>{0.515514672f, 0.0256582536f},
-std::array<float,2>{0.356263071f, 0.947609663f},
-std::array<float,2>{0.144053891f, 0.459018499f},
-std::array<float,2>{0.795933247f, 0.686322212f},
-std::array<float,2>{0.808840454f, 0.0439010151f},
-std::array<float,2>{0.139825702f, 0.991156936f},
-std::array<float,2>{0.374824435f, 0.497924268f},
-std::array<float,2>{0.530520439f, 0.628031015f},
-std::array<float,2>{0.654967844f, 0.255151242f},
-std::array<float,2>{0.440306813f, 0.554920971f},
-std::array<float,2>{0.0332638584f, 0.180871859f},
-std::array<float,2>{0.978007436f, 0.874834418f},
-std::array<float,2>{0.891529381f, 0.388041407f},
-std::array<float,2>{0.0928588212f, 0.734714448f},
-std::array<float,2>{0.402076304f, 0.0773847699f},
-std::array<float,2>{0.732656181f, 0.880278409f},
-std::array<float,2>{0.600298226f, 0.193422005f},
-std::array<float,2>{0.253073215f, 0.795019507f},
-std::array<float,2>{0.221386343f, 0.330095232f},
-std::array<float,2>{0.854147077f, 0.573187888f},
-std::array<float,2>{0.965767264f, 0.136698276f},
-std::array<float,2>{0.0236313138f, 0.835513234f},
-std::array<float,2>{0.470292628f, 0.290191829f},
-std::array<float,2>{0.676850557f, 0.503172874f},
-std::array<float,2>{0.549137473f, 0.439678729f},
-std::array<float,2>{0.339820564f, 0.661865473f},
-std::array<float,2>{0.185575515f, 0.00779974042f},
-std::array<float,2>{0.764822781f, 0.967053771f},
-std::array<float,2>{0.833056569f, 0.350751966f},
-std::array<float,2>{0.192458764f, 0.610242903f},
-std::array<float,2>{0.300687134f, 0.223065183f},
-std::array<float,2>{0.565784633f, 0.779456258f},
-std::array<float,2>{0.714141548f, 0.103427395f},
-std::array<float,2>{0.431106806f, 0.929637671f},
-std::array<float,2>{0.103529617f, 0.411169171f},
-std::array<float,2>{0.909264326f, 0.705165982f},
-std::array<float,2>{0.973031163f, 0.0101659875f},
-std::array<float,2>{0.0416194983f, 0.958414197f},
-std::array<float,2>{0.449121654f, 0.451728344f},
-std::array<float,2>{0.643241882f, 0.669856548f},
-std::array<float,2>{0.521403849f, 0.28641215f},
-std::array<float,2>{0.364685506f, 0.508072793f},
-std::array<float,2>{0.13125965f, 0.130351633f},
-std::array<float,2>{0.80212146f, 0.836864233f},
-std::array<float,2>{0.844483614f, 0.420083672f},
-std::array<float,2>{0.232468128f, 0.713647366f},
-std::array<float,2>{0.263300121f, 0.0965636745f},
-std::array<float,2>{0.605672836f, 0.930282414f},
-std::array<float,2>{0.721396744f, 0.234055787f},
-std::array<float,2>{0.394240797f, 0.769406438f},
-std::array<float,2>{0.0786989853f, 0.355833888f},
-std::array<float,2>{0.902032256f, 0.619586408f},
-std::array<float,2>{0.75423485f, 0.176529974f},
-std::array<float,2>{0.179077521f, 0.866128325f},
-std::array<float,2>{0.333112657f, 0.260972917f},
-std::array<float,2>{0.560480356f, 0.554357469f},
-std::array<float,2>{0.687498927f, 0.485952526f},
-std::array<float,2>{0.479067057f, 0.640425682f},
-std::array<float,2>{0.0174896903f, 0.0386847854f},
-std::array<float,2>{0.957952976f, 0.997708976f},
-std::array<float,2>{0.91521728f, 0.337756276f},
-std::array<float,2>{0.0978461653f, 0.566272318f},
-std::array<float,2>{0.425098181f, 0.20058839f},
-std::array<float,2>{0.704535484f, 0.782075107f},
-std::array<float,2>{0.573914051f, 0.0657601357f},
-std::array<float,2>{0.306362808f, 0.88500154f},
-std::array<float,2>{0.197954506f, 0.37653625f},
-std::array<float,2>{0.843139589f, 0.748693109f},
-std::array<float,2>{0.8274948f, 0.109956712f},
-std::array<float,2>{0.204040796f, 0.916052103f},
-std::array<float,2>{0.295529038f, 0.435524434f},
-std::array<float,2>{0.579257786f, 0.687705398f},
-std::array<float,2>{0.697605729f, 0.373681366f},
-std::array<float,2>{0.415841639f, 0.600226283f},
-std::array<float,2>{0.113272578f, 0.238573059f},
-std::array<float,2>{0.936884701f, 0.752851129f},
-std::array<float,2>{0.941074431f, 0.461869359f},
-std::array<float,2>{0.0131811602f, 0.676693082f},
-std::array<float,2>{0.486255884f, 0.0199683402f},
-std::array<float,2>{0.668031931f, 0.939489067f},
-std::array<float,2>{0.53555721f, 0.153376639f},
-std::array<float,2>{0.316390991f, 0.814741373f},
-std::array<float,2>{0.162109211f, 0.301558137f},
-std::array<float,2>{0.774836361f, 0.520466149f},
-std::array<float,2>{0.889063537f, 0.216362506f},
-std::array<float,2>{0.0762983263f, 0.811342776f},
-std::array<float,2>{0.378480524f, 0.313296169f},
-std::array<float,2>{0.745764852f, 0.581484795f},
-std::array<float,2>{0.611800492f, 0.394019753f},
-std::array<float,2>{0.268526584f, 0.73348707f},
-std::array<float,2>{0.239682019f, 0.0791376382f},
-std::array<float,2>{0.865012646f, 0.900669575f},
-std::array<float,2>{0.783441246f, 0.278929174f},
-std::array<float,2>{0.153694764f, 0.543966472f},
-std::array<float,2>{0.345929116f, 0.168313846f},
-std::array<float,2>{0.507769346f, 0.856279254f},
-std::array<float,2>{0.636453927f, 0.0589806736f},
-std::array<float,2>{0.460546553f, 0.971429288f},
-std::array<float,2>{0.0613720678f, 0.484055877f},
-std::array<float,2>{0.990427613f, 0.644225717f},
-std::array<float,2>{0.904959679f, 0.0488876812f},
-std::array<float,2>{0.0845504925f, 0.979525805f},
-std::array<float,2>{0.397919983f, 0.469081104f},
-std::array<float,2>{0.72599113f, 0.653177977f},
-std::array<float,2>{0.605454743f, 0.269804746f},
-std::array<float,2>{0.259414703f, 0.538410425f},
-std::array<float,2>{0.228958532f, 0.163775161f},
-std::array<float,2>{0.848507941f, 0.845264852f},
-std::array<float,2>{0.798653901f, 0.400567085f},
-std::array<float,2>{0.128625304f, 0.724313915f},
-std::array<float,2>{0.360364974f, 0.0861897394f},
-std::array<float,2>{0.516114652f, 0.897925377f},
-std::array<float,2>{0.648265362f, 0.205959171f},
-std::array<float,2>{0.451515645f, 0.799639046f},
-std::array<float,2>{0.046870321f, 0.326217771f},
-std::array<float,2>{0.970119774f, 0.586526453f},
-std::array<float,2>{0.836815774f, 0.147110373f},
-std::array<float,2>{0.202514678f, 0.827695847f},
-std::array<float,2>{0.309715003f, 0.304863662f},
-std::array<float,2>{0.5759179f, 0.525535941f},
-std::array<float,2>{0.707497239f, 0.455918103f},
-std::array<float,2>{0.429239154f, 0.680114448f},
-std::array<float,2>{0.0951980129f, 0.0289944094f},
-std::array<float,2>{0.920060754f, 0.950552225f},
-std::array<float,2>{0.955796719f, 0.36348927f},
-std::array<float,2>{0.02229831f, 0.604649246f},
-std::array<float,2>{0.484271139f, 0.246496707f},
-std::array<float,2>{0.68273586f, 0.762638927f},
-std::array<float,2>{0.557490051f, 0.122702084f},
-std::array<float,2>{0.329277128f, 0.907553852f},
-std::array<float,2>{0.175336733f, 0.428086847f},
-std::array<float,2>{0.753575563f, 0.696869373f},
-std::array<float,2>{0.781174421f, 0.0733305514f},
-std::array<float,2>{0.159555733f, 0.877872527f},
-std::array<float,2>{0.318081617f, 0.386625856f},
-std::array<float,2>{0.534376979f, 0.742105067f},
-std::array<float,2>{0.665037036f, 0.332405537f},
-std::array<float,2>{0.491661042f, 0.576966882f},
-std::array<float,2>{0.0108189695f, 0.190531865f},
-std::array<float,2>{0.941752374f, 0.789759636f},
-std::array<float,2>{0.930566192f, 0.493904352f},
-std::array<float,2>{0.114019722f, 0.632330298f},
-std::array<float,2>{0.419268578f, 0.0429360196f},
-std::array<float,2>{0.699784338f, 0.985413373f},
-std::array<float,2>{0.582925737f, 0.184858784f},
-std::array<float,2>{0.292509943f, 0.869342804f},
-std::array<float,2>{0.210293472f, 0.252414376f},
-std::array<float,2>{0.823060811f, 0.559452415f},
-std::array<float,2>{0.98770684f, 0.221036404f},
-std::array<float,2>{0.0554754511f, 0.775656223f},
-std::array<float,2>{0.454884529f, 0.345254809f},
-std::array<float,2>{0.640162945f, 0.615805686f},
-std::array<float,2>{0.503098011f, 0.410048902f},
-std::array<float,2>{0.351208419f, 0.707391024f},
-std::array<float,2>{0.149555653f, 0.105841622f},
-std::array<float,2>{0.787819147f, 0.921996772f},
-std::array<float,2>{0.861346245f, 0.294242114f},
-std::array<float,2>{0.237625077f, 0.504615486f},
-std::array<float,2>{0.269538701f, 0.138516352f},
-std::array<float,2>{0.614077628f, 0.828202665f},
-std::array<float,2>{0.749212384f, 0.00361659331f},
-std::array<float,2>{0.379029423f, 0.963373661f},
-std::array<float,2>{0.071147576f, 0.443963856f},
-std::array<float,2>{0.885096729f, 0.658845127f},
-std::array<float,2>{0.948625445f, 0.100235887f},
-std::array<float,2>{0.000878476363f, 0.935505748f},
-std::array<float,2>{0.496986508f, 0.416869551f},
-std::array<float,2>{0.65797478f, 0.718253672f},
-std::array<float,2>{0.543451369f, 0.35537231f},
-std::array<float,2>{0.32372421f, 0.623770654f},
-std::array<float,2>{0.166545048f, 0.229794294f},
-std::array<float,2>{0.769408286f, 0.771599233f},
-std::array<float,2>{0.816280603f, 0.448419631f},
-std::array<float,2>{0.21371609f, 0.667884946f},
-std::array<float,2>{0.284851104f, 0.0141152535f},
-std::array<float,2>{0.589331806f, 0.954304397f},
-std::array<float,2>{0.694618165f, 0.128055543f},
-std::array<float,2>{0.410506696f, 0.841294944f},
-std::array<float,2>{0.122499637f, 0.284352928f},
-std::array<float,2>{0.923544109f, 0.51451987f},
-std::array<float,2>{0.791966915f, 0.196400315f},
-std::array<float,2>{0.148137361f, 0.785156608f},
-std::array<float,2>{0.351795554f, 0.342722982f},
-std::array<float,2>{0.509418488f, 0.566449463f},
-std::array<float,2>{0.629446268f, 0.381422907f},
-std::array<float,2>{0.461437523f, 0.742352247f},
-std::array<float,2>{0.0541287363f, 0.0672950745f},
-std::array<float,2>{0.993352234f, 0.88676846f},
-std::array<float,2>{0.879463434f, 0.265056103f},
-std::array<float,2>{0.069878757f, 0.550042272f},
-std::array<float,2>{0.388142586f, 0.174797684f},
-std::array<float,2>{0.740328014f, 0.861240208f},
-std::array<float,2>{0.618729591f, 0.0329424962f},
-std::array<float,2>{0.275588214f, 0.992904067f},
-std::array<float,2>{0.249174833f, 0.488568425f},
-std::array<float,2>{0.86732173f, 0.634729028f},
-std::array<float,2>{0.858331561f, 0.0167288482f},
-std::array<float,2>{0.223209321f, 0.944019377f},
-std::array<float,2>{0.257135093f, 0.468684345f},
-std::array<float,2>{0.597133577f, 0.673058152f},
-std::array<float,2>{0.728002727f, 0.300155818f},
-std::array<float,2>{0.403079957f, 0.516330957f},
-std::array<float,2>{0.0862294957f, 0.149472237f},
-std::array<float,2>{0.898337185f, 0.81821847f},
-std::array<float,2>{0.981043816f, 0.432748377f},
-std::array<float,2>{0.0362722613f, 0.69191581f},
-std::array<float,2>{0.444244027f, 0.115919411f},
-std::array<float,2>{0.650852621f, 0.919005454f},
-std::array<float,2>{0.524204552f, 0.236750916f},
-std::array<float,2>{0.367449641f, 0.757766187f},
-std::array<float,2>{0.134388879f, 0.368975431f},
-std::array<float,2>{0.80825007f, 0.595804453f},
-std::array<float,2>{0.912422419f, 0.167784929f},
-std::array<float,2>{0.108273655f, 0.854355872f},
-std::array<float,2>{0.434442699f, 0.277097762f},
-std::array<float,2>{0.716116011f, 0.541120768f},
-std::array<float,2>{0.569826066f, 0.477182388f},
-std::array<float,2>{0.301986873f, 0.646481037f},
-std::array<float,2>{0.190711707f, 0.0563642569f},
-std::array<float,2>{0.828820288f, 0.973710537f},
-std::array<float,2>{0.761198103f, 0.319097131f},
-std::array<float,2>{0.182798564f, 0.585058928f},
-std::array<float,2>{0.340726346f, 0.212995231f},
-std::array<float,2>{0.553339601f, 0.806005359f},
-std::array<float,2>{0.67517972f, 0.0850930437f},
-std::array<float,2>{0.474078506f, 0.903599679f},
-std::array<float,2>{0.0300272666f, 0.394629031f},
-std::array<float,2>{0.962400794f, 0.730043054f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.508153617f, 0.719388902f},
-std::array<float,2>{0.331776619f, 0.0175911542f},
-std::array<float,2>{0.912973046f, 0.314925998f},
-std::array<float,2>{0.0262430049f, 0.92638737f},
-std::array<float,2>{0.801440239f, 0.830951631f},
-std::array<float,2>{0.15325579f, 0.393373281f},
-std::array<float,2>{0.749997735f, 0.131062925f},
-std::array<float,2>{0.408586591f, 0.560456157f},
-std::array<float,2>{0.631895542f, 0.945798695f},
-std::array<float,2>{0.48563239f, 0.303419769f},
-std::array<float,2>{0.871476471f, 0.118652977f},
-std::array<float,2>{0.233378634f, 0.661434531f},
-std::array<float,2>{0.992230356f, 0.622523129f},
-std::array<float,2>{0.106541455f, 0.215404212f},
-std::array<float,2>{0.572494268f, 0.48478809f},
-std::array<float,2>{0.2939623f, 0.767049789f},
-std::array<float,2>{0.704839766f, 0.509361148f},
-std::array<float,2>{0.387489259f, 0.15897578f},
-std::array<float,2>{0.768365324f, 0.424780101f},
-std::array<float,2>{0.164778963f, 0.848797619f},
-std::array<float,2>{0.879109383f, 0.898370266f},
-std::array<float,2>{0.0554515161f, 0.348115921f},
-std::array<float,2>{0.543581724f, 0.0541893579f},
-std::array<float,2>{0.37106216f, 0.68925637f},
-std::array<float,2>{0.613277793f, 0.802112103f},
-std::array<float,2>{0.275532305f, 0.461041272f},
-std::array<float,2>{0.945201993f, 0.236805141f},
-std::array<float,2>{0.069680728f, 0.57482779f},
-std::array<float,2>{0.842216849f, 0.628020644f},
-std::array<float,2>{0.195664719f, 0.0825388208f},
-std::array<float,2>{0.673964083f, 0.277388185f},
-std::array<float,2>{0.451185286f, 0.976412117f},
-std::array<float,2>{0.588396668f, 0.583225429f},
-std::array<float,2>{0.312487751f, 0.222497344f},
-std::array<float,2>{0.974886179f, 0.442408264f},
-std::array<float,2>{0.111100994f, 0.782677174f},
-std::array<float,2>{0.858346164f, 0.994103253f},
-std::array<float,2>{0.245180041f, 0.26266408f},
-std::array<float,2>{0.643875957f, 0.0754973814f},
-std::array<float,2>{0.475924343f, 0.64540422f},
-std::array<float,2>{0.734016418f, 0.873093367f},
-std::array<float,2>{0.42321074f, 0.418711483f},
-std::array<float,2>{0.785724998f, 0.179139718f},
-std::array<float,2>{0.13472122f, 0.525112391f},
-std::array<float,2>{0.92786473f, 0.705864787f},
-std::array<float,2>{0.00379184773f, 0.0348818637f},
-std::array<float,2>{0.523618281f, 0.370328724f},
-std::array<float,2>{0.318037927f, 0.887594104f},
-std::array<float,2>{0.658276975f, 0.679035425f},
-std::array<float,2>{0.459874392f, 0.0988320038f},
-std::array<float,2>{0.825249195f, 0.287300348f},
-std::array<float,2>{0.207458138f, 0.964891076f},
-std::array<float,2>{0.966467142f, 0.762304068f},
-std::array<float,2>{0.0911755189f, 0.481441975f},
-std::array<float,2>{0.59530282f, 0.201283097f},
-std::array<float,2>{0.263388783f, 0.604054928f},
-std::array<float,2>{0.561612546f, 0.918353558f},
-std::array<float,2>{0.35290283f, 0.332475215f},
-std::array<float,2>{0.890763879f, 0.00291300262f},
-std::array<float,2>{0.0395503864f, 0.749977171f},
-std::array<float,2>{0.759031773f, 0.540469348f},
-std::array<float,2>{0.179187015f, 0.155902505f},
-std::array<float,2>{0.690145791f, 0.386055082f},
-std::array<float,2>{0.393287957f, 0.823663473f},
-std::array<float,2>{0.606326759f, 0.648514688f},
-std::array<float,2>{0.251196444f, 0.0645089224f},
-std::array<float,2>{0.956862152f, 0.256295949f},
-std::array<float,2>{0.0821420103f, 0.990680456f},
-std::array<float,2>{0.819843411f, 0.79162246f},
-std::array<float,2>{0.213947639f, 0.453010172f},
-std::array<float,2>{0.665259898f, 0.231880143f},
-std::array<float,2>{0.463296175f, 0.591178775f},
-std::array<float,2>{0.696538806f, 0.878639281f},
-std::array<float,2>{0.402192175f, 0.362041295f},
-std::array<float,2>{0.751420617f, 0.0428072773f},
-std::array<float,2>{0.181127042f, 0.715178907f},
-std::array<float,2>{0.905686677f, 0.521336257f},
-std::array<float,2>{0.0385623462f, 0.187211409f},
-std::array<float,2>{0.550975442f, 0.406581849f},
-std::array<float,2>{0.349738628f, 0.86473763f},
-std::array<float,2>{0.655337691f, 0.600805879f},
-std::array<float,2>{0.479199171f, 0.187563494f},
-std::array<float,2>{0.850860417f, 0.470611364f},
-std::array<float,2>{0.238557085f, 0.75195384f},
-std::array<float,2>{0.977592826f, 0.956448257f},
-std::array<float,2>{0.124132648f, 0.294755071f},
-std::array<float,2>{0.579568505f, 0.102472782f},
-std::array<float,2>{0.302297413f, 0.682522655f},
-std::array<float,2>{0.517681658f, 0.819685102f},
-std::array<float,2>{0.325085908f, 0.376304895f},
-std::array<float,2>{0.931763828f, 0.146800131f},
-std::array<float,2>{0.0133098904f, 0.538595557f},
-std::array<float,2>{0.790894449f, 0.738895357f},
-std::array<float,2>{0.13056846f, 0.0108478246f},
-std::array<float,2>{0.720096886f, 0.341735095f},
-std::array<float,2>{0.430928588f, 0.910975814f},
-std::array<float,2>{0.535657704f, 0.550943851f},
-std::array<float,2>{0.363136232f, 0.136143133f},
-std::array<float,2>{0.887381732f, 0.40022561f},
-std::array<float,2>{0.0481946468f, 0.842146575f},
-std::array<float,2>{0.774155319f, 0.933072388f},
-std::array<float,2>{0.162974223f, 0.326316446f},
-std::array<float,2>{0.714040577f, 0.0307794195f},
-std::array<float,2>{0.3808074f, 0.733750224f},
-std::array<float,2>{0.681457937f, 0.779572487f},
-std::array<float,2>{0.442787111f, 0.498256952f},
-std::array<float,2>{0.831279635f, 0.207699984f},
-std::array<float,2>{0.188253179f, 0.616796732f},
-std::array<float,2>{0.946692467f, 0.666651368f},
-std::array<float,2>{0.0738432854f, 0.116478048f},
-std::array<float,2>{0.622089088f, 0.305096537f},
-std::array<float,2>{0.267907381f, 0.939434409f},
-std::array<float,2>{0.738005579f, 0.702376366f},
-std::array<float,2>{0.420791835f, 0.0566678569f},
-std::array<float,2>{0.806598961f, 0.352312803f},
-std::array<float,2>{0.143918693f, 0.903610528f},
-std::array<float,2>{0.915583014f, 0.85656172f},
-std::array<float,2>{0.0173549373f, 0.432359904f},
-std::array<float,2>{0.502811074f, 0.164535031f},
-std::array<float,2>{0.335984379f, 0.501719117f},
-std::array<float,2>{0.567922771f, 0.978793561f},
-std::array<float,2>{0.2875835f, 0.273021638f},
-std::array<float,2>{0.989138961f, 0.0896599665f},
-std::array<float,2>{0.097457774f, 0.632896721f},
-std::array<float,2>{0.86100924f, 0.563672662f},
-std::array<float,2>{0.22096473f, 0.243655816f},
-std::array<float,2>{0.637628853f, 0.454440653f},
-std::array<float,2>{0.49829784f, 0.805909514f},
-std::array<float,2>{0.549214184f, 0.658504546f},
-std::array<float,2>{0.345236808f, 0.122173689f},
-std::array<float,2>{0.900128961f, 0.297484279f},
-std::array<float,2>{0.0331405327f, 0.949733257f},
-std::array<float,2>{0.7572366f, 0.770031273f},
-std::array<float,2>{0.186640665f, 0.488942921f},
-std::array<float,2>{0.700190902f, 0.214428142f},
-std::array<float,2>{0.402749568f, 0.617914617f},
-std::array<float,2>{0.671705127f, 0.924927831f},
-std::array<float,2>{0.466398239f, 0.317378879f},
-std::array<float,2>{0.815841317f, 0.0209441371f},
-std::array<float,2>{0.217634112f, 0.724540651f},
-std::array<float,2>{0.957263231f, 0.557689965f},
-std::array<float,2>{0.0795717239f, 0.126228735f},
-std::array<float,2>{0.604264319f, 0.396971136f},
-std::array<float,2>{0.256928593f, 0.83462888f},
-std::array<float,2>{0.723909855f, 0.573450267f},
-std::array<float,2>{0.435672551f, 0.240456074f},
-std::array<float,2>{0.796132207f, 0.465861827f},
-std::array<float,2>{0.126062557f, 0.799980223f},
-std::array<float,2>{0.936964273f, 0.97199285f},
-std::array<float,2>{0.0111079952f, 0.274970472f},
-std::array<float,2>{0.519941688f, 0.0800485015f},
-std::array<float,2>{0.322279483f, 0.631533861f},
-std::array<float,2>{0.582967699f, 0.843830109f},
-std::array<float,2>{0.296936184f, 0.428019583f},
-std::array<float,2>{0.98098588f, 0.162851796f},
-std::array<float,2>{0.118009105f, 0.512238383f},
-std::array<float,2>{0.846179068f, 0.694916844f},
-std::array<float,2>{0.237540439f, 0.0484734178f},
-std::array<float,2>{0.649427593f, 0.346366018f},
-std::array<float,2>{0.48198539f, 0.894439995f},
-std::array<float,2>{0.617393494f, 0.530854404f},
-std::array<float,2>{0.269684821f, 0.175582826f},
-std::array<float,2>{0.95284909f, 0.415179431f},
-std::array<float,2>{0.0777090117f, 0.867197037f},
-std::array<float,2>{0.835431159f, 0.883648038f},
-std::array<float,2>{0.194777489f, 0.374055892f},
-std::array<float,2>{0.683795929f, 0.035734687f},
-std::array<float,2>{0.44124347f, 0.708063304f},
-std::array<float,2>{0.717630863f, 0.787573636f},
-std::array<float,2>{0.376145065f, 0.438875705f},
-std::array<float,2>{0.778639197f, 0.223272711f},
-std::array<float,2>{0.159229085f, 0.579473674f},
-std::array<float,2>{0.88622117f, 0.642486989f},
-std::array<float,2>{0.0542140268f, 0.0712457895f},
-std::array<float,2>{0.531983137f, 0.260890037f},
-std::array<float,2>{0.365860939f, 0.998785257f},
-std::array<float,2>{0.636293471f, 0.744154572f},
-std::array<float,2>{0.492514014f, 0.00500858296f},
-std::array<float,2>{0.863555729f, 0.328548789f},
-std::array<float,2>{0.226322547f, 0.916798294f},
-std::array<float,2>{0.984774351f, 0.824893892f},
-std::array<float,2>{0.101390891f, 0.390263349f},
-std::array<float,2>{0.56289351f, 0.149951085f},
-std::array<float,2>{0.282138586f, 0.546667337f},
-std::array<float,2>{0.505880892f, 0.964427292f},
-std::array<float,2>{0.343369663f, 0.283263296f},
-std::array<float,2>{0.918883741f, 0.0965348408f},
-std::array<float,2>{0.0213694386f, 0.674824417f},
-std::array<float,2>{0.811624229f, 0.606795073f},
-std::array<float,2>{0.145998836f, 0.196677506f},
-std::array<float,2>{0.740632951f, 0.480124295f},
-std::array<float,2>{0.417011261f, 0.759629965f},
-std::array<float,2>{0.574436784f, 0.71274358f},
-std::array<float,2>{0.290414989f, 0.0432782732f},
-std::array<float,2>{0.997936368f, 0.366577804f},
-std::array<float,2>{0.104270868f, 0.880022883f},
-std::array<float,2>{0.868850708f, 0.860018194f},
-std::array<float,2>{0.22982119f, 0.410425037f},
-std::array<float,2>{0.626933098f, 0.183039561f},
-std::array<float,2>{0.490472019f, 0.517446399f},
-std::array<float,2>{0.743623853f, 0.984726548f},
-std::array<float,2>{0.411490113f, 0.251770318f},
-std::array<float,2>{0.79982096f, 0.0674552023f},
-std::array<float,2>{0.151549086f, 0.655756176f},
-std::array<float,2>{0.90760386f, 0.585967779f},
-std::array<float,2>{0.0302085299f, 0.230400369f},
-std::array<float,2>{0.514649987f, 0.449115902f},
-std::array<float,2>{0.33380571f, 0.793979108f},
-std::array<float,2>{0.676217377f, 0.534252584f},
-std::array<float,2>{0.447608948f, 0.141231656f},
-std::array<float,2>{0.836640477f, 0.379211307f},
-std::array<float,2>{0.201535031f, 0.81469661f},
-std::array<float,2>{0.940662265f, 0.906288624f},
-std::array<float,2>{0.0636910126f, 0.337437719f},
-std::array<float,2>{0.614794374f, 0.0128966002f},
-std::array<float,2>{0.281131029f, 0.735670209f},
-std::array<float,2>{0.539805412f, 0.754370093f},
-std::array<float,2>{0.371160239f, 0.475007743f},
-std::array<float,2>{0.878864408f, 0.194007456f},
-std::array<float,2>{0.0619159602f, 0.595053971f},
-std::array<float,2>{0.769856334f, 0.683814764f},
-std::array<float,2>{0.169819102f, 0.107969865f},
-std::array<float,2>{0.709317565f, 0.29178986f},
-std::array<float,2>{0.383002073f, 0.958303273f},
-std::array<float,2>{0.527758181f, 0.612043381f},
-std::array<float,2>{0.316015929f, 0.20414339f},
-std::array<float,2>{0.923763752f, 0.493492335f},
-std::array<float,2>{0.00445123622f, 0.77548641f},
-std::array<float,2>{0.781410098f, 0.944350719f},
-std::array<float,2>{0.138020143f, 0.309693366f},
-std::array<float,2>{0.726792276f, 0.112983964f},
-std::array<float,2>{0.429659665f, 0.670982778f},
-std::array<float,2>{0.648238599f, 0.839595199f},
-std::array<float,2>{0.47060594f, 0.402757794f},
-std::array<float,2>{0.854478955f, 0.137956068f},
-std::array<float,2>{0.247430354f, 0.5499084f},
-std::array<float,2>{0.971054733f, 0.726942658f},
-std::array<float,2>{0.116454981f, 0.0244370289f},
-std::array<float,2>{0.59336096f, 0.322930753f},
-std::array<float,2>{0.308292955f, 0.935542881f},
-std::array<float,2>{0.693359673f, 0.639791429f},
-std::array<float,2>{0.397875398f, 0.0925062373f},
-std::array<float,2>{0.764512062f, 0.267533422f},
-std::array<float,2>{0.173835129f, 0.981111884f},
-std::array<float,2>{0.897450387f, 0.811298013f},
-std::array<float,2>{0.0456362665f, 0.459198385f},
-std::array<float,2>{0.55477947f, 0.247675598f},
-std::array<float,2>{0.357595742f, 0.567768753f},
-std::array<float,2>{0.601514697f, 0.900169849f},
-std::array<float,2>{0.257924885f, 0.356490016f},
-std::array<float,2>{0.962843478f, 0.0621086396f},
-std::array<float,2>{0.0877343416f, 0.696876228f},
-std::array<float,2>{0.821668983f, 0.50773406f},
-std::array<float,2>{0.204695255f, 0.168767437f},
-std::array<float,2>{0.66168803f, 0.434570551f},
-std::array<float,2>{0.456036448f, 0.85467875f},
-std::array<float,2>{0.544985056f, 0.6910972f},
-std::array<float,2>{0.367957234f, 0.0524650626f},
-std::array<float,2>{0.881360531f, 0.350107819f},
-std::array<float,2>{0.0575994737f, 0.895557344f},
-std::array<float,2>{0.767296433f, 0.850767612f},
-std::array<float,2>{0.167259157f, 0.42278254f},
-std::array<float,2>{0.705855846f, 0.157106072f},
-std::array<float,2>{0.389683217f, 0.510866821f},
-std::array<float,2>{0.673132896f, 0.973807633f},
-std::array<float,2>{0.45001024f, 0.279567808f},
-std::array<float,2>{0.841744721f, 0.0842638388f},
-std::array<float,2>{0.198436648f, 0.626929343f},
-std::array<float,2>{0.942133784f, 0.576456249f},
-std::array<float,2>{0.0674669892f, 0.235534728f},
-std::array<float,2>{0.610716164f, 0.463524848f},
-std::array<float,2>{0.274792165f, 0.802912474f},
-std::array<float,2>{0.747880518f, 0.561566591f},
-std::array<float,2>{0.406343728f, 0.129098639f},
-std::array<float,2>{0.803924441f, 0.391392797f},
-std::array<float,2>{0.154509544f, 0.829265237f},
-std::array<float,2>{0.91182071f, 0.927783668f},
-std::array<float,2>{0.0244950466f, 0.312543005f},
-std::array<float,2>{0.509969115f, 0.0165546201f},
-std::array<float,2>{0.328564703f, 0.721335232f},
-std::array<float,2>{0.571729124f, 0.76900959f},
-std::array<float,2>{0.295548022f, 0.486542553f},
-std::array<float,2>{0.995157599f, 0.217606604f},
-std::array<float,2>{0.108894385f, 0.624617696f},
-std::array<float,2>{0.874622166f, 0.662399948f},
-std::array<float,2>{0.230989292f, 0.120891474f},
-std::array<float,2>{0.628971875f, 0.301773101f},
-std::array<float,2>{0.487644911f, 0.947679639f},
-std::array<float,2>{0.597484767f, 0.603266835f},
-std::array<float,2>{0.26532647f, 0.200388178f},
-std::array<float,2>{0.967242539f, 0.483865201f},
-std::array<float,2>{0.093137607f, 0.765532911f},
-std::array<float,2>{0.827814937f, 0.968060374f},
-std::array<float,2>{0.210907713f, 0.285966933f},
-std::array<float,2>{0.656974494f, 0.100307815f},
-std::array<float,2>{0.458781511f, 0.676855624f},
-std::array<float,2>{0.688991666f, 0.822059453f},
-std::array<float,2>{0.392004192f, 0.38362658f},
-std::array<float,2>{0.761539876f, 0.153226733f},
-std::array<float,2>{0.176296264f, 0.542330205f},
-std::array<float,2>{0.893182456f, 0.746399641f},
-std::array<float,2>{0.0424082614f, 0.00114407658f},
-std::array<float,2>{0.559134305f, 0.33448264f},
-std::array<float,2>{0.353673786f, 0.921207547f},
-std::array<float,2>{0.64204967f, 0.648017466f},
-std::array<float,2>{0.474029422f, 0.0770143792f},
-std::array<float,2>{0.856509328f, 0.26429525f},
-std::array<float,2>{0.243013173f, 0.996076524f},
-std::array<float,2>{0.97311306f, 0.785071015f},
-std::array<float,2>{0.111498535f, 0.444091827f},
-std::array<float,2>{0.586378515f, 0.219124064f},
-std::array<float,2>{0.309524745f, 0.584718466f},
-std::array<float,2>{0.527230561f, 0.889471292f},
-std::array<float,2>{0.319831222f, 0.368996263f},
-std::array<float,2>{0.92648679f, 0.0323330201f},
-std::array<float,2>{0.00104671251f, 0.703340173f},
-std::array<float,2>{0.7875067f, 0.526324093f},
-std::array<float,2>{0.135955766f, 0.175914407f},
-std::array<float,2>{0.732397139f, 0.420968652f},
-std::array<float,2>{0.42417711f, 0.872464657f},
-std::array<float,2>{0.581117809f, 0.681559503f},
-std::array<float,2>{0.304611832f, 0.104278453f},
-std::array<float,2>{0.980214119f, 0.295946717f},
-std::array<float,2>{0.121444643f, 0.954077423f},
-std::array<float,2>{0.849394381f, 0.75164032f},
-std::array<float,2>{0.24111034f, 0.472237051f},
-std::array<float,2>{0.653807461f, 0.190722197f},
-std::array<float,2>{0.476727247f, 0.597686291f},
-std::array<float,2>{0.722065449f, 0.913963377f},
-std::array<float,2>{0.432530105f, 0.343139946f},
-std::array<float,2>{0.791787863f, 0.00899342913f},
-std::array<float,2>{0.131826937f, 0.74171412f},
-std::array<float,2>{0.930548012f, 0.536219656f},
-std::array<float,2>{0.0150318798f, 0.14505595f},
-std::array<float,2>{0.516618192f, 0.37757796f},
-std::array<float,2>{0.328012317f, 0.817211032f},
-std::array<float,2>{0.667415142f, 0.592168272f},
-std::array<float,2>{0.461061984f, 0.232556969f},
-std::array<float,2>{0.817860544f, 0.450380117f},
-std::array<float,2>{0.211173519f, 0.789085269f},
-std::array<float,2>{0.954893529f, 0.989244342f},
-std::array<float,2>{0.0853699297f, 0.25515002f},
-std::array<float,2>{0.607880294f, 0.0634540319f},
-std::array<float,2>{0.253028989f, 0.651261985f},
-std::array<float,2>{0.554246306f, 0.866889596f},
-std::array<float,2>{0.349240899f, 0.41003561f},
-std::array<float,2>{0.90417099f, 0.184181824f},
-std::array<float,2>{0.0362634324f, 0.52258265f},
-std::array<float,2>{0.752009869f, 0.717429936f},
-std::array<float,2>{0.181754738f, 0.0402790755f},
-std::array<float,2>{0.697304368f, 0.360471785f},
-std::array<float,2>{0.399163902f, 0.876662672f},
-std::array<float,2>{0.501578152f, 0.501996398f},
-std::array<float,2>{0.338272631f, 0.166113123f},
-std::array<float,2>{0.917258382f, 0.429997563f},
-std::array<float,2>{0.0184962116f, 0.858860731f},
-std::array<float,2>{0.80691421f, 0.906164467f},
-std::array<float,2>{0.14234443f, 0.353618264f},
-std::array<float,2>{0.73508656f, 0.0554851703f},
-std::array<float,2>{0.417979121f, 0.700423717f},
-std::array<float,2>{0.640278101f, 0.808445334f},
-std::array<float,2>{0.497229606f, 0.455837816f},
-std::array<float,2>{0.862282872f, 0.244844943f},
-std::array<float,2>{0.220444441f, 0.564563215f},
-std::array<float,2>{0.991829395f, 0.635847747f},
-std::array<float,2>{0.0949190184f, 0.0873701796f},
-std::array<float,2>{0.569564283f, 0.270300299f},
-std::array<float,2>{0.286825031f, 0.976921141f},
-std::array<float,2>{0.712101161f, 0.731696129f},
-std::array<float,2>{0.381910771f, 0.0285622701f},
-std::array<float,2>{0.776537061f, 0.324466407f},
-std::array<float,2>{0.160523266f, 0.929691017f},
-std::array<float,2>{0.890171826f, 0.841307938f},
-std::array<float,2>{0.0490234941f, 0.401046574f},
-std::array<float,2>{0.537115633f, 0.134544f},
-std::array<float,2>{0.359641939f, 0.554353654f},
-std::array<float,2>{0.623244822f, 0.939953268f},
-std::array<float,2>{0.265670478f, 0.308090568f},
-std::array<float,2>{0.947344184f, 0.113855891f},
-std::array<float,2>{0.0721829459f, 0.6652143f},
-std::array<float,2>{0.828411639f, 0.615077257f},
-std::array<float,2>{0.190265566f, 0.210683852f},
-std::array<float,2>{0.683580399f, 0.496943593f},
-std::array<float,2>{0.443893462f, 0.778674185f},
-std::array<float,2>{0.522429824f, 0.629477084f},
-std::array<float,2>{0.320528239f, 0.0805121437f},
-std::array<float,2>{0.934993148f, 0.276772946f},
-std::array<float,2>{0.00872315746f, 0.969243288f},
-std::array<float,2>{0.79335463f, 0.798567772f},
-std::array<float,2>{0.127962321f, 0.467526495f},
-std::array<float,2>{0.725437164f, 0.238860413f},
-std::array<float,2>{0.433972955f, 0.571917117f},
-std::array<float,2>{0.65178436f, 0.892422676f},
-std::array<float,2>{0.483431518f, 0.345204622f},
-std::array<float,2>{0.844994068f, 0.05070474f},
-std::array<float,2>{0.235006556f, 0.692382455f},
-std::array<float,2>{0.983928025f, 0.513904393f},
-std::array<float,2>{0.119556867f, 0.161060259f},
-std::array<float,2>{0.585430682f, 0.42715463f},
-std::array<float,2>{0.299276501f, 0.846579373f},
-std::array<float,2>{0.702330649f, 0.619596183f},
-std::array<float,2>{0.405997455f, 0.21233277f},
-std::array<float,2>{0.755753219f, 0.49148494f},
-std::array<float,2>{0.185410336f, 0.772413611f},
-std::array<float,2>{0.901728928f, 0.951430082f},
-std::array<float,2>{0.0347250253f, 0.299119264f},
-std::array<float,2>{0.548533082f, 0.124141447f},
-std::array<float,2>{0.347152412f, 0.658112049f},
-std::array<float,2>{0.603354156f, 0.83325702f},
-std::array<float,2>{0.254101306f, 0.394709796f},
-std::array<float,2>{0.959296763f, 0.12802057f},
-std::array<float,2>{0.0810850933f, 0.556213915f},
-std::array<float,2>{0.813523054f, 0.725982785f},
-std::array<float,2>{0.216310292f, 0.0233558714f},
-std::array<float,2>{0.669189036f, 0.319904804f},
-std::array<float,2>{0.468197733f, 0.923670232f},
-std::array<float,2>{0.565030634f, 0.544550657f},
-std::array<float,2>{0.284624517f, 0.151944801f},
-std::array<float,2>{0.987588346f, 0.387208611f},
-std::array<float,2>{0.098067075f, 0.826450825f},
-std::array<float,2>{0.865877807f, 0.915421069f},
-std::array<float,2>{0.223350167f, 0.331285149f},
-std::array<float,2>{0.634463549f, 0.00598752964f},
-std::array<float,2>{0.494578063f, 0.742652118f},
-std::array<float,2>{0.73943305f, 0.759984434f},
-std::array<float,2>{0.414713889f, 0.477399111f},
-std::array<float,2>{0.810372829f, 0.197347671f},
-std::array<float,2>{0.147986159f, 0.609337449f},
-std::array<float,2>{0.921292901f, 0.673282444f},
-std::array<float,2>{0.0220614728f, 0.0949422121f},
-std::array<float,2>{0.505662858f, 0.283060551f},
-std::array<float,2>{0.340913415f, 0.96173805f},
-std::array<float,2>{0.686553657f, 0.710656047f},
-std::array<float,2>{0.437810898f, 0.0376121588f},
-std::array<float,2>{0.833665192f, 0.371753007f},
-std::array<float,2>{0.192937449f, 0.884958446f},
-std::array<float,2>{0.949407876f, 0.870255649f},
-std::array<float,2>{0.0750257075f, 0.416079462f},
-std::array<float,2>{0.620824754f, 0.17300041f},
-std::array<float,2>{0.272467792f, 0.529047608f},
-std::array<float,2>{0.534057915f, 0.996646225f},
-std::array<float,2>{0.364609063f, 0.259463996f},
-std::array<float,2>{0.884289563f, 0.0735592246f},
-std::array<float,2>{0.051813107f, 0.644496799f},
-std::array<float,2>{0.77930516f, 0.58120811f},
-std::array<float,2>{0.156523317f, 0.225999445f},
-std::array<float,2>{0.716688633f, 0.440220147f},
-std::array<float,2>{0.37876606f, 0.7861076f},
-std::array<float,2>{0.615487278f, 0.736779034f},
-std::array<float,2>{0.277476341f, 0.0155258533f},
-std::array<float,2>{0.938536644f, 0.339321017f},
-std::array<float,2>{0.0648751706f, 0.909970999f},
-std::array<float,2>{0.838550448f, 0.813186944f},
-std::array<float,2>{0.200048804f, 0.382372558f},
-std::array<float,2>{0.679004371f, 0.144432187f},
-std::array<float,2>{0.44681567f, 0.532230079f},
-std::array<float,2>{0.708629072f, 0.959905744f},
-std::array<float,2>{0.385884613f, 0.290974468f},
-std::array<float,2>{0.771911323f, 0.107294977f},
-std::array<float,2>{0.169930249f, 0.686329722f},
-std::array<float,2>{0.876802266f, 0.596694767f},
-std::array<float,2>{0.0589278191f, 0.191414133f},
-std::array<float,2>{0.542379737f, 0.473463356f},
-std::array<float,2>{0.374392807f, 0.757742882f},
-std::array<float,2>{0.628143132f, 0.519194365f},
-std::array<float,2>{0.489446044f, 0.180986702f},
-std::array<float,2>{0.870746017f, 0.413184583f},
-std::array<float,2>{0.227484569f, 0.862841725f},
-std::array<float,2>{0.998324037f, 0.881377161f},
-std::array<float,2>{0.102395408f, 0.363422751f},
-std::array<float,2>{0.576460242f, 0.0468731076f},
-std::array<float,2>{0.292796761f, 0.713467538f},
-std::array<float,2>{0.511872947f, 0.796751738f},
-std::array<float,2>{0.335580021f, 0.44570455f},
-std::array<float,2>{0.908390164f, 0.227282092f},
-std::array<float,2>{0.0276172254f, 0.58830297f},
-std::array<float,2>{0.798413992f, 0.653337836f},
-std::array<float,2>{0.148530751f, 0.0693385601f},
-std::array<float,2>{0.74538517f, 0.253258705f},
-std::array<float,2>{0.412619621f, 0.986748815f},
-std::array<float,2>{0.557444215f, 0.56854856f},
-std::array<float,2>{0.356349796f, 0.248613387f},
-std::array<float,2>{0.89590621f, 0.457207352f},
-std::array<float,2>{0.0433227308f, 0.808740079f},
-std::array<float,2>{0.763377368f, 0.983457565f},
-std::array<float,2>{0.172757939f, 0.268550962f},
-std::array<float,2>{0.69246161f, 0.091444388f},
-std::array<float,2>{0.395422846f, 0.638202846f},
-std::array<float,2>{0.663565695f, 0.853230357f},
-std::array<float,2>{0.453277975f, 0.436985493f},
-std::array<float,2>{0.82252425f, 0.171439558f},
-std::array<float,2>{0.206602067f, 0.505645573f},
-std::array<float,2>{0.963721991f, 0.698003829f},
-std::array<float,2>{0.0886605978f, 0.0603472702f},
-std::array<float,2>{0.598303318f, 0.357438266f},
-std::array<float,2>{0.260998368f, 0.900520802f},
-std::array<float,2>{0.729175746f, 0.668308079f},
-std::array<float,2>{0.426841199f, 0.110908717f},
-std::array<float,2>{0.784659386f, 0.31124109f},
-std::array<float,2>{0.139545307f, 0.942874432f},
-std::array<float,2>{0.925435901f, 0.774582922f},
-std::array<float,2>{0.00771567971f, 0.495089293f},
-std::array<float,2>{0.529496729f, 0.205109671f},
-std::array<float,2>{0.314377606f, 0.611158848f},
-std::array<float,2>{0.590520918f, 0.935847402f},
-std::array<float,2>{0.305071741f, 0.321573794f},
-std::array<float,2>{0.969183445f, 0.027120417f},
-std::array<float,2>{0.115119465f, 0.729692578f},
-std::array<float,2>{0.85226357f, 0.547578573f},
-std::array<float,2>{0.248394012f, 0.140265033f},
-std::array<float,2>{0.645151556f, 0.405324548f},
-std::array<float,2>{0.472434968f, 0.836765349f},
-std::array<float,2>{0.559836209f, 0.748766899f},
-std::array<float,2>{0.35477823f, 0.00346786249f},
-std::array<float,2>{0.894380629f, 0.333456278f},
-std::array<float,2>{0.0412608907f, 0.919541538f},
-std::array<float,2>{0.760088801f, 0.822915196f},
-std::array<float,2>{0.177731961f, 0.385077238f},
-std::array<float,2>{0.687875569f, 0.155039907f},
-std::array<float,2>{0.391474158f, 0.53915447f},
-std::array<float,2>{0.657242477f, 0.966383457f},
-std::array<float,2>{0.457835734f, 0.288179696f},
-std::array<float,2>{0.826624274f, 0.0978841931f},
-std::array<float,2>{0.209513843f, 0.678133249f},
-std::array<float,2>{0.96788013f, 0.604840159f},
-std::array<float,2>{0.0924599022f, 0.202696592f},
-std::array<float,2>{0.595811903f, 0.481652915f},
-std::array<float,2>{0.264091551f, 0.763212264f},
-std::array<float,2>{0.730932057f, 0.523709714f},
-std::array<float,2>{0.425194502f, 0.178640008f},
-std::array<float,2>{0.788450599f, 0.419804543f},
-std::array<float,2>{0.135608524f, 0.874606907f},
-std::array<float,2>{0.926961124f, 0.888336718f},
-std::array<float,2>{0.000414798444f, 0.369348705f},
-std::array<float,2>{0.526069462f, 0.0340482891f},
-std::array<float,2>{0.318756312f, 0.706948102f},
-std::array<float,2>{0.587213755f, 0.781573415f},
-std::array<float,2>{0.310044706f, 0.441987038f},
-std::array<float,2>{0.973912001f, 0.221376717f},
-std::array<float,2>{0.113191158f, 0.582486391f},
-std::array<float,2>{0.85565722f, 0.645819008f},
-std::array<float,2>{0.243423745f, 0.0745423585f},
-std::array<float,2>{0.64104259f, 0.263153851f},
-std::array<float,2>{0.473614156f, 0.992440701f},
-std::array<float,2>{0.609660685f, 0.575994849f},
-std::array<float,2>{0.274379432f, 0.237604454f},
-std::array<float,2>{0.943077147f, 0.462204814f},
-std::array<float,2>{0.067142792f, 0.800881386f},
-std::array<float,2>{0.839862943f, 0.974772215f},
-std::array<float,2>{0.198135421f, 0.278678358f},
-std::array<float,2>{0.672224045f, 0.0832665414f},
-std::array<float,2>{0.450422406f, 0.627892613f},
-std::array<float,2>{0.707018375f, 0.848519504f},
-std::array<float,2>{0.388795257f, 0.425380588f},
-std::array<float,2>{0.765869856f, 0.159896404f},
-std::array<float,2>{0.166339308f, 0.50851953f},
-std::array<float,2>{0.881906629f, 0.687548041f},
-std::array<float,2>{0.0579932965f, 0.0533574075f},
-std::array<float,2>{0.546506703f, 0.348922849f},
-std::array<float,2>{0.368289828f, 0.896626174f},
-std::array<float,2>{0.630609393f, 0.660869837f},
-std::array<float,2>{0.4871566f, 0.117760308f},
-std::array<float,2>{0.873831689f, 0.304214865f},
-std::array<float,2>{0.231710032f, 0.946528196f},
-std::array<float,2>{0.994435728f, 0.766020894f},
-std::array<float,2>{0.10775727f, 0.486117244f},
-std::array<float,2>{0.570419431f, 0.216332301f},
-std::array<float,2>{0.296694189f, 0.621919334f},
-std::array<float,2>{0.511056066f, 0.926872075f},
-std::array<float,2>{0.329496592f, 0.316285998f},
-std::array<float,2>{0.910402894f, 0.0188165903f},
-std::array<float,2>{0.0237834137f, 0.720090032f},
-std::array<float,2>{0.803468943f, 0.558803678f},
-std::array<float,2>{0.155509666f, 0.132114574f},
-std::array<float,2>{0.746547282f, 0.394172519f},
-std::array<float,2>{0.407250553f, 0.83130002f},
-std::array<float,2>{0.568629503f, 0.634650588f},
-std::array<float,2>{0.285938174f, 0.0888328701f},
-std::array<float,2>{0.990871012f, 0.272301376f},
-std::array<float,2>{0.0944728479f, 0.980074286f},
-std::array<float,2>{0.862387598f, 0.80525142f},
-std::array<float,2>{0.219440013f, 0.453419685f},
-std::array<float,2>{0.639370799f, 0.242435649f},
-std::array<float,2>{0.497059703f, 0.563027799f},
-std::array<float,2>{0.735924959f, 0.903184831f},
-std::array<float,2>{0.41975382f, 0.353239506f},
-std::array<float,2>{0.808244884f, 0.0585586019f},
-std::array<float,2>{0.141554594f, 0.702110946f},
-std::array<float,2>{0.916512728f, 0.500673592f},
-std::array<float,2>{0.0194890779f, 0.165811032f},
-std::array<float,2>{0.500460267f, 0.433365971f},
-std::array<float,2>{0.33929491f, 0.855578661f},
-std::array<float,2>{0.682567298f, 0.615503907f},
-std::array<float,2>{0.444451272f, 0.208214894f},
-std::array<float,2>{0.82922256f, 0.499097019f},
-std::array<float,2>{0.190880135f, 0.781220078f},
-std::array<float,2>{0.948940873f, 0.937956989f},
-std::array<float,2>{0.0705908164f, 0.305858165f},
-std::array<float,2>{0.624503314f, 0.115388602f},
-std::array<float,2>{0.267138839f, 0.667322397f},
-std::array<float,2>{0.538858294f, 0.843718708f},
-std::array<float,2>{0.360481381f, 0.39888525f},
-std::array<float,2>{0.889419734f, 0.134900838f},
-std::array<float,2>{0.0503582582f, 0.552318335f},
-std::array<float,2>{0.775590718f, 0.733196497f},
-std::array<float,2>{0.161339954f, 0.0302055534f},
-std::array<float,2>{0.711899877f, 0.328095347f},
-std::array<float,2>{0.381414801f, 0.932483375f},
-std::array<float,2>{0.516434729f, 0.53742677f},
-std::array<float,2>{0.326317579f, 0.14767544f},
-std::array<float,2>{0.931577206f, 0.375093907f},
-std::array<float,2>{0.0140056871f, 0.81846422f},
-std::array<float,2>{0.79252702f, 0.911520779f},
-std::array<float,2>{0.132799402f, 0.34073332f},
-std::array<float,2>{0.720944107f, 0.01063825f},
-std::array<float,2>{0.433475167f, 0.740062892f},
-std::array<float,2>{0.652494729f, 0.753021896f},
-std::array<float,2>{0.478147894f, 0.468872547f},
-std::array<float,2>{0.847816467f, 0.188668534f},
-std::array<float,2>{0.242069259f, 0.599610746f},
-std::array<float,2>{0.97924906f, 0.683434129f},
-std::array<float,2>{0.122469671f, 0.102833122f},
-std::array<float,2>{0.580378175f, 0.293815374f},
-std::array<float,2>{0.302776814f, 0.955205023f},
-std::array<float,2>{0.698281109f, 0.716540635f},
-std::array<float,2>{0.400176972f, 0.0416738577f},
-std::array<float,2>{0.753017545f, 0.362677395f},
-std::array<float,2>{0.183020741f, 0.877710104f},
-std::array<float,2>{0.903020382f, 0.863775313f},
-std::array<float,2>{0.0356325433f, 0.407982826f},
-std::array<float,2>{0.552956402f, 0.185943171f},
-std::array<float,2>{0.348436713f, 0.520420611f},
-std::array<float,2>{0.608967245f, 0.992112756f},
-std::array<float,2>{0.252596915f, 0.256959558f},
-std::array<float,2>{0.95396328f, 0.0658932477f},
-std::array<float,2>{0.0849025175f, 0.650334775f},
-std::array<float,2>{0.816544235f, 0.589965999f},
-std::array<float,2>{0.212853596f, 0.230604678f},
-std::array<float,2>{0.666245222f, 0.451338142f},
-std::array<float,2>{0.462261528f, 0.792618334f},
-std::array<float,2>{0.504852653f, 0.674537241f},
-std::array<float,2>{0.340136468f, 0.0974424481f},
-std::array<float,2>{0.92034626f, 0.284775436f},
-std::array<float,2>{0.0231476352f, 0.963702381f},
-std::array<float,2>{0.80903244f, 0.758243382f},
-std::array<float,2>{0.146655306f, 0.479227066f},
-std::array<float,2>{0.739052415f, 0.1958078f},
-std::array<float,2>{0.41583693f, 0.605811357f},
-std::array<float,2>{0.633520305f, 0.917295992f},
-std::array<float,2>{0.495254397f, 0.329671115f},
-std::array<float,2>{0.867090821f, 0.00404068734f},
-std::array<float,2>{0.224006921f, 0.745378911f},
-std::array<float,2>{0.987043262f, 0.545273423f},
-std::array<float,2>{0.0994159505f, 0.148484603f},
-std::array<float,2>{0.565723956f, 0.389044195f},
-std::array<float,2>{0.283652872f, 0.82568711f},
-std::array<float,2>{0.715601623f, 0.578247309f},
-std::array<float,2>{0.377194285f, 0.224537954f},
-std::array<float,2>{0.780927479f, 0.438171536f},
-std::array<float,2>{0.157308847f, 0.788767755f},
-std::array<float,2>{0.883582354f, 0.999405921f},
-std::array<float,2>{0.0515327565f, 0.260727078f},
-std::array<float,2>{0.534241259f, 0.07180392f},
-std::array<float,2>{0.364086688f, 0.641429007f},
-std::array<float,2>{0.620029807f, 0.868560076f},
-std::array<float,2>{0.272324711f, 0.414972335f},
-std::array<float,2>{0.951059878f, 0.17421715f},
-std::array<float,2>{0.0760921612f, 0.529361665f},
-std::array<float,2>{0.832502842f, 0.707304358f},
-std::array<float,2>{0.192139179f, 0.0368997343f},
-std::array<float,2>{0.685839891f, 0.373501509f},
-std::array<float,2>{0.438720644f, 0.884103835f},
-std::array<float,2>{0.584323823f, 0.513140976f},
-std::array<float,2>{0.300424308f, 0.163781956f},
-std::array<float,2>{0.982529938f, 0.429459333f},
-std::array<float,2>{0.120347545f, 0.845097363f},
-std::array<float,2>{0.843994081f, 0.892882764f},
-std::array<float,2>{0.23600626f, 0.346953273f},
-std::array<float,2>{0.650942385f, 0.0470582694f},
-std::array<float,2>{0.483388811f, 0.694137633f},
-std::array<float,2>{0.725973725f, 0.799382985f},
-std::array<float,2>{0.43497628f, 0.465627402f},
-std::array<float,2>{0.794113696f, 0.241908535f},
-std::array<float,2>{0.126994014f, 0.572546244f},
-std::array<float,2>{0.934046149f, 0.632445633f},
-std::array<float,2>{0.00936361402f, 0.0782077461f},
-std::array<float,2>{0.522488713f, 0.273674399f},
-std::array<float,2>{0.322134227f, 0.97116822f},
-std::array<float,2>{0.668659329f, 0.723400354f},
-std::array<float,2>{0.467617273f, 0.0202212837f},
-std::array<float,2>{0.812744141f, 0.318234921f},
-std::array<float,2>{0.215647057f, 0.924154878f},
-std::array<float,2>{0.960627198f, 0.83541733f},
-std::array<float,2>{0.0808205679f, 0.398017943f},
-std::array<float,2>{0.602130115f, 0.12596105f},
-std::array<float,2>{0.255837798f, 0.557557285f},
-std::array<float,2>{0.546926081f, 0.951065004f},
-std::array<float,2>{0.346504778f, 0.29817301f},
-std::array<float,2>{0.900864065f, 0.12205223f},
-std::array<float,2>{0.0340686888f, 0.659973383f},
-std::array<float,2>{0.754583299f, 0.619032979f},
-std::array<float,2>{0.183861673f, 0.213441998f},
-std::array<float,2>{0.701800525f, 0.489283592f},
-std::array<float,2>{0.404649258f, 0.771351576f},
-std::array<float,2>{0.598720968f, 0.695595682f},
-std::array<float,2>{0.259941459f, 0.0606193244f},
-std::array<float,2>{0.964740515f, 0.355954438f},
-std::array<float,2>{0.0893561915f, 0.89924413f},
-std::array<float,2>{0.823406458f, 0.854060352f},
-std::array<float,2>{0.205243289f, 0.433628291f},
-std::array<float,2>{0.662520945f, 0.169285119f},
-std::array<float,2>{0.454885691f, 0.506230175f},
-std::array<float,2>{0.691830695f, 0.981770277f},
-std::array<float,2>{0.396251649f, 0.266425043f},
-std::array<float,2>{0.762074888f, 0.0933709741f},
-std::array<float,2>{0.173432201f, 0.638943553f},
-std::array<float,2>{0.894560337f, 0.56700784f},
-std::array<float,2>{0.044886671f, 0.246667519f},
-std::array<float,2>{0.557851076f, 0.460931271f},
-std::array<float,2>{0.3570261f, 0.81189096f},
-std::array<float,2>{0.645606935f, 0.549663246f},
-std::array<float,2>{0.471641958f, 0.137530938f},
-std::array<float,2>{0.852953076f, 0.403620839f},
-std::array<float,2>{0.249290153f, 0.838265657f},
-std::array<float,2>{0.970086455f, 0.934496105f},
-std::array<float,2>{0.114170007f, 0.323931485f},
-std::array<float,2>{0.591571629f, 0.023450993f},
-std::array<float,2>{0.3063052f, 0.728492081f},
-std::array<float,2>{0.530701578f, 0.776861608f},
-std::array<float,2>{0.313130617f, 0.49223572f},
-std::array<float,2>{0.923960567f, 0.20398213f},
-std::array<float,2>{0.00671750586f, 0.613217652f},
-std::array<float,2>{0.784129798f, 0.670178592f},
-std::array<float,2>{0.140391052f, 0.111554898f},
-std::array<float,2>{0.730112672f, 0.309206843f},
-std::array<float,2>{0.426063508f, 0.944292009f},
-std::array<float,2>{0.541646004f, 0.593751609f},
-std::array<float,2>{0.373553544f, 0.194550529f},
-std::array<float,2>{0.875081599f, 0.475948393f},
-std::array<float,2>{0.0603301786f, 0.755799711f},
-std::array<float,2>{0.773073673f, 0.957413018f},
-std::array<float,2>{0.171045616f, 0.292619497f},
-std::array<float,2>{0.707430601f, 0.108956262f},
-std::array<float,2>{0.385519743f, 0.684783101f},
-std::array<float,2>{0.677937746f, 0.815903723f},
-std::array<float,2>{0.445893973f, 0.380099893f},
-std::array<float,2>{0.83910805f, 0.141928047f},
-std::array<float,2>{0.200290367f, 0.533837676f},
-std::array<float,2>{0.937943399f, 0.734908342f},
-std::array<float,2>{0.0658111051f, 0.0119821886f},
-std::array<float,2>{0.616695285f, 0.336153477f},
-std::array<float,2>{0.278745413f, 0.90811801f},
-std::array<float,2>{0.744514823f, 0.655043423f},
-std::array<float,2>{0.413994551f, 0.067154102f},
-std::array<float,2>{0.797221601f, 0.250310004f},
-std::array<float,2>{0.150163084f, 0.985802412f},
-std::array<float,2>{0.909943998f, 0.793636739f},
-std::array<float,2>{0.0284744389f, 0.447863609f},
-std::array<float,2>{0.513167381f, 0.229302451f},
-std::array<float,2>{0.334554136f, 0.587756634f},
-std::array<float,2>{0.577906311f, 0.87917906f},
-std::array<float,2>{0.291787863f, 0.366150349f},
-std::array<float,2>{0.999032676f, 0.0442625098f},
-std::array<float,2>{0.102740161f, 0.711779475f},
-std::array<float,2>{0.870104611f, 0.516377032f},
-std::array<float,2>{0.227552325f, 0.182123914f},
-std::array<float,2>{0.627903998f, 0.411588341f},
-std::array<float,2>{0.489239275f, 0.860984325f},
-std::array<float,2>{0.525152266f, 0.704462409f},
-std::array<float,2>{0.316748053f, 0.0319352858f},
-std::array<float,2>{0.929635167f, 0.368075818f},
-std::array<float,2>{0.0026801608f, 0.890291274f},
-std::array<float,2>{0.786661386f, 0.871222198f},
-std::array<float,2>{0.133559391f, 0.420048743f},
-std::array<float,2>{0.733104765f, 0.176925883f},
-std::array<float,2>{0.422150761f, 0.526482701f},
-std::array<float,2>{0.64263767f, 0.994451761f},
-std::array<float,2>{0.474913478f, 0.265533477f},
-std::array<float,2>{0.859201312f, 0.0778645575f},
-std::array<float,2>{0.244873822f, 0.6469661f},
-std::array<float,2>{0.975779831f, 0.585310996f},
-std::array<float,2>{0.109947048f, 0.219998866f},
-std::array<float,2>{0.589689255f, 0.445264399f},
-std::array<float,2>{0.311093062f, 0.784107447f},
-std::array<float,2>{0.690943778f, 0.541734636f},
-std::array<float,2>{0.394128233f, 0.153363749f},
-std::array<float,2>{0.75836426f, 0.384087235f},
-std::array<float,2>{0.178049132f, 0.820881307f},
-std::array<float,2>{0.892449558f, 0.920594633f},
-std::array<float,2>{0.0409519225f, 0.335927546f},
-std::array<float,2>{0.561208963f, 0.000122178972f},
-std::array<float,2>{0.351647615f, 0.747630119f},
-std::array<float,2>{0.593878686f, 0.763746798f},
-std::array<float,2>{0.262270331f, 0.482955039f},
-std::array<float,2>{0.964898705f, 0.199314669f},
-std::array<float,2>{0.0903676078f, 0.602388322f},
-std::array<float,2>{0.82485038f, 0.675887167f},
-std::array<float,2>{0.208421215f, 0.101223931f},
-std::array<float,2>{0.660004199f, 0.286304981f},
-std::array<float,2>{0.460320413f, 0.967602134f},
-std::array<float,2>{0.573633432f, 0.623285294f},
-std::array<float,2>{0.293368071f, 0.218226373f},
-std::array<float,2>{0.993540764f, 0.487662256f},
-std::array<float,2>{0.105881214f, 0.767747581f},
-std::array<float,2>{0.872870386f, 0.948825836f},
-std::array<float,2>{0.234359771f, 0.301350534f},
-std::array<float,2>{0.631796002f, 0.119513363f},
-std::array<float,2>{0.484640777f, 0.663374364f},
-std::array<float,2>{0.748208284f, 0.828671217f},
-std::array<float,2>{0.409678847f, 0.392169535f},
-std::array<float,2>{0.801927805f, 0.129948348f},
-std::array<float,2>{0.153430372f, 0.561329961f},
-std::array<float,2>{0.913888335f, 0.722571313f},
-std::array<float,2>{0.0268954765f, 0.0174309742f},
-std::array<float,2>{0.509072483f, 0.314232498f},
-std::array<float,2>{0.331021667f, 0.929154813f},
-std::array<float,2>{0.675082743f, 0.625766039f},
-std::array<float,2>{0.452849776f, 0.0858178139f},
-std::array<float,2>{0.843292892f, 0.280573457f},
-std::array<float,2>{0.197220504f, 0.972965539f},
-std::array<float,2>{0.943549395f, 0.804165006f},
-std::array<float,2>{0.0689804852f, 0.463897765f},
-std::array<float,2>{0.611502469f, 0.234542936f},
-std::array<float,2>{0.27690199f, 0.577445865f},
-std::array<float,2>{0.544554532f, 0.894946277f},
-std::array<float,2>{0.369372368f, 0.351045489f},
-std::array<float,2>{0.880577624f, 0.0512453206f},
-std::array<float,2>{0.0557661541f, 0.689556897f},
-std::array<float,2>{0.769523919f, 0.510391593f},
-std::array<float,2>{0.165971279f, 0.157762542f},
-std::array<float,2>{0.703769922f, 0.423778772f},
-std::array<float,2>{0.388569683f, 0.850135863f},
-std::array<float,2>{0.621524513f, 0.664824307f},
-std::array<float,2>{0.269450545f, 0.114552349f},
-std::array<float,2>{0.945423901f, 0.306697398f},
-std::array<float,2>{0.0730723441f, 0.940796614f},
-std::array<float,2>{0.830803275f, 0.777890921f},
-std::array<float,2>{0.189137563f, 0.497483671f},
-std::array<float,2>{0.680390358f, 0.20939894f},
-std::array<float,2>{0.442136973f, 0.614062607f},
-std::array<float,2>{0.713851333f, 0.931628823f},
-std::array<float,2>{0.379724532f, 0.325834274f},
-std::array<float,2>{0.775274277f, 0.0279675238f},
-std::array<float,2>{0.163119063f, 0.731327891f},
-std::array<float,2>{0.888330221f, 0.553066313f},
-std::array<float,2>{0.0469314121f, 0.132995129f},
-std::array<float,2>{0.536228418f, 0.401577681f},
-std::array<float,2>{0.361430198f, 0.840563476f},
-std::array<float,2>{0.638669074f, 0.56574589f},
-std::array<float,2>{0.499939233f, 0.24593538f},
-std::array<float,2>{0.859983504f, 0.456700206f},
-std::array<float,2>{0.221793309f, 0.806991577f},
-std::array<float,2>{0.989397526f, 0.977666199f},
-std::array<float,2>{0.0961899981f, 0.271063477f},
-std::array<float,2>{0.566826105f, 0.0864908099f},
-std::array<float,2>{0.288950443f, 0.635453403f},
-std::array<float,2>{0.503707945f, 0.857505918f},
-std::array<float,2>{0.3375462f, 0.430994093f},
-std::array<float,2>{0.914751887f, 0.167129695f},
-std::array<float,2>{0.0165221877f, 0.503168464f},
-std::array<float,2>{0.805484295f, 0.699798942f},
-std::array<float,2>{0.143094629f, 0.0564035252f},
-std::array<float,2>{0.73720628f, 0.355246663f},
-std::array<float,2>{0.421168476f, 0.905161858f},
-std::array<float,2>{0.551995754f, 0.521822631f},
-std::array<float,2>{0.350970715f, 0.184894264f},
-std::array<float,2>{0.905001044f, 0.408605158f},
-std::array<float,2>{0.0378082432f, 0.865391552f},
-std::array<float,2>{0.750164092f, 0.875180423f},
-std::array<float,2>{0.18061991f, 0.360266834f},
-std::array<float,2>{0.696195006f, 0.0398897938f},
-std::array<float,2>{0.401231527f, 0.718386173f},
-std::array<float,2>{0.664303839f, 0.790794134f},
-std::array<float,2>{0.463995278f, 0.449252784f},
-std::array<float,2>{0.819155097f, 0.234002143f},
-std::array<float,2>{0.213348597f, 0.592906594f},
-std::array<float,2>{0.955775678f, 0.651442111f},
-std::array<float,2>{0.0832294226f, 0.0635940656f},
-std::array<float,2>{0.607314646f, 0.254384369f},
-std::array<float,2>{0.250237316f, 0.990219474f},
-std::array<float,2>{0.719422996f, 0.740464807f},
-std::array<float,2>{0.429830045f, 0.00861598831f},
-std::array<float,2>{0.789897203f, 0.341990322f},
-std::array<float,2>{0.129180729f, 0.913051128f},
-std::array<float,2>{0.932762325f, 0.817787886f},
-std::array<float,2>{0.0122485021f, 0.378671527f},
-std::array<float,2>{0.519466281f, 0.145818502f},
-std::array<float,2>{0.325919688f, 0.535802603f},
-std::array<float,2>{0.578830421f, 0.954493046f},
-std::array<float,2>{0.301535755f, 0.295478523f},
-std::array<float,2>{0.976663947f, 0.104720809f},
-std::array<float,2>{0.123554729f, 0.68058002f},
-std::array<float,2>{0.849825263f, 0.599104524f},
-std::array<float,2>{0.239988029f, 0.189947799f},
-std::array<float,2>{0.654811382f, 0.470819265f},
-std::array<float,2>{0.480192214f, 0.750635445f},
-std::array<float,2>{0.532736778f, 0.64338094f},
-std::array<float,2>{0.366913646f, 0.0724422708f},
-std::array<float,2>{0.885034859f, 0.258283794f},
-std::array<float,2>{0.0532691889f, 0.997153699f},
-std::array<float,2>{0.777595222f, 0.786182046f},
-std::array<float,2>{0.158418894f, 0.440558285f},
-std::array<float,2>{0.718542218f, 0.225405708f},
-std::array<float,2>{0.375645399f, 0.580755055f},
-std::array<float,2>{0.685341358f, 0.886408806f},
-std::array<float,2>{0.43952781f, 0.372704148f},
-std::array<float,2>{0.834830225f, 0.0388108492f},
-std::array<float,2>{0.194300726f, 0.709063768f},
-std::array<float,2>{0.951726139f, 0.527676761f},
-std::array<float,2>{0.0771030411f, 0.171941623f},
-std::array<float,2>{0.619063258f, 0.417902142f},
-std::array<float,2>{0.27112183f, 0.869160295f},
-std::array<float,2>{0.742014289f, 0.60814321f},
-std::array<float,2>{0.416680545f, 0.198975444f},
-std::array<float,2>{0.810601115f, 0.477765262f},
-std::array<float,2>{0.145251274f, 0.761614084f},
-std::array<float,2>{0.91929239f, 0.962522328f},
-std::array<float,2>{0.019779684f, 0.282070458f},
-std::array<float,2>{0.507777035f, 0.094585225f},
-std::array<float,2>{0.341962099f, 0.672336161f},
-std::array<float,2>{0.564426422f, 0.827609539f},
-std::array<float,2>{0.282416165f, 0.388653398f},
-std::array<float,2>{0.985684097f, 0.151067868f},
-std::array<float,2>{0.100152835f, 0.543498099f},
-std::array<float,2>{0.864944518f, 0.743230164f},
-std::array<float,2>{0.225349262f, 0.00709443958f},
-std::array<float,2>{0.635054171f, 0.330949724f},
-std::array<float,2>{0.494126469f, 0.914731801f},
-std::array<float,2>{0.60469532f, 0.555094361f},
-std::array<float,2>{0.256628186f, 0.127654493f},
-std::array<float,2>{0.95882082f, 0.396434724f},
-std::array<float,2>{0.0781278685f, 0.832613051f},
-std::array<float,2>{0.815278649f, 0.922275782f},
-std::array<float,2>{0.218495056f, 0.318948627f},
-std::array<float,2>{0.670385659f, 0.0223832261f},
-std::array<float,2>{0.46561268f, 0.725385547f},
-std::array<float,2>{0.70104152f, 0.77320379f},
-std::array<float,2>{0.403690428f, 0.491060555f},
-std::array<float,2>{0.756725788f, 0.211571664f},
-std::array<float,2>{0.18586044f, 0.620673835f},
-std::array<float,2>{0.898989916f, 0.65671742f},
-std::array<float,2>{0.0317195244f, 0.123480409f},
-std::array<float,2>{0.550537407f, 0.300137013f},
-std::array<float,2>{0.344100893f, 0.952914596f},
-std::array<float,2>{0.648878694f, 0.693337202f},
-std::array<float,2>{0.480832666f, 0.0489119031f},
-std::array<float,2>{0.847636878f, 0.344058305f},
-std::array<float,2>{0.236527458f, 0.890875638f},
-std::array<float,2>{0.981859088f, 0.847603321f},
-std::array<float,2>{0.118758269f, 0.426642954f},
-std::array<float,2>{0.583481014f, 0.161604911f},
-std::array<float,2>{0.298165023f, 0.515010476f},
-std::array<float,2>{0.520978749f, 0.970380425f},
-std::array<float,2>{0.323966384f, 0.275941491f},
-std::array<float,2>{0.936234117f, 0.081698142f},
-std::array<float,2>{0.0100446614f, 0.630056977f},
-std::array<float,2>{0.795384705f, 0.570722997f},
-std::array<float,2>{0.125278383f, 0.240159407f},
-std::array<float,2>{0.722708404f, 0.468663484f},
-std::array<float,2>{0.437428534f, 0.797641635f},
-std::array<float,2>{0.592376828f, 0.728728116f},
-std::array<float,2>{0.306732506f, 0.0262566395f},
-std::array<float,2>{0.972490191f, 0.320368111f},
-std::array<float,2>{0.115871385f, 0.937169969f},
-std::array<float,2>{0.855246902f, 0.837600946f},
-std::array<float,2>{0.24705185f, 0.405005664f},
-std::array<float,2>{0.646598339f, 0.139419645f},
-std::array<float,2>{0.469200492f, 0.548015952f},
-std::array<float,2>{0.727776825f, 0.941867471f},
-std::array<float,2>{0.428165108f, 0.312277794f},
-std::array<float,2>{0.782699585f, 0.109563172f},
-std::array<float,2>{0.137647137f, 0.669384181f},
-std::array<float,2>{0.922147572f, 0.609753907f},
-std::array<float,2>{0.00504451338f, 0.20615992f},
-std::array<float,2>{0.528779268f, 0.495750725f},
-std::array<float,2>{0.314621985f, 0.77385509f},
-std::array<float,2>{0.660777688f, 0.503908277f},
-std::array<float,2>{0.45654884f, 0.170137346f},
-std::array<float,2>{0.820403576f, 0.436516285f},
-std::array<float,2>{0.203965828f, 0.85170579f},
-std::array<float,2>{0.961895704f, 0.901380658f},
-std::array<float,2>{0.086617589f, 0.358415008f},
-std::array<float,2>{0.599613488f, 0.0591454804f},
-std::array<float,2>{0.259242892f, 0.698443949f},
-std::array<float,2>{0.55642736f, 0.810207725f},
-std::array<float,2>{0.358704448f, 0.458031416f},
-std::array<float,2>{0.89833051f, 0.24951601f},
-std::array<float,2>{0.04612533f, 0.569364071f},
-std::array<float,2>{0.765624642f, 0.636791468f},
-std::array<float,2>{0.175071761f, 0.0905326158f},
-std::array<float,2>{0.6945979f, 0.268647194f},
-std::array<float,2>{0.397178262f, 0.982994199f},
-std::array<float,2>{0.514581859f, 0.589756668f},
-std::array<float,2>{0.332084f, 0.227666497f},
-std::array<float,2>{0.906632304f, 0.447023332f},
-std::array<float,2>{0.0309085008f, 0.795437574f},
-std::array<float,2>{0.798932433f, 0.987904906f},
-std::array<float,2>{0.150934502f, 0.252607673f},
-std::array<float,2>{0.742484391f, 0.0690418109f},
-std::array<float,2>{0.410274029f, 0.652852714f},
-std::array<float,2>{0.625513971f, 0.86199075f},
-std::array<float,2>{0.492113322f, 0.412767649f},
-std::array<float,2>{0.867544472f, 0.18005012f},
-std::array<float,2>{0.229142636f, 0.518137217f},
-std::array<float,2>{0.996730864f, 0.714637041f},
-std::array<float,2>{0.105177693f, 0.0456098691f},
-std::array<float,2>{0.575480998f, 0.365156412f},
-std::array<float,2>{0.2898871f, 0.88255316f},
-std::array<float,2>{0.710286498f, 0.686560929f},
-std::array<float,2>{0.384349883f, 0.105765425f},
-std::array<float,2>{0.771380961f, 0.289454103f},
-std::array<float,2>{0.168388903f, 0.960004628f},
-std::array<float,2>{0.877499461f, 0.755992413f},
-std::array<float,2>{0.0613954701f, 0.473901302f},
-std::array<float,2>{0.540267944f, 0.192560375f},
-std::array<float,2>{0.372131735f, 0.596047819f},
-std::array<float,2>{0.613407731f, 0.908694804f},
-std::array<float,2>{0.279999793f, 0.338028163f},
-std::array<float,2>{0.940077305f, 0.0139724799f},
-std::array<float,2>{0.0625552759f, 0.737525463f},
-std::array<float,2>{0.837834895f, 0.531981826f},
-std::array<float,2>{0.202985823f, 0.142789394f},
-std::array<float,2>{0.677266777f, 0.381073415f},
-std::array<float,2>{0.449215174f, 0.814168513f},
-std::array<float,2>{0.518918037f, 0.739406407f},
-std::array<float,2>{0.325303465f, 0.00976845529f},
-std::array<float,2>{0.933551252f, 0.340260953f},
-std::array<float,2>{0.0120278867f, 0.911916673f},
-std::array<float,2>{0.789390862f, 0.819240272f},
-std::array<float,2>{0.129770622f, 0.37558639f},
-std::array<float,2>{0.718918622f, 0.148080349f},
-std::array<float,2>{0.430216253f, 0.537998617f},
-std::array<float,2>{0.654607713f, 0.955854297f},
-std::array<float,2>{0.479935169f, 0.293341547f},
-std::array<float,2>{0.850533426f, 0.103291512f},
-std::array<float,2>{0.239399508f, 0.682669163f},
-std::array<float,2>{0.977109194f, 0.600570381f},
-std::array<float,2>{0.123272061f, 0.189398348f},
-std::array<float,2>{0.57851845f, 0.46950841f},
-std::array<float,2>{0.30109489f, 0.753475785f},
-std::array<float,2>{0.695627272f, 0.519896328f},
-std::array<float,2>{0.400507629f, 0.186411142f},
-std::array<float,2>{0.750555336f, 0.407538235f},
-std::array<float,2>{0.180035725f, 0.863405704f},
-std::array<float,2>{0.904377103f, 0.877396345f},
-std::array<float,2>{0.0372513905f, 0.363018662f},
-std::array<float,2>{0.552506804f, 0.0413296185f},
-std::array<float,2>{0.351515234f, 0.716302037f},
-std::array<float,2>{0.606729746f, 0.792383671f},
-std::array<float,2>{0.250872463f, 0.451741785f},
-std::array<float,2>{0.955299318f, 0.23119694f},
-std::array<float,2>{0.0837908909f, 0.590744793f},
-std::array<float,2>{0.818437517f, 0.649814963f},
-std::array<float,2>{0.213422701f, 0.0663712472f},
-std::array<float,2>{0.664638698f, 0.257554829f},
-std::array<float,2>{0.464574248f, 0.991307795f},
-std::array<float,2>{0.567255974f, 0.562753737f},
-std::array<float,2>{0.288405806f, 0.242910668f},
-std::array<float,2>{0.990107596f, 0.453994125f},
-std::array<float,2>{0.0961951464f, 0.804955244f},
-std::array<float,2>{0.859834552f, 0.979647279f},
-std::array<float,2>{0.222183973f, 0.27161327f},
-std::array<float,2>{0.637726188f, 0.0882502198f},
-std::array<float,2>{0.499124229f, 0.633948863f},
-std::array<float,2>{0.736635923f, 0.856434464f},
-std::array<float,2>{0.421661168f, 0.432784855f},
-std::array<float,2>{0.805091619f, 0.165200025f},
-std::array<float,2>{0.142751932f, 0.500276208f},
-std::array<float,2>{0.914468229f, 0.701244891f},
-std::array<float,2>{0.0159559865f, 0.0579957813f},
-std::array<float,2>{0.503269553f, 0.352645934f},
-std::array<float,2>{0.337054074f, 0.902526677f},
-std::array<float,2>{0.679708004f, 0.66765666f},
-std::array<float,2>{0.441695154f, 0.115931056f},
-std::array<float,2>{0.830413043f, 0.306637615f},
-std::array<float,2>{0.188903406f, 0.938389301f},
-std::array<float,2>{0.946059287f, 0.78062433f},
-std::array<float,2>{0.0724765211f, 0.499542415f},
-std::array<float,2>{0.621842086f, 0.208519787f},
-std::array<float,2>{0.268746585f, 0.616087735f},
-std::array<float,2>{0.537091672f, 0.932076991f},
-std::array<float,2>{0.362276167f, 0.327485323f},
-std::array<float,2>{0.887824655f, 0.0297661778f},
-std::array<float,2>{0.0475921929f, 0.732814014f},
-std::array<float,2>{0.774842322f, 0.552051842f},
-std::array<float,2>{0.164001361f, 0.135258645f},
-std::array<float,2>{0.713201702f, 0.398940444f},
-std::array<float,2>{0.379361957f, 0.842970908f},
-std::array<float,2>{0.612213314f, 0.627001047f},
-std::array<float,2>{0.276845932f, 0.0837990269f},
-std::array<float,2>{0.944232166f, 0.279268175f},
-std::array<float,2>{0.0688216016f, 0.975187898f},
-std::array<float,2>{0.843187571f, 0.801564634f},
-std::array<float,2>{0.196509033f, 0.46261254f},
-std::array<float,2>{0.675313711f, 0.238223985f},
-std::array<float,2>{0.45261246f, 0.575635552f},
-std::array<float,2>{0.703509569f, 0.897164345f},
-std::array<float,2>{0.387997389f, 0.349418879f},
-std::array<float,2>{0.769031227f, 0.0531619973f},
-std::array<float,2>{0.165166944f, 0.688082218f},
-std::array<float,2>{0.880366683f, 0.508064032f},
-std::array<float,2>{0.0562558137f, 0.159459963f},
-std::array<float,2>{0.544340611f, 0.425043106f},
-std::array<float,2>{0.3697218f, 0.847811759f},
-std::array<float,2>{0.631177366f, 0.621387064f},
-std::array<float,2>{0.484944522f, 0.216281548f},
-std::array<float,2>{0.872535348f, 0.485531896f},
-std::array<float,2>{0.233579352f, 0.766211808f},
-std::array<float,2>{0.993730783f, 0.946804106f},
-std::array<float,2>{0.106383584f, 0.304029703f},
-std::array<float,2>{0.574012399f, 0.117404938f},
-std::array<float,2>{0.293571055f, 0.660250306f},
-std::array<float,2>{0.509319425f, 0.831593633f},
-std::array<float,2>{0.330133885f, 0.393688262f},
-std::array<float,2>{0.913561642f, 0.132674247f},
-std::array<float,2>{0.0266818851f, 0.559197485f},
-std::array<float,2>{0.802355766f, 0.720661163f},
-std::array<float,2>{0.15396294f, 0.0191212203f},
-std::array<float,2>{0.749010742f, 0.315456182f},
-std::array<float,2>{0.409400851f, 0.927360654f},
-std::array<float,2>{0.560787022f, 0.539970279f},
-std::array<float,2>{0.352216065f, 0.154299676f},
-std::array<float,2>{0.891947329f, 0.385334671f},
-std::array<float,2>{0.0401978455f, 0.822423041f},
-std::array<float,2>{0.758020639f, 0.919252932f},
-std::array<float,2>{0.178346202f, 0.333893657f},
-std::array<float,2>{0.690482914f, 0.00338758482f},
-std::array<float,2>{0.393591046f, 0.748208106f},
-std::array<float,2>{0.659540892f, 0.762916446f},
-std::array<float,2>{0.460747004f, 0.482065231f},
-std::array<float,2>{0.824273884f, 0.202216879f},
-std::array<float,2>{0.208946586f, 0.605079353f},
-std::array<float,2>{0.965595305f, 0.67843622f},
-std::array<float,2>{0.0902393684f, 0.0982563645f},
-std::array<float,2>{0.594674408f, 0.288591057f},
-std::array<float,2>{0.262040675f, 0.966220438f},
-std::array<float,2>{0.732693374f, 0.706511378f},
-std::array<float,2>{0.422402501f, 0.0336362459f},
-std::array<float,2>{0.786442518f, 0.369785339f},
-std::array<float,2>{0.132952884f, 0.887727618f},
-std::array<float,2>{0.928906739f, 0.87449342f},
-std::array<float,2>{0.002341541f, 0.419025302f},
-std::array<float,2>{0.524760306f, 0.177859545f},
-std::array<float,2>{0.317239463f, 0.524084866f},
-std::array<float,2>{0.589326143f, 0.992986619f},
-std::array<float,2>{0.310967207f, 0.263520896f},
-std::array<float,2>{0.976440787f, 0.0747681558f},
-std::array<float,2>{0.109513268f, 0.646066606f},
-std::array<float,2>{0.858675063f, 0.582730949f},
-std::array<float,2>{0.244226724f, 0.22113359f},
-std::array<float,2>{0.643236816f, 0.441862851f},
-std::array<float,2>{0.475501597f, 0.781953692f},
-std::array<float,2>{0.540830612f, 0.685361922f},
-std::array<float,2>{0.372908682f, 0.108604528f},
-std::array<float,2>{0.877404749f, 0.292457372f},
-std::array<float,2>{0.0609866828f, 0.957671106f},
-std::array<float,2>{0.770891368f, 0.75509727f},
-std::array<float,2>{0.168926001f, 0.476267189f},
-std::array<float,2>{0.710930467f, 0.19487004f},
-std::array<float,2>{0.383805543f, 0.594688118f},
-std::array<float,2>{0.677238226f, 0.907355666f},
-std::array<float,2>{0.448358029f, 0.336826801f},
-std::array<float,2>{0.836974978f, 0.012607621f},
-std::array<float,2>{0.202290699f, 0.734821081f},
-std::array<float,2>{0.939616442f, 0.533326447f},
-std::array<float,2>{0.0630298182f, 0.142302871f},
-std::array<float,2>{0.613881767f, 0.380556405f},
-std::array<float,2>{0.279364496f, 0.816045761f},
-std::array<float,2>{0.742743313f, 0.587080002f},
-std::array<float,2>{0.410786867f, 0.228539437f},
-std::array<float,2>{0.799564481f, 0.447611451f},
-std::array<float,2>{0.150850356f, 0.793369472f},
-std::array<float,2>{0.906862319f, 0.986309588f},
-std::array<float,2>{0.0306404866f, 0.250940084f},
-std::array<float,2>{0.513770521f, 0.0667931363f},
-std::array<float,2>{0.332888305f, 0.654466689f},
-std::array<float,2>{0.57576853f, 0.860408247f},
-std::array<float,2>{0.289089561f, 0.4117544f},
-std::array<float,2>{0.996565163f, 0.182405308f},
-std::array<float,2>{0.104706489f, 0.515723646f},
-std::array<float,2>{0.868152559f, 0.710967004f},
-std::array<float,2>{0.22897847f, 0.0446838886f},
-std::array<float,2>{0.625456631f, 0.365347028f},
-std::array<float,2>{0.491692513f, 0.879711688f},
-std::array<float,2>{0.600510001f, 0.506501675f},
-std::array<float,2>{0.259616345f, 0.169740349f},
-std::array<float,2>{0.961184084f, 0.434525043f},
-std::array<float,2>{0.0859631673f, 0.85389632f},
-std::array<float,2>{0.820979714f, 0.898865342f},
-std::array<float,2>{0.203152001f, 0.356269747f},
-std::array<float,2>{0.660441697f, 0.0613501891f},
-std::array<float,2>{0.45652768f, 0.696105719f},
-std::array<float,2>{0.695153415f, 0.812266827f},
-std::array<float,2>{0.396517217f, 0.460342407f},
-std::array<float,2>{0.764993548f, 0.246449962f},
-std::array<float,2>{0.175740674f, 0.566734612f},
-std::array<float,2>{0.897821963f, 0.639597952f},
-std::array<float,2>{0.0468221456f, 0.0928826481f},
-std::array<float,2>{0.555995584f, 0.265687138f},
-std::array<float,2>{0.359217286f, 0.982240438f},
-std::array<float,2>{0.647446513f, 0.727957308f},
-std::array<float,2>{0.469286263f, 0.0239385664f},
-std::array<float,2>{0.854885161f, 0.323317975f},
-std::array<float,2>{0.246226311f, 0.933900535f},
-std::array<float,2>{0.971957326f, 0.838615239f},
-std::array<float,2>{0.115248628f, 0.4039433f},
-std::array<float,2>{0.592103124f, 0.136972025f},
-std::array<float,2>{0.307133526f, 0.548967838f},
-std::array<float,2>{0.529192209f, 0.943613231f},
-std::array<float,2>{0.315086335f, 0.308643132f},
-std::array<float,2>{0.922552288f, 0.111910649f},
-std::array<float,2>{0.0055088033f, 0.670836091f},
-std::array<float,2>{0.782977402f, 0.612739146f},
-std::array<float,2>{0.137077555f, 0.203178212f},
-std::array<float,2>{0.728160679f, 0.492711425f},
-std::array<float,2>{0.42824921f, 0.776553333f},
-std::array<float,2>{0.583862662f, 0.693654239f},
-std::array<float,2>{0.298807234f, 0.0476308241f},
-std::array<float,2>{0.98202002f, 0.3472386f},
-std::array<float,2>{0.118183352f, 0.893089235f},
-std::array<float,2>{0.847084403f, 0.845683336f},
-std::array<float,2>{0.236967862f, 0.428756863f},
-std::array<float,2>{0.649377346f, 0.163302854f},
-std::array<float,2>{0.481149524f, 0.513452113f},
-std::array<float,2>{0.72316134f, 0.971346378f},
-std::array<float,2>{0.436856925f, 0.273986548f},
-std::array<float,2>{0.795537949f, 0.0786244497f},
-std::array<float,2>{0.125894576f, 0.632078707f},
-std::array<float,2>{0.935905814f, 0.573200405f},
-std::array<float,2>{0.0103572104f, 0.241258875f},
-std::array<float,2>{0.521026373f, 0.465135932f},
-std::array<float,2>{0.323413014f, 0.799196064f},
-std::array<float,2>{0.670505404f, 0.556782186f},
-std::array<float,2>{0.465284228f, 0.125405908f},
-std::array<float,2>{0.814599454f, 0.39790228f},
-std::array<float,2>{0.217917204f, 0.835621476f},
-std::array<float,2>{0.95814997f, 0.924709916f},
-std::array<float,2>{0.0790328309f, 0.317834318f},
-std::array<float,2>{0.605099082f, 0.0195463467f},
-std::array<float,2>{0.256164819f, 0.723105133f},
-std::array<float,2>{0.549947441f, 0.770787716f},
-std::array<float,2>{0.344624013f, 0.490120679f},
-std::array<float,2>{0.898539782f, 0.212952375f},
-std::array<float,2>{0.0321890973f, 0.618619859f},
-std::array<float,2>{0.755944073f, 0.659316003f},
-std::array<float,2>{0.186446488f, 0.121133506f},
-std::array<float,2>{0.700571418f, 0.298438847f},
-std::array<float,2>{0.403840303f, 0.950213611f},
-std::array<float,2>{0.507116497f, 0.606044233f},
-std::array<float,2>{0.342720658f, 0.195800096f},
-std::array<float,2>{0.919567108f, 0.478724867f},
-std::array<float,2>{0.0202200133f, 0.758329093f},
-std::array<float,2>{0.811447144f, 0.963320017f},
-std::array<float,2>{0.144979134f, 0.284353584f},
-std::array<float,2>{0.741522491f, 0.0971041992f},
-std::array<float,2>{0.416157395f, 0.674218118f},
-std::array<float,2>{0.635424793f, 0.825369596f},
-std::array<float,2>{0.493237019f, 0.389633507f},
-std::array<float,2>{0.864389241f, 0.149082616f},
-std::array<float,2>{0.224704295f, 0.545885265f},
-std::array<float,2>{0.986281037f, 0.746036887f},
-std::array<float,2>{0.0998059884f, 0.0046712039f},
-std::array<float,2>{0.56354785f, 0.329157025f},
-std::array<float,2>{0.282899857f, 0.917673528f},
-std::array<float,2>{0.718121886f, 0.640947223f},
-std::array<float,2>{0.375022322f, 0.0715306699f},
-std::array<float,2>{0.777860999f, 0.259856761f},
-std::array<float,2>{0.159173235f, 0.999925852f},
-std::array<float,2>{0.885608315f, 0.788502097f},
-std::array<float,2>{0.0529941805f, 0.437603742f},
-std::array<float,2>{0.532684684f, 0.223830357f},
-std::array<float,2>{0.366523296f, 0.578739822f},
-std::array<float,2>{0.618536413f, 0.884595215f},
-std::array<float,2>{0.270792872f, 0.37373209f},
-std::array<float,2>{0.951581776f, 0.0364445187f},
-std::array<float,2>{0.0764411017f, 0.707676172f},
-std::array<float,2>{0.834226012f, 0.529966474f},
-std::array<float,2>{0.193800271f, 0.174689561f},
-std::array<float,2>{0.684646428f, 0.414243519f},
-std::array<float,2>{0.440369129f, 0.869114339f},
-std::array<float,2>{0.55345875f, 0.717896819f},
-std::array<float,2>{0.347850412f, 0.0393499173f},
-std::array<float,2>{0.902487934f, 0.359568208f},
-std::array<float,2>{0.0358115882f, 0.875654876f},
-std::array<float,2>{0.753570855f, 0.866115093f},
-std::array<float,2>{0.183384314f, 0.409017682f},
-std::array<float,2>{0.698974311f, 0.185424328f},
-std::array<float,2>{0.399650097f, 0.522178471f},
-std::array<float,2>{0.666768491f, 0.989336252f},
-std::array<float,2>{0.462490022f, 0.254441917f},
-std::array<float,2>{0.817188144f, 0.0640961379f},
-std::array<float,2>{0.212146178f, 0.652333021f},
-std::array<float,2>{0.953590751f, 0.593380988f},
-std::array<float,2>{0.0842408091f, 0.233532906f},
-std::array<float,2>{0.608440638f, 0.449852109f},
-std::array<float,2>{0.252389669f, 0.790395677f},
-std::array<float,2>{0.721337616f, 0.535608053f},
-std::array<float,2>{0.432910293f, 0.146314517f},
-std::array<float,2>{0.792399943f, 0.377939492f},
-std::array<float,2>{0.132011801f, 0.818332851f},
-std::array<float,2>{0.931134284f, 0.912386954f},
-std::array<float,2>{0.0142563628f, 0.342638254f},
-std::array<float,2>{0.515954733f, 0.00812014192f},
-std::array<float,2>{0.326820791f, 0.740927815f},
-std::array<float,2>{0.58089757f, 0.750212312f},
-std::array<float,2>{0.30333665f, 0.471341938f},
-std::array<float,2>{0.978820264f, 0.189622611f},
-std::array<float,2>{0.122902855f, 0.599244058f},
-std::array<float,2>{0.848605692f, 0.679934502f},
-std::array<float,2>{0.241446108f, 0.105017602f},
-std::array<float,2>{0.653238714f, 0.295324922f},
-std::array<float,2>{0.477712154f, 0.954791188f},
-std::array<float,2>{0.624693513f, 0.613525569f},
-std::array<float,2>{0.266790301f, 0.209592983f},
-std::array<float,2>{0.948518753f, 0.49757427f},
-std::array<float,2>{0.0710692927f, 0.777800679f},
-std::array<float,2>{0.830009282f, 0.941322148f},
-std::array<float,2>{0.190963238f, 0.307130784f},
-std::array<float,2>{0.681763172f, 0.11485301f},
-std::array<float,2>{0.444902569f, 0.664336979f},
-std::array<float,2>{0.711395442f, 0.840124786f},
-std::array<float,2>{0.381259918f, 0.402028233f},
-std::array<float,2>{0.776087105f, 0.133728117f},
-std::array<float,2>{0.161627442f, 0.553659022f},
-std::array<float,2>{0.889148355f, 0.730486035f},
-std::array<float,2>{0.0498858951f, 0.0277953967f},
-std::array<float,2>{0.538318098f, 0.325651258f},
-std::array<float,2>{0.360924274f, 0.930752158f},
-std::array<float,2>{0.63900888f, 0.635168493f},
-std::array<float,2>{0.49639675f, 0.0862074494f},
-std::array<float,2>{0.863047183f, 0.270594686f},
-std::array<float,2>{0.219077095f, 0.978243709f},
-std::array<float,2>{0.990537345f, 0.807496905f},
-std::array<float,2>{0.0939506516f, 0.456405014f},
-std::array<float,2>{0.569162846f, 0.245603964f},
-std::array<float,2>{0.285360515f, 0.56629324f},
-std::array<float,2>{0.500580728f, 0.90464294f},
-std::array<float,2>{0.339535564f, 0.354551256f},
-std::array<float,2>{0.916072071f, 0.0560953692f},
-std::array<float,2>{0.0186053067f, 0.699556708f},
-std::array<float,2>{0.808033407f, 0.503423214f},
-std::array<float,2>{0.140761867f, 0.167608634f},
-std::array<float,2>{0.735406458f, 0.431463301f},
-std::array<float,2>{0.419076741f, 0.858153105f},
-std::array<float,2>{0.571186364f, 0.6636163f},
-std::array<float,2>{0.295932949f, 0.119797736f},
-std::array<float,2>{0.994862139f, 0.301256508f},
-std::array<float,2>{0.108323127f, 0.948425889f},
-std::array<float,2>{0.87322396f, 0.768191993f},
-std::array<float,2>{0.23198387f, 0.487961233f},
-std::array<float,2>{0.630278111f, 0.218486473f},
-std::array<float,2>{0.486389488f, 0.623903811f},
-std::array<float,2>{0.746648312f, 0.929642022f},
-std::array<float,2>{0.407726407f, 0.313714445f},
-std::array<float,2>{0.802810192f, 0.0170338452f},
-std::array<float,2>{0.156024918f, 0.721951365f},
-std::array<float,2>{0.911026299f, 0.560865164f},
-std::array<float,2>{0.0241196528f, 0.130454287f},
-std::array<float,2>{0.511395454f, 0.391854376f},
-std::array<float,2>{0.330069393f, 0.828434765f},
-std::array<float,2>{0.672518075f, 0.577992618f},
-std::array<float,2>{0.451075941f, 0.235113591f},
-std::array<float,2>{0.840718985f, 0.464787304f},
-std::array<float,2>{0.197272599f, 0.804526031f},
-std::array<float,2>{0.942426264f, 0.97345376f},
-std::array<float,2>{0.0665714368f, 0.280771732f},
-std::array<float,2>{0.609981775f, 0.0850366578f},
-std::array<float,2>{0.273588836f, 0.625458539f},
-std::array<float,2>{0.546163499f, 0.849761009f},
-std::array<float,2>{0.369119167f, 0.423060566f},
-std::array<float,2>{0.882403314f, 0.157274649f},
-std::array<float,2>{0.0582135022f, 0.509867609f},
-std::array<float,2>{0.766217828f, 0.690337539f},
-std::array<float,2>{0.166891322f, 0.0513107702f},
-std::array<float,2>{0.706460714f, 0.351077616f},
-std::array<float,2>{0.389604717f, 0.89508456f},
-std::array<float,2>{0.525694728f, 0.52700907f},
-std::array<float,2>{0.31919843f, 0.177652821f},
-std::array<float,2>{0.927516103f, 0.420738429f},
-std::array<float,2>{0.000589752977f, 0.872039735f},
-std::array<float,2>{0.788635552f, 0.889894009f},
-std::array<float,2>{0.135047808f, 0.367562979f},
-std::array<float,2>{0.731124163f, 0.0314285904f},
-std::array<float,2>{0.425489157f, 0.704687536f},
-std::array<float,2>{0.641388953f, 0.783273041f},
-std::array<float,2>{0.472729832f, 0.444750637f},
-std::array<float,2>{0.856210768f, 0.220327601f},
-std::array<float,2>{0.244076714f, 0.585923076f},
-std::array<float,2>{0.974284708f, 0.64721024f},
-std::array<float,2>{0.112391181f, 0.0774405822f},
-std::array<float,2>{0.58778286f, 0.264767557f},
-std::array<float,2>{0.310463935f, 0.994702578f},
-std::array<float,2>{0.68839407f, 0.74712342f},
-std::array<float,2>{0.390775979f, 0.000788576785f},
-std::array<float,2>{0.760691345f, 0.33544606f},
-std::array<float,2>{0.177143708f, 0.919946671f},
-std::array<float,2>{0.893749416f, 0.820692718f},
-std::array<float,2>{0.0418803878f, 0.384528697f},
-std::array<float,2>{0.560492277f, 0.15418008f},
-std::array<float,2>{0.355072528f, 0.541049004f},
-std::array<float,2>{0.596356273f, 0.967007101f},
-std::array<float,2>{0.264341652f, 0.286828816f},
-std::array<float,2>{0.968549967f, 0.100837417f},
-std::array<float,2>{0.0919959545f, 0.676478326f},
-std::array<float,2>{0.826763272f, 0.601809621f},
-std::array<float,2>{0.209438652f, 0.200138509f},
-std::array<float,2>{0.658162236f, 0.482440323f},
-std::array<float,2>{0.45729965f, 0.76457274f},
-std::array<float,2>{0.51327163f, 0.652408123f},
-std::array<float,2>{0.333998621f, 0.0686998591f},
-std::array<float,2>{0.909211695f, 0.252413869f},
-std::array<float,2>{0.0289727431f, 0.987460315f},
-std::array<float,2>{0.797712028f, 0.795312881f},
-std::array<float,2>{0.149605453f, 0.446757883f},
-std::array<float,2>{0.744657457f, 0.228492007f},
-std::array<float,2>{0.413238108f, 0.589113235f},
-std::array<float,2>{0.627304494f, 0.882100642f},
-std::array<float,2>{0.48849681f, 0.364581525f},
-std::array<float,2>{0.869573236f, 0.0450518951f},
-std::array<float,2>{0.22816287f, 0.713998139f},
-std::array<float,2>{0.999644995f, 0.5176211f},
-std::array<float,2>{0.103411809f, 0.180579916f},
-std::array<float,2>{0.577314317f, 0.412213355f},
-std::array<float,2>{0.291475058f, 0.861373901f},
-std::array<float,2>{0.707688153f, 0.596591592f},
-std::array<float,2>{0.385242611f, 0.193235636f},
-std::array<float,2>{0.772462308f, 0.474535137f},
-std::array<float,2>{0.171665117f, 0.756716609f},
-std::array<float,2>{0.875942767f, 0.960605562f},
-std::array<float,2>{0.0598418117f, 0.289932013f},
-std::array<float,2>{0.541389346f, 0.106422581f},
-std::array<float,2>{0.373229593f, 0.687187195f},
-std::array<float,2>{0.616945446f, 0.813571215f},
-std::array<float,2>{0.279133022f, 0.381394029f},
-std::array<float,2>{0.938055933f, 0.143504128f},
-std::array<float,2>{0.0662215874f, 0.531367362f},
-std::array<float,2>{0.839743316f, 0.738115311f},
-std::array<float,2>{0.200813144f, 0.0144235268f},
-std::array<float,2>{0.678631485f, 0.338529348f},
-std::array<float,2>{0.445545852f, 0.908501685f},
-std::array<float,2>{0.591115832f, 0.548560023f},
-std::array<float,2>{0.305711508f, 0.139047042f},
-std::array<float,2>{0.970465541f, 0.404695451f},
-std::array<float,2>{0.113443568f, 0.837297738f},
-std::array<float,2>{0.853483677f, 0.936763406f},
-std::array<float,2>{0.249990478f, 0.321134388f},
-std::array<float,2>{0.646252394f, 0.025816232f},
-std::array<float,2>{0.47071138f, 0.729463577f},
-std::array<float,2>{0.729590058f, 0.774243534f},
-std::array<float,2>{0.426689506f, 0.49560234f},
-std::array<float,2>{0.783555865f, 0.206776679f},
-std::array<float,2>{0.139691994f, 0.610190928f},
-std::array<float,2>{0.924576998f, 0.669524312f},
-std::array<float,2>{0.0061206203f, 0.110294178f},
-std::array<float,2>{0.531013668f, 0.311672002f},
-std::array<float,2>{0.312707335f, 0.941905737f},
-std::array<float,2>{0.662936091f, 0.698732734f},
-std::array<float,2>{0.45443958f, 0.0590802729f},
-std::array<float,2>{0.823847294f, 0.358913481f},
-std::array<float,2>{0.20603098f, 0.9020769f},
-std::array<float,2>{0.96413058f, 0.852253854f},
-std::array<float,2>{0.0893437266f, 0.435917586f},
-std::array<float,2>{0.599470019f, 0.170412064f},
-std::array<float,2>{0.260569364f, 0.504662812f},
-std::array<float,2>{0.558186114f, 0.982550025f},
-std::array<float,2>{0.356565684f, 0.269243181f},
-std::array<float,2>{0.895078778f, 0.0901516005f},
-std::array<float,2>{0.0441322029f, 0.637571037f},
-std::array<float,2>{0.762251854f, 0.569989622f},
-std::array<float,2>{0.173130661f, 0.249315396f},
-std::array<float,2>{0.692083895f, 0.458730102f},
-std::array<float,2>{0.395988971f, 0.809573472f},
-std::array<float,2>{0.602044642f, 0.725030124f},
-std::array<float,2>{0.255096495f, 0.0215370562f},
-std::array<float,2>{0.960267305f, 0.318515837f},
-std::array<float,2>{0.0802513734f, 0.92260623f},
-std::array<float,2>{0.813271701f, 0.83232832f},
-std::array<float,2>{0.214875072f, 0.395902842f},
-std::array<float,2>{0.668266296f, 0.127044931f},
-std::array<float,2>{0.466811746f, 0.555539906f},
-std::array<float,2>{0.701437712f, 0.952357829f},
-std::array<float,2>{0.405065626f, 0.30059436f},
-std::array<float,2>{0.75424552f, 0.123977453f},
-std::array<float,2>{0.184350416f, 0.657218754f},
-std::array<float,2>{0.901149571f, 0.620153487f},
-std::array<float,2>{0.0334832743f, 0.211257696f},
-std::array<float,2>{0.547588587f, 0.490649968f},
-std::array<float,2>{0.346004248f, 0.772644103f},
-std::array<float,2>{0.65040952f, 0.515459716f},
-std::array<float,2>{0.482572764f, 0.161891997f},
-std::array<float,2>{0.844710112f, 0.425973654f},
-std::array<float,2>{0.235406861f, 0.846779466f},
-std::array<float,2>{0.982979476f, 0.891430974f},
-std::array<float,2>{0.120924763f, 0.344245523f},
-std::array<float,2>{0.584731877f, 0.0493970439f},
-std::array<float,2>{0.299825221f, 0.692488134f},
-std::array<float,2>{0.523029745f, 0.797042429f},
-std::array<float,2>{0.321736813f, 0.468046397f},
-std::array<float,2>{0.934084535f, 0.239451885f},
-std::array<float,2>{0.00879412238f, 0.571154952f},
-std::array<float,2>{0.794692397f, 0.630684972f},
-std::array<float,2>{0.127709985f, 0.0810956284f},
-std::array<float,2>{0.726382911f, 0.275523573f},
-std::array<float,2>{0.435448378f, 0.970065117f},
-std::array<float,2>{0.535054922f, 0.580399811f},
-std::array<float,2>{0.363294154f, 0.224868864f},
-std::array<float,2>{0.882954538f, 0.441048294f},
-std::array<float,2>{0.0510823391f, 0.787108898f},
-std::array<float,2>{0.780462027f, 0.997866392f},
-std::array<float,2>{0.157922938f, 0.258326471f},
-std::array<float,2>{0.715127885f, 0.0727965683f},
-std::array<float,2>{0.377762705f, 0.64266634f},
-std::array<float,2>{0.686416149f, 0.870054483f},
-std::array<float,2>{0.43944338f, 0.417072058f},
-std::array<float,2>{0.832924247f, 0.172752187f},
-std::array<float,2>{0.191736445f, 0.528217793f},
-std::array<float,2>{0.950665414f, 0.70951879f},
-std::array<float,2>{0.0754693449f, 0.0381070636f},
-std::array<float,2>{0.619217813f, 0.372516423f},
-std::array<float,2>{0.271642655f, 0.886224389f},
-std::array<float,2>{0.738451123f, 0.672846377f},
-std::array<float,2>{0.415106028f, 0.094018437f},
-std::array<float,2>{0.80910176f, 0.281488895f},
-std::array<float,2>{0.14739573f, 0.962362051f},
-std::array<float,2>{0.920668006f, 0.760743022f},
-std::array<float,2>{0.0227362923f, 0.478203356f},
-std::array<float,2>{0.504363716f, 0.198311642f},
-std::array<float,2>{0.340777785f, 0.607546151f},
-std::array<float,2>{0.565947473f, 0.914233983f},
-std::array<float,2>{0.284000546f, 0.330209523f},
-std::array<float,2>{0.986735106f, 0.00740082376f},
-std::array<float,2>{0.0989091471f, 0.743698716f},
-std::array<float,2>{0.866273284f, 0.54312396f},
-std::array<float,2>{0.224352896f, 0.150426045f},
-std::array<float,2>{0.632975459f, 0.387788922f},
-std::array<float,2>{0.495886892f, 0.827810347f},
-std::array<float,2>{0.537639916f, 0.734108388f},
-std::array<float,2>{0.360103965f, 0.0304881167f},
-std::array<float,2>{0.889874697f, 0.327093452f},
-std::array<float,2>{0.0497875363f, 0.933342993f},
-std::array<float,2>{0.777174234f, 0.842661917f},
-std::array<float,2>{0.161063492f, 0.399814188f},
-std::array<float,2>{0.71277684f, 0.136518344f},
-std::array<float,2>{0.382781893f, 0.551565111f},
-std::array<float,2>{0.683004022f, 0.938670933f},
-std::array<float,2>{0.443572104f, 0.305335581f},
-std::array<float,2>{0.829077005f, 0.116762318f},
-std::array<float,2>{0.189668223f, 0.666072547f},
-std::array<float,2>{0.948172152f, 0.616608083f},
-std::array<float,2>{0.0717199519f, 0.207121491f},
-std::array<float,2>{0.623936713f, 0.498595506f},
-std::array<float,2>{0.266373396f, 0.779868066f},
-std::array<float,2>{0.734577775f, 0.50111419f},
-std::array<float,2>{0.418753922f, 0.165002093f},
-std::array<float,2>{0.807416439f, 0.431857765f},
-std::array<float,2>{0.141956791f, 0.857063115f},
-std::array<float,2>{0.917923152f, 0.903972268f},
-std::array<float,2>{0.017912874f, 0.351991504f},
-std::array<float,2>{0.501355648f, 0.057192184f},
-std::array<float,2>{0.338744462f, 0.702660918f},
-std::array<float,2>{0.570159137f, 0.806472659f},
-std::array<float,2>{0.286467731f, 0.454868317f},
-std::array<float,2>{0.99159503f, 0.243561476f},
-std::array<float,2>{0.0954179615f, 0.564298511f},
-std::array<float,2>{0.86145854f, 0.633666217f},
-std::array<float,2>{0.220112771f, 0.0891906843f},
-std::array<float,2>{0.639682472f, 0.272781461f},
-std::array<float,2>{0.497657835f, 0.97945261f},
-std::array<float,2>{0.608181179f, 0.591562927f},
-std::array<float,2>{0.253674626f, 0.232322499f},
-std::array<float,2>{0.954260409f, 0.452617377f},
-std::array<float,2>{0.085449405f, 0.791103184f},
-std::array<float,2>{0.818195462f, 0.990973771f},
-std::array<float,2>{0.211747497f, 0.256394327f},
-std::array<float,2>{0.667896807f, 0.0653921887f},
-std::array<float,2>{0.461718947f, 0.649251401f},
-std::array<float,2>{0.698012173f, 0.865074337f},
-std::array<float,2>{0.398489356f, 0.406743467f},
-std::array<float,2>{0.752893984f, 0.186748162f},
-std::array<float,2>{0.182228401f, 0.520709097f},
-std::array<float,2>{0.903713226f, 0.715468585f},
-std::array<float,2>{0.0367180258f, 0.0421875454f},
-std::array<float,2>{0.553762138f, 0.361683965f},
-std::array<float,2>{0.348801017f, 0.878123105f},
-std::array<float,2>{0.654026747f, 0.682053089f},
-std::array<float,2>{0.477274418f, 0.10187757f},
-std::array<float,2>{0.849059045f, 0.294187337f},
-std::array<float,2>{0.240545884f, 0.95667845f},
-std::array<float,2>{0.979705572f, 0.752839327f},
-std::array<float,2>{0.121947214f, 0.469916821f},
-std::array<float,2>{0.581995547f, 0.188144058f},
-std::array<float,2>{0.303981781f, 0.601511717f},
-std::array<float,2>{0.517180264f, 0.91047734f},
-std::array<float,2>{0.327389508f, 0.341033667f},
-std::array<float,2>{0.930070817f, 0.011480689f},
-std::array<float,2>{0.0151427323f, 0.738711655f},
-std::array<float,2>{0.791465461f, 0.538556576f},
-std::array<float,2>{0.131118119f, 0.147422299f},
-std::array<float,2>{0.722276986f, 0.37656039f},
-std::array<float,2>{0.431803048f, 0.82002157f},
-std::array<float,2>{0.586570561f, 0.644784689f},
-std::array<float,2>{0.308618844f, 0.0761062279f},
-std::array<float,2>{0.973513901f, 0.26191178f},
-std::array<float,2>{0.111839995f, 0.993178189f},
-std::array<float,2>{0.857251942f, 0.782840192f},
-std::array<float,2>{0.242222697f, 0.442953706f},
-std::array<float,2>{0.642167389f, 0.22183533f},
-std::array<float,2>{0.47460261f, 0.583795488f},
-std::array<float,2>{0.731455266f, 0.887165904f},
-std::array<float,2>{0.424566358f, 0.370945126f},
-std::array<float,2>{0.787646592f, 0.0342320576f},
-std::array<float,2>{0.136458755f, 0.705497563f},
-std::array<float,2>{0.925989032f, 0.524688661f},
-std::array<float,2>{0.00190336595f, 0.179516882f},
-std::array<float,2>{0.52637583f, 0.418276191f},
-std::array<float,2>{0.319702655f, 0.873622298f},
-std::array<float,2>{0.656614125f, 0.603598893f},
-std::array<float,2>{0.458420902f, 0.201761007f},
-std::array<float,2>{0.827609777f, 0.480760604f},
-std::array<float,2>{0.210446298f, 0.761855185f},
-std::array<float,2>{0.967700005f, 0.965678394f},
-std::array<float,2>{0.0934044868f, 0.287817419f},
-std::array<float,2>{0.596679747f, 0.0992798507f},
-std::array<float,2>{0.264957607f, 0.679415584f},
-std::array<float,2>{0.558724821f, 0.823817432f},
-std::array<float,2>{0.354025722f, 0.386603296f},
-std::array<float,2>{0.892673314f, 0.155585229f},
-std::array<float,2>{0.0426057428f, 0.5408234f},
-std::array<float,2>{0.760958016f, 0.749086261f},
-std::array<float,2>{0.175878644f, 0.00225477456f},
-std::array<float,2>{0.688489974f, 0.332948714f},
-std::array<float,2>{0.392100513f, 0.918718815f},
-std::array<float,2>{0.510674059f, 0.559977889f},
-std::array<float,2>{0.329094976f, 0.131576151f},
-std::array<float,2>{0.91134119f, 0.392883092f},
-std::array<float,2>{0.0250159074f, 0.83040309f},
-std::array<float,2>{0.804640353f, 0.926029503f},
-std::array<float,2>{0.155246511f, 0.315000147f},
-std::array<float,2>{0.747386277f, 0.0182355009f},
-std::array<float,2>{0.407064259f, 0.718885541f},
-std::array<float,2>{0.629857659f, 0.767214835f},
-std::array<float,2>{0.487995714f, 0.485253721f},
-std::array<float,2>{0.874355555f, 0.215091974f},
-std::array<float,2>{0.230624124f, 0.622963488f},
-std::array<float,2>{0.995710075f, 0.661912084f},
-std::array<float,2>{0.108612761f, 0.118512362f},
-std::array<float,2>{0.571833372f, 0.303083122f},
-std::array<float,2>{0.295064121f, 0.945866466f},
-std::array<float,2>{0.705558658f, 0.688798726f},
-std::array<float,2>{0.390175879f, 0.0542609431f},
-std::array<float,2>{0.767056346f, 0.348332554f},
-std::array<float,2>{0.167958543f, 0.897482455f},
-std::array<float,2>{0.881130278f, 0.849160373f},
-std::array<float,2>{0.0570138581f, 0.42386201f},
-std::array<float,2>{0.545538127f, 0.158645883f},
-std::array<float,2>{0.367413253f, 0.508916497f},
-std::array<float,2>{0.611085296f, 0.975652158f},
-std::array<float,2>{0.275303245f, 0.278055578f},
-std::array<float,2>{0.941731811f, 0.0822238922f},
-std::array<float,2>{0.068213433f, 0.628747344f},
-std::array<float,2>{0.841175258f, 0.574598491f},
-std::array<float,2>{0.198997289f, 0.236989334f},
-std::array<float,2>{0.673576832f, 0.461883008f},
-std::array<float,2>{0.449517787f, 0.802587926f},
-std::array<float,2>{0.530047715f, 0.67152226f},
-std::array<float,2>{0.313491076f, 0.112762608f},
-std::array<float,2>{0.925213158f, 0.310105234f},
-std::array<float,2>{0.00714350445f, 0.945267081f},
-std::array<float,2>{0.784908175f, 0.775975108f},
-std::array<float,2>{0.138974428f, 0.493878067f},
-std::array<float,2>{0.728983998f, 0.20459345f},
-std::array<float,2>{0.427687198f, 0.611417234f},
-std::array<float,2>{0.644997299f, 0.934800684f},
-std::array<float,2>{0.471761733f, 0.322396547f},
-std::array<float,2>{0.852000177f, 0.0252753049f},
-std::array<float,2>{0.248848692f, 0.727060676f},
-std::array<float,2>{0.969533026f, 0.550774693f},
-std::array<float,2>{0.114721417f, 0.138572246f},
-std::array<float,2>{0.590314567f, 0.403183311f},
-std::array<float,2>{0.305632472f, 0.839287281f},
-std::array<float,2>{0.693139613f, 0.567945182f},
-std::array<float,2>{0.394726187f, 0.247354358f},
-std::array<float,2>{0.762873352f, 0.459811509f},
-std::array<float,2>{0.172007218f, 0.810791135f},
-std::array<float,2>{0.896214604f, 0.980523884f},
-std::array<float,2>{0.0436885022f, 0.266803503f},
-std::array<float,2>{0.55694747f, 0.091843307f},
-std::array<float,2>{0.355898768f, 0.640226424f},
-std::array<float,2>{0.598068237f, 0.855182767f},
-std::array<float,2>{0.261571407f, 0.435412496f},
-std::array<float,2>{0.963236332f, 0.16844371f},
-std::array<float,2>{0.0881034881f, 0.507198393f},
-std::array<float,2>{0.823137224f, 0.69634223f},
-std::array<float,2>{0.206444487f, 0.0616882741f},
-std::array<float,2>{0.663828433f, 0.357359052f},
-std::array<float,2>{0.45376268f, 0.899862885f},
-std::array<float,2>{0.577092111f, 0.516933858f},
-std::array<float,2>{0.292068899f, 0.183321983f},
-std::array<float,2>{0.998678148f, 0.41089347f},
-std::array<float,2>{0.101831675f, 0.859535635f},
-std::array<float,2>{0.870563805f, 0.880625188f},
-std::array<float,2>{0.226720616f, 0.367048055f},
-std::array<float,2>{0.62889272f, 0.0435197167f},
-std::array<float,2>{0.490163743f, 0.712344885f},
-std::array<float,2>{0.745618403f, 0.794631004f},
-std::array<float,2>{0.412227958f, 0.448352396f},
-std::array<float,2>{0.798191667f, 0.229971588f},
-std::array<float,2>{0.149319828f, 0.58679539f},
-std::array<float,2>{0.909046531f, 0.655845344f},
-std::array<float,2>{0.0282196626f, 0.0680955797f},
-std::array<float,2>{0.512553215f, 0.25117895f},
-std::array<float,2>{0.335391879f, 0.985324681f},
-std::array<float,2>{0.679363012f, 0.736302078f},
-std::array<float,2>{0.446696341f, 0.0136477938f},
-std::array<float,2>{0.837952495f, 0.337029457f},
-std::array<float,2>{0.199371099f, 0.906991303f},
-std::array<float,2>{0.938981891f, 0.815233767f},
-std::array<float,2>{0.065328069f, 0.379862666f},
-std::array<float,2>{0.616039276f, 0.140901536f},
-std::array<float,2>{0.277878344f, 0.535069346f},
-std::array<float,2>{0.542824924f, 0.958684385f},
-std::array<float,2>{0.37464866f, 0.291383356f},
-std::array<float,2>{0.876169205f, 0.107674025f},
-std::array<float,2>{0.0591280833f, 0.684413671f},
-std::array<float,2>{0.772149622f, 0.595252752f},
-std::array<float,2>{0.170428708f, 0.193394974f},
-std::array<float,2>{0.708097398f, 0.475390404f},
-std::array<float,2>{0.386263967f, 0.754445195f},
-std::array<float,2>{0.620462179f, 0.708918154f},
-std::array<float,2>{0.273096114f, 0.0355896428f},
-std::array<float,2>{0.950128257f, 0.374873787f},
-std::array<float,2>{0.0745710358f, 0.883280814f},
-std::array<float,2>{0.833014309f, 0.867829382f},
-std::array<float,2>{0.192507833f, 0.415819138f},
-std::array<float,2>{0.687294841f, 0.174860105f},
-std::array<float,2>{0.438383192f, 0.530750573f},
-std::array<float,2>{0.716016889f, 0.998464108f},
-std::array<float,2>{0.378109545f, 0.261294514f},
-std::array<float,2>{0.779907048f, 0.0705149844f},
-std::array<float,2>{0.156974807f, 0.642072916f},
-std::array<float,2>{0.883983374f, 0.579877913f},
-std::array<float,2>{0.052541662f, 0.22275646f},
-std::array<float,2>{0.533221543f, 0.439255804f},
-std::array<float,2>{0.364790797f, 0.787880063f},
-std::array<float,2>{0.633821666f, 0.54601258f},
-std::array<float,2>{0.495112509f, 0.149602592f},
-std::array<float,2>{0.865596831f, 0.389815539f},
-std::array<float,2>{0.222969249f, 0.824451685f},
-std::array<float,2>{0.98788929f, 0.916055799f},
-std::array<float,2>{0.0984127745f, 0.328838676f},
-std::array<float,2>{0.564723015f, 0.00584755652f},
-std::array<float,2>{0.285113543f, 0.744652271f},
-std::array<float,2>{0.505189121f, 0.75904429f},
-std::array<float,2>{0.341433108f, 0.479902148f},
-std::array<float,2>{0.921651304f, 0.197136685f},
-std::array<float,2>{0.021718096f, 0.607087493f},
-std::array<float,2>{0.809578717f, 0.675576806f},
-std::array<float,2>{0.147541121f, 0.0958278477f},
-std::array<float,2>{0.740103841f, 0.283802301f},
-std::array<float,2>{0.414493412f, 0.964190245f},
-std::array<float,2>{0.547865272f, 0.617604911f},
-std::array<float,2>{0.347428948f, 0.214249372f},
-std::array<float,2>{0.902297199f, 0.488493621f},
-std::array<float,2>{0.0345346108f, 0.769627988f},
-std::array<float,2>{0.755169749f, 0.949222624f},
-std::array<float,2>{0.184751853f, 0.297069252f},
-std::array<float,2>{0.702766895f, 0.122696176f},
-std::array<float,2>{0.405663371f, 0.65910691f},
-std::array<float,2>{0.669913411f, 0.833988845f},
-std::array<float,2>{0.468530774f, 0.397278816f},
-std::array<float,2>{0.814220071f, 0.126490116f},
-std::array<float,2>{0.215894282f, 0.558266163f},
-std::array<float,2>{0.95968467f, 0.723660827f},
-std::array<float,2>{0.0816983953f, 0.0210869573f},
-std::array<float,2>{0.602641344f, 0.316418171f},
-std::array<float,2>{0.254819959f, 0.925752163f},
-std::array<float,2>{0.725083172f, 0.631047845f},
-std::array<float,2>{0.434517741f, 0.0794904307f},
-std::array<float,2>{0.793822587f, 0.274781495f},
-std::array<float,2>{0.128535613f, 0.972392499f},
-std::array<float,2>{0.935131073f, 0.800436258f},
-std::array<float,2>{0.00803629681f, 0.466495901f},
-std::array<float,2>{0.521572948f, 0.241056561f},
-std::array<float,2>{0.321195126f, 0.573959529f},
-std::array<float,2>{0.585780382f, 0.893808186f},
-std::array<float,2>{0.299488306f, 0.345799357f},
-std::array<float,2>{0.98355478f, 0.0479328111f},
-std::array<float,2>{0.119685456f, 0.694802761f},
-std::array<float,2>{0.845291495f, 0.512140632f},
-std::array<float,2>{0.234535873f, 0.162377179f},
-std::array<float,2>{0.651998281f, 0.428653836f},
-std::array<float,2>{0.48416537f, 0.844633639f},
-std::array<float,2>{0.502014339f, 0.700845659f},
-std::array<float,2>{0.336496443f, 0.055136919f},
-std::array<float,2>{0.915388525f, 0.354342043f},
-std::array<float,2>{0.0167475156f, 0.905454338f},
-std::array<float,2>{0.8057037f, 0.85926652f},
-std::array<float,2>{0.144271925f, 0.430259913f},
-std::array<float,2>{0.737334907f, 0.166588992f},
-std::array<float,2>{0.420247465f, 0.50262481f},
-std::array<float,2>{0.636850119f, 0.977186203f},
-std::array<float,2>{0.498601496f, 0.269981086f},
-std::array<float,2>{0.860430717f, 0.0875657424f},
-std::array<float,2>{0.221346721f, 0.636544943f},
-std::array<float,2>{0.988500655f, 0.565332711f},
-std::array<float,2>{0.0967360958f, 0.244553745f},
-std::array<float,2>{0.567400753f, 0.455411643f},
-std::array<float,2>{0.287672162f, 0.808097839f},
-std::array<float,2>{0.714446425f, 0.553727746f},
-std::array<float,2>{0.380252361f, 0.133886084f},
-std::array<float,2>{0.773548782f, 0.400630325f},
-std::array<float,2>{0.162268057f, 0.84158808f},
-std::array<float,2>{0.886912107f, 0.930300593f},
-std::array<float,2>{0.048764091f, 0.324907124f},
-std::array<float,2>{0.535344243f, 0.0291663185f},
-std::array<float,2>{0.362511128f, 0.731978238f},
-std::array<float,2>{0.622727752f, 0.778971374f},
-std::array<float,2>{0.268071055f, 0.49611786f},
-std::array<float,2>{0.947059751f, 0.210137129f},
-std::array<float,2>{0.0735295862f, 0.614532292f},
-std::array<float,2>{0.83165127f, 0.6659109f},
-std::array<float,2>{0.187749654f, 0.113553539f},
-std::array<float,2>{0.681149423f, 0.308583885f},
-std::array<float,2>{0.443321556f, 0.939534426f},
-std::array<float,2>{0.580048919f, 0.598263264f},
-std::array<float,2>{0.301995784f, 0.191267163f},
-std::array<float,2>{0.978336334f, 0.472094655f},
-std::array<float,2>{0.124883443f, 0.751449406f},
-std::array<float,2>{0.851098239f, 0.953324795f},
-std::array<float,2>{0.23877643f, 0.296866924f},
-std::array<float,2>{0.656034768f, 0.103764825f},
-std::array<float,2>{0.478648692f, 0.680954695f},
-std::array<float,2>{0.720509946f, 0.816593349f},
-std::array<float,2>{0.431226373f, 0.377298206f},
-std::array<float,2>{0.790520728f, 0.144543231f},
-std::array<float,2>{0.130344629f, 0.536767364f},
-std::array<float,2>{0.932572007f, 0.741281867f},
-std::array<float,2>{0.0128388461f, 0.00971245021f},
-std::array<float,2>{0.518257082f, 0.343311042f},
-std::array<float,2>{0.324252576f, 0.913178086f},
-std::array<float,2>{0.665657997f, 0.650693059f},
-std::array<float,2>{0.463851035f, 0.0626939684f},
-std::array<float,2>{0.819375932f, 0.255718976f},
-std::array<float,2>{0.214652374f, 0.988665044f},
-std::array<float,2>{0.956508279f, 0.789577842f},
-std::array<float,2>{0.0827014297f, 0.450937837f},
-std::array<float,2>{0.605675638f, 0.233378559f},
-std::array<float,2>{0.251818448f, 0.592701793f},
-std::array<float,2>{0.551568508f, 0.876012385f},
-std::array<float,2>{0.350169986f, 0.361104459f},
-std::array<float,2>{0.905942082f, 0.040672116f},
-std::array<float,2>{0.0390549898f, 0.716935217f},
-std::array<float,2>{0.751556039f, 0.523381948f},
-std::array<float,2>{0.181414023f, 0.183901101f},
-std::array<float,2>{0.697022259f, 0.409603477f},
-std::array<float,2>{0.401540518f, 0.866263509f},
-std::array<float,2>{0.595196605f, 0.677278757f},
-std::array<float,2>{0.26317662f, 0.10001348f},
-std::array<float,2>{0.966295242f, 0.285163552f},
-std::array<float,2>{0.0917724594f, 0.968479633f},
-std::array<float,2>{0.825772822f, 0.764876366f},
-std::array<float,2>{0.207535163f, 0.484336495f},
-std::array<float,2>{0.659124553f, 0.200726166f},
-std::array<float,2>{0.45922333f, 0.602691591f},
-std::array<float,2>{0.689544082f, 0.921637058f},
-std::array<float,2>{0.392579675f, 0.334087163f},
-std::array<float,2>{0.759727895f, 0.00192755461f},
-std::array<float,2>{0.179415241f, 0.74688077f},
-std::array<float,2>{0.891135156f, 0.542746425f},
-std::array<float,2>{0.0400051475f, 0.15267165f},
-std::array<float,2>{0.562293708f, 0.383077234f},
-std::array<float,2>{0.353199512f, 0.82170701f},
-std::array<float,2>{0.644072413f, 0.584214091f},
-std::array<float,2>{0.476548195f, 0.219356388f},
-std::array<float,2>{0.857492805f, 0.443820328f},
-std::array<float,2>{0.245948941f, 0.784414589f},
-std::array<float,2>{0.975489855f, 0.995202541f},
-std::array<float,2>{0.110424742f, 0.26389879f},
-std::array<float,2>{0.588202655f, 0.0764679089f},
-std::array<float,2>{0.311682671f, 0.647802353f},
-std::array<float,2>{0.523995578f, 0.872943819f},
-std::array<float,2>{0.317842692f, 0.42178905f},
-std::array<float,2>{0.928535402f, 0.176703304f},
-std::array<float,2>{0.00337788439f, 0.525806189f},
-std::array<float,2>{0.785362422f, 0.703983128f},
-std::array<float,2>{0.134191886f, 0.032720767f},
-std::array<float,2>{0.733783364f, 0.368587881f},
-std::array<float,2>{0.423777163f, 0.888901412f},
-std::array<float,2>{0.543114781f, 0.511651039f},
-std::array<float,2>{0.370352715f, 0.156604379f},
-std::array<float,2>{0.879572392f, 0.422194332f},
-std::array<float,2>{0.0547901131f, 0.851439953f},
-std::array<float,2>{0.767743111f, 0.896143496f},
-std::array<float,2>{0.164140567f, 0.349758685f},
-std::array<float,2>{0.704323709f, 0.052006878f},
-std::array<float,2>{0.387153685f, 0.690644205f},
-std::array<float,2>{0.674609303f, 0.803616166f},
-std::array<float,2>{0.452046633f, 0.46293512f},
-std::array<float,2>{0.842446148f, 0.236238301f},
-std::array<float,2>{0.195911914f, 0.577025592f},
-std::array<float,2>{0.944570541f, 0.626435459f},
-std::array<float,2>{0.0701876283f, 0.0844947547f},
-std::array<float,2>{0.612570524f, 0.280000299f},
-std::array<float,2>{0.276359349f, 0.974431813f},
-std::array<float,2>{0.749172509f, 0.720890284f},
-std::array<float,2>{0.408882856f, 0.016086461f},
-std::array<float,2>{0.801062644f, 0.313337922f},
-std::array<float,2>{0.15278922f, 0.928266585f},
-std::array<float,2>{0.91228199f, 0.829953969f},
-std::array<float,2>{0.0256336201f, 0.390894234f},
-std::array<float,2>{0.508449674f, 0.129774764f},
-std::array<float,2>{0.331121445f, 0.562332988f},
-std::array<float,2>{0.572921276f, 0.947904825f},
-std::array<float,2>{0.294683367f, 0.30232054f},
-std::array<float,2>{0.992817581f, 0.120299503f},
-std::array<float,2>{0.107289158f, 0.662649453f},
-std::array<float,2>{0.872005641f, 0.624212861f},
-std::array<float,2>{0.232768327f, 0.217242017f},
-std::array<float,2>{0.632730126f, 0.487135947f},
-std::array<float,2>{0.48584494f, 0.769432485f},
-std::array<float,2>{0.555182815f, 0.637789428f},
-std::array<float,2>{0.358139515f, 0.0908547342f},
-std::array<float,2>{0.896640718f, 0.267601281f},
-std::array<float,2>{0.0449620783f, 0.984224319f},
-std::array<float,2>{0.763938129f, 0.809142768f},
-std::array<float,2>{0.174494132f, 0.457720786f},
-std::array<float,2>{0.693986714f, 0.248342991f},
-std::array<float,2>{0.398120701f, 0.568909645f},
-std::array<float,2>{0.661611795f, 0.901049018f},
-std::array<float,2>{0.455145061f, 0.358039171f},
-std::array<float,2>{0.821850538f, 0.0597589239f},
-std::array<float,2>{0.204267487f, 0.697360575f},
-std::array<float,2>{0.961958408f, 0.505004823f},
-std::array<float,2>{0.087203458f, 0.17123805f},
-std::array<float,2>{0.601036787f, 0.437072217f},
-std::array<float,2>{0.258657426f, 0.852567911f},
-std::array<float,2>{0.727268755f, 0.610469997f},
-std::array<float,2>{0.429017305f, 0.205799952f},
-std::array<float,2>{0.781978369f, 0.494298041f},
-std::array<float,2>{0.138248563f, 0.775085092f},
-std::array<float,2>{0.922860146f, 0.942585349f},
-std::array<float,2>{0.00430849893f, 0.31069988f},
-std::array<float,2>{0.527954698f, 0.11038541f},
-std::array<float,2>{0.315775663f, 0.668792009f},
-std::array<float,2>{0.592947543f, 0.836097121f},
-std::array<float,2>{0.307665765f, 0.406127363f},
-std::array<float,2>{0.971424937f, 0.139956892f},
-std::array<float,2>{0.117021725f, 0.547166109f},
-std::array<float,2>{0.853698492f, 0.730342627f},
-std::array<float,2>{0.247971043f, 0.0265845936f},
-std::array<float,2>{0.647745132f, 0.321843565f},
-std::array<float,2>{0.470022202f, 0.93617934f},
-std::array<float,2>{0.614516973f, 0.53315872f},
-std::array<float,2>{0.280566454f, 0.143792719f},
-std::array<float,2>{0.941333771f, 0.381946534f},
-std::array<float,2>{0.0640460625f, 0.812858224f},
-std::array<float,2>{0.835970581f, 0.909660995f},
-std::array<float,2>{0.202091217f, 0.339558959f},
-std::array<float,2>{0.676435411f, 0.0149368346f},
-std::array<float,2>{0.448237747f, 0.737184227f},
-std::array<float,2>{0.709912181f, 0.757070005f},
-std::array<float,2>{0.383386612f, 0.473008364f},
-std::array<float,2>{0.770115137f, 0.192051128f},
-std::array<float,2>{0.169238344f, 0.597573698f},
-std::array<float,2>{0.878017843f, 0.685718715f},
-std::array<float,2>{0.0621409751f, 0.106717899f},
-std::array<float,2>{0.539346099f, 0.290088266f},
-std::array<float,2>{0.371721923f, 0.959021568f},
-std::array<float,2>{0.626026332f, 0.713240027f},
-std::array<float,2>{0.491078466f, 0.0459705777f},
-std::array<float,2>{0.86864388f, 0.363829345f},
-std::array<float,2>{0.230068222f, 0.881286621f},
-std::array<float,2>{0.997220814f, 0.862546325f},
-std::array<float,2>{0.10400176f, 0.413783669f},
-std::array<float,2>{0.57488209f, 0.181192726f},
-std::array<float,2>{0.290568948f, 0.518847704f},
-std::array<float,2>{0.515320182f, 0.987273514f},
-std::array<float,2>{0.333460569f, 0.253443629f},
-std::array<float,2>{0.907981932f, 0.0700757727f},
-std::array<float,2>{0.0293571278f, 0.653891206f},
-std::array<float,2>{0.800643384f, 0.588506639f},
-std::array<float,2>{0.151861638f, 0.226961896f},
-std::array<float,2>{0.743864894f, 0.445878178f},
-std::array<float,2>{0.412013739f, 0.796337903f},
-std::array<float,2>{0.563220918f, 0.742785513f},
-std::array<float,2>{0.281643182f, 0.00680829026f},
-std::array<float,2>{0.985048056f, 0.33201012f},
-std::array<float,2>{0.100784518f, 0.915967822f},
-std::array<float,2>{0.86422056f, 0.826773226f},
-std::array<float,2>{0.225761905f, 0.386930823f},
-std::array<float,2>{0.636183858f, 0.151459411f},
-std::array<float,2>{0.492715269f, 0.544363856f},
-std::array<float,2>{0.740811586f, 0.961001098f},
-std::array<float,2>{0.417859912f, 0.282302976f},
-std::array<float,2>{0.812484503f, 0.095565021f},
-std::array<float,2>{0.145869389f, 0.673752487f},
-std::array<float,2>{0.918030143f, 0.608546734f},
-std::array<float,2>{0.0205967743f, 0.198141053f},
-std::array<float,2>{0.506835401f, 0.476929009f},
-std::array<float,2>{0.343122482f, 0.760731816f},
-std::array<float,2>{0.684309304f, 0.528685272f},
-std::array<float,2>{0.440679401f, 0.173561722f},
-std::array<float,2>{0.835588336f, 0.416895866f},
-std::array<float,2>{0.19495143f, 0.8706882f},
-std::array<float,2>{0.952551603f, 0.885548472f},
-std::array<float,2>{0.0773267671f, 0.371431649f},
-std::array<float,2>{0.618115664f, 0.037314564f},
-std::array<float,2>{0.270448655f, 0.710442245f},
-std::array<float,2>{0.531342208f, 0.785385489f},
-std::array<float,2>{0.365503222f, 0.43971917f},
-std::array<float,2>{0.886643171f, 0.226158455f},
-std::array<float,2>{0.0540302433f, 0.58185631f},
-std::array<float,2>{0.778873086f, 0.643695831f},
-std::array<float,2>{0.159954891f, 0.0737455562f},
-std::array<float,2>{0.71723175f, 0.259068221f},
-std::array<float,2>{0.376731426f, 0.99656713f},
-std::array<float,2>{0.52040112f, 0.571543396f},
-std::array<float,2>{0.322879374f, 0.238752842f},
-std::array<float,2>{0.937108278f, 0.467106909f},
-std::array<float,2>{0.0113662481f, 0.798107028f},
-std::array<float,2>{0.79662621f, 0.9690063f},
-std::array<float,2>{0.126658276f, 0.276887715f},
-std::array<float,2>{0.724577129f, 0.0809321702f},
-std::array<float,2>{0.436449677f, 0.629382372f},
-std::array<float,2>{0.650119305f, 0.845782101f},
-std::array<float,2>{0.481707692f, 0.427363366f},
-std::array<float,2>{0.846510589f, 0.160507679f},
-std::array<float,2>{0.238084927f, 0.514184952f},
-std::array<float,2>{0.980518341f, 0.691645086f},
-std::array<float,2>{0.117299065f, 0.0502301939f},
-std::array<float,2>{0.582355738f, 0.345337719f},
-std::array<float,2>{0.297665209f, 0.891863883f},
-std::array<float,2>{0.699568093f, 0.65766722f},
-std::array<float,2>{0.403116882f, 0.124956563f},
-std::array<float,2>{0.75750941f, 0.299361229f},
-std::array<float,2>{0.187085018f, 0.952040851f},
-std::array<float,2>{0.899504721f, 0.771860957f},
-std::array<float,2>{0.0326956622f, 0.492107332f},
-std::array<float,2>{0.549380064f, 0.212850332f},
-std::array<float,2>{0.34488821f, 0.619978011f},
-std::array<float,2>{0.603996873f, 0.923200309f},
-std::array<float,2>{0.257728636f, 0.319649518f},
-std::array<float,2>{0.95757699f, 0.0226096548f},
-std::array<float,2>{0.0798676312f, 0.726084948f},
-std::array<float,2>{0.816101968f, 0.556024432f},
-std::array<float,2>{0.216853648f, 0.128809407f},
-std::array<float,2>{0.671110153f, 0.395312458f},
-std::array<float,2>{0.466255665f, 0.833592832f},
-std::array<float,2>{0.50650394f, 0.745124996f},
-std::array<float,2>{0.34294638f, 0.00421277946f},
-std::array<float,2>{0.918267548f, 0.330052227f},
-std::array<float,2>{0.0209327508f, 0.917059362f},
-std::array<float,2>{0.812134862f, 0.826043725f},
-std::array<float,2>{0.14559418f, 0.388908207f},
-std::array<float,2>{0.740979493f, 0.1487782f},
-std::array<float,2>{0.417696089f, 0.544934332f},
-std::array<float,2>{0.635843277f, 0.96348083f},
-std::array<float,2>{0.493015349f, 0.284991562f},
-std::array<float,2>{0.863878071f, 0.0972469673f},
-std::array<float,2>{0.226069734f, 0.674672902f},
-std::array<float,2>{0.985124588f, 0.605543315f},
-std::array<float,2>{0.100834981f, 0.196120232f},
-std::array<float,2>{0.563361287f, 0.479389727f},
-std::array<float,2>{0.281326711f, 0.757914782f},
-std::array<float,2>{0.717040718f, 0.529696643f},
-std::array<float,2>{0.376477271f, 0.173983783f},
-std::array<float,2>{0.779254794f, 0.414581746f},
-std::array<float,2>{0.159828544f, 0.868326843f},
-std::array<float,2>{0.886230648f, 0.883839965f},
-std::array<float,2>{0.0537257232f, 0.373086751f},
-std::array<float,2>{0.531676769f, 0.0368595272f},
-std::array<float,2>{0.365359545f, 0.707188547f},
-std::array<float,2>{0.617859364f, 0.788966179f},
-std::array<float,2>{0.270183325f, 0.438309342f},
-std::array<float,2>{0.952317536f, 0.224269792f},
-std::array<float,2>{0.0776051357f, 0.578389049f},
-std::array<float,2>{0.835844159f, 0.64120096f},
-std::array<float,2>{0.195248678f, 0.0720616207f},
-std::array<float,2>{0.684423149f, 0.260284632f},
-std::array<float,2>{0.440536708f, 0.999089658f},
-std::array<float,2>{0.582219243f, 0.572496951f},
-std::array<float,2>{0.297495037f, 0.241955251f},
-std::array<float,2>{0.98083663f, 0.465359449f},
-std::array<float,2>{0.117591687f, 0.799613059f},
-std::array<float,2>{0.846386552f, 0.970877349f},
-std::array<float,2>{0.237898111f, 0.273720026f},
-std::array<float,2>{0.650388241f, 0.078574568f},
-std::array<float,2>{0.481495351f, 0.632633388f},
-std::array<float,2>{0.724169731f, 0.84490788f},
-std::array<float,2>{0.436078995f, 0.429408252f},
-std::array<float,2>{0.796732783f, 0.163867086f},
-std::array<float,2>{0.126787141f, 0.512834549f},
-std::array<float,2>{0.937376261f, 0.694058478f},
-std::array<float,2>{0.0115501368f, 0.0473075025f},
-std::array<float,2>{0.520119846f, 0.346857309f},
-std::array<float,2>{0.323177874f, 0.892795503f},
-std::array<float,2>{0.671190798f, 0.659843087f},
-std::array<float,2>{0.465880096f, 0.121737361f},
-std::array<float,2>{0.816316903f, 0.298052847f},
-std::array<float,2>{0.217238188f, 0.950913846f},
-std::array<float,2>{0.957883179f, 0.771179438f},
-std::array<float,2>{0.0798283592f, 0.489565432f},
-std::array<float,2>{0.603609622f, 0.213796794f},
-std::array<float,2>{0.257467747f, 0.618825078f},
-std::array<float,2>{0.549563766f, 0.924014211f},
-std::array<float,2>{0.34497273f, 0.31798175f},
-std::array<float,2>{0.899787545f, 0.0203000456f},
-std::array<float,2>{0.0323118456f, 0.723208964f},
-std::array<float,2>{0.757628798f, 0.557267606f},
-std::array<float,2>{0.187261447f, 0.125607967f},
-std::array<float,2>{0.699264228f, 0.398407906f},
-std::array<float,2>{0.402836561f, 0.835115016f},
-std::array<float,2>{0.600821674f, 0.63881737f},
-std::array<float,2>{0.25836283f, 0.09372513f},
-std::array<float,2>{0.962251961f, 0.266222f},
-std::array<float,2>{0.0870657787f, 0.98154825f},
-std::array<float,2>{0.822211862f, 0.81160742f},
-std::array<float,2>{0.204508319f, 0.460532188f},
-std::array<float,2>{0.661302447f, 0.246896684f},
-std::array<float,2>{0.455394298f, 0.567280173f},
-std::array<float,2>{0.694121778f, 0.899001539f},
-std::array<float,2>{0.398320168f, 0.355565548f},
-std::array<float,2>{0.763862669f, 0.0609529912f},
-std::array<float,2>{0.174723893f, 0.69550854f},
-std::array<float,2>{0.89674443f, 0.505976439f},
-std::array<float,2>{0.0453408547f, 0.169158518f},
-std::array<float,2>{0.555638194f, 0.433882952f},
-std::array<float,2>{0.358370423f, 0.854447782f},
-std::array<float,2>{0.647683263f, 0.613025486f},
-std::array<float,2>{0.469802469f, 0.203792095f},
-std::array<float,2>{0.853902459f, 0.492556572f},
-std::array<float,2>{0.247753024f, 0.777252614f},
-std::array<float,2>{0.971485913f, 0.944082201f},
-std::array<float,2>{0.116925642f, 0.309509873f},
-std::array<float,2>{0.593160331f, 0.111793816f},
-std::array<float,2>{0.307954133f, 0.669985831f},
-std::array<float,2>{0.528300583f, 0.838047504f},
-std::array<float,2>{0.31555891f, 0.403526247f},
-std::array<float,2>{0.923150122f, 0.137442067f},
-std::array<float,2>{0.00402769586f, 0.549451768f},
-std::array<float,2>{0.782209992f, 0.728041232f},
-std::array<float,2>{0.138570249f, 0.0237428658f},
-std::array<float,2>{0.727323234f, 0.324017316f},
-std::array<float,2>{0.428814024f, 0.934229136f},
-std::array<float,2>{0.53915894f, 0.534116089f},
-std::array<float,2>{0.372048348f, 0.141711622f},
-std::array<float,2>{0.878239989f, 0.380287945f},
-std::array<float,2>{0.0623870753f, 0.815527201f},
-std::array<float,2>{0.770445168f, 0.907744229f},
-std::array<float,2>{0.168987766f, 0.336351097f},
-std::array<float,2>{0.709566176f, 0.0118263448f},
-std::array<float,2>{0.383776903f, 0.735297143f},
-std::array<float,2>{0.6765365f, 0.755468607f},
-std::array<float,2>{0.447791129f, 0.475685537f},
-std::array<float,2>{0.836183906f, 0.194583416f},
-std::array<float,2>{0.201832592f, 0.594187975f},
-std::array<float,2>{0.941041172f, 0.685023725f},
-std::array<float,2>{0.0642922148f, 0.109305456f},
-std::array<float,2>{0.614440739f, 0.292945027f},
-std::array<float,2>{0.280428171f, 0.957193851f},
-std::array<float,2>{0.743899763f, 0.711646914f},
-std::array<float,2>{0.411625147f, 0.0440439656f},
-std::array<float,2>{0.80032599f, 0.365874201f},
-std::array<float,2>{0.152146727f, 0.879107833f},
-std::array<float,2>{0.907893419f, 0.861310005f},
-std::array<float,2>{0.0297344793f, 0.411299795f},
-std::array<float,2>{0.515470266f, 0.181883812f},
-std::array<float,2>{0.33318013f, 0.516241014f},
-std::array<float,2>{0.575055063f, 0.985551119f},
-std::array<float,2>{0.290905923f, 0.25004068f},
-std::array<float,2>{0.997328997f, 0.0670614466f},
-std::array<float,2>{0.103523254f, 0.654989123f},
-std::array<float,2>{0.868232727f, 0.587474108f},
-std::array<float,2>{0.230277523f, 0.229159653f},
-std::array<float,2>{0.626435757f, 0.44807899f},
-std::array<float,2>{0.490730166f, 0.793841779f},
-std::array<float,2>{0.562039435f, 0.677938998f},
-std::array<float,2>{0.353316516f, 0.0979909003f},
-std::array<float,2>{0.891535223f, 0.288477421f},
-std::array<float,2>{0.0397939011f, 0.966638327f},
-std::array<float,2>{0.759395182f, 0.763543904f},
-std::array<float,2>{0.179463342f, 0.481927603f},
-std::array<float,2>{0.689769745f, 0.20296745f},
-std::array<float,2>{0.392860711f, 0.60457021f},
-std::array<float,2>{0.658692718f, 0.91977632f},
-std::array<float,2>{0.459352821f, 0.333148569f},
-std::array<float,2>{0.826045632f, 0.00380613585f},
-std::array<float,2>{0.207837373f, 0.748990357f},
-std::array<float,2>{0.965928495f, 0.539534032f},
-std::array<float,2>{0.0915207192f, 0.154875502f},
-std::array<float,2>{0.594884515f, 0.384767503f},
-std::array<float,2>{0.262897044f, 0.823130786f},
-std::array<float,2>{0.733578444f, 0.582181215f},
-std::array<float,2>{0.423399687f, 0.221443266f},
-std::array<float,2>{0.785428703f, 0.442151427f},
-std::array<float,2>{0.133833811f, 0.781335473f},
-std::array<float,2>{0.92828536f, 0.992298603f},
-std::array<float,2>{0.00300552393f, 0.262707382f},
-std::array<float,2>{0.524256885f, 0.0743854493f},
-std::array<float,2>{0.317529112f, 0.645706534f},
-std::array<float,2>{0.587995648f, 0.874832988f},
-std::array<float,2>{0.31180495f, 0.419555843f},
-std::array<float,2>{0.975307107f, 0.17844674f},
-std::array<float,2>{0.110703625f, 0.523626089f},
-std::array<float,2>{0.857899904f, 0.706653059f},
-std::array<float,2>{0.245796517f, 0.0339234658f},
-std::array<float,2>{0.644308329f, 0.369476616f},
-std::array<float,2>{0.476171345f, 0.888605654f},
-std::array<float,2>{0.612450182f, 0.508557439f},
-std::array<float,2>{0.275963902f, 0.160110921f},
-std::array<float,2>{0.94458586f, 0.425770104f},
-std::array<float,2>{0.070048295f, 0.848351538f},
-std::array<float,2>{0.842568338f, 0.896826267f},
-std::array<float,2>{0.196183488f, 0.348720014f},
-std::array<float,2>{0.674415469f, 0.0535708591f},
-std::array<float,2>{0.45184806f, 0.687820315f},
-std::array<float,2>{0.704425693f, 0.80102694f},
-std::array<float,2>{0.386829525f, 0.462137491f},
-std::array<float,2>{0.767867804f, 0.237392262f},
-std::array<float,2>{0.16443409f, 0.575882018f},
-std::array<float,2>{0.879657567f, 0.627451479f},
-std::array<float,2>{0.0549647585f, 0.0830519199f},
-std::array<float,2>{0.543454289f, 0.27842927f},
-std::array<float,2>{0.370367318f, 0.974959016f},
-std::array<float,2>{0.632413089f, 0.719727099f},
-std::array<float,2>{0.486084044f, 0.018680973f},
-std::array<float,2>{0.871598661f, 0.316133559f},
-std::array<float,2>{0.232602268f, 0.927006304f},
-std::array<float,2>{0.99303627f, 0.831143618f},
-std::array<float,2>{0.107111946f, 0.394521773f},
-std::array<float,2>{0.573011279f, 0.131928116f},
-std::array<float,2>{0.294463366f, 0.559035957f},
-std::array<float,2>{0.50859338f, 0.946576715f},
-std::array<float,2>{0.331316292f, 0.304533124f},
-std::array<float,2>{0.912569165f, 0.118012592f},
-std::array<float,2>{0.0258157924f, 0.660971403f},
-std::array<float,2>{0.800850689f, 0.621644855f},
-std::array<float,2>{0.152429625f, 0.216625884f},
-std::array<float,2>{0.749465942f, 0.485985577f},
-std::array<float,2>{0.409136295f, 0.76567924f},
-std::array<float,2>{0.567772269f, 0.701703787f},
-std::array<float,2>{0.287871629f, 0.0582791418f},
-std::array<float,2>{0.988719761f, 0.353430986f},
-std::array<float,2>{0.0970089063f, 0.902963996f},
-std::array<float,2>{0.860701561f, 0.855902195f},
-std::array<float,2>{0.221471414f, 0.433292687f},
-std::array<float,2>{0.637155771f, 0.165582865f},
-std::array<float,2>{0.498905659f, 0.500869513f},
-std::array<float,2>{0.737728059f, 0.980425417f},
-std::array<float,2>{0.41997394f, 0.272089005f},
-std::array<float,2>{0.805986106f, 0.0884177238f},
-std::array<float,2>{0.144317761f, 0.634392321f},
-std::array<float,2>{0.915081978f, 0.563285649f},
-std::array<float,2>{0.0170773603f, 0.24234511f},
-std::array<float,2>{0.502207756f, 0.453208715f},
-std::array<float,2>{0.336776316f, 0.805525243f},
-std::array<float,2>{0.680781066f, 0.552705646f},
-std::array<float,2>{0.443060219f, 0.13513419f},
-std::array<float,2>{0.831962109f, 0.398599684f},
-std::array<float,2>{0.187521383f, 0.843374193f},
-std::array<float,2>{0.946933925f, 0.932362914f},
-std::array<float,2>{0.0733856186f, 0.327702254f},
-std::array<float,2>{0.622833192f, 0.029867366f},
-std::array<float,2>{0.268491507f, 0.733037353f},
-std::array<float,2>{0.535586953f, 0.780919731f},
-std::array<float,2>{0.36258617f, 0.499378026f},
-std::array<float,2>{0.88702172f, 0.208350211f},
-std::array<float,2>{0.0484411977f, 0.615386307f},
-std::array<float,2>{0.773741961f, 0.667030811f},
-std::array<float,2>{0.162535638f, 0.115709424f},
-std::array<float,2>{0.714758933f, 0.306099057f},
-std::array<float,2>{0.379945517f, 0.937564611f},
-std::array<float,2>{0.518311739f, 0.599942923f},
-std::array<float,2>{0.324617922f, 0.1889112f},
-std::array<float,2>{0.932281137f, 0.469222486f},
-std::array<float,2>{0.0129415533f, 0.753404677f},
-std::array<float,2>{0.790192544f, 0.95550108f},
-std::array<float,2>{0.130035743f, 0.293599606f},
-std::array<float,2>{0.720305681f, 0.10256207f},
-std::array<float,2>{0.431469232f, 0.683112502f},
-std::array<float,2>{0.655963421f, 0.818714559f},
-std::array<float,2>{0.478926122f, 0.375399858f},
-std::array<float,2>{0.851417542f, 0.147794157f},
-std::array<float,2>{0.239051148f, 0.537282109f},
-std::array<float,2>{0.97816515f, 0.739984453f},
-std::array<float,2>{0.124710239f, 0.0104930168f},
-std::array<float,2>{0.579690039f, 0.340509385f},
-std::array<float,2>{0.302157521f, 0.911303103f},
-std::array<float,2>{0.696777463f, 0.650026739f},
-std::array<float,2>{0.401809603f, 0.0656697378f},
-std::array<float,2>{0.751895249f, 0.257311076f},
-std::array<float,2>{0.181343183f, 0.9918046f},
-std::array<float,2>{0.906161427f, 0.792936623f},
-std::array<float,2>{0.0387304835f, 0.451510727f},
-std::array<float,2>{0.55133146f, 0.230779573f},
-std::array<float,2>{0.350570649f, 0.590157151f},
-std::array<float,2>{0.605787933f, 0.877616227f},
-std::array<float,2>{0.251643419f, 0.362548292f},
-std::array<float,2>{0.956115782f, 0.0418665186f},
-std::array<float,2>{0.0827711523f, 0.716688573f},
-std::array<float,2>{0.81960851f, 0.520153403f},
-std::array<float,2>{0.214474604f, 0.185743913f},
-std::array<float,2>{0.665955544f, 0.407808512f},
-std::array<float,2>{0.463460237f, 0.864132822f},
-std::array<float,2>{0.533525169f, 0.709295094f},
-std::array<float,2>{0.365145385f, 0.0389423594f},
-std::array<float,2>{0.884063184f, 0.37303403f},
-std::array<float,2>{0.0524310432f, 0.886506557f},
-std::array<float,2>{0.780070066f, 0.869465947f},
-std::array<float,2>{0.157218605f, 0.417493194f},
-std::array<float,2>{0.716262281f, 0.172122344f},
-std::array<float,2>{0.378213733f, 0.527350008f},
-std::array<float,2>{0.687161207f, 0.997430265f},
-std::array<float,2>{0.438218147f, 0.257982194f},
-std::array<float,2>{0.833342195f, 0.0727537051f},
-std::array<float,2>{0.192638382f, 0.643285096f},
-std::array<float,2>{0.949843884f, 0.580818832f},
-std::array<float,2>{0.0744553134f, 0.225167334f},
-std::array<float,2>{0.620297074f, 0.44083336f},
-std::array<float,2>{0.273374975f, 0.786611915f},
-std::array<float,2>{0.739866257f, 0.543898761f},
-std::array<float,2>{0.414269894f, 0.151357472f},
-std::array<float,2>{0.809880793f, 0.38818869f},
-std::array<float,2>{0.147795424f, 0.827370167f},
-std::array<float,2>{0.921627402f, 0.91498059f},
-std::array<float,2>{0.0218121763f, 0.330609828f},
-std::array<float,2>{0.504910171f, 0.00693865586f},
-std::array<float,2>{0.341754109f, 0.743413448f},
-std::array<float,2>{0.56455034f, 0.761471391f},
-std::array<float,2>{0.28480354f, 0.477843732f},
-std::array<float,2>{0.98823005f, 0.198856294f},
-std::array<float,2>{0.0983135849f, 0.608233869f},
-std::array<float,2>{0.865443826f, 0.672023952f},
-std::array<float,2>{0.222777322f, 0.094442822f},
-std::array<float,2>{0.634070337f, 0.281752706f},
-std::array<float,2>{0.494789481f, 0.962722421f},
-std::array<float,2>{0.603011727f, 0.620903909f},
-std::array<float,2>{0.254526764f, 0.21174188f},
-std::array<float,2>{0.959946632f, 0.490769774f},
-std::array<float,2>{0.0819474459f, 0.773122609f},
-std::array<float,2>{0.814068913f, 0.952726483f},
-std::array<float,2>{0.216228142f, 0.299863249f},
-std::array<float,2>{0.669653714f, 0.123139299f},
-std::array<float,2>{0.468396127f, 0.656359375f},
-std::array<float,2>{0.703013003f, 0.832975984f},
-std::array<float,2>{0.405285627f, 0.39612487f},
-std::array<float,2>{0.755048573f, 0.127845302f},
-std::array<float,2>{0.184924901f, 0.554790676f},
-std::array<float,2>{0.90199244f, 0.725102484f},
-std::array<float,2>{0.0344000459f, 0.0220065843f},
-std::array<float,2>{0.548239887f, 0.319098234f},
-std::array<float,2>{0.347213119f, 0.921875954f},
-std::array<float,2>{0.652129829f, 0.630363882f},
-std::array<float,2>{0.483901054f, 0.0820034742f},
-std::array<float,2>{0.845489204f, 0.276239306f},
-std::array<float,2>{0.234845802f, 0.970520675f},
-std::array<float,2>{0.983750999f, 0.797394276f},
-std::array<float,2>{0.119915083f, 0.46836549f},
-std::array<float,2>{0.585585415f, 0.239864483f},
-std::array<float,2>{0.299567997f, 0.570485651f},
-std::array<float,2>{0.521741986f, 0.890684485f},
-std::array<float,2>{0.320864499f, 0.343867064f},
-std::array<float,2>{0.935350955f, 0.0491771325f},
-std::array<float,2>{0.00815676153f, 0.692979634f},
-std::array<float,2>{0.793566763f, 0.514743388f},
-std::array<float,2>{0.128719404f, 0.161331594f},
-std::array<float,2>{0.724669337f, 0.426441103f},
-std::array<float,2>{0.434250206f, 0.847205102f},
-std::array<float,2>{0.589946032f, 0.669057846f},
-std::array<float,2>{0.305379659f, 0.10969954f},
-std::array<float,2>{0.969257414f, 0.312110156f},
-std::array<float,2>{0.114464395f, 0.941533327f},
-std::array<float,2>{0.85164243f, 0.773597658f},
-std::array<float,2>{0.24876754f, 0.496081829f},
-std::array<float,2>{0.644574046f, 0.206309646f},
-std::array<float,2>{0.472141594f, 0.609456599f},
-std::array<float,2>{0.728580713f, 0.937348604f},
-std::array<float,2>{0.427320749f, 0.320570081f},
-std::array<float,2>{0.784938097f, 0.0259112474f},
-std::array<float,2>{0.13883923f, 0.728932977f},
-std::array<float,2>{0.924953401f, 0.548255086f},
-std::array<float,2>{0.00692575146f, 0.139331639f},
-std::array<float,2>{0.529936433f, 0.405267507f},
-std::array<float,2>{0.313769579f, 0.837802947f},
-std::array<float,2>{0.663642466f, 0.56978476f},
-std::array<float,2>{0.45396933f, 0.24980323f},
-std::array<float,2>{0.822821558f, 0.458374292f},
-std::array<float,2>{0.206293643f, 0.810542405f},
-std::array<float,2>{0.963064253f, 0.983394682f},
-std::array<float,2>{0.0882430077f, 0.268973887f},
-std::array<float,2>{0.597806871f, 0.0906126946f},
-std::array<float,2>{0.261277437f, 0.637119055f},
-std::array<float,2>{0.556847155f, 0.851940453f},
-std::array<float,2>{0.355490029f, 0.436215758f},
-std::array<float,2>{0.896333158f, 0.170280874f},
-std::array<float,2>{0.0438520275f, 0.504384041f},
-std::array<float,2>{0.763051748f, 0.698617041f},
-std::array<float,2>{0.172189221f, 0.0595423728f},
-std::array<float,2>{0.693066835f, 0.35874486f},
-std::array<float,2>{0.394907087f, 0.901679575f},
-std::array<float,2>{0.512337267f, 0.518513501f},
-std::array<float,2>{0.335151047f, 0.179727301f},
-std::array<float,2>{0.908915877f, 0.41294831f},
-std::array<float,2>{0.0279151052f, 0.86216414f},
-std::array<float,2>{0.797902942f, 0.882624805f},
-std::array<float,2>{0.148961693f, 0.364876717f},
-std::array<float,2>{0.745862722f, 0.0458214581f},
-std::array<float,2>{0.412513852f, 0.714414895f},
-std::array<float,2>{0.628524244f, 0.795706391f},
-std::array<float,2>{0.48990804f, 0.446968555f},
-std::array<float,2>{0.870127261f, 0.227790266f},
-std::array<float,2>{0.227016628f, 0.589363396f},
-std::array<float,2>{0.998828113f, 0.653087795f},
-std::array<float,2>{0.101743653f, 0.0691006556f},
-std::array<float,2>{0.576769769f, 0.252840102f},
-std::array<float,2>{0.292321503f, 0.98806107f},
-std::array<float,2>{0.708291411f, 0.737701118f},
-std::array<float,2>{0.386612982f, 0.0137581816f},
-std::array<float,2>{0.77237606f, 0.338206232f},
-std::array<float,2>{0.170829028f, 0.909068406f},
-std::array<float,2>{0.876429796f, 0.814309359f},
-std::array<float,2>{0.0595196746f, 0.381113112f},
-std::array<float,2>{0.542505085f, 0.14292264f},
-std::array<float,2>{0.37499088f, 0.532222092f},
-std::array<float,2>{0.61573416f, 0.960265756f},
-std::array<float,2>{0.27814883f, 0.289273232f},
-std::array<float,2>{0.939222991f, 0.105512343f},
-std::array<float,2>{0.0651044697f, 0.686818182f},
-std::array<float,2>{0.838323891f, 0.595766306f},
-std::array<float,2>{0.199491262f, 0.192802116f},
-std::array<float,2>{0.679583669f, 0.473663092f},
-std::array<float,2>{0.446341306f, 0.75632602f},
-std::array<float,2>{0.526752889f, 0.646628797f},
-std::array<float,2>{0.319453627f, 0.0780365318f},
-std::array<float,2>{0.926046908f, 0.265360445f},
-std::array<float,2>{0.00156918878f, 0.994306684f},
-std::array<float,2>{0.787852883f, 0.783917069f},
-std::array<float,2>{0.136557594f, 0.445018083f},
-std::array<float,2>{0.731831014f, 0.219855666f},
-std::array<float,2>{0.424417555f, 0.584987283f},
-std::array<float,2>{0.642405808f, 0.890447319f},
-std::array<float,2>{0.474161595f, 0.367822886f},
-std::array<float,2>{0.857092202f, 0.0322109014f},
-std::array<float,2>{0.242579192f, 0.704308867f},
-std::array<float,2>{0.973260939f, 0.52669251f},
-std::array<float,2>{0.112289421f, 0.177154839f},
-std::array<float,2>{0.58689189f, 0.420253098f},
-std::array<float,2>{0.308925599f, 0.871442199f},
-std::array<float,2>{0.688926697f, 0.602177083f},
-std::array<float,2>{0.392430335f, 0.199671924f},
-std::array<float,2>{0.761177301f, 0.483362287f},
-std::array<float,2>{0.176222607f, 0.764032781f},
-std::array<float,2>{0.893058419f, 0.967322946f},
-std::array<float,2>{0.0427909717f, 0.286612689f},
-std::array<float,2>{0.558877587f, 0.101323649f},
-std::array<float,2>{0.354257613f, 0.676121533f},
-std::array<float,2>{0.597127378f, 0.821104705f},
-std::array<float,2>{0.26470235f, 0.383900553f},
-std::array<float,2>{0.967472553f, 0.153719008f},
-std::array<float,2>{0.0936749652f, 0.54192394f},
-std::array<float,2>{0.827202201f, 0.747809172f},
-std::array<float,2>{0.210174873f, 0.000316155027f},
-std::array<float,2>{0.656381726f, 0.335586816f},
-std::array<float,2>{0.458155155f, 0.920748711f},
-std::array<float,2>{0.572044611f, 0.56127125f},
-std::array<float,2>{0.295247734f, 0.130287066f},
-std::array<float,2>{0.995875359f, 0.392339885f},
-std::array<float,2>{0.108853728f, 0.828967392f},
-std::array<float,2>{0.874208391f, 0.92879349f},
-std::array<float,2>{0.230774313f, 0.31398949f},
-std::array<float,2>{0.629404485f, 0.0173253939f},
-std::array<float,2>{0.488085896f, 0.722224832f},
-std::array<float,2>{0.747174561f, 0.767958164f},
-std::array<float,2>{0.406871349f, 0.487486422f},
-std::array<float,2>{0.804411948f, 0.217822298f},
-std::array<float,2>{0.154970244f, 0.623427927f},
-std::array<float,2>{0.911618054f, 0.663238943f},
-std::array<float,2>{0.025191335f, 0.119206004f},
-std::array<float,2>{0.510465741f, 0.301589042f},
-std::array<float,2>{0.32869181f, 0.948987305f},
-std::array<float,2>{0.673584282f, 0.689841032f},
-std::array<float,2>{0.449305654f, 0.0509148911f},
-std::array<float,2>{0.840890884f, 0.350767404f},
-std::array<float,2>{0.198749349f, 0.894663751f},
-std::array<float,2>{0.941540241f, 0.850461662f},
-std::array<float,2>{0.067959249f, 0.423527986f},
-std::array<float,2>{0.610956252f, 0.158110708f},
-std::array<float,2>{0.275010347f, 0.510725915f},
-std::array<float,2>{0.545857787f, 0.972675145f},
-std::array<float,2>{0.367456824f, 0.280386299f},
-std::array<float,2>{0.881081283f, 0.0855632871f},
-std::array<float,2>{0.0567692406f, 0.625691652f},
-std::array<float,2>{0.766676307f, 0.577352583f},
-std::array<float,2>{0.167545214f, 0.234856054f},
-std::array<float,2>{0.705136299f, 0.464226127f},
-std::array<float,2>{0.390622854f, 0.803928673f},
-std::array<float,2>{0.623651743f, 0.731084526f},
-std::array<float,2>{0.266340673f, 0.0280899778f},
-std::array<float,2>{0.947798073f, 0.32594353f},
-std::array<float,2>{0.0714556724f, 0.931174815f},
-std::array<float,2>{0.828832448f, 0.84073174f},
-std::array<float,2>{0.189859197f, 0.401759714f},
-std::array<float,2>{0.682697237f, 0.133165956f},
-std::array<float,2>{0.443793833f, 0.552857995f},
-std::array<float,2>{0.712620497f, 0.940586507f},
-std::array<float,2>{0.382550329f, 0.306946456f},
-std::array<float,2>{0.7770648f, 0.114453636f},
-std::array<float,2>{0.160704613f, 0.664676964f},
-std::array<float,2>{0.890038729f, 0.613839686f},
-std::array<float,2>{0.0494804569f, 0.209022045f},
-std::array<float,2>{0.538045406f, 0.497286528f},
-std::array<float,2>{0.360124648f, 0.778154969f},
-std::array<float,2>{0.639936209f, 0.503331721f},
-std::array<float,2>{0.497889549f, 0.167370617f},
-std::array<float,2>{0.861748517f, 0.430735826f},
-std::array<float,2>{0.2198174f, 0.857906997f},
-std::array<float,2>{0.991257071f, 0.904818535f},
-std::array<float,2>{0.0955774561f, 0.355167061f},
-std::array<float,2>{0.570019543f, 0.056277521f},
-std::array<float,2>{0.286276937f, 0.699996412f},
-std::array<float,2>{0.50120151f, 0.806860447f},
-std::array<float,2>{0.33849597f, 0.456806719f},
-std::array<float,2>{0.917632759f, 0.245618641f},
-std::array<float,2>{0.0177089442f, 0.565478921f},
-std::array<float,2>{0.807172179f, 0.635657132f},
-std::array<float,2>{0.141621724f, 0.0868182629f},
-std::array<float,2>{0.734704196f, 0.271356463f},
-std::array<float,2>{0.418640643f, 0.977933049f},
-std::array<float,2>{0.554113925f, 0.593233407f},
-std::array<float,2>{0.34908253f, 0.234319523f},
-std::array<float,2>{0.903500676f, 0.44965291f},
-std::array<float,2>{0.0370433442f, 0.790709496f},
-std::array<float,2>{0.752576113f, 0.989924908f},
-std::array<float,2>{0.182410076f, 0.254149795f},
-std::array<float,2>{0.697920561f, 0.0639477596f},
-std::array<float,2>{0.398859203f, 0.651748359f},
-std::array<float,2>{0.66757679f, 0.865561604f},
-std::array<float,2>{0.461439073f, 0.408293635f},
-std::array<float,2>{0.818061173f, 0.184795305f},
-std::array<float,2>{0.211429819f, 0.521560729f},
-std::array<float,2>{0.954383969f, 0.718708932f},
-std::array<float,2>{0.085833624f, 0.0396432839f},
-std::array<float,2>{0.608000994f, 0.360032469f},
-std::array<float,2>{0.253603429f, 0.875443399f},
-std::array<float,2>{0.722526252f, 0.6803689f},
-std::array<float,2>{0.432121783f, 0.104838826f},
-std::array<float,2>{0.791244149f, 0.295748323f},
-std::array<float,2>{0.130903229f, 0.954181671f},
-std::array<float,2>{0.929774284f, 0.750826776f},
-std::array<float,2>{0.0154355243f, 0.4711577f},
-std::array<float,2>{0.517573595f, 0.190277368f},
-std::array<float,2>{0.327424854f, 0.598740518f},
-std::array<float,2>{0.581740379f, 0.912678063f},
-std::array<float,2>{0.303885579f, 0.342102051f},
-std::array<float,2>{0.979884386f, 0.00841948017f},
-std::array<float,2>{0.121738568f, 0.740525603f},
-std::array<float,2>{0.848828554f, 0.535993278f},
-std::array<float,2>{0.240319401f, 0.145688683f},
-std::array<float,2>{0.65417248f, 0.378580332f},
-std::array<float,2>{0.477392852f, 0.817463279f},
-std::array<float,2>{0.547699094f, 0.724230647f},
-std::array<float,2>{0.345799804f, 0.0205407012f},
-std::array<float,2>{0.900972724f, 0.316927195f},
-std::array<float,2>{0.0334222689f, 0.925273299f},
-std::array<float,2>{0.754107475f, 0.834750831f},
-std::array<float,2>{0.184174076f, 0.396542877f},
-std::array<float,2>{0.701256037f, 0.126063973f},
-std::array<float,2>{0.404997349f, 0.557919979f},
-std::array<float,2>{0.667971492f, 0.950041115f},
-std::array<float,2>{0.467284024f, 0.297739565f},
-std::array<float,2>{0.813151538f, 0.122357547f},
-std::array<float,2>{0.215228975f, 0.658212245f},
-std::array<float,2>{0.960134029f, 0.617998958f},
-std::array<float,2>{0.0803754106f, 0.214831993f},
-std::array<float,2>{0.601791859f, 0.489245236f},
-std::array<float,2>{0.255171716f, 0.770390987f},
-std::array<float,2>{0.726216853f, 0.512457013f},
-std::array<float,2>{0.435151309f, 0.162644148f},
-std::array<float,2>{0.794538617f, 0.427844018f},
-std::array<float,2>{0.127442122f, 0.844109476f},
-std::array<float,2>{0.934524596f, 0.894095778f},
-std::array<float,2>{0.00924730953f, 0.346536279f},
-std::array<float,2>{0.523357153f, 0.0487562753f},
-std::array<float,2>{0.32148236f, 0.695294201f},
-std::array<float,2>{0.584489405f, 0.800105929f},
-std::array<float,2>{0.300248682f, 0.466261178f},
-std::array<float,2>{0.983367741f, 0.240617007f},
-std::array<float,2>{0.120839171f, 0.573533058f},
-std::array<float,2>{0.84425807f, 0.631820679f},
-std::array<float,2>{0.23581256f, 0.0796528831f},
-std::array<float,2>{0.650685251f, 0.275186628f},
-std::array<float,2>{0.482878298f, 0.971687555f},
-std::array<float,2>{0.619462669f, 0.57911849f},
-std::array<float,2>{0.271780968f, 0.223534405f},
-std::array<float,2>{0.95024389f, 0.438502133f},
-std::array<float,2>{0.0753806084f, 0.787279546f},
-std::array<float,2>{0.832651973f, 0.99874264f},
-std::array<float,2>{0.19160822f, 0.261081249f},
-std::array<float,2>{0.686088264f, 0.0708828568f},
-std::array<float,2>{0.439138561f, 0.642119527f},
-std::array<float,2>{0.715033531f, 0.867503226f},
-std::array<float,2>{0.377593577f, 0.41547972f},
-std::array<float,2>{0.780749083f, 0.175533891f},
-std::array<float,2>{0.158021033f, 0.531037211f},
-std::array<float,2>{0.883240759f, 0.708428562f},
-std::array<float,2>{0.0508326925f, 0.0361122228f},
-std::array<float,2>{0.534799695f, 0.374347687f},
-std::array<float,2>{0.363564312f, 0.883434713f},
-std::array<float,2>{0.633211553f, 0.675207675f},
-std::array<float,2>{0.495825857f, 0.0963464975f},
-std::array<float,2>{0.86655724f, 0.283484608f},
-std::array<float,2>{0.22448194f, 0.964789569f},
-std::array<float,2>{0.986424863f, 0.759452641f},
-std::array<float,2>{0.0987432674f, 0.480298877f},
-std::array<float,2>{0.566397488f, 0.196374223f},
-std::array<float,2>{0.283700109f, 0.606687486f},
-std::array<float,2>{0.504063249f, 0.916729033f},
-std::array<float,2>{0.34034428f, 0.328170568f},
-std::array<float,2>{0.920448899f, 0.0052811061f},
-std::array<float,2>{0.0224935897f, 0.744539797f},
-std::array<float,2>{0.809490085f, 0.546415508f},
-std::array<float,2>{0.14705874f, 0.150206357f},
-std::array<float,2>{0.738649011f, 0.390461922f},
-std::array<float,2>{0.415322661f, 0.824983954f},
-std::array<float,2>{0.577616215f, 0.655439675f},
-std::array<float,2>{0.291117519f, 0.0678505227f},
-std::array<float,2>{0.999892116f, 0.251575321f},
-std::array<float,2>{0.103107721f, 0.98460716f},
-std::array<float,2>{0.869336009f, 0.79429853f},
-std::array<float,2>{0.228513762f, 0.448806763f},
-std::array<float,2>{0.627109528f, 0.230089039f},
-std::array<float,2>{0.488706321f, 0.586245716f},
-std::array<float,2>{0.744936228f, 0.880312979f},
-std::array<float,2>{0.413357288f, 0.366289884f},
-std::array<float,2>{0.79755348f, 0.04311933f},
-std::array<float,2>{0.149780586f, 0.712555707f},
-std::array<float,2>{0.909584999f, 0.517177165f},
-std::array<float,2>{0.0292177759f, 0.182855755f},
-std::array<float,2>{0.513566792f, 0.410323322f},
-std::array<float,2>{0.334353507f, 0.860176921f},
-std::array<float,2>{0.678289294f, 0.594796717f},
-std::array<float,2>{0.445715457f, 0.194312468f},
-std::array<float,2>{0.839501083f, 0.474650353f},
-std::array<float,2>{0.201020837f, 0.754009008f},
-std::array<float,2>{0.938255608f, 0.958123922f},
-std::array<float,2>{0.0659792498f, 0.291602552f},
-std::array<float,2>{0.616727173f, 0.108331501f},
-std::array<float,2>{0.278892368f, 0.683846235f},
-std::array<float,2>{0.541071534f, 0.814867318f},
-std::array<float,2>{0.373341829f, 0.378908962f},
-std::array<float,2>{0.875533283f, 0.14157483f},
-std::array<float,2>{0.0596574955f, 0.534533739f},
-std::array<float,2>{0.77287519f, 0.735562444f},
-std::array<float,2>{0.171608195f, 0.0129411155f},
-std::array<float,2>{0.707953751f, 0.337814927f},
-std::array<float,2>{0.384946942f, 0.906584322f},
-std::array<float,2>{0.530852258f, 0.550264359f},
-std::array<float,2>{0.312931359f, 0.137923732f},
-std::array<float,2>{0.924373209f, 0.402576327f},
-std::array<float,2>{0.0060201562f, 0.839710474f},
-std::array<float,2>{0.783291876f, 0.935126245f},
-std::array<float,2>{0.139987394f, 0.323052853f},
-std::array<float,2>{0.729796469f, 0.0247315411f},
-std::array<float,2>{0.42641297f, 0.726713419f},
-std::array<float,2>{0.646042347f, 0.775835276f},
-std::array<float,2>{0.471024066f, 0.493207872f},
-std::array<float,2>{0.853054702f, 0.204454646f},
-std::array<float,2>{0.249587461f, 0.612134576f},
-std::array<float,2>{0.970248699f, 0.671379268f},
-std::array<float,2>{0.113578372f, 0.113134727f},
-std::array<float,2>{0.591035187f, 0.309877723f},
-std::array<float,2>{0.305922955f, 0.944728494f},
-std::array<float,2>{0.692252815f, 0.697093725f},
-std::array<float,2>{0.395559102f, 0.0623415112f},
-std::array<float,2>{0.762464046f, 0.356776923f},
-std::array<float,2>{0.172982499f, 0.900121093f},
-std::array<float,2>{0.895407856f, 0.854780316f},
-std::array<float,2>{0.0443661995f, 0.434946924f},
-std::array<float,2>{0.558370709f, 0.168484837f},
-std::array<float,2>{0.356846213f, 0.507516861f},
-std::array<float,2>{0.59935534f, 0.981380701f},
-std::array<float,2>{0.26036185f, 0.267303377f},
-std::array<float,2>{0.963925719f, 0.0925939083f},
-std::array<float,2>{0.0891089737f, 0.639934003f},
-std::array<float,2>{0.824018478f, 0.567521751f},
-std::array<float,2>{0.205704555f, 0.247852653f},
-std::array<float,2>{0.662752569f, 0.459398419f},
-std::array<float,2>{0.454277217f, 0.811158955f},
-std::array<float,2>{0.511613667f, 0.661365569f},
-std::array<float,2>{0.329598069f, 0.118932523f},
-std::array<float,2>{0.910873234f, 0.303507447f},
-std::array<float,2>{0.0242711492f, 0.945458114f},
-std::array<float,2>{0.803070545f, 0.766631544f},
-std::array<float,2>{0.155930534f, 0.484382957f},
-std::array<float,2>{0.747005582f, 0.215614229f},
-std::array<float,2>{0.408055574f, 0.622076392f},
-std::array<float,2>{0.629992425f, 0.926658332f},
-std::array<float,2>{0.486657888f, 0.314478278f},
-std::array<float,2>{0.873367786f, 0.0180559456f},
-std::array<float,2>{0.23230648f, 0.719484806f},
-std::array<float,2>{0.995048344f, 0.560259819f},
-std::array<float,2>{0.107937992f, 0.131216303f},
-std::array<float,2>{0.570812762f, 0.393096089f},
-std::array<float,2>{0.296379924f, 0.830808222f},
-std::array<float,2>{0.706097007f, 0.575032055f},
-std::array<float,2>{0.389184594f, 0.236490145f},
-std::array<float,2>{0.766542196f, 0.461355805f},
-std::array<float,2>{0.166527271f, 0.801932633f},
-std::array<float,2>{0.882604003f, 0.976104856f},
-std::array<float,2>{0.0584269837f, 0.277730703f},
-std::array<float,2>{0.546132445f, 0.0829965323f},
-std::array<float,2>{0.368750095f, 0.628345907f},
-std::array<float,2>{0.610291064f, 0.849112213f},
-std::array<float,2>{0.273825109f, 0.424549699f},
-std::array<float,2>{0.942809522f, 0.158784166f},
-std::array<float,2>{0.066840522f, 0.509535253f},
-std::array<float,2>{0.840342999f, 0.689169228f},
-std::array<float,2>{0.197602808f, 0.0538460426f},
-std::array<float,2>{0.672609866f, 0.347723454f},
-std::array<float,2>{0.450888783f, 0.898071349f},
-std::array<float,2>{0.587589443f, 0.525349855f},
-std::array<float,2>{0.31021294f, 0.178944454f},
-std::array<float,2>{0.974535227f, 0.418640614f},
-std::array<float,2>{0.112557665f, 0.873460233f},
-std::array<float,2>{0.856130242f, 0.887313247f},
-std::array<float,2>{0.243678123f, 0.370378166f},
-std::array<float,2>{0.641237736f, 0.0350689404f},
-std::array<float,2>{0.472905546f, 0.705578506f},
-std::array<float,2>{0.731430948f, 0.782234907f},
-std::array<float,2>{0.425589502f, 0.442760825f},
-std::array<float,2>{0.7889539f, 0.222373247f},
-std::array<float,2>{0.134882033f, 0.583281457f},
-std::array<float,2>{0.927381456f, 0.645216584f},
-std::array<float,2>{0.000871344178f, 0.0752869993f},
-std::array<float,2>{0.525447547f, 0.262327433f},
-std::array<float,2>{0.318971366f, 0.993794262f},
-std::array<float,2>{0.657832086f, 0.749684036f},
-std::array<float,2>{0.457160622f, 0.00265058991f},
-std::array<float,2>{0.827114105f, 0.332167804f},
-std::array<float,2>{0.209109068f, 0.918167412f},
-std::array<float,2>{0.968454897f, 0.823367417f},
-std::array<float,2>{0.0921488553f, 0.385825843f},
-std::array<float,2>{0.596635997f, 0.156069383f},
-std::array<float,2>{0.264528841f, 0.54007709f},
-std::array<float,2>{0.560218513f, 0.96530658f},
-std::array<float,2>{0.355355293f, 0.287428737f},
-std::array<float,2>{0.893906891f, 0.098885417f},
-std::array<float,2>{0.0416975729f, 0.678901136f},
-std::array<float,2>{0.760486543f, 0.604482114f},
-std::array<float,2>{0.176827297f, 0.201561958f},
-std::array<float,2>{0.688218594f, 0.481025487f},
-std::array<float,2>{0.3909235f, 0.762662649f},
-std::array<float,2>{0.608705819f, 0.715037644f},
-std::array<float,2>{0.252057195f, 0.042703338f},
-std::array<float,2>{0.953229427f, 0.362065524f},
-std::array<float,2>{0.0840732679f, 0.878799021f},
-std::array<float,2>{0.817004502f, 0.864343107f},
-std::array<float,2>{0.212187499f, 0.406468242f},
-std::array<float,2>{0.666567028f, 0.187311083f},
-std::array<float,2>{0.462762266f, 0.521093667f},
-std::array<float,2>{0.699094534f, 0.990448356f},
-std::array<float,2>{0.399740279f, 0.255893141f},
-std::array<float,2>{0.753662467f, 0.0648029372f},
-std::array<float,2>{0.183307946f, 0.648778439f},
-std::array<float,2>{0.902679086f, 0.590942204f},
-std::array<float,2>{0.0360361934f, 0.231680617f},
-std::array<float,2>{0.553613245f, 0.452699721f},
-std::array<float,2>{0.348061979f, 0.791978657f},
-std::array<float,2>{0.652978539f, 0.538965523f},
-std::array<float,2>{0.477827698f, 0.146654487f},
-std::array<float,2>{0.848148763f, 0.376085311f},
-std::array<float,2>{0.241494715f, 0.819494784f},
-std::array<float,2>{0.978758156f, 0.910845339f},
-std::array<float,2>{0.12278033f, 0.341363639f},
-std::array<float,2>{0.580750704f, 0.0110059818f},
-std::array<float,2>{0.303675681f, 0.739016533f},
-std::array<float,2>{0.515659988f, 0.752438784f},
-std::array<float,2>{0.327007562f, 0.470285624f},
-std::array<float,2>{0.930789351f, 0.187842518f},
-std::array<float,2>{0.0145270741f, 0.601044714f},
-std::array<float,2>{0.792019188f, 0.682129025f},
-std::array<float,2>{0.132128656f, 0.102165885f},
-std::array<float,2>{0.721448243f, 0.29466179f},
-std::array<float,2>{0.432681173f, 0.956227005f},
-std::array<float,2>{0.538348138f, 0.616978347f},
-std::array<float,2>{0.361305296f, 0.208000973f},
-std::array<float,2>{0.888734937f, 0.498520941f},
-std::array<float,2>{0.0501312241f, 0.779426277f},
-std::array<float,2>{0.776291609f, 0.939202905f},
-std::array<float,2>{0.161888599f, 0.304741114f},
-std::array<float,2>{0.711008728f, 0.116244152f},
-std::array<float,2>{0.380972147f, 0.666857421f},
-std::array<float,2>{0.682049036f, 0.841822147f},
-std::array<float,2>{0.445206434f, 0.400056064f},
-std::array<float,2>{0.8295995f, 0.135756239f},
-std::array<float,2>{0.19122988f, 0.551255822f},
-std::array<float,2>{0.948484659f, 0.733399987f},
-std::array<float,2>{0.0710378289f, 0.0311936922f},
-std::array<float,2>{0.624890447f, 0.326465309f},
-std::array<float,2>{0.26707986f, 0.932812274f},
-std::array<float,2>{0.735649109f, 0.633196056f},
-std::array<float,2>{0.419358253f, 0.0893770009f},
-std::array<float,2>{0.807773113f, 0.273240149f},
-std::array<float,2>{0.141082481f, 0.978742778f},
-std::array<float,2>{0.916339397f, 0.805723727f},
-std::array<float,2>{0.0189153962f, 0.45426029f},
-std::array<float,2>{0.50094378f, 0.243956298f},
-std::array<float,2>{0.33968088f, 0.563946664f},
-std::array<float,2>{0.56885463f, 0.903383672f},
-std::array<float,2>{0.285629839f, 0.352283537f},
-std::array<float,2>{0.990386724f, 0.0570179708f},
-std::array<float,2>{0.0940961391f, 0.702401996f},
-std::array<float,2>{0.862914741f, 0.501523614f},
-std::array<float,2>{0.21887964f, 0.164259881f},
-std::array<float,2>{0.638743639f, 0.432410777f},
-std::array<float,2>{0.496133685f, 0.856818974f},
-std::array<float,2>{0.521291196f, 0.692050576f},
-std::array<float,2>{0.323664665f, 0.0503040738f},
-std::array<float,2>{0.935590029f, 0.34496966f},
-std::array<float,2>{0.0105640087f, 0.892205656f},
-std::array<float,2>{0.795738161f, 0.846320152f},
-std::array<float,2>{0.125723347f, 0.426838487f},
-std::array<float,2>{0.723592341f, 0.160868213f},
-std::array<float,2>{0.436570853f, 0.513992608f},
-std::array<float,2>{0.64916271f, 0.969606757f},
-std::array<float,2>{0.481317252f, 0.276445985f},
-std::array<float,2>{0.846879065f, 0.0802626237f},
-std::array<float,2>{0.237197325f, 0.629653335f},
-std::array<float,2>{0.982288659f, 0.572152972f},
-std::array<float,2>{0.118412033f, 0.239052474f},
-std::array<float,2>{0.58366251f, 0.467635691f},
-std::array<float,2>{0.298511982f, 0.798673213f},
-std::array<float,2>{0.700314879f, 0.556551754f},
-std::array<float,2>{0.404121369f, 0.128413811f},
-std::array<float,2>{0.756262481f, 0.395019144f},
-std::array<float,2>{0.186239868f, 0.83324486f},
-std::array<float,2>{0.898763955f, 0.923513949f},
-std::array<float,2>{0.0318917818f, 0.32009086f},
-std::array<float,2>{0.550232351f, 0.0230673328f},
-std::array<float,2>{0.344242513f, 0.725691259f},
-std::array<float,2>{0.605393052f, 0.772060573f},
-std::array<float,2>{0.255944401f, 0.491307616f},
-std::array<float,2>{0.958402991f, 0.212146372f},
-std::array<float,2>{0.0787443966f, 0.619191289f},
-std::array<float,2>{0.814876735f, 0.657788277f},
-std::array<float,2>{0.218074352f, 0.124507375f},
-std::array<float,2>{0.670695543f, 0.298991889f},
-std::array<float,2>{0.465010881f, 0.951290846f},
-std::array<float,2>{0.563809037f, 0.609030485f},
-std::array<float,2>{0.283169389f, 0.197541758f},
-std::array<float,2>{0.985951245f, 0.477091938f},
-std::array<float,2>{0.0998918414f, 0.760194242f},
-std::array<float,2>{0.864714861f, 0.961620033f},
-std::array<float,2>{0.224936068f, 0.282725483f},
-std::array<float,2>{0.635667741f, 0.0951835886f},
-std::array<float,2>{0.493490279f, 0.672879815f},
-std::array<float,2>{0.741269708f, 0.82623291f},
-std::array<float,2>{0.416306019f, 0.387659013f},
-std::array<float,2>{0.811046243f, 0.152340397f},
-std::array<float,2>{0.144567177f, 0.544718683f},
-std::array<float,2>{0.919782698f, 0.742429316f},
-std::array<float,2>{0.0205033552f, 0.0063265753f},
-std::array<float,2>{0.50701648f, 0.331410825f},
-std::array<float,2>{0.342305779f, 0.915175438f},
-std::array<float,2>{0.684933901f, 0.644104183f},
-std::array<float,2>{0.439959764f, 0.0733125731f},
-std::array<float,2>{0.834395647f, 0.259591728f},
-std::array<float,2>{0.193535984f, 0.997036338f},
-std::array<float,2>{0.951228678f, 0.785646617f},
-std::array<float,2>{0.0763233081f, 0.440060556f},
-std::array<float,2>{0.618210673f, 0.225587383f},
-std::array<float,2>{0.270527869f, 0.581376195f},
-std::array<float,2>{0.532240391f, 0.885051668f},
-std::array<float,2>{0.36638096f, 0.372045338f},
-std::array<float,2>{0.885458529f, 0.0379430428f},
-std::array<float,2>{0.0529317744f, 0.710918486f},
-std::array<float,2>{0.778312981f, 0.529231966f},
-std::array<float,2>{0.158715993f, 0.173307762f},
-std::array<float,2>{0.717986405f, 0.416305572f},
-std::array<float,2>{0.375251263f, 0.870542943f},
-std::array<float,2>{0.614057302f, 0.686232328f},
-std::array<float,2>{0.279591948f, 0.106965102f},
-std::array<float,2>{0.939887166f, 0.290709496f},
-std::array<float,2>{0.0634587184f, 0.95954448f},
-std::array<float,2>{0.837377429f, 0.757482708f},
-std::array<float,2>{0.202397659f, 0.473329753f},
-std::array<float,2>{0.676769078f, 0.191842303f},
-std::array<float,2>{0.448519439f, 0.596980155f},
-std::array<float,2>{0.710677981f, 0.909700453f},
-std::array<float,2>{0.384148061f, 0.338923067f},
-std::array<float,2>{0.770655394f, 0.0151934111f},
-std::array<float,2>{0.168636128f, 0.736434937f},
-std::array<float,2>{0.877052665f, 0.532630265f},
-std::array<float,2>{0.0606997907f, 0.144079581f},
-std::array<float,2>{0.540759504f, 0.382676125f},
-std::array<float,2>{0.3725878f, 0.813363671f},
-std::array<float,2>{0.62511152f, 0.588074625f},
-std::array<float,2>{0.49140811f, 0.227342337f},
-std::array<float,2>{0.867734492f, 0.445344239f},
-std::array<float,2>{0.22875011f, 0.796442986f},
-std::array<float,2>{0.996255636f, 0.986422062f},
-std::array<float,2>{0.104975715f, 0.253063411f},
-std::array<float,2>{0.575969458f, 0.0696756467f},
-std::array<float,2>{0.289471626f, 0.653739452f},
-std::array<float,2>{0.514057159f, 0.863206625f},
-std::array<float,2>{0.332700729f, 0.413550943f},
-std::array<float,2>{0.907023549f, 0.180907756f},
-std::array<float,2>{0.0303747635f, 0.519414902f},
-std::array<float,2>{0.799348414f, 0.713810205f},
-std::array<float,2>{0.150594547f, 0.0465332866f},
-std::array<float,2>{0.743077636f, 0.363746315f},
-std::array<float,2>{0.410955399f, 0.881787241f},
-std::array<float,2>{0.555791497f, 0.505406201f},
-std::array<float,2>{0.358985811f, 0.171726555f},
-std::array<float,2>{0.897694409f, 0.436635226f},
-std::array<float,2>{0.0464004613f, 0.853344083f},
-std::array<float,2>{0.764763117f, 0.900689125f},
-std::array<float,2>{0.175516412f, 0.357752621f},
-std::array<float,2>{0.694975317f, 0.0602315962f},
-std::array<float,2>{0.396858662f, 0.697905004f},
-std::array<float,2>{0.660359085f, 0.8089481f},
-std::array<float,2>{0.45617038f, 0.45745796f},
-std::array<float,2>{0.821197331f, 0.248850033f},
-std::array<float,2>{0.203461379f, 0.568780482f},
-std::array<float,2>{0.960994244f, 0.638447285f},
-std::array<float,2>{0.0863713175f, 0.0917122737f},
-std::array<float,2>{0.600226402f, 0.268108398f},
-std::array<float,2>{0.259341508f, 0.983836591f},
-std::array<float,2>{0.728463888f, 0.729768515f},
-std::array<float,2>{0.428592235f, 0.0270566195f},
-std::array<float,2>{0.782802999f, 0.321360737f},
-std::array<float,2>{0.136809617f, 0.935682297f},
-std::array<float,2>{0.922815621f, 0.83665657f},
-std::array<float,2>{0.00570674799f, 0.405687302f},
-std::array<float,2>{0.528956234f, 0.140610233f},
-std::array<float,2>{0.315290242f, 0.547705352f},
-std::array<float,2>{0.591982961f, 0.943145514f},
-std::array<float,2>{0.307547629f, 0.311405748f},
-std::array<float,2>{0.971691251f, 0.111199804f},
-std::array<float,2>{0.115703307f, 0.667988241f},
-std::array<float,2>{0.854654789f, 0.610988021f},
-std::array<float,2>{0.246581748f, 0.205518693f},
-std::array<float,2>{0.647179306f, 0.49474889f},
-std::array<float,2>{0.469693989f, 0.774680853f},
-std::array<float,2>{0.544038713f, 0.626663387f},
-std::array<float,2>{0.369942933f, 0.0840289667f},
-std::array<float,2>{0.880083442f, 0.279362112f},
-std::array<float,2>{0.0564140268f, 0.97399354f},
-std::array<float,2>{0.768636227f, 0.803017557f},
-std::array<float,2>{0.165439963f, 0.463816017f},
-std::array<float,2>{0.703198195f, 0.235629186f},
-std::array<float,2>{0.387732327f, 0.576253891f},
-std::array<float,2>{0.67572403f, 0.895944118f},
-std::array<float,2>{0.452296376f, 0.350585252f},
-std::array<float,2>{0.842931032f, 0.0525644384f},
-std::array<float,2>{0.196538284f, 0.691238999f},
-std::array<float,2>{0.944032907f, 0.511095047f},
-std::array<float,2>{0.0683685839f, 0.156789362f},
-std::array<float,2>{0.611976683f, 0.422392517f},
-std::array<float,2>{0.276371688f, 0.850867033f},
-std::array<float,2>{0.748579264f, 0.624932945f},
-std::array<float,2>{0.40948379f, 0.217526302f},
-std::array<float,2>{0.802703559f, 0.486576676f},
-std::array<float,2>{0.15427044f, 0.768614292f},
-std::array<float,2>{0.913175702f, 0.947462976f},
-std::array<float,2>{0.0266092811f, 0.302102f},
-std::array<float,2>{0.50973022f, 0.120720625f},
-std::array<float,2>{0.330429882f, 0.662275195f},
-std::array<float,2>{0.573884726f, 0.829489112f},
-std::array<float,2>{0.293755978f, 0.391138732f},
-std::array<float,2>{0.994095564f, 0.12935248f},
-std::array<float,2>{0.10618218f, 0.5618788f},
-std::array<float,2>{0.872255206f, 0.721610665f},
-std::array<float,2>{0.233646452f, 0.0161550697f},
-std::array<float,2>{0.630863547f, 0.312847853f},
-std::array<float,2>{0.485315382f, 0.928151309f},
-std::array<float,2>{0.594444036f, 0.542046845f},
-std::array<float,2>{0.26188603f, 0.152888983f},
-std::array<float,2>{0.96550256f, 0.383398235f},
-std::array<float,2>{0.0900331438f, 0.821856022f},
-std::array<float,2>{0.824537575f, 0.921017468f},
-std::array<float,2>{0.208698854f, 0.334725469f},
-std::array<float,2>{0.659222484f, 0.00132467644f},
-std::array<float,2>{0.460514277f, 0.746105969f},
-std::array<float,2>{0.690775931f, 0.765352726f},
-std::array<float,2>{0.393973202f, 0.483612776f},
-std::array<float,2>{0.758278906f, 0.200562567f},
-std::array<float,2>{0.178617999f, 0.603293359f},
-std::array<float,2>{0.891631782f, 0.67709142f},
-std::array<float,2>{0.0403990522f, 0.100467376f},
-std::array<float,2>{0.560907722f, 0.285878569f},
-std::array<float,2>{0.352527022f, 0.967821062f},
-std::array<float,2>{0.64346689f, 0.703502536f},
-std::array<float,2>{0.475178182f, 0.0326867625f},
-std::array<float,2>{0.858398557f, 0.368691236f},
-std::array<float,2>{0.244395047f, 0.889196157f},
-std::array<float,2>{0.976276636f, 0.872170806f},
-std::array<float,2>{0.109812818f, 0.421144366f},
-std::array<float,2>{0.5889166f, 0.176198885f},
-std::array<float,2>{0.310648203f, 0.526115477f},
-std::array<float,2>{0.524473488f, 0.995636582f},
-std::array<float,2>{0.317021698f, 0.264412701f},
-std::array<float,2>{0.92907393f, 0.0768339261f},
-std::array<float,2>{0.00202493486f, 0.648208618f},
-std::array<float,2>{0.786141455f, 0.584555149f},
-std::array<float,2>{0.133198515f, 0.218758747f},
-std::array<float,2>{0.73248148f, 0.444058955f},
-std::array<float,2>{0.422762752f, 0.784705162f},
-std::array<float,2>{0.578267574f, 0.742174149f},
-std::array<float,2>{0.300828695f, 0.00915254187f},
-std::array<float,2>{0.977342486f, 0.342954725f},
-std::array<float,2>{0.12334615f, 0.913587332f},
-std::array<float,2>{0.850184202f, 0.816954255f},
-std::array<float,2>{0.239683583f, 0.377900898f},
-std::array<float,2>{0.654374897f, 0.14534983f},
-std::array<float,2>{0.479710191f, 0.536557496f},
-std::array<float,2>{0.719029546f, 0.953831732f},
-std::array<float,2>{0.430591345f, 0.296173364f},
-std::array<float,2>{0.789213181f, 0.104158908f},
-std::array<float,2>{0.129436329f, 0.681158245f},
-std::array<float,2>{0.933224797f, 0.598057747f},
-std::array<float,2>{0.0117454138f, 0.190535709f},
-std::array<float,2>{0.518747151f, 0.472622275f},
-std::array<float,2>{0.325522393f, 0.751811683f},
-std::array<float,2>{0.665001273f, 0.522874773f},
-std::array<float,2>{0.464640111f, 0.184442952f},
-std::array<float,2>{0.818678796f, 0.40980497f},
-std::array<float,2>{0.21378544f, 0.86697191f},
-std::array<float,2>{0.955557287f, 0.876857102f},
-std::array<float,2>{0.0837184787f, 0.360609621f},
-std::array<float,2>{0.606671214f, 0.0403398871f},
-std::array<float,2>{0.250615925f, 0.717567027f},
-std::array<float,2>{0.552429378f, 0.789469779f},
-std::array<float,2>{0.351151496f, 0.450578392f},
-std::array<float,2>{0.904749453f, 0.232868075f},
-std::array<float,2>{0.0374869704f, 0.591982484f},
-std::array<float,2>{0.750971496f, 0.651007414f},
-std::array<float,2>{0.179801017f, 0.0632201731f},
-std::array<float,2>{0.695461154f, 0.255028337f},
-std::array<float,2>{0.400822908f, 0.988948286f},
-std::array<float,2>{0.503112793f, 0.564843357f},
-std::array<float,2>{0.337245375f, 0.244874015f},
-std::array<float,2>{0.914148033f, 0.455589712f},
-std::array<float,2>{0.0157551579f, 0.808304846f},
-std::array<float,2>{0.804814637f, 0.976650715f},
-std::array<float,2>{0.143064708f, 0.270096183f},
-std::array<float,2>{0.736472249f, 0.0871455818f},
-std::array<float,2>{0.421482533f, 0.63610512f},
-std::array<float,2>{0.638096869f, 0.858497322f},
-std::array<float,2>{0.499336362f, 0.429822475f},
-std::array<float,2>{0.859598935f, 0.166265175f},
-std::array<float,2>{0.222524703f, 0.502376974f},
-std::array<float,2>{0.989783645f, 0.700653493f},
-std::array<float,2>{0.0965271145f, 0.0554177538f},
-std::array<float,2>{0.567116261f, 0.353778422f},
-std::array<float,2>{0.28822127f, 0.905828297f},
-std::array<float,2>{0.713060498f, 0.665416121f},
-std::array<float,2>{0.379047871f, 0.114038669f},
-std::array<float,2>{0.774561286f, 0.307805955f},
-std::array<float,2>{0.163688183f, 0.940411806f},
-std::array<float,2>{0.887987137f, 0.778550804f},
-std::array<float,2>{0.0478116348f, 0.496656388f},
-std::array<float,2>{0.536728024f, 0.210735783f},
-std::array<float,2>{0.361940682f, 0.61482197f},
-std::array<float,2>{0.621825874f, 0.930111349f},
-std::array<float,2>{0.268864214f, 0.324416012f},
-std::array<float,2>{0.945912421f, 0.0285726897f},
-std::array<float,2>{0.0726149604f, 0.731608152f},
-std::array<float,2>{0.830279291f, 0.554461002f},
-std::array<float,2>{0.188570485f, 0.134440407f},
-std::array<float,2>{0.680174828f, 0.401363373f},
-std::array<float,2>{0.441601187f, 0.840924323f},
-std::array<float,2>{0.528356731f, 0.727378368f},
-std::array<float,2>{0.314922452f, 0.0249986667f},
-std::array<float,2>{0.921964228f, 0.32264328f},
-std::array<float,2>{0.00530406972f, 0.934920192f},
-std::array<float,2>{0.782468975f, 0.839064837f},
-std::array<float,2>{0.137256175f, 0.402940065f},
-std::array<float,2>{0.727792144f, 0.138297424f},
-std::array<float,2>{0.427972972f, 0.550336897f},
-std::array<float,2>{0.64686656f, 0.945009589f},
-std::array<float,2>{0.468957931f, 0.310307682f},
-std::array<float,2>{0.855127633f, 0.112407185f},
-std::array<float,2>{0.246740714f, 0.67183876f},
-std::array<float,2>{0.972251296f, 0.611760736f},
-std::array<float,2>{0.115984745f, 0.204956099f},
-std::array<float,2>{0.592710495f, 0.494104534f},
-std::array<float,2>{0.306942374f, 0.776283443f},
-std::array<float,2>{0.694355905f, 0.506919742f},
-std::array<float,2>{0.397267342f, 0.168020129f},
-std::array<float,2>{0.765162706f, 0.435207129f},
-std::array<float,2>{0.175016746f, 0.855362356f},
-std::array<float,2>{0.898089826f, 0.899437726f},
-std::array<float,2>{0.0463315621f, 0.357124388f},
-std::array<float,2>{0.556223631f, 0.0619341694f},
-std::array<float,2>{0.358594298f, 0.696633458f},
-std::array<float,2>{0.599998057f, 0.810725451f},
-std::array<float,2>{0.259000123f, 0.459519446f},
-std::array<float,2>{0.961664557f, 0.247180477f},
-std::array<float,2>{0.086872682f, 0.568131685f},
-std::array<float,2>{0.820774019f, 0.640388131f},
-std::array<float,2>{0.203847006f, 0.0921799242f},
-std::array<float,2>{0.661055028f, 0.267072558f},
-std::array<float,2>{0.456945598f, 0.980891228f},
-std::array<float,2>{0.575420141f, 0.586553812f},
-std::array<float,2>{0.289641768f, 0.229707167f},
-std::array<float,2>{0.996852636f, 0.448582351f},
-std::array<float,2>{0.105323367f, 0.794760823f},
-std::array<float,2>{0.867380857f, 0.985033274f},
-std::array<float,2>{0.229253426f, 0.25136295f},
-std::array<float,2>{0.625951946f, 0.068313323f},
-std::array<float,2>{0.491739124f, 0.656141758f},
-std::array<float,2>{0.742299974f, 0.859674811f},
-std::array<float,2>{0.410460442f, 0.410753101f},
-std::array<float,2>{0.799194813f, 0.183487192f},
-std::array<float,2>{0.151230082f, 0.516785026f},
-std::array<float,2>{0.906333983f, 0.711984158f},
-std::array<float,2>{0.031224316f, 0.0437919088f},
-std::array<float,2>{0.514327049f, 0.3667216f},
-std::array<float,2>{0.332300514f, 0.880411685f},
-std::array<float,2>{0.677573442f, 0.684155822f},
-std::array<float,2>{0.448788434f, 0.107549176f},
-std::array<float,2>{0.837520599f, 0.291129738f},
-std::array<float,2>{0.202801406f, 0.958775043f},
-std::array<float,2>{0.940359592f, 0.754816234f},
-std::array<float,2>{0.0628539324f, 0.475177377f},
-std::array<float,2>{0.613571703f, 0.193649754f},
-std::array<float,2>{0.280260831f, 0.595631003f},
-std::array<float,2>{0.540340424f, 0.906940162f},
-std::array<float,2>{0.372399122f, 0.337213784f},
-std::array<float,2>{0.877740204f, 0.0133749526f},
-std::array<float,2>{0.0612566657f, 0.735881329f},
-std::array<float,2>{0.771180749f, 0.534768164f},
-std::array<float,2>{0.168067053f, 0.140832856f},
-std::array<float,2>{0.710054636f, 0.379545748f},
-std::array<float,2>{0.384553313f, 0.815049946f},
-std::array<float,2>{0.618716002f, 0.641765296f},
-std::array<float,2>{0.271362007f, 0.0706432909f},
-std::array<float,2>{0.951957464f, 0.261480987f},
-std::array<float,2>{0.0768962353f, 0.998277307f},
-std::array<float,2>{0.834497213f, 0.787693381f},
-std::array<float,2>{0.194077015f, 0.439160317f},
-std::array<float,2>{0.685138464f, 0.223106697f},
-std::array<float,2>{0.439840317f, 0.579800248f},
-std::array<float,2>{0.718280435f, 0.882927537f},
-std::array<float,2>{0.375953227f, 0.374600679f},
-std::array<float,2>{0.777472019f, 0.0353503563f},
-std::array<float,2>{0.158680052f, 0.708571553f},
-std::array<float,2>{0.884813726f, 0.530351818f},
-std::array<float,2>{0.0536130294f, 0.175122485f},
-std::array<float,2>{0.533100963f, 0.415759921f},
-std::array<float,2>{0.367035836f, 0.868028641f},
-std::array<float,2>{0.634855032f, 0.607410848f},
-std::array<float,2>{0.493878692f, 0.196903765f},
-std::array<float,2>{0.865023434f, 0.479596168f},
-std::array<float,2>{0.225174144f, 0.758926034f},
-std::array<float,2>{0.985538363f, 0.964026093f},
-std::array<float,2>{0.100465313f, 0.284137815f},
-std::array<float,2>{0.564044893f, 0.0960461125f},
-std::array<float,2>{0.282637179f, 0.675412476f},
-std::array<float,2>{0.50734359f, 0.824623704f},
-std::array<float,2>{0.342196763f, 0.390128404f},
-std::array<float,2>{0.918951571f, 0.149775326f},
-std::array<float,2>{0.0196280573f, 0.546367228f},
-std::array<float,2>{0.810858905f, 0.745058298f},
-std::array<float,2>{0.145319849f, 0.005555382f},
-std::array<float,2>{0.741801918f, 0.328895539f},
-std::array<float,2>{0.416877329f, 0.916445434f},
-std::array<float,2>{0.550523162f, 0.558362782f},
-std::array<float,2>{0.343782067f, 0.126905799f},
-std::array<float,2>{0.899368167f, 0.397064537f},
-std::array<float,2>{0.0313812792f, 0.834373355f},
-std::array<float,2>{0.756352901f, 0.925296068f},
-std::array<float,2>{0.185632691f, 0.316674471f},
-std::array<float,2>{0.700840771f, 0.021319909f},
-std::array<float,2>{0.403324038f, 0.724101543f},
-std::array<float,2>{0.670013368f, 0.769865513f},
-std::array<float,2>{0.465414137f, 0.488634229f},
-std::array<float,2>{0.815139532f, 0.214022979f},
-std::array<float,2>{0.218709022f, 0.61730057f},
-std::array<float,2>{0.958540499f, 0.658779085f},
-std::array<float,2>{0.0785283446f, 0.123043299f},
-std::array<float,2>{0.604792953f, 0.297170132f},
-std::array<float,2>{0.256378263f, 0.949557662f},
-std::array<float,2>{0.722939253f, 0.694474041f},
-std::array<float,2>{0.437099636f, 0.0481470525f},
-std::array<float,2>{0.794991016f, 0.346024334f},
-std::array<float,2>{0.125135317f, 0.893631518f},
-std::array<float,2>{0.936523318f, 0.844417453f},
-std::array<float,2>{0.0100042354f, 0.428251088f},
-std::array<float,2>{0.520610988f, 0.162255615f},
-std::array<float,2>{0.324081361f, 0.511719942f},
-std::array<float,2>{0.583131731f, 0.972505867f},
-std::array<float,2>{0.297863424f, 0.274607807f},
-std::array<float,2>{0.981625259f, 0.0791895762f},
-std::array<float,2>{0.119051069f, 0.631297886f},
-std::array<float,2>{0.847355306f, 0.574180186f},
-std::array<float,2>{0.236701936f, 0.240864143f},
-std::array<float,2>{0.648498833f, 0.466637403f},
-std::array<float,2>{0.480469435f, 0.800614357f},
-std::array<float,2>{0.536613345f, 0.666412592f},
-std::array<float,2>{0.361604542f, 0.117025271f},
-std::array<float,2>{0.888615012f, 0.305505872f},
-std::array<float,2>{0.0471230485f, 0.938938737f},
-std::array<float,2>{0.775120735f, 0.780186832f},
-std::array<float,2>{0.163417354f, 0.498874098f},
-std::array<float,2>{0.713588834f, 0.207466677f},
-std::array<float,2>{0.379574299f, 0.616309106f},
-std::array<float,2>{0.680597603f, 0.933541f},
-std::array<float,2>{0.44237259f, 0.326726586f},
-std::array<float,2>{0.830848396f, 0.0305283237f},
-std::array<float,2>{0.18935357f, 0.734188199f},
-std::array<float,2>{0.945773184f, 0.551368237f},
-std::array<float,2>{0.0729005709f, 0.136272103f},
-std::array<float,2>{0.621151149f, 0.399655432f},
-std::array<float,2>{0.269207239f, 0.842321992f},
-std::array<float,2>{0.737049997f, 0.564012825f},
-std::array<float,2>{0.420967281f, 0.243198007f},
-std::array<float,2>{0.805185556f, 0.454591066f},
-std::array<float,2>{0.143471345f, 0.806256592f},
-std::array<float,2>{0.914878905f, 0.979187489f},
-std::array<float,2>{0.0162303317f, 0.272630751f},
-std::array<float,2>{0.503464341f, 0.0888801888f},
-std::array<float,2>{0.337860376f, 0.633530676f},
-std::array<float,2>{0.566467702f, 0.857310712f},
-std::array<float,2>{0.288593054f, 0.431907862f},
-std::array<float,2>{0.989528358f, 0.164565235f},
-std::array<float,2>{0.095725134f, 0.501421034f},
-std::array<float,2>{0.860296011f, 0.702943981f},
-std::array<float,2>{0.222153023f, 0.0574937984f},
-std::array<float,2>{0.638235629f, 0.351741284f},
-std::array<float,2>{0.499558538f, 0.90414542f},
-std::array<float,2>{0.606979549f, 0.520989478f},
-std::array<float,2>{0.250326693f, 0.186901957f},
-std::array<float,2>{0.956037939f, 0.407112151f},
-std::array<float,2>{0.0833470672f, 0.864762604f},
-std::array<float,2>{0.819030166f, 0.878351152f},
-std::array<float,2>{0.212948456f, 0.361543387f},
-std::array<float,2>{0.664543331f, 0.0423937514f},
-std::array<float,2>{0.464331686f, 0.715584278f},
-std::array<float,2>{0.695989609f, 0.791384637f},
-std::array<float,2>{0.400981456f, 0.452249974f},
-std::array<float,2>{0.750427723f, 0.23196502f},
-std::array<float,2>{0.180365667f, 0.591463983f},
-std::array<float,2>{0.905270576f, 0.649119854f},
-std::array<float,2>{0.0379115343f, 0.0649697036f},
-std::array<float,2>{0.552076399f, 0.256647021f},
-std::array<float,2>{0.35060522f, 0.990882397f},
-std::array<float,2>{0.655215144f, 0.738296628f},
-std::array<float,2>{0.480446994f, 0.0112415571f},
-std::array<float,2>{0.849936426f, 0.341253728f},
-std::array<float,2>{0.240017459f, 0.910221398f},
-std::array<float,2>{0.976949275f, 0.820299566f},
-std::array<float,2>{0.123870134f, 0.376774937f},
-std::array<float,2>{0.578876376f, 0.146982104f},
-std::array<float,2>{0.301440001f, 0.538089573f},
-std::array<float,2>{0.51917696f, 0.956810236f},
-std::array<float,2>{0.326021999f, 0.294310063f},
-std::array<float,2>{0.933051884f, 0.101575337f},
-std::array<float,2>{0.0126700401f, 0.681725264f},
-std::array<float,2>{0.789566934f, 0.601296306f},
-std::array<float,2>{0.128913745f, 0.1882364f},
-std::array<float,2>{0.71955055f, 0.470011294f},
-std::array<float,2>{0.430169284f, 0.752678216f},
-std::array<float,2>{0.589585185f, 0.705138505f},
-std::array<float,2>{0.311495215f, 0.0345112532f},
-std::array<float,2>{0.976059496f, 0.370822757f},
-std::array<float,2>{0.110250533f, 0.886902034f},
-std::array<float,2>{0.858985841f, 0.873782873f},
-std::array<float,2>{0.244737417f, 0.418198764f},
-std::array<float,2>{0.642908096f, 0.179423451f},
-std::array<float,2>{0.47475186f, 0.524584532f},
-std::array<float,2>{0.733397484f, 0.993516505f},
-std::array<float,2>{0.421884686f, 0.262131155f},
-std::array<float,2>{0.78692472f, 0.0758171678f},
-std::array<float,2>{0.133446544f, 0.644756854f},
-std::array<float,2>{0.929441929f, 0.583682656f},
-std::array<float,2>{0.00278756744f, 0.22201249f},
-std::array<float,2>{0.525086045f, 0.443192601f},
-std::array<float,2>{0.316410452f, 0.782981038f},
-std::array<float,2>{0.659816682f, 0.540535033f},
-std::array<float,2>{0.460109353f, 0.155354381f},
-std::array<float,2>{0.825052023f, 0.386343539f},
-std::array<float,2>{0.208025873f, 0.824099541f},
-std::array<float,2>{0.965259552f, 0.918695092f},
-std::array<float,2>{0.0906833708f, 0.332537591f},
-std::array<float,2>{0.594230354f, 0.0021934805f},
-std::array<float,2>{0.262475699f, 0.749494672f},
-std::array<float,2>{0.561415911f, 0.762139022f},
-std::array<float,2>{0.351909786f, 0.480658799f},
-std::array<float,2>{0.892246723f, 0.202083796f},
-std::array<float,2>{0.0406222641f, 0.603860855f},
-std::array<float,2>{0.758583009f, 0.679655671f},
-std::array<float,2>{0.177965879f, 0.0993993953f},
-std::array<float,2>{0.691328824f, 0.28807205f},
-std::array<float,2>{0.394346654f, 0.965409636f},
-std::array<float,2>{0.509021223f, 0.622600734f},
-std::array<float,2>{0.330764145f, 0.215075359f},
-std::array<float,2>{0.913664937f, 0.48489061f},
-std::array<float,2>{0.0271438845f, 0.767472088f},
-std::array<float,2>{0.802106082f, 0.946268559f},
-std::array<float,2>{0.153600678f, 0.302829534f},
-std::array<float,2>{0.748294115f, 0.118201762f},
-std::array<float,2>{0.409924328f, 0.661704898f},
-std::array<float,2>{0.631365716f, 0.830136001f},
-std::array<float,2>{0.484461367f, 0.39262116f},
-std::array<float,2>{0.872658789f, 0.13162528f},
-std::array<float,2>{0.234100252f, 0.55966574f},
-std::array<float,2>{0.993351698f, 0.719020486f},
-std::array<float,2>{0.105494648f, 0.018393131f},
-std::array<float,2>{0.573439419f, 0.315384358f},
-std::array<float,2>{0.293002188f, 0.925851285f},
-std::array<float,2>{0.704075456f, 0.628423452f},
-std::array<float,2>{0.388318717f, 0.0824343339f},
-std::array<float,2>{0.769144058f, 0.278300554f},
-std::array<float,2>{0.165739715f, 0.975880623f},
-std::array<float,2>{0.880707204f, 0.802269399f},
-std::array<float,2>{0.0560192466f, 0.461604625f},
-std::array<float,2>{0.544777572f, 0.237162769f},
-std::array<float,2>{0.369614035f, 0.574407637f},
-std::array<float,2>{0.611701965f, 0.897917032f},
-std::array<float,2>{0.2772111f, 0.348525614f},
-std::array<float,2>{0.943694413f, 0.054662358f},
-std::array<float,2>{0.0692232102f, 0.688648403f},
-std::array<float,2>{0.843747199f, 0.509194553f},
-std::array<float,2>{0.196832046f, 0.158422515f},
-std::array<float,2>{0.67486161f, 0.424113154f},
-std::array<float,2>{0.452937037f, 0.849518716f},
-std::array<float,2>{0.558095455f, 0.697572052f},
-std::array<float,2>{0.357209831f, 0.0600356273f},
-std::array<float,2>{0.895011842f, 0.358200967f},
-std::array<float,2>{0.0446556881f, 0.901170969f},
-std::array<float,2>{0.761747122f, 0.852980316f},
-std::array<float,2>{0.173818722f, 0.437357038f},
-std::array<float,2>{0.691464841f, 0.171054289f},
-std::array<float,2>{0.396125883f, 0.505347908f},
-std::array<float,2>{0.662327707f, 0.984073102f},
-std::array<float,2>{0.454708725f, 0.268056422f},
-std::array<float,2>{0.823684871f, 0.0912087038f},
-std::array<float,2>{0.205549344f, 0.638037264f},
-std::array<float,2>{0.964407265f, 0.569175065f},
-std::array<float,2>{0.0896700174f, 0.248131961f},
-std::array<float,2>{0.598926544f, 0.457970083f},
-std::array<float,2>{0.26022464f, 0.809354365f},
-std::array<float,2>{0.730389118f, 0.547099292f},
-std::array<float,2>{0.425951749f, 0.139805034f},
-std::array<float,2>{0.783863544f, 0.40580225f},
-std::array<float,2>{0.140205815f, 0.836188734f},
-std::array<float,2>{0.924077094f, 0.936513484f},
-std::array<float,2>{0.00641967356f, 0.322043121f},
-std::array<float,2>{0.530366778f, 0.0267483126f},
-std::array<float,2>{0.313249826f, 0.730148852f},
-std::array<float,2>{0.591418862f, 0.77518338f},
-std::array<float,2>{0.306633353f, 0.494562387f},
-std::array<float,2>{0.9697963f, 0.205847025f},
-std::array<float,2>{0.11384885f, 0.610629559f},
-std::array<float,2>{0.852692068f, 0.668568611f},
-std::array<float,2>{0.249155432f, 0.11082574f},
-std::array<float,2>{0.645776749f, 0.310829192f},
-std::array<float,2>{0.471284896f, 0.942855954f},
-std::array<float,2>{0.616310656f, 0.597278655f},
-std::array<float,2>{0.27853927f, 0.192330956f},
-std::array<float,2>{0.937511802f, 0.472683787f},
-std::array<float,2>{0.0655520782f, 0.757237494f},
-std::array<float,2>{0.83916682f, 0.959241867f},
-std::array<float,2>{0.200474411f, 0.290481806f},
-std::array<float,2>{0.678005338f, 0.106593929f},
-std::array<float,2>{0.44608593f, 0.685804605f},
-std::array<float,2>{0.707241416f, 0.812556922f},
-std::array<float,2>{0.38530764f, 0.382184774f},
-std::array<float,2>{0.77340126f, 0.144032925f},
-std::array<float,2>{0.171356142f, 0.532814026f},
-std::array<float,2>{0.875457108f, 0.736964166f},
-std::array<float,2>{0.0601419732f, 0.0147874625f},
-std::array<float,2>{0.541873217f, 0.3398408f},
-std::array<float,2>{0.37397337f, 0.909283876f},
-std::array<float,2>{0.627618909f, 0.654240012f},
-std::array<float,2>{0.488910824f, 0.0698942915f},
-std::array<float,2>{0.869797349f, 0.253810704f},
-std::array<float,2>{0.227927372f, 0.986982346f},
-std::array<float,2>{0.999397457f, 0.796036541f},
-std::array<float,2>{0.102869503f, 0.446277022f},
-std::array<float,2>{0.577670932f, 0.226694062f},
-std::array<float,2>{0.291697532f, 0.588728607f},
-std::array<float,2>{0.512912512f, 0.881017327f},
-std::array<float,2>{0.334854335f, 0.364241868f},
-std::array<float,2>{0.909804702f, 0.046380017f},
-std::array<float,2>{0.028653264f, 0.712935507f},
-std::array<float,2>{0.797067344f, 0.518673718f},
-std::array<float,2>{0.150095165f, 0.181479692f},
-std::array<float,2>{0.744270861f, 0.414001375f},
-std::array<float,2>{0.413699329f, 0.862740755f},
-std::array<float,2>{0.565671682f, 0.673365653f},
-std::array<float,2>{0.28334254f, 0.0954296887f},
-std::array<float,2>{0.987175941f, 0.282612413f},
-std::array<float,2>{0.0992592499f, 0.961382508f},
-std::array<float,2>{0.866813242f, 0.76044476f},
-std::array<float,2>{0.223820582f, 0.476744592f},
-std::array<float,2>{0.63373065f, 0.197981745f},
-std::array<float,2>{0.495564729f, 0.608739614f},
-std::array<float,2>{0.738957703f, 0.91569066f},
-std::array<float,2>{0.415716439f, 0.331672639f},
-std::array<float,2>{0.808629453f, 0.00650569377f},
-std::array<float,2>{0.146935314f, 0.743135333f},
-std::array<float,2>{0.920096636f, 0.544154108f},
-std::array<float,2>{0.0233082958f, 0.151845947f},
-std::array<float,2>{0.50455606f, 0.387163609f},
-std::array<float,2>{0.339861989f, 0.826943457f},
-std::array<float,2>{0.685622156f, 0.581781328f},
-std::array<float,2>{0.43884927f, 0.226552621f},
-std::array<float,2>{0.832246661f, 0.439499617f},
-std::array<float,2>{0.192038119f, 0.785453558f},
-std::array<float,2>{0.950876415f, 0.99624604f},
-std::array<float,2>{0.0757952332f, 0.258970916f},
-std::array<float,2>{0.61976999f, 0.0740268752f},
-std::array<float,2>{0.272155672f, 0.6438905f},
-std::array<float,2>{0.534601271f, 0.871034622f},
-std::array<float,2>{0.363956302f, 0.41658321f},
-std::array<float,2>{0.883519113f, 0.173780277f},
-std::array<float,2>{0.0514418446f, 0.528460205f},
-std::array<float,2>{0.781210005f, 0.710021019f},
-std::array<float,2>{0.157675698f, 0.0375355892f},
-std::array<float,2>{0.715393305f, 0.37112087f},
-std::array<float,2>{0.377263546f, 0.885387063f},
-std::array<float,2>{0.522912025f, 0.514458895f},
-std::array<float,2>{0.321778536f, 0.1603062f},
-std::array<float,2>{0.93360132f, 0.427608013f},
-std::array<float,2>{0.00965203717f, 0.846039295f},
-std::array<float,2>{0.794337392f, 0.891685486f},
-std::array<float,2>{0.127298132f, 0.345513672f},
-std::array<float,2>{0.72562927f, 0.0498546138f},
-std::array<float,2>{0.434809238f, 0.691836476f},
-std::array<float,2>{0.651242614f, 0.798018575f},
-std::array<float,2>{0.483112156f, 0.466907829f},
-std::array<float,2>{0.84417516f, 0.238331839f},
-std::array<float,2>{0.236325711f, 0.571513534f},
-std::array<float,2>{0.982849181f, 0.629007936f},
-std::array<float,2>{0.1204217f, 0.0807844922f},
-std::array<float,2>{0.584181905f, 0.277206481f},
-std::array<float,2>{0.300609797f, 0.968833923f},
-std::array<float,2>{0.70211333f, 0.726495028f},
-std::array<float,2>{0.404512346f, 0.0229367316f},
-std::array<float,2>{0.754662097f, 0.319544286f},
-std::array<float,2>{0.183654949f, 0.923031807f},
-std::array<float,2>{0.900524974f, 0.833862424f},
-std::array<float,2>{0.0337187089f, 0.395107865f},
-std::array<float,2>{0.547257245f, 0.128521264f},
-std::array<float,2>{0.346229076f, 0.555783451f},
-std::array<float,2>{0.602473974f, 0.951824605f},
-std::array<float,2>{0.255438209f, 0.299626023f},
-std::array<float,2>{0.960902572f, 0.124710485f},
-std::array<float,2>{0.0805982351f, 0.657298625f},
-std::array<float,2>{0.812543571f, 0.619674861f},
-std::array<float,2>{0.215450242f, 0.212533638f},
-std::array<float,2>{0.668805122f, 0.491725236f},
-std::array<float,2>{0.467325807f, 0.771511614f},
-std::array<float,2>{0.50014931f, 0.636351049f},
-std::array<float,2>{0.339015216f, 0.08785218f},
-std::array<float,2>{0.916887045f, 0.269634128f},
-std::array<float,2>{0.0190566406f, 0.977415681f},
-std::array<float,2>{0.808377624f, 0.807633281f},
-std::array<float,2>{0.141202718f, 0.455146194f},
-std::array<float,2>{0.736273229f, 0.244257376f},
-std::array<float,2>{0.419576377f, 0.565035462f},
-std::array<float,2>{0.63955611f, 0.905713201f},
-std::array<float,2>{0.496639907f, 0.354151756f},
-std::array<float,2>{0.862575293f, 0.0548392944f},
-std::array<float,2>{0.219606638f, 0.7009601f},
-std::array<float,2>{0.991169155f, 0.502912045f},
-std::array<float,2>{0.0944847316f, 0.166763872f},
-std::array<float,2>{0.568402231f, 0.430648297f},
-std::array<float,2>{0.28579253f, 0.858992219f},
-std::array<float,2>{0.711530626f, 0.61438483f},
-std::array<float,2>{0.381709009f, 0.210269436f},
-std::array<float,2>{0.775795221f, 0.496534526f},
-std::array<float,2>{0.161417589f, 0.779228687f},
-std::array<float,2>{0.889351904f, 0.939859569f},
-std::array<float,2>{0.0506534018f, 0.308305115f},
-std::array<float,2>{0.538751245f, 0.11333327f},
-std::array<float,2>{0.360596597f, 0.665660262f},
-std::array<float,2>{0.624201775f, 0.841448486f},
-std::array<float,2>{0.267506272f, 0.400675237f},
-std::array<float,2>{0.949061215f, 0.13424626f},
-std::array<float,2>{0.0705089197f, 0.554078281f},
-std::array<float,2>{0.829371631f, 0.732276976f},
-std::array<float,2>{0.190538079f, 0.0289923921f},
-std::array<float,2>{0.682365835f, 0.325078011f},
-std::array<float,2>{0.44478941f, 0.930662274f},
-std::array<float,2>{0.58008182f, 0.53700459f},
-std::array<float,2>{0.30316925f, 0.14494285f},
-std::array<float,2>{0.979166746f, 0.377073705f},
-std::array<float,2>{0.122125819f, 0.816872895f},
-std::array<float,2>{0.847931385f, 0.913400769f},
-std::array<float,2>{0.241770998f, 0.343631059f},
-std::array<float,2>{0.652617216f, 0.00948514976f},
-std::array<float,2>{0.478466839f, 0.74145937f},
-std::array<float,2>{0.721172452f, 0.751055121f},
-std::array<float,2>{0.433238834f, 0.471877664f},
-std::array<float,2>{0.792821884f, 0.190949395f},
-std::array<float,2>{0.132353872f, 0.598483741f},
-std::array<float,2>{0.931237519f, 0.680725336f},
-std::array<float,2>{0.0137147307f, 0.103754468f},
-std::array<float,2>{0.516216218f, 0.296600223f},
-std::array<float,2>{0.326575518f, 0.953607261f},
-std::array<float,2>{0.666473508f, 0.717226148f},
-std::array<float,2>{0.462056488f, 0.0409179851f},
-std::array<float,2>{0.816730857f, 0.360980719f},
-std::array<float,2>{0.212440118f, 0.876249433f},
-std::array<float,2>{0.953677177f, 0.866517007f},
-std::array<float,2>{0.0845231637f, 0.409240186f},
-std::array<float,2>{0.609302104f, 0.183813989f},
-std::array<float,2>{0.252810001f, 0.523033082f},
-std::array<float,2>{0.553202689f, 0.98850745f},
-std::array<float,2>{0.348149359f, 0.255371988f},
-std::array<float,2>{0.903300285f, 0.062780045f},
-std::array<float,2>{0.0352871083f, 0.650574625f},
-std::array<float,2>{0.753291488f, 0.592325509f},
-std::array<float,2>{0.18282795f, 0.233076677f},
-std::array<float,2>{0.698622167f, 0.450773001f},
-std::array<float,2>{0.39993304f, 0.789882421f},
-std::array<float,2>{0.596007943f, 0.746698618f},
-std::array<float,2>{0.263858736f, 0.00153769518f},
-std::array<float,2>{0.9681077f, 0.334441096f},
-std::array<float,2>{0.0927467272f, 0.921499014f},
-std::array<float,2>{0.8263219f, 0.821404099f},
-std::array<float,2>{0.209883913f, 0.383020669f},
-std::array<float,2>{0.657501221f, 0.15238522f},
-std::array<float,2>{0.457543135f, 0.542693079f},
-std::array<float,2>{0.687642217f, 0.968613744f},
-std::array<float,2>{0.391310304f, 0.285455823f},
-std::array<float,2>{0.759985685f, 0.0996811986f},
-std::array<float,2>{0.177374125f, 0.677704811f},
-std::array<float,2>{0.89420408f, 0.603008807f},
-std::array<float,2>{0.0412444919f, 0.201087996f},
-std::array<float,2>{0.559801936f, 0.48400557f},
-std::array<float,2>{0.354550749f, 0.76491791f},
-std::array<float,2>{0.640657663f, 0.525573015f},
-std::array<float,2>{0.47323367f, 0.176351726f},
-std::array<float,2>{0.855844975f, 0.421606362f},
-std::array<float,2>{0.243170694f, 0.872785628f},
-std::array<float,2>{0.973818004f, 0.889078021f},
-std::array<float,2>{0.112839684f, 0.368302405f},
-std::array<float,2>{0.586955369f, 0.0330985114f},
-std::array<float,2>{0.309570491f, 0.703645229f},
-std::array<float,2>{0.52636075f, 0.784639418f},
-std::array<float,2>{0.318438262f, 0.443445057f},
-std::array<float,2>{0.927158296f, 0.219624892f},
-std::array<float,2>{0.000147349172f, 0.584426224f},
-std::array<float,2>{0.78813684f, 0.647672296f},
-std::array<float,2>{0.135369062f, 0.0763014853f},
-std::array<float,2>{0.730470598f, 0.263945311f},
-std::array<float,2>{0.42503044f, 0.995527744f},
-std::array<float,2>{0.546797037f, 0.576677024f},
-std::array<float,2>{0.368607193f, 0.235857353f},
-std::array<float,2>{0.882181644f, 0.463167727f},
-std::array<float,2>{0.0578410514f, 0.803225517f},
-std::array<float,2>{0.765709758f, 0.974350035f},
-std::array<float,2>{0.166229993f, 0.28009814f},
-std::array<float,2>{0.706668079f, 0.0847927332f},
-std::array<float,2>{0.388994038f, 0.626127422f},
-std::array<float,2>{0.672055125f, 0.851272821f},
-std::array<float,2>{0.450531781f, 0.422002584f},
-std::array<float,2>{0.84010464f, 0.15636754f},
-std::array<float,2>{0.197763219f, 0.511282444f},
-std::array<float,2>{0.943298995f, 0.690676868f},
-std::array<float,2>{0.0670631155f, 0.0519679487f},
-std::array<float,2>{0.609384656f, 0.350002021f},
-std::array<float,2>{0.273938507f, 0.896463633f},
-std::array<float,2>{0.746239245f, 0.663061857f},
-std::array<float,2>{0.407664627f, 0.120490886f},
-std::array<float,2>{0.803248346f, 0.302595407f},
-std::array<float,2>{0.155606017f, 0.948207021f},
-std::array<float,2>{0.910377741f, 0.769260526f},
-std::array<float,2>{0.0234543234f, 0.48699668f},
-std::array<float,2>{0.510938227f, 0.216998234f},
-std::array<float,2>{0.32929951f, 0.624506533f},
-std::array<float,2>{0.57072413f, 0.928477407f},
-std::array<float,2>{0.29645741f, 0.313171566f},
-std::array<float,2>{0.994301021f, 0.0156905651f},
-std::array<float,2>{0.107638106f, 0.721052289f},
-std::array<float,2>{0.873538256f, 0.562027752f},
-std::array<float,2>{0.231547236f, 0.129436493f},
-std::array<float,2>{0.630729258f, 0.39072147f},
-std::array<float,2>{0.487027049f, 0.829673707f},
-std::array<float,2>{0.542002022f, 0.734553397f},
-std::array<float,2>{0.374218643f, 0.0123616261f},
-std::array<float,2>{0.876641929f, 0.336621284f},
-std::array<float,2>{0.0588250011f, 0.907705188f},
-std::array<float,2>{0.771687448f, 0.816222191f},
-std::array<float,2>{0.170210406f, 0.380669147f},
-std::array<float,2>{0.708849072f, 0.142576486f},
-std::array<float,2>{0.386016339f, 0.533568263f},
-std::array<float,2>{0.678921223f, 0.957830012f},
-std::array<float,2>{0.447159767f, 0.292180032f},
-std::array<float,2>{0.838754773f, 0.108879335f},
-std::array<float,2>{0.199886695f, 0.685061932f},
-std::array<float,2>{0.93892163f, 0.594481409f},
-std::array<float,2>{0.0645071417f, 0.195288181f},
-std::array<float,2>{0.615278125f, 0.476423055f},
-std::array<float,2>{0.277683765f, 0.75514555f},
-std::array<float,2>{0.745264292f, 0.51592052f},
-std::array<float,2>{0.412854642f, 0.182185054f},
-std::array<float,2>{0.798653364f, 0.411909699f},
-std::array<float,2>{0.148868158f, 0.86060226f},
-std::array<float,2>{0.908675551f, 0.879620731f},
-std::array<float,2>{0.0275574178f, 0.365609765f},
-std::array<float,2>{0.512112319f, 0.0446557216f},
-std::array<float,2>{0.335875571f, 0.711248398f},
-std::array<float,2>{0.57630676f, 0.79305172f},
-std::array<float,2>{0.292650431f, 0.447367817f},
-std::array<float,2>{0.998264253f, 0.228978351f},
-std::array<float,2>{0.102175735f, 0.587248385f},
-std::array<float,2>{0.871016145f, 0.654557407f},
-std::array<float,2>{0.227068529f, 0.0665346384f},
-std::array<float,2>{0.628395677f, 0.250713617f},
-std::array<float,2>{0.489687651f, 0.986005723f},
-std::array<float,2>{0.598580241f, 0.566510141f},
-std::array<float,2>{0.260964125f, 0.246204242f},
-std::array<float,2>{0.963536203f, 0.460131198f},
-std::array<float,2>{0.0884207711f, 0.812071145f},
-std::array<float,2>{0.822322905f, 0.982034802f},
-std::array<float,2>{0.206877261f, 0.265904903f},
-std::array<float,2>{0.663126469f, 0.0930385366f},
-std::array<float,2>{0.453469515f, 0.639369905f},
-std::array<float,2>{0.692829132f, 0.853525817f},
-std::array<float,2>{0.395200849f, 0.434268594f},
-std::array<float,2>{0.763478696f, 0.169636115f},
-std::array<float,2>{0.172486112f, 0.50682205f},
-std::array<float,2>{0.895536661f, 0.695843399f},
-std::array<float,2>{0.0431482531f, 0.0612332895f},
-std::array<float,2>{0.557283938f, 0.356153995f},
-std::array<float,2>{0.356065571f, 0.898473203f},
-std::array<float,2>{0.64528358f, 0.670628846f},
-std::array<float,2>{0.472235829f, 0.112096108f},
-std::array<float,2>{0.852531493f, 0.308846623f},
-std::array<float,2>{0.248163059f, 0.943413734f},
-std::array<float,2>{0.96881038f, 0.77661705f},
-std::array<float,2>{0.114825867f, 0.49307555f},
-std::array<float,2>{0.590741396f, 0.203554571f},
-std::array<float,2>{0.304789424f, 0.612510145f},
-std::array<float,2>{0.529616892f, 0.933742642f},
-std::array<float,2>{0.314116925f, 0.323539764f},
-std::array<float,2>{0.925562263f, 0.0244051535f},
-std::array<float,2>{0.00744669279f, 0.727553427f},
-std::array<float,2>{0.784291685f, 0.549157143f},
-std::array<float,2>{0.139295056f, 0.136909932f},
-std::array<float,2>{0.729288101f, 0.404251039f},
-std::array<float,2>{0.42723009f, 0.838680208f},
-std::array<float,2>{0.584988952f, 0.632186353f},
-std::array<float,2>{0.298954099f, 0.0790424198f},
-std::array<float,2>{0.984305322f, 0.274332702f},
-std::array<float,2>{0.119191207f, 0.971666276f},
-std::array<float,2>{0.844839931f, 0.799010992f},
-std::array<float,2>{0.235144824f, 0.464904755f},
-std::array<float,2>{0.651497781f, 0.241682246f},
-std::array<float,2>{0.483733952f, 0.572767854f},
-std::array<float,2>{0.725201547f, 0.893531144f},
-std::array<float,2>{0.433647722f, 0.34761852f},
-std::array<float,2>{0.793054283f, 0.0473969765f},
-std::array<float,2>{0.1283793f, 0.69347626f},
-std::array<float,2>{0.934642375f, 0.513395786f},
-std::array<float,2>{0.0083864592f, 0.163427979f},
-std::array<float,2>{0.5221982f, 0.428990662f},
-std::array<float,2>{0.320662826f, 0.845413864f},
-std::array<float,2>{0.669426739f, 0.618333876f},
-std::array<float,2>{0.46799776f, 0.213334829f},
-std::array<float,2>{0.813785374f, 0.489840597f},
-std::array<float,2>{0.216597587f, 0.770536363f},
-std::array<float,2>{0.959203839f, 0.950612128f},
-std::array<float,2>{0.0814298689f, 0.298796058f},
-std::array<float,2>{0.603067994f, 0.121351041f},
-std::array<float,2>{0.254172176f, 0.65953809f},
-std::array<float,2>{0.548670709f, 0.835727811f},
-std::array<float,2>{0.346729398f, 0.397579044f},
-std::array<float,2>{0.901465476f, 0.12516658f},
-std::array<float,2>{0.0351284929f, 0.557017386f},
-std::array<float,2>{0.755377412f, 0.72270751f},
-std::array<float,2>{0.185128212f, 0.0200095735f},
-std::array<float,2>{0.702399135f, 0.317382842f},
-std::array<float,2>{0.406165749f, 0.92448765f},
-std::array<float,2>{0.50538218f, 0.545416892f},
-std::array<float,2>{0.341157168f, 0.149281308f},
-std::array<float,2>{0.921059251f, 0.389276594f},
-std::array<float,2>{0.022388177f, 0.825543582f},
-std::array<float,2>{0.810103297f, 0.917742193f},
-std::array<float,2>{0.148347422f, 0.329491317f},
-std::array<float,2>{0.739589155f, 0.00443100417f},
-std::array<float,2>{0.414879411f, 0.745801091f},
-std::array<float,2>{0.634731293f, 0.758740842f},
-std::array<float,2>{0.494314969f, 0.478913724f},
-std::array<float,2>{0.866134346f, 0.19543016f},
-std::array<float,2>{0.223534092f, 0.606381118f},
-std::array<float,2>{0.987400472f, 0.67392695f},
-std::array<float,2>{0.0976700559f, 0.0968963951f},
-std::array<float,2>{0.565315843f, 0.284429312f},
-std::array<float,2>{0.284352332f, 0.963070512f},
-std::array<float,2>{0.71633178f, 0.707975924f},
-std::array<float,2>{0.378594398f, 0.0363631919f},
-std::array<float,2>{0.779739022f, 0.373900294f},
-std::array<float,2>{0.156306058f, 0.884423733f},
-std::array<float,2>{0.884558737f, 0.868831217f},
-std::array<float,2>{0.0520242341f, 0.414399773f},
-std::array<float,2>{0.53389734f, 0.174440831f},
-std::array<float,2>{0.36431393f, 0.530180454f},
-std::array<float,2>{0.620981812f, 0.999624848f},
-std::array<float,2>{0.272856236f, 0.260116279f},
-std::array<float,2>{0.949466348f, 0.0715817213f},
-std::array<float,2>{0.0748193786f, 0.640743256f},
-std::array<float,2>{0.833921731f, 0.579066575f},
-std::array<float,2>{0.193116382f, 0.2239068f},
-std::array<float,2>{0.686870515f, 0.437776506f},
-std::array<float,2>{0.437568635f, 0.788309455f},
-std::array<float,2>{0.516971231f, 0.682954371f},
-std::array<float,2>{0.327771187f, 0.103271008f},
-std::array<float,2>{0.930405676f, 0.293178797f},
-std::array<float,2>{0.0147466538f, 0.955703259f},
-std::array<float,2>{0.791576982f, 0.753690541f},
-std::array<float,2>{0.131415084f, 0.469353527f},
-std::array<float,2>{0.72169137f, 0.188965842f},
-std::array<float,2>{0.432145715f, 0.600128412f},
-std::array<float,2>{0.653373182f, 0.911832213f},
-std::array<float,2>{0.476858556f, 0.340018272f},
-std::array<float,2>{0.849193633f, 0.0100546433f},
-std::array<float,2>{0.24092555f, 0.739594638f},
-std::array<float,2>{0.980360031f, 0.537835956f},
-std::array<float,2>{0.121216625f, 0.14821139f},
-std::array<float,2>{0.581431627f, 0.37592712f},
-std::array<float,2>{0.304253995f, 0.818848491f},
-std::array<float,2>{0.697681189f, 0.590504766f},
-std::array<float,2>{0.399188221f, 0.231233239f},
-std::array<float,2>{0.752343893f, 0.452131778f},
-std::array<float,2>{0.181938425f, 0.792106986f},
-std::array<float,2>{0.903835416f, 0.991509855f},
-std::array<float,2>{0.0366143063f, 0.257615209f},
-std::array<float,2>{0.554526806f, 0.0660579577f},
-std::array<float,2>{0.349474013f, 0.649533391f},
-std::array<float,2>{0.607483804f, 0.863731444f},
-std::array<float,2>{0.253174931f, 0.407420367f},
-std::array<float,2>{0.954688191f, 0.186165646f},
-std::array<float,2>{0.0850178301f, 0.51976043f},
-std::array<float,2>{0.817572534f, 0.716051638f},
-std::array<float,2>{0.211388499f, 0.0411126986f},
-std::array<float,2>{0.667096198f, 0.363264769f},
-std::array<float,2>{0.461387247f, 0.877158821f},
-std::array<float,2>{0.569596529f, 0.500207841f},
-std::array<float,2>{0.286891133f, 0.165489838f},
-std::array<float,2>{0.991999567f, 0.433035642f},
-std::array<float,2>{0.0952092633f, 0.856011391f},
-std::array<float,2>{0.861899555f, 0.902771056f},
-std::array<float,2>{0.220496312f, 0.352964044f},
-std::array<float,2>{0.640426278f, 0.0576948076f},
-std::array<float,2>{0.497332186f, 0.701564133f},
-std::array<float,2>{0.735269368f, 0.804915249f},
-std::array<float,2>{0.418348521f, 0.453767717f},
-std::array<float,2>{0.806699812f, 0.243151471f},
-std::array<float,2>{0.142205f, 0.562680185f},
-std::array<float,2>{0.917004943f, 0.634084105f},
-std::array<float,2>{0.018179154f, 0.0881314799f},
-std::array<float,2>{0.501901031f, 0.271969527f},
-std::array<float,2>{0.337923944f, 0.979801178f},
-std::array<float,2>{0.683316171f, 0.732455969f},
-std::array<float,2>{0.444258124f, 0.029493209f},
-std::array<float,2>{0.828308523f, 0.327345669f},
-std::array<float,2>{0.190057024f, 0.931844771f},
-std::array<float,2>{0.947509885f, 0.843235373f},
-std::array<float,2>{0.0719542578f, 0.399368793f},
-std::array<float,2>{0.623365104f, 0.135560244f},
-std::array<float,2>{0.266059309f, 0.55176419f},
-std::array<float,2>{0.537558138f, 0.938138187f},
-std::array<float,2>{0.359447449f, 0.306205571f},
-std::array<float,2>{0.890412211f, 0.116021268f},
-std::array<float,2>{0.0490932353f, 0.667949975f},
-std::array<float,2>{0.776722074f, 0.615911603f},
-std::array<float,2>{0.160230428f, 0.208811626f},
-std::array<float,2>{0.712267041f, 0.499760926f},
-std::array<float,2>{0.382201135f, 0.780401647f},
-std::array<float,2>{0.610593379f, 0.688314021f},
-std::array<float,2>{0.274496883f, 0.0529297777f},
-std::array<float,2>{0.942275524f, 0.349322885f},
-std::array<float,2>{0.0678354055f, 0.897226274f},
-std::array<float,2>{0.841542006f, 0.848015308f},
-std::array<float,2>{0.198570013f, 0.425133675f},
-std::array<float,2>{0.672931671f, 0.159342125f},
-std::array<float,2>{0.449771523f, 0.507904649f},
-std::array<float,2>{0.705635965f, 0.975469291f},
-std::array<float,2>{0.390089273f, 0.278952539f},
-std::array<float,2>{0.767405748f, 0.0837216824f},
-std::array<float,2>{0.167183772f, 0.627209604f},
-std::array<float,2>{0.881784797f, 0.575392485f},
-std::array<float,2>{0.0572993532f, 0.237830833f},
-std::array<float,2>{0.545322716f, 0.462661892f},
-std::array<float,2>{0.367797196f, 0.801308632f},
-std::array<float,2>{0.629303634f, 0.559509993f},
-std::array<float,2>{0.487514436f, 0.132459342f},
-std::array<float,2>{0.874824524f, 0.393911928f},
-std::array<float,2>{0.231293783f, 0.83190912f},
-std::array<float,2>{0.99538976f, 0.927678585f},
-std::array<float,2>{0.109155022f, 0.315909088f},
-std::array<float,2>{0.571323216f, 0.0194852389f},
-std::array<float,2>{0.295876741f, 0.720231175f},
-std::array<float,2>{0.510212839f, 0.76644814f},
-std::array<float,2>{0.328214198f, 0.485698044f},
-std::array<float,2>{0.911980867f, 0.215961099f},
-std::array<float,2>{0.0247554127f, 0.621152997f},
-std::array<float,2>{0.804187655f, 0.660594523f},
-std::array<float,2>{0.15471898f, 0.117444657f},
-std::array<float,2>{0.747777581f, 0.303933024f},
-std::array<float,2>{0.406643838f, 0.947113693f},
-std::array<float,2>{0.559492111f, 0.605318964f},
-std::array<float,2>{0.353872478f, 0.202605844f},
-std::array<float,2>{0.893423319f, 0.48228693f},
-std::array<float,2>{0.0420046821f, 0.763151884f},
-std::array<float,2>{0.76127708f, 0.965891004f},
-std::array<float,2>{0.176617414f, 0.288906038f},
-std::array<float,2>{0.689316511f, 0.0984139293f},
-std::array<float,2>{0.391715854f, 0.678553581f},
-std::array<float,2>{0.65715009f, 0.822623849f},
-std::array<float,2>{0.45865202f, 0.385672361f},
-std::array<float,2>{0.828018129f, 0.154563084f},
-std::array<float,2>{0.210692525f, 0.539792478f},
-std::array<float,2>{0.966831803f, 0.748326123f},
-std::array<float,2>{0.0929298848f, 0.00300011574f},
-std::array<float,2>{0.597366452f, 0.33363837f},
-std::array<float,2>{0.265622467f, 0.919098079f},
-std::array<float,2>{0.732154727f, 0.646416366f},
-std::array<float,2>{0.423935562f, 0.0750258416f},
-std::array<float,2>{0.787171125f, 0.263292104f},
-std::array<float,2>{0.136199966f, 0.992821753f},
-std::array<float,2>{0.926568329f, 0.782215714f},
-std::array<float,2>{0.00129089074f, 0.441491753f},
-std::array<float,2>{0.527012348f, 0.220786244f},
-std::array<float,2>{0.320255667f, 0.58287859f},
-std::array<float,2>{0.586047411f, 0.888169765f},
-std::array<float,2>{0.309310257f, 0.370026171f},
-std::array<float,2>{0.972717583f, 0.0334305018f},
-std::array<float,2>{0.11171224f, 0.706206918f},
-std::array<float,2>{0.856903672f, 0.5243209f},
-std::array<float,2>{0.242836609f, 0.178130925f},
-std::array<float,2>{0.641672254f, 0.419308633f},
-std::array<float,2>{0.473714262f, 0.874112308f},
-std::array<float,2>{0.515080988f, 0.714295328f},
-std::array<float,2>{0.333636403f, 0.0452204049f},
-std::array<float,2>{0.907422125f, 0.364345998f},
-std::array<float,2>{0.0298997276f, 0.882078528f},
-std::array<float,2>{0.800158262f, 0.861809254f},
-std::array<float,2>{0.151816323f, 0.412486017f},
-std::array<float,2>{0.743235588f, 0.180370912f},
-std::array<float,2>{0.411235958f, 0.517839789f},
-std::array<float,2>{0.626547933f, 0.98778218f},
-std::array<float,2>{0.490671545f, 0.251973778f},
-std::array<float,2>{0.868912935f, 0.0685027242f},
-std::array<float,2>{0.229517475f, 0.652740359f},
-std::array<float,2>{0.997692227f, 0.588968456f},
-std::array<float,2>{0.104027249f, 0.22816582f},
-std::array<float,2>{0.574673176f, 0.446365714f},
-std::array<float,2>{0.290155739f, 0.795048296f},
-std::array<float,2>{0.709010124f, 0.531614423f},
-std::array<float,2>{0.383144408f, 0.143156797f},
-std::array<float,2>{0.769586384f, 0.381609142f},
-std::array<float,2>{0.169554472f, 0.813757479f},
-std::array<float,2>{0.878528416f, 0.908373952f},
-std::array<float,2>{0.0616353303f, 0.338802874f},
-std::array<float,2>{0.539625406f, 0.0142708281f},
-std::array<float,2>{0.371554911f, 0.73800844f},
-std::array<float,2>{0.615122855f, 0.756494701f},
-std::array<float,2>{0.280935198f, 0.474167228f},
-std::array<float,2>{0.940801859f, 0.193059057f},
-std::array<float,2>{0.0637365878f, 0.59638989f},
-std::array<float,2>{0.836807013f, 0.687445879f},
-std::array<float,2>{0.201340005f, 0.106080502f},
-std::array<float,2>{0.67599678f, 0.289767861f},
-std::array<float,2>{0.44743672f, 0.960828662f},
-std::array<float,2>{0.593668222f, 0.609959126f},
-std::array<float,2>{0.308382839f, 0.206988558f},
-std::array<float,2>{0.970793545f, 0.495158702f},
-std::array<float,2>{0.116512232f, 0.773934186f},
-std::array<float,2>{0.854207993f, 0.94225657f},
-std::array<float,2>{0.247245237f, 0.311842173f},
-std::array<float,2>{0.648006737f, 0.110049456f},
-std::array<float,2>{0.47034362f, 0.669902742f},
-std::array<float,2>{0.726960957f, 0.836941659f},
-std::array<float,2>{0.42931959f, 0.404339582f},
-std::array<float,2>{0.781708837f, 0.138915494f},
-std::array<float,2>{0.137728766f, 0.548710525f},
-std::array<float,2>{0.923511803f, 0.729093492f},
-std::array<float,2>{0.00470325537f, 0.0254470687f},
-std::array<float,2>{0.527522087f, 0.320848703f},
-std::array<float,2>{0.316308349f, 0.937010348f},
-std::array<float,2>{0.661938727f, 0.637375295f},
-std::array<float,2>{0.455663353f, 0.0899223909f},
-std::array<float,2>{0.821435094f, 0.269443095f},
-std::array<float,2>{0.204861149f, 0.982747555f},
-std::array<float,2>{0.962431967f, 0.809955657f},
-std::array<float,2>{0.0875736848f, 0.458827734f},
-std::array<float,2>{0.601287425f, 0.249024287f},
-std::array<float,2>{0.258073568f, 0.57016784f},
-std::array<float,2>{0.555070221f, 0.902237594f},
-std::array<float,2>{0.357712835f, 0.359302312f},
-std::array<float,2>{0.897081316f, 0.0586719997f},
-std::array<float,2>{0.045871038f, 0.699182987f},
-std::array<float,2>{0.7641837f, 0.504516542f},
-std::array<float,2>{0.174077481f, 0.170808494f},
-std::array<float,2>{0.693732381f, 0.435686648f},
-std::array<float,2>{0.397687972f, 0.852348745f},
-std::array<float,2>{0.604165614f, 0.656848371f},
-std::array<float,2>{0.257271528f, 0.123666123f},
-std::array<float,2>{0.95730263f, 0.300518334f},
-std::array<float,2>{0.0792230368f, 0.952567458f},
-std::array<float,2>{0.815509677f, 0.772794545f},
-std::array<float,2>{0.21732752f, 0.490335464f},
-std::array<float,2>{0.671449661f, 0.211070821f},
-std::array<float,2>{0.466793805f, 0.620469928f},
-std::array<float,2>{0.699813008f, 0.922720492f},
-std::array<float,2>{0.40243423f, 0.318769902f},
-std::array<float,2>{0.756952822f, 0.0219020732f},
-std::array<float,2>{0.186929196f, 0.72467941f},
-std::array<float,2>{0.900292575f, 0.555276871f},
-std::array<float,2>{0.0327376463f, 0.127309859f},
-std::array<float,2>{0.548960209f, 0.395652324f},
-std::array<float,2>{0.345647663f, 0.832167447f},
-std::array<float,2>{0.649853647f, 0.570893645f},
-std::array<float,2>{0.482216895f, 0.239509836f},
-std::array<float,2>{0.845867038f, 0.467830241f},
-std::array<float,2>{0.237691894f, 0.797344506f},
-std::array<float,2>{0.981241465f, 0.969891727f},
-std::array<float,2>{0.117778264f, 0.275806844f},
-std::array<float,2>{0.582563877f, 0.0814884603f},
-std::array<float,2>{0.297270566f, 0.63049525f},
-std::array<float,2>{0.519573927f, 0.846970975f},
-std::array<float,2>{0.322575152f, 0.426222742f},
-std::array<float,2>{0.936728656f, 0.161652893f},
-std::array<float,2>{0.0109045533f, 0.51523608f},
-std::array<float,2>{0.796212792f, 0.692774415f},
-std::array<float,2>{0.12641947f, 0.0495874546f},
-std::array<float,2>{0.723669708f, 0.344685256f},
-std::array<float,2>{0.436008364f, 0.891114652f},
-std::array<float,2>{0.531809628f, 0.528035879f},
-std::array<float,2>{0.366003811f, 0.172574565f},
-std::array<float,2>{0.885744452f, 0.417263389f},
-std::array<float,2>{0.0544523858f, 0.869835317f},
-std::array<float,2>{0.778409123f, 0.885839283f},
-std::array<float,2>{0.159441188f, 0.37209475f},
-std::array<float,2>{0.717311144f, 0.0384569429f},
-std::array<float,2>{0.376345962f, 0.709830701f},
-std::array<float,2>{0.684013844f, 0.786819518f},
-std::array<float,2>{0.441141069f, 0.441357642f},
-std::array<float,2>{0.835104346f, 0.224730596f},
-std::array<float,2>{0.194569245f, 0.58029753f},
-std::array<float,2>{0.953072488f, 0.643060327f},
-std::array<float,2>{0.078025125f, 0.0730651617f},
-std::array<float,2>{0.617593229f, 0.258693665f},
-std::array<float,2>{0.269990355f, 0.997773767f},
-std::array<float,2>{0.740302742f, 0.744013011f},
-std::array<float,2>{0.417459756f, 0.00757981045f},
-std::array<float,2>{0.811807036f, 0.330386817f},
-std::array<float,2>{0.146441743f, 0.914413095f},
-std::array<float,2>{0.918685198f, 0.82806623f},
-std::array<float,2>{0.021008648f, 0.388035178f},
-std::array<float,2>{0.506236494f, 0.150699094f},
-std::array<float,2>{0.343673825f, 0.543405056f},
-std::array<float,2>{0.562725306f, 0.962146521f},
-std::array<float,2>{0.281902999f, 0.281544328f},
-std::array<float,2>{0.984389305f, 0.0937749594f},
-std::array<float,2>{0.10116744f, 0.67252332f},
-std::array<float,2>{0.863430202f, 0.607767105f},
-std::array<float,2>{0.226213604f, 0.198636755f},
-std::array<float,2>{0.636609733f, 0.478380859f},
-std::array<float,2>{0.49228701f, 0.761128545f},
-std::array<float,2>{0.551242054f, 0.651946902f},
-std::array<float,2>{0.350061804f, 0.0643526837f},
-std::array<float,2>{0.905312538f, 0.254713207f},
-std::array<float,2>{0.0381046012f, 0.989725232f},
-std::array<float,2>{0.751097441f, 0.790202677f},
-std::array<float,2>{0.180761322f, 0.450003475f},
-std::array<float,2>{0.696436048f, 0.233875975f},
-std::array<float,2>{0.402009964f, 0.593619168f},
-std::array<float,2>{0.665490985f, 0.875901818f},
-std::array<float,2>{0.462917119f, 0.359850883f},
-std::array<float,2>{0.820260406f, 0.0391950496f},
-std::array<float,2>{0.214291677f, 0.718066633f},
-std::array<float,2>{0.956614256f, 0.522355795f},
-std::array<float,2>{0.0824114978f, 0.185094014f},
-std::array<float,2>{0.606136262f, 0.408713818f},
-std::array<float,2>{0.251403332f, 0.865788758f},
-std::array<float,2>{0.719790936f, 0.599418819f},
-std::array<float,2>{0.430882871f, 0.189871833f},
-std::array<float,2>{0.790692568f, 0.471558005f},
-std::array<float,2>{0.130662844f, 0.750311017f},
-std::array<float,2>{0.932076275f, 0.954994977f},
-std::array<float,2>{0.0136372419f, 0.295127302f},
-std::array<float,2>{0.518012404f, 0.105227463f},
-std::array<float,2>{0.324762821f, 0.679888368f},
-std::array<float,2>{0.579214275f, 0.817953885f},
-std::array<float,2>{0.302733004f, 0.378387332f},
-std::array<float,2>{0.977832913f, 0.146048665f},
-std::array<float,2>{0.124451615f, 0.535192788f},
-std::array<float,2>{0.85070318f, 0.741030931f},
-std::array<float,2>{0.238466352f, 0.00796203129f},
-std::array<float,2>{0.655602276f, 0.342470497f},
-std::array<float,2>{0.4793154f, 0.912223339f},
-std::array<float,2>{0.6223616f, 0.55332166f},
-std::array<float,2>{0.267649889f, 0.133325517f},
-std::array<float,2>{0.946441054f, 0.402316272f},
-std::array<float,2>{0.0741654858f, 0.839917004f},
-std::array<float,2>{0.831347287f, 0.930991828f},
-std::array<float,2>{0.188069209f, 0.325315416f},
-std::array<float,2>{0.681373f, 0.027465716f},
-std::array<float,2>{0.442495942f, 0.730751395f},
-std::array<float,2>{0.714252949f, 0.777409554f},
-std::array<float,2>{0.380441487f, 0.497988433f},
-std::array<float,2>{0.774234533f, 0.209943905f},
-std::array<float,2>{0.162748381f, 0.613382161f},
-std::array<float,2>{0.887563467f, 0.664258718f},
-std::array<float,2>{0.0480584577f, 0.115192369f},
-std::array<float,2>{0.536094904f, 0.307536513f},
-std::array<float,2>{0.362852335f, 0.941086173f},
-std::array<float,2>{0.637370229f, 0.699327469f},
-std::array<float,2>{0.49829036f, 0.0558122322f},
-std::array<float,2>{0.86116749f, 0.354947418f},
-std::array<float,2>{0.2209187f, 0.904445827f},
-std::array<float,2>{0.988924563f, 0.858224213f},
-std::array<float,2>{0.0973314643f, 0.431298047f},
-std::array<float,2>{0.568203568f, 0.167869315f},
-std::array<float,2>{0.287289202f, 0.503816843f},
-std::array<float,2>{0.502579629f, 0.97845763f},
-std::array<float,2>{0.33633244f, 0.270835459f},
-std::array<float,2>{0.915774584f, 0.0861130208f},
-std::array<float,2>{0.0171688702f, 0.634858847f},
-std::array<float,2>{0.806161821f, 0.566030741f},
-std::array<float,2>{0.14366895f, 0.24527353f},
-std::array<float,2>{0.738105714f, 0.456160933f},
-std::array<float,2>{0.420575142f, 0.807132185f},
-std::array<float,2>{0.572517514f, 0.721737087f},
-std::array<float,2>{0.294403523f, 0.0168292839f},
-std::array<float,2>{0.992487609f, 0.31381005f},
-std::array<float,2>{0.10688179f, 0.929219604f},
-std::array<float,2>{0.871209443f, 0.828220069f},
-std::array<float,2>{0.233104363f, 0.391694874f},
-std::array<float,2>{0.632190883f, 0.130712286f},
-std::array<float,2>{0.485436559f, 0.560626149f},
-std::array<float,2>{0.749572635f, 0.9486323f},
-std::array<float,2>{0.408317238f, 0.300845563f},
-std::array<float,2>{0.801618278f, 0.119978681f},
-std::array<float,2>{0.153046161f, 0.663999498f},
-std::array<float,2>{0.912707031f, 0.62357229f},
-std::array<float,2>{0.0260524657f, 0.218659863f},
-std::array<float,2>{0.507812619f, 0.488230795f},
-std::array<float,2>{0.331846416f, 0.768488824f},
-std::array<float,2>{0.674271643f, 0.510215938f},
-std::array<float,2>{0.451624393f, 0.157575712f},
-std::array<float,2>{0.841921031f, 0.423133701f},
-std::array<float,2>{0.195391849f, 0.849866748f},
-std::array<float,2>{0.94483006f, 0.89543283f},
-std::array<float,2>{0.0695535466f, 0.351518929f},
-std::array<float,2>{0.612905383f, 0.0517083108f},
-std::array<float,2>{0.275854826f, 0.690121531f},
-std::array<float,2>{0.543838978f, 0.804407358f},
-std::array<float,2>{0.370685279f, 0.464485049f},
-std::array<float,2>{0.879167676f, 0.235087395f},
-std::array<float,2>{0.0551939122f, 0.577698827f},
-std::array<float,2>{0.76824528f, 0.62506038f},
-std::array<float,2>{0.164970905f, 0.0852128714f},
-std::array<float,2>{0.704806745f, 0.281157255f},
-std::array<float,2>{0.387320727f, 0.973244071f},
-std::array<float,2>{0.523913026f, 0.585629106f},
-std::array<float,2>{0.318223059f, 0.220638797f},
-std::array<float,2>{0.928084254f, 0.444399059f},
-std::array<float,2>{0.00353071466f, 0.783470392f},
-std::array<float,2>{0.786033213f, 0.995089352f},
-std::array<float,2>{0.134336114f, 0.264912426f},
-std::array<float,2>{0.734290183f, 0.0773809627f},
-std::array<float,2>{0.423006952f, 0.647395074f},
-std::array<float,2>{0.643659115f, 0.871612191f},
-std::array<float,2>{0.475810379f, 0.420522958f},
-std::array<float,2>{0.858125746f, 0.177473754f},
-std::array<float,2>{0.245584324f, 0.527321815f},
-std::array<float,2>{0.974633157f, 0.705037236f},
-std::array<float,2>{0.110904716f, 0.031506367f},
-std::array<float,2>{0.588678479f, 0.367208719f},
-std::array<float,2>{0.31205219f, 0.889885008f},
-std::array<float,2>{0.690248907f, 0.676746964f},
-std::array<float,2>{0.393328458f, 0.100670815f},
-std::array<float,2>{0.759121597f, 0.287089705f},
-std::array<float,2>{0.178738162f, 0.967042863f},
-std::array<float,2>{0.891088307f, 0.76423192f},
-std::array<float,2>{0.0392872989f, 0.482824951f},
-std::array<float,2>{0.561819613f, 0.199771225f},
-std::array<float,2>{0.352684438f, 0.60158217f},
-std::array<float,2>{0.595665097f, 0.92027396f},
-std::array<float,2>{0.263667941f, 0.335154444f},
-std::array<float,2>{0.966575325f, 0.000663711107f},
-std::array<float,2>{0.0909943506f, 0.747521639f},
-std::array<float,2>{0.825553596f, 0.541319728f},
-std::array<float,2>{0.207199425f, 0.153884932f},
-std::array<float,2>{0.658593118f, 0.384318084f},
-std::array<float,2>{0.459530652f, 0.820355296f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.126538768f, 0.868529975f},
-std::array<float,2>{0.920744479f, 0.178362846f},
-std::array<float,2>{0.258243263f, 0.394171089f},
-std::array<float,2>{0.55292654f, 0.632460535f},
-std::array<float,2>{0.405495822f, 0.582054913f},
-std::array<float,2>{0.74988234f, 0.352782577f},
-std::array<float,2>{0.0661683828f, 0.0338286757f},
-std::array<float,2>{0.859630704f, 0.879400015f},
-std::array<float,2>{0.0182547253f, 0.72751224f},
-std::array<float,2>{0.753917754f, 0.46065852f},
-std::array<float,2>{0.460951537f, 0.235924125f},
-std::array<float,2>{0.676923633f, 0.809376776f},
-std::array<float,2>{0.363674909f, 0.964286983f},
-std::array<float,2>{0.618206322f, 0.0692393035f},
-std::array<float,2>{0.223779798f, 0.293281347f},
-std::array<float,2>{0.998199821f, 0.519346058f},
-std::array<float,2>{0.106887862f, 0.932297349f},
-std::array<float,2>{0.830233097f, 0.00104041281f},
-std::array<float,2>{0.424094737f, 0.3249152f},
-std::array<float,2>{0.706308126f, 0.6104303f},
-std::array<float,2>{0.282059729f, 0.666166306f},
-std::array<float,2>{0.521947682f, 0.415281147f},
-std::array<float,2>{0.172501013f, 0.143192247f},
-std::array<float,2>{0.888826072f, 0.835041165f},
-std::array<float,2>{0.194005981f, 0.543499768f},
-std::array<float,2>{0.942831337f, 0.251161486f},
-std::array<float,2>{0.340552002f, 0.116290428f},
-std::array<float,2>{0.565727592f, 0.996684968f},
-std::array<float,2>{0.497464061f, 0.77553159f},
-std::array<float,2>{0.650845587f, 0.197984874f},
-std::array<float,2>{0.0328267403f, 0.490683049f},
-std::array<float,2>{0.812390387f, 0.691302061f},
-std::array<float,2>{0.055748079f, 0.788665831f},
-std::array<float,2>{0.791689754f, 0.233428106f},
-std::array<float,2>{0.479543149f, 0.447163254f},
-std::array<float,2>{0.637742817f, 0.736628592f},
-std::array<float,2>{0.326516867f, 0.511359036f},
-std::array<float,2>{0.590175211f, 0.301273584f},
-std::array<float,2>{0.216080561f, 0.0837946907f},
-std::array<float,2>{0.953820467f, 0.94340378f},
-std::array<float,2>{0.164338738f, 0.642854214f},
-std::array<float,2>{0.896657467f, 0.377955168f},
-std::array<float,2>{0.30567506f, 0.171035528f},
-std::array<float,2>{0.510046482f, 0.847438574f},
-std::array<float,2>{0.406393558f, 0.899283648f},
-std::array<float,2>{0.690488994f, 0.0533575825f},
-std::array<float,2>{0.120686248f, 0.372041702f},
-std::array<float,2>{0.816275418f, 0.573183f},
-std::array<float,2>{0.243324295f, 0.974484503f},
-std::array<float,2>{0.97594732f, 0.095688425f},
-std::array<float,2>{0.348264754f, 0.268081754f},
-std::array<float,2>{0.601310611f, 0.554716408f},
-std::array<float,2>{0.443319917f, 0.714744151f},
-std::array<float,2>{0.659550667f, 0.475614607f},
-std::array<float,2>{0.00944347493f, 0.214917615f},
-std::array<float,2>{0.777788401f, 0.750935018f},
-std::array<float,2>{0.0838088989f, 0.60389632f},
-std::array<float,2>{0.847100198f, 0.340275377f},
-std::array<float,2>{0.377390891f, 0.0244923346f},
-std::array<float,2>{0.726991117f, 0.915274024f},
-std::array<float,2>{0.274758339f, 0.825300336f},
-std::array<float,2>{0.532184303f, 0.128580645f},
-std::array<float,2>{0.147734061f, 0.422791511f},
-std::array<float,2>{0.936793268f, 0.685498714f},
-std::array<float,2>{0.203135505f, 0.759047329f},
-std::array<float,2>{0.963718653f, 0.203347161f},
-std::array<float,2>{0.315907001f, 0.478840739f},
-std::array<float,2>{0.583387792f, 0.70974189f},
-std::array<float,2>{0.471280783f, 0.55413717f},
-std::array<float,2>{0.629414856f, 0.278630883f},
-std::array<float,2>{0.048235625f, 0.10353297f},
-std::array<float,2>{0.785317481f, 0.978503883f},
-std::array<float,2>{0.110672846f, 0.675520003f},
-std::array<float,2>{0.823691785f, 0.430461407f},
-std::array<float,2>{0.415790796f, 0.136643261f},
-std::array<float,2>{0.696552455f, 0.816266f},
-std::array<float,2>{0.30140835f, 0.907880962f},
-std::array<float,2>{0.507693112f, 0.0170371197f},
-std::array<float,2>{0.15888381f, 0.329859614f},
-std::array<float,2>{0.899666011f, 0.601454318f},
-std::array<float,2>{0.0047873538f, 0.946284652f},
-std::array<float,2>{0.770108521f, 0.0871851146f},
-std::array<float,2>{0.446688145f, 0.308466643f},
-std::array<float,2>{0.666555226f, 0.506166875f},
-std::array<float,2>{0.352164686f, 0.747317016f},
-std::array<float,2>{0.606628239f, 0.44261238f},
-std::array<float,2>{0.237164855f, 0.225443512f},
-std::array<float,2>{0.982973337f, 0.790204465f},
-std::array<float,2>{0.148736849f, 0.564721406f},
-std::array<float,2>{0.929161668f, 0.367164016f},
-std::array<float,2>{0.270923644f, 0.0563548617f},
-std::array<float,2>{0.539182663f, 0.891913712f},
-std::array<float,2>{0.388786107f, 0.852885962f},
-std::array<float,2>{0.726119995f, 0.156627834f},
-std::array<float,2>{0.0914861709f, 0.389844298f},
-std::array<float,2>{0.856558621f, 0.649856865f},
-std::array<float,2>{0.0719034299f, 0.841057658f},
-std::array<float,2>{0.867969215f, 0.152583048f},
-std::array<float,2>{0.39230752f, 0.40765062f},
-std::array<float,2>{0.736664474f, 0.658663929f},
-std::array<float,2>{0.254821986f, 0.620156109f},
-std::array<float,2>{0.562116086f, 0.316524297f},
-std::array<float,2>{0.136780977f, 0.0136945564f},
-std::array<float,2>{0.910725951f, 0.923401594f},
-std::array<float,2>{0.230807379f, 0.698661029f},
-std::array<float,2>{0.985708892f, 0.497341216f},
-std::array<float,2>{0.374021083f, 0.19293806f},
-std::array<float,2>{0.613257647f, 0.771280229f},
-std::array<float,2>{0.455165774f, 0.986250639f},
-std::array<float,2>{0.684659123f, 0.118925668f},
-std::array<float,2>{0.0253736507f, 0.258517623f},
-std::array<float,2>{0.763059676f, 0.538830101f},
-std::array<float,2>{0.182192713f, 0.882943094f},
-std::array<float,2>{0.878127754f, 0.0454945788f},
-std::array<float,2>{0.295300037f, 0.346111923f},
-std::array<float,2>{0.525379181f, 0.588204324f},
-std::array<float,2>{0.431092739f, 0.633584857f},
-std::array<float,2>{0.715651929f, 0.402329892f},
-std::array<float,2>{0.0957075283f, 0.186934739f},
-std::array<float,2>{0.838798106f, 0.86010015f},
-std::array<float,2>{0.0435757935f, 0.529838979f},
-std::array<float,2>{0.804442823f, 0.287261367f},
-std::array<float,2>{0.486404002f, 0.0733060315f},
-std::array<float,2>{0.647688866f, 0.9578197f},
-std::array<float,2>{0.329368055f, 0.802476525f},
-std::array<float,2>{0.577804983f, 0.245231971f},
-std::array<float,2>{0.195624232f, 0.465550125f},
-std::array<float,2>{0.951062977f, 0.72254473f},
-std::array<float,2>{0.219587415f, 0.818287432f},
-std::array<float,2>{0.994972944f, 0.139458418f},
-std::array<float,2>{0.361713976f, 0.435081005f},
-std::array<float,2>{0.62240088f, 0.678198934f},
-std::array<float,2>{0.465202093f, 0.595751286f},
-std::array<float,2>{0.674513817f, 0.333111942f},
-std::array<float,2>{0.0203824323f, 0.0219158586f},
-std::array<float,2>{0.751325846f, 0.912811697f},
-std::array<float,2>{0.066792883f, 0.704903841f},
-std::array<float,2>{0.866652071f, 0.483873487f},
-std::array<float,2>{0.399080813f, 0.208090901f},
-std::array<float,2>{0.744909585f, 0.761753201f},
-std::array<float,2>{0.264796376f, 0.98192817f},
-std::array<float,2>{0.548775852f, 0.106326908f},
-std::array<float,2>{0.129275903f, 0.276172727f},
-std::array<float,2>{0.914215982f, 0.548657238f},
-std::array<float,2>{0.0378514118f, 0.89604044f},
-std::array<float,2>{0.805193365f, 0.0622143783f},
-std::array<float,2>{0.492794186f, 0.360523999f},
-std::array<float,2>{0.655869186f, 0.567653179f},
-std::array<float,2>{0.336466312f, 0.653967023f},
-std::array<float,2>{0.569728732f, 0.386114269f},
-std::array<float,2>{0.191222489f, 0.163878262f},
-std::array<float,2>{0.938285947f, 0.85929054f},
-std::array<float,2>{0.175827473f, 0.502085805f},
-std::array<float,2>{0.885695398f, 0.312323004f},
-std::array<float,2>{0.285625488f, 0.0907982737f},
-std::array<float,2>{0.516391516f, 0.949378014f},
-std::array<float,2>{0.426973492f, 0.795534194f},
-std::array<float,2>{0.708340704f, 0.221760735f},
-std::array<float,2>{0.102873713f, 0.440406621f},
-std::array<float,2>{0.833821654f, 0.742492318f},
-std::array<float,2>{0.124255881f, 0.76780659f},
-std::array<float,2>{0.817967176f, 0.188651323f},
-std::array<float,2>{0.412094176f, 0.495795906f},
-std::array<float,2>{0.693536758f, 0.701813042f},
-std::array<float,2>{0.309363633f, 0.532060325f},
-std::array<float,2>{0.512170434f, 0.261771172f},
-std::array<float,2>{0.171444833f, 0.123630263f},
-std::array<float,2>{0.893934906f, 0.991055906f},
-std::array<float,2>{0.212749615f, 0.663959563f},
-std::array<float,2>{0.960723281f, 0.410725683f},
-std::array<float,2>{0.323707253f, 0.149888098f},
-std::array<float,2>{0.588401198f, 0.839637756f},
-std::array<float,2>{0.48144573f, 0.928729117f},
-std::array<float,2>{0.634143174f, 0.00782288238f},
-std::array<float,2>{0.0602872781f, 0.315532953f},
-std::array<float,2>{0.795524597f, 0.622673452f},
-std::array<float,2>{0.142466486f, 0.956098199f},
-std::array<float,2>{0.930058658f, 0.0778814927f},
-std::array<float,2>{0.278243929f, 0.283528537f},
-std::array<float,2>{0.536264002f, 0.525834143f},
-std::array<float,2>{0.38133648f, 0.724224627f},
-std::array<float,2>{0.7343418f, 0.463052481f},
-std::array<float,2>{0.0809078738f, 0.246825904f},
-std::array<float,2>{0.85092181f, 0.798799694f},
-std::array<float,2>{0.0134952962f, 0.592110872f},
-std::array<float,2>{0.775342762f, 0.348599494f},
-std::array<float,2>{0.438010842f, 0.0418469682f},
-std::array<float,2>{0.661595345f, 0.890575528f},
-std::array<float,2>{0.346416444f, 0.866019905f},
-std::array<float,2>{0.594650686f, 0.18152605f},
-std::array<float,2>{0.247244313f, 0.402466178f},
-std::array<float,2>{0.970042467f, 0.638478994f},
-std::array<float,2>{0.160277009f, 0.807153463f},
-std::array<float,2>{0.904631555f, 0.240774691f},
-std::array<float,2>{0.300735623f, 0.454066008f},
-std::array<float,2>{0.501521289f, 0.730985045f},
-std::array<float,2>{0.419505119f, 0.523082137f},
-std::array<float,2>{0.699951053f, 0.291107476f},
-std::array<float,2>{0.115796678f, 0.0654853433f},
-std::array<float,2>{0.826331317f, 0.968343616f},
-std::array<float,2>{0.053388264f, 0.628049135f},
-std::array<float,2>{0.782457829f, 0.397036165f},
-std::array<float,2>{0.476454258f, 0.171994254f},
-std::array<float,2>{0.625774205f, 0.87149775f},
-std::array<float,2>{0.31899932f, 0.875913203f},
-std::array<float,2>{0.581240177f, 0.0370543115f},
-std::array<float,2>{0.207533926f, 0.356956393f},
-std::array<float,2>{0.964942038f, 0.57836926f},
-std::array<float,2>{0.0890174806f, 0.994822025f},
-std::array<float,2>{0.85514909f, 0.110655643f},
-std::array<float,2>{0.385766447f, 0.256982476f},
-std::array<float,2>{0.719482422f, 0.541952133f},
-std::array<float,2>{0.268943906f, 0.692146122f},
-std::array<float,2>{0.545457184f, 0.487713993f},
-std::array<float,2>{0.152514979f, 0.200724825f},
-std::array<float,2>{0.925513148f, 0.777976632f},
-std::array<float,2>{0.239648655f, 0.615059078f},
-std::array<float,2>{0.976754785f, 0.322266966f},
-std::array<float,2>{0.359052956f, 0.00780915795f},
-std::array<float,2>{0.604644358f, 0.934265971f},
-std::array<float,2>{0.450540245f, 0.831400573f},
-std::array<float,2>{0.669277608f, 0.145878747f},
-std::array<float,2>{0.000513812935f, 0.418180287f},
-std::array<float,2>{0.768143594f, 0.670705378f},
-std::array<float,2>{0.0299025346f, 0.848065138f},
-std::array<float,2>{0.759222925f, 0.16453734f},
-std::array<float,2>{0.460492134f, 0.379833013f},
-std::array<float,2>{0.680379868f, 0.648034036f},
-std::array<float,2>{0.368911833f, 0.57439065f},
-std::array<float,2>{0.615448713f, 0.370097786f},
-std::array<float,2>{0.228029117f, 0.0501292311f},
-std::array<float,2>{0.991315603f, 0.904836893f},
-std::array<float,2>{0.134896517f, 0.740395069f},
-std::array<float,2>{0.907299399f, 0.45127368f},
-std::array<float,2>{0.251508713f, 0.22904481f},
-std::array<float,2>{0.55671072f, 0.781871855f},
-std::array<float,2>{0.397964507f, 0.941401005f},
-std::array<float,2>{0.739589572f, 0.0783632919f},
-std::array<float,2>{0.0748198256f, 0.30007267f},
-std::array<float,2>{0.871655166f, 0.514727533f},
-std::array<float,2>{0.20132038f, 0.920774758f},
-std::array<float,2>{0.945616603f, 0.030125726f},
-std::array<float,2>{0.335417479f, 0.336607605f},
-std::array<float,2>{0.572653115f, 0.608900607f},
-std::array<float,2>{0.491883337f, 0.68055743f},
-std::array<float,2>{0.644040227f, 0.428627372f},
-std::array<float,2>{0.0398878679f, 0.130521744f},
-std::array<float,2>{0.799989164f, 0.821165383f},
-std::array<float,2>{0.101217031f, 0.562268972f},
-std::array<float,2>{0.841895282f, 0.27110827f},
-std::array<float,2>{0.434674293f, 0.0983165354f},
-std::array<float,2>{0.713331044f, 0.969843507f},
-std::array<float,2>{0.292192906f, 0.754310012f},
-std::array<float,2>{0.528242111f, 0.213480443f},
-std::array<float,2>{0.187040493f, 0.468978405f},
-std::array<float,2>{0.881242633f, 0.717251241f},
-std::array<float,2>{0.17451188f, 0.832549632f},
-std::array<float,2>{0.888257921f, 0.142518997f},
-std::array<float,2>{0.283417523f, 0.416402191f},
-std::array<float,2>{0.520772517f, 0.665734768f},
-std::array<float,2>{0.422308296f, 0.613134027f},
-std::array<float,2>{0.703176856f, 0.327598423f},
-std::array<float,2>{0.107774094f, 0.00241083954f},
-std::array<float,2>{0.829876721f, 0.931237936f},
-std::array<float,2>{0.0343043245f, 0.688943565f},
-std::array<float,2>{0.809558272f, 0.489362419f},
-std::array<float,2>{0.498937339f, 0.196063489f},
-std::array<float,2>{0.6495561f, 0.773544014f},
-std::array<float,2>{0.342855006f, 0.998342395f},
-std::array<float,2>{0.563000262f, 0.113582209f},
-std::array<float,2>{0.191909641f, 0.253057182f},
-std::array<float,2>{0.944436789f, 0.54656601f},
-std::array<float,2>{0.0632351264f, 0.88242358f},
-std::array<float,2>{0.861986518f, 0.0328825116f},
-std::array<float,2>{0.402481079f, 0.354552507f},
-std::array<float,2>{0.747941732f, 0.585165143f},
-std::array<float,2>{0.260191679f, 0.629575968f},
-std::array<float,2>{0.552244186f, 0.390629888f},
-std::array<float,2>{0.127487704f, 0.176923111f},
-std::array<float,2>{0.919827998f, 0.870475113f},
-std::array<float,2>{0.226197973f, 0.516716361f},
-std::array<float,2>{0.9969787f, 0.295070708f},
-std::array<float,2>{0.366074204f, 0.0680388287f},
-std::array<float,2>{0.620383084f, 0.961918056f},
-std::array<float,2>{0.464398593f, 0.810991645f},
-std::array<float,2>{0.678300619f, 0.236896589f},
-std::array<float,2>{0.01728951f, 0.458535254f},
-std::array<float,2>{0.757354915f, 0.729898632f},
-std::array<float,2>{0.0108206635f, 0.752496243f},
-std::array<float,2>{0.780537605f, 0.217652664f},
-std::array<float,2>{0.444935948f, 0.474230051f},
-std::array<float,2>{0.657542944f, 0.711351395f},
-std::array<float,2>{0.350576609f, 0.558402836f},
-std::array<float,2>{0.599340796f, 0.265929252f},
-std::array<float,2>{0.244312927f, 0.0961128548f},
-std::array<float,2>{0.974295497f, 0.975551724f},
-std::array<float,2>{0.144723445f, 0.68610543f},
-std::array<float,2>{0.935328484f, 0.425237924f},
-std::array<float,2>{0.277209401f, 0.125453636f},
-std::array<float,2>{0.533529818f, 0.828105867f},
-std::array<float,2>{0.375122309f, 0.916664541f},
-std::array<float,2>{0.728712022f, 0.0258779395f},
-std::array<float,2>{0.0848944113f, 0.34181127f},
-std::array<float,2>{0.843837917f, 0.602461517f},
-std::array<float,2>{0.217041209f, 0.942814887f},
-std::array<float,2>{0.956781149f, 0.0851272941f},
-std::array<float,2>{0.324434042f, 0.304661244f},
-std::array<float,2>{0.592645526f, 0.508993089f},
-std::array<float,2>{0.476835042f, 0.734448612f},
-std::array<float,2>{0.639755905f, 0.448749959f},
-std::array<float,2>{0.0575592928f, 0.230719566f},
-std::array<float,2>{0.789420366f, 0.786195099f},
-std::array<float,2>{0.119073994f, 0.571891248f},
-std::array<float,2>{0.814228117f, 0.374886572f},
-std::array<float,2>{0.408959121f, 0.051616326f},
-std::array<float,2>{0.688349426f, 0.900539637f},
-std::array<float,2>{0.307318121f, 0.845222056f},
-std::array<float,2>{0.508713484f, 0.168871835f},
-std::array<float,2>{0.166228801f, 0.376033545f},
-std::array<float,2>{0.896429121f, 0.642093301f},
-std::array<float,2>{0.235921055f, 0.791696906f},
-std::array<float,2>{0.981590569f, 0.22372134f},
-std::array<float,2>{0.35415116f, 0.444716603f},
-std::array<float,2>{0.607906699f, 0.748932779f},
-std::array<float,2>{0.448647767f, 0.504370093f},
-std::array<float,2>{0.664677143f, 0.305179983f},
-std::array<float,2>{0.00740375789f, 0.0893038586f},
-std::array<float,2>{0.772230804f, 0.948121786f},
-std::array<float,2>{0.0936712399f, 0.652274787f},
-std::array<float,2>{0.85798353f, 0.388387322f},
-std::array<float,2>{0.387528479f, 0.158593133f},
-std::array<float,2>{0.723500013f, 0.854650676f},
-std::array<float,2>{0.273002684f, 0.892742097f},
-std::array<float,2>{0.541789711f, 0.0573209524f},
-std::array<float,2>{0.152039886f, 0.365147501f},
-std::array<float,2>{0.926565766f, 0.56374079f},
-std::array<float,2>{0.0501095541f, 0.980295658f},
-std::array<float,2>{0.787243903f, 0.102784932f},
-std::array<float,2>{0.4688676f, 0.280934244f},
-std::array<float,2>{0.631960869f, 0.551397502f},
-std::array<float,2>{0.313173652f, 0.708183885f},
-std::array<float,2>{0.585796893f, 0.478142858f},
-std::array<float,2>{0.205830291f, 0.206932917f},
-std::array<float,2>{0.962888956f, 0.760818481f},
-std::array<float,2>{0.157475933f, 0.598510087f},
-std::array<float,2>{0.901138842f, 0.331256449f},
-std::array<float,2>{0.304322362f, 0.0178880692f},
-std::array<float,2>{0.504170179f, 0.909033835f},
-std::array<float,2>{0.416648418f, 0.812902987f},
-std::array<float,2>{0.697945118f, 0.134625494f},
-std::array<float,2>{0.1126021f, 0.431980222f},
-std::array<float,2>{0.820784628f, 0.673464596f},
-std::array<float,2>{0.0942967981f, 0.862932682f},
-std::array<float,2>{0.837138414f, 0.183974057f},
-std::array<float,2>{0.432509631f, 0.398894608f},
-std::array<float,2>{0.717452586f, 0.635742247f},
-std::array<float,2>{0.294825554f, 0.587296188f},
-std::array<float,2>{0.527309358f, 0.34561646f},
-std::array<float,2>{0.180729583f, 0.0443003438f},
-std::array<float,2>{0.875690162f, 0.884834945f},
-std::array<float,2>{0.198424816f, 0.719948828f},
-std::array<float,2>{0.952923238f, 0.467909038f},
-std::array<float,2>{0.331023365f, 0.24413307f},
-std::array<float,2>{0.57489121f, 0.803683937f},
-std::array<float,2>{0.485383123f, 0.959897101f},
-std::array<float,2>{0.644611955f, 0.071613498f},
-std::array<float,2>{0.0467231162f, 0.285799146f},
-std::array<float,2>{0.802313507f, 0.527942598f},
-std::array<float,2>{0.140070781f, 0.924854159f},
-std::array<float,2>{0.91263938f, 0.0127138086f},
-std::array<float,2>{0.256559908f, 0.320109218f},
-std::array<float,2>{0.560397029f, 0.617310166f},
-std::array<float,2>{0.392721862f, 0.65815407f},
-std::array<float,2>{0.734958529f, 0.408205003f},
-std::array<float,2>{0.0731465667f, 0.154819071f},
-std::array<float,2>{0.869794786f, 0.84270066f},
-std::array<float,2>{0.026717579f, 0.537026048f},
-std::array<float,2>{0.764557004f, 0.261404276f},
-std::array<float,2>{0.454652399f, 0.119831383f},
-std::array<float,2>{0.686975121f, 0.987356782f},
-std::array<float,2>{0.37276268f, 0.771764159f},
-std::array<float,2>{0.611264706f, 0.195141643f},
-std::array<float,2>{0.234279722f, 0.498930186f},
-std::array<float,2>{0.987774789f, 0.695538938f},
-std::array<float,2>{0.187855512f, 0.856046379f},
-std::array<float,2>{0.940835238f, 0.160706699f},
-std::array<float,2>{0.33871451f, 0.383175552f},
-std::array<float,2>{0.568159103f, 0.654721916f},
-std::array<float,2>{0.494185627f, 0.569470227f},
-std::array<float,2>{0.653594434f, 0.361988068f},
-std::array<float,2>{0.0368552022f, 0.0598075502f},
-std::array<float,2>{0.807353735f, 0.897671759f},
-std::array<float,2>{0.103744127f, 0.745542169f},
-std::array<float,2>{0.835136712f, 0.438445598f},
-std::array<float,2>{0.429612279f, 0.219551414f},
-std::array<float,2>{0.710754991f, 0.793711305f},
-std::array<float,2>{0.287315786f, 0.952582896f},
-std::array<float,2>{0.518383384f, 0.0918139666f},
-std::array<float,2>{0.17936331f, 0.309250206f},
-std::array<float,2>{0.882961571f, 0.50065124f},
-std::array<float,2>{0.0225724615f, 0.912108362f},
-std::array<float,2>{0.751965344f, 0.0202579089f},
-std::array<float,2>{0.468068421f, 0.334847152f},
-std::array<float,2>{0.672196805f, 0.594235599f},
-std::array<float,2>{0.359465212f, 0.677133679f},
-std::array<float,2>{0.623806894f, 0.437091559f},
-std::array<float,2>{0.221604794f, 0.137468278f},
-std::array<float,2>{0.992772579f, 0.819100261f},
-std::array<float,2>{0.131291673f, 0.550074816f},
-std::array<float,2>{0.917964518f, 0.274409652f},
-std::array<float,2>{0.263370275f, 0.108097211f},
-std::array<float,2>{0.549896777f, 0.983796179f},
-std::array<float,2>{0.401295811f, 0.764401257f},
-std::array<float,2>{0.7433514f, 0.210122034f},
-std::array<float,2>{0.0690967366f, 0.481402755f},
-std::array<float,2>{0.864269912f, 0.706264794f},
-std::array<float,2>{0.0799069703f, 0.799674869f},
-std::array<float,2>{0.84929055f, 0.248110712f},
-std::array<float,2>{0.379919469f, 0.462604463f},
-std::array<float,2>{0.731256127f, 0.724931657f},
-std::array<float,2>{0.280476809f, 0.523604393f},
-std::array<float,2>{0.538521647f, 0.2820867f},
-std::array<float,2>{0.143079877f, 0.0744590685f},
-std::array<float,2>{0.932722986f, 0.954003036f},
-std::array<float,2>{0.248804793f, 0.639774024f},
-std::array<float,2>{0.971183419f, 0.405993432f},
-std::array<float,2>{0.344239146f, 0.182865068f},
-std::array<float,2>{0.596154273f, 0.863570333f},
-std::array<float,2>{0.441146791f, 0.887954414f},
-std::array<float,2>{0.66310966f, 0.0405698754f},
-std::array<float,2>{0.0138047719f, 0.350566745f},
-std::array<float,2>{0.77549237f, 0.589990973f},
-std::array<float,2>{0.169738874f, 0.989745259f},
-std::array<float,2>{0.891242743f, 0.121624358f},
-std::array<float,2>{0.310689509f, 0.264988095f},
-std::array<float,2>{0.514092147f, 0.533278823f},
-std::array<float,2>{0.413944095f, 0.699523985f},
-std::array<float,2>{0.691603005f, 0.492293656f},
-std::array<float,2>{0.122433096f, 0.19114092f},
-std::array<float,2>{0.819761336f, 0.766711593f},
-std::array<float,2>{0.0621349066f, 0.623138189f},
-std::array<float,2>{0.793615878f, 0.313164383f},
-std::array<float,2>{0.484168857f, 0.0109166773f},
-std::array<float,2>{0.635788918f, 0.927057147f},
-std::array<float,2>{0.321080595f, 0.836268365f},
-std::array<float,2>{0.587137759f, 0.151324764f},
-std::array<float,2>{0.213945523f, 0.412155151f},
-std::array<float,2>{0.958194017f, 0.662018597f},
-std::array<float,2>{0.154904366f, 0.780770123f},
-std::array<float,2>{0.923289061f, 0.201849476f},
-std::array<float,2>{0.267099589f, 0.486123741f},
-std::array<float,2>{0.543327451f, 0.694185019f},
-std::array<float,2>{0.383453339f, 0.539178252f},
-std::array<float,2>{0.722475052f, 0.255350381f},
-std::array<float,2>{0.0871818885f, 0.112880334f},
-std::array<float,2>{0.851597667f, 0.993403435f},
-std::array<float,2>{0.00328248926f, 0.6692608f},
-std::array<float,2>{0.766259432f, 0.420891225f},
-std::array<float,2>{0.452249706f, 0.147570997f},
-std::array<float,2>{0.67089802f, 0.828907788f},
-std::array<float,2>{0.356402397f, 0.936369658f},
-std::array<float,2>{0.601890147f, 0.00512754777f},
-std::array<float,2>{0.24073571f, 0.322208464f},
-std::array<float,2>{0.979484022f, 0.6167413f},
-std::array<float,2>{0.114042968f, 0.964943647f},
-std::array<float,2>{0.824685156f, 0.06428352f},
-std::array<float,2>{0.421507955f, 0.290883303f},
-std::array<float,2>{0.702167988f, 0.5211097f},
-std::array<float,2>{0.298262745f, 0.734252989f},
-std::array<float,2>{0.502774835f, 0.456586629f},
-std::array<float,2>{0.163192585f, 0.239009187f},
-std::array<float,2>{0.903966844f, 0.806580007f},
-std::array<float,2>{0.210482597f, 0.581711531f},
-std::array<float,2>{0.967231572f, 0.358840525f},
-std::array<float,2>{0.318356752f, 0.0384854525f},
-std::array<float,2>{0.579394281f, 0.877169669f},
-std::array<float,2>{0.473173946f, 0.874646068f},
-std::array<float,2>{0.628398895f, 0.173963889f},
-std::array<float,2>{0.0526432469f, 0.394879907f},
-std::array<float,2>{0.783324599f, 0.625927091f},
-std::array<float,2>{0.0420489497f, 0.82417202f},
-std::array<float,2>{0.798202932f, 0.132324412f},
-std::array<float,2>{0.489640236f, 0.427171648f},
-std::array<float,2>{0.641341567f, 0.68283534f},
-std::array<float,2>{0.332118511f, 0.60739851f},
-std::array<float,2>{0.571209788f, 0.33815518f},
-std::array<float,2>{0.199888214f, 0.028042417f},
-std::array<float,2>{0.948660731f, 0.918095469f},
-std::array<float,2>{0.185379684f, 0.714914441f},
-std::array<float,2>{0.8793751f, 0.472252429f},
-std::array<float,2>{0.2904239f, 0.211229339f},
-std::array<float,2>{0.530485511f, 0.757306039f},
-std::array<float,2>{0.435982883f, 0.972307742f},
-std::array<float,2>{0.712596178f, 0.101190776f},
-std::array<float,2>{0.0990219787f, 0.272581577f},
-std::array<float,2>{0.840638638f, 0.559731424f},
-std::array<float,2>{0.229213506f, 0.903634846f},
-std::array<float,2>{0.989151061f, 0.0478870161f},
-std::array<float,2>{0.370296329f, 0.368098766f},
-std::array<float,2>{0.613834441f, 0.576902986f},
-std::array<float,2>{0.458051294f, 0.644797742f},
-std::array<float,2>{0.683250487f, 0.381573141f},
-std::array<float,2>{0.0285815317f, 0.167953804f},
-std::array<float,2>{0.761700332f, 0.850770593f},
-std::array<float,2>{0.0776430219f, 0.513327539f},
-std::array<float,2>{0.873390317f, 0.298641294f},
-std::array<float,2>{0.396292448f, 0.0811426416f},
-std::array<float,2>{0.741951525f, 0.9377262f},
-std::array<float,2>{0.253557742f, 0.783274412f},
-std::array<float,2>{0.554705799f, 0.228308558f},
-std::array<float,2>{0.13471058f, 0.450991124f},
-std::array<float,2>{0.910125494f, 0.738447309f},
-std::array<float,2>{0.147069007f, 0.826258302f},
-std::array<float,2>{0.936448932f, 0.126383871f},
-std::array<float,2>{0.273628473f, 0.424205959f},
-std::array<float,2>{0.532687008f, 0.687435389f},
-std::array<float,2>{0.378373206f, 0.603110492f},
-std::array<float,2>{0.727698863f, 0.342998594f},
-std::array<float,2>{0.0827277899f, 0.0267187469f},
-std::array<float,2>{0.846205175f, 0.917335033f},
-std::array<float,2>{0.00840219948f, 0.712097466f},
-std::array<float,2>{0.779175878f, 0.472712487f},
-std::array<float,2>{0.44180733f, 0.217933655f},
-std::array<float,2>{0.658995032f, 0.753736913f},
-std::array<float,2>{0.348782152f, 0.976150274f},
-std::array<float,2>{0.600449979f, 0.0970090181f},
-std::array<float,2>{0.243121177f, 0.26680851f},
-std::array<float,2>{0.974609852f, 0.557586432f},
-std::array<float,2>{0.119928256f, 0.902114272f},
-std::array<float,2>{0.81457001f, 0.0525393933f},
-std::array<float,2>{0.407786041f, 0.373883486f},
-std::array<float,2>{0.690156281f, 0.570436597f},
-std::array<float,2>{0.304764658f, 0.640791059f},
-std::array<float,2>{0.511692822f, 0.375409573f},
-std::array<float,2>{0.165911436f, 0.16982767f},
-std::array<float,2>{0.897969186f, 0.844015718f},
-std::array<float,2>{0.215327784f, 0.508049786f},
-std::array<float,2>{0.954266012f, 0.303435743f},
-std::array<float,2>{0.327294469f, 0.0841504708f},
-std::array<float,2>{0.591711938f, 0.941665053f},
-std::array<float,2>{0.478638232f, 0.785389721f},
-std::array<float,2>{0.636798859f, 0.231876478f},
-std::array<float,2>{0.055093646f, 0.448193759f},
-std::array<float,2>{0.792278886f, 0.735649168f},
-std::array<float,2>{0.0321263485f, 0.775344789f},
-std::array<float,2>{0.811443985f, 0.197206363f},
-std::array<float,2>{0.496699542f, 0.489027202f},
-std::array<float,2>{0.651517212f, 0.688065588f},
-std::array<float,2>{0.341388047f, 0.545806646f},
-std::array<float,2>{0.564742088f, 0.252122521f},
-std::array<float,2>{0.194831908f, 0.114600703f},
-std::array<float,2>{0.942003012f, 0.999336243f},
-std::array<float,2>{0.173555613f, 0.664407969f},
-std::array<float,2>{0.890086591f, 0.417930782f},
-std::array<float,2>{0.28247264f, 0.141197056f},
-std::array<float,2>{0.522660851f, 0.833024919f},
-std::array<float,2>{0.425716996f, 0.930228531f},
-std::array<float,2>{0.70582962f, 0.00351197599f},
-std::array<float,2>{0.106244154f, 0.326859236f},
-std::array<float,2>{0.831632376f, 0.611891747f},
-std::array<float,2>{0.223445445f, 0.960950911f},
-std::array<float,2>{0.999664783f, 0.0672191009f},
-std::array<float,2>{0.364399612f, 0.296785653f},
-std::array<float,2>{0.617263854f, 0.516011417f},
-std::array<float,2>{0.462360293f, 0.729317367f},
-std::array<float,2>{0.675930023f, 0.45751819f},
-std::array<float,2>{0.0189676601f, 0.238193452f},
-std::array<float,2>{0.755097032f, 0.812044442f},
-std::array<float,2>{0.064720422f, 0.584852874f},
-std::array<float,2>{0.861209214f, 0.353528202f},
-std::array<float,2>{0.40492937f, 0.0320343338f},
-std::array<float,2>{0.748383343f, 0.881575525f},
-std::array<float,2>{0.259103477f, 0.869321883f},
-std::array<float,2>{0.554366827f, 0.175942197f},
-std::array<float,2>{0.125434026f, 0.392303765f},
-std::array<float,2>{0.921087623f, 0.630149722f},
-std::array<float,2>{0.197021648f, 0.803943455f},
-std::array<float,2>{0.949582815f, 0.242653266f},
-std::array<float,2>{0.328237444f, 0.467254043f},
-std::array<float,2>{0.576347232f, 0.718980789f},
-std::array<float,2>{0.487732738f, 0.529000342f},
-std::array<float,2>{0.64725405f, 0.286493093f},
-std::array<float,2>{0.0440478176f, 0.0712551177f},
-std::array<float,2>{0.803707778f, 0.960582137f},
-std::array<float,2>{0.0969386026f, 0.634903431f},
-std::array<float,2>{0.839681327f, 0.399466336f},
-std::array<float,2>{0.430421114f, 0.185221374f},
-std::array<float,2>{0.716181338f, 0.861587584f},
-std::array<float,2>{0.295952559f, 0.885789156f},
-std::array<float,2>{0.523446202f, 0.0436028875f},
-std::array<float,2>{0.182883859f, 0.344487935f},
-std::array<float,2>{0.87702179f, 0.585986733f},
-std::array<float,2>{0.0240977816f, 0.986441135f},
-std::array<float,2>{0.762042403f, 0.120587096f},
-std::array<float,2>{0.456254125f, 0.260062724f},
-std::array<float,2>{0.684170604f, 0.535205305f},
-std::array<float,2>{0.374918371f, 0.696479499f},
-std::array<float,2>{0.612213492f, 0.499555945f},
-std::array<float,2>{0.232405767f, 0.193590194f},
-std::array<float,2>{0.984422505f, 0.773133278f},
-std::array<float,2>{0.13837941f, 0.61899972f},
-std::array<float,2>{0.911436439f, 0.319270313f},
-std::array<float,2>{0.255462408f, 0.0119749727f},
-std::array<float,2>{0.561142981f, 0.924701333f},
-std::array<float,2>{0.390663654f, 0.843349814f},
-std::array<float,2>{0.73779887f, 0.156034529f},
-std::array<float,2>{0.0708432421f, 0.409985185f},
-std::array<float,2>{0.86905551f, 0.656404018f},
-std::array<float,2>{0.090332821f, 0.853732526f},
-std::array<float,2>{0.856146693f, 0.159230843f},
-std::array<float,2>{0.390395284f, 0.387187749f},
-std::array<float,2>{0.725338638f, 0.651335359f},
-std::array<float,2>{0.270177007f, 0.562767863f},
-std::array<float,2>{0.540961027f, 0.363518029f},
-std::array<float,2>{0.149601907f, 0.0582382195f},
-std::array<float,2>{0.928665221f, 0.894153416f},
-std::array<float,2>{0.238142446f, 0.749993801f},
-std::array<float,2>{0.984034181f, 0.443742931f},
-std::array<float,2>{0.353043675f, 0.223044798f},
-std::array<float,2>{0.60554713f, 0.792662084f},
-std::array<float,2>{0.445436299f, 0.948373258f},
-std::array<float,2>{0.667598665f, 0.0884789973f},
-std::array<float,2>{0.00513938116f, 0.306506902f},
-std::array<float,2>{0.771252334f, 0.504980683f},
-std::array<float,2>{0.159680977f, 0.909330606f},
-std::array<float,2>{0.899393559f, 0.0194399096f},
-std::array<float,2>{0.302051097f, 0.330977708f},
-std::array<float,2>{0.506595254f, 0.599202752f},
-std::array<float,2>{0.414572239f, 0.672382891f},
-std::array<float,2>{0.695989013f, 0.433330625f},
-std::array<float,2>{0.109631777f, 0.133686662f},
-std::array<float,2>{0.822775304f, 0.81434077f},
-std::array<float,2>{0.0474403687f, 0.55200386f},
-std::array<float,2>{0.786902606f, 0.279484868f},
-std::array<float,2>{0.472087473f, 0.101970606f},
-std::array<float,2>{0.630574107f, 0.97887063f},
-std::array<float,2>{0.314605355f, 0.760301411f},
-std::array<float,2>{0.582453549f, 0.206007332f},
-std::array<float,2>{0.204892367f, 0.477408558f},
-std::array<float,2>{0.964657307f, 0.707617223f},
-std::array<float,2>{0.246839419f, 0.865050316f},
-std::array<float,2>{0.969423354f, 0.182387322f},
-std::array<float,2>{0.346991897f, 0.404313296f},
-std::array<float,2>{0.595218539f, 0.639302611f},
-std::array<float,2>{0.438894451f, 0.590859294f},
-std::array<float,2>{0.660384059f, 0.351013184f},
-std::array<float,2>{0.0121869799f, 0.0399041809f},
-std::array<float,2>{0.774205685f, 0.887297809f},
-std::array<float,2>{0.0811319724f, 0.725907207f},
-std::array<float,2>{0.850165427f, 0.461774498f},
-std::array<float,2>{0.38280651f, 0.249848008f},
-std::array<float,2>{0.732456207f, 0.799819291f},
-std::array<float,2>{0.278443247f, 0.954327464f},
-std::array<float,2>{0.535244524f, 0.0757518113f},
-std::array<float,2>{0.141214818f, 0.282537758f},
-std::array<float,2>{0.931139588f, 0.524726748f},
-std::array<float,2>{0.0591110811f, 0.92588228f},
-std::array<float,2>{0.796361864f, 0.0101503041f},
-std::array<float,2>{0.481198698f, 0.314398646f},
-std::array<float,2>{0.633447766f, 0.62468791f},
-std::array<float,2>{0.32320565f, 0.660260081f},
-std::array<float,2>{0.589354277f, 0.413424939f},
-std::array<float,2>{0.211630657f, 0.151507825f},
-std::array<float,2>{0.959389508f, 0.837451279f},
-std::array<float,2>{0.170175865f, 0.534584999f},
-std::array<float,2>{0.892637074f, 0.264103502f},
-std::array<float,2>{0.309766978f, 0.122278243f},
-std::array<float,2>{0.513635278f, 0.988708436f},
-std::array<float,2>{0.410336167f, 0.765669823f},
-std::array<float,2>{0.694833279f, 0.190170825f},
-std::array<float,2>{0.123699963f, 0.49334228f},
-std::array<float,2>{0.817297876f, 0.700819492f},
-std::array<float,2>{0.101774238f, 0.794328511f},
-std::array<float,2>{0.832859278f, 0.220612928f},
-std::array<float,2>{0.426625222f, 0.439222932f},
-std::array<float,2>{0.70715332f, 0.744175971f},
-std::array<float,2>{0.28658393f, 0.501244009f},
-std::array<float,2>{0.516640365f, 0.310069472f},
-std::array<float,2>{0.176929548f, 0.092804879f},
-std::array<float,2>{0.886102676f, 0.951678813f},
-std::array<float,2>{0.190245166f, 0.655957341f},
-std::array<float,2>{0.939138889f, 0.384517014f},
-std::array<float,2>{0.337091565f, 0.161427006f},
-std::array<float,2>{0.569311857f, 0.857224405f},
-std::array<float,2>{0.493220985f, 0.8965137f},
-std::array<float,2>{0.654467285f, 0.0587688908f},
-std::array<float,2>{0.0385176279f, 0.363266855f},
-std::array<float,2>{0.806165695f, 0.569036245f},
-std::array<float,2>{0.130796075f, 0.983076751f},
-std::array<float,2>{0.915901423f, 0.108752735f},
-std::array<float,2>{0.264439195f, 0.274457455f},
-std::array<float,2>{0.547601998f, 0.549521565f},
-std::array<float,2>{0.399497569f, 0.705960572f},
-std::array<float,2>{0.745592713f, 0.481520057f},
-std::array<float,2>{0.0679894984f, 0.209897786f},
-std::array<float,2>{0.865448058f, 0.765184283f},
-std::array<float,2>{0.0214384962f, 0.595629394f},
-std::array<float,2>{0.750783145f, 0.335184336f},
-std::array<float,2>{0.465907156f, 0.0210180152f},
-std::array<float,2>{0.6752069f, 0.91098851f},
-std::array<float,2>{0.363041461f, 0.819889605f},
-std::array<float,2>{0.621344209f, 0.138059631f},
-std::array<float,2>{0.220418409f, 0.436356634f},
-std::array<float,2>{0.996035695f, 0.676605403f},
-std::array<float,2>{0.186381325f, 0.756525815f},
-std::array<float,2>{0.88259989f, 0.212322339f},
-std::array<float,2>{0.291436225f, 0.470820963f},
-std::array<float,2>{0.528779685f, 0.715994418f},
-std::array<float,2>{0.433773756f, 0.559432149f},
-std::array<float,2>{0.714541495f, 0.272335023f},
-std::array<float,2>{0.0997456387f, 0.100296557f},
-std::array<float,2>{0.843418181f, 0.97089982f},
-std::array<float,2>{0.0409413613f, 0.682358503f},
-std::array<float,2>{0.798927069f, 0.426716924f},
-std::array<float,2>{0.490850031f, 0.131291986f},
-std::array<float,2>{0.643414497f, 0.82288444f},
-std::array<float,2>{0.334804356f, 0.919018447f},
-std::array<float,2>{0.573992014f, 0.0285731014f},
-std::array<float,2>{0.202615857f, 0.339506805f},
-std::array<float,2>{0.946899831f, 0.605937421f},
-std::array<float,2>{0.0755686611f, 0.939355552f},
-std::array<float,2>{0.872174025f, 0.0804488361f},
-std::array<float,2>{0.396903008f, 0.297670424f},
-std::array<float,2>{0.739008963f, 0.512129605f},
-std::array<float,2>{0.250073403f, 0.739608824f},
-std::array<float,2>{0.558482409f, 0.449865669f},
-std::array<float,2>{0.136617228f, 0.22664313f},
-std::array<float,2>{0.906917572f, 0.784576774f},
-std::array<float,2>{0.226963788f, 0.577422142f},
-std::array<float,2>{0.99089849f, 0.368455231f},
-std::array<float,2>{0.367271274f, 0.0470283702f},
-std::array<float,2>{0.617000282f, 0.902755022f},
-std::array<float,2>{0.459222704f, 0.849944115f},
-std::array<float,2>{0.681610882f, 0.166277632f},
-std::array<float,2>{0.0310466532f, 0.381965131f},
-std::array<float,2>{0.758073866f, 0.645980537f},
-std::array<float,2>{0.00124852103f, 0.829676032f},
-std::array<float,2>{0.769106567f, 0.147223189f},
-std::array<float,2>{0.449553013f, 0.421048224f},
-std::array<float,2>{0.668111444f, 0.668883324f},
-std::array<float,2>{0.358066559f, 0.615846515f},
-std::array<float,2>{0.604289532f, 0.320768952f},
-std::array<float,2>{0.238399342f, 0.00477626408f},
-std::array<float,2>{0.977610707f, 0.93745786f},
-std::array<float,2>{0.15406771f, 0.695225537f},
-std::array<float,2>{0.924791276f, 0.48467657f},
-std::array<float,2>{0.267769516f, 0.203118861f},
-std::array<float,2>{0.545912981f, 0.780005932f},
-std::array<float,2>{0.384808153f, 0.993004918f},
-std::array<float,2>{0.720585942f, 0.112085022f},
-std::array<float,2>{0.0884142742f, 0.254121929f},
-std::array<float,2>{0.853737652f, 0.540495098f},
-std::array<float,2>{0.208741292f, 0.878418863f},
-std::array<float,2>{0.966407537f, 0.0379639529f},
-std::array<float,2>{0.320053935f, 0.358086914f},
-std::array<float,2>{0.580704451f, 0.58026433f},
-std::array<float,2>{0.474625349f, 0.626090527f},
-std::array<float,2>{0.62671715f, 0.395911247f},
-std::array<float,2>{0.0546270162f, 0.175636426f},
-std::array<float,2>{0.78188628f, 0.873701513f},
-std::array<float,2>{0.116698757f, 0.520149231f},
-std::array<float,2>{0.827611566f, 0.289430588f},
-std::array<float,2>{0.418014854f, 0.0629647151f},
-std::array<float,2>{0.700630426f, 0.966050506f},
-std::array<float,2>{0.299132884f, 0.805422127f},
-std::array<float,2>{0.500837088f, 0.239595696f},
-std::array<float,2>{0.161763251f, 0.455418825f},
-std::array<float,2>{0.906177342f, 0.733320117f},
-std::array<float,2>{0.167032421f, 0.846376419f},
-std::array<float,2>{0.895134151f, 0.170701295f},
-std::array<float,2>{0.307711452f, 0.377920598f},
-std::array<float,2>{0.509339213f, 0.644457102f},
-std::array<float,2>{0.40954265f, 0.57352221f},
-std::array<float,2>{0.688859999f, 0.372917563f},
-std::array<float,2>{0.118062355f, 0.0541655272f},
-std::array<float,2>{0.813163579f, 0.899733782f},
-std::array<float,2>{0.058081843f, 0.73793745f},
-std::array<float,2>{0.7909953f, 0.445450008f},
-std::array<float,2>{0.478369027f, 0.232599109f},
-std::array<float,2>{0.639198601f, 0.787935674f},
-std::array<float,2>{0.325627595f, 0.944956183f},
-std::array<float,2>{0.593316257f, 0.0821733102f},
-std::array<float,2>{0.21874921f, 0.302475631f},
-std::array<float,2>{0.955425918f, 0.510321677f},
-std::array<float,2>{0.0850096866f, 0.914994597f},
-std::array<float,2>{0.844901204f, 0.0239894092f},
-std::array<float,2>{0.376563162f, 0.34148702f},
-std::array<float,2>{0.730171144f, 0.60522902f},
-std::array<float,2>{0.275756299f, 0.684077442f},
-std::array<float,2>{0.534885466f, 0.423523307f},
-std::array<float,2>{0.145632252f, 0.127582207f},
-std::array<float,2>{0.933836758f, 0.824891806f},
-std::array<float,2>{0.245430514f, 0.556358933f},
-std::array<float,2>{0.973390281f, 0.269024968f},
-std::array<float,2>{0.351436079f, 0.0939027593f},
-std::array<float,2>{0.598609209f, 0.973448575f},
-std::array<float,2>{0.443956226f, 0.751473367f},
-std::array<float,2>{0.656447113f, 0.216701657f},
-std::array<float,2>{0.0100345034f, 0.475111932f},
-std::array<float,2>{0.780206382f, 0.713201523f},
-std::array<float,2>{0.0164434686f, 0.810112119f},
-std::array<float,2>{0.755905151f, 0.235205159f},
-std::array<float,2>{0.463061482f, 0.459511876f},
-std::array<float,2>{0.678965271f, 0.728450954f},
-std::array<float,2>{0.367047727f, 0.518006325f},
-std::array<float,2>{0.619169176f, 0.294276744f},
-std::array<float,2>{0.225026071f, 0.0694807693f},
-std::array<float,2>{0.997479737f, 0.963117898f},
-std::array<float,2>{0.128871992f, 0.631809592f},
-std::array<float,2>{0.918155849f, 0.39297381f},
-std::array<float,2>{0.261718333f, 0.178944021f},
-std::array<float,2>{0.551422894f, 0.867688656f},
-std::array<float,2>{0.403812647f, 0.880295038f},
-std::array<float,2>{0.74609977f, 0.0344539098f},
-std::array<float,2>{0.0638580993f, 0.351638764f},
-std::array<float,2>{0.863238394f, 0.583274543f},
-std::array<float,2>{0.19315818f, 0.997722328f},
-std::array<float,2>{0.943799496f, 0.115620442f},
-std::array<float,2>{0.342652738f, 0.250428259f},
-std::array<float,2>{0.564075589f, 0.544140518f},
-std::array<float,2>{0.4990969f, 0.689689815f},
-std::array<float,2>{0.649116516f, 0.49215287f},
-std::array<float,2>{0.0334944166f, 0.199066654f},
-std::array<float,2>{0.809846818f, 0.777253687f},
-std::array<float,2>{0.108546957f, 0.60983634f},
-std::array<float,2>{0.828385413f, 0.325780213f},
-std::array<float,2>{0.423422068f, 0.000707939907f},
-std::array<float,2>{0.704543948f, 0.933110297f},
-std::array<float,2>{0.284482092f, 0.834793508f},
-std::array<float,2>{0.519560754f, 0.144366309f},
-std::array<float,2>{0.175503895f, 0.414830536f},
-std::array<float,2>{0.8870309f, 0.667785048f},
-std::array<float,2>{0.233336106f, 0.769952774f},
-std::array<float,2>{0.986648917f, 0.191573501f},
-std::array<float,2>{0.371849298f, 0.496521324f},
-std::array<float,2>{0.609922826f, 0.697404683f},
-std::array<float,2>{0.453766495f, 0.537724972f},
-std::array<float,2>{0.685627401f, 0.259712845f},
-std::array<float,2>{0.0256739091f, 0.117288038f},
-std::array<float,2>{0.765614271f, 0.985110939f},
-std::array<float,2>{0.0735578239f, 0.659304619f},
-std::array<float,2>{0.870571554f, 0.406521022f},
-std::array<float,2>{0.393590987f, 0.153637186f},
-std::array<float,2>{0.736176372f, 0.840529859f},
-std::array<float,2>{0.256980211f, 0.922242701f},
-std::array<float,2>{0.55947721f, 0.0153596709f},
-std::array<float,2>{0.139327452f, 0.31826207f},
-std::array<float,2>{0.913796127f, 0.619169772f},
-std::array<float,2>{0.0450845324f, 0.95822227f},
-std::array<float,2>{0.801726282f, 0.0729736537f},
-std::array<float,2>{0.485270262f, 0.288545579f},
-std::array<float,2>{0.646361589f, 0.530878425f},
-std::array<float,2>{0.331368476f, 0.721480846f},
-std::array<float,2>{0.575732529f, 0.46643576f},
-std::array<float,2>{0.197999999f, 0.244742468f},
-std::array<float,2>{0.951701105f, 0.801106334f},
-std::array<float,2>{0.179903463f, 0.589081228f},
-std::array<float,2>{0.876816511f, 0.347288758f},
-std::array<float,2>{0.293420285f, 0.0461678915f},
-std::array<float,2>{0.526051402f, 0.884700835f},
-std::array<float,2>{0.432683766f, 0.861308932f},
-std::array<float,2>{0.717897236f, 0.185836032f},
-std::array<float,2>{0.0950177684f, 0.400977731f},
-std::array<float,2>{0.836669385f, 0.634269118f},
-std::array<float,2>{0.111848883f, 0.815054715f},
-std::array<float,2>{0.821487844f, 0.134934813f},
-std::array<float,2>{0.417018414f, 0.430815458f},
-std::array<float,2>{0.699073195f, 0.674242139f},
-std::array<float,2>{0.3031905f, 0.599877715f},
-std::array<float,2>{0.505007386f, 0.328822196f},
-std::array<float,2>{0.156831101f, 0.0159265865f},
-std::array<float,2>{0.901487947f, 0.907129467f},
-std::array<float,2>{0.206479445f, 0.710260808f},
-std::array<float,2>{0.961792946f, 0.480142534f},
-std::array<float,2>{0.313818693f, 0.20500733f},
-std::array<float,2>{0.584953547f, 0.757857084f},
-std::array<float,2>{0.470597327f, 0.977390587f},
-std::array<float,2>{0.630937159f, 0.105071634f},
-std::array<float,2>{0.0491256453f, 0.278299481f},
-std::array<float,2>{0.788223207f, 0.552783489f},
-std::array<float,2>{0.150475055f, 0.890643895f},
-std::array<float,2>{0.927287579f, 0.0555403493f},
-std::array<float,2>{0.272192806f, 0.366142303f},
-std::array<float,2>{0.542264581f, 0.566328168f},
-std::array<float,2>{0.388109416f, 0.649099767f},
-std::array<float,2>{0.724416375f, 0.388757199f},
-std::array<float,2>{0.0921114087f, 0.157807648f},
-std::array<float,2>{0.859181702f, 0.851680398f},
-std::array<float,2>{0.00611940492f, 0.507776082f},
-std::array<float,2>{0.773022056f, 0.306651741f},
-std::array<float,2>{0.447484523f, 0.0864821598f},
-std::array<float,2>{0.66591984f, 0.946790695f},
-std::array<float,2>{0.355462372f, 0.789484978f},
-std::array<float,2>{0.608789206f, 0.226235107f},
-std::array<float,2>{0.234594196f, 0.442380905f},
-std::array<float,2>{0.980720699f, 0.746941626f},
-std::array<float,2>{0.213812709f, 0.838685215f},
-std::array<float,2>{0.957749546f, 0.148986772f},
-std::array<float,2>{0.321384549f, 0.411177039f},
-std::array<float,2>{0.586056054f, 0.662401676f},
-std::array<float,2>{0.482509255f, 0.62157023f},
-std::array<float,2>{0.634886444f, 0.314686567f},
-std::array<float,2>{0.0610485822f, 0.0092135882f},
-std::array<float,2>{0.794240832f, 0.927986324f},
-std::array<float,2>{0.121940762f, 0.702388763f},
-std::array<float,2>{0.818632841f, 0.49451682f},
-std::array<float,2>{0.412860572f, 0.187800318f},
-std::array<float,2>{0.692487895f, 0.769113719f},
-std::array<float,2>{0.311849952f, 0.991613328f},
-std::array<float,2>{0.514857292f, 0.124639846f},
-std::array<float,2>{0.168602303f, 0.26324901f},
-std::array<float,2>{0.892031014f, 0.533073664f},
-std::array<float,2>{0.014669613f, 0.888897836f},
-std::array<float,2>{0.776883245f, 0.042233184f},
-std::array<float,2>{0.439791501f, 0.349108875f},
-std::array<float,2>{0.66217643f, 0.593065858f},
-std::array<float,2>{0.344991952f, 0.637336969f},
-std::array<float,2>{0.596890569f, 0.403734148f},
-std::array<float,2>{0.249385625f, 0.180635273f},
-std::array<float,2>{0.971759379f, 0.866918385f},
-std::array<float,2>{0.144466057f, 0.527261555f},
-std::array<float,2>{0.931803524f, 0.285028934f},
-std::array<float,2>{0.279942453f, 0.0764257237f},
-std::array<float,2>{0.537543237f, 0.955499947f},
-std::array<float,2>{0.379790306f, 0.79751575f},
-std::array<float,2>{0.732283473f, 0.247357488f},
-std::array<float,2>{0.0789619759f, 0.464267343f},
-std::array<float,2>{0.848267138f, 0.722659171f},
-std::array<float,2>{0.0701367632f, 0.763385355f},
-std::array<float,2>{0.864080906f, 0.207535625f},
-std::array<float,2>{0.401383698f, 0.482937008f},
-std::array<float,2>{0.74238205f, 0.703187764f},
-std::array<float,2>{0.261864007f, 0.547278821f},
-std::array<float,2>{0.54890126f, 0.277178258f},
-std::array<float,2>{0.132079884f, 0.107294135f},
-std::array<float,2>{0.91618365f, 0.980728388f},
-std::array<float,2>{0.221724048f, 0.678872168f},
-std::array<float,2>{0.99405849f, 0.433891147f},
-std::array<float,2>{0.360904664f, 0.140066192f},
-std::array<float,2>{0.624092817f, 0.817341626f},
-std::array<float,2>{0.466872692f, 0.913846672f},
-std::array<float,2>{0.673710644f, 0.0228144769f},
-std::array<float,2>{0.0222132057f, 0.33300218f},
-std::array<float,2>{0.753847301f, 0.597249508f},
-std::array<float,2>{0.177981824f, 0.950772166f},
-std::array<float,2>{0.883858144f, 0.0910890251f},
-std::array<float,2>{0.288541108f, 0.31124106f},
-std::array<float,2>{0.519218862f, 0.503316164f},
-std::array<float,2>{0.427779973f, 0.743932247f},
-std::array<float,2>{0.709608853f, 0.440481365f},
-std::array<float,2>{0.104805999f, 0.221058235f},
-std::array<float,2>{0.834279001f, 0.796177864f},
-std::array<float,2>{0.0352339037f, 0.567311823f},
-std::array<float,2>{0.807721198f, 0.359698862f},
-std::array<float,2>{0.49529171f, 0.0610413253f},
-std::array<float,2>{0.652935624f, 0.894641101f},
-std::array<float,2>{0.339468032f, 0.858102381f},
-std::array<float,2>{0.566836715f, 0.16295822f},
-std::array<float,2>{0.189387649f, 0.385433435f},
-std::array<float,2>{0.939708769f, 0.652906835f},
-std::array<float,2>{0.133317113f, 0.782317042f},
-std::array<float,2>{0.908946812f, 0.229548633f},
-std::array<float,2>{0.25217703f, 0.452941686f},
-std::array<float,2>{0.556634247f, 0.741706491f},
-std::array<float,2>{0.395409673f, 0.514010787f},
-std::array<float,2>{0.74095583f, 0.299451649f},
-std::array<float,2>{0.0767978206f, 0.0794576257f},
-std::array<float,2>{0.874144793f, 0.939938009f},
-std::array<float,2>{0.0279090293f, 0.647373974f},
-std::array<float,2>{0.760060847f, 0.38036263f},
-std::array<float,2>{0.457582861f, 0.165703997f},
-std::array<float,2>{0.681933463f, 0.849467397f},
-std::array<float,2>{0.369535714f, 0.90578264f},
-std::array<float,2>{0.614673853f, 0.0492373332f},
-std::array<float,2>{0.230445042f, 0.370218426f},
-std::array<float,2>{0.989352107f, 0.575779378f},
-std::array<float,2>{0.0984311029f, 0.969481885f},
-std::array<float,2>{0.841317236f, 0.0988274291f},
-std::array<float,2>{0.436734974f, 0.27040875f},
-std::array<float,2>{0.711186528f, 0.561178207f},
-std::array<float,2>{0.289695531f, 0.718329072f},
-std::array<float,2>{0.52944684f, 0.470081955f},
-std::array<float,2>{0.183875248f, 0.214346603f},
-std::array<float,2>{0.880852997f, 0.755293906f},
-std::array<float,2>{0.201085493f, 0.607561469f},
-std::array<float,2>{0.948020875f, 0.337784857f},
-std::array<float,2>{0.33338666f, 0.0305398591f},
-std::array<float,2>{0.572208226f, 0.921544135f},
-std::array<float,2>{0.488647729f, 0.821490705f},
-std::array<float,2>{0.641734302f, 0.129693314f},
-std::array<float,2>{0.0419826359f, 0.429337114f},
-std::array<float,2>{0.797397673f, 0.680973649f},
-std::array<float,2>{0.0516972393f, 0.872754037f},
-std::array<float,2>{0.784695268f, 0.173011944f},
-std::array<float,2>{0.474479318f, 0.397775382f},
-std::array<float,2>{0.627197504f, 0.627885401f},
-std::array<float,2>{0.316438109f, 0.579212606f},
-std::array<float,2>{0.578385174f, 0.356264621f},
-std::array<float,2>{0.209286064f, 0.0353835933f},
-std::array<float,2>{0.968419433f, 0.876835108f},
-std::array<float,2>{0.162755802f, 0.731571078f},
-std::array<float,2>{0.902832806f, 0.454503745f},
-std::array<float,2>{0.297700465f, 0.241910696f},
-std::array<float,2>{0.503253281f, 0.807928681f},
-std::array<float,2>{0.420504987f, 0.967388868f},
-std::array<float,2>{0.701284826f, 0.0651495308f},
-std::array<float,2>{0.115137458f, 0.292389959f},
-std::array<float,2>{0.825347245f, 0.521790445f},
-std::array<float,2>{0.241332188f, 0.935504854f},
-std::array<float,2>{0.97994101f, 0.00665192818f},
-std::array<float,2>{0.356864601f, 0.323937327f},
-std::array<float,2>{0.602928758f, 0.613985717f},
-std::array<float,2>{0.452000976f, 0.671250343f},
-std::array<float,2>{0.671180069f, 0.418952674f},
-std::array<float,2>{0.00262349425f, 0.145181909f},
-std::array<float,2>{0.766914248f, 0.830184102f},
-std::array<float,2>{0.0861859992f, 0.542006373f},
-std::array<float,2>{0.852584541f, 0.255860418f},
-std::array<float,2>{0.383834064f, 0.10968823f},
-std::array<float,2>{0.721085787f, 0.995383441f},
-std::array<float,2>{0.26575309f, 0.778515935f},
-std::array<float,2>{0.544505715f, 0.200118199f},
-std::array<float,2>{0.155534044f, 0.486428112f},
-std::array<float,2>{0.922407568f, 0.693341434f},
-std::array<float,2>{0.150225237f, 0.852384806f},
-std::array<float,2>{0.928071976f, 0.157694921f},
-std::array<float,2>{0.269537002f, 0.389514625f},
-std::array<float,2>{0.540239453f, 0.648822427f},
-std::array<float,2>{0.390041977f, 0.565446496f},
-std::array<float,2>{0.725085378f, 0.365328193f},
-std::array<float,2>{0.0901192129f, 0.0551088601f},
-std::array<float,2>{0.855896175f, 0.891368389f},
-std::array<float,2>{0.00541315274f, 0.746223032f},
-std::array<float,2>{0.77068305f, 0.441605479f},
-std::array<float,2>{0.445882916f, 0.2258773f},
-std::array<float,2>{0.667056322f, 0.789729178f},
-std::array<float,2>{0.352890939f, 0.946327269f},
-std::array<float,2>{0.606060743f, 0.0860006809f},
-std::array<float,2>{0.237450317f, 0.307491183f},
-std::array<float,2>{0.983437955f, 0.507071555f},
-std::array<float,2>{0.11009679f, 0.906711698f},
-std::array<float,2>{0.822493017f, 0.0164491292f},
-std::array<float,2>{0.414149255f, 0.3281793f},
-std::array<float,2>{0.695368052f, 0.600584567f},
-std::array<float,2>{0.302670509f, 0.674455345f},
-std::array<float,2>{0.506291568f, 0.431463778f},
-std::array<float,2>{0.159345046f, 0.135707468f},
-std::array<float,2>{0.898777723f, 0.814649105f},
-std::array<float,2>{0.20420602f, 0.55328697f},
-std::array<float,2>{0.964185297f, 0.277429104f},
-std::array<float,2>{0.314985752f, 0.104706638f},
-std::array<float,2>{0.582613707f, 0.976645529f},
-std::array<float,2>{0.47219336f, 0.758576035f},
-std::array<float,2>{0.630139351f, 0.204269394f},
-std::array<float,2>{0.0472105183f, 0.479561716f},
-std::array<float,2>{0.786559999f, 0.710832834f},
-std::array<float,2>{0.0445577353f, 0.801370978f},
-std::array<float,2>{0.803077102f, 0.244141996f},
-std::array<float,2>{0.488168567f, 0.465915412f},
-std::array<float,2>{0.646604419f, 0.720955849f},
-std::array<float,2>{0.328621715f, 0.530492604f},
-std::array<float,2>{0.576805234f, 0.288864553f},
-std::array<float,2>{0.196573928f, 0.0724737495f},
-std::array<float,2>{0.950186968f, 0.9585675f},
-std::array<float,2>{0.183124483f, 0.634511232f},
-std::array<float,2>{0.87781179f, 0.400449693f},
-std::array<float,2>{0.296498209f, 0.186181664f},
-std::array<float,2>{0.523987055f, 0.860378206f},
-std::array<float,2>{0.430139512f, 0.884252429f},
-std::array<float,2>{0.716399491f, 0.046504803f},
-std::array<float,2>{0.0975701511f, 0.346885055f},
-std::array<float,2>{0.839294493f, 0.589509189f},
-std::array<float,2>{0.231791914f, 0.984837949f},
-std::array<float,2>{0.985097528f, 0.117920958f},
-std::array<float,2>{0.374064982f, 0.25897643f},
-std::array<float,2>{0.611503482f, 0.537539124f},
-std::array<float,2>{0.456988752f, 0.698088467f},
-std::array<float,2>{0.683838487f, 0.496690273f},
-std::array<float,2>{0.0235079136f, 0.192204237f},
-std::array<float,2>{0.76255542f, 0.770121336f},
-std::array<float,2>{0.0704196319f, 0.620072365f},
-std::array<float,2>{0.868168354f, 0.317596585f},
-std::array<float,2>{0.3914015f, 0.0150464578f},
-std::array<float,2>{0.737653196f, 0.922583878f},
-std::array<float,2>{0.25520134f, 0.840110183f},
-std::array<float,2>{0.560990572f, 0.154166386f},
-std::array<float,2>{0.138128325f, 0.406795651f},
-std::array<float,2>{0.911831737f, 0.659971595f},
-std::array<float,2>{0.194537759f, 0.776535451f},
-std::array<float,2>{0.941763937f, 0.198567852f},
-std::array<float,2>{0.340903848f, 0.491665214f},
-std::array<float,2>{0.564993918f, 0.689947069f},
-std::array<float,2>{0.496346027f, 0.544768751f},
-std::array<float,2>{0.651988387f, 0.250528753f},
-std::array<float,2>{0.0315048732f, 0.115952067f},
-std::array<float,2>{0.810996354f, 0.997305393f},
-std::array<float,2>{0.105770506f, 0.6672405f},
-std::array<float,2>{0.831350446f, 0.414265096f},
-std::array<float,2>{0.42517969f, 0.14403753f},
-std::array<float,2>{0.705510914f, 0.834363639f},
-std::array<float,2>{0.282952368f, 0.932683945f},
-std::array<float,2>{0.523331463f, 0.000264597649f},
-std::array<float,2>{0.173134476f, 0.325347126f},
-std::array<float,2>{0.89015162f, 0.60987097f},
-std::array<float,2>{0.0193465855f, 0.963844657f},
-std::array<float,2>{0.755396962f, 0.0700141042f},
-std::array<float,2>{0.462428033f, 0.294538021f},
-std::array<float,2>{0.676712334f, 0.518358111f},
-std::array<float,2>{0.36489445f, 0.727749944f},
-std::array<float,2>{0.617934406f, 0.459438354f},
-std::array<float,2>{0.222922966f, 0.234505445f},
-std::array<float,2>{0.999035656f, 0.809648216f},
-std::array<float,2>{0.125662372f, 0.583554566f},
-std::array<float,2>{0.921871483f, 0.35245049f},
-std::array<float,2>{0.259684235f, 0.0350209959f},
-std::array<float,2>{0.55384171f, 0.880488336f},
-std::array<float,2>{0.404527128f, 0.867661297f},
-std::array<float,2>{0.748737752f, 0.179492086f},
-std::array<float,2>{0.0653527677f, 0.393335879f},
-std::array<float,2>{0.860692561f, 0.631146133f},
-std::array<float,2>{0.0825111568f, 0.824587524f},
-std::array<float,2>{0.84592104f, 0.127050772f},
-std::array<float,2>{0.378459573f, 0.422981501f},
-std::array<float,2>{0.7281546f, 0.684396863f},
-std::array<float,2>{0.274364442f, 0.604850709f},
-std::array<float,2>{0.533134222f, 0.34110707f},
-std::array<float,2>{0.146710888f, 0.0238542892f},
-std::array<float,2>{0.936028123f, 0.914088786f},
-std::array<float,2>{0.24242641f, 0.713467121f},
-std::array<float,2>{0.975397706f, 0.474714547f},
-std::array<float,2>{0.349588305f, 0.216165066f},
-std::array<float,2>{0.599835336f, 0.751340032f},
-std::array<float,2>{0.442374498f, 0.972781122f},
-std::array<float,2>{0.658613861f, 0.0943598375f},
-std::array<float,2>{0.00808968022f, 0.269203633f},
-std::array<float,2>{0.778626919f, 0.555689752f},
-std::array<float,2>{0.165522277f, 0.899928749f},
-std::array<float,2>{0.897498131f, 0.0545085259f},
-std::array<float,2>{0.305186272f, 0.37251699f},
-std::array<float,2>{0.511143625f, 0.574088335f},
-std::array<float,2>{0.40768975f, 0.643655777f},
-std::array<float,2>{0.689881682f, 0.377295434f},
-std::array<float,2>{0.119457431f, 0.17017962f},
-std::array<float,2>{0.815245569f, 0.845945895f},
-std::array<float,2>{0.0555743203f, 0.510078669f},
-std::array<float,2>{0.792691231f, 0.302178681f},
-std::array<float,2>{0.479250371f, 0.0825793147f},
-std::array<float,2>{0.63746798f, 0.944667041f},
-std::array<float,2>{0.327664793f, 0.787185848f},
-std::array<float,2>{0.591171026f, 0.233160466f},
-std::array<float,2>{0.215471014f, 0.446146697f},
-std::array<float,2>{0.955076933f, 0.737725437f},
-std::array<float,2>{0.238954261f, 0.830813289f},
-std::array<float,2>{0.978330314f, 0.144961551f},
-std::array<float,2>{0.357472032f, 0.419508725f},
-std::array<float,2>{0.603765488f, 0.671557724f},
-std::array<float,2>{0.450007468f, 0.613514006f},
-std::array<float,2>{0.668635011f, 0.323569745f},
-std::array<float,2>{0.00155222917f, 0.00633542519f},
-std::array<float,2>{0.768632233f, 0.934585154f},
-std::array<float,2>{0.088101916f, 0.692506433f},
-std::array<float,2>{0.854248583f, 0.486991733f},
-std::array<float,2>{0.385267496f, 0.199581429f},
-std::array<float,2>{0.719764531f, 0.77884376f},
-std::array<float,2>{0.268182844f, 0.995931208f},
-std::array<float,2>{0.546527743f, 0.110109068f},
-std::array<float,2>{0.153776094f, 0.256352961f},
-std::array<float,2>{0.923906982f, 0.542615831f},
-std::array<float,2>{0.0540645979f, 0.876298964f},
-std::array<float,2>{0.781302154f, 0.0359463543f},
-std::array<float,2>{0.475196511f, 0.355584979f},
-std::array<float,2>{0.626026511f, 0.579604566f},
-std::array<float,2>{0.319679081f, 0.627366722f},
-std::array<float,2>{0.58022517f, 0.398402214f},
-std::array<float,2>{0.2081898f, 0.173418194f},
-std::array<float,2>{0.966125429f, 0.872537911f},
-std::array<float,2>{0.161529362f, 0.521990716f},
-std::array<float,2>{0.905331731f, 0.292874515f},
-std::array<float,2>{0.299712121f, 0.064750649f},
-std::array<float,2>{0.500055075f, 0.967223585f},
-std::array<float,2>{0.418664455f, 0.808434606f},
-std::array<float,2>{0.700829625f, 0.241479322f},
-std::array<float,2>{0.116705872f, 0.454669863f},
-std::array<float,2>{0.827661335f, 0.732171953f},
-std::array<float,2>{0.100230873f, 0.755392253f},
-std::array<float,2>{0.843208551f, 0.214618698f},
-std::array<float,2>{0.434176326f, 0.470333427f},
-std::array<float,2>{0.71404773f, 0.718146324f},
-std::array<float,2>{0.291585147f, 0.560703814f},
-std::array<float,2>{0.529095471f, 0.269878507f},
-std::array<float,2>{0.185575634f, 0.0992195234f},
-std::array<float,2>{0.881875217f, 0.968987465f},
-std::array<float,2>{0.202662319f, 0.681423545f},
-std::array<float,2>{0.946373224f, 0.428973317f},
-std::array<float,2>{0.334088176f, 0.129280612f},
-std::array<float,2>{0.573538899f, 0.821975529f},
-std::array<float,2>{0.490281463f, 0.920974731f},
-std::array<float,2>{0.642871022f, 0.0308527518f},
-std::array<float,2>{0.0403391086f, 0.337340891f},
-std::array<float,2>{0.799374282f, 0.608043015f},
-std::array<float,2>{0.136121303f, 0.9402349f},
-std::array<float,2>{0.906438828f, 0.0797157809f},
-std::array<float,2>{0.250655055f, 0.299191326f},
-std::array<float,2>{0.557976782f, 0.514393628f},
-std::array<float,2>{0.397275507f, 0.741458893f},
-std::array<float,2>{0.738506198f, 0.452460915f},
-std::array<float,2>{0.0757218078f, 0.230270743f},
-std::array<float,2>{0.873011589f, 0.783007145f},
-std::array<float,2>{0.030442344f, 0.575378895f},
-std::array<float,2>{0.758362889f, 0.37099582f},
-std::array<float,2>{0.459715664f, 0.0493277125f},
-std::array<float,2>{0.68093735f, 0.905638635f},
-std::array<float,2>{0.368061483f, 0.848921955f},
-std::array<float,2>{0.616440296f, 0.165358439f},
-std::array<float,2>{0.227450803f, 0.380648196f},
-std::array<float,2>{0.990297794f, 0.646529555f},
-std::array<float,2>{0.177592024f, 0.796607792f},
-std::array<float,2>{0.886513114f, 0.2215489f},
-std::array<float,2>{0.286698759f, 0.441142619f},
-std::array<float,2>{0.517101169f, 0.743574739f},
-std::array<float,2>{0.425790668f, 0.503508389f},
-std::array<float,2>{0.707850873f, 0.310782671f},
-std::array<float,2>{0.102201678f, 0.0916610211f},
-std::array<float,2>{0.832390249f, 0.950439155f},
-std::array<float,2>{0.0390122086f, 0.6527071f},
-std::array<float,2>{0.805952013f, 0.384788483f},
-std::array<float,2>{0.494002819f, 0.162588179f},
-std::array<float,2>{0.655147672f, 0.857431829f},
-std::array<float,2>{0.337549746f, 0.895332217f},
-std::array<float,2>{0.568496108f, 0.0610137954f},
-std::array<float,2>{0.189661443f, 0.360268503f},
-std::array<float,2>{0.9389382f, 0.566802263f},
-std::array<float,2>{0.0676929355f, 0.980976462f},
-std::array<float,2>{0.8662076f, 0.106838912f},
-std::array<float,2>{0.400249273f, 0.276817411f},
-std::array<float,2>{0.746022642f, 0.547693253f},
-std::array<float,2>{0.263791144f, 0.703990519f},
-std::array<float,2>{0.547185004f, 0.482729226f},
-std::array<float,2>{0.130224004f, 0.207394257f},
-std::array<float,2>{0.915142536f, 0.762799621f},
-std::array<float,2>{0.220122978f, 0.596750081f},
-std::array<float,2>{0.995596051f, 0.332249165f},
-std::array<float,2>{0.36231792f, 0.0233504102f},
-std::array<float,2>{0.621866584f, 0.913378775f},
-std::array<float,2>{0.46637395f, 0.816500187f},
-std::array<float,2>{0.675743461f, 0.140516847f},
-std::array<float,2>{0.0206721891f, 0.434126496f},
-std::array<float,2>{0.750038326f, 0.67955941f},
-std::array<float,2>{0.01264014f, 0.866592646f},
-std::array<float,2>{0.773873389f, 0.180097178f},
-std::array<float,2>{0.439038336f, 0.404055655f},
-std::array<float,2>{0.660750389f, 0.637191594f},
-std::array<float,2>{0.347330421f, 0.593510032f},
-std::array<float,2>{0.595134318f, 0.349352598f},
-std::array<float,2>{0.24619849f, 0.0427715555f},
-std::array<float,2>{0.96918416f, 0.889234662f},
-std::array<float,2>{0.140769124f, 0.723158598f},
-std::array<float,2>{0.931300819f, 0.464376956f},
-std::array<float,2>{0.278923422f, 0.248040348f},
-std::array<float,2>{0.535974681f, 0.797025442f},
-std::array<float,2>{0.382184356f, 0.955703735f},
-std::array<float,2>{0.733103454f, 0.077088818f},
-std::array<float,2>{0.0815468878f, 0.284237981f},
-std::array<float,2>{0.850054741f, 0.526691496f},
-std::array<float,2>{0.211208284f, 0.928431809f},
-std::array<float,2>{0.959861577f, 0.00969067495f},
-std::array<float,2>{0.322438031f, 0.315110087f},
-std::array<float,2>{0.589544117f, 0.621980608f},
-std::array<float,2>{0.48081398f, 0.663002551f},
-std::array<float,2>{0.632902324f, 0.411738038f},
-std::array<float,2>{0.0586161427f, 0.148694143f},
-std::array<float,2>{0.796656966f, 0.838058054f},
-std::array<float,2>{0.123404108f, 0.53235811f},
-std::array<float,2>{0.81655407f, 0.262990832f},
-std::array<float,2>{0.410808533f, 0.124408163f},
-std::array<float,2>{0.694504559f, 0.991849244f},
-std::array<float,2>{0.310495764f, 0.768849909f},
-std::array<float,2>{0.51277262f, 0.188354358f},
-std::array<float,2>{0.170766488f, 0.494889915f},
-std::array<float,2>{0.893140554f, 0.702704132f},
-std::array<float,2>{0.15662688f, 0.813503265f},
-std::array<float,2>{0.90189445f, 0.133030742f},
-std::array<float,2>{0.303599328f, 0.432638198f},
-std::array<float,2>{0.505429149f, 0.67203325f},
-std::array<float,2>{0.417757958f, 0.598938525f},
-std::array<float,2>{0.698355973f, 0.330411524f},
-std::array<float,2>{0.111657687f, 0.0189971998f},
-std::array<float,2>{0.822158158f, 0.909946144f},
-std::array<float,2>{0.0493754819f, 0.707369149f},
-std::array<float,2>{0.788922429f, 0.477017283f},
-std::array<float,2>{0.469973773f, 0.205107227f},
-std::array<float,2>{0.631762207f, 0.760128915f},
-std::array<float,2>{0.314140767f, 0.979165256f},
-std::array<float,2>{0.584354699f, 0.102310725f},
-std::array<float,2>{0.207021922f, 0.279884815f},
-std::array<float,2>{0.961321056f, 0.552642047f},
-std::array<float,2>{0.092285879f, 0.893712342f},
-std::array<float,2>{0.858547032f, 0.0579730272f},
-std::array<float,2>{0.388563216f, 0.363928825f},
-std::array<float,2>{0.723905921f, 0.563350618f},
-std::array<float,2>{0.271620244f, 0.650716305f},
-std::array<float,2>{0.542708814f, 0.387261719f},
-std::array<float,2>{0.151172325f, 0.159767658f},
-std::array<float,2>{0.927003026f, 0.854134917f},
-std::array<float,2>{0.235181466f, 0.505550921f},
-std::array<float,2>{0.981388509f, 0.306068093f},
-std::array<float,2>{0.35488236f, 0.0881640092f},
-std::array<float,2>{0.608893752f, 0.948989689f},
-std::array<float,2>{0.448172092f, 0.792372227f},
-std::array<float,2>{0.665364861f, 0.223605722f},
-std::array<float,2>{0.00681905402f, 0.444304705f},
-std::array<float,2>{0.772595763f, 0.749260545f},
-std::array<float,2>{0.0262941122f, 0.772478759f},
-std::array<float,2>{0.764748991f, 0.194264442f},
-std::array<float,2>{0.453552395f, 0.499121636f},
-std::array<float,2>{0.686285675f, 0.697192252f},
-std::array<float,2>{0.371349335f, 0.535954535f},
-std::array<float,2>{0.609592199f, 0.260611981f},
-std::array<float,2>{0.232823119f, 0.120792292f},
-std::array<float,2>{0.987010717f, 0.986978829f},
-std::array<float,2>{0.138691232f, 0.657209158f},
-std::array<float,2>{0.913446546f, 0.40925923f},
-std::array<float,2>{0.257788599f, 0.155560091f},
-std::array<float,2>{0.559052587f, 0.843111038f},
-std::array<float,2>{0.394372731f, 0.924020052f},
-std::array<float,2>{0.735810995f, 0.0123783471f},
-std::array<float,2>{0.0741171688f, 0.318843752f},
-std::array<float,2>{0.870705962f, 0.618593514f},
-std::array<float,2>{0.197542861f, 0.960085869f},
-std::array<float,2>{0.951656997f, 0.0703607872f},
-std::array<float,2>{0.331572622f, 0.287065893f},
-std::array<float,2>{0.575322866f, 0.528765082f},
-std::array<float,2>{0.484487116f, 0.719697833f},
-std::array<float,2>{0.64564544f, 0.467745721f},
-std::array<float,2>{0.0455062613f, 0.242866755f},
-std::array<float,2>{0.801076829f, 0.804299772f},
-std::array<float,2>{0.0955453739f, 0.586609304f},
-std::array<float,2>{0.83637327f, 0.343753487f},
-std::array<float,2>{0.433440566f, 0.0433476493f},
-std::array<float,2>{0.718265355f, 0.886480033f},
-std::array<float,2>{0.293937445f, 0.86195761f},
-std::array<float,2>{0.525820732f, 0.18463704f},
-std::array<float,2>{0.18017979f, 0.400165051f},
-std::array<float,2>{0.876334131f, 0.635260224f},
-std::array<float,2>{0.225226223f, 0.811623871f},
-std::array<float,2>{0.997668087f, 0.237386659f},
-std::array<float,2>{0.366493762f, 0.457753122f},
-std::array<float,2>{0.62001282f, 0.728594363f},
-std::array<float,2>{0.463702649f, 0.516521037f},
-std::array<float,2>{0.679575264f, 0.29616943f},
-std::array<float,2>{0.015878344f, 0.0667300671f},
-std::array<float,2>{0.756569564f, 0.961830914f},
-std::array<float,2>{0.0643857345f, 0.630613625f},
-std::array<float,2>{0.862760723f, 0.39176324f},
-std::array<float,2>{0.403341323f, 0.176360622f},
-std::array<float,2>{0.746892095f, 0.869765162f},
-std::array<float,2>{0.260832161f, 0.881217659f},
-std::array<float,2>{0.551080525f, 0.0316315033f},
-std::array<float,2>{0.12814416f, 0.354375869f},
-std::array<float,2>{0.918569326f, 0.584378779f},
-std::array<float,2>{0.0341498516f, 0.999948442f},
-std::array<float,2>{0.810283124f, 0.114967577f},
-std::array<float,2>{0.499837726f, 0.252443552f},
-std::array<float,2>{0.648756444f, 0.545192838f},
-std::array<float,2>{0.34182325f, 0.687964618f},
-std::array<float,2>{0.563713908f, 0.48828131f},
-std::array<float,2>{0.192391276f, 0.196631834f},
-std::array<float,2>{0.94406116f, 0.774483979f},
-std::array<float,2>{0.174968243f, 0.611751199f},
-std::array<float,2>{0.887503564f, 0.326268107f},
-std::array<float,2>{0.28506431f, 0.00320263673f},
-std::array<float,2>{0.520204484f, 0.930135787f},
-std::array<float,2>{0.42308858f, 0.833940148f},
-std::array<float,2>{0.704707325f, 0.14077124f},
-std::array<float,2>{0.108899824f, 0.41744557f},
-std::array<float,2>{0.828772008f, 0.664634049f},
-std::array<float,2>{0.11732436f, 0.844289362f},
-std::array<float,2>{0.812898934f, 0.169395f},
-std::array<float,2>{0.409834921f, 0.375688642f},
-std::array<float,2>{0.689217269f, 0.641388834f},
-std::array<float,2>{0.30816102f, 0.571214736f},
-std::array<float,2>{0.509050786f, 0.37333551f},
-std::array<float,2>{0.167812943f, 0.0520632789f},
-std::array<float,2>{0.89498502f, 0.901494086f},
-std::array<float,2>{0.218101442f, 0.735842645f},
-std::array<float,2>{0.955746472f, 0.447276026f},
-std::array<float,2>{0.32582292f, 0.232391775f},
-std::array<float,2>{0.592775106f, 0.785709381f},
-std::array<float,2>{0.477994561f, 0.942188621f},
-std::array<float,2>{0.639149189f, 0.0848473459f},
-std::array<float,2>{0.0583344325f, 0.30303213f},
-std::array<float,2>{0.790392339f, 0.508311629f},
-std::array<float,2>{0.146255374f, 0.917737246f},
-std::array<float,2>{0.934090853f, 0.0269940924f},
-std::array<float,2>{0.276121229f, 0.343399704f},
-std::array<float,2>{0.534571409f, 0.602953672f},
-std::array<float,2>{0.376332998f, 0.686940074f},
-std::array<float,2>{0.729496837f, 0.424581051f},
-std::array<float,2>{0.085463427f, 0.126851231f},
-std::array<float,2>{0.845217764f, 0.826770067f},
-std::array<float,2>{0.0103860125f, 0.556715429f},
-std::array<float,2>{0.779665112f, 0.267198741f},
-std::array<float,2>{0.443740726f, 0.0974898487f},
-std::array<float,2>{0.657176733f, 0.975659788f},
-std::array<float,2>{0.350608677f, 0.752978683f},
-std::array<float,2>{0.598127007f, 0.218316898f},
-std::array<float,2>{0.246059611f, 0.473248065f},
-std::array<float,2>{0.973052084f, 0.712490618f},
-std::array<float,2>{0.209958836f, 0.873284876f},
-std::array<float,2>{0.968171597f, 0.174997434f},
-std::array<float,2>{0.316898584f, 0.396211088f},
-std::array<float,2>{0.578740478f, 0.626835704f},
-std::array<float,2>{0.473742098f, 0.580979586f},
-std::array<float,2>{0.627753675f, 0.357784152f},
-std::array<float,2>{0.0511505045f, 0.0374071561f},
-std::array<float,2>{0.784644842f, 0.878412664f},
-std::array<float,2>{0.114575125f, 0.732769549f},
-std::array<float,2>{0.82588011f, 0.456023961f},
-std::array<float,2>{0.420128673f, 0.240153581f},
-std::array<float,2>{0.702029407f, 0.80505091f},
-std::array<float,2>{0.29709962f, 0.966323495f},
-std::array<float,2>{0.503787518f, 0.0630751327f},
-std::array<float,2>{0.162239149f, 0.289833814f},
-std::array<float,2>{0.902352273f, 0.519537807f},
-std::array<float,2>{0.00212450535f, 0.936907232f},
-std::array<float,2>{0.767460406f, 0.00429178448f},
-std::array<float,2>{0.45154053f, 0.321242034f},
-std::array<float,2>{0.671565413f, 0.615321338f},
-std::array<float,2>{0.357194126f, 0.667997718f},
-std::array<float,2>{0.603211284f, 0.421848863f},
-std::array<float,2>{0.242135301f, 0.146898121f},
-std::array<float,2>{0.980380058f, 0.829489172f},
-std::array<float,2>{0.155984014f, 0.540752172f},
-std::array<float,2>{0.922277629f, 0.254547328f},
-std::array<float,2>{0.266456068f, 0.111534506f},
-std::array<float,2>{0.543966711f, 0.992451787f},
-std::array<float,2>{0.384451836f, 0.779571533f},
-std::array<float,2>{0.7211954f, 0.202448636f},
-std::array<float,2>{0.0866600052f, 0.485173166f},
-std::array<float,2>{0.853468716f, 0.694345653f},
-std::array<float,2>{0.0763549581f, 0.784825325f},
-std::array<float,2>{0.874900579f, 0.227520227f},
-std::array<float,2>{0.394731432f, 0.449560493f},
-std::array<float,2>{0.74050343f, 0.740081549f},
-std::array<float,2>{0.252625525f, 0.512691557f},
-std::array<float,2>{0.556028605f, 0.297034651f},
-std::array<float,2>{0.132877722f, 0.0808342993f},
-std::array<float,2>{0.908375323f, 0.938685894f},
-std::array<float,2>{0.22996594f, 0.646263361f},
-std::array<float,2>{0.989785194f, 0.38259843f},
-std::array<float,2>{0.36973241f, 0.166758969f},
-std::array<float,2>{0.615224242f, 0.850298882f},
-std::array<float,2>{0.45723924f, 0.903320014f},
-std::array<float,2>{0.682178795f, 0.0475587398f},
-std::array<float,2>{0.0276589468f, 0.368838787f},
-std::array<float,2>{0.760386229f, 0.578104973f},
-std::array<float,2>{0.184538901f, 0.971624017f},
-std::array<float,2>{0.880257666f, 0.0998278037f},
-std::array<float,2>{0.289507002f, 0.271683395f},
-std::array<float,2>{0.530240238f, 0.558861136f},
-std::array<float,2>{0.437264353f, 0.716356754f},
-std::array<float,2>{0.711473584f, 0.47134608f},
-std::array<float,2>{0.0980551615f, 0.212437198f},
-std::array<float,2>{0.841023326f, 0.756057441f},
-std::array<float,2>{0.0410967283f, 0.60606277f},
-std::array<float,2>{0.79722333f, 0.339257091f},
-std::array<float,2>{0.488819212f, 0.0288214386f},
-std::array<float,2>{0.642205119f, 0.919818938f},
-std::array<float,2>{0.333826125f, 0.822587729f},
-std::array<float,2>{0.571316719f, 0.131492853f},
-std::array<float,2>{0.200248763f, 0.426228851f},
-std::array<float,2>{0.947690904f, 0.681798935f},
-std::array<float,2>{0.13243477f, 0.764930189f},
-std::array<float,2>{0.916605294f, 0.209122568f},
-std::array<float,2>{0.262440354f, 0.482040823f},
-std::array<float,2>{0.54940182f, 0.705534697f},
-std::array<float,2>{0.401864648f, 0.549068451f},
-std::array<float,2>{0.74270463f, 0.275270283f},
-std::array<float,2>{0.0696401373f, 0.109023154f},
-std::array<float,2>{0.863643467f, 0.98273617f},
-std::array<float,2>{0.0219684057f, 0.676086664f},
-std::array<float,2>{0.752973735f, 0.435911149f},
-std::array<float,2>{0.467590749f, 0.138278708f},
-std::array<float,2>{0.673316121f, 0.819494188f},
-std::array<float,2>{0.360489428f, 0.910337985f},
-std::array<float,2>{0.624775708f, 0.0207646098f},
-std::array<float,2>{0.222581744f, 0.335526317f},
-std::array<float,2>{0.993246198f, 0.595063686f},
-std::array<float,2>{0.105202623f, 0.951604486f},
-std::array<float,2>{0.834793687f, 0.0932940766f},
-std::array<float,2>{0.428308547f, 0.309626222f},
-std::array<float,2>{0.709088445f, 0.501816392f},
-std::array<float,2>{0.288635612f, 0.745077908f},
-std::array<float,2>{0.518576205f, 0.438496768f},
-std::array<float,2>{0.178288803f, 0.220141932f},
-std::array<float,2>{0.884518087f, 0.794839561f},
-std::array<float,2>{0.188852787f, 0.568655014f},
-std::array<float,2>{0.940195858f, 0.362606764f},
-std::array<float,2>{0.339256555f, 0.0593778566f},
-std::array<float,2>{0.566984773f, 0.897227526f},
-std::array<float,2>{0.495933533f, 0.856919348f},
-std::array<float,2>{0.652752519f, 0.162053019f},
-std::array<float,2>{0.0358263291f, 0.383872896f},
-std::array<float,2>{0.808287263f, 0.655402124f},
-std::array<float,2>{0.0608708821f, 0.837384105f},
-std::array<float,2>{0.794829667f, 0.15224342f},
-std::array<float,2>{0.483210415f, 0.413663685f},
-std::array<float,2>{0.635428429f, 0.66081804f},
-std::array<float,2>{0.322043478f, 0.624132037f},
-std::array<float,2>{0.586693883f, 0.313708842f},
-std::array<float,2>{0.213178143f, 0.0105126519f},
-std::array<float,2>{0.957053125f, 0.926498175f},
-std::array<float,2>{0.168183044f, 0.700553417f},
-std::array<float,2>{0.892335713f, 0.493855834f},
-std::array<float,2>{0.31218639f, 0.189800873f},
-std::array<float,2>{0.515347004f, 0.766440511f},
-std::array<float,2>{0.412321061f, 0.989162028f},
-std::array<float,2>{0.693069041f, 0.122642584f},
-std::array<float,2>{0.121467009f, 0.264163256f},
-std::array<float,2>{0.819106102f, 0.534956813f},
-std::array<float,2>{0.249774098f, 0.886919856f},
-std::array<float,2>{0.972240508f, 0.0392488912f},
-std::array<float,2>{0.345640033f, 0.351489544f},
-std::array<float,2>{0.597542644f, 0.591346681f},
-std::array<float,2>{0.440144747f, 0.638977766f},
-std::array<float,2>{0.662891269f, 0.404864848f},
-std::array<float,2>{0.0153570203f, 0.181963652f},
-std::array<float,2>{0.776849329f, 0.864703357f},
-std::array<float,2>{0.0783954635f, 0.525210381f},
-std::array<float,2>{0.847754896f, 0.282922715f},
-std::array<float,2>{0.379390121f, 0.0752765536f},
-std::array<float,2>{0.731827259f, 0.95465821f},
-std::array<float,2>{0.27958259f, 0.800495505f},
-std::array<float,2>{0.53795296f, 0.249226898f},
-std::array<float,2>{0.143961027f, 0.461069465f},
-std::array<float,2>{0.932327807f, 0.726201415f},
-std::array<float,2>{0.137401f, 0.841960013f},
-std::array<float,2>{0.910194576f, 0.154639602f},
-std::array<float,2>{0.254227757f, 0.409058928f},
-std::array<float,2>{0.561778843f, 0.6576581f},
-std::array<float,2>{0.391771108f, 0.617823064f},
-std::array<float,2>{0.736829937f, 0.319448709f},
-std::array<float,2>{0.0713109449f, 0.0135801472f},
-std::array<float,2>{0.867558181f, 0.925543964f},
-std::array<float,2>{0.024416374f, 0.696040094f},
-std::array<float,2>{0.763251245f, 0.498481333f},
-std::array<float,2>{0.455906332f, 0.194711417f},
-std::array<float,2>{0.685211122f, 0.772258401f},
-std::array<float,2>{0.373191327f, 0.988246024f},
-std::array<float,2>{0.612674117f, 0.119441509f},
-std::array<float,2>{0.231123731f, 0.261217684f},
-std::array<float,2>{0.986016333f, 0.536472917f},
-std::array<float,2>{0.096607022f, 0.885273755f},
-std::array<float,2>{0.838170052f, 0.0444426239f},
-std::array<float,2>{0.431384236f, 0.345200807f},
-std::array<float,2>{0.715003192f, 0.587518036f},
-std::array<float,2>{0.295888573f, 0.636536777f},
-std::array<float,2>{0.524522781f, 0.399110973f},
-std::array<float,2>{0.181912631f, 0.184471205f},
-std::array<float,2>{0.878678262f, 0.86263603f},
-std::array<float,2>{0.196132928f, 0.527792633f},
-std::array<float,2>{0.950533152f, 0.285279274f},
-std::array<float,2>{0.32997328f, 0.0720311254f},
-std::array<float,2>{0.577172458f, 0.959398508f},
-std::array<float,2>{0.486944705f, 0.80308336f},
-std::array<float,2>{0.648374319f, 0.243395045f},
-std::array<float,2>{0.0431790985f, 0.468373299f},
-std::array<float,2>{0.803772509f, 0.720473945f},
-std::array<float,2>{0.0485894457f, 0.761281252f},
-std::array<float,2>{0.786080658f, 0.206399024f},
-std::array<float,2>{0.470942587f, 0.477938265f},
-std::array<float,2>{0.629149795f, 0.708887696f},
-std::array<float,2>{0.316023648f, 0.551028311f},
-std::array<float,2>{0.583702564f, 0.280636877f},
-std::array<float,2>{0.204093918f, 0.103424944f},
-std::array<float,2>{0.963098943f, 0.979643285f},
-std::array<float,2>{0.158342406f, 0.673214436f},
-std::array<float,2>{0.900049686f, 0.432425082f},
-std::array<float,2>{0.301148951f, 0.133917823f},
-std::array<float,2>{0.507045507f, 0.813027263f},
-std::array<float,2>{0.415101856f, 0.908459127f},
-std::array<float,2>{0.697193265f, 0.0182283502f},
-std::array<float,2>{0.111244738f, 0.331599325f},
-std::array<float,2>{0.823911846f, 0.597936273f},
-std::array<float,2>{0.236520216f, 0.947590828f},
-std::array<float,2>{0.98263377f, 0.0894824937f},
-std::array<float,2>{0.351677716f, 0.30471015f},
-std::array<float,2>{0.606999815f, 0.504767358f},
-std::array<float,2>{0.447054029f, 0.748345554f},
-std::array<float,2>{0.666348159f, 0.445251942f},
-std::array<float,2>{0.00391347287f, 0.224607453f},
-std::array<float,2>{0.769674063f, 0.791105747f},
-std::array<float,2>{0.0908272862f, 0.563988924f},
-std::array<float,2>{0.857040942f, 0.364744365f},
-std::array<float,2>{0.389183372f, 0.0570222996f},
-std::array<float,2>{0.725662887f, 0.893522382f},
-std::array<float,2>{0.271318048f, 0.855116546f},
-std::array<float,2>{0.539916456f, 0.158776298f},
-std::array<float,2>{0.148945913f, 0.388053507f},
-std::array<float,2>{0.929342151f, 0.65166539f},
-std::array<float,2>{0.216716617f, 0.786809504f},
-std::array<float,2>{0.953478694f, 0.231095582f},
-std::array<float,2>{0.326925009f, 0.448398471f},
-std::array<float,2>{0.590552151f, 0.7349509f},
-std::array<float,2>{0.480342716f, 0.50973779f},
-std::array<float,2>{0.638255477f, 0.303830981f},
-std::array<float,2>{0.056407284f, 0.0857563838f},
-std::array<float,2>{0.79124862f, 0.942918181f},
-std::array<float,2>{0.120319381f, 0.641810596f},
-std::array<float,2>{0.815613568f, 0.376867652f},
-std::array<float,2>{0.406913847f, 0.168361112f},
-std::array<float,2>{0.691050947f, 0.845201135f},
-std::array<float,2>{0.306170136f, 0.901197791f},
-std::array<float,2>{0.510298073f, 0.0511751957f},
-std::array<float,2>{0.164570704f, 0.374169111f},
-std::array<float,2>{0.897070289f, 0.571379542f},
-std::array<float,2>{0.00919804629f, 0.974813879f},
-std::array<float,2>{0.778023303f, 0.0965498015f},
-std::array<float,2>{0.442629755f, 0.266563118f},
-std::array<float,2>{0.659867227f, 0.557827353f},
-std::array<float,2>{0.347855419f, 0.711582124f},
-std::array<float,2>{0.600629687f, 0.473910242f},
-std::array<float,2>{0.243653193f, 0.216833621f},
-std::array<float,2>{0.976216972f, 0.751957417f},
-std::array<float,2>{0.148336798f, 0.601898491f},
-std::array<float,2>{0.937348485f, 0.342540532f},
-std::array<float,2>{0.275245994f, 0.0263520367f},
-std::array<float,2>{0.531615794f, 0.916285634f},
-std::array<float,2>{0.377903908f, 0.827597499f},
-std::array<float,2>{0.727345645f, 0.125698388f},
-std::array<float,2>{0.0831689984f, 0.42540431f},
-std::array<float,2>{0.847296774f, 0.685909033f},
-std::array<float,2>{0.0654503331f, 0.870606303f},
-std::array<float,2>{0.859885335f, 0.177305833f},
-std::array<float,2>{0.406159014f, 0.391441584f},
-std::array<float,2>{0.749319792f, 0.629168272f},
-std::array<float,2>{0.25868389f, 0.585634112f},
-std::array<float,2>{0.553606689f, 0.355224937f},
-std::array<float,2>{0.126098454f, 0.0324638784f},
-std::array<float,2>{0.920200944f, 0.882199347f},
-std::array<float,2>{0.224549487f, 0.729983091f},
-std::array<float,2>{0.998544395f, 0.458145142f},
-std::array<float,2>{0.364007592f, 0.236478686f},
-std::array<float,2>{0.618713856f, 0.811209321f},
-std::array<float,2>{0.461469382f, 0.962409317f},
-std::array<float,2>{0.677585602f, 0.0674892738f},
-std::array<float,2>{0.0177879464f, 0.29543373f},
-std::array<float,2>{0.754608095f, 0.517381251f},
-std::array<float,2>{0.171896532f, 0.930950046f},
-std::array<float,2>{0.889600217f, 0.00249919319f},
-std::array<float,2>{0.28140679f, 0.327723891f},
-std::array<float,2>{0.522393882f, 0.612537026f},
-std::array<float,2>{0.424479753f, 0.665058672f},
-std::array<float,2>{0.707001686f, 0.416523039f},
-std::array<float,2>{0.107210264f, 0.142004743f},
-std::array<float,2>{0.830607116f, 0.832303226f},
-std::array<float,2>{0.0324226394f, 0.5461303f},
-std::array<float,2>{0.811937332f, 0.253654748f},
-std::array<float,2>{0.498010874f, 0.113903828f},
-std::array<float,2>{0.651038826f, 0.998581052f},
-std::array<float,2>{0.339921951f, 0.774052441f},
-std::array<float,2>{0.565930367f, 0.195678473f},
-std::array<float,2>{0.193829238f, 0.489770442f},
-std::array<float,2>{0.94295013f, 0.689294755f},
-std::array<float,2>{0.227808729f, 0.851251423f},
-std::array<float,2>{0.992053628f, 0.167097822f},
-std::array<float,2>{0.368348628f, 0.381011099f},
-std::array<float,2>{0.615723729f, 0.645236552f},
-std::array<float,2>{0.460179389f, 0.576598823f},
-std::array<float,2>{0.679816961f, 0.36763227f},
-std::array<float,2>{0.0297061875f, 0.0486669876f},
-std::array<float,2>{0.759554267f, 0.904089451f},
-std::array<float,2>{0.0746098906f, 0.739212334f},
-std::array<float,2>{0.871557534f, 0.450467616f},
-std::array<float,2>{0.397651911f, 0.22762765f},
-std::array<float,2>{0.740062952f, 0.78396523f},
-std::array<float,2>{0.251030087f, 0.938362598f},
-std::array<float,2>{0.557300985f, 0.0816082433f},
-std::array<float,2>{0.135332242f, 0.297964305f},
-std::array<float,2>{0.908037961f, 0.513173282f},
-std::array<float,2>{0.0393482149f, 0.918593407f},
-std::array<float,2>{0.800346375f, 0.0277873129f},
-std::array<float,2>{0.491370648f, 0.338674664f},
-std::array<float,2>{0.644480824f, 0.60661912f},
-std::array<float,2>{0.335719496f, 0.683106482f},
-std::array<float,2>{0.57302475f, 0.427625626f},
-std::array<float,2>{0.202142954f, 0.132268891f},
-std::array<float,2>{0.945977569f, 0.823471069f},
-std::array<float,2>{0.186768562f, 0.560140371f},
-std::array<float,2>{0.881739616f, 0.273084074f},
-std::array<float,2>{0.29257831f, 0.101046495f},
-std::array<float,2>{0.527602792f, 0.972032547f},
-std::array<float,2>{0.435519516f, 0.757359922f},
-std::array<float,2>{0.713827729f, 0.211436555f},
-std::array<float,2>{0.100968331f, 0.471751571f},
-std::array<float,2>{0.842393875f, 0.71546942f},
-std::array<float,2>{0.115323231f, 0.805953562f},
-std::array<float,2>{0.827031493f, 0.238299206f},
-std::array<float,2>{0.419007748f, 0.456529081f},
-std::array<float,2>{0.699233234f, 0.733485699f},
-std::array<float,2>{0.300141573f, 0.520783961f},
-std::array<float,2>{0.501006603f, 0.290247679f},
-std::array<float,2>{0.16066578f, 0.0637434125f},
-std::array<float,2>{0.905199885f, 0.96559608f},
-std::array<float,2>{0.207314f, 0.625111222f},
-std::array<float,2>{0.965379417f, 0.395310372f},
-std::array<float,2>{0.31851843f, 0.174800456f},
-std::array<float,2>{0.581569791f, 0.874336481f},
-std::array<float,2>{0.475991607f, 0.877545178f},
-std::array<float,2>{0.625269294f, 0.0387866572f},
-std::array<float,2>{0.0530124679f, 0.359033525f},
-std::array<float,2>{0.78318131f, 0.581152797f},
-std::array<float,2>{0.153102875f, 0.993679821f},
-std::array<float,2>{0.925046682f, 0.112551711f},
-std::array<float,2>{0.269050628f, 0.255457968f},
-std::array<float,2>{0.545289397f, 0.539919734f},
-std::array<float,2>{0.386652946f, 0.693390787f},
-std::array<float,2>{0.719215572f, 0.485463411f},
-std::array<float,2>{0.089629747f, 0.201287508f},
-std::array<float,2>{0.854543984f, 0.780388176f},
-std::array<float,2>{0.000117013944f, 0.616690338f},
-std::array<float,2>{0.767784894f, 0.32154417f},
-std::array<float,2>{0.450729042f, 0.00559322815f},
-std::array<float,2>{0.669918895f, 0.935896516f},
-std::array<float,2>{0.358733654f, 0.828248024f},
-std::array<float,2>{0.604996324f, 0.148125231f},
-std::array<float,2>{0.239877522f, 0.420154095f},
-std::array<float,2>{0.97716397f, 0.669896007f},
-std::array<float,2>{0.17124936f, 0.767198801f},
-std::array<float,2>{0.894185126f, 0.19088836f},
-std::array<float,2>{0.308806807f, 0.492875665f},
-std::array<float,2>{0.512270451f, 0.699805558f},
-std::array<float,2>{0.411476552f, 0.533848226f},
-std::array<float,2>{0.694297791f, 0.265320033f},
-std::array<float,2>{0.124816149f, 0.121176369f},
-std::array<float,2>{0.817484915f, 0.989956617f},
-std::array<float,2>{0.0598858148f, 0.661281943f},
-std::array<float,2>{0.795197725f, 0.412871242f},
-std::array<float,2>{0.482228726f, 0.150846392f},
-std::array<float,2>{0.634744585f, 0.836515784f},
-std::array<float,2>{0.324100554f, 0.927571595f},
-std::array<float,2>{0.588136971f, 0.0112963011f},
-std::array<float,2>{0.212030709f, 0.312585473f},
-std::array<float,2>{0.959998786f, 0.623958468f},
-std::array<float,2>{0.0804376677f, 0.953192592f},
-std::array<float,2>{0.851101458f, 0.0747161657f},
-std::array<float,2>{0.381460369f, 0.281468153f},
-std::array<float,2>{0.733751357f, 0.524115562f},
-std::array<float,2>{0.277345002f, 0.725286901f},
-std::array<float,2>{0.53672725f, 0.46198228f},
-std::array<float,2>{0.14196533f, 0.24895145f},
-std::array<float,2>{0.930649459f, 0.798995018f},
-std::array<float,2>{0.247610584f, 0.590445161f},
-std::array<float,2>{0.970251501f, 0.349771142f},
-std::array<float,2>{0.345953554f, 0.0404178128f},
-std::array<float,2>{0.594011307f, 0.888395429f},
-std::array<float,2>{0.43768096f, 0.863968253f},
-std::array<float,2>{0.661858559f, 0.183232471f},
-std::array<float,2>{0.0129943136f, 0.405597627f},
-std::array<float,2>{0.774751902f, 0.640430629f},
-std::array<float,2>{0.0200044792f, 0.818394899f},
-std::array<float,2>{0.7518031f, 0.137112588f},
-std::array<float,2>{0.465422928f, 0.436570853f},
-std::array<float,2>{0.674185395f, 0.67750138f},
-std::array<float,2>{0.362067193f, 0.594334781f},
-std::array<float,2>{0.622570395f, 0.334067076f},
-std::array<float,2>{0.219008327f, 0.0198741741f},
-std::array<float,2>{0.994282961f, 0.911614299f},
-std::array<float,2>{0.129684836f, 0.706709087f},
-std::array<float,2>{0.914585114f, 0.480788112f},
-std::array<float,2>{0.265418738f, 0.21052514f},
-std::array<float,2>{0.548056483f, 0.764016092f},
-std::array<float,2>{0.398478806f, 0.984297693f},
-std::array<float,2>{0.744462848f, 0.107777104f},
-std::array<float,2>{0.0673234239f, 0.273470461f},
-std::array<float,2>{0.866858602f, 0.550616145f},
-std::array<float,2>{0.190637112f, 0.89828968f},
-std::array<float,2>{0.937880158f, 0.0604984798f},
-std::array<float,2>{0.336420149f, 0.361733556f},
-std::array<float,2>{0.569965601f, 0.570227206f},
-std::array<float,2>{0.492435783f, 0.65518862f},
-std::array<float,2>{0.655274332f, 0.383735687f},
-std::array<float,2>{0.0371308252f, 0.160196364f},
-std::array<float,2>{0.804903507f, 0.855551362f},
-std::array<float,2>{0.103117913f, 0.500221252f},
-std::array<float,2>{0.833486378f, 0.308833688f},
-std::array<float,2>{0.427530587f, 0.0925894976f},
-std::array<float,2>{0.708806276f, 0.952967286f},
-std::array<float,2>{0.285648137f, 0.793439388f},
-std::array<float,2>{0.516042411f, 0.219182536f},
-std::array<float,2>{0.176306859f, 0.437779874f},
-std::array<float,2>{0.885140121f, 0.745655596f},
-std::array<float,2>{0.181617782f, 0.859391272f},
-std::array<float,2>{0.8751508f, 0.187321872f},
-std::array<float,2>{0.294333577f, 0.401579142f},
-std::array<float,2>{0.526548743f, 0.632955432f},
-std::array<float,2>{0.431684017f, 0.588645875f},
-std::array<float,2>{0.717204392f, 0.346529126f},
-std::array<float,2>{0.0938624814f, 0.0452684127f},
-std::array<float,2>{0.837542534f, 0.883545995f},
-std::array<float,2>{0.0462055765f, 0.72183466f},
-std::array<float,2>{0.802123308f, 0.46525979f},
-std::array<float,2>{0.48589161f, 0.245904461f},
-std::array<float,2>{0.64521873f, 0.802229822f},
-std::array<float,2>{0.330138415f, 0.957437694f},
-std::array<float,2>{0.574249685f, 0.0739241689f},
-std::array<float,2>{0.198831305f, 0.288024068f},
-std::array<float,2>{0.95228231f, 0.529738963f},
-std::array<float,2>{0.072390914f, 0.923031807f},
-std::array<float,2>{0.869382024f, 0.0144166024f},
-std::array<float,2>{0.393202215f, 0.31690675f},
-std::array<float,2>{0.734478593f, 0.620682895f},
-std::array<float,2>{0.256159097f, 0.658860028f},
-std::array<float,2>{0.55984199f, 0.407949507f},
-std::array<float,2>{0.140163392f, 0.153048053f},
-std::array<float,2>{0.912360311f, 0.841655672f},
-std::array<float,2>{0.233685255f, 0.53856039f},
-std::array<float,2>{0.987883925f, 0.257829607f},
-std::array<float,2>{0.372539133f, 0.118226618f},
-std::array<float,2>{0.610453725f, 0.985828638f},
-std::array<float,2>{0.454458207f, 0.770849049f},
-std::array<float,2>{0.687121272f, 0.192595735f},
-std::array<float,2>{0.0270915478f, 0.497967422f},
-std::array<float,2>{0.763929307f, 0.698996127f},
-std::array<float,2>{0.00710282195f, 0.790759027f},
-std::array<float,2>{0.771676004f, 0.224743262f},
-std::array<float,2>{0.448929071f, 0.443207085f},
-std::array<float,2>{0.664454818f, 0.747619748f},
-std::array<float,2>{0.353790909f, 0.506584048f},
-std::array<float,2>{0.608028531f, 0.307949513f},
-std::array<float,2>{0.235387951f, 0.0874800831f},
-std::array<float,2>{0.982305169f, 0.945689917f},
-std::array<float,2>{0.151667804f, 0.650270879f},
-std::array<float,2>{0.926150858f, 0.390559167f},
-std::array<float,2>{0.272641152f, 0.157113597f},
-std::array<float,2>{0.541287184f, 0.853030443f},
-std::array<float,2>{0.386781186f, 0.892571211f},
-std::array<float,2>{0.72293824f, 0.0557266325f},
-std::array<float,2>{0.0929771513f, 0.366621405f},
-std::array<float,2>{0.857865512f, 0.565106392f},
-std::array<float,2>{0.20524618f, 0.977869511f},
-std::array<float,2>{0.962190568f, 0.104162298f},
-std::array<float,2>{0.312708706f, 0.279036254f},
-std::array<float,2>{0.585098684f, 0.554280221f},
-std::array<float,2>{0.46949327f, 0.709061384f},
-std::array<float,2>{0.632375002f, 0.479395509f},
-std::array<float,2>{0.0505936258f, 0.204025269f},
-std::array<float,2>{0.787831187f, 0.759527743f},
-std::array<float,2>{0.112808712f, 0.600929737f},
-std::array<float,2>{0.821228147f, 0.329430997f},
-std::array<float,2>{0.41605559f, 0.0172507372f},
-std::array<float,2>{0.697686791f, 0.907319546f},
-std::array<float,2>{0.30388692f, 0.815829754f},
-std::array<float,2>{0.504602969f, 0.136123046f},
-std::array<float,2>{0.157765418f, 0.429759264f},
-std::array<float,2>{0.900718629f, 0.67501241f},
-std::array<float,2>{0.244914919f, 0.750124693f},
-std::array<float,2>{0.973994613f, 0.215441138f},
-std::array<float,2>{0.349824995f, 0.47632125f},
-std::array<float,2>{0.598736644f, 0.714194119f},
-std::array<float,2>{0.444540143f, 0.555461168f},
-std::array<float,2>{0.658143997f, 0.268023372f},
-std::array<float,2>{0.0114492858f, 0.0949811116f},
-std::array<float,2>{0.781055033f, 0.973973036f},
-std::array<float,2>{0.0844342262f, 0.684789658f},
-std::array<float,2>{0.844714463f, 0.422184646f},
-std::array<float,2>{0.375680178f, 0.128176227f},
-std::array<float,2>{0.729287207f, 0.826127768f},
-std::array<float,2>{0.276754647f, 0.915755451f},
-std::array<float,2>{0.533717155f, 0.0249812193f},
-std::array<float,2>{0.145164236f, 0.340525717f},
-std::array<float,2>{0.934956193f, 0.604224324f},
-std::array<float,2>{0.056663353f, 0.943903685f},
-std::array<float,2>{0.789768517f, 0.0832476467f},
-std::array<float,2>{0.477098435f, 0.300800622f},
-std::array<float,2>{0.640447617f, 0.5107463f},
-std::array<float,2>{0.324724585f, 0.737029076f},
-std::array<float,2>{0.592014968f, 0.446422517f},
-std::array<float,2>{0.217718884f, 0.234360427f},
-std::array<float,2>{0.956285715f, 0.788397074f},
-std::array<float,2>{0.166551352f, 0.572373867f},
-std::array<float,2>{0.895887136f, 0.371441096f},
-std::array<float,2>{0.30692929f, 0.0528807677f},
-std::array<float,2>{0.508022189f, 0.89867866f},
-std::array<float,2>{0.408531576f, 0.84710443f},
-std::array<float,2>{0.687772751f, 0.17143558f},
-std::array<float,2>{0.118548714f, 0.378665149f},
-std::array<float,2>{0.813937485f, 0.643502355f},
-std::array<float,2>{0.108391739f, 0.835899055f},
-std::array<float,2>{0.829461932f, 0.142899707f},
-std::array<float,2>{0.422818124f, 0.415759206f},
-std::array<float,2>{0.703686774f, 0.666553974f},
-std::array<float,2>{0.284148872f, 0.61125648f},
-std::array<float,2>{0.521177888f, 0.324691653f},
-std::array<float,2>{0.174116299f, 0.00165502809f},
-std::array<float,2>{0.887995899f, 0.932079494f},
-std::array<float,2>{0.191712901f, 0.690569758f},
-std::array<float,2>{0.944981992f, 0.490874499f},
-std::array<float,2>{0.343667716f, 0.197663471f},
-std::array<float,2>{0.562534273f, 0.776035547f},
-std::array<float,2>{0.498066396f, 0.996485472f},
-std::array<float,2>{0.649943352f, 0.116802588f},
-std::array<float,2>{0.0350240134f, 0.251473695f},
-std::array<float,2>{0.808806539f, 0.543437183f},
-std::array<float,2>{0.127150938f, 0.879377902f},
-std::array<float,2>{0.918978333f, 0.0336390845f},
-std::array<float,2>{0.260699332f, 0.353208929f},
-std::array<float,2>{0.55232501f, 0.582841218f},
-std::array<float,2>{0.402841687f, 0.632262349f},
-std::array<float,2>{0.747274339f, 0.393795907f},
-std::array<float,2>{0.0627847761f, 0.177942693f},
-std::array<float,2>{0.861779988f, 0.869087517f},
-std::array<float,2>{0.0169018209f, 0.518703878f},
-std::array<float,2>{0.757200122f, 0.29360199f},
-std::array<float,2>{0.463979036f, 0.0685989335f},
-std::array<float,2>{0.677829802f, 0.964788556f},
-std::array<float,2>{0.365334272f, 0.808669567f},
-std::array<float,2>{0.621030748f, 0.235429555f},
-std::array<float,2>{0.225900576f, 0.460113466f},
-std::array<float,2>{0.99627322f, 0.72703284f},
-std::array<float,2>{0.199372575f, 0.820634604f},
-std::array<float,2>{0.948852897f, 0.130227879f},
-std::array<float,2>{0.332632989f, 0.42813009f},
-std::array<float,2>{0.570619881f, 0.680091679f},
-std::array<float,2>{0.489764124f, 0.608451664f},
-std::array<float,2>{0.640698195f, 0.336307943f},
-std::array<float,2>{0.0427205339f, 0.0296541769f},
-std::array<float,2>{0.798620999f, 0.920164645f},
-std::array<float,2>{0.0993376821f, 0.717477381f},
-std::array<float,2>{0.840256333f, 0.469527006f},
-std::array<float,2>{0.436401725f, 0.212977797f},
-std::array<float,2>{0.71235311f, 0.754668355f},
-std::array<float,2>{0.290713936f, 0.97048682f},
-std::array<float,2>{0.530762613f, 0.097936511f},
-std::array<float,2>{0.184812725f, 0.270676315f},
-std::array<float,2>{0.879449427f, 0.561657012f},
-std::array<float,2>{0.0290907528f, 0.90450114f},
-std::array<float,2>{0.761171997f, 0.0503467657f},
-std::array<float,2>{0.458685637f, 0.369614482f},
-std::array<float,2>{0.683077335f, 0.575021982f},
-std::array<float,2>{0.370683193f, 0.647809088f},
-std::array<float,2>{0.613722384f, 0.379383206f},
-std::array<float,2>{0.228882909f, 0.164596081f},
-std::array<float,2>{0.988482893f, 0.848573267f},
-std::array<float,2>{0.134187251f, 0.515387893f},
-std::array<float,2>{0.90926075f, 0.300357252f},
-std::array<float,2>{0.252935916f, 0.078787297f},
-std::array<float,2>{0.555452704f, 0.94066143f},
-std::array<float,2>{0.395749271f, 0.781586051f},
-std::array<float,2>{0.741488576f, 0.228905395f},
-std::array<float,2>{0.077231206f, 0.451874703f},
-std::array<float,2>{0.873794436f, 0.740854204f},
-std::array<float,2>{0.0877568424f, 0.777407467f},
-std::array<float,2>{0.852256775f, 0.200299546f},
-std::array<float,2>{0.382989466f, 0.488125533f},
-std::array<float,2>{0.72181344f, 0.69162178f},
-std::array<float,2>{0.266820043f, 0.541286409f},
-std::array<float,2>{0.543746233f, 0.25747931f},
-std::array<float,2>{0.154512063f, 0.11111898f},
-std::array<float,2>{0.923545539f, 0.994225323f},
-std::array<float,2>{0.240351349f, 0.6700207f},
-std::array<float,2>{0.978693008f, 0.418927342f},
-std::array<float,2>{0.355753124f, 0.146172568f},
-std::array<float,2>{0.602078438f, 0.831935465f},
-std::array<float,2>{0.453022659f, 0.933970332f},
-std::array<float,2>{0.67008847f, 0.00730949407f},
-std::array<float,2>{0.00374979945f, 0.322952509f},
-std::array<float,2>{0.765909195f, 0.614657462f},
-std::array<float,2>{0.164019719f, 0.968135357f},
-std::array<float,2>{0.903747737f, 0.0660581589f},
-std::array<float,2>{0.298408061f, 0.29156208f},
-std::array<float,2>{0.502356529f, 0.522772372f},
-std::array<float,2>{0.421014249f, 0.730678678f},
-std::array<float,2>{0.702741504f, 0.453132838f},
-std::array<float,2>{0.113741986f, 0.240608484f},
-std::array<float,2>{0.825158298f, 0.806713223f},
-std::array<float,2>{0.0520941727f, 0.579031169f},
-std::array<float,2>{0.783737123f, 0.356482655f},
-std::array<float,2>{0.472799271f, 0.0361339636f},
-std::array<float,2>{0.628481328f, 0.875084221f},
-std::array<float,2>{0.317870855f, 0.871696591f},
-std::array<float,2>{0.57992208f, 0.172657698f},
-std::array<float,2>{0.209988832f, 0.396754563f},
-std::array<float,2>{0.967632174f, 0.628568113f},
-std::array<float,2>{0.143039852f, 0.798285604f},
-std::array<float,2>{0.933507979f, 0.246393308f},
-std::array<float,2>{0.280980855f, 0.463754892f},
-std::array<float,2>{0.538907051f, 0.723641157f},
-std::array<float,2>{0.380414039f, 0.525922179f},
-std::array<float,2>{0.730727732f, 0.28406173f},
-std::array<float,2>{0.0794524401f, 0.077548489f},
-std::array<float,2>{0.84880358f, 0.956973851f},
-std::array<float,2>{0.0142107243f, 0.637912333f},
-std::array<float,2>{0.776007056f, 0.403046161f},
-std::array<float,2>{0.440648764f, 0.18079032f},
-std::array<float,2>{0.664024413f, 0.865716457f},
-std::array<float,2>{0.344043791f, 0.889996588f},
-std::array<float,2>{0.596390069f, 0.0413084552f},
-std::array<float,2>{0.248384342f, 0.347981155f},
-std::array<float,2>{0.971527159f, 0.59266156f},
-std::array<float,2>{0.122946963f, 0.990628302f},
-std::array<float,2>{0.819832861f, 0.12337824f},
-std::array<float,2>{0.413448483f, 0.262480468f},
-std::array<float,2>{0.692244232f, 0.531370103f},
-std::array<float,2>{0.311046958f, 0.701389551f},
-std::array<float,2>{0.514400423f, 0.495182097f},
-std::array<float,2>{0.16895628f, 0.18904376f},
-std::array<float,2>{0.890807569f, 0.7682181f},
-std::array<float,2>{0.214738935f, 0.622202635f},
-std::array<float,2>{0.958642721f, 0.316245168f},
-std::array<float,2>{0.32060203f, 0.00840666052f},
-std::array<float,2>{0.587539434f, 0.929672778f},
-std::array<float,2>{0.483502775f, 0.839230657f},
-std::array<float,2>{0.636290371f, 0.150277108f},
-std::array<float,2>{0.0618208982f, 0.410532027f},
-std::array<float,2>{0.792976856f, 0.663287401f},
-std::array<float,2>{0.036429923f, 0.858473003f},
-std::array<float,2>{0.807039857f, 0.163423777f},
-std::array<float,2>{0.49480778f, 0.386636287f},
-std::array<float,2>{0.654294848f, 0.653802872f},
-std::array<float,2>{0.338225722f, 0.568291068f},
-std::array<float,2>{0.567646444f, 0.360896975f},
-std::array<float,2>{0.188178584f, 0.0617833287f},
-std::array<float,2>{0.941028655f, 0.895897925f},
-std::array<float,2>{0.179026902f, 0.743060589f},
-std::array<float,2>{0.883514583f, 0.43947053f},
-std::array<float,2>{0.287895948f, 0.222537294f},
-std::array<float,2>{0.517598569f, 0.795368254f},
-std::array<float,2>{0.42915529f, 0.949993432f},
-std::array<float,2>{0.710064054f, 0.0900500044f},
-std::array<float,2>{0.104086407f, 0.311621189f},
-std::array<float,2>{0.835659564f, 0.502499342f},
-std::array<float,2>{0.221125722f, 0.912544429f},
-std::array<float,2>{0.992226124f, 0.0221537799f},
-std::array<float,2>{0.360222846f, 0.333706856f},
-std::array<float,2>{0.623483717f, 0.596420705f},
-std::array<float,2>{0.46839574f, 0.678424537f},
-std::array<float,2>{0.672467113f, 0.434973538f},
-std::array<float,2>{0.0231938623f, 0.138824031f},
-std::array<float,2>{0.752814531f, 0.817670405f},
-std::array<float,2>{0.0686049312f, 0.547871947f},
-std::array<float,2>{0.865128875f, 0.275452644f},
-std::array<float,2>{0.400617898f, 0.105880119f},
-std::array<float,2>{0.743959367f, 0.982311606f},
-std::array<float,2>{0.262781769f, 0.762345374f},
-std::array<float,2>{0.550765932f, 0.208953455f},
-std::array<float,2>{0.131701589f, 0.484198123f},
-std::array<float,2>{0.917099357f, 0.704433322f},
-std::array<float,2>{0.135701194f, 0.849257529f},
-std::array<float,2>{0.907943964f, 0.165883482f},
-std::array<float,2>{0.251304954f, 0.380101264f},
-std::array<float,2>{0.557509661f, 0.647099197f},
-std::array<float,2>{0.397715211f, 0.576061428f},
-std::array<float,2>{0.739808381f, 0.370483428f},
-std::array<float,2>{0.0743833184f, 0.0488969311f},
-std::array<float,2>{0.871209383f, 0.906182647f},
-std::array<float,2>{0.0293686129f, 0.742124498f},
-std::array<float,2>{0.75933969f, 0.452875644f},
-std::array<float,2>{0.460394502f, 0.229762077f},
-std::array<float,2>{0.680044293f, 0.782511711f},
-std::array<float,2>{0.368561208f, 0.939626813f},
-std::array<float,2>{0.616075039f, 0.0793276578f},
-std::array<float,2>{0.227638662f, 0.299745023f},
-std::array<float,2>{0.991815567f, 0.513849676f},
-std::array<float,2>{0.100704186f, 0.921783566f},
-std::array<float,2>{0.842772603f, 0.0304216705f},
-std::array<float,2>{0.435277194f, 0.337461114f},
-std::array<float,2>{0.713622987f, 0.607812166f},
-std::array<float,2>{0.292814523f, 0.680833936f},
-std::array<float,2>{0.527451098f, 0.429525256f},
-std::array<float,2>{0.186636508f, 0.129554182f},
-std::array<float,2>{0.881466389f, 0.821564257f},
-std::array<float,2>{0.201668829f, 0.561288238f},
-std::array<float,2>{0.946053863f, 0.270023763f},
-std::array<float,2>{0.335554391f, 0.0990330875f},
-std::array<float,2>{0.572989941f, 0.96952337f},
-std::array<float,2>{0.491528898f, 0.75495702f},
-std::array<float,2>{0.644285381f, 0.213940069f},
-std::array<float,2>{0.0391866043f, 0.469904065f},
-std::array<float,2>{0.800545692f, 0.718551755f},
-std::array<float,2>{0.0529001318f, 0.807793081f},
-std::array<float,2>{0.782832682f, 0.242017135f},
-std::array<float,2>{0.475806296f, 0.45425728f},
-std::array<float,2>{0.625093937f, 0.731781006f},
-std::array<float,2>{0.318663567f, 0.5214867f},
-std::array<float,2>{0.581985116f, 0.292127132f},
-std::array<float,2>{0.207150251f, 0.0653662309f},
-std::array<float,2>{0.965578079f, 0.967628837f},
-std::array<float,2>{0.16089569f, 0.627539575f},
-std::array<float,2>{0.904996991f, 0.397684425f},
-std::array<float,2>{0.299936146f, 0.173117355f},
-std::array<float,2>{0.50137341f, 0.872981846f},
-std::array<float,2>{0.419344038f, 0.876479089f},
-std::array<float,2>{0.699468732f, 0.0355059095f},
-std::array<float,2>{0.115517631f, 0.355995744f},
-std::array<float,2>{0.826871157f, 0.579465449f},
-std::array<float,2>{0.240154982f, 0.99522227f},
-std::array<float,2>{0.977356672f, 0.109447867f},
-std::array<float,2>{0.358509839f, 0.256131738f},
-std::array<float,2>{0.605255663f, 0.542388201f},
-std::array<float,2>{0.451012373f, 0.692931592f},
-std::array<float,2>{0.669574618f, 0.486668229f},
-std::array<float,2>{0.000273729878f, 0.199846208f},
-std::array<float,2>{0.767869473f, 0.778743446f},
-std::array<float,2>{0.0894521624f, 0.614247978f},
-std::array<float,2>{0.85484004f, 0.324173391f},
-std::array<float,2>{0.386231542f, 0.00651659723f},
-std::array<float,2>{0.71885711f, 0.935118675f},
-std::array<float,2>{0.269457906f, 0.830325186f},
-std::array<float,2>{0.544952929f, 0.145313263f},
-std::array<float,2>{0.153039142f, 0.419233918f},
-std::array<float,2>{0.925160348f, 0.670954406f},
-std::array<float,2>{0.212303251f, 0.769292235f},
-std::array<float,2>{0.960373998f, 0.187659383f},
-std::array<float,2>{0.323949307f, 0.494195938f},
-std::array<float,2>{0.587935925f, 0.702470839f},
-std::array<float,2>{0.482053608f, 0.532825828f},
-std::array<float,2>{0.634348273f, 0.263444513f},
-std::array<float,2>{0.0597317033f, 0.12486133f},
-std::array<float,2>{0.794942558f, 0.991433322f},
-std::array<float,2>{0.124634676f, 0.66215384f},
-std::array<float,2>{0.817718923f, 0.411429793f},
-std::array<float,2>{0.411369741f, 0.149260819f},
-std::array<float,2>{0.693920135f, 0.838516951f},
-std::array<float,2>{0.309036374f, 0.927921951f},
-std::array<float,2>{0.512495518f, 0.0090151988f},
-std::array<float,2>{0.171008691f, 0.314887732f},
-std::array<float,2>{0.89453119f, 0.62129277f},
-std::array<float,2>{0.0128032612f, 0.95531702f},
-std::array<float,2>{0.774515748f, 0.076269336f},
-std::array<float,2>{0.437938869f, 0.284690648f},
-std::array<float,2>{0.662008703f, 0.526924729f},
-std::array<float,2>{0.345762223f, 0.723059356f},
-std::array<float,2>{0.59398216f, 0.464110643f},
-std::array<float,2>{0.247983292f, 0.247075096f},
-std::array<float,2>{0.970535159f, 0.797673821f},
-std::array<float,2>{0.141769677f, 0.592865944f},
-std::array<float,2>{0.930274129f, 0.348803341f},
-std::array<float,2>{0.27782017f, 0.0424709469f},
-std::array<float,2>{0.537080586f, 0.888933003f},
-std::array<float,2>{0.381604075f, 0.867044926f},
-std::array<float,2>{0.733479083f, 0.180293217f},
-std::array<float,2>{0.0802198052f, 0.403470159f},
-std::array<float,2>{0.851388693f, 0.637674689f},
-std::array<float,2>{0.0669574291f, 0.817036331f},
-std::array<float,2>{0.86701405f, 0.13983418f},
-std::array<float,2>{0.398765236f, 0.433814377f},
-std::array<float,2>{0.744350374f, 0.679112017f},
-std::array<float,2>{0.265283614f, 0.597491503f},
-std::array<float,2>{0.548245549f, 0.332566589f},
-std::array<float,2>{0.12951833f, 0.0224689897f},
-std::array<float,2>{0.91487968f, 0.913755834f},
-std::array<float,2>{0.21887286f, 0.703452229f},
-std::array<float,2>{0.994401336f, 0.483200401f},
-std::array<float,2>{0.361822844f, 0.207825661f},
-std::array<float,2>{0.622927725f, 0.763641477f},
-std::array<float,2>{0.465663761f, 0.980550528f},
-std::array<float,2>{0.674037874f, 0.107114591f},
-std::array<float,2>{0.0195526257f, 0.276889354f},
-std::array<float,2>{0.751599789f, 0.546984136f},
-std::array<float,2>{0.176554352f, 0.894842267f},
-std::array<float,2>{0.884852409f, 0.0614763163f},
-std::array<float,2>{0.286029726f, 0.35951376f},
-std::array<float,2>{0.515665352f, 0.567049861f},
-std::array<float,2>{0.427414745f, 0.653127491f},
-std::array<float,2>{0.708709836f, 0.385508716f},
-std::array<float,2>{0.103273265f, 0.162689075f},
-std::array<float,2>{0.833088219f, 0.858175576f},
-std::array<float,2>{0.0374429859f, 0.502943933f},
-std::array<float,2>{0.804966748f, 0.311367393f},
-std::array<float,2>{0.492417216f, 0.0909262225f},
-std::array<float,2>{0.655695617f, 0.9509902f},
-std::array<float,2>{0.336001098f, 0.79605037f},
-std::array<float,2>{0.570077121f, 0.220703423f},
-std::array<float,2>{0.190701529f, 0.440760165f},
-std::array<float,2>{0.937705398f, 0.74387753f},
-std::array<float,2>{0.23123233f, 0.84061414f},
-std::array<float,2>{0.986114025f, 0.153369293f},
-std::array<float,2>{0.373338282f, 0.40648365f},
-std::array<float,2>{0.612347782f, 0.659572721f},
-std::array<float,2>{0.455571145f, 0.619565785f},
-std::array<float,2>{0.685490787f, 0.318030238f},
-std::array<float,2>{0.0248441268f, 0.0153833218f},
-std::array<float,2>{0.763584971f, 0.921973586f},
-std::array<float,2>{0.0716045275f, 0.697592974f},
-std::array<float,2>{0.867253006f, 0.496267885f},
-std::array<float,2>{0.391862184f, 0.191677928f},
-std::array<float,2>{0.737100601f, 0.769561112f},
-std::array<float,2>{0.253911942f, 0.985037684f},
-std::array<float,2>{0.561568081f, 0.117561579f},
-std::array<float,2>{0.137608305f, 0.259433478f},
-std::array<float,2>{0.910547733f, 0.537906468f},
-std::array<float,2>{0.0432671532f, 0.884279251f},
-std::array<float,2>{0.804181993f, 0.0460626073f},
-std::array<float,2>{0.487248331f, 0.347638369f},
-std::array<float,2>{0.648164928f, 0.589147031f},
-std::array<float,2>{0.32980594f, 0.633820117f},
-std::array<float,2>{0.57744056f, 0.401221454f},
-std::array<float,2>{0.195833281f, 0.185674325f},
-std::array<float,2>{0.95043236f, 0.860846281f},
-std::array<float,2>{0.181831613f, 0.531068504f},
-std::array<float,2>{0.878625691f, 0.288309157f},
-std::array<float,2>{0.295453042f, 0.0732219815f},
-std::array<float,2>{0.524719238f, 0.958358645f},
-std::array<float,2>{0.431602865f, 0.800820887f},
-std::array<float,2>{0.71519953f, 0.244994402f},
-std::array<float,2>{0.0962541401f, 0.466622353f},
-std::array<float,2>{0.837946117f, 0.721366882f},
-std::array<float,2>{0.110943064f, 0.758141816f},
-std::array<float,2>{0.824043572f, 0.204770356f},
-std::array<float,2>{0.415347129f, 0.480234623f},
-std::array<float,2>{0.696820319f, 0.710042059f},
-std::array<float,2>{0.300884932f, 0.553031743f},
-std::array<float,2>{0.507264614f, 0.277980536f},
-std::array<float,2>{0.158521235f, 0.105344862f},
-std::array<float,2>{0.900319397f, 0.977092028f},
-std::array<float,2>{0.203656808f, 0.67396909f},
-std::array<float,2>{0.963163912f, 0.431095809f},
-std::array<float,2>{0.316332698f, 0.13515389f},
-std::array<float,2>{0.583805621f, 0.815224588f},
-std::array<float,2>{0.471183717f, 0.90696156f},
-std::array<float,2>{0.629329801f, 0.0157450363f},
-std::array<float,2>{0.0485367626f, 0.328953743f},
-std::array<float,2>{0.785655379f, 0.59970212f},
-std::array<float,2>{0.149306282f, 0.94708997f},
-std::array<float,2>{0.929519296f, 0.086821124f},
-std::array<float,2>{0.271174639f, 0.307080448f},
-std::array<float,2>{0.539569438f, 0.507425427f},
-std::array<float,2>{0.389409631f, 0.746792376f},
-std::array<float,2>{0.725830138f, 0.441936582f},
-std::array<float,2>{0.0910672173f, 0.226447731f},
-std::array<float,2>{0.857237518f, 0.78909868f},
-std::array<float,2>{0.00420889212f, 0.566052258f},
-std::array<float,2>{0.769922614f, 0.365827024f},
-std::array<float,2>{0.446916044f, 0.0553240404f},
-std::array<float,2>{0.666221738f, 0.89106673f},
-std::array<float,2>{0.351899117f, 0.851913512f},
-std::array<float,2>{0.607214212f, 0.158166349f},
-std::array<float,2>{0.23676616f, 0.389157772f},
-std::array<float,2>{0.982778549f, 0.649205863f},
-std::array<float,2>{0.164888084f, 0.787708521f},
-std::array<float,2>{0.897255659f, 0.232839704f},
-std::array<float,2>{0.306626439f, 0.445605218f},
-std::array<float,2>{0.51071775f, 0.738251448f},
-std::array<float,2>{0.407180786f, 0.510650873f},
-std::array<float,2>{0.691227138f, 0.302492678f},
-std::array<float,2>{0.120391794f, 0.0823620558f},
-std::array<float,2>{0.815804303f, 0.945074201f},
-std::array<float,2>{0.056212794f, 0.644076765f},
-std::array<float,2>{0.791304171f, 0.377582312f},
-std::array<float,2>{0.480022401f, 0.17063503f},
-std::array<float,2>{0.638431191f, 0.846628189f},
-std::array<float,2>{0.326731086f, 0.899593294f},
-std::array<float,2>{0.590595365f, 0.0537277386f},
-std::array<float,2>{0.216456056f, 0.372736841f},
-std::array<float,2>{0.953316867f, 0.573444128f},
-std::array<float,2>{0.0834823921f, 0.973346829f},
-std::array<float,2>{0.847493052f, 0.0941182002f},
-std::array<float,2>{0.377562732f, 0.26860401f},
-std::array<float,2>{0.727114439f, 0.556584597f},
-std::array<float,2>{0.275047243f, 0.712970674f},
-std::array<float,2>{0.53136766f, 0.475347996f},
-std::array<float,2>{0.148138359f, 0.216381982f},
-std::array<float,2>{0.93704319f, 0.751740813f},
-std::array<float,2>{0.244031474f, 0.605046868f},
-std::array<float,2>{0.976530313f, 0.341562212f},
-std::array<float,2>{0.348047584f, 0.0242719743f},
-std::array<float,2>{0.600897133f, 0.914644778f},
-std::array<float,2>{0.442441583f, 0.825100243f},
-std::array<float,2>{0.659976065f, 0.127922043f},
-std::array<float,2>{0.00894621294f, 0.423741102f},
-std::array<float,2>{0.778091967f, 0.683822334f},
-std::array<float,2>{0.0178993307f, 0.867978871f},
-std::array<float,2>{0.754814267f, 0.179186553f},
-std::array<float,2>{0.461734384f, 0.392653674f},
-std::array<float,2>{0.677414298f, 0.631384194f},
-std::array<float,2>{0.364062935f, 0.583014667f},
-std::array<float,2>{0.619110703f, 0.352027029f},
-std::array<float,2>{0.224132329f, 0.0343796872f},
-std::array<float,2>{0.998922527f, 0.880010068f},
-std::array<float,2>{0.126447141f, 0.728121281f},
-std::array<float,2>{0.920147836f, 0.459780902f},
-std::array<float,2>{0.258452356f, 0.234904394f},
-std::array<float,2>{0.553387105f, 0.81035924f},
-std::array<float,2>{0.405929476f, 0.96335119f},
-std::array<float,2>{0.749093771f, 0.0698201656f},
-std::array<float,2>{0.065805763f, 0.293948948f},
-std::array<float,2>{0.86032778f, 0.51769042f},
-std::array<float,2>{0.193503544f, 0.933371603f},
-std::array<float,2>{0.943117917f, 0.000825731724f},
-std::array<float,2>{0.340280473f, 0.326011539f},
-std::array<float,2>{0.566287875f, 0.609396875f},
-std::array<float,2>{0.497617245f, 0.667673051f},
-std::array<float,2>{0.65114516f, 0.414684296f},
-std::array<float,2>{0.0326862745f, 0.144249082f},
-std::array<float,2>{0.81172967f, 0.834682584f},
-std::array<float,2>{0.106984749f, 0.544328809f},
-std::array<float,2>{0.831014812f, 0.250029981f},
-std::array<float,2>{0.424753726f, 0.11536818f},
-std::array<float,2>{0.706722617f, 0.997823656f},
-std::array<float,2>{0.281620771f, 0.776874185f},
-std::array<float,2>{0.52216661f, 0.19884631f},
-std::array<float,2>{0.17216821f, 0.491858363f},
-std::array<float,2>{0.889394283f, 0.689770639f},
-std::array<float,2>{0.184869647f, 0.823150158f},
-std::array<float,2>{0.879701614f, 0.131024539f},
-std::array<float,2>{0.290923864f, 0.426443577f},
-std::array<float,2>{0.531221509f, 0.682416677f},
-std::array<float,2>{0.436159015f, 0.60556221f},
-std::array<float,2>{0.712063193f, 0.339739025f},
-std::array<float,2>{0.0994565561f, 0.0283336546f},
-std::array<float,2>{0.839977264f, 0.919311643f},
-std::array<float,2>{0.0428294912f, 0.716190636f},
-std::array<float,2>{0.79857707f, 0.470995277f},
-std::array<float,2>{0.490002126f, 0.212140203f},
-std::array<float,2>{0.640973806f, 0.756706417f},
-std::array<float,2>{0.332928419f, 0.97100842f},
-std::array<float,2>{0.570460677f, 0.100401573f},
-std::array<float,2>{0.199555308f, 0.272131205f},
-std::array<float,2>{0.949039876f, 0.559294164f},
-std::array<float,2>{0.0775351226f, 0.902442515f},
-std::array<float,2>{0.87357688f, 0.0473237783f},
-std::array<float,2>{0.395857394f, 0.368272603f},
-std::array<float,2>{0.741393626f, 0.577389538f},
-std::array<float,2>{0.253290236f, 0.645719647f},
-std::array<float,2>{0.555368364f, 0.38211742f},
-std::array<float,2>{0.133843422f, 0.166098088f},
-std::array<float,2>{0.909619153f, 0.849625885f},
-std::array<float,2>{0.228545323f, 0.511772335f},
-std::array<float,2>{0.988569796f, 0.297559202f},
-std::array<float,2>{0.370912164f, 0.0801045522f},
-std::array<float,2>{0.613300622f, 0.93917799f},
-std::array<float,2>{0.458751112f, 0.784236789f},
-std::array<float,2>{0.682640612f, 0.226901546f},
-std::array<float,2>{0.0288637578f, 0.450154871f},
-std::array<float,2>{0.760930777f, 0.739441514f},
-std::array<float,2>{0.00351329078f, 0.780157626f},
-std::array<float,2>{0.765817225f, 0.202790886f},
-std::array<float,2>{0.452779472f, 0.484456092f},
-std::array<float,2>{0.670170605f, 0.694901466f},
-std::array<float,2>{0.355640203f, 0.540200889f},
-std::array<float,2>{0.602365613f, 0.254267752f},
-std::array<float,2>{0.240498498f, 0.111828893f},
-std::array<float,2>{0.978876889f, 0.992703199f},
-std::array<float,2>{0.154578641f, 0.668677688f},
-std::array<float,2>{0.923654795f, 0.421151489f},
-std::array<float,2>{0.266872048f, 0.147138f},
-std::array<float,2>{0.543660641f, 0.829939008f},
-std::array<float,2>{0.38324362f, 0.937110364f},
-std::array<float,2>{0.721997499f, 0.00455049565f},
-std::array<float,2>{0.0875069797f, 0.320323437f},
-std::array<float,2>{0.852494001f, 0.616107762f},
-std::array<float,2>{0.210363284f, 0.966122091f},
-std::array<float,2>{0.967467785f, 0.0625025705f},
-std::array<float,2>{0.317456961f, 0.289179474f},
-std::array<float,2>{0.579643607f, 0.520442426f},
-std::array<float,2>{0.47292769f, 0.733130515f},
-std::array<float,2>{0.628764927f, 0.455129206f},
-std::array<float,2>{0.0518376194f, 0.239258125f},
-std::array<float,2>{0.783957839f, 0.805327713f},
-std::array<float,2>{0.113478318f, 0.580528796f},
-std::array<float,2>{0.82492739f, 0.358179152f},
-std::array<float,2>{0.421239316f, 0.0377172939f},
-std::array<float,2>{0.703005612f, 0.878903806f},
-std::array<float,2>{0.298824668f, 0.87399143f},
-std::array<float,2>{0.502109826f, 0.175302669f},
-std::array<float,2>{0.163743094f, 0.395737052f},
-std::array<float,2>{0.903413355f, 0.626231194f},
-std::array<float,2>{0.248155504f, 0.800251544f},
-std::array<float,2>{0.971371651f, 0.249721587f},
-std::array<float,2>{0.343827099f, 0.461636513f},
-std::array<float,2>{0.59650749f, 0.725689054f},
-std::array<float,2>{0.440860718f, 0.524590909f},
-std::array<float,2>{0.663579762f, 0.282282323f},
-std::array<float,2>{0.0145259006f, 0.0759337991f},
-std::array<float,2>{0.776184976f, 0.954477489f},
-std::array<float,2>{0.0792023763f, 0.639563084f},
-std::array<float,2>{0.849115193f, 0.404689401f},
-std::array<float,2>{0.380743414f, 0.182355121f},
-std::array<float,2>{0.730579495f, 0.864939272f},
-std::array<float,2>{0.281230479f, 0.887636006f},
-std::array<float,2>{0.538811445f, 0.0397621468f},
-std::array<float,2>{0.142787218f, 0.350660324f},
-std::array<float,2>{0.933205843f, 0.591190815f},
-std::array<float,2>{0.0617489368f, 0.988325f},
-std::array<float,2>{0.793277562f, 0.122457735f},
-std::array<float,2>{0.483655095f, 0.263862282f},
-std::array<float,2>{0.63667953f, 0.534202218f},
-std::array<float,2>{0.320373893f, 0.701125383f},
-std::array<float,2>{0.587768137f, 0.493524879f},
-std::array<float,2>{0.214457035f, 0.190380543f},
-std::array<float,2>{0.958916247f, 0.765873194f},
-std::array<float,2>{0.169229507f, 0.6248824f},
-std::array<float,2>{0.890984833f, 0.314099073f},
-std::array<float,2>{0.311449349f, 0.00979700405f},
-std::array<float,2>{0.514504731f, 0.926177263f},
-std::array<float,2>{0.413178504f, 0.837866724f},
-std::array<float,2>{0.691927552f, 0.15181756f},
-std::array<float,2>{0.122661695f, 0.41314885f},
-std::array<float,2>{0.820172489f, 0.660638869f},
-std::array<float,2>{0.104438238f, 0.857082784f},
-std::array<float,2>{0.83583945f, 0.161140934f},
-std::array<float,2>{0.428762972f, 0.384631723f},
-std::array<float,2>{0.710397899f, 0.656113148f},
-std::array<float,2>{0.287826002f, 0.56922847f},
-std::array<float,2>{0.518010736f, 0.362900525f},
-std::array<float,2>{0.178799048f, 0.0590264313f},
-std::array<float,2>{0.883632421f, 0.896759093f},
-std::array<float,2>{0.188248903f, 0.74448055f},
-std::array<float,2>{0.941376567f, 0.439062566f},
-std::array<float,2>{0.337917507f, 0.220398799f},
-std::array<float,2>{0.567522764f, 0.794163048f},
-std::array<float,2>{0.494925082f, 0.951956213f},
-std::array<float,2>{0.653826714f, 0.0930279419f},
-std::array<float,2>{0.0362277478f, 0.310363948f},
-std::array<float,2>{0.806807876f, 0.500994146f},
-std::array<float,2>{0.131471232f, 0.910649121f},
-std::array<float,2>{0.917277157f, 0.0213977471f},
-std::array<float,2>{0.263078481f, 0.335264355f},
-std::array<float,2>{0.550315797f, 0.595306098f},
-std::array<float,2>{0.40081811f, 0.676301241f},
-std::array<float,2>{0.743883848f, 0.436189145f},
-std::array<float,2>{0.0684410185f, 0.137748107f},
-std::array<float,2>{0.864901245f, 0.820295691f},
-std::array<float,2>{0.0230597388f, 0.549767911f},
-std::array<float,2>{0.752667248f, 0.274679452f},
-std::array<float,2>{0.468735605f, 0.108431995f},
-std::array<float,2>{0.672771573f, 0.983307838f},
-std::array<float,2>{0.35994491f, 0.765522301f},
-std::array<float,2>{0.623220146f, 0.209561482f},
-std::array<float,2>{0.220867023f, 0.481913f},
-std::array<float,2>{0.992496848f, 0.705658615f},
-std::array<float,2>{0.199028715f, 0.861424148f},
-std::array<float,2>{0.952609003f, 0.185379475f},
-std::array<float,2>{0.330508649f, 0.399793714f},
-std::array<float,2>{0.574544728f, 0.635225475f},
-std::array<float,2>{0.486192435f, 0.586250126f},
-std::array<float,2>{0.645388961f, 0.344334096f},
-std::array<float,2>{0.0460472703f, 0.0438719355f},
-std::array<float,2>{0.801760435f, 0.88608259f},
-std::array<float,2>{0.0940445438f, 0.719187737f},
-std::array<float,2>{0.837785184f, 0.466986686f},
-std::array<float,2>{0.432086676f, 0.242275685f},
-std::array<float,2>{0.716941714f, 0.804006398f},
-std::array<float,2>{0.29411608f, 0.960888863f},
-std::array<float,2>{0.526641369f, 0.071012035f},
-std::array<float,2>{0.181298122f, 0.286141008f},
-std::array<float,2>{0.875438571f, 0.529183149f},
-std::array<float,2>{0.0271550398f, 0.924455881f},
-std::array<float,2>{0.763709009f, 0.0117357103f},
-std::array<float,2>{0.454316735f, 0.318869621f},
-std::array<float,2>{0.687441289f, 0.618827164f},
-std::array<float,2>{0.372178525f, 0.656495214f},
-std::array<float,2>{0.610696197f, 0.409857303f},
-std::array<float,2>{0.233434439f, 0.15586035f},
-std::array<float,2>{0.988249779f, 0.843683541f},
-std::array<float,2>{0.140529349f, 0.535424709f},
-std::array<float,2>{0.912232757f, 0.259789526f},
-std::array<float,2>{0.255995482f, 0.120285936f},
-std::array<float,2>{0.559589446f, 0.986791551f},
-std::array<float,2>{0.393414587f, 0.773359179f},
-std::array<float,2>{0.734627128f, 0.193793714f},
-std::array<float,2>{0.0726886764f, 0.499844283f},
-std::array<float,2>{0.869544685f, 0.696648955f},
-std::array<float,2>{0.0930722952f, 0.792824864f},
-std::array<float,2>{0.857443869f, 0.222897872f},
-std::array<float,2>{0.38718468f, 0.443450123f},
-std::array<float,2>{0.722880602f, 0.749635816f},
-std::array<float,2>{0.272706062f, 0.505217254f},
-std::array<float,2>{0.541258872f, 0.306236476f},
-std::array<float,2>{0.151456371f, 0.0887257084f},
-std::array<float,2>{0.925873458f, 0.948545456f},
-std::array<float,2>{0.235740915f, 0.651049256f},
-std::array<float,2>{0.981933653f, 0.386780858f},
-std::array<float,2>{0.353607237f, 0.159566626f},
-std::array<float,2>{0.608168542f, 0.853981912f},
-std::array<float,2>{0.449001312f, 0.894491255f},
-std::array<float,2>{0.664298415f, 0.058530122f},
-std::array<float,2>{0.00688295159f, 0.363666177f},
-std::array<float,2>{0.771835744f, 0.562525094f},
-std::array<float,2>{0.158064902f, 0.978743672f},
-std::array<float,2>{0.900439799f, 0.101587571f},
-std::array<float,2>{0.304193109f, 0.27958262f},
-std::array<float,2>{0.50476402f, 0.551880836f},
-std::array<float,2>{0.41649735f, 0.70784843f},
-std::array<float,2>{0.697494388f, 0.477206618f},
-std::array<float,2>{0.113169461f, 0.205575779f},
-std::array<float,2>{0.820814431f, 0.760514975f},
-std::array<float,2>{0.0504820719f, 0.599488318f},
-std::array<float,2>{0.788081408f, 0.330606073f},
-std::array<float,2>{0.469444424f, 0.0190950502f},
-std::array<float,2>{0.632652998f, 0.909483194f},
-std::array<float,2>{0.312924176f, 0.814023554f},
-std::array<float,2>{0.585434318f, 0.133423761f},
-std::array<float,2>{0.205551267f, 0.433402926f},
-std::array<float,2>{0.962141395f, 0.672629595f},
-std::array<float,2>{0.145323455f, 0.753477514f},
-std::array<float,2>{0.934680223f, 0.218245283f},
-std::array<float,2>{0.276424587f, 0.473005801f},
-std::array<float,2>{0.534027994f, 0.712359369f},
-std::array<float,2>{0.375954509f, 0.557262957f},
-std::array<float,2>{0.729124963f, 0.266944081f},
-std::array<float,2>{0.0840765908f, 0.0969068334f},
-std::array<float,2>{0.844414234f, 0.976504683f},
-std::array<float,2>{0.0116147744f, 0.687113285f},
-std::array<float,2>{0.780819178f, 0.424037755f},
-std::array<float,2>{0.444659024f, 0.126175687f},
-std::array<float,2>{0.657755911f, 0.826554358f},
-std::array<float,2>{0.350058705f, 0.917025983f},
-std::array<float,2>{0.599110603f, 0.026402127f},
-std::array<float,2>{0.24463892f, 0.343140364f},
-std::array<float,2>{0.97371161f, 0.603356183f},
-std::array<float,2>{0.11823447f, 0.941408038f},
-std::array<float,2>{0.813565612f, 0.0843289942f},
-std::array<float,2>{0.408250421f, 0.303704143f},
-std::array<float,2>{0.687518954f, 0.508281469f},
-std::array<float,2>{0.306689143f, 0.735384822f},
-std::array<float,2>{0.508269966f, 0.447830856f},
-std::array<float,2>{0.166815266f, 0.231563523f},
-std::array<float,2>{0.895627618f, 0.785533488f},
-std::array<float,2>{0.21735768f, 0.57056874f},
-std::array<float,2>{0.956369281f, 0.37359497f},
-std::array<float,2>{0.325096458f, 0.0523273647f},
-std::array<float,2>{0.592194915f, 0.902036965f},
-std::array<float,2>{0.477438986f, 0.8437621f},
-std::array<float,2>{0.6401847f, 0.169523776f},
-std::array<float,2>{0.0570048466f, 0.375057042f},
-std::array<float,2>{0.789863348f, 0.64098388f},
-std::array<float,2>{0.034894608f, 0.833410084f},
-std::array<float,2>{0.809015334f, 0.141388282f},
-std::array<float,2>{0.498427004f, 0.417654455f},
-std::array<float,2>{0.650373459f, 0.664069533f},
-std::array<float,2>{0.343344152f, 0.612240016f},
-std::array<float,2>{0.562936246f, 0.326964229f},
-std::array<float,2>{0.191533953f, 0.00389848906f},
-std::array<float,2>{0.945197165f, 0.93042779f},
-std::array<float,2>{0.174031183f, 0.688392103f},
-std::array<float,2>{0.88787657f, 0.489002496f},
-std::array<float,2>{0.28382647f, 0.196887121f},
-std::array<float,2>{0.521444201f, 0.775098503f},
-std::array<float,2>{0.422503263f, 0.999203742f},
-std::array<float,2>{0.70395875f, 0.114258863f},
-std::array<float,2>{0.107914507f, 0.252201229f},
-std::array<float,2>{0.829277277f, 0.545485437f},
-std::array<float,2>{0.22565116f, 0.881601632f},
-std::array<float,2>{0.996442974f, 0.0317519829f},
-std::array<float,2>{0.365564495f, 0.353856087f},
-std::array<float,2>{0.620723069f, 0.584693849f},
-std::array<float,2>{0.464111418f, 0.63005513f},
-std::array<float,2>{0.678127646f, 0.392400771f},
-std::array<float,2>{0.0167659409f, 0.176068142f},
-std::array<float,2>{0.756944001f, 0.869515359f},
-std::array<float,2>{0.0627308339f, 0.515643537f},
-std::array<float,2>{0.861364663f, 0.296512306f},
-std::array<float,2>{0.403198868f, 0.067027919f},
-std::array<float,2>{0.747355402f, 0.961241722f},
-std::array<float,2>{0.260324538f, 0.812458158f},
-std::array<float,2>{0.552678227f, 0.237893507f},
-std::array<float,2>{0.127410322f, 0.457133442f},
-std::array<float,2>{0.919408798f, 0.729059815f},
-std::array<float,2>{0.153322041f, 0.828765869f},
-std::array<float,2>{0.924267948f, 0.147919416f},
-std::array<float,2>{0.268380553f, 0.420579612f},
-std::array<float,2>{0.546742916f, 0.669011354f},
-std::array<float,2>{0.385601193f, 0.617147565f},
-std::array<float,2>{0.720135689f, 0.32187134f},
-std::array<float,2>{0.0883418396f, 0.00508865016f},
-std::array<float,2>{0.854011059f, 0.936087012f},
-std::array<float,2>{0.00173156918f, 0.694043696f},
-std::array<float,2>{0.768910408f, 0.486045629f},
-std::array<float,2>{0.449892223f, 0.202066034f},
-std::array<float,2>{0.668922961f, 0.781101465f},
-std::array<float,2>{0.357769072f, 0.993605137f},
-std::array<float,2>{0.603702068f, 0.113221146f},
-std::array<float,2>{0.239130914f, 0.255048126f},
-std::array<float,2>{0.978041828f, 0.539350033f},
-std::array<float,2>{0.117018178f, 0.877329826f},
-std::array<float,2>{0.827969074f, 0.0382616371f},
-std::array<float,2>{0.418706447f, 0.358443081f},
-std::array<float,2>{0.700929761f, 0.58194983f},
-std::array<float,2>{0.299384713f, 0.625517249f},
-std::array<float,2>{0.500403881f, 0.394563586f},
-std::array<float,2>{0.161175951f, 0.174261436f},
-std::array<float,2>{0.905565739f, 0.874819875f},
-std::array<float,2>{0.208280385f, 0.521243274f},
-std::array<float,2>{0.966013134f, 0.290725857f},
-std::array<float,2>{0.319517761f, 0.0640055388f},
-std::array<float,2>{0.580422163f, 0.965296686f},
-std::array<float,2>{0.47549808f, 0.806267738f},
-std::array<float,2>{0.626260102f, 0.239139825f},
-std::array<float,2>{0.0538753457f, 0.456928462f},
-std::array<float,2>{0.781652451f, 0.734038055f},
-std::array<float,2>{0.0401470289f, 0.756953359f},
-std::array<float,2>{0.799781561f, 0.210992649f},
-std::array<float,2>{0.490596592f, 0.472620159f},
-std::array<float,2>{0.642611682f, 0.715107024f},
-std::array<float,2>{0.334303379f, 0.559815228f},
-std::array<float,2>{0.573322892f, 0.272763431f},
-std::array<float,2>{0.203118443f, 0.101540655f},
-std::array<float,2>{0.946565092f, 0.97255218f},
-std::array<float,2>{0.185915351f, 0.682958543f},
-std::array<float,2>{0.882274985f, 0.426834524f},
-std::array<float,2>{0.291766703f, 0.132718086f},
-std::array<float,2>{0.528853416f, 0.823835492f},
-std::array<float,2>{0.434486121f, 0.91822052f},
-std::array<float,2>{0.714179993f, 0.0281321928f},
-std::array<float,2>{0.100491986f, 0.33807385f},
-std::array<float,2>{0.842922807f, 0.606983542f},
-std::array<float,2>{0.227206662f, 0.937756479f},
-std::array<float,2>{0.990692616f, 0.0813643038f},
-std::array<float,2>{0.36781171f, 0.298497617f},
-std::array<float,2>{0.616664708f, 0.513625979f},
-std::array<float,2>{0.459809542f, 0.738603234f},
-std::array<float,2>{0.680719852f, 0.450870514f},
-std::array<float,2>{0.030660037f, 0.228172421f},
-std::array<float,2>{0.758638382f, 0.783587098f},
-std::array<float,2>{0.0761034191f, 0.577089846f},
-std::array<float,2>{0.872645855f, 0.367863595f},
-std::array<float,2>{0.397204965f, 0.0481400043f},
-std::array<float,2>{0.738616407f, 0.903498113f},
-std::array<float,2>{0.250839591f, 0.850878537f},
-std::array<float,2>{0.557659268f, 0.167627335f},
-std::array<float,2>{0.135931373f, 0.381801724f},
-std::array<float,2>{0.906502366f, 0.644772589f},
-std::array<float,2>{0.189811751f, 0.793463767f},
-std::array<float,2>{0.93864131f, 0.219426379f},
-std::array<float,2>{0.337752461f, 0.438122183f},
-std::array<float,2>{0.568770468f, 0.745155036f},
-std::array<float,2>{0.493788838f, 0.500797153f},
-std::array<float,2>{0.654967248f, 0.30937013f},
-std::array<float,2>{0.0386965089f, 0.0921367034f},
-std::array<float,2>{0.805828273f, 0.952152729f},
-std::array<float,2>{0.102367043f, 0.654497683f},
-std::array<float,2>{0.832036734f, 0.382886946f},
-std::array<float,2>{0.426124901f, 0.160981759f},
-std::array<float,2>{0.707526267f, 0.856312394f},
-std::array<float,2>{0.286951423f, 0.897880495f},
-std::array<float,2>{0.517537534f, 0.0599894933f},
-std::array<float,2>{0.177318111f, 0.362151593f},
-std::array<float,2>{0.88634634f, 0.569641113f},
-std::array<float,2>{0.0208733715f, 0.983401537f},
-std::array<float,2>{0.750279784f, 0.108356521f},
-std::array<float,2>{0.466674268f, 0.274018556f},
-std::array<float,2>{0.67546612f, 0.54988718f},
-std::array<float,2>{0.362584203f, 0.706371248f},
-std::array<float,2>{0.621804297f, 0.481102765f},
-std::array<float,2>{0.219844714f, 0.210448608f},
-std::array<float,2>{0.995242357f, 0.764448166f},
-std::array<float,2>{0.130096853f, 0.593838453f},
-std::array<float,2>{0.915521801f, 0.334490597f},
-std::array<float,2>{0.263987839f, 0.0202890541f},
-std::array<float,2>{0.547098577f, 0.911804438f},
-std::array<float,2>{0.399953127f, 0.819019079f},
-std::array<float,2>{0.745682716f, 0.137416527f},
-std::array<float,2>{0.0674401745f, 0.437365979f},
-std::array<float,2>{0.865785062f, 0.676824629f},
-std::array<float,2>{0.0818235874f, 0.86344862f},
-std::array<float,2>{0.849698901f, 0.182798982f},
-std::array<float,2>{0.382025242f, 0.406223446f},
-std::array<float,2>{0.73323828f, 0.639925301f},
-std::array<float,2>{0.279102087f, 0.590189099f},
-std::array<float,2>{0.53582114f, 0.350127101f},
-std::array<float,2>{0.14104946f, 0.0409200564f},
-std::array<float,2>{0.931427062f, 0.887888134f},
-std::array<float,2>{0.246516839f, 0.724787354f},
-std::array<float,2>{0.968946099f, 0.462802202f},
-std::array<float,2>{0.34754476f, 0.248337433f},
-std::array<float,2>{0.594796896f, 0.799322963f},
-std::array<float,2>{0.439295948f, 0.953690112f},
-std::array<float,2>{0.660976171f, 0.074585326f},
-std::array<float,2>{0.0123354141f, 0.281873375f},
-std::array<float,2>{0.773642778f, 0.523764729f},
-std::array<float,2>{0.170630276f, 0.926955223f},
-std::array<float,2>{0.893346071f, 0.0111383433f},
-std::array<float,2>{0.31024003f, 0.313263148f},
-std::array<float,2>{0.513177454f, 0.623506188f},
-std::array<float,2>{0.411008954f, 0.661638677f},
-std::array<float,2>{0.694580495f, 0.412580043f},
-std::array<float,2>{0.1231502f, 0.150941938f},
-std::array<float,2>{0.816832602f, 0.836164773f},
-std::array<float,2>{0.0590624809f, 0.533501208f},
-std::array<float,2>{0.796474874f, 0.264824003f},
-std::array<float,2>{0.480538398f, 0.121940404f},
-std::array<float,2>{0.63311702f, 0.989369273f},
-std::array<float,2>{0.322598606f, 0.766955733f},
-std::array<float,2>{0.589769483f, 0.19137232f},
-std::array<float,2>{0.211064264f, 0.492528051f},
-std::array<float,2>{0.959490001f, 0.699242294f},
-std::array<float,2>{0.237550393f, 0.85492754f},
-std::array<float,2>{0.983662665f, 0.158441603f},
-std::array<float,2>{0.352634668f, 0.388655335f},
-std::array<float,2>{0.606252253f, 0.652006865f},
-std::array<float,2>{0.446152359f, 0.563663125f},
-std::array<float,2>{0.667461157f, 0.364867896f},
-std::array<float,2>{0.00579304388f, 0.0575737432f},
-std::array<float,2>{0.770825207f, 0.892828584f},
-std::array<float,2>{0.0898826793f, 0.748687685f},
-std::array<float,2>{0.8555125f, 0.444391757f},
-std::array<float,2>{0.389710784f, 0.22388351f},
-std::array<float,2>{0.724713802f, 0.791950285f},
-std::array<float,2>{0.269933462f, 0.947859406f},
-std::array<float,2>{0.540303469f, 0.0888780281f},
-std::array<float,2>{0.149916828f, 0.305456191f},
-std::array<float,2>{0.927880347f, 0.504083753f},
-std::array<float,2>{0.0470380448f, 0.908716619f},
-std::array<float,2>{0.786308885f, 0.0178032294f},
-std::array<float,2>{0.472615033f, 0.331527889f},
-std::array<float,2>{0.629999101f, 0.598300278f},
-std::array<float,2>{0.315410286f, 0.67364949f},
-std::array<float,2>{0.582898259f, 0.431825399f},
-std::array<float,2>{0.204480305f, 0.134497955f},
-std::array<float,2>{0.963916123f, 0.812731862f},
-std::array<float,2>{0.159479231f, 0.551576912f},
-std::array<float,2>{0.898465455f, 0.281222075f},
-std::array<float,2>{0.302248567f, 0.102630153f},
-std::array<float,2>{0.505980968f, 0.980020702f},
-std::array<float,2>{0.414507389f, 0.76100266f},
-std::array<float,2>{0.695640028f, 0.206626892f},
-std::array<float,2>{0.110118359f, 0.478443414f},
-std::array<float,2>{0.822630763f, 0.708399117f},
-std::array<float,2>{0.0972923115f, 0.803402305f},
-std::array<float,2>{0.838899374f, 0.243780464f},
-std::array<float,2>{0.429910392f, 0.468178213f},
-std::array<float,2>{0.716677785f, 0.72001332f},
-std::array<float,2>{0.296860963f, 0.528167784f},
-std::array<float,2>{0.52433306f, 0.285975724f},
-std::array<float,2>{0.183449343f, 0.0714953393f},
-std::array<float,2>{0.877618015f, 0.959588408f},
-std::array<float,2>{0.196389169f, 0.636163056f},
-std::array<float,2>{0.949923277f, 0.398638129f},
-std::array<float,2>{0.328902155f, 0.183634907f},
-std::array<float,2>{0.577020824f, 0.863260567f},
-std::array<float,2>{0.487800658f, 0.885205626f},
-std::array<float,2>{0.6468032f, 0.0440826416f},
-std::array<float,2>{0.0446883999f, 0.345315844f},
-std::array<float,2>{0.802892447f, 0.587083459f},
-std::array<float,2>{0.137700766f, 0.987575471f},
-std::array<float,2>{0.911868632f, 0.119979292f},
-std::array<float,2>{0.255070359f, 0.261577666f},
-std::array<float,2>{0.560588539f, 0.536854744f},
-std::array<float,2>{0.391341925f, 0.695716083f},
-std::array<float,2>{0.737312496f, 0.498741955f},
-std::array<float,2>{0.0707192123f, 0.19485046f},
-std::array<float,2>{0.868492424f, 0.771714628f},
-std::array<float,2>{0.0238042306f, 0.617463887f},
-std::array<float,2>{0.762439847f, 0.319974154f},
-std::array<float,2>{0.456692606f, 0.0131553011f},
-std::array<float,2>{0.68370527f, 0.925147653f},
-std::array<float,2>{0.374391019f, 0.842327476f},
-std::array<float,2>{0.611739159f, 0.155055627f},
-std::array<float,2>{0.231642038f, 0.40865466f},
-std::array<float,2>{0.985274911f, 0.657913566f},
-std::array<float,2>{0.172922343f, 0.773830414f},
-std::array<float,2>{0.890517414f, 0.196009785f},
-std::array<float,2>{0.283168674f, 0.489684492f},
-std::array<float,2>{0.52303499f, 0.688667655f},
-std::array<float,2>{0.425041229f, 0.546639085f},
-std::array<float,2>{0.705139041f, 0.253310382f},
-std::array<float,2>{0.105712704f, 0.113472231f},
-std::array<float,2>{0.831127465f, 0.998161256f},
-std::array<float,2>{0.0313716792f, 0.665978611f},
-std::array<float,2>{0.810658336f, 0.416018456f},
-std::array<float,2>{0.496234417f, 0.142206728f},
-std::array<float,2>{0.652301669f, 0.833004296f},
-std::array<float,2>{0.341123611f, 0.93156755f},
-std::array<float,2>{0.56539011f, 0.00213775388f},
-std::array<float,2>{0.194636852f, 0.327332318f},
-std::array<float,2>{0.94146812f, 0.612888277f},
-std::array<float,2>{0.0650629848f, 0.96222192f},
-std::array<float,2>{0.860391855f, 0.068224974f},
-std::array<float,2>{0.404620349f, 0.295368522f},
-std::array<float,2>{0.748886108f, 0.516859293f},
-std::array<float,2>{0.259517908f, 0.729704618f},
-std::array<float,2>{0.554137528f, 0.45876953f},
-std::array<float,2>{0.125868633f, 0.23708576f},
-std::array<float,2>{0.921509326f, 0.810722053f},
-std::array<float,2>{0.222820818f, 0.585284412f},
-std::array<float,2>{0.999397337f, 0.354744345f},
-std::array<float,2>{0.365017146f, 0.0331154466f},
-std::array<float,2>{0.617806613f, 0.882637978f},
-std::array<float,2>{0.462838978f, 0.870337605f},
-std::array<float,2>{0.676293314f, 0.177220017f},
-std::array<float,2>{0.0190873258f, 0.391065419f},
-std::array<float,2>{0.755729556f, 0.62969023f},
-std::array<float,2>{0.00791701209f, 0.827690303f},
-std::array<float,2>{0.778564095f, 0.125143528f},
-std::array<float,2>{0.441916257f, 0.424830377f},
-std::array<float,2>{0.658434033f, 0.686427772f},
-std::array<float,2>{0.349224299f, 0.602187276f},
-std::array<float,2>{0.600070596f, 0.342143655f},
-std::array<float,2>{0.242524311f, 0.0255260672f},
-std::array<float,2>{0.975170434f, 0.916914225f},
-std::array<float,2>{0.146771714f, 0.710945129f},
-std::array<float,2>{0.935766518f, 0.474435836f},
-std::array<float,2>{0.273960412f, 0.217462182f},
-std::array<float,2>{0.532884419f, 0.752915442f},
-std::array<float,2>{0.378840089f, 0.975150645f},
-std::array<float,2>{0.72837007f, 0.0958358794f},
-std::array<float,2>{0.0822345614f, 0.265704632f},
-std::array<float,2>{0.845949411f, 0.558346808f},
-std::array<float,2>{0.215620175f, 0.900642693f},
-std::array<float,2>{0.954682529f, 0.0514312945f},
-std::array<float,2>{0.327915847f, 0.374582022f},
-std::array<float,2>{0.590888441f, 0.572248936f},
-std::array<float,2>{0.479174048f, 0.642354071f},
-std::array<float,2>{0.637430727f, 0.376263708f},
-std::array<float,2>{0.055318404f, 0.168488473f},
-std::array<float,2>{0.792954206f, 0.845527053f},
-std::array<float,2>{0.119312324f, 0.509203732f},
-std::array<float,2>{0.815042675f, 0.304367006f},
-std::array<float,2>{0.407427251f, 0.0852707028f},
-std::array<float,2>{0.689525962f, 0.942424119f},
-std::array<float,2>{0.305430561f, 0.786591351f},
-std::array<float,2>{0.510838568f, 0.230624557f},
-std::array<float,2>{0.165125772f, 0.449032217f},
-std::array<float,2>{0.897910297f, 0.734807611f},
-std::array<float,2>{0.162378013f, 0.871250451f},
-std::array<float,2>{0.90279156f, 0.172278598f},
-std::array<float,2>{0.297254443f, 0.397376835f},
-std::array<float,2>{0.503556788f, 0.628336728f},
-std::array<float,2>{0.420195967f, 0.578204632f},
-std::array<float,2>{0.701804757f, 0.357272297f},
-std::array<float,2>{0.114464924f, 0.0366570763f},
-std::array<float,2>{0.82608366f, 0.87570864f},
-std::array<float,2>{0.0510121249f, 0.731400967f},
-std::array<float,2>{0.784221113f, 0.453783929f},
-std::array<float,2>{0.473940939f, 0.24099201f},
-std::array<float,2>{0.627576172f, 0.807453156f},
-std::array<float,2>{0.317341864f, 0.968562186f},
-std::array<float,2>{0.579015493f, 0.0657371804f},
-std::array<float,2>{0.209697872f, 0.291468203f},
-std::array<float,2>{0.967951715f, 0.52331388f},
-std::array<float,2>{0.0866785496f, 0.934532642f},
-std::array<float,2>{0.853086233f, 0.00737668108f},
-std::array<float,2>{0.384763926f, 0.322708696f},
-std::array<float,2>{0.721605122f, 0.614765108f},
-std::array<float,2>{0.266281098f, 0.670476019f},
-std::array<float,2>{0.544283867f, 0.418233216f},
-std::array<float,2>{0.156086221f, 0.145699322f},
-std::array<float,2>{0.922012806f, 0.831295073f},
-std::array<float,2>{0.241752997f, 0.541524112f},
-std::array<float,2>{0.980039895f, 0.257216483f},
-std::array<float,2>{0.357107192f, 0.110486157f},
-std::array<float,2>{0.60328126f, 0.994987369f},
-std::array<float,2>{0.451195478f, 0.778157532f},
-std::array<float,2>{0.671720624f, 0.201111093f},
-std::array<float,2>{0.00221085479f, 0.487439573f},
-std::array<float,2>{0.767233312f, 0.691994667f},
-std::array<float,2>{0.0274423826f, 0.782087624f},
-std::array<float,2>{0.760579228f, 0.229305267f},
-std::array<float,2>{0.457474589f, 0.451476157f},
-std::array<float,2>{0.682482421f, 0.740495503f},
-std::array<float,2>{0.370112687f, 0.515115142f},
-std::array<float,2>{0.614763737f, 0.299913079f},
-std::array<float,2>{0.229535714f, 0.0784677416f},
-std::array<float,2>{0.99023056f, 0.941095233f},
-std::array<float,2>{0.133170933f, 0.648223996f},
-std::array<float,2>{0.908603132f, 0.379502892f},
-std::array<float,2>{0.252728492f, 0.164149508f},
-std::array<float,2>{0.555903137f, 0.847705066f},
-std::array<float,2>{0.394861132f, 0.905187011f},
-std::array<float,2>{0.740326107f, 0.0499969944f},
-std::array<float,2>{0.0764525533f, 0.369634122f},
-std::array<float,2>{0.874550223f, 0.57455945f},
-std::array<float,2>{0.200514585f, 0.969998896f},
-std::array<float,2>{0.947331369f, 0.0985166579f},
-std::array<float,2>{0.333644271f, 0.27135095f},
-std::array<float,2>{0.5716272f, 0.562137604f},
-std::array<float,2>{0.489174038f, 0.716891825f},
-std::array<float,2>{0.642404795f, 0.46913445f},
-std::array<float,2>{0.0412698202f, 0.213754028f},
-std::array<float,2>{0.79709965f, 0.753961384f},
-std::array<float,2>{0.0978981629f, 0.609158278f},
-std::array<float,2>{0.841113448f, 0.336687952f},
-std::array<float,2>{0.43718186f, 0.0299849585f},
-std::array<float,2>{0.711696208f, 0.920604467f},
-std::array<float,2>{0.289150476f, 0.82102412f},
-std::array<float,2>{0.530011654f, 0.130663142f},
-std::array<float,2>{0.184138164f, 0.428312421f},
-std::array<float,2>{0.880088747f, 0.680352569f},
-std::array<float,2>{0.222391203f, 0.762141645f},
-std::array<float,2>{0.993591368f, 0.208265945f},
-std::array<float,2>{0.360743999f, 0.483519912f},
-std::array<float,2>{0.624691248f, 0.704618037f},
-std::array<float,2>{0.467334986f, 0.548567176f},
-std::array<float,2>{0.672868192f, 0.275998682f},
-std::array<float,2>{0.0215445459f, 0.106153026f},
-std::array<float,2>{0.753188133f, 0.981664598f},
-std::array<float,2>{0.0694456324f, 0.677854419f},
-std::array<float,2>{0.863491118f, 0.435334563f},
-std::array<float,2>{0.402342945f, 0.139285564f},
-std::array<float,2>{0.743157566f, 0.817931831f},
-std::array<float,2>{0.262552887f, 0.912964582f},
-std::array<float,2>{0.549594104f, 0.0216635093f},
-std::array<float,2>{0.132791713f, 0.333358288f},
-std::array<float,2>{0.91698426f, 0.596087515f},
-std::array<float,2>{0.0360910445f, 0.94965148f},
-std::array<float,2>{0.808485746f, 0.0904928744f},
-std::array<float,2>{0.495651156f, 0.312255681f},
-std::array<float,2>{0.652515292f, 0.50223726f},
-std::array<float,2>{0.339088231f, 0.742188871f},
-std::array<float,2>{0.567375958f, 0.440109611f},
-std::array<float,2>{0.188539356f, 0.222043559f},
-std::array<float,2>{0.940003335f, 0.795822382f},
-std::array<float,2>{0.178671479f, 0.567579627f},
-std::array<float,2>{0.884707868f, 0.360817224f},
-std::array<float,2>{0.288987428f, 0.0623681806f},
-std::array<float,2>{0.518812776f, 0.896292448f},
-std::array<float,2>{0.428576857f, 0.858987391f},
-std::array<float,2>{0.709255159f, 0.163771182f},
-std::array<float,2>{0.105445541f, 0.385816604f},
-std::array<float,2>{0.834710002f, 0.65417248f},
-std::array<float,2>{0.121261358f, 0.839527726f},
-std::array<float,2>{0.819025338f, 0.149506047f},
-std::array<float,2>{0.412572175f, 0.410910279f},
-std::array<float,2>{0.69316566f, 0.663750052f},
-std::array<float,2>{0.312480658f, 0.62298578f},
-std::array<float,2>{0.515588105f, 0.315825939f},
-std::array<float,2>{0.168288991f, 0.00827758107f},
-std::array<float,2>{0.892111957f, 0.929116666f},
-std::array<float,2>{0.213036239f, 0.702067375f},
-std::array<float,2>{0.957276523f, 0.496011168f},
-std::array<float,2>{0.322012633f, 0.188757598f},
-std::array<float,2>{0.58659488f, 0.767933667f},
-std::array<float,2>{0.483126789f, 0.990772724f},
-std::array<float,2>{0.635612786f, 0.123805732f},
-std::array<float,2>{0.0607297122f, 0.262176991f},
-std::array<float,2>{0.79446733f, 0.531866491f},
-std::array<float,2>{0.143643573f, 0.890233159f},
-std::array<float,2>{0.932443917f, 0.0416024029f},
-std::array<float,2>{0.279458404f, 0.348168761f},
-std::array<float,2>{0.537831783f, 0.592027783f},
-std::array<float,2>{0.379011363f, 0.638210237f},
-std::array<float,2>{0.731645107f, 0.402652442f},
-std::array<float,2>{0.0782519504f, 0.181264639f},
-std::array<float,2>{0.847958744f, 0.865825057f},
-std::array<float,2>{0.0154184802f, 0.525603354f},
-std::array<float,2>{0.776396692f, 0.283274502f},
-std::array<float,2>{0.440245628f, 0.0777532011f},
-std::array<float,2>{0.662731409f, 0.956423283f},
-std::array<float,2>{0.345404774f, 0.798537076f},
-std::array<float,2>{0.59724617f, 0.247065187f},
-std::array<float,2>{0.249633804f, 0.46317485f},
-std::array<float,2>{0.972504199f, 0.724434793f},
-std::array<float,2>{0.206772968f, 0.815983534f},
-std::array<float,2>{0.961163163f, 0.136289731f},
-std::array<float,2>{0.314328343f, 0.430341452f},
-std::array<float,2>{0.584173083f, 0.675718248f},
-std::array<float,2>{0.469795495f, 0.6013183f},
-std::array<float,2>{0.631527543f, 0.329622716f},
-std::array<float,2>{0.0496856235f, 0.0168180801f},
-std::array<float,2>{0.788630724f, 0.90817076f},
-std::array<float,2>{0.111498848f, 0.709504008f},
-std::array<float,2>{0.821877241f, 0.478660166f},
-std::array<float,2>{0.417637378f, 0.20351094f},
-std::array<float,2>{0.698507667f, 0.758861721f},
-std::array<float,2>{0.303435117f, 0.978064835f},
-std::array<float,2>{0.505721629f, 0.10387364f},
-std::array<float,2>{0.156359211f, 0.278504729f},
-std::array<float,2>{0.902148604f, 0.5537799f},
-std::array<float,2>{0.00654933881f, 0.891747296f},
-std::array<float,2>{0.77278471f, 0.0564932153f},
-std::array<float,2>{0.447781324f, 0.36686179f},
-std::array<float,2>{0.665136755f, 0.564537823f},
-std::array<float,2>{0.354572386f, 0.649511814f},
-std::array<float,2>{0.60920769f, 0.390093654f},
-std::array<float,2>{0.234946877f, 0.15648593f},
-std::array<float,2>{0.981118798f, 0.852574348f},
-std::array<float,2>{0.150935456f, 0.505988598f},
-std::array<float,2>{0.926998854f, 0.308184117f},
-std::array<float,2>{0.271771759f, 0.0871040672f},
-std::array<float,2>{0.542752147f, 0.945860565f},
-std::array<float,2>{0.388332635f, 0.790482998f},
-std::array<float,2>{0.723824799f, 0.225262359f},
-std::array<float,2>{0.0925942063f, 0.442704469f},
-std::array<float,2>{0.858877838f, 0.74719125f},
-std::array<float,2>{0.0738455504f, 0.771022141f},
-std::array<float,2>{0.870852411f, 0.193311438f},
-std::array<float,2>{0.394044876f, 0.497267276f},
-std::array<float,2>{0.735533714f, 0.698321342f},
-std::array<float,2>{0.257346362f, 0.538576782f},
-std::array<float,2>{0.558696985f, 0.258583546f},
-std::array<float,2>{0.138966277f, 0.118684985f},
-std::array<float,2>{0.913237393f, 0.986038744f},
-std::array<float,2>{0.232553437f, 0.658385098f},
-std::array<float,2>{0.987174153f, 0.407314092f},
-std::array<float,2>{0.371293545f, 0.152608156f},
-std::array<float,2>{0.609837592f, 0.84108448f},
-std::array<float,2>{0.453340471f, 0.923742592f},
-std::array<float,2>{0.686203361f, 0.0139214229f},
-std::array<float,2>{0.0260324813f, 0.316811562f},
-std::array<float,2>{0.764912486f, 0.620568693f},
-std::array<float,2>{0.180523589f, 0.957689047f},
-std::array<float,2>{0.876004696f, 0.0736714154f},
-std::array<float,2>{0.293530852f, 0.287581325f},
-std::array<float,2>{0.52562958f, 0.530267775f},
-std::array<float,2>{0.433270663f, 0.722193539f},
-std::array<float,2>{0.718532443f, 0.465698749f},
-std::array<float,2>{0.0952706784f, 0.245462567f},
-std::array<float,2>{0.836167216f, 0.802566946f},
-std::array<float,2>{0.0458702482f, 0.588013411f},
-std::array<float,2>{0.800903082f, 0.345919907f},
-std::array<float,2>{0.484829366f, 0.0457049981f},
-std::array<float,2>{0.645958304f, 0.883276224f},
-std::array<float,2>{0.331798226f, 0.860107958f},
-std::array<float,2>{0.57562989f, 0.186664715f},
-std::array<float,2>{0.197320566f, 0.402023405f},
-std::array<float,2>{0.95117259f, 0.633533299f},
-std::array<float,2>{0.128357485f, 0.809142709f},
-std::array<float,2>{0.918898523f, 0.236279428f},
-std::array<float,2>{0.261173427f, 0.460792005f},
-std::array<float,2>{0.550924122f, 0.727263391f},
-std::array<float,2>{0.403588533f, 0.519229531f},
-std::array<float,2>{0.746704221f, 0.293044895f},
-std::array<float,2>{0.0641834736f, 0.0690472201f},
-std::array<float,2>{0.86241883f, 0.963963926f},
-std::array<float,2>{0.0158295967f, 0.632804394f},
-std::array<float,2>{0.756672025f, 0.394450128f},
-std::array<float,2>{0.463475257f, 0.178653032f},
-std::array<float,2>{0.679358542f, 0.868206263f},
-std::array<float,2>{0.366291493f, 0.8797791f},
-std::array<float,2>{0.619841993f, 0.0341167711f},
-std::array<float,2>{0.225430369f, 0.352805853f},
-std::array<float,2>{0.997856855f, 0.582481563f},
-std::array<float,2>{0.10928864f, 0.996969402f},
-std::array<float,2>{0.828937769f, 0.116505511f},
-std::array<float,2>{0.423317045f, 0.251273811f},
-std::array<float,2>{0.704958916f, 0.543941438f},
-std::array<float,2>{0.284833938f, 0.690998554f},
-std::array<float,2>{0.520397663f, 0.490424424f},
-std::array<float,2>{0.175274149f, 0.198148921f},
-std::array<float,2>{0.887295306f, 0.77571851f},
-std::array<float,2>{0.192655951f, 0.610804439f},
-std::array<float,2>{0.94411391f, 0.325075626f},
-std::array<float,2>{0.342105925f, 0.00131559302f},
-std::array<float,2>{0.56387502f, 0.93239367f},
-std::array<float,2>{0.499722689f, 0.835352719f},
-std::array<float,2>{0.648669839f, 0.143471763f},
-std::array<float,2>{0.0338545553f, 0.415407211f},
-std::array<float,2>{0.810349703f, 0.66642189f},
-std::array<float,2>{0.0583765209f, 0.847289145f},
-std::array<float,2>{0.790085018f, 0.171279609f},
-std::array<float,2>{0.477561504f, 0.378340662f},
-std::array<float,2>{0.638866186f, 0.642595828f},
-std::array<float,2>{0.326061308f, 0.572872281f},
-std::array<float,2>{0.593148887f, 0.37166065f},
-std::array<float,2>{0.21796295f, 0.0536327921f},
-std::array<float,2>{0.955860734f, 0.899046779f},
-std::array<float,2>{0.167630419f, 0.736391187f},
-std::array<float,2>{0.894547522f, 0.446992904f},
-std::array<float,2>{0.308391452f, 0.233833641f},
-std::array<float,2>{0.508972108f, 0.789013386f},
-std::array<float,2>{0.410115331f, 0.943651736f},
-std::array<float,2>{0.689208508f, 0.0836211443f},
-std::array<float,2>{0.117511675f, 0.301662534f},
-std::array<float,2>{0.812599599f, 0.511619806f},
-std::array<float,2>{0.245740622f, 0.915490389f},
-std::array<float,2>{0.972757995f, 0.0248735026f},
-std::array<float,2>{0.350997657f, 0.339983374f},
-std::array<float,2>{0.59771663f, 0.603745461f},
-std::array<float,2>{0.443426669f, 0.685213685f},
-std::array<float,2>{0.656777501f, 0.422557771f},
-std::array<float,2>{0.0106084347f, 0.128843442f},
-std::array<float,2>{0.779480875f, 0.825546622f},
-std::array<float,2>{0.0857757553f, 0.555005491f},
-std::array<float,2>{0.845584989f, 0.268491119f},
-std::array<float,2>{0.376044691f, 0.0952839777f},
-std::array<float,2>{0.729758084f, 0.974339485f},
-std::array<float,2>{0.276159644f, 0.750659347f},
-std::array<float,2>{0.534421742f, 0.215299711f},
-std::array<float,2>{0.146214917f, 0.476023406f},
-std::array<float,2>{0.934345901f, 0.714500129f},
-std::array<float,2>{0.141560286f, 0.865239084f},
-std::array<float,2>{0.930668771f, 0.180964649f},
-std::array<float,2>{0.278654456f, 0.403215468f},
-std::array<float,2>{0.535500705f, 0.637984455f},
-std::array<float,2>{0.382336706f, 0.592434466f},
-std::array<float,2>{0.732680738f, 0.347729206f},
-std::array<float,2>{0.0814913437f, 0.0411700718f},
-std::array<float,2>{0.850383282f, 0.88987869f},
-std::array<float,2>{0.0119487429f, 0.723896384f},
-std::array<float,2>{0.774028659f, 0.463515759f},
-std::array<float,2>{0.438611388f, 0.246241748f},
-std::array<float,2>{0.660599232f, 0.797986209f},
-std::array<float,2>{0.346896142f, 0.956643045f},
-std::array<float,2>{0.59566772f, 0.0773606673f},
-std::array<float,2>{0.246801078f, 0.283834934f},
-std::array<float,2>{0.969648242f, 0.526346087f},
-std::array<float,2>{0.12399286f, 0.929427028f},
-std::array<float,2>{0.817026794f, 0.00860898569f},
-std::array<float,2>{0.410435259f, 0.316067874f},
-std::array<float,2>{0.695251048f, 0.622331202f},
-std::array<float,2>{0.309960276f, 0.663434446f},
-std::array<float,2>{0.5132792f, 0.410341144f},
-std::array<float,2>{0.16995582f, 0.150036231f},
-std::array<float,2>{0.892971754f, 0.83899188f},
-std::array<float,2>{0.211906284f, 0.531562746f},
-std::array<float,2>{0.95913291f, 0.262394547f},
-std::array<float,2>{0.32276684f, 0.123097189f},
-std::array<float,2>{0.588937879f, 0.99038583f},
-std::array<float,2>{0.481420189f, 0.768360019f},
-std::array<float,2>{0.633768141f, 0.189348266f},
-std::array<float,2>{0.0594644397f, 0.495394498f},
-std::array<float,2>{0.796118855f, 0.701540053f},
-std::array<float,2>{0.0381999947f, 0.794961154f},
-std::array<float,2>{0.806597888f, 0.222284794f},
-std::array<float,2>{0.493615597f, 0.439776123f},
-std::array<float,2>{0.654764295f, 0.742729068f},
-std::array<float,2>{0.337381423f, 0.502914786f},
-std::array<float,2>{0.568875015f, 0.311994135f},
-std::array<float,2>{0.190159664f, 0.0901965722f},
-std::array<float,2>{0.939326108f, 0.949918449f},
-std::array<float,2>{0.177004501f, 0.653532803f},
-std::array<float,2>{0.885975838f, 0.386379987f},
-std::array<float,2>{0.286135823f, 0.16322808f},
-std::array<float,2>{0.517032564f, 0.858726442f},
-std::array<float,2>{0.426293463f, 0.895517051f},
-std::array<float,2>{0.707366228f, 0.0615952052f},
-std::array<float,2>{0.102019042f, 0.361157238f},
-std::array<float,2>{0.832568884f, 0.567887306f},
-std::array<float,2>{0.220515743f, 0.982077122f},
-std::array<float,2>{0.995686412f, 0.105610661f},
-std::array<float,2>{0.362836957f, 0.275650918f},
-std::array<float,2>{0.621097744f, 0.548177719f},
-std::array<float,2>{0.466232598f, 0.704330325f},
-std::array<float,2>{0.674837589f, 0.483947247f},
-std::array<float,2>{0.0210843999f, 0.208719313f},
-std::array<float,2>{0.75067246f, 0.762475908f},
-std::array<float,2>{0.068127498f, 0.596634686f},
-std::array<float,2>{0.865680575f, 0.33386904f},
-std::array<float,2>{0.399793118f, 0.0223071687f},
-std::array<float,2>{0.745143175f, 0.912255764f},
-std::array<float,2>{0.26426208f, 0.817430198f},
-std::array<float,2>{0.547735035f, 0.138971359f},
-std::array<float,2>{0.130405799f, 0.434573352f},
-std::array<float,2>{0.915705085f, 0.678617775f},
-std::array<float,2>{0.202387527f, 0.754424334f},
-std::array<float,2>{0.947160125f, 0.21318762f},
-std::array<float,2>{0.334574968f, 0.469390452f},
-std::array<float,2>{0.573952436f, 0.717588305f},
-std::array<float,2>{0.491155654f, 0.561771631f},
-std::array<float,2>{0.643152177f, 0.270939142f},
-std::array<float,2>{0.0407588743f, 0.0978507698f},
-std::array<float,2>{0.799259841f, 0.970282733f},
-std::array<float,2>{0.100043982f, 0.679825902f},
-std::array<float,2>{0.843549073f, 0.427888632f},
-std::array<float,2>{0.433964074f, 0.130052716f},
-std::array<float,2>{0.714622676f, 0.820400715f},
-std::array<float,2>{0.291126311f, 0.920299947f},
-std::array<float,2>{0.528518975f, 0.029503651f},
-std::array<float,2>{0.18617557f, 0.335986525f},
-std::array<float,2>{0.882391393f, 0.60872978f},
-std::array<float,2>{0.0309825186f, 0.940754771f},
-std::array<float,2>{0.757828414f, 0.0789243802f},
-std::array<float,2>{0.459392697f, 0.300596356f},
-std::array<float,2>{0.681334376f, 0.515308142f},
-std::array<float,2>{0.367593676f, 0.741077602f},
-std::array<float,2>{0.616718888f, 0.452050775f},
-std::array<float,2>{0.226657927f, 0.228703573f},
-std::array<float,2>{0.991079986f, 0.781436563f},
-std::array<float,2>{0.136400238f, 0.574898541f},
-std::array<float,2>{0.907048047f, 0.369310081f},
-std::array<float,2>{0.250481218f, 0.0507083982f},
-std::array<float,2>{0.558307767f, 0.904586852f},
-std::array<float,2>{0.396502525f, 0.848221004f},
-std::array<float,2>{0.739019096f, 0.164873928f},
-std::array<float,2>{0.0753593594f, 0.379101485f},
-std::array<float,2>{0.872490644f, 0.647604883f},
-std::array<float,2>{0.0888382941f, 0.831608415f},
-std::array<float,2>{0.85386622f, 0.14637728f},
-std::array<float,2>{0.385065019f, 0.418468058f},
-std::array<float,2>{0.720441103f, 0.670328379f},
-std::array<float,2>{0.26803726f, 0.614433944f},
-std::array<float,2>{0.546327829f, 0.323238224f},
-std::array<float,2>{0.153914332f, 0.00702684047f},
-std::array<float,2>{0.924346745f, 0.933647692f},
-std::array<float,2>{0.238640323f, 0.691742718f},
-std::array<float,2>{0.977956355f, 0.487979054f},
-std::array<float,2>{0.358157456f, 0.200516179f},
-std::array<float,2>{0.604117811f, 0.777675033f},
-std::array<float,2>{0.449425459f, 0.994524896f},
-std::array<float,2>{0.668362856f, 0.11087162f},
-std::array<float,2>{0.00100676494f, 0.257660717f},
-std::array<float,2>{0.769502819f, 0.541173756f},
-std::array<float,2>{0.161961719f, 0.875335097f},
-std::array<float,2>{0.905890882f, 0.0365011096f},
-std::array<float,2>{0.299043387f, 0.356893808f},
-std::array<float,2>{0.500730157f, 0.578638673f},
-std::array<float,2>{0.41822058f, 0.628723085f},
-std::array<float,2>{0.700383902f, 0.396728456f},
-std::array<float,2>{0.116368361f, 0.172397509f},
-std::array<float,2>{0.827349842f, 0.871872723f},
-std::array<float,2>{0.0542147271f, 0.52247113f},
-std::array<float,2>{0.78211832f, 0.291798085f},
-std::array<float,2>{0.475005269f, 0.0663322285f},
-std::array<float,2>{0.626642883f, 0.967804849f},
-std::array<float,2>{0.320227683f, 0.806924105f},
-std::array<float,2>{0.580905139f, 0.240422487f},
-std::array<float,2>{0.208613873f, 0.453501225f},
-std::array<float,2>{0.966555178f, 0.730857015f},
-std::array<float,2>{0.242692739f, 0.825710833f},
-std::array<float,2>{0.974918187f, 0.127978489f},
-std::array<float,2>{0.34898752f, 0.422108829f},
-std::array<float,2>{0.600107312f, 0.684862018f},
-std::array<float,2>{0.441548824f, 0.604485273f},
-std::array<float,2>{0.658910215f, 0.340730309f},
-std::array<float,2>{0.00859312247f, 0.0252423808f},
-std::array<float,2>{0.778881729f, 0.915987194f},
-std::array<float,2>{0.0830061659f, 0.713988662f},
-std::array<float,2>{0.846597314f, 0.476222724f},
-std::array<float,2>{0.377971828f, 0.215694889f},
-std::array<float,2>{0.727785349f, 0.750347853f},
-std::array<float,2>{0.273695439f, 0.973729908f},
-std::array<float,2>{0.532330155f, 0.0948716402f},
-std::array<float,2>{0.147254899f, 0.267766416f},
-std::array<float,2>{0.936258852f, 0.555324495f},
-std::array<float,2>{0.0548542738f, 0.898872972f},
-std::array<float,2>{0.792008579f, 0.0532187745f},
-std::array<float,2>{0.478782207f, 0.371262193f},
-std::array<float,2>{0.637147546f, 0.572693229f},
-std::array<float,2>{0.327438533f, 0.643230915f},
-std::array<float,2>{0.591370344f, 0.378655732f},
-std::array<float,2>{0.214950249f, 0.17177479f},
-std::array<float,2>{0.954369545f, 0.846804202f},
-std::array<float,2>{0.165749088f, 0.511211872f},
-std::array<float,2>{0.898427367f, 0.301079661f},
-std::array<float,2>{0.304988801f, 0.083466135f},
-std::array<float,2>{0.511422873f, 0.944333911f},
-std::array<float,2>{0.408069342f, 0.788139522f},
-std::array<float,2>{0.690344334f, 0.234121382f},
-std::array<float,2>{0.11982435f, 0.446752191f},
-std::array<float,2>{0.81483674f, 0.737232149f},
-std::array<float,2>{0.106076643f, 0.776286542f},
-std::array<float,2>{0.831829607f, 0.197327584f},
-std::array<float,2>{0.425517112f, 0.491180897f},
-std::array<float,2>{0.705771029f, 0.690826178f},
-std::array<float,2>{0.282286882f, 0.543155968f},
-std::array<float,2>{0.522939205f, 0.251938313f},
-std::array<float,2>{0.17378588f, 0.117133372f},
-std::array<float,2>{0.889686584f, 0.99618876f},
-std::array<float,2>{0.195310399f, 0.666891992f},
-std::array<float,2>{0.942330778f, 0.416001886f},
-std::array<float,2>{0.34176451f, 0.142689079f},
-std::array<float,2>{0.564661801f, 0.835481048f},
-std::array<float,2>{0.497019321f, 0.931818545f},
-std::array<float,2>{0.651692867f, 0.0019462778f},
-std::array<float,2>{0.0319079235f, 0.324406832f},
-std::array<float,2>{0.811078608f, 0.611073554f},
-std::array<float,2>{0.125192121f, 0.964541256f},
-std::array<float,2>{0.921373665f, 0.0688123852f},
-std::array<float,2>{0.258828968f, 0.293817818f},
-std::array<float,2>{0.554527879f, 0.518944979f},
-std::array<float,2>{0.405129105f, 0.726600707f},
-std::array<float,2>{0.748048842f, 0.460246027f},
-std::array<float,2>{0.0645704344f, 0.235661417f},
-std::array<float,2>{0.861024082f, 0.808875978f},
-std::array<float,2>{0.0186101273f, 0.582581222f},
-std::array<float,2>{0.755255997f, 0.35329622f},
-std::array<float,2>{0.462103069f, 0.0333463401f},
-std::array<float,2>{0.676263213f, 0.878940046f},
-std::array<float,2>{0.364636213f, 0.868866146f},
-std::array<float,2>{0.617619991f, 0.17803295f},
-std::array<float,2>{0.223323792f, 0.394018471f},
-std::array<float,2>{0.999985099f, 0.632036686f},
-std::array<float,2>{0.182637081f, 0.801767766f},
-std::array<float,2>{0.877328455f, 0.245638773f},
-std::array<float,2>{0.296272993f, 0.465041935f},
-std::array<float,2>{0.523865521f, 0.722124994f},
-std::array<float,2>{0.430415571f, 0.529521465f},
-std::array<float,2>{0.715985f, 0.287608951f},
-std::array<float,2>{0.0968140364f, 0.0740995705f},
-std::array<float,2>{0.839531064f, 0.957054377f},
-std::array<float,2>{0.0443982743f, 0.633116007f},
-std::array<float,2>{0.803237259f, 0.401782006f},
-std::array<float,2>{0.487435699f, 0.187222093f},
-std::array<float,2>{0.647185147f, 0.859721065f},
-std::array<float,2>{0.328528821f, 0.88350451f},
-std::array<float,2>{0.576642752f, 0.0450560004f},
-std::array<float,2>{0.196878418f, 0.346356988f},
-std::array<float,2>{0.949230254f, 0.588431418f},
-std::array<float,2>{0.0712041631f, 0.985557914f},
-std::array<float,2>{0.868875682f, 0.118598215f},
-std::array<float,2>{0.390888602f, 0.258289367f},
-std::array<float,2>{0.738274336f, 0.538297415f},
-std::array<float,2>{0.255711585f, 0.698840022f},
-std::array<float,2>{0.561343133f, 0.497753531f},
-std::array<float,2>{0.138485461f, 0.192780629f},
-std::array<float,2>{0.9112643f, 0.770544052f},
-std::array<float,2>{0.232056171f, 0.621053696f},
-std::array<float,2>{0.984814405f, 0.317151397f},
-std::array<float,2>{0.374689072f, 0.014174764f},
-std::array<float,2>{0.612020016f, 0.923252344f},
-std::array<float,2>{0.456328601f, 0.84145236f},
-std::array<float,2>{0.684495449f, 0.153107971f},
-std::array<float,2>{0.0241731666f, 0.408100903f},
-std::array<float,2>{0.761755466f, 0.658973157f},
-std::array<float,2>{0.00496461382f, 0.85349673f},
-std::array<float,2>{0.771014571f, 0.156768873f},
-std::array<float,2>{0.44565317f, 0.390178651f},
-std::array<float,2>{0.667931139f, 0.650090456f},
-std::array<float,2>{0.35329777f, 0.565192103f},
-std::array<float,2>{0.605906367f, 0.366428703f},
-std::array<float,2>{0.238002107f, 0.0561231039f},
-std::array<float,2>{0.984330237f, 0.892274976f},
-std::array<float,2>{0.149858907f, 0.747967243f},
-std::array<float,2>{0.928414702f, 0.443003833f},
-std::array<float,2>{0.27040872f, 0.225093871f},
-std::array<float,2>{0.540557504f, 0.790790856f},
-std::array<float,2>{0.390148669f, 0.945409298f},
-std::array<float,2>{0.725438595f, 0.0877837762f},
-std::array<float,2>{0.0907203406f, 0.307630152f},
-std::array<float,2>{0.856319904f, 0.506651998f},
-std::array<float,2>{0.20468533f, 0.907578528f},
-std::array<float,2>{0.964469731f, 0.0175675638f},
-std::array<float,2>{0.31490165f, 0.329227775f},
-std::array<float,2>{0.582178473f, 0.600747168f},
-std::array<float,2>{0.471770436f, 0.675099492f},
-std::array<float,2>{0.630643308f, 0.430145144f},
-std::array<float,2>{0.0476823673f, 0.135830671f},
-std::array<float,2>{0.786701202f, 0.815613806f},
-std::array<float,2>{0.109475687f, 0.554607809f},
-std::array<float,2>{0.823227227f, 0.279068053f},
-std::array<float,2>{0.414811134f, 0.104435399f},
-std::array<float,2>{0.696141362f, 0.977658272f},
-std::array<float,2>{0.301968664f, 0.759443343f},
-std::array<float,2>{0.506524205f, 0.203836799f},
-std::array<float,2>{0.159935459f, 0.479183435f},
-std::array<float,2>{0.899156213f, 0.709246218f},
-std::array<float,2>{0.168875948f, 0.836692572f},
-std::array<float,2>{0.891797364f, 0.150552019f},
-std::array<float,2>{0.311722934f, 0.412635475f},
-std::array<float,2>{0.514978945f, 0.661477685f},
-std::array<float,2>{0.41263327f, 0.623683929f},
-std::array<float,2>{0.692867577f, 0.312783211f},
-std::array<float,2>{0.121803202f, 0.0116688618f},
-std::array<float,2>{0.818516612f, 0.927398622f},
-std::array<float,2>{0.0614414625f, 0.700143695f},
-std::array<float,2>{0.794145107f, 0.493110865f},
-std::array<float,2>{0.48287943f, 0.190580741f},
-std::array<float,2>{0.635146141f, 0.767415226f},
-std::array<float,2>{0.321663529f, 0.990232944f},
-std::array<float,2>{0.586318076f, 0.121386267f},
-std::array<float,2>{0.213467225f, 0.265393794f},
-std::array<float,2>{0.957767069f, 0.534079731f},
-std::array<float,2>{0.078776814f, 0.888520896f},
-std::array<float,2>{0.848546445f, 0.0400742665f},
-std::array<float,2>{0.379538298f, 0.349898279f},
-std::array<float,2>{0.731940031f, 0.590658545f},
-std::array<float,2>{0.280051887f, 0.640295088f},
-std::array<float,2>{0.537272036f, 0.40535897f},
-std::array<float,2>{0.144209251f, 0.183514163f},
-std::array<float,2>{0.932105303f, 0.864043713f},
-std::array<float,2>{0.24918887f, 0.524284542f},
-std::array<float,2>{0.971988797f, 0.281517446f},
-std::array<float,2>{0.344855875f, 0.0750431865f},
-std::array<float,2>{0.596934378f, 0.953448474f},
-std::array<float,2>{0.43947795f, 0.799211383f},
-std::array<float,2>{0.662354827f, 0.248545691f},
-std::array<float,2>{0.0149001246f, 0.462207228f},
-std::array<float,2>{0.777118862f, 0.725389779f},
-std::array<float,2>{0.0224408042f, 0.763776422f},
-std::array<float,2>{0.753537238f, 0.210936919f},
-std::array<float,2>{0.467158079f, 0.48069182f},
-std::array<float,2>{0.673393726f, 0.706908822f},
-std::array<float,2>{0.361220717f, 0.550369382f},
-std::array<float,2>{0.624313533f, 0.273911923f},
-std::array<float,2>{0.221989319f, 0.107617095f},
-std::array<float,2>{0.993792832f, 0.983928502f},
-std::array<float,2>{0.1322335f, 0.677346528f},
-std::array<float,2>{0.916450262f, 0.436961949f},
-std::array<float,2>{0.262152225f, 0.136750489f},
-std::array<float,2>{0.549305201f, 0.818671823f},
-std::array<float,2>{0.401770681f, 0.91129601f},
-std::array<float,2>{0.742555022f, 0.0195567794f},
-std::array<float,2>{0.0699195936f, 0.334434271f},
-std::array<float,2>{0.863951504f, 0.594506681f},
-std::array<float,2>{0.188988596f, 0.952748418f},
-std::array<float,2>{0.939607263f, 0.0923535898f},
-std::array<float,2>{0.33965674f, 0.309044451f},
-std::array<float,2>{0.566617787f, 0.500352502f},
-std::array<float,2>{0.495554566f, 0.74598223f},
-std::array<float,2>{0.653156161f, 0.437520146f},
-std::array<float,2>{0.0354408175f, 0.218893126f},
-std::array<float,2>{0.808042705f, 0.793068647f},
-std::array<float,2>{0.104522221f, 0.569900036f},
-std::array<float,2>{0.833991945f, 0.361521423f},
-std::array<float,2>{0.428070456f, 0.0601850972f},
-std::array<float,2>{0.709888816f, 0.898072004f},
-std::array<float,2>{0.288114578f, 0.855720878f},
-std::array<float,2>{0.51943779f, 0.160566568f},
-std::array<float,2>{0.17792736f, 0.383317411f},
-std::array<float,2>{0.884192884f, 0.654825687f},
-std::array<float,2>{0.230191857f, 0.783740759f},
-std::array<float,2>{0.989582062f, 0.227811038f},
-std::array<float,2>{0.369317055f, 0.450247347f},
-std::array<float,2>{0.614310026f, 0.738805532f},
-std::array<float,2>{0.457777083f, 0.512882113f},
-std::array<float,2>{0.681855738f, 0.29829362f},
-std::array<float,2>{0.0280936379f, 0.0818605646f},
-std::array<float,2>{0.759989858f, 0.93806833f},
-std::array<float,2>{0.0769127309f, 0.645390272f},
-std::array<float,2>{0.874272227f, 0.381222695f},
-std::array<float,2>{0.39508605f, 0.167476535f},
-std::array<float,2>{0.741124153f, 0.85134989f},
-std::array<float,2>{0.252271771f, 0.903876126f},
-std::array<float,2>{0.556335568f, 0.0483702607f},
-std::array<float,2>{0.133712724f, 0.367404312f},
-std::array<float,2>{0.908706188f, 0.5762676f},
-std::array<float,2>{0.0415797941f, 0.971835554f},
-std::array<float,2>{0.797649503f, 0.100683764f},
-std::array<float,2>{0.488402486f, 0.273341954f},
-std::array<float,2>{0.642011404f, 0.560494959f},
-std::array<float,2>{0.333058894f, 0.715622187f},
-std::array<float,2>{0.571779191f, 0.472016841f},
-std::array<float,2>{0.200872853f, 0.211742818f},
-std::array<float,2>{0.947763801f, 0.757748842f},
-std::array<float,2>{0.183808878f, 0.606838346f},
-std::array<float,2>{0.880422831f, 0.338437349f},
-std::array<float,2>{0.289953649f, 0.0273545571f},
-std::array<float,2>{0.529601574f, 0.918920636f},
-std::array<float,2>{0.43680203f, 0.82351315f},
-std::array<float,2>{0.710986733f, 0.131878078f},
-std::array<float,2>{0.0981455892f, 0.427248031f},
-std::array<float,2>{0.841691077f, 0.683361888f},
-std::array<float,2>{0.114750445f, 0.874106526f},
-std::array<float,2>{0.825551152f, 0.174414635f},
-std::array<float,2>{0.420770198f, 0.395028651f},
-std::array<float,2>{0.70152241f, 0.625395358f},
-std::array<float,2>{0.297402859f, 0.581512272f},
-std::array<float,2>{0.503108501f, 0.359191805f},
-std::array<float,2>{0.162889034f, 0.0388893969f},
-std::array<float,2>{0.903120339f, 0.877721965f},
-std::array<float,2>{0.209012151f, 0.733650804f},
-std::array<float,2>{0.968723476f, 0.456117004f},
-std::array<float,2>{0.316889256f, 0.238647297f},
-std::array<float,2>{0.578209639f, 0.805895209f},
-std::array<float,2>{0.474357039f, 0.965339839f},
-std::array<float,2>{0.627041399f, 0.0636644438f},
-std::array<float,2>{0.0515075214f, 0.290373683f},
-std::array<float,2>{0.784983575f, 0.52061373f},
-std::array<float,2>{0.155464441f, 0.935617328f},
-std::array<float,2>{0.922760665f, 0.00570311258f},
-std::array<float,2>{0.266106993f, 0.321298778f},
-std::array<float,2>{0.544873059f, 0.616435468f},
-std::array<float,2>{0.384121567f, 0.669578195f},
-std::array<float,2>{0.720813096f, 0.420253396f},
-std::array<float,2>{0.0861780941f, 0.148405075f},
-std::array<float,2>{0.852957666f, 0.828511596f},
-std::array<float,2>{0.00276006525f, 0.539739847f},
-std::array<float,2>{0.766665578f, 0.255660087f},
-std::array<float,2>{0.451829731f, 0.112351641f},
-std::array<float,2>{0.671087563f, 0.993956268f},
-std::array<float,2>{0.356451869f, 0.780673265f},
-std::array<float,2>{0.602653921f, 0.201507315f},
-std::array<float,2>{0.241485372f, 0.485723048f},
-std::array<float,2>{0.97949481f, 0.693801224f},
-std::array<float,2>{0.21846655f, 0.844862819f},
-std::array<float,2>{0.955177784f, 0.168136001f},
-std::array<float,2>{0.325235784f, 0.376521051f},
-std::array<float,2>{0.593748927f, 0.641867936f},
-std::array<float,2>{0.478038758f, 0.571569383f},
-std::array<float,2>{0.639435291f, 0.374386728f},
-std::array<float,2>{0.0578090996f, 0.0509474762f},
-std::array<float,2>{0.790649056f, 0.901024818f},
-std::array<float,2>{0.1179149f, 0.73529011f},
-std::array<float,2>{0.81330049f, 0.448571652f},
-std::array<float,2>{0.40941748f, 0.231400043f},
-std::array<float,2>{0.688573718f, 0.786908865f},
-std::array<float,2>{0.307900608f, 0.943295598f},
-std::array<float,2>{0.509650826f, 0.0856276527f},
-std::array<float,2>{0.16746144f, 0.303979307f},
-std::array<float,2>{0.895335793f, 0.509504795f},
-std::array<float,2>{0.0099109374f, 0.916077673f},
-std::array<float,2>{0.779836953f, 0.0259431917f},
-std::array<float,2>{0.444161266f, 0.34235847f},
-std::array<float,2>{0.656511426f, 0.601731598f},
-std::array<float,2>{0.351262093f, 0.685628533f},
-std::array<float,2>{0.598189712f, 0.425595313f},
-std::array<float,2>{0.245205224f, 0.125775889f},
-std::array<float,2>{0.973278105f, 0.827233851f},
-std::array<float,2>{0.145786136f, 0.557959974f},
-std::array<float,2>{0.934078455f, 0.266241878f},
-std::array<float,2>{0.275596023f, 0.0964145064f},
-std::array<float,2>{0.535155773f, 0.974863231f},
-std::array<float,2>{0.376756936f, 0.75231123f},
-std::array<float,2>{0.730404913f, 0.21710977f},
-std::array<float,2>{0.0853174478f, 0.473733097f},
-std::array<float,2>{0.845060706f, 0.7117818f},
-std::array<float,2>{0.063687183f, 0.811505198f},
-std::array<float,2>{0.8630265f, 0.236595944f},
-std::array<float,2>{0.404260725f, 0.458267987f},
-std::array<float,2>{0.746389985f, 0.730260611f},
-std::array<float,2>{0.261396348f, 0.517114043f},
-std::array<float,2>{0.551535487f, 0.295722932f},
-std::array<float,2>{0.128503963f, 0.0677198917f},
-std::array<float,2>{0.918449581f, 0.962867975f},
-std::array<float,2>{0.224696636f, 0.628953695f},
-std::array<float,2>{0.997146845f, 0.39111802f},
-std::array<float,2>{0.366854519f, 0.177680001f},
-std::array<float,2>{0.61941129f, 0.871082127f},
-std::array<float,2>{0.46320051f, 0.881990433f},
-std::array<float,2>{0.678827763f, 0.0326613635f},
-std::array<float,2>{0.0161818229f, 0.355069637f},
-std::array<float,2>{0.756105363f, 0.585755229f},
-std::array<float,2>{0.175637022f, 0.998985946f},
-std::array<float,2>{0.886902511f, 0.114103056f},
-std::array<float,2>{0.284325004f, 0.253818452f},
-std::array<float,2>{0.519912958f, 0.546324849f},
-std::array<float,2>{0.423612088f, 0.689028323f},
-std::array<float,2>{0.704178393f, 0.490101963f},
-std::array<float,2>{0.108867742f, 0.195326865f},
-std::array<float,2>{0.828173935f, 0.774386525f},
-std::array<float,2>{0.0333206169f, 0.612761199f},
-std::array<float,2>{0.809604585f, 0.327988625f},
-std::array<float,2>{0.499313831f, 0.00269446778f},
-std::array<float,2>{0.649348378f, 0.930759847f},
-std::array<float,2>{0.3425138f, 0.832114935f},
-std::array<float,2>{0.564261794f, 0.141782165f},
-std::array<float,2>{0.192958727f, 0.41679731f},
-std::array<float,2>{0.943563938f, 0.665514469f},
-std::array<float,2>{0.139520764f, 0.772055089f},
-std::array<float,2>{0.914011657f, 0.194418728f},
-std::array<float,2>{0.257321984f, 0.49812448f},
-std::array<float,2>{0.559250295f, 0.696229756f},
-std::array<float,2>{0.393919468f, 0.536274672f},
-std::array<float,2>{0.736038983f, 0.260859966f},
-std::array<float,2>{0.0733449459f, 0.119369037f},
-std::array<float,2>{0.870192409f, 0.987946987f},
-std::array<float,2>{0.0255265106f, 0.657393098f},
-std::array<float,2>{0.765244067f, 0.408831477f},
-std::array<float,2>{0.453999817f, 0.154463008f},
-std::array<float,2>{0.685844779f, 0.842153072f},
-std::array<float,2>{0.371709228f, 0.925490618f},
-std::array<float,2>{0.61022836f, 0.0133270398f},
-std::array<float,2>{0.233146757f, 0.319702655f},
-std::array<float,2>{0.986421764f, 0.617990136f},
-std::array<float,2>{0.0949047953f, 0.959087193f},
-std::array<float,2>{0.836885989f, 0.0719577447f},
-std::array<float,2>{0.433057576f, 0.285619169f},
-std::array<float,2>{0.71818465f, 0.527360499f},
-std::array<float,2>{0.293040752f, 0.720400095f},
-std::array<float,2>{0.526224434f, 0.468506455f},
-std::array<float,2>{0.17996709f, 0.24358958f},
-std::array<float,2>{0.87655884f, 0.8028965f},
-std::array<float,2>{0.197807312f, 0.587720335f},
-std::array<float,2>{0.951987863f, 0.344891787f},
-std::array<float,2>{0.331115454f, 0.044806771f},
-std::array<float,2>{0.576050758f, 0.885734618f},
-std::array<float,2>{0.484978855f, 0.86251384f},
-std::array<float,2>{0.646027684f, 0.184119433f},
-std::array<float,2>{0.0452419035f, 0.399263293f},
-std::array<float,2>{0.801302731f, 0.636457682f},
-std::array<float,2>{0.0490695462f, 0.813288152f},
-std::array<float,2>{0.788426459f, 0.134187028f},
-std::array<float,2>{0.470298022f, 0.432241082f},
-std::array<float,2>{0.631233394f, 0.672972202f},
-std::array<float,2>{0.313595355f, 0.597877145f},
-std::array<float,2>{0.584507585f, 0.331798941f},
-std::array<float,2>{0.206295311f, 0.0184840336f},
-std::array<float,2>{0.961612284f, 0.908419132f},
-std::array<float,2>{0.15703924f, 0.708509684f},
-std::array<float,2>{0.901736677f, 0.477655441f},
-std::array<float,2>{0.302932769f, 0.206171274f},
-std::array<float,2>{0.505146384f, 0.76168865f},
-std::array<float,2>{0.417278111f, 0.979911864f},
-std::array<float,2>{0.698921382f, 0.103101745f},
-std::array<float,2>{0.112263739f, 0.280386955f},
-std::array<float,2>{0.821703851f, 0.551011145f},
-std::array<float,2>{0.234640524f, 0.893190026f},
-std::array<float,2>{0.980685055f, 0.0566669069f},
-std::array<float,2>{0.355065316f, 0.364352405f},
-std::array<float,2>{0.60856688f, 0.564325988f},
-std::array<float,2>{0.447727859f, 0.651380837f},
-std::array<float,2>{0.665728807f, 0.387828588f},
-std::array<float,2>{0.00599074923f, 0.158946261f},
-std::array<float,2>{0.773387432f, 0.855256498f},
-std::array<float,2>{0.0918830708f, 0.504509807f},
-std::array<float,2>{0.858937919f, 0.30506292f},
-std::array<float,2>{0.387807876f, 0.0897195563f},
-std::array<float,2>{0.724336624f, 0.94730103f},
-std::array<float,2>{0.272421449f, 0.79142791f},
-std::array<float,2>{0.542135f, 0.22421822f},
-std::array<float,2>{0.150744811f, 0.445008129f},
-std::array<float,2>{0.927699983f, 0.748205662f},
-std::array<float,2>{0.128961995f, 0.819682181f},
-std::array<float,2>{0.914307714f, 0.138501018f},
-std::array<float,2>{0.264986068f, 0.435699373f},
-std::array<float,2>{0.548346281f, 0.675814986f},
-std::array<float,2>{0.399380893f, 0.594913483f},
-std::array<float,2>{0.744757473f, 0.335789561f},
-std::array<float,2>{0.0665492937f, 0.0205750149f},
-std::array<float,2>{0.866354585f, 0.910601556f},
-std::array<float,2>{0.0201641638f, 0.705099106f},
-std::array<float,2>{0.751010835f, 0.48239246f},
-std::array<float,2>{0.464936554f, 0.209423363f},
-std::array<float,2>{0.674598336f, 0.764650583f},
-std::array<float,2>{0.361328632f, 0.982474208f},
-std::array<float,2>{0.622297764f, 0.109314188f},
-std::array<float,2>{0.219455287f, 0.274954468f},
-std::array<float,2>{0.994751394f, 0.549236715f},
-std::array<float,2>{0.102605291f, 0.897209764f},
-std::array<float,2>{0.833593428f, 0.0591523647f},
-std::array<float,2>{0.427144021f, 0.362509966f},
-std::array<float,2>{0.708147287f, 0.568485439f},
-std::array<float,2>{0.285199732f, 0.655653715f},
-std::array<float,2>{0.516267836f, 0.384093076f},
-std::array<float,2>{0.176264361f, 0.161662102f},
-std::array<float,2>{0.885317624f, 0.856537163f},
-std::array<float,2>{0.191136017f, 0.501645327f},
-std::array<float,2>{0.93802911f, 0.309828281f},
-std::array<float,2>{0.336736739f, 0.0935356915f},
-std::array<float,2>{0.569487333f, 0.951360166f},
-std::array<float,2>{0.493117809f, 0.794498205f},
-std::array<float,2>{0.656246543f, 0.219780281f},
-std::array<float,2>{0.0378220417f, 0.438845932f},
-std::array<float,2>{0.805494905f, 0.744630694f},
-std::array<float,2>{0.0605339073f, 0.766319156f},
-std::array<float,2>{0.795746028f, 0.189635918f},
-std::array<float,2>{0.481697649f, 0.493997931f},
-std::array<float,2>{0.633942604f, 0.700256646f},
-std::array<float,2>{0.323383093f, 0.534849167f},
-std::array<float,2>{0.588653028f, 0.264574736f},
-std::array<float,2>{0.212487116f, 0.122805402f},
-std::array<float,2>{0.960479677f, 0.988869548f},
-std::array<float,2>{0.171815217f, 0.661101162f},
-std::array<float,2>{0.893783391f, 0.413858324f},
-std::array<float,2>{0.309184909f, 0.152036175f},
-std::array<float,2>{0.51188004f, 0.837012112f},
-std::array<float,2>{0.411800623f, 0.926709056f},
-std::array<float,2>{0.693773866f, 0.010341851f},
-std::array<float,2>{0.124297999f, 0.31384331f},
-std::array<float,2>{0.818244874f, 0.624341309f},
-std::array<float,2>{0.247380197f, 0.955049634f},
-std::array<float,2>{0.969969571f, 0.0756231844f},
-std::array<float,2>{0.346576124f, 0.283100426f},
-std::array<float,2>{0.594450414f, 0.525001168f},
-std::array<float,2>{0.438250244f, 0.726536393f},
-std::array<float,2>{0.661289871f, 0.461243927f},
-std::array<float,2>{0.01319909f, 0.249291718f},
-std::array<float,2>{0.774978459f, 0.800574243f},
-std::array<float,2>{0.0807399899f, 0.59176141f},
-std::array<float,2>{0.850806534f, 0.351161003f},
-std::array<float,2>{0.381022066f, 0.0394867621f},
-std::array<float,2>{0.734040082f, 0.887056947f},
-std::array<float,2>{0.278022051f, 0.864415705f},
-std::array<float,2>{0.536392331f, 0.181835681f},
-std::array<float,2>{0.14226523f, 0.405069947f},
-std::array<float,2>{0.929723561f, 0.638733447f},
-std::array<float,2>{0.207887203f, 0.804718494f},
-std::array<float,2>{0.965275764f, 0.239861324f},
-std::array<float,2>{0.31931743f, 0.455605149f},
-std::array<float,2>{0.581303179f, 0.732428908f},
-std::array<float,2>{0.476265013f, 0.519784927f},
-std::array<float,2>{0.625722528f, 0.289582014f},
-std::array<float,2>{0.0536862537f, 0.0632594675f},
-std::array<float,2>{0.782498002f, 0.966672301f},
-std::array<float,2>{0.116210446f, 0.626539052f},
-std::array<float,2>{0.826473057f, 0.396459013f},
-std::array<float,2>{0.419819444f, 0.175218433f},
-std::array<float,2>{0.69997251f, 0.873317003f},
-std::array<float,2>{0.300397277f, 0.877957106f},
-std::array<float,2>{0.50178057f, 0.0372376144f},
-std::array<float,2>{0.160421714f, 0.357625306f},
-std::array<float,2>{0.904348373f, 0.580789506f},
-std::array<float,2>{0.000921038911f, 0.992262244f},
-std::array<float,2>{0.768535316f, 0.11180649f},
-std::array<float,2>{0.450412869f, 0.25471127f},
-std::array<float,2>{0.668949544f, 0.540960729f},
-std::array<float,2>{0.359347314f, 0.694691718f},
-std::array<float,2>{0.604891062f, 0.484927267f},
-std::array<float,2>{0.23945941f, 0.202210262f},
-std::array<float,2>{0.976962745f, 0.77933383f},
-std::array<float,2>{0.152746186f, 0.615576327f},
-std::array<float,2>{0.92557925f, 0.320838749f},
-std::array<float,2>{0.268592715f, 0.00405385997f},
-std::array<float,2>{0.545798779f, 0.936687171f},
-std::array<float,2>{0.386195004f, 0.829214036f},
-std::array<float,2>{0.719687939f, 0.14654848f},
-std::array<float,2>{0.0892279968f, 0.421396852f},
-std::array<float,2>{0.855304539f, 0.668250263f},
-std::array<float,2>{0.0750179142f, 0.850344777f},
-std::array<float,2>{0.871943891f, 0.16651459f},
-std::array<float,2>{0.398243994f, 0.382473618f},
-std::array<float,2>{0.739471376f, 0.646124899f},
-std::array<float,2>{0.251934886f, 0.577787459f},
-std::array<float,2>{0.557053983f, 0.369108915f},
-std::array<float,2>{0.135051638f, 0.0476410836f},
-std::array<float,2>{0.907509267f, 0.902916014f},
-std::array<float,2>{0.228471056f, 0.739895523f},
-std::array<float,2>{0.991563559f, 0.449354768f},
-std::array<float,2>{0.368839711f, 0.22716932f},
-std::array<float,2>{0.615589142f, 0.785108566f},
-std::array<float,2>{0.460746944f, 0.938894153f},
-std::array<float,2>{0.68057847f, 0.080569528f},
-std::array<float,2>{0.0301484428f, 0.297167987f},
-std::array<float,2>{0.759013832f, 0.512322247f},
-std::array<float,2>{0.187354594f, 0.919570446f},
-std::array<float,2>{0.880915403f, 0.0292900708f},
-std::array<float,2>{0.292286843f, 0.33897683f},
-std::array<float,2>{0.528057277f, 0.606392622f},
-std::array<float,2>{0.434847176f, 0.681990862f},
-std::array<float,2>{0.71299547f, 0.425924987f},
-std::array<float,2>{0.101432726f, 0.131820038f},
-std::array<float,2>{0.842120171f, 0.822374105f},
-std::array<float,2>{0.0396286771f, 0.558637619f},
-std::array<float,2>{0.800291777f, 0.271743745f},
-std::array<float,2>{0.492106527f, 0.100073993f},
-std::array<float,2>{0.643724501f, 0.97126025f},
-std::array<float,2>{0.335124701f, 0.756292105f},
-std::array<float,2>{0.572370708f, 0.212672561f},
-std::array<float,2>{0.20153901f, 0.471438169f},
-std::array<float,2>{0.945534408f, 0.716598809f},
-std::array<float,2>{0.224034712f, 0.869888246f},
-std::array<float,2>{0.998333097f, 0.176605046f},
-std::array<float,2>{0.363434404f, 0.391936779f},
-std::array<float,2>{0.618523538f, 0.630732059f},
-std::array<float,2>{0.46131438f, 0.584115267f},
-std::array<float,2>{0.677144706f, 0.354011595f},
-std::array<float,2>{0.0183843765f, 0.0313870199f},
-std::array<float,2>{0.754169524f, 0.880955458f},
-std::array<float,2>{0.0659927651f, 0.728931248f},
-std::array<float,2>{0.85954088f, 0.457805037f},
-std::array<float,2>{0.405570239f, 0.237554997f},
-std::array<float,2>{0.749732494f, 0.811823964f},
-std::array<float,2>{0.25795576f, 0.961510599f},
-std::array<float,2>{0.55320859f, 0.0666301474f},
-std::array<float,2>{0.126937017f, 0.296104759f},
-std::array<float,2>{0.920483947f, 0.516140103f},
-std::array<float,2>{0.0330474339f, 0.92985189f},
-std::array<float,2>{0.812133074f, 0.00315332809f},
-std::array<float,2>{0.497213393f, 0.326614618f},
-std::array<float,2>{0.650601923f, 0.611352503f},
-std::array<float,2>{0.340668112f, 0.664798319f},
-std::array<float,2>{0.565562785f, 0.417191863f},
-std::array<float,2>{0.194278896f, 0.140951723f},
-std::array<float,2>{0.942405343f, 0.833584845f},
-std::array<float,2>{0.17266129f, 0.544995129f},
-std::array<float,2>{0.889112055f, 0.252741992f},
-std::array<float,2>{0.281970859f, 0.115159519f},
-std::array<float,2>{0.521713078f, 0.999627233f},
-std::array<float,2>{0.424002111f, 0.774792254f},
-std::array<float,2>{0.706189692f, 0.196471781f},
-std::array<float,2>{0.106670961f, 0.488579988f},
-std::array<float,2>{0.830524206f, 0.687612474f},
-std::array<float,2>{0.120892845f, 0.786025226f},
-std::array<float,2>{0.816102386f, 0.231951237f},
-std::array<float,2>{0.406597465f, 0.447709203f},
-std::array<float,2>{0.69070673f, 0.736308873f},
-std::array<float,2>{0.306119144f, 0.508698344f},
-std::array<float,2>{0.509910643f, 0.302853882f},
-std::array<float,2>{0.164233774f, 0.084698692f},
-std::array<float,2>{0.896734655f, 0.942024171f},
-std::array<float,2>{0.215984046f, 0.641215861f},
-std::array<float,2>{0.953875184f, 0.375889808f},
-std::array<float,2>{0.326220095f, 0.168948665f},
-std::array<float,2>{0.590016425f, 0.844609737f},
-std::array<float,2>{0.479825675f, 0.90175873f},
-std::array<float,2>{0.638086081f, 0.0518184677f},
-std::array<float,2>{0.055908341f, 0.373259693f},
-std::array<float,2>{0.791797638f, 0.570856094f},
-std::array<float,2>{0.147507951f, 0.975862324f},
-std::array<float,2>{0.93664211f, 0.0972249582f},
-std::array<float,2>{0.274482369f, 0.267348081f},
-std::array<float,2>{0.531744123f, 0.557079315f},
-std::array<float,2>{0.377022535f, 0.712880731f},
-std::array<float,2>{0.726635277f, 0.473584354f},
-std::array<float,2>{0.0835403726f, 0.218545258f},
-std::array<float,2>{0.846895993f, 0.753331244f},
-std::array<float,2>{0.0095811123f, 0.602701962f},
-std::array<float,2>{0.777361751f, 0.343700647f},
-std::array<float,2>{0.442993313f, 0.0273056813f},
-std::array<float,2>{0.659422815f, 0.917573869f},
-std::array<float,2>{0.34841761f, 0.827045143f},
-std::array<float,2>{0.60154587f, 0.126676157f},
-std::array<float,2>{0.243538201f, 0.424503148f},
-std::array<float,2>{0.975613177f, 0.686684906f},
-std::array<float,2>{0.159178287f, 0.759888232f},
-std::array<float,2>{0.899461091f, 0.205327779f},
-std::array<float,2>{0.30156672f, 0.476595432f},
-std::array<float,2>{0.50755465f, 0.707186759f},
-std::array<float,2>{0.415624738f, 0.552303076f},
-std::array<float,2>{0.696369886f, 0.280127496f},
-std::array<float,2>{0.110563532f, 0.102120273f},
-std::array<float,2>{0.823288858f, 0.97940594f},
-std::array<float,2>{0.0478575081f, 0.672241867f},
-std::array<float,2>{0.785469413f, 0.432875723f},
-std::array<float,2>{0.471596092f, 0.133193478f},
-std::array<float,2>{0.629839301f, 0.81393379f},
-std::array<float,2>{0.315659106f, 0.909855425f},
-std::array<float,2>{0.583166897f, 0.0185772032f},
-std::array<float,2>{0.20353055f, 0.330283523f},
-std::array<float,2>{0.963447511f, 0.598739743f},
-std::array<float,2>{0.0917688385f, 0.948943675f},
-std::array<float,2>{0.856879532f, 0.0878997892f},
-std::array<float,2>{0.389088094f, 0.305877477f},
-std::array<float,2>{0.726540923f, 0.505739093f},
-std::array<float,2>{0.270668894f, 0.749375343f},
-std::array<float,2>{0.539398134f, 0.44385922f},
-std::array<float,2>{0.148574427f, 0.223357633f},
-std::array<float,2>{0.92880404f, 0.792115688f},
-std::array<float,2>{0.236872897f, 0.563175857f},
-std::array<float,2>{0.983302057f, 0.364233017f},
-std::array<float,2>{0.352312028f, 0.0576764196f},
-std::array<float,2>{0.606845498f, 0.894003987f},
-std::array<float,2>{0.446470499f, 0.854266107f},
-std::array<float,2>{0.666963935f, 0.160035774f},
-std::array<float,2>{0.00439853687f, 0.387489468f},
-std::array<float,2>{0.770336568f, 0.650494218f},
-std::array<float,2>{0.0251111947f, 0.842787325f},
-std::array<float,2>{0.762743592f, 0.15530774f},
-std::array<float,2>{0.455440134f, 0.40944925f},
-std::array<float,2>{0.684980392f, 0.65697521f},
-std::array<float,2>{0.37366876f, 0.618301332f},
-std::array<float,2>{0.61291337f, 0.318478584f},
-std::array<float,2>{0.2306014f, 0.0126678841f},
-std::array<float,2>{0.985537112f, 0.924089074f},
-std::array<float,2>{0.136991948f, 0.696991622f},
-std::array<float,2>{0.910909593f, 0.49929893f},
-std::array<float,2>{0.254408151f, 0.1938885f},
-std::array<float,2>{0.562280476f, 0.772899866f},
-std::array<float,2>{0.392560333f, 0.987153828f},
-std::array<float,2>{0.736356556f, 0.120916612f},
-std::array<float,2>{0.072057575f, 0.260270417f},
-std::array<float,2>{0.867867708f, 0.535735011f},
-std::array<float,2>{0.19532539f, 0.886418343f},
-std::array<float,2>{0.950911224f, 0.0430512093f},
-std::array<float,2>{0.32933712f, 0.344161689f},
-std::array<float,2>{0.578095019f, 0.586860955f},
-std::array<float,2>{0.486762077f, 0.635624588f},
-std::array<float,2>{0.647868216f, 0.399978518f},
-std::array<float,2>{0.0438176282f, 0.184927523f},
-std::array<float,2>{0.804620206f, 0.862140298f},
-std::array<float,2>{0.0961496979f, 0.528492689f},
-std::array<float,2>{0.838463604f, 0.286805332f},
-std::array<float,2>{0.430752158f, 0.070688732f},
-std::array<float,2>{0.715483904f, 0.960340381f},
-std::array<float,2>{0.295103818f, 0.804589152f},
-std::array<float,2>{0.525111198f, 0.242947355f},
-std::array<float,2>{0.182539821f, 0.467498124f},
-std::array<float,2>{0.878312409f, 0.719276309f},
-std::array<float,2>{0.179528207f, 0.857678354f},
-std::array<float,2>{0.883219063f, 0.162219077f},
-std::array<float,2>{0.287386239f, 0.385144681f},
-std::array<float,2>{0.518116951f, 0.652420044f},
-std::array<float,2>{0.429267973f, 0.566503763f},
-std::array<float,2>{0.710594237f, 0.360010087f},
-std::array<float,2>{0.103963785f, 0.0606958792f},
-std::array<float,2>{0.83524859f, 0.895028234f},
-std::array<float,2>{0.0369638279f, 0.743341386f},
-std::array<float,2>{0.807450652f, 0.441180289f},
-std::array<float,2>{0.4945997f, 0.22136192f},
-std::array<float,2>{0.653420627f, 0.79681313f},
-std::array<float,2>{0.338407278f, 0.950569689f},
-std::array<float,2>{0.567920685f, 0.0913991928f},
-std::array<float,2>{0.187714577f, 0.310979396f},
-std::array<float,2>{0.940439939f, 0.503812134f},
-std::array<float,2>{0.0689694211f, 0.913127065f},
-std::array<float,2>{0.864723086f, 0.0231723804f},
-std::array<float,2>{0.400982887f, 0.332503736f},
-std::array<float,2>{0.743447542f, 0.597090602f},
-std::array<float,2>{0.263516158f, 0.679334164f},
-std::array<float,2>{0.550286412f, 0.434525728f},
-std::array<float,2>{0.131053269f, 0.140375748f},
-std::array<float,2>{0.917608202f, 0.816849351f},
-std::array<float,2>{0.22128135f, 0.547545493f},
-std::array<float,2>{0.993004024f, 0.276481956f},
-std::array<float,2>{0.359656394f, 0.106588237f},
-std::array<float,2>{0.623595893f, 0.981293797f},
-std::array<float,2>{0.467785984f, 0.762983084f},
-std::array<float,2>{0.672055006f, 0.207047671f},
-std::array<float,2>{0.0228077713f, 0.482476085f},
-std::array<float,2>{0.752369404f, 0.70375973f},
-std::array<float,2>{0.0140083209f, 0.797317386f},
-std::array<float,2>{0.775860906f, 0.247657955f},
-std::array<float,2>{0.441281617f, 0.464698136f},
-std::array<float,2>{0.663561702f, 0.723433614f},
-std::array<float,2>{0.344551861f, 0.526523352f},
-std::array<float,2>{0.595867693f, 0.284452796f},
-std::array<float,2>{0.248684227f, 0.0767786503f},
-std::array<float,2>{0.970708072f, 0.955842197f},
-std::array<float,2>{0.143443301f, 0.636770427f},
-std::array<float,2>{0.932991683f, 0.403815299f},
-std::array<float,2>{0.280655682f, 0.179731235f},
-std::array<float,2>{0.538239419f, 0.866375566f},
-std::array<float,2>{0.380319029f, 0.88962853f},
-std::array<float,2>{0.730991185f, 0.0425204746f},
-std::array<float,2>{0.0797738135f, 0.349436074f},
-std::array<float,2>{0.849556684f, 0.593440831f},
-std::array<float,2>{0.214126289f, 0.99203825f},
-std::array<float,2>{0.958448172f, 0.124079272f},
-std::array<float,2>{0.320957959f, 0.262869149f},
-std::array<float,2>{0.587292671f, 0.532543898f},
-std::array<float,2>{0.484108895f, 0.702985048f},
-std::array<float,2>{0.636077285f, 0.494692624f},
-std::array<float,2>{0.0623154752f, 0.18804422f},
-std::array<float,2>{0.793820977f, 0.768700004f},
-std::array<float,2>{0.122130208f, 0.621761799f},
-std::array<float,2>{0.819515228f, 0.315195709f},
-std::array<float,2>{0.413778186f, 0.00941479392f},
-std::array<float,2>{0.691739202f, 0.928628862f},
-std::array<float,2>{0.31101796f, 0.838334978f},
-std::array<float,2>{0.513692379f, 0.148559928f},
-std::array<float,2>{0.169669494f, 0.411941111f},
-std::array<float,2>{0.891520858f, 0.662608922f},
-std::array<float,2>{0.241047576f, 0.779058576f},
-std::array<float,2>{0.979104578f, 0.199343115f},
-std::array<float,2>{0.356103241f, 0.487222761f},
-std::array<float,2>{0.601762354f, 0.692844629f},
-std::array<float,2>{0.452421248f, 0.542905331f},
-std::array<float,2>{0.670416474f, 0.256702721f},
-std::array<float,2>{0.00302969222f, 0.109888285f},
-std::array<float,2>{0.766565323f, 0.995715201f},
-std::array<float,2>{0.0870598927f, 0.671814322f},
-std::array<float,2>{0.851968348f, 0.419833213f},
-std::array<float,2>{0.383575797f, 0.144596964f},
-std::array<float,2>{0.722199261f, 0.83071667f},
-std::array<float,2>{0.267555714f, 0.935022414f},
-std::array<float,2>{0.54318893f, 0.00587501889f},
-std::array<float,2>{0.155085504f, 0.323277742f},
-std::array<float,2>{0.923058093f, 0.613608897f},
-std::array<float,2>{0.0524900109f, 0.967030406f},
-std::array<float,2>{0.78352505f, 0.0646696016f},
-std::array<float,2>{0.473528862f, 0.292487741f},
-std::array<float,2>{0.628008962f, 0.52239424f},
-std::array<float,2>{0.317907959f, 0.732365549f},
-std::array<float,2>{0.579199374f, 0.45487237f},
-std::array<float,2>{0.210721791f, 0.241373494f},
-std::array<float,2>{0.966803432f, 0.808229566f},
-std::array<float,2>{0.163509101f, 0.579879045f},
-std::array<float,2>{0.90409857f, 0.355915725f},
-std::array<float,2>{0.298009634f, 0.0358773991f},
-std::array<float,2>{0.502629578f, 0.876089215f},
-std::array<float,2>{0.421827316f, 0.872129977f},
-std::array<float,2>{0.702504754f, 0.173731565f},
-std::array<float,2>{0.113954745f, 0.398103565f},
-std::array<float,2>{0.824358821f, 0.627137542f},
-std::array<float,2>{0.0987964794f, 0.822124064f},
-std::array<float,2>{0.840472221f, 0.128950372f},
-std::array<float,2>{0.435762614f, 0.428794026f},
-std::array<float,2>{0.712812066f, 0.68124336f},
-std::array<float,2>{0.290047467f, 0.608246863f},
-std::array<float,2>{0.530672729f, 0.337025851f},
-std::array<float,2>{0.185108796f, 0.0311582964f},
-std::array<float,2>{0.879080117f, 0.921305597f},
-std::array<float,2>{0.200000539f, 0.717808843f},
-std::array<float,2>{0.948465645f, 0.470482469f},
-std::array<float,2>{0.332470924f, 0.214543596f},
-std::array<float,2>{0.570848167f, 0.755783975f},
-std::array<float,2>{0.48937121f, 0.969110906f},
-std::array<float,2>{0.641541481f, 0.0995148495f},
-std::array<float,2>{0.0424067453f, 0.269637734f},
-std::array<float,2>{0.797924697f, 0.560958624f},
-std::array<float,2>{0.134354725f, 0.905337393f},
-std::array<float,2>{0.909753323f, 0.0497737788f},
-std::array<float,2>{0.253666312f, 0.370848447f},
-std::array<float,2>{0.555029035f, 0.575563073f},
-std::array<float,2>{0.396046758f, 0.646951556f},
-std::array<float,2>{0.741734087f, 0.380423665f},
-std::array<float,2>{0.0781035423f, 0.165267467f},
-std::array<float,2>{0.873177707f, 0.84878391f},
-std::array<float,2>{0.0284354631f, 0.514422178f},
-std::array<float,2>{0.76141566f, 0.298855633f},
-std::array<float,2>{0.458347142f, 0.0800686479f},
-std::array<float,2>{0.683500469f, 0.939987063f},
-std::array<float,2>{0.370516628f, 0.78295213f},
-std::array<float,2>{0.614115596f, 0.230052352f},
-std::array<float,2>{0.229417145f, 0.452351153f},
-std::array<float,2>{0.988776088f, 0.741304457f},
-std::array<float,2>{0.192228809f, 0.834212184f},
-std::array<float,2>{0.944632173f, 0.143781736f},
-std::array<float,2>{0.343029767f, 0.414344281f},
-std::array<float,2>{0.56330514f, 0.667071521f},
-std::array<float,2>{0.498638719f, 0.610187113f},
-std::array<float,2>{0.649729371f, 0.325462013f},
-std::array<float,2>{0.0345975347f, 0.000203591611f},
-std::array<float,2>{0.809102416f, 0.932970226f},
-std::array<float,2>{0.107516401f, 0.690332532f},
-std::array<float,2>{0.829758227f, 0.491438061f},
-std::array<float,2>{0.422014832f, 0.198283285f},
-std::array<float,2>{0.703483999f, 0.776703596f},
-std::array<float,2>{0.283518016f, 0.997510016f},
-std::array<float,2>{0.520639598f, 0.116032675f},
-std::array<float,2>{0.174674109f, 0.250938177f},
-std::array<float,2>{0.888548851f, 0.544643581f},
-std::array<float,2>{0.0174978077f, 0.880679011f},
-std::array<float,2>{0.757665694f, 0.0347841233f},
-std::array<float,2>{0.464756578f, 0.352190197f},
-std::array<float,2>{0.678635955f, 0.583847463f},
-std::array<float,2>{0.365799814f, 0.631056428f},
-std::array<float,2>{0.620120168f, 0.39328742f},
-std::array<float,2>{0.226366788f, 0.179439992f},
-std::array<float,2>{0.996748149f, 0.867269874f},
-std::array<float,2>{0.127783492f, 0.518308401f},
-std::array<float,2>{0.919513583f, 0.294844925f},
-std::array<float,2>{0.259855926f, 0.0702822953f},
-std::array<float,2>{0.551792681f, 0.963588357f},
-std::array<float,2>{0.402658969f, 0.809947312f},
-std::array<float,2>{0.747626185f, 0.234669879f},
-std::array<float,2>{0.0630535185f, 0.458998561f},
-std::array<float,2>{0.862217188f, 0.727784574f},
-std::array<float,2>{0.0847161412f, 0.751013994f},
-std::array<float,2>{0.844038069f, 0.215975091f},
-std::array<float,2>{0.375253022f, 0.475029528f},
-std::array<float,2>{0.728801429f, 0.713636398f},
-std::array<float,2>{0.277001411f, 0.555947602f},
-std::array<float,2>{0.533409834f, 0.269497424f},
-std::array<float,2>{0.144981787f, 0.0946026221f},
-std::array<float,2>{0.935203016f, 0.972936749f},
-std::array<float,2>{0.244479209f, 0.684299529f},
-std::array<float,2>{0.97458142f, 0.423102617f},
-std::array<float,2>{0.350331634f, 0.127409831f},
-std::array<float,2>{0.599555671f, 0.824273229f},
-std::array<float,2>{0.445177436f, 0.914517403f},
-std::array<float,2>{0.657411635f, 0.0234479047f},
-std::array<float,2>{0.0110138748f, 0.341032892f},
-std::array<float,2>{0.780380905f, 0.604531825f},
-std::array<float,2>{0.166303679f, 0.944477439f},
-std::array<float,2>{0.896188974f, 0.0829758793f},
-std::array<float,2>{0.307410002f, 0.301819623f},
-std::array<float,2>{0.508516908f, 0.509976625f},
-std::array<float,2>{0.408891708f, 0.737521291f},
-std::array<float,2>{0.688037574f, 0.44581458f},
-std::array<float,2>{0.118711531f, 0.232990876f},
-std::array<float,2>{0.814087629f, 0.787544012f},
-std::array<float,2>{0.0572341941f, 0.573786795f},
-std::array<float,2>{0.789183199f, 0.372118086f},
-std::array<float,2>{0.476754785f, 0.0543868206f},
-std::array<float,2>{0.639899492f, 0.900363505f},
-std::array<float,2>{0.324602813f, 0.846159816f},
-std::array<float,2>{0.592406511f, 0.169931576f},
-std::array<float,2>{0.216938287f, 0.376998276f},
-std::array<float,2>{0.956890404f, 0.643864572f},
-std::array<float,2>{0.152206242f, 0.790013611f},
-std::array<float,2>{0.926392138f, 0.225711375f},
-std::array<float,2>{0.273200303f, 0.441701323f},
-std::array<float,2>{0.541686594f, 0.746526241f},
-std::array<float,2>{0.387443185f, 0.50722456f},
-std::array<float,2>{0.723199248f, 0.307307839f},
-std::array<float,2>{0.0933140293f, 0.0862919316f},
-std::array<float,2>{0.858255267f, 0.946564913f},
-std::array<float,2>{0.00762645621f, 0.648607075f},
-std::array<float,2>{0.772077858f, 0.389173567f},
-std::array<float,2>{0.448480964f, 0.157362476f},
-std::array<float,2>{0.665038943f, 0.8521626f},
-std::array<float,2>{0.354310811f, 0.891220152f},
-std::array<float,2>{0.607660472f, 0.0549147651f},
-std::array<float,2>{0.236281052f, 0.365599006f},
-std::array<float,2>{0.981850505f, 0.565703452f},
-std::array<float,2>{0.112421006f, 0.976895213f},
-std::array<float,2>{0.820461571f, 0.104807697f},
-std::array<float,2>{0.416949958f, 0.277793288f},
-std::array<float,2>{0.6980474f, 0.553623736f},
-std::array<float,2>{0.30466482f, 0.710522711f},
-std::array<float,2>{0.503981769f, 0.479866296f},
-std::array<float,2>{0.157325298f, 0.204480901f},
-std::array<float,2>{0.901067078f, 0.758475363f},
-std::array<float,2>{0.205797151f, 0.600256443f},
-std::array<float,2>{0.962510407f, 0.328523219f},
-std::array<float,2>{0.313457787f, 0.0162723958f},
-std::array<float,2>{0.585510254f, 0.906493843f},
-std::array<float,2>{0.469052851f, 0.814898968f},
-std::array<float,2>{0.632102549f, 0.135466427f},
-std::array<float,2>{0.0499795862f, 0.431271136f},
-std::array<float,2>{0.787397921f, 0.67471981f},
-std::array<float,2>{0.0464075468f, 0.860639155f},
-std::array<float,2>{0.802604973f, 0.186386615f},
-std::array<float,2>{0.485631973f, 0.400673181f},
-std::array<float,2>{0.644919157f, 0.634718537f},
-std::array<float,2>{0.330628633f, 0.589657664f},
-std::array<float,2>{0.574985206f, 0.347130477f},
-std::array<float,2>{0.198658779f, 0.0467432402f},
-std::array<float,2>{0.952764153f, 0.883899212f},
-std::array<float,2>{0.180995256f, 0.72093302f},
-std::array<float,2>{0.875953972f, 0.466249287f},
-std::array<float,2>{0.294477344f, 0.244440764f},
-std::array<float,2>{0.526875019f, 0.801594794f},
-std::array<float,2>{0.432263672f, 0.958756864f},
-std::array<float,2>{0.71756041f, 0.0725801066f},
-std::array<float,2>{0.0946886912f, 0.288794398f},
-std::array<float,2>{0.837219059f, 0.530668437f},
-std::array<float,2>{0.234073088f, 0.92279309f},
-std::array<float,2>{0.98754555f, 0.0146662798f},
-std::array<float,2>{0.372988611f, 0.317693293f},
-std::array<float,2>{0.610971332f, 0.61969918f},
-std::array<float,2>{0.455046862f, 0.659679949f},
-std::array<float,2>{0.686741292f, 0.407023132f},
-std::array<float,2>{0.0264619291f, 0.153887287f},
-std::array<float,2>{0.764266551f, 0.839866519f},
-std::array<float,2>{0.0728377774f, 0.537203491f},
-std::array<float,2>{0.870023727f, 0.259230375f},
-std::array<float,2>{0.392932445f, 0.11771705f},
-std::array<float,2>{0.735249341f, 0.984536886f},
-std::array<float,2>{0.256716609f, 0.770397067f},
-std::array<float,2>{0.560229361f, 0.191967681f},
-std::array<float,2>{0.139875591f, 0.496861637f},
-std::array<float,2>{0.913071036f, 0.697807729f}}
\ No newline at end of file
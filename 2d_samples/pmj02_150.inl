@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.941298068f, 0.772987008f},
-std::array<float,2>{0.294422299f, 0.139702857f},
-std::array<float,2>{0.500705898f, 0.278050601f},
-std::array<float,2>{0.0573200397f, 0.611680031f},
-std::array<float,2>{0.701105714f, 0.693814933f},
-std::array<float,2>{0.190219641f, 0.48168993f},
-std::array<float,2>{0.817260325f, 0.0794529095f},
-std::array<float,2>{0.38218987f, 0.902035952f},
-std::array<float,2>{0.809746385f, 0.504062891f},
-std::array<float,2>{0.490859807f, 0.326875895f},
-std::array<float,2>{0.678288102f, 0.244328529f},
-std::array<float,2>{0.170703262f, 0.832505107f},
-std::array<float,2>{0.619185925f, 0.990448415f},
-std::array<float,2>{0.101396233f, 0.0609363727f},
-std::array<float,2>{0.917621851f, 0.414286405f},
-std::array<float,2>{0.329023838f, 0.639499068f},
-std::array<float,2>{0.846893847f, 0.916658282f},
-std::array<float,2>{0.409083515f, 0.0961187109f},
-std::array<float,2>{0.719815791f, 0.468460709f},
-std::array<float,2>{0.22590746f, 0.726498842f},
-std::array<float,2>{0.53404212f, 0.589451551f},
-std::array<float,2>{0.015669059f, 0.298558235f},
-std::array<float,2>{0.986048043f, 0.183116376f},
-std::array<float,2>{0.278692901f, 0.796179652f},
-std::array<float,2>{0.880836487f, 0.664791346f},
-std::array<float,2>{0.361992449f, 0.378732204f},
-std::array<float,2>{0.565485537f, 0.0297776293f},
-std::array<float,2>{0.0783455521f, 0.955011368f},
-std::array<float,2>{0.632955968f, 0.86056006f},
-std::array<float,2>{0.138904199f, 0.218278885f},
-std::array<float,2>{0.764194906f, 0.357385725f},
-std::array<float,2>{0.444885403f, 0.551651061f},
-std::array<float,2>{0.77609688f, 0.820400894f},
-std::array<float,2>{0.458105266f, 0.232652187f},
-std::array<float,2>{0.650597513f, 0.342654765f},
-std::array<float,2>{0.155905828f, 0.521706581f},
-std::array<float,2>{0.58853668f, 0.64602828f},
-std::array<float,2>{0.0634557009f, 0.425849319f},
-std::array<float,2>{0.893803775f, 0.0465902276f},
-std::array<float,2>{0.34419477f, 0.973576844f},
-std::array<float,2>{0.970706761f, 0.596509278f},
-std::array<float,2>{0.250835627f, 0.261031926f},
-std::array<float,2>{0.554139376f, 0.153913513f},
-std::array<float,2>{0.000810752332f, 0.763768613f},
-std::array<float,2>{0.744739234f, 0.889850199f},
-std::array<float,2>{0.249862105f, 0.0631953627f},
-std::array<float,2>{0.872215748f, 0.491812944f},
-std::array<float,2>{0.429844916f, 0.7103917f},
-std::array<float,2>{0.923300326f, 0.949665725f},
-std::array<float,2>{0.325440675f, 0.011427775f},
-std::array<float,2>{0.60437721f, 0.393364727f},
-std::array<float,2>{0.111938849f, 0.680821061f},
-std::array<float,2>{0.658010006f, 0.544417977f},
-std::array<float,2>{0.180425197f, 0.365958422f},
-std::array<float,2>{0.786251187f, 0.193569005f},
-std::array<float,2>{0.48395443f, 0.85749048f},
-std::array<float,2>{0.840892315f, 0.7417261f},
-std::array<float,2>{0.401728988f, 0.442097276f},
-std::array<float,2>{0.711621225f, 0.118966639f},
-std::array<float,2>{0.213349909f, 0.93204689f},
-std::array<float,2>{0.53116405f, 0.799400866f},
-std::array<float,2>{0.0345323905f, 0.160278514f},
-std::array<float,2>{0.953993022f, 0.290076852f},
-std::array<float,2>{0.298484117f, 0.570903659f},
-std::array<float,2>{0.901110351f, 0.848046243f},
-std::array<float,2>{0.35171783f, 0.199599266f},
-std::array<float,2>{0.585501492f, 0.371646672f},
-std::array<float,2>{0.0727173164f, 0.533462882f},
-std::array<float,2>{0.642720222f, 0.674277544f},
-std::array<float,2>{0.145524874f, 0.40551278f},
-std::array<float,2>{0.769651353f, 0.00615987973f},
-std::array<float,2>{0.466958493f, 0.941746533f},
-std::array<float,2>{0.864577711f, 0.563328266f},
-std::array<float,2>{0.425836414f, 0.287882537f},
-std::array<float,2>{0.741134763f, 0.165035784f},
-std::array<float,2>{0.241615772f, 0.806546688f},
-std::array<float,2>{0.556460917f, 0.926052034f},
-std::array<float,2>{0.0107888523f, 0.111794069f},
-std::array<float,2>{0.984201491f, 0.448621035f},
-std::array<float,2>{0.260697216f, 0.745684981f},
-std::array<float,2>{0.792172611f, 0.983885288f},
-std::array<float,2>{0.473596543f, 0.0339834057f},
-std::array<float,2>{0.67075932f, 0.433488399f},
-std::array<float,2>{0.179678276f, 0.653248727f},
-std::array<float,2>{0.599599838f, 0.524858594f},
-std::array<float,2>{0.117517851f, 0.333539009f},
-std::array<float,2>{0.934585094f, 0.223777071f},
-std::array<float,2>{0.313896447f, 0.819720328f},
-std::array<float,2>{0.96808064f, 0.712566972f},
-std::array<float,2>{0.308572769f, 0.492446303f},
-std::array<float,2>{0.517913938f, 0.0743895546f},
-std::array<float,2>{0.0406524464f, 0.875782788f},
-std::array<float,2>{0.709459007f, 0.753947496f},
-std::array<float,2>{0.205589503f, 0.141677618f},
-std::array<float,2>{0.834854186f, 0.250970215f},
-std::array<float,2>{0.393316299f, 0.604690015f},
-std::array<float,2>{0.827853382f, 0.787051678f},
-std::array<float,2>{0.38682726f, 0.176369578f},
-std::array<float,2>{0.694932818f, 0.311850011f},
-std::array<float,2>{0.197304636f, 0.5803262f},
-std::array<float,2>{0.511286855f, 0.729528546f},
-std::array<float,2>{0.0483247526f, 0.455940872f},
-std::array<float,2>{0.949140787f, 0.105297692f},
-std::array<float,2>{0.285929561f, 0.907910943f},
-std::array<float,2>{0.90956521f, 0.558237374f},
-std::array<float,2>{0.342937499f, 0.348181605f},
-std::array<float,2>{0.615883946f, 0.209927276f},
-std::array<float,2>{0.107690722f, 0.868981361f},
-std::array<float,2>{0.681436598f, 0.967531562f},
-std::array<float,2>{0.158378214f, 0.0213604718f},
-std::array<float,2>{0.801247656f, 0.383875102f},
-std::array<float,2>{0.496949315f, 0.662091851f},
-std::array<float,2>{0.999289155f, 0.896193087f},
-std::array<float,2>{0.269038796f, 0.0886302888f},
-std::array<float,2>{0.544092238f, 0.473182857f},
-std::array<float,2>{0.0250622109f, 0.696806073f},
-std::array<float,2>{0.729366362f, 0.618082404f},
-std::array<float,2>{0.227105588f, 0.271350443f},
-std::array<float,2>{0.852101743f, 0.131765291f},
-std::array<float,2>{0.41672498f, 0.781135023f},
-std::array<float,2>{0.753497541f, 0.632172287f},
-std::array<float,2>{0.449703068f, 0.407248795f},
-std::array<float,2>{0.626419902f, 0.0491881482f},
-std::array<float,2>{0.12911427f, 0.994868934f},
-std::array<float,2>{0.576424479f, 0.842226684f},
-std::array<float,2>{0.0883685052f, 0.23841849f},
-std::array<float,2>{0.889536202f, 0.317221701f},
-std::array<float,2>{0.37300539f, 0.511630356f},
-std::array<float,2>{0.977520883f, 0.830082476f},
-std::array<float,2>{0.265038371f, 0.24897556f},
-std::array<float,2>{0.560197234f, 0.321861267f},
-std::array<float,2>{0.0145291155f, 0.503652275f},
-std::array<float,2>{0.736697018f, 0.633001447f},
-std::array<float,2>{0.235506535f, 0.418086946f},
-std::array<float,2>{0.861926734f, 0.0551613681f},
-std::array<float,2>{0.424072891f, 0.98827368f},
-std::array<float,2>{0.766781509f, 0.614130378f},
-std::array<float,2>{0.464424372f, 0.274502873f},
-std::array<float,2>{0.646969736f, 0.136378288f},
-std::array<float,2>{0.144455254f, 0.768212736f},
-std::array<float,2>{0.579892993f, 0.902710736f},
-std::array<float,2>{0.0760473758f, 0.0836718008f},
-std::array<float,2>{0.905673385f, 0.478531569f},
-std::array<float,2>{0.355813205f, 0.691008806f},
-std::array<float,2>{0.831017613f, 0.957812309f},
-std::array<float,2>{0.394704878f, 0.0258410852f},
-std::array<float,2>{0.703687072f, 0.380268902f},
-std::array<float,2>{0.208643556f, 0.6688748f},
-std::array<float,2>{0.522428989f, 0.548991442f},
-std::array<float,2>{0.0433853604f, 0.354396254f},
-std::array<float,2>{0.961292148f, 0.212936103f},
-std::array<float,2>{0.309638679f, 0.866141677f},
-std::array<float,2>{0.93247658f, 0.722541094f},
-std::array<float,2>{0.316455066f, 0.464085281f},
-std::array<float,2>{0.594623268f, 0.100988567f},
-std::array<float,2>{0.124503486f, 0.920957565f},
-std::array<float,2>{0.6667853f, 0.791065574f},
-std::array<float,2>{0.174079388f, 0.186906368f},
-std::array<float,2>{0.794127762f, 0.301709294f},
-std::array<float,2>{0.470390201f, 0.590364158f},
-std::array<float,2>{0.80062604f, 0.758333266f},
-std::array<float,2>{0.492435724f, 0.151132375f},
-std::array<float,2>{0.68676585f, 0.264296502f},
-std::array<float,2>{0.162321582f, 0.600647748f},
-std::array<float,2>{0.609897435f, 0.706643879f},
-std::array<float,2>{0.10526669f, 0.485040575f},
-std::array<float,2>{0.910879433f, 0.0685865134f},
-std::array<float,2>{0.339424312f, 0.88447988f},
-std::array<float,2>{0.95310992f, 0.516467512f},
-std::array<float,2>{0.285044253f, 0.338802487f},
-std::array<float,2>{0.515563905f, 0.227120981f},
-std::array<float,2>{0.0524349362f, 0.827131867f},
-std::array<float,2>{0.690475702f, 0.971577823f},
-std::array<float,2>{0.199358061f, 0.0425933823f},
-std::array<float,2>{0.823504746f, 0.424311489f},
-std::array<float,2>{0.384562016f, 0.642313421f},
-std::array<float,2>{0.886245787f, 0.934232116f},
-std::array<float,2>{0.369393945f, 0.122852668f},
-std::array<float,2>{0.57184422f, 0.438743621f},
-std::array<float,2>{0.0924155265f, 0.737539113f},
-std::array<float,2>{0.631317973f, 0.576688349f},
-std::array<float,2>{0.128864288f, 0.295642674f},
-std::array<float,2>{0.755405307f, 0.157794833f},
-std::array<float,2>{0.445650399f, 0.802882791f},
-std::array<float,2>{0.858940303f, 0.685275733f},
-std::array<float,2>{0.419424862f, 0.397428364f},
-std::array<float,2>{0.733321607f, 0.0145367486f},
-std::array<float,2>{0.232062295f, 0.947414279f},
-std::array<float,2>{0.541648805f, 0.852124095f},
-std::array<float,2>{0.0275887307f, 0.191099793f},
-std::array<float,2>{0.994030654f, 0.362837642f},
-std::array<float,2>{0.2705203f, 0.539237022f},
-std::array<float,2>{0.918293297f, 0.812230408f},
-std::array<float,2>{0.332319081f, 0.170127735f},
-std::array<float,2>{0.624349654f, 0.285039574f},
-std::array<float,2>{0.0962394252f, 0.567273796f},
-std::array<float,2>{0.67417568f, 0.747901976f},
-std::array<float,2>{0.165855438f, 0.452837735f},
-std::array<float,2>{0.805790484f, 0.114151366f},
-std::array<float,2>{0.486045539f, 0.924083591f},
-std::array<float,2>{0.812990606f, 0.535432398f},
-std::array<float,2>{0.376425892f, 0.36865437f},
-std::array<float,2>{0.698258042f, 0.19703342f},
-std::array<float,2>{0.193422079f, 0.847091019f},
-std::array<float,2>{0.506975174f, 0.938135684f},
-std::array<float,2>{0.05968564f, 0.00210642209f},
-std::array<float,2>{0.944706023f, 0.400183648f},
-std::array<float,2>{0.289638191f, 0.678683162f},
-std::array<float,2>{0.75849396f, 0.87959075f},
-std::array<float,2>{0.438285351f, 0.0704957992f},
-std::array<float,2>{0.640244961f, 0.497595429f},
-std::array<float,2>{0.135748222f, 0.717769802f},
-std::array<float,2>{0.569188595f, 0.609103024f},
-std::array<float,2>{0.0847033262f, 0.257580668f},
-std::array<float,2>{0.876577079f, 0.14489831f},
-std::array<float,2>{0.365462095f, 0.752068698f},
-std::array<float,2>{0.990441501f, 0.651854038f},
-std::array<float,2>{0.274153531f, 0.437259287f},
-std::array<float,2>{0.535816491f, 0.0370278172f},
-std::array<float,2>{0.021679379f, 0.980124474f},
-std::array<float,2>{0.72590971f, 0.812564015f},
-std::array<float,2>{0.219265535f, 0.221806377f},
-std::array<float,2>{0.850353897f, 0.328800052f},
-std::array<float,2>{0.411679327f, 0.530644f},
-std::array<float,2>{0.868049979f, 0.872776091f},
-std::array<float,2>{0.436569959f, 0.205624357f},
-std::array<float,2>{0.74695915f, 0.346128851f},
-std::array<float,2>{0.244197056f, 0.562170088f},
-std::array<float,2>{0.54872334f, 0.658692598f},
-std::array<float,2>{0.00435548415f, 0.389597088f},
-std::array<float,2>{0.975977898f, 0.0191504788f},
-std::array<float,2>{0.257634431f, 0.962873876f},
-std::array<float,2>{0.89583981f, 0.583687663f},
-std::array<float,2>{0.350802988f, 0.305538356f},
-std::array<float,2>{0.591863334f, 0.172416732f},
-std::array<float,2>{0.0700650215f, 0.784344196f},
-std::array<float,2>{0.654964507f, 0.912904024f},
-std::array<float,2>{0.14870204f, 0.107693054f},
-std::array<float,2>{0.78083235f, 0.458774984f},
-std::array<float,2>{0.454253793f, 0.733527362f},
-std::array<float,2>{0.960646808f, 0.996617913f},
-std::array<float,2>{0.302290946f, 0.0507861339f},
-std::array<float,2>{0.524505556f, 0.410808444f},
-std::array<float,2>{0.0386841558f, 0.625446618f},
-std::array<float,2>{0.715846539f, 0.514420152f},
-std::array<float,2>{0.215729967f, 0.314186871f},
-std::array<float,2>{0.838457525f, 0.235764101f},
-std::array<float,2>{0.404683679f, 0.837980568f},
-std::array<float,2>{0.782240629f, 0.700698793f},
-std::array<float,2>{0.477254719f, 0.47155422f},
-std::array<float,2>{0.662542522f, 0.0900994912f},
-std::array<float,2>{0.184807211f, 0.89337492f},
-std::array<float,2>{0.609372199f, 0.774808586f},
-std::array<float,2>{0.116628662f, 0.127892867f},
-std::array<float,2>{0.928732634f, 0.26912868f},
-std::array<float,2>{0.320454717f, 0.624966204f},
-std::array<float,2>{0.986365497f, 0.793949664f},
-std::array<float,2>{0.281243563f, 0.180188954f},
-std::array<float,2>{0.532941341f, 0.300542504f},
-std::array<float,2>{0.0190240908f, 0.587099493f},
-std::array<float,2>{0.722175837f, 0.723170638f},
-std::array<float,2>{0.223670632f, 0.465315521f},
-std::array<float,2>{0.845168591f, 0.0943074226f},
-std::array<float,2>{0.406632692f, 0.915602148f},
-std::array<float,2>{0.762953103f, 0.553308904f},
-std::array<float,2>{0.442074776f, 0.357674986f},
-std::array<float,2>{0.635696948f, 0.215767696f},
-std::array<float,2>{0.138043642f, 0.862732768f},
-std::array<float,2>{0.563317418f, 0.955474019f},
-std::array<float,2>{0.0811682791f, 0.0285300799f},
-std::array<float,2>{0.882737637f, 0.375800252f},
-std::array<float,2>{0.360810131f, 0.667383432f},
-std::array<float,2>{0.818785608f, 0.899674654f},
-std::array<float,2>{0.379973292f, 0.081196174f},
-std::array<float,2>{0.702084839f, 0.483342409f},
-std::array<float,2>{0.188417077f, 0.692673981f},
-std::array<float,2>{0.502332211f, 0.610917091f},
-std::array<float,2>{0.0553901084f, 0.280066341f},
-std::array<float,2>{0.93800199f, 0.137467623f},
-std::array<float,2>{0.295496821f, 0.770200729f},
-std::array<float,2>{0.914599478f, 0.638058126f},
-std::array<float,2>{0.330993861f, 0.417501897f},
-std::array<float,2>{0.618126631f, 0.0587748289f},
-std::array<float,2>{0.0989501998f, 0.988519311f},
-std::array<float,2>{0.676795244f, 0.834709048f},
-std::array<float,2>{0.168907642f, 0.242452592f},
-std::array<float,2>{0.812236905f, 0.325203896f},
-std::array<float,2>{0.489718795f, 0.506536067f},
-std::array<float,2>{0.788690984f, 0.855780244f},
-std::array<float,2>{0.480701357f, 0.193349138f},
-std::array<float,2>{0.659139276f, 0.365035862f},
-std::array<float,2>{0.182427853f, 0.545518339f},
-std::array<float,2>{0.602278769f, 0.682528198f},
-std::array<float,2>{0.109591089f, 0.391029119f},
-std::array<float,2>{0.924208581f, 0.00935970433f},
-std::array<float,2>{0.32720843f, 0.951623023f},
-std::array<float,2>{0.956147552f, 0.573767006f},
-std::array<float,2>{0.300059855f, 0.292822093f},
-std::array<float,2>{0.528041124f, 0.163171098f},
-std::array<float,2>{0.0329843089f, 0.797849357f},
-std::array<float,2>{0.714452088f, 0.930566311f},
-std::array<float,2>{0.212687165f, 0.120884523f},
-std::array<float,2>{0.842680991f, 0.444274038f},
-std::array<float,2>{0.399642706f, 0.739620388f},
-std::array<float,2>{0.89116019f, 0.976035297f},
-std::array<float,2>{0.345877349f, 0.0439551063f},
-std::array<float,2>{0.58686471f, 0.42950049f},
-std::array<float,2>{0.065408051f, 0.647876322f},
-std::array<float,2>{0.64892f, 0.521083176f},
-std::array<float,2>{0.152345881f, 0.340788335f},
-std::array<float,2>{0.774490595f, 0.232206464f},
-std::array<float,2>{0.460460633f, 0.823713839f},
-std::array<float,2>{0.873526692f, 0.708339393f},
-std::array<float,2>{0.431975424f, 0.489071548f},
-std::array<float,2>{0.742530346f, 0.0658170506f},
-std::array<float,2>{0.246279031f, 0.88782239f},
-std::array<float,2>{0.550822139f, 0.763542354f},
-std::array<float,2>{0.00223207544f, 0.155481309f},
-std::array<float,2>{0.969176888f, 0.259590715f},
-std::array<float,2>{0.252279252f, 0.593947589f},
-std::array<float,2>{0.937133133f, 0.816975296f},
-std::array<float,2>{0.315236777f, 0.225196496f},
-std::array<float,2>{0.600912631f, 0.334996819f},
-std::array<float,2>{0.119913772f, 0.526527166f},
-std::array<float,2>{0.668648124f, 0.655313134f},
-std::array<float,2>{0.176759854f, 0.430746913f},
-std::array<float,2>{0.790426791f, 0.0329567716f},
-std::array<float,2>{0.475594401f, 0.980819225f},
-std::array<float,2>{0.833730221f, 0.602859437f},
-std::array<float,2>{0.391940624f, 0.252480626f},
-std::array<float,2>{0.708772123f, 0.143018246f},
-std::array<float,2>{0.204976365f, 0.756974995f},
-std::array<float,2>{0.516201079f, 0.878140092f},
-std::array<float,2>{0.0428692624f, 0.0775559023f},
-std::array<float,2>{0.965689242f, 0.494166166f},
-std::array<float,2>{0.30478394f, 0.713428438f},
-std::array<float,2>{0.771839261f, 0.944728613f},
-std::array<float,2>{0.466404021f, 0.00530118914f},
-std::array<float,2>{0.641215444f, 0.403965026f},
-std::array<float,2>{0.146812409f, 0.672362387f},
-std::array<float,2>{0.583806932f, 0.532068789f},
-std::array<float,2>{0.0716791078f, 0.373913944f},
-std::array<float,2>{0.899815738f, 0.201736599f},
-std::array<float,2>{0.35354048f, 0.849945664f},
-std::array<float,2>{0.980979145f, 0.742759585f},
-std::array<float,2>{0.259216964f, 0.447257519f},
-std::array<float,2>{0.556741953f, 0.111140974f},
-std::array<float,2>{0.00868462864f, 0.928032041f},
-std::array<float,2>{0.739129722f, 0.806976855f},
-std::array<float,2>{0.239634603f, 0.166199535f},
-std::array<float,2>{0.866230667f, 0.286454886f},
-std::array<float,2>{0.429116935f, 0.564903736f},
-std::array<float,2>{0.854646564f, 0.779143274f},
-std::array<float,2>{0.41558063f, 0.129622996f},
-std::array<float,2>{0.727092624f, 0.272330463f},
-std::array<float,2>{0.228677958f, 0.621017933f},
-std::array<float,2>{0.546640337f, 0.697301745f},
-std::array<float,2>{0.0272474624f, 0.475664586f},
-std::array<float,2>{0.996707857f, 0.0870042369f},
-std::array<float,2>{0.266630381f, 0.897782266f},
-std::array<float,2>{0.887847245f, 0.507925928f},
-std::array<float,2>{0.373875707f, 0.319831252f},
-std::array<float,2>{0.575756907f, 0.240545943f},
-std::array<float,2>{0.0861350149f, 0.840456605f},
-std::array<float,2>{0.628413141f, 0.992545128f},
-std::array<float,2>{0.132736042f, 0.0482517406f},
-std::array<float,2>{0.750774801f, 0.409653753f},
-std::array<float,2>{0.451920092f, 0.630263984f},
-std::array<float,2>{0.945852101f, 0.909308553f},
-std::array<float,2>{0.288343251f, 0.103170715f},
-std::array<float,2>{0.509214103f, 0.454511851f},
-std::array<float,2>{0.0494805276f, 0.726861238f},
-std::array<float,2>{0.691747069f, 0.578772306f},
-std::array<float,2>{0.195720717f, 0.308595359f},
-std::array<float,2>{0.824998498f, 0.178274527f},
-std::array<float,2>{0.389673531f, 0.787656665f},
-std::array<float,2>{0.803893447f, 0.662997186f},
-std::array<float,2>{0.498651177f, 0.385696024f},
-std::array<float,2>{0.683555961f, 0.0230595432f},
-std::array<float,2>{0.15734753f, 0.966173589f},
-std::array<float,2>{0.613328397f, 0.869217753f},
-std::array<float,2>{0.105474055f, 0.207339868f},
-std::array<float,2>{0.906865597f, 0.351209283f},
-std::array<float,2>{0.340431482f, 0.555243552f},
-std::array<float,2>{0.963874698f, 0.864125907f},
-std::array<float,2>{0.31087333f, 0.21180959f},
-std::array<float,2>{0.520937443f, 0.353205293f},
-std::array<float,2>{0.0450056195f, 0.547363341f},
-std::array<float,2>{0.705315053f, 0.671816766f},
-std::array<float,2>{0.210162729f, 0.382457227f},
-std::array<float,2>{0.829343259f, 0.024218034f},
-std::array<float,2>{0.397943914f, 0.960104942f},
-std::array<float,2>{0.796534598f, 0.592939794f},
-std::array<float,2>{0.471571475f, 0.304026872f},
-std::array<float,2>{0.664928138f, 0.1854323f},
-std::array<float,2>{0.173449337f, 0.790991306f},
-std::array<float,2>{0.596087158f, 0.919028282f},
-std::array<float,2>{0.122188859f, 0.0993114859f},
-std::array<float,2>{0.931092501f, 0.46269694f},
-std::array<float,2>{0.320306003f, 0.719359457f},
-std::array<float,2>{0.860069156f, 0.985036969f},
-std::array<float,2>{0.422416329f, 0.0575983003f},
-std::array<float,2>{0.73467958f, 0.42185244f},
-std::array<float,2>{0.236945704f, 0.636197984f},
-std::array<float,2>{0.561464965f, 0.500808597f},
-std::array<float,2>{0.013384115f, 0.322520554f},
-std::array<float,2>{0.979733407f, 0.247029841f},
-std::array<float,2>{0.262085646f, 0.82821238f},
-std::array<float,2>{0.903267622f, 0.688358903f},
-std::array<float,2>{0.358182669f, 0.47805655f},
-std::array<float,2>{0.581701934f, 0.084094815f},
-std::array<float,2>{0.0773831531f, 0.905854225f},
-std::array<float,2>{0.644990027f, 0.766499281f},
-std::array<float,2>{0.141686827f, 0.133298606f},
-std::array<float,2>{0.767769754f, 0.277037501f},
-std::array<float,2>{0.461913198f, 0.616578639f},
-std::array<float,2>{0.757733524f, 0.800993502f},
-std::array<float,2>{0.447523534f, 0.159233242f},
-std::array<float,2>{0.629127622f, 0.29358542f},
-std::array<float,2>{0.125840098f, 0.575467587f},
-std::array<float,2>{0.573238432f, 0.735176563f},
-std::array<float,2>{0.0904475003f, 0.440964431f},
-std::array<float,2>{0.883686066f, 0.123535633f},
-std::array<float,2>{0.368195504f, 0.936353803f},
-std::array<float,2>{0.994858265f, 0.541562498f},
-std::array<float,2>{0.271912128f, 0.361052573f},
-std::array<float,2>{0.540754437f, 0.189165249f},
-std::array<float,2>{0.0307858884f, 0.85542804f},
-std::array<float,2>{0.730774462f, 0.945881963f},
-std::array<float,2>{0.232732475f, 0.0120010013f},
-std::array<float,2>{0.855487645f, 0.395488501f},
-std::array<float,2>{0.421144694f, 0.686034083f},
-std::array<float,2>{0.913917303f, 0.885887861f},
-std::array<float,2>{0.3377482f, 0.066620566f},
-std::array<float,2>{0.611642241f, 0.486781448f},
-std::array<float,2>{0.1026778f, 0.703185499f},
-std::array<float,2>{0.684206188f, 0.599157691f},
-std::array<float,2>{0.161490902f, 0.263584048f},
-std::array<float,2>{0.798816383f, 0.149991497f},
-std::array<float,2>{0.494519323f, 0.759893894f},
-std::array<float,2>{0.821535289f, 0.644120336f},
-std::array<float,2>{0.386256188f, 0.423743486f},
-std::array<float,2>{0.688362539f, 0.0409118943f},
-std::array<float,2>{0.203073695f, 0.969469309f},
-std::array<float,2>{0.511757493f, 0.824533105f},
-std::array<float,2>{0.0540880002f, 0.228811294f},
-std::array<float,2>{0.950649679f, 0.337328404f},
-std::array<float,2>{0.282638043f, 0.519000709f},
-std::array<float,2>{0.877943277f, 0.750496626f},
-std::array<float,2>{0.36414364f, 0.146882191f},
-std::array<float,2>{0.566693306f, 0.254512995f},
-std::array<float,2>{0.0825308859f, 0.60647738f},
-std::array<float,2>{0.636909068f, 0.71622026f},
-std::array<float,2>{0.133571297f, 0.498219252f},
-std::array<float,2>{0.759838939f, 0.0740673468f},
-std::array<float,2>{0.439664751f, 0.882709086f},
-std::array<float,2>{0.84831959f, 0.527853489f},
-std::array<float,2>{0.412724465f, 0.331975162f},
-std::array<float,2>{0.723424315f, 0.219528675f},
-std::array<float,2>{0.221239284f, 0.816274464f},
-std::array<float,2>{0.53787452f, 0.97685039f},
-std::array<float,2>{0.0198758449f, 0.0372091085f},
-std::array<float,2>{0.988601565f, 0.434641868f},
-std::array<float,2>{0.276574522f, 0.650328875f},
-std::array<float,2>{0.806717455f, 0.923400819f},
-std::array<float,2>{0.487027258f, 0.115306601f},
-std::array<float,2>{0.672963202f, 0.449646235f},
-std::array<float,2>{0.167862475f, 0.748238325f},
-std::array<float,2>{0.622415602f, 0.568702221f},
-std::array<float,2>{0.0940378308f, 0.282029063f},
-std::array<float,2>{0.920591593f, 0.169697136f},
-std::array<float,2>{0.335543483f, 0.808949769f},
-std::array<float,2>{0.942090571f, 0.676082611f},
-std::array<float,2>{0.291434675f, 0.401266247f},
-std::array<float,2>{0.505097747f, 0.00108757487f},
-std::array<float,2>{0.0620278679f, 0.939658761f},
-std::array<float,2>{0.696862161f, 0.844648957f},
-std::array<float,2>{0.191877574f, 0.197824255f},
-std::array<float,2>{0.815444589f, 0.369390666f},
-std::array<float,2>{0.37862885f, 0.537425756f},
-std::array<float,2>{0.836536407f, 0.836919308f},
-std::array<float,2>{0.403836131f, 0.237045974f},
-std::array<float,2>{0.718427777f, 0.315126747f},
-std::array<float,2>{0.217651412f, 0.513082623f},
-std::array<float,2>{0.527255952f, 0.627689302f},
-std::array<float,2>{0.0369611569f, 0.41248557f},
-std::array<float,2>{0.957844973f, 0.0535595119f},
-std::array<float,2>{0.303551227f, 0.999364018f},
-std::array<float,2>{0.926180243f, 0.6215747f},
-std::array<float,2>{0.322382182f, 0.267007977f},
-std::array<float,2>{0.606503308f, 0.125428885f},
-std::array<float,2>{0.114321105f, 0.776071906f},
-std::array<float,2>{0.660290897f, 0.890725136f},
-std::array<float,2>{0.186845228f, 0.0926334113f},
-std::array<float,2>{0.783423662f, 0.470452756f},
-std::array<float,2>{0.478835404f, 0.702740729f},
-std::array<float,2>{0.974398077f, 0.963270426f},
-std::array<float,2>{0.254373729f, 0.0174893234f},
-std::array<float,2>{0.549400032f, 0.387420654f},
-std::array<float,2>{0.00694601331f, 0.657883644f},
-std::array<float,2>{0.748254359f, 0.559564471f},
-std::array<float,2>{0.243656069f, 0.344527334f},
-std::array<float,2>{0.869897366f, 0.203523338f},
-std::array<float,2>{0.434222221f, 0.874297798f},
-std::array<float,2>{0.778026879f, 0.731150866f},
-std::array<float,2>{0.455289364f, 0.459796757f},
-std::array<float,2>{0.652820051f, 0.105742432f},
-std::array<float,2>{0.151522383f, 0.911732435f},
-std::array<float,2>{0.590065718f, 0.781411231f},
-std::array<float,2>{0.0674932674f, 0.175325975f},
-std::array<float,2>{0.89780724f, 0.307677716f},
-std::array<float,2>{0.348339289f, 0.585546494f},
-std::array<float,2>{0.970455527f, 0.765157104f},
-std::array<float,2>{0.253287882f, 0.15270929f},
-std::array<float,2>{0.552209198f, 0.259952486f},
-std::array<float,2>{0.00334076793f, 0.597211063f},
-std::array<float,2>{0.743341982f, 0.709676564f},
-std::array<float,2>{0.247921541f, 0.490739495f},
-std::array<float,2>{0.874434948f, 0.0638752654f},
-std::array<float,2>{0.432931989f, 0.88877511f},
-std::array<float,2>{0.773594439f, 0.522984147f},
-std::array<float,2>{0.459525049f, 0.343737066f},
-std::array<float,2>{0.650345266f, 0.233860612f},
-std::array<float,2>{0.153827369f, 0.821457684f},
-std::array<float,2>{0.587324619f, 0.973719656f},
-std::array<float,2>{0.0662640855f, 0.0457585976f},
-std::array<float,2>{0.891637385f, 0.42713514f},
-std::array<float,2>{0.347620398f, 0.644991994f},
-std::array<float,2>{0.842983842f, 0.933053076f},
-std::array<float,2>{0.399008155f, 0.117948316f},
-std::array<float,2>{0.713457882f, 0.442552716f},
-std::array<float,2>{0.211867243f, 0.740618825f},
-std::array<float,2>{0.528741539f, 0.571476817f},
-std::array<float,2>{0.0320499241f, 0.289954096f},
-std::array<float,2>{0.955523074f, 0.16119194f},
-std::array<float,2>{0.29887712f, 0.79999274f},
-std::array<float,2>{0.925759852f, 0.679793417f},
-std::array<float,2>{0.326752603f, 0.393559635f},
-std::array<float,2>{0.603058517f, 0.010477243f},
-std::array<float,2>{0.110885277f, 0.951077342f},
-std::array<float,2>{0.659613311f, 0.859350681f},
-std::array<float,2>{0.182763442f, 0.194905624f},
-std::array<float,2>{0.78743881f, 0.366991252f},
-std::array<float,2>{0.48226279f, 0.543025017f},
-std::array<float,2>{0.811192334f, 0.833625734f},
-std::array<float,2>{0.48886767f, 0.245660126f},
-std::array<float,2>{0.67585355f, 0.327474177f},
-std::array<float,2>{0.169905663f, 0.505474627f},
-std::array<float,2>{0.618516743f, 0.640278578f},
-std::array<float,2>{0.0983384028f, 0.415816069f},
-std::array<float,2>{0.91555351f, 0.0615453124f},
-std::array<float,2>{0.331797838f, 0.991553724f},
-std::array<float,2>{0.938769698f, 0.612568676f},
-std::array<float,2>{0.296602219f, 0.278701186f},
-std::array<float,2>{0.503134787f, 0.139401823f},
-std::array<float,2>{0.056582015f, 0.772253573f},
-std::array<float,2>{0.70292443f, 0.900473356f},
-std::array<float,2>{0.188844159f, 0.0783151761f},
-std::array<float,2>{0.819699585f, 0.481092811f},
-std::array<float,2>{0.379154235f, 0.69462359f},
-std::array<float,2>{0.881205618f, 0.953229189f},
-std::array<float,2>{0.359543353f, 0.0303547271f},
-std::array<float,2>{0.563796401f, 0.377576351f},
-std::array<float,2>{0.0810295045f, 0.665577829f},
-std::array<float,2>{0.636705995f, 0.552202523f},
-std::array<float,2>{0.136787727f, 0.355624378f},
-std::array<float,2>{0.761773169f, 0.217768386f},
-std::array<float,2>{0.442444801f, 0.859770656f},
-std::array<float,2>{0.843867481f, 0.725460052f},
-std::array<float,2>{0.408069998f, 0.467403978f},
-std::array<float,2>{0.720804453f, 0.0976395831f},
-std::array<float,2>{0.222994059f, 0.917705059f},
-std::array<float,2>{0.531255484f, 0.795593679f},
-std::array<float,2>{0.0185527913f, 0.181954712f},
-std::array<float,2>{0.988169432f, 0.297179163f},
-std::array<float,2>{0.279482841f, 0.588186979f},
-std::array<float,2>{0.90820086f, 0.867717385f},
-std::array<float,2>{0.340929091f, 0.209988236f},
-std::array<float,2>{0.614512086f, 0.34873566f},
-std::array<float,2>{0.107386418f, 0.557020307f},
-std::array<float,2>{0.682541609f, 0.660636544f},
-std::array<float,2>{0.156865805f, 0.383704096f},
-std::array<float,2>{0.803435802f, 0.0201069936f},
-std::array<float,2>{0.499966919f, 0.968514502f},
-std::array<float,2>{0.825271964f, 0.581277788f},
-std::array<float,2>{0.389167935f, 0.311110288f},
-std::array<float,2>{0.692946494f, 0.176935688f},
-std::array<float,2>{0.196914896f, 0.785925269f},
-std::array<float,2>{0.508233726f, 0.906732082f},
-std::array<float,2>{0.0500485078f, 0.103731729f},
-std::array<float,2>{0.946551859f, 0.456585616f},
-std::array<float,2>{0.288033575f, 0.72900629f},
-std::array<float,2>{0.751659691f, 0.99513787f},
-std::array<float,2>{0.452167064f, 0.050680235f},
-std::array<float,2>{0.627049029f, 0.406727105f},
-std::array<float,2>{0.131680742f, 0.631518841f},
-std::array<float,2>{0.574911952f, 0.509910941f},
-std::array<float,2>{0.087765865f, 0.3177239f},
-std::array<float,2>{0.886848927f, 0.239639878f},
-std::array<float,2>{0.374664128f, 0.84281379f},
-std::array<float,2>{0.997969747f, 0.69546324f},
-std::array<float,2>{0.266225457f, 0.474595129f},
-std::array<float,2>{0.545672417f, 0.0889743194f},
-std::array<float,2>{0.0258184262f, 0.894805849f},
-std::array<float,2>{0.728138208f, 0.779871047f},
-std::array<float,2>{0.229682133f, 0.132343009f},
-std::array<float,2>{0.853663146f, 0.270156831f},
-std::array<float,2>{0.414857209f, 0.618415415f},
-std::array<float,2>{0.866096258f, 0.804877818f},
-std::array<float,2>{0.427787721f, 0.165280461f},
-std::array<float,2>{0.740189016f, 0.288490921f},
-std::array<float,2>{0.23832944f, 0.564383984f},
-std::array<float,2>{0.557828486f, 0.744206309f},
-std::array<float,2>{0.00972945523f, 0.447736412f},
-std::array<float,2>{0.981464386f, 0.112562619f},
-std::array<float,2>{0.258725315f, 0.926980793f},
-std::array<float,2>{0.898907423f, 0.534540474f},
-std::array<float,2>{0.354562104f, 0.372326493f},
-std::array<float,2>{0.58298701f, 0.200212151f},
-std::array<float,2>{0.070838511f, 0.848994792f},
-std::array<float,2>{0.641750574f, 0.943206608f},
-std::array<float,2>{0.148390397f, 0.0077915201f},
-std::array<float,2>{0.773214936f, 0.404931903f},
-std::array<float,2>{0.465099871f, 0.674904346f},
-std::array<float,2>{0.965933263f, 0.876721382f},
-std::array<float,2>{0.306200266f, 0.0753080249f},
-std::array<float,2>{0.516946554f, 0.494049042f},
-std::array<float,2>{0.0419205353f, 0.711506248f},
-std::array<float,2>{0.70723021f, 0.604254186f},
-std::array<float,2>{0.203531206f, 0.25179401f},
-std::array<float,2>{0.8321473f, 0.140956774f},
-std::array<float,2>{0.390674919f, 0.755473375f},
-std::array<float,2>{0.789606869f, 0.654049397f},
-std::array<float,2>{0.47543481f, 0.431952029f},
-std::array<float,2>{0.669343591f, 0.0343710482f},
-std::array<float,2>{0.176103011f, 0.982425511f},
-std::array<float,2>{0.600562394f, 0.818775177f},
-std::array<float,2>{0.120414749f, 0.222718477f},
-std::array<float,2>{0.936501801f, 0.332136214f},
-std::array<float,2>{0.315544516f, 0.524374843f},
-std::array<float,2>{0.950062871f, 0.827540576f},
-std::array<float,2>{0.281949639f, 0.227807388f},
-std::array<float,2>{0.512761414f, 0.339332342f},
-std::array<float,2>{0.0527874604f, 0.517132878f},
-std::array<float,2>{0.68870151f, 0.641353726f},
-std::array<float,2>{0.20214504f, 0.425215036f},
-std::array<float,2>{0.820727408f, 0.0413868651f},
-std::array<float,2>{0.385597765f, 0.972346187f},
-std::array<float,2>{0.79743129f, 0.599708974f},
-std::array<float,2>{0.495328605f, 0.265186965f},
-std::array<float,2>{0.684998512f, 0.152303383f},
-std::array<float,2>{0.160579041f, 0.759444118f},
-std::array<float,2>{0.612415493f, 0.882999659f},
-std::array<float,2>{0.101632386f, 0.0699256063f},
-std::array<float,2>{0.912915945f, 0.485989422f},
-std::array<float,2>{0.33599025f, 0.705909789f},
-std::array<float,2>{0.856466174f, 0.948972344f},
-std::array<float,2>{0.42040354f, 0.0148511864f},
-std::array<float,2>{0.731871545f, 0.397904009f},
-std::array<float,2>{0.233767778f, 0.683950901f},
-std::array<float,2>{0.539504349f, 0.540147781f},
-std::array<float,2>{0.0294348188f, 0.361548483f},
-std::array<float,2>{0.995749295f, 0.190411985f},
-std::array<float,2>{0.272923321f, 0.852710903f},
-std::array<float,2>{0.884280026f, 0.736966372f},
-std::array<float,2>{0.367337376f, 0.437832564f},
-std::array<float,2>{0.573347688f, 0.121460184f},
-std::array<float,2>{0.0911541134f, 0.934871495f},
-std::array<float,2>{0.63018173f, 0.804486692f},
-std::array<float,2>{0.126799509f, 0.15680635f},
-std::array<float,2>{0.755861938f, 0.296623468f},
-std::array<float,2>{0.448375195f, 0.577589214f},
-std::array<float,2>{0.76924485f, 0.768953621f},
-std::array<float,2>{0.462288976f, 0.135569513f},
-std::array<float,2>{0.645638108f, 0.274213582f},
-std::array<float,2>{0.141324431f, 0.614559829f},
-std::array<float,2>{0.580168188f, 0.69026649f},
-std::array<float,2>{0.076677449f, 0.479847014f},
-std::array<float,2>{0.904125094f, 0.0822343752f},
-std::array<float,2>{0.359055817f, 0.903772056f},
-std::array<float,2>{0.978975296f, 0.502758801f},
-std::array<float,2>{0.263343692f, 0.321237087f},
-std::array<float,2>{0.562292337f, 0.249609098f},
-std::array<float,2>{0.0117854234f, 0.831235468f},
-std::array<float,2>{0.736261964f, 0.987099469f},
-std::array<float,2>{0.237603828f, 0.0561363138f},
-std::array<float,2>{0.861152291f, 0.419618428f},
-std::array<float,2>{0.423784882f, 0.634345949f},
-std::array<float,2>{0.930423319f, 0.920245409f},
-std::array<float,2>{0.319292158f, 0.0997853652f},
-std::array<float,2>{0.596857727f, 0.463155806f},
-std::array<float,2>{0.121325247f, 0.720999599f},
-std::array<float,2>{0.665532947f, 0.591550589f},
-std::array<float,2>{0.171986908f, 0.302242965f},
-std::array<float,2>{0.795705676f, 0.18606852f},
-std::array<float,2>{0.471817225f, 0.792906284f},
-std::array<float,2>{0.828580678f, 0.669086337f},
-std::array<float,2>{0.39728108f, 0.379549295f},
-std::array<float,2>{0.70638442f, 0.0268028956f},
-std::array<float,2>{0.20934552f, 0.958635807f},
-std::array<float,2>{0.519793332f, 0.866419852f},
-std::array<float,2>{0.0459802039f, 0.214392394f},
-std::array<float,2>{0.963661551f, 0.355409086f},
-std::array<float,2>{0.311977684f, 0.55063647f},
-std::array<float,2>{0.89668709f, 0.783719778f},
-std::array<float,2>{0.349058747f, 0.173562109f},
-std::array<float,2>{0.591000497f, 0.306199223f},
-std::array<float,2>{0.0666541308f, 0.582298279f},
-std::array<float,2>{0.653694391f, 0.732527077f},
-std::array<float,2>{0.150725141f, 0.457151622f},
-std::array<float,2>{0.7790488f, 0.108998835f},
-std::array<float,2>{0.456095636f, 0.913922131f},
-std::array<float,2>{0.870943427f, 0.560994923f},
-std::array<float,2>{0.434613824f, 0.347385943f},
-std::array<float,2>{0.749301016f, 0.206506073f},
-std::array<float,2>{0.24256444f, 0.871916473f},
-std::array<float,2>{0.550233126f, 0.961599886f},
-std::array<float,2>{0.00635480089f, 0.0176101383f},
-std::array<float,2>{0.973245144f, 0.390093535f},
-std::array<float,2>{0.25540179f, 0.659674108f},
-std::array<float,2>{0.78510505f, 0.894412279f},
-std::array<float,2>{0.479971588f, 0.0909417942f},
-std::array<float,2>{0.661451519f, 0.472248256f},
-std::array<float,2>{0.185651377f, 0.699353933f},
-std::array<float,2>{0.606406391f, 0.623170555f},
-std::array<float,2>{0.113368332f, 0.267879009f},
-std::array<float,2>{0.927249372f, 0.128088459f},
-std::array<float,2>{0.323539644f, 0.773698986f},
-std::array<float,2>{0.958195269f, 0.626914144f},
-std::array<float,2>{0.304458022f, 0.411824971f},
-std::array<float,2>{0.525456607f, 0.0523912907f},
-std::array<float,2>{0.0355681106f, 0.99770546f},
-std::array<float,2>{0.716862798f, 0.838946462f},
-std::array<float,2>{0.218646988f, 0.234821081f},
-std::array<float,2>{0.837572694f, 0.313026369f},
-std::array<float,2>{0.402998239f, 0.515094936f},
-std::array<float,2>{0.815155923f, 0.846490979f},
-std::array<float,2>{0.377666861f, 0.196222737f},
-std::array<float,2>{0.695835888f, 0.367761582f},
-std::array<float,2>{0.192959324f, 0.537086785f},
-std::array<float,2>{0.503926635f, 0.678878069f},
-std::array<float,2>{0.0614054278f, 0.399100631f},
-std::array<float,2>{0.942857862f, 0.00382398744f},
-std::array<float,2>{0.292625666f, 0.938841581f},
-std::array<float,2>{0.921814322f, 0.567632675f},
-std::array<float,2>{0.334799528f, 0.28389436f},
-std::array<float,2>{0.621808052f, 0.171853617f},
-std::array<float,2>{0.0956668258f, 0.810844302f},
-std::array<float,2>{0.67246902f, 0.924990296f},
-std::array<float,2>{0.166250691f, 0.114528731f},
-std::array<float,2>{0.808260262f, 0.451215059f},
-std::array<float,2>{0.488035411f, 0.746780097f},
-std::array<float,2>{0.989930093f, 0.978544533f},
-std::array<float,2>{0.276202321f, 0.0354406238f},
-std::array<float,2>{0.5382424f, 0.436466396f},
-std::array<float,2>{0.0205438249f, 0.651203036f},
-std::array<float,2>{0.723831952f, 0.529425323f},
-std::array<float,2>{0.221935362f, 0.330073327f},
-std::array<float,2>{0.849606574f, 0.221439809f},
-std::array<float,2>{0.413304985f, 0.814010382f},
-std::array<float,2>{0.760948658f, 0.718309283f},
-std::array<float,2>{0.440831274f, 0.496230304f},
-std::array<float,2>{0.638411045f, 0.0714602023f},
-std::array<float,2>{0.134532765f, 0.880561054f},
-std::array<float,2>{0.567908168f, 0.753645539f},
-std::array<float,2>{0.0830897987f, 0.146026745f},
-std::array<float,2>{0.877165079f, 0.256808341f},
-std::array<float,2>{0.364456475f, 0.607724786f},
-std::array<float,2>{0.9550336f, 0.798536479f},
-std::array<float,2>{0.297524452f, 0.16232045f},
-std::array<float,2>{0.529519618f, 0.291659325f},
-std::array<float,2>{0.034087643f, 0.573153377f},
-std::array<float,2>{0.712162793f, 0.738711178f},
-std::array<float,2>{0.214189574f, 0.444413513f},
-std::array<float,2>{0.8402282f, 0.119522072f},
-std::array<float,2>{0.401208967f, 0.930672169f},
-std::array<float,2>{0.786065638f, 0.546128392f},
-std::array<float,2>{0.483284473f, 0.364008218f},
-std::array<float,2>{0.656802654f, 0.19142431f},
-std::array<float,2>{0.181349531f, 0.857373953f},
-std::array<float,2>{0.605430245f, 0.952533782f},
-std::array<float,2>{0.112656109f, 0.00794044603f},
-std::array<float,2>{0.922077298f, 0.392321676f},
-std::array<float,2>{0.324838847f, 0.683516562f},
-std::array<float,2>{0.871798217f, 0.887086093f},
-std::array<float,2>{0.431149274f, 0.0645559505f},
-std::array<float,2>{0.745130837f, 0.489935607f},
-std::array<float,2>{0.248976558f, 0.707919955f},
-std::array<float,2>{0.553044498f, 0.59525013f},
-std::array<float,2>{0.00172037224f, 0.258118927f},
-std::array<float,2>{0.971681237f, 0.154433504f},
-std::array<float,2>{0.251006424f, 0.762218118f},
-std::array<float,2>{0.893124342f, 0.646683276f},
-std::array<float,2>{0.345373303f, 0.428198844f},
-std::array<float,2>{0.589672029f, 0.0429906137f},
-std::array<float,2>{0.0637484714f, 0.975562274f},
-std::array<float,2>{0.65221554f, 0.823173821f},
-std::array<float,2>{0.154787987f, 0.231374145f},
-std::array<float,2>{0.776810527f, 0.341210842f},
-std::array<float,2>{0.457558215f, 0.520293474f},
-std::array<float,2>{0.764978826f, 0.862036467f},
-std::array<float,2>{0.444092333f, 0.216203332f},
-std::array<float,2>{0.633816004f, 0.358521432f},
-std::array<float,2>{0.139729187f, 0.553901196f},
-std::array<float,2>{0.564582407f, 0.666379273f},
-std::array<float,2>{0.0799417868f, 0.376222968f},
-std::array<float,2>{0.879628241f, 0.0280852187f},
-std::array<float,2>{0.363013357f, 0.956694067f},
-std::array<float,2>{0.984405458f, 0.58659327f},
-std::array<float,2>{0.277832955f, 0.299247891f},
-std::array<float,2>{0.534183741f, 0.181554735f},
-std::array<float,2>{0.0169833563f, 0.793823361f},
-std::array<float,2>{0.719282091f, 0.914501846f},
-std::array<float,2>{0.224992633f, 0.0949473232f},
-std::array<float,2>{0.846668541f, 0.466323584f},
-std::array<float,2>{0.409252077f, 0.72366327f},
-std::array<float,2>{0.916976631f, 0.989945471f},
-std::array<float,2>{0.329542726f, 0.0596564747f},
-std::array<float,2>{0.620314479f, 0.416327178f},
-std::array<float,2>{0.100105613f, 0.636838615f},
-std::array<float,2>{0.679649532f, 0.507516503f},
-std::array<float,2>{0.171207666f, 0.324492842f},
-std::array<float,2>{0.808797061f, 0.243196771f},
-std::array<float,2>{0.492095262f, 0.83534503f},
-std::array<float,2>{0.817832828f, 0.691784978f},
-std::array<float,2>{0.381583065f, 0.48347193f},
-std::array<float,2>{0.699630916f, 0.0805329457f},
-std::array<float,2>{0.190881476f, 0.899113595f},
-std::array<float,2>{0.501227975f, 0.771179378f},
-std::array<float,2>{0.0578592345f, 0.138022572f},
-std::array<float,2>{0.939960241f, 0.281149477f},
-std::array<float,2>{0.293579608f, 0.609857857f},
-std::array<float,2>{0.889894664f, 0.8417871f},
-std::array<float,2>{0.371731609f, 0.242045462f},
-std::array<float,2>{0.577848256f, 0.318814754f},
-std::array<float,2>{0.089525722f, 0.509538114f},
-std::array<float,2>{0.625626922f, 0.629261494f},
-std::array<float,2>{0.130578056f, 0.40868485f},
-std::array<float,2>{0.752804816f, 0.047492262f},
-std::array<float,2>{0.450788379f, 0.993977487f},
-std::array<float,2>{0.852767944f, 0.619353771f},
-std::array<float,2>{0.417901069f, 0.272619188f},
-std::array<float,2>{0.729785204f, 0.130749539f},
-std::array<float,2>{0.227678314f, 0.778210461f},
-std::array<float,2>{0.543794155f, 0.896650612f},
-std::array<float,2>{0.0240098536f, 0.0867866129f},
-std::array<float,2>{0.998299479f, 0.474969804f},
-std::array<float,2>{0.268435717f, 0.699002028f},
-std::array<float,2>{0.802201927f, 0.964876354f},
-std::array<float,2>{0.497369021f, 0.0216779839f},
-std::array<float,2>{0.679733992f, 0.386604697f},
-std::array<float,2>{0.159289792f, 0.663105726f},
-std::array<float,2>{0.616566122f, 0.5565117f},
-std::array<float,2>{0.108521961f, 0.349620998f},
-std::array<float,2>{0.909178138f, 0.208227724f},
-std::array<float,2>{0.342215508f, 0.870470166f},
-std::array<float,2>{0.948218107f, 0.728016198f},
-std::array<float,2>{0.286417782f, 0.453659981f},
-std::array<float,2>{0.509919822f, 0.102410749f},
-std::array<float,2>{0.0471634418f, 0.908997416f},
-std::array<float,2>{0.69351244f, 0.788549185f},
-std::array<float,2>{0.19894509f, 0.179138213f},
-std::array<float,2>{0.826812983f, 0.309679866f},
-std::array<float,2>{0.388357788f, 0.579343736f},
-std::array<float,2>{0.835474074f, 0.755912125f},
-std::array<float,2>{0.393809527f, 0.144024059f},
-std::array<float,2>{0.710507274f, 0.253034562f},
-std::array<float,2>{0.207029119f, 0.602381229f},
-std::array<float,2>{0.519252241f, 0.714258194f},
-std::array<float,2>{0.0397548601f, 0.495635539f},
-std::array<float,2>{0.967315495f, 0.0769509897f},
-std::array<float,2>{0.306731015f, 0.877477825f},
-std::array<float,2>{0.934483886f, 0.525422812f},
-std::array<float,2>{0.312802821f, 0.334048569f},
-std::array<float,2>{0.598534822f, 0.226272881f},
-std::array<float,2>{0.118342966f, 0.818239629f},
-std::array<float,2>{0.671518981f, 0.981633663f},
-std::array<float,2>{0.178637177f, 0.0320450515f},
-std::array<float,2>{0.791959107f, 0.429720581f},
-std::array<float,2>{0.473982185f, 0.655006349f},
-std::array<float,2>{0.982934415f, 0.928928077f},
-std::array<float,2>{0.261635631f, 0.109421492f},
-std::array<float,2>{0.554720402f, 0.446116239f},
-std::array<float,2>{0.0104457233f, 0.744050324f},
-std::array<float,2>{0.742092431f, 0.565976083f},
-std::array<float,2>{0.240558997f, 0.2855905f},
-std::array<float,2>{0.864012003f, 0.167882383f},
-std::array<float,2>{0.426898658f, 0.808167636f},
-std::array<float,2>{0.770522058f, 0.673826814f},
-std::array<float,2>{0.468116373f, 0.403053164f},
-std::array<float,2>{0.644137859f, 0.00405726489f},
-std::array<float,2>{0.145442262f, 0.944008052f},
-std::array<float,2>{0.584535718f, 0.850984573f},
-std::array<float,2>{0.0740592331f, 0.202291369f},
-std::array<float,2>{0.902035952f, 0.374486208f},
-std::array<float,2>{0.353175968f, 0.532970846f},
-std::array<float,2>{0.992415011f, 0.853848219f},
-std::array<float,2>{0.269882768f, 0.187805504f},
-std::array<float,2>{0.542108655f, 0.359533876f},
-std::array<float,2>{0.0292564873f, 0.542688668f},
-std::array<float,2>{0.734001696f, 0.686795592f},
-std::array<float,2>{0.230720013f, 0.395883352f},
-std::array<float,2>{0.858003318f, 0.0136233494f},
-std::array<float,2>{0.418106914f, 0.946877778f},
-std::array<float,2>{0.754858255f, 0.574833333f},
-std::array<float,2>{0.447201908f, 0.294857681f},
-std::array<float,2>{0.632148802f, 0.158990651f},
-std::array<float,2>{0.127607197f, 0.802317321f},
-std::array<float,2>{0.57106632f, 0.937028944f},
-std::array<float,2>{0.0930554047f, 0.124432057f},
-std::array<float,2>{0.885238111f, 0.440214485f},
-std::array<float,2>{0.370914549f, 0.73625052f},
-std::array<float,2>{0.822851777f, 0.970027983f},
-std::array<float,2>{0.383031279f, 0.0393750258f},
-std::array<float,2>{0.690108955f, 0.422453493f},
-std::array<float,2>{0.200739145f, 0.643223941f},
-std::array<float,2>{0.514538765f, 0.518101573f},
-std::array<float,2>{0.0510025695f, 0.336684495f},
-std::array<float,2>{0.95179683f, 0.230419695f},
-std::array<float,2>{0.284120411f, 0.82600385f},
-std::array<float,2>{0.911423802f, 0.704550564f},
-std::array<float,2>{0.338543117f, 0.488250464f},
-std::array<float,2>{0.611184478f, 0.0681949928f},
-std::array<float,2>{0.104252756f, 0.885538936f},
-std::array<float,2>{0.685953557f, 0.760983944f},
-std::array<float,2>{0.163395554f, 0.148670763f},
-std::array<float,2>{0.799781322f, 0.26236245f},
-std::array<float,2>{0.493976146f, 0.598093271f},
-std::array<float,2>{0.793680251f, 0.789258957f},
-std::array<float,2>{0.469682723f, 0.183594808f},
-std::array<float,2>{0.667266667f, 0.302977771f},
-std::array<float,2>{0.174859434f, 0.592110634f},
-std::array<float,2>{0.595283508f, 0.720626414f},
-std::array<float,2>{0.123604886f, 0.461228222f},
-std::array<float,2>{0.932821035f, 0.0977506191f},
-std::array<float,2>{0.318188578f, 0.918839037f},
-std::array<float,2>{0.962684512f, 0.548084617f},
-std::array<float,2>{0.309324056f, 0.351645857f},
-std::array<float,2>{0.522909045f, 0.212753102f},
-std::array<float,2>{0.0442805588f, 0.864430308f},
-std::array<float,2>{0.704151273f, 0.959493577f},
-std::array<float,2>{0.207356811f, 0.0248394217f},
-std::array<float,2>{0.831858695f, 0.381400019f},
-std::array<float,2>{0.39600426f, 0.670309842f},
-std::array<float,2>{0.90521574f, 0.904396474f},
-std::array<float,2>{0.357205689f, 0.0857283622f},
-std::array<float,2>{0.57848829f, 0.47748211f},
-std::array<float,2>{0.0743064657f, 0.689262152f},
-std::array<float,2>{0.647510469f, 0.615597248f},
-std::array<float,2>{0.142663464f, 0.276077837f},
-std::array<float,2>{0.765980184f, 0.13462694f},
-std::array<float,2>{0.463471621f, 0.767238975f},
-std::array<float,2>{0.862553179f, 0.635182023f},
-std::array<float,2>{0.424961805f, 0.420630485f},
-std::array<float,2>{0.737365305f, 0.0584810562f},
-std::array<float,2>{0.234562814f, 0.986024678f},
-std::array<float,2>{0.559394598f, 0.829336286f},
-std::array<float,2>{0.0154914362f, 0.247375742f},
-std::array<float,2>{0.977630854f, 0.324057192f},
-std::array<float,2>{0.264539808f, 0.501339018f},
-std::array<float,2>{0.9284392f, 0.777080655f},
-std::array<float,2>{0.321402878f, 0.126181364f},
-std::array<float,2>{0.607533216f, 0.265794218f},
-std::array<float,2>{0.115679696f, 0.622149944f},
-std::array<float,2>{0.66398102f, 0.701978564f},
-std::array<float,2>{0.18398951f, 0.468824983f},
-std::array<float,2>{0.781382203f, 0.0930579454f},
-std::array<float,2>{0.47758022f, 0.891851723f},
-std::array<float,2>{0.839642227f, 0.512641191f},
-std::array<float,2>{0.405466169f, 0.316205233f},
-std::array<float,2>{0.714956462f, 0.237359136f},
-std::array<float,2>{0.216598496f, 0.83670181f},
-std::array<float,2>{0.523699164f, 0.998365104f},
-std::array<float,2>{0.0371965654f, 0.0537478179f},
-std::array<float,2>{0.959852159f, 0.41334486f},
-std::array<float,2>{0.301135153f, 0.628263831f},
-std::array<float,2>{0.779345214f, 0.910641372f},
-std::array<float,2>{0.453803986f, 0.106676042f},
-std::array<float,2>{0.655490816f, 0.460610807f},
-std::array<float,2>{0.149636343f, 0.731469274f},
-std::array<float,2>{0.593563497f, 0.584045827f},
-std::array<float,2>{0.0684096143f, 0.306919634f},
-std::array<float,2>{0.894768178f, 0.173955172f},
-std::array<float,2>{0.349653274f, 0.782468438f},
-std::array<float,2>{0.975113928f, 0.657069564f},
-std::array<float,2>{0.256289601f, 0.388280213f},
-std::array<float,2>{0.547167718f, 0.0160823576f},
-std::array<float,2>{0.00537768751f, 0.964292288f},
-std::array<float,2>{0.747891963f, 0.873525918f},
-std::array<float,2>{0.24604556f, 0.204685852f},
-std::array<float,2>{0.868469179f, 0.344826877f},
-std::array<float,2>{0.435665637f, 0.560465038f},
-std::array<float,2>{0.851017058f, 0.815149486f},
-std::array<float,2>{0.410360098f, 0.220554307f},
-std::array<float,2>{0.724734962f, 0.330534369f},
-std::array<float,2>{0.220414579f, 0.529241562f},
-std::array<float,2>{0.537019968f, 0.648892879f},
-std::array<float,2>{0.0224619005f, 0.434450537f},
-std::array<float,2>{0.992003798f, 0.0381705724f},
-std::array<float,2>{0.274565279f, 0.977983773f},
-std::array<float,2>{0.875000954f, 0.60617429f},
-std::array<float,2>{0.367040098f, 0.254910618f},
-std::array<float,2>{0.56982094f, 0.147767976f},
-std::array<float,2>{0.0858065709f, 0.751338243f},
-std::array<float,2>{0.639606714f, 0.881323576f},
-std::array<float,2>{0.135463625f, 0.0730044022f},
-std::array<float,2>{0.759464204f, 0.499078304f},
-std::array<float,2>{0.43861711f, 0.715156913f},
-std::array<float,2>{0.944009244f, 0.940758228f},
-std::array<float,2>{0.290692389f, 0.000541095564f},
-std::array<float,2>{0.506705582f, 0.402097583f},
-std::array<float,2>{0.0591397583f, 0.676879287f},
-std::array<float,2>{0.697808206f, 0.538495421f},
-std::array<float,2>{0.194528967f, 0.370467246f},
-std::array<float,2>{0.814442277f, 0.198459685f},
-std::array<float,2>{0.375476301f, 0.845025122f},
-std::array<float,2>{0.805118918f, 0.749716163f},
-std::array<float,2>{0.485265225f, 0.450499505f},
-std::array<float,2>{0.674974144f, 0.116382331f},
-std::array<float,2>{0.164355844f, 0.922011793f},
-std::array<float,2>{0.623125255f, 0.80984199f},
-std::array<float,2>{0.0966817364f, 0.168214202f},
-std::array<float,2>{0.919270575f, 0.282313228f},
-std::array<float,2>{0.333754241f, 0.570284307f},
-std::array<float,2>{0.96691364f, 0.75516504f},
-std::array<float,2>{0.307271332f, 0.141327739f},
-std::array<float,2>{0.518846929f, 0.251322329f},
-std::array<float,2>{0.039064303f, 0.603856981f},
-std::array<float,2>{0.710178912f, 0.711010635f},
-std::array<float,2>{0.20636043f, 0.493630588f},
-std::array<float,2>{0.835257053f, 0.0757424161f},
-std::array<float,2>{0.394116491f, 0.876024902f},
-std::array<float,2>{0.791325569f, 0.523836076f},
-std::array<float,2>{0.47440365f, 0.332864255f},
-std::array<float,2>{0.671349525f, 0.223460063f},
-std::array<float,2>{0.178001642f, 0.819044709f},
-std::array<float,2>{0.597739756f, 0.982991397f},
-std::array<float,2>{0.118715353f, 0.0350526497f},
-std::array<float,2>{0.93392086f, 0.432533175f},
-std::array<float,2>{0.313006252f, 0.65342176f},
-std::array<float,2>{0.863595903f, 0.927679956f},
-std::array<float,2>{0.42752254f, 0.112919927f},
-std::array<float,2>{0.741329968f, 0.448240727f},
-std::array<float,2>{0.241070837f, 0.74503392f},
-std::array<float,2>{0.555212498f, 0.563748419f},
-std::array<float,2>{0.00981226191f, 0.288838357f},
-std::array<float,2>{0.9825297f, 0.165589631f},
-std::array<float,2>{0.261176586f, 0.80537492f},
-std::array<float,2>{0.901393831f, 0.67551434f},
-std::array<float,2>{0.352793813f, 0.404464692f},
-std::array<float,2>{0.584283352f, 0.00730985962f},
-std::array<float,2>{0.0736113861f, 0.942384958f},
-std::array<float,2>{0.643890917f, 0.849379122f},
-std::array<float,2>{0.144555077f, 0.200900689f},
-std::array<float,2>{0.771217346f, 0.372935534f},
-std::array<float,2>{0.468357295f, 0.53512013f},
-std::array<float,2>{0.75238353f, 0.843726814f},
-std::array<float,2>{0.450446546f, 0.240060776f},
-std::array<float,2>{0.625466228f, 0.318320215f},
-std::array<float,2>{0.129984364f, 0.510714114f},
-std::array<float,2>{0.577246189f, 0.631322622f},
-std::array<float,2>{0.0889365301f, 0.40705812f},
-std::array<float,2>{0.890272677f, 0.0498289466f},
-std::array<float,2>{0.371277392f, 0.995709896f},
-std::array<float,2>{0.998871744f, 0.618978977f},
-std::array<float,2>{0.267951757f, 0.269637525f},
-std::array<float,2>{0.543053567f, 0.132084578f},
-std::array<float,2>{0.0236511584f, 0.779586554f},
-std::array<float,2>{0.730312765f, 0.895308852f},
-std::array<float,2>{0.228365794f, 0.0895095915f},
-std::array<float,2>{0.853335917f, 0.473947614f},
-std::array<float,2>{0.41747728f, 0.696169078f},
-std::array<float,2>{0.908482611f, 0.967917025f},
-std::array<float,2>{0.342593402f, 0.0197894461f},
-std::array<float,2>{0.616725087f, 0.382971108f},
-std::array<float,2>{0.109154262f, 0.660758317f},
-std::array<float,2>{0.680242419f, 0.557507098f},
-std::array<float,2>{0.159904301f, 0.349293679f},
-std::array<float,2>{0.802420616f, 0.210604787f},
-std::array<float,2>{0.497854739f, 0.867367923f},
-std::array<float,2>{0.826387584f, 0.728589118f},
-std::array<float,2>{0.387991577f, 0.456269056f},
-std::array<float,2>{0.693952858f, 0.104152568f},
-std::array<float,2>{0.19828783f, 0.906883121f},
-std::array<float,2>{0.510304868f, 0.785296321f},
-std::array<float,2>{0.0473761968f, 0.177430645f},
-std::array<float,2>{0.947729647f, 0.310637325f},
-std::array<float,2>{0.286747128f, 0.581957042f},
-std::array<float,2>{0.87923342f, 0.860152721f},
-std::array<float,2>{0.362331837f, 0.217214167f},
-std::array<float,2>{0.565406501f, 0.355959207f},
-std::array<float,2>{0.079535909f, 0.552271903f},
-std::array<float,2>{0.634642482f, 0.66524899f},
-std::array<float,2>{0.140224889f, 0.37702167f},
-std::array<float,2>{0.765496433f, 0.0310865026f},
-std::array<float,2>{0.443769664f, 0.953634381f},
-std::array<float,2>{0.845757782f, 0.588586271f},
-std::array<float,2>{0.409923553f, 0.297405481f},
-std::array<float,2>{0.71909523f, 0.182212204f},
-std::array<float,2>{0.22543551f, 0.794958055f},
-std::array<float,2>{0.534672141f, 0.917373776f},
-std::array<float,2>{0.0172072873f, 0.0968307927f},
-std::array<float,2>{0.984983027f, 0.466967404f},
-std::array<float,2>{0.277381986f, 0.724661648f},
-std::array<float,2>{0.809267402f, 0.992141485f},
-std::array<float,2>{0.491281062f, 0.0620277636f},
-std::array<float,2>{0.678918302f, 0.41503942f},
-std::array<float,2>{0.171867922f, 0.639804184f},
-std::array<float,2>{0.620880306f, 0.505031109f},
-std::array<float,2>{0.0998367965f, 0.327657312f},
-std::array<float,2>{0.916473508f, 0.245446473f},
-std::array<float,2>{0.329818845f, 0.833322942f},
-std::array<float,2>{0.939660013f, 0.695254326f},
-std::array<float,2>{0.293098688f, 0.480793297f},
-std::array<float,2>{0.501615763f, 0.0787301287f},
-std::array<float,2>{0.0581125729f, 0.90131098f},
-std::array<float,2>{0.70011121f, 0.771910369f},
-std::array<float,2>{0.191248f, 0.138759896f},
-std::array<float,2>{0.818287849f, 0.279287249f},
-std::array<float,2>{0.381318033f, 0.613153636f},
-std::array<float,2>{0.840669572f, 0.800436437f},
-std::array<float,2>{0.400581777f, 0.162061945f},
-std::array<float,2>{0.712810099f, 0.289127409f},
-std::array<float,2>{0.214805782f, 0.572206676f},
-std::array<float,2>{0.529913902f, 0.741169095f},
-std::array<float,2>{0.0333085954f, 0.442931533f},
-std::array<float,2>{0.954421461f, 0.117655545f},
-std::array<float,2>{0.29706192f, 0.933156729f},
-std::array<float,2>{0.922731519f, 0.54382509f},
-std::array<float,2>{0.324437827f, 0.36645636f},
-std::array<float,2>{0.604504168f, 0.194822803f},
-std::array<float,2>{0.112947457f, 0.858712554f},
-std::array<float,2>{0.656284332f, 0.95028913f},
-std::array<float,2>{0.18093051f, 0.00987411756f},
-std::array<float,2>{0.785480976f, 0.394343048f},
-std::array<float,2>{0.482448816f, 0.680464029f},
-std::array<float,2>{0.972235441f, 0.889345825f},
-std::array<float,2>{0.251905322f, 0.06407132f},
-std::array<float,2>{0.55354923f, 0.490620703f},
-std::array<float,2>{0.00135889591f, 0.709466636f},
-std::array<float,2>{0.74564451f, 0.596866965f},
-std::array<float,2>{0.248093516f, 0.260301292f},
-std::array<float,2>{0.871545196f, 0.153117612f},
-std::array<float,2>{0.431622446f, 0.764672279f},
-std::array<float,2>{0.777100325f, 0.645280123f},
-std::array<float,2>{0.457044899f, 0.427510828f},
-std::array<float,2>{0.651540697f, 0.0451715365f},
-std::array<float,2>{0.154374942f, 0.974529147f},
-std::array<float,2>{0.589036465f, 0.8222453f},
-std::array<float,2>{0.0643163547f, 0.234115019f},
-std::array<float,2>{0.892905176f, 0.342958689f},
-std::array<float,2>{0.345213413f, 0.522735238f},
-std::array<float,2>{0.9916026f, 0.813564897f},
-std::array<float,2>{0.275288194f, 0.220851496f},
-std::array<float,2>{0.536350548f, 0.329160988f},
-std::array<float,2>{0.0229562093f, 0.529793799f},
-std::array<float,2>{0.725561619f, 0.650552213f},
-std::array<float,2>{0.22006768f, 0.435842991f},
-std::array<float,2>{0.85138917f, 0.0360639021f},
-std::array<float,2>{0.411003619f, 0.979221642f},
-std::array<float,2>{0.759216905f, 0.608320773f},
-std::array<float,2>{0.439138144f, 0.256012559f},
-std::array<float,2>{0.639137506f, 0.145954639f},
-std::array<float,2>{0.134808272f, 0.753237426f},
-std::array<float,2>{0.570175767f, 0.880281508f},
-std::array<float,2>{0.0850311369f, 0.0718303546f},
-std::array<float,2>{0.875929177f, 0.496655345f},
-std::array<float,2>{0.366477847f, 0.718103886f},
-std::array<float,2>{0.813481927f, 0.939417601f},
-std::array<float,2>{0.375718385f, 0.00310083386f},
-std::array<float,2>{0.697553277f, 0.398675174f},
-std::array<float,2>{0.195237607f, 0.679541469f},
-std::array<float,2>{0.506038725f, 0.536457658f},
-std::array<float,2>{0.0586780719f, 0.36752221f},
-std::array<float,2>{0.94363445f, 0.195399269f},
-std::array<float,2>{0.290267497f, 0.845897257f},
-std::array<float,2>{0.919772685f, 0.746278882f},
-std::array<float,2>{0.333387822f, 0.452095211f},
-std::array<float,2>{0.624001086f, 0.114881746f},
-std::array<float,2>{0.0975486636f, 0.925541699f},
-std::array<float,2>{0.675526142f, 0.811228871f},
-std::array<float,2>{0.164588988f, 0.171121821f},
-std::array<float,2>{0.805603802f, 0.283383191f},
-std::array<float,2>{0.484529465f, 0.568054855f},
-std::array<float,2>{0.782125235f, 0.774189055f},
-std::array<float,2>{0.478298992f, 0.128746614f},
-std::array<float,2>{0.663542211f, 0.268522859f},
-std::array<float,2>{0.184391096f, 0.623940825f},
-std::array<float,2>{0.608157039f, 0.700143814f},
-std::array<float,2>{0.116187662f, 0.471692502f},
-std::array<float,2>{0.92784071f, 0.0914899632f},
-std::array<float,2>{0.321823746f, 0.893665314f},
-std::array<float,2>{0.959094048f, 0.515266836f},
-std::array<float,2>{0.301757634f, 0.312796175f},
-std::array<float,2>{0.524344981f, 0.234878629f},
-std::array<float,2>{0.0378738381f, 0.839668214f},
-std::array<float,2>{0.715477884f, 0.997454643f},
-std::array<float,2>{0.215910867f, 0.0518561415f},
-std::array<float,2>{0.839084327f, 0.411314785f},
-std::array<float,2>{0.406105727f, 0.62601769f},
-std::array<float,2>{0.895227015f, 0.913133264f},
-std::array<float,2>{0.350378871f, 0.108864486f},
-std::array<float,2>{0.593100846f, 0.457650214f},
-std::array<float,2>{0.0689794049f, 0.733297229f},
-std::array<float,2>{0.656022668f, 0.582813978f},
-std::array<float,2>{0.150056571f, 0.305960923f},
-std::array<float,2>{0.780083776f, 0.173060685f},
-std::array<float,2>{0.453133047f, 0.783398569f},
-std::array<float,2>{0.869009376f, 0.659265697f},
-std::array<float,2>{0.436065465f, 0.390277505f},
-std::array<float,2>{0.747182786f, 0.0184547994f},
-std::array<float,2>{0.245322168f, 0.961388111f},
-std::array<float,2>{0.54773587f, 0.871364415f},
-std::array<float,2>{0.00513192173f, 0.206881091f},
-std::array<float,2>{0.974915445f, 0.347156793f},
-std::array<float,2>{0.256723166f, 0.561469197f},
-std::array<float,2>{0.933138311f, 0.792231858f},
-std::array<float,2>{0.317452729f, 0.185893387f},
-std::array<float,2>{0.59481442f, 0.302712739f},
-std::array<float,2>{0.123094983f, 0.591056526f},
-std::array<float,2>{0.66764468f, 0.721495569f},
-std::array<float,2>{0.175336793f, 0.463838309f},
-std::array<float,2>{0.793353736f, 0.100491054f},
-std::array<float,2>{0.469186753f, 0.920534492f},
-std::array<float,2>{0.831538022f, 0.549958348f},
-std::array<float,2>{0.395530254f, 0.354661763f},
-std::array<float,2>{0.705035686f, 0.214044079f},
-std::array<float,2>{0.207611158f, 0.866959512f},
-std::array<float,2>{0.523108125f, 0.958348751f},
-std::array<float,2>{0.0446893498f, 0.027217783f},
-std::array<float,2>{0.962034225f, 0.378942251f},
-std::array<float,2>{0.30893743f, 0.669553339f},
-std::array<float,2>{0.766424417f, 0.903911293f},
-std::array<float,2>{0.463031977f, 0.0826709941f},
-std::array<float,2>{0.647993088f, 0.480181396f},
-std::array<float,2>{0.143429205f, 0.689911544f},
-std::array<float,2>{0.578646302f, 0.614940822f},
-std::array<float,2>{0.0747748464f, 0.273479611f},
-std::array<float,2>{0.904521942f, 0.135069966f},
-std::array<float,2>{0.356665045f, 0.76944685f},
-std::array<float,2>{0.978388369f, 0.633928597f},
-std::array<float,2>{0.263694733f, 0.419095963f},
-std::array<float,2>{0.55881387f, 0.056227278f},
-std::array<float,2>{0.0147862704f, 0.986653686f},
-std::array<float,2>{0.738152802f, 0.831562281f},
-std::array<float,2>{0.235026121f, 0.249321818f},
-std::array<float,2>{0.863244534f, 0.320725828f},
-std::array<float,2>{0.425765783f, 0.502231777f},
-std::array<float,2>{0.857768118f, 0.853189111f},
-std::array<float,2>{0.418693036f, 0.189925611f},
-std::array<float,2>{0.733837485f, 0.362255067f},
-std::array<float,2>{0.231024697f, 0.540862679f},
-std::array<float,2>{0.542664528f, 0.684267521f},
-std::array<float,2>{0.0283361841f, 0.39841494f},
-std::array<float,2>{0.99309957f, 0.0152508114f},
-std::array<float,2>{0.270339727f, 0.948265731f},
-std::array<float,2>{0.885580957f, 0.577840149f},
-std::array<float,2>{0.370561182f, 0.296153992f},
-std::array<float,2>{0.570745051f, 0.156575307f},
-std::array<float,2>{0.0932788923f, 0.804010391f},
-std::array<float,2>{0.632791638f, 0.935273707f},
-std::array<float,2>{0.127324134f, 0.121979907f},
-std::array<float,2>{0.75417304f, 0.438215226f},
-std::array<float,2>{0.446309239f, 0.736786902f},
-std::array<float,2>{0.951243877f, 0.972035885f},
-std::array<float,2>{0.283268571f, 0.0419254489f},
-std::array<float,2>{0.513747692f, 0.425442129f},
-std::array<float,2>{0.0515786447f, 0.641040027f},
-std::array<float,2>{0.689915597f, 0.516786873f},
-std::array<float,2>{0.20022738f, 0.33949402f},
-std::array<float,2>{0.822333336f, 0.228488639f},
-std::array<float,2>{0.383342087f, 0.827926815f},
-std::array<float,2>{0.799266815f, 0.705240607f},
-std::array<float,2>{0.493355036f, 0.485625446f},
-std::array<float,2>{0.686430752f, 0.0696019009f},
-std::array<float,2>{0.163717911f, 0.883404016f},
-std::array<float,2>{0.61071223f, 0.758954585f},
-std::array<float,2>{0.103763066f, 0.151377097f},
-std::array<float,2>{0.911899686f, 0.264915049f},
-std::array<float,2>{0.338118434f, 0.600340903f},
-std::array<float,2>{0.982274592f, 0.807752132f},
-std::array<float,2>{0.257954091f, 0.167279527f},
-std::array<float,2>{0.558315337f, 0.286060423f},
-std::array<float,2>{0.0089588277f, 0.565688431f},
-std::array<float,2>{0.739606738f, 0.743403614f},
-std::array<float,2>{0.238806039f, 0.445467114f},
-std::array<float,2>{0.865266323f, 0.110214464f},
-std::array<float,2>{0.428629637f, 0.929519832f},
-std::array<float,2>{0.772473693f, 0.532701254f},
-std::array<float,2>{0.465451539f, 0.374598861f},
-std::array<float,2>{0.642118573f, 0.203099251f},
-std::array<float,2>{0.147461489f, 0.851161659f},
-std::array<float,2>{0.582154214f, 0.943595052f},
-std::array<float,2>{0.070552066f, 0.00456031598f},
-std::array<float,2>{0.899137497f, 0.402629942f},
-std::array<float,2>{0.355172306f, 0.67285955f},
-std::array<float,2>{0.832730412f, 0.877135515f},
-std::array<float,2>{0.391309321f, 0.0764907449f},
-std::array<float,2>{0.70762229f, 0.495364249f},
-std::array<float,2>{0.203625634f, 0.714545906f},
-std::array<float,2>{0.517290056f, 0.601807296f},
-std::array<float,2>{0.0412724651f, 0.253776103f},
-std::array<float,2>{0.966415405f, 0.144297898f},
-std::array<float,2>{0.305691808f, 0.7563743f},
-std::array<float,2>{0.93586278f, 0.654506803f},
-std::array<float,2>{0.316348702f, 0.430406481f},
-std::array<float,2>{0.6000911f, 0.0313198492f},
-std::array<float,2>{0.120631985f, 0.982112229f},
-std::array<float,2>{0.669613957f, 0.817454636f},
-std::array<float,2>{0.1764047f, 0.22592549f},
-std::array<float,2>{0.78934443f, 0.334702909f},
-std::array<float,2>{0.475066096f, 0.526042521f},
-std::array<float,2>{0.802777767f, 0.870973587f},
-std::array<float,2>{0.499115229f, 0.208546579f},
-std::array<float,2>{0.68193996f, 0.350571126f},
-std::array<float,2>{0.156525001f, 0.556134105f},
-std::array<float,2>{0.614784062f, 0.663597405f},
-std::array<float,2>{0.106656171f, 0.386155039f},
-std::array<float,2>{0.907658935f, 0.0222446732f},
-std::array<float,2>{0.341394067f, 0.965675116f},
-std::array<float,2>{0.946792364f, 0.58007592f},
-std::array<float,2>{0.287150204f, 0.310346991f},
-std::array<float,2>{0.508741438f, 0.179347932f},
-std::array<float,2>{0.0504312254f, 0.789000154f},
-std::array<float,2>{0.692739189f, 0.908427238f},
-std::array<float,2>{0.196616113f, 0.101633266f},
-std::array<float,2>{0.82590431f, 0.453572541f},
-std::array<float,2>{0.388750762f, 0.72843051f},
-std::array<float,2>{0.887630761f, 0.993399084f},
-std::array<float,2>{0.374044091f, 0.0471985713f},
-std::array<float,2>{0.57424736f, 0.408914626f},
-std::array<float,2>{0.0873878151f, 0.62957412f},
-std::array<float,2>{0.627855539f, 0.508829355f},
-std::array<float,2>{0.130896255f, 0.318879992f},
-std::array<float,2>{0.751266837f, 0.24149695f},
-std::array<float,2>{0.453121632f, 0.840923607f},
-std::array<float,2>{0.854249477f, 0.698244452f},
-std::array<float,2>{0.41411379f, 0.475502759f},
-std::array<float,2>{0.727609873f, 0.0861638114f},
-std::array<float,2>{0.230467111f, 0.897153437f},
-std::array<float,2>{0.545268714f, 0.777462602f},
-std::array<float,2>{0.0263002664f, 0.129910037f},
-std::array<float,2>{0.997170925f, 0.273156673f},
-std::array<float,2>{0.265775561f, 0.61975646f},
-std::array<float,2>{0.915242434f, 0.835605204f},
-std::array<float,2>{0.33129096f, 0.243781f},
-std::array<float,2>{0.618760407f, 0.324879557f},
-std::array<float,2>{0.0976937935f, 0.507213891f},
-std::array<float,2>{0.676681399f, 0.63766557f},
-std::array<float,2>{0.169257134f, 0.416760385f},
-std::array<float,2>{0.810788691f, 0.0601849668f},
-std::array<float,2>{0.488710701f, 0.989677846f},
-std::array<float,2>{0.820018947f, 0.610043645f},
-std::array<float,2>{0.379606366f, 0.280587494f},
-std::array<float,2>{0.70242095f, 0.138592303f},
-std::array<float,2>{0.189195395f, 0.770593226f},
-std::array<float,2>{0.503437877f, 0.898847878f},
-std::array<float,2>{0.0560314879f, 0.0809184983f},
-std::array<float,2>{0.939305961f, 0.484231442f},
-std::array<float,2>{0.296123922f, 0.692376316f},
-std::array<float,2>{0.762627661f, 0.956425965f},
-std::array<float,2>{0.443127513f, 0.0273684822f},
-std::array<float,2>{0.635818601f, 0.376527816f},
-std::array<float,2>{0.137687236f, 0.666850746f},
-std::array<float,2>{0.564292252f, 0.554524124f},
-std::array<float,2>{0.0803467855f, 0.359015495f},
-std::array<float,2>{0.881729007f, 0.216562092f},
-std::array<float,2>{0.360176772f, 0.861658573f},
-std::array<float,2>{0.987507522f, 0.724221528f},
-std::array<float,2>{0.280175537f, 0.465919882f},
-std::array<float,2>{0.532112122f, 0.0955452248f},
-std::array<float,2>{0.0176240709f, 0.914691985f},
-std::array<float,2>{0.721578181f, 0.793354213f},
-std::array<float,2>{0.223489478f, 0.180821911f},
-std::array<float,2>{0.844255388f, 0.299497396f},
-std::array<float,2>{0.407474309f, 0.586425543f},
-std::array<float,2>{0.874686897f, 0.761758327f},
-std::array<float,2>{0.433129489f, 0.155241564f},
-std::array<float,2>{0.744056582f, 0.258788913f},
-std::array<float,2>{0.247215509f, 0.594950497f},
-std::array<float,2>{0.552478731f, 0.707253873f},
-std::array<float,2>{0.00382859935f, 0.489624053f},
-std::array<float,2>{0.969738185f, 0.0650906935f},
-std::array<float,2>{0.253448874f, 0.887294233f},
-std::array<float,2>{0.89241004f, 0.519811392f},
-std::array<float,2>{0.346724302f, 0.341792822f},
-std::array<float,2>{0.587800801f, 0.230947495f},
-std::array<float,2>{0.0658660829f, 0.822293818f},
-std::array<float,2>{0.649757862f, 0.97508657f},
-std::array<float,2>{0.15370658f, 0.043871861f},
-std::array<float,2>{0.774364054f, 0.428589195f},
-std::array<float,2>{0.45899561f, 0.647076428f},
-std::array<float,2>{0.955959082f, 0.931417763f},
-std::array<float,2>{0.299676418f, 0.119807392f},
-std::array<float,2>{0.529117644f, 0.445053011f},
-std::array<float,2>{0.0317102633f, 0.739230037f},
-std::array<float,2>{0.712975502f, 0.572399497f},
-std::array<float,2>{0.211388379f, 0.291237563f},
-std::array<float,2>{0.843363702f, 0.163078457f},
-std::array<float,2>{0.398684561f, 0.798128426f},
-std::array<float,2>{0.787600458f, 0.683098912f},
-std::array<float,2>{0.481649488f, 0.391656607f},
-std::array<float,2>{0.65978986f, 0.0083242869f},
-std::array<float,2>{0.183295801f, 0.952726901f},
-std::array<float,2>{0.602676988f, 0.85680002f},
-std::array<float,2>{0.110461846f, 0.192048758f},
-std::array<float,2>{0.925202131f, 0.363291562f},
-std::array<float,2>{0.326381475f, 0.546531975f},
-std::array<float,2>{0.943131745f, 0.845218122f},
-std::array<float,2>{0.292338401f, 0.198983952f},
-std::array<float,2>{0.504598141f, 0.370688736f},
-std::array<float,2>{0.0605696365f, 0.53898114f},
-std::array<float,2>{0.695426106f, 0.67727679f},
-std::array<float,2>{0.192722097f, 0.401675552f},
-std::array<float,2>{0.814873695f, 0.00011784595f},
-std::array<float,2>{0.377053142f, 0.941161573f},
-std::array<float,2>{0.808027029f, 0.569381535f},
-std::array<float,2>{0.487307221f, 0.282735795f},
-std::array<float,2>{0.671984434f, 0.168603182f},
-std::array<float,2>{0.166803122f, 0.810367107f},
-std::array<float,2>{0.621573448f, 0.922551155f},
-std::array<float,2>{0.095122166f, 0.116986394f},
-std::array<float,2>{0.921365142f, 0.450854212f},
-std::array<float,2>{0.334117055f, 0.749464333f},
-std::array<float,2>{0.849051297f, 0.978131056f},
-std::array<float,2>{0.413738579f, 0.0389335975f},
-std::array<float,2>{0.72459048f, 0.434066981f},
-std::array<float,2>{0.222324744f, 0.649039745f},
-std::array<float,2>{0.538872898f, 0.528560758f},
-std::array<float,2>{0.0213175006f, 0.33099699f},
-std::array<float,2>{0.989595354f, 0.219946906f},
-std::array<float,2>{0.275745213f, 0.814668655f},
-std::array<float,2>{0.87747401f, 0.715449929f},
-std::array<float,2>{0.365204453f, 0.499870121f},
-std::array<float,2>{0.567509413f, 0.0725517645f},
-std::array<float,2>{0.0838347971f, 0.88142693f},
-std::array<float,2>{0.638049066f, 0.751631558f},
-std::array<float,2>{0.133829355f, 0.148385048f},
-std::array<float,2>{0.761292994f, 0.255844504f},
-std::array<float,2>{0.440972894f, 0.605822504f},
-std::array<float,2>{0.778799117f, 0.782882154f},
-std::array<float,2>{0.456771016f, 0.174535125f},
-std::array<float,2>{0.65418613f, 0.307384223f},
-std::array<float,2>{0.151270613f, 0.584919393f},
-std::array<float,2>{0.59166044f, 0.731959403f},
-std::array<float,2>{0.067292437f, 0.460230678f},
-std::array<float,2>{0.897083759f, 0.107287951f},
-std::array<float,2>{0.349472284f, 0.91106993f},
-std::array<float,2>{0.972856939f, 0.559783459f},
-std::array<float,2>{0.255347878f, 0.345351636f},
-std::array<float,2>{0.550657332f, 0.204340398f},
-std::array<float,2>{0.00608290406f, 0.87397486f},
-std::array<float,2>{0.749927223f, 0.964409232f},
-std::array<float,2>{0.242951602f, 0.0162344519f},
-std::array<float,2>{0.870294988f, 0.387970358f},
-std::array<float,2>{0.435072988f, 0.656558216f},
-std::array<float,2>{0.927194834f, 0.892385304f},
-std::array<float,2>{0.324091524f, 0.093521297f},
-std::array<float,2>{0.605557442f, 0.469306618f},
-std::array<float,2>{0.11423564f, 0.701289058f},
-std::array<float,2>{0.661672592f, 0.622976303f},
-std::array<float,2>{0.186408162f, 0.266309679f},
-std::array<float,2>{0.784261823f, 0.126476943f},
-std::array<float,2>{0.480344892f, 0.776597917f},
-std::array<float,2>{0.837265134f, 0.628603995f},
-std::array<float,2>{0.402699262f, 0.413950771f},
-std::array<float,2>{0.717626274f, 0.0546172746f},
-std::array<float,2>{0.217893124f, 0.998579562f},
-std::array<float,2>{0.526262045f, 0.836235344f},
-std::array<float,2>{0.0357535742f, 0.23825708f},
-std::array<float,2>{0.958767295f, 0.315753788f},
-std::array<float,2>{0.304051101f, 0.511912227f},
-std::array<float,2>{0.903427124f, 0.766637862f},
-std::array<float,2>{0.358701855f, 0.134268135f},
-std::array<float,2>{0.580784321f, 0.275408745f},
-std::array<float,2>{0.0766504481f, 0.615731597f},
-std::array<float,2>{0.646302044f, 0.688561976f},
-std::array<float,2>{0.141036004f, 0.476623058f},
-std::array<float,2>{0.768766642f, 0.0852880329f},
-std::array<float,2>{0.462424308f, 0.905080497f},
-std::array<float,2>{0.860382199f, 0.501688123f},
-std::array<float,2>{0.423003286f, 0.323351979f},
-std::array<float,2>{0.73545444f, 0.247799903f},
-std::array<float,2>{0.237949938f, 0.829900503f},
-std::array<float,2>{0.561677277f, 0.985566854f},
-std::array<float,2>{0.0123594115f, 0.0579706244f},
-std::array<float,2>{0.97906822f, 0.420276612f},
-std::array<float,2>{0.262915522f, 0.635397315f},
-std::array<float,2>{0.79512912f, 0.918179274f},
-std::array<float,2>{0.472347796f, 0.098237969f},
-std::array<float,2>{0.665392995f, 0.461838603f},
-std::array<float,2>{0.172621593f, 0.720045626f},
-std::array<float,2>{0.597611248f, 0.592364967f},
-std::array<float,2>{0.121969029f, 0.30360043f},
-std::array<float,2>{0.930027425f, 0.184543774f},
-std::array<float,2>{0.318585277f, 0.789852262f},
-std::array<float,2>{0.963062882f, 0.670719147f},
-std::array<float,2>{0.312315017f, 0.380870193f},
-std::array<float,2>{0.520475388f, 0.0250879582f},
-std::array<float,2>{0.0464635007f, 0.95921886f},
-std::array<float,2>{0.706755102f, 0.864958405f},
-std::array<float,2>{0.2096719f, 0.212184593f},
-std::array<float,2>{0.828985393f, 0.352426291f},
-std::array<float,2>{0.396522433f, 0.548776984f},
-std::array<float,2>{0.821280539f, 0.82538265f},
-std::array<float,2>{0.384831965f, 0.22985512f},
-std::array<float,2>{0.689337909f, 0.336045116f},
-std::array<float,2>{0.201350868f, 0.517749846f},
-std::array<float,2>{0.513357997f, 0.642922997f},
-std::array<float,2>{0.0534129702f, 0.422267079f},
-std::array<float,2>{0.949419081f, 0.0397062041f},
-std::array<float,2>{0.281321645f, 0.970344126f},
-std::array<float,2>{0.912551105f, 0.598312736f},
-std::array<float,2>{0.336843193f, 0.261915833f},
-std::array<float,2>{0.613276482f, 0.149055764f},
-std::array<float,2>{0.10211014f, 0.761311471f},
-std::array<float,2>{0.685117483f, 0.884984314f},
-std::array<float,2>{0.160692707f, 0.0676955655f},
-std::array<float,2>{0.79712075f, 0.487407744f},
-std::array<float,2>{0.496038109f, 0.70498246f},
-std::array<float,2>{0.995445848f, 0.946713448f},
-std::array<float,2>{0.273047984f, 0.0130206225f},
-std::array<float,2>{0.5400213f, 0.396354079f},
-std::array<float,2>{0.030149173f, 0.687225342f},
-std::array<float,2>{0.732146561f, 0.542005122f},
-std::array<float,2>{0.234149545f, 0.360294014f},
-std::array<float,2>{0.857111752f, 0.188231975f},
-std::array<float,2>{0.420555353f, 0.854130089f},
-std::array<float,2>{0.756633937f, 0.735729337f},
-std::array<float,2>{0.448777914f, 0.439835221f},
-std::array<float,2>{0.630745113f, 0.124638468f},
-std::array<float,2>{0.126068607f, 0.936694741f},
-std::array<float,2>{0.574161172f, 0.801786482f},
-std::array<float,2>{0.091628395f, 0.158670515f},
-std::array<float,2>{0.884091437f, 0.294383913f},
-std::array<float,2>{0.368072599f, 0.574447155f},
-std::array<float,2>{0.996314168f, 0.780502081f},
-std::array<float,2>{0.267168045f, 0.130958259f},
-std::array<float,2>{0.546133697f, 0.270600915f},
-std::array<float,2>{0.0267373528f, 0.617219627f},
-std::array<float,2>{0.726983011f, 0.69671154f},
-std::array<float,2>{0.22935757f, 0.4727422f},
-std::array<float,2>{0.8551296f, 0.0879674777f},
-std::array<float,2>{0.41514191f, 0.895923495f},
-std::array<float,2>{0.750006139f, 0.510902405f},
-std::array<float,2>{0.451457858f, 0.316476196f},
-std::array<float,2>{0.628550649f, 0.238997608f},
-std::array<float,2>{0.13192758f, 0.842588007f},
-std::array<float,2>{0.575210929f, 0.994175196f},
-std::array<float,2>{0.0868281573f, 0.0496142618f},
-std::array<float,2>{0.888383925f, 0.408198059f},
-std::array<float,2>{0.37337178f, 0.63235718f},
-std::array<float,2>{0.824600458f, 0.907714188f},
-std::array<float,2>{0.390442699f, 0.104884706f},
-std::array<float,2>{0.692322373f, 0.455426127f},
-std::array<float,2>{0.196010306f, 0.730209947f},
-std::array<float,2>{0.509472132f, 0.580959737f},
-std::array<float,2>{0.0490593612f, 0.312207222f},
-std::array<float,2>{0.945710897f, 0.175810963f},
-std::array<float,2>{0.288606673f, 0.786383927f},
-std::array<float,2>{0.906572521f, 0.661229491f},
-std::array<float,2>{0.340291888f, 0.384753764f},
-std::array<float,2>{0.61404562f, 0.0207679085f},
-std::array<float,2>{0.106148288f, 0.96696192f},
-std::array<float,2>{0.683093607f, 0.868504524f},
-std::array<float,2>{0.157890841f, 0.209053546f},
-std::array<float,2>{0.80436939f, 0.347683489f},
-std::array<float,2>{0.498316646f, 0.557650864f},
-std::array<float,2>{0.790717483f, 0.819873691f},
-std::array<float,2>{0.476498276f, 0.224255279f},
-std::array<float,2>{0.668327808f, 0.333414167f},
-std::array<float,2>{0.177273273f, 0.525203168f},
-std::array<float,2>{0.601482689f, 0.652689159f},
-std::array<float,2>{0.119437337f, 0.432893097f},
-std::array<float,2>{0.93700999f, 0.0333506316f},
-std::array<float,2>{0.314648747f, 0.983972073f},
-std::array<float,2>{0.964990854f, 0.605403721f},
-std::array<float,2>{0.305379242f, 0.250410527f},
-std::array<float,2>{0.515700281f, 0.142169043f},
-std::array<float,2>{0.0419931598f, 0.754803479f},
-std::array<float,2>{0.708328903f, 0.875237525f},
-std::array<float,2>{0.204409853f, 0.074888289f},
-std::array<float,2>{0.833253205f, 0.493002236f},
-std::array<float,2>{0.392567873f, 0.711966217f},
-std::array<float,2>{0.900152326f, 0.942313492f},
-std::array<float,2>{0.354308486f, 0.00668331189f},
-std::array<float,2>{0.583474874f, 0.406083941f},
-std::array<float,2>{0.0719801858f, 0.674523056f},
-std::array<float,2>{0.640726924f, 0.533894479f},
-std::array<float,2>{0.147009194f, 0.371439427f},
-std::array<float,2>{0.772175789f, 0.200190112f},
-std::array<float,2>{0.465891659f, 0.848463833f},
-std::array<float,2>{0.867015958f, 0.745500147f},
-std::array<float,2>{0.429340363f, 0.449052423f},
-std::array<float,2>{0.738575459f, 0.111840412f},
-std::array<float,2>{0.240136042f, 0.926273346f},
-std::array<float,2>{0.557406247f, 0.806104124f},
-std::array<float,2>{0.0081741605f, 0.164230585f},
-std::array<float,2>{0.980769873f, 0.287444919f},
-std::array<float,2>{0.259505898f, 0.562695682f},
-std::array<float,2>{0.924471855f, 0.858251631f},
-std::array<float,2>{0.327714771f, 0.194222152f},
-std::array<float,2>{0.601817071f, 0.365621805f},
-std::array<float,2>{0.110142969f, 0.544461548f},
-std::array<float,2>{0.658610702f, 0.681215286f},
-std::array<float,2>{0.182123542f, 0.392818719f},
-std::array<float,2>{0.788140416f, 0.0109538715f},
-std::array<float,2>{0.481286377f, 0.949926615f},
-std::array<float,2>{0.841821551f, 0.570488214f},
-std::array<float,2>{0.399981469f, 0.290800691f},
-std::array<float,2>{0.71421212f, 0.160977513f},
-std::array<float,2>{0.212393939f, 0.798997343f},
-std::array<float,2>{0.527588665f, 0.932434976f},
-std::array<float,2>{0.0326261669f, 0.118369073f},
-std::array<float,2>{0.956679881f, 0.441498667f},
-std::array<float,2>{0.300328493f, 0.741362572f},
-std::array<float,2>{0.775013626f, 0.972989202f},
-std::array<float,2>{0.460337937f, 0.0460659899f},
-std::array<float,2>{0.649409473f, 0.42628938f},
-std::array<float,2>{0.153302252f, 0.645984888f},
-std::array<float,2>{0.585963607f, 0.52231729f},
-std::array<float,2>{0.0647359192f, 0.342014819f},
-std::array<float,2>{0.890988827f, 0.233245865f},
-std::array<float,2>{0.346533477f, 0.820933878f},
-std::array<float,2>{0.969400406f, 0.710509896f},
-std::array<float,2>{0.252576441f, 0.491694301f},
-std::array<float,2>{0.55150938f, 0.0627562106f},
-std::array<float,2>{0.00250876788f, 0.890232444f},
-std::array<float,2>{0.743011892f, 0.764389873f},
-std::array<float,2>{0.246589407f, 0.153764218f},
-std::array<float,2>{0.873681903f, 0.261366874f},
-std::array<float,2>{0.432157427f, 0.596160114f},
-std::array<float,2>{0.845681906f, 0.7968449f},
-std::array<float,2>{0.406768918f, 0.182875738f},
-std::array<float,2>{0.721962392f, 0.298228174f},
-std::array<float,2>{0.22416988f, 0.589062333f},
-std::array<float,2>{0.532293677f, 0.725928843f},
-std::array<float,2>{0.0195087176f, 0.467819005f},
-std::array<float,2>{0.987043023f, 0.0963643566f},
-std::array<float,2>{0.280510992f, 0.916132748f},
-std::array<float,2>{0.882207513f, 0.550958097f},
-std::array<float,2>{0.361108691f, 0.35676527f},
-std::array<float,2>{0.562515259f, 0.2182111f},
-std::array<float,2>{0.0819966048f, 0.860925853f},
-std::array<float,2>{0.635027051f, 0.954366207f},
-std::array<float,2>{0.138566792f, 0.0300957765f},
-std::array<float,2>{0.763254821f, 0.378277153f},
-std::array<float,2>{0.441764623f, 0.664210141f},
-std::array<float,2>{0.937812805f, 0.90147835f},
-std::array<float,2>{0.295391679f, 0.0798968002f},
-std::array<float,2>{0.502891362f, 0.482334912f},
-std::array<float,2>{0.0547541417f, 0.693974197f},
-std::array<float,2>{0.701367319f, 0.61189121f},
-std::array<float,2>{0.187972426f, 0.277422637f},
-std::array<float,2>{0.819110155f, 0.140141517f},
-std::array<float,2>{0.380656183f, 0.772680044f},
-std::array<float,2>{0.811874211f, 0.638787925f},
-std::array<float,2>{0.489991933f, 0.414935797f},
-std::array<float,2>{0.677539706f, 0.061438553f},
-std::array<float,2>{0.168362081f, 0.990791678f},
-std::array<float,2>{0.617567658f, 0.832870603f},
-std::array<float,2>{0.0991821513f, 0.24478291f},
-std::array<float,2>{0.914449573f, 0.32639423f},
-std::array<float,2>{0.330513865f, 0.504790187f},
-std::array<float,2>{0.957081318f, 0.83879894f},
-std::array<float,2>{0.302983016f, 0.236157194f},
-std::array<float,2>{0.526428998f, 0.313784868f},
-std::array<float,2>{0.0365005136f, 0.513871431f},
-std::array<float,2>{0.718161345f, 0.625589669f},
-std::array<float,2>{0.21703276f, 0.410360813f},
-std::array<float,2>{0.836278319f, 0.0517407097f},
-std::array<float,2>{0.40358755f, 0.996524632f},
-std::array<float,2>{0.784164131f, 0.624203026f},
-std::array<float,2>{0.479131728f, 0.268868834f},
-std::array<float,2>{0.661055982f, 0.127061322f},
-std::array<float,2>{0.187450856f, 0.774919808f},
-std::array<float,2>{0.607136309f, 0.892581999f},
-std::array<float,2>{0.115214504f, 0.0907527432f},
-std::array<float,2>{0.926648259f, 0.470935971f},
-std::array<float,2>{0.322889119f, 0.700197518f},
-std::array<float,2>{0.869332314f, 0.962336004f},
-std::array<float,2>{0.433973998f, 0.0185879655f},
-std::array<float,2>{0.748787045f, 0.389068574f},
-std::array<float,2>{0.243362278f, 0.658481956f},
-std::array<float,2>{0.549255431f, 0.561536491f},
-std::array<float,2>{0.00764820445f, 0.346371233f},
-std::array<float,2>{0.973832965f, 0.205514058f},
-std::array<float,2>{0.254706234f, 0.872479677f},
-std::array<float,2>{0.898402989f, 0.734102666f},
-std::array<float,2>{0.348049045f, 0.458018214f},
-std::array<float,2>{0.590530574f, 0.108068801f},
-std::array<float,2>{0.0680311918f, 0.912189305f},
-std::array<float,2>{0.65331614f, 0.784924686f},
-std::array<float,2>{0.151937425f, 0.172054172f},
-std::array<float,2>{0.777540982f, 0.305090427f},
-std::array<float,2>{0.456053525f, 0.583364189f},
-std::array<float,2>{0.760389745f, 0.752459824f},
-std::array<float,2>{0.440400153f, 0.145293146f},
-std::array<float,2>{0.637270749f, 0.257178545f},
-std::array<float,2>{0.132998794f, 0.608817875f},
-std::array<float,2>{0.566967428f, 0.717044771f},
-std::array<float,2>{0.0824568644f, 0.49740985f},
-std::array<float,2>{0.878839672f, 0.0712000579f},
-std::array<float,2>{0.363747746f, 0.879352093f},
-std::array<float,2>{0.989030719f, 0.53087157f},
-std::array<float,2>{0.277188033f, 0.328282624f},
-std::array<float,2>{0.537522554f, 0.222354859f},
-std::array<float,2>{0.0202854723f, 0.813147545f},
-std::array<float,2>{0.722805858f, 0.979809105f},
-std::array<float,2>{0.221153706f, 0.0363323316f},
-std::array<float,2>{0.847876728f, 0.436849922f},
-std::array<float,2>{0.412482619f, 0.652083158f},
-std::array<float,2>{0.920349956f, 0.924731016f},
-std::array<float,2>{0.335279673f, 0.113438576f},
-std::array<float,2>{0.623013794f, 0.452593714f},
-std::array<float,2>{0.0944268405f, 0.747120023f},
-std::array<float,2>{0.673661411f, 0.566407502f},
-std::array<float,2>{0.167203009f, 0.284394115f},
-std::array<float,2>{0.807246983f, 0.170615479f},
-std::array<float,2>{0.48659426f, 0.811954498f},
-std::array<float,2>{0.816099942f, 0.678075373f},
-std::array<float,2>{0.378290236f, 0.399894565f},
-std::array<float,2>{0.696362913f, 0.00248367782f},
-std::array<float,2>{0.192091137f, 0.937949419f},
-std::array<float,2>{0.505522728f, 0.847317457f},
-std::array<float,2>{0.0619733892f, 0.196321443f},
-std::array<float,2>{0.941731751f, 0.368486643f},
-std::array<float,2>{0.291518897f, 0.535809815f},
-std::array<float,2>{0.88299644f, 0.803652167f},
-std::array<float,2>{0.368761361f, 0.15737398f},
-std::array<float,2>{0.572745383f, 0.295255601f},
-std::array<float,2>{0.0898874477f, 0.576188862f},
-std::array<float,2>{0.629575908f, 0.738209724f},
-std::array<float,2>{0.125076473f, 0.439312428f},
-std::array<float,2>{0.757118821f, 0.122220717f},
-std::array<float,2>{0.44797197f, 0.933721364f},
-std::array<float,2>{0.85618639f, 0.539916515f},
-std::array<float,2>{0.421403199f, 0.362706155f},
-std::array<float,2>{0.73143667f, 0.19060269f},
-std::array<float,2>{0.233258322f, 0.8517313f},
-std::array<float,2>{0.540243864f, 0.948199749f},
-std::array<float,2>{0.0304829981f, 0.0141018052f},
-std::array<float,2>{0.994620979f, 0.396855026f},
-std::array<float,2>{0.272313535f, 0.68501544f},
-std::array<float,2>{0.798222601f, 0.884103298f},
-std::array<float,2>{0.494871497f, 0.069209516f},
-std::array<float,2>{0.683647633f, 0.484611034f},
-std::array<float,2>{0.161734477f, 0.70610857f},
-std::array<float,2>{0.612283766f, 0.601136744f},
-std::array<float,2>{0.103201322f, 0.263711482f},
-std::array<float,2>{0.913509369f, 0.150437832f},
-std::array<float,2>{0.337070763f, 0.758154571f},
-std::array<float,2>{0.950818777f, 0.641911268f},
-std::array<float,2>{0.283020258f, 0.424746722f},
-std::array<float,2>{0.512654543f, 0.0421794206f},
-std::array<float,2>{0.0542055331f, 0.970800579f},
-std::array<float,2>{0.687697768f, 0.82636106f},
-std::array<float,2>{0.202410549f, 0.226951048f},
-std::array<float,2>{0.822239339f, 0.33822006f},
-std::array<float,2>{0.385791868f, 0.515788555f},
-std::array<float,2>{0.829597354f, 0.865403056f},
-std::array<float,2>{0.398311406f, 0.21365501f},
-std::array<float,2>{0.705893517f, 0.353540987f},
-std::array<float,2>{0.210587576f, 0.549463212f},
-std::array<float,2>{0.521031559f, 0.668439925f},
-std::array<float,2>{0.0455534793f, 0.380558372f},
-std::array<float,2>{0.964782834f, 0.0263513047f},
-std::array<float,2>{0.311161786f, 0.957440734f},
-std::array<float,2>{0.931412995f, 0.590201318f},
-std::array<float,2>{0.31944719f, 0.301063418f},
-std::array<float,2>{0.596322775f, 0.187177092f},
-std::array<float,2>{0.123003766f, 0.791539967f},
-std::array<float,2>{0.66424799f, 0.921814561f},
-std::array<float,2>{0.172885746f, 0.101288281f},
-std::array<float,2>{0.796049774f, 0.464775473f},
-std::array<float,2>{0.471071392f, 0.722004533f},
-std::array<float,2>{0.98032099f, 0.987363338f},
-std::array<float,2>{0.262489825f, 0.0553913265f},
-std::array<float,2>{0.560932636f, 0.418552697f},
-std::array<float,2>{0.0131347505f, 0.633666992f},
-std::array<float,2>{0.734978199f, 0.503257394f},
-std::array<float,2>{0.236712217f, 0.321546137f},
-std::array<float,2>{0.859486878f, 0.248347849f},
-std::array<float,2>{0.422109723f, 0.83080709f},
-std::array<float,2>{0.768344641f, 0.690436304f},
-std::array<float,2>{0.461416453f, 0.479147315f},
-std::array<float,2>{0.645039082f, 0.0830574036f},
-std::array<float,2>{0.142420053f, 0.90310955f},
-std::array<float,2>{0.581383824f, 0.768021166f},
-std::array<float,2>{0.0780103505f, 0.136193529f},
-std::array<float,2>{0.902752519f, 0.275080979f},
-std::array<float,2>{0.357649684f, 0.61332041f},
-std::array<float,2>{0.948579013f, 0.787256658f},
-std::array<float,2>{0.285363466f, 0.178158954f},
-std::array<float,2>{0.510974348f, 0.309489787f},
-std::array<float,2>{0.0484192893f, 0.578577042f},
-std::array<float,2>{0.694613636f, 0.727342904f},
-std::array<float,2>{0.197843194f, 0.454935521f},
-std::array<float,2>{0.827402472f, 0.102824375f},
-std::array<float,2>{0.38741985f, 0.909963906f},
-std::array<float,2>{0.801458061f, 0.554975748f},
-std::array<float,2>{0.496509075f, 0.351048887f},
-std::array<float,2>{0.681060553f, 0.207863644f},
-std::array<float,2>{0.158741295f, 0.869639993f},
-std::array<float,2>{0.615447819f, 0.966714442f},
-std::array<float,2>{0.108076893f, 0.0229384061f},
-std::array<float,2>{0.909871817f, 0.385251582f},
-std::array<float,2>{0.343668073f, 0.662403226f},
-std::array<float,2>{0.851640344f, 0.898082793f},
-std::array<float,2>{0.416348398f, 0.0874132961f},
-std::array<float,2>{0.728592575f, 0.47609058f},
-std::array<float,2>{0.226687446f, 0.698082805f},
-std::array<float,2>{0.544625223f, 0.620392203f},
-std::array<float,2>{0.024455091f, 0.271772027f},
-std::array<float,2>{0.999887764f, 0.129138529f},
-std::array<float,2>{0.269121915f, 0.77845782f},
-std::array<float,2>{0.888833761f, 0.630387783f},
-std::array<float,2>{0.372177213f, 0.409981251f},
-std::array<float,2>{0.576713383f, 0.0485814139f},
-std::array<float,2>{0.0885269642f, 0.993150234f},
-std::array<float,2>{0.626914322f, 0.84019351f},
-std::array<float,2>{0.129706547f, 0.241001025f},
-std::array<float,2>{0.753073871f, 0.319523364f},
-std::array<float,2>{0.449927956f, 0.50838685f},
-std::array<float,2>{0.770117939f, 0.850521803f},
-std::array<float,2>{0.467398703f, 0.201512367f},
-std::array<float,2>{0.643499494f, 0.373471528f},
-std::array<float,2>{0.146118939f, 0.531700671f},
-std::array<float,2>{0.585221052f, 0.672843814f},
-std::array<float,2>{0.0727573782f, 0.403797805f},
-std::array<float,2>{0.900406122f, 0.00575411366f},
-std::array<float,2>{0.352127552f, 0.944934666f},
-std::array<float,2>{0.983834445f, 0.565129697f},
-std::array<float,2>{0.260138839f, 0.286962271f},
-std::array<float,2>{0.555727124f, 0.16668652f},
-std::array<float,2>{0.0116172833f, 0.80758059f},
-std::array<float,2>{0.740498543f, 0.928630352f},
-std::array<float,2>{0.241977811f, 0.110408396f},
-std::array<float,2>{0.865180671f, 0.446588457f},
-std::array<float,2>{0.426683426f, 0.742557943f},
-std::array<float,2>{0.93514353f, 0.981296182f},
-std::array<float,2>{0.314199388f, 0.0323403813f},
-std::array<float,2>{0.598702252f, 0.431222975f},
-std::array<float,2>{0.118129857f, 0.656002879f},
-std::array<float,2>{0.670408964f, 0.527206004f},
-std::array<float,2>{0.178894028f, 0.335476369f},
-std::array<float,2>{0.792897344f, 0.224795103f},
-std::array<float,2>{0.472910792f, 0.816666007f},
-std::array<float,2>{0.834115207f, 0.713037014f},
-std::array<float,2>{0.392726511f, 0.495008498f},
-std::array<float,2>{0.709912062f, 0.0776751563f},
-std::array<float,2>{0.205206424f, 0.878703833f},
-std::array<float,2>{0.518540263f, 0.757703781f},
-std::array<float,2>{0.0405148603f, 0.143217281f},
-std::array<float,2>{0.968479216f, 0.252180696f},
-std::array<float,2>{0.307734936f, 0.603358805f},
-std::array<float,2>{0.894427896f, 0.824182868f},
-std::array<float,2>{0.344691962f, 0.231922448f},
-std::array<float,2>{0.588374078f, 0.34027189f},
-std::array<float,2>{0.0629373863f, 0.520525992f},
-std::array<float,2>{0.651080132f, 0.648183823f},
-std::array<float,2>{0.155729532f, 0.428836852f},
-std::array<float,2>{0.775446057f, 0.0447884053f},
-std::array<float,2>{0.45890376f, 0.976282179f},
-std::array<float,2>{0.872787952f, 0.594564319f},
-std::array<float,2>{0.43027091f, 0.259253561f},
-std::array<float,2>{0.74427563f, 0.155866757f},
-std::array<float,2>{0.249231234f, 0.762831867f},
-std::array<float,2>{0.554556787f, 0.8884992f},
-std::array<float,2>{0.000288839103f, 0.0660860091f},
-std::array<float,2>{0.971507609f, 0.488313287f},
-std::array<float,2>{0.250198841f, 0.708717465f},
-std::array<float,2>{0.786636055f, 0.95175904f},
-std::array<float,2>{0.483736157f, 0.00881690253f},
-std::array<float,2>{0.657340527f, 0.391376913f},
-std::array<float,2>{0.180003345f, 0.681679547f},
-std::array<float,2>{0.603662729f, 0.544924736f},
-std::array<float,2>{0.111393839f, 0.364355356f},
-std::array<float,2>{0.923533499f, 0.192506358f},
-std::array<float,2>{0.325965643f, 0.856433153f},
-std::array<float,2>{0.953332722f, 0.740062475f},
-std::array<float,2>{0.298156768f, 0.443756342f},
-std::array<float,2>{0.530442417f, 0.120180905f},
-std::array<float,2>{0.0346904099f, 0.929858863f},
-std::array<float,2>{0.711034f, 0.797291338f},
-std::array<float,2>{0.213649929f, 0.163919404f},
-std::array<float,2>{0.841790497f, 0.292284012f},
-std::array<float,2>{0.402056664f, 0.573707402f},
-std::array<float,2>{0.816887975f, 0.769969821f},
-std::array<float,2>{0.382784307f, 0.136919394f},
-std::array<float,2>{0.700635076f, 0.279408872f},
-std::array<float,2>{0.189715266f, 0.610635042f},
-std::array<float,2>{0.500486791f, 0.693201244f},
-std::array<float,2>{0.056883432f, 0.48277089f},
-std::array<float,2>{0.940722108f, 0.0817223042f},
-std::array<float,2>{0.294624656f, 0.90002054f},
-std::array<float,2>{0.916995227f, 0.506128907f},
-std::array<float,2>{0.328467935f, 0.326107383f},
-std::array<float,2>{0.619802237f, 0.242864922f},
-std::array<float,2>{0.100638993f, 0.834212005f},
-std::array<float,2>{0.677949309f, 0.989241004f},
-std::array<float,2>{0.17033346f, 0.0591530018f},
-std::array<float,2>{0.810072958f, 0.417167634f},
-std::array<float,2>{0.49032101f, 0.638525248f},
-std::array<float,2>{0.985499561f, 0.915085435f},
-std::array<float,2>{0.279228598f, 0.09409412f},
-std::array<float,2>{0.53368783f, 0.465734154f},
-std::array<float,2>{0.0163755305f, 0.722713828f},
-std::array<float,2>{0.720305383f, 0.587648451f},
-std::array<float,2>{0.22640948f, 0.299817681f},
-std::array<float,2>{0.847607255f, 0.179760098f},
-std::array<float,2>{0.408237606f, 0.794449627f},
-std::array<float,2>{0.76389724f, 0.667582154f},
-std::array<float,2>{0.444639146f, 0.375002742f},
-std::array<float,2>{0.633447289f, 0.0289190132f},
-std::array<float,2>{0.139373571f, 0.955631256f},
-std::array<float,2>{0.566215336f, 0.863173783f},
-std::array<float,2>{0.078960456f, 0.214965671f},
-std::array<float,2>{0.880083442f, 0.358253419f},
-std::array<float,2>{0.361659646f, 0.553153217f},
-std::array<float,2>{0.976369381f, 0.874792933f},
-std::array<float,2>{0.257260203f, 0.203895822f},
-std::array<float,2>{0.5479877f, 0.344228238f},
-std::array<float,2>{0.00479034241f, 0.558916569f},
-std::array<float,2>{0.746216893f, 0.657304227f},
-std::array<float,2>{0.244984284f, 0.386724412f},
-std::array<float,2>{0.867325425f, 0.017060427f},
-std::array<float,2>{0.437227756f, 0.963678777f},
-std::array<float,2>{0.780588686f, 0.585011005f},
-std::array<float,2>{0.454874903f, 0.308259398f},
-std::array<float,2>{0.654686213f, 0.174969018f},
-std::array<float,2>{0.149374336f, 0.781975269f},
-std::array<float,2>{0.592452705f, 0.911227643f},
-std::array<float,2>{0.0696722642f, 0.106071211f},
-std::array<float,2>{0.896130741f, 0.459343702f},
-std::array<float,2>{0.351171374f, 0.730538845f},
-std::array<float,2>{0.838335335f, 0.999649346f},
-std::array<float,2>{0.405086368f, 0.0528491549f},
-std::array<float,2>{0.716714561f, 0.412645191f},
-std::array<float,2>{0.215090141f, 0.626993418f},
-std::array<float,2>{0.524942398f, 0.51336503f},
-std::array<float,2>{0.038481351f, 0.314901292f},
-std::array<float,2>{0.960191488f, 0.236612871f},
-std::array<float,2>{0.301916063f, 0.837632716f},
-std::array<float,2>{0.929515123f, 0.702217996f},
-std::array<float,2>{0.320828289f, 0.469962329f},
-std::array<float,2>{0.608706594f, 0.0918188766f},
-std::array<float,2>{0.117067285f, 0.891183257f},
-std::array<float,2>{0.662679315f, 0.77579236f},
-std::array<float,2>{0.185459882f, 0.125751942f},
-std::array<float,2>{0.783066213f, 0.26754871f},
-std::array<float,2>{0.477046102f, 0.622017324f},
-std::array<float,2>{0.80651778f, 0.809309721f},
-std::array<float,2>{0.48546198f, 0.169399485f},
-std::array<float,2>{0.674551427f, 0.28159827f},
-std::array<float,2>{0.165353164f, 0.568915844f},
-std::array<float,2>{0.624688864f, 0.748705685f},
-std::array<float,2>{0.0958012715f, 0.45016852f},
-std::array<float,2>{0.91866374f, 0.116141103f},
-std::array<float,2>{0.332941681f, 0.922942996f},
-std::array<float,2>{0.945095956f, 0.537836134f},
-std::array<float,2>{0.28942132f, 0.370077401f},
-std::array<float,2>{0.507377088f, 0.197624162f},
-std::array<float,2>{0.0601961724f, 0.844097257f},
-std::array<float,2>{0.698774219f, 0.940330803f},
-std::array<float,2>{0.193895534f, 0.00159465114f},
-std::array<float,2>{0.812820733f, 0.400458455f},
-std::array<float,2>{0.376881331f, 0.676684022f},
-std::array<float,2>{0.876226544f, 0.88212949f},
-std::array<float,2>{0.366157502f, 0.0734009221f},
-std::array<float,2>{0.568843842f, 0.498579532f},
-std::array<float,2>{0.0844527632f, 0.71676302f},
-std::array<float,2>{0.639853716f, 0.607221186f},
-std::array<float,2>{0.136463776f, 0.253953874f},
-std::array<float,2>{0.758254647f, 0.147002935f},
-std::array<float,2>{0.437697738f, 0.750255883f},
-std::array<float,2>{0.850091994f, 0.649866045f},
-std::array<float,2>{0.41148001f, 0.435475141f},
-std::array<float,2>{0.726123452f, 0.0377707556f},
-std::array<float,2>{0.219180673f, 0.977494001f},
-std::array<float,2>{0.535454631f, 0.81576997f},
-std::array<float,2>{0.0223400034f, 0.21917294f},
-std::array<float,2>{0.990927935f, 0.331199199f},
-std::array<float,2>{0.27348724f, 0.527408004f},
-std::array<float,2>{0.91046387f, 0.760511577f},
-std::array<float,2>{0.339194536f, 0.149853617f},
-std::array<float,2>{0.609707475f, 0.262844712f},
-std::array<float,2>{0.104501277f, 0.598821819f},
-std::array<float,2>{0.687190175f, 0.704049647f},
-std::array<float,2>{0.162896514f, 0.487022221f},
-std::array<float,2>{0.799912035f, 0.0673823729f},
-std::array<float,2>{0.493162394f, 0.886397839f},
-std::array<float,2>{0.823824465f, 0.519111395f},
-std::array<float,2>{0.383951843f, 0.337850064f},
-std::array<float,2>{0.691105783f, 0.229334235f},
-std::array<float,2>{0.199729517f, 0.825054467f},
-std::array<float,2>{0.514741838f, 0.968978226f},
-std::array<float,2>{0.0519104563f, 0.040398106f},
-std::array<float,2>{0.952576637f, 0.423208803f},
-std::array<float,2>{0.284334421f, 0.643893063f},
-std::array<float,2>{0.755225718f, 0.93555218f},
-std::array<float,2>{0.445994616f, 0.123494551f},
-std::array<float,2>{0.631472051f, 0.440594941f},
-std::array<float,2>{0.128399044f, 0.734523535f},
-std::array<float,2>{0.571504474f, 0.576100945f},
-std::array<float,2>{0.0919186324f, 0.293403745f},
-std::array<float,2>{0.885949552f, 0.15968737f},
-std::array<float,2>{0.369930357f, 0.801293731f},
-std::array<float,2>{0.993231654f, 0.686106622f},
-std::array<float,2>{0.271467805f, 0.394902647f},
-std::array<float,2>{0.541413724f, 0.0125284363f},
-std::array<float,2>{0.0281897653f, 0.945780993f},
-std::array<float,2>{0.732701838f, 0.854876757f},
-std::array<float,2>{0.231643781f, 0.188664943f},
-std::array<float,2>{0.858881056f, 0.360396266f},
-std::array<float,2>{0.419871956f, 0.541283071f},
-std::array<float,2>{0.861725748f, 0.828894317f},
-std::array<float,2>{0.42454046f, 0.246551886f},
-std::array<float,2>{0.737244368f, 0.323240161f},
-std::array<float,2>{0.236315772f, 0.500354946f},
-std::array<float,2>{0.559717059f, 0.636255205f},
-std::array<float,2>{0.0139504997f, 0.420921504f},
-std::array<float,2>{0.976897299f, 0.057112731f},
-std::array<float,2>{0.265435398f, 0.98462683f},
-std::array<float,2>{0.90618813f, 0.616799295f},
-std::array<float,2>{0.356202245f, 0.276698112f},
-std::array<float,2>{0.579139233f, 0.133706197f},
-std::array<float,2>{0.0754769146f, 0.76600641f},
-std::array<float,2>{0.647011459f, 0.90558666f},
-std::array<float,2>{0.143610626f, 0.0848177746f},
-std::array<float,2>{0.767093778f, 0.47781837f},
-std::array<float,2>{0.46415925f, 0.687803268f},
-std::array<float,2>{0.961484492f, 0.960506499f},
-std::array<float,2>{0.310526699f, 0.0238011256f},
-std::array<float,2>{0.52178216f, 0.382316709f},
-std::array<float,2>{0.0435357764f, 0.671356678f},
-std::array<float,2>{0.703229129f, 0.547131658f},
-std::array<float,2>{0.208310142f, 0.352960825f},
-std::array<float,2>{0.830537856f, 0.211182266f},
-std::array<float,2>{0.395275474f, 0.863769293f},
-std::array<float,2>{0.794737995f, 0.719100118f},
-std::array<float,2>{0.469876796f, 0.46201849f},
-std::array<float,2>{0.666491747f, 0.0987231806f},
-std::array<float,2>{0.174479932f, 0.91971153f},
-std::array<float,2>{0.593938768f, 0.790265322f},
-std::array<float,2>{0.124613605f, 0.184595212f},
-std::array<float,2>{0.931831479f, 0.304437041f},
-std::array<float,2>{0.31701839f, 0.593488634f},
-std::array<float,2>{0.959712863f, 0.775165558f},
-std::array<float,2>{0.301022261f, 0.127331793f},
-std::array<float,2>{0.5236063f, 0.268656135f},
-std::array<float,2>{0.0375094861f, 0.624424458f},
-std::array<float,2>{0.715170622f, 0.70058161f},
-std::array<float,2>{0.216482893f, 0.471008152f},
-std::array<float,2>{0.839456379f, 0.0904023573f},
-std::array<float,2>{0.405539036f, 0.892930567f},
-std::array<float,2>{0.781629562f, 0.513994455f},
-std::array<float,2>{0.477972716f, 0.313581645f},
-std::array<float,2>{0.663590908f, 0.236022547f},
-std::array<float,2>{0.183675081f, 0.838507533f},
-std::array<float,2>{0.607781947f, 0.99623704f},
-std::array<float,2>{0.115273885f, 0.051449433f},
-std::array<float,2>{0.928677022f, 0.410473883f},
-std::array<float,2>{0.321709841f, 0.625850022f},
-std::array<float,2>{0.868320405f, 0.912511349f},
-std::array<float,2>{0.436033458f, 0.108299375f},
-std::array<float,2>{0.747590065f, 0.458409667f},
-std::array<float,2>{0.245827645f, 0.734302282f},
-std::array<float,2>{0.546936333f, 0.583245456f},
-std::array<float,2>{0.00581846246f, 0.304841846f},
-std::array<float,2>{0.975561559f, 0.172132298f},
-std::array<float,2>{0.256086975f, 0.784718871f},
-std::array<float,2>{0.894794345f, 0.658428192f},
-std::array<float,2>{0.350024879f, 0.388682693f},
-std::array<float,2>{0.593286932f, 0.0188000556f},
-std::array<float,2>{0.0686324835f, 0.961966634f},
-std::array<float,2>{0.655592799f, 0.872241497f},
-std::array<float,2>{0.149722785f, 0.205108002f},
-std::array<float,2>{0.779687107f, 0.346574754f},
-std::array<float,2>{0.454099417f, 0.56190151f},
-std::array<float,2>{0.759715915f, 0.813359737f},
-std::array<float,2>{0.438777119f, 0.222512662f},
-std::array<float,2>{0.639164925f, 0.328473955f},
-std::array<float,2>{0.135603979f, 0.531034708f},
-std::array<float,2>{0.569399536f, 0.652295649f},
-std::array<float,2>{0.0854523256f, 0.436648339f},
-std::array<float,2>{0.875279963f, 0.0364486389f},
-std::array<float,2>{0.366735905f, 0.979657114f},
-std::array<float,2>{0.991889656f, 0.608541846f},
-std::array<float,2>{0.274788916f, 0.257010162f},
-std::array<float,2>{0.536647379f, 0.145163551f},
-std::array<float,2>{0.022722099f, 0.752916336f},
-std::array<float,2>{0.725051224f, 0.879095733f},
-std::array<float,2>{0.220601797f, 0.0710278526f},
-std::array<float,2>{0.850723684f, 0.497131288f},
-std::array<float,2>{0.410593539f, 0.716799915f},
-std::array<float,2>{0.9190256f, 0.937712014f},
-std::array<float,2>{0.33372286f, 0.00286277849f},
-std::array<float,2>{0.623299778f, 0.399545908f},
-std::array<float,2>{0.0970384479f, 0.677759647f},
-std::array<float,2>{0.675049901f, 0.535889208f},
-std::array<float,2>{0.164266646f, 0.368176132f},
-std::array<float,2>{0.804837227f, 0.19654876f},
-std::array<float,2>{0.484967053f, 0.847565234f},
-std::array<float,2>{0.814175963f, 0.747391701f},
-std::array<float,2>{0.375172883f, 0.452216983f},
-std::array<float,2>{0.698016167f, 0.113548994f},
-std::array<float,2>{0.194743797f, 0.924364209f},
-std::array<float,2>{0.506483614f, 0.811535895f},
-std::array<float,2>{0.059381932f, 0.170655191f},
-std::array<float,2>{0.944226921f, 0.284469843f},
-std::array<float,2>{0.290929168f, 0.566716492f},
-std::array<float,2>{0.884852052f, 0.852028012f},
-std::array<float,2>{0.37071076f, 0.190716803f},
-std::array<float,2>{0.571038723f, 0.362332463f},
-std::array<float,2>{0.0929627195f, 0.539596975f},
-std::array<float,2>{0.631873846f, 0.684750319f},
-std::array<float,2>{0.12787582f, 0.3967112f},
-std::array<float,2>{0.754406869f, 0.013722484f},
-std::array<float,2>{0.446808159f, 0.947980821f},
-std::array<float,2>{0.858391881f, 0.576471746f},
-std::array<float,2>{0.418272138f, 0.294964582f},
-std::array<float,2>{0.734248817f, 0.157598585f},
-std::array<float,2>{0.230535179f, 0.803435206f},
-std::array<float,2>{0.542430341f, 0.933929861f},
-std::array<float,2>{0.0289674476f, 0.122505255f},
-std::array<float,2>{0.992620111f, 0.439056575f},
-std::array<float,2>{0.269745529f, 0.737844288f},
-std::array<float,2>{0.799373686f, 0.971105576f},
-std::array<float,2>{0.493761361f, 0.0424399711f},
-std::array<float,2>{0.685708344f, 0.424442112f},
-std::array<float,2>{0.163095698f, 0.641749799f},
-std::array<float,2>{0.611005366f, 0.515888035f},
-std::array<float,2>{0.104031697f, 0.338001251f},
-std::array<float,2>{0.91114527f, 0.226626649f},
-std::array<float,2>{0.338738203f, 0.826437533f},
-std::array<float,2>{0.952025414f, 0.706341386f},
-std::array<float,2>{0.283721685f, 0.484735727f},
-std::array<float,2>{0.514306605f, 0.0688538179f},
-std::array<float,2>{0.0510898009f, 0.883936226f},
-std::array<float,2>{0.690218568f, 0.757879317f},
-std::array<float,2>{0.201103687f, 0.150742218f},
-std::array<float,2>{0.823219538f, 0.263970554f},
-std::array<float,2>{0.383104533f, 0.601413369f},
-std::array<float,2>{0.831644893f, 0.791886091f},
-std::array<float,2>{0.396456361f, 0.187390551f},
-std::array<float,2>{0.704432487f, 0.300829411f},
-std::array<float,2>{0.2070577f, 0.58987993f},
-std::array<float,2>{0.522582829f, 0.72175324f},
-std::array<float,2>{0.0441483073f, 0.464467466f},
-std::array<float,2>{0.962553084f, 0.10147047f},
-std::array<float,2>{0.309360743f, 0.921456635f},
-std::array<float,2>{0.933060408f, 0.549708009f},
-std::array<float,2>{0.31811139f, 0.353927225f},
-std::array<float,2>{0.595501602f, 0.213524356f},
-std::array<float,2>{0.123891301f, 0.86562252f},
-std::array<float,2>{0.667117417f, 0.957273066f},
-std::array<float,2>{0.175181091f, 0.0260467175f},
-std::array<float,2>{0.793798625f, 0.380664229f},
-std::array<float,2>{0.469461769f, 0.667984009f},
-std::array<float,2>{0.978018105f, 0.903026581f},
-std::array<float,2>{0.264229923f, 0.0833177194f},
-std::array<float,2>{0.559148312f, 0.479321063f},
-std::array<float,2>{0.0153138572f, 0.690787673f},
-std::array<float,2>{0.737683177f, 0.613555372f},
-std::array<float,2>{0.234783754f, 0.275360435f},
-std::array<float,2>{0.862383962f, 0.135786012f},
-std::array<float,2>{0.425233781f, 0.767660618f},
-std::array<float,2>{0.7657305f, 0.633338332f},
-std::array<float,2>{0.463864028f, 0.418770075f},
-std::array<float,2>{0.647832572f, 0.0554896034f},
-std::array<float,2>{0.143019736f, 0.987590313f},
-std::array<float,2>{0.578311265f, 0.830902934f},
-std::array<float,2>{0.0746293515f, 0.248235419f},
-std::array<float,2>{0.905011714f, 0.321531951f},
-std::array<float,2>{0.357085288f, 0.503062844f},
-std::array<float,2>{0.998102188f, 0.842312694f},
-std::array<float,2>{0.268181026f, 0.239145666f},
-std::array<float,2>{0.543694854f, 0.316755474f},
-std::array<float,2>{0.0243214685f, 0.511109531f},
-std::array<float,2>{0.729669988f, 0.632811606f},
-std::array<float,2>{0.227839023f, 0.407717288f},
-std::array<float,2>{0.852810919f, 0.0495595075f},
-std::array<float,2>{0.417483687f, 0.994569838f},
-std::array<float,2>{0.752472818f, 0.617548347f},
-std::array<float,2>{0.450938255f, 0.270766944f},
-std::array<float,2>{0.625817955f, 0.131205127f},
-std::array<float,2>{0.13079688f, 0.780645847f},
-std::array<float,2>{0.577955842f, 0.895572126f},
-std::array<float,2>{0.0897772759f, 0.0882537216f},
-std::array<float,2>{0.889782369f, 0.472906888f},
-std::array<float,2>{0.371997505f, 0.696418703f},
-std::array<float,2>{0.827102959f, 0.967153609f},
-std::array<float,2>{0.388651341f, 0.0205413271f},
-std::array<float,2>{0.693731487f, 0.384299904f},
-std::array<float,2>{0.199046478f, 0.661533356f},
-std::array<float,2>{0.510124326f, 0.557990313f},
-std::array<float,2>{0.0468868203f, 0.348005146f},
-std::array<float,2>{0.947932541f, 0.209409744f},
-std::array<float,2>{0.286273479f, 0.868340194f},
-std::array<float,2>{0.90883112f, 0.730236113f},
-std::array<float,2>{0.341997385f, 0.455097914f},
-std::array<float,2>{0.616447926f, 0.104732014f},
-std::array<float,2>{0.108713761f, 0.907274902f},
-std::array<float,2>{0.679943442f, 0.786182404f},
-std::array<float,2>{0.159508601f, 0.176166132f},
-std::array<float,2>{0.801822007f, 0.312361777f},
-std::array<float,2>{0.497163147f, 0.58079654f},
-std::array<float,2>{0.791702867f, 0.754586279f},
-std::array<float,2>{0.47387597f, 0.142390803f},
-std::array<float,2>{0.671664417f, 0.250185281f},
-std::array<float,2>{0.178303123f, 0.605144858f},
-std::array<float,2>{0.598332822f, 0.712308586f},
-std::array<float,2>{0.118635587f, 0.492817461f},
-std::array<float,2>{0.934087932f, 0.0749758631f},
-std::array<float,2>{0.312680483f, 0.87536329f},
-std::array<float,2>{0.967585087f, 0.524985254f},
-std::array<float,2>{0.306960225f, 0.333189994f},
-std::array<float,2>{0.519366622f, 0.22444275f},
-std::array<float,2>{0.0398608111f, 0.820217133f},
-std::array<float,2>{0.710809588f, 0.984288573f},
-std::array<float,2>{0.206592575f, 0.0336710811f},
-std::array<float,2>{0.835884333f, 0.432679385f},
-std::array<float,2>{0.39368248f, 0.65248698f},
-std::array<float,2>{0.902225435f, 0.926526129f},
-std::array<float,2>{0.353318036f, 0.112181962f},
-std::array<float,2>{0.584728241f, 0.448852569f},
-std::array<float,2>{0.0739691332f, 0.745158672f},
-std::array<float,2>{0.644443989f, 0.562922478f},
-std::array<float,2>{0.145181373f, 0.287318677f},
-std::array<float,2>{0.770914793f, 0.164455503f},
-std::array<float,2>{0.467951715f, 0.805895329f},
-std::array<float,2>{0.864150047f, 0.674598098f},
-std::array<float,2>{0.427128583f, 0.405825585f},
-std::array<float,2>{0.741791487f, 0.00646314258f},
-std::array<float,2>{0.240393832f, 0.942029297f},
-std::array<float,2>{0.555153966f, 0.848306417f},
-std::array<float,2>{0.0105710104f, 0.199864566f},
-std::array<float,2>{0.983205676f, 0.371299714f},
-std::array<float,2>{0.261234134f, 0.533980489f},
-std::array<float,2>{0.922253072f, 0.799173236f},
-std::array<float,2>{0.325115919f, 0.160705f},
-std::array<float,2>{0.604985058f, 0.290713161f},
-std::array<float,2>{0.112493768f, 0.570703268f},
-std::array<float,2>{0.65710789f, 0.741615534f},
-std::array<float,2>{0.181600288f, 0.441879958f},
-std::array<float,2>{0.785857975f, 0.118535705f},
-std::array<float,2>{0.483045489f, 0.932130992f},
-std::array<float,2>{0.839887202f, 0.544698119f},
-std::array<float,2>{0.401011646f, 0.365275413f},
-std::array<float,2>{0.711966693f, 0.193950251f},
-std::array<float,2>{0.213876277f, 0.858077168f},
-std::array<float,2>{0.529588401f, 0.949966967f},
-std::array<float,2>{0.0338689908f, 0.0111041078f},
-std::array<float,2>{0.954745352f, 0.39283663f},
-std::array<float,2>{0.297655314f, 0.681493282f},
-std::array<float,2>{0.776482165f, 0.890455842f},
-std::array<float,2>{0.457828701f, 0.0625645295f},
-std::array<float,2>{0.651897669f, 0.491283804f},
-std::array<float,2>{0.155257478f, 0.710879683f},
-std::array<float,2>{0.58951509f, 0.59577477f},
-std::array<float,2>{0.0635448545f, 0.261668295f},
-std::array<float,2>{0.893324316f, 0.15351136f},
-std::array<float,2>{0.345644712f, 0.764593303f},
-std::array<float,2>{0.971963465f, 0.64555335f},
-std::array<float,2>{0.251289397f, 0.426743895f},
-std::array<float,2>{0.55297029f, 0.0463376492f},
-std::array<float,2>{0.00151708769f, 0.972840071f},
-std::array<float,2>{0.745362878f, 0.821087182f},
-std::array<float,2>{0.248580277f, 0.232978329f},
-std::array<float,2>{0.871854603f, 0.342109025f},
-std::array<float,2>{0.430747092f, 0.521996021f},
-std::array<float,2>{0.846330643f, 0.861146748f},
-std::array<float,2>{0.40965727f, 0.21796985f},
-std::array<float,2>{0.71954155f, 0.356572598f},
-std::array<float,2>{0.224614203f, 0.551261246f},
-std::array<float,2>{0.534507871f, 0.664366126f},
-std::array<float,2>{0.0166210402f, 0.378135622f},
-std::array<float,2>{0.984769166f, 0.0298284143f},
-std::array<float,2>{0.278246015f, 0.954345226f},
-std::array<float,2>{0.879656315f, 0.589122713f},
-std::array<float,2>{0.363154262f, 0.297970295f},
-std::array<float,2>{0.564837933f, 0.182749555f},
-std::array<float,2>{0.0797052756f, 0.796497464f},
-std::array<float,2>{0.634211302f, 0.91630125f},
-std::array<float,2>{0.139998078f, 0.0966646001f},
-std::array<float,2>{0.764663994f, 0.46808815f},
-std::array<float,2>{0.443908155f, 0.725693762f},
-std::array<float,2>{0.940396845f, 0.991046309f},
-std::array<float,2>{0.293933123f, 0.0611691587f},
-std::array<float,2>{0.50120616f, 0.414720923f},
-std::array<float,2>{0.0579318851f, 0.639100134f},
-std::array<float,2>{0.699399829f, 0.504552007f},
-std::array<float,2>{0.190568596f, 0.326518804f},
-std::array<float,2>{0.817386508f, 0.244911492f},
-std::array<float,2>{0.38171351f, 0.832584918f},
-std::array<float,2>{0.808908761f, 0.69410032f},
-std::array<float,2>{0.491819084f, 0.481954932f},
-std::array<float,2>{0.679215372f, 0.0797057152f},
-std::array<float,2>{0.171111643f, 0.901776552f},
-std::array<float,2>{0.620556951f, 0.772935092f},
-std::array<float,2>{0.10044235f, 0.140449077f},
-std::array<float,2>{0.91674453f, 0.277763724f},
-std::array<float,2>{0.329294145f, 0.612145841f},
-std::array<float,2>{0.973442435f, 0.78221941f},
-std::array<float,2>{0.255617172f, 0.175134867f},
-std::array<float,2>{0.550027788f, 0.308553606f},
-std::array<float,2>{0.00677150721f, 0.585308194f},
-std::array<float,2>{0.749103427f, 0.730954349f},
-std::array<float,2>{0.242240354f, 0.45921877f},
-std::array<float,2>{0.870657086f, 0.106402226f},
-std::array<float,2>{0.434900105f, 0.911609054f},
-std::array<float,2>{0.779175758f, 0.558723688f},
-std::array<float,2>{0.45645839f, 0.343988031f},
-std::array<float,2>{0.653350174f, 0.203678712f},
-std::array<float,2>{0.150581688f, 0.874616325f},
-std::array<float,2>{0.591293156f, 0.963466823f},
-std::array<float,2>{0.0665472448f, 0.016666051f},
-std::array<float,2>{0.896787822f, 0.386964798f},
-std::array<float,2>{0.348839581f, 0.657551885f},
-std::array<float,2>{0.837889254f, 0.891443551f},
-std::array<float,2>{0.403300077f, 0.0921488106f},
-std::array<float,2>{0.717204273f, 0.470186174f},
-std::array<float,2>{0.218282983f, 0.702578306f},
-std::array<float,2>{0.525702357f, 0.621779919f},
-std::array<float,2>{0.0352455415f, 0.267106563f},
-std::array<float,2>{0.958370149f, 0.125713408f},
-std::array<float,2>{0.304232568f, 0.775469661f},
-std::array<float,2>{0.927574754f, 0.62728101f},
-std::array<float,2>{0.323395461f, 0.412960052f},
-std::array<float,2>{0.606048286f, 0.0530792661f},
-std::array<float,2>{0.113546945f, 0.99987185f},
-std::array<float,2>{0.66130203f, 0.837831616f},
-std::array<float,2>{0.185830206f, 0.236389473f},
-std::array<float,2>{0.784796655f, 0.314693213f},
-std::array<float,2>{0.47958836f, 0.513558149f},
-std::array<float,2>{0.808491647f, 0.843977332f},
-std::array<float,2>{0.488128066f, 0.197330862f},
-std::array<float,2>{0.672812223f, 0.369716316f},
-std::array<float,2>{0.166338861f, 0.537874222f},
-std::array<float,2>{0.6219486f, 0.676440537f},
-std::array<float,2>{0.0952502191f, 0.400828481f},
-std::array<float,2>{0.921457291f, 0.00171564915f},
-std::array<float,2>{0.334600002f, 0.939967513f},
-std::array<float,2>{0.942523599f, 0.56924659f},
-std::array<float,2>{0.29289639f, 0.281486332f},
-std::array<float,2>{0.504357696f, 0.169089004f},
-std::array<float,2>{0.0612160824f, 0.809529126f},
-std::array<float,2>{0.696183205f, 0.923324585f},
-std::array<float,2>{0.193233788f, 0.115750305f},
-std::array<float,2>{0.815302074f, 0.449755758f},
-std::array<float,2>{0.377914816f, 0.748959243f},
-std::array<float,2>{0.877391398f, 0.977099955f},
-std::array<float,2>{0.364600956f, 0.0378593616f},
-std::array<float,2>{0.568357289f, 0.435135841f},
-std::array<float,2>{0.0834601969f, 0.649464309f},
-std::array<float,2>{0.638581634f, 0.527789891f},
-std::array<float,2>{0.134483665f, 0.331468761f},
-std::array<float,2>{0.761024773f, 0.218991965f},
-std::array<float,2>{0.440659881f, 0.815526426f},
-std::array<float,2>{0.849236548f, 0.716344774f},
-std::array<float,2>{0.413507789f, 0.498830467f},
-std::array<float,2>{0.724115551f, 0.0735650361f},
-std::array<float,2>{0.221762374f, 0.882000446f},
-std::array<float,2>{0.538366735f, 0.750005484f},
-std::array<float,2>{0.0209866632f, 0.147264734f},
-std::array<float,2>{0.990219772f, 0.25428462f},
-std::array<float,2>{0.276010394f, 0.606979072f},
-std::array<float,2>{0.912615061f, 0.82473737f},
-std::array<float,2>{0.336208671f, 0.229017332f},
-std::array<float,2>{0.612694263f, 0.337586761f},
-std::array<float,2>{0.101939f, 0.51937741f},
-std::array<float,2>{0.684771895f, 0.643708289f},
-std::array<float,2>{0.160274684f, 0.422920197f},
-std::array<float,2>{0.797623336f, 0.0401215777f},
-std::array<float,2>{0.495513141f, 0.969096363f},
-std::array<float,2>{0.820540249f, 0.598930418f},
-std::array<float,2>{0.38535887f, 0.263155639f},
-std::array<float,2>{0.688862205f, 0.149588928f},
-std::array<float,2>{0.201865464f, 0.760383427f},
-std::array<float,2>{0.513181627f, 0.886538088f},
-std::array<float,2>{0.0530328602f, 0.067033954f},
-std::array<float,2>{0.949798524f, 0.487204671f},
-std::array<float,2>{0.282058746f, 0.703761876f},
-std::array<float,2>{0.756291866f, 0.945418835f},
-std::array<float,2>{0.448723823f, 0.0123296622f},
-std::array<float,2>{0.629909754f, 0.394607753f},
-std::array<float,2>{0.126635477f, 0.686334491f},
-std::array<float,2>{0.573617339f, 0.541148245f},
-std::array<float,2>{0.0908913538f, 0.360777438f},
-std::array<float,2>{0.884577215f, 0.188927263f},
-std::array<float,2>{0.367535502f, 0.854630291f},
-std::array<float,2>{0.996074796f, 0.734824777f},
-std::array<float,2>{0.272625268f, 0.440724462f},
-std::array<float,2>{0.539125621f, 0.123236015f},
-std::array<float,2>{0.0296843313f, 0.935972333f},
-std::array<float,2>{0.731620967f, 0.801672578f},
-std::array<float,2>{0.23344259f, 0.160147026f},
-std::array<float,2>{0.856926024f, 0.293007135f},
-std::array<float,2>{0.420000523f, 0.575761497f},
-std::array<float,2>{0.860862017f, 0.765782237f},
-std::array<float,2>{0.423498541f, 0.133455113f},
-std::array<float,2>{0.735892773f, 0.276466429f},
-std::array<float,2>{0.237406701f, 0.616947949f},
-std::array<float,2>{0.562051535f, 0.687508643f},
-std::array<float,2>{0.01220096f, 0.477559388f},
-std::array<float,2>{0.978613734f, 0.0846300125f},
-std::array<float,2>{0.263489664f, 0.905485868f},
-std::array<float,2>{0.904012263f, 0.500085294f},
-std::array<float,2>{0.359148681f, 0.322811484f},
-std::array<float,2>{0.58047235f, 0.246164411f},
-std::array<float,2>{0.0769672543f, 0.828847647f},
-std::array<float,2>{0.645955682f, 0.984587312f},
-std::array<float,2>{0.141411811f, 0.0567787215f},
-std::array<float,2>{0.769392848f, 0.421156853f},
-std::array<float,2>{0.4619762f, 0.636656404f},
-std::array<float,2>{0.96347791f, 0.91948545f},
-std::array<float,2>{0.311543077f, 0.0990125164f},
-std::array<float,2>{0.519656301f, 0.462164998f},
-std::array<float,2>{0.0463240482f, 0.71896553f},
-std::array<float,2>{0.706086159f, 0.593578637f},
-std::array<float,2>{0.209050223f, 0.304560661f},
-std::array<float,2>{0.828197837f, 0.185049385f},
-std::array<float,2>{0.397177815f, 0.790502608f},
-std::array<float,2>{0.795528054f, 0.670901358f},
-std::array<float,2>{0.472150892f, 0.381933987f},
-std::array<float,2>{0.665961146f, 0.023487607f},
-std::array<float,2>{0.172346756f, 0.960834622f},
-std::array<float,2>{0.596940756f, 0.863370895f},
-std::array<float,2>{0.121459603f, 0.211059049f},
-std::array<float,2>{0.930406868f, 0.352689743f},
-std::array<float,2>{0.318877548f, 0.547107875f},
-std::array<float,2>{0.946399689f, 0.870091736f},
-std::array<float,2>{0.287829846f, 0.207523927f},
-std::array<float,2>{0.507941961f, 0.350612372f},
-std::array<float,2>{0.050284151f, 0.554767668f},
-std::array<float,2>{0.693214774f, 0.662202418f},
-std::array<float,2>{0.197033629f, 0.384916335f},
-std::array<float,2>{0.825665176f, 0.0226353928f},
-std::array<float,2>{0.389608562f, 0.966516912f},
-std::array<float,2>{0.803694904f, 0.578274727f},
-std::array<float,2>{0.499748915f, 0.309283525f},
-std::array<float,2>{0.682203889f, 0.177756712f},
-std::array<float,2>{0.157144725f, 0.787591517f},
-std::array<float,2>{0.614283442f, 0.909863949f},
-std::array<float,2>{0.106992163f, 0.102634668f},
-std::array<float,2>{0.907717943f, 0.454646945f},
-std::array<float,2>{0.341120869f, 0.727120876f},
-std::array<float,2>{0.853856444f, 0.992827773f},
-std::array<float,2>{0.414715022f, 0.0486501977f},
-std::array<float,2>{0.728347898f, 0.409745187f},
-std::array<float,2>{0.229779527f, 0.630676568f},
-std::array<float,2>{0.545538664f, 0.508745074f},
-std::array<float,2>{0.0254155099f, 0.319640249f},
-std::array<float,2>{0.997634947f, 0.240935862f},
-std::array<float,2>{0.266387492f, 0.83994925f},
-std::array<float,2>{0.887066364f, 0.697873771f},
-std::array<float,2>{0.374993682f, 0.476344585f},
-std::array<float,2>{0.575148702f, 0.0877045915f},
-std::array<float,2>{0.0874728709f, 0.89830333f},
-std::array<float,2>{0.627264142f, 0.778574824f},
-std::array<float,2>{0.131491542f, 0.129220709f},
-std::array<float,2>{0.751811743f, 0.271726072f},
-std::array<float,2>{0.452451617f, 0.620222151f},
-std::array<float,2>{0.773017228f, 0.807296157f},
-std::array<float,2>{0.464904279f, 0.166914925f},
-std::array<float,2>{0.642041862f, 0.286746562f},
-std::array<float,2>{0.148077264f, 0.565391004f},
-std::array<float,2>{0.582729936f, 0.742323756f},
-std::array<float,2>{0.0711784214f, 0.44652769f},
-std::array<float,2>{0.8986184f, 0.110717654f},
-std::array<float,2>{0.354753256f, 0.928433776f},
-std::array<float,2>{0.981895268f, 0.531363249f},
-std::array<float,2>{0.258483917f, 0.37311098f},
-std::array<float,2>{0.557921112f, 0.201412126f},
-std::array<float,2>{0.00937131979f, 0.850292563f},
-std::array<float,2>{0.739915788f, 0.945307612f},
-std::array<float,2>{0.238537297f, 0.00556859933f},
-std::array<float,2>{0.865926981f, 0.403351665f},
-std::array<float,2>{0.428080231f, 0.672408044f},
-std::array<float,2>{0.936215341f, 0.878508449f},
-std::array<float,2>{0.315798402f, 0.0779088587f},
-std::array<float,2>{0.600337505f, 0.494635552f},
-std::array<float,2>{0.120125704f, 0.713143349f},
-std::array<float,2>{0.669134319f, 0.603139877f},
-std::array<float,2>{0.175898969f, 0.252347827f},
-std::array<float,2>{0.789960086f, 0.143392906f},
-std::array<float,2>{0.475177228f, 0.757552147f},
-std::array<float,2>{0.832401276f, 0.656210959f},
-std::array<float,2>{0.391001016f, 0.431530625f},
-std::array<float,2>{0.707448483f, 0.0327022634f},
-std::array<float,2>{0.203197598f, 0.981178284f},
-std::array<float,2>{0.51669085f, 0.816604555f},
-std::array<float,2>{0.0417433418f, 0.224911571f},
-std::array<float,2>{0.966164231f, 0.335856199f},
-std::array<float,2>{0.306536287f, 0.527032971f},
-std::array<float,2>{0.892062843f, 0.763146043f},
-std::array<float,2>{0.347397715f, 0.156122655f},
-std::array<float,2>{0.587105453f, 0.258895367f},
-std::array<float,2>{0.0661088452f, 0.594461381f},
-std::array<float,2>{0.650128543f, 0.708800673f},
-std::array<float,2>{0.154061258f, 0.488580197f},
-std::array<float,2>{0.77391398f, 0.0661661103f},
-std::array<float,2>{0.45973444f, 0.888255656f},
-std::array<float,2>{0.87408787f, 0.520936906f},
-std::array<float,2>{0.432641238f, 0.339896858f},
-std::array<float,2>{0.743425846f, 0.231602684f},
-std::array<float,2>{0.247633398f, 0.823784888f},
-std::array<float,2>{0.551969886f, 0.976390004f},
-std::array<float,2>{0.00314378552f, 0.0445162244f},
-std::array<float,2>{0.970683813f, 0.429118603f},
-std::array<float,2>{0.25300771f, 0.648358405f},
-std::array<float,2>{0.78725785f, 0.930165291f},
-std::array<float,2>{0.48201111f, 0.120537855f},
-std::array<float,2>{0.659332097f, 0.443509638f},
-std::array<float,2>{0.183100715f, 0.739879727f},
-std::array<float,2>{0.603277683f, 0.573382437f},
-std::array<float,2>{0.111169502f, 0.292234004f},
-std::array<float,2>{0.925470054f, 0.163662314f},
-std::array<float,2>{0.327103674f, 0.797045231f},
-std::array<float,2>{0.955184042f, 0.681969523f},
-std::array<float,2>{0.299134493f, 0.391256332f},
-std::array<float,2>{0.528330088f, 0.00912276283f},
-std::array<float,2>{0.0318288952f, 0.951920748f},
-std::array<float,2>{0.713786185f, 0.856076121f},
-std::array<float,2>{0.211626157f, 0.192778885f},
-std::array<float,2>{0.84320724f, 0.364732385f},
-std::array<float,2>{0.39928773f, 0.545348465f},
-std::array<float,2>{0.819369614f, 0.834457815f},
-std::array<float,2>{0.378994346f, 0.243009388f},
-std::array<float,2>{0.702845812f, 0.32570219f},
-std::array<float,2>{0.188552499f, 0.505970418f},
-std::array<float,2>{0.503256559f, 0.638376892f},
-std::array<float,2>{0.0561551787f, 0.417419374f},
-std::array<float,2>{0.938587368f, 0.0593897849f},
-std::array<float,2>{0.29675284f, 0.988838136f},
-std::array<float,2>{0.915838897f, 0.610457659f},
-std::array<float,2>{0.33172217f, 0.279666394f},
-std::array<float,2>{0.6183182f, 0.137145579f},
-std::array<float,2>{0.0984470546f, 0.769661188f},
-std::array<float,2>{0.676101387f, 0.900224149f},
-std::array<float,2>{0.16943419f, 0.0817942098f},
-std::array<float,2>{0.811358988f, 0.482545078f},
-std::array<float,2>{0.489018559f, 0.693080604f},
-std::array<float,2>{0.987923622f, 0.955932856f},
-std::array<float,2>{0.279593945f, 0.0291131511f},
-std::array<float,2>{0.531580746f, 0.375333697f},
-std::array<float,2>{0.0182720423f, 0.667924404f},
-std::array<float,2>{0.721184313f, 0.552949667f},
-std::array<float,2>{0.222876444f, 0.358092576f},
-std::array<float,2>{0.844085574f, 0.215324953f},
-std::array<float,2>{0.407803684f, 0.86292845f},
-std::array<float,2>{0.762081385f, 0.722907007f},
-std::array<float,2>{0.442839861f, 0.465410292f},
-std::array<float,2>{0.636430979f, 0.0938972607f},
-std::array<float,2>{0.137079552f, 0.915367782f},
-std::array<float,2>{0.563498735f, 0.794916093f},
-std::array<float,2>{0.0807098895f, 0.179938495f},
-std::array<float,2>{0.880873084f, 0.300168991f},
-std::array<float,2>{0.359838247f, 0.587556899f},
-std::array<float,2>{0.988381028f, 0.753137767f},
-std::array<float,2>{0.276792645f, 0.145726115f},
-std::array<float,2>{0.53767705f, 0.25619778f},
-std::array<float,2>{0.0195853803f, 0.608039558f},
-std::array<float,2>{0.72319603f, 0.717997313f},
-std::array<float,2>{0.22157082f, 0.497008264f},
-std::array<float,2>{0.848459601f, 0.0720287263f},
-std::array<float,2>{0.412902683f, 0.879988849f},
-std::array<float,2>{0.76025188f, 0.530271769f},
-std::array<float,2>{0.439846069f, 0.329545379f},
-std::array<float,2>{0.637163877f, 0.220991895f},
-std::array<float,2>{0.133401021f, 0.813954532f},
-std::array<float,2>{0.56643635f, 0.979478359f},
-std::array<float,2>{0.0829654336f, 0.0356867611f},
-std::array<float,2>{0.878291368f, 0.435588211f},
-std::array<float,2>{0.363951683f, 0.650784969f},
-std::array<float,2>{0.815700352f, 0.925334632f},
-std::array<float,2>{0.378742874f, 0.115126021f},
-std::array<float,2>{0.697233796f, 0.451763272f},
-std::array<float,2>{0.191462114f, 0.746376693f},
-std::array<float,2>{0.505151153f, 0.568254769f},
-std::array<float,2>{0.0623850226f, 0.283513457f},
-std::array<float,2>{0.942223668f, 0.171374664f},
-std::array<float,2>{0.291205823f, 0.811507583f},
-std::array<float,2>{0.920691192f, 0.679318249f},
-std::array<float,2>{0.335886419f, 0.398852795f},
-std::array<float,2>{0.622118771f, 0.00325594051f},
-std::array<float,2>{0.0939406902f, 0.939125538f},
-std::array<float,2>{0.673279345f, 0.846063673f},
-std::array<float,2>{0.167599931f, 0.195748955f},
-std::array<float,2>{0.80702424f, 0.367385417f},
-std::array<float,2>{0.487085223f, 0.536338151f},
-std::array<float,2>{0.783478081f, 0.839580297f},
-std::array<float,2>{0.478655934f, 0.235222057f},
-std::array<float,2>{0.66040206f, 0.312522918f},
-std::array<float,2>{0.186558023f, 0.515529215f},
-std::array<float,2>{0.606779993f, 0.626336038f},
-std::array<float,2>{0.114598021f, 0.411467344f},
-std::array<float,2>{0.925999343f, 0.052152168f},
-std::array<float,2>{0.322653413f, 0.997140646f},
-std::array<float,2>{0.957548618f, 0.623642564f},
-std::array<float,2>{0.303407937f, 0.268187255f},
-std::array<float,2>{0.526870251f, 0.128616184f},
-std::array<float,2>{0.0366843864f, 0.773953855f},
-std::array<float,2>{0.71850884f, 0.893896997f},
-std::array<float,2>{0.21736145f, 0.0916475728f},
-std::array<float,2>{0.836805165f, 0.471925497f},
-std::array<float,2>{0.40419361f, 0.699828446f},
-std::array<float,2>{0.897565663f, 0.960949063f},
-std::array<float,2>{0.348455042f, 0.0182976425f},
-std::array<float,2>{0.590232968f, 0.390592486f},
-std::array<float,2>{0.0676717386f, 0.659603238f},
-std::array<float,2>{0.652443647f, 0.561222374f},
-std::array<float,2>{0.151629254f, 0.346885771f},
-std::array<float,2>{0.778235495f, 0.206700474f},
-std::array<float,2>{0.455439329f, 0.871130526f},
-std::array<float,2>{0.869790435f, 0.73296088f},
-std::array<float,2>{0.434503168f, 0.457769036f},
-std::array<float,2>{0.748347223f, 0.108619049f},
-std::array<float,2>{0.24410747f, 0.913511813f},
-std::array<float,2>{0.54966712f, 0.783499122f},
-std::array<float,2>{0.00717263715f, 0.173114926f},
-std::array<float,2>{0.974290848f, 0.305875182f},
-std::array<float,2>{0.254086167f, 0.582651973f},
-std::array<float,2>{0.930784166f, 0.866869092f},
-std::array<float,2>{0.319853246f, 0.214185715f},
-std::array<float,2>{0.595739484f, 0.354810297f},
-std::array<float,2>{0.122483209f, 0.550151706f},
-std::array<float,2>{0.664735615f, 0.669792354f},
-std::array<float,2>{0.173688874f, 0.379258454f},
-std::array<float,2>{0.796861351f, 0.0269045997f},
-std::array<float,2>{0.471223533f, 0.958021402f},
-std::array<float,2>{0.829363644f, 0.591233611f},
-std::array<float,2>{0.397638559f, 0.302391559f},
-std::array<float,2>{0.705432355f, 0.185750037f},
-std::array<float,2>{0.210279509f, 0.792395175f},
-std::array<float,2>{0.520550728f, 0.920830309f},
-std::array<float,2>{0.0453944094f, 0.100103043f},
-std::array<float,2>{0.96432817f, 0.463436246f},
-std::array<float,2>{0.310553342f, 0.721203327f},
-std::array<float,2>{0.767875433f, 0.986552656f},
-std::array<float,2>{0.461600035f, 0.0565724745f},
-std::array<float,2>{0.64460063f, 0.419256568f},
-std::array<float,2>{0.142044336f, 0.634173453f},
-std::array<float,2>{0.582019985f, 0.502072096f},
-std::array<float,2>{0.077605933f, 0.320325166f},
-std::array<float,2>{0.902850389f, 0.249122545f},
-std::array<float,2>{0.357998192f, 0.831906676f},
-std::array<float,2>{0.979954243f, 0.68948096f},
-std::array<float,2>{0.261946201f, 0.48032859f},
-std::array<float,2>{0.561184824f, 0.0827646479f},
-std::array<float,2>{0.0136487959f, 0.904265821f},
-std::array<float,2>{0.734540284f, 0.769198358f},
-std::array<float,2>{0.237107471f, 0.134871721f},
-std::array<float,2>{0.860255897f, 0.273693234f},
-std::array<float,2>{0.422611833f, 0.615159929f},
-std::array<float,2>{0.855851114f, 0.803919554f},
-std::array<float,2>{0.421119362f, 0.156326085f},
-std::array<float,2>{0.730641663f, 0.296071053f},
-std::array<float,2>{0.232517883f, 0.577911556f},
-std::array<float,2>{0.540796518f, 0.736335278f},
-std::array<float,2>{0.0311408062f, 0.438340634f},
-std::array<float,2>{0.994944334f, 0.12177033f},
-std::array<float,2>{0.271544367f, 0.935354769f},
-std::array<float,2>{0.883329391f, 0.540767133f},
-std::array<float,2>{0.368414253f, 0.361990452f},
-std::array<float,2>{0.572926044f, 0.189665973f},
-std::array<float,2>{0.0907060504f, 0.853382289f},
-std::array<float,2>{0.629364133f, 0.948693812f},
-std::array<float,2>{0.125558838f, 0.0156010827f},
-std::array<float,2>{0.757539093f, 0.398167998f},
-std::array<float,2>{0.44730407f, 0.684353471f},
-std::array<float,2>{0.950246871f, 0.883708239f},
-std::array<float,2>{0.282453597f, 0.0695508346f},
-std::array<float,2>{0.512073874f, 0.48546204f},
-std::array<float,2>{0.0537845455f, 0.705339491f},
-std::array<float,2>{0.688086569f, 0.600471199f},
-std::array<float,2>{0.202850759f, 0.264837801f},
-std::array<float,2>{0.821497738f, 0.1516404f},
-std::array<float,2>{0.386610925f, 0.759250581f},
-std::array<float,2>{0.798449636f, 0.640760362f},
-std::array<float,2>{0.494380027f, 0.425582439f},
-std::array<float,2>{0.684512377f, 0.0416228995f},
-std::array<float,2>{0.161258116f, 0.971803129f},
-std::array<float,2>{0.61136055f, 0.827806652f},
-std::array<float,2>{0.102954149f, 0.228218302f},
-std::array<float,2>{0.913756251f, 0.339723706f},
-std::array<float,2>{0.337473065f, 0.516914964f},
-std::array<float,2>{0.965337515f, 0.819239438f},
-std::array<float,2>{0.305084378f, 0.223315626f},
-std::array<float,2>{0.516552508f, 0.332648605f},
-std::array<float,2>{0.0424880907f, 0.523444057f},
-std::array<float,2>{0.708686888f, 0.653701663f},
-std::array<float,2>{0.204668418f, 0.43219614f},
-std::array<float,2>{0.833869517f, 0.0347654f},
-std::array<float,2>{0.391636372f, 0.98329252f},
-std::array<float,2>{0.790129185f, 0.603684127f},
-std::array<float,2>{0.476003617f, 0.251190811f},
-std::array<float,2>{0.668904245f, 0.141511574f},
-std::array<float,2>{0.177126482f, 0.755112767f},
-std::array<float,2>{0.60071969f, 0.876396716f},
-std::array<float,2>{0.119633704f, 0.0760594159f},
-std::array<float,2>{0.937448025f, 0.493183047f},
-std::array<float,2>{0.315065295f, 0.711281657f},
-std::array<float,2>{0.866569281f, 0.942777872f},
-std::array<float,2>{0.428765774f, 0.00703910273f},
-std::array<float,2>{0.738771915f, 0.404594153f},
-std::array<float,2>{0.239457071f, 0.675549924f},
-std::array<float,2>{0.556917965f, 0.534848988f},
-std::array<float,2>{0.00830842648f, 0.372685552f},
-std::array<float,2>{0.98134619f, 0.201126203f},
-std::array<float,2>{0.258812308f, 0.849303186f},
-std::array<float,2>{0.899488032f, 0.744826496f},
-std::array<float,2>{0.353993207f, 0.447945446f},
-std::array<float,2>{0.583616138f, 0.113246024f},
-std::array<float,2>{0.0714915097f, 0.927286923f},
-std::array<float,2>{0.641531527f, 0.805458784f},
-std::array<float,2>{0.146498859f, 0.165961027f},
-std::array<float,2>{0.771668613f, 0.288699478f},
-std::array<float,2>{0.466559649f, 0.563674569f},
-std::array<float,2>{0.750498176f, 0.779483914f},
-std::array<float,2>{0.451669157f, 0.131837636f},
-std::array<float,2>{0.628098726f, 0.269899219f},
-std::array<float,2>{0.132442102f, 0.618677378f},
-std::array<float,2>{0.575966597f, 0.69593364f},
-std::array<float,2>{0.0862678513f, 0.47369647f},
-std::array<float,2>{0.888029516f, 0.0897441208f},
-std::array<float,2>{0.373638421f, 0.895174563f},
-std::array<float,2>{0.99702239f, 0.51032865f},
-std::array<float,2>{0.266956449f, 0.318095386f},
-std::array<float,2>{0.546441495f, 0.239835843f},
-std::array<float,2>{0.0268925112f, 0.84341681f},
-std::array<float,2>{0.727503777f, 0.996053755f},
-std::array<float,2>{0.228876501f, 0.0501544662f},
-std::array<float,2>{0.854852498f, 0.406768233f},
-std::array<float,2>{0.415825963f, 0.630917192f},
-std::array<float,2>{0.907169819f, 0.907224894f},
-std::array<float,2>{0.340793014f, 0.104438066f},
-std::array<float,2>{0.613551974f, 0.456357718f},
-std::array<float,2>{0.105850466f, 0.728838623f},
-std::array<float,2>{0.683326244f, 0.581654012f},
-std::array<float,2>{0.157636479f, 0.310859025f},
-std::array<float,2>{0.804064393f, 0.177616209f},
-std::array<float,2>{0.498797923f, 0.785570681f},
-std::array<float,2>{0.824919462f, 0.660964847f},
-std::array<float,2>{0.389963478f, 0.383224636f},
-std::array<float,2>{0.691637754f, 0.0196570903f},
-std::array<float,2>{0.19544363f, 0.968119502f},
-std::array<float,2>{0.508852005f, 0.86743325f},
-std::array<float,2>{0.0495929122f, 0.210784525f},
-std::array<float,2>{0.946221948f, 0.349395394f},
-std::array<float,2>{0.288108647f, 0.557292521f},
-std::array<float,2>{0.882508218f, 0.795278251f},
-std::array<float,2>{0.360477477f, 0.18242608f},
-std::array<float,2>{0.563196838f, 0.297700137f},
-std::array<float,2>{0.0813466981f, 0.588735819f},
-std::array<float,2>{0.635460079f, 0.725063562f},
-std::array<float,2>{0.137788296f, 0.467130095f},
-std::array<float,2>{0.762702882f, 0.0969600379f},
-std::array<float,2>{0.442234665f, 0.917074442f},
-std::array<float,2>{0.844805181f, 0.552636504f},
-std::array<float,2>{0.406359345f, 0.356334448f},
-std::array<float,2>{0.722484469f, 0.217011824f},
-std::array<float,2>{0.22404708f, 0.859937966f},
-std::array<float,2>{0.533179343f, 0.95409435f},
-std::array<float,2>{0.0186280292f, 0.0309104118f},
-std::array<float,2>{0.986697674f, 0.377221495f},
-std::array<float,2>{0.280831993f, 0.665290654f},
-std::array<float,2>{0.812278748f, 0.900956154f},
-std::array<float,2>{0.489325792f, 0.0790144429f},
-std::array<float,2>{0.677036703f, 0.480484635f},
-std::array<float,2>{0.168534428f, 0.694928944f},
-std::array<float,2>{0.617751002f, 0.61285001f},
-std::array<float,2>{0.0987734646f, 0.278854966f},
-std::array<float,2>{0.914902687f, 0.139126301f},
-std::array<float,2>{0.330736071f, 0.771537244f},
-std::array<float,2>{0.938331425f, 0.640053034f},
-std::array<float,2>{0.29567644f, 0.415442199f},
-std::array<float,2>{0.502106607f, 0.0624025241f},
-std::array<float,2>{0.0554710366f, 0.991780758f},
-std::array<float,2>{0.701890111f, 0.833039701f},
-std::array<float,2>{0.188156039f, 0.245298892f},
-std::array<float,2>{0.818410873f, 0.327934116f},
-std::array<float,2>{0.38031581f, 0.5052616f},
-std::array<float,2>{0.842507839f, 0.858496726f},
-std::array<float,2>{0.399789035f, 0.194573998f},
-std::array<float,2>{0.714674771f, 0.366422743f},
-std::array<float,2>{0.212619901f, 0.543547034f},
-std::array<float,2>{0.528105974f, 0.680200338f},
-std::array<float,2>{0.0329082832f, 0.394277692f},
-std::array<float,2>{0.956311584f, 0.0100541823f},
-std::array<float,2>{0.29991588f, 0.950500548f},
-std::array<float,2>{0.923923433f, 0.571832478f},
-std::array<float,2>{0.327545553f, 0.289438128f},
-std::array<float,2>{0.602484286f, 0.161854327f},
-std::array<float,2>{0.109772779f, 0.800574541f},
-std::array<float,2>{0.658905447f, 0.933456898f},
-std::array<float,2>{0.182242453f, 0.117221601f},
-std::array<float,2>{0.78885448f, 0.44335252f},
-std::array<float,2>{0.48088786f, 0.740775943f},
-std::array<float,2>{0.968765199f, 0.974136055f},
-std::array<float,2>{0.252124101f, 0.0451271832f},
-std::array<float,2>{0.551084578f, 0.427340358f},
-std::array<float,2>{0.00206111046f, 0.645213604f},
-std::array<float,2>{0.742298663f, 0.522553027f},
-std::array<float,2>{0.246495396f, 0.343062222f},
-std::array<float,2>{0.873060286f, 0.234188452f},
-std::array<float,2>{0.431809187f, 0.82201761f},
-std::array<float,2>{0.774695098f, 0.709058821f},
-std::array<float,2>{0.460877627f, 0.490413755f},
-std::array<float,2>{0.648541927f, 0.0643921793f},
-std::array<float,2>{0.152776107f, 0.889626741f},
-std::array<float,2>{0.586651564f, 0.765107214f},
-std::array<float,2>{0.0651837215f, 0.152890846f},
-std::array<float,2>{0.891399026f, 0.26060915f},
-std::array<float,2>{0.346123248f, 0.596965492f},
-std::array<float,2>{0.944493592f, 0.810254335f},
-std::array<float,2>{0.289798021f, 0.168828085f},
-std::array<float,2>{0.507145345f, 0.283009559f},
-std::array<float,2>{0.0598750114f, 0.569597602f},
-std::array<float,2>{0.698721349f, 0.74911052f},
-std::array<float,2>{0.193654716f, 0.450973839f},
-std::array<float,2>{0.813458323f, 0.116923921f},
-std::array<float,2>{0.376188755f, 0.922840059f},
-std::array<float,2>{0.806105196f, 0.538758516f},
-std::array<float,2>{0.486275077f, 0.370897681f},
-std::array<float,2>{0.673936188f, 0.198897377f},
-std::array<float,2>{0.165602818f, 0.845554233f},
-std::array<float,2>{0.624225914f, 0.941213489f},
-std::array<float,2>{0.0965291187f, 0.000400858989f},
-std::array<float,2>{0.918015063f, 0.401389539f},
-std::array<float,2>{0.332235664f, 0.677647173f},
-std::array<float,2>{0.850325346f, 0.881728888f},
-std::array<float,2>{0.411967427f, 0.0724073946f},
-std::array<float,2>{0.725709677f, 0.499658823f},
-std::array<float,2>{0.219507888f, 0.715684712f},
-std::array<float,2>{0.536109149f, 0.605689466f},
-std::array<float,2>{0.0219216216f, 0.255457759f},
-std::array<float,2>{0.990492582f, 0.147985995f},
-std::array<float,2>{0.274374396f, 0.751728415f},
-std::array<float,2>{0.876808882f, 0.649364829f},
-std::array<float,2>{0.365506411f, 0.433706164f},
-std::array<float,2>{0.568941236f, 0.0387259126f},
-std::array<float,2>{0.0848089829f, 0.978421032f},
-std::array<float,2>{0.640380979f, 0.814872444f},
-std::array<float,2>{0.136166602f, 0.220146f},
-std::array<float,2>{0.758714259f, 0.330596656f},
-std::array<float,2>{0.438084006f, 0.528736293f},
-std::array<float,2>{0.781020999f, 0.873581588f},
-std::array<float,2>{0.454541415f, 0.204396576f},
-std::array<float,2>{0.655137539f, 0.345548093f},
-std::array<float,2>{0.148533255f, 0.55992645f},
-std::array<float,2>{0.592193365f, 0.656311274f},
-std::array<float,2>{0.0702525526f, 0.38777113f},
-std::array<float,2>{0.895701289f, 0.0164822675f},
-std::array<float,2>{0.350899667f, 0.964646935f},
-std::array<float,2>{0.975808322f, 0.584609568f},
-std::array<float,2>{0.257362008f, 0.307182133f},
-std::array<float,2>{0.54855603f, 0.17459476f},
-std::array<float,2>{0.00391375786f, 0.783133149f},
-std::array<float,2>{0.746783555f, 0.91067481f},
-std::array<float,2>{0.244602814f, 0.107112214f},
-std::array<float,2>{0.867778659f, 0.460179418f},
-std::array<float,2>{0.436966032f, 0.732352197f},
-std::array<float,2>{0.928996265f, 0.998924851f},
-std::array<float,2>{0.320661008f, 0.0543631054f},
-std::array<float,2>{0.608994126f, 0.413670033f},
-std::array<float,2>{0.116299808f, 0.628771126f},
-std::array<float,2>{0.662197948f, 0.51208216f},
-std::array<float,2>{0.185006499f, 0.315497041f},
-std::array<float,2>{0.782678962f, 0.238034487f},
-std::array<float,2>{0.477327675f, 0.836062372f},
-std::array<float,2>{0.83862865f, 0.701644182f},
-std::array<float,2>{0.404511631f, 0.469564259f},
-std::array<float,2>{0.716102004f, 0.0934997797f},
-std::array<float,2>{0.215393826f, 0.892149866f},
-std::array<float,2>{0.524823844f, 0.776811957f},
-std::array<float,2>{0.0389184207f, 0.126948938f},
-std::array<float,2>{0.960759759f, 0.266506404f},
-std::array<float,2>{0.302659422f, 0.622685671f},
-std::array<float,2>{0.905429602f, 0.829697013f},
-std::array<float,2>{0.35555774f, 0.247902691f},
-std::array<float,2>{0.579829156f, 0.323572904f},
-std::array<float,2>{0.0757854581f, 0.501903653f},
-std::array<float,2>{0.646707177f, 0.635710716f},
-std::array<float,2>{0.14419812f, 0.420015007f},
-std::array<float,2>{0.766985536f, 0.0577285066f},
-std::array<float,2>{0.464842916f, 0.985655844f},
-std::array<float,2>{0.862214088f, 0.616035521f},
-std::array<float,2>{0.424058229f, 0.275843829f},
-std::array<float,2>{0.736470163f, 0.133875683f},
-std::array<float,2>{0.235729516f, 0.767084777f},
-std::array<float,2>{0.560454547f, 0.904872954f},
-std::array<float,2>{0.0143527398f, 0.0852021277f},
-std::array<float,2>{0.977115691f, 0.476885051f},
-std::array<float,2>{0.264727294f, 0.688906014f},
-std::array<float,2>{0.794245005f, 0.959244549f},
-std::array<float,2>{0.470694929f, 0.0253155287f},
-std::array<float,2>{0.666552305f, 0.381329f},
-std::array<float,2>{0.173927084f, 0.670411646f},
-std::array<float,2>{0.594337344f, 0.548487186f},
-std::array<float,2>{0.124137379f, 0.352247149f},
-std::array<float,2>{0.932219386f, 0.211979046f},
-std::array<float,2>{0.316806525f, 0.864997625f},
-std::array<float,2>{0.961014092f, 0.71989727f},
-std::array<float,2>{0.310040057f, 0.46152091f},
-std::array<float,2>{0.52218461f, 0.0984643474f},
-std::array<float,2>{0.0429940596f, 0.918353736f},
-std::array<float,2>{0.704041839f, 0.789572895f},
-std::array<float,2>{0.208956569f, 0.184257939f},
-std::array<float,2>{0.830784798f, 0.303350806f},
-std::array<float,2>{0.395015568f, 0.592705548f},
-std::array<float,2>{0.823373675f, 0.761616886f},
-std::array<float,2>{0.384337157f, 0.149351418f},
-std::array<float,2>{0.690699339f, 0.26212886f},
-std::array<float,2>{0.199529484f, 0.598597348f},
-std::array<float,2>{0.515272379f, 0.704821765f},
-std::array<float,2>{0.0526025705f, 0.487751305f},
-std::array<float,2>{0.952637434f, 0.0674794912f},
-std::array<float,2>{0.28480345f, 0.885211945f},
-std::array<float,2>{0.910952091f, 0.517933846f},
-std::array<float,2>{0.339734554f, 0.336209714f},
-std::array<float,2>{0.610348463f, 0.22967647f},
-std::array<float,2>{0.105187692f, 0.825665832f},
-std::array<float,2>{0.68677175f, 0.970644176f},
-std::array<float,2>{0.162479833f, 0.039875824f},
-std::array<float,2>{0.800311923f, 0.421961606f},
-std::array<float,2>{0.492404431f, 0.64271158f},
-std::array<float,2>{0.993815422f, 0.936789632f},
-std::array<float,2>{0.27081719f, 0.124945961f},
-std::array<float,2>{0.541935802f, 0.43965736f},
-std::array<float,2>{0.0274745636f, 0.735545099f},
-std::array<float,2>{0.733024955f, 0.574550331f},
-std::array<float,2>{0.232354596f, 0.294134527f},
-std::array<float,2>{0.859369874f, 0.158256501f},
-std::array<float,2>{0.419050395f, 0.802105665f},
-std::array<float,2>{0.755722582f, 0.687298417f},
-std::array<float,2>{0.445332468f, 0.396216929f},
-std::array<float,2>{0.631053686f, 0.0129049439f},
-std::array<float,2>{0.128654391f, 0.946406364f},
-std::array<float,2>{0.57218188f, 0.854338288f},
-std::array<float,2>{0.0926838219f, 0.188469738f},
-std::array<float,2>{0.886618793f, 0.359927088f},
-std::array<float,2>{0.369236171f, 0.542380631f},
-std::array<float,2>{0.983920097f, 0.851501584f},
-std::array<float,2>{0.260401279f, 0.202731311f},
-std::array<float,2>{0.556197226f, 0.374829262f},
-std::array<float,2>{0.0111383777f, 0.532308519f},
-std::array<float,2>{0.740838349f, 0.673298001f},
-std::array<float,2>{0.241296947f, 0.402478307f},
-std::array<float,2>{0.864481807f, 0.00470011402f},
-std::array<float,2>{0.426126122f, 0.943811715f},
-std::array<float,2>{0.76980418f, 0.565656841f},
-std::array<float,2>{0.467135161f, 0.285750628f},
-std::array<float,2>{0.642941713f, 0.1671049f},
-std::array<float,2>{0.145906672f, 0.808057129f},
-std::array<float,2>{0.585913241f, 0.929206312f},
-std::array<float,2>{0.0723557994f, 0.110092483f},
-std::array<float,2>{0.901320338f, 0.445577949f},
-std::array<float,2>{0.351890802f, 0.74344945f},
-std::array<float,2>{0.834540486f, 0.982413948f},
-std::array<float,2>{0.393240154f, 0.0315590873f},
-std::array<float,2>{0.709099829f, 0.430459678f},
-std::array<float,2>{0.205925196f, 0.654541194f},
-std::array<float,2>{0.51761806f, 0.526289701f},
-std::array<float,2>{0.040784847f, 0.334755212f},
-std::array<float,2>{0.967884958f, 0.22564888f},
-std::array<float,2>{0.308296412f, 0.817685485f},
-std::array<float,2>{0.935049176f, 0.714618385f},
-std::array<float,2>{0.313693553f, 0.495332301f},
-std::array<float,2>{0.599186718f, 0.0763602555f},
-std::array<float,2>{0.117324412f, 0.877240062f},
-std::array<float,2>{0.670414925f, 0.756672502f},
-std::array<float,2>{0.179372519f, 0.144083902f},
-std::array<float,2>{0.792280555f, 0.253649563f},
-std::array<float,2>{0.473193884f, 0.601587832f},
-std::array<float,2>{0.800959647f, 0.788777471f},
-std::array<float,2>{0.496754318f, 0.179600313f},
-std::array<float,2>{0.68127197f, 0.310160547f},
-std::array<float,2>{0.158472002f, 0.579776049f},
-std::array<float,2>{0.616107523f, 0.728072226f},
-std::array<float,2>{0.107627682f, 0.453341961f},
-std::array<float,2>{0.909204841f, 0.102025993f},
-std::array<float,2>{0.343183398f, 0.90861702f},
-std::array<float,2>{0.948921382f, 0.555821776f},
-std::array<float,2>{0.285827637f, 0.350167811f},
-std::array<float,2>{0.511699021f, 0.208930045f},
-std::array<float,2>{0.0480897315f, 0.870797396f},
-std::array<float,2>{0.695104301f, 0.965447962f},
-std::array<float,2>{0.197724134f, 0.0220642611f},
-std::array<float,2>{0.828034341f, 0.385784388f},
-std::array<float,2>{0.387163848f, 0.663885713f},
-std::array<float,2>{0.889297247f, 0.897223413f},
-std::array<float,2>{0.372750491f, 0.0863563195f},
-std::array<float,2>{0.576268494f, 0.475201875f},
-std::array<float,2>{0.0880050287f, 0.698627949f},
-std::array<float,2>{0.62617892f, 0.620101988f},
-std::array<float,2>{0.129294261f, 0.273302883f},
-std::array<float,2>{0.753675044f, 0.130149648f},
-std::array<float,2>{0.449436069f, 0.777662873f},
-std::array<float,2>{0.852398217f, 0.629644036f},
-std::array<float,2>{0.416979671f, 0.409114033f},
-std::array<float,2>{0.729005814f, 0.047066588f},
-std::array<float,2>{0.227459177f, 0.993639171f},
-std::array<float,2>{0.544283509f, 0.841126144f},
-std::array<float,2>{0.0253248513f, 0.241315067f},
-std::array<float,2>{0.999230027f, 0.319179744f},
-std::array<float,2>{0.268569678f, 0.509058297f},
-std::array<float,2>{0.917751789f, 0.770928979f},
-std::array<float,2>{0.328732789f, 0.138280079f},
-std::array<float,2>{0.619492352f, 0.280381948f},
-std::array<float,2>{0.101196438f, 0.610268414f},
-std::array<float,2>{0.678538501f, 0.691936731f},
-std::array<float,2>{0.170612276f, 0.484121889f},
-std::array<float,2>{0.810045123f, 0.0807833299f},
-std::array<float,2>{0.491127789f, 0.898610115f},
-std::array<float,2>{0.817120075f, 0.507007062f},
-std::array<float,2>{0.382023424f, 0.325012177f},
-std::array<float,2>{0.700893581f, 0.243943274f},
-std::array<float,2>{0.190031379f, 0.835925519f},
-std::array<float,2>{0.500771165f, 0.989333153f},
-std::array<float,2>{0.0575580969f, 0.0603561997f},
-std::array<float,2>{0.940930545f, 0.416629583f},
-std::array<float,2>{0.294094741f, 0.637376308f},
-std::array<float,2>{0.764445961f, 0.914933801f},
-std::array<float,2>{0.445116282f, 0.0954311043f},
-std::array<float,2>{0.633087575f, 0.466181844f},
-std::array<float,2>{0.138998985f, 0.724514663f},
-std::array<float,2>{0.565818548f, 0.586018145f},
-std::array<float,2>{0.0785405114f, 0.299690098f},
-std::array<float,2>{0.880396545f, 0.181001097f},
-std::array<float,2>{0.36208576f, 0.793070614f},
-std::array<float,2>{0.986120462f, 0.666704595f},
-std::array<float,2>{0.278402895f, 0.376886904f},
-std::array<float,2>{0.533700943f, 0.0277373232f},
-std::array<float,2>{0.0160759222f, 0.956089735f},
-std::array<float,2>{0.720087528f, 0.861508608f},
-std::array<float,2>{0.22575669f, 0.21635443f},
-std::array<float,2>{0.847095668f, 0.359165251f},
-std::array<float,2>{0.408928454f, 0.554404855f},
-std::array<float,2>{0.87242651f, 0.82263875f},
-std::array<float,2>{0.430090129f, 0.230501294f},
-std::array<float,2>{0.745032728f, 0.341352373f},
-std::array<float,2>{0.249596462f, 0.519742608f},
-std::array<float,2>{0.553718805f, 0.647404552f},
-std::array<float,2>{0.000602673623f, 0.428247869f},
-std::array<float,2>{0.971056402f, 0.0436447076f},
-std::array<float,2>{0.250680327f, 0.974713326f},
-std::array<float,2>{0.89361316f, 0.595014632f},
-std::array<float,2>{0.343957245f, 0.258392602f},
-std::array<float,2>{0.588863969f, 0.154810533f},
-std::array<float,2>{0.0630732402f, 0.76214546f},
-std::array<float,2>{0.650658786f, 0.887593448f},
-std::array<float,2>{0.156188264f, 0.0653406009f},
-std::array<float,2>{0.776166558f, 0.489485562f},
-std::array<float,2>{0.458357066f, 0.707367837f},
-std::array<float,2>{0.953789949f, 0.952935517f},
-std::array<float,2>{0.298685998f, 0.00856422447f},
-std::array<float,2>{0.530875683f, 0.392002881f},
-std::array<float,2>{0.0342685729f, 0.682682753f},
-std::array<float,2>{0.711812973f, 0.546814084f},
-std::array<float,2>{0.213129386f, 0.363705367f},
-std::array<float,2>{0.84126842f, 0.192290947f},
-std::array<float,2>{0.401450664f, 0.856480777f},
-std::array<float,2>{0.786614239f, 0.738918841f},
-std::array<float,2>{0.484349877f, 0.445272803f},
-std::array<float,2>{0.657731295f, 0.12008588f},
-std::array<float,2>{0.180260122f, 0.931362271f},
-std::array<float,2>{0.60418725f, 0.797926724f},
-std::array<float,2>{0.112152562f, 0.162652105f},
-std::array<float,2>{0.923094034f, 0.291449904f},
-std::array<float,2>{0.325375766f, 0.572612703f},
-std::array<float,2>{0.95216769f, 0.759644926f},
-std::array<float,2>{0.284473628f, 0.15204215f},
-std::array<float,2>{0.514893532f, 0.265588552f},
-std::array<float,2>{0.0520337f, 0.599871993f},
-std::array<float,2>{0.691403151f, 0.705683529f},
-std::array<float,2>{0.200166553f, 0.486201644f},
-std::array<float,2>{0.824047267f, 0.0702910051f},
-std::array<float,2>{0.384053737f, 0.883216143f},
-std::array<float,2>{0.800168693f, 0.51744628f},
-std::array<float,2>{0.492910773f, 0.338912547f},
-std::array<float,2>{0.687261581f, 0.227739677f},
-std::array<float,2>{0.162606537f, 0.827294528f},
-std::array<float,2>{0.609533608f, 0.972467661f},
-std::array<float,2>{0.104948543f, 0.0411006138f},
-std::array<float,2>{0.910242736f, 0.424967796f},
-std::array<float,2>{0.338873237f, 0.641598642f},
-std::array<float,2>{0.858634472f, 0.934771299f},
-std::array<float,2>{0.419463545f, 0.121096298f},
-std::array<float,2>{0.732472777f, 0.437712729f},
-std::array<float,2>{0.231811985f, 0.737219989f},
-std::array<float,2>{0.541120231f, 0.577151835f},
-std::array<float,2>{0.0280407146f, 0.296653479f},
-std::array<float,2>{0.993500113f, 0.157129407f},
-std::array<float,2>{0.271227002f, 0.804308236f},
-std::array<float,2>{0.886086583f, 0.68367821f},
-std::array<float,2>{0.369759172f, 0.397704363f},
-std::array<float,2>{0.571704447f, 0.0150671937f},
-std::array<float,2>{0.0920806527f, 0.949043155f},
-std::array<float,2>{0.631663322f, 0.852820814f},
-std::array<float,2>{0.128059283f, 0.190097213f},
-std::array<float,2>{0.754901648f, 0.361612976f},
-std::array<float,2>{0.446240038f, 0.540411353f},
-std::array<float,2>{0.767460465f, 0.831417799f},
-std::array<float,2>{0.464061499f, 0.249802023f},
-std::array<float,2>{0.647227943f, 0.320987076f},
-std::array<float,2>{0.143812507f, 0.502652705f},
-std::array<float,2>{0.579478204f, 0.634547114f},
-std::array<float,2>{0.0754169077f, 0.419757038f},
-std::array<float,2>{0.905917108f, 0.0556939244f},
-std::array<float,2>{0.356069684f, 0.986958742f},
-std::array<float,2>{0.976567626f, 0.614340723f},
-std::array<float,2>{0.265171647f, 0.273982793f},
-std::array<float,2>{0.559959888f, 0.135365665f},
-std::array<float,2>{0.0137869604f, 0.768606186f},
-std::array<float,2>{0.736929119f, 0.90336138f},
-std::array<float,2>{0.236037105f, 0.0823992714f},
-std::array<float,2>{0.861404955f, 0.479710281f},
-std::array<float,2>{0.424690992f, 0.690044999f},
-std::array<float,2>{0.932017207f, 0.958949208f},
-std::array<float,2>{0.317219198f, 0.0263875946f},
-std::array<float,2>{0.594220936f, 0.379654199f},
-std::array<float,2>{0.124983773f, 0.669409215f},
-std::array<float,2>{0.666134357f, 0.550343156f},
-std::array<float,2>{0.174589619f, 0.355061203f},
-std::array<float,2>{0.79466182f, 0.214709222f},
-std::array<float,2>{0.470061809f, 0.866618991f},
-std::array<float,2>{0.83010757f, 0.72091639f},
-std::array<float,2>{0.395090163f, 0.463015944f},
-std::array<float,2>{0.703452766f, 0.0999374092f},
-std::array<float,2>{0.208195761f, 0.919936299f},
-std::array<float,2>{0.521535754f, 0.792568982f},
-std::array<float,2>{0.0437496826f, 0.186308801f},
-std::array<float,2>{0.961760104f, 0.301772565f},
-std::array<float,2>{0.310076356f, 0.591671824f},
-std::array<float,2>{0.896382213f, 0.871739149f},
-std::array<float,2>{0.351516187f, 0.206185117f},
-std::array<float,2>{0.592592955f, 0.347552001f},
-std::array<float,2>{0.0694295838f, 0.560684502f},
-std::array<float,2>{0.654410124f, 0.660135984f},
-std::array<float,2>{0.149000138f, 0.389807582f},
-std::array<float,2>{0.780445457f, 0.0179702435f},
-std::array<float,2>{0.454598069f, 0.961672664f},
-std::array<float,2>{0.867549002f, 0.582134128f},
-std::array<float,2>{0.437379003f, 0.306521177f},
-std::array<float,2>{0.746430576f, 0.173781946f},
-std::array<float,2>{0.244718134f, 0.784061134f},
-std::array<float,2>{0.548116505f, 0.913756132f},
-std::array<float,2>{0.00450659264f, 0.109250322f},
-std::array<float,2>{0.976243019f, 0.457377583f},
-std::array<float,2>{0.256958067f, 0.732753038f},
-std::array<float,2>{0.782943308f, 0.997902453f},
-std::array<float,2>{0.476715803f, 0.0525672957f},
-std::array<float,2>{0.663068831f, 0.412040859f},
-std::array<float,2>{0.1851044f, 0.626502991f},
-std::array<float,2>{0.60852927f, 0.514696002f},
-std::array<float,2>{0.116922043f, 0.313297033f},
-std::array<float,2>{0.929380178f, 0.234465599f},
-std::array<float,2>{0.321157545f, 0.839251578f},
-std::array<float,2>{0.960308611f, 0.69949317f},
-std::array<float,2>{0.302075893f, 0.47245115f},
-std::array<float,2>{0.525241017f, 0.0912295878f},
-std::array<float,2>{0.0381115302f, 0.894226491f},
-std::array<float,2>{0.716351569f, 0.773589551f},
-std::array<float,2>{0.214849472f, 0.128254697f},
-std::array<float,2>{0.837974906f, 0.267700821f},
-std::array<float,2>{0.405017942f, 0.623435855f},
-std::array<float,2>{0.81265229f, 0.810629547f},
-std::array<float,2>{0.376513809f, 0.171473652f},
-std::array<float,2>{0.699199021f, 0.284010261f},
-std::array<float,2>{0.194231272f, 0.567414045f},
-std::array<float,2>{0.507799923f, 0.74696213f},
-std::array<float,2>{0.0604746789f, 0.451420963f},
-std::array<float,2>{0.944975615f, 0.114284433f},
-std::array<float,2>{0.289085895f, 0.925158858f},
-std::array<float,2>{0.918869376f, 0.536842227f},
-std::array<float,2>{0.332576036f, 0.367924362f},
-std::array<float,2>{0.624881327f, 0.195911586f},
-std::array<float,2>{0.0961828008f, 0.846279681f},
-std::array<float,2>{0.674598753f, 0.938596725f},
-std::array<float,2>{0.165056407f, 0.00365236984f},
-std::array<float,2>{0.806363165f, 0.399408311f},
-std::array<float,2>{0.485635489f, 0.679139018f},
-std::array<float,2>{0.991104186f, 0.880726337f},
-std::array<float,2>{0.27379635f, 0.071678251f},
-std::array<float,2>{0.535353243f, 0.496489674f},
-std::array<float,2>{0.0221810248f, 0.718710184f},
-std::array<float,2>{0.726551235f, 0.607590973f},
-std::array<float,2>{0.218892232f, 0.256461918f},
-std::array<float,2>{0.84969604f, 0.146263078f},
-std::array<float,2>{0.41129756f, 0.75379163f},
-std::array<float,2>{0.757880151f, 0.650899649f},
-std::array<float,2>{0.437747955f, 0.436220706f},
-std::array<float,2>{0.640116155f, 0.035303548f},
-std::array<float,2>{0.136634588f, 0.978966832f},
-std::array<float,2>{0.568438709f, 0.814374983f},
-std::array<float,2>{0.0841893926f, 0.22127296f},
-std::array<float,2>{0.876127243f, 0.329691917f},
-std::array<float,2>{0.365832478f, 0.529663742f},
-std::array<float,2>{0.971388459f, 0.821646571f},
-std::array<float,2>{0.250411868f, 0.233438209f},
-std::array<float,2>{0.554275513f, 0.343352079f},
-std::array<float,2>{0.000167450518f, 0.523371756f},
-std::array<float,2>{0.744556844f, 0.644585192f},
-std::array<float,2>{0.249293581f, 0.426985651f},
-std::array<float,2>{0.872812212f, 0.0455377102f},
-std::array<float,2>{0.430438519f, 0.974082649f},
-std::array<float,2>{0.775650263f, 0.597590744f},
-std::array<float,2>{0.458568335f, 0.260013819f},
-std::array<float,2>{0.651172996f, 0.15235199f},
-std::array<float,2>{0.155276269f, 0.765413046f},
-std::array<float,2>{0.588017583f, 0.889040649f},
-std::array<float,2>{0.0625092089f, 0.0635784119f},
-std::array<float,2>{0.894056201f, 0.491133809f},
-std::array<float,2>{0.344315022f, 0.709841907f},
-std::array<float,2>{0.841376662f, 0.950866401f},
-std::array<float,2>{0.402343631f, 0.0105405757f},
-std::array<float,2>{0.711370349f, 0.39383918f},
-std::array<float,2>{0.21361123f, 0.680103302f},
-std::array<float,2>{0.530629098f, 0.543290019f},
-std::array<float,2>{0.0350263305f, 0.36685285f},
-std::array<float,2>{0.953604519f, 0.195213199f},
-std::array<float,2>{0.297878951f, 0.859129906f},
-std::array<float,2>{0.92359072f, 0.740252912f},
-std::array<float,2>{0.325742304f, 0.442784429f},
-std::array<float,2>{0.603875935f, 0.117845319f},
-std::array<float,2>{0.1116184f, 0.93263042f},
-std::array<float,2>{0.657712221f, 0.800222039f},
-std::array<float,2>{0.179842591f, 0.161442801f},
-std::array<float,2>{0.78689903f, 0.289737403f},
-std::array<float,2>{0.483431071f, 0.571548045f},
-std::array<float,2>{0.810481906f, 0.772141576f},
-std::array<float,2>{0.49068144f, 0.139468521f},
-std::array<float,2>{0.678178251f, 0.278422505f},
-std::array<float,2>{0.169940546f, 0.612430871f},
-std::array<float,2>{0.619913697f, 0.694378555f},
-std::array<float,2>{0.100834556f, 0.481430471f},
-std::array<float,2>{0.917299688f, 0.0785273686f},
-std::array<float,2>{0.328307748f, 0.900827408f},
-std::array<float,2>{0.940600336f, 0.505683899f},
-std::array<float,2>{0.294692725f, 0.32717225f},
-std::array<float,2>{0.500166118f, 0.246049136f},
-std::array<float,2>{0.0570409782f, 0.833803415f},
-std::array<float,2>{0.70033747f, 0.991363883f},
-std::array<float,2>{0.189477324f, 0.06190506f},
-std::array<float,2>{0.816465139f, 0.415591925f},
-std::array<float,2>{0.382335603f, 0.640599489f},
-std::array<float,2>{0.880128086f, 0.917808414f},
-std::array<float,2>{0.361497194f, 0.0973915234f},
-std::array<float,2>{0.56602031f, 0.467617035f},
-std::array<float,2>{0.0786841214f, 0.725126088f},
-std::array<float,2>{0.633624256f, 0.588002264f},
-std::array<float,2>{0.139632195f, 0.297031969f},
-std::array<float,2>{0.764135361f, 0.18183665f},
-std::array<float,2>{0.444396585f, 0.795874417f},
-std::array<float,2>{0.847361147f, 0.665849924f},
-std::array<float,2>{0.408595383f, 0.377902478f},
-std::array<float,2>{0.720534325f, 0.0305920504f},
-std::array<float,2>{0.226239756f, 0.953477323f},
-std::array<float,2>{0.533441126f, 0.859548867f},
-std::array<float,2>{0.0161550771f, 0.217391014f},
-std::array<float,2>{0.985766172f, 0.355738074f},
-std::array<float,2>{0.278997004f, 0.551832736f},
-std::array<float,2>{0.909960151f, 0.785701513f},
-std::array<float,2>{0.343455732f, 0.177063242f},
-std::array<float,2>{0.615575194f, 0.311438859f},
-std::array<float,2>{0.108182132f, 0.581491113f},
-std::array<float,2>{0.680854261f, 0.729363143f},
-std::array<float,2>{0.15911606f, 0.456902444f},
-std::array<float,2>{0.801706672f, 0.103892036f},
-std::array<float,2>{0.496181518f, 0.906313658f},
-std::array<float,2>{0.827319682f, 0.556676388f},
-std::array<float,2>{0.387652367f, 0.349030107f},
-std::array<float,2>{0.694387555f, 0.210228041f},
-std::array<float,2>{0.198198497f, 0.868081093f},
-std::array<float,2>{0.511166692f, 0.968370318f},
-std::array<float,2>{0.0485867895f, 0.0203536004f},
-std::array<float,2>{0.948420763f, 0.383398175f},
-std::array<float,2>{0.28544873f, 0.660351574f},
-std::array<float,2>{0.753406644f, 0.894711077f},
-std::array<float,2>{0.450137675f, 0.0892167613f},
-std::array<float,2>{0.626690745f, 0.474297553f},
-std::array<float,2>{0.129591063f, 0.695564926f},
-std::array<float,2>{0.577044845f, 0.618371487f},
-std::array<float,2>{0.0888401493f, 0.270400524f},
-std::array<float,2>{0.889116466f, 0.132703796f},
-std::array<float,2>{0.372376084f, 0.780123651f},
-std::array<float,2>{0.999561012f, 0.631653845f},
-std::array<float,2>{0.26948458f, 0.406386018f},
-std::array<float,2>{0.544874668f, 0.0503269136f},
-std::array<float,2>{0.0248593204f, 0.995364606f},
-std::array<float,2>{0.728844225f, 0.843213499f},
-std::array<float,2>{0.226863906f, 0.239358336f},
-std::array<float,2>{0.851948917f, 0.317433059f},
-std::array<float,2>{0.416249454f, 0.510020673f},
-std::array<float,2>{0.864939094f, 0.848823786f},
-std::array<float,2>{0.426419377f, 0.200565577f},
-std::array<float,2>{0.740371525f, 0.37229225f},
-std::array<float,2>{0.241773456f, 0.534273326f},
-std::array<float,2>{0.555944145f, 0.675228477f},
-std::array<float,2>{0.0113190021f, 0.405130357f},
-std::array<float,2>{0.983573973f, 0.007498716f},
-std::array<float,2>{0.259938091f, 0.942980349f},
-std::array<float,2>{0.900691152f, 0.564156651f},
-std::array<float,2>{0.35238108f, 0.28823036f},
-std::array<float,2>{0.58509773f, 0.165391102f},
-std::array<float,2>{0.0730111897f, 0.805043936f},
-std::array<float,2>{0.643072963f, 0.92702204f},
-std::array<float,2>{0.14629747f, 0.112518102f},
-std::array<float,2>{0.770311594f, 0.447462589f},
-std::array<float,2>{0.467738658f, 0.744581044f},
-std::array<float,2>{0.968722343f, 0.982857227f},
-std::array<float,2>{0.307922304f, 0.0344277248f},
-std::array<float,2>{0.518286049f, 0.431867421f},
-std::array<float,2>{0.0400926247f, 0.65406245f},
-std::array<float,2>{0.709611058f, 0.524149895f},
-std::array<float,2>{0.205483973f, 0.33229363f},
-std::array<float,2>{0.834448993f, 0.223011762f},
-std::array<float,2>{0.392971337f, 0.818413556f},
-std::array<float,2>{0.792602181f, 0.711864412f},
-std::array<float,2>{0.472726375f, 0.493657172f},
-std::array<float,2>{0.670154452f, 0.0756831393f},
-std::array<float,2>{0.179043189f, 0.876585722f},
-std::array<float,2>{0.598992765f, 0.755698204f},
-std::array<float,2>{0.117906593f, 0.140688315f},
-std::array<float,2>{0.935445905f, 0.251488149f},
-std::array<float,2>{0.314324319f, 0.604122043f},
-std::array<float,2>{0.994365811f, 0.802658737f},
-std::array<float,2>{0.272179902f, 0.158927038f},
-std::array<float,2>{0.540383458f, 0.294554442f},
-std::array<float,2>{0.030693531f, 0.575192332f},
-std::array<float,2>{0.731173575f, 0.736068785f},
-std::array<float,2>{0.23302123f, 0.440177947f},
-std::array<float,2>{0.856350541f, 0.124265365f},
-std::array<float,2>{0.421866089f, 0.93747133f},
-std::array<float,2>{0.756938994f, 0.542886138f},
-std::array<float,2>{0.448155522f, 0.359645396f},
-std::array<float,2>{0.629849494f, 0.187532648f},
-std::array<float,2>{0.125267699f, 0.853673995f},
-std::array<float,2>{0.572298348f, 0.947200894f},
-std::array<float,2>{0.0900922567f, 0.0132015152f},
-std::array<float,2>{0.883103788f, 0.395646125f},
-std::array<float,2>{0.36900869f, 0.68670243f},
-std::array<float,2>{0.822015584f, 0.885287702f},
-std::array<float,2>{0.386045188f, 0.0680650845f},
-std::array<float,2>{0.687918365f, 0.488036066f},
-std::array<float,2>{0.202198759f, 0.704233229f},
-std::array<float,2>{0.512245655f, 0.597861946f},
-std::array<float,2>{0.0546487197f, 0.262676716f},
-std::array<float,2>{0.950995684f, 0.148755476f},
-std::array<float,2>{0.282728851f, 0.760988057f},
-std::array<float,2>{0.913116395f, 0.643437624f},
-std::array<float,2>{0.337248147f, 0.42263186f},
-std::array<float,2>{0.611922443f, 0.0392796732f},
-std::array<float,2>{0.103346296f, 0.969841659f},
-std::array<float,2>{0.68405962f, 0.825779021f},
-std::array<float,2>{0.16204448f, 0.230008841f},
-std::array<float,2>{0.797884762f, 0.336646169f},
-std::array<float,2>{0.495014757f, 0.518371165f},
-std::array<float,2>{0.796186864f, 0.864698231f},
-std::array<float,2>{0.470707536f, 0.212590829f},
-std::array<float,2>{0.66436708f, 0.352027595f},
-std::array<float,2>{0.173336372f, 0.548261344f},
-std::array<float,2>{0.59664011f, 0.670111895f},
-std::array<float,2>{0.122644037f, 0.381695926f},
-std::array<float,2>{0.931308746f, 0.0245759282f},
-std::array<float,2>{0.319695413f, 0.959860027f},
-std::array<float,2>{0.964581609f, 0.59192282f},
-std::array<float,2>{0.311315984f, 0.302999496f},
-std::array<float,2>{0.521456182f, 0.1839623f},
-std::array<float,2>{0.0457923524f, 0.789478481f},
-std::array<float,2>{0.705637574f, 0.918582857f},
-std::array<float,2>{0.21072489f, 0.0980427787f},
-std::array<float,2>{0.830002129f, 0.461128473f},
-std::array<float,2>{0.398174077f, 0.720453799f},
-std::array<float,2>{0.902469218f, 0.986225188f},
-std::array<float,2>{0.357666492f, 0.0583495572f},
-std::array<float,2>{0.581282675f, 0.420825034f},
-std::array<float,2>{0.0778050348f, 0.634950519f},
-std::array<float,2>{0.645347893f, 0.501166403f},
-std::array<float,2>{0.142325029f, 0.323867738f},
-std::array<float,2>{0.768222213f, 0.247210234f},
-std::array<float,2>{0.461032212f, 0.829427063f},
-std::array<float,2>{0.85970372f, 0.689158022f},
-std::array<float,2>{0.4222188f, 0.477198035f},
-std::array<float,2>{0.73532486f, 0.085608229f},
-std::array<float,2>{0.236386299f, 0.904644251f},
-std::array<float,2>{0.560548127f, 0.767504275f},
-std::array<float,2>{0.0127801411f, 0.134305015f},
-std::array<float,2>{0.980071187f, 0.276126951f},
-std::array<float,2>{0.26240328f, 0.615472555f},
-std::array<float,2>{0.926338851f, 0.836503029f},
-std::array<float,2>{0.32300052f, 0.237792507f},
-std::array<float,2>{0.607408106f, 0.316081345f},
-std::array<float,2>{0.114759877f, 0.512349129f},
-std::array<float,2>{0.660790503f, 0.628112257f},
-std::array<float,2>{0.187040716f, 0.41320923f},
-std::array<float,2>{0.783722401f, 0.0541234761f},
-std::array<float,2>{0.479273617f, 0.9981336f},
-std::array<float,2>{0.83601439f, 0.622328162f},
-std::array<float,2>{0.403400183f, 0.265992463f},
-std::array<float,2>{0.71791321f, 0.126364902f},
-std::array<float,2>{0.217223167f, 0.77713716f},
-std::array<float,2>{0.526691496f, 0.891648293f},
-std::array<float,2>{0.0363015048f, 0.0928493068f},
-std::array<float,2>{0.957339346f, 0.469125122f},
-std::array<float,2>{0.302884698f, 0.701877415f},
-std::array<float,2>{0.777613878f, 0.964052379f},
-std::array<float,2>{0.455572873f, 0.0157624707f},
-std::array<float,2>{0.653052807f, 0.388512909f},
-std::array<float,2>{0.152261585f, 0.656813145f},
-std::array<float,2>{0.590595365f, 0.560286999f},
-std::array<float,2>{0.0683196634f, 0.345212519f},
-std::array<float,2>{0.897979438f, 0.204834297f},
-std::array<float,2>{0.347722352f, 0.873161077f},
-std::array<float,2>{0.973944902f, 0.731779516f},
-std::array<float,2>{0.25454402f, 0.460745454f},
-std::array<float,2>{0.548911691f, 0.106732108f},
-std::array<float,2>{0.00754219806f, 0.910299659f},
-std::array<float,2>{0.74874568f, 0.782654881f},
-std::array<float,2>{0.243596122f, 0.174278349f},
-std::array<float,2>{0.869450629f, 0.306806684f},
-std::array<float,2>{0.433771968f, 0.584417641f},
-std::array<float,2>{0.848135054f, 0.75105983f},
-std::array<float,2>{0.412349463f, 0.147592068f},
-std::array<float,2>{0.722918272f, 0.255342066f},
-std::array<float,2>{0.220819473f, 0.606205165f},
-std::array<float,2>{0.53715831f, 0.714991689f},
-std::array<float,2>{0.0201031566f, 0.499347895f},
-std::array<float,2>{0.98887521f, 0.0729381964f},
-std::array<float,2>{0.276963711f, 0.881008625f},
-std::array<float,2>{0.878520787f, 0.528811157f},
-std::array<float,2>{0.363420516f, 0.330274701f},
-std::array<float,2>{0.567272663f, 0.220321283f},
-std::array<float,2>{0.0822118595f, 0.815226316f},
-std::array<float,2>{0.637651503f, 0.977741957f},
-std::array<float,2>{0.133300409f, 0.0383403711f},
-std::array<float,2>{0.760623991f, 0.434136093f},
-std::array<float,2>{0.439987332f, 0.648565352f},
-std::array<float,2>{0.9414832f, 0.922291934f},
-std::array<float,2>{0.291892171f, 0.116519168f},
-std::array<float,2>{0.505814075f, 0.450278103f},
-std::array<float,2>{0.061632216f, 0.749907434f},
-std::array<float,2>{0.696686327f, 0.569956541f},
-std::array<float,2>{0.192304298f, 0.282688528f},
-std::array<float,2>{0.816292882f, 0.168174118f},
-std::array<float,2>{0.377961606f, 0.809667289f},
-std::array<float,2>{0.807384312f, 0.677078366f},
-std::array<float,2>{0.486436516f, 0.402297467f},
-std::array<float,2>{0.673414886f, 0.000737315277f},
-std::array<float,2>{0.167428032f, 0.940645278f},
-std::array<float,2>{0.622685611f, 0.844774067f},
-std::array<float,2>{0.0946508497f, 0.198673293f},
-std::array<float,2>{0.920153081f, 0.370237857f},
-std::array<float,2>{0.335117698f, 0.538234055f},
-std::array<float,2>{0.956813693f, 0.857005477f},
-std::array<float,2>{0.300779909f, 0.191674739f},
-std::array<float,2>{0.527365744f, 0.364216655f},
-std::array<float,2>{0.0324482322f, 0.546216965f},
-std::array<float,2>{0.714021266f, 0.683238447f},
-std::array<float,2>{0.211936221f, 0.392388314f},
-std::array<float,2>{0.842227101f, 0.00818835571f},
-std::array<float,2>{0.400169998f, 0.952193916f},
-std::array<float,2>{0.788331151f, 0.572784007f},
-std::array<float,2>{0.481049299f, 0.291882843f},
-std::array<float,2>{0.658218563f, 0.162493467f},
-std::array<float,2>{0.181716844f, 0.798760891f},
-std::array<float,2>{0.601795971f, 0.930916011f},
-std::array<float,2>{0.110003687f, 0.119270884f},
-std::array<float,2>{0.924781382f, 0.444650203f},
-std::array<float,2>{0.327912599f, 0.738293171f},
-std::array<float,2>{0.874002635f, 0.975174546f},
-std::array<float,2>{0.432542622f, 0.0433805548f},
-std::array<float,2>{0.742731094f, 0.427766889f},
-std::array<float,2>{0.247029498f, 0.646758616f},
-std::array<float,2>{0.551612198f, 0.520091593f},
-std::array<float,2>{0.00289507094f, 0.340827286f},
-std::array<float,2>{0.969561696f, 0.231086716f},
-std::array<float,2>{0.252797365f, 0.822897375f},
-std::array<float,2>{0.890824676f, 0.707658648f},
-std::array<float,2>{0.34626475f, 0.490213841f},
-std::array<float,2>{0.586382985f, 0.0649373233f},
-std::array<float,2>{0.0646349862f, 0.886923194f},
-std::array<float,2>{0.649007142f, 0.762465537f},
-std::array<float,2>{0.152854294f, 0.154608577f},
-std::array<float,2>{0.775356352f, 0.257962942f},
-std::array<float,2>{0.460137874f, 0.595591962f},
-std::array<float,2>{0.763588428f, 0.793636858f},
-std::array<float,2>{0.441494435f, 0.181254074f},
-std::array<float,2>{0.634820342f, 0.299004942f},
-std::array<float,2>{0.138239786f, 0.586742163f},
-std::array<float,2>{0.56288588f, 0.724007845f},
-std::array<float,2>{0.0815662891f, 0.466646463f},
-std::array<float,2>{0.882015765f, 0.0951904133f},
-std::array<float,2>{0.360867232f, 0.914139569f},
-std::array<float,2>{0.987302542f, 0.554098785f},
-std::array<float,2>{0.280719101f, 0.358648241f},
-std::array<float,2>{0.532530963f, 0.21602194f},
-std::array<float,2>{0.0192368906f, 0.862267315f},
-std::array<float,2>{0.721715271f, 0.956881762f},
-std::array<float,2>{0.224424437f, 0.0280283745f},
-std::array<float,2>{0.84533143f, 0.376103103f},
-std::array<float,2>{0.407123089f, 0.666143119f},
-std::array<float,2>{0.91427654f, 0.899401784f},
-std::array<float,2>{0.330190808f, 0.0802852809f},
-std::array<float,2>{0.617281735f, 0.483673096f},
-std::array<float,2>{0.0993913189f, 0.691647947f},
-std::array<float,2>{0.677247584f, 0.60956347f},
-std::array<float,2>{0.168018952f, 0.280936271f},
-std::array<float,2>{0.811547756f, 0.137866542f},
-std::array<float,2>{0.489783525f, 0.771367669f},
-std::array<float,2>{0.819011509f, 0.636969149f},
-std::array<float,2>{0.380590141f, 0.416115999f},
-std::array<float,2>{0.701469779f, 0.0599507131f},
-std::array<float,2>{0.18773739f, 0.990056932f},
-std::array<float,2>{0.502565145f, 0.835037649f},
-std::array<float,2>{0.0550349541f, 0.243572146f},
-std::array<float,2>{0.93767488f, 0.32429105f},
-std::array<float,2>{0.295165777f, 0.507783473f},
-std::array<float,2>{0.888474882f, 0.777918875f},
-std::array<float,2>{0.37317872f, 0.130405739f},
-std::array<float,2>{0.575519741f, 0.27276355f},
-std::array<float,2>{0.086590454f, 0.619455576f},
-std::array<float,2>{0.628723562f, 0.698944926f},
-std::array<float,2>{0.132268921f, 0.474657297f},
-std::array<float,2>{0.750256419f, 0.0865381137f},
-std::array<float,2>{0.451246321f, 0.896857679f},
-std::array<float,2>{0.855381489f, 0.509414792f},
-std::array<float,2>{0.415303409f, 0.318423748f},
-std::array<float,2>{0.726741552f, 0.241717517f},
-std::array<float,2>{0.229021743f, 0.841526806f},
-std::array<float,2>{0.546199739f, 0.993654907f},
-std::array<float,2>{0.0265456233f, 0.0476486422f},
-std::array<float,2>{0.996561289f, 0.408314258f},
-std::array<float,2>{0.267492086f, 0.628926277f},
-std::array<float,2>{0.804632843f, 0.908860743f},
-std::array<float,2>{0.498265028f, 0.102062084f},
-std::array<float,2>{0.682706237f, 0.453885794f},
-std::array<float,2>{0.158062533f, 0.727600038f},
-std::array<float,2>{0.613855064f, 0.579464436f},
-std::array<float,2>{0.106407151f, 0.30994162f},
-std::array<float,2>{0.906397462f, 0.178878814f},
-std::array<float,2>{0.33986029f, 0.78812921f},
-std::array<float,2>{0.945535123f, 0.663510978f},
-std::array<float,2>{0.289007008f, 0.386256844f},
-std::array<float,2>{0.509622991f, 0.0219036434f},
-std::array<float,2>{0.0491853915f, 0.965321302f},
-std::array<float,2>{0.69198525f, 0.8702299f},
-std::array<float,2>{0.196219042f, 0.208316535f},
-std::array<float,2>{0.824272454f, 0.350061178f},
-std::array<float,2>{0.390377373f, 0.556310356f},
-std::array<float,2>{0.833017528f, 0.818094254f},
-std::array<float,2>{0.392310768f, 0.226552173f},
-std::array<float,2>{0.708225489f, 0.334389716f},
-std::array<float,2>{0.204101712f, 0.525739968f},
-std::array<float,2>{0.515884638f, 0.655249953f},
-std::array<float,2>{0.0424154773f, 0.43000716f},
-std::array<float,2>{0.965270162f, 0.0319149271f},
-std::array<float,2>{0.305646688f, 0.981822252f},
-std::array<float,2>{0.936642885f, 0.602247894f},
-std::array<float,2>{0.314873517f, 0.253265709f},
-std::array<float,2>{0.601080775f, 0.143754557f},
-std::array<float,2>{0.119243585f, 0.756290138f},
-std::array<float,2>{0.668095827f, 0.877868354f},
-std::array<float,2>{0.17751728f, 0.0766787827f},
-std::array<float,2>{0.790950835f, 0.496056527f},
-std::array<float,2>{0.476214767f, 0.714108586f},
-std::array<float,2>{0.980712593f, 0.944207728f},
-std::array<float,2>{0.259570688f, 0.00416827714f},
-std::array<float,2>{0.557314456f, 0.403160602f},
-std::array<float,2>{0.00799727719f, 0.673356235f},
-std::array<float,2>{0.738321126f, 0.532952547f},
-std::array<float,2>{0.239923894f, 0.374027163f},
-std::array<float,2>{0.866936862f, 0.202504873f},
-std::array<float,2>{0.429443866f, 0.850744843f},
-std::array<float,2>{0.772290528f, 0.743887901f},
-std::array<float,2>{0.466089368f, 0.446023226f},
-std::array<float,2>{0.641002238f, 0.109622322f},
-std::array<float,2>{0.147407398f, 0.929179013f},
-std::array<float,2>{0.58314687f, 0.808471859f},
-std::array<float,2>{0.0721859038f, 0.167523161f},
-std::array<float,2>{0.900134146f, 0.285267979f},
-std::array<float,2>{0.354043812f, 0.566268802f},
-std::array<float,2>{0.979405999f, 0.768543243f},
-std::array<float,2>{0.262986243f, 0.136713922f},
-std::array<float,2>{0.56185019f, 0.274698526f},
-std::array<float,2>{0.01246842f, 0.613991797f},
-std::array<float,2>{0.735644698f, 0.691328049f},
-std::array<float,2>{0.238184661f, 0.478952289f},
-std::array<float,2>{0.860830486f, 0.0838222355f},
-std::array<float,2>{0.423257649f, 0.902408957f},
-std::array<float,2>{0.76900667f, 0.503865778f},
-std::array<float,2>{0.462756127f, 0.322063118f},
-std::array<float,2>{0.646001458f, 0.248702928f},
-std::array<float,2>{0.14086847f, 0.830395639f},
-std::array<float,2>{0.580898881f, 0.987899721f},
-std::array<float,2>{0.07626497f, 0.0547551177f},
-std::array<float,2>{0.903770685f, 0.41834572f},
-std::array<float,2>{0.358580709f, 0.633191407f},
-std::array<float,2>{0.828771889f, 0.9213866f},
-std::array<float,2>{0.396863669f, 0.100592069f},
-std::array<float,2>{0.706949234f, 0.464318633f},
-std::array<float,2>{0.209888592f, 0.722182155f},
-std::array<float,2>{0.52011919f, 0.590691626f},
-std::array<float,2>{0.0468284488f, 0.301315427f},
-std::array<float,2>{0.963225603f, 0.186526671f},
-std::array<float,2>{0.312236786f, 0.791416705f},
-std::array<float,2>{0.929904401f, 0.66863966f},
-std::array<float,2>{0.318639964f, 0.379976869f},
-std::array<float,2>{0.597390175f, 0.0254888814f},
-std::array<float,2>{0.121623583f, 0.957557261f},
-std::array<float,2>{0.665100276f, 0.865725398f},
-std::array<float,2>{0.172379434f, 0.213335007f},
-std::array<float,2>{0.795324385f, 0.354052335f},
-std::array<float,2>{0.472565949f, 0.549300015f},
-std::array<float,2>{0.797011673f, 0.82688421f},
-std::array<float,2>{0.495823205f, 0.227353737f},
-std::array<float,2>{0.685355425f, 0.338428617f},
-std::array<float,2>{0.161051929f, 0.516303957f},
-std::array<float,2>{0.612802625f, 0.64242053f},
-std::array<float,2>{0.102479838f, 0.423912942f},
-std::array<float,2>{0.912277818f, 0.0428215861f},
-std::array<float,2>{0.336436719f, 0.971249998f},
-std::array<float,2>{0.949552059f, 0.600932419f},
-std::array<float,2>{0.281536639f, 0.26451546f},
-std::array<float,2>{0.513520956f, 0.151031554f},
-std::array<float,2>{0.0534801856f, 0.758583784f},
-std::array<float,2>{0.689121902f, 0.884580374f},
-std::array<float,2>{0.201536611f, 0.0688167438f},
-std::array<float,2>{0.820973217f, 0.485337973f},
-std::array<float,2>{0.385040253f, 0.706898212f},
-std::array<float,2>{0.883970737f, 0.947591841f},
-std::array<float,2>{0.367707551f, 0.0143051501f},
-std::array<float,2>{0.573933363f, 0.397185564f},
-std::array<float,2>{0.0913635641f, 0.685364723f},
-std::array<float,2>{0.630544424f, 0.539452732f},
-std::array<float,2>{0.126448914f, 0.363249958f},
-std::array<float,2>{0.756350279f, 0.191227481f},
-std::array<float,2>{0.449100375f, 0.852312326f},
-std::array<float,2>{0.857218087f, 0.737694561f},
-std::array<float,2>{0.420827687f, 0.438620746f},
-std::array<float,2>{0.73223269f, 0.12269894f},
-std::array<float,2>{0.234079316f, 0.934366405f},
-std::array<float,2>{0.539697647f, 0.803193092f},
-std::array<float,2>{0.0299568549f, 0.158026114f},
-std::array<float,2>{0.995349765f, 0.295846045f},
-std::array<float,2>{0.273267448f, 0.577107191f},
-std::array<float,2>{0.921128511f, 0.846735716f},
-std::array<float,2>{0.334451735f, 0.19696629f},
-std::array<float,2>{0.621276736f, 0.369055927f},
-std::array<float,2>{0.0948757902f, 0.535254002f},
-std::array<float,2>{0.672148168f, 0.678233445f},
-std::array<float,2>{0.16668117f, 0.399921298f},
-std::array<float,2>{0.807677507f, 0.00219873013f},
-std::array<float,2>{0.487655431f, 0.93824631f},
-std::array<float,2>{0.814566612f, 0.566912472f},
-std::array<float,2>{0.377351612f, 0.284804642f},
-std::array<float,2>{0.695640147f, 0.17019245f},
-std::array<float,2>{0.192518979f, 0.81231159f},
-std::array<float,2>{0.504744589f, 0.924062967f},
-std::array<float,2>{0.0609344169f, 0.113785036f},
-std::array<float,2>{0.94296509f, 0.452982008f},
-std::array<float,2>{0.292063683f, 0.747579634f},
-std::array<float,2>{0.761649072f, 0.980354607f},
-std::array<float,2>{0.441404015f, 0.0367871821f},
-std::array<float,2>{0.637884915f, 0.437048197f},
-std::array<float,2>{0.134144351f, 0.651441813f},
-std::array<float,2>{0.567843854f, 0.530274212f},
-std::array<float,2>{0.0835691169f, 0.329030275f},
-std::array<float,2>{0.877730966f, 0.222153142f},
-std::array<float,2>{0.364913881f, 0.812748492f},
-std::array<float,2>{0.989447236f, 0.717359722f},
-std::array<float,2>{0.275480717f, 0.497899622f},
-std::array<float,2>{0.538768709f, 0.0707440451f},
-std::array<float,2>{0.0211684629f, 0.87983793f},
-std::array<float,2>{0.724234045f, 0.75240916f},
-std::array<float,2>{0.222648129f, 0.144662946f},
-std::array<float,2>{0.848846793f, 0.257328451f},
-std::array<float,2>{0.413840681f, 0.609291315f},
-std::array<float,2>{0.870547473f, 0.784588218f},
-std::array<float,2>{0.435483605f, 0.172792181f},
-std::array<float,2>{0.749697924f, 0.305302411f},
-std::array<float,2>{0.24287343f, 0.583971679f},
-std::array<float,2>{0.550341427f, 0.733831704f},
-std::array<float,2>{0.00615576934f, 0.458565921f},
-std::array<float,2>{0.973087966f, 0.10755305f},
-std::array<float,2>{0.25499022f, 0.912712693f},
-std::array<float,2>{0.897307873f, 0.562457204f},
-std::array<float,2>{0.349146456f, 0.345879287f},
-std::array<float,2>{0.591546774f, 0.205880627f},
-std::array<float,2>{0.067043066f, 0.873035252f},
-std::array<float,2>{0.653845727f, 0.962517619f},
-std::array<float,2>{0.151014879f, 0.0194415282f},
-std::array<float,2>{0.778339446f, 0.389389962f},
-std::array<float,2>{0.456985921f, 0.659078896f},
-std::array<float,2>{0.958635986f, 0.89320451f},
-std::array<float,2>{0.303936154f, 0.0900145918f},
-std::array<float,2>{0.526038468f, 0.471361578f},
-std::array<float,2>{0.0361122414f, 0.701046109f},
-std::array<float,2>{0.71743387f, 0.624636054f},
-std::array<float,2>{0.218179703f, 0.26937142f},
-std::array<float,2>{0.837013602f, 0.12759158f},
-std::array<float,2>{0.402537256f, 0.774652421f},
-std::array<float,2>{0.784483433f, 0.625100672f},
-std::array<float,2>{0.480181187f, 0.411114484f},
-std::array<float,2>{0.661894321f, 0.0511764586f},
-std::array<float,2>{0.186080128f, 0.996850789f},
-std::array<float,2>{0.605759859f, 0.838178813f},
-std::array<float,2>{0.113875188f, 0.235492334f},
-std::array<float,2>{0.92691499f, 0.314445376f},
-std::array<float,2>{0.323758781f, 0.514361799f},
-std::array<float,2>{0.939146876f, 0.832198977f},
-std::array<float,2>{0.296248287f, 0.244461641f},
-std::array<float,2>{0.503799856f, 0.327012837f},
-std::array<float,2>{0.0558853075f, 0.504240811f},
-std::array<float,2>{0.702276587f, 0.639298618f},
-std::array<float,2>{0.189245179f, 0.414483428f},
-std::array<float,2>{0.820073724f, 0.060587462f},
-std::array<float,2>{0.379765958f, 0.990510106f},
-std::array<float,2>{0.810970008f, 0.61135298f},
-std::array<float,2>{0.488509178f, 0.278267771f},
-std::array<float,2>{0.676475465f, 0.140031338f},
-std::array<float,2>{0.169107437f, 0.773409069f},
-std::array<float,2>{0.618945301f, 0.902159214f},
-std::array<float,2>{0.0979582518f, 0.0792177394f},
-std::array<float,2>{0.9155007f, 0.481543154f},
-std::array<float,2>{0.331391126f, 0.693584085f},
-std::array<float,2>{0.84465462f, 0.954691052f},
-std::array<float,2>{0.407365799f, 0.0293894969f},
-std::array<float,2>{0.721191704f, 0.37847054f},
-std::array<float,2>{0.223369509f, 0.664970875f},
-std::array<float,2>{0.531921446f, 0.551463544f},
-std::array<float,2>{0.0178841092f, 0.356961668f},
-std::array<float,2>{0.987772048f, 0.218547121f},
-std::array<float,2>{0.279969394f, 0.860764861f},
-std::array<float,2>{0.881482244f, 0.726090491f},
-std::array<float,2>{0.360008806f, 0.468527466f},
-std::array<float,2>{0.564108133f, 0.0958329216f},
-std::array<float,2>{0.080095835f, 0.916881561f},
-std::array<float,2>{0.636133254f, 0.795945048f},
-std::array<float,2>{0.137392327f, 0.183567181f},
-std::array<float,2>{0.762437344f, 0.298743755f},
-std::array<float,2>{0.443074673f, 0.589812934f},
-std::array<float,2>{0.774053693f, 0.764111996f},
-std::array<float,2>{0.459320933f, 0.154227749f},
-std::array<float,2>{0.649577379f, 0.260867745f},
-std::array<float,2>{0.15332897f, 0.596390963f},
-std::array<float,2>{0.587513268f, 0.710117042f},
-std::array<float,2>{0.0655234382f, 0.491996944f},
-std::array<float,2>{0.892131507f, 0.0634274632f},
-std::array<float,2>{0.346975952f, 0.890025735f},
-std::array<float,2>{0.970016837f, 0.521851778f},
-std::array<float,2>{0.253820181f, 0.342397422f},
-std::array<float,2>{0.552626252f, 0.232839331f},
-std::array<float,2>{0.00345194363f, 0.820644259f},
-std::array<float,2>{0.743817747f, 0.973352075f},
-std::array<float,2>{0.247419938f, 0.0467586555f},
-std::array<float,2>{0.874909639f, 0.426230043f},
-std::array<float,2>{0.433409125f, 0.646267772f},
-std::array<float,2>{0.925032675f, 0.931711614f},
-std::array<float,2>{0.326639801f, 0.118870236f},
-std::array<float,2>{0.602887511f, 0.442260146f},
-std::array<float,2>{0.110735595f, 0.74199748f},
-std::array<float,2>{0.659925818f, 0.571094215f},
-std::array<float,2>{0.183371961f, 0.29045862f},
-std::array<float,2>{0.787992656f, 0.160452738f},
-std::array<float,2>{0.481809765f, 0.799802423f},
-std::array<float,2>{0.843702734f, 0.6810534f},
-std::array<float,2>{0.398542911f, 0.393278509f},
-std::array<float,2>{0.713265717f, 0.0116530396f},
-std::array<float,2>{0.211134166f, 0.949431598f},
-std::array<float,2>{0.528954089f, 0.85786134f},
-std::array<float,2>{0.031440977f, 0.193621814f},
-std::array<float,2>{0.955730021f, 0.366145402f},
-std::array<float,2>{0.299374044f, 0.54415071f},
-std::array<float,2>{0.899348497f, 0.806382179f},
-std::array<float,2>{0.355390728f, 0.164559364f},
-std::array<float,2>{0.58247143f, 0.28777647f},
-std::array<float,2>{0.070575878f, 0.563221812f},
-std::array<float,2>{0.642417431f, 0.746038854f},
-std::array<float,2>{0.147884175f, 0.448409438f},
-std::array<float,2>{0.772793651f, 0.111336082f},
-std::array<float,2>{0.46565938f, 0.925819159f},
-std::array<float,2>{0.865672827f, 0.533242822f},
-std::array<float,2>{0.428308725f, 0.372061789f},
-std::array<float,2>{0.739416659f, 0.19945468f},
-std::array<float,2>{0.239062831f, 0.847708166f},
-std::array<float,2>{0.55844903f, 0.941560686f},
-std::array<float,2>{0.00917995442f, 0.00603996683f},
-std::array<float,2>{0.982044876f, 0.405539125f},
-std::array<float,2>{0.258299708f, 0.673995972f},
-std::array<float,2>{0.789165854f, 0.875610888f},
-std::array<float,2>{0.474648893f, 0.074677512f},
-std::array<float,2>{0.669830382f, 0.492190838f},
-std::array<float,2>{0.176560789f, 0.712682188f},
-std::array<float,2>{0.599786758f, 0.604862511f},
-std::array<float,2>{0.120908566f, 0.250627041f},
-std::array<float,2>{0.935667217f, 0.141871989f},
-std::array<float,2>{0.316113144f, 0.754298627f},
-std::array<float,2>{0.96675092f, 0.65289104f},
-std::array<float,2>{0.306054145f, 0.433266461f},
-std::array<float,2>{0.517373145f, 0.0337697901f},
-std::array<float,2>{0.0411328636f, 0.983493745f},
-std::array<float,2>{0.708002627f, 0.819361567f},
-std::array<float,2>{0.203989521f, 0.224119261f},
-std::array<float,2>{0.832824469f, 0.333757669f},
-std::array<float,2>{0.391557544f, 0.52462256f},
-std::array<float,2>{0.825938463f, 0.868858278f},
-std::array<float,2>{0.389076352f, 0.209587768f},
-std::array<float,2>{0.692535937f, 0.348596871f},
-std::array<float,2>{0.196322754f, 0.55844599f},
-std::array<float,2>{0.508493364f, 0.661641359f},
-std::array<float,2>{0.0505994894f, 0.384088814f},
-std::array<float,2>{0.947155178f, 0.0210420992f},
-std::array<float,2>{0.287506789f, 0.967361271f},
-std::array<float,2>{0.907232344f, 0.580314279f},
-std::array<float,2>{0.341793001f, 0.31156379f},
-std::array<float,2>{0.615121067f, 0.176737845f},
-std::array<float,2>{0.106765218f, 0.786627352f},
-std::array<float,2>{0.681823194f, 0.908029675f},
-std::array<float,2>{0.156332657f, 0.105073981f},
-std::array<float,2>{0.803177536f, 0.455613822f},
-std::array<float,2>{0.499416679f, 0.729758859f},
-std::array<float,2>{0.997405708f, 0.995063782f},
-std::array<float,2>{0.266031414f, 0.0490100384f},
-std::array<float,2>{0.545017421f, 0.407706439f},
-std::array<float,2>{0.0259239338f, 0.631921768f},
-std::array<float,2>{0.72793287f, 0.511471808f},
-std::array<float,2>{0.230018094f, 0.31692788f},
-std::array<float,2>{0.854183793f, 0.238595888f},
-std::array<float,2>{0.414404184f, 0.841901541f},
-std::array<float,2>{0.75111711f, 0.697161496f},
-std::array<float,2>{0.452816576f, 0.473602295f},
-std::array<float,2>{0.627518237f, 0.0885557458f},
-std::array<float,2>{0.131317973f, 0.896351814f},
-std::array<float,2>{0.574478388f, 0.780834973f},
-std::array<float,2>{0.0869226009f, 0.131458968f},
-std::array<float,2>{0.887381494f, 0.27107814f},
-std::array<float,2>{0.374426216f, 0.617801905f},
-std::array<float,2>{0.962295949f, 0.790721595f},
-std::array<float,2>{0.30877617f, 0.18508476f},
-std::array<float,2>{0.523346543f, 0.303864598f},
-std::array<float,2>{0.0444912054f, 0.593130231f},
-std::array<float,2>{0.704829991f, 0.719675004f},
-std::array<float,2>{0.207888693f, 0.462634414f},
-std::array<float,2>{0.831076086f, 0.0995697826f},
-std::array<float,2>{0.395844311f, 0.919362247f},
-std::array<float,2>{0.793118417f, 0.547740042f},
-std::array<float,2>{0.468964636f, 0.353309363f},
-std::array<float,2>{0.667779446f, 0.211594135f},
-std::array<float,2>{0.175660461f, 0.863784313f},
-std::array<float,2>{0.595003307f, 0.960286677f},
-std::array<float,2>{0.123388566f, 0.0240620337f},
-std::array<float,2>{0.933385134f, 0.382731885f},
-std::array<float,2>{0.317741573f, 0.67160815f},
-std::array<float,2>{0.862814009f, 0.906190872f},
-std::array<float,2>{0.425332606f, 0.0843400806f},
-std::array<float,2>{0.737820446f, 0.478449613f},
-std::array<float,2>{0.235261798f, 0.688200474f},
-std::array<float,2>{0.558958113f, 0.61635077f},
-std::array<float,2>{0.0150150983f, 0.277183205f},
-std::array<float,2>{0.978102624f, 0.132888868f},
-std::array<float,2>{0.263953716f, 0.766131818f},
-std::array<float,2>{0.904646754f, 0.63591522f},
-std::array<float,2>{0.356804729f, 0.421562642f},
-std::array<float,2>{0.578885674f, 0.0571646057f},
-std::array<float,2>{0.0751683488f, 0.985155225f},
-std::array<float,2>{0.648203433f, 0.82838285f},
-std::array<float,2>{0.143117592f, 0.246648252f},
-std::array<float,2>{0.766147316f, 0.322363406f},
-std::array<float,2>{0.463243097f, 0.500651181f},
-std::array<float,2>{0.753995538f, 0.855074108f},
-std::array<float,2>{0.446695477f, 0.1893332f},
-std::array<float,2>{0.632446706f, 0.361164987f},
-std::array<float,2>{0.126989901f, 0.541773677f},
-std::array<float,2>{0.570529878f, 0.685554087f},
-std::array<float,2>{0.0936407447f, 0.395039588f},
-std::array<float,2>{0.885317981f, 0.0117969243f},
-std::array<float,2>{0.370290667f, 0.946132183f},
-std::array<float,2>{0.992776692f, 0.575328171f},
-std::array<float,2>{0.270038038f, 0.293918192f},
-std::array<float,2>{0.542951405f, 0.159507528f},
-std::array<float,2>{0.0285752025f, 0.801110506f},
-std::array<float,2>{0.733607531f, 0.936176717f},
-std::array<float,2>{0.23130849f, 0.123975739f},
-std::array<float,2>{0.857605159f, 0.44131583f},
-std::array<float,2>{0.418941647f, 0.735034883f},
-std::array<float,2>{0.911674738f, 0.969543993f},
-std::array<float,2>{0.338317454f, 0.0405991226f},
-std::array<float,2>{0.610564291f, 0.423552126f},
-std::array<float,2>{0.10357222f, 0.644408226f},
-std::array<float,2>{0.686154246f, 0.518556416f},
-std::array<float,2>{0.163831353f, 0.336955041f},
-std::array<float,2>{0.798984706f, 0.228752911f},
-std::array<float,2>{0.493533611f, 0.824459076f},
-std::array<float,2>{0.822626293f, 0.703435481f},
-std::array<float,2>{0.383782625f, 0.486507177f},
-std::array<float,2>{0.689508736f, 0.0668791682f},
-std::array<float,2>{0.20052363f, 0.886129141f},
-std::array<float,2>{0.514112592f, 0.760092497f},
-std::array<float,2>{0.0514373891f, 0.150318548f},
-std::array<float,2>{0.95142746f, 0.263333976f},
-std::array<float,2>{0.283587158f, 0.599493563f},
-std::array<float,2>{0.875705361f, 0.81603241f},
-std::array<float,2>{0.366256297f, 0.21934551f},
-std::array<float,2>{0.56992358f, 0.331646055f},
-std::array<float,2>{0.0852584168f, 0.528231263f},
-std::array<float,2>{0.638813257f, 0.649970651f},
-std::array<float,2>{0.135241657f, 0.434983164f},
-std::array<float,2>{0.759007156f, 0.037571501f},
-std::array<float,2>{0.439244896f, 0.976793587f},
-std::array<float,2>{0.85129261f, 0.606733203f},
-std::array<float,2>{0.4108105f, 0.254645944f},
-std::array<float,2>{0.725116014f, 0.146673694f},
-std::array<float,2>{0.219869316f, 0.750941396f},
-std::array<float,2>{0.536505759f, 0.88233006f},
-std::array<float,2>{0.023335807f, 0.0738103911f},
-std::array<float,2>{0.991449535f, 0.498414725f},
-std::array<float,2>{0.274917662f, 0.715859294f},
-std::array<float,2>{0.805253685f, 0.939836085f},
-std::array<float,2>{0.484786958f, 0.0013824089f},
-std::array<float,2>{0.675701141f, 0.401000202f},
-std::array<float,2>{0.164928123f, 0.675905049f},
-std::array<float,2>{0.623595297f, 0.537268341f},
-std::array<float,2>{0.0973660499f, 0.369313568f},
-std::array<float,2>{0.91958034f, 0.19823575f},
-std::array<float,2>{0.333022922f, 0.844441414f},
-std::array<float,2>{0.943559289f, 0.748534322f},
-std::array<float,2>{0.290485501f, 0.449254543f},
-std::array<float,2>{0.506216526f, 0.115576401f},
-std::array<float,2>{0.0590665117f, 0.923728228f},
-std::array<float,2>{0.697272062f, 0.808597803f},
-std::array<float,2>{0.194875851f, 0.169593126f},
-std::array<float,2>{0.813942969f, 0.28180474f},
-std::array<float,2>{0.375876844f, 0.568575323f},
-std::array<float,2>{0.839148104f, 0.776152074f},
-std::array<float,2>{0.405943871f, 0.125136539f},
-std::array<float,2>{0.715625048f, 0.26676327f},
-std::array<float,2>{0.216180563f, 0.621132076f},
-std::array<float,2>{0.524036705f, 0.703005195f},
-std::array<float,2>{0.037778087f, 0.470579207f},
-std::array<float,2>{0.959428072f, 0.0923816934f},
-std::array<float,2>{0.301418066f, 0.891004384f},
-std::array<float,2>{0.928149283f, 0.512801647f},
-std::array<float,2>{0.322199613f, 0.315323174f},
-std::array<float,2>{0.608062029f, 0.237253129f},
-std::array<float,2>{0.115933418f, 0.837303162f},
-std::array<float,2>{0.663209319f, 0.999233961f},
-std::array<float,2>{0.184244141f, 0.0532679074f},
-std::array<float,2>{0.781939507f, 0.412205607f},
-std::array<float,2>{0.478151709f, 0.627452135f},
-std::array<float,2>{0.974769533f, 0.911934435f},
-std::array<float,2>{0.256373376f, 0.105697848f},
-std::array<float,2>{0.547420323f, 0.45961082f},
-std::array<float,2>{0.0049583693f, 0.731305659f},
-std::array<float,2>{0.747426987f, 0.585720658f},
-std::array<float,2>{0.245407358f, 0.307953f},
-std::array<float,2>{0.868865669f, 0.175664052f},
-std::array<float,2>{0.436447322f, 0.781653106f},
-std::array<float,2>{0.780022979f, 0.658172071f},
-std::array<float,2>{0.453590691f, 0.38748309f},
-std::array<float,2>{0.655850291f, 0.0172961764f},
-std::array<float,2>{0.15025124f, 0.962911606f},
-std::array<float,2>{0.592958629f, 0.874205649f},
-std::array<float,2>{0.0692230165f, 0.203136414f},
-std::array<float,2>{0.895286858f, 0.344425589f},
-std::array<float,2>{0.350132257f, 0.559300363f},
-std::array<float,2>{0.985175788f, 0.862481058f},
-std::array<float,2>{0.277710736f, 0.215434119f},
-std::array<float,2>{0.535077989f, 0.357616186f},
-std::array<float,2>{0.0174138974f, 0.553690314f},
-std::array<float,2>{0.718854129f, 0.667037964f},
-std::array<float,2>{0.225165978f, 0.375491321f},
-std::array<float,2>{0.845986009f, 0.0285680611f},
-std::array<float,2>{0.409742773f, 0.955257952f},
-std::array<float,2>{0.76524961f, 0.58729136f},
-std::array<float,2>{0.443549782f, 0.300406277f},
-std::array<float,2>{0.634491444f, 0.180548921f},
-std::array<float,2>{0.140614659f, 0.794369638f},
-std::array<float,2>{0.564988494f, 0.915944397f},
-std::array<float,2>{0.0792044029f, 0.0945492238f},
-std::array<float,2>{0.879011512f, 0.464863777f},
-std::array<float,2>{0.362579644f, 0.723453701f},
-std::array<float,2>{0.818106115f, 0.988565683f},
-std::array<float,2>{0.380895883f, 0.0589601696f},
-std::array<float,2>{0.699729443f, 0.417741537f},
-std::array<float,2>{0.190959156f, 0.63792628f},
-std::array<float,2>{0.501846313f, 0.506668448f},
-std::array<float,2>{0.0584122911f, 0.32566613f},
-std::array<float,2>{0.939698994f, 0.242417544f},
-std::array<float,2>{0.293301463f, 0.834787488f},
-std::array<float,2>{0.916216493f, 0.692485571f},
-std::array<float,2>{0.330048203f, 0.48302561f},
-std::array<float,2>{0.620831847f, 0.0813136771f},
-std::array<float,2>{0.0999594182f, 0.89962858f},
-std::array<float,2>{0.6791417f, 0.770360231f},
-std::array<float,2>{0.171392471f, 0.137323663f},
-std::array<float,2>{0.809536576f, 0.279947013f},
-std::array<float,2>{0.491683483f, 0.611171305f},
-std::array<float,2>{0.785318613f, 0.797407925f},
-std::array<float,2>{0.482883632f, 0.163565561f},
-std::array<float,2>{0.656642675f, 0.292593688f},
-std::array<float,2>{0.180868343f, 0.57415247f},
-std::array<float,2>{0.604896128f, 0.739312291f},
-std::array<float,2>{0.113258876f, 0.443874657f},
-std::array<float,2>{0.922495008f, 0.120809324f},
-std::array<float,2>{0.324540108f, 0.930375874f},
-std::array<float,2>{0.954139173f, 0.545876503f},
-std::array<float,2>{0.29714793f, 0.36494866f},
-std::array<float,2>{0.530201316f, 0.192949533f},
-std::array<float,2>{0.0336188748f, 0.855541945f},
-std::array<float,2>{0.712456286f, 0.951278031f},
-std::array<float,2>{0.214451924f, 0.00952619966f},
-std::array<float,2>{0.840494096f, 0.390724808f},
-std::array<float,2>{0.400853068f, 0.68220365f},
-std::array<float,2>{0.892629802f, 0.887954235f},
-std::array<float,2>{0.344788849f, 0.0654371604f},
-std::array<float,2>{0.589143097f, 0.488949448f},
-std::array<float,2>{0.064139396f, 0.708104551f},
-std::array<float,2>{0.651779771f, 0.594206154f},
-std::array<float,2>{0.154583916f, 0.259440452f},
-std::array<float,2>{0.776994884f, 0.155654237f},
-std::array<float,2>{0.457321107f, 0.763416946f},
-std::array<float,2>{0.871245801f, 0.647637188f},
-std::array<float,2>{0.431391358f, 0.429342717f},
-std::array<float,2>{0.745950282f, 0.0444152616f},
-std::array<float,2>{0.24840878f, 0.97574228f},
-std::array<float,2>{0.553429782f, 0.823484898f},
-std::array<float,2>{0.00099455344f, 0.232021123f},
-std::array<float,2>{0.972571492f, 0.340551406f},
-std::array<float,2>{0.251492471f, 0.521401882f},
-std::array<float,2>{0.933810711f, 0.757165611f},
-std::array<float,2>{0.313260764f, 0.142646849f},
-std::array<float,2>{0.597923517f, 0.252905518f},
-std::array<float,2>{0.119138524f, 0.602743566f},
-std::array<float,2>{0.671087205f, 0.713755846f},
-std::array<float,2>{0.177786678f, 0.494477481f},
-std::array<float,2>{0.79114145f, 0.0773591027f},
-std::array<float,2>{0.474269688f, 0.878243208f},
-std::array<float,2>{0.835158169f, 0.526689827f},
-std::array<float,2>{0.394352436f, 0.335367858f},
-std::array<float,2>{0.710300028f, 0.225449726f},
-std::array<float,2>{0.206062376f, 0.817154288f},
-std::array<float,2>{0.518647909f, 0.980527937f},
-std::array<float,2>{0.0394274406f, 0.0329807252f},
-std::array<float,2>{0.967138231f, 0.431107432f},
-std::array<float,2>{0.307472885f, 0.655626595f},
-std::array<float,2>{0.771272182f, 0.927945435f},
-std::array<float,2>{0.468510956f, 0.110974029f},
-std::array<float,2>{0.643711746f, 0.44699508f},
-std::array<float,2>{0.144831762f, 0.743112624f},
-std::array<float,2>{0.584170043f, 0.56466794f},
-std::array<float,2>{0.0733520538f, 0.286318272f},
-std::array<float,2>{0.901617467f, 0.166403249f},
-std::array<float,2>{0.35261175f, 0.806664288f},
-std::array<float,2>{0.98273021f, 0.671915293f},
-std::array<float,2>{0.260870129f, 0.404236078f},
-std::array<float,2>{0.555658102f, 0.00492554205f},
-std::array<float,2>{0.0101534445f, 0.944546819f},
-std::array<float,2>{0.741623998f, 0.849798322f},
-std::array<float,2>{0.240932867f, 0.202062592f},
-std::array<float,2>{0.863323748f, 0.373679489f},
-std::array<float,2>{0.427389205f, 0.531839907f},
-std::array<float,2>{0.853234947f, 0.840673864f},
-std::array<float,2>{0.417045653f, 0.240280166f},
-std::array<float,2>{0.730202913f, 0.320144892f},
-std::array<float,2>{0.228118256f, 0.508134484f},
-std::array<float,2>{0.543434262f, 0.630084991f},
-std::array<float,2>{0.0237557702f, 0.409277886f},
-std::array<float,2>{0.998632193f, 0.0479617789f},
-std::array<float,2>{0.267673135f, 0.992246032f},
-std::array<float,2>{0.890554905f, 0.620707512f},
-std::array<float,2>{0.371344507f, 0.272036344f},
-std::array<float,2>{0.577605247f, 0.129641354f},
-std::array<float,2>{0.0893509462f, 0.778994799f},
-std::array<float,2>{0.625089049f, 0.897635102f},
-std::array<float,2>{0.130322412f, 0.0872987211f},
-std::array<float,2>{0.752178669f, 0.47592783f},
-std::array<float,2>{0.45042944f, 0.697552502f},
-std::array<float,2>{0.947368443f, 0.965832174f},
-std::array<float,2>{0.286886483f, 0.0232762173f},
-std::array<float,2>{0.510564983f, 0.385311574f},
-std::array<float,2>{0.0478170477f, 0.662836552f},
-std::array<float,2>{0.694279671f, 0.555433869f},
-std::array<float,2>{0.19854252f, 0.351418257f},
-std::array<float,2>{0.826489687f, 0.207056597f},
-std::array<float,2>{0.387865216f, 0.869555891f},
-std::array<float,2>{0.802704811f, 0.726765871f},
-std::array<float,2>{0.497685224f, 0.454231322f},
-std::array<float,2>{0.680516005f, 0.103309624f},
-std::array<float,2>{0.159917966f, 0.909599602f},
-std::array<float,2>{0.61718297f, 0.787971914f},
-std::array<float,2>{0.108904891f, 0.178633079f},
-std::array<float,2>{0.908441663f, 0.308925867f},
-std::array<float,2>{0.342528254f, 0.579020202f}}
\ No newline at end of file
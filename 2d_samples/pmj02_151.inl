@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0290437397f, 0.465076953f},
-std::array<float,2>{0.778652966f, 0.853440821f},
-std::array<float,2>{0.387490839f, 0.730499685f},
-std::array<float,2>{0.547092378f, 0.234466106f},
-std::array<float,2>{0.259378999f, 0.0213985704f},
-std::array<float,2>{0.70428884f, 0.50606966f},
-std::array<float,2>{0.172600523f, 0.973948479f},
-std::array<float,2>{0.985346198f, 0.366815746f},
-std::array<float,2>{0.21357359f, 0.135359734f},
-std::array<float,2>{0.928380251f, 0.684254766f},
-std::array<float,2>{0.326046318f, 0.786882281f},
-std::array<float,2>{0.640710235f, 0.414241463f},
-std::array<float,2>{0.477997839f, 0.305898517f},
-std::array<float,2>{0.575004756f, 0.913134336f},
-std::array<float,2>{0.0694702938f, 0.597002983f},
-std::array<float,2>{0.874076486f, 0.113528579f},
-std::array<float,2>{0.152352959f, 0.316700071f},
-std::array<float,2>{0.952569067f, 0.944591522f},
-std::array<float,2>{0.28927353f, 0.54271847f},
-std::array<float,2>{0.723701894f, 0.058787249f},
-std::array<float,2>{0.421316117f, 0.215148926f},
-std::array<float,2>{0.504512012f, 0.717495382f},
-std::array<float,2>{0.0485650487f, 0.822201014f},
-std::array<float,2>{0.810034096f, 0.481756032f},
-std::array<float,2>{0.0997831151f, 0.0929025486f},
-std::array<float,2>{0.821635067f, 0.569960356f},
-std::array<float,2>{0.458992451f, 0.892179549f},
-std::array<float,2>{0.600930691f, 0.262599528f},
-std::array<float,2>{0.365679711f, 0.393382251f},
-std::array<float,2>{0.666589916f, 0.754024923f},
-std::array<float,2>{0.221767306f, 0.633796513f},
-std::array<float,2>{0.877735972f, 0.1600409f},
-std::array<float,2>{0.249723569f, 0.43131724f},
-std::array<float,2>{0.905431151f, 0.810706437f},
-std::array<float,2>{0.357695639f, 0.65644002f},
-std::array<float,2>{0.685272932f, 0.144859537f},
-std::array<float,2>{0.450600386f, 0.0955428332f},
-std::array<float,2>{0.624256372f, 0.616428435f},
-std::array<float,2>{0.109625719f, 0.936651707f},
-std::array<float,2>{0.841737032f, 0.285649866f},
-std::array<float,2>{0.0370668359f, 0.220055729f},
-std::array<float,2>{0.782278001f, 0.748963416f},
-std::array<float,2>{0.435419858f, 0.870111346f},
-std::array<float,2>{0.527676642f, 0.447956532f},
-std::array<float,2>{0.307422906f, 0.350151211f},
-std::array<float,2>{0.742301583f, 0.988693595f},
-std::array<float,2>{0.138633579f, 0.526582539f},
-std::array<float,2>{0.956532598f, 0.0079540778f},
-std::array<float,2>{0.0884785354f, 0.270693094f},
-std::array<float,2>{0.847282827f, 0.884601474f},
-std::array<float,2>{0.498565882f, 0.591063619f},
-std::array<float,2>{0.581483543f, 0.0633436516f},
-std::array<float,2>{0.340970904f, 0.174206778f},
-std::array<float,2>{0.632299364f, 0.644273818f},
-std::array<float,2>{0.191505939f, 0.771696925f},
-std::array<float,2>{0.913913429f, 0.375678778f},
-std::array<float,2>{0.165438265f, 0.0384635814f},
-std::array<float,2>{0.97903955f, 0.54818058f},
-std::array<float,2>{0.276801258f, 0.961019933f},
-std::array<float,2>{0.693197131f, 0.332086235f},
-std::array<float,2>{0.402795762f, 0.489095807f},
-std::array<float,2>{0.537294149f, 0.835470438f},
-std::array<float,2>{0.00135013228f, 0.693491876f},
-std::array<float,2>{0.756758928f, 0.191668466f},
-std::array<float,2>{0.12086682f, 0.386598229f},
-std::array<float,2>{0.831005037f, 0.774447739f},
-std::array<float,2>{0.440064311f, 0.650242031f},
-std::array<float,2>{0.611899137f, 0.186708778f},
-std::array<float,2>{0.34429127f, 0.0778564885f},
-std::array<float,2>{0.677001297f, 0.582632542f},
-std::array<float,2>{0.241309747f, 0.882076621f},
-std::array<float,2>{0.89249903f, 0.277235538f},
-std::array<float,2>{0.127459586f, 0.197936416f},
-std::array<float,2>{0.965011299f, 0.702570438f},
-std::array<float,2>{0.298128903f, 0.836620748f},
-std::array<float,2>{0.739316523f, 0.496276885f},
-std::array<float,2>{0.425689071f, 0.335953534f},
-std::array<float,2>{0.516052842f, 0.954316378f},
-std::array<float,2>{0.0433266722f, 0.555167556f},
-std::array<float,2>{0.79424268f, 0.0408765078f},
-std::array<float,2>{0.196460456f, 0.290764362f},
-std::array<float,2>{0.920316994f, 0.927426875f},
-std::array<float,2>{0.330257684f, 0.620374978f},
-std::array<float,2>{0.640024424f, 0.108639777f},
-std::array<float,2>{0.488323569f, 0.154247433f},
-std::array<float,2>{0.592516124f, 0.66647625f},
-std::array<float,2>{0.0788896307f, 0.803346515f},
-std::array<float,2>{0.854825974f, 0.424409062f},
-std::array<float,2>{0.0143289864f, 0.00309679494f},
-std::array<float,2>{0.76333034f, 0.521965623f},
-std::array<float,2>{0.392326027f, 0.99397248f},
-std::array<float,2>{0.541916549f, 0.358313084f},
-std::array<float,2>{0.2709575f, 0.43851161f},
-std::array<float,2>{0.696241558f, 0.865687072f},
-std::array<float,2>{0.158483073f, 0.735246837f},
-std::array<float,2>{0.96880579f, 0.233960569f},
-std::array<float,2>{0.181240514f, 0.474317759f},
-std::array<float,2>{0.996507823f, 0.817527175f},
-std::array<float,2>{0.253113121f, 0.705801904f},
-std::array<float,2>{0.716509879f, 0.205665737f},
-std::array<float,2>{0.378990948f, 0.0498809405f},
-std::array<float,2>{0.557229936f, 0.533105969f},
-std::array<float,2>{0.0215414036f, 0.948728979f},
-std::array<float,2>{0.771970332f, 0.325465411f},
-std::array<float,2>{0.0773972347f, 0.168179244f},
-std::array<float,2>{0.862725854f, 0.631128013f},
-std::array<float,2>{0.475472301f, 0.760453224f},
-std::array<float,2>{0.568832517f, 0.400186658f},
-std::array<float,2>{0.315978765f, 0.252745539f},
-std::array<float,2>{0.654452562f, 0.904073715f},
-std::array<float,2>{0.204849526f, 0.574753046f},
-std::array<float,2>{0.930157125f, 0.0797549635f},
-std::array<float,2>{0.0564106405f, 0.371454477f},
-std::array<float,2>{0.799004793f, 0.978506565f},
-std::array<float,2>{0.412998676f, 0.508574486f},
-std::array<float,2>{0.515182853f, 0.0258354507f},
-std::array<float,2>{0.28365612f, 0.243009582f},
-std::array<float,2>{0.730437696f, 0.72019124f},
-std::array<float,2>{0.148154587f, 0.845892906f},
-std::array<float,2>{0.941375077f, 0.458714396f},
-std::array<float,2>{0.229982883f, 0.118229605f},
-std::array<float,2>{0.885900974f, 0.60205096f},
-std::array<float,2>{0.370146573f, 0.914628386f},
-std::array<float,2>{0.659368753f, 0.298436701f},
-std::array<float,2>{0.467502445f, 0.409623265f},
-std::array<float,2>{0.604230881f, 0.792385638f},
-std::array<float,2>{0.105095245f, 0.674307168f},
-std::array<float,2>{0.813013017f, 0.126793325f},
-std::array<float,2>{0.0429678485f, 0.421679169f},
-std::array<float,2>{0.791464806f, 0.783949733f},
-std::array<float,2>{0.427140266f, 0.680209994f},
-std::array<float,2>{0.519599855f, 0.136949986f},
-std::array<float,2>{0.302799791f, 0.111064926f},
-std::array<float,2>{0.737024605f, 0.598748744f},
-std::array<float,2>{0.130049959f, 0.907858908f},
-std::array<float,2>{0.963036001f, 0.309383631f},
-std::array<float,2>{0.236613274f, 0.238422319f},
-std::array<float,2>{0.897234619f, 0.727317154f},
-std::array<float,2>{0.348424852f, 0.855834305f},
-std::array<float,2>{0.673703909f, 0.463242263f},
-std::array<float,2>{0.441640019f, 0.36095348f},
-std::array<float,2>{0.616915166f, 0.970714748f},
-std::array<float,2>{0.124589235f, 0.503116965f},
-std::array<float,2>{0.832643151f, 0.017173769f},
-std::array<float,2>{0.163141549f, 0.259429365f},
-std::array<float,2>{0.975225031f, 0.895773768f},
-std::array<float,2>{0.267906249f, 0.56525737f},
-std::array<float,2>{0.699676156f, 0.0869971365f},
-std::array<float,2>{0.395672888f, 0.162602335f},
-std::array<float,2>{0.544586658f, 0.639228046f},
-std::array<float,2>{0.0114416154f, 0.753664792f},
-std::array<float,2>{0.758660495f, 0.398109436f},
-std::array<float,2>{0.0846816227f, 0.0581968985f},
-std::array<float,2>{0.856770694f, 0.543133557f},
-std::array<float,2>{0.487161785f, 0.940760016f},
-std::array<float,2>{0.586592913f, 0.314198762f},
-std::array<float,2>{0.335074753f, 0.478825331f},
-std::array<float,2>{0.634475708f, 0.825401664f},
-std::array<float,2>{0.202439517f, 0.711161792f},
-std::array<float,2>{0.9163028f, 0.212852508f},
-std::array<float,2>{0.21075353f, 0.452630728f},
-std::array<float,2>{0.934825003f, 0.873205841f},
-std::array<float,2>{0.318597972f, 0.745541155f},
-std::array<float,2>{0.649682105f, 0.223450065f},
-std::array<float,2>{0.472046107f, 0.015318579f},
-std::array<float,2>{0.564517558f, 0.531006217f},
-std::array<float,2>{0.0726554692f, 0.986941457f},
-std::array<float,2>{0.864349842f, 0.346153915f},
-std::array<float,2>{0.0184658188f, 0.143135294f},
-std::array<float,2>{0.768600821f, 0.661647081f},
-std::array<float,2>{0.376542479f, 0.805962205f},
-std::array<float,2>{0.560852528f, 0.434517831f},
-std::array<float,2>{0.255369306f, 0.284041673f},
-std::array<float,2>{0.711940646f, 0.929848731f},
-std::array<float,2>{0.183753043f, 0.612130523f},
-std::array<float,2>{0.992299974f, 0.100855082f},
-std::array<float,2>{0.10675519f, 0.330361813f},
-std::array<float,2>{0.817134321f, 0.967446327f},
-std::array<float,2>{0.463744789f, 0.551064432f},
-std::array<float,2>{0.606952071f, 0.0334555879f},
-std::array<float,2>{0.373491764f, 0.191102371f},
-std::array<float,2>{0.662436485f, 0.690672934f},
-std::array<float,2>{0.232654065f, 0.831497729f},
-std::array<float,2>{0.887462854f, 0.485682517f},
-std::array<float,2>{0.144026443f, 0.067109853f},
-std::array<float,2>{0.945098221f, 0.587038398f},
-std::array<float,2>{0.286338747f, 0.887098968f},
-std::array<float,2>{0.733349979f, 0.267385334f},
-std::array<float,2>{0.409001142f, 0.382662386f},
-std::array<float,2>{0.508295834f, 0.76608187f},
-std::array<float,2>{0.0610801391f, 0.644542158f},
-std::array<float,2>{0.802813292f, 0.178831726f},
-std::array<float,2>{0.0663774386f, 0.495653987f},
-std::array<float,2>{0.870842814f, 0.843600571f},
-std::array<float,2>{0.481119365f, 0.696126223f},
-std::array<float,2>{0.573974609f, 0.199503735f},
-std::array<float,2>{0.320658416f, 0.0464428551f},
-std::array<float,2>{0.647505343f, 0.560722589f},
-std::array<float,2>{0.21503897f, 0.960907221f},
-std::array<float,2>{0.922905028f, 0.343664855f},
-std::array<float,2>{0.179525509f, 0.181187943f},
-std::array<float,2>{0.989586651f, 0.655449927f},
-std::array<float,2>{0.264896572f, 0.778833568f},
-std::array<float,2>{0.708711982f, 0.389060974f},
-std::array<float,2>{0.385971457f, 0.279671133f},
-std::array<float,2>{0.552888036f, 0.877532601f},
-std::array<float,2>{0.0238993149f, 0.57975632f},
-std::array<float,2>{0.775831223f, 0.0728291944f},
-std::array<float,2>{0.226374045f, 0.354669839f},
-std::array<float,2>{0.881591737f, 0.999226451f},
-std::array<float,2>{0.359867603f, 0.517855108f},
-std::array<float,2>{0.67011416f, 0.00706132175f},
-std::array<float,2>{0.456007391f, 0.228346542f},
-std::array<float,2>{0.595849931f, 0.738833964f},
-std::array<float,2>{0.0947352573f, 0.862481833f},
-std::array<float,2>{0.824342489f, 0.443202347f},
-std::array<float,2>{0.0546714589f, 0.10339842f},
-std::array<float,2>{0.805553377f, 0.624912143f},
-std::array<float,2>{0.416981995f, 0.924433231f},
-std::array<float,2>{0.500652015f, 0.295951873f},
-std::array<float,2>{0.293840259f, 0.426775813f},
-std::array<float,2>{0.719647527f, 0.797474921f},
-std::array<float,2>{0.151261508f, 0.67082876f},
-std::array<float,2>{0.946970761f, 0.151244134f},
-std::array<float,2>{0.136031568f, 0.405865729f},
-std::array<float,2>{0.960236192f, 0.763470113f},
-std::array<float,2>{0.311080098f, 0.627121508f},
-std::array<float,2>{0.746803343f, 0.166895747f},
-std::array<float,2>{0.432446212f, 0.0832599923f},
-std::array<float,2>{0.525096059f, 0.571632147f},
-std::array<float,2>{0.0339567997f, 0.901097834f},
-std::array<float,2>{0.788591683f, 0.254300237f},
-std::array<float,2>{0.113990113f, 0.210139006f},
-std::array<float,2>{0.839565158f, 0.707899272f},
-std::array<float,2>{0.447462469f, 0.815790117f},
-std::array<float,2>{0.617494464f, 0.472468585f},
-std::array<float,2>{0.354862005f, 0.321357787f},
-std::array<float,2>{0.68305707f, 0.951656342f},
-std::array<float,2>{0.245153472f, 0.536925614f},
-std::array<float,2>{0.901569963f, 0.0534725562f},
-std::array<float,2>{0.00753917405f, 0.303683668f},
-std::array<float,2>{0.750010371f, 0.919785738f},
-std::array<float,2>{0.399628222f, 0.606663406f},
-std::array<float,2>{0.534622431f, 0.123209774f},
-std::array<float,2>{0.27775982f, 0.129101351f},
-std::array<float,2>{0.687639058f, 0.677260458f},
-std::array<float,2>{0.168808654f, 0.79685837f},
-std::array<float,2>{0.982792735f, 0.412725776f},
-std::array<float,2>{0.189643905f, 0.0301535707f},
-std::array<float,2>{0.908258319f, 0.51356703f},
-std::array<float,2>{0.337266713f, 0.981543899f},
-std::array<float,2>{0.627773702f, 0.368367314f},
-std::array<float,2>{0.495980203f, 0.45488432f},
-std::array<float,2>{0.584346235f, 0.848288536f},
-std::array<float,2>{0.0927779675f, 0.726228654f},
-std::array<float,2>{0.851507068f, 0.248831078f},
-std::array<float,2>{0.0497050546f, 0.483231872f},
-std::array<float,2>{0.810961843f, 0.823050082f},
-std::array<float,2>{0.418714195f, 0.715229273f},
-std::array<float,2>{0.506494522f, 0.217910931f},
-std::array<float,2>{0.291520596f, 0.0606806651f},
-std::array<float,2>{0.725931764f, 0.539574206f},
-std::array<float,2>{0.1546572f, 0.942185819f},
-std::array<float,2>{0.950836658f, 0.318589002f},
-std::array<float,2>{0.219913229f, 0.157828316f},
-std::array<float,2>{0.875341833f, 0.635917485f},
-std::array<float,2>{0.363559574f, 0.756234288f},
-std::array<float,2>{0.665061057f, 0.391017973f},
-std::array<float,2>{0.458414912f, 0.264683127f},
-std::array<float,2>{0.599601686f, 0.893990397f},
-std::array<float,2>{0.0990688428f, 0.567361772f},
-std::array<float,2>{0.823482633f, 0.0904613882f},
-std::array<float,2>{0.175734222f, 0.36501646f},
-std::array<float,2>{0.987623155f, 0.976023972f},
-std::array<float,2>{0.260226369f, 0.505523145f},
-std::array<float,2>{0.706761837f, 0.0225902554f},
-std::array<float,2>{0.389837921f, 0.237759635f},
-std::array<float,2>{0.549990654f, 0.73245728f},
-std::array<float,2>{0.0311655905f, 0.855345666f},
-std::array<float,2>{0.780614495f, 0.468728095f},
-std::array<float,2>{0.0672448128f, 0.115263253f},
-std::array<float,2>{0.872699022f, 0.594307721f},
-std::array<float,2>{0.478949368f, 0.910797834f},
-std::array<float,2>{0.577727377f, 0.308524966f},
-std::array<float,2>{0.327846557f, 0.417376101f},
-std::array<float,2>{0.643434405f, 0.787284255f},
-std::array<float,2>{0.211633012f, 0.685742915f},
-std::array<float,2>{0.927415371f, 0.134504512f},
-std::array<float,2>{0.194092885f, 0.378341824f},
-std::array<float,2>{0.911027372f, 0.771111548f},
-std::array<float,2>{0.34278366f, 0.640688896f},
-std::array<float,2>{0.629248202f, 0.17364791f},
-std::array<float,2>{0.497408807f, 0.0663728788f},
-std::array<float,2>{0.579241753f, 0.592274189f},
-std::array<float,2>{0.0872177035f, 0.885338962f},
-std::array<float,2>{0.844733894f, 0.272456735f},
-std::array<float,2>{0.00347333495f, 0.193904489f},
-std::array<float,2>{0.755357683f, 0.693272233f},
-std::array<float,2>{0.405296385f, 0.832613051f},
-std::array<float,2>{0.535319984f, 0.491755158f},
-std::array<float,2>{0.27478835f, 0.334607929f},
-std::array<float,2>{0.694772482f, 0.964442134f},
-std::array<float,2>{0.166092485f, 0.550322533f},
-std::array<float,2>{0.977591693f, 0.0352636464f},
-std::array<float,2>{0.112990454f, 0.288266569f},
-std::array<float,2>{0.842424214f, 0.935237467f},
-std::array<float,2>{0.45308435f, 0.614601612f},
-std::array<float,2>{0.621517479f, 0.0973300338f},
-std::array<float,2>{0.357226044f, 0.14751114f},
-std::array<float,2>{0.686822832f, 0.659415245f},
-std::array<float,2>{0.247196198f, 0.8086043f},
-std::array<float,2>{0.903887272f, 0.432720602f},
-std::array<float,2>{0.140077412f, 0.0109893121f},
-std::array<float,2>{0.954218924f, 0.524515152f},
-std::array<float,2>{0.305824608f, 0.990401506f},
-std::array<float,2>{0.745485008f, 0.349555254f},
-std::array<float,2>{0.436495006f, 0.446183741f},
-std::array<float,2>{0.530537546f, 0.867773592f},
-std::array<float,2>{0.0386704989f, 0.746622205f},
-std::array<float,2>{0.78350997f, 0.221662253f},
-std::array<float,2>{0.0802702382f, 0.423146814f},
-std::array<float,2>{0.852998137f, 0.801602662f},
-std::array<float,2>{0.490531385f, 0.665055394f},
-std::array<float,2>{0.590467095f, 0.154668629f},
-std::array<float,2>{0.328423679f, 0.10599643f},
-std::array<float,2>{0.638539493f, 0.619041502f},
-std::array<float,2>{0.198391259f, 0.929509282f},
-std::array<float,2>{0.919688582f, 0.291353136f},
-std::array<float,2>{0.157881856f, 0.232218057f},
-std::array<float,2>{0.972617209f, 0.737621844f},
-std::array<float,2>{0.27319178f, 0.863976359f},
-std::array<float,2>{0.699075997f, 0.44138813f},
-std::array<float,2>{0.393101037f, 0.356301129f},
-std::array<float,2>{0.539481521f, 0.995039999f},
-std::array<float,2>{0.0124971494f, 0.519643247f},
-std::array<float,2>{0.764565587f, 0.000811324921f},
-std::array<float,2>{0.238479182f, 0.274727315f},
-std::array<float,2>{0.893034041f, 0.879715204f},
-std::array<float,2>{0.346134156f, 0.58423686f},
-std::array<float,2>{0.679663122f, 0.0760058984f},
-std::array<float,2>{0.43888697f, 0.185534164f},
-std::array<float,2>{0.61023128f, 0.651124239f},
-std::array<float,2>{0.117704108f, 0.776576877f},
-std::array<float,2>{0.828166664f, 0.383328766f},
-std::array<float,2>{0.0456204712f, 0.0415536612f},
-std::array<float,2>{0.795899928f, 0.558441341f},
-std::array<float,2>{0.422236711f, 0.956945598f},
-std::array<float,2>{0.518699467f, 0.338947147f},
-std::array<float,2>{0.300592005f, 0.499923021f},
-std::array<float,2>{0.741730511f, 0.838237643f},
-std::array<float,2>{0.125776619f, 0.700482786f},
-std::array<float,2>{0.966949105f, 0.196663931f},
-std::array<float,2>{0.146178886f, 0.459300011f},
-std::array<float,2>{0.937712789f, 0.844464421f},
-std::array<float,2>{0.282020241f, 0.72252208f},
-std::array<float,2>{0.728255808f, 0.244229615f},
-std::array<float,2>{0.410597473f, 0.024546735f},
-std::array<float,2>{0.513451397f, 0.510543048f},
-std::array<float,2>{0.0575473607f, 0.978621006f},
-std::array<float,2>{0.798423648f, 0.373807937f},
-std::array<float,2>{0.102800183f, 0.128396228f},
-std::array<float,2>{0.815184534f, 0.673104584f},
-std::array<float,2>{0.46670416f, 0.790565848f},
-std::array<float,2>{0.603104532f, 0.407204509f},
-std::array<float,2>{0.367612094f, 0.300453454f},
-std::array<float,2>{0.657165051f, 0.916637957f},
-std::array<float,2>{0.227422729f, 0.603637636f},
-std::array<float,2>{0.88295418f, 0.120236009f},
-std::array<float,2>{0.0213632938f, 0.327640772f},
-std::array<float,2>{0.770705104f, 0.947250962f},
-std::array<float,2>{0.382649988f, 0.533493221f},
-std::array<float,2>{0.556540191f, 0.0480747819f},
-std::array<float,2>{0.250821143f, 0.203184649f},
-std::array<float,2>{0.71698904f, 0.703728914f},
-std::array<float,2>{0.183184505f, 0.82029736f},
-std::array<float,2>{0.998915374f, 0.475898325f},
-std::array<float,2>{0.206277132f, 0.0804525912f},
-std::array<float,2>{0.933137536f, 0.577599883f},
-std::array<float,2>{0.314262182f, 0.90449971f},
-std::array<float,2>{0.652955115f, 0.250114411f},
-std::array<float,2>{0.473685533f, 0.400682181f},
-std::array<float,2>{0.567023933f, 0.758204579f},
-std::array<float,2>{0.074475579f, 0.630297065f},
-std::array<float,2>{0.859494567f, 0.170604736f},
-std::array<float,2>{0.00855186954f, 0.395339519f},
-std::array<float,2>{0.760891378f, 0.751073122f},
-std::array<float,2>{0.397238404f, 0.638157606f},
-std::array<float,2>{0.546592653f, 0.161549434f},
-std::array<float,2>{0.266013891f, 0.0890908539f},
-std::array<float,2>{0.701382816f, 0.562826216f},
-std::array<float,2>{0.160304263f, 0.89821595f},
-std::array<float,2>{0.97290951f, 0.260406554f},
-std::array<float,2>{0.200755f, 0.214282259f},
-std::array<float,2>{0.915565372f, 0.714688003f},
-std::array<float,2>{0.332828492f, 0.826394856f},
-std::array<float,2>{0.635905564f, 0.477278858f},
-std::array<float,2>{0.484843343f, 0.315822363f},
-std::array<float,2>{0.588483334f, 0.937806785f},
-std::array<float,2>{0.0828718022f, 0.546036065f},
-std::array<float,2>{0.858048379f, 0.0554656684f},
-std::array<float,2>{0.130901679f, 0.310586989f},
-std::array<float,2>{0.962280989f, 0.908512354f},
-std::array<float,2>{0.301836461f, 0.600034118f},
-std::array<float,2>{0.735409617f, 0.112166733f},
-std::array<float,2>{0.429278731f, 0.138723686f},
-std::array<float,2>{0.523056626f, 0.681645572f},
-std::array<float,2>{0.0397124067f, 0.783071935f},
-std::array<float,2>{0.790616453f, 0.419553787f},
-std::array<float,2>{0.122237414f, 0.0180272926f},
-std::array<float,2>{0.835059047f, 0.501098037f},
-std::array<float,2>{0.445076197f, 0.96908164f},
-std::array<float,2>{0.613645375f, 0.361745238f},
-std::array<float,2>{0.349949002f, 0.46161288f},
-std::array<float,2>{0.67471844f, 0.85775727f},
-std::array<float,2>{0.234433934f, 0.729968309f},
-std::array<float,2>{0.895839989f, 0.241430819f},
-std::array<float,2>{0.231380194f, 0.487732172f},
-std::array<float,2>{0.889824927f, 0.829254389f},
-std::array<float,2>{0.371756047f, 0.687889993f},
-std::array<float,2>{0.661602378f, 0.188179269f},
-std::array<float,2>{0.461233765f, 0.0322320387f},
-std::array<float,2>{0.608070016f, 0.554113567f},
-std::array<float,2>{0.10807322f, 0.966212273f},
-std::array<float,2>{0.819320381f, 0.328495771f},
-std::array<float,2>{0.0604307353f, 0.176982418f},
-std::array<float,2>{0.802701592f, 0.647846222f},
-std::array<float,2>{0.406791419f, 0.768958271f},
-std::array<float,2>{0.510773361f, 0.380029798f},
-std::array<float,2>{0.287763953f, 0.267909467f},
-std::array<float,2>{0.731311738f, 0.889238536f},
-std::array<float,2>{0.141676739f, 0.588709712f},
-std::array<float,2>{0.942615926f, 0.0701138601f},
-std::array<float,2>{0.0704031438f, 0.34378472f},
-std::array<float,2>{0.867007971f, 0.985621393f},
-std::array<float,2>{0.468822092f, 0.528819323f},
-std::array<float,2>{0.563099682f, 0.0133217704f},
-std::array<float,2>{0.316553742f, 0.224994302f},
-std::array<float,2>{0.651952446f, 0.743340015f},
-std::array<float,2>{0.207629859f, 0.871903956f},
-std::array<float,2>{0.936913788f, 0.45098424f},
-std::array<float,2>{0.186778799f, 0.0986588001f},
-std::array<float,2>{0.994692922f, 0.610126615f},
-std::array<float,2>{0.25605768f, 0.932824492f},
-std::array<float,2>{0.7139588f, 0.283168703f},
-std::array<float,2>{0.37876907f, 0.436603814f},
-std::array<float,2>{0.559231758f, 0.807728708f},
-std::array<float,2>{0.0172193665f, 0.663027227f},
-std::array<float,2>{0.765752316f, 0.141320482f},
-std::array<float,2>{0.0973133892f, 0.443405688f},
-std::array<float,2>{0.828087091f, 0.859817266f},
-std::array<float,2>{0.453897804f, 0.741554379f},
-std::array<float,2>{0.594682395f, 0.22884953f},
-std::array<float,2>{0.362338573f, 0.00579733727f},
-std::array<float,2>{0.668103635f, 0.516811609f},
-std::array<float,2>{0.223703727f, 0.997782052f},
-std::array<float,2>{0.879068375f, 0.352021754f},
-std::array<float,2>{0.149348363f, 0.149128124f},
-std::array<float,2>{0.949146271f, 0.669611156f},
-std::array<float,2>{0.295340061f, 0.800237417f},
-std::array<float,2>{0.722005069f, 0.428138524f},
-std::array<float,2>{0.415672332f, 0.294555902f},
-std::array<float,2>{0.503610611f, 0.922803819f},
-std::array<float,2>{0.0517128333f, 0.622023642f},
-std::array<float,2>{0.80763483f, 0.105380878f},
-std::array<float,2>{0.217398986f, 0.34132576f},
-std::array<float,2>{0.924728096f, 0.957574964f},
-std::array<float,2>{0.323393971f, 0.559038997f},
-std::array<float,2>{0.644886672f, 0.043164257f},
-std::array<float,2>{0.48270008f, 0.202174246f},
-std::array<float,2>{0.571302235f, 0.698534608f},
-std::array<float,2>{0.0632602498f, 0.841774583f},
-std::array<float,2>{0.868482232f, 0.493756711f},
-std::array<float,2>{0.0267976243f, 0.0717512667f},
-std::array<float,2>{0.775310755f, 0.580760598f},
-std::array<float,2>{0.383367002f, 0.875901282f},
-std::array<float,2>{0.551721692f, 0.277857214f},
-std::array<float,2>{0.261889338f, 0.388051867f},
-std::array<float,2>{0.709905446f, 0.77978009f},
-std::array<float,2>{0.17636542f, 0.653095961f},
-std::array<float,2>{0.992118299f, 0.182978243f},
-std::array<float,2>{0.171855763f, 0.411898762f},
-std::array<float,2>{0.981680691f, 0.793017328f},
-std::array<float,2>{0.279486567f, 0.67851913f},
-std::array<float,2>{0.690331042f, 0.131862462f},
-std::array<float,2>{0.402195841f, 0.121469274f},
-std::array<float,2>{0.532356501f, 0.609369755f},
-std::array<float,2>{0.00518985139f, 0.921331346f},
-std::array<float,2>{0.752959251f, 0.302546054f},
-std::array<float,2>{0.0909003839f, 0.247476771f},
-std::array<float,2>{0.847842097f, 0.723712564f},
-std::array<float,2>{0.492745906f, 0.851420581f},
-std::array<float,2>{0.582153916f, 0.456500769f},
-std::array<float,2>{0.338959992f, 0.369612157f},
-std::array<float,2>{0.625431418f, 0.984029949f},
-std::array<float,2>{0.188169301f, 0.514541686f},
-std::array<float,2>{0.906254828f, 0.0275489707f},
-std::array<float,2>{0.031952709f, 0.256978691f},
-std::array<float,2>{0.786076248f, 0.899333f},
-std::array<float,2>{0.431196839f, 0.572507501f},
-std::array<float,2>{0.525614798f, 0.0853504911f},
-std::array<float,2>{0.31019178f, 0.164259613f},
-std::array<float,2>{0.748855054f, 0.626139283f},
-std::array<float,2>{0.13473922f, 0.764133394f},
-std::array<float,2>{0.95708847f, 0.404291898f},
-std::array<float,2>{0.24263905f, 0.0517755002f},
-std::array<float,2>{0.899457395f, 0.537478924f},
-std::array<float,2>{0.352816612f, 0.949658215f},
-std::array<float,2>{0.680821419f, 0.322857052f},
-std::array<float,2>{0.446510285f, 0.469103545f},
-std::array<float,2>{0.619845033f, 0.813251376f},
-std::array<float,2>{0.116837464f, 0.709991992f},
-std::array<float,2>{0.837415755f, 0.20778355f},
-std::array<float,2>{0.0378286503f, 0.448463857f},
-std::array<float,2>{0.784783661f, 0.871013522f},
-std::array<float,2>{0.436804235f, 0.749486864f},
-std::array<float,2>{0.529475152f, 0.218917996f},
-std::array<float,2>{0.304990798f, 0.00897955522f},
-std::array<float,2>{0.744952917f, 0.525912523f},
-std::array<float,2>{0.139088526f, 0.989509284f},
-std::array<float,2>{0.953241825f, 0.351167023f},
-std::array<float,2>{0.246520326f, 0.146392822f},
-std::array<float,2>{0.90308249f, 0.657979369f},
-std::array<float,2>{0.356014878f, 0.812473059f},
-std::array<float,2>{0.686192691f, 0.430543393f},
-std::array<float,2>{0.451501876f, 0.286901683f},
-std::array<float,2>{0.622429073f, 0.936269164f},
-std::array<float,2>{0.112027332f, 0.616021097f},
-std::array<float,2>{0.843288422f, 0.0944792703f},
-std::array<float,2>{0.167571113f, 0.333514899f},
-std::array<float,2>{0.976926386f, 0.962101161f},
-std::array<float,2>{0.274353534f, 0.547046125f},
-std::array<float,2>{0.694255352f, 0.037184909f},
-std::array<float,2>{0.404404223f, 0.193222538f},
-std::array<float,2>{0.536574066f, 0.69455117f},
-std::array<float,2>{0.00256279763f, 0.834889948f},
-std::array<float,2>{0.753914893f, 0.489886165f},
-std::array<float,2>{0.0863029957f, 0.0643458962f},
-std::array<float,2>{0.843823612f, 0.59080857f},
-std::array<float,2>{0.496605456f, 0.883030415f},
-std::array<float,2>{0.578492165f, 0.270469934f},
-std::array<float,2>{0.342350751f, 0.376488537f},
-std::array<float,2>{0.630538762f, 0.772902846f},
-std::array<float,2>{0.194427937f, 0.64284277f},
-std::array<float,2>{0.911863565f, 0.175743416f},
-std::array<float,2>{0.212623641f, 0.415723175f},
-std::array<float,2>{0.926418543f, 0.785296857f},
-std::array<float,2>{0.326301396f, 0.684832811f},
-std::array<float,2>{0.643633723f, 0.136637881f},
-std::array<float,2>{0.480306506f, 0.115121581f},
-std::array<float,2>{0.576480448f, 0.596013725f},
-std::array<float,2>{0.0674475357f, 0.912791133f},
-std::array<float,2>{0.871709704f, 0.305099607f},
-std::array<float,2>{0.0301750526f, 0.235569656f},
-std::array<float,2>{0.779658854f, 0.731920719f},
-std::array<float,2>{0.389633805f, 0.852274597f},
-std::array<float,2>{0.549422562f, 0.466154188f},
-std::array<float,2>{0.26118508f, 0.365376383f},
-std::array<float,2>{0.705117941f, 0.973156214f},
-std::array<float,2>{0.173891038f, 0.507429838f},
-std::array<float,2>{0.986394048f, 0.0201954674f},
-std::array<float,2>{0.0985332951f, 0.262921482f},
-std::array<float,2>{0.823168516f, 0.891539574f},
-std::array<float,2>{0.45775649f, 0.569030344f},
-std::array<float,2>{0.598067641f, 0.0924239382f},
-std::array<float,2>{0.364875972f, 0.15865007f},
-std::array<float,2>{0.664472163f, 0.632881999f},
-std::array<float,2>{0.219526634f, 0.755508006f},
-std::array<float,2>{0.876804531f, 0.394323796f},
-std::array<float,2>{0.155791149f, 0.0603299104f},
-std::array<float,2>{0.949550867f, 0.541448236f},
-std::array<float,2>{0.292240709f, 0.944254577f},
-std::array<float,2>{0.724959731f, 0.318109572f},
-std::array<float,2>{0.419898599f, 0.481328219f},
-std::array<float,2>{0.50774914f, 0.820446908f},
-std::array<float,2>{0.0504520163f, 0.718736529f},
-std::array<float,2>{0.811659634f, 0.216712609f},
-std::array<float,2>{0.0754598677f, 0.399035037f},
-std::array<float,2>{0.860833645f, 0.760832787f},
-std::array<float,2>{0.473591357f, 0.632765234f},
-std::array<float,2>{0.567442894f, 0.169785798f},
-std::array<float,2>{0.312600672f, 0.0784949362f},
-std::array<float,2>{0.653976262f, 0.575414777f},
-std::array<float,2>{0.205296755f, 0.903209329f},
-std::array<float,2>{0.932031274f, 0.253404349f},
-std::array<float,2>{0.181793034f, 0.206777379f},
-std::array<float,2>{0.999126017f, 0.706849098f},
-std::array<float,2>{0.251911253f, 0.816536665f},
-std::array<float,2>{0.718077779f, 0.473076224f},
-std::array<float,2>{0.381737828f, 0.324419498f},
-std::array<float,2>{0.555622637f, 0.947385192f},
-std::array<float,2>{0.0201858692f, 0.531505048f},
-std::array<float,2>{0.770348966f, 0.0492173731f},
-std::array<float,2>{0.228354111f, 0.297038049f},
-std::array<float,2>{0.884618223f, 0.91558373f},
-std::array<float,2>{0.36898604f, 0.602834582f},
-std::array<float,2>{0.657919109f, 0.118011378f},
-std::array<float,2>{0.465533286f, 0.125331834f},
-std::array<float,2>{0.601938844f, 0.675090551f},
-std::array<float,2>{0.102106929f, 0.79162854f},
-std::array<float,2>{0.815917015f, 0.408204556f},
-std::array<float,2>{0.0581042618f, 0.027009381f},
-std::array<float,2>{0.797323823f, 0.509453237f},
-std::array<float,2>{0.411291093f, 0.976570606f},
-std::array<float,2>{0.512447476f, 0.372390598f},
-std::array<float,2>{0.283032298f, 0.457084328f},
-std::array<float,2>{0.726833463f, 0.847249031f},
-std::array<float,2>{0.145132974f, 0.719038248f},
-std::array<float,2>{0.9394328f, 0.243165031f},
-std::array<float,2>{0.126169592f, 0.497594088f},
-std::array<float,2>{0.96838361f, 0.837516069f},
-std::array<float,2>{0.299167901f, 0.701769412f},
-std::array<float,2>{0.740375817f, 0.198244706f},
-std::array<float,2>{0.422989607f, 0.0396380126f},
-std::array<float,2>{0.517793179f, 0.556382596f},
-std::array<float,2>{0.0461306907f, 0.953615069f},
-std::array<float,2>{0.795326054f, 0.336974293f},
-std::array<float,2>{0.118817568f, 0.186508268f},
-std::array<float,2>{0.829333067f, 0.648887038f},
-std::array<float,2>{0.438307345f, 0.774034977f},
-std::array<float,2>{0.610488594f, 0.385521531f},
-std::array<float,2>{0.346687913f, 0.275606811f},
-std::array<float,2>{0.678448915f, 0.881605923f},
-std::array<float,2>{0.239629701f, 0.583341956f},
-std::array<float,2>{0.89420104f, 0.0766805634f},
-std::array<float,2>{0.0135657415f, 0.358612657f},
-std::array<float,2>{0.76555264f, 0.993074119f},
-std::array<float,2>{0.394314289f, 0.522853017f},
-std::array<float,2>{0.540514886f, 0.00252695265f},
-std::array<float,2>{0.271577001f, 0.233095095f},
-std::array<float,2>{0.697387159f, 0.735379815f},
-std::array<float,2>{0.156419247f, 0.866528094f},
-std::array<float,2>{0.970822275f, 0.437927872f},
-std::array<float,2>{0.197939023f, 0.107847355f},
-std::array<float,2>{0.918335795f, 0.619355857f},
-std::array<float,2>{0.32940039f, 0.926690698f},
-std::array<float,2>{0.637410581f, 0.289330304f},
-std::array<float,2>{0.491903245f, 0.425713837f},
-std::array<float,2>{0.591416359f, 0.804099321f},
-std::array<float,2>{0.081936799f, 0.667017758f},
-std::array<float,2>{0.851621866f, 0.152454913f},
-std::array<float,2>{0.0159811415f, 0.434748381f},
-std::array<float,2>{0.766769826f, 0.805229306f},
-std::array<float,2>{0.377052546f, 0.66071856f},
-std::array<float,2>{0.559993148f, 0.144496858f},
-std::array<float,2>{0.257181346f, 0.0997491181f},
-std::array<float,2>{0.712897837f, 0.613267183f},
-std::array<float,2>{0.185863674f, 0.931088448f},
-std::array<float,2>{0.995181084f, 0.284829944f},
-std::array<float,2>{0.208388135f, 0.224559084f},
-std::array<float,2>{0.936093152f, 0.744545221f},
-std::array<float,2>{0.317391783f, 0.874610484f},
-std::array<float,2>{0.650541961f, 0.451747984f},
-std::array<float,2>{0.469776005f, 0.34730196f},
-std::array<float,2>{0.56372875f, 0.987909317f},
-std::array<float,2>{0.0716865137f, 0.529347897f},
-std::array<float,2>{0.865637124f, 0.0143706137f},
-std::array<float,2>{0.14072822f, 0.266247422f},
-std::array<float,2>{0.942350805f, 0.888078809f},
-std::array<float,2>{0.288705379f, 0.586803496f},
-std::array<float,2>{0.732373476f, 0.0676507503f},
-std::array<float,2>{0.407357186f, 0.178376243f},
-std::array<float,2>{0.510015488f, 0.645513415f},
-std::array<float,2>{0.0595311001f, 0.767377019f},
-std::array<float,2>{0.801728666f, 0.380972862f},
-std::array<float,2>{0.109172642f, 0.0342867449f},
-std::array<float,2>{0.820018113f, 0.552719533f},
-std::array<float,2>{0.462773621f, 0.967788577f},
-std::array<float,2>{0.608546853f, 0.33148405f},
-std::array<float,2>{0.372277111f, 0.484815121f},
-std::array<float,2>{0.660562158f, 0.83040148f},
-std::array<float,2>{0.231644616f, 0.690338552f},
-std::array<float,2>{0.889319003f, 0.189757854f},
-std::array<float,2>{0.235843286f, 0.464536369f},
-std::array<float,2>{0.895281851f, 0.857388139f},
-std::array<float,2>{0.351492256f, 0.728453994f},
-std::array<float,2>{0.674892962f, 0.239456266f},
-std::array<float,2>{0.444179416f, 0.0157590639f},
-std::array<float,2>{0.614350796f, 0.502289176f},
-std::array<float,2>{0.12115182f, 0.971919239f},
-std::array<float,2>{0.834215641f, 0.359613806f},
-std::array<float,2>{0.0401765183f, 0.137707502f},
-std::array<float,2>{0.789142013f, 0.681523919f},
-std::array<float,2>{0.428136647f, 0.785085797f},
-std::array<float,2>{0.522111475f, 0.420721024f},
-std::array<float,2>{0.301154286f, 0.309811711f},
-std::array<float,2>{0.734466195f, 0.906365633f},
-std::array<float,2>{0.132727578f, 0.597742558f},
-std::array<float,2>{0.961506963f, 0.110122725f},
-std::array<float,2>{0.0831969306f, 0.31273964f},
-std::array<float,2>{0.858745396f, 0.939526677f},
-std::array<float,2>{0.485482097f, 0.544819951f},
-std::array<float,2>{0.588928938f, 0.0575971678f},
-std::array<float,2>{0.333394796f, 0.211256817f},
-std::array<float,2>{0.635303915f, 0.712599456f},
-std::array<float,2>{0.199653715f, 0.824745119f},
-std::array<float,2>{0.914939225f, 0.480267912f},
-std::array<float,2>{0.161414757f, 0.0860016048f},
-std::array<float,2>{0.974362433f, 0.566246212f},
-std::array<float,2>{0.267013073f, 0.894620001f},
-std::array<float,2>{0.703059614f, 0.258205414f},
-std::array<float,2>{0.39841187f, 0.396850616f},
-std::array<float,2>{0.545630097f, 0.752831519f},
-std::array<float,2>{0.00946538616f, 0.639942765f},
-std::array<float,2>{0.759859383f, 0.164032713f},
-std::array<float,2>{0.115690775f, 0.471162111f},
-std::array<float,2>{0.836855233f, 0.815422237f},
-std::array<float,2>{0.446005225f, 0.708665431f},
-std::array<float,2>{0.620350778f, 0.209875599f},
-std::array<float,2>{0.351775259f, 0.0539247282f},
-std::array<float,2>{0.680446506f, 0.535177112f},
-std::array<float,2>{0.24404408f, 0.952426016f},
-std::array<float,2>{0.898795485f, 0.320940286f},
-std::array<float,2>{0.133725107f, 0.167383477f},
-std::array<float,2>{0.958332837f, 0.628272474f},
-std::array<float,2>{0.309435397f, 0.762596369f},
-std::array<float,2>{0.749127865f, 0.404989004f},
-std::array<float,2>{0.429743469f, 0.255245835f},
-std::array<float,2>{0.527311325f, 0.90209645f},
-std::array<float,2>{0.0324338265f, 0.571174324f},
-std::array<float,2>{0.786179543f, 0.0828402564f},
-std::array<float,2>{0.188509539f, 0.367470682f},
-std::array<float,2>{0.90723598f, 0.980666339f},
-std::array<float,2>{0.33860305f, 0.51192975f},
-std::array<float,2>{0.62659514f, 0.0307962652f},
-std::array<float,2>{0.493229747f, 0.249553695f},
-std::array<float,2>{0.58333528f, 0.725201488f},
-std::array<float,2>{0.0901368186f, 0.8487131f},
-std::array<float,2>{0.84899646f, 0.453834832f},
-std::array<float,2>{0.00432406738f, 0.124744989f},
-std::array<float,2>{0.752057374f, 0.606286407f},
-std::array<float,2>{0.400748223f, 0.918385088f},
-std::array<float,2>{0.531310976f, 0.304231286f},
-std::array<float,2>{0.280298501f, 0.414059103f},
-std::array<float,2>{0.691016316f, 0.795581162f},
-std::array<float,2>{0.170496538f, 0.676284671f},
-std::array<float,2>{0.980940223f, 0.130791247f},
-std::array<float,2>{0.177100375f, 0.389732718f},
-std::array<float,2>{0.991072059f, 0.77735579f},
-std::array<float,2>{0.263666719f, 0.654491782f},
-std::array<float,2>{0.710688233f, 0.179906622f},
-std::array<float,2>{0.384668559f, 0.0737474114f},
-std::array<float,2>{0.552236974f, 0.578945875f},
-std::array<float,2>{0.0256363973f, 0.878331721f},
-std::array<float,2>{0.774068117f, 0.280690432f},
-std::array<float,2>{0.0640103817f, 0.200795531f},
-std::array<float,2>{0.868031681f, 0.69702369f},
-std::array<float,2>{0.483465225f, 0.842445195f},
-std::array<float,2>{0.571132839f, 0.494866639f},
-std::array<float,2>{0.322630405f, 0.34215346f},
-std::array<float,2>{0.646054506f, 0.959382236f},
-std::array<float,2>{0.218028203f, 0.561742783f},
-std::array<float,2>{0.92534554f, 0.0450346321f},
-std::array<float,2>{0.0519504957f, 0.295632929f},
-std::array<float,2>{0.807072043f, 0.925427973f},
-std::array<float,2>{0.414786011f, 0.623451948f},
-std::array<float,2>{0.502644658f, 0.101781107f},
-std::array<float,2>{0.29673925f, 0.151501134f},
-std::array<float,2>{0.720888734f, 0.670995176f},
-std::array<float,2>{0.149575695f, 0.798117101f},
-std::array<float,2>{0.947643042f, 0.426017731f},
-std::array<float,2>{0.222840503f, 0.00632688822f},
-std::array<float,2>{0.880314946f, 0.518787384f},
-std::array<float,2>{0.361420989f, 0.998514652f},
-std::array<float,2>{0.668982625f, 0.353601396f},
-std::array<float,2>{0.454343498f, 0.44181332f},
-std::array<float,2>{0.595476389f, 0.862038434f},
-std::array<float,2>{0.0958276689f, 0.739976943f},
-std::array<float,2>{0.826188028f, 0.227236643f},
-std::array<float,2>{0.000205994074f, 0.490449965f},
-std::array<float,2>{0.757403672f, 0.833869696f},
-std::array<float,2>{0.403618395f, 0.691711545f},
-std::array<float,2>{0.538702548f, 0.19520849f},
-std::array<float,2>{0.275976896f, 0.0370416678f},
-std::array<float,2>{0.691615105f, 0.549188316f},
-std::array<float,2>{0.164174303f, 0.962907553f},
-std::array<float,2>{0.979849398f, 0.335612297f},
-std::array<float,2>{0.192884713f, 0.172449395f},
-std::array<float,2>{0.912509978f, 0.642149508f},
-std::array<float,2>{0.339995801f, 0.769877195f},
-std::array<float,2>{0.631491721f, 0.377113998f},
-std::array<float,2>{0.499878705f, 0.273025304f},
-std::array<float,2>{0.580834866f, 0.886674106f},
-std::array<float,2>{0.0897329226f, 0.593186378f},
-std::array<float,2>{0.846645892f, 0.0649237335f},
-std::array<float,2>{0.137651071f, 0.34826237f},
-std::array<float,2>{0.955765665f, 0.991383016f},
-std::array<float,2>{0.308221042f, 0.52352488f},
-std::array<float,2>{0.743532002f, 0.010623279f},
-std::array<float,2>{0.434228241f, 0.221909925f},
-std::array<float,2>{0.528818011f, 0.747183442f},
-std::array<float,2>{0.0360848904f, 0.868756592f},
-std::array<float,2>{0.781944633f, 0.447018832f},
-std::array<float,2>{0.110401236f, 0.0957625732f},
-std::array<float,2>{0.839889646f, 0.613551438f},
-std::array<float,2>{0.450088441f, 0.934176803f},
-std::array<float,2>{0.623249471f, 0.287782043f},
-std::array<float,2>{0.358713806f, 0.432532817f},
-std::array<float,2>{0.683830798f, 0.810427666f},
-std::array<float,2>{0.248251975f, 0.658238292f},
-std::array<float,2>{0.904378533f, 0.146640569f},
-std::array<float,2>{0.220758155f, 0.391661644f},
-std::array<float,2>{0.878573895f, 0.757650971f},
-std::array<float,2>{0.366842985f, 0.635143459f},
-std::array<float,2>{0.667703211f, 0.156250343f},
-std::array<float,2>{0.460543454f, 0.0913964137f},
-std::array<float,2>{0.599614739f, 0.567606091f},
-std::array<float,2>{0.101539671f, 0.893462479f},
-std::array<float,2>{0.820879161f, 0.264616758f},
-std::array<float,2>{0.0477127954f, 0.217266321f},
-std::array<float,2>{0.809484959f, 0.716722906f},
-std::array<float,2>{0.420356542f, 0.824005961f},
-std::array<float,2>{0.505483985f, 0.483475327f},
-std::array<float,2>{0.290186435f, 0.319865823f},
-std::array<float,2>{0.723514378f, 0.94300127f},
-std::array<float,2>{0.15369302f, 0.540370584f},
-std::array<float,2>{0.951611817f, 0.0618753359f},
-std::array<float,2>{0.0685145482f, 0.307510406f},
-std::array<float,2>{0.873714745f, 0.911678433f},
-std::array<float,2>{0.47687453f, 0.595128715f},
-std::array<float,2>{0.576074839f, 0.116446473f},
-std::array<float,2>{0.324712843f, 0.132943243f},
-std::array<float,2>{0.642228901f, 0.686819911f},
-std::array<float,2>{0.213991642f, 0.78903079f},
-std::array<float,2>{0.929660976f, 0.416121662f},
-std::array<float,2>{0.173166379f, 0.0223411564f},
-std::array<float,2>{0.986275673f, 0.504762888f},
-std::array<float,2>{0.258081734f, 0.975383639f},
-std::array<float,2>{0.703772545f, 0.363587886f},
-std::array<float,2>{0.3882626f, 0.46735698f},
-std::array<float,2>{0.548462749f, 0.854261339f},
-std::array<float,2>{0.0282206144f, 0.733810723f},
-std::array<float,2>{0.777564108f, 0.236332566f},
-std::array<float,2>{0.10382659f, 0.407892883f},
-std::array<float,2>{0.81386584f, 0.789285421f},
-std::array<float,2>{0.468354732f, 0.672726631f},
-std::array<float,2>{0.604651868f, 0.127500087f},
-std::array<float,2>{0.369309276f, 0.119387515f},
-std::array<float,2>{0.658493459f, 0.604772508f},
-std::array<float,2>{0.228876114f, 0.917597532f},
-std::array<float,2>{0.885013938f, 0.299349666f},
-std::array<float,2>{0.147027224f, 0.245989844f},
-std::array<float,2>{0.940413713f, 0.721162617f},
-std::array<float,2>{0.28513369f, 0.845285892f},
-std::array<float,2>{0.72885102f, 0.460316867f},
-std::array<float,2>{0.413239241f, 0.374334216f},
-std::array<float,2>{0.514182746f, 0.979492426f},
-std::array<float,2>{0.0554407761f, 0.511418104f},
-std::array<float,2>{0.800635219f, 0.0234890711f},
-std::array<float,2>{0.203888625f, 0.251850784f},
-std::array<float,2>{0.931581736f, 0.90604353f},
-std::array<float,2>{0.315220475f, 0.576866925f},
-std::array<float,2>{0.65558368f, 0.0819984451f},
-std::array<float,2>{0.476480544f, 0.17092067f},
-std::array<float,2>{0.569569051f, 0.629439652f},
-std::array<float,2>{0.0768977851f, 0.758942366f},
-std::array<float,2>{0.86203599f, 0.402071297f},
-std::array<float,2>{0.0232462715f, 0.0470528714f},
-std::array<float,2>{0.77317822f, 0.534854889f},
-std::array<float,2>{0.380678266f, 0.945816696f},
-std::array<float,2>{0.557851613f, 0.327084064f},
-std::array<float,2>{0.252269208f, 0.475240678f},
-std::array<float,2>{0.715258539f, 0.81912142f},
-std::array<float,2>{0.180063412f, 0.70476526f},
-std::array<float,2>{0.997681856f, 0.204709172f},
-std::array<float,2>{0.159750596f, 0.440324187f},
-std::array<float,2>{0.97056812f, 0.864555061f},
-std::array<float,2>{0.269579202f, 0.736657977f},
-std::array<float,2>{0.696372449f, 0.230562195f},
-std::array<float,2>{0.391068816f, 0.0013830578f},
-std::array<float,2>{0.542166233f, 0.520933032f},
-std::array<float,2>{0.0155244358f, 0.995159686f},
-std::array<float,2>{0.762537241f, 0.357409209f},
-std::array<float,2>{0.0800436139f, 0.155993566f},
-std::array<float,2>{0.854386747f, 0.664800107f},
-std::array<float,2>{0.489498645f, 0.802670956f},
-std::array<float,2>{0.592782855f, 0.422424436f},
-std::array<float,2>{0.331326038f, 0.292863727f},
-std::array<float,2>{0.638719738f, 0.927949309f},
-std::array<float,2>{0.195514426f, 0.617878318f},
-std::array<float,2>{0.921122134f, 0.106764495f},
-std::array<float,2>{0.0448027737f, 0.338386476f},
-std::array<float,2>{0.793711066f, 0.955919743f},
-std::array<float,2>{0.423961312f, 0.557145238f},
-std::array<float,2>{0.516942799f, 0.0424713157f},
-std::array<float,2>{0.297364146f, 0.195639223f},
-std::array<float,2>{0.738419712f, 0.699738979f},
-std::array<float,2>{0.128066853f, 0.83929038f},
-std::array<float,2>{0.966004312f, 0.498122215f},
-std::array<float,2>{0.240621716f, 0.0745699555f},
-std::array<float,2>{0.891204536f, 0.585746467f},
-std::array<float,2>{0.344752222f, 0.880678654f},
-std::array<float,2>{0.676175833f, 0.273914695f},
-std::array<float,2>{0.441402137f, 0.384379655f},
-std::array<float,2>{0.612319767f, 0.775566757f},
-std::array<float,2>{0.119265959f, 0.651444972f},
-std::array<float,2>{0.831247568f, 0.184386879f},
-std::array<float,2>{0.0618213192f, 0.379618436f},
-std::array<float,2>{0.804261446f, 0.768172681f},
-std::array<float,2>{0.409401476f, 0.647035956f},
-std::array<float,2>{0.509049356f, 0.175941244f},
-std::array<float,2>{0.285770476f, 0.0690293312f},
-std::array<float,2>{0.733728528f, 0.58891952f},
-std::array<float,2>{0.142661542f, 0.889649332f},
-std::array<float,2>{0.943787575f, 0.269158572f},
-std::array<float,2>{0.234306708f, 0.188638732f},
-std::array<float,2>{0.888437092f, 0.688492f},
-std::array<float,2>{0.37447542f, 0.828971863f},
-std::array<float,2>{0.663651228f, 0.48716417f},
-std::array<float,2>{0.464803219f, 0.329928875f},
-std::array<float,2>{0.60581398f, 0.965343535f},
-std::array<float,2>{0.106201857f, 0.553186595f},
-std::array<float,2>{0.817903519f, 0.0314816087f},
-std::array<float,2>{0.184977576f, 0.282169223f},
-std::array<float,2>{0.993631959f, 0.932323217f},
-std::array<float,2>{0.25409767f, 0.611145198f},
-std::array<float,2>{0.711339891f, 0.0980148315f},
-std::array<float,2>{0.375478894f, 0.14223595f},
-std::array<float,2>{0.562458992f, 0.663116276f},
-std::array<float,2>{0.0191282295f, 0.807609797f},
-std::array<float,2>{0.768075705f, 0.435570002f},
-std::array<float,2>{0.073924385f, 0.0125435824f},
-std::array<float,2>{0.863452017f, 0.528196454f},
-std::array<float,2>{0.471412987f, 0.984724164f},
-std::array<float,2>{0.565979064f, 0.345631838f},
-std::array<float,2>{0.319884062f, 0.44938603f},
-std::array<float,2>{0.648678541f, 0.872327864f},
-std::array<float,2>{0.209373936f, 0.74250561f},
-std::array<float,2>{0.933866322f, 0.226003811f},
-std::array<float,2>{0.201409176f, 0.478158265f},
-std::array<float,2>{0.917596877f, 0.827560067f},
-std::array<float,2>{0.334925622f, 0.712972999f},
-std::array<float,2>{0.633230984f, 0.213055775f},
-std::array<float,2>{0.488141805f, 0.0564754941f},
-std::array<float,2>{0.587471485f, 0.545264244f},
-std::array<float,2>{0.0853170529f, 0.938574493f},
-std::array<float,2>{0.855707765f, 0.314683735f},
-std::array<float,2>{0.0105479909f, 0.160957366f},
-std::array<float,2>{0.758829415f, 0.637443304f},
-std::array<float,2>{0.395468414f, 0.750124037f},
-std::array<float,2>{0.543640137f, 0.396241099f},
-std::array<float,2>{0.26922667f, 0.261516809f},
-std::array<float,2>{0.701023579f, 0.897037208f},
-std::array<float,2>{0.163012594f, 0.564154565f},
-std::array<float,2>{0.976062477f, 0.0886181593f},
-std::array<float,2>{0.123592764f, 0.362484306f},
-std::array<float,2>{0.833785951f, 0.970158875f},
-std::array<float,2>{0.442923635f, 0.50028348f},
-std::array<float,2>{0.615314424f, 0.0188227016f},
-std::array<float,2>{0.349556834f, 0.240313143f},
-std::array<float,2>{0.672688484f, 0.728827f},
-std::array<float,2>{0.237386122f, 0.858931065f},
-std::array<float,2>{0.897616982f, 0.462338418f},
-std::array<float,2>{0.129037306f, 0.11301738f},
-std::array<float,2>{0.964784801f, 0.6013515f},
-std::array<float,2>{0.30456084f, 0.910058796f},
-std::array<float,2>{0.737356782f, 0.311573714f},
-std::array<float,2>{0.425882161f, 0.418819547f},
-std::array<float,2>{0.521182656f, 0.781659961f},
-std::array<float,2>{0.0419599228f, 0.683119178f},
-std::array<float,2>{0.792219639f, 0.140361682f},
-std::array<float,2>{0.0924507603f, 0.455485076f},
-std::array<float,2>{0.84965384f, 0.849856138f},
-std::array<float,2>{0.494813591f, 0.723624468f},
-std::array<float,2>{0.585304141f, 0.246477693f},
-std::array<float,2>{0.335996479f, 0.0288797468f},
-std::array<float,2>{0.628890395f, 0.514939487f},
-std::array<float,2>{0.191149652f, 0.983280778f},
-std::array<float,2>{0.909349382f, 0.370196044f},
-std::array<float,2>{0.169498876f, 0.131643191f},
-std::array<float,2>{0.983511269f, 0.679297924f},
-std::array<float,2>{0.278341472f, 0.794592977f},
-std::array<float,2>{0.689105451f, 0.410984218f},
-std::array<float,2>{0.399162799f, 0.300825417f},
-std::array<float,2>{0.533318222f, 0.920458734f},
-std::array<float,2>{0.00606025802f, 0.607718349f},
-std::array<float,2>{0.751681209f, 0.122745946f},
-std::array<float,2>{0.245018005f, 0.323406219f},
-std::array<float,2>{0.90115881f, 0.950465918f},
-std::array<float,2>{0.353678495f, 0.538713336f},
-std::array<float,2>{0.682215214f, 0.0513148047f},
-std::array<float,2>{0.448507398f, 0.208698034f},
-std::array<float,2>{0.618431151f, 0.709134817f},
-std::array<float,2>{0.11432635f, 0.813926995f},
-std::array<float,2>{0.838519633f, 0.470000118f},
-std::array<float,2>{0.0342742503f, 0.0846375972f},
-std::array<float,2>{0.787449002f, 0.573995173f},
-std::array<float,2>{0.433271408f, 0.899773538f},
-std::array<float,2>{0.524261355f, 0.255968541f},
-std::array<float,2>{0.311964542f, 0.402788758f},
-std::array<float,2>{0.747429371f, 0.764649332f},
-std::array<float,2>{0.135539129f, 0.625501812f},
-std::array<float,2>{0.959414065f, 0.165917262f},
-std::array<float,2>{0.151432961f, 0.429023683f},
-std::array<float,2>{0.945933819f, 0.799528003f},
-std::array<float,2>{0.294709831f, 0.668174505f},
-std::array<float,2>{0.720478892f, 0.150320873f},
-std::array<float,2>{0.417007327f, 0.103727937f},
-std::array<float,2>{0.501752138f, 0.622505426f},
-std::array<float,2>{0.0529657267f, 0.922861099f},
-std::array<float,2>{0.806572855f, 0.293536961f},
-std::array<float,2>{0.094052583f, 0.229804859f},
-std::array<float,2>{0.825582802f, 0.740653336f},
-std::array<float,2>{0.456722587f, 0.861074746f},
-std::array<float,2>{0.596935928f, 0.444643676f},
-std::array<float,2>{0.361261278f, 0.352835476f},
-std::array<float,2>{0.671302438f, 0.996515274f},
-std::array<float,2>{0.22490561f, 0.515816391f},
-std::array<float,2>{0.882188916f, 0.00443028752f},
-std::array<float,2>{0.0246283598f, 0.279096752f},
-std::array<float,2>{0.776519239f, 0.87668705f},
-std::array<float,2>{0.385615647f, 0.581643701f},
-std::array<float,2>{0.554227829f, 0.0706569776f},
-std::array<float,2>{0.264380068f, 0.182583466f},
-std::array<float,2>{0.707358539f, 0.653667152f},
-std::array<float,2>{0.178468212f, 0.780277073f},
-std::array<float,2>{0.9890154f, 0.387235641f},
-std::array<float,2>{0.216295838f, 0.044852186f},
-std::array<float,2>{0.921950877f, 0.559874535f},
-std::array<float,2>{0.321794868f, 0.958188713f},
-std::array<float,2>{0.647025585f, 0.340227097f},
-std::array<float,2>{0.481525749f, 0.492465764f},
-std::array<float,2>{0.573193789f, 0.840720952f},
-std::array<float,2>{0.0650007352f, 0.697279871f},
-std::array<float,2>{0.87002635f, 0.201363176f},
-std::array<float,2>{0.0150718186f, 0.43836388f},
-std::array<float,2>{0.761853755f, 0.867165267f},
-std::array<float,2>{0.391176939f, 0.73606807f},
-std::array<float,2>{0.542947054f, 0.232559696f},
-std::array<float,2>{0.270302266f, 0.00217413623f},
-std::array<float,2>{0.697033525f, 0.523171961f},
-std::array<float,2>{0.159259617f, 0.992459834f},
-std::array<float,2>{0.969816744f, 0.359255254f},
-std::array<float,2>{0.196118742f, 0.152892098f},
-std::array<float,2>{0.921491861f, 0.667625129f},
-std::array<float,2>{0.331719011f, 0.804301262f},
-std::array<float,2>{0.639498413f, 0.425036341f},
-std::array<float,2>{0.489766419f, 0.289934337f},
-std::array<float,2>{0.593449354f, 0.926150918f},
-std::array<float,2>{0.0794425979f, 0.619837999f},
-std::array<float,2>{0.85398221f, 0.107950293f},
-std::array<float,2>{0.128745794f, 0.337511659f},
-std::array<float,2>{0.966481745f, 0.953320265f},
-std::array<float,2>{0.297315001f, 0.5559901f},
-std::array<float,2>{0.738832951f, 0.0393761843f},
-std::array<float,2>{0.424395025f, 0.198882729f},
-std::array<float,2>{0.517491877f, 0.701613426f},
-std::array<float,2>{0.044074975f, 0.836991668f},
-std::array<float,2>{0.793371916f, 0.497090667f},
-std::array<float,2>{0.119775608f, 0.0764782578f},
-std::array<float,2>{0.832026243f, 0.583952308f},
-std::array<float,2>{0.440590143f, 0.881257594f},
-std::array<float,2>{0.612900496f, 0.276348323f},
-std::array<float,2>{0.345675617f, 0.384797364f},
-std::array<float,2>{0.676573157f, 0.773876607f},
-std::array<float,2>{0.240965769f, 0.649030209f},
-std::array<float,2>{0.890716732f, 0.185770154f},
-std::array<float,2>{0.229015604f, 0.409061551f},
-std::array<float,2>{0.88532722f, 0.791465461f},
-std::array<float,2>{0.369946301f, 0.675539613f},
-std::array<float,2>{0.658780277f, 0.125633135f},
-std::array<float,2>{0.468153656f, 0.117276855f},
-std::array<float,2>{0.605268717f, 0.603375733f},
-std::array<float,2>{0.104490653f, 0.915298164f},
-std::array<float,2>{0.814233363f, 0.297379702f},
-std::array<float,2>{0.0548857711f, 0.244013771f},
-std::array<float,2>{0.799909294f, 0.719341755f},
-std::array<float,2>{0.413766265f, 0.846817255f},
-std::array<float,2>{0.513704181f, 0.457855493f},
-std::array<float,2>{0.284359246f, 0.372959167f},
-std::array<float,2>{0.729380429f, 0.977396667f},
-std::array<float,2>{0.146838486f, 0.509005964f},
-std::array<float,2>{0.939685643f, 0.0268423166f},
-std::array<float,2>{0.0764560997f, 0.253902167f},
-std::array<float,2>{0.861379087f, 0.902418435f},
-std::array<float,2>{0.475994468f, 0.576104462f},
-std::array<float,2>{0.570077062f, 0.0786190554f},
-std::array<float,2>{0.314862043f, 0.169264674f},
-std::array<float,2>{0.655881464f, 0.632165074f},
-std::array<float,2>{0.203383893f, 0.761598706f},
-std::array<float,2>{0.931043386f, 0.398494393f},
-std::array<float,2>{0.180206016f, 0.0493787341f},
-std::array<float,2>{0.997340679f, 0.531988025f},
-std::array<float,2>{0.252635062f, 0.947981954f},
-std::array<float,2>{0.715367377f, 0.32518357f},
-std::array<float,2>{0.380189031f, 0.473144829f},
-std::array<float,2>{0.558339119f, 0.817356706f},
-std::array<float,2>{0.0228223223f, 0.706321657f},
-std::array<float,2>{0.772846162f, 0.206348673f},
-std::array<float,2>{0.100753196f, 0.393610984f},
-std::array<float,2>{0.820362031f, 0.754940271f},
-std::array<float,2>{0.46044597f, 0.633336782f},
-std::array<float,2>{0.600305378f, 0.158718005f},
-std::array<float,2>{0.366348505f, 0.0922270343f},
-std::array<float,2>{0.667117715f, 0.568423748f},
-std::array<float,2>{0.221538395f, 0.890722394f},
-std::array<float,2>{0.878058255f, 0.263568312f},
-std::array<float,2>{0.153926894f, 0.216280118f},
-std::array<float,2>{0.952133238f, 0.717864096f},
-std::array<float,2>{0.290580601f, 0.821237683f},
-std::array<float,2>{0.722997963f, 0.480585694f},
-std::array<float,2>{0.420495093f, 0.317827761f},
-std::array<float,2>{0.505220115f, 0.943423271f},
-std::array<float,2>{0.0471755266f, 0.541795492f},
-std::array<float,2>{0.809006214f, 0.0597461239f},
-std::array<float,2>{0.214835286f, 0.305350542f},
-std::array<float,2>{0.928946793f, 0.912289321f},
-std::array<float,2>{0.324619055f, 0.596474051f},
-std::array<float,2>{0.641656816f, 0.114441976f},
-std::array<float,2>{0.477286637f, 0.136164919f},
-std::array<float,2>{0.575423658f, 0.685307562f},
-std::array<float,2>{0.0691854358f, 0.78584975f},
-std::array<float,2>{0.873522222f, 0.415297627f},
-std::array<float,2>{0.0275308266f, 0.0197646879f},
-std::array<float,2>{0.777960956f, 0.50696665f},
-std::array<float,2>{0.387954563f, 0.973035634f},
-std::array<float,2>{0.547915041f, 0.366084129f},
-std::array<float,2>{0.258745432f, 0.466509044f},
-std::array<float,2>{0.703125477f, 0.852025688f},
-std::array<float,2>{0.173344314f, 0.732290983f},
-std::array<float,2>{0.985779047f, 0.23624672f},
-std::array<float,2>{0.164901167f, 0.489490032f},
-std::array<float,2>{0.980449677f, 0.834089875f},
-std::array<float,2>{0.275821745f, 0.695089102f},
-std::array<float,2>{0.692322493f, 0.192526013f},
-std::array<float,2>{0.403925359f, 0.0380225256f},
-std::array<float,2>{0.538521349f, 0.547368228f},
-std::array<float,2>{0.000769841834f, 0.962609828f},
-std::array<float,2>{0.757098854f, 0.333180338f},
-std::array<float,2>{0.0892837793f, 0.174883276f},
-std::array<float,2>{0.845788777f, 0.643445373f},
-std::array<float,2>{0.499047846f, 0.773292482f},
-std::array<float,2>{0.580237567f, 0.376300901f},
-std::array<float,2>{0.340807229f, 0.269775897f},
-std::array<float,2>{0.631272614f, 0.883467734f},
-std::array<float,2>{0.192606464f, 0.590205312f},
-std::array<float,2>{0.912644744f, 0.0639415979f},
-std::array<float,2>{0.0353121869f, 0.351014078f},
-std::array<float,2>{0.781598687f, 0.990046024f},
-std::array<float,2>{0.433901519f, 0.525534451f},
-std::array<float,2>{0.528335035f, 0.00961524248f},
-std::array<float,2>{0.307921678f, 0.2194985f},
-std::array<float,2>{0.743980408f, 0.749667287f},
-std::array<float,2>{0.136801407f, 0.870443761f},
-std::array<float,2>{0.955162585f, 0.448872715f},
-std::array<float,2>{0.248758852f, 0.093799904f},
-std::array<float,2>{0.905143559f, 0.61563462f},
-std::array<float,2>{0.359011143f, 0.935950994f},
-std::array<float,2>{0.684454024f, 0.286402196f},
-std::array<float,2>{0.449665576f, 0.429823756f},
-std::array<float,2>{0.623885632f, 0.811835945f},
-std::array<float,2>{0.111051396f, 0.657470703f},
-std::array<float,2>{0.840417564f, 0.145978168f},
-std::array<float,2>{0.0532227531f, 0.426671654f},
-std::array<float,2>{0.80580169f, 0.798815727f},
-std::array<float,2>{0.417482406f, 0.671610057f},
-std::array<float,2>{0.501405954f, 0.151861459f},
-std::array<float,2>{0.294286251f, 0.102189876f},
-std::array<float,2>{0.719924808f, 0.623968184f},
-std::array<float,2>{0.152042136f, 0.924971044f},
-std::array<float,2>{0.945572317f, 0.294925034f},
-std::array<float,2>{0.225551561f, 0.226567283f},
-std::array<float,2>{0.882378817f, 0.739437401f},
-std::array<float,2>{0.360356748f, 0.861330867f},
-std::array<float,2>{0.671489298f, 0.442117453f},
-std::array<float,2>{0.456251323f, 0.354325682f},
-std::array<float,2>{0.597207546f, 0.998636603f},
-std::array<float,2>{0.0944691077f, 0.519318044f},
-std::array<float,2>{0.825749516f, 0.00677900575f},
-std::array<float,2>{0.177863583f, 0.281126827f},
-std::array<float,2>{0.988412619f, 0.878554702f},
-std::array<float,2>{0.26371333f, 0.578360558f},
-std::array<float,2>{0.707615733f, 0.0735063031f},
-std::array<float,2>{0.385250062f, 0.180313602f},
-std::array<float,2>{0.553752422f, 0.654933631f},
-std::array<float,2>{0.024961099f, 0.778234363f},
-std::array<float,2>{0.77731216f, 0.39040029f},
-std::array<float,2>{0.0647605211f, 0.0455731638f},
-std::array<float,2>{0.869306087f, 0.562247217f},
-std::array<float,2>{0.482193023f, 0.959751785f},
-std::array<float,2>{0.572499692f, 0.342442542f},
-std::array<float,2>{0.321767628f, 0.494407356f},
-std::array<float,2>{0.646730244f, 0.841966927f},
-std::array<float,2>{0.216458976f, 0.696330547f},
-std::array<float,2>{0.922533751f, 0.200435013f},
-std::array<float,2>{0.190555692f, 0.453395575f},
-std::array<float,2>{0.909860611f, 0.849388719f},
-std::array<float,2>{0.336556286f, 0.724753618f},
-std::array<float,2>{0.628146708f, 0.249284804f},
-std::array<float,2>{0.494393647f, 0.0306004062f},
-std::array<float,2>{0.585911453f, 0.512518048f},
-std::array<float,2>{0.0918960571f, 0.981063902f},
-std::array<float,2>{0.850277066f, 0.367960006f},
-std::array<float,2>{0.00658759382f, 0.129948005f},
-std::array<float,2>{0.751238704f, 0.676074624f},
-std::array<float,2>{0.398866892f, 0.795088649f},
-std::array<float,2>{0.53371048f, 0.413571775f},
-std::array<float,2>{0.279205203f, 0.303997248f},
-std::array<float,2>{0.688884795f, 0.918865621f},
-std::array<float,2>{0.169427305f, 0.605778873f},
-std::array<float,2>{0.984163761f, 0.124293081f},
-std::array<float,2>{0.114770204f, 0.320778519f},
-std::array<float,2>{0.83818382f, 0.9530406f},
-std::array<float,2>{0.448759496f, 0.53576827f},
-std::array<float,2>{0.618706346f, 0.0545295924f},
-std::array<float,2>{0.354248434f, 0.209012479f},
-std::array<float,2>{0.681826532f, 0.708274066f},
-std::array<float,2>{0.244404569f, 0.814670026f},
-std::array<float,2>{0.900491357f, 0.471191764f},
-std::array<float,2>{0.134834737f, 0.0824676752f},
-std::array<float,2>{0.959585249f, 0.570346177f},
-std::array<float,2>{0.312378615f, 0.901536107f},
-std::array<float,2>{0.747849166f, 0.255514234f},
-std::array<float,2>{0.432999074f, 0.404371142f},
-std::array<float,2>{0.523804843f, 0.761982083f},
-std::array<float,2>{0.0348067172f, 0.628893137f},
-std::array<float,2>{0.787629604f, 0.167842165f},
-std::array<float,2>{0.085676752f, 0.479839653f},
-std::array<float,2>{0.856218278f, 0.82436204f},
-std::array<float,2>{0.487394899f, 0.712027848f},
-std::array<float,2>{0.587337315f, 0.211746484f},
-std::array<float,2>{0.334083498f, 0.0568764322f},
-std::array<float,2>{0.63352859f, 0.544361949f},
-std::array<float,2>{0.201875538f, 0.940014839f},
-std::array<float,2>{0.917212307f, 0.313346863f},
-std::array<float,2>{0.162363067f, 0.163365707f},
-std::array<float,2>{0.976295054f, 0.640349448f},
-std::array<float,2>{0.269003063f, 0.752008736f},
-std::array<float,2>{0.700536013f, 0.397228032f},
-std::array<float,2>{0.394774735f, 0.258492827f},
-std::array<float,2>{0.543200314f, 0.895077705f},
-std::array<float,2>{0.00986927841f, 0.565788269f},
-std::array<float,2>{0.759572983f, 0.0868501216f},
-std::array<float,2>{0.238156796f, 0.360132575f},
-std::array<float,2>{0.898262382f, 0.97238338f},
-std::array<float,2>{0.348940551f, 0.502452791f},
-std::array<float,2>{0.671881616f, 0.0163126662f},
-std::array<float,2>{0.442429632f, 0.239808962f},
-std::array<float,2>{0.615848064f, 0.727960765f},
-std::array<float,2>{0.123440415f, 0.85691154f},
-std::array<float,2>{0.833412588f, 0.464033931f},
-std::array<float,2>{0.0410618745f, 0.109694779f},
-std::array<float,2>{0.792756855f, 0.598200798f},
-std::array<float,2>{0.426534921f, 0.907057941f},
-std::array<float,2>{0.520746887f, 0.31012696f},
-std::array<float,2>{0.303867936f, 0.420214713f},
-std::array<float,2>{0.73824805f, 0.784371495f},
-std::array<float,2>{0.129779249f, 0.68100816f},
-std::array<float,2>{0.96396637f, 0.1383214f},
-std::array<float,2>{0.143210277f, 0.381652713f},
-std::array<float,2>{0.944125295f, 0.766665697f},
-std::array<float,2>{0.285167962f, 0.646276772f},
-std::array<float,2>{0.734187543f, 0.177932248f},
-std::array<float,2>{0.410019517f, 0.0682551116f},
-std::array<float,2>{0.50934124f, 0.586292505f},
-std::array<float,2>{0.0621472746f, 0.888622999f},
-std::array<float,2>{0.803971708f, 0.265721351f},
-std::array<float,2>{0.105596833f, 0.190163717f},
-std::array<float,2>{0.817510903f, 0.6897223f},
-std::array<float,2>{0.464078903f, 0.830620766f},
-std::array<float,2>{0.606328785f, 0.484909356f},
-std::array<float,2>{0.374916047f, 0.332020581f},
-std::array<float,2>{0.663503349f, 0.968527436f},
-std::array<float,2>{0.233611301f, 0.55217433f},
-std::array<float,2>{0.888066292f, 0.0348153375f},
-std::array<float,2>{0.0187597517f, 0.284318626f},
-std::array<float,2>{0.767866373f, 0.931482673f},
-std::array<float,2>{0.375596136f, 0.612450302f},
-std::array<float,2>{0.561654925f, 0.10052418f},
-std::array<float,2>{0.254627645f, 0.143657506f},
-std::array<float,2>{0.711819351f, 0.660168648f},
-std::array<float,2>{0.185484231f, 0.805160046f},
-std::array<float,2>{0.993975043f, 0.435531735f},
-std::array<float,2>{0.209549546f, 0.0139787318f},
-std::array<float,2>{0.934418023f, 0.530229867f},
-std::array<float,2>{0.31948635f, 0.987678051f},
-std::array<float,2>{0.648956835f, 0.347102642f},
-std::array<float,2>{0.470856875f, 0.451393217f},
-std::array<float,2>{0.565872312f, 0.87419647f},
-std::array<float,2>{0.0736867711f, 0.74486053f},
-std::array<float,2>{0.863850594f, 0.223751187f},
-std::array<float,2>{0.0466472469f, 0.498665214f},
-std::array<float,2>{0.795532048f, 0.839514971f},
-std::array<float,2>{0.42337954f, 0.699504972f},
-std::array<float,2>{0.518229604f, 0.196092233f},
-std::array<float,2>{0.29957667f, 0.0427742563f},
-std::array<float,2>{0.741180182f, 0.556653798f},
-std::array<float,2>{0.126710564f, 0.955215633f},
-std::array<float,2>{0.967953503f, 0.337895721f},
-std::array<float,2>{0.239995539f, 0.184067264f},
-std::array<float,2>{0.893916965f, 0.65197283f},
-std::array<float,2>{0.347644418f, 0.776141822f},
-std::array<float,2>{0.677877784f, 0.38410446f},
-std::array<float,2>{0.437631398f, 0.273954272f},
-std::array<float,2>{0.610877991f, 0.880307615f},
-std::array<float,2>{0.118648022f, 0.585425138f},
-std::array<float,2>{0.829865277f, 0.0749641582f},
-std::array<float,2>{0.156803235f, 0.356896728f},
-std::array<float,2>{0.971264064f, 0.99603349f},
-std::array<float,2>{0.272057444f, 0.521452904f},
-std::array<float,2>{0.698105931f, 0.00177895022f},
-std::array<float,2>{0.393831372f, 0.231047496f},
-std::array<float,2>{0.540730119f, 0.73699832f},
-std::array<float,2>{0.0129662929f, 0.86498636f},
-std::array<float,2>{0.764929235f, 0.439927518f},
-std::array<float,2>{0.0811871067f, 0.107171156f},
-std::array<float,2>{0.852224052f, 0.617224276f},
-std::array<float,2>{0.491359532f, 0.92868489f},
-std::array<float,2>{0.590982556f, 0.292165607f},
-std::array<float,2>{0.329684615f, 0.422118962f},
-std::array<float,2>{0.636939943f, 0.802099943f},
-std::array<float,2>{0.197630435f, 0.664152384f},
-std::array<float,2>{0.918592691f, 0.155427769f},
-std::array<float,2>{0.206013843f, 0.401608646f},
-std::array<float,2>{0.932537973f, 0.759676576f},
-std::array<float,2>{0.31337291f, 0.62904644f},
-std::array<float,2>{0.653464675f, 0.171847418f},
-std::array<float,2>{0.47284168f, 0.0810808763f},
-std::array<float,2>{0.568320751f, 0.576272845f},
-std::array<float,2>{0.0759678856f, 0.905534208f},
-std::array<float,2>{0.860967338f, 0.251173794f},
-std::array<float,2>{0.0195837803f, 0.204530075f},
-std::array<float,2>{0.769981265f, 0.704491079f},
-std::array<float,2>{0.38121447f, 0.818475068f},
-std::array<float,2>{0.555126309f, 0.474734038f},
-std::array<float,2>{0.25107789f, 0.326284796f},
-std::array<float,2>{0.718319416f, 0.945410848f},
-std::array<float,2>{0.182319075f, 0.534508049f},
-std::array<float,2>{0.999721348f, 0.0477284901f},
-std::array<float,2>{0.101712033f, 0.299000531f},
-std::array<float,2>{0.816076159f, 0.917366028f},
-std::array<float,2>{0.465065897f, 0.605022967f},
-std::array<float,2>{0.602505445f, 0.119971849f},
-std::array<float,2>{0.368352354f, 0.127152488f},
-std::array<float,2>{0.657458365f, 0.672005117f},
-std::array<float,2>{0.227701947f, 0.789723217f},
-std::array<float,2>{0.884239495f, 0.407232374f},
-std::array<float,2>{0.144982651f, 0.0241919849f},
-std::array<float,2>{0.93874532f, 0.51089263f},
-std::array<float,2>{0.282462567f, 0.98045218f},
-std::array<float,2>{0.727211773f, 0.37478599f},
-std::array<float,2>{0.411678523f, 0.46091944f},
-std::array<float,2>{0.51219362f, 0.845018029f},
-std::array<float,2>{0.0581304282f, 0.721412182f},
-std::array<float,2>{0.797785699f, 0.245433062f},
-std::array<float,2>{0.067928046f, 0.416960031f},
-std::array<float,2>{0.87137872f, 0.788382292f},
-std::array<float,2>{0.47950083f, 0.687331378f},
-std::array<float,2>{0.576865852f, 0.133419156f},
-std::array<float,2>{0.327091962f, 0.116852768f},
-std::array<float,2>{0.644318461f, 0.595242262f},
-std::array<float,2>{0.211960584f, 0.911405921f},
-std::array<float,2>{0.926114678f, 0.306767434f},
-std::array<float,2>{0.174444765f, 0.237248316f},
-std::array<float,2>{0.987131953f, 0.734009743f},
-std::array<float,2>{0.261672467f, 0.853874266f},
-std::array<float,2>{0.705957294f, 0.466971636f},
-std::array<float,2>{0.388727278f, 0.364035785f},
-std::array<float,2>{0.549311221f, 0.974763155f},
-std::array<float,2>{0.0296048895f, 0.504381299f},
-std::array<float,2>{0.779845536f, 0.0218496211f},
-std::array<float,2>{0.218974888f, 0.263980806f},
-std::array<float,2>{0.876248598f, 0.892945588f},
-std::array<float,2>{0.364566922f, 0.568137884f},
-std::array<float,2>{0.664929152f, 0.0909027606f},
-std::array<float,2>{0.457348883f, 0.157189623f},
-std::array<float,2>{0.598490298f, 0.635628998f},
-std::array<float,2>{0.0977708027f, 0.757306516f},
-std::array<float,2>{0.82235682f, 0.392556161f},
-std::array<float,2>{0.0498347804f, 0.0623403788f},
-std::array<float,2>{0.812320471f, 0.540850043f},
-std::array<float,2>{0.419088066f, 0.942735434f},
-std::array<float,2>{0.507268131f, 0.319493979f},
-std::array<float,2>{0.292613864f, 0.484149724f},
-std::array<float,2>{0.725186348f, 0.823454976f},
-std::array<float,2>{0.155659586f, 0.715955377f},
-std::array<float,2>{0.949862063f, 0.217474282f},
-std::array<float,2>{0.139621109f, 0.446639031f},
-std::array<float,2>{0.953800142f, 0.868334532f},
-std::array<float,2>{0.305501461f, 0.747806966f},
-std::array<float,2>{0.744330168f, 0.222547859f},
-std::array<float,2>{0.437057227f, 0.0100735435f},
-std::array<float,2>{0.530150056f, 0.524347186f},
-std::array<float,2>{0.0375959985f, 0.991918564f},
-std::array<float,2>{0.784612656f, 0.348005205f},
-std::array<float,2>{0.111722574f, 0.147435322f},
-std::array<float,2>{0.843255281f, 0.658817649f},
-std::array<float,2>{0.45207417f, 0.809727073f},
-std::array<float,2>{0.623041213f, 0.431782871f},
-std::array<float,2>{0.355530679f, 0.287194252f},
-std::array<float,2>{0.685976088f, 0.933682442f},
-std::array<float,2>{0.246756911f, 0.614234984f},
-std::array<float,2>{0.902771294f, 0.0965866968f},
-std::array<float,2>{0.00228872988f, 0.33541736f},
-std::array<float,2>{0.754662216f, 0.963452518f},
-std::array<float,2>{0.405072451f, 0.549732029f},
-std::array<float,2>{0.53682965f, 0.0366070829f},
-std::array<float,2>{0.273642212f, 0.194658697f},
-std::array<float,2>{0.693769634f, 0.692079544f},
-std::array<float,2>{0.167432576f, 0.833156288f},
-std::array<float,2>{0.977377534f, 0.490812331f},
-std::array<float,2>{0.194875166f, 0.0650712773f},
-std::array<float,2>{0.911394238f, 0.593462169f},
-std::array<float,2>{0.341950625f, 0.88610661f},
-std::array<float,2>{0.630096078f, 0.272696257f},
-std::array<float,2>{0.496146828f, 0.377678782f},
-std::array<float,2>{0.578850389f, 0.770086586f},
-std::array<float,2>{0.0868675113f, 0.641920984f},
-std::array<float,2>{0.844511807f, 0.172259331f},
-std::array<float,2>{0.0262813121f, 0.387023002f},
-std::array<float,2>{0.773821056f, 0.781013727f},
-std::array<float,2>{0.384072334f, 0.654103398f},
-std::array<float,2>{0.552714229f, 0.182059035f},
-std::array<float,2>{0.263123304f, 0.0710716322f},
-std::array<float,2>{0.710136235f, 0.581537008f},
-std::array<float,2>{0.177633092f, 0.876276433f},
-std::array<float,2>{0.990268171f, 0.278404564f},
-std::array<float,2>{0.218468308f, 0.202060625f},
-std::array<float,2>{0.924944639f, 0.698010743f},
-std::array<float,2>{0.322845161f, 0.839969337f},
-std::array<float,2>{0.645707667f, 0.492972016f},
-std::array<float,2>{0.484074622f, 0.340457827f},
-std::array<float,2>{0.570784628f, 0.958848298f},
-std::array<float,2>{0.0638917834f, 0.560197473f},
-std::array<float,2>{0.867442787f, 0.0439712517f},
-std::array<float,2>{0.150364116f, 0.292975515f},
-std::array<float,2>{0.947794378f, 0.923639417f},
-std::array<float,2>{0.296058118f, 0.62285924f},
-std::array<float,2>{0.721667171f, 0.104214922f},
-std::array<float,2>{0.414237499f, 0.149758756f},
-std::array<float,2>{0.502118945f, 0.668704093f},
-std::array<float,2>{0.0526136719f, 0.799272656f},
-std::array<float,2>{0.80734396f, 0.429343998f},
-std::array<float,2>{0.0966433063f, 0.00429011835f},
-std::array<float,2>{0.82690376f, 0.516314626f},
-std::array<float,2>{0.455024213f, 0.996943951f},
-std::array<float,2>{0.595099449f, 0.353334516f},
-std::array<float,2>{0.362066954f, 0.444990039f},
-std::array<float,2>{0.669576943f, 0.860479355f},
-std::array<float,2>{0.223360956f, 0.740954041f},
-std::array<float,2>{0.880770922f, 0.230324849f},
-std::array<float,2>{0.243364096f, 0.470382452f},
-std::array<float,2>{0.899362624f, 0.8140499f},
-std::array<float,2>{0.352443427f, 0.709925115f},
-std::array<float,2>{0.680082321f, 0.208469376f},
-std::array<float,2>{0.445693254f, 0.0511156246f},
-std::array<float,2>{0.6209957f, 0.538292229f},
-std::array<float,2>{0.115732752f, 0.950955033f},
-std::array<float,2>{0.836059988f, 0.324195415f},
-std::array<float,2>{0.0328833573f, 0.165287331f},
-std::array<float,2>{0.786632478f, 0.625193059f},
-std::array<float,2>{0.430459499f, 0.765546918f},
-std::array<float,2>{0.526569605f, 0.402865618f},
-std::array<float,2>{0.308865786f, 0.256433666f},
-std::array<float,2>{0.749603331f, 0.900277376f},
-std::array<float,2>{0.132865503f, 0.573476672f},
-std::array<float,2>{0.958644927f, 0.0843248144f},
-std::array<float,2>{0.0904880613f, 0.370636284f},
-std::array<float,2>{0.849372625f, 0.982471883f},
-std::array<float,2>{0.494122565f, 0.515417695f},
-std::array<float,2>{0.583721638f, 0.0288065691f},
-std::array<float,2>{0.338237286f, 0.247036174f},
-std::array<float,2>{0.626210988f, 0.723129511f},
-std::array<float,2>{0.189348996f, 0.850232363f},
-std::array<float,2>{0.907841206f, 0.455687284f},
-std::array<float,2>{0.170380771f, 0.122191131f},
-std::array<float,2>{0.981196105f, 0.608204365f},
-std::array<float,2>{0.281224817f, 0.919930577f},
-std::array<float,2>{0.690823197f, 0.301463336f},
-std::array<float,2>{0.400954455f, 0.410597861f},
-std::array<float,2>{0.531904399f, 0.794170618f},
-std::array<float,2>{0.00451478176f, 0.679138899f},
-std::array<float,2>{0.75265938f, 0.130970612f},
-std::array<float,2>{0.122007936f, 0.462827176f},
-std::array<float,2>{0.834634423f, 0.858748674f},
-std::array<float,2>{0.443430811f, 0.729341805f},
-std::array<float,2>{0.614848614f, 0.240966544f},
-std::array<float,2>{0.350776076f, 0.0190615542f},
-std::array<float,2>{0.675423563f, 0.500538111f},
-std::array<float,2>{0.235805586f, 0.97064358f},
-std::array<float,2>{0.894894302f, 0.362806737f},
-std::array<float,2>{0.132034689f, 0.139875203f},
-std::array<float,2>{0.961366951f, 0.682645798f},
-std::array<float,2>{0.301586241f, 0.782065988f},
-std::array<float,2>{0.734970689f, 0.418430507f},
-std::array<float,2>{0.428638786f, 0.31238088f},
-std::array<float,2>{0.521846831f, 0.909277201f},
-std::array<float,2>{0.0410134532f, 0.601062238f},
-std::array<float,2>{0.789827287f, 0.112368852f},
-std::array<float,2>{0.199950472f, 0.315042019f},
-std::array<float,2>{0.914113522f, 0.938983023f},
-std::array<float,2>{0.333878726f, 0.545595467f},
-std::array<float,2>{0.635045588f, 0.0558586307f},
-std::array<float,2>{0.486016363f, 0.213460639f},
-std::array<float,2>{0.589578986f, 0.713392496f},
-std::array<float,2>{0.0837868974f, 0.827727735f},
-std::array<float,2>{0.859233379f, 0.477962732f},
-std::array<float,2>{0.00907007698f, 0.0882827565f},
-std::array<float,2>{0.760617435f, 0.563694775f},
-std::array<float,2>{0.397878289f, 0.89665401f},
-std::array<float,2>{0.545239031f, 0.261108875f},
-std::array<float,2>{0.267190129f, 0.395802945f},
-std::array<float,2>{0.702617884f, 0.750545144f},
-std::array<float,2>{0.161776543f, 0.636856854f},
-std::array<float,2>{0.973642528f, 0.1603342f},
-std::array<float,2>{0.186523363f, 0.436207145f},
-std::array<float,2>{0.995926023f, 0.807037115f},
-std::array<float,2>{0.257781297f, 0.66381222f},
-std::array<float,2>{0.713657916f, 0.141605631f},
-std::array<float,2>{0.37783426f, 0.0984220356f},
-std::array<float,2>{0.560361147f, 0.610708952f},
-std::array<float,2>{0.0165095478f, 0.931800246f},
-std::array<float,2>{0.767345011f, 0.281511456f},
-std::array<float,2>{0.0718592852f, 0.226154521f},
-std::array<float,2>{0.866131902f, 0.743072271f},
-std::array<float,2>{0.470318288f, 0.872721493f},
-std::array<float,2>{0.564212382f, 0.449808568f},
-std::array<float,2>{0.317967057f, 0.344822794f},
-std::array<float,2>{0.650954664f, 0.985158861f},
-std::array<float,2>{0.208569497f, 0.527541518f},
-std::array<float,2>{0.93556726f, 0.0117219118f},
-std::array<float,2>{0.0587781481f, 0.268838227f},
-std::array<float,2>{0.800972402f, 0.890259147f},
-std::array<float,2>{0.408123463f, 0.58951062f},
-std::array<float,2>{0.51074183f, 0.0684137568f},
-std::array<float,2>{0.288300961f, 0.176621929f},
-std::array<float,2>{0.731592f, 0.646755636f},
-std::array<float,2>{0.141134337f, 0.767891884f},
-std::array<float,2>{0.941682518f, 0.3789289f},
-std::array<float,2>{0.232217312f, 0.0322211683f},
-std::array<float,2>{0.8887465f, 0.553358078f},
-std::array<float,2>{0.372872084f, 0.964977801f},
-std::array<float,2>{0.660771251f, 0.329340309f},
-std::array<float,2>{0.462167084f, 0.486349583f},
-std::array<float,2>{0.608971953f, 0.828322947f},
-std::array<float,2>{0.10862571f, 0.689000845f},
-std::array<float,2>{0.819529295f, 0.189366817f},
-std::array<float,2>{0.0567414798f, 0.458178014f},
-std::array<float,2>{0.797852993f, 0.846494079f},
-std::array<float,2>{0.410670102f, 0.720279336f},
-std::array<float,2>{0.51312387f, 0.242543221f},
-std::array<float,2>{0.281688303f, 0.0263612792f},
-std::array<float,2>{0.727950811f, 0.507953465f},
-std::array<float,2>{0.145874664f, 0.977611661f},
-std::array<float,2>{0.938236713f, 0.371685773f},
-std::array<float,2>{0.227040783f, 0.126099095f},
-std::array<float,2>{0.883718729f, 0.674690664f},
-std::array<float,2>{0.367687047f, 0.792775333f},
-std::array<float,2>{0.656499863f, 0.409746915f},
-std::array<float,2>{0.465834409f, 0.298181951f},
-std::array<float,2>{0.602754831f, 0.914092839f},
-std::array<float,2>{0.103122421f, 0.601981342f},
-std::array<float,2>{0.81461072f, 0.11912784f},
-std::array<float,2>{0.182982758f, 0.326067746f},
-std::array<float,2>{0.99851656f, 0.949215889f},
-std::array<float,2>{0.250295371f, 0.532289386f},
-std::array<float,2>{0.71735549f, 0.0504116528f},
-std::array<float,2>{0.382309914f, 0.20532088f},
-std::array<float,2>{0.555700839f, 0.705283046f},
-std::array<float,2>{0.0206006616f, 0.817947507f},
-std::array<float,2>{0.771473765f, 0.473794639f},
-std::array<float,2>{0.0747713149f, 0.0791796595f},
-std::array<float,2>{0.860310435f, 0.574462175f},
-std::array<float,2>{0.474296451f, 0.903704941f},
-std::array<float,2>{0.566511571f, 0.252378136f},
-std::array<float,2>{0.313630909f, 0.399446934f},
-std::array<float,2>{0.652506709f, 0.760062873f},
-std::array<float,2>{0.20703055f, 0.63144052f},
-std::array<float,2>{0.932827115f, 0.168462068f},
-std::array<float,2>{0.199141696f, 0.424045742f},
-std::array<float,2>{0.919028878f, 0.802841842f},
-std::array<float,2>{0.32862246f, 0.66666019f},
-std::array<float,2>{0.637779236f, 0.153707519f},
-std::array<float,2>{0.490862787f, 0.109083056f},
-std::array<float,2>{0.590009749f, 0.620906711f},
-std::array<float,2>{0.0807285756f, 0.927101612f},
-std::array<float,2>{0.853108048f, 0.290056378f},
-std::array<float,2>{0.0120083131f, 0.233775362f},
-std::array<float,2>{0.764027596f, 0.73480773f},
-std::array<float,2>{0.392816544f, 0.865776479f},
-std::array<float,2>{0.539977431f, 0.439388931f},
-std::array<float,2>{0.272765815f, 0.35748145f},
-std::array<float,2>{0.698595345f, 0.993283093f},
-std::array<float,2>{0.157521129f, 0.522374928f},
-std::array<float,2>{0.971723795f, 0.00354402233f},
-std::array<float,2>{0.117520146f, 0.276598543f},
-std::array<float,2>{0.828727484f, 0.882353306f},
-std::array<float,2>{0.439018339f, 0.582270801f},
-std::array<float,2>{0.609803975f, 0.0771732703f},
-std::array<float,2>{0.346562266f, 0.187427029f},
-std::array<float,2>{0.679028749f, 0.649865508f},
-std::array<float,2>{0.23901476f, 0.775206983f},
-std::array<float,2>{0.8931216f, 0.385942668f},
-std::array<float,2>{0.125185221f, 0.0400852337f},
-std::array<float,2>{0.967675745f, 0.55522716f},
-std::array<float,2>{0.300242901f, 0.954796672f},
-std::array<float,2>{0.741211414f, 0.336662829f},
-std::array<float,2>{0.422588378f, 0.497050375f},
-std::array<float,2>{0.519341052f, 0.836363137f},
-std::array<float,2>{0.0453312099f, 0.703096449f},
-std::array<float,2>{0.79682678f, 0.197453201f},
-std::array<float,2>{0.0874039158f, 0.375294685f},
-std::array<float,2>{0.845609188f, 0.772197902f},
-std::array<float,2>{0.498009533f, 0.643630624f},
-std::array<float,2>{0.579620242f, 0.174537137f},
-std::array<float,2>{0.343552917f, 0.0625415072f},
-std::array<float,2>{0.629731894f, 0.591620445f},
-std::array<float,2>{0.193739191f, 0.883830011f},
-std::array<float,2>{0.910481513f, 0.271368682f},
-std::array<float,2>{0.166767672f, 0.192104414f},
-std::array<float,2>{0.97842586f, 0.693931103f},
-std::array<float,2>{0.27509883f, 0.835357904f},
-std::array<float,2>{0.694909513f, 0.488661945f},
-std::array<float,2>{0.406070322f, 0.332952142f},
-std::array<float,2>{0.535763621f, 0.961493134f},
-std::array<float,2>{0.00303338445f, 0.548730075f},
-std::array<float,2>{0.755818903f, 0.0388714373f},
-std::array<float,2>{0.247662783f, 0.285412848f},
-std::array<float,2>{0.90377754f, 0.937271357f},
-std::array<float,2>{0.356632918f, 0.616800487f},
-std::array<float,2>{0.687220097f, 0.0949606076f},
-std::array<float,2>{0.452582508f, 0.145416871f},
-std::array<float,2>{0.621790648f, 0.657005012f},
-std::array<float,2>{0.112713665f, 0.811511695f},
-std::array<float,2>{0.842181563f, 0.430892825f},
-std::array<float,2>{0.0385206155f, 0.0087126568f},
-std::array<float,2>{0.783705533f, 0.527125657f},
-std::array<float,2>{0.435729772f, 0.989092112f},
-std::array<float,2>{0.530846477f, 0.349879473f},
-std::array<float,2>{0.30652988f, 0.447616607f},
-std::array<float,2>{0.745690286f, 0.86948204f},
-std::array<float,2>{0.140336156f, 0.748090982f},
-std::array<float,2>{0.955075324f, 0.220301494f},
-std::array<float,2>{0.1550221f, 0.482201815f},
-std::array<float,2>{0.950432181f, 0.821690261f},
-std::array<float,2>{0.291215688f, 0.717041135f},
-std::array<float,2>{0.726360381f, 0.215431303f},
-std::array<float,2>{0.418351084f, 0.059454374f},
-std::array<float,2>{0.506089568f, 0.542291403f},
-std::array<float,2>{0.0488669872f, 0.945130348f},
-std::array<float,2>{0.811490417f, 0.317114234f},
-std::array<float,2>{0.0995395482f, 0.159356371f},
-std::array<float,2>{0.824057519f, 0.634487033f},
-std::array<float,2>{0.458576918f, 0.754873753f},
-std::array<float,2>{0.598989487f, 0.393018782f},
-std::array<float,2>{0.364080399f, 0.262152404f},
-std::array<float,2>{0.665773153f, 0.892086089f},
-std::array<float,2>{0.220242918f, 0.56967175f},
-std::array<float,2>{0.875885546f, 0.0936268345f},
-std::array<float,2>{0.0304330159f, 0.366606057f},
-std::array<float,2>{0.780768156f, 0.974380076f},
-std::array<float,2>{0.390290856f, 0.50650388f},
-std::array<float,2>{0.55061394f, 0.0206457563f},
-std::array<float,2>{0.260287315f, 0.235156819f},
-std::array<float,2>{0.706210315f, 0.731355727f},
-std::array<float,2>{0.174967661f, 0.852875829f},
-std::array<float,2>{0.987831771f, 0.465366244f},
-std::array<float,2>{0.211179942f, 0.113772973f},
-std::array<float,2>{0.926989615f, 0.59734118f},
-std::array<float,2>{0.327168524f, 0.913733482f},
-std::array<float,2>{0.642763436f, 0.306209028f},
-std::array<float,2>{0.479215264f, 0.414573222f},
-std::array<float,2>{0.577197134f, 0.786527574f},
-std::array<float,2>{0.0665063486f, 0.683685303f},
-std::array<float,2>{0.872094512f, 0.13477537f},
-std::array<float,2>{0.00561032305f, 0.41230014f},
-std::array<float,2>{0.753864288f, 0.795955122f},
-std::array<float,2>{0.40136829f, 0.677011192f},
-std::array<float,2>{0.532944739f, 0.129463047f},
-std::array<float,2>{0.280141771f, 0.12399295f},
-std::array<float,2>{0.689677417f, 0.607324958f},
-std::array<float,2>{0.171306431f, 0.919250548f},
-std::array<float,2>{0.982350588f, 0.302859068f},
-std::array<float,2>{0.187514812f, 0.248358935f},
-std::array<float,2>{0.90674454f, 0.7258178f},
-std::array<float,2>{0.339807898f, 0.848023295f},
-std::array<float,2>{0.625559628f, 0.454533726f},
-std::array<float,2>{0.492270052f, 0.368824184f},
-std::array<float,2>{0.58280319f, 0.982115865f},
-std::array<float,2>{0.0916764811f, 0.513001978f},
-std::array<float,2>{0.848427892f, 0.0295622181f},
-std::array<float,2>{0.134264007f, 0.254786253f},
-std::array<float,2>{0.957823992f, 0.900458515f},
-std::array<float,2>{0.309737086f, 0.571781874f},
-std::array<float,2>{0.748102784f, 0.0835913345f},
-std::array<float,2>{0.431086421f, 0.166233256f},
-std::array<float,2>{0.526307464f, 0.627688229f},
-std::array<float,2>{0.0315102674f, 0.76290381f},
-std::array<float,2>{0.785401225f, 0.405345947f},
-std::array<float,2>{0.116597988f, 0.0527474023f},
-std::array<float,2>{0.837285817f, 0.536484897f},
-std::array<float,2>{0.44718039f, 0.951793253f},
-std::array<float,2>{0.619474471f, 0.322116375f},
-std::array<float,2>{0.353072166f, 0.471775383f},
-std::array<float,2>{0.681462467f, 0.816074073f},
-std::array<float,2>{0.242840648f, 0.707354546f},
-std::array<float,2>{0.900277913f, 0.210474879f},
-std::array<float,2>{0.224410042f, 0.442710668f},
-std::array<float,2>{0.879779816f, 0.86315757f},
-std::array<float,2>{0.363043934f, 0.73847723f},
-std::array<float,2>{0.668943822f, 0.22799179f},
-std::array<float,2>{0.453598946f, 0.0073898118f},
-std::array<float,2>{0.593817174f, 0.518416166f},
-std::array<float,2>{0.0970579609f, 0.999714613f},
-std::array<float,2>{0.827613533f, 0.355381101f},
-std::array<float,2>{0.0512471423f, 0.150408357f},
-std::array<float,2>{0.808557391f, 0.670066535f},
-std::array<float,2>{0.415098101f, 0.796985626f},
-std::array<float,2>{0.503282547f, 0.427486241f},
-std::array<float,2>{0.295880198f, 0.296765417f},
-std::array<float,2>{0.722201705f, 0.92399019f},
-std::array<float,2>{0.148670405f, 0.624141514f},
-std::array<float,2>{0.948396862f, 0.102992363f},
-std::array<float,2>{0.062595062f, 0.343199968f},
-std::array<float,2>{0.869136035f, 0.96025008f},
-std::array<float,2>{0.483253419f, 0.561327219f},
-std::array<float,2>{0.572133124f, 0.0459341332f},
-std::array<float,2>{0.3238267f, 0.199773476f},
-std::array<float,2>{0.645323873f, 0.695733428f},
-std::array<float,2>{0.2169424f, 0.843047559f},
-std::array<float,2>{0.923940957f, 0.49541688f},
-std::array<float,2>{0.176135674f, 0.0727195963f},
-std::array<float,2>{0.991668105f, 0.579180062f},
-std::array<float,2>{0.262600571f, 0.87731266f},
-std::array<float,2>{0.709186852f, 0.280175626f},
-std::array<float,2>{0.382898778f, 0.389425546f},
-std::array<float,2>{0.550862134f, 0.778410673f},
-std::array<float,2>{0.0273061469f, 0.656009495f},
-std::array<float,2>{0.774837613f, 0.180752769f},
-std::array<float,2>{0.107759535f, 0.486049384f},
-std::array<float,2>{0.818740785f, 0.831719756f},
-std::array<float,2>{0.461778283f, 0.69121021f},
-std::array<float,2>{0.607821465f, 0.190513089f},
-std::array<float,2>{0.371348709f, 0.0341423079f},
-std::array<float,2>{0.662051082f, 0.551470518f},
-std::array<float,2>{0.230518386f, 0.967101991f},
-std::array<float,2>{0.890494466f, 0.330949128f},
-std::array<float,2>{0.142322466f, 0.179252863f},
-std::array<float,2>{0.942915916f, 0.645078003f},
-std::array<float,2>{0.287216008f, 0.76618886f},
-std::array<float,2>{0.730787337f, 0.381993026f},
-std::array<float,2>{0.406283081f, 0.267040104f},
-std::array<float,2>{0.511359513f, 0.887586534f},
-std::array<float,2>{0.0596536547f, 0.587483525f},
-std::array<float,2>{0.802173197f, 0.066433996f},
-std::array<float,2>{0.207440615f, 0.346230268f},
-std::array<float,2>{0.93731153f, 0.986529887f},
-std::array<float,2>{0.317205518f, 0.530573368f},
-std::array<float,2>{0.65151608f, 0.0148285404f},
-std::array<float,2>{0.469445676f, 0.222673059f},
-std::array<float,2>{0.562683523f, 0.745799065f},
-std::array<float,2>{0.0708319694f, 0.873859882f},
-std::array<float,2>{0.866553843f, 0.453076959f},
-std::array<float,2>{0.0170104336f, 0.10151317f},
-std::array<float,2>{0.766470373f, 0.611639559f},
-std::array<float,2>{0.378276795f, 0.930181086f},
-std::array<float,2>{0.558810532f, 0.283305317f},
-std::array<float,2>{0.256469488f, 0.43373543f},
-std::array<float,2>{0.714666009f, 0.806548119f},
-std::array<float,2>{0.187016144f, 0.661577463f},
-std::array<float,2>{0.994166791f, 0.142613277f},
-std::array<float,2>{0.160848856f, 0.397670567f},
-std::array<float,2>{0.973626494f, 0.753381729f},
-std::array<float,2>{0.266205192f, 0.639061868f},
-std::array<float,2>{0.702025831f, 0.162288845f},
-std::array<float,2>{0.396743119f, 0.0875905231f},
-std::array<float,2>{0.54625839f, 0.564685404f},
-std::array<float,2>{0.0082529597f, 0.896203399f},
-std::array<float,2>{0.761479676f, 0.259253055f},
-std::array<float,2>{0.0821967497f, 0.21230787f},
-std::array<float,2>{0.857802868f, 0.711511314f},
-std::array<float,2>{0.485150665f, 0.825737596f},
-std::array<float,2>{0.588260233f, 0.479083031f},
-std::array<float,2>{0.332316846f, 0.313491136f},
-std::array<float,2>{0.636612356f, 0.940928042f},
-std::array<float,2>{0.200477317f, 0.543533027f},
-std::array<float,2>{0.915256977f, 0.0578386299f},
-std::array<float,2>{0.0392284319f, 0.308724612f},
-std::array<float,2>{0.790496707f, 0.907459795f},
-std::array<float,2>{0.428759813f, 0.599158168f},
-std::array<float,2>{0.52288872f, 0.110796116f},
-std::array<float,2>{0.302484721f, 0.137584776f},
-std::array<float,2>{0.736076534f, 0.680079699f},
-std::array<float,2>{0.131527737f, 0.783566535f},
-std::array<float,2>{0.962880015f, 0.42101261f},
-std::array<float,2>{0.235030591f, 0.0167180672f},
-std::array<float,2>{0.896207809f, 0.503629386f},
-std::array<float,2>{0.350523323f, 0.97162199f},
-std::array<float,2>{0.673890233f, 0.360793531f},
-std::array<float,2>{0.444513172f, 0.463653743f},
-std::array<float,2>{0.613993168f, 0.856296301f},
-std::array<float,2>{0.122645445f, 0.72689116f},
-std::array<float,2>{0.835855007f, 0.23916088f},
-std::array<float,2>{0.0221307073f, 0.476493061f},
-std::array<float,2>{0.772356153f, 0.819619298f},
-std::array<float,2>{0.379844636f, 0.703163266f},
-std::array<float,2>{0.556742728f, 0.203833565f},
-std::array<float,2>{0.253602952f, 0.0485470556f},
-std::array<float,2>{0.715981066f, 0.533823431f},
-std::array<float,2>{0.180776775f, 0.94637394f},
-std::array<float,2>{0.996971428f, 0.327620566f},
-std::array<float,2>{0.204541624f, 0.169938788f},
-std::array<float,2>{0.930281401f, 0.630841911f},
-std::array<float,2>{0.315611571f, 0.758538902f},
-std::array<float,2>{0.655143797f, 0.401124805f},
-std::array<float,2>{0.474673718f, 0.250744313f},
-std::array<float,2>{0.568985462f, 0.904879928f},
-std::array<float,2>{0.0780503303f, 0.577646375f},
-std::array<float,2>{0.862954795f, 0.0806113034f},
-std::array<float,2>{0.147906482f, 0.373341948f},
-std::array<float,2>{0.940587103f, 0.979314148f},
-std::array<float,2>{0.284048259f, 0.510121763f},
-std::array<float,2>{0.729617357f, 0.0253314227f},
-std::array<float,2>{0.412522823f, 0.245094284f},
-std::array<float,2>{0.515076578f, 0.722059786f},
-std::array<float,2>{0.0560159162f, 0.843968809f},
-std::array<float,2>{0.799463153f, 0.459777266f},
-std::array<float,2>{0.104668863f, 0.121051326f},
-std::array<float,2>{0.812967062f, 0.604283631f},
-std::array<float,2>{0.467110783f, 0.916249692f},
-std::array<float,2>{0.603685915f, 0.299853683f},
-std::array<float,2>{0.371039867f, 0.406596214f},
-std::array<float,2>{0.65976274f, 0.790520012f},
-std::array<float,2>{0.229939446f, 0.673808873f},
-std::array<float,2>{0.886398017f, 0.128702179f},
-std::array<float,2>{0.241958082f, 0.383137435f},
-std::array<float,2>{0.891891241f, 0.777210534f},
-std::array<float,2>{0.34402132f, 0.650590658f},
-std::array<float,2>{0.677384436f, 0.184885681f},
-std::array<float,2>{0.439910054f, 0.0753583014f},
-std::array<float,2>{0.61160177f, 0.584841073f},
-std::array<float,2>{0.120499589f, 0.878993034f},
-std::array<float,2>{0.830217063f, 0.275112629f},
-std::array<float,2>{0.0438798182f, 0.197193265f},
-std::array<float,2>{0.794723392f, 0.700864971f},
-std::array<float,2>{0.425117761f, 0.838796794f},
-std::array<float,2>{0.51622808f, 0.499224097f},
-std::array<float,2>{0.29881838f, 0.339441538f},
-std::array<float,2>{0.739789665f, 0.956535101f},
-std::array<float,2>{0.127428085f, 0.558042049f},
-std::array<float,2>{0.965477765f, 0.0410226397f},
-std::array<float,2>{0.0785088465f, 0.29160139f},
-std::array<float,2>{0.85525322f, 0.929126322f},
-std::array<float,2>{0.489054978f, 0.618255794f},
-std::array<float,2>{0.591847241f, 0.105817221f},
-std::array<float,2>{0.330748796f, 0.15504986f},
-std::array<float,2>{0.640365303f, 0.665737689f},
-std::array<float,2>{0.197244734f, 0.800816417f},
-std::array<float,2>{0.920445979f, 0.423671037f},
-std::array<float,2>{0.158987686f, 0.000144059086f},
-std::array<float,2>{0.969587088f, 0.520098686f},
-std::array<float,2>{0.27119109f, 0.994262397f},
-std::array<float,2>{0.695323229f, 0.355864882f},
-std::array<float,2>{0.391607612f, 0.440822989f},
-std::array<float,2>{0.541029871f, 0.863342583f},
-std::array<float,2>{0.014023751f, 0.738094032f},
-std::array<float,2>{0.762970746f, 0.2315882f},
-std::array<float,2>{0.110243067f, 0.43329668f},
-std::array<float,2>{0.841071904f, 0.809454441f},
-std::array<float,2>{0.450872064f, 0.659687817f},
-std::array<float,2>{0.624826372f, 0.148283586f},
-std::array<float,2>{0.358208925f, 0.0970802233f},
-std::array<float,2>{0.684870601f, 0.615127325f},
-std::array<float,2>{0.249218687f, 0.934686542f},
-std::array<float,2>{0.906072319f, 0.288802952f},
-std::array<float,2>{0.137834534f, 0.220752403f},
-std::array<float,2>{0.956797838f, 0.746197283f},
-std::array<float,2>{0.306925446f, 0.86739862f},
-std::array<float,2>{0.743020117f, 0.445648551f},
-std::array<float,2>{0.434833795f, 0.348665982f},
-std::array<float,2>{0.527989507f, 0.991018593f},
-std::array<float,2>{0.0363675654f, 0.525298595f},
-std::array<float,2>{0.783030927f, 0.0113596944f},
-std::array<float,2>{0.191907868f, 0.271919847f},
-std::array<float,2>{0.913236499f, 0.885051966f},
-std::array<float,2>{0.341659606f, 0.592420697f},
-std::array<float,2>{0.632487953f, 0.0656692237f},
-std::array<float,2>{0.498092175f, 0.173065543f},
-std::array<float,2>{0.581789613f, 0.641423821f},
-std::array<float,2>{0.0880697221f, 0.770986855f},
-std::array<float,2>{0.846804559f, 0.378624529f},
-std::array<float,2>{0.00186202337f, 0.0360664651f},
-std::array<float,2>{0.756341755f, 0.550150275f},
-std::array<float,2>{0.403006822f, 0.963983893f},
-std::array<float,2>{0.537663877f, 0.334133863f},
-std::array<float,2>{0.277236611f, 0.491254538f},
-std::array<float,2>{0.692829311f, 0.832318366f},
-std::array<float,2>{0.165872723f, 0.692835629f},
-std::array<float,2>{0.978664279f, 0.193549335f},
-std::array<float,2>{0.172299817f, 0.467867225f},
-std::array<float,2>{0.984383821f, 0.854757607f},
-std::array<float,2>{0.258921415f, 0.733166993f},
-std::array<float,2>{0.704890847f, 0.238036215f},
-std::array<float,2>{0.386796117f, 0.0233482085f},
-std::array<float,2>{0.547810376f, 0.504913151f},
-std::array<float,2>{0.0284503251f, 0.976334572f},
-std::array<float,2>{0.779027045f, 0.364645571f},
-std::array<float,2>{0.0699059293f, 0.13390018f},
-std::array<float,2>{0.874643803f, 0.686149597f},
-std::array<float,2>{0.478385657f, 0.787811697f},
-std::array<float,2>{0.5744313f, 0.417495608f},
-std::array<float,2>{0.325439423f, 0.3077586f},
-std::array<float,2>{0.641257942f, 0.910378575f},
-std::array<float,2>{0.213284254f, 0.593951106f},
-std::array<float,2>{0.927886426f, 0.115742937f},
-std::array<float,2>{0.0482687764f, 0.319315821f},
-std::array<float,2>{0.810530007f, 0.941690207f},
-std::array<float,2>{0.421701252f, 0.539170504f},
-std::array<float,2>{0.504324138f, 0.0612807274f},
-std::array<float,2>{0.289659888f, 0.21846953f},
-std::array<float,2>{0.724178195f, 0.715471268f},
-std::array<float,2>{0.152973011f, 0.822509885f},
-std::array<float,2>{0.952641726f, 0.482644141f},
-std::array<float,2>{0.22239098f, 0.0902574807f},
-std::array<float,2>{0.87720871f, 0.566482425f},
-std::array<float,2>{0.365726888f, 0.894340456f},
-std::array<float,2>{0.666074216f, 0.265471011f},
-std::array<float,2>{0.459543824f, 0.391291767f},
-std::array<float,2>{0.601105332f, 0.75643301f},
-std::array<float,2>{0.10042768f, 0.636574984f},
-std::array<float,2>{0.822060049f, 0.157424867f},
-std::array<float,2>{0.0333566703f, 0.403641105f},
-std::array<float,2>{0.788247585f, 0.764631987f},
-std::array<float,2>{0.432043344f, 0.626798689f},
-std::array<float,2>{0.524499416f, 0.16486451f},
-std::array<float,2>{0.311015606f, 0.0855301544f},
-std::array<float,2>{0.746467173f, 0.572972715f},
-std::array<float,2>{0.136263222f, 0.898660541f},
-std::array<float,2>{0.960851014f, 0.257779688f},
-std::array<float,2>{0.245942652f, 0.207463712f},
-std::array<float,2>{0.90215683f, 0.710621297f},
-std::array<float,2>{0.355163962f, 0.81259042f},
-std::array<float,2>{0.683113217f, 0.469686389f},
-std::array<float,2>{0.447979867f, 0.322412908f},
-std::array<float,2>{0.617753327f, 0.949832678f},
-std::array<float,2>{0.11364416f, 0.537717879f},
-std::array<float,2>{0.839151561f, 0.0522939041f},
-std::array<float,2>{0.168100849f, 0.301974028f},
-std::array<float,2>{0.983090758f, 0.921454906f},
-std::array<float,2>{0.278257668f, 0.608882964f},
-std::array<float,2>{0.688354075f, 0.121816203f},
-std::array<float,2>{0.400125861f, 0.132343695f},
-std::array<float,2>{0.534704804f, 0.677911937f},
-std::array<float,2>{0.00711121364f, 0.793565869f},
-std::array<float,2>{0.750836551f, 0.41135788f},
-std::array<float,2>{0.0935592428f, 0.0278510004f},
-std::array<float,2>{0.850747883f, 0.51384753f},
-std::array<float,2>{0.495490253f, 0.983570158f},
-std::array<float,2>{0.584592879f, 0.369740814f},
-std::array<float,2>{0.337560505f, 0.456794828f},
-std::array<float,2>{0.627058506f, 0.851041138f},
-std::array<float,2>{0.190094173f, 0.7244609f},
-std::array<float,2>{0.90915972f, 0.247912735f},
-std::array<float,2>{0.215410501f, 0.49363032f},
-std::array<float,2>{0.923485756f, 0.841081023f},
-std::array<float,2>{0.321197301f, 0.699213088f},
-std::array<float,2>{0.648403168f, 0.203040063f},
-std::array<float,2>{0.480696976f, 0.0435194857f},
-std::array<float,2>{0.57353884f, 0.559442461f},
-std::array<float,2>{0.0655838996f, 0.957149029f},
-std::array<float,2>{0.870281279f, 0.341180325f},
-std::array<float,2>{0.0242788587f, 0.183414534f},
-std::array<float,2>{0.776117861f, 0.65247333f},
-std::array<float,2>{0.386500448f, 0.780242682f},
-std::array<float,2>{0.55341804f, 0.388316154f},
-std::array<float,2>{0.265534818f, 0.277364969f},
-std::array<float,2>{0.708297968f, 0.87517184f},
-std::array<float,2>{0.178783536f, 0.580225766f},
-std::array<float,2>{0.989784062f, 0.0720793232f},
-std::array<float,2>{0.0956175998f, 0.352216721f},
-std::array<float,2>{0.82498014f, 0.997244f},
-std::array<float,2>{0.455365062f, 0.517276525f},
-std::array<float,2>{0.596232593f, 0.00533550931f},
-std::array<float,2>{0.359460622f, 0.229248837f},
-std::array<float,2>{0.670567155f, 0.741891861f},
-std::array<float,2>{0.225950941f, 0.860067248f},
-std::array<float,2>{0.881196737f, 0.444330931f},
-std::array<float,2>{0.150716394f, 0.104904987f},
-std::array<float,2>{0.946729541f, 0.621183634f},
-std::array<float,2>{0.293283284f, 0.922073364f},
-std::array<float,2>{0.719169021f, 0.294282824f},
-std::array<float,2>{0.416387796f, 0.428341329f},
-std::array<float,2>{0.500264585f, 0.800716221f},
-std::array<float,2>{0.0537846163f, 0.669205964f},
-std::array<float,2>{0.804956436f, 0.148467228f},
-std::array<float,2>{0.0731692836f, 0.450494736f},
-std::array<float,2>{0.864808679f, 0.871493995f},
-std::array<float,2>{0.472645223f, 0.743960202f},
-std::array<float,2>{0.565014064f, 0.225457311f},
-std::array<float,2>{0.31903553f, 0.0130250771f},
-std::array<float,2>{0.65005368f, 0.528332472f},
-std::array<float,2>{0.210396305f, 0.986198604f},
-std::array<float,2>{0.935117483f, 0.344602585f},
-std::array<float,2>{0.18447049f, 0.140941411f},
-std::array<float,2>{0.992864907f, 0.662558198f},
-std::array<float,2>{0.255457044f, 0.808383167f},
-std::array<float,2>{0.712753892f, 0.437065542f},
-std::array<float,2>{0.376267225f, 0.282515079f},
-std::array<float,2>{0.561275482f, 0.933163762f},
-std::array<float,2>{0.0177630801f, 0.609817386f},
-std::array<float,2>{0.769191742f, 0.0995936543f},
-std::array<float,2>{0.233256802f, 0.328856528f},
-std::array<float,2>{0.886974096f, 0.966435134f},
-std::array<float,2>{0.373908818f, 0.554218531f},
-std::array<float,2>{0.662855864f, 0.0331608728f},
-std::array<float,2>{0.463256031f, 0.187963694f},
-std::array<float,2>{0.606789589f, 0.688180208f},
-std::array<float,2>{0.107139461f, 0.829743087f},
-std::array<float,2>{0.816773474f, 0.487857372f},
-std::array<float,2>{0.0610096566f, 0.0696648508f},
-std::array<float,2>{0.803433001f, 0.588171899f},
-std::array<float,2>{0.408383727f, 0.889025629f},
-std::array<float,2>{0.508764088f, 0.268160999f},
-std::array<float,2>{0.28682369f, 0.380544782f},
-std::array<float,2>{0.732791841f, 0.769086301f},
-std::array<float,2>{0.144243106f, 0.648313344f},
-std::array<float,2>{0.944494247f, 0.177249402f},
-std::array<float,2>{0.130747914f, 0.419398278f},
-std::array<float,2>{0.963781357f, 0.782577395f},
-std::array<float,2>{0.303689688f, 0.682235658f},
-std::array<float,2>{0.736658216f, 0.13916038f},
-std::array<float,2>{0.427483112f, 0.111705042f},
-std::array<float,2>{0.520507693f, 0.600565076f},
-std::array<float,2>{0.0424757376f, 0.909027159f},
-std::array<float,2>{0.791921616f, 0.311514974f},
-std::array<float,2>{0.124029204f, 0.241823271f},
-std::array<float,2>{0.832124472f, 0.730425954f},
-std::array<float,2>{0.441897094f, 0.858045697f},
-std::array<float,2>{0.61662966f, 0.461198658f},
-std::array<float,2>{0.347957194f, 0.361824661f},
-std::array<float,2>{0.673080564f, 0.969431341f},
-std::array<float,2>{0.236824796f, 0.501773953f},
-std::array<float,2>{0.896701217f, 0.0185544044f},
-std::array<float,2>{0.0108842077f, 0.260123909f},
-std::array<float,2>{0.758259952f, 0.897693694f},
-std::array<float,2>{0.39611271f, 0.563008845f},
-std::array<float,2>{0.544168234f, 0.0898166448f},
-std::array<float,2>{0.268261552f, 0.161640108f},
-std::array<float,2>{0.699822009f, 0.638667703f},
-std::array<float,2>{0.163624629f, 0.751716256f},
-std::array<float,2>{0.9748891f, 0.394556075f},
-std::array<float,2>{0.202755958f, 0.055043675f},
-std::array<float,2>{0.916800678f, 0.546776831f},
-std::array<float,2>{0.335737079f, 0.93804419f},
-std::array<float,2>{0.634249449f, 0.316065639f},
-std::array<float,2>{0.486669838f, 0.477031142f},
-std::array<float,2>{0.58642447f, 0.826676726f},
-std::array<float,2>{0.0842427611f, 0.714220047f},
-std::array<float,2>{0.857291937f, 0.214390382f},
-std::array<float,2>{0.00630710134f, 0.454191208f},
-std::array<float,2>{0.751907289f, 0.847771049f},
-std::array<float,2>{0.399219006f, 0.726025641f},
-std::array<float,2>{0.533497155f, 0.248117521f},
-std::array<float,2>{0.278750151f, 0.0294601452f},
-std::array<float,2>{0.68929863f, 0.512891829f},
-std::array<float,2>{0.169830665f, 0.982391059f},
-std::array<float,2>{0.983855903f, 0.368997782f},
-std::array<float,2>{0.191331893f, 0.129774332f},
-std::array<float,2>{0.909580112f, 0.676870346f},
-std::array<float,2>{0.336365163f, 0.796264052f},
-std::array<float,2>{0.628433347f, 0.412378311f},
-std::array<float,2>{0.495069832f, 0.303139359f},
-std::array<float,2>{0.585063517f, 0.919150174f},
-std::array<float,2>{0.0926676244f, 0.607126892f},
-std::array<float,2>{0.849997938f, 0.123768955f},
-std::array<float,2>{0.135316536f, 0.321997613f},
-std::array<float,2>{0.958994269f, 0.952120602f},
-std::array<float,2>{0.311646193f, 0.536166012f},
-std::array<float,2>{0.747215986f, 0.0532215536f},
-std::array<float,2>{0.433528394f, 0.210846111f},
-std::array<float,2>{0.524013877f, 0.707196116f},
-std::array<float,2>{0.0346006043f, 0.816216528f},
-std::array<float,2>{0.787289977f, 0.472019166f},
-std::array<float,2>{0.114627972f, 0.0839195251f},
-std::array<float,2>{0.838864446f, 0.572197199f},
-std::array<float,2>{0.448288083f, 0.900876641f},
-std::array<float,2>{0.618312001f, 0.254627705f},
-std::array<float,2>{0.353796959f, 0.405727416f},
-std::array<float,2>{0.682580173f, 0.763097167f},
-std::array<float,2>{0.244713023f, 0.627602696f},
-std::array<float,2>{0.901036024f, 0.16645363f},
-std::array<float,2>{0.224680915f, 0.427512974f},
-std::array<float,2>{0.8820526f, 0.79720974f},
-std::array<float,2>{0.3610605f, 0.67020756f},
-std::array<float,2>{0.67111659f, 0.15075995f},
-std::array<float,2>{0.456997633f, 0.102614149f},
-std::array<float,2>{0.59691304f, 0.624268591f},
-std::array<float,2>{0.0938583389f, 0.92422545f},
-std::array<float,2>{0.825303376f, 0.296391338f},
-std::array<float,2>{0.0530855022f, 0.227591187f},
-std::array<float,2>{0.806224585f, 0.738756418f},
-std::array<float,2>{0.417339385f, 0.862965345f},
-std::array<float,2>{0.501503289f, 0.442483842f},
-std::array<float,2>{0.29445374f, 0.355053782f},
-std::array<float,2>{0.720444322f, 0.999951065f},
-std::array<float,2>{0.151636481f, 0.518173695f},
-std::array<float,2>{0.946185231f, 0.00757989613f},
-std::array<float,2>{0.0652305111f, 0.279987633f},
-std::array<float,2>{0.869789004f, 0.876998305f},
-std::array<float,2>{0.481732041f, 0.579356372f},
-std::array<float,2>{0.572799027f, 0.0724009648f},
-std::array<float,2>{0.322128773f, 0.180953652f},
-std::array<float,2>{0.647301078f, 0.655808747f},
-std::array<float,2>{0.216046378f, 0.778581321f},
-std::array<float,2>{0.92235595f, 0.38935104f},
-std::array<float,2>{0.178246036f, 0.0462072268f},
-std::array<float,2>{0.988972485f, 0.561263204f},
-std::array<float,2>{0.264614582f, 0.960129559f},
-std::array<float,2>{0.707177162f, 0.342924982f},
-std::array<float,2>{0.385361403f, 0.495326519f},
-std::array<float,2>{0.554632187f, 0.842798889f},
-std::array<float,2>{0.0247691628f, 0.695353329f},
-std::array<float,2>{0.776797771f, 0.200094268f},
-std::array<float,2>{0.106055371f, 0.3821477f},
-std::array<float,2>{0.818332911f, 0.766396523f},
-std::array<float,2>{0.464456171f, 0.645332813f},
-std::array<float,2>{0.605480254f, 0.179542363f},
-std::array<float,2>{0.374097109f, 0.0668810979f},
-std::array<float,2>{0.663899839f, 0.587845027f},
-std::array<float,2>{0.233944133f, 0.887222171f},
-std::array<float,2>{0.888398588f, 0.266684979f},
-std::array<float,2>{0.142965943f, 0.190868646f},
-std::array<float,2>{0.943461776f, 0.69116199f},
-std::array<float,2>{0.286002308f, 0.831813812f},
-std::array<float,2>{0.733418643f, 0.486295104f},
-std::array<float,2>{0.409660012f, 0.330625623f},
-std::array<float,2>{0.508794725f, 0.966888785f},
-std::array<float,2>{0.0615404062f, 0.551526964f},
-std::array<float,2>{0.80451405f, 0.0338183343f},
-std::array<float,2>{0.209199488f, 0.283660829f},
-std::array<float,2>{0.933656991f, 0.930569768f},
-std::array<float,2>{0.320128441f, 0.611436725f},
-std::array<float,2>{0.64891398f, 0.101102792f},
-std::array<float,2>{0.471661538f, 0.142822877f},
-std::array<float,2>{0.5661847f, 0.661266863f},
-std::array<float,2>{0.0740637854f, 0.806237161f},
-std::array<float,2>{0.863672376f, 0.433852106f},
-std::array<float,2>{0.0192930009f, 0.0149556966f},
-std::array<float,2>{0.768458724f, 0.530471683f},
-std::array<float,2>{0.375058651f, 0.986614227f},
-std::array<float,2>{0.562215805f, 0.346470326f},
-std::array<float,2>{0.254260629f, 0.452656329f},
-std::array<float,2>{0.71113044f, 0.873681724f},
-std::array<float,2>{0.18469964f, 0.745943129f},
-std::array<float,2>{0.993381143f, 0.223034829f},
-std::array<float,2>{0.162797317f, 0.479337424f},
-std::array<float,2>{0.975620866f, 0.82602638f},
-std::array<float,2>{0.269396126f, 0.711881638f},
-std::array<float,2>{0.700821877f, 0.211935624f},
-std::array<float,2>{0.395256251f, 0.0580941476f},
-std::array<float,2>{0.543851554f, 0.543705583f},
-std::array<float,2>{0.0103221545f, 0.941398799f},
-std::array<float,2>{0.759036183f, 0.313742042f},
-std::array<float,2>{0.0851234123f, 0.16243422f},
-std::array<float,2>{0.855931103f, 0.638762772f},
-std::array<float,2>{0.487814218f, 0.753147662f},
-std::array<float,2>{0.587885916f, 0.397731364f},
-std::array<float,2>{0.33465901f, 0.258802325f},
-std::array<float,2>{0.632940948f, 0.896303713f},
-std::array<float,2>{0.201420978f, 0.56474793f},
-std::array<float,2>{0.917888403f, 0.0876605734f},
-std::array<float,2>{0.0415499061f, 0.360430717f},
-std::array<float,2>{0.792477012f, 0.971237481f},
-std::array<float,2>{0.426147461f, 0.503700793f},
-std::array<float,2>{0.521340966f, 0.0170528069f},
-std::array<float,2>{0.304293811f, 0.238954708f},
-std::array<float,2>{0.737732232f, 0.726627707f},
-std::array<float,2>{0.129217058f, 0.85619545f},
-std::array<float,2>{0.964367747f, 0.463392794f},
-std::array<float,2>{0.237645254f, 0.11052084f},
-std::array<float,2>{0.897935092f, 0.599491656f},
-std::array<float,2>{0.349128634f, 0.907595694f},
-std::array<float,2>{0.6723786f, 0.308872104f},
-std::array<float,2>{0.443201482f, 0.421299487f},
-std::array<float,2>{0.615574062f, 0.783308685f},
-std::array<float,2>{0.124016821f, 0.679765522f},
-std::array<float,2>{0.83363378f, 0.1373557f},
-std::array<float,2>{0.0552765988f, 0.410150379f},
-std::array<float,2>{0.80036211f, 0.792489827f},
-std::array<float,2>{0.413514048f, 0.674474418f},
-std::array<float,2>{0.514615119f, 0.126254216f},
-std::array<float,2>{0.284841627f, 0.118832633f},
-std::array<float,2>{0.72857058f, 0.601756871f},
-std::array<float,2>{0.147360504f, 0.914307654f},
-std::array<float,2>{0.939957857f, 0.297901034f},
-std::array<float,2>{0.228578061f, 0.242408827f},
-std::array<float,2>{0.884809136f, 0.7206375f},
-std::array<float,2>{0.369442165f, 0.846314013f},
-std::array<float,2>{0.65830797f, 0.458473891f},
-std::array<float,2>{0.468598604f, 0.37196064f},
-std::array<float,2>{0.604871988f, 0.977833569f},
-std::array<float,2>{0.103730448f, 0.50815326f},
-std::array<float,2>{0.813658416f, 0.0260049682f},
-std::array<float,2>{0.179761365f, 0.252079397f},
-std::array<float,2>{0.997938931f, 0.903473735f},
-std::array<float,2>{0.251997888f, 0.574669957f},
-std::array<float,2>{0.714933515f, 0.0795235261f},
-std::array<float,2>{0.380588204f, 0.168728352f},
-std::array<float,2>{0.557895958f, 0.631623209f},
-std::array<float,2>{0.0230979752f, 0.75982666f},
-std::array<float,2>{0.773390293f, 0.39984268f},
-std::array<float,2>{0.0771469921f, 0.0506730601f},
-std::array<float,2>{0.862272084f, 0.532563567f},
-std::array<float,2>{0.476186275f, 0.948761702f},
-std::array<float,2>{0.569613814f, 0.325784236f},
-std::array<float,2>{0.315057576f, 0.474021405f},
-std::array<float,2>{0.655448735f, 0.818118632f},
-std::array<float,2>{0.203727469f, 0.70539856f},
-std::array<float,2>{0.931316376f, 0.205516741f},
-std::array<float,2>{0.195660129f, 0.438998878f},
-std::array<float,2>{0.921330988f, 0.866073191f},
-std::array<float,2>{0.331065416f, 0.734480441f},
-std::array<float,2>{0.639096797f, 0.233476087f},
-std::array<float,2>{0.489629447f, 0.00371528999f},
-std::array<float,2>{0.593247235f, 0.522020459f},
-std::array<float,2>{0.0797813833f, 0.993592024f},
-std::array<float,2>{0.854046106f, 0.357705116f},
-std::array<float,2>{0.0153531879f, 0.15348199f},
-std::array<float,2>{0.762431502f, 0.666968167f},
-std::array<float,2>{0.390706778f, 0.803123355f},
-std::array<float,2>{0.542286634f, 0.424159914f},
-std::array<float,2>{0.26993683f, 0.290427804f},
-std::array<float,2>{0.696683526f, 0.92685008f},
-std::array<float,2>{0.159961253f, 0.620828032f},
-std::array<float,2>{0.970267236f, 0.10924346f},
-std::array<float,2>{0.119611345f, 0.336879075f},
-std::array<float,2>{0.831472278f, 0.955064714f},
-std::array<float,2>{0.441084415f, 0.555462182f},
-std::array<float,2>{0.612638891f, 0.0403845832f},
-std::array<float,2>{0.345163107f, 0.197715253f},
-std::array<float,2>{0.675805748f, 0.702694416f},
-std::array<float,2>{0.240257517f, 0.835988879f},
-std::array<float,2>{0.891499579f, 0.496769488f},
-std::array<float,2>{0.128340393f, 0.0775166228f},
-std::array<float,2>{0.966137886f, 0.58238256f},
-std::array<float,2>{0.297785729f, 0.882757723f},
-std::array<float,2>{0.738541067f, 0.276703507f},
-std::array<float,2>{0.424301535f, 0.386114568f},
-std::array<float,2>{0.516839862f, 0.775032163f},
-std::array<float,2>{0.044493597f, 0.649450243f},
-std::array<float,2>{0.793616116f, 0.187247679f},
-std::array<float,2>{0.0894353241f, 0.488360584f},
-std::array<float,2>{0.846213162f, 0.834999382f},
-std::array<float,2>{0.499632567f, 0.694299996f},
-std::array<float,2>{0.580693841f, 0.192382678f},
-std::array<float,2>{0.340173185f, 0.0386828259f},
-std::array<float,2>{0.631757557f, 0.548365355f},
-std::array<float,2>{0.193339929f, 0.961712658f},
-std::array<float,2>{0.912300408f, 0.33255741f},
-std::array<float,2>{0.164429799f, 0.174599186f},
-std::array<float,2>{0.979498684f, 0.644034147f},
-std::array<float,2>{0.276172966f, 0.772320509f},
-std::array<float,2>{0.691865623f, 0.37509042f},
-std::array<float,2>{0.403476119f, 0.271236956f},
-std::array<float,2>{0.539038122f, 0.884172857f},
-std::array<float,2>{0.000421789911f, 0.591449261f},
-std::array<float,2>{0.757638454f, 0.062825948f},
-std::array<float,2>{0.248314932f, 0.349729389f},
-std::array<float,2>{0.904754281f, 0.988849103f},
-std::array<float,2>{0.358464152f, 0.526956618f},
-std::array<float,2>{0.684044957f, 0.00835830905f},
-std::array<float,2>{0.449788153f, 0.220501155f},
-std::array<float,2>{0.623470485f, 0.748440981f},
-std::array<float,2>{0.110630721f, 0.869226933f},
-std::array<float,2>{0.840217173f, 0.447405398f},
-std::array<float,2>{0.0358843952f, 0.0949957222f},
-std::array<float,2>{0.782160282f, 0.617051959f},
-std::array<float,2>{0.434433788f, 0.937072754f},
-std::array<float,2>{0.529296398f, 0.285237581f},
-std::array<float,2>{0.308506608f, 0.431024551f},
-std::array<float,2>{0.743396163f, 0.81121999f},
-std::array<float,2>{0.137391135f, 0.656830728f},
-std::array<float,2>{0.955883682f, 0.145112202f},
-std::array<float,2>{0.153410912f, 0.392623246f},
-std::array<float,2>{0.951361179f, 0.754411101f},
-std::array<float,2>{0.290388793f, 0.634600699f},
-std::array<float,2>{0.723181486f, 0.159549773f},
-std::array<float,2>{0.419995368f, 0.0932833329f},
-std::array<float,2>{0.505798161f, 0.569442689f},
-std::array<float,2>{0.0475923717f, 0.891780436f},
-std::array<float,2>{0.809165299f, 0.261799783f},
-std::array<float,2>{0.101107478f, 0.215658054f},
-std::array<float,2>{0.82125926f, 0.716891706f},
-std::array<float,2>{0.460784644f, 0.821528018f},
-std::array<float,2>{0.60009712f, 0.482008606f},
-std::array<float,2>{0.367170811f, 0.317191899f},
-std::array<float,2>{0.667959988f, 0.944880068f},
-std::array<float,2>{0.221049786f, 0.542069435f},
-std::array<float,2>{0.878896832f, 0.0592929088f},
-std::array<float,2>{0.027884217f, 0.306563675f},
-std::array<float,2>{0.777674019f, 0.913986325f},
-std::array<float,2>{0.388653606f, 0.597645938f},
-std::array<float,2>{0.548619926f, 0.11412707f},
-std::array<float,2>{0.257983059f, 0.135227397f},
-std::array<float,2>{0.703976214f, 0.683885276f},
-std::array<float,2>{0.172901243f, 0.786171913f},
-std::array<float,2>{0.985960245f, 0.414974988f},
-std::array<float,2>{0.214248419f, 0.0208902285f},
-std::array<float,2>{0.929436207f, 0.506713986f},
-std::array<float,2>{0.324984193f, 0.974265218f},
-std::array<float,2>{0.642429531f, 0.366448998f},
-std::array<float,2>{0.47674793f, 0.465640336f},
-std::array<float,2>{0.57571131f, 0.852698326f},
-std::array<float,2>{0.0688232109f, 0.731140196f},
-std::array<float,2>{0.873869002f, 0.235027105f},
-std::array<float,2>{0.0325043574f, 0.469240218f},
-std::array<float,2>{0.786575019f, 0.812927544f},
-std::array<float,2>{0.430152595f, 0.710698366f},
-std::array<float,2>{0.52702415f, 0.207136855f},
-std::array<float,2>{0.309125632f, 0.0526833758f},
-std::array<float,2>{0.74943912f, 0.537936568f},
-std::array<float,2>{0.133477792f, 0.950061023f},
-std::array<float,2>{0.958107769f, 0.322548896f},
-std::array<float,2>{0.243662819f, 0.164576292f},
-std::array<float,2>{0.898617685f, 0.626571894f},
-std::array<float,2>{0.351950884f, 0.764220774f},
-std::array<float,2>{0.680232584f, 0.403553158f},
-std::array<float,2>{0.4462758f, 0.257411808f},
-std::array<float,2>{0.620498657f, 0.898897886f},
-std::array<float,2>{0.115322195f, 0.573058248f},
-std::array<float,2>{0.836528003f, 0.0857204199f},
-std::array<float,2>{0.170887232f, 0.370081931f},
-std::array<float,2>{0.980594873f, 0.983832777f},
-std::array<float,2>{0.280524105f, 0.513946354f},
-std::array<float,2>{0.691325605f, 0.0281544179f},
-std::array<float,2>{0.400395423f, 0.247717857f},
-std::array<float,2>{0.531605244f, 0.724157333f},
-std::array<float,2>{0.00405209092f, 0.850799382f},
-std::array<float,2>{0.752210855f, 0.456555396f},
-std::array<float,2>{0.0898895487f, 0.121833771f},
-std::array<float,2>{0.848709166f, 0.608468711f},
-std::array<float,2>{0.493624717f, 0.921776474f},
-std::array<float,2>{0.58311969f, 0.302159131f},
-std::array<float,2>{0.338757515f, 0.411505431f},
-std::array<float,2>{0.626720726f, 0.793937624f},
-std::array<float,2>{0.188764647f, 0.678169906f},
-std::array<float,2>{0.907493353f, 0.132616699f},
-std::array<float,2>{0.217982188f, 0.38845104f},
-std::array<float,2>{0.925760865f, 0.780016363f},
-std::array<float,2>{0.322292387f, 0.652636707f},
-std::array<float,2>{0.646340787f, 0.183341309f},
-std::array<float,2>{0.483882517f, 0.0720006973f},
-std::array<float,2>{0.570875645f, 0.580477893f},
-std::array<float,2>{0.0644258261f, 0.875285566f},
-std::array<float,2>{0.8679052f, 0.277748317f},
-std::array<float,2>{0.0254827328f, 0.202826664f},
-std::array<float,2>{0.774175525f, 0.69879806f},
-std::array<float,2>{0.384353936f, 0.841063738f},
-std::array<float,2>{0.55197382f, 0.493330598f},
-std::array<float,2>{0.263425529f, 0.341017634f},
-std::array<float,2>{0.710810006f, 0.95743984f},
-std::array<float,2>{0.176963836f, 0.559096694f},
-std::array<float,2>{0.990874469f, 0.0437659174f},
-std::array<float,2>{0.0960197002f, 0.294127285f},
-std::array<float,2>{0.826539814f, 0.922353745f},
-std::array<float,2>{0.45451653f, 0.621505797f},
-std::array<float,2>{0.595230341f, 0.104522713f},
-std::array<float,2>{0.361587495f, 0.148731664f},
-std::array<float,2>{0.669321418f, 0.669171691f},
-std::array<float,2>{0.222963274f, 0.800310552f},
-std::array<float,2>{0.879923403f, 0.428525269f},
-std::array<float,2>{0.149803132f, 0.0051112147f},
-std::array<float,2>{0.947389007f, 0.51756227f},
-std::array<float,2>{0.296485275f, 0.99744457f},
-std::array<float,2>{0.721098006f, 0.352296382f},
-std::array<float,2>{0.414816707f, 0.443892211f},
-std::array<float,2>{0.502867877f, 0.86025703f},
-std::array<float,2>{0.0520671867f, 0.74201405f},
-std::array<float,2>{0.806850195f, 0.229180321f},
-std::array<float,2>{0.071489431f, 0.437354982f},
-std::array<float,2>{0.865404963f, 0.80833298f},
-std::array<float,2>{0.469983846f, 0.662314355f},
-std::array<float,2>{0.56349349f, 0.140833795f},
-std::array<float,2>{0.317768723f, 0.0992688835f},
-std::array<float,2>{0.65076834f, 0.609472036f},
-std::array<float,2>{0.208106354f, 0.933485746f},
-std::array<float,2>{0.93641609f, 0.28236255f},
-std::array<float,2>{0.185619071f, 0.225208491f},
-std::array<float,2>{0.995561898f, 0.743823409f},
-std::array<float,2>{0.256958246f, 0.871265531f},
-std::array<float,2>{0.713311255f, 0.450262547f},
-std::array<float,2>{0.377249986f, 0.344271064f},
-std::array<float,2>{0.559753537f, 0.985946953f},
-std::array<float,2>{0.0158314593f, 0.52868259f},
-std::array<float,2>{0.766866207f, 0.0127673456f},
-std::array<float,2>{0.231761768f, 0.268548399f},
-std::array<float,2>{0.889592052f, 0.888850093f},
-std::array<float,2>{0.372547954f, 0.588061512f},
-std::array<float,2>{0.660249591f, 0.0693841055f},
-std::array<float,2>{0.462505728f, 0.177529946f},
-std::array<float,2>{0.608715475f, 0.647958994f},
-std::array<float,2>{0.109073639f, 0.769367695f},
-std::array<float,2>{0.820182562f, 0.380761564f},
-std::array<float,2>{0.0591496862f, 0.0327626802f},
-std::array<float,2>{0.801285446f, 0.554620624f},
-std::array<float,2>{0.407696784f, 0.966634631f},
-std::array<float,2>{0.509770155f, 0.329014271f},
-std::array<float,2>{0.288950682f, 0.488272727f},
-std::array<float,2>{0.731968582f, 0.829927862f},
-std::array<float,2>{0.140872598f, 0.68838197f},
-std::array<float,2>{0.942076027f, 0.187657595f},
-std::array<float,2>{0.132335216f, 0.461173177f},
-std::array<float,2>{0.961803019f, 0.858291626f},
-std::array<float,2>{0.30082193f, 0.730093241f},
-std::array<float,2>{0.734699547f, 0.242083892f},
-std::array<float,2>{0.427967489f, 0.0181090217f},
-std::array<float,2>{0.522413909f, 0.501699567f},
-std::array<float,2>{0.0404617824f, 0.969519079f},
-std::array<float,2>{0.789518476f, 0.362258732f},
-std::array<float,2>{0.121428356f, 0.139442414f},
-std::array<float,2>{0.834386587f, 0.682409167f},
-std::array<float,2>{0.443969131f, 0.782287598f},
-std::array<float,2>{0.614597082f, 0.419118524f},
-std::array<float,2>{0.351239473f, 0.311232895f},
-std::array<float,2>{0.675281346f, 0.908861518f},
-std::array<float,2>{0.236264735f, 0.600108981f},
-std::array<float,2>{0.8950665f, 0.111361891f},
-std::array<float,2>{0.00956798624f, 0.316245884f},
-std::array<float,2>{0.760171115f, 0.938353121f},
-std::array<float,2>{0.398027152f, 0.546579778f},
-std::array<float,2>{0.545794964f, 0.0548914112f},
-std::array<float,2>{0.266705543f, 0.214721784f},
-std::array<float,2>{0.702750564f, 0.714097381f},
-std::array<float,2>{0.161366999f, 0.827074587f},
-std::array<float,2>{0.974585652f, 0.476633996f},
-std::array<float,2>{0.199279636f, 0.0894543156f},
-std::array<float,2>{0.914698362f, 0.563372672f},
-std::array<float,2>{0.33320573f, 0.897888541f},
-std::array<float,2>{0.635536969f, 0.259777069f},
-std::array<float,2>{0.485639095f, 0.395002633f},
-std::array<float,2>{0.58924371f, 0.751674652f},
-std::array<float,2>{0.0834834799f, 0.638187766f},
-std::array<float,2>{0.858588576f, 0.162086233f},
-std::array<float,2>{0.0205015652f, 0.401081115f},
-std::array<float,2>{0.770082712f, 0.758568108f},
-std::array<float,2>{0.381430775f, 0.630457342f},
-std::array<float,2>{0.555241525f, 0.170203879f},
-std::array<float,2>{0.251632422f, 0.0810325816f},
-std::array<float,2>{0.717958212f, 0.578024805f},
-std::array<float,2>{0.182107672f, 0.905051231f},
-std::array<float,2>{0.999466121f, 0.250561774f},
-std::array<float,2>{0.205483869f, 0.204039097f},
-std::array<float,2>{0.931781769f, 0.70359391f},
-std::array<float,2>{0.312765419f, 0.819396436f},
-std::array<float,2>{0.654096007f, 0.4761388f},
-std::array<float,2>{0.473355293f, 0.3272205f},
-std::array<float,2>{0.567651093f, 0.946750104f},
-std::array<float,2>{0.0752622485f, 0.534104884f},
-std::array<float,2>{0.860570192f, 0.0487577505f},
-std::array<float,2>{0.145440862f, 0.300180674f},
-std::array<float,2>{0.939002693f, 0.916315258f},
-std::array<float,2>{0.282840401f, 0.604116857f},
-std::array<float,2>{0.726610482f, 0.120793551f},
-std::array<float,2>{0.411404729f, 0.12855573f},
-std::array<float,2>{0.51260376f, 0.673503399f},
-std::array<float,2>{0.0577794537f, 0.790232599f},
-std::array<float,2>{0.797030628f, 0.406389832f},
-std::array<float,2>{0.102376245f, 0.0249739215f},
-std::array<float,2>{0.815445006f, 0.509932816f},
-std::array<float,2>{0.4657709f, 0.979129136f},
-std::array<float,2>{0.601641774f, 0.373102874f},
-std::array<float,2>{0.36875692f, 0.459488541f},
-std::array<float,2>{0.658064723f, 0.844074488f},
-std::array<float,2>{0.22810854f, 0.721682787f},
-std::array<float,2>{0.884474874f, 0.24478367f},
-std::array<float,2>{0.239316955f, 0.499384642f},
-std::array<float,2>{0.894422233f, 0.838416994f},
-std::array<float,2>{0.346953183f, 0.70094347f},
-std::array<float,2>{0.678517282f, 0.196888775f},
-std::array<float,2>{0.43804267f, 0.0412894748f},
-std::array<float,2>{0.610732317f, 0.557723403f},
-std::array<float,2>{0.119107962f, 0.95609051f},
-std::array<float,2>{0.829360306f, 0.339637995f},
-std::array<float,2>{0.0461559631f, 0.184660569f},
-std::array<float,2>{0.795152843f, 0.65065217f},
-std::array<float,2>{0.423130691f, 0.777081549f},
-std::array<float,2>{0.517870247f, 0.382815361f},
-std::array<float,2>{0.298855662f, 0.275354296f},
-std::array<float,2>{0.740571797f, 0.879374146f},
-std::array<float,2>{0.126237527f, 0.584588826f},
-std::array<float,2>{0.968699396f, 0.0756491199f},
-std::array<float,2>{0.0817108527f, 0.355508894f},
-std::array<float,2>{0.851908326f, 0.994393408f},
-std::array<float,2>{0.492006809f, 0.520369172f},
-std::array<float,2>{0.59171772f, 0.000277165498f},
-std::array<float,2>{0.329184711f, 0.231916711f},
-std::array<float,2>{0.637645304f, 0.738018155f},
-std::array<float,2>{0.198008716f, 0.863653958f},
-std::array<float,2>{0.918149054f, 0.440596581f},
-std::array<float,2>{0.156653047f, 0.105550528f},
-std::array<float,2>{0.971144855f, 0.618586957f},
-std::array<float,2>{0.271777183f, 0.928768814f},
-std::array<float,2>{0.697549939f, 0.291877478f},
-std::array<float,2>{0.394043803f, 0.423439682f},
-std::array<float,2>{0.540225506f, 0.801033437f},
-std::array<float,2>{0.0132708503f, 0.665884137f},
-std::array<float,2>{0.76529938f, 0.154893935f},
-std::array<float,2>{0.112064019f, 0.44533971f},
-std::array<float,2>{0.843538225f, 0.867583334f},
-std::array<float,2>{0.451414466f, 0.746410728f},
-std::array<float,2>{0.622077644f, 0.220977589f},
-std::array<float,2>{0.356276184f, 0.011714953f},
-std::array<float,2>{0.68633765f, 0.524975657f},
-std::array<float,2>{0.246097326f, 0.990837336f},
-std::array<float,2>{0.903007805f, 0.34898293f},
-std::array<float,2>{0.138845637f, 0.148024619f},
-std::array<float,2>{0.953505099f, 0.660000682f},
-std::array<float,2>{0.304763079f, 0.809262574f},
-std::array<float,2>{0.744673133f, 0.433537722f},
-std::array<float,2>{0.436617523f, 0.289013624f},
-std::array<float,2>{0.529710114f, 0.934966445f},
-std::array<float,2>{0.0378760248f, 0.614826262f},
-std::array<float,2>{0.785150111f, 0.0967683494f},
-std::array<float,2>{0.194796592f, 0.334462732f},
-std::array<float,2>{0.912003815f, 0.964152753f},
-std::array<float,2>{0.34268114f, 0.549992621f},
-std::array<float,2>{0.630712807f, 0.0358757339f},
-std::array<float,2>{0.497026503f, 0.193752155f},
-std::array<float,2>{0.578305662f, 0.692498922f},
-std::array<float,2>{0.0859852135f, 0.832223177f},
-std::array<float,2>{0.844076753f, 0.491553307f},
-std::array<float,2>{0.00279653701f, 0.0657349303f},
-std::array<float,2>{0.754305422f, 0.592597306f},
-std::array<float,2>{0.404760212f, 0.884905338f},
-std::array<float,2>{0.536215544f, 0.271685153f},
-std::array<float,2>{0.273992181f, 0.378748983f},
-std::array<float,2>{0.694028795f, 0.770632803f},
-std::array<float,2>{0.167773366f, 0.641230702f},
-std::array<float,2>{0.976624668f, 0.173188493f},
-std::array<float,2>{0.174273387f, 0.417794168f},
-std::array<float,2>{0.98680383f, 0.787931859f},
-std::array<float,2>{0.260755032f, 0.686375022f},
-std::array<float,2>{0.705337644f, 0.13420476f},
-std::array<float,2>{0.389378577f, 0.116178393f},
-std::array<float,2>{0.549628079f, 0.594038546f},
-std::array<float,2>{0.029806938f, 0.910515368f},
-std::array<float,2>{0.779328227f, 0.30792591f},
-std::array<float,2>{0.0677337945f, 0.238105461f},
-std::array<float,2>{0.872009873f, 0.733047009f},
-std::array<float,2>{0.480126828f, 0.854587078f},
-std::array<float,2>{0.576316714f, 0.468220979f},
-std::array<float,2>{0.326471508f, 0.36449343f},
-std::array<float,2>{0.644031882f, 0.976097167f},
-std::array<float,2>{0.212889373f, 0.5053249f},
-std::array<float,2>{0.926713705f, 0.0231836308f},
-std::array<float,2>{0.0505697168f, 0.265336245f},
-std::array<float,2>{0.811774433f, 0.894216359f},
-std::array<float,2>{0.419587791f, 0.566712439f},
-std::array<float,2>{0.507476807f, 0.0900657177f},
-std::array<float,2>{0.292082995f, 0.15764913f},
-std::array<float,2>{0.724677742f, 0.636277854f},
-std::array<float,2>{0.156238213f, 0.756682515f},
-std::array<float,2>{0.949355423f, 0.391413301f},
-std::array<float,2>{0.219429478f, 0.0612462386f},
-std::array<float,2>{0.876669109f, 0.539439499f},
-std::array<float,2>{0.365056992f, 0.941499591f},
-std::array<float,2>{0.664074898f, 0.318986744f},
-std::array<float,2>{0.457877278f, 0.482740283f},
-std::array<float,2>{0.597780883f, 0.822332799f},
-std::array<float,2>{0.0982570574f, 0.715756834f},
-std::array<float,2>{0.822789848f, 0.218643084f},
-std::array<float,2>{0.0514799133f, 0.442339242f},
-std::array<float,2>{0.808027446f, 0.861718416f},
-std::array<float,2>{0.415922374f, 0.739512682f},
-std::array<float,2>{0.503708184f, 0.226823702f},
-std::array<float,2>{0.294960648f, 0.00653066533f},
-std::array<float,2>{0.721916258f, 0.519158006f},
-std::array<float,2>{0.148960054f, 0.998862863f},
-std::array<float,2>{0.948773146f, 0.35405153f},
-std::array<float,2>{0.224102944f, 0.152279153f},
-std::array<float,2>{0.879205227f, 0.671846688f},
-std::array<float,2>{0.362703502f, 0.798432171f},
-std::array<float,2>{0.668230534f, 0.426438361f},
-std::array<float,2>{0.453698605f, 0.295358002f},
-std::array<float,2>{0.59441632f, 0.925247192f},
-std::array<float,2>{0.0974573269f, 0.623670816f},
-std::array<float,2>{0.827762842f, 0.102347918f},
-std::array<float,2>{0.17675063f, 0.342628002f},
-std::array<float,2>{0.991786063f, 0.959615648f},
-std::array<float,2>{0.262012154f, 0.56235832f},
-std::array<float,2>{0.709625185f, 0.0457033291f},
-std::array<float,2>{0.383758247f, 0.200619608f},
-std::array<float,2>{0.551435411f, 0.696634829f},
-std::array<float,2>{0.0263969339f, 0.842196405f},
-std::array<float,2>{0.775039136f, 0.494196206f},
-std::array<float,2>{0.063137576f, 0.0732942075f},
-std::array<float,2>{0.868264318f, 0.578596771f},
-std::array<float,2>{0.482453942f, 0.878814638f},
-std::array<float,2>{0.571670234f, 0.280979693f},
-std::array<float,2>{0.323629498f, 0.390191883f},
-std::array<float,2>{0.644713819f, 0.778024614f},
-std::array<float,2>{0.217589706f, 0.655074418f},
-std::array<float,2>{0.924511969f, 0.180564582f},
-std::array<float,2>{0.188446149f, 0.413321614f},
-std::array<float,2>{0.906505585f, 0.795380414f},
-std::array<float,2>{0.339344084f, 0.675976455f},
-std::array<float,2>{0.625179172f, 0.13018924f},
-std::array<float,2>{0.493010849f, 0.124135435f},
-std::array<float,2>{0.582334459f, 0.605637431f},
-std::array<float,2>{0.0911789089f, 0.918698549f},
-std::array<float,2>{0.848108828f, 0.303867757f},
-std::array<float,2>{0.00495975744f, 0.249178976f},
-std::array<float,2>{0.753205299f, 0.724962533f},
-std::array<float,2>{0.401894897f, 0.849147379f},
-std::array<float,2>{0.532563686f, 0.453341872f},
-std::array<float,2>{0.279710263f, 0.367742807f},
-std::array<float,2>{0.690007806f, 0.98140353f},
-std::array<float,2>{0.171579719f, 0.512275398f},
-std::array<float,2>{0.981886804f, 0.0304950532f},
-std::array<float,2>{0.116974197f, 0.255739063f},
-std::array<float,2>{0.837674737f, 0.901795983f},
-std::array<float,2>{0.446679085f, 0.570712507f},
-std::array<float,2>{0.620005131f, 0.0820446312f},
-std::array<float,2>{0.352657229f, 0.167684793f},
-std::array<float,2>{0.681051135f, 0.628557265f},
-std::array<float,2>{0.242274702f, 0.761907935f},
-std::array<float,2>{0.899886012f, 0.404637039f},
-std::array<float,2>{0.134513468f, 0.0542480461f},
-std::array<float,2>{0.957297087f, 0.536065221f},
-std::array<float,2>{0.310304463f, 0.952852964f},
-std::array<float,2>{0.748744845f, 0.320412785f},
-std::array<float,2>{0.431434274f, 0.471446395f},
-std::array<float,2>{0.525844872f, 0.814932644f},
-std::array<float,2>{0.0319925286f, 0.708059311f},
-std::array<float,2>{0.785766363f, 0.209249288f},
-std::array<float,2>{0.0827056766f, 0.397131026f},
-std::array<float,2>{0.858158648f, 0.7522102f},
-std::array<float,2>{0.484459341f, 0.640407383f},
-std::array<float,2>{0.588641822f, 0.16322431f},
-std::array<float,2>{0.332643569f, 0.0866600797f},
-std::array<float,2>{0.636078f, 0.565531611f},
-std::array<float,2>{0.201046899f, 0.895334423f},
-std::array<float,2>{0.915867031f, 0.258731931f},
-std::array<float,2>{0.160427168f, 0.21164237f},
-std::array<float,2>{0.972771287f, 0.712368131f},
-std::array<float,2>{0.26583007f, 0.824558794f},
-std::array<float,2>{0.701611638f, 0.479551554f},
-std::array<float,2>{0.397047132f, 0.313040853f},
-std::array<float,2>{0.546712816f, 0.940197587f},
-std::array<float,2>{0.0085205799f, 0.544068396f},
-std::array<float,2>{0.761042297f, 0.0568906926f},
-std::array<float,2>{0.23470138f, 0.310453683f},
-std::array<float,2>{0.895566881f, 0.906797707f},
-std::array<float,2>{0.349818587f, 0.598533273f},
-std::array<float,2>{0.674355209f, 0.109564431f},
-std::array<float,2>{0.445025653f, 0.138617039f},
-std::array<float,2>{0.613297343f, 0.680778801f},
-std::array<float,2>{0.12251801f, 0.784496069f},
-std::array<float,2>{0.835358441f, 0.42010653f},
-std::array<float,2>{0.0399808101f, 0.0165050216f},
-std::array<float,2>{0.790892124f, 0.502706945f},
-std::array<float,2>{0.429533511f, 0.972609818f},
-std::array<float,2>{0.523417234f, 0.36000818f},
-std::array<float,2>{0.302177101f, 0.464254647f},
-std::array<float,2>{0.735808015f, 0.856642902f},
-std::array<float,2>{0.131221533f, 0.727676928f},
-std::array<float,2>{0.961963177f, 0.240072429f},
-std::array<float,2>{0.141849756f, 0.485322058f},
-std::array<float,2>{0.942739964f, 0.830979466f},
-std::array<float,2>{0.287921965f, 0.689638615f},
-std::array<float,2>{0.731114805f, 0.190369502f},
-std::array<float,2>{0.407178342f, 0.0351367258f},
-std::array<float,2>{0.511017084f, 0.55199796f},
-std::array<float,2>{0.0602529161f, 0.968356788f},
-std::array<float,2>{0.802328348f, 0.331564546f},
-std::array<float,2>{0.108266659f, 0.178140029f},
-std::array<float,2>{0.818913341f, 0.646124661f},
-std::array<float,2>{0.461033165f, 0.767060399f},
-std::array<float,2>{0.608223021f, 0.381538063f},
-std::array<float,2>{0.372056961f, 0.266004592f},
-std::array<float,2>{0.661196053f, 0.888399124f},
-std::array<float,2>{0.231015489f, 0.585970998f},
-std::array<float,2>{0.89013207f, 0.0679149702f},
-std::array<float,2>{0.017377289f, 0.346788615f},
-std::array<float,2>{0.765918553f, 0.98739475f},
-std::array<float,2>{0.37851882f, 0.529854953f},
-std::array<float,2>{0.55935353f, 0.01369764f},
-std::array<float,2>{0.256299555f, 0.223928615f},
-std::array<float,2>{0.714136004f, 0.744961739f},
-std::array<float,2>{0.186604992f, 0.874279618f},
-std::array<float,2>{0.994885445f, 0.451585472f},
-std::array<float,2>{0.2079864f, 0.10032475f},
-std::array<float,2>{0.936656654f, 0.612564027f},
-std::array<float,2>{0.316718787f, 0.931359947f},
-std::array<float,2>{0.65219146f, 0.284582645f},
-std::array<float,2>{0.469095975f, 0.435087025f},
-std::array<float,2>{0.563391268f, 0.804758906f},
-std::array<float,2>{0.0707196519f, 0.660468102f},
-std::array<float,2>{0.866927564f, 0.143878073f},
-std::array<float,2>{0.0122398082f, 0.425199777f},
-std::array<float,2>{0.764324605f, 0.80467701f},
-std::array<float,2>{0.393456459f, 0.667846859f},
-std::array<float,2>{0.53913039f, 0.153217584f},
-std::array<float,2>{0.273275763f, 0.108173124f},
-std::array<float,2>{0.698934793f, 0.620098889f},
-std::array<float,2>{0.158038676f, 0.925994098f},
-std::array<float,2>{0.972299278f, 0.289652169f},
-std::array<float,2>{0.198589072f, 0.232839897f},
-std::array<float,2>{0.919517517f, 0.736320794f},
-std::array<float,2>{0.328357011f, 0.866875231f},
-std::array<float,2>{0.638219059f, 0.438039809f},
-std::array<float,2>{0.490420163f, 0.358984649f},
-std::array<float,2>{0.590651929f, 0.992382526f},
-std::array<float,2>{0.0803892314f, 0.5233863f},
-std::array<float,2>{0.852719069f, 0.00229871273f},
-std::array<float,2>{0.125550508f, 0.275948614f},
-std::array<float,2>{0.967069507f, 0.881029308f},
-std::array<float,2>{0.300351351f, 0.583524942f},
-std::array<float,2>{0.742028654f, 0.0763071701f},
-std::array<float,2>{0.422020376f, 0.185905829f},
-std::array<float,2>{0.518902004f, 0.649216175f},
-std::array<float,2>{0.0457078405f, 0.773493648f},
-std::array<float,2>{0.796315789f, 0.385067761f},
-std::array<float,2>{0.118074141f, 0.0391021222f},
-std::array<float,2>{0.828374267f, 0.555702507f},
-std::array<float,2>{0.438702852f, 0.953393579f},
-std::array<float,2>{0.610002875f, 0.337797344f},
-std::array<float,2>{0.345801532f, 0.497328788f},
-std::array<float,2>{0.679207325f, 0.837233603f},
-std::array<float,2>{0.238713577f, 0.701304138f},
-std::array<float,2>{0.892813563f, 0.199162468f},
-std::array<float,2>{0.227083713f, 0.457676709f},
-std::array<float,2>{0.883271158f, 0.846974313f},
-std::array<float,2>{0.367314726f, 0.719533384f},
-std::array<float,2>{0.656763434f, 0.243781477f},
-std::array<float,2>{0.466465861f, 0.0265376382f},
-std::array<float,2>{0.603327394f, 0.509113133f},
-std::array<float,2>{0.102643773f, 0.977221012f},
-std::array<float,2>{0.815233886f, 0.372622222f},
-std::array<float,2>{0.0571757294f, 0.125945032f},
-std::array<float,2>{0.798721492f, 0.675300181f},
-std::array<float,2>{0.41020754f, 0.791062534f},
-std::array<float,2>{0.513267219f, 0.40877068f},
-std::array<float,2>{0.281919569f, 0.297643721f},
-std::array<float,2>{0.728280902f, 0.915067136f},
-std::array<float,2>{0.146424055f, 0.603143156f},
-std::array<float,2>{0.937917411f, 0.117614336f},
-std::array<float,2>{0.0742691532f, 0.324848831f},
-std::array<float,2>{0.859701872f, 0.948062181f},
-std::array<float,2>{0.473920345f, 0.531804502f},
-std::array<float,2>{0.567263722f, 0.0497017764f},
-std::array<float,2>{0.314092368f, 0.206169218f},
-std::array<float,2>{0.653290272f, 0.706079185f},
-std::array<float,2>{0.20632112f, 0.817024946f},
-std::array<float,2>{0.933425665f, 0.473424554f},
-std::array<float,2>{0.183355466f, 0.0789147839f},
-std::array<float,2>{0.998541415f, 0.575696588f},
-std::array<float,2>{0.250714868f, 0.902644157f},
-std::array<float,2>{0.717227101f, 0.253520131f},
-std::array<float,2>{0.382546723f, 0.39868933f},
-std::array<float,2>{0.55628258f, 0.761456907f},
-std::array<float,2>{0.0211614389f, 0.631893575f},
-std::array<float,2>{0.770795703f, 0.169016525f},
-std::array<float,2>{0.0986451507f, 0.480729908f},
-std::array<float,2>{0.823523879f, 0.820884943f},
-std::array<float,2>{0.458142698f, 0.718083799f},
-std::array<float,2>{0.599217653f, 0.215962008f},
-std::array<float,2>{0.363432407f, 0.0599416643f},
-std::array<float,2>{0.665458679f, 0.541594326f},
-std::array<float,2>{0.22007978f, 0.943818331f},
-std::array<float,2>{0.875053525f, 0.317529947f},
-std::array<float,2>{0.154489934f, 0.159079194f},
-std::array<float,2>{0.951028228f, 0.633558273f},
-std::array<float,2>{0.291956216f, 0.755244136f},
-std::array<float,2>{0.725617409f, 0.393903702f},
-std::array<float,2>{0.418634295f, 0.263318628f},
-std::array<float,2>{0.506599903f, 0.891100347f},
-std::array<float,2>{0.0493640006f, 0.56872952f},
-std::array<float,2>{0.810580254f, 0.0918999761f},
-std::array<float,2>{0.211761206f, 0.365757883f},
-std::array<float,2>{0.92753309f, 0.972851515f},
-std::array<float,2>{0.328080148f, 0.507104874f},
-std::array<float,2>{0.643131971f, 0.0198615883f},
-std::array<float,2>{0.478672743f, 0.23605749f},
-std::array<float,2>{0.577966452f, 0.732122064f},
-std::array<float,2>{0.0671351478f, 0.851738453f},
-std::array<float,2>{0.872806013f, 0.466716111f},
-std::array<float,2>{0.0308560822f, 0.114581503f},
-std::array<float,2>{0.780490279f, 0.596269608f},
-std::array<float,2>{0.39009285f, 0.912488699f},
-std::array<float,2>{0.550169051f, 0.30566287f},
-std::array<float,2>{0.259901792f, 0.415105283f},
-std::array<float,2>{0.706923246f, 0.786094189f},
-std::array<float,2>{0.175528198f, 0.68515873f},
-std::array<float,2>{0.987472296f, 0.135938391f},
-std::array<float,2>{0.16639787f, 0.375992626f},
-std::array<float,2>{0.977889717f, 0.772988915f},
-std::array<float,2>{0.27453962f, 0.643183947f},
-std::array<float,2>{0.694524884f, 0.175079897f},
-std::array<float,2>{0.405712515f, 0.0636134371f},
-std::array<float,2>{0.535479009f, 0.589856982f},
-std::array<float,2>{0.00387054961f, 0.883576453f},
-std::array<float,2>{0.755025744f, 0.269656539f},
-std::array<float,2>{0.0870738551f, 0.192769021f},
-std::array<float,2>{0.845075488f, 0.694931149f},
-std::array<float,2>{0.497202933f, 0.834437788f},
-std::array<float,2>{0.579549372f, 0.489660382f},
-std::array<float,2>{0.343075752f, 0.333482414f},
-std::array<float,2>{0.629045129f, 0.962786496f},
-std::array<float,2>{0.194005281f, 0.547708809f},
-std::array<float,2>{0.910673678f, 0.0376095846f},
-std::array<float,2>{0.0390204638f, 0.286178231f},
-std::array<float,2>{0.783257127f, 0.935756564f},
-std::array<float,2>{0.436190933f, 0.615433872f},
-std::array<float,2>{0.530351162f, 0.0941491425f},
-std::array<float,2>{0.30608207f, 0.145545751f},
-std::array<float,2>{0.745234787f, 0.657246232f},
-std::array<float,2>{0.139770895f, 0.811561406f},
-std::array<float,2>{0.954560816f, 0.43016991f},
-std::array<float,2>{0.247388124f, 0.00941101741f},
-std::array<float,2>{0.904147565f, 0.525735855f},
-std::array<float,2>{0.356955379f, 0.98987478f},
-std::array<float,2>{0.686523914f, 0.350723982f},
-std::array<float,2>{0.452669352f, 0.449112594f},
-std::array<float,2>{0.621196866f, 0.870222986f},
-std::array<float,2>{0.113161631f, 0.749960303f},
-std::array<float,2>{0.842558444f, 0.219392627f},
-std::array<float,2>{0.0234613549f, 0.492864072f},
-std::array<float,2>{0.775624335f, 0.840331435f},
-std::array<float,2>{0.386211574f, 0.697969973f},
-std::array<float,2>{0.553019404f, 0.201728672f},
-std::array<float,2>{0.264660507f, 0.0442277901f},
-std::array<float,2>{0.708757222f, 0.560495853f},
-std::array<float,2>{0.179340392f, 0.958723664f},
-std::array<float,2>{0.989465177f, 0.340583056f},
-std::array<float,2>{0.215108126f, 0.181793362f},
-std::array<float,2>{0.923246562f, 0.653912067f},
-std::array<float,2>{0.320494682f, 0.780809581f},
-std::array<float,2>{0.64774543f, 0.386731535f},
-std::array<float,2>{0.481338233f, 0.278591812f},
-std::array<float,2>{0.573939502f, 0.87611115f},
-std::array<float,2>{0.0660393313f, 0.581154823f},
-std::array<float,2>{0.870883584f, 0.0708902031f},
-std::array<float,2>{0.150899366f, 0.353078693f},
-std::array<float,2>{0.947104514f, 0.996754408f},
-std::array<float,2>{0.293676645f, 0.516375959f},
-std::array<float,2>{0.719384551f, 0.00404222449f},
-std::array<float,2>{0.416648209f, 0.230179831f},
-std::array<float,2>{0.500829935f, 0.74116528f},
-std::array<float,2>{0.0544025786f, 0.860691726f},
-std::array<float,2>{0.805339456f, 0.445086688f},
-std::array<float,2>{0.0949980542f, 0.104359142f},
-std::array<float,2>{0.824530542f, 0.622753441f},
-std::array<float,2>{0.4556247f, 0.923471212f},
-std::array<float,2>{0.596098304f, 0.293338388f},
-std::array<float,2>{0.360150188f, 0.429560751f},
-std::array<float,2>{0.670382679f, 0.799015641f},
-std::array<float,2>{0.226167306f, 0.668606341f},
-std::array<float,2>{0.881810069f, 0.149443761f},
-std::array<float,2>{0.245470569f, 0.403078407f},
-std::array<float,2>{0.901820481f, 0.765335262f},
-std::array<float,2>{0.354701251f, 0.625322759f},
-std::array<float,2>{0.682680726f, 0.16522482f},
-std::array<float,2>{0.447636604f, 0.0840007514f},
-std::array<float,2>{0.617425323f, 0.573638856f},
-std::array<float,2>{0.114193358f, 0.900119841f},
-std::array<float,2>{0.839693844f, 0.256633878f},
-std::array<float,2>{0.0337333903f, 0.208175525f},
-std::array<float,2>{0.789056838f, 0.709670365f},
-std::array<float,2>{0.432322502f, 0.814304173f},
-std::array<float,2>{0.525258243f, 0.470532507f},
-std::array<float,2>{0.311419338f, 0.323784053f},
-std::array<float,2>{0.746979594f, 0.950685918f},
-std::array<float,2>{0.135953888f, 0.538533092f},
-std::array<float,2>{0.960151315f, 0.0508978143f},
-std::array<float,2>{0.0931426138f, 0.301627874f},
-std::array<float,2>{0.851291776f, 0.920363009f},
-std::array<float,2>{0.495668918f, 0.607964396f},
-std::array<float,2>{0.584213257f, 0.122390568f},
-std::array<float,2>{0.336939305f, 0.13123095f},
-std::array<float,2>{0.627595484f, 0.678810537f},
-std::array<float,2>{0.189885408f, 0.794274747f},
-std::array<float,2>{0.90855062f, 0.410203278f},
-std::array<float,2>{0.168670714f, 0.0284876227f},
-std::array<float,2>{0.982636273f, 0.515276909f},
-std::array<float,2>{0.277344316f, 0.98266983f},
-std::array<float,2>{0.687757909f, 0.370940447f},
-std::array<float,2>{0.399894893f, 0.456003577f},
-std::array<float,2>{0.534209669f, 0.850356102f},
-std::array<float,2>{0.00763329165f, 0.722864389f},
-std::array<float,2>{0.750364661f, 0.246741474f},
-std::array<float,2>{0.124841727f, 0.417972416f},
-std::array<float,2>{0.832895339f, 0.781981885f},
-std::array<float,2>{0.441703677f, 0.683104336f},
-std::array<float,2>{0.616952777f, 0.140009791f},
-std::array<float,2>{0.348220021f, 0.112617731f},
-std::array<float,2>{0.673389792f, 0.600640059f},
-std::array<float,2>{0.23643969f, 0.909602046f},
-std::array<float,2>{0.897036731f, 0.312084973f},
-std::array<float,2>{0.130167827f, 0.241087228f},
-std::array<float,2>{0.963238358f, 0.729123294f},
-std::array<float,2>{0.302989304f, 0.858546734f},
-std::array<float,2>{0.737185538f, 0.462621421f},
-std::array<float,2>{0.426990211f, 0.363175601f},
-std::array<float,2>{0.519790947f, 0.970224977f},
-std::array<float,2>{0.042549748f, 0.500942528f},
-std::array<float,2>{0.791094244f, 0.0195270553f},
-std::array<float,2>{0.202351704f, 0.260967165f},
-std::array<float,2>{0.916178167f, 0.896861672f},
-std::array<float,2>{0.335269034f, 0.56386447f},
-std::array<float,2>{0.634580016f, 0.0881122202f},
-std::array<float,2>{0.486961514f, 0.160640597f},
-std::array<float,2>{0.586860418f, 0.637103736f},
-std::array<float,2>{0.0848402902f, 0.750928879f},
-std::array<float,2>{0.856495261f, 0.395668566f},
-std::array<float,2>{0.0116603859f, 0.0560270771f},
-std::array<float,2>{0.758355141f, 0.545773149f},
-std::array<float,2>{0.395978004f, 0.939233959f},
-std::array<float,2>{0.544895649f, 0.315405726f},
-std::array<float,2>{0.267688394f, 0.477709979f},
-std::array<float,2>{0.699407756f, 0.828056335f},
-std::array<float,2>{0.163380608f, 0.713743091f},
-std::array<float,2>{0.975409031f, 0.213804066f},
-std::array<float,2>{0.183981895f, 0.450062841f},
-std::array<float,2>{0.992448568f, 0.872868598f},
-std::array<float,2>{0.254932523f, 0.742779613f},
-std::array<float,2>{0.712312758f, 0.22639589f},
-std::array<float,2>{0.376871526f, 0.0121836411f},
-std::array<float,2>{0.560604692f, 0.527636528f},
-std::array<float,2>{0.018110944f, 0.984869301f},
-std::array<float,2>{0.768944144f, 0.345146567f},
-std::array<float,2>{0.0722689852f, 0.141892359f},
-std::array<float,2>{0.864740729f, 0.663959801f},
-std::array<float,2>{0.47169435f, 0.806826651f},
-std::array<float,2>{0.564920247f, 0.436425894f},
-std::array<float,2>{0.318653077f, 0.281269491f},
-std::array<float,2>{0.649499476f, 0.931909621f},
-std::array<float,2>{0.210505962f, 0.610455394f},
-std::array<float,2>{0.93458581f, 0.0983464867f},
-std::array<float,2>{0.0612856485f, 0.329435498f},
-std::array<float,2>{0.803135335f, 0.965214074f},
-std::array<float,2>{0.408706546f, 0.553635538f},
-std::array<float,2>{0.507864833f, 0.0318997316f},
-std::array<float,2>{0.286519527f, 0.188989997f},
-std::array<float,2>{0.732984424f, 0.689374804f},
-std::array<float,2>{0.143749699f, 0.82837373f},
-std::array<float,2>{0.944979966f, 0.486636162f},
-std::array<float,2>{0.232804358f, 0.0686060339f},
-std::array<float,2>{0.887387037f, 0.589780748f},
-std::array<float,2>{0.37318328f, 0.890559018f},
-std::array<float,2>{0.66230917f, 0.268609077f},
-std::array<float,2>{0.463554412f, 0.379256666f},
-std::array<float,2>{0.607213378f, 0.767686903f},
-std::array<float,2>{0.106536537f, 0.646523535f},
-std::array<float,2>{0.817207932f, 0.176478431f},
-std::array<float,2>{0.0430356301f, 0.3838588f},
-std::array<float,2>{0.794073164f, 0.775991619f},
-std::array<float,2>{0.425294638f, 0.652248919f},
-std::array<float,2>{0.515749335f, 0.183736235f},
-std::array<float,2>{0.298013836f, 0.0748609751f},
-std::array<float,2>{0.739512622f, 0.585129857f},
-std::array<float,2>{0.127888754f, 0.879931867f},
-std::array<float,2>{0.965165436f, 0.274193317f},
-std::array<float,2>{0.241588801f, 0.196035385f},
-std::array<float,2>{0.892109156f, 0.699263155f},
-std::array<float,2>{0.344678164f, 0.839753032f},
-std::array<float,2>{0.677146077f, 0.498852164f},
-std::array<float,2>{0.440389693f, 0.338245243f},
-std::array<float,2>{0.61213553f, 0.955541015f},
-std::array<float,2>{0.120628677f, 0.557029068f},
-std::array<float,2>{0.830577314f, 0.0425681807f},
-std::array<float,2>{0.158382192f, 0.292448759f},
-std::array<float,2>{0.969041288f, 0.928347826f},
-std::array<float,2>{0.270637363f, 0.617530882f},
-std::array<float,2>{0.6959548f, 0.107331365f},
-std::array<float,2>{0.392571062f, 0.155748561f},
-std::array<float,2>{0.541712999f, 0.664375365f},
-std::array<float,2>{0.0145586208f, 0.80176878f},
-std::array<float,2>{0.763655365f, 0.42233777f},
-std::array<float,2>{0.0786445066f, 0.0016147017f},
-std::array<float,2>{0.854670405f, 0.521041214f},
-std::array<float,2>{0.488604903f, 0.995777488f},
-std::array<float,2>{0.592649817f, 0.356576413f},
-std::array<float,2>{0.330534905f, 0.439487517f},
-std::array<float,2>{0.639814258f, 0.865021884f},
-std::array<float,2>{0.196776524f, 0.737154067f},
-std::array<float,2>{0.920024455f, 0.231225252f},
-std::array<float,2>{0.204822585f, 0.474932462f},
-std::array<float,2>{0.929693937f, 0.818837702f},
-std::array<float,2>{0.316216588f, 0.704111814f},
-std::array<float,2>{0.654555082f, 0.2041035f},
-std::array<float,2>{0.475294054f, 0.0475468934f},
-std::array<float,2>{0.568381846f, 0.534244001f},
-std::array<float,2>{0.0773597732f, 0.945563555f},
-std::array<float,2>{0.862506568f, 0.326571256f},
-std::array<float,2>{0.0219704211f, 0.171394899f},
-std::array<float,2>{0.77169472f, 0.629173875f},
-std::array<float,2>{0.379207045f, 0.759447753f},
-std::array<float,2>{0.557375371f, 0.401795268f},
-std::array<float,2>{0.253324956f, 0.251349181f},
-std::array<float,2>{0.716761291f, 0.905489862f},
-std::array<float,2>{0.181575209f, 0.576475263f},
-std::array<float,2>{0.996316969f, 0.0814037099f},
-std::array<float,2>{0.105416365f, 0.374628216f},
-std::array<float,2>{0.813272476f, 0.980222404f},
-std::array<float,2>{0.46770516f, 0.510994077f},
-std::array<float,2>{0.604488313f, 0.0241449941f},
-std::array<float,2>{0.370445818f, 0.245360926f},
-std::array<float,2>{0.659534216f, 0.721660197f},
-std::array<float,2>{0.230234683f, 0.844929039f},
-std::array<float,2>{0.886185527f, 0.460460454f},
-std::array<float,2>{0.14838019f, 0.119675048f},
-std::array<float,2>{0.941025198f, 0.605392516f},
-std::array<float,2>{0.283304185f, 0.917041183f},
-std::array<float,2>{0.7302019f, 0.299120516f},
-std::array<float,2>{0.412836522f, 0.407493532f},
-std::array<float,2>{0.515602112f, 0.789975464f},
-std::array<float,2>{0.0562299155f, 0.67228961f},
-std::array<float,2>{0.799098849f, 0.127343476f},
-std::array<float,2>{0.0696918666f, 0.467271596f},
-std::array<float,2>{0.874305725f, 0.853672683f},
-std::array<float,2>{0.477549821f, 0.734167039f},
-std::array<float,2>{0.574788094f, 0.2369605f},
-std::array<float,2>{0.325749993f, 0.0217046048f},
-std::array<float,2>{0.640969694f, 0.5039801f},
-std::array<float,2>{0.213734418f, 0.975065768f},
-std::array<float,2>{0.928694963f, 0.363935143f},
-std::array<float,2>{0.172653094f, 0.133642927f},
-std::array<float,2>{0.984912574f, 0.687112153f},
-std::array<float,2>{0.259568214f, 0.788143218f},
-std::array<float,2>{0.704462588f, 0.416636437f},
-std::array<float,2>{0.387351662f, 0.306997031f},
-std::array<float,2>{0.547275722f, 0.911137819f},
-std::array<float,2>{0.0291512869f, 0.595665097f},
-std::array<float,2>{0.778516591f, 0.116976522f},
-std::array<float,2>{0.222065702f, 0.319637001f},
-std::array<float,2>{0.877502739f, 0.94251895f},
-std::array<float,2>{0.36545527f, 0.540615499f},
-std::array<float,2>{0.666794121f, 0.0621182397f},
-std::array<float,2>{0.459397942f, 0.217772484f},
-std::array<float,2>{0.600597918f, 0.716109574f},
-std::array<float,2>{0.100032248f, 0.823715806f},
-std::array<float,2>{0.821300507f, 0.484050333f},
-std::array<float,2>{0.0488270223f, 0.091263473f},
-std::array<float,2>{0.809743524f, 0.568037212f},
-std::array<float,2>{0.420952767f, 0.892699301f},
-std::array<float,2>{0.504725516f, 0.263685018f},
-std::array<float,2>{0.289379746f, 0.392193794f},
-std::array<float,2>{0.72409296f, 0.757067621f},
-std::array<float,2>{0.152681395f, 0.635267854f},
-std::array<float,2>{0.952187598f, 0.156745374f},
-std::array<float,2>{0.138332918f, 0.431899905f},
-std::array<float,2>{0.956148624f, 0.809839964f},
-std::array<float,2>{0.307222635f, 0.659117401f},
-std::array<float,2>{0.742538571f, 0.147024497f},
-std::array<float,2>{0.435106814f, 0.0963195786f},
-std::array<float,2>{0.527493119f, 0.613922179f},
-std::array<float,2>{0.0366827883f, 0.93385148f},
-std::array<float,2>{0.782659352f, 0.287383914f},
-std::array<float,2>{0.109440759f, 0.22234337f},
-std::array<float,2>{0.841546059f, 0.747598827f},
-std::array<float,2>{0.45032689f, 0.86860919f},
-std::array<float,2>{0.624500394f, 0.446330041f},
-std::array<float,2>{0.357567668f, 0.347802937f},
-std::array<float,2>{0.685424685f, 0.991983771f},
-std::array<float,2>{0.249858662f, 0.524053574f},
-std::array<float,2>{0.905688584f, 0.00996804144f},
-std::array<float,2>{0.00116174843f, 0.272822112f},
-std::array<float,2>{0.756380975f, 0.885887682f},
-std::array<float,2>{0.402486175f, 0.593523979f},
-std::array<float,2>{0.537378311f, 0.0654263124f},
-std::array<float,2>{0.276483178f, 0.171913892f},
-std::array<float,2>{0.69301337f, 0.641715348f},
-std::array<float,2>{0.165195391f, 0.770465255f},
-std::array<float,2>{0.979253352f, 0.377720684f},
-std::array<float,2>{0.191719741f, 0.0362832136f},
-std::array<float,2>{0.913791358f, 0.549414575f},
-std::array<float,2>{0.341273367f, 0.963764846f},
-std::array<float,2>{0.632035434f, 0.335107505f},
-std::array<float,2>{0.498852134f, 0.49116078f},
-std::array<float,2>{0.581282854f, 0.833330333f},
-std::array<float,2>{0.0888600647f, 0.692260027f},
-std::array<float,2>{0.847500503f, 0.19448474f},
-std::array<float,2>{0.0180482436f, 0.452048957f},
-std::array<float,2>{0.769499362f, 0.874857426f},
-std::array<float,2>{0.376097828f, 0.744297743f},
-std::array<float,2>{0.561372757f, 0.224247605f},
-std::array<float,2>{0.255655408f, 0.0145470891f},
-std::array<float,2>{0.712522626f, 0.529544115f},
-std::array<float,2>{0.18409881f, 0.988120615f},
-std::array<float,2>{0.992973447f, 0.347465277f},
-std::array<float,2>{0.210097507f, 0.144231915f},
-std::array<float,2>{0.935500026f, 0.66104275f},
-std::array<float,2>{0.319220841f, 0.805635571f},
-std::array<float,2>{0.650211811f, 0.43495661f},
-std::array<float,2>{0.472283453f, 0.285092682f},
-std::array<float,2>{0.565281093f, 0.930683851f},
-std::array<float,2>{0.0728936493f, 0.61280483f},
-std::array<float,2>{0.865094364f, 0.0999503583f},
-std::array<float,2>{0.144418329f, 0.331285894f},
-std::array<float,2>{0.944816768f, 0.968094766f},
-std::array<float,2>{0.286906809f, 0.552398682f},
-std::array<float,2>{0.732534409f, 0.0346607789f},
-std::array<float,2>{0.408587486f, 0.189469412f},
-std::array<float,2>{0.508401752f, 0.689944327f},
-std::array<float,2>{0.0607248656f, 0.830255926f},
-std::array<float,2>{0.803523839f, 0.484588444f},
-std::array<float,2>{0.107258484f, 0.0676252693f},
-std::array<float,2>{0.816622913f, 0.586639464f},
-std::array<float,2>{0.462926477f, 0.887932897f},
-std::array<float,2>{0.606501579f, 0.266538888f},
-std::array<float,2>{0.373636007f, 0.381238192f},
-std::array<float,2>{0.662833512f, 0.767148137f},
-std::array<float,2>{0.232933819f, 0.645938277f},
-std::array<float,2>{0.886787117f, 0.17861174f},
-std::array<float,2>{0.237231538f, 0.420535862f},
-std::array<float,2>{0.896829903f, 0.784727514f},
-std::array<float,2>{0.347774208f, 0.681383193f},
-std::array<float,2>{0.673096061f, 0.137957066f},
-std::array<float,2>{0.442270666f, 0.109930582f},
-std::array<float,2>{0.616392732f, 0.598086119f},
-std::array<float,2>{0.124466464f, 0.906612873f},
-std::array<float,2>{0.83229214f, 0.309975952f},
-std::array<float,2>{0.0420711897f, 0.239520237f},
-std::array<float,2>{0.791526556f, 0.728121281f},
-std::array<float,2>{0.427708447f, 0.857137442f},
-std::array<float,2>{0.520189524f, 0.464786232f},
-std::array<float,2>{0.303327262f, 0.359624773f},
-std::array<float,2>{0.736358702f, 0.972023964f},
-std::array<float,2>{0.130489096f, 0.501990914f},
-std::array<float,2>{0.963441253f, 0.0159089491f},
-std::array<float,2>{0.0841291398f, 0.25800702f},
-std::array<float,2>{0.85696739f, 0.894934475f},
-std::array<float,2>{0.486551493f, 0.566078603f},
-std::array<float,2>{0.586044431f, 0.0862829611f},
-std::array<float,2>{0.33562696f, 0.163682863f},
-std::array<float,2>{0.63392216f, 0.639854491f},
-std::array<float,2>{0.202884331f, 0.752489686f},
-std::array<float,2>{0.916541934f, 0.396708697f},
-std::array<float,2>{0.1640165f, 0.057183262f},
-std::array<float,2>{0.974680781f, 0.54465425f},
-std::array<float,2>{0.26851809f, 0.939792216f},
-std::array<float,2>{0.700164914f, 0.312889904f},
-std::array<float,2>{0.396262765f, 0.48019284f},
-std::array<float,2>{0.544211686f, 0.825051129f},
-std::array<float,2>{0.0109981773f, 0.712776303f},
-std::array<float,2>{0.757812619f, 0.211055174f},
-std::array<float,2>{0.11346063f, 0.405113697f},
-std::array<float,2>{0.838915586f, 0.762367487f},
-std::array<float,2>{0.448040128f, 0.628025293f},
-std::array<float,2>{0.617925525f, 0.167045712f},
-std::array<float,2>{0.355425358f, 0.0826012865f},
-std::array<float,2>{0.683357954f, 0.570877552f},
-std::array<float,2>{0.24582535f, 0.90232259f},
-std::array<float,2>{0.90197885f, 0.255084366f},
-std::array<float,2>{0.136705488f, 0.2094886f},
-std::array<float,2>{0.960497916f, 0.708982885f},
-std::array<float,2>{0.310579449f, 0.815016448f},
-std::array<float,2>{0.746130526f, 0.470720142f},
-std::array<float,2>{0.431753814f, 0.321142852f},
-std::array<float,2>{0.524856031f, 0.95232439f},
-std::array<float,2>{0.0334794931f, 0.535453916f},
-std::array<float,2>{0.788564384f, 0.0541314222f},
-std::array<float,2>{0.190232158f, 0.304667383f},
-std::array<float,2>{0.908748448f, 0.918212712f},
-std::array<float,2>{0.33780545f, 0.606160879f},
-std::array<float,2>{0.627410531f, 0.124835089f},
-std::array<float,2>{0.495294511f, 0.130572781f},
-std::array<float,2>{0.584736943f, 0.676742733f},
-std::array<float,2>{0.0933117792f, 0.79568845f},
-std::array<float,2>{0.851068258f, 0.413603783f},
-std::array<float,2>{0.00700445613f, 0.0310096014f},
-std::array<float,2>{0.750501573f, 0.512093484f},
-std::array<float,2>{0.400293559f, 0.980760515f},
-std::array<float,2>{0.534965158f, 0.367307156f},
-std::array<float,2>{0.277994335f, 0.453914732f},
-std::array<float,2>{0.688154638f, 0.84898597f},
-std::array<float,2>{0.168379337f, 0.725496709f},
-std::array<float,2>{0.983182132f, 0.249829412f},
-std::array<float,2>{0.179095566f, 0.495095134f},
-std::array<float,2>{0.990160763f, 0.842635334f},
-std::array<float,2>{0.265221655f, 0.696999669f},
-std::array<float,2>{0.708042383f, 0.201169133f},
-std::array<float,2>{0.386297256f, 0.045288384f},
-std::array<float,2>{0.553698242f, 0.561793268f},
-std::array<float,2>{0.0239926409f, 0.959159791f},
-std::array<float,2>{0.776162028f, 0.341951102f},
-std::array<float,2>{0.0657630563f, 0.180147558f},
-std::array<float,2>{0.870396137f, 0.654726923f},
-std::array<float,2>{0.48091194f, 0.777683198f},
-std::array<float,2>{0.573377848f, 0.389920324f},
-std::array<float,2>{0.320987403f, 0.280341089f},
-std::array<float,2>{0.647989869f, 0.878053725f},
-std::array<float,2>{0.215645224f, 0.578837872f},
-std::array<float,2>{0.923787653f, 0.0742065832f},
-std::array<float,2>{0.054073099f, 0.353937238f},
-std::array<float,2>{0.804701924f, 0.998106837f},
-std::array<float,2>{0.416181952f, 0.518899262f},
-std::array<float,2>{0.500023484f, 0.00591531955f},
-std::array<float,2>{0.293042958f, 0.227430448f},
-std::array<float,2>{0.718960404f, 0.740050077f},
-std::array<float,2>{0.150494292f, 0.862078905f},
-std::array<float,2>{0.946466506f, 0.441408753f},
-std::array<float,2>{0.225692824f, 0.10200236f},
-std::array<float,2>{0.880906701f, 0.623140037f},
-std::array<float,2>{0.359692514f, 0.925585091f},
-std::array<float,2>{0.670858264f, 0.295716226f},
-std::array<float,2>{0.45521313f, 0.426241815f},
-std::array<float,2>{0.596492052f, 0.798094332f},
-std::array<float,2>{0.0953748152f, 0.671322167f},
-std::array<float,2>{0.824757755f, 0.151806384f},
-std::array<float,2>{0.0364227891f, 0.430241317f},
-std::array<float,2>{0.782735527f, 0.812094629f},
-std::array<float,2>{0.434741348f, 0.657920599f},
-std::array<float,2>{0.528128326f, 0.146057531f},
-std::array<float,2>{0.306840092f, 0.0945827514f},
-std::array<float,2>{0.742820382f, 0.61576736f},
-std::array<float,2>{0.137943491f, 0.936465442f},
-std::array<float,2>{0.956691146f, 0.286665112f},
-std::array<float,2>{0.24930127f, 0.219199032f},
-std::array<float,2>{0.905866504f, 0.749243081f},
-std::array<float,2>{0.357937545f, 0.870680094f},
-std::array<float,2>{0.684770703f, 0.448561251f},
-std::array<float,2>{0.451052815f, 0.351411611f},
-std::array<float,2>{0.624731362f, 0.989408314f},
-std::array<float,2>{0.110050678f, 0.526191771f},
-std::array<float,2>{0.841004491f, 0.009079854f},
-std::array<float,2>{0.16575335f, 0.270165205f},
-std::array<float,2>{0.978992164f, 0.88316977f},
-std::array<float,2>{0.277034402f, 0.59048605f},
-std::array<float,2>{0.692443132f, 0.0640926436f},
-std::array<float,2>{0.403220892f, 0.175450325f},
-std::array<float,2>{0.538055003f, 0.642592251f},
-std::array<float,2>{0.00156463333f, 0.772574425f},
-std::array<float,2>{0.755882621f, 0.376783252f},
-std::array<float,2>{0.0882487074f, 0.0374706984f},
-std::array<float,2>{0.847103f, 0.547323406f},
-std::array<float,2>{0.498497099f, 0.962318897f},
-std::array<float,2>{0.58162576f, 0.333961636f},
-std::array<float,2>{0.341487914f, 0.490151644f},
-std::array<float,2>{0.632601619f, 0.834585845f},
-std::array<float,2>{0.192331627f, 0.694681406f},
-std::array<float,2>{0.913563073f, 0.193076983f},
-std::array<float,2>{0.212973863f, 0.465902895f},
-std::array<float,2>{0.928060174f, 0.852366626f},
-std::array<float,2>{0.32554391f, 0.731589615f},
-std::array<float,2>{0.641528308f, 0.235797971f},
-std::array<float,2>{0.478066832f, 0.0203739367f},
-std::array<float,2>{0.574522436f, 0.507672906f},
-std::array<float,2>{0.0701147094f, 0.973519623f},
-std::array<float,2>{0.87484467f, 0.365661442f},
-std::array<float,2>{0.0287571345f, 0.136449337f},
-std::array<float,2>{0.779276967f, 0.684576273f},
-std::array<float,2>{0.387165844f, 0.785630882f},
-std::array<float,2>{0.547412932f, 0.415965587f},
-std::array<float,2>{0.259171486f, 0.304874182f},
-std::array<float,2>{0.7046175f, 0.912972271f},
-std::array<float,2>{0.171939254f, 0.595793724f},
-std::array<float,2>{0.984741867f, 0.114853315f},
-std::array<float,2>{0.10014227f, 0.318340659f},
-std::array<float,2>{0.821986616f, 0.943947494f},
-std::array<float,2>{0.45989415f, 0.541213393f},
-std::array<float,2>{0.601318479f, 0.0602405295f},
-std::array<float,2>{0.366042316f, 0.216386348f},
-std::array<float,2>{0.666438878f, 0.718289852f},
-std::array<float,2>{0.22259964f, 0.820789158f},
-std::array<float,2>{0.877140522f, 0.481141776f},
-std::array<float,2>{0.153107002f, 0.0926654264f},
-std::array<float,2>{0.953062177f, 0.569103003f},
-std::array<float,2>{0.289831251f, 0.891329408f},
-std::array<float,2>{0.72440058f, 0.262978524f},
-std::array<float,2>{0.421453387f, 0.394056588f},
-std::array<float,2>{0.504077733f, 0.755845845f},
-std::array<float,2>{0.0479465276f, 0.633105218f},
-std::array<float,2>{0.810176909f, 0.158378035f},
-std::array<float,2>{0.0777544007f, 0.472706199f},
-std::array<float,2>{0.863140881f, 0.816677749f},
-std::array<float,2>{0.474882871f, 0.706766963f},
-std::array<float,2>{0.569304407f, 0.20687227f},
-std::array<float,2>{0.315719455f, 0.0489928164f},
-std::array<float,2>{0.654990375f, 0.531407058f},
-std::array<float,2>{0.204237625f, 0.947546721f},
-std::array<float,2>{0.930563629f, 0.324617594f},
-std::array<float,2>{0.181054667f, 0.169516876f},
-std::array<float,2>{0.996682107f, 0.63252914f},
-std::array<float,2>{0.253802001f, 0.761170447f},
-std::array<float,2>{0.716142535f, 0.39920181f},
-std::array<float,2>{0.379515201f, 0.253104091f},
-std::array<float,2>{0.557023764f, 0.902902961f},
-std::array<float,2>{0.0224126149f, 0.575581074f},
-std::array<float,2>{0.772210598f, 0.078232497f},
-std::array<float,2>{0.229709253f, 0.372190684f},
-std::array<float,2>{0.886569381f, 0.976939857f},
-std::array<float,2>{0.370703191f, 0.509677708f},
-std::array<float,2>{0.660069108f, 0.0271997638f},
-std::array<float,2>{0.466839761f, 0.243607864f},
-std::array<float,2>{0.603772998f, 0.718945205f},
-std::array<float,2>{0.104777567f, 0.847543478f},
-std::array<float,2>{0.812651098f, 0.457365632f},
-std::array<float,2>{0.0558125675f, 0.117870033f},
-std::array<float,2>{0.799583733f, 0.602722287f},
-std::array<float,2>{0.412109822f, 0.915950119f},
-std::array<float,2>{0.514769673f, 0.297254592f},
-std::array<float,2>{0.283732563f, 0.408606142f},
-std::array<float,2>{0.729968488f, 0.79189378f},
-std::array<float,2>{0.147512421f, 0.67498827f},
-std::array<float,2>{0.940846503f, 0.125145435f},
-std::array<float,2>{0.126966462f, 0.385420769f},
-std::array<float,2>{0.965736926f, 0.774403691f},
-std::array<float,2>{0.298446834f, 0.64852494f},
-std::array<float,2>{0.740210772f, 0.186055407f},
-std::array<float,2>{0.424838215f, 0.0770161897f},
-std::array<float,2>{0.516442537f, 0.583225131f},
-std::array<float,2>{0.0436971262f, 0.881569028f},
-std::array<float,2>{0.794448256f, 0.275843203f},
-std::array<float,2>{0.120335974f, 0.198724672f},
-std::array<float,2>{0.830445588f, 0.702137887f},
-std::array<float,2>{0.439693213f, 0.837877989f},
-std::array<float,2>{0.611535072f, 0.497817665f},
-std::array<float,2>{0.343753606f, 0.337330401f},
-std::array<float,2>{0.67749393f, 0.953971863f},
-std::array<float,2>{0.241777211f, 0.556568623f},
-std::array<float,2>{0.891651869f, 0.039799992f},
-std::array<float,2>{0.0136905387f, 0.289139003f},
-std::array<float,2>{0.762782633f, 0.926404238f},
-std::array<float,2>{0.392020285f, 0.619494438f},
-std::array<float,2>{0.541454852f, 0.107517153f},
-std::array<float,2>{0.271297604f, 0.15280965f},
-std::array<float,2>{0.695708811f, 0.667356491f},
-std::array<float,2>{0.158819005f, 0.803740144f},
-std::array<float,2>{0.969351768f, 0.425351888f},
-std::array<float,2>{0.196961582f, 0.00269206567f},
-std::array<float,2>{0.920795381f, 0.522648394f},
-std::array<float,2>{0.330874473f, 0.992767811f},
-std::array<float,2>{0.640554428f, 0.358708858f},
-std::array<float,2>{0.488996267f, 0.437567502f},
-std::array<float,2>{0.592236698f, 0.866286457f},
-std::array<float,2>{0.0781843662f, 0.735757053f},
-std::array<float,2>{0.855116069f, 0.233363569f},
-std::array<float,2>{0.0598994903f, 0.486951739f},
-std::array<float,2>{0.801802516f, 0.828654289f},
-std::array<float,2>{0.406495452f, 0.688776493f},
-std::array<float,2>{0.511580646f, 0.188728571f},
-std::array<float,2>{0.287421405f, 0.0316998921f},
-std::array<float,2>{0.730666757f, 0.552828491f},
-std::array<float,2>{0.142568365f, 0.965761244f},
-std::array<float,2>{0.943332851f, 0.329751462f},
-std::array<float,2>{0.230874538f, 0.176074624f},
-std::array<float,2>{0.890187025f, 0.647323668f},
-std::array<float,2>{0.371135861f, 0.768378437f},
-std::array<float,2>{0.661725938f, 0.379654408f},
-std::array<float,2>{0.461642921f, 0.269303977f},
-std::array<float,2>{0.607470632f, 0.890112877f},
-std::array<float,2>{0.107503951f, 0.589222908f},
-std::array<float,2>{0.818401277f, 0.0690927207f},
-std::array<float,2>{0.187424496f, 0.345426857f},
-std::array<float,2>{0.994614244f, 0.984574556f},
-std::array<float,2>{0.256623268f, 0.528042853f},
-std::array<float,2>{0.714574337f, 0.0124499379f},
-std::array<float,2>{0.377934992f, 0.225645348f},
-std::array<float,2>{0.559069097f, 0.742301762f},
-std::array<float,2>{0.0167934336f, 0.872144163f},
-std::array<float,2>{0.766158104f, 0.449503601f},
-std::array<float,2>{0.0711268485f, 0.0979000926f},
-std::array<float,2>{0.86630559f, 0.611037731f},
-std::array<float,2>{0.469573051f, 0.932515621f},
-std::array<float,2>{0.562932253f, 0.281942189f},
-std::array<float,2>{0.317088306f, 0.435816467f},
-std::array<float,2>{0.651658893f, 0.80730772f},
-std::array<float,2>{0.20705767f, 0.663430572f},
-std::array<float,2>{0.93708986f, 0.142546311f},
-std::array<float,2>{0.200295702f, 0.396046013f},
-std::array<float,2>{0.915486455f, 0.750400603f},
-std::array<float,2>{0.332190245f, 0.637556434f},
-std::array<float,2>{0.636400163f, 0.160829991f},
-std::array<float,2>{0.48507604f, 0.0888609663f},
-std::array<float,2>{0.587922871f, 0.564275324f},
-std::array<float,2>{0.0822770968f, 0.897349894f},
-std::array<float,2>{0.8576442f, 0.261466712f},
-std::array<float,2>{0.00792454183f, 0.213262931f},
-std::array<float,2>{0.761352897f, 0.713197708f},
-std::array<float,2>{0.396675587f, 0.827244699f},
-std::array<float,2>{0.545963347f, 0.478367537f},
-std::array<float,2>{0.266364187f, 0.314707458f},
-std::array<float,2>{0.701813877f, 0.938959301f},
-std::array<float,2>{0.16095227f, 0.545122504f},
-std::array<float,2>{0.973341405f, 0.0563652031f},
-std::array<float,2>{0.123013176f, 0.311858207f},
-std::array<float,2>{0.835624814f, 0.909855723f},
-std::array<float,2>{0.444730103f, 0.601140022f},
-std::array<float,2>{0.614034235f, 0.113156579f},
-std::array<float,2>{0.350198209f, 0.140440926f},
-std::array<float,2>{0.674101591f, 0.683586299f},
-std::array<float,2>{0.235147402f, 0.781255901f},
-std::array<float,2>{0.896246612f, 0.418545544f},
-std::array<float,2>{0.13180685f, 0.01855704f},
-std::array<float,2>{0.962521613f, 0.500162899f},
-std::array<float,2>{0.302599311f, 0.969924867f},
-std::array<float,2>{0.736131907f, 0.362690747f},
-std::array<float,2>{0.429003f, 0.46201703f},
-std::array<float,2>{0.522473991f, 0.859258771f},
-std::array<float,2>{0.0395427495f, 0.72852248f},
-std::array<float,2>{0.79007107f, 0.240619183f},
-std::array<float,2>{0.0915444344f, 0.410804063f},
-std::array<float,2>{0.848251402f, 0.794679821f},
-std::array<float,2>{0.492621034f, 0.679683864f},
-std::array<float,2>{0.582536519f, 0.131364554f},
-std::array<float,2>{0.339400858f, 0.122890234f},
-std::array<float,2>{0.625899255f, 0.607611358f},
-std::array<float,2>{0.187945351f, 0.920658171f},
-std::array<float,2>{0.907079339f, 0.301220596f},
-std::array<float,2>{0.170915097f, 0.246184081f},
-std::array<float,2>{0.982132673f, 0.723366618f},
-std::array<float,2>{0.279974341f, 0.849609613f},
-std::array<float,2>{0.689860702f, 0.455246001f},
-std::array<float,2>{0.401639193f, 0.370460123f},
-std::array<float,2>{0.532985568f, 0.98304069f},
-std::array<float,2>{0.00567697501f, 0.51466918f},
-std::array<float,2>{0.753516197f, 0.0291596334f},
-std::array<float,2>{0.242949724f, 0.256275862f},
-std::array<float,2>{0.899962306f, 0.899607241f},
-std::array<float,2>{0.353450984f, 0.573740423f},
-std::array<float,2>{0.681331873f, 0.084894225f},
-std::array<float,2>{0.446841091f, 0.165556684f},
-std::array<float,2>{0.619354188f, 0.625903726f},
-std::array<float,2>{0.116401121f, 0.765094817f},
-std::array<float,2>{0.836977184f, 0.402455121f},
-std::array<float,2>{0.0314238518f, 0.0516791828f},
-std::array<float,2>{0.785334289f, 0.539035439f},
-std::array<float,2>{0.43078953f, 0.950436413f},
-std::array<float,2>{0.525896132f, 0.323514134f},
-std::array<float,2>{0.309972644f, 0.469809413f},
-std::array<float,2>{0.748482287f, 0.81349057f},
-std::array<float,2>{0.133847028f, 0.709355414f},
-std::array<float,2>{0.957643986f, 0.208925337f},
-std::array<float,2>{0.148813769f, 0.444518149f},
-std::array<float,2>{0.948512137f, 0.861309528f},
-std::array<float,2>{0.295454115f, 0.740354896f},
-std::array<float,2>{0.722463965f, 0.229588851f},
-std::array<float,2>{0.415373206f, 0.00481837429f},
-std::array<float,2>{0.503085196f, 0.516040444f},
-std::array<float,2>{0.0507981405f, 0.996302187f},
-std::array<float,2>{0.808198452f, 0.35270074f},
-std::array<float,2>{0.0967023224f, 0.149928033f},
-std::array<float,2>{0.827375054f, 0.668325245f},
-std::array<float,2>{0.453302383f, 0.799674451f},
-std::array<float,2>{0.594032347f, 0.428776026f},
-std::array<float,2>{0.362927407f, 0.293926358f},
-std::array<float,2>{0.668695986f, 0.923327625f},
-std::array<float,2>{0.224168643f, 0.622274816f},
-std::array<float,2>{0.879481614f, 0.103806272f},
-std::array<float,2>{0.0269094072f, 0.340080649f},
-std::array<float,2>{0.774590492f, 0.95845902f},
-std::array<float,2>{0.383232385f, 0.559586704f},
-std::array<float,2>{0.551113546f, 0.0446676947f},
-std::array<float,2>{0.262251347f, 0.201598346f},
-std::array<float,2>{0.709353089f, 0.697556674f},
-std::array<float,2>{0.175925106f, 0.840371549f},
-std::array<float,2>{0.991445005f, 0.492237121f},
-std::array<float,2>{0.217077747f, 0.0704374462f},
-std::array<float,2>{0.9240821f, 0.581829786f},
-std::array<float,2>{0.324034572f, 0.876885355f},
-std::array<float,2>{0.645124435f, 0.278986812f},
-std::array<float,2>{0.482931465f, 0.387660831f},
-std::array<float,2>{0.572004318f, 0.780727506f},
-std::array<float,2>{0.0628116354f, 0.653416812f},
-std::array<float,2>{0.868700027f, 0.182133034f},
-std::array<float,2>{0.0031800752f, 0.377275378f},
-std::array<float,2>{0.755377233f, 0.769768834f},
-std::array<float,2>{0.40590173f, 0.642349601f},
-std::array<float,2>{0.53607899f, 0.172775865f},
-std::array<float,2>{0.275310129f, 0.0646754131f},
-std::array<float,2>{0.695103049f, 0.592890322f},
-std::array<float,2>{0.166517973f, 0.886433363f},
-std::array<float,2>{0.978177249f, 0.27323097f},
-std::array<float,2>{0.193556055f, 0.195040882f},
-std::array<float,2>{0.910266876f, 0.69157064f},
-std::array<float,2>{0.34338665f, 0.833628237f},
-std::array<float,2>{0.62940228f, 0.49066636f},
-std::array<float,2>{0.497620076f, 0.335738719f},
-std::array<float,2>{0.579897881f, 0.963170648f},
-std::array<float,2>{0.0878727213f, 0.548923433f},
-std::array<float,2>{0.845443487f, 0.0366931707f},
-std::array<float,2>{0.140586555f, 0.288017482f},
-std::array<float,2>{0.954722404f, 0.934377193f},
-std::array<float,2>{0.306171954f, 0.613459468f},
-std::array<float,2>{0.746091723f, 0.0959964916f},
-std::array<float,2>{0.435824066f, 0.146887854f},
-std::array<float,2>{0.53101033f, 0.658491611f},
-std::array<float,2>{0.0381730273f, 0.810173512f},
-std::array<float,2>{0.784087598f, 0.43214184f},
-std::array<float,2>{0.112486303f, 0.0104186889f},
-std::array<float,2>{0.841978967f, 0.523732483f},
-std::array<float,2>{0.452155262f, 0.9915905f},
-std::array<float,2>{0.621890366f, 0.348408252f},
-std::array<float,2>{0.356916368f, 0.447130322f},
-std::array<float,2>{0.687312067f, 0.869077623f},
-std::array<float,2>{0.247904256f, 0.747508526f},
-std::array<float,2>{0.903458953f, 0.222114965f},
-std::array<float,2>{0.220513389f, 0.483685523f},
-std::array<float,2>{0.875632405f, 0.823771715f},
-std::array<float,2>{0.363903403f, 0.716535866f},
-std::array<float,2>{0.665567517f, 0.216892734f},
-std::array<float,2>{0.458793074f, 0.0616088137f},
-std::array<float,2>{0.598795474f, 0.540255606f},
-std::array<float,2>{0.0992116183f, 0.943159342f},
-std::array<float,2>{0.823863983f, 0.320111126f},
-std::array<float,2>{0.0491721742f, 0.156526744f},
-std::array<float,2>{0.811208606f, 0.634887278f},
-std::array<float,2>{0.417985886f, 0.757478893f},
-std::array<float,2>{0.506324708f, 0.391878694f},
-std::array<float,2>{0.291464359f, 0.26439178f},
-std::array<float,2>{0.726303935f, 0.893169701f},
-std::array<float,2>{0.155204311f, 0.56762886f},
-std::array<float,2>{0.950461507f, 0.0917275846f},
-std::array<float,2>{0.0667646453f, 0.363461763f},
-std::array<float,2>{0.872540414f, 0.975341141f},
-std::array<float,2>{0.479302019f, 0.504437387f},
-std::array<float,2>{0.577527046f, 0.0220608003f},
-std::array<float,2>{0.327522278f, 0.236702144f},
-std::array<float,2>{0.643060207f, 0.733462334f},
-std::array<float,2>{0.211217523f, 0.854029536f},
-std::array<float,2>{0.927125752f, 0.467659801f},
-std::array<float,2>{0.175192446f, 0.116539553f},
-std::array<float,2>{0.988165617f, 0.594750643f},
-std::array<float,2>{0.260725141f, 0.911929429f},
-std::array<float,2>{0.706509054f, 0.307161242f},
-std::array<float,2>{0.390383452f, 0.416295201f},
-std::array<float,2>{0.550398052f, 0.788813591f},
-std::array<float,2>{0.0307494216f, 0.686716259f},
-std::array<float,2>{0.781175733f, 0.13316904f},
-std::array<float,2>{0.103362739f, 0.460050374f},
-std::array<float,2>{0.814811707f, 0.845599055f},
-std::array<float,2>{0.466136724f, 0.720861971f},
-std::array<float,2>{0.602994084f, 0.245731115f},
-std::array<float,2>{0.367940336f, 0.0238200296f},
-std::array<float,2>{0.656264961f, 0.511507034f},
-std::array<float,2>{0.226795003f, 0.979833603f},
-std::array<float,2>{0.883487761f, 0.374042779f},
-std::array<float,2>{0.145718604f, 0.127883017f},
-std::array<float,2>{0.937989652f, 0.672382534f},
-std::array<float,2>{0.281290978f, 0.789472997f},
-std::array<float,2>{0.72754401f, 0.408057898f},
-std::array<float,2>{0.411120772f, 0.299583584f},
-std::array<float,2>{0.512880027f, 0.91778487f},
-std::array<float,2>{0.0570037253f, 0.604708672f},
-std::array<float,2>{0.798336506f, 0.119209386f},
-std::array<float,2>{0.206638768f, 0.326775402f},
-std::array<float,2>{0.932894647f, 0.946112871f},
-std::array<float,2>{0.313930422f, 0.534985125f},
-std::array<float,2>{0.652786613f, 0.0472276062f},
-std::array<float,2>{0.474413872f, 0.205024302f},
-std::array<float,2>{0.566887856f, 0.705016971f},
-std::array<float,2>{0.0750564337f, 0.818941653f},
-std::array<float,2>{0.860104859f, 0.475414157f},
-std::array<float,2>{0.0208253358f, 0.0817830265f},
-std::array<float,2>{0.771208465f, 0.576944947f},
-std::array<float,2>{0.382058322f, 0.905761719f},
-std::array<float,2>{0.556077719f, 0.251642108f},
-std::array<float,2>{0.250150412f, 0.40233621f},
-std::array<float,2>{0.717615843f, 0.75904423f},
-std::array<float,2>{0.18268913f, 0.629766405f},
-std::array<float,2>{0.998235464f, 0.171343192f},
-std::array<float,2>{0.157321185f, 0.422697842f},
-std::array<float,2>{0.972124457f, 0.802278042f},
-std::array<float,2>{0.272530705f, 0.664555371f},
-std::array<float,2>{0.69833827f, 0.156066909f},
-std::array<float,2>{0.393066317f, 0.106468409f},
-std::array<float,2>{0.539738357f, 0.618052959f},
-std::array<float,2>{0.0117489966f, 0.928171635f},
-std::array<float,2>{0.763849139f, 0.292633891f},
-std::array<float,2>{0.0808760598f, 0.230824873f},
-std::array<float,2>{0.853461206f, 0.736402094f},
-std::array<float,2>{0.491008699f, 0.864487112f},
-std::array<float,2>{0.590266585f, 0.440123856f},
-std::array<float,2>{0.329101235f, 0.357010067f},
-std::array<float,2>{0.63800931f, 0.995583355f},
-std::array<float,2>{0.198894396f, 0.520664096f},
-std::array<float,2>{0.919216573f, 0.00114891725f},
-std::array<float,2>{0.0449678898f, 0.273527592f},
-std::array<float,2>{0.796528935f, 0.880457997f},
-std::array<float,2>{0.422761261f, 0.585573971f},
-std::array<float,2>{0.51906395f, 0.0743511543f},
-std::array<float,2>{0.299922079f, 0.184190542f},
-std::array<float,2>{0.741635144f, 0.651676357f},
-std::array<float,2>{0.125319853f, 0.775681019f},
-std::array<float,2>{0.967525721f, 0.384617835f},
-std::array<float,2>{0.238905191f, 0.0422169417f},
-std::array<float,2>{0.893553197f, 0.557594717f},
-std::array<float,2>{0.346280158f, 0.955737472f},
-std::array<float,2>{0.678921759f, 0.338637173f},
-std::array<float,2>{0.43922022f, 0.498515487f},
-std::array<float,2>{0.609606981f, 0.838893831f},
-std::array<float,2>{0.117197119f, 0.70001322f},
-std::array<float,2>{0.829076111f, 0.195356771f},
-std::array<float,2>{0.0407610722f, 0.463114738f},
-std::array<float,2>{0.78962642f, 0.855668962f},
-std::array<float,2>{0.428339332f, 0.727245212f},
-std::array<float,2>{0.521545529f, 0.238596529f},
-std::array<float,2>{0.301429957f, 0.0174004007f},
-std::array<float,2>{0.735291004f, 0.503324389f},
-std::array<float,2>{0.132321f, 0.971041381f},
-std::array<float,2>{0.961149871f, 0.361205906f},
-std::array<float,2>{0.235436186f, 0.137193799f},
-std::array<float,2>{0.894700408f, 0.680650473f},
-std::array<float,2>{0.350863487f, 0.783790469f},
-std::array<float,2>{0.675604045f, 0.421520352f},
-std::array<float,2>{0.443755329f, 0.30915609f},
-std::array<float,2>{0.614997447f, 0.908028066f},
-std::array<float,2>{0.121646225f, 0.599082589f},
-std::array<float,2>{0.834885359f, 0.111134827f},
-std::array<float,2>{0.162025839f, 0.314379066f},
-std::array<float,2>{0.974095464f, 0.940529108f},
-std::array<float,2>{0.267409414f, 0.543256104f},
-std::array<float,2>{0.70225811f, 0.0584765859f},
-std::array<float,2>{0.39754352f, 0.212467864f},
-std::array<float,2>{0.54503262f, 0.711234748f},
-std::array<float,2>{0.00893337652f, 0.825594008f},
-std::array<float,2>{0.760386646f, 0.478525937f},
-std::array<float,2>{0.0836856589f, 0.0872896314f},
-std::array<float,2>{0.858994722f, 0.565041959f},
-std::array<float,2>{0.486270279f, 0.895582795f},
-std::array<float,2>{0.589611471f, 0.259588957f},
-std::array<float,2>{0.333590746f, 0.398357987f},
-std::array<float,2>{0.634934247f, 0.753509879f},
-std::array<float,2>{0.200177222f, 0.639643669f},
-std::array<float,2>{0.914417982f, 0.163035408f},
-std::array<float,2>{0.208951622f, 0.434242994f},
-std::array<float,2>{0.93595016f, 0.805673182f},
-std::array<float,2>{0.318216413f, 0.66189748f},
-std::array<float,2>{0.651130378f, 0.143322781f},
-std::array<float,2>{0.47061339f, 0.100734264f},
-std::array<float,2>{0.564172089f, 0.612036049f},
-std::array<float,2>{0.072048746f, 0.930134118f},
-std::array<float,2>{0.865796328f, 0.283840001f},
-std::array<float,2>{0.0161275212f, 0.223249435f},
-std::array<float,2>{0.767216265f, 0.745349109f},
-std::array<float,2>{0.377486557f, 0.873371005f},
-std::array<float,2>{0.560061276f, 0.452332377f},
-std::array<float,2>{0.257522434f, 0.345914781f},
-std::array<float,2>{0.713421822f, 0.987072587f},
-std::array<float,2>{0.18614234f, 0.530854762f},
-std::array<float,2>{0.995747685f, 0.01552164f},
-std::array<float,2>{0.108705498f, 0.267281443f},
-std::array<float,2>{0.819817185f, 0.886892974f},
-std::array<float,2>{0.46213457f, 0.587400436f},
-std::array<float,2>{0.609330058f, 0.067381829f},
-std::array<float,2>{0.372792333f, 0.179189682f},
-std::array<float,2>{0.660949349f, 0.644790113f},
-std::array<float,2>{0.231988296f, 0.7657215f},
-std::array<float,2>{0.889149308f, 0.382327735f},
-std::array<float,2>{0.141593203f, 0.0334156342f},
-std::array<float,2>{0.941455781f, 0.551010609f},
-std::array<float,2>{0.288438857f, 0.967679918f},
-std::array<float,2>{0.731813908f, 0.33014825f},
-std::array<float,2>{0.407783926f, 0.485544652f},
-std::array<float,2>{0.510479927f, 0.831248939f},
-std::array<float,2>{0.0588679463f, 0.690703034f},
-std::array<float,2>{0.801247597f, 0.191379607f},
-std::array<float,2>{0.0634896681f, 0.388861537f},
-std::array<float,2>{0.867379308f, 0.779131353f},
-std::array<float,2>{0.484315485f, 0.655732453f},
-std::array<float,2>{0.57041347f, 0.18154557f},
-std::array<float,2>{0.32308659f, 0.0730526447f},
-std::array<float,2>{0.645806611f, 0.580023587f},
-std::array<float,2>{0.218557164f, 0.877902865f},
-std::array<float,2>{0.925210118f, 0.27952835f},
-std::array<float,2>{0.177370027f, 0.199434608f},
-std::array<float,2>{0.990718901f, 0.69582206f},
-std::array<float,2>{0.26291585f, 0.843465567f},
-std::array<float,2>{0.710444152f, 0.495858312f},
-std::array<float,2>{0.383873612f, 0.34337458f},
-std::array<float,2>{0.55248946f, 0.960621715f},
-std::array<float,2>{0.0260691922f, 0.560936749f},
-std::array<float,2>{0.773624361f, 0.046765428f},
-std::array<float,2>{0.223591387f, 0.296369851f},
-std::array<float,2>{0.880577028f, 0.924654901f},
-std::array<float,2>{0.361965686f, 0.62475574f},
-std::array<float,2>{0.669829369f, 0.103096388f},
-std::array<float,2>{0.454660714f, 0.150915161f},
-std::array<float,2>{0.594811618f, 0.670504034f},
-std::array<float,2>{0.096306093f, 0.797635913f},
-std::array<float,2>{0.826985359f, 0.427097112f},
-std::array<float,2>{0.0523219556f, 0.00715096481f},
-std::array<float,2>{0.807382345f, 0.51765877f},
-std::array<float,2>{0.414398223f, 0.999470592f},
-std::array<float,2>{0.502357423f, 0.354784638f},
-std::array<float,2>{0.296367168f, 0.443085432f},
-std::array<float,2>{0.721391797f, 0.862564147f},
-std::array<float,2>{0.150032595f, 0.739027321f},
-std::array<float,2>{0.948095798f, 0.228245512f},
-std::array<float,2>{0.133222133f, 0.472305894f},
-std::array<float,2>{0.958755612f, 0.815622389f},
-std::array<float,2>{0.30881682f, 0.707625628f},
-std::array<float,2>{0.749912739f, 0.210269108f},
-std::array<float,2>{0.430326581f, 0.0533704385f},
-std::array<float,2>{0.526853621f, 0.53663677f},
-std::array<float,2>{0.0331961401f, 0.951296985f},
-std::array<float,2>{0.787069619f, 0.321543813f},
-std::array<float,2>{0.116089068f, 0.166628242f},
-std::array<float,2>{0.836318195f, 0.627408385f},
-std::array<float,2>{0.445416212f, 0.763329983f},
-std::array<float,2>{0.620798588f, 0.406133473f},
-std::array<float,2>{0.35227102f, 0.254094809f},
-std::array<float,2>{0.679915786f, 0.901136279f},
-std::array<float,2>{0.243641257f, 0.571484327f},
-std::array<float,2>{0.898965895f, 0.0832146034f},
-std::array<float,2>{0.0046731336f, 0.368446827f},
-std::array<float,2>{0.752889633f, 0.981774628f},
-std::array<float,2>{0.401309609f, 0.513228297f},
-std::array<float,2>{0.531986892f, 0.0299168434f},
-std::array<float,2>{0.280872494f, 0.248603091f},
-std::array<float,2>{0.6906569f, 0.726337314f},
-std::array<float,2>{0.17009528f, 0.848402083f},
-std::array<float,2>{0.981390178f, 0.454821318f},
-std::array<float,2>{0.189016312f, 0.123379521f},
-std::array<float,2>{0.908160388f, 0.606933057f},
-std::array<float,2>{0.337976247f, 0.919625223f},
-std::array<float,2>{0.62632072f, 0.303261071f},
-std::array<float,2>{0.493836671f, 0.41299504f},
-std::array<float,2>{0.583946228f, 0.796403944f},
-std::array<float,2>{0.0908201188f, 0.677568376f},
-std::array<float,2>{0.849206507f, 0.129309803f},
-std::array<float,2>{0.0294750351f, 0.414378494f},
-std::array<float,2>{0.780139863f, 0.786788821f},
-std::array<float,2>{0.389036804f, 0.684472203f},
-std::array<float,2>{0.548987687f, 0.135580406f},
-std::array<float,2>{0.261354715f, 0.113500014f},
-std::array<float,2>{0.705582738f, 0.596852303f},
-std::array<float,2>{0.17471756f, 0.91354233f},
-std::array<float,2>{0.987002134f, 0.306029677f},
-std::array<float,2>{0.212364867f, 0.234652683f},
-std::array<float,2>{0.925786972f, 0.730785549f},
-std::array<float,2>{0.326839536f, 0.853196323f},
-std::array<float,2>{0.644279778f, 0.465162784f},
-std::array<float,2>{0.479927033f, 0.366973847f},
-std::array<float,2>{0.577142775f, 0.973677039f},
-std::array<float,2>{0.0683479458f, 0.506204665f},
-std::array<float,2>{0.871168971f, 0.0211702324f},
-std::array<float,2>{0.155423999f, 0.262423456f},
-std::array<float,2>{0.950142741f, 0.892547429f},
-std::array<float,2>{0.29292506f, 0.570235729f},
-std::array<float,2>{0.72554177f, 0.0931039751f},
-std::array<float,2>{0.419345587f, 0.15983361f},
-std::array<float,2>{0.506882429f, 0.634162664f},
-std::array<float,2>{0.0502928793f, 0.754202247f},
-std::array<float,2>{0.812096536f, 0.393264621f},
-std::array<float,2>{0.0979816541f, 0.0589021221f},
-std::array<float,2>{0.822541118f, 0.542949259f},
-std::array<float,2>{0.457109272f, 0.944538116f},
-std::array<float,2>{0.598163009f, 0.316586167f},
-std::array<float,2>{0.364472657f, 0.481629044f},
-std::array<float,2>{0.664689541f, 0.821835101f},
-std::array<float,2>{0.219088361f, 0.717572749f},
-std::array<float,2>{0.876177609f, 0.21488896f},
-std::array<float,2>{0.246958181f, 0.448109746f},
-std::array<float,2>{0.902538478f, 0.869758427f},
-std::array<float,2>{0.35573408f, 0.748659968f},
-std::array<float,2>{0.685615122f, 0.219881907f},
-std::array<float,2>{0.451818019f, 0.00816464983f},
-std::array<float,2>{0.622724295f, 0.526709855f},
-std::array<float,2>{0.111359455f, 0.988443255f},
-std::array<float,2>{0.842799485f, 0.3503851f},
-std::array<float,2>{0.0373149551f, 0.144603685f},
-std::array<float,2>{0.78429389f, 0.656547606f},
-std::array<float,2>{0.437278599f, 0.810872912f},
-std::array<float,2>{0.529991567f, 0.431423932f},
-std::array<float,2>{0.305287272f, 0.285902381f},
-std::array<float,2>{0.74443984f, 0.936837375f},
-std::array<float,2>{0.139217898f, 0.616602659f},
-std::array<float,2>{0.954084516f, 0.0954410061f},
-std::array<float,2>{0.0865408108f, 0.332347572f},
-std::array<float,2>{0.844328225f, 0.961337984f},
-std::array<float,2>{0.496376336f, 0.548016548f},
-std::array<float,2>{0.578888595f, 0.0382085405f},
-std::array<float,2>{0.342207998f, 0.191456288f},
-std::array<float,2>{0.630332589f, 0.693644166f},
-std::array<float,2>{0.195083171f, 0.83588171f},
-std::array<float,2>{0.911291182f, 0.48900044f},
-std::array<float,2>{0.167200029f, 0.0630661845f},
-std::array<float,2>{0.977165759f, 0.591118515f},
-std::array<float,2>{0.273859411f, 0.884420216f},
-std::array<float,2>{0.693416297f, 0.270831436f},
-std::array<float,2>{0.404957622f, 0.375794619f},
-std::array<float,2>{0.53688091f, 0.771788597f},
-std::array<float,2>{0.00201820722f, 0.644396782f},
-std::array<float,2>{0.75444603f, 0.173941836f},
-std::array<float,2>{0.118168756f, 0.49653849f},
-std::array<float,2>{0.829675913f, 0.836721301f},
-std::array<float,2>{0.437813073f, 0.702330828f},
-std::array<float,2>{0.611256719f, 0.19804579f},
-std::array<float,2>{0.347394288f, 0.040541742f},
-std::array<float,2>{0.678152859f, 0.554714322f},
-std::array<float,2>{0.239812672f, 0.954355001f},
-std::array<float,2>{0.893742263f, 0.336198419f},
-std::array<float,2>{0.126585826f, 0.187011227f},
-std::array<float,2>{0.968119502f, 0.650107563f},
-std::array<float,2>{0.299343646f, 0.774758279f},
-std::array<float,2>{0.740745544f, 0.386371225f},
-std::array<float,2>{0.423689365f, 0.276973158f},
-std::array<float,2>{0.518396497f, 0.882198036f},
-std::array<float,2>{0.0466179028f, 0.583003998f},
-std::array<float,2>{0.795752823f, 0.0780978724f},
-std::array<float,2>{0.197390169f, 0.357979447f},
-std::array<float,2>{0.918764472f, 0.993770719f},
-std::array<float,2>{0.330069244f, 0.521553099f},
-std::array<float,2>{0.637177646f, 0.00321554276f},
-std::array<float,2>{0.491662443f, 0.234294415f},
-std::array<float,2>{0.591273904f, 0.734996974f},
-std::array<float,2>{0.0813990459f, 0.865420282f},
-std::array<float,2>{0.852522433f, 0.438800365f},
-std::array<float,2>{0.0127908783f, 0.10873764f},
-std::array<float,2>{0.764736414f, 0.62034899f},
-std::array<float,2>{0.393576533f, 0.927503347f},
-std::array<float,2>{0.540987074f, 0.290927529f},
-std::array<float,2>{0.272285551f, 0.424624205f},
-std::array<float,2>{0.697816253f, 0.80361557f},
-std::array<float,2>{0.157074064f, 0.666117072f},
-std::array<float,2>{0.971516609f, 0.154000118f},
-std::array<float,2>{0.182467476f, 0.400000602f},
-std::array<float,2>{0.99984771f, 0.760599315f},
-std::array<float,2>{0.251253784f, 0.631078839f},
-std::array<float,2>{0.718510032f, 0.168247357f},
-std::array<float,2>{0.380929977f, 0.0800337344f},
-std::array<float,2>{0.554850996f, 0.575056314f},
-std::array<float,2>{0.0199148636f, 0.903825343f},
-std::array<float,2>{0.769606054f, 0.252623945f},
-std::array<float,2>{0.0759080797f, 0.206017137f},
-std::array<float,2>{0.861230135f, 0.705969393f},
-std::array<float,2>{0.473127812f, 0.817654371f},
-std::array<float,2>{0.567962885f, 0.474551469f},
-std::array<float,2>{0.313054979f, 0.325421721f},
-std::array<float,2>{0.653614283f, 0.948397219f},
-std::array<float,2>{0.205692887f, 0.532899916f},
-std::array<float,2>{0.932147622f, 0.0502059348f},
-std::array<float,2>{0.0584730431f, 0.298589051f},
-std::array<float,2>{0.797563255f, 0.914868116f},
-std::array<float,2>{0.412043035f, 0.602514327f},
-std::array<float,2>{0.51178509f, 0.118435025f},
-std::array<float,2>{0.282650024f, 0.126515582f},
-std::array<float,2>{0.727458537f, 0.673921406f},
-std::array<float,2>{0.1446473f, 0.792007983f},
-std::array<float,2>{0.938686073f, 0.409260392f},
-std::array<float,2>{0.227906406f, 0.025509268f},
-std::array<float,2>{0.883865654f, 0.508413553f},
-std::array<float,2>{0.368563652f, 0.978051543f},
-std::array<float,2>{0.657641828f, 0.371198416f},
-std::array<float,2>{0.465293616f, 0.458806515f},
-std::array<float,2>{0.602182388f, 0.846044719f},
-std::array<float,2>{0.101810463f, 0.719933987f},
-std::array<float,2>{0.816169262f, 0.242809922f},
-std::array<float,2>{0.0101029398f, 0.477505118f},
-std::array<float,2>{0.759370148f, 0.826607943f},
-std::array<float,2>{0.394840091f, 0.714561522f},
-std::array<float,2>{0.543430328f, 0.213935375f},
-std::array<float,2>{0.268699497f, 0.0553662106f},
-std::array<float,2>{0.700262785f, 0.546224177f},
-std::array<float,2>{0.162175268f, 0.937542796f},
-std::array<float,2>{0.976382315f, 0.315623671f},
-std::array<float,2>{0.20195955f, 0.161174074f},
-std::array<float,2>{0.917239308f, 0.637782335f},
-std::array<float,2>{0.334290326f, 0.751407385f},
-std::array<float,2>{0.633573532f, 0.39519015f},
-std::array<float,2>{0.487761766f, 0.260661274f},
-std::array<float,2>{0.586919308f, 0.898009002f},
-std::array<float,2>{0.0857321844f, 0.562639415f},
-std::array<float,2>{0.855989933f, 0.0892697796f},
-std::array<float,2>{0.129428089f, 0.361455292f},
-std::array<float,2>{0.964191556f, 0.968924642f},
-std::array<float,2>{0.303981364f, 0.501363337f},
-std::array<float,2>{0.737798214f, 0.0176735111f},
-std::array<float,2>{0.426335245f, 0.241633311f},
-std::array<float,2>{0.520846188f, 0.729498923f},
-std::array<float,2>{0.0414814614f, 0.857441664f},
-std::array<float,2>{0.792545497f, 0.461700797f},
-std::array<float,2>{0.123173192f, 0.111937508f},
-std::array<float,2>{0.833072126f, 0.599718928f},
-std::array<float,2>{0.442735672f, 0.908332884f},
-std::array<float,2>{0.616186678f, 0.310921878f},
-std::array<float,2>{0.348863512f, 0.419775277f},
-std::array<float,2>{0.67222029f, 0.782779336f},
-std::array<float,2>{0.23780106f, 0.682027102f},
-std::array<float,2>{0.898035467f, 0.138951987f},
-std::array<float,2>{0.233770654f, 0.380182177f},
-std::array<float,2>{0.887768626f, 0.768597186f},
-std::array<float,2>{0.374597609f, 0.647496223f},
-std::array<float,2>{0.663248181f, 0.177221432f},
-std::array<float,2>{0.464241743f, 0.0699056536f},
-std::array<float,2>{0.606167912f, 0.588418007f},
-std::array<float,2>{0.105777889f, 0.889594018f},
-std::array<float,2>{0.817808509f, 0.267770559f},
-std::array<float,2>{0.0622825325f, 0.188392729f},
-std::array<float,2>{0.803775132f, 0.687605202f},
-std::array<float,2>{0.40983662f, 0.829574466f},
-std::array<float,2>{0.509659886f, 0.487432957f},
-std::array<float,2>{0.285564393f, 0.328193724f},
-std::array<float,2>{0.734097779f, 0.965913117f},
-std::array<float,2>{0.143448353f, 0.553772271f},
-std::array<float,2>{0.944031537f, 0.0326357707f},
-std::array<float,2>{0.0734556913f, 0.282750696f},
-std::array<float,2>{0.864207327f, 0.933014035f},
-std::array<float,2>{0.471036494f, 0.6099599f},
-std::array<float,2>{0.565475702f, 0.0989002585f},
-std::array<float,2>{0.319664031f, 0.141391233f},
-std::array<float,2>{0.649244726f, 0.662770867f},
-std::array<float,2>{0.209808663f, 0.807998836f},
-std::array<float,2>{0.934232891f, 0.436871111f},
-std::array<float,2>{0.185189307f, 0.0135622043f},
-std::array<float,2>{0.993702471f, 0.529181719f},
-std::array<float,2>{0.254758745f, 0.985427678f},
-std::array<float,2>{0.711512327f, 0.344159245f},
-std::array<float,2>{0.375806689f, 0.450849235f},
-std::array<float,2>{0.561799943f, 0.871729612f},
-std::array<float,2>{0.0190157667f, 0.743492007f},
-std::array<float,2>{0.767677188f, 0.224626571f},
-std::array<float,2>{0.094657734f, 0.427797198f},
-std::array<float,2>{0.825949669f, 0.799882591f},
-std::array<float,2>{0.45645842f, 0.669844449f},
-std::array<float,2>{0.597424567f, 0.149353817f},
-std::array<float,2>{0.360628009f, 0.105124898f},
-std::array<float,2>{0.67167443f, 0.621729076f},
-std::array<float,2>{0.225249559f, 0.922543764f},
-std::array<float,2>{0.882723093f, 0.294696122f},
-std::array<float,2>{0.152195901f, 0.228561267f},
-std::array<float,2>{0.945394218f, 0.741401196f},
-std::array<float,2>{0.294157594f, 0.859487474f},
-std::array<float,2>{0.719997764f, 0.443690777f},
-std::array<float,2>{0.417953908f, 0.351796776f},
-std::array<float,2>{0.501182318f, 0.997832716f},
-std::array<float,2>{0.0536538027f, 0.517085731f},
-std::array<float,2>{0.806096554f, 0.00552666886f},
-std::array<float,2>{0.216604471f, 0.278268635f},
-std::array<float,2>{0.922703326f, 0.875507712f},
-std::array<float,2>{0.32147339f, 0.580981731f},
-std::array<float,2>{0.646501184f, 0.0715142488f},
-std::array<float,2>{0.482022405f, 0.182848349f},
-std::array<float,2>{0.572565436f, 0.653005362f},
-std::array<float,2>{0.0645885244f, 0.779377937f},
-std::array<float,2>{0.869608402f, 0.387745559f},
-std::array<float,2>{0.0251984298f, 0.043369703f},
-std::array<float,2>{0.777086198f, 0.558755398f},
-std::array<float,2>{0.384942412f, 0.957849503f},
-std::array<float,2>{0.553997219f, 0.341556281f},
-std::array<float,2>{0.264043123f, 0.494089663f},
-std::array<float,2>{0.707919896f, 0.841395795f},
-std::array<float,2>{0.178145647f, 0.698326111f},
-std::array<float,2>{0.988721609f, 0.202411473f},
-std::array<float,2>{0.169052005f, 0.45629245f},
-std::array<float,2>{0.984039426f, 0.851200283f},
-std::array<float,2>{0.279034257f, 0.724053979f},
-std::array<float,2>{0.688647032f, 0.247261599f},
-std::array<float,2>{0.398667097f, 0.0277886819f},
-std::array<float,2>{0.534039199f, 0.514358819f},
-std::array<float,2>{0.00667225337f, 0.984358668f},
-std::array<float,2>{0.750999033f, 0.369281322f},
-std::array<float,2>{0.0922379196f, 0.132112905f},
-std::array<float,2>{0.850578547f, 0.67826122f},
-std::array<float,2>{0.494261742f, 0.793317318f},
-std::array<float,2>{0.585557759f, 0.411633462f},
-std::array<float,2>{0.336874038f, 0.302320719f},
-std::array<float,2>{0.62829262f, 0.920905113f},
-std::array<float,2>{0.19077462f, 0.609076858f},
-std::array<float,2>{0.910115063f, 0.121158488f},
-std::array<float,2>{0.0350036211f, 0.323164374f},
-std::array<float,2>{0.787853539f, 0.949376345f},
-std::array<float,2>{0.432642668f, 0.537200868f},
-std::array<float,2>{0.523482144f, 0.0520692542f},
-std::array<float,2>{0.312079161f, 0.207721457f},
-std::array<float,2>{0.74766773f, 0.710289836f},
-std::array<float,2>{0.135064691f, 0.813037813f},
-std::array<float,2>{0.959812164f, 0.468750805f},
-std::array<float,2>{0.244289696f, 0.0851725414f},
-std::array<float,2>{0.900759041f, 0.572617471f},
-std::array<float,2>{0.354098827f, 0.899053395f},
-std::array<float,2>{0.682123899f, 0.257122219f},
-std::array<float,2>{0.449148089f, 0.403962582f},
-std::array<float,2>{0.618900657f, 0.763810694f},
-std::array<float,2>{0.115059212f, 0.626389623f},
-std::array<float,2>{0.83796227f, 0.164402679f},
-std::array<float,2>{0.046990294f, 0.39062795f},
-std::array<float,2>{0.808806062f, 0.75586462f},
-std::array<float,2>{0.420790672f, 0.636182547f},
-std::array<float,2>{0.505034387f, 0.157962099f},
-std::array<float,2>{0.290961057f, 0.0907927603f},
-std::array<float,2>{0.722743392f, 0.567042649f},
-std::array<float,2>{0.154207498f, 0.89373672f},
-std::array<float,2>{0.951661468f, 0.26500991f},
-std::array<float,2>{0.221254051f, 0.218065962f},
-std::array<float,2>{0.878203988f, 0.714942455f},
-std::array<float,2>{0.366565555f, 0.822758555f},
-std::array<float,2>{0.667397499f, 0.483011305f},
-std::array<float,2>{0.46008122f, 0.318825364f},
-std::array<float,2>{0.600472391f, 0.942104399f},
-std::array<float,2>{0.100935817f, 0.540034413f},
-std::array<float,2>{0.820792198f, 0.0608588718f},
-std::array<float,2>{0.173809633f, 0.308288693f},
-std::array<float,2>{0.98549968f, 0.911128998f},
-std::array<float,2>{0.258354396f, 0.594620705f},
-std::array<float,2>{0.703440845f, 0.115681171f},
-std::array<float,2>{0.387912005f, 0.134592965f},
-std::array<float,2>{0.548132598f, 0.685879171f},
-std::array<float,2>{0.0276885442f, 0.787361324f},
-std::array<float,2>{0.778098941f, 0.417225212f},
-std::array<float,2>{0.0689865053f, 0.0227233525f},
-std::array<float,2>{0.873093307f, 0.505855083f},
-std::array<float,2>{0.477519006f, 0.975635946f},
-std::array<float,2>{0.575453639f, 0.364964336f},
-std::array<float,2>{0.324228436f, 0.468457818f},
-std::array<float,2>{0.64208132f, 0.855217814f},
-std::array<float,2>{0.214460254f, 0.732868016f},
-std::array<float,2>{0.929120243f, 0.237467289f},
-std::array<float,2>{0.192804649f, 0.492124647f},
-std::array<float,2>{0.912867308f, 0.832884133f},
-std::array<float,2>{0.340448409f, 0.693082869f},
-std::array<float,2>{0.630874395f, 0.194248036f},
-std::array<float,2>{0.499338508f, 0.0355140157f},
-std::array<float,2>{0.580360472f, 0.550611794f},
-std::array<float,2>{0.0889172181f, 0.964763701f},
-std::array<float,2>{0.846034586f, 0.334808379f},
-std::array<float,2>{0.000546419353f, 0.173501298f},
-std::array<float,2>{0.757025659f, 0.641010284f},
-std::array<float,2>{0.404280126f, 0.771354675f},
-std::array<float,2>{0.53831619f, 0.378152788f},
-std::array<float,2>{0.275414199f, 0.272176743f},
-std::array<float,2>{0.69190675f, 0.885628343f},
-std::array<float,2>{0.164674655f, 0.591878235f},
-std::array<float,2>{0.980161667f, 0.0659497157f},
-std::array<float,2>{0.111253403f, 0.349252164f},
-std::array<float,2>{0.840609908f, 0.990605712f},
-std::array<float,2>{0.449306965f, 0.524810076f},
-std::array<float,2>{0.623603821f, 0.0107841706f},
-std::array<float,2>{0.359217048f, 0.221197069f},
-std::array<float,2>{0.684099793f, 0.746850431f},
-std::array<float,2>{0.248883471f, 0.868021488f},
-std::array<float,2>{0.904851139f, 0.445823818f},
-std::array<float,2>{0.137010604f, 0.0975350067f},
-std::array<float,2>{0.955449402f, 0.614390671f},
-std::array<float,2>{0.307660729f, 0.935532451f},
-std::array<float,2>{0.743761122f, 0.288340062f},
-std::array<float,2>{0.433770835f, 0.432999253f},
-std::array<float,2>{0.528636634f, 0.80895108f},
-std::array<float,2>{0.0356295109f, 0.659570217f},
-std::array<float,2>{0.781399012f, 0.147809744f},
-std::array<float,2>{0.0791629925f, 0.441000223f},
-std::array<float,2>{0.853520155f, 0.864094615f},
-std::array<float,2>{0.490079314f, 0.737529993f},
-std::array<float,2>{0.593548238f, 0.232113019f},
-std::array<float,2>{0.331798434f, 0.000542346737f},
-std::array<float,2>{0.639386773f, 0.519933879f},
-std::array<float,2>{0.195855811f, 0.994731247f},
-std::array<float,2>{0.921787441f, 0.356077909f},
-std::array<float,2>{0.159613013f, 0.154411018f},
-std::array<float,2>{0.970140517f, 0.665511489f},
-std::array<float,2>{0.270257264f, 0.801279008f},
-std::array<float,2>{0.697016299f, 0.422991246f},
-std::array<float,2>{0.391431451f, 0.291032553f},
-std::array<float,2>{0.542523563f, 0.929407239f},
-std::array<float,2>{0.0147317611f, 0.618874967f},
-std::array<float,2>{0.76202935f, 0.10638383f},
-std::array<float,2>{0.241067097f, 0.339123636f},
-std::array<float,2>{0.89089644f, 0.956645668f},
-std::array<float,2>{0.345245123f, 0.558168232f},
-std::array<float,2>{0.676445663f, 0.0418800265f},
-std::array<float,2>{0.440719962f, 0.196346775f},
-std::array<float,2>{0.613060355f, 0.700433671f},
-std::array<float,2>{0.11997506f, 0.837926507f},
-std::array<float,2>{0.831763625f, 0.499570221f},
-std::array<float,2>{0.0444091707f, 0.0757923126f},
-std::array<float,2>{0.793071091f, 0.584035158f},
-std::array<float,2>{0.424607813f, 0.879454255f},
-std::array<float,2>{0.517246306f, 0.274569422f},
-std::array<float,2>{0.296936214f, 0.383695871f},
-std::array<float,2>{0.739230037f, 0.776806772f},
-std::array<float,2>{0.128490359f, 0.651109517f},
-std::array<float,2>{0.96672684f, 0.185225129f},
-std::array<float,2>{0.146549761f, 0.406896472f},
-std::array<float,2>{0.939735293f, 0.790866077f},
-std::array<float,2>{0.284603983f, 0.672915936f},
-std::array<float,2>{0.729035318f, 0.128109246f},
-std::array<float,2>{0.413958371f, 0.120412365f},
-std::array<float,2>{0.514110565f, 0.603923798f},
-std::array<float,2>{0.0551452413f, 0.916950405f},
-std::array<float,2>{0.800066948f, 0.300594956f},
-std::array<float,2>{0.104152754f, 0.244601592f},
-std::array<float,2>{0.814071953f, 0.722241998f},
-std::array<float,2>{0.467957616f, 0.844502032f},
-std::array<float,2>{0.605037332f, 0.45922327f},
-std::array<float,2>{0.369853646f, 0.373546153f},
-std::array<float,2>{0.659071326f, 0.978910625f},
-std::array<float,2>{0.229306132f, 0.510417998f},
-std::array<float,2>{0.885716498f, 0.0247050244f},
-std::array<float,2>{0.0225840416f, 0.250333667f},
-std::array<float,2>{0.772595704f, 0.904763877f},
-std::array<float,2>{0.380055279f, 0.577236354f},
-std::array<float,2>{0.558487236f, 0.0801356956f},
-std::array<float,2>{0.252772719f, 0.170836151f},
-std::array<float,2>{0.715610325f, 0.630092502f},
-std::array<float,2>{0.1804519f, 0.758010566f},
-std::array<float,2>{0.997172475f, 0.400622666f},
-std::array<float,2>{0.203320757f, 0.0480987988f},
-std::array<float,2>{0.930829108f, 0.533275366f},
-std::array<float,2>{0.31448099f, 0.946813941f},
-std::array<float,2>{0.656195939f, 0.327919722f},
-std::array<float,2>{0.475593448f, 0.475642264f},
-std::array<float,2>{0.569961667f, 0.819951653f},
-std::array<float,2>{0.0762243718f, 0.704052389f},
-std::array<float,2>{0.861749172f, 0.20351088f}}
\ No newline at end of file
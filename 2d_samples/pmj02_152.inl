@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.743739665f, 0.010260758f},
-std::array<float,2>{0.256704062f, 0.534247041f},
-std::array<float,2>{0.0173516721f, 0.47169289f},
-std::array<float,2>{0.767626822f, 0.75092411f},
-std::array<float,2>{0.922299206f, 0.312205434f},
-std::array<float,2>{0.190296739f, 0.99835521f},
-std::array<float,2>{0.476034105f, 0.167493403f},
-std::array<float,2>{0.609021723f, 0.710782766f},
-std::array<float,2>{0.525334656f, 0.417052686f},
-std::array<float,2>{0.407799184f, 0.857469261f},
-std::array<float,2>{0.132895976f, 0.0776405558f},
-std::array<float,2>{0.943714559f, 0.616248786f},
-std::array<float,2>{0.856797636f, 0.219255731f},
-std::array<float,2>{0.115554258f, 0.639494658f},
-std::array<float,2>{0.350000322f, 0.347342134f},
-std::array<float,2>{0.646692216f, 0.906681299f},
-std::array<float,2>{0.564165831f, 0.13841334f},
-std::array<float,2>{0.439808369f, 0.72319895f},
-std::array<float,2>{0.240996733f, 0.262100101f},
-std::array<float,2>{0.902319372f, 0.943961859f},
-std::array<float,2>{0.802012622f, 0.448159546f},
-std::array<float,2>{0.0312574022f, 0.792349756f},
-std::array<float,2>{0.292639762f, 0.035490606f},
-std::array<float,2>{0.7186535f, 0.53009814f},
-std::array<float,2>{0.669636726f, 0.3155725f},
-std::array<float,2>{0.338082463f, 0.904189646f},
-std::array<float,2>{0.0767679587f, 0.215010956f},
-std::array<float,2>{0.828355968f, 0.663504183f},
-std::array<float,2>{0.993091345f, 0.112022564f},
-std::array<float,2>{0.158925459f, 0.570622146f},
-std::array<float,2>{0.384137332f, 0.38727355f},
-std::array<float,2>{0.532705784f, 0.841286123f},
-std::array<float,2>{0.629574955f, 0.188021675f},
-std::array<float,2>{0.360716999f, 0.672533572f},
-std::array<float,2>{0.0957180709f, 0.343144387f},
-std::array<float,2>{0.866946518f, 0.888662696f},
-std::array<float,2>{0.960793257f, 0.402040839f},
-std::array<float,2>{0.150264159f, 0.824424863f},
-std::array<float,2>{0.429715484f, 0.0992956758f},
-std::array<float,2>{0.507229805f, 0.583800435f},
-std::array<float,2>{0.619712472f, 0.266206652f},
-std::array<float,2>{0.487499297f, 0.962448418f},
-std::array<float,2>{0.214278027f, 0.140725896f},
-std::array<float,2>{0.910425067f, 0.745278001f},
-std::array<float,2>{0.752424836f, 0.0495481603f},
-std::array<float,2>{0.0107720615f, 0.501129329f},
-std::array<float,2>{0.270737648f, 0.46730417f},
-std::array<float,2>{0.730066538f, 0.805905402f},
-std::array<float,2>{0.555866897f, 0.0854692534f},
-std::array<float,2>{0.393518806f, 0.606524706f},
-std::array<float,2>{0.18188782f, 0.436274707f},
-std::array<float,2>{0.977424741f, 0.866226017f},
-std::array<float,2>{0.814414322f, 0.374174476f},
-std::array<float,2>{0.0885743946f, 0.932103872f},
-std::array<float,2>{0.314231426f, 0.238110408f},
-std::array<float,2>{0.674051225f, 0.644009233f},
-std::array<float,2>{0.691035688f, 0.48556155f},
-std::array<float,2>{0.311770499f, 0.776893079f},
-std::array<float,2>{0.0580010563f, 0.0281699244f},
-std::array<float,2>{0.790344656f, 0.556730807f},
-std::array<float,2>{0.884163976f, 0.173393965f},
-std::array<float,2>{0.232757941f, 0.700951993f},
-std::array<float,2>{0.466399848f, 0.285529882f},
-std::array<float,2>{0.592822313f, 0.974738181f},
-std::array<float,2>{0.682578325f, 0.109003194f},
-std::array<float,2>{0.327645689f, 0.590098202f},
-std::array<float,2>{0.0822398067f, 0.392144054f},
-std::array<float,2>{0.821622968f, 0.81468761f},
-std::array<float,2>{0.972201467f, 0.333019853f},
-std::array<float,2>{0.174706459f, 0.880932987f},
-std::array<float,2>{0.402330041f, 0.195937306f},
-std::array<float,2>{0.549172044f, 0.681397021f},
-std::array<float,2>{0.584758997f, 0.456419498f},
-std::array<float,2>{0.454352587f, 0.79973197f},
-std::array<float,2>{0.221973523f, 0.0558218099f},
-std::array<float,2>{0.879956126f, 0.510808408f},
-std::array<float,2>{0.784200966f, 0.153242931f},
-std::array<float,2>{0.054673586f, 0.735851705f},
-std::array<float,2>{0.301563233f, 0.276145399f},
-std::array<float,2>{0.700373113f, 0.958192647f},
-std::array<float,2>{0.514756441f, 0.245744422f},
-std::array<float,2>{0.422761321f, 0.656187892f},
-std::array<float,2>{0.145109117f, 0.361095011f},
-std::array<float,2>{0.962072909f, 0.92783767f},
-std::array<float,2>{0.871346653f, 0.423776388f},
-std::array<float,2>{0.106388852f, 0.867860496f},
-std::array<float,2>{0.372716963f, 0.0897769108f},
-std::array<float,2>{0.634375274f, 0.599357724f},
-std::array<float,2>{0.719784379f, 0.294619143f},
-std::array<float,2>{0.274960458f, 0.977058113f},
-std::array<float,2>{0.00572403613f, 0.180000588f},
-std::array<float,2>{0.760925651f, 0.695187092f},
-std::array<float,2>{0.921142876f, 0.0210449081f},
-std::array<float,2>{0.206758797f, 0.554609478f},
-std::array<float,2>{0.49359566f, 0.499774039f},
-std::array<float,2>{0.610066772f, 0.767742157f},
-std::array<float,2>{0.70759213f, 0.157119766f},
-std::array<float,2>{0.281416982f, 0.714372218f},
-std::array<float,2>{0.0459852032f, 0.298570126f},
-std::array<float,2>{0.812119961f, 0.989847541f},
-std::array<float,2>{0.897617161f, 0.481991827f},
-std::array<float,2>{0.245513871f, 0.765182555f},
-std::array<float,2>{0.447062641f, 0.00378366373f},
-std::array<float,2>{0.576595306f, 0.540541053f},
-std::array<float,2>{0.543774307f, 0.357762337f},
-std::array<float,2>{0.379420161f, 0.917822957f},
-std::array<float,2>{0.167663783f, 0.229444325f},
-std::array<float,2>{0.985826254f, 0.63187623f},
-std::array<float,2>{0.838349879f, 0.0661360472f},
-std::array<float,2>{0.068504326f, 0.620658815f},
-std::array<float,2>{0.333653599f, 0.410872489f},
-std::array<float,2>{0.662475467f, 0.851328671f},
-std::array<float,2>{0.593810499f, 0.0444299057f},
-std::array<float,2>{0.482639194f, 0.52256f},
-std::array<float,2>{0.196201175f, 0.43803525f},
-std::array<float,2>{0.934955657f, 0.785067856f},
-std::array<float,2>{0.77948755f, 0.254097909f},
-std::array<float,2>{0.0301504042f, 0.946975112f},
-std::array<float,2>{0.259694636f, 0.12957944f},
-std::array<float,2>{0.738764286f, 0.72788924f},
-std::array<float,2>{0.654084921f, 0.381870627f},
-std::array<float,2>{0.352651f, 0.830527127f},
-std::array<float,2>{0.124600321f, 0.11860466f},
-std::array<float,2>{0.843789637f, 0.56624341f},
-std::array<float,2>{0.952464759f, 0.203319311f},
-std::array<float,2>{0.125213817f, 0.670436978f},
-std::array<float,2>{0.417176843f, 0.321887434f},
-std::array<float,2>{0.519401193f, 0.897535086f},
-std::array<float,2>{0.643529952f, 0.0591204129f},
-std::array<float,2>{0.344301611f, 0.514081001f},
-std::array<float,2>{0.111654364f, 0.460001141f},
-std::array<float,2>{0.854682326f, 0.801570892f},
-std::array<float,2>{0.940408707f, 0.278294742f},
-std::array<float,2>{0.13989374f, 0.953360796f},
-std::array<float,2>{0.412433028f, 0.149041489f},
-std::array<float,2>{0.527860045f, 0.740004122f},
-std::array<float,2>{0.603137851f, 0.398268908f},
-std::array<float,2>{0.471105218f, 0.818661928f},
-std::array<float,2>{0.192983776f, 0.103381418f},
-std::array<float,2>{0.927159965f, 0.589302838f},
-std::array<float,2>{0.772763014f, 0.200085163f},
-std::array<float,2>{0.0207330883f, 0.687056243f},
-std::array<float,2>{0.253825724f, 0.329489529f},
-std::array<float,2>{0.746152997f, 0.878221154f},
-std::array<float,2>{0.5390504f, 0.186526909f},
-std::array<float,2>{0.389579028f, 0.688941538f},
-std::array<float,2>{0.163864434f, 0.291280299f},
-std::array<float,2>{0.999555111f, 0.983555377f},
-std::array<float,2>{0.833830118f, 0.496061146f},
-std::array<float,2>{0.0725613162f, 0.77254796f},
-std::array<float,2>{0.342046887f, 0.016073944f},
-std::array<float,2>{0.66716373f, 0.550202787f},
-std::array<float,2>{0.712910652f, 0.365157574f},
-std::array<float,2>{0.295972228f, 0.925282419f},
-std::array<float,2>{0.0361274034f, 0.248816863f},
-std::array<float,2>{0.799972832f, 0.650838971f},
-std::array<float,2>{0.90530467f, 0.09232191f},
-std::array<float,2>{0.236083239f, 0.596868217f},
-std::array<float,2>{0.444196939f, 0.42675668f},
-std::array<float,2>{0.568852067f, 0.872396648f},
-std::array<float,2>{0.730675578f, 0.23362495f},
-std::array<float,2>{0.266486555f, 0.627657056f},
-std::array<float,2>{0.0129060512f, 0.354975879f},
-std::array<float,2>{0.757506609f, 0.921678245f},
-std::array<float,2>{0.906424999f, 0.40853402f},
-std::array<float,2>{0.218712255f, 0.846293807f},
-std::array<float,2>{0.489454895f, 0.0672900975f},
-std::array<float,2>{0.621635497f, 0.623706162f},
-std::array<float,2>{0.502626896f, 0.302160263f},
-std::array<float,2>{0.435958296f, 0.986547112f},
-std::array<float,2>{0.154949799f, 0.163845778f},
-std::array<float,2>{0.954331398f, 0.716667235f},
-std::array<float,2>{0.860471606f, 0.00607186835f},
-std::array<float,2>{0.100648969f, 0.545387089f},
-std::array<float,2>{0.366846144f, 0.478935719f},
-std::array<float,2>{0.628386497f, 0.760027468f},
-std::array<float,2>{0.588197052f, 0.124660082f},
-std::array<float,2>{0.463015139f, 0.566846013f},
-std::array<float,2>{0.229993507f, 0.377496004f},
-std::array<float,2>{0.888807297f, 0.833491504f},
-std::array<float,2>{0.795704961f, 0.325525999f},
-std::array<float,2>{0.0591198243f, 0.894073486f},
-std::array<float,2>{0.30852133f, 0.209157005f},
-std::array<float,2>{0.691642463f, 0.664210856f},
-std::array<float,2>{0.676264822f, 0.443073094f},
-std::array<float,2>{0.319634974f, 0.785731614f},
-std::array<float,2>{0.0898458362f, 0.0410265028f},
-std::array<float,2>{0.816995621f, 0.51773417f},
-std::array<float,2>{0.98220706f, 0.126215428f},
-std::array<float,2>{0.186329484f, 0.733469844f},
-std::array<float,2>{0.395633519f, 0.251639724f},
-std::array<float,2>{0.560443342f, 0.949978769f},
-std::array<float,2>{0.695333421f, 0.0712390319f},
-std::array<float,2>{0.298630953f, 0.611530721f},
-std::array<float,2>{0.0488737337f, 0.420977652f},
-std::array<float,2>{0.786049962f, 0.854448199f},
-std::array<float,2>{0.876309991f, 0.351083219f},
-std::array<float,2>{0.222997919f, 0.911839902f},
-std::array<float,2>{0.459330469f, 0.226048812f},
-std::array<float,2>{0.581892073f, 0.636458576f},
-std::array<float,2>{0.551188469f, 0.476082236f},
-std::array<float,2>{0.403020442f, 0.755953848f},
-std::array<float,2>{0.177115873f, 0.0155334212f},
-std::array<float,2>{0.97356236f, 0.537659347f},
-std::array<float,2>{0.82710427f, 0.1706312f},
-std::array<float,2>{0.0800105929f, 0.705741227f},
-std::array<float,2>{0.323868066f, 0.305915505f},
-std::array<float,2>{0.687450528f, 0.994172871f},
-std::array<float,2>{0.615896642f, 0.214621961f},
-std::array<float,2>{0.498437405f, 0.65847975f},
-std::array<float,2>{0.210437968f, 0.318671107f},
-std::array<float,2>{0.916974604f, 0.900529683f},
-std::array<float,2>{0.764991403f, 0.386637479f},
-std::array<float,2>{0.00221116468f, 0.839649379f},
-std::array<float,2>{0.27810362f, 0.114050694f},
-std::array<float,2>{0.723364055f, 0.575547695f},
-std::array<float,2>{0.637622535f, 0.261627346f},
-std::array<float,2>{0.367768705f, 0.93859303f},
-std::array<float,2>{0.104263537f, 0.134102196f},
-std::array<float,2>{0.869492412f, 0.719519734f},
-std::array<float,2>{0.966494262f, 0.0330779254f},
-std::array<float,2>{0.142649427f, 0.524627268f},
-std::array<float,2>{0.426704794f, 0.451380104f},
-std::array<float,2>{0.509682596f, 0.794263601f},
-std::array<float,2>{0.65935868f, 0.147692323f},
-std::array<float,2>{0.32923758f, 0.748746753f},
-std::array<float,2>{0.0648699552f, 0.27187255f},
-std::array<float,2>{0.843050301f, 0.967417479f},
-std::array<float,2>{0.990181923f, 0.463858038f},
-std::array<float,2>{0.171764418f, 0.812005997f},
-std::array<float,2>{0.376974881f, 0.0524106026f},
-std::array<float,2>{0.541426003f, 0.504716337f},
-std::array<float,2>{0.571650624f, 0.33935979f},
-std::array<float,2>{0.45112136f, 0.884316444f},
-std::array<float,2>{0.249449447f, 0.192928582f},
-std::array<float,2>{0.892066598f, 0.677565098f},
-std::array<float,2>{0.804872274f, 0.097182408f},
-std::array<float,2>{0.0413455442f, 0.578706861f},
-std::array<float,2>{0.28551659f, 0.404192835f},
-std::array<float,2>{0.704092026f, 0.821834266f},
-std::array<float,2>{0.522572041f, 0.0265410226f},
-std::array<float,2>{0.418877095f, 0.560210764f},
-std::array<float,2>{0.131669372f, 0.489027292f},
-std::array<float,2>{0.947732151f, 0.780493259f},
-std::array<float,2>{0.850071967f, 0.283998817f},
-std::array<float,2>{0.118218526f, 0.970380843f},
-std::array<float,2>{0.358019114f, 0.179451138f},
-std::array<float,2>{0.651096821f, 0.695957303f},
-std::array<float,2>{0.738227904f, 0.432155162f},
-std::array<float,2>{0.264623791f, 0.859836102f},
-std::array<float,2>{0.0272800755f, 0.0816229209f},
-std::array<float,2>{0.774898469f, 0.603530884f},
-std::array<float,2>{0.931481183f, 0.240589038f},
-std::array<float,2>{0.202485099f, 0.647499382f},
-std::array<float,2>{0.480389982f, 0.36953336f},
-std::array<float,2>{0.601203501f, 0.934395909f},
-std::array<float,2>{0.714860797f, 0.0373912789f},
-std::array<float,2>{0.289290994f, 0.527454615f},
-std::array<float,2>{0.0336840264f, 0.446386695f},
-std::array<float,2>{0.802893102f, 0.79067862f},
-std::array<float,2>{0.899914443f, 0.265240371f},
-std::array<float,2>{0.239899814f, 0.942596674f},
-std::array<float,2>{0.438571692f, 0.139794007f},
-std::array<float,2>{0.564700425f, 0.724967957f},
-std::array<float,2>{0.534012318f, 0.389422894f},
-std::array<float,2>{0.386446923f, 0.842836618f},
-std::array<float,2>{0.157448262f, 0.110240228f},
-std::array<float,2>{0.995114863f, 0.573812723f},
-std::array<float,2>{0.83022058f, 0.218473554f},
-std::array<float,2>{0.0743327066f, 0.661314189f},
-std::array<float,2>{0.336285979f, 0.312505007f},
-std::array<float,2>{0.670707524f, 0.904499412f},
-std::array<float,2>{0.605705619f, 0.164082631f},
-std::array<float,2>{0.474433422f, 0.707576692f},
-std::array<float,2>{0.187664866f, 0.309443265f},
-std::array<float,2>{0.924642086f, 0.99705261f},
-std::array<float,2>{0.767546356f, 0.469582856f},
-std::array<float,2>{0.018227905f, 0.752195299f},
-std::array<float,2>{0.253915787f, 0.00840397179f},
-std::array<float,2>{0.744670749f, 0.531252444f},
-std::array<float,2>{0.644596636f, 0.345569044f},
-std::array<float,2>{0.347740948f, 0.909977138f},
-std::array<float,2>{0.115083076f, 0.221431583f},
-std::array<float,2>{0.858673573f, 0.636831641f},
-std::array<float,2>{0.941591501f, 0.0748075172f},
-std::array<float,2>{0.134802058f, 0.614392936f},
-std::array<float,2>{0.409554362f, 0.415807754f},
-std::array<float,2>{0.527103782f, 0.85590589f},
-std::array<float,2>{0.67302978f, 0.235993057f},
-std::array<float,2>{0.314622998f, 0.641948223f},
-std::array<float,2>{0.0870733857f, 0.372178912f},
-std::array<float,2>{0.815764964f, 0.930045128f},
-std::array<float,2>{0.979220569f, 0.433632582f},
-std::array<float,2>{0.180076972f, 0.865055382f},
-std::array<float,2>{0.39079842f, 0.0831860974f},
-std::array<float,2>{0.557980895f, 0.608982921f},
-std::array<float,2>{0.589847982f, 0.287307262f},
-std::array<float,2>{0.467406839f, 0.973809958f},
-std::array<float,2>{0.231690913f, 0.174162835f},
-std::array<float,2>{0.885144651f, 0.701421022f},
-std::array<float,2>{0.791346312f, 0.0293378346f},
-std::array<float,2>{0.0549661852f, 0.554769158f},
-std::array<float,2>{0.309345543f, 0.487210691f},
-std::array<float,2>{0.688425541f, 0.774732053f},
-std::array<float,2>{0.505168259f, 0.101343907f},
-std::array<float,2>{0.432418376f, 0.585062087f},
-std::array<float,2>{0.15155454f, 0.399374098f},
-std::array<float,2>{0.957467556f, 0.826601923f},
-std::array<float,2>{0.864714921f, 0.341510117f},
-std::array<float,2>{0.0948974192f, 0.890220344f},
-std::array<float,2>{0.3625139f, 0.189752311f},
-std::array<float,2>{0.632028997f, 0.674503207f},
-std::array<float,2>{0.727958202f, 0.466585547f},
-std::array<float,2>{0.273077577f, 0.808038592f},
-std::array<float,2>{0.0087506175f, 0.0473032407f},
-std::array<float,2>{0.750283837f, 0.50270474f},
-std::array<float,2>{0.913360476f, 0.14378424f},
-std::array<float,2>{0.211339548f, 0.742502511f},
-std::array<float,2>{0.484937578f, 0.268485069f},
-std::array<float,2>{0.618839741f, 0.963778079f},
-std::array<float,2>{0.636471927f, 0.0861045867f},
-std::array<float,2>{0.374384761f, 0.600478292f},
-std::array<float,2>{0.10929203f, 0.425095737f},
-std::array<float,2>{0.873451471f, 0.869204462f},
-std::array<float,2>{0.964051008f, 0.363082439f},
-std::array<float,2>{0.146921605f, 0.926690459f},
-std::array<float,2>{0.42470029f, 0.243514732f},
-std::array<float,2>{0.513100564f, 0.653630257f},
-std::array<float,2>{0.611739814f, 0.497663438f},
-std::array<float,2>{0.495732993f, 0.76685828f},
-std::array<float,2>{0.203640282f, 0.0227030944f},
-std::array<float,2>{0.918168485f, 0.552065253f},
-std::array<float,2>{0.758604109f, 0.182603076f},
-std::array<float,2>{0.00681772502f, 0.693269908f},
-std::array<float,2>{0.276697427f, 0.295173258f},
-std::array<float,2>{0.722222149f, 0.979067743f},
-std::array<float,2>{0.546986461f, 0.197786361f},
-std::array<float,2>{0.399426758f, 0.682717323f},
-std::array<float,2>{0.173759237f, 0.334240139f},
-std::array<float,2>{0.969020605f, 0.879080832f},
-std::array<float,2>{0.822429001f, 0.393137097f},
-std::array<float,2>{0.0854526088f, 0.813501179f},
-std::array<float,2>{0.325223476f, 0.107146591f},
-std::array<float,2>{0.680660367f, 0.593364596f},
-std::array<float,2>{0.702685475f, 0.273906827f},
-std::array<float,2>{0.303925633f, 0.959551036f},
-std::array<float,2>{0.0517970473f, 0.15455541f},
-std::array<float,2>{0.781914651f, 0.737341285f},
-std::array<float,2>{0.882411361f, 0.0584137775f},
-std::array<float,2>{0.218803972f, 0.509190679f},
-std::array<float,2>{0.456467122f, 0.454964191f},
-std::array<float,2>{0.583051145f, 0.796920776f},
-std::array<float,2>{0.740814388f, 0.132108092f},
-std::array<float,2>{0.260727137f, 0.730000973f},
-std::array<float,2>{0.0287444834f, 0.256316811f},
-std::array<float,2>{0.77803266f, 0.948658168f},
-std::array<float,2>{0.937260568f, 0.440618247f},
-std::array<float,2>{0.19897671f, 0.781517625f},
-std::array<float,2>{0.481073767f, 0.0459632277f},
-std::array<float,2>{0.596762955f, 0.520866036f},
-std::array<float,2>{0.5167557f, 0.323985785f},
-std::array<float,2>{0.41573751f, 0.896462202f},
-std::array<float,2>{0.128070027f, 0.205726266f},
-std::array<float,2>{0.95079565f, 0.669149339f},
-std::array<float,2>{0.845988214f, 0.120526403f},
-std::array<float,2>{0.122447386f, 0.562821329f},
-std::array<float,2>{0.354913622f, 0.380463749f},
-std::array<float,2>{0.655847669f, 0.82963562f},
-std::array<float,2>{0.575171769f, 0.00125640258f},
-std::array<float,2>{0.447507352f, 0.542874396f},
-std::array<float,2>{0.243342414f, 0.483194947f},
-std::array<float,2>{0.895859659f, 0.762582719f},
-std::array<float,2>{0.809637487f, 0.2998932f},
-std::array<float,2>{0.0447597392f, 0.990753233f},
-std::array<float,2>{0.284328192f, 0.160027847f},
-std::array<float,2>{0.709422648f, 0.711598635f},
-std::array<float,2>{0.660626829f, 0.413122505f},
-std::array<float,2>{0.335545361f, 0.848529577f},
-std::array<float,2>{0.0680475682f, 0.0631034598f},
-std::array<float,2>{0.837764084f, 0.617343485f},
-std::array<float,2>{0.986543238f, 0.227281228f},
-std::array<float,2>{0.165770561f, 0.628917396f},
-std::array<float,2>{0.381167471f, 0.357278228f},
-std::array<float,2>{0.546328843f, 0.91409868f},
-std::array<float,2>{0.665535629f, 0.0182248447f},
-std::array<float,2>{0.340869248f, 0.548050821f},
-std::array<float,2>{0.0714606196f, 0.493021071f},
-std::array<float,2>{0.835572839f, 0.769770741f},
-std::array<float,2>{0.996324718f, 0.2906501f},
-std::array<float,2>{0.160744235f, 0.982230484f},
-std::array<float,2>{0.386996657f, 0.185193643f},
-std::array<float,2>{0.536183774f, 0.689480305f},
-std::array<float,2>{0.567386866f, 0.428280234f},
-std::array<float,2>{0.443228096f, 0.873498499f},
-std::array<float,2>{0.238089025f, 0.0910231471f},
-std::array<float,2>{0.903377891f, 0.594499588f},
-std::array<float,2>{0.797871649f, 0.247848287f},
-std::array<float,2>{0.038084317f, 0.649692535f},
-std::array<float,2>{0.293933064f, 0.36612311f},
-std::array<float,2>{0.711919844f, 0.922571123f},
-std::array<float,2>{0.530104995f, 0.151414216f},
-std::array<float,2>{0.410923272f, 0.741116881f},
-std::array<float,2>{0.137456983f, 0.279652536f},
-std::array<float,2>{0.937941313f, 0.955643952f},
-std::array<float,2>{0.852418542f, 0.458493263f},
-std::array<float,2>{0.110738732f, 0.804083824f},
-std::array<float,2>{0.346943349f, 0.0616467223f},
-std::array<float,2>{0.641362488f, 0.511888742f},
-std::array<float,2>{0.748927891f, 0.331502527f},
-std::array<float,2>{0.250320703f, 0.875409663f},
-std::array<float,2>{0.0222223122f, 0.201584816f},
-std::array<float,2>{0.771252453f, 0.684726894f},
-std::array<float,2>{0.928046227f, 0.103584379f},
-std::array<float,2>{0.194766194f, 0.587446749f},
-std::array<float,2>{0.46971041f, 0.394700468f},
-std::array<float,2>{0.604206562f, 0.817313135f},
-std::array<float,2>{0.694251597f, 0.208431765f},
-std::array<float,2>{0.306531966f, 0.666016221f},
-std::array<float,2>{0.0609671213f, 0.327447951f},
-std::array<float,2>{0.794015348f, 0.892141044f},
-std::array<float,2>{0.888508797f, 0.375934005f},
-std::array<float,2>{0.22701472f, 0.834343135f},
-std::array<float,2>{0.46232304f, 0.122056693f},
-std::array<float,2>{0.58647567f, 0.569011211f},
-std::array<float,2>{0.561456263f, 0.252852052f},
-std::array<float,2>{0.397411555f, 0.952772737f},
-std::array<float,2>{0.185486764f, 0.127306208f},
-std::array<float,2>{0.9841609f, 0.730755031f},
-std::array<float,2>{0.818597376f, 0.0398515388f},
-std::array<float,2>{0.0931978002f, 0.517196894f},
-std::array<float,2>{0.316477448f, 0.443606645f},
-std::array<float,2>{0.679177105f, 0.788427711f},
-std::array<float,2>{0.624832034f, 0.0694263428f},
-std::array<float,2>{0.49102971f, 0.622174025f},
-std::array<float,2>{0.215242758f, 0.407574564f},
-std::array<float,2>{0.909758985f, 0.845088243f},
-std::array<float,2>{0.754040539f, 0.352599651f},
-std::array<float,2>{0.0149534876f, 0.918610871f},
-std::array<float,2>{0.269406974f, 0.231247693f},
-std::array<float,2>{0.733878136f, 0.626442015f},
-std::array<float,2>{0.62629652f, 0.477131069f},
-std::array<float,2>{0.363405854f, 0.759653509f},
-std::array<float,2>{0.0978900343f, 0.00455070846f},
-std::array<float,2>{0.863224804f, 0.543636858f},
-std::array<float,2>{0.955222189f, 0.161040783f},
-std::array<float,2>{0.153090447f, 0.717841566f},
-std::array<float,2>{0.433764517f, 0.304634005f},
-std::array<float,2>{0.501677454f, 0.986273885f},
-std::array<float,2>{0.724615991f, 0.11544057f},
-std::array<float,2>{0.280744642f, 0.576892376f},
-std::array<float,2>{0.00140563236f, 0.384125352f},
-std::array<float,2>{0.763325095f, 0.836421132f},
-std::array<float,2>{0.915563464f, 0.31697908f},
-std::array<float,2>{0.207536176f, 0.900310099f},
-std::array<float,2>{0.497690469f, 0.211455971f},
-std::array<float,2>{0.614087582f, 0.657216311f},
-std::array<float,2>{0.51003927f, 0.449647486f},
-std::array<float,2>{0.428924322f, 0.795287013f},
-std::array<float,2>{0.142231122f, 0.0338745452f},
-std::array<float,2>{0.967160404f, 0.526267648f},
-std::array<float,2>{0.86841923f, 0.135213956f},
-std::array<float,2>{0.102546118f, 0.721886992f},
-std::array<float,2>{0.369540483f, 0.259117663f},
-std::array<float,2>{0.639252007f, 0.940354049f},
-std::array<float,2>{0.578343451f, 0.223032922f},
-std::array<float,2>{0.457406044f, 0.632872105f},
-std::array<float,2>{0.225127682f, 0.348557979f},
-std::array<float,2>{0.877600789f, 0.913746059f},
-std::array<float,2>{0.788996458f, 0.418102264f},
-std::array<float,2>{0.0473819785f, 0.851896465f},
-std::array<float,2>{0.299139231f, 0.074143067f},
-std::array<float,2>{0.698169947f, 0.611188233f},
-std::array<float,2>{0.683805346f, 0.307447165f},
-std::array<float,2>{0.32057029f, 0.992384911f},
-std::array<float,2>{0.0810275227f, 0.169627398f},
-std::array<float,2>{0.825871348f, 0.704910815f},
-std::array<float,2>{0.975773633f, 0.0119598182f},
-std::array<float,2>{0.179489955f, 0.536760211f},
-std::array<float,2>{0.404680461f, 0.473538995f},
-std::array<float,2>{0.554474294f, 0.754596651f},
-std::array<float,2>{0.649384379f, 0.177601233f},
-std::array<float,2>{0.355632275f, 0.699107349f},
-std::array<float,2>{0.120259568f, 0.282850534f},
-std::array<float,2>{0.849388242f, 0.97200793f},
-std::array<float,2>{0.946945131f, 0.490846902f},
-std::array<float,2>{0.130383044f, 0.778797567f},
-std::array<float,2>{0.420630753f, 0.023623962f},
-std::array<float,2>{0.52108717f, 0.561321795f},
-std::array<float,2>{0.599549472f, 0.368074089f},
-std::array<float,2>{0.476710826f, 0.937240064f},
-std::array<float,2>{0.2010452f, 0.238970831f},
-std::array<float,2>{0.933344543f, 0.645084798f},
-std::array<float,2>{0.776281059f, 0.0783789381f},
-std::array<float,2>{0.0250809006f, 0.603307009f},
-std::array<float,2>{0.263459057f, 0.429794401f},
-std::array<float,2>{0.735328913f, 0.862951934f},
-std::array<float,2>{0.540321946f, 0.0529190823f},
-std::array<float,2>{0.375212967f, 0.506049991f},
-std::array<float,2>{0.169201851f, 0.462505162f},
-std::array<float,2>{0.99173373f, 0.810466349f},
-std::array<float,2>{0.84164232f, 0.27079758f},
-std::array<float,2>{0.0636875257f, 0.965074718f},
-std::array<float,2>{0.330582887f, 0.144544378f},
-std::array<float,2>{0.656933486f, 0.746160328f},
-std::array<float,2>{0.706709802f, 0.405068696f},
-std::array<float,2>{0.288587928f, 0.822893858f},
-std::array<float,2>{0.0405091681f, 0.09542799f},
-std::array<float,2>{0.806932747f, 0.581441104f},
-std::array<float,2>{0.893398643f, 0.193669826f},
-std::array<float,2>{0.24674204f, 0.679111004f},
-std::array<float,2>{0.452742398f, 0.337753385f},
-std::array<float,2>{0.573634028f, 0.885033607f},
-std::array<float,2>{0.689239323f, 0.0289804619f},
-std::array<float,2>{0.310433596f, 0.557654321f},
-std::array<float,2>{0.0562503822f, 0.485209048f},
-std::array<float,2>{0.792946935f, 0.775641382f},
-std::array<float,2>{0.886108935f, 0.287103802f},
-std::array<float,2>{0.231432274f, 0.976137877f},
-std::array<float,2>{0.468328416f, 0.172174856f},
-std::array<float,2>{0.590829968f, 0.699818969f},
-std::array<float,2>{0.556936562f, 0.437091619f},
-std::array<float,2>{0.392244965f, 0.865968049f},
-std::array<float,2>{0.180813387f, 0.0847415924f},
-std::array<float,2>{0.979801834f, 0.606149673f},
-std::array<float,2>{0.814471245f, 0.236922026f},
-std::array<float,2>{0.0860253572f, 0.642650485f},
-std::array<float,2>{0.316402286f, 0.373922557f},
-std::array<float,2>{0.672084749f, 0.933587849f},
-std::array<float,2>{0.617323577f, 0.14163208f},
-std::array<float,2>{0.485866994f, 0.744861722f},
-std::array<float,2>{0.212776288f, 0.266957939f},
-std::array<float,2>{0.913006961f, 0.961427927f},
-std::array<float,2>{0.751449466f, 0.467787176f},
-std::array<float,2>{0.00932804774f, 0.805265665f},
-std::array<float,2>{0.271877497f, 0.050239969f},
-std::array<float,2>{0.726825476f, 0.500387132f},
-std::array<float,2>{0.630918026f, 0.341885716f},
-std::array<float,2>{0.362225652f, 0.886951864f},
-std::array<float,2>{0.0942466557f, 0.188865408f},
-std::array<float,2>{0.863629103f, 0.673149824f},
-std::array<float,2>{0.958338261f, 0.0981536061f},
-std::array<float,2>{0.151284441f, 0.582160294f},
-std::array<float,2>{0.433481038f, 0.401099384f},
-std::array<float,2>{0.504065752f, 0.82575202f},
-std::array<float,2>{0.671112478f, 0.216762945f},
-std::array<float,2>{0.337599218f, 0.662751377f},
-std::array<float,2>{0.0760533139f, 0.314751834f},
-std::array<float,2>{0.831384003f, 0.902923226f},
-std::array<float,2>{0.995414078f, 0.387884259f},
-std::array<float,2>{0.156727508f, 0.840128541f},
-std::array<float,2>{0.385103911f, 0.112917855f},
-std::array<float,2>{0.534991443f, 0.571941853f},
-std::array<float,2>{0.566073537f, 0.263097227f},
-std::array<float,2>{0.437650234f, 0.944426656f},
-std::array<float,2>{0.238620549f, 0.137453079f},
-std::array<float,2>{0.898672938f, 0.724539876f},
-std::array<float,2>{0.804021478f, 0.0370821692f},
-std::array<float,2>{0.0344466716f, 0.531041324f},
-std::array<float,2>{0.290349662f, 0.448838681f},
-std::array<float,2>{0.716188073f, 0.791258991f},
-std::array<float,2>{0.525672793f, 0.0769308582f},
-std::array<float,2>{0.408440322f, 0.615500212f},
-std::array<float,2>{0.136154324f, 0.416035146f},
-std::array<float,2>{0.943352759f, 0.859358847f},
-std::array<float,2>{0.858000934f, 0.346621037f},
-std::array<float,2>{0.113496616f, 0.907955885f},
-std::array<float,2>{0.34891665f, 0.219923288f},
-std::array<float,2>{0.646002769f, 0.640334547f},
-std::array<float,2>{0.745165169f, 0.471526176f},
-std::array<float,2>{0.255789369f, 0.751812577f},
-std::array<float,2>{0.0188357718f, 0.0107952859f},
-std::array<float,2>{0.766215503f, 0.534071207f},
-std::array<float,2>{0.925669432f, 0.166239783f},
-std::array<float,2>{0.188668892f, 0.709388196f},
-std::array<float,2>{0.47279036f, 0.310878515f},
-std::array<float,2>{0.607127666f, 0.99972862f},
-std::array<float,2>{0.65488863f, 0.118073367f},
-std::array<float,2>{0.354060709f, 0.564696312f},
-std::array<float,2>{0.121404253f, 0.380997956f},
-std::array<float,2>{0.847110152f, 0.831172407f},
-std::array<float,2>{0.950127542f, 0.320844114f},
-std::array<float,2>{0.127913088f, 0.897361517f},
-std::array<float,2>{0.414724886f, 0.204951212f},
-std::array<float,2>{0.516308486f, 0.671735108f},
-std::array<float,2>{0.596328616f, 0.439052403f},
-std::array<float,2>{0.482129723f, 0.78333205f},
-std::array<float,2>{0.198054358f, 0.0438677073f},
-std::array<float,2>{0.936026335f, 0.521766245f},
-std::array<float,2>{0.778738558f, 0.130567461f},
-std::array<float,2>{0.0277793072f, 0.726563096f},
-std::array<float,2>{0.261354327f, 0.255543679f},
-std::array<float,2>{0.741624057f, 0.945604444f},
-std::array<float,2>{0.545309126f, 0.230254039f},
-std::array<float,2>{0.382438481f, 0.63174957f},
-std::array<float,2>{0.164537624f, 0.358581692f},
-std::array<float,2>{0.987356961f, 0.916236818f},
-std::array<float,2>{0.836012483f, 0.412005544f},
-std::array<float,2>{0.0666521192f, 0.850542605f},
-std::array<float,2>{0.334850788f, 0.0647008419f},
-std::array<float,2>{0.661320388f, 0.620106578f},
-std::array<float,2>{0.710135221f, 0.296893209f},
-std::array<float,2>{0.284072101f, 0.988823175f},
-std::array<float,2>{0.0437721312f, 0.157781094f},
-std::array<float,2>{0.809197724f, 0.713821411f},
-std::array<float,2>{0.894604862f, 0.00212938455f},
-std::array<float,2>{0.242534712f, 0.539737284f},
-std::array<float,2>{0.448595256f, 0.481174231f},
-std::array<float,2>{0.575653553f, 0.763874948f},
-std::array<float,2>{0.721051991f, 0.181197345f},
-std::array<float,2>{0.276350379f, 0.69424355f},
-std::array<float,2>{0.0074427668f, 0.293808281f},
-std::array<float,2>{0.758932173f, 0.978069663f},
-std::array<float,2>{0.919815302f, 0.498404622f},
-std::array<float,2>{0.20418404f, 0.769453704f},
-std::array<float,2>{0.495051622f, 0.0197734758f},
-std::array<float,2>{0.612392783f, 0.553395391f},
-std::array<float,2>{0.511855006f, 0.360325962f},
-std::array<float,2>{0.424926966f, 0.92925036f},
-std::array<float,2>{0.147547573f, 0.244229078f},
-std::array<float,2>{0.96353215f, 0.654729307f},
-std::array<float,2>{0.874117076f, 0.0879914835f},
-std::array<float,2>{0.108265482f, 0.598536909f},
-std::array<float,2>{0.373906702f, 0.422701091f},
-std::array<float,2>{0.63522023f, 0.868186235f},
-std::array<float,2>{0.582506716f, 0.0547868386f},
-std::array<float,2>{0.455891937f, 0.510729373f},
-std::array<float,2>{0.220670223f, 0.455814332f},
-std::array<float,2>{0.881302893f, 0.80002147f},
-std::array<float,2>{0.782348037f, 0.276372433f},
-std::array<float,2>{0.0514197461f, 0.957429409f},
-std::array<float,2>{0.303630501f, 0.153418556f},
-std::array<float,2>{0.702053249f, 0.734521091f},
-std::array<float,2>{0.681071639f, 0.391356528f},
-std::array<float,2>{0.324249893f, 0.815526545f},
-std::array<float,2>{0.0847960934f, 0.108318821f},
-std::array<float,2>{0.823732138f, 0.591318309f},
-std::array<float,2>{0.970503449f, 0.196973428f},
-std::array<float,2>{0.17244111f, 0.680344999f},
-std::array<float,2>{0.39895317f, 0.332306296f},
-std::array<float,2>{0.548372924f, 0.882150352f},
-std::array<float,2>{0.67831099f, 0.0428420119f},
-std::array<float,2>{0.317831099f, 0.51916486f},
-std::array<float,2>{0.0920091867f, 0.441999018f},
-std::array<float,2>{0.819521785f, 0.786276579f},
-std::array<float,2>{0.982566595f, 0.250468552f},
-std::array<float,2>{0.184560135f, 0.950641751f},
-std::array<float,2>{0.398260087f, 0.125478908f},
-std::array<float,2>{0.562329113f, 0.732653677f},
-std::array<float,2>{0.586931884f, 0.377944112f},
-std::array<float,2>{0.460990638f, 0.832708895f},
-std::array<float,2>{0.227896288f, 0.12375579f},
-std::array<float,2>{0.887228131f, 0.567470551f},
-std::array<float,2>{0.793721855f, 0.210742339f},
-std::array<float,2>{0.061617136f, 0.665558338f},
-std::array<float,2>{0.304841667f, 0.324704468f},
-std::array<float,2>{0.694997489f, 0.893224835f},
-std::array<float,2>{0.500594199f, 0.162292033f},
-std::array<float,2>{0.435276955f, 0.715689242f},
-std::array<float,2>{0.15376243f, 0.301185429f},
-std::array<float,2>{0.956326246f, 0.987806678f},
-std::array<float,2>{0.861757517f, 0.479545563f},
-std::array<float,2>{0.0987093002f, 0.76110816f},
-std::array<float,2>{0.365201503f, 0.0075579132f},
-std::array<float,2>{0.625205278f, 0.546018839f},
-std::array<float,2>{0.733267128f, 0.353702605f},
-std::array<float,2>{0.268006504f, 0.920681715f},
-std::array<float,2>{0.0140443016f, 0.232800007f},
-std::array<float,2>{0.755558133f, 0.628385305f},
-std::array<float,2>{0.908661127f, 0.0682239905f},
-std::array<float,2>{0.216671228f, 0.624331057f},
-std::array<float,2>{0.491916955f, 0.409649462f},
-std::array<float,2>{0.623076737f, 0.847350955f},
-std::array<float,2>{0.711737812f, 0.24926272f},
-std::array<float,2>{0.294656932f, 0.651910841f},
-std::array<float,2>{0.0385270528f, 0.363414675f},
-std::array<float,2>{0.797489405f, 0.924505651f},
-std::array<float,2>{0.902408719f, 0.427299172f},
-std::array<float,2>{0.237122327f, 0.871468008f},
-std::array<float,2>{0.441551805f, 0.0933564827f},
-std::array<float,2>{0.567298651f, 0.596509933f},
-std::array<float,2>{0.535416603f, 0.292736769f},
-std::array<float,2>{0.388596952f, 0.982793152f},
-std::array<float,2>{0.161890268f, 0.18626073f},
-std::array<float,2>{0.9978351f, 0.688437939f},
-std::array<float,2>{0.834163904f, 0.0171308629f},
-std::array<float,2>{0.0707051456f, 0.549585402f},
-std::array<float,2>{0.340275109f, 0.494349211f},
-std::array<float,2>{0.664467335f, 0.771999478f},
-std::array<float,2>{0.60500896f, 0.102479242f},
-std::array<float,2>{0.470450282f, 0.587929487f},
-std::array<float,2>{0.193707734f, 0.397265881f},
-std::array<float,2>{0.929535806f, 0.819875062f},
-std::array<float,2>{0.769835651f, 0.32877028f},
-std::array<float,2>{0.0226212963f, 0.877040744f},
-std::array<float,2>{0.25164324f, 0.200339451f},
-std::array<float,2>{0.749673247f, 0.686356843f},
-std::array<float,2>{0.641632438f, 0.459230006f},
-std::array<float,2>{0.345852256f, 0.802702487f},
-std::array<float,2>{0.109945163f, 0.0598364845f},
-std::array<float,2>{0.853416681f, 0.515295088f},
-std::array<float,2>{0.938869119f, 0.149958447f},
-std::array<float,2>{0.137877017f, 0.738691628f},
-std::array<float,2>{0.411233336f, 0.278636485f},
-std::array<float,2>{0.531238437f, 0.954974174f},
-std::array<float,2>{0.736100197f, 0.0804967657f},
-std::array<float,2>{0.262114465f, 0.604989767f},
-std::array<float,2>{0.0239026006f, 0.43355003f},
-std::array<float,2>{0.776884377f, 0.861151278f},
-std::array<float,2>{0.93215555f, 0.370877951f},
-std::array<float,2>{0.199923724f, 0.935251594f},
-std::array<float,2>{0.477543771f, 0.24191463f},
-std::array<float,2>{0.598316669f, 0.646627545f},
-std::array<float,2>{0.519709408f, 0.49022001f},
-std::array<float,2>{0.421804667f, 0.779335141f},
-std::array<float,2>{0.129251927f, 0.0259615034f},
-std::array<float,2>{0.946218789f, 0.558793247f},
-std::array<float,2>{0.848553777f, 0.177779049f},
-std::array<float,2>{0.119401336f, 0.69637233f},
-std::array<float,2>{0.357305855f, 0.284548819f},
-std::array<float,2>{0.650093138f, 0.969281018f},
-std::array<float,2>{0.572830558f, 0.191980273f},
-std::array<float,2>{0.451456308f, 0.676754236f},
-std::array<float,2>{0.247201756f, 0.337905854f},
-std::array<float,2>{0.894482434f, 0.883522332f},
-std::array<float,2>{0.808450937f, 0.402392745f},
-std::array<float,2>{0.0396427102f, 0.820978165f},
-std::array<float,2>{0.287440985f, 0.0961305723f},
-std::array<float,2>{0.705317378f, 0.579365909f},
-std::array<float,2>{0.658171654f, 0.27263537f},
-std::array<float,2>{0.331575185f, 0.968734682f},
-std::array<float,2>{0.0631445125f, 0.147073701f},
-std::array<float,2>{0.840105891f, 0.749936759f},
-std::array<float,2>{0.990987599f, 0.051412113f},
-std::array<float,2>{0.168250129f, 0.505252242f},
-std::array<float,2>{0.376315862f, 0.464339614f},
-std::array<float,2>{0.539972305f, 0.810739636f},
-std::array<float,2>{0.640102088f, 0.133707717f},
-std::array<float,2>{0.370300025f, 0.719850004f},
-std::array<float,2>{0.101960525f, 0.260312617f},
-std::array<float,2>{0.867689729f, 0.937517166f},
-std::array<float,2>{0.968651652f, 0.452760935f},
-std::array<float,2>{0.140654281f, 0.793915033f},
-std::array<float,2>{0.428444922f, 0.0314115211f},
-std::array<float,2>{0.51131171f, 0.523743212f},
-std::array<float,2>{0.61504215f, 0.320000321f},
-std::array<float,2>{0.496439546f, 0.901523292f},
-std::array<float,2>{0.208139703f, 0.213855788f},
-std::array<float,2>{0.914270759f, 0.659714758f},
-std::array<float,2>{0.762618721f, 0.114430532f},
-std::array<float,2>{0.000936151249f, 0.574728012f},
-std::array<float,2>{0.279389679f, 0.385733932f},
-std::array<float,2>{0.725926697f, 0.838051379f},
-std::array<float,2>{0.5531286f, 0.0144312605f},
-std::array<float,2>{0.405748844f, 0.538289905f},
-std::array<float,2>{0.178000256f, 0.475188226f},
-std::array<float,2>{0.974939108f, 0.757098079f},
-std::array<float,2>{0.825176477f, 0.305401206f},
-std::array<float,2>{0.0811971053f, 0.99537015f},
-std::array<float,2>{0.321546882f, 0.171239212f},
-std::array<float,2>{0.684673309f, 0.706659973f},
-std::array<float,2>{0.698898315f, 0.420351118f},
-std::array<float,2>{0.30010739f, 0.855008125f},
-std::array<float,2>{0.0487915017f, 0.072238408f},
-std::array<float,2>{0.787965655f, 0.613109529f},
-std::array<float,2>{0.878140926f, 0.225398734f},
-std::array<float,2>{0.225830346f, 0.63568157f},
-std::array<float,2>{0.458539784f, 0.35039562f},
-std::array<float,2>{0.579427004f, 0.910811603f},
-std::array<float,2>{0.728574455f, 0.0484279469f},
-std::array<float,2>{0.270280272f, 0.503877103f},
-std::array<float,2>{0.0105208596f, 0.465156049f},
-std::array<float,2>{0.753771603f, 0.806675315f},
-std::array<float,2>{0.912100732f, 0.2692689f},
-std::array<float,2>{0.213453576f, 0.964625001f},
-std::array<float,2>{0.487279117f, 0.143390551f},
-std::array<float,2>{0.620263636f, 0.743639767f},
-std::array<float,2>{0.506637216f, 0.400239676f},
-std::array<float,2>{0.431584716f, 0.827776313f},
-std::array<float,2>{0.149087116f, 0.0996715203f},
-std::array<float,2>{0.959400415f, 0.584549546f},
-std::array<float,2>{0.865848839f, 0.191040367f},
-std::array<float,2>{0.0970618799f, 0.675607026f},
-std::array<float,2>{0.359508693f, 0.340436012f},
-std::array<float,2>{0.630043745f, 0.889621735f},
-std::array<float,2>{0.592080712f, 0.175703749f},
-std::array<float,2>{0.464932948f, 0.703071594f},
-std::array<float,2>{0.234201103f, 0.288266361f},
-std::array<float,2>{0.882901967f, 0.973190904f},
-std::array<float,2>{0.78927356f, 0.487905651f},
-std::array<float,2>{0.0575780571f, 0.774135411f},
-std::array<float,2>{0.310784161f, 0.0307181273f},
-std::array<float,2>{0.689853549f, 0.556463897f},
-std::array<float,2>{0.675646901f, 0.371872067f},
-std::array<float,2>{0.312623978f, 0.931070983f},
-std::array<float,2>{0.0897176191f, 0.234970957f},
-std::array<float,2>{0.812859476f, 0.641355813f},
-std::array<float,2>{0.977691174f, 0.0828002095f},
-std::array<float,2>{0.182688192f, 0.608095288f},
-std::array<float,2>{0.393822521f, 0.434889436f},
-std::array<float,2>{0.555018067f, 0.86360532f},
-std::array<float,2>{0.647983909f, 0.22198011f},
-std::array<float,2>{0.350863636f, 0.637863219f},
-std::array<float,2>{0.117070399f, 0.344663024f},
-std::array<float,2>{0.855817854f, 0.908907592f},
-std::array<float,2>{0.944745243f, 0.414465636f},
-std::array<float,2>{0.134717077f, 0.85725385f},
-std::array<float,2>{0.407052845f, 0.075289458f},
-std::array<float,2>{0.523477554f, 0.61418885f},
-std::array<float,2>{0.607859075f, 0.310064286f},
-std::array<float,2>{0.475390404f, 0.997342467f},
-std::array<float,2>{0.191179365f, 0.165578395f},
-std::array<float,2>{0.923217118f, 0.708444118f},
-std::array<float,2>{0.76947093f, 0.00886666495f},
-std::array<float,2>{0.016500799f, 0.533042252f},
-std::array<float,2>{0.257759988f, 0.470287114f},
-std::array<float,2>{0.742675841f, 0.753525555f},
-std::array<float,2>{0.531995177f, 0.111206979f},
-std::array<float,2>{0.38341853f, 0.572734356f},
-std::array<float,2>{0.16008386f, 0.390531421f},
-std::array<float,2>{0.993434787f, 0.842683196f},
-std::array<float,2>{0.829188824f, 0.313801408f},
-std::array<float,2>{0.0776965991f, 0.905352414f},
-std::array<float,2>{0.33944425f, 0.217258409f},
-std::array<float,2>{0.668781161f, 0.660805762f},
-std::array<float,2>{0.71767658f, 0.446196377f},
-std::array<float,2>{0.291740477f, 0.789204776f},
-std::array<float,2>{0.032734517f, 0.0381311178f},
-std::array<float,2>{0.801237583f, 0.528958619f},
-std::array<float,2>{0.900827587f, 0.139274642f},
-std::array<float,2>{0.241812438f, 0.726125121f},
-std::array<float,2>{0.440969855f, 0.264356196f},
-std::array<float,2>{0.562891364f, 0.942047834f},
-std::array<float,2>{0.663314104f, 0.0643534064f},
-std::array<float,2>{0.332844377f, 0.618519068f},
-std::array<float,2>{0.0699859709f, 0.412230521f},
-std::array<float,2>{0.839774489f, 0.849038422f},
-std::array<float,2>{0.984383762f, 0.356377095f},
-std::array<float,2>{0.166963503f, 0.915124595f},
-std::array<float,2>{0.380749673f, 0.227770597f},
-std::array<float,2>{0.544341624f, 0.630094171f},
-std::array<float,2>{0.577449977f, 0.483835846f},
-std::array<float,2>{0.445835412f, 0.762908876f},
-std::array<float,2>{0.244320676f, 0.000879267638f},
-std::array<float,2>{0.896835744f, 0.541751206f},
-std::array<float,2>{0.810657203f, 0.15896742f},
-std::array<float,2>{0.0453111641f, 0.712642789f},
-std::array<float,2>{0.282461375f, 0.299616754f},
-std::array<float,2>{0.708888888f, 0.991542578f},
-std::array<float,2>{0.518279076f, 0.206126943f},
-std::array<float,2>{0.416682243f, 0.668402851f},
-std::array<float,2>{0.125980914f, 0.32313329f},
-std::array<float,2>{0.951933444f, 0.894931376f},
-std::array<float,2>{0.845617294f, 0.379263282f},
-std::array<float,2>{0.123862505f, 0.828517258f},
-std::array<float,2>{0.351669163f, 0.119683534f},
-std::array<float,2>{0.652851522f, 0.563941181f},
-std::array<float,2>{0.740035772f, 0.257003307f},
-std::array<float,2>{0.258659363f, 0.9479689f},
-std::array<float,2>{0.0308443662f, 0.131537363f},
-std::array<float,2>{0.780445576f, 0.728524864f},
-std::array<float,2>{0.934253097f, 0.0455849506f},
-std::array<float,2>{0.196403697f, 0.520243764f},
-std::array<float,2>{0.484276623f, 0.440049142f},
-std::array<float,2>{0.595260024f, 0.782607257f},
-std::array<float,2>{0.699459374f, 0.156118512f},
-std::array<float,2>{0.301824868f, 0.736636281f},
-std::array<float,2>{0.0533080474f, 0.274781287f},
-std::array<float,2>{0.783758223f, 0.960366309f},
-std::array<float,2>{0.879384339f, 0.453641921f},
-std::array<float,2>{0.221512645f, 0.798259139f},
-std::array<float,2>{0.453649789f, 0.0574466251f},
-std::array<float,2>{0.585528731f, 0.508039117f},
-std::array<float,2>{0.550505877f, 0.335881948f},
-std::array<float,2>{0.400736958f, 0.880398512f},
-std::array<float,2>{0.175646648f, 0.19883278f},
-std::array<float,2>{0.971227765f, 0.682548285f},
-std::array<float,2>{0.821078539f, 0.105692826f},
-std::array<float,2>{0.0830929726f, 0.592020512f},
-std::array<float,2>{0.326929629f, 0.39389199f},
-std::array<float,2>{0.683573604f, 0.813192129f},
-std::array<float,2>{0.611060321f, 0.0217423532f},
-std::array<float,2>{0.492194772f, 0.550795317f},
-std::array<float,2>{0.205454186f, 0.496216804f},
-std::array<float,2>{0.920274138f, 0.765724838f},
-std::array<float,2>{0.760095775f, 0.296610892f},
-std::array<float,2>{0.00447397679f, 0.979938507f},
-std::array<float,2>{0.274109006f, 0.183389902f},
-std::array<float,2>{0.719532669f, 0.691558421f},
-std::array<float,2>{0.633569241f, 0.423990428f},
-std::array<float,2>{0.37161088f, 0.870756745f},
-std::array<float,2>{0.106761932f, 0.0878864378f},
-std::array<float,2>{0.873018265f, 0.600791454f},
-std::array<float,2>{0.961237788f, 0.242577881f},
-std::array<float,2>{0.14621307f, 0.652738929f},
-std::array<float,2>{0.423604041f, 0.362178266f},
-std::array<float,2>{0.514390469f, 0.927706957f},
-std::array<float,2>{0.627236784f, 0.00559445983f},
-std::array<float,2>{0.365961194f, 0.544150531f},
-std::array<float,2>{0.0996300951f, 0.477843136f},
-std::array<float,2>{0.860312402f, 0.758288503f},
-std::array<float,2>{0.953811824f, 0.303249419f},
-std::array<float,2>{0.155290231f, 0.985173464f},
-std::array<float,2>{0.437247247f, 0.161949679f},
-std::array<float,2>{0.503387749f, 0.717455983f},
-std::array<float,2>{0.622754633f, 0.406672984f},
-std::array<float,2>{0.489085555f, 0.844500542f},
-std::array<float,2>{0.217450932f, 0.0690412074f},
-std::array<float,2>{0.907798231f, 0.621520162f},
-std::array<float,2>{0.755914927f, 0.231940165f},
-std::array<float,2>{0.0122714946f, 0.625189304f},
-std::array<float,2>{0.267558038f, 0.352228016f},
-std::array<float,2>{0.731661558f, 0.919900417f},
-std::array<float,2>{0.559035301f, 0.128047273f},
-std::array<float,2>{0.395345926f, 0.732008278f},
-std::array<float,2>{0.187108964f, 0.253156662f},
-std::array<float,2>{0.981178284f, 0.951278746f},
-std::array<float,2>{0.817746639f, 0.444696307f},
-std::array<float,2>{0.0915739611f, 0.787385464f},
-std::array<float,2>{0.318805516f, 0.0407480747f},
-std::array<float,2>{0.677613318f, 0.516017675f},
-std::array<float,2>{0.692834735f, 0.326215446f},
-std::array<float,2>{0.307546794f, 0.890822887f},
-std::array<float,2>{0.060401842f, 0.207159087f},
-std::array<float,2>{0.796509147f, 0.667726219f},
-std::array<float,2>{0.890343606f, 0.122161984f},
-std::array<float,2>{0.228674904f, 0.569500864f},
-std::array<float,2>{0.46414867f, 0.376392186f},
-std::array<float,2>{0.589666247f, 0.835389614f},
-std::array<float,2>{0.747761726f, 0.203096956f},
-std::array<float,2>{0.252459496f, 0.683847308f},
-std::array<float,2>{0.0201309714f, 0.330477476f},
-std::array<float,2>{0.771953046f, 0.876640201f},
-std::array<float,2>{0.926145673f, 0.396152258f},
-std::array<float,2>{0.191924751f, 0.818053961f},
-std::array<float,2>{0.472095698f, 0.10525582f},
-std::array<float,2>{0.601994157f, 0.586892068f},
-std::array<float,2>{0.528463483f, 0.280425251f},
-std::array<float,2>{0.41340968f, 0.956552148f},
-std::array<float,2>{0.139020637f, 0.150837973f},
-std::array<float,2>{0.940887868f, 0.741966844f},
-std::array<float,2>{0.854124248f, 0.061367739f},
-std::array<float,2>{0.112799905f, 0.513296187f},
-std::array<float,2>{0.345065892f, 0.45797962f},
-std::array<float,2>{0.644010365f, 0.803670824f},
-std::array<float,2>{0.569712758f, 0.0899203643f},
-std::array<float,2>{0.445198387f, 0.595091522f},
-std::array<float,2>{0.234569505f, 0.429624677f},
-std::array<float,2>{0.90485847f, 0.874458075f},
-std::array<float,2>{0.798947275f, 0.366739243f},
-std::array<float,2>{0.0364103317f, 0.923007309f},
-std::array<float,2>{0.295032144f, 0.246899173f},
-std::array<float,2>{0.714690566f, 0.648711205f},
-std::array<float,2>{0.666588068f, 0.493216991f},
-std::array<float,2>{0.342808872f, 0.770739913f},
-std::array<float,2>{0.073487103f, 0.0187893789f},
-std::array<float,2>{0.833007097f, 0.547507048f},
-std::array<float,2>{0.9983024f, 0.184095234f},
-std::array<float,2>{0.162921607f, 0.691324532f},
-std::array<float,2>{0.389918655f, 0.289554566f},
-std::array<float,2>{0.537721992f, 0.981103599f},
-std::array<float,2>{0.7044366f, 0.0941861123f},
-std::array<float,2>{0.286808133f, 0.580492496f},
-std::array<float,2>{0.042583771f, 0.405407757f},
-std::array<float,2>{0.80609268f, 0.82338959f},
-std::array<float,2>{0.890737891f, 0.336292535f},
-std::array<float,2>{0.248738453f, 0.886240005f},
-std::array<float,2>{0.450112075f, 0.194925591f},
-std::array<float,2>{0.570769966f, 0.678356469f},
-std::array<float,2>{0.542441666f, 0.461134017f},
-std::array<float,2>{0.378381997f, 0.808983564f},
-std::array<float,2>{0.170560136f, 0.0541445799f},
-std::array<float,2>{0.989004672f, 0.507547617f},
-std::array<float,2>{0.842478752f, 0.146440595f},
-std::array<float,2>{0.0657168999f, 0.747318566f},
-std::array<float,2>{0.328179389f, 0.269841194f},
-std::array<float,2>{0.658610165f, 0.966603577f},
-std::array<float,2>{0.600524306f, 0.240128815f},
-std::array<float,2>{0.478575349f, 0.64557457f},
-std::array<float,2>{0.202047274f, 0.368498296f},
-std::array<float,2>{0.930531681f, 0.936322272f},
-std::array<float,2>{0.774144709f, 0.431375861f},
-std::array<float,2>{0.0262101572f, 0.861892104f},
-std::array<float,2>{0.265470028f, 0.0797960237f},
-std::array<float,2>{0.736694515f, 0.602343798f},
-std::array<float,2>{0.651804805f, 0.281615406f},
-std::array<float,2>{0.359061241f, 0.971002281f},
-std::array<float,2>{0.11776863f, 0.176197112f},
-std::array<float,2>{0.850772619f, 0.6980474f},
-std::array<float,2>{0.948740721f, 0.0248061679f},
-std::array<float,2>{0.13278003f, 0.562437832f},
-std::array<float,2>{0.419166625f, 0.492120743f},
-std::array<float,2>{0.521599531f, 0.777615607f},
-std::array<float,2>{0.685843587f, 0.168458521f},
-std::array<float,2>{0.322832346f, 0.70327884f},
-std::array<float,2>{0.0788912028f, 0.308283746f},
-std::array<float,2>{0.827680409f, 0.994134903f},
-std::array<float,2>{0.974565625f, 0.474044651f},
-std::array<float,2>{0.175846845f, 0.755822897f},
-std::array<float,2>{0.403614193f, 0.013421678f},
-std::array<float,2>{0.552610159f, 0.535262465f},
-std::array<float,2>{0.580985367f, 0.349319428f},
-std::array<float,2>{0.460646957f, 0.91298002f},
-std::array<float,2>{0.224134207f, 0.223854497f},
-std::array<float,2>{0.875861466f, 0.634420037f},
-std::array<float,2>{0.786432266f, 0.0730715171f},
-std::array<float,2>{0.0506980754f, 0.609939635f},
-std::array<float,2>{0.297456414f, 0.419462323f},
-std::array<float,2>{0.696321964f, 0.853158891f},
-std::array<float,2>{0.50840193f, 0.0342485309f},
-std::array<float,2>{0.427202553f, 0.527005196f},
-std::array<float,2>{0.143666893f, 0.450718939f},
-std::array<float,2>{0.964847505f, 0.796652794f},
-std::array<float,2>{0.871061563f, 0.258196622f},
-std::array<float,2>{0.105034329f, 0.940777123f},
-std::array<float,2>{0.368797094f, 0.135906562f},
-std::array<float,2>{0.638068557f, 0.721039236f},
-std::array<float,2>{0.724021375f, 0.38311246f},
-std::array<float,2>{0.27852571f, 0.837173998f},
-std::array<float,2>{0.00322277355f, 0.116257645f},
-std::array<float,2>{0.763778806f, 0.57734865f},
-std::array<float,2>{0.917346179f, 0.212736696f},
-std::array<float,2>{0.209607467f, 0.657744169f},
-std::array<float,2>{0.499418885f, 0.318162084f},
-std::array<float,2>{0.617108107f, 0.899098933f},
-std::array<float,2>{0.718955696f, 0.0201592334f},
-std::array<float,2>{0.273525536f, 0.553105414f},
-std::array<float,2>{0.00416069198f, 0.498806268f},
-std::array<float,2>{0.7605111f, 0.768570542f},
-std::array<float,2>{0.920460463f, 0.293191075f},
-std::array<float,2>{0.20569773f, 0.977741301f},
-std::array<float,2>{0.492868036f, 0.180696756f},
-std::array<float,2>{0.610693276f, 0.693366349f},
-std::array<float,2>{0.514154434f, 0.421904117f},
-std::array<float,2>{0.422955841f, 0.868858337f},
-std::array<float,2>{0.145913467f, 0.0885384157f},
-std::array<float,2>{0.961526871f, 0.597797334f},
-std::array<float,2>{0.872481465f, 0.244998261f},
-std::array<float,2>{0.107234769f, 0.654794753f},
-std::array<float,2>{0.371388823f, 0.359498769f},
-std::array<float,2>{0.633184552f, 0.929090559f},
-std::array<float,2>{0.585208356f, 0.153928876f},
-std::array<float,2>{0.453238517f, 0.735191107f},
-std::array<float,2>{0.220812857f, 0.27705431f},
-std::array<float,2>{0.879777908f, 0.95794946f},
-std::array<float,2>{0.78356576f, 0.455300719f},
-std::array<float,2>{0.0528860427f, 0.800323367f},
-std::array<float,2>{0.302538484f, 0.0553338006f},
-std::array<float,2>{0.699936271f, 0.510158837f},
-std::array<float,2>{0.682988822f, 0.332710892f},
-std::array<float,2>{0.326268584f, 0.882506132f},
-std::array<float,2>{0.0837607607f, 0.196561918f},
-std::array<float,2>{0.820677161f, 0.679987907f},
-std::array<float,2>{0.971101165f, 0.107523173f},
-std::array<float,2>{0.174918383f, 0.590869188f},
-std::array<float,2>{0.400891721f, 0.390951514f},
-std::array<float,2>{0.550158739f, 0.816263497f},
-std::array<float,2>{0.652435064f, 0.204431221f},
-std::array<float,2>{0.35250029f, 0.671276748f},
-std::array<float,2>{0.123054877f, 0.320553571f},
-std::array<float,2>{0.845060766f, 0.896743953f},
-std::array<float,2>{0.951194167f, 0.381698132f},
-std::array<float,2>{0.126824543f, 0.831933737f},
-std::array<float,2>{0.416321188f, 0.117571861f},
-std::array<float,2>{0.517865658f, 0.565020382f},
-std::array<float,2>{0.594768405f, 0.255295306f},
-std::array<float,2>{0.48360908f, 0.946013629f},
-std::array<float,2>{0.197177798f, 0.130078584f},
-std::array<float,2>{0.933850765f, 0.727431417f},
-std::array<float,2>{0.780831516f, 0.0429909602f},
-std::array<float,2>{0.030424213f, 0.522339225f},
-std::array<float,2>{0.257863104f, 0.438839138f},
-std::array<float,2>{0.739575744f, 0.783695519f},
-std::array<float,2>{0.544521749f, 0.0649781674f},
-std::array<float,2>{0.380032182f, 0.619559109f},
-std::array<float,2>{0.166162997f, 0.411508352f},
-std::array<float,2>{0.98498112f, 0.849975884f},
-std::array<float,2>{0.838899255f, 0.359230131f},
-std::array<float,2>{0.0693890974f, 0.916844428f},
-std::array<float,2>{0.332423121f, 0.229749963f},
-std::array<float,2>{0.66379559f, 0.631153047f},
-std::array<float,2>{0.708068907f, 0.480795652f},
-std::array<float,2>{0.283201844f, 0.764264524f},
-std::array<float,2>{0.0457345992f, 0.00251585012f},
-std::array<float,2>{0.811329782f, 0.539458036f},
-std::array<float,2>{0.897078633f, 0.157315403f},
-std::array<float,2>{0.244925484f, 0.713283658f},
-std::array<float,2>{0.445320278f, 0.297548294f},
-std::array<float,2>{0.577727437f, 0.988307714f},
-std::array<float,2>{0.668377101f, 0.112698451f},
-std::array<float,2>{0.338897616f, 0.571770847f},
-std::array<float,2>{0.0771842077f, 0.388547629f},
-std::array<float,2>{0.829619527f, 0.840671122f},
-std::array<float,2>{0.99401927f, 0.315321118f},
-std::array<float,2>{0.159391239f, 0.902800143f},
-std::array<float,2>{0.383170605f, 0.215863511f},
-std::array<float,2>{0.531692743f, 0.662250996f},
-std::array<float,2>{0.563365161f, 0.448277265f},
-std::array<float,2>{0.440754414f, 0.791771472f},
-std::array<float,2>{0.241648719f, 0.0364035144f},
-std::array<float,2>{0.900978565f, 0.530303299f},
-std::array<float,2>{0.801419854f, 0.137131333f},
-std::array<float,2>{0.0324644856f, 0.723893404f},
-std::array<float,2>{0.291240722f, 0.263607919f},
-std::array<float,2>{0.717114627f, 0.944936454f},
-std::array<float,2>{0.524317861f, 0.220615104f},
-std::array<float,2>{0.406685054f, 0.639931798f},
-std::array<float,2>{0.134149447f, 0.346044093f},
-std::array<float,2>{0.944923162f, 0.907707751f},
-std::array<float,2>{0.856214345f, 0.416686565f},
-std::array<float,2>{0.116238602f, 0.858454108f},
-std::array<float,2>{0.351204515f, 0.0762096271f},
-std::array<float,2>{0.647507548f, 0.616040349f},
-std::array<float,2>{0.742190003f, 0.31126228f},
-std::array<float,2>{0.257118791f, 0.999249876f},
-std::array<float,2>{0.015715491f, 0.166852832f},
-std::array<float,2>{0.76876235f, 0.709818125f},
-std::array<float,2>{0.92351979f, 0.0113007324f},
-std::array<float,2>{0.190808013f, 0.533455074f},
-std::array<float,2>{0.474920958f, 0.470971137f},
-std::array<float,2>{0.608342648f, 0.751028121f},
-std::array<float,2>{0.690105736f, 0.17283012f},
-std::array<float,2>{0.311077088f, 0.699312627f},
-std::array<float,2>{0.0567424521f, 0.286279827f},
-std::array<float,2>{0.789907694f, 0.975721598f},
-std::array<float,2>{0.883702457f, 0.484677225f},
-std::array<float,2>{0.233555123f, 0.776249468f},
-std::array<float,2>{0.465791196f, 0.0287412331f},
-std::array<float,2>{0.592312872f, 0.558301568f},
-std::array<float,2>{0.555242598f, 0.373223692f},
-std::array<float,2>{0.39410764f, 0.932745874f},
-std::array<float,2>{0.183392391f, 0.236465678f},
-std::array<float,2>{0.978116751f, 0.643105924f},
-std::array<float,2>{0.813430965f, 0.0841868818f},
-std::array<float,2>{0.08901494f, 0.60579741f},
-std::array<float,2>{0.313436478f, 0.436746925f},
-std::array<float,2>{0.674942255f, 0.86550796f},
-std::array<float,2>{0.620984972f, 0.0506736711f},
-std::array<float,2>{0.486628503f, 0.500952125f},
-std::array<float,2>{0.21320425f, 0.468444288f},
-std::array<float,2>{0.911181152f, 0.805011868f},
-std::array<float,2>{0.753373504f, 0.2672939f},
-std::array<float,2>{0.00980980415f, 0.961132228f},
-std::array<float,2>{0.269866675f, 0.142324507f},
-std::array<float,2>{0.729297101f, 0.74434036f},
-std::array<float,2>{0.630596042f, 0.400520712f},
-std::array<float,2>{0.360108703f, 0.825457811f},
-std::array<float,2>{0.0975328237f, 0.0978290811f},
-std::array<float,2>{0.865695f, 0.582631111f},
-std::array<float,2>{0.959545672f, 0.188983366f},
-std::array<float,2>{0.148539633f, 0.673812389f},
-std::array<float,2>{0.431019515f, 0.342408806f},
-std::array<float,2>{0.505878925f, 0.887257576f},
-std::array<float,2>{0.63844341f, 0.0317708068f},
-std::array<float,2>{0.368637174f, 0.52421385f},
-std::array<float,2>{0.104656659f, 0.452203691f},
-std::array<float,2>{0.870266855f, 0.793048441f},
-std::array<float,2>{0.965433896f, 0.259804904f},
-std::array<float,2>{0.144254953f, 0.938227177f},
-std::array<float,2>{0.427419186f, 0.133007199f},
-std::array<float,2>{0.507847488f, 0.720649302f},
-std::array<float,2>{0.616517961f, 0.385209411f},
-std::array<float,2>{0.499581397f, 0.838473856f},
-std::array<float,2>{0.209325492f, 0.115199022f},
-std::array<float,2>{0.91764909f, 0.574609995f},
-std::array<float,2>{0.764426291f, 0.21299158f},
-std::array<float,2>{0.0037321765f, 0.659461856f},
-std::array<float,2>{0.279163003f, 0.319680095f},
-std::array<float,2>{0.724446833f, 0.901948869f},
-std::array<float,2>{0.551925182f, 0.171626538f},
-std::array<float,2>{0.404103577f, 0.706348777f},
-std::array<float,2>{0.176317751f, 0.304690361f},
-std::array<float,2>{0.973741651f, 0.99579221f},
-std::array<float,2>{0.827213228f, 0.474654555f},
-std::array<float,2>{0.078506425f, 0.757419825f},
-std::array<float,2>{0.322378516f, 0.0137674762f},
-std::array<float,2>{0.686232686f, 0.539014757f},
-std::array<float,2>{0.697154939f, 0.349923372f},
-std::array<float,2>{0.297337502f, 0.910416186f},
-std::array<float,2>{0.0500115007f, 0.224636078f},
-std::array<float,2>{0.786958814f, 0.635057688f},
-std::array<float,2>{0.87512964f, 0.0715365186f},
-std::array<float,2>{0.223899126f, 0.612622976f},
-std::array<float,2>{0.460345328f, 0.420571744f},
-std::array<float,2>{0.580211639f, 0.854955852f},
-std::array<float,2>{0.737064123f, 0.241562292f},
-std::array<float,2>{0.265098512f, 0.647414625f},
-std::array<float,2>{0.0254763383f, 0.370571524f},
-std::array<float,2>{0.773824334f, 0.934653759f},
-std::array<float,2>{0.929819584f, 0.432760686f},
-std::array<float,2>{0.201641604f, 0.860610485f},
-std::array<float,2>{0.479253143f, 0.0809479505f},
-std::array<float,2>{0.599895716f, 0.604877889f},
-std::array<float,2>{0.521989346f, 0.285108179f},
-std::array<float,2>{0.419561207f, 0.968752265f},
-std::array<float,2>{0.132022351f, 0.178534806f},
-std::array<float,2>{0.948517084f, 0.696986616f},
-std::array<float,2>{0.851481616f, 0.0258342829f},
-std::array<float,2>{0.117215447f, 0.559317648f},
-std::array<float,2>{0.358430028f, 0.489617944f},
-std::array<float,2>{0.652029335f, 0.780260384f},
-std::array<float,2>{0.571009338f, 0.096612297f},
-std::array<float,2>{0.449380487f, 0.579820633f},
-std::array<float,2>{0.248379961f, 0.40325281f},
-std::array<float,2>{0.89118129f, 0.820684433f},
-std::array<float,2>{0.80615294f, 0.338575691f},
-std::array<float,2>{0.0424034074f, 0.883296967f},
-std::array<float,2>{0.286433965f, 0.191673964f},
-std::array<float,2>{0.70475626f, 0.676240087f},
-std::array<float,2>{0.65894115f, 0.46440044f},
-std::array<float,2>{0.328929394f, 0.811505735f},
-std::array<float,2>{0.0663020462f, 0.0511209816f},
-std::array<float,2>{0.84204191f, 0.505539298f},
-std::array<float,2>{0.988748789f, 0.14692153f},
-std::array<float,2>{0.170381382f, 0.749061704f},
-std::array<float,2>{0.378744781f, 0.273311675f},
-std::array<float,2>{0.542538404f, 0.967894316f},
-std::array<float,2>{0.714241982f, 0.0930072516f},
-std::array<float,2>{0.295713097f, 0.59596622f},
-std::array<float,2>{0.0367411301f, 0.427037507f},
-std::array<float,2>{0.799434721f, 0.872012675f},
-std::array<float,2>{0.904624045f, 0.363793939f},
-std::array<float,2>{0.234910712f, 0.923927307f},
-std::array<float,2>{0.444362313f, 0.249704525f},
-std::array<float,2>{0.570221066f, 0.651446998f},
-std::array<float,2>{0.537314296f, 0.494992554f},
-std::array<float,2>{0.390362144f, 0.77172333f},
-std::array<float,2>{0.162512496f, 0.016659027f},
-std::array<float,2>{0.99881202f, 0.549004018f},
-std::array<float,2>{0.832130969f, 0.185859904f},
-std::array<float,2>{0.0738178939f, 0.687667906f},
-std::array<float,2>{0.343341231f, 0.292330176f},
-std::array<float,2>{0.666038454f, 0.983259439f},
-std::array<float,2>{0.602182925f, 0.200969294f},
-std::array<float,2>{0.472629398f, 0.685782731f},
-std::array<float,2>{0.19153282f, 0.328156978f},
-std::array<float,2>{0.926515937f, 0.877460122f},
-std::array<float,2>{0.772003531f, 0.396498144f},
-std::array<float,2>{0.0195635073f, 0.819557488f},
-std::array<float,2>{0.252146155f, 0.101875417f},
-std::array<float,2>{0.747288465f, 0.588713169f},
-std::array<float,2>{0.644334495f, 0.279035509f},
-std::array<float,2>{0.345285624f, 0.954561591f},
-std::array<float,2>{0.112380318f, 0.149730936f},
-std::array<float,2>{0.853649378f, 0.73889482f},
-std::array<float,2>{0.941384971f, 0.0604862608f},
-std::array<float,2>{0.139626548f, 0.514790714f},
-std::array<float,2>{0.413958669f, 0.459493399f},
-std::array<float,2>{0.529214144f, 0.801924706f},
-std::array<float,2>{0.677208245f, 0.125580505f},
-std::array<float,2>{0.318849951f, 0.73304528f},
-std::array<float,2>{0.0911111906f, 0.250840634f},
-std::array<float,2>{0.818160534f, 0.950998008f},
-std::array<float,2>{0.980948627f, 0.441494733f},
-std::array<float,2>{0.186877385f, 0.787000716f},
-std::array<float,2>{0.394821405f, 0.0421704613f},
-std::array<float,2>{0.559299111f, 0.518769741f},
-std::array<float,2>{0.589091063f, 0.324932754f},
-std::array<float,2>{0.464702249f, 0.893025517f},
-std::array<float,2>{0.229027182f, 0.210080326f},
-std::array<float,2>{0.889829636f, 0.665293217f},
-std::array<float,2>{0.796150863f, 0.123497389f},
-std::array<float,2>{0.0597874932f, 0.56790179f},
-std::array<float,2>{0.30690065f, 0.378599644f},
-std::array<float,2>{0.692902446f, 0.832288682f},
-std::array<float,2>{0.503753185f, 0.00722327782f},
-std::array<float,2>{0.436582923f, 0.546657205f},
-std::array<float,2>{0.155825302f, 0.480343759f},
-std::array<float,2>{0.953128159f, 0.761434376f},
-std::array<float,2>{0.859853387f, 0.301559865f},
-std::array<float,2>{0.10039261f, 0.987777054f},
-std::array<float,2>{0.365674525f, 0.162797555f},
-std::array<float,2>{0.627813578f, 0.714913905f},
-std::array<float,2>{0.731934845f, 0.410009056f},
-std::array<float,2>{0.266830951f, 0.847090244f},
-std::array<float,2>{0.0121077243f, 0.0675541162f},
-std::array<float,2>{0.756589532f, 0.624692261f},
-std::array<float,2>{0.907228708f, 0.233147174f},
-std::array<float,2>{0.217036709f, 0.628881812f},
-std::array<float,2>{0.488454342f, 0.354040205f},
-std::array<float,2>{0.622489214f, 0.920107186f},
-std::array<float,2>{0.70135355f, 0.056786187f},
-std::array<float,2>{0.302917689f, 0.508430898f},
-std::array<float,2>{0.051258374f, 0.45352295f},
-std::array<float,2>{0.782863438f, 0.798563302f},
-std::array<float,2>{0.881458938f, 0.275027782f},
-std::array<float,2>{0.219849512f, 0.96074909f},
-std::array<float,2>{0.455250323f, 0.155600816f},
-std::array<float,2>{0.582995176f, 0.736966312f},
-std::array<float,2>{0.547956109f, 0.394190341f},
-std::array<float,2>{0.398512959f, 0.812727869f},
-std::array<float,2>{0.172117859f, 0.106356181f},
-std::array<float,2>{0.969976008f, 0.592655778f},
-std::array<float,2>{0.823521018f, 0.198511973f},
-std::array<float,2>{0.0842020884f, 0.681826591f},
-std::array<float,2>{0.325119942f, 0.335324496f},
-std::array<float,2>{0.681543946f, 0.879895747f},
-std::array<float,2>{0.613091588f, 0.182665825f},
-std::array<float,2>{0.494623572f, 0.692131817f},
-std::array<float,2>{0.204857126f, 0.296350211f},
-std::array<float,2>{0.919099987f, 0.980271339f},
-std::array<float,2>{0.759407043f, 0.496983528f},
-std::array<float,2>{0.00720141223f, 0.766239107f},
-std::array<float,2>{0.27585727f, 0.0224226117f},
-std::array<float,2>{0.721494675f, 0.551668406f},
-std::array<float,2>{0.635406673f, 0.361654639f},
-std::array<float,2>{0.373314112f, 0.927128434f},
-std::array<float,2>{0.107627124f, 0.243132189f},
-std::array<float,2>{0.874534249f, 0.653231263f},
-std::array<float,2>{0.963150859f, 0.0870650634f},
-std::array<float,2>{0.148414761f, 0.601249754f},
-std::array<float,2>{0.425435036f, 0.424719125f},
-std::array<float,2>{0.512387872f, 0.870519817f},
-std::array<float,2>{0.661950529f, 0.228279427f},
-std::array<float,2>{0.334002733f, 0.630650997f},
-std::array<float,2>{0.0671096146f, 0.355652452f},
-std::array<float,2>{0.836901724f, 0.915814221f},
-std::array<float,2>{0.988135457f, 0.413038433f},
-std::array<float,2>{0.164632112f, 0.849448264f},
-std::array<float,2>{0.381906956f, 0.0636933297f},
-std::array<float,2>{0.54572469f, 0.618842661f},
-std::array<float,2>{0.575739682f, 0.299099863f},
-std::array<float,2>{0.448971748f, 0.992185891f},
-std::array<float,2>{0.243006557f, 0.158292159f},
-std::array<float,2>{0.895299017f, 0.711965621f},
-std::array<float,2>{0.808850288f, 0.000371240836f},
-std::array<float,2>{0.0431273282f, 0.541131496f},
-std::array<float,2>{0.283361226f, 0.484264255f},
-std::array<float,2>{0.710777044f, 0.76333338f},
-std::array<float,2>{0.515806079f, 0.119221888f},
-std::array<float,2>{0.41445145f, 0.563984156f},
-std::array<float,2>{0.127258688f, 0.379405349f},
-std::array<float,2>{0.949346662f, 0.828651011f},
-std::array<float,2>{0.847473383f, 0.322674543f},
-std::array<float,2>{0.121680573f, 0.895384908f},
-std::array<float,2>{0.353988945f, 0.206925303f},
-std::array<float,2>{0.654541135f, 0.66879636f},
-std::array<float,2>{0.741859078f, 0.439740628f},
-std::array<float,2>{0.260914087f, 0.783059776f},
-std::array<float,2>{0.028003512f, 0.045031894f},
-std::array<float,2>{0.778945982f, 0.519842148f},
-std::array<float,2>{0.936402678f, 0.131204769f},
-std::array<float,2>{0.197728962f, 0.729156911f},
-std::array<float,2>{0.481739938f, 0.257580608f},
-std::array<float,2>{0.595809102f, 0.94773221f},
-std::array<float,2>{0.645881116f, 0.0760592371f},
-std::array<float,2>{0.349160045f, 0.613557696f},
-std::array<float,2>{0.113885097f, 0.414760202f},
-std::array<float,2>{0.857469797f, 0.856524646f},
-std::array<float,2>{0.942389488f, 0.344010293f},
-std::array<float,2>{0.136597008f, 0.908349276f},
-std::array<float,2>{0.408895731f, 0.222189575f},
-std::array<float,2>{0.525892973f, 0.638419986f},
-std::array<float,2>{0.606614232f, 0.470003068f},
-std::array<float,2>{0.473166615f, 0.753250301f},
-std::array<float,2>{0.189224884f, 0.00944427401f},
-std::array<float,2>{0.924969435f, 0.532446265f},
-std::array<float,2>{0.765675426f, 0.165486097f},
-std::array<float,2>{0.0194025151f, 0.708745956f},
-std::array<float,2>{0.255354464f, 0.309767783f},
-std::array<float,2>{0.745892048f, 0.997765064f},
-std::array<float,2>{0.534555018f, 0.217388883f},
-std::array<float,2>{0.385568887f, 0.66024369f},
-std::array<float,2>{0.157062694f, 0.314261943f},
-std::array<float,2>{0.99586612f, 0.906099439f},
-std::array<float,2>{0.831992447f, 0.389830858f},
-std::array<float,2>{0.0756266043f, 0.842115998f},
-std::array<float,2>{0.337127984f, 0.110615462f},
-std::array<float,2>{0.671649277f, 0.573008001f},
-std::array<float,2>{0.716579318f, 0.263746113f},
-std::array<float,2>{0.290833175f, 0.94170624f},
-std::array<float,2>{0.0348733291f, 0.138880044f},
-std::array<float,2>{0.804202914f, 0.725606918f},
-std::array<float,2>{0.899115503f, 0.0388626754f},
-std::array<float,2>{0.239108175f, 0.528731585f},
-std::array<float,2>{0.438475639f, 0.445490807f},
-std::array<float,2>{0.565664649f, 0.789979637f},
-std::array<float,2>{0.727130771f, 0.142783165f},
-std::array<float,2>{0.272132307f, 0.743970573f},
-std::array<float,2>{0.00909035653f, 0.268572181f},
-std::array<float,2>{0.751791716f, 0.964194953f},
-std::array<float,2>{0.912411153f, 0.465643167f},
-std::array<float,2>{0.212046802f, 0.807472289f},
-std::array<float,2>{0.485613227f, 0.0479258709f},
-std::array<float,2>{0.617749155f, 0.503085732f},
-std::array<float,2>{0.504408062f, 0.340218991f},
-std::array<float,2>{0.432920188f, 0.888955235f},
-std::array<float,2>{0.150850296f, 0.190598726f},
-std::array<float,2>{0.958612919f, 0.675195694f},
-std::array<float,2>{0.86384058f, 0.100281373f},
-std::array<float,2>{0.0941073075f, 0.584043264f},
-std::array<float,2>{0.361550212f, 0.399617165f},
-std::array<float,2>{0.631690979f, 0.827534437f},
-std::array<float,2>{0.591423094f, 0.0310335662f},
-std::array<float,2>{0.46806848f, 0.556111872f},
-std::array<float,2>{0.23076871f, 0.487698734f},
-std::array<float,2>{0.886453569f, 0.773528099f},
-std::array<float,2>{0.792404592f, 0.288661301f},
-std::array<float,2>{0.0559029505f, 0.972715974f},
-std::array<float,2>{0.309690446f, 0.175045773f},
-std::array<float,2>{0.688670278f, 0.702585816f},
-std::array<float,2>{0.672432661f, 0.43511191f},
-std::array<float,2>{0.315668792f, 0.863793015f},
-std::array<float,2>{0.0865630656f, 0.0820857584f},
-std::array<float,2>{0.815416992f, 0.607791007f},
-std::array<float,2>{0.98027426f, 0.234406948f},
-std::array<float,2>{0.181486905f, 0.640953839f},
-std::array<float,2>{0.391827822f, 0.371567369f},
-std::array<float,2>{0.557420671f, 0.931228697f},
-std::array<float,2>{0.685211957f, 0.0128922518f},
-std::array<float,2>{0.322212011f, 0.535970509f},
-std::array<float,2>{0.0817570537f, 0.474566758f},
-std::array<float,2>{0.824504137f, 0.755220711f},
-std::array<float,2>{0.975408614f, 0.307816237f},
-std::array<float,2>{0.178435728f, 0.993445039f},
-std::array<float,2>{0.406211078f, 0.168323129f},
-std::array<float,2>{0.553288162f, 0.70371443f},
-std::array<float,2>{0.579867423f, 0.419087797f},
-std::array<float,2>{0.458321512f, 0.852959335f},
-std::array<float,2>{0.226215929f, 0.0722840279f},
-std::array<float,2>{0.878707945f, 0.609826386f},
-std::array<float,2>{0.787270784f, 0.224167407f},
-std::array<float,2>{0.0482755676f, 0.634247422f},
-std::array<float,2>{0.300644487f, 0.349053502f},
-std::array<float,2>{0.698416591f, 0.912127256f},
-std::array<float,2>{0.510757208f, 0.136400968f},
-std::array<float,2>{0.427879155f, 0.72158587f},
-std::array<float,2>{0.141395733f, 0.258464038f},
-std::array<float,2>{0.96789664f, 0.940972745f},
-std::array<float,2>{0.867575824f, 0.450293124f},
-std::array<float,2>{0.102224745f, 0.79611659f},
-std::array<float,2>{0.370947868f, 0.0350201949f},
-std::array<float,2>{0.640377223f, 0.526553571f},
-std::array<float,2>{0.726544082f, 0.317505747f},
-std::array<float,2>{0.280224025f, 0.898756862f},
-std::array<float,2>{0.000372043025f, 0.212243855f},
-std::array<float,2>{0.761856794f, 0.657492697f},
-std::array<float,2>{0.914883018f, 0.116802715f},
-std::array<float,2>{0.208830446f, 0.577640235f},
-std::array<float,2>{0.496835858f, 0.383485168f},
-std::array<float,2>{0.614543021f, 0.83768934f},
-std::array<float,2>{0.706016302f, 0.194454819f},
-std::array<float,2>{0.287639499f, 0.677884698f},
-std::array<float,2>{0.0395192169f, 0.336871862f},
-std::array<float,2>{0.8078143f, 0.886156023f},
-std::array<float,2>{0.893615007f, 0.406113029f},
-std::array<float,2>{0.247949705f, 0.824015856f},
-std::array<float,2>{0.452110499f, 0.094309032f},
-std::array<float,2>{0.57234031f, 0.58063513f},
-std::array<float,2>{0.539239466f, 0.270435959f},
-std::array<float,2>{0.376876771f, 0.966248393f},
-std::array<float,2>{0.168510258f, 0.145575896f},
-std::array<float,2>{0.990503669f, 0.747995973f},
-std::array<float,2>{0.840786517f, 0.0543128997f},
-std::array<float,2>{0.062635161f, 0.507296145f},
-std::array<float,2>{0.331127465f, 0.461793989f},
-std::array<float,2>{0.657429516f, 0.809375226f},
-std::array<float,2>{0.597885907f, 0.079562217f},
-std::array<float,2>{0.478511423f, 0.601605833f},
-std::array<float,2>{0.199537039f, 0.430828124f},
-std::array<float,2>{0.932063103f, 0.861524045f},
-std::array<float,2>{0.776416659f, 0.36868012f},
-std::array<float,2>{0.0243375171f, 0.935978532f},
-std::array<float,2>{0.262223661f, 0.239598021f},
-std::array<float,2>{0.735780597f, 0.646206081f},
-std::array<float,2>{0.649859548f, 0.491463929f},
-std::array<float,2>{0.356787056f, 0.777878582f},
-std::array<float,2>{0.120058633f, 0.025180839f},
-std::array<float,2>{0.847753048f, 0.561927378f},
-std::array<float,2>{0.94537729f, 0.176720858f},
-std::array<float,2>{0.1296065f, 0.69746542f},
-std::array<float,2>{0.421303332f, 0.281826675f},
-std::array<float,2>{0.520419955f, 0.971574962f},
-std::array<float,2>{0.749311447f, 0.104792558f},
-std::array<float,2>{0.251391321f, 0.586302102f},
-std::array<float,2>{0.0233287327f, 0.395936251f},
-std::array<float,2>{0.770214856f, 0.817452073f},
-std::array<float,2>{0.929039299f, 0.330857277f},
-std::array<float,2>{0.194263756f, 0.876428246f},
-std::array<float,2>{0.46988219f, 0.202528581f},
-std::array<float,2>{0.604951501f, 0.684491754f},
-std::array<float,2>{0.530551493f, 0.457264274f},
-std::array<float,2>{0.412085623f, 0.802769303f},
-std::array<float,2>{0.138520002f, 0.0606854372f},
-std::array<float,2>{0.939343274f, 0.513008118f},
-std::array<float,2>{0.85280484f, 0.151277408f},
-std::array<float,2>{0.109829292f, 0.741476953f},
-std::array<float,2>{0.346406698f, 0.281192482f},
-std::array<float,2>{0.642386675f, 0.956216574f},
-std::array<float,2>{0.566500485f, 0.24645032f},
-std::array<float,2>{0.442183346f, 0.649212301f},
-std::array<float,2>{0.236375481f, 0.366514087f},
-std::array<float,2>{0.902888179f, 0.923400283f},
-std::array<float,2>{0.797003806f, 0.428752482f},
-std::array<float,2>{0.038635008f, 0.874826968f},
-std::array<float,2>{0.294143468f, 0.0906229168f},
-std::array<float,2>{0.711154044f, 0.595548451f},
-std::array<float,2>{0.664777756f, 0.289178371f},
-std::array<float,2>{0.340475291f, 0.980642319f},
-std::array<float,2>{0.0710373148f, 0.18385455f},
-std::array<float,2>{0.834703207f, 0.6904791f},
-std::array<float,2>{0.997175813f, 0.0194769409f},
-std::array<float,2>{0.161193028f, 0.547008395f},
-std::array<float,2>{0.387932003f, 0.493851751f},
-std::array<float,2>{0.535919011f, 0.771074831f},
-std::array<float,2>{0.62580204f, 0.161406249f},
-std::array<float,2>{0.36461556f, 0.716825902f},
-std::array<float,2>{0.0991396531f, 0.302753896f},
-std::array<float,2>{0.862270772f, 0.984804749f},
-std::array<float,2>{0.957025945f, 0.478408724f},
-std::array<float,2>{0.154225841f, 0.758324444f},
-std::array<float,2>{0.435043514f, 0.00520569226f},
-std::array<float,2>{0.500063121f, 0.544566214f},
-std::array<float,2>{0.623832047f, 0.352017641f},
-std::array<float,2>{0.491692692f, 0.919170141f},
-std::array<float,2>{0.215839058f, 0.231785461f},
-std::array<float,2>{0.908908188f, 0.625798464f},
-std::array<float,2>{0.755323529f, 0.0687315166f},
-std::array<float,2>{0.0144287841f, 0.621734381f},
-std::array<float,2>{0.268253982f, 0.406900197f},
-std::array<float,2>{0.732422531f, 0.844003081f},
-std::array<float,2>{0.561812282f, 0.040357478f},
-std::array<float,2>{0.397731602f, 0.516199946f},
-std::array<float,2>{0.184037477f, 0.44522658f},
-std::array<float,2>{0.983111143f, 0.787846327f},
-std::array<float,2>{0.820216775f, 0.253436148f},
-std::array<float,2>{0.0925555155f, 0.951815248f},
-std::array<float,2>{0.318064809f, 0.128567249f},
-std::array<float,2>{0.678089023f, 0.731601417f},
-std::array<float,2>{0.694721282f, 0.376908928f},
-std::array<float,2>{0.305381328f, 0.835487366f},
-std::array<float,2>{0.0623633638f, 0.12278714f},
-std::array<float,2>{0.793175876f, 0.570081413f},
-std::array<float,2>{0.887147307f, 0.207970619f},
-std::array<float,2>{0.228509218f, 0.667158306f},
-std::array<float,2>{0.461772114f, 0.326763213f},
-std::array<float,2>{0.587645292f, 0.891119599f},
-std::array<float,2>{0.709940135f, 0.00309810718f},
-std::array<float,2>{0.284721255f, 0.540455163f},
-std::array<float,2>{0.04425909f, 0.48177442f},
-std::array<float,2>{0.810196579f, 0.764971733f},
-std::array<float,2>{0.896100819f, 0.298066705f},
-std::array<float,2>{0.243792564f, 0.989411294f},
-std::array<float,2>{0.448162168f, 0.156474143f},
-std::array<float,2>{0.57448709f, 0.713940263f},
-std::array<float,2>{0.546546102f, 0.410306931f},
-std::array<float,2>{0.381666332f, 0.850978136f},
-std::array<float,2>{0.165185124f, 0.0655798018f},
-std::array<float,2>{0.987193167f, 0.620247781f},
-std::array<float,2>{0.83729291f, 0.228587836f},
-std::array<float,2>{0.067470327f, 0.632779419f},
-std::array<float,2>{0.335432321f, 0.358269304f},
-std::array<float,2>{0.661004961f, 0.917323589f},
-std::array<float,2>{0.597513914f, 0.129340366f},
-std::array<float,2>{0.480759948f, 0.728187323f},
-std::array<float,2>{0.198654935f, 0.254730374f},
-std::array<float,2>{0.936823487f, 0.94631058f},
-std::array<float,2>{0.777831912f, 0.437647551f},
-std::array<float,2>{0.028977951f, 0.784258842f},
-std::array<float,2>{0.25994432f, 0.0446629524f},
-std::array<float,2>{0.740305901f, 0.523293138f},
-std::array<float,2>{0.655470729f, 0.321415186f},
-std::array<float,2>{0.355417162f, 0.897990346f},
-std::array<float,2>{0.12257912f, 0.204087019f},
-std::array<float,2>{0.846675217f, 0.670258224f},
-std::array<float,2>{0.950248361f, 0.118872695f},
-std::array<float,2>{0.128631935f, 0.565857351f},
-std::array<float,2>{0.415500373f, 0.382416487f},
-std::array<float,2>{0.517167687f, 0.830846071f},
-std::array<float,2>{0.680089831f, 0.195715636f},
-std::array<float,2>{0.325984001f, 0.680992007f},
-std::array<float,2>{0.0853694007f, 0.333679944f},
-std::array<float,2>{0.82292676f, 0.881829858f},
-std::array<float,2>{0.969513953f, 0.391997069f},
-std::array<float,2>{0.173157513f, 0.815094352f},
-std::array<float,2>{0.399979621f, 0.10887821f},
-std::array<float,2>{0.547746301f, 0.590500832f},
-std::array<float,2>{0.583794951f, 0.275585085f},
-std::array<float,2>{0.45669803f, 0.958851874f},
-std::array<float,2>{0.219474167f, 0.152790591f},
-std::array<float,2>{0.882200181f, 0.735809863f},
-std::array<float,2>{0.781557381f, 0.0564052723f},
-std::array<float,2>{0.0525307097f, 0.511631906f},
-std::array<float,2>{0.304296374f, 0.4568654f},
-std::array<float,2>{0.70249474f, 0.799208224f},
-std::array<float,2>{0.5132429f, 0.088992089f},
-std::array<float,2>{0.424129605f, 0.598928094f},
-std::array<float,2>{0.147151306f, 0.423012674f},
-std::array<float,2>{0.964725673f, 0.867285907f},
-std::array<float,2>{0.874004006f, 0.360549361f},
-std::array<float,2>{0.108605362f, 0.928399265f},
-std::array<float,2>{0.374793053f, 0.245468393f},
-std::array<float,2>{0.63594985f, 0.655650437f},
-std::array<float,2>{0.72173208f, 0.499283284f},
-std::array<float,2>{0.276969552f, 0.768112838f},
-std::array<float,2>{0.00628650887f, 0.02058056f},
-std::array<float,2>{0.758196652f, 0.553960085f},
-std::array<float,2>{0.918722391f, 0.180465847f},
-std::array<float,2>{0.203549013f, 0.694339097f},
-std::array<float,2>{0.495243222f, 0.294004858f},
-std::array<float,2>{0.611965477f, 0.976971805f},
-std::array<float,2>{0.632761002f, 0.098914817f},
-std::array<float,2>{0.36285761f, 0.583040237f},
-std::array<float,2>{0.0956554711f, 0.401779383f},
-std::array<float,2>{0.864766061f, 0.824711204f},
-std::array<float,2>{0.957753241f, 0.343270212f},
-std::array<float,2>{0.152173311f, 0.887710214f},
-std::array<float,2>{0.431755722f, 0.187510312f},
-std::array<float,2>{0.505806625f, 0.672100842f},
-std::array<float,2>{0.618518233f, 0.466801465f},
-std::array<float,2>{0.484687746f, 0.806586087f},
-std::array<float,2>{0.211538404f, 0.0492694527f},
-std::array<float,2>{0.913925648f, 0.501736403f},
-std::array<float,2>{0.750844419f, 0.14121069f},
-std::array<float,2>{0.00810279325f, 0.74560976f},
-std::array<float,2>{0.272575527f, 0.265880436f},
-std::array<float,2>{0.728177369f, 0.962368608f},
-std::array<float,2>{0.558259189f, 0.237522677f},
-std::array<float,2>{0.39113614f, 0.644264698f},
-std::array<float,2>{0.18065834f, 0.374925226f},
-std::array<float,2>{0.97862184f, 0.932477534f},
-std::array<float,2>{0.816266239f, 0.435916305f},
-std::array<float,2>{0.087499395f, 0.866989315f},
-std::array<float,2>{0.315334946f, 0.08522477f},
-std::array<float,2>{0.673369527f, 0.607207954f},
-std::array<float,2>{0.687946796f, 0.285934985f},
-std::array<float,2>{0.30907771f, 0.975294888f},
-std::array<float,2>{0.055588454f, 0.173324376f},
-std::array<float,2>{0.791903317f, 0.700452805f},
-std::array<float,2>{0.885570526f, 0.0276967399f},
-std::array<float,2>{0.231955945f, 0.557327509f},
-std::array<float,2>{0.467026949f, 0.48592177f},
-std::array<float,2>{0.590475202f, 0.776419699f},
-std::array<float,2>{0.74416846f, 0.167276561f},
-std::array<float,2>{0.254622638f, 0.710089087f},
-std::array<float,2>{0.017616801f, 0.311914295f},
-std::array<float,2>{0.767029822f, 0.998762727f},
-std::array<float,2>{0.924280167f, 0.472189784f},
-std::array<float,2>{0.18807447f, 0.750435352f},
-std::array<float,2>{0.4741081f, 0.0100097125f},
-std::array<float,2>{0.605995834f, 0.534754515f},
-std::array<float,2>{0.526587486f, 0.347039849f},
-std::array<float,2>{0.410104007f, 0.907015562f},
-std::array<float,2>{0.135418668f, 0.218837932f},
-std::array<float,2>{0.941958904f, 0.638929486f},
-std::array<float,2>{0.858909667f, 0.0775677487f},
-std::array<float,2>{0.114344299f, 0.616761923f},
-std::array<float,2>{0.348248541f, 0.417812467f},
-std::array<float,2>{0.645150483f, 0.858027518f},
-std::array<float,2>{0.565275371f, 0.0357080586f},
-std::array<float,2>{0.43930012f, 0.529736638f},
-std::array<float,2>{0.239377096f, 0.447394222f},
-std::array<float,2>{0.89963156f, 0.792812228f},
-std::array<float,2>{0.803300023f, 0.26256907f},
-std::array<float,2>{0.0338363908f, 0.943581045f},
-std::array<float,2>{0.289770484f, 0.137698457f},
-std::array<float,2>{0.715795338f, 0.723020315f},
-std::array<float,2>{0.670107365f, 0.38680774f},
-std::array<float,2>{0.336568564f, 0.841735661f},
-std::array<float,2>{0.0747911185f, 0.111352943f},
-std::array<float,2>{0.831000686f, 0.570923209f},
-std::array<float,2>{0.994532824f, 0.215334103f},
-std::array<float,2>{0.158112496f, 0.663717926f},
-std::array<float,2>{0.38618052f, 0.31609571f},
-std::array<float,2>{0.533361256f, 0.903618932f},
-std::array<float,2>{0.656389296f, 0.0517991818f},
-std::array<float,2>{0.330226243f, 0.504103601f},
-std::array<float,2>{0.0640581772f, 0.462999076f},
-std::array<float,2>{0.841251433f, 0.812136292f},
-std::array<float,2>{0.991569221f, 0.272227287f},
-std::array<float,2>{0.169499129f, 0.966860116f},
-std::array<float,2>{0.375953466f, 0.148415655f},
-std::array<float,2>{0.540961683f, 0.748220265f},
-std::array<float,2>{0.574043691f, 0.403359681f},
-std::array<float,2>{0.452633798f, 0.821602702f},
-std::array<float,2>{0.246546999f, 0.0970494226f},
-std::array<float,2>{0.89289856f, 0.578331828f},
-std::array<float,2>{0.807295084f, 0.19282636f},
-std::array<float,2>{0.0407095738f, 0.677077651f},
-std::array<float,2>{0.288214415f, 0.338936985f},
-std::array<float,2>{0.706214845f, 0.88401401f},
-std::array<float,2>{0.520723164f, 0.178875491f},
-std::array<float,2>{0.42033717f, 0.695581615f},
-std::array<float,2>{0.130239427f, 0.28347069f},
-std::array<float,2>{0.946626782f, 0.970061183f},
-std::array<float,2>{0.848885834f, 0.488572478f},
-std::array<float,2>{0.121048108f, 0.780969203f},
-std::array<float,2>{0.356185824f, 0.0270213168f},
-std::array<float,2>{0.648479342f, 0.559663832f},
-std::array<float,2>{0.734682977f, 0.369861901f},
-std::array<float,2>{0.262863517f, 0.933783829f},
-std::array<float,2>{0.024524413f, 0.241146103f},
-std::array<float,2>{0.775441825f, 0.648369253f},
-std::array<float,2>{0.932619095f, 0.0813187063f},
-std::array<float,2>{0.200649932f, 0.604360044f},
-std::array<float,2>{0.477381825f, 0.431845903f},
-std::array<float,2>{0.59885329f, 0.860314012f},
-std::array<float,2>{0.697630167f, 0.226483688f},
-std::array<float,2>{0.299666584f, 0.635810912f},
-std::array<float,2>{0.0468935706f, 0.350778461f},
-std::array<float,2>{0.788461745f, 0.911594748f},
-std::array<float,2>{0.877043486f, 0.42141515f},
-std::array<float,2>{0.224822551f, 0.853651941f},
-std::array<float,2>{0.457681149f, 0.0704096183f},
-std::array<float,2>{0.578672528f, 0.612062395f},
-std::array<float,2>{0.554197133f, 0.306523591f},
-std::array<float,2>{0.405200571f, 0.994962335f},
-std::array<float,2>{0.178882241f, 0.170290887f},
-std::array<float,2>{0.97634995f, 0.705376983f},
-std::array<float,2>{0.825321496f, 0.0149834901f},
-std::array<float,2>{0.0801889673f, 0.537123978f},
-std::array<float,2>{0.321151823f, 0.475810289f},
-std::array<float,2>{0.684239447f, 0.756684124f},
-std::array<float,2>{0.613674402f, 0.113288827f},
-std::array<float,2>{0.497409642f, 0.575941324f},
-std::array<float,2>{0.207240894f, 0.385823458f},
-std::array<float,2>{0.915408194f, 0.839129269f},
-std::array<float,2>{0.762734175f, 0.319328308f},
-std::array<float,2>{0.00167270307f, 0.901087999f},
-std::array<float,2>{0.280980706f, 0.214219525f},
-std::array<float,2>{0.725374222f, 0.659142375f},
-std::array<float,2>{0.638886929f, 0.451820701f},
-std::array<float,2>{0.36965555f, 0.79490453f},
-std::array<float,2>{0.103091381f, 0.0326861814f},
-std::array<float,2>{0.86895895f, 0.525250256f},
-std::array<float,2>{0.967299163f, 0.134539559f},
-std::array<float,2>{0.141763255f, 0.719003379f},
-std::array<float,2>{0.429294795f, 0.26104781f},
-std::array<float,2>{0.510618627f, 0.939331472f},
-std::array<float,2>{0.734242737f, 0.0664587915f},
-std::array<float,2>{0.268702328f, 0.623309731f},
-std::array<float,2>{0.0154787432f, 0.408966899f},
-std::array<float,2>{0.754870892f, 0.845823884f},
-std::array<float,2>{0.909185112f, 0.355259717f},
-std::array<float,2>{0.215578079f, 0.920975029f},
-std::array<float,2>{0.490362376f, 0.234367982f},
-std::array<float,2>{0.624451399f, 0.626958907f},
-std::array<float,2>{0.501150548f, 0.479023993f},
-std::array<float,2>{0.434185863f, 0.760492921f},
-std::array<float,2>{0.152690589f, 0.00668412121f},
-std::array<float,2>{0.955904961f, 0.545821249f},
-std::array<float,2>{0.862451911f, 0.163247168f},
-std::array<float,2>{0.0982696638f, 0.715955079f},
-std::array<float,2>{0.364029139f, 0.30227223f},
-std::array<float,2>{0.626616538f, 0.987166703f},
-std::array<float,2>{0.586154938f, 0.209922478f},
-std::array<float,2>{0.462748259f, 0.664657235f},
-std::array<float,2>{0.227290958f, 0.325732112f},
-std::array<float,2>{0.888139486f, 0.893575966f},
-std::array<float,2>{0.794588745f, 0.377231777f},
-std::array<float,2>{0.0612517856f, 0.833940983f},
-std::array<float,2>{0.30607757f, 0.124031894f},
-std::array<float,2>{0.693474889f, 0.567229211f},
-std::array<float,2>{0.679243445f, 0.251071572f},
-std::array<float,2>{0.316929549f, 0.94969964f},
-std::array<float,2>{0.0934046283f, 0.126870796f},
-std::array<float,2>{0.819232881f, 0.734201074f},
-std::array<float,2>{0.983490169f, 0.0417163782f},
-std::array<float,2>{0.184997976f, 0.518362582f},
-std::array<float,2>{0.396511644f, 0.442567676f},
-std::array<float,2>{0.560871243f, 0.78553915f},
-std::array<float,2>{0.640878975f, 0.148738831f},
-std::array<float,2>{0.347314805f, 0.739557445f},
-std::array<float,2>{0.110881932f, 0.277473539f},
-std::array<float,2>{0.85168004f, 0.954072297f},
-std::array<float,2>{0.938112736f, 0.460709423f},
-std::array<float,2>{0.137158215f, 0.800960362f},
-std::array<float,2>{0.410451472f, 0.0588658229f},
-std::array<float,2>{0.529592097f, 0.514238417f},
-std::array<float,2>{0.603801131f, 0.330002576f},
-std::array<float,2>{0.468887687f, 0.878472447f},
-std::array<float,2>{0.195141539f, 0.199372426f},
-std::array<float,2>{0.928611577f, 0.686689138f},
-std::array<float,2>{0.770913243f, 0.102795184f},
-std::array<float,2>{0.0215132348f, 0.589797616f},
-std::array<float,2>{0.250504404f, 0.39792335f},
-std::array<float,2>{0.748363495f, 0.819293618f},
-std::array<float,2>{0.536807895f, 0.0163347907f},
-std::array<float,2>{0.387496471f, 0.550490201f},
-std::array<float,2>{0.160421968f, 0.495131314f},
-std::array<float,2>{0.996660054f, 0.773397028f},
-std::array<float,2>{0.835118115f, 0.291776687f},
-std::array<float,2>{0.0718891397f, 0.9843418f},
-std::array<float,2>{0.341442198f, 0.187121689f},
-std::array<float,2>{0.665423512f, 0.689433932f},
-std::array<float,2>{0.712824047f, 0.425879121f},
-std::array<float,2>{0.293123722f, 0.872759819f},
-std::array<float,2>{0.0375338309f, 0.0921489745f},
-std::array<float,2>{0.798419416f, 0.597427666f},
-std::array<float,2>{0.904168427f, 0.248414442f},
-std::array<float,2>{0.237520516f, 0.651322067f},
-std::array<float,2>{0.442500621f, 0.364691079f},
-std::array<float,2>{0.567962348f, 0.925407171f},
-std::array<float,2>{0.738842845f, 0.0468692966f},
-std::array<float,2>{0.259224832f, 0.521248162f},
-std::array<float,2>{0.0294598807f, 0.441278517f},
-std::array<float,2>{0.780243576f, 0.781958878f},
-std::array<float,2>{0.935115159f, 0.25664112f},
-std::array<float,2>{0.195347086f, 0.948954761f},
-std::array<float,2>{0.482990265f, 0.132487148f},
-std::array<float,2>{0.594378412f, 0.729775012f},
-std::array<float,2>{0.518925548f, 0.379956007f},
-std::array<float,2>{0.417934626f, 0.829268932f},
-std::array<float,2>{0.125711113f, 0.120923266f},
-std::array<float,2>{0.952770472f, 0.56325233f},
-std::array<float,2>{0.844347954f, 0.205079272f},
-std::array<float,2>{0.12411236f, 0.669445515f},
-std::array<float,2>{0.353420794f, 0.323476464f},
-std::array<float,2>{0.653457344f, 0.895825982f},
-std::array<float,2>{0.577042758f, 0.159537211f},
-std::array<float,2>{0.446670473f, 0.711077034f},
-std::array<float,2>{0.245814815f, 0.300350159f},
-std::array<float,2>{0.89811945f, 0.990252793f},
-std::array<float,2>{0.81171602f, 0.482736796f},
-std::array<float,2>{0.0467364825f, 0.762046993f},
-std::array<float,2>{0.281957448f, 0.00181933818f},
-std::array<float,2>{0.707040906f, 0.542002797f},
-std::array<float,2>{0.66275543f, 0.356903464f},
-std::array<float,2>{0.33332032f, 0.914842546f},
-std::array<float,2>{0.0688715875f, 0.226789981f},
-std::array<float,2>{0.838820875f, 0.629786372f},
-std::array<float,2>{0.985947251f, 0.0626988113f},
-std::array<float,2>{0.16710113f, 0.61798501f},
-std::array<float,2>{0.379305542f, 0.414027691f},
-std::array<float,2>{0.543294191f, 0.847751856f},
-std::array<float,2>{0.633892715f, 0.243879169f},
-std::array<float,2>{0.372272372f, 0.654173911f},
-std::array<float,2>{0.105748691f, 0.362780035f},
-std::array<float,2>{0.871702373f, 0.926177204f},
-std::array<float,2>{0.962857544f, 0.425454229f},
-std::array<float,2>{0.144926429f, 0.869891047f},
-std::array<float,2>{0.421952546f, 0.0868140161f},
-std::array<float,2>{0.515197873f, 0.599624097f},
-std::array<float,2>{0.609637439f, 0.295620739f},
-std::array<float,2>{0.493738353f, 0.978588641f},
-std::array<float,2>{0.206188738f, 0.181974769f},
-std::array<float,2>{0.921754479f, 0.692721248f},
-std::array<float,2>{0.761708796f, 0.022999024f},
-std::array<float,2>{0.00508660544f, 0.552577734f},
-std::array<float,2>{0.274880201f, 0.497130275f},
-std::array<float,2>{0.72037971f, 0.767127335f},
-std::array<float,2>{0.549660563f, 0.106897064f},
-std::array<float,2>{0.401843339f, 0.592964053f},
-std::array<float,2>{0.174294755f, 0.392715126f},
-std::array<float,2>{0.9721663f, 0.814054906f},
-std::array<float,2>{0.821886122f, 0.334741712f},
-std::array<float,2>{0.0828870535f, 0.879503667f},
-std::array<float,2>{0.327384144f, 0.197717056f},
-std::array<float,2>{0.681988418f, 0.683359146f},
-std::array<float,2>{0.700964272f, 0.454368174f},
-std::array<float,2>{0.301267862f, 0.797661185f},
-std::array<float,2>{0.0541192479f, 0.0577846542f},
-std::array<float,2>{0.784731746f, 0.509334624f},
-std::array<float,2>{0.880651355f, 0.154806614f},
-std::array<float,2>{0.222518459f, 0.738099992f},
-std::array<float,2>{0.454717875f, 0.274171621f},
-std::array<float,2>{0.584178984f, 0.959057331f},
-std::array<float,2>{0.674596131f, 0.0838265345f},
-std::array<float,2>{0.313695341f, 0.608438611f},
-std::array<float,2>{0.0882388055f, 0.434102952f},
-std::array<float,2>{0.81349647f, 0.864572287f},
-std::array<float,2>{0.976922631f, 0.37276724f},
-std::array<float,2>{0.182498932f, 0.930369139f},
-std::array<float,2>{0.393031627f, 0.235436678f},
-std::array<float,2>{0.556595623f, 0.642190993f},
-std::array<float,2>{0.593464255f, 0.486371607f},
-std::array<float,2>{0.466271818f, 0.775140822f},
-std::array<float,2>{0.232943907f, 0.0300179422f},
-std::array<float,2>{0.884316504f, 0.555492759f},
-std::array<float,2>{0.790810525f, 0.174724951f},
-std::array<float,2>{0.0584237576f, 0.702004373f},
-std::array<float,2>{0.31211555f, 0.287887633f},
-std::array<float,2>{0.690781295f, 0.97440815f},
-std::array<float,2>{0.507582366f, 0.190279603f},
-std::array<float,2>{0.43049702f, 0.673921406f},
-std::array<float,2>{0.149439335f, 0.341205776f},
-std::array<float,2>{0.960080028f, 0.890113592f},
-std::array<float,2>{0.866446674f, 0.398485303f},
-std::array<float,2>{0.0964092836f, 0.82710886f},
-std::array<float,2>{0.360910624f, 0.10067486f},
-std::array<float,2>{0.6289832f, 0.58591342f},
-std::array<float,2>{0.729501665f, 0.267663211f},
-std::array<float,2>{0.271003246f, 0.963020742f},
-std::array<float,2>{0.0117099863f, 0.144460559f},
-std::array<float,2>{0.752609968f, 0.74304688f},
-std::array<float,2>{0.910964727f, 0.047582563f},
-std::array<float,2>{0.214560241f, 0.502031386f},
-std::array<float,2>{0.488242865f, 0.466198534f},
-std::array<float,2>{0.619594812f, 0.808267593f},
-std::array<float,2>{0.718158126f, 0.140536755f},
-std::array<float,2>{0.292383641f, 0.725472093f},
-std::array<float,2>{0.0321466811f, 0.265122324f},
-std::array<float,2>{0.802481234f, 0.943248749f},
-std::array<float,2>{0.901784658f, 0.446930617f},
-std::array<float,2>{0.240542024f, 0.790392756f},
-std::array<float,2>{0.44011271f, 0.0380201191f},
-std::array<float,2>{0.563694358f, 0.528263986f},
-std::array<float,2>{0.533158302f, 0.313243717f},
-std::array<float,2>{0.384596795f, 0.904988706f},
-std::array<float,2>{0.158478513f, 0.218246952f},
-std::array<float,2>{0.992428958f, 0.661765337f},
-std::array<float,2>{0.828960121f, 0.10939122f},
-std::array<float,2>{0.0766326487f, 0.573399425f},
-std::array<float,2>{0.338765085f, 0.388726681f},
-std::array<float,2>{0.66908294f, 0.843615949f},
-std::array<float,2>{0.608817399f, 0.00799101591f},
-std::array<float,2>{0.476074725f, 0.531996846f},
-std::array<float,2>{0.189635813f, 0.468775004f},
-std::array<float,2>{0.922489345f, 0.752578437f},
-std::array<float,2>{0.76836437f, 0.308837563f},
-std::array<float,2>{0.0168827828f, 0.996412158f},
-std::array<float,2>{0.256094575f, 0.164604917f},
-std::array<float,2>{0.743449807f, 0.707314849f},
-std::array<float,2>{0.647189081f, 0.41512084f},
-std::array<float,2>{0.350524247f, 0.856138289f},
-std::array<float,2>{0.116093993f, 0.0743103325f},
-std::array<float,2>{0.856989324f, 0.614804447f},
-std::array<float,2>{0.943965256f, 0.220923305f},
-std::array<float,2>{0.133559346f, 0.637668133f},
-std::array<float,2>{0.407474697f, 0.34511286f},
-std::array<float,2>{0.524752796f, 0.909396887f},
-std::array<float,2>{0.650722027f, 0.0243932214f},
-std::array<float,2>{0.357726276f, 0.560548961f},
-std::array<float,2>{0.118827067f, 0.490559489f},
-std::array<float,2>{0.850227058f, 0.778833926f},
-std::array<float,2>{0.948230326f, 0.282612741f},
-std::array<float,2>{0.131148234f, 0.972335219f},
-std::array<float,2>{0.418198377f, 0.176840842f},
-std::array<float,2>{0.523055494f, 0.698350012f},
-std::array<float,2>{0.600987434f, 0.430609733f},
-std::array<float,2>{0.479627907f, 0.86257726f},
-std::array<float,2>{0.202768028f, 0.0786831677f},
-std::array<float,2>{0.930686951f, 0.602628887f},
-std::array<float,2>{0.775121272f, 0.238634124f},
-std::array<float,2>{0.0266914088f, 0.644811213f},
-std::array<float,2>{0.264093846f, 0.367325485f},
-std::array<float,2>{0.737515211f, 0.936536968f},
-std::array<float,2>{0.541933477f, 0.145221993f},
-std::array<float,2>{0.377902001f, 0.746759534f},
-std::array<float,2>{0.171111777f, 0.271095604f},
-std::array<float,2>{0.98928982f, 0.965378404f},
-std::array<float,2>{0.843518198f, 0.46216327f},
-std::array<float,2>{0.0650456101f, 0.809812307f},
-std::array<float,2>{0.329771936f, 0.0536220558f},
-std::array<float,2>{0.659937859f, 0.506418288f},
-std::array<float,2>{0.703563869f, 0.337214112f},
-std::array<float,2>{0.286049873f, 0.885725677f},
-std::array<float,2>{0.0417280309f, 0.194091067f},
-std::array<float,2>{0.805538237f, 0.6796332f},
-std::array<float,2>{0.892489254f, 0.094749853f},
-std::array<float,2>{0.249952838f, 0.581747174f},
-std::array<float,2>{0.450325549f, 0.404378623f},
-std::array<float,2>{0.572025716f, 0.822602332f},
-std::array<float,2>{0.722796082f, 0.211239427f},
-std::array<float,2>{0.277738452f, 0.656507432f},
-std::array<float,2>{0.00284136622f, 0.316820771f},
-std::array<float,2>{0.765319228f, 0.899901807f},
-std::array<float,2>{0.916415274f, 0.38434127f},
-std::array<float,2>{0.210627794f, 0.836862564f},
-std::array<float,2>{0.498970062f, 0.115727477f},
-std::array<float,2>{0.615372598f, 0.576334894f},
-std::array<float,2>{0.509257555f, 0.25932911f},
-std::array<float,2>{0.425831825f, 0.939735293f},
-std::array<float,2>{0.143332243f, 0.135457546f},
-std::array<float,2>{0.966047108f, 0.722519219f},
-std::array<float,2>{0.869678199f, 0.0332254656f},
-std::array<float,2>{0.103811041f, 0.525712371f},
-std::array<float,2>{0.367489189f, 0.449826568f},
-std::array<float,2>{0.637030363f, 0.795536101f},
-std::array<float,2>{0.581287205f, 0.0734325871f},
-std::array<float,2>{0.459614486f, 0.61041522f},
-std::array<float,2>{0.223383799f, 0.418496966f},
-std::array<float,2>{0.87686187f, 0.852199733f},
-std::array<float,2>{0.785551786f, 0.347889096f},
-std::array<float,2>{0.0496488027f, 0.913228571f},
-std::array<float,2>{0.298197538f, 0.22348085f},
-std::array<float,2>{0.695842505f, 0.633376539f},
-std::array<float,2>{0.686841786f, 0.472670972f},
-std::array<float,2>{0.323508859f, 0.754353404f},
-std::array<float,2>{0.0795762092f, 0.0122795943f},
-std::array<float,2>{0.826501727f, 0.536533296f},
-std::array<float,2>{0.973030925f, 0.168953761f},
-std::array<float,2>{0.177688122f, 0.704277039f},
-std::array<float,2>{0.402724177f, 0.306956977f},
-std::array<float,2>{0.551331818f, 0.993058681f},
-std::array<float,2>{0.692263722f, 0.121220909f},
-std::array<float,2>{0.308024883f, 0.568781674f},
-std::array<float,2>{0.058983285f, 0.37538451f},
-std::array<float,2>{0.794941485f, 0.834768772f},
-std::array<float,2>{0.889514804f, 0.327700347f},
-std::array<float,2>{0.229838297f, 0.891742706f},
-std::array<float,2>{0.463765204f, 0.208584294f},
-std::array<float,2>{0.588588417f, 0.666588604f},
-std::array<float,2>{0.559859872f, 0.444037795f},
-std::array<float,2>{0.396355957f, 0.78884393f},
-std::array<float,2>{0.185599193f, 0.0391468853f},
-std::array<float,2>{0.981859803f, 0.516913891f},
-std::array<float,2>{0.816622376f, 0.127864078f},
-std::array<float,2>{0.0903539285f, 0.731197238f},
-std::array<float,2>{0.320145845f, 0.252211452f},
-std::array<float,2>{0.676607192f, 0.952215254f},
-std::array<float,2>{0.62121433f, 0.230645657f},
-std::array<float,2>{0.489894301f, 0.626625597f},
-std::array<float,2>{0.217922151f, 0.353320092f},
-std::array<float,2>{0.906921804f, 0.918014824f},
-std::array<float,2>{0.757039547f, 0.407956958f},
-std::array<float,2>{0.0134895081f, 0.845581532f},
-std::array<float,2>{0.265883356f, 0.0702691674f},
-std::array<float,2>{0.731182158f, 0.622664094f},
-std::array<float,2>{0.628777266f, 0.304040581f},
-std::array<float,2>{0.366520584f, 0.985352397f},
-std::array<float,2>{0.101344429f, 0.160325125f},
-std::array<float,2>{0.86101526f, 0.718473256f},
-std::array<float,2>{0.954806149f, 0.00403397158f},
-std::array<float,2>{0.154479086f, 0.543115795f},
-std::array<float,2>{0.436053067f, 0.476615489f},
-std::array<float,2>{0.50228405f, 0.7588799f},
-std::array<float,2>{0.667578697f, 0.185008943f},
-std::array<float,2>{0.342423826f, 0.690004885f},
-std::array<float,2>{0.0729639605f, 0.290046006f},
-std::array<float,2>{0.833242118f, 0.981660306f},
-std::array<float,2>{0.99939394f, 0.492640287f},
-std::array<float,2>{0.163279623f, 0.770021081f},
-std::array<float,2>{0.388852388f, 0.0176680405f},
-std::array<float,2>{0.538187265f, 0.548816025f},
-std::array<float,2>{0.56859082f, 0.365318686f},
-std::array<float,2>{0.443707585f, 0.922257483f},
-std::array<float,2>{0.235518232f, 0.247099489f},
-std::array<float,2>{0.905764341f, 0.650208414f},
-std::array<float,2>{0.800725996f, 0.0913421884f},
-std::array<float,2>{0.0352077223f, 0.594195068f},
-std::array<float,2>{0.296517164f, 0.427997053f},
-std::array<float,2>{0.713823736f, 0.873902082f},
-std::array<float,2>{0.527812004f, 0.0621900111f},
-std::array<float,2>{0.413047135f, 0.512556672f},
-std::array<float,2>{0.140153944f, 0.458857745f},
-std::array<float,2>{0.939735711f, 0.804550231f},
-std::array<float,2>{0.855167329f, 0.279926986f},
-std::array<float,2>{0.112035185f, 0.955310583f},
-std::array<float,2>{0.343932509f, 0.152320057f},
-std::array<float,2>{0.642978132f, 0.740236938f},
-std::array<float,2>{0.747048259f, 0.395168036f},
-std::array<float,2>{0.253088057f, 0.816610336f},
-std::array<float,2>{0.0210866332f, 0.104451232f},
-std::array<float,2>{0.773254335f, 0.587067127f},
-std::array<float,2>{0.927302063f, 0.201807871f},
-std::array<float,2>{0.192649901f, 0.685395181f},
-std::array<float,2>{0.471302748f, 0.331831545f},
-std::array<float,2>{0.602769911f, 0.875509083f},
-std::array<float,2>{0.737575054f, 0.026361635f},
-std::array<float,2>{0.263737023f, 0.558861315f},
-std::array<float,2>{0.0264862962f, 0.489835888f},
-std::array<float,2>{0.775161088f, 0.7797153f},
-std::array<float,2>{0.931074202f, 0.284224033f},
-std::array<float,2>{0.202981025f, 0.969645977f},
-std::array<float,2>{0.479761392f, 0.178061694f},
-std::array<float,2>{0.600738645f, 0.696743846f},
-std::array<float,2>{0.52338475f, 0.43312481f},
-std::array<float,2>{0.418451369f, 0.860957861f},
-std::array<float,2>{0.13090685f, 0.0801575035f},
-std::array<float,2>{0.94789505f, 0.605255842f},
-std::array<float,2>{0.850453675f, 0.24199371f},
-std::array<float,2>{0.119137257f, 0.646878242f},
-std::array<float,2>{0.357457042f, 0.370751798f},
-std::array<float,2>{0.650568187f, 0.935523212f},
-std::array<float,2>{0.571941853f, 0.147456825f},
-std::array<float,2>{0.450593442f, 0.749515116f},
-std::array<float,2>{0.249607205f, 0.272764623f},
-std::array<float,2>{0.892297029f, 0.968318641f},
-std::array<float,2>{0.805181384f, 0.463941813f},
-std::array<float,2>{0.0419081934f, 0.810883164f},
-std::array<float,2>{0.285663307f, 0.0516561717f},
-std::array<float,2>{0.703263819f, 0.505061984f},
-std::array<float,2>{0.659820497f, 0.33835274f},
-std::array<float,2>{0.329963654f, 0.883734226f},
-std::array<float,2>{0.0652730316f, 0.19216384f},
-std::array<float,2>{0.843390346f, 0.676492691f},
-std::array<float,2>{0.989565253f, 0.0957770795f},
-std::array<float,2>{0.171304747f, 0.57932514f},
-std::array<float,2>{0.377578884f, 0.402797431f},
-std::array<float,2>{0.541508615f, 0.821103096f},
-std::array<float,2>{0.636906683f, 0.213518694f},
-std::array<float,2>{0.367248237f, 0.660109818f},
-std::array<float,2>{0.103642218f, 0.320297927f},
-std::array<float,2>{0.869939446f, 0.901677847f},
-std::array<float,2>{0.966073692f, 0.385267347f},
-std::array<float,2>{0.143231601f, 0.838197768f},
-std::array<float,2>{0.426235139f, 0.114641473f},
-std::array<float,2>{0.508995354f, 0.574986696f},
-std::array<float,2>{0.615688026f, 0.26066035f},
-std::array<float,2>{0.498535812f, 0.93798542f},
-std::array<float,2>{0.210909024f, 0.133412302f},
-std::array<float,2>{0.916143656f, 0.720193148f},
-std::array<float,2>{0.765383124f, 0.031698063f},
-std::array<float,2>{0.00245412695f, 0.523464441f},
-std::array<float,2>{0.277415305f, 0.453079194f},
-std::array<float,2>{0.723102748f, 0.793691874f},
-std::array<float,2>{0.55167371f, 0.071978949f},
-std::array<float,2>{0.402403116f, 0.613033593f},
-std::array<float,2>{0.177489847f, 0.419995695f},
-std::array<float,2>{0.972880006f, 0.855328977f},
-std::array<float,2>{0.826374292f, 0.350184709f},
-std::array<float,2>{0.0791241676f, 0.910892367f},
-std::array<float,2>{0.323245168f, 0.225153267f},
-std::array<float,2>{0.686689317f, 0.635448277f},
-std::array<float,2>{0.696085036f, 0.475441724f},
-std::array<float,2>{0.298072875f, 0.757070005f},
-std::array<float,2>{0.0495513603f, 0.0143563747f},
-std::array<float,2>{0.785389841f, 0.538497567f},
-std::array<float,2>{0.87666136f, 0.170995772f},
-std::array<float,2>{0.223536953f, 0.706867874f},
-std::array<float,2>{0.459840894f, 0.305663526f},
-std::array<float,2>{0.581305981f, 0.995227695f},
-std::array<float,2>{0.676367998f, 0.123911671f},
-std::array<float,2>{0.319910794f, 0.567786157f},
-std::array<float,2>{0.090752691f, 0.378405273f},
-std::array<float,2>{0.816719234f, 0.832797945f},
-std::array<float,2>{0.9815768f, 0.324291468f},
-std::array<float,2>{0.185972363f, 0.893361688f},
-std::array<float,2>{0.396042258f, 0.210495755f},
-std::array<float,2>{0.559774756f, 0.665990174f},
-std::array<float,2>{0.588715017f, 0.442345381f},
-std::array<float,2>{0.463459909f, 0.78651017f},
-std::array<float,2>{0.229498848f, 0.0426225141f},
-std::array<float,2>{0.889263213f, 0.519358575f},
-std::array<float,2>{0.795338631f, 0.125004128f},
-std::array<float,2>{0.0587912761f, 0.732695103f},
-std::array<float,2>{0.307702124f, 0.250123471f},
-std::array<float,2>{0.692011058f, 0.950238407f},
-std::array<float,2>{0.502178252f, 0.23266235f},
-std::array<float,2>{0.436497867f, 0.628150403f},
-std::array<float,2>{0.154701576f, 0.353979707f},
-std::array<float,2>{0.954874575f, 0.920528948f},
-std::array<float,2>{0.861308336f, 0.40933162f},
-std::array<float,2>{0.101303987f, 0.847634912f},
-std::array<float,2>{0.366251409f, 0.0679359362f},
-std::array<float,2>{0.628578067f, 0.624117196f},
-std::array<float,2>{0.731335998f, 0.300931603f},
-std::array<float,2>{0.265837401f, 0.988157809f},
-std::array<float,2>{0.0133255618f, 0.162498727f},
-std::array<float,2>{0.757168174f, 0.715366304f},
-std::array<float,2>{0.907201886f, 0.00770482887f},
-std::array<float,2>{0.218258873f, 0.546331108f},
-std::array<float,2>{0.490011841f, 0.479784369f},
-std::array<float,2>{0.621375024f, 0.760906935f},
-std::array<float,2>{0.713445544f, 0.186298326f},
-std::array<float,2>{0.296712607f, 0.688225389f},
-std::array<float,2>{0.0355069339f, 0.292490989f},
-std::array<float,2>{0.800464034f, 0.982444406f},
-std::array<float,2>{0.90610671f, 0.494562089f},
-std::array<float,2>{0.235815197f, 0.772414505f},
-std::array<float,2>{0.443538785f, 0.0174717959f},
-std::array<float,2>{0.568698287f, 0.549496293f},
-std::array<float,2>{0.538368165f, 0.363704592f},
-std::array<float,2>{0.388936281f, 0.924597204f},
-std::array<float,2>{0.163437501f, 0.249493971f},
-std::array<float,2>{0.999230921f, 0.652175069f},
-std::array<float,2>{0.833389044f, 0.0937211588f},
-std::array<float,2>{0.0730060115f, 0.596405268f},
-std::array<float,2>{0.342690915f, 0.427706271f},
-std::array<float,2>{0.66776377f, 0.871123672f},
-std::array<float,2>{0.602837384f, 0.0597589202f},
-std::array<float,2>{0.471449465f, 0.515509903f},
-std::array<float,2>{0.192441061f, 0.459183276f},
-std::array<float,2>{0.927665532f, 0.802410603f},
-std::array<float,2>{0.77312237f, 0.278559953f},
-std::array<float,2>{0.0214802194f, 0.954716384f},
-std::array<float,2>{0.253222525f, 0.150234595f},
-std::array<float,2>{0.74678731f, 0.738310397f},
-std::array<float,2>{0.642776251f, 0.397201121f},
-std::array<float,2>{0.34403941f, 0.820088506f},
-std::array<float,2>{0.112263054f, 0.102151364f},
-std::array<float,2>{0.855343342f, 0.588183224f},
-std::array<float,2>{0.939616382f, 0.200569466f},
-std::array<float,2>{0.140521735f, 0.686117649f},
-std::array<float,2>{0.412685931f, 0.329054773f},
-std::array<float,2>{0.527409017f, 0.87727046f},
-std::array<float,2>{0.653641522f, 0.0434696376f},
-std::array<float,2>{0.35305202f, 0.521501362f},
-std::array<float,2>{0.124384105f, 0.439256459f},
-std::array<float,2>{0.844567657f, 0.783460021f},
-std::array<float,2>{0.953095078f, 0.255781323f},
-std::array<float,2>{0.125967696f, 0.945481062f},
-std::array<float,2>{0.41749683f, 0.130736336f},
-std::array<float,2>{0.518652797f, 0.726812422f},
-std::array<float,2>{0.594723463f, 0.381216377f},
-std::array<float,2>{0.48317948f, 0.831430495f},
-std::array<float,2>{0.195730835f, 0.117752813f},
-std::array<float,2>{0.935334444f, 0.564781129f},
-std::array<float,2>{0.779967129f, 0.204623029f},
-std::array<float,2>{0.0296885967f, 0.671405017f},
-std::array<float,2>{0.258804768f, 0.321184158f},
-std::array<float,2>{0.739013731f, 0.897171319f},
-std::array<float,2>{0.543204725f, 0.158110082f},
-std::array<float,2>{0.37897715f, 0.713559508f},
-std::array<float,2>{0.167354375f, 0.297140032f},
-std::array<float,2>{0.986189008f, 0.989020109f},
-std::array<float,2>{0.838600457f, 0.481411994f},
-std::array<float,2>{0.0690984428f, 0.763935506f},
-std::array<float,2>{0.333199203f, 0.00238693319f},
-std::array<float,2>{0.662957788f, 0.539861798f},
-std::array<float,2>{0.707327247f, 0.358719349f},
-std::array<float,2>{0.282124639f, 0.916383028f},
-std::array<float,2>{0.0464379713f, 0.230182767f},
-std::array<float,2>{0.811961949f, 0.631425619f},
-std::array<float,2>{0.898250341f, 0.0645139441f},
-std::array<float,2>{0.245948404f, 0.619740546f},
-std::array<float,2>{0.446401089f, 0.411825925f},
-std::array<float,2>{0.576691985f, 0.85032028f},
-std::array<float,2>{0.720650733f, 0.244471118f},
-std::array<float,2>{0.274465561f, 0.654342115f},
-std::array<float,2>{0.00522275595f, 0.359993517f},
-std::array<float,2>{0.761345625f, 0.929678977f},
-std::array<float,2>{0.921414077f, 0.422605127f},
-std::array<float,2>{0.206385136f, 0.868537664f},
-std::array<float,2>{0.493997008f, 0.088363722f},
-std::array<float,2>{0.60942477f, 0.598332465f},
-std::array<float,2>{0.515415013f, 0.293518692f},
-std::array<float,2>{0.422145635f, 0.978394032f},
-std::array<float,2>{0.144762263f, 0.181629449f},
-std::array<float,2>{0.962562859f, 0.694023907f},
-std::array<float,2>{0.872003794f, 0.0197908524f},
-std::array<float,2>{0.105667181f, 0.553469002f},
-std::array<float,2>{0.372435778f, 0.498108476f},
-std::array<float,2>{0.63404125f, 0.769047737f},
-std::array<float,2>{0.584286749f, 0.108084604f},
-std::array<float,2>{0.4549312f, 0.591673672f},
-std::array<float,2>{0.222310945f, 0.391495049f},
-std::array<float,2>{0.880378604f, 0.815807164f},
-std::array<float,2>{0.785030305f, 0.332166255f},
-std::array<float,2>{0.0539046042f, 0.882045984f},
-std::array<float,2>{0.30082503f, 0.197181568f},
-std::array<float,2>{0.700848758f, 0.680498242f},
-std::array<float,2>{0.681745291f, 0.455694109f},
-std::array<float,2>{0.327396989f, 0.800092757f},
-std::array<float,2>{0.0826061144f, 0.0549905412f},
-std::array<float,2>{0.822228372f, 0.510279179f},
-std::array<float,2>{0.971760631f, 0.153766215f},
-std::array<float,2>{0.173997387f, 0.734781325f},
-std::array<float,2>{0.401402742f, 0.276631415f},
-std::array<float,2>{0.549535453f, 0.957135618f},
-std::array<float,2>{0.690508962f, 0.084660694f},
-std::array<float,2>{0.312419742f, 0.606366456f},
-std::array<float,2>{0.0581767187f, 0.437359661f},
-std::array<float,2>{0.790744185f, 0.865756392f},
-std::array<float,2>{0.884631276f, 0.373598337f},
-std::array<float,2>{0.233287573f, 0.933270931f},
-std::array<float,2>{0.466041088f, 0.237267524f},
-std::array<float,2>{0.593521893f, 0.642874539f},
-std::array<float,2>{0.556227624f, 0.484973103f},
-std::array<float,2>{0.392658383f, 0.775415897f},
-std::array<float,2>{0.182369366f, 0.0292608161f},
-std::array<float,2>{0.976590931f, 0.557912409f},
-std::array<float,2>{0.813827991f, 0.171948254f},
-std::array<float,2>{0.0880865827f, 0.700067222f},
-std::array<float,2>{0.313790888f, 0.286766618f},
-std::array<float,2>{0.67432332f, 0.976411819f},
-std::array<float,2>{0.619253099f, 0.18866019f},
-std::array<float,2>{0.488010496f, 0.673066795f},
-std::array<float,2>{0.214645073f, 0.34217608f},
-std::array<float,2>{0.910752535f, 0.887098968f},
-std::array<float,2>{0.752790034f, 0.401251912f},
-std::array<float,2>{0.0114643611f, 0.82600373f},
-std::array<float,2>{0.271339804f, 0.0984533429f},
-std::array<float,2>{0.729887068f, 0.582462847f},
-std::array<float,2>{0.62919867f, 0.26665163f},
-std::array<float,2>{0.361238092f, 0.961787164f},
-std::array<float,2>{0.0965322927f, 0.141877323f},
-std::array<float,2>{0.866695523f, 0.744989097f},
-std::array<float,2>{0.960239649f, 0.0498486944f},
-std::array<float,2>{0.149781555f, 0.500002861f},
-std::array<float,2>{0.430282533f, 0.468129605f},
-std::array<float,2>{0.507397532f, 0.80546701f},
-std::array<float,2>{0.669401109f, 0.137395993f},
-std::array<float,2>{0.338512778f, 0.724176824f},
-std::array<float,2>{0.0763379708f, 0.262849748f},
-std::array<float,2>{0.828781903f, 0.944718719f},
-std::array<float,2>{0.992566884f, 0.449136138f},
-std::array<float,2>{0.15825896f, 0.791377366f},
-std::array<float,2>{0.384478122f, 0.0366816074f},
-std::array<float,2>{0.532862663f, 0.530953884f},
-std::array<float,2>{0.563901007f, 0.314631373f},
-std::array<float,2>{0.440307617f, 0.90309f},
-std::array<float,2>{0.240285888f, 0.216349155f},
-std::array<float,2>{0.901523113f, 0.663057029f},
-std::array<float,2>{0.802674413f, 0.113274477f},
-std::array<float,2>{0.0318727344f, 0.572235703f},
-std::array<float,2>{0.2920748f, 0.388030559f},
-std::array<float,2>{0.717792094f, 0.839851975f},
-std::array<float,2>{0.524576485f, 0.0111205652f},
-std::array<float,2>{0.407350212f, 0.533775032f},
-std::array<float,2>{0.133336872f, 0.471318245f},
-std::array<float,2>{0.944219768f, 0.75151962f},
-std::array<float,2>{0.85741508f, 0.310565144f},
-std::array<float,2>{0.115797095f, 0.999792814f},
-std::array<float,2>{0.350116521f, 0.16642195f},
-std::array<float,2>{0.647259355f, 0.709220946f},
-std::array<float,2>{0.743171096f, 0.416358113f},
-std::array<float,2>{0.25633052f, 0.859036744f},
-std::array<float,2>{0.0168159083f, 0.0767282099f},
-std::array<float,2>{0.768176913f, 0.615268648f},
-std::array<float,2>{0.92263633f, 0.220165819f},
-std::array<float,2>{0.189930812f, 0.640596211f},
-std::array<float,2>{0.476415128f, 0.346198767f},
-std::array<float,2>{0.608419061f, 0.908015072f},
-std::array<float,2>{0.7063061f, 0.0537914038f},
-std::array<float,2>{0.288532823f, 0.507781982f},
-std::array<float,2>{0.0408191867f, 0.461224824f},
-std::array<float,2>{0.807487369f, 0.808641732f},
-std::array<float,2>{0.892665982f, 0.269695491f},
-std::array<float,2>{0.246300623f, 0.966338038f},
-std::array<float,2>{0.452376455f, 0.146139711f},
-std::array<float,2>{0.573865116f, 0.747119367f},
-std::array<float,2>{0.54076457f, 0.405521423f},
-std::array<float,2>{0.375497103f, 0.82362783f},
-std::array<float,2>{0.169828564f, 0.0939214081f},
-std::array<float,2>{0.991345704f, 0.580125332f},
-std::array<float,2>{0.841042578f, 0.195246369f},
-std::array<float,2>{0.0644301176f, 0.678642571f},
-std::array<float,2>{0.330400407f, 0.336093009f},
-std::array<float,2>{0.656500459f, 0.886696339f},
-std::array<float,2>{0.599110186f, 0.175886139f},
-std::array<float,2>{0.477278411f, 0.697773039f},
-std::array<float,2>{0.200323552f, 0.281375706f},
-std::array<float,2>{0.932901263f, 0.970828772f},
-std::array<float,2>{0.775829196f, 0.491905957f},
-std::array<float,2>{0.0246853232f, 0.777425885f},
-std::array<float,2>{0.262945741f, 0.0246481169f},
-std::array<float,2>{0.734463394f, 0.562252462f},
-std::array<float,2>{0.648681939f, 0.368261755f},
-std::array<float,2>{0.356328785f, 0.936100066f},
-std::array<float,2>{0.120758943f, 0.23993735f},
-std::array<float,2>{0.848684013f, 0.645830393f},
-std::array<float,2>{0.946329832f, 0.0799501389f},
-std::array<float,2>{0.129986227f, 0.602088928f},
-std::array<float,2>{0.420141041f, 0.431615114f},
-std::array<float,2>{0.520790935f, 0.862131596f},
-std::array<float,2>{0.684458137f, 0.223935366f},
-std::array<float,2>{0.321037352f, 0.63461566f},
-std::array<float,2>{0.080509223f, 0.349588037f},
-std::array<float,2>{0.825605512f, 0.912622213f},
-std::array<float,2>{0.976274192f, 0.4196904f},
-std::array<float,2>{0.179082289f, 0.853437424f},
-std::array<float,2>{0.404968083f, 0.0728017837f},
-std::array<float,2>{0.553760648f, 0.610223055f},
-std::array<float,2>{0.579039991f, 0.308477849f},
-std::array<float,2>{0.457915068f, 0.993798971f},
-std::array<float,2>{0.224963009f, 0.168785557f},
-std::array<float,2>{0.877438784f, 0.703503788f},
-std::array<float,2>{0.788242102f, 0.013592558f},
-std::array<float,2>{0.0471747145f, 0.535472333f},
-std::array<float,2>{0.299501628f, 0.473675519f},
-std::array<float,2>{0.697476208f, 0.755372584f},
-std::array<float,2>{0.510325313f, 0.116678998f},
-std::array<float,2>{0.429580122f, 0.577417314f},
-std::array<float,2>{0.141893983f, 0.38292259f},
-std::array<float,2>{0.967639863f, 0.837005138f},
-std::array<float,2>{0.868874371f, 0.317957431f},
-std::array<float,2>{0.103427619f, 0.899372399f},
-std::array<float,2>{0.370015115f, 0.212414756f},
-std::array<float,2>{0.638994932f, 0.65799737f},
-std::array<float,2>{0.725192785f, 0.450979322f},
-std::array<float,2>{0.2810224f, 0.796620727f},
-std::array<float,2>{0.00189282629f, 0.0344299637f},
-std::array<float,2>{0.762985766f, 0.527123809f},
-std::array<float,2>{0.9151932f, 0.136188745f},
-std::array<float,2>{0.207404003f, 0.720783174f},
-std::array<float,2>{0.497286648f, 0.258055389f},
-std::array<float,2>{0.613518178f, 0.940452516f},
-std::array<float,2>{0.626713693f, 0.06930691f},
-std::array<float,2>{0.363884509f, 0.621172309f},
-std::array<float,2>{0.0985863283f, 0.406396121f},
-std::array<float,2>{0.862733126f, 0.844400942f},
-std::array<float,2>{0.955757678f, 0.352388024f},
-std::array<float,2>{0.152464628f, 0.919547856f},
-std::array<float,2>{0.434378952f, 0.232250378f},
-std::array<float,2>{0.501233041f, 0.625317335f},
-std::array<float,2>{0.62410289f, 0.477579564f},
-std::array<float,2>{0.490609765f, 0.758001208f},
-std::array<float,2>{0.215402409f, 0.00578594906f},
-std::array<float,2>{0.90958184f, 0.54435271f},
-std::array<float,2>{0.754583538f, 0.161668211f},
-std::array<float,2>{0.0151433935f, 0.717755258f},
-std::array<float,2>{0.268976897f, 0.303501457f},
-std::array<float,2>{0.734113038f, 0.985085189f},
-std::array<float,2>{0.56068927f, 0.207457349f},
-std::array<float,2>{0.39694652f, 0.667547822f},
-std::array<float,2>{0.184672877f, 0.326645792f},
-std::array<float,2>{0.983816206f, 0.890894711f},
-std::array<float,2>{0.818996489f, 0.376153469f},
-std::array<float,2>{0.0936291218f, 0.834965944f},
-std::array<float,2>{0.317271531f, 0.122443072f},
-std::array<float,2>{0.679678261f, 0.569791794f},
-std::array<float,2>{0.693616986f, 0.25333631f},
-std::array<float,2>{0.305870265f, 0.951620042f},
-std::array<float,2>{0.0613174736f, 0.128204346f},
-std::array<float,2>{0.794904172f, 0.732278228f},
-std::array<float,2>{0.887863636f, 0.040796943f},
-std::array<float,2>{0.227530047f, 0.515627086f},
-std::array<float,2>{0.462542564f, 0.4444502f},
-std::array<float,2>{0.586379647f, 0.78732425f},
-std::array<float,2>{0.748080909f, 0.150429532f},
-std::array<float,2>{0.250886142f, 0.741704047f},
-std::array<float,2>{0.0217867754f, 0.280733526f},
-std::array<float,2>{0.770717025f, 0.956907272f},
-std::array<float,2>{0.928298533f, 0.45762378f},
-std::array<float,2>{0.194840521f, 0.80335474f},
-std::array<float,2>{0.469140947f, 0.0610958971f},
-std::array<float,2>{0.60362488f, 0.513513923f},
-std::array<float,2>{0.529374599f, 0.33027932f},
-std::array<float,2>{0.410400212f, 0.876877785f},
-std::array<float,2>{0.136870041f, 0.202797398f},
-std::array<float,2>{0.938263714f, 0.68374157f},
-std::array<float,2>{0.851937294f, 0.105074145f},
-std::array<float,2>{0.11121399f, 0.586569011f},
-std::array<float,2>{0.347480893f, 0.396344244f},
-std::array<float,2>{0.640789807f, 0.818142295f},
-std::array<float,2>{0.568266749f, 0.0188370757f},
-std::array<float,2>{0.442866594f, 0.547791004f},
-std::array<float,2>{0.237742499f, 0.49360761f},
-std::array<float,2>{0.903879046f, 0.770894229f},
-std::array<float,2>{0.798787117f, 0.289915591f},
-std::array<float,2>{0.0371581838f, 0.981218398f},
-std::array<float,2>{0.293429255f, 0.184403226f},
-std::array<float,2>{0.712481201f, 0.691142142f},
-std::array<float,2>{0.665073395f, 0.429234087f},
-std::array<float,2>{0.341564476f, 0.874233961f},
-std::array<float,2>{0.0722391456f, 0.0902020484f},
-std::array<float,2>{0.835308611f, 0.5949471f},
-std::array<float,2>{0.997001827f, 0.246626332f},
-std::array<float,2>{0.160201043f, 0.648442388f},
-std::array<float,2>{0.387442499f, 0.367138177f},
-std::array<float,2>{0.536987126f, 0.923141122f},
-std::array<float,2>{0.660801351f, 0.00051379262f},
-std::array<float,2>{0.334985763f, 0.541570008f},
-std::array<float,2>{0.0678441003f, 0.483639777f},
-std::array<float,2>{0.837116361f, 0.763180852f},
-std::array<float,2>{0.987005711f, 0.299375951f},
-std::array<float,2>{0.165326595f, 0.991213977f},
-std::array<float,2>{0.381483763f, 0.158697605f},
-std::array<float,2>{0.546798587f, 0.712683737f},
-std::array<float,2>{0.574445903f, 0.412524432f},
-std::array<float,2>{0.447872937f, 0.84885633f},
-std::array<float,2>{0.244014606f, 0.0641101375f},
-std::array<float,2>{0.896458447f, 0.618402839f},
-std::array<float,2>{0.810504675f, 0.227971181f},
-std::array<float,2>{0.0440993309f, 0.630368352f},
-std::array<float,2>{0.285027951f, 0.356099665f},
-std::array<float,2>{0.709635139f, 0.915478885f},
-std::array<float,2>{0.517501354f, 0.131835729f},
-std::array<float,2>{0.415219814f, 0.728957117f},
-std::array<float,2>{0.128860399f, 0.257243782f},
-std::array<float,2>{0.950677812f, 0.947998464f},
-std::array<float,2>{0.846328497f, 0.44028002f},
-std::array<float,2>{0.122977816f, 0.782408535f},
-std::array<float,2>{0.355009913f, 0.045703534f},
-std::array<float,2>{0.655582905f, 0.520424783f},
-std::array<float,2>{0.740592718f, 0.322896928f},
-std::array<float,2>{0.2601794f, 0.894750118f},
-std::array<float,2>{0.0291529614f, 0.206524268f},
-std::array<float,2>{0.777557015f, 0.668054938f},
-std::array<float,2>{0.936533689f, 0.119984828f},
-std::array<float,2>{0.198246911f, 0.563577473f},
-std::array<float,2>{0.480592132f, 0.378983289f},
-std::array<float,2>{0.59738791f, 0.828206003f},
-std::array<float,2>{0.702350557f, 0.199092269f},
-std::array<float,2>{0.304620862f, 0.682201266f},
-std::array<float,2>{0.0522769541f, 0.335561901f},
-std::array<float,2>{0.781393886f, 0.880839407f},
-std::array<float,2>{0.882065594f, 0.39356795f},
-std::array<float,2>{0.21956709f, 0.813419819f},
-std::array<float,2>{0.456837595f, 0.105743542f},
-std::array<float,2>{0.583621979f, 0.592076898f},
-std::array<float,2>{0.547578573f, 0.274636596f},
-std::array<float,2>{0.40035972f, 0.959967136f},
-std::array<float,2>{0.172985405f, 0.155772448f},
-std::array<float,2>{0.969257593f, 0.736342549f},
-std::array<float,2>{0.823083699f, 0.05715378f},
-std::array<float,2>{0.0851741955f, 0.508246243f},
-std::array<float,2>{0.325707763f, 0.454098433f},
-std::array<float,2>{0.679791391f, 0.797895133f},
-std::array<float,2>{0.61222136f, 0.0874596313f},
-std::array<float,2>{0.495542467f, 0.600855649f},
-std::array<float,2>{0.203246728f, 0.424135834f},
-std::array<float,2>{0.918562114f, 0.87091732f},
-std::array<float,2>{0.757894754f, 0.362029672f},
-std::array<float,2>{0.00600039121f, 0.927484691f},
-std::array<float,2>{0.277136087f, 0.242188409f},
-std::array<float,2>{0.722119272f, 0.652490377f},
-std::array<float,2>{0.63620013f, 0.496375322f},
-std::array<float,2>{0.374754548f, 0.766060531f},
-std::array<float,2>{0.108830169f, 0.0214948393f},
-std::array<float,2>{0.873623669f, 0.551141977f},
-std::array<float,2>{0.964592814f, 0.183286503f},
-std::array<float,2>{0.147305191f, 0.691754282f},
-std::array<float,2>{0.423981726f, 0.296752572f},
-std::array<float,2>{0.513578176f, 0.979522645f},
-std::array<float,2>{0.728397548f, 0.099927552f},
-std::array<float,2>{0.272822797f, 0.584791601f},
-std::array<float,2>{0.00795377977f, 0.400062323f},
-std::array<float,2>{0.750592947f, 0.828002751f},
-std::array<float,2>{0.913602412f, 0.340588868f},
-std::array<float,2>{0.21181871f, 0.889215648f},
-std::array<float,2>{0.484585166f, 0.191389933f},
-std::array<float,2>{0.61834085f, 0.675357461f},
-std::array<float,2>{0.505601048f, 0.464892805f},
-std::array<float,2>{0.431893975f, 0.807116866f},
-std::array<float,2>{0.152025789f, 0.0487883948f},
-std::array<float,2>{0.957942128f, 0.503659904f},
-std::array<float,2>{0.865112245f, 0.143232435f},
-std::array<float,2>{0.0954499692f, 0.743350685f},
-std::array<float,2>{0.363267362f, 0.269385248f},
-std::array<float,2>{0.632511795f, 0.964372575f},
-std::array<float,2>{0.590746939f, 0.235271111f},
-std::array<float,2>{0.467120051f, 0.64159584f},
-std::array<float,2>{0.232256144f, 0.371619284f},
-std::array<float,2>{0.885401905f, 0.930730402f},
-std::array<float,2>{0.791668415f, 0.434749424f},
-std::array<float,2>{0.0553262308f, 0.86332494f},
-std::array<float,2>{0.308822989f, 0.082664229f},
-std::array<float,2>{0.68757385f, 0.608280778f},
-std::array<float,2>{0.673734248f, 0.288504004f},
-std::array<float,2>{0.315033585f, 0.97342062f},
-std::array<float,2>{0.0876944512f, 0.175498664f},
-std::array<float,2>{0.816141367f, 0.702855527f},
-std::array<float,2>{0.97883153f, 0.0303464793f},
-std::array<float,2>{0.180417761f, 0.556250036f},
-std::array<float,2>{0.391456634f, 0.488114327f},
-std::array<float,2>{0.558478475f, 0.774383783f},
-std::array<float,2>{0.645361781f, 0.16590634f},
-std::array<float,2>{0.34841159f, 0.708112299f},
-std::array<float,2>{0.114529446f, 0.310387939f},
-std::array<float,2>{0.859142423f, 0.9971596f},
-std::array<float,2>{0.94228816f, 0.470490813f},
-std::array<float,2>{0.135635719f, 0.753830016f},
-std::array<float,2>{0.409889191f, 0.00908920728f},
-std::array<float,2>{0.526849926f, 0.532854676f},
-std::array<float,2>{0.606243372f, 0.344314814f},
-std::array<float,2>{0.473849565f, 0.90916568f},
-std::array<float,2>{0.188409492f, 0.221881732f},
-std::array<float,2>{0.924040437f, 0.63810873f},
-std::array<float,2>{0.766735554f, 0.0755389854f},
-std::array<float,2>{0.0179203767f, 0.613860726f},
-std::array<float,2>{0.254714847f, 0.414150327f},
-std::array<float,2>{0.74455446f, 0.857111871f},
-std::array<float,2>{0.533679545f, 0.0385181196f},
-std::array<float,2>{0.385877311f, 0.529170334f},
-std::array<float,2>{0.15791814f, 0.446012586f},
-std::array<float,2>{0.994274318f, 0.789514065f},
-std::array<float,2>{0.830770314f, 0.264523536f},
-std::array<float,2>{0.0751071945f, 0.942321241f},
-std::array<float,2>{0.336692929f, 0.139473602f},
-std::array<float,2>{0.670369267f, 0.726491928f},
-std::array<float,2>{0.715386271f, 0.390227199f},
-std::array<float,2>{0.289957076f, 0.842359304f},
-std::array<float,2>{0.0340417773f, 0.111027338f},
-std::array<float,2>{0.803477526f, 0.572387576f},
-std::array<float,2>{0.89969188f, 0.216853976f},
-std::array<float,2>{0.239629373f, 0.661080778f},
-std::array<float,2>{0.43908447f, 0.313562483f},
-std::array<float,2>{0.564955533f, 0.905742943f},
-std::array<float,2>{0.698606551f, 0.0153582431f},
-std::array<float,2>{0.300446838f, 0.537944973f},
-std::array<float,2>{0.0480590686f, 0.476415724f},
-std::array<float,2>{0.787448525f, 0.756231427f},
-std::array<float,2>{0.878592968f, 0.305790156f},
-std::array<float,2>{0.226340339f, 0.994520009f},
-std::array<float,2>{0.45800814f, 0.170776382f},
-std::array<float,2>{0.579762161f, 0.706013024f},
-std::array<float,2>{0.553529263f, 0.421340972f},
-std::array<float,2>{0.405903697f, 0.854215384f},
-std::array<float,2>{0.17871061f, 0.0709960982f},
-std::array<float,2>{0.975236714f, 0.611747265f},
-std::array<float,2>{0.824335456f, 0.225819543f},
-std::array<float,2>{0.0818811804f, 0.636618078f},
-std::array<float,2>{0.321794778f, 0.35148108f},
-std::array<float,2>{0.685463786f, 0.912047625f},
-std::array<float,2>{0.614428222f, 0.133853108f},
-std::array<float,2>{0.496616721f, 0.719390869f},
-std::array<float,2>{0.20856522f, 0.261282891f},
-std::array<float,2>{0.914593995f, 0.938733459f},
-std::array<float,2>{0.762129307f, 0.451424152f},
-std::array<float,2>{4.79671617e-05f, 0.793952703f},
-std::array<float,2>{0.279951483f, 0.0327163376f},
-std::array<float,2>{0.726132274f, 0.524798691f},
-std::array<float,2>{0.64050138f, 0.318592221f},
-std::array<float,2>{0.370834947f, 0.900749803f},
-std::array<float,2>{0.102490857f, 0.214392677f},
-std::array<float,2>{0.86734122f, 0.658350885f},
-std::array<float,2>{0.968217373f, 0.11383079f},
-std::array<float,2>{0.141315222f, 0.575294971f},
-std::array<float,2>{0.428137153f, 0.386374712f},
-std::array<float,2>{0.511116803f, 0.839493275f},
-std::array<float,2>{0.657642066f, 0.193183929f},
-std::array<float,2>{0.331468284f, 0.677309692f},
-std::array<float,2>{0.0627590492f, 0.339720309f},
-std::array<float,2>{0.840560853f, 0.884677768f},
-std::array<float,2>{0.990347862f, 0.40402326f},
-std::array<float,2>{0.168773711f, 0.822101176f},
-std::array<float,2>{0.376683414f, 0.0974293947f},
-std::array<float,2>{0.5393731f, 0.579063594f},
-std::array<float,2>{0.572516441f, 0.271618366f},
-std::array<float,2>{0.451850951f, 0.967711747f},
-std::array<float,2>{0.247788399f, 0.147732019f},
-std::array<float,2>{0.893984199f, 0.748810172f},
-std::array<float,2>{0.808082998f, 0.052546978f},
-std::array<float,2>{0.0391811691f, 0.504588902f},
-std::array<float,2>{0.288018495f, 0.46349144f},
-std::array<float,2>{0.705628872f, 0.811694801f},
-std::array<float,2>{0.520224631f, 0.0818695128f},
-std::array<float,2>{0.42093271f, 0.603994012f},
-std::array<float,2>{0.12966615f, 0.432572573f},
-std::array<float,2>{0.945704997f, 0.859584153f},
-std::array<float,2>{0.848056734f, 0.369216532f},
-std::array<float,2>{0.119831167f, 0.934282303f},
-std::array<float,2>{0.356586426f, 0.240270108f},
-std::array<float,2>{0.649492562f, 0.647944689f},
-std::array<float,2>{0.73535639f, 0.488993794f},
-std::array<float,2>{0.262501031f, 0.780706406f},
-std::array<float,2>{0.0241016522f, 0.0266163517f},
-std::array<float,2>{0.77679044f, 0.560427964f},
-std::array<float,2>{0.931649268f, 0.179319337f},
-std::array<float,2>{0.199397743f, 0.696164906f},
-std::array<float,2>{0.478136182f, 0.283709705f},
-std::array<float,2>{0.598102033f, 0.970579743f},
-std::array<float,2>{0.642332971f, 0.103191435f},
-std::array<float,2>{0.346454501f, 0.588873148f},
-std::array<float,2>{0.109381661f, 0.398014516f},
-std::array<float,2>{0.852612138f, 0.818524361f},
-std::array<float,2>{0.939020813f, 0.329188198f},
-std::array<float,2>{0.138207346f, 0.877958655f},
-std::array<float,2>{0.41183877f, 0.19973062f},
-std::array<float,2>{0.53030473f, 0.687473834f},
-std::array<float,2>{0.604734123f, 0.460228026f},
-std::array<float,2>{0.470124066f, 0.801315784f},
-std::array<float,2>{0.193942666f, 0.0594032481f},
-std::array<float,2>{0.928942621f, 0.513836145f},
-std::array<float,2>{0.770394087f, 0.149340227f},
-std::array<float,2>{0.0231225789f, 0.73978126f},
-std::array<float,2>{0.250982314f, 0.278046995f},
-std::array<float,2>{0.749222457f, 0.953381538f},
-std::array<float,2>{0.535740316f, 0.248600513f},
-std::array<float,2>{0.387987047f, 0.650613427f},
-std::array<float,2>{0.161445171f, 0.364911556f},
-std::array<float,2>{0.997550607f, 0.924911022f},
-std::array<float,2>{0.834857702f, 0.426478624f},
-std::array<float,2>{0.0710812062f, 0.872245431f},
-std::array<float,2>{0.340716034f, 0.0925354809f},
-std::array<float,2>{0.664854348f, 0.59697479f},
-std::array<float,2>{0.711307049f, 0.291059852f},
-std::array<float,2>{0.29429251f, 0.983707249f},
-std::array<float,2>{0.0390387438f, 0.18695119f},
-std::array<float,2>{0.797120512f, 0.688481808f},
-std::array<float,2>{0.90316385f, 0.0157108027f},
-std::array<float,2>{0.236749753f, 0.549885511f},
-std::array<float,2>{0.44212836f, 0.495781124f},
-std::array<float,2>{0.56677705f, 0.772778869f},
-std::array<float,2>{0.732780635f, 0.163710847f},
-std::array<float,2>{0.268481851f, 0.716362178f},
-std::array<float,2>{0.0143496729f, 0.301790714f},
-std::array<float,2>{0.754950285f, 0.986573935f},
-std::array<float,2>{0.909131527f, 0.478640109f},
-std::array<float,2>{0.216205299f, 0.759977162f},
-std::array<float,2>{0.491296142f, 0.00627576699f},
-std::array<float,2>{0.623585582f, 0.545119524f},
-std::array<float,2>{0.500262201f, 0.354618758f},
-std::array<float,2>{0.434785068f, 0.921547174f},
-std::array<float,2>{0.153835624f, 0.233726576f},
-std::array<float,2>{0.956678331f, 0.627769887f},
-std::array<float,2>{0.861915469f, 0.0669398233f},
-std::array<float,2>{0.0993780419f, 0.623918772f},
-std::array<float,2>{0.36442855f, 0.408401161f},
-std::array<float,2>{0.625541627f, 0.846519887f},
-std::array<float,2>{0.587661147f, 0.0413604751f},
-std::array<float,2>{0.461456567f, 0.517840683f},
-std::array<float,2>{0.228045553f, 0.443125695f},
-std::array<float,2>{0.886937678f, 0.786084533f},
-std::array<float,2>{0.793340206f, 0.251744717f},
-std::array<float,2>{0.0620292015f, 0.949883103f},
-std::array<float,2>{0.305498302f, 0.126451388f},
-std::array<float,2>{0.694346964f, 0.733691633f},
-std::array<float,2>{0.677943826f, 0.377720654f},
-std::array<float,2>{0.3181642f, 0.833239019f},
-std::array<float,2>{0.0925251991f, 0.124774799f},
-std::array<float,2>{0.820044339f, 0.566414237f},
-std::array<float,2>{0.983325362f, 0.209238008f},
-std::array<float,2>{0.183597863f, 0.664345026f},
-std::array<float,2>{0.397673965f, 0.325328916f},
-std::array<float,2>{0.56158483f, 0.894428432f},
-std::array<float,2>{0.681343794f, 0.0561342575f},
-std::array<float,2>{0.324926019f, 0.511129379f},
-std::array<float,2>{0.084287405f, 0.456258237f},
-std::array<float,2>{0.823310554f, 0.79932636f},
-std::array<float,2>{0.96995002f, 0.27612257f},
-std::array<float,2>{0.172339246f, 0.95828259f},
-std::array<float,2>{0.398739964f, 0.152850777f},
-std::array<float,2>{0.548128426f, 0.736310184f},
-std::array<float,2>{0.58254385f, 0.39233619f},
-std::array<float,2>{0.455430478f, 0.814910412f},
-std::array<float,2>{0.22001344f, 0.109265134f},
-std::array<float,2>{0.88164103f, 0.589912295f},
-std::array<float,2>{0.783168554f, 0.196244419f},
-std::array<float,2>{0.0509027913f, 0.681222737f},
-std::array<float,2>{0.302999914f, 0.333261639f},
-std::array<float,2>{0.701482832f, 0.881244481f},
-std::array<float,2>{0.512499392f, 0.179730713f},
-std::array<float,2>{0.425721526f, 0.694921911f},
-std::array<float,2>{0.148014992f, 0.294912964f},
-std::array<float,2>{0.963112473f, 0.977461398f},
-std::array<float,2>{0.874806345f, 0.499592483f},
-std::array<float,2>{0.107756257f, 0.767949879f},
-std::array<float,2>{0.373109192f, 0.0214206669f},
-std::array<float,2>{0.635620177f, 0.554304481f},
-std::array<float,2>{0.72142446f, 0.360854298f},
-std::array<float,2>{0.27562204f, 0.928084731f},
-std::array<float,2>{0.00697087124f, 0.245985955f},
-std::array<float,2>{0.75976485f, 0.655822814f},
-std::array<float,2>{0.919386864f, 0.0894198939f},
-std::array<float,2>{0.204623774f, 0.599517763f},
-std::array<float,2>{0.494321913f, 0.423458457f},
-std::array<float,2>{0.613017082f, 0.867965162f},
-std::array<float,2>{0.710551381f, 0.229208454f},
-std::array<float,2>{0.283451021f, 0.632230639f},
-std::array<float,2>{0.043320559f, 0.357466131f},
-std::array<float,2>{0.808778048f, 0.917663574f},
-std::array<float,2>{0.895213842f, 0.410955995f},
-std::array<float,2>{0.24271737f, 0.851216376f},
-std::array<float,2>{0.449101061f, 0.0661623403f},
-std::array<float,2>{0.576019585f, 0.621001959f},
-std::array<float,2>{0.545648038f, 0.298741162f},
-std::array<float,2>{0.382261127f, 0.990118444f},
-std::array<float,2>{0.164960876f, 0.156857222f},
-std::array<float,2>{0.988007545f, 0.714805782f},
-std::array<float,2>{0.836615622f, 0.0034747913f},
-std::array<float,2>{0.0673437119f, 0.541000128f},
-std::array<float,2>{0.334411979f, 0.482277185f},
-std::array<float,2>{0.661825716f, 0.76554203f},
-std::array<float,2>{0.596001029f, 0.118400872f},
-std::array<float,2>{0.481687933f, 0.566111386f},
-std::array<float,2>{0.197269171f, 0.382309765f},
-std::array<float,2>{0.936196625f, 0.830226421f},
-std::array<float,2>{0.779087484f, 0.322215438f},
-std::array<float,2>{0.0283143036f, 0.897925794f},
-std::array<float,2>{0.261017323f, 0.203491002f},
-std::array<float,2>{0.741956592f, 0.670803785f},
-std::array<float,2>{0.654354334f, 0.43827945f},
-std::array<float,2>{0.353687316f, 0.784673095f},
-std::array<float,2>{0.121839419f, 0.0440401174f},
-std::array<float,2>{0.847334146f, 0.522866726f},
-std::array<float,2>{0.949492872f, 0.129651636f},
-std::array<float,2>{0.127055839f, 0.727629364f},
-std::array<float,2>{0.414234042f, 0.2542741f},
-std::array<float,2>{0.515873551f, 0.947087467f},
-std::array<float,2>{0.745802701f, 0.0780874193f},
-std::array<float,2>{0.254970282f, 0.616681576f},
-std::array<float,2>{0.0190694574f, 0.417441159f},
-std::array<float,2>{0.76588136f, 0.857784867f},
-std::array<float,2>{0.925111711f, 0.347620636f},
-std::array<float,2>{0.189056009f, 0.906477273f},
-std::array<float,2>{0.473400921f, 0.219522521f},
-std::array<float,2>{0.606865108f, 0.639331877f},
-std::array<float,2>{0.526274443f, 0.471979052f},
-std::array<float,2>{0.409062564f, 0.75065881f},
-std::array<float,2>{0.136411965f, 0.0105747106f},
-std::array<float,2>{0.942751169f, 0.534440935f},
-std::array<float,2>{0.857812047f, 0.16794233f},
-std::array<float,2>{0.114183486f, 0.710496128f},
-std::array<float,2>{0.349510849f, 0.312414318f},
-std::array<float,2>{0.645509899f, 0.998075008f},
-std::array<float,2>{0.565720797f, 0.215145826f},
-std::array<float,2>{0.438115805f, 0.663294077f},
-std::array<float,2>{0.23899141f, 0.31588316f},
-std::array<float,2>{0.89939791f, 0.903986633f},
-std::array<float,2>{0.804546952f, 0.387522846f},
-std::array<float,2>{0.035115283f, 0.840904057f},
-std::array<float,2>{0.29072684f, 0.112278946f},
-std::array<float,2>{0.716347635f, 0.570342302f},
-std::array<float,2>{0.671389937f, 0.261830211f},
-std::array<float,2>{0.337291002f, 0.944093764f},
-std::array<float,2>{0.0752702355f, 0.138452336f},
-std::array<float,2>{0.831755102f, 0.723592579f},
-std::array<float,2>{0.995839596f, 0.0353624411f},
-std::array<float,2>{0.156802863f, 0.529877365f},
-std::array<float,2>{0.385291487f, 0.447790831f},
-std::array<float,2>{0.53419745f, 0.792192757f},
-std::array<float,2>{0.631538093f, 0.140882045f},
-std::array<float,2>{0.361773729f, 0.745456219f},
-std::array<float,2>{0.0939879119f, 0.266461879f},
-std::array<float,2>{0.864131689f, 0.962730944f},
-std::array<float,2>{0.958983898f, 0.467608809f},
-std::array<float,2>{0.150574207f, 0.805994928f},
-std::array<float,2>{0.432713926f, 0.0496117435f},
-std::array<float,2>{0.504880428f, 0.501425505f},
-std::array<float,2>{0.618138313f, 0.342954606f},
-std::array<float,2>{0.485361367f, 0.888260543f},
-std::array<float,2>{0.212236553f, 0.188267604f},
-std::array<float,2>{0.912137389f, 0.672682405f},
-std::array<float,2>{0.751691759f, 0.0995398536f},
-std::array<float,2>{0.00896300934f, 0.583687067f},
-std::array<float,2>{0.272406012f, 0.402258933f},
-std::array<float,2>{0.727438509f, 0.824497759f},
-std::array<float,2>{0.557364404f, 0.028065756f},
-std::array<float,2>{0.391934723f, 0.556915104f},
-std::array<float,2>{0.181221679f, 0.485834718f},
-std::array<float,2>{0.979990959f, 0.777154088f},
-std::array<float,2>{0.815089941f, 0.28523913f},
-std::array<float,2>{0.0867799744f, 0.974895716f},
-std::array<float,2>{0.315756977f, 0.173806772f},
-std::array<float,2>{0.672814429f, 0.700718582f},
-std::array<float,2>{0.688801467f, 0.43643102f},
-std::array<float,2>{0.309909284f, 0.866683364f},
-std::array<float,2>{0.0560148917f, 0.0857908949f},
-std::array<float,2>{0.792058051f, 0.60688138f},
-std::array<float,2>{0.886476934f, 0.238010004f},
-std::array<float,2>{0.230664313f, 0.643627465f},
-std::array<float,2>{0.467980117f, 0.374400586f},
-std::array<float,2>{0.591739416f, 0.931661129f},
-std::array<float,2>{0.724313617f, 0.0340492874f},
-std::array<float,2>{0.278809726f, 0.526041806f},
-std::array<float,2>{0.0036315727f, 0.449268758f},
-std::array<float,2>{0.764170766f, 0.794934154f},
-std::array<float,2>{0.917783678f, 0.258797109f},
-std::array<float,2>{0.209097087f, 0.94004935f},
-std::array<float,2>{0.499925435f, 0.134973034f},
-std::array<float,2>{0.616219878f, 0.722137392f},
-std::array<float,2>{0.508202136f, 0.384004682f},
-std::array<float,2>{0.427627087f, 0.83607471f},
-std::array<float,2>{0.144447491f, 0.115500383f},
-std::array<float,2>{0.965605736f, 0.5769099f},
-std::array<float,2>{0.870441496f, 0.211785167f},
-std::array<float,2>{0.104751535f, 0.65692693f},
-std::array<float,2>{0.368361235f, 0.317304581f},
-std::array<float,2>{0.638225198f, 0.900049865f},
-std::array<float,2>{0.580511868f, 0.16989857f},
-std::array<float,2>{0.460059822f, 0.704636872f},
-std::array<float,2>{0.223761544f, 0.3072972f},
-std::array<float,2>{0.875450671f, 0.99243921f},
-std::array<float,2>{0.786666811f, 0.473320633f},
-std::array<float,2>{0.05010546f, 0.754696906f},
-std::array<float,2>{0.296938777f, 0.0121362582f},
-std::array<float,2>{0.696795642f, 0.536956429f},
-std::array<float,2>{0.686314046f, 0.348376334f},
-std::array<float,2>{0.322634459f, 0.913922846f},
-std::array<float,2>{0.0781497136f, 0.222893432f},
-std::array<float,2>{0.827632725f, 0.633253813f},
-std::array<float,2>{0.97392571f, 0.0737729147f},
-std::array<float,2>{0.17651701f, 0.611034334f},
-std::array<float,2>{0.403900981f, 0.418400705f},
-std::array<float,2>{0.552115321f, 0.851649106f},
-std::array<float,2>{0.6521433f, 0.239146829f},
-std::array<float,2>{0.358772933f, 0.645293117f},
-std::array<float,2>{0.117541149f, 0.367767721f},
-std::array<float,2>{0.851164222f, 0.937311053f},
-std::array<float,2>{0.948485792f, 0.429986954f},
-std::array<float,2>{0.132202938f, 0.863056123f},
-std::array<float,2>{0.41978541f, 0.0782029629f},
-std::array<float,2>{0.522250354f, 0.603071213f},
-std::array<float,2>{0.599781752f, 0.283056408f},
-std::array<float,2>{0.479189068f, 0.971791625f},
-std::array<float,2>{0.201179951f, 0.177357048f},
-std::array<float,2>{0.930086434f, 0.698783994f},
-std::array<float,2>{0.773554206f, 0.0238761678f},
-std::array<float,2>{0.0256401654f, 0.561059475f},
-std::array<float,2>{0.264714509f, 0.491127789f},
-std::array<float,2>{0.736981809f, 0.778557718f},
-std::array<float,2>{0.542799115f, 0.0955141485f},
-std::array<float,2>{0.378652424f, 0.581169784f},
-std::array<float,2>{0.170015708f, 0.404986918f},
-std::array<float,2>{0.988427579f, 0.82302475f},
-std::array<float,2>{0.841898561f, 0.337628782f},
-std::array<float,2>{0.0660654679f, 0.884785116f},
-std::array<float,2>{0.328698486f, 0.193576589f},
-std::array<float,2>{0.658725083f, 0.678734541f},
-std::array<float,2>{0.704942405f, 0.462843835f},
-std::array<float,2>{0.28618291f, 0.810284674f},
-std::array<float,2>{0.0421010591f, 0.053201355f},
-std::array<float,2>{0.806476891f, 0.506237507f},
-std::array<float,2>{0.891468585f, 0.144863516f},
-std::array<float,2>{0.248200461f, 0.746474862f},
-std::array<float,2>{0.449638397f, 0.270718247f},
-std::array<float,2>{0.571159542f, 0.965102851f},
-std::array<float,2>{0.666379213f, 0.091168046f},
-std::array<float,2>{0.343641043f, 0.594448626f},
-std::array<float,2>{0.0741991773f, 0.428667307f},
-std::array<float,2>{0.832340956f, 0.873085797f},
-std::array<float,2>{0.998713911f, 0.365800917f},
-std::array<float,2>{0.16219908f, 0.922643006f},
-std::array<float,2>{0.390554607f, 0.247758195f},
-std::array<float,2>{0.537538886f, 0.649508476f},
-std::array<float,2>{0.570043683f, 0.492757946f},
-std::array<float,2>{0.444717437f, 0.769802928f},
-std::array<float,2>{0.235245183f, 0.0183356199f},
-std::array<float,2>{0.904470384f, 0.548274159f},
-std::array<float,2>{0.79971385f, 0.185430586f},
-std::array<float,2>{0.0370667577f, 0.689935565f},
-std::array<float,2>{0.295510471f, 0.290787071f},
-std::array<float,2>{0.713900149f, 0.981951118f},
-std::array<float,2>{0.528915226f, 0.201409474f},
-std::array<float,2>{0.413635314f, 0.68502897f},
-std::array<float,2>{0.139305189f, 0.331218928f},
-std::array<float,2>{0.94108963f, 0.875132322f},
-std::array<float,2>{0.853971839f, 0.394919306f},
-std::array<float,2>{0.112664871f, 0.816917896f},
-std::array<float,2>{0.345513701f, 0.103805646f},
-std::array<float,2>{0.64425993f, 0.587839961f},
-std::array<float,2>{0.747392237f, 0.27930823f},
-std::array<float,2>{0.252396971f, 0.955948174f},
-std::array<float,2>{0.0198637564f, 0.151701748f},
-std::array<float,2>{0.772288501f, 0.740799129f},
-std::array<float,2>{0.926344931f, 0.0619246364f},
-std::array<float,2>{0.19175674f, 0.512012184f},
-std::array<float,2>{0.472404391f, 0.458064288f},
-std::array<float,2>{0.602484226f, 0.803785622f},
-std::array<float,2>{0.693339527f, 0.12717998f},
-std::array<float,2>{0.306678385f, 0.73070699f},
-std::array<float,2>{0.0600511059f, 0.252497047f},
-std::array<float,2>{0.795980096f, 0.952967107f},
-std::array<float,2>{0.890049577f, 0.443542868f},
-std::array<float,2>{0.229368657f, 0.788182974f},
-std::array<float,2>{0.464414477f, 0.0396485925f},
-std::array<float,2>{0.589175105f, 0.51746726f},
-std::array<float,2>{0.559499264f, 0.327175856f},
-std::array<float,2>{0.394612461f, 0.892507493f},
-std::array<float,2>{0.186577141f, 0.208148718f},
-std::array<float,2>{0.980669498f, 0.666281402f},
-std::array<float,2>{0.818065941f, 0.121816665f},
-std::array<float,2>{0.0910041034f, 0.56924206f},
-std::array<float,2>{0.319119036f, 0.375707358f},
-std::array<float,2>{0.676854193f, 0.834176779f},
-std::array<float,2>{0.622289121f, 0.0047543929f},
-std::array<float,2>{0.488567203f, 0.543744504f},
-std::array<float,2>{0.217263997f, 0.47747311f},
-std::array<float,2>{0.907506585f, 0.759322524f},
-std::array<float,2>{0.75678575f, 0.304314643f},
-std::array<float,2>{0.0119460914f, 0.985946417f},
-std::array<float,2>{0.267078727f, 0.160691947f},
-std::array<float,2>{0.732353389f, 0.718133807f},
-std::array<float,2>{0.6275298f, 0.407467574f},
-std::array<float,2>{0.365240306f, 0.8447662f},
-std::array<float,2>{0.100158952f, 0.069701694f},
-std::array<float,2>{0.85961324f, 0.622437656f},
-std::array<float,2>{0.953475773f, 0.231015563f},
-std::array<float,2>{0.156064749f, 0.626094818f},
-std::array<float,2>{0.43691802f, 0.3528319f},
-std::array<float,2>{0.503418505f, 0.918742299f},
-std::array<float,2>{0.632817924f, 0.0228764415f},
-std::array<float,2>{0.371262461f, 0.551990449f},
-std::array<float,2>{0.106959894f, 0.497925341f},
-std::array<float,2>{0.872154593f, 0.766642749f},
-std::array<float,2>{0.961877823f, 0.294978797f},
-std::array<float,2>{0.145721644f, 0.97929728f},
-std::array<float,2>{0.423222452f, 0.18236804f},
-std::array<float,2>{0.513911188f, 0.692948997f},
-std::array<float,2>{0.610540807f, 0.42503342f},
-std::array<float,2>{0.493048459f, 0.869520426f},
-std::array<float,2>{0.205849901f, 0.0863931626f},
-std::array<float,2>{0.920834422f, 0.600141048f},
-std::array<float,2>{0.76038295f, 0.24321647f},
-std::array<float,2>{0.00403467566f, 0.653474689f},
-std::array<float,2>{0.273750454f, 0.362970054f},
-std::array<float,2>{0.719165921f, 0.926319301f},
-std::array<float,2>{0.549823821f, 0.154309571f},
-std::array<float,2>{0.401315689f, 0.737739265f},
-std::array<float,2>{0.175096333f, 0.27356261f},
-std::array<float,2>{0.970945358f, 0.959840059f},
-std::array<float,2>{0.82045126f, 0.454608411f},
-std::array<float,2>{0.0835694298f, 0.797284663f},
-std::array<float,2>{0.326642901f, 0.0581729673f},
-std::array<float,2>{0.68266046f, 0.508999288f},
-std::array<float,2>{0.700128973f, 0.334046364f},
-std::array<float,2>{0.302377641f, 0.879254103f},
-std::array<float,2>{0.0529975221f, 0.198077708f},
-std::array<float,2>{0.783334434f, 0.683034003f},
-std::array<float,2>{0.879534185f, 0.10730008f},
-std::array<float,2>{0.221001297f, 0.593643248f},
-std::array<float,2>{0.453433692f, 0.393410146f},
-std::array<float,2>{0.585117877f, 0.813952446f},
-std::array<float,2>{0.739440262f, 0.205977917f},
-std::array<float,2>{0.258192062f, 0.6694085f},
-std::array<float,2>{0.0306360871f, 0.323850989f},
-std::array<float,2>{0.781243563f, 0.896051526f},
-std::array<float,2>{0.933780015f, 0.380636215f},
-std::array<float,2>{0.196998298f, 0.829838991f},
-std::array<float,2>{0.483697236f, 0.120170452f},
-std::array<float,2>{0.595204711f, 0.562625706f},
-std::array<float,2>{0.51763016f, 0.25608632f},
-std::array<float,2>{0.41622442f, 0.948374271f},
-std::array<float,2>{0.126575246f, 0.13186346f},
-std::array<float,2>{0.951422632f, 0.730336607f},
-std::array<float,2>{0.844903409f, 0.0462120958f},
-std::array<float,2>{0.123352632f, 0.52054292f},
-std::array<float,2>{0.352096796f, 0.440807968f},
-std::array<float,2>{0.65281266f, 0.781452477f},
-std::array<float,2>{0.578073144f, 0.0633965433f},
-std::array<float,2>{0.445698172f, 0.617521822f},
-std::array<float,2>{0.244824335f, 0.413395077f},
-std::array<float,2>{0.897347569f, 0.848304808f},
-std::array<float,2>{0.811061084f, 0.356945068f},
-std::array<float,2>{0.0456386581f, 0.914428592f},
-std::array<float,2>{0.282718748f, 0.227317467f},
-std::array<float,2>{0.708448708f, 0.629332542f},
-std::array<float,2>{0.664000928f, 0.483081549f},
-std::array<float,2>{0.332108498f, 0.762292445f},
-std::array<float,2>{0.069718346f, 0.00120988861f},
-std::array<float,2>{0.839201927f, 0.542492747f},
-std::array<float,2>{0.985127568f, 0.159790307f},
-std::array<float,2>{0.166260317f, 0.711681485f},
-std::array<float,2>{0.380231321f, 0.300185412f},
-std::array<float,2>{0.544912696f, 0.99101007f},
-std::array<float,2>{0.716847181f, 0.11007645f},
-std::array<float,2>{0.29143402f, 0.574121058f},
-std::array<float,2>{0.0326745324f, 0.389182657f},
-std::array<float,2>{0.801557302f, 0.843246758f},
-std::array<float,2>{0.901212156f, 0.312798589f},
-std::array<float,2>{0.241275474f, 0.904669702f},
-std::array<float,2>{0.440635651f, 0.218580768f},
-std::array<float,2>{0.56312567f, 0.661397457f},
-std::array<float,2>{0.531277299f, 0.446742177f},
-std::array<float,2>{0.382880211f, 0.79098314f},
-std::array<float,2>{0.159606263f, 0.0373341963f},
-std::array<float,2>{0.993656337f, 0.527656674f},
-std::array<float,2>{0.829924762f, 0.140112042f},
-std::array<float,2>{0.0774927959f, 0.724631727f},
-std::array<float,2>{0.339265108f, 0.265439868f},
-std::array<float,2>{0.667970777f, 0.942868412f},
-std::array<float,2>{0.608042181f, 0.22148332f},
-std::array<float,2>{0.474769503f, 0.637031138f},
-std::array<float,2>{0.190448225f, 0.345309645f},
-std::array<float,2>{0.923707962f, 0.909773171f},
-std::array<float,2>{0.76904285f, 0.415752679f},
-std::array<float,2>{0.0159853771f, 0.855485618f},
-std::array<float,2>{0.257057428f, 0.0751532167f},
-std::array<float,2>{0.742593169f, 0.614636242f},
-std::array<float,2>{0.647759914f, 0.309172213f},
-std::array<float,2>{0.351520389f, 0.996824861f},
-std::array<float,2>{0.116542734f, 0.164487839f},
-std::array<float,2>{0.856131732f, 0.707982183f},
-std::array<float,2>{0.945122361f, 0.00875144731f},
-std::array<float,2>{0.13382633f, 0.531597733f},
-std::array<float,2>{0.406289667f, 0.469271511f},
-std::array<float,2>{0.523982465f, 0.752348661f},
-std::array<float,2>{0.675187945f, 0.174036771f},
-std::array<float,2>{0.313151121f, 0.701277018f},
-std::array<float,2>{0.0892406479f, 0.287521839f},
-std::array<float,2>{0.813001573f, 0.974027753f},
-std::array<float,2>{0.978503287f, 0.486925453f},
-std::array<float,2>{0.183234796f, 0.774612546f},
-std::array<float,2>{0.394368619f, 0.0296125989f},
-std::array<float,2>{0.555553973f, 0.555173039f},
-std::array<float,2>{0.592582285f, 0.372346669f},
-std::array<float,2>{0.465545714f, 0.929717183f},
-std::array<float,2>{0.233789191f, 0.23624596f},
-std::array<float,2>{0.883500338f, 0.641731739f},
-std::array<float,2>{0.789733469f, 0.0833085179f},
-std::array<float,2>{0.0569638014f, 0.609143376f},
-std::array<float,2>{0.311320454f, 0.434077352f},
-std::array<float,2>{0.690251529f, 0.864962935f},
-std::array<float,2>{0.506340504f, 0.0469006784f},
-std::array<float,2>{0.430898994f, 0.502580941f},
-std::array<float,2>{0.148817003f, 0.466451764f},
-std::array<float,2>{0.959820926f, 0.807799935f},
-std::array<float,2>{0.865402281f, 0.268249601f},
-std::array<float,2>{0.0973736793f, 0.963618934f},
-std::array<float,2>{0.359920025f, 0.143925965f},
-std::array<float,2>{0.630672336f, 0.742344737f},
-std::array<float,2>{0.729108572f, 0.399096906f},
-std::array<float,2>{0.269752175f, 0.826363385f},
-std::array<float,2>{0.0101085287f, 0.101255476f},
-std::array<float,2>{0.752970755f, 0.585240722f},
-std::array<float,2>{0.91156882f, 0.189616114f},
-std::array<float,2>{0.212914139f, 0.67466718f},
-std::array<float,2>{0.486356467f, 0.341729105f},
-std::array<float,2>{0.620742321f, 0.890403748f},
-std::array<float,2>{0.731865704f, 0.00651954161f},
-std::array<float,2>{0.26725775f, 0.545517564f},
-std::array<float,2>{0.0126641868f, 0.47942242f},
-std::array<float,2>{0.756104171f, 0.760531604f},
-std::array<float,2>{0.907993615f, 0.302582264f},
-std::array<float,2>{0.217612281f, 0.986850142f},
-std::array<float,2>{0.488800079f, 0.163455814f},
-std::array<float,2>{0.62299192f, 0.716210961f},
-std::array<float,2>{0.502983272f, 0.40870735f},
-std::array<float,2>{0.437284768f, 0.846135497f},
-std::array<float,2>{0.155752569f, 0.0667736679f},
-std::array<float,2>{0.954000413f, 0.623215616f},
-std::array<float,2>{0.860097885f, 0.233922809f},
-std::array<float,2>{0.100086011f, 0.627437413f},
-std::array<float,2>{0.366178006f, 0.355081558f},
-std::array<float,2>{0.62710917f, 0.921192348f},
-std::array<float,2>{0.589498222f, 0.126607761f},
-std::array<float,2>{0.463931769f, 0.733915091f},
-std::array<float,2>{0.22889401f, 0.251259357f},
-std::array<float,2>{0.890434265f, 0.949442387f},
-std::array<float,2>{0.796644866f, 0.44278574f},
-std::array<float,2>{0.0602225028f, 0.785175741f},
-std::array<float,2>{0.307261944f, 0.0419761539f},
-std::array<float,2>{0.692471087f, 0.518228889f},
-std::array<float,2>{0.677460313f, 0.326080203f},
-std::array<float,2>{0.318364173f, 0.893848419f},
-std::array<float,2>{0.0914711803f, 0.209681615f},
-std::array<float,2>{0.817556858f, 0.664984167f},
-std::array<float,2>{0.981288373f, 0.12448132f},
-std::array<float,2>{0.187429383f, 0.567030191f},
-std::array<float,2>{0.395024538f, 0.376972526f},
-std::array<float,2>{0.558724165f, 0.833634913f},
-std::array<float,2>{0.643719137f, 0.199631512f},
-std::array<float,2>{0.344800413f, 0.686806262f},
-std::array<float,2>{0.113060132f, 0.329718679f},
-std::array<float,2>{0.854282796f, 0.878789604f},
-std::array<float,2>{0.940463483f, 0.397471786f},
-std::array<float,2>{0.138898224f, 0.819018304f},
-std::array<float,2>{0.413304001f, 0.10277012f},
-std::array<float,2>{0.528757095f, 0.589410603f},
-std::array<float,2>{0.601628959f, 0.277750462f},
-std::array<float,2>{0.471806288f, 0.953814685f},
-std::array<float,2>{0.192300707f, 0.148643211f},
-std::array<float,2>{0.925962389f, 0.739434063f},
-std::array<float,2>{0.771652162f, 0.058616586f},
-std::array<float,2>{0.0203374475f, 0.514549255f},
-std::array<float,2>{0.252775967f, 0.460461408f},
-std::array<float,2>{0.74804616f, 0.801265359f},
-std::array<float,2>{0.537844539f, 0.0919606537f},
-std::array<float,2>{0.389845103f, 0.597186029f},
-std::array<float,2>{0.162718758f, 0.426060081f},
-std::array<float,2>{0.998228431f, 0.872852206f},
-std::array<float,2>{0.832540214f, 0.364315838f},
-std::array<float,2>{0.0733994171f, 0.92559433f},
-std::array<float,2>{0.343228787f, 0.248156995f},
-std::array<float,2>{0.66696012f, 0.651082397f},
-std::array<float,2>{0.714382589f, 0.49555099f},
-std::array<float,2>{0.295266598f, 0.773170292f},
-std::array<float,2>{0.0362125635f, 0.0164975189f},
-std::array<float,2>{0.79909277f, 0.550548255f},
-std::array<float,2>{0.905155241f, 0.187396228f},
-std::array<float,2>{0.234733149f, 0.689041078f},
-std::array<float,2>{0.444958746f, 0.291549116f},
-std::array<float,2>{0.569477677f, 0.984029651f},
-std::array<float,2>{0.658237338f, 0.0967437923f},
-std::array<float,2>{0.328422278f, 0.57857126f},
-std::array<float,2>{0.0656359568f, 0.403577954f},
-std::array<float,2>{0.842769027f, 0.821323454f},
-std::array<float,2>{0.989246428f, 0.339209616f},
-std::array<float,2>{0.170873761f, 0.884174764f},
-std::array<float,2>{0.378100485f, 0.192498192f},
-std::array<float,2>{0.542042553f, 0.676894665f},
-std::array<float,2>{0.570454001f, 0.463231206f},
-std::array<float,2>{0.449745655f, 0.812288761f},
-std::array<float,2>{0.248927876f, 0.0521454699f},
-std::array<float,2>{0.890981495f, 0.504315913f},
-std::array<float,2>{0.805708945f, 0.14806731f},
-std::array<float,2>{0.0428016782f, 0.748444438f},
-std::array<float,2>{0.28698042f, 0.272200197f},
-std::array<float,2>{0.704342484f, 0.967208087f},
-std::array<float,2>{0.521958351f, 0.240785837f},
-std::array<float,2>{0.419401258f, 0.648106158f},
-std::array<float,2>{0.132498577f, 0.369947046f},
-std::array<float,2>{0.94909054f, 0.933966935f},
-std::array<float,2>{0.851059258f, 0.432122767f},
-std::array<float,2>{0.118016295f, 0.86001724f},
-std::array<float,2>{0.359305531f, 0.0811062902f},
-std::array<float,2>{0.651408434f, 0.604121804f},
-std::array<float,2>{0.736381292f, 0.283324897f},
-std::array<float,2>{0.265242785f, 0.969953656f},
-std::array<float,2>{0.0259417053f, 0.179007187f},
-std::array<float,2>{0.774171948f, 0.695514143f},
-std::array<float,2>{0.930245459f, 0.0272255f},
-std::array<float,2>{0.201794654f, 0.559857428f},
-std::array<float,2>{0.478800863f, 0.488318354f},
-std::array<float,2>{0.600268126f, 0.781091332f},
-std::array<float,2>{0.696549177f, 0.170103535f},
-std::array<float,2>{0.297738999f, 0.705276787f},
-std::array<float,2>{0.0502971746f, 0.306223989f},
-std::array<float,2>{0.786370277f, 0.994803667f},
-std::array<float,2>{0.875627279f, 0.475946754f},
-std::array<float,2>{0.22439529f, 0.756531119f},
-std::array<float,2>{0.460834086f, 0.0147394538f},
-std::array<float,2>{0.580722868f, 0.537372291f},
-std::array<float,2>{0.552468479f, 0.350996315f},
-std::array<float,2>{0.403451473f, 0.911188781f},
-std::array<float,2>{0.176221669f, 0.22609672f},
-std::array<float,2>{0.974183202f, 0.636061907f},
-std::array<float,2>{0.828024149f, 0.0707491636f},
-std::array<float,2>{0.0787260458f, 0.611936688f},
-std::array<float,2>{0.323210031f, 0.421784073f},
-std::array<float,2>{0.685555518f, 0.853797257f},
-std::array<float,2>{0.616758943f, 0.0323183835f},
-std::array<float,2>{0.499209374f, 0.525122821f},
-std::array<float,2>{0.209743172f, 0.452114999f},
-std::array<float,2>{0.917226732f, 0.794444621f},
-std::array<float,2>{0.764024734f, 0.26076141f},
-std::array<float,2>{0.0029552069f, 0.93913883f},
-std::array<float,2>{0.27859816f, 0.134459972f},
-std::array<float,2>{0.723864496f, 0.718918204f},
-std::array<float,2>{0.637723207f, 0.386100739f},
-std::array<float,2>{0.368951768f, 0.839007676f},
-std::array<float,2>{0.10523203f, 0.113619991f},
-std::array<float,2>{0.870675862f, 0.575924575f},
-std::array<float,2>{0.965323865f, 0.214018881f},
-std::array<float,2>{0.143946543f, 0.658933938f},
-std::array<float,2>{0.426780909f, 0.318934739f},
-std::array<float,2>{0.508550525f, 0.901216686f},
-std::array<float,2>{0.630343974f, 0.0489161387f},
-std::array<float,2>{0.359746277f, 0.501708746f},
-std::array<float,2>{0.0968158543f, 0.46723038f},
-std::array<float,2>{0.86608386f, 0.806212723f},
-std::array<float,2>{0.959083438f, 0.265647143f},
-std::array<float,2>{0.149316549f, 0.962139368f},
-std::array<float,2>{0.431306541f, 0.141503721f},
-std::array<float,2>{0.506559312f, 0.746069849f},
-std::array<float,2>{0.620482385f, 0.401452154f},
-std::array<float,2>{0.486844063f, 0.82511586f},
-std::array<float,2>{0.213633657f, 0.0987027809f},
-std::array<float,2>{0.911698401f, 0.583326757f},
-std::array<float,2>{0.753448606f, 0.187850669f},
-std::array<float,2>{0.0102572413f, 0.672235072f},
-std::array<float,2>{0.270166606f, 0.343581676f},
-std::array<float,2>{0.728842974f, 0.887978256f},
-std::array<float,2>{0.554764211f, 0.172901124f},
-std::array<float,2>{0.393597811f, 0.700270712f},
-std::array<float,2>{0.182907447f, 0.285746783f},
-std::array<float,2>{0.978006542f, 0.97535485f},
-std::array<float,2>{0.812613547f, 0.486227632f},
-std::array<float,2>{0.089545384f, 0.776765168f},
-std::array<float,2>{0.312817693f, 0.0274282545f},
-std::array<float,2>{0.675448596f, 0.557545006f},
-std::array<float,2>{0.68963635f, 0.374616414f},
-std::array<float,2>{0.310836524f, 0.932302654f},
-std::array<float,2>{0.0572930761f, 0.237657487f},
-std::array<float,2>{0.789482534f, 0.644486666f},
-std::array<float,2>{0.883060038f, 0.0850503892f},
-std::array<float,2>{0.234079212f, 0.606956899f},
-std::array<float,2>{0.465112507f, 0.435563773f},
-std::array<float,2>{0.591922879f, 0.866731286f},
-std::array<float,2>{0.743154347f, 0.218996584f},
-std::array<float,2>{0.25741145f, 0.638761163f},
-std::array<float,2>{0.0161674283f, 0.346804887f},
-std::array<float,2>{0.76926887f, 0.906967103f},
-std::array<float,2>{0.922960281f, 0.417688429f},
-std::array<float,2>{0.190943122f, 0.858381033f},
-std::array<float,2>{0.475243032f, 0.0771551877f},
-std::array<float,2>{0.607456148f, 0.61698693f},
-std::array<float,2>{0.523859918f, 0.31159386f},
-std::array<float,2>{0.40686208f, 0.998890162f},
-std::array<float,2>{0.134386286f, 0.167081907f},
-std::array<float,2>{0.944403648f, 0.710241199f},
-std::array<float,2>{0.85566771f, 0.0101396898f},
-std::array<float,2>{0.116722085f, 0.535147369f},
-std::array<float,2>{0.350657851f, 0.472493261f},
-std::array<float,2>{0.648270547f, 0.750200331f},
-std::array<float,2>{0.562622666f, 0.11176043f},
-std::array<float,2>{0.441340655f, 0.571283877f},
-std::array<float,2>{0.242113933f, 0.386995584f},
-std::array<float,2>{0.90055567f, 0.841390729f},
-std::array<float,2>{0.800999165f, 0.316234857f},
-std::array<float,2>{0.0331631713f, 0.903555751f},
-std::array<float,2>{0.291925788f, 0.215787992f},
-std::array<float,2>{0.717518032f, 0.663913906f},
-std::array<float,2>{0.668650031f, 0.447557747f},
-std::array<float,2>{0.339701474f, 0.792575538f},
-std::array<float,2>{0.0780258626f, 0.0359244645f},
-std::array<float,2>{0.829562664f, 0.529487967f},
-std::array<float,2>{0.99321419f, 0.138181478f},
-std::array<float,2>{0.159782067f, 0.722807348f},
-std::array<float,2>{0.38361901f, 0.262281865f},
-std::array<float,2>{0.531833291f, 0.943693697f},
-std::array<float,2>{0.70852536f, 0.0656758249f},
-std::array<float,2>{0.282529235f, 0.620377004f},
-std::array<float,2>{0.0450012535f, 0.410604417f},
-std::array<float,2>{0.810806513f, 0.850691915f},
-std::array<float,2>{0.896707118f, 0.358106673f},
-std::array<float,2>{0.244517341f, 0.917181194f},
-std::array<float,2>{0.446149915f, 0.228801444f},
-std::array<float,2>{0.577383637f, 0.632550001f},
-std::array<float,2>{0.544094503f, 0.481535584f},
-std::array<float,2>{0.380531222f, 0.76470989f},
-std::array<float,2>{0.166597113f, 0.0034155196f},
-std::array<float,2>{0.984849989f, 0.540111303f},
-std::array<float,2>{0.83943212f, 0.156602979f},
-std::array<float,2>{0.0701630414f, 0.714281917f},
-std::array<float,2>{0.332591474f, 0.298098594f},
-std::array<float,2>{0.663396716f, 0.989524066f},
-std::array<float,2>{0.595608711f, 0.203757554f},
-std::array<float,2>{0.484094828f, 0.669989109f},
-std::array<float,2>{0.196607739f, 0.321656138f},
-std::array<float,2>{0.934472263f, 0.89831996f},
-std::array<float,2>{0.780686975f, 0.382631361f},
-std::array<float,2>{0.0312040821f, 0.830792546f},
-std::array<float,2>{0.25834778f, 0.119080327f},
-std::array<float,2>{0.739899635f, 0.565663517f},
-std::array<float,2>{0.653270364f, 0.254555762f},
-std::array<float,2>{0.352004349f, 0.94673866f},
-std::array<float,2>{0.12368308f, 0.12908946f},
-std::array<float,2>{0.845421135f, 0.728501916f},
-std::array<float,2>{0.95177269f, 0.0447689109f},
-std::array<float,2>{0.126230225f, 0.523184597f},
-std::array<float,2>{0.416936547f, 0.437918246f},
-std::array<float,2>{0.518317997f, 0.784548461f},
-std::array<float,2>{0.683323503f, 0.152536467f},
-std::array<float,2>{0.326883018f, 0.73548758f},
-std::array<float,2>{0.0834139064f, 0.275654912f},
-std::array<float,2>{0.820864022f, 0.958616018f},
-std::array<float,2>{0.97153312f, 0.456669748f},
-std::array<float,2>{0.175375506f, 0.798922658f},
-std::array<float,2>{0.400582582f, 0.0563275963f},
-std::array<float,2>{0.550665498f, 0.511456668f},
-std::array<float,2>{0.585728288f, 0.333781034f},
-std::array<float,2>{0.453879178f, 0.881415009f},
-std::array<float,2>{0.221285969f, 0.195536047f},
-std::array<float,2>{0.879139006f, 0.680888712f},
-std::array<float,2>{0.784047902f, 0.108530298f},
-std::array<float,2>{0.0535206459f, 0.590607762f},
-std::array<float,2>{0.302047253f, 0.391720235f},
-std::array<float,2>{0.699614525f, 0.815410733f},
-std::array<float,2>{0.51441443f, 0.0208968185f},
-std::array<float,2>{0.423571587f, 0.553788364f},
-std::array<float,2>{0.146295905f, 0.499167085f},
-std::array<float,2>{0.961065352f, 0.768428087f},
-std::array<float,2>{0.872591734f, 0.294409454f},
-std::array<float,2>{0.106581315f, 0.976715982f},
-std::array<float,2>{0.371880174f, 0.180416316f},
-std::array<float,2>{0.633332729f, 0.694600105f},
-std::array<float,2>{0.719266832f, 0.42329666f},
-std::array<float,2>{0.274404734f, 0.867446482f},
-std::array<float,2>{0.00473253755f, 0.0892711878f},
-std::array<float,2>{0.75989449f, 0.598694444f},
-std::array<float,2>{0.920013547f, 0.24534972f},
-std::array<float,2>{0.205178186f, 0.655274153f},
-std::array<float,2>{0.492531687f, 0.360620558f},
-std::array<float,2>{0.611223102f, 0.928687274f},
-std::array<float,2>{0.6951828f, 0.0394775309f},
-std::array<float,2>{0.305052072f, 0.516729355f},
-std::array<float,2>{0.0617914759f, 0.444318682f},
-std::array<float,2>{0.793498397f, 0.788691759f},
-std::array<float,2>{0.88758719f, 0.252075076f},
-std::array<float,2>{0.227704689f, 0.952520311f},
-std::array<float,2>{0.461266279f, 0.127573162f},
-std::array<float,2>{0.587374687f, 0.731246889f},
-std::array<float,2>{0.562177777f, 0.375102699f},
-std::array<float,2>{0.398086578f, 0.834640861f},
-std::array<float,2>{0.184290856f, 0.121513508f},
-std::array<float,2>{0.98277694f, 0.568589389f},
-std::array<float,2>{0.819674909f, 0.208857343f},
-std::array<float,2>{0.0920777172f, 0.666970968f},
-std::array<float,2>{0.317507893f, 0.328108072f},
-std::array<float,2>{0.678552568f, 0.892059386f},
-std::array<float,2>{0.623499811f, 0.160453483f},
-std::array<float,2>{0.492069483f, 0.718580365f},
-std::array<float,2>{0.216342866f, 0.303740025f},
-std::array<float,2>{0.908363283f, 0.985711038f},
-std::array<float,2>{0.755776703f, 0.4768354f},
-std::array<float,2>{0.0138380975f, 0.759153008f},
-std::array<float,2>{0.267778903f, 0.00417932868f},
-std::array<float,2>{0.73298341f, 0.543388367f},
-std::array<float,2>{0.625285625f, 0.35306105f},
-std::array<float,2>{0.364896655f, 0.918450117f},
-std::array<float,2>{0.0990363136f, 0.230812848f},
-std::array<float,2>{0.861464679f, 0.626927733f},
-std::array<float,2>{0.956091881f, 0.0698919371f},
-std::array<float,2>{0.153449968f, 0.622958183f},
-std::array<float,2>{0.435456961f, 0.408056498f},
-std::array<float,2>{0.500900149f, 0.845232427f},
-std::array<float,2>{0.664294779f, 0.247370064f},
-std::array<float,2>{0.340028882f, 0.64994967f},
-std::array<float,2>{0.0704799816f, 0.365496337f},
-std::array<float,2>{0.834308684f, 0.921908617f},
-std::array<float,2>{0.997708142f, 0.427806437f},
-std::array<float,2>{0.161711767f, 0.873545825f},
-std::array<float,2>{0.38825658f, 0.091560401f},
-std::array<float,2>{0.535290182f, 0.59384656f},
-std::array<float,2>{0.567032397f, 0.290518224f},
-std::array<float,2>{0.441842288f, 0.981842577f},
-std::array<float,2>{0.236842528f, 0.18472743f},
-std::array<float,2>{0.902611852f, 0.69028157f},
-std::array<float,2>{0.797801197f, 0.0179824904f},
-std::array<float,2>{0.0382884219f, 0.54857409f},
-std::array<float,2>{0.294902176f, 0.492263198f},
-std::array<float,2>{0.711468101f, 0.770298719f},
-std::array<float,2>{0.531003475f, 0.104009539f},
-std::array<float,2>{0.411574334f, 0.587248147f},
-std::array<float,2>{0.138104871f, 0.395405263f},
-std::array<float,2>{0.938697696f, 0.81670326f},
-std::array<float,2>{0.853039682f, 0.331773102f},
-std::array<float,2>{0.110269867f, 0.875936925f},
-std::array<float,2>{0.346110225f, 0.202002957f},
-std::array<float,2>{0.641993165f, 0.685302436f},
-std::array<float,2>{0.749822319f, 0.458676577f},
-std::array<float,2>{0.251836747f, 0.80442965f},
-std::array<float,2>{0.0228383299f, 0.0623887517f},
-std::array<float,2>{0.769534647f, 0.512310684f},
-std::array<float,2>{0.929245114f, 0.151899621f},
-std::array<float,2>{0.193374366f, 0.74053055f},
-std::array<float,2>{0.470486432f, 0.280226886f},
-std::array<float,2>{0.605257511f, 0.955366731f},
-std::array<float,2>{0.650206923f, 0.0788649917f},
-std::array<float,2>{0.357112706f, 0.602998912f},
-std::array<float,2>{0.11920853f, 0.430177122f},
-std::array<float,2>{0.848376751f, 0.862482071f},
-std::array<float,2>{0.945909858f, 0.367530584f},
-std::array<float,2>{0.129140079f, 0.937001944f},
-std::array<float,2>{0.421495825f, 0.238449231f},
-std::array<float,2>{0.519789577f, 0.644599259f},
-std::array<float,2>{0.598390281f, 0.49037829f},
-std::array<float,2>{0.477881968f, 0.779286087f},
-std::array<float,2>{0.200162411f, 0.0240419414f},
-std::array<float,2>{0.932571292f, 0.560856938f},
-std::array<float,2>{0.777102292f, 0.177029267f},
-std::array<float,2>{0.0236207899f, 0.69864279f},
-std::array<float,2>{0.261802018f, 0.282309353f},
-std::array<float,2>{0.73599273f, 0.972610712f},
-std::array<float,2>{0.539739311f, 0.194117978f},
-std::array<float,2>{0.376139998f, 0.679234147f},
-std::array<float,2>{0.168162435f, 0.336967289f},
-std::array<float,2>{0.990818143f, 0.885484636f},
-std::array<float,2>{0.839934349f, 0.404593587f},
-std::array<float,2>{0.0634024367f, 0.822478652f},
-std::array<float,2>{0.331828117f, 0.0950563326f},
-std::array<float,2>{0.657878399f, 0.581977129f},
-std::array<float,2>{0.705383778f, 0.271456182f},
-std::array<float,2>{0.287341356f, 0.965797603f},
-std::array<float,2>{0.0398396961f, 0.145314291f},
-std::array<float,2>{0.808255851f, 0.746965051f},
-std::array<float,2>{0.894244373f, 0.0532240979f},
-std::array<float,2>{0.247388542f, 0.506767511f},
-std::array<float,2>{0.451320887f, 0.462117046f},
-std::array<float,2>{0.573018014f, 0.810040772f},
-std::array<float,2>{0.725818694f, 0.135521919f},
-std::array<float,2>{0.279683828f, 0.722271562f},
-std::array<float,2>{0.000532015343f, 0.259678781f},
-std::array<float,2>{0.762235641f, 0.939630568f},
-std::array<float,2>{0.914448082f, 0.450194895f},
-std::array<float,2>{0.208463088f, 0.795791388f},
-std::array<float,2>{0.496301591f, 0.0335936211f},
-std::array<float,2>{0.614976406f, 0.525475562f},
-std::array<float,2>{0.511642098f, 0.316492498f},
-std::array<float,2>{0.428666621f, 0.89961201f},
-std::array<float,2>{0.141112477f, 0.210974589f},
-std::array<float,2>{0.968496442f, 0.656341016f},
-std::array<float,2>{0.868107736f, 0.116018817f},
-std::array<float,2>{0.101602145f, 0.57661581f},
-std::array<float,2>{0.370366931f, 0.384541959f},
-std::array<float,2>{0.639803648f, 0.836657166f},
-std::array<float,2>{0.57932049f, 0.0126339262f},
-std::array<float,2>{0.458952606f, 0.53632313f},
-std::array<float,2>{0.225627854f, 0.473103851f},
-std::array<float,2>{0.878404796f, 0.754051745f},
-std::array<float,2>{0.787752509f, 0.30665496f},
-std::array<float,2>{0.0483861901f, 0.992702723f},
-std::array<float,2>{0.299822181f, 0.169276029f},
-std::array<float,2>{0.699049294f, 0.704480588f},
-std::array<float,2>{0.684927702f, 0.418708473f},
-std::array<float,2>{0.321477056f, 0.852425814f},
-std::array<float,2>{0.0814790875f, 0.0735435262f},
-std::array<float,2>{0.824711978f, 0.610823631f},
-std::array<float,2>{0.97468251f, 0.223377571f},
-std::array<float,2>{0.177934602f, 0.633783638f},
-std::array<float,2>{0.405378461f, 0.348004788f},
-std::array<float,2>{0.552839875f, 0.913393319f},
-std::array<float,2>{0.672219634f, 0.0301510543f},
-std::array<float,2>{0.315972626f, 0.555370092f},
-std::array<float,2>{0.0862901509f, 0.486712307f},
-std::array<float,2>{0.814837098f, 0.775259256f},
-std::array<float,2>{0.979694605f, 0.287757486f},
-std::array<float,2>{0.180998728f, 0.974324465f},
-std::array<float,2>{0.392531633f, 0.174320921f},
-std::array<float,2>{0.556761742f, 0.701743484f},
-std::array<float,2>{0.59116745f, 0.434482187f},
-std::array<float,2>{0.468679577f, 0.864366472f},
-std::array<float,2>{0.231076151f, 0.0837146789f},
-std::array<float,2>{0.885901034f, 0.608819783f},
-std::array<float,2>{0.792693377f, 0.235640541f},
-std::array<float,2>{0.0564350933f, 0.642354727f},
-std::array<float,2>{0.310260683f, 0.373045444f},
-std::array<float,2>{0.689018071f, 0.930551827f},
-std::array<float,2>{0.504281044f, 0.14406155f},
-std::array<float,2>{0.433194965f, 0.742872298f},
-std::array<float,2>{0.151046515f, 0.267864406f},
-std::array<float,2>{0.958058655f, 0.963321447f},
-std::array<float,2>{0.86350739f, 0.465918899f},
-std::array<float,2>{0.0945066586f, 0.808504283f},
-std::array<float,2>{0.361822248f, 0.0477240831f},
-std::array<float,2>{0.631248534f, 0.502362549f},
-std::array<float,2>{0.726734877f, 0.340869337f},
-std::array<float,2>{0.271623731f, 0.889864385f},
-std::array<float,2>{0.00953321066f, 0.19014141f},
-std::array<float,2>{0.75119406f, 0.674166441f},
-std::array<float,2>{0.912736833f, 0.101001158f},
-std::array<float,2>{0.21258001f, 0.585454226f},
-std::array<float,2>{0.48615554f, 0.398887753f},
-std::array<float,2>{0.617561221f, 0.826815009f},
-std::array<float,2>{0.715836287f, 0.217813313f},
-std::array<float,2>{0.290161073f, 0.661982119f},
-std::array<float,2>{0.0342316665f, 0.313190013f},
-std::array<float,2>{0.803952873f, 0.905134499f},
-std::array<float,2>{0.898799062f, 0.389040828f},
-std::array<float,2>{0.23847644f, 0.843323469f},
-std::array<float,2>{0.437982738f, 0.10981226f},
-std::array<float,2>{0.566295683f, 0.573557019f},
-std::array<float,2>{0.534808695f, 0.264741898f},
-std::array<float,2>{0.384906679f, 0.943068564f},
-std::array<float,2>{0.156437308f, 0.140173882f},
-std::array<float,2>{0.995119035f, 0.725313842f},
-std::array<float,2>{0.831055999f, 0.0376043916f},
-std::array<float,2>{0.0757637471f, 0.527923584f},
-std::array<float,2>{0.337882161f, 0.447087705f},
-std::array<float,2>{0.671241462f, 0.790114462f},
-std::array<float,2>{0.607255101f, 0.0746514648f},
-std::array<float,2>{0.472960174f, 0.615214288f},
-std::array<float,2>{0.188926533f, 0.415410995f},
-std::array<float,2>{0.925478101f, 0.85632503f},
-std::array<float,2>{0.766487062f, 0.344939709f},
-std::array<float,2>{0.0185862537f, 0.909568369f},
-std::array<float,2>{0.255588233f, 0.221149266f},
-std::array<float,2>{0.745477974f, 0.637382209f},
-std::array<float,2>{0.646433651f, 0.469054043f},
-std::array<float,2>{0.348662585f, 0.752893448f},
-std::array<float,2>{0.113544486f, 0.00829853583f},
-std::array<float,2>{0.8582865f, 0.531933069f},
-std::array<float,2>{0.943020344f, 0.164987132f},
-std::array<float,2>{0.135925904f, 0.707265496f},
-std::array<float,2>{0.408539712f, 0.308875114f},
-std::array<float,2>{0.525616229f, 0.996223569f},
-std::array<float,2>{0.741308272f, 0.120720819f},
-std::array<float,2>{0.261503041f, 0.563005745f},
-std::array<float,2>{0.0275793206f, 0.380226523f},
-std::array<float,2>{0.778395832f, 0.829361498f},
-std::array<float,2>{0.935776651f, 0.323695123f},
-std::array<float,2>{0.197982103f, 0.895728052f},
-std::array<float,2>{0.482303977f, 0.205471739f},
-std::array<float,2>{0.596585929f, 0.669683635f},
-std::array<float,2>{0.516588032f, 0.440987527f},
-std::array<float,2>{0.414929301f, 0.782221675f},
-std::array<float,2>{0.127671108f, 0.0465503298f},
-std::array<float,2>{0.949712932f, 0.521060109f},
-std::array<float,2>{0.846778989f, 0.132700562f},
-std::array<float,2>{0.121328428f, 0.729731619f},
-std::array<float,2>{0.354248852f, 0.256528199f},
-std::array<float,2>{0.655100107f, 0.948998451f},
-std::array<float,2>{0.575404584f, 0.226826474f},
-std::array<float,2>{0.448436677f, 0.629527748f},
-std::array<float,2>{0.242246211f, 0.356554717f},
-std::array<float,2>{0.895005047f, 0.914718986f},
-std::array<float,2>{0.809452534f, 0.413724482f},
-std::array<float,2>{0.0435576737f, 0.848129451f},
-std::array<float,2>{0.28378135f, 0.0629371703f},
-std::array<float,2>{0.710442245f, 0.617738783f},
-std::array<float,2>{0.661562085f, 0.300688922f},
-std::array<float,2>{0.334568709f, 0.990600586f},
-std::array<float,2>{0.066440843f, 0.159256428f},
-std::array<float,2>{0.83628577f, 0.711369693f},
-std::array<float,2>{0.987610817f, 0.00154990354f},
-std::array<float,2>{0.16408655f, 0.542430043f},
-std::array<float,2>{0.382784992f, 0.482628137f},
-std::array<float,2>{0.544922113f, 0.761919022f},
-std::array<float,2>{0.634977341f, 0.181856617f},
-std::array<float,2>{0.373606026f, 0.692539692f},
-std::array<float,2>{0.107966766f, 0.295785308f},
-std::array<float,2>{0.874368072f, 0.97878778f},
-std::array<float,2>{0.963673055f, 0.49734202f},
-std::array<float,2>{0.147864074f, 0.767571688f},
-std::array<float,2>{0.425274968f, 0.0234126151f},
-std::array<float,2>{0.512167454f, 0.552419841f},
-std::array<float,2>{0.612686872f, 0.362402201f},
-std::array<float,2>{0.494731039f, 0.925947964f},
-std::array<float,2>{0.204542324f, 0.2439432f},
-std::array<float,2>{0.919519484f, 0.653961301f},
-std::array<float,2>{0.759148538f, 0.0865835026f},
-std::array<float,2>{0.00770941237f, 0.599954307f},
-std::array<float,2>{0.275990576f, 0.425698519f},
-std::array<float,2>{0.720811129f, 0.869756281f},
-std::array<float,2>{0.54871881f, 0.0578899533f},
-std::array<float,2>{0.399198085f, 0.509723127f},
-std::array<float,2>{0.17262128f, 0.454149634f},
-std::array<float,2>{0.970448554f, 0.797573149f},
-std::array<float,2>{0.824075282f, 0.273936093f},
-std::array<float,2>{0.0846166834f, 0.959254444f},
-std::array<float,2>{0.324500382f, 0.155214772f},
-std::array<float,2>{0.680837989f, 0.737934053f},
-std::array<float,2>{0.701721668f, 0.392966539f},
-std::array<float,2>{0.303320825f, 0.814300656f},
-std::array<float,2>{0.0515935533f, 0.106572382f},
-std::array<float,2>{0.782654107f, 0.593227804f},
-std::array<float,2>{0.880949795f, 0.197307155f},
-std::array<float,2>{0.22029458f, 0.683191955f},
-std::array<float,2>{0.455725342f, 0.334559739f},
-std::array<float,2>{0.582034886f, 0.879672527f},
-std::array<float,2>{0.712333441f, 0.0170784164f},
-std::array<float,2>{0.293496788f, 0.549090624f},
-std::array<float,2>{0.0377598889f, 0.494848102f},
-std::array<float,2>{0.798137605f, 0.771916509f},
-std::array<float,2>{0.903706729f, 0.292163759f},
-std::array<float,2>{0.237973005f, 0.982939005f},
-std::array<float,2>{0.442990392f, 0.185722753f},
-std::array<float,2>{0.567662656f, 0.68782872f},
-std::array<float,2>{0.536620617f, 0.426816791f},
-std::array<float,2>{0.386730373f, 0.871592045f},
-std::array<float,2>{0.161045268f, 0.0931153521f},
-std::array<float,2>{0.996351182f, 0.595718145f},
-std::array<float,2>{0.83569628f, 0.249863133f},
-std::array<float,2>{0.0717773288f, 0.651611865f},
-std::array<float,2>{0.341066927f, 0.364174783f},
-std::array<float,2>{0.665824592f, 0.924111366f},
-std::array<float,2>{0.604286313f, 0.149526358f},
-std::array<float,2>{0.469368428f, 0.739151716f},
-std::array<float,2>{0.194423869f, 0.279295564f},
-std::array<float,2>{0.927917957f, 0.954288006f},
-std::array<float,2>{0.771023273f, 0.459951699f},
-std::array<float,2>{0.0220342278f, 0.802089632f},
-std::array<float,2>{0.250178725f, 0.0601293109f},
-std::array<float,2>{0.748710811f, 0.515066803f},
-std::array<float,2>{0.641293287f, 0.32860899f},
-std::array<float,2>{0.346889973f, 0.87768805f},
-std::array<float,2>{0.110549837f, 0.200767651f},
-std::array<float,2>{0.852103293f, 0.685896158f},
-std::array<float,2>{0.937539577f, 0.101802975f},
-std::array<float,2>{0.137276456f, 0.588506699f},
-std::array<float,2>{0.410712034f, 0.396844894f},
-std::array<float,2>{0.529795706f, 0.819602013f},
-std::array<float,2>{0.67884779f, 0.210399583f},
-std::array<float,2>{0.316793203f, 0.665269911f},
-std::array<float,2>{0.0928472877f, 0.324964494f},
-std::array<float,2>{0.818713486f, 0.892621756f},
-std::array<float,2>{0.983914793f, 0.378740937f},
-std::array<float,2>{0.185117379f, 0.832243979f},
-std::array<float,2>{0.397065729f, 0.123130687f},
-std::array<float,2>{0.561186373f, 0.568261147f},
-std::array<float,2>{0.586853802f, 0.250504792f},
-std::array<float,2>{0.462040067f, 0.95073086f},
-std::array<float,2>{0.22669071f, 0.125851825f},
-std::array<float,2>{0.888221085f, 0.733375549f},
-std::array<float,2>{0.794233441f, 0.0424384885f},
-std::array<float,2>{0.0606462769f, 0.519026637f},
-std::array<float,2>{0.306192189f, 0.441731721f},
-std::array<float,2>{0.693885922f, 0.786835968f},
-std::array<float,2>{0.501805127f, 0.0676745027f},
-std::array<float,2>{0.434023917f, 0.624906182f},
-std::array<float,2>{0.153029248f, 0.409905165f},
-std::array<float,2>{0.955534101f, 0.846706629f},
-std::array<float,2>{0.862967491f, 0.354346305f},
-std::array<float,2>{0.0979580507f, 0.920403481f},
-std::array<float,2>{0.363739133f, 0.23336108f},
-std::array<float,2>{0.626174569f, 0.628487468f},
-std::array<float,2>{0.73352474f, 0.480178207f},
-std::array<float,2>{0.269215584f, 0.761615574f},
-std::array<float,2>{0.0146787679f, 0.00700190431f},
-std::array<float,2>{0.754390895f, 0.546390116f},
-std::array<float,2>{0.910050035f, 0.162880555f},
-std::array<float,2>{0.214918971f, 0.715265989f},
-std::array<float,2>{0.490956783f, 0.301361829f},
-std::array<float,2>{0.624607563f, 0.987375915f},
-std::array<float,2>{0.639457285f, 0.114988901f},
-std::array<float,2>{0.369333059f, 0.57423228f},
-std::array<float,2>{0.102976903f, 0.38496986f},
-std::array<float,2>{0.868327379f, 0.838859618f},
-std::array<float,2>{0.96698308f, 0.319530725f},
-std::array<float,2>{0.142489761f, 0.902300298f},
-std::array<float,2>{0.429193944f, 0.213286206f},
-std::array<float,2>{0.509922266f, 0.65941596f},
-std::array<float,2>{0.613935232f, 0.45243901f},
-std::array<float,2>{0.497891933f, 0.793399096f},
-std::array<float,2>{0.207890794f, 0.0320135057f},
-std::array<float,2>{0.915992737f, 0.524057269f},
-std::array<float,2>{0.763567567f, 0.133085504f},
-std::array<float,2>{0.00103199156f, 0.720260024f},
-std::array<float,2>{0.280510902f, 0.260081619f},
-std::array<float,2>{0.724951148f, 0.938402414f},
-std::array<float,2>{0.554225028f, 0.224869654f},
-std::array<float,2>{0.40442729f, 0.634846807f},
-std::array<float,2>{0.179377675f, 0.34971121f},
-std::array<float,2>{0.976071775f, 0.910313904f},
-std::array<float,2>{0.826014996f, 0.420663387f},
-std::array<float,2>{0.0805665925f, 0.854642153f},
-std::array<float,2>{0.320438087f, 0.0713348836f},
-std::array<float,2>{0.68392849f, 0.612440228f},
-std::array<float,2>{0.697762728f, 0.304934978f},
-std::array<float,2>{0.299016148f, 0.996023357f},
-std::array<float,2>{0.047710225f, 0.171713248f},
-std::array<float,2>{0.788670301f, 0.706100941f},
-std::array<float,2>{0.877830684f, 0.0141514903f},
-std::array<float,2>{0.225521341f, 0.538610399f},
-std::array<float,2>{0.457121372f, 0.475084394f},
-std::array<float,2>{0.578485847f, 0.757775128f},
-std::array<float,2>{0.735058188f, 0.17824173f},
-std::array<float,2>{0.263273329f, 0.697238743f},
-std::array<float,2>{0.0252265222f, 0.284689307f},
-std::array<float,2>{0.776072979f, 0.969017029f},
-std::array<float,2>{0.933585227f, 0.489490122f},
-std::array<float,2>{0.200758934f, 0.779791236f},
-std::array<float,2>{0.477049381f, 0.0255824681f},
-std::array<float,2>{0.599209845f, 0.559413254f},
-std::array<float,2>{0.521301806f, 0.370239377f},
-std::array<float,2>{0.420684963f, 0.935053647f},
-std::array<float,2>{0.130616188f, 0.24126786f},
-std::array<float,2>{0.947223246f, 0.647193253f},
-std::array<float,2>{0.849242508f, 0.080739066f},
-std::array<float,2>{0.120363161f, 0.604581833f},
-std::array<float,2>{0.355921179f, 0.432937503f},
-std::array<float,2>{0.648959935f, 0.860509813f},
-std::array<float,2>{0.573335648f, 0.0507916547f},
-std::array<float,2>{0.452985138f, 0.505750537f},
-std::array<float,2>{0.246963173f, 0.464837849f},
-std::array<float,2>{0.89323169f, 0.811249971f},
-std::array<float,2>{0.806723297f, 0.2731646f},
-std::array<float,2>{0.0402277075f, 0.96823889f},
-std::array<float,2>{0.288921744f, 0.146707237f},
-std::array<float,2>{0.707011402f, 0.749399662f},
-std::array<float,2>{0.65703094f, 0.402854264f},
-std::array<float,2>{0.33098799f, 0.820518553f},
-std::array<float,2>{0.0638185069f, 0.0963857844f},
-std::array<float,2>{0.841314912f, 0.579869211f},
-std::array<float,2>{0.992131472f, 0.191449195f},
-std::array<float,2>{0.169011399f, 0.675928593f},
-std::array<float,2>{0.375297457f, 0.338655233f},
-std::array<float,2>{0.540098608f, 0.882816017f},
-std::array<float,2>{0.670417428f, 0.0361750349f},
-std::array<float,2>{0.336080194f, 0.530709088f},
-std::array<float,2>{0.0745992213f, 0.448653489f},
-std::array<float,2>{0.830457985f, 0.791625619f},
-std::array<float,2>{0.994646251f, 0.263366818f},
-std::array<float,2>{0.157678694f, 0.945258856f},
-std::array<float,2>{0.386514783f, 0.136756182f},
-std::array<float,2>{0.533881366f, 0.723646164f},
-std::array<float,2>{0.564534426f, 0.388333261f},
-std::array<float,2>{0.438876599f, 0.840415776f},
-std::array<float,2>{0.240047589f, 0.112507373f},
-std::array<float,2>{0.900188982f, 0.571412444f},
-std::array<float,2>{0.802990317f, 0.216216579f},
-std::array<float,2>{0.0333505422f, 0.662473321f},
-std::array<float,2>{0.289368838f, 0.315021127f},
-std::array<float,2>{0.715112865f, 0.902494431f},
-std::array<float,2>{0.526864469f, 0.166550249f},
-std::array<float,2>{0.409404844f, 0.709549606f},
-std::array<float,2>{0.135183781f, 0.311468154f},
-std::array<float,2>{0.941659689f, 0.999478519f},
-std::array<float,2>{0.858443916f, 0.470938385f},
-std::array<float,2>{0.114982814f, 0.751317978f},
-std::array<float,2>{0.348143727f, 0.0115427822f},
-std::array<float,2>{0.644860685f, 0.533227801f},
-std::array<float,2>{0.745101392f, 0.345829785f},
-std::array<float,2>{0.254196107f, 0.907294154f},
-std::array<float,2>{0.018439997f, 0.220328555f},
-std::array<float,2>{0.7673316f, 0.639670968f},
-std::array<float,2>{0.924506605f, 0.0765294358f},
-std::array<float,2>{0.187855676f, 0.615882099f},
-std::array<float,2>{0.47420156f, 0.416785419f},
-std::array<float,2>{0.605762601f, 0.858854473f},
-std::array<float,2>{0.688089132f, 0.236577332f},
-std::array<float,2>{0.309102118f, 0.643406212f},
-std::array<float,2>{0.0549169742f, 0.373495191f},
-std::array<float,2>{0.791049361f, 0.932944715f},
-std::array<float,2>{0.884997308f, 0.436789572f},
-std::array<float,2>{0.231493816f, 0.86533165f},
-std::array<float,2>{0.467687011f, 0.084263742f},
-std::array<float,2>{0.590150893f, 0.605639219f},
-std::array<float,2>{0.557765961f, 0.286471277f},
-std::array<float,2>{0.391093582f, 0.976066887f},
-std::array<float,2>{0.179907128f, 0.172503367f},
-std::array<float,2>{0.979479432f, 0.699489713f},
-std::array<float,2>{0.815448821f, 0.028538119f},
-std::array<float,2>{0.0873526037f, 0.558461189f},
-std::array<float,2>{0.314781994f, 0.484390616f},
-std::array<float,2>{0.673209727f, 0.776052296f},
-std::array<float,2>{0.619112432f, 0.0979378298f},
-std::array<float,2>{0.485189825f, 0.582850099f},
-std::array<float,2>{0.210942581f, 0.400837809f},
-std::array<float,2>{0.913199425f, 0.825347185f},
-std::array<float,2>{0.750177562f, 0.34261626f},
-std::array<float,2>{0.00833596755f, 0.887645006f},
-std::array<float,2>{0.273290455f, 0.189259797f},
-std::array<float,2>{0.727593124f, 0.673437953f},
-std::array<float,2>{0.632168829f, 0.468674332f},
-std::array<float,2>{0.362584651f, 0.804736733f},
-std::array<float,2>{0.0950782001f, 0.0504850373f},
-std::array<float,2>{0.864391029f, 0.500692904f},
-std::array<float,2>{0.957094312f, 0.142359748f},
-std::array<float,2>{0.151751906f, 0.744484007f},
-std::array<float,2>{0.4322007f, 0.267490149f},
-std::array<float,2>{0.505078793f, 0.961237371f},
-std::array<float,2>{0.722559988f, 0.0887321904f},
-std::array<float,2>{0.276442111f, 0.59793824f},
-std::array<float,2>{0.0065371599f, 0.422335356f},
-std::array<float,2>{0.758404672f, 0.868999302f},
-std::array<float,2>{0.918407083f, 0.359799117f},
-std::array<float,2>{0.203894615f, 0.928949296f},
-std::array<float,2>{0.49605161f, 0.244862214f},
-std::array<float,2>{0.611342072f, 0.655206323f},
-std::array<float,2>{0.512736917f, 0.498749107f},
-std::array<float,2>{0.424405754f, 0.76892364f},
-std::array<float,2>{0.146601692f, 0.0203892924f},
-std::array<float,2>{0.96417892f, 0.552967787f},
-std::array<float,2>{0.873092115f, 0.180990368f},
-std::array<float,2>{0.108889036f, 0.693725109f},
-std::array<float,2>{0.374024868f, 0.293416202f},
-std::array<float,2>{0.63650316f, 0.977991641f},
-std::array<float,2>{0.583299696f, 0.19651328f},
-std::array<float,2>{0.456156582f, 0.679804683f},
-std::array<float,2>{0.219226226f, 0.332935095f},
-std::array<float,2>{0.882600665f, 0.882785499f},
-std::array<float,2>{0.782214344f, 0.390753329f},
-std::array<float,2>{0.0521638468f, 0.816075742f},
-std::array<float,2>{0.304120392f, 0.107876107f},
-std::array<float,2>{0.703085899f, 0.591106117f},
-std::array<float,2>{0.680345893f, 0.277332157f},
-std::array<float,2>{0.325491667f, 0.957566917f},
-std::array<float,2>{0.0858903825f, 0.154187456f},
-std::array<float,2>{0.822588563f, 0.734976411f},
-std::array<float,2>{0.968802333f, 0.0556200482f},
-std::array<float,2>{0.173478231f, 0.509917855f},
-std::array<float,2>{0.399698704f, 0.455457538f},
-std::array<float,2>{0.547291815f, 0.800615728f},
-std::array<float,2>{0.656174898f, 0.130317956f},
-std::array<float,2>{0.354521245f, 0.727282345f},
-std::array<float,2>{0.122108117f, 0.255005687f},
-std::array<float,2>{0.845917284f, 0.946266532f},
-std::array<float,2>{0.951164424f, 0.438491523f},
-std::array<float,2>{0.128245458f, 0.78409344f},
-std::array<float,2>{0.4158898f, 0.0432489552f},
-std::array<float,2>{0.517078578f, 0.522072852f},
-std::array<float,2>{0.597137511f, 0.32063809f},
-std::array<float,2>{0.481335878f, 0.896565676f},
-std::array<float,2>{0.198810637f, 0.204330683f},
-std::array<float,2>{0.937175393f, 0.671073318f},
-std::array<float,2>{0.778143048f, 0.117299758f},
-std::array<float,2>{0.0285231806f, 0.565202594f},
-std::array<float,2>{0.260453641f, 0.381403536f},
-std::array<float,2>{0.741032422f, 0.831636548f},
-std::array<float,2>{0.546046019f, 0.00278434018f},
-std::array<float,2>{0.380879819f, 0.53927809f},
-std::array<float,2>{0.165896446f, 0.48070392f},
-std::array<float,2>{0.986763537f, 0.764646053f},
-std::array<float,2>{0.837597907f, 0.297770262f},
-std::array<float,2>{0.0683346838f, 0.988581896f},
-std::array<float,2>{0.33581838f, 0.157691628f},
-std::array<float,2>{0.6602965f, 0.713117957f},
-std::array<float,2>{0.708984911f, 0.411207289f},
-std::array<float,2>{0.284527689f, 0.849806428f},
-std::array<float,2>{0.044512324f, 0.065374136f},
-std::array<float,2>{0.809836566f, 0.619209647f},
-std::array<float,2>{0.89553988f, 0.229695618f},
-std::array<float,2>{0.243494064f, 0.631043851f},
-std::array<float,2>{0.447740614f, 0.359049022f},
-std::array<float,2>{0.574849129f, 0.916564941f},
-std::array<float,2>{0.746453285f, 0.0609222427f},
-std::array<float,2>{0.253586054f, 0.5128268f},
-std::array<float,2>{0.0207849909f, 0.45745185f},
-std::array<float,2>{0.772482157f, 0.803177118f},
-std::array<float,2>{0.926819623f, 0.28089869f},
-std::array<float,2>{0.193283021f, 0.956469774f},
-std::array<float,2>{0.470807135f, 0.150982618f},
-std::array<float,2>{0.603390276f, 0.741273761f},
-std::array<float,2>{0.528249979f, 0.395511031f},
-std::array<float,2>{0.412227482f, 0.817826629f},
-std::array<float,2>{0.139788911f, 0.104570575f},
-std::array<float,2>{0.940165579f, 0.586072445f},
-std::array<float,2>{0.854791999f, 0.20237872f},
-std::array<float,2>{0.111500718f, 0.684282541f},
-std::array<float,2>{0.344546258f, 0.330785424f},
-std::array<float,2>{0.643276155f, 0.875990748f},
-std::array<float,2>{0.56932956f, 0.183786988f},
-std::array<float,2>{0.444028795f, 0.690796912f},
-std::array<float,2>{0.236252889f, 0.289452821f},
-std::array<float,2>{0.90568912f, 0.980953693f},
-std::array<float,2>{0.800288916f, 0.493971646f},
-std::array<float,2>{0.0356614888f, 0.771242738f},
-std::array<float,2>{0.296368897f, 0.0192285329f},
-std::array<float,2>{0.713242054f, 0.54718709f},
-std::array<float,2>{0.667236924f, 0.366318733f},
-std::array<float,2>{0.342012107f, 0.92371881f},
-std::array<float,2>{0.0723224208f, 0.24630329f},
-std::array<float,2>{0.833517551f, 0.649070978f},
-std::array<float,2>{0.999867499f, 0.0904178247f},
-std::array<float,2>{0.163574576f, 0.595255494f},
-std::array<float,2>{0.389375538f, 0.429003984f},
-std::array<float,2>{0.538657129f, 0.874615252f},
-std::array<float,2>{0.628008544f, 0.231514663f},
-std::array<float,2>{0.366959751f, 0.62550962f},
-std::array<float,2>{0.100838557f, 0.351664305f},
-std::array<float,2>{0.860809386f, 0.919413626f},
-std::array<float,2>{0.954389513f, 0.407194018f},
-std::array<float,2>{0.155078202f, 0.843903065f},
-std::array<float,2>{0.435665429f, 0.0683961213f},
-std::array<float,2>{0.50290978f, 0.62187928f},
-std::array<float,2>{0.621911824f, 0.30300349f},
-std::array<float,2>{0.489701301f, 0.98447448f},
-std::array<float,2>{0.218351617f, 0.161346972f},
-std::array<float,2>{0.906659424f, 0.717041433f},
-std::array<float,2>{0.757675827f, 0.00507238135f},
-std::array<float,2>{0.0130589632f, 0.544714928f},
-std::array<float,2>{0.266269147f, 0.478093445f},
-std::array<float,2>{0.7307778f, 0.758671701f},
-std::array<float,2>{0.560207069f, 0.1228403f},
-std::array<float,2>{0.395963401f, 0.569957435f},
-std::array<float,2>{0.186101079f, 0.376537889f},
-std::array<float,2>{0.982135773f, 0.835819662f},
-std::array<float,2>{0.817332327f, 0.327083319f},
-std::array<float,2>{0.0901198536f, 0.891535342f},
-std::array<float,2>{0.319351345f, 0.207578138f},
-std::array<float,2>{0.675924182f, 0.667236865f},
-std::array<float,2>{0.691781878f, 0.445055485f},
-std::array<float,2>{0.308322519f, 0.787694931f},
-std::array<float,2>{0.0593352988f, 0.0401692651f},
-std::array<float,2>{0.795479298f, 0.51649797f},
-std::array<float,2>{0.889062047f, 0.128676459f},
-std::array<float,2>{0.23031123f, 0.73176676f},
-std::array<float,2>{0.463337958f, 0.25373286f},
-std::array<float,2>{0.587992489f, 0.952021897f},
-std::array<float,2>{0.687103212f, 0.0725290924f},
-std::array<float,2>{0.323989153f, 0.609490514f},
-std::array<float,2>{0.0796000138f, 0.419419855f},
-std::array<float,2>{0.826812148f, 0.852564394f},
-std::array<float,2>{0.973363042f, 0.348731786f},
-std::array<float,2>{0.176874921f, 0.912457883f},
-std::array<float,2>{0.403176188f, 0.224429622f},
-std::array<float,2>{0.550791979f, 0.633991659f},
-std::array<float,2>{0.581593215f, 0.47422576f},
-std::array<float,2>{0.459081739f, 0.755098045f},
-std::array<float,2>{0.222867042f, 0.0131667517f},
-std::array<float,2>{0.876111448f, 0.535867035f},
-std::array<float,2>{0.785699844f, 0.168034926f},
-std::array<float,2>{0.0493129157f, 0.704036236f},
-std::array<float,2>{0.298415244f, 0.307883888f},
-std::array<float,2>{0.695630789f, 0.993407488f},
-std::array<float,2>{0.509446621f, 0.212148264f},
-std::array<float,2>{0.426391959f, 0.657254815f},
-std::array<float,2>{0.142914146f, 0.317850411f},
-std::array<float,2>{0.966667116f, 0.898463428f},
-std::array<float,2>{0.86923629f, 0.383691519f},
-std::array<float,2>{0.104094125f, 0.837594748f},
-std::array<float,2>{0.367963701f, 0.116985597f},
-std::array<float,2>{0.637403727f, 0.577947795f},
-std::array<float,2>{0.723605633f, 0.258549243f},
-std::array<float,2>{0.277893901f, 0.941329896f},
-std::array<float,2>{0.00197889842f, 0.136493534f},
-std::array<float,2>{0.764777601f, 0.721409082f},
-std::array<float,2>{0.916676402f, 0.0348684043f},
-std::array<float,2>{0.209983706f, 0.526619256f},
-std::array<float,2>{0.4981125f, 0.450505942f},
-std::array<float,2>{0.616175294f, 0.796307147f},
-std::array<float,2>{0.703710079f, 0.145924062f},
-std::array<float,2>{0.285347283f, 0.747597039f},
-std::array<float,2>{0.0412283987f, 0.270060062f},
-std::array<float,2>{0.804986119f, 0.965927184f},
-std::array<float,2>{0.891735256f, 0.461588413f},
-std::array<float,2>{0.249175429f, 0.809172273f},
-std::array<float,2>{0.450830966f, 0.0545847192f},
-std::array<float,2>{0.571455061f, 0.507040799f},
-std::array<float,2>{0.541082978f, 0.336457342f},
-std::array<float,2>{0.377292067f, 0.885803461f},
-std::array<float,2>{0.171578437f, 0.194808751f},
-std::array<float,2>{0.98976326f, 0.677988172f},
-std::array<float,2>{0.843004346f, 0.0945904106f},
-std::array<float,2>{0.0646365806f, 0.580835819f},
-std::array<float,2>{0.329474896f, 0.405965447f},
-std::array<float,2>{0.659499168f, 0.82378459f},
-std::array<float,2>{0.601558328f, 0.024948325f},
-std::array<float,2>{0.480049014f, 0.561725318f},
-std::array<float,2>{0.202160165f, 0.491340667f},
-std::array<float,2>{0.931338131f, 0.778244138f},
-std::array<float,2>{0.774539649f, 0.282117963f},
-std::array<float,2>{0.0269177705f, 0.971325278f},
-std::array<float,2>{0.264263421f, 0.176498935f},
-std::array<float,2>{0.737944365f, 0.69769758f},
-std::array<float,2>{0.651134431f, 0.430957168f},
-std::array<float,2>{0.358352691f, 0.861657143f},
-std::array<float,2>{0.118501388f, 0.0792260543f},
-std::array<float,2>{0.849740982f, 0.601818681f},
-std::array<float,2>{0.947305322f, 0.239448652f},
-std::array<float,2>{0.131543651f, 0.646372557f},
-std::array<float,2>{0.418611199f, 0.3689349f},
-std::array<float,2>{0.522774816f, 0.935672104f},
-std::array<float,2>{0.646952033f, 0.00962868799f},
-std::array<float,2>{0.349808931f, 0.532683492f},
-std::array<float,2>{0.115345843f, 0.469773978f},
-std::array<float,2>{0.856639922f, 0.75295037f},
-std::array<float,2>{0.943415165f, 0.309892386f},
-std::array<float,2>{0.133263916f, 0.997830629f},
-std::array<float,2>{0.408112615f, 0.165218532f},
-std::array<float,2>{0.525146484f, 0.708644331f},
-std::array<float,2>{0.609306395f, 0.41487202f},
-std::array<float,2>{0.475643426f, 0.856719077f},
-std::array<float,2>{0.189954206f, 0.0759224668f},
-std::array<float,2>{0.921896398f, 0.613520265f},
-std::array<float,2>{0.768004239f, 0.222570643f},
-std::array<float,2>{0.0172466785f, 0.638583124f},
-std::array<float,2>{0.256516337f, 0.343829662f},
-std::array<float,2>{0.74405241f, 0.908539593f},
-std::array<float,2>{0.532263398f, 0.139119864f},
-std::array<float,2>{0.383961886f, 0.725864053f},
-std::array<float,2>{0.159099415f, 0.263993859f},
-std::array<float,2>{0.992886662f, 0.941473424f},
-std::array<float,2>{0.828596532f, 0.445697278f},
-std::array<float,2>{0.0770923048f, 0.789607286f},
-std::array<float,2>{0.338341624f, 0.0388178378f},
-std::array<float,2>{0.669687092f, 0.528531909f},
-std::array<float,2>{0.718363702f, 0.314205378f},
-std::array<float,2>{0.292794913f, 0.90580982f},
-std::array<float,2>{0.031696219f, 0.217616454f},
-std::array<float,2>{0.801921666f, 0.660518229f},
-std::array<float,2>{0.901929796f, 0.110461943f},
-std::array<float,2>{0.240941897f, 0.572757185f},
-std::array<float,2>{0.439651936f, 0.389917672f},
-std::array<float,2>{0.564337075f, 0.841949046f},
-std::array<float,2>{0.730271697f, 0.190908626f},
-std::array<float,2>{0.270918071f, 0.675022125f},
-std::array<float,2>{0.0110480804f, 0.340044528f},
-std::array<float,2>{0.752032757f, 0.888891757f},
-std::array<float,2>{0.910263479f, 0.399766654f},
-std::array<float,2>{0.214100316f, 0.827319384f},
-std::array<float,2>{0.487657487f, 0.100473627f},
-std::array<float,2>{0.620036304f, 0.584396601f},
-std::array<float,2>{0.507018447f, 0.269021571f},
-std::array<float,2>{0.430098802f, 0.964078546f},
-std::array<float,2>{0.149922386f, 0.142918035f},
-std::array<float,2>{0.960600138f, 0.743787408f},
-std::array<float,2>{0.866833568f, 0.0482734703f},
-std::array<float,2>{0.0959590077f, 0.503251433f},
-std::array<float,2>{0.360467225f, 0.465416461f},
-std::array<float,2>{0.629820764f, 0.807258904f},
-std::array<float,2>{0.593149722f, 0.0823208466f},
-std::array<float,2>{0.466683596f, 0.607497156f},
-std::array<float,2>{0.232567012f, 0.435305148f},
-std::array<float,2>{0.883798122f, 0.864176452f},
-std::array<float,2>{0.79024899f, 0.371136397f},
-std::array<float,2>{0.0578105189f, 0.931437075f},
-std::array<float,2>{0.311564744f, 0.234636515f},
-std::array<float,2>{0.691328406f, 0.64080584f},
-std::array<float,2>{0.674212217f, 0.487467915f},
-std::array<float,2>{0.314090163f, 0.773823202f},
-std::array<float,2>{0.0887773111f, 0.0308889337f},
-std::array<float,2>{0.814204752f, 0.555868208f},
-std::array<float,2>{0.977194488f, 0.17505759f},
-std::array<float,2>{0.181778863f, 0.702344477f},
-std::array<float,2>{0.393290043f, 0.288902432f},
-std::array<float,2>{0.556047201f, 0.972916663f},
-std::array<float,2>{0.700567603f, 0.105959237f},
-std::array<float,2>{0.301474392f, 0.592308044f},
-std::array<float,2>{0.0542359278f, 0.394524962f},
-std::array<float,2>{0.784632921f, 0.812979043f},
-std::array<float,2>{0.880176127f, 0.335038573f},
-std::array<float,2>{0.221710756f, 0.880185783f},
-std::array<float,2>{0.454313308f, 0.198248014f},
-std::array<float,2>{0.584534883f, 0.682002723f},
-std::array<float,2>{0.548879921f, 0.453363955f},
-std::array<float,2>{0.402068049f, 0.798671067f},
-std::array<float,2>{0.174442947f, 0.0569417216f},
-std::array<float,2>{0.972631454f, 0.508682489f},
-std::array<float,2>{0.821486712f, 0.155449465f},
-std::array<float,2>{0.0824620873f, 0.737300754f},
-std::array<float,2>{0.328029901f, 0.275244951f},
-std::array<float,2>{0.682181656f, 0.960597873f},
-std::array<float,2>{0.610294282f, 0.24282226f},
-std::array<float,2>{0.493274361f, 0.652840078f},
-std::array<float,2>{0.206922412f, 0.361564159f},
-std::array<float,2>{0.921044111f, 0.926979005f},
-std::array<float,2>{0.761044919f, 0.424329996f},
-std::array<float,2>{0.00556087727f, 0.870218754f},
-std::array<float,2>{0.275327981f, 0.0873648077f},
-std::array<float,2>{0.720031261f, 0.601454496f},
-std::array<float,2>{0.63472122f, 0.296121836f},
-std::array<float,2>{0.373014867f, 0.980142653f},
-std::array<float,2>{0.106180109f, 0.183034107f},
-std::array<float,2>{0.871097982f, 0.692224562f},
-std::array<float,2>{0.962283432f, 0.0220082495f},
-std::array<float,2>{0.145380437f, 0.551478088f},
-std::array<float,2>{0.422371536f, 0.496704519f},
-std::array<float,2>{0.514969051f, 0.766511977f},
-std::array<float,2>{0.662240148f, 0.158570513f},
-std::array<float,2>{0.333854437f, 0.712204039f},
-std::array<float,2>{0.068760477f, 0.298978806f},
-std::array<float,2>{0.838024974f, 0.991850555f},
-std::array<float,2>{0.985503376f, 0.484113425f},
-std::array<float,2>{0.167949185f, 0.763632834f},
-std::array<float,2>{0.379674256f, 0.000155655376f},
-std::array<float,2>{0.543562829f, 0.541487873f},
-std::array<float,2>{0.576406837f, 0.355753422f},
-std::array<float,2>{0.447018176f, 0.915763259f},
-std::array<float,2>{0.245144129f, 0.228116095f},
-std::array<float,2>{0.897736132f, 0.630385458f},
-std::array<float,2>{0.812373936f, 0.0639153793f},
-std::array<float,2>{0.0461492687f, 0.61913681f},
-std::array<float,2>{0.281628907f, 0.41259861f},
-std::array<float,2>{0.707924366f, 0.849218845f},
-std::array<float,2>{0.519269288f, 0.0452286005f},
-std::array<float,2>{0.417343497f, 0.519586742f},
-std::array<float,2>{0.125476345f, 0.439628482f},
-std::array<float,2>{0.95226562f, 0.782902241f},
-std::array<float,2>{0.844015956f, 0.257562876f},
-std::array<float,2>{0.124898754f, 0.947398126f},
-std::array<float,2>{0.352945983f, 0.130913168f},
-std::array<float,2>{0.653840184f, 0.729257405f},
-std::array<float,2>{0.738464773f, 0.379814565f},
-std::array<float,2>{0.259496778f, 0.82900542f},
-std::array<float,2>{0.02998529f, 0.119609147f},
-std::array<float,2>{0.77968812f, 0.56422478f},
-std::array<float,2>{0.934780896f, 0.206737489f},
-std::array<float,2>{0.195997477f, 0.668468654f},
-std::array<float,2>{0.482772887f, 0.322396845f},
-std::array<float,2>{0.594105303f, 0.895093262f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.951557636f, 0.259670675f},
-std::array<float,2>{0.276523054f, 0.535843134f},
-std::array<float,2>{0.0869572312f, 0.076451309f},
-std::array<float,2>{0.527895331f, 0.983860791f},
-std::array<float,2>{0.670119405f, 0.248757437f},
-std::array<float,2>{0.1769595f, 0.807714939f},
-std::array<float,2>{0.471858919f, 0.450444728f},
-std::array<float,2>{0.819021046f, 0.697538376f},
-std::array<float,2>{0.768969595f, 0.00312974537f},
-std::array<float,2>{0.415217668f, 0.926168442f},
-std::array<float,2>{0.237471282f, 0.369229376f},
-std::array<float,2>{0.723820508f, 0.602285445f},
-std::array<float,2>{0.593773723f, 0.387175798f},
-std::array<float,2>{0.00987069961f, 0.66443795f},
-std::array<float,2>{0.338896722f, 0.132855535f},
-std::array<float,2>{0.89952457f, 0.817517161f},
-std::array<float,2>{0.864305437f, 0.491802096f},
-std::array<float,2>{0.457721174f, 0.739502966f},
-std::array<float,2>{0.135729462f, 0.191950291f},
-std::array<float,2>{0.637793601f, 0.761737347f},
-std::array<float,2>{0.544090688f, 0.102899536f},
-std::array<float,2>{0.107162572f, 0.968000472f},
-std::array<float,2>{0.296269178f, 0.295184374f},
-std::array<float,2>{0.980389118f, 0.509013653f},
-std::array<float,2>{0.912422001f, 0.165540069f},
-std::array<float,2>{0.348333806f, 0.862911344f},
-std::array<float,2>{0.0317758657f, 0.414158821f},
-std::array<float,2>{0.575150907f, 0.630768061f},
-std::array<float,2>{0.68781352f, 0.334981233f},
-std::array<float,2>{0.211611822f, 0.569880605f},
-std::array<float,2>{0.400321692f, 0.0372039527f},
-std::array<float,2>{0.797828555f, 0.900142312f},
-std::array<float,2>{0.889224291f, 0.433848858f},
-std::array<float,2>{0.31916073f, 0.642598748f},
-std::array<float,2>{0.0197767522f, 0.182728425f},
-std::array<float,2>{0.614667773f, 0.849936485f},
-std::array<float,2>{0.744993448f, 0.0483880825f},
-std::array<float,2>{0.223705232f, 0.889074683f},
-std::array<float,2>{0.422551841f, 0.316160798f},
-std::array<float,2>{0.756620288f, 0.588207304f},
-std::array<float,2>{0.833255589f, 0.216619447f},
-std::array<float,2>{0.490212053f, 0.76906693f},
-std::array<float,2>{0.168997496f, 0.478994638f},
-std::array<float,2>{0.672644854f, 0.720057487f},
-std::array<float,2>{0.512221992f, 0.30018422f},
-std::array<float,2>{0.0689485371f, 0.525596321f},
-std::array<float,2>{0.256566405f, 0.123216391f},
-std::array<float,2>{0.967122853f, 0.947801471f},
-std::array<float,2>{0.788975537f, 0.35701701f},
-std::array<float,2>{0.377999514f, 0.618072391f},
-std::array<float,2>{0.190947384f, 0.0244618542f},
-std::array<float,2>{0.7178635f, 0.91669786f},
-std::array<float,2>{0.582634985f, 0.150274277f},
-std::array<float,2>{0.0584820956f, 0.830323219f},
-std::array<float,2>{0.369740009f, 0.392920762f},
-std::array<float,2>{0.932919025f, 0.673479736f},
-std::array<float,2>{0.991240978f, 0.0817529485f},
-std::array<float,2>{0.303270787f, 0.988888979f},
-std::array<float,2>{0.120934352f, 0.27923131f},
-std::array<float,2>{0.550206065f, 0.560497105f},
-std::array<float,2>{0.654158175f, 0.456039429f},
-std::array<float,2>{0.151161909f, 0.706227899f},
-std::array<float,2>{0.444310665f, 0.229845181f},
-std::array<float,2>{0.859089255f, 0.795542061f},
-std::array<float,2>{0.927691162f, 0.326474398f},
-std::array<float,2>{0.364791691f, 0.583114684f},
-std::array<float,2>{0.0513100065f, 0.0584433824f},
-std::array<float,2>{0.588607311f, 0.87946111f},
-std::array<float,2>{0.705974102f, 0.178007886f},
-std::array<float,2>{0.196088567f, 0.857364833f},
-std::array<float,2>{0.385066241f, 0.42960614f},
-std::array<float,2>{0.790987253f, 0.653652847f},
-std::array<float,2>{0.844194949f, 0.110552549f},
-std::array<float,2>{0.452670485f, 0.942762494f},
-std::array<float,2>{0.143948033f, 0.309866309f},
-std::array<float,2>{0.645523846f, 0.522677481f},
-std::array<float,2>{0.556595504f, 0.46942848f},
-std::array<float,2>{0.116531588f, 0.727636516f},
-std::array<float,2>{0.308992773f, 0.208802462f},
-std::array<float,2>{0.994085312f, 0.774455249f},
-std::array<float,2>{0.757895052f, 0.405671239f},
-std::array<float,2>{0.430083752f, 0.685850024f},
-std::array<float,2>{0.234054714f, 0.142234951f},
-std::array<float,2>{0.738289535f, 0.840639055f},
-std::array<float,2>{0.620538712f, 0.0177607536f},
-std::array<float,2>{0.0285321958f, 0.909246325f},
-std::array<float,2>{0.323870629f, 0.346176833f},
-std::array<float,2>{0.880009592f, 0.61089313f},
-std::array<float,2>{0.95888108f, 0.222326115f},
-std::array<float,2>{0.265198112f, 0.785387158f},
-std::array<float,2>{0.0766694248f, 0.462241411f},
-std::array<float,2>{0.505691409f, 0.717387855f},
-std::array<float,2>{0.686460972f, 0.273255736f},
-std::array<float,2>{0.162580654f, 0.549927473f},
-std::array<float,2>{0.49998191f, 0.0903715119f},
-std::array<float,2>{0.842421174f, 0.99309814f},
-std::array<float,2>{0.972910106f, 0.442250162f},
-std::array<float,2>{0.286703795f, 0.691231072f},
-std::array<float,2>{0.0949497595f, 0.237117633f},
-std::array<float,2>{0.536629677f, 0.800798059f},
-std::array<float,2>{0.62612766f, 0.0634050742f},
-std::array<float,2>{0.128079996f, 0.970980585f},
-std::array<float,2>{0.465004861f, 0.254577965f},
-std::array<float,2>{0.86795789f, 0.539328575f},
-std::array<float,2>{0.80944258f, 0.127460524f},
-std::array<float,2>{0.391260445f, 0.827024639f},
-std::array<float,2>{0.209661528f, 0.375776738f},
-std::array<float,2>{0.696060002f, 0.65776062f},
-std::array<float,2>{0.568208277f, 0.362016022f},
-std::array<float,2>{0.0422468595f, 0.593988061f},
-std::array<float,2>{0.358698845f, 0.0105150323f},
-std::array<float,2>{0.917885542f, 0.933321178f},
-std::array<float,2>{0.821291983f, 0.281983823f},
-std::array<float,2>{0.480230451f, 0.507394433f},
-std::array<float,2>{0.184612751f, 0.0987578481f},
-std::array<float,2>{0.658593416f, 0.960309684f},
-std::array<float,2>{0.522288561f, 0.202157274f},
-std::array<float,2>{0.0811779648f, 0.756107867f},
-std::array<float,2>{0.272273928f, 0.497043043f},
-std::array<float,2>{0.943236411f, 0.74426347f},
-std::array<float,2>{0.891469836f, 0.0431154482f},
-std::array<float,2>{0.330889255f, 0.891429305f},
-std::array<float,2>{0.00523520168f, 0.336300075f},
-std::array<float,2>{0.60278511f, 0.571321845f},
-std::array<float,2>{0.729566872f, 0.409011066f},
-std::array<float,2>{0.244773149f, 0.636672914f},
-std::array<float,2>{0.406396121f, 0.161243841f},
-std::array<float,2>{0.776487708f, 0.869109154f},
-std::array<float,2>{0.905543745f, 0.308560759f},
-std::array<float,2>{0.340401828f, 0.516343832f},
-std::array<float,2>{0.0143161714f, 0.114410989f},
-std::array<float,2>{0.601524353f, 0.937601388f},
-std::array<float,2>{0.72071135f, 0.203528821f},
-std::array<float,2>{0.239755988f, 0.780014694f},
-std::array<float,2>{0.421734244f, 0.475830913f},
-std::array<float,2>{0.769540429f, 0.734086156f},
-std::array<float,2>{0.81458348f, 0.0598593876f},
-std::array<float,2>{0.475307733f, 0.876020551f},
-std::array<float,2>{0.172385827f, 0.321432829f},
-std::array<float,2>{0.667475402f, 0.579712629f},
-std::array<float,2>{0.523996532f, 0.423909932f},
-std::array<float,2>{0.0905262902f, 0.652210534f},
-std::array<float,2>{0.277692258f, 0.175616115f},
-std::array<float,2>{0.948745012f, 0.852681518f},
-std::array<float,2>{0.802595198f, 0.468253911f},
-std::array<float,2>{0.404360503f, 0.714455783f},
-std::array<float,2>{0.216219649f, 0.224980757f},
-std::array<float,2>{0.693857491f, 0.78231132f},
-std::array<float,2>{0.571526945f, 0.0873515233f},
-std::array<float,2>{0.0352517366f, 0.99738425f},
-std::array<float,2>{0.344279736f, 0.268303037f},
-std::array<float,2>{0.907433212f, 0.55136925f},
-std::array<float,2>{0.982539177f, 0.145275161f},
-std::array<float,2>{0.289117992f, 0.838121653f},
-std::array<float,2>{0.103661455f, 0.399284691f},
-std::array<float,2>{0.540964961f, 0.681332827f},
-std::array<float,2>{0.636408269f, 0.348371565f},
-std::array<float,2>{0.139713988f, 0.614607155f},
-std::array<float,2>{0.456246018f, 0.0204270147f},
-std::array<float,2>{0.862862825f, 0.913879395f},
-std::array<float,2>{0.96396786f, 0.381904691f},
-std::array<float,2>{0.251856774f, 0.661006331f},
-std::array<float,2>{0.0634639189f, 0.13117002f},
-std::array<float,2>{0.510800064f, 0.821911931f},
-std::array<float,2>{0.67775774f, 0.0147265755f},
-std::array<float,2>{0.164781794f, 0.933715999f},
-std::array<float,2>{0.487302959f, 0.365279227f},
-std::array<float,2>{0.829543054f, 0.60027355f},
-std::array<float,2>{0.753625333f, 0.24087669f},
-std::array<float,2>{0.429491043f, 0.798910856f},
-std::array<float,2>{0.221222594f, 0.438879043f},
-std::array<float,2>{0.74619633f, 0.691702306f},
-std::array<float,2>{0.612210274f, 0.250193477f},
-std::array<float,2>{0.0157334376f, 0.544512331f},
-std::array<float,2>{0.313692093f, 0.0696175024f},
-std::array<float,2>{0.884659827f, 0.975381136f},
-std::array<float,2>{0.855432451f, 0.343579829f},
-std::array<float,2>{0.438339204f, 0.575208306f},
-std::array<float,2>{0.153556123f, 0.0408014245f},
-std::array<float,2>{0.650880754f, 0.897353232f},
-std::array<float,2>{0.551724792f, 0.157980844f},
-std::array<float,2>{0.121373698f, 0.873553932f},
-std::array<float,2>{0.300244898f, 0.410195976f},
-std::array<float,2>{0.987990797f, 0.637877524f},
-std::array<float,2>{0.933603585f, 0.0972705483f},
-std::array<float,2>{0.373349339f, 0.956412673f},
-std::array<float,2>{0.0593408421f, 0.288313955f},
-std::array<float,2>{0.578318298f, 0.502529085f},
-std::array<float,2>{0.714528799f, 0.494780183f},
-std::array<float,2>{0.192743972f, 0.7498101f},
-std::array<float,2>{0.38155514f, 0.197661772f},
-std::array<float,2>{0.784217536f, 0.752584279f},
-std::array<float,2>{0.996569991f, 0.372576088f},
-std::array<float,2>{0.304701477f, 0.606206119f},
-std::array<float,2>{0.109927185f, 0.00436566491f},
-std::array<float,2>{0.560713172f, 0.925185323f},
-std::array<float,2>{0.640804768f, 0.139868721f},
-std::array<float,2>{0.144841731f, 0.815829158f},
-std::array<float,2>{0.448801994f, 0.386536956f},
-std::array<float,2>{0.850416243f, 0.668900013f},
-std::array<float,2>{0.796289921f, 0.0705205798f},
-std::array<float,2>{0.386795521f, 0.977134168f},
-std::array<float,2>{0.200729936f, 0.262988865f},
-std::array<float,2>{0.709659219f, 0.532152534f},
-std::array<float,2>{0.593533695f, 0.445364565f},
-std::array<float,2>{0.0492519587f, 0.70160991f},
-std::array<float,2>{0.361602038f, 0.244002715f},
-std::array<float,2>{0.923290431f, 0.811827123f},
-std::array<float,2>{0.837664008f, 0.420196325f},
-std::array<float,2>{0.494477659f, 0.626091242f},
-std::array<float,2>{0.158030123f, 0.170466244f},
-std::array<float,2>{0.680409312f, 0.863746464f},
-std::array<float,2>{0.50258106f, 0.0330885388f},
-std::array<float,2>{0.0731422976f, 0.903182328f},
-std::array<float,2>{0.258944571f, 0.330660552f},
-std::array<float,2>{0.953442812f, 0.564756155f},
-std::array<float,2>{0.876660228f, 0.188336894f},
-std::array<float,2>{0.324565202f, 0.760909438f},
-std::array<float,2>{0.0237812102f, 0.487131864f},
-std::array<float,2>{0.62152791f, 0.734502733f},
-std::array<float,2>{0.736022592f, 0.291511267f},
-std::array<float,2>{0.228824764f, 0.513781011f},
-std::array<float,2>{0.433947951f, 0.10723763f},
-std::array<float,2>{0.762354672f, 0.962092161f},
-std::array<float,2>{0.919503212f, 0.484180927f},
-std::array<float,2>{0.354592919f, 0.724619746f},
-std::array<float,2>{0.0459834896f, 0.212398186f},
-std::array<float,2>{0.565060079f, 0.770499408f},
-std::array<float,2>{0.703034997f, 0.120210521f},
-std::array<float,2>{0.204797283f, 0.95168525f},
-std::array<float,2>{0.395643681f, 0.300862014f},
-std::array<float,2>{0.806460798f, 0.528262913f},
-std::array<float,2>{0.872407258f, 0.184139907f},
-std::array<float,2>{0.462325424f, 0.846296191f},
-std::array<float,2>{0.130910724f, 0.430088431f},
-std::array<float,2>{0.629570007f, 0.645392776f},
-std::array<float,2>{0.534066319f, 0.318246424f},
-std::array<float,2>{0.100310102f, 0.590721726f},
-std::array<float,2>{0.281559587f, 0.0527157523f},
-std::array<float,2>{0.969347954f, 0.884630322f},
-std::array<float,2>{0.7809214f, 0.273633718f},
-std::array<float,2>{0.411509037f, 0.557718754f},
-std::array<float,2>{0.247351483f, 0.0845798627f},
-std::array<float,2>{0.73078692f, 0.986362696f},
-std::array<float,2>{0.607571363f, 0.23083289f},
-std::array<float,2>{0.00205912837f, 0.792352617f},
-std::array<float,2>{0.332929671f, 0.459628105f},
-std::array<float,2>{0.895711362f, 0.709912002f},
-std::array<float,2>{0.939164579f, 0.0283354875f},
-std::array<float,2>{0.266989231f, 0.920650065f},
-std::array<float,2>{0.0833716989f, 0.352253735f},
-std::array<float,2>{0.518783212f, 0.623541892f},
-std::array<float,2>{0.66124773f, 0.396541059f},
-std::array<float,2>{0.180524141f, 0.676027656f},
-std::array<float,2>{0.4825975f, 0.153150886f},
-std::array<float,2>{0.827109873f, 0.834481061f},
-std::array<float,2>{0.978501558f, 0.293793827f},
-std::array<float,2>{0.294335008f, 0.511073351f},
-std::array<float,2>{0.108405456f, 0.104075037f},
-std::array<float,2>{0.54559052f, 0.966445506f},
-std::array<float,2>{0.638914585f, 0.194742262f},
-std::array<float,2>{0.133537799f, 0.765297234f},
-std::array<float,2>{0.459388345f, 0.490212709f},
-std::array<float,2>{0.866460264f, 0.74078244f},
-std::array<float,2>{0.80000788f, 0.0365760028f},
-std::array<float,2>{0.401164472f, 0.902231872f},
-std::array<float,2>{0.214281842f, 0.332394332f},
-std::array<float,2>{0.69122088f, 0.566783071f},
-std::array<float,2>{0.576776683f, 0.417256892f},
-std::array<float,2>{0.0349584147f, 0.631610572f},
-std::array<float,2>{0.350551188f, 0.167620167f},
-std::array<float,2>{0.912069738f, 0.860397398f},
-std::array<float,2>{0.816916883f, 0.45187971f},
-std::array<float,2>{0.468920022f, 0.69705379f},
-std::array<float,2>{0.17916584f, 0.246143967f},
-std::array<float,2>{0.669665575f, 0.805599332f},
-std::array<float,2>{0.529880047f, 0.0753336549f},
-std::array<float,2>{0.0896227509f, 0.981583297f},
-std::array<float,2>{0.275078446f, 0.260696381f},
-std::array<float,2>{0.950714469f, 0.539059818f},
-std::array<float,2>{0.901445508f, 0.134832636f},
-std::array<float,2>{0.337666363f, 0.818674028f},
-std::array<float,2>{0.00962136779f, 0.389222413f},
-std::array<float,2>{0.596067965f, 0.666227341f},
-std::array<float,2>{0.725369275f, 0.368795633f},
-std::array<float,2>{0.2357613f, 0.604747176f},
-std::array<float,2>{0.416019529f, 0.000406956882f},
-std::array<float,2>{0.766670108f, 0.928111434f},
-std::array<float,2>{0.931575358f, 0.391806185f},
-std::array<float,2>{0.368845046f, 0.675639331f},
-std::array<float,2>{0.0557529517f, 0.152205169f},
-std::array<float,2>{0.584281266f, 0.828413665f},
-std::array<float,2>{0.715996027f, 0.0265696943f},
-std::array<float,2>{0.188592389f, 0.915394068f},
-std::array<float,2>{0.376817137f, 0.358913064f},
-std::array<float,2>{0.785932004f, 0.619944692f},
-std::array<float,2>{0.855732083f, 0.227547333f},
-std::array<float,2>{0.442141145f, 0.793180108f},
-std::array<float,2>{0.14918749f, 0.454197556f},
-std::array<float,2>{0.655459464f, 0.704070747f},
-std::array<float,2>{0.54851073f, 0.280014604f},
-std::array<float,2>{0.117595263f, 0.562298179f},
-std::array<float,2>{0.301652968f, 0.0795284882f},
-std::array<float,2>{0.990130424f, 0.990356207f},
-std::array<float,2>{0.754417241f, 0.312679201f},
-std::array<float,2>{0.425499052f, 0.586393118f},
-std::array<float,2>{0.226158381f, 0.0493237451f},
-std::array<float,2>{0.743456781f, 0.887825012f},
-std::array<float,2>{0.616708577f, 0.180424228f},
-std::array<float,2>{0.0219669323f, 0.849267304f},
-std::array<float,2>{0.317337722f, 0.4362306f},
-std::array<float,2>{0.888540447f, 0.641742885f},
-std::array<float,2>{0.965866745f, 0.12116082f},
-std::array<float,2>{0.254268318f, 0.946183681f},
-std::array<float,2>{0.0668644905f, 0.297240406f},
-std::array<float,2>{0.514362514f, 0.525004208f},
-std::array<float,2>{0.675242305f, 0.477481872f},
-std::array<float,2>{0.170952901f, 0.721745849f},
-std::array<float,2>{0.490739673f, 0.218099996f},
-std::array<float,2>{0.835512221f, 0.766771495f},
-std::array<float,2>{0.881914377f, 0.344697565f},
-std::array<float,2>{0.320694208f, 0.612823486f},
-std::array<float,2>{0.0306601692f, 0.0170817338f},
-std::array<float,2>{0.617721677f, 0.907866478f},
-std::array<float,2>{0.741732061f, 0.144341186f},
-std::array<float,2>{0.231710553f, 0.843392253f},
-std::array<float,2>{0.43336159f, 0.404295117f},
-std::array<float,2>{0.760413587f, 0.684044957f},
-std::array<float,2>{0.840955853f, 0.093541041f},
-std::array<float,2>{0.497741729f, 0.994627893f},
-std::array<float,2>{0.161226004f, 0.270945191f},
-std::array<float,2>{0.683601141f, 0.547197998f},
-std::array<float,2>{0.506275296f, 0.464813143f},
-std::array<float,2>{0.0751311332f, 0.714955091f},
-std::array<float,2>{0.262863636f, 0.219730735f},
-std::array<float,2>{0.960809767f, 0.788664281f},
-std::array<float,2>{0.79144448f, 0.42590943f},
-std::array<float,2>{0.384094954f, 0.656083584f},
-std::array<float,2>{0.198852971f, 0.177316234f},
-std::array<float,2>{0.704880118f, 0.857698023f},
-std::array<float,2>{0.58639586f, 0.0560731329f},
-std::array<float,2>{0.0535215586f, 0.880936682f},
-std::array<float,2>{0.366846591f, 0.324948996f},
-std::array<float,2>{0.927957356f, 0.584871113f},
-std::array<float,2>{0.995938003f, 0.21044755f},
-std::array<float,2>{0.312442452f, 0.777160883f},
-std::array<float,2>{0.114301264f, 0.471234322f},
-std::array<float,2>{0.556773603f, 0.7304281f},
-std::array<float,2>{0.647917271f, 0.311043888f},
-std::array<float,2>{0.141230375f, 0.52123791f},
-std::array<float,2>{0.44962731f, 0.11218258f},
-std::array<float,2>{0.84644109f, 0.945185721f},
-std::array<float,2>{0.944507658f, 0.499121487f},
-std::array<float,2>{0.270908147f, 0.744086325f},
-std::array<float,2>{0.0781870559f, 0.200724602f},
-std::array<float,2>{0.521075428f, 0.753992975f},
-std::array<float,2>{0.657373905f, 0.100782372f},
-std::array<float,2>{0.186171189f, 0.95855099f},
-std::array<float,2>{0.476596564f, 0.283561915f},
-std::array<float,2>{0.822642326f, 0.505846679f},
-std::array<float,2>{0.773486078f, 0.162752673f},
-std::array<float,2>{0.410137832f, 0.870669246f},
-std::array<float,2>{0.242445767f, 0.40813458f},
-std::array<float,2>{0.727861822f, 0.633169949f},
-std::array<float,2>{0.604973376f, 0.339630187f},
-std::array<float,2>{0.00626581348f, 0.573022068f},
-std::array<float,2>{0.32966426f, 0.0449438319f},
-std::array<float,2>{0.893385172f, 0.893613577f},
-std::array<float,2>{0.870705187f, 0.256413847f},
-std::array<float,2>{0.46777612f, 0.542542338f},
-std::array<float,2>{0.125182629f, 0.0657130107f},
-std::array<float,2>{0.628013194f, 0.968877852f},
-std::array<float,2>{0.538765907f, 0.234770656f},
-std::array<float,2>{0.0959867239f, 0.802782416f},
-std::array<float,2>{0.287530154f, 0.444802731f},
-std::array<float,2>{0.975219548f, 0.688711822f},
-std::array<float,2>{0.914957464f, 0.0088444734f},
-std::array<float,2>{0.356122553f, 0.930737495f},
-std::array<float,2>{0.0402023196f, 0.359622061f},
-std::array<float,2>{0.569114447f, 0.595875919f},
-std::array<float,2>{0.697468042f, 0.377388954f},
-std::array<float,2>{0.207849443f, 0.658573627f},
-std::array<float,2>{0.3945207f, 0.125944003f},
-std::array<float,2>{0.81123358f, 0.82501775f},
-std::array<float,2>{0.909678042f, 0.267237395f},
-std::array<float,2>{0.347434759f, 0.553904712f},
-std::array<float,2>{0.0371979587f, 0.088586174f},
-std::array<float,2>{0.573766053f, 0.998921692f},
-std::array<float,2>{0.691940129f, 0.224385396f},
-std::array<float,2>{0.217515379f, 0.784268618f},
-std::array<float,2>{0.402410597f, 0.465007126f},
-std::array<float,2>{0.802754879f, 0.712741494f},
-std::array<float,2>{0.859737277f, 0.0218806006f},
-std::array<float,2>{0.453401983f, 0.910395324f},
-std::array<float,2>{0.137486234f, 0.351287544f},
-std::array<float,2>{0.633080482f, 0.616017163f},
-std::array<float,2>{0.541795433f, 0.400811881f},
-std::array<float,2>{0.103011347f, 0.68281287f},
-std::array<float,2>{0.292485505f, 0.147278547f},
-std::array<float,2>{0.980655849f, 0.83777982f},
-std::array<float,2>{0.772427797f, 0.474349767f},
-std::array<float,2>{0.419245213f, 0.731933653f},
-std::array<float,2>{0.24116905f, 0.205867261f},
-std::array<float,2>{0.720535517f, 0.778868854f},
-std::array<float,2>{0.599482477f, 0.116283953f},
-std::array<float,2>{0.0119372364f, 0.93946898f},
-std::array<float,2>{0.343707681f, 0.305295557f},
-std::array<float,2>{0.902486563f, 0.517689049f},
-std::array<float,2>{0.946431696f, 0.173453853f},
-std::array<float,2>{0.280901819f, 0.85509479f},
-std::array<float,2>{0.0934541076f, 0.423082739f},
-std::array<float,2>{0.527143836f, 0.649667084f},
-std::array<float,2>{0.665063143f, 0.322409332f},
-std::array<float,2>{0.175302267f, 0.580796301f},
-std::array<float,2>{0.472901523f, 0.0611539111f},
-std::array<float,2>{0.812934279f, 0.878354609f},
-std::array<float,2>{0.985167682f, 0.412535787f},
-std::array<float,2>{0.29738605f, 0.64039284f},
-std::array<float,2>{0.124591023f, 0.159536079f},
-std::array<float,2>{0.552836835f, 0.871513486f},
-std::array<float,2>{0.649942696f, 0.0423771441f},
-std::array<float,2>{0.154825941f, 0.894952714f},
-std::array<float,2>{0.439510733f, 0.34070304f},
-std::array<float,2>{0.852479815f, 0.576387465f},
-std::array<float,2>{0.781295061f, 0.196639016f},
-std::array<float,2>{0.380520284f, 0.750120521f},
-std::array<float,2>{0.193642527f, 0.492491931f},
-std::array<float,2>{0.712438405f, 0.747775197f},
-std::array<float,2>{0.580691755f, 0.285786808f},
-std::array<float,2>{0.0621977039f, 0.501218855f},
-std::array<float,2>{0.371385664f, 0.0952017233f},
-std::array<float,2>{0.937042236f, 0.953294754f},
-std::array<float,2>{0.83166194f, 0.364033759f},
-std::array<float,2>{0.484640777f, 0.598038435f},
-std::array<float,2>{0.16736801f, 0.0118593276f},
-std::array<float,2>{0.677707374f, 0.937425256f},
-std::array<float,2>{0.508063495f, 0.129091814f},
-std::array<float,2>{0.0656444132f, 0.823501527f},
-std::array<float,2>{0.252706885f, 0.380694121f},
-std::array<float,2>{0.961794436f, 0.66274339f},
-std::array<float,2>{0.884789765f, 0.0668766052f},
-std::array<float,2>{0.315110892f, 0.974408805f},
-std::array<float,2>{0.0188852921f, 0.252879471f},
-std::array<float,2>{0.611282289f, 0.546111643f},
-std::array<float,2>{0.748277187f, 0.439613789f},
-std::array<float,2>{0.218996033f, 0.694729447f},
-std::array<float,2>{0.426014841f, 0.239489898f},
-std::array<float,2>{0.751824439f, 0.798166931f},
-std::array<float,2>{0.955838501f, 0.328344405f},
-std::array<float,2>{0.260436147f, 0.562738478f},
-std::array<float,2>{0.0722274631f, 0.0334127657f},
-std::array<float,2>{0.50022459f, 0.904382706f},
-std::array<float,2>{0.682489753f, 0.168001235f},
-std::array<float,2>{0.15899308f, 0.865390956f},
-std::array<float,2>{0.493623078f, 0.418009698f},
-std::array<float,2>{0.838644087f, 0.628551841f},
-std::array<float,2>{0.763745368f, 0.107591055f},
-std::array<float,2>{0.43642211f, 0.96356523f},
-std::array<float,2>{0.227709636f, 0.289329857f},
-std::array<float,2>{0.737485468f, 0.51312381f},
-std::array<float,2>{0.623498201f, 0.485594213f},
-std::array<float,2>{0.0265390929f, 0.737784386f},
-std::array<float,2>{0.327413619f, 0.190299541f},
-std::array<float,2>{0.877974629f, 0.758539259f},
-std::array<float,2>{0.848081291f, 0.384750783f},
-std::array<float,2>{0.445862412f, 0.670625508f},
-std::array<float,2>{0.14790684f, 0.137345061f},
-std::array<float,2>{0.644147336f, 0.813667357f},
-std::array<float,2>{0.56015867f, 0.00735175377f},
-std::array<float,2>{0.11269743f, 0.922094643f},
-std::array<float,2>{0.3080796f, 0.374275506f},
-std::array<float,2>{0.99959439f, 0.607552648f},
-std::array<float,2>{0.925172687f, 0.245677233f},
-std::array<float,2>{0.35945785f, 0.810419202f},
-std::array<float,2>{0.0486323461f, 0.447356015f},
-std::array<float,2>{0.591058731f, 0.699241757f},
-std::array<float,2>{0.708482921f, 0.264440656f},
-std::array<float,2>{0.201563671f, 0.534448445f},
-std::array<float,2>{0.388922542f, 0.0722753406f},
-std::array<float,2>{0.793988407f, 0.979867458f},
-std::array<float,2>{0.898417532f, 0.458357066f},
-std::array<float,2>{0.335657507f, 0.707719445f},
-std::array<float,2>{0.000243447386f, 0.232860789f},
-std::array<float,2>{0.60739404f, 0.789962053f},
-std::array<float,2>{0.733336031f, 0.0827911869f},
-std::array<float,2>{0.248721063f, 0.985188484f},
-std::array<float,2>{0.412231177f, 0.275968075f},
-std::array<float,2>{0.777650476f, 0.556436896f},
-std::array<float,2>{0.825234532f, 0.155686051f},
-std::array<float,2>{0.482032627f, 0.832869947f},
-std::array<float,2>{0.181749374f, 0.395019978f},
-std::array<float,2>{0.662242949f, 0.679011643f},
-std::array<float,2>{0.51756984f, 0.35416314f},
-std::array<float,2>{0.0846330673f, 0.622592986f},
-std::array<float,2>{0.268335313f, 0.0304379743f},
-std::array<float,2>{0.940510631f, 0.918905854f},
-std::array<float,2>{0.806865811f, 0.303132445f},
-std::array<float,2>{0.398146927f, 0.529356062f},
-std::array<float,2>{0.20542416f, 0.11800193f},
-std::array<float,2>{0.701163292f, 0.951122761f},
-std::array<float,2>{0.562693357f, 0.213007137f},
-std::array<float,2>{0.0430598818f, 0.772155166f},
-std::array<float,2>{0.3517088f, 0.481660217f},
-std::array<float,2>{0.919941962f, 0.723256171f},
-std::array<float,2>{0.972004592f, 0.0541835912f},
-std::array<float,2>{0.283368886f, 0.885627627f},
-std::array<float,2>{0.0990751013f, 0.32025972f},
-std::array<float,2>{0.532919228f, 0.593324363f},
-std::array<float,2>{0.632331669f, 0.432799309f},
-std::array<float,2>{0.129243612f, 0.64839071f},
-std::array<float,2>{0.464782149f, 0.186145529f},
-std::array<float,2>{0.8746683f, 0.845298946f},
-std::array<float,2>{0.968628764f, 0.298090816f},
-std::array<float,2>{0.256952077f, 0.523706794f},
-std::array<float,2>{0.0697320551f, 0.122343197f},
-std::array<float,2>{0.51351428f, 0.946963966f},
-std::array<float,2>{0.673545897f, 0.216961101f},
-std::array<float,2>{0.168626145f, 0.766109943f},
-std::array<float,2>{0.488657534f, 0.477874517f},
-std::array<float,2>{0.832370698f, 0.720977247f},
-std::array<float,2>{0.757619143f, 0.049866315f},
-std::array<float,2>{0.423788965f, 0.88763696f},
-std::array<float,2>{0.223002017f, 0.313858509f},
-std::array<float,2>{0.745830417f, 0.58723557f},
-std::array<float,2>{0.6141541f, 0.436569244f},
-std::array<float,2>{0.0208651908f, 0.641352594f},
-std::array<float,2>{0.319377452f, 0.181604668f},
-std::array<float,2>{0.890057147f, 0.848388731f},
-std::array<float,2>{0.857723117f, 0.453502774f},
-std::array<float,2>{0.4452236f, 0.704811394f},
-std::array<float,2>{0.151416644f, 0.227407575f},
-std::array<float,2>{0.653252721f, 0.794228613f},
-std::array<float,2>{0.548902452f, 0.0783055499f},
-std::array<float,2>{0.120038979f, 0.991627872f},
-std::array<float,2>{0.304562569f, 0.280685008f},
-std::array<float,2>{0.991099417f, 0.561340749f},
-std::array<float,2>{0.932127297f, 0.150633067f},
-std::array<float,2>{0.371061802f, 0.829956412f},
-std::array<float,2>{0.05715115f, 0.39109382f},
-std::array<float,2>{0.583903015f, 0.674676299f},
-std::array<float,2>{0.717679024f, 0.358392358f},
-std::array<float,2>{0.190121979f, 0.620560527f},
-std::array<float,2>{0.377924591f, 0.0256856382f},
-std::array<float,2>{0.787647128f, 0.914530396f},
-std::array<float,2>{0.898721755f, 0.390340984f},
-std::array<float,2>{0.338243634f, 0.667614698f},
-std::array<float,2>{0.0111442674f, 0.136150286f},
-std::array<float,2>{0.595550478f, 0.820000589f},
-std::array<float,2>{0.722709715f, 0.000999050331f},
-std::array<float,2>{0.236627281f, 0.929262102f},
-std::array<float,2>{0.414701194f, 0.367273062f},
-std::array<float,2>{0.767856002f, 0.603726268f},
-std::array<float,2>{0.819826841f, 0.247203186f},
-std::array<float,2>{0.470975965f, 0.805983961f},
-std::array<float,2>{0.176064134f, 0.453046471f},
-std::array<float,2>{0.671345949f, 0.695503414f},
-std::array<float,2>{0.528768122f, 0.26086536f},
-std::array<float,2>{0.0865432248f, 0.537166119f},
-std::array<float,2>{0.276029021f, 0.0751401559f},
-std::array<float,2>{0.952671766f, 0.981269896f},
-std::array<float,2>{0.79851985f, 0.333604127f},
-std::array<float,2>{0.399204701f, 0.5678249f},
-std::array<float,2>{0.21207875f, 0.0358260833f},
-std::array<float,2>{0.689383209f, 0.900935173f},
-std::array<float,2>{0.575350702f, 0.166919649f},
-std::array<float,2>{0.0325713605f, 0.859455049f},
-std::array<float,2>{0.348745704f, 0.416693568f},
-std::array<float,2>{0.913711071f, 0.632649004f},
-std::array<float,2>{0.978730679f, 0.105429314f},
-std::array<float,2>{0.29498598f, 0.965239286f},
-std::array<float,2>{0.106206432f, 0.294160783f},
-std::array<float,2>{0.543870389f, 0.510633409f},
-std::array<float,2>{0.636795998f, 0.488690913f},
-std::array<float,2>{0.136508659f, 0.741389096f},
-std::array<float,2>{0.458589792f, 0.193999007f},
-std::array<float,2>{0.863477767f, 0.764481902f},
-std::array<float,2>{0.916971207f, 0.361151576f},
-std::array<float,2>{0.35818553f, 0.5968225f},
-std::array<float,2>{0.0411607772f, 0.00798831228f},
-std::array<float,2>{0.566562891f, 0.930293739f},
-std::array<float,2>{0.697082937f, 0.126163721f},
-std::array<float,2>{0.210094452f, 0.825242162f},
-std::array<float,2>{0.392109871f, 0.378193825f},
-std::array<float,2>{0.80988121f, 0.659518957f},
-std::array<float,2>{0.869120002f, 0.0649273545f},
-std::array<float,2>{0.466739416f, 0.970562816f},
-std::array<float,2>{0.127440736f, 0.257584214f},
-std::array<float,2>{0.625157297f, 0.541838169f},
-std::array<float,2>{0.535627007f, 0.44389233f},
-std::array<float,2>{0.0942998454f, 0.688151598f},
-std::array<float,2>{0.285959989f, 0.236014038f},
-std::array<float,2>{0.973989189f, 0.804670513f},
-std::array<float,2>{0.776144683f, 0.407218665f},
-std::array<float,2>{0.407299519f, 0.634307146f},
-std::array<float,2>{0.245577946f, 0.163212582f},
-std::array<float,2>{0.729172111f, 0.870096922f},
-std::array<float,2>{0.601870537f, 0.0467944853f},
-std::array<float,2>{0.00472222036f, 0.892586708f},
-std::array<float,2>{0.331317782f, 0.337997079f},
-std::array<float,2>{0.89170599f, 0.573802769f},
-std::array<float,2>{0.941981792f, 0.199368194f},
-std::array<float,2>{0.272621304f, 0.755177915f},
-std::array<float,2>{0.0801686198f, 0.498606205f},
-std::array<float,2>{0.522942007f, 0.742991388f},
-std::array<float,2>{0.660131752f, 0.285063028f},
-std::array<float,2>{0.18419449f, 0.503979921f},
-std::array<float,2>{0.479489952f, 0.0998833552f},
-std::array<float,2>{0.820777297f, 0.957826018f},
-std::array<float,2>{0.992943525f, 0.471953094f},
-std::array<float,2>{0.309985697f, 0.72946763f},
-std::array<float,2>{0.115414239f, 0.209038094f},
-std::array<float,2>{0.555586994f, 0.775666535f},
-std::array<float,2>{0.644938946f, 0.112335324f},
-std::array<float,2>{0.14336051f, 0.943433046f},
-std::array<float,2>{0.451896638f, 0.311799437f},
-std::array<float,2>{0.844858348f, 0.520058453f},
-std::array<float,2>{0.790023386f, 0.176413134f},
-std::array<float,2>{0.386039168f, 0.859193563f},
-std::array<float,2>{0.196863249f, 0.427350044f},
-std::array<float,2>{0.706907928f, 0.655057728f},
-std::array<float,2>{0.589452147f, 0.325943649f},
-std::array<float,2>{0.0521092825f, 0.585215569f},
-std::array<float,2>{0.363390744f, 0.0555719472f},
-std::array<float,2>{0.926238656f, 0.882162333f},
-std::array<float,2>{0.843691826f, 0.270216823f},
-std::array<float,2>{0.498173684f, 0.548486233f},
-std::array<float,2>{0.163915113f, 0.0921495259f},
-std::array<float,2>{0.687137067f, 0.995656252f},
-std::array<float,2>{0.504066586f, 0.21927847f},
-std::array<float,2>{0.0774472058f, 0.787756085f},
-std::array<float,2>{0.264615715f, 0.46355322f},
-std::array<float,2>{0.957580805f, 0.715944231f},
-std::array<float,2>{0.879140794f, 0.0159676969f},
-std::array<float,2>{0.323045641f, 0.906368077f},
-std::array<float,2>{0.0273895897f, 0.345315188f},
-std::array<float,2>{0.619871736f, 0.611540318f},
-std::array<float,2>{0.740111232f, 0.403133214f},
-std::array<float,2>{0.23319152f, 0.685169756f},
-std::array<float,2>{0.430905998f, 0.142966971f},
-std::array<float,2>{0.758957803f, 0.842601418f},
-std::array<float,2>{0.882828653f, 0.253565699f},
-std::array<float,2>{0.312807292f, 0.545373142f},
-std::array<float,2>{0.0174237024f, 0.0679685771f},
-std::array<float,2>{0.613199949f, 0.973287106f},
-std::array<float,2>{0.74709779f, 0.238932073f},
-std::array<float,2>{0.222037837f, 0.797043383f},
-std::array<float,2>{0.42780146f, 0.44115597f},
-std::array<float,2>{0.752164006f, 0.693652749f},
-std::array<float,2>{0.828653336f, 0.0136354892f},
-std::array<float,2>{0.487574071f, 0.935908139f},
-std::array<float,2>{0.16575247f, 0.364464283f},
-std::array<float,2>{0.679018795f, 0.59928292f},
-std::array<float,2>{0.510595977f, 0.37923494f},
-std::array<float,2>{0.0643594936f, 0.663397431f},
-std::array<float,2>{0.250144392f, 0.130597502f},
-std::array<float,2>{0.963561893f, 0.822429717f},
-std::array<float,2>{0.783263266f, 0.493864685f},
-std::array<float,2>{0.382192254f, 0.746777415f},
-std::array<float,2>{0.192376912f, 0.196107134f},
-std::array<float,2>{0.713217497f, 0.751785934f},
-std::array<float,2>{0.579654455f, 0.0939389542f},
-std::array<float,2>{0.060002014f, 0.9544034f},
-std::array<float,2>{0.374763519f, 0.286937594f},
-std::array<float,2>{0.93522203f, 0.500942469f},
-std::array<float,2>{0.986446977f, 0.158903643f},
-std::array<float,2>{0.29932043f, 0.872662842f},
-std::array<float,2>{0.122547165f, 0.413825721f},
-std::array<float,2>{0.551952004f, 0.639420688f},
-std::array<float,2>{0.651696324f, 0.341695338f},
-std::array<float,2>{0.152678639f, 0.577905655f},
-std::array<float,2>{0.439389229f, 0.041461233f},
-std::array<float,2>{0.853639364f, 0.895904362f},
-std::array<float,2>{0.948039234f, 0.422758967f},
-std::array<float,2>{0.279243082f, 0.648760796f},
-std::array<float,2>{0.0911159292f, 0.172651455f},
-std::array<float,2>{0.525238156f, 0.854296923f},
-std::array<float,2>{0.666885614f, 0.0619723611f},
-std::array<float,2>{0.173761845f, 0.876977444f},
-std::array<float,2>{0.476387203f, 0.323849946f},
-std::array<float,2>{0.815714538f, 0.581344903f},
-std::array<float,2>{0.770647347f, 0.206366047f},
-std::array<float,2>{0.420292646f, 0.778309941f},
-std::array<float,2>{0.238799289f, 0.473458797f},
-std::array<float,2>{0.722172916f, 0.730974078f},
-std::array<float,2>{0.600076675f, 0.306296587f},
-std::array<float,2>{0.0149182053f, 0.518892765f},
-std::array<float,2>{0.341246754f, 0.115638629f},
-std::array<float,2>{0.904419124f, 0.940710425f},
-std::array<float,2>{0.861519158f, 0.350578159f},
-std::array<float,2>{0.455361634f, 0.616656482f},
-std::array<float,2>{0.139368445f, 0.0229578316f},
-std::array<float,2>{0.635119557f, 0.911548913f},
-std::array<float,2>{0.539970636f, 0.147703797f},
-std::array<float,2>{0.104737379f, 0.836382329f},
-std::array<float,2>{0.290510088f, 0.401565284f},
-std::array<float,2>{0.983430207f, 0.682602048f},
-std::array<float,2>{0.906530082f, 0.0895809084f},
-std::array<float,2>{0.345037669f, 0.999629736f},
-std::array<float,2>{0.0368057899f, 0.266145229f},
-std::array<float,2>{0.570928097f, 0.553556144f},
-std::array<float,2>{0.695016265f, 0.466304898f},
-std::array<float,2>{0.215188578f, 0.711647928f},
-std::array<float,2>{0.405685425f, 0.223230496f},
-std::array<float,2>{0.801306546f, 0.783882201f},
-std::array<float,2>{0.970655084f, 0.318450868f},
-std::array<float,2>{0.282935262f, 0.59268707f},
-std::array<float,2>{0.101121351f, 0.0527640358f},
-std::array<float,2>{0.534604371f, 0.886638343f},
-std::array<float,2>{0.630457401f, 0.187202618f},
-std::array<float,2>{0.132357493f, 0.844098032f},
-std::array<float,2>{0.461465806f, 0.431860417f},
-std::array<float,2>{0.871992409f, 0.647251964f},
-std::array<float,2>{0.804732203f, 0.11852961f},
-std::array<float,2>{0.394654334f, 0.950181603f},
-std::array<float,2>{0.203740716f, 0.304196656f},
-std::array<float,2>{0.701608181f, 0.531154215f},
-std::array<float,2>{0.56597358f, 0.480477452f},
-std::array<float,2>{0.0455666892f, 0.724400342f},
-std::array<float,2>{0.354484558f, 0.2145845f},
-std::array<float,2>{0.918884873f, 0.772946f},
-std::array<float,2>{0.827790916f, 0.39607957f},
-std::array<float,2>{0.483544022f, 0.678019345f},
-std::array<float,2>{0.181413069f, 0.155181915f},
-std::array<float,2>{0.660857499f, 0.833014369f},
-std::array<float,2>{0.518442988f, 0.0296876356f},
-std::array<float,2>{0.0826719031f, 0.919206619f},
-std::array<float,2>{0.26571694f, 0.355262965f},
-std::array<float,2>{0.937768281f, 0.621763349f},
-std::array<float,2>{0.89514339f, 0.234146789f},
-std::array<float,2>{0.333166242f, 0.790381372f},
-std::array<float,2>{0.00363061018f, 0.45741272f},
-std::array<float,2>{0.608868182f, 0.70839113f},
-std::array<float,2>{0.731957078f, 0.277323455f},
-std::array<float,2>{0.246098608f, 0.554876864f},
-std::array<float,2>{0.410387248f, 0.0833106861f},
-std::array<float,2>{0.779673755f, 0.985612094f},
-std::array<float,2>{0.92269057f, 0.449088216f},
-std::array<float,2>{0.362986296f, 0.700790286f},
-std::array<float,2>{0.0502715781f, 0.244415224f},
-std::array<float,2>{0.592093706f, 0.809171736f},
-std::array<float,2>{0.710407138f, 0.0737961531f},
-std::array<float,2>{0.199733689f, 0.978839517f},
-std::array<float,2>{0.388469905f, 0.265154839f},
-std::array<float,2>{0.795469344f, 0.533409715f},
-std::array<float,2>{0.85112071f, 0.138137206f},
-std::array<float,2>{0.447885215f, 0.812757015f},
-std::array<float,2>{0.145662397f, 0.382920176f},
-std::array<float,2>{0.642187297f, 0.671353221f},
-std::array<float,2>{0.562201083f, 0.373983413f},
-std::array<float,2>{0.110437676f, 0.608703852f},
-std::array<float,2>{0.306466311f, 0.00589087792f},
-std::array<float,2>{0.997579694f, 0.923314631f},
-std::array<float,2>{0.763303876f, 0.290280759f},
-std::array<float,2>{0.435466051f, 0.511776507f},
-std::array<float,2>{0.230227098f, 0.108601116f},
-std::array<float,2>{0.735144556f, 0.964523315f},
-std::array<float,2>{0.62286073f, 0.190642953f},
-std::array<float,2>{0.0246745273f, 0.758856833f},
-std::array<float,2>{0.325588018f, 0.484612316f},
-std::array<float,2>{0.87512666f, 0.736582279f},
-std::array<float,2>{0.954959333f, 0.0343484581f},
-std::array<float,2>{0.258360803f, 0.905882299f},
-std::array<float,2>{0.0735852793f, 0.32964161f},
-std::array<float,2>{0.503729939f, 0.563814282f},
-std::array<float,2>{0.681029797f, 0.419508547f},
-std::array<float,2>{0.156626537f, 0.627071381f},
-std::array<float,2>{0.495148808f, 0.169309899f},
-std::array<float,2>{0.836144745f, 0.867182732f},
-std::array<float,2>{0.988364875f, 0.277657241f},
-std::array<float,2>{0.301906049f, 0.559241354f},
-std::array<float,2>{0.118408635f, 0.0810537413f},
-std::array<float,2>{0.547575474f, 0.989271522f},
-std::array<float,2>{0.654812276f, 0.229112551f},
-std::array<float,2>{0.149420306f, 0.79604125f},
-std::array<float,2>{0.443022102f, 0.45701915f},
-std::array<float,2>{0.856670797f, 0.705672145f},
-std::array<float,2>{0.786441505f, 0.0238399412f},
-std::array<float,2>{0.375265181f, 0.91786474f},
-std::array<float,2>{0.187912464f, 0.356210828f},
-std::array<float,2>{0.714932919f, 0.61839962f},
-std::array<float,2>{0.585220695f, 0.394316763f},
-std::array<float,2>{0.0551486462f, 0.67244935f},
-std::array<float,2>{0.367383033f, 0.148887441f},
-std::array<float,2>{0.93028003f, 0.831089973f},
-std::array<float,2>{0.834106743f, 0.479786694f},
-std::array<float,2>{0.49134773f, 0.719724417f},
-std::array<float,2>{0.17089279f, 0.214970618f},
-std::array<float,2>{0.674565077f, 0.767755091f},
-std::array<float,2>{0.515322387f, 0.124526471f},
-std::array<float,2>{0.0678376555f, 0.948732018f},
-std::array<float,2>{0.255754709f, 0.299446762f},
-std::array<float,2>{0.965352774f, 0.526834309f},
-std::array<float,2>{0.887178838f, 0.182591036f},
-std::array<float,2>{0.317685753f, 0.851318061f},
-std::array<float,2>{0.0226680506f, 0.434926748f},
-std::array<float,2>{0.616044819f, 0.643944323f},
-std::array<float,2>{0.742692828f, 0.315138638f},
-std::array<float,2>{0.225533426f, 0.589706421f},
-std::array<float,2>{0.424213588f, 0.0473072231f},
-std::array<float,2>{0.755607128f, 0.89008081f},
-std::array<float,2>{0.91092968f, 0.415895373f},
-std::array<float,2>{0.351148337f, 0.629075944f},
-std::array<float,2>{0.0335876383f, 0.165029436f},
-std::array<float,2>{0.5774073f, 0.86176306f},
-std::array<float,2>{0.690083086f, 0.038129054f},
-std::array<float,2>{0.213835239f, 0.898881733f},
-std::array<float,2>{0.401777148f, 0.334945768f},
-std::array<float,2>{0.79972893f, 0.569143951f},
-std::array<float,2>{0.866174042f, 0.193334073f},
-std::array<float,2>{0.460783571f, 0.76299125f},
-std::array<float,2>{0.13384679f, 0.490615159f},
-std::array<float,2>{0.640489221f, 0.738433957f},
-std::array<float,2>{0.546773016f, 0.296607792f},
-std::array<float,2>{0.108153827f, 0.508697152f},
-std::array<float,2>{0.293878436f, 0.101676002f},
-std::array<float,2>{0.976682961f, 0.967517793f},
-std::array<float,2>{0.766024113f, 0.370638251f},
-std::array<float,2>{0.417598635f, 0.602878749f},
-std::array<float,2>{0.234958366f, 0.00221968722f},
-std::array<float,2>{0.726241589f, 0.92719841f},
-std::array<float,2>{0.597428322f, 0.134682491f},
-std::array<float,2>{0.00842431467f, 0.817009628f},
-std::array<float,2>{0.336858749f, 0.387775362f},
-std::array<float,2>{0.901344657f, 0.665326118f},
-std::array<float,2>{0.950122118f, 0.0774762183f},
-std::array<float,2>{0.274283618f, 0.983045876f},
-std::array<float,2>{0.088707529f, 0.258398682f},
-std::array<float,2>{0.53077364f, 0.536611319f},
-std::array<float,2>{0.66858381f, 0.450055093f},
-std::array<float,2>{0.178505719f, 0.698484957f},
-std::array<float,2>{0.470689833f, 0.249381915f},
-std::array<float,2>{0.818162262f, 0.806899846f},
-std::array<float,2>{0.893585622f, 0.337603748f},
-std::array<float,2>{0.328360409f, 0.570337176f},
-std::array<float,2>{0.00702979323f, 0.0445437804f},
-std::array<float,2>{0.603919625f, 0.892079592f},
-std::array<float,2>{0.727304161f, 0.16090323f},
-std::array<float,2>{0.243515089f, 0.867897451f},
-std::array<float,2>{0.408496261f, 0.409181863f},
-std::array<float,2>{0.775164187f, 0.634772003f},
-std::array<float,2>{0.823569834f, 0.0976618826f},
-std::array<float,2>{0.477578372f, 0.959872246f},
-std::array<float,2>{0.186613217f, 0.282683432f},
-std::array<float,2>{0.656366646f, 0.506407142f},
-std::array<float,2>{0.519541562f, 0.498039454f},
-std::array<float,2>{0.0795682445f, 0.745685756f},
-std::array<float,2>{0.270028383f, 0.20196192f},
-std::array<float,2>{0.944060147f, 0.757390797f},
-std::array<float,2>{0.81153816f, 0.37634638f},
-std::array<float,2>{0.392623991f, 0.656260252f},
-std::array<float,2>{0.208860666f, 0.128027484f},
-std::array<float,2>{0.698400259f, 0.827463031f},
-std::array<float,2>{0.569615722f, 0.0112361079f},
-std::array<float,2>{0.0398154408f, 0.932539463f},
-std::array<float,2>{0.356830448f, 0.362831265f},
-std::array<float,2>{0.915426731f, 0.595556259f},
-std::array<float,2>{0.976182878f, 0.237972841f},
-std::array<float,2>{0.288231403f, 0.801790774f},
-std::array<float,2>{0.0974732265f, 0.442588449f},
-std::array<float,2>{0.537221134f, 0.689723194f},
-std::array<float,2>{0.627421021f, 0.255828649f},
-std::array<float,2>{0.126910016f, 0.5408324f},
-std::array<float,2>{0.467007995f, 0.0643030852f},
-std::array<float,2>{0.869536579f, 0.97217679f},
-std::array<float,2>{0.959127009f, 0.461312741f},
-std::array<float,2>{0.261979938f, 0.718172431f},
-std::array<float,2>{0.0755293667f, 0.221119627f},
-std::array<float,2>{0.507434428f, 0.786582112f},
-std::array<float,2>{0.685231507f, 0.0917749852f},
-std::array<float,2>{0.16046147f, 0.993596911f},
-std::array<float,2>{0.496957809f, 0.272187054f},
-std::array<float,2>{0.840339184f, 0.549301803f},
-std::array<float,2>{0.761690915f, 0.141491622f},
-std::array<float,2>{0.432053328f, 0.841701925f},
-std::array<float,2>{0.231120259f, 0.404616952f},
-std::array<float,2>{0.740799427f, 0.687015057f},
-std::array<float,2>{0.618195176f, 0.347424865f},
-std::array<float,2>{0.0297752917f, 0.610316157f},
-std::array<float,2>{0.321508586f, 0.0194828101f},
-std::array<float,2>{0.880936265f, 0.908792794f},
-std::array<float,2>{0.847404182f, 0.309029937f},
-std::array<float,2>{0.451010644f, 0.521722734f},
-std::array<float,2>{0.14187102f, 0.10991554f},
-std::array<float,2>{0.647435784f, 0.942083895f},
-std::array<float,2>{0.558350742f, 0.207195297f},
-std::array<float,2>{0.113808684f, 0.774242103f},
-std::array<float,2>{0.310685486f, 0.470571339f},
-std::array<float,2>{0.994445264f, 0.726932943f},
-std::array<float,2>{0.92918402f, 0.0569655783f},
-std::array<float,2>{0.365969777f, 0.880397201f},
-std::array<float,2>{0.054359816f, 0.32739383f},
-std::array<float,2>{0.587022722f, 0.582770646f},
-std::array<float,2>{0.703384638f, 0.428667068f},
-std::array<float,2>{0.197798818f, 0.652835488f},
-std::array<float,2>{0.383580655f, 0.179193884f},
-std::array<float,2>{0.792021096f, 0.85571444f},
-std::array<float,2>{0.935687006f, 0.28770411f},
-std::array<float,2>{0.37286368f, 0.503580689f},
-std::array<float,2>{0.0615196787f, 0.0959450379f},
-std::array<float,2>{0.581402242f, 0.955798745f},
-std::array<float,2>{0.711866736f, 0.198998451f},
-std::array<float,2>{0.195095047f, 0.753670931f},
-std::array<float,2>{0.379600316f, 0.495264739f},
-std::array<float,2>{0.783193886f, 0.748608232f},
-std::array<float,2>{0.853131473f, 0.0400268808f},
-std::array<float,2>{0.441115111f, 0.898213446f},
-std::array<float,2>{0.155605808f, 0.342135221f},
-std::array<float,2>{0.649035394f, 0.574649632f},
-std::array<float,2>{0.554512143f, 0.411248267f},
-std::array<float,2>{0.123446964f, 0.637276828f},
-std::array<float,2>{0.298082829f, 0.156490043f},
-std::array<float,2>{0.986083567f, 0.874191225f},
-std::array<float,2>{0.750397325f, 0.438110858f},
-std::array<float,2>{0.427304775f, 0.69242537f},
-std::array<float,2>{0.220373258f, 0.24169296f},
-std::array<float,2>{0.749922693f, 0.800283551f},
-std::array<float,2>{0.609899461f, 0.0692038089f},
-std::array<float,2>{0.0178374555f, 0.976258159f},
-std::array<float,2>{0.315837413f, 0.25147593f},
-std::array<float,2>{0.886602938f, 0.543410182f},
-std::array<float,2>{0.962521374f, 0.132717848f},
-std::array<float,2>{0.253461868f, 0.820615709f},
-std::array<float,2>{0.0647849813f, 0.381524295f},
-std::array<float,2>{0.509119749f, 0.66123718f},
-std::array<float,2>{0.67608887f, 0.366453677f},
-std::array<float,2>{0.166648328f, 0.600926876f},
-std::array<float,2>{0.485693157f, 0.0142813772f},
-std::array<float,2>{0.830215454f, 0.934992671f},
-std::array<float,2>{0.981956124f, 0.399838179f},
-std::array<float,2>{0.291048616f, 0.6802423f},
-std::array<float,2>{0.102500714f, 0.145663455f},
-std::array<float,2>{0.542547047f, 0.838899195f},
-std::array<float,2>{0.634072661f, 0.0210040752f},
-std::array<float,2>{0.138235405f, 0.912766397f},
-std::array<float,2>{0.454735339f, 0.348775655f},
-std::array<float,2>{0.860366762f, 0.613283992f},
-std::array<float,2>{0.804291308f, 0.225677207f},
-std::array<float,2>{0.403979063f, 0.782012582f},
-std::array<float,2>{0.218199879f, 0.467600614f},
-std::array<float,2>{0.693006277f, 0.713473439f},
-std::array<float,2>{0.57258451f, 0.268872857f},
-std::array<float,2>{0.0384089127f, 0.551864982f},
-std::array<float,2>{0.346613854f, 0.0866758525f},
-std::array<float,2>{0.90861243f, 0.996567547f},
-std::array<float,2>{0.814236462f, 0.321199805f},
-std::array<float,2>{0.474361718f, 0.578273356f},
-std::array<float,2>{0.174457803f, 0.0588741787f},
-std::array<float,2>{0.664490581f, 0.87525177f},
-std::array<float,2>{0.525922179f, 0.173935726f},
-std::array<float,2>{0.0919634923f, 0.852047086f},
-std::array<float,2>{0.279664814f, 0.425062507f},
-std::array<float,2>{0.945416391f, 0.650501013f},
-std::array<float,2>{0.903519928f, 0.113812998f},
-std::array<float,2>{0.342734009f, 0.939245701f},
-std::array<float,2>{0.0128546292f, 0.307448745f},
-std::array<float,2>{0.598327935f, 0.516866326f},
-std::array<float,2>{0.718789577f, 0.474911362f},
-std::array<float,2>{0.241916642f, 0.732589304f},
-std::array<float,2>{0.418479323f, 0.205067605f},
-std::array<float,2>{0.772659361f, 0.781009316f},
-std::array<float,2>{0.939847469f, 0.35329774f},
-std::array<float,2>{0.269430012f, 0.62435472f},
-std::array<float,2>{0.0852520987f, 0.0279162806f},
-std::array<float,2>{0.516599953f, 0.921496809f},
-std::array<float,2>{0.663891375f, 0.154155016f},
-std::array<float,2>{0.183545873f, 0.835093856f},
-std::array<float,2>{0.481345654f, 0.398285538f},
-std::array<float,2>{0.824725986f, 0.676965714f},
-std::array<float,2>{0.778785646f, 0.0851805583f},
-std::array<float,2>{0.413885474f, 0.988047421f},
-std::array<float,2>{0.249367818f, 0.274610966f},
-std::array<float,2>{0.73405993f, 0.556739211f},
-std::array<float,2>{0.605883658f, 0.460851014f},
-std::array<float,2>{0.001927773f, 0.710611522f},
-std::array<float,2>{0.334831119f, 0.232059598f},
-std::array<float,2>{0.896981716f, 0.79196322f},
-std::array<float,2>{0.873630404f, 0.4314273f},
-std::array<float,2>{0.462909639f, 0.645820916f},
-std::array<float,2>{0.130022541f, 0.185268849f},
-std::array<float,2>{0.631430328f, 0.847629309f},
-std::array<float,2>{0.53215307f, 0.0515431874f},
-std::array<float,2>{0.0981031433f, 0.883456469f},
-std::array<float,2>{0.284348726f, 0.316593915f},
-std::array<float,2>{0.970938385f, 0.590892971f},
-std::array<float,2>{0.921750665f, 0.211256281f},
-std::array<float,2>{0.353458554f, 0.77134639f},
-std::array<float,2>{0.0439795405f, 0.482933909f},
-std::array<float,2>{0.564102709f, 0.725747526f},
-std::array<float,2>{0.699422896f, 0.302296847f},
-std::array<float,2>{0.206474528f, 0.529118121f},
-std::array<float,2>{0.396851122f, 0.120046228f},
-std::array<float,2>{0.808434308f, 0.953001916f},
-std::array<float,2>{0.877179086f, 0.48802647f},
-std::array<float,2>{0.326316446f, 0.735526443f},
-std::array<float,2>{0.0256441683f, 0.189340711f},
-std::array<float,2>{0.624238491f, 0.760719001f},
-std::array<float,2>{0.736885846f, 0.105722897f},
-std::array<float,2>{0.226674616f, 0.961380124f},
-std::array<float,2>{0.436696023f, 0.292358488f},
-std::array<float,2>{0.764798403f, 0.515247047f},
-std::array<float,2>{0.839248002f, 0.17117919f},
-std::array<float,2>{0.492373317f, 0.864637434f},
-std::array<float,2>{0.160110936f, 0.421662599f},
-std::array<float,2>{0.683124483f, 0.625200152f},
-std::array<float,2>{0.501849353f, 0.331610858f},
-std::array<float,2>{0.0711698011f, 0.56599772f},
-std::array<float,2>{0.26095584f, 0.0314797424f},
-std::array<float,2>{0.956539154f, 0.904136896f},
-std::array<float,2>{0.793340266f, 0.262130678f},
-std::array<float,2>{0.389915913f, 0.533021867f},
-std::array<float,2>{0.202338189f, 0.0718521699f},
-std::array<float,2>{0.707223356f, 0.978006542f},
-std::array<float,2>{0.590458035f, 0.242400423f},
-std::array<float,2>{0.047810901f, 0.811008632f},
-std::array<float,2>{0.360581309f, 0.446996242f},
-std::array<float,2>{0.92386359f, 0.702643752f},
-std::array<float,2>{0.998577714f, 0.00490786787f},
-std::array<float,2>{0.307210237f, 0.924658298f},
-std::array<float,2>{0.111999236f, 0.371986777f},
-std::array<float,2>{0.558740199f, 0.606797457f},
-std::array<float,2>{0.643554389f, 0.385617703f},
-std::array<float,2>{0.146918014f, 0.669342935f},
-std::array<float,2>{0.446526945f, 0.139558971f},
-std::array<float,2>{0.849468112f, 0.814867377f},
-std::array<float,2>{0.957103193f, 0.271884263f},
-std::array<float,2>{0.264031321f, 0.549518585f},
-std::array<float,2>{0.0777766854f, 0.091046758f},
-std::array<float,2>{0.504713237f, 0.993777454f},
-std::array<float,2>{0.68667984f, 0.221355587f},
-std::array<float,2>{0.163299769f, 0.78678596f},
-std::array<float,2>{0.498723418f, 0.461591095f},
-std::array<float,2>{0.843156755f, 0.718318343f},
-std::array<float,2>{0.75953424f, 0.0186011977f},
-std::array<float,2>{0.431310236f, 0.90849793f},
-std::array<float,2>{0.232525602f, 0.346817225f},
-std::array<float,2>{0.739347756f, 0.609778285f},
-std::array<float,2>{0.619158566f, 0.404963851f},
-std::array<float,2>{0.0281403288f, 0.686591089f},
-std::array<float,2>{0.322695225f, 0.14110285f},
-std::array<float,2>{0.879827321f, 0.84128195f},
-std::array<float,2>{0.845432699f, 0.47019276f},
-std::array<float,2>{0.451528549f, 0.72732383f},
-std::array<float,2>{0.142825276f, 0.20762679f},
-std::array<float,2>{0.645024002f, 0.773515642f},
-std::array<float,2>{0.554888427f, 0.109588765f},
-std::array<float,2>{0.116150022f, 0.941479206f},
-std::array<float,2>{0.31027782f, 0.309191138f},
-std::array<float,2>{0.9923352f, 0.522043884f},
-std::array<float,2>{0.92627877f, 0.179677725f},
-std::array<float,2>{0.364001811f, 0.856049716f},
-std::array<float,2>{0.0524410047f, 0.428120613f},
-std::array<float,2>{0.589192569f, 0.652794838f},
-std::array<float,2>{0.706427395f, 0.327791303f},
-std::array<float,2>{0.196578801f, 0.582321942f},
-std::array<float,2>{0.386657327f, 0.0571931675f},
-std::array<float,2>{0.789398968f, 0.880001187f},
-std::array<float,2>{0.892303109f, 0.409717262f},
-std::array<float,2>{0.331650168f, 0.635387957f},
-std::array<float,2>{0.00434828922f, 0.160472363f},
-std::array<float,2>{0.602438807f, 0.867553592f},
-std::array<float,2>{0.728754878f, 0.0440055765f},
-std::array<float,2>{0.245698944f, 0.892290294f},
-std::array<float,2>{0.407892704f, 0.337250799f},
-std::array<float,2>{0.775514543f, 0.570868373f},
-std::array<float,2>{0.82083869f, 0.20142068f},
-std::array<float,2>{0.478694677f, 0.757247925f},
-std::array<float,2>{0.183925718f, 0.497493327f},
-std::array<float,2>{0.659623027f, 0.745521724f},
-std::array<float,2>{0.5232476f, 0.282810658f},
-std::array<float,2>{0.080880858f, 0.505862832f},
-std::array<float,2>{0.273278028f, 0.0984712169f},
-std::array<float,2>{0.941711843f, 0.959379017f},
-std::array<float,2>{0.810499907f, 0.362642318f},
-std::array<float,2>{0.392050862f, 0.595153153f},
-std::array<float,2>{0.210902676f, 0.0107626719f},
-std::array<float,2>{0.696513176f, 0.932055831f},
-std::array<float,2>{0.567216218f, 0.128487334f},
-std::array<float,2>{0.0416183174f, 0.827902794f},
-std::array<float,2>{0.357465178f, 0.376836419f},
-std::array<float,2>{0.91612047f, 0.656841218f},
-std::array<float,2>{0.974143386f, 0.0635705441f},
-std::array<float,2>{0.285566092f, 0.97200495f},
-std::array<float,2>{0.0941902623f, 0.255030602f},
-std::array<float,2>{0.535819948f, 0.540221751f},
-std::array<float,2>{0.625687897f, 0.442876637f},
-std::array<float,2>{0.12781103f, 0.690251887f},
-std::array<float,2>{0.466220319f, 0.237392992f},
-std::array<float,2>{0.86862582f, 0.802658617f},
-std::array<float,2>{0.913500905f, 0.334260434f},
-std::array<float,2>{0.349309832f, 0.568760216f},
-std::array<float,2>{0.0331479199f, 0.0389008336f},
-std::array<float,2>{0.575982511f, 0.899215996f},
-std::array<float,2>{0.688841224f, 0.164367855f},
-std::array<float,2>{0.212806046f, 0.862164259f},
-std::array<float,2>{0.398670882f, 0.415213138f},
-std::array<float,2>{0.798237383f, 0.629548073f},
-std::array<float,2>{0.86388123f, 0.102318928f},
-std::array<float,2>{0.45809558f, 0.967088819f},
-std::array<float,2>{0.135925606f, 0.296232879f},
-std::array<float,2>{0.637568355f, 0.508270085f},
-std::array<float,2>{0.542993426f, 0.490985692f},
-std::array<float,2>{0.105648004f, 0.738980889f},
-std::array<float,2>{0.295583874f, 0.192444086f},
-std::array<float,2>{0.979272544f, 0.763405263f},
-std::array<float,2>{0.768461466f, 0.388302177f},
-std::array<float,2>{0.414510816f, 0.665995061f},
-std::array<float,2>{0.237058669f, 0.134074613f},
-std::array<float,2>{0.723522902f, 0.816407442f},
-std::array<float,2>{0.594914138f, 0.00292187021f},
-std::array<float,2>{0.0113421744f, 0.927377164f},
-std::array<float,2>{0.338782251f, 0.370450437f},
-std::array<float,2>{0.899050891f, 0.603335261f},
-std::array<float,2>{0.952241302f, 0.249544188f},
-std::array<float,2>{0.2756643f, 0.807459593f},
-std::array<float,2>{0.0862818062f, 0.449267268f},
-std::array<float,2>{0.529144764f, 0.698800087f},
-std::array<float,2>{0.671516538f, 0.258153051f},
-std::array<float,2>{0.176507175f, 0.536767423f},
-std::array<float,2>{0.471197277f, 0.0778120384f},
-std::array<float,2>{0.819395661f, 0.982447088f},
-std::array<float,2>{0.990685999f, 0.456127554f},
-std::array<float,2>{0.30419457f, 0.705262423f},
-std::array<float,2>{0.119196802f, 0.2287765f},
-std::array<float,2>{0.549700618f, 0.796482861f},
-std::array<float,2>{0.652461588f, 0.0803482085f},
-std::array<float,2>{0.151886195f, 0.990107656f},
-std::array<float,2>{0.444478631f, 0.277994365f},
-std::array<float,2>{0.858365238f, 0.558926761f},
-std::array<float,2>{0.787418246f, 0.149267018f},
-std::array<float,2>{0.377135515f, 0.831685305f},
-std::array<float,2>{0.189689592f, 0.393674195f},
-std::array<float,2>{0.717012703f, 0.672159016f},
-std::array<float,2>{0.583360612f, 0.355502158f},
-std::array<float,2>{0.0566763468f, 0.618818045f},
-std::array<float,2>{0.370540321f, 0.0240359381f},
-std::array<float,2>{0.932575822f, 0.917063117f},
-std::array<float,2>{0.83264643f, 0.298951268f},
-std::array<float,2>{0.488807648f, 0.526907384f},
-std::array<float,2>{0.168162197f, 0.124425516f},
-std::array<float,2>{0.673316181f, 0.948441505f},
-std::array<float,2>{0.512871742f, 0.21561572f},
-std::array<float,2>{0.070166342f, 0.768426538f},
-std::array<float,2>{0.257799953f, 0.480254143f},
-std::array<float,2>{0.967987537f, 0.719097376f},
-std::array<float,2>{0.890535712f, 0.0474087037f},
-std::array<float,2>{0.320288897f, 0.890337586f},
-std::array<float,2>{0.0211953633f, 0.314853638f},
-std::array<float,2>{0.613584399f, 0.589050233f},
-std::array<float,2>{0.745482862f, 0.435517877f},
-std::array<float,2>{0.223486215f, 0.644470334f},
-std::array<float,2>{0.42327401f, 0.181800798f},
-std::array<float,2>{0.757255197f, 0.850907505f},
-std::array<float,2>{0.875513911f, 0.292562753f},
-std::array<float,2>{0.325757384f, 0.51503706f},
-std::array<float,2>{0.0253290497f, 0.106009766f},
-std::array<float,2>{0.622428119f, 0.961769223f},
-std::array<float,2>{0.734387815f, 0.188815325f},
-std::array<float,2>{0.229829282f, 0.759901226f},
-std::array<float,2>{0.434666455f, 0.487563014f},
-std::array<float,2>{0.762958169f, 0.736312449f},
-std::array<float,2>{0.836813033f, 0.0318904519f},
-std::array<float,2>{0.496091723f, 0.903451622f},
-std::array<float,2>{0.156988069f, 0.331350148f},
-std::array<float,2>{0.681164443f, 0.565603018f},
-std::array<float,2>{0.503138363f, 0.420973599f},
-std::array<float,2>{0.0737529024f, 0.62574476f},
-std::array<float,2>{0.257835329f, 0.171605676f},
-std::array<float,2>{0.954577744f, 0.864934385f},
-std::array<float,2>{0.79518038f, 0.446701765f},
-std::array<float,2>{0.387951106f, 0.702413023f},
-std::array<float,2>{0.199659422f, 0.243161306f},
-std::array<float,2>{0.710797966f, 0.811155498f},
-std::array<float,2>{0.592363596f, 0.071730718f},
-std::array<float,2>{0.0503154546f, 0.978151023f},
-std::array<float,2>{0.362779647f, 0.26224646f},
-std::array<float,2>{0.92199868f, 0.532567739f},
-std::array<float,2>{0.997209728f, 0.138806656f},
-std::array<float,2>{0.305729866f, 0.814962387f},
-std::array<float,2>{0.111038312f, 0.385192424f},
-std::array<float,2>{0.56199652f, 0.669750392f},
-std::array<float,2>{0.64179337f, 0.371405989f},
-std::array<float,2>{0.14638716f, 0.607305229f},
-std::array<float,2>{0.44734624f, 0.00561377686f},
-std::array<float,2>{0.850598097f, 0.924179435f},
-std::array<float,2>{0.93824476f, 0.39750585f},
-std::array<float,2>{0.266561508f, 0.67747736f},
-std::array<float,2>{0.0822949782f, 0.153357759f},
-std::array<float,2>{0.517659724f, 0.835485697f},
-std::array<float,2>{0.660373628f, 0.0275211744f},
-std::array<float,2>{0.180794656f, 0.921115875f},
-std::array<float,2>{0.484131277f, 0.352545083f},
-std::array<float,2>{0.827247381f, 0.624858558f},
-std::array<float,2>{0.779914677f, 0.231651679f},
-std::array<float,2>{0.410872072f, 0.79128778f},
-std::array<float,2>{0.247038066f, 0.459988147f},
-std::array<float,2>{0.731876254f, 0.710400164f},
-std::array<float,2>{0.60910964f, 0.275071919f},
-std::array<float,2>{0.00336033641f, 0.557364702f},
-std::array<float,2>{0.333505988f, 0.0858307853f},
-std::array<float,2>{0.894731164f, 0.98737359f},
-std::array<float,2>{0.871295094f, 0.31701681f},
-std::array<float,2>{0.461202532f, 0.591596425f},
-std::array<float,2>{0.132001594f, 0.0509588122f},
-std::array<float,2>{0.630175829f, 0.883105636f},
-std::array<float,2>{0.535106599f, 0.185020074f},
-std::array<float,2>{0.100641295f, 0.846896648f},
-std::array<float,2>{0.282510251f, 0.431000322f},
-std::array<float,2>{0.970172048f, 0.646454453f},
-std::array<float,2>{0.918001592f, 0.119442895f},
-std::array<float,2>{0.353534311f, 0.952185273f},
-std::array<float,2>{0.0449352749f, 0.302146077f},
-std::array<float,2>{0.565771937f, 0.528475821f},
-std::array<float,2>{0.701826036f, 0.482795656f},
-std::array<float,2>{0.203376219f, 0.726182759f},
-std::array<float,2>{0.395494998f, 0.211798921f},
-std::array<float,2>{0.805345356f, 0.770604849f},
-std::array<float,2>{0.984220922f, 0.349415928f},
-std::array<float,2>{0.290620476f, 0.613997221f},
-std::array<float,2>{0.105031081f, 0.0207821745f},
-std::array<float,2>{0.539126992f, 0.912414432f},
-std::array<float,2>{0.635666549f, 0.14600119f},
-std::array<float,2>{0.139135644f, 0.839359701f},
-std::array<float,2>{0.45590663f, 0.399985731f},
-std::array<float,2>{0.861950934f, 0.67974484f},
-std::array<float,2>{0.800877988f, 0.0860318765f},
-std::array<float,2>{0.405893922f, 0.996707559f},
-std::array<float,2>{0.215481415f, 0.269110292f},
-std::array<float,2>{0.694671214f, 0.552269697f},
-std::array<float,2>{0.570684254f, 0.466864556f},
-std::array<float,2>{0.0365678817f, 0.713191748f},
-std::array<float,2>{0.345351607f, 0.226329699f},
-std::array<float,2>{0.907126367f, 0.781440139f},
-std::array<float,2>{0.815936923f, 0.425479501f},
-std::array<float,2>{0.475945324f, 0.651126444f},
-std::array<float,2>{0.173106074f, 0.174634233f},
-std::array<float,2>{0.666162789f, 0.852326393f},
-std::array<float,2>{0.524861097f, 0.0593344755f},
-std::array<float,2>{0.0917311534f, 0.875593245f},
-std::array<float,2>{0.278452367f, 0.320733428f},
-std::array<float,2>{0.94735831f, 0.578837872f},
-std::array<float,2>{0.904843211f, 0.204244405f},
-std::array<float,2>{0.341529787f, 0.780333161f},
-std::array<float,2>{0.0155307045f, 0.475578606f},
-std::array<float,2>{0.600462615f, 0.732960165f},
-std::array<float,2>{0.722128689f, 0.306887239f},
-std::array<float,2>{0.238704294f, 0.517262518f},
-std::array<float,2>{0.420426935f, 0.113324039f},
-std::array<float,2>{0.771166265f, 0.938865721f},
-std::array<float,2>{0.934939802f, 0.495748371f},
-std::array<float,2>{0.374327093f, 0.748129725f},
-std::array<float,2>{0.0603052825f, 0.198456123f},
-std::array<float,2>{0.579421282f, 0.753387451f},
-std::array<float,2>{0.713684857f, 0.0963564366f},
-std::array<float,2>{0.191683665f, 0.955443323f},
-std::array<float,2>{0.382427275f, 0.287545621f},
-std::array<float,2>{0.783777475f, 0.503391027f},
-std::array<float,2>{0.854209542f, 0.156763524f},
-std::array<float,2>{0.438625455f, 0.874763429f},
-std::array<float,2>{0.152908638f, 0.411773741f},
-std::array<float,2>{0.652194858f, 0.636805952f},
-std::array<float,2>{0.552594304f, 0.342563957f},
-std::array<float,2>{0.122684374f, 0.574953377f},
-std::array<float,2>{0.299047768f, 0.0393929183f},
-std::array<float,2>{0.986874282f, 0.89785254f},
-std::array<float,2>{0.752905428f, 0.251281291f},
-std::array<float,2>{0.428616226f, 0.543854952f},
-std::array<float,2>{0.222316667f, 0.0684127957f},
-std::array<float,2>{0.747972488f, 0.975818574f},
-std::array<float,2>{0.612685144f, 0.241998479f},
-std::array<float,2>{0.0170774087f, 0.80042547f},
-std::array<float,2>{0.313330203f, 0.437861353f},
-std::array<float,2>{0.883363903f, 0.693000913f},
-std::array<float,2>{0.963181138f, 0.0139017534f},
-std::array<float,2>{0.250634044f, 0.935347497f},
-std::array<float,2>{0.0638911203f, 0.366934508f},
-std::array<float,2>{0.509837747f, 0.601091564f},
-std::array<float,2>{0.679595113f, 0.381088018f},
-std::array<float,2>{0.165356442f, 0.661940694f},
-std::array<float,2>{0.48804453f, 0.132319376f},
-std::array<float,2>{0.828604937f, 0.820896089f},
-std::array<float,2>{0.995117068f, 0.31219849f},
-std::array<float,2>{0.311045825f, 0.51998353f},
-std::array<float,2>{0.11347416f, 0.112863302f},
-std::array<float,2>{0.557994246f, 0.944324553f},
-std::array<float,2>{0.646631658f, 0.209725708f},
-std::array<float,2>{0.142408848f, 0.776293695f},
-std::array<float,2>{0.450263977f, 0.47240451f},
-std::array<float,2>{0.846886814f, 0.72878629f},
-std::array<float,2>{0.792839289f, 0.0550920218f},
-std::array<float,2>{0.382846266f, 0.882667959f},
-std::array<float,2>{0.197613463f, 0.325633287f},
-std::array<float,2>{0.70399791f, 0.585796833f},
-std::array<float,2>{0.587437212f, 0.427001268f},
-std::array<float,2>{0.0538831055f, 0.654553831f},
-std::array<float,2>{0.365490973f, 0.176229835f},
-std::array<float,2>{0.929250717f, 0.858621716f},
-std::array<float,2>{0.840245366f, 0.463317961f},
-std::array<float,2>{0.496212184f, 0.716673493f},
-std::array<float,2>{0.160674632f, 0.218931913f},
-std::array<float,2>{0.684589565f, 0.787397206f},
-std::array<float,2>{0.507267594f, 0.0926075354f},
-std::array<float,2>{0.0759157985f, 0.995322883f},
-std::array<float,2>{0.262223691f, 0.26992768f},
-std::array<float,2>{0.959903896f, 0.547866404f},
-std::array<float,2>{0.881587625f, 0.143157393f},
-std::array<float,2>{0.322079837f, 0.841979563f},
-std::array<float,2>{0.0301188678f, 0.402419686f},
-std::array<float,2>{0.619049788f, 0.684656799f},
-std::array<float,2>{0.740686536f, 0.34508875f},
-std::array<float,2>{0.230531573f, 0.611868978f},
-std::array<float,2>{0.432470113f, 0.0166004412f},
-std::array<float,2>{0.760755241f, 0.906978905f},
-std::array<float,2>{0.915746391f, 0.378797323f},
-std::array<float,2>{0.357311636f, 0.660007715f},
-std::array<float,2>{0.0391017199f, 0.126835451f},
-std::array<float,2>{0.570228279f, 0.825949669f},
-std::array<float,2>{0.699122548f, 0.00842609629f},
-std::array<float,2>{0.208184943f, 0.929841816f},
-std::array<float,2>{0.393357068f, 0.360648066f},
-std::array<float,2>{0.812410593f, 0.59719938f},
-std::array<float,2>{0.869902432f, 0.235466257f},
-std::array<float,2>{0.467624933f, 0.803922355f},
-std::array<float,2>{0.126220226f, 0.443806201f},
-std::array<float,2>{0.627910256f, 0.687559187f},
-std::array<float,2>{0.537738323f, 0.256894916f},
-std::array<float,2>{0.0968719423f, 0.541274965f},
-std::array<float,2>{0.288697779f, 0.0649985671f},
-std::array<float,2>{0.976006925f, 0.969776034f},
-std::array<float,2>{0.774497688f, 0.338469684f},
-std::array<float,2>{0.408768088f, 0.573457658f},
-std::array<float,2>{0.24402681f, 0.0462525524f},
-std::array<float,2>{0.726702511f, 0.893296063f},
-std::array<float,2>{0.604486406f, 0.163923517f},
-std::array<float,2>{0.00735347625f, 0.869624555f},
-std::array<float,2>{0.328910291f, 0.406378031f},
-std::array<float,2>{0.894147396f, 0.633944213f},
-std::array<float,2>{0.943689704f, 0.100214668f},
-std::array<float,2>{0.269855797f, 0.957238972f},
-std::array<float,2>{0.0799321085f, 0.284582853f},
-std::array<float,2>{0.520195603f, 0.504474878f},
-std::array<float,2>{0.656964064f, 0.498409569f},
-std::array<float,2>{0.187213227f, 0.742259562f},
-std::array<float,2>{0.478239119f, 0.199901447f},
-std::array<float,2>{0.824040651f, 0.75549376f},
-std::array<float,2>{0.900432289f, 0.368090123f},
-std::array<float,2>{0.336245835f, 0.604022026f},
-std::array<float,2>{0.00821043644f, 0.00190991326f},
-std::array<float,2>{0.596989274f, 0.928934157f},
-std::array<float,2>{0.725600421f, 0.136272997f},
-std::array<float,2>{0.234810472f, 0.819796741f},
-std::array<float,2>{0.417331994f, 0.389762849f},
-std::array<float,2>{0.766475856f, 0.667343259f},
-std::array<float,2>{0.81758678f, 0.0746752322f},
-std::array<float,2>{0.469834328f, 0.980684459f},
-std::array<float,2>{0.177886531f, 0.261357605f},
-std::array<float,2>{0.6683864f, 0.537924409f},
-std::array<float,2>{0.530696869f, 0.45231089f},
-std::array<float,2>{0.0880730227f, 0.696211278f},
-std::array<float,2>{0.27384305f, 0.247612059f},
-std::array<float,2>{0.949543715f, 0.806176186f},
-std::array<float,2>{0.799179673f, 0.416389942f},
-std::array<float,2>{0.402338266f, 0.632083058f},
-std::array<float,2>{0.213353962f, 0.166344449f},
-std::array<float,2>{0.689927161f, 0.860005498f},
-std::array<float,2>{0.577858746f, 0.0355159082f},
-std::array<float,2>{0.0337117836f, 0.90083617f},
-std::array<float,2>{0.350921959f, 0.333256871f},
-std::array<float,2>{0.910472095f, 0.568169594f},
-std::array<float,2>{0.977253199f, 0.193674296f},
-std::array<float,2>{0.293376356f, 0.764148235f},
-std::array<float,2>{0.107889205f, 0.489128083f},
-std::array<float,2>{0.546190679f, 0.74181515f},
-std::array<float,2>{0.639711201f, 0.294899583f},
-std::array<float,2>{0.134671524f, 0.510106444f},
-std::array<float,2>{0.460336357f, 0.104719609f},
-std::array<float,2>{0.865699708f, 0.965677023f},
-std::array<float,2>{0.964996576f, 0.478403836f},
-std::array<float,2>{0.254889607f, 0.721295118f},
-std::array<float,2>{0.0679971427f, 0.217725351f},
-std::array<float,2>{0.515007496f, 0.766443849f},
-std::array<float,2>{0.674152911f, 0.122639723f},
-std::array<float,2>{0.170050114f, 0.946441174f},
-std::array<float,2>{0.492054164f, 0.298382461f},
-std::array<float,2>{0.83460623f, 0.523932457f},
-std::array<float,2>{0.754979253f, 0.180774331f},
-std::array<float,2>{0.424323887f, 0.847919464f},
-std::array<float,2>{0.225027293f, 0.437169284f},
-std::array<float,2>{0.742533803f, 0.640876234f},
-std::array<float,2>{0.615311801f, 0.314313442f},
-std::array<float,2>{0.0231791642f, 0.587848186f},
-std::array<float,2>{0.318246186f, 0.0507696122f},
-std::array<float,2>{0.887315035f, 0.886768758f},
-std::array<float,2>{0.857309997f, 0.280980289f},
-std::array<float,2>{0.442631155f, 0.560668409f},
-std::array<float,2>{0.150315866f, 0.0786984041f},
-std::array<float,2>{0.654459536f, 0.991741717f},
-std::array<float,2>{0.546963811f, 0.226905778f},
-std::array<float,2>{0.119109958f, 0.794762135f},
-std::array<float,2>{0.302676111f, 0.453664511f},
-std::array<float,2>{0.989207327f, 0.704530239f},
-std::array<float,2>{0.92971915f, 0.0259255599f},
-std::array<float,2>{0.368069291f, 0.914745867f},
-std::array<float,2>{0.055303812f, 0.35759601f},
-std::array<float,2>{0.58581537f, 0.621088386f},
-std::array<float,2>{0.715448976f, 0.391323656f},
-std::array<float,2>{0.188390896f, 0.673878491f},
-std::array<float,2>{0.375780284f, 0.15132159f},
-std::array<float,2>{0.786733627f, 0.829134524f},
-std::array<float,2>{0.924450397f, 0.264809161f},
-std::array<float,2>{0.361029863f, 0.533907831f},
-std::array<float,2>{0.047205057f, 0.0733409971f},
-std::array<float,2>{0.58996731f, 0.979115427f},
-std::array<float,2>{0.707967103f, 0.244892567f},
-std::array<float,2>{0.202909499f, 0.808794737f},
-std::array<float,2>{0.390165269f, 0.448484868f},
-std::array<float,2>{0.793626428f, 0.700258613f},
-std::array<float,2>{0.848789275f, 0.00654746732f},
-std::array<float,2>{0.447021574f, 0.923687279f},
-std::array<float,2>{0.147310361f, 0.373151273f},
-std::array<float,2>{0.642612159f, 0.609200656f},
-std::array<float,2>{0.559094787f, 0.383785158f},
-std::array<float,2>{0.111334346f, 0.671577513f},
-std::array<float,2>{0.306970537f, 0.138591185f},
-std::array<float,2>{0.998357952f, 0.813040614f},
-std::array<float,2>{0.765357554f, 0.485270679f},
-std::array<float,2>{0.437044472f, 0.736962736f},
-std::array<float,2>{0.227078453f, 0.190981686f},
-std::array<float,2>{0.736485779f, 0.759406626f},
-std::array<float,2>{0.624834418f, 0.109226391f},
-std::array<float,2>{0.0262567643f, 0.964031756f},
-std::array<float,2>{0.327130824f, 0.290543348f},
-std::array<float,2>{0.877709866f, 0.51224035f},
-std::array<float,2>{0.957011461f, 0.169508293f},
-std::array<float,2>{0.261233121f, 0.866655827f},
-std::array<float,2>{0.0706852376f, 0.41925776f},
-std::array<float,2>{0.501071393f, 0.627547324f},
-std::array<float,2>{0.682789803f, 0.329176515f},
-std::array<float,2>{0.159459963f, 0.564164877f},
-std::array<float,2>{0.492900074f, 0.0351238549f},
-std::array<float,2>{0.839657664f, 0.905425191f},
-std::array<float,2>{0.971575022f, 0.432584792f},
-std::array<float,2>{0.28484574f, 0.646610796f},
-std::array<float,2>{0.0984658971f, 0.186631158f},
-std::array<float,2>{0.531714141f, 0.844532907f},
-std::array<float,2>{0.63117069f, 0.0536492467f},
-std::array<float,2>{0.130460009f, 0.886198163f},
-std::array<float,2>{0.463735908f, 0.31909129f},
-std::array<float,2>{0.873353004f, 0.591832757f},
-std::array<float,2>{0.808072269f, 0.214350596f},
-std::array<float,2>{0.397212416f, 0.773333073f},
-std::array<float,2>{0.206905082f, 0.481105119f},
-std::array<float,2>{0.700121582f, 0.723785341f},
-std::array<float,2>{0.563707948f, 0.304523557f},
-std::array<float,2>{0.0447625369f, 0.530389249f},
-std::array<float,2>{0.352934718f, 0.118756957f},
-std::array<float,2>{0.921004593f, 0.949616551f},
-std::array<float,2>{0.824234784f, 0.354934931f},
-std::array<float,2>{0.480889142f, 0.621354938f},
-std::array<float,2>{0.182633862f, 0.0301922429f},
-std::array<float,2>{0.663524985f, 0.919522464f},
-std::array<float,2>{0.51573956f, 0.154417798f},
-std::array<float,2>{0.0854605436f, 0.833965003f},
-std::array<float,2>{0.269004345f, 0.395657867f},
-std::array<float,2>{0.940024793f, 0.678382516f},
-std::array<float,2>{0.896597922f, 0.0838339999f},
-std::array<float,2>{0.334092826f, 0.98604089f},
-std::array<float,2>{0.00143806764f, 0.27666837f},
-std::array<float,2>{0.606346369f, 0.555475235f},
-std::array<float,2>{0.73377949f, 0.457642317f},
-std::array<float,2>{0.249834925f, 0.708859742f},
-std::array<float,2>{0.413299561f, 0.233610153f},
-std::array<float,2>{0.778989494f, 0.790821135f},
-std::array<float,2>{0.945997536f, 0.323320776f},
-std::array<float,2>{0.279884905f, 0.58172375f},
-std::array<float,2>{0.0923067033f, 0.0623705462f},
-std::array<float,2>{0.525629878f, 0.877752841f},
-std::array<float,2>{0.664970875f, 0.172018141f},
-std::array<float,2>{0.1742616f, 0.85360682f},
-std::array<float,2>{0.473654002f, 0.422341347f},
-std::array<float,2>{0.813926518f, 0.649238884f},
-std::array<float,2>{0.773349643f, 0.115752809f},
-std::array<float,2>{0.418027848f, 0.941369474f},
-std::array<float,2>{0.241314828f, 0.306066126f},
-std::array<float,2>{0.719275713f, 0.519080639f},
-std::array<float,2>{0.59795177f, 0.472860754f},
-std::array<float,2>{0.0136089176f, 0.730788529f},
-std::array<float,2>{0.342246562f, 0.206790105f},
-std::array<float,2>{0.903953969f, 0.77767998f},
-std::array<float,2>{0.861195385f, 0.402068853f},
-std::array<float,2>{0.454466134f, 0.681675255f},
-std::array<float,2>{0.138054803f, 0.147949859f},
-std::array<float,2>{0.634479523f, 0.836860716f},
-std::array<float,2>{0.542366028f, 0.0229314249f},
-std::array<float,2>{0.10172113f, 0.912008822f},
-std::array<float,2>{0.291517705f, 0.350084752f},
-std::array<float,2>{0.981772244f, 0.616990983f},
-std::array<float,2>{0.908995032f, 0.223077625f},
-std::array<float,2>{0.346185058f, 0.783570647f},
-std::array<float,2>{0.0390606411f, 0.46649754f},
-std::array<float,2>{0.573138475f, 0.711324632f},
-std::array<float,2>{0.692456961f, 0.265865594f},
-std::array<float,2>{0.218616143f, 0.552958727f},
-std::array<float,2>{0.403756857f, 0.0889552459f},
-std::array<float,2>{0.803806067f, 0.99912703f},
-std::array<float,2>{0.88598913f, 0.44065243f},
-std::array<float,2>{0.316231728f, 0.693943501f},
-std::array<float,2>{0.0184198078f, 0.238503382f},
-std::array<float,2>{0.60959667f, 0.797739983f},
-std::array<float,2>{0.749416709f, 0.0674102753f},
-std::array<float,2>{0.21986559f, 0.972750306f},
-std::array<float,2>{0.426805943f, 0.25314638f},
-std::array<float,2>{0.750677049f, 0.545659065f},
-std::array<float,2>{0.830863297f, 0.129989877f},
-std::array<float,2>{0.485988945f, 0.823081017f},
-std::array<float,2>{0.166476682f, 0.379808217f},
-std::array<float,2>{0.676614821f, 0.663794041f},
-std::array<float,2>{0.509527385f, 0.364984959f},
-std::array<float,2>{0.0653733388f, 0.59909153f},
-std::array<float,2>{0.253027201f, 0.0130376779f},
-std::array<float,2>{0.962303698f, 0.936422288f},
-std::array<float,2>{0.782616138f, 0.286264658f},
-std::array<float,2>{0.379170448f, 0.500182509f},
-std::array<float,2>{0.194339067f, 0.0943069309f},
-std::array<float,2>{0.711074471f, 0.95480907f},
-std::array<float,2>{0.581597626f, 0.19559665f},
-std::array<float,2>{0.0606475323f, 0.751352966f},
-std::array<float,2>{0.372113615f, 0.493288726f},
-std::array<float,2>{0.93633908f, 0.746486306f},
-std::array<float,2>{0.985434651f, 0.0415835381f},
-std::array<float,2>{0.298579276f, 0.896481097f},
-std::array<float,2>{0.123649493f, 0.34107253f},
-std::array<float,2>{0.553909659f, 0.577417433f},
-std::array<float,2>{0.648441553f, 0.413382411f},
-std::array<float,2>{0.156036362f, 0.638989508f},
-std::array<float,2>{0.440814167f, 0.158256724f},
-std::array<float,2>{0.852830946f, 0.872402132f},
-std::array<float,2>{0.942846835f, 0.284016937f},
-std::array<float,2>{0.271585464f, 0.505271912f},
-std::array<float,2>{0.0819794163f, 0.101313926f},
-std::array<float,2>{0.521730363f, 0.958201528f},
-std::array<float,2>{0.6589818f, 0.200195745f},
-std::array<float,2>{0.185377136f, 0.754762411f},
-std::array<float,2>{0.479521364f, 0.499909967f},
-std::array<float,2>{0.821994603f, 0.743226349f},
-std::array<float,2>{0.777170956f, 0.0456741452f},
-std::array<float,2>{0.407041728f, 0.894322455f},
-std::array<float,2>{0.244325384f, 0.33919242f},
-std::array<float,2>{0.73007375f, 0.572279394f},
-std::array<float,2>{0.603191733f, 0.407466292f},
-std::array<float,2>{0.00568042416f, 0.633738577f},
-std::array<float,2>{0.330329657f, 0.162254915f},
-std::array<float,2>{0.890753806f, 0.870271444f},
-std::array<float,2>{0.86729157f, 0.444869161f},
-std::array<float,2>{0.465493172f, 0.689067781f},
-std::array<float,2>{0.128473878f, 0.235103175f},
-std::array<float,2>{0.626824558f, 0.803434074f},
-std::array<float,2>{0.536217749f, 0.0663091466f},
-std::array<float,2>{0.0953431726f, 0.969432652f},
-std::array<float,2>{0.286611199f, 0.2559596f},
-std::array<float,2>{0.9731915f, 0.542121112f},
-std::array<float,2>{0.917286456f, 0.125445947f},
-std::array<float,2>{0.359230787f, 0.824691832f},
-std::array<float,2>{0.0428257175f, 0.377776593f},
-std::array<float,2>{0.567740321f, 0.659044087f},
-std::array<float,2>{0.69562602f, 0.359899133f},
-std::array<float,2>{0.209390387f, 0.596528947f},
-std::array<float,2>{0.390813351f, 0.00941047724f},
-std::array<float,2>{0.808753848f, 0.931439281f},
-std::array<float,2>{0.880465806f, 0.403746128f},
-std::array<float,2>{0.323681414f, 0.684501112f},
-std::array<float,2>{0.0290087909f, 0.14359273f},
-std::array<float,2>{0.620978653f, 0.843120217f},
-std::array<float,2>{0.739103317f, 0.0173179004f},
-std::array<float,2>{0.233790532f, 0.907460451f},
-std::array<float,2>{0.430386722f, 0.344000697f},
-std::array<float,2>{0.758707941f, 0.612524927f},
-std::array<float,2>{0.841960847f, 0.220641673f},
-std::array<float,2>{0.499403298f, 0.788430929f},
-std::array<float,2>{0.162733197f, 0.463889301f},
-std::array<float,2>{0.685721576f, 0.71542716f},
-std::array<float,2>{0.504999876f, 0.27142334f},
-std::array<float,2>{0.0765945986f, 0.547707796f},
-std::array<float,2>{0.265079737f, 0.0928841308f},
-std::array<float,2>{0.958218694f, 0.994918287f},
-std::array<float,2>{0.790461361f, 0.324688792f},
-std::array<float,2>{0.385345221f, 0.584290028f},
-std::array<float,2>{0.195432603f, 0.056238018f},
-std::array<float,2>{0.70546639f, 0.881377459f},
-std::array<float,2>{0.587961316f, 0.176818758f},
-std::array<float,2>{0.0512613989f, 0.85836333f},
-std::array<float,2>{0.364331126f, 0.426286817f},
-std::array<float,2>{0.926808059f, 0.655357778f},
-std::array<float,2>{0.993358493f, 0.111775465f},
-std::array<float,2>{0.309491605f, 0.944575906f},
-std::array<float,2>{0.116941333f, 0.310666472f},
-std::array<float,2>{0.555798829f, 0.520604908f},
-std::array<float,2>{0.646006167f, 0.470788479f},
-std::array<float,2>{0.144350708f, 0.729735374f},
-std::array<float,2>{0.452334315f, 0.21059683f},
-std::array<float,2>{0.844499826f, 0.776408315f},
-std::array<float,2>{0.933552384f, 0.358410269f},
-std::array<float,2>{0.369557977f, 0.619318664f},
-std::array<float,2>{0.0576780289f, 0.0273366924f},
-std::array<float,2>{0.582074881f, 0.915602207f},
-std::array<float,2>{0.718624771f, 0.151453316f},
-std::array<float,2>{0.190623f, 0.828626275f},
-std::array<float,2>{0.378868312f, 0.392463714f},
-std::array<float,2>{0.788475573f, 0.674888968f},
-std::array<float,2>{0.858862579f, 0.0800338164f},
-std::array<float,2>{0.443422109f, 0.990755558f},
-std::array<float,2>{0.150713056f, 0.279496253f},
-std::array<float,2>{0.65355891f, 0.561854362f},
-std::array<float,2>{0.550360024f, 0.454983175f},
-std::array<float,2>{0.120234437f, 0.703296483f},
-std::array<float,2>{0.303021222f, 0.228315428f},
-std::array<float,2>{0.991891384f, 0.793464482f},
-std::array<float,2>{0.756061971f, 0.435922563f},
-std::array<float,2>{0.422163844f, 0.642374098f},
-std::array<float,2>{0.224569112f, 0.180013165f},
-std::array<float,2>{0.744326174f, 0.849039257f},
-std::array<float,2>{0.615149856f, 0.049137082f},
-std::array<float,2>{0.0203279983f, 0.888489842f},
-std::array<float,2>{0.318524003f, 0.313341677f},
-std::array<float,2>{0.889070868f, 0.586805642f},
-std::array<float,2>{0.967638075f, 0.218652368f},
-std::array<float,2>{0.256303459f, 0.767311156f},
-std::array<float,2>{0.068750076f, 0.47674492f},
-std::array<float,2>{0.511916935f, 0.722410977f},
-std::array<float,2>{0.671949208f, 0.297654718f},
-std::array<float,2>{0.169764817f, 0.524478376f},
-std::array<float,2>{0.489632249f, 0.121745437f},
-std::array<float,2>{0.833624303f, 0.945765376f},
-std::array<float,2>{0.979579568f, 0.489427745f},
-std::array<float,2>{0.296461165f, 0.740495026f},
-std::array<float,2>{0.106823631f, 0.19519797f},
-std::array<float,2>{0.544713259f, 0.764702022f},
-std::array<float,2>{0.638237596f, 0.103516057f},
-std::array<float,2>{0.134925276f, 0.96618259f},
-std::array<float,2>{0.457495749f, 0.293248147f},
-std::array<float,2>{0.864799798f, 0.511325955f},
-std::array<float,2>{0.797275126f, 0.167024598f},
-std::array<float,2>{0.399865597f, 0.860999405f},
-std::array<float,2>{0.211163446f, 0.417735279f},
-std::array<float,2>{0.688247204f, 0.63132906f},
-std::array<float,2>{0.574398637f, 0.332844317f},
-std::array<float,2>{0.0315356478f, 0.567376792f},
-std::array<float,2>{0.348135114f, 0.0366887935f},
-std::array<float,2>{0.912721157f, 0.901657879f},
-std::array<float,2>{0.818420768f, 0.260143548f},
-std::array<float,2>{0.472460449f, 0.538412035f},
-std::array<float,2>{0.177253529f, 0.0760142878f},
-std::array<float,2>{0.670808136f, 0.982396245f},
-std::array<float,2>{0.527532876f, 0.246979013f},
-std::array<float,2>{0.087536715f, 0.804725826f},
-std::array<float,2>{0.277215481f, 0.451366931f},
-std::array<float,2>{0.951981246f, 0.696705818f},
-std::array<float,2>{0.900325894f, 0.000605237321f},
-std::array<float,2>{0.339595467f, 0.928425074f},
-std::array<float,2>{0.0104868412f, 0.368498415f},
-std::array<float,2>{0.594718039f, 0.604997873f},
-std::array<float,2>{0.724569321f, 0.388942868f},
-std::array<float,2>{0.238113537f, 0.666946828f},
-std::array<float,2>{0.415682584f, 0.135661721f},
-std::array<float,2>{0.769349337f, 0.819301248f},
-std::array<float,2>{0.896191835f, 0.275529176f},
-std::array<float,2>{0.332150638f, 0.555668712f},
-std::array<float,2>{0.00275186705f, 0.0824016333f},
-std::array<float,2>{0.608199298f, 0.984700143f},
-std::array<float,2>{0.731106281f, 0.23296538f},
-std::array<float,2>{0.247822419f, 0.789326012f},
-std::array<float,2>{0.411675781f, 0.458937407f},
-std::array<float,2>{0.780608892f, 0.707384527f},
-std::array<float,2>{0.826338351f, 0.0311235059f},
-std::array<float,2>{0.483197093f, 0.918360829f},
-std::array<float,2>{0.180127546f, 0.353573531f},
-std::array<float,2>{0.661683321f, 0.622165143f},
-std::array<float,2>{0.519353271f, 0.395008326f},
-std::array<float,2>{0.083498843f, 0.679412246f},
-std::array<float,2>{0.267498612f, 0.155809298f},
-std::array<float,2>{0.938678026f, 0.832116663f},
-std::array<float,2>{0.805747688f, 0.482103825f},
-std::array<float,2>{0.396461874f, 0.722779095f},
-std::array<float,2>{0.204223096f, 0.213527158f},
-std::array<float,2>{0.702361941f, 0.771575034f},
-std::array<float,2>{0.56448549f, 0.11740616f},
-std::array<float,2>{0.0468360484f, 0.950422883f},
-std::array<float,2>{0.355164558f, 0.303471923f},
-std::array<float,2>{0.919033408f, 0.530142307f},
-std::array<float,2>{0.968856871f, 0.185908526f},
-std::array<float,2>{0.282013714f, 0.845118165f},
-std::array<float,2>{0.0996451527f, 0.433339179f},
-std::array<float,2>{0.533615589f, 0.647892237f},
-std::array<float,2>{0.629330993f, 0.319742292f},
-std::array<float,2>{0.131830826f, 0.593111813f},
-std::array<float,2>{0.462838262f, 0.0546418354f},
-std::array<float,2>{0.872684062f, 0.885080636f},
-std::array<float,2>{0.954002559f, 0.418784797f},
-std::array<float,2>{0.259627253f, 0.628401458f},
-std::array<float,2>{0.0723442659f, 0.168648794f},
-std::array<float,2>{0.501960158f, 0.866040349f},
-std::array<float,2>{0.679967463f, 0.0337491147f},
-std::array<float,2>{0.157598272f, 0.905091703f},
-std::array<float,2>{0.49503538f, 0.328715175f},
-std::array<float,2>{0.837257028f, 0.563076198f},
-std::array<float,2>{0.762000799f, 0.189556092f},
-std::array<float,2>{0.434379816f, 0.758266866f},
-std::array<float,2>{0.229149535f, 0.48592931f},
-std::array<float,2>{0.735560596f, 0.738019586f},
-std::array<float,2>{0.621762812f, 0.289598793f},
-std::array<float,2>{0.0240941104f, 0.513656855f},
-std::array<float,2>{0.324724495f, 0.108110391f},
-std::array<float,2>{0.876155257f, 0.963124275f},
-std::array<float,2>{0.849886179f, 0.374802977f},
-std::array<float,2>{0.448608398f, 0.608329296f},
-std::array<float,2>{0.145270944f, 0.00705960672f},
-std::array<float,2>{0.641457796f, 0.922568858f},
-std::array<float,2>{0.561113894f, 0.137043282f},
-std::array<float,2>{0.109411992f, 0.814439774f},
-std::array<float,2>{0.30552128f, 0.384124607f},
-std::array<float,2>{0.996710241f, 0.670064986f},
-std::array<float,2>{0.923477352f, 0.0731104761f},
-std::array<float,2>{0.362275392f, 0.980224013f},
-std::array<float,2>{0.0493566915f, 0.264148533f},
-std::array<float,2>{0.592895806f, 0.535024583f},
-std::array<float,2>{0.708998501f, 0.448145121f},
-std::array<float,2>{0.200481176f, 0.700060129f},
-std::array<float,2>{0.387429059f, 0.245237917f},
-std::array<float,2>{0.796764672f, 0.809790313f},
-std::array<float,2>{0.987790108f, 0.340239048f},
-std::array<float,2>{0.300629348f, 0.576857269f},
-std::array<float,2>{0.121843792f, 0.0426151119f},
-std::array<float,2>{0.550937414f, 0.895026565f},
-std::array<float,2>{0.650429428f, 0.159868881f},
-std::array<float,2>{0.153939888f, 0.872006714f},
-std::array<float,2>{0.437793672f, 0.412622392f},
-std::array<float,2>{0.854793191f, 0.639766097f},
-std::array<float,2>{0.784970164f, 0.0954292417f},
-std::array<float,2>{0.380946487f, 0.954097569f},
-std::array<float,2>{0.192938954f, 0.285471052f},
-std::array<float,2>{0.714239001f, 0.50190866f},
-std::array<float,2>{0.578966975f, 0.492806643f},
-std::array<float,2>{0.0589218922f, 0.747321963f},
-std::array<float,2>{0.37375015f, 0.197036982f},
-std::array<float,2>{0.934264541f, 0.750660956f},
-std::array<float,2>{0.829790533f, 0.380162418f},
-std::array<float,2>{0.486355335f, 0.662307978f},
-std::array<float,2>{0.164125711f, 0.129445821f},
-std::array<float,2>{0.678224027f, 0.823767662f},
-std::array<float,2>{0.51154685f, 0.0125972275f},
-std::array<float,2>{0.0628477708f, 0.936584651f},
-std::array<float,2>{0.25110653f, 0.363531619f},
-std::array<float,2>{0.964755893f, 0.598178208f},
-std::array<float,2>{0.883919537f, 0.240227684f},
-std::array<float,2>{0.314164519f, 0.798539937f},
-std::array<float,2>{0.0162072163f, 0.439947069f},
-std::array<float,2>{0.611774206f, 0.694933772f},
-std::array<float,2>{0.74690485f, 0.252344221f},
-std::array<float,2>{0.220899165f, 0.546692133f},
-std::array<float,2>{0.428913623f, 0.067110911f},
-std::array<float,2>{0.752954483f, 0.973940313f},
-std::array<float,2>{0.908053637f, 0.4654558f},
-std::array<float,2>{0.344149143f, 0.712212861f},
-std::array<float,2>{0.0356872343f, 0.22373496f},
-std::array<float,2>{0.57216239f, 0.784751832f},
-std::array<float,2>{0.693489611f, 0.0879019871f},
-std::array<float,2>{0.216314316f, 0.998181999f},
-std::array<float,2>{0.404806733f, 0.266804188f},
-std::array<float,2>{0.801982522f, 0.554539382f},
-std::array<float,2>{0.86254096f, 0.146914586f},
-std::array<float,2>{0.456814229f, 0.836915791f},
-std::array<float,2>{0.140270576f, 0.401277721f},
-std::array<float,2>{0.636098444f, 0.683324695f},
-std::array<float,2>{0.540519297f, 0.350946456f},
-std::array<float,2>{0.104048833f, 0.615516007f},
-std::array<float,2>{0.289572567f, 0.0221051294f},
-std::array<float,2>{0.98296392f, 0.911014616f},
-std::array<float,2>{0.770335495f, 0.304977804f},
-std::array<float,2>{0.421314538f, 0.518285573f},
-std::array<float,2>{0.239358485f, 0.116753027f},
-std::array<float,2>{0.721522927f, 0.940307558f},
-std::array<float,2>{0.600675046f, 0.205455855f},
-std::array<float,2>{0.0141595611f, 0.778565884f},
-std::array<float,2>{0.340309083f, 0.473973751f},
-std::array<float,2>{0.905900836f, 0.731531918f},
-std::array<float,2>{0.948599219f, 0.0608837157f},
-std::array<float,2>{0.278014541f, 0.878889441f},
-std::array<float,2>{0.0901089162f, 0.322945535f},
-std::array<float,2>{0.523673296f, 0.580561221f},
-std::array<float,2>{0.667722464f, 0.423383176f},
-std::array<float,2>{0.172074452f, 0.650245905f},
-std::array<float,2>{0.474989891f, 0.173072144f},
-std::array<float,2>{0.815390348f, 0.854683518f},
-std::array<float,2>{0.974746823f, 0.254157782f},
-std::array<float,2>{0.287713438f, 0.539597631f},
-std::array<float,2>{0.0964465141f, 0.0628143474f},
-std::array<float,2>{0.538307309f, 0.971293509f},
-std::array<float,2>{0.628634572f, 0.236369744f},
-std::array<float,2>{0.125731215f, 0.801345825f},
-std::array<float,2>{0.468287379f, 0.441587687f},
-std::array<float,2>{0.870491147f, 0.690711379f},
-std::array<float,2>{0.810897529f, 0.0100160707f},
-std::array<float,2>{0.393713027f, 0.932806849f},
-std::array<float,2>{0.207291901f, 0.361557305f},
-std::array<float,2>{0.698077261f, 0.594632387f},
-std::array<float,2>{0.568634152f, 0.375106603f},
-std::array<float,2>{0.0408146754f, 0.657431245f},
-std::array<float,2>{0.355799377f, 0.126983777f},
-std::array<float,2>{0.914355099f, 0.82625401f},
-std::array<float,2>{0.823100507f, 0.496507585f},
-std::array<float,2>{0.477204084f, 0.744935513f},
-std::array<float,2>{0.185865402f, 0.203055128f},
-std::array<float,2>{0.65793556f, 0.756450415f},
-std::array<float,2>{0.520682454f, 0.0993564278f},
-std::array<float,2>{0.0786728784f, 0.960619211f},
-std::array<float,2>{0.271122396f, 0.281665057f},
-std::array<float,2>{0.945150554f, 0.507313728f},
-std::array<float,2>{0.892613351f, 0.161632732f},
-std::array<float,2>{0.329538435f, 0.868581772f},
-std::array<float,2>{0.00636907667f, 0.408370852f},
-std::array<float,2>{0.605080485f, 0.635768175f},
-std::array<float,2>{0.728229523f, 0.33675772f},
-std::array<float,2>{0.242686599f, 0.57217288f},
-std::array<float,2>{0.409413517f, 0.0436060056f},
-std::array<float,2>{0.774309456f, 0.890736938f},
-std::array<float,2>{0.928286135f, 0.428778112f},
-std::array<float,2>{0.366516948f, 0.654235721f},
-std::array<float,2>{0.0531422906f, 0.17833063f},
-std::array<float,2>{0.586430311f, 0.85656631f},
-std::array<float,2>{0.704572499f, 0.0578085072f},
-std::array<float,2>{0.198329031f, 0.878998935f},
-std::array<float,2>{0.384683669f, 0.326896667f},
-std::array<float,2>{0.791935802f, 0.583845079f},
-std::array<float,2>{0.845787466f, 0.208299816f},
-std::array<float,2>{0.450159758f, 0.775386512f},
-std::array<float,2>{0.141051054f, 0.469181865f},
-std::array<float,2>{0.648217499f, 0.728436947f},
-std::array<float,2>{0.557390869f, 0.310159534f},
-std::array<float,2>{0.115076117f, 0.523278236f},
-std::array<float,2>{0.311652899f, 0.111057363f},
-std::array<float,2>{0.995255888f, 0.943343163f},
-std::array<float,2>{0.760027528f, 0.346336573f},
-std::array<float,2>{0.432860941f, 0.610624015f},
-std::array<float,2>{0.231951088f, 0.0184399076f},
-std::array<float,2>{0.741334975f, 0.909820378f},
-std::array<float,2>{0.61758858f, 0.142032415f},
-std::array<float,2>{0.030836137f, 0.840304911f},
-std::array<float,2>{0.321113944f, 0.405960947f},
-std::array<float,2>{0.88266319f, 0.686077237f},
-std::array<float,2>{0.960294664f, 0.0901993215f},
-std::array<float,2>{0.263614446f, 0.99225837f},
-std::array<float,2>{0.074418962f, 0.272647828f},
-std::array<float,2>{0.50659889f, 0.550586998f},
-std::array<float,2>{0.684432149f, 0.462549537f},
-std::array<float,2>{0.161801949f, 0.716980457f},
-std::array<float,2>{0.497266382f, 0.221780241f},
-std::array<float,2>{0.841519475f, 0.786015153f},
-std::array<float,2>{0.887720644f, 0.315680951f},
-std::array<float,2>{0.316470891f, 0.588590503f},
-std::array<float,2>{0.0221498441f, 0.0479369164f},
-std::array<float,2>{0.616681755f, 0.889415741f},
-std::array<float,2>{0.743807137f, 0.183395773f},
-std::array<float,2>{0.225646615f, 0.850470245f},
-std::array<float,2>{0.424968988f, 0.434498221f},
-std::array<float,2>{0.754180193f, 0.643511593f},
-std::array<float,2>{0.835083723f, 0.123731323f},
-std::array<float,2>{0.490434021f, 0.947601676f},
-std::array<float,2>{0.171865493f, 0.300518751f},
-std::array<float,2>{0.675406337f, 0.526275575f},
-std::array<float,2>{0.513672233f, 0.479279786f},
-std::array<float,2>{0.0672292188f, 0.720423162f},
-std::array<float,2>{0.254505515f, 0.216135293f},
-std::array<float,2>{0.966753542f, 0.7687186f},
-std::array<float,2>{0.785470784f, 0.393141478f},
-std::array<float,2>{0.376082242f, 0.67313385f},
-std::array<float,2>{0.189386278f, 0.149901867f},
-std::array<float,2>{0.716417253f, 0.83070606f},
-std::array<float,2>{0.58487922f, 0.0251418985f},
-std::array<float,2>{0.0562341884f, 0.916234493f},
-std::array<float,2>{0.368549019f, 0.356702834f},
-std::array<float,2>{0.930698752f, 0.617534518f},
-std::array<float,2>{0.989657581f, 0.23024863f},
-std::array<float,2>{0.301121503f, 0.795359135f},
-std::array<float,2>{0.117807269f, 0.455562562f},
-std::array<float,2>{0.54831171f, 0.706903815f},
-std::array<float,2>{0.656032026f, 0.278455794f},
-std::array<float,2>{0.148816884f, 0.560012758f},
-std::array<float,2>{0.44154048f, 0.0812608004f},
-std::array<float,2>{0.85642153f, 0.98835814f},
-std::array<float,2>{0.950525522f, 0.451047271f},
-std::array<float,2>{0.274812192f, 0.698114097f},
-std::array<float,2>{0.0893521383f, 0.24818933f},
-std::array<float,2>{0.529506445f, 0.808528066f},
-std::array<float,2>{0.668953657f, 0.0770325065f},
-std::array<float,2>{0.179517776f, 0.983951509f},
-std::array<float,2>{0.469677418f, 0.259055048f},
-std::array<float,2>{0.816652f, 0.535369158f},
-std::array<float,2>{0.767507613f, 0.133619279f},
-std::array<float,2>{0.416562468f, 0.818113744f},
-std::array<float,2>{0.235895991f, 0.387318194f},
-std::array<float,2>{0.725076139f, 0.664774716f},
-std::array<float,2>{0.596330702f, 0.369728416f},
-std::array<float,2>{0.00894512143f, 0.601566374f},
-std::array<float,2>{0.336948156f, 0.00387523114f},
-std::array<float,2>{0.90190804f, 0.92636472f},
-std::array<float,2>{0.866866231f, 0.295832425f},
-std::array<float,2>{0.459626347f, 0.509634376f},
-std::array<float,2>{0.132813737f, 0.103215478f},
-std::array<float,2>{0.639233172f, 0.968441188f},
-std::array<float,2>{0.545347452f, 0.191861629f},
-std::array<float,2>{0.109013997f, 0.762250483f},
-std::array<float,2>{0.294761032f, 0.491549492f},
-std::array<float,2>{0.977946758f, 0.74001956f},
-std::array<float,2>{0.91151315f, 0.037665043f},
-std::array<float,2>{0.349800229f, 0.899652481f},
-std::array<float,2>{0.0344417244f, 0.335761696f},
-std::array<float,2>{0.576335311f, 0.569701552f},
-std::array<float,2>{0.690488458f, 0.414728612f},
-std::array<float,2>{0.214709193f, 0.630320907f},
-std::array<float,2>{0.400395811f, 0.165435642f},
-std::array<float,2>{0.80035919f, 0.862489939f},
-std::array<float,2>{0.920849442f, 0.301662117f},
-std::array<float,2>{0.352289915f, 0.527390659f},
-std::array<float,2>{0.0434651487f, 0.121070452f},
-std::array<float,2>{0.563059568f, 0.951443434f},
-std::array<float,2>{0.70023632f, 0.21256119f},
-std::array<float,2>{0.2059284f, 0.769708276f},
-std::array<float,2>{0.397683322f, 0.483468056f},
-std::array<float,2>{0.807476997f, 0.725389361f},
-std::array<float,2>{0.874229252f, 0.0519338064f},
-std::array<float,2>{0.464274466f, 0.884097815f},
-std::array<float,2>{0.129599437f, 0.317456216f},
-std::array<float,2>{0.631942749f, 0.59007746f},
-std::array<float,2>{0.532335818f, 0.430221707f},
-std::array<float,2>{0.0993448347f, 0.644708633f},
-std::array<float,2>{0.283791989f, 0.183990613f},
-std::array<float,2>{0.972537875f, 0.84582603f},
-std::array<float,2>{0.778272748f, 0.459384501f},
-std::array<float,2>{0.412912369f, 0.709013879f},
-std::array<float,2>{0.248059675f, 0.231305927f},
-std::array<float,2>{0.732596397f, 0.792813897f},
-std::array<float,2>{0.606754541f, 0.0841689259f},
-std::array<float,2>{0.000822175469f, 0.986862361f},
-std::array<float,2>{0.335096091f, 0.273962677f},
-std::array<float,2>{0.897462606f, 0.558271885f},
-std::array<float,2>{0.941169798f, 0.152737439f},
-std::array<float,2>{0.268019259f, 0.834412217f},
-std::array<float,2>{0.0840642601f, 0.397118837f},
-std::array<float,2>{0.516817153f, 0.6765576f},
-std::array<float,2>{0.662939906f, 0.352041155f},
-std::array<float,2>{0.182198524f, 0.623199463f},
-std::array<float,2>{0.481905609f, 0.0292871371f},
-std::array<float,2>{0.826018274f, 0.920155466f},
-std::array<float,2>{0.999042988f, 0.385827482f},
-std::array<float,2>{0.308227211f, 0.668245196f},
-std::array<float,2>{0.112884983f, 0.140385881f},
-std::array<float,2>{0.559842467f, 0.816336155f},
-std::array<float,2>{0.643958986f, 0.00444984343f},
-std::array<float,2>{0.148291841f, 0.925412238f},
-std::array<float,2>{0.44547236f, 0.372133911f},
-std::array<float,2>{0.848312914f, 0.605884135f},
-std::array<float,2>{0.794895172f, 0.243543044f},
-std::array<float,2>{0.38917169f, 0.812318802f},
-std::array<float,2>{0.202076584f, 0.445939213f},
-std::array<float,2>{0.708751798f, 0.701720476f},
-std::array<float,2>{0.591329575f, 0.263585418f},
-std::array<float,2>{0.0481938273f, 0.53146863f},
-std::array<float,2>{0.360346198f, 0.0709230006f},
-std::array<float,2>{0.925674379f, 0.977024734f},
-std::array<float,2>{0.837908685f, 0.330116898f},
-std::array<float,2>{0.493844151f, 0.56497103f},
-std::array<float,2>{0.158414543f, 0.032309711f},
-std::array<float,2>{0.681991696f, 0.902357638f},
-std::array<float,2>{0.500626147f, 0.170216978f},
-std::array<float,2>{0.0716419592f, 0.86420542f},
-std::array<float,2>{0.260128587f, 0.420841336f},
-std::array<float,2>{0.955313325f, 0.626912415f},
-std::array<float,2>{0.878806949f, 0.106909357f},
-std::array<float,2>{0.328003198f, 0.962450504f},
-std::array<float,2>{0.0270358138f, 0.291371047f},
-std::array<float,2>{0.624016225f, 0.51442647f},
-std::array<float,2>{0.738264024f, 0.486810416f},
-std::array<float,2>{0.2283905f, 0.735322952f},
-std::array<float,2>{0.435747355f, 0.187960938f},
-std::array<float,2>{0.764540255f, 0.761248887f},
-std::array<float,2>{0.961126566f, 0.365879118f},
-std::array<float,2>{0.252331913f, 0.599969506f},
-std::array<float,2>{0.0661587492f, 0.0152901113f},
-std::array<float,2>{0.508461237f, 0.93437469f},
-std::array<float,2>{0.677130699f, 0.131506488f},
-std::array<float,2>{0.167801648f, 0.821733952f},
-std::array<float,2>{0.485169828f, 0.382590294f},
-std::array<float,2>{0.831372678f, 0.66021961f},
-std::array<float,2>{0.751198113f, 0.0702248141f},
-std::array<float,2>{0.426337838f, 0.974649787f},
-std::array<float,2>{0.219514951f, 0.250621706f},
-std::array<float,2>{0.748988509f, 0.54424715f},
-std::array<float,2>{0.610771418f, 0.439183444f},
-std::array<float,2>{0.0195070617f, 0.692017674f},
-std::array<float,2>{0.314469695f, 0.240493402f},
-std::array<float,2>{0.885397971f, 0.799717665f},
-std::array<float,2>{0.852046013f, 0.410797f},
-std::array<float,2>{0.440131217f, 0.638346851f},
-std::array<float,2>{0.15463084f, 0.157299429f},
-std::array<float,2>{0.649515212f, 0.873480558f},
-std::array<float,2>{0.553319514f, 0.0401121862f},
-std::array<float,2>{0.124215789f, 0.896917522f},
-std::array<float,2>{0.296937972f, 0.34307602f},
-std::array<float,2>{0.984859586f, 0.575899422f},
-std::array<float,2>{0.936968386f, 0.197903082f},
-std::array<float,2>{0.371655613f, 0.752314806f},
-std::array<float,2>{0.0617171265f, 0.494534552f},
-std::array<float,2>{0.580122232f, 0.749444485f},
-std::array<float,2>{0.711964309f, 0.28868416f},
-std::array<float,2>{0.193873465f, 0.50215435f},
-std::array<float,2>{0.379899353f, 0.0971615911f},
-std::array<float,2>{0.781865716f, 0.956862271f},
-std::array<float,2>{0.903211951f, 0.476204962f},
-std::array<float,2>{0.342878103f, 0.733808339f},
-std::array<float,2>{0.012387502f, 0.203634396f},
-std::array<float,2>{0.599092782f, 0.779568136f},
-std::array<float,2>{0.719769895f, 0.11488799f},
-std::array<float,2>{0.240464866f, 0.938160062f},
-std::array<float,2>{0.419653773f, 0.307756692f},
-std::array<float,2>{0.771888733f, 0.516093075f},
-std::array<float,2>{0.813209534f, 0.175179511f},
-std::array<float,2>{0.473300934f, 0.85335952f},
-std::array<float,2>{0.17521809f, 0.424662501f},
-std::array<float,2>{0.665649235f, 0.651582956f},
-std::array<float,2>{0.526430666f, 0.322012573f},
-std::array<float,2>{0.0930639431f, 0.579482436f},
-std::array<float,2>{0.280632168f, 0.0602902994f},
-std::array<float,2>{0.946846664f, 0.876906812f},
-std::array<float,2>{0.803410769f, 0.267664135f},
-std::array<float,2>{0.402920723f, 0.550909042f},
-std::array<float,2>{0.217192292f, 0.0876652524f},
-std::array<float,2>{0.691786051f, 0.997955918f},
-std::array<float,2>{0.573417783f, 0.225245699f},
-std::array<float,2>{0.0379639342f, 0.782908022f},
-std::array<float,2>{0.34696278f, 0.468555868f},
-std::array<float,2>{0.909511447f, 0.714123726f},
-std::array<float,2>{0.981390715f, 0.0198096409f},
-std::array<float,2>{0.29228121f, 0.913383007f},
-std::array<float,2>{0.103123724f, 0.347979367f},
-std::array<float,2>{0.541128278f, 0.615160286f},
-std::array<float,2>{0.633408844f, 0.398873538f},
-std::array<float,2>{0.136896253f, 0.681136012f},
-std::array<float,2>{0.454062581f, 0.144715533f},
-std::array<float,2>{0.860056698f, 0.838528991f},
-std::array<float,2>{0.938928187f, 0.274665654f},
-std::array<float,2>{0.26718393f, 0.557060361f},
-std::array<float,2>{0.0838219002f, 0.0853614733f},
-std::array<float,2>{0.519253075f, 0.987865388f},
-std::array<float,2>{0.662106335f, 0.232403129f},
-std::array<float,2>{0.179803267f, 0.791612506f},
-std::array<float,2>{0.482971311f, 0.460576594f},
-std::array<float,2>{0.826544106f, 0.710752547f},
-std::array<float,2>{0.780339003f, 0.0282365456f},
-std::array<float,2>{0.411925673f, 0.921685398f},
-std::array<float,2>{0.247591153f, 0.353083551f},
-std::array<float,2>{0.731419921f, 0.624186516f},
-std::array<float,2>{0.608001292f, 0.398105323f},
-std::array<float,2>{0.00259334268f, 0.677040756f},
-std::array<float,2>{0.332354069f, 0.153842539f},
-std::array<float,2>{0.896292865f, 0.835365176f},
-std::array<float,2>{0.872866392f, 0.483374864f},
-std::array<float,2>{0.462519169f, 0.725925982f},
-std::array<float,2>{0.131418258f, 0.211059898f},
-std::array<float,2>{0.628959775f, 0.771149576f},
-std::array<float,2>{0.533252358f, 0.119861856f},
-std::array<float,2>{0.100096487f, 0.952841461f},
-std::array<float,2>{0.281924099f, 0.302639514f},
-std::array<float,2>{0.969194353f, 0.528913736f},
-std::array<float,2>{0.919219971f, 0.18544592f},
-std::array<float,2>{0.35542649f, 0.847237706f},
-std::array<float,2>{0.0465933383f, 0.431226373f},
-std::array<float,2>{0.56482482f, 0.645546675f},
-std::array<float,2>{0.702405393f, 0.316808701f},
-std::array<float,2>{0.20439139f, 0.591278672f},
-std::array<float,2>{0.396013707f, 0.0513216518f},
-std::array<float,2>{0.806118369f, 0.883759737f},
-std::array<float,2>{0.876460075f, 0.421492845f},
-std::array<float,2>{0.325063139f, 0.625250399f},
-std::array<float,2>{0.0243907161f, 0.171078458f},
-std::array<float,2>{0.621999085f, 0.864420831f},
-std::array<float,2>{0.735687852f, 0.0315949135f},
-std::array<float,2>{0.229394391f, 0.903902113f},
-std::array<float,2>{0.434161305f, 0.331920326f},
-std::array<float,2>{0.761768639f, 0.56640476f},
-std::array<float,2>{0.836950541f, 0.189169303f},
-std::array<float,2>{0.494632483f, 0.760422766f},
-std::array<float,2>{0.157370776f, 0.488079756f},
-std::array<float,2>{0.679772019f, 0.735634804f},
-std::array<float,2>{0.502248228f, 0.2920672f},
-std::array<float,2>{0.0725248903f, 0.515417516f},
-std::array<float,2>{0.259491831f, 0.105674729f},
-std::array<float,2>{0.95366627f, 0.960954487f},
-std::array<float,2>{0.796432197f, 0.371599883f},
-std::array<float,2>{0.387669802f, 0.606653333f},
-std::array<float,2>{0.200200528f, 0.00529654976f},
-std::array<float,2>{0.709307253f, 0.924494505f},
-std::array<float,2>{0.593252599f, 0.139324546f},
-std::array<float,2>{0.0496345833f, 0.814610064f},
-std::array<float,2>{0.361893564f, 0.385429978f},
-std::array<float,2>{0.923826635f, 0.668964982f},
-std::array<float,2>{0.997011125f, 0.0721571445f},
-std::array<float,2>{0.305409163f, 0.977739036f},
-std::array<float,2>{0.109673157f, 0.261891156f},
-std::array<float,2>{0.561382174f, 0.532782316f},
-std::array<float,2>{0.641212702f, 0.447089255f},
-std::array<float,2>{0.145046324f, 0.703115821f},
-std::array<float,2>{0.448285609f, 0.24248071f},
-std::array<float,2>{0.84980166f, 0.810635567f},
-std::array<float,2>{0.934405267f, 0.341921628f},
-std::array<float,2>{0.37402153f, 0.574385524f},
-std::array<float,2>{0.0588125959f, 0.0397679657f},
-std::array<float,2>{0.578671932f, 0.898114979f},
-std::array<float,2>{0.713932216f, 0.156651258f},
-std::array<float,2>{0.193350539f, 0.874296188f},
-std::array<float,2>{0.381144077f, 0.411535501f},
-std::array<float,2>{0.784810305f, 0.637577772f},
-std::array<float,2>{0.854716063f, 0.0960617661f},
-std::array<float,2>{0.437682152f, 0.955937505f},
-std::array<float,2>{0.154211879f, 0.287853897f},
-std::array<float,2>{0.650851071f, 0.503869772f},
-std::array<float,2>{0.551264644f, 0.495536536f},
-std::array<float,2>{0.121655717f, 0.749017417f},
-std::array<float,2>{0.300379872f, 0.198799416f},
-std::array<float,2>{0.987398148f, 0.753592134f},
-std::array<float,2>{0.753278732f, 0.38168332f},
-std::array<float,2>{0.42899403f, 0.661461234f},
-std::array<float,2>{0.220981225f, 0.132560149f},
-std::array<float,2>{0.746726096f, 0.820314348f},
-std::array<float,2>{0.611359f, 0.0145824859f},
-std::array<float,2>{0.0164920092f, 0.934665382f},
-std::array<float,2>{0.314291358f, 0.366503209f},
-std::array<float,2>{0.884224355f, 0.600634694f},
-std::array<float,2>{0.964534163f, 0.241410553f},
-std::array<float,2>{0.251289874f, 0.800036252f},
-std::array<float,2>{0.0625519976f, 0.438252181f},
-std::array<float,2>{0.511378884f, 0.6928702f},
-std::array<float,2>{0.678573847f, 0.251904637f},
-std::array<float,2>{0.164436042f, 0.54303062f},
-std::array<float,2>{0.486633152f, 0.0688920841f},
-std::array<float,2>{0.829964578f, 0.976445258f},
-std::array<float,2>{0.983237386f, 0.467363626f},
-std::array<float,2>{0.289819449f, 0.713688552f},
-std::array<float,2>{0.10426183f, 0.225902259f},
-std::array<float,2>{0.540041685f, 0.781894028f},
-std::array<float,2>{0.635944545f, 0.0865861699f},
-std::array<float,2>{0.140571684f, 0.996154845f},
-std::array<float,2>{0.456785709f, 0.268785089f},
-std::array<float,2>{0.86275816f, 0.552131176f},
-std::array<float,2>{0.802193284f, 0.145893574f},
-std::array<float,2>{0.405094117f, 0.839200914f},
-std::array<float,2>{0.216656774f, 0.39960748f},
-std::array<float,2>{0.693762839f, 0.680621326f},
-std::array<float,2>{0.571945608f, 0.348991156f},
-std::array<float,2>{0.0359439962f, 0.613688409f},
-std::array<float,2>{0.343776047f, 0.0214140415f},
-std::array<float,2>{0.907720685f, 0.912951946f},
-std::array<float,2>{0.815177381f, 0.307266742f},
-std::array<float,2>{0.474650174f, 0.516768992f},
-std::array<float,2>{0.172359958f, 0.114118107f},
-std::array<float,2>{0.667731285f, 0.939198673f},
-std::array<float,2>{0.523746014f, 0.204759002f},
-std::array<float,2>{0.0900077447f, 0.78078872f},
-std::array<float,2>{0.278204143f, 0.474789351f},
-std::array<float,2>{0.948351085f, 0.732791841f},
-std::array<float,2>{0.906057775f, 0.0586736351f},
-std::array<float,2>{0.340003371f, 0.875078917f},
-std::array<float,2>{0.0137755098f, 0.320878237f},
-std::array<float,2>{0.601025641f, 0.578595638f},
-std::array<float,2>{0.721390486f, 0.424907148f},
-std::array<float,2>{0.239607349f, 0.650640309f},
-std::array<float,2>{0.421059936f, 0.174207076f},
-std::array<float,2>{0.770033836f, 0.851706922f},
-std::array<float,2>{0.890928745f, 0.282408386f},
-std::array<float,2>{0.330124915f, 0.506699741f},
-std::array<float,2>{0.00545071671f, 0.0980965048f},
-std::array<float,2>{0.603306592f, 0.959591269f},
-std::array<float,2>{0.730456114f, 0.20174247f},
-std::array<float,2>{0.244561642f, 0.757774115f},
-std::array<float,2>{0.406902254f, 0.497714996f},
-std::array<float,2>{0.776929021f, 0.74602145f},
-std::array<float,2>{0.822238445f, 0.0448422283f},
-std::array<float,2>{0.479975909f, 0.891828895f},
-std::array<float,2>{0.185238749f, 0.337735087f},
-std::array<float,2>{0.658878088f, 0.570789337f},
-std::array<float,2>{0.521611691f, 0.409575135f},
-std::array<float,2>{0.0816854388f, 0.635219753f},
-std::array<float,2>{0.271824002f, 0.160856351f},
-std::array<float,2>{0.942611396f, 0.868112564f},
-std::array<float,2>{0.808867514f, 0.442693084f},
-std::array<float,2>{0.390962303f, 0.689554453f},
-std::array<float,2>{0.20907113f, 0.238103658f},
-std::array<float,2>{0.695316732f, 0.802194834f},
-std::array<float,2>{0.567580462f, 0.0639756769f},
-std::array<float,2>{0.0426492579f, 0.972556055f},
-std::array<float,2>{0.359049857f, 0.255470067f},
-std::array<float,2>{0.916995108f, 0.54065299f},
-std::array<float,2>{0.973465502f, 0.128394067f},
-std::array<float,2>{0.286163658f, 0.827182412f},
-std::array<float,2>{0.0955918431f, 0.37621066f},
-std::array<float,2>{0.536444366f, 0.656719983f},
-std::array<float,2>{0.626478374f, 0.36308977f},
-std::array<float,2>{0.128847882f, 0.595447063f},
-std::array<float,2>{0.465711832f, 0.0116837313f},
-std::array<float,2>{0.867509127f, 0.932182312f},
-std::array<float,2>{0.958311558f, 0.40437296f},
-std::array<float,2>{0.264759243f, 0.687466919f},
-std::array<float,2>{0.0763257444f, 0.141175702f},
-std::array<float,2>{0.505291939f, 0.841533422f},
-std::array<float,2>{0.685911357f, 0.0191190168f},
-std::array<float,2>{0.162858009f, 0.908959925f},
-std::array<float,2>{0.499203622f, 0.347230643f},
-std::array<float,2>{0.842240095f, 0.609970272f},
-std::array<float,2>{0.758399785f, 0.220837459f},
-std::array<float,2>{0.430573642f, 0.786348522f},
-std::array<float,2>{0.233565897f, 0.460959494f},
-std::array<float,2>{0.73893553f, 0.717941582f},
-std::array<float,2>{0.620674074f, 0.272372246f},
-std::array<float,2>{0.0291943047f, 0.548883677f},
-std::array<float,2>{0.323294282f, 0.0914600119f},
-std::array<float,2>{0.880733728f, 0.993192196f},
-std::array<float,2>{0.844338953f, 0.327197403f},
-std::array<float,2>{0.452410817f, 0.582531393f},
-std::array<float,2>{0.144139275f, 0.0566466488f},
-std::array<float,2>{0.646449208f, 0.880708039f},
-std::array<float,2>{0.55609262f, 0.178769127f},
-std::array<float,2>{0.117106237f, 0.855648935f},
-std::array<float,2>{0.309279978f, 0.428427368f},
-std::array<float,2>{0.993586302f, 0.653272569f},
-std::array<float,2>{0.927241564f, 0.110207528f},
-std::array<float,2>{0.364532769f, 0.942223608f},
-std::array<float,2>{0.0507876389f, 0.308680594f},
-std::array<float,2>{0.588140011f, 0.521971464f},
-std::array<float,2>{0.705141544f, 0.470240057f},
-std::array<float,2>{0.195742741f, 0.726789832f},
-std::array<float,2>{0.385536283f, 0.207378611f},
-std::array<float,2>{0.79023999f, 0.774146557f},
-std::array<float,2>{0.992099404f, 0.356025875f},
-std::array<float,2>{0.302940488f, 0.61848563f},
-std::array<float,2>{0.120596588f, 0.0236713551f},
-std::array<float,2>{0.550736368f, 0.91771245f},
-std::array<float,2>{0.653636515f, 0.148505658f},
-std::array<float,2>{0.15050821f, 0.831351161f},
-std::array<float,2>{0.443842173f, 0.394281179f},
-std::array<float,2>{0.858485341f, 0.672734857f},
-std::array<float,2>{0.788171291f, 0.0806100294f},
-std::array<float,2>{0.378515065f, 0.98961556f},
-std::array<float,2>{0.190772474f, 0.277449191f},
-std::array<float,2>{0.718291461f, 0.559435189f},
-std::array<float,2>{0.582296789f, 0.456618339f},
-std::array<float,2>{0.0580855794f, 0.705868661f},
-std::array<float,2>{0.369234234f, 0.229296863f},
-std::array<float,2>{0.933307886f, 0.796221018f},
-std::array<float,2>{0.833845794f, 0.434746653f},
-std::array<float,2>{0.489381522f, 0.643740237f},
-std::array<float,2>{0.169662192f, 0.182321727f},
-std::array<float,2>{0.672209203f, 0.851439297f},
-std::array<float,2>{0.511973739f, 0.0469765849f},
-std::array<float,2>{0.0683698356f, 0.889890909f},
-std::array<float,2>{0.255919755f, 0.31524986f},
-std::array<float,2>{0.967453718f, 0.589359522f},
-std::array<float,2>{0.888880134f, 0.215291694f},
-std::array<float,2>{0.318700284f, 0.767983079f},
-std::array<float,2>{0.0200742837f, 0.479544014f},
-std::array<float,2>{0.614963114f, 0.719384372f},
-std::array<float,2>{0.744616508f, 0.299680561f},
-std::array<float,2>{0.224342093f, 0.526483357f},
-std::array<float,2>{0.422020257f, 0.124900848f},
-std::array<float,2>{0.756125093f, 0.948982835f},
-std::array<float,2>{0.912945628f, 0.490274727f},
-std::array<float,2>{0.34785217f, 0.73871851f},
-std::array<float,2>{0.031479381f, 0.1931113f},
-std::array<float,2>{0.574535489f, 0.762719095f},
-std::array<float,2>{0.687995374f, 0.101949848f},
-std::array<float,2>{0.211329535f, 0.967554688f},
-std::array<float,2>{0.399505585f, 0.296861172f},
-std::array<float,2>{0.797091365f, 0.508311987f},
-std::array<float,2>{0.865148127f, 0.164559677f},
-std::array<float,2>{0.457109958f, 0.861376941f},
-std::array<float,2>{0.135048538f, 0.415754318f},
-std::array<float,2>{0.638462842f, 0.62929225f},
-std::array<float,2>{0.544566929f, 0.334640712f},
-std::array<float,2>{0.106643319f, 0.569053888f},
-std::array<float,2>{0.296665013f, 0.0383459777f},
-std::array<float,2>{0.979875803f, 0.89851737f},
-std::array<float,2>{0.76911962f, 0.258774549f},
-std::array<float,2>{0.41577971f, 0.536237538f},
-std::array<float,2>{0.237929612f, 0.0772906542f},
-std::array<float,2>{0.724139392f, 0.98329699f},
-std::array<float,2>{0.594324529f, 0.249072999f},
-std::array<float,2>{0.0105640171f, 0.806703269f},
-std::array<float,2>{0.339623362f, 0.44990766f},
-std::array<float,2>{0.899944723f, 0.698615193f},
-std::array<float,2>{0.951862693f, 0.00205682172f},
-std::array<float,2>{0.276865751f, 0.926947713f},
-std::array<float,2>{0.0877757967f, 0.370943874f},
-std::array<float,2>{0.527606487f, 0.6025998f},
-std::array<float,2>{0.670652628f, 0.387981534f},
-std::array<float,2>{0.177726582f, 0.665090084f},
-std::array<float,2>{0.472287536f, 0.134464845f},
-std::array<float,2>{0.818833292f, 0.817351282f},
-std::array<float,2>{0.972182751f, 0.303841025f},
-std::array<float,2>{0.28414613f, 0.530850172f},
-std::array<float,2>{0.0995116755f, 0.118324034f},
-std::array<float,2>{0.532559752f, 0.949823558f},
-std::array<float,2>{0.632117569f, 0.214769006f},
-std::array<float,2>{0.129681587f, 0.772622347f},
-std::array<float,2>{0.463961333f, 0.480877787f},
-std::array<float,2>{0.874435186f, 0.72420609f},
-std::array<float,2>{0.80731523f, 0.0530895256f},
-std::array<float,2>{0.397859365f, 0.886379063f},
-std::array<float,2>{0.205587476f, 0.318633437f},
-std::array<float,2>{0.700463235f, 0.592502117f},
-std::array<float,2>{0.56334585f, 0.431994468f},
-std::array<float,2>{0.0438984968f, 0.647043169f},
-std::array<float,2>{0.35241273f, 0.187483698f},
-std::array<float,2>{0.920633852f, 0.843877554f},
-std::array<float,2>{0.825731695f, 0.457031608f},
-std::array<float,2>{0.481562763f, 0.708160996f},
-std::array<float,2>{0.182391092f, 0.233910382f},
-std::array<float,2>{0.66260314f, 0.790049493f},
-std::array<float,2>{0.517015934f, 0.083103992f},
-std::array<float,2>{0.084265776f, 0.985557914f},
-std::array<float,2>{0.267705381f, 0.276932418f},
-std::array<float,2>{0.941111565f, 0.555022955f},
-std::array<float,2>{0.897867858f, 0.155001208f},
-std::array<float,2>{0.335228771f, 0.833316445f},
-std::array<float,2>{0.000623036118f, 0.396411657f},
-std::array<float,2>{0.606663167f, 0.677739322f},
-std::array<float,2>{0.732669175f, 0.355076194f},
-std::array<float,2>{0.248314291f, 0.62197876f},
-std::array<float,2>{0.41281265f, 0.0293605588f},
-std::array<float,2>{0.777897894f, 0.919101238f},
-std::array<float,2>{0.92540139f, 0.383298129f},
-std::array<float,2>{0.359917462f, 0.670898974f},
-std::array<float,2>{0.0480245911f, 0.137823224f},
-std::array<float,2>{0.591598213f, 0.812561274f},
-std::array<float,2>{0.708698869f, 0.00622103782f},
-std::array<float,2>{0.201710135f, 0.922986984f},
-std::array<float,2>{0.389565289f, 0.373537928f},
-std::array<float,2>{0.794555008f, 0.60849905f},
-std::array<float,2>{0.84840709f, 0.244146571f},
-std::array<float,2>{0.445629716f, 0.809500098f},
-std::array<float,2>{0.148127809f, 0.448845565f},
-std::array<float,2>{0.643723547f, 0.701034606f},
-std::array<float,2>{0.559666932f, 0.265411198f},
-std::array<float,2>{0.113278404f, 0.533632994f},
-std::array<float,2>{0.308357358f, 0.0741689578f},
-std::array<float,2>{0.999284327f, 0.978678524f},
-std::array<float,2>{0.764375627f, 0.329895824f},
-std::array<float,2>{0.435996532f, 0.563515306f},
-std::array<float,2>{0.228173897f, 0.0344586037f},
-std::array<float,2>{0.737998903f, 0.90619719f},
-std::array<float,2>{0.623656988f, 0.169015199f},
-std::array<float,2>{0.0271267332f, 0.866713345f},
-std::array<float,2>{0.327787191f, 0.419709921f},
-std::array<float,2>{0.878637791f, 0.627354562f},
-std::array<float,2>{0.955465555f, 0.108863868f},
-std::array<float,2>{0.259840161f, 0.964791894f},
-std::array<float,2>{0.0713479444f, 0.290414929f},
-std::array<float,2>{0.500811994f, 0.512058973f},
-std::array<float,2>{0.68164587f, 0.484860539f},
-std::array<float,2>{0.158454642f, 0.73651886f},
-std::array<float,2>{0.4940947f, 0.190770239f},
-std::array<float,2>{0.838270307f, 0.759162664f},
-std::array<float,2>{0.885736763f, 0.364696205f},
-std::array<float,2>{0.314940631f, 0.599498034f},
-std::array<float,2>{0.0192139801f, 0.013235352f},
-std::array<float,2>{0.61052078f, 0.935655296f},
-std::array<float,2>{0.748727262f, 0.130718604f},
-std::array<float,2>{0.219448179f, 0.822540641f},
-std::array<float,2>{0.426529467f, 0.37909776f},
-std::array<float,2>{0.751440704f, 0.663320005f},
-std::array<float,2>{0.831217587f, 0.0683034882f},
-std::array<float,2>{0.485076785f, 0.973434746f},
-std::array<float,2>{0.167657956f, 0.253792912f},
-std::array<float,2>{0.676880598f, 0.545145154f},
-std::array<float,2>{0.508743882f, 0.441305786f},
-std::array<float,2>{0.0662563443f, 0.69347024f},
-std::array<float,2>{0.25197199f, 0.23914431f},
-std::array<float,2>{0.961293757f, 0.797342002f},
-std::array<float,2>{0.782031834f, 0.413630575f},
-std::array<float,2>{0.380333394f, 0.639212966f},
-std::array<float,2>{0.194231465f, 0.158992842f},
-std::array<float,2>{0.712309182f, 0.872966051f},
-std::array<float,2>{0.580474079f, 0.0411446728f},
-std::array<float,2>{0.0619641989f, 0.895543635f},
-std::array<float,2>{0.37194398f, 0.341545731f},
-std::array<float,2>{0.936590433f, 0.57767719f},
-std::array<float,2>{0.984508753f, 0.195918053f},
-std::array<float,2>{0.297187656f, 0.751592457f},
-std::array<float,2>{0.124336042f, 0.494128466f},
-std::array<float,2>{0.553596973f, 0.746911883f},
-std::array<float,2>{0.649775982f, 0.286812246f},
-std::array<float,2>{0.154299125f, 0.500667632f},
-std::array<float,2>{0.440199792f, 0.0942247286f},
-std::array<float,2>{0.851613581f, 0.954309523f},
-std::array<float,2>{0.947146416f, 0.473243952f},
-std::array<float,2>{0.280357361f, 0.731366038f},
-std::array<float,2>{0.0928219333f, 0.206152961f},
-std::array<float,2>{0.526629925f, 0.7779423f},
-std::array<float,2>{0.666003644f, 0.115380473f},
-std::array<float,2>{0.174834907f, 0.940580904f},
-std::array<float,2>{0.473567635f, 0.306491286f},
-std::array<float,2>{0.813323915f, 0.518566668f},
-std::array<float,2>{0.771568954f, 0.172415286f},
-std::array<float,2>{0.419783384f, 0.854079783f},
-std::array<float,2>{0.240602478f, 0.42242682f},
-std::array<float,2>{0.720027328f, 0.648619533f},
-std::array<float,2>{0.598797321f, 0.324136853f},
-std::array<float,2>{0.0124904839f, 0.581133246f},
-std::array<float,2>{0.343142897f, 0.0615611784f},
-std::array<float,2>{0.902925849f, 0.877265394f},
-std::array<float,2>{0.860208154f, 0.26650238f},
-std::array<float,2>{0.453846723f, 0.553370178f},
-std::array<float,2>{0.137160689f, 0.0898075029f},
-std::array<float,2>{0.633707821f, 0.999984682f},
-std::array<float,2>{0.541333854f, 0.223571688f},
-std::array<float,2>{0.103279546f, 0.783984542f},
-std::array<float,2>{0.292227775f, 0.466005147f},
-std::array<float,2>{0.980997741f, 0.7118873f},
-std::array<float,2>{0.909199536f, 0.0232381802f},
-std::array<float,2>{0.346714586f, 0.911359727f},
-std::array<float,2>{0.037638519f, 0.350263149f},
-std::array<float,2>{0.573680699f, 0.616235197f},
-std::array<float,2>{0.69155544f, 0.401692778f},
-std::array<float,2>{0.21694088f, 0.682334721f},
-std::array<float,2>{0.403280944f, 0.147753865f},
-std::array<float,2>{0.8035146f, 0.836096823f},
-std::array<float,2>{0.914195836f, 0.257491648f},
-std::array<float,2>{0.355694294f, 0.541534483f},
-std::array<float,2>{0.0405792743f, 0.0645660535f},
-std::array<float,2>{0.568404377f, 0.970245838f},
-std::array<float,2>{0.697817326f, 0.236087754f},
-std::array<float,2>{0.207034096f, 0.804270446f},
-std::array<float,2>{0.393954188f, 0.44421801f},
-std::array<float,2>{0.810571492f, 0.688250244f},
-std::array<float,2>{0.87015456f, 0.0081432052f},
-std::array<float,2>{0.468545258f, 0.930564046f},
-std::array<float,2>{0.125782982f, 0.361023933f},
-std::array<float,2>{0.628871679f, 0.596973002f},
-std::array<float,2>{0.538449883f, 0.377949238f},
-std::array<float,2>{0.0964007229f, 0.659374893f},
-std::array<float,2>{0.287886411f, 0.126308545f},
-std::array<float,2>{0.975066066f, 0.825506568f},
-std::array<float,2>{0.774160326f, 0.498826653f},
-std::array<float,2>{0.409633189f, 0.74274981f},
-std::array<float,2>{0.243069097f, 0.199665755f},
-std::array<float,2>{0.7283445f, 0.75506109f},
-std::array<float,2>{0.605427682f, 0.0998005643f},
-std::array<float,2>{0.00676488737f, 0.957545638f},
-std::array<float,2>{0.329165697f, 0.284882873f},
-std::array<float,2>{0.893017828f, 0.504296482f},
-std::array<float,2>{0.945040107f, 0.163500309f},
-std::array<float,2>{0.271309346f, 0.869849384f},
-std::array<float,2>{0.0789571628f, 0.406828403f},
-std::array<float,2>{0.520837724f, 0.634582579f},
-std::array<float,2>{0.658047199f, 0.338302851f},
-std::array<float,2>{0.185583234f, 0.574079871f},
-std::array<float,2>{0.477506816f, 0.0465029515f},
-std::array<float,2>{0.822876334f, 0.893011212f},
-std::array<float,2>{0.995522678f, 0.427593231f},
-std::array<float,2>{0.311785311f, 0.654912174f},
-std::array<float,2>{0.114884086f, 0.176724195f},
-std::array<float,2>{0.557214081f, 0.859112144f},
-std::array<float,2>{0.648116767f, 0.0552196242f},
-std::array<float,2>{0.14077799f, 0.881940305f},
-std::array<float,2>{0.449828357f, 0.325696856f},
-std::array<float,2>{0.846022308f, 0.58499974f},
-std::array<float,2>{0.791658938f, 0.209322423f},
-std::array<float,2>{0.384492725f, 0.775434673f},
-std::array<float,2>{0.198561415f, 0.471696645f},
-std::array<float,2>{0.704159081f, 0.729008794f},
-std::array<float,2>{0.586866975f, 0.311733007f},
-std::array<float,2>{0.0529514663f, 0.520305991f},
-std::array<float,2>{0.366212517f, 0.11272683f},
-std::array<float,2>{0.928569794f, 0.943703115f},
-std::array<float,2>{0.841714501f, 0.34563157f},
-std::array<float,2>{0.497451544f, 0.611661375f},
-std::array<float,2>{0.162106276f, 0.0158442147f},
-std::array<float,2>{0.684184492f, 0.90661937f},
-std::array<float,2>{0.506467581f, 0.142702833f},
-std::array<float,2>{0.0746618286f, 0.842423439f},
-std::array<float,2>{0.263214678f, 0.40296644f},
-std::array<float,2>{0.959972739f, 0.68553865f},
-std::array<float,2>{0.882545471f, 0.0920086354f},
-std::array<float,2>{0.320824683f, 0.996026576f},
-std::array<float,2>{0.031088423f, 0.270503461f},
-std::array<float,2>{0.617240965f, 0.548789263f},
-std::array<float,2>{0.74148798f, 0.463669807f},
-std::array<float,2>{0.232272133f, 0.716086805f},
-std::array<float,2>{0.432962507f, 0.219630077f},
-std::array<float,2>{0.759963334f, 0.787891448f},
-std::array<float,2>{0.966404617f, 0.313516647f},
-std::array<float,2>{0.254774898f, 0.58702755f},
-std::array<float,2>{0.066917859f, 0.0501195267f},
-std::array<float,2>{0.514142573f, 0.887392819f},
-std::array<float,2>{0.675609708f, 0.181244195f},
-std::array<float,2>{0.17162925f, 0.848225713f},
-std::array<float,2>{0.490712196f, 0.436935633f},
-std::array<float,2>{0.835346341f, 0.641463935f},
-std::array<float,2>{0.754149437f, 0.122233324f},
-std::array<float,2>{0.425255418f, 0.947070837f},
-std::array<float,2>{0.22592777f, 0.298300058f},
-std::array<float,2>{0.743988335f, 0.523678362f},
-std::array<float,2>{0.61639601f, 0.477584362f},
-std::array<float,2>{0.0222739913f, 0.720895648f},
-std::array<float,2>{0.316679776f, 0.217218503f},
-std::array<float,2>{0.888181806f, 0.765673816f},
-std::array<float,2>{0.855993569f, 0.390732586f},
-std::array<float,2>{0.441667616f, 0.674541414f},
-std::array<float,2>{0.148452938f, 0.150720939f},
-std::array<float,2>{0.655892491f, 0.829747915f},
-std::array<float,2>{0.547904968f, 0.0256202184f},
-std::array<float,2>{0.118010215f, 0.914214671f},
-std::array<float,2>{0.301002443f, 0.357973635f},
-std::array<float,2>{0.989324391f, 0.620211542f},
-std::array<float,2>{0.931059599f, 0.227216482f},
-std::array<float,2>{0.368245482f, 0.793989956f},
-std::array<float,2>{0.0564656258f, 0.453366876f},
-std::array<float,2>{0.584647179f, 0.705039442f},
-std::array<float,2>{0.716776431f, 0.280502766f},
-std::array<float,2>{0.189175099f, 0.561241448f},
-std::array<float,2>{0.376265943f, 0.0783792213f},
-std::array<float,2>{0.785343826f, 0.991441905f},
-std::array<float,2>{0.902322531f, 0.452689171f},
-std::array<float,2>{0.337225199f, 0.695675611f},
-std::array<float,2>{0.00917881168f, 0.247418463f},
-std::array<float,2>{0.596550763f, 0.805870593f},
-std::array<float,2>{0.724731863f, 0.074836649f},
-std::array<float,2>{0.236321718f, 0.981107295f},
-std::array<float,2>{0.416972101f, 0.261062831f},
-std::array<float,2>{0.767198503f, 0.53746593f},
-std::array<float,2>{0.816476822f, 0.135812446f},
-std::array<float,2>{0.469438821f, 0.820198834f},
-std::array<float,2>{0.179320946f, 0.390601933f},
-std::array<float,2>{0.669363856f, 0.667761743f},
-std::array<float,2>{0.529646337f, 0.367469221f},
-std::array<float,2>{0.089053981f, 0.603761315f},
-std::array<float,2>{0.274479121f, 0.00124667748f},
-std::array<float,2>{0.950231075f, 0.929498494f},
-std::array<float,2>{0.800614417f, 0.294195145f},
-std::array<float,2>{0.400700092f, 0.510256886f},
-std::array<float,2>{0.214479476f, 0.105101161f},
-std::array<float,2>{0.690885007f, 0.96487397f},
-std::array<float,2>{0.576524794f, 0.194204912f},
-std::array<float,2>{0.0342059396f, 0.764248967f},
-std::array<float,2>{0.350052923f, 0.488290071f},
-std::array<float,2>{0.911358058f, 0.74153322f},
-std::array<float,2>{0.977580786f, 0.0359727032f},
-std::array<float,2>{0.294506341f, 0.9013592f},
-std::array<float,2>{0.109206535f, 0.333949655f},
-std::array<float,2>{0.544983029f, 0.567393184f},
-std::array<float,2>{0.63940537f, 0.4168109f},
-std::array<float,2>{0.133216724f, 0.632512867f},
-std::array<float,2>{0.459757179f, 0.166677997f},
-std::array<float,2>{0.866951406f, 0.859731257f},
-std::array<float,2>{0.954200149f, 0.28910777f},
-std::array<float,2>{0.258289874f, 0.512819409f},
-std::array<float,2>{0.0740376338f, 0.107724324f},
-std::array<float,2>{0.503177702f, 0.963718355f},
-std::array<float,2>{0.681638479f, 0.190028876f},
-std::array<float,2>{0.156747252f, 0.758680522f},
-std::array<float,2>{0.495744854f, 0.485696882f},
-std::array<float,2>{0.836562753f, 0.737461805f},
-std::array<float,2>{0.762906015f, 0.0334881917f},
-std::array<float,2>{0.434988946f, 0.904541969f},
-std::array<float,2>{0.229703784f, 0.328410178f},
-std::array<float,2>{0.734702349f, 0.562805414f},
-std::array<float,2>{0.622098804f, 0.418313384f},
-std::array<float,2>{0.024957506f, 0.62888962f},
-std::array<float,2>{0.326114297f, 0.168422863f},
-std::array<float,2>{0.875959158f, 0.865582883f},
-std::array<float,2>{0.85104394f, 0.447521389f},
-std::array<float,2>{0.447709322f, 0.699698031f},
-std::array<float,2>{0.146230265f, 0.245953158f},
-std::array<float,2>{0.641991794f, 0.810181677f},
-std::array<float,2>{0.561612785f, 0.0725477934f},
-std::array<float,2>{0.111297324f, 0.979617298f},
-std::array<float,2>{0.30607605f, 0.264294207f},
-std::array<float,2>{0.997527301f, 0.534283817f},
-std::array<float,2>{0.922144651f, 0.137588158f},
-std::array<float,2>{0.362323314f, 0.813741148f},
-std::array<float,2>{0.050640624f, 0.384517044f},
-std::array<float,2>{0.59257257f, 0.670772552f},
-std::array<float,2>{0.710642934f, 0.374216497f},
-std::array<float,2>{0.199422359f, 0.607863188f},
-std::array<float,2>{0.387758881f, 0.00763154402f},
-std::array<float,2>{0.794988632f, 0.922361434f},
-std::array<float,2>{0.894915521f, 0.395354688f},
-std::array<float,2>{0.333822131f, 0.678846538f},
-std::array<float,2>{0.00297567062f, 0.155316025f},
-std::array<float,2>{0.609361053f, 0.832648635f},
-std::array<float,2>{0.731638134f, 0.0306060947f},
-std::array<float,2>{0.246671006f, 0.918520868f},
-std::array<float,2>{0.411041439f, 0.354272425f},
-std::array<float,2>{0.780224204f, 0.622808933f},
-std::array<float,2>{0.827598751f, 0.232580721f},
-std::array<float,2>{0.484023154f, 0.789654195f},
-std::array<float,2>{0.181105405f, 0.458057433f},
-std::array<float,2>{0.660449982f, 0.707982361f},
-std::array<float,2>{0.51797086f, 0.27635625f},
-std::array<float,2>{0.082111977f, 0.556360781f},
-std::array<float,2>{0.266258925f, 0.0825597644f},
-std::array<float,2>{0.938206792f, 0.984982252f},
-std::array<float,2>{0.805565536f, 0.319852352f},
-std::array<float,2>{0.395212948f, 0.593654931f},
-std::array<float,2>{0.203312069f, 0.0537998155f},
-std::array<float,2>{0.701963603f, 0.885359049f},
-std::array<float,2>{0.565452218f, 0.186398387f},
-std::array<float,2>{0.0453021154f, 0.845473528f},
-std::array<float,2>{0.353905529f, 0.432874978f},
-std::array<float,2>{0.918327332f, 0.647980154f},
-std::array<float,2>{0.969849586f, 0.117696904f},
-std::array<float,2>{0.282450199f, 0.950779855f},
-std::array<float,2>{0.100960746f, 0.302807599f},
-std::array<float,2>{0.534764886f, 0.529759347f},
-std::array<float,2>{0.629903376f, 0.481730431f},
-std::array<float,2>{0.13209562f, 0.723432362f},
-std::array<float,2>{0.461160243f, 0.213141784f},
-std::array<float,2>{0.871348798f, 0.772413969f},
-std::array<float,2>{0.906860352f, 0.351388186f},
-std::array<float,2>{0.345469356f, 0.615830779f},
-std::array<float,2>{0.0361684486f, 0.0216084402f},
-std::array<float,2>{0.570473969f, 0.91053158f},
-std::array<float,2>{0.694547534f, 0.147060826f},
-std::array<float,2>{0.215790421f, 0.83741945f},
-std::array<float,2>{0.40611887f, 0.400402635f},
-std::array<float,2>{0.801213026f, 0.682920158f},
-std::array<float,2>{0.86223805f, 0.0886867046f},
-std::array<float,2>{0.455601722f, 0.998758256f},
-std::array<float,2>{0.138905615f, 0.267410696f},
-std::array<float,2>{0.635258973f, 0.554188073f},
-std::array<float,2>{0.539478362f, 0.465329289f},
-std::array<float,2>{0.105266698f, 0.712543249f},
-std::array<float,2>{0.290888548f, 0.224254847f},
-std::array<float,2>{0.984016597f, 0.784627318f},
-std::array<float,2>{0.771357954f, 0.423284173f},
-std::array<float,2>{0.420853436f, 0.649582684f},
-std::array<float,2>{0.238285363f, 0.173601329f},
-std::array<float,2>{0.721805394f, 0.855449498f},
-std::array<float,2>{0.600160599f, 0.0615046918f},
-std::array<float,2>{0.0153511334f, 0.878044426f},
-std::array<float,2>{0.341720998f, 0.32254678f},
-std::array<float,2>{0.905138195f, 0.580840766f},
-std::array<float,2>{0.947569609f, 0.205638722f},
-std::array<float,2>{0.278648347f, 0.779169798f},
-std::array<float,2>{0.0914857239f, 0.474381834f},
-std::array<float,2>{0.524483085f, 0.732354939f},
-std::array<float,2>{0.666376233f, 0.305555463f},
-std::array<float,2>{0.172965109f, 0.517991543f},
-std::array<float,2>{0.475774109f, 0.116632223f},
-std::array<float,2>{0.816317201f, 0.939882338f},
-std::array<float,2>{0.987254202f, 0.492269903f},
-std::array<float,2>{0.299084544f, 0.747844875f},
-std::array<float,2>{0.123000354f, 0.196322963f},
-std::array<float,2>{0.552248716f, 0.75033015f},
-std::array<float,2>{0.652024269f, 0.0947442576f},
-std::array<float,2>{0.153202459f, 0.953412116f},
-std::array<float,2>{0.438885182f, 0.28591007f},
-std::array<float,2>{0.854331136f, 0.501441836f},
-std::array<float,2>{0.78406167f, 0.159280688f},
-std::array<float,2>{0.382578909f, 0.871291637f},
-std::array<float,2>{0.191638738f, 0.412269443f},
-std::array<float,2>{0.713449061f, 0.640142798f},
-std::array<float,2>{0.579218984f, 0.340509474f},
-std::array<float,2>{0.0602695607f, 0.576532245f},
-std::array<float,2>{0.374241531f, 0.0422194563f},
-std::array<float,2>{0.934587181f, 0.894739628f},
-std::array<float,2>{0.828303814f, 0.252600551f},
-std::array<float,2>{0.487793297f, 0.546352983f},
-std::array<float,2>{0.165115312f, 0.0664875135f},
-std::array<float,2>{0.679392278f, 0.974226058f},
-std::array<float,2>{0.510096192f, 0.239687726f},
-std::array<float,2>{0.0636236221f, 0.798051834f},
-std::array<float,2>{0.250958711f, 0.439730704f},
-std::array<float,2>{0.962980866f, 0.694366813f},
-std::array<float,2>{0.883682132f, 0.0119998502f},
-std::array<float,2>{0.313159376f, 0.937091649f},
-std::array<float,2>{0.0166107658f, 0.363920242f},
-std::array<float,2>{0.612379253f, 0.597764552f},
-std::array<float,2>{0.747677982f, 0.380526751f},
-std::array<float,2>{0.222523704f, 0.662895799f},
-std::array<float,2>{0.428408414f, 0.12916027f},
-std::array<float,2>{0.752503633f, 0.823325753f},
-std::array<float,2>{0.879494369f, 0.270546436f},
-std::array<float,2>{0.322402418f, 0.547080934f},
-std::array<float,2>{0.0280196499f, 0.0934979767f},
-std::array<float,2>{0.619486928f, 0.994321883f},
-std::array<float,2>{0.739699483f, 0.220171124f},
-std::array<float,2>{0.232786268f, 0.788966596f},
-std::array<float,2>{0.43144986f, 0.46439141f},
-std::array<float,2>{0.759353697f, 0.715162158f},
-std::array<float,2>{0.842799306f, 0.0166724101f},
-std::array<float,2>{0.498912036f, 0.908182979f},
-std::array<float,2>{0.163485602f, 0.344386429f},
-std::array<float,2>{0.686922491f, 0.613248587f},
-std::array<float,2>{0.504405737f, 0.403924674f},
-std::array<float,2>{0.0779985338f, 0.68380326f},
-std::array<float,2>{0.263858289f, 0.144123286f},
-std::array<float,2>{0.957459152f, 0.843541682f},
-std::array<float,2>{0.789116204f, 0.471451133f},
-std::array<float,2>{0.386405766f, 0.729997635f},
-std::array<float,2>{0.196513295f, 0.210130379f},
-std::array<float,2>{0.706257164f, 0.77693373f},
-std::array<float,2>{0.589083552f, 0.111852512f},
-std::array<float,2>{0.0525425039f, 0.944889784f},
-std::array<float,2>{0.364228308f, 0.311457068f},
-std::array<float,2>{0.926663697f, 0.521462977f},
-std::array<float,2>{0.992459893f, 0.177694798f},
-std::array<float,2>{0.310472757f, 0.857647061f},
-std::array<float,2>{0.115787521f, 0.426202804f},
-std::array<float,2>{0.55509311f, 0.655898094f},
-std::array<float,2>{0.645395279f, 0.3249816f},
-std::array<float,2>{0.142671943f, 0.584588885f},
-std::array<float,2>{0.45127213f, 0.0556845665f},
-std::array<float,2>{0.845555604f, 0.881219566f},
-std::array<float,2>{0.941441059f, 0.407821327f},
-std::array<float,2>{0.272979707f, 0.632988453f},
-std::array<float,2>{0.0806457028f, 0.162900209f},
-std::array<float,2>{0.523054481f, 0.870939493f},
-std::array<float,2>{0.659387052f, 0.0452265553f},
-std::array<float,2>{0.183794931f, 0.89398247f},
-std::array<float,2>{0.478825957f, 0.339538932f},
-std::array<float,2>{0.821143031f, 0.572863698f},
-std::array<float,2>{0.775854588f, 0.201012492f},
-std::array<float,2>{0.407967776f, 0.754290342f},
-std::array<float,2>{0.24608852f, 0.499363333f},
-std::array<float,2>{0.728843749f, 0.743671179f},
-std::array<float,2>{0.602077186f, 0.283330947f},
-std::array<float,2>{0.00398267852f, 0.505450189f},
-std::array<float,2>{0.332012355f, 0.100930855f},
-std::array<float,2>{0.892575026f, 0.958795726f},
-std::array<float,2>{0.868299127f, 0.359477907f},
-std::array<float,2>{0.465990216f, 0.59606117f},
-std::array<float,2>{0.127604768f, 0.00909661036f},
-std::array<float,2>{0.625971377f, 0.93104434f},
-std::array<float,2>{0.536112905f, 0.125641137f},
-std::array<float,2>{0.0939866453f, 0.824903667f},
-std::array<float,2>{0.285354406f, 0.377004385f},
-std::array<float,2>{0.974407554f, 0.658434212f},
-std::array<float,2>{0.916307449f, 0.0655773506f},
-std::array<float,2>{0.357694924f, 0.969091058f},
-std::array<float,2>{0.0417994559f, 0.256629139f},
-std::array<float,2>{0.566985488f, 0.542834461f},
-std::array<float,2>{0.696702719f, 0.444402218f},
-std::array<float,2>{0.210485518f, 0.688818693f},
-std::array<float,2>{0.391647786f, 0.23447144f},
-std::array<float,2>{0.810202718f, 0.803168416f},
-std::array<float,2>{0.979142487f, 0.332260758f},
-std::array<float,2>{0.295681596f, 0.566623628f},
-std::array<float,2>{0.105905019f, 0.0363452919f},
-std::array<float,2>{0.543347239f, 0.901896656f},
-std::array<float,2>{0.637296975f, 0.167893887f},
-std::array<float,2>{0.13620086f, 0.860714376f},
-std::array<float,2>{0.458449125f, 0.417015374f},
-std::array<float,2>{0.864080608f, 0.631424129f},
-std::array<float,2>{0.797922075f, 0.104475632f},
-std::array<float,2>{0.398917824f, 0.966593087f},
-std::array<float,2>{0.212519109f, 0.293477476f},
-std::array<float,2>{0.688538432f, 0.510861874f},
-std::array<float,2>{0.57573247f, 0.489967555f},
-std::array<float,2>{0.0329356752f, 0.741185069f},
-std::array<float,2>{0.349529445f, 0.19435291f},
-std::array<float,2>{0.913114667f, 0.765488207f},
-std::array<float,2>{0.819795609f, 0.38963291f},
-std::array<float,2>{0.471554786f, 0.666330934f},
-std::array<float,2>{0.176560268f, 0.135207281f},
-std::array<float,2>{0.671833158f, 0.818359494f},
-std::array<float,2>{0.528877497f, 4.83581352e-05f},
-std::array<float,2>{0.0861202031f, 0.927800536f},
-std::array<float,2>{0.275560647f, 0.368923873f},
-std::array<float,2>{0.952551365f, 0.604721904f},
-std::array<float,2>{0.899337113f, 0.246476367f},
-std::array<float,2>{0.338443875f, 0.805253029f},
-std::array<float,2>{0.0116366949f, 0.452037364f},
-std::array<float,2>{0.595137894f, 0.696870148f},
-std::array<float,2>{0.72321713f, 0.260468185f},
-std::array<float,2>{0.237279221f, 0.538578868f},
-std::array<float,2>{0.414092064f, 0.075509049f},
-std::array<float,2>{0.768194139f, 0.981743276f},
-std::array<float,2>{0.932271421f, 0.454528362f},
-std::array<float,2>{0.370149851f, 0.703707337f},
-std::array<float,2>{0.056948442f, 0.22781755f},
-std::array<float,2>{0.583027005f, 0.793392599f},
-std::array<float,2>{0.717225075f, 0.0791458562f},
-std::array<float,2>{0.189791173f, 0.990508139f},
-std::array<float,2>{0.377252012f, 0.280221254f},
-std::array<float,2>{0.787159383f, 0.562197924f},
-std::array<float,2>{0.858065069f, 0.152015746f},
-std::array<float,2>{0.444642246f, 0.82812798f},
-std::array<float,2>{0.152335465f, 0.391890407f},
-std::array<float,2>{0.652730703f, 0.675362051f},
-std::array<float,2>{0.549545884f, 0.359159142f},
-std::array<float,2>{0.119569175f, 0.619796038f},
-std::array<float,2>{0.303729355f, 0.026696343f},
-std::array<float,2>{0.990305781f, 0.915193498f},
-std::array<float,2>{0.756902814f, 0.297014385f},
-std::array<float,2>{0.422927916f, 0.525156915f},
-std::array<float,2>{0.223361686f, 0.121367976f},
-std::array<float,2>{0.745208979f, 0.945946276f},
-std::array<float,2>{0.613308609f, 0.217866436f},
-std::array<float,2>{0.0213840213f, 0.766993165f},
-std::array<float,2>{0.320037663f, 0.477268696f},
-std::array<float,2>{0.890245378f, 0.722088575f},
-std::array<float,2>{0.968079984f, 0.049798727f},
-std::array<float,2>{0.257475644f, 0.888099849f},
-std::array<float,2>{0.0699169412f, 0.312929392f},
-std::array<float,2>{0.513022721f, 0.586083174f},
-std::array<float,2>{0.673062027f, 0.436362505f},
-std::array<float,2>{0.168222874f, 0.642020583f},
-std::array<float,2>{0.489053905f, 0.180359036f},
-std::array<float,2>{0.832938254f, 0.849532783f},
-std::array<float,2>{0.998126984f, 0.26289162f},
-std::array<float,2>{0.306657642f, 0.531880796f},
-std::array<float,2>{0.111807957f, 0.0707991123f},
-std::array<float,2>{0.559360683f, 0.977367938f},
-std::array<float,2>{0.642866433f, 0.243690655f},
-std::array<float,2>{0.147139505f, 0.811708391f},
-std::array<float,2>{0.446911901f, 0.445618361f},
-std::array<float,2>{0.848902762f, 0.701395094f},
-std::array<float,2>{0.793898225f, 0.00412178552f},
-std::array<float,2>{0.390399158f, 0.92492795f},
-std::array<float,2>{0.202871144f, 0.373043269f},
-std::array<float,2>{0.707609832f, 0.606111765f},
-std::array<float,2>{0.590244234f, 0.386392295f},
-std::array<float,2>{0.0469493531f, 0.668605387f},
-std::array<float,2>{0.361091137f, 0.140086323f},
-std::array<float,2>{0.92463243f, 0.81558007f},
-std::array<float,2>{0.839433491f, 0.486831456f},
-std::array<float,2>{0.493001401f, 0.734735727f},
-std::array<float,2>{0.159258187f, 0.188110098f},
-std::array<float,2>{0.682988167f, 0.760995388f},
-std::array<float,2>{0.501371443f, 0.107135415f},
-std::array<float,2>{0.0704132542f, 0.96228224f},
-std::array<float,2>{0.261521876f, 0.291861057f},
-std::array<float,2>{0.956771493f, 0.513942838f},
-std::array<float,2>{0.877465487f, 0.170759171f},
-std::array<float,2>{0.326833755f, 0.863317192f},
-std::array<float,2>{0.0259309765f, 0.420139879f},
-std::array<float,2>{0.624548435f, 0.626278877f},
-std::array<float,2>{0.736767948f, 0.331044286f},
-std::array<float,2>{0.227519974f, 0.564677954f},
-std::array<float,2>{0.437431663f, 0.0328981839f},
-std::array<float,2>{0.765435636f, 0.903036714f},
-std::array<float,2>{0.92132026f, 0.429722756f},
-std::array<float,2>{0.352580965f, 0.645198762f},
-std::array<float,2>{0.0446049161f, 0.184554175f},
-std::array<float,2>{0.563921988f, 0.846454024f},
-std::array<float,2>{0.699788868f, 0.0524276532f},
-std::array<float,2>{0.206626609f, 0.884513557f},
-std::array<float,2>{0.397413254f, 0.318109185f},
-std::array<float,2>{0.807624578f, 0.590347052f},
-std::array<float,2>{0.873269022f, 0.212067097f},
-std::array<float,2>{0.463405252f, 0.770238221f},
-std::array<float,2>{0.130706042f, 0.484046787f},
-std::array<float,2>{0.631078959f, 0.725029945f},
-std::array<float,2>{0.531317353f, 0.30113399f},
-std::array<float,2>{0.0981963575f, 0.527916789f},
-std::array<float,2>{0.285010576f, 0.120414406f},
-std::array<float,2>{0.971247196f, 0.952145755f},
-std::array<float,2>{0.77927351f, 0.35247004f},
-std::array<float,2>{0.413397133f, 0.623970747f},
-std::array<float,2>{0.249740303f, 0.0286270976f},
-std::array<float,2>{0.733546555f, 0.920686305f},
-std::array<float,2>{0.606149733f, 0.152886733f},
-std::array<float,2>{0.00116854173f, 0.834825933f},
-std::array<float,2>{0.334346563f, 0.396884143f},
-std::array<float,2>{0.896798134f, 0.676022112f},
-std::array<float,2>{0.940234601f, 0.0848845094f},
-std::array<float,2>{0.26867348f, 0.986745059f},
-std::array<float,2>{0.0858611092f, 0.273814887f},
-std::array<float,2>{0.51590693f, 0.55808121f},
-std::array<float,2>{0.66313833f, 0.459899366f},
-std::array<float,2>{0.18309249f, 0.709493995f},
-std::array<float,2>{0.480558634f, 0.23068653f},
-std::array<float,2>{0.824586689f, 0.792085767f},
-std::array<float,2>{0.904294252f, 0.321573883f},
-std::array<float,2>{0.341984779f, 0.58003509f},
-std::array<float,2>{0.0133662866f, 0.0595927984f},
-std::array<float,2>{0.597807407f, 0.876379907f},
-std::array<float,2>{0.719645619f, 0.1754269f},
-std::array<float,2>{0.241558895f, 0.853022635f},
-std::array<float,2>{0.418408334f, 0.424184561f},
-std::array<float,2>{0.773103654f, 0.65203923f},
-std::array<float,2>{0.813577294f, 0.114620216f},
-std::array<float,2>{0.473894119f, 0.937919021f},
-std::array<float,2>{0.173831806f, 0.308131635f},
-std::array<float,2>{0.66460979f, 0.516420364f},
-std::array<float,2>{0.525878668f, 0.475655138f},
-std::array<float,2>{0.0925489292f, 0.734207749f},
-std::array<float,2>{0.280079454f, 0.203129411f},
-std::array<float,2>{0.94611758f, 0.780253291f},
-std::array<float,2>{0.804174483f, 0.399086356f},
-std::array<float,2>{0.403460652f, 0.68147856f},
-std::array<float,2>{0.218331233f, 0.1451502f},
-std::array<float,2>{0.69283551f, 0.838222742f},
-std::array<float,2>{0.572813451f, 0.0201057382f},
-std::array<float,2>{0.0387018248f, 0.913787901f},
-std::array<float,2>{0.345935673f, 0.348483026f},
-std::array<float,2>{0.908825815f, 0.614484906f},
-std::array<float,2>{0.981487691f, 0.224827543f},
-std::array<float,2>{0.291932642f, 0.782560885f},
-std::array<float,2>{0.101813659f, 0.467854679f},
-std::array<float,2>{0.542117476f, 0.714803934f},
-std::array<float,2>{0.634724557f, 0.268362314f},
-std::array<float,2>{0.137811035f, 0.551664531f},
-std::array<float,2>{0.454167545f, 0.0869969353f},
-std::array<float,2>{0.860948205f, 0.997116089f},
-std::array<float,2>{0.962107599f, 0.438668728f},
-std::array<float,2>{0.253231108f, 0.691610277f},
-std::array<float,2>{0.0649729297f, 0.241203293f},
-std::array<float,2>{0.509371936f, 0.799235463f},
-std::array<float,2>{0.67650795f, 0.0694006383f},
-std::array<float,2>{0.166227445f, 0.975244701f},
-std::array<float,2>{0.486239374f, 0.250468612f},
-std::array<float,2>{0.830589354f, 0.5447191f},
-std::array<float,2>{0.750880778f, 0.130944684f},
-std::array<float,2>{0.427172601f, 0.822094798f},
-std::array<float,2>{0.220071897f, 0.382322282f},
-std::array<float,2>{0.74912858f, 0.660655439f},
-std::array<float,2>{0.609862447f, 0.365635753f},
-std::array<float,2>{0.0182540156f, 0.600441456f},
-std::array<float,2>{0.315976709f, 0.0150244059f},
-std::array<float,2>{0.885887086f, 0.933923662f},
-std::array<float,2>{0.852731764f, 0.288493276f},
-std::array<float,2>{0.440527469f, 0.502783418f},
-std::array<float,2>{0.155951709f, 0.0974981561f},
-std::array<float,2>{0.648814678f, 0.956055224f},
-std::array<float,2>{0.554112375f, 0.197290003f},
-std::array<float,2>{0.123899058f, 0.752764583f},
-std::array<float,2>{0.298649341f, 0.494968176f},
-std::array<float,2>{0.985795379f, 0.749657035f},
-std::array<float,2>{0.936254919f, 0.0407210402f},
-std::array<float,2>{0.372377545f, 0.897161186f},
-std::array<float,2>{0.0608993806f, 0.343337774f},
-std::array<float,2>{0.581973612f, 0.575654924f},
-std::array<float,2>{0.711404741f, 0.410418123f},
-std::array<float,2>{0.194690049f, 0.638027728f},
-std::array<float,2>{0.379024833f, 0.157830879f},
-std::array<float,2>{0.782328904f, 0.873968542f},
-std::array<float,2>{0.929583669f, 0.309749871f},
-std::array<float,2>{0.36523807f, 0.522799969f},
-std::array<float,2>{0.0540425479f, 0.110751167f},
-std::array<float,2>{0.587679386f, 0.942620575f},
-std::array<float,2>{0.703814328f, 0.208643511f},
-std::array<float,2>{0.197479427f, 0.774697125f},
-std::array<float,2>{0.383097351f, 0.469697148f},
-std::array<float,2>{0.792665124f, 0.727998734f},
-std::array<float,2>{0.847088695f, 0.0581602901f},
-std::array<float,2>{0.450609118f, 0.879694521f},
-std::array<float,2>{0.142285705f, 0.32631892f},
-std::array<float,2>{0.64688766f, 0.583382249f},
-std::array<float,2>{0.55761832f, 0.429438263f},
-std::array<float,2>{0.11362657f, 0.6535182f},
-std::array<float,2>{0.31135112f, 0.177772745f},
-std::array<float,2>{0.99480921f, 0.856953859f},
-std::array<float,2>{0.761116147f, 0.462037683f},
-std::array<float,2>{0.432245433f, 0.717701614f},
-std::array<float,2>{0.230763033f, 0.222444177f},
-std::array<float,2>{0.740388393f, 0.785589278f},
-std::array<float,2>{0.61868155f, 0.0906560868f},
-std::array<float,2>{0.0298474971f, 0.9927845f},
-std::array<float,2>{0.321973205f, 0.273035407f},
-std::array<float,2>{0.881670177f, 0.550244689f},
-std::array<float,2>{0.959593832f, 0.142516792f},
-std::array<float,2>{0.262571722f, 0.840554297f},
-std::array<float,2>{0.0759722218f, 0.405314863f},
-std::array<float,2>{0.507005811f, 0.685774982f},
-std::array<float,2>{0.684939206f, 0.345845282f},
-std::array<float,2>{0.161052749f, 0.611234605f},
-std::array<float,2>{0.49640426f, 0.0180504322f},
-std::array<float,2>{0.840054333f, 0.909603417f},
-std::array<float,2>{0.97563839f, 0.375618845f},
-std::array<float,2>{0.289025813f, 0.658140481f},
-std::array<float,2>{0.0969970524f, 0.127728075f},
-std::array<float,2>{0.537888706f, 0.82680577f},
-std::array<float,2>{0.627492726f, 0.0103484355f},
-std::array<float,2>{0.126323923f, 0.9334656f},
-std::array<float,2>{0.467475474f, 0.362239659f},
-std::array<float,2>{0.869754016f, 0.594011962f},
-std::array<float,2>{0.8120507f, 0.237031966f},
-std::array<float,2>{0.393067926f, 0.801122308f},
-std::array<float,2>{0.20846799f, 0.442082375f},
-std::array<float,2>{0.698923469f, 0.691012263f},
-std::array<float,2>{0.569894135f, 0.254755586f},
-std::array<float,2>{0.0394458808f, 0.539173961f},
-std::array<float,2>{0.357140124f, 0.0631419271f},
-std::array<float,2>{0.915955603f, 0.970923424f},
-std::array<float,2>{0.823910534f, 0.33594811f},
-std::array<float,2>{0.478348494f, 0.571754873f},
-std::array<float,2>{0.187476471f, 0.0433958992f},
-std::array<float,2>{0.657175303f, 0.891145349f},
-std::array<float,2>{0.520306349f, 0.161420628f},
-std::array<float,2>{0.0797731504f, 0.868734598f},
-std::array<float,2>{0.269731611f, 0.408721983f},
-std::array<float,2>{0.943561852f, 0.636448145f},
-std::array<float,2>{0.894503772f, 0.0988981426f},
-std::array<float,2>{0.328796327f, 0.960117042f},
-std::array<float,2>{0.00765618077f, 0.281881362f},
-std::array<float,2>{0.604219019f, 0.507615328f},
-std::array<float,2>{0.72701335f, 0.496771008f},
-std::array<float,2>{0.243661463f, 0.744530737f},
-std::array<float,2>{0.409093589f, 0.202409551f},
-std::array<float,2>{0.774817348f, 0.755916834f},
-std::array<float,2>{0.949316442f, 0.369455934f},
-std::array<float,2>{0.273521841f, 0.602533221f},
-std::array<float,2>{0.088208586f, 0.00322894612f},
-std::array<float,2>{0.530315876f, 0.925789177f},
-std::array<float,2>{0.668157756f, 0.13323617f},
-std::array<float,2>{0.178218022f, 0.817652464f},
-std::array<float,2>{0.470031917f, 0.386781693f},
-std::array<float,2>{0.817740619f, 0.66419363f},
-std::array<float,2>{0.766247153f, 0.0762478486f},
-std::array<float,2>{0.41720739f, 0.983407855f},
-std::array<float,2>{0.23442775f, 0.259445101f},
-std::array<float,2>{0.725987852f, 0.536061466f},
-std::array<float,2>{0.596751392f, 0.450348735f},
-std::array<float,2>{0.00803105347f, 0.697384834f},
-std::array<float,2>{0.336085558f, 0.24901028f},
-std::array<float,2>{0.900693238f, 0.808022797f},
-std::array<float,2>{0.865260482f, 0.414436996f},
-std::array<float,2>{0.460143894f, 0.630376101f},
-std::array<float,2>{0.134333596f, 0.165888563f},
-std::array<float,2>{0.640050948f, 0.863151014f},
-std::array<float,2>{0.546001911f, 0.037485268f},
-std::array<float,2>{0.107511327f, 0.90021354f},
-std::array<float,2>{0.293019593f, 0.335340738f},
-std::array<float,2>{0.977391481f, 0.570091903f},
-std::array<float,2>{0.910284936f, 0.192173094f},
-std::array<float,2>{0.350717664f, 0.762134671f},
-std::array<float,2>{0.0341141857f, 0.492052764f},
-std::array<float,2>{0.577895105f, 0.7394557f},
-std::array<float,2>{0.689499855f, 0.294932604f},
-std::array<float,2>{0.212995142f, 0.509228528f},
-std::array<float,2>{0.401980728f, 0.102684632f},
-std::array<float,2>{0.798832357f, 0.96814853f},
-std::array<float,2>{0.887667298f, 0.478672326f},
-std::array<float,2>{0.318051398f, 0.7198838f},
-std::array<float,2>{0.0232850779f, 0.216331765f},
-std::array<float,2>{0.615718007f, 0.76943773f},
-std::array<float,2>{0.742271841f, 0.123371877f},
-std::array<float,2>{0.224753693f, 0.948197424f},
-std::array<float,2>{0.424657077f, 0.299825102f},
-std::array<float,2>{0.755219996f, 0.525768936f},
-std::array<float,2>{0.834945381f, 0.182966307f},
-std::array<float,2>{0.491804987f, 0.849816978f},
-std::array<float,2>{0.170208573f, 0.433772922f},
-std::array<float,2>{0.673888087f, 0.64297384f},
-std::array<float,2>{0.514684796f, 0.316323072f},
-std::array<float,2>{0.0683116317f, 0.587961257f},
-std::array<float,2>{0.255283505f, 0.0486531034f},
-std::array<float,2>{0.965281367f, 0.888777852f},
-std::array<float,2>{0.787056684f, 0.278856516f},
-std::array<float,2>{0.375677764f, 0.560183465f},
-std::array<float,2>{0.188073099f, 0.0818357691f},
-std::array<float,2>{0.715651989f, 0.989124119f},
-std::array<float,2>{0.585622728f, 0.229666442f},
-std::array<float,2>{0.0555948578f, 0.795789242f},
-std::array<float,2>{0.367780417f, 0.455669224f},
-std::array<float,2>{0.929968417f, 0.706528485f},
-std::array<float,2>{0.988791049f, 0.0246660393f},
-std::array<float,2>{0.302302241f, 0.916952491f},
-std::array<float,2>{0.118772812f, 0.357276887f},
-std::array<float,2>{0.547232032f, 0.617719412f},
-std::array<float,2>{0.654766381f, 0.392813206f},
-std::array<float,2>{0.150065988f, 0.673749626f},
-std::array<float,2>{0.442428976f, 0.149913758f},
-std::array<float,2>{0.857049108f, 0.830168068f},
-std::array<float,2>{0.963666797f, 0.250778377f},
-std::array<float,2>{0.250446707f, 0.544066727f},
-std::array<float,2>{0.0641838238f, 0.0699445605f},
-std::array<float,2>{0.510352194f, 0.975080907f},
-std::array<float,2>{0.678764999f, 0.240235373f},
-std::array<float,2>{0.166012257f, 0.799385786f},
-std::array<float,2>{0.487534165f, 0.439332098f},
-std::array<float,2>{0.829057038f, 0.692283273f},
-std::array<float,2>{0.752392709f, 0.0156040713f},
-std::array<float,2>{0.427993029f, 0.934294164f},
-std::array<float,2>{0.221839577f, 0.366064399f},
-std::array<float,2>{0.747549534f, 0.599820614f},
-std::array<float,2>{0.612967849f, 0.382555991f},
-std::array<float,2>{0.0172549989f, 0.660410643f},
-std::array<float,2>{0.312535793f, 0.13164638f},
-std::array<float,2>{0.883186221f, 0.821490645f},
-std::array<float,2>{0.854000092f, 0.494292259f},
-std::array<float,2>{0.439133644f, 0.749031663f},
-std::array<float,2>{0.152425498f, 0.198025689f},
-std::array<float,2>{0.651584983f, 0.752058685f},
-std::array<float,2>{0.552081227f, 0.0968754739f},
-std::array<float,2>{0.12215063f, 0.956556201f},
-std::array<float,2>{0.299565464f, 0.288878858f},
-std::array<float,2>{0.986782908f, 0.502206385f},
-std::array<float,2>{0.935366869f, 0.157590255f},
-std::array<float,2>{0.374598175f, 0.873080194f},
-std::array<float,2>{0.0597013086f, 0.411027491f},
-std::array<float,2>{0.579875052f, 0.638569713f},
-std::array<float,2>{0.712916732f, 0.342836022f},
-std::array<float,2>{0.191899225f, 0.576059461f},
-std::array<float,2>{0.382031083f, 0.0403412431f},
-std::array<float,2>{0.783545375f, 0.896597683f},
-std::array<float,2>{0.904772043f, 0.42452997f},
-std::array<float,2>{0.340914041f, 0.651723206f},
-std::array<float,2>{0.014792636f, 0.175000995f},
-std::array<float,2>{0.599657118f, 0.853047073f},
-std::array<float,2>{0.722439528f, 0.0605182052f},
-std::array<float,2>{0.239036947f, 0.876466215f},
-std::array<float,2>{0.420031279f, 0.322074652f},
-std::array<float,2>{0.770928621f, 0.579343796f},
-std::array<float,2>{0.815521777f, 0.204052702f},
-std::array<float,2>{0.476182669f, 0.779492438f},
-std::array<float,2>{0.17338115f, 0.476496786f},
-std::array<float,2>{0.666623771f, 0.73346895f},
-std::array<float,2>{0.525028467f, 0.307932496f},
-std::array<float,2>{0.0910178274f, 0.515632451f},
-std::array<float,2>{0.278855205f, 0.115201384f},
-std::array<float,2>{0.94780916f, 0.938448489f},
-std::array<float,2>{0.801740468f, 0.347868532f},
-std::array<float,2>{0.405433625f, 0.614936292f},
-std::array<float,2>{0.215013504f, 0.0197578128f},
-std::array<float,2>{0.695162654f, 0.913266599f},
-std::array<float,2>{0.571150184f, 0.144777536f},
-std::array<float,2>{0.0369744226f, 0.838655174f},
-std::array<float,2>{0.344887435f, 0.398545772f},
-std::array<float,2>{0.906442523f, 0.680795133f},
-std::array<float,2>{0.983671308f, 0.0875125602f},
-std::array<float,2>{0.290206194f, 0.997655451f},
-std::array<float,2>{0.104719296f, 0.267885774f},
-std::array<float,2>{0.53960675f, 0.551083803f},
-std::array<float,2>{0.634867787f, 0.468419194f},
-std::array<float,2>{0.1395652f, 0.714067936f},
-std::array<float,2>{0.455219597f, 0.225435525f},
-std::array<float,2>{0.861770213f, 0.783157945f},
-std::array<float,2>{0.918539464f, 0.317700297f},
-std::array<float,2>{0.354112476f, 0.59011811f},
-std::array<float,2>{0.0458122529f, 0.0521442592f},
-std::array<float,2>{0.566384196f, 0.8839463f},
-std::array<float,2>{0.701371074f, 0.183815658f},
-std::array<float,2>{0.203937024f, 0.846007645f},
-std::array<float,2>{0.394782782f, 0.430429876f},
-std::array<float,2>{0.805082381f, 0.644803762f},
-std::array<float,2>{0.871600747f, 0.120715186f},
-std::array<float,2>{0.461771905f, 0.951209664f},
-std::array<float,2>{0.132764503f, 0.301434845f},
-std::array<float,2>{0.630759299f, 0.527653039f},
-std::array<float,2>{0.534226477f, 0.483644217f},
-std::array<float,2>{0.10152825f, 0.725159883f},
-std::array<float,2>{0.282990038f, 0.212705866f},
-std::array<float,2>{0.970447361f, 0.769886971f},
-std::array<float,2>{0.77950716f, 0.397321343f},
-std::array<float,2>{0.410562068f, 0.676374018f},
-std::array<float,2>{0.246510223f, 0.152545974f},
-std::array<float,2>{0.732372403f, 0.834005237f},
-std::array<float,2>{0.608575881f, 0.0289928503f},
-std::array<float,2>{0.00383335794f, 0.920241773f},
-std::array<float,2>{0.33348006f, 0.351612568f},
-std::array<float,2>{0.895374596f, 0.623448253f},
-std::array<float,2>{0.937733412f, 0.231079161f},
-std::array<float,2>{0.265974194f, 0.792637944f},
-std::array<float,2>{0.0827906355f, 0.45901227f},
-std::array<float,2>{0.518073738f, 0.709442735f},
-std::array<float,2>{0.660994172f, 0.274349838f},
-std::array<float,2>{0.181392461f, 0.558505177f},
-std::array<float,2>{0.483707339f, 0.0843863636f},
-std::array<float,2>{0.828108609f, 0.987154067f},
-std::array<float,2>{0.998008907f, 0.446058869f},
-std::array<float,2>{0.306205064f, 0.701996386f},
-std::array<float,2>{0.110696293f, 0.243229493f},
-std::array<float,2>{0.562288046f, 0.812107325f},
-std::array<float,2>{0.642445028f, 0.071103923f},
-std::array<float,2>{0.145921767f, 0.976636648f},
-std::array<float,2>{0.448105365f, 0.263319522f},
-std::array<float,2>{0.851499677f, 0.531678081f},
-std::array<float,2>{0.795839846f, 0.14034304f},
-std::array<float,2>{0.388383806f, 0.815925479f},
-std::array<float,2>{0.19996874f, 0.386193693f},
-std::array<float,2>{0.710102081f, 0.668007731f},
-std::array<float,2>{0.591970265f, 0.372393817f},
-std::array<float,2>{0.0500265807f, 0.605639577f},
-std::array<float,2>{0.363196254f, 0.00484142918f},
-std::array<float,2>{0.922478378f, 0.925647259f},
-std::array<float,2>{0.836384296f, 0.291020483f},
-std::array<float,2>{0.495449543f, 0.514178813f},
-std::array<float,2>{0.156453103f, 0.106682546f},
-std::array<float,2>{0.68086201f, 0.962682128f},
-std::array<float,2>{0.503549516f, 0.187530249f},
-std::array<float,2>{0.0733132511f, 0.76157546f},
-std::array<float,2>{0.258708656f, 0.486464918f},
-std::array<float,2>{0.954661489f, 0.734869659f},
-std::array<float,2>{0.8754825f, 0.0326491483f},
-std::array<float,2>{0.325405806f, 0.902769268f},
-std::array<float,2>{0.0244557094f, 0.330461442f},
-std::array<float,2>{0.622774422f, 0.5653193f},
-std::array<float,2>{0.734934747f, 0.420618832f},
-std::array<float,2>{0.230106354f, 0.626553297f},
-std::array<float,2>{0.435203552f, 0.170047924f},
-std::array<float,2>{0.763491809f, 0.863939345f},
-std::array<float,2>{0.889799297f, 0.300652236f},
-std::array<float,2>{0.319752455f, 0.526000738f},
-std::array<float,2>{0.0205741897f, 0.123930998f},
-std::array<float,2>{0.613863289f, 0.947356224f},
-std::array<float,2>{0.746073008f, 0.216014475f},
-std::array<float,2>{0.222728461f, 0.768932223f},
-std::array<float,2>{0.423394442f, 0.479006201f},
-std::array<float,2>{0.757523179f, 0.720495045f},
-std::array<float,2>{0.832185984f, 0.0483294427f},
-std::array<float,2>{0.488355607f, 0.889232457f},
-std::array<float,2>{0.168925166f, 0.315571189f},
-std::array<float,2>{0.67381829f, 0.58880955f},
-std::array<float,2>{0.513322473f, 0.434115559f},
-std::array<float,2>{0.0693590567f, 0.643102646f},
-std::array<float,2>{0.257314473f, 0.183113724f},
-std::array<float,2>{0.968374491f, 0.85029155f},
-std::array<float,2>{0.787922323f, 0.45515129f},
-std::array<float,2>{0.377502263f, 0.706779897f},
-std::array<float,2>{0.190287158f, 0.230158374f},
-std::array<float,2>{0.717325211f, 0.795112371f},
-std::array<float,2>{0.583706677f, 0.0813677907f},
-std::array<float,2>{0.0574816875f, 0.988672495f},
-std::array<float,2>{0.370621681f, 0.278791934f},
-std::array<float,2>{0.931780219f, 0.559663177f},
-std::array<float,2>{0.990867019f, 0.149493933f},
-std::array<float,2>{0.304366022f, 0.83092159f},
-std::array<float,2>{0.119807526f, 0.393464923f},
-std::array<float,2>{0.549256802f, 0.672985256f},
-std::array<float,2>{0.652857661f, 0.356485337f},
-std::array<float,2>{0.151825398f, 0.617313445f},
-std::array<float,2>{0.444829851f, 0.0252770633f},
-std::array<float,2>{0.857537806f, 0.9164083f},
-std::array<float,2>{0.953124166f, 0.387473732f},
-std::array<float,2>{0.27630198f, 0.664891362f},
-std::array<float,2>{0.086670123f, 0.133398235f},
-std::array<float,2>{0.528518558f, 0.818278968f},
-std::array<float,2>{0.671021581f, 0.00348788197f},
-std::array<float,2>{0.175904021f, 0.926547825f},
-std::array<float,2>{0.470938832f, 0.369957745f},
-std::array<float,2>{0.820070982f, 0.602047265f},
-std::array<float,2>{0.767786205f, 0.24831979f},
-std::array<float,2>{0.414974809f, 0.808206737f},
-std::array<float,2>{0.236550286f, 0.450742215f},
-std::array<float,2>{0.723095834f, 0.697961509f},
-std::array<float,2>{0.595456839f, 0.258941501f},
-std::array<float,2>{0.0108392127f, 0.535542727f},
-std::array<float,2>{0.338042289f, 0.0768676773f},
-std::array<float,2>{0.898562849f, 0.984285653f},
-std::array<float,2>{0.863535464f, 0.335663825f},
-std::array<float,2>{0.458867669f, 0.569547474f},
-std::array<float,2>{0.136381522f, 0.037974041f},
-std::array<float,2>{0.637156844f, 0.899684072f},
-std::array<float,2>{0.543471932f, 0.165067896f},
-std::array<float,2>{0.106145874f, 0.862573147f},
-std::array<float,2>{0.295332104f, 0.414937943f},
-std::array<float,2>{0.978794217f, 0.630118966f},
-std::array<float,2>{0.913859546f, 0.103477821f},
-std::array<float,2>{0.34904471f, 0.968621373f},
-std::array<float,2>{0.0323042311f, 0.295561045f},
-std::array<float,2>{0.575552106f, 0.509363949f},
-std::array<float,2>{0.688982069f, 0.491411954f},
-std::array<float,2>{0.212240174f, 0.73984766f},
-std::array<float,2>{0.399152696f, 0.19155255f},
-std::array<float,2>{0.79870075f, 0.762574196f},
-std::array<float,2>{0.973866999f, 0.361589849f},
-std::array<float,2>{0.285885245f, 0.594479322f},
-std::array<float,2>{0.0945095941f, 0.00981038529f},
-std::array<float,2>{0.535298944f, 0.932885349f},
-std::array<float,2>{0.62531364f, 0.127264082f},
-std::array<float,2>{0.127079681f, 0.826474428f},
-std::array<float,2>{0.466384888f, 0.375407219f},
-std::array<float,2>{0.868690968f, 0.657572865f},
-std::array<float,2>{0.809673488f, 0.0626401454f},
-std::array<float,2>{0.392459989f, 0.971613765f},
-std::array<float,2>{0.210248858f, 0.253917277f},
-std::array<float,2>{0.696951389f, 0.539842427f},
-std::array<float,2>{0.566738784f, 0.441854388f},
-std::array<float,2>{0.0414033122f, 0.69057703f},
-std::array<float,2>{0.357988507f, 0.236667126f},
-std::array<float,2>{0.916710794f, 0.801732183f},
-std::array<float,2>{0.820462942f, 0.408627152f},
-std::array<float,2>{0.479180396f, 0.635988891f},
-std::array<float,2>{0.184473827f, 0.162014276f},
-std::array<float,2>{0.659905791f, 0.868403554f},
-std::array<float,2>{0.522547841f, 0.0438675806f},
-std::array<float,2>{0.0804414302f, 0.890953898f},
-std::array<float,2>{0.272712946f, 0.336454391f},
-std::array<float,2>{0.942262173f, 0.571835637f},
-std::array<float,2>{0.891994178f, 0.2028234f},
-std::array<float,2>{0.331179917f, 0.756808996f},
-std::array<float,2>{0.0045379228f, 0.496177733f},
-std::array<float,2>{0.601713836f, 0.744692683f},
-std::array<float,2>{0.729331553f, 0.281455219f},
-std::array<float,2>{0.245285407f, 0.50703609f},
-std::array<float,2>{0.407660455f, 0.0994489118f},
-std::array<float,2>{0.775940776f, 0.960713029f},
-std::array<float,2>{0.925787687f, 0.468854368f},
-std::array<float,2>{0.363717705f, 0.728091419f},
-std::array<float,2>{0.0518890955f, 0.208015695f},
-std::array<float,2>{0.589795709f, 0.775031686f},
-std::array<float,2>{0.706651032f, 0.111275673f},
-std::array<float,2>{0.197097808f, 0.942993462f},
-std::array<float,2>{0.385905057f, 0.310341388f},
-std::array<float,2>{0.789740503f, 0.523124754f},
-std::array<float,2>{0.845026195f, 0.178584173f},
-std::array<float,2>{0.451987863f, 0.856690049f},
-std::array<float,2>{0.143087149f, 0.428958833f},
-std::array<float,2>{0.644545972f, 0.653947651f},
-std::array<float,2>{0.555336773f, 0.326928526f},
-std::array<float,2>{0.115569361f, 0.583647668f},
-std::array<float,2>{0.309693456f, 0.0579104163f},
-std::array<float,2>{0.99288559f, 0.879166722f},
-std::array<float,2>{0.759072602f, 0.272926062f},
-std::array<float,2>{0.430912524f, 0.55030793f},
-std::array<float,2>{0.233145431f, 0.0900182053f},
-std::array<float,2>{0.739771008f, 0.992556036f},
-std::array<float,2>{0.619919837f, 0.222066045f},
-std::array<float,2>{0.0277881343f, 0.7857458f},
-std::array<float,2>{0.322977394f, 0.462885857f},
-std::array<float,2>{0.879214764f, 0.717141867f},
-std::array<float,2>{0.957836092f, 0.0182559621f},
-std::array<float,2>{0.264345288f, 0.909994304f},
-std::array<float,2>{0.0773186833f, 0.346465915f},
-std::array<float,2>{0.504337728f, 0.610532224f},
-std::array<float,2>{0.687285721f, 0.406064093f},
-std::array<float,2>{0.163591117f, 0.68631345f},
-std::array<float,2>{0.498502523f, 0.141662613f},
-std::array<float,2>{0.843442082f, 0.840024889f},
-std::array<float,2>{0.986255586f, 0.285195351f},
-std::array<float,2>{0.298172176f, 0.501700044f},
-std::array<float,2>{0.123082414f, 0.095626764f},
-std::array<float,2>{0.554431975f, 0.953697205f},
-std::array<float,2>{0.649365067f, 0.196934596f},
-std::array<float,2>{0.155326411f, 0.750835776f},
-std::array<float,2>{0.441218734f, 0.492968112f},
-std::array<float,2>{0.853361309f, 0.747124732f},
-std::array<float,2>{0.782812238f, 0.0427519605f},
-std::array<float,2>{0.379786074f, 0.895355046f},
-std::array<float,2>{0.19484742f, 0.340079129f},
-std::array<float,2>{0.711534083f, 0.576961756f},
-std::array<float,2>{0.581100583f, 0.412855208f},
-std::array<float,2>{0.061149288f, 0.639961898f},
-std::array<float,2>{0.372778744f, 0.160155311f},
-std::array<float,2>{0.935999632f, 0.871705532f},
-std::array<float,2>{0.830499172f, 0.440357834f},
-std::array<float,2>{0.485397637f, 0.69513905f},
-std::array<float,2>{0.166968778f, 0.239893928f},
-std::array<float,2>{0.67579937f, 0.798740923f},
-std::array<float,2>{0.508918464f, 0.0671975315f},
-std::array<float,2>{0.0645968243f, 0.973655879f},
-std::array<float,2>{0.253784955f, 0.252016813f},
-std::array<float,2>{0.962729573f, 0.546543479f},
-std::array<float,2>{0.88646245f, 0.129858345f},
-std::array<float,2>{0.315530211f, 0.823984444f},
-std::array<float,2>{0.0177795086f, 0.379976779f},
-std::array<float,2>{0.610327244f, 0.662523627f},
-std::array<float,2>{0.749605179f, 0.363435686f},
-std::array<float,2>{0.220493689f, 0.598530114f},
-std::array<float,2>{0.427633017f, 0.0123701943f},
-std::array<float,2>{0.750041783f, 0.936987758f},
-std::array<float,2>{0.908422172f, 0.401032984f},
-std::array<float,2>{0.346356362f, 0.683414578f},
-std::array<float,2>{0.0381535031f, 0.146555647f},
-std::array<float,2>{0.572460771f, 0.837348223f},
-std::array<float,2>{0.693201721f, 0.0222620144f},
-std::array<float,2>{0.217792735f, 0.910685599f},
-std::array<float,2>{0.404062033f, 0.350716025f},
-std::array<float,2>{0.804459095f, 0.615363419f},
-std::array<float,2>{0.860756159f, 0.22407262f},
-std::array<float,2>{0.454898626f, 0.785054564f},
-std::array<float,2>{0.138605237f, 0.465718061f},
-std::array<float,2>{0.633904874f, 0.712117612f},
-std::array<float,2>{0.542866707f, 0.267072737f},
-std::array<float,2>{0.102243841f, 0.554380417f},
-std::array<float,2>{0.291372538f, 0.0881598592f},
-std::array<float,2>{0.982352793f, 0.998392284f},
-std::array<float,2>{0.772823155f, 0.323092014f},
-std::array<float,2>{0.418904632f, 0.580081582f},
-std::array<float,2>{0.242131412f, 0.060586255f},
-std::array<float,2>{0.719000459f, 0.878597021f},
-std::array<float,2>{0.598528564f, 0.173142299f},
-std::array<float,2>{0.0130616613f, 0.854758263f},
-std::array<float,2>{0.342512757f, 0.423768818f},
-std::array<float,2>{0.903568864f, 0.650066197f},
-std::array<float,2>{0.945773423f, 0.116989523f},
-std::array<float,2>{0.279319853f, 0.939957619f},
-std::array<float,2>{0.0920561254f, 0.304818362f},
-std::array<float,2>{0.526315629f, 0.518339396f},
-std::array<float,2>{0.664100945f, 0.473762125f},
-std::array<float,2>{0.174661607f, 0.731814861f},
-std::array<float,2>{0.474540025f, 0.205117524f},
-std::array<float,2>{0.813965261f, 0.778496206f},
-std::array<float,2>{0.897306979f, 0.353996038f},
-std::array<float,2>{0.334565461f, 0.622384846f},
-std::array<float,2>{0.00159708469f, 0.0308585484f},
-std::array<float,2>{0.605712414f, 0.918164372f},
-std::array<float,2>{0.734132111f, 0.156130552f},
-std::array<float,2>{0.249114901f, 0.83250618f},
-std::array<float,2>{0.413611203f, 0.394688994f},
-std::array<float,2>{0.778443873f, 0.679500818f},
-std::array<float,2>{0.825154006f, 0.0820445195f},
-std::array<float,2>{0.481102347f, 0.984536886f},
-std::array<float,2>{0.183340609f, 0.275842816f},
-std::array<float,2>{0.663653374f, 0.556066334f},
-std::array<float,2>{0.516289592f, 0.458628953f},
-std::array<float,2>{0.0850812495f, 0.707230568f},
-std::array<float,2>{0.269204617f, 0.233274639f},
-std::array<float,2>{0.939487398f, 0.789179742f},
-std::array<float,2>{0.808128536f, 0.433383763f},
-std::array<float,2>{0.396500856f, 0.647565007f},
-std::array<float,2>{0.206068695f, 0.185778052f},
-std::array<float,2>{0.69969672f, 0.844855309f},
-std::array<float,2>{0.564325213f, 0.0542733185f},
-std::array<float,2>{0.0443922132f, 0.884817123f},
-std::array<float,2>{0.353141099f, 0.319357395f},
-std::array<float,2>{0.92158407f, 0.592972398f},
-std::array<float,2>{0.971073508f, 0.213726923f},
-std::array<float,2>{0.284438938f, 0.771739662f},
-std::array<float,2>{0.0978542715f, 0.482380986f},
-std::array<float,2>{0.531915486f, 0.723012507f},
-std::array<float,2>{0.631659508f, 0.303325087f},
-std::array<float,2>{0.130175099f, 0.529874444f},
-std::array<float,2>{0.46323958f, 0.11743629f},
-std::array<float,2>{0.873820424f, 0.950555444f},
-std::array<float,2>{0.956281483f, 0.486253023f},
-std::array<float,2>{0.261055887f, 0.738103211f},
-std::array<float,2>{0.0708571374f, 0.189855516f},
-std::array<float,2>{0.501492083f, 0.757901311f},
-std::array<float,2>{0.683552384f, 0.108187892f},
-std::array<float,2>{0.15974617f, 0.963287234f},
-std::array<float,2>{0.492670387f, 0.290009886f},
-std::array<float,2>{0.8390944f, 0.513342381f},
-std::array<float,2>{0.765136361f, 0.168913603f},
-std::array<float,2>{0.436779171f, 0.865832686f},
-std::array<float,2>{0.227035835f, 0.418594658f},
-std::array<float,2>{0.737154961f, 0.628149569f},
-std::array<float,2>{0.624443471f, 0.328943491f},
-std::array<float,2>{0.0255072098f, 0.563248813f},
-std::array<float,2>{0.326517522f, 0.0340558216f},
-std::array<float,2>{0.877281249f, 0.904915273f},
-std::array<float,2>{0.849288523f, 0.263863921f},
-std::array<float,2>{0.44665274f, 0.534679115f},
-std::array<float,2>{0.146666571f, 0.0727844313f},
-std::array<float,2>{0.643281341f, 0.980361283f},
-std::array<float,2>{0.558936238f, 0.24544777f},
-std::array<float,2>{0.112153202f, 0.809869707f},
-std::array<float,2>{0.307438016f, 0.447790831f},
-std::array<float,2>{0.998986304f, 0.699920177f},
-std::array<float,2>{0.924110353f, 0.00715432595f},
-std::array<float,2>{0.360770941f, 0.922801793f},
-std::array<float,2>{0.0474225394f, 0.374755144f},
-std::array<float,2>{0.590592623f, 0.608120859f},
-std::array<float,2>{0.707493722f, 0.38390857f},
-std::array<float,2>{0.202562928f, 0.670272887f},
-std::array<float,2>{0.389830321f, 0.13682957f},
-std::array<float,2>{0.793073535f, 0.814139366f},
-std::array<float,2>{0.930643618f, 0.27957347f},
-std::array<float,2>{0.367445022f, 0.561765313f},
-std::array<float,2>{0.0548726916f, 0.0796377659f},
-std::array<float,2>{0.585189223f, 0.991123319f},
-std::array<float,2>{0.715105712f, 0.228033438f},
-std::array<float,2>{0.187609464f, 0.793754101f},
-std::array<float,2>{0.375213206f, 0.454763114f},
-std::array<float,2>{0.78622669f, 0.703432798f},
-std::array<float,2>{0.856741965f, 0.0269750189f},
-std::array<float,2>{0.443297595f, 0.915910006f},
-std::array<float,2>{0.14968425f, 0.358642846f},
-std::array<float,2>{0.655031562f, 0.619577587f},
-std::array<float,2>{0.547628224f, 0.392286748f},
-std::array<float,2>{0.118327931f, 0.675141156f},
-std::array<float,2>{0.302105069f, 0.151847243f},
-std::array<float,2>{0.988703668f, 0.828909636f},
-std::array<float,2>{0.755802155f, 0.476992905f},
-std::array<float,2>{0.4239676f, 0.722624362f},
-std::array<float,2>{0.225231737f, 0.2184591f},
-std::array<float,2>{0.74303025f, 0.767336428f},
-std::array<float,2>{0.615900218f, 0.121912926f},
-std::array<float,2>{0.0227454044f, 0.945392311f},
-std::array<float,2>{0.317468464f, 0.297483116f},
-std::array<float,2>{0.886756897f, 0.524725199f},
-std::array<float,2>{0.965707541f, 0.179703265f},
-std::array<float,2>{0.255453795f, 0.848812938f},
-std::array<float,2>{0.0674480572f, 0.435590148f},
-std::array<float,2>{0.515392005f, 0.642196178f},
-std::array<float,2>{0.674453676f, 0.31309852f},
-std::array<float,2>{0.170557231f, 0.586609006f},
-std::array<float,2>{0.491638929f, 0.0488552898f},
-std::array<float,2>{0.834377229f, 0.888322055f},
-std::array<float,2>{0.976985514f, 0.417502046f},
-std::array<float,2>{0.293632716f, 0.630913496f},
-std::array<float,2>{0.108319201f, 0.167237967f},
-std::array<float,2>{0.546569407f, 0.861241281f},
-std::array<float,2>{0.640143871f, 0.0369670354f},
-std::array<float,2>{0.134166315f, 0.901532769f},
-std::array<float,2>{0.46067825f, 0.332581878f},
-std::array<float,2>{0.865814626f, 0.567071259f},
-std::array<float,2>{0.799512148f, 0.194950327f},
-std::array<float,2>{0.401481867f, 0.76499784f},
-std::array<float,2>{0.213539362f, 0.489549041f},
-std::array<float,2>{0.690391719f, 0.740426898f},
-std::array<float,2>{0.577234149f, 0.293174088f},
-std::array<float,2>{0.0334412716f, 0.511695921f},
-std::array<float,2>{0.351560593f, 0.10378053f},
-std::array<float,2>{0.91085726f, 0.965990245f},
-std::array<float,2>{0.817954957f, 0.368392378f},
-std::array<float,2>{0.470457762f, 0.605442762f},
-std::array<float,2>{0.178297639f, 0.000868203992f},
-std::array<float,2>{0.668797433f, 0.928557754f},
-std::array<float,2>{0.531008661f, 0.135459185f},
-std::array<float,2>{0.0883939713f, 0.819063604f},
-std::array<float,2>{0.273966044f, 0.388713181f},
-std::array<float,2>{0.949750543f, 0.666671634f},
-std::array<float,2>{0.900893033f, 0.0757489428f},
-std::array<float,2>{0.336501718f, 0.981963754f},
-std::array<float,2>{0.00878510438f, 0.259934634f},
-std::array<float,2>{0.597396433f, 0.538097262f},
-std::array<float,2>{0.726345003f, 0.451577008f},
-std::array<float,2>{0.235310748f, 0.696406782f},
-std::array<float,2>{0.417767406f, 0.246785507f},
-std::array<float,2>{0.765637577f, 0.804991663f},
-std::array<float,2>{0.944204152f, 0.338894039f},
-std::array<float,2>{0.27045092f, 0.572554886f},
-std::array<float,2>{0.0792542249f, 0.0455385633f},
-std::array<float,2>{0.519842446f, 0.894113362f},
-std::array<float,2>{0.656633556f, 0.162503675f},
-std::array<float,2>{0.186787561f, 0.87055409f},
-std::array<float,2>{0.477849603f, 0.407541454f},
-std::array<float,2>{0.823384643f, 0.633382201f},
-std::array<float,2>{0.775023758f, 0.101501018f},
-std::array<float,2>{0.40825209f, 0.958490133f},
-std::array<float,2>{0.243297294f, 0.283737987f},
-std::array<float,2>{0.727191508f, 0.505092621f},
-std::array<float,2>{0.603731513f, 0.499589533f},
-std::array<float,2>{0.00719919847f, 0.743487954f},
-std::array<float,2>{0.328433484f, 0.200478971f},
-std::array<float,2>{0.894034147f, 0.754565775f},
-std::array<float,2>{0.869181693f, 0.37749517f},
-std::array<float,2>{0.467194438f, 0.658697069f},
-std::array<float,2>{0.126558468f, 0.125136659f},
-std::array<float,2>{0.627166688f, 0.824422002f},
-std::array<float,2>{0.537486255f, 0.00961108319f},
-std::array<float,2>{0.0973161682f, 0.931349993f},
-std::array<float,2>{0.28850019f, 0.360319555f},
-std::array<float,2>{0.976466477f, 0.596355557f},
-std::array<float,2>{0.915098667f, 0.235134304f},
-std::array<float,2>{0.356499881f, 0.803657353f},
-std::array<float,2>{0.0395939797f, 0.44527024f},
-std::array<float,2>{0.569553733f, 0.689294994f},
-std::array<float,2>{0.698486984f, 0.256263733f},
-std::array<float,2>{0.20869796f, 0.542443812f},
-std::array<float,2>{0.393028975f, 0.0659452528f},
-std::array<float,2>{0.811888218f, 0.96963048f},
-std::array<float,2>{0.881105006f, 0.4641743f},
-std::array<float,2>{0.321604043f, 0.715627015f},
-std::array<float,2>{0.0293140095f, 0.220322117f},
-std::array<float,2>{0.61841315f, 0.788224995f},
-std::array<float,2>{0.741011977f, 0.0930416882f},
-std::array<float,2>{0.231235385f, 0.994788587f},
-std::array<float,2>{0.431640655f, 0.271049589f},
-std::array<float,2>{0.761358678f, 0.547400236f},
-std::array<float,2>{0.840596735f, 0.143975511f},
-std::array<float,2>{0.496705949f, 0.842827976f},
-std::array<float,2>{0.160392269f, 0.403353781f},
-std::array<float,2>{0.6854496f, 0.684138715f},
-std::array<float,2>{0.507749021f, 0.343798131f},
-std::array<float,2>{0.0753408149f, 0.612748742f},
-std::array<float,2>{0.261818469f, 0.0174175315f},
-std::array<float,2>{0.959272861f, 0.90750736f},
-std::array<float,2>{0.792288423f, 0.310818404f},
-std::array<float,2>{0.383491576f, 0.52088052f},
-std::array<float,2>{0.198162898f, 0.111523367f},
-std::array<float,2>{0.703368723f, 0.944623113f},
-std::array<float,2>{0.587321818f, 0.210878536f},
-std::array<float,2>{0.0544616543f, 0.77672267f},
-std::array<float,2>{0.365835518f, 0.471085608f},
-std::array<float,2>{0.928924441f, 0.729800045f},
-std::array<float,2>{0.994196534f, 0.0565508418f},
-std::array<float,2>{0.310998261f, 0.881833494f},
-std::array<float,2>{0.114137627f, 0.324269414f},
-std::array<float,2>{0.558312953f, 0.584164202f},
-std::array<float,2>{0.647106111f, 0.426586121f},
-std::array<float,2>{0.141785249f, 0.655554473f},
-std::array<float,2>{0.450706691f, 0.177133337f},
-std::array<float,2>{0.847501516f, 0.857955813f},
-std::array<float,2>{0.949134588f, 0.305810958f},
-std::array<float,2>{0.2773664f, 0.519300818f},
-std::array<float,2>{0.0906113088f, 0.116181664f},
-std::array<float,2>{0.524403691f, 0.940950871f},
-std::array<float,2>{0.667133272f, 0.206745639f},
-std::array<float,2>{0.172755584f, 0.777345896f},
-std::array<float,2>{0.475517094f, 0.473132432f},
-std::array<float,2>{0.814830303f, 0.730684817f},
-std::array<float,2>{0.769955993f, 0.0621841066f},
-std::array<float,2>{0.421614975f, 0.877553225f},
-std::array<float,2>{0.240110934f, 0.323566407f},
-std::array<float,2>{0.720982313f, 0.58201164f},
-std::array<float,2>{0.601141632f, 0.422094375f},
-std::array<float,2>{0.0145754879f, 0.649007201f},
-std::array<float,2>{0.340628624f, 0.17217131f},
-std::array<float,2>{0.905305624f, 0.853821874f},
-std::array<float,2>{0.863052726f, 0.466632009f},
-std::array<float,2>{0.456401378f, 0.710941315f},
-std::array<float,2>{0.140053511f, 0.222829983f},
-std::array<float,2>{0.636717021f, 0.783423543f},
-std::array<float,2>{0.540666103f, 0.0892371237f},
-std::array<float,2>{0.103937961f, 0.999345541f},
-std::array<float,2>{0.289408863f, 0.265904039f},
-std::array<float,2>{0.982714295f, 0.553104401f},
-std::array<float,2>{0.907601416f, 0.148236796f},
-std::array<float,2>{0.344498575f, 0.836441696f},
-std::array<float,2>{0.0354140587f, 0.402260602f},
-std::array<float,2>{0.571770012f, 0.682021677f},
-std::array<float,2>{0.694140494f, 0.349701226f},
-std::array<float,2>{0.215844348f, 0.616917133f},
-std::array<float,2>{0.404608518f, 0.0226027612f},
-std::array<float,2>{0.802297652f, 0.911835849f},
-std::array<float,2>{0.884465456f, 0.379631013f},
-std::array<float,2>{0.313784361f, 0.66399473f},
-std::array<float,2>{0.0160743222f, 0.130356625f},
-std::array<float,2>{0.612032115f, 0.822787225f},
-std::array<float,2>{0.746408105f, 0.0127433687f},
-std::array<float,2>{0.221653521f, 0.936073422f},
-std::array<float,2>{0.429405361f, 0.365186334f},
-std::array<float,2>{0.753856778f, 0.598691463f},
-std::array<float,2>{0.829247355f, 0.238645777f},
-std::array<float,2>{0.486949384f, 0.797504306f},
-std::array<float,2>{0.164983183f, 0.440850586f},
-std::array<float,2>{0.678189516f, 0.694093347f},
-std::array<float,2>{0.511011362f, 0.253394663f},
-std::array<float,2>{0.063128069f, 0.545452714f},
-std::array<float,2>{0.251524687f, 0.0677914992f},
-std::array<float,2>{0.964203119f, 0.973045051f},
-std::array<float,2>{0.784632325f, 0.340976328f},
-std::array<float,2>{0.381708205f, 0.577357531f},
-std::array<float,2>{0.192502439f, 0.0419295356f},
-std::array<float,2>{0.714789689f, 0.896111488f},
-std::array<float,2>{0.578384995f, 0.158544883f},
-std::array<float,2>{0.0591908693f, 0.872208893f},
-std::array<float,2>{0.373247713f, 0.413242728f},
-std::array<float,2>{0.933953643f, 0.638730526f},
-std::array<float,2>{0.988194227f, 0.0946007818f},
-std::array<float,2>{0.299834192f, 0.954920053f},
-std::array<float,2>{0.121109664f, 0.286456168f},
-std::array<float,2>{0.551340461f, 0.500324726f},
-std::array<float,2>{0.651237249f, 0.493557423f},
-std::array<float,2>{0.153807342f, 0.746253073f},
-std::array<float,2>{0.438190371f, 0.195335686f},
-std::array<float,2>{0.855145156f, 0.751023233f},
-std::array<float,2>{0.922946095f, 0.373405576f},
-std::array<float,2>{0.361435324f, 0.608928919f},
-std::array<float,2>{0.0488743335f, 0.00674499199f},
-std::array<float,2>{0.593287885f, 0.923420608f},
-std::array<float,2>{0.709929466f, 0.138423547f},
-std::array<float,2>{0.201076359f, 0.813418388f},
-std::array<float,2>{0.387133062f, 0.383332074f},
-std::array<float,2>{0.79608196f, 0.671685398f},
-std::array<float,2>{0.850288033f, 0.0736648962f},
-std::array<float,2>{0.449113518f, 0.979432583f},
-std::array<float,2>{0.144748151f, 0.264965177f},
-std::array<float,2>{0.640966415f, 0.534012437f},
-std::array<float,2>{0.560833335f, 0.448507935f},
-std::array<float,2>{0.110320129f, 0.700616956f},
-std::array<float,2>{0.304986537f, 0.24463661f},
-std::array<float,2>{0.996272624f, 0.809041739f},
-std::array<float,2>{0.762650847f, 0.419149965f},
-std::array<float,2>{0.433722138f, 0.627842724f},
-std::array<float,2>{0.228759512f, 0.169784904f},
-std::array<float,2>{0.736216128f, 0.866436303f},
-std::array<float,2>{0.621099293f, 0.0347391888f},
-std::array<float,2>{0.0235531386f, 0.905540049f},
-std::array<float,2>{0.324332088f, 0.329564542f},
-std::array<float,2>{0.876932681f, 0.564419806f},
-std::array<float,2>{0.953318596f, 0.191301048f},
-std::array<float,2>{0.259173602f, 0.759601295f},
-std::array<float,2>{0.0729455575f, 0.484932363f},
-std::array<float,2>{0.502791941f, 0.737193644f},
-std::array<float,2>{0.680433512f, 0.290863305f},
-std::array<float,2>{0.157952785f, 0.512634337f},
-std::array<float,2>{0.494338542f, 0.109101556f},
-std::array<float,2>{0.837464035f, 0.964351475f},
-std::array<float,2>{0.969711006f, 0.48137188f},
-std::array<float,2>{0.281432569f, 0.724099576f},
-std::array<float,2>{0.100497209f, 0.21407944f},
-std::array<float,2>{0.533791542f, 0.773073912f},
-std::array<float,2>{0.629718244f, 0.119138859f},
-std::array<float,2>{0.131188199f, 0.94922322f},
-std::array<float,2>{0.462013394f, 0.304276109f},
-std::array<float,2>{0.872085273f, 0.530692995f},
-std::array<float,2>{0.806177914f, 0.186823845f},
-std::array<float,2>{0.395764709f, 0.844318092f},
-std::array<float,2>{0.205077365f, 0.432328045f},
-std::array<float,2>{0.702769935f, 0.646858037f},
-std::array<float,2>{0.565380096f, 0.319319338f},
-std::array<float,2>{0.0462441929f, 0.592133701f},
-std::array<float,2>{0.354898334f, 0.0532964878f},
-std::array<float,2>{0.919848979f, 0.885807574f},
-std::array<float,2>{0.826763451f, 0.27645424f},
-std::array<float,2>{0.482818335f, 0.555249035f},
-std::array<float,2>{0.180419147f, 0.0837165341f},
-std::array<float,2>{0.66160953f, 0.986274838f},
-std::array<float,2>{0.518818557f, 0.233687147f},
-std::array<float,2>{0.0831744671f, 0.790688336f},
-std::array<float,2>{0.266733289f, 0.457839966f},
-std::array<float,2>{0.939317107f, 0.708500922f},
-std::array<float,2>{0.895960331f, 0.0298869349f},
-std::array<float,2>{0.332728446f, 0.91984123f},
-std::array<float,2>{0.00243295287f, 0.354711086f},
-std::array<float,2>{0.607898474f, 0.621175587f},
-std::array<float,2>{0.730516434f, 0.395873725f},
-std::array<float,2>{0.247087836f, 0.678481758f},
-std::array<float,2>{0.411240458f, 0.154599324f},
-std::array<float,2>{0.78121537f, 0.833667099f},
-std::array<float,2>{0.899723351f, 0.261717826f},
-std::array<float,2>{0.339306355f, 0.537757099f},
-std::array<float,2>{0.0101565784f, 0.0743288025f},
-std::array<float,2>{0.594076872f, 0.980833232f},
-std::array<float,2>{0.723986983f, 0.247952685f},
-std::array<float,2>{0.237583324f, 0.806467593f},
-std::array<float,2>{0.415523887f, 0.452472538f},
-std::array<float,2>{0.768659353f, 0.695840478f},
-std::array<float,2>{0.819242001f, 0.00157789921f},
-std::array<float,2>{0.471931815f, 0.92912513f},
-std::array<float,2>{0.177007005f, 0.367749959f},
-std::array<float,2>{0.670278251f, 0.604284704f},
-std::array<float,2>{0.528295994f, 0.389961094f},
-std::array<float,2>{0.0873186365f, 0.667188585f},
-std::array<float,2>{0.276748538f, 0.13651076f},
-std::array<float,2>{0.951206923f, 0.819421351f},
-std::array<float,2>{0.797510326f, 0.48884663f},
-std::array<float,2>{0.399972498f, 0.742018044f},
-std::array<float,2>{0.211796269f, 0.193597257f},
-std::array<float,2>{0.687632024f, 0.76387316f},
-std::array<float,2>{0.574838996f, 0.104814872f},
-std::array<float,2>{0.0320540853f, 0.96548295f},
-std::array<float,2>{0.348455787f, 0.294593006f},
-std::array<float,2>{0.91230619f, 0.509778798f},
-std::array<float,2>{0.980015576f, 0.166062027f},
-std::array<float,2>{0.29604727f, 0.860349834f},
-std::array<float,2>{0.107285112f, 0.416224927f},
-std::array<float,2>{0.544431746f, 0.631879807f},
-std::array<float,2>{0.638148725f, 0.333227962f},
-std::array<float,2>{0.135394976f, 0.568114758f},
-std::array<float,2>{0.457857668f, 0.0351985916f},
-std::array<float,2>{0.864639282f, 0.900491714f},
-std::array<float,2>{0.966993451f, 0.437293977f},
-std::array<float,2>{0.256774664f, 0.640761554f},
-std::array<float,2>{0.0693187043f, 0.181121737f},
-std::array<float,2>{0.512481272f, 0.847790956f},
-std::array<float,2>{0.672554731f, 0.0503829978f},
-std::array<float,2>{0.169380486f, 0.887094855f},
-std::array<float,2>{0.489930093f, 0.314056814f},
-std::array<float,2>{0.833078146f, 0.587417603f},
-std::array<float,2>{0.756365657f, 0.21748881f},
-std::array<float,2>{0.422809184f, 0.766275764f},
-std::array<float,2>{0.22401309f, 0.478199512f},
-std::array<float,2>{0.744814038f, 0.721649349f},
-std::array<float,2>{0.614493668f, 0.298806876f},
-std::array<float,2>{0.0195766501f, 0.524292767f},
-std::array<float,2>{0.318929404f, 0.122853503f},
-std::array<float,2>{0.889458179f, 0.946602285f},
-std::array<float,2>{0.85934335f, 0.357878447f},
-std::array<float,2>{0.443938166f, 0.620671213f},
-std::array<float,2>{0.15092814f, 0.0262471829f},
-std::array<float,2>{0.653952062f, 0.915032148f},
-std::array<float,2>{0.549854577f, 0.150993019f},
-std::array<float,2>{0.120624915f, 0.829414129f},
-std::array<float,2>{0.303583503f, 0.391471773f},
-std::array<float,2>{0.991623759f, 0.674153924f},
-std::array<float,2>{0.932768166f, 0.0790886879f},
-std::array<float,2>{0.369946331f, 0.992187202f},
-std::array<float,2>{0.0582461245f, 0.281209946f},
-std::array<float,2>{0.582954884f, 0.560963333f},
-std::array<float,2>{0.718182862f, 0.454063237f},
-std::array<float,2>{0.191329524f, 0.704210877f},
-std::array<float,2>{0.378177315f, 0.226779819f},
-std::array<float,2>{0.788770616f, 0.794582903f},
-std::array<float,2>{0.993870378f, 0.325233936f},
-std::array<float,2>{0.308829397f, 0.585508704f},
-std::array<float,2>{0.11631126f, 0.0549080819f},
-std::array<float,2>{0.556163311f, 0.88255769f},
-std::array<float,2>{0.645848989f, 0.17581962f},
-std::array<float,2>{0.143771634f, 0.858884156f},
-std::array<float,2>{0.452896774f, 0.42710942f},
-std::array<float,2>{0.843841434f, 0.65433991f},
-std::array<float,2>{0.790725768f, 0.113173388f},
-std::array<float,2>{0.384947807f, 0.943892062f},
-std::array<float,2>{0.195873097f, 0.312428117f},
-std::array<float,2>{0.705795765f, 0.519601285f},
-std::array<float,2>{0.588713944f, 0.472537994f},
-std::array<float,2>{0.0515752248f, 0.728656888f},
-std::array<float,2>{0.365039021f, 0.20951809f},
-std::array<float,2>{0.927338839f, 0.775943279f},
-std::array<float,2>{0.84258604f, 0.402681053f},
-std::array<float,2>{0.499714047f, 0.684896946f},
-std::array<float,2>{0.162227437f, 0.143410355f},
-std::array<float,2>{0.686092198f, 0.842244685f},
-std::array<float,2>{0.505479217f, 0.0162894707f},
-std::array<float,2>{0.0770296678f, 0.907167315f},
-std::array<float,2>{0.26561296f, 0.344793767f},
-std::array<float,2>{0.958706498f, 0.612283528f},
-std::array<float,2>{0.88015455f, 0.219123036f},
-std::array<float,2>{0.32407409f, 0.787151337f},
-std::array<float,2>{0.0287038647f, 0.462934166f},
-std::array<float,2>{0.620176852f, 0.716396749f},
-std::array<float,2>{0.738730133f, 0.269608378f},
-std::array<float,2>{0.234143198f, 0.548226476f},
-std::array<float,2>{0.429716349f, 0.0925031751f},
-std::array<float,2>{0.758074403f, 0.99553597f},
-std::array<float,2>{0.917587459f, 0.443410903f},
-std::array<float,2>{0.358443439f, 0.687930822f},
-std::array<float,2>{0.042129036f, 0.235677421f},
-std::array<float,2>{0.567976058f, 0.804007411f},
-std::array<float,2>{0.69580704f, 0.065385811f},
-std::array<float,2>{0.209743991f, 0.970141351f},
-std::array<float,2>{0.391408831f, 0.25712204f},
-std::array<float,2>{0.80932045f, 0.541151226f},
-std::array<float,2>{0.867830634f, 0.1266343f},
-std::array<float,2>{0.465117931f, 0.825814426f},
-std::array<float,2>{0.128320351f, 0.378598601f},
-std::array<float,2>{0.626242161f, 0.659904063f},
-std::array<float,2>{0.537097931f, 0.360426068f},
-std::array<float,2>{0.095015727f, 0.597545385f},
-std::array<float,2>{0.287088096f, 0.00857629906f},
-std::array<float,2>{0.972838998f, 0.930174947f},
-std::array<float,2>{0.776614428f, 0.284420073f},
-std::array<float,2>{0.406603098f, 0.50470525f},
-std::array<float,2>{0.245104626f, 0.100414395f},
-std::array<float,2>{0.729802072f, 0.957388699f},
-std::array<float,2>{0.602551699f, 0.20013392f},
-std::array<float,2>{0.00491041085f, 0.755632758f},
-std::array<float,2>{0.330710769f, 0.49826324f},
-std::array<float,2>{0.891250193f, 0.742625237f},
-std::array<float,2>{0.942872524f, 0.0461022221f},
-std::array<float,2>{0.27215752f, 0.893367708f},
-std::array<float,2>{0.0813362524f, 0.338765472f},
-std::array<float,2>{0.522065699f, 0.573634505f},
-std::array<float,2>{0.658338726f, 0.406617463f},
-std::array<float,2>{0.185046688f, 0.634099007f},
-std::array<float,2>{0.480120242f, 0.163610786f},
-std::array<float,2>{0.821547806f, 0.869196355f},
-std::array<float,2>{0.980741084f, 0.269384742f},
-std::array<float,2>{0.292766184f, 0.552505016f},
-std::array<float,2>{0.102607332f, 0.0862431079f},
-std::array<float,2>{0.541607559f, 0.997000933f},
-std::array<float,2>{0.632958412f, 0.226167217f},
-std::array<float,2>{0.13729018f, 0.781645715f},
-std::array<float,2>{0.45314154f, 0.467139959f},
-std::array<float,2>{0.859399378f, 0.713049531f},
-std::array<float,2>{0.803172708f, 0.0207216162f},
-std::array<float,2>{0.402692646f, 0.91214025f},
-std::array<float,2>{0.21757324f, 0.349254549f},
-std::array<float,2>{0.692289174f, 0.6141451f},
-std::array<float,2>{0.574122488f, 0.400298536f},
-std::array<float,2>{0.037432801f, 0.680012226f},
-std::array<float,2>{0.347229064f, 0.146367863f},
-std::array<float,2>{0.909953117f, 0.839776278f},
-std::array<float,2>{0.812514603f, 0.475208104f},
-std::array<float,2>{0.472870439f, 0.733332992f},
-std::array<float,2>{0.175769567f, 0.204534173f},
-std::array<float,2>{0.665408373f, 0.7805354f},
-std::array<float,2>{0.526857018f, 0.113645688f},
-std::array<float,2>{0.0936206207f, 0.938487947f},
-std::array<float,2>{0.281207979f, 0.306834251f},
-std::array<float,2>{0.946603537f, 0.517412305f},
-std::array<float,2>{0.902593613f, 0.174539715f},
-std::array<float,2>{0.343331277f, 0.85217005f},
-std::array<float,2>{0.0121987099f, 0.425743222f},
-std::array<float,2>{0.599364996f, 0.650970519f},
-std::array<float,2>{0.720230341f, 0.320453256f},
-std::array<float,2>{0.240771726f, 0.57909143f},
-std::array<float,2>{0.418992966f, 0.0591824651f},
-std::array<float,2>{0.772044539f, 0.875889838f},
-std::array<float,2>{0.937305629f, 0.411970109f},
-std::array<float,2>{0.371126652f, 0.637070358f},
-std::array<float,2>{0.0624223761f, 0.157195434f},
-std::array<float,2>{0.581015229f, 0.874529123f},
-std::array<float,2>{0.712690592f, 0.0391716212f},
-std::array<float,2>{0.193418398f, 0.897563279f},
-std::array<float,2>{0.380668432f, 0.342385828f},
-std::array<float,2>{0.781724691f, 0.574809194f},
-std::array<float,2>{0.852104306f, 0.198489487f},
-std::array<float,2>{0.439759821f, 0.753073215f},
-std::array<float,2>{0.155242354f, 0.495899022f},
-std::array<float,2>{0.650380135f, 0.748494148f},
-std::array<float,2>{0.552996755f, 0.287135273f},
-std::array<float,2>{0.12483234f, 0.502983689f},
-std::array<float,2>{0.2977027f, 0.0965372324f},
-std::array<float,2>{0.984875798f, 0.955148995f},
-std::array<float,2>{0.751603246f, 0.366981924f},
-std::array<float,2>{0.426069438f, 0.601468623f},
-std::array<float,2>{0.218750522f, 0.0139181949f},
-std::array<float,2>{0.748333633f, 0.935134351f},
-std::array<float,2>{0.610956013f, 0.131876722f},
-std::array<float,2>{0.0185965244f, 0.821141064f},
-std::array<float,2>{0.315382391f, 0.38112849f},
-std::array<float,2>{0.885240674f, 0.661705315f},
-std::array<float,2>{0.96149087f, 0.0688209012f},
-std::array<float,2>{0.252623826f, 0.976029396f},
-std::array<float,2>{0.0659162924f, 0.251114696f},
-std::array<float,2>{0.507949769f, 0.54365319f},
-std::array<float,2>{0.677437365f, 0.437507778f},
-std::array<float,2>{0.167073548f, 0.693127036f},
-std::array<float,2>{0.484541625f, 0.241908699f},
-std::array<float,2>{0.831886292f, 0.800628662f},
-std::array<float,2>{0.878229141f, 0.331095874f},
-std::array<float,2>{0.327203125f, 0.565862536f},
-std::array<float,2>{0.0267577767f, 0.0320838839f},
-std::array<float,2>{0.623221397f, 0.903758347f},
-std::array<float,2>{0.737777114f, 0.171690926f},
-std::array<float,2>{0.227922305f, 0.865089595f},
-std::array<float,2>{0.436251909f, 0.421372235f},
-std::array<float,2>{0.764070094f, 0.625528336f},
-std::array<float,2>{0.838616371f, 0.106429055f},
-std::array<float,2>{0.493189007f, 0.961516917f},
-std::array<float,2>{0.158849582f, 0.292966336f},
-std::array<float,2>{0.682244182f, 0.514880121f},
-std::array<float,2>{0.500282764f, 0.487328261f},
-std::array<float,2>{0.0719771907f, 0.73604089f},
-std::array<float,2>{0.260679126f, 0.18850106f},
-std::array<float,2>{0.955787182f, 0.760209441f},
-std::array<float,2>{0.794335723f, 0.3848719f},
-std::array<float,2>{0.388778567f, 0.669474661f},
-std::array<float,2>{0.201195613f, 0.13900502f},
-std::array<float,2>{0.708219647f, 0.815222442f},
-std::array<float,2>{0.591202199f, 0.00576035073f},
-std::array<float,2>{0.0483961888f, 0.924003661f},
-std::array<float,2>{0.359651357f, 0.371295959f},
-std::array<float,2>{0.925006151f, 0.607044816f},
-std::array<float,2>{0.999977708f, 0.242676109f},
-std::array<float,2>{0.307735145f, 0.811498106f},
-std::array<float,2>{0.112366214f, 0.44645986f},
-std::array<float,2>{0.560529947f, 0.702162564f},
-std::array<float,2>{0.644509673f, 0.262540191f},
-std::array<float,2>{0.147570848f, 0.532419562f},
-std::array<float,2>{0.44618246f, 0.0712985992f},
-std::array<float,2>{0.847833037f, 0.978279531f},
-std::array<float,2>{0.940703571f, 0.460330069f},
-std::array<float,2>{0.268244505f, 0.710112154f},
-std::array<float,2>{0.084875226f, 0.2318414f},
-std::array<float,2>{0.517300725f, 0.791172624f},
-std::array<float,2>{0.662522495f, 0.0856305584f},
-std::array<float,2>{0.181927085f, 0.98767978f},
-std::array<float,2>{0.48233974f, 0.275182724f},
-std::array<float,2>{0.825538158f, 0.557553291f},
-std::array<float,2>{0.7775442f, 0.153581709f},
-std::array<float,2>{0.412447661f, 0.83575201f},
-std::array<float,2>{0.24886322f, 0.397823066f},
-std::array<float,2>{0.733145058f, 0.677592635f},
-std::array<float,2>{0.606984854f, 0.352930754f},
-std::array<float,2>{0.000338458864f, 0.624722362f},
-std::array<float,2>{0.335706413f, 0.0276752263f},
-std::array<float,2>{0.898149371f, 0.921180725f},
-std::array<float,2>{0.87493211f, 0.301849723f},
-std::array<float,2>{0.464387923f, 0.528797805f},
-std::array<float,2>{0.128957748f, 0.119356245f},
-std::array<float,2>{0.632590175f, 0.952583194f},
-std::array<float,2>{0.532981932f, 0.211656928f},
-std::array<float,2>{0.0988729298f, 0.770808816f},
-std::array<float,2>{0.283586532f, 0.482474059f},
-std::array<float,2>{0.971705556f, 0.726363063f},
-std::array<float,2>{0.920244277f, 0.0511302315f},
-std::array<float,2>{0.351953834f, 0.882839322f},
-std::array<float,2>{0.0433876589f, 0.317240953f},
-std::array<float,2>{0.562961221f, 0.591361344f},
-std::array<float,2>{0.700877666f, 0.430795193f},
-std::array<float,2>{0.205248401f, 0.646087229f},
-std::array<float,2>{0.398319513f, 0.184766546f},
-std::array<float,2>{0.80700326f, 0.847119093f},
-std::array<float,2>{0.911846459f, 0.295969367f},
-std::array<float,2>{0.350308597f, 0.507833362f},
-std::array<float,2>{0.034770444f, 0.10222663f},
-std::array<float,2>{0.577018023f, 0.966869771f},
-std::array<float,2>{0.691001058f, 0.192768559f},
-std::array<float,2>{0.213983878f, 0.763608515f},
-std::array<float,2>{0.400984019f, 0.490813822f},
-std::array<float,2>{0.800089061f, 0.73923409f},
-std::array<float,2>{0.866430819f, 0.03879188f},
-std::array<float,2>{0.459057689f, 0.899000227f},
-std::array<float,2>{0.133574367f, 0.334085107f},
-std::array<float,2>{0.639029562f, 0.568382859f},
-std::array<float,2>{0.545716047f, 0.415324599f},
-std::array<float,2>{0.108745158f, 0.629772425f},
-std::array<float,2>{0.293969572f, 0.164297789f},
-std::array<float,2>{0.978244543f, 0.861907244f},
-std::array<float,2>{0.766872108f, 0.449706763f},
-std::array<float,2>{0.416440964f, 0.699198484f},
-std::array<float,2>{0.235522941f, 0.24989216f},
-std::array<float,2>{0.725213051f, 0.807322919f},
-std::array<float,2>{0.595724404f, 0.0780205578f},
-std::array<float,2>{0.00950294919f, 0.982802868f},
-std::array<float,2>{0.337622017f, 0.25796622f},
-std::array<float,2>{0.901703298f, 0.536952615f},
-std::array<float,2>{0.950958431f, 0.13400811f},
-std::array<float,2>{0.275385618f, 0.816652298f},
-std::array<float,2>{0.0893620849f, 0.388633847f},
-std::array<float,2>{0.530159414f, 0.665536463f},
-std::array<float,2>{0.669811785f, 0.370213032f},
-std::array<float,2>{0.178917319f, 0.603088498f},
-std::array<float,2>{0.469047189f, 0.00249613938f},
-std::array<float,2>{0.817211807f, 0.927634776f},
-std::array<float,2>{0.989864767f, 0.39382416f},
-std::array<float,2>{0.301448077f, 0.671960831f},
-std::array<float,2>{0.117303774f, 0.14908056f},
-std::array<float,2>{0.548825145f, 0.831974506f},
-std::array<float,2>{0.655540109f, 0.024252817f},
-std::array<float,2>{0.148992658f, 0.917450428f},
-std::array<float,2>{0.441986412f, 0.355884343f},
-std::array<float,2>{0.855635703f, 0.61912328f},
-std::array<float,2>{0.785871029f, 0.228666455f},
-std::array<float,2>{0.376634508f, 0.796762943f},
-std::array<float,2>{0.188824609f, 0.456343532f},
-std::array<float,2>{0.716093838f, 0.70550859f},
-std::array<float,2>{0.584000766f, 0.278301954f},
-std::array<float,2>{0.056110464f, 0.558717012f},
-std::array<float,2>{0.369098842f, 0.0802791789f},
-std::array<float,2>{0.931174874f, 0.989864707f},
-std::array<float,2>{0.835731208f, 0.314687133f},
-std::array<float,2>{0.49110058f, 0.589210093f},
-std::array<float,2>{0.17117089f, 0.0476556309f},
-std::array<float,2>{0.674903154f, 0.8905074f},
-std::array<float,2>{0.514530659f, 0.181935981f},
-std::array<float,2>{0.0666123554f, 0.850663543f},
-std::array<float,2>{0.253919005f, 0.435157627f},
-std::array<float,2>{0.966164827f, 0.644181252f},
-std::array<float,2>{0.888281107f, 0.124129891f},
-std::array<float,2>{0.316940546f, 0.948721588f},
-std::array<float,2>{0.0215966199f, 0.299236834f},
-std::array<float,2>{0.617103457f, 0.527214289f},
-std::array<float,2>{0.743231416f, 0.48018074f},
-std::array<float,2>{0.226350829f, 0.718817949f},
-std::array<float,2>{0.425700754f, 0.215433866f},
-std::array<float,2>{0.754808366f, 0.768291056f},
-std::array<float,2>{0.960659266f, 0.347027689f},
-std::array<float,2>{0.263124853f, 0.609487951f},
-std::array<float,2>{0.0747895464f, 0.0189607721f},
-std::array<float,2>{0.506059408f, 0.908312798f},
-std::array<float,2>{0.683903456f, 0.140721068f},
-std::array<float,2>{0.161542371f, 0.841031671f},
-std::array<float,2>{0.497984201f, 0.405195206f},
-std::array<float,2>{0.84113735f, 0.686865091f},
-std::array<float,2>{0.760519564f, 0.0910785869f},
-std::array<float,2>{0.433129609f, 0.993949115f},
-std::array<float,2>{0.23155959f, 0.271515816f},
-std::array<float,2>{0.742086887f, 0.54977107f},
-std::array<float,2>{0.618027985f, 0.461706281f},
-std::array<float,2>{0.0303206332f, 0.718702853f},
-std::array<float,2>{0.320529878f, 0.221511766f},
-std::array<float,2>{0.882160723f, 0.786956668f},
-std::array<float,2>{0.846266866f, 0.427968353f},
-std::array<float,2>{0.44930473f, 0.652501523f},
-std::array<float,2>{0.141568094f, 0.179409936f},
-std::array<float,2>{0.64769429f, 0.856388509f},
-std::array<float,2>{0.556942403f, 0.0575152747f},
-std::array<float,2>{0.114511997f, 0.880228579f},
-std::array<float,2>{0.312013894f, 0.327919573f},
-std::array<float,2>{0.995787263f, 0.582099676f},
-std::array<float,2>{0.928027511f, 0.207905531f},
-std::array<float,2>{0.367061526f, 0.7738446f},
-std::array<float,2>{0.0533688888f, 0.469762355f},
-std::array<float,2>{0.586162746f, 0.727232695f},
-std::array<float,2>{0.704635978f, 0.309513092f},
-std::array<float,2>{0.199185356f, 0.522432566f},
-std::array<float,2>{0.383984298f, 0.10971231f},
-std::array<float,2>{0.791225612f, 0.941886842f},
-std::array<float,2>{0.893075883f, 0.497216195f},
-std::array<float,2>{0.330072343f, 0.74518609f},
-std::array<float,2>{0.00599240232f, 0.201205403f},
-std::array<float,2>{0.604707837f, 0.756894767f},
-std::array<float,2>{0.727591157f, 0.0981670171f},
-std::array<float,2>{0.242199421f, 0.959083915f},
-std::array<float,2>{0.409890354f, 0.282980859f},
-std::array<float,2>{0.773772418f, 0.50633198f},
-std::array<float,2>{0.822468162f, 0.160394505f},
-std::array<float,2>{0.477034092f, 0.867209017f},
-std::array<float,2>{0.186462551f, 0.410092086f},
-std::array<float,2>{0.657651603f, 0.635729551f},
-std::array<float,2>{0.521379888f, 0.33715713f},
-std::array<float,2>{0.0784798339f, 0.571192384f},
-std::array<float,2>{0.270576507f, 0.0441972874f},
-std::array<float,2>{0.94463712f, 0.892373919f},
-std::array<float,2>{0.811508298f, 0.255271822f},
-std::array<float,2>{0.394248664f, 0.54051131f},
-std::array<float,2>{0.207761124f, 0.0637310967f},
-std::array<float,2>{0.69760263f, 0.971755385f},
-std::array<float,2>{0.568937719f, 0.237564653f},
-std::array<float,2>{0.040369276f, 0.802327812f},
-std::array<float,2>{0.356284708f, 0.443220913f},
-std::array<float,2>{0.914733827f, 0.690054297f},
-std::array<float,2>{0.975540161f, 0.011142591f},
-std::array<float,2>{0.287259698f, 0.931763351f},
-std::array<float,2>{0.0957636312f, 0.362460375f},
-std::array<float,2>{0.538943946f, 0.59474355f},
-std::array<float,2>{0.628194094f, 0.376515538f},
-std::array<float,2>{0.125247672f, 0.657182992f},
-std::array<float,2>{0.46826002f, 0.128698632f},
-std::array<float,2>{0.87095058f, 0.827650428f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.358191848f, 0.208389834f},
-std::array<float,2>{0.86537993f, 0.755948901f},
-std::array<float,2>{0.706255078f, 0.36246419f},
-std::array<float,2>{0.0795290545f, 0.643370569f},
-std::array<float,2>{0.205044985f, 0.465652615f},
-std::array<float,2>{0.500758171f, 0.587732196f},
-std::array<float,2>{0.915253282f, 0.090353936f},
-std::array<float,2>{0.47914511f, 0.91980505f},
-std::array<float,2>{0.0338184983f, 0.0156584661f},
-std::array<float,2>{0.666066468f, 0.947772741f},
-std::array<float,2>{0.791824222f, 0.413474351f},
-std::array<float,2>{0.291834027f, 0.533425987f},
-std::array<float,2>{0.420346588f, 0.259734601f},
-std::array<float,2>{0.990548015f, 0.725705028f},
-std::array<float,2>{0.566283762f, 0.173556343f},
-std::array<float,2>{0.178431138f, 0.844103754f},
-std::array<float,2>{0.439791262f, 0.113220438f},
-std::array<float,2>{0.897661984f, 0.887272358f},
-std::array<float,2>{0.542066693f, 0.492985815f},
-std::array<float,2>{0.243793547f, 0.595472991f},
-std::array<float,2>{0.114297107f, 0.322393894f},
-std::array<float,2>{0.725945234f, 0.671465755f},
-std::array<float,2>{0.826041222f, 0.236410931f},
-std::array<float,2>{0.327993184f, 0.809528828f},
-std::array<float,2>{0.134295419f, 0.129222944f},
-std::array<float,2>{0.620293796f, 0.842860281f},
-std::array<float,2>{0.962490022f, 0.292668462f},
-std::array<float,2>{0.378925711f, 0.688618124f},
-std::array<float,2>{0.268738538f, 0.396522731f},
-std::array<float,2>{0.762010038f, 0.515751362f},
-std::array<float,2>{0.625255167f, 0.0447832905f},
-std::array<float,2>{0.0215982981f, 0.996655703f},
-std::array<float,2>{0.397423208f, 0.168453008f},
-std::array<float,2>{0.942119718f, 0.864724219f},
-std::array<float,2>{0.606830359f, 0.274418354f},
-std::array<float,2>{0.142581701f, 0.746393442f},
-std::array<float,2>{0.00901116338f, 0.436684281f},
-std::array<float,2>{0.649610579f, 0.554948092f},
-std::array<float,2>{0.779771328f, 0.00732966885f},
-std::array<float,2>{0.254612714f, 0.954901338f},
-std::array<float,2>{0.232727125f, 0.0721830204f},
-std::array<float,2>{0.555133939f, 0.930873036f},
-std::array<float,2>{0.876791954f, 0.448937207f},
-std::array<float,2>{0.45560652f, 0.572930694f},
-std::array<float,2>{0.342675209f, 0.348220706f},
-std::array<float,2>{0.837476611f, 0.634754181f},
-std::array<float,2>{0.741877139f, 0.192110509f},
-std::array<float,2>{0.107337609f, 0.769441247f},
-std::array<float,2>{0.305513203f, 0.0499922633f},
-std::array<float,2>{0.797020495f, 0.978036702f},
-std::array<float,2>{0.67621994f, 0.375451714f},
-std::array<float,2>{0.0530537255f, 0.515382826f},
-std::array<float,2>{0.165140808f, 0.310847074f},
-std::array<float,2>{0.581051648f, 0.712644637f},
-std::array<float,2>{0.973790884f, 0.154718608f},
-std::array<float,2>{0.43337062f, 0.813093543f},
-std::array<float,2>{0.0772827119f, 0.229904637f},
-std::array<float,2>{0.698136151f, 0.787902296f},
-std::array<float,2>{0.848628521f, 0.342531681f},
-std::array<float,2>{0.362931758f, 0.683629215f},
-std::array<float,2>{0.484494001f, 0.471597493f},
-std::array<float,2>{0.928084075f, 0.620726168f},
-std::array<float,2>{0.52117604f, 0.10623879f},
-std::array<float,2>{0.199049562f, 0.893768549f},
-std::array<float,2>{0.259346306f, 0.142902613f},
-std::array<float,2>{0.770915091f, 0.824644208f},
-std::array<float,2>{0.642420471f, 0.303972155f},
-std::array<float,2>{0.00115926645f, 0.704516053f},
-std::array<float,2>{0.155319154f, 0.386186749f},
-std::array<float,2>{0.598381281f, 0.504849494f},
-std::array<float,2>{0.951793611f, 0.0601551831f},
-std::array<float,2>{0.398607463f, 0.969958186f},
-std::array<float,2>{0.0978913531f, 0.0969858244f},
-std::array<float,2>{0.746220469f, 0.902173221f},
-std::array<float,2>{0.830472291f, 0.479653776f},
-std::array<float,2>{0.334610254f, 0.61395824f},
-std::array<float,2>{0.462780476f, 0.333381534f},
-std::array<float,2>{0.886326849f, 0.678439319f},
-std::array<float,2>{0.54800725f, 0.221909866f},
-std::array<float,2>{0.226370931f, 0.789463699f},
-std::array<float,2>{0.42480585f, 0.0137457987f},
-std::array<float,2>{0.981656671f, 0.96624583f},
-std::array<float,2>{0.587457955f, 0.425096512f},
-std::array<float,2>{0.163226739f, 0.55425787f},
-std::array<float,2>{0.0595345981f, 0.270676345f},
-std::array<float,2>{0.681393743f, 0.739901364f},
-std::array<float,2>{0.807176054f, 0.162266359f},
-std::array<float,2>{0.300868392f, 0.872785509f},
-std::array<float,2>{0.194788918f, 0.195800766f},
-std::array<float,2>{0.526050448f, 0.77431792f},
-std::array<float,2>{0.930520535f, 0.358759493f},
-std::array<float,2>{0.49252817f, 0.625829875f},
-std::array<float,2>{0.373974562f, 0.444158435f},
-std::array<float,2>{0.854844213f, 0.565439045f},
-std::array<float,2>{0.69125706f, 0.0673289299f},
-std::array<float,2>{0.06563586f, 0.92472595f},
-std::array<float,2>{0.47553575f, 0.246361017f},
-std::array<float,2>{0.909305513f, 0.796930432f},
-std::array<float,2>{0.514060438f, 0.320039839f},
-std::array<float,2>{0.216323644f, 0.656936944f},
-std::array<float,2>{0.092265524f, 0.49129799f},
-std::array<float,2>{0.71131736f, 0.606576324f},
-std::array<float,2>{0.873013973f, 0.124083057f},
-std::array<float,2>{0.35010311f, 0.878467262f},
-std::array<float,2>{0.186322793f, 0.0330723338f},
-std::array<float,2>{0.576702476f, 0.991663218f},
-std::array<float,2>{0.999382496f, 0.405869395f},
-std::array<float,2>{0.412480772f, 0.523579121f},
-std::array<float,2>{0.288031906f, 0.288035244f},
-std::array<float,2>{0.783166051f, 0.695982754f},
-std::array<float,2>{0.663764119f, 0.133957997f},
-std::array<float,2>{0.040902216f, 0.831144631f},
-std::array<float,2>{0.31847614f, 0.0783132687f},
-std::array<float,2>{0.81646961f, 0.911314487f},
-std::array<float,2>{0.732856095f, 0.454618871f},
-std::array<float,2>{0.123140849f, 0.582023501f},
-std::array<float,2>{0.237683013f, 0.369448632f},
-std::array<float,2>{0.531583011f, 0.651353478f},
-std::array<float,2>{0.906137407f, 0.213278815f},
-std::array<float,2>{0.452148408f, 0.759554565f},
-std::array<float,2>{0.025843706f, 0.183569834f},
-std::array<float,2>{0.635918081f, 0.856595397f},
-std::array<float,2>{0.755580425f, 0.255238086f},
-std::array<float,2>{0.274796635f, 0.733451068f},
-std::array<float,2>{0.388248652f, 0.415260017f},
-std::array<float,2>{0.958188534f, 0.5392344f},
-std::array<float,2>{0.612319887f, 0.028853653f},
-std::array<float,2>{0.127480432f, 0.940108299f},
-std::array<float,2>{0.329978257f, 0.177886844f},
-std::array<float,2>{0.834536016f, 0.848603368f},
-std::array<float,2>{0.744685948f, 0.263247937f},
-std::array<float,2>{0.0950044617f, 0.722611785f},
-std::array<float,2>{0.222217456f, 0.407223791f},
-std::array<float,2>{0.55300343f, 0.537544906f},
-std::array<float,2>{0.888332903f, 0.0201581288f},
-std::array<float,2>{0.464978933f, 0.949391186f},
-std::array<float,2>{0.00611022813f, 0.0888548717f},
-std::array<float,2>{0.646073103f, 0.916595042f},
-std::array<float,2>{0.766507864f, 0.462486297f},
-std::array<float,2>{0.262254745f, 0.592951775f},
-std::array<float,2>{0.404491186f, 0.364122063f},
-std::array<float,2>{0.948341608f, 0.64611876f},
-std::array<float,2>{0.595868826f, 0.206311822f},
-std::array<float,2>{0.152260154f, 0.751724482f},
-std::array<float,2>{0.496458948f, 0.040819481f},
-std::array<float,2>{0.936398327f, 0.995083272f},
-std::array<float,2>{0.527914584f, 0.393438011f},
-std::array<float,2>{0.188621461f, 0.519955516f},
-std::array<float,2>{0.068330355f, 0.296288133f},
-std::array<float,2>{0.692003012f, 0.693216383f},
-std::array<float,2>{0.858074248f, 0.126325801f},
-std::array<float,2>{0.370443106f, 0.837793648f},
-std::array<float,2>{0.156352535f, 0.241013885f},
-std::array<float,2>{0.591731131f, 0.80471158f},
-std::array<float,2>{0.97813499f, 0.326065689f},
-std::array<float,2>{0.426256239f, 0.667298734f},
-std::array<float,2>{0.299864441f, 0.499848247f},
-std::array<float,2>{0.810093403f, 0.600247502f},
-std::array<float,2>{0.685295939f, 0.117100887f},
-std::array<float,2>{0.0575777441f, 0.885042191f},
-std::array<float,2>{0.408073187f, 0.188991487f},
-std::array<float,2>{0.993984699f, 0.770691395f},
-std::array<float,2>{0.572202444f, 0.346254706f},
-std::array<float,2>{0.18287994f, 0.639570117f},
-std::array<float,2>{0.0456741378f, 0.450543046f},
-std::array<float,2>{0.658435583f, 0.574244201f},
-std::array<float,2>{0.787821651f, 0.0758503973f},
-std::array<float,2>{0.283219159f, 0.934778988f},
-std::array<float,2>{0.211777151f, 0.00344707072f},
-std::array<float,2>{0.509263515f, 0.960087597f},
-std::array<float,2>{0.913577318f, 0.433393329f},
-std::array<float,2>{0.472158849f, 0.560132325f},
-std::array<float,2>{0.346500635f, 0.279614747f},
-std::array<float,2>{0.870771766f, 0.742557704f},
-std::array<float,2>{0.718145609f, 0.16559799f},
-std::array<float,2>{0.0861241072f, 0.860802293f},
-std::array<float,2>{0.279533088f, 0.102696918f},
-std::array<float,2>{0.750520647f, 0.894631863f},
-std::array<float,2>{0.637280107f, 0.475278735f},
-std::array<float,2>{0.0307648238f, 0.623474896f},
-std::array<float,2>{0.12932159f, 0.33774057f},
-std::array<float,2>{0.614621699f, 0.680475652f},
-std::array<float,2>{0.956112802f, 0.234354794f},
-std::array<float,2>{0.384610265f, 0.781370759f},
-std::array<float,2>{0.119373031f, 0.149804235f},
-std::array<float,2>{0.727655828f, 0.817580342f},
-std::array<float,2>{0.813353181f, 0.306296229f},
-std::array<float,2>{0.31386894f, 0.717151821f},
-std::array<float,2>{0.446014374f, 0.380037814f},
-std::array<float,2>{0.901214242f, 0.510085702f},
-std::array<float,2>{0.537496746f, 0.0524379276f},
-std::array<float,2>{0.2383385f, 0.980761826f},
-std::array<float,2>{0.294678181f, 0.223797098f},
-std::array<float,2>{0.795150995f, 0.795342028f},
-std::array<float,2>{0.670801163f, 0.331200957f},
-std::array<float,2>{0.0386951789f, 0.675301254f},
-std::array<float,2>{0.173435166f, 0.481944263f},
-std::array<float,2>{0.567906857f, 0.610903978f},
-std::array<float,2>{0.984687805f, 0.101254649f},
-std::array<float,2>{0.414535344f, 0.903979599f},
-std::array<float,2>{0.0843513757f, 0.0572968759f},
-std::array<float,2>{0.71072644f, 0.975084186f},
-std::array<float,2>{0.863198996f, 0.390608788f},
-std::array<float,2>{0.35539785f, 0.503360808f},
-std::array<float,2>{0.482105345f, 0.298571467f},
-std::array<float,2>{0.921223819f, 0.707844317f},
-std::array<float,2>{0.507138431f, 0.146676943f},
-std::array<float,2>{0.208337903f, 0.820648134f},
-std::array<float,2>{0.377732873f, 0.0641698316f},
-std::array<float,2>{0.967501163f, 0.928045869f},
-std::array<float,2>{0.621697009f, 0.439051569f},
-std::array<float,2>{0.138687313f, 0.569594979f},
-std::array<float,2>{0.0165428426f, 0.351718485f},
-std::array<float,2>{0.630234301f, 0.632278681f},
-std::array<float,2>{0.761599362f, 0.201955304f},
-std::array<float,2>{0.273334205f, 0.777976453f},
-std::array<float,2>{0.247872502f, 0.156545639f},
-std::array<float,2>{0.546440482f, 0.870665371f},
-std::array<float,2>{0.893214881f, 0.268643081f},
-std::array<float,2>{0.444856465f, 0.738029122f},
-std::array<float,2>{0.323839486f, 0.429386079f},
-std::array<float,2>{0.820528388f, 0.549896121f},
-std::array<float,2>{0.721686125f, 0.00892468914f},
-std::array<float,2>{0.1108054f, 0.963395f},
-std::array<float,2>{0.457076728f, 0.13922894f},
-std::array<float,2>{0.879084349f, 0.83254987f},
-std::array<float,2>{0.561857581f, 0.281392813f},
-std::array<float,2>{0.229534879f, 0.700473011f},
-std::array<float,2>{0.103957243f, 0.401847601f},
-std::array<float,2>{0.737006664f, 0.527812183f},
-std::array<float,2>{0.840267181f, 0.0351827294f},
-std::array<float,2>{0.338742107f, 0.987441838f},
-std::array<float,2>{0.147893846f, 0.118575551f},
-std::array<float,2>{0.602854133f, 0.880957484f},
-std::array<float,2>{0.939052045f, 0.48649326f},
-std::array<float,2>{0.392039835f, 0.604181051f},
-std::array<float,2>{0.251020104f, 0.313701659f},
-std::array<float,2>{0.77571857f, 0.662440717f},
-std::array<float,2>{0.655313671f, 0.243782341f},
-std::array<float,2>{0.0135635724f, 0.804157197f},
-std::array<float,2>{0.363763839f, 0.0242630523f},
-std::array<float,2>{0.846881151f, 0.94376564f},
-std::array<float,2>{0.701643646f, 0.421759903f},
-std::array<float,2>{0.0738783255f, 0.544053078f},
-std::array<float,2>{0.200121835f, 0.251481026f},
-std::array<float,2>{0.518603623f, 0.730392933f},
-std::array<float,2>{0.925400138f, 0.187311277f},
-std::array<float,2>{0.490914911f, 0.852897704f},
-std::array<float,2>{0.0468835458f, 0.217502221f},
-std::array<float,2>{0.673087835f, 0.76468569f},
-std::array<float,2>{0.800951958f, 0.373950034f},
-std::array<float,2>{0.309701622f, 0.655775905f},
-std::array<float,2>{0.437293112f, 0.459457874f},
-std::array<float,2>{0.971584916f, 0.584479749f},
-std::array<float,2>{0.584276915f, 0.0841899589f},
-std::array<float,2>{0.171278685f, 0.907454431f},
-std::array<float,2>{0.326034039f, 0.235611185f},
-std::array<float,2>{0.827747405f, 0.811991215f},
-std::array<float,2>{0.723344922f, 0.321933061f},
-std::array<float,2>{0.117061608f, 0.668767273f},
-std::array<float,2>{0.244979158f, 0.495762557f},
-std::array<float,2>{0.540750146f, 0.596191049f},
-std::array<float,2>{0.895696342f, 0.110571004f},
-std::array<float,2>{0.437878221f, 0.890519202f},
-std::array<float,2>{0.0201181415f, 0.0451550782f},
-std::array<float,2>{0.627175689f, 0.999292016f},
-std::array<float,2>{0.764145672f, 0.396188617f},
-std::array<float,2>{0.266706795f, 0.519480586f},
-std::array<float,2>{0.382764935f, 0.290520072f},
-std::array<float,2>{0.963879347f, 0.690790653f},
-std::array<float,2>{0.617659628f, 0.132047996f},
-std::array<float,2>{0.135382384f, 0.840975344f},
-std::array<float,2>{0.476563036f, 0.0925872549f},
-std::array<float,2>{0.917021632f, 0.920217574f},
-std::array<float,2>{0.502475023f, 0.46681571f},
-std::array<float,2>{0.206503779f, 0.589589775f},
-std::array<float,2>{0.0816260055f, 0.360071689f},
-std::array<float,2>{0.704752803f, 0.641885281f},
-std::array<float,2>{0.863582611f, 0.20939678f},
-std::array<float,2>{0.357014209f, 0.755700111f},
-std::array<float,2>{0.176299289f, 0.175369084f},
-std::array<float,2>{0.563422382f, 0.847163379f},
-std::array<float,2>{0.989621758f, 0.261502624f},
-std::array<float,2>{0.419331819f, 0.723829687f},
-std::array<float,2>{0.290775448f, 0.410812676f},
-std::array<float,2>{0.789085627f, 0.532567263f},
-std::array<float,2>{0.665066659f, 0.0178531799f},
-std::array<float,2>{0.0321913213f, 0.945835412f},
-std::array<float,2>{0.430478036f, 0.154118583f},
-std::array<float,2>{0.976138532f, 0.814683676f},
-std::array<float,2>{0.578336656f, 0.308998138f},
-std::array<float,2>{0.167349368f, 0.713360429f},
-std::array<float,2>{0.0527213775f, 0.377163827f},
-std::array<float,2>{0.67945677f, 0.512813687f},
-std::array<float,2>{0.799949706f, 0.0474144369f},
-std::array<float,2>{0.306747288f, 0.978599608f},
-std::array<float,2>{0.19682464f, 0.108924933f},
-std::array<float,2>{0.522580326f, 0.891199648f},
-std::array<float,2>{0.9272632f, 0.470430613f},
-std::array<float,2>{0.487962753f, 0.61782074f},
-std::array<float,2>{0.360888898f, 0.33991465f},
-std::array<float,2>{0.849892259f, 0.685989439f},
-std::array<float,2>{0.696646452f, 0.226930425f},
-std::array<float,2>{0.0752335638f, 0.786176205f},
-std::array<float,2>{0.257548362f, 0.00579855917f},
-std::array<float,2>{0.778655231f, 0.956813455f},
-std::array<float,2>{0.652027309f, 0.435059816f},
-std::array<float,2>{0.0112272091f, 0.557320297f},
-std::array<float,2>{0.142369598f, 0.276174933f},
-std::array<float,2>{0.607587814f, 0.749887943f},
-std::array<float,2>{0.943984628f, 0.170578465f},
-std::array<float,2>{0.394869328f, 0.866062164f},
-std::array<float,2>{0.108453721f, 0.194990396f},
-std::array<float,2>{0.739517272f, 0.766641319f},
-std::array<float,2>{0.837929368f, 0.350587517f},
-std::array<float,2>{0.341163605f, 0.636610329f},
-std::array<float,2>{0.45382008f, 0.446795464f},
-std::array<float,2>{0.877491057f, 0.571301043f},
-std::array<float,2>{0.557501614f, 0.072510615f},
-std::array<float,2>{0.23140718f, 0.932936311f},
-std::array<float,2>{0.30404526f, 0.161617532f},
-std::array<float,2>{0.805805147f, 0.873637855f},
-std::array<float,2>{0.683401465f, 0.273415655f},
-std::array<float,2>{0.0623597503f, 0.740803301f},
-std::array<float,2>{0.160776362f, 0.423790544f},
-std::array<float,2>{0.588701367f, 0.550901949f},
-std::array<float,2>{0.982693732f, 0.012498077f},
-std::array<float,2>{0.422480851f, 0.967150629f},
-std::array<float,2>{0.0628211349f, 0.069535993f},
-std::array<float,2>{0.688426495f, 0.922151685f},
-std::array<float,2>{0.852947414f, 0.442919552f},
-std::array<float,2>{0.372606903f, 0.56257391f},
-std::array<float,2>{0.495017588f, 0.356960386f},
-std::array<float,2>{0.931940258f, 0.627627254f},
-std::array<float,2>{0.524429202f, 0.197386771f},
-std::array<float,2>{0.192498505f, 0.776415527f},
-std::array<float,2>{0.401072502f, 0.0617203824f},
-std::array<float,2>{0.950506866f, 0.971754491f},
-std::array<float,2>{0.601123154f, 0.383816123f},
-std::array<float,2>{0.153786123f, 0.507111788f},
-std::array<float,2>{0.00313022267f, 0.302678615f},
-std::array<float,2>{0.644036889f, 0.706680954f},
-std::array<float,2>{0.773428559f, 0.14150995f},
-std::array<float,2>{0.261480272f, 0.828069031f},
-std::array<float,2>{0.224273562f, 0.2196493f},
-std::array<float,2>{0.54968518f, 0.792077363f},
-std::array<float,2>{0.882829428f, 0.334640712f},
-std::array<float,2>{0.463072717f, 0.677228689f},
-std::array<float,2>{0.332813382f, 0.47812745f},
-std::array<float,2>{0.829085648f, 0.615741849f},
-std::array<float,2>{0.749569356f, 0.0945822895f},
-std::array<float,2>{0.101318009f, 0.899339259f},
-std::array<float,2>{0.44960776f, 0.211808488f},
-std::array<float,2>{0.902444661f, 0.760350943f},
-std::array<float,2>{0.534885287f, 0.367483795f},
-std::array<float,2>{0.234707966f, 0.650275707f},
-std::array<float,2>{0.122357383f, 0.456587642f},
-std::array<float,2>{0.73094058f, 0.57855171f},
-std::array<float,2>{0.819454014f, 0.0813504085f},
-std::array<float,2>{0.316482008f, 0.913881779f},
-std::array<float,2>{0.126503974f, 0.0297971647f},
-std::array<float,2>{0.61082387f, 0.938523769f},
-std::array<float,2>{0.959201992f, 0.417537749f},
-std::array<float,2>{0.389601946f, 0.54264462f},
-std::array<float,2>{0.276252657f, 0.257252842f},
-std::array<float,2>{0.756490707f, 0.731056392f},
-std::array<float,2>{0.632917166f, 0.181366935f},
-std::array<float,2>{0.0239879619f, 0.8578794f},
-std::array<float,2>{0.34795472f, 0.122479498f},
-std::array<float,2>{0.873838902f, 0.875000477f},
-std::array<float,2>{0.712995887f, 0.488723874f},
-std::array<float,2>{0.0916390643f, 0.608933747f},
-std::array<float,2>{0.217311829f, 0.317893296f},
-std::array<float,2>{0.511906266f, 0.659438193f},
-std::array<float,2>{0.90627116f, 0.248669669f},
-std::array<float,2>{0.47424373f, 0.799590409f},
-std::array<float,2>{0.0422093458f, 0.136073023f},
-std::array<float,2>{0.661079645f, 0.829937756f},
-std::array<float,2>{0.784165621f, 0.285613984f},
-std::array<float,2>{0.285459638f, 0.697712302f},
-std::array<float,2>{0.411430389f, 0.403445274f},
-std::array<float,2>{0.997154474f, 0.52628684f},
-std::array<float,2>{0.574809134f, 0.0336403809f},
-std::array<float,2>{0.185306638f, 0.988638401f},
-std::array<float,2>{0.368791133f, 0.127225041f},
-std::array<float,2>{0.857291162f, 0.838984191f},
-std::array<float,2>{0.694048107f, 0.293376535f},
-std::array<float,2>{0.0696064159f, 0.694380701f},
-std::array<float,2>{0.191388875f, 0.392090321f},
-std::array<float,2>{0.530260205f, 0.523308933f},
-std::array<float,2>{0.934006333f, 0.0411197841f},
-std::array<float,2>{0.498102874f, 0.993767679f},
-std::array<float,2>{0.0547138229f, 0.113928065f},
-std::array<float,2>{0.687069476f, 0.884541273f},
-std::array<float,2>{0.810661733f, 0.497067004f},
-std::array<float,2>{0.297521621f, 0.599521458f},
-std::array<float,2>{0.428589165f, 0.327507257f},
-std::array<float,2>{0.979233682f, 0.665522337f},
-std::array<float,2>{0.593087137f, 0.238886431f},
-std::array<float,2>{0.158761069f, 0.807051241f},
-std::array<float,2>{0.467139333f, 0.0218886975f},
-std::array<float,2>{0.888675034f, 0.951557159f},
-std::array<float,2>{0.550871015f, 0.409681886f},
-std::array<float,2>{0.219454467f, 0.537026823f},
-std::array<float,2>{0.0976379886f, 0.26368311f},
-std::array<float,2>{0.743915796f, 0.719213843f},
-std::array<float,2>{0.832785666f, 0.177676871f},
-std::array<float,2>{0.330404103f, 0.851243675f},
-std::array<float,2>{0.15008682f, 0.203665897f},
-std::array<float,2>{0.59546423f, 0.752178371f},
-std::array<float,2>{0.946350217f, 0.366998702f},
-std::array<float,2>{0.403312176f, 0.647194445f},
-std::array<float,2>{0.264508426f, 0.464208066f},
-std::array<float,2>{0.768497646f, 0.591070414f},
-std::array<float,2>{0.647717118f, 0.0864239112f},
-std::array<float,2>{0.0042746081f, 0.915262878f},
-std::array<float,2>{0.386699975f, 0.231562823f},
-std::array<float,2>{0.954873383f, 0.784743607f},
-std::array<float,2>{0.616268754f, 0.339095503f},
-std::array<float,2>{0.13158524f, 0.682833791f},
-std::array<float,2>{0.0281749051f, 0.473569602f},
-std::array<float,2>{0.640575409f, 0.621430755f},
-std::array<float,2>{0.753094673f, 0.103972837f},
-std::array<float,2>{0.279124767f, 0.898406148f},
-std::array<float,2>{0.241899282f, 0.0532057211f},
-std::array<float,2>{0.535342872f, 0.983357131f},
-std::array<float,2>{0.898522675f, 0.381786138f},
-std::array<float,2>{0.448788255f, 0.508693695f},
-std::array<float,2>{0.315027535f, 0.307255387f},
-std::array<float,2>{0.814742446f, 0.715614736f},
-std::array<float,2>{0.728813112f, 0.151171759f},
-std::array<float,2>{0.118725054f, 0.819433451f},
-std::array<float,2>{0.282232583f, 0.0775569156f},
-std::array<float,2>{0.785209477f, 0.936854959f},
-std::array<float,2>{0.656768799f, 0.451440692f},
-std::array<float,2>{0.0444052145f, 0.577851534f},
-std::array<float,2>{0.179870412f, 0.344591707f},
-std::array<float,2>{0.572454572f, 0.638622999f},
-std::array<float,2>{0.995064735f, 0.189984933f},
-std::array<float,2>{0.409320325f, 0.773003161f},
-std::array<float,2>{0.0892234594f, 0.16713202f},
-std::array<float,2>{0.716047108f, 0.86170572f},
-std::array<float,2>{0.867552817f, 0.278165668f},
-std::array<float,2>{0.343775868f, 0.744483888f},
-std::array<float,2>{0.469852954f, 0.431615531f},
-std::array<float,2>{0.911313653f, 0.561423659f},
-std::array<float,2>{0.510762393f, 0.00115196675f},
-std::array<float,2>{0.214563578f, 0.958401084f},
-std::array<float,2>{0.271336675f, 0.201050833f},
-std::array<float,2>{0.75873059f, 0.779353797f},
-std::array<float,2>{0.631100774f, 0.354733735f},
-std::array<float,2>{0.0177590437f, 0.629901052f},
-std::array<float,2>{0.137427211f, 0.440613806f},
-std::array<float,2>{0.624690413f, 0.566543818f},
-std::array<float,2>{0.965872407f, 0.0656076297f},
-std::array<float,2>{0.375228196f, 0.92685771f},
-std::array<float,2>{0.112905934f, 0.0105840629f},
-std::array<float,2>{0.719600081f, 0.961351573f},
-std::array<float,2>{0.82368803f, 0.427253813f},
-std::array<float,2>{0.321180195f, 0.547344267f},
-std::array<float,2>{0.442454875f, 0.266661346f},
-std::array<float,2>{0.892329335f, 0.735452414f},
-std::array<float,2>{0.543457866f, 0.159195691f},
-std::array<float,2>{0.248114318f, 0.867923975f},
-std::array<float,2>{0.417452216f, 0.0989539921f},
-std::array<float,2>{0.986775815f, 0.905130446f},
-std::array<float,2>{0.570036113f, 0.484150231f},
-std::array<float,2>{0.17447497f, 0.611435056f},
-std::array<float,2>{0.0369275212f, 0.329201788f},
-std::array<float,2>{0.66804111f, 0.672166348f},
-std::array<float,2>{0.794256985f, 0.225179404f},
-std::array<float,2>{0.296292603f, 0.794271171f},
-std::array<float,2>{0.209200442f, 0.145648643f},
-std::array<float,2>{0.504934132f, 0.822757602f},
-std::array<float,2>{0.918745995f, 0.300531298f},
-std::array<float,2>{0.482800245f, 0.709514081f},
-std::array<float,2>{0.353067756f, 0.386828691f},
-std::array<float,2>{0.861059427f, 0.501146317f},
-std::array<float,2>{0.708925426f, 0.0554754212f},
-std::array<float,2>{0.0830996037f, 0.973210871f},
-std::array<float,2>{0.489708453f, 0.183622196f},
-std::array<float,2>{0.922057331f, 0.854685187f},
-std::array<float,2>{0.515956223f, 0.253437608f},
-std::array<float,2>{0.20213975f, 0.727309585f},
-std::array<float,2>{0.0712262318f, 0.41942355f},
-std::array<float,2>{0.700267911f, 0.546737969f},
-std::array<float,2>{0.844834983f, 0.0256874021f},
-std::array<float,2>{0.365249068f, 0.942485988f},
-std::array<float,2>{0.168823153f, 0.0821360648f},
-std::array<float,2>{0.58304131f, 0.90858978f},
-std::array<float,2>{0.969020844f, 0.457072616f},
-std::array<float,2>{0.433953315f, 0.58220917f},
-std::array<float,2>{0.310822219f, 0.372982502f},
-std::array<float,2>{0.803105295f, 0.6528036f},
-std::array<float,2>{0.675531447f, 0.215512186f},
-std::array<float,2>{0.0503770672f, 0.762616277f},
-std::array<float,2>{0.336991102f, 0.0388529859f},
-std::array<float,2>{0.842211723f, 0.986266673f},
-std::array<float,2>{0.735202253f, 0.40016973f},
-std::array<float,2>{0.101849303f, 0.529487848f},
-std::array<float,2>{0.226922736f, 0.283495098f},
-std::array<float,2>{0.560347378f, 0.701730728f},
-std::array<float,2>{0.882466197f, 0.138196498f},
-std::array<float,2>{0.460778832f, 0.834861338f},
-std::array<float,2>{0.0155387754f, 0.244954363f},
-std::array<float,2>{0.653735638f, 0.801505685f},
-std::array<float,2>{0.774634957f, 0.315715969f},
-std::array<float,2>{0.252663821f, 0.66185534f},
-std::array<float,2>{0.394437671f, 0.48616758f},
-std::array<float,2>{0.939998806f, 0.602932096f},
-std::array<float,2>{0.604009628f, 0.120707907f},
-std::array<float,2>{0.145165756f, 0.878953278f},
-std::array<float,2>{0.361767888f, 0.22781831f},
-std::array<float,2>{0.84947902f, 0.786114693f},
-std::array<float,2>{0.699130356f, 0.341000706f},
-std::array<float,2>{0.0769649372f, 0.686562002f},
-std::array<float,2>{0.197702214f, 0.469718903f},
-std::array<float,2>{0.520217299f, 0.618224502f},
-std::array<float,2>{0.929406464f, 0.108185939f},
-std::array<float,2>{0.48547557f, 0.892089486f},
-std::array<float,2>{0.0544224717f, 0.0483258218f},
-std::array<float,2>{0.677625835f, 0.980272293f},
-std::array<float,2>{0.79817611f, 0.378174752f},
-std::array<float,2>{0.30608508f, 0.511799097f},
-std::array<float,2>{0.431987733f, 0.309766889f},
-std::array<float,2>{0.972923875f, 0.714284837f},
-std::array<float,2>{0.581082106f, 0.153087229f},
-std::array<float,2>{0.164509386f, 0.816155791f},
-std::array<float,2>{0.456743747f, 0.0740216002f},
-std::array<float,2>{0.87563163f, 0.931950629f},
-std::array<float,2>{0.555877388f, 0.446278036f},
-std::array<float,2>{0.233965278f, 0.570418775f},
-std::array<float,2>{0.106192075f, 0.350143522f},
-std::array<float,2>{0.741199911f, 0.635465026f},
-std::array<float,2>{0.835963488f, 0.193650648f},
-std::array<float,2>{0.34351632f, 0.766528487f},
-std::array<float,2>{0.144336417f, 0.171082541f},
-std::array<float,2>{0.605803311f, 0.866444349f},
-std::array<float,2>{0.943253875f, 0.276662827f},
-std::array<float,2>{0.397944003f, 0.748444259f},
-std::array<float,2>{0.255746394f, 0.43400985f},
-std::array<float,2>{0.780365825f, 0.558507085f},
-std::array<float,2>{0.648956895f, 0.00429567974f},
-std::array<float,2>{0.0081506595f, 0.955742359f},
-std::array<float,2>{0.380619556f, 0.131759629f},
-std::array<float,2>{0.961396813f, 0.840030074f},
-std::array<float,2>{0.619669259f, 0.289155483f},
-std::array<float,2>{0.133060485f, 0.690106213f},
-std::array<float,2>{0.0229566712f, 0.394630671f},
-std::array<float,2>{0.626021504f, 0.517727613f},
-std::array<float,2>{0.762756526f, 0.0467675887f},
-std::array<float,2>{0.267956287f, 0.99888736f},
-std::array<float,2>{0.242709219f, 0.109977536f},
-std::array<float,2>{0.541178703f, 0.889182031f},
-std::array<float,2>{0.896595597f, 0.49423942f},
-std::array<float,2>{0.440655738f, 0.597602069f},
-std::array<float,2>{0.326187104f, 0.32067579f},
-std::array<float,2>{0.824811757f, 0.669880211f},
-std::array<float,2>{0.724724233f, 0.234942004f},
-std::array<float,2>{0.113748781f, 0.811479867f},
-std::array<float,2>{0.292575538f, 0.0186143275f},
-std::array<float,2>{0.792325318f, 0.946554482f},
-std::array<float,2>{0.66768086f, 0.411327958f},
-std::array<float,2>{0.0346825309f, 0.531460404f},
-std::array<float,2>{0.178853527f, 0.260741502f},
-std::array<float,2>{0.564660311f, 0.722687364f},
-std::array<float,2>{0.991737783f, 0.17423138f},
-std::array<float,2>{0.421496809f, 0.846311986f},
-std::array<float,2>{0.0788459331f, 0.210730046f},
-std::array<float,2>{0.705563426f, 0.754867613f},
-std::array<float,2>{0.866405785f, 0.36103949f},
-std::array<float,2>{0.358822435f, 0.640891492f},
-std::array<float,2>{0.479564369f, 0.46796909f},
-std::array<float,2>{0.914635479f, 0.58803308f},
-std::array<float,2>{0.501912951f, 0.0930806547f},
-std::array<float,2>{0.203338295f, 0.921648085f},
-std::array<float,2>{0.273830116f, 0.180317849f},
-std::array<float,2>{0.754314125f, 0.859352469f},
-std::array<float,2>{0.635264575f, 0.256654501f},
-std::array<float,2>{0.0270846002f, 0.731474161f},
-std::array<float,2>{0.128324509f, 0.416304857f},
-std::array<float,2>{0.611656785f, 0.54172945f},
-std::array<float,2>{0.957101643f, 0.0303211547f},
-std::array<float,2>{0.3867971f, 0.937654674f},
-std::array<float,2>{0.124547005f, 0.0801976621f},
-std::array<float,2>{0.733817101f, 0.912695825f},
-std::array<float,2>{0.817885578f, 0.455515563f},
-std::array<float,2>{0.319372416f, 0.579537868f},
-std::array<float,2>{0.453047603f, 0.368629992f},
-std::array<float,2>{0.9045192f, 0.649325669f},
-std::array<float,2>{0.533115745f, 0.212499619f},
-std::array<float,2>{0.236583486f, 0.761461079f},
-std::array<float,2>{0.41395691f, 0.0350423083f},
-std::array<float,2>{0.998266459f, 0.98977828f},
-std::array<float,2>{0.577294827f, 0.403198093f},
-std::array<float,2>{0.187150389f, 0.526373565f},
-std::array<float,2>{0.0397580601f, 0.286599606f},
-std::array<float,2>{0.662847698f, 0.699194133f},
-std::array<float,2>{0.781716228f, 0.135300219f},
-std::array<float,2>{0.288135737f, 0.828894794f},
-std::array<float,2>{0.214954555f, 0.249410242f},
-std::array<float,2>{0.515513003f, 0.800348043f},
-std::array<float,2>{0.908923864f, 0.316624254f},
-std::array<float,2>{0.476164877f, 0.658534586f},
-std::array<float,2>{0.351368546f, 0.49014768f},
-std::array<float,2>{0.871336877f, 0.607904375f},
-std::array<float,2>{0.712256968f, 0.121399902f},
-std::array<float,2>{0.0934074596f, 0.876877606f},
-std::array<float,2>{0.494105279f, 0.19875297f},
-std::array<float,2>{0.930675447f, 0.77561444f},
-std::array<float,2>{0.526703358f, 0.35598138f},
-std::array<float,2>{0.193723023f, 0.628574431f},
-std::array<float,2>{0.0649914742f, 0.441677421f},
-std::array<float,2>{0.690198064f, 0.563522279f},
-std::array<float,2>{0.854164958f, 0.0691849068f},
-std::array<float,2>{0.374791473f, 0.92363584f},
-std::array<float,2>{0.162490383f, 0.0132989632f},
-std::array<float,2>{0.586057305f, 0.968356788f},
-std::array<float,2>{0.981398761f, 0.422072083f},
-std::array<float,2>{0.424199879f, 0.552363694f},
-std::array<float,2>{0.302704543f, 0.272402495f},
-std::array<float,2>{0.807632446f, 0.741490543f},
-std::array<float,2>{0.680180967f, 0.16017057f},
-std::array<float,2>{0.0602449253f, 0.874622881f},
-std::array<float,2>{0.335672438f, 0.0952247754f},
-std::array<float,2>{0.832008839f, 0.899716198f},
-std::array<float,2>{0.747688055f, 0.477209359f},
-std::array<float,2>{0.0994321108f, 0.616733491f},
-std::array<float,2>{0.225206181f, 0.335604966f},
-std::array<float,2>{0.547776997f, 0.675803065f},
-std::array<float,2>{0.885080636f, 0.220065296f},
-std::array<float,2>{0.461799562f, 0.791747034f},
-std::array<float,2>{0.000545995601f, 0.142261222f},
-std::array<float,2>{0.64133507f, 0.826468945f},
-std::array<float,2>{0.769539833f, 0.301013857f},
-std::array<float,2>{0.258346319f, 0.705775797f},
-std::array<float,2>{0.400363535f, 0.383453816f},
-std::array<float,2>{0.952747643f, 0.506684124f},
-std::array<float,2>{0.599271834f, 0.0611831062f},
-std::array<float,2>{0.154416516f, 0.971125066f},
-std::array<float,2>{0.312606752f, 0.152241588f},
-std::array<float,2>{0.81435889f, 0.818412721f},
-std::array<float,2>{0.727391124f, 0.308067262f},
-std::array<float,2>{0.120469064f, 0.716703832f},
-std::array<float,2>{0.239476919f, 0.381961733f},
-std::array<float,2>{0.53821969f, 0.508791685f},
-std::array<float,2>{0.902329981f, 0.0546614975f},
-std::array<float,2>{0.447028786f, 0.983472228f},
-std::array<float,2>{0.0296056625f, 0.105379127f},
-std::array<float,2>{0.637994528f, 0.897398114f},
-std::array<float,2>{0.751194954f, 0.473841906f},
-std::array<float,2>{0.280956447f, 0.622211099f},
-std::array<float,2>{0.383283854f, 0.338348329f},
-std::array<float,2>{0.955471396f, 0.681765854f},
-std::array<float,2>{0.613594592f, 0.230512276f},
-std::array<float,2>{0.130401611f, 0.7840271f},
-std::array<float,2>{0.471256763f, 0.000495306973f},
-std::array<float,2>{0.912769854f, 0.957498074f},
-std::array<float,2>{0.507830143f, 0.429801017f},
-std::array<float,2>{0.212107643f, 0.561780989f},
-std::array<float,2>{0.0873621255f, 0.279143602f},
-std::array<float,2>{0.717740059f, 0.745695174f},
-std::array<float,2>{0.869717538f, 0.166920289f},
-std::array<float,2>{0.347585797f, 0.862733185f},
-std::array<float,2>{0.182123408f, 0.190706238f},
-std::array<float,2>{0.571212351f, 0.772116184f},
-std::array<float,2>{0.99272567f, 0.345652699f},
-std::array<float,2>{0.406463861f, 0.636977255f},
-std::array<float,2>{0.284676939f, 0.452388734f},
-std::array<float,2>{0.78854233f, 0.576317608f},
-std::array<float,2>{0.65918988f, 0.0771216005f},
-std::array<float,2>{0.0466992557f, 0.935777783f},
-std::array<float,2>{0.426888138f, 0.240121096f},
-std::array<float,2>{0.976938188f, 0.807926834f},
-std::array<float,2>{0.590309262f, 0.326662302f},
-std::array<float,2>{0.15802972f, 0.664550841f},
-std::array<float,2>{0.0578498691f, 0.49775207f},
-std::array<float,2>{0.684383452f, 0.598277986f},
-std::array<float,2>{0.809127867f, 0.114972003f},
-std::array<float,2>{0.299304217f, 0.883286536f},
-std::array<float,2>{0.187684193f, 0.042521175f},
-std::array<float,2>{0.529012024f, 0.992518723f},
-std::array<float,2>{0.937304616f, 0.390675783f},
-std::array<float,2>{0.497952014f, 0.521858633f},
-std::array<float,2>{0.369461089f, 0.294057757f},
-std::array<float,2>{0.859091878f, 0.694332421f},
-std::array<float,2>{0.692769945f, 0.128065184f},
-std::array<float,2>{0.0665316805f, 0.838038266f},
-std::array<float,2>{0.263640404f, 0.0877039433f},
-std::array<float,2>{0.766635835f, 0.914552808f},
-std::array<float,2>{0.644862056f, 0.463723063f},
-std::array<float,2>{0.00702343788f, 0.590363085f},
-std::array<float,2>{0.151229531f, 0.366039932f},
-std::array<float,2>{0.597314537f, 0.64792943f},
-std::array<float,2>{0.947988927f, 0.204404488f},
-std::array<float,2>{0.405976266f, 0.753628194f},
-std::array<float,2>{0.093955718f, 0.175933152f},
-std::array<float,2>{0.745418549f, 0.849687278f},
-std::array<float,2>{0.835398614f, 0.264937878f},
-std::array<float,2>{0.328921974f, 0.7202034f},
-std::array<float,2>{0.465922296f, 0.408758819f},
-std::array<float,2>{0.887362361f, 0.535878062f},
-std::array<float,2>{0.554067194f, 0.0226177964f},
-std::array<float,2>{0.22100687f, 0.952588558f},
-std::array<float,2>{0.309545606f, 0.215874493f},
-std::array<float,2>{0.802615702f, 0.762985528f},
-std::array<float,2>{0.672812998f, 0.371201754f},
-std::array<float,2>{0.048775658f, 0.653364122f},
-std::array<float,2>{0.170787573f, 0.458851993f},
-std::array<float,2>{0.585257709f, 0.583123863f},
-std::array<float,2>{0.971923292f, 0.0830295309f},
-std::array<float,2>{0.436377704f, 0.909687579f},
-std::array<float,2>{0.072595939f, 0.027175555f},
-std::array<float,2>{0.702876568f, 0.941421926f},
-std::array<float,2>{0.846191406f, 0.418856621f},
-std::array<float,2>{0.364535332f, 0.545217872f},
-std::array<float,2>{0.492124379f, 0.252309024f},
-std::array<float,2>{0.924249887f, 0.728395939f},
-std::array<float,2>{0.517876208f, 0.185209736f},
-std::array<float,2>{0.201166689f, 0.854015172f},
-std::array<float,2>{0.391010135f, 0.119820811f},
-std::array<float,2>{0.937883198f, 0.880455911f},
-std::array<float,2>{0.601846039f, 0.484929353f},
-std::array<float,2>{0.147445157f, 0.6024912f},
-std::array<float,2>{0.0124807833f, 0.315168917f},
-std::array<float,2>{0.654983699f, 0.660169363f},
-std::array<float,2>{0.776832342f, 0.245317847f},
-std::array<float,2>{0.250114202f, 0.802711844f},
-std::array<float,2>{0.229030579f, 0.137058601f},
-std::array<float,2>{0.561135173f, 0.835180163f},
-std::array<float,2>{0.880262136f, 0.285063863f},
-std::array<float,2>{0.458430707f, 0.702363253f},
-std::array<float,2>{0.339329392f, 0.399290562f},
-std::array<float,2>{0.841083348f, 0.530581892f},
-std::array<float,2>{0.737396598f, 0.0376466177f},
-std::array<float,2>{0.10495194f, 0.985056818f},
-std::array<float,2>{0.444059908f, 0.158620507f},
-std::array<float,2>{0.894053936f, 0.868939221f},
-std::array<float,2>{0.544980228f, 0.265675068f},
-std::array<float,2>{0.246833265f, 0.735178828f},
-std::array<float,2>{0.11033868f, 0.426720828f},
-std::array<float,2>{0.720714271f, 0.548268437f},
-std::array<float,2>{0.821820915f, 0.0109112579f},
-std::array<float,2>{0.322662741f, 0.962783754f},
-std::array<float,2>{0.140391573f, 0.0651307851f},
-std::array<float,2>{0.622546554f, 0.926082134f},
-std::array<float,2>{0.968696833f, 0.439777523f},
-std::array<float,2>{0.378520101f, 0.567552805f},
-std::array<float,2>{0.271579117f, 0.354339987f},
-std::array<float,2>{0.760668874f, 0.629514575f},
-std::array<float,2>{0.629831314f, 0.199774355f},
-std::array<float,2>{0.0174157023f, 0.780993283f},
-std::array<float,2>{0.35367617f, 0.0557685308f},
-std::array<float,2>{0.862046182f, 0.973973334f},
-std::array<float,2>{0.709671915f, 0.388359874f},
-std::array<float,2>{0.0858108923f, 0.500092268f},
-std::array<float,2>{0.20756124f, 0.299264044f},
-std::array<float,2>{0.506321192f, 0.710337996f},
-std::array<float,2>{0.920470297f, 0.144604087f},
-std::array<float,2>{0.480895728f, 0.823921084f},
-std::array<float,2>{0.03775087f, 0.225625932f},
-std::array<float,2>{0.671016514f, 0.793258548f},
-std::array<float,2>{0.796641111f, 0.328755409f},
-std::array<float,2>{0.293116957f, 0.673433542f},
-std::array<float,2>{0.415158451f, 0.482992023f},
-std::array<float,2>{0.985604107f, 0.612674415f},
-std::array<float,2>{0.566801667f, 0.0983053446f},
-std::array<float,2>{0.172677442f, 0.905603945f},
-std::array<float,2>{0.339878321f, 0.192942232f},
-std::array<float,2>{0.839451134f, 0.767937362f},
-std::array<float,2>{0.738751888f, 0.349600136f},
-std::array<float,2>{0.107994594f, 0.63349086f},
-std::array<float,2>{0.231660679f, 0.447688103f},
-std::array<float,2>{0.558435142f, 0.574204266f},
-std::array<float,2>{0.878228128f, 0.0704620108f},
-std::array<float,2>{0.454519689f, 0.930479527f},
-std::array<float,2>{0.0102402382f, 0.00588054582f},
-std::array<float,2>{0.651253104f, 0.953536451f},
-std::array<float,2>{0.778036714f, 0.436104357f},
-std::array<float,2>{0.256726235f, 0.556471288f},
-std::array<float,2>{0.395956904f, 0.273618609f},
-std::array<float,2>{0.944973946f, 0.747831166f},
-std::array<float,2>{0.609053671f, 0.169149965f},
-std::array<float,2>{0.141472086f, 0.863901496f},
-std::array<float,2>{0.486525178f, 0.107232191f},
-std::array<float,2>{0.926540613f, 0.892800152f},
-std::array<float,2>{0.521582186f, 0.472368479f},
-std::array<float,2>{0.195367426f, 0.619449377f},
-std::array<float,2>{0.0750090629f, 0.343066335f},
-std::array<float,2>{0.695987582f, 0.684899807f},
-std::array<float,2>{0.85127449f, 0.229389593f},
-std::array<float,2>{0.359588057f, 0.788789749f},
-std::array<float,2>{0.166365728f, 0.155465111f},
-std::array<float,2>{0.579944968f, 0.813861787f},
-std::array<float,2>{0.975525975f, 0.312450677f},
-std::array<float,2>{0.431013912f, 0.711065471f},
-std::array<float,2>{0.307691008f, 0.376320988f},
-std::array<float,2>{0.79953897f, 0.513963103f},
-std::array<float,2>{0.677770734f, 0.0488556735f},
-std::array<float,2>{0.0513959266f, 0.976742685f},
-std::array<float,2>{0.418795705f, 0.171886772f},
-std::array<float,2>{0.988534212f, 0.844897151f},
-std::array<float,2>{0.56395185f, 0.257900059f},
-std::array<float,2>{0.177179724f, 0.725026011f},
-std::array<float,2>{0.0324803255f, 0.41305086f},
-std::array<float,2>{0.664140701f, 0.534717858f},
-std::array<float,2>{0.790488183f, 0.017161062f},
-std::array<float,2>{0.289571255f, 0.948341727f},
-std::array<float,2>{0.205089808f, 0.0908600166f},
-std::array<float,2>{0.503868401f, 0.918635428f},
-std::array<float,2>{0.916887224f, 0.465834826f},
-std::array<float,2>{0.478219151f, 0.586880565f},
-std::array<float,2>{0.356086075f, 0.361678243f},
-std::array<float,2>{0.864573598f, 0.643957555f},
-std::array<float,2>{0.704091489f, 0.207981691f},
-std::array<float,2>{0.0805899501f, 0.757626772f},
-std::array<float,2>{0.265901238f, 0.0437480249f},
-std::array<float,2>{0.765591681f, 0.997773647f},
-std::array<float,2>{0.628447294f, 0.398034543f},
-std::array<float,2>{0.0209539998f, 0.517376244f},
-std::array<float,2>{0.136112094f, 0.291710824f},
-std::array<float,2>{0.618483007f, 0.687580526f},
-std::array<float,2>{0.963127017f, 0.130639166f},
-std::array<float,2>{0.381273329f, 0.842438459f},
-std::array<float,2>{0.115787536f, 0.237363562f},
-std::array<float,2>{0.723953426f, 0.809760809f},
-std::array<float,2>{0.826496482f, 0.323387802f},
-std::array<float,2>{0.3248128f, 0.669945359f},
-std::array<float,2>{0.438929468f, 0.493721277f},
-std::array<float,2>{0.894729078f, 0.594143629f},
-std::array<float,2>{0.539426029f, 0.112290278f},
-std::array<float,2>{0.245283723f, 0.887712836f},
-std::array<float,2>{0.286487997f, 0.133707538f},
-std::array<float,2>{0.784350514f, 0.830822885f},
-std::array<float,2>{0.66181612f, 0.288486838f},
-std::array<float,2>{0.0413627066f, 0.697048247f},
-std::array<float,2>{0.184317604f, 0.404767543f},
-std::array<float,2>{0.575754642f, 0.524787545f},
-std::array<float,2>{0.996623337f, 0.0316988304f},
-std::array<float,2>{0.411086798f, 0.990617514f},
-std::array<float,2>{0.0900251046f, 0.123573206f},
-std::array<float,2>{0.714249074f, 0.87758112f},
-std::array<float,2>{0.874558806f, 0.490828633f},
-std::array<float,2>{0.349433333f, 0.605773449f},
-std::array<float,2>{0.47317934f, 0.318948179f},
-std::array<float,2>{0.907692611f, 0.657909393f},
-std::array<float,2>{0.513514936f, 0.247259915f},
-std::array<float,2>{0.217953086f, 0.798680246f},
-std::array<float,2>{0.390564352f, 0.0273511056f},
-std::array<float,2>{0.960475087f, 0.941262603f},
-std::array<float,2>{0.609627187f, 0.414957553f},
-std::array<float,2>{0.125122443f, 0.540506244f},
-std::array<float,2>{0.0253347773f, 0.254658073f},
-std::array<float,2>{0.634369731f, 0.733322442f},
-std::array<float,2>{0.757782459f, 0.181991652f},
-std::array<float,2>{0.277243137f, 0.856018364f},
-std::array<float,2>{0.235514671f, 0.214702219f},
-std::array<float,2>{0.53361088f, 0.757858396f},
-std::array<float,2>{0.904178441f, 0.370782733f},
-std::array<float,2>{0.451127082f, 0.652025282f},
-std::array<float,2>{0.317483008f, 0.454035074f},
-std::array<float,2>{0.818675458f, 0.580997884f},
-std::array<float,2>{0.731970906f, 0.0799992159f},
-std::array<float,2>{0.12188489f, 0.910396874f},
-std::array<float,2>{0.464024454f, 0.221159741f},
-std::array<float,2>{0.884122849f, 0.790649116f},
-std::array<float,2>{0.550526023f, 0.332219183f},
-std::array<float,2>{0.223197624f, 0.678719938f},
-std::array<float,2>{0.10036023f, 0.479334831f},
-std::array<float,2>{0.748252988f, 0.61449033f},
-std::array<float,2>{0.829901338f, 0.0964094996f},
-std::array<float,2>{0.333958775f, 0.901280582f},
-std::array<float,2>{0.152408853f, 0.058987163f},
-std::array<float,2>{0.600541472f, 0.969522417f},
-std::array<float,2>{0.94958353f, 0.38553679f},
-std::array<float,2>{0.402189463f, 0.505858958f},
-std::array<float,2>{0.260506213f, 0.303705812f},
-std::array<float,2>{0.771866918f, 0.703729212f},
-std::array<float,2>{0.64319241f, 0.144271448f},
-std::array<float,2>{0.00243782601f, 0.825989664f},
-std::array<float,2>{0.371871233f, 0.0679320469f},
-std::array<float,2>{0.85168767f, 0.925529957f},
-std::array<float,2>{0.688920319f, 0.444796056f},
-std::array<float,2>{0.0639088079f, 0.565128088f},
-std::array<float,2>{0.19196716f, 0.357929885f},
-std::array<float,2>{0.5235309f, 0.626071036f},
-std::array<float,2>{0.932689905f, 0.196445018f},
-std::array<float,2>{0.495314181f, 0.77450794f},
-std::array<float,2>{0.0613401532f, 0.1632725f},
-std::array<float,2>{0.682137966f, 0.871623278f},
-std::array<float,2>{0.805586696f, 0.270344287f},
-std::array<float,2>{0.303626359f, 0.738685727f},
-std::array<float,2>{0.423184156f, 0.424448788f},
-std::array<float,2>{0.983986974f, 0.553008497f},
-std::array<float,2>{0.589626729f, 0.0149716362f},
-std::array<float,2>{0.161304697f, 0.96504277f},
-std::array<float,2>{0.34561792f, 0.164151832f},
-std::array<float,2>{0.869053364f, 0.860275805f},
-std::array<float,2>{0.715453327f, 0.280489057f},
-std::array<float,2>{0.0881159604f, 0.743462086f},
-std::array<float,2>{0.213826939f, 0.43216154f},
-std::array<float,2>{0.51051259f, 0.558895826f},
-std::array<float,2>{0.910811841f, 0.00218577147f},
-std::array<float,2>{0.469140738f, 0.959025204f},
-std::array<float,2>{0.0435114801f, 0.0746964887f},
-std::array<float,2>{0.657693326f, 0.933991075f},
-std::array<float,2>{0.78635937f, 0.450160325f},
-std::array<float,2>{0.281396478f, 0.57524246f},
-std::array<float,2>{0.408385575f, 0.346715569f},
-std::array<float,2>{0.995312989f, 0.640158892f},
-std::array<float,2>{0.573814809f, 0.18750374f},
-std::array<float,2>{0.180681378f, 0.769914865f},
-std::array<float,2>{0.447813898f, 0.0513340011f},
-std::array<float,2>{0.899866879f, 0.982148707f},
-std::array<float,2>{0.536802292f, 0.379534155f},
-std::array<float,2>{0.240580067f, 0.511296451f},
-std::array<float,2>{0.117350392f, 0.305337518f},
-std::array<float,2>{0.730461836f, 0.717894912f},
-std::array<float,2>{0.816267252f, 0.14901185f},
-std::array<float,2>{0.315643758f, 0.816896319f},
-std::array<float,2>{0.131839529f, 0.23275207f},
-std::array<float,2>{0.616050839f, 0.782982528f},
-std::array<float,2>{0.953975618f, 0.336016357f},
-std::array<float,2>{0.38539061f, 0.681200564f},
-std::array<float,2>{0.278097302f, 0.476208627f},
-std::array<float,2>{0.75207448f, 0.624942362f},
-std::array<float,2>{0.63960427f, 0.102245584f},
-std::array<float,2>{0.0292919911f, 0.895633876f},
-std::array<float,2>{0.404247761f, 0.205909252f},
-std::array<float,2>{0.945760429f, 0.750665545f},
-std::array<float,2>{0.594053388f, 0.364967376f},
-std::array<float,2>{0.148646504f, 0.645328879f},
-std::array<float,2>{0.00530864671f, 0.461309254f},
-std::array<float,2>{0.647037566f, 0.592106521f},
-std::array<float,2>{0.769182384f, 0.0892262459f},
-std::array<float,2>{0.264853626f, 0.917774081f},
-std::array<float,2>{0.220303878f, 0.0207980797f},
-std::array<float,2>{0.552209735f, 0.950572431f},
-std::array<float,2>{0.889854968f, 0.407787979f},
-std::array<float,2>{0.468632579f, 0.538689435f},
-std::array<float,2>{0.33200407f, 0.262420952f},
-std::array<float,2>{0.833225191f, 0.721307397f},
-std::array<float,2>{0.742316484f, 0.179401368f},
-std::array<float,2>{0.0960574895f, 0.848966181f},
-std::array<float,2>{0.298821092f, 0.115414307f},
-std::array<float,2>{0.812390268f, 0.885820866f},
-std::array<float,2>{0.686447203f, 0.498873234f},
-std::array<float,2>{0.0564092509f, 0.601505876f},
-std::array<float,2>{0.159191638f, 0.324533969f},
-std::array<float,2>{0.592179358f, 0.66674149f},
-std::array<float,2>{0.980414152f, 0.241423309f},
-std::array<float,2>{0.429113299f, 0.806353033f},
-std::array<float,2>{0.0689192489f, 0.125494823f},
-std::array<float,2>{0.695152938f, 0.836393476f},
-std::array<float,2>{0.856287539f, 0.295855552f},
-std::array<float,2>{0.367652267f, 0.69235146f},
-std::array<float,2>{0.499686539f, 0.393914461f},
-std::array<float,2>{0.934761703f, 0.521259367f},
-std::array<float,2>{0.530494571f, 0.0396929048f},
-std::array<float,2>{0.189459458f, 0.995800197f},
-std::array<float,2>{0.253290713f, 0.242386445f},
-std::array<float,2>{0.774153173f, 0.803159535f},
-std::array<float,2>{0.653129995f, 0.31303978f},
-std::array<float,2>{0.0138671184f, 0.663332283f},
-std::array<float,2>{0.146166801f, 0.487360656f},
-std::array<float,2>{0.604913235f, 0.604983568f},
-std::array<float,2>{0.940882087f, 0.11735297f},
-std::array<float,2>{0.393208355f, 0.882799268f},
-std::array<float,2>{0.103034638f, 0.0361740738f},
-std::array<float,2>{0.735999107f, 0.986341536f},
-std::array<float,2>{0.843136251f, 0.400975198f},
-std::array<float,2>{0.336378545f, 0.528751671f},
-std::array<float,2>{0.459914118f, 0.28227672f},
-std::array<float,2>{0.88126564f, 0.699921966f},
-std::array<float,2>{0.558764637f, 0.139768884f},
-std::array<float,2>{0.227725625f, 0.833708704f},
-std::array<float,2>{0.434609711f, 0.0853047892f},
-std::array<float,2>{0.969855607f, 0.906708717f},
-std::array<float,2>{0.582273304f, 0.460590601f},
-std::array<float,2>{0.169792742f, 0.585871696f},
-std::array<float,2>{0.0492973998f, 0.374548465f},
-std::array<float,2>{0.674540699f, 0.654842496f},
-std::array<float,2>{0.804594636f, 0.218336627f},
-std::array<float,2>{0.312472075f, 0.763754785f},
-std::array<float,2>{0.202167705f, 0.186139956f},
-std::array<float,2>{0.51726371f, 0.852496684f},
-std::array<float,2>{0.923811018f, 0.250665337f},
-std::array<float,2>{0.489046663f, 0.729475617f},
-std::array<float,2>{0.36678654f, 0.420820177f},
-std::array<float,2>{0.844566643f, 0.543223619f},
-std::array<float,2>{0.699843168f, 0.0249365047f},
-std::array<float,2>{0.0720569044f, 0.944623649f},
-std::array<float,2>{0.484183818f, 0.147919118f},
-std::array<float,2>{0.919763207f, 0.822053909f},
-std::array<float,2>{0.504280508f, 0.297509074f},
-std::array<float,2>{0.210835218f, 0.70867914f},
-std::array<float,2>{0.0820981488f, 0.389042169f},
-std::array<float,2>{0.707847595f, 0.502722323f},
-std::array<float,2>{0.85945195f, 0.0580915324f},
-std::array<float,2>{0.352431148f, 0.976513326f},
-std::array<float,2>{0.175422847f, 0.100580662f},
-std::array<float,2>{0.569055557f, 0.902741492f},
-std::array<float,2>{0.98745656f, 0.480817646f},
-std::array<float,2>{0.416649729f, 0.609704435f},
-std::array<float,2>{0.29563275f, 0.330637872f},
-std::array<float,2>{0.793690801f, 0.67426312f},
-std::array<float,2>{0.669125915f, 0.223233581f},
-std::array<float,2>{0.0355390124f, 0.796622992f},
-std::array<float,2>{0.321406275f, 0.00861929357f},
-std::array<float,2>{0.822697937f, 0.963873386f},
-std::array<float,2>{0.719805896f, 0.428688228f},
-std::array<float,2>{0.11204347f, 0.548973203f},
-std::array<float,2>{0.249076203f, 0.26787889f},
-std::array<float,2>{0.544698834f, 0.736779451f},
-std::array<float,2>{0.891546667f, 0.157368585f},
-std::array<float,2>{0.442045033f, 0.870016754f},
-std::array<float,2>{0.0187492035f, 0.202407628f},
-std::array<float,2>{0.632093847f, 0.778475106f},
-std::array<float,2>{0.759677649f, 0.353323281f},
-std::array<float,2>{0.269718796f, 0.631347179f},
-std::array<float,2>{0.376599103f, 0.437819034f},
-std::array<float,2>{0.965041876f, 0.568434477f},
-std::array<float,2>{0.623734534f, 0.0629937649f},
-std::array<float,2>{0.138645142f, 0.929313242f},
-std::array<float,2>{0.374393195f, 0.197179005f},
-std::array<float,2>{0.853698313f, 0.77535677f},
-std::array<float,2>{0.689680576f, 0.357629091f},
-std::array<float,2>{0.0645519495f, 0.626650929f},
-std::array<float,2>{0.194146156f, 0.445202172f},
-std::array<float,2>{0.526889205f, 0.56493926f},
-std::array<float,2>{0.931304574f, 0.0677367151f},
-std::array<float,2>{0.493574619f, 0.925184965f},
-std::array<float,2>{0.0599619262f, 0.0153987762f},
-std::array<float,2>{0.679724157f, 0.965343177f},
-std::array<float,2>{0.80832392f, 0.424275041f},
-std::array<float,2>{0.301966369f, 0.553298593f},
-std::array<float,2>{0.424380034f, 0.269636333f},
-std::array<float,2>{0.980824232f, 0.739132702f},
-std::array<float,2>{0.586729169f, 0.163680986f},
-std::array<float,2>{0.162929893f, 0.871485412f},
-std::array<float,2>{0.461023122f, 0.0959814116f},
-std::array<float,2>{0.885551333f, 0.900537729f},
-std::array<float,2>{0.54723525f, 0.478813767f},
-std::array<float,2>{0.224842414f, 0.614959657f},
-std::array<float,2>{0.0987217128f, 0.332863301f},
-std::array<float,2>{0.747470438f, 0.679243505f},
-std::array<float,2>{0.831377208f, 0.221242487f},
-std::array<float,2>{0.335414708f, 0.790296316f},
-std::array<float,2>{0.155141279f, 0.144006729f},
-std::array<float,2>{0.599060416f, 0.825510502f},
-std::array<float,2>{0.95234853f, 0.30286324f},
-std::array<float,2>{0.399463654f, 0.703585029f},
-std::array<float,2>{0.258233219f, 0.384857684f},
-std::array<float,2>{0.77048409f, 0.505212128f},
-std::array<float,2>{0.640999079f, 0.0595233664f},
-std::array<float,2>{0.000211158462f, 0.969085991f},
-std::array<float,2>{0.387308896f, 0.182199717f},
-std::array<float,2>{0.957528591f, 0.855818272f},
-std::array<float,2>{0.612251282f, 0.254150599f},
-std::array<float,2>{0.128771096f, 0.732528687f},
-std::array<float,2>{0.0265947469f, 0.414328843f},
-std::array<float,2>{0.635122836f, 0.54093653f},
-std::array<float,2>{0.754625797f, 0.0279129371f},
-std::array<float,2>{0.274030089f, 0.940522015f},
-std::array<float,2>{0.237042695f, 0.0793275461f},
-std::array<float,2>{0.532445967f, 0.910756826f},
-std::array<float,2>{0.904976487f, 0.453562051f},
-std::array<float,2>{0.452347368f, 0.580278635f},
-std::array<float,2>{0.319966167f, 0.37026605f},
-std::array<float,2>{0.817501426f, 0.651618183f},
-std::array<float,2>{0.734208822f, 0.21402812f},
-std::array<float,2>{0.124308623f, 0.758737147f},
-std::array<float,2>{0.288775533f, 0.0319517739f},
-std::array<float,2>{0.782013655f, 0.991104662f},
-std::array<float,2>{0.662447691f, 0.404830277f},
-std::array<float,2>{0.0395088345f, 0.525185347f},
-std::array<float,2>{0.186734214f, 0.288613617f},
-std::array<float,2>{0.578074872f, 0.696478665f},
-std::array<float,2>{0.998815536f, 0.13323091f},
-std::array<float,2>{0.413436949f, 0.830370009f},
-std::array<float,2>{0.0930078477f, 0.247934952f},
-std::array<float,2>{0.71244508f, 0.79800123f},
-std::array<float,2>{0.871913433f, 0.318729281f},
-std::array<float,2>{0.350664586f, 0.65757513f},
-std::array<float,2>{0.475844592f, 0.490699857f},
-std::array<float,2>{0.908570826f, 0.606021225f},
-std::array<float,2>{0.515103519f, 0.123387858f},
-std::array<float,2>{0.215448841f, 0.877059817f},
-std::array<float,2>{0.268137276f, 0.12995559f},
-std::array<float,2>{0.763558745f, 0.842041969f},
-std::array<float,2>{0.626531661f, 0.29127261f},
-std::array<float,2>{0.0228741784f, 0.688315749f},
-std::array<float,2>{0.133567974f, 0.397703409f},
-std::array<float,2>{0.619330049f, 0.516995549f},
-std::array<float,2>{0.961597443f, 0.0429723524f},
-std::array<float,2>{0.380009919f, 0.997150779f},
-std::array<float,2>{0.113908373f, 0.111719027f},
-std::array<float,2>{0.725494504f, 0.888240278f},
-std::array<float,2>{0.824226201f, 0.493284434f},
-std::array<float,2>{0.327118307f, 0.594348848f},
-std::array<float,2>{0.440945625f, 0.323977172f},
-std::array<float,2>{0.89706111f, 0.670708537f},
-std::array<float,2>{0.541940987f, 0.23810634f},
-std::array<float,2>{0.242260516f, 0.81016314f},
-std::array<float,2>{0.421217918f, 0.0169183593f},
-std::array<float,2>{0.991418123f, 0.948770404f},
-std::array<float,2>{0.565070331f, 0.412541121f},
-std::array<float,2>{0.1796128f, 0.534260631f},
-std::array<float,2>{0.0343932733f, 0.258555472f},
-std::array<float,2>{0.667339742f, 0.725165546f},
-std::array<float,2>{0.792655706f, 0.172632024f},
-std::array<float,2>{0.292475462f, 0.845476508f},
-std::array<float,2>{0.203888312f, 0.207385853f},
-std::array<float,2>{0.501023233f, 0.756881773f},
-std::array<float,2>{0.914347231f, 0.362170488f},
-std::array<float,2>{0.480402648f, 0.644416511f},
-std::array<float,2>{0.358931303f, 0.466532022f},
-std::array<float,2>{0.867148995f, 0.586363912f},
-std::array<float,2>{0.705743313f, 0.0916672051f},
-std::array<float,2>{0.0781549588f, 0.918300927f},
-std::array<float,2>{0.486288488f, 0.228604153f},
-std::array<float,2>{0.929074049f, 0.788319111f},
-std::array<float,2>{0.519556284f, 0.343595207f},
-std::array<float,2>{0.197931379f, 0.685098231f},
-std::array<float,2>{0.0763176084f, 0.471742749f},
-std::array<float,2>{0.698464572f, 0.619984448f},
-std::array<float,2>{0.848650932f, 0.106512547f},
-std::array<float,2>{0.361844122f, 0.893151462f},
-std::array<float,2>{0.164823011f, 0.0496846437f},
-std::array<float,2>{0.58164227f, 0.977370381f},
-std::array<float,2>{0.97323364f, 0.37647444f},
-std::array<float,2>{0.432413548f, 0.514161229f},
-std::array<float,2>{0.306274772f, 0.311998159f},
-std::array<float,2>{0.798629284f, 0.711904645f},
-std::array<float,2>{0.676976562f, 0.156092271f},
-std::array<float,2>{0.0539302193f, 0.81402868f},
-std::array<float,2>{0.342980832f, 0.0709505305f},
-std::array<float,2>{0.836596251f, 0.930168688f},
-std::array<float,2>{0.740267038f, 0.448139846f},
-std::array<float,2>{0.105556391f, 0.573411882f},
-std::array<float,2>{0.233587295f, 0.34912014f},
-std::array<float,2>{0.556340992f, 0.633044899f},
-std::array<float,2>{0.875213623f, 0.19286567f},
-std::array<float,2>{0.456344485f, 0.768149436f},
-std::array<float,2>{0.00832512509f, 0.169772699f},
-std::array<float,2>{0.648608863f, 0.863683879f},
-std::array<float,2>{0.780896425f, 0.274014235f},
-std::array<float,2>{0.255230606f, 0.747212052f},
-std::array<float,2>{0.397961408f, 0.436014771f},
-std::array<float,2>{0.942571342f, 0.555883169f},
-std::array<float,2>{0.606229603f, 0.0067980946f},
-std::array<float,2>{0.144013524f, 0.954008818f},
-std::array<float,2>{0.322775275f, 0.158140734f},
-std::array<float,2>{0.821494877f, 0.869572878f},
-std::array<float,2>{0.721516013f, 0.268287122f},
-std::array<float,2>{0.109696768f, 0.737078786f},
-std::array<float,2>{0.246398121f, 0.428011268f},
-std::array<float,2>{0.54587698f, 0.549429059f},
-std::array<float,2>{0.893759549f, 0.00802455936f},
-std::array<float,2>{0.443416327f, 0.964570343f},
-std::array<float,2>{0.0168444812f, 0.0626311004f},
-std::array<float,2>{0.628915787f, 0.929111481f},
-std::array<float,2>{0.760228097f, 0.437992632f},
-std::array<float,2>{0.272167832f, 0.56931901f},
-std::array<float,2>{0.378265977f, 0.352971196f},
-std::array<float,2>{0.968072414f, 0.631714821f},
-std::array<float,2>{0.622811437f, 0.203076303f},
-std::array<float,2>{0.139927462f, 0.779212415f},
-std::array<float,2>{0.481431901f, 0.0582395308f},
-std::array<float,2>{0.92029053f, 0.975723565f},
-std::array<float,2>{0.506353021f, 0.389317602f},
-std::array<float,2>{0.207132727f, 0.502262175f},
-std::array<float,2>{0.0854067877f, 0.297299415f},
-std::array<float,2>{0.709326863f, 0.70808208f},
-std::array<float,2>{0.861730337f, 0.148081765f},
-std::array<float,2>{0.354455739f, 0.821639597f},
-std::array<float,2>{0.172236204f, 0.222986311f},
-std::array<float,2>{0.567155302f, 0.796076477f},
-std::array<float,2>{0.986078918f, 0.330288261f},
-std::array<float,2>{0.415854007f, 0.67461729f},
-std::array<float,2>{0.293768793f, 0.480970919f},
-std::array<float,2>{0.796170294f, 0.610062778f},
-std::array<float,2>{0.671442091f, 0.0998717397f},
-std::array<float,2>{0.0372475609f, 0.90330857f},
-std::array<float,2>{0.435778558f, 0.218059897f},
-std::array<float,2>{0.972371101f, 0.764602423f},
-std::array<float,2>{0.585505962f, 0.374127418f},
-std::array<float,2>{0.170189053f, 0.654580712f},
-std::array<float,2>{0.0483313054f, 0.460015655f},
-std::array<float,2>{0.671922326f, 0.585175991f},
-std::array<float,2>{0.80196923f, 0.085563384f},
-std::array<float,2>{0.308793157f, 0.907124758f},
-std::array<float,2>{0.200415507f, 0.024701409f},
-std::array<float,2>{0.518358886f, 0.945150733f},
-std::array<float,2>{0.924793005f, 0.420269519f},
-std::array<float,2>{0.491573423f, 0.543707311f},
-std::array<float,2>{0.364835769f, 0.250219196f},
-std::array<float,2>{0.846259773f, 0.728548944f},
-std::array<float,2>{0.702222228f, 0.18571879f},
-std::array<float,2>{0.0727607384f, 0.851709783f},
-std::array<float,2>{0.250643939f, 0.117846899f},
-std::array<float,2>{0.777319908f, 0.882244825f},
-std::array<float,2>{0.654377878f, 0.488169938f},
-std::array<float,2>{0.0118381251f, 0.604884982f},
-std::array<float,2>{0.146924227f, 0.312720329f},
-std::array<float,2>{0.602191865f, 0.663641751f},
-std::array<float,2>{0.938112497f, 0.242817834f},
-std::array<float,2>{0.391522259f, 0.803575873f},
-std::array<float,2>{0.105189532f, 0.140590861f},
-std::array<float,2>{0.738076806f, 0.833070397f},
-std::array<float,2>{0.841602802f, 0.283088177f},
-std::array<float,2>{0.339825153f, 0.69928962f},
-std::array<float,2>{0.458728969f, 0.40072301f},
-std::array<float,2>{0.880694389f, 0.529154778f},
-std::array<float,2>{0.560924351f, 0.0368915424f},
-std::array<float,2>{0.228604123f, 0.987160027f},
-std::array<float,2>{0.299504697f, 0.241963267f},
-std::array<float,2>{0.808997333f, 0.806000113f},
-std::array<float,2>{0.683656871f, 0.324960411f},
-std::array<float,2>{0.0582599565f, 0.666420758f},
-std::array<float,2>{0.157696977f, 0.498102784f},
-std::array<float,2>{0.590332091f, 0.600738943f},
-std::array<float,2>{0.977114797f, 0.115773514f},
-std::array<float,2>{0.427657753f, 0.886634171f},
-std::array<float,2>{0.0673359483f, 0.0395358056f},
-std::array<float,2>{0.693208456f, 0.995510817f},
-std::array<float,2>{0.858536422f, 0.394051969f},
-std::array<float,2>{0.36988169f, 0.520727158f},
-std::array<float,2>{0.49738276f, 0.295335203f},
-std::array<float,2>{0.93655169f, 0.691434026f},
-std::array<float,2>{0.528610229f, 0.125406757f},
-std::array<float,2>{0.188329965f, 0.836702228f},
-std::array<float,2>{0.405618429f, 0.0895530656f},
-std::array<float,2>{0.947270811f, 0.917410433f},
-std::array<float,2>{0.597026229f, 0.461683333f},
-std::array<float,2>{0.150501236f, 0.592565596f},
-std::array<float,2>{0.0076269987f, 0.364592284f},
-std::array<float,2>{0.645296454f, 0.644645691f},
-std::array<float,2>{0.767424583f, 0.205259174f},
-std::array<float,2>{0.26271987f, 0.750185192f},
-std::array<float,2>{0.221406296f, 0.179029644f},
-std::array<float,2>{0.554495335f, 0.849437177f},
-std::array<float,2>{0.886876047f, 0.261749864f},
-std::array<float,2>{0.466556966f, 0.720856667f},
-std::array<float,2>{0.328277916f, 0.407682121f},
-std::array<float,2>{0.835915983f, 0.538146913f},
-std::array<float,2>{0.745899439f, 0.0210124534f},
-std::array<float,2>{0.0945597738f, 0.95106858f},
-std::array<float,2>{0.446709812f, 0.148818016f},
-std::array<float,2>{0.901835024f, 0.81651336f},
-std::array<float,2>{0.538639724f, 0.304742396f},
-std::array<float,2>{0.240183562f, 0.718273759f},
-std::array<float,2>{0.120800272f, 0.379228622f},
-std::array<float,2>{0.726595998f, 0.511031508f},
-std::array<float,2>{0.813928306f, 0.0510539897f},
-std::array<float,2>{0.313445479f, 0.981728256f},
-std::array<float,2>{0.129882917f, 0.101608343f},
-std::array<float,2>{0.614177406f, 0.896443367f},
-std::array<float,2>{0.955826044f, 0.475997448f},
-std::array<float,2>{0.383788586f, 0.624357939f},
-std::array<float,2>{0.280745596f, 0.336685121f},
-std::array<float,2>{0.751926661f, 0.680783391f},
-std::array<float,2>{0.638409317f, 0.23338832f},
-std::array<float,2>{0.0299993325f, 0.782475889f},
-std::array<float,2>{0.346811831f, 0.00291502685f},
-std::array<float,2>{0.869469762f, 0.95995599f},
-std::array<float,2>{0.717182636f, 0.43165791f},
-std::array<float,2>{0.0875633582f, 0.559320688f},
-std::array<float,2>{0.212741598f, 0.280955821f},
-std::array<float,2>{0.508754373f, 0.743958771f},
-std::array<float,2>{0.912163019f, 0.164622188f},
-std::array<float,2>{0.470829636f, 0.859405756f},
-std::array<float,2>{0.04609216f, 0.188330263f},
-std::array<float,2>{0.660136878f, 0.770232975f},
-std::array<float,2>{0.7889691f, 0.347290963f},
-std::array<float,2>{0.284295231f, 0.639850676f},
-std::array<float,2>{0.406759441f, 0.449430138f},
-std::array<float,2>{0.99259609f, 0.575835228f},
-std::array<float,2>{0.570735455f, 0.0751861036f},
-std::array<float,2>{0.18238534f, 0.934236705f},
-std::array<float,2>{0.333101243f, 0.220299065f},
-std::array<float,2>{0.829323888f, 0.791096509f},
-std::array<float,2>{0.748882711f, 0.335408747f},
-std::array<float,2>{0.0997079685f, 0.676516473f},
-std::array<float,2>{0.222809166f, 0.476714879f},
-std::array<float,2>{0.549943507f, 0.616379142f},
-std::array<float,2>{0.884647787f, 0.0949955359f},
-std::array<float,2>{0.464402497f, 0.900316179f},
-std::array<float,2>{0.00248471112f, 0.060791973f},
-std::array<float,2>{0.642808259f, 0.971283555f},
-std::array<float,2>{0.772394359f, 0.383038759f},
-std::array<float,2>{0.259876192f, 0.506207824f},
-std::array<float,2>{0.401650488f, 0.301714033f},
-std::array<float,2>{0.949903369f, 0.705453694f},
-std::array<float,2>{0.599680841f, 0.14175792f},
-std::array<float,2>{0.153273657f, 0.826925635f},
-std::array<float,2>{0.496048212f, 0.0688296854f},
-std::array<float,2>{0.93341583f, 0.923217237f},
-std::array<float,2>{0.524232745f, 0.441971272f},
-std::array<float,2>{0.191763923f, 0.564325392f},
-std::array<float,2>{0.0639983788f, 0.355690598f},
-std::array<float,2>{0.689361215f, 0.628306687f},
-std::array<float,2>{0.852214634f, 0.19863449f},
-std::array<float,2>{0.371239483f, 0.776102662f},
-std::array<float,2>{0.161867782f, 0.160967559f},
-std::array<float,2>{0.588878989f, 0.874497533f},
-std::array<float,2>{0.98356694f, 0.271958917f},
-std::array<float,2>{0.423371613f, 0.741763234f},
-std::array<float,2>{0.302891344f, 0.422609478f},
-std::array<float,2>{0.804717124f, 0.552154005f},
-std::array<float,2>{0.681986511f, 0.013147207f},
-std::array<float,2>{0.0608272888f, 0.967774987f},
-std::array<float,2>{0.410281777f, 0.134782389f},
-std::array<float,2>{0.996259928f, 0.828353405f},
-std::array<float,2>{0.575619042f, 0.286933452f},
-std::array<float,2>{0.183705181f, 0.698366821f},
-std::array<float,2>{0.041830916f, 0.402456909f},
-std::array<float,2>{0.661496103f, 0.527260184f},
-std::array<float,2>{0.78507185f, 0.0344824828f},
-std::array<float,2>{0.286764055f, 0.989659607f},
-std::array<float,2>{0.218697876f, 0.121620268f},
-std::array<float,2>{0.513045847f, 0.876401961f},
-std::array<float,2>{0.9078601f, 0.489494205f},
-std::array<float,2>{0.472736776f, 0.608305454f},
-std::array<float,2>{0.348794401f, 0.317203373f},
-std::array<float,2>{0.874292433f, 0.658991933f},
-std::array<float,2>{0.714393497f, 0.249970406f},
-std::array<float,2>{0.0906682685f, 0.800133884f},
-std::array<float,2>{0.276651472f, 0.0309612323f},
-std::array<float,2>{0.757293165f, 0.938464522f},
-std::array<float,2>{0.634002864f, 0.416991234f},
-std::array<float,2>{0.0244472288f, 0.541177213f},
-std::array<float,2>{0.125631288f, 0.255993187f},
-std::array<float,2>{0.609889627f, 0.732418835f},
-std::array<float,2>{0.96042186f, 0.179859072f},
-std::array<float,2>{0.389813155f, 0.858492911f},
-std::array<float,2>{0.121504851f, 0.21203132f},
-std::array<float,2>{0.731625557f, 0.761090159f},
-std::array<float,2>{0.819110155f, 0.368960738f},
-std::array<float,2>{0.317886412f, 0.648742259f},
-std::array<float,2>{0.45061481f, 0.455829054f},
-std::array<float,2>{0.903449893f, 0.57993114f},
-std::array<float,2>{0.533825755f, 0.0809140876f},
-std::array<float,2>{0.236052513f, 0.912508428f},
-std::array<float,2>{0.289228886f, 0.174436703f},
-std::array<float,2>{0.790961206f, 0.845970392f},
-std::array<float,2>{0.66487509f, 0.259872198f},
-std::array<float,2>{0.032737799f, 0.723398983f},
-std::array<float,2>{0.177526847f, 0.411699325f},
-std::array<float,2>{0.56433624f, 0.531909943f},
-std::array<float,2>{0.988924444f, 0.0194838047f},
-std::array<float,2>{0.418453187f, 0.947235405f},
-std::array<float,2>{0.0801888928f, 0.0933912024f},
-std::array<float,2>{0.703350723f, 0.921158731f},
-std::array<float,2>{0.864797652f, 0.468534917f},
-std::array<float,2>{0.35589397f, 0.588390946f},
-std::array<float,2>{0.477874488f, 0.360771537f},
-std::array<float,2>{0.916280091f, 0.641435564f},
-std::array<float,2>{0.5030092f, 0.210344866f},
-std::array<float,2>{0.20570448f, 0.754096031f},
-std::array<float,2>{0.381723404f, 0.0459927209f},
-std::array<float,2>{0.963451385f, 0.998484492f},
-std::array<float,2>{0.618679225f, 0.395494223f},
-std::array<float,2>{0.136545122f, 0.518168986f},
-std::array<float,2>{0.0213436652f, 0.289619476f},
-std::array<float,2>{0.628122687f, 0.689502656f},
-std::array<float,2>{0.76476115f, 0.131121054f},
-std::array<float,2>{0.266336501f, 0.840804517f},
-std::array<float,2>{0.246067733f, 0.234621286f},
-std::array<float,2>{0.539816022f, 0.810722351f},
-std::array<float,2>{0.895224392f, 0.321057051f},
-std::array<float,2>{0.439058244f, 0.669150829f},
-std::array<float,2>{0.324292541f, 0.495042264f},
-std::array<float,2>{0.827085495f, 0.596954346f},
-std::array<float,2>{0.724236906f, 0.109623328f},
-std::array<float,2>{0.115276799f, 0.889052331f},
-std::array<float,2>{0.454681784f, 0.194145679f},
-std::array<float,2>{0.878678143f, 0.765982747f},
-std::array<float,2>{0.557890832f, 0.349773109f},
-std::array<float,2>{0.232036114f, 0.634931087f},
-std::array<float,2>{0.10780029f, 0.44554767f},
-std::array<float,2>{0.738791645f, 0.570953846f},
-std::array<float,2>{0.839252949f, 0.0734302178f},
-std::array<float,2>{0.34044075f, 0.932258308f},
-std::array<float,2>{0.141073808f, 0.00463365857f},
-std::array<float,2>{0.608733833f, 0.955230236f},
-std::array<float,2>{0.944347441f, 0.434543163f},
-std::array<float,2>{0.396397561f, 0.557782829f},
-std::array<float,2>{0.255974323f, 0.277121216f},
-std::array<float,2>{0.777594626f, 0.748602152f},
-std::array<float,2>{0.650723279f, 0.17176114f},
-std::array<float,2>{0.0103990072f, 0.867174268f},
-std::array<float,2>{0.359906048f, 0.107532285f},
-std::array<float,2>{0.850931942f, 0.892327785f},
-std::array<float,2>{0.695439875f, 0.468910873f},
-std::array<float,2>{0.074220866f, 0.618817151f},
-std::array<float,2>{0.195912704f, 0.341315985f},
-std::array<float,2>{0.522241473f, 0.687097669f},
-std::array<float,2>{0.925824225f, 0.228511795f},
-std::array<float,2>{0.487196088f, 0.785415411f},
-std::array<float,2>{0.0509012565f, 0.152425468f},
-std::array<float,2>{0.678328216f, 0.8155514f},
-std::array<float,2>{0.799298167f, 0.310413241f},
-std::array<float,2>{0.308261514f, 0.714823842f},
-std::array<float,2>{0.431575716f, 0.378429711f},
-std::array<float,2>{0.974845588f, 0.512466908f},
-std::array<float,2>{0.579506934f, 0.0484266244f},
-std::array<float,2>{0.166740835f, 0.979965687f},
-std::array<float,2>{0.351613045f, 0.145291135f},
-std::array<float,2>{0.860233188f, 0.823339999f},
-std::array<float,2>{0.707047284f, 0.299765915f},
-std::array<float,2>{0.0828006864f, 0.710800767f},
-std::array<float,2>{0.210319012f, 0.387783855f},
-std::array<float,2>{0.504784107f, 0.500950396f},
-std::array<float,2>{0.919148386f, 0.0563043058f},
-std::array<float,2>{0.483566642f, 0.974192441f},
-std::array<float,2>{0.0359460078f, 0.0979871973f},
-std::array<float,2>{0.669481099f, 0.90586853f},
-std::array<float,2>{0.793284833f, 0.482483268f},
-std::array<float,2>{0.294956833f, 0.612916648f},
-std::array<float,2>{0.416092336f, 0.328360289f},
-std::array<float,2>{0.988052845f, 0.673311472f},
-std::array<float,2>{0.568390429f, 0.226120219f},
-std::array<float,2>{0.175136134f, 0.793848097f},
-std::array<float,2>{0.441762775f, 0.0114902388f},
-std::array<float,2>{0.890745997f, 0.962228298f},
-std::array<float,2>{0.544338405f, 0.426020682f},
-std::array<float,2>{0.249617159f, 0.548680544f},
-std::array<float,2>{0.111376286f, 0.266374916f},
-std::array<float,2>{0.720574021f, 0.73453182f},
-std::array<float,2>{0.822954774f, 0.159087405f},
-std::array<float,2>{0.322100461f, 0.868579865f},
-std::array<float,2>{0.137983188f, 0.199703202f},
-std::array<float,2>{0.623425126f, 0.780319273f},
-std::array<float,2>{0.965575337f, 0.353816628f},
-std::array<float,2>{0.376443923f, 0.629383266f},
-std::array<float,2>{0.270135522f, 0.439964622f},
-std::array<float,2>{0.759087682f, 0.568007588f},
-std::array<float,2>{0.632634342f, 0.0647165775f},
-std::array<float,2>{0.0193482544f, 0.926460683f},
-std::array<float,2>{0.392664343f, 0.245775819f},
-std::array<float,2>{0.940931857f, 0.802082777f},
-std::array<float,2>{0.605056345f, 0.314849854f},
-std::array<float,2>{0.145822763f, 0.660667479f},
-std::array<float,2>{0.0141924294f, 0.484649658f},
-std::array<float,2>{0.652457118f, 0.601934016f},
-std::array<float,2>{0.773527026f, 0.119345814f},
-std::array<float,2>{0.253516674f, 0.880023897f},
-std::array<float,2>{0.228361711f, 0.0375957415f},
-std::array<float,2>{0.559136212f, 0.984424591f},
-std::array<float,2>{0.881786525f, 0.398808658f},
-std::array<float,2>{0.459415555f, 0.531200469f},
-std::array<float,2>{0.336790919f, 0.284267932f},
-std::array<float,2>{0.843371212f, 0.702784896f},
-std::array<float,2>{0.735660911f, 0.13761586f},
-std::array<float,2>{0.102593213f, 0.83582443f},
-std::array<float,2>{0.311712742f, 0.0835720226f},
-std::array<float,2>{0.804102838f, 0.909585774f},
-std::array<float,2>{0.674155116f, 0.458060235f},
-std::array<float,2>{0.0494247042f, 0.583761632f},
-std::array<float,2>{0.169291988f, 0.372062683f},
-std::array<float,2>{0.582966864f, 0.653845608f},
-std::array<float,2>{0.970498681f, 0.216666251f},
-std::array<float,2>{0.43533498f, 0.763429463f},
-std::array<float,2>{0.0714793429f, 0.184843212f},
-std::array<float,2>{0.699308693f, 0.853820741f},
-std::array<float,2>{0.843855739f, 0.252503455f},
-std::array<float,2>{0.366536885f, 0.727966845f},
-std::array<float,2>{0.488689989f, 0.418306559f},
-std::array<float,2>{0.92287457f, 0.545771956f},
-std::array<float,2>{0.517046511f, 0.0267577581f},
-std::array<float,2>{0.203122452f, 0.941928804f},
-std::array<float,2>{0.265153378f, 0.204972416f},
-std::array<float,2>{0.768661857f, 0.753053069f},
-std::array<float,2>{0.646681964f, 0.365593195f},
-std::array<float,2>{0.00556894671f, 0.648107171f},
-std::array<float,2>{0.149214879f, 0.463005304f},
-std::array<float,2>{0.594679773f, 0.589875638f},
-std::array<float,2>{0.94596374f, 0.0870096385f},
-std::array<float,2>{0.403796762f, 0.914152861f},
-std::array<float,2>{0.09622664f, 0.022990251f},
-std::array<float,2>{0.743162036f, 0.952772141f},
-std::array<float,2>{0.833679974f, 0.408541292f},
-std::array<float,2>{0.331439227f, 0.535473049f},
-std::array<float,2>{0.468258917f, 0.265566975f},
-std::array<float,2>{0.890154481f, 0.720449805f},
-std::array<float,2>{0.552601337f, 0.176409811f},
-std::array<float,2>{0.220159858f, 0.850289822f},
-std::array<float,2>{0.429480553f, 0.114630125f},
-std::array<float,2>{0.979575396f, 0.88331449f},
-std::array<float,2>{0.592590928f, 0.497379094f},
-std::array<float,2>{0.159965694f, 0.597760797f},
-std::array<float,2>{0.0557036772f, 0.326565236f},
-std::array<float,2>{0.685587704f, 0.66415149f},
-std::array<float,2>{0.811567485f, 0.239559114f},
-std::array<float,2>{0.297881275f, 0.80838424f},
-std::array<float,2>{0.190232307f, 0.128801614f},
-std::array<float,2>{0.53078568f, 0.838671923f},
-std::array<float,2>{0.935361147f, 0.294748694f},
-std::array<float,2>{0.499281496f, 0.693660498f},
-std::array<float,2>{0.36801073f, 0.391151667f},
-std::array<float,2>{0.855476201f, 0.522328734f},
-std::array<float,2>{0.694350064f, 0.0420509204f},
-std::array<float,2>{0.0685477331f, 0.993101656f},
-std::array<float,2>{0.469378889f, 0.16641134f},
-std::array<float,2>{0.910492003f, 0.862990499f},
-std::array<float,2>{0.510006845f, 0.278374165f},
-std::array<float,2>{0.213083044f, 0.74518311f},
-std::array<float,2>{0.0883923694f, 0.430427372f},
-std::array<float,2>{0.715170681f, 0.56220746f},
-std::array<float,2>{0.868296742f, 0.000242838883f},
-std::array<float,2>{0.34518826f, 0.957549512f},
-std::array<float,2>{0.181160018f, 0.0763096437f},
-std::array<float,2>{0.573478997f, 0.936374485f},
-std::array<float,2>{0.995730281f, 0.452780098f},
-std::array<float,2>{0.408894092f, 0.576948345f},
-std::array<float,2>{0.282183081f, 0.344813704f},
-std::array<float,2>{0.787066519f, 0.637535751f},
-std::array<float,2>{0.657868505f, 0.190921694f},
-std::array<float,2>{0.0431583747f, 0.771843314f},
-std::array<float,2>{0.316122681f, 0.0538595133f},
-std::array<float,2>{0.815848827f, 0.984261513f},
-std::array<float,2>{0.72970891f, 0.382481366f},
-std::array<float,2>{0.117716923f, 0.509624362f},
-std::array<float,2>{0.240724847f, 0.308244109f},
-std::array<float,2>{0.536320567f, 0.716088653f},
-std::array<float,2>{0.899959326f, 0.151783705f},
-std::array<float,2>{0.447582036f, 0.819182992f},
-std::array<float,2>{0.0283422153f, 0.231346622f},
-std::array<float,2>{0.638721347f, 0.783544064f},
-std::array<float,2>{0.752459109f, 0.338502198f},
-std::array<float,2>{0.277826339f, 0.682276368f},
-std::array<float,2>{0.385123789f, 0.474200964f},
-std::array<float,2>{0.953243911f, 0.622730374f},
-std::array<float,2>{0.615458727f, 0.104759336f},
-std::array<float,2>{0.132809862f, 0.896720231f},
-std::array<float,2>{0.349929392f, 0.248173743f},
-std::array<float,2>{0.872179449f, 0.798968136f},
-std::array<float,2>{0.711678982f, 0.317812622f},
-std::array<float,2>{0.0926805362f, 0.660045385f},
-std::array<float,2>{0.21595417f, 0.489037335f},
-std::array<float,2>{0.514244795f, 0.608513713f},
-std::array<float,2>{0.909859598f, 0.122720547f},
-std::array<float,2>{0.474669158f, 0.875885069f},
-std::array<float,2>{0.0403263792f, 0.0338192917f},
-std::array<float,2>{0.663571477f, 0.988954246f},
-std::array<float,2>{0.782332778f, 0.403849363f},
-std::array<float,2>{0.287489891f, 0.525448084f},
-std::array<float,2>{0.412672043f, 0.285764813f},
-std::array<float,2>{0.999708235f, 0.697838366f},
-std::array<float,2>{0.576398015f, 0.136251539f},
-std::array<float,2>{0.185561016f, 0.829120159f},
-std::array<float,2>{0.451412827f, 0.0818587244f},
-std::array<float,2>{0.905683517f, 0.913199425f},
-std::array<float,2>{0.531887472f, 0.456479222f},
-std::array<float,2>{0.238017514f, 0.578937113f},
-std::array<float,2>{0.123782843f, 0.367916197f},
-std::array<float,2>{0.733057916f, 0.649701536f},
-std::array<float,2>{0.817016006f, 0.211053073f},
-std::array<float,2>{0.319032878f, 0.760219038f},
-std::array<float,2>{0.127368703f, 0.181001037f},
-std::array<float,2>{0.612838149f, 0.858015776f},
-std::array<float,2>{0.95851326f, 0.257643014f},
-std::array<float,2>{0.388036877f, 0.730905712f},
-std::array<float,2>{0.275297046f, 0.417093009f},
-std::array<float,2>{0.75531733f, 0.542396963f},
-std::array<float,2>{0.63646704f, 0.0295712538f},
-std::array<float,2>{0.0262269117f, 0.939014792f},
-std::array<float,2>{0.399185807f, 0.14110969f},
-std::array<float,2>{0.951460004f, 0.827388048f},
-std::array<float,2>{0.597756028f, 0.302026182f},
-std::array<float,2>{0.156167567f, 0.706133485f},
-std::array<float,2>{0.00194225647f, 0.384674728f},
-std::array<float,2>{0.641971946f, 0.507713556f},
-std::array<float,2>{0.771040082f, 0.0621611737f},
-std::array<float,2>{0.258878201f, 0.972597003f},
-std::array<float,2>{0.225710943f, 0.0940558687f},
-std::array<float,2>{0.548560083f, 0.898706079f},
-std::array<float,2>{0.885902762f, 0.477909505f},
-std::array<float,2>{0.462283462f, 0.615564764f},
-std::array<float,2>{0.334456444f, 0.334392995f},
-std::array<float,2>{0.830994546f, 0.677254975f},
-std::array<float,2>{0.746685565f, 0.218867302f},
-std::array<float,2>{0.0982150435f, 0.792846859f},
-std::array<float,2>{0.301586211f, 0.0118414154f},
-std::array<float,2>{0.806988299f, 0.967741609f},
-std::array<float,2>{0.681141257f, 0.423146814f},
-std::array<float,2>{0.0586614385f, 0.551332116f},
-std::array<float,2>{0.1639494f, 0.272781551f},
-std::array<float,2>{0.58720994f, 0.740537822f},
-std::array<float,2>{0.98194778f, 0.161674395f},
-std::array<float,2>{0.425740004f, 0.873359382f},
-std::array<float,2>{0.0660098642f, 0.197970033f},
-std::array<float,2>{0.690735638f, 0.776986897f},
-std::array<float,2>{0.855153918f, 0.356814921f},
-std::array<float,2>{0.373231351f, 0.627392173f},
-std::array<float,2>{0.492745727f, 0.442635566f},
-std::array<float,2>{0.929836333f, 0.56344521f},
-std::array<float,2>{0.52556473f, 0.0702429265f},
-std::array<float,2>{0.195291147f, 0.922832727f},
-std::array<float,2>{0.254241556f, 0.169955522f},
-std::array<float,2>{0.779912591f, 0.865454435f},
-std::array<float,2>{0.649962723f, 0.275784522f},
-std::array<float,2>{0.00968448073f, 0.749427199f},
-std::array<float,2>{0.143307745f, 0.434597909f},
-std::array<float,2>{0.60717386f, 0.556856871f},
-std::array<float,2>{0.941714466f, 0.00512492517f},
-std::array<float,2>{0.396943778f, 0.956518531f},
-std::array<float,2>{0.10664887f, 0.0728236586f},
-std::array<float,2>{0.741503358f, 0.933120489f},
-std::array<float,2>{0.837263107f, 0.446394235f},
-std::array<float,2>{0.342103779f, 0.572075844f},
-std::array<float,2>{0.455340892f, 0.351307839f},
-std::array<float,2>{0.876058638f, 0.636043012f},
-std::array<float,2>{0.555483222f, 0.194429263f},
-std::array<float,2>{0.232960552f, 0.767562747f},
-std::array<float,2>{0.432694316f, 0.0469729863f},
-std::array<float,2>{0.974428415f, 0.979189396f},
-std::array<float,2>{0.58021456f, 0.377878457f},
-std::array<float,2>{0.165590644f, 0.513264596f},
-std::array<float,2>{0.0532952994f, 0.309343964f},
-std::array<float,2>{0.676556289f, 0.713531733f},
-std::array<float,2>{0.797549367f, 0.153774992f},
-std::array<float,2>{0.305142641f, 0.815196157f},
-std::array<float,2>{0.198597595f, 0.227103934f},
-std::array<float,2>{0.520828724f, 0.786760986f},
-std::array<float,2>{0.928702712f, 0.340658993f},
-std::array<float,2>{0.48518455f, 0.686074972f},
-std::array<float,2>{0.362471849f, 0.469836473f},
-std::array<float,2>{0.848116696f, 0.617520392f},
-std::array<float,2>{0.697580814f, 0.108801708f},
-std::array<float,2>{0.0780492052f, 0.890850186f},
-std::array<float,2>{0.478665769f, 0.209895685f},
-std::array<float,2>{0.915632606f, 0.755305946f},
-std::array<float,2>{0.500415206f, 0.359756321f},
-std::array<float,2>{0.20414798f, 0.642318249f},
-std::array<float,2>{0.0796926767f, 0.467588902f},
-std::array<float,2>{0.706775248f, 0.589195192f},
-std::array<float,2>{0.865847766f, 0.0918765292f},
-std::array<float,2>{0.357422024f, 0.920702159f},
-std::array<float,2>{0.178084627f, 0.0183797237f},
-std::array<float,2>{0.56564343f, 0.945759654f},
-std::array<float,2>{0.991029859f, 0.410401702f},
-std::array<float,2>{0.420454383f, 0.533070028f},
-std::array<float,2>{0.29145059f, 0.261092931f},
-std::array<float,2>{0.791151643f, 0.724186242f},
-std::array<float,2>{0.666891634f, 0.174983665f},
-std::array<float,2>{0.0332862772f, 0.847421527f},
-std::array<float,2>{0.327409029f, 0.111127466f},
-std::array<float,2>{0.825472772f, 0.889900446f},
-std::array<float,2>{0.726434886f, 0.495357931f},
-std::array<float,2>{0.115129963f, 0.596193016f},
-std::array<float,2>{0.2435285f, 0.321651965f},
-std::array<float,2>{0.542822301f, 0.668317378f},
-std::array<float,2>{0.898032963f, 0.236040816f},
-std::array<float,2>{0.440216839f, 0.812331378f},
-std::array<float,2>{0.0221411008f, 0.132359609f},
-std::array<float,2>{0.625852406f, 0.841483712f},
-std::array<float,2>{0.762409449f, 0.290821582f},
-std::array<float,2>{0.269145221f, 0.691177368f},
-std::array<float,2>{0.379606128f, 0.395792961f},
-std::array<float,2>{0.962208033f, 0.518709958f},
-std::array<float,2>{0.620756865f, 0.0454157442f},
-std::array<float,2>{0.133946687f, 0.999634922f},
-std::array<float,2>{0.338105559f, 0.137787223f},
-std::array<float,2>{0.840338647f, 0.834406495f},
-std::array<float,2>{0.736773491f, 0.283893764f},
-std::array<float,2>{0.104134344f, 0.701293409f},
-std::array<float,2>{0.230002269f, 0.399649054f},
-std::array<float,2>{0.56245625f, 0.529991865f},
-std::array<float,2>{0.879878879f, 0.0383823663f},
-std::array<float,2>{0.457667559f, 0.985547483f},
-std::array<float,2>{0.0127249984f, 0.120539539f},
-std::array<float,2>{0.656238675f, 0.879434407f},
-std::array<float,2>{0.776334643f, 0.485456288f},
-std::array<float,2>{0.251676083f, 0.603271008f},
-std::array<float,2>{0.392139852f, 0.316171467f},
-std::array<float,2>{0.938505113f, 0.661153316f},
-std::array<float,2>{0.603089094f, 0.244175702f},
-std::array<float,2>{0.14812237f, 0.801068127f},
-std::array<float,2>{0.49043119f, 0.0262448359f},
-std::array<float,2>{0.925248921f, 0.943104804f},
-std::array<float,2>{0.519421518f, 0.419881433f},
-std::array<float,2>{0.199526981f, 0.546296954f},
-std::array<float,2>{0.0735206082f, 0.253413677f},
-std::array<float,2>{0.701688468f, 0.726746142f},
-std::array<float,2>{0.847298205f, 0.184304044f},
-std::array<float,2>{0.364042401f, 0.85504961f},
-std::array<float,2>{0.171668097f, 0.215080649f},
-std::array<float,2>{0.584692001f, 0.762084424f},
-std::array<float,2>{0.970714927f, 0.372425824f},
-std::array<float,2>{0.43683368f, 0.652889609f},
-std::array<float,2>{0.310373694f, 0.457941741f},
-std::array<float,2>{0.801725745f, 0.58267504f},
-std::array<float,2>{0.673623502f, 0.0828048363f},
-std::array<float,2>{0.04768987f, 0.90893054f},
-std::array<float,2>{0.41492936f, 0.224901617f},
-std::array<float,2>{0.985256374f, 0.794756651f},
-std::array<float,2>{0.567581415f, 0.329908013f},
-std::array<float,2>{0.173179343f, 0.672503948f},
-std::array<float,2>{0.0381978974f, 0.483720779f},
-std::array<float,2>{0.670376658f, 0.612297714f},
-std::array<float,2>{0.795479894f, 0.0991472602f},
-std::array<float,2>{0.294073015f, 0.904631555f},
-std::array<float,2>{0.208644733f, 0.0548908822f},
-std::array<float,2>{0.507801771f, 0.972806454f},
-std::array<float,2>{0.921528339f, 0.387257069f},
-std::array<float,2>{0.481880695f, 0.501934171f},
-std::array<float,2>{0.354556262f, 0.300176024f},
-std::array<float,2>{0.862611711f, 0.709073782f},
-std::array<float,2>{0.710054755f, 0.146003202f},
-std::array<float,2>{0.0847065225f, 0.822588205f},
-std::array<float,2>{0.272461116f, 0.0663037375f},
-std::array<float,2>{0.761175752f, 0.927272201f},
-std::array<float,2>{0.630734503f, 0.441072106f},
-std::array<float,2>{0.0157093424f, 0.566970289f},
-std::array<float,2>{0.13959983f, 0.355374455f},
-std::array<float,2>{0.621444523f, 0.630393267f},
-std::array<float,2>{0.967267036f, 0.200242877f},
-std::array<float,2>{0.376970202f, 0.78023982f},
-std::array<float,2>{0.110873498f, 0.159744129f},
-std::array<float,2>{0.722187698f, 0.867615759f},
-std::array<float,2>{0.821169972f, 0.267272323f},
-std::array<float,2>{0.323720217f, 0.736011624f},
-std::array<float,2>{0.444793373f, 0.427180529f},
-std::array<float,2>{0.892768562f, 0.547560513f},
-std::array<float,2>{0.546191871f, 0.0102354232f},
-std::array<float,2>{0.24746193f, 0.961601317f},
-std::array<float,2>{0.284172833f, 0.189496681f},
-std::array<float,2>{0.787389219f, 0.772541106f},
-std::array<float,2>{0.65871352f, 0.34402898f},
-std::array<float,2>{0.0451344959f, 0.638120949f},
-std::array<float,2>{0.183245897f, 0.452137113f},
-std::array<float,2>{0.571724296f, 0.577505648f},
-std::array<float,2>{0.993397951f, 0.0780660883f},
-std::array<float,2>{0.407708853f, 0.937345386f},
-std::array<float,2>{0.0868238956f, 0.00173812348f},
-std::array<float,2>{0.718360841f, 0.958855629f},
-std::array<float,2>{0.870432794f, 0.430704057f},
-std::array<float,2>{0.346059024f, 0.560643673f},
-std::array<float,2>{0.472343266f, 0.277386129f},
-std::array<float,2>{0.913200498f, 0.7451123f},
-std::array<float,2>{0.509549916f, 0.167723715f},
-std::array<float,2>{0.211103842f, 0.862029195f},
-std::array<float,2>{0.384178162f, 0.104228258f},
-std::array<float,2>{0.957004428f, 0.897729278f},
-std::array<float,2>{0.615111411f, 0.472998381f},
-std::array<float,2>{0.12947385f, 0.621701658f},
-std::array<float,2>{0.0305501241f, 0.339566678f},
-std::array<float,2>{0.636832893f, 0.683172166f},
-std::array<float,2>{0.750377417f, 0.231986642f},
-std::array<float,2>{0.280195236f, 0.784309268f},
-std::array<float,2>{0.239072442f, 0.150600865f},
-std::array<float,2>{0.53791362f, 0.820112169f},
-std::array<float,2>{0.900706112f, 0.307005048f},
-std::array<float,2>{0.445417941f, 0.715035439f},
-std::array<float,2>{0.314435959f, 0.381126642f},
-std::array<float,2>{0.812728524f, 0.508177161f},
-std::array<float,2>{0.728213072f, 0.0534093529f},
-std::array<float,2>{0.119757175f, 0.982771814f},
-std::array<float,2>{0.465740532f, 0.177166849f},
-std::array<float,2>{0.888167441f, 0.851012528f},
-std::array<float,2>{0.553223073f, 0.264353782f},
-std::array<float,2>{0.221993461f, 0.719422162f},
-std::array<float,2>{0.0956968069f, 0.409255415f},
-std::array<float,2>{0.744249403f, 0.536204875f},
-std::array<float,2>{0.833987176f, 0.0224091765f},
-std::array<float,2>{0.329249144f, 0.951713026f},
-std::array<float,2>{0.151844651f, 0.0869025365f},
-std::array<float,2>{0.596243203f, 0.91598624f},
-std::array<float,2>{0.949110448f, 0.464695781f},
-std::array<float,2>{0.405199379f, 0.591786861f},
-std::array<float,2>{0.262033343f, 0.366569549f},
-std::array<float,2>{0.765659511f, 0.646617949f},
-std::array<float,2>{0.645526111f, 0.203475893f},
-std::array<float,2>{0.00664434163f, 0.752883077f},
-std::array<float,2>{0.37107265f, 0.0415410399f},
-std::array<float,2>{0.857529581f, 0.993476331f},
-std::array<float,2>{0.691563904f, 0.391864955f},
-std::array<float,2>{0.0677771792f, 0.52261138f},
-std::array<float,2>{0.189329207f, 0.293670654f},
-std::array<float,2>{0.527566135f, 0.694880843f},
-std::array<float,2>{0.935907066f, 0.127551198f},
-std::array<float,2>{0.496789962f, 0.839810908f},
-std::array<float,2>{0.0569334552f, 0.23874411f},
-std::array<float,2>{0.684576869f, 0.807583153f},
-std::array<float,2>{0.809812963f, 0.327810466f},
-std::array<float,2>{0.300423265f, 0.665782869f},
-std::array<float,2>{0.426648617f, 0.496458828f},
-std::array<float,2>{0.977809966f, 0.59882164f},
-std::array<float,2>{0.591054857f, 0.11351005f},
-std::array<float,2>{0.157031178f, 0.884179652f},
-std::array<float,2>{0.317072421f, 0.213405877f},
-std::array<float,2>{0.820166111f, 0.759246707f},
-std::array<float,2>{0.731231987f, 0.369925201f},
-std::array<float,2>{0.122975685f, 0.650529623f},
-std::array<float,2>{0.235275835f, 0.454390675f},
-std::array<float,2>{0.534421623f, 0.581157148f},
-std::array<float,2>{0.903220713f, 0.0786350965f},
-std::array<float,2>{0.449856699f, 0.911857307f},
-std::array<float,2>{0.0235456303f, 0.0284268297f},
-std::array<float,2>{0.633451879f, 0.939678907f},
-std::array<float,2>{0.756096661f, 0.415700316f},
-std::array<float,2>{0.275559187f, 0.539676905f},
-std::array<float,2>{0.389029056f, 0.255678296f},
-std::array<float,2>{0.959543705f, 0.733908534f},
-std::array<float,2>{0.611180484f, 0.182877347f},
-std::array<float,2>{0.126259938f, 0.857030749f},
-std::array<float,2>{0.473989785f, 0.124837324f},
-std::array<float,2>{0.907095373f, 0.877982497f},
-std::array<float,2>{0.512230575f, 0.491942078f},
-std::array<float,2>{0.217249185f, 0.607150137f},
-std::array<float,2>{0.0908486545f, 0.319813043f},
-std::array<float,2>{0.713767707f, 0.656256914f},
-std::array<float,2>{0.873082757f, 0.246776253f},
-std::array<float,2>{0.348425359f, 0.797617197f},
-std::array<float,2>{0.184772775f, 0.134427533f},
-std::array<float,2>{0.57436049f, 0.831601501f},
-std::array<float,2>{0.997636914f, 0.287190318f},
-std::array<float,2>{0.411718875f, 0.695650756f},
-std::array<float,2>{0.285810262f, 0.405632406f},
-std::array<float,2>{0.783314168f, 0.524335563f},
-std::array<float,2>{0.660629332f, 0.032524135f},
-std::array<float,2>{0.042795904f, 0.991977453f},
-std::array<float,2>{0.422171444f, 0.162823334f},
-std::array<float,2>{0.983312249f, 0.872480571f},
-std::array<float,2>{0.587950349f, 0.271065056f},
-std::array<float,2>{0.160243869f, 0.739472568f},
-std::array<float,2>{0.0618482791f, 0.425597191f},
-std::array<float,2>{0.682853878f, 0.554059029f},
-std::array<float,2>{0.806530595f, 0.0145483399f},
-std::array<float,2>{0.304452658f, 0.966394961f},
-std::array<float,2>{0.19299376f, 0.0664813221f},
-std::array<float,2>{0.525153518f, 0.924083054f},
-std::array<float,2>{0.932497799f, 0.44352901f},
-std::array<float,2>{0.494436443f, 0.566047668f},
-std::array<float,2>{0.372502238f, 0.359301239f},
-std::array<float,2>{0.853110015f, 0.62500757f},
-std::array<float,2>{0.687903225f, 0.196157098f},
-std::array<float,2>{0.0630998015f, 0.773497045f},
-std::array<float,2>{0.261060834f, 0.0596518852f},
-std::array<float,2>{0.772746801f, 0.970640361f},
-std::array<float,2>{0.644433856f, 0.386307299f},
-std::array<float,2>{0.00380653213f, 0.504136443f},
-std::array<float,2>{0.153969675f, 0.304244399f},
-std::array<float,2>{0.600892246f, 0.704980969f},
-std::array<float,2>{0.950887561f, 0.143156707f},
-std::array<float,2>{0.400520355f, 0.825061738f},
-std::array<float,2>{0.100590549f, 0.222511977f},
-std::array<float,2>{0.749359787f, 0.789600015f},
-std::array<float,2>{0.828270614f, 0.333667606f},
-std::array<float,2>{0.332312822f, 0.678121984f},
-std::array<float,2>{0.463460892f, 0.480039358f},
-std::array<float,2>{0.88333112f, 0.613389015f},
-std::array<float,2>{0.549196243f, 0.0973520055f},
-std::array<float,2>{0.223915741f, 0.901721179f},
-std::array<float,2>{0.307219774f, 0.155158132f},
-std::array<float,2>{0.8004179f, 0.812505603f},
-std::array<float,2>{0.678850412f, 0.311185598f},
-std::array<float,2>{0.0522244461f, 0.712296724f},
-std::array<float,2>{0.167913347f, 0.375738144f},
-std::array<float,2>{0.579004347f, 0.515002608f},
-std::array<float,2>{0.97573781f, 0.0504699461f},
-std::array<float,2>{0.429716974f, 0.977620482f},
-std::array<float,2>{0.0761294737f, 0.105719179f},
-std::array<float,2>{0.696834266f, 0.894264877f},
-std::array<float,2>{0.850377977f, 0.470836967f},
-std::array<float,2>{0.360388041f, 0.620593488f},
-std::array<float,2>{0.48758328f, 0.342195332f},
-std::array<float,2>{0.926831901f, 0.684366226f},
-std::array<float,2>{0.523117959f, 0.230252385f},
-std::array<float,2>{0.196509615f, 0.787318051f},
-std::array<float,2>{0.395126611f, 0.00706164772f},
-std::array<float,2>{0.943388104f, 0.954442084f},
-std::array<float,2>{0.608267248f, 0.43727845f},
-std::array<float,2>{0.142053828f, 0.555276453f},
-std::array<float,2>{0.0112562226f, 0.275029898f},
-std::array<float,2>{0.651474178f, 0.746905029f},
-std::array<float,2>{0.779153049f, 0.168888882f},
-std::array<float,2>{0.256965011f, 0.864920139f},
-std::array<float,2>{0.230581388f, 0.191492617f},
-std::array<float,2>{0.556824446f, 0.768662274f},
-std::array<float,2>{0.87705797f, 0.34778741f},
-std::array<float,2>{0.453600258f, 0.634077609f},
-std::array<float,2>{0.341407597f, 0.448261768f},
-std::array<float,2>{0.838608444f, 0.572393f},
-std::array<float,2>{0.739893019f, 0.0715419576f},
-std::array<float,2>{0.109185338f, 0.931514084f},
-std::array<float,2>{0.438055634f, 0.2370895f},
-std::array<float,2>{0.896396577f, 0.80860132f},
-std::array<float,2>{0.540473402f, 0.323112875f},
-std::array<float,2>{0.244235948f, 0.671075702f},
-std::array<float,2>{0.116329029f, 0.492267907f},
-std::array<float,2>{0.722680986f, 0.594922066f},
-std::array<float,2>{0.827379823f, 0.112489872f},
-std::array<float,2>{0.325311214f, 0.886852801f},
-std::array<float,2>{0.134987593f, 0.044029545f},
-std::array<float,2>{0.61806792f, 0.99655205f},
-std::array<float,2>{0.964411318f, 0.397453874f},
-std::array<float,2>{0.382235467f, 0.516189575f},
-std::array<float,2>{0.267102957f, 0.292347699f},
-std::array<float,2>{0.764520884f, 0.689130425f},
-std::array<float,2>{0.62744379f, 0.129686728f},
-std::array<float,2>{0.0196246151f, 0.843337834f},
-std::array<float,2>{0.356558323f, 0.0903317407f},
-std::array<float,2>{0.863891244f, 0.919018388f},
-std::array<float,2>{0.704383492f, 0.464923799f},
-std::array<float,2>{0.0812322944f, 0.587058127f},
-std::array<float,2>{0.206878945f, 0.363166273f},
-std::array<float,2>{0.502077401f, 0.642621636f},
-std::array<float,2>{0.917895377f, 0.208756894f},
-std::array<float,2>{0.477064848f, 0.756553888f},
-std::array<float,2>{0.0314486362f, 0.172876015f},
-std::array<float,2>{0.665564239f, 0.844384789f},
-std::array<float,2>{0.790001512f, 0.258969784f},
-std::array<float,2>{0.29022041f, 0.726513267f},
-std::array<float,2>{0.41944012f, 0.413647175f},
-std::array<float,2>{0.990214825f, 0.534072101f},
-std::array<float,2>{0.562768638f, 0.016396407f},
-std::array<float,2>{0.176139161f, 0.947698116f},
-std::array<float,2>{0.36580044f, 0.186813995f},
-std::array<float,2>{0.845420659f, 0.853342175f},
-std::array<float,2>{0.700929403f, 0.251172811f},
-std::array<float,2>{0.0704624057f, 0.729839861f},
-std::array<float,2>{0.201516449f, 0.421040744f},
-std::array<float,2>{0.516251564f, 0.54449743f},
-std::array<float,2>{0.922456503f, 0.0234614909f},
-std::array<float,2>{0.489760667f, 0.944218278f},
-std::array<float,2>{0.0501132086f, 0.0845254958f},
-std::array<float,2>{0.675133705f, 0.907972157f},
-std::array<float,2>{0.803314745f, 0.459832549f},
-std::array<float,2>{0.311080396f, 0.584080815f},
-std::array<float,2>{0.434344262f, 0.373381078f},
-std::array<float,2>{0.969506204f, 0.655561984f},
-std::array<float,2>{0.583692849f, 0.216847613f},
-std::array<float,2>{0.168194458f, 0.76530987f},
-std::array<float,2>{0.460076034f, 0.0360148102f},
-std::array<float,2>{0.881993234f, 0.988262832f},
-std::array<float,2>{0.559847176f, 0.401877552f},
-std::array<float,2>{0.227335468f, 0.528119445f},
-std::array<float,2>{0.102465332f, 0.281975448f},
-std::array<float,2>{0.734446287f, 0.700791895f},
-std::array<float,2>{0.842351615f, 0.138803497f},
-std::array<float,2>{0.337736547f, 0.832088292f},
-std::array<float,2>{0.144931167f, 0.243197486f},
-std::array<float,2>{0.60397172f, 0.804304242f},
-std::array<float,2>{0.939596534f, 0.314235806f},
-std::array<float,2>{0.393632293f, 0.662659645f},
-std::array<float,2>{0.252119273f, 0.487074286f},
-std::array<float,2>{0.775190353f, 0.603785157f},
-std::array<float,2>{0.65381372f, 0.11879614f},
-std::array<float,2>{0.0146792009f, 0.88179177f},
-std::array<float,2>{0.375721216f, 0.201345682f},
-std::array<float,2>{0.96666944f, 0.777401328f},
-std::array<float,2>{0.624367058f, 0.352159649f},
-std::array<float,2>{0.136737928f, 0.632570982f},
-std::array<float,2>{0.0184121076f, 0.43872875f},
-std::array<float,2>{0.631521165f, 0.570033431f},
-std::array<float,2>{0.758110702f, 0.063615039f},
-std::array<float,2>{0.270835668f, 0.928644001f},
-std::array<float,2>{0.24888356f, 0.00954410899f},
-std::array<float,2>{0.543182969f, 0.963145971f},
-std::array<float,2>{0.89167583f, 0.429041058f},
-std::array<float,2>{0.443301588f, 0.55040884f},
-std::array<float,2>{0.320634902f, 0.269392669f},
-std::array<float,2>{0.824015915f, 0.737382233f},
-std::array<float,2>{0.719101965f, 0.15711306f},
-std::array<float,2>{0.112769432f, 0.870590568f},
-std::array<float,2>{0.296554059f, 0.100857444f},
-std::array<float,2>{0.794476211f, 0.9034006f},
-std::array<float,2>{0.66856575f, 0.48168093f},
-std::array<float,2>{0.036544811f, 0.610810876f},
-std::array<float,2>{0.173998877f, 0.332020462f},
-std::array<float,2>{0.56975162f, 0.674971759f},
-std::array<float,2>{0.986878157f, 0.224126175f},
-std::array<float,2>{0.417726517f, 0.795733273f},
-std::array<float,2>{0.0838849843f, 0.147179067f},
-std::array<float,2>{0.708429873f, 0.82114011f},
-std::array<float,2>{0.860650659f, 0.298316568f},
-std::array<float,2>{0.352575094f, 0.707099319f},
-std::array<float,2>{0.483316839f, 0.389710307f},
-std::array<float,2>{0.918384254f, 0.503560483f},
-std::array<float,2>{0.505735159f, 0.0568510666f},
-std::array<float,2>{0.209620982f, 0.975409806f},
-std::array<float,2>{0.278587967f, 0.233460441f},
-std::array<float,2>{0.753447235f, 0.78209585f},
-std::array<float,2>{0.639840662f, 0.337058693f},
-std::array<float,2>{0.0275194142f, 0.679916322f},
-std::array<float,2>{0.1312695f, 0.47469902f},
-std::array<float,2>{0.617087245f, 0.623788774f},
-std::array<float,2>{0.954435408f, 0.103080578f},
-std::array<float,2>{0.385785758f, 0.895464063f},
-std::array<float,2>{0.118225746f, 0.0520714521f},
-std::array<float,2>{0.729390204f, 0.981266558f},
-std::array<float,2>{0.815348327f, 0.380572796f},
-std::array<float,2>{0.314843893f, 0.510320365f},
-std::array<float,2>{0.448508948f, 0.305970281f},
-std::array<float,2>{0.899102449f, 0.717503726f},
-std::array<float,2>{0.536077619f, 0.150210276f},
-std::array<float,2>{0.24133718f, 0.818147659f},
-std::array<float,2>{0.409932226f, 0.0752215907f},
-std::array<float,2>{0.994153023f, 0.935112178f},
-std::array<float,2>{0.573110759f, 0.450907797f},
-std::array<float,2>{0.180205047f, 0.574846327f},
-std::array<float,2>{0.0445790514f, 0.34613353f},
-std::array<float,2>{0.656710744f, 0.639105022f},
-std::array<float,2>{0.785966635f, 0.188786954f},
-std::array<float,2>{0.282893538f, 0.771418035f},
-std::array<float,2>{0.214018419f, 0.165418893f},
-std::array<float,2>{0.511468232f, 0.861161888f},
-std::array<float,2>{0.911694705f, 0.27982232f},
-std::array<float,2>{0.470577061f, 0.742985129f},
-std::array<float,2>{0.344525158f, 0.432948887f},
-std::array<float,2>{0.867682457f, 0.560057819f},
-std::array<float,2>{0.716633737f, 0.00296870433f},
-std::array<float,2>{0.0897851959f, 0.960683465f},
-std::array<float,2>{0.498657852f, 0.126591533f},
-std::array<float,2>{0.934153557f, 0.837108135f},
-std::array<float,2>{0.529731631f, 0.29647851f},
-std::array<float,2>{0.190615758f, 0.692598164f},
-std::array<float,2>{0.0699225143f, 0.392928481f},
-std::array<float,2>{0.693375945f, 0.520209789f},
-std::array<float,2>{0.856642544f, 0.0401839204f},
-std::array<float,2>{0.368169039f, 0.994547188f},
-std::array<float,2>{0.158368602f, 0.11646878f},
-std::array<float,2>{0.593350232f, 0.885299563f},
-std::array<float,2>{0.978687406f, 0.499079049f},
-std::array<float,2>{0.428099662f, 0.599955797f},
-std::array<float,2>{0.297335923f, 0.325300097f},
-std::array<float,2>{0.811202884f, 0.667573333f},
-std::array<float,2>{0.686901808f, 0.240691841f},
-std::array<float,2>{0.0553335361f, 0.805467725f},
-std::array<float,2>{0.330917209f, 0.0199722182f},
-std::array<float,2>{0.83232832f, 0.949888945f},
-std::array<float,2>{0.743566036f, 0.406663328f},
-std::array<float,2>{0.0967693105f, 0.537890077f},
-std::array<float,2>{0.219013438f, 0.262788206f},
-std::array<float,2>{0.551341236f, 0.721874118f},
-std::array<float,2>{0.889640868f, 0.178233594f},
-std::array<float,2>{0.467533052f, 0.847701013f},
-std::array<float,2>{0.00480065681f, 0.206768468f},
-std::array<float,2>{0.648320973f, 0.7513659f},
-std::array<float,2>{0.767588854f, 0.363625318f},
-std::array<float,2>{0.264104724f, 0.645561397f},
-std::array<float,2>{0.402435094f, 0.462400496f},
-std::array<float,2>{0.947089136f, 0.593390524f},
-std::array<float,2>{0.594849765f, 0.0880582258f},
-std::array<float,2>{0.149636954f, 0.916070521f},
-std::array<float,2>{0.345799148f, 0.187863961f},
-std::array<float,2>{0.870208144f, 0.769661367f},
-std::array<float,2>{0.71850723f, 0.347056657f},
-std::array<float,2>{0.0866492391f, 0.640498877f},
-std::array<float,2>{0.211324409f, 0.44973588f},
-std::array<float,2>{0.50935483f, 0.575537026f},
-std::array<float,2>{0.913572371f, 0.0743726045f},
-std::array<float,2>{0.472436696f, 0.933640599f},
-std::array<float,2>{0.0453771688f, 0.00228625769f},
-std::array<float,2>{0.65909338f, 0.959275782f},
-std::array<float,2>{0.787352502f, 0.432567537f},
-std::array<float,2>{0.283695847f, 0.558743477f},
-std::array<float,2>{0.407357872f, 0.280702442f},
-std::array<float,2>{0.99362433f, 0.743406892f},
-std::array<float,2>{0.571423352f, 0.164394736f},
-std::array<float,2>{0.183388561f, 0.860036552f},
-std::array<float,2>{0.445786506f, 0.102420054f},
-std::array<float,2>{0.900609791f, 0.895796478f},
-std::array<float,2>{0.537709057f, 0.476408005f},
-std::array<float,2>{0.238851652f, 0.624724329f},
-std::array<float,2>{0.120105729f, 0.336363077f},
-std::array<float,2>{0.728421152f, 0.681539834f},
-std::array<float,2>{0.812804043f, 0.232607111f},
-std::array<float,2>{0.314068586f, 0.782731056f},
-std::array<float,2>{0.129695296f, 0.149226204f},
-std::array<float,2>{0.614842892f, 0.817255855f},
-std::array<float,2>{0.956675768f, 0.305582494f},
-std::array<float,2>{0.383817255f, 0.718064189f},
-std::array<float,2>{0.27988866f, 0.379793823f},
-std::array<float,2>{0.75009042f, 0.511655688f},
-std::array<float,2>{0.637044013f, 0.0517284945f},
-std::array<float,2>{0.030485956f, 0.982216239f},
-std::array<float,2>{0.40497306f, 0.179592371f},
-std::array<float,2>{0.948868811f, 0.84863317f},
-std::array<float,2>{0.596666634f, 0.262618303f},
-std::array<float,2>{0.151430562f, 0.721574962f},
-std::array<float,2>{0.00652852701f, 0.408171088f},
-std::array<float,2>{0.645836532f, 0.539030969f},
-std::array<float,2>{0.766053855f, 0.0206640754f},
-std::array<float,2>{0.261820376f, 0.950365126f},
-std::array<float,2>{0.221716061f, 0.0889502689f},
-std::array<float,2>{0.553635716f, 0.917718112f},
-std::array<float,2>{0.887745082f, 0.461177886f},
-std::array<float,2>{0.465390295f, 0.592026412f},
-std::array<float,2>{0.329408854f, 0.365016103f},
-std::array<float,2>{0.834328532f, 0.645249605f},
-std::array<float,2>{0.744557798f, 0.205735877f},
-std::array<float,2>{0.0952829793f, 0.750895858f},
-std::array<float,2>{0.300606996f, 0.0398477167f},
-std::array<float,2>{0.809828579f, 0.995894313f},
-std::array<float,2>{0.68497318f, 0.393642932f},
-std::array<float,2>{0.0568811968f, 0.521178722f},
-std::array<float,2>{0.156854987f, 0.295470446f},
-std::array<float,2>{0.591294944f, 0.691927493f},
-std::array<float,2>{0.977644384f, 0.125949621f},
-std::array<float,2>{0.426455617f, 0.836156905f},
-std::array<float,2>{0.067600213f, 0.241636634f},
-std::array<float,2>{0.691650629f, 0.80662185f},
-std::array<float,2>{0.857679844f, 0.324276358f},
-std::array<float,2>{0.370828837f, 0.666888297f},
-std::array<float,2>{0.496964455f, 0.498746365f},
-std::array<float,2>{0.935547173f, 0.601211727f},
-std::array<float,2>{0.527724087f, 0.115530521f},
-std::array<float,2>{0.189026147f, 0.88622117f},
-std::array<float,2>{0.251833797f, 0.139942244f},
-std::array<float,2>{0.776038229f, 0.833888292f},
-std::array<float,2>{0.6559214f, 0.282577068f},
-std::array<float,2>{0.0131491646f, 0.700162649f},
-std::array<float,2>{0.148412064f, 0.401293844f},
-std::array<float,2>{0.603332639f, 0.528559089f},
-std::array<float,2>{0.93882972f, 0.0365672521f},
-std::array<float,2>{0.392425478f, 0.986596048f},
-std::array<float,2>{0.104441196f, 0.117464438f},
-std::array<float,2>{0.736430049f, 0.882527173f},
-std::array<float,2>{0.840665221f, 0.487741798f},
-std::array<float,2>{0.3381944f, 0.605309188f},
-std::array<float,2>{0.457787126f, 0.313416362f},
-std::array<float,2>{0.879511178f, 0.663097739f},
-std::array<float,2>{0.562225103f, 0.242459655f},
-std::array<float,2>{0.230274633f, 0.802924216f},
-std::array<float,2>{0.436587483f, 0.0253265221f},
-std::array<float,2>{0.971054912f, 0.944489658f},
-std::array<float,2>{0.584938705f, 0.4206523f},
-std::array<float,2>{0.171467617f, 0.543161571f},
-std::array<float,2>{0.0476033986f, 0.250942498f},
-std::array<float,2>{0.673500121f, 0.729237318f},
-std::array<float,2>{0.801398814f, 0.186511129f},
-std::array<float,2>{0.310078233f, 0.852277637f},
-std::array<float,2>{0.19926396f, 0.218720019f},
-std::array<float,2>{0.519071221f, 0.764036834f},
-std::array<float,2>{0.924894512f, 0.374887735f},
-std::array<float,2>{0.490501076f, 0.655164003f},
-std::array<float,2>{0.364002049f, 0.460707933f},
-std::array<float,2>{0.847612143f, 0.585688412f},
-std::array<float,2>{0.701965213f, 0.0850037485f},
-std::array<float,2>{0.0734362155f, 0.906390071f},
-std::array<float,2>{0.481489658f, 0.223402694f},
-std::array<float,2>{0.921872914f, 0.796867847f},
-std::array<float,2>{0.507500112f, 0.330892652f},
-std::array<float,2>{0.208941057f, 0.673955798f},
-std::array<float,2>{0.0848414749f, 0.480536193f},
-std::array<float,2>{0.710215688f, 0.609383941f},
-std::array<float,2>{0.862527013f, 0.100328207f},
-std::array<float,2>{0.354979664f, 0.902547479f},
-std::array<float,2>{0.172914907f, 0.0577677488f},
-std::array<float,2>{0.567696512f, 0.976136148f},
-std::array<float,2>{0.984968126f, 0.388804644f},
-std::array<float,2>{0.414784133f, 0.502629697f},
-std::array<float,2>{0.294402689f, 0.297776252f},
-std::array<float,2>{0.795882702f, 0.708754897f},
-std::array<float,2>{0.669951856f, 0.147508383f},
-std::array<float,2>{0.0383695886f, 0.821855545f},
-std::array<float,2>{0.323350519f, 0.0634616688f},
-std::array<float,2>{0.820985615f, 0.929545701f},
-std::array<float,2>{0.722614586f, 0.43772015f},
-std::array<float,2>{0.111242227f, 0.568696499f},
-std::array<float,2>{0.247266904f, 0.353198439f},
-std::array<float,2>{0.546021998f, 0.630977154f},
-std::array<float,2>{0.892861366f, 0.202263325f},
-std::array<float,2>{0.444453895f, 0.778682768f},
-std::array<float,2>{0.0159812942f, 0.157526806f},
-std::array<float,2>{0.630381167f, 0.869782805f},
-std::array<float,2>{0.760812521f, 0.267588317f},
-std::array<float,2>{0.272853792f, 0.736478329f},
-std::array<float,2>{0.377306223f, 0.428382069f},
-std::array<float,2>{0.966800153f, 0.549094081f},
-std::array<float,2>{0.621195972f, 0.00849063881f},
-std::array<float,2>{0.139391065f, 0.964219809f},
-std::array<float,2>{0.341846198f, 0.169245422f},
-std::array<float,2>{0.83708781f, 0.864219844f},
-std::array<float,2>{0.74137634f, 0.273776859f},
-std::array<float,2>{0.106729485f, 0.747718334f},
-std::array<float,2>{0.233166128f, 0.436430752f},
-std::array<float,2>{0.555359304f, 0.556363404f},
-std::array<float,2>{0.876264691f, 0.00632358529f},
-std::array<float,2>{0.455255061f, 0.95315057f},
-std::array<float,2>{0.00936101936f, 0.0707601681f},
-std::array<float,2>{0.650227845f, 0.930363834f},
-std::array<float,2>{0.780200362f, 0.44736889f},
-std::array<float,2>{0.254116267f, 0.573800862f},
-std::array<float,2>{0.396620631f, 0.349316567f},
-std::array<float,2>{0.941610754f, 0.633552253f},
-std::array<float,2>{0.607332408f, 0.193252638f},
-std::array<float,2>{0.143540636f, 0.76779294f},
-std::array<float,2>{0.484994411f, 0.0491021574f},
-std::array<float,2>{0.92836231f, 0.97687f},
-std::array<float,2>{0.520659924f, 0.375991583f},
-std::array<float,2>{0.198470712f, 0.513770461f},
-std::array<float,2>{0.077677466f, 0.312175959f},
-std::array<float,2>{0.697338343f, 0.711416721f},
-std::array<float,2>{0.847685993f, 0.155654132f},
-std::array<float,2>{0.362773001f, 0.813720703f},
-std::array<float,2>{0.165975362f, 0.229215726f},
-std::array<float,2>{0.580328286f, 0.788865685f},
-std::array<float,2>{0.974173188f, 0.342894912f},
-std::array<float,2>{0.432997853f, 0.68479383f},
-std::array<float,2>{0.304826975f, 0.472586632f},
-std::array<float,2>{0.797700107f, 0.619344354f},
-std::array<float,2>{0.676339269f, 0.106979713f},
-std::array<float,2>{0.05352946f, 0.893029273f},
-std::array<float,2>{0.420764297f, 0.207642436f},
-std::array<float,2>{0.990839541f, 0.757389009f},
-std::array<float,2>{0.56591022f, 0.361356407f},
-std::array<float,2>{0.177978367f, 0.643773794f},
-std::array<float,2>{0.0336244591f, 0.466277748f},
-std::array<float,2>{0.666579485f, 0.586509109f},
-std::array<float,2>{0.791466713f, 0.0912603289f},
-std::array<float,2>{0.291169018f, 0.918708742f},
-std::array<float,2>{0.204543933f, 0.0173470415f},
-std::array<float,2>{0.500218034f, 0.948616683f},
-std::array<float,2>{0.915794075f, 0.412612855f},
-std::array<float,2>{0.478936672f, 0.534986854f},
-std::array<float,2>{0.357696086f, 0.258145541f},
-std::array<float,2>{0.866039872f, 0.72484082f},
-std::array<float,2>{0.706966698f, 0.172297239f},
-std::array<float,2>{0.080048874f, 0.845206976f},
-std::array<float,2>{0.269501805f, 0.111836903f},
-std::array<float,2>{0.762648404f, 0.887959659f},
-std::array<float,2>{0.625656426f, 0.494112462f},
-std::array<float,2>{0.0222995449f, 0.593877375f},
-std::array<float,2>{0.134161338f, 0.323516309f},
-std::array<float,2>{0.620949924f, 0.670403481f},
-std::array<float,2>{0.96196413f, 0.23762387f},
-std::array<float,2>{0.37987107f, 0.81003058f},
-std::array<float,2>{0.114967585f, 0.130587175f},
-std::array<float,2>{0.72623086f, 0.842700839f},
-std::array<float,2>{0.825237632f, 0.291978985f},
-std::array<float,2>{0.32718417f, 0.687948525f},
-std::array<float,2>{0.439956039f, 0.398288131f},
-std::array<float,2>{0.898288608f, 0.517162502f},
-std::array<float,2>{0.542628884f, 0.0434662513f},
-std::array<float,2>{0.243334398f, 0.998007417f},
-std::array<float,2>{0.287112802f, 0.247354999f},
-std::array<float,2>{0.782530963f, 0.798448503f},
-std::array<float,2>{0.663134813f, 0.319126338f},
-std::array<float,2>{0.0401456244f, 0.6581074f},
-std::array<float,2>{0.185798869f, 0.491026193f},
-std::array<float,2>{0.576424181f, 0.605642319f},
-std::array<float,2>{0.999894023f, 0.123795599f},
-std::array<float,2>{0.412965864f, 0.877889514f},
-std::array<float,2>{0.0923020989f, 0.031283211f},
-std::array<float,2>{0.711523771f, 0.990413845f},
-std::array<float,2>{0.872530937f, 0.404474616f},
-std::array<float,2>{0.349717528f, 0.524630606f},
-std::array<float,2>{0.475078166f, 0.288165867f},
-std::array<float,2>{0.910135448f, 0.696981192f},
-std::array<float,2>{0.5145275f, 0.133381218f},
-std::array<float,2>{0.216259524f, 0.830716252f},
-std::array<float,2>{0.387789011f, 0.079668723f},
-std::array<float,2>{0.958780825f, 0.910433948f},
-std::array<float,2>{0.613073587f, 0.453735679f},
-std::array<float,2>{0.127068058f, 0.580700874f},
-std::array<float,2>{0.0259417966f, 0.371039748f},
-std::array<float,2>{0.636481464f, 0.652234614f},
-std::array<float,2>{0.754938185f, 0.214456767f},
-std::array<float,2>{0.274995506f, 0.758180976f},
-std::array<float,2>{0.238183662f, 0.18167676f},
-std::array<float,2>{0.532066703f, 0.856380761f},
-std::array<float,2>{0.905343175f, 0.254483342f},
-std::array<float,2>{0.451545149f, 0.73296392f},
-std::array<float,2>{0.319248319f, 0.414680094f},
-std::array<float,2>{0.817326367f, 0.540123582f},
-std::array<float,2>{0.733264565f, 0.0277061351f},
-std::array<float,2>{0.123670921f, 0.940943718f},
-std::array<float,2>{0.46209836f, 0.144287452f},
-std::array<float,2>{0.88615638f, 0.825732768f},
-std::array<float,2>{0.548811376f, 0.303252608f},
-std::array<float,2>{0.225923598f, 0.704016745f},
-std::array<float,2>{0.0984797329f, 0.385321379f},
-std::array<float,2>{0.747062922f, 0.505612373f},
-std::array<float,2>{0.830703676f, 0.0587508753f},
-std::array<float,2>{0.334054887f, 0.969308317f},
-std::array<float,2>{0.155787706f, 0.0964867398f},
-std::array<float,2>{0.598125577f, 0.901016772f},
-std::array<float,2>{0.951238573f, 0.479083419f},
-std::array<float,2>{0.399060339f, 0.614604592f},
-std::array<float,2>{0.259094089f, 0.332463741f},
-std::array<float,2>{0.771295905f, 0.679055512f},
-std::array<float,2>{0.641663551f, 0.220823973f},
-std::array<float,2>{0.00154182955f, 0.790974796f},
-std::array<float,2>{0.373499244f, 0.0148906102f},
-std::array<float,2>{0.855259895f, 0.965094864f},
-std::array<float,2>{0.690545022f, 0.424726814f},
-std::array<float,2>{0.0663028434f, 0.552920878f},
-std::array<float,2>{0.194968387f, 0.270191401f},
-std::array<float,2>{0.525772214f, 0.738488674f},
-std::array<float,2>{0.930100381f, 0.163492635f},
-std::array<float,2>{0.492978245f, 0.872032762f},
-std::array<float,2>{0.0590640977f, 0.196598902f},
-std::array<float,2>{0.680746377f, 0.774824262f},
-std::array<float,2>{0.806820512f, 0.358264208f},
-std::array<float,2>{0.301294684f, 0.626298487f},
-std::array<float,2>{0.42531395f, 0.44434613f},
-std::array<float,2>{0.982237458f, 0.565227628f},
-std::array<float,2>{0.586992919f, 0.0682588145f},
-std::array<float,2>{0.163702682f, 0.92562139f},
-std::array<float,2>{0.31455496f, 0.230907917f},
-std::array<float,2>{0.815121353f, 0.783727586f},
-std::array<float,2>{0.729076684f, 0.337925822f},
-std::array<float,2>{0.118488476f, 0.68203938f},
-std::array<float,2>{0.241670236f, 0.47410053f},
-std::array<float,2>{0.535666704f, 0.622349799f},
-std::array<float,2>{0.8992939f, 0.105021007f},
-std::array<float,2>{0.44835633f, 0.897192836f},
-std::array<float,2>{0.0277198255f, 0.0542578585f},
-std::array<float,2>{0.640001297f, 0.98380363f},
-std::array<float,2>{0.753673494f, 0.382107615f},
-std::array<float,2>{0.278560102f, 0.50913918f},
-std::array<float,2>{0.386141151f, 0.307824254f},
-std::array<float,2>{0.954165339f, 0.716379106f},
-std::array<float,2>{0.616732001f, 0.152011961f},
-std::array<float,2>{0.131040767f, 0.818716586f},
-std::array<float,2>{0.470235109f, 0.0766603574f},
-std::array<float,2>{0.912054777f, 0.935945928f},
-std::array<float,2>{0.511699677f, 0.452492505f},
-std::array<float,2>{0.21417065f, 0.576460361f},
-std::array<float,2>{0.0893607363f, 0.345228285f},
-std::array<float,2>{0.716494441f, 0.636822581f},
-std::array<float,2>{0.868122637f, 0.190541759f},
-std::array<float,2>{0.344336838f, 0.772406638f},
-std::array<float,2>{0.18050009f, 0.166581497f},
-std::array<float,2>{0.572973013f, 0.862370968f},
-std::array<float,2>{0.994389236f, 0.278894573f},
-std::array<float,2>{0.409726143f, 0.745937049f},
-std::array<float,2>{0.283062696f, 0.429980576f},
-std::array<float,2>{0.785708785f, 0.561732292f},
-std::array<float,2>{0.656360924f, 0.000813507999f},
-std::array<float,2>{0.0448352806f, 0.957261622f},
-std::array<float,2>{0.427929163f, 0.128353745f},
-std::array<float,2>{0.978815496f, 0.838300109f},
-std::array<float,2>{0.593638957f, 0.294222683f},
-std::array<float,2>{0.158571467f, 0.693974018f},
-std::array<float,2>{0.0554291978f, 0.391010851f},
-std::array<float,2>{0.68653357f, 0.521604598f},
-std::array<float,2>{0.811400533f, 0.0428212211f},
-std::array<float,2>{0.297077149f, 0.992197037f},
-std::array<float,2>{0.190719083f, 0.115175396f},
-std::array<float,2>{0.52937305f, 0.882824957f},
-std::array<float,2>{0.934512019f, 0.497833639f},
-std::array<float,2>{0.498845071f, 0.598467648f},
-std::array<float,2>{0.368430465f, 0.327101678f},
-std::array<float,2>{0.856888294f, 0.664883852f},
-std::array<float,2>{0.693615794f, 0.23999007f},
-std::array<float,2>{0.0702879503f, 0.807690859f},
-std::array<float,2>{0.263828039f, 0.0227798522f},
-std::array<float,2>{0.767872632f, 0.952385724f},
-std::array<float,2>{0.648049712f, 0.409103394f},
-std::array<float,2>{0.00448051561f, 0.536031187f},
-std::array<float,2>{0.149896473f, 0.264707923f},
-std::array<float,2>{0.595053673f, 0.719733119f},
-std::array<float,2>{0.946981668f, 0.176153868f},
-std::array<float,2>{0.402815133f, 0.849903405f},
-std::array<float,2>{0.0970315412f, 0.204213038f},
-std::array<float,2>{0.743338168f, 0.753841877f},
-std::array<float,2>{0.8321805f, 0.365828812f},
-std::array<float,2>{0.330599457f, 0.647697806f},
-std::array<float,2>{0.467467546f, 0.463546485f},
-std::array<float,2>{0.8891837f, 0.590785265f},
-std::array<float,2>{0.551668167f, 0.0874213427f},
-std::array<float,2>{0.218757987f, 0.915038109f},
-std::array<float,2>{0.311293423f, 0.18547684f},
-std::array<float,2>{0.803479791f, 0.85432601f},
-std::array<float,2>{0.674979508f, 0.252091706f},
-std::array<float,2>{0.0498827137f, 0.72824049f},
-std::array<float,2>{0.168315679f, 0.418654174f},
-std::array<float,2>{0.583771288f, 0.545128584f},
-std::array<float,2>{0.969326198f, 0.0269857775f},
-std::array<float,2>{0.434197783f, 0.941882193f},
-std::array<float,2>{0.0707460716f, 0.0834367201f},
-std::array<float,2>{0.700850487f, 0.910055697f},
-std::array<float,2>{0.845520556f, 0.458657652f},
-std::array<float,2>{0.365983158f, 0.583288372f},
-std::array<float,2>{0.49009347f, 0.371512532f},
-std::array<float,2>{0.922838211f, 0.653661847f},
-std::array<float,2>{0.516359746f, 0.216261163f},
-std::array<float,2>{0.201190323f, 0.762805402f},
-std::array<float,2>{0.393832654f, 0.0379523747f},
-std::array<float,2>{0.939915538f, 0.985213339f},
-std::array<float,2>{0.603694201f, 0.399118334f},
-std::array<float,2>{0.144719824f, 0.530473113f},
-std::array<float,2>{0.0150725627f, 0.284748554f},
-std::array<float,2>{0.654210567f, 0.702467203f},
-std::array<float,2>{0.774942696f, 0.136824161f},
-std::array<float,2>{0.252259701f, 0.83542031f},
-std::array<float,2>{0.227251142f, 0.245537087f},
-std::array<float,2>{0.559666455f, 0.80228442f},
-std::array<float,2>{0.882230401f, 0.315245777f},
-std::array<float,2>{0.460213751f, 0.660578609f},
-std::array<float,2>{0.33745259f, 0.48517558f},
-std::array<float,2>{0.842645228f, 0.602121651f},
-std::array<float,2>{0.734673679f, 0.1199793f},
-std::array<float,2>{0.102070317f, 0.880836904f},
-std::array<float,2>{0.442912251f, 0.200149298f},
-std::array<float,2>{0.89189887f, 0.781223893f},
-std::array<float,2>{0.54345125f, 0.35415718f},
-std::array<float,2>{0.248583302f, 0.629848897f},
-std::array<float,2>{0.112351097f, 0.439474612f},
-std::array<float,2>{0.718762636f, 0.5677495f},
-std::array<float,2>{0.823870182f, 0.0652159676f},
-std::array<float,2>{0.320324689f, 0.925897777f},
-std::array<float,2>{0.137141302f, 0.0112225451f},
-std::array<float,2>{0.624025047f, 0.96255517f},
-std::array<float,2>{0.966386914f, 0.426462322f},
-std::array<float,2>{0.375773758f, 0.547904968f},
-std::array<float,2>{0.270569086f, 0.265931606f},
-std::array<float,2>{0.757885098f, 0.735076129f},
-std::array<float,2>{0.631750345f, 0.158421218f},
-std::array<float,2>{0.0182298683f, 0.868728042f},
-std::array<float,2>{0.352959275f, 0.0984131172f},
-std::array<float,2>{0.86041081f, 0.905485749f},
-std::array<float,2>{0.708105981f, 0.483197063f},
-std::array<float,2>{0.0835652575f, 0.612442017f},
-std::array<float,2>{0.209906757f, 0.328974545f},
-std::array<float,2>{0.505564332f, 0.673706114f},
-std::array<float,2>{0.918009937f, 0.225856811f},
-std::array<float,2>{0.483138889f, 0.792983949f},
-std::array<float,2>{0.0362382494f, 0.144856438f},
-std::array<float,2>{0.668820858f, 0.824160635f},
-std::array<float,2>{0.794891655f, 0.298967153f},
-std::array<float,2>{0.296860784f, 0.709961474f},
-std::array<float,2>{0.417702824f, 0.38857168f},
-std::array<float,2>{0.98710984f, 0.500266671f},
-std::array<float,2>{0.569386363f, 0.0559891686f},
-std::array<float,2>{0.174245298f, 0.973704994f},
-std::array<float,2>{0.360680282f, 0.152950913f},
-std::array<float,2>{0.850331485f, 0.816330552f},
-std::array<float,2>{0.697047234f, 0.30981952f},
-std::array<float,2>{0.0757101551f, 0.713899076f},
-std::array<float,2>{0.196539223f, 0.378169119f},
-std::array<float,2>{0.523218334f, 0.512072921f},
-std::array<float,2>{0.927203f, 0.048068665f},
-std::array<float,2>{0.487480879f, 0.980000377f},
-std::array<float,2>{0.0518355966f, 0.10791602f},
-std::array<float,2>{0.67911315f, 0.891697526f},
-std::array<float,2>{0.800650477f, 0.469298154f},
-std::array<float,2>{0.307559758f, 0.618527174f},
-std::array<float,2>{0.429957062f, 0.341201156f},
-std::array<float,2>{0.975954771f, 0.686877012f},
-std::array<float,2>{0.578709364f, 0.227691576f},
-std::array<float,2>{0.167671636f, 0.78580755f},
-std::array<float,2>{0.453274846f, 0.00407860568f},
-std::array<float,2>{0.877247572f, 0.955976307f},
-std::array<float,2>{0.556912661f, 0.433676362f},
-std::array<float,2>{0.230767608f, 0.558255553f},
-std::array<float,2>{0.108887941f, 0.276515335f},
-std::array<float,2>{0.740047038f, 0.748185217f},
-std::array<float,2>{0.838742316f, 0.171329796f},
-std::array<float,2>{0.34165144f, 0.866524518f},
-std::array<float,2>{0.141667679f, 0.193390697f},
-std::array<float,2>{0.607949138f, 0.766285121f},
-std::array<float,2>{0.943705499f, 0.350446135f},
-std::array<float,2>{0.395264f, 0.635641098f},
-std::array<float,2>{0.257265478f, 0.445983231f},
-std::array<float,2>{0.778942704f, 0.570659339f},
-std::array<float,2>{0.651688337f, 0.0737480894f},
-std::array<float,2>{0.0116060777f, 0.931800306f},
-std::array<float,2>{0.382057846f, 0.235282555f},
-std::array<float,2>{0.964685559f, 0.811101198f},
-std::array<float,2>{0.617728233f, 0.320414752f},
-std::array<float,2>{0.135194495f, 0.669603348f},
-std::array<float,2>{0.019806141f, 0.494601965f},
-std::array<float,2>{0.627726614f, 0.597207189f},
-std::array<float,2>{0.764331043f, 0.110120282f},
-std::array<float,2>{0.267413259f, 0.889508486f},
-std::array<float,2>{0.244552284f, 0.0466231108f},
-std::array<float,2>{0.540256679f, 0.998714089f},
-std::array<float,2>{0.896131575f, 0.394837171f},
-std::array<float,2>{0.438362628f, 0.517994285f},
-std::array<float,2>{0.32555005f, 0.289339334f},
-std::array<float,2>{0.827415228f, 0.690263808f},
-std::array<float,2>{0.72293514f, 0.131438613f},
-std::array<float,2>{0.116501048f, 0.840232015f},
-std::array<float,2>{0.290460259f, 0.0929786116f},
-std::array<float,2>{0.789650261f, 0.921591878f},
-std::array<float,2>{0.665842295f, 0.468044221f},
-std::array<float,2>{0.0316485167f, 0.588328362f},
-std::array<float,2>{0.176021293f, 0.361105442f},
-std::array<float,2>{0.562500417f, 0.640656292f},
-std::array<float,2>{0.989821434f, 0.210528612f},
-std::array<float,2>{0.419761926f, 0.754636467f},
-std::array<float,2>{0.081342645f, 0.174066082f},
-std::array<float,2>{0.704291165f, 0.84657985f},
-std::array<float,2>{0.864081621f, 0.260425687f},
-std::array<float,2>{0.35689196f, 0.723088324f},
-std::array<float,2>{0.477524459f, 0.411463439f},
-std::array<float,2>{0.917713821f, 0.53170681f},
-std::array<float,2>{0.502375424f, 0.0189207271f},
-std::array<float,2>{0.206688896f, 0.946528852f},
-std::array<float,2>{0.275648326f, 0.212818742f},
-std::array<float,2>{0.756324649f, 0.761590004f},
-std::array<float,2>{0.633779109f, 0.368408084f},
-std::array<float,2>{0.0238050912f, 0.648966491f},
-std::array<float,2>{0.126133695f, 0.455088019f},
-std::array<float,2>{0.610993803f, 0.579337955f},
-std::array<float,2>{0.959882617f, 0.0805371776f},
-std::array<float,2>{0.388883859f, 0.91304636f},
-std::array<float,2>{0.122794941f, 0.0306895897f},
-std::array<float,2>{0.731111825f, 0.937972069f},
-std::array<float,2>{0.819838524f, 0.416171283f},
-std::array<float,2>{0.31717959f, 0.541869342f},
-std::array<float,2>{0.449965119f, 0.256350368f},
-std::array<float,2>{0.902894258f, 0.731889904f},
-std::array<float,2>{0.534509659f, 0.18049787f},
-std::array<float,2>{0.235055357f, 0.85909158f},
-std::array<float,2>{0.411927253f, 0.121271037f},
-std::array<float,2>{0.997876644f, 0.876614928f},
-std::array<float,2>{0.574552f, 0.489985883f},
-std::array<float,2>{0.185006097f, 0.607437968f},
-std::array<float,2>{0.0425107256f, 0.316681027f},
-std::array<float,2>{0.660385311f, 0.658377051f},
-std::array<float,2>{0.783566713f, 0.249058709f},
-std::array<float,2>{0.285962313f, 0.800616503f},
-std::array<float,2>{0.21696195f, 0.135635912f},
-std::array<float,2>{0.512653708f, 0.828856707f},
-std::array<float,2>{0.906901717f, 0.286263913f},
-std::array<float,2>{0.473663032f, 0.698859215f},
-std::array<float,2>{0.348253369f, 0.402934253f},
-std::array<float,2>{0.873456836f, 0.526626229f},
-std::array<float,2>{0.713446498f, 0.0347825475f},
-std::array<float,2>{0.0911545381f, 0.990171731f},
-std::array<float,2>{0.49424389f, 0.160512075f},
-std::array<float,2>{0.932182848f, 0.874855876f},
-std::array<float,2>{0.524927735f, 0.272086203f},
-std::array<float,2>{0.193133712f, 0.741351247f},
-std::array<float,2>{0.0633216202f, 0.422210544f},
-std::array<float,2>{0.687721729f, 0.552679002f},
-std::array<float,2>{0.853434682f, 0.0134823155f},
-std::array<float,2>{0.372205704f, 0.968540967f},
-std::array<float,2>{0.160477698f, 0.0689286441f},
-std::array<float,2>{0.588193595f, 0.923446953f},
-std::array<float,2>{0.983030796f, 0.441641212f},
-std::array<float,2>{0.421892375f, 0.563752413f},
-std::array<float,2>{0.304321885f, 0.356235415f},
-std::array<float,2>{0.806186736f, 0.6288746f},
-std::array<float,2>{0.683021724f, 0.199183345f},
-std::array<float,2>{0.0615694411f, 0.775769472f},
-std::array<float,2>{0.332031637f, 0.0614094473f},
-std::array<float,2>{0.828599095f, 0.970891953f},
-std::array<float,2>{0.749095619f, 0.383587301f},
-std::array<float,2>{0.101063684f, 0.506380141f},
-std::array<float,2>{0.22380656f, 0.301133871f},
-std::array<float,2>{0.54905802f, 0.705888867f},
-std::array<float,2>{0.883632302f, 0.14239119f},
-std::array<float,2>{0.463822007f, 0.826201677f},
-std::array<float,2>{0.00351656345f, 0.21984908f},
-std::array<float,2>{0.644262493f, 0.791849613f},
-std::array<float,2>{0.772673726f, 0.335807979f},
-std::array<float,2>{0.260877341f, 0.676157057f},
-std::array<float,2>{0.400717169f, 0.47737962f},
-std::array<float,2>{0.951018631f, 0.617056251f},
-std::array<float,2>{0.6006338f, 0.0956011042f},
-std::array<float,2>{0.154080212f, 0.899481356f},
-std::array<float,2>{0.369776875f, 0.239138305f},
-std::array<float,2>{0.858695626f, 0.806743801f},
-std::array<float,2>{0.693069756f, 0.327373475f},
-std::array<float,2>{0.0670009702f, 0.665245652f},
-std::array<float,2>{0.188211307f, 0.496635467f},
-std::array<float,2>{0.528435528f, 0.599341273f},
-std::array<float,2>{0.936990321f, 0.114098333f},
-std::array<float,2>{0.497290462f, 0.884391665f},
-std::array<float,2>{0.0585527569f, 0.0413507894f},
-std::array<float,2>{0.683878064f, 0.994044125f},
-std::array<float,2>{0.808828354f, 0.392359287f},
-std::array<float,2>{0.299723893f, 0.523098707f},
-std::array<float,2>{0.427479833f, 0.293093264f},
-std::array<float,2>{0.97745955f, 0.694656551f},
-std::array<float,2>{0.590815783f, 0.127088606f},
-std::array<float,2>{0.157286316f, 0.839354098f},
-std::array<float,2>{0.466465563f, 0.0861570165f},
-std::array<float,2>{0.887203217f, 0.915411174f},
-std::array<float,2>{0.554304659f, 0.464089751f},
-std::array<float,2>{0.221461341f, 0.590961277f},
-std::array<float,2>{0.0944787934f, 0.366708785f},
-std::array<float,2>{0.745696247f, 0.6474213f},
-std::array<float,2>{0.835679471f, 0.203921422f},
-std::array<float,2>{0.328431994f, 0.752357185f},
-std::array<float,2>{0.15073894f, 0.17742601f},
-std::array<float,2>{0.5968768f, 0.851482689f},
-std::array<float,2>{0.947571635f, 0.264025688f},
-std::array<float,2>{0.405378491f, 0.718775272f},
-std::array<float,2>{0.263047844f, 0.410117179f},
-std::array<float,2>{0.767262638f, 0.536711454f},
-std::array<float,2>{0.645230711f, 0.0215163194f},
-std::array<float,2>{0.00737076113f, 0.951387167f},
-std::array<float,2>{0.383457839f, 0.15090853f},
-std::array<float,2>{0.955679655f, 0.819725335f},
-std::array<float,2>{0.613921285f, 0.307470411f},
-std::array<float,2>{0.130148798f, 0.715416908f},
-std::array<float,2>{0.0302077867f, 0.381384134f},
-std::array<float,2>{0.638521969f, 0.508337736f},
-std::array<float,2>{0.75160104f, 0.0529593825f},
-std::array<float,2>{0.280473411f, 0.982965589f},
-std::array<float,2>{0.239907682f, 0.103709795f},
-std::array<float,2>{0.538943768f, 0.898044646f},
-std::array<float,2>{0.901541889f, 0.473153263f},
-std::array<float,2>{0.446408987f, 0.621308804f},
-std::array<float,2>{0.313155055f, 0.339163482f},
-std::array<float,2>{0.813574672f, 0.683071315f},
-std::array<float,2>{0.726948678f, 0.231774911f},
-std::array<float,2>{0.120978385f, 0.78510797f},
-std::array<float,2>{0.284656972f, 0.00133133144f},
-std::array<float,2>{0.788802564f, 0.958032072f},
-std::array<float,2>{0.659740269f, 0.4311589f},
-std::array<float,2>{0.0463019907f, 0.561074436f},
-std::array<float,2>{0.182241917f, 0.27794379f},
-std::array<float,2>{0.570318818f, 0.744352221f},
-std::array<float,2>{0.992258608f, 0.167457461f},
-std::array<float,2>{0.406989574f, 0.861464024f},
-std::array<float,2>{0.0877903253f, 0.190400079f},
-std::array<float,2>{0.717038751f, 0.773416221f},
-std::array<float,2>{0.869239151f, 0.34437716f},
-std::array<float,2>{0.347167939f, 0.63825953f},
-std::array<float,2>{0.471115321f, 0.451306552f},
-std::array<float,2>{0.912566245f, 0.577988505f},
-std::array<float,2>{0.508481264f, 0.0772567689f},
-std::array<float,2>{0.212423503f, 0.936571836f},
-std::array<float,2>{0.272227317f, 0.159457579f},
-std::array<float,2>{0.759994924f, 0.867711604f},
-std::array<float,2>{0.629152834f, 0.266850173f},
-std::array<float,2>{0.0168794934f, 0.735718191f},
-std::array<float,2>{0.13969785f, 0.427636117f},
-std::array<float,2>{0.622668803f, 0.54699868f},
-std::array<float,2>{0.967917264f, 0.0104710553f},
-std::array<float,2>{0.378117532f, 0.961086631f},
-std::array<float,2>{0.109403558f, 0.0657483414f},
-std::array<float,2>{0.721360147f, 0.927006841f},
-std::array<float,2>{0.82154566f, 0.440741628f},
-std::array<float,2>{0.323040515f, 0.566664159f},
-std::array<float,2>{0.443695754f, 0.354861647f},
-std::array<float,2>{0.893822372f, 0.630280316f},
-std::array<float,2>{0.545621991f, 0.200704843f},
-std::array<float,2>{0.246227697f, 0.779782653f},
-std::array<float,2>{0.415588886f, 0.0552169122f},
-std::array<float,2>{0.986280441f, 0.973472834f},
-std::array<float,2>{0.566934168f, 0.387205511f},
-std::array<float,2>{0.171978325f, 0.501398087f},
-std::array<float,2>{0.0375306495f, 0.300686419f},
-std::array<float,2>{0.671639323f, 0.709794641f},
-std::array<float,2>{0.795922577f, 0.145769283f},
-std::array<float,2>{0.293639302f, 0.823094785f},
-std::array<float,2>{0.2073192f, 0.22541599f},
-std::array<float,2>{0.50664407f, 0.794030845f},
-std::array<float,2>{0.920154214f, 0.329375178f},
-std::array<float,2>{0.4810341f, 0.672056675f},
-std::array<float,2>{0.354139656f, 0.484076679f},
-std::array<float,2>{0.861409128f, 0.611726403f},
-std::array<float,2>{0.709153533f, 0.0988252312f},
-std::array<float,2>{0.0850429684f, 0.904846966f},
-std::array<float,2>{0.491449952f, 0.215673551f},
-std::array<float,2>{0.924428701f, 0.7623474f},
-std::array<float,2>{0.518249929f, 0.372651488f},
-std::array<float,2>{0.200538412f, 0.652389944f},
-std::array<float,2>{0.0732392967f, 0.457310617f},
-std::array<float,2>{0.702522039f, 0.582490683f},
-std::array<float,2>{0.846542478f, 0.0822936743f},
-std::array<float,2>{0.365044177f, 0.908254623f},
-std::array<float,2>{0.170102343f, 0.0255918894f},
-std::array<float,2>{0.585857272f, 0.942826211f},
-std::array<float,2>{0.972468257f, 0.419071555f},
-std::array<float,2>{0.435940713f, 0.546424329f},
-std::array<float,2>{0.308992088f, 0.253845334f},
-std::array<float,2>{0.80215764f, 0.727243543f},
-std::array<float,2>{0.672266066f, 0.183884025f},
-std::array<float,2>{0.0480676405f, 0.854970872f},
-std::array<float,2>{0.339484632f, 0.121049695f},
-std::array<float,2>{0.841551125f, 0.879197657f},
-std::array<float,2>{0.737815917f, 0.485930115f},
-std::array<float,2>{0.105283767f, 0.60258925f},
-std::array<float,2>{0.228786096f, 0.31547004f},
-std::array<float,2>{0.560560644f, 0.662108481f},
-std::array<float,2>{0.880522847f, 0.244715169f},
-std::array<float,2>{0.458894879f, 0.801676631f},
-std::array<float,2>{0.0120404307f, 0.138535887f},
-std::array<float,2>{0.654659927f, 0.834609568f},
-std::array<float,2>{0.776885569f, 0.283242315f},
-std::array<float,2>{0.250949085f, 0.701997459f},
-std::array<float,2>{0.391213149f, 0.40005812f},
-std::array<float,2>{0.938382328f, 0.529656172f},
-std::array<float,2>{0.602390885f, 0.0386137515f},
-std::array<float,2>{0.146618918f, 0.986026108f},
-std::array<float,2>{0.326890469f, 0.132286698f},
-std::array<float,2>{0.824701488f, 0.841223419f},
-std::array<float,2>{0.725312948f, 0.290213108f},
-std::array<float,2>{0.114106655f, 0.690666914f},
-std::array<float,2>{0.242547959f, 0.396297365f},
-std::array<float,2>{0.541659117f, 0.519209146f},
-std::array<float,2>{0.897269011f, 0.0453425422f},
-std::array<float,2>{0.441349655f, 0.999159634f},
-std::array<float,2>{0.0225191563f, 0.110628203f},
-std::array<float,2>{0.626766503f, 0.890260041f},
-std::array<float,2>{0.763190269f, 0.495939016f},
-std::array<float,2>{0.268359244f, 0.595718741f},
-std::array<float,2>{0.380153686f, 0.322172672f},
-std::array<float,2>{0.961726546f, 0.668526947f},
-std::array<float,2>{0.619440913f, 0.235404074f},
-std::array<float,2>{0.133303329f, 0.811591804f},
-std::array<float,2>{0.480038404f, 0.0176061634f},
-std::array<float,2>{0.91421181f, 0.946141601f},
-std::array<float,2>{0.501399696f, 0.410903364f},
-std::array<float,2>{0.203656301f, 0.532267988f},
-std::array<float,2>{0.0785494894f, 0.261241645f},
-std::array<float,2>{0.706030667f, 0.7239061f},
-std::array<float,2>{0.866939366f, 0.175720006f},
-std::array<float,2>{0.359339207f, 0.846829593f},
-std::array<float,2>{0.179205358f, 0.209224239f},
-std::array<float,2>{0.565200329f, 0.755437136f},
-std::array<float,2>{0.99160409f, 0.360201985f},
-std::array<float,2>{0.42092675f, 0.64184165f},
-std::array<float,2>{0.292175323f, 0.467193902f},
-std::array<float,2>{0.792954385f, 0.589730442f},
-std::array<float,2>{0.6671561f, 0.092350632f},
-std::array<float,2>{0.0346473902f, 0.920072436f},
-std::array<float,2>{0.432360113f, 0.226625159f},
-std::array<float,2>{0.973450601f, 0.786542952f},
-std::array<float,2>{0.582029045f, 0.340152681f},
-std::array<float,2>{0.16465497f, 0.685718298f},
-std::array<float,2>{0.0539869219f, 0.4705998f},
-std::array<float,2>{0.677062154f, 0.618052423f},
-std::array<float,2>{0.798458636f, 0.109343134f},
-std::array<float,2>{0.306433767f, 0.891395569f},
-std::array<float,2>{0.198182717f, 0.0476941913f},
-std::array<float,2>{0.51980269f, 0.978966594f},
-std::array<float,2>{0.928821087f, 0.377372175f},
-std::array<float,2>{0.485985279f, 0.513082206f},
-std::array<float,2>{0.362287402f, 0.308652341f},
-std::array<float,2>{0.849033058f, 0.713077486f},
-std::array<float,2>{0.698629916f, 0.15397799f},
-std::array<float,2>{0.076601848f, 0.814712405f},
-std::array<float,2>{0.254901677f, 0.0723969713f},
-std::array<float,2>{0.781100214f, 0.932665527f},
-std::array<float,2>{0.648769319f, 0.447144657f},
-std::array<float,2>{0.00873551238f, 0.571622491f},
-std::array<float,2>{0.143639892f, 0.351037145f},
-std::array<float,2>{0.60615325f, 0.636300385f},
-std::array<float,2>{0.942766488f, 0.19509536f},
-std::array<float,2>{0.398416579f, 0.767010212f},
-std::array<float,2>{0.105829716f, 0.170748278f},
-std::array<float,2>{0.740555227f, 0.865821481f},
-std::array<float,2>{0.836779058f, 0.276112944f},
-std::array<float,2>{0.343230397f, 0.749638319f},
-std::array<float,2>{0.456114829f, 0.43544215f},
-std::array<float,2>{0.875409722f, 0.557600558f},
-std::array<float,2>{0.556440651f, 0.00545913121f},
-std::array<float,2>{0.233696043f, 0.956544816f},
-std::array<float,2>{0.302024722f, 0.197644442f},
-std::array<float,2>{0.808580458f, 0.776681244f},
-std::array<float,2>{0.680043161f, 0.35741207f},
-std::array<float,2>{0.05964287f, 0.627809167f},
-std::array<float,2>{0.162757814f, 0.443263203f},
-std::array<float,2>{0.586605608f, 0.562788248f},
-std::array<float,2>{0.980514765f, 0.0696463734f},
-std::array<float,2>{0.424723089f, 0.921880305f},
-std::array<float,2>{0.0648145825f, 0.0123032928f},
-std::array<float,2>{0.689768255f, 0.966825068f},
-std::array<float,2>{0.853894114f, 0.423515528f},
-std::array<float,2>{0.374198228f, 0.551029265f},
-std::array<float,2>{0.493283898f, 0.273138613f},
-std::array<float,2>{0.931564808f, 0.741051495f},
-std::array<float,2>{0.527265906f, 0.161211282f},
-std::array<float,2>{0.194066912f, 0.873882353f},
-std::array<float,2>{0.399820924f, 0.0943252146f},
-std::array<float,2>{0.952630997f, 0.899071217f},
-std::array<float,2>{0.598846436f, 0.478414088f},
-std::array<float,2>{0.154791012f, 0.615997016f},
-std::array<float,2>{0.000304841553f, 0.334856957f},
-std::array<float,2>{0.640865624f, 0.676910698f},
-std::array<float,2>{0.770204008f, 0.21944882f},
-std::array<float,2>{0.258002371f, 0.792284906f},
-std::array<float,2>{0.224952579f, 0.141223043f},
-std::array<float,2>{0.546939015f, 0.827781856f},
-std::array<float,2>{0.885396361f, 0.302454591f},
-std::array<float,2>{0.461352408f, 0.706983328f},
-std::array<float,2>{0.334995806f, 0.384148002f},
-std::array<float,2>{0.831193566f, 0.506880105f},
-std::array<float,2>{0.747077525f, 0.061893709f},
-std::array<float,2>{0.0989956111f, 0.97201544f},
-std::array<float,2>{0.452630103f, 0.181601748f},
-std::array<float,2>{0.905240119f, 0.857533395f},
-std::array<float,2>{0.532604277f, 0.25704053f},
-std::array<float,2>{0.237095386f, 0.731231213f},
-std::array<float,2>{0.124036111f, 0.417874634f},
-std::array<float,2>{0.734089553f, 0.542782187f},
-std::array<float,2>{0.817710876f, 0.0302341431f},
-std::array<float,2>{0.320273876f, 0.938907683f},
-std::array<float,2>{0.128442124f, 0.0812317804f},
-std::array<float,2>{0.61196202f, 0.913813531f},
-std::array<float,2>{0.957994461f, 0.457009405f},
-std::array<float,2>{0.387664735f, 0.578146219f},
-std::array<float,2>{0.274330527f, 0.367402762f},
-std::array<float,2>{0.754777074f, 0.650145531f},
-std::array<float,2>{0.634795904f, 0.211451903f},
-std::array<float,2>{0.0268469285f, 0.760515273f},
-std::array<float,2>{0.350882411f, 0.0334171318f},
-std::array<float,2>{0.871811152f, 0.988397002f},
-std::array<float,2>{0.71265167f, 0.403801769f},
-std::array<float,2>{0.0931196064f, 0.525883138f},
-std::array<float,2>{0.215643719f, 0.285380036f},
-std::array<float,2>{0.514698446f, 0.697440624f},
-std::array<float,2>{0.908290744f, 0.13574931f},
-std::array<float,2>{0.475778162f, 0.829741955f},
-std::array<float,2>{0.0391575396f, 0.248936847f},
-std::array<float,2>{0.662239373f, 0.799349368f},
-std::array<float,2>{0.781793535f, 0.31833604f},
-std::array<float,2>{0.288894802f, 0.659204006f},
-std::array<float,2>{0.413170278f, 0.488491982f},
-std::array<float,2>{0.998682499f, 0.609296203f},
-std::array<float,2>{0.577728689f, 0.122143075f},
-std::array<float,2>{0.18681027f, 0.875465691f},
-std::array<float,2>{0.331083357f, 0.206126079f},
-std::array<float,2>{0.833812356f, 0.751678407f},
-std::array<float,2>{0.742758274f, 0.364013553f},
-std::array<float,2>{0.0964477658f, 0.646399319f},
-std::array<float,2>{0.219875753f, 0.462872803f},
-std::array<float,2>{0.552448034f, 0.593173385f},
-std::array<float,2>{0.890414655f, 0.0883984119f},
-std::array<float,2>{0.468008339f, 0.916936576f},
-std::array<float,2>{0.00573661318f, 0.0204785354f},
-std::array<float,2>{0.646969616f, 0.949586213f},
-std::array<float,2>{0.768856466f, 0.40689683f},
-std::array<float,2>{0.265473664f, 0.537225783f},
-std::array<float,2>{0.40342474f, 0.263505369f},
-std::array<float,2>{0.946273744f, 0.722174644f},
-std::array<float,2>{0.594454885f, 0.178042933f},
-std::array<float,2>{0.148998097f, 0.848343253f},
-std::array<float,2>{0.499081671f, 0.116735555f},
-std::array<float,2>{0.935290992f, 0.88477391f},
-std::array<float,2>{0.53120321f, 0.499658197f},
-std::array<float,2>{0.190001592f, 0.600349009f},
-std::array<float,2>{0.0687409043f, 0.325897336f},
-std::array<float,2>{0.694765091f, 0.667170286f},
-std::array<float,2>{0.855818152f, 0.240828693f},
-std::array<float,2>{0.367771268f, 0.805059314f},
-std::array<float,2>{0.159853652f, 0.126031458f},
-std::array<float,2>{0.592477739f, 0.83757019f},
-std::array<float,2>{0.979763031f, 0.296139181f},
-std::array<float,2>{0.429303616f, 0.693042755f},
-std::array<float,2>{0.298167974f, 0.39312169f},
-std::array<float,2>{0.81193763f, 0.519595087f},
-std::array<float,2>{0.685840905f, 0.0405890867f},
-std::array<float,2>{0.0559240095f, 0.994767547f},
-std::array<float,2>{0.409068763f, 0.166012451f},
-std::array<float,2>{0.996043324f, 0.86041069f},
-std::array<float,2>{0.573708773f, 0.279444605f},
-std::array<float,2>{0.181518704f, 0.742237031f},
-std::array<float,2>{0.0432830974f, 0.433294654f},
-std::array<float,2>{0.658156872f, 0.560384929f},
-std::array<float,2>{0.786760628f, 0.00376816699f},
-std::array<float,2>{0.281799555f, 0.960235476f},
-std::array<float,2>{0.213141024f, 0.076062806f},
-std::array<float,2>{0.510217547f, 0.934959114f},
-std::array<float,2>{0.910314322f, 0.450369f},
-std::array<float,2>{0.469543666f, 0.574638605f},
-std::array<float,2>{0.344822258f, 0.346489042f},
-std::array<float,2>{0.868458748f, 0.639244735f},
-std::array<float,2>{0.714991689f, 0.189430073f},
-std::array<float,2>{0.0887537077f, 0.770877719f},
-std::array<float,2>{0.277356237f, 0.052584663f},
-std::array<float,2>{0.752885163f, 0.980487764f},
-std::array<float,2>{0.639057755f, 0.380325615f},
-std::array<float,2>{0.0287198741f, 0.509886682f},
-std::array<float,2>{0.13234517f, 0.306530863f},
-std::array<float,2>{0.61548543f, 0.716798484f},
-std::array<float,2>{0.953570783f, 0.149479404f},
-std::array<float,2>{0.384871662f, 0.817741215f},
-std::array<float,2>{0.118116856f, 0.233908787f},
-std::array<float,2>{0.729777098f, 0.781693876f},
-std::array<float,2>{0.81562078f, 0.337413281f},
-std::array<float,2>{0.316220671f, 0.680375338f},
-std::array<float,2>{0.447413087f, 0.475552738f},
-std::array<float,2>{0.900155663f, 0.623091996f},
-std::array<float,2>{0.536495149f, 0.102931052f},
-std::array<float,2>{0.240976304f, 0.894809604f},
-std::array<float,2>{0.29528892f, 0.146899f},
-std::array<float,2>{0.793156505f, 0.820486248f},
-std::array<float,2>{0.669859469f, 0.298585743f},
-std::array<float,2>{0.0358428098f, 0.707712054f},
-std::array<float,2>{0.175029606f, 0.390336573f},
-std::array<float,2>{0.568744719f, 0.503054261f},
-std::array<float,2>{0.987934172f, 0.057549987f},
-std::array<float,2>{0.416362643f, 0.974787354f},
-std::array<float,2>{0.0825207159f, 0.101475611f},
-std::array<float,2>{0.707351625f, 0.904204488f},
-std::array<float,2>{0.860052764f, 0.482400149f},
-std::array<float,2>{0.35186547f, 0.61118567f},
-std::array<float,2>{0.483780831f, 0.331431597f},
-std::array<float,2>{0.919301569f, 0.6756621f},
-std::array<float,2>{0.504424512f, 0.224065796f},
-std::array<float,2>{0.210157007f, 0.794956326f},
-std::array<float,2>{0.376192063f, 0.00907839276f},
-std::array<float,2>{0.965737343f, 0.963717997f},
-std::array<float,2>{0.623144388f, 0.429460019f},
-std::array<float,2>{0.137848124f, 0.550138712f},
-std::array<float,2>{0.0192791503f, 0.268871605f},
-std::array<float,2>{0.632432282f, 0.73816818f},
-std::array<float,2>{0.758934259f, 0.156410769f},
-std::array<float,2>{0.270492256f, 0.870975792f},
-std::array<float,2>{0.249936223f, 0.201801717f},
-std::array<float,2>{0.544144094f, 0.77826494f},
-std::array<float,2>{0.891098976f, 0.35184598f},
-std::array<float,2>{0.441528559f, 0.632020235f},
-std::array<float,2>{0.321796238f, 0.43943733f},
-std::array<float,2>{0.823225319f, 0.569540918f},
-std::array<float,2>{0.720346153f, 0.0642759576f},
-std::array<float,2>{0.111683339f, 0.927835405f},
-std::array<float,2>{0.459222406f, 0.244068697f},
-std::array<float,2>{0.881495833f, 0.803936839f},
-std::array<float,2>{0.55940932f, 0.313781559f},
-std::array<float,2>{0.228268281f, 0.662297189f},
-std::array<float,2>{0.102974437f, 0.486799598f},
-std::array<float,2>{0.735362291f, 0.604367793f},
-std::array<float,2>{0.843514204f, 0.118194297f},
-std::array<float,2>{0.336651713f, 0.881305993f},
-std::array<float,2>{0.14563185f, 0.0355982706f},
-std::array<float,2>{0.605439305f, 0.987601995f},
-std::array<float,2>{0.941348612f, 0.401379108f},
-std::array<float,2>{0.392984509f, 0.527560592f},
-std::array<float,2>{0.25387764f, 0.281533897f},
-std::array<float,2>{0.773712039f, 0.700295746f},
-std::array<float,2>{0.652738988f, 0.139634192f},
-std::array<float,2>{0.0145122763f, 0.83287853f},
-std::array<float,2>{0.366259098f, 0.0843680799f},
-std::array<float,2>{0.844166696f, 0.907484651f},
-std::array<float,2>{0.699464262f, 0.459158659f},
-std::array<float,2>{0.0716717169f, 0.58485806f},
-std::array<float,2>{0.202842712f, 0.373636901f},
-std::array<float,2>{0.516703665f, 0.656091571f},
-std::array<float,2>{0.923201025f, 0.217753038f},
-std::array<float,2>{0.488337755f, 0.764921904f},
-std::array<float,2>{0.0495739281f, 0.187240571f},
-std::array<float,2>{0.673893094f, 0.852652252f},
-std::array<float,2>{0.803792715f, 0.251885861f},
-std::array<float,2>{0.311968088f, 0.730031371f},
-std::array<float,2>{0.435171872f, 0.421621561f},
-std::array<float,2>{0.970350027f, 0.544325948f},
-std::array<float,2>{0.582611859f, 0.0239370372f},
-std::array<float,2>{0.16895926f, 0.943475962f},
-std::array<float,2>{0.355514795f, 0.173766762f},
-std::array<float,2>{0.865086973f, 0.843769431f},
-std::array<float,2>{0.703456581f, 0.259287894f},
-std::array<float,2>{0.0805230066f, 0.725957036f},
-std::array<float,2>{0.205918387f, 0.41329962f},
-std::array<float,2>{0.503308535f, 0.533545732f},
-std::array<float,2>{0.91604811f, 0.0159736015f},
-std::array<float,2>{0.477562517f, 0.94810313f},
-std::array<float,2>{0.0331333913f, 0.0907730088f},
-std::array<float,2>{0.664689481f, 0.919660091f},
-std::array<float,2>{0.790592432f, 0.465344012f},
-std::array<float,2>{0.289506465f, 0.587628722f},
-std::array<float,2>{0.418021917f, 0.362663686f},
-std::array<float,2>{0.989022136f, 0.643138409f},
-std::array<float,2>{0.564121366f, 0.208041608f},
-std::array<float,2>{0.177348182f, 0.756122053f},
-std::array<float,2>{0.439242959f, 0.0445524864f},
-std::array<float,2>{0.8954916f, 0.996897757f},
-std::array<float,2>{0.539724231f, 0.396855593f},
-std::array<float,2>{0.245642781f, 0.5158934f},
-std::array<float,2>{0.115511194f, 0.292796344f},
-std::array<float,2>{0.724381566f, 0.688777864f},
-std::array<float,2>{0.826690197f, 0.12897259f},
-std::array<float,2>{0.324654967f, 0.843234181f},
-std::array<float,2>{0.13634941f, 0.236635551f},
-std::array<float,2>{0.618994653f, 0.809316695f},
-std::array<float,2>{0.963708043f, 0.322533131f},
-std::array<float,2>{0.381496936f, 0.671698511f},
-std::array<float,2>{0.266534597f, 0.492836535f},
-std::array<float,2>{0.764923453f, 0.59540838f},
-std::array<float,2>{0.628365815f, 0.112795956f},
-std::array<float,2>{0.0210778918f, 0.887573242f},
-std::array<float,2>{0.396151423f, 0.19216308f},
-std::array<float,2>{0.944802701f, 0.769263387f},
-std::array<float,2>{0.60853833f, 0.348609537f},
-std::array<float,2>{0.140728712f, 0.634396911f},
-std::array<float,2>{0.0106308274f, 0.449145555f},
-std::array<float,2>{0.650499105f, 0.573067367f},
-std::array<float,2>{0.777355731f, 0.072016485f},
-std::array<float,2>{0.256313473f, 0.93094039f},
-std::array<float,2>{0.232312948f, 0.00773692038f},
-std::array<float,2>{0.557641566f, 0.954814017f},
-std::array<float,2>{0.878501594f, 0.436774731f},
-std::array<float,2>{0.455068231f, 0.554836214f},
-std::array<float,2>{0.340658456f, 0.274764597f},
-std::array<float,2>{0.838898242f, 0.746254921f},
-std::array<float,2>{0.739242852f, 0.168076411f},
-std::array<float,2>{0.107515901f, 0.864268005f},
-std::array<float,2>{0.308544308f, 0.105961479f},
-std::array<float,2>{0.79888308f, 0.893851697f},
-std::array<float,2>{0.678521514f, 0.471288949f},
-std::array<float,2>{0.0510615818f, 0.621076167f},
-std::array<float,2>{0.166856259f, 0.342485428f},
-std::array<float,2>{0.579191983f, 0.683989704f},
-std::array<float,2>{0.974984348f, 0.229529202f},
-std::array<float,2>{0.431211531f, 0.78778857f},
-std::array<float,2>{0.0746120438f, 0.154310524f},
-std::array<float,2>{0.695649087f, 0.813341022f},
-std::array<float,2>{0.850712895f, 0.31063804f},
-std::array<float,2>{0.360333204f, 0.712730825f},
-std::array<float,2>{0.487040281f, 0.375019729f},
-std::array<float,2>{0.926194549f, 0.51533556f},
-std::array<float,2>{0.522157192f, 0.0502492897f},
-std::array<float,2>{0.196140513f, 0.978398502f},
-std::array<float,2>{0.260166228f, 0.222073406f},
-std::array<float,2>{0.772091031f, 0.789088249f},
-std::array<float,2>{0.642977893f, 0.333050579f},
-std::array<float,2>{0.00290286518f, 0.67851603f},
-std::array<float,2>{0.153073609f, 0.479883641f},
-std::array<float,2>{0.599955559f, 0.614229262f},
-std::array<float,2>{0.94997555f, 0.0967955589f},
-std::array<float,2>{0.401567727f, 0.901889265f},
-std::array<float,2>{0.0999523476f, 0.060404744f},
-std::array<float,2>{0.748579025f, 0.970183015f},
-std::array<float,2>{0.829553246f, 0.385974765f},
-std::array<float,2>{0.333300143f, 0.504590571f},
-std::array<float,2>{0.464833677f, 0.303922653f},
-std::array<float,2>{0.8844437f, 0.704136729f},
-std::array<float,2>{0.550072253f, 0.142715842f},
-std::array<float,2>{0.222954348f, 0.824244261f},
-std::array<float,2>{0.42376709f, 0.0670761019f},
-std::array<float,2>{0.983722091f, 0.924334824f},
-std::array<float,2>{0.589289129f, 0.443992078f},
-std::array<float,2>{0.161666289f, 0.565841854f},
-std::array<float,2>{0.060598582f, 0.358439863f},
-std::array<float,2>{0.681828856f, 0.625644267f},
-std::array<float,2>{0.805094123f, 0.195553258f},
-std::array<float,2>{0.303209811f, 0.774107158f},
-std::array<float,2>{0.191422373f, 0.162493169f},
-std::array<float,2>{0.524069071f, 0.873032033f},
-std::array<float,2>{0.933154643f, 0.270790815f},
-std::array<float,2>{0.495688915f, 0.740124166f},
-std::array<float,2>{0.371579945f, 0.424909204f},
-std::array<float,2>{0.852330446f, 0.554634094f},
-std::array<float,2>{0.689003468f, 0.0140755f},
-std::array<float,2>{0.0644281134f, 0.966044545f},
-std::array<float,2>{0.472935796f, 0.134226963f},
-std::array<float,2>{0.908043623f, 0.831332922f},
-std::array<float,2>{0.512738645f, 0.287809283f},
-std::array<float,2>{0.218293279f, 0.69614917f},
-std::array<float,2>{0.0904800668f, 0.406235576f},
-std::array<float,2>{0.714777589f, 0.523770809f},
-std::array<float,2>{0.874199986f, 0.0328870267f},
-std::array<float,2>{0.349023253f, 0.991435707f},
-std::array<float,2>{0.183854342f, 0.124394827f},
-std::array<float,2>{0.5754143f, 0.878764987f},
-std::array<float,2>{0.996511638f, 0.491533965f},
-std::array<float,2>{0.41040656f, 0.606914937f},
-std::array<float,2>{0.28698799f, 0.320147038f},
-std::array<float,2>{0.784847796f, 0.657079935f},
-std::array<float,2>{0.661358535f, 0.24611038f},
-std::array<float,2>{0.0416773073f, 0.797184885f},
-std::array<float,2>{0.318129331f, 0.0291548092f},
-std::array<float,2>{0.819032967f, 0.94021672f},
-std::array<float,2>{0.731773615f, 0.415450066f},
-std::array<float,2>{0.121206671f, 0.539544702f},
-std::array<float,2>{0.236152843f, 0.254995525f},
-std::array<float,2>{0.533943415f, 0.733721793f},
-std::array<float,2>{0.903575242f, 0.183176309f},
-std::array<float,2>{0.450346887f, 0.856877983f},
-std::array<float,2>{0.0247523244f, 0.212894619f},
-std::array<float,2>{0.634033263f, 0.759388506f},
-std::array<float,2>{0.756976008f, 0.369277835f},
-std::array<float,2>{0.276412636f, 0.650965571f},
-std::array<float,2>{0.390091151f, 0.455016077f},
-std::array<float,2>{0.959983289f, 0.581766486f},
-std::array<float,2>{0.610223293f, 0.0784849823f},
-std::array<float,2>{0.125803366f, 0.911515117f},
-std::array<float,2>{0.364394575f, 0.217153236f},
-std::array<float,2>{0.84583652f, 0.765432775f},
-std::array<float,2>{0.703094661f, 0.373106152f},
-std::array<float,2>{0.0723382458f, 0.655297697f},
-std::array<float,2>{0.20082438f, 0.459630668f},
-std::array<float,2>{0.517760873f, 0.584447086f},
-std::array<float,2>{0.92383796f, 0.0847747326f},
-std::array<float,2>{0.491701394f, 0.907875538f},
-std::array<float,2>{0.0485425331f, 0.0237458274f},
-std::array<float,2>{0.672586083f, 0.943857253f},
-std::array<float,2>{0.802460194f, 0.421366423f},
-std::array<float,2>{0.309296548f, 0.544779181f},
-std::array<float,2>{0.436102569f, 0.251459539f},
-std::array<float,2>{0.972072661f, 0.729685128f},
-std::array<float,2>{0.585075378f, 0.186638564f},
-std::array<float,2>{0.170433164f, 0.853054464f},
-std::array<float,2>{0.458223462f, 0.118909009f},
-std::array<float,2>{0.880016267f, 0.881421685f},
-std::array<float,2>{0.561385572f, 0.487028897f},
-std::array<float,2>{0.229319036f, 0.603541434f},
-std::array<float,2>{0.104537733f, 0.314047664f},
-std::array<float,2>{0.737760961f, 0.663071156f},
-std::array<float,2>{0.840839565f, 0.243557096f},
-std::array<float,2>{0.338950425f, 0.804489911f},
-std::array<float,2>{0.147171244f, 0.13908425f},
-std::array<float,2>{0.601691961f, 0.832473159f},
-std::array<float,2>{0.937706113f, 0.282080472f},
-std::array<float,2>{0.390865505f, 0.701150298f},
-std::array<float,2>{0.250378966f, 0.402340889f},
-std::array<float,2>{0.776467144f, 0.528041422f},
-std::array<float,2>{0.655213058f, 0.0357485116f},
-std::array<float,2>{0.0123070097f, 0.987796664f},
-std::array<float,2>{0.378888905f, 0.156756192f},
-std::array<float,2>{0.968326807f, 0.870313048f},
-std::array<float,2>{0.622223198f, 0.269045889f},
-std::array<float,2>{0.140263602f, 0.737573564f},
-std::array<float,2>{0.0171833113f, 0.428953111f},
-std::array<float,2>{0.629538178f, 0.550778985f},
-std::array<float,2>{0.760359228f, 0.00939742103f},
-std::array<float,2>{0.27195695f, 0.963064134f},
-std::array<float,2>{0.246724382f, 0.063945882f},
-std::array<float,2>{0.54520452f, 0.928408563f},
-std::array<float,2>{0.894385278f, 0.43848604f},
-std::array<float,2>{0.444129139f, 0.570264041f},
-std::array<float,2>{0.322374582f, 0.352386266f},
-std::array<float,2>{0.822193623f, 0.632550538f},
-std::array<float,2>{0.721037447f, 0.201430872f},
-std::array<float,2>{0.110000543f, 0.777764022f},
-std::array<float,2>{0.293360591f, 0.0570073798f},
-std::array<float,2>{0.796592534f, 0.975121558f},
-std::array<float,2>{0.671306968f, 0.390108824f},
-std::array<float,2>{0.0380340777f, 0.503856361f},
-std::array<float,2>{0.172497645f, 0.298027754f},
-std::array<float,2>{0.566541672f, 0.707483709f},
-std::array<float,2>{0.985364437f, 0.14732255f},
-std::array<float,2>{0.41541025f, 0.820883572f},
-std::array<float,2>{0.0856326073f, 0.224410519f},
-std::array<float,2>{0.709863603f, 0.795493484f},
-std::array<float,2>{0.862137735f, 0.331784725f},
-std::array<float,2>{0.353798598f, 0.675166309f},
-std::array<float,2>{0.48050186f, 0.481734514f},
-std::array<float,2>{0.920849025f, 0.610443771f},
-std::array<float,2>{0.505999625f, 0.100727208f},
-std::array<float,2>{0.20795992f, 0.903687835f},
-std::array<float,2>{0.281220824f, 0.149965465f},
-std::array<float,2>{0.751457036f, 0.817948341f},
-std::array<float,2>{0.637723148f, 0.305883616f},
-std::array<float,2>{0.0294520911f, 0.717577219f},
-std::array<float,2>{0.130724519f, 0.380702049f},
-std::array<float,2>{0.613434792f, 0.510583103f},
-std::array<float,2>{0.955116749f, 0.0517868288f},
-std::array<float,2>{0.382929265f, 0.981047451f},
-std::array<float,2>{0.120222405f, 0.103393011f},
-std::array<float,2>{0.727276802f, 0.895077825f},
-std::array<float,2>{0.814041257f, 0.475016594f},
-std::array<float,2>{0.312943369f, 0.623668194f},
-std::array<float,2>{0.446898878f, 0.337328047f},
-std::array<float,2>{0.901951313f, 0.679953516f},
-std::array<float,2>{0.538528919f, 0.233726785f},
-std::array<float,2>{0.239686072f, 0.781854033f},
-std::array<float,2>{0.406708926f, 0.0032188003f},
-std::array<float,2>{0.992927611f, 0.960717261f},
-std::array<float,2>{0.570859075f, 0.432775527f},
-std::array<float,2>{0.181768239f, 0.559732199f},
-std::array<float,2>{0.0465966873f, 0.280148089f},
-std::array<float,2>{0.659520924f, 0.742731631f},
-std::array<float,2>{0.788250208f, 0.165207326f},
-std::array<float,2>{0.28502509f, 0.8609671f},
-std::array<float,2>{0.21232526f, 0.188541546f},
-std::array<float,2>{0.508071125f, 0.771131933f},
-std::array<float,2>{0.912995636f, 0.345773935f},
-std::array<float,2>{0.471469939f, 0.638853371f},
-std::array<float,2>{0.347392857f, 0.451167166f},
-std::array<float,2>{0.870086014f, 0.575017035f},
-std::array<float,2>{0.717300475f, 0.0754881874f},
-std::array<float,2>{0.0869796574f, 0.93546921f},
-std::array<float,2>{0.49759987f, 0.240328103f},
-std::array<float,2>{0.937049568f, 0.805330217f},
-std::array<float,2>{0.529173791f, 0.325662702f},
-std::array<float,2>{0.187873304f, 0.667850494f},
-std::array<float,2>{0.0667346641f, 0.499405891f},
-std::array<float,2>{0.692536533f, 0.599706173f},
-std::array<float,2>{0.859143019f, 0.116373077f},
-std::array<float,2>{0.369225174f, 0.885718286f},
-std::array<float,2>{0.157850206f, 0.0404342264f},
-std::array<float,2>{0.589884758f, 0.994165242f},
-std::array<float,2>{0.976717234f, 0.392747939f},
-std::array<float,2>{0.427095473f, 0.520453572f},
-std::array<float,2>{0.298923105f, 0.296724051f},
-std::array<float,2>{0.809520066f, 0.692849815f},
-std::array<float,2>{0.684142053f, 0.126847669f},
-std::array<float,2>{0.0580067895f, 0.837332428f},
-std::array<float,2>{0.328787804f, 0.088252537f},
-std::array<float,2>{0.835002601f, 0.916331112f},
-std::array<float,2>{0.745285988f, 0.462028205f},
-std::array<float,2>{0.0941862315f, 0.593565464f},
-std::array<float,2>{0.220892966f, 0.363328576f},
-std::array<float,2>{0.553883255f, 0.645971298f},
-std::array<float,2>{0.887476385f, 0.2068142f},
-std::array<float,2>{0.466269195f, 0.751170754f},
-std::array<float,2>{0.00710763829f, 0.178590864f},
-std::array<float,2>{0.64461422f, 0.848105073f},
-std::array<float,2>{0.767074645f, 0.263103873f},
-std::array<float,2>{0.263357103f, 0.722118437f},
-std::array<float,2>{0.406140774f, 0.406287134f},
-std::array<float,2>{0.948015392f, 0.537729263f},
-std::array<float,2>{0.597555757f, 0.0197547041f},
-std::array<float,2>{0.151022434f, 0.950081944f},
-std::array<float,2>{0.319700122f, 0.182703018f},
-std::array<float,2>{0.818232477f, 0.857233226f},
-std::array<float,2>{0.733541727f, 0.255568862f},
-std::array<float,2>{0.12498527f, 0.734252989f},
-std::array<float,2>{0.236513972f, 0.415871054f},
-std::array<float,2>{0.532745659f, 0.539865613f},
-std::array<float,2>{0.904591858f, 0.0288003702f},
-std::array<float,2>{0.452799708f, 0.939940751f},
-std::array<float,2>{0.027210502f, 0.0790657848f},
-std::array<float,2>{0.635639429f, 0.911889434f},
-std::array<float,2>{0.753993154f, 0.454231948f},
-std::array<float,2>{0.273478806f, 0.581309319f},
-std::array<float,2>{0.387084365f, 0.36965549f},
-std::array<float,2>{0.957516432f, 0.650799513f},
-std::array<float,2>{0.611522257f, 0.213754669f},
-std::array<float,2>{0.127961636f, 0.758993626f},
-std::array<float,2>{0.476554245f, 0.0324191041f},
-std::array<float,2>{0.908963263f, 0.991887629f},
-std::array<float,2>{0.515308797f, 0.405474424f},
-std::array<float,2>{0.215232626f, 0.524120569f},
-std::array<float,2>{0.0935129076f, 0.287475556f},
-std::array<float,2>{0.71194756f, 0.695524454f},
-std::array<float,2>{0.871390402f, 0.134686381f},
-std::array<float,2>{0.351287365f, 0.831859589f},
-std::array<float,2>{0.187278509f, 0.24697566f},
-std::array<float,2>{0.577526391f, 0.797416031f},
-std::array<float,2>{0.998294473f, 0.319374621f},
-std::array<float,2>{0.413605213f, 0.656561136f},
-std::array<float,2>{0.288336813f, 0.4920398f},
-std::array<float,2>{0.781264126f, 0.607288778f},
-std::array<float,2>{0.662607908f, 0.124580763f},
-std::array<float,2>{0.0400008075f, 0.878223777f},
-std::array<float,2>{0.424045026f, 0.196031094f},
-std::array<float,2>{0.981049657f, 0.773701668f},
-std::array<float,2>{0.586358547f, 0.359022826f},
-std::array<float,2>{0.162165761f, 0.625266373f},
-std::array<float,2>{0.0603666566f, 0.44366017f},
-std::array<float,2>{0.680468798f, 0.566207051f},
-std::array<float,2>{0.80797863f, 0.0667094365f},
-std::array<float,2>{0.302402973f, 0.923904061f},
-std::array<float,2>{0.19348222f, 0.0143676307f},
-std::array<float,2>{0.526409626f, 0.96655786f},
-std::array<float,2>{0.931049943f, 0.425468653f},
-std::array<float,2>{0.493750274f, 0.553883851f},
-std::array<float,2>{0.374580145f, 0.271241695f},
-std::array<float,2>{0.854269743f, 0.739560783f},
-std::array<float,2>{0.690139294f, 0.163015679f},
-std::array<float,2>{0.0654229149f, 0.872195184f},
-std::array<float,2>{0.258549571f, 0.0976029932f},
-std::array<float,2>{0.77001673f, 0.901487887f},
-std::array<float,2>{0.641454518f, 0.480356038f},
-std::array<float,2>{0.00073862815f, 0.613636255f},
-std::array<float,2>{0.154728964f, 0.333839923f},
-std::array<float,2>{0.599583983f, 0.677851558f},
-std::array<float,2>{0.953122497f, 0.222383559f},
-std::array<float,2>{0.400143474f, 0.790032446f},
-std::array<float,2>{0.0992381349f, 0.143432841f},
-std::array<float,2>{0.747907043f, 0.824811578f},
-std::array<float,2>{0.831668377f, 0.304601878f},
-std::array<float,2>{0.335747182f, 0.704598486f},
-std::array<float,2>{0.461630732f, 0.386705637f},
-std::array<float,2>{0.884980738f, 0.504236341f},
-std::array<float,2>{0.547493875f, 0.0599372946f},
-std::array<float,2>{0.225461766f, 0.970443189f},
-std::array<float,2>{0.30584386f, 0.230216518f},
-std::array<float,2>{0.798068166f, 0.787408829f},
-std::array<float,2>{0.677302182f, 0.341965497f},
-std::array<float,2>{0.0545000061f, 0.68412745f},
-std::array<float,2>{0.164092273f, 0.471057922f},
-std::array<float,2>{0.58135581f, 0.620242476f},
-std::array<float,2>{0.97287178f, 0.105526865f},
-std::array<float,2>{0.431874752f, 0.894327521f},
-std::array<float,2>{0.0767172426f, 0.0507722832f},
-std::array<float,2>{0.698797047f, 0.977846503f},
-std::array<float,2>{0.849298418f, 0.375683397f},
-std::array<float,2>{0.361410201f, 0.514805436f},
-std::array<float,2>{0.485666275f, 0.311374128f},
-std::array<float,2>{0.92946279f, 0.712091923f},
-std::array<float,2>{0.520445883f, 0.1548599f},
-std::array<float,2>{0.197490141f, 0.81290406f},
-std::array<float,2>{0.397575408f, 0.0714227706f},
-std::array<float,2>{0.943061411f, 0.93116051f},
-std::array<float,2>{0.605513752f, 0.448651254f},
-std::array<float,2>{0.144255444f, 0.572522163f},
-std::array<float,2>{0.00785334595f, 0.348049939f},
-std::array<float,2>{0.649409652f, 0.633836567f},
-std::array<float,2>{0.78072226f, 0.191728413f},
-std::array<float,2>{0.2554335f, 0.768954456f},
-std::array<float,2>{0.234363168f, 0.16854845f},
-std::array<float,2>{0.556016266f, 0.865071535f},
-std::array<float,2>{0.875870347f, 0.275283158f},
-std::array<float,2>{0.456842184f, 0.746692419f},
-std::array<float,2>{0.343473643f, 0.437097579f},
-std::array<float,2>{0.836253047f, 0.55552429f},
-std::array<float,2>{0.740853131f, 0.00723838527f},
-std::array<float,2>{0.106412202f, 0.954249978f},
-std::array<float,2>{0.440878898f, 0.129396617f},
-std::array<float,2>{0.896780729f, 0.843707025f},
-std::array<float,2>{0.541417897f, 0.292023391f},
-std::array<float,2>{0.243073493f, 0.689279139f},
-std::array<float,2>{0.11340709f, 0.397152752f},
-std::array<float,2>{0.725097239f, 0.516464114f},
-std::array<float,2>{0.825143874f, 0.0442219488f},
-std::array<float,2>{0.326428384f, 0.996193886f},
-std::array<float,2>{0.132849306f, 0.11271926f},
-std::array<float,2>{0.619891405f, 0.887014925f},
-std::array<float,2>{0.960946083f, 0.49247393f},
-std::array<float,2>{0.380551368f, 0.595113933f},
-std::array<float,2>{0.267821968f, 0.322970212f},
-std::array<float,2>{0.762952983f, 0.671299279f},
-std::array<float,2>{0.626423895f, 0.236993939f},
-std::array<float,2>{0.0234041028f, 0.808889627f},
-std::array<float,2>{0.358618587f, 0.0161649771f},
-std::array<float,2>{0.866504073f, 0.947367668f},
-std::array<float,2>{0.705209315f, 0.413894206f},
-std::array<float,2>{0.0789403096f, 0.53393507f},
-std::array<float,2>{0.203414351f, 0.25904569f},
-std::array<float,2>{0.501588523f, 0.726128161f},
-std::array<float,2>{0.914835274f, 0.17326507f},
-std::array<float,2>{0.479950607f, 0.844550431f},
-std::array<float,2>{0.034993317f, 0.208569437f},
-std::array<float,2>{0.667886138f, 0.756682634f},
-std::array<float,2>{0.792200446f, 0.362793863f},
-std::array<float,2>{0.292756677f, 0.642853677f},
-std::array<float,2>{0.421763688f, 0.465184867f},
-std::array<float,2>{0.991994977f, 0.58736825f},
-std::array<float,2>{0.564732492f, 0.0900219232f},
-std::array<float,2>{0.179006517f, 0.919380128f},
-std::array<float,2>{0.336080819f, 0.244469851f},
-std::array<float,2>{0.842946887f, 0.800961673f},
-std::array<float,2>{0.736089051f, 0.315927356f},
-std::array<float,2>{0.10334418f, 0.661483526f},
-std::array<float,2>{0.227950692f, 0.485699207f},
-std::array<float,2>{0.558865249f, 0.603429735f},
-std::array<float,2>{0.881043077f, 0.120278589f},
-std::array<float,2>{0.45951429f, 0.879793823f},
-std::array<float,2>{0.0139498077f, 0.0380938724f},
-std::array<float,2>{0.652914345f, 0.985755682f},
-std::array<float,2>{0.774364769f, 0.399811685f},
-std::array<float,2>{0.253014743f, 0.530246794f},
-std::array<float,2>{0.39349255f, 0.284081757f},
-std::array<float,2>{0.940598071f, 0.701504588f},
-std::array<float,2>{0.604629219f, 0.137963742f},
-std::array<float,2>{0.146270558f, 0.83411479f},
-std::array<float,2>{0.488973439f, 0.0825553089f},
-std::array<float,2>{0.923416972f, 0.909105301f},
-std::array<float,2>{0.517463326f, 0.457565695f},
-std::array<float,2>{0.202441886f, 0.582871616f},
-std::array<float,2>{0.0719651207f, 0.372194469f},
-std::array<float,2>{0.700002313f, 0.653198302f},
-std::array<float,2>{0.844285905f, 0.215121984f},
-std::array<float,2>{0.367159545f, 0.761734068f},
-std::array<float,2>{0.169583246f, 0.184557587f},
-std::array<float,2>{0.582515538f, 0.855358243f},
-std::array<float,2>{0.970177591f, 0.253171951f},
-std::array<float,2>{0.434938043f, 0.726885378f},
-std::array<float,2>{0.312162429f, 0.419604748f},
-std::array<float,2>{0.8042292f, 0.545968533f},
-std::array<float,2>{0.674727321f, 0.026049139f},
-std::array<float,2>{0.0490302406f, 0.943282068f},
-std::array<float,2>{0.416807503f, 0.146407351f},
-std::array<float,2>{0.987700641f, 0.82232976f},
-std::array<float,2>{0.569091797f, 0.300030261f},
-std::array<float,2>{0.175540879f, 0.709434092f},
-std::array<float,2>{0.035247989f, 0.387651831f},
-std::array<float,2>{0.669199824f, 0.501529217f},
-std::array<float,2>{0.793936312f, 0.0551261939f},
-std::array<float,2>{0.295796722f, 0.972922325f},
-std::array<float,2>{0.210523024f, 0.09946049f},
-std::array<float,2>{0.503957331f, 0.904466391f},
-std::array<float,2>{0.919643581f, 0.483419567f},
-std::array<float,2>{0.483975261f, 0.61204201f},
-std::array<float,2>{0.352183491f, 0.329764485f},
-std::array<float,2>{0.859764576f, 0.672615826f},
-std::array<float,2>{0.707527161f, 0.224717408f},
-std::array<float,2>{0.0822883174f, 0.79449451f},
-std::array<float,2>{0.269953847f, 0.00977182668f},
-std::array<float,2>{0.759508729f, 0.961875379f},
-std::array<float,2>{0.631996691f, 0.426857531f},
-std::array<float,2>{0.0188008584f, 0.547699153f},
-std::array<float,2>{0.138352975f, 0.267353415f},
-std::array<float,2>{0.623807132f, 0.736287415f},
-std::array<float,2>{0.965330243f, 0.159974813f},
-std::array<float,2>{0.376733124f, 0.867250443f},
-std::array<float,2>{0.112080172f, 0.200596109f},
-std::array<float,2>{0.720173478f, 0.77998811f},
-std::array<float,2>{0.822371185f, 0.355106711f},
-std::array<float,2>{0.321604282f, 0.630718052f},
-std::array<float,2>{0.442245811f, 0.441343039f},
-std::array<float,2>{0.891249359f, 0.567142546f},
-std::array<float,2>{0.544670582f, 0.0659206882f},
-std::array<float,2>{0.249459997f, 0.927670896f},
-std::array<float,2>{0.281534016f, 0.167866737f},
-std::array<float,2>{0.786501467f, 0.862249374f},
-std::array<float,2>{0.657342196f, 0.277690709f},
-std::array<float,2>{0.0438685529f, 0.74478817f},
-std::array<float,2>{0.181044683f, 0.4309569f},
-std::array<float,2>{0.57407403f, 0.560994744f},
-std::array<float,2>{0.995494545f, 0.00156379375f},
-std::array<float,2>{0.408584028f, 0.958546877f},
-std::array<float,2>{0.0882363692f, 0.0777506083f},
-std::array<float,2>{0.715602994f, 0.93710357f},
-std::array<float,2>{0.868723094f, 0.451791912f},
-std::array<float,2>{0.345320642f, 0.577385068f},
-std::array<float,2>{0.468881488f, 0.343868077f},
-std::array<float,2>{0.910955608f, 0.637771308f},
-std::array<float,2>{0.510324121f, 0.189813063f},
-std::array<float,2>{0.213520214f, 0.772788703f},
-std::array<float,2>{0.385643065f, 0.0535962097f},
-std::array<float,2>{0.953799307f, 0.982580245f},
-std::array<float,2>{0.615886986f, 0.381070554f},
-std::array<float,2>{0.132143781f, 0.508019805f},
-std::array<float,2>{0.0288987122f, 0.306650847f},
-std::array<float,2>{0.639272392f, 0.715125024f},
-std::array<float,2>{0.752282917f, 0.150733948f},
-std::array<float,2>{0.278037012f, 0.820023119f},
-std::array<float,2>{0.240461677f, 0.232254967f},
-std::array<float,2>{0.536944509f, 0.784623027f},
-std::array<float,2>{0.899504423f, 0.339626282f},
-std::array<float,2>{0.448240012f, 0.683505595f},
-std::array<float,2>{0.315902472f, 0.472702116f},
-std::array<float,2>{0.816101372f, 0.621917486f},
-std::array<float,2>{0.730133832f, 0.104396269f},
-std::array<float,2>{0.117481396f, 0.897570491f},
-std::array<float,2>{0.468348533f, 0.203199849f},
-std::array<float,2>{0.890043855f, 0.752475977f},
-std::array<float,2>{0.551974893f, 0.366367936f},
-std::array<float,2>{0.220475003f, 0.646853745f},
-std::array<float,2>{0.0958335623f, 0.464446008f},
-std::array<float,2>{0.74262017f, 0.591376483f},
-std::array<float,2>{0.833396316f, 0.0865434781f},
-std::array<float,2>{0.331669509f, 0.915551782f},
-std::array<float,2>{0.148857996f, 0.0221489277f},
-std::array<float,2>{0.593892336f, 0.951996803f},
-std::array<float,2>{0.945350289f, 0.409657568f},
-std::array<float,2>{0.403952718f, 0.536457002f},
-std::array<float,2>{0.264954597f, 0.264489561f},
-std::array<float,2>{0.769485593f, 0.719539165f},
-std::array<float,2>{0.64740485f, 0.176787645f},
-std::array<float,2>{0.0049262559f, 0.850829899f},
-std::array<float,2>{0.367423594f, 0.113590568f},
-std::array<float,2>{0.855988383f, 0.88395071f},
-std::array<float,2>{0.694924176f, 0.496198148f},
-std::array<float,2>{0.0691293031f, 0.599004328f},
-std::array<float,2>{0.189881727f, 0.328104258f},
-std::array<float,2>{0.530583441f, 0.665545464f},
-std::array<float,2>{0.935003459f, 0.238471657f},
-std::array<float,2>{0.499993622f, 0.80723691f},
-std::array<float,2>{0.0563145243f, 0.127916396f},
-std::array<float,2>{0.686052084f, 0.839439809f},
-std::array<float,2>{0.81222856f, 0.293848783f},
-std::array<float,2>{0.298342049f, 0.695139647f},
-std::array<float,2>{0.428756207f, 0.391610265f},
-std::array<float,2>{0.980049908f, 0.522809267f},
-std::array<float,2>{0.591856956f, 0.0418187268f},
-std::array<float,2>{0.159454435f, 0.99336338f},
-std::array<float,2>{0.349251002f, 0.136636704f},
-std::array<float,2>{0.874999464f, 0.829505742f},
-std::array<float,2>{0.713977933f, 0.285916597f},
-std::array<float,2>{0.0902763307f, 0.698141992f},
-std::array<float,2>{0.218173966f, 0.40407294f},
-std::array<float,2>{0.513271213f, 0.525688827f},
-std::array<float,2>{0.907387316f, 0.0341585726f},
-std::array<float,2>{0.473554522f, 0.989118099f},
-std::array<float,2>{0.0410591327f, 0.122839719f},
-std::array<float,2>{0.662097275f, 0.875530183f},
-std::array<float,2>{0.784603894f, 0.488864809f},
-std::array<float,2>{0.286162853f, 0.60873872f},
-std::array<float,2>{0.410715312f, 0.31745857f},
-std::array<float,2>{0.996962309f, 0.659764946f},
-std::array<float,2>{0.576013148f, 0.248374522f},
-std::array<float,2>{0.184346974f, 0.799109399f},
-std::array<float,2>{0.450822741f, 0.0294671971f},
-std::array<float,2>{0.903997421f, 0.939233661f},
-std::array<float,2>{0.533249021f, 0.417256057f},
-std::array<float,2>{0.23560898f, 0.542013526f},
-std::array<float,2>{0.121651888f, 0.257370621f},
-std::array<float,2>{0.732198954f, 0.730565727f},
-std::array<float,2>{0.818441927f, 0.180752933f},
-std::array<float,2>{0.317633122f, 0.858319759f},
-std::array<float,2>{0.125403851f, 0.211375743f},
-std::array<float,2>{0.609442115f, 0.759932935f},
-std::array<float,2>{0.96087122f, 0.367997199f},
-std::array<float,2>{0.390202075f, 0.649423599f},
-std::array<float,2>{0.276858509f, 0.456252158f},
-std::array<float,2>{0.757539511f, 0.5787341f},
-std::array<float,2>{0.634697378f, 0.0817118064f},
-std::array<float,2>{0.0250844043f, 0.913432956f},
-std::array<float,2>{0.401893586f, 0.219058216f},
-std::array<float,2>{0.949397385f, 0.792512655f},
-std::array<float,2>{0.600224555f, 0.334051639f},
-std::array<float,2>{0.152756467f, 0.677608848f},
-std::array<float,2>{0.00197581179f, 0.477703005f},
-std::array<float,2>{0.64342159f, 0.615463614f},
-std::array<float,2>{0.771644592f, 0.0939541161f},
-std::array<float,2>{0.260327309f, 0.898517728f},
-std::array<float,2>{0.223559141f, 0.0623358749f},
-std::array<float,2>{0.550541639f, 0.972230732f},
-std::array<float,2>{0.883998215f, 0.384496093f},
-std::array<float,2>{0.464126468f, 0.507408023f},
-std::array<float,2>{0.333723396f, 0.301950067f},
-std::array<float,2>{0.829738796f, 0.706397891f},
-std::array<float,2>{0.748412788f, 0.140802547f},
-std::array<float,2>{0.100241534f, 0.827492833f},
-std::array<float,2>{0.303281516f, 0.069837071f},
-std::array<float,2>{0.805247426f, 0.922557831f},
-std::array<float,2>{0.682471812f, 0.442594498f},
-std::array<float,2>{0.0611263439f, 0.56314671f},
-std::array<float,2>{0.161414459f, 0.356606603f},
-std::array<float,2>{0.589559197f, 0.627038956f},
-std::array<float,2>{0.984361112f, 0.198076844f},
-std::array<float,2>{0.422917575f, 0.777183592f},
-std::array<float,2>{0.0636299327f, 0.162022069f},
-std::array<float,2>{0.688565969f, 0.873058915f},
-std::array<float,2>{0.852034628f, 0.272516608f},
-std::array<float,2>{0.371792436f, 0.740306199f},
-std::array<float,2>{0.495584548f, 0.422860086f},
-std::array<float,2>{0.932938993f, 0.551683426f},
-std::array<float,2>{0.523774624f, 0.0120952409f},
-std::array<float,2>{0.192209959f, 0.967478037f},
-std::array<float,2>{0.256498158f, 0.194739804f},
-std::array<float,2>{0.778147876f, 0.767162681f},
-std::array<float,2>{0.650973201f, 0.351548344f},
-std::array<float,2>{0.0097830547f, 0.635971189f},
-std::array<float,2>{0.141208485f, 0.446710616f},
-std::array<float,2>{0.609175622f, 0.571849108f},
-std::array<float,2>{0.945295393f, 0.073154971f},
-std::array<float,2>{0.395522952f, 0.93354404f},
-std::array<float,2>{0.108332895f, 0.00517521519f},
-std::array<float,2>{0.738305807f, 0.956173658f},
-std::array<float,2>{0.839657784f, 0.435038149f},
-std::array<float,2>{0.340109974f, 0.556956291f},
-std::array<float,2>{0.454204232f, 0.275463313f},
-std::array<float,2>{0.87793988f, 0.749178052f},
-std::array<float,2>{0.55825299f, 0.170363784f},
-std::array<float,2>{0.231819317f, 0.865640461f},
-std::array<float,2>{0.430754691f, 0.108623341f},
-std::array<float,2>{0.975156367f, 0.8910653f},
-std::array<float,2>{0.579808354f, 0.470202953f},
-std::array<float,2>{0.166153207f, 0.617415786f},
-std::array<float,2>{0.0516054071f, 0.340350568f},
-std::array<float,2>{0.678139389f, 0.686300337f},
-std::array<float,2>{0.799803615f, 0.227401674f},
-std::array<float,2>{0.307985783f, 0.786981046f},
-std::array<float,2>{0.195773974f, 0.153385371f},
-std::array<float,2>{0.521867633f, 0.814965963f},
-std::array<float,2>{0.926392138f, 0.309116423f},
-std::array<float,2>{0.486576438f, 0.71366173f},
-std::array<float,2>{0.359858364f, 0.37748301f},
-std::array<float,2>{0.851535857f, 0.51367116f},
-std::array<float,2>{0.696279645f, 0.0471656024f},
-std::array<float,2>{0.0747677162f, 0.97936666f},
-std::array<float,2>{0.478453398f, 0.175260618f},
-std::array<float,2>{0.916630507f, 0.847176373f},
-std::array<float,2>{0.50360322f, 0.260780424f},
-std::array<float,2>{0.205499589f, 0.724574745f},
-std::array<float,2>{0.0809320435f, 0.410258949f},
-std::array<float,2>{0.703827977f, 0.532724977f},
-std::array<float,2>{0.864341021f, 0.0181957111f},
-std::array<float,2>{0.356332928f, 0.94532609f},
-std::array<float,2>{0.176919371f, 0.0921676233f},
-std::array<float,2>{0.563586175f, 0.920545042f},
-std::array<float,2>{0.988439322f, 0.467428088f},
-std::array<float,2>{0.418671191f, 0.58899492f},
-std::array<float,2>{0.289956957f, 0.359455794f},
-std::array<float,2>{0.790169179f, 0.642339945f},
-std::array<float,2>{0.664406002f, 0.209602147f},
-std::array<float,2>{0.0323959999f, 0.755083144f},
-std::array<float,2>{0.325110614f, 0.0457205847f},
-std::array<float,2>{0.826194882f, 0.999785125f},
-std::array<float,2>{0.723789811f, 0.395689666f},
-std::array<float,2>{0.116075486f, 0.518830121f},
-std::array<float,2>{0.245419309f, 0.290571719f},
-std::array<float,2>{0.539302289f, 0.691090286f},
-std::array<float,2>{0.894835353f, 0.132718921f},
-std::array<float,2>{0.438698292f, 0.841700852f},
-std::array<float,2>{0.0207243115f, 0.236094773f},
-std::array<float,2>{0.628838301f, 0.812013924f},
-std::array<float,2>{0.765234947f, 0.321375221f},
-std::array<float,2>{0.265712917f, 0.668043852f},
-std::array<float,2>{0.380931765f, 0.495532066f},
-std::array<float,2>{0.963371754f, 0.596471965f},
-std::array<float,2>{0.618366003f, 0.110995859f},
-std::array<float,2>{0.135758966f, 0.889803827f},
-std::array<float,2>{0.355024964f, 0.226334751f},
-std::array<float,2>{0.862861812f, 0.793486536f},
-std::array<float,2>{0.710681617f, 0.328584373f},
-std::array<float,2>{0.0842278525f, 0.672922194f},
-std::array<float,2>{0.208173692f, 0.482893348f},
-std::array<float,2>{0.507007599f, 0.613201141f},
-std::array<float,2>{0.921056092f, 0.0977403969f},
-std::array<float,2>{0.482334286f, 0.906117618f},
-std::array<float,2>{0.038851399f, 0.0566388741f},
-std::array<float,2>{0.670576096f, 0.974506199f},
-std::array<float,2>{0.795186818f, 0.388175726f},
-std::array<float,2>{0.294568032f, 0.500660598f},
-std::array<float,2>{0.414241552f, 0.299522638f},
-std::array<float,2>{0.984512269f, 0.71051544f},
-std::array<float,2>{0.568285286f, 0.145088851f},
-std::array<float,2>{0.173744276f, 0.823513806f},
-std::array<float,2>{0.445278138f, 0.0644917488f},
-std::array<float,2>{0.893482268f, 0.926747501f},
-std::array<float,2>{0.54666096f, 0.440308094f},
-std::array<float,2>{0.247764856f, 0.568331063f},
-std::array<float,2>{0.110391997f, 0.353535503f},
-std::array<float,2>{0.722115695f, 0.628919125f},
-std::array<float,2>{0.820702255f, 0.199430212f},
-std::array<float,2>{0.324113131f, 0.780521512f},
-std::array<float,2>{0.138927549f, 0.158753023f},
-std::array<float,2>{0.622043729f, 0.868301392f},
-std::array<float,2>{0.967764556f, 0.266203821f},
-std::array<float,2>{0.377627879f, 0.734691501f},
-std::array<float,2>{0.273088604f, 0.426112533f},
-std::array<float,2>{0.761418581f, 0.548521936f},
-std::array<float,2>{0.630051076f, 0.0112905074f},
-std::array<float,2>{0.0163551439f, 0.961943448f},
-std::array<float,2>{0.391745478f, 0.13741678f},
-std::array<float,2>{0.939384103f, 0.835555434f},
-std::array<float,2>{0.602697432f, 0.284548551f},
-std::array<float,2>{0.147621751f, 0.703097284f},
-std::array<float,2>{0.0132179195f, 0.398637682f},
-std::array<float,2>{0.655555904f, 0.530812263f},
-std::array<float,2>{0.775614738f, 0.0371653661f},
-std::array<float,2>{0.251264125f, 0.984778821f},
-std::array<float,2>{0.229842216f, 0.11953412f},
-std::array<float,2>{0.561741173f, 0.880155087f},
-std::array<float,2>{0.879186153f, 0.484521747f},
-std::array<float,2>{0.4573569f, 0.601563454f},
-std::array<float,2>{0.338574588f, 0.31468007f},
-std::array<float,2>{0.839845479f, 0.661109328f},
-std::array<float,2>{0.737300336f, 0.246002749f},
-std::array<float,2>{0.103678852f, 0.80184561f},
-std::array<float,2>{0.309944987f, 0.0264825728f},
-std::array<float,2>{0.801068783f, 0.94233489f},
-std::array<float,2>{0.673211992f, 0.418062955f},
-std::array<float,2>{0.0473409817f, 0.545617104f},
-std::array<float,2>{0.171125636f, 0.252817512f},
-std::array<float,2>{0.584061265f, 0.727615058f},
-std::array<float,2>{0.971210122f, 0.184803769f},
-std::array<float,2>{0.437151998f, 0.853619576f},
-std::array<float,2>{0.0740534067f, 0.216537267f},
-std::array<float,2>{0.701368511f, 0.763296187f},
-std::array<float,2>{0.847040415f, 0.371624798f},
-std::array<float,2>{0.363301903f, 0.654242277f},
-std::array<float,2>{0.491199136f, 0.458486289f},
-std::array<float,2>{0.92575562f, 0.583538115f},
-std::array<float,2>{0.5189358f, 0.0838594362f},
-std::array<float,2>{0.199834183f, 0.909360945f},
-std::array<float,2>{0.262518167f, 0.176749691f},
-std::array<float,2>{0.766113818f, 0.850568712f},
-std::array<float,2>{0.646410763f, 0.265346736f},
-std::array<float,2>{0.00592838274f, 0.720476449f},
-std::array<float,2>{0.152088091f, 0.408436358f},
-std::array<float,2>{0.596015036f, 0.535172582f},
-std::array<float,2>{0.948491454f, 0.0233710799f},
-std::array<float,2>{0.404652297f, 0.952994704f},
-std::array<float,2>{0.0949260592f, 0.0871961415f},
-std::array<float,2>{0.745017529f, 0.914440751f},
-std::array<float,2>{0.834786713f, 0.463185877f},
-std::array<float,2>{0.329623222f, 0.590167701f},
-std::array<float,2>{0.465164423f, 0.365281701f},
-std::array<float,2>{0.888431191f, 0.648298144f},
-std::array<float,2>{0.552943528f, 0.204714581f},
-std::array<float,2>{0.222555682f, 0.75336349f},
-std::array<float,2>{0.425791442f, 0.0424454361f},
-std::array<float,2>{0.978304863f, 0.992761195f},
-std::array<float,2>{0.591496706f, 0.39148581f},
-std::array<float,2>{0.15653947f, 0.522097945f},
-std::array<float,2>{0.0572638623f, 0.294614971f},
-std::array<float,2>{0.68537128f, 0.693397462f},
-std::array<float,2>{0.810475051f, 0.128423735f},
-std::array<float,2>{0.300272644f, 0.838386238f},
-std::array<float,2>{0.188868836f, 0.239473566f},
-std::array<float,2>{0.528123796f, 0.808330655f},
-std::array<float,2>{0.936157882f, 0.326318204f},
-std::array<float,2>{0.496230215f, 0.664390326f},
-std::array<float,2>{0.370346397f, 0.497216165f},
-std::array<float,2>{0.858328879f, 0.59793365f},
-std::array<float,2>{0.692166448f, 0.114284709f},
-std::array<float,2>{0.0679753795f, 0.88366425f},
-std::array<float,2>{0.471858859f, 0.191196233f},
-std::array<float,2>{0.91397059f, 0.771651506f},
-std::array<float,2>{0.509032667f, 0.34500128f},
-std::array<float,2>{0.211466044f, 0.637390733f},
-std::array<float,2>{0.086360909f, 0.453021586f},
-std::array<float,2>{0.717977583f, 0.576850295f},
-std::array<float,2>{0.870904028f, 0.0765694901f},
-std::array<float,2>{0.346293271f, 0.936150014f},
-std::array<float,2>{0.182632431f, 0.000452248205f},
-std::array<float,2>{0.571933925f, 0.957852364f},
-std::array<float,2>{0.993661106f, 0.430194616f},
-std::array<float,2>{0.407823622f, 0.56244427f},
-std::array<float,2>{0.283672392f, 0.278567672f},
-std::array<float,2>{0.788021266f, 0.745390475f},
-std::array<float,2>{0.658580422f, 0.166201741f},
-std::array<float,2>{0.0455822125f, 0.863109648f},
-std::array<float,2>{0.313704252f, 0.104541063f},
-std::array<float,2>{0.813058674f, 0.896821082f},
-std::array<float,2>{0.727957606f, 0.474526972f},
-std::array<float,2>{0.119472146f, 0.622939944f},
-std::array<float,2>{0.238767475f, 0.338834971f},
-std::array<float,2>{0.537329495f, 0.682409704f},
-std::array<float,2>{0.900915802f, 0.230993569f},
-std::array<float,2>{0.446199536f, 0.783429682f},
-std::array<float,2>{0.0310456455f, 0.151538521f},
-std::array<float,2>{0.637640774f, 0.819012225f},
-std::array<float,2>{0.750826955f, 0.30854246f},
-std::array<float,2>{0.279672831f, 0.715824068f},
-std::array<float,2>{0.384456605f, 0.382706821f},
-std::array<float,2>{0.956430316f, 0.509479284f},
-std::array<float,2>{0.614298642f, 0.0540981628f},
-std::array<float,2>{0.129044503f, 0.983973682f},
-std::array<float,2>{0.334931135f, 0.14185594f},
-std::array<float,2>{0.830275595f, 0.82671994f},
-std::array<float,2>{0.746556938f, 0.30133155f},
-std::array<float,2>{0.0979768708f, 0.705178559f},
-std::array<float,2>{0.226234436f, 0.383159101f},
-std::array<float,2>{0.548153341f, 0.506002247f},
-std::array<float,2>{0.88653779f, 0.0607263297f},
-std::array<float,2>{0.462563425f, 0.971593916f},
-std::array<float,2>{0.00123069866f, 0.0948515162f},
-std::array<float,2>{0.642148674f, 0.900129795f},
-std::array<float,2>{0.770644963f, 0.476844162f},
-std::array<float,2>{0.259640187f, 0.616611123f},
-std::array<float,2>{0.398834854f, 0.335191667f},
-std::array<float,2>{0.952113688f, 0.676332235f},
-std::array<float,2>{0.598446965f, 0.220531493f},
-std::array<float,2>{0.155598879f, 0.791268826f},
-std::array<float,2>{0.492354155f, 0.0128902039f},
-std::array<float,2>{0.930320263f, 0.968017638f},
-std::array<float,2>{0.526333272f, 0.422568828f},
-std::array<float,2>{0.19435364f, 0.551814139f},
-std::array<float,2>{0.0657442212f, 0.27169466f},
-std::array<float,2>{0.690946639f, 0.742126882f},
-std::array<float,2>{0.854675949f, 0.160679042f},
-std::array<float,2>{0.373648107f, 0.874093294f},
-std::array<float,2>{0.163475737f, 0.198459536f},
-std::array<float,2>{0.587862551f, 0.776242673f},
-std::array<float,2>{0.981718838f, 0.355811387f},
-std::array<float,2>{0.425263911f, 0.628162742f},
-std::array<float,2>{0.301138192f, 0.442307383f},
-std::array<float,2>{0.807538569f, 0.564050078f},
-std::array<float,2>{0.681530714f, 0.0685228631f},
-std::array<float,2>{0.0592261814f, 0.922908723f},
-std::array<float,2>{0.412149429f, 0.249604151f},
-std::array<float,2>{0.999104738f, 0.799905837f},
-std::array<float,2>{0.57707119f, 0.317063004f},
-std::array<float,2>{0.186056688f, 0.658850431f},
-std::array<float,2>{0.040585842f, 0.489736617f},
-std::array<float,2>{0.663940668f, 0.607981265f},
-std::array<float,2>{0.782793403f, 0.121949121f},
-std::array<float,2>{0.287654459f, 0.876110375f},
-std::array<float,2>{0.216679409f, 0.0344162136f},
-std::array<float,2>{0.513888717f, 0.989452362f},
-std::array<float,2>{0.909516037f, 0.402654976f},
-std::array<float,2>{0.475196004f, 0.526944458f},
-std::array<float,2>{0.350447088f, 0.286693603f},
-std::array<float,2>{0.872739434f, 0.69850558f},
-std::array<float,2>{0.710976481f, 0.135123938f},
-std::array<float,2>{0.0918902829f, 0.82857275f},
-std::array<float,2>{0.274627388f, 0.0806150734f},
-std::array<float,2>{0.755792022f, 0.912212789f},
-std::array<float,2>{0.636212349f, 0.455644995f},
-std::array<float,2>{0.0254043471f, 0.579604924f},
-std::array<float,2>{0.127917543f, 0.368829459f},
-std::array<float,2>{0.612639904f, 0.648483813f},
-std::array<float,2>{0.958405614f, 0.212170735f},
-std::array<float,2>{0.388614088f, 0.760861933f},
-std::array<float,2>{0.123497926f, 0.180104077f},
-std::array<float,2>{0.732464612f, 0.858861446f},
-std::array<float,2>{0.816868663f, 0.256235778f},
-std::array<float,2>{0.318831354f, 0.732143104f},
-std::array<float,2>{0.451699257f, 0.416740358f},
-std::array<float,2>{0.905873299f, 0.541322529f},
-std::array<float,2>{0.531457067f, 0.0312107839f},
-std::array<float,2>{0.237544611f, 0.937988639f},
-std::array<float,2>{0.29165864f, 0.210117891f},
-std::array<float,2>{0.791603088f, 0.754184961f},
-std::array<float,2>{0.66635114f, 0.360519141f},
-std::array<float,2>{0.0340791307f, 0.641299486f},
-std::array<float,2>{0.17849496f, 0.46833083f},
-std::array<float,2>{0.566052794f, 0.588825285f},
-std::array<float,2>{0.990478039f, 0.0935900509f},
-std::array<float,2>{0.4201217f, 0.920913041f},
-std::array<float,2>{0.0792019367f, 0.0190432705f},
-std::array<float,2>{0.70641011f, 0.946811378f},
-std::array<float,2>{0.865653217f, 0.41187501f},
-std::array<float,2>{0.358084619f, 0.532048941f},
-std::array<float,2>{0.479459912f, 0.260115623f},
-std::array<float,2>{0.915424943f, 0.723373473f},
-std::array<float,2>{0.500628114f, 0.174682125f},
-std::array<float,2>{0.204812646f, 0.845852017f},
-std::array<float,2>{0.37923339f, 0.109548785f},
-std::array<float,2>{0.962784231f, 0.888795257f},
-std::array<float,2>{0.620469689f, 0.494723141f},
-std::array<float,2>{0.134668559f, 0.596803904f},
-std::array<float,2>{0.0219114106f, 0.320886642f},
-std::array<float,2>{0.625115931f, 0.669391334f},
-std::array<float,2>{0.761911631f, 0.234410167f},
-std::array<float,2>{0.268848002f, 0.810990334f},
-std::array<float,2>{0.244040668f, 0.13091971f},
-std::array<float,2>{0.542304575f, 0.840452194f},
-std::array<float,2>{0.897760987f, 0.289896965f},
-std::array<float,2>{0.439690083f, 0.68991518f},
-std::array<float,2>{0.327654243f, 0.395047575f},
-std::array<float,2>{0.825813711f, 0.518328011f},
-std::array<float,2>{0.725762486f, 0.0462495647f},
-std::array<float,2>{0.11471054f, 0.998059928f},
-std::array<float,2>{0.456019998f, 0.171556607f},
-std::array<float,2>{0.876630068f, 0.86676836f},
-std::array<float,2>{0.55478996f, 0.277015328f},
-std::array<float,2>{0.23252821f, 0.748874605f},
-std::array<float,2>{0.107064746f, 0.434200406f},
-std::array<float,2>{0.742009699f, 0.558062971f},
-std::array<float,2>{0.83786571f, 0.00468810322f},
-std::array<float,2>{0.342483103f, 0.955504894f},
-std::array<float,2>{0.143050984f, 0.0735835582f},
-std::array<float,2>{0.606669486f, 0.932461083f},
-std::array<float,2>{0.942179561f, 0.445653796f},
-std::array<float,2>{0.397129327f, 0.57113862f},
-std::array<float,2>{0.254643798f, 0.350078523f},
-std::array<float,2>{0.779470503f, 0.635120571f},
-std::array<float,2>{0.649779856f, 0.194070816f},
-std::array<float,2>{0.00904431473f, 0.765791595f},
-std::array<float,2>{0.363043904f, 0.0487297364f},
-std::array<float,2>{0.848216176f, 0.979711235f},
-std::array<float,2>{0.697891951f, 0.378727704f},
-std::array<float,2>{0.0774973705f, 0.512373507f},
-std::array<float,2>{0.198858008f, 0.310075462f},
-std::array<float,2>{0.521246791f, 0.714461744f},
-std::array<float,2>{0.927878916f, 0.152663082f},
-std::array<float,2>{0.484629124f, 0.815753579f},
-std::array<float,2>{0.0528162196f, 0.228220835f},
-std::array<float,2>{0.675852001f, 0.785169423f},
-std::array<float,2>{0.797142029f, 0.341683507f},
-std::array<float,2>{0.305401921f, 0.687428415f},
-std::array<float,2>{0.433119029f, 0.469206333f},
-std::array<float,2>{0.974089384f, 0.618953407f},
-std::array<float,2>{0.580780447f, 0.10786698f},
-std::array<float,2>{0.165475562f, 0.892498374f},
-std::array<float,2>{0.320900768f, 0.202644795f},
-std::array<float,2>{0.823485076f, 0.778824031f},
-std::array<float,2>{0.719437957f, 0.352641881f},
-std::array<float,2>{0.113039941f, 0.631439209f},
-std::array<float,2>{0.248421341f, 0.438250095f},
-std::array<float,2>{0.543739676f, 0.569026172f},
-std::array<float,2>{0.892483771f, 0.0627733544f},
-std::array<float,2>{0.442739755f, 0.928789079f},
-std::array<float,2>{0.0180112254f, 0.0082748821f},
-std::array<float,2>{0.631337702f, 0.964601994f},
-std::array<float,2>{0.758536875f, 0.42778939f},
-std::array<float,2>{0.271087855f, 0.5496943f},
-std::array<float,2>{0.375279129f, 0.268524408f},
-std::array<float,2>{0.966224015f, 0.736986697f},
-std::array<float,2>{0.624946117f, 0.157892376f},
-std::array<float,2>{0.137535229f, 0.86931324f},
-std::array<float,2>{0.482574165f, 0.0998258889f},
-std::array<float,2>{0.918561399f, 0.902904034f},
-std::array<float,2>{0.505332232f, 0.481417686f},
-std::array<float,2>{0.209339157f, 0.610174298f},
-std::array<float,2>{0.0833146274f, 0.330410391f},
-std::array<float,2>{0.708655238f, 0.674427927f},
-std::array<float,2>{0.861161768f, 0.222732797f},
-std::array<float,2>{0.35331744f, 0.79627353f},
-std::array<float,2>{0.174601153f, 0.14838703f},
-std::array<float,2>{0.570147097f, 0.821490765f},
-std::array<float,2>{0.98638016f, 0.297019869f},
-std::array<float,2>{0.417163938f, 0.708457291f},
-std::array<float,2>{0.296130508f, 0.38945508f},
-std::array<float,2>{0.794166267f, 0.502031446f},
-std::array<float,2>{0.668288589f, 0.0584460981f},
-std::array<float,2>{0.0367701277f, 0.975999236f},
-std::array<float,2>{0.433801115f, 0.185808584f},
-std::array<float,2>{0.968818903f, 0.851811945f},
-std::array<float,2>{0.583327115f, 0.250294238f},
-std::array<float,2>{0.168492496f, 0.728806376f},
-std::array<float,2>{0.0506407656f, 0.420032412f},
-std::array<float,2>{0.675739586f, 0.543560505f},
-std::array<float,2>{0.802875519f, 0.0245761983f},
-std::array<float,2>{0.310581833f, 0.944882929f},
-std::array<float,2>{0.201721877f, 0.0857352614f},
-std::array<float,2>{0.515707374f, 0.906738818f},
-std::array<float,2>{0.922316611f, 0.460250616f},
-std::array<float,2>{0.489376038f, 0.585290849f},
-std::array<float,2>{0.365570903f, 0.374273092f},
-std::array<float,2>{0.845163405f, 0.654429436f},
-std::array<float,2>{0.700576305f, 0.217952445f},
-std::array<float,2>{0.0709850565f, 0.764364719f},
-std::array<float,2>{0.252730817f, 0.0368256383f},
-std::array<float,2>{0.774721622f, 0.986897051f},
-std::array<float,2>{0.653398335f, 0.400489688f},
-std::array<float,2>{0.0153749306f, 0.528933823f},
-std::array<float,2>{0.145495385f, 0.282887876f},
-std::array<float,2>{0.604364514f, 0.699538171f},
-std::array<float,2>{0.940364003f, 0.140329674f},
-std::array<float,2>{0.394156188f, 0.833324015f},
-std::array<float,2>{0.10161145f, 0.24292168f},
-std::array<float,2>{0.7350021f, 0.803314149f},
-std::array<float,2>{0.841842651f, 0.312910974f},
-std::array<float,2>{0.337283581f, 0.663888991f},
-std::array<float,2>{0.460660666f, 0.487841964f},
-std::array<float,2>{0.88278389f, 0.604576826f},
-std::array<float,2>{0.560207605f, 0.118105523f},
-std::array<float,2>{0.226720512f, 0.88205272f},
-std::array<float,2>{0.297611624f, 0.125187919f},
-std::array<float,2>{0.810918331f, 0.836455226f},
-std::array<float,2>{0.687339842f, 0.295061827f},
-std::array<float,2>{0.0551729016f, 0.691776931f},
-std::array<float,2>{0.1590572f, 0.394345015f},
-std::array<float,2>{0.592939854f, 0.52084893f},
-std::array<float,2>{0.979335845f, 0.0392569192f},
-std::array<float,2>{0.428268552f, 0.995300829f},
-std::array<float,2>{0.0695673898f, 0.116130471f},
-std::array<float,2>{0.694155693f, 0.886306226f},
-std::array<float,2>{0.857010245f, 0.498308182f},
-std::array<float,2>{0.368992358f, 0.601044953f},
-std::array<float,2>{0.498372138f, 0.324729145f},
-std::array<float,2>{0.933783412f, 0.666215181f},
-std::array<float,2>{0.529818237f, 0.241779268f},
-std::array<float,2>{0.190948844f, 0.805897057f},
-std::array<float,2>{0.402999997f, 0.0213557817f},
-std::array<float,2>{0.946717799f, 0.950902641f},
-std::array<float,2>{0.595397294f, 0.407376707f},
-std::array<float,2>{0.150294155f, 0.538446367f},
-std::array<float,2>{0.00401062146f, 0.261991411f},
-std::array<float,2>{0.647691548f, 0.720994771f},
-std::array<float,2>{0.768281519f, 0.178801686f},
-std::array<float,2>{0.264257729f, 0.849307775f},
-std::array<float,2>{0.219574004f, 0.20545423f},
-std::array<float,2>{0.551124215f, 0.750335276f},
-std::array<float,2>{0.888976693f, 0.364349008f},
-std::array<float,2>{0.466929764f, 0.644987464f},
-std::array<float,2>{0.330293089f, 0.461531371f},
-std::array<float,2>{0.832568467f, 0.592322052f},
-std::array<float,2>{0.743783355f, 0.0897782072f},
-std::array<float,2>{0.0971928164f, 0.916993856f},
-std::array<float,2>{0.448995441f, 0.232964724f},
-std::array<float,2>{0.898864746f, 0.782393098f},
-std::array<float,2>{0.535586238f, 0.336536556f},
-std::array<float,2>{0.241983339f, 0.681063831f},
-std::array<float,2>{0.119083717f, 0.475669354f},
-std::array<float,2>{0.728670299f, 0.624105752f},
-std::array<float,2>{0.81445384f, 0.101993829f},
-std::array<float,2>{0.315398544f, 0.896024168f},
-std::array<float,2>{0.131803364f, 0.0508977249f},
-std::array<float,2>{0.616661906f, 0.981551409f},
-std::array<float,2>{0.954692721f, 0.378937066f},
-std::array<float,2>{0.386283845f, 0.510937691f},
-std::array<float,2>{0.278826684f, 0.305039138f},
-std::array<float,2>{0.753241479f, 0.718574345f},
-std::array<float,2>{0.640161216f, 0.14855884f},
-std::array<float,2>{0.0279873889f, 0.816801369f},
-std::array<float,2>{0.344092637f, 0.0748095065f},
-std::array<float,2>{0.867264211f, 0.934535265f},
-std::array<float,2>{0.716110587f, 0.449623019f},
-std::array<float,2>{0.0890013948f, 0.576075256f},
-std::array<float,2>{0.21462132f, 0.34750545f},
-std::array<float,2>{0.511154532f, 0.639932454f},
-std::array<float,2>{0.911597431f, 0.188084975f},
-std::array<float,2>{0.470117778f, 0.770265043f},
-std::array<float,2>{0.0441098958f, 0.164888874f},
-std::array<float,2>{0.65704757f, 0.859840035f},
-std::array<float,2>{0.785555422f, 0.281088531f},
-std::array<float,2>{0.282631755f, 0.743699431f},
-std::array<float,2>{0.409452885f, 0.432115853f},
-std::array<float,2>{0.994793236f, 0.559329569f},
-std::array<float,2>{0.572581589f, 0.00257908786f},
-std::array<float,2>{0.180011034f, 0.959680259f},
-std::array<float,2>{0.372907996f, 0.163871169f},
-std::array<float,2>{0.852633476f, 0.871295452f},
-std::array<float,2>{0.688069344f, 0.269843698f},
-std::array<float,2>{0.0625316203f, 0.738779068f},
-std::array<float,2>{0.192661121f, 0.423898816f},
-std::array<float,2>{0.524782717f, 0.553671837f},
-std::array<float,2>{0.931841254f, 0.0153105231f},
-std::array<float,2>{0.494725317f, 0.965729058f},
-std::array<float,2>{0.0621943288f, 0.0675125644f},
-std::array<float,2>{0.683108509f, 0.924909413f},
-std::array<float,2>{0.806132495f, 0.44485119f},
-std::array<float,2>{0.303932667f, 0.564612508f},
-std::array<float,2>{0.42277503f, 0.357693493f},
-std::array<float,2>{0.982512593f, 0.626799464f},
-std::array<float,2>{0.5885638f, 0.196898133f},
-std::array<float,2>{0.160987481f, 0.775143087f},
-std::array<float,2>{0.463176161f, 0.0592089184f},
-std::array<float,2>{0.88319087f, 0.968859911f},
-std::array<float,2>{0.549427032f, 0.385238558f},
-std::array<float,2>{0.224420771f, 0.505057573f},
-std::array<float,2>{0.101500794f, 0.302989811f},
-std::array<float,2>{0.749927282f, 0.703317344f},
-std::array<float,2>{0.828728616f, 0.143783197f},
-std::array<float,2>{0.332564652f, 0.825435698f},
-std::array<float,2>{0.153552443f, 0.221494883f},
-std::array<float,2>{0.60145539f, 0.790261865f},
-std::array<float,2>{0.950396776f, 0.332640678f},
-std::array<float,2>{0.401206881f, 0.679622293f},
-std::array<float,2>{0.261436284f, 0.478654563f},
-std::array<float,2>{0.773137093f, 0.615016222f},
-std::array<float,2>{0.643758357f, 0.0959038436f},
-std::array<float,2>{0.00337351556f, 0.900679111f},
-std::array<float,2>{0.389212966f, 0.214290082f},
-std::array<float,2>{0.959282577f, 0.758419096f},
-std::array<float,2>{0.610409915f, 0.370388687f},
-std::array<float,2>{0.126731858f, 0.651450396f},
-std::array<float,2>{0.0243216977f, 0.453147978f},
-std::array<float,2>{0.633077204f, 0.580448091f},
-std::array<float,2>{0.756605506f, 0.0794131234f},
-std::array<float,2>{0.27599293f, 0.911098599f},
-std::array<float,2>{0.234542206f, 0.0280910991f},
-std::array<float,2>{0.535098135f, 0.940830708f},
-std::array<float,2>{0.902812421f, 0.414296687f},
-std::array<float,2>{0.449306577f, 0.540753603f},
-std::array<float,2>{0.316779703f, 0.254031777f},
-std::array<float,2>{0.819708526f, 0.73283112f},
-std::array<float,2>{0.730590522f, 0.18253617f},
-std::array<float,2>{0.122270487f, 0.85548687f},
-std::array<float,2>{0.285273969f, 0.12326435f},
-std::array<float,2>{0.783747137f, 0.877310753f},
-std::array<float,2>{0.660688221f, 0.49026376f},
-std::array<float,2>{0.0423998423f, 0.606439233f},
-std::array<float,2>{0.185086101f, 0.31857276f},
-std::array<float,2>{0.574999988f, 0.657306135f},
-std::array<float,2>{0.997478366f, 0.247733712f},
-std::array<float,2>{0.41123274f, 0.798222005f},
-std::array<float,2>{0.0913737714f, 0.132954612f},
-std::array<float,2>{0.713327289f, 0.830289185f},
-std::array<float,2>{0.873550057f, 0.288948506f},
-std::array<float,2>{0.347758502f, 0.696762323f},
-std::array<float,2>{0.474504292f, 0.405050874f},
-std::array<float,2>{0.906725228f, 0.525004625f},
-std::array<float,2>{0.512057602f, 0.0322000049f},
-std::array<float,2>{0.217534348f, 0.990778387f},
-std::array<float,2>{0.26688543f, 0.237987459f},
-std::array<float,2>{0.763723254f, 0.810520053f},
-std::array<float,2>{0.627279162f, 0.323937923f},
-std::array<float,2>{0.0204156525f, 0.670646369f},
-std::array<float,2>{0.13558051f, 0.49365133f},
-std::array<float,2>{0.617225885f, 0.594657421f},
-std::array<float,2>{0.96420455f, 0.111372292f},
-std::array<float,2>{0.382348061f, 0.888564587f},
-std::array<float,2>{0.116708338f, 0.0433400273f},
-std::array<float,2>{0.723530889f, 0.997539699f},
-std::array<float,2>{0.827963114f, 0.39773652f},
-std::array<float,2>{0.325880587f, 0.516769648f},
-std::array<float,2>{0.437734187f, 0.291072488f},
-std::array<float,2>{0.895900726f, 0.688170314f},
-std::array<float,2>{0.540811121f, 0.130202502f},
-std::array<float,2>{0.244872242f, 0.841918349f},
-std::array<float,2>{0.419152141f, 0.0914943293f},
-std::array<float,2>{0.989462733f, 0.9180094f},
-std::array<float,2>{0.563138068f, 0.466585398f},
-std::array<float,2>{0.176657975f, 0.585956931f},
-std::array<float,2>{0.0318394937f, 0.361877829f},
-std::array<float,2>{0.665364563f, 0.644214153f},
-std::array<float,2>{0.789423466f, 0.207115307f},
-std::array<float,2>{0.290650576f, 0.757298112f},
-std::array<float,2>{0.206296057f, 0.172563419f},
-std::array<float,2>{0.502905011f, 0.845419645f},
-std::array<float,2>{0.917278886f, 0.258480757f},
-std::array<float,2>{0.47699523f, 0.725343227f},
-std::array<float,2>{0.357316941f, 0.412293524f},
-std::array<float,2>{0.863299608f, 0.534589708f},
-std::array<float,2>{0.704954326f, 0.0167686716f},
-std::array<float,2>{0.0819662809f, 0.949153662f},
-std::array<float,2>{0.48823446f, 0.155938819f},
-std::array<float,2>{0.927664101f, 0.814404964f},
-std::array<float,2>{0.522749245f, 0.311764568f},
-std::array<float,2>{0.19724758f, 0.711491346f},
-std::array<float,2>{0.075543955f, 0.376827508f},
-std::array<float,2>{0.696347713f, 0.514537871f},
-std::array<float,2>{0.849626243f, 0.0493751839f},
-std::array<float,2>{0.361162752f, 0.977054477f},
-std::array<float,2>{0.167211279f, 0.106706925f},
-std::array<float,2>{0.578494012f, 0.8935256f},
-std::array<float,2>{0.976327002f, 0.471940219f},
-std::array<float,2>{0.430265307f, 0.619638264f},
-std::array<float,2>{0.306893885f, 0.343290716f},
-std::array<float,2>{0.800087392f, 0.685412169f},
-std::array<float,2>{0.679306567f, 0.228926986f},
-std::array<float,2>{0.0523909889f, 0.788531244f},
-std::array<float,2>{0.341046423f, 0.00638907077f},
-std::array<float,2>{0.838169038f, 0.953679502f},
-std::array<float,2>{0.739422321f, 0.435717523f},
-std::array<float,2>{0.108822413f, 0.556127012f},
-std::array<float,2>{0.231170908f, 0.274377406f},
-std::array<float,2>{0.5573138f, 0.74750334f},
-std::array<float,2>{0.877729535f, 0.169522196f},
-std::array<float,2>{0.453964621f, 0.86340642f},
-std::array<float,2>{0.0108454358f, 0.192536995f},
-std::array<float,2>{0.6523242f, 0.768450439f},
-std::array<float,2>{0.778333366f, 0.348757327f},
-std::array<float,2>{0.257755667f, 0.633104563f},
-std::array<float,2>{0.394553781f, 0.447949231f},
-std::array<float,2>{0.944167197f, 0.573715627f},
-std::array<float,2>{0.607770026f, 0.0711426362f},
-std::array<float,2>{0.142115027f, 0.92974627f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.133160651f, 0.567965508f},
-std::array<float,2>{0.808415294f, 0.40937525f},
-std::array<float,2>{0.3010934f, 0.0366468169f},
-std::array<float,2>{0.608107626f, 0.958786964f},
-std::array<float,2>{0.397361904f, 0.82000947f},
-std::array<float,2>{0.68477571f, 0.137257501f},
-std::array<float,2>{0.0863687098f, 0.321642339f},
-std::array<float,2>{0.960767388f, 0.652463913f},
-std::array<float,2>{0.320480287f, 0.707639515f},
-std::array<float,2>{0.545292139f, 0.263304085f},
-std::array<float,2>{0.235853806f, 0.239872694f},
-std::array<float,2>{0.814526916f, 0.76146698f},
-std::array<float,2>{0.0186901372f, 0.913150907f},
-std::array<float,2>{0.901734114f, 0.0934991911f},
-std::array<float,2>{0.494521976f, 0.451399922f},
-std::array<float,2>{0.706250787f, 0.54968524f},
-std::array<float,2>{0.0994047076f, 0.657646537f},
-std::array<float,2>{0.984255254f, 0.361748487f},
-std::array<float,2>{0.43398279f, 0.184243917f},
-std::array<float,2>{0.650563478f, 0.847115159f},
-std::array<float,2>{0.253711343f, 0.98237735f},
-std::array<float,2>{0.571646512f, 0.0100879585f},
-std::array<float,2>{0.160269096f, 0.393979639f},
-std::array<float,2>{0.756476879f, 0.621857762f},
-std::array<float,2>{0.446166247f, 0.522256434f},
-std::array<float,2>{0.720277905f, 0.496586263f},
-std::array<float,2>{0.0475666523f, 0.111899473f},
-std::array<float,2>{0.910152435f, 0.89046824f},
-std::array<float,2>{0.195137858f, 0.805673718f},
-std::array<float,2>{0.869310677f, 0.191498458f},
-std::array<float,2>{0.36966604f, 0.293540359f},
-std::array<float,2>{0.515172124f, 0.719900489f},
-std::array<float,2>{0.0423654579f, 0.539770126f},
-std::array<float,2>{0.928775966f, 0.460867703f},
-std::array<float,2>{0.461012155f, 0.062739037f},
-std::array<float,2>{0.744398296f, 0.934208333f},
-std::array<float,2>{0.355421931f, 0.774174869f},
-std::array<float,2>{0.526700854f, 0.220260262f},
-std::array<float,2>{0.20490478f, 0.27928853f},
-std::array<float,2>{0.849472582f, 0.701402724f},
-std::array<float,2>{0.410564691f, 0.640263319f},
-std::array<float,2>{0.626798272f, 0.331668973f},
-std::array<float,2>{0.122447491f, 0.148950458f},
-std::array<float,2>{0.999739289f, 0.833084464f},
-std::array<float,2>{0.175062716f, 0.94462204f},
-std::array<float,2>{0.772851586f, 0.0558432899f},
-std::array<float,2>{0.2808263f, 0.424746245f},
-std::array<float,2>{0.593515694f, 0.592551589f},
-std::array<float,2>{0.222067803f, 0.739572823f},
-std::array<float,2>{0.836191475f, 0.304166466f},
-std::array<float,2>{0.342946261f, 0.210763991f},
-std::array<float,2>{0.560554504f, 0.794828653f},
-std::array<float,2>{0.483533949f, 0.898510695f},
-std::array<float,2>{0.692665577f, 0.0964267626f},
-std::array<float,2>{0.010722734f, 0.480419666f},
-std::array<float,2>{0.876023412f, 0.500479937f},
-std::array<float,2>{0.28948471f, 0.602602482f},
-std::array<float,2>{0.624494374f, 0.390159935f},
-std::array<float,2>{0.15291281f, 0.0239205435f},
-std::array<float,2>{0.785767257f, 0.994001985f},
-std::array<float,2>{0.0695653185f, 0.865948856f},
-std::array<float,2>{0.940112472f, 0.159922212f},
-std::array<float,2>{0.3904576f, 0.355651855f},
-std::array<float,2>{0.660095394f, 0.677439749f},
-std::array<float,2>{0.213635668f, 0.514128387f},
-std::array<float,2>{0.858443201f, 0.472838104f},
-std::array<float,2>{0.348553658f, 0.107961953f},
-std::array<float,2>{0.519033253f, 0.895297706f},
-std::array<float,2>{0.456242263f, 0.783858716f},
-std::array<float,2>{0.735812128f, 0.212685555f},
-std::array<float,2>{0.0312777236f, 0.304786861f},
-std::array<float,2>{0.93120271f, 0.743195236f},
-std::array<float,2>{0.271668375f, 0.684102654f},
-std::array<float,2>{0.58064723f, 0.350620985f},
-std::array<float,2>{0.183866352f, 0.166211814f},
-std::array<float,2>{0.77370733f, 0.870173335f},
-std::array<float,2>{0.112534948f, 0.991030335f},
-std::array<float,2>{0.992090762f, 0.0201311894f},
-std::array<float,2>{0.416624695f, 0.382037848f},
-std::array<float,2>{0.634661376f, 0.596764445f},
-std::array<float,2>{0.0029656922f, 0.692618728f},
-std::array<float,2>{0.888671339f, 0.272336811f},
-std::array<float,2>{0.473842502f, 0.233831957f},
-std::array<float,2>{0.698701799f, 0.768719435f},
-std::array<float,2>{0.330325007f, 0.922348678f},
-std::array<float,2>{0.553617597f, 0.0751532689f},
-std::array<float,2>{0.230929121f, 0.468707025f},
-std::array<float,2>{0.832619429f, 0.535875499f},
-std::array<float,2>{0.377205074f, 0.578880131f},
-std::array<float,2>{0.665721714f, 0.431719661f},
-std::array<float,2>{0.0763436556f, 0.0508111119f},
-std::array<float,2>{0.94539237f, 0.952887774f},
-std::array<float,2>{0.142949492f, 0.839360595f},
-std::array<float,2>{0.792155027f, 0.142338499f},
-std::array<float,2>{0.284283221f, 0.34016344f},
-std::array<float,2>{0.610995054f, 0.631788313f},
-std::array<float,2>{0.0854202509f, 0.61620307f},
-std::array<float,2>{0.964594483f, 0.399739593f},
-std::array<float,2>{0.398908168f, 0.000792244624f},
-std::array<float,2>{0.675676107f, 0.972142339f},
-std::array<float,2>{0.304922879f, 0.851751924f},
-std::array<float,2>{0.597169578f, 0.173790663f},
-std::array<float,2>{0.12731044f, 0.368726164f},
-std::array<float,2>{0.797462881f, 0.667242408f},
-std::array<float,2>{0.486371875f, 0.734009147f},
-std::array<float,2>{0.712970197f, 0.283058643f},
-std::array<float,2>{0.0289606638f, 0.202959269f},
-std::array<float,2>{0.892324507f, 0.803215921f},
-std::array<float,2>{0.244013071f, 0.882190764f},
-std::array<float,2>{0.820820272f, 0.120124206f},
-std::array<float,2>{0.317742139f, 0.491037995f},
-std::array<float,2>{0.537068844f, 0.528744876f},
-std::array<float,2>{0.170275509f, 0.645241976f},
-std::array<float,2>{0.764672995f, 0.317828864f},
-std::array<float,2>{0.261232764f, 0.129961222f},
-std::array<float,2>{0.569538236f, 0.825724185f},
-std::array<float,2>{0.426296741f, 0.963051498f},
-std::array<float,2>{0.641794384f, 0.0407995209f},
-std::array<float,2>{0.104693055f, 0.418387175f},
-std::array<float,2>{0.975079954f, 0.571400106f},
-std::array<float,2>{0.363433629f, 0.559964597f},
-std::array<float,2>{0.507142901f, 0.439639598f},
-std::array<float,2>{0.200084269f, 0.0794789791f},
-std::array<float,2>{0.862412333f, 0.914764166f},
-std::array<float,2>{0.0560271926f, 0.752299309f},
-std::array<float,2>{0.914085746f, 0.24837254f},
-std::array<float,2>{0.443703324f, 0.252152771f},
-std::array<float,2>{0.733501613f, 0.717809021f},
-std::array<float,2>{0.240941554f, 0.600088656f},
-std::array<float,2>{0.816415727f, 0.378361285f},
-std::array<float,2>{0.325032592f, 0.0187325943f},
-std::array<float,2>{0.54178822f, 0.986404359f},
-std::array<float,2>{0.497222811f, 0.873734772f},
-std::array<float,2>{0.708967268f, 0.170821652f},
-std::array<float,2>{0.0228287969f, 0.346969694f},
-std::array<float,2>{0.902419209f, 0.681892276f},
-std::array<float,2>{0.300482124f, 0.748377502f},
-std::array<float,2>{0.603436232f, 0.311339378f},
-std::array<float,2>{0.137294173f, 0.217310682f},
-std::array<float,2>{0.811264277f, 0.785157025f},
-std::array<float,2>{0.0910183638f, 0.893808901f},
-std::array<float,2>{0.955168784f, 0.102599628f},
-std::array<float,2>{0.39141503f, 0.468940884f},
-std::array<float,2>{0.681148171f, 0.508815825f},
-std::array<float,2>{0.0516145304f, 0.626142323f},
-std::array<float,2>{0.913805842f, 0.337791622f},
-std::array<float,2>{0.451208651f, 0.145116329f},
-std::array<float,2>{0.725122631f, 0.842536986f},
-std::array<float,2>{0.372050643f, 0.948624313f},
-std::array<float,2>{0.511424601f, 0.0481400415f},
-std::array<float,2>{0.188800007f, 0.433790773f},
-std::array<float,2>{0.872333348f, 0.585358918f},
-std::array<float,2>{0.432937652f, 0.531271994f},
-std::array<float,2>{0.654937446f, 0.463704824f},
-std::array<float,2>{0.0969066396f, 0.073897168f},
-std::array<float,2>{0.977667511f, 0.92611748f},
-std::array<float,2>{0.15922372f, 0.769879699f},
-std::array<float,2>{0.751601875f, 0.226568833f},
-std::array<float,2>{0.255023807f, 0.267926723f},
-std::array<float,2>{0.576500058f, 0.689790905f},
-std::array<float,2>{0.117495321f, 0.525523663f},
-std::array<float,2>{0.993373275f, 0.485909849f},
-std::array<float,2>{0.409806341f, 0.122050218f},
-std::array<float,2>{0.631087542f, 0.87711817f},
-std::array<float,2>{0.274481833f, 0.798222721f},
-std::array<float,2>{0.587574005f, 0.195755079f},
-std::array<float,2>{0.179638982f, 0.286352038f},
-std::array<float,2>{0.769234657f, 0.729095995f},
-std::array<float,2>{0.465838224f, 0.671813309f},
-std::array<float,2>{0.747292042f, 0.37496981f},
-std::array<float,2>{0.0436793491f, 0.176803291f},
-std::array<float,2>{0.925780416f, 0.858121276f},
-std::array<float,2>{0.207993567f, 0.974734664f},
-std::array<float,2>{0.844602823f, 0.00745918741f},
-std::array<float,2>{0.359196514f, 0.402671993f},
-std::array<float,2>{0.528549254f, 0.610953748f},
-std::array<float,2>{0.150231704f, 0.713360906f},
-std::array<float,2>{0.781314909f, 0.254932731f},
-std::array<float,2>{0.294025093f, 0.246042117f},
-std::array<float,2>{0.618110836f, 0.754632771f},
-std::array<float,2>{0.384447992f, 0.921487749f},
-std::array<float,2>{0.66253072f, 0.0838799179f},
-std::array<float,2>{0.0629329607f, 0.444770962f},
-std::array<float,2>{0.941635311f, 0.554996073f},
-std::array<float,2>{0.339703918f, 0.574789226f},
-std::array<float,2>{0.557589829f, 0.415434927f},
-std::array<float,2>{0.225072563f, 0.0457695685f},
-std::array<float,2>{0.843357503f, 0.965791345f},
-std::array<float,2>{0.0128109381f, 0.820593238f},
-std::array<float,2>{0.878952384f, 0.126275092f},
-std::array<float,2>{0.477668494f, 0.312582433f},
-std::array<float,2>{0.687865257f, 0.643644929f},
-std::array<float,2>{0.181052729f, 0.554065883f},
-std::array<float,2>{0.77864331f, 0.445359856f},
-std::array<float,2>{0.266341686f, 0.0885589048f},
-std::array<float,2>{0.583654881f, 0.907404542f},
-std::array<float,2>{0.418768317f, 0.764892459f},
-std::array<float,2>{0.63907975f, 0.236794174f},
-std::array<float,2>{0.115542151f, 0.260708183f},
-std::array<float,2>{0.988067806f, 0.706649303f},
-std::array<float,2>{0.344441742f, 0.648798525f},
-std::array<float,2>{0.519916832f, 0.325182498f},
-std::array<float,2>{0.217154905f, 0.13316986f},
-std::array<float,2>{0.855148077f, 0.813468158f},
-std::array<float,2>{0.0384312347f, 0.954073966f},
-std::array<float,2>{0.935199857f, 0.0315658934f},
-std::array<float,2>{0.458401114f, 0.413199425f},
-std::array<float,2>{0.742169738f, 0.562706888f},
-std::array<float,2>{0.0719002336f, 0.726290166f},
-std::array<float,2>{0.949945033f, 0.290939152f},
-std::array<float,2>{0.379271537f, 0.191381127f},
-std::array<float,2>{0.669478178f, 0.809439838f},
-std::array<float,2>{0.288211733f, 0.885545909f},
-std::array<float,2>{0.615401208f, 0.116736427f},
-std::array<float,2>{0.146331891f, 0.49594298f},
-std::array<float,2>{0.796598554f, 0.518964052f},
-std::array<float,2>{0.472271025f, 0.617408633f},
-std::array<float,2>{0.700109959f, 0.396040589f},
-std::array<float,2>{0.00649851235f, 0.014473374f},
-std::array<float,2>{0.884390473f, 0.978299677f},
-std::array<float,2>{0.229259565f, 0.847935796f},
-std::array<float,2>{0.830219626f, 0.180782244f},
-std::array<float,2>{0.332657814f, 0.363487303f},
-std::array<float,2>{0.550605714f, 0.662270725f},
-std::array<float,2>{0.026516322f, 0.586062431f},
-std::array<float,2>{0.897839606f, 0.426839679f},
-std::array<float,2>{0.490132838f, 0.0586969219f},
-std::array<float,2>{0.714977026f, 0.93750906f},
-std::array<float,2>{0.31458056f, 0.828633249f},
-std::array<float,2>{0.534806609f, 0.153208062f},
-std::array<float,2>{0.249120802f, 0.333917528f},
-std::array<float,2>{0.826532602f, 0.63527739f},
-std::array<float,2>{0.402373999f, 0.69736886f},
-std::array<float,2>{0.676109374f, 0.27712056f},
-std::array<float,2>{0.0795220211f, 0.224951178f},
-std::array<float,2>{0.965792537f, 0.780132532f},
-std::array<float,2>{0.130828142f, 0.933200836f},
-std::array<float,2>{0.803406537f, 0.0668017268f},
-std::array<float,2>{0.309052169f, 0.455822289f},
-std::array<float,2>{0.599749744f, 0.545458078f},
-std::array<float,2>{0.19760403f, 0.675120711f},
-std::array<float,2>{0.864720523f, 0.354453862f},
-std::array<float,2>{0.361701608f, 0.160857648f},
-std::array<float,2>{0.501549482f, 0.861602724f},
-std::array<float,2>{0.439091504f, 0.996657193f},
-std::array<float,2>{0.728817344f, 0.0299168546f},
-std::array<float,2>{0.0611943528f, 0.385189682f},
-std::array<float,2>{0.918965399f, 0.606261015f},
-std::array<float,2>{0.265143275f, 0.505285144f},
-std::array<float,2>{0.562900603f, 0.480628848f},
-std::array<float,2>{0.167098925f, 0.100869834f},
-std::array<float,2>{0.758876443f, 0.904301524f},
-std::array<float,2>{0.107389092f, 0.791045785f},
-std::array<float,2>{0.969433427f, 0.204072669f},
-std::array<float,2>{0.422236949f, 0.300155699f},
-std::array<float,2>{0.646611571f, 0.735143065f},
-std::array<float,2>{0.162218004f, 0.623906195f},
-std::array<float,2>{0.755341351f, 0.391713142f},
-std::array<float,2>{0.251788914f, 0.00938535295f},
-std::array<float,2>{0.573609769f, 0.982625067f},
-std::array<float,2>{0.43709442f, 0.845370352f},
-std::array<float,2>{0.650047541f, 0.18613492f},
-std::array<float,2>{0.0998184755f, 0.361090034f},
-std::array<float,2>{0.980683982f, 0.658696711f},
-std::array<float,2>{0.368465573f, 0.721264958f},
-std::array<float,2>{0.512190163f, 0.295391798f},
-std::array<float,2>{0.191782817f, 0.194683746f},
-std::array<float,2>{0.867355883f, 0.808108687f},
-std::array<float,2>{0.0507540517f, 0.887953162f},
-std::array<float,2>{0.907564044f, 0.109464623f},
-std::array<float,2>{0.448409021f, 0.498978704f},
-std::array<float,2>{0.720880449f, 0.52047056f},
-std::array<float,2>{0.0897632614f, 0.65449518f},
-std::array<float,2>{0.957602322f, 0.322969437f},
-std::array<float,2>{0.395109713f, 0.139388219f},
-std::array<float,2>{0.685868144f, 0.81642592f},
-std::array<float,2>{0.303543061f, 0.959736049f},
-std::array<float,2>{0.606185675f, 0.0381660089f},
-std::array<float,2>{0.136087105f, 0.406764358f},
-std::array<float,2>{0.804703355f, 0.570126414f},
-std::array<float,2>{0.492391348f, 0.548346162f},
-std::array<float,2>{0.70473361f, 0.450567544f},
-std::array<float,2>{0.0165987089f, 0.0909313783f},
-std::array<float,2>{0.89892441f, 0.911376834f},
-std::array<float,2>{0.237020582f, 0.759576201f},
-std::array<float,2>{0.813072264f, 0.241048381f},
-std::array<float,2>{0.322436541f, 0.264076084f},
-std::array<float,2>{0.544832945f, 0.710839093f},
-std::array<float,2>{0.00947273057f, 0.502486706f},
-std::array<float,2>{0.877302885f, 0.477689147f},
-std::array<float,2>{0.481315494f, 0.0947398022f},
-std::array<float,2>{0.694409251f, 0.90050149f},
-std::array<float,2>{0.341188163f, 0.796812952f},
-std::array<float,2>{0.560534179f, 0.20761098f},
-std::array<float,2>{0.220380068f, 0.302336484f},
-std::array<float,2>{0.839840055f, 0.741405547f},
-std::array<float,2>{0.388206571f, 0.678701758f},
-std::array<float,2>{0.657500684f, 0.358076394f},
-std::array<float,2>{0.0671118647f, 0.157277524f},
-std::array<float,2>{0.938076258f, 0.86377275f},
-std::array<float,2>{0.155576617f, 0.99567914f},
-std::array<float,2>{0.78828609f, 0.0271131974f},
-std::array<float,2>{0.291726857f, 0.387170464f},
-std::array<float,2>{0.622968554f, 0.603696942f},
-std::array<float,2>{0.20690681f, 0.700438201f},
-std::array<float,2>{0.850034595f, 0.28076452f},
-std::array<float,2>{0.352373093f, 0.222575918f},
-std::array<float,2>{0.523468196f, 0.776599646f},
-std::array<float,2>{0.463369697f, 0.936907887f},
-std::array<float,2>{0.743849516f, 0.0651503205f},
-std::array<float,2>{0.0393461064f, 0.45874083f},
-std::array<float,2>{0.926643968f, 0.542148054f},
-std::array<float,2>{0.277623564f, 0.591324747f},
-std::array<float,2>{0.591477752f, 0.422169954f},
-std::array<float,2>{0.173167318f, 0.0571122728f},
-std::array<float,2>{0.770177662f, 0.941830516f},
-std::array<float,2>{0.123180747f, 0.834536374f},
-std::array<float,2>{0.99747777f, 0.151690379f},
-std::array<float,2>{0.412501514f, 0.328967422f},
-std::array<float,2>{0.628056109f, 0.638068676f},
-std::array<float,2>{0.232625663f, 0.538199425f},
-std::array<float,2>{0.834859788f, 0.464910537f},
-std::array<float,2>{0.329278171f, 0.0766834766f},
-std::array<float,2>{0.552491963f, 0.924460113f},
-std::array<float,2>{0.47523737f, 0.766871512f},
-std::array<float,2>{0.696042955f, 0.230490461f},
-std::array<float,2>{0.000696195872f, 0.270129412f},
-std::array<float,2>{0.889782548f, 0.693502009f},
-std::array<float,2>{0.282900542f, 0.62911731f},
-std::array<float,2>{0.612951756f, 0.342284858f},
-std::array<float,2>{0.142566249f, 0.142793283f},
-std::array<float,2>{0.789181888f, 0.837610304f},
-std::array<float,2>{0.0757201985f, 0.949900687f},
-std::array<float,2>{0.948943734f, 0.0545219779f},
-std::array<float,2>{0.375417799f, 0.43132171f},
-std::array<float,2>{0.666378856f, 0.580391705f},
-std::array<float,2>{0.0333276466f, 0.744242847f},
-std::array<float,2>{0.931660056f, 0.308211982f},
-std::array<float,2>{0.45400387f, 0.213899508f},
-std::array<float,2>{0.737838745f, 0.782707393f},
-std::array<float,2>{0.350134999f, 0.897986591f},
-std::array<float,2>{0.515806019f, 0.106506683f},
-std::array<float,2>{0.212641254f, 0.475993752f},
-std::array<float,2>{0.855585992f, 0.513348162f},
-std::array<float,2>{0.415423989f, 0.59450388f},
-std::array<float,2>{0.635636389f, 0.380117953f},
-std::array<float,2>{0.110686675f, 0.0231747515f},
-std::array<float,2>{0.989885628f, 0.990008414f},
-std::array<float,2>{0.186604813f, 0.867410123f},
-std::array<float,2>{0.776190221f, 0.165777177f},
-std::array<float,2>{0.269610047f, 0.34856239f},
-std::array<float,2>{0.578249395f, 0.687437296f},
-std::array<float,2>{0.102236092f, 0.572876871f},
-std::array<float,2>{0.9746086f, 0.421344936f},
-std::array<float,2>{0.428870142f, 0.0416049063f},
-std::array<float,2>{0.643408775f, 0.962187707f},
-std::array<float,2>{0.258961648f, 0.827880144f},
-std::array<float,2>{0.567316473f, 0.132532746f},
-std::array<float,2>{0.168807045f, 0.31929186f},
-std::array<float,2>{0.763412356f, 0.646499276f},
-std::array<float,2>{0.442362189f, 0.715208113f},
-std::array<float,2>{0.731196225f, 0.251438171f},
-std::array<float,2>{0.056647066f, 0.247140363f},
-std::array<float,2>{0.916602492f, 0.751102924f},
-std::array<float,2>{0.201906085f, 0.917358398f},
-std::array<float,2>{0.860300481f, 0.0805983618f},
-std::array<float,2>{0.366096854f, 0.439044595f},
-std::array<float,2>{0.505268037f, 0.561829805f},
-std::array<float,2>{0.12677224f, 0.665986359f},
-std::array<float,2>{0.799432456f, 0.369193286f},
-std::array<float,2>{0.307513654f, 0.174492434f},
-std::array<float,2>{0.593774378f, 0.85485214f},
-std::array<float,2>{0.40222922f, 0.970519423f},
-std::array<float,2>{0.672284901f, 0.00234744372f},
-std::array<float,2>{0.0823433027f, 0.400590479f},
-std::array<float,2>{0.962569177f, 0.613782287f},
-std::array<float,2>{0.319666833f, 0.530352831f},
-std::array<float,2>{0.538027406f, 0.489960045f},
-std::array<float,2>{0.245939374f, 0.117570743f},
-std::array<float,2>{0.823491335f, 0.879684269f},
-std::array<float,2>{0.0307552442f, 0.801284254f},
-std::array<float,2>{0.89275831f, 0.200016782f},
-std::array<float,2>{0.485618412f, 0.284012407f},
-std::array<float,2>{0.712865353f, 0.730989397f},
-std::array<float,2>{0.1900464f, 0.582685232f},
-std::array<float,2>{0.874313295f, 0.436613172f},
-std::array<float,2>{0.373986125f, 0.0506135002f},
-std::array<float,2>{0.509335041f, 0.946072817f},
-std::array<float,2>{0.450565398f, 0.840092421f},
-std::array<float,2>{0.723347962f, 0.147987187f},
-std::array<float,2>{0.0530980639f, 0.338094622f},
-std::array<float,2>{0.911105692f, 0.627010047f},
-std::array<float,2>{0.25697583f, 0.688196003f},
-std::array<float,2>{0.574624836f, 0.266175866f},
-std::array<float,2>{0.156348318f, 0.230187953f},
-std::array<float,2>{0.753360868f, 0.771791518f},
-std::array<float,2>{0.0956972614f, 0.927822769f},
-std::array<float,2>{0.978720725f, 0.0707150027f},
-std::array<float,2>{0.431503177f, 0.461903244f},
-std::array<float,2>{0.652794361f, 0.533894181f},
-std::array<float,2>{0.0208532959f, 0.681025088f},
-std::array<float,2>{0.905747056f, 0.344935924f},
-std::array<float,2>{0.499392301f, 0.169185475f},
-std::array<float,2>{0.709335744f, 0.872284889f},
-std::array<float,2>{0.327697426f, 0.986278653f},
-std::array<float,2>{0.54081732f, 0.0167398695f},
-std::array<float,2>{0.238591418f, 0.376669288f},
-std::array<float,2>{0.819746792f, 0.598574162f},
-std::array<float,2>{0.393733382f, 0.510733306f},
-std::array<float,2>{0.682517648f, 0.471545428f},
-std::array<float,2>{0.0922270045f, 0.104618035f},
-std::array<float,2>{0.954714298f, 0.892350852f},
-std::array<float,2>{0.138823748f, 0.787506104f},
-std::array<float,2>{0.8096928f, 0.216288894f},
-std::array<float,2>{0.298188359f, 0.308606923f},
-std::array<float,2>{0.6048944f, 0.747057676f},
-std::array<float,2>{0.065216735f, 0.556952953f},
-std::array<float,2>{0.943451285f, 0.443327814f},
-std::array<float,2>{0.385366976f, 0.085381493f},
-std::array<float,2>{0.660984039f, 0.918895245f},
-std::array<float,2>{0.295415848f, 0.756122053f},
-std::array<float,2>{0.619360209f, 0.244116753f},
-std::array<float,2>{0.151225537f, 0.257621884f},
-std::array<float,2>{0.783857167f, 0.712606668f},
-std::array<float,2>{0.478634745f, 0.641724348f},
-std::array<float,2>{0.690829754f, 0.31580621f},
-std::array<float,2>{0.015539228f, 0.127987951f},
-std::array<float,2>{0.881991446f, 0.823797107f},
-std::array<float,2>{0.222657248f, 0.967122972f},
-std::array<float,2>{0.840005755f, 0.0445610657f},
-std::array<float,2>{0.336252004f, 0.417048991f},
-std::array<float,2>{0.554969192f, 0.577198923f},
-std::array<float,2>{0.176194906f, 0.726875603f},
-std::array<float,2>{0.7667647f, 0.288190842f},
-std::array<float,2>{0.277053028f, 0.199035302f},
-std::array<float,2>{0.58867079f, 0.799425602f},
-std::array<float,2>{0.407311589f, 0.875462294f},
-std::array<float,2>{0.629114389f, 0.123575523f},
-std::array<float,2>{0.11923977f, 0.487262428f},
-std::array<float,2>{0.995676398f, 0.524903893f},
-std::array<float,2>{0.355889082f, 0.612074792f},
-std::array<float,2>{0.530733228f, 0.405265629f},
-std::array<float,2>{0.209803239f, 0.00420938944f},
-std::array<float,2>{0.847047687f, 0.973511279f},
-std::array<float,2>{0.0468580984f, 0.855712235f},
-std::array<float,2>{0.922914982f, 0.178162381f},
-std::array<float,2>{0.466962785f, 0.371836573f},
-std::array<float,2>{0.749981761f, 0.668722987f},
-std::array<float,2>{0.148176342f, 0.51740545f},
-std::array<float,2>{0.794042587f, 0.493648291f},
-std::array<float,2>{0.285224646f, 0.114464156f},
-std::array<float,2>{0.614244461f, 0.884702802f},
-std::array<float,2>{0.381242037f, 0.812251031f},
-std::array<float,2>{0.671335936f, 0.188348308f},
-std::array<float,2>{0.0737954602f, 0.292036384f},
-std::array<float,2>{0.952364028f, 0.723490298f},
-std::array<float,2>{0.335291237f, 0.660290658f},
-std::array<float,2>{0.548274755f, 0.36606735f},
-std::array<float,2>{0.228425473f, 0.182790399f},
-std::array<float,2>{0.829046249f, 0.851376355f},
-std::array<float,2>{0.00411613053f, 0.979722559f},
-std::array<float,2>{0.885327578f, 0.0134743182f},
-std::array<float,2>{0.47043246f, 0.398086876f},
-std::array<float,2>{0.702704489f, 0.619850993f},
-std::array<float,2>{0.114968576f, 0.704686224f},
-std::array<float,2>{0.986104369f, 0.258246243f},
-std::array<float,2>{0.421861589f, 0.234842777f},
-std::array<float,2>{0.637276173f, 0.763659f},
-std::array<float,2>{0.267637372f, 0.910146117f},
-std::array<float,2>{0.58475548f, 0.0861890242f},
-std::array<float,2>{0.183375403f, 0.447903275f},
-std::array<float,2>{0.780967474f, 0.551071405f},
-std::array<float,2>{0.45955193f, 0.565200627f},
-std::array<float,2>{0.738332331f, 0.411999226f},
-std::array<float,2>{0.0363599695f, 0.0341679566f},
-std::array<float,2>{0.937157214f, 0.956393003f},
-std::array<float,2>{0.216399252f, 0.816047132f},
-std::array<float,2>{0.852578759f, 0.135021657f},
-std::array<float,2>{0.345730394f, 0.327773124f},
-std::array<float,2>{0.522954464f, 0.651865244f},
-std::array<float,2>{0.0586649776f, 0.607479334f},
-std::array<float,2>{0.920658886f, 0.383096427f},
-std::array<float,2>{0.440131873f, 0.0287805684f},
-std::array<float,2>{0.727862418f, 0.999556541f},
-std::array<float,2>{0.361224324f, 0.860250354f},
-std::array<float,2>{0.502470195f, 0.163226143f},
-std::array<float,2>{0.195907027f, 0.352794051f},
-std::array<float,2>{0.866372943f, 0.672216654f},
-std::array<float,2>{0.425259829f, 0.737143695f},
-std::array<float,2>{0.644625366f, 0.298382521f},
-std::array<float,2>{0.107787699f, 0.20635128f},
-std::array<float,2>{0.97211647f, 0.790789008f},
-std::array<float,2>{0.164697319f, 0.903163075f},
-std::array<float,2>{0.760941863f, 0.0988947973f},
-std::array<float,2>{0.262688041f, 0.484011263f},
-std::array<float,2>{0.566386878f, 0.5066486f},
-std::array<float,2>{0.247240514f, 0.634429276f},
-std::array<float,2>{0.824850321f, 0.334070027f},
-std::array<float,2>{0.313376069f, 0.155852199f},
-std::array<float,2>{0.532574594f, 0.83160156f},
-std::array<float,2>{0.490758896f, 0.940205812f},
-std::array<float,2>{0.717265069f, 0.061102014f},
-std::array<float,2>{0.0238338318f, 0.428861707f},
-std::array<float,2>{0.894947886f, 0.588184536f},
-std::array<float,2>{0.310836494f, 0.543918073f},
-std::array<float,2>{0.597972155f, 0.454204381f},
-std::array<float,2>{0.132434011f, 0.0690044984f},
-std::array<float,2>{0.801050305f, 0.931610346f},
-std::array<float,2>{0.0815257207f, 0.778324068f},
-std::array<float,2>{0.967762828f, 0.224356577f},
-std::array<float,2>{0.405055761f, 0.27492395f},
-std::array<float,2>{0.679511666f, 0.697156727f},
-std::array<float,2>{0.153620556f, 0.605065644f},
-std::array<float,2>{0.786506355f, 0.388063908f},
-std::array<float,2>{0.29094246f, 0.0254180245f},
-std::array<float,2>{0.623700559f, 0.994622469f},
-std::array<float,2>{0.389493018f, 0.864270747f},
-std::array<float,2>{0.658954978f, 0.156348646f},
-std::array<float,2>{0.0686077103f, 0.358534366f},
-std::array<float,2>{0.940993488f, 0.679299116f},
-std::array<float,2>{0.342088848f, 0.740459502f},
-std::array<float,2>{0.562282205f, 0.301053315f},
-std::array<float,2>{0.221390873f, 0.20890516f},
-std::array<float,2>{0.837774575f, 0.794947326f},
-std::array<float,2>{0.0111541981f, 0.902287662f},
-std::array<float,2>{0.875179052f, 0.0945086852f},
-std::array<float,2>{0.483319849f, 0.477414221f},
-std::array<float,2>{0.692362189f, 0.5034554f},
-std::array<float,2>{0.121882588f, 0.637330353f},
-std::array<float,2>{0.998313367f, 0.32958886f},
-std::array<float,2>{0.411195308f, 0.150698587f},
-std::array<float,2>{0.625928283f, 0.835308194f},
-std::array<float,2>{0.279545635f, 0.942483246f},
-std::array<float,2>{0.59233588f, 0.0582749769f},
-std::array<float,2>{0.173965141f, 0.423488468f},
-std::array<float,2>{0.772034168f, 0.590733051f},
-std::array<float,2>{0.46222356f, 0.541392803f},
-std::array<float,2>{0.746080041f, 0.457767844f},
-std::array<float,2>{0.0418237373f, 0.0658567697f},
-std::array<float,2>{0.92852807f, 0.936108887f},
-std::array<float,2>{0.203965098f, 0.775721848f},
-std::array<float,2>{0.848387957f, 0.220797688f},
-std::array<float,2>{0.354297936f, 0.280195743f},
-std::array<float,2>{0.525940657f, 0.699434519f},
-std::array<float,2>{0.0482873842f, 0.520818114f},
-std::array<float,2>{0.909157157f, 0.499595493f},
-std::array<float,2>{0.447038144f, 0.111245647f},
-std::array<float,2>{0.718950391f, 0.886927068f},
-std::array<float,2>{0.370816737f, 0.806735933f},
-std::array<float,2>{0.513771176f, 0.193691999f},
-std::array<float,2>{0.194045171f, 0.296813309f},
-std::array<float,2>{0.870271623f, 0.722061098f},
-std::array<float,2>{0.43523851f, 0.660039544f},
-std::array<float,2>{0.651633143f, 0.359452814f},
-std::array<float,2>{0.0978629068f, 0.187474549f},
-std::array<float,2>{0.982639611f, 0.844268799f},
-std::array<float,2>{0.161604777f, 0.98386246f},
-std::array<float,2>{0.757011592f, 0.00850623567f},
-std::array<float,2>{0.252055913f, 0.391347647f},
-std::array<float,2>{0.571001887f, 0.624432564f},
-std::array<float,2>{0.234751165f, 0.709414601f},
-std::array<float,2>{0.815437675f, 0.26469326f},
-std::array<float,2>{0.321964473f, 0.241628543f},
-std::array<float,2>{0.546225846f, 0.758504808f},
-std::array<float,2>{0.496012181f, 0.910236418f},
-std::array<float,2>{0.706042588f, 0.0901013538f},
-std::array<float,2>{0.0182655696f, 0.449782073f},
-std::array<float,2>{0.901214123f, 0.54736954f},
-std::array<float,2>{0.30225876f, 0.56845057f},
-std::array<float,2>{0.609034896f, 0.407861501f},
-std::array<float,2>{0.134267315f, 0.0375390984f},
-std::array<float,2>{0.807576478f, 0.960067391f},
-std::array<float,2>{0.0876856074f, 0.81775713f},
-std::array<float,2>{0.95990175f, 0.139875501f},
-std::array<float,2>{0.398379266f, 0.32337743f},
-std::array<float,2>{0.684481978f, 0.656216621f},
-std::array<float,2>{0.200807288f, 0.56110853f},
-std::array<float,2>{0.861922562f, 0.438043922f},
-std::array<float,2>{0.364883423f, 0.0814682394f},
-std::array<float,2>{0.506400287f, 0.91615808f},
-std::array<float,2>{0.444425642f, 0.75076592f},
-std::array<float,2>{0.733322203f, 0.246326491f},
-std::array<float,2>{0.0556465946f, 0.250905275f},
-std::array<float,2>{0.915466011f, 0.715831459f},
-std::array<float,2>{0.260265887f, 0.647810757f},
-std::array<float,2>{0.56872189f, 0.319821805f},
-std::array<float,2>{0.171615437f, 0.131451562f},
-std::array<float,2>{0.764350414f, 0.827147126f},
-std::array<float,2>{0.104419388f, 0.96132952f},
-std::array<float,2>{0.976410866f, 0.0426549651f},
-std::array<float,2>{0.427487761f, 0.420465142f},
-std::array<float,2>{0.640851617f, 0.573406219f},
-std::array<float,2>{0.0275231451f, 0.732301116f},
-std::array<float,2>{0.890966356f, 0.285102993f},
-std::array<float,2>{0.488091141f, 0.200581953f},
-std::array<float,2>{0.71463567f, 0.802689612f},
-std::array<float,2>{0.316921294f, 0.880829871f},
-std::array<float,2>{0.535342932f, 0.118779495f},
-std::array<float,2>{0.242354393f, 0.488771141f},
-std::array<float,2>{0.822044373f, 0.530127168f},
-std::array<float,2>{0.399892747f, 0.614452064f},
-std::array<float,2>{0.674395919f, 0.402314007f},
-std::array<float,2>{0.0845336244f, 0.00294672139f},
-std::array<float,2>{0.963025212f, 0.969310522f},
-std::array<float,2>{0.12820296f, 0.853742123f},
-std::array<float,2>{0.798325717f, 0.175358117f},
-std::array<float,2>{0.305681974f, 0.370170206f},
-std::array<float,2>{0.596330822f, 0.664914489f},
-std::array<float,2>{0.0773289949f, 0.58174175f},
-std::array<float,2>{0.946820319f, 0.430498451f},
-std::array<float,2>{0.378839135f, 0.0527399331f},
-std::array<float,2>{0.664766371f, 0.950317562f},
-std::array<float,2>{0.28360337f, 0.836771965f},
-std::array<float,2>{0.609454751f, 0.144275755f},
-std::array<float,2>{0.144506171f, 0.343721569f},
-std::array<float,2>{0.791150093f, 0.630137622f},
-std::array<float,2>{0.47337386f, 0.694736898f},
-std::array<float,2>{0.698176622f, 0.270816565f},
-std::array<float,2>{0.00212822179f, 0.231569171f},
-std::array<float,2>{0.887231946f, 0.765795171f},
-std::array<float,2>{0.23148872f, 0.924936414f},
-std::array<float,2>{0.833142877f, 0.0780157223f},
-std::array<float,2>{0.331728488f, 0.466611505f},
-std::array<float,2>{0.553794146f, 0.537882566f},
-std::array<float,2>{0.184716135f, 0.685970962f},
-std::array<float,2>{0.774438739f, 0.349089414f},
-std::array<float,2>{0.27280882f, 0.164489537f},
-std::array<float,2>{0.58105725f, 0.868287563f},
-std::array<float,2>{0.417750597f, 0.988779724f},
-std::array<float,2>{0.633440256f, 0.0222286638f},
-std::array<float,2>{0.111430503f, 0.379020274f},
-std::array<float,2>{0.990291119f, 0.595131516f},
-std::array<float,2>{0.348727345f, 0.512485087f},
-std::array<float,2>{0.518073082f, 0.474990636f},
-std::array<float,2>{0.214261353f, 0.105566509f},
-std::array<float,2>{0.85828954f, 0.897100031f},
-std::array<float,2>{0.0324436575f, 0.782199562f},
-std::array<float,2>{0.930225909f, 0.213822499f},
-std::array<float,2>{0.455911905f, 0.307605237f},
-std::array<float,2>{0.734407663f, 0.74602735f},
-std::array<float,2>{0.22655794f, 0.576895535f},
-std::array<float,2>{0.8418172f, 0.416602075f},
-std::array<float,2>{0.338051498f, 0.0437376872f},
-std::array<float,2>{0.558513641f, 0.968327403f},
-std::array<float,2>{0.477147788f, 0.822821558f},
-std::array<float,2>{0.689394474f, 0.127561301f},
-std::array<float,2>{0.0122270444f, 0.314843982f},
-std::array<float,2>{0.880328774f, 0.640800774f},
-std::array<float,2>{0.293530941f, 0.710942566f},
-std::array<float,2>{0.618918836f, 0.255945027f},
-std::array<float,2>{0.148610264f, 0.24276334f},
-std::array<float,2>{0.782847583f, 0.757251501f},
-std::array<float,2>{0.063706845f, 0.919051349f},
-std::array<float,2>{0.943204343f, 0.0845577195f},
-std::array<float,2>{0.383116513f, 0.441782057f},
-std::array<float,2>{0.664017439f, 0.557874501f},
-std::array<float,2>{0.0440030731f, 0.669023633f},
-std::array<float,2>{0.923842549f, 0.372488648f},
-std::array<float,2>{0.464954257f, 0.178844616f},
-std::array<float,2>{0.746846795f, 0.856917381f},
-std::array<float,2>{0.358310074f, 0.974484384f},
-std::array<float,2>{0.527596533f, 0.00562429661f},
-std::array<float,2>{0.208975017f, 0.405326098f},
-std::array<float,2>{0.845112443f, 0.613129199f},
-std::array<float,2>{0.408434898f, 0.524291933f},
-std::array<float,2>{0.63259846f, 0.488088399f},
-std::array<float,2>{0.11849273f, 0.124715537f},
-std::array<float,2>{0.992878795f, 0.876849592f},
-std::array<float,2>{0.178667411f, 0.800326705f},
-std::array<float,2>{0.768240631f, 0.197941765f},
-std::array<float,2>{0.273556292f, 0.287671298f},
-std::array<float,2>{0.586363375f, 0.727581441f},
-std::array<float,2>{0.0962406546f, 0.534796596f},
-std::array<float,2>{0.977031946f, 0.462515175f},
-std::array<float,2>{0.431957215f, 0.0717821941f},
-std::array<float,2>{0.655735254f, 0.928919137f},
-std::array<float,2>{0.254048049f, 0.772656739f},
-std::array<float,2>{0.57767725f, 0.228858963f},
-std::array<float,2>{0.159119695f, 0.266747147f},
-std::array<float,2>{0.750104249f, 0.689185202f},
-std::array<float,2>{0.453072131f, 0.628357172f},
-std::array<float,2>{0.726432681f, 0.339507669f},
-std::array<float,2>{0.0524075814f, 0.14673157f},
-std::array<float,2>{0.91286248f, 0.840930581f},
-std::array<float,2>{0.187613517f, 0.946314752f},
-std::array<float,2>{0.871908844f, 0.0495232753f},
-std::array<float,2>{0.3725335f, 0.435877234f},
-std::array<float,2>{0.510696411f, 0.58301121f},
-std::array<float,2>{0.137721628f, 0.747666419f},
-std::array<float,2>{0.812363863f, 0.310387254f},
-std::array<float,2>{0.299289852f, 0.215402871f},
-std::array<float,2>{0.601713896f, 0.788941026f},
-std::array<float,2>{0.392456263f, 0.890789986f},
-std::array<float,2>{0.679907382f, 0.10438922f},
-std::array<float,2>{0.0906476602f, 0.472383887f},
-std::array<float,2>{0.956175089f, 0.510935843f},
-std::array<float,2>{0.325228214f, 0.59936589f},
-std::array<float,2>{0.542169273f, 0.375858992f},
-std::array<float,2>{0.241480231f, 0.0159206707f},
-std::array<float,2>{0.818000972f, 0.984642804f},
-std::array<float,2>{0.0220349561f, 0.871387124f},
-std::array<float,2>{0.904041767f, 0.168735579f},
-std::array<float,2>{0.496699154f, 0.343871385f},
-std::array<float,2>{0.707208216f, 0.68030262f},
-std::array<float,2>{0.166124552f, 0.50773561f},
-std::array<float,2>{0.758206487f, 0.482473522f},
-std::array<float,2>{0.264092565f, 0.0982487127f},
-std::array<float,2>{0.564186454f, 0.903691232f},
-std::array<float,2>{0.423343658f, 0.789221406f},
-std::array<float,2>{0.647604942f, 0.20511122f},
-std::array<float,2>{0.106344864f, 0.297684878f},
-std::array<float,2>{0.969958842f, 0.738022387f},
-std::array<float,2>{0.362956017f, 0.673173487f},
-std::array<float,2>{0.500716507f, 0.351794124f},
-std::array<float,2>{0.198876858f, 0.163085535f},
-std::array<float,2>{0.863960207f, 0.860489309f},
-std::array<float,2>{0.0624991842f, 0.998250723f},
-std::array<float,2>{0.918502152f, 0.0277589951f},
-std::array<float,2>{0.438019514f, 0.384046584f},
-std::array<float,2>{0.729657292f, 0.608770311f},
-std::array<float,2>{0.0782610476f, 0.696051896f},
-std::array<float,2>{0.96677351f, 0.274033904f},
-std::array<float,2>{0.403349519f, 0.22283031f},
-std::array<float,2>{0.677504897f, 0.777702272f},
-std::array<float,2>{0.310460687f, 0.930360794f},
-std::array<float,2>{0.600645423f, 0.0695454478f},
-std::array<float,2>{0.128934145f, 0.453744859f},
-std::array<float,2>{0.803931355f, 0.544620633f},
-std::array<float,2>{0.489036947f, 0.589596391f},
-std::array<float,2>{0.71634686f, 0.427774668f},
-std::array<float,2>{0.0254104026f, 0.0621016547f},
-std::array<float,2>{0.897291839f, 0.940637827f},
-std::array<float,2>{0.248740122f, 0.83095628f},
-std::array<float,2>{0.827883422f, 0.154442102f},
-std::array<float,2>{0.315701634f, 0.33569175f},
-std::array<float,2>{0.533270657f, 0.633387804f},
-std::array<float,2>{0.00692519546f, 0.620501101f},
-std::array<float,2>{0.883244872f, 0.397249669f},
-std::array<float,2>{0.471304148f, 0.0124525707f},
-std::array<float,2>{0.701151073f, 0.978890061f},
-std::array<float,2>{0.333071053f, 0.850014865f},
-std::array<float,2>{0.549222529f, 0.181855023f},
-std::array<float,2>{0.229756877f, 0.366865128f},
-std::array<float,2>{0.831642807f, 0.661524892f},
-std::array<float,2>{0.380370051f, 0.723856688f},
-std::array<float,2>{0.668449461f, 0.291836083f},
-std::array<float,2>{0.0706348494f, 0.18876873f},
-std::array<float,2>{0.950236619f, 0.810739517f},
-std::array<float,2>{0.145191684f, 0.883263886f},
-std::array<float,2>{0.795203626f, 0.113921955f},
-std::array<float,2>{0.287242353f, 0.493016273f},
-std::array<float,2>{0.616606593f, 0.515943468f},
-std::array<float,2>{0.218546942f, 0.65039742f},
-std::array<float,2>{0.853641391f, 0.326627582f},
-std::array<float,2>{0.345337152f, 0.136311859f},
-std::array<float,2>{0.521324158f, 0.814698279f},
-std::array<float,2>{0.457454383f, 0.955345929f},
-std::array<float,2>{0.741140008f, 0.0345825106f},
-std::array<float,2>{0.0372884795f, 0.411059201f},
-std::array<float,2>{0.934248328f, 0.565720141f},
-std::array<float,2>{0.267462105f, 0.552388072f},
-std::array<float,2>{0.582818449f, 0.449180663f},
-std::array<float,2>{0.18026948f, 0.086977005f},
-std::array<float,2>{0.778291225f, 0.909006119f},
-std::array<float,2>{0.11687126f, 0.762540817f},
-std::array<float,2>{0.987283409f, 0.236142963f},
-std::array<float,2>{0.419878364f, 0.25889644f},
-std::array<float,2>{0.63994503f, 0.703887105f},
-std::array<float,2>{0.172665223f, 0.593683124f},
-std::array<float,2>{0.77080071f, 0.425495058f},
-std::array<float,2>{0.278942019f, 0.0551125705f},
-std::array<float,2>{0.590615988f, 0.943639398f},
-std::array<float,2>{0.413316995f, 0.832590282f},
-std::array<float,2>{0.627318501f, 0.149511099f},
-std::array<float,2>{0.12485189f, 0.330235928f},
-std::array<float,2>{0.99676621f, 0.638827741f},
-std::array<float,2>{0.353267133f, 0.702682793f},
-std::array<float,2>{0.524917901f, 0.278081924f},
-std::array<float,2>{0.205851927f, 0.219444826f},
-std::array<float,2>{0.851229787f, 0.775147736f},
-std::array<float,2>{0.0406325422f, 0.935380697f},
-std::array<float,2>{0.927385569f, 0.0643741637f},
-std::array<float,2>{0.463896006f, 0.459775567f},
-std::array<float,2>{0.742969155f, 0.540387571f},
-std::array<float,2>{0.0677464604f, 0.676130593f},
-std::array<float,2>{0.939307809f, 0.357042342f},
-std::array<float,2>{0.386891186f, 0.158245802f},
-std::array<float,2>{0.657033384f, 0.866559803f},
-std::array<float,2>{0.292063296f, 0.99254334f},
-std::array<float,2>{0.621402025f, 0.0251808576f},
-std::array<float,2>{0.154477492f, 0.388903439f},
-std::array<float,2>{0.787933469f, 0.602004647f},
-std::array<float,2>{0.481780559f, 0.501381993f},
-std::array<float,2>{0.693384826f, 0.478978515f},
-std::array<float,2>{0.00846365746f, 0.0973543003f},
-std::array<float,2>{0.878183722f, 0.900008976f},
-std::array<float,2>{0.219458789f, 0.793236911f},
-std::array<float,2>{0.838253796f, 0.209118992f},
-std::array<float,2>{0.339997202f, 0.303566694f},
-std::array<float,2>{0.559157133f, 0.739144802f},
-std::array<float,2>{0.0169636291f, 0.550195575f},
-std::array<float,2>{0.899488747f, 0.453040481f},
-std::array<float,2>{0.493337214f, 0.0920776129f},
-std::array<float,2>{0.703605592f, 0.912436962f},
-std::array<float,2>{0.323846966f, 0.760291636f},
-std::array<float,2>{0.543515801f, 0.238320842f},
-std::array<float,2>{0.238117144f, 0.261858881f},
-std::array<float,2>{0.81418395f, 0.70898217f},
-std::array<float,2>{0.396385193f, 0.654141724f},
-std::array<float,2>{0.686943471f, 0.320528656f},
-std::array<float,2>{0.088523373f, 0.138014346f},
-std::array<float,2>{0.958806813f, 0.818726718f},
-std::array<float,2>{0.135558724f, 0.95717752f},
-std::array<float,2>{0.805735946f, 0.0353337415f},
-std::array<float,2>{0.304631352f, 0.408638954f},
-std::array<float,2>{0.606765449f, 0.567132473f},
-std::array<float,2>{0.1933323f, 0.718755245f},
-std::array<float,2>{0.868546188f, 0.294359773f},
-std::array<float,2>{0.367215514f, 0.193067521f},
-std::array<float,2>{0.51318264f, 0.804891586f},
-std::array<float,2>{0.447357863f, 0.889585614f},
-std::array<float,2>{0.722104192f, 0.112679638f},
-std::array<float,2>{0.0491438359f, 0.497344315f},
-std::array<float,2>{0.906524658f, 0.522520363f},
-std::array<float,2>{0.250958264f, 0.622965395f},
-std::array<float,2>{0.572502494f, 0.39274171f},
-std::array<float,2>{0.163694069f, 0.0116021084f},
-std::array<float,2>{0.754321098f, 0.981048107f},
-std::array<float,2>{0.10062708f, 0.845929801f},
-std::array<float,2>{0.981588006f, 0.185309708f},
-std::array<float,2>{0.435638458f, 0.363104522f},
-std::array<float,2>{0.648906648f, 0.656523407f},
-std::array<float,2>{0.244231284f, 0.527722955f},
-std::array<float,2>{0.823218405f, 0.491346657f},
-std::array<float,2>{0.318366766f, 0.119240142f},
-std::array<float,2>{0.538563132f, 0.881261945f},
-std::array<float,2>{0.485224098f, 0.804643631f},
-std::array<float,2>{0.711168587f, 0.20153892f},
-std::array<float,2>{0.029759312f, 0.281642079f},
-std::array<float,2>{0.894141376f, 0.733064353f},
-std::array<float,2>{0.307805479f, 0.666669309f},
-std::array<float,2>{0.594856262f, 0.367259562f},
-std::array<float,2>{0.125840113f, 0.172175959f},
-std::array<float,2>{0.800333738f, 0.852666557f},
-std::array<float,2>{0.0837809518f, 0.971616447f},
-std::array<float,2>{0.961794496f, 0.00151627767f},
-std::array<float,2>{0.400397956f, 0.398658127f},
-std::array<float,2>{0.672887504f, 0.616897166f},
-std::array<float,2>{0.0579265729f, 0.717155516f},
-std::array<float,2>{0.917076588f, 0.253180593f},
-std::array<float,2>{0.44269827f, 0.249258921f},
-std::array<float,2>{0.732104301f, 0.753369153f},
-std::array<float,2>{0.366252571f, 0.915807307f},
-std::array<float,2>{0.504835308f, 0.0790386871f},
-std::array<float,2>{0.202638775f, 0.440468043f},
-std::array<float,2>{0.860747874f, 0.559070826f},
-std::array<float,2>{0.428685009f, 0.571009338f},
-std::array<float,2>{0.644231498f, 0.419325382f},
-std::array<float,2>{0.103018954f, 0.0398475826f},
-std::array<float,2>{0.973419785f, 0.96417588f},
-std::array<float,2>{0.169464573f, 0.824835956f},
-std::array<float,2>{0.761826336f, 0.129464835f},
-std::array<float,2>{0.257839143f, 0.317287385f},
-std::array<float,2>{0.567764401f, 0.645639837f},
-std::array<float,2>{0.110254623f, 0.596167147f},
-std::array<float,2>{0.988924384f, 0.381328642f},
-std::array<float,2>{0.414277136f, 0.0210753903f},
-std::array<float,2>{0.636048615f, 0.991554856f},
-std::array<float,2>{0.271391928f, 0.869532585f},
-std::array<float,2>{0.579384685f, 0.167616189f},
-std::array<float,2>{0.18625614f, 0.350138515f},
-std::array<float,2>{0.776538312f, 0.685438454f},
-std::array<float,2>{0.454500973f, 0.742738783f},
-std::array<float,2>{0.73718524f, 0.305771738f},
-std::array<float,2>{0.0343035199f, 0.211664051f},
-std::array<float,2>{0.933497429f, 0.784817874f},
-std::array<float,2>{0.211764678f, 0.896100402f},
-std::array<float,2>{0.856729507f, 0.108925946f},
-std::array<float,2>{0.350711346f, 0.474208295f},
-std::array<float,2>{0.51706171f, 0.515256941f},
-std::array<float,2>{0.141363606f, 0.632731795f},
-std::array<float,2>{0.790340424f, 0.341710418f},
-std::array<float,2>{0.281946778f, 0.141292766f},
-std::array<float,2>{0.612039089f, 0.838759482f},
-std::array<float,2>{0.376291096f, 0.951441109f},
-std::array<float,2>{0.667350948f, 0.052406542f},
-std::array<float,2>{0.074227713f, 0.433070749f},
-std::array<float,2>{0.947831869f, 0.579859734f},
-std::array<float,2>{0.328193575f, 0.536378324f},
-std::array<float,2>{0.55145067f, 0.467503637f},
-std::array<float,2>{0.233766809f, 0.0755225047f},
-std::array<float,2>{0.835524976f, 0.923732877f},
-std::array<float,2>{0.00104768423f, 0.767813087f},
-std::array<float,2>{0.889477372f, 0.233126342f},
-std::array<float,2>{0.476269633f, 0.272970051f},
-std::array<float,2>{0.696565151f, 0.692106605f},
-std::array<float,2>{0.210562512f, 0.609567523f},
-std::array<float,2>{0.845853806f, 0.403557926f},
-std::array<float,2>{0.357361287f, 0.00648773368f},
-std::array<float,2>{0.529613018f, 0.975983083f},
-std::array<float,2>{0.467983723f, 0.858948171f},
-std::array<float,2>{0.748175085f, 0.17586112f},
-std::array<float,2>{0.0451488979f, 0.373121291f},
-std::array<float,2>{0.92259258f, 0.669978261f},
-std::array<float,2>{0.27559942f, 0.730389893f},
-std::array<float,2>{0.589072704f, 0.285533071f},
-std::array<float,2>{0.177600712f, 0.196398228f},
-std::array<float,2>{0.76657629f, 0.797338307f},
-std::array<float,2>{0.12100435f, 0.878409445f},
-std::array<float,2>{0.994903624f, 0.122859143f},
-std::array<float,2>{0.406437248f, 0.484563529f},
-std::array<float,2>{0.630054772f, 0.527326226f},
-std::array<float,2>{0.0144663099f, 0.642733574f},
-std::array<float,2>{0.881728351f, 0.313924253f},
-std::array<float,2>{0.480369091f, 0.125617132f},
-std::array<float,2>{0.690231144f, 0.822006822f},
-std::array<float,2>{0.337257713f, 0.966242492f},
-std::array<float,2>{0.556612313f, 0.0467970558f},
-std::array<float,2>{0.223714918f, 0.414992839f},
-std::array<float,2>{0.841723084f, 0.575234234f},
-std::array<float,2>{0.3865619f, 0.556338012f},
-std::array<float,2>{0.661884189f, 0.443577141f},
-std::array<float,2>{0.0663527995f, 0.0822990537f},
-std::array<float,2>{0.944970608f, 0.9200598f},
-std::array<float,2>{0.152133852f, 0.755840242f},
-std::array<float,2>{0.784975827f, 0.2444015f},
-std::array<float,2>{0.295901686f, 0.253970146f},
-std::array<float,2>{0.620511293f, 0.714398384f},
-std::array<float,2>{0.0936118141f, 0.508108675f},
-std::array<float,2>{0.953981996f, 0.470007509f},
-std::array<float,2>{0.393485755f, 0.102038763f},
-std::array<float,2>{0.682656467f, 0.893523991f},
-std::array<float,2>{0.297204792f, 0.786236703f},
-std::array<float,2>{0.604121923f, 0.218164101f},
-std::array<float,2>{0.139747873f, 0.311852187f},
-std::array<float,2>{0.808980227f, 0.74932909f},
-std::array<float,2>{0.498711705f, 0.683298647f},
-std::array<float,2>{0.71068716f, 0.346214235f},
-std::array<float,2>{0.0201384705f, 0.171695679f},
-std::array<float,2>{0.904982328f, 0.87419951f},
-std::array<float,2>{0.240014493f, 0.987314939f},
-std::array<float,2>{0.818490446f, 0.0182934068f},
-std::array<float,2>{0.326536447f, 0.377056748f},
-std::array<float,2>{0.539601207f, 0.601046324f},
-std::array<float,2>{0.157443017f, 0.691398501f},
-std::array<float,2>{0.752723396f, 0.269108713f},
-std::array<float,2>{0.256220281f, 0.228263006f},
-std::array<float,2>{0.576012671f, 0.77087301f},
-std::array<float,2>{0.430294842f, 0.926954389f},
-std::array<float,2>{0.6542449f, 0.0730584636f},
-std::array<float,2>{0.0940943509f, 0.464530259f},
-std::array<float,2>{0.980204165f, 0.532742143f},
-std::array<float,2>{0.374741912f, 0.584602773f},
-std::array<float,2>{0.50822109f, 0.435075015f},
-std::array<float,2>{0.191236123f, 0.0471662432f},
-std::array<float,2>{0.873866916f, 0.947410285f},
-std::array<float,2>{0.05419451f, 0.843181849f},
-std::array<float,2>{0.912027121f, 0.146225959f},
-std::array<float,2>{0.449221373f, 0.336604565f},
-std::array<float,2>{0.724059463f, 0.625405848f},
-std::array<float,2>{0.13179633f, 0.546423852f},
-std::array<float,2>{0.801829875f, 0.456268817f},
-std::array<float,2>{0.312350512f, 0.0681980848f},
-std::array<float,2>{0.598829091f, 0.932231307f},
-std::array<float,2>{0.405286044f, 0.780929804f},
-std::array<float,2>{0.678052366f, 0.226450369f},
-std::array<float,2>{0.0803184658f, 0.275961876f},
-std::array<float,2>{0.968720555f, 0.698547006f},
-std::array<float,2>{0.314109504f, 0.636604965f},
-std::array<float,2>{0.531881094f, 0.332285345f},
-std::array<float,2>{0.246118918f, 0.153953135f},
-std::array<float,2>{0.826072574f, 0.829838097f},
-std::array<float,2>{0.02470324f, 0.938783586f},
-std::array<float,2>{0.896156013f, 0.0603418835f},
-std::array<float,2>{0.491648823f, 0.426077515f},
-std::array<float,2>{0.718674839f, 0.587652028f},
-std::array<float,2>{0.108845361f, 0.735948503f},
-std::array<float,2>{0.971440315f, 0.298847079f},
-std::array<float,2>{0.424327672f, 0.205058873f},
-std::array<float,2>{0.645793974f, 0.792525768f},
-std::array<float,2>{0.262842715f, 0.905533493f},
-std::array<float,2>{0.564611852f, 0.100277491f},
-std::array<float,2>{0.165418282f, 0.481948465f},
-std::array<float,2>{0.760307133f, 0.504388809f},
-std::array<float,2>{0.441396117f, 0.606672347f},
-std::array<float,2>{0.72677207f, 0.385929853f},
-std::array<float,2>{0.0597520731f, 0.0305282343f},
-std::array<float,2>{0.921449602f, 0.997208118f},
-std::array<float,2>{0.196593374f, 0.86242795f},
-std::array<float,2>{0.865492642f, 0.161630839f},
-std::array<float,2>{0.360131085f, 0.354815036f},
-std::array<float,2>{0.50340271f, 0.674092948f},
-std::array<float,2>{0.0359339342f, 0.563929617f},
-std::array<float,2>{0.935809195f, 0.412896395f},
-std::array<float,2>{0.460446298f, 0.033145979f},
-std::array<float,2>{0.739374876f, 0.954218507f},
-std::array<float,2>{0.347401857f, 0.813907504f},
-std::array<float,2>{0.521537602f, 0.134184614f},
-std::array<float,2>{0.21554248f, 0.325643778f},
-std::array<float,2>{0.852054179f, 0.649637878f},
-std::array<float,2>{0.420619696f, 0.705469012f},
-std::array<float,2>{0.637704134f, 0.261267394f},
-std::array<float,2>{0.113516398f, 0.237772182f},
-std::array<float,2>{0.984623373f, 0.764473379f},
-std::array<float,2>{0.182400107f, 0.906441808f},
-std::array<float,2>{0.779678524f, 0.0891769379f},
-std::array<float,2>{0.269206554f, 0.447207779f},
-std::array<float,2>{0.585828602f, 0.552864075f},
-std::array<float,2>{0.227347106f, 0.663201988f},
-std::array<float,2>{0.829152644f, 0.364831358f},
-std::array<float,2>{0.334669769f, 0.180288777f},
-std::array<float,2>{0.547441542f, 0.849096239f},
-std::array<float,2>{0.468759984f, 0.976695836f},
-std::array<float,2>{0.701451838f, 0.0149183227f},
-std::array<float,2>{0.00552932732f, 0.395199329f},
-std::array<float,2>{0.886173964f, 0.618448496f},
-std::array<float,2>{0.286714137f, 0.518344641f},
-std::array<float,2>{0.615086973f, 0.494754553f},
-std::array<float,2>{0.147171706f, 0.116089851f},
-std::array<float,2>{0.793290198f, 0.886562884f},
-std::array<float,2>{0.0732180253f, 0.810351968f},
-std::array<float,2>{0.951316535f, 0.190366864f},
-std::array<float,2>{0.381990105f, 0.289666206f},
-std::array<float,2>{0.670342326f, 0.725288868f},
-std::array<float,2>{0.143902257f, 0.579240263f},
-std::array<float,2>{0.791965067f, 0.433306187f},
-std::array<float,2>{0.284095049f, 0.0519314222f},
-std::array<float,2>{0.609870911f, 0.952008665f},
-std::array<float,2>{0.377996922f, 0.838286638f},
-std::array<float,2>{0.664493978f, 0.140829563f},
-std::array<float,2>{0.0779828802f, 0.340833545f},
-std::array<float,2>{0.946608305f, 0.632101893f},
-std::array<float,2>{0.331329852f, 0.691874027f},
-std::array<float,2>{0.554599464f, 0.272693664f},
-std::array<float,2>{0.232201874f, 0.232904673f},
-std::array<float,2>{0.833830595f, 0.768123925f},
-std::array<float,2>{0.00267674052f, 0.923107803f},
-std::array<float,2>{0.887020528f, 0.0758871362f},
-std::array<float,2>{0.472777545f, 0.466867507f},
-std::array<float,2>{0.697295249f, 0.536967516f},
-std::array<float,2>{0.111846484f, 0.684719205f},
-std::array<float,2>{0.99095875f, 0.349991441f},
-std::array<float,2>{0.417241037f, 0.167368099f},
-std::array<float,2>{0.633108854f, 0.869799316f},
-std::array<float,2>{0.272958159f, 0.991830528f},
-std::array<float,2>{0.58195442f, 0.0206174478f},
-std::array<float,2>{0.185423464f, 0.381802976f},
-std::array<float,2>{0.774920881f, 0.596479118f},
-std::array<float,2>{0.455372423f, 0.515004396f},
-std::array<float,2>{0.735249519f, 0.473744333f},
-std::array<float,2>{0.0330874175f, 0.108635396f},
-std::array<float,2>{0.929888427f, 0.895653069f},
-std::array<float,2>{0.214593142f, 0.784565091f},
-std::array<float,2>{0.85779947f, 0.211320266f},
-std::array<float,2>{0.349263549f, 0.306374341f},
-std::array<float,2>{0.517895281f, 0.742463708f},
-std::array<float,2>{0.0551564507f, 0.559406281f},
-std::array<float,2>{0.915594161f, 0.441304475f},
-std::array<float,2>{0.445187628f, 0.0782430544f},
-std::array<float,2>{0.732563853f, 0.915516019f},
-std::array<float,2>{0.364408582f, 0.753741503f},
-std::array<float,2>{0.505964816f, 0.249805853f},
-std::array<float,2>{0.200654849f, 0.253735542f},
-std::array<float,2>{0.861627877f, 0.717367828f},
-std::array<float,2>{0.426833689f, 0.646042407f},
-std::array<float,2>{0.641132712f, 0.316469103f},
-std::array<float,2>{0.103794873f, 0.129162207f},
-std::array<float,2>{0.975915134f, 0.824299514f},
-std::array<float,2>{0.171378911f, 0.964671969f},
-std::array<float,2>{0.763967156f, 0.039324224f},
-std::array<float,2>{0.26013732f, 0.419658214f},
-std::array<float,2>{0.568904161f, 0.5703125f},
-std::array<float,2>{0.242808759f, 0.732547164f},
-std::array<float,2>{0.821455181f, 0.282094806f},
-std::array<float,2>{0.316602409f, 0.201808408f},
-std::array<float,2>{0.535941839f, 0.803902388f},
-std::array<float,2>{0.487750679f, 0.881458759f},
-std::array<float,2>{0.713907003f, 0.119708635f},
-std::array<float,2>{0.0279982015f, 0.491962045f},
-std::array<float,2>{0.891529739f, 0.527907073f},
-std::array<float,2>{0.306220025f, 0.616606176f},
-std::array<float,2>{0.59604907f, 0.399390668f},
-std::array<float,2>{0.128899336f, 0.00103128282f},
-std::array<float,2>{0.798713684f, 0.970931709f},
-std::array<float,2>{0.0840101838f, 0.853132546f},
-std::array<float,2>{0.963497758f, 0.172439218f},
-std::array<float,2>{0.400026679f, 0.367730826f},
-std::array<float,2>{0.674113929f, 0.666237593f},
-std::array<float,2>{0.193488106f, 0.523359895f},
-std::array<float,2>{0.870637596f, 0.497580707f},
-std::array<float,2>{0.370448887f, 0.11285004f},
-std::array<float,2>{0.514549851f, 0.888690114f},
-std::array<float,2>{0.446402043f, 0.805479646f},
-std::array<float,2>{0.719679952f, 0.192793652f},
-std::array<float,2>{0.0485269204f, 0.294619352f},
-std::array<float,2>{0.908596337f, 0.719700098f},
-std::array<float,2>{0.252818584f, 0.657030702f},
-std::array<float,2>{0.570581913f, 0.362727404f},
-std::array<float,2>{0.162015721f, 0.184995413f},
-std::array<float,2>{0.757374763f, 0.846578777f},
-std::array<float,2>{0.0981920883f, 0.980588377f},
-std::array<float,2>{0.983293712f, 0.0107444115f},
-std::array<float,2>{0.434857041f, 0.39351058f},
-std::array<float,2>{0.652201653f, 0.622253358f},
-std::array<float,2>{0.0176466424f, 0.708247304f},
-std::array<float,2>{0.900530696f, 0.262478054f},
-std::array<float,2>{0.495356768f, 0.239055872f},
-std::array<float,2>{0.705411911f, 0.760065377f},
-std::array<float,2>{0.321653694f, 0.912668645f},
-std::array<float,2>{0.546697497f, 0.092514351f},
-std::array<float,2>{0.235037595f, 0.452526152f},
-std::array<float,2>{0.815955579f, 0.550716162f},
-std::array<float,2>{0.397563845f, 0.56642586f},
-std::array<float,2>{0.683981121f, 0.409109175f},
-std::array<float,2>{0.0872366279f, 0.0360842235f},
-std::array<float,2>{0.959174275f, 0.957912266f},
-std::array<float,2>{0.13467297f, 0.818912685f},
-std::array<float,2>{0.806883574f, 0.138189539f},
-std::array<float,2>{0.301951736f, 0.320833772f},
-std::array<float,2>{0.608471155f, 0.653345823f},
-std::array<float,2>{0.0688724369f, 0.60242486f},
-std::array<float,2>{0.940550089f, 0.389183551f},
-std::array<float,2>{0.389157504f, 0.0246168822f},
-std::array<float,2>{0.658260345f, 0.993163824f},
-std::array<float,2>{0.29017356f, 0.866936088f},
-std::array<float,2>{0.623366535f, 0.15900971f},
-std::array<float,2>{0.15428412f, 0.356696516f},
-std::array<float,2>{0.787085056f, 0.676288426f},
-std::array<float,2>{0.482609749f, 0.73844707f},
-std::array<float,2>{0.691752434f, 0.302985638f},
-std::array<float,2>{0.0116346618f, 0.209584415f},
-std::array<float,2>{0.875514627f, 0.793926835f},
-std::array<float,2>{0.220993653f, 0.899559319f},
-std::array<float,2>{0.837135971f, 0.0968387946f},
-std::array<float,2>{0.342303544f, 0.479435235f},
-std::array<float,2>{0.561857283f, 0.501473606f},
-std::array<float,2>{0.174787879f, 0.639239192f},
-std::array<float,2>{0.771686614f, 0.330593556f},
-std::array<float,2>{0.27984336f, 0.149920136f},
-std::array<float,2>{0.592177033f, 0.832275927f},
-std::array<float,2>{0.411678046f, 0.944281876f},
-std::array<float,2>{0.625445366f, 0.0555011854f},
-std::array<float,2>{0.121337302f, 0.425057083f},
-std::array<float,2>{0.998757005f, 0.593046427f},
-std::array<float,2>{0.353754282f, 0.540880084f},
-std::array<float,2>{0.52571243f, 0.459081829f},
-std::array<float,2>{0.203604281f, 0.063925229f},
-std::array<float,2>{0.848128617f, 0.934714198f},
-std::array<float,2>{0.0411058404f, 0.774802327f},
-std::array<float,2>{0.927969992f, 0.2191948f},
-std::array<float,2>{0.462671846f, 0.277523279f},
-std::array<float,2>{0.745152414f, 0.702332795f},
-std::array<float,2>{0.230284855f, 0.618748724f},
-std::array<float,2>{0.831429124f, 0.394566327f},
-std::array<float,2>{0.333956897f, 0.0154483337f},
-std::array<float,2>{0.549419105f, 0.977333426f},
-std::array<float,2>{0.471051067f, 0.849601328f},
-std::array<float,2>{0.700496912f, 0.180132166f},
-std::array<float,2>{0.00749775209f, 0.364740044f},
-std::array<float,2>{0.883569539f, 0.663744748f},
-std::array<float,2>{0.287962258f, 0.724967062f},
-std::array<float,2>{0.616828978f, 0.289217889f},
-std::array<float,2>{0.144945934f, 0.189878464f},
-std::array<float,2>{0.795564771f, 0.809972286f},
-std::array<float,2>{0.070922941f, 0.886134207f},
-std::array<float,2>{0.951069295f, 0.115497641f},
-std::array<float,2>{0.380646229f, 0.494240314f},
-std::array<float,2>{0.668705761f, 0.517689049f},
-std::array<float,2>{0.0380581766f, 0.650057554f},
-std::array<float,2>{0.933739126f, 0.325832903f},
-std::array<float,2>{0.457715541f, 0.134292558f},
-std::array<float,2>{0.740363657f, 0.814332187f},
-std::array<float,2>{0.344855428f, 0.954824209f},
-std::array<float,2>{0.520939112f, 0.0322703905f},
-std::array<float,2>{0.217920586f, 0.41258508f},
-std::array<float,2>{0.854151011f, 0.564096987f},
-std::array<float,2>{0.419219077f, 0.553263664f},
-std::array<float,2>{0.6404019f, 0.446759462f},
-std::array<float,2>{0.116440788f, 0.0894097015f},
-std::array<float,2>{0.98635596f, 0.906843126f},
-std::array<float,2>{0.179989457f, 0.76384896f},
-std::array<float,2>{0.777609706f, 0.237818345f},
-std::array<float,2>{0.266619503f, 0.260789126f},
-std::array<float,2>{0.582353532f, 0.705932915f},
-std::array<float,2>{0.105561733f, 0.504553556f},
-std::array<float,2>{0.970262468f, 0.481772155f},
-std::array<float,2>{0.422886848f, 0.0997128263f},
-std::array<float,2>{0.648061514f, 0.906048417f},
-std::array<float,2>{0.264426291f, 0.792075515f},
-std::array<float,2>{0.56349194f, 0.204322383f},
-std::array<float,2>{0.166563481f, 0.299321085f},
-std::array<float,2>{0.758496165f, 0.735573888f},
-std::array<float,2>{0.437853605f, 0.674468458f},
-std::array<float,2>{0.730059206f, 0.355009496f},
-std::array<float,2>{0.0619780906f, 0.161360383f},
-std::array<float,2>{0.918393552f, 0.863175452f},
-std::array<float,2>{0.198316798f, 0.997733772f},
-std::array<float,2>{0.863544047f, 0.0309434123f},
-std::array<float,2>{0.362757772f, 0.386388898f},
-std::array<float,2>{0.500046074f, 0.607058287f},
-std::array<float,2>{0.12987496f, 0.698873818f},
-std::array<float,2>{0.804445982f, 0.27547437f},
-std::array<float,2>{0.309986979f, 0.225872427f},
-std::array<float,2>{0.601259589f, 0.780501008f},
-std::array<float,2>{0.404230267f, 0.931679904f},
-std::array<float,2>{0.676992655f, 0.0674404651f},
-std::array<float,2>{0.0786190033f, 0.456872195f},
-std::array<float,2>{0.966043174f, 0.545912325f},
-std::array<float,2>{0.316321373f, 0.587162077f},
-std::array<float,2>{0.534107447f, 0.426326096f},
-std::array<float,2>{0.248476624f, 0.0596412197f},
-std::array<float,2>{0.827260017f, 0.93917501f},
-std::array<float,2>{0.0262211114f, 0.829280555f},
-std::array<float,2>{0.896953404f, 0.153381124f},
-std::array<float,2>{0.488427788f, 0.332594067f},
-std::array<float,2>{0.715895891f, 0.635768771f},
-std::array<float,2>{0.158340842f, 0.532449603f},
-std::array<float,2>{0.750753999f, 0.463890314f},
-std::array<float,2>{0.254621029f, 0.072287038f},
-std::array<float,2>{0.577155173f, 0.927625775f},
-std::array<float,2>{0.432502657f, 0.771221578f},
-std::array<float,2>{0.656101227f, 0.227829337f},
-std::array<float,2>{0.0961583257f, 0.268801033f},
-std::array<float,2>{0.977090478f, 0.69045496f},
-std::array<float,2>{0.372616053f, 0.62560302f},
-std::array<float,2>{0.510192931f, 0.33600688f},
-std::array<float,2>{0.188045606f, 0.145818546f},
-std::array<float,2>{0.871476114f, 0.843627214f},
-std::array<float,2>{0.0517786629f, 0.948111236f},
-std::array<float,2>{0.912315726f, 0.0476815403f},
-std::array<float,2>{0.452471107f, 0.434630185f},
-std::array<float,2>{0.725712955f, 0.58419466f},
-std::array<float,2>{0.0899111032f, 0.749535203f},
-std::array<float,2>{0.95674479f, 0.312306732f},
-std::array<float,2>{0.39205575f, 0.218666732f},
-std::array<float,2>{0.680431664f, 0.78678745f},
-std::array<float,2>{0.299679399f, 0.892988265f},
-std::array<float,2>{0.602485776f, 0.102452368f},
-std::array<float,2>{0.13828142f, 0.470374793f},
-std::array<float,2>{0.81199199f, 0.508423209f},
-std::array<float,2>{0.496204436f, 0.60148406f},
-std::array<float,2>{0.707669199f, 0.377865136f},
-std::array<float,2>{0.0216921512f, 0.017842222f},
-std::array<float,2>{0.90367806f, 0.988188446f},
-std::array<float,2>{0.242055103f, 0.874797165f},
-std::array<float,2>{0.817529559f, 0.171182811f},
-std::array<float,2>{0.326077878f, 0.345883787f},
-std::array<float,2>{0.542774081f, 0.68308109f},
-std::array<float,2>{0.0120829195f, 0.576109827f},
-std::array<float,2>{0.880399048f, 0.414366364f},
-std::array<float,2>{0.476645947f, 0.0462234616f},
-std::array<float,2>{0.688579023f, 0.966454029f},
-std::array<float,2>{0.338381261f, 0.821676016f},
-std::array<float,2>{0.55805248f, 0.125095651f},
-std::array<float,2>{0.22585994f, 0.31398353f},
-std::array<float,2>{0.842377663f, 0.643361747f},
-std::array<float,2>{0.383569002f, 0.713974655f},
-std::array<float,2>{0.663564742f, 0.254559278f},
-std::array<float,2>{0.0640361682f, 0.24482736f},
-std::array<float,2>{0.942463219f, 0.755053282f},
-std::array<float,2>{0.149046257f, 0.920788169f},
-std::array<float,2>{0.782705605f, 0.0827302933f},
-std::array<float,2>{0.29302457f, 0.443893433f},
-std::array<float,2>{0.618376076f, 0.556054831f},
-std::array<float,2>{0.208181605f, 0.670844197f},
-std::array<float,2>{0.8456707f, 0.373629361f},
-std::array<float,2>{0.357683837f, 0.176361054f},
-std::array<float,2>{0.528230548f, 0.858830512f},
-std::array<float,2>{0.465702355f, 0.976237357f},
-std::array<float,2>{0.746168911f, 0.00626053661f},
-std::array<float,2>{0.0446963198f, 0.40394029f},
-std::array<float,2>{0.924763143f, 0.609994292f},
-std::array<float,2>{0.274171084f, 0.526523411f},
-std::array<float,2>{0.586676538f, 0.485202134f},
-std::array<float,2>{0.178096578f, 0.122335777f},
-std::array<float,2>{0.76801157f, 0.87863791f},
-std::array<float,2>{0.119139142f, 0.797563076f},
-std::array<float,2>{0.992453933f, 0.197232306f},
-std::array<float,2>{0.409121692f, 0.28606534f},
-std::array<float,2>{0.632243991f, 0.729955316f},
-std::array<float,2>{0.185982049f, 0.595514297f},
-std::array<float,2>{0.776866496f, 0.3797203f},
-std::array<float,2>{0.270691365f, 0.0218287595f},
-std::array<float,2>{0.580038309f, 0.988711059f},
-std::array<float,2>{0.414965868f, 0.868972659f},
-std::array<float,2>{0.636234403f, 0.164692521f},
-std::array<float,2>{0.109857425f, 0.34925738f},
-std::array<float,2>{0.988529801f, 0.68638885f},
-std::array<float,2>{0.351293385f, 0.745237887f},
-std::array<float,2>{0.517503917f, 0.307092667f},
-std::array<float,2>{0.211320937f, 0.213222787f},
-std::array<float,2>{0.85706836f, 0.781532526f},
-std::array<float,2>{0.035057988f, 0.896933377f},
-std::array<float,2>{0.933013916f, 0.10634245f},
-std::array<float,2>{0.455001652f, 0.475558937f},
-std::array<float,2>{0.736501992f, 0.512009144f},
-std::array<float,2>{0.0750092492f, 0.630543947f},
-std::array<float,2>{0.947707653f, 0.342814505f},
-std::array<float,2>{0.3766056f, 0.143926561f},
-std::array<float,2>{0.667590559f, 0.836408675f},
-std::array<float,2>{0.281515956f, 0.951161325f},
-std::array<float,2>{0.611453295f, 0.0534373f},
-std::array<float,2>{0.140972823f, 0.430086762f},
-std::array<float,2>{0.790653646f, 0.581358433f},
-std::array<float,2>{0.475878686f, 0.537176251f},
-std::array<float,2>{0.696835756f, 0.466091901f},
-std::array<float,2>{0.00168797816f, 0.0771629438f},
-std::array<float,2>{0.888687015f, 0.925757766f},
-std::array<float,2>{0.233957499f, 0.766298234f},
-std::array<float,2>{0.835262597f, 0.232022822f},
-std::array<float,2>{0.328760803f, 0.271400392f},
-std::array<float,2>{0.550926864f, 0.694847882f},
-std::array<float,2>{0.0302474052f, 0.529505968f},
-std::array<float,2>{0.893844426f, 0.488480896f},
-std::array<float,2>{0.484841079f, 0.118388996f},
-std::array<float,2>{0.711903989f, 0.880236804f},
-std::array<float,2>{0.31918627f, 0.802178323f},
-std::array<float,2>{0.538676739f, 0.200698003f},
-std::array<float,2>{0.244916886f, 0.284575045f},
-std::array<float,2>{0.822725594f, 0.731486976f},
-std::array<float,2>{0.400961965f, 0.664547741f},
-std::array<float,2>{0.673377156f, 0.370622545f},
-std::array<float,2>{0.0830642879f, 0.175204143f},
-std::array<float,2>{0.961160779f, 0.854378104f},
-std::array<float,2>{0.125476927f, 0.969101071f},
-std::array<float,2>{0.80019623f, 0.00367521774f},
-std::array<float,2>{0.3084912f, 0.401493847f},
-std::array<float,2>{0.595579982f, 0.614943504f},
-std::array<float,2>{0.202528641f, 0.716785431f},
-std::array<float,2>{0.861319423f, 0.250106812f},
-std::array<float,2>{0.366798997f, 0.246981487f},
-std::array<float,2>{0.504131973f, 0.750072002f},
-std::array<float,2>{0.443338662f, 0.916506648f},
-std::array<float,2>{0.731455863f, 0.0818119571f},
-std::array<float,2>{0.0585197657f, 0.437608182f},
-std::array<float,2>{0.917586505f, 0.560603499f},
-std::array<float,2>{0.258672953f, 0.574006259f},
-std::array<float,2>{0.568019688f, 0.420170128f},
-std::array<float,2>{0.169091821f, 0.0422288515f},
-std::array<float,2>{0.762277782f, 0.961525619f},
-std::array<float,2>{0.103372455f, 0.826535761f},
-std::array<float,2>{0.973034263f, 0.131125823f},
-std::array<float,2>{0.427963316f, 0.320001453f},
-std::array<float,2>{0.643678367f, 0.648076952f},
-std::array<float,2>{0.237643898f, 0.547105372f},
-std::array<float,2>{0.813577831f, 0.449625939f},
-std::array<float,2>{0.323348016f, 0.0904354677f},
-std::array<float,2>{0.543081939f, 0.910932124f},
-std::array<float,2>{0.493929952f, 0.758260906f},
-std::array<float,2>{0.703844011f, 0.241729543f},
-std::array<float,2>{0.0175368413f, 0.265395015f},
-std::array<float,2>{0.900223672f, 0.709689915f},
-std::array<float,2>{0.303916872f, 0.655281246f},
-std::array<float,2>{0.607046843f, 0.32387951f},
-std::array<float,2>{0.135151282f, 0.140149102f},
-std::array<float,2>{0.806283653f, 0.817962766f},
-std::array<float,2>{0.0883445367f, 0.960769176f},
-std::array<float,2>{0.958310902f, 0.0378163531f},
-std::array<float,2>{0.395978808f, 0.407570601f},
-std::array<float,2>{0.687276363f, 0.568896949f},
-std::array<float,2>{0.0494174175f, 0.722573817f},
-std::array<float,2>{0.907158792f, 0.296201617f},
-std::array<float,2>{0.447756171f, 0.194101378f},
-std::array<float,2>{0.722607315f, 0.807283819f},
-std::array<float,2>{0.367776752f, 0.887292147f},
-std::array<float,2>{0.513624668f, 0.110692859f},
-std::array<float,2>{0.192449123f, 0.499180585f},
-std::array<float,2>{0.869131684f, 0.521181166f},
-std::array<float,2>{0.436202109f, 0.624602854f},
-std::array<float,2>{0.649047196f, 0.390720367f},
-std::array<float,2>{0.101468451f, 0.00822206959f},
-std::array<float,2>{0.981967628f, 0.984364569f},
-std::array<float,2>{0.16317907f, 0.844124019f},
-std::array<float,2>{0.754669785f, 0.186958194f},
-std::array<float,2>{0.250129014f, 0.360134482f},
-std::array<float,2>{0.573177934f, 0.659258723f},
-std::array<float,2>{0.124062702f, 0.590182126f},
-std::array<float,2>{0.996214211f, 0.423014164f},
-std::array<float,2>{0.413698852f, 0.0580205619f},
-std::array<float,2>{0.627619743f, 0.943210304f},
-std::array<float,2>{0.278627753f, 0.835570574f},
-std::array<float,2>{0.590054333f, 0.151009306f},
-std::array<float,2>{0.172000349f, 0.329957753f},
-std::array<float,2>{0.771417081f, 0.636766255f},
-std::array<float,2>{0.464426935f, 0.699829578f},
-std::array<float,2>{0.742469013f, 0.279401243f},
-std::array<float,2>{0.0402613394f, 0.22144179f},
-std::array<float,2>{0.927129507f, 0.776066184f},
-std::array<float,2>{0.205316082f, 0.935765028f},
-std::array<float,2>{0.850928664f, 0.0662804618f},
-std::array<float,2>{0.352912605f, 0.457108974f},
-std::array<float,2>{0.524847865f, 0.541513503f},
-std::array<float,2>{0.15486826f, 0.678835809f},
-std::array<float,2>{0.787168741f, 0.359002352f},
-std::array<float,2>{0.292900175f, 0.156847343f},
-std::array<float,2>{0.621677935f, 0.864987016f},
-std::array<float,2>{0.387433022f, 0.994845331f},
-std::array<float,2>{0.656379998f, 0.0261930302f},
-std::array<float,2>{0.0683523342f, 0.38837564f},
-std::array<float,2>{0.938498199f, 0.604776382f},
-std::array<float,2>{0.340489268f, 0.502933383f},
-std::array<float,2>{0.558972597f, 0.47673738f},
-std::array<float,2>{0.219026148f, 0.0941798538f},
-std::array<float,2>{0.838672221f, 0.901525557f},
-std::array<float,2>{0.00793657731f, 0.795738757f},
-std::array<float,2>{0.878484726f, 0.208374932f},
-std::array<float,2>{0.481951356f, 0.301322818f},
-std::array<float,2>{0.694193482f, 0.741033018f},
-std::array<float,2>{0.215061963f, 0.56625551f},
-std::array<float,2>{0.851841509f, 0.410569608f},
-std::array<float,2>{0.346901178f, 0.034882579f},
-std::array<float,2>{0.522170246f, 0.95563823f},
-std::array<float,2>{0.46055457f, 0.815037727f},
-std::array<float,2>{0.739814281f, 0.135906979f},
-std::array<float,2>{0.0351917557f, 0.326758206f},
-std::array<float,2>{0.93616122f, 0.651278794f},
-std::array<float,2>{0.268925399f, 0.703357518f},
-std::array<float,2>{0.585448861f, 0.259504646f},
-std::array<float,2>{0.181794271f, 0.235781625f},
-std::array<float,2>{0.779955506f, 0.761723697f},
-std::array<float,2>{0.114079498f, 0.908477068f},
-std::array<float,2>{0.98500371f, 0.0874770656f},
-std::array<float,2>{0.419924885f, 0.448639303f},
-std::array<float,2>{0.638404191f, 0.552158475f},
-std::array<float,2>{0.00503057661f, 0.661832392f},
-std::array<float,2>{0.886300862f, 0.366324961f},
-std::array<float,2>{0.469539016f, 0.182284579f},
-std::array<float,2>{0.70168817f, 0.850430071f},
-std::array<float,2>{0.334009051f, 0.979441822f},
-std::array<float,2>{0.547202885f, 0.0121578891f},
-std::array<float,2>{0.226609915f, 0.39671886f},
-std::array<float,2>{0.829910278f, 0.620901108f},
-std::array<float,2>{0.382492483f, 0.516488194f},
-std::array<float,2>{0.670809865f, 0.492313236f},
-std::array<float,2>{0.0723601952f, 0.113394126f},
-std::array<float,2>{0.952045858f, 0.883583605f},
-std::array<float,2>{0.14696297f, 0.811294794f},
-std::array<float,2>{0.793560207f, 0.18907468f},
-std::array<float,2>{0.286579937f, 0.291461021f},
-std::array<float,2>{0.614315331f, 0.724424899f},
-std::array<float,2>{0.0808795691f, 0.544405818f},
-std::array<float,2>{0.96817112f, 0.45325008f},
-std::array<float,2>{0.405911207f, 0.0698518306f},
-std::array<float,2>{0.678324997f, 0.929700315f},
-std::array<float,2>{0.31194967f, 0.777970731f},
-std::array<float,2>{0.599146605f, 0.22327736f},
-std::array<float,2>{0.130879238f, 0.273924559f},
-std::array<float,2>{0.802256167f, 0.695774078f},
-std::array<float,2>{0.491916776f, 0.633162677f},
-std::array<float,2>{0.718092322f, 0.335030407f},
-std::array<float,2>{0.0253478698f, 0.155144185f},
-std::array<float,2>{0.895649314f, 0.830253959f},
-std::array<float,2>{0.246648207f, 0.941366732f},
-std::array<float,2>{0.825606644f, 0.0618066452f},
-std::array<float,2>{0.31390062f, 0.428418964f},
-std::array<float,2>{0.531540215f, 0.589113414f},
-std::array<float,2>{0.165963814f, 0.737325191f},
-std::array<float,2>{0.759807169f, 0.297006518f},
-std::array<float,2>{0.263507575f, 0.205791265f},
-std::array<float,2>{0.565142095f, 0.789823353f},
-std::array<float,2>{0.42397064f, 0.904030204f},
-std::array<float,2>{0.64617759f, 0.0980218425f},
-std::array<float,2>{0.109025247f, 0.483132988f},
-std::array<float,2>{0.971045911f, 0.506993771f},
-std::array<float,2>{0.359567583f, 0.609134078f},
-std::array<float,2>{0.5036304f, 0.384720206f},
-std::array<float,2>{0.197241694f, 0.0279431995f},
-std::array<float,2>{0.865948439f, 0.998982489f},
-std::array<float,2>{0.0602677017f, 0.86095506f},
-std::array<float,2>{0.92133826f, 0.162353233f},
-std::array<float,2>{0.440637261f, 0.352410346f},
-std::array<float,2>{0.727242947f, 0.67375797f},
-std::array<float,2>{0.140392736f, 0.511577845f},
-std::array<float,2>{0.809234917f, 0.472165406f},
-std::array<float,2>{0.297737926f, 0.103626989f},
-std::array<float,2>{0.603957117f, 0.891278744f},
-std::array<float,2>{0.393046886f, 0.788202763f},
-std::array<float,2>{0.683586776f, 0.215122297f},
-std::array<float,2>{0.0932517797f, 0.309687346f},
-std::array<float,2>{0.953597128f, 0.747238636f},
-std::array<float,2>{0.327068657f, 0.679843068f},
-std::array<float,2>{0.539539695f, 0.344632298f},
-std::array<float,2>{0.239306942f, 0.168121085f},
-std::array<float,2>{0.819256604f, 0.871771395f},
-std::array<float,2>{0.019681327f, 0.98513943f},
-std::array<float,2>{0.904305935f, 0.0161523074f},
-std::array<float,2>{0.498062521f, 0.375483662f},
-std::array<float,2>{0.710132658f, 0.598648489f},
-std::array<float,2>{0.0944518223f, 0.688550591f},
-std::array<float,2>{0.979805112f, 0.267239004f},
-std::array<float,2>{0.429701298f, 0.229201391f},
-std::array<float,2>{0.653737724f, 0.77326268f},
-std::array<float,2>{0.256737292f, 0.929260612f},
-std::array<float,2>{0.575317979f, 0.0716612786f},
-std::array<float,2>{0.158186391f, 0.462246507f},
-std::array<float,2>{0.752212822f, 0.534385324f},
-std::array<float,2>{0.44989264f, 0.58361119f},
-std::array<float,2>{0.72419703f, 0.436356574f},
-std::array<float,2>{0.0544037558f, 0.0491160229f},
-std::array<float,2>{0.91155386f, 0.947116673f},
-std::array<float,2>{0.190565005f, 0.841662169f},
-std::array<float,2>{0.873061836f, 0.147211835f},
-std::array<float,2>{0.374392241f, 0.339026421f},
-std::array<float,2>{0.508543789f, 0.628736138f},
-std::array<float,2>{0.0456827544f, 0.612548947f},
-std::array<float,2>{0.921878636f, 0.406037539f},
-std::array<float,2>{0.468266517f, 0.00515171839f},
-std::array<float,2>{0.748625994f, 0.97384131f},
-std::array<float,2>{0.356725872f, 0.857183695f},
-std::array<float,2>{0.530044436f, 0.179625824f},
-std::array<float,2>{0.210084558f, 0.372623563f},
-std::array<float,2>{0.846355796f, 0.669736862f},
-std::array<float,2>{0.407027155f, 0.728301764f},
-std::array<float,2>{0.630790532f, 0.287384659f},
-std::array<float,2>{0.120135412f, 0.197335035f},
-std::array<float,2>{0.994282007f, 0.800123811f},
-std::array<float,2>{0.176886976f, 0.876159728f},
-std::array<float,2>{0.766073585f, 0.124163061f},
-std::array<float,2>{0.276365101f, 0.487423211f},
-std::array<float,2>{0.589589298f, 0.523914814f},
-std::array<float,2>{0.224416539f, 0.64148134f},
-std::array<float,2>{0.840908349f, 0.315256566f},
-std::array<float,2>{0.337715089f, 0.127195254f},
-std::array<float,2>{0.555856824f, 0.822342753f},
-std::array<float,2>{0.479637265f, 0.967783809f},
-std::array<float,2>{0.689713061f, 0.0430407524f},
-std::array<float,2>{0.014010408f, 0.41601935f},
-std::array<float,2>{0.880916893f, 0.576591611f},
-std::array<float,2>{0.296394855f, 0.55856365f},
-std::array<float,2>{0.620923519f, 0.441945255f},
-std::array<float,2>{0.151790649f, 0.084425129f},
-std::array<float,2>{0.784398794f, 0.91989857f},
-std::array<float,2>{0.0657217801f, 0.757338464f},
-std::array<float,2>{0.944382489f, 0.242339402f},
-std::array<float,2>{0.386084437f, 0.256481767f},
-std::array<float,2>{0.661162794f, 0.711848974f},
-std::array<float,2>{0.127921805f, 0.61367768f},
-std::array<float,2>{0.797142148f, 0.400944799f},
-std::array<float,2>{0.305228114f, 0.00258182362f},
-std::array<float,2>{0.596872568f, 0.969907343f},
-std::array<float,2>{0.399120569f, 0.85498476f},
-std::array<float,2>{0.674905956f, 0.173950121f},
-std::array<float,2>{0.0858058855f, 0.370002836f},
-std::array<float,2>{0.963981152f, 0.665421307f},
-std::array<float,2>{0.31829685f, 0.730553031f},
-std::array<float,2>{0.536169231f, 0.283646137f},
-std::array<float,2>{0.243177488f, 0.199259356f},
-std::array<float,2>{0.820716143f, 0.800921261f},
-std::array<float,2>{0.0287809931f, 0.878939092f},
-std::array<float,2>{0.891725063f, 0.117699936f},
-std::array<float,2>{0.486897022f, 0.489289135f},
-std::array<float,2>{0.713454664f, 0.531249702f},
-std::array<float,2>{0.1053271f, 0.647289693f},
-std::array<float,2>{0.975296855f, 0.318722039f},
-std::array<float,2>{0.426056743f, 0.132171273f},
-std::array<float,2>{0.64225477f, 0.827403128f},
-std::array<float,2>{0.261022836f, 0.962676942f},
-std::array<float,2>{0.570232689f, 0.0414033905f},
-std::array<float,2>{0.170591444f, 0.421536565f},
-std::array<float,2>{0.76515013f, 0.572402358f},
-std::array<float,2>{0.444000661f, 0.562142313f},
-std::array<float,2>{0.734121799f, 0.438548446f},
-std::array<float,2>{0.0565496311f, 0.0803620964f},
-std::array<float,2>{0.914722383f, 0.917795658f},
-std::array<float,2>{0.199684083f, 0.751902759f},
-std::array<float,2>{0.862828374f, 0.247918561f},
-std::array<float,2>{0.364098698f, 0.251567274f},
-std::array<float,2>{0.507674098f, 0.715667665f},
-std::array<float,2>{0.0318878368f, 0.51300174f},
-std::array<float,2>{0.930767f, 0.476545483f},
-std::array<float,2>{0.456742495f, 0.107253373f},
-std::array<float,2>{0.736100018f, 0.897524357f},
-std::array<float,2>{0.347806245f, 0.782850385f},
-std::array<float,2>{0.519409955f, 0.214785844f},
-std::array<float,2>{0.213274688f, 0.307808936f},
-std::array<float,2>{0.858903706f, 0.744865775f},
-std::array<float,2>{0.416456491f, 0.686724663f},
-std::array<float,2>{0.633862793f, 0.347913593f},
-std::array<float,2>{0.112840183f, 0.16524367f},
-std::array<float,2>{0.9915694f, 0.868028224f},
-std::array<float,2>{0.184397668f, 0.989726186f},
-std::array<float,2>{0.774036109f, 0.0228532478f},
-std::array<float,2>{0.272338867f, 0.380579025f},
-std::array<float,2>{0.580083489f, 0.593890607f},
-std::array<float,2>{0.23129794f, 0.694155037f},
-std::array<float,2>{0.832085013f, 0.269834697f},
-std::array<float,2>{0.330736995f, 0.231318593f},
-std::array<float,2>{0.552889049f, 0.767423987f},
-std::array<float,2>{0.474379003f, 0.924176931f},
-std::array<float,2>{0.69877708f, 0.0764670447f},
-std::array<float,2>{0.00354181509f, 0.465537846f},
-std::array<float,2>{0.887726009f, 0.538799226f},
-std::array<float,2>{0.285081357f, 0.580962837f},
-std::array<float,2>{0.610576689f, 0.431116492f},
-std::array<float,2>{0.143488571f, 0.054166235f},
-std::array<float,2>{0.792582273f, 0.949495196f},
-std::array<float,2>{0.076702401f, 0.837390423f},
-std::array<float,2>{0.945929766f, 0.143542215f},
-std::array<float,2>{0.377536505f, 0.342538744f},
-std::array<float,2>{0.665455222f, 0.62953651f},
-std::array<float,2>{0.204191357f, 0.542854965f},
-std::array<float,2>{0.848883212f, 0.458424717f},
-std::array<float,2>{0.35475111f, 0.0645202398f},
-std::array<float,2>{0.527297735f, 0.9374066f},
-std::array<float,2>{0.461847961f, 0.776906133f},
-std::array<float,2>{0.745099127f, 0.222062379f},
-std::array<float,2>{0.0425519012f, 0.28062582f},
-std::array<float,2>{0.929335833f, 0.700805783f},
-std::array<float,2>{0.280637443f, 0.638378084f},
-std::array<float,2>{0.592787445f, 0.328495204f},
-std::array<float,2>{0.175731033f, 0.152250096f},
-std::array<float,2>{0.773049295f, 0.834365189f},
-std::array<float,2>{0.12276496f, 0.942299545f},
-std::array<float,2>{0.999086618f, 0.0573355891f},
-std::array<float,2>{0.411092103f, 0.422401309f},
-std::array<float,2>{0.626098275f, 0.591073632f},
-std::array<float,2>{0.0101850126f, 0.742082655f},
-std::array<float,2>{0.876671255f, 0.301942676f},
-std::array<float,2>{0.484058827f, 0.207270578f},
-std::array<float,2>{0.693172812f, 0.796094358f},
-std::array<float,2>{0.343719304f, 0.901361585f},
-std::array<float,2>{0.561226547f, 0.0952872485f},
-std::array<float,2>{0.22227402f, 0.478203088f},
-std::array<float,2>{0.836581349f, 0.502371907f},
-std::array<float,2>{0.390116304f, 0.604264438f},
-std::array<float,2>{0.659397662f, 0.387687624f},
-std::array<float,2>{0.069896847f, 0.0265339818f},
-std::array<float,2>{0.93979758f, 0.995419741f},
-std::array<float,2>{0.152806833f, 0.863446653f},
-std::array<float,2>{0.785315156f, 0.157924339f},
-std::array<float,2>{0.289934754f, 0.357793689f},
-std::array<float,2>{0.624631405f, 0.677820802f},
-std::array<float,2>{0.0865878165f, 0.569575667f},
-std::array<float,2>{0.960445344f, 0.406377435f},
-std::array<float,2>{0.396511793f, 0.0386125371f},
-std::array<float,2>{0.685218751f, 0.959066272f},
-std::array<float,2>{0.301301301f, 0.81707567f},
-std::array<float,2>{0.607702672f, 0.138680086f},
-std::array<float,2>{0.133787006f, 0.322716892f},
-std::array<float,2>{0.807804763f, 0.654817164f},
-std::array<float,2>{0.495032102f, 0.710024595f},
-std::array<float,2>{0.706626594f, 0.264630944f},
-std::array<float,2>{0.0191399343f, 0.240651131f},
-std::array<float,2>{0.902194619f, 0.759030163f},
-std::array<float,2>{0.235778779f, 0.912086844f},
-std::array<float,2>{0.814998329f, 0.0914225727f},
-std::array<float,2>{0.32102415f, 0.45100224f},
-std::array<float,2>{0.545829773f, 0.547855973f},
-std::array<float,2>{0.160829857f, 0.658375025f},
-std::array<float,2>{0.756074846f, 0.360786527f},
-std::array<float,2>{0.253404289f, 0.185922205f},
-std::array<float,2>{0.572247565f, 0.845098138f},
-std::array<float,2>{0.434302449f, 0.98296392f},
-std::array<float,2>{0.65097636f, 0.00886353385f},
-std::array<float,2>{0.0988468975f, 0.392562658f},
-std::array<float,2>{0.983804643f, 0.623117328f},
-std::array<float,2>{0.369537592f, 0.519748807f},
-std::array<float,2>{0.51488924f, 0.498270243f},
-std::array<float,2>{0.194596827f, 0.110047951f},
-std::array<float,2>{0.869802117f, 0.888220727f},
-std::array<float,2>{0.0470217057f, 0.807653606f},
-std::array<float,2>{0.909234464f, 0.194871917f},
-std::array<float,2>{0.4453125f, 0.29581216f},
-std::array<float,2>{0.720057487f, 0.720829844f},
-std::array<float,2>{0.249801785f, 0.588734806f},
-std::array<float,2>{0.826926529f, 0.429433137f},
-std::array<float,2>{0.315021545f, 0.0608110838f},
-std::array<float,2>{0.534604311f, 0.939905226f},
-std::array<float,2>{0.489479274f, 0.83138299f},
-std::array<float,2>{0.715373397f, 0.155304506f},
-std::array<float,2>{0.0269877184f, 0.334499568f},
-std::array<float,2>{0.898190498f, 0.633977652f},
-std::array<float,2>{0.309125125f, 0.696753263f},
-std::array<float,2>{0.600542426f, 0.274814755f},
-std::array<float,2>{0.130022675f, 0.224027991f},
-std::array<float,2>{0.803065777f, 0.77885884f},
-std::array<float,2>{0.0799050853f, 0.930888057f},
-std::array<float,2>{0.965302467f, 0.06839744f},
-std::array<float,2>{0.403191209f, 0.454624683f},
-std::array<float,2>{0.676704466f, 0.543441057f},
-std::array<float,2>{0.0606184229f, 0.672548771f},
-std::array<float,2>{0.919694424f, 0.353107661f},
-std::array<float,2>{0.438640416f, 0.163870037f},
-std::array<float,2>{0.729225874f, 0.859507918f},
-std::array<float,2>{0.362185836f, 0.99935621f},
-std::array<float,2>{0.501336396f, 0.029144885f},
-std::array<float,2>{0.197777078f, 0.383688092f},
-std::array<float,2>{0.865093827f, 0.607923329f},
-std::array<float,2>{0.422690511f, 0.506265938f},
-std::array<float,2>{0.647285163f, 0.483814597f},
-std::array<float,2>{0.106594034f, 0.0991544202f},
-std::array<float,2>{0.969110608f, 0.902769327f},
-std::array<float,2>{0.167854443f, 0.790202022f},
-std::array<float,2>{0.759681642f, 0.206852779f},
-std::array<float,2>{0.264853418f, 0.29798916f},
-std::array<float,2>{0.563256025f, 0.736772299f},
-std::array<float,2>{0.116053551f, 0.55134505f},
-std::array<float,2>{0.987320781f, 0.447634131f},
-std::array<float,2>{0.418251485f, 0.0865068659f},
-std::array<float,2>{0.639398575f, 0.909511089f},
-std::array<float,2>{0.265663981f, 0.762950301f},
-std::array<float,2>{0.583180964f, 0.235205367f},
-std::array<float,2>{0.181567818f, 0.258343309f},
-std::array<float,2>{0.779061139f, 0.704110384f},
-std::array<float,2>{0.458865732f, 0.651853383f},
-std::array<float,2>{0.741342902f, 0.327180117f},
-std::array<float,2>{0.0386568904f, 0.135333046f},
-std::array<float,2>{0.934644938f, 0.81573993f},
-std::array<float,2>{0.217497677f, 0.956655979f},
-std::array<float,2>{0.854540646f, 0.0332287438f},
-std::array<float,2>{0.344166338f, 0.41120258f},
-std::array<float,2>{0.520233691f, 0.564808786f},
-std::array<float,2>{0.145577341f, 0.72303766f},
-std::array<float,2>{0.795926869f, 0.292670935f},
-std::array<float,2>{0.288868815f, 0.187940225f},
-std::array<float,2>{0.615768611f, 0.811673045f},
-std::array<float,2>{0.379791826f, 0.884095073f},
-std::array<float,2>{0.669113576f, 0.115156628f},
-std::array<float,2>{0.0715812147f, 0.49373582f},
-std::array<float,2>{0.949324369f, 0.516852617f},
-std::array<float,2>{0.332479268f, 0.619466126f},
-std::array<float,2>{0.550192356f, 0.397729278f},
-std::array<float,2>{0.228777602f, 0.0127228899f},
-std::array<float,2>{0.830843151f, 0.980266273f},
-std::array<float,2>{0.00623219926f, 0.850886583f},
-std::array<float,2>{0.884118617f, 0.183265731f},
-std::array<float,2>{0.47197789f, 0.365377486f},
-std::array<float,2>{0.699468195f, 0.661036253f},
-std::array<float,2>{0.178895473f, 0.524731517f},
-std::array<float,2>{0.768590152f, 0.48636955f},
-std::array<float,2>{0.275150657f, 0.123194121f},
-std::array<float,2>{0.587202072f, 0.875615537f},
-std::array<float,2>{0.409614891f, 0.799127162f},
-std::array<float,2>{0.631597221f, 0.19838877f},
-std::array<float,2>{0.117794186f, 0.288734257f},
-std::array<float,2>{0.993948638f, 0.727470219f},
-std::array<float,2>{0.358728051f, 0.668110669f},
-std::array<float,2>{0.52921623f, 0.371137261f},
-std::array<float,2>{0.20736903f, 0.178280905f},
-std::array<float,2>{0.843834579f, 0.856347322f},
-std::array<float,2>{0.0432331637f, 0.972698331f},
-std::array<float,2>{0.925153732f, 0.00468447851f},
-std::array<float,2>{0.466691762f, 0.404426366f},
-std::array<float,2>{0.747614264f, 0.611739874f},
-std::array<float,2>{0.0632206947f, 0.712202847f},
-std::array<float,2>{0.942240953f, 0.257176638f},
-std::array<float,2>{0.383951157f, 0.243182808f},
-std::array<float,2>{0.662921607f, 0.756610215f},
-std::array<float,2>{0.294513077f, 0.918343127f},
-std::array<float,2>{0.617488384f, 0.085790202f},
-std::array<float,2>{0.149803057f, 0.442635208f},
-std::array<float,2>{0.781778872f, 0.557474375f},
-std::array<float,2>{0.478212118f, 0.577898026f},
-std::array<float,2>{0.688250244f, 0.417654335f},
-std::array<float,2>{0.0132955909f, 0.0439942032f},
-std::array<float,2>{0.879859328f, 0.967472017f},
-std::array<float,2>{0.225243911f, 0.823725581f},
-std::array<float,2>{0.84320575f, 0.128732026f},
-std::array<float,2>{0.338890672f, 0.31619525f},
-std::array<float,2>{0.556825161f, 0.642229497f},
-std::array<float,2>{0.0231910627f, 0.5980196f},
-std::array<float,2>{0.902861536f, 0.376242906f},
-std::array<float,2>{0.497756124f, 0.0172063969f},
-std::array<float,2>{0.708395123f, 0.985449433f},
-std::array<float,2>{0.324379623f, 0.872823179f},
-std::array<float,2>{0.541261494f, 0.169446647f},
-std::array<float,2>{0.24052012f, 0.345275074f},
-std::array<float,2>{0.817254007f, 0.681224465f},
-std::array<float,2>{0.391087741f, 0.746441483f},
-std::array<float,2>{0.681387067f, 0.309449822f},
-std::array<float,2>{0.0913608596f, 0.216716185f},
-std::array<float,2>{0.955624163f, 0.787849307f},
-std::array<float,2>{0.136912927f, 0.892009854f},
-std::array<float,2>{0.811026335f, 0.104988888f},
-std::array<float,2>{0.30001986f, 0.470733762f},
-std::array<float,2>{0.602800727f, 0.510220468f},
-std::array<float,2>{0.1891599f, 0.627562523f},
-std::array<float,2>{0.872861505f, 0.338600278f},
-std::array<float,2>{0.371527553f, 0.147853538f},
-std::array<float,2>{0.510976851f, 0.840728879f},
-std::array<float,2>{0.451808631f, 0.945587337f},
-std::array<float,2>{0.724996567f, 0.0502598546f},
-std::array<float,2>{0.0508831479f, 0.437155187f},
-std::array<float,2>{0.913104832f, 0.582274973f},
-std::array<float,2>{0.255647302f, 0.533265352f},
-std::array<float,2>{0.576996148f, 0.46129474f},
-std::array<float,2>{0.160049468f, 0.0711117387f},
-std::array<float,2>{0.75111711f, 0.928362489f},
-std::array<float,2>{0.0974466056f, 0.772095799f},
-std::array<float,2>{0.978394032f, 0.229918703f},
-std::array<float,2>{0.433417231f, 0.266079456f},
-std::array<float,2>{0.654703975f, 0.687528551f},
-std::array<float,2>{0.168062001f, 0.572226167f},
-std::array<float,2>{0.763094068f, 0.418531805f},
-std::array<float,2>{0.259592921f, 0.0404314213f},
-std::array<float,2>{0.566674113f, 0.963528454f},
-std::array<float,2>{0.429301202f, 0.825199008f},
-std::array<float,2>{0.642919421f, 0.130740598f},
-std::array<float,2>{0.101907551f, 0.318210036f},
-std::array<float,2>{0.973872125f, 0.644552708f},
-std::array<float,2>{0.365721315f, 0.718523085f},
-std::array<float,2>{0.505742848f, 0.252501369f},
-std::array<float,2>{0.201625064f, 0.248775482f},
-std::array<float,2>{0.859596968f, 0.7524423f},
-std::array<float,2>{0.0571915805f, 0.914534628f},
-std::array<float,2>{0.916416228f, 0.0798428953f},
-std::array<float,2>{0.441715986f, 0.440005392f},
-std::array<float,2>{0.730537713f, 0.560485601f},
-std::array<float,2>{0.0826227963f, 0.667782009f},
-std::array<float,2>{0.962150097f, 0.368547976f},
-std::array<float,2>{0.401668787f, 0.173309013f},
-std::array<float,2>{0.672597706f, 0.852074862f},
-std::array<float,2>{0.306685418f, 0.972539425f},
-std::array<float,2>{0.594251931f, 0.000208386424f},
-std::array<float,2>{0.126158491f, 0.399993658f},
-std::array<float,2>{0.799052179f, 0.615283251f},
-std::array<float,2>{0.485920936f, 0.528890908f},
-std::array<float,2>{0.712292612f, 0.490611136f},
-std::array<float,2>{0.031188231f, 0.120795809f},
-std::array<float,2>{0.893140912f, 0.882333517f},
-std::array<float,2>{0.245349437f, 0.803371489f},
-std::array<float,2>{0.823768258f, 0.202403054f},
-std::array<float,2>{0.320299745f, 0.282494307f},
-std::array<float,2>{0.53735739f, 0.7335006f},
-std::array<float,2>{4.36873815e-05f, 0.535331905f},
-std::array<float,2>{0.890399039f, 0.467869401f},
-std::array<float,2>{0.474859208f, 0.0744873807f},
-std::array<float,2>{0.695737541f, 0.922834814f},
-std::array<float,2>{0.330073833f, 0.769355357f},
-std::array<float,2>{0.551802456f, 0.233931959f},
-std::array<float,2>{0.233202621f, 0.271729141f},
-std::array<float,2>{0.833992839f, 0.693112493f},
-std::array<float,2>{0.375952959f, 0.631216586f},
-std::array<float,2>{0.6667974f, 0.340393126f},
-std::array<float,2>{0.0755610913f, 0.141895473f},
-std::array<float,2>{0.948700547f, 0.839014292f},
-std::array<float,2>{0.141882077f, 0.95239532f},
-std::array<float,2>{0.789798975f, 0.0514976867f},
-std::array<float,2>{0.282622546f, 0.432264119f},
-std::array<float,2>{0.612339258f, 0.578556597f},
-std::array<float,2>{0.212192103f, 0.74400568f},
-std::array<float,2>{0.856106758f, 0.305416614f},
-std::array<float,2>{0.350052267f, 0.212344527f},
-std::array<float,2>{0.51647675f, 0.783277512f},
-std::array<float,2>{0.453515053f, 0.894674063f},
-std::array<float,2>{0.737509072f, 0.107649855f},
-std::array<float,2>{0.0339352116f, 0.473570913f},
-std::array<float,2>{0.932241201f, 0.51424253f},
-std::array<float,2>{0.270309329f, 0.597443938f},
-std::array<float,2>{0.579051077f, 0.382735997f},
-std::array<float,2>{0.187459067f, 0.0196140632f},
-std::array<float,2>{0.7756024f, 0.990385413f},
-std::array<float,2>{0.111245476f, 0.870786905f},
-std::array<float,2>{0.989321053f, 0.166718945f},
-std::array<float,2>{0.415796161f, 0.35111782f},
-std::array<float,2>{0.634863913f, 0.683814645f},
-std::array<float,2>{0.219836116f, 0.500687957f},
-std::array<float,2>{0.838878572f, 0.479905427f},
-std::array<float,2>{0.341627657f, 0.0957837477f},
-std::array<float,2>{0.559705973f, 0.89917922f},
-std::array<float,2>{0.480484813f, 0.794285834f},
-std::array<float,2>{0.6948542f, 0.210260108f},
-std::array<float,2>{0.00908900611f, 0.304429203f},
-std::array<float,2>{0.877564609f, 0.740159094f},
-std::array<float,2>{0.291046947f, 0.676761508f},
-std::array<float,2>{0.62224257f, 0.356178075f},
-std::array<float,2>{0.155904263f, 0.159546241f},
-std::array<float,2>{0.788869739f, 0.865506113f},
-std::array<float,2>{0.0668632612f, 0.993437231f},
-std::array<float,2>{0.937576413f, 0.0240903124f},
-std::array<float,2>{0.387911707f, 0.389705271f},
-std::array<float,2>{0.657751083f, 0.603335142f},
-std::array<float,2>{0.0400074422f, 0.702014089f},
-std::array<float,2>{0.925838113f, 0.278458565f},
-std::array<float,2>{0.463634819f, 0.220051125f},
-std::array<float,2>{0.743384004f, 0.773660064f},
-std::array<float,2>{0.351753563f, 0.933861971f},
-std::array<float,2>{0.524020672f, 0.0632302538f},
-std::array<float,2>{0.206479013f, 0.460018247f},
-std::array<float,2>{0.850500405f, 0.539487302f},
-std::array<float,2>{0.412813693f, 0.592021167f},
-std::array<float,2>{0.628818154f, 0.424150079f},
-std::array<float,2>{0.123741247f, 0.0564272664f},
-std::array<float,2>{0.997677088f, 0.945025206f},
-std::array<float,2>{0.173784465f, 0.833699107f},
-std::array<float,2>{0.769757211f, 0.148600891f},
-std::array<float,2>{0.278108448f, 0.331122249f},
-std::array<float,2>{0.591184318f, 0.639671087f},
-std::array<float,2>{0.100107215f, 0.621184111f},
-std::array<float,2>{0.981282175f, 0.394256473f},
-std::array<float,2>{0.436875641f, 0.0105487797f},
-std::array<float,2>{0.649898767f, 0.981736064f},
-std::array<float,2>{0.251443863f, 0.847542405f},
-std::array<float,2>{0.573892236f, 0.183713481f},
-std::array<float,2>{0.16283074f, 0.361888826f},
-std::array<float,2>{0.755671561f, 0.657985926f},
-std::array<float,2>{0.449114919f, 0.720588982f},
-std::array<float,2>{0.721498907f, 0.293277174f},
-std::array<float,2>{0.0499427542f, 0.192382634f},
-std::array<float,2>{0.908014894f, 0.806205213f},
-std::array<float,2>{0.192078456f, 0.89007324f},
-std::array<float,2>{0.867895365f, 0.111784078f},
-std::array<float,2>{0.36908102f, 0.496107012f},
-std::array<float,2>{0.512439728f, 0.521755755f},
-std::array<float,2>{0.136364937f, 0.653032303f},
-std::array<float,2>{0.805436492f, 0.322067142f},
-std::array<float,2>{0.302889019f, 0.136777505f},
-std::array<float,2>{0.605709255f, 0.819732726f},
-std::array<float,2>{0.394663662f, 0.958486199f},
-std::array<float,2>{0.686176956f, 0.0361934267f},
-std::array<float,2>{0.0891601145f, 0.409941882f},
-std::array<float,2>{0.957234085f, 0.567868114f},
-std::array<float,2>{0.322944462f, 0.549082935f},
-std::array<float,2>{0.544366956f, 0.451822609f},
-std::array<float,2>{0.236794382f, 0.0928966627f},
-std::array<float,2>{0.812506735f, 0.913669884f},
-std::array<float,2>{0.0160742383f, 0.760810256f},
-std::array<float,2>{0.899208844f, 0.239308193f},
-std::array<float,2>{0.49267745f, 0.262940526f},
-std::array<float,2>{0.704576373f, 0.707136095f},
-std::array<float,2>{0.195642546f, 0.605953813f},
-std::array<float,2>{0.867084086f, 0.385494292f},
-std::array<float,2>{0.360793054f, 0.0295385662f},
-std::array<float,2>{0.501999617f, 0.996445537f},
-std::array<float,2>{0.439675987f, 0.862036288f},
-std::array<float,2>{0.728410542f, 0.160470858f},
-std::array<float,2>{0.059526097f, 0.353650987f},
-std::array<float,2>{0.920338273f, 0.675480962f},
-std::array<float,2>{0.262029707f, 0.734480143f},
-std::array<float,2>{0.565639019f, 0.300620109f},
-std::array<float,2>{0.164127812f, 0.203395784f},
-std::array<float,2>{0.761673868f, 0.791876674f},
-std::array<float,2>{0.108379155f, 0.905049324f},
-std::array<float,2>{0.972322464f, 0.101499781f},
-std::array<float,2>{0.425517946f, 0.481097847f},
-std::array<float,2>{0.645324528f, 0.505774498f},
-std::array<float,2>{0.0240623038f, 0.635026336f},
-std::array<float,2>{0.895466745f, 0.33342123f},
-std::array<float,2>{0.490415186f, 0.152373165f},
-std::array<float,2>{0.717683136f, 0.828370869f},
-std::array<float,2>{0.312514305f, 0.938197494f},
-std::array<float,2>{0.532832265f, 0.0591385439f},
-std::array<float,2>{0.247996762f, 0.427266568f},
-std::array<float,2>{0.824503064f, 0.586657465f},
-std::array<float,2>{0.404603362f, 0.545380592f},
-std::array<float,2>{0.679160178f, 0.455300093f},
-std::array<float,2>{0.08185184f, 0.0670296848f},
-std::array<float,2>{0.967139244f, 0.93284142f},
-std::array<float,2>{0.132064968f, 0.779519498f},
-std::array<float,2>{0.801316679f, 0.225478053f},
-std::array<float,2>{0.311473906f, 0.27657029f},
-std::array<float,2>{0.598210275f, 0.698164284f},
-std::array<float,2>{0.0735535696f, 0.519428134f},
-std::array<float,2>{0.952848434f, 0.495289445f},
-std::array<float,2>{0.381716937f, 0.116529256f},
-std::array<float,2>{0.671451747f, 0.884951591f},
-std::array<float,2>{0.285900861f, 0.808878005f},
-std::array<float,2>{0.613726735f, 0.190690637f},
-std::array<float,2>{0.147466525f, 0.29009223f},
-std::array<float,2>{0.794814706f, 0.725936472f},
-std::array<float,2>{0.470011085f, 0.662959456f},
-std::array<float,2>{0.702246666f, 0.363775671f},
-std::array<float,2>{0.00485126488f, 0.18127659f},
-std::array<float,2>{0.884888053f, 0.848450243f},
-std::array<float,2>{0.227737889f, 0.977838874f},
-std::array<float,2>{0.8281883f, 0.013925706f},
-std::array<float,2>{0.335722744f, 0.395610631f},
-std::array<float,2>{0.548763394f, 0.617839456f},
-std::array<float,2>{0.182723373f, 0.70607239f},
-std::array<float,2>{0.780499458f, 0.259923875f},
-std::array<float,2>{0.268212259f, 0.237280235f},
-std::array<float,2>{0.584440231f, 0.765186131f},
-std::array<float,2>{0.420947194f, 0.907972991f},
-std::array<float,2>{0.636999369f, 0.0883364454f},
-std::array<float,2>{0.114571311f, 0.446084231f},
-std::array<float,2>{0.985541761f, 0.554494798f},
-std::array<float,2>{0.346467525f, 0.563164473f},
-std::array<float,2>{0.52246654f, 0.413651198f},
-std::array<float,2>{0.215863913f, 0.0321129262f},
-std::array<float,2>{0.853513658f, 0.953380108f},
-std::array<float,2>{0.0367587656f, 0.81285727f},
-std::array<float,2>{0.936888754f, 0.1337336f},
-std::array<float,2>{0.459179074f, 0.324629247f},
-std::array<float,2>{0.7391572f, 0.648928821f},
-std::array<float,2>{0.15042749f, 0.555292964f},
-std::array<float,2>{0.783380806f, 0.445281118f},
-std::array<float,2>{0.295238048f, 0.0833063275f},
-std::array<float,2>{0.619733214f, 0.920899212f},
-std::array<float,2>{0.385035038f, 0.754098356f},
-std::array<float,2>{0.660357356f, 0.245514572f},
-std::array<float,2>{0.0647347867f, 0.255847991f},
-std::array<float,2>{0.944263637f, 0.713482201f},
-std::array<float,2>{0.336538643f, 0.644524693f},
-std::array<float,2>{0.555232346f, 0.313283116f},
-std::array<float,2>{0.223418847f, 0.126468778f},
-std::array<float,2>{0.840726495f, 0.821094334f},
-std::array<float,2>{0.0150116887f, 0.965168595f},
-std::array<float,2>{0.882601082f, 0.0451501757f},
-std::array<float,2>{0.47939983f, 0.415637553f},
-std::array<float,2>{0.69113642f, 0.574502349f},
-std::array<float,2>{0.119895071f, 0.728843272f},
-std::array<float,2>{0.995426297f, 0.286824673f},
-std::array<float,2>{0.407769829f, 0.196168274f},
-std::array<float,2>{0.629444718f, 0.798348904f},
-std::array<float,2>{0.27667886f, 0.877881646f},
-std::array<float,2>{0.588119388f, 0.121471271f},
-std::array<float,2>{0.17651476f, 0.485533118f},
-std::array<float,2>{0.767300725f, 0.526110768f},
-std::array<float,2>{0.467370987f, 0.610756457f},
-std::array<float,2>{0.749383211f, 0.402925521f},
-std::array<float,2>{0.046162352f, 0.00693686074f},
-std::array<float,2>{0.923379838f, 0.975203335f},
-std::array<float,2>{0.209225684f, 0.857539654f},
-std::array<float,2>{0.847308099f, 0.177720845f},
-std::array<float,2>{0.356316805f, 0.374503583f},
-std::array<float,2>{0.530872166f, 0.671269655f},
-std::array<float,2>{0.053599596f, 0.585640311f},
-std::array<float,2>{0.910362244f, 0.434152752f},
-std::array<float,2>{0.451158881f, 0.0484631211f},
-std::array<float,2>{0.722968638f, 0.948748648f},
-std::array<float,2>{0.373090982f, 0.841976225f},
-std::array<float,2>{0.50905937f, 0.144797087f},
-std::array<float,2>{0.189479887f, 0.337187022f},
-std::array<float,2>{0.874640763f, 0.626939058f},
-std::array<float,2>{0.430996984f, 0.690350175f},
-std::array<float,2>{0.652880132f, 0.268312633f},
-std::array<float,2>{0.0949452594f, 0.227159828f},
-std::array<float,2>{0.979464352f, 0.770255625f},
-std::array<float,2>{0.157168105f, 0.926408768f},
-std::array<float,2>{0.753762245f, 0.073497884f},
-std::array<float,2>{0.257572144f, 0.463012576f},
-std::array<float,2>{0.575192988f, 0.531755447f},
-std::array<float,2>{0.239047483f, 0.682612062f},
-std::array<float,2>{0.8199476f, 0.347197562f},
-std::array<float,2>{0.327305973f, 0.170040771f},
-std::array<float,2>{0.540506601f, 0.873324454f},
-std::array<float,2>{0.499934882f, 0.987108052f},
-std::array<float,2>{0.709834337f, 0.0195093825f},
-std::array<float,2>{0.0211139675f, 0.378842503f},
-std::array<float,2>{0.905866146f, 0.60031718f},
-std::array<float,2>{0.298392117f, 0.50942713f},
-std::array<float,2>{0.605014324f, 0.469547749f},
-std::array<float,2>{0.139444545f, 0.103178285f},
-std::array<float,2>{0.810291469f, 0.894082606f},
-std::array<float,2>{0.0927656293f, 0.785674274f},
-std::array<float,2>{0.954526126f, 0.217065498f},
-std::array<float,2>{0.394277215f, 0.310665965f},
-std::array<float,2>{0.68179059f, 0.748540759f},
-std::array<float,2>{0.148833871f, 0.574237227f},
-std::array<float,2>{0.783120394f, 0.415880889f},
-std::array<float,2>{0.293890357f, 0.0452999212f},
-std::array<float,2>{0.618716121f, 0.964984357f},
-std::array<float,2>{0.382980138f, 0.820898592f},
-std::array<float,2>{0.663599968f, 0.1269003f},
-std::array<float,2>{0.0637751371f, 0.313078314f},
-std::array<float,2>{0.942922652f, 0.644285083f},
-std::array<float,2>{0.338274866f, 0.713664055f},
-std::array<float,2>{0.558348894f, 0.255438477f},
-std::array<float,2>{0.22617197f, 0.245255932f},
-std::array<float,2>{0.842129409f, 0.754343212f},
-std::array<float,2>{0.0125090843f, 0.921220064f},
-std::array<float,2>{0.880071223f, 0.0830446556f},
-std::array<float,2>{0.477469027f, 0.445000112f},
-std::array<float,2>{0.689082205f, 0.555500865f},
-std::array<float,2>{0.118264861f, 0.671075761f},
-std::array<float,2>{0.992974818f, 0.374217272f},
-std::array<float,2>{0.408523738f, 0.177379057f},
-std::array<float,2>{0.632397294f, 0.857782125f},
-std::array<float,2>{0.273848325f, 0.975391507f},
-std::array<float,2>{0.58602494f, 0.00713378284f},
-std::array<float,2>{0.178356856f, 0.403230727f},
-std::array<float,2>{0.768544912f, 0.610551476f},
-std::array<float,2>{0.465138912f, 0.526353717f},
-std::array<float,2>{0.746644795f, 0.48564899f},
-std::array<float,2>{0.0442384928f, 0.121267371f},
-std::array<float,2>{0.924145818f, 0.877682686f},
-std::array<float,2>{0.208738878f, 0.798627853f},
-std::array<float,2>{0.844819725f, 0.195922613f},
-std::array<float,2>{0.358081758f, 0.286923558f},
-std::array<float,2>{0.527537405f, 0.728585303f},
-std::array<float,2>{0.0526266731f, 0.531992257f},
-std::array<float,2>{0.912687004f, 0.463246673f},
-std::array<float,2>{0.452661902f, 0.0732716769f},
-std::array<float,2>{0.726146221f, 0.926634669f},
-std::array<float,2>{0.372259498f, 0.770375609f},
-std::array<float,2>{0.510266125f, 0.227499381f},
-std::array<float,2>{0.187931716f, 0.268071324f},
-std::array<float,2>{0.871634245f, 0.690083742f},
-std::array<float,2>{0.431873202f, 0.626598895f},
-std::array<float,2>{0.655413151f, 0.336935669f},
-std::array<float,2>{0.0965046808f, 0.144605547f},
-std::array<float,2>{0.976687253f, 0.842219532f},
-std::array<float,2>{0.158908784f, 0.949211776f},
-std::array<float,2>{0.750453591f, 0.0487037525f},
-std::array<float,2>{0.254255533f, 0.434440017f},
-std::array<float,2>{0.577933311f, 0.585775375f},
-std::array<float,2>{0.24136053f, 0.748905241f},
-std::array<float,2>{0.818252683f, 0.31090495f},
-std::array<float,2>{0.325528443f, 0.216860354f},
-std::array<float,2>{0.542421162f, 0.786017478f},
-std::array<float,2>{0.496937066f, 0.894469678f},
-std::array<float,2>{0.707472205f, 0.103486128f},
-std::array<float,2>{0.0222833324f, 0.469350815f},
-std::array<float,2>{0.904072106f, 0.509715617f},
-std::array<float,2>{0.298979074f, 0.600378931f},
-std::array<float,2>{0.601835549f, 0.378549337f},
-std::array<float,2>{0.13798143f, 0.0192471128f},
-std::array<float,2>{0.812157273f, 0.987013519f},
-std::array<float,2>{0.090341635f, 0.873236001f},
-std::array<float,2>{0.956419468f, 0.170265481f},
-std::array<float,2>{0.392134517f, 0.347594619f},
-std::array<float,2>{0.679995835f, 0.682354629f},
-std::array<float,2>{0.199017972f, 0.505385995f},
-std::array<float,2>{0.864256263f, 0.481348157f},
-std::array<float,2>{0.363055259f, 0.101299256f},
-std::array<float,2>{0.500745833f, 0.904856622f},
-std::array<float,2>{0.438320726f, 0.791737318f},
-std::array<float,2>{0.729741871f, 0.203208089f},
-std::array<float,2>{0.0621004067f, 0.300309092f},
-std::array<float,2>{0.918725014f, 0.734789252f},
-std::array<float,2>{0.263735294f, 0.67571187f},
-std::array<float,2>{0.564217746f, 0.353964478f},
-std::array<float,2>{0.166371435f, 0.160373002f},
-std::array<float,2>{0.757887602f, 0.862201333f},
-std::array<float,2>{0.106028229f, 0.99621886f},
-std::array<float,2>{0.970118999f, 0.0296768602f},
-std::array<float,2>{0.423666447f, 0.385557771f},
-std::array<float,2>{0.647815585f, 0.605590224f},
-std::array<float,2>{0.0258314852f, 0.697911978f},
-std::array<float,2>{0.897087038f, 0.276807606f},
-std::array<float,2>{0.488985807f, 0.22528705f},
-std::array<float,2>{0.716611862f, 0.779753447f},
-std::array<float,2>{0.315474987f, 0.932924211f},
-std::array<float,2>{0.533471167f, 0.0673683062f},
-std::array<float,2>{0.249003455f, 0.455430776f},
-std::array<float,2>{0.827755988f, 0.545072198f},
-std::array<float,2>{0.40360409f, 0.586780548f},
-std::array<float,2>{0.677366436f, 0.427531093f},
-std::array<float,2>{0.0784092396f, 0.0594028942f},
-std::array<float,2>{0.966402233f, 0.938325405f},
-std::array<float,2>{0.129214972f, 0.82826829f},
-std::array<float,2>{0.804145992f, 0.152649149f},
-std::array<float,2>{0.310262948f, 0.333174199f},
-std::array<float,2>{0.600854754f, 0.634990573f},
-std::array<float,2>{0.0704425275f, 0.61814636f},
-std::array<float,2>{0.950680614f, 0.39596194f},
-std::array<float,2>{0.379885316f, 0.0138605693f},
-std::array<float,2>{0.668123722f, 0.97754389f},
-std::array<float,2>{0.287367433f, 0.84832257f},
-std::array<float,2>{0.616333842f, 0.181457207f},
-std::array<float,2>{0.145287752f, 0.364167541f},
-std::array<float,2>{0.795092404f, 0.662749469f},
-std::array<float,2>{0.471471936f, 0.725641549f},
-std::array<float,2>{0.700743318f, 0.29037568f},
-std::array<float,2>{0.00720739318f, 0.190452904f},
-std::array<float,2>{0.882827401f, 0.808710396f},
-std::array<float,2>{0.22956638f, 0.885100543f},
-std::array<float,2>{0.83189404f, 0.116356321f},
-std::array<float,2>{0.333431602f, 0.495439231f},
-std::array<float,2>{0.54906708f, 0.519071698f},
-std::array<float,2>{0.180566117f, 0.649412513f},
-std::array<float,2>{0.777951539f, 0.3242957f},
-std::array<float,2>{0.267225087f, 0.133365154f},
-std::array<float,2>{0.582549989f, 0.812581599f},
-std::array<float,2>{0.4194507f, 0.953321576f},
-std::array<float,2>{0.639860213f, 0.031769f},
-std::array<float,2>{0.117099062f, 0.414053023f},
-std::array<float,2>{0.987019539f, 0.563433349f},
-std::array<float,2>{0.345701665f, 0.55427748f},
-std::array<float,2>{0.521070957f, 0.445913106f},
-std::array<float,2>{0.218372941f, 0.0880628377f},
-std::array<float,2>{0.853774607f, 0.907919228f},
-std::array<float,2>{0.0373729542f, 0.765530109f},
-std::array<float,2>{0.934477925f, 0.236860231f},
-std::array<float,2>{0.457246482f, 0.260220736f},
-std::array<float,2>{0.740744472f, 0.706331015f},
-std::array<float,2>{0.221626252f, 0.603126884f},
-std::array<float,2>{0.837611496f, 0.390107721f},
-std::array<float,2>{0.341879189f, 0.0242498312f},
-std::array<float,2>{0.562203228f, 0.993259013f},
-std::array<float,2>{0.483000666f, 0.865349472f},
-std::array<float,2>{0.692092478f, 0.159197703f},
-std::array<float,2>{0.0107738804f, 0.356258065f},
-std::array<float,2>{0.875354826f, 0.677069128f},
-std::array<float,2>{0.290659219f, 0.739849091f},
-std::array<float,2>{0.623801768f, 0.304513007f},
-std::array<float,2>{0.153520465f, 0.21004346f},
-std::array<float,2>{0.786245644f, 0.793968141f},
-std::array<float,2>{0.0683856606f, 0.898970127f},
-std::array<float,2>{0.941288412f, 0.0961109921f},
-std::array<float,2>{0.389308155f, 0.479494005f},
-std::array<float,2>{0.658774614f, 0.500955224f},
-std::array<float,2>{0.0415551327f, 0.640134811f},
-std::array<float,2>{0.928258836f, 0.331520051f},
-std::array<float,2>{0.462118417f, 0.148841918f},
-std::array<float,2>{0.745821476f, 0.833774507f},
-std::array<float,2>{0.354085237f, 0.945282817f},
-std::array<float,2>{0.526306808f, 0.0563763566f},
-std::array<float,2>{0.203615472f, 0.423923731f},
-std::array<float,2>{0.848624766f, 0.592058182f},
-std::array<float,2>{0.41151318f, 0.539200127f},
-std::array<float,2>{0.625704467f, 0.460403174f},
-std::array<float,2>{0.12172047f, 0.0632477328f},
-std::array<float,2>{0.998078346f, 0.933805406f},
-std::array<float,2>{0.174235776f, 0.77391988f},
-std::array<float,2>{0.772335827f, 0.219879389f},
-std::array<float,2>{0.2795012f, 0.278641313f},
-std::array<float,2>{0.592627585f, 0.701736152f},
-std::array<float,2>{0.0980714336f, 0.521581769f},
-std::array<float,2>{0.982797503f, 0.496358633f},
-std::array<float,2>{0.435310781f, 0.11152482f},
-std::array<float,2>{0.651394963f, 0.88989085f},
-std::array<float,2>{0.252308667f, 0.806552231f},
-std::array<float,2>{0.571270823f, 0.192080796f},
-std::array<float,2>{0.161270782f, 0.293186605f},
-std::array<float,2>{0.757148981f, 0.7204386f},
-std::array<float,2>{0.446967185f, 0.65789485f},
-std::array<float,2>{0.719079018f, 0.362213165f},
-std::array<float,2>{0.0479697436f, 0.184000075f},
-std::array<float,2>{0.908890843f, 0.847368419f},
-std::array<float,2>{0.19430165f, 0.981594563f},
-std::array<float,2>{0.870499671f, 0.0104934545f},
-std::array<float,2>{0.370876044f, 0.39436385f},
-std::array<float,2>{0.514013469f, 0.621534646f},
-std::array<float,2>{0.133986712f, 0.707334876f},
-std::array<float,2>{0.807202935f, 0.262834251f},
-std::array<float,2>{0.302500486f, 0.239526778f},
-std::array<float,2>{0.609270215f, 0.761094987f},
-std::array<float,2>{0.397963613f, 0.913975418f},
-std::array<float,2>{0.684171498f, 0.0931077078f},
-std::array<float,2>{0.0875883177f, 0.452088475f},
-std::array<float,2>{0.959611535f, 0.54907155f},
-std::array<float,2>{0.322063774f, 0.567383468f},
-std::array<float,2>{0.546021581f, 0.409880489f},
-std::array<float,2>{0.234604686f, 0.0365139879f},
-std::array<float,2>{0.815876544f, 0.958201706f},
-std::array<float,2>{0.0184792988f, 0.8194561f},
-std::array<float,2>{0.900920331f, 0.137054443f},
-std::array<float,2>{0.495667905f, 0.321838826f},
-std::array<float,2>{0.705744267f, 0.653087676f},
-std::array<float,2>{0.171680793f, 0.560076714f},
-std::array<float,2>{0.764510036f, 0.440413088f},
-std::array<float,2>{0.260644257f, 0.0795903057f},
-std::array<float,2>{0.568493307f, 0.914129078f},
-std::array<float,2>{0.42754817f, 0.752714813f},
-std::array<float,2>{0.64093864f, 0.24885568f},
-std::array<float,2>{0.104234248f, 0.252698749f},
-std::array<float,2>{0.976166964f, 0.718464494f},
-std::array<float,2>{0.365069091f, 0.645015001f},
-std::array<float,2>{0.506708324f, 0.317941278f},
-std::array<float,2>{0.201096117f, 0.130462989f},
-std::array<float,2>{0.862137556f, 0.82546562f},
-std::array<float,2>{0.0552069917f, 0.963843524f},
-std::array<float,2>{0.915155709f, 0.0400985926f},
-std::array<float,2>{0.444710881f, 0.418928862f},
-std::array<float,2>{0.73300463f, 0.571784973f},
-std::array<float,2>{0.0849128291f, 0.733751178f},
-std::array<float,2>{0.963369608f, 0.282272995f},
-std::array<float,2>{0.399552524f, 0.202346414f},
-std::array<float,2>{0.674625874f, 0.803653359f},
-std::array<float,2>{0.305960268f, 0.88267982f},
-std::array<float,2>{0.596524954f, 0.120924585f},
-std::array<float,2>{0.128144234f, 0.490438461f},
-std::array<float,2>{0.798081875f, 0.529204905f},
-std::array<float,2>{0.487984449f, 0.615701377f},
-std::array<float,2>{0.714403272f, 0.400164902f},
-std::array<float,2>{0.0277705286f, 0.000321618223f},
-std::array<float,2>{0.890671849f, 0.97227633f},
-std::array<float,2>{0.242465496f, 0.852484822f},
-std::array<float,2>{0.821812451f, 0.173042119f},
-std::array<float,2>{0.317325622f, 0.368219435f},
-std::array<float,2>{0.535486698f, 0.667492628f},
-std::array<float,2>{0.00232000067f, 0.578253508f},
-std::array<float,2>{0.887633801f, 0.432389081f},
-std::array<float,2>{0.473514587f, 0.0517531112f},
-std::array<float,2>{0.697830081f, 0.952149928f},
-std::array<float,2>{0.331938207f, 0.839142561f},
-std::array<float,2>{0.554143488f, 0.141633093f},
-std::array<float,2>{0.231729656f, 0.340739489f},
-std::array<float,2>{0.833410919f, 0.631008267f},
-std::array<float,2>{0.378604174f, 0.693175316f},
-std::array<float,2>{0.664950609f, 0.271704644f},
-std::array<float,2>{0.0775369108f, 0.234291241f},
-std::array<float,2>{0.947233796f, 0.76928103f},
-std::array<float,2>{0.144226968f, 0.92245537f},
-std::array<float,2>{0.791479647f, 0.0742416754f},
-std::array<float,2>{0.283354312f, 0.468221843f},
-std::array<float,2>{0.609660327f, 0.53551209f},
-std::array<float,2>{0.213953346f, 0.68403852f},
-std::array<float,2>{0.858020067f, 0.351458549f},
-std::array<float,2>{0.348911613f, 0.166869193f},
-std::array<float,2>{0.518381536f, 0.870863438f},
-std::array<float,2>{0.455599964f, 0.990684927f},
-std::array<float,2>{0.734678388f, 0.0198008548f},
-std::array<float,2>{0.0325556472f, 0.382465273f},
-std::array<float,2>{0.930637419f, 0.597334623f},
-std::array<float,2>{0.272681892f, 0.514411688f},
-std::array<float,2>{0.581304669f, 0.473226279f},
-std::array<float,2>{0.184892178f, 0.107811876f},
-std::array<float,2>{0.774683416f, 0.894814134f},
-std::array<float,2>{0.111614503f, 0.783689678f},
-std::array<float,2>{0.990630984f, 0.212031171f},
-std::array<float,2>{0.417566806f, 0.305596381f},
-std::array<float,2>{0.633638799f, 0.743807554f},
-std::array<float,2>{0.177449033f, 0.611530066f},
-std::array<float,2>{0.766264737f, 0.404701173f},
-std::array<float,2>{0.275668293f, 0.00440310873f},
-std::array<float,2>{0.589237511f, 0.973038673f},
-std::array<float,2>{0.406600744f, 0.856093824f},
-std::array<float,2>{0.63013941f, 0.178601071f},
-std::array<float,2>{0.12078663f, 0.371404529f},
-std::array<float,2>{0.994694471f, 0.668448746f},
-std::array<float,2>{0.357024163f, 0.727063835f},
-std::array<float,2>{0.529328346f, 0.289027005f},
-std::array<float,2>{0.210749313f, 0.198637992f},
-std::array<float,2>{0.846176267f, 0.798899412f},
-std::array<float,2>{0.0452741832f, 0.875974059f},
-std::array<float,2>{0.922748208f, 0.123509042f},
-std::array<float,2>{0.468203038f, 0.486582756f},
-std::array<float,2>{0.748371243f, 0.524442494f},
-std::array<float,2>{0.0659810454f, 0.642571092f},
-std::array<float,2>{0.945237815f, 0.316032857f},
-std::array<float,2>{0.386421353f, 0.128606275f},
-std::array<float,2>{0.661803722f, 0.823476672f},
-std::array<float,2>{0.296294928f, 0.967663527f},
-std::array<float,2>{0.620212436f, 0.044242993f},
-std::array<float,2>{0.151976019f, 0.417789489f},
-std::array<float,2>{0.784690499f, 0.577670097f},
-std::array<float,2>{0.479995191f, 0.55730933f},
-std::array<float,2>{0.689988375f, 0.442413598f},
-std::array<float,2>{0.0142970746f, 0.0856004432f},
-std::array<float,2>{0.881354868f, 0.918107688f},
-std::array<float,2>{0.22402212f, 0.756385326f},
-std::array<float,2>{0.84133476f, 0.243513435f},
-std::array<float,2>{0.336941272f, 0.257024646f},
-std::array<float,2>{0.556200802f, 0.712033033f},
-std::array<float,2>{0.0203509592f, 0.50996542f},
-std::array<float,2>{0.905201554f, 0.470988572f},
-std::array<float,2>{0.49881056f, 0.105432987f},
-std::array<float,2>{0.710759342f, 0.891818166f},
-std::array<float,2>{0.326415122f, 0.787659466f},
-std::array<float,2>{0.539809763f, 0.216494545f},
-std::array<float,2>{0.239865109f, 0.309265554f},
-std::array<float,2>{0.818618298f, 0.746113002f},
-std::array<float,2>{0.393227607f, 0.681534648f},
-std::array<float,2>{0.68298918f, 0.345482171f},
-std::array<float,2>{0.0933478251f, 0.169750154f},
-std::array<float,2>{0.9537009f, 0.872697771f},
-std::array<float,2>{0.140014023f, 0.985705435f},
-std::array<float,2>{0.808708012f, 0.0173382834f},
-std::array<float,2>{0.297015995f, 0.376152068f},
-std::array<float,2>{0.604427874f, 0.59776324f},
-std::array<float,2>{0.191058099f, 0.687828422f},
-std::array<float,2>{0.873708963f, 0.265674025f},
-std::array<float,2>{0.374893248f, 0.229731545f},
-std::array<float,2>{0.508011878f, 0.772313476f},
-std::array<float,2>{0.449542224f, 0.928538501f},
-std::array<float,2>{0.723771453f, 0.0708591565f},
-std::array<float,2>{0.0537892208f, 0.460974276f},
-std::array<float,2>{0.911742568f, 0.533452034f},
-std::array<float,2>{0.255960941f, 0.582422376f},
-std::array<float,2>{0.575774133f, 0.437414765f},
-std::array<float,2>{0.15750064f, 0.0500065908f},
-std::array<float,2>{0.752561867f, 0.945421159f},
-std::array<float,2>{0.0938461572f, 0.840339541f},
-std::array<float,2>{0.980350375f, 0.147564217f},
-std::array<float,2>{0.430436611f, 0.338631094f},
-std::array<float,2>{0.653845787f, 0.627891302f},
-std::array<float,2>{0.246372014f, 0.543144226f},
-std::array<float,2>{0.825741112f, 0.454962969f},
-std::array<float,2>{0.314337105f, 0.0686401054f},
-std::array<float,2>{0.532054126f, 0.931123674f},
-std::array<float,2>{0.491361707f, 0.779162049f},
-std::array<float,2>{0.718366265f, 0.223804966f},
-std::array<float,2>{0.0245934818f, 0.274433076f},
-std::array<float,2>{0.896405756f, 0.696357608f},
-std::array<float,2>{0.312099338f, 0.634231508f},
-std::array<float,2>{0.599088669f, 0.334902078f},
-std::array<float,2>{0.131447792f, 0.155617461f},
-std::array<float,2>{0.802240968f, 0.831140339f},
-std::array<float,2>{0.0804453939f, 0.939453483f},
-std::array<float,2>{0.968285441f, 0.0607068427f},
-std::array<float,2>{0.405594945f, 0.429583788f},
-std::array<float,2>{0.677882791f, 0.588502169f},
-std::array<float,2>{0.0600181669f, 0.736525834f},
-std::array<float,2>{0.921715498f, 0.298180938f},
-std::array<float,2>{0.441152275f, 0.206574246f},
-std::array<float,2>{0.727005899f, 0.790469825f},
-std::array<float,2>{0.359988391f, 0.90236342f},
-std::array<float,2>{0.503051817f, 0.0995292887f},
-std::array<float,2>{0.196375638f, 0.483430654f},
-std::array<float,2>{0.865266979f, 0.506084919f},
-std::array<float,2>{0.424776703f, 0.608312547f},
-std::array<float,2>{0.645717263f, 0.38332513f},
-std::array<float,2>{0.108419143f, 0.0289718434f},
-std::array<float,2>{0.971259594f, 0.99922663f},
-std::array<float,2>{0.165168077f, 0.859854698f},
-std::array<float,2>{0.760713279f, 0.163599893f},
-std::array<float,2>{0.263074011f, 0.353282809f},
-std::array<float,2>{0.564715505f, 0.672729611f},
-std::array<float,2>{0.113641627f, 0.564552963f},
-std::array<float,2>{0.984565377f, 0.411561102f},
-std::array<float,2>{0.420664936f, 0.033602193f},
-std::array<float,2>{0.638058126f, 0.956901848f},
-std::array<float,2>{0.269311368f, 0.815525115f},
-std::array<float,2>{0.585460484f, 0.135681674f},
-std::array<float,2>{0.182190359f, 0.32743904f},
-std::array<float,2>{0.779531419f, 0.651384115f},
-std::array<float,2>{0.460075021f, 0.704384923f},
-std::array<float,2>{0.73965168f, 0.258566946f},
-std::array<float,2>{0.0358799659f, 0.2348997f},
-std::array<float,2>{0.935556829f, 0.762890995f},
-std::array<float,2>{0.215754017f, 0.909313798f},
-std::array<float,2>{0.852366149f, 0.0867607594f},
-std::array<float,2>{0.347599f, 0.447460711f},
-std::array<float,2>{0.521830142f, 0.551702559f},
-std::array<float,2>{0.147271276f, 0.660777986f},
-std::array<float,2>{0.79298526f, 0.365479499f},
-std::array<float,2>{0.287014097f, 0.183462575f},
-std::array<float,2>{0.61488533f, 0.850725293f},
-std::array<float,2>{0.382259458f, 0.98001647f},
-std::array<float,2>{0.670114756f, 0.0130528742f},
-std::array<float,2>{0.0727567449f, 0.397648364f},
-std::array<float,2>{0.951516032f, 0.619234383f},
-std::array<float,2>{0.334914505f, 0.516830385f},
-std::array<float,2>{0.547694921f, 0.493925959f},
-std::array<float,2>{0.227071807f, 0.114748411f},
-std::array<float,2>{0.829358935f, 0.883798301f},
-std::array<float,2>{0.00568270404f, 0.811894238f},
-std::array<float,2>{0.885928988f, 0.187642425f},
-std::array<float,2>{0.469079882f, 0.292886883f},
-std::array<float,2>{0.701321721f, 0.722740054f},
-std::array<float,2>{0.20563519f, 0.591013849f},
-std::array<float,2>{0.851482689f, 0.422813058f},
-std::array<float,2>{0.353385985f, 0.0574469231f},
-std::array<float,2>{0.525226712f, 0.941934347f},
-std::array<float,2>{0.464320362f, 0.83412993f},
-std::array<float,2>{0.742727697f, 0.152013153f},
-std::array<float,2>{0.0408543944f, 0.328129649f},
-std::array<float,2>{0.927571476f, 0.638546824f},
-std::array<float,2>{0.279086262f, 0.701072037f},
-std::array<float,2>{0.590349317f, 0.280389935f},
-std::array<float,2>{0.172542065f, 0.22183378f},
-std::array<float,2>{0.770730197f, 0.777258754f},
-std::array<float,2>{0.124668948f, 0.937172651f},
-std::array<float,2>{0.99686861f, 0.0648905784f},
-std::array<float,2>{0.413481802f, 0.458015084f},
-std::array<float,2>{0.627008379f, 0.54248786f},
-std::array<float,2>{0.00856090523f, 0.678203106f},
-std::array<float,2>{0.87815696f, 0.357665449f},
-std::array<float,2>{0.481494904f, 0.158024803f},
-std::array<float,2>{0.693760276f, 0.863768578f},
-std::array<float,2>{0.340195507f, 0.995253921f},
-std::array<float,2>{0.559446335f, 0.0266566891f},
-std::array<float,2>{0.219683483f, 0.387267083f},
-std::array<float,2>{0.83795923f, 0.604164898f},
-std::array<float,2>{0.387190253f, 0.502028406f},
-std::array<float,2>{0.656808853f, 0.478429943f},
-std::array<float,2>{0.0675968304f, 0.0956939906f},
-std::array<float,2>{0.939185143f, 0.900893688f},
-std::array<float,2>{0.154581845f, 0.796153665f},
-std::array<float,2>{0.78760761f, 0.207344681f},
-std::array<float,2>{0.292415947f, 0.30208829f},
-std::array<float,2>{0.621117294f, 0.741865218f},
-std::array<float,2>{0.0887623057f, 0.548278868f},
-std::array<float,2>{0.958653688f, 0.450746477f},
-std::array<float,2>{0.396116525f, 0.0917597413f},
-std::array<float,2>{0.686641514f, 0.911657214f},
-std::array<float,2>{0.304388493f, 0.759193957f},
-std::array<float,2>{0.606668591f, 0.240366831f},
-std::array<float,2>{0.135410994f, 0.264328212f},
-std::array<float,2>{0.806084573f, 0.710247517f},
-std::array<float,2>{0.493448973f, 0.655046582f},
-std::array<float,2>{0.703161955f, 0.322457314f},
-std::array<float,2>{0.0166937876f, 0.139128521f},
-std::array<float,2>{0.899732113f, 0.817275167f},
-std::array<float,2>{0.237913087f, 0.959332108f},
-std::array<float,2>{0.814212382f, 0.0389234833f},
-std::array<float,2>{0.324037671f, 0.406706244f},
-std::array<float,2>{0.543874979f, 0.569770098f},
-std::array<float,2>{0.163962513f, 0.720988631f},
-std::array<float,2>{0.754041314f, 0.295508623f},
-std::array<float,2>{0.250620514f, 0.195284754f},
-std::array<float,2>{0.572694063f, 0.808010459f},
-std::array<float,2>{0.435798168f, 0.888429284f},
-std::array<float,2>{0.648462176f, 0.110124283f},
-std::array<float,2>{0.100991704f, 0.498529494f},
-std::array<float,2>{0.981871903f, 0.519827485f},
-std::array<float,2>{0.367659658f, 0.623383284f},
-std::array<float,2>{0.512701273f, 0.392311573f},
-std::array<float,2>{0.192965791f, 0.00908064097f},
-std::array<float,2>{0.86821425f, 0.983279586f},
-std::array<float,2>{0.0489812121f, 0.844909906f},
-std::array<float,2>{0.906276286f, 0.185705394f},
-std::array<float,2>{0.447510332f, 0.360509098f},
-std::array<float,2>{0.721757948f, 0.658631086f},
-std::array<float,2>{0.125612259f, 0.530869007f},
-std::array<float,2>{0.80075568f, 0.489621192f},
-std::array<float,2>{0.308092326f, 0.118074499f},
-std::array<float,2>{0.595089257f, 0.879382312f},
-std::array<float,2>{0.400769651f, 0.801054418f},
-std::array<float,2>{0.6732319f, 0.199590102f},
-std::array<float,2>{0.0836906284f, 0.283446401f},
-std::array<float,2>{0.961567819f, 0.730814576f},
-std::array<float,2>{0.318631113f, 0.665157855f},
-std::array<float,2>{0.538300693f, 0.369721025f},
-std::array<float,2>{0.244499773f, 0.174311981f},
-std::array<float,2>{0.822906435f, 0.855347872f},
-std::array<float,2>{0.0294845644f, 0.970177352f},
-std::array<float,2>{0.894502342f, 0.0028664011f},
-std::array<float,2>{0.484911561f, 0.40119195f},
-std::array<float,2>{0.711393476f, 0.613391042f},
-std::array<float,2>{0.102628663f, 0.715512455f},
-std::array<float,2>{0.973365247f, 0.25184226f},
-std::array<float,2>{0.428464592f, 0.247711137f},
-std::array<float,2>{0.644495964f, 0.751603305f},
-std::array<float,2>{0.258191109f, 0.917556524f},
-std::array<float,2>{0.567384422f, 0.0802020207f},
-std::array<float,2>{0.169920012f, 0.438934624f},
-std::array<float,2>{0.762187064f, 0.562342644f},
-std::array<float,2>{0.442608893f, 0.572691619f},
-std::array<float,2>{0.732316196f, 0.421851158f},
-std::array<float,2>{0.0578020364f, 0.0410309136f},
-std::array<float,2>{0.91741538f, 0.962571919f},
-std::array<float,2>{0.20300217f, 0.827293038f},
-std::array<float,2>{0.860396266f, 0.132057056f},
-std::array<float,2>{0.366471052f, 0.318462044f},
-std::array<float,2>{0.504529953f, 0.646996021f},
-std::array<float,2>{0.03449798f, 0.5941239f},
-std::array<float,2>{0.933257818f, 0.380619407f},
-std::array<float,2>{0.454130173f, 0.0225104708f},
-std::array<float,2>{0.736955285f, 0.989469945f},
-std::array<float,2>{0.350977629f, 0.86779952f},
-std::array<float,2>{0.516828299f, 0.165301442f},
-std::array<float,2>{0.211551145f, 0.347683787f},
-std::array<float,2>{0.856478035f, 0.686882913f},
-std::array<float,2>{0.414360166f, 0.744994044f},
-std::array<float,2>{0.635975361f, 0.308087468f},
-std::array<float,2>{0.109878831f, 0.214390039f},
-std::array<float,2>{0.989045858f, 0.783010125f},
-std::array<float,2>{0.186298892f, 0.897758126f},
-std::array<float,2>{0.776683807f, 0.106968403f},
-std::array<float,2>{0.27100879f, 0.476193458f},
-std::array<float,2>{0.579241157f, 0.512822509f},
-std::array<float,2>{0.233398899f, 0.629839063f},
-std::array<float,2>{0.83580786f, 0.342386067f},
-std::array<float,2>{0.328374356f, 0.143257141f},
-std::array<float,2>{0.551730394f, 0.836917639f},
-std::array<float,2>{0.476413429f, 0.949379623f},
-std::array<float,2>{0.696374238f, 0.0539234057f},
-std::array<float,2>{0.00122824719f, 0.430893689f},
-std::array<float,2>{0.889283836f, 0.580635309f},
-std::array<float,2>{0.28220889f, 0.538825452f},
-std::array<float,2>{0.61209017f, 0.4657166f},
-std::array<float,2>{0.141311988f, 0.0763906017f},
-std::array<float,2>{0.790044188f, 0.924011469f},
-std::array<float,2>{0.0746772587f, 0.767234147f},
-std::array<float,2>{0.948200583f, 0.230987668f},
-std::array<float,2>{0.376108974f, 0.26971215f},
-std::array<float,2>{0.66708982f, 0.693938196f},
-std::array<float,2>{0.137462199f, 0.598905504f},
-std::array<float,2>{0.811289847f, 0.37523514f},
-std::array<float,2>{0.300587058f, 0.0164002217f},
-std::array<float,2>{0.603209078f, 0.985015452f},
-std::array<float,2>{0.391200483f, 0.871888459f},
-std::array<float,2>{0.680739343f, 0.168280274f},
-std::array<float,2>{0.0912397727f, 0.344367802f},
-std::array<float,2>{0.95541954f, 0.680136025f},
-std::array<float,2>{0.324948519f, 0.747503877f},
-std::array<float,2>{0.541629851f, 0.309926838f},
-std::array<float,2>{0.241194919f, 0.214941099f},
-std::array<float,2>{0.816789329f, 0.788400114f},
-std::array<float,2>{0.0226290654f, 0.891363859f},
-std::array<float,2>{0.902726948f, 0.103932053f},
-std::array<float,2>{0.497385114f, 0.471780688f},
-std::array<float,2>{0.708540618f, 0.511397719f},
-std::array<float,2>{0.0970798805f, 0.628582954f},
-std::array<float,2>{0.977940857f, 0.339250565f},
-std::array<float,2>{0.432785779f, 0.147351474f},
-std::array<float,2>{0.655114233f, 0.841528177f},
-std::array<float,2>{0.255230516f, 0.946872413f},
-std::array<float,2>{0.576353192f, 0.0490035824f},
-std::array<float,2>{0.159604385f, 0.436088383f},
-std::array<float,2>{0.751906395f, 0.583753705f},
-std::array<float,2>{0.451467872f, 0.534431815f},
-std::array<float,2>{0.725483477f, 0.462090284f},
-std::array<float,2>{0.0514568612f, 0.0715196505f},
-std::array<float,2>{0.913840413f, 0.929529488f},
-std::array<float,2>{0.188697264f, 0.772994995f},
-std::array<float,2>{0.872312069f, 0.229250252f},
-std::array<float,2>{0.371724218f, 0.267498434f},
-std::array<float,2>{0.511493325f, 0.688828409f},
-std::array<float,2>{0.0437586419f, 0.523535013f},
-std::array<float,2>{0.925438941f, 0.487714142f},
-std::array<float,2>{0.466093928f, 0.124282151f},
-std::array<float,2>{0.747542858f, 0.876453638f},
-std::array<float,2>{0.358901203f, 0.799825072f},
-std::array<float,2>{0.528650522f, 0.197618246f},
-std::array<float,2>{0.207630023f, 0.287265718f},
-std::array<float,2>{0.84441191f, 0.728164554f},
-std::array<float,2>{0.409940958f, 0.669503808f},
-std::array<float,2>{0.631305337f, 0.372970462f},
-std::array<float,2>{0.117421098f, 0.179222643f},
-std::array<float,2>{0.993531227f, 0.856955767f},
-std::array<float,2>{0.179270834f, 0.973892093f},
-std::array<float,2>{0.769518912f, 0.00511081936f},
-std::array<float,2>{0.274877161f, 0.405907154f},
-std::array<float,2>{0.587733924f, 0.612483561f},
-std::array<float,2>{0.224704415f, 0.711612821f},
-std::array<float,2>{0.843614221f, 0.25660634f},
-std::array<float,2>{0.339527398f, 0.242510438f},
-std::array<float,2>{0.557337224f, 0.757705331f},
-std::array<float,2>{0.477895975f, 0.919476926f},
-std::array<float,2>{0.687515199f, 0.0842127502f},
-std::array<float,2>{0.0129578412f, 0.442272425f},
-std::array<float,2>{0.879304528f, 0.558163881f},
-std::array<float,2>{0.294405937f, 0.576190412f},
-std::array<float,2>{0.617737114f, 0.416281104f},
-std::array<float,2>{0.150090337f, 0.0432277322f},
-std::array<float,2>{0.781680346f, 0.968026936f},
-std::array<float,2>{0.0626188219f, 0.822709799f},
-std::array<float,2>{0.941658437f, 0.127355203f},
-std::array<float,2>{0.384681344f, 0.314955115f},
-std::array<float,2>{0.662242532f, 0.641149759f},
-std::array<float,2>{0.216859087f, 0.551780939f},
-std::array<float,2>{0.855370879f, 0.448422581f},
-std::array<float,2>{0.34471181f, 0.0878853053f},
-std::array<float,2>{0.519588888f, 0.908352435f},
-std::array<float,2>{0.458058447f, 0.762050569f},
-std::array<float,2>{0.741796911f, 0.235510275f},
-std::array<float,2>{0.0383296162f, 0.259630352f},
-std::array<float,2>{0.935406566f, 0.703404069f},
-std::array<float,2>{0.266536593f, 0.650885701f},
-std::array<float,2>{0.5838328f, 0.326936901f},
-std::array<float,2>{0.180811346f, 0.136147052f},
-std::array<float,2>{0.778351724f, 0.815373302f},
-std::array<float,2>{0.115436316f, 0.955974519f},
-std::array<float,2>{0.987988651f, 0.0350694247f},
-std::array<float,2>{0.418586701f, 0.410219997f},
-std::array<float,2>{0.638693869f, 0.566156685f},
-std::array<float,2>{0.00682872813f, 0.724165559f},
-std::array<float,2>{0.884686053f, 0.291067958f},
-std::array<float,2>{0.472570628f, 0.189247981f},
-std::array<float,2>{0.69978112f, 0.811173737f},
-std::array<float,2>{0.332950294f, 0.883377254f},
-std::array<float,2>{0.550379813f, 0.113699846f},
-std::array<float,2>{0.229088888f, 0.492640078f},
-std::array<float,2>{0.830540478f, 0.51631391f},
-std::array<float,2>{0.379060984f, 0.620676458f},
-std::array<float,2>{0.669875741f, 0.396798253f},
-std::array<float,2>{0.072229661f, 0.0118992273f},
-std::array<float,2>{0.949960828f, 0.979136944f},
-std::array<float,2>{0.146023393f, 0.850327373f},
-std::array<float,2>{0.796688914f, 0.182549328f},
-std::array<float,2>{0.288403481f, 0.36645636f},
-std::array<float,2>{0.615636706f, 0.661874652f},
-std::array<float,2>{0.079283528f, 0.58887881f},
-std::array<float,2>{0.965450943f, 0.428494692f},
-std::array<float,2>{0.402673244f, 0.0617397912f},
-std::array<float,2>{0.675852299f, 0.94116205f},
-std::array<float,2>{0.308757216f, 0.830525219f},
-std::array<float,2>{0.600052178f, 0.154793039f},
-std::array<float,2>{0.130583212f, 0.335217655f},
-std::array<float,2>{0.803692937f, 0.632838011f},
-std::array<float,2>{0.489931345f, 0.6953758f},
-std::array<float,2>{0.715247869f, 0.273659855f},
-std::array<float,2>{0.0267115068f, 0.223573312f},
-std::array<float,2>{0.897475541f, 0.778092504f},
-std::array<float,2>{0.249483287f, 0.930014551f},
-std::array<float,2>{0.826178133f, 0.0702577457f},
-std::array<float,2>{0.314760566f, 0.453541398f},
-std::array<float,2>{0.535094082f, 0.544120312f},
-std::array<float,2>{0.16740416f, 0.673539937f},
-std::array<float,2>{0.759242415f, 0.35217014f},
-std::array<float,2>{0.26562497f, 0.162364587f},
-std::array<float,2>{0.562664986f, 0.86121273f},
-std::array<float,2>{0.421924472f, 0.998673797f},
-std::array<float,2>{0.646787405f, 0.02814872f},
-std::array<float,2>{0.107172333f, 0.384365261f},
-std::array<float,2>{0.969716251f, 0.609016061f},
-std::array<float,2>{0.361417919f, 0.507235825f},
-std::array<float,2>{0.501929402f, 0.48333028f},
-std::array<float,2>{0.197473466f, 0.0977980047f},
-std::array<float,2>{0.864336371f, 0.904222608f},
-std::array<float,2>{0.0613573566f, 0.789756358f},
-std::array<float,2>{0.919394374f, 0.206013784f},
-std::array<float,2>{0.439308077f, 0.297246724f},
-std::array<float,2>{0.728698075f, 0.737765551f},
-std::array<float,2>{0.236188546f, 0.569211543f},
-std::array<float,2>{0.814744055f, 0.407274157f},
-std::array<float,2>{0.320583731f, 0.0380817764f},
-std::array<float,2>{0.545153558f, 0.960564137f},
-std::array<float,2>{0.494260043f, 0.818184018f},
-std::array<float,2>{0.706383824f, 0.140610367f},
-std::array<float,2>{0.0189356487f, 0.324135005f},
-std::array<float,2>{0.901407719f, 0.655753076f},
-std::array<float,2>{0.300818205f, 0.709944129f},
-std::array<float,2>{0.608390749f, 0.26515162f},
-std::array<float,2>{0.132995248f, 0.242055371f},
-std::array<float,2>{0.808111012f, 0.757969201f},
-std::array<float,2>{0.086016275f, 0.910749674f},
-std::array<float,2>{0.960507572f, 0.0905907899f},
-std::array<float,2>{0.397200257f, 0.449443877f},
-std::array<float,2>{0.684865415f, 0.547177136f},
-std::array<float,2>{0.0478080362f, 0.659586787f},
-std::array<float,2>{0.909879148f, 0.360052109f},
-std::array<float,2>{0.445825815f, 0.186590865f},
-std::array<float,2>{0.720499098f, 0.843855977f},
-std::array<float,2>{0.37006104f, 0.983916342f},
-std::array<float,2>{0.515535891f, 0.00790596288f},
-std::array<float,2>{0.195004821f, 0.390989333f},
-std::array<float,2>{0.869452417f, 0.62498796f},
-std::array<float,2>{0.433782399f, 0.521422505f},
-std::array<float,2>{0.650872231f, 0.499408543f},
-std::array<float,2>{0.0992871448f, 0.110389084f},
-std::array<float,2>{0.983998239f, 0.887632906f},
-std::array<float,2>{0.160452873f, 0.807552814f},
-std::array<float,2>{0.756668389f, 0.193939805f},
-std::array<float,2>{0.253469229f, 0.296087116f},
-std::array<float,2>{0.571497202f, 0.722343266f},
-std::array<float,2>{0.122198656f, 0.541912258f},
-std::array<float,2>{0.999995053f, 0.457484424f},
-std::array<float,2>{0.410304993f, 0.0660652891f},
-std::array<float,2>{0.62656635f, 0.935826063f},
-std::array<float,2>{0.281238645f, 0.776348054f},
-std::array<float,2>{0.593448699f, 0.221370712f},
-std::array<float,2>{0.174992889f, 0.279657423f},
-std::array<float,2>{0.772696733f, 0.700187564f},
-std::array<float,2>{0.461342126f, 0.637092769f},
-std::array<float,2>{0.744324267f, 0.329822063f},
-std::array<float,2>{0.0420785807f, 0.1512492f},
-std::array<float,2>{0.929127574f, 0.835870624f},
-std::array<float,2>{0.204765707f, 0.943087578f},
-std::array<float,2>{0.849131286f, 0.05778547f},
-std::array<float,2>{0.35510993f, 0.423306882f},
-std::array<float,2>{0.52656579f, 0.589880705f},
-std::array<float,2>{0.153269365f, 0.740888238f},
-std::array<float,2>{0.786110878f, 0.30169788f},
-std::array<float,2>{0.289280534f, 0.208111212f},
-std::array<float,2>{0.624130845f, 0.79541254f},
-std::array<float,2>{0.390361965f, 0.901747823f},
-std::array<float,2>{0.659788668f, 0.093823269f},
-std::array<float,2>{0.0695832595f, 0.476998299f},
-std::array<float,2>{0.940234601f, 0.503358722f},
-std::array<float,2>{0.343148798f, 0.604685783f},
-std::array<float,2>{0.560829401f, 0.388561428f},
-std::array<float,2>{0.221732095f, 0.0260507911f},
-std::array<float,2>{0.836112499f, 0.994925082f},
-std::array<float,2>{0.0104909651f, 0.865195453f},
-std::array<float,2>{0.876244307f, 0.157224894f},
-std::array<float,2>{0.483845145f, 0.359168261f},
-std::array<float,2>{0.692590177f, 0.679003716f},
-std::array<float,2>{0.18383038f, 0.511959374f},
-std::array<float,2>{0.773632109f, 0.475113481f},
-std::array<float,2>{0.271924794f, 0.106112733f},
-std::array<float,2>{0.580868363f, 0.896556556f},
-std::array<float,2>{0.416969985f, 0.781345069f},
-std::array<float,2>{0.634400904f, 0.212892964f},
-std::array<float,2>{0.112581566f, 0.306816787f},
-std::array<float,2>{0.991864681f, 0.745517612f},
-std::array<float,2>{0.348176479f, 0.68608588f},
-std::array<float,2>{0.518626034f, 0.349502593f},
-std::array<float,2>{0.213399857f, 0.165028468f},
-std::array<float,2>{0.858689308f, 0.868679583f},
-std::array<float,2>{0.0315579735f, 0.988419533f},
-std::array<float,2>{0.931477606f, 0.0215107258f},
-std::array<float,2>{0.456489474f, 0.379420966f},
-std::array<float,2>{0.73543638f, 0.595399559f},
-std::array<float,2>{0.0765832514f, 0.695290744f},
-std::array<float,2>{0.94560957f, 0.271167845f},
-std::array<float,2>{0.377099216f, 0.232223347f},
-std::array<float,2>{0.665902436f, 0.766570389f},
-std::array<float,2>{0.284525216f, 0.925431013f},
-std::array<float,2>{0.611306369f, 0.077490449f},
-std::array<float,2>{0.142759591f, 0.46599251f},
-std::array<float,2>{0.792468607f, 0.537542522f},
-std::array<float,2>{0.473884851f, 0.581225455f},
-std::array<float,2>{0.698328197f, 0.429733902f},
-std::array<float,2>{0.00325737731f, 0.0537034385f},
-std::array<float,2>{0.888308108f, 0.950721562f},
-std::array<float,2>{0.230508074f, 0.835949004f},
-std::array<float,2>{0.832853138f, 0.14368704f},
-std::array<float,2>{0.330178678f, 0.343061179f},
-std::array<float,2>{0.553447545f, 0.630739868f},
-std::array<float,2>{0.0292403121f, 0.61509949f},
-std::array<float,2>{0.892417908f, 0.401628852f},
-std::array<float,2>{0.486590058f, 0.0036377965f},
-std::array<float,2>{0.713147819f, 0.968862116f},
-std::array<float,2>{0.31756109f, 0.854018986f},
-std::array<float,2>{0.53663367f, 0.17489922f},
-std::array<float,2>{0.243887797f, 0.370984435f},
-std::array<float,2>{0.821285605f, 0.664240837f},
-std::array<float,2>{0.398506224f, 0.731877863f},
-std::array<float,2>{0.675379157f, 0.284377843f},
-std::array<float,2>{0.0851552635f, 0.201001689f},
-std::array<float,2>{0.964738548f, 0.801908493f},
-std::array<float,2>{0.127191722f, 0.880087852f},
-std::array<float,2>{0.797759295f, 0.118600801f},
-std::array<float,2>{0.305061758f, 0.48876816f},
-std::array<float,2>{0.597602963f, 0.529779017f},
-std::array<float,2>{0.199891314f, 0.64823097f},
-std::array<float,2>{0.862753451f, 0.320304871f},
-std::array<float,2>{0.363636196f, 0.131029025f},
-std::array<float,2>{0.507004857f, 0.826380908f},
-std::array<float,2>{0.443450838f, 0.961730957f},
-std::array<float,2>{0.733829379f, 0.0424616635f},
-std::array<float,2>{0.0556745306f, 0.420088172f},
-std::array<float,2>{0.914506316f, 0.57385844f},
-std::array<float,2>{0.261640877f, 0.561003923f},
-std::array<float,2>{0.56974113f, 0.437856883f},
-std::array<float,2>{0.170163155f, 0.0815599486f},
-std::array<float,2>{0.765086293f, 0.916944742f},
-std::array<float,2>{0.104909241f, 0.750362396f},
-std::array<float,2>{0.97472924f, 0.246622056f},
-std::array<float,2>{0.426717699f, 0.250307143f},
-std::array<float,2>{0.641866565f, 0.716427565f},
-std::array<float,2>{0.156727254f, 0.584285378f},
-std::array<float,2>{0.752995193f, 0.434815168f},
-std::array<float,2>{0.257106066f, 0.0475669689f},
-std::array<float,2>{0.574337602f, 0.947822273f},
-std::array<float,2>{0.431236804f, 0.843397081f},
-std::array<float,2>{0.652549505f, 0.145614982f},
-std::array<float,2>{0.0952450261f, 0.336330086f},
-std::array<float,2>{0.978782833f, 0.625803649f},
-std::array<float,2>{0.373702347f, 0.690892458f},
-std::array<float,2>{0.509561896f, 0.268789113f},
-std::array<float,2>{0.190417096f, 0.227577716f},
-std::array<float,2>{0.874165535f, 0.77138257f},
-std::array<float,2>{0.0528604873f, 0.927472591f},
-std::array<float,2>{0.910778522f, 0.0725901797f},
-std::array<float,2>{0.45037207f, 0.464193791f},
-std::array<float,2>{0.723442256f, 0.532632828f},
-std::array<float,2>{0.0918504521f, 0.682706654f},
-std::array<float,2>{0.955045462f, 0.346129656f},
-std::array<float,2>{0.393852234f, 0.171067923f},
-std::array<float,2>{0.682222784f, 0.87462914f},
-std::array<float,2>{0.298082978f, 0.987831354f},
-std::array<float,2>{0.604613364f, 0.0176287852f},
-std::array<float,2>{0.138987765f, 0.377676964f},
-std::array<float,2>{0.809908867f, 0.601287901f},
-std::array<float,2>{0.499109894f, 0.508578956f},
-std::array<float,2>{0.709181488f, 0.470552862f},
-std::array<float,2>{0.0205882676f, 0.102276377f},
-std::array<float,2>{0.905507267f, 0.892819405f},
-std::array<float,2>{0.238403991f, 0.787086666f},
-std::array<float,2>{0.819574296f, 0.218315735f},
-std::array<float,2>{0.327982664f, 0.312038422f},
-std::array<float,2>{0.540542901f, 0.749970555f},
-std::array<float,2>{0.0153352926f, 0.555853903f},
-std::array<float,2>{0.882163942f, 0.444100201f},
-std::array<float,2>{0.478856742f, 0.0829006359f},
-std::array<float,2>{0.690624595f, 0.920604706f},
-std::array<float,2>{0.336011767f, 0.75512886f},
-std::array<float,2>{0.554859042f, 0.244933948f},
-std::array<float,2>{0.223048404f, 0.254713178f},
-std::array<float,2>{0.840268135f, 0.714313269f},
-std::array<float,2>{0.385629594f, 0.643203139f},
-std::array<float,2>{0.660709083f, 0.314383149f},
-std::array<float,2>{0.065106295f, 0.125310823f},
-std::array<float,2>{0.94375062f, 0.821444094f},
-std::array<float,2>{0.151014417f, 0.966688216f},
-std::array<float,2>{0.784000039f, 0.0461126231f},
-std::array<float,2>{0.29570508f, 0.414278388f},
-std::array<float,2>{0.619553447f, 0.575899065f},
-std::array<float,2>{0.209627315f, 0.729641616f},
-std::array<float,2>{0.846836686f, 0.285728067f},
-std::array<float,2>{0.355546921f, 0.197001442f},
-std::array<float,2>{0.530303955f, 0.797795177f},
-std::array<float,2>{0.467071891f, 0.878786266f},
-std::array<float,2>{0.74960804f, 0.122119665f},
-std::array<float,2>{0.0466046408f, 0.484999895f},
-std::array<float,2>{0.923106492f, 0.526803434f},
-std::array<float,2>{0.277172506f, 0.610214353f},
-std::array<float,2>{0.588561118f, 0.404218674f},
-std::array<float,2>{0.17595163f, 0.0060786549f},
-std::array<float,2>{0.767017961f, 0.976471841f},
-std::array<float,2>{0.119576037f, 0.858567238f},
-std::array<float,2>{0.995924354f, 0.176538751f},
-std::array<float,2>{0.407506347f, 0.373952538f},
-std::array<float,2>{0.629155099f, 0.670418561f},
-std::array<float,2>{0.22826843f, 0.518027604f},
-std::array<float,2>{0.828849852f, 0.494423747f},
-std::array<float,2>{0.3351551f, 0.115347646f},
-std::array<float,2>{0.547870219f, 0.885799944f},
-std::array<float,2>{0.470596194f, 0.809791386f},
-std::array<float,2>{0.703110576f, 0.189520553f},
-std::array<float,2>{0.004304762f, 0.289549977f},
-std::array<float,2>{0.885726929f, 0.724738181f},
-std::array<float,2>{0.28555432f, 0.663902462f},
-std::array<float,2>{0.613921344f, 0.364481598f},
-std::array<float,2>{0.14838472f, 0.179706857f},
-std::array<float,2>{0.79443109f, 0.849222362f},
-std::array<float,2>{0.074090682f, 0.977174461f},
-std::array<float,2>{0.952535331f, 0.0153025435f},
-std::array<float,2>{0.380903035f, 0.394905984f},
-std::array<float,2>{0.671123624f, 0.619050264f},
-std::array<float,2>{0.0364368893f, 0.705623925f},
-std::array<float,2>{0.937257111f, 0.261155337f},
-std::array<float,2>{0.459872782f, 0.238097131f},
-std::array<float,2>{0.738544226f, 0.763979077f},
-std::array<float,2>{0.345959574f, 0.907143116f},
-std::array<float,2>{0.523299813f, 0.0897578374f},
-std::array<float,2>{0.216565356f, 0.446442574f},
-std::array<float,2>{0.852799177f, 0.553527057f},
-std::array<float,2>{0.421406329f, 0.564270496f},
-std::array<float,2>{0.637578249f, 0.412314892f},
-std::array<float,2>{0.115188673f, 0.0325594619f},
-std::array<float,2>{0.985912263f, 0.954954982f},
-std::array<float,2>{0.183331162f, 0.814032078f},
-std::array<float,2>{0.781024575f, 0.134671018f},
-std::array<float,2>{0.267998368f, 0.326137543f},
-std::array<float,2>{0.584482849f, 0.650180519f},
-std::array<float,2>{0.107547365f, 0.607358932f},
-std::array<float,2>{0.971699655f, 0.386715144f},
-std::array<float,2>{0.424844474f, 0.031016266f},
-std::array<float,2>{0.644794226f, 0.998010218f},
-std::array<float,2>{0.262430817f, 0.86296773f},
-std::array<float,2>{0.565939307f, 0.161428332f},
-std::array<float,2>{0.164975777f, 0.355435014f},
-std::array<float,2>{0.761132002f, 0.674764931f},
-std::array<float,2>{0.440204024f, 0.735833764f},
-std::array<float,2>{0.727727234f, 0.29976666f},
-std::array<float,2>{0.0590797514f, 0.204420328f},
-std::array<float,2>{0.920652568f, 0.79240495f},
-std::array<float,2>{0.196268678f, 0.905781507f},
-std::array<float,2>{0.8665874f, 0.0999677926f},
-std::array<float,2>{0.360871643f, 0.481603235f},
-std::array<float,2>{0.502820492f, 0.504777372f},
-std::array<float,2>{0.132714435f, 0.636208534f},
-std::array<float,2>{0.800918996f, 0.332850099f},
-std::array<float,2>{0.310586393f, 0.153805852f},
-std::array<float,2>{0.597801507f, 0.829559743f},
-std::array<float,2>{0.404835403f, 0.939212203f},
-std::array<float,2>{0.679374516f, 0.059836898f},
-std::array<float,2>{0.0812719315f, 0.426675946f},
-std::array<float,2>{0.967333376f, 0.587110221f},
-std::array<float,2>{0.313169867f, 0.54626286f},
-std::array<float,2>{0.532292306f, 0.456732452f},
-std::array<float,2>{0.24738577f, 0.067655921f},
-std::array<float,2>{0.824961066f, 0.932037294f},
-std::array<float,2>{0.023548374f, 0.780748963f},
-std::array<float,2>{0.894610822f, 0.225682676f},
-std::array<float,2>{0.490982205f, 0.275847107f},
-std::array<float,2>{0.71701175f, 0.699184835f},
-std::array<float,2>{0.1915977f, 0.62252593f},
-std::array<float,2>{0.867595911f, 0.393120974f},
-std::array<float,2>{0.368314952f, 0.0112126851f},
-std::array<float,2>{0.511945248f, 0.98075819f},
-std::array<float,2>{0.448695332f, 0.846229613f},
-std::array<float,2>{0.721081376f, 0.184716046f},
-std::array<float,2>{0.0503324606f, 0.362401456f},
-std::array<float,2>{0.907445133f, 0.656814337f},
-std::array<float,2>{0.25161168f, 0.719451547f},
-std::array<float,2>{0.57330966f, 0.294701278f},
-std::array<float,2>{0.162488997f, 0.192503154f},
-std::array<float,2>{0.754926503f, 0.805336475f},
-std::array<float,2>{0.0999071226f, 0.889096141f},
-std::array<float,2>{0.980948389f, 0.113264106f},
-std::array<float,2>{0.437490582f, 0.497925431f},
-std::array<float,2>{0.650180876f, 0.523122549f},
-std::array<float,2>{0.0162408762f, 0.653672934f},
-std::array<float,2>{0.898551643f, 0.321098834f},
-std::array<float,2>{0.492519021f, 0.138439938f},
-std::array<float,2>{0.704836786f, 0.819152355f},
-std::array<float,2>{0.32268092f, 0.957583785f},
-std::array<float,2>{0.544648767f, 0.0358076431f},
-std::array<float,2>{0.237152874f, 0.408852637f},
-std::array<float,2>{0.81343925f, 0.566670358f},
-std::array<float,2>{0.395320207f, 0.550456822f},
-std::array<float,2>{0.685613036f, 0.452149212f},
-std::array<float,2>{0.0894658566f, 0.0927543268f},
-std::array<float,2>{0.957870781f, 0.912953556f},
-std::array<float,2>{0.135861337f, 0.759815335f},
-std::array<float,2>{0.805073202f, 0.238978729f},
-std::array<float,2>{0.30326587f, 0.26224041f},
-std::array<float,2>{0.606221259f, 0.708373249f},
-std::array<float,2>{0.0672565699f, 0.501801312f},
-std::array<float,2>{0.938472927f, 0.479126543f},
-std::array<float,2>{0.388514608f, 0.0970364138f},
-std::array<float,2>{0.657233357f, 0.899698853f},
-std::array<float,2>{0.291833669f, 0.793604672f},
-std::array<float,2>{0.622723401f, 0.209842145f},
-std::array<float,2>{0.155350134f, 0.302766502f},
-std::array<float,2>{0.788432598f, 0.738556981f},
-std::array<float,2>{0.48106277f, 0.676731169f},
-std::array<float,2>{0.694680274f, 0.356447428f},
-std::array<float,2>{0.0095217973f, 0.158764943f},
-std::array<float,2>{0.877148211f, 0.866992414f},
-std::array<float,2>{0.220518231f, 0.992918134f},
-std::array<float,2>{0.839517355f, 0.0247951671f},
-std::array<float,2>{0.340950102f, 0.389493614f},
-std::array<float,2>{0.560218871f, 0.602133512f},
-std::array<float,2>{0.172966003f, 0.702521861f},
-std::array<float,2>{0.770477593f, 0.277750015f},
-std::array<float,2>{0.277455986f, 0.218804151f},
-std::array<float,2>{0.591684163f, 0.774474859f},
-std::array<float,2>{0.412249625f, 0.934965551f},
-std::array<float,2>{0.628181398f, 0.0636177287f},
-std::array<float,2>{0.123488083f, 0.459375352f},
-std::array<float,2>{0.997154772f, 0.540759683f},
-std::array<float,2>{0.352175415f, 0.592987895f},
-std::array<float,2>{0.523882926f, 0.424932063f},
-std::array<float,2>{0.206562132f, 0.0553145334f},
-std::array<float,2>{0.849778652f, 0.943983495f},
-std::array<float,2>{0.0391251557f, 0.832047224f},
-std::array<float,2>{0.926466525f, 0.150164932f},
-std::array<float,2>{0.46301496f, 0.330817997f},
-std::array<float,2>{0.743963838f, 0.639473736f},
-std::array<float,2>{0.142288476f, 0.536842883f},
-std::array<float,2>{0.789433181f, 0.467150003f},
-std::array<float,2>{0.283129066f, 0.0760639086f},
-std::array<float,2>{0.613097668f, 0.923083127f},
-std::array<float,2>{0.37517333f, 0.768415451f},
-std::array<float,2>{0.666226864f, 0.232439712f},
-std::array<float,2>{0.0760535002f, 0.272790879f},
-std::array<float,2>{0.94910872f, 0.691438735f},
-std::array<float,2>{0.329420209f, 0.631916165f},
-std::array<float,2>{0.552306235f, 0.341277361f},
-std::array<float,2>{0.232733384f, 0.140985325f},
-std::array<float,2>{0.834708571f, 0.838114321f},
-std::array<float,2>{0.000773148553f, 0.951701939f},
-std::array<float,2>{0.890062332f, 0.0520990416f},
-std::array<float,2>{0.475579679f, 0.43349123f},
-std::array<float,2>{0.696257651f, 0.579553664f},
-std::array<float,2>{0.110432915f, 0.742333829f},
-std::array<float,2>{0.990024447f, 0.306407988f},
-std::array<float,2>{0.415102422f, 0.211090639f},
-std::array<float,2>{0.63535434f, 0.784203529f},
-std::array<float,2>{0.269846916f, 0.895814538f},
-std::array<float,2>{0.578506112f, 0.108729295f},
-std::array<float,2>{0.186865732f, 0.473908067f},
-std::array<float,2>{0.77588141f, 0.514726818f},
-std::array<float,2>{0.453779519f, 0.596203208f},
-std::array<float,2>{0.738232553f, 0.381446868f},
-std::array<float,2>{0.0335749425f, 0.0208431222f},
-std::array<float,2>{0.931914449f, 0.992103994f},
-std::array<float,2>{0.21276322f, 0.870072126f},
-std::array<float,2>{0.855902374f, 0.167182595f},
-std::array<float,2>{0.350451589f, 0.349640936f},
-std::array<float,2>{0.516104162f, 0.685001016f},
-std::array<float,2>{0.0569329374f, 0.570695996f},
-std::array<float,2>{0.916753769f, 0.419917434f},
-std::array<float,2>{0.442022264f, 0.0392505042f},
-std::array<float,2>{0.731363714f, 0.964463413f},
-std::array<float,2>{0.365826428f, 0.824706733f},
-std::array<float,2>{0.505105019f, 0.129116058f},
-std::array<float,2>{0.201702163f, 0.316851318f},
-std::array<float,2>{0.86006254f, 0.646434128f},
-std::array<float,2>{0.429127336f, 0.717682898f},
-std::array<float,2>{0.643158793f, 0.253460974f},
-std::array<float,2>{0.10239879f, 0.249515757f},
-std::array<float,2>{0.974239111f, 0.753578544f},
-std::array<float,2>{0.168611974f, 0.915250599f},
-std::array<float,2>{0.763662815f, 0.078428559f},
-std::array<float,2>{0.259079427f, 0.441012084f},
-std::array<float,2>{0.566894948f, 0.559094131f},
-std::array<float,2>{0.245628178f, 0.666267395f},
-std::array<float,2>{0.823265493f, 0.367938936f},
-std::array<float,2>{0.319495857f, 0.172804728f},
-std::array<float,2>{0.537646055f, 0.853358805f},
-std::array<float,2>{0.485393196f, 0.970965683f},
-std::array<float,2>{0.712471187f, 0.00127619144f},
-std::array<float,2>{0.0302773565f, 0.39910537f},
-std::array<float,2>{0.893000901f, 0.616409898f},
-std::array<float,2>{0.307244807f, 0.528282702f},
-std::array<float,2>{0.594099879f, 0.491709918f},
-std::array<float,2>{0.12670517f, 0.120064221f},
-std::array<float,2>{0.7997033f, 0.881600559f},
-std::array<float,2>{0.0822392628f, 0.804155946f},
-std::array<float,2>{0.962777078f, 0.202064753f},
-std::array<float,2>{0.40201667f, 0.281778872f},
-std::array<float,2>{0.672113717f, 0.732699752f},
-std::array<float,2>{0.130262107f, 0.587431133f},
-std::array<float,2>{0.802797914f, 0.426025242f},
-std::array<float,2>{0.30944252f, 0.0602019876f},
-std::array<float,2>{0.600143552f, 0.938654244f},
-std::array<float,2>{0.403052717f, 0.829700947f},
-std::array<float,2>{0.67642647f, 0.154153779f},
-std::array<float,2>{0.0796408057f, 0.332082897f},
-std::array<float,2>{0.964975238f, 0.636404991f},
-std::array<float,2>{0.31541723f, 0.698252082f},
-std::array<float,2>{0.534302235f, 0.276285589f},
-std::array<float,2>{0.249588579f, 0.226121247f},
-std::array<float,2>{0.826767445f, 0.781209409f},
-std::array<float,2>{0.027291216f, 0.932505846f},
-std::array<float,2>{0.898330927f, 0.0679286793f},
-std::array<float,2>{0.489542753f, 0.45644635f},
-std::array<float,2>{0.715740085f, 0.546665132f},
-std::array<float,2>{0.10675592f, 0.673878133f},
-std::array<float,2>{0.968802273f, 0.354556173f},
-std::array<float,2>{0.422381103f, 0.161916733f},
-std::array<float,2>{0.647191465f, 0.862597883f},
-std::array<float,2>{0.265133232f, 0.997426093f},
-std::array<float,2>{0.563012719f, 0.0304640662f},
-std::array<float,2>{0.167722613f, 0.386158794f},
-std::array<float,2>{0.759368896f, 0.606804013f},
-std::array<float,2>{0.438922971f, 0.503959537f},
-std::array<float,2>{0.729486644f, 0.482345164f},
-std::array<float,2>{0.0609468371f, 0.100390077f},
-std::array<float,2>{0.919658601f, 0.905412793f},
-std::array<float,2>{0.198171839f, 0.792907715f},
-std::array<float,2>{0.864914179f, 0.204645142f},
-std::array<float,2>{0.362027436f, 0.299285799f},
-std::array<float,2>{0.50108701f, 0.736325741f},
-std::array<float,2>{0.0389108397f, 0.553003967f},
-std::array<float,2>{0.934819698f, 0.44689548f},
-std::array<float,2>{0.458670944f, 0.0888859704f},
-std::array<float,2>{0.741529882f, 0.90664959f},
-std::array<float,2>{0.343970984f, 0.76439774f},
-std::array<float,2>{0.520371318f, 0.237328127f},
-std::array<float,2>{0.217670396f, 0.26147601f},
-std::array<float,2>{0.854862988f, 0.705089569f},
-std::array<float,2>{0.418067098f, 0.649772704f},
-std::array<float,2>{0.639579713f, 0.325233251f},
-std::array<float,2>{0.115727775f, 0.133923545f},
-std::array<float,2>{0.987649143f, 0.813678741f},
-std::array<float,2>{0.181304768f, 0.954570115f},
-std::array<float,2>{0.778928697f, 0.0328513905f},
-std::array<float,2>{0.266111612f, 0.412636429f},
-std::array<float,2>{0.583486915f, 0.563502133f},
-std::array<float,2>{0.228662878f, 0.725376129f},
-std::array<float,2>{0.830668271f, 0.289886862f},
-std::array<float,2>{0.332235217f, 0.190034434f},
-std::array<float,2>{0.550041854f, 0.810081244f},
-std::array<float,2>{0.471705258f, 0.886369705f},
-std::array<float,2>{0.69938761f, 0.11586649f},
-std::array<float,2>{0.00600963691f, 0.495066881f},
-std::array<float,2>{0.883836627f, 0.518243611f},
-std::array<float,2>{0.28858012f, 0.618176043f},
-std::array<float,2>{0.616079986f, 0.395379245f},
-std::array<float,2>{0.145781845f, 0.0148136485f},
-std::array<float,2>{0.796144903f, 0.976947308f},
-std::array<float,2>{0.0714828596f, 0.848812282f},
-std::array<float,2>{0.949572921f, 0.180544868f},
-std::array<float,2>{0.379632413f, 0.365224421f},
-std::array<float,2>{0.669229627f, 0.663568854f},
-std::array<float,2>{0.207186848f, 0.527084768f},
-std::array<float,2>{0.84413296f, 0.484721273f},
-std::array<float,2>{0.358429343f, 0.122749239f},
-std::array<float,2>{0.528928578f, 0.878045559f},
-std::array<float,2>{0.466335714f, 0.797092855f},
-std::array<float,2>{0.74782598f, 0.196559697f},
-std::array<float,2>{0.0429714844f, 0.285325199f},
-std::array<float,2>{0.924894273f, 0.730029166f},
-std::array<float,2>{0.274993896f, 0.670278013f},
-std::array<float,2>{0.587124109f, 0.373355806f},
-std::array<float,2>{0.179074392f, 0.176097289f},
-std::array<float,2>{0.768884838f, 0.859260261f},
-std::array<float,2>{0.117952973f, 0.975709856f},
-std::array<float,2>{0.993739724f, 0.00672552409f},
-std::array<float,2>{0.409211695f, 0.403775841f},
-std::array<float,2>{0.631561756f, 0.609637737f},
-std::array<float,2>{0.0135252979f, 0.714612186f},
-std::array<float,2>{0.879523098f, 0.254310787f},
-std::array<float,2>{0.478297591f, 0.244351834f},
-std::array<float,2>{0.688212872f, 0.755460441f},
-std::array<float,2>{0.33920157f, 0.920287848f},
-std::array<float,2>{0.557046115f, 0.0820431635f},
-std::array<float,2>{0.225563258f, 0.443678826f},
-std::array<float,2>{0.842986882f, 0.556587815f},
-std::array<float,2>{0.38420099f, 0.57545352f},
-std::array<float,2>{0.662685513f, 0.414762914f},
-std::array<float,2>{0.0632428825f, 0.0465007648f},
-std::array<float,2>{0.942094922f, 0.965872943f},
-std::array<float,2>{0.149513349f, 0.822037518f},
-std::array<float,2>{0.782057405f, 0.125776857f},
-std::array<float,2>{0.294766724f, 0.313519359f},
-std::array<float,2>{0.617348671f, 0.643045604f},
-std::array<float,2>{0.0917080566f, 0.600796163f},
-std::array<float,2>{0.955843389f, 0.37735936f},
-std::array<float,2>{0.390849322f, 0.0185527299f},
-std::array<float,2>{0.681408942f, 0.987715602f},
-std::array<float,2>{0.300075084f, 0.87435776f},
-std::array<float,2>{0.602605045f, 0.171621889f},
-std::array<float,2>{0.137103438f, 0.346445024f},
-std::array<float,2>{0.810686648f, 0.683414876f},
-std::array<float,2>{0.497861892f, 0.749137521f},
-std::array<float,2>{0.708205402f, 0.311755508f},
-std::array<float,2>{0.0232183728f, 0.217839167f},
-std::array<float,2>{0.903120339f, 0.786584556f},
-std::array<float,2>{0.240388736f, 0.893136382f},
-std::array<float,2>{0.816922069f, 0.101801381f},
-std::array<float,2>{0.324647516f, 0.469928622f},
-std::array<float,2>{0.541079283f, 0.507943511f},
-std::array<float,2>{0.159801483f, 0.625028908f},
-std::array<float,2>{0.7513901f, 0.336881459f},
-std::array<float,2>{0.255409479f, 0.146471664f},
-std::array<float,2>{0.576704025f, 0.842946291f},
-std::array<float,2>{0.433309168f, 0.947728455f},
-std::array<float,2>{0.654317141f, 0.0470212959f},
-std::array<float,2>{0.0973658189f, 0.435310066f},
-std::array<float,2>{0.978185415f, 0.584836602f},
-std::array<float,2>{0.371285826f, 0.533163548f},
-std::array<float,2>{0.511162102f, 0.464682639f},
-std::array<float,2>{0.189298362f, 0.072913751f},
-std::array<float,2>{0.872683167f, 0.927210867f},
-std::array<float,2>{0.0510417596f, 0.770580292f},
-std::array<float,2>{0.913453102f, 0.228452131f},
-std::array<float,2>{0.452043802f, 0.269383162f},
-std::array<float,2>{0.72483325f, 0.690959871f},
-std::array<float,2>{0.24350211f, 0.617051244f},
-std::array<float,2>{0.820336998f, 0.39875707f},
-std::array<float,2>{0.318013579f, 0.00179372635f},
-std::array<float,2>{0.536422253f, 0.971236527f},
-std::array<float,2>{0.487217903f, 0.853002191f},
-std::array<float,2>{0.713663876f, 0.171925083f},
-std::array<float,2>{0.0284511503f, 0.36765489f},
-std::array<float,2>{0.892005801f, 0.666810513f},
-std::array<float,2>{0.305449337f, 0.733305812f},
-std::array<float,2>{0.597041965f, 0.281286836f},
-std::array<float,2>{0.127685174f, 0.201225847f},
-std::array<float,2>{0.796955287f, 0.804358721f},
-std::array<float,2>{0.0854507163f, 0.880975604f},
-std::array<float,2>{0.964278996f, 0.119469255f},
-std::array<float,2>{0.399250537f, 0.49166885f},
-std::array<float,2>{0.67526263f, 0.527511537f},
-std::array<float,2>{0.0563286468f, 0.645946801f},
-std::array<float,2>{0.914818406f, 0.317067206f},
-std::array<float,2>{0.444192767f, 0.12987107f},
-std::array<float,2>{0.734145522f, 0.825027585f},
-std::array<float,2>{0.364004344f, 0.964035034f},
-std::array<float,2>{0.507444322f, 0.0397499278f},
-std::array<float,2>{0.199364722f, 0.419034421f},
-std::array<float,2>{0.863118768f, 0.571282387f},
-std::array<float,2>{0.426012516f, 0.558714807f},
-std::array<float,2>{0.642499864f, 0.440900683f},
-std::array<float,2>{0.105160311f, 0.0787161812f},
-std::array<float,2>{0.975443482f, 0.915682614f},
-std::array<float,2>{0.170776978f, 0.753160238f},
-std::array<float,2>{0.765435398f, 0.249357685f},
-std::array<float,2>{0.260963917f, 0.25315243f},
-std::array<float,2>{0.569944322f, 0.717000425f},
-std::array<float,2>{0.113255143f, 0.51545161f},
-std::array<float,2>{0.991259098f, 0.474573702f},
-std::array<float,2>{0.416067213f, 0.109160021f},
-std::array<float,2>{0.634047687f, 0.896380484f},
-std::array<float,2>{0.271984458f, 0.784915209f},
-std::array<float,2>{0.580450654f, 0.211857557f},
-std::array<float,2>{0.18420285f, 0.306111515f},
-std::array<float,2>{0.774324954f, 0.743095398f},
-std::array<float,2>{0.456948817f, 0.685121417f},
-std::array<float,2>{0.735953987f, 0.350486547f},
-std::array<float,2>{0.031986367f, 0.167877018f},
-std::array<float,2>{0.930913329f, 0.869334161f},
-std::array<float,2>{0.213082314f, 0.991394699f},
-std::array<float,2>{0.859304607f, 0.0212934911f},
-std::array<float,2>{0.348118067f, 0.380977511f},
-std::array<float,2>{0.519096732f, 0.595868647f},
-std::array<float,2>{0.143131435f, 0.692308068f},
-std::array<float,2>{0.792739809f, 0.273251027f},
-std::array<float,2>{0.284688175f, 0.233173743f},
-std::array<float,2>{0.610760331f, 0.767913759f},
-std::array<float,2>{0.37769416f, 0.923474789f},
-std::array<float,2>{0.66518575f, 0.0752492175f},
-std::array<float,2>{0.0770394653f, 0.467734486f},
-std::array<float,2>{0.946062446f, 0.536256313f},
-std::array<float,2>{0.330970287f, 0.579689145f},
-std::array<float,2>{0.553155363f, 0.432659447f},
-std::array<float,2>{0.231103107f, 0.0526379831f},
-std::array<float,2>{0.832406342f, 0.951294541f},
-std::array<float,2>{0.00382900797f, 0.838509023f},
-std::array<float,2>{0.887971878f, 0.141474605f},
-std::array<float,2>{0.474313974f, 0.341491431f},
-std::array<float,2>{0.699026823f, 0.632403076f},
-std::array<float,2>{0.175311744f, 0.540202498f},
-std::array<float,2>{0.773390412f, 0.459543854f},
-std::array<float,2>{0.28040725f, 0.0640254766f},
-std::array<float,2>{0.593227923f, 0.935216784f},
-std::array<float,2>{0.410855055f, 0.774984956f},
-std::array<float,2>{0.626254141f, 0.219536558f},
-std::array<float,2>{0.122851051f, 0.27787751f},
-std::array<float,2>{0.99947536f, 0.703109622f},
-std::array<float,2>{0.354652166f, 0.638988495f},
-std::array<float,2>{0.527023017f, 0.330464035f},
-std::array<float,2>{0.204543084f, 0.149701685f},
-std::array<float,2>{0.848771989f, 0.832877874f},
-std::array<float,2>{0.0427479409f, 0.943418682f},
-std::array<float,2>{0.929608941f, 0.05475628f},
-std::array<float,2>{0.461652458f, 0.425580382f},
-std::array<float,2>{0.74471426f, 0.593496084f},
-std::array<float,2>{0.0701998323f, 0.738982141f},
-std::array<float,2>{0.939657569f, 0.303232521f},
-std::array<float,2>{0.389705837f, 0.209275961f},
-std::array<float,2>{0.659481585f, 0.793089092f},
-std::array<float,2>{0.289754927f, 0.900343657f},
-std::array<float,2>{0.624889553f, 0.0975249931f},
-std::array<float,2>{0.152388468f, 0.478584766f},
-std::array<float,2>{0.785555482f, 0.501204669f},
-std::array<float,2>{0.484279364f, 0.601635218f},
-std::array<float,2>{0.692872703f, 0.389037162f},
-std::array<float,2>{0.00982093718f, 0.0249639321f},
-std::array<float,2>{0.876770973f, 0.992239773f},
-std::array<float,2>{0.222583339f, 0.866361976f},
-std::array<float,2>{0.836675167f, 0.158530638f},
-std::array<float,2>{0.343369305f, 0.35738641f},
-std::array<float,2>{0.561507642f, 0.675825417f},
-std::array<float,2>{0.0192986727f, 0.56715101f},
-std::array<float,2>{0.902080297f, 0.408427715f},
-std::array<float,2>{0.494870692f, 0.035632778f},
-std::array<float,2>{0.706932127f, 0.95729059f},
-std::array<float,2>{0.321099579f, 0.818402529f},
-std::array<float,2>{0.54551959f, 0.137760475f},
-std::array<float,2>{0.235483274f, 0.32075727f},
-std::array<float,2>{0.815244198f, 0.653937638f},
-std::array<float,2>{0.396865815f, 0.708722591f},
-std::array<float,2>{0.685443044f, 0.262197286f},
-std::array<float,2>{0.0868553743f, 0.238533065f},
-std::array<float,2>{0.960191786f, 0.760704577f},
-std::array<float,2>{0.133521289f, 0.912333965f},
-std::array<float,2>{0.807892799f, 0.0918602943f},
-std::array<float,2>{0.301753312f, 0.452670425f},
-std::array<float,2>{0.607656062f, 0.549993813f},
-std::array<float,2>{0.194530264f, 0.656428635f},
-std::array<float,2>{0.869925678f, 0.363023788f},
-std::array<float,2>{0.369289041f, 0.185073838f},
-std::array<float,2>{0.515125334f, 0.84605521f},
-std::array<float,2>{0.445683122f, 0.981258869f},
-std::array<float,2>{0.719781697f, 0.0114063239f},
-std::array<float,2>{0.0471777767f, 0.392992288f},
-std::array<float,2>{0.909580112f, 0.622610748f},
-std::array<float,2>{0.253036022f, 0.522715151f},
-std::array<float,2>{0.572001398f, 0.497299463f},
-std::array<float,2>{0.160898522f, 0.1124295f},
-std::array<float,2>{0.756176949f, 0.889251232f},
-std::array<float,2>{0.0990391895f, 0.805155516f},
-std::array<float,2>{0.983441591f, 0.193241835f},
-std::array<float,2>{0.434370905f, 0.294178247f},
-std::array<float,2>{0.651167035f, 0.719147503f},
-std::array<float,2>{0.164430872f, 0.608591795f},
-std::array<float,2>{0.761356294f, 0.383954585f},
-std::array<float,2>{0.261823922f, 0.0274765231f},
-std::array<float,2>{0.565713227f, 0.99832952f},
-std::array<float,2>{0.425728172f, 0.860833108f},
-std::array<float,2>{0.645113528f, 0.162622675f},
-std::array<float,2>{0.108088657f, 0.351884454f},
-std::array<float,2>{0.972630024f, 0.672956407f},
-std::array<float,2>{0.360471487f, 0.73815769f},
-std::array<float,2>{0.502213657f, 0.297569543f},
-std::array<float,2>{0.195355341f, 0.20553565f},
-std::array<float,2>{0.866921306f, 0.789469779f},
-std::array<float,2>{0.0592640229f, 0.903484166f},
-std::array<float,2>{0.919926703f, 0.098572053f},
-std::array<float,2>{0.439833552f, 0.48281461f},
-std::array<float,2>{0.728082776f, 0.507333577f},
-std::array<float,2>{0.0815565363f, 0.633636832f},
-std::array<float,2>{0.966906905f, 0.33573401f},
-std::array<float,2>{0.404506773f, 0.154661551f},
-std::array<float,2>{0.678714514f, 0.830651522f},
-std::array<float,2>{0.311242133f, 0.94075489f},
-std::array<float,2>{0.598520041f, 0.0624784715f},
-std::array<float,2>{0.132265776f, 0.428035647f},
-std::array<float,2>{0.801570296f, 0.58974582f},
-std::array<float,2>{0.490541637f, 0.544718862f},
-std::array<float,2>{0.717429459f, 0.453901887f},
-std::array<float,2>{0.024292605f, 0.0695998669f},
-std::array<float,2>{0.895096123f, 0.930522859f},
-std::array<float,2>{0.247617722f, 0.777571619f},
-std::array<float,2>{0.824358046f, 0.223004609f},
-std::array<float,2>{0.312957287f, 0.274368554f},
-std::array<float,2>{0.533046484f, 0.695879698f},
-std::array<float,2>{0.00446111709f, 0.515750229f},
-std::array<float,2>{0.885080457f, 0.49270612f},
-std::array<float,2>{0.469936043f, 0.114118874f},
-std::array<float,2>{0.702553928f, 0.882879019f},
-std::array<float,2>{0.335503936f, 0.810934544f},
-std::array<float,2>{0.548341632f, 0.188529059f},
-std::array<float,2>{0.227889106f, 0.291639805f},
-std::array<float,2>{0.828542709f, 0.724115551f},
-std::array<float,2>{0.381458789f, 0.661294103f},
-std::array<float,2>{0.671655834f, 0.36714381f},
-std::array<float,2>{0.0732744113f, 0.182122558f},
-std::array<float,2>{0.95300281f, 0.849795938f},
-std::array<float,2>{0.147788197f, 0.978622377f},
-std::array<float,2>{0.79444325f, 0.0122169275f},
-std::array<float,2>{0.28564477f, 0.397013217f},
-std::array<float,2>{0.613455474f, 0.620227039f},
-std::array<float,2>{0.216078103f, 0.703753591f},
-std::array<float,2>{0.853256643f, 0.259159952f},
-std::array<float,2>{0.346421182f, 0.236068591f},
-std::array<float,2>{0.522814393f, 0.7623927f},
-std::array<float,2>{0.459273219f, 0.90876323f},
-std::array<float,2>{0.738835096f, 0.0873224214f},
-std::array<float,2>{0.03692092f, 0.44894883f},
-std::array<float,2>{0.936617434f, 0.552695394f},
-std::array<float,2>{0.268449038f, 0.565657794f},
-std::array<float,2>{0.584172785f, 0.410836846f},
-std::array<float,2>{0.182968885f, 0.0343825482f},
-std::array<float,2>{0.780678213f, 0.955144703f},
-std::array<float,2>{0.114307538f, 0.814592421f},
-std::array<float,2>{0.985712647f, 0.136591032f},
-std::array<float,2>{0.421195f, 0.326249987f},
-std::array<float,2>{0.636924565f, 0.650754333f},
-std::array<float,2>{0.223210812f, 0.557710111f},
-std::array<float,2>{0.840518296f, 0.441600114f},
-std::array<float,2>{0.336879969f, 0.0847788975f},
-std::array<float,2>{0.55562228f, 0.919386625f},
-std::array<float,2>{0.479120433f, 0.756959796f},
-std::array<float,2>{0.691279173f, 0.243020818f},
-std::array<float,2>{0.0148426648f, 0.256312817f},
-std::array<float,2>{0.882339776f, 0.71119225f},
-std::array<float,2>{0.294939876f, 0.641061425f},
-std::array<float,2>{0.619886994f, 0.314506322f},
-std::array<float,2>{0.150728315f, 0.127692208f},
-std::array<float,2>{0.783660829f, 0.823037267f},
-std::array<float,2>{0.0646773353f, 0.968672872f},
-std::array<float,2>{0.943851471f, 0.0435514376f},
-std::array<float,2>{0.384900391f, 0.416948348f},
-std::array<float,2>{0.660413384f, 0.577109516f},
-std::array<float,2>{0.04591313f, 0.727928817f},
-std::array<float,2>{0.923786283f, 0.287918329f},
-std::array<float,2>{0.467731118f, 0.19803068f},
-std::array<float,2>{0.749171793f, 0.800648928f},
-std::array<float,2>{0.356023282f, 0.876560569f},
-std::array<float,2>{0.531246841f, 0.124826118f},
-std::array<float,2>{0.209264547f, 0.488017768f},
-std::array<float,2>{0.847610056f, 0.524036825f},
-std::array<float,2>{0.408143193f, 0.612894654f},
-std::array<float,2>{0.629851043f, 0.405596942f},
-std::array<float,2>{0.119814917f, 0.00546341296f},
-std::array<float,2>{0.995223761f, 0.974293411f},
-std::array<float,2>{0.17638734f, 0.8564713f},
-std::array<float,2>{0.767550766f, 0.179004252f},
-std::array<float,2>{0.276532203f, 0.372229308f},
-std::array<float,2>{0.588196516f, 0.669229984f},
-std::array<float,2>{0.0951565281f, 0.583291709f},
-std::array<float,2>{0.979083717f, 0.435641468f},
-std::array<float,2>{0.430673093f, 0.0497674271f},
-std::array<float,2>{0.653279305f, 0.94655025f},
-std::array<float,2>{0.257490218f, 0.841113031f},
-std::array<float,2>{0.574824274f, 0.146614209f},
-std::array<float,2>{0.156951711f, 0.339652598f},
-std::array<float,2>{0.753467977f, 0.628149986f},
-std::array<float,2>{0.450823545f, 0.689328969f},
-std::array<float,2>{0.722877145f, 0.267011195f},
-std::array<float,2>{0.0534550734f, 0.228586689f},
-std::array<float,2>{0.910488546f, 0.772927105f},
-std::array<float,2>{0.189761892f, 0.929023743f},
-std::array<float,2>{0.874925911f, 0.072098501f},
-std::array<float,2>{0.373331159f, 0.462876737f},
-std::array<float,2>{0.508986831f, 0.535012364f},
-std::array<float,2>{0.139182374f, 0.68063432f},
-std::array<float,2>{0.810383737f, 0.34421891f},
-std::array<float,2>{0.298783064f, 0.16861023f},
-std::array<float,2>{0.605381966f, 0.871325076f},
-std::array<float,2>{0.394367069f, 0.984415531f},
-std::array<float,2>{0.682021558f, 0.0158565268f},
-std::array<float,2>{0.0922934487f, 0.375622571f},
-std::array<float,2>{0.954301834f, 0.599189937f},
-std::array<float,2>{0.327471048f, 0.511155367f},
-std::array<float,2>{0.540252805f, 0.472608209f},
-std::array<float,2>{0.238773793f, 0.104039751f},
-std::array<float,2>{0.820222914f, 0.891055822f},
-std::array<float,2>{0.0214293748f, 0.788635373f},
-std::array<float,2>{0.906233847f, 0.215811059f},
-std::array<float,2>{0.499601901f, 0.310088873f},
-std::array<float,2>{0.70965445f, 0.747974694f},
-std::array<float,2>{0.201250926f, 0.573617935f},
-std::array<float,2>{0.859785616f, 0.420768172f},
-std::array<float,2>{0.365310907f, 0.0427532867f},
-std::array<float,2>{0.505597591f, 0.961148322f},
-std::array<float,2>{0.44162479f, 0.826674342f},
-std::array<float,2>{0.730907202f, 0.131751373f},
-std::array<float,2>{0.0575440452f, 0.31943056f},
-std::array<float,2>{0.916155756f, 0.647489846f},
-std::array<float,2>{0.259294719f, 0.716212988f},
-std::array<float,2>{0.566591263f, 0.250574738f},
-std::array<float,2>{0.168375179f, 0.246500179f},
-std::array<float,2>{0.762706757f, 0.750683784f},
-std::array<float,2>{0.101777099f, 0.916397631f},
-std::array<float,2>{0.974095821f, 0.0812371448f},
-std::array<float,2>{0.429502606f, 0.438306153f},
-std::array<float,2>{0.642586291f, 0.561492324f},
-std::array<float,2>{0.0308263879f, 0.664634168f},
-std::array<float,2>{0.893523693f, 0.370458096f},
-std::array<float,2>{0.486225396f, 0.175571486f},
-std::array<float,2>{0.712146103f, 0.853916764f},
-std::array<float,2>{0.320008278f, 0.969564676f},
-std::array<float,2>{0.537339449f, 0.00333603821f},
-std::array<float,2>{0.24536176f, 0.402060807f},
-std::array<float,2>{0.824139953f, 0.614517331f},
-std::array<float,2>{0.401401758f, 0.529795289f},
-std::array<float,2>{0.672610343f, 0.489251047f},
-std::array<float,2>{0.0828517899f, 0.119073033f},
-std::array<float,2>{0.962305903f, 0.880376756f},
-std::array<float,2>{0.126222074f, 0.802326798f},
-std::array<float,2>{0.799148202f, 0.200282976f},
-std::array<float,2>{0.306901097f, 0.284778565f},
-std::array<float,2>{0.594718039f, 0.731983721f},
-std::array<float,2>{0.0753467977f, 0.537659526f},
-std::array<float,2>{0.948396802f, 0.466385514f},
-std::array<float,2>{0.375696748f, 0.0778427273f},
-std::array<float,2>{0.666599512f, 0.925157547f},
-std::array<float,2>{0.282312691f, 0.765981734f},
-std::array<float,2>{0.612701178f, 0.231702283f},
-std::array<float,2>{0.14174515f, 0.270538747f},
-std::array<float,2>{0.789793074f, 0.694517851f},
-std::array<float,2>{0.474613458f, 0.629932046f},
-std::array<float,2>{0.695332289f, 0.343262404f},
-std::array<float,2>{0.000244664727f, 0.144356474f},
-std::array<float,2>{0.890379846f, 0.836620092f},
-std::array<float,2>{0.232934937f, 0.950652778f},
-std::array<float,2>{0.834299803f, 0.0531511381f},
-std::array<float,2>{0.329680443f, 0.430408418f},
-std::array<float,2>{0.552023172f, 0.581949234f},
-std::array<float,2>{0.187014624f, 0.74567914f},
-std::array<float,2>{0.775782406f, 0.307250559f},
-std::array<float,2>{0.270031959f, 0.213608772f},
-std::array<float,2>{0.578653097f, 0.781909466f},
-std::array<float,2>{0.415728658f, 0.897422194f},
-std::array<float,2>{0.635080278f, 0.105850197f},
-std::array<float,2>{0.110843748f, 0.474679142f},
-std::array<float,2>{0.989724398f, 0.512280583f},
-std::array<float,2>{0.349843264f, 0.594928503f},
-std::array<float,2>{0.516337693f, 0.379359603f},
-std::array<float,2>{0.212139383f, 0.0220165756f},
-std::array<float,2>{0.856204212f, 0.989182234f},
-std::array<float,2>{0.034013737f, 0.868632138f},
-std::array<float,2>{0.932545364f, 0.164238751f},
-std::array<float,2>{0.453322262f, 0.348633975f},
-std::array<float,2>{0.737641931f, 0.685550332f},
-std::array<float,2>{0.156054601f, 0.503756046f},
-std::array<float,2>{0.788697839f, 0.477231264f},
-std::array<float,2>{0.291268229f, 0.0942536891f},
-std::array<float,2>{0.622336268f, 0.901940823f},
-std::array<float,2>{0.388060063f, 0.79527396f},
-std::array<float,2>{0.658001125f, 0.208715007f},
-std::array<float,2>{0.0665447041f, 0.300935f},
-std::array<float,2>{0.937750459f, 0.740596354f},
-std::array<float,2>{0.341330796f, 0.679547548f},
-std::array<float,2>{0.559903502f, 0.358884186f},
-std::array<float,2>{0.220170036f, 0.156651855f},
-std::array<float,2>{0.839339256f, 0.86470753f},
-std::array<float,2>{0.00897284504f, 0.994305968f},
-std::array<float,2>{0.877850592f, 0.0257614683f},
-std::array<float,2>{0.480947107f, 0.387876511f},
-std::array<float,2>{0.69514513f, 0.605424941f},
-std::array<float,2>{0.123962305f, 0.699465334f},
-std::array<float,2>{0.997969091f, 0.279932171f},
-std::array<float,2>{0.413071275f, 0.220961004f},
-std::array<float,2>{0.628631651f, 0.775570989f},
-std::array<float,2>{0.277868688f, 0.936419427f},
-std::array<float,2>{0.590849638f, 0.0654314458f},
-std::array<float,2>{0.173511267f, 0.45772326f},
-std::array<float,2>{0.769929111f, 0.54103893f},
-std::array<float,2>{0.46355927f, 0.590407729f},
-std::array<float,2>{0.743480563f, 0.423775017f},
-std::array<float,2>{0.0396723151f, 0.0584813319f},
-std::array<float,2>{0.926252663f, 0.942807257f},
-std::array<float,2>{0.206072301f, 0.835063815f},
-std::array<float,2>{0.850286603f, 0.150557429f},
-std::array<float,2>{0.35196045f, 0.329206765f},
-std::array<float,2>{0.524185181f, 0.637633443f},
-std::array<float,2>{0.0501973927f, 0.624201775f},
-std::array<float,2>{0.907942772f, 0.391472489f},
-std::array<float,2>{0.448844224f, 0.00875694584f},
-std::array<float,2>{0.721381009f, 0.983586192f},
-std::array<float,2>{0.368817508f, 0.844682097f},
-std::array<float,2>{0.512641847f, 0.187026903f},
-std::array<float,2>{0.192146555f, 0.359728843f},
-std::array<float,2>{0.868086278f, 0.659891129f},
-std::array<float,2>{0.436610401f, 0.721890628f},
-std::array<float,2>{0.649561405f, 0.296558052f},
-std::array<float,2>{0.100424103f, 0.193455949f},
-std::array<float,2>{0.981154203f, 0.806950092f},
-std::array<float,2>{0.162889883f, 0.887017667f},
-std::array<float,2>{0.755544186f, 0.11097981f},
-std::array<float,2>{0.251200914f, 0.499962986f},
-std::array<float,2>{0.57407248f, 0.520687878f},
-std::array<float,2>{0.236465096f, 0.655859828f},
-std::array<float,2>{0.812843025f, 0.323516876f},
-std::array<float,2>{0.323154658f, 0.13993378f},
-std::array<float,2>{0.544053018f, 0.81746012f},
-std::array<float,2>{0.493084311f, 0.960269868f},
-std::array<float,2>{0.704104185f, 0.0372610502f},
-std::array<float,2>{0.0158307534f, 0.408147037f},
-std::array<float,2>{0.898981392f, 0.568724751f},
-std::array<float,2>{0.303217947f, 0.547802746f},
-std::array<float,2>{0.605813444f, 0.450133592f},
-std::array<float,2>{0.136622995f, 0.0898915157f},
-std::array<float,2>{0.805344939f, 0.910534024f},
-std::array<float,2>{0.0889237374f, 0.758684695f},
-std::array<float,2>{0.957362711f, 0.241377801f},
-std::array<float,2>{0.394846439f, 0.265008807f},
-std::array<float,2>{0.686351955f, 0.709164679f},
-std::array<float,2>{0.14463602f, 0.620057762f},
-std::array<float,2>{0.795840204f, 0.398303896f},
-std::array<float,2>{0.287800074f, 0.0133006917f},
-std::array<float,2>{0.61714381f, 0.979858696f},
-std::array<float,2>{0.380413592f, 0.851164758f},
-std::array<float,2>{0.668533087f, 0.183047146f},
-std::array<float,2>{0.071165055f, 0.365893245f},
-std::array<float,2>{0.950744331f, 0.660589874f},
-std::array<float,2>{0.333584458f, 0.723245323f},
-std::array<float,2>{0.549616098f, 0.292256087f},
-std::array<float,2>{0.230146006f, 0.188171044f},
-std::array<float,2>{0.831201732f, 0.812417865f},
-std::array<float,2>{0.00779153779f, 0.884450793f},
-std::array<float,2>{0.883421898f, 0.114682749f},
-std::array<float,2>{0.47076717f, 0.493251711f},
-std::array<float,2>{0.700306833f, 0.517256796f},
-std::array<float,2>{0.116621591f, 0.652146757f},
-std::array<float,2>{0.986721992f, 0.328107804f},
-std::array<float,2>{0.418981284f, 0.134864852f},
-std::array<float,2>{0.640322864f, 0.816205263f},
-std::array<float,2>{0.267086774f, 0.956188023f},
-std::array<float,2>{0.582184255f, 0.0339216851f},
-std::array<float,2>{0.179758385f, 0.411675036f},
-std::array<float,2>{0.777393341f, 0.564965725f},
-std::array<float,2>{0.457847327f, 0.550942898f},
-std::array<float,2>{0.740594983f, 0.448033482f},
-std::array<float,2>{0.0376718007f, 0.0860356614f},
-std::array<float,2>{0.933840334f, 0.909820676f},
-std::array<float,2>{0.21818921f, 0.763343692f},
-std::array<float,2>{0.854373813f, 0.234433934f},
-std::array<float,2>{0.345195025f, 0.257864743f},
-std::array<float,2>{0.520657539f, 0.704858482f},
-std::array<float,2>{0.0617423207f, 0.506412506f},
-std::array<float,2>{0.918152332f, 0.484220088f},
-std::array<float,2>{0.437548995f, 0.0988557637f},
-std::array<float,2>{0.730232835f, 0.902917862f},
-std::array<float,2>{0.362319052f, 0.790670156f},
-std::array<float,2>{0.500473738f, 0.206185341f},
-std::array<float,2>{0.198619604f, 0.298628956f},
-std::array<float,2>{0.863451004f, 0.736955285f},
-std::array<float,2>{0.423285425f, 0.672075748f},
-std::array<float,2>{0.648209095f, 0.352772623f},
-std::array<float,2>{0.105802022f, 0.163357973f},
-std::array<float,2>{0.970647275f, 0.860064387f},
-std::array<float,2>{0.166944578f, 0.99992764f},
-std::array<float,2>{0.758578479f, 0.028439898f},
-std::array<float,2>{0.26417461f, 0.383033991f},
-std::array<float,2>{0.563962519f, 0.607909024f},
-std::array<float,2>{0.248058811f, 0.696846783f},
-std::array<float,2>{0.827453315f, 0.275161296f},
-std::array<float,2>{0.316031009f, 0.224439383f},
-std::array<float,2>{0.533809245f, 0.778745472f},
-std::array<float,2>{0.488682836f, 0.931233406f},
-std::array<float,2>{0.716106355f, 0.0691015944f},
-std::array<float,2>{0.0259206388f, 0.454553604f},
-std::array<float,2>{0.896587968f, 0.543607771f},
-std::array<float,2>{0.309656709f, 0.587996483f},
-std::array<float,2>{0.601561069f, 0.429152936f},
-std::array<float,2>{0.129466146f, 0.0615176223f},
-std::array<float,2>{0.804242611f, 0.94008559f},
-std::array<float,2>{0.0789047182f, 0.831913173f},
-std::array<float,2>{0.966190696f, 0.156083658f},
-std::array<float,2>{0.403992951f, 0.334335864f},
-std::array<float,2>{0.677195072f, 0.63471663f},
-std::array<float,2>{0.188423216f, 0.533956289f},
-std::array<float,2>{0.871259809f, 0.461595088f},
-std::array<float,2>{0.372975618f, 0.0705184415f},
-std::array<float,2>{0.509872854f, 0.928222001f},
-std::array<float,2>{0.452163488f, 0.771599531f},
-std::array<float,2>{0.72585088f, 0.230418637f},
-std::array<float,2>{0.0520238504f, 0.266516298f},
-std::array<float,2>{0.912466526f, 0.688457668f},
-std::array<float,2>{0.25471139f, 0.627230942f},
-std::array<float,2>{0.577514648f, 0.338151515f},
-std::array<float,2>{0.158666521f, 0.148228705f},
-std::array<float,2>{0.750657678f, 0.840083063f},
-std::array<float,2>{0.0958231241f, 0.94590646f},
-std::array<float,2>{0.977299571f, 0.0503151976f},
-std::array<float,2>{0.432271242f, 0.436833084f},
-std::array<float,2>{0.655777693f, 0.582832754f},
-std::array<float,2>{0.0218706541f, 0.746706784f},
-std::array<float,2>{0.903535903f, 0.30897814f},
-std::array<float,2>{0.496527523f, 0.215923458f},
-std::array<float,2>{0.707825482f, 0.787158251f},
-std::array<float,2>{0.325687379f, 0.892179847f},
-std::array<float,2>{0.542543054f, 0.10473875f},
-std::array<float,2>{0.241820619f, 0.471410096f},
-std::array<float,2>{0.817756891f, 0.510333359f},
-std::array<float,2>{0.391764671f, 0.598221898f},
-std::array<float,2>{0.680380225f, 0.376788884f},
-std::array<float,2>{0.0902434886f, 0.0169730596f},
-std::array<float,2>{0.956818461f, 0.985883713f},
-std::array<float,2>{0.138458267f, 0.872448623f},
-std::array<float,2>{0.81166929f, 0.169349626f},
-std::array<float,2>{0.299394488f, 0.344997972f},
-std::array<float,2>{0.602142274f, 0.680754364f},
-std::array<float,2>{0.0642762855f, 0.577449441f},
-std::array<float,2>{0.942705572f, 0.417418897f},
-std::array<float,2>{0.383450568f, 0.0447482541f},
-std::array<float,2>{0.663101852f, 0.966954947f},
-std::array<float,2>{0.293450773f, 0.824019492f},
-std::array<float,2>{0.618466735f, 0.128199682f},
-std::array<float,2>{0.149326563f, 0.315453947f},
-std::array<float,2>{0.782351077f, 0.641856194f},
-std::array<float,2>{0.476855129f, 0.712698579f},
-std::array<float,2>{0.688801408f, 0.25732848f},
-std::array<float,2>{0.011896614f, 0.243656874f},
-std::array<float,2>{0.880619168f, 0.756096125f},
-std::array<float,2>{0.225700766f, 0.918565512f},
-std::array<float,2>{0.842612863f, 0.0851318017f},
-std::array<float,2>{0.338790178f, 0.442985922f},
-std::array<float,2>{0.557736933f, 0.556685507f},
-std::array<float,2>{0.177903935f, 0.668517351f},
-std::array<float,2>{0.7677598f, 0.371824801f},
-std::array<float,2>{0.274129152f, 0.17783311f},
-std::array<float,2>{0.58662802f, 0.855747104f},
-std::array<float,2>{0.408839762f, 0.973165929f},
-std::array<float,2>{0.632006347f, 0.00400233781f},
-std::array<float,2>{0.118738301f, 0.404810011f},
-std::array<float,2>{0.992425203f, 0.61203903f},
-std::array<float,2>{0.357644588f, 0.52519846f},
-std::array<float,2>{0.527971268f, 0.487020582f},
-std::array<float,2>{0.208267704f, 0.123984337f},
-std::array<float,2>{0.845434904f, 0.875010669f},
-std::array<float,2>{0.0445342734f, 0.799656808f},
-std::array<float,2>{0.924507797f, 0.198808342f},
-std::array<float,2>{0.465335608f, 0.288544476f},
-std::array<float,2>{0.746531367f, 0.72666508f},
-std::array<float,2>{0.232091308f, 0.580128491f},
-std::array<float,2>{0.833702385f, 0.431479275f},
-std::array<float,2>{0.331293255f, 0.0544245504f},
-std::array<float,2>{0.554414213f, 0.950054109f},
-std::array<float,2>{0.472905457f, 0.837844253f},
-std::array<float,2>{0.697549522f, 0.142862901f},
-std::array<float,2>{0.00291554001f, 0.342022061f},
-std::array<float,2>{0.886746407f, 0.629338562f},
-std::array<float,2>{0.283831954f, 0.693829119f},
-std::array<float,2>{0.61012578f, 0.270372808f},
-std::array<float,2>{0.143582225f, 0.230895162f},
-std::array<float,2>{0.791730225f, 0.766620934f},
-std::array<float,2>{0.0778544322f, 0.924629271f},
-std::array<float,2>{0.946456492f, 0.0769112408f},
-std::array<float,2>{0.378388941f, 0.465241998f},
-std::array<float,2>{0.664200842f, 0.538439751f},
-std::array<float,2>{0.0327199362f, 0.687177896f},
-std::array<float,2>{0.929938793f, 0.348341405f},
-std::array<float,2>{0.455254465f, 0.165746212f},
-std::array<float,2>{0.735063434f, 0.867627084f},
-std::array<float,2>{0.349428982f, 0.989799738f},
-std::array<float,2>{0.51765883f, 0.0233769771f},
-std::array<float,2>{0.214715362f, 0.380367517f},
-std::array<float,2>{0.857662797f, 0.594296694f},
-std::array<float,2>{0.417145282f, 0.513538718f},
-std::array<float,2>{0.632824898f, 0.475591391f},
-std::array<float,2>{0.112079129f, 0.106836453f},
-std::array<float,2>{0.991209507f, 0.898221612f},
-std::array<float,2>{0.185074612f, 0.78222692f},
-std::array<float,2>{0.775224864f, 0.21434176f},
-std::array<float,2>{0.273203164f, 0.308562279f},
-std::array<float,2>{0.581603765f, 0.744400322f},
-std::array<float,2>{0.103545465f, 0.561698496f},
-std::array<float,2>{0.975760877f, 0.439403027f},
-std::array<float,2>{0.427056044f, 0.0809412897f},
-std::array<float,2>{0.641436696f, 0.917030513f},
-std::array<float,2>{0.260000288f, 0.751263678f},
-std::array<float,2>{0.569151938f, 0.247404218f},
-std::array<float,2>{0.170992523f, 0.25108251f},
-std::array<float,2>{0.763897598f, 0.714982688f},
-std::array<float,2>{0.444953203f, 0.646751642f},
-std::array<float,2>{0.732741833f, 0.319049954f},
-std::array<float,2>{0.0549008511f, 0.132658377f},
-std::array<float,2>{0.915968716f, 0.828071952f},
-std::array<float,2>{0.200273558f, 0.961946487f},
-std::array<float,2>{0.861351728f, 0.0419470482f},
-std::array<float,2>{0.364745051f, 0.420944393f},
-std::array<float,2>{0.506122589f, 0.573233426f},
-std::array<float,2>{0.12857984f, 0.731317043f},
-std::array<float,2>{0.798555315f, 0.283710271f},
-std::array<float,2>{0.306530893f, 0.199890986f},
-std::array<float,2>{0.595735669f, 0.801691353f},
-std::array<float,2>{0.400376081f, 0.879547596f},
-std::array<float,2>{0.673942208f, 0.11733494f},
-std::array<float,2>{0.084370859f, 0.490211338f},
-std::array<float,2>{0.963717699f, 0.530731976f},
-std::array<float,2>{0.316864908f, 0.614103079f},
-std::array<float,2>{0.535647273f, 0.400724292f},
-std::array<float,2>{0.243077666f, 0.00218199007f},
-std::array<float,2>{0.821564972f, 0.970307052f},
-std::array<float,2>{0.028266497f, 0.854640782f},
-std::array<float,2>{0.891125917f, 0.174749136f},
-std::array<float,2>{0.48752895f, 0.369449347f},
-std::array<float,2>{0.714203179f, 0.665556431f},
-std::array<float,2>{0.161682367f, 0.520224035f},
-std::array<float,2>{0.757732332f, 0.498596311f},
-std::array<float,2>{0.252464086f, 0.109683722f},
-std::array<float,2>{0.570403993f, 0.887746274f},
-std::array<float,2>{0.434639037f, 0.808453023f},
-std::array<float,2>{0.652007937f, 0.194579974f},
-std::array<float,2>{0.0985058919f, 0.294985831f},
-std::array<float,2>{0.982913315f, 0.721605361f},
-std::array<float,2>{0.370301932f, 0.658987224f},
-std::array<float,2>{0.514181495f, 0.361057758f},
-std::array<float,2>{0.193650588f, 0.186379403f},
-std::array<float,2>{0.871045709f, 0.845646679f},
-std::array<float,2>{0.048678685f, 0.982666731f},
-std::array<float,2>{0.908414006f, 0.00955473166f},
-std::array<float,2>{0.446752101f, 0.391951859f},
-std::array<float,2>{0.719428241f, 0.62365675f},
-std::array<float,2>{0.0870686173f, 0.710456014f},
-std::array<float,2>{0.959420323f, 0.263906121f},
-std::array<float,2>{0.397944838f, 0.240826696f},
-std::array<float,2>{0.683701932f, 0.759460032f},
-std::array<float,2>{0.302113891f, 0.911508203f},
-std::array<float,2>{0.608870208f, 0.0911856368f},
-std::array<float,2>{0.134362504f, 0.450402826f},
-std::array<float,2>{0.806982279f, 0.548702657f},
-std::array<float,2>{0.495399028f, 0.56987232f},
-std::array<float,2>{0.705159128f, 0.407119006f},
-std::array<float,2>{0.0180422328f, 0.0384628363f},
-std::array<float,2>{0.900680959f, 0.959478796f},
-std::array<float,2>{0.235153556f, 0.816734612f},
-std::array<float,2>{0.816287458f, 0.139625639f},
-std::array<float,2>{0.321305603f, 0.323233694f},
-std::array<float,2>{0.546395421f, 0.654747188f},
-std::array<float,2>{0.0113892676f, 0.603878856f},
-std::array<float,2>{0.875924587f, 0.38677296f},
-std::array<float,2>{0.482865065f, 0.0269662011f},
-std::array<float,2>{0.691559553f, 0.995905817f},
-std::array<float,2>{0.342588395f, 0.864099443f},
-std::array<float,2>{0.56169486f, 0.15751943f},
-std::array<float,2>{0.220766827f, 0.358319432f},
-std::array<float,2>{0.837310135f, 0.678361416f},
-std::array<float,2>{0.388877034f, 0.741679907f},
-std::array<float,2>{0.658623874f, 0.302608192f},
-std::array<float,2>{0.0692967325f, 0.207963422f},
-std::array<float,2>{0.94068867f, 0.796572089f},
-std::array<float,2>{0.153827205f, 0.900744319f},
-std::array<float,2>{0.786665618f, 0.0949927047f},
-std::array<float,2>{0.290291756f, 0.47796154f},
-std::array<float,2>{0.623139977f, 0.502881527f},
-std::array<float,2>{0.203154534f, 0.637734234f},
-std::array<float,2>{0.847792864f, 0.328825474f},
-std::array<float,2>{0.353843927f, 0.151373595f},
-std::array<float,2>{0.52543962f, 0.834801018f},
-std::array<float,2>{0.462576419f, 0.94145906f},
-std::array<float,2>{0.745591342f, 0.0566739589f},
-std::array<float,2>{0.0413846336f, 0.422051311f},
-std::array<float,2>{0.928103149f, 0.591689169f},
-std::array<float,2>{0.280248106f, 0.542261302f},
-std::array<float,2>{0.591881335f, 0.458585829f},
-std::array<float,2>{0.174543887f, 0.065213047f},
-std::array<float,2>{0.771731257f, 0.936728954f},
-std::array<float,2>{0.12135829f, 0.776852906f},
-std::array<float,2>{0.9989779f, 0.222219467f},
-std::array<float,2>{0.412044257f, 0.281119645f},
-std::array<float,2>{0.625230253f, 0.700471759f},
-std::array<float,2>{0.181970805f, 0.562862992f},
-std::array<float,2>{0.780174136f, 0.413409114f},
-std::array<float,2>{0.268698335f, 0.0313347876f},
-std::array<float,2>{0.585112393f, 0.953834116f},
-std::array<float,2>{0.420311332f, 0.813094854f},
-std::array<float,2>{0.638615131f, 0.132860854f},
-std::array<float,2>{0.113979749f, 0.32479617f},
-std::array<float,2>{0.985185742f, 0.648628533f},
-std::array<float,2>{0.346978933f, 0.706870914f},
-std::array<float,2>{0.522243917f, 0.260377407f},
-std::array<float,2>{0.215279073f, 0.236437455f},
-std::array<float,2>{0.851680934f, 0.765076518f},
-std::array<float,2>{0.0356119834f, 0.907658041f},
-std::array<float,2>{0.936343014f, 0.0888447165f},
-std::array<float,2>{0.460786343f, 0.445623279f},
-std::array<float,2>{0.740056753f, 0.553768277f},
-std::array<float,2>{0.0725159571f, 0.662409365f},
-std::array<float,2>{0.95166719f, 0.363708973f},
-std::array<float,2>{0.382772356f, 0.18102169f},
-std::array<float,2>{0.670447171f, 0.847892106f},
-std::array<float,2>{0.286298096f, 0.978126705f},
-std::array<float,2>{0.614709258f, 0.0143463137f},
-std::array<float,2>{0.146607906f, 0.396378458f},
-std::array<float,2>{0.79371959f, 0.617536604f},
-std::array<float,2>{0.46928665f, 0.518754303f},
-std::array<float,2>{0.702017725f, 0.495802611f},
-std::array<float,2>{0.00523081282f, 0.117140628f},
-std::array<float,2>{0.886601865f, 0.885275066f},
-std::array<float,2>{0.227032855f, 0.809292316f},
-std::array<float,2>{0.829721332f, 0.191080868f},
-std::array<float,2>{0.334404439f, 0.290766627f},
-std::array<float,2>{0.547065318f, 0.726516843f},
-std::array<float,2>{0.0251147337f, 0.545737386f},
-std::array<float,2>{0.895990193f, 0.455747545f},
-std::array<float,2>{0.49216634f, 0.0666258484f},
-std::array<float,2>{0.717893183f, 0.93358326f},
-std::array<float,2>{0.313527316f, 0.779984474f},
-std::array<float,2>{0.531460404f, 0.224815816f},
-std::array<float,2>{0.246891171f, 0.27708602f},
-std::array<float,2>{0.825345218f, 0.697611153f},
-std::array<float,2>{0.40613696f, 0.635597587f},
-std::array<float,2>{0.678535461f, 0.333634377f},
-std::array<float,2>{0.0806343779f, 0.153031573f},
-std::array<float,2>{0.967833698f, 0.828976274f},
-std::array<float,2>{0.131121129f, 0.937795401f},
-std::array<float,2>{0.80260402f, 0.0589655861f},
-std::array<float,2>{0.311614215f, 0.42707479f},
-std::array<float,2>{0.599485874f, 0.586291313f},
-std::array<float,2>{0.196863785f, 0.734875858f},
-std::array<float,2>{0.86611712f, 0.29990077f},
-std::array<float,2>{0.359656036f, 0.203638852f},
-std::array<float,2>{0.50384748f, 0.791455388f},
-std::array<float,2>{0.440817356f, 0.904718697f},
-std::array<float,2>{0.727345765f, 0.10070321f},
-std::array<float,2>{0.0605096407f, 0.480842829f},
-std::array<float,2>{0.921056509f, 0.505018413f},
-std::array<float,2>{0.263330132f, 0.606201053f},
-std::array<float,2>{0.565324128f, 0.384937555f},
-std::array<float,2>{0.165746137f, 0.0300888978f},
-std::array<float,2>{0.760183871f, 0.996866822f},
-std::array<float,2>{0.109177925f, 0.861521542f},
-std::array<float,2>{0.970791757f, 0.161128312f},
-std::array<float,2>{0.424170256f, 0.354209363f},
-std::array<float,2>{0.646340072f, 0.674949765f},
-std::array<float,2>{0.239640743f, 0.509118974f},
-std::array<float,2>{0.819075286f, 0.469188094f},
-std::array<float,2>{0.32677567f, 0.102878854f},
-std::array<float,2>{0.539298654f, 0.89376533f},
-std::array<float,2>{0.498449713f, 0.785429358f},
-std::array<float,2>{0.710279882f, 0.217620194f},
-std::array<float,2>{0.0199622754f, 0.31109634f},
-std::array<float,2>{0.904679775f, 0.748130977f},
-std::array<float,2>{0.297571301f, 0.681707919f},
-std::array<float,2>{0.603607237f, 0.346869081f},
-std::array<float,2>{0.140173003f, 0.170491382f},
-std::array<float,2>{0.809503198f, 0.873854339f},
-std::array<float,2>{0.0929868296f, 0.986700475f},
-std::array<float,2>{0.953284442f, 0.0188271664f},
-std::array<float,2>{0.392819911f, 0.378139615f},
-std::array<float,2>{0.683301926f, 0.599801004f},
-std::array<float,2>{0.0545545928f, 0.689632595f},
-std::array<float,2>{0.911347568f, 0.267670155f},
-std::array<float,2>{0.450011224f, 0.226996198f},
-std::array<float,2>{0.724552035f, 0.76955229f},
-std::array<float,2>{0.374175876f, 0.925837636f},
-std::array<float,2>{0.508592427f, 0.0741384849f},
-std::array<float,2>{0.190860286f, 0.463499635f},
-std::array<float,2>{0.873480618f, 0.531582832f},
-std::array<float,2>{0.430145293f, 0.585091174f},
-std::array<float,2>{0.653491557f, 0.433977246f},
-std::array<float,2>{0.0946921632f, 0.04805962f},
-std::array<float,2>{0.979560077f, 0.94835192f},
-std::array<float,2>{0.157839715f, 0.84238565f},
-std::array<float,2>{0.752159238f, 0.145298019f},
-std::array<float,2>{0.256380618f, 0.337446362f},
-std::array<float,2>{0.575655699f, 0.626313865f},
-std::array<float,2>{0.120509624f, 0.611320019f},
-std::array<float,2>{0.994564772f, 0.40250802f},
-std::array<float,2>{0.406824708f, 0.00761663262f},
-std::array<float,2>{0.630588174f, 0.975077212f},
-std::array<float,2>{0.275916547f, 0.858227134f},
-std::array<float,2>{0.589694202f, 0.177133515f},
-std::array<float,2>{0.177156001f, 0.374665767f},
-std::array<float,2>{0.765641928f, 0.67146951f},
-std::array<float,2>{0.468555957f, 0.729464173f},
-std::array<float,2>{0.748977721f, 0.28655377f},
-std::array<float,2>{0.0454993099f, 0.195528194f},
-std::array<float,2>{0.922136426f, 0.797873259f},
-std::array<float,2>{0.210268617f, 0.877376914f},
-std::array<float,2>{0.846662164f, 0.121705517f},
-std::array<float,2>{0.356610417f, 0.486110777f},
-std::array<float,2>{0.529796243f, 0.525799692f},
-std::array<float,2>{0.151420027f, 0.64397496f},
-std::array<float,2>{0.784547031f, 0.312897563f},
-std::array<float,2>{0.296785474f, 0.126215667f},
-std::array<float,2>{0.620773733f, 0.820329547f},
-std::array<float,2>{0.385947436f, 0.96556288f},
-std::array<float,2>{0.661563516f, 0.0455909595f},
-std::array<float,2>{0.0655255765f, 0.415282667f},
-std::array<float,2>{0.944814444f, 0.575016618f},
-std::array<float,2>{0.337600768f, 0.554861307f},
-std::array<float,2>{0.556107938f, 0.444459528f},
-std::array<float,2>{0.224130571f, 0.0836359337f},
-std::array<float,2>{0.841072619f, 0.921809375f},
-std::array<float,2>{0.0137544777f, 0.75485003f},
-std::array<float,2>{0.881300926f, 0.245642841f},
-std::array<float,2>{0.479975492f, 0.255292475f},
-std::array<float,2>{0.689498067f, 0.713099301f},
-std::array<float,2>{0.2110634f, 0.597012043f},
-std::array<float,2>{0.857255876f, 0.382184774f},
-std::array<float,2>{0.351327568f, 0.0203446373f},
-std::array<float,2>{0.517313778f, 0.990880907f},
-std::array<float,2>{0.454598397f, 0.870451272f},
-std::array<float,2>{0.736698985f, 0.166410089f},
-std::array<float,2>{0.0346726887f, 0.351038456f},
-std::array<float,2>{0.932771325f, 0.684561431f},
-std::array<float,2>{0.270789444f, 0.743487179f},
-std::array<float,2>{0.579774559f, 0.305132896f},
-std::array<float,2>{0.185711265f, 0.212638408f},
-std::array<float,2>{0.777123451f, 0.784084558f},
-std::array<float,2>{0.109601647f, 0.895259023f},
-std::array<float,2>{0.988297343f, 0.10815987f},
-std::array<float,2>{0.414621234f, 0.472952485f},
-std::array<float,2>{0.636576653f, 0.513912916f},
-std::array<float,2>{0.00173252216f, 0.6314556f},
-std::array<float,2>{0.889007747f, 0.340040982f},
-std::array<float,2>{0.475770175f, 0.142267391f},
-std::array<float,2>{0.697083592f, 0.839612901f},
-std::array<float,2>{0.329010308f, 0.952840567f},
-std::array<float,2>{0.551090837f, 0.051158987f},
-std::array<float,2>{0.234297335f, 0.431903243f},
-std::array<float,2>{0.83499831f, 0.578819633f},
-std::array<float,2>{0.376785964f, 0.535930395f},
-std::array<float,2>{0.667888522f, 0.468462139f},
-std::array<float,2>{0.0749168098f, 0.0747130141f},
-std::array<float,2>{0.947469592f, 0.922044992f},
-std::array<float,2>{0.140824497f, 0.768912315f},
-std::array<float,2>{0.790918231f, 0.233589754f},
-std::array<float,2>{0.281393737f, 0.271979362f},
-std::array<float,2>{0.611677885f, 0.692860842f},
-std::array<float,2>{0.0833831429f, 0.528507471f},
-std::array<float,2>{0.961274445f, 0.490904808f},
-std::array<float,2>{0.401154757f, 0.120411448f},
-std::array<float,2>{0.673604846f, 0.882018209f},
-std::array<float,2>{0.308166385f, 0.80281502f},
-std::array<float,2>{0.595356822f, 0.202684164f},
-std::array<float,2>{0.125009477f, 0.282907307f},
-std::array<float,2>{0.800000608f, 0.734268248f},
-std::array<float,2>{0.484543413f, 0.667048872f},
-std::array<float,2>{0.711466551f, 0.369073749f},
-std::array<float,2>{0.0299631096f, 0.173520401f},
-std::array<float,2>{0.893629789f, 0.852035105f},
-std::array<float,2>{0.244664833f, 0.971686006f},
-std::array<float,2>{0.822270155f, 0.000707111496f},
-std::array<float,2>{0.318857223f, 0.399589598f},
-std::array<float,2>{0.538844109f, 0.615899622f},
-std::array<float,2>{0.169278577f, 0.718118548f},
-std::array<float,2>{0.762604415f, 0.252276063f},
-std::array<float,2>{0.258354604f, 0.248283505f},
-std::array<float,2>{0.568137407f, 0.752137601f},
-std::array<float,2>{0.428085029f, 0.9148435f},
-std::array<float,2>{0.643965244f, 0.0792021155f},
-std::array<float,2>{0.103261948f, 0.439728677f},
-std::array<float,2>{0.972685337f, 0.559800625f},
-std::array<float,2>{0.367093176f, 0.571711183f},
-std::array<float,2>{0.504342377f, 0.41816622f},
-std::array<float,2>{0.202345699f, 0.0406655967f},
-std::array<float,2>{0.860895991f, 0.963153124f},
-std::array<float,2>{0.058125075f, 0.826120496f},
-std::array<float,2>{0.91776967f, 0.130175859f},
-std::array<float,2>{0.442958504f, 0.317437887f},
-std::array<float,2>{0.731712699f, 0.645506382f},
-std::array<float,2>{0.134945005f, 0.549401343f},
-std::array<float,2>{0.8065539f, 0.451429099f},
-std::array<float,2>{0.304175526f, 0.0936420336f},
-std::array<float,2>{0.607338309f, 0.913511336f},
-std::array<float,2>{0.395587087f, 0.761522472f},
-std::array<float,2>{0.687182367f, 0.240000889f},
-std::array<float,2>{0.0880398452f, 0.263508081f},
-std::array<float,2>{0.958118796f, 0.707808673f},
-std::array<float,2>{0.323678046f, 0.652691245f},
-std::array<float,2>{0.543222904f, 0.321483016f},
-std::array<float,2>{0.237415776f, 0.137685642f},
-std::array<float,2>{0.813750327f, 0.820263207f},
-std::array<float,2>{0.0172377732f, 0.958738089f},
-std::array<float,2>{0.899913669f, 0.0370019078f},
-std::array<float,2>{0.493662685f, 0.409636229f},
-std::array<float,2>{0.703980625f, 0.568161309f},
-std::array<float,2>{0.101115197f, 0.720093131f},
-std::array<float,2>{0.98228085f, 0.293792993f},
-std::array<float,2>{0.436280847f, 0.191891342f},
-std::array<float,2>{0.649392843f, 0.806087136f},
-std::array<float,2>{0.250440657f, 0.890366495f},
-std::array<float,2>{0.57298553f, 0.112142496f},
-std::array<float,2>{0.163504839f, 0.496996492f},
-std::array<float,2>{0.754581451f, 0.52203548f},
-std::array<float,2>{0.448114425f, 0.62161988f},
-std::array<float,2>{0.722314715f, 0.39363414f},
-std::array<float,2>{0.049707979f, 0.00981222652f},
-std::array<float,2>{0.906940937f, 0.981955886f},
-std::array<float,2>{0.192827791f, 0.846890628f},
-std::array<float,2>{0.868658006f, 0.184503436f},
-std::array<float,2>{0.367956907f, 0.361376911f},
-std::array<float,2>{0.513329089f, 0.657276213f},
-std::array<float,2>{0.0405199453f, 0.592497647f},
-std::array<float,2>{0.926956952f, 0.424413532f},
-std::array<float,2>{0.464644253f, 0.0559308194f},
-std::array<float,2>{0.742394567f, 0.944445312f},
-std::array<float,2>{0.352613837f, 0.833434403f},
-std::array<float,2>{0.52459538f, 0.149332359f},
-std::array<float,2>{0.205535337f, 0.331931323f},
-std::array<float,2>{0.850782037f, 0.640560567f},
-std::array<float,2>{0.414006203f, 0.701560259f},
-std::array<float,2>{0.62773639f, 0.278991342f},
-std::array<float,2>{0.124298297f, 0.220678672f},
-std::array<float,2>{0.996362388f, 0.773993492f},
-std::array<float,2>{0.172219485f, 0.934476733f},
-std::array<float,2>{0.771190703f, 0.0629371554f},
-std::array<float,2>{0.278424889f, 0.460680604f},
-std::array<float,2>{0.590133011f, 0.539921582f},
-std::array<float,2>{0.218769297f, 0.677493811f},
-std::array<float,2>{0.83858788f, 0.355796427f},
-std::array<float,2>{0.340595841f, 0.159838557f},
-std::array<float,2>{0.558657289f, 0.866132855f},
-std::array<float,2>{0.482333153f, 0.993837476f},
-std::array<float,2>{0.694047511f, 0.0235734582f},
-std::array<float,2>{0.00822913833f, 0.390429556f},
-std::array<float,2>{0.878711104f, 0.602972686f},
-std::array<float,2>{0.29248482f, 0.500052452f},
-std::array<float,2>{0.622041464f, 0.480166703f},
-std::array<float,2>{0.155179501f, 0.0966705829f},
-std::array<float,2>{0.787588954f, 0.898780048f},
-std::array<float,2>{0.0679939389f, 0.79451853f},
-std::array<float,2>{0.938850462f, 0.210638613f},
-std::array<float,2>{0.387670159f, 0.303743333f},
-std::array<float,2>{0.656511307f, 0.739320934f}}
\ No newline at end of file
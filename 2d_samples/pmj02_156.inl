@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.161087111f, 0.262607664f},
-std::array<float,2>{0.911454976f, 0.660418749f},
-std::array<float,2>{0.436519384f, 0.888326228f},
-std::array<float,2>{0.724025786f, 0.106084421f},
-std::array<float,2>{0.296035081f, 0.177755654f},
-std::array<float,2>{0.512452543f, 0.824509799f},
-std::array<float,2>{0.0619200692f, 0.580132127f},
-std::array<float,2>{0.775746226f, 0.426094264f},
-std::array<float,2>{0.443857312f, 0.466363996f},
-std::array<float,2>{0.637233853f, 0.525929272f},
-std::array<float,2>{0.217164338f, 0.783827841f},
-std::array<float,2>{0.972199678f, 0.233673304f},
-std::array<float,2>{0.0802225769f, 0.0560913347f},
-std::array<float,2>{0.856843293f, 0.976109922f},
-std::array<float,2>{0.315028846f, 0.710671902f},
-std::array<float,2>{0.616779804f, 0.350212008f},
-std::array<float,2>{1.96687524e-05f, 0.375811696f},
-std::array<float,2>{0.785879374f, 0.621270835f},
-std::array<float,2>{0.256022781f, 0.862438619f},
-std::array<float,2>{0.533635437f, 0.149155334f},
-std::array<float,2>{0.377751857f, 0.0675894544f},
-std::array<float,2>{0.691862404f, 0.920305789f},
-std::array<float,2>{0.132573798f, 0.651121736f},
-std::array<float,2>{0.89049077f, 0.283974111f},
-std::array<float,2>{0.345064849f, 0.326218307f},
-std::array<float,2>{0.578369975f, 0.738367975f},
-std::array<float,2>{0.105635941f, 0.961457968f},
-std::array<float,2>{0.819524765f, 0.000953378563f},
-std::array<float,2>{0.246847004f, 0.197739184f},
-std::array<float,2>{0.964520454f, 0.758153617f},
-std::array<float,2>{0.492918253f, 0.558790505f},
-std::array<float,2>{0.662357032f, 0.495550007f},
-std::array<float,2>{0.195329234f, 0.477782279f},
-std::array<float,2>{0.992804408f, 0.532453239f},
-std::array<float,2>{0.45606035f, 0.774232388f},
-std::array<float,2>{0.648052216f, 0.213933632f},
-std::array<float,2>{0.339912623f, 0.0306342971f},
-std::array<float,2>{0.608145773f, 0.937674344f},
-std::array<float,2>{0.0771698281f, 0.719285011f},
-std::array<float,2>{0.873310506f, 0.333841681f},
-std::array<float,2>{0.407809466f, 0.301704526f},
-std::array<float,2>{0.736590981f, 0.628501594f},
-std::array<float,2>{0.174076781f, 0.924128175f},
-std::array<float,2>{0.931877017f, 0.081975162f},
-std::array<float,2>{0.0340203866f, 0.128920764f},
-std::array<float,2>{0.751492262f, 0.851096213f},
-std::array<float,2>{0.298763484f, 0.598041713f},
-std::array<float,2>{0.521265805f, 0.396835119f},
-std::array<float,2>{0.112101287f, 0.371791631f},
-std::array<float,2>{0.832107902f, 0.694781661f},
-std::array<float,2>{0.3686198f, 0.996632814f},
-std::array<float,2>{0.576453567f, 0.0416868143f},
-std::array<float,2>{0.475366682f, 0.247007921f},
-std::array<float,2>{0.684357584f, 0.808994234f},
-std::array<float,2>{0.220661774f, 0.504341781f},
-std::array<float,2>{0.93855226f, 0.442283571f},
-std::array<float,2>{0.280360848f, 0.418868899f},
-std::array<float,2>{0.561904967f, 0.57493186f},
-std::array<float,2>{0.0251653381f, 0.838328719f},
-std::array<float,2>{0.807702184f, 0.156921893f},
-std::array<float,2>{0.145192832f, 0.119064011f},
-std::array<float,2>{0.898269355f, 0.904907823f},
-std::array<float,2>{0.396440178f, 0.679891288f},
-std::array<float,2>{0.703933179f, 0.280010909f},
-std::array<float,2>{0.228765175f, 0.341571927f},
-std::array<float,2>{0.95175159f, 0.728349447f},
-std::array<float,2>{0.481183976f, 0.952846885f},
-std::array<float,2>{0.67804718f, 0.0229099933f},
-std::array<float,2>{0.364773124f, 0.206795275f},
-std::array<float,2>{0.564658165f, 0.767798483f},
-std::array<float,2>{0.118044674f, 0.544410348f},
-std::array<float,2>{0.842425764f, 0.469322771f},
-std::array<float,2>{0.403636366f, 0.4000898f},
-std::array<float,2>{0.716693223f, 0.604874909f},
-std::array<float,2>{0.150468171f, 0.858952582f},
-std::array<float,2>{0.901886642f, 0.133558601f},
-std::array<float,2>{0.0202535018f, 0.0908024609f},
-std::array<float,2>{0.79954046f, 0.936686158f},
-std::array<float,2>{0.272854865f, 0.637823522f},
-std::array<float,2>{0.552014589f, 0.310355544f},
-std::array<float,2>{0.068107523f, 0.451711774f},
-std::array<float,2>{0.864809275f, 0.512497663f},
-std::array<float,2>{0.334273607f, 0.797680736f},
-std::array<float,2>{0.600439548f, 0.234971821f},
-std::array<float,2>{0.46649757f, 0.0329079293f},
-std::array<float,2>{0.650828123f, 0.988725662f},
-std::array<float,2>{0.189187989f, 0.6990453f},
-std::array<float,2>{0.986583114f, 0.364344686f},
-std::array<float,2>{0.310105741f, 0.267252892f},
-std::array<float,2>{0.527050197f, 0.676311731f},
-std::array<float,2>{0.0439427048f, 0.895707488f},
-std::array<float,2>{0.759345233f, 0.114635751f},
-std::array<float,2>{0.184183627f, 0.170511469f},
-std::array<float,2>{0.928679109f, 0.830642641f},
-std::array<float,2>{0.414616168f, 0.569980621f},
-std::array<float,2>{0.749190271f, 0.413929641f},
-std::array<float,2>{0.132878438f, 0.432771862f},
-std::array<float,2>{0.879843235f, 0.588480234f},
-std::array<float,2>{0.389638156f, 0.816060245f},
-std::array<float,2>{0.69849956f, 0.180722862f},
-std::array<float,2>{0.258892477f, 0.100146435f},
-std::array<float,2>{0.542406261f, 0.875402451f},
-std::array<float,2>{0.009323515f, 0.670225561f},
-std::array<float,2>{0.791374743f, 0.251186192f},
-std::array<float,2>{0.48550263f, 0.358901232f},
-std::array<float,2>{0.667275906f, 0.713643074f},
-std::array<float,2>{0.239588559f, 0.980780363f},
-std::array<float,2>{0.95957613f, 0.0503957719f},
-std::array<float,2>{0.100004725f, 0.218791872f},
-std::array<float,2>{0.826872706f, 0.789739966f},
-std::array<float,2>{0.35439384f, 0.522794485f},
-std::array<float,2>{0.591554523f, 0.460000038f},
-std::array<float,2>{0.0473777577f, 0.289900988f},
-std::array<float,2>{0.768504024f, 0.647836447f},
-std::array<float,2>{0.286839515f, 0.907195747f},
-std::array<float,2>{0.503010333f, 0.0724911243f},
-std::array<float,2>{0.429558218f, 0.146773294f},
-std::array<float,2>{0.732408643f, 0.874112725f},
-std::array<float,2>{0.171207011f, 0.61691767f},
-std::array<float,2>{0.920631647f, 0.388318568f},
-std::array<float,2>{0.32691595f, 0.48894608f},
-std::array<float,2>{0.61792773f, 0.547605634f},
-std::array<float,2>{0.0910269842f, 0.753772676f},
-std::array<float,2>{0.844555974f, 0.19376871f},
-std::array<float,2>{0.209299788f, 0.0124677243f},
-std::array<float,2>{0.982326925f, 0.955118001f},
-std::array<float,2>{0.451877147f, 0.748774469f},
-std::array<float,2>{0.629521787f, 0.313206226f},
-std::array<float,2>{0.154033929f, 0.346015126f},
-std::array<float,2>{0.905882239f, 0.704841673f},
-std::array<float,2>{0.401094258f, 0.970380306f},
-std::array<float,2>{0.714313269f, 0.0604740307f},
-std::array<float,2>{0.268665373f, 0.227038205f},
-std::array<float,2>{0.550225973f, 0.785486758f},
-std::array<float,2>{0.0159136131f, 0.528816104f},
-std::array<float,2>{0.802937627f, 0.463040918f},
-std::array<float,2>{0.478070021f, 0.422937393f},
-std::array<float,2>{0.673775315f, 0.58401233f},
-std::array<float,2>{0.230586469f, 0.822931826f},
-std::array<float,2>{0.948995113f, 0.173645481f},
-std::array<float,2>{0.12120901f, 0.10405656f},
-std::array<float,2>{0.836769879f, 0.884277582f},
-std::array<float,2>{0.360486507f, 0.658922493f},
-std::array<float,2>{0.569871843f, 0.258552223f},
-std::array<float,2>{0.0410412401f, 0.496476769f},
-std::array<float,2>{0.762617707f, 0.555828214f},
-std::array<float,2>{0.305498749f, 0.763496995f},
-std::array<float,2>{0.52877003f, 0.199922353f},
-std::array<float,2>{0.419964671f, 0.00707967626f},
-std::array<float,2>{0.74383074f, 0.966870844f},
-std::array<float,2>{0.182493269f, 0.737011015f},
-std::array<float,2>{0.924015224f, 0.3241795f},
-std::array<float,2>{0.331151009f, 0.285416067f},
-std::array<float,2>{0.594586551f, 0.652590811f},
-std::array<float,2>{0.0659541339f, 0.914093554f},
-std::array<float,2>{0.860518754f, 0.0658288002f},
-std::array<float,2>{0.19208762f, 0.153749883f},
-std::array<float,2>{0.991122484f, 0.866479933f},
-std::array<float,2>{0.462470174f, 0.619484782f},
-std::array<float,2>{0.65396291f, 0.38267976f},
-std::array<float,2>{0.236964345f, 0.391918182f},
-std::array<float,2>{0.95482111f, 0.595884144f},
-std::array<float,2>{0.490912646f, 0.845684648f},
-std::array<float,2>{0.669302464f, 0.125410318f},
-std::array<float,2>{0.357769996f, 0.0848439559f},
-std::array<float,2>{0.589718103f, 0.929009616f},
-std::array<float,2>{0.0949700922f, 0.628995717f},
-std::array<float,2>{0.822435677f, 0.297104299f},
-std::array<float,2>{0.386371553f, 0.329463691f},
-std::array<float,2>{0.699825943f, 0.722743154f},
-std::array<float,2>{0.137872949f, 0.942054331f},
-std::array<float,2>{0.877474844f, 0.0234568082f},
-std::array<float,2>{0.0120945713f, 0.217713222f},
-std::array<float,2>{0.794662893f, 0.77876091f},
-std::array<float,2>{0.264306128f, 0.538693845f},
-std::array<float,2>{0.544071674f, 0.482742578f},
-std::array<float,2>{0.0897811428f, 0.2767317f},
-std::array<float,2>{0.848489881f, 0.686940312f},
-std::array<float,2>{0.322003007f, 0.901802123f},
-std::array<float,2>{0.621491492f, 0.121902086f},
-std::array<float,2>{0.446679443f, 0.16328223f},
-std::array<float,2>{0.628511488f, 0.840046883f},
-std::array<float,2>{0.20394586f, 0.570801616f},
-std::array<float,2>{0.978227675f, 0.414779514f},
-std::array<float,2>{0.284618616f, 0.44043228f},
-std::array<float,2>{0.504114926f, 0.500908375f},
-std::array<float,2>{0.0528699011f, 0.806279659f},
-std::array<float,2>{0.771830142f, 0.242595986f},
-std::array<float,2>{0.166261986f, 0.0460565798f},
-std::array<float,2>{0.916870475f, 0.993192971f},
-std::array<float,2>{0.424728125f, 0.69056493f},
-std::array<float,2>{0.730452716f, 0.370231926f},
-std::array<float,2>{0.211666629f, 0.308267862f},
-std::array<float,2>{0.974094689f, 0.636555016f},
-std::array<float,2>{0.438206136f, 0.932815671f},
-std::array<float,2>{0.632989585f, 0.0880252793f},
-std::array<float,2>{0.317693472f, 0.140335098f},
-std::array<float,2>{0.613189876f, 0.855440319f},
-std::array<float,2>{0.0832718313f, 0.608664691f},
-std::array<float,2>{0.854942977f, 0.404760897f},
-std::array<float,2>{0.430031955f, 0.473575681f},
-std::array<float,2>{0.719949722f, 0.539912224f},
-std::array<float,2>{0.157861829f, 0.770234108f},
-std::array<float,2>{0.908379436f, 0.20714815f},
-std::array<float,2>{0.0579733327f, 0.0183263216f},
-std::array<float,2>{0.780542076f, 0.94912535f},
-std::array<float,2>{0.291861326f, 0.733048797f},
-std::array<float,2>{0.511392534f, 0.339041859f},
-std::array<float,2>{0.103830151f, 0.4080621f},
-std::array<float,2>{0.814199567f, 0.564047933f},
-std::array<float,2>{0.347718805f, 0.83399719f},
-std::array<float,2>{0.582422554f, 0.167110816f},
-std::array<float,2>{0.499159425f, 0.113020867f},
-std::array<float,2>{0.658730626f, 0.891417563f},
-std::array<float,2>{0.245909691f, 0.672243118f},
-std::array<float,2>{0.965823948f, 0.270515531f},
-std::array<float,2>{0.252337486f, 0.362973452f},
-std::array<float,2>{0.53768456f, 0.701741755f},
-std::array<float,2>{0.004956441f, 0.987641573f},
-std::array<float,2>{0.784071565f, 0.0370419621f},
-std::array<float,2>{0.125066593f, 0.240901768f},
-std::array<float,2>{0.883413851f, 0.80325073f},
-std::array<float,2>{0.381055683f, 0.511598468f},
-std::array<float,2>{0.687890768f, 0.446267873f},
-std::array<float,2>{0.177771762f, 0.456478804f},
-std::array<float,2>{0.934236705f, 0.518543899f},
-std::array<float,2>{0.411079735f, 0.794241369f},
-std::array<float,2>{0.738438308f, 0.222921789f},
-std::array<float,2>{0.303965658f, 0.0524719842f},
-std::array<float,2>{0.516383469f, 0.978474319f},
-std::array<float,2>{0.0373793058f, 0.717221797f},
-std::array<float,2>{0.754568279f, 0.355386466f},
-std::array<float,2>{0.460241407f, 0.254653633f},
-std::array<float,2>{0.641619742f, 0.665674329f},
-std::array<float,2>{0.202787057f, 0.881408572f},
-std::array<float,2>{0.997173071f, 0.0971746892f},
-std::array<float,2>{0.0704964921f, 0.183713764f},
-std::array<float,2>{0.868317127f, 0.818113208f},
-std::array<float,2>{0.33662805f, 0.591365635f},
-std::array<float,2>{0.602634132f, 0.437163234f},
-std::array<float,2>{0.0278383438f, 0.320146561f},
-std::array<float,2>{0.808967888f, 0.745273232f},
-std::array<float,2>{0.27385658f, 0.959735036f},
-std::array<float,2>{0.556416273f, 0.00945919566f},
-std::array<float,2>{0.393565327f, 0.190151125f},
-std::array<float,2>{0.707749069f, 0.753960431f},
-std::array<float,2>{0.144033402f, 0.554149687f},
-std::array<float,2>{0.892312765f, 0.485021293f},
-std::array<float,2>{0.371677309f, 0.386461377f},
-std::array<float,2>{0.573052824f, 0.61073488f},
-std::array<float,2>{0.115249336f, 0.868668199f},
-std::array<float,2>{0.829916835f, 0.143399626f},
-std::array<float,2>{0.223005161f, 0.0775128305f},
-std::array<float,2>{0.944996595f, 0.9129861f},
-std::array<float,2>{0.470670819f, 0.642068923f},
-std::array<float,2>{0.682354748f, 0.296219289f},
-std::array<float,2>{0.130145863f, 0.282846838f},
-std::array<float,2>{0.88848716f, 0.649005115f},
-std::array<float,2>{0.376287192f, 0.919653475f},
-std::array<float,2>{0.694926858f, 0.0697797984f},
-std::array<float,2>{0.254463673f, 0.151003778f},
-std::array<float,2>{0.533166707f, 0.859942853f},
-std::array<float,2>{0.00227019354f, 0.6240201f},
-std::array<float,2>{0.78854084f, 0.378601611f},
-std::array<float,2>{0.495209515f, 0.494022578f},
-std::array<float,2>{0.660958111f, 0.561058998f},
-std::array<float,2>{0.248151779f, 0.759770572f},
-std::array<float,2>{0.96115768f, 0.195822656f},
-std::array<float,2>{0.107630976f, 0.00287396507f},
-std::array<float,2>{0.817025125f, 0.964003265f},
-std::array<float,2>{0.346185386f, 0.741987526f},
-std::array<float,2>{0.582024217f, 0.32610321f},
-std::array<float,2>{0.0590690225f, 0.428240776f},
-std::array<float,2>{0.774409056f, 0.579723716f},
-std::array<float,2>{0.294828624f, 0.827783704f},
-std::array<float,2>{0.515024841f, 0.177028716f},
-std::array<float,2>{0.43359831f, 0.108738549f},
-std::array<float,2>{0.724768519f, 0.889303029f},
-std::array<float,2>{0.163645789f, 0.662614167f},
-std::array<float,2>{0.913957477f, 0.264909267f},
-std::array<float,2>{0.314223707f, 0.34934321f},
-std::array<float,2>{0.614767432f, 0.707234085f},
-std::array<float,2>{0.0786956176f, 0.973147392f},
-std::array<float,2>{0.858842671f, 0.0568721667f},
-std::array<float,2>{0.215528384f, 0.231435046f},
-std::array<float,2>{0.969076693f, 0.782239258f},
-std::array<float,2>{0.442287326f, 0.525358856f},
-std::array<float,2>{0.638897896f, 0.466999978f},
-std::array<float,2>{0.22170116f, 0.443814397f},
-std::array<float,2>{0.93995136f, 0.506361365f},
-std::array<float,2>{0.472844958f, 0.811437786f},
-std::array<float,2>{0.687239528f, 0.248860091f},
-std::array<float,2>{0.369556069f, 0.0397843048f},
-std::array<float,2>{0.574369073f, 0.998959124f},
-std::array<float,2>{0.11051818f, 0.692763448f},
-std::array<float,2>{0.834883273f, 0.374969691f},
-std::array<float,2>{0.397012264f, 0.277437598f},
-std::array<float,2>{0.706262827f, 0.681797385f},
-std::array<float,2>{0.148107201f, 0.903723478f},
-std::array<float,2>{0.89627558f, 0.120311715f},
-std::array<float,2>{0.0271534808f, 0.158666804f},
-std::array<float,2>{0.804775894f, 0.836867869f},
-std::array<float,2>{0.27875632f, 0.577977836f},
-std::array<float,2>{0.559585631f, 0.420251369f},
-std::array<float,2>{0.0749724731f, 0.335908055f},
-std::array<float,2>{0.872789264f, 0.72104758f},
-std::array<float,2>{0.342007518f, 0.941215873f},
-std::array<float,2>{0.606995761f, 0.0273481794f},
-std::array<float,2>{0.453778148f, 0.21113129f},
-std::array<float,2>{0.645460129f, 0.77677989f},
-std::array<float,2>{0.198363602f, 0.534924209f},
-std::array<float,2>{0.995187342f, 0.480436385f},
-std::array<float,2>{0.299966127f, 0.396372467f},
-std::array<float,2>{0.523264825f, 0.600082815f},
-std::array<float,2>{0.0329879075f, 0.847931206f},
-std::array<float,2>{0.752988994f, 0.131259039f},
-std::array<float,2>{0.172827989f, 0.0791148841f},
-std::array<float,2>{0.93020004f, 0.923503876f},
-std::array<float,2>{0.409313977f, 0.626245081f},
-std::array<float,2>{0.735312939f, 0.302948773f},
-std::array<float,2>{0.191250369f, 0.366593271f},
-std::array<float,2>{0.984946847f, 0.696578503f},
-std::array<float,2>{0.467966437f, 0.991297364f},
-std::array<float,2>{0.650304198f, 0.034861058f},
-std::array<float,2>{0.332040161f, 0.23684971f},
-std::array<float,2>{0.597738326f, 0.799220085f},
-std::array<float,2>{0.0689008087f, 0.515330195f},
-std::array<float,2>{0.866625011f, 0.450017571f},
-std::array<float,2>{0.416352034f, 0.411978573f},
-std::array<float,2>{0.748042405f, 0.568224788f},
-std::array<float,2>{0.186126709f, 0.829557598f},
-std::array<float,2>{0.926772654f, 0.169561043f},
-std::array<float,2>{0.0450005494f, 0.11690174f},
-std::array<float,2>{0.761105537f, 0.896727562f},
-std::array<float,2>{0.311657369f, 0.678128421f},
-std::array<float,2>{0.524676681f, 0.267957449f},
-std::array<float,2>{0.11937768f, 0.471791089f},
-std::array<float,2>{0.840952098f, 0.546643555f},
-std::array<float,2>{0.367158085f, 0.766195238f},
-std::array<float,2>{0.564246595f, 0.204793081f},
-std::array<float,2>{0.483028531f, 0.0209551565f},
-std::array<float,2>{0.676322877f, 0.951120734f},
-std::array<float,2>{0.226883158f, 0.72928375f},
-std::array<float,2>{0.949761152f, 0.342338681f},
-std::array<float,2>{0.270740688f, 0.312402517f},
-std::array<float,2>{0.55404228f, 0.639243245f},
-std::array<float,2>{0.0224040542f, 0.934011042f},
-std::array<float,2>{0.79880178f, 0.0920958742f},
-std::array<float,2>{0.148875743f, 0.1362537f},
-std::array<float,2>{0.900369525f, 0.856884241f},
-std::array<float,2>{0.405000001f, 0.602065086f},
-std::array<float,2>{0.718405306f, 0.40173012f},
-std::array<float,2>{0.169236347f, 0.389290154f},
-std::array<float,2>{0.919032574f, 0.613588989f},
-std::array<float,2>{0.426880479f, 0.872723579f},
-std::array<float,2>{0.732433021f, 0.145454139f},
-std::array<float,2>{0.287884325f, 0.0712285191f},
-std::array<float,2>{0.500841737f, 0.909506857f},
-std::array<float,2>{0.0501717255f, 0.644922733f},
-std::array<float,2>{0.767213404f, 0.292830139f},
-std::array<float,2>{0.449648052f, 0.31479165f},
-std::array<float,2>{0.632029116f, 0.746986449f},
-std::array<float,2>{0.208740279f, 0.954038084f},
-std::array<float,2>{0.984360158f, 0.0137892812f},
-std::array<float,2>{0.093653582f, 0.192005768f},
-std::array<float,2>{0.847087026f, 0.751288474f},
-std::array<float,2>{0.326022089f, 0.550667822f},
-std::array<float,2>{0.620532572f, 0.4909814f},
-std::array<float,2>{0.00981797371f, 0.252724946f},
-std::array<float,2>{0.789894998f, 0.668342292f},
-std::array<float,2>{0.260798186f, 0.877976358f},
-std::array<float,2>{0.540977001f, 0.0995071307f},
-std::array<float,2>{0.388074964f, 0.182228222f},
-std::array<float,2>{0.695722818f, 0.81413275f},
-std::array<float,2>{0.135565817f, 0.586877346f},
-std::array<float,2>{0.881529331f, 0.43002969f},
-std::array<float,2>{0.352097452f, 0.458002925f},
-std::array<float,2>{0.592612624f, 0.52129817f},
-std::array<float,2>{0.0987409055f, 0.791641533f},
-std::array<float,2>{0.824497759f, 0.22250548f},
-std::array<float,2>{0.241196617f, 0.0476903059f},
-std::array<float,2>{0.958015501f, 0.982850254f},
-std::array<float,2>{0.486834317f, 0.711858511f},
-std::array<float,2>{0.665495455f, 0.356864512f},
-std::array<float,2>{0.179801866f, 0.321825296f},
-std::array<float,2>{0.923798859f, 0.734719932f},
-std::array<float,2>{0.419199109f, 0.966485918f},
-std::array<float,2>{0.745532691f, 0.00493795006f},
-std::array<float,2>{0.307554126f, 0.201248661f},
-std::array<float,2>{0.529481471f, 0.764689088f},
-std::array<float,2>{0.0399853252f, 0.558130264f},
-std::array<float,2>{0.765008986f, 0.498311341f},
-std::array<float,2>{0.464526147f, 0.380423486f},
-std::array<float,2>{0.654837847f, 0.6174317f},
-std::array<float,2>{0.194271699f, 0.863857508f},
-std::array<float,2>{0.989798367f, 0.155693501f},
-std::array<float,2>{0.0632293224f, 0.0634426624f},
-std::array<float,2>{0.862742603f, 0.916433752f},
-std::array<float,2>{0.329756171f, 0.655513763f},
-std::array<float,2>{0.596127212f, 0.288736045f},
-std::array<float,2>{0.0178476702f, 0.462286979f},
-std::array<float,2>{0.801279783f, 0.530659854f},
-std::array<float,2>{0.266483217f, 0.788771272f},
-std::array<float,2>{0.54702127f, 0.228786945f},
-std::array<float,2>{0.400034279f, 0.0606195033f},
-std::array<float,2>{0.71162641f, 0.972652018f},
-std::array<float,2>{0.155829817f, 0.706060648f},
-std::array<float,2>{0.90410918f, 0.344333678f},
-std::array<float,2>{0.363179058f, 0.260767043f},
-std::array<float,2>{0.566425085f, 0.656480849f},
-std::array<float,2>{0.124378279f, 0.885490358f},
-std::array<float,2>{0.839597464f, 0.102846295f},
-std::array<float,2>{0.232843339f, 0.174185708f},
-std::array<float,2>{0.946769893f, 0.821386099f},
-std::array<float,2>{0.479039431f, 0.582818627f},
-std::array<float,2>{0.675773919f, 0.424178451f},
-std::array<float,2>{0.206098169f, 0.416238427f},
-std::array<float,2>{0.980274379f, 0.573586643f},
-std::array<float,2>{0.448191077f, 0.842223585f},
-std::array<float,2>{0.625674009f, 0.161860958f},
-std::array<float,2>{0.322449714f, 0.124412231f},
-std::array<float,2>{0.624032259f, 0.899020851f},
-std::array<float,2>{0.0866536871f, 0.684178472f},
-std::array<float,2>{0.851067841f, 0.27442494f},
-std::array<float,2>{0.423586279f, 0.368793964f},
-std::array<float,2>{0.728373408f, 0.688483119f},
-std::array<float,2>{0.164153025f, 0.995095372f},
-std::array<float,2>{0.9159711f, 0.0434072688f},
-std::array<float,2>{0.0510450527f, 0.244711459f},
-std::array<float,2>{0.769596338f, 0.808365583f},
-std::array<float,2>{0.28268531f, 0.503352046f},
-std::array<float,2>{0.507306755f, 0.437847376f},
-std::array<float,2>{0.0958988592f, 0.299428523f},
-std::array<float,2>{0.820675075f, 0.632486165f},
-std::array<float,2>{0.357071072f, 0.927663326f},
-std::array<float,2>{0.587042868f, 0.0831674188f},
-std::array<float,2>{0.489548564f, 0.1277439f},
-std::array<float,2>{0.670293033f, 0.846490324f},
-std::array<float,2>{0.234802514f, 0.594280243f},
-std::array<float,2>{0.956959426f, 0.394312322f},
-std::array<float,2>{0.262859106f, 0.480548143f},
-std::array<float,2>{0.545883298f, 0.536783218f},
-std::array<float,2>{0.0147881983f, 0.779420853f},
-std::array<float,2>{0.795961499f, 0.215224087f},
-std::array<float,2>{0.140153199f, 0.0267666075f},
-std::array<float,2>{0.875172734f, 0.945112288f},
-std::array<float,2>{0.383992165f, 0.72580719f},
-std::array<float,2>{0.701190412f, 0.331452578f},
-std::array<float,2>{0.24274908f, 0.272656798f},
-std::array<float,2>{0.967589974f, 0.675656617f},
-std::array<float,2>{0.49720335f, 0.89345628f},
-std::array<float,2>{0.657529175f, 0.109825015f},
-std::array<float,2>{0.350079596f, 0.164978921f},
-std::array<float,2>{0.584854662f, 0.832733274f},
-std::array<float,2>{0.10316515f, 0.565161467f},
-std::array<float,2>{0.815953732f, 0.408497065f},
-std::array<float,2>{0.3793194f, 0.449078888f},
-std::array<float,2>{0.691079736f, 0.508637369f},
-std::array<float,2>{0.128182679f, 0.801203609f},
-std::array<float,2>{0.885355115f, 0.238677621f},
-std::array<float,2>{0.00767809758f, 0.0374237858f},
-std::array<float,2>{0.78292948f, 0.985309541f},
-std::array<float,2>{0.250196755f, 0.701155901f},
-std::array<float,2>{0.535314202f, 0.360975266f},
-std::array<float,2>{0.0853360593f, 0.403016925f},
-std::array<float,2>{0.852161884f, 0.606997132f},
-std::array<float,2>{0.318606704f, 0.852843642f},
-std::array<float,2>{0.609400809f, 0.137944475f},
-std::array<float,2>{0.440319747f, 0.0862993225f},
-std::array<float,2>{0.635664761f, 0.931614816f},
-std::array<float,2>{0.213276029f, 0.633741796f},
-std::array<float,2>{0.975647509f, 0.306186765f},
-std::array<float,2>{0.289503604f, 0.33766982f},
-std::array<float,2>{0.509309471f, 0.730565786f},
-std::array<float,2>{0.0549574308f, 0.945793092f},
-std::array<float,2>{0.77877754f, 0.0175352413f},
-std::array<float,2>{0.158426821f, 0.210059255f},
-std::array<float,2>{0.906447887f, 0.772036374f},
-std::array<float,2>{0.432644218f, 0.54170692f},
-std::array<float,2>{0.721463859f, 0.475306541f},
-std::array<float,2>{0.14198786f, 0.488225967f},
-std::array<float,2>{0.893560946f, 0.552629113f},
-std::array<float,2>{0.391531408f, 0.757127762f},
-std::array<float,2>{0.710895717f, 0.187505275f},
-std::array<float,2>{0.275475234f, 0.0101080658f},
-std::array<float,2>{0.556661725f, 0.958537221f},
-std::array<float,2>{0.0309668537f, 0.744046926f},
-std::array<float,2>{0.810997427f, 0.316449732f},
-std::array<float,2>{0.470736951f, 0.294905424f},
-std::array<float,2>{0.680221081f, 0.644126296f},
-std::array<float,2>{0.226382971f, 0.910399556f},
-std::array<float,2>{0.941532254f, 0.0759365857f},
-std::array<float,2>{0.11434947f, 0.141501516f},
-std::array<float,2>{0.830456972f, 0.869273782f},
-std::array<float,2>{0.373232454f, 0.61172843f},
-std::array<float,2>{0.570892513f, 0.384190112f},
-std::array<float,2>{0.036366269f, 0.352685988f},
-std::array<float,2>{0.755896509f, 0.716080844f},
-std::array<float,2>{0.301037937f, 0.978661418f},
-std::array<float,2>{0.51850462f, 0.0541527905f},
-std::array<float,2>{0.413902521f, 0.224841222f},
-std::array<float,2>{0.741328061f, 0.796501935f},
-std::array<float,2>{0.177326083f, 0.517536223f},
-std::array<float,2>{0.935563624f, 0.453303784f},
-std::array<float,2>{0.338749021f, 0.434874922f},
-std::array<float,2>{0.604598761f, 0.592594922f},
-std::array<float,2>{0.0732598007f, 0.819659829f},
-std::array<float,2>{0.870958328f, 0.187459141f},
-std::array<float,2>{0.200215921f, 0.0948151499f},
-std::array<float,2>{0.999760926f, 0.879036009f},
-std::array<float,2>{0.457379669f, 0.667106867f},
-std::array<float,2>{0.643361509f, 0.255990475f},
-std::array<float,2>{0.175157562f, 0.304672122f},
-std::array<float,2>{0.933303833f, 0.625872254f},
-std::array<float,2>{0.406728297f, 0.922343016f},
-std::array<float,2>{0.738074839f, 0.0784145147f},
-std::array<float,2>{0.297822088f, 0.132049307f},
-std::array<float,2>{0.519830942f, 0.849429846f},
-std::array<float,2>{0.0344562829f, 0.600765049f},
-std::array<float,2>{0.750056148f, 0.395331115f},
-std::array<float,2>{0.455862731f, 0.47899583f},
-std::array<float,2>{0.647006631f, 0.5337708f},
-std::array<float,2>{0.196428001f, 0.775719523f},
-std::array<float,2>{0.99402374f, 0.212082714f},
-std::array<float,2>{0.0769742131f, 0.0285085309f},
-std::array<float,2>{0.874328554f, 0.939798832f},
-std::array<float,2>{0.341151863f, 0.722177386f},
-std::array<float,2>{0.609028459f, 0.334921509f},
-std::array<float,2>{0.0243910402f, 0.421854645f},
-std::array<float,2>{0.807022452f, 0.576383173f},
-std::array<float,2>{0.280097187f, 0.837519705f},
-std::array<float,2>{0.561124742f, 0.159546494f},
-std::array<float,2>{0.394592702f, 0.119703583f},
-std::array<float,2>{0.704631984f, 0.90315634f},
-std::array<float,2>{0.145624921f, 0.682900131f},
-std::array<float,2>{0.896892726f, 0.278598756f},
-std::array<float,2>{0.367742866f, 0.373173654f},
-std::array<float,2>{0.577239752f, 0.691563249f},
-std::array<float,2>{0.112465128f, 0.999535084f},
-std::array<float,2>{0.833393514f, 0.0406026058f},
-std::array<float,2>{0.219006732f, 0.249206051f},
-std::array<float,2>{0.93805325f, 0.8121593f},
-std::array<float,2>{0.476537019f, 0.507483006f},
-std::array<float,2>{0.684833407f, 0.444531381f},
-std::array<float,2>{0.217921078f, 0.468685776f},
-std::array<float,2>{0.971452713f, 0.523483753f},
-std::array<float,2>{0.444867641f, 0.781853318f},
-std::array<float,2>{0.638072133f, 0.232053429f},
-std::array<float,2>{0.315895498f, 0.0585284941f},
-std::array<float,2>{0.615896761f, 0.974332571f},
-std::array<float,2>{0.0811301842f, 0.708203495f},
-std::array<float,2>{0.856144369f, 0.348544866f},
-std::array<float,2>{0.436612934f, 0.263967127f},
-std::array<float,2>{0.723175287f, 0.663276196f},
-std::array<float,2>{0.161303759f, 0.890103042f},
-std::array<float,2>{0.91084826f, 0.107907616f},
-std::array<float,2>{0.0612862408f, 0.176362708f},
-std::array<float,2>{0.777242005f, 0.827108204f},
-std::array<float,2>{0.295397878f, 0.579065621f},
-std::array<float,2>{0.512796819f, 0.42891705f},
-std::array<float,2>{0.107182078f, 0.324471235f},
-std::array<float,2>{0.818558633f, 0.740668058f},
-std::array<float,2>{0.34461078f, 0.963605762f},
-std::array<float,2>{0.579791784f, 0.0031285251f},
-std::array<float,2>{0.493961632f, 0.196772158f},
-std::array<float,2>{0.663796186f, 0.761708558f},
-std::array<float,2>{0.247578785f, 0.562458098f},
-std::array<float,2>{0.963822663f, 0.4926413f},
-std::array<float,2>{0.256900042f, 0.377554625f},
-std::array<float,2>{0.534851968f, 0.624637604f},
-std::array<float,2>{0.00150826038f, 0.860383272f},
-std::array<float,2>{0.787027597f, 0.151487097f},
-std::array<float,2>{0.131589845f, 0.0693159625f},
-std::array<float,2>{0.889299095f, 0.918193221f},
-std::array<float,2>{0.378194988f, 0.650050819f},
-std::array<float,2>{0.693303883f, 0.281569421f},
-std::array<float,2>{0.239094839f, 0.355993181f},
-std::array<float,2>{0.960317969f, 0.711999416f},
-std::array<float,2>{0.485084593f, 0.98346144f},
-std::array<float,2>{0.666945755f, 0.0483644493f},
-std::array<float,2>{0.354624808f, 0.221097231f},
-std::array<float,2>{0.590206563f, 0.792421401f},
-std::array<float,2>{0.101060227f, 0.520238936f},
-std::array<float,2>{0.827726185f, 0.458608806f},
-std::array<float,2>{0.39034012f, 0.431293428f},
-std::array<float,2>{0.697867632f, 0.587277889f},
-std::array<float,2>{0.134499729f, 0.812745631f},
-std::array<float,2>{0.880328715f, 0.182679638f},
-std::array<float,2>{0.00863634516f, 0.0976899043f},
-std::array<float,2>{0.792021334f, 0.877891421f},
-std::array<float,2>{0.257884473f, 0.669512212f},
-std::array<float,2>{0.541027606f, 0.253056139f},
-std::array<float,2>{0.0906699076f, 0.491916269f},
-std::array<float,2>{0.845477462f, 0.549064875f},
-std::array<float,2>{0.32773146f, 0.750478745f},
-std::array<float,2>{0.618719339f, 0.192755908f},
-std::array<float,2>{0.452917606f, 0.0146757364f},
-std::array<float,2>{0.630516469f, 0.955049396f},
-std::array<float,2>{0.210414723f, 0.747111499f},
-std::array<float,2>{0.980801225f, 0.316145033f},
-std::array<float,2>{0.285568029f, 0.291930616f},
-std::array<float,2>{0.501994252f, 0.645524204f},
-std::array<float,2>{0.048701819f, 0.909070969f},
-std::array<float,2>{0.768767238f, 0.0714406297f},
-std::array<float,2>{0.170789957f, 0.146402016f},
-std::array<float,2>{0.921323299f, 0.871332169f},
-std::array<float,2>{0.428085148f, 0.614603698f},
-std::array<float,2>{0.730913877f, 0.389804125f},
-std::array<float,2>{0.151865438f, 0.4003914f},
-std::array<float,2>{0.900963545f, 0.603111565f},
-std::array<float,2>{0.40310654f, 0.855578125f},
-std::array<float,2>{0.714846432f, 0.135056585f},
-std::array<float,2>{0.272166848f, 0.0934636444f},
-std::array<float,2>{0.551366746f, 0.934795499f},
-std::array<float,2>{0.021461172f, 0.640490711f},
-std::array<float,2>{0.799974263f, 0.311271042f},
-std::array<float,2>{0.481938452f, 0.343240708f},
-std::array<float,2>{0.678896546f, 0.729929566f},
-std::array<float,2>{0.230181009f, 0.949777663f},
-std::array<float,2>{0.952980638f, 0.019802833f},
-std::array<float,2>{0.119095944f, 0.203181267f},
-std::array<float,2>{0.843675435f, 0.766644359f},
-std::array<float,2>{0.363482416f, 0.545520306f},
-std::array<float,2>{0.565997422f, 0.470962286f},
-std::array<float,2>{0.0440591946f, 0.269022942f},
-std::array<float,2>{0.758554339f, 0.679274499f},
-std::array<float,2>{0.309147418f, 0.898197591f},
-std::array<float,2>{0.526166439f, 0.115589179f},
-std::array<float,2>{0.415285647f, 0.168310747f},
-std::array<float,2>{0.748399198f, 0.828314006f},
-std::array<float,2>{0.185442924f, 0.566991508f},
-std::array<float,2>{0.929356635f, 0.410295486f},
-std::array<float,2>{0.33578068f, 0.450351059f},
-std::array<float,2>{0.600943506f, 0.514070034f},
-std::array<float,2>{0.0673659295f, 0.800652683f},
-std::array<float,2>{0.863543212f, 0.237838358f},
-std::array<float,2>{0.18789506f, 0.0333442427f},
-std::array<float,2>{0.987470329f, 0.990919054f},
-std::array<float,2>{0.464984834f, 0.695654392f},
-std::array<float,2>{0.651467025f, 0.365661055f},
-std::array<float,2>{0.137383893f, 0.330243915f},
-std::array<float,2>{0.878260314f, 0.724673212f},
-std::array<float,2>{0.384974808f, 0.94345957f},
-std::array<float,2>{0.700721264f, 0.0261305626f},
-std::array<float,2>{0.265304297f, 0.216091156f},
-std::array<float,2>{0.543181479f, 0.780452669f},
-std::array<float,2>{0.0128396638f, 0.535357952f},
-std::array<float,2>{0.793069184f, 0.481529891f},
-std::array<float,2>{0.491830945f, 0.39260909f},
-std::array<float,2>{0.668007374f, 0.594824076f},
-std::array<float,2>{0.237424985f, 0.846797943f},
-std::array<float,2>{0.954101026f, 0.128009543f},
-std::array<float,2>{0.0943100601f, 0.0820732117f},
-std::array<float,2>{0.823919773f, 0.925874054f},
-std::array<float,2>{0.358542293f, 0.631000161f},
-std::array<float,2>{0.588401616f, 0.299934745f},
-std::array<float,2>{0.0544770807f, 0.438531041f},
-std::array<float,2>{0.772478998f, 0.502581537f},
-std::array<float,2>{0.283982784f, 0.807023108f},
-std::array<float,2>{0.50550288f, 0.245823473f},
-std::array<float,2>{0.425755948f, 0.0441791639f},
-std::array<float,2>{0.728530467f, 0.995940268f},
-std::array<float,2>{0.16773349f, 0.688369215f},
-std::array<float,2>{0.917788267f, 0.367701769f},
-std::array<float,2>{0.320998818f, 0.274072051f},
-std::array<float,2>{0.622202933f, 0.684906662f},
-std::array<float,2>{0.0886029676f, 0.900029719f},
-std::array<float,2>{0.849317253f, 0.123584479f},
-std::array<float,2>{0.204658329f, 0.160309523f},
-std::array<float,2>{0.977093697f, 0.843072474f},
-std::array<float,2>{0.445608824f, 0.572489798f},
-std::array<float,2>{0.627704501f, 0.417149156f},
-std::array<float,2>{0.231588587f, 0.42504406f},
-std::array<float,2>{0.947653294f, 0.583428562f},
-std::array<float,2>{0.477490216f, 0.820422113f},
-std::array<float,2>{0.672371268f, 0.175430819f},
-std::array<float,2>{0.360320359f, 0.102004729f},
-std::array<float,2>{0.568761051f, 0.886589408f},
-std::array<float,2>{0.122537062f, 0.65810287f},
-std::array<float,2>{0.837755501f, 0.259867102f},
-std::array<float,2>{0.401788801f, 0.344865769f},
-std::array<float,2>{0.713290513f, 0.705327988f},
-std::array<float,2>{0.152883992f, 0.971297324f},
-std::array<float,2>{0.90467453f, 0.0615821369f},
-std::array<float,2>{0.0168936718f, 0.229590788f},
-std::array<float,2>{0.804085553f, 0.78760314f},
-std::array<float,2>{0.268032998f, 0.529648781f},
-std::array<float,2>{0.549509466f, 0.461328328f},
-std::array<float,2>{0.0652743801f, 0.288038224f},
-std::array<float,2>{0.859618425f, 0.655192554f},
-std::array<float,2>{0.330214441f, 0.917103171f},
-std::array<float,2>{0.595606506f, 0.064337045f},
-std::array<float,2>{0.461151153f, 0.154812112f},
-std::array<float,2>{0.652661443f, 0.864591837f},
-std::array<float,2>{0.193037108f, 0.618555784f},
-std::array<float,2>{0.991882086f, 0.379618287f},
-std::array<float,2>{0.30660823f, 0.49927932f},
-std::array<float,2>{0.527620018f, 0.556788445f},
-std::array<float,2>{0.0421452969f, 0.764457107f},
-std::array<float,2>{0.76278913f, 0.202244386f},
-std::array<float,2>{0.182760775f, 0.00446821749f},
-std::array<float,2>{0.925470591f, 0.965234935f},
-std::array<float,2>{0.421136618f, 0.735756934f},
-std::array<float,2>{0.742462516f, 0.320531458f},
-std::array<float,2>{0.201825365f, 0.257313699f},
-std::array<float,2>{0.996193051f, 0.666500747f},
-std::array<float,2>{0.459510058f, 0.88006103f},
-std::array<float,2>{0.64092356f, 0.0944496989f},
-std::array<float,2>{0.33774963f, 0.185836494f},
-std::array<float,2>{0.602451086f, 0.818897724f},
-std::array<float,2>{0.0717796162f, 0.592987418f},
-std::array<float,2>{0.86800456f, 0.433896661f},
-std::array<float,2>{0.411530644f, 0.454321921f},
-std::array<float,2>{0.739461899f, 0.516336083f},
-std::array<float,2>{0.17887713f, 0.794925928f},
-std::array<float,2>{0.935491323f, 0.226041049f},
-std::array<float,2>{0.0390237868f, 0.0537090413f},
-std::array<float,2>{0.755051255f, 0.980170548f},
-std::array<float,2>{0.302967876f, 0.71569109f},
-std::array<float,2>{0.517272651f, 0.352170795f},
-std::array<float,2>{0.116412863f, 0.382926017f},
-std::array<float,2>{0.828367889f, 0.612962127f},
-std::array<float,2>{0.372591406f, 0.870252967f},
-std::array<float,2>{0.573275208f, 0.141901016f},
-std::array<float,2>{0.469007969f, 0.0750455037f},
-std::array<float,2>{0.683495402f, 0.91138041f},
-std::array<float,2>{0.223895833f, 0.6428442f},
-std::array<float,2>{0.944255054f, 0.293137789f},
-std::array<float,2>{0.274984479f, 0.317870259f},
-std::array<float,2>{0.5555287f, 0.742712557f},
-std::array<float,2>{0.0290966127f, 0.957809806f},
-std::array<float,2>{0.809803426f, 0.0116444016f},
-std::array<float,2>{0.142681658f, 0.189325482f},
-std::array<float,2>{0.891188562f, 0.756034791f},
-std::array<float,2>{0.393464327f, 0.551117241f},
-std::array<float,2>{0.708724201f, 0.486625999f},
-std::array<float,2>{0.156429291f, 0.476215571f},
-std::array<float,2>{0.909666121f, 0.542026699f},
-std::array<float,2>{0.431508601f, 0.772602201f},
-std::array<float,2>{0.719651043f, 0.20969516f},
-std::array<float,2>{0.292065829f, 0.0161075871f},
-std::array<float,2>{0.509866655f, 0.946832001f},
-std::array<float,2>{0.0568380915f, 0.73183161f},
-std::array<float,2>{0.779735982f, 0.33653754f},
-std::array<float,2>{0.43898654f, 0.304759175f},
-std::array<float,2>{0.633847892f, 0.634459436f},
-std::array<float,2>{0.212215066f, 0.930478036f},
-std::array<float,2>{0.973008752f, 0.0876932815f},
-std::array<float,2>{0.0821502879f, 0.136964932f},
-std::array<float,2>{0.854439616f, 0.851620913f},
-std::array<float,2>{0.317088783f, 0.6061517f},
-std::array<float,2>{0.611745f, 0.40373075f},
-std::array<float,2>{0.0044187787f, 0.360204965f},
-std::array<float,2>{0.784942091f, 0.699274361f},
-std::array<float,2>{0.253881752f, 0.986000478f},
-std::array<float,2>{0.538916349f, 0.03813795f},
-std::array<float,2>{0.381993055f, 0.239625558f},
-std::array<float,2>{0.688504517f, 0.802364469f},
-std::array<float,2>{0.126221925f, 0.509717584f},
-std::array<float,2>{0.884070098f, 0.447707802f},
-std::array<float,2>{0.34891659f, 0.409755677f},
-std::array<float,2>{0.583472848f, 0.565824866f},
-std::array<float,2>{0.10475184f, 0.833468318f},
-std::array<float,2>{0.812629819f, 0.165636614f},
-std::array<float,2>{0.244537085f, 0.110685013f},
-std::array<float,2>{0.96576345f, 0.89388907f},
-std::array<float,2>{0.498846591f, 0.674283981f},
-std::array<float,2>{0.659832299f, 0.272403032f},
-std::array<float,2>{0.146501899f, 0.280360192f},
-std::array<float,2>{0.894769609f, 0.681078196f},
-std::array<float,2>{0.397867501f, 0.905955136f},
-std::array<float,2>{0.705728769f, 0.117949501f},
-std::array<float,2>{0.277694434f, 0.157305568f},
-std::array<float,2>{0.558982432f, 0.839699328f},
-std::array<float,2>{0.0257464703f, 0.575295866f},
-std::array<float,2>{0.806386173f, 0.419559181f},
-std::array<float,2>{0.473831654f, 0.443230689f},
-std::array<float,2>{0.686492562f, 0.505689025f},
-std::array<float,2>{0.22135298f, 0.81025207f},
-std::array<float,2>{0.941399932f, 0.247541904f},
-std::array<float,2>{0.110167257f, 0.0428090654f},
-std::array<float,2>{0.835389197f, 0.997292042f},
-std::array<float,2>{0.370364875f, 0.694249809f},
-std::array<float,2>{0.576043487f, 0.372107714f},
-std::array<float,2>{0.0321574993f, 0.397769809f},
-std::array<float,2>{0.751960814f, 0.599517345f},
-std::array<float,2>{0.29896459f, 0.85026902f},
-std::array<float,2>{0.521920264f, 0.130837128f},
-std::array<float,2>{0.408519804f, 0.0806002393f},
-std::array<float,2>{0.735972345f, 0.924970269f},
-std::array<float,2>{0.172860876f, 0.627439499f},
-std::array<float,2>{0.93150878f, 0.302234709f},
-std::array<float,2>{0.342938066f, 0.332637787f},
-std::array<float,2>{0.606329203f, 0.720552802f},
-std::array<float,2>{0.0760300979f, 0.938859046f},
-std::array<float,2>{0.872017801f, 0.0302144382f},
-std::array<float,2>{0.197350904f, 0.213626325f},
-std::array<float,2>{0.994333029f, 0.77461499f},
-std::array<float,2>{0.454514235f, 0.532219827f},
-std::array<float,2>{0.64614594f, 0.477263868f},
-std::array<float,2>{0.249872297f, 0.494190931f},
-std::array<float,2>{0.962225914f, 0.559879959f},
-std::array<float,2>{0.495094478f, 0.759645939f},
-std::array<float,2>{0.661503375f, 0.198901176f},
-std::array<float,2>{0.347206265f, 0.00142737117f},
-std::array<float,2>{0.580521107f, 0.962584972f},
-std::array<float,2>{0.108930424f, 0.739419699f},
-std::array<float,2>{0.817929864f, 0.328076333f},
-std::array<float,2>{0.375567615f, 0.284887671f},
-std::array<float,2>{0.693622828f, 0.651376605f},
-std::array<float,2>{0.129612103f, 0.921229422f},
-std::array<float,2>{0.886931241f, 0.0664691627f},
-std::array<float,2>{0.00344069279f, 0.149568483f},
-std::array<float,2>{0.787463129f, 0.862109303f},
-std::array<float,2>{0.255216986f, 0.622962475f},
-std::array<float,2>{0.531463206f, 0.376375079f},
-std::array<float,2>{0.0793978423f, 0.351068556f},
-std::array<float,2>{0.857448876f, 0.709048927f},
-std::array<float,2>{0.312886894f, 0.974837005f},
-std::array<float,2>{0.613705397f, 0.0547821f},
-std::array<float,2>{0.442399204f, 0.232647493f},
-std::array<float,2>{0.63991189f, 0.785121679f},
-std::array<float,2>{0.216012388f, 0.526716828f},
-std::array<float,2>{0.97050041f, 0.464908808f},
-std::array<float,2>{0.293817401f, 0.427577734f},
-std::array<float,2>{0.514637351f, 0.581300795f},
-std::array<float,2>{0.0597871393f, 0.825291872f},
-std::array<float,2>{0.774417818f, 0.1793212f},
-std::array<float,2>{0.163048118f, 0.106472351f},
-std::array<float,2>{0.912120283f, 0.886923611f},
-std::array<float,2>{0.434861511f, 0.661561608f},
-std::array<float,2>{0.725738108f, 0.263291717f},
-std::array<float,2>{0.207063004f, 0.31398803f},
-std::array<float,2>{0.982869625f, 0.749594092f},
-std::array<float,2>{0.450954109f, 0.956643522f},
-std::array<float,2>{0.631450474f, 0.0130629372f},
-std::array<float,2>{0.325039506f, 0.195154354f},
-std::array<float,2>{0.61941874f, 0.752620339f},
-std::array<float,2>{0.0918931961f, 0.548582673f},
-std::array<float,2>{0.846310079f, 0.489416659f},
-std::array<float,2>{0.426062256f, 0.387127519f},
-std::array<float,2>{0.73375684f, 0.616083324f},
-std::array<float,2>{0.168909729f, 0.873762846f},
-std::array<float,2>{0.91892463f, 0.147560403f},
-std::array<float,2>{0.0490230136f, 0.0733718872f},
-std::array<float,2>{0.765772462f, 0.90799576f},
-std::array<float,2>{0.288485855f, 0.647244096f},
-std::array<float,2>{0.501891732f, 0.290209621f},
-std::array<float,2>{0.0983044356f, 0.459662706f},
-std::array<float,2>{0.825711668f, 0.522165418f},
-std::array<float,2>{0.353232443f, 0.790642142f},
-std::array<float,2>{0.593566954f, 0.219817474f},
-std::array<float,2>{0.487926662f, 0.0493470579f},
-std::array<float,2>{0.664955258f, 0.982136548f},
-std::array<float,2>{0.241332173f, 0.714121282f},
-std::array<float,2>{0.957703829f, 0.357804149f},
-std::array<float,2>{0.260327369f, 0.250176996f},
-std::array<float,2>{0.539627194f, 0.670971334f},
-std::array<float,2>{0.0116383005f, 0.876414895f},
-std::array<float,2>{0.790285707f, 0.100915782f},
-std::array<float,2>{0.136597723f, 0.180218533f},
-std::array<float,2>{0.882483065f, 0.815185964f},
-std::array<float,2>{0.387680888f, 0.58908546f},
-std::array<float,2>{0.696886361f, 0.432078302f},
-std::array<float,2>{0.186678678f, 0.412604481f},
-std::array<float,2>{0.926516771f, 0.568814516f},
-std::array<float,2>{0.417860627f, 0.831876755f},
-std::array<float,2>{0.746892989f, 0.171743527f},
-std::array<float,2>{0.310857475f, 0.114039965f},
-std::array<float,2>{0.523798406f, 0.895468235f},
-std::array<float,2>{0.046655599f, 0.677245557f},
-std::array<float,2>{0.760244966f, 0.266307473f},
-std::array<float,2>{0.467368305f, 0.363649637f},
-std::array<float,2>{0.648497641f, 0.697454512f},
-std::array<float,2>{0.190000966f, 0.989732683f},
-std::array<float,2>{0.985587537f, 0.0316789187f},
-std::array<float,2>{0.0700659528f, 0.235800147f},
-std::array<float,2>{0.866170943f, 0.798074961f},
-std::array<float,2>{0.333965063f, 0.512788773f},
-std::array<float,2>{0.598800778f, 0.452493578f},
-std::array<float,2>{0.0228039082f, 0.30932802f},
-std::array<float,2>{0.797644079f, 0.637627125f},
-std::array<float,2>{0.270314634f, 0.936461806f},
-std::array<float,2>{0.553053498f, 0.0910319462f},
-std::array<float,2>{0.405566752f, 0.133822083f},
-std::array<float,2>{0.717217088f, 0.858397305f},
-std::array<float,2>{0.149618283f, 0.604234099f},
-std::array<float,2>{0.898450136f, 0.398535937f},
-std::array<float,2>{0.365589976f, 0.470365882f},
-std::array<float,2>{0.563191533f, 0.543260574f},
-std::array<float,2>{0.120602593f, 0.768979013f},
-std::array<float,2>{0.840039909f, 0.205203399f},
-std::array<float,2>{0.227664858f, 0.0216753539f},
-std::array<float,2>{0.950635016f, 0.951570868f},
-std::array<float,2>{0.48431012f, 0.727075756f},
-std::array<float,2>{0.677440345f, 0.340725631f},
-std::array<float,2>{0.165841416f, 0.369458765f},
-std::array<float,2>{0.914178193f, 0.69034785f},
-std::array<float,2>{0.422173947f, 0.99253583f},
-std::array<float,2>{0.726623118f, 0.0455598347f},
-std::array<float,2>{0.281316608f, 0.243449405f},
-std::array<float,2>{0.506651998f, 0.80552876f},
-std::array<float,2>{0.0523852743f, 0.501804829f},
-std::array<float,2>{0.771053433f, 0.440338314f},
-std::array<float,2>{0.448852837f, 0.415746421f},
-std::array<float,2>{0.626729667f, 0.5713588f},
-std::array<float,2>{0.205170766f, 0.841082811f},
-std::array<float,2>{0.978768826f, 0.162903145f},
-std::array<float,2>{0.0869997516f, 0.122337237f},
-std::array<float,2>{0.850382626f, 0.900992692f},
-std::array<float,2>{0.323585004f, 0.68605423f},
-std::array<float,2>{0.623887181f, 0.275882542f},
-std::array<float,2>{0.0142068863f, 0.483643234f},
-std::array<float,2>{0.795278311f, 0.537485242f},
-std::array<float,2>{0.262560606f, 0.77747798f},
-std::array<float,2>{0.546676099f, 0.218010694f},
-std::array<float,2>{0.382853389f, 0.0247245617f},
-std::array<float,2>{0.702187955f, 0.942395151f},
-std::array<float,2>{0.139283061f, 0.724588573f},
-std::array<float,2>{0.876335025f, 0.328393489f},
-std::array<float,2>{0.355790019f, 0.29801476f},
-std::array<float,2>{0.586170733f, 0.630518138f},
-std::array<float,2>{0.0968346968f, 0.92804116f},
-std::array<float,2>{0.821646273f, 0.0852614641f},
-std::array<float,2>{0.235964149f, 0.126670823f},
-std::array<float,2>{0.955662847f, 0.844616771f},
-std::array<float,2>{0.488455832f, 0.597497284f},
-std::array<float,2>{0.671204805f, 0.391575217f},
-std::array<float,2>{0.195299104f, 0.381136507f},
-std::array<float,2>{0.988962591f, 0.620740235f},
-std::array<float,2>{0.463110536f, 0.865379274f},
-std::array<float,2>{0.656167269f, 0.152443796f},
-std::array<float,2>{0.329075307f, 0.0652989075f},
-std::array<float,2>{0.596857369f, 0.915557742f},
-std::array<float,2>{0.0642355829f, 0.653540373f},
-std::array<float,2>{0.861793697f, 0.286230415f},
-std::array<float,2>{0.418103725f, 0.322864115f},
-std::array<float,2>{0.744455397f, 0.738009512f},
-std::array<float,2>{0.181352839f, 0.967887104f},
-std::array<float,2>{0.922116697f, 0.00623113615f},
-std::array<float,2>{0.0408487692f, 0.201021567f},
-std::array<float,2>{0.764217496f, 0.76263082f},
-std::array<float,2>{0.307920396f, 0.555586636f},
-std::array<float,2>{0.53076607f, 0.497919023f},
-std::array<float,2>{0.123543039f, 0.259609014f},
-std::array<float,2>{0.838189304f, 0.659628093f},
-std::array<float,2>{0.362174898f, 0.882945836f},
-std::array<float,2>{0.567453206f, 0.104840823f},
-std::array<float,2>{0.479642957f, 0.172229886f},
-std::array<float,2>{0.674063861f, 0.823390484f},
-std::array<float,2>{0.233790442f, 0.58567363f},
-std::array<float,2>{0.945714235f, 0.42238754f},
-std::array<float,2>{0.267491966f, 0.464097261f},
-std::array<float,2>{0.548612893f, 0.52823776f},
-std::array<float,2>{0.0186638441f, 0.786567926f},
-std::array<float,2>{0.801939428f, 0.228394896f},
-std::array<float,2>{0.155271634f, 0.0587032586f},
-std::array<float,2>{0.903163254f, 0.9696365f},
-std::array<float,2>{0.398469597f, 0.703700721f},
-std::array<float,2>{0.712370634f, 0.346779406f},
-std::array<float,2>{0.2249953f, 0.295731604f},
-std::array<float,2>{0.942711473f, 0.641064107f},
-std::array<float,2>{0.471967638f, 0.913546026f},
-std::array<float,2>{0.681149483f, 0.0768485591f},
-std::array<float,2>{0.374975264f, 0.144307733f},
-std::array<float,2>{0.57205689f, 0.867781639f},
-std::array<float,2>{0.11380323f, 0.610144138f},
-std::array<float,2>{0.831300735f, 0.385124654f},
-std::array<float,2>{0.391952008f, 0.48555848f},
-std::array<float,2>{0.709843993f, 0.553642809f},
-std::array<float,2>{0.141044334f, 0.755726695f},
-std::array<float,2>{0.893131971f, 0.190800831f},
-std::array<float,2>{0.0296825971f, 0.0085668657f},
-std::array<float,2>{0.811850071f, 0.960930288f},
-std::array<float,2>{0.276373297f, 0.744614065f},
-std::array<float,2>{0.558315814f, 0.319026291f},
-std::array<float,2>{0.0727910548f, 0.435593814f},
-std::array<float,2>{0.86969167f, 0.59007746f},
-std::array<float,2>{0.33945176f, 0.816989601f},
-std::array<float,2>{0.604400158f, 0.18526198f},
-std::array<float,2>{0.458303303f, 0.0957606584f},
-std::array<float,2>{0.643795729f, 0.882736266f},
-std::array<float,2>{0.199520499f, 0.664978266f},
-std::array<float,2>{0.998513699f, 0.255312085f},
-std::array<float,2>{0.301977605f, 0.353779882f},
-std::array<float,2>{0.518760562f, 0.718592167f},
-std::array<float,2>{0.0353016518f, 0.976754963f},
-std::array<float,2>{0.757095635f, 0.0512321219f},
-std::array<float,2>{0.175908461f, 0.223934472f},
-std::array<float,2>{0.937490106f, 0.793381453f},
-std::array<float,2>{0.412549168f, 0.519143581f},
-std::array<float,2>{0.740583003f, 0.455419183f},
-std::array<float,2>{0.127449915f, 0.447236717f},
-std::array<float,2>{0.8863976f, 0.510642171f},
-std::array<float,2>{0.380203456f, 0.80460465f},
-std::array<float,2>{0.69008249f, 0.241955355f},
-std::array<float,2>{0.251508772f, 0.0359616838f},
-std::array<float,2>{0.536924422f, 0.987297237f},
-std::array<float,2>{0.00678825285f, 0.702807605f},
-std::array<float,2>{0.781739831f, 0.362155646f},
-std::array<float,2>{0.496881813f, 0.270284146f},
-std::array<float,2>{0.656832516f, 0.673357487f},
-std::array<float,2>{0.243570089f, 0.891879737f},
-std::array<float,2>{0.967961729f, 0.111767694f},
-std::array<float,2>{0.101687044f, 0.16677399f},
-std::array<float,2>{0.814721525f, 0.835084856f},
-std::array<float,2>{0.351111472f, 0.563376248f},
-std::array<float,2>{0.585190058f, 0.406797469f},
-std::array<float,2>{0.0560378842f, 0.338140875f},
-std::array<float,2>{0.777490616f, 0.73412776f},
-std::array<float,2>{0.290184826f, 0.948184609f},
-std::array<float,2>{0.508403301f, 0.0191970207f},
-std::array<float,2>{0.432045192f, 0.208455086f},
-std::array<float,2>{0.722094893f, 0.770688891f},
-std::array<float,2>{0.15969795f, 0.540326893f},
-std::array<float,2>{0.907772064f, 0.474400967f},
-std::array<float,2>{0.320239872f, 0.405317724f},
-std::array<float,2>{0.610752046f, 0.607825458f},
-std::array<float,2>{0.0849302858f, 0.853703737f},
-std::array<float,2>{0.852765918f, 0.138722196f},
-std::array<float,2>{0.214257196f, 0.0890428796f},
-std::array<float,2>{0.975080609f, 0.931731522f},
-std::array<float,2>{0.441089541f, 0.634942651f},
-std::array<float,2>{0.636016667f, 0.306976199f},
-std::array<float,2>{0.184762433f, 0.265877187f},
-std::array<float,2>{0.929059148f, 0.677607775f},
-std::array<float,2>{0.415696084f, 0.894751132f},
-std::array<float,2>{0.748793185f, 0.113729432f},
-std::array<float,2>{0.308805346f, 0.170981005f},
-std::array<float,2>{0.525672913f, 0.831472158f},
-std::array<float,2>{0.0447088331f, 0.568975866f},
-std::array<float,2>{0.758101642f, 0.412368357f},
-std::array<float,2>{0.465407401f, 0.453036726f},
-std::array<float,2>{0.651980162f, 0.513257444f},
-std::array<float,2>{0.188032657f, 0.798563361f},
-std::array<float,2>{0.988141179f, 0.235986486f},
-std::array<float,2>{0.0667843223f, 0.0321600623f},
-std::array<float,2>{0.864225447f, 0.990030587f},
-std::array<float,2>{0.335329145f, 0.69817245f},
-std::array<float,2>{0.601377308f, 0.363849908f},
-std::array<float,2>{0.0207298119f, 0.39913407f},
-std::array<float,2>{0.800383866f, 0.603562832f},
-std::array<float,2>{0.271671623f, 0.857675552f},
-std::array<float,2>{0.550845683f, 0.134587452f},
-std::array<float,2>{0.402622133f, 0.0914675444f},
-std::array<float,2>{0.715556383f, 0.93595165f},
-std::array<float,2>{0.151645273f, 0.63707608f},
-std::array<float,2>{0.900592804f, 0.30882588f},
-std::array<float,2>{0.364122927f, 0.339890897f},
-std::array<float,2>{0.565879107f, 0.726743221f},
-std::array<float,2>{0.118531577f, 0.951874495f},
-std::array<float,2>{0.842920005f, 0.0223538168f},
-std::array<float,2>{0.229588509f, 0.205685869f},
-std::array<float,2>{0.952611983f, 0.769217849f},
-std::array<float,2>{0.481848776f, 0.543735027f},
-std::array<float,2>{0.679359734f, 0.469742596f},
-std::array<float,2>{0.210827574f, 0.489811003f},
-std::array<float,2>{0.981126308f, 0.547966897f},
-std::array<float,2>{0.452273637f, 0.752424002f},
-std::array<float,2>{0.630309463f, 0.194395766f},
-std::array<float,2>{0.327595174f, 0.0136524457f},
-std::array<float,2>{0.618250668f, 0.956496119f},
-std::array<float,2>{0.0901458412f, 0.749252677f},
-std::array<float,2>{0.844800591f, 0.313801259f},
-std::array<float,2>{0.428596973f, 0.29092294f},
-std::array<float,2>{0.73133117f, 0.646683633f},
-std::array<float,2>{0.170241103f, 0.907331586f},
-std::array<float,2>{0.921712577f, 0.0739468113f},
-std::array<float,2>{0.0482569672f, 0.148179188f},
-std::array<float,2>{0.769063473f, 0.873459935f},
-std::array<float,2>{0.285916477f, 0.615719855f},
-std::array<float,2>{0.502614498f, 0.387619853f},
-std::array<float,2>{0.101379685f, 0.35806492f},
-std::array<float,2>{0.827361345f, 0.714564979f},
-std::array<float,2>{0.35524416f, 0.981589139f},
-std::array<float,2>{0.590798497f, 0.0492031015f},
-std::array<float,2>{0.484786808f, 0.220325842f},
-std::array<float,2>{0.666042447f, 0.790226817f},
-std::array<float,2>{0.238684043f, 0.521661758f},
-std::array<float,2>{0.960702777f, 0.459344953f},
-std::array<float,2>{0.25867036f, 0.432407141f},
-std::array<float,2>{0.541544795f, 0.589805424f},
-std::array<float,2>{0.00819431804f, 0.814879596f},
-std::array<float,2>{0.792482018f, 0.179699928f},
-std::array<float,2>{0.13407062f, 0.101241611f},
-std::array<float,2>{0.880471528f, 0.876788139f},
-std::array<float,2>{0.389863342f, 0.671744585f},
-std::array<float,2>{0.697549403f, 0.250748426f},
-std::array<float,2>{0.247249857f, 0.327322006f},
-std::array<float,2>{0.962906361f, 0.739854872f},
-std::array<float,2>{0.493308753f, 0.961916566f},
-std::array<float,2>{0.663143516f, 0.00191724126f},
-std::array<float,2>{0.344046623f, 0.19872126f},
-std::array<float,2>{0.579417229f, 0.759074867f},
-std::array<float,2>{0.106545612f, 0.560397446f},
-std::array<float,2>{0.819297314f, 0.495068818f},
-std::array<float,2>{0.378477514f, 0.376864403f},
-std::array<float,2>{0.692622125f, 0.622167766f},
-std::array<float,2>{0.131035849f, 0.861374021f},
-std::array<float,2>{0.888824105f, 0.15023379f},
-std::array<float,2>{0.00101159781f, 0.0669865981f},
-std::array<float,2>{0.786552429f, 0.921604037f},
-std::array<float,2>{0.257681429f, 0.651990354f},
-std::array<float,2>{0.534327745f, 0.284594685f},
-std::array<float,2>{0.0816438347f, 0.465648443f},
-std::array<float,2>{0.85576576f, 0.527298868f},
-std::array<float,2>{0.316053808f, 0.784278631f},
-std::array<float,2>{0.615338683f, 0.233029708f},
-std::array<float,2>{0.444360435f, 0.0555255786f},
-std::array<float,2>{0.638270617f, 0.97533828f},
-std::array<float,2>{0.218569517f, 0.709821582f},
-std::array<float,2>{0.970727205f, 0.351177931f},
-std::array<float,2>{0.29560551f, 0.262927473f},
-std::array<float,2>{0.513206601f, 0.66183722f},
-std::array<float,2>{0.0608730093f, 0.887299597f},
-std::array<float,2>{0.776541352f, 0.107125692f},
-std::array<float,2>{0.162091285f, 0.17884697f},
-std::array<float,2>{0.910420537f, 0.825801134f},
-std::array<float,2>{0.437185109f, 0.581848562f},
-std::array<float,2>{0.723110318f, 0.42682755f},
-std::array<float,2>{0.146261796f, 0.419339299f},
-std::array<float,2>{0.897440732f, 0.575965464f},
-std::array<float,2>{0.39549014f, 0.839267492f},
-std::array<float,2>{0.704427719f, 0.158181727f},
-std::array<float,2>{0.279558152f, 0.117377557f},
-std::array<float,2>{0.560563624f, 0.905536294f},
-std::array<float,2>{0.0234707799f, 0.681398213f},
-std::array<float,2>{0.807174265f, 0.280895054f},
-std::array<float,2>{0.475901067f, 0.372829348f},
-std::array<float,2>{0.685473621f, 0.693580866f},
-std::array<float,2>{0.219559595f, 0.997751355f},
-std::array<float,2>{0.937763393f, 0.0424318835f},
-std::array<float,2>{0.112961791f, 0.248025462f},
-std::array<float,2>{0.833774686f, 0.809999168f},
-std::array<float,2>{0.367576182f, 0.505102277f},
-std::array<float,2>{0.57796669f, 0.442768455f},
-std::array<float,2>{0.0350105837f, 0.302257985f},
-std::array<float,2>{0.750714183f, 0.627597749f},
-std::array<float,2>{0.297107428f, 0.925447047f},
-std::array<float,2>{0.520369172f, 0.0803937837f},
-std::array<float,2>{0.406799555f, 0.129970282f},
-std::array<float,2>{0.737506211f, 0.849678099f},
-std::array<float,2>{0.175513089f, 0.598974705f},
-std::array<float,2>{0.93271035f, 0.398183554f},
-std::array<float,2>{0.341712475f, 0.476607233f},
-std::array<float,2>{0.608607709f, 0.531603336f},
-std::array<float,2>{0.0764043853f, 0.775250256f},
-std::array<float,2>{0.874643207f, 0.213199601f},
-std::array<float,2>{0.197217494f, 0.02963873f},
-std::array<float,2>{0.993564129f, 0.939026594f},
-std::array<float,2>{0.455183089f, 0.719784141f},
-std::array<float,2>{0.646912813f, 0.332256973f},
-std::array<float,2>{0.126681462f, 0.361752391f},
-std::array<float,2>{0.884566128f, 0.702564657f},
-std::array<float,2>{0.382799208f, 0.986342847f},
-std::array<float,2>{0.689105034f, 0.035453096f},
-std::array<float,2>{0.253018379f, 0.241603702f},
-std::array<float,2>{0.538256645f, 0.803711057f},
-std::array<float,2>{0.00419415161f, 0.510012627f},
-std::array<float,2>{0.784649968f, 0.44676429f},
-std::array<float,2>{0.4981879f, 0.406284004f},
-std::array<float,2>{0.659526706f, 0.562897921f},
-std::array<float,2>{0.244915724f, 0.835829198f},
-std::array<float,2>{0.964952111f, 0.166418105f},
-std::array<float,2>{0.10532143f, 0.111931466f},
-std::array<float,2>{0.813437939f, 0.892354667f},
-std::array<float,2>{0.349578291f, 0.6731264f},
-std::array<float,2>{0.583782852f, 0.269803971f},
-std::array<float,2>{0.0572709218f, 0.473904878f},
-std::array<float,2>{0.780066669f, 0.54061991f},
-std::array<float,2>{0.292679012f, 0.771329224f},
-std::array<float,2>{0.510740817f, 0.208779141f},
-std::array<float,2>{0.430851489f, 0.0186989903f},
-std::array<float,2>{0.718939722f, 0.947568953f},
-std::array<float,2>{0.157031819f, 0.73380363f},
-std::array<float,2>{0.91003871f, 0.338450521f},
-std::array<float,2>{0.316762209f, 0.307588786f},
-std::array<float,2>{0.61211592f, 0.63551569f},
-std::array<float,2>{0.0829659477f, 0.932563245f},
-std::array<float,2>{0.853954911f, 0.0893898681f},
-std::array<float,2>{0.212654263f, 0.139548317f},
-std::array<float,2>{0.973579705f, 0.85432446f},
-std::array<float,2>{0.438698709f, 0.608335078f},
-std::array<float,2>{0.634569108f, 0.405765027f},
-std::array<float,2>{0.224311605f, 0.385650367f},
-std::array<float,2>{0.943481624f, 0.609458864f},
-std::array<float,2>{0.469709903f, 0.867631495f},
-std::array<float,2>{0.682874262f, 0.143668219f},
-std::array<float,2>{0.372494608f, 0.0764492974f},
-std::array<float,2>{0.573781252f, 0.91362834f},
-std::array<float,2>{0.117096566f, 0.641401231f},
-std::array<float,2>{0.828921258f, 0.295085907f},
-std::array<float,2>{0.392636091f, 0.318690419f},
-std::array<float,2>{0.708417237f, 0.74466306f},
-std::array<float,2>{0.143491983f, 0.960160613f},
-std::array<float,2>{0.891080439f, 0.00795487221f},
-std::array<float,2>{0.0287927035f, 0.191373348f},
-std::array<float,2>{0.810063362f, 0.755154014f},
-std::array<float,2>{0.274454802f, 0.553128004f},
-std::array<float,2>{0.55503875f, 0.485974073f},
-std::array<float,2>{0.071325615f, 0.255631775f},
-std::array<float,2>{0.867597818f, 0.66436702f},
-std::array<float,2>{0.337265074f, 0.882203519f},
-std::array<float,2>{0.601692796f, 0.0963824689f},
-std::array<float,2>{0.459445685f, 0.184588581f},
-std::array<float,2>{0.641352415f, 0.816576958f},
-std::array<float,2>{0.201235563f, 0.590629697f},
-std::array<float,2>{0.99700886f, 0.436111569f},
-std::array<float,2>{0.303696871f, 0.45585677f},
-std::array<float,2>{0.516697288f, 0.518846452f},
-std::array<float,2>{0.0383182801f, 0.793603539f},
-std::array<float,2>{0.755452573f, 0.224224031f},
-std::array<float,2>{0.179466844f, 0.0515645817f},
-std::array<float,2>{0.935037792f, 0.97753793f},
-std::array<float,2>{0.412002832f, 0.718037367f},
-std::array<float,2>{0.739853024f, 0.35402739f},
-std::array<float,2>{0.192741707f, 0.286662459f},
-std::array<float,2>{0.991458476f, 0.654151797f},
-std::array<float,2>{0.461705983f, 0.915121853f},
-std::array<float,2>{0.653224707f, 0.0648887604f},
-std::array<float,2>{0.330727547f, 0.152981326f},
-std::array<float,2>{0.5949108f, 0.86609894f},
-std::array<float,2>{0.0648059547f, 0.620143354f},
-std::array<float,2>{0.85995841f, 0.381803304f},
-std::array<float,2>{0.421476513f, 0.497303039f},
-std::array<float,2>{0.742977977f, 0.55480206f},
-std::array<float,2>{0.183139443f, 0.761979103f},
-std::array<float,2>{0.924978375f, 0.200373337f},
-std::array<float,2>{0.0426381901f, 0.00638558948f},
-std::array<float,2>{0.763338923f, 0.968382895f},
-std::array<float,2>{0.305807501f, 0.737535119f},
-std::array<float,2>{0.528062999f, 0.322734296f},
-std::array<float,2>{0.122640863f, 0.421896428f},
-std::array<float,2>{0.836915612f, 0.585060298f},
-std::array<float,2>{0.359812349f, 0.824196458f},
-std::array<float,2>{0.569002211f, 0.172522232f},
-std::array<float,2>{0.476808935f, 0.105075054f},
-std::array<float,2>{0.672034144f, 0.883332551f},
-std::array<float,2>{0.232408434f, 0.660057843f},
-std::array<float,2>{0.94822669f, 0.259080917f},
-std::array<float,2>{0.268226385f, 0.347272128f},
-std::array<float,2>{0.549185455f, 0.703451157f},
-std::array<float,2>{0.0173277333f, 0.969125986f},
-std::array<float,2>{0.8043167f, 0.059392754f},
-std::array<float,2>{0.152560204f, 0.227789983f},
-std::array<float,2>{0.904893756f, 0.786670625f},
-std::array<float,2>{0.402261019f, 0.527421713f},
-std::array<float,2>{0.713799119f, 0.464461476f},
-std::array<float,2>{0.167433396f, 0.439899623f},
-std::array<float,2>{0.917047083f, 0.50138694f},
-std::array<float,2>{0.424916029f, 0.804957271f},
-std::array<float,2>{0.72927916f, 0.243754819f},
-std::array<float,2>{0.283389688f, 0.0450340286f},
-std::array<float,2>{0.505066454f, 0.992684364f},
-std::array<float,2>{0.053924147f, 0.689499795f},
-std::array<float,2>{0.773396373f, 0.370065391f},
-std::array<float,2>{0.445815325f, 0.275634199f},
-std::array<float,2>{0.627431631f, 0.685940146f},
-std::array<float,2>{0.204174772f, 0.900603235f},
-std::array<float,2>{0.976821184f, 0.122574642f},
-std::array<float,2>{0.0882156119f, 0.162264496f},
-std::array<float,2>{0.848944366f, 0.841699243f},
-std::array<float,2>{0.320769459f, 0.572129011f},
-std::array<float,2>{0.622872651f, 0.415273607f},
-std::array<float,2>{0.013670804f, 0.329030186f},
-std::array<float,2>{0.793899477f, 0.723926961f},
-std::array<float,2>{0.264948308f, 0.943226755f},
-std::array<float,2>{0.543718755f, 0.0251523443f},
-std::array<float,2>{0.385631412f, 0.218706965f},
-std::array<float,2>{0.700488448f, 0.77815032f},
-std::array<float,2>{0.136969432f, 0.537971377f},
-std::array<float,2>{0.878532112f, 0.484281927f},
-std::array<float,2>{0.359270602f, 0.390856862f},
-std::array<float,2>{0.588061094f, 0.597098768f},
-std::array<float,2>{0.0939956605f, 0.844054878f},
-std::array<float,2>{0.8233459f, 0.126285002f},
-std::array<float,2>{0.237811431f, 0.0858298689f},
-std::array<float,2>{0.953592122f, 0.928435981f},
-std::array<float,2>{0.491526157f, 0.630121946f},
-std::array<float,2>{0.668825567f, 0.29863432f},
-std::array<float,2>{0.15034841f, 0.310822934f},
-std::array<float,2>{0.899111509f, 0.639729738f},
-std::array<float,2>{0.405770332f, 0.935287535f},
-std::array<float,2>{0.717498004f, 0.0931921974f},
-std::array<float,2>{0.269944668f, 0.13571088f},
-std::array<float,2>{0.553388655f, 0.856299877f},
-std::array<float,2>{0.0233051255f, 0.602683365f},
-std::array<float,2>{0.79698807f, 0.400940418f},
-std::array<float,2>{0.483741552f, 0.471480399f},
-std::array<float,2>{0.676792681f, 0.545083404f},
-std::array<float,2>{0.228451937f, 0.767513514f},
-std::array<float,2>{0.950953186f, 0.203693882f},
-std::array<float,2>{0.120969124f, 0.0202781074f},
-std::array<float,2>{0.840546668f, 0.949647665f},
-std::array<float,2>{0.366147757f, 0.730023205f},
-std::array<float,2>{0.562736988f, 0.343682051f},
-std::array<float,2>{0.046061039f, 0.411080658f},
-std::array<float,2>{0.760387719f, 0.56688273f},
-std::array<float,2>{0.311383188f, 0.829017043f},
-std::array<float,2>{0.523963332f, 0.168554455f},
-std::array<float,2>{0.417256117f, 0.116137154f},
-std::array<float,2>{0.746095002f, 0.897927403f},
-std::array<float,2>{0.187310725f, 0.678859949f},
-std::array<float,2>{0.925940156f, 0.269255966f},
-std::array<float,2>{0.333441585f, 0.365980446f},
-std::array<float,2>{0.599492073f, 0.695922077f},
-std::array<float,2>{0.069416739f, 0.990640283f},
-std::array<float,2>{0.865673244f, 0.0340690948f},
-std::array<float,2>{0.189736336f, 0.237636596f},
-std::array<float,2>{0.986225069f, 0.800221324f},
-std::array<float,2>{0.467079133f, 0.514284849f},
-std::array<float,2>{0.649282873f, 0.450904727f},
-std::array<float,2>{0.242073163f, 0.458031803f},
-std::array<float,2>{0.95745492f, 0.519574285f},
-std::array<float,2>{0.487360001f, 0.792897403f},
-std::array<float,2>{0.664499998f, 0.221386001f},
-std::array<float,2>{0.35286662f, 0.0482745953f},
-std::array<float,2>{0.593154609f, 0.984070361f},
-std::array<float,2>{0.0979960039f, 0.712609887f},
-std::array<float,2>{0.825268328f, 0.355919927f},
-std::array<float,2>{0.387100965f, 0.253441781f},
-std::array<float,2>{0.696663558f, 0.668974578f},
-std::array<float,2>{0.13586773f, 0.877219379f},
-std::array<float,2>{0.88225019f, 0.0984099656f},
-std::array<float,2>{0.010859089f, 0.183188662f},
-std::array<float,2>{0.790981472f, 0.813011885f},
-std::array<float,2>{0.260150611f, 0.587552607f},
-std::array<float,2>{0.539268792f, 0.431105465f},
-std::array<float,2>{0.092763871f, 0.315476209f},
-std::array<float,2>{0.845868945f, 0.747790456f},
-std::array<float,2>{0.324226767f, 0.954535127f},
-std::array<float,2>{0.619679272f, 0.0153473634f},
-std::array<float,2>{0.450421602f, 0.192979217f},
-std::array<float,2>{0.631156623f, 0.7508955f},
-std::array<float,2>{0.20752418f, 0.549789965f},
-std::array<float,2>{0.983067572f, 0.491525292f},
-std::array<float,2>{0.289002895f, 0.390327901f},
-std::array<float,2>{0.501274109f, 0.615088522f},
-std::array<float,2>{0.0494661331f, 0.871812701f},
-std::array<float,2>{0.766490698f, 0.145635784f},
-std::array<float,2>{0.16801165f, 0.0717906281f},
-std::array<float,2>{0.918048739f, 0.908548772f},
-std::array<float,2>{0.426301301f, 0.646383822f},
-std::array<float,2>{0.734147787f, 0.291383654f},
-std::array<float,2>{0.216411129f, 0.347813398f},
-std::array<float,2>{0.970068872f, 0.70893079f},
-std::array<float,2>{0.443272352f, 0.973922551f},
-std::array<float,2>{0.640369356f, 0.0579592884f},
-std::array<float,2>{0.313356727f, 0.231566444f},
-std::array<float,2>{0.614203334f, 0.781362772f},
-std::array<float,2>{0.0800469369f, 0.524134934f},
-std::array<float,2>{0.85828656f, 0.46792388f},
-std::array<float,2>{0.435373574f, 0.429234803f},
-std::array<float,2>{0.726210415f, 0.578299403f},
-std::array<float,2>{0.16255115f, 0.82647264f},
-std::array<float,2>{0.912836254f, 0.175944269f},
-std::array<float,2>{0.0601605363f, 0.108193465f},
-std::array<float,2>{0.775330603f, 0.890481174f},
-std::array<float,2>{0.293329418f, 0.66368854f},
-std::array<float,2>{0.514118671f, 0.264437526f},
-std::array<float,2>{0.108836375f, 0.493145943f},
-std::array<float,2>{0.817763329f, 0.561640918f},
-std::array<float,2>{0.346683651f, 0.760868967f},
-std::array<float,2>{0.580829322f, 0.196925715f},
-std::array<float,2>{0.494208455f, 0.00384842907f},
-std::array<float,2>{0.66182524f, 0.963249922f},
-std::array<float,2>{0.249134034f, 0.741208255f},
-std::array<float,2>{0.962559581f, 0.324969471f},
-std::array<float,2>{0.255811006f, 0.281968176f},
-std::array<float,2>{0.531815469f, 0.649421394f},
-std::array<float,2>{0.00306807831f, 0.918849289f},
-std::array<float,2>{0.787843883f, 0.0685656294f},
-std::array<float,2>{0.129027754f, 0.151871517f},
-std::array<float,2>{0.887537301f, 0.861125767f},
-std::array<float,2>{0.375051409f, 0.624381065f},
-std::array<float,2>{0.694170356f, 0.376963735f},
-std::array<float,2>{0.173633412f, 0.394765228f},
-std::array<float,2>{0.931114793f, 0.601505041f},
-std::array<float,2>{0.408693135f, 0.848815084f},
-std::array<float,2>{0.735382795f, 0.132353574f},
-std::array<float,2>{0.299470514f, 0.0788018256f},
-std::array<float,2>{0.522284746f, 0.922430456f},
-std::array<float,2>{0.0313850306f, 0.625420153f},
-std::array<float,2>{0.752824545f, 0.304108053f},
-std::array<float,2>{0.4550336f, 0.334362924f},
-std::array<float,2>{0.645672143f, 0.721684515f},
-std::array<float,2>{0.198167697f, 0.940149248f},
-std::array<float,2>{0.994799674f, 0.0288825352f},
-std::array<float,2>{0.0753950998f, 0.212550715f},
-std::array<float,2>{0.871531069f, 0.77599436f},
-std::array<float,2>{0.343428135f, 0.533321381f},
-std::array<float,2>{0.605496705f, 0.479295284f},
-std::array<float,2>{0.02603071f, 0.279047579f},
-std::array<float,2>{0.805695415f, 0.683551133f},
-std::array<float,2>{0.27790615f, 0.902351141f},
-std::array<float,2>{0.559284091f, 0.119498923f},
-std::array<float,2>{0.398374647f, 0.160089076f},
-std::array<float,2>{0.705369353f, 0.836942554f},
-std::array<float,2>{0.147216827f, 0.576732635f},
-std::array<float,2>{0.89523685f, 0.421210229f},
-std::array<float,2>{0.371007711f, 0.444832563f},
-std::array<float,2>{0.57532686f, 0.506941199f},
-std::array<float,2>{0.109458521f, 0.811732411f},
-std::array<float,2>{0.83560729f, 0.24984315f},
-std::array<float,2>{0.221171603f, 0.0401450135f},
-std::array<float,2>{0.940831482f, 0.999484718f},
-std::array<float,2>{0.474526942f, 0.692022264f},
-std::array<float,2>{0.68599534f, 0.373770803f},
-std::array<float,2>{0.159341723f, 0.336379647f},
-std::array<float,2>{0.907642961f, 0.732109547f},
-std::array<float,2>{0.432153761f, 0.946295083f},
-std::array<float,2>{0.722266197f, 0.0164610296f},
-std::array<float,2>{0.290647209f, 0.209105462f},
-std::array<float,2>{0.508243203f, 0.773331583f},
-std::array<float,2>{0.056494724f, 0.542766571f},
-std::array<float,2>{0.778295398f, 0.475901663f},
-std::array<float,2>{0.440842718f, 0.403990358f},
-std::array<float,2>{0.636563301f, 0.605829477f},
-std::array<float,2>{0.214463085f, 0.852172554f},
-std::array<float,2>{0.975428581f, 0.137440398f},
-std::array<float,2>{0.0840270519f, 0.0872917026f},
-std::array<float,2>{0.853175938f, 0.92979461f},
-std::array<float,2>{0.31962505f, 0.633840621f},
-std::array<float,2>{0.611069858f, 0.3054609f},
-std::array<float,2>{0.00590697676f, 0.448023647f},
-std::array<float,2>{0.781633079f, 0.509071767f},
-std::array<float,2>{0.251304656f, 0.802035034f},
-std::array<float,2>{0.536546946f, 0.240012765f},
-std::array<float,2>{0.380776912f, 0.0388173237f},
-std::array<float,2>{0.689596057f, 0.985779941f},
-std::array<float,2>{0.126958981f, 0.699959457f},
-std::array<float,2>{0.885776222f, 0.359678507f},
-std::array<float,2>{0.350928843f, 0.271611452f},
-std::array<float,2>{0.585619748f, 0.674328268f},
-std::array<float,2>{0.102493122f, 0.894200444f},
-std::array<float,2>{0.815408409f, 0.111295827f},
-std::array<float,2>{0.243889928f, 0.165292621f},
-std::array<float,2>{0.968685269f, 0.83353585f},
-std::array<float,2>{0.496322662f, 0.566008627f},
-std::array<float,2>{0.6565516f, 0.409533769f},
-std::array<float,2>{0.199739382f, 0.434449255f},
-std::array<float,2>{0.998556793f, 0.593510449f},
-std::array<float,2>{0.45893091f, 0.81840694f},
-std::array<float,2>{0.644108832f, 0.186346516f},
-std::array<float,2>{0.339302719f, 0.0940609425f},
-std::array<float,2>{0.603933811f, 0.880458891f},
-std::array<float,2>{0.0725834221f, 0.666550636f},
-std::array<float,2>{0.869465828f, 0.257784903f},
-std::array<float,2>{0.412957579f, 0.35189113f},
-std::array<float,2>{0.740884662f, 0.714861274f},
-std::array<float,2>{0.176424623f, 0.979941547f},
-std::array<float,2>{0.936597228f, 0.0528134443f},
-std::array<float,2>{0.0360097662f, 0.226219952f},
-std::array<float,2>{0.757389605f, 0.795437276f},
-std::array<float,2>{0.302372783f, 0.515752077f},
-std::array<float,2>{0.519378185f, 0.454950601f},
-std::array<float,2>{0.113381684f, 0.293604285f},
-std::array<float,2>{0.831950486f, 0.643471599f},
-std::array<float,2>{0.37412256f, 0.911695182f},
-std::array<float,2>{0.571747839f, 0.0742410049f},
-std::array<float,2>{0.472175926f, 0.142519891f},
-std::array<float,2>{0.681404352f, 0.87061435f},
-std::array<float,2>{0.225395069f, 0.612657011f},
-std::array<float,2>{0.94287926f, 0.38356635f},
-std::array<float,2>{0.276988506f, 0.487262011f},
-std::array<float,2>{0.557835579f, 0.551505744f},
-std::array<float,2>{0.030070534f, 0.756786525f},
-std::array<float,2>{0.81202817f, 0.188657969f},
-std::array<float,2>{0.141394258f, 0.0110842353f},
-std::array<float,2>{0.892907321f, 0.957111359f},
-std::array<float,2>{0.392236501f, 0.742536902f},
-std::array<float,2>{0.709419191f, 0.317873985f},
-std::array<float,2>{0.234042779f, 0.260427237f},
-std::array<float,2>{0.946188211f, 0.657431006f},
-std::array<float,2>{0.48037827f, 0.885818303f},
-std::array<float,2>{0.674716711f, 0.102322489f},
-std::array<float,2>{0.361459374f, 0.174842045f},
-std::array<float,2>{0.568289638f, 0.821183741f},
-std::array<float,2>{0.123102419f, 0.583530247f},
-std::array<float,2>{0.838766754f, 0.425369918f},
-std::array<float,2>{0.398926497f, 0.461455464f},
-std::array<float,2>{0.712782681f, 0.529971242f},
-std::array<float,2>{0.154556856f, 0.787335634f},
-std::array<float,2>{0.902502f, 0.229982987f},
-std::array<float,2>{0.0191415325f, 0.0623560697f},
-std::array<float,2>{0.802299798f, 0.971157849f},
-std::array<float,2>{0.266742229f, 0.705951333f},
-std::array<float,2>{0.548297882f, 0.345286936f},
-std::array<float,2>{0.0638695583f, 0.379379898f},
-std::array<float,2>{0.862109125f, 0.618671536f},
-std::array<float,2>{0.32849291f, 0.865016639f},
-std::array<float,2>{0.597418666f, 0.154651061f},
-std::array<float,2>{0.463745654f, 0.0639211386f},
-std::array<float,2>{0.655529559f, 0.917494893f},
-std::array<float,2>{0.194509566f, 0.654385269f},
-std::array<float,2>{0.988487661f, 0.287170887f},
-std::array<float,2>{0.308538496f, 0.321198583f},
-std::array<float,2>{0.530527234f, 0.736116767f},
-std::array<float,2>{0.0404989645f, 0.965413928f},
-std::array<float,2>{0.764158249f, 0.00427846378f},
-std::array<float,2>{0.180796653f, 0.202686518f},
-std::array<float,2>{0.922467113f, 0.763975978f},
-std::array<float,2>{0.418676943f, 0.557460964f},
-std::array<float,2>{0.744677901f, 0.499629617f},
-std::array<float,2>{0.139012381f, 0.482392967f},
-std::array<float,2>{0.87650764f, 0.535843194f},
-std::array<float,2>{0.383723944f, 0.781149209f},
-std::array<float,2>{0.702717423f, 0.216424182f},
-std::array<float,2>{0.261933506f, 0.0257614236f},
-std::array<float,2>{0.546361148f, 0.944128394f},
-std::array<float,2>{0.0140665062f, 0.725169599f},
-std::array<float,2>{0.795866489f, 0.330606192f},
-std::array<float,2>{0.489115715f, 0.300549567f},
-std::array<float,2>{0.671642005f, 0.631742716f},
-std::array<float,2>{0.235733137f, 0.926348746f},
-std::array<float,2>{0.955205262f, 0.0825583488f},
-std::array<float,2>{0.0973519385f, 0.128703758f},
-std::array<float,2>{0.822040141f, 0.847313404f},
-std::array<float,2>{0.356151432f, 0.595225334f},
-std::array<float,2>{0.586476803f, 0.3935211f},
-std::array<float,2>{0.0518210903f, 0.367368519f},
-std::array<float,2>{0.770668149f, 0.687519014f},
-std::array<float,2>{0.281888306f, 0.995378077f},
-std::array<float,2>{0.506044328f, 0.0444857106f},
-std::array<float,2>{0.422832876f, 0.245528817f},
-std::array<float,2>{0.727501035f, 0.807590663f},
-std::array<float,2>{0.165384784f, 0.502133071f},
-std::array<float,2>{0.914794445f, 0.439331979f},
-std::array<float,2>{0.324029505f, 0.417539746f},
-std::array<float,2>{0.623226702f, 0.572824001f},
-std::array<float,2>{0.0874940753f, 0.843487144f},
-std::array<float,2>{0.850078702f, 0.161057428f},
-std::array<float,2>{0.205709338f, 0.123422258f},
-std::array<float,2>{0.979102433f, 0.899485171f},
-std::array<float,2>{0.448529482f, 0.685211062f},
-std::array<float,2>{0.62615937f, 0.273528457f},
-std::array<float,2>{0.171401888f, 0.292470157f},
-std::array<float,2>{0.920165777f, 0.645077407f},
-std::array<float,2>{0.428904116f, 0.909915328f},
-std::array<float,2>{0.731575251f, 0.0705072656f},
-std::array<float,2>{0.286355019f, 0.144583032f},
-std::array<float,2>{0.503769875f, 0.872233033f},
-std::array<float,2>{0.0471918359f, 0.614082992f},
-std::array<float,2>{0.767729282f, 0.38902092f},
-std::array<float,2>{0.451410741f, 0.490444541f},
-std::array<float,2>{0.629086196f, 0.550157905f},
-std::array<float,2>{0.209587634f, 0.751603544f},
-std::array<float,2>{0.981509268f, 0.191639468f},
-std::array<float,2>{0.0915364325f, 0.0141711989f},
-std::array<float,2>{0.844006181f, 0.95337373f},
-std::array<float,2>{0.326584756f, 0.746360064f},
-std::array<float,2>{0.617460966f, 0.315100729f},
-std::array<float,2>{0.00903207157f, 0.430614471f},
-std::array<float,2>{0.791808248f, 0.586371243f},
-std::array<float,2>{0.259634435f, 0.813938618f},
-std::array<float,2>{0.542782187f, 0.182119206f},
-std::array<float,2>{0.388758451f, 0.098713994f},
-std::array<float,2>{0.698813736f, 0.878694177f},
-std::array<float,2>{0.13361904f, 0.668922901f},
-std::array<float,2>{0.879042566f, 0.252098262f},
-std::array<float,2>{0.353547037f, 0.357118309f},
-std::array<float,2>{0.591094315f, 0.711252153f},
-std::array<float,2>{0.100119188f, 0.983366847f},
-std::array<float,2>{0.826232672f, 0.0471161827f},
-std::array<float,2>{0.239877522f, 0.221756935f},
-std::array<float,2>{0.959243059f, 0.791108847f},
-std::array<float,2>{0.485954255f, 0.520636559f},
-std::array<float,2>{0.667753041f, 0.457355827f},
-std::array<float,2>{0.188656837f, 0.449265957f},
-std::array<float,2>{0.986995876f, 0.515110135f},
-std::array<float,2>{0.466182947f, 0.799625337f},
-std::array<float,2>{0.65096426f, 0.23671405f},
-std::array<float,2>{0.334772289f, 0.0345000178f},
-std::array<float,2>{0.599954545f, 0.992077172f},
-std::array<float,2>{0.0677582845f, 0.697102487f},
-std::array<float,2>{0.86435765f, 0.36687097f},
-std::array<float,2>{0.414150834f, 0.268534958f},
-std::array<float,2>{0.749734521f, 0.678385019f},
-std::array<float,2>{0.183984444f, 0.897030771f},
-std::array<float,2>{0.928171277f, 0.116244711f},
-std::array<float,2>{0.043449048f, 0.169152975f},
-std::array<float,2>{0.759041369f, 0.829669535f},
-std::array<float,2>{0.309803694f, 0.567780375f},
-std::array<float,2>{0.526622951f, 0.411173224f},
-std::array<float,2>{0.117387645f, 0.34210667f},
-std::array<float,2>{0.842156649f, 0.728897691f},
-std::array<float,2>{0.364552945f, 0.950672925f},
-std::array<float,2>{0.565142751f, 0.0210553501f},
-std::array<float,2>{0.480589032f, 0.20445469f},
-std::array<float,2>{0.678515375f, 0.765678287f},
-std::array<float,2>{0.229486898f, 0.546104252f},
-std::array<float,2>{0.951358259f, 0.472601742f},
-std::array<float,2>{0.27337271f, 0.402056396f},
-std::array<float,2>{0.552288771f, 0.601910472f},
-std::array<float,2>{0.0198733415f, 0.857242346f},
-std::array<float,2>{0.799294412f, 0.136092067f},
-std::array<float,2>{0.151293531f, 0.0927116051f},
-std::array<float,2>{0.901554763f, 0.934428573f},
-std::array<float,2>{0.4040187f, 0.6389938f},
-std::array<float,2>{0.71593523f, 0.311594039f},
-std::array<float,2>{0.219833359f, 0.374214441f},
-std::array<float,2>{0.938999951f, 0.693253517f},
-std::array<float,2>{0.475007832f, 0.998120904f},
-std::array<float,2>{0.683735967f, 0.039515309f},
-std::array<float,2>{0.369035602f, 0.248246893f},
-std::array<float,2>{0.576963067f, 0.810714781f},
-std::array<float,2>{0.111445524f, 0.505954981f},
-std::array<float,2>{0.832809627f, 0.44388774f},
-std::array<float,2>{0.395746887f, 0.420449913f},
-std::array<float,2>{0.703609586f, 0.577490568f},
-std::array<float,2>{0.144861504f, 0.836232305f},
-std::array<float,2>{0.897563934f, 0.158887878f},
-std::array<float,2>{0.0247795638f, 0.12072666f},
-std::array<float,2>{0.808237553f, 0.903878808f},
-std::array<float,2>{0.28119114f, 0.682221889f},
-std::array<float,2>{0.562140703f, 0.278016567f},
-std::array<float,2>{0.077760987f, 0.479932427f},
-std::array<float,2>{0.873696387f, 0.534622014f},
-std::array<float,2>{0.340733767f, 0.777098358f},
-std::array<float,2>{0.607806504f, 0.21171917f},
-std::array<float,2>{0.456585795f, 0.0278826747f},
-std::array<float,2>{0.647901297f, 0.940547764f},
-std::array<float,2>{0.195890322f, 0.721292615f},
-std::array<float,2>{0.992260158f, 0.33513397f},
-std::array<float,2>{0.298146844f, 0.303578943f},
-std::array<float,2>{0.520905256f, 0.626592398f},
-std::array<float,2>{0.0335647129f, 0.923301995f},
-std::array<float,2>{0.751037478f, 0.0800192356f},
-std::array<float,2>{0.174774185f, 0.131568402f},
-std::array<float,2>{0.932407856f, 0.848276675f},
-std::array<float,2>{0.40763706f, 0.600361228f},
-std::array<float,2>{0.73685205f, 0.395665258f},
-std::array<float,2>{0.132106617f, 0.378158659f},
-std::array<float,2>{0.889692307f, 0.623216748f},
-std::array<float,2>{0.376987904f, 0.859727681f},
-std::array<float,2>{0.692053378f, 0.150636405f},
-std::array<float,2>{0.25647825f, 0.0698994473f},
-std::array<float,2>{0.533890724f, 0.918983817f},
-std::array<float,2>{0.000930627109f, 0.648694932f},
-std::array<float,2>{0.785306633f, 0.282297194f},
-std::array<float,2>{0.492458761f, 0.325345129f},
-std::array<float,2>{0.662819803f, 0.741392553f},
-std::array<float,2>{0.246456072f, 0.964628696f},
-std::array<float,2>{0.963938713f, 0.00236938545f},
-std::array<float,2>{0.105996184f, 0.195687369f},
-std::array<float,2>{0.820136607f, 0.760738552f},
-std::array<float,2>{0.345354974f, 0.560685754f},
-std::array<float,2>{0.579060197f, 0.493413895f},
-std::array<float,2>{0.0620341189f, 0.265483201f},
-std::array<float,2>{0.776048839f, 0.662116647f},
-std::array<float,2>{0.296682328f, 0.888755143f},
-std::array<float,2>{0.511742175f, 0.109104857f},
-std::array<float,2>{0.435931355f, 0.177672371f},
-std::array<float,2>{0.724227846f, 0.827545047f},
-std::array<float,2>{0.160592318f, 0.579375744f},
-std::array<float,2>{0.91184175f, 0.427868366f},
-std::array<float,2>{0.314882547f, 0.467345536f},
-std::array<float,2>{0.616516292f, 0.524509907f},
-std::array<float,2>{0.0809664279f, 0.782775819f},
-std::array<float,2>{0.857050717f, 0.230724052f},
-std::array<float,2>{0.217309937f, 0.057130117f},
-std::array<float,2>{0.971959233f, 0.972860336f},
-std::array<float,2>{0.443623662f, 0.707845747f},
-std::array<float,2>{0.63687396f, 0.348643363f},
-std::array<float,2>{0.144456252f, 0.317302465f},
-std::array<float,2>{0.891813338f, 0.743337452f},
-std::array<float,2>{0.394346446f, 0.958123922f},
-std::array<float,2>{0.707495332f, 0.0104807317f},
-std::array<float,2>{0.274234891f, 0.188146859f},
-std::array<float,2>{0.555763721f, 0.757522941f},
-std::array<float,2>{0.0274727996f, 0.551892936f},
-std::array<float,2>{0.809323311f, 0.48751381f},
-std::array<float,2>{0.469956726f, 0.384535491f},
-std::array<float,2>{0.682051837f, 0.612073779f},
-std::array<float,2>{0.223338723f, 0.870076656f},
-std::array<float,2>{0.944536507f, 0.140646011f},
-std::array<float,2>{0.116043523f, 0.0752127245f},
-std::array<float,2>{0.829141796f, 0.910993993f},
-std::array<float,2>{0.37130639f, 0.64358592f},
-std::array<float,2>{0.572633445f, 0.294382185f},
-std::array<float,2>{0.0376313701f, 0.454024166f},
-std::array<float,2>{0.754356563f, 0.517028987f},
-std::array<float,2>{0.304406136f, 0.796200752f},
-std::array<float,2>{0.51575464f, 0.225412011f},
-std::array<float,2>{0.410615206f, 0.0544006452f},
-std::array<float,2>{0.739170611f, 0.979198933f},
-std::array<float,2>{0.178478494f, 0.716695547f},
-std::array<float,2>{0.933669627f, 0.353429496f},
-std::array<float,2>{0.336200476f, 0.256388724f},
-std::array<float,2>{0.603221595f, 0.667849183f},
-std::array<float,2>{0.0711742043f, 0.87959379f},
-std::array<float,2>{0.868931115f, 0.0955765396f},
-std::array<float,2>{0.202435076f, 0.186641902f},
-std::array<float,2>{0.997766793f, 0.819828868f},
-std::array<float,2>{0.460466623f, 0.591881871f},
-std::array<float,2>{0.64230299f, 0.435125172f},
-std::array<float,2>{0.245378599f, 0.408820897f},
-std::array<float,2>{0.96631819f, 0.564902008f},
-std::array<float,2>{0.499557585f, 0.832460284f},
-std::array<float,2>{0.658211708f, 0.164346159f},
-std::array<float,2>{0.348489612f, 0.109940015f},
-std::array<float,2>{0.582761884f, 0.89298296f},
-std::array<float,2>{0.10432297f, 0.675017416f},
-std::array<float,2>{0.813895345f, 0.273051262f},
-std::array<float,2>{0.381746054f, 0.360600114f},
-std::array<float,2>{0.688212097f, 0.700212717f},
-std::array<float,2>{0.125539407f, 0.98472935f},
-std::array<float,2>{0.882979453f, 0.0378183499f},
-std::array<float,2>{0.00547266472f, 0.239122301f},
-std::array<float,2>{0.783674538f, 0.801689088f},
-std::array<float,2>{0.252447903f, 0.508117616f},
-std::array<float,2>{0.537527382f, 0.448528916f},
-std::array<float,2>{0.0837644562f, 0.305664837f},
-std::array<float,2>{0.855326116f, 0.633257568f},
-std::array<float,2>{0.31814602f, 0.930983722f},
-std::array<float,2>{0.612600982f, 0.0868096426f},
-std::array<float,2>{0.437866181f, 0.138387471f},
-std::array<float,2>{0.633651614f, 0.853352606f},
-std::array<float,2>{0.211060286f, 0.606771052f},
-std::array<float,2>{0.974285901f, 0.402703762f},
-std::array<float,2>{0.291226268f, 0.474713266f},
-std::array<float,2>{0.510822535f, 0.54104656f},
-std::array<float,2>{0.058479283f, 0.771861911f},
-std::array<float,2>{0.780770898f, 0.210559115f},
-std::array<float,2>{0.157526329f, 0.0166052375f},
-std::array<float,2>{0.908901334f, 0.94583565f},
-std::array<float,2>{0.430380642f, 0.731026113f},
-std::array<float,2>{0.720598042f, 0.337289691f},
-std::array<float,2>{0.203566179f, 0.275023997f},
-std::array<float,2>{0.977815926f, 0.683979809f},
-std::array<float,2>{0.44679752f, 0.898770571f},
-std::array<float,2>{0.628405035f, 0.124533229f},
-std::array<float,2>{0.321764171f, 0.161551759f},
-std::array<float,2>{0.622044325f, 0.842351556f},
-std::array<float,2>{0.089010261f, 0.574198842f},
-std::array<float,2>{0.848141015f, 0.416680306f},
-std::array<float,2>{0.423995316f, 0.438333362f},
-std::array<float,2>{0.729673982f, 0.503741324f},
-std::array<float,2>{0.16653502f, 0.807736874f},
-std::array<float,2>{0.916041553f, 0.24446319f},
-std::array<float,2>{0.0533792749f, 0.04367752f},
-std::array<float,2>{0.772240818f, 0.994553924f},
-std::array<float,2>{0.284736603f, 0.689088106f},
-std::array<float,2>{0.504785955f, 0.368516475f},
-std::array<float,2>{0.0956415758f, 0.393678397f},
-std::array<float,2>{0.823019266f, 0.594125688f},
-std::array<float,2>{0.358262986f, 0.846158266f},
-std::array<float,2>{0.589007378f, 0.127383113f},
-std::array<float,2>{0.490686536f, 0.0836503059f},
-std::array<float,2>{0.66956687f, 0.926977277f},
-std::array<float,2>{0.236683786f, 0.63215816f},
-std::array<float,2>{0.95412612f, 0.299102306f},
-std::array<float,2>{0.26384601f, 0.331867605f},
-std::array<float,2>{0.544733346f, 0.726498902f},
-std::array<float,2>{0.0124476412f, 0.944619179f},
-std::array<float,2>{0.794361055f, 0.0270321369f},
-std::array<float,2>{0.138646126f, 0.215753153f},
-std::array<float,2>{0.877148151f, 0.780183315f},
-std::array<float,2>{0.38596037f, 0.536563754f},
-std::array<float,2>{0.699513972f, 0.481396556f},
-std::array<float,2>{0.181805953f, 0.498926163f},
-std::array<float,2>{0.92459172f, 0.557986379f},
-std::array<float,2>{0.420633644f, 0.765272737f},
-std::array<float,2>{0.743378043f, 0.201729566f},
-std::array<float,2>{0.304972321f, 0.00540132774f},
-std::array<float,2>{0.528978467f, 0.966158748f},
-std::array<float,2>{0.0419604741f, 0.735333562f},
-std::array<float,2>{0.761728764f, 0.321438581f},
-std::array<float,2>{0.462025136f, 0.288532823f},
-std::array<float,2>{0.653351545f, 0.656015456f},
-std::array<float,2>{0.191506237f, 0.9168818f},
-std::array<float,2>{0.990298688f, 0.0627553314f},
-std::array<float,2>{0.0655776486f, 0.156186387f},
-std::array<float,2>{0.861117423f, 0.86363095f},
-std::array<float,2>{0.331897557f, 0.618162096f},
-std::array<float,2>{0.593839586f, 0.380280942f},
-std::array<float,2>{0.0163889714f, 0.344024658f},
-std::array<float,2>{0.803367615f, 0.706562281f},
-std::array<float,2>{0.269061834f, 0.971960366f},
-std::array<float,2>{0.550658226f, 0.0615230873f},
-std::array<float,2>{0.400874764f, 0.229127109f},
-std::array<float,2>{0.714747012f, 0.788389683f},
-std::array<float,2>{0.15337202f, 0.530779243f},
-std::array<float,2>{0.905392647f, 0.462830722f},
-std::array<float,2>{0.361012667f, 0.424613774f},
-std::array<float,2>{0.569505155f, 0.582184672f},
-std::array<float,2>{0.12204247f, 0.821945667f},
-std::array<float,2>{0.836212635f, 0.174594387f},
-std::array<float,2>{0.231017083f, 0.103155054f},
-std::array<float,2>{0.94843781f, 0.885003746f},
-std::array<float,2>{0.477947682f, 0.657031417f},
-std::array<float,2>{0.673069894f, 0.261567503f},
-std::array<float,2>{0.134988606f, 0.251726508f},
-std::array<float,2>{0.881004333f, 0.670634985f},
-std::array<float,2>{0.388323843f, 0.875921607f},
-std::array<float,2>{0.695833862f, 0.0999954492f},
-std::array<float,2>{0.261613935f, 0.181448042f},
-std::array<float,2>{0.540317297f, 0.815908492f},
-std::array<float,2>{0.0106329489f, 0.588183105f},
-std::array<float,2>{0.789108396f, 0.433172673f},
-std::array<float,2>{0.486738503f, 0.460933357f},
-std::array<float,2>{0.665733755f, 0.523231745f},
-std::array<float,2>{0.240430146f, 0.789093435f},
-std::array<float,2>{0.958855689f, 0.219575182f},
-std::array<float,2>{0.0993721634f, 0.0502689667f},
-std::array<float,2>{0.824711561f, 0.981127381f},
-std::array<float,2>{0.351910055f, 0.713346541f},
-std::array<float,2>{0.592165887f, 0.358586699f},
-std::array<float,2>{0.0506865531f, 0.388136446f},
-std::array<float,2>{0.766872048f, 0.616245151f},
-std::array<float,2>{0.287555456f, 0.87482518f},
-std::array<float,2>{0.500034451f, 0.147246823f},
-std::array<float,2>{0.42758581f, 0.0730404407f},
-std::array<float,2>{0.733055592f, 0.906673133f},
-std::array<float,2>{0.169893369f, 0.648338556f},
-std::array<float,2>{0.919805408f, 0.2893942f},
-std::array<float,2>{0.325437456f, 0.312537849f},
-std::array<float,2>{0.621072412f, 0.748488247f},
-std::array<float,2>{0.0931636021f, 0.955681741f},
-std::array<float,2>{0.847230017f, 0.0120838983f},
-std::array<float,2>{0.208058193f, 0.194237083f},
-std::array<float,2>{0.983698726f, 0.753111064f},
-std::array<float,2>{0.449929118f, 0.547269344f},
-std::array<float,2>{0.632391393f, 0.488298774f},
-std::array<float,2>{0.227424234f, 0.469080418f},
-std::array<float,2>{0.949605823f, 0.54473871f},
-std::array<float,2>{0.482423097f, 0.768514633f},
-std::array<float,2>{0.676148713f, 0.206102297f},
-std::array<float,2>{0.366614759f, 0.0230241604f},
-std::array<float,2>{0.563668847f, 0.952198565f},
-std::array<float,2>{0.119632699f, 0.727749944f},
-std::array<float,2>{0.841744125f, 0.341165662f},
-std::array<float,2>{0.404447526f, 0.310013741f},
-std::array<float,2>{0.718154967f, 0.638635814f},
-std::array<float,2>{0.149020642f, 0.937071443f},
-std::array<float,2>{0.899828494f, 0.0902662203f},
-std::array<float,2>{0.0215954501f, 0.133267328f},
-std::array<float,2>{0.79789722f, 0.858866453f},
-std::array<float,2>{0.271247566f, 0.605172276f},
-std::array<float,2>{0.5545035f, 0.399728805f},
-std::array<float,2>{0.0685868785f, 0.3649562f},
-std::array<float,2>{0.866886318f, 0.698643148f},
-std::array<float,2>{0.332615465f, 0.988947809f},
-std::array<float,2>{0.598200262f, 0.0325587057f},
-std::array<float,2>{0.468346119f, 0.234752193f},
-std::array<float,2>{0.64949429f, 0.797021031f},
-std::array<float,2>{0.1907579f, 0.511821508f},
-std::array<float,2>{0.984645426f, 0.451616466f},
-std::array<float,2>{0.312274009f, 0.413180679f},
-std::array<float,2>{0.525159836f, 0.569773316f},
-std::array<float,2>{0.0458901636f, 0.83036226f},
-std::array<float,2>{0.761380672f, 0.170075089f},
-std::array<float,2>{0.185593724f, 0.114756338f},
-std::array<float,2>{0.927324772f, 0.896450758f},
-std::array<float,2>{0.416605234f, 0.676231802f},
-std::array<float,2>{0.747401476f, 0.266819596f},
-std::array<float,2>{0.199158356f, 0.33349207f},
-std::array<float,2>{0.996092618f, 0.719204545f},
-std::array<float,2>{0.453203231f, 0.938046098f},
-std::array<float,2>{0.644536674f, 0.0309699718f},
-std::array<float,2>{0.342509747f, 0.214563683f},
-std::array<float,2>{0.606837094f, 0.773750424f},
-std::array<float,2>{0.0745444298f, 0.532960653f},
-std::array<float,2>{0.872354746f, 0.478503674f},
-std::array<float,2>{0.410077304f, 0.397017509f},
-std::array<float,2>{0.734715641f, 0.598349571f},
-std::array<float,2>{0.171976268f, 0.850895762f},
-std::array<float,2>{0.929937661f, 0.129840061f},
-std::array<float,2>{0.0322475843f, 0.0810639188f},
-std::array<float,2>{0.753765345f, 0.924391925f},
-std::array<float,2>{0.300413102f, 0.627993226f},
-std::array<float,2>{0.522480428f, 0.30085218f},
-std::array<float,2>{0.111039139f, 0.44182837f},
-std::array<float,2>{0.834204376f, 0.504564941f},
-std::array<float,2>{0.369829446f, 0.809479117f},
-std::array<float,2>{0.574924767f, 0.246340856f},
-std::array<float,2>{0.473193169f, 0.0410788134f},
-std::array<float,2>{0.686784625f, 0.996564865f},
-std::array<float,2>{0.222610369f, 0.694932699f},
-std::array<float,2>{0.939843833f, 0.371165693f},
-std::array<float,2>{0.279089898f, 0.279489011f},
-std::array<float,2>{0.560301125f, 0.680647194f},
-std::array<float,2>{0.0267264917f, 0.904325068f},
-std::array<float,2>{0.805541635f, 0.118173495f},
-std::array<float,2>{0.147534192f, 0.156489596f},
-std::array<float,2>{0.895975471f, 0.838641584f},
-std::array<float,2>{0.396869123f, 0.574547291f},
-std::array<float,2>{0.706551313f, 0.418327451f},
-std::array<float,2>{0.163540885f, 0.426750839f},
-std::array<float,2>{0.913125873f, 0.581046522f},
-std::array<float,2>{0.434345871f, 0.824808955f},
-std::array<float,2>{0.725364089f, 0.178356186f},
-std::array<float,2>{0.294412941f, 0.105679981f},
-std::array<float,2>{0.515460253f, 0.888033152f},
-std::array<float,2>{0.059393812f, 0.661024332f},
-std::array<float,2>{0.773891509f, 0.261997283f},
-std::array<float,2>{0.441688061f, 0.349785507f},
-std::array<float,2>{0.639218092f, 0.710033f},
-std::array<float,2>{0.214916334f, 0.975617588f},
-std::array<float,2>{0.969323039f, 0.0564292111f},
-std::array<float,2>{0.0784472451f, 0.234185636f},
-std::array<float,2>{0.85899508f, 0.78350246f},
-std::array<float,2>{0.313914597f, 0.525864184f},
-std::array<float,2>{0.614462495f, 0.465963691f},
-std::array<float,2>{0.00251034065f, 0.283215612f},
-std::array<float,2>{0.788644969f, 0.650451958f},
-std::array<float,2>{0.254109293f, 0.92079705f},
-std::array<float,2>{0.532442808f, 0.0682539418f},
-std::array<float,2>{0.37665379f, 0.148710772f},
-std::array<float,2>{0.694625139f, 0.863169312f},
-std::array<float,2>{0.130854651f, 0.621958435f},
-std::array<float,2>{0.888047993f, 0.375029296f},
-std::array<float,2>{0.346367955f, 0.495918959f},
-std::array<float,2>{0.581367135f, 0.559219837f},
-std::array<float,2>{0.108108133f, 0.758493304f},
-std::array<float,2>{0.81678313f, 0.197930619f},
-std::array<float,2>{0.248857483f, 0.000406066276f},
-std::array<float,2>{0.961801529f, 0.961320162f},
-std::array<float,2>{0.495988637f, 0.738904297f},
-std::array<float,2>{0.660385609f, 0.326963931f},
-std::array<float,2>{0.177075595f, 0.354768813f},
-std::array<float,2>{0.93612951f, 0.71754992f},
-std::array<float,2>{0.413196504f, 0.977611601f},
-std::array<float,2>{0.741833568f, 0.0520754643f},
-std::array<float,2>{0.301662624f, 0.223449394f},
-std::array<float,2>{0.517683864f, 0.794846058f},
-std::array<float,2>{0.0368404612f, 0.517635703f},
-std::array<float,2>{0.756750762f, 0.456642419f},
-std::array<float,2>{0.457613915f, 0.436886668f},
-std::array<float,2>{0.64297539f, 0.591103733f},
-std::array<float,2>{0.201028988f, 0.817574739f},
-std::array<float,2>{0.999401927f, 0.18455781f},
-std::array<float,2>{0.0741771311f, 0.097135596f},
-std::array<float,2>{0.870260835f, 0.881330848f},
-std::array<float,2>{0.338254243f, 0.665455103f},
-std::array<float,2>{0.605445027f, 0.253987491f},
-std::array<float,2>{0.0303036496f, 0.484584749f},
-std::array<float,2>{0.81103617f, 0.554308474f},
-std::array<float,2>{0.276302785f, 0.754699826f},
-std::array<float,2>{0.557379663f, 0.189501211f},
-std::array<float,2>{0.390835971f, 0.00896547362f},
-std::array<float,2>{0.710238874f, 0.959347188f},
-std::array<float,2>{0.142345175f, 0.745968938f},
-std::array<float,2>{0.894384444f, 0.3194547f},
-std::array<float,2>{0.373924285f, 0.296597421f},
-std::array<float,2>{0.570422053f, 0.64228642f},
-std::array<float,2>{0.115200497f, 0.912177384f},
-std::array<float,2>{0.83066386f, 0.0776453242f},
-std::array<float,2>{0.225711271f, 0.142604366f},
-std::array<float,2>{0.94192946f, 0.868199348f},
-std::array<float,2>{0.471347928f, 0.611119568f},
-std::array<float,2>{0.679942608f, 0.386027634f},
-std::array<float,2>{0.213508233f, 0.405174434f},
-std::array<float,2>{0.976515949f, 0.609346926f},
-std::array<float,2>{0.439792424f, 0.854959667f},
-std::array<float,2>{0.634891033f, 0.139776558f},
-std::array<float,2>{0.319236487f, 0.0885007679f},
-std::array<float,2>{0.610260367f, 0.933411956f},
-std::array<float,2>{0.0857420489f, 0.636040092f},
-std::array<float,2>{0.851567507f, 0.307772964f},
-std::array<float,2>{0.433293015f, 0.339452505f},
-std::array<float,2>{0.7211169f, 0.732817531f},
-std::array<float,2>{0.158923373f, 0.948646903f},
-std::array<float,2>{0.906847358f, 0.0178753864f},
-std::array<float,2>{0.0554936379f, 0.207910731f},
-std::array<float,2>{0.778915405f, 0.769638181f},
-std::array<float,2>{0.289580762f, 0.5390746f},
-std::array<float,2>{0.509256721f, 0.472719938f},
-std::array<float,2>{0.102822132f, 0.271324307f},
-std::array<float,2>{0.815792561f, 0.672697544f},
-std::array<float,2>{0.350296646f, 0.890706539f},
-std::array<float,2>{0.584042072f, 0.112790234f},
-std::array<float,2>{0.497810811f, 0.167623192f},
-std::array<float,2>{0.657832563f, 0.834477127f},
-std::array<float,2>{0.24257341f, 0.563745141f},
-std::array<float,2>{0.966917157f, 0.40753144f},
-std::array<float,2>{0.250655532f, 0.445494562f},
-std::array<float,2>{0.53570801f, 0.511154056f},
-std::array<float,2>{0.00686557172f, 0.803192914f},
-std::array<float,2>{0.782383382f, 0.240653902f},
-std::array<float,2>{0.128710881f, 0.0364880897f},
-std::array<float,2>{0.884973824f, 0.987845778f},
-std::array<float,2>{0.3796556f, 0.701620698f},
-std::array<float,2>{0.690750122f, 0.362583965f},
-std::array<float,2>{0.234961674f, 0.297391355f},
-std::array<float,2>{0.956420183f, 0.629546344f},
-std::array<float,2>{0.489797175f, 0.929259539f},
-std::array<float,2>{0.670515954f, 0.0843089074f},
-std::array<float,2>{0.356762141f, 0.125929013f},
-std::array<float,2>{0.587805152f, 0.84485352f},
-std::array<float,2>{0.0965568051f, 0.596542776f},
-std::array<float,2>{0.821282804f, 0.392563015f},
-std::array<float,2>{0.384610564f, 0.483322114f},
-std::array<float,2>{0.701698363f, 0.538219094f},
-std::array<float,2>{0.139789283f, 0.779177248f},
-std::array<float,2>{0.875839353f, 0.217074722f},
-std::array<float,2>{0.0155481761f, 0.0243575703f},
-std::array<float,2>{0.79639852f, 0.941745579f},
-std::array<float,2>{0.263282031f, 0.723383009f},
-std::array<float,2>{0.545111239f, 0.329901487f},
-std::array<float,2>{0.0860448629f, 0.414297402f},
-std::array<float,2>{0.851544797f, 0.570596397f},
-std::array<float,2>{0.32312876f, 0.840711355f},
-std::array<float,2>{0.624800026f, 0.164022982f},
-std::array<float,2>{0.447700679f, 0.121324271f},
-std::array<float,2>{0.625074625f, 0.902115405f},
-std::array<float,2>{0.206826538f, 0.687057972f},
-std::array<float,2>{0.979659915f, 0.277302474f},
-std::array<float,2>{0.282922626f, 0.370672911f},
-std::array<float,2>{0.507468045f, 0.691240788f},
-std::array<float,2>{0.0515749753f, 0.993803501f},
-std::array<float,2>{0.770154536f, 0.046655409f},
-std::array<float,2>{0.164731264f, 0.242902026f},
-std::array<float,2>{0.91531688f, 0.805974007f},
-std::array<float,2>{0.422868103f, 0.500362277f},
-std::array<float,2>{0.727856994f, 0.440921217f},
-std::array<float,2>{0.155459911f, 0.463771343f},
-std::array<float,2>{0.90379566f, 0.528745472f},
-std::array<float,2>{0.399423271f, 0.785998881f},
-std::array<float,2>{0.711374104f, 0.227331489f},
-std::array<float,2>{0.265881777f, 0.0596994944f},
-std::array<float,2>{0.547600389f, 0.970009625f},
-std::array<float,2>{0.0184348933f, 0.704422891f},
-std::array<float,2>{0.801263869f, 0.346467882f},
-std::array<float,2>{0.47865358f, 0.258295029f},
-std::array<float,2>{0.675136924f, 0.658505738f},
-std::array<float,2>{0.232969806f, 0.884249389f},
-std::array<float,2>{0.946828723f, 0.103852592f},
-std::array<float,2>{0.124993578f, 0.173177272f},
-std::array<float,2>{0.838989615f, 0.822708249f},
-std::array<float,2>{0.362620324f, 0.584509909f},
-std::array<float,2>{0.567052782f, 0.423428476f},
-std::array<float,2>{0.0393226333f, 0.323628098f},
-std::array<float,2>{0.765191972f, 0.736793756f},
-std::array<float,2>{0.306872517f, 0.967405677f},
-std::array<float,2>{0.53021884f, 0.00740579981f},
-std::array<float,2>{0.419833332f, 0.199408069f},
-std::array<float,2>{0.746090531f, 0.762697995f},
-std::array<float,2>{0.180546448f, 0.556408048f},
-std::array<float,2>{0.923063695f, 0.49679774f},
-std::array<float,2>{0.329367787f, 0.382037938f},
-std::array<float,2>{0.596254528f, 0.619637609f},
-std::array<float,2>{0.0629498065f, 0.867150068f},
-std::array<float,2>{0.862914622f, 0.154035732f},
-std::array<float,2>{0.193404675f, 0.0663753599f},
-std::array<float,2>{0.989324391f, 0.91485399f},
-std::array<float,2>{0.464197278f, 0.652915835f},
-std::array<float,2>{0.654338658f, 0.28604874f},
-std::array<float,2>{0.166803211f, 0.276172578f},
-std::array<float,2>{0.916428804f, 0.686414361f},
-std::array<float,2>{0.424095094f, 0.901318789f},
-std::array<float,2>{0.729913831f, 0.122147076f},
-std::array<float,2>{0.285004228f, 0.162619889f},
-std::array<float,2>{0.504582703f, 0.840889812f},
-std::array<float,2>{0.0536920317f, 0.571553648f},
-std::array<float,2>{0.77205199f, 0.41580075f},
-std::array<float,2>{0.447083086f, 0.439983428f},
-std::array<float,2>{0.628077507f, 0.501671314f},
-std::array<float,2>{0.203190878f, 0.805402756f},
-std::array<float,2>{0.97756803f, 0.243315071f},
-std::array<float,2>{0.0891419053f, 0.0457351878f},
-std::array<float,2>{0.84776777f, 0.992243648f},
-std::array<float,2>{0.32131055f, 0.690146804f},
-std::array<float,2>{0.621679485f, 0.36937052f},
-std::array<float,2>{0.0125007788f, 0.391211897f},
-std::array<float,2>{0.79398942f, 0.597265959f},
-std::array<float,2>{0.26414752f, 0.844326079f},
-std::array<float,2>{0.544587672f, 0.126921654f},
-std::array<float,2>{0.386010408f, 0.0850559771f},
-std::array<float,2>{0.699269056f, 0.927790344f},
-std::array<float,2>{0.138219818f, 0.630826473f},
-std::array<float,2>{0.877347112f, 0.298206985f},
-std::array<float,2>{0.357953697f, 0.328138441f},
-std::array<float,2>{0.589147806f, 0.724345565f},
-std::array<float,2>{0.095246911f, 0.942719638f},
-std::array<float,2>{0.82299155f, 0.0245413836f},
-std::array<float,2>{0.236344844f, 0.218187124f},
-std::array<float,2>{0.954405725f, 0.77766335f},
-std::array<float,2>{0.490418792f, 0.53729403f},
-std::array<float,2>{0.669817507f, 0.483635783f},
-std::array<float,2>{0.191714212f, 0.497610867f},
-std::array<float,2>{0.990583122f, 0.555402517f},
-std::array<float,2>{0.462259233f, 0.762257338f},
-std::array<float,2>{0.653717935f, 0.2009269f},
-std::array<float,2>{0.331678241f, 0.00586732663f},
-std::array<float,2>{0.594156802f, 0.968166113f},
-std::array<float,2>{0.0658901334f, 0.738206744f},
-std::array<float,2>{0.860840678f, 0.323238492f},
-std::array<float,2>{0.420761138f, 0.286377698f},
-std::array<float,2>{0.743508339f, 0.653750658f},
-std::array<float,2>{0.181905836f, 0.915848851f},
-std::array<float,2>{0.924337029f, 0.0651796982f},
-std::array<float,2>{0.0416898467f, 0.152712539f},
-std::array<float,2>{0.76200676f, 0.865673184f},
-std::array<float,2>{0.304864019f, 0.621004999f},
-std::array<float,2>{0.529284656f, 0.380906612f},
-std::array<float,2>{0.121758118f, 0.347050995f},
-std::array<float,2>{0.836031675f, 0.704084694f},
-std::array<float,2>{0.361236811f, 0.969460785f},
-std::array<float,2>{0.569768608f, 0.0589675494f},
-std::array<float,2>{0.477622926f, 0.228105217f},
-std::array<float,2>{0.673313081f, 0.786350846f},
-std::array<float,2>{0.231417194f, 0.528063655f},
-std::array<float,2>{0.948600352f, 0.46412611f},
-std::array<float,2>{0.26949209f, 0.422760934f},
-std::array<float,2>{0.550513029f, 0.585848689f},
-std::array<float,2>{0.0162611566f, 0.823711514f},
-std::array<float,2>{0.803677678f, 0.171914354f},
-std::array<float,2>{0.153618902f, 0.104512289f},
-std::array<float,2>{0.905571043f, 0.883181036f},
-std::array<float,2>{0.400432467f, 0.659337759f},
-std::array<float,2>{0.714465082f, 0.259476542f},
-std::array<float,2>{0.223389089f, 0.31929329f},
-std::array<float,2>{0.944807112f, 0.744154334f},
-std::array<float,2>{0.470130175f, 0.960580528f},
-std::array<float,2>{0.681873381f, 0.00845007878f},
-std::array<float,2>{0.371339649f, 0.19063811f},
-std::array<float,2>{0.572369754f, 0.755436361f},
-std::array<float,2>{0.115905128f, 0.553251386f},
-std::array<float,2>{0.829529881f, 0.485683382f},
-std::array<float,2>{0.394236475f, 0.38482362f},
-std::array<float,2>{0.707239449f, 0.609868288f},
-std::array<float,2>{0.144243494f, 0.868100047f},
-std::array<float,2>{0.892050803f, 0.144119591f},
-std::array<float,2>{0.0277825668f, 0.0769936219f},
-std::array<float,2>{0.8094244f, 0.913318634f},
-std::array<float,2>{0.274025589f, 0.640863836f},
-std::array<float,2>{0.5560022f, 0.295617193f},
-std::array<float,2>{0.0709642321f, 0.455214381f},
-std::array<float,2>{0.868778825f, 0.519395888f},
-std::array<float,2>{0.336136311f, 0.793002903f},
-std::array<float,2>{0.603385746f, 0.223864451f},
-std::array<float,2>{0.460858703f, 0.0509718508f},
-std::array<float,2>{0.642382979f, 0.976865947f},
-std::array<float,2>{0.202257156f, 0.718287468f},
-std::array<float,2>{0.997900844f, 0.353570729f},
-std::array<float,2>{0.304676145f, 0.254974514f},
-std::array<float,2>{0.51602155f, 0.664578676f},
-std::array<float,2>{0.0378781781f, 0.882545054f},
-std::array<float,2>{0.754101098f, 0.096171625f},
-std::array<float,2>{0.178458229f, 0.185437173f},
-std::array<float,2>{0.934023738f, 0.81728071f},
-std::array<float,2>{0.410240471f, 0.590162933f},
-std::array<float,2>{0.738929868f, 0.435926199f},
-std::array<float,2>{0.125943124f, 0.407131106f},
-std::array<float,2>{0.883200884f, 0.562998414f},
-std::array<float,2>{0.381368786f, 0.835254073f},
-std::array<float,2>{0.688475668f, 0.166608602f},
-std::array<float,2>{0.252789587f, 0.111376196f},
-std::array<float,2>{0.537211478f, 0.891675174f},
-std::array<float,2>{0.00572579121f, 0.673732698f},
-std::array<float,2>{0.783278823f, 0.270175695f},
-std::array<float,2>{0.499839634f, 0.361884952f},
-std::array<float,2>{0.658578098f, 0.702903688f},
-std::array<float,2>{0.245188653f, 0.986877501f},
-std::array<float,2>{0.966586292f, 0.0356843323f},
-std::array<float,2>{0.104133599f, 0.241706282f},
-std::array<float,2>{0.813675761f, 0.804242432f},
-std::array<float,2>{0.348377138f, 0.510411799f},
-std::array<float,2>{0.582843363f, 0.446973234f},
-std::array<float,2>{0.0582534522f, 0.30670312f},
-std::array<float,2>{0.78106755f, 0.635155499f},
-std::array<float,2>{0.291357338f, 0.932060242f},
-std::array<float,2>{0.510999858f, 0.0892622173f},
-std::array<float,2>{0.430482417f, 0.139030576f},
-std::array<float,2>{0.720309973f, 0.853818715f},
-std::array<float,2>{0.157248542f, 0.607526302f},
-std::array<float,2>{0.909155428f, 0.405682713f},
-std::array<float,2>{0.318051428f, 0.474153399f},
-std::array<float,2>{0.6123541f, 0.540130913f},
-std::array<float,2>{0.0835562646f, 0.770823896f},
-std::array<float,2>{0.854983091f, 0.208225861f},
-std::array<float,2>{0.211185127f, 0.0195211526f},
-std::array<float,2>{0.974512517f, 0.947760761f},
-std::array<float,2>{0.437691659f, 0.734165609f},
-std::array<float,2>{0.633428514f, 0.33807224f},
-std::array<float,2>{0.144579411f, 0.372549802f},
-std::array<float,2>{0.897750437f, 0.693958759f},
-std::array<float,2>{0.395861626f, 0.997542739f},
-std::array<float,2>{0.703266084f, 0.04268777f},
-std::array<float,2>{0.280892849f, 0.247310579f},
-std::array<float,2>{0.562482834f, 0.81040448f},
-std::array<float,2>{0.0245835744f, 0.505470157f},
-std::array<float,2>{0.808461428f, 0.443083912f},
-std::array<float,2>{0.474703461f, 0.419905245f},
-std::array<float,2>{0.684045553f, 0.575488985f},
-std::array<float,2>{0.220087141f, 0.839455366f},
-std::array<float,2>{0.939331055f, 0.157619193f},
-std::array<float,2>{0.111796834f, 0.117779158f},
-std::array<float,2>{0.832742512f, 0.906229317f},
-std::array<float,2>{0.368675977f, 0.680815279f},
-std::array<float,2>{0.576842725f, 0.280538946f},
-std::array<float,2>{0.0333510041f, 0.477327645f},
-std::array<float,2>{0.75123471f, 0.531915426f},
-std::array<float,2>{0.298043936f, 0.774757981f},
-std::array<float,2>{0.520690978f, 0.213497221f},
-std::array<float,2>{0.407247305f, 0.0298453532f},
-std::array<float,2>{0.737136722f, 0.938569248f},
-std::array<float,2>{0.174398288f, 0.720344067f},
-std::array<float,2>{0.932348788f, 0.33291173f},
-std::array<float,2>{0.340547293f, 0.301974803f},
-std::array<float,2>{0.607468545f, 0.627065361f},
-std::array<float,2>{0.0778944492f, 0.925064504f},
-std::array<float,2>{0.873904943f, 0.0809406564f},
-std::array<float,2>{0.19606787f, 0.130484715f},
-std::array<float,2>{0.992443264f, 0.850394428f},
-std::array<float,2>{0.456940353f, 0.599242449f},
-std::array<float,2>{0.647623122f, 0.397507906f},
-std::array<float,2>{0.246191099f, 0.376162499f},
-std::array<float,2>{0.964300811f, 0.622662604f},
-std::array<float,2>{0.492310882f, 0.861979842f},
-std::array<float,2>{0.663062155f, 0.149662659f},
-std::array<float,2>{0.345666617f, 0.0668760464f},
-std::array<float,2>{0.578701794f, 0.920920014f},
-std::array<float,2>{0.106423222f, 0.651849747f},
-std::array<float,2>{0.819923162f, 0.284978807f},
-std::array<float,2>{0.377275914f, 0.327708334f},
-std::array<float,2>{0.692219675f, 0.739534259f},
-std::array<float,2>{0.132059708f, 0.962859392f},
-std::array<float,2>{0.889988899f, 0.00107420073f},
-std::array<float,2>{0.000625116634f, 0.199049786f},
-std::array<float,2>{0.785642505f, 0.759364486f},
-std::array<float,2>{0.256655723f, 0.559804738f},
-std::array<float,2>{0.53396523f, 0.49443388f},
-std::array<float,2>{0.080716148f, 0.263585865f},
-std::array<float,2>{0.857275486f, 0.661242545f},
-std::array<float,2>{0.314612955f, 0.887059331f},
-std::array<float,2>{0.616429985f, 0.106841154f},
-std::array<float,2>{0.443598926f, 0.179541215f},
-std::array<float,2>{0.63696599f, 0.825504005f},
-std::array<float,2>{0.217581555f, 0.581282675f},
-std::array<float,2>{0.97173804f, 0.427307755f},
-std::array<float,2>{0.296503425f, 0.465325087f},
-std::array<float,2>{0.512169302f, 0.52653563f},
-std::array<float,2>{0.0623439141f, 0.784805059f},
-std::array<float,2>{0.776305377f, 0.232686982f},
-std::array<float,2>{0.160370961f, 0.0550100803f},
-std::array<float,2>{0.91209811f, 0.974888504f},
-std::array<float,2>{0.435599178f, 0.709343255f},
-std::array<float,2>{0.72437048f, 0.350612193f},
-std::array<float,2>{0.209814012f, 0.290374666f},
-std::array<float,2>{0.981835723f, 0.647184014f},
-std::array<float,2>{0.45145607f, 0.907798529f},
-std::array<float,2>{0.629309177f, 0.0735112876f},
-std::array<float,2>{0.326263368f, 0.147861317f},
-std::array<float,2>{0.617383301f, 0.873911083f},
-std::array<float,2>{0.0917727724f, 0.615879774f},
-std::array<float,2>{0.843796849f, 0.386856467f},
-std::array<float,2>{0.429036021f, 0.489632338f},
-std::array<float,2>{0.731759489f, 0.548602939f},
-std::array<float,2>{0.171727225f, 0.752896547f},
-std::array<float,2>{0.920334816f, 0.194916308f},
-std::array<float,2>{0.0468799658f, 0.0128663918f},
-std::array<float,2>{0.767889678f, 0.956910968f},
-std::array<float,2>{0.286562592f, 0.749768317f},
-std::array<float,2>{0.50345701f, 0.314403385f},
-std::array<float,2>{0.10051515f, 0.431825012f},
-std::array<float,2>{0.826603353f, 0.589143336f},
-std::array<float,2>{0.353913873f, 0.815038979f},
-std::array<float,2>{0.591005027f, 0.180531874f},
-std::array<float,2>{0.486281306f, 0.100824818f},
-std::array<float,2>{0.667608738f, 0.876121998f},
-std::array<float,2>{0.240226448f, 0.671220899f},
-std::array<float,2>{0.959011555f, 0.250313908f},
-std::array<float,2>{0.259304911f, 0.357517928f},
-std::array<float,2>{0.542536616f, 0.7140733f},
-std::array<float,2>{0.00915390253f, 0.982308686f},
-std::array<float,2>{0.791510344f, 0.0495855436f},
-std::array<float,2>{0.133410677f, 0.220022261f},
-std::array<float,2>{0.87935394f, 0.790924728f},
-std::array<float,2>{0.389141113f, 0.522401631f},
-std::array<float,2>{0.699134409f, 0.459803253f},
-std::array<float,2>{0.183680713f, 0.452360123f},
-std::array<float,2>{0.92776823f, 0.51307267f},
-std::array<float,2>{0.414468378f, 0.798139215f},
-std::array<float,2>{0.749889314f, 0.235582948f},
-std::array<float,2>{0.309913635f, 0.0314538404f},
-std::array<float,2>{0.526576221f, 0.989258051f},
-std::array<float,2>{0.0431956984f, 0.697561562f},
-std::array<float,2>{0.758856535f, 0.363461405f},
-std::array<float,2>{0.465853512f, 0.266497344f},
-std::array<float,2>{0.651248217f, 0.676980197f},
-std::array<float,2>{0.188851625f, 0.895091653f},
-std::array<float,2>{0.987105668f, 0.113808997f},
-std::array<float,2>{0.0675430968f, 0.171406269f},
-std::array<float,2>{0.864551127f, 0.831768453f},
-std::array<float,2>{0.334654123f, 0.568493366f},
-std::array<float,2>{0.599757969f, 0.41299662f},
-std::array<float,2>{0.0195626095f, 0.340451568f},
-std::array<float,2>{0.798927665f, 0.727298319f},
-std::array<float,2>{0.273167133f, 0.951233327f},
-std::array<float,2>{0.552679777f, 0.0218743831f},
-std::array<float,2>{0.404142141f, 0.205544397f},
-std::array<float,2>{0.716173053f, 0.768785775f},
-std::array<float,2>{0.151049569f, 0.543183506f},
-std::array<float,2>{0.901776612f, 0.470505148f},
-std::array<float,2>{0.364260882f, 0.398692518f},
-std::array<float,2>{0.565423429f, 0.604331851f},
-std::array<float,2>{0.117498018f, 0.857971549f},
-std::array<float,2>{0.84199059f, 0.134172156f},
-std::array<float,2>{0.229194075f, 0.0911060721f},
-std::array<float,2>{0.951640904f, 0.936110795f},
-std::array<float,2>{0.480915368f, 0.637450576f},
-std::array<float,2>{0.678354859f, 0.309105366f},
-std::array<float,2>{0.140135437f, 0.300292701f},
-std::array<float,2>{0.875589371f, 0.631156981f},
-std::array<float,2>{0.384511739f, 0.926053107f},
-std::array<float,2>{0.702021599f, 0.0823040456f},
-std::array<float,2>{0.263629198f, 0.128300771f},
-std::array<float,2>{0.545291722f, 0.847046912f},
-std::array<float,2>{0.0153558301f, 0.595197856f},
-std::array<float,2>{0.796787739f, 0.392948598f},
-std::array<float,2>{0.490143239f, 0.481831938f},
-std::array<float,2>{0.670732379f, 0.535490334f},
-std::array<float,2>{0.235149905f, 0.780591667f},
-std::array<float,2>{0.956249952f, 0.215881199f},
-std::array<float,2>{0.0963865295f, 0.025957847f},
-std::array<float,2>{0.820962489f, 0.943676233f},
-std::array<float,2>{0.356627882f, 0.724893272f},
-std::array<float,2>{0.58751303f, 0.330522388f},
-std::array<float,2>{0.0515022874f, 0.417463005f},
-std::array<float,2>{0.77041626f, 0.572692573f},
-std::array<float,2>{0.283203065f, 0.842783391f},
-std::array<float,2>{0.507727146f, 0.16060774f},
-std::array<float,2>{0.423265904f, 0.123947881f},
-std::array<float,2>{0.72756964f, 0.900260866f},
-std::array<float,2>{0.164982468f, 0.684755504f},
-std::array<float,2>{0.915241599f, 0.274276644f},
-std::array<float,2>{0.322970688f, 0.368043214f},
-std::array<float,2>{0.624558449f, 0.688084126f},
-std::array<float,2>{0.086345911f, 0.995750546f},
-std::array<float,2>{0.851100445f, 0.0444145799f},
-std::array<float,2>{0.206758648f, 0.246038035f},
-std::array<float,2>{0.979917049f, 0.806784928f},
-std::array<float,2>{0.447321028f, 0.502690673f},
-std::array<float,2>{0.625455618f, 0.438857496f},
-std::array<float,2>{0.233377814f, 0.461163759f},
-std::array<float,2>{0.947129071f, 0.529351413f},
-std::array<float,2>{0.478940666f, 0.787936032f},
-std::array<float,2>{0.674818635f, 0.229863331f},
-std::array<float,2>{0.362505704f, 0.0618361086f},
-std::array<float,2>{0.567246675f, 0.971589625f},
-std::array<float,2>{0.124729283f, 0.705204248f},
-std::array<float,2>{0.839224339f, 0.345102072f},
-std::array<float,2>{0.399764895f, 0.260129035f},
-std::array<float,2>{0.711144984f, 0.657764554f},
-std::array<float,2>{0.155525118f, 0.886359453f},
-std::array<float,2>{0.903452575f, 0.101622738f},
-std::array<float,2>{0.0181780737f, 0.175646737f},
-std::array<float,2>{0.800871015f, 0.820597768f},
-std::array<float,2>{0.265826583f, 0.583131015f},
-std::array<float,2>{0.547758639f, 0.425162435f},
-std::array<float,2>{0.0627303123f, 0.320711285f},
-std::array<float,2>{0.863117516f, 0.735373318f},
-std::array<float,2>{0.329324752f, 0.964872837f},
-std::array<float,2>{0.596505523f, 0.00467577996f},
-std::array<float,2>{0.464015245f, 0.20257026f},
-std::array<float,2>{0.654748976f, 0.76437211f},
-std::array<float,2>{0.193711922f, 0.557092011f},
-std::array<float,2>{0.989654839f, 0.499228656f},
-std::array<float,2>{0.307087779f, 0.37972185f},
-std::array<float,2>{0.529925823f, 0.618348837f},
-std::array<float,2>{0.0392719023f, 0.864366531f},
-std::array<float,2>{0.765605867f, 0.155065015f},
-std::array<float,2>{0.180303365f, 0.0640535653f},
-std::array<float,2>{0.923266411f, 0.917332411f},
-std::array<float,2>{0.41957733f, 0.654993176f},
-std::array<float,2>{0.74567461f, 0.287726134f},
-std::array<float,2>{0.200839162f, 0.352367669f},
-std::array<float,2>{0.999233305f, 0.715557873f},
-std::array<float,2>{0.457794279f, 0.980341077f},
-std::array<float,2>{0.642789781f, 0.0533193685f},
-std::array<float,2>{0.337902606f, 0.225805879f},
-std::array<float,2>{0.605061412f, 0.795357704f},
-std::array<float,2>{0.0737321973f, 0.516596317f},
-std::array<float,2>{0.870525122f, 0.454483509f},
-std::array<float,2>{0.413563997f, 0.433753669f},
-std::array<float,2>{0.74206847f, 0.593244135f},
-std::array<float,2>{0.176948562f, 0.819292903f},
-std::array<float,2>{0.936369836f, 0.18562524f},
-std::array<float,2>{0.0368730575f, 0.0946251675f},
-std::array<float,2>{0.756433547f, 0.880197942f},
-std::array<float,2>{0.301453471f, 0.666178644f},
-std::array<float,2>{0.517968893f, 0.257041782f},
-std::array<float,2>{0.114785016f, 0.486542642f},
-std::array<float,2>{0.830841243f, 0.550940037f},
-std::array<float,2>{0.373537987f, 0.756238937f},
-std::array<float,2>{0.570620954f, 0.189024374f},
-std::array<float,2>{0.471489608f, 0.0114095816f},
-std::array<float,2>{0.679809391f, 0.957714796f},
-std::array<float,2>{0.225992486f, 0.743073702f},
-std::array<float,2>{0.94237864f, 0.31754148f},
-std::array<float,2>{0.276018739f, 0.293262064f},
-std::array<float,2>{0.557197988f, 0.642732322f},
-std::array<float,2>{0.0306163039f, 0.911199629f},
-std::array<float,2>{0.811323106f, 0.0747992024f},
-std::array<float,2>{0.142126158f, 0.141642734f},
-std::array<float,2>{0.894243658f, 0.870491028f},
-std::array<float,2>{0.391072392f, 0.613212645f},
-std::array<float,2>{0.709989667f, 0.383075833f},
-std::array<float,2>{0.159155875f, 0.403389007f},
-std::array<float,2>{0.907097995f, 0.606426179f},
-std::array<float,2>{0.433357269f, 0.852027595f},
-std::array<float,2>{0.720830441f, 0.136908352f},
-std::array<float,2>{0.289851159f, 0.0875752568f},
-std::array<float,2>{0.509032011f, 0.930206299f},
-std::array<float,2>{0.0551887192f, 0.634573996f},
-std::array<float,2>{0.779111087f, 0.30507049f},
-std::array<float,2>{0.43959251f, 0.336836576f},
-std::array<float,2>{0.635085702f, 0.731650591f},
-std::array<float,2>{0.213789374f, 0.947039306f},
-std::array<float,2>{0.976077437f, 0.0157158375f},
-std::array<float,2>{0.08555305f, 0.209745914f},
-std::array<float,2>{0.851955712f, 0.772773802f},
-std::array<float,2>{0.318959534f, 0.542268336f},
-std::array<float,2>{0.610045493f, 0.476437122f},
-std::array<float,2>{0.00718180137f, 0.27219367f},
-std::array<float,2>{0.782640219f, 0.673850954f},
-std::array<float,2>{0.250941575f, 0.89365828f},
-std::array<float,2>{0.535895288f, 0.110405579f},
-std::array<float,2>{0.379410893f, 0.165945992f},
-std::array<float,2>{0.690631151f, 0.83319515f},
-std::array<float,2>{0.128597274f, 0.565652132f},
-std::array<float,2>{0.885199189f, 0.410003841f},
-std::array<float,2>{0.350433528f, 0.447311223f},
-std::array<float,2>{0.584371388f, 0.509339452f},
-std::array<float,2>{0.102657162f, 0.802496433f},
-std::array<float,2>{0.815567195f, 0.239267647f},
-std::array<float,2>{0.242364407f, 0.0385126472f},
-std::array<float,2>{0.967183888f, 0.986251116f},
-std::array<float,2>{0.497756273f, 0.699598849f},
-std::array<float,2>{0.658070326f, 0.360095024f},
-std::array<float,2>{0.172305495f, 0.334682882f},
-std::array<float,2>{0.929739714f, 0.722632647f},
-std::array<float,2>{0.409816563f, 0.939535856f},
-std::array<float,2>{0.734489381f, 0.0287470538f},
-std::array<float,2>{0.30059284f, 0.212274998f},
-std::array<float,2>{0.522845864f, 0.775553226f},
-std::array<float,2>{0.0325653739f, 0.533958435f},
-std::array<float,2>{0.75362128f, 0.478720069f},
-std::array<float,2>{0.453611523f, 0.395136863f},
-std::array<float,2>{0.644922078f, 0.600873232f},
-std::array<float,2>{0.198936403f, 0.849321425f},
-std::array<float,2>{0.995647848f, 0.132323444f},
-std::array<float,2>{0.0744013041f, 0.078126654f},
-std::array<float,2>{0.872308135f, 0.922100067f},
-std::array<float,2>{0.342720896f, 0.625711977f},
-std::array<float,2>{0.606601596f, 0.304227084f},
-std::array<float,2>{0.0265063588f, 0.444580793f},
-std::array<float,2>{0.805411339f, 0.507617652f},
-std::array<float,2>{0.278835744f, 0.812357187f},
-std::array<float,2>{0.560458541f, 0.249342993f},
-std::array<float,2>{0.396627933f, 0.040844176f},
-std::array<float,2>{0.706962883f, 0.999836028f},
-std::array<float,2>{0.147736326f, 0.691762209f},
-std::array<float,2>{0.895643413f, 0.373506069f},
-std::array<float,2>{0.370007455f, 0.278516442f},
-std::array<float,2>{0.575181842f, 0.682812393f},
-std::array<float,2>{0.111301221f, 0.902840495f},
-std::array<float,2>{0.83425957f, 0.119972356f},
-std::array<float,2>{0.222273603f, 0.159263283f},
-std::array<float,2>{0.939654708f, 0.837878525f},
-std::array<float,2>{0.473563075f, 0.576484323f},
-std::array<float,2>{0.686572909f, 0.421625644f},
-std::array<float,2>{0.215128273f, 0.428967804f},
-std::array<float,2>{0.969666779f, 0.578636825f},
-std::array<float,2>{0.441426605f, 0.826672375f},
-std::array<float,2>{0.639605939f, 0.176517129f},
-std::array<float,2>{0.313535541f, 0.107497081f},
-std::array<float,2>{0.614560008f, 0.889858663f},
-std::array<float,2>{0.078186579f, 0.663553298f},
-std::array<float,2>{0.859215617f, 0.26374492f},
-std::array<float,2>{0.434130311f, 0.348324776f},
-std::array<float,2>{0.725117207f, 0.708473146f},
-std::array<float,2>{0.163247243f, 0.974477351f},
-std::array<float,2>{0.91334784f, 0.0581510216f},
-std::array<float,2>{0.0591598526f, 0.232254416f},
-std::array<float,2>{0.773655713f, 0.782171249f},
-std::array<float,2>{0.293999076f, 0.523860633f},
-std::array<float,2>{0.515192151f, 0.468285859f},
-std::array<float,2>{0.108220503f, 0.281311452f},
-std::array<float,2>{0.816579163f, 0.650368214f},
-std::array<float,2>{0.346440375f, 0.918305695f},
-std::array<float,2>{0.581259549f, 0.0690412819f},
-std::array<float,2>{0.495670557f, 0.151642099f},
-std::array<float,2>{0.660407424f, 0.860603988f},
-std::array<float,2>{0.248688132f, 0.624930918f},
-std::array<float,2>{0.961655438f, 0.377749681f},
-std::array<float,2>{0.254162401f, 0.492413521f},
-std::array<float,2>{0.532689512f, 0.562157691f},
-std::array<float,2>{0.00269770063f, 0.76124692f},
-std::array<float,2>{0.788838923f, 0.19629626f},
-std::array<float,2>{0.130592272f, 0.00319759524f},
-std::array<float,2>{0.887849092f, 0.963803172f},
-std::array<float,2>{0.376723856f, 0.740375459f},
-std::array<float,2>{0.694523513f, 0.324399084f},
-std::array<float,2>{0.240544125f, 0.253180265f},
-std::array<float,2>{0.958611429f, 0.66976589f},
-std::array<float,2>{0.486365944f, 0.877506673f},
-std::array<float,2>{0.665790021f, 0.0981113911f},
-std::array<float,2>{0.351635456f, 0.183067545f},
-std::array<float,2>{0.591829836f, 0.812713861f},
-std::array<float,2>{0.099288635f, 0.587079883f},
-std::array<float,2>{0.824954093f, 0.431526214f},
-std::array<float,2>{0.388482749f, 0.458771944f},
-std::array<float,2>{0.696190953f, 0.52027446f},
-std::array<float,2>{0.13500984f, 0.792105913f},
-std::array<float,2>{0.881259501f, 0.220812961f},
-std::array<float,2>{0.0104089417f, 0.0487127639f},
-std::array<float,2>{0.78940326f, 0.983774245f},
-std::array<float,2>{0.261430442f, 0.71218878f},
-std::array<float,2>{0.540098667f, 0.356227964f},
-std::array<float,2>{0.0929527581f, 0.389998198f},
-std::array<float,2>{0.847618878f, 0.614265561f},
-std::array<float,2>{0.325469643f, 0.871444404f},
-std::array<float,2>{0.620695889f, 0.146165714f},
-std::array<float,2>{0.449975699f, 0.0717365891f},
-std::array<float,2>{0.632719994f, 0.908718526f},
-std::array<float,2>{0.208348319f, 0.645929933f},
-std::array<float,2>{0.983424902f, 0.291703969f},
-std::array<float,2>{0.287255734f, 0.316357404f},
-std::array<float,2>{0.50032109f, 0.747377694f},
-std::array<float,2>{0.0503369421f, 0.954700053f},
-std::array<float,2>{0.766606152f, 0.0149103431f},
-std::array<float,2>{0.16948548f, 0.192549929f},
-std::array<float,2>{0.919463038f, 0.750135005f},
-std::array<float,2>{0.427431822f, 0.54913348f},
-std::array<float,2>{0.733256936f, 0.492107391f},
-std::array<float,2>{0.149381965f, 0.470888317f},
-std::array<float,2>{0.899464369f, 0.545858443f},
-std::array<float,2>{0.404563487f, 0.766974866f},
-std::array<float,2>{0.717889905f, 0.203469113f},
-std::array<float,2>{0.271199971f, 0.0196972955f},
-std::array<float,2>{0.554204226f, 0.950147629f},
-std::array<float,2>{0.021816615f, 0.729542911f},
-std::array<float,2>{0.798204541f, 0.342813462f},
-std::array<float,2>{0.482796311f, 0.31135866f},
-std::array<float,2>{0.675948441f, 0.640225291f},
-std::array<float,2>{0.227081582f, 0.934935033f},
-std::array<float,2>{0.949335992f, 0.0937332287f},
-std::array<float,2>{0.120110072f, 0.1348892f},
-std::array<float,2>{0.841359913f, 0.855931044f},
-std::array<float,2>{0.366256654f, 0.60338074f},
-std::array<float,2>{0.563778222f, 0.400858283f},
-std::array<float,2>{0.0456521884f, 0.365436912f},
-std::array<float,2>{0.761712492f, 0.695528567f},
-std::array<float,2>{0.312071025f, 0.990996003f},
-std::array<float,2>{0.525026739f, 0.0334930196f},
-std::array<float,2>{0.41693902f, 0.238201603f},
-std::array<float,2>{0.747110009f, 0.800536335f},
-std::array<float,2>{0.185933754f, 0.51378113f},
-std::array<float,2>{0.927498102f, 0.450468421f},
-std::array<float,2>{0.332790673f, 0.410563618f},
-std::array<float,2>{0.598506272f, 0.567301214f},
-std::array<float,2>{0.068829827f, 0.828457117f},
-std::array<float,2>{0.867170095f, 0.168069974f},
-std::array<float,2>{0.190443292f, 0.115341842f},
-std::array<float,2>{0.984568477f, 0.898112655f},
-std::array<float,2>{0.468645424f, 0.679581344f},
-std::array<float,2>{0.649717033f, 0.268773675f},
-std::array<float,2>{0.183519319f, 0.28901428f},
-std::array<float,2>{0.925220788f, 0.655536532f},
-std::array<float,2>{0.421652615f, 0.916199207f},
-std::array<float,2>{0.74271071f, 0.0630459115f},
-std::array<float,2>{0.305965871f, 0.155443266f},
-std::array<float,2>{0.528237522f, 0.864126563f},
-std::array<float,2>{0.0429602936f, 0.617251992f},
-std::array<float,2>{0.763504922f, 0.380730927f},
-std::array<float,2>{0.461446136f, 0.498262286f},
-std::array<float,2>{0.652934015f, 0.558381081f},
-std::array<float,2>{0.192543194f, 0.764975429f},
-std::array<float,2>{0.991252601f, 0.201641291f},
-std::array<float,2>{0.0644949675f, 0.00532802334f},
-std::array<float,2>{0.860325694f, 0.96667403f},
-std::array<float,2>{0.330980986f, 0.734534681f},
-std::array<float,2>{0.595008314f, 0.322225809f},
-std::array<float,2>{0.0175703447f, 0.423983634f},
-std::array<float,2>{0.804546416f, 0.582652152f},
-std::array<float,2>{0.268403858f, 0.821747959f},
-std::array<float,2>{0.54894501f, 0.17398791f},
-std::array<float,2>{0.401984513f, 0.102679014f},
-std::array<float,2>{0.713594615f, 0.885643601f},
-std::array<float,2>{0.152718186f, 0.65672183f},
-std::array<float,2>{0.905118227f, 0.261195272f},
-std::array<float,2>{0.359388977f, 0.34462741f},
-std::array<float,2>{0.569284379f, 0.706439674f},
-std::array<float,2>{0.122807592f, 0.972244024f},
-std::array<float,2>{0.837260604f, 0.0610074289f},
-std::array<float,2>{0.232159451f, 0.228625908f},
-std::array<float,2>{0.947915077f, 0.788928568f},
-std::array<float,2>{0.476730317f, 0.530354202f},
-std::array<float,2>{0.672339439f, 0.462142855f},
-std::array<float,2>{0.204549581f, 0.437678218f},
-std::array<float,2>{0.976602137f, 0.503045797f},
-std::array<float,2>{0.446053207f, 0.808228254f},
-std::array<float,2>{0.62695682f, 0.245116696f},
-std::array<float,2>{0.320402682f, 0.0430144407f},
-std::array<float,2>{0.622602105f, 0.994820297f},
-std::array<float,2>{0.088116616f, 0.688924372f},
-std::array<float,2>{0.848730981f, 0.368953079f},
-std::array<float,2>{0.425282896f, 0.274722606f},
-std::array<float,2>{0.729028761f, 0.684413791f},
-std::array<float,2>{0.167024925f, 0.89928627f},
-std::array<float,2>{0.91736269f, 0.124184728f},
-std::array<float,2>{0.0540841222f, 0.162092596f},
-std::array<float,2>{0.773080051f, 0.841847777f},
-std::array<float,2>{0.283551008f, 0.573306501f},
-std::array<float,2>{0.505220771f, 0.416475207f},
-std::array<float,2>{0.0939352363f, 0.331257015f},
-std::array<float,2>{0.823598981f, 0.725957453f},
-std::array<float,2>{0.359042227f, 0.945005476f},
-std::array<float,2>{0.588150203f, 0.0263963882f},
-std::array<float,2>{0.491400331f, 0.214962199f},
-std::array<float,2>{0.668554187f, 0.779737294f},
-std::array<float,2>{0.238081947f, 0.53694433f},
-std::array<float,2>{0.953180015f, 0.480831236f},
-std::array<float,2>{0.264885455f, 0.394198924f},
-std::array<float,2>{0.543677032f, 0.594510913f},
-std::array<float,2>{0.0133143524f, 0.846396089f},
-std::array<float,2>{0.793655097f, 0.127605185f},
-std::array<float,2>{0.136732951f, 0.0833857879f},
-std::array<float,2>{0.878738463f, 0.927293003f},
-std::array<float,2>{0.385488987f, 0.632666945f},
-std::array<float,2>{0.700332403f, 0.299578995f},
-std::array<float,2>{0.244783059f, 0.361180246f},
-std::array<float,2>{0.965172768f, 0.70085752f},
-std::array<float,2>{0.498420417f, 0.985067904f},
-std::array<float,2>{0.659343243f, 0.0373325534f},
-std::array<float,2>{0.349171251f, 0.238394707f},
-std::array<float,2>{0.583631814f, 0.801013887f},
-std::array<float,2>{0.10501501f, 0.508399487f},
-std::array<float,2>{0.813185692f, 0.448839217f},
-std::array<float,2>{0.382357091f, 0.408244133f},
-std::array<float,2>{0.68922174f, 0.565384328f},
-std::array<float,2>{0.126914069f, 0.832767308f},
-std::array<float,2>{0.884428501f, 0.164693296f},
-std::array<float,2>{0.00400366075f, 0.109393097f},
-std::array<float,2>{0.78431505f, 0.893295944f},
-std::array<float,2>{0.25324291f, 0.675415933f},
-std::array<float,2>{0.538349152f, 0.27283445f},
-std::array<float,2>{0.0827366635f, 0.475363553f},
-std::array<float,2>{0.853728175f, 0.541791856f},
-std::array<float,2>{0.316648632f, 0.772354364f},
-std::array<float,2>{0.611941218f, 0.210401922f},
-std::array<float,2>{0.438952565f, 0.0171078108f},
-std::array<float,2>{0.634301901f, 0.945396602f},
-std::array<float,2>{0.212613627f, 0.73093307f},
-std::array<float,2>{0.973273277f, 0.337516993f},
-std::array<float,2>{0.292901903f, 0.30646497f},
-std::array<float,2>{0.51041913f, 0.633336723f},
-std::array<float,2>{0.0575319901f, 0.931326747f},
-std::array<float,2>{0.779897392f, 0.0859600306f},
-std::array<float,2>{0.156781167f, 0.137928262f},
-std::array<float,2>{0.909678519f, 0.852619708f},
-std::array<float,2>{0.431117922f, 0.607262611f},
-std::array<float,2>{0.719025075f, 0.403130651f},
-std::array<float,2>{0.143082142f, 0.383887887f},
-std::array<float,2>{0.890817285f, 0.611355901f},
-std::array<float,2>{0.393047541f, 0.869536519f},
-std::array<float,2>{0.708066523f, 0.141253695f},
-std::array<float,2>{0.274824351f, 0.0757550672f},
-std::array<float,2>{0.554757237f, 0.91058135f},
-std::array<float,2>{0.0283411331f, 0.644510925f},
-std::array<float,2>{0.810478628f, 0.294552475f},
-std::array<float,2>{0.469287336f, 0.316677719f},
-std::array<float,2>{0.682752252f, 0.743662f},
-std::array<float,2>{0.224384561f, 0.958956182f},
-std::array<float,2>{0.943829298f, 0.00984156877f},
-std::array<float,2>{0.116866522f, 0.187969431f},
-std::array<float,2>{0.828620136f, 0.75689733f},
-std::array<float,2>{0.372207642f, 0.552381992f},
-std::array<float,2>{0.574001789f, 0.488002032f},
-std::array<float,2>{0.0385320596f, 0.256173134f},
-std::array<float,2>{0.755810201f, 0.667283356f},
-std::array<float,2>{0.303355396f, 0.879233658f},
-std::array<float,2>{0.516851604f, 0.0951502547f},
-std::array<float,2>{0.411807716f, 0.187138364f},
-std::array<float,2>{0.740016699f, 0.819439888f},
-std::array<float,2>{0.179274708f, 0.592298925f},
-std::array<float,2>{0.934689939f, 0.434681773f},
-std::array<float,2>{0.337016612f, 0.453504592f},
-std::array<float,2>{0.601846039f, 0.517129958f},
-std::array<float,2>{0.071575895f, 0.796819448f},
-std::array<float,2>{0.867283642f, 0.224948779f},
-std::array<float,2>{0.201642111f, 0.0538919233f},
-std::array<float,2>{0.99659729f, 0.978925526f},
-std::array<float,2>{0.459205896f, 0.716055632f},
-std::array<float,2>{0.641471088f, 0.352890879f},
-std::array<float,2>{0.131173f, 0.325788915f},
-std::array<float,2>{0.889096379f, 0.741743624f},
-std::array<float,2>{0.378869891f, 0.964348197f},
-std::array<float,2>{0.692660511f, 0.0026736022f},
-std::array<float,2>{0.257343084f, 0.196085438f},
-std::array<float,2>{0.534555435f, 0.760071933f},
-std::array<float,2>{0.00128601608f, 0.56136924f},
-std::array<float,2>{0.7862221f, 0.493790209f},
-std::array<float,2>{0.493622035f, 0.378738344f},
-std::array<float,2>{0.663553894f, 0.623557508f},
-std::array<float,2>{0.247348785f, 0.860114098f},
-std::array<float,2>{0.963147521f, 0.151271105f},
-std::array<float,2>{0.106911518f, 0.0694703609f},
-std::array<float,2>{0.818905473f, 0.919815004f},
-std::array<float,2>{0.343763262f, 0.649208188f},
-std::array<float,2>{0.579211712f, 0.282962352f},
-std::array<float,2>{0.0605513938f, 0.467192143f},
-std::array<float,2>{0.776829839f, 0.52502948f},
-std::array<float,2>{0.295889825f, 0.782485187f},
-std::array<float,2>{0.513472497f, 0.231067628f},
-std::array<float,2>{0.437432528f, 0.0570717342f},
-std::array<float,2>{0.722749054f, 0.973535776f},
-std::array<float,2>{0.161763996f, 0.707400084f},
-std::array<float,2>{0.910311282f, 0.349568933f},
-std::array<float,2>{0.316330373f, 0.264862508f},
-std::array<float,2>{0.615685999f, 0.663047731f},
-std::array<float,2>{0.0819040239f, 0.889406323f},
-std::array<float,2>{0.855558455f, 0.108589284f},
-std::array<float,2>{0.218468696f, 0.176827878f},
-std::array<float,2>{0.971087813f, 0.827928364f},
-std::array<float,2>{0.444780886f, 0.579890132f},
-std::array<float,2>{0.638452053f, 0.428519785f},
-std::array<float,2>{0.219461814f, 0.420001179f},
-std::array<float,2>{0.93754065f, 0.577791214f},
-std::array<float,2>{0.475666344f, 0.836583436f},
-std::array<float,2>{0.685091317f, 0.158339471f},
-std::array<float,2>{0.367343336f, 0.120380342f},
-std::array<float,2>{0.577725351f, 0.903350115f},
-std::array<float,2>{0.113279417f, 0.681979477f},
-std::array<float,2>{0.833530426f, 0.277800322f},
-std::array<float,2>{0.395063609f, 0.374646693f},
-std::array<float,2>{0.70421046f, 0.692596316f},
-std::array<float,2>{0.146234289f, 0.998662293f},
-std::array<float,2>{0.897033632f, 0.0399876498f},
-std::array<float,2>{0.023883719f, 0.248769149f},
-std::array<float,2>{0.807610273f, 0.811270654f},
-std::array<float,2>{0.279477388f, 0.506599665f},
-std::array<float,2>{0.560927331f, 0.44354409f},
-std::array<float,2>{0.0764935315f, 0.303015292f},
-std::array<float,2>{0.874805629f, 0.626165032f},
-std::array<float,2>{0.341527015f, 0.923605025f},
-std::array<float,2>{0.608884573f, 0.0794823542f},
-std::array<float,2>{0.455441236f, 0.130950272f},
-std::array<float,2>{0.646608055f, 0.847843766f},
-std::array<float,2>{0.197009489f, 0.599747658f},
-std::array<float,2>{0.993329465f, 0.396184832f},
-std::array<float,2>{0.297279805f, 0.480017871f},
-std::array<float,2>{0.520198703f, 0.534813941f},
-std::array<float,2>{0.0348671526f, 0.77641803f},
-std::array<float,2>{0.7508533f, 0.211376742f},
-std::array<float,2>{0.175718546f, 0.0276135784f},
-std::array<float,2>{0.932977378f, 0.941056967f},
-std::array<float,2>{0.407045901f, 0.720918477f},
-std::array<float,2>{0.737658203f, 0.335601628f},
-std::array<float,2>{0.188409105f, 0.267722428f},
-std::array<float,2>{0.987864494f, 0.677946806f},
-std::array<float,2>{0.465582192f, 0.8967852f},
-std::array<float,2>{0.652329504f, 0.117045909f},
-std::array<float,2>{0.335002422f, 0.169894904f},
-std::array<float,2>{0.601211905f, 0.829331756f},
-std::array<float,2>{0.0665318519f, 0.567981005f},
-std::array<float,2>{0.863851964f, 0.411648393f},
-std::array<float,2>{0.415813237f, 0.449798942f},
-std::array<float,2>{0.748540461f, 0.515569568f},
-std::array<float,2>{0.185017034f, 0.799002528f},
-std::array<float,2>{0.928902864f, 0.237303048f},
-std::array<float,2>{0.0446731187f, 0.0351157188f},
-std::array<float,2>{0.757934391f, 0.991637051f},
-std::array<float,2>{0.308844477f, 0.696343482f},
-std::array<float,2>{0.525592148f, 0.366313636f},
-std::array<float,2>{0.118390642f, 0.401387364f},
-std::array<float,2>{0.843132198f, 0.602296293f},
-std::array<float,2>{0.363867253f, 0.856656075f},
-std::array<float,2>{0.565613329f, 0.136510015f},
-std::array<float,2>{0.481489807f, 0.092005752f},
-std::array<float,2>{0.679540277f, 0.933808506f},
-std::array<float,2>{0.229793072f, 0.639528871f},
-std::array<float,2>{0.952303767f, 0.312220782f},
-std::array<float,2>{0.271946579f, 0.342741281f},
-std::array<float,2>{0.551043987f, 0.729027569f},
-std::array<float,2>{0.020831855f, 0.95087719f},
-std::array<float,2>{0.800545216f, 0.0206966419f},
-std::array<float,2>{0.151420593f, 0.204895139f},
-std::array<float,2>{0.900872588f, 0.766440988f},
-std::array<float,2>{0.402423769f, 0.546628892f},
-std::array<float,2>{0.715797365f, 0.472159594f},
-std::array<float,2>{0.170034021f, 0.490743041f},
-std::array<float,2>{0.921551466f, 0.550513208f},
-std::array<float,2>{0.428412288f, 0.751198947f},
-std::array<float,2>{0.731059253f, 0.192235619f},
-std::array<float,2>{0.285678834f, 0.0139667671f},
-std::array<float,2>{0.502890468f, 0.953823686f},
-std::array<float,2>{0.0478924885f, 0.746786058f},
-std::array<float,2>{0.769519329f, 0.314540148f},
-std::array<float,2>{0.45246172f, 0.292541951f},
-std::array<float,2>{0.630081117f, 0.644760787f},
-std::array<float,2>{0.210452572f, 0.909414291f},
-std::array<float,2>{0.981399059f, 0.0709197968f},
-std::array<float,2>{0.0899724066f, 0.145045012f},
-std::array<float,2>{0.845155001f, 0.872833669f},
-std::array<float,2>{0.327356905f, 0.613412321f},
-std::array<float,2>{0.618505239f, 0.389488131f},
-std::array<float,2>{0.00796998478f, 0.356517792f},
-std::array<float,2>{0.792730272f, 0.71146059f},
-std::array<float,2>{0.25836435f, 0.982480109f},
-std::array<float,2>{0.541923046f, 0.0474392474f},
-std::array<float,2>{0.39004162f, 0.222185731f},
-std::array<float,2>{0.697273731f, 0.791766346f},
-std::array<float,2>{0.13385503f, 0.521008074f},
-std::array<float,2>{0.88067311f, 0.457645416f},
-std::array<float,2>{0.354988903f, 0.429781258f},
-std::array<float,2>{0.590522528f, 0.58647567f},
-std::array<float,2>{0.101264983f, 0.814404726f},
-std::array<float,2>{0.827491105f, 0.182392523f},
-std::array<float,2>{0.238309488f, 0.0993519723f},
-std::array<float,2>{0.960505009f, 0.878318131f},
-std::array<float,2>{0.484467059f, 0.668155491f},
-std::array<float,2>{0.666330636f, 0.252567589f},
-std::array<float,2>{0.154474303f, 0.258321166f},
-std::array<float,2>{0.902650714f, 0.659031987f},
-std::array<float,2>{0.399353683f, 0.884587944f},
-std::array<float,2>{0.71257621f, 0.104391001f},
-std::array<float,2>{0.266990125f, 0.173488423f},
-std::array<float,2>{0.547940433f, 0.823238134f},
-std::array<float,2>{0.0192987844f, 0.58432132f},
-std::array<float,2>{0.802559793f, 0.423198402f},
-std::array<float,2>{0.480123669f, 0.463222861f},
-std::array<float,2>{0.674345434f, 0.529286683f},
-std::array<float,2>{0.234322026f, 0.785378873f},
-std::array<float,2>{0.946017623f, 0.226666018f},
-std::array<float,2>{0.123356886f, 0.0601014048f},
-std::array<float,2>{0.838468671f, 0.97047019f},
-std::array<float,2>{0.361650944f, 0.704644561f},
-std::array<float,2>{0.56794852f, 0.345884025f},
-std::array<float,2>{0.0401503332f, 0.382393509f},
-std::array<float,2>{0.76384002f, 0.619352877f},
-std::array<float,2>{0.308106899f, 0.866232812f},
-std::array<float,2>{0.530512214f, 0.153473884f},
-std::array<float,2>{0.418903172f, 0.0655611753f},
-std::array<float,2>{0.744917333f, 0.914427102f},
-std::array<float,2>{0.181050047f, 0.652414203f},
-std::array<float,2>{0.92280221f, 0.285216182f},
-std::array<float,2>{0.328223646f, 0.323963076f},
-std::array<float,2>{0.597382665f, 0.73713547f},
-std::array<float,2>{0.0636262074f, 0.967067778f},
-std::array<float,2>{0.862059355f, 0.00729366578f},
-std::array<float,2>{0.194704548f, 0.200037152f},
-std::array<float,2>{0.9887501f, 0.76330924f},
-std::array<float,2>{0.463616312f, 0.556091249f},
-std::array<float,2>{0.655353785f, 0.496325433f},
-std::array<float,2>{0.235398144f, 0.482554793f},
-std::array<float,2>{0.955503404f, 0.539042413f},
-std::array<float,2>{0.488937587f, 0.778494298f},
-std::array<float,2>{0.671395719f, 0.217302889f},
-std::array<float,2>{0.356223792f, 0.0238512419f},
-std::array<float,2>{0.586803198f, 0.94230783f},
-std::array<float,2>{0.0975484103f, 0.723093629f},
-std::array<float,2>{0.821976066f, 0.329148978f},
-std::array<float,2>{0.383365333f, 0.297207355f},
-std::array<float,2>{0.703006864f, 0.629215777f},
-std::array<float,2>{0.138891757f, 0.928864837f},
-std::array<float,2>{0.876762807f, 0.0846564844f},
-std::array<float,2>{0.0137815708f, 0.125117138f},
-std::array<float,2>{0.795537233f, 0.845287502f},
-std::array<float,2>{0.261985153f, 0.596042752f},
-std::array<float,2>{0.545935094f, 0.391763508f},
-std::array<float,2>{0.0876744017f, 0.37060526f},
-std::array<float,2>{0.849771738f, 0.690791965f},
-std::array<float,2>{0.32393688f, 0.993645191f},
-std::array<float,2>{0.623456895f, 0.0462083891f},
-std::array<float,2>{0.448414773f, 0.242193907f},
-std::array<float,2>{0.626387656f, 0.806433499f},
-std::array<float,2>{0.206021667f, 0.500680387f},
-std::array<float,2>{0.979277551f, 0.440777898f},
-std::array<float,2>{0.282138318f, 0.414838731f},
-std::array<float,2>{0.506112456f, 0.571171761f},
-std::array<float,2>{0.0521972626f, 0.840212882f},
-std::array<float,2>{0.770969093f, 0.163467646f},
-std::array<float,2>{0.165042162f, 0.121793941f},
-std::array<float,2>{0.914934814f, 0.901391625f},
-std::array<float,2>{0.42236945f, 0.686609268f},
-std::array<float,2>{0.727126837f, 0.276468217f},
-std::array<float,2>{0.214834496f, 0.339160353f},
-std::array<float,2>{0.975285411f, 0.733230948f},
-std::array<float,2>{0.440481693f, 0.948809862f},
-std::array<float,2>{0.63632226f, 0.0182317831f},
-std::array<float,2>{0.319574594f, 0.207275495f},
-std::array<float,2>{0.611218274f, 0.770305037f},
-std::array<float,2>{0.0843357071f, 0.539723814f},
-std::array<float,2>{0.853357911f, 0.473376483f},
-std::array<float,2>{0.432530046f, 0.404482573f},
-std::array<float,2>{0.722417116f, 0.608502626f},
-std::array<float,2>{0.159515828f, 0.855009615f},
-std::array<float,2>{0.907336593f, 0.140613198f},
-std::array<float,2>{0.0562392063f, 0.0882406011f},
-std::array<float,2>{0.778015673f, 0.932878911f},
-std::array<float,2>{0.29081589f, 0.636309445f},
-std::array<float,2>{0.507861018f, 0.308498085f},
-std::array<float,2>{0.102108069f, 0.445903629f},
-std::array<float,2>{0.815116644f, 0.511361599f},
-std::array<float,2>{0.350631505f, 0.803691924f},
-std::array<float,2>{0.585836947f, 0.241048619f},
-std::array<float,2>{0.49642995f, 0.0367064588f},
-std::array<float,2>{0.656389177f, 0.987525523f},
-std::array<float,2>{0.244006038f, 0.702098608f},
-std::array<float,2>{0.968300402f, 0.363270074f},
-std::array<float,2>{0.251033008f, 0.270830125f},
-std::array<float,2>{0.536245048f, 0.672112525f},
-std::array<float,2>{0.00626716763f, 0.891113877f},
-std::array<float,2>{0.781453729f, 0.113237515f},
-std::array<float,2>{0.127408624f, 0.167356342f},
-std::array<float,2>{0.886202693f, 0.834452689f},
-std::array<float,2>{0.380409569f, 0.564400971f},
-std::array<float,2>{0.689822316f, 0.407881558f},
-std::array<float,2>{0.17665118f, 0.437434524f},
-std::array<float,2>{0.936795115f, 0.591622233f},
-std::array<float,2>{0.412774205f, 0.818222106f},
-std::array<float,2>{0.741159201f, 0.183990434f},
-std::array<float,2>{0.302506447f, 0.0975737199f},
-std::array<float,2>{0.519071221f, 0.881648302f},
-std::array<float,2>{0.0357069448f, 0.665846944f},
-std::array<float,2>{0.757666051f, 0.254608512f},
-std::array<float,2>{0.458571285f, 0.355150372f},
-std::array<float,2>{0.644429147f, 0.716853499f},
-std::array<float,2>{0.199993268f, 0.978054643f},
-std::array<float,2>{0.999020278f, 0.052657824f},
-std::array<float,2>{0.0724143311f, 0.222695157f},
-std::array<float,2>{0.869254649f, 0.794155538f},
-std::array<float,2>{0.338985145f, 0.518182456f},
-std::array<float,2>{0.603726208f, 0.456065059f},
-std::array<float,2>{0.0299469139f, 0.295906693f},
-std::array<float,2>{0.812451959f, 0.641830862f},
-std::array<float,2>{0.277128816f, 0.91268158f},
-std::array<float,2>{0.558078289f, 0.0773226246f},
-std::array<float,2>{0.392536402f, 0.14322187f},
-std::array<float,2>{0.709199786f, 0.869094133f},
-std::array<float,2>{0.141214073f, 0.610522926f},
-std::array<float,2>{0.892618954f, 0.386660486f},
-std::array<float,2>{0.374443412f, 0.485205889f},
-std::array<float,2>{0.571514487f, 0.553812981f},
-std::array<float,2>{0.11360535f, 0.75423789f},
-std::array<float,2>{0.831631124f, 0.190414578f},
-std::array<float,2>{0.225173905f, 0.00953153335f},
-std::array<float,2>{0.943288803f, 0.959611952f},
-std::array<float,2>{0.472438097f, 0.745403528f},
-std::array<float,2>{0.681179583f, 0.319854707f},
-std::array<float,2>{0.16231285f, 0.350354403f},
-std::array<float,2>{0.913055897f, 0.710900962f},
-std::array<float,2>{0.43512255f, 0.976408005f},
-std::array<float,2>{0.726550519f, 0.0558399633f},
-std::array<float,2>{0.293163657f, 0.233609617f},
-std::array<float,2>{0.513783991f, 0.78394264f},
-std::array<float,2>{0.0604609922f, 0.526342154f},
-std::array<float,2>{0.775035799f, 0.466789722f},
-std::array<float,2>{0.442882866f, 0.425978214f},
-std::array<float,2>{0.640541375f, 0.580525517f},
-std::array<float,2>{0.216606975f, 0.824245691f},
-std::array<float,2>{0.969954431f, 0.178100169f},
-std::array<float,2>{0.0796070695f, 0.10621278f},
-std::array<float,2>{0.857997417f, 0.888467014f},
-std::array<float,2>{0.313166469f, 0.660362124f},
-std::array<float,2>{0.613916278f, 0.262446463f},
-std::array<float,2>{0.00337092439f, 0.495150477f},
-std::array<float,2>{0.787609339f, 0.559037507f},
-std::array<float,2>{0.255551726f, 0.757898688f},
-std::array<float,2>{0.532212555f, 0.197468475f},
-std::array<float,2>{0.375374168f, 0.00068591442f},
-std::array<float,2>{0.693925917f, 0.961670578f},
-std::array<float,2>{0.129257396f, 0.738591552f},
-std::array<float,2>{0.887370169f, 0.326547831f},
-std::array<float,2>{0.34697324f, 0.283880353f},
-std::array<float,2>{0.580730498f, 0.651300132f},
-std::array<float,2>{0.108484156f, 0.920153618f},
-std::array<float,2>{0.817542255f, 0.067722708f},
-std::array<float,2>{0.249372318f, 0.149377331f},
-std::array<float,2>{0.962732673f, 0.862789989f},
-std::array<float,2>{0.494496286f, 0.621362686f},
-std::array<float,2>{0.662012398f, 0.375601411f},
-std::array<float,2>{0.197951481f, 0.396650881f},
-std::array<float,2>{0.995068789f, 0.597871661f},
-std::array<float,2>{0.454815596f, 0.851451695f},
-std::array<float,2>{0.645819962f, 0.129288137f},
-std::array<float,2>{0.343588978f, 0.081662178f},
-std::array<float,2>{0.605902672f, 0.924057484f},
-std::array<float,2>{0.075614877f, 0.628668249f},
-std::array<float,2>{0.871197343f, 0.301476687f},
-std::array<float,2>{0.408982217f, 0.333687335f},
-std::array<float,2>{0.735604346f, 0.719523191f},
-std::array<float,2>{0.17336005f, 0.937838733f},
-std::array<float,2>{0.930772543f, 0.0304862522f},
-std::array<float,2>{0.0315039977f, 0.214241847f},
-std::array<float,2>{0.752539456f, 0.773950279f},
-std::array<float,2>{0.29975152f, 0.532553017f},
-std::array<float,2>{0.522092462f, 0.477926105f},
-std::array<float,2>{0.109705158f, 0.280130386f},
-std::array<float,2>{0.835904837f, 0.679936945f},
-std::array<float,2>{0.370698988f, 0.905237615f},
-std::array<float,2>{0.575630665f, 0.118815951f},
-std::array<float,2>{0.474229544f, 0.15700303f},
-std::array<float,2>{0.685757816f, 0.838048995f},
-std::array<float,2>{0.220819533f, 0.574961126f},
-std::array<float,2>{0.940658331f, 0.418522835f},
-std::array<float,2>{0.278198838f, 0.441991597f},
-std::array<float,2>{0.559544921f, 0.503995657f},
-std::array<float,2>{0.026301587f, 0.808823943f},
-std::array<float,2>{0.806133687f, 0.246704578f},
-std::array<float,2>{0.147107482f, 0.0418487713f},
-std::array<float,2>{0.895338893f, 0.99691242f},
-std::array<float,2>{0.397953123f, 0.694447279f},
-std::array<float,2>{0.705269456f, 0.372067094f},
-std::array<float,2>{0.228254676f, 0.310214102f},
-std::array<float,2>{0.950724185f, 0.637971461f},
-std::array<float,2>{0.483542383f, 0.936909139f},
-std::array<float,2>{0.677196443f, 0.0903630257f},
-std::array<float,2>{0.365905017f, 0.133509532f},
-std::array<float,2>{0.562792242f, 0.859135449f},
-std::array<float,2>{0.120734565f, 0.604572177f},
-std::array<float,2>{0.840643048f, 0.400385052f},
-std::array<float,2>{0.406152099f, 0.4697133f},
-std::array<float,2>{0.717736185f, 0.544083476f},
-std::array<float,2>{0.150044799f, 0.767935574f},
-std::array<float,2>{0.899284363f, 0.206592396f},
-std::array<float,2>{0.0229631849f, 0.0224631708f},
-std::array<float,2>{0.797330558f, 0.95301199f},
-std::array<float,2>{0.269598842f, 0.728250206f},
-std::array<float,2>{0.553638816f, 0.341335148f},
-std::array<float,2>{0.0697398409f, 0.413778752f},
-std::array<float,2>{0.865360796f, 0.570230007f},
-std::array<float,2>{0.333163172f, 0.830918014f},
-std::array<float,2>{0.599333167f, 0.170822859f},
-std::array<float,2>{0.467008322f, 0.114300624f},
-std::array<float,2>{0.649051845f, 0.895784557f},
-std::array<float,2>{0.189682677f, 0.676532626f},
-std::array<float,2>{0.985976815f, 0.267411917f},
-std::array<float,2>{0.311189234f, 0.364556879f},
-std::array<float,2>{0.524252534f, 0.698789299f},
-std::array<float,2>{0.0463453606f, 0.988464057f},
-std::array<float,2>{0.76065892f, 0.0330817029f},
-std::array<float,2>{0.18717809f, 0.235243365f},
-std::array<float,2>{0.926047862f, 0.797563672f},
-std::array<float,2>{0.417071193f, 0.512354612f},
-std::array<float,2>{0.746415794f, 0.451943815f},
-std::array<float,2>{0.136205703f, 0.460350215f},
-std::array<float,2>{0.881935954f, 0.522464395f},
-std::array<float,2>{0.386791706f, 0.789922774f},
-std::array<float,2>{0.696473658f, 0.219040111f},
-std::array<float,2>{0.25976637f, 0.0505504608f},
-std::array<float,2>{0.539409518f, 0.980685592f},
-std::array<float,2>{0.0111577772f, 0.713526249f},
-std::array<float,2>{0.790541232f, 0.359319746f},
-std::array<float,2>{0.487759143f, 0.251316756f},
-std::array<float,2>{0.66415894f, 0.669999838f},
-std::array<float,2>{0.241932824f, 0.875122488f},
-std::array<float,2>{0.957044482f, 0.100381933f},
-std::array<float,2>{0.0977009982f, 0.180995673f},
-std::array<float,2>{0.825562775f, 0.816352963f},
-std::array<float,2>{0.35255757f, 0.588744402f},
-std::array<float,2>{0.592980146f, 0.433098853f},
-std::array<float,2>{0.0495887548f, 0.313244313f},
-std::array<float,2>{0.766190469f, 0.748875022f},
-std::array<float,2>{0.288792998f, 0.955324233f},
-std::array<float,2>{0.501057208f, 0.0123112993f},
-std::array<float,2>{0.426737159f, 0.193464264f},
-std::array<float,2>{0.733987749f, 0.753609061f},
-std::array<float,2>{0.16836226f, 0.547615469f},
-std::array<float,2>{0.918305039f, 0.489242822f},
-std::array<float,2>{0.324477702f, 0.388583571f},
-std::array<float,2>{0.620060503f, 0.617092371f},
-std::array<float,2>{0.0924062431f, 0.874435306f},
-std::array<float,2>{0.846132934f, 0.146615848f},
-std::array<float,2>{0.207845271f, 0.0725991651f},
-std::array<float,2>{0.983372509f, 0.906939209f},
-std::array<float,2>{0.450636387f, 0.647607267f},
-std::array<float,2>{0.630936742f, 0.289572269f},
-std::array<float,2>{0.179147169f, 0.254257619f},
-std::array<float,2>{0.935271204f, 0.665106356f},
-std::array<float,2>{0.411138594f, 0.881021619f},
-std::array<float,2>{0.739644468f, 0.0968311131f},
-std::array<float,2>{0.303214341f, 0.184212029f},
-std::array<float,2>{0.517418325f, 0.817669332f},
-std::array<float,2>{0.0386034511f, 0.590982199f},
-std::array<float,2>{0.755289853f, 0.436666608f},
-std::array<float,2>{0.459908247f, 0.456852406f},
-std::array<float,2>{0.640638888f, 0.517889321f},
-std::array<float,2>{0.201917484f, 0.79446131f},
-std::array<float,2>{0.996350825f, 0.223176852f},
-std::array<float,2>{0.0720856488f, 0.0518476553f},
-std::array<float,2>{0.867896736f, 0.978022933f},
-std::array<float,2>{0.337491006f, 0.717385292f},
-std::array<float,2>{0.60212481f, 0.354735345f},
-std::array<float,2>{0.0288999975f, 0.385966659f},
-std::array<float,2>{0.809940279f, 0.610851169f},
-std::array<float,2>{0.27529332f, 0.868543863f},
-std::array<float,2>{0.555189013f, 0.142975792f},
-std::array<float,2>{0.393149376f, 0.0779796541f},
-std::array<float,2>{0.708838463f, 0.912457228f},
-std::array<float,2>{0.143027157f, 0.642455876f},
-std::array<float,2>{0.891393006f, 0.296662301f},
-std::array<float,2>{0.373011827f, 0.319583923f},
-std::array<float,2>{0.573722541f, 0.745646119f},
-std::array<float,2>{0.116556078f, 0.959228218f},
-std::array<float,2>{0.82850188f, 0.00911678374f},
-std::array<float,2>{0.223825037f, 0.189711034f},
-std::array<float,2>{0.943850696f, 0.754575491f},
-std::array<float,2>{0.468955517f, 0.554641783f},
-std::array<float,2>{0.683201432f, 0.484741151f},
-std::array<float,2>{0.212071985f, 0.473069847f},
-std::array<float,2>{0.972868919f, 0.5395208f},
-std::array<float,2>{0.439378679f, 0.769823551f},
-std::array<float,2>{0.634195626f, 0.207720309f},
-std::array<float,2>{0.317223519f, 0.017798664f},
-std::array<float,2>{0.611410677f, 0.948409736f},
-std::array<float,2>{0.0824451745f, 0.732631028f},
-std::array<float,2>{0.85405767f, 0.339711517f},
-std::array<float,2>{0.431179434f, 0.308096796f},
-std::array<float,2>{0.719239771f, 0.635845065f},
-std::array<float,2>{0.156549856f, 0.933159232f},
-std::array<float,2>{0.909358501f, 0.0888273269f},
-std::array<float,2>{0.0568909496f, 0.139972195f},
-std::array<float,2>{0.779474914f, 0.854512393f},
-std::array<float,2>{0.292469412f, 0.609008908f},
-std::array<float,2>{0.510028005f, 0.404952049f},
-std::array<float,2>{0.104727112f, 0.362496644f},
-std::array<float,2>{0.812810004f, 0.701215208f},
-std::array<float,2>{0.348716438f, 0.988186657f},
-std::array<float,2>{0.583175659f, 0.0361833014f},
-std::array<float,2>{0.498648494f, 0.240359649f},
-std::array<float,2>{0.660065651f, 0.802802801f},
-std::array<float,2>{0.244290933f, 0.510808527f},
-std::array<float,2>{0.965538681f, 0.445590436f},
-std::array<float,2>{0.253489465f, 0.407386631f},
-std::array<float,2>{0.538698137f, 0.563528359f},
-std::array<float,2>{0.00486731157f, 0.834835231f},
-std::array<float,2>{0.784856796f, 0.167883515f},
-std::array<float,2>{0.126129627f, 0.112334639f},
-std::array<float,2>{0.883868337f, 0.890872717f},
-std::array<float,2>{0.382109851f, 0.672531784f},
-std::array<float,2>{0.688815475f, 0.271220237f},
-std::array<float,2>{0.237550214f, 0.329730093f},
-std::array<float,2>{0.953704596f, 0.723556876f},
-std::array<float,2>{0.492003262f, 0.941595614f},
-std::array<float,2>{0.668296993f, 0.0240469072f},
-std::array<float,2>{0.358772635f, 0.216912404f},
-std::array<float,2>{0.588653564f, 0.779026687f},
-std::array<float,2>{0.0947139561f, 0.538553417f},
-std::array<float,2>{0.824103534f, 0.483021319f},
-std::array<float,2>{0.385050565f, 0.392319977f},
-std::array<float,2>{0.701035559f, 0.596422076f},
-std::array<float,2>{0.137659535f, 0.84517628f},
-std::array<float,2>{0.878066659f, 0.125497654f},
-std::array<float,2>{0.0129963988f, 0.0839878768f},
-std::array<float,2>{0.79334414f, 0.929607332f},
-std::array<float,2>{0.265624672f, 0.629707992f},
-std::array<float,2>{0.543400168f, 0.297692418f},
-std::array<float,2>{0.0888069496f, 0.44132781f},
-std::array<float,2>{0.849464178f, 0.500098646f},
-std::array<float,2>{0.321151078f, 0.805902779f},
-std::array<float,2>{0.622517169f, 0.243032694f},
-std::array<float,2>{0.44551155f, 0.0466157384f},
-std::array<float,2>{0.627548397f, 0.994114518f},
-std::array<float,2>{0.204849333f, 0.690936446f},
-std::array<float,2>{0.977310658f, 0.371046841f},
-std::array<float,2>{0.283793867f, 0.27688089f},
-std::array<float,2>{0.505733669f, 0.68749553f},
-std::array<float,2>{0.0542318262f, 0.901899397f},
-std::array<float,2>{0.772735417f, 0.12141224f},
-std::array<float,2>{0.167583436f, 0.163651466f},
-std::array<float,2>{0.917717338f, 0.840414166f},
-std::array<float,2>{0.425364226f, 0.570367992f},
-std::array<float,2>{0.72900176f, 0.414417714f},
-std::array<float,2>{0.153122708f, 0.423688024f},
-std::array<float,2>{0.904468775f, 0.584935308f},
-std::array<float,2>{0.401407033f, 0.822424829f},
-std::array<float,2>{0.713040352f, 0.173001125f},
-std::array<float,2>{0.267707288f, 0.103668354f},
-std::array<float,2>{0.549681544f, 0.883872032f},
-std::array<float,2>{0.0168018676f, 0.658243954f},
-std::array<float,2>{0.803931475f, 0.257876128f},
-std::array<float,2>{0.477119148f, 0.346380562f},
-std::array<float,2>{0.672711611f, 0.70423764f},
-std::array<float,2>{0.231734335f, 0.969882488f},
-std::array<float,2>{0.94750458f, 0.0599524863f},
-std::array<float,2>{0.122098051f, 0.227161989f},
-std::array<float,2>{0.837457061f, 0.785742342f},
-std::array<float,2>{0.36004582f, 0.528564394f},
-std::array<float,2>{0.568419516f, 0.46341902f},
-std::array<float,2>{0.0424760617f, 0.285689414f},
-std::array<float,2>{0.763118565f, 0.653259695f},
-std::array<float,2>{0.306218386f, 0.914760113f},
-std::array<float,2>{0.527364552f, 0.0659861714f},
-std::array<float,2>{0.421331227f, 0.154244691f},
-std::array<float,2>{0.742263079f, 0.866860151f},
-std::array<float,2>{0.183011785f, 0.620086133f},
-std::array<float,2>{0.925682962f, 0.382101566f},
-std::array<float,2>{0.330412567f, 0.496832848f},
-std::array<float,2>{0.595435679f, 0.556285024f},
-std::array<float,2>{0.0650800392f, 0.762951076f},
-std::array<float,2>{0.859808624f, 0.199606314f},
-std::array<float,2>{0.193288833f, 0.00778004481f},
-std::array<float,2>{0.992061853f, 0.967758834f},
-std::array<float,2>{0.461391002f, 0.73641789f},
-std::array<float,2>{0.652490377f, 0.323347181f},
-std::array<float,2>{0.13475281f, 0.358765721f},
-std::array<float,2>{0.880050302f, 0.71292299f},
-std::array<float,2>{0.390584588f, 0.981219471f},
-std::array<float,2>{0.698199689f, 0.0499830246f},
-std::array<float,2>{0.258207202f, 0.219406977f},
-std::array<float,2>{0.541324139f, 0.789404452f},
-std::array<float,2>{0.00844420306f, 0.523111403f},
-std::array<float,2>{0.792381108f, 0.460624754f},
-std::array<float,2>{0.485273689f, 0.433399945f},
-std::array<float,2>{0.666634917f, 0.588006318f},
-std::array<float,2>{0.238796011f, 0.815521002f},
-std::array<float,2>{0.960173488f, 0.181283101f},
-std::array<float,2>{0.100796811f, 0.0997473374f},
-std::array<float,2>{0.828076899f, 0.875531256f},
-std::array<float,2>{0.354840696f, 0.670716107f},
-std::array<float,2>{0.590052307f, 0.251547068f},
-std::array<float,2>{0.0483488888f, 0.488644719f},
-std::array<float,2>{0.768949151f, 0.546957135f},
-std::array<float,2>{0.285173297f, 0.753244102f},
-std::array<float,2>{0.502294481f, 0.19399406f},
-std::array<float,2>{0.427792579f, 0.0117467297f},
-std::array<float,2>{0.730685353f, 0.955830812f},
-std::array<float,2>{0.170569822f, 0.748201251f},
-std::array<float,2>{0.920991421f, 0.312973648f},
-std::array<float,2>{0.327950746f, 0.28929615f},
-std::array<float,2>{0.619096875f, 0.647997558f},
-std::array<float,2>{0.0905744061f, 0.906477034f},
-std::array<float,2>{0.845362723f, 0.0728972182f},
-std::array<float,2>{0.209976822f, 0.147201449f},
-std::array<float,2>{0.980585933f, 0.87456882f},
-std::array<float,2>{0.452658504f, 0.616571426f},
-std::array<float,2>{0.630661547f, 0.387878537f},
-std::array<float,2>{0.230287895f, 0.399537951f},
-std::array<float,2>{0.952870607f, 0.605228126f},
-std::array<float,2>{0.482416064f, 0.858614743f},
-std::array<float,2>{0.67896831f, 0.132992163f},
-std::array<float,2>{0.363559633f, 0.0900814459f},
-std::array<float,2>{0.566381276f, 0.93729502f},
-std::array<float,2>{0.118786722f, 0.638203621f},
-std::array<float,2>{0.843465447f, 0.309758812f},
-std::array<float,2>{0.403040171f, 0.341023952f},
-std::array<float,2>{0.71509707f, 0.728005469f},
-std::array<float,2>{0.152158305f, 0.952406764f},
-std::array<float,2>{0.901149035f, 0.0232564602f},
-std::array<float,2>{0.0211707447f, 0.206418291f},
-std::array<float,2>{0.800204992f, 0.768166125f},
-std::array<float,2>{0.272427291f, 0.544627547f},
-std::array<float,2>{0.551594555f, 0.468809992f},
-std::array<float,2>{0.0669853687f, 0.267029881f},
-std::array<float,2>{0.863464653f, 0.67580235f},
-std::array<float,2>{0.335454732f, 0.896081626f},
-std::array<float,2>{0.600666702f, 0.115057573f},
-std::array<float,2>{0.4652493f, 0.170273006f},
-std::array<float,2>{0.651792347f, 0.830265462f},
-std::array<float,2>{0.187533662f, 0.569430411f},
-std::array<float,2>{0.98759371f, 0.413394988f},
-std::array<float,2>{0.309507608f, 0.451184809f},
-std::array<float,2>{0.525979221f, 0.511983812f},
-std::array<float,2>{0.0443865284f, 0.797316074f},
-std::array<float,2>{0.7584185f, 0.234595254f},
-std::array<float,2>{0.185174331f, 0.0322838724f},
-std::array<float,2>{0.929527402f, 0.989189267f},
-std::array<float,2>{0.41513443f, 0.698269367f},
-std::array<float,2>{0.748107612f, 0.365154415f},
-std::array<float,2>{0.196633235f, 0.301171392f},
-std::array<float,2>{0.993795574f, 0.628299057f},
-std::array<float,2>{0.455603123f, 0.924561024f},
-std::array<float,2>{0.647420049f, 0.0815271363f},
-std::array<float,2>{0.340906739f, 0.129634246f},
-std::array<float,2>{0.609303176f, 0.850710511f},
-std::array<float,2>{0.0768704116f, 0.598613739f},
-std::array<float,2>{0.87415868f, 0.397226304f},
-std::array<float,2>{0.406384706f, 0.478152841f},
-std::array<float,2>{0.737826765f, 0.532738984f},
-std::array<float,2>{0.174908429f, 0.773595572f},
-std::array<float,2>{0.933543801f, 0.214601234f},
-std::array<float,2>{0.0342732854f, 0.0312304199f},
-std::array<float,2>{0.750318289f, 0.938367903f},
-std::array<float,2>{0.297411084f, 0.718918025f},
-std::array<float,2>{0.519752681f, 0.333189219f},
-std::array<float,2>{0.112574756f, 0.417978287f},
-std::array<float,2>{0.833086431f, 0.574336052f},
-std::array<float,2>{0.368084639f, 0.838520467f},
-std::array<float,2>{0.577489436f, 0.156674072f},
-std::array<float,2>{0.476290375f, 0.11852365f},
-std::array<float,2>{0.684800267f, 0.904622138f},
-std::array<float,2>{0.21898146f, 0.680250585f},
-std::array<float,2>{0.93832314f, 0.279764861f},
-std::array<float,2>{0.279923946f, 0.371463746f},
-std::array<float,2>{0.561353266f, 0.695232153f},
-std::array<float,2>{0.0240302868f, 0.996225059f},
-std::array<float,2>{0.80670321f, 0.0412612632f},
-std::array<float,2>{0.145846769f, 0.24632746f},
-std::array<float,2>{0.896550894f, 0.809203684f},
-std::array<float,2>{0.394791633f, 0.504768133f},
-std::array<float,2>{0.704856157f, 0.441509426f},
-std::array<float,2>{0.16153729f, 0.466268778f},
-std::array<float,2>{0.911129236f, 0.525405526f},
-std::array<float,2>{0.436831176f, 0.783315897f},
-std::array<float,2>{0.723562539f, 0.23396869f},
-std::array<float,2>{0.295072585f, 0.0562421121f},
-std::array<float,2>{0.513086617f, 0.97594738f},
-std::array<float,2>{0.0612240098f, 0.710276544f},
-std::array<float,2>{0.776971996f, 0.350025296f},
-std::array<float,2>{0.445117027f, 0.261767805f},
-std::array<float,2>{0.637906551f, 0.660756171f},
-std::array<float,2>{0.218187749f, 0.887820423f},
-std::array<float,2>{0.971289337f, 0.105831154f},
-std::array<float,2>{0.0814318806f, 0.178569958f},
-std::array<float,2>{0.856338441f, 0.825184524f},
-std::array<float,2>{0.315638393f, 0.580722988f},
-std::array<float,2>{0.616116285f, 0.426450908f},
-std::array<float,2>{0.00187897007f, 0.326749235f},
-std::array<float,2>{0.786759079f, 0.739110887f},
-std::array<float,2>{0.257295787f, 0.96106571f},
-std::array<float,2>{0.535029829f, 2.54752431e-05f},
-std::array<float,2>{0.378166258f, 0.198047906f},
-std::array<float,2>{0.692918301f, 0.75858748f},
-std::array<float,2>{0.131738871f, 0.559471905f},
-std::array<float,2>{0.88949424f, 0.49578476f},
-std::array<float,2>{0.34437722f, 0.375464141f},
-std::array<float,2>{0.580013275f, 0.621693552f},
-std::array<float,2>{0.107164897f, 0.862971365f},
-std::array<float,2>{0.818793893f, 0.148530066f},
-std::array<float,2>{0.248037189f, 0.0678913072f},
-std::array<float,2>{0.963474751f, 0.920435846f},
-std::array<float,2>{0.493793786f, 0.650854051f},
-std::array<float,2>{0.663981616f, 0.283463508f},
-std::array<float,2>{0.140855253f, 0.294040263f},
-std::array<float,2>{0.893448472f, 0.643860281f},
-std::array<float,2>{0.391634226f, 0.910815537f},
-std::array<float,2>{0.709652483f, 0.0754964575f},
-std::array<float,2>{0.276688218f, 0.140980065f},
-std::array<float,2>{0.558461428f, 0.869699001f},
-std::array<float,2>{0.0293636341f, 0.611944079f},
-std::array<float,2>{0.811529636f, 0.384329289f},
-std::array<float,2>{0.471785009f, 0.48762694f},
-std::array<float,2>{0.680807173f, 0.55200398f},
-std::array<float,2>{0.224707991f, 0.757632434f},
-std::array<float,2>{0.942579269f, 0.188363642f},
-std::array<float,2>{0.114071302f, 0.0105781043f},
-std::array<float,2>{0.831054986f, 0.958479404f},
-std::array<float,2>{0.374636918f, 0.74343437f},
-std::array<float,2>{0.571974277f, 0.316995949f},
-std::array<float,2>{0.0355128199f, 0.435442895f},
-std::array<float,2>{0.757032514f, 0.592269123f},
-std::array<float,2>{0.302206755f, 0.820311546f},
-std::array<float,2>{0.519040644f, 0.18676807f},
-std::array<float,2>{0.412287027f, 0.0952818319f},
-std::array<float,2>{0.740476847f, 0.879830182f},
-std::array<float,2>{0.176159456f, 0.667678416f},
-std::array<float,2>{0.93701601f, 0.256707668f},
-std::array<float,2>{0.339728504f, 0.353227943f},
-std::array<float,2>{0.604095578f, 0.716414452f},
-std::array<float,2>{0.0731340274f, 0.979382634f},
-std::array<float,2>{0.869874537f, 0.0545424931f},
-std::array<float,2>{0.199302971f, 0.225181058f},
-std::array<float,2>{0.998211086f, 0.796043456f},
-std::array<float,2>{0.458054364f, 0.516639233f},
-std::array<float,2>{0.643841803f, 0.453672975f},
-std::array<float,2>{0.243286639f, 0.448454708f},
-std::array<float,2>{0.968234003f, 0.507845759f},
-std::array<float,2>{0.496823907f, 0.801402926f},
-std::array<float,2>{0.657221317f, 0.238815621f},
-std::array<float,2>{0.351357609f, 0.037978515f},
-std::array<float,2>{0.585302651f, 0.984529078f},
-std::array<float,2>{0.10196811f, 0.700547099f},
-std::array<float,2>{0.81445837f, 0.360550225f},
-std::array<float,2>{0.380026788f, 0.273326248f},
-std::array<float,2>{0.690193117f, 0.675191104f},
-std::array<float,2>{0.127721071f, 0.892659247f},
-std::array<float,2>{0.886510968f, 0.110260718f},
-std::array<float,2>{0.00647722464f, 0.164280877f},
-std::array<float,2>{0.782187581f, 0.832095683f},
-std::array<float,2>{0.251842231f, 0.564627469f},
-std::array<float,2>{0.53666538f, 0.409120828f},
-std::array<float,2>{0.0846681148f, 0.336942017f},
-std::array<float,2>{0.852946281f, 0.731411636f},
-std::array<float,2>{0.319946736f, 0.946265161f},
-std::array<float,2>{0.610496044f, 0.0170328692f},
-std::array<float,2>{0.441275895f, 0.210840002f},
-std::array<float,2>{0.635849893f, 0.771492243f},
-std::array<float,2>{0.213987514f, 0.541500509f},
-std::array<float,2>{0.974663496f, 0.474919021f},
-std::array<float,2>{0.290425867f, 0.402564675f},
-std::array<float,2>{0.508763909f, 0.606508315f},
-std::array<float,2>{0.0556700639f, 0.853154778f},
-std::array<float,2>{0.777722836f, 0.138603866f},
-std::array<float,2>{0.159940258f, 0.0865027532f},
-std::array<float,2>{0.908060789f, 0.930902958f},
-std::array<float,2>{0.43175444f, 0.632918417f},
-std::array<float,2>{0.721842885f, 0.305928499f},
-std::array<float,2>{0.205554307f, 0.368326664f},
-std::array<float,2>{0.978589773f, 0.689422488f},
-std::array<float,2>{0.449126542f, 0.994308054f},
-std::array<float,2>{0.626528382f, 0.043836344f},
-std::array<float,2>{0.323396653f, 0.244380847f},
-std::array<float,2>{0.623564065f, 0.808002293f},
-std::array<float,2>{0.0873255432f, 0.503476918f},
-std::array<float,2>{0.850104153f, 0.438232422f},
-std::array<float,2>{0.422062576f, 0.416876405f},
-std::array<float,2>{0.726892591f, 0.573903024f},
-std::array<float,2>{0.165744379f, 0.842647314f},
-std::array<float,2>{0.914413631f, 0.161341354f},
-std::array<float,2>{0.0526858978f, 0.124880403f},
-std::array<float,2>{0.771348178f, 0.898565352f},
-std::array<float,2>{0.281586051f, 0.683683097f},
-std::array<float,2>{0.506424904f, 0.275173694f},
-std::array<float,2>{0.0969455391f, 0.481126845f},
-std::array<float,2>{0.82152462f, 0.53621614f},
-std::array<float,2>{0.355504543f, 0.779858232f},
-std::array<float,2>{0.586317182f, 0.215501025f},
-std::array<float,2>{0.488673419f, 0.0273154117f},
-std::array<float,2>{0.671058774f, 0.944519043f},
-std::array<float,2>{0.236130625f, 0.726279616f},
-std::array<float,2>{0.955938041f, 0.331595212f},
-std::array<float,2>{0.262399405f, 0.299035132f},
-std::array<float,2>{0.54651773f, 0.63195169f},
-std::array<float,2>{0.0145393787f, 0.927106142f},
-std::array<float,2>{0.795048654f, 0.0839393958f},
-std::array<float,2>{0.139489815f, 0.127169728f},
-std::array<float,2>{0.875984728f, 0.845909357f},
-std::array<float,2>{0.383273333f, 0.593927085f},
-std::array<float,2>{0.702407241f, 0.394019485f},
-std::array<float,2>{0.181526393f, 0.380003929f},
-std::array<float,2>{0.922203839f, 0.617680192f},
-std::array<float,2>{0.418355316f, 0.863437116f},
-std::array<float,2>{0.744276226f, 0.155808583f},
-std::array<float,2>{0.307786316f, 0.0626557544f},
-std::array<float,2>{0.531190276f, 0.916585743f},
-std::array<float,2>{0.0405546911f, 0.655855834f},
-std::array<float,2>{0.764492989f, 0.288131207f},
-std::array<float,2>{0.463256091f, 0.321658075f},
-std::array<float,2>{0.655927539f, 0.734889328f},
-std::array<float,2>{0.194936574f, 0.96598208f},
-std::array<float,2>{0.989188135f, 0.0056939018f},
-std::array<float,2>{0.0642005801f, 0.202101931f},
-std::array<float,2>{0.861467838f, 0.765556216f},
-std::array<float,2>{0.328823209f, 0.557797372f},
-std::array<float,2>{0.597008467f, 0.498578846f},
-std::array<float,2>{0.0189373214f, 0.261374146f},
-std::array<float,2>{0.802085996f, 0.656838894f},
-std::array<float,2>{0.26727578f, 0.885209024f},
-std::array<float,2>{0.548443317f, 0.103395894f},
-std::array<float,2>{0.39879483f, 0.174501866f},
-std::array<float,2>{0.712115228f, 0.82208693f},
-std::array<float,2>{0.154952615f, 0.582347214f},
-std::array<float,2>{0.902939558f, 0.424351603f},
-std::array<float,2>{0.361983031f, 0.46248883f},
-std::array<float,2>{0.567764699f, 0.531058371f},
-std::array<float,2>{0.123913579f, 0.788273156f},
-std::array<float,2>{0.837925255f, 0.229468852f},
-std::array<float,2>{0.233447045f, 0.0612567477f},
-std::array<float,2>{0.945540369f, 0.971875191f},
-std::array<float,2>{0.479771763f, 0.706935644f},
-std::array<float,2>{0.674157441f, 0.343888313f},
-std::array<float,2>{0.168648407f, 0.315419108f},
-std::array<float,2>{0.918628573f, 0.746127367f},
-std::array<float,2>{0.42583096f, 0.953335762f},
-std::array<float,2>{0.733635008f, 0.0144137628f},
-std::array<float,2>{0.288130701f, 0.191811681f},
-std::array<float,2>{0.501614988f, 0.751815379f},
-std::array<float,2>{0.0492968075f, 0.549824238f},
-std::array<float,2>{0.766091347f, 0.490667492f},
-std::array<float,2>{0.45082441f, 0.38886103f},
-std::array<float,2>{0.631627321f, 0.61394316f},
-std::array<float,2>{0.207453296f, 0.872544944f},
-std::array<float,2>{0.982561111f, 0.144939065f},
-std::array<float,2>{0.0920800418f, 0.0707324147f},
-std::array<float,2>{0.846625447f, 0.90975374f},
-std::array<float,2>{0.324884892f, 0.6453017f},
-std::array<float,2>{0.619244158f, 0.292125911f},
-std::array<float,2>{0.0113473684f, 0.457216233f},
-std::array<float,2>{0.790249884f, 0.520932972f},
-std::array<float,2>{0.260701597f, 0.791321814f},
-std::array<float,2>{0.539970934f, 0.22206901f},
-std::array<float,2>{0.387421697f, 0.0472441129f},
-std::array<float,2>{0.69705689f, 0.982994318f},
-std::array<float,2>{0.13636446f, 0.711060226f},
-std::array<float,2>{0.882738233f, 0.357181787f},
-std::array<float,2>{0.353442013f, 0.252273887f},
-std::array<float,2>{0.593503773f, 0.668677986f},
-std::array<float,2>{0.0985238031f, 0.878616512f},
-std::array<float,2>{0.826055408f, 0.0988864526f},
-std::array<float,2>{0.24163188f, 0.181868732f},
-std::array<float,2>{0.957916856f, 0.813569844f},
-std::array<float,2>{0.488196999f, 0.585959733f},
-std::array<float,2>{0.664790273f, 0.430205703f},
-std::array<float,2>{0.190330625f, 0.411427557f},
-std::array<float,2>{0.985708475f, 0.567572594f},
-std::array<float,2>{0.467731595f, 0.829876423f},
-std::array<float,2>{0.648765087f, 0.169331446f},
-std::array<float,2>{0.333715051f, 0.116671704f},
-std::array<float,2>{0.599064529f, 0.897263527f},
-std::array<float,2>{0.0701563433f, 0.678525805f},
-std::array<float,2>{0.86592865f, 0.268258363f},
-std::array<float,2>{0.417671829f, 0.36714682f},
-std::array<float,2>{0.746680081f, 0.696822762f},
-std::array<float,2>{0.186944753f, 0.991794109f},
-std::array<float,2>{0.926402032f, 0.0342360288f},
-std::array<float,2>{0.0465779342f, 0.236558378f},
-std::array<float,2>{0.7599473f, 0.799414217f},
-std::array<float,2>{0.310637355f, 0.514747083f},
-std::array<float,2>{0.523600876f, 0.449668318f},
-std::array<float,2>{0.120287322f, 0.311853677f},
-std::array<float,2>{0.840102494f, 0.638703525f},
-std::array<float,2>{0.365442932f, 0.934310138f},
-std::array<float,2>{0.563442171f, 0.0924410746f},
-std::array<float,2>{0.483941495f, 0.135902703f},
-std::array<float,2>{0.677538991f, 0.857070029f},
-std::array<float,2>{0.227784961f, 0.601643443f},
-std::array<float,2>{0.950213194f, 0.402143359f},
-std::array<float,2>{0.270062894f, 0.472351879f},
-std::array<float,2>{0.552865267f, 0.546181142f},
-std::array<float,2>{0.0225504674f, 0.766049504f},
-std::array<float,2>{0.797402024f, 0.204248175f},
-std::array<float,2>{0.149887517f, 0.0213867705f},
-std::array<float,2>{0.898911893f, 0.950272024f},
-std::array<float,2>{0.405437857f, 0.728546977f},
-std::array<float,2>{0.716989279f, 0.341935754f},
-std::array<float,2>{0.221474007f, 0.278141588f},
-std::array<float,2>{0.94105643f, 0.682560742f},
-std::array<float,2>{0.47401765f, 0.904235482f},
-std::array<float,2>{0.686066866f, 0.121059261f},
-std::array<float,2>{0.370202303f, 0.159009919f},
-std::array<float,2>{0.575878918f, 0.836111069f},
-std::array<float,2>{0.109954387f, 0.577215016f},
-std::array<float,2>{0.835079908f, 0.420880526f},
-std::array<float,2>{0.397530288f, 0.444223851f},
-std::array<float,2>{0.705816448f, 0.506145f},
-std::array<float,2>{0.146858752f, 0.810861588f},
-std::array<float,2>{0.895013452f, 0.248392642f},
-std::array<float,2>{0.0256027319f, 0.0392954051f},
-std::array<float,2>{0.806555808f, 0.998394072f},
-std::array<float,2>{0.277497619f, 0.693073392f},
-std::array<float,2>{0.558758259f, 0.37443909f},
-std::array<float,2>{0.0757500082f, 0.395897865f},
-std::array<float,2>{0.87168777f, 0.600151062f},
-std::array<float,2>{0.343026459f, 0.848491788f},
-std::array<float,2>{0.606028557f, 0.13162525f},
-std::array<float,2>{0.454232395f, 0.0797239766f},
-std::array<float,2>{0.64640975f, 0.92286998f},
-std::array<float,2>{0.197635055f, 0.626824915f},
-std::array<float,2>{0.994392276f, 0.303462178f},
-std::array<float,2>{0.299264342f, 0.335413128f},
-std::array<float,2>{0.521573424f, 0.721490383f},
-std::array<float,2>{0.0317513607f, 0.940847397f},
-std::array<float,2>{0.752356887f, 0.0282939691f},
-std::array<float,2>{0.173171178f, 0.211565822f},
-std::array<float,2>{0.931307793f, 0.77733314f},
-std::array<float,2>{0.408277899f, 0.534213424f},
-std::array<float,2>{0.736181974f, 0.479618073f},
-std::array<float,2>{0.129664481f, 0.493382096f},
-std::array<float,2>{0.887156248f, 0.560906827f},
-std::array<float,2>{0.375795126f, 0.760276675f},
-std::array<float,2>{0.693447411f, 0.19531621f},
-std::array<float,2>{0.25508216f, 0.00219645421f},
-std::array<float,2>{0.531716585f, 0.964437664f},
-std::array<float,2>{0.00369139458f, 0.741587341f},
-std::array<float,2>{0.787305713f, 0.325613946f},
-std::array<float,2>{0.494848907f, 0.282637954f},
-std::array<float,2>{0.661195576f, 0.648615956f},
-std::array<float,2>{0.249730244f, 0.919405401f},
-std::array<float,2>{0.962082863f, 0.07009013f},
-std::array<float,2>{0.109174088f, 0.150437713f},
-std::array<float,2>{0.818348587f, 0.859569728f},
-std::array<float,2>{0.3474558f, 0.623452961f},
-std::array<float,2>{0.580237985f, 0.37826544f},
-std::array<float,2>{0.0598794855f, 0.3490991f},
-std::array<float,2>{0.774793506f, 0.707755268f},
-std::array<float,2>{0.293511033f, 0.973000705f},
-std::array<float,2>{0.514325678f, 0.0574748367f},
-std::array<float,2>{0.434629381f, 0.230519012f},
-std::array<float,2>{0.726017594f, 0.783068836f},
-std::array<float,2>{0.162682861f, 0.52471453f},
-std::array<float,2>{0.912463844f, 0.467551202f},
-std::array<float,2>{0.312731445f, 0.42821756f},
-std::array<float,2>{0.613286972f, 0.579179704f},
-std::array<float,2>{0.0793343857f, 0.8273651f},
-std::array<float,2>{0.857666254f, 0.177439153f},
-std::array<float,2>{0.216144085f, 0.109177269f},
-std::array<float,2>{0.9702788f, 0.888955593f},
-std::array<float,2>{0.442687273f, 0.662543178f},
-std::array<float,2>{0.639867127f, 0.265300542f},
-std::array<float,2>{0.158125818f, 0.305236727f},
-std::array<float,2>{0.908600271f, 0.634044349f},
-std::array<float,2>{0.429734588f, 0.930059791f},
-std::array<float,2>{0.720180809f, 0.0869162455f},
-std::array<float,2>{0.291563928f, 0.137679979f},
-std::array<float,2>{0.511669397f, 0.852526009f},
-std::array<float,2>{0.0576757491f, 0.605682015f},
-std::array<float,2>{0.780406117f, 0.404232442f},
-std::array<float,2>{0.438304037f, 0.475809991f},
-std::array<float,2>{0.633099377f, 0.542617559f},
-std::array<float,2>{0.211721152f, 0.77313745f},
-std::array<float,2>{0.973660946f, 0.209326759f},
-std::array<float,2>{0.0831561834f, 0.0161685497f},
-std::array<float,2>{0.854667902f, 0.946680486f},
-std::array<float,2>{0.31739819f, 0.732337356f},
-std::array<float,2>{0.612837195f, 0.336018175f},
-std::array<float,2>{0.0052354401f, 0.409372896f},
-std::array<float,2>{0.783708453f, 0.566254556f},
-std::array<float,2>{0.252150387f, 0.833899498f},
-std::array<float,2>{0.538084209f, 0.165057093f},
-std::array<float,2>{0.381148994f, 0.110868596f},
-std::array<float,2>{0.687571585f, 0.894452333f},
-std::array<float,2>{0.125452638f, 0.674802601f},
-std::array<float,2>{0.883756042f, 0.27195093f},
-std::array<float,2>{0.348098189f, 0.359606206f},
-std::array<float,2>{0.582208872f, 0.699923754f},
-std::array<float,2>{0.103629142f, 0.985380948f},
-std::array<float,2>{0.814451337f, 0.0390115082f},
-std::array<float,2>{0.245763049f, 0.239827469f},
-std::array<float,2>{0.966252089f, 0.801983714f},
-std::array<float,2>{0.49933967f, 0.508936942f},
-std::array<float,2>{0.659022987f, 0.447784245f},
-std::array<float,2>{0.203123838f, 0.454793423f},
-std::array<float,2>{0.997468233f, 0.516035676f},
-std::array<float,2>{0.460014313f, 0.79577589f},
-std::array<float,2>{0.642017663f, 0.226409495f},
-std::array<float,2>{0.336771131f, 0.0530187786f},
-std::array<float,2>{0.602819026f, 0.979502022f},
-std::array<float,2>{0.070778504f, 0.715235591f},
-std::array<float,2>{0.86850208f, 0.351790994f},
-std::array<float,2>{0.41072762f, 0.257549644f},
-std::array<float,2>{0.738723397f, 0.666893423f},
-std::array<float,2>{0.178217992f, 0.880625486f},
-std::array<float,2>{0.934426785f, 0.0939118639f},
-std::array<float,2>{0.0373494104f, 0.186073139f},
-std::array<float,2>{0.754679024f, 0.818724096f},
-std::array<float,2>{0.303918839f, 0.593438566f},
-std::array<float,2>{0.516117513f, 0.434227049f},
-std::array<float,2>{0.115631744f, 0.318240941f},
-std::array<float,2>{0.829779923f, 0.742238045f},
-std::array<float,2>{0.371846557f, 0.957455873f},
-std::array<float,2>{0.572797298f, 0.0107490839f},
-std::array<float,2>{0.470361292f, 0.188852116f},
-std::array<float,2>{0.682384372f, 0.756437123f},
-std::array<float,2>{0.222873151f, 0.551612377f},
-std::array<float,2>{0.945182502f, 0.486972988f},
-std::array<float,2>{0.273507029f, 0.383327127f},
-std::array<float,2>{0.556202352f, 0.612525165f},
-std::array<float,2>{0.0281538162f, 0.870977223f},
-std::array<float,2>{0.808789432f, 0.142129332f},
-std::array<float,2>{0.143768638f, 0.0745160878f},
-std::array<float,2>{0.892475724f, 0.912000418f},
-std::array<float,2>{0.393817782f, 0.643163741f},
-std::array<float,2>{0.707780838f, 0.29379788f},
-std::array<float,2>{0.230940372f, 0.345650166f},
-std::array<float,2>{0.948891938f, 0.705793381f},
-std::array<float,2>{0.478478581f, 0.970935643f},
-std::array<float,2>{0.673361123f, 0.0622091033f},
-std::array<float,2>{0.36065346f, 0.230252311f},
-std::array<float,2>{0.570183635f, 0.787509143f},
-std::array<float,2>{0.121412747f, 0.530073524f},
-std::array<float,2>{0.836473525f, 0.461808503f},
-std::array<float,2>{0.401158392f, 0.425654083f},
-std::array<float,2>{0.714041114f, 0.583771348f},
-std::array<float,2>{0.154078335f, 0.820886254f},
-std::array<float,2>{0.906099081f, 0.175226182f},
-std::array<float,2>{0.0156489406f, 0.102289714f},
-std::array<float,2>{0.80309546f, 0.886053205f},
-std::array<float,2>{0.269017458f, 0.657697976f},
-std::array<float,2>{0.549942195f, 0.260707647f},
-std::array<float,2>{0.0663680658f, 0.499923408f},
-std::array<float,2>{0.860757351f, 0.5571841f},
-std::array<float,2>{0.331344903f, 0.763842046f},
-std::array<float,2>{0.594330251f, 0.203035727f},
-std::array<float,2>{0.462771505f, 0.00393866049f},
-std::array<float,2>{0.654282808f, 0.965578139f},
-std::array<float,2>{0.192206517f, 0.735919595f},
-std::array<float,2>{0.990843952f, 0.320952505f},
-std::array<float,2>{0.305332094f, 0.287506104f},
-std::array<float,2>{0.528534114f, 0.654731035f},
-std::array<float,2>{0.0414974466f, 0.917958915f},
-std::array<float,2>{0.762323201f, 0.0635608509f},
-std::array<float,2>{0.182224944f, 0.154314056f},
-std::array<float,2>{0.924305856f, 0.864986479f},
-std::array<float,2>{0.4203403f, 0.619062543f},
-std::array<float,2>{0.743913531f, 0.378973693f},
-std::array<float,2>{0.138167992f, 0.393268168f},
-std::array<float,2>{0.877695978f, 0.595565081f},
-std::array<float,2>{0.386546493f, 0.847470164f},
-std::array<float,2>{0.700164258f, 0.128537208f},
-std::array<float,2>{0.264543563f, 0.0829669833f},
-std::array<float,2>{0.544284225f, 0.926707506f},
-std::array<float,2>{0.0118153784f, 0.6314556f},
-std::array<float,2>{0.794877648f, 0.300457299f},
-std::array<float,2>{0.490993321f, 0.330922037f},
-std::array<float,2>{0.669168353f, 0.725361109f},
-std::array<float,2>{0.237176746f, 0.944052815f},
-std::array<float,2>{0.954907238f, 0.0256310441f},
-std::array<float,2>{0.0951238051f, 0.216605216f},
-std::array<float,2>{0.822737753f, 0.780792177f},
-std::array<float,2>{0.357577503f, 0.53610307f},
-std::array<float,2>{0.589574873f, 0.482031941f},
-std::array<float,2>{0.0531489104f, 0.273769021f},
-std::array<float,2>{0.771559715f, 0.685476661f},
-std::array<float,2>{0.284236759f, 0.899830103f},
-std::array<float,2>{0.504322588f, 0.12321163f},
-std::array<float,2>{0.424400717f, 0.160761744f},
-std::array<float,2>{0.729992032f, 0.84361589f},
-std::array<float,2>{0.166232929f, 0.573157549f},
-std::array<float,2>{0.91664058f, 0.417841345f},
-std::array<float,2>{0.322128981f, 0.439078599f},
-std::array<float,2>{0.621244252f, 0.50239706f},
-std::array<float,2>{0.0894455686f, 0.807292163f},
-std::array<float,2>{0.84825927f, 0.245209455f},
-std::array<float,2>{0.2037258f, 0.0448578559f},
-std::array<float,2>{0.978394091f, 0.995290279f},
-std::array<float,2>{0.446417719f, 0.687905967f},
-std::array<float,2>{0.62870568f, 0.36748296f},
-std::array<float,2>{0.150793552f, 0.343291402f},
-std::array<float,2>{0.902255774f, 0.730420291f},
-std::array<float,2>{0.403423131f, 0.949297845f},
-std::array<float,2>{0.716365755f, 0.0202170927f},
-std::array<float,2>{0.272577733f, 0.204082772f},
-std::array<float,2>{0.551975191f, 0.767097294f},
-std::array<float,2>{0.0204738658f, 0.545258045f},
-std::array<float,2>{0.79971832f, 0.471386224f},
-std::array<float,2>{0.481239468f, 0.401176989f},
-std::array<float,2>{0.67789638f, 0.603001118f},
-std::array<float,2>{0.228658259f, 0.856023371f},
-std::array<float,2>{0.95198822f, 0.135442257f},
-std::array<float,2>{0.117913477f, 0.0929667801f},
-std::array<float,2>{0.842558682f, 0.935327113f},
-std::array<float,2>{0.365011603f, 0.639982402f},
-std::array<float,2>{0.564917982f, 0.310687959f},
-std::array<float,2>{0.0434992313f, 0.451035887f},
-std::array<float,2>{0.759708583f, 0.51449275f},
-std::array<float,2>{0.310376823f, 0.800003529f},
-std::array<float,2>{0.527297676f, 0.237370342f},
-std::array<float,2>{0.415029287f, 0.0339218266f},
-std::array<float,2>{0.749435365f, 0.990427732f},
-std::array<float,2>{0.18455188f, 0.696270823f},
-std::array<float,2>{0.928426683f, 0.365925997f},
-std::array<float,2>{0.334012508f, 0.269337088f},
-std::array<float,2>{0.600300252f, 0.679104388f},
-std::array<float,2>{0.0682448074f, 0.897478223f},
-std::array<float,2>{0.865184724f, 0.115833655f},
-std::array<float,2>{0.189244092f, 0.168782696f},
-std::array<float,2>{0.986371338f, 0.828757823f},
-std::array<float,2>{0.466647208f, 0.566507697f},
-std::array<float,2>{0.650478482f, 0.410738736f},
-std::array<float,2>{0.239480495f, 0.43066591f},
-std::array<float,2>{0.959780812f, 0.587689877f},
-std::array<float,2>{0.485779285f, 0.813456416f},
-std::array<float,2>{0.667185426f, 0.183528066f},
-std::array<float,2>{0.354213059f, 0.0983395055f},
-std::array<float,2>{0.591526866f, 0.877175868f},
-std::array<float,2>{0.0998287201f, 0.669290066f},
-std::array<float,2>{0.827132165f, 0.253804237f},
-std::array<float,2>{0.389297605f, 0.355490178f},
-std::array<float,2>{0.698372543f, 0.712825418f},
-std::array<float,2>{0.133185491f, 0.984266758f},
-std::array<float,2>{0.879520833f, 0.0479839928f},
-std::array<float,2>{0.00960682984f, 0.221601218f},
-std::array<float,2>{0.791105747f, 0.792688429f},
-std::array<float,2>{0.259136438f, 0.519795835f},
-std::array<float,2>{0.542108774f, 0.458343238f},
-std::array<float,2>{0.0910709202f, 0.291137189f},
-std::array<float,2>{0.844437838f, 0.646229804f},
-std::array<float,2>{0.326861054f, 0.908243418f},
-std::array<float,2>{0.617770493f, 0.0721414834f},
-std::array<float,2>{0.452115923f, 0.145925924f},
-std::array<float,2>{0.629686296f, 0.871852815f},
-std::array<float,2>{0.209059522f, 0.614938617f},
-std::array<float,2>{0.982148945f, 0.390622675f},
-std::array<float,2>{0.286958218f, 0.491422743f},
-std::array<float,2>{0.503321111f, 0.549548388f},
-std::array<float,2>{0.047679916f, 0.750541687f},
-std::array<float,2>{0.768173277f, 0.193185925f},
-std::array<float,2>{0.171107516f, 0.0155097386f},
-std::array<float,2>{0.920758784f, 0.954329193f},
-std::array<float,2>{0.429227382f, 0.747886539f},
-std::array<float,2>{0.732009172f, 0.315877378f},
-std::array<float,2>{0.216951355f, 0.264297247f},
-std::array<float,2>{0.972466171f, 0.66392225f},
-std::array<float,2>{0.444214851f, 0.890160501f},
-std::array<float,2>{0.637646675f, 0.107966155f},
-std::array<float,2>{0.315194815f, 0.17606324f},
-std::array<float,2>{0.617103815f, 0.826326966f},
-std::array<float,2>{0.0804272741f, 0.578555763f},
-std::array<float,2>{0.856595516f, 0.429487348f},
-std::array<float,2>{0.436168373f, 0.468096524f},
-std::array<float,2>{0.723672211f, 0.524400771f},
-std::array<float,2>{0.160752788f, 0.781638443f},
-std::array<float,2>{0.911253572f, 0.231701642f},
-std::array<float,2>{0.0616081804f, 0.0576196313f},
-std::array<float,2>{0.775403678f, 0.973784864f},
-std::array<float,2>{0.296360672f, 0.708564281f},
-std::array<float,2>{0.512346983f, 0.347950011f},
-std::array<float,2>{0.105740689f, 0.377422869f},
-std::array<float,2>{0.819633126f, 0.624214888f},
-std::array<float,2>{0.344855964f, 0.860938966f},
-std::array<float,2>{0.57825166f, 0.152188107f},
-std::array<float,2>{0.493096918f, 0.0686384887f},
-std::array<float,2>{0.662343025f, 0.918468237f},
-std::array<float,2>{0.246812522f, 0.649658561f},
-std::array<float,2>{0.964824259f, 0.282220751f},
-std::array<float,2>{0.256209701f, 0.324749857f},
-std::array<float,2>{0.533406496f, 0.740826368f},
-std::array<float,2>{0.000398406468f, 0.962964594f},
-std::array<float,2>{0.785964072f, 0.00359835871f},
-std::array<float,2>{0.132539943f, 0.19726032f},
-std::array<float,2>{0.890335917f, 0.761031687f},
-std::array<float,2>{0.377669156f, 0.56178546f},
-std::array<float,2>{0.691578984f, 0.492810637f},
-std::array<float,2>{0.173831642f, 0.479228884f},
-std::array<float,2>{0.931950212f, 0.533483207f},
-std::array<float,2>{0.407998681f, 0.776341736f},
-std::array<float,2>{0.73634541f, 0.212785646f},
-std::array<float,2>{0.298393011f, 0.0290598758f},
-std::array<float,2>{0.52117902f, 0.940223396f},
-std::array<float,2>{0.0339005813f, 0.722067714f},
-std::array<float,2>{0.751910627f, 0.334041148f},
-std::array<float,2>{0.456509441f, 0.303897858f},
-std::array<float,2>{0.648355484f, 0.625159323f},
-std::array<float,2>{0.195797861f, 0.922851503f},
-std::array<float,2>{0.993112922f, 0.0790324286f},
-std::array<float,2>{0.0776147619f, 0.13265726f},
-std::array<float,2>{0.873223543f, 0.849101841f},
-std::array<float,2>{0.340218991f, 0.601196885f},
-std::array<float,2>{0.608325779f, 0.394955307f},
-std::array<float,2>{0.0250583459f, 0.373964638f},
-std::array<float,2>{0.808004618f, 0.692269325f},
-std::array<float,2>{0.280697197f, 0.999184847f},
-std::array<float,2>{0.561725199f, 0.0404323824f},
-std::array<float,2>{0.396080554f, 0.24952659f},
-std::array<float,2>{0.703832567f, 0.811813533f},
-std::array<float,2>{0.145507574f, 0.507240295f},
-std::array<float,2>{0.898129642f, 0.44525066f},
-std::array<float,2>{0.368273169f, 0.420934856f},
-std::array<float,2>{0.576396942f, 0.576996028f},
-std::array<float,2>{0.111970805f, 0.837248802f},
-std::array<float,2>{0.832284689f, 0.159855634f},
-std::array<float,2>{0.220439106f, 0.119192302f},
-std::array<float,2>{0.938868821f, 0.90265727f},
-std::array<float,2>{0.475204498f, 0.683321774f},
-std::array<float,2>{0.684097946f, 0.279273242f},
-std::array<float,2>{0.128067836f, 0.269678026f},
-std::array<float,2>{0.885522187f, 0.672901869f},
-std::array<float,2>{0.379013449f, 0.89231801f},
-std::array<float,2>{0.691198289f, 0.112085849f},
-std::array<float,2>{0.250296384f, 0.166168988f},
-std::array<float,2>{0.535501301f, 0.835655332f},
-std::array<float,2>{0.00735618081f, 0.562671423f},
-std::array<float,2>{0.783003032f, 0.406539857f},
-std::array<float,2>{0.497413278f, 0.446398526f},
-std::array<float,2>{0.657373667f, 0.509789109f},
-std::array<float,2>{0.243155494f, 0.8040452f},
-std::array<float,2>{0.967517316f, 0.241348654f},
-std::array<float,2>{0.103359036f, 0.0353491046f},
-std::array<float,2>{0.816307366f, 0.986581564f},
-std::array<float,2>{0.349708736f, 0.702293813f},
-std::array<float,2>{0.584510624f, 0.361354172f},
-std::array<float,2>{0.0549069159f, 0.406204998f},
-std::array<float,2>{0.778558612f, 0.60795635f},
-std::array<float,2>{0.289062798f, 0.854184866f},
-std::array<float,2>{0.509691417f, 0.139383376f},
-std::array<float,2>{0.43290624f, 0.0897757858f},
-std::array<float,2>{0.721365571f, 0.932285845f},
-std::array<float,2>{0.158474639f, 0.6353423f},
-std::array<float,2>{0.906516314f, 0.307284087f},
-std::array<float,2>{0.318536013f, 0.338766754f},
-std::array<float,2>{0.609628797f, 0.733538151f},
-std::array<float,2>{0.085163109f, 0.947387993f},
-std::array<float,2>{0.85238564f, 0.019007165f},
-std::array<float,2>{0.213132143f, 0.208647162f},
-std::array<float,2>{0.97592175f, 0.771154583f},
-std::array<float,2>{0.440150112f, 0.540878594f},
-std::array<float,2>{0.635421276f, 0.473792076f},
-std::array<float,2>{0.226191312f, 0.486281991f},
-std::array<float,2>{0.941863596f, 0.552769065f},
-std::array<float,2>{0.471009284f, 0.754912972f},
-std::array<float,2>{0.680614889f, 0.191002443f},
-std::array<float,2>{0.373466015f, 0.00813711341f},
-std::array<float,2>{0.571088612f, 0.96026063f},
-std::array<float,2>{0.114718959f, 0.745052218f},
-std::array<float,2>{0.83024776f, 0.318488061f},
-std::array<float,2>{0.391207159f, 0.295197278f},
-std::array<float,2>{0.710485697f, 0.641204119f},
-std::array<float,2>{0.141844094f, 0.914007366f},
-std::array<float,2>{0.893881798f, 0.0763233677f},
-std::array<float,2>{0.0311413091f, 0.143884957f},
-std::array<float,2>{0.810650647f, 0.867335379f},
-std::array<float,2>{0.275871038f, 0.609676123f},
-std::array<float,2>{0.556893349f, 0.385380745f},
-std::array<float,2>{0.0735463873f, 0.354270965f},
-std::array<float,2>{0.870638907f, 0.717832744f},
-std::array<float,2>{0.338472933f, 0.977124751f},
-std::array<float,2>{0.604740739f, 0.0514928326f},
-std::array<float,2>{0.457237482f, 0.224458471f},
-std::array<float,2>{0.643184423f, 0.793767214f},
-std::array<float,2>{0.20065248f, 0.51874876f},
-std::array<float,2>{0.999686956f, 0.455680519f},
-std::array<float,2>{0.300879002f, 0.436455667f},
-std::array<float,2>{0.518191814f, 0.590419829f},
-std::array<float,2>{0.0365589745f, 0.81676352f},
-std::array<float,2>{0.756273746f, 0.185020939f},
-std::array<float,2>{0.177574307f, 0.096458979f},
-std::array<float,2>{0.935958564f, 0.881995082f},
-std::array<float,2>{0.413668066f, 0.664171696f},
-std::array<float,2>{0.741491139f, 0.255393565f},
-std::array<float,2>{0.194027737f, 0.322330624f},
-std::array<float,2>{0.990199387f, 0.737742245f},
-std::array<float,2>{0.464780122f, 0.968594551f},
-std::array<float,2>{0.655111551f, 0.00675315363f},
-std::array<float,2>{0.329986632f, 0.200605199f},
-std::array<float,2>{0.595708013f, 0.761934817f},
-std::array<float,2>{0.0634302273f, 0.55513972f},
-std::array<float,2>{0.862417161f, 0.49752903f},
-std::array<float,2>{0.418951929f, 0.381507784f},
-std::array<float,2>{0.745175183f, 0.620364726f},
-std::array<float,2>{0.179942772f, 0.865881383f},
-std::array<float,2>{0.923346341f, 0.153279215f},
-std::array<float,2>{0.0396310315f, 0.0645555034f},
-std::array<float,2>{0.764681458f, 0.915482998f},
-std::array<float,2>{0.307130426f, 0.65393889f},
-std::array<float,2>{0.529729664f, 0.287020415f},
-std::array<float,2>{0.124040119f, 0.464738995f},
-std::array<float,2>{0.839785993f, 0.527724981f},
-std::array<float,2>{0.362892151f, 0.786942065f},
-std::array<float,2>{0.566655219f, 0.227660015f},
-std::array<float,2>{0.479442209f, 0.0591720678f},
-std::array<float,2>{0.675466835f, 0.968856335f},
-std::array<float,2>{0.23264946f, 0.703143001f},
-std::array<float,2>{0.946374416f, 0.347510904f},
-std::array<float,2>{0.266159028f, 0.258789957f},
-std::array<float,2>{0.547321737f, 0.659763694f},
-std::array<float,2>{0.0177042261f, 0.883684456f},
-std::array<float,2>{0.801607013f, 0.105453074f},
-std::array<float,2>{0.156217709f, 0.172654867f},
-std::array<float,2>{0.903949738f, 0.823850989f},
-std::array<float,2>{0.400160879f, 0.585245788f},
-std::array<float,2>{0.711766243f, 0.422165036f},
-std::array<float,2>{0.16435954f, 0.415359229f},
-std::array<float,2>{0.915760756f, 0.571874261f},
-std::array<float,2>{0.423554599f, 0.841396213f},
-std::array<float,2>{0.728228331f, 0.162460595f},
-std::array<float,2>{0.282283932f, 0.122840241f},
-std::array<float,2>{0.506848752f, 0.900655866f},
-std::array<float,2>{0.0510187037f, 0.685611904f},
-std::array<float,2>{0.76986903f, 0.275673211f},
-std::array<float,2>{0.447930574f, 0.369807392f},
-std::array<float,2>{0.625831962f, 0.689725161f},
-std::array<float,2>{0.206302285f, 0.993122756f},
-std::array<float,2>{0.980109274f, 0.0453147776f},
-std::array<float,2>{0.0869119242f, 0.244137079f},
-std::array<float,2>{0.850732028f, 0.804896653f},
-std::array<float,2>{0.322708011f, 0.501027405f},
-std::array<float,2>{0.624400139f, 0.439584851f},
-std::array<float,2>{0.0150032341f, 0.298438579f},
-std::array<float,2>{0.796375811f, 0.63024193f},
-std::array<float,2>{0.262990445f, 0.92865634f},
-std::array<float,2>{0.545591354f, 0.0855597556f},
-std::array<float,2>{0.384253412f, 0.12621437f},
-std::array<float,2>{0.701626241f, 0.843848109f},
-std::array<float,2>{0.140440956f, 0.596851528f},
-std::array<float,2>{0.875256836f, 0.390988082f},
-std::array<float,2>{0.357198864f, 0.483897775f},
-std::array<float,2>{0.587375998f, 0.537666738f},
-std::array<float,2>{0.0961656496f, 0.77787441f},
-std::array<float,2>{0.820352674f, 0.218325421f},
-std::array<float,2>{0.234451756f, 0.025012942f},
-std::array<float,2>{0.956761777f, 0.942991972f},
-std::array<float,2>{0.4892582f, 0.72386384f},
-std::array<float,2>{0.669946611f, 0.328709424f},
-std::array<float,2>{0.186315909f, 0.364132971f},
-std::array<float,2>{0.927095592f, 0.697931826f},
-std::array<float,2>{0.416110843f, 0.989857316f},
-std::array<float,2>{0.747576773f, 0.0319068432f},
-std::array<float,2>{0.311910987f, 0.236173049f},
-std::array<float,2>{0.524499178f, 0.798708081f},
-std::array<float,2>{0.0453823619f, 0.51349932f},
-std::array<float,2>{0.760771811f, 0.452730447f},
-std::array<float,2>{0.468223274f, 0.412276387f},
-std::array<float,2>{0.649961889f, 0.569334328f},
-std::array<float,2>{0.190919369f, 0.831157207f},
-std::array<float,2>{0.985148728f, 0.171294361f},
-std::array<float,2>{0.0691470951f, 0.113470986f},
-std::array<float,2>{0.866421998f, 0.894848824f},
-std::array<float,2>{0.332387269f, 0.677265823f},
-std::array<float,2>{0.598100543f, 0.265643477f},
-std::array<float,2>{0.0221799295f, 0.469980747f},
-std::array<float,2>{0.798386931f, 0.5435431f},
-std::array<float,2>{0.270991713f, 0.769383073f},
-std::array<float,2>{0.553834736f, 0.206008554f},
-std::array<float,2>{0.405060649f, 0.0221820008f},
-std::array<float,2>{0.718681395f, 0.952029467f},
-std::array<float,2>{0.148560062f, 0.726896763f},
-std::array<float,2>{0.899928689f, 0.340120465f},
-std::array<float,2>{0.36670956f, 0.308876216f},
-std::array<float,2>{0.5641132f, 0.636787236f},
-std::array<float,2>{0.119564578f, 0.935701787f},
-std::array<float,2>{0.841083407f, 0.0915843472f},
-std::array<float,2>{0.226745889f, 0.134453028f},
-std::array<float,2>{0.950030327f, 0.857602596f},
-std::array<float,2>{0.483276039f, 0.603942215f},
-std::array<float,2>{0.676565409f, 0.399331808f},
-std::array<float,2>{0.208682671f, 0.387402385f},
-std::array<float,2>{0.98403728f, 0.615322351f},
-std::array<float,2>{0.449361116f, 0.873089492f},
-std::array<float,2>{0.632120371f, 0.148331806f},
-std::array<float,2>{0.325897783f, 0.0740595236f},
-std::array<float,2>{0.620212674f, 0.907495439f},
-std::array<float,2>{0.0932887122f, 0.646829009f},
-std::array<float,2>{0.846820533f, 0.290644765f},
-std::array<float,2>{0.427076876f, 0.313547015f},
-std::array<float,2>{0.732701778f, 0.749378562f},
-std::array<float,2>{0.16914168f, 0.956277311f},
-std::array<float,2>{0.919320881f, 0.013423766f},
-std::array<float,2>{0.0500388183f, 0.194704145f},
-std::array<float,2>{0.76747334f, 0.752121627f},
-std::array<float,2>{0.287608236f, 0.548140943f},
-std::array<float,2>{0.50052923f, 0.490047783f},
-std::array<float,2>{0.0989242792f, 0.250573337f},
-std::array<float,2>{0.824293733f, 0.671394706f},
-std::array<float,2>{0.352427453f, 0.876679003f},
-std::array<float,2>{0.592297554f, 0.101503268f},
-std::array<float,2>{0.487124622f, 0.180149406f},
-std::array<float,2>{0.665078521f, 0.814653695f},
-std::array<float,2>{0.240960628f, 0.589523673f},
-std::array<float,2>{0.958393872f, 0.432209522f},
-std::array<float,2>{0.261178941f, 0.45908466f},
-std::array<float,2>{0.54076308f, 0.521886051f},
-std::array<float,2>{0.0101363696f, 0.790435553f},
-std::array<float,2>{0.789710522f, 0.220516264f},
-std::array<float,2>{0.135423869f, 0.0490400493f},
-std::array<float,2>{0.881668448f, 0.981810391f},
-std::array<float,2>{0.387895525f, 0.714698136f},
-std::array<float,2>{0.695425272f, 0.358282119f},
-std::array<float,2>{0.248340711f, 0.284181356f},
-std::array<float,2>{0.961355507f, 0.652145982f},
-std::array<float,2>{0.495419472f, 0.921768904f},
-std::array<float,2>{0.660654843f, 0.06732288f},
-std::array<float,2>{0.345731586f, 0.150022432f},
-std::array<float,2>{0.581629515f, 0.861595035f},
-std::array<float,2>{0.10767556f, 0.622452557f},
-std::array<float,2>{0.817327499f, 0.37669909f},
-std::array<float,2>{0.376011312f, 0.494759917f},
-std::array<float,2>{0.69529295f, 0.560191393f},
-std::array<float,2>{0.129909933f, 0.758824229f},
-std::array<float,2>{0.888334215f, 0.198342294f},
-std::array<float,2>{0.00217652088f, 0.00170562393f},
-std::array<float,2>{0.788160801f, 0.962300003f},
-std::array<float,2>{0.254713207f, 0.740182698f},
-std::array<float,2>{0.532820046f, 0.327551693f},
-std::array<float,2>{0.0789386928f, 0.427156925f},
-std::array<float,2>{0.858436644f, 0.581766725f},
-std::array<float,2>{0.314052105f, 0.825996518f},
-std::array<float,2>{0.615188718f, 0.179099232f},
-std::array<float,2>{0.442073971f, 0.107397862f},
-std::array<float,2>{0.639080405f, 0.887467146f},
-std::array<float,2>{0.215729326f, 0.662068725f},
-std::array<float,2>{0.968958855f, 0.263107091f},
-std::array<float,2>{0.29461509f, 0.351369739f},
-std::array<float,2>{0.514872551f, 0.709525943f},
-std::array<float,2>{0.0586135834f, 0.975474834f},
-std::array<float,2>{0.77401185f, 0.0553025864f},
-std::array<float,2>{0.16393894f, 0.233230054f},
-std::array<float,2>{0.913777888f, 0.784488201f},
-std::array<float,2>{0.43390727f, 0.526912034f},
-std::array<float,2>{0.724897087f, 0.465377182f},
-std::array<float,2>{0.148358434f, 0.442468137f},
-std::array<float,2>{0.896191597f, 0.505275905f},
-std::array<float,2>{0.397346437f, 0.809625089f},
-std::array<float,2>{0.706400275f, 0.247623861f},
-std::array<float,2>{0.278401822f, 0.0420491472f},
-std::array<float,2>{0.559891641f, 0.997906327f},
-std::array<float,2>{0.0270422231f, 0.693820298f},
-std::array<float,2>{0.804992795f, 0.372646481f},
-std::array<float,2>{0.473022372f, 0.281029761f},
-std::array<float,2>{0.687410116f, 0.681165099f},
-std::array<float,2>{0.222061217f, 0.90547663f},
-std::array<float,2>{0.940253198f, 0.117554106f},
-std::array<float,2>{0.11061427f, 0.15790382f},
-std::array<float,2>{0.834693134f, 0.838953197f},
-std::array<float,2>{0.369208962f, 0.57588172f},
-std::array<float,2>{0.574575663f, 0.419057488f},
-std::array<float,2>{0.0328510888f, 0.332441777f},
-std::array<float,2>{0.753416359f, 0.720003545f},
-std::array<float,2>{0.30007419f, 0.939310193f},
-std::array<float,2>{0.523024321f, 0.0293103326f},
-std::array<float,2>{0.409465909f, 0.213093668f},
-std::array<float,2>{0.735040545f, 0.775133848f},
-std::array<float,2>{0.172494233f, 0.531387985f},
-std::array<float,2>{0.930604398f, 0.477000058f},
-std::array<float,2>{0.342133492f, 0.398429662f},
-std::array<float,2>{0.607369542f, 0.598747969f},
-std::array<float,2>{0.0747774467f, 0.850077152f},
-std::array<float,2>{0.873026192f, 0.130292684f},
-std::array<float,2>{0.198706836f, 0.0801770836f},
-std::array<float,2>{0.995482087f, 0.925679862f},
-std::array<float,2>{0.454008132f, 0.627869844f},
-std::array<float,2>{0.645242929f, 0.302733988f}}
\ No newline at end of file
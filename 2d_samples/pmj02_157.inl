@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.821775675f, 0.473437876f},
-std::array<float,2>{0.428064853f, 0.705017447f},
-std::array<float,2>{0.0705965832f, 0.0224003643f},
-std::array<float,2>{0.609163046f, 0.840887785f},
-std::array<float,2>{0.691127777f, 0.184510887f},
-std::array<float,2>{0.168950066f, 0.876935542f},
-std::array<float,2>{0.337265402f, 0.343289047f},
-std::array<float,2>{0.978096068f, 0.61287415f},
-std::array<float,2>{0.522814214f, 0.280517995f},
-std::array<float,2>{0.0511502102f, 0.542608202f},
-std::array<float,2>{0.493083328f, 0.228421912f},
-std::array<float,2>{0.768981814f, 0.981852114f},
-std::array<float,2>{0.905562639f, 0.084105961f},
-std::array<float,2>{0.268052876f, 0.798220038f},
-std::array<float,2>{0.196900934f, 0.401404679f},
-std::array<float,2>{0.637495518f, 0.653678358f},
-std::array<float,2>{0.953506589f, 0.358966798f},
-std::array<float,2>{0.360472947f, 0.577444315f},
-std::array<float,2>{0.13842012f, 0.134876221f},
-std::array<float,2>{0.733113229f, 0.918603599f},
-std::array<float,2>{0.569906712f, 0.048600778f},
-std::array<float,2>{0.102878667f, 0.846170187f},
-std::array<float,2>{0.380699098f, 0.444716513f},
-std::array<float,2>{0.863454163f, 0.74574095f},
-std::array<float,2>{0.681152463f, 0.422148168f},
-std::array<float,2>{0.218976751f, 0.686715066f},
-std::array<float,2>{0.301733971f, 0.1161649f},
-std::array<float,2>{0.934372246f, 0.775890291f},
-std::array<float,2>{0.804288626f, 0.195913061f},
-std::array<float,2>{0.439942211f, 0.962876618f},
-std::array<float,2>{0.0118976543f, 0.288127542f},
-std::array<float,2>{0.5513556f, 0.526835918f},
-std::array<float,2>{0.913222134f, 0.385131866f},
-std::array<float,2>{0.294210345f, 0.633128941f},
-std::array<float,2>{0.24278906f, 0.0715460479f},
-std::array<float,2>{0.66422987f, 0.792179286f},
-std::array<float,2>{0.535154879f, 0.238359496f},
-std::array<float,2>{0.0291009154f, 0.995206356f},
-std::array<float,2>{0.456201404f, 0.261931121f},
-std::array<float,2>{0.793770909f, 0.547474384f},
-std::array<float,2>{0.747553408f, 0.314657867f},
-std::array<float,2>{0.141021714f, 0.598427773f},
-std::array<float,2>{0.343900323f, 0.164631292f},
-std::array<float,2>{0.942093194f, 0.893363535f},
-std::array<float,2>{0.850877106f, 0.00064384623f},
-std::array<float,2>{0.394374937f, 0.813835919f},
-std::array<float,2>{0.120073333f, 0.492911607f},
-std::array<float,2>{0.582388163f, 0.688145936f},
-std::array<float,2>{0.764934897f, 0.307069987f},
-std::array<float,2>{0.474440813f, 0.513559759f},
-std::array<float,2>{0.0391628742f, 0.207704395f},
-std::array<float,2>{0.51461637f, 0.947843909f},
-std::array<float,2>{0.642908812f, 0.102720886f},
-std::array<float,2>{0.209120333f, 0.763519943f},
-std::array<float,2>{0.261709839f, 0.408614099f},
-std::array<float,2>{0.886213243f, 0.657165647f},
-std::array<float,2>{0.618003309f, 0.456228346f},
-std::array<float,2>{0.0861523598f, 0.722360075f},
-std::array<float,2>{0.418714821f, 0.038844347f},
-std::array<float,2>{0.828632534f, 0.862770259f},
-std::array<float,2>{0.991429806f, 0.147006601f},
-std::array<float,2>{0.312813818f, 0.935056627f},
-std::array<float,2>{0.180279702f, 0.3731848f},
-std::array<float,2>{0.713994443f, 0.590387583f},
-std::array<float,2>{0.781429946f, 0.420636684f},
-std::array<float,2>{0.467592061f, 0.664560318f},
-std::array<float,2>{0.0157293249f, 0.0964604244f},
-std::array<float,2>{0.546823204f, 0.751722991f},
-std::array<float,2>{0.656827807f, 0.212615803f},
-std::array<float,2>{0.239179775f, 0.938491106f},
-std::array<float,2>{0.28812924f, 0.297740996f},
-std::array<float,2>{0.920512974f, 0.502622187f},
-std::array<float,2>{0.586512744f, 0.36222294f},
-std::array<float,2>{0.114886157f, 0.578436434f},
-std::array<float,2>{0.401074648f, 0.149519473f},
-std::array<float,2>{0.854389548f, 0.928646028f},
-std::array<float,2>{0.948082864f, 0.0407681391f},
-std::array<float,2>{0.35681352f, 0.870783389f},
-std::array<float,2>{0.148881912f, 0.462559193f},
-std::array<float,2>{0.739266872f, 0.731069803f},
-std::array<float,2>{0.87951535f, 0.25687176f},
-std::array<float,2>{0.251891762f, 0.560823679f},
-std::array<float,2>{0.215896234f, 0.245015085f},
-std::array<float,2>{0.651100278f, 0.991866946f},
-std::array<float,2>{0.505964518f, 0.0650169402f},
-std::array<float,2>{0.0389494523f, 0.78567481f},
-std::array<float,2>{0.477443397f, 0.377423048f},
-std::array<float,2>{0.750530005f, 0.627929211f},
-std::array<float,2>{0.707657695f, 0.487304151f},
-std::array<float,2>{0.175106809f, 0.701106489f},
-std::array<float,2>{0.325336993f, 0.0147416946f},
-std::array<float,2>{0.997025311f, 0.826785922f},
-std::array<float,2>{0.843473494f, 0.159579888f},
-std::array<float,2>{0.408353209f, 0.905383885f},
-std::array<float,2>{0.0800140426f, 0.327173382f},
-std::array<float,2>{0.609588325f, 0.605894029f},
-std::array<float,2>{0.973991871f, 0.449414343f},
-std::array<float,2>{0.33135879f, 0.740403891f},
-std::array<float,2>{0.159178525f, 0.0583220534f},
-std::array<float,2>{0.695632756f, 0.856853008f},
-std::array<float,2>{0.59853369f, 0.128190845f},
-std::array<float,2>{0.0677614585f, 0.91043669f},
-std::array<float,2>{0.4306207f, 0.346620351f},
-std::array<float,2>{0.819950581f, 0.56610781f},
-std::array<float,2>{0.628133297f, 0.295437187f},
-std::array<float,2>{0.194707081f, 0.519852698f},
-std::array<float,2>{0.276886374f, 0.189387694f},
-std::array<float,2>{0.896426857f, 0.95584017f},
-std::array<float,2>{0.779859483f, 0.12457446f},
-std::array<float,2>{0.486280531f, 0.766801119f},
-std::array<float,2>{0.0571752116f, 0.436132818f},
-std::array<float,2>{0.525710046f, 0.673525751f},
-std::array<float,2>{0.874718308f, 0.32948631f},
-std::array<float,2>{0.383575588f, 0.624375105f},
-std::array<float,2>{0.0950522646f, 0.173047245f},
-std::array<float,2>{0.575621903f, 0.883621037f},
-std::array<float,2>{0.722367227f, 0.0242583733f},
-std::array<float,2>{0.125060186f, 0.829955399f},
-std::array<float,2>{0.374994546f, 0.481335342f},
-std::array<float,2>{0.966665149f, 0.714888573f},
-std::array<float,2>{0.556358159f, 0.396541327f},
-std::array<float,2>{0.000277693005f, 0.646052837f},
-std::array<float,2>{0.44882077f, 0.0932574943f},
-std::array<float,2>{0.810174763f, 0.805506587f},
-std::array<float,2>{0.925374687f, 0.226176098f},
-std::array<float,2>{0.30565393f, 0.970303535f},
-std::array<float,2>{0.231001586f, 0.266022712f},
-std::array<float,2>{0.674006522f, 0.534220576f},
-std::array<float,2>{0.858419299f, 0.403102845f},
-std::array<float,2>{0.404618949f, 0.651654363f},
-std::array<float,2>{0.111356542f, 0.0817456841f},
-std::array<float,2>{0.592311203f, 0.803824544f},
-std::array<float,2>{0.737671077f, 0.232190087f},
-std::array<float,2>{0.156213716f, 0.979551852f},
-std::array<float,2>{0.352134287f, 0.27385357f},
-std::array<float,2>{0.951456785f, 0.546509624f},
-std::array<float,2>{0.540846527f, 0.337599963f},
-std::array<float,2>{0.0220300909f, 0.616378307f},
-std::array<float,2>{0.462265611f, 0.180597454f},
-std::array<float,2>{0.78687799f, 0.880602241f},
-std::array<float,2>{0.914216995f, 0.0175264068f},
-std::array<float,2>{0.282244414f, 0.838784933f},
-std::array<float,2>{0.236637995f, 0.471496016f},
-std::array<float,2>{0.663091362f, 0.708681881f},
-std::array<float,2>{0.993852019f, 0.281377673f},
-std::array<float,2>{0.321908921f, 0.529306948f},
-std::array<float,2>{0.179409415f, 0.201642945f},
-std::array<float,2>{0.706803143f, 0.96844846f},
-std::array<float,2>{0.615200818f, 0.111251988f},
-std::array<float,2>{0.083117418f, 0.779803097f},
-std::array<float,2>{0.410205632f, 0.427309424f},
-std::array<float,2>{0.837975204f, 0.681759715f},
-std::array<float,2>{0.656039774f, 0.438344121f},
-std::array<float,2>{0.212528139f, 0.748171568f},
-std::array<float,2>{0.257449031f, 0.0534962341f},
-std::array<float,2>{0.876516998f, 0.850566566f},
-std::array<float,2>{0.756157219f, 0.139722317f},
-std::array<float,2>{0.48123917f, 0.914702654f},
-std::array<float,2>{0.0332828946f, 0.352860868f},
-std::array<float,2>{0.502382159f, 0.572642088f},
-std::array<float,2>{0.893680155f, 0.497065008f},
-std::array<float,2>{0.280229926f, 0.692644656f},
-std::array<float,2>{0.188334778f, 0.00701149181f},
-std::array<float,2>{0.629202306f, 0.820026815f},
-std::array<float,2>{0.529031754f, 0.168202683f},
-std::array<float,2>{0.0617002286f, 0.898062468f},
-std::array<float,2>{0.491034299f, 0.317157805f},
-std::array<float,2>{0.776903927f, 0.595120132f},
-std::array<float,2>{0.700659633f, 0.260800004f},
-std::array<float,2>{0.163313657f, 0.551348567f},
-std::array<float,2>{0.333199173f, 0.235609919f},
-std::array<float,2>{0.972252071f, 0.999093175f},
-std::array<float,2>{0.81467706f, 0.0780249462f},
-std::array<float,2>{0.436078668f, 0.794199705f},
-std::array<float,2>{0.063367635f, 0.39054203f},
-std::array<float,2>{0.596126497f, 0.639384329f},
-std::array<float,2>{0.80766362f, 0.370680958f},
-std::array<float,2>{0.452269167f, 0.586180031f},
-std::array<float,2>{0.00709455973f, 0.142366856f},
-std::array<float,2>{0.561136723f, 0.932941318f},
-std::array<float,2>{0.677672982f, 0.0318553448f},
-std::array<float,2>{0.230305865f, 0.864672601f},
-std::array<float,2>{0.311469764f, 0.459220141f},
-std::array<float,2>{0.929003417f, 0.726172984f},
-std::array<float,2>{0.572316468f, 0.413879931f},
-std::array<float,2>{0.0980495289f, 0.662771463f},
-std::array<float,2>{0.390575707f, 0.108731791f},
-std::array<float,2>{0.870680392f, 0.761158168f},
-std::array<float,2>{0.964841306f, 0.206998229f},
-std::array<float,2>{0.369532377f, 0.951499879f},
-std::array<float,2>{0.131578833f, 0.311438739f},
-std::array<float,2>{0.726040781f, 0.508365273f},
-std::array<float,2>{0.772488058f, 0.466984689f},
-std::array<float,2>{0.498304188f, 0.72792232f},
-std::array<float,2>{0.0494511724f, 0.0446167402f},
-std::array<float,2>{0.517048478f, 0.874767363f},
-std::array<float,2>{0.636289358f, 0.152594849f},
-std::array<float,2>{0.199750721f, 0.922215581f},
-std::array<float,2>{0.26979515f, 0.364163995f},
-std::array<float,2>{0.901672125f, 0.583841443f},
-std::array<float,2>{0.604145467f, 0.302089214f},
-std::array<float,2>{0.0743615627f, 0.505155563f},
-std::array<float,2>{0.425499439f, 0.215757117f},
-std::array<float,2>{0.82735759f, 0.942465186f},
-std::array<float,2>{0.981639862f, 0.100134477f},
-std::array<float,2>{0.342897743f, 0.756719768f},
-std::array<float,2>{0.167648196f, 0.416958928f},
-std::array<float,2>{0.691763937f, 0.6711604f},
-std::array<float,2>{0.931176603f, 0.32417053f},
-std::array<float,2>{0.30029875f, 0.604946673f},
-std::array<float,2>{0.224065229f, 0.161466151f},
-std::array<float,2>{0.687055886f, 0.90040493f},
-std::array<float,2>{0.548894644f, 0.0094524296f},
-std::array<float,2>{0.00781276543f, 0.822945237f},
-std::array<float,2>{0.442563385f, 0.490396142f},
-std::array<float,2>{0.797876239f, 0.696710408f},
-std::array<float,2>{0.727031052f, 0.381136298f},
-std::array<float,2>{0.133041814f, 0.629874289f},
-std::array<float,2>{0.365841269f, 0.0672130734f},
-std::array<float,2>{0.957322776f, 0.781581223f},
-std::array<float,2>{0.862980425f, 0.246220499f},
-std::array<float,2>{0.376850545f, 0.986480832f},
-std::array<float,2>{0.109361127f, 0.250185281f},
-std::array<float,2>{0.565802217f, 0.55644995f},
-std::array<float,2>{0.939263463f, 0.43039158f},
-std::array<float,2>{0.351457119f, 0.676867783f},
-std::array<float,2>{0.146342337f, 0.118549749f},
-std::array<float,2>{0.74608165f, 0.771281481f},
-std::array<float,2>{0.581519246f, 0.192730725f},
-std::array<float,2>{0.123481773f, 0.959959447f},
-std::array<float,2>{0.395178974f, 0.289549381f},
-std::array<float,2>{0.8462556f, 0.515862882f},
-std::array<float,2>{0.668163955f, 0.351532727f},
-std::array<float,2>{0.248087838f, 0.5682019f},
-std::array<float,2>{0.291782141f, 0.131778732f},
-std::array<float,2>{0.907099843f, 0.909763753f},
-std::array<float,2>{0.790465891f, 0.0599222556f},
-std::array<float,2>{0.459701985f, 0.854483068f},
-std::array<float,2>{0.0267521515f, 0.449050128f},
-std::array<float,2>{0.536715984f, 0.737017035f},
-std::array<float,2>{0.833896935f, 0.27119872f},
-std::array<float,2>{0.415934354f, 0.537307441f},
-std::array<float,2>{0.0932865515f, 0.219790414f},
-std::array<float,2>{0.624183059f, 0.975312173f},
-std::array<float,2>{0.716523647f, 0.0875366181f},
-std::array<float,2>{0.186330914f, 0.810929596f},
-std::array<float,2>{0.316546589f, 0.393012583f},
-std::array<float,2>{0.986256838f, 0.64105171f},
-std::array<float,2>{0.508184493f, 0.479033381f},
-std::array<float,2>{0.0467042625f, 0.711469114f},
-std::array<float,2>{0.471722215f, 0.0307425801f},
-std::array<float,2>{0.759924412f, 0.834171712f},
-std::array<float,2>{0.889884889f, 0.178397074f},
-std::array<float,2>{0.264189988f, 0.888615489f},
-std::array<float,2>{0.206422776f, 0.335705191f},
-std::array<float,2>{0.64591831f, 0.618611634f},
-std::array<float,2>{0.865982652f, 0.442141682f},
-std::array<float,2>{0.382134199f, 0.743355095f},
-std::array<float,2>{0.104540028f, 0.0494533256f},
-std::array<float,2>{0.568226993f, 0.844008505f},
-std::array<float,2>{0.731329501f, 0.132859662f},
-std::array<float,2>{0.139715418f, 0.921443224f},
-std::array<float,2>{0.362882435f, 0.356438428f},
-std::array<float,2>{0.955990493f, 0.574943066f},
-std::array<float,2>{0.55466038f, 0.285588264f},
-std::array<float,2>{0.0148932729f, 0.524400532f},
-std::array<float,2>{0.438058645f, 0.198431581f},
-std::array<float,2>{0.802061617f, 0.964320838f},
-std::array<float,2>{0.935777366f, 0.115081444f},
-std::array<float,2>{0.304034919f, 0.774036586f},
-std::array<float,2>{0.222305074f, 0.424429089f},
-std::array<float,2>{0.682381749f, 0.684452474f},
-std::array<float,2>{0.980336189f, 0.34007284f},
-std::array<float,2>{0.33881551f, 0.609652042f},
-std::array<float,2>{0.171475232f, 0.187376007f},
-std::array<float,2>{0.688811123f, 0.878418446f},
-std::array<float,2>{0.606822193f, 0.0209269915f},
-std::array<float,2>{0.0723704696f, 0.842138529f},
-std::array<float,2>{0.427054733f, 0.474757373f},
-std::array<float,2>{0.822838247f, 0.705805838f},
-std::array<float,2>{0.640243649f, 0.399846256f},
-std::array<float,2>{0.198711067f, 0.654509902f},
-std::array<float,2>{0.265916258f, 0.0820900947f},
-std::array<float,2>{0.90304023f, 0.800581336f},
-std::array<float,2>{0.765803456f, 0.229687572f},
-std::array<float,2>{0.495100945f, 0.983596802f},
-std::array<float,2>{0.053915225f, 0.279102117f},
-std::array<float,2>{0.521130264f, 0.540911317f},
-std::array<float,2>{0.882939279f, 0.406667441f},
-std::array<float,2>{0.259675354f, 0.658766389f},
-std::array<float,2>{0.207087085f, 0.104257241f},
-std::array<float,2>{0.641555727f, 0.763918281f},
-std::array<float,2>{0.512627125f, 0.210888803f},
-std::array<float,2>{0.0414581522f, 0.947081923f},
-std::array<float,2>{0.475241899f, 0.306002825f},
-std::array<float,2>{0.763120949f, 0.51477325f},
-std::array<float,2>{0.712399125f, 0.371998549f},
-std::array<float,2>{0.18274872f, 0.592583179f},
-std::array<float,2>{0.316290051f, 0.145943999f},
-std::array<float,2>{0.988926888f, 0.936686993f},
-std::array<float,2>{0.832012475f, 0.0362961479f},
-std::array<float,2>{0.420094609f, 0.861007452f},
-std::array<float,2>{0.0887935013f, 0.454903871f},
-std::array<float,2>{0.621061862f, 0.719747663f},
-std::array<float,2>{0.795071781f, 0.263902783f},
-std::array<float,2>{0.453703046f, 0.550233722f},
-std::array<float,2>{0.0302557964f, 0.240390852f},
-std::array<float,2>{0.532926202f, 0.993303001f},
-std::array<float,2>{0.667127669f, 0.0732164606f},
-std::array<float,2>{0.24491924f, 0.790175319f},
-std::array<float,2>{0.295941263f, 0.384563357f},
-std::array<float,2>{0.910571992f, 0.636198103f},
-std::array<float,2>{0.5846349f, 0.49499768f},
-std::array<float,2>{0.118359916f, 0.690191686f},
-std::array<float,2>{0.392056257f, 0.00304724416f},
-std::array<float,2>{0.84824425f, 0.816301703f},
-std::array<float,2>{0.943932831f, 0.166109532f},
-std::array<float,2>{0.346317083f, 0.890669763f},
-std::array<float,2>{0.143408209f, 0.312507749f},
-std::array<float,2>{0.748076379f, 0.601362109f},
-std::array<float,2>{0.753418207f, 0.376788497f},
-std::array<float,2>{0.479491353f, 0.625441074f},
-std::array<float,2>{0.0367181562f, 0.064267464f},
-std::array<float,2>{0.504840195f, 0.788670897f},
-std::array<float,2>{0.648898482f, 0.243309721f},
-std::array<float,2>{0.217114925f, 0.989002168f},
-std::array<float,2>{0.25293678f, 0.254308939f},
-std::array<float,2>{0.881732643f, 0.559224725f},
-std::array<float,2>{0.612524867f, 0.324431092f},
-std::array<float,2>{0.0803504363f, 0.607823551f},
-std::array<float,2>{0.408174217f, 0.157770917f},
-std::array<float,2>{0.840165973f, 0.903546691f},
-std::array<float,2>{0.999081075f, 0.0135312146f},
-std::array<float,2>{0.327751994f, 0.826077402f},
-std::array<float,2>{0.172084212f, 0.485768437f},
-std::array<float,2>{0.709172666f, 0.702865005f},
-std::array<float,2>{0.918841004f, 0.300525486f},
-std::array<float,2>{0.286325544f, 0.501777232f},
-std::array<float,2>{0.241716176f, 0.213105053f},
-std::array<float,2>{0.659718156f, 0.940653384f},
-std::array<float,2>{0.543851435f, 0.0952645913f},
-std::array<float,2>{0.0192762315f, 0.753237188f},
-std::array<float,2>{0.465287566f, 0.418306649f},
-std::array<float,2>{0.784226418f, 0.666954935f},
-std::array<float,2>{0.742082894f, 0.464208335f},
-std::array<float,2>{0.150865957f, 0.733302593f},
-std::array<float,2>{0.358106375f, 0.0423926301f},
-std::array<float,2>{0.946453691f, 0.869009137f},
-std::array<float,2>{0.853112578f, 0.152036399f},
-std::array<float,2>{0.399693519f, 0.926745057f},
-std::array<float,2>{0.116874434f, 0.360759526f},
-std::array<float,2>{0.588569701f, 0.580764353f},
-std::array<float,2>{0.96682936f, 0.483198494f},
-std::array<float,2>{0.372802824f, 0.718399465f},
-std::array<float,2>{0.127998829f, 0.0254283957f},
-std::array<float,2>{0.718981564f, 0.831323981f},
-std::array<float,2>{0.576263368f, 0.175707176f},
-std::array<float,2>{0.0958422646f, 0.886611581f},
-std::array<float,2>{0.385751903f, 0.330907315f},
-std::array<float,2>{0.873006046f, 0.622161508f},
-std::array<float,2>{0.673379481f, 0.268622011f},
-std::array<float,2>{0.233768046f, 0.532495141f},
-std::array<float,2>{0.307014436f, 0.224249423f},
-std::array<float,2>{0.92317009f, 0.972283661f},
-std::array<float,2>{0.81060344f, 0.0909957588f},
-std::array<float,2>{0.445725918f, 0.808577597f},
-std::array<float,2>{0.0031970297f, 0.395834178f},
-std::array<float,2>{0.557001114f, 0.646621466f},
-std::array<float,2>{0.817342401f, 0.345602661f},
-std::array<float,2>{0.432197988f, 0.563322127f},
-std::array<float,2>{0.0688533187f, 0.126569316f},
-std::array<float,2>{0.60025382f, 0.912800789f},
-std::array<float,2>{0.698569775f, 0.0557233617f},
-std::array<float,2>{0.157782272f, 0.857610345f},
-std::array<float,2>{0.329036355f, 0.451547354f},
-std::array<float,2>{0.974868298f, 0.738885522f},
-std::array<float,2>{0.52426374f, 0.434236228f},
-std::array<float,2>{0.0554273203f, 0.675163269f},
-std::array<float,2>{0.487373322f, 0.122835405f},
-std::array<float,2>{0.778296351f, 0.768109024f},
-std::array<float,2>{0.898245513f, 0.189619914f},
-std::array<float,2>{0.274674028f, 0.953867257f},
-std::array<float,2>{0.192090124f, 0.293627769f},
-std::array<float,2>{0.626555622f, 0.521686077f},
-std::array<float,2>{0.83785212f, 0.42884919f},
-std::array<float,2>{0.41320616f, 0.680208147f},
-std::array<float,2>{0.0851451457f, 0.111894086f},
-std::array<float,2>{0.617166221f, 0.777726471f},
-std::array<float,2>{0.703894258f, 0.200684533f},
-std::array<float,2>{0.175916359f, 0.964931965f},
-std::array<float,2>{0.322979867f, 0.28455317f},
-std::array<float,2>{0.995789409f, 0.527554095f},
-std::array<float,2>{0.500138998f, 0.355136871f},
-std::array<float,2>{0.0329846255f, 0.571582377f},
-std::array<float,2>{0.48258993f, 0.13762176f},
-std::array<float,2>{0.754000962f, 0.916860044f},
-std::array<float,2>{0.878894806f, 0.0509752408f},
-std::array<float,2>{0.255534232f, 0.848391473f},
-std::array<float,2>{0.214755222f, 0.440407753f},
-std::array<float,2>{0.654193938f, 0.746560872f},
-std::array<float,2>{0.951058686f, 0.277026206f},
-std::array<float,2>{0.354141146f, 0.542985618f},
-std::array<float,2>{0.152785376f, 0.233395413f},
-std::array<float,2>{0.734444022f, 0.977564156f},
-std::array<float,2>{0.590866029f, 0.0794814453f},
-std::array<float,2>{0.110164918f, 0.800913513f},
-std::array<float,2>{0.40289256f, 0.405955523f},
-std::array<float,2>{0.857152581f, 0.648905754f},
-std::array<float,2>{0.660884917f, 0.469849169f},
-std::array<float,2>{0.234611079f, 0.709467292f},
-std::array<float,2>{0.283267081f, 0.0186504088f},
-std::array<float,2>{0.916836143f, 0.836544394f},
-std::array<float,2>{0.78716433f, 0.18296209f},
-std::array<float,2>{0.464361161f, 0.881976485f},
-std::array<float,2>{0.0209355038f, 0.33867687f},
-std::array<float,2>{0.541349709f, 0.614397228f},
-std::array<float,2>{0.926625788f, 0.45805192f},
-std::array<float,2>{0.309746861f, 0.723020792f},
-std::array<float,2>{0.226892695f, 0.0351218879f},
-std::array<float,2>{0.67846483f, 0.866538703f},
-std::array<float,2>{0.5602566f, 0.144029737f},
-std::array<float,2>{0.00521353073f, 0.931324959f},
-std::array<float,2>{0.449234068f, 0.367642254f},
-std::array<float,2>{0.805674136f, 0.589713275f},
-std::array<float,2>{0.724207401f, 0.309825271f},
-std::array<float,2>{0.129622892f, 0.510959268f},
-std::array<float,2>{0.367454886f, 0.204004914f},
-std::array<float,2>{0.961020708f, 0.950044692f},
-std::array<float,2>{0.867384672f, 0.105902694f},
-std::array<float,2>{0.387290657f, 0.757992268f},
-std::array<float,2>{0.100781158f, 0.411290675f},
-std::array<float,2>{0.570334971f, 0.661128581f},
-std::array<float,2>{0.774722815f, 0.320006251f},
-std::array<float,2>{0.490057737f, 0.595987976f},
-std::array<float,2>{0.0603744015f, 0.170998797f},
-std::array<float,2>{0.529796124f, 0.896221876f},
-std::array<float,2>{0.631991923f, 0.00537141087f},
-std::array<float,2>{0.190293297f, 0.818263054f},
-std::array<float,2>{0.278887719f, 0.499369562f},
-std::array<float,2>{0.891777873f, 0.695201516f},
-std::array<float,2>{0.594766438f, 0.387162477f},
-std::array<float,2>{0.0647205263f, 0.637412488f},
-std::array<float,2>{0.435443193f, 0.0749594271f},
-std::array<float,2>{0.812669933f, 0.796238422f},
-std::array<float,2>{0.969382107f, 0.237917542f},
-std::array<float,2>{0.335077196f, 0.996944427f},
-std::array<float,2>{0.162063688f, 0.259513021f},
-std::array<float,2>{0.702212572f, 0.554113448f},
-std::array<float,2>{0.800581992f, 0.488311559f},
-std::array<float,2>{0.444358855f, 0.698652208f},
-std::array<float,2>{0.0106346849f, 0.0116887912f},
-std::array<float,2>{0.547744691f, 0.820770204f},
-std::array<float,2>{0.684389293f, 0.162725195f},
-std::array<float,2>{0.225144565f, 0.899929464f},
-std::array<float,2>{0.297011226f, 0.321474165f},
-std::array<float,2>{0.933043182f, 0.602901757f},
-std::array<float,2>{0.563524544f, 0.252459168f},
-std::array<float,2>{0.106248155f, 0.558069944f},
-std::array<float,2>{0.377946377f, 0.249980316f},
-std::array<float,2>{0.861194551f, 0.98524195f},
-std::array<float,2>{0.960551143f, 0.0699058548f},
-std::array<float,2>{0.365193427f, 0.784444392f},
-std::array<float,2>{0.135492459f, 0.379351348f},
-std::array<float,2>{0.729665756f, 0.631268382f},
-std::array<float,2>{0.899748027f, 0.365728945f},
-std::array<float,2>{0.271743536f, 0.585161209f},
-std::array<float,2>{0.202053592f, 0.154364735f},
-std::array<float,2>{0.6331985f, 0.924424291f},
-std::array<float,2>{0.518788517f, 0.0454840623f},
-std::array<float,2>{0.0476752669f, 0.872134686f},
-std::array<float,2>{0.497069657f, 0.465080708f},
-std::array<float,2>{0.770136416f, 0.73019582f},
-std::array<float,2>{0.693636358f, 0.415021926f},
-std::array<float,2>{0.164811507f, 0.669343591f},
-std::array<float,2>{0.341361344f, 0.0988634974f},
-std::array<float,2>{0.984176278f, 0.754380643f},
-std::array<float,2>{0.824527025f, 0.218087167f},
-std::array<float,2>{0.42250064f, 0.943687856f},
-std::array<float,2>{0.076952152f, 0.304442048f},
-std::array<float,2>{0.60318172f, 0.506403804f},
-std::array<float,2>{0.987052321f, 0.391682923f},
-std::array<float,2>{0.319277465f, 0.643756926f},
-std::array<float,2>{0.184495717f, 0.0894669518f},
-std::array<float,2>{0.717932045f, 0.809095144f},
-std::array<float,2>{0.621592283f, 0.221163526f},
-std::array<float,2>{0.0913193673f, 0.972780347f},
-std::array<float,2>{0.416933924f, 0.271532744f},
-std::array<float,2>{0.835355818f, 0.536446929f},
-std::array<float,2>{0.648431599f, 0.33273524f},
-std::array<float,2>{0.204259321f, 0.619724333f},
-std::array<float,2>{0.26204288f, 0.176196679f},
-std::array<float,2>{0.888544559f, 0.889569104f},
-std::array<float,2>{0.758917332f, 0.0275126882f},
-std::array<float,2>{0.469812095f, 0.832096934f},
-std::array<float,2>{0.0447569154f, 0.476914674f},
-std::array<float,2>{0.510022819f, 0.714769006f},
-std::array<float,2>{0.845567048f, 0.29145506f},
-std::array<float,2>{0.397923797f, 0.51938504f},
-std::array<float,2>{0.122675449f, 0.195116535f},
-std::array<float,2>{0.579632282f, 0.957589447f},
-std::array<float,2>{0.74286896f, 0.120933466f},
-std::array<float,2>{0.14683646f, 0.772457838f},
-std::array<float,2>{0.348414451f, 0.432629138f},
-std::array<float,2>{0.940126836f, 0.678216994f},
-std::array<float,2>{0.538288713f, 0.445617884f},
-std::array<float,2>{0.0247338973f, 0.735583484f},
-std::array<float,2>{0.457078665f, 0.0618850775f},
-std::array<float,2>{0.792161942f, 0.853314638f},
-std::array<float,2>{0.908888996f, 0.129622519f},
-std::array<float,2>{0.289434195f, 0.90735513f},
-std::array<float,2>{0.246856943f, 0.349339902f},
-std::array<float,2>{0.670983732f, 0.570180237f},
-std::array<float,2>{0.848660886f, 0.493723541f},
-std::array<float,2>{0.391245127f, 0.688678682f},
-std::array<float,2>{0.117819749f, 0.00139626663f},
-std::array<float,2>{0.585066199f, 0.813078165f},
-std::array<float,2>{0.749024332f, 0.165139064f},
-std::array<float,2>{0.143737003f, 0.893854856f},
-std::array<float,2>{0.347377002f, 0.316167623f},
-std::array<float,2>{0.944449604f, 0.59893012f},
-std::array<float,2>{0.5313766f, 0.262778699f},
-std::array<float,2>{0.0302840639f, 0.548132181f},
-std::array<float,2>{0.454873025f, 0.239459276f},
-std::array<float,2>{0.796875f, 0.994966209f},
-std::array<float,2>{0.911956549f, 0.0712475553f},
-std::array<float,2>{0.295033813f, 0.791367471f},
-std::array<float,2>{0.24564071f, 0.385785043f},
-std::array<float,2>{0.666021347f, 0.634282351f},
-std::array<float,2>{0.989320338f, 0.374796182f},
-std::array<float,2>{0.315345109f, 0.5912866f},
-std::array<float,2>{0.182362303f, 0.148068368f},
-std::array<float,2>{0.71128124f, 0.933983028f},
-std::array<float,2>{0.61961776f, 0.0375083797f},
-std::array<float,2>{0.0893177316f, 0.862090886f},
-std::array<float,2>{0.421536833f, 0.456049472f},
-std::array<float,2>{0.830310822f, 0.721314609f},
-std::array<float,2>{0.642138004f, 0.409465015f},
-std::array<float,2>{0.208483174f, 0.657386124f},
-std::array<float,2>{0.258734316f, 0.101880491f},
-std::array<float,2>{0.88436681f, 0.762317538f},
-std::array<float,2>{0.762099087f, 0.208653644f},
-std::array<float,2>{0.476126343f, 0.948493659f},
-std::array<float,2>{0.042383559f, 0.307860613f},
-std::array<float,2>{0.513472855f, 0.512658477f},
-std::array<float,2>{0.903561771f, 0.400440425f},
-std::array<float,2>{0.26685828f, 0.6523875f},
-std::array<float,2>{0.197851256f, 0.0856955722f},
-std::array<float,2>{0.639109612f, 0.797032952f},
-std::array<float,2>{0.520099521f, 0.227362931f},
-std::array<float,2>{0.0534752011f, 0.980756164f},
-std::array<float,2>{0.495523661f, 0.280256212f},
-std::array<float,2>{0.76722151f, 0.541782677f},
-std::array<float,2>{0.68805629f, 0.341988802f},
-std::array<float,2>{0.170428365f, 0.611966252f},
-std::array<float,2>{0.339578927f, 0.185156778f},
-std::array<float,2>{0.978708506f, 0.875132442f},
-std::array<float,2>{0.823313713f, 0.0228944123f},
-std::array<float,2>{0.426022202f, 0.840126514f},
-std::array<float,2>{0.0739294812f, 0.474174351f},
-std::array<float,2>{0.605540395f, 0.703216016f},
-std::array<float,2>{0.801350057f, 0.287825614f},
-std::array<float,2>{0.438796222f, 0.525929868f},
-std::array<float,2>{0.0137830414f, 0.197004139f},
-std::array<float,2>{0.552956522f, 0.961213529f},
-std::array<float,2>{0.683009326f, 0.117099427f},
-std::array<float,2>{0.221521139f, 0.777081311f},
-std::array<float,2>{0.302930117f, 0.423672199f},
-std::array<float,2>{0.936813831f, 0.686486244f},
-std::array<float,2>{0.566729665f, 0.444033086f},
-std::array<float,2>{0.104069054f, 0.744870067f},
-std::array<float,2>{0.381418526f, 0.0476141982f},
-std::array<float,2>{0.866485417f, 0.84751153f},
-std::array<float,2>{0.956468344f, 0.136694267f},
-std::array<float,2>{0.362033069f, 0.919126213f},
-std::array<float,2>{0.139254928f, 0.358114034f},
-std::array<float,2>{0.731992304f, 0.576176465f},
-std::array<float,2>{0.77848345f, 0.436892629f},
-std::array<float,2>{0.487150162f, 0.671910465f},
-std::array<float,2>{0.0562666431f, 0.123606943f},
-std::array<float,2>{0.524679422f, 0.765808642f},
-std::array<float,2>{0.625054121f, 0.188374609f},
-std::array<float,2>{0.193148047f, 0.956800818f},
-std::array<float,2>{0.274184167f, 0.296530426f},
-std::array<float,2>{0.897202611f, 0.521406114f},
-std::array<float,2>{0.600814581f, 0.347339451f},
-std::array<float,2>{0.0700526908f, 0.564790368f},
-std::array<float,2>{0.433398068f, 0.127149105f},
-std::array<float,2>{0.817569137f, 0.911281884f},
-std::array<float,2>{0.975813031f, 0.0575185716f},
-std::array<float,2>{0.32985279f, 0.856257558f},
-std::array<float,2>{0.15679197f, 0.45056203f},
-std::array<float,2>{0.697658479f, 0.741872668f},
-std::array<float,2>{0.922198713f, 0.267503202f},
-std::array<float,2>{0.308104724f, 0.533583105f},
-std::array<float,2>{0.232547835f, 0.22518234f},
-std::array<float,2>{0.672446549f, 0.969297826f},
-std::array<float,2>{0.558504879f, 0.0922903344f},
-std::array<float,2>{0.00264993892f, 0.806302309f},
-std::array<float,2>{0.446290314f, 0.398254246f},
-std::array<float,2>{0.812245011f, 0.644919932f},
-std::array<float,2>{0.720685422f, 0.482052773f},
-std::array<float,2>{0.127778247f, 0.715942204f},
-std::array<float,2>{0.371250302f, 0.0251773689f},
-std::array<float,2>{0.968612373f, 0.82897383f},
-std::array<float,2>{0.871803224f, 0.172788486f},
-std::array<float,2>{0.384902537f, 0.884310663f},
-std::array<float,2>{0.0970206633f, 0.328564912f},
-std::array<float,2>{0.578116059f, 0.623941004f},
-std::array<float,2>{0.945545256f, 0.4614591f},
-std::array<float,2>{0.358732015f, 0.732139647f},
-std::array<float,2>{0.151684657f, 0.0399098806f},
-std::array<float,2>{0.740396559f, 0.86998415f},
-std::array<float,2>{0.589149833f, 0.14932397f},
-std::array<float,2>{0.115238346f, 0.92968303f},
-std::array<float,2>{0.398899764f, 0.362373233f},
-std::array<float,2>{0.851788819f, 0.579937041f},
-std::array<float,2>{0.658641994f, 0.298493683f},
-std::array<float,2>{0.240481853f, 0.50354135f},
-std::array<float,2>{0.286046565f, 0.211404592f},
-std::array<float,2>{0.919091463f, 0.937580347f},
-std::array<float,2>{0.783482015f, 0.0970932245f},
-std::array<float,2>{0.465944827f, 0.750465989f},
-std::array<float,2>{0.0182318762f, 0.421717495f},
-std::array<float,2>{0.544250309f, 0.665846348f},
-std::array<float,2>{0.841697872f, 0.326215148f},
-std::array<float,2>{0.406474859f, 0.606960714f},
-std::array<float,2>{0.0818510503f, 0.158733085f},
-std::array<float,2>{0.611592054f, 0.904663265f},
-std::array<float,2>{0.71002394f, 0.0143142967f},
-std::array<float,2>{0.173821986f, 0.827376485f},
-std::array<float,2>{0.326400399f, 0.487802029f},
-std::array<float,2>{0.998911977f, 0.699911118f},
-std::array<float,2>{0.50557977f, 0.378471524f},
-std::array<float,2>{0.0361245126f, 0.628362656f},
-std::array<float,2>{0.479795665f, 0.0656588748f},
-std::array<float,2>{0.75274241f, 0.786547482f},
-std::array<float,2>{0.882446468f, 0.245978996f},
-std::array<float,2>{0.252542853f, 0.99039036f},
-std::array<float,2>{0.218247816f, 0.256357372f},
-std::array<float,2>{0.649723411f, 0.562002003f},
-std::array<float,2>{0.814216018f, 0.389287621f},
-std::array<float,2>{0.43440333f, 0.640258253f},
-std::array<float,2>{0.066166155f, 0.0767793506f},
-std::array<float,2>{0.594206631f, 0.793069541f},
-std::array<float,2>{0.701575935f, 0.235328361f},
-std::array<float,2>{0.161054313f, 0.998803258f},
-std::array<float,2>{0.334613144f, 0.260644466f},
-std::array<float,2>{0.969985127f, 0.552397966f},
-std::array<float,2>{0.530535579f, 0.317871392f},
-std::array<float,2>{0.0587155186f, 0.594658613f},
-std::array<float,2>{0.488299429f, 0.169806495f},
-std::array<float,2>{0.77372402f, 0.89667815f},
-std::array<float,2>{0.891081333f, 0.00636802427f},
-std::array<float,2>{0.278237134f, 0.818637848f},
-std::array<float,2>{0.191056907f, 0.497541606f},
-std::array<float,2>{0.631149292f, 0.692247689f},
-std::array<float,2>{0.961988747f, 0.311827302f},
-std::array<float,2>{0.368765771f, 0.509423375f},
-std::array<float,2>{0.129993543f, 0.205637649f},
-std::array<float,2>{0.722914815f, 0.952659726f},
-std::array<float,2>{0.571393013f, 0.107608102f},
-std::array<float,2>{0.0999374837f, 0.759771287f},
-std::array<float,2>{0.388436973f, 0.413077831f},
-std::array<float,2>{0.868732035f, 0.663212597f},
-std::array<float,2>{0.678729057f, 0.460655391f},
-std::array<float,2>{0.227975324f, 0.725115657f},
-std::array<float,2>{0.309398711f, 0.0327025093f},
-std::array<float,2>{0.926895499f, 0.863422751f},
-std::array<float,2>{0.805188537f, 0.141187966f},
-std::array<float,2>{0.450620025f, 0.932470262f},
-std::array<float,2>{0.00448414311f, 0.369692773f},
-std::array<float,2>{0.559534252f, 0.58694309f},
-std::array<float,2>{0.917890668f, 0.472144306f},
-std::array<float,2>{0.284524173f, 0.70720619f},
-std::array<float,2>{0.235984385f, 0.0157818217f},
-std::array<float,2>{0.661297858f, 0.838947654f},
-std::array<float,2>{0.542015314f, 0.181210831f},
-std::array<float,2>{0.0195365921f, 0.879868329f},
-std::array<float,2>{0.463150978f, 0.336127222f},
-std::array<float,2>{0.788992941f, 0.615346491f},
-std::array<float,2>{0.736260355f, 0.27473262f},
-std::array<float,2>{0.153837189f, 0.545443058f},
-std::array<float,2>{0.354937285f, 0.231188878f},
-std::array<float,2>{0.94976151f, 0.979095519f},
-std::array<float,2>{0.856427073f, 0.0803405195f},
-std::array<float,2>{0.403850228f, 0.803239584f},
-std::array<float,2>{0.110618323f, 0.40343529f},
-std::array<float,2>{0.589915812f, 0.650847256f},
-std::array<float,2>{0.755292535f, 0.35226354f},
-std::array<float,2>{0.484216899f, 0.573346078f},
-std::array<float,2>{0.0319712237f, 0.139107957f},
-std::array<float,2>{0.5016765f, 0.915574789f},
-std::array<float,2>{0.653185725f, 0.0540863089f},
-std::array<float,2>{0.213529885f, 0.851284504f},
-std::array<float,2>{0.254157811f, 0.438495398f},
-std::array<float,2>{0.877258837f, 0.749303401f},
-std::array<float,2>{0.61601007f, 0.42621839f},
-std::array<float,2>{0.0848368779f, 0.683262527f},
-std::array<float,2>{0.412535518f, 0.109768555f},
-std::array<float,2>{0.836464226f, 0.781056941f},
-std::array<float,2>{0.994455814f, 0.202761114f},
-std::array<float,2>{0.323632687f, 0.96685195f},
-std::array<float,2>{0.177628711f, 0.28224805f},
-std::array<float,2>{0.704939902f, 0.530303776f},
-std::array<float,2>{0.791485727f, 0.448026925f},
-std::array<float,2>{0.458386451f, 0.737891614f},
-std::array<float,2>{0.0237846952f, 0.0592366308f},
-std::array<float,2>{0.537422001f, 0.854874372f},
-std::array<float,2>{0.670190334f, 0.13189359f},
-std::array<float,2>{0.247440413f, 0.908346355f},
-std::array<float,2>{0.290856391f, 0.349676549f},
-std::array<float,2>{0.909871459f, 0.567329764f},
-std::array<float,2>{0.578282833f, 0.29019776f},
-std::array<float,2>{0.121999696f, 0.517191887f},
-std::array<float,2>{0.397123128f, 0.19174163f},
-std::array<float,2>{0.844420373f, 0.960330307f},
-std::array<float,2>{0.941002548f, 0.117755219f},
-std::array<float,2>{0.349103659f, 0.769730449f},
-std::array<float,2>{0.147953346f, 0.431292027f},
-std::array<float,2>{0.743576586f, 0.675804317f},
-std::array<float,2>{0.887326598f, 0.334630758f},
-std::array<float,2>{0.262739122f, 0.617551863f},
-std::array<float,2>{0.203701168f, 0.178878099f},
-std::array<float,2>{0.646706402f, 0.886933446f},
-std::array<float,2>{0.511007726f, 0.029822519f},
-std::array<float,2>{0.0438827872f, 0.835433125f},
-std::array<float,2>{0.469386786f, 0.479809284f},
-std::array<float,2>{0.758125067f, 0.712300718f},
-std::array<float,2>{0.717395306f, 0.394437522f},
-std::array<float,2>{0.185047522f, 0.642343104f},
-std::array<float,2>{0.319915116f, 0.0863645449f},
-std::array<float,2>{0.988226175f, 0.811852336f},
-std::array<float,2>{0.834913433f, 0.218840927f},
-std::array<float,2>{0.417533964f, 0.975588977f},
-std::array<float,2>{0.089890033f, 0.269598007f},
-std::array<float,2>{0.622165024f, 0.538843989f},
-std::array<float,2>{0.983186543f, 0.417512864f},
-std::array<float,2>{0.34011969f, 0.670021772f},
-std::array<float,2>{0.165918007f, 0.101194344f},
-std::array<float,2>{0.694897473f, 0.757281184f},
-std::array<float,2>{0.60210216f, 0.21591121f},
-std::array<float,2>{0.0779763013f, 0.942304373f},
-std::array<float,2>{0.423720866f, 0.301424354f},
-std::array<float,2>{0.825234115f, 0.504195809f},
-std::array<float,2>{0.633903086f, 0.364281803f},
-std::array<float,2>{0.202886f, 0.582541764f},
-std::array<float,2>{0.273077697f, 0.153333828f},
-std::array<float,2>{0.898993433f, 0.922959268f},
-std::array<float,2>{0.770621002f, 0.0439068638f},
-std::array<float,2>{0.497721881f, 0.873342752f},
-std::array<float,2>{0.0483216904f, 0.468545735f},
-std::array<float,2>{0.518459558f, 0.726576269f},
-std::array<float,2>{0.860185683f, 0.251566976f},
-std::array<float,2>{0.377858728f, 0.555437684f},
-std::array<float,2>{0.107027374f, 0.247125581f},
-std::array<float,2>{0.562831163f, 0.987443566f},
-std::array<float,2>{0.729103386f, 0.067679815f},
-std::array<float,2>{0.136550918f, 0.782817304f},
-std::array<float,2>{0.363958746f, 0.3827613f},
-std::array<float,2>{0.959853649f, 0.630548656f},
-std::array<float,2>{0.547945619f, 0.491922468f},
-std::array<float,2>{0.0112821637f, 0.696220398f},
-std::array<float,2>{0.444127917f, 0.00878460705f},
-std::array<float,2>{0.79921782f, 0.823418796f},
-std::array<float,2>{0.932606518f, 0.161092862f},
-std::array<float,2>{0.298799366f, 0.901941359f},
-std::array<float,2>{0.225908667f, 0.322680622f},
-std::array<float,2>{0.684891105f, 0.604076862f},
-std::array<float,2>{0.829519689f, 0.453561991f},
-std::array<float,2>{0.419850141f, 0.71883291f},
-std::array<float,2>{0.0870049521f, 0.0354886018f},
-std::array<float,2>{0.618231595f, 0.859728098f},
-std::array<float,2>{0.713743269f, 0.145373553f},
-std::array<float,2>{0.181586474f, 0.935871363f},
-std::array<float,2>{0.313604385f, 0.37296468f},
-std::array<float,2>{0.990493298f, 0.593108416f},
-std::array<float,2>{0.514762819f, 0.305307329f},
-std::array<float,2>{0.0407373384f, 0.514597595f},
-std::array<float,2>{0.473347455f, 0.209311187f},
-std::array<float,2>{0.764637887f, 0.946015835f},
-std::array<float,2>{0.885105371f, 0.104879387f},
-std::array<float,2>{0.260051012f, 0.764700472f},
-std::array<float,2>{0.210745946f, 0.407897234f},
-std::array<float,2>{0.644371212f, 0.659410059f},
-std::array<float,2>{0.9424299f, 0.314427435f},
-std::array<float,2>{0.345203459f, 0.600370765f},
-std::array<float,2>{0.141712576f, 0.167240158f},
-std::array<float,2>{0.746746004f, 0.891926169f},
-std::array<float,2>{0.583707035f, 0.00253007864f},
-std::array<float,2>{0.120656051f, 0.815290034f},
-std::array<float,2>{0.393520385f, 0.495175004f},
-std::array<float,2>{0.849823177f, 0.690851569f},
-std::array<float,2>{0.665302157f, 0.382819116f},
-std::array<float,2>{0.243802562f, 0.63568145f},
-std::array<float,2>{0.293677598f, 0.07366319f},
-std::array<float,2>{0.912837565f, 0.789689124f},
-std::array<float,2>{0.794396102f, 0.241597354f},
-std::array<float,2>{0.455856502f, 0.992288232f},
-std::array<float,2>{0.027833445f, 0.264728725f},
-std::array<float,2>{0.533340156f, 0.549804151f},
-std::array<float,2>{0.935439765f, 0.425021738f},
-std::array<float,2>{0.302481025f, 0.684582174f},
-std::array<float,2>{0.220247641f, 0.113605112f},
-std::array<float,2>{0.680209994f, 0.774585068f},
-std::array<float,2>{0.552271545f, 0.197969049f},
-std::array<float,2>{0.0135665368f, 0.963775456f},
-std::array<float,2>{0.441375822f, 0.287051439f},
-std::array<float,2>{0.803466976f, 0.524861693f},
-std::array<float,2>{0.733880162f, 0.357393086f},
-std::array<float,2>{0.137256473f, 0.57587111f},
-std::array<float,2>{0.359926403f, 0.134156898f},
-std::array<float,2>{0.955003858f, 0.920731246f},
-std::array<float,2>{0.864565253f, 0.0504027009f},
-std::array<float,2>{0.379224598f, 0.845184147f},
-std::array<float,2>{0.102067217f, 0.443302393f},
-std::array<float,2>{0.568449795f, 0.742751718f},
-std::array<float,2>{0.76802808f, 0.277584165f},
-std::array<float,2>{0.493219227f, 0.539656699f},
-std::array<float,2>{0.0524593294f, 0.228593662f},
-std::array<float,2>{0.521687627f, 0.982492805f},
-std::array<float,2>{0.638353586f, 0.0837294385f},
-std::array<float,2>{0.195832834f, 0.799432933f},
-std::array<float,2>{0.269357085f, 0.398653299f},
-std::array<float,2>{0.904475927f, 0.656184733f},
-std::array<float,2>{0.608034968f, 0.476274163f},
-std::array<float,2>{0.0717372894f, 0.706848681f},
-std::array<float,2>{0.429366499f, 0.0200404413f},
-std::array<float,2>{0.820379376f, 0.842979431f},
-std::array<float,2>{0.976842105f, 0.186342523f},
-std::array<float,2>{0.33654359f, 0.877572954f},
-std::array<float,2>{0.168655932f, 0.341135442f},
-std::array<float,2>{0.689751446f, 0.610645473f},
-std::array<float,2>{0.809206963f, 0.394549221f},
-std::array<float,2>{0.447743088f, 0.64770776f},
-std::array<float,2>{0.00107632205f, 0.0905500576f},
-std::array<float,2>{0.555607319f, 0.807040513f},
-std::array<float,2>{0.675153196f, 0.223505631f},
-std::array<float,2>{0.231820881f, 0.970855474f},
-std::array<float,2>{0.305997729f, 0.267918438f},
-std::array<float,2>{0.924000382f, 0.531757057f},
-std::array<float,2>{0.57499069f, 0.331639528f},
-std::array<float,2>{0.0939394459f, 0.621676147f},
-std::array<float,2>{0.384106308f, 0.174801528f},
-std::array<float,2>{0.873330235f, 0.884898543f},
-std::array<float,2>{0.965807498f, 0.0268873051f},
-std::array<float,2>{0.373790085f, 0.830480218f},
-std::array<float,2>{0.126919553f, 0.484081149f},
-std::array<float,2>{0.721157789f, 0.717170715f},
-std::array<float,2>{0.894647241f, 0.294820309f},
-std::array<float,2>{0.275620073f, 0.522663891f},
-std::array<float,2>{0.193487912f, 0.191255078f},
-std::array<float,2>{0.627722859f, 0.954501092f},
-std::array<float,2>{0.52685982f, 0.121710934f},
-std::array<float,2>{0.0585602298f, 0.769149125f},
-std::array<float,2>{0.484860241f, 0.435096651f},
-std::array<float,2>{0.78052187f, 0.674254477f},
-std::array<float,2>{0.697219014f, 0.452634454f},
-std::array<float,2>{0.159985095f, 0.739468753f},
-std::array<float,2>{0.330419987f, 0.0556453057f},
-std::array<float,2>{0.973632514f, 0.858527005f},
-std::array<float,2>{0.818507969f, 0.125328258f},
-std::array<float,2>{0.43122375f, 0.913535178f},
-std::array<float,2>{0.0668541268f, 0.344422787f},
-std::array<float,2>{0.598739088f, 0.564103842f},
-std::array<float,2>{0.997324467f, 0.484791905f},
-std::array<float,2>{0.324841559f, 0.701601505f},
-std::array<float,2>{0.174520299f, 0.0121218134f},
-std::array<float,2>{0.708653033f, 0.825066805f},
-std::array<float,2>{0.611104608f, 0.156382412f},
-std::array<float,2>{0.0782027766f, 0.902729928f},
-std::array<float,2>{0.409698039f, 0.325286478f},
-std::array<float,2>{0.842191041f, 0.608751535f},
-std::array<float,2>{0.651908517f, 0.255337089f},
-std::array<float,2>{0.215023428f, 0.560040474f},
-std::array<float,2>{0.250547826f, 0.242963612f},
-std::array<float,2>{0.880458176f, 0.990111649f},
-std::array<float,2>{0.751411855f, 0.06276007f},
-std::array<float,2>{0.477629274f, 0.787316918f},
-std::array<float,2>{0.0377384648f, 0.375136465f},
-std::array<float,2>{0.507665575f, 0.626502872f},
-std::array<float,2>{0.854798675f, 0.359987885f},
-std::array<float,2>{0.401599348f, 0.581441998f},
-std::array<float,2>{0.114079423f, 0.150524318f},
-std::array<float,2>{0.587518036f, 0.927644193f},
-std::array<float,2>{0.738292456f, 0.0419350341f},
-std::array<float,2>{0.150169402f, 0.867651999f},
-std::array<float,2>{0.356111825f, 0.463477671f},
-std::array<float,2>{0.948830545f, 0.733837545f},
-std::array<float,2>{0.54537499f, 0.419814974f},
-std::array<float,2>{0.0172549747f, 0.667935908f},
-std::array<float,2>{0.468706012f, 0.0942060202f},
-std::array<float,2>{0.782465696f, 0.752843559f},
-std::array<float,2>{0.921760678f, 0.214552641f},
-std::array<float,2>{0.287450224f, 0.940336645f},
-std::array<float,2>{0.239605457f, 0.299013615f},
-std::array<float,2>{0.657590687f, 0.500826061f},
-std::array<float,2>{0.870065689f, 0.410568088f},
-std::array<float,2>{0.389106125f, 0.661262035f},
-std::array<float,2>{0.0992363617f, 0.107233733f},
-std::array<float,2>{0.573693037f, 0.758844376f},
-std::array<float,2>{0.72553879f, 0.204754084f},
-std::array<float,2>{0.132128656f, 0.950267255f},
-std::array<float,2>{0.371054679f, 0.308852673f},
-std::array<float,2>{0.963402689f, 0.510106742f},
-std::array<float,2>{0.561748624f, 0.368237168f},
-std::array<float,2>{0.00603824947f, 0.588864326f},
-std::array<float,2>{0.451533139f, 0.142655596f},
-std::array<float,2>{0.807074964f, 0.930259943f},
-std::array<float,2>{0.928552687f, 0.0333499759f},
-std::array<float,2>{0.312464863f, 0.865923405f},
-std::array<float,2>{0.229461595f, 0.457707822f},
-std::array<float,2>{0.676049292f, 0.72410351f},
-std::array<float,2>{0.971049666f, 0.258567333f},
-std::array<float,2>{0.332419455f, 0.553090394f},
-std::array<float,2>{0.162341729f, 0.236984298f},
-std::array<float,2>{0.700191259f, 0.997906506f},
-std::array<float,2>{0.597574651f, 0.0761637017f},
-std::array<float,2>{0.0640455037f, 0.795589447f},
-std::array<float,2>{0.436842412f, 0.387804002f},
-std::array<float,2>{0.815510273f, 0.638411164f},
-std::array<float,2>{0.630114019f, 0.498211294f},
-std::array<float,2>{0.189364225f, 0.693835139f},
-std::array<float,2>{0.280299038f, 0.00418713642f},
-std::array<float,2>{0.892877996f, 0.816835761f},
-std::array<float,2>{0.775662959f, 0.170220003f},
-std::array<float,2>{0.491244435f, 0.895482361f},
-std::array<float,2>{0.0610300787f, 0.318694949f},
-std::array<float,2>{0.527452886f, 0.597100437f},
-std::array<float,2>{0.875618577f, 0.440873414f},
-std::array<float,2>{0.256732285f, 0.747405589f},
-std::array<float,2>{0.211380661f, 0.0524764061f},
-std::array<float,2>{0.654657483f, 0.84896481f},
-std::array<float,2>{0.502949536f, 0.138115421f},
-std::array<float,2>{0.0346012935f, 0.917762876f},
-std::array<float,2>{0.482239634f, 0.354296327f},
-std::array<float,2>{0.757690191f, 0.570727527f},
-std::array<float,2>{0.705560505f, 0.283454448f},
-std::array<float,2>{0.17842558f, 0.528399229f},
-std::array<float,2>{0.320792884f, 0.200162411f},
-std::array<float,2>{0.992564142f, 0.965875149f},
-std::array<float,2>{0.83978647f, 0.112551086f},
-std::array<float,2>{0.412030995f, 0.77832967f},
-std::array<float,2>{0.0826765001f, 0.427960962f},
-std::array<float,2>{0.613771975f, 0.681426346f},
-std::array<float,2>{0.785369813f, 0.338908821f},
-std::array<float,2>{0.46168083f, 0.613689125f},
-std::array<float,2>{0.02310724f, 0.182009995f},
-std::array<float,2>{0.539457321f, 0.881454051f},
-std::array<float,2>{0.662763298f, 0.0178498924f},
-std::array<float,2>{0.237349913f, 0.83697468f},
-std::array<float,2>{0.282013148f, 0.468771309f},
-std::array<float,2>{0.915709913f, 0.710038722f},
-std::array<float,2>{0.592842937f, 0.404685736f},
-std::array<float,2>{0.113213845f, 0.650332212f},
-std::array<float,2>{0.405336469f, 0.078345634f},
-std::array<float,2>{0.857733011f, 0.801853776f},
-std::array<float,2>{0.952932298f, 0.234181195f},
-std::array<float,2>{0.352586836f, 0.976725578f},
-std::array<float,2>{0.154714689f, 0.276157022f},
-std::array<float,2>{0.737200618f, 0.544896662f},
-std::array<float,2>{0.761460066f, 0.478131473f},
-std::array<float,2>{0.471104294f, 0.713010967f},
-std::array<float,2>{0.0452634208f, 0.0286586229f},
-std::array<float,2>{0.509314239f, 0.833475351f},
-std::array<float,2>{0.644595802f, 0.176933736f},
-std::array<float,2>{0.205889493f, 0.890077293f},
-std::array<float,2>{0.2651802f, 0.333889514f},
-std::array<float,2>{0.88962543f, 0.620846748f},
-std::array<float,2>{0.623784602f, 0.272902727f},
-std::array<float,2>{0.0924586579f, 0.535999715f},
-std::array<float,2>{0.414120495f, 0.222548515f},
-std::array<float,2>{0.832375586f, 0.973909199f},
-std::array<float,2>{0.98447901f, 0.0888516679f},
-std::array<float,2>{0.318235457f, 0.810030043f},
-std::array<float,2>{0.186582699f, 0.391034305f},
-std::array<float,2>{0.715631485f, 0.643172264f},
-std::array<float,2>{0.907804668f, 0.347676396f},
-std::array<float,2>{0.292030305f, 0.56923759f},
-std::array<float,2>{0.24919802f, 0.13016066f},
-std::array<float,2>{0.669595003f, 0.906319618f},
-std::array<float,2>{0.536102712f, 0.0610879846f},
-std::array<float,2>{0.0254236422f, 0.851754487f},
-std::array<float,2>{0.460196644f, 0.446764082f},
-std::array<float,2>{0.789429605f, 0.7348966f},
-std::array<float,2>{0.744847178f, 0.431832939f},
-std::array<float,2>{0.145337343f, 0.678769469f},
-std::array<float,2>{0.350371242f, 0.119439647f},
-std::array<float,2>{0.938270748f, 0.772948921f},
-std::array<float,2>{0.847583115f, 0.193806678f},
-std::array<float,2>{0.396273136f, 0.958629549f},
-std::array<float,2>{0.124852002f, 0.29272306f},
-std::array<float,2>{0.58099097f, 0.518357098f},
-std::array<float,2>{0.958688378f, 0.380828351f},
-std::array<float,2>{0.366753787f, 0.632644832f},
-std::array<float,2>{0.133967683f, 0.0687334761f},
-std::array<float,2>{0.727713406f, 0.78398788f},
-std::array<float,2>{0.564726412f, 0.248396188f},
-std::array<float,2>{0.108174689f, 0.985520184f},
-std::array<float,2>{0.375374645f, 0.253820807f},
-std::array<float,2>{0.862063229f, 0.556646824f},
-std::array<float,2>{0.686113834f, 0.320793718f},
-std::array<float,2>{0.223488957f, 0.601987898f},
-std::array<float,2>{0.299111545f, 0.163333371f},
-std::array<float,2>{0.929917216f, 0.898772299f},
-std::array<float,2>{0.796889246f, 0.010165954f},
-std::array<float,2>{0.442303479f, 0.822256625f},
-std::array<float,2>{0.00940156169f, 0.489417493f},
-std::array<float,2>{0.550207138f, 0.697628736f},
-std::array<float,2>{0.8268736f, 0.303236216f},
-std::array<float,2>{0.424335688f, 0.507563233f},
-std::array<float,2>{0.0754926056f, 0.217120439f},
-std::array<float,2>{0.605335295f, 0.944620013f},
-std::array<float,2>{0.69317776f, 0.0981842354f},
-std::array<float,2>{0.166674793f, 0.755794346f},
-std::array<float,2>{0.34247455f, 0.415862888f},
-std::array<float,2>{0.98138082f, 0.668130755f},
-std::array<float,2>{0.516078949f, 0.46659565f},
-std::array<float,2>{0.0498193651f, 0.728727281f},
-std::array<float,2>{0.499233902f, 0.046728678f},
-std::array<float,2>{0.77193743f, 0.87206465f},
-std::array<float,2>{0.901177645f, 0.155796096f},
-std::array<float,2>{0.271027952f, 0.92550683f},
-std::array<float,2>{0.200297907f, 0.36687246f},
-std::array<float,2>{0.635582209f, 0.584433913f},
-std::array<float,2>{0.84253037f, 0.487658918f},
-std::array<float,2>{0.409350455f, 0.699309587f},
-std::array<float,2>{0.0790921003f, 0.013744615f},
-std::array<float,2>{0.610745311f, 0.827679634f},
-std::array<float,2>{0.708486199f, 0.158247873f},
-std::array<float,2>{0.173899338f, 0.90515691f},
-std::array<float,2>{0.324556082f, 0.326823145f},
-std::array<float,2>{0.997892439f, 0.606823921f},
-std::array<float,2>{0.50729239f, 0.256248206f},
-std::array<float,2>{0.0374965891f, 0.562159538f},
-std::array<float,2>{0.47820279f, 0.245299414f},
-std::array<float,2>{0.751530826f, 0.991173744f},
-std::array<float,2>{0.880142689f, 0.0660507828f},
-std::array<float,2>{0.250057876f, 0.786795676f},
-std::array<float,2>{0.215466142f, 0.378278464f},
-std::array<float,2>{0.651414514f, 0.628691256f},
-std::array<float,2>{0.948252857f, 0.362941027f},
-std::array<float,2>{0.355763286f, 0.579510391f},
-std::array<float,2>{0.14964357f, 0.148618847f},
-std::array<float,2>{0.738906145f, 0.928925931f},
-std::array<float,2>{0.587248623f, 0.0393220559f},
-std::array<float,2>{0.1137411f, 0.869145274f},
-std::array<float,2>{0.402057558f, 0.461425364f},
-std::array<float,2>{0.855164587f, 0.731929898f},
-std::array<float,2>{0.657963216f, 0.420921594f},
-std::array<float,2>{0.2398559f, 0.66530025f},
-std::array<float,2>{0.287959844f, 0.0972806066f},
-std::array<float,2>{0.921126068f, 0.750640988f},
-std::array<float,2>{0.783037007f, 0.211604521f},
-std::array<float,2>{0.46791032f, 0.93841809f},
-std::array<float,2>{0.0170542747f, 0.298007131f},
-std::array<float,2>{0.545732856f, 0.502959669f},
-std::array<float,2>{0.924529314f, 0.397584677f},
-std::array<float,2>{0.306536406f, 0.645091653f},
-std::array<float,2>{0.232248664f, 0.0920755565f},
-std::array<float,2>{0.675775945f, 0.806090415f},
-std::array<float,2>{0.554939568f, 0.225054964f},
-std::array<float,2>{0.00149901642f, 0.968775272f},
-std::array<float,2>{0.447944373f, 0.266914368f},
-std::array<float,2>{0.808622777f, 0.533797801f},
-std::array<float,2>{0.721383393f, 0.328689992f},
-std::array<float,2>{0.125992566f, 0.623483181f},
-std::array<float,2>{0.373217285f, 0.172067106f},
-std::array<float,2>{0.965147913f, 0.884232759f},
-std::array<float,2>{0.873604417f, 0.0248518139f},
-std::array<float,2>{0.384326667f, 0.828131437f},
-std::array<float,2>{0.094550252f, 0.481927186f},
-std::array<float,2>{0.574465632f, 0.716769755f},
-std::array<float,2>{0.780867875f, 0.296140254f},
-std::array<float,2>{0.485064983f, 0.520903647f},
-std::array<float,2>{0.0580927245f, 0.187641159f},
-std::array<float,2>{0.526583433f, 0.956509888f},
-std::array<float,2>{0.627334476f, 0.123288281f},
-std::array<float,2>{0.194212645f, 0.766186714f},
-std::array<float,2>{0.276046038f, 0.43715477f},
-std::array<float,2>{0.895381391f, 0.672536671f},
-std::array<float,2>{0.599420071f, 0.450761795f},
-std::array<float,2>{0.0671868026f, 0.741379559f},
-std::array<float,2>{0.430864096f, 0.056841895f},
-std::array<float,2>{0.819203615f, 0.855732977f},
-std::array<float,2>{0.973037243f, 0.127770796f},
-std::array<float,2>{0.331013739f, 0.911670923f},
-std::array<float,2>{0.159584761f, 0.34691295f},
-std::array<float,2>{0.696446717f, 0.56500113f},
-std::array<float,2>{0.802853823f, 0.422914565f},
-std::array<float,2>{0.440651506f, 0.685863554f},
-std::array<float,2>{0.013081871f, 0.116229318f},
-std::array<float,2>{0.551986039f, 0.776759744f},
-std::array<float,2>{0.67986697f, 0.196453407f},
-std::array<float,2>{0.219743952f, 0.961811781f},
-std::array<float,2>{0.302163869f, 0.287122995f},
-std::array<float,2>{0.934904039f, 0.525720358f},
-std::array<float,2>{0.569261909f, 0.357559651f},
-std::array<float,2>{0.101773798f, 0.577144146f},
-std::array<float,2>{0.379404247f, 0.135891914f},
-std::array<float,2>{0.86497283f, 0.919626415f},
-std::array<float,2>{0.954162359f, 0.0473287143f},
-std::array<float,2>{0.359650224f, 0.847167194f},
-std::array<float,2>{0.136815146f, 0.443782896f},
-std::array<float,2>{0.734199286f, 0.744154692f},
-std::array<float,2>{0.904872f, 0.279309928f},
-std::array<float,2>{0.268576115f, 0.541024804f},
-std::array<float,2>{0.195800647f, 0.22699587f},
-std::array<float,2>{0.638063788f, 0.981357515f},
-std::array<float,2>{0.522454679f, 0.0853611678f},
-std::array<float,2>{0.0521951318f, 0.797730982f},
-std::array<float,2>{0.493959039f, 0.400990814f},
-std::array<float,2>{0.768388808f, 0.653235495f},
-std::array<float,2>{0.690100253f, 0.474093884f},
-std::array<float,2>{0.168288097f, 0.704081178f},
-std::array<float,2>{0.336232722f, 0.0230726935f},
-std::array<float,2>{0.977308989f, 0.840401113f},
-std::array<float,2>{0.820900738f, 0.184871659f},
-std::array<float,2>{0.428878754f, 0.875705361f},
-std::array<float,2>{0.0718052611f, 0.342439562f},
-std::array<float,2>{0.607848227f, 0.611606658f},
-std::array<float,2>{0.990852296f, 0.455204397f},
-std::array<float,2>{0.314117223f, 0.720981538f},
-std::array<float,2>{0.181007221f, 0.0376242176f},
-std::array<float,2>{0.713246822f, 0.8613832f},
-std::array<float,2>{0.618722677f, 0.147561252f},
-std::array<float,2>{0.0874972716f, 0.934280992f},
-std::array<float,2>{0.419220209f, 0.374352127f},
-std::array<float,2>{0.829942107f, 0.591629922f},
-std::array<float,2>{0.643880129f, 0.30858472f},
-std::array<float,2>{0.210283339f, 0.511834502f},
-std::array<float,2>{0.260375768f, 0.208349228f},
-std::array<float,2>{0.885464489f, 0.949069619f},
-std::array<float,2>{0.76402843f, 0.102428272f},
-std::array<float,2>{0.473138183f, 0.761971474f},
-std::array<float,2>{0.0403043889f, 0.409767717f},
-std::array<float,2>{0.515493274f, 0.658068895f},
-std::array<float,2>{0.850579858f, 0.315690726f},
-std::array<float,2>{0.393017888f, 0.599134564f},
-std::array<float,2>{0.120421812f, 0.165607631f},
-std::array<float,2>{0.583489418f, 0.894508541f},
-std::array<float,2>{0.746394634f, 0.00177053036f},
-std::array<float,2>{0.142272502f, 0.81289494f},
-std::array<float,2>{0.345347285f, 0.493322521f},
-std::array<float,2>{0.943348289f, 0.689061463f},
-std::array<float,2>{0.534098685f, 0.386687279f},
-std::array<float,2>{0.0275679994f, 0.634021163f},
-std::array<float,2>{0.455365956f, 0.0704556555f},
-std::array<float,2>{0.794828236f, 0.791742384f},
-std::array<float,2>{0.912159801f, 0.239802122f},
-std::array<float,2>{0.293026865f, 0.994412303f},
-std::array<float,2>{0.243177891f, 0.263592839f},
-std::array<float,2>{0.665657818f, 0.548385143f},
-std::array<float,2>{0.861400008f, 0.381972432f},
-std::array<float,2>{0.375658393f, 0.630154848f},
-std::array<float,2>{0.107811414f, 0.0680666342f},
-std::array<float,2>{0.565363586f, 0.782570004f},
-std::array<float,2>{0.728254378f, 0.248043999f},
-std::array<float,2>{0.134398878f, 0.987946987f},
-std::array<float,2>{0.366531849f, 0.251440436f},
-std::array<float,2>{0.958447993f, 0.554819524f},
-std::array<float,2>{0.550374985f, 0.32298252f},
-std::array<float,2>{0.00926539022f, 0.603913605f},
-std::array<float,2>{0.441634685f, 0.160439f},
-std::array<float,2>{0.797457039f, 0.901535273f},
-std::array<float,2>{0.930403948f, 0.00811017584f},
-std::array<float,2>{0.299370825f, 0.824026346f},
-std::array<float,2>{0.222865969f, 0.49139744f},
-std::array<float,2>{0.685827017f, 0.695448518f},
-std::array<float,2>{0.980594635f, 0.301158696f},
-std::array<float,2>{0.341828227f, 0.504827976f},
-std::array<float,2>{0.166044325f, 0.21632421f},
-std::array<float,2>{0.692742467f, 0.941810846f},
-std::array<float,2>{0.604953945f, 0.100658379f},
-std::array<float,2>{0.0761610419f, 0.757559001f},
-std::array<float,2>{0.423886806f, 0.417317063f},
-std::array<float,2>{0.82618922f, 0.670532882f},
-std::array<float,2>{0.634795189f, 0.4682284f},
-std::array<float,2>{0.200777456f, 0.727274597f},
-std::array<float,2>{0.27057454f, 0.0430500321f},
-std::array<float,2>{0.900415778f, 0.873715878f},
-std::array<float,2>{0.77227813f, 0.153831527f},
-std::array<float,2>{0.499953687f, 0.923587382f},
-std::array<float,2>{0.0506911986f, 0.364986122f},
-std::array<float,2>{0.516298175f, 0.582129002f},
-std::array<float,2>{0.888729274f, 0.480168402f},
-std::array<float,2>{0.265118092f, 0.712505579f},
-std::array<float,2>{0.205476433f, 0.0297283698f},
-std::array<float,2>{0.645434141f, 0.835586905f},
-std::array<float,2>{0.508996844f, 0.179361388f},
-std::array<float,2>{0.0458808839f, 0.887315989f},
-std::array<float,2>{0.471312493f, 0.334022641f},
-std::array<float,2>{0.760842383f, 0.617973745f},
-std::array<float,2>{0.715059102f, 0.270462126f},
-std::array<float,2>{0.187272131f, 0.538263798f},
-std::array<float,2>{0.317595094f, 0.219428822f},
-std::array<float,2>{0.985051453f, 0.976323068f},
-std::array<float,2>{0.832533121f, 0.0868839175f},
-std::array<float,2>{0.415034652f, 0.812493443f},
-std::array<float,2>{0.0919450521f, 0.393642366f},
-std::array<float,2>{0.623394072f, 0.641898215f},
-std::array<float,2>{0.789775193f, 0.350334972f},
-std::array<float,2>{0.460866004f, 0.566661954f},
-std::array<float,2>{0.0261497218f, 0.132674217f},
-std::array<float,2>{0.535555124f, 0.908896923f},
-std::array<float,2>{0.668990552f, 0.0586808622f},
-std::array<float,2>{0.249687508f, 0.855091631f},
-std::array<float,2>{0.292773098f, 0.44764328f},
-std::array<float,2>{0.907407343f, 0.737538517f},
-std::array<float,2>{0.580174983f, 0.430776507f},
-std::array<float,2>{0.12428312f, 0.67633605f},
-std::array<float,2>{0.395960093f, 0.117542207f},
-std::array<float,2>{0.846862137f, 0.770277262f},
-std::array<float,2>{0.937988222f, 0.192319214f},
-std::array<float,2>{0.349982411f, 0.960688114f},
-std::array<float,2>{0.144784123f, 0.290551484f},
-std::array<float,2>{0.744173646f, 0.516614616f},
-std::array<float,2>{0.757176161f, 0.439216495f},
-std::array<float,2>{0.481680602f, 0.749589682f},
-std::array<float,2>{0.0347840972f, 0.0542220436f},
-std::array<float,2>{0.503688693f, 0.850625634f},
-std::array<float,2>{0.654850662f, 0.139316589f},
-std::array<float,2>{0.21145533f, 0.915490568f},
-std::array<float,2>{0.256314188f, 0.352009326f},
-std::array<float,2>{0.875270545f, 0.574077249f},
-std::array<float,2>{0.613591075f, 0.282942474f},
-std::array<float,2>{0.0821268857f, 0.531157434f},
-std::array<float,2>{0.41161266f, 0.202456966f},
-std::array<float,2>{0.839107811f, 0.967533469f},
-std::array<float,2>{0.992707014f, 0.110207163f},
-std::array<float,2>{0.321037233f, 0.780304909f},
-std::array<float,2>{0.178165838f, 0.426452816f},
-std::array<float,2>{0.705606759f, 0.683096826f},
-std::array<float,2>{0.91551429f, 0.336502999f},
-std::array<float,2>{0.281358838f, 0.615944147f},
-std::array<float,2>{0.237994879f, 0.181081861f},
-std::array<float,2>{0.662347555f, 0.878959954f},
-std::array<float,2>{0.540026188f, 0.0165409017f},
-std::array<float,2>{0.0229280926f, 0.839627147f},
-std::array<float,2>{0.461407125f, 0.472203225f},
-std::array<float,2>{0.786075056f, 0.707774043f},
-std::array<float,2>{0.736609459f, 0.403862268f},
-std::array<float,2>{0.155262634f, 0.651115954f},
-std::array<float,2>{0.353296399f, 0.0809159875f},
-std::array<float,2>{0.952467501f, 0.803125679f},
-std::array<float,2>{0.858095229f, 0.230850071f},
-std::array<float,2>{0.406098723f, 0.978706717f},
-std::array<float,2>{0.11242155f, 0.275129795f},
-std::array<float,2>{0.593540967f, 0.545096517f},
-std::array<float,2>{0.963304818f, 0.412446737f},
-std::array<float,2>{0.370346457f, 0.664061725f},
-std::array<float,2>{0.132523641f, 0.108380444f},
-std::array<float,2>{0.724843144f, 0.760271549f},
-std::array<float,2>{0.574048698f, 0.205172032f},
-std::array<float,2>{0.0987072289f, 0.95255971f},
-std::array<float,2>{0.38918969f, 0.312186897f},
-std::array<float,2>{0.869220316f, 0.508941889f},
-std::array<float,2>{0.676736891f, 0.369407594f},
-std::array<float,2>{0.228715494f, 0.587504148f},
-std::array<float,2>{0.311838925f, 0.141072705f},
-std::array<float,2>{0.92778194f, 0.931777358f},
-std::array<float,2>{0.807503462f, 0.0330541022f},
-std::array<float,2>{0.452142298f, 0.864222348f},
-std::array<float,2>{0.00639104145f, 0.460208118f},
-std::array<float,2>{0.562441468f, 0.724661052f},
-std::array<float,2>{0.816099405f, 0.260007054f},
-std::array<float,2>{0.437141508f, 0.551809132f},
-std::array<float,2>{0.0636307821f, 0.234761074f},
-std::array<float,2>{0.597038805f, 0.998095334f},
-std::array<float,2>{0.699441969f, 0.0766370296f},
-std::array<float,2>{0.162617862f, 0.793683529f},
-std::array<float,2>{0.332964808f, 0.388730794f},
-std::array<float,2>{0.971475542f, 0.639754176f},
-std::array<float,2>{0.528319657f, 0.497725666f},
-std::array<float,2>{0.0611335337f, 0.691719294f},
-std::array<float,2>{0.492125511f, 0.00631664088f},
-std::array<float,2>{0.776243687f, 0.81890732f},
-std::array<float,2>{0.893158495f, 0.169124827f},
-std::array<float,2>{0.280994117f, 0.897218883f},
-std::array<float,2>{0.188660815f, 0.317490101f},
-std::array<float,2>{0.630584419f, 0.594029725f},
-std::array<float,2>{0.852387905f, 0.463011295f},
-std::array<float,2>{0.399213344f, 0.734210312f},
-std::array<float,2>{0.116110161f, 0.0414081328f},
-std::array<float,2>{0.589571774f, 0.868107438f},
-std::array<float,2>{0.74103117f, 0.151350066f},
-std::array<float,2>{0.152015284f, 0.926954925f},
-std::array<float,2>{0.359203607f, 0.359743029f},
-std::array<float,2>{0.945866942f, 0.582012594f},
-std::array<float,2>{0.544672966f, 0.299337626f},
-std::array<float,2>{0.0176735688f, 0.500065804f},
-std::array<float,2>{0.46637395f, 0.214125425f},
-std::array<float,2>{0.78381604f, 0.939642906f},
-std::array<float,2>{0.919441581f, 0.0946774632f},
-std::array<float,2>{0.285186976f, 0.75239116f},
-std::array<float,2>{0.241009101f, 0.419164002f},
-std::array<float,2>{0.659034371f, 0.667252421f},
-std::array<float,2>{0.998320818f, 0.325994074f},
-std::array<float,2>{0.327022791f, 0.608941138f},
-std::array<float,2>{0.173266008f, 0.156832963f},
-std::array<float,2>{0.710558653f, 0.90301162f},
-std::array<float,2>{0.61209476f, 0.0126656638f},
-std::array<float,2>{0.0811762288f, 0.824555755f},
-std::array<float,2>{0.407073915f, 0.484865546f},
-std::array<float,2>{0.841056943f, 0.702042341f},
-std::array<float,2>{0.649967551f, 0.37571305f},
-std::array<float,2>{0.218705818f, 0.626212776f},
-std::array<float,2>{0.252283722f, 0.0634195209f},
-std::array<float,2>{0.882060468f, 0.787602067f},
-std::array<float,2>{0.752142727f, 0.242316991f},
-std::array<float,2>{0.480091542f, 0.989567757f},
-std::array<float,2>{0.0354988165f, 0.255497873f},
-std::array<float,2>{0.505121112f, 0.560531497f},
-std::array<float,2>{0.896899164f, 0.434919268f},
-std::array<float,2>{0.273766965f, 0.674534976f},
-std::array<float,2>{0.192394093f, 0.121112853f},
-std::array<float,2>{0.625591516f, 0.768737555f},
-std::array<float,2>{0.525297284f, 0.190442175f},
-std::array<float,2>{0.0556886718f, 0.955003858f},
-std::array<float,2>{0.486378163f, 0.294214487f},
-std::array<float,2>{0.779283166f, 0.522999346f},
-std::array<float,2>{0.697959721f, 0.344034761f},
-std::array<float,2>{0.156486779f, 0.563719392f},
-std::array<float,2>{0.32949385f, 0.125812024f},
-std::array<float,2>{0.976467073f, 0.913592696f},
-std::array<float,2>{0.818142414f, 0.0550380461f},
-std::array<float,2>{0.432813317f, 0.858958066f},
-std::array<float,2>{0.069493413f, 0.453065544f},
-std::array<float,2>{0.601472259f, 0.739979386f},
-std::array<float,2>{0.811563134f, 0.268333793f},
-std::array<float,2>{0.446984947f, 0.531623125f},
-std::array<float,2>{0.00231655734f, 0.223009735f},
-std::array<float,2>{0.557657242f, 0.971571147f},
-std::array<float,2>{0.671915531f, 0.0902779922f},
-std::array<float,2>{0.232982874f, 0.807541251f},
-std::array<float,2>{0.308361858f, 0.395404667f},
-std::array<float,2>{0.922501564f, 0.648259461f},
-std::array<float,2>{0.577435791f, 0.483823836f},
-std::array<float,2>{0.0974224955f, 0.717311263f},
-std::array<float,2>{0.385404199f, 0.0266563222f},
-std::array<float,2>{0.871411741f, 0.830904901f},
-std::array<float,2>{0.967973471f, 0.174060732f},
-std::array<float,2>{0.371678889f, 0.885463297f},
-std::array<float,2>{0.127294004f, 0.331210971f},
-std::array<float,2>{0.72008121f, 0.621334314f},
-std::array<float,2>{0.766914964f, 0.399179637f},
-std::array<float,2>{0.496010542f, 0.655482352f},
-std::array<float,2>{0.0531819239f, 0.0832144544f},
-std::array<float,2>{0.51973027f, 0.79902035f},
-std::array<float,2>{0.639646947f, 0.229426906f},
-std::array<float,2>{0.197378069f, 0.983365417f},
-std::array<float,2>{0.267091751f, 0.278290242f},
-std::array<float,2>{0.90408814f, 0.539198101f},
-std::array<float,2>{0.60613054f, 0.341549903f},
-std::array<float,2>{0.0735831708f, 0.611044109f},
-std::array<float,2>{0.426482946f, 0.18586643f},
-std::array<float,2>{0.823832214f, 0.877249241f},
-std::array<float,2>{0.979049563f, 0.0196853038f},
-std::array<float,2>{0.339213073f, 0.843453288f},
-std::array<float,2>{0.170393795f, 0.475976855f},
-std::array<float,2>{0.687951505f, 0.706210852f},
-std::array<float,2>{0.937338352f, 0.286227018f},
-std::array<float,2>{0.303304553f, 0.525284111f},
-std::array<float,2>{0.220918432f, 0.197372898f},
-std::array<float,2>{0.683117688f, 0.963212907f},
-std::array<float,2>{0.553230226f, 0.113921434f},
-std::array<float,2>{0.0146220354f, 0.775028348f},
-std::array<float,2>{0.439367533f, 0.425503731f},
-std::array<float,2>{0.800929785f, 0.68527925f},
-std::array<float,2>{0.731924415f, 0.442502707f},
-std::array<float,2>{0.138724104f, 0.742468536f},
-std::array<float,2>{0.361468047f, 0.0502454937f},
-std::array<float,2>{0.956959307f, 0.845252514f},
-std::array<float,2>{0.867092252f, 0.13470538f},
-std::array<float,2>{0.381013662f, 0.919963062f},
-std::array<float,2>{0.1035382f, 0.356561095f},
-std::array<float,2>{0.566942334f, 0.5755319f},
-std::array<float,2>{0.945097208f, 0.495908618f},
-std::array<float,2>{0.346993715f, 0.690953612f},
-std::array<float,2>{0.144441485f, 0.00224691653f},
-std::array<float,2>{0.749945045f, 0.814930975f},
-std::array<float,2>{0.58562851f, 0.167802617f},
-std::array<float,2>{0.117575221f, 0.892349422f},
-std::array<float,2>{0.390771031f, 0.313595742f},
-std::array<float,2>{0.849296749f, 0.599835873f},
-std::array<float,2>{0.666529417f, 0.265520066f},
-std::array<float,2>{0.245213762f, 0.549148321f},
-std::array<float,2>{0.295497477f, 0.241932824f},
-std::array<float,2>{0.91132009f, 0.99294126f},
-std::array<float,2>{0.796102703f, 0.0740943253f},
-std::array<float,2>{0.454220146f, 0.789132357f},
-std::array<float,2>{0.03084662f, 0.383387864f},
-std::array<float,2>{0.531927228f, 0.634808481f},
-std::array<float,2>{0.831053793f, 0.372070432f},
-std::array<float,2>{0.421281487f, 0.593560398f},
-std::array<float,2>{0.089557454f, 0.144910872f},
-std::array<float,2>{0.619641602f, 0.936073065f},
-std::array<float,2>{0.711870909f, 0.0357721336f},
-std::array<float,2>{0.181813002f, 0.860303581f},
-std::array<float,2>{0.314707994f, 0.453805983f},
-std::array<float,2>{0.989818275f, 0.719516158f},
-std::array<float,2>{0.512749374f, 0.407270819f},
-std::array<float,2>{0.0425107665f, 0.659699202f},
-std::array<float,2>{0.47598657f, 0.105145931f},
-std::array<float,2>{0.762324154f, 0.765152097f},
-std::array<float,2>{0.883876085f, 0.209596336f},
-std::array<float,2>{0.258190095f, 0.945424795f},
-std::array<float,2>{0.208803371f, 0.304697752f},
-std::array<float,2>{0.641696572f, 0.51387614f},
-std::array<float,2>{0.826145351f, 0.415081233f},
-std::array<float,2>{0.423264056f, 0.668517053f},
-std::array<float,2>{0.0774861425f, 0.0977654532f},
-std::array<float,2>{0.601834476f, 0.755227983f},
-std::array<float,2>{0.69437921f, 0.217419833f},
-std::array<float,2>{0.165526599f, 0.945035398f},
-std::array<float,2>{0.340423495f, 0.302805543f},
-std::array<float,2>{0.982651532f, 0.507041514f},
-std::array<float,2>{0.51795435f, 0.366225004f},
-std::array<float,2>{0.0487767495f, 0.584926844f},
-std::array<float,2>{0.497535646f, 0.155280054f},
-std::array<float,2>{0.77147305f, 0.924938262f},
-std::array<float,2>{0.898924768f, 0.0461373255f},
-std::array<float,2>{0.272924721f, 0.871474743f},
-std::array<float,2>{0.202186093f, 0.4658885f},
-std::array<float,2>{0.634709537f, 0.729126453f},
-std::array<float,2>{0.959328592f, 0.252936274f},
-std::array<float,2>{0.363302827f, 0.557288349f},
-std::array<float,2>{0.136004359f, 0.248830989f},
-std::array<float,2>{0.728852332f, 0.986210585f},
-std::array<float,2>{0.563202739f, 0.0690630376f},
-std::array<float,2>{0.106865332f, 0.783360362f},
-std::array<float,2>{0.376994491f, 0.380179405f},
-std::array<float,2>{0.859444261f, 0.632185876f},
-std::array<float,2>{0.68514961f, 0.489844769f},
-std::array<float,2>{0.226535723f, 0.697869539f},
-std::array<float,2>{0.297863007f, 0.0105458861f},
-std::array<float,2>{0.931665123f, 0.821681678f},
-std::array<float,2>{0.799772203f, 0.163939163f},
-std::array<float,2>{0.443503857f, 0.899183452f},
-std::array<float,2>{0.0111180618f, 0.320964903f},
-std::array<float,2>{0.548508584f, 0.602225959f},
-std::array<float,2>{0.909428954f, 0.44699654f},
-std::array<float,2>{0.29017514f, 0.734431028f},
-std::array<float,2>{0.248015136f, 0.0607034788f},
-std::array<float,2>{0.67069757f, 0.852078915f},
-std::array<float,2>{0.537699044f, 0.130400404f},
-std::array<float,2>{0.0240498167f, 0.906739831f},
-std::array<float,2>{0.458877832f, 0.348157942f},
-std::array<float,2>{0.791686833f, 0.568575442f},
-std::array<float,2>{0.744079173f, 0.292163223f},
-std::array<float,2>{0.147692084f, 0.517609179f},
-std::array<float,2>{0.349421263f, 0.194193095f},
-std::array<float,2>{0.940826595f, 0.958270252f},
-std::array<float,2>{0.843971729f, 0.119900949f},
-std::array<float,2>{0.396952301f, 0.773106754f},
-std::array<float,2>{0.121215485f, 0.432340622f},
-std::array<float,2>{0.578641057f, 0.679600239f},
-std::array<float,2>{0.758419991f, 0.333308369f},
-std::array<float,2>{0.46876961f, 0.620434403f},
-std::array<float,2>{0.0434505939f, 0.177551344f},
-std::array<float,2>{0.511514366f, 0.89014864f},
-std::array<float,2>{0.647301257f, 0.0292955413f},
-std::array<float,2>{0.203410983f, 0.833806992f},
-std::array<float,2>{0.263289183f, 0.477889597f},
-std::array<float,2>{0.886871219f, 0.713658273f},
-std::array<float,2>{0.622747838f, 0.391413987f},
-std::array<float,2>{0.0903622955f, 0.642752051f},
-std::array<float,2>{0.41731146f, 0.088170968f},
-std::array<float,2>{0.834463596f, 0.810475945f},
-std::array<float,2>{0.987463713f, 0.222076699f},
-std::array<float,2>{0.31944561f, 0.97437501f},
-std::array<float,2>{0.185458183f, 0.273319274f},
-std::array<float,2>{0.717146218f, 0.535606325f},
-std::array<float,2>{0.788356066f, 0.469514847f},
-std::array<float,2>{0.463441014f, 0.710530102f},
-std::array<float,2>{0.0203043558f, 0.0183602981f},
-std::array<float,2>{0.542893589f, 0.837536097f},
-std::array<float,2>{0.662059069f, 0.182409778f},
-std::array<float,2>{0.235669792f, 0.8811059f},
-std::array<float,2>{0.284984589f, 0.339792907f},
-std::array<float,2>{0.917263031f, 0.614062786f},
-std::array<float,2>{0.590420842f, 0.275578707f},
-std::array<float,2>{0.110991098f, 0.544351876f},
-std::array<float,2>{0.403590441f, 0.233566478f},
-std::array<float,2>{0.85591656f, 0.977355421f},
-std::array<float,2>{0.949412227f, 0.0788698792f},
-std::array<float,2>{0.354986608f, 0.802437365f},
-std::array<float,2>{0.153377295f, 0.404792637f},
-std::array<float,2>{0.73538357f, 0.649477482f},
-std::array<float,2>{0.877804995f, 0.35375005f},
-std::array<float,2>{0.25464955f, 0.571058095f},
-std::array<float,2>{0.213068232f, 0.138255537f},
-std::array<float,2>{0.65273267f, 0.917477906f},
-std::array<float,2>{0.501173675f, 0.0521237478f},
-std::array<float,2>{0.0315121748f, 0.849183142f},
-std::array<float,2>{0.483468384f, 0.441293329f},
-std::array<float,2>{0.755613327f, 0.747939765f},
-std::array<float,2>{0.704250455f, 0.428553641f},
-std::array<float,2>{0.176975936f, 0.680831432f},
-std::array<float,2>{0.324085653f, 0.113188311f},
-std::array<float,2>{0.99503237f, 0.779237688f},
-std::array<float,2>{0.836300313f, 0.199531093f},
-std::array<float,2>{0.412690222f, 0.966613114f},
-std::array<float,2>{0.0843970552f, 0.284125f},
-std::array<float,2>{0.615609646f, 0.52923274f},
-std::array<float,2>{0.97031945f, 0.388499081f},
-std::array<float,2>{0.334096074f, 0.637943864f},
-std::array<float,2>{0.160247013f, 0.0752878487f},
-std::array<float,2>{0.701763868f, 0.795140803f},
-std::array<float,2>{0.594714344f, 0.236429363f},
-std::array<float,2>{0.0657708421f, 0.997479618f},
-std::array<float,2>{0.43399322f, 0.257824063f},
-std::array<float,2>{0.813868344f, 0.553629696f},
-std::array<float,2>{0.631795526f, 0.318926245f},
-std::array<float,2>{0.190749422f, 0.59748739f},
-std::array<float,2>{0.277448058f, 0.170895964f},
-std::array<float,2>{0.891197562f, 0.89478749f},
-std::array<float,2>{0.774259806f, 0.00473997835f},
-std::array<float,2>{0.488959223f, 0.81694603f},
-std::array<float,2>{0.0592785589f, 0.498677045f},
-std::array<float,2>{0.531128466f, 0.694108129f},
-std::array<float,2>{0.868563831f, 0.309396416f},
-std::array<float,2>{0.388051987f, 0.510371089f},
-std::array<float,2>{0.100558452f, 0.204272553f},
-std::array<float,2>{0.57181865f, 0.950981736f},
-std::array<float,2>{0.723197699f, 0.106778234f},
-std::array<float,2>{0.130800456f, 0.759318113f},
-std::array<float,2>{0.368244171f, 0.410980314f},
-std::array<float,2>{0.962764919f, 0.661888957f},
-std::array<float,2>{0.558945894f, 0.457366735f},
-std::array<float,2>{0.00392992236f, 0.724141538f},
-std::array<float,2>{0.450873405f, 0.0340557657f},
-std::array<float,2>{0.804741681f, 0.865686774f},
-std::array<float,2>{0.927500248f, 0.143188894f},
-std::array<float,2>{0.309034765f, 0.930055499f},
-std::array<float,2>{0.228461415f, 0.368685544f},
-std::array<float,2>{0.679569066f, 0.587922096f},
-std::array<float,2>{0.872474551f, 0.48058778f},
-std::array<float,2>{0.386272997f, 0.715534985f},
-std::array<float,2>{0.0966277793f, 0.0237243362f},
-std::array<float,2>{0.576953113f, 0.82917732f},
-std::array<float,2>{0.719273567f, 0.173692241f},
-std::array<float,2>{0.128760606f, 0.883285761f},
-std::array<float,2>{0.372513324f, 0.329730332f},
-std::array<float,2>{0.967470467f, 0.624986649f},
-std::array<float,2>{0.557272017f, 0.266522646f},
-std::array<float,2>{0.00345129962f, 0.534914613f},
-std::array<float,2>{0.446085632f, 0.225638226f},
-std::array<float,2>{0.811438322f, 0.970043659f},
-std::array<float,2>{0.923450589f, 0.0935557187f},
-std::array<float,2>{0.307450444f, 0.804875791f},
-std::array<float,2>{0.234140933f, 0.397248775f},
-std::array<float,2>{0.673249543f, 0.645862043f},
-std::array<float,2>{0.97529614f, 0.345803738f},
-std::array<float,2>{0.328320086f, 0.56555891f},
-std::array<float,2>{0.157608613f, 0.128797755f},
-std::array<float,2>{0.698849201f, 0.911117077f},
-std::array<float,2>{0.600008905f, 0.0579670742f},
-std::array<float,2>{0.0686874613f, 0.856934786f},
-std::array<float,2>{0.431839049f, 0.450034827f},
-std::array<float,2>{0.816766441f, 0.741193533f},
-std::array<float,2>{0.626358747f, 0.436022729f},
-std::array<float,2>{0.19173491f, 0.673148215f},
-std::array<float,2>{0.274944812f, 0.124103375f},
-std::array<float,2>{0.897562563f, 0.767107666f},
-std::array<float,2>{0.777466357f, 0.188956261f},
-std::array<float,2>{0.487798303f, 0.955329835f},
-std::array<float,2>{0.0551197976f, 0.295310736f},
-std::array<float,2>{0.523538947f, 0.520380497f},
-std::array<float,2>{0.881132066f, 0.377701849f},
-std::array<float,2>{0.253588468f, 0.627324402f},
-std::array<float,2>{0.217356265f, 0.0649252459f},
-std::array<float,2>{0.649348736f, 0.785194576f},
-std::array<float,2>{0.504145622f, 0.244470581f},
-std::array<float,2>{0.0363644734f, 0.991527379f},
-std::array<float,2>{0.478645891f, 0.257730246f},
-std::array<float,2>{0.753282607f, 0.561298668f},
-std::array<float,2>{0.709761977f, 0.327814937f},
-std::array<float,2>{0.172434181f, 0.605994582f},
-std::array<float,2>{0.327467948f, 0.159725189f},
-std::array<float,2>{0.999594867f, 0.9058097f},
-std::array<float,2>{0.840632498f, 0.0155643346f},
-std::array<float,2>{0.407701224f, 0.826470792f},
-std::array<float,2>{0.0809834152f, 0.486411631f},
-std::array<float,2>{0.612795055f, 0.700229585f},
-std::array<float,2>{0.784732223f, 0.297133446f},
-std::array<float,2>{0.465729535f, 0.502383232f},
-std::array<float,2>{0.0187576748f, 0.212264434f},
-std::array<float,2>{0.543435812f, 0.938981056f},
-std::array<float,2>{0.65925467f, 0.0957522467f},
-std::array<float,2>{0.241316378f, 0.751379728f},
-std::array<float,2>{0.286880285f, 0.420125335f},
-std::array<float,2>{0.918366671f, 0.664418101f},
-std::array<float,2>{0.588016808f, 0.462320417f},
-std::array<float,2>{0.116442502f, 0.730805516f},
-std::array<float,2>{0.399980456f, 0.0401808135f},
-std::array<float,2>{0.852996767f, 0.870275378f},
-std::array<float,2>{0.946976185f, 0.150030032f},
-std::array<float,2>{0.35775584f, 0.927906752f},
-std::array<float,2>{0.151164189f, 0.361448795f},
-std::array<float,2>{0.741389513f, 0.578675449f},
-std::array<float,2>{0.763630152f, 0.408858865f},
-std::array<float,2>{0.474627018f, 0.656408191f},
-std::array<float,2>{0.0417450219f, 0.103215255f},
-std::array<float,2>{0.512014806f, 0.762906671f},
-std::array<float,2>{0.641048014f, 0.207519427f},
-std::array<float,2>{0.207967803f, 0.947714686f},
-std::array<float,2>{0.25924778f, 0.307365626f},
-std::array<float,2>{0.883701146f, 0.512954652f},
-std::array<float,2>{0.620467484f, 0.373644322f},
-std::array<float,2>{0.0881625637f, 0.590016663f},
-std::array<float,2>{0.42062059f, 0.146892071f},
-std::array<float,2>{0.831271529f, 0.935171723f},
-std::array<float,2>{0.988548756f, 0.0385125987f},
-std::array<float,2>{0.315527856f, 0.863274813f},
-std::array<float,2>{0.18351844f, 0.456668764f},
-std::array<float,2>{0.712451339f, 0.722126484f},
-std::array<float,2>{0.910845518f, 0.262660593f},
-std::array<float,2>{0.296633571f, 0.546890795f},
-std::array<float,2>{0.244460821f, 0.239242017f},
-std::array<float,2>{0.667641222f, 0.996084571f},
-std::array<float,2>{0.532253802f, 0.0720607415f},
-std::array<float,2>{0.0297380202f, 0.792514741f},
-std::array<float,2>{0.453516841f, 0.385441095f},
-std::array<float,2>{0.795584381f, 0.633344054f},
-std::array<float,2>{0.748837054f, 0.492502421f},
-std::array<float,2>{0.14273122f, 0.687569559f},
-std::array<float,2>{0.345827371f, 0.000193729109f},
-std::array<float,2>{0.943373621f, 0.814029813f},
-std::array<float,2>{0.847948372f, 0.164512053f},
-std::array<float,2>{0.392160296f, 0.892868757f},
-std::array<float,2>{0.118784741f, 0.315299183f},
-std::array<float,2>{0.584188998f, 0.598007977f},
-std::array<float,2>{0.955128491f, 0.445155382f},
-std::array<float,2>{0.362371236f, 0.745199442f},
-std::array<float,2>{0.14038147f, 0.0482052341f},
-std::array<float,2>{0.730674565f, 0.846645534f},
-std::array<float,2>{0.567747116f, 0.13543959f},
-std::array<float,2>{0.105193131f, 0.918093264f},
-std::array<float,2>{0.382710487f, 0.358673573f},
-std::array<float,2>{0.865282834f, 0.577690482f},
-std::array<float,2>{0.681679487f, 0.288953573f},
-std::array<float,2>{0.221740782f, 0.527175903f},
-std::array<float,2>{0.304367453f, 0.195667878f},
-std::array<float,2>{0.936183989f, 0.96239984f},
-std::array<float,2>{0.802505612f, 0.115455195f},
-std::array<float,2>{0.437754363f, 0.775810182f},
-std::array<float,2>{0.0152434874f, 0.422396928f},
-std::array<float,2>{0.553982198f, 0.687441409f},
-std::array<float,2>{0.822499752f, 0.343213975f},
-std::array<float,2>{0.427625179f, 0.612437487f},
-std::array<float,2>{0.0731398538f, 0.183946133f},
-std::array<float,2>{0.607226729f, 0.876436472f},
-std::array<float,2>{0.689290524f, 0.021943409f},
-std::array<float,2>{0.171133459f, 0.841484308f},
-std::array<float,2>{0.338225633f, 0.472952098f},
-std::array<float,2>{0.979615927f, 0.704105616f},
-std::array<float,2>{0.520697057f, 0.40220502f},
-std::array<float,2>{0.0546608344f, 0.654198408f},
-std::array<float,2>{0.494269848f, 0.0849540755f},
-std::array<float,2>{0.766335666f, 0.798712671f},
-std::array<float,2>{0.902378798f, 0.227697819f},
-std::array<float,2>{0.266585678f, 0.98195523f},
-std::array<float,2>{0.198970631f, 0.280950129f},
-std::array<float,2>{0.639837146f, 0.542132258f},
-std::array<float,2>{0.835628211f, 0.393289179f},
-std::array<float,2>{0.416252911f, 0.64144218f},
-std::array<float,2>{0.0909644812f, 0.0873797312f},
-std::array<float,2>{0.621260822f, 0.811407447f},
-std::array<float,2>{0.718577147f, 0.220692053f},
-std::array<float,2>{0.183985278f, 0.974924684f},
-std::array<float,2>{0.318419486f, 0.270822912f},
-std::array<float,2>{0.986511648f, 0.537969351f},
-std::array<float,2>{0.510567307f, 0.335326582f},
-std::array<float,2>{0.0439821295f, 0.618802547f},
-std::array<float,2>{0.470618576f, 0.177996621f},
-std::array<float,2>{0.75952816f, 0.887970924f},
-std::array<float,2>{0.887949169f, 0.0310513843f},
-std::array<float,2>{0.262355894f, 0.834665298f},
-std::array<float,2>{0.204657912f, 0.478638172f},
-std::array<float,2>{0.647669792f, 0.711250842f},
-std::array<float,2>{0.939748108f, 0.2895886f},
-std::array<float,2>{0.347733378f, 0.516269326f},
-std::array<float,2>{0.147335112f, 0.192887157f},
-std::array<float,2>{0.742395043f, 0.959144056f},
-std::array<float,2>{0.57929039f, 0.118937522f},
-std::array<float,2>{0.122518547f, 0.770837426f},
-std::array<float,2>{0.39819628f, 0.429752231f},
-std::array<float,2>{0.844949424f, 0.677277088f},
-std::array<float,2>{0.671553075f, 0.448722541f},
-std::array<float,2>{0.246109441f, 0.736746728f},
-std::array<float,2>{0.289926976f, 0.0604580268f},
-std::array<float,2>{0.908251166f, 0.853582442f},
-std::array<float,2>{0.792884886f, 0.130985588f},
-std::array<float,2>{0.45787105f, 0.909666777f},
-std::array<float,2>{0.0253508519f, 0.350671738f},
-std::array<float,2>{0.538967311f, 0.567824125f},
-std::array<float,2>{0.933134079f, 0.490984261f},
-std::array<float,2>{0.297462672f, 0.696879029f},
-std::array<float,2>{0.224865094f, 0.00883022696f},
-std::array<float,2>{0.683889031f, 0.822303057f},
-std::array<float,2>{0.547047198f, 0.161671758f},
-std::array<float,2>{0.0101648374f, 0.900945246f},
-std::array<float,2>{0.444827139f, 0.323683888f},
-std::array<float,2>{0.800257504f, 0.605183661f},
-std::array<float,2>{0.730056226f, 0.250665188f},
-std::array<float,2>{0.135127082f, 0.555992424f},
-std::array<float,2>{0.364569515f, 0.246756569f},
-std::array<float,2>{0.960394621f, 0.986831486f},
-std::array<float,2>{0.860838532f, 0.0668143407f},
-std::array<float,2>{0.37851578f, 0.782186687f},
-std::array<float,2>{0.105521038f, 0.381416082f},
-std::array<float,2>{0.564230025f, 0.629043221f},
-std::array<float,2>{0.769572437f, 0.363416374f},
-std::array<float,2>{0.496180862f, 0.583078265f},
-std::array<float,2>{0.0472593457f, 0.153051361f},
-std::array<float,2>{0.51943773f, 0.922743499f},
-std::array<float,2>{0.633430958f, 0.0440737121f},
-std::array<float,2>{0.201456144f, 0.874302506f},
-std::array<float,2>{0.272328496f, 0.467368364f},
-std::array<float,2>{0.900280535f, 0.728354037f},
-std::array<float,2>{0.602646589f, 0.416383684f},
-std::array<float,2>{0.0766170099f, 0.671411455f},
-std::array<float,2>{0.421940327f, 0.0997018218f},
-std::array<float,2>{0.82512629f, 0.75628823f},
-std::array<float,2>{0.983732164f, 0.215053022f},
-std::array<float,2>{0.341095299f, 0.942949772f},
-std::array<float,2>{0.164173037f, 0.302580416f},
-std::array<float,2>{0.694241047f, 0.5056265f},
-std::array<float,2>{0.806225061f, 0.459817052f},
-std::array<float,2>{0.45010978f, 0.726062655f},
-std::array<float,2>{0.00559906941f, 0.0315592214f},
-std::array<float,2>{0.559578955f, 0.865028083f},
-std::array<float,2>{0.678190172f, 0.141687647f},
-std::array<float,2>{0.227065727f, 0.933323503f},
-std::array<float,2>{0.310431361f, 0.370404691f},
-std::array<float,2>{0.92589891f, 0.586523533f},
-std::array<float,2>{0.570946693f, 0.310682058f},
-std::array<float,2>{0.101198882f, 0.508276165f},
-std::array<float,2>{0.386943132f, 0.206411421f},
-std::array<float,2>{0.86796844f, 0.951681137f},
-std::array<float,2>{0.96168077f, 0.109335795f},
-std::array<float,2>{0.368083f, 0.761328459f},
-std::array<float,2>{0.129220188f, 0.413312912f},
-std::array<float,2>{0.723965824f, 0.662149668f},
-std::array<float,2>{0.892134845f, 0.316471606f},
-std::array<float,2>{0.278697044f, 0.595454514f},
-std::array<float,2>{0.189898223f, 0.168765262f},
-std::array<float,2>{0.63253963f, 0.897654414f},
-std::array<float,2>{0.529582798f, 0.00760050304f},
-std::array<float,2>{0.059581738f, 0.819657922f},
-std::array<float,2>{0.489392281f, 0.496398628f},
-std::array<float,2>{0.775363863f, 0.69310379f},
-std::array<float,2>{0.702896714f, 0.390105814f},
-std::array<float,2>{0.16128917f, 0.638681293f},
-std::array<float,2>{0.33555907f, 0.07760223f},
-std::array<float,2>{0.968862891f, 0.79451865f},
-std::array<float,2>{0.813389063f, 0.23620975f},
-std::array<float,2>{0.434614807f, 0.999875009f},
-std::array<float,2>{0.0650817603f, 0.261408359f},
-std::array<float,2>{0.59544754f, 0.551071286f},
-std::array<float,2>{0.99537921f, 0.426815569f},
-std::array<float,2>{0.322717071f, 0.682271123f},
-std::array<float,2>{0.176669836f, 0.110786036f},
-std::array<float,2>{0.703494966f, 0.779550493f},
-std::array<float,2>{0.616389692f, 0.202077731f},
-std::array<float,2>{0.0855414644f, 0.967776835f},
-std::array<float,2>{0.413651079f, 0.282068759f},
-std::array<float,2>{0.837123036f, 0.529950321f},
-std::array<float,2>{0.653400362f, 0.353513211f},
-std::array<float,2>{0.214267641f, 0.57311517f},
-std::array<float,2>{0.255348325f, 0.140581295f},
-std::array<float,2>{0.878394127f, 0.914160192f},
-std::array<float,2>{0.754531205f, 0.0531802177f},
-std::array<float,2>{0.483135194f, 0.850075901f},
-std::array<float,2>{0.0323489532f, 0.437852681f},
-std::array<float,2>{0.500678182f, 0.748983979f},
-std::array<float,2>{0.856778383f, 0.274339825f},
-std::array<float,2>{0.402359486f, 0.545964599f},
-std::array<float,2>{0.109604813f, 0.23172079f},
-std::array<float,2>{0.591673553f, 0.980350852f},
-std::array<float,2>{0.735287011f, 0.0812899768f},
-std::array<float,2>{0.153311118f, 0.804474592f},
-std::array<float,2>{0.353943318f, 0.40258953f},
-std::array<float,2>{0.950433373f, 0.65212208f},
-std::array<float,2>{0.541968107f, 0.470712751f},
-std::array<float,2>{0.0213477444f, 0.708032012f},
-std::array<float,2>{0.464229077f, 0.0169329979f},
-std::array<float,2>{0.787772834f, 0.838182986f},
-std::array<float,2>{0.916212618f, 0.179733142f},
-std::array<float,2>{0.283763379f, 0.880328596f},
-std::array<float,2>{0.235193864f, 0.33719793f},
-std::array<float,2>{0.660602689f, 0.616875827f},
-std::array<float,2>{0.819803059f, 0.451819271f},
-std::array<float,2>{0.429926723f, 0.738470018f},
-std::array<float,2>{0.0683374777f, 0.0565197468f},
-std::array<float,2>{0.598135531f, 0.858270943f},
-std::array<float,2>{0.695888698f, 0.125981882f},
-std::array<float,2>{0.158430278f, 0.912125409f},
-std::array<float,2>{0.331564516f, 0.344940424f},
-std::array<float,2>{0.974338889f, 0.562541485f},
-std::array<float,2>{0.526359022f, 0.293381333f},
-std::array<float,2>{0.0566542707f, 0.522037089f},
-std::array<float,2>{0.485555798f, 0.190274566f},
-std::array<float,2>{0.779459715f, 0.953371286f},
-std::array<float,2>{0.895876288f, 0.122488074f},
-std::array<float,2>{0.276584327f, 0.768030405f},
-std::array<float,2>{0.194992661f, 0.433781505f},
-std::array<float,2>{0.628793895f, 0.67564714f},
-std::array<float,2>{0.965972424f, 0.330114514f},
-std::array<float,2>{0.374121249f, 0.622990072f},
-std::array<float,2>{0.125758424f, 0.175215632f},
-std::array<float,2>{0.721708238f, 0.88599503f},
-std::array<float,2>{0.575903475f, 0.0260112807f},
-std::array<float,2>{0.09534657f, 0.831672013f},
-std::array<float,2>{0.382872909f, 0.482861787f},
-std::array<float,2>{0.874094069f, 0.717906952f},
-std::array<float,2>{0.67450285f, 0.396215618f},
-std::array<float,2>{0.230951682f, 0.647385418f},
-std::array<float,2>{0.305043548f, 0.0914592817f},
-std::array<float,2>{0.925292671f, 0.808095336f},
-std::array<float,2>{0.809639692f, 0.223966211f},
-std::array<float,2>{0.448588163f, 0.971828938f},
-std::array<float,2>{0.000716662908f, 0.269517869f},
-std::array<float,2>{0.556030691f, 0.533127546f},
-std::array<float,2>{0.920365453f, 0.418796897f},
-std::array<float,2>{0.288815379f, 0.666062474f},
-std::array<float,2>{0.238618955f, 0.0947940126f},
-std::array<float,2>{0.656584144f, 0.753759325f},
-std::array<float,2>{0.546373665f, 0.213657975f},
-std::array<float,2>{0.0161752291f, 0.941038907f},
-std::array<float,2>{0.467252374f, 0.299838036f},
-std::array<float,2>{0.781884134f, 0.501300573f},
-std::array<float,2>{0.740218759f, 0.361019343f},
-std::array<float,2>{0.149390981f, 0.580290198f},
-std::array<float,2>{0.357082009f, 0.151466385f},
-std::array<float,2>{0.947492719f, 0.92619437f},
-std::array<float,2>{0.853763282f, 0.0425392985f},
-std::array<float,2>{0.400412828f, 0.868485153f},
-std::array<float,2>{0.114697039f, 0.464609683f},
-std::array<float,2>{0.586310387f, 0.732819617f},
-std::array<float,2>{0.750307798f, 0.254817814f},
-std::array<float,2>{0.47678256f, 0.558855176f},
-std::array<float,2>{0.0384323709f, 0.244137675f},
-std::array<float,2>{0.50669235f, 0.988443971f},
-std::array<float,2>{0.65040642f, 0.063616693f},
-std::array<float,2>{0.216499835f, 0.788517594f},
-std::array<float,2>{0.251134723f, 0.376090348f},
-std::array<float,2>{0.879145741f, 0.625680625f},
-std::array<float,2>{0.610279143f, 0.48596698f},
-std::array<float,2>{0.0791347027f, 0.702305019f},
-std::array<float,2>{0.408921093f, 0.0127628017f},
-std::array<float,2>{0.843208432f, 0.825355828f},
-std::array<float,2>{0.996343195f, 0.157234922f},
-std::array<float,2>{0.32591635f, 0.903973579f},
-std::array<float,2>{0.175401747f, 0.32504335f},
-std::array<float,2>{0.707505822f, 0.608051538f},
-std::array<float,2>{0.793281794f, 0.383902758f},
-std::array<float,2>{0.456759185f, 0.636337161f},
-std::array<float,2>{0.0288010519f, 0.0725134313f},
-std::array<float,2>{0.534571946f, 0.790653586f},
-std::array<float,2>{0.664660156f, 0.240820765f},
-std::array<float,2>{0.242393553f, 0.993810654f},
-std::array<float,2>{0.294880241f, 0.264570594f},
-std::array<float,2>{0.913598716f, 0.550630212f},
-std::array<float,2>{0.582799673f, 0.313057959f},
-std::array<float,2>{0.119540848f, 0.600796819f},
-std::array<float,2>{0.393951207f, 0.166736826f},
-std::array<float,2>{0.851370335f, 0.891373336f},
-std::array<float,2>{0.94164747f, 0.00378830684f},
-std::array<float,2>{0.344708085f, 0.815743506f},
-std::array<float,2>{0.141239107f, 0.494327664f},
-std::array<float,2>{0.748036385f, 0.689629138f},
-std::array<float,2>{0.886412919f, 0.306468427f},
-std::array<float,2>{0.260782391f, 0.515577197f},
-std::array<float,2>{0.20968464f, 0.210076913f},
-std::array<float,2>{0.643214703f, 0.94630909f},
-std::array<float,2>{0.514082015f, 0.103865072f},
-std::array<float,2>{0.0399964415f, 0.764468312f},
-std::array<float,2>{0.474004388f, 0.406923145f},
-std::array<float,2>{0.76522851f, 0.65852195f},
-std::array<float,2>{0.714604557f, 0.454113275f},
-std::array<float,2>{0.179797143f, 0.72061944f},
-std::array<float,2>{0.313052058f, 0.0366697982f},
-std::array<float,2>{0.991973221f, 0.860620737f},
-std::array<float,2>{0.828455567f, 0.14641723f},
-std::array<float,2>{0.418179333f, 0.937324584f},
-std::array<float,2>{0.0868299827f, 0.371189058f},
-std::array<float,2>{0.617625654f, 0.592009127f},
-std::array<float,2>{0.977807939f, 0.475149423f},
-std::array<float,2>{0.337448627f, 0.705087602f},
-std::array<float,2>{0.169903919f, 0.0211371295f},
-std::array<float,2>{0.690790355f, 0.842361748f},
-std::array<float,2>{0.60869962f, 0.186892956f},
-std::array<float,2>{0.0712003931f, 0.878295839f},
-std::array<float,2>{0.42850253f, 0.34068951f},
-std::array<float,2>{0.822059214f, 0.609979272f},
-std::array<float,2>{0.636819124f, 0.278763503f},
-std::array<float,2>{0.196313575f, 0.540155053f},
-std::array<float,2>{0.268168509f, 0.2302652f},
-std::array<float,2>{0.905834317f, 0.98402971f},
-std::array<float,2>{0.76918292f, 0.0828631595f},
-std::array<float,2>{0.492331028f, 0.800095141f},
-std::array<float,2>{0.0517293178f, 0.399918377f},
-std::array<float,2>{0.523101389f, 0.655104697f},
-std::array<float,2>{0.864133418f, 0.35571909f},
-std::array<float,2>{0.380350143f, 0.574685752f},
-std::array<float,2>{0.103256486f, 0.133778304f},
-std::array<float,2>{0.569708467f, 0.921291828f},
-std::array<float,2>{0.732646048f, 0.0491419062f},
-std::array<float,2>{0.137949824f, 0.844666183f},
-std::array<float,2>{0.361157417f, 0.441786975f},
-std::array<float,2>{0.953683853f, 0.743672311f},
-std::array<float,2>{0.551029146f, 0.424151838f},
-std::array<float,2>{0.0122136017f, 0.683801353f},
-std::array<float,2>{0.439834863f, 0.114261948f},
-std::array<float,2>{0.803760231f, 0.773894727f},
-std::array<float,2>{0.933914959f, 0.199128494f},
-std::array<float,2>{0.300980598f, 0.964824378f},
-std::array<float,2>{0.219331056f, 0.286029249f},
-std::array<float,2>{0.680845141f, 0.523778081f},
-std::array<float,2>{0.845719099f, 0.433407754f},
-std::array<float,2>{0.394832224f, 0.678396285f},
-std::array<float,2>{0.123824202f, 0.12051674f},
-std::array<float,2>{0.581604183f, 0.771845758f},
-std::array<float,2>{0.74523586f, 0.194781274f},
-std::array<float,2>{0.145986393f, 0.957210124f},
-std::array<float,2>{0.350615293f, 0.291738749f},
-std::array<float,2>{0.938616395f, 0.518776834f},
-std::array<float,2>{0.536177039f, 0.348753929f},
-std::array<float,2>{0.0271676499f, 0.569519818f},
-std::array<float,2>{0.459460407f, 0.129197568f},
-std::array<float,2>{0.790819466f, 0.907762229f},
-std::array<float,2>{0.906374514f, 0.0624743365f},
-std::array<float,2>{0.29140231f, 0.852944374f},
-std::array<float,2>{0.249023348f, 0.44620344f},
-std::array<float,2>{0.668824792f, 0.736204803f},
-std::array<float,2>{0.985569477f, 0.272307932f},
-std::array<float,2>{0.317343324f, 0.536819279f},
-std::array<float,2>{0.18568036f, 0.221569359f},
-std::array<float,2>{0.716156244f, 0.973145187f},
-std::array<float,2>{0.62453711f, 0.0889943317f},
-std::array<float,2>{0.0929200798f, 0.808834612f},
-std::array<float,2>{0.415524036f, 0.39234218f},
-std::array<float,2>{0.83321774f, 0.644080758f},
-std::array<float,2>{0.646418154f, 0.477404267f},
-std::array<float,2>{0.206953421f, 0.714226961f},
-std::array<float,2>{0.26395157f, 0.0279465765f},
-std::array<float,2>{0.89031899f, 0.832876146f},
-std::array<float,2>{0.760574818f, 0.176480159f},
-std::array<float,2>{0.472645551f, 0.888980627f},
-std::array<float,2>{0.0459273607f, 0.332235128f},
-std::array<float,2>{0.508657992f, 0.619569421f},
-std::array<float,2>{0.902320385f, 0.465495676f},
-std::array<float,2>{0.270030886f, 0.729878187f},
-std::array<float,2>{0.199571699f, 0.0451635979f},
-std::array<float,2>{0.636157691f, 0.872619033f},
-std::array<float,2>{0.517389953f, 0.155101463f},
-std::array<float,2>{0.049283348f, 0.924172699f},
-std::array<float,2>{0.49894318f, 0.365585655f},
-std::array<float,2>{0.773204029f, 0.585473597f},
-std::array<float,2>{0.692332447f, 0.303879827f},
-std::array<float,2>{0.167332143f, 0.506181002f},
-std::array<float,2>{0.343375146f, 0.218749195f},
-std::array<float,2>{0.982329071f, 0.944097698f},
-std::array<float,2>{0.828086972f, 0.0993140936f},
-std::array<float,2>{0.424866915f, 0.754511237f},
-std::array<float,2>{0.0748804957f, 0.414522558f},
-std::array<float,2>{0.603836894f, 0.669889033f},
-std::array<float,2>{0.798740387f, 0.321787089f},
-std::array<float,2>{0.443304956f, 0.603351831f},
-std::array<float,2>{0.00851832144f, 0.162506908f},
-std::array<float,2>{0.549355686f, 0.899532795f},
-std::array<float,2>{0.686542332f, 0.0112272706f},
-std::array<float,2>{0.224146694f, 0.820909798f},
-std::array<float,2>{0.300123692f, 0.488931239f},
-std::array<float,2>{0.930888653f, 0.699022651f},
-std::array<float,2>{0.566211522f, 0.379399925f},
-std::array<float,2>{0.10871096f, 0.63151896f},
-std::array<float,2>{0.376181811f, 0.0697334558f},
-std::array<float,2>{0.862643659f, 0.784876585f},
-std::array<float,2>{0.95756346f, 0.24904345f},
-std::array<float,2>{0.365332574f, 0.984467626f},
-std::array<float,2>{0.133557826f, 0.25225094f},
-std::array<float,2>{0.727297008f, 0.558480203f},
-std::array<float,2>{0.776378989f, 0.499852061f},
-std::array<float,2>{0.490367949f, 0.694819331f},
-std::array<float,2>{0.0623599663f, 0.00507911807f},
-std::array<float,2>{0.528644264f, 0.817567885f},
-std::array<float,2>{0.629432857f, 0.171740413f},
-std::array<float,2>{0.187554017f, 0.89580673f},
-std::array<float,2>{0.279451907f, 0.319567412f},
-std::array<float,2>{0.894289553f, 0.596324384f},
-std::array<float,2>{0.596365988f, 0.259028703f},
-std::array<float,2>{0.0629777536f, 0.554243624f},
-std::array<float,2>{0.435754031f, 0.237496451f},
-std::array<float,2>{0.815186977f, 0.996468782f},
-std::array<float,2>{0.972131014f, 0.0744234324f},
-std::array<float,2>{0.333834022f, 0.796557963f},
-std::array<float,2>{0.163627252f, 0.387555152f},
-std::array<float,2>{0.700762391f, 0.637176394f},
-std::array<float,2>{0.929623485f, 0.367868394f},
-std::array<float,2>{0.310770363f, 0.589139998f},
-std::array<float,2>{0.229824975f, 0.144205943f},
-std::array<float,2>{0.676869988f, 0.930941105f},
-std::array<float,2>{0.560573518f, 0.0346279368f},
-std::array<float,2>{0.00774392206f, 0.866790056f},
-std::array<float,2>{0.452822655f, 0.458779752f},
-std::array<float,2>{0.808420897f, 0.723474383f},
-std::array<float,2>{0.726100445f, 0.412017643f},
-std::array<float,2>{0.131169513f, 0.660580933f},
-std::array<float,2>{0.369646996f, 0.105958365f},
-std::array<float,2>{0.964234054f, 0.758581996f},
-std::array<float,2>{0.870401204f, 0.203356788f},
-std::array<float,2>{0.389715433f, 0.949661136f},
-std::array<float,2>{0.0981682241f, 0.310542881f},
-std::array<float,2>{0.572923839f, 0.511591613f},
-std::array<float,2>{0.952075243f, 0.405398518f},
-std::array<float,2>{0.35204196f, 0.649017334f},
-std::array<float,2>{0.155609265f, 0.079903692f},
-std::array<float,2>{0.738239348f, 0.801339746f},
-std::array<float,2>{0.592205882f, 0.232493907f},
-std::array<float,2>{0.112145908f, 0.978306472f},
-std::array<float,2>{0.405270755f, 0.276432872f},
-std::array<float,2>{0.859321654f, 0.543755531f},
-std::array<float,2>{0.663637757f, 0.33809498f},
-std::array<float,2>{0.23688899f, 0.615065753f},
-std::array<float,2>{0.282981038f, 0.18313542f},
-std::array<float,2>{0.914882302f, 0.882439375f},
-std::array<float,2>{0.786523461f, 0.0190686174f},
-std::array<float,2>{0.462768197f, 0.836408556f},
-std::array<float,2>{0.0216457527f, 0.470355242f},
-std::array<float,2>{0.540492713f, 0.70963937f},
-std::array<float,2>{0.838387191f, 0.285100251f},
-std::array<float,2>{0.410711795f, 0.528310955f},
-std::array<float,2>{0.0835362002f, 0.200252414f},
-std::array<float,2>{0.614610374f, 0.965475738f},
-std::array<float,2>{0.706316292f, 0.111443534f},
-std::array<float,2>{0.179020494f, 0.777839422f},
-std::array<float,2>{0.321585387f, 0.429486901f},
-std::array<float,2>{0.993499041f, 0.679861367f},
-std::array<float,2>{0.502792597f, 0.43962276f},
-std::array<float,2>{0.0341299474f, 0.747070014f},
-std::array<float,2>{0.480771154f, 0.0516464151f},
-std::array<float,2>{0.756506085f, 0.84805572f},
-std::array<float,2>{0.876366258f, 0.136810258f},
-std::array<float,2>{0.257279664f, 0.916303515f},
-std::array<float,2>{0.211932838f, 0.354771644f},
-std::array<float,2>{0.655523658f, 0.57189858f},
-std::array<float,2>{0.832180202f, 0.478801042f},
-std::array<float,2>{0.414526194f, 0.710968494f},
-std::array<float,2>{0.092541419f, 0.0308545753f},
-std::array<float,2>{0.623749971f, 0.834759772f},
-std::array<float,2>{0.715565205f, 0.177851439f},
-std::array<float,2>{0.186968386f, 0.88788259f},
-std::array<float,2>{0.318022966f, 0.335080087f},
-std::array<float,2>{0.984762549f, 0.618970811f},
-std::array<float,2>{0.509728134f, 0.270615995f},
-std::array<float,2>{0.0451398902f, 0.53762579f},
-std::array<float,2>{0.470720261f, 0.22031565f},
-std::array<float,2>{0.761633992f, 0.974793971f},
-std::array<float,2>{0.889247596f, 0.0869579837f},
-std::array<float,2>{0.26555413f, 0.811157346f},
-std::array<float,2>{0.205572814f, 0.393553793f},
-std::array<float,2>{0.644962132f, 0.641318023f},
-std::array<float,2>{0.938034236f, 0.351058275f},
-std::array<float,2>{0.350242257f, 0.567402661f},
-std::array<float,2>{0.145237908f, 0.131217942f},
-std::array<float,2>{0.744968772f, 0.909422755f},
-std::array<float,2>{0.580672085f, 0.0602602884f},
-std::array<float,2>{0.124626048f, 0.853921533f},
-std::array<float,2>{0.396020412f, 0.448427439f},
-std::array<float,2>{0.847273707f, 0.736522436f},
-std::array<float,2>{0.669833124f, 0.429985285f},
-std::array<float,2>{0.249295354f, 0.677707374f},
-std::array<float,2>{0.292237967f, 0.118656352f},
-std::array<float,2>{0.907971203f, 0.770681679f},
-std::array<float,2>{0.789257944f, 0.193344593f},
-std::array<float,2>{0.460332751f, 0.959232688f},
-std::array<float,2>{0.0257044323f, 0.290005773f},
-std::array<float,2>{0.535728872f, 0.516493976f},
-std::array<float,2>{0.929942369f, 0.38174817f},
-std::array<float,2>{0.298895329f, 0.629236996f},
-std::array<float,2>{0.223277926f, 0.0665415525f},
-std::array<float,2>{0.686318159f, 0.781888425f},
-std::array<float,2>{0.5498842f, 0.246969327f},
-std::array<float,2>{0.00974693988f, 0.987210631f},
-std::array<float,2>{0.441957831f, 0.250834972f},
-std::array<float,2>{0.797121406f, 0.555853367f},
-std::array<float,2>{0.727803588f, 0.323382348f},
-std::array<float,2>{0.134034365f, 0.605226636f},
-std::array<float,2>{0.36696589f, 0.161901489f},
-std::array<float,2>{0.958808661f, 0.901245952f},
-std::array<float,2>{0.861823142f, 0.00926479977f},
-std::array<float,2>{0.375197381f, 0.822661519f},
-std::array<float,2>{0.108063504f, 0.490935951f},
-std::array<float,2>{0.564668477f, 0.697021902f},
-std::array<float,2>{0.771503985f, 0.302254528f},
-std::array<float,2>{0.499271154f, 0.505512834f},
-std::array<float,2>{0.0501065962f, 0.215237945f},
-std::array<float,2>{0.515855074f, 0.943192661f},
-std::array<float,2>{0.635353923f, 0.100003809f},
-std::array<float,2>{0.200536221f, 0.756087303f},
-std::array<float,2>{0.271348089f, 0.416227669f},
-std::array<float,2>{0.901073754f, 0.671787143f},
-std::array<float,2>{0.605224609f, 0.467753679f},
-std::array<float,2>{0.0753702372f, 0.728255332f},
-std::array<float,2>{0.424774736f, 0.0442302227f},
-std::array<float,2>{0.827091336f, 0.874165177f},
-std::array<float,2>{0.981197715f, 0.153131887f},
-std::array<float,2>{0.342688471f, 0.922509909f},
-std::array<float,2>{0.166923493f, 0.363725543f},
-std::array<float,2>{0.693098545f, 0.583358347f},
-std::array<float,2>{0.80687058f, 0.413373262f},
-std::array<float,2>{0.451316714f, 0.662557483f},
-std::array<float,2>{0.00618737703f, 0.109072737f},
-std::array<float,2>{0.562002301f, 0.761565626f},
-std::array<float,2>{0.675957143f, 0.206128582f},
-std::array<float,2>{0.229085848f, 0.952000976f},
-std::array<float,2>{0.312193036f, 0.310839176f},
-std::array<float,2>{0.928411782f, 0.507983148f},
-std::array<float,2>{0.573449731f, 0.37034291f},
-std::array<float,2>{0.0996084288f, 0.586822331f},
-std::array<float,2>{0.388903022f, 0.142037258f},
-std::array<float,2>{0.869862914f, 0.93341291f},
-std::array<float,2>{0.963724375f, 0.0313956328f},
-std::array<float,2>{0.370724589f, 0.864931822f},
-std::array<float,2>{0.131913885f, 0.459502459f},
-std::array<float,2>{0.725235879f, 0.72561717f},
-std::array<float,2>{0.892729223f, 0.261524022f},
-std::array<float,2>{0.280555725f, 0.550896585f},
-std::array<float,2>{0.188979656f, 0.236048147f},
-std::array<float,2>{0.630173981f, 0.999552727f},
-std::array<float,2>{0.527811944f, 0.0772301182f},
-std::array<float,2>{0.0606442764f, 0.794900596f},
-std::array<float,2>{0.491624177f, 0.38968727f},
-std::array<float,2>{0.77548784f, 0.6390903f},
-std::array<float,2>{0.699768305f, 0.496170998f},
-std::array<float,2>{0.162387341f, 0.693323374f},
-std::array<float,2>{0.332153767f, 0.00738100428f},
-std::array<float,2>{0.970858991f, 0.819475353f},
-std::array<float,2>{0.815712392f, 0.168658778f},
-std::array<float,2>{0.436606348f, 0.897893012f},
-std::array<float,2>{0.0644309968f, 0.316756964f},
-std::array<float,2>{0.59736675f, 0.595577836f},
-std::array<float,2>{0.99239552f, 0.437681615f},
-std::array<float,2>{0.320346266f, 0.748645782f},
-std::array<float,2>{0.17852366f, 0.0528196916f},
-std::array<float,2>{0.705222368f, 0.849841356f},
-std::array<float,2>{0.614182115f, 0.140163049f},
-std::array<float,2>{0.0830040127f, 0.914337933f},
-std::array<float,2>{0.411830485f, 0.353123128f},
-std::array<float,2>{0.839447379f, 0.572942793f},
-std::array<float,2>{0.654453993f, 0.281782359f},
-std::array<float,2>{0.211043224f, 0.530040443f},
-std::array<float,2>{0.256363422f, 0.201841697f},
-std::array<float,2>{0.875931144f, 0.968136549f},
-std::array<float,2>{0.757510722f, 0.110354222f},
-std::array<float,2>{0.481935322f, 0.7792992f},
-std::array<float,2>{0.0342306867f, 0.427033693f},
-std::array<float,2>{0.503342569f, 0.682501853f},
-std::array<float,2>{0.857448101f, 0.337067246f},
-std::array<float,2>{0.405567914f, 0.617026567f},
-std::array<float,2>{0.112882443f, 0.180066705f},
-std::array<float,2>{0.593126535f, 0.880019546f},
-std::array<float,2>{0.73686558f, 0.0168299824f},
-std::array<float,2>{0.154447109f, 0.837931454f},
-std::array<float,2>{0.352854967f, 0.471064568f},
-std::array<float,2>{0.95274955f, 0.708402514f},
-std::array<float,2>{0.5392676f, 0.402492344f},
-std::array<float,2>{0.0232929382f, 0.651966333f},
-std::array<float,2>{0.461628407f, 0.0814005136f},
-std::array<float,2>{0.785556734f, 0.80421412f},
-std::array<float,2>{0.915827215f, 0.231588915f},
-std::array<float,2>{0.281867355f, 0.980220318f},
-std::array<float,2>{0.237786725f, 0.274138659f},
-std::array<float,2>{0.66304183f, 0.546281397f},
-std::array<float,2>{0.873159468f, 0.397044033f},
-std::array<float,2>{0.383932859f, 0.645648539f},
-std::array<float,2>{0.094197318f, 0.0933467522f},
-std::array<float,2>{0.574885964f, 0.805069208f},
-std::array<float,2>{0.720863283f, 0.225982264f},
-std::array<float,2>{0.126554191f, 0.969867349f},
-std::array<float,2>{0.373778105f, 0.266185999f},
-std::array<float,2>{0.965340078f, 0.534754097f},
-std::array<float,2>{0.555327594f, 0.330055207f},
-std::array<float,2>{0.00141873304f, 0.624636531f},
-std::array<float,2>{0.447352529f, 0.173368201f},
-std::array<float,2>{0.809372902f, 0.882945836f},
-std::array<float,2>{0.924155056f, 0.0235986616f},
-std::array<float,2>{0.305674911f, 0.829358697f},
-std::array<float,2>{0.231569991f, 0.480846703f},
-std::array<float,2>{0.674960315f, 0.715639293f},
-std::array<float,2>{0.973176599f, 0.294964254f},
-std::array<float,2>{0.33025986f, 0.520115674f},
-std::array<float,2>{0.159682184f, 0.188690946f},
-std::array<float,2>{0.696994066f, 0.955153704f},
-std::array<float,2>{0.59889102f, 0.124477401f},
-std::array<float,2>{0.0665117428f, 0.767356753f},
-std::array<float,2>{0.431595504f, 0.435746193f},
-std::array<float,2>{0.818665206f, 0.673094511f},
-std::array<float,2>{0.627604187f, 0.449763179f},
-std::array<float,2>{0.193740129f, 0.740936458f},
-std::array<float,2>{0.275842696f, 0.0576923639f},
-std::array<float,2>{0.894920886f, 0.857300401f},
-std::array<float,2>{0.780324519f, 0.128566518f},
-std::array<float,2>{0.484432012f, 0.910844028f},
-std::array<float,2>{0.0581200942f, 0.346172184f},
-std::array<float,2>{0.527283013f, 0.565678418f},
-std::array<float,2>{0.880664706f, 0.486670196f},
-std::array<float,2>{0.250851005f, 0.700441658f},
-std::array<float,2>{0.215129003f, 0.0151526406f},
-std::array<float,2>{0.652290225f, 0.826253057f},
-std::array<float,2>{0.507520795f, 0.159998074f},
-std::array<float,2>{0.0379162803f, 0.906029642f},
-std::array<float,2>{0.477918446f, 0.328026414f},
-std::array<float,2>{0.751131654f, 0.606248975f},
-std::array<float,2>{0.708795309f, 0.257378489f},
-std::array<float,2>{0.174595073f, 0.561177492f},
-std::array<float,2>{0.325184554f, 0.244190961f},
-std::array<float,2>{0.997101605f, 0.991418839f},
-std::array<float,2>{0.841813207f, 0.0644845814f},
-std::array<float,2>{0.409971863f, 0.785561025f},
-std::array<float,2>{0.0785740092f, 0.377525687f},
-std::array<float,2>{0.610994279f, 0.62709856f},
-std::array<float,2>{0.782525361f, 0.361730635f},
-std::array<float,2>{0.46847105f, 0.578954518f},
-std::array<float,2>{0.0173621476f, 0.150203481f},
-std::array<float,2>{0.545154333f, 0.928013861f},
-std::array<float,2>{0.65745455f, 0.0403102599f},
-std::array<float,2>{0.23926568f, 0.870525777f},
-std::array<float,2>{0.287291855f, 0.462147027f},
-std::array<float,2>{0.921591341f, 0.730620861f},
-std::array<float,2>{0.587648571f, 0.420354664f},
-std::array<float,2>{0.113912784f, 0.664246321f},
-std::array<float,2>{0.401644498f, 0.0961041972f},
-std::array<float,2>{0.854698479f, 0.751178622f},
-std::array<float,2>{0.949138582f, 0.211957052f},
-std::array<float,2>{0.356282562f, 0.939243376f},
-std::array<float,2>{0.149995163f, 0.297011346f},
-std::array<float,2>{0.73859489f, 0.502097845f},
-std::array<float,2>{0.764233649f, 0.456992567f},
-std::array<float,2>{0.473564327f, 0.721714437f},
-std::array<float,2>{0.0407878235f, 0.0382149778f},
-std::array<float,2>{0.515073836f, 0.862937093f},
-std::array<float,2>{0.644166231f, 0.146524683f},
-std::array<float,2>{0.210623816f, 0.935529113f},
-std::array<float,2>{0.259805739f, 0.373928994f},
-std::array<float,2>{0.884953201f, 0.590107083f},
-std::array<float,2>{0.618597686f, 0.30740875f},
-std::array<float,2>{0.0873954296f, 0.512803793f},
-std::array<float,2>{0.41961959f, 0.20710361f},
-std::array<float,2>{0.829292595f, 0.947416306f},
-std::array<float,2>{0.990277052f, 0.103302836f},
-std::array<float,2>{0.313881099f, 0.763142824f},
-std::array<float,2>{0.181164369f, 0.409082592f},
-std::array<float,2>{0.713558674f, 0.65657419f},
-std::array<float,2>{0.912897587f, 0.315175533f},
-std::array<float,2>{0.293866128f, 0.597709477f},
-std::array<float,2>{0.243972689f, 0.164188564f},
-std::array<float,2>{0.665116131f, 0.892752826f},
-std::array<float,2>{0.533689797f, 0.000406462321f},
-std::array<float,2>{0.0282365885f, 0.814405441f},
-std::array<float,2>{0.455690712f, 0.492311597f},
-std::array<float,2>{0.794156492f, 0.687764585f},
-std::array<float,2>{0.7469697f, 0.385689497f},
-std::array<float,2>{0.142028183f, 0.633655369f},
-std::array<float,2>{0.344816387f, 0.0717983693f},
-std::array<float,2>{0.942791462f, 0.792908192f},
-std::array<float,2>{0.850060046f, 0.238871634f},
-std::array<float,2>{0.393294752f, 0.995627463f},
-std::array<float,2>{0.121047229f, 0.262379378f},
-std::array<float,2>{0.583866119f, 0.547247767f},
-std::array<float,2>{0.954658508f, 0.42261529f},
-std::array<float,2>{0.36015588f, 0.687028944f},
-std::array<float,2>{0.137472048f, 0.115580082f},
-std::array<float,2>{0.733601809f, 0.775450826f},
-std::array<float,2>{0.568757236f, 0.195428118f},
-std::array<float,2>{0.10252621f, 0.96208936f},
-std::array<float,2>{0.379017979f, 0.288659632f},
-std::array<float,2>{0.864393592f, 0.526952863f},
-std::array<float,2>{0.680607915f, 0.358580917f},
-std::array<float,2>{0.220647663f, 0.577920973f},
-std::array<float,2>{0.302559912f, 0.135568529f},
-std::array<float,2>{0.935231328f, 0.918309927f},
-std::array<float,2>{0.803297639f, 0.0480198786f},
-std::array<float,2>{0.441148669f, 0.84621793f},
-std::array<float,2>{0.0133406324f, 0.444967151f},
-std::array<float,2>{0.552700877f, 0.74549222f},
-std::array<float,2>{0.820696473f, 0.28124097f},
-std::array<float,2>{0.429556161f, 0.542441547f},
-std::array<float,2>{0.0715316609f, 0.22790429f},
-std::array<float,2>{0.608234346f, 0.982322514f},
-std::array<float,2>{0.689696014f, 0.0844871551f},
-std::array<float,2>{0.168703407f, 0.798459411f},
-std::array<float,2>{0.336782604f, 0.401911288f},
-std::array<float,2>{0.976585448f, 0.653947532f},
-std::array<float,2>{0.521796227f, 0.472897947f},
-std::array<float,2>{0.0526644476f, 0.704513252f},
-std::array<float,2>{0.493429393f, 0.0215914603f},
-std::array<float,2>{0.767728209f, 0.841567814f},
-std::array<float,2>{0.904600143f, 0.183744028f},
-std::array<float,2>{0.269138783f, 0.876038671f},
-std::array<float,2>{0.196127817f, 0.342832118f},
-std::array<float,2>{0.638638556f, 0.612715781f},
-std::array<float,2>{0.844554186f, 0.445939302f},
-std::array<float,2>{0.397396713f, 0.736051738f},
-std::array<float,2>{0.12177068f, 0.0621039644f},
-std::array<float,2>{0.578391671f, 0.852685332f},
-std::array<float,2>{0.743232787f, 0.129125699f},
-std::array<float,2>{0.148257032f, 0.908055186f},
-std::array<float,2>{0.348745346f, 0.348913819f},
-std::array<float,2>{0.941186011f, 0.569596112f},
-std::array<float,2>{0.537327707f, 0.291988283f},
-std::array<float,2>{0.0234578419f, 0.519011021f},
-std::array<float,2>{0.45808056f, 0.194440544f},
-std::array<float,2>{0.79103446f, 0.957496524f},
-std::array<float,2>{0.910060883f, 0.120143183f},
-std::array<float,2>{0.290675163f, 0.771628916f},
-std::array<float,2>{0.24720414f, 0.433279634f},
-std::array<float,2>{0.669976056f, 0.678591132f},
-std::array<float,2>{0.987898946f, 0.332405061f},
-std::array<float,2>{0.320207477f, 0.619384289f},
-std::array<float,2>{0.184596181f, 0.176727012f},
-std::array<float,2>{0.717745185f, 0.88880533f},
-std::array<float,2>{0.622390091f, 0.0282438062f},
-std::array<float,2>{0.090204671f, 0.832587481f},
-std::array<float,2>{0.41785115f, 0.477153987f},
-std::array<float,2>{0.834627748f, 0.71402663f},
-std::array<float,2>{0.646834671f, 0.392224044f},
-std::array<float,2>{0.203891605f, 0.644456983f},
-std::array<float,2>{0.263118863f, 0.0893034041f},
-std::array<float,2>{0.887540281f, 0.808987916f},
-std::array<float,2>{0.757954061f, 0.221363291f},
-std::array<float,2>{0.4695566f, 0.973419607f},
-std::array<float,2>{0.0434999093f, 0.272023529f},
-std::array<float,2>{0.510936558f, 0.537052691f},
-std::array<float,2>{0.899264634f, 0.41415447f},
-std::array<float,2>{0.273348004f, 0.669442058f},
-std::array<float,2>{0.202767596f, 0.099551931f},
-std::array<float,2>{0.634045303f, 0.754691958f},
-std::array<float,2>{0.518216968f, 0.21848011f},
-std::array<float,2>{0.047895018f, 0.943914711f},
-std::array<float,2>{0.498043627f, 0.304006219f},
-std::array<float,2>{0.770839453f, 0.50594759f},
-std::array<float,2>{0.695165336f, 0.365382344f},
-std::array<float,2>{0.165572196f, 0.585799158f},
-std::array<float,2>{0.340034395f, 0.154973909f},
-std::array<float,2>{0.982920468f, 0.923949122f},
-std::array<float,2>{0.825541377f, 0.0453527644f},
-std::array<float,2>{0.423548341f, 0.873017371f},
-std::array<float,2>{0.0778096244f, 0.465626776f},
-std::array<float,2>{0.602503359f, 0.729702175f},
-std::array<float,2>{0.798938334f, 0.252069414f},
-std::array<float,2>{0.44401294f, 0.558175445f},
-std::array<float,2>{0.0116852885f, 0.249492675f},
-std::array<float,2>{0.548308313f, 0.984850883f},
-std::array<float,2>{0.684761226f, 0.0695673525f},
-std::array<float,2>{0.225752711f, 0.785097837f},
-std::array<float,2>{0.298348904f, 0.379712075f},
-std::array<float,2>{0.932351291f, 0.631643295f},
-std::array<float,2>{0.562500477f, 0.489020735f},
-std::array<float,2>{0.107334591f, 0.698856294f},
-std::array<float,2>{0.377534866f, 0.0108334143f},
-std::array<float,2>{0.860020876f, 0.821054339f},
-std::array<float,2>{0.959506929f, 0.16218029f},
-std::array<float,2>{0.364121467f, 0.899671316f},
-std::array<float,2>{0.136260167f, 0.322069675f},
-std::array<float,2>{0.729485333f, 0.603224933f},
-std::array<float,2>{0.773450732f, 0.387441844f},
-std::array<float,2>{0.488722354f, 0.636893094f},
-std::array<float,2>{0.0590334944f, 0.0747013688f},
-std::array<float,2>{0.530428529f, 0.796869755f},
-std::array<float,2>{0.631041646f, 0.237694204f},
-std::array<float,2>{0.191287547f, 0.996172845f},
-std::array<float,2>{0.2778669f, 0.259137064f},
-std::array<float,2>{0.890775323f, 0.554578006f},
-std::array<float,2>{0.593899846f, 0.319803149f},
-std::array<float,2>{0.0661352947f, 0.59656918f},
-std::array<float,2>{0.434192449f, 0.171404347f},
-std::array<float,2>{0.814196646f, 0.895526171f},
-std::array<float,2>{0.969810367f, 0.00535292877f},
-std::array<float,2>{0.334941745f, 0.817753494f},
-std::array<float,2>{0.160764828f, 0.499565184f},
-std::array<float,2>{0.701323152f, 0.69448489f},
-std::array<float,2>{0.927013993f, 0.310115725f},
-std::array<float,2>{0.309169531f, 0.511356115f},
-std::array<float,2>{0.22757189f, 0.203550816f},
-std::array<float,2>{0.679081738f, 0.949458718f},
-std::array<float,2>{0.559250832f, 0.106340922f},
-std::array<float,2>{0.00474607386f, 0.758460045f},
-std::array<float,2>{0.450406671f, 0.41169852f},
-std::array<float,2>{0.805521429f, 0.660387337f},
-std::array<float,2>{0.722801387f, 0.45858252f},
-std::array<float,2>{0.130345523f, 0.723316789f},
-std::array<float,2>{0.369022936f, 0.034293361f},
-std::array<float,2>{0.962309957f, 0.866979122f},
-std::array<float,2>{0.869123042f, 0.144379988f},
-std::array<float,2>{0.388264924f, 0.930752695f},
-std::array<float,2>{0.0997467861f, 0.368061602f},
-std::array<float,2>{0.571735799f, 0.5888955f},
-std::array<float,2>{0.950031519f, 0.470624655f},
-std::array<float,2>{0.354667187f, 0.709958851f},
-std::array<float,2>{0.154235378f, 0.0193419438f},
-std::array<float,2>{0.736049891f, 0.836016059f},
-std::array<float,2>{0.590217233f, 0.18351768f},
-std::array<float,2>{0.110413097f, 0.882684112f},
-std::array<float,2>{0.404149622f, 0.338184297f},
-std::array<float,2>{0.855969906f, 0.614768863f},
-std::array<float,2>{0.661428571f, 0.276776403f},
-std::array<float,2>{0.236293018f, 0.543480158f},
-std::array<float,2>{0.284390002f, 0.232709318f},
-std::array<float,2>{0.917498827f, 0.978100181f},
-std::array<float,2>{0.788615108f, 0.0797696486f},
-std::array<float,2>{0.463047028f, 0.801571608f},
-std::array<float,2>{0.019829182f, 0.405702561f},
-std::array<float,2>{0.542400539f, 0.649375796f},
-std::array<float,2>{0.836729407f, 0.354502052f},
-std::array<float,2>{0.412242711f, 0.572214365f},
-std::array<float,2>{0.0845370814f, 0.137115106f},
-std::array<float,2>{0.615911067f, 0.91606462f},
-std::array<float,2>{0.704699695f, 0.0512741543f},
-std::array<float,2>{0.177256197f, 0.847889245f},
-std::array<float,2>{0.323432475f, 0.439829081f},
-std::array<float,2>{0.994329154f, 0.746661246f},
-std::array<float,2>{0.501912177f, 0.429384589f},
-std::array<float,2>{0.0319966301f, 0.680166423f},
-std::array<float,2>{0.483909577f, 0.111618236f},
-std::array<float,2>{0.755117178f, 0.778191507f},
-std::array<float,2>{0.876968443f, 0.200537294f},
-std::array<float,2>{0.253965616f, 0.965596259f},
-std::array<float,2>{0.213636652f, 0.284698218f},
-std::array<float,2>{0.653023124f, 0.527878582f},
-std::array<float,2>{0.817724288f, 0.434054434f},
-std::array<float,2>{0.433271974f, 0.675455332f},
-std::array<float,2>{0.0700899437f, 0.122224517f},
-std::array<float,2>{0.60089916f, 0.767642975f},
-std::array<float,2>{0.697386563f, 0.190155238f},
-std::array<float,2>{0.157133579f, 0.953347504f},
-std::array<float,2>{0.329631329f, 0.2931059f},
-std::array<float,2>{0.975890279f, 0.522424877f},
-std::array<float,2>{0.524430752f, 0.345109701f},
-std::array<float,2>{0.0565847568f, 0.562818766f},
-std::array<float,2>{0.487023115f, 0.126423255f},
-std::array<float,2>{0.778664052f, 0.912560582f},
-std::array<float,2>{0.897301197f, 0.0562136807f},
-std::array<float,2>{0.273930281f, 0.857994616f},
-std::array<float,2>{0.192967981f, 0.452086836f},
-std::array<float,2>{0.625452638f, 0.738601446f},
-std::array<float,2>{0.968291938f, 0.269235134f},
-std::array<float,2>{0.371459484f, 0.532866597f},
-std::array<float,2>{0.127670497f, 0.223713711f},
-std::array<float,2>{0.720361352f, 0.972151577f},
-std::array<float,2>{0.57781285f, 0.0917566866f},
-std::array<float,2>{0.0968179181f, 0.807778358f},
-std::array<float,2>{0.385195166f, 0.396321595f},
-std::array<float,2>{0.871835113f, 0.647051871f},
-std::array<float,2>{0.672778904f, 0.482593f},
-std::array<float,2>{0.232695177f, 0.718250334f},
-std::array<float,2>{0.307812035f, 0.026297275f},
-std::array<float,2>{0.922062278f, 0.831972241f},
-std::array<float,2>{0.812424302f, 0.174956515f},
-std::array<float,2>{0.446664631f, 0.88590616f},
-std::array<float,2>{0.00287180487f, 0.330428034f},
-std::array<float,2>{0.558184803f, 0.622717798f},
-std::array<float,2>{0.919302344f, 0.464530736f},
-std::array<float,2>{0.285840899f, 0.732647836f},
-std::array<float,2>{0.240332708f, 0.042934075f},
-std::array<float,2>{0.658252895f, 0.868369043f},
-std::array<float,2>{0.544071376f, 0.151724726f},
-std::array<float,2>{0.0185364541f, 0.926000416f},
-std::array<float,2>{0.466156483f, 0.36121279f},
-std::array<float,2>{0.783394217f, 0.580442727f},
-std::array<float,2>{0.740497291f, 0.300116509f},
-std::array<float,2>{0.151462421f, 0.501156151f},
-std::array<float,2>{0.358450234f, 0.21353291f},
-std::array<float,2>{0.945590317f, 0.941361129f},
-std::array<float,2>{0.851989865f, 0.0950557813f},
-std::array<float,2>{0.398585945f, 0.753661335f},
-std::array<float,2>{0.115700759f, 0.41857627f},
-std::array<float,2>{0.588898242f, 0.666265428f},
-std::array<float,2>{0.752509058f, 0.324927181f},
-std::array<float,2>{0.479679614f, 0.608288109f},
-std::array<float,2>{0.0356513076f, 0.157533497f},
-std::array<float,2>{0.50567174f, 0.904227436f},
-std::array<float,2>{0.649513721f, 0.0130686536f},
-std::array<float,2>{0.217913285f, 0.825591385f},
-std::array<float,2>{0.252887458f, 0.486166f},
-std::array<float,2>{0.882638812f, 0.70259732f},
-std::array<float,2>{0.611361563f, 0.376396894f},
-std::array<float,2>{0.0816219673f, 0.625911772f},
-std::array<float,2>{0.406687647f, 0.0637368932f},
-std::array<float,2>{0.841454148f, 0.788206875f},
-std::array<float,2>{0.998703361f, 0.243783697f},
-std::array<float,2>{0.326495469f, 0.988743126f},
-std::array<float,2>{0.173344001f, 0.254396737f},
-std::array<float,2>{0.710409105f, 0.55880034f},
-std::array<float,2>{0.796574354f, 0.494525492f},
-std::array<float,2>{0.454805344f, 0.689900577f},
-std::array<float,2>{0.0307291374f, 0.00343652838f},
-std::array<float,2>{0.531560898f, 0.81546104f},
-std::array<float,2>{0.666311085f, 0.166817635f},
-std::array<float,2>{0.245971307f, 0.891331792f},
-std::array<float,2>{0.295225561f, 0.313450098f},
-std::array<float,2>{0.911833525f, 0.600905478f},
-std::array<float,2>{0.585444331f, 0.264207095f},
-std::array<float,2>{0.117981106f, 0.550430954f},
-std::array<float,2>{0.39145568f, 0.24106054f},
-std::array<float,2>{0.849080086f, 0.993970215f},
-std::array<float,2>{0.944694757f, 0.0722960234f},
-std::array<float,2>{0.347545087f, 0.790958464f},
-std::array<float,2>{0.144040942f, 0.384271026f},
-std::array<float,2>{0.749506533f, 0.636709929f},
-std::array<float,2>{0.884674788f, 0.37141943f},
-std::array<float,2>{0.258339614f, 0.592058837f},
-std::array<float,2>{0.208127618f, 0.146140158f},
-std::array<float,2>{0.642524183f, 0.937191248f},
-std::array<float,2>{0.513191462f, 0.0370429307f},
-std::array<float,2>{0.0422283523f, 0.86036557f},
-std::array<float,2>{0.476465404f, 0.454589456f},
-std::array<float,2>{0.761827171f, 0.720292866f},
-std::array<float,2>{0.711033046f, 0.407157898f},
-std::array<float,2>{0.18242909f, 0.658405721f},
-std::array<float,2>{0.314973235f, 0.103654668f},
-std::array<float,2>{0.989709258f, 0.764253974f},
-std::array<float,2>{0.830421746f, 0.210211068f},
-std::array<float,2>{0.421668828f, 0.946734607f},
-std::array<float,2>{0.0889753103f, 0.306307435f},
-std::array<float,2>{0.619210839f, 0.515203536f},
-std::array<float,2>{0.978778481f, 0.400272161f},
-std::array<float,2>{0.339843214f, 0.654937387f},
-std::array<float,2>{0.170758307f, 0.0826313123f},
-std::array<float,2>{0.688423753f, 0.799871087f},
-std::array<float,2>{0.605828404f, 0.230188206f},
-std::array<float,2>{0.0741254464f, 0.98418653f},
-std::array<float,2>{0.426100791f, 0.278525472f},
-std::array<float,2>{0.823710382f, 0.540421724f},
-std::array<float,2>{0.63876003f, 0.340430677f},
-std::array<float,2>{0.198080555f, 0.610240638f},
-std::array<float,2>{0.266759157f, 0.186658874f},
-std::array<float,2>{0.903606474f, 0.878074706f},
-std::array<float,2>{0.767450631f, 0.0213853903f},
-std::array<float,2>{0.4953565f, 0.842685938f},
-std::array<float,2>{0.0534605086f, 0.475383848f},
-std::array<float,2>{0.520366311f, 0.705346406f},
-std::array<float,2>{0.866399825f, 0.285654783f},
-std::array<float,2>{0.381705761f, 0.523625255f},
-std::array<float,2>{0.104352765f, 0.198799878f},
-std::array<float,2>{0.566464126f, 0.964379191f},
-std::array<float,2>{0.732407629f, 0.11463581f},
-std::array<float,2>{0.139405176f, 0.773510575f},
-std::array<float,2>{0.362303972f, 0.423887223f},
-std::array<float,2>{0.956077635f, 0.68395859f},
-std::array<float,2>{0.553110421f, 0.441413105f},
-std::array<float,2>{0.0139869582f, 0.743904352f},
-std::array<float,2>{0.438499242f, 0.0490098186f},
-std::array<float,2>{0.801740885f, 0.844273508f},
-std::array<float,2>{0.936762333f, 0.133318245f},
-std::array<float,2>{0.303041101f, 0.920939028f},
-std::array<float,2>{0.221397474f, 0.355655581f},
-std::array<float,2>{0.68283397f, 0.574311316f},
-std::array<float,2>{0.860924542f, 0.491488814f},
-std::array<float,2>{0.378409594f, 0.695715189f},
-std::array<float,2>{0.106072709f, 0.00784763787f},
-std::array<float,2>{0.563944459f, 0.823787689f},
-std::array<float,2>{0.729862452f, 0.160400346f},
-std::array<float,2>{0.135664269f, 0.901647091f},
-std::array<float,2>{0.364943832f, 0.32322216f},
-std::array<float,2>{0.960868955f, 0.603747666f},
-std::array<float,2>{0.547547638f, 0.251193017f},
-std::array<float,2>{0.0104478318f, 0.555149972f},
-std::array<float,2>{0.444673508f, 0.247752145f},
-std::array<float,2>{0.800430238f, 0.988136768f},
-std::array<float,2>{0.932777047f, 0.0681905076f},
-std::array<float,2>{0.297162563f, 0.782269239f},
-std::array<float,2>{0.225496009f, 0.38230902f},
-std::array<float,2>{0.684175313f, 0.630069792f},
-std::array<float,2>{0.983993053f, 0.365221262f},
-std::array<float,2>{0.341579199f, 0.582289159f},
-std::array<float,2>{0.16462411f, 0.154277831f},
-std::array<float,2>{0.693481147f, 0.923462093f},
-std::array<float,2>{0.603298843f, 0.0432293713f},
-std::array<float,2>{0.0768752694f, 0.873853743f},
-std::array<float,2>{0.422671676f, 0.467990845f},
-std::array<float,2>{0.82422179f, 0.72734803f},
-std::array<float,2>{0.633011103f, 0.417025536f},
-std::array<float,2>{0.201832578f, 0.67074132f},
-std::array<float,2>{0.27166f, 0.100909531f},
-std::array<float,2>{0.899477839f, 0.75765568f},
-std::array<float,2>{0.770367801f, 0.216557696f},
-std::array<float,2>{0.496608943f, 0.941442788f},
-std::array<float,2>{0.0474628247f, 0.300954551f},
-std::array<float,2>{0.518958569f, 0.504544079f},
-std::array<float,2>{0.888322651f, 0.393848687f},
-std::array<float,2>{0.261810184f, 0.641767979f},
-std::array<float,2>{0.20445089f, 0.0866627321f},
-std::array<float,2>{0.648181617f, 0.812252879f},
-std::array<float,2>{0.509794533f, 0.219607517f},
-std::array<float,2>{0.0444688834f, 0.976212621f},
-std::array<float,2>{0.470030963f, 0.270205915f},
-std::array<float,2>{0.7591784f, 0.538372755f},
-std::array<float,2>{0.718074262f, 0.334435672f},
-std::array<float,2>{0.184311271f, 0.617812634f},
-std::array<float,2>{0.318984598f, 0.179483786f},
-std::array<float,2>{0.987223923f, 0.887638509f},
-std::array<float,2>{0.835165322f, 0.0293789394f},
-std::array<float,2>{0.416513622f, 0.83593297f},
-std::array<float,2>{0.0916393623f, 0.480377853f},
-std::array<float,2>{0.62194258f, 0.712751985f},
-std::array<float,2>{0.792309642f, 0.290886492f},
-std::array<float,2>{0.457298845f, 0.51698637f},
-std::array<float,2>{0.0245423019f, 0.19207269f},
-std::array<float,2>{0.538451195f, 0.960877061f},
-std::array<float,2>{0.671241045f, 0.117339022f},
-std::array<float,2>{0.246692181f, 0.77023375f},
-std::array<float,2>{0.289282739f, 0.431045175f},
-std::array<float,2>{0.908991933f, 0.67669028f},
-std::array<float,2>{0.579934835f, 0.447346747f},
-std::array<float,2>{0.122965269f, 0.737655163f},
-std::array<float,2>{0.397617251f, 0.0590507537f},
-std::array<float,2>{0.845306814f, 0.855228722f},
-std::array<float,2>{0.94031179f, 0.132393524f},
-std::array<float,2>{0.348217249f, 0.908982038f},
-std::array<float,2>{0.146624371f, 0.350525945f},
-std::array<float,2>{0.742963791f, 0.566542387f},
-std::array<float,2>{0.754378021f, 0.426662296f},
-std::array<float,2>{0.482857138f, 0.682742476f},
-std::array<float,2>{0.0329103433f, 0.109910704f},
-std::array<float,2>{0.500323594f, 0.780543923f},
-std::array<float,2>{0.653946817f, 0.20238401f},
-std::array<float,2>{0.214584142f, 0.967498481f},
-std::array<float,2>{0.255630046f, 0.283145487f},
-std::array<float,2>{0.878469586f, 0.530787945f},
-std::array<float,2>{0.616756797f, 0.351774037f},
-std::array<float,2>{0.0852514282f, 0.573874176f},
-std::array<float,2>{0.413445413f, 0.139533222f},
-std::array<float,2>{0.837627828f, 0.915157914f},
-std::array<float,2>{0.99589026f, 0.0545264967f},
-std::array<float,2>{0.323115855f, 0.850974917f},
-std::array<float,2>{0.176127478f, 0.439084589f},
-std::array<float,2>{0.703667045f, 0.749833822f},
-std::array<float,2>{0.916604161f, 0.275183618f},
-std::array<float,2>{0.283493608f, 0.545268357f},
-std::array<float,2>{0.234779626f, 0.230694979f},
-std::array<float,2>{0.660923958f, 0.978994071f},
-std::array<float,2>{0.541198313f, 0.080610469f},
-std::array<float,2>{0.0207132734f, 0.80297327f},
-std::array<float,2>{0.464791507f, 0.404107481f},
-std::array<float,2>{0.787396312f, 0.651252866f},
-std::array<float,2>{0.734745979f, 0.472513586f},
-std::array<float,2>{0.15234445f, 0.707620978f},
-std::array<float,2>{0.354321301f, 0.0161463674f},
-std::array<float,2>{0.950776398f, 0.839526057f},
-std::array<float,2>{0.857270896f, 0.180735007f},
-std::array<float,2>{0.403287172f, 0.879236162f},
-std::array<float,2>{0.109936699f, 0.336789042f},
-std::array<float,2>{0.591237366f, 0.616049826f},
-std::array<float,2>{0.961196423f, 0.460011721f},
-std::array<float,2>{0.367394179f, 0.72499162f},
-std::array<float,2>{0.129644111f, 0.0328093357f},
-std::array<float,2>{0.724526525f, 0.863964438f},
-std::array<float,2>{0.570608735f, 0.140656173f},
-std::array<float,2>{0.100925691f, 0.931892753f},
-std::array<float,2>{0.387688905f, 0.369348437f},
-std::array<float,2>{0.867483497f, 0.587759376f},
-std::array<float,2>{0.678554535f, 0.312449485f},
-std::array<float,2>{0.226727098f, 0.50910604f},
-std::array<float,2>{0.310011625f, 0.205507055f},
-std::array<float,2>{0.926513076f, 0.952263594f},
-std::array<float,2>{0.805952847f, 0.108153701f},
-std::array<float,2>{0.449557483f, 0.760643959f},
-std::array<float,2>{0.00498278392f, 0.412157655f},
-std::array<float,2>{0.560331762f, 0.663651228f},
-std::array<float,2>{0.812809289f, 0.317822814f},
-std::array<float,2>{0.435292333f, 0.59384346f},
-std::array<float,2>{0.0646069199f, 0.169217736f},
-std::array<float,2>{0.595170915f, 0.897050321f},
-std::array<float,2>{0.702425659f, 0.00588831725f},
-std::array<float,2>{0.16182673f, 0.819158018f},
-std::array<float,2>{0.335356861f, 0.497984767f},
-std::array<float,2>{0.969632566f, 0.691469431f},
-std::array<float,2>{0.530157983f, 0.388960302f},
-std::array<float,2>{0.0601222552f, 0.640045226f},
-std::array<float,2>{0.489948004f, 0.0763078704f},
-std::array<float,2>{0.774528086f, 0.793774903f},
-std::array<float,2>{0.891957998f, 0.234446242f},
-std::array<float,2>{0.279248387f, 0.998446465f},
-std::array<float,2>{0.189962059f, 0.260091573f},
-std::array<float,2>{0.632312596f, 0.552032292f},
-std::array<float,2>{0.839881063f, 0.378172755f},
-std::array<float,2>{0.407860339f, 0.628437996f},
-std::array<float,2>{0.080280453f, 0.0661995411f},
-std::array<float,2>{0.612742722f, 0.786897123f},
-std::array<float,2>{0.709283233f, 0.245459452f},
-std::array<float,2>{0.172232047f, 0.990794897f},
-std::array<float,2>{0.327969015f, 0.25586623f},
-std::array<float,2>{0.999438226f, 0.562336802f},
-std::array<float,2>{0.504574478f, 0.326976895f},
-std::array<float,2>{0.036879465f, 0.606563985f},
-std::array<float,2>{0.479131758f, 0.158508465f},
-std::array<float,2>{0.753718793f, 0.904808223f},
-std::array<float,2>{0.88141185f, 0.0141018303f},
-std::array<float,2>{0.253209651f, 0.828086793f},
-std::array<float,2>{0.216997832f, 0.487369984f},
-std::array<float,2>{0.648561299f, 0.699630022f},
-std::array<float,2>{0.946593761f, 0.298282892f},
-std::array<float,2>{0.358211488f, 0.503354669f},
-std::array<float,2>{0.150403947f, 0.211739987f},
-std::array<float,2>{0.741722882f, 0.938113332f},
-std::array<float,2>{0.588808179f, 0.0974486172f},
-std::array<float,2>{0.116950266f, 0.750929475f},
-std::array<float,2>{0.399417847f, 0.421345532f},
-std::array<float,2>{0.853382885f, 0.665229321f},
-std::array<float,2>{0.660005033f, 0.461009473f},
-std::array<float,2>{0.242177084f, 0.731449127f},
-std::array<float,2>{0.286537647f, 0.0391297825f},
-std::array<float,2>{0.91869998f, 0.869387686f},
-std::array<float,2>{0.784552157f, 0.148800999f},
-std::array<float,2>{0.464867562f, 0.929037333f},
-std::array<float,2>{0.0193597395f, 0.363115788f},
-std::array<float,2>{0.543679357f, 0.57927978f},
-std::array<float,2>{0.922945023f, 0.481632143f},
-std::array<float,2>{0.306881726f, 0.716543972f},
-std::array<float,2>{0.233607396f, 0.0245450791f},
-std::array<float,2>{0.673664987f, 0.828595817f},
-std::array<float,2>{0.55664742f, 0.1721479f},
-std::array<float,2>{0.00308404141f, 0.883927643f},
-std::array<float,2>{0.445313543f, 0.328894556f},
-std::array<float,2>{0.810798943f, 0.623071134f},
-std::array<float,2>{0.719203949f, 0.266652852f},
-std::array<float,2>{0.12830326f, 0.533981979f},
-std::array<float,2>{0.372590065f, 0.224619329f},
-std::array<float,2>{0.96726656f, 0.9690153f},
-std::array<float,2>{0.872751057f, 0.0918922871f},
-std::array<float,2>{0.38599658f, 0.805813968f},
-std::array<float,2>{0.0961667895f, 0.397721797f},
-std::array<float,2>{0.576572537f, 0.645286381f},
-std::array<float,2>{0.777854085f, 0.347093403f},
-std::array<float,2>{0.487569928f, 0.565404117f},
-std::array<float,2>{0.0553238168f, 0.127654091f},
-std::array<float,2>{0.524145186f, 0.912077725f},
-std::array<float,2>{0.626945138f, 0.0569372177f},
-std::array<float,2>{0.192306072f, 0.855576277f},
-std::array<float,2>{0.274607629f, 0.45096913f},
-std::array<float,2>{0.898077726f, 0.741498232f},
-std::array<float,2>{0.600395501f, 0.437399179f},
-std::array<float,2>{0.0692319497f, 0.672651529f},
-std::array<float,2>{0.432379007f, 0.123458214f},
-std::array<float,2>{0.817047536f, 0.766505241f},
-std::array<float,2>{0.97469455f, 0.187854379f},
-std::array<float,2>{0.32866165f, 0.956188023f},
-std::array<float,2>{0.158010259f, 0.296237051f},
-std::array<float,2>{0.698427081f, 0.520704031f},
-std::array<float,2>{0.801990986f, 0.443472892f},
-std::array<float,2>{0.43827045f, 0.744567692f},
-std::array<float,2>{0.0148497541f, 0.0470978767f},
-std::array<float,2>{0.554239452f, 0.846877515f},
-std::array<float,2>{0.682334483f, 0.136014089f},
-std::array<float,2>{0.22265406f, 0.919904649f},
-std::array<float,2>{0.303741574f, 0.357742488f},
-std::array<float,2>{0.935811281f, 0.576828182f},
-std::array<float,2>{0.567890108f, 0.287449867f},
-std::array<float,2>{0.104827046f, 0.525471509f},
-std::array<float,2>{0.381988019f, 0.196679488f},
-std::array<float,2>{0.865850806f, 0.961451054f},
-std::array<float,2>{0.955720246f, 0.116622627f},
-std::array<float,2>{0.363168716f, 0.776568592f},
-std::array<float,2>{0.140099943f, 0.423187107f},
-std::array<float,2>{0.73117429f, 0.685636759f},
-std::array<float,2>{0.903095484f, 0.342610985f},
-std::array<float,2>{0.265798271f, 0.611534595f},
-std::array<float,2>{0.198402375f, 0.184741408f},
-std::array<float,2>{0.640446365f, 0.875757635f},
-std::array<float,2>{0.521358252f, 0.0232518166f},
-std::array<float,2>{0.0540949553f, 0.840672493f},
-std::array<float,2>{0.494772136f, 0.473796874f},
-std::array<float,2>{0.766035259f, 0.703825295f},
-std::array<float,2>{0.688567698f, 0.401227653f},
-std::array<float,2>{0.171837822f, 0.652988672f},
-std::array<float,2>{0.338397384f, 0.0850382149f},
-std::array<float,2>{0.980150759f, 0.797575355f},
-std::array<float,2>{0.823007822f, 0.226679444f},
-std::array<float,2>{0.426795214f, 0.981171012f},
-std::array<float,2>{0.0725633502f, 0.279583067f},
-std::array<float,2>{0.606666446f, 0.541359484f},
-std::array<float,2>{0.989056885f, 0.409926564f},
-std::array<float,2>{0.315988868f, 0.657891273f},
-std::array<float,2>{0.183088139f, 0.10216371f},
-std::array<float,2>{0.711917043f, 0.761910439f},
-std::array<float,2>{0.620808959f, 0.208135188f},
-std::array<float,2>{0.0884248391f, 0.948846221f},
-std::array<float,2>{0.42021054f, 0.308163762f},
-std::array<float,2>{0.83172518f, 0.512037277f},
-std::array<float,2>{0.641239643f, 0.374123871f},
-std::array<float,2>{0.207434475f, 0.591426432f},
-std::array<float,2>{0.259513408f, 0.14772293f},
-std::array<float,2>{0.883297682f, 0.934392214f},
-std::array<float,2>{0.76279825f, 0.0379578322f},
-std::array<float,2>{0.475521773f, 0.861745775f},
-std::array<float,2>{0.0411022604f, 0.455470502f},
-std::array<float,2>{0.512345612f, 0.720707536f},
-std::array<float,2>{0.848511517f, 0.263370275f},
-std::array<float,2>{0.391749382f, 0.548732162f},
-std::array<float,2>{0.118617862f, 0.24002111f},
-std::array<float,2>{0.584952533f, 0.994243324f},
-std::array<float,2>{0.748406827f, 0.070766598f},
-std::array<float,2>{0.143078759f, 0.791847706f},
-std::array<float,2>{0.346442878f, 0.386300296f},
-std::array<float,2>{0.944317162f, 0.634039819f},
-std::array<float,2>{0.53303498f, 0.493503094f},
-std::array<float,2>{0.02997135f, 0.689256549f},
-std::array<float,2>{0.454006135f, 0.00152015814f},
-std::array<float,2>{0.79527694f, 0.812727451f},
-std::array<float,2>{0.910398781f, 0.165985882f},
-std::array<float,2>{0.296306401f, 0.894266784f},
-std::array<float,2>{0.24469842f, 0.315613627f},
-std::array<float,2>{0.667338431f, 0.599509597f},
-std::array<float,2>{0.827565312f, 0.466173887f},
-std::array<float,2>{0.425773889f, 0.729447067f},
-std::array<float,2>{0.0745297149f, 0.0461871438f},
-std::array<float,2>{0.604262829f, 0.871336579f},
-std::array<float,2>{0.691576183f, 0.15572235f},
-std::array<float,2>{0.167907774f, 0.925232708f},
-std::array<float,2>{0.343146265f, 0.36666593f},
-std::array<float,2>{0.981740713f, 0.584711909f},
-std::array<float,2>{0.516666889f, 0.303215683f},
-std::array<float,2>{0.0495644696f, 0.50721097f},
-std::array<float,2>{0.498179346f, 0.21771352f},
-std::array<float,2>{0.772861183f, 0.945290744f},
-std::array<float,2>{0.901387155f, 0.0981391147f},
-std::array<float,2>{0.269704133f, 0.755043387f},
-std::array<float,2>{0.199959829f, 0.415358514f},
-std::array<float,2>{0.636628568f, 0.668759584f},
-std::array<float,2>{0.957190335f, 0.321257025f},
-std::array<float,2>{0.36614126f, 0.602472425f},
-std::array<float,2>{0.133081332f, 0.163712278f},
-std::array<float,2>{0.726707935f, 0.899012327f},
-std::array<float,2>{0.565463006f, 0.0102643324f},
-std::array<float,2>{0.109011583f, 0.821413636f},
-std::array<float,2>{0.376616389f, 0.490196615f},
-std::array<float,2>{0.863232374f, 0.698055983f},
-std::array<float,2>{0.687364876f, 0.380047232f},
-std::array<float,2>{0.22382386f, 0.632063091f},
-std::array<float,2>{0.30069676f, 0.0691842064f},
-std::array<float,2>{0.931555152f, 0.783602595f},
-std::array<float,2>{0.798307419f, 0.248644233f},
-std::array<float,2>{0.442771763f, 0.986045897f},
-std::array<float,2>{0.00812583696f, 0.25332582f},
-std::array<float,2>{0.549099863f, 0.557483375f},
-std::array<float,2>{0.906880081f, 0.432377726f},
-std::array<float,2>{0.291657269f, 0.679262221f},
-std::array<float,2>{0.248374581f, 0.119847097f},
-std::array<float,2>{0.668399274f, 0.773226142f},
-std::array<float,2>{0.537030578f, 0.193962157f},
-std::array<float,2>{0.0265039299f, 0.958245277f},
-std::array<float,2>{0.45990783f, 0.292327523f},
-std::array<float,2>{0.790252566f, 0.51792109f},
-std::array<float,2>{0.745669663f, 0.348525435f},
-std::array<float,2>{0.146074906f, 0.568789303f},
-std::array<float,2>{0.351098776f, 0.130670086f},
-std::array<float,2>{0.939207554f, 0.907080114f},
-std::array<float,2>{0.84656018f, 0.0608664155f},
-std::array<float,2>{0.395330578f, 0.852474809f},
-std::array<float,2>{0.123092473f, 0.447188646f},
-std::array<float,2>{0.581129313f, 0.734752297f},
-std::array<float,2>{0.760021567f, 0.273056448f},
-std::array<float,2>{0.472063333f, 0.535287857f},
-std::array<float,2>{0.0465020165f, 0.221780211f},
-std::array<float,2>{0.507994652f, 0.974262118f},
-std::array<float,2>{0.645527661f, 0.0881030113f},
-std::array<float,2>{0.206208199f, 0.810208619f},
-std::array<float,2>{0.264595568f, 0.391155899f},
-std::array<float,2>{0.890061677f, 0.642882288f},
-std::array<float,2>{0.624333858f, 0.477645606f},
-std::array<float,2>{0.0937084556f, 0.713426113f},
-std::array<float,2>{0.415549397f, 0.0290465895f},
-std::array<float,2>{0.833633661f, 0.833651602f},
-std::array<float,2>{0.986013055f, 0.177379519f},
-std::array<float,2>{0.31676811f, 0.89053911f},
-std::array<float,2>{0.186210185f, 0.333024383f},
-std::array<float,2>{0.716641486f, 0.620323837f},
-std::array<float,2>{0.786657631f, 0.405189127f},
-std::array<float,2>{0.461938053f, 0.649831057f},
-std::array<float,2>{0.0222277436f, 0.0787181035f},
-std::array<float,2>{0.540746927f, 0.802568972f},
-std::array<float,2>{0.663511455f, 0.233751893f},
-std::array<float,2>{0.236366138f, 0.977252662f},
-std::array<float,2>{0.282479286f, 0.275848836f},
-std::array<float,2>{0.914503217f, 0.544102371f},
-std::array<float,2>{0.59259963f, 0.339367747f},
-std::array<float,2>{0.111646175f, 0.613984406f},
-std::array<float,2>{0.404431969f, 0.182237342f},
-std::array<float,2>{0.858704746f, 0.88094455f},
-std::array<float,2>{0.951402903f, 0.0180742647f},
-std::array<float,2>{0.352531612f, 0.837697208f},
-std::array<float,2>{0.155764669f, 0.469264567f},
-std::array<float,2>{0.737507224f, 0.71086061f},
-std::array<float,2>{0.876790166f, 0.283720136f},
-std::array<float,2>{0.257795244f, 0.528871238f},
-std::array<float,2>{0.212780893f, 0.199433342f},
-std::array<float,2>{0.655945599f, 0.966470361f},
-std::array<float,2>{0.502070665f, 0.112845801f},
-std::array<float,2>{0.033501111f, 0.778909683f},
-std::array<float,2>{0.481114149f, 0.428399622f},
-std::array<float,2>{0.75606811f, 0.681127131f},
-std::array<float,2>{0.706590533f, 0.441151917f},
-std::array<float,2>{0.179620698f, 0.747589707f},
-std::array<float,2>{0.322043478f, 0.0518377088f},
-std::array<float,2>{0.994013667f, 0.849575639f},
-std::array<float,2>{0.83829695f, 0.138566047f},
-std::array<float,2>{0.410630733f, 0.917068362f},
-std::array<float,2>{0.0834442899f, 0.35398525f},
-std::array<float,2>{0.614788234f, 0.570982218f},
-std::array<float,2>{0.972437143f, 0.499018252f},
-std::array<float,2>{0.333437145f, 0.693862498f},
-std::array<float,2>{0.163461179f, 0.00460590841f},
-std::array<float,2>{0.700207591f, 0.81720835f},
-std::array<float,2>{0.595835924f, 0.170572847f},
-std::array<float,2>{0.0630746186f, 0.894611299f},
-std::array<float,2>{0.436417073f, 0.319149315f},
-std::array<float,2>{0.814824522f, 0.597389758f},
-std::array<float,2>{0.629086852f, 0.25812453f},
-std::array<float,2>{0.188047007f, 0.553457618f},
-std::array<float,2>{0.280020028f, 0.236653507f},
-std::array<float,2>{0.893880904f, 0.997313499f},
-std::array<float,2>{0.777127445f, 0.0756646469f},
-std::array<float,2>{0.49092719f, 0.795309603f},
-std::array<float,2>{0.0620062426f, 0.388281405f},
-std::array<float,2>{0.529290318f, 0.637740731f},
-std::array<float,2>{0.871080995f, 0.36897704f},
-std::array<float,2>{0.390303493f, 0.588198483f},
-std::array<float,2>{0.0977013782f, 0.143550381f},
-std::array<float,2>{0.572744727f, 0.929897249f},
-std::array<float,2>{0.725640118f, 0.033858642f},
-std::array<float,2>{0.131691247f, 0.865362585f},
-std::array<float,2>{0.369303972f, 0.457045078f},
-std::array<float,2>{0.964429259f, 0.724593461f},
-std::array<float,2>{0.561515212f, 0.410795301f},
-std::array<float,2>{0.00685814768f, 0.661787689f},
-std::array<float,2>{0.452568948f, 0.10665451f},
-std::array<float,2>{0.807914734f, 0.759662211f},
-std::array<float,2>{0.928919494f, 0.204376057f},
-std::array<float,2>{0.31117326f, 0.950709879f},
-std::array<float,2>{0.230071798f, 0.309277922f},
-std::array<float,2>{0.677271426f, 0.51070416f},
-std::array<float,2>{0.854036808f, 0.419254243f},
-std::array<float,2>{0.401249886f, 0.667109609f},
-std::array<float,2>{0.115038022f, 0.0944687724f},
-std::array<float,2>{0.586896896f, 0.752049804f},
-std::array<float,2>{0.739658117f, 0.213909805f},
-std::array<float,2>{0.148519382f, 0.939804435f},
-std::array<float,2>{0.356455594f, 0.299714148f},
-std::array<float,2>{0.947817028f, 0.500339806f},
-std::array<float,2>{0.546438396f, 0.359479129f},
-std::array<float,2>{0.0159694348f, 0.581765115f},
-std::array<float,2>{0.467389703f, 0.151014239f},
-std::array<float,2>{0.781635046f, 0.927028179f},
-std::array<float,2>{0.920852304f, 0.0411391221f},
-std::array<float,2>{0.288377285f, 0.867911577f},
-std::array<float,2>{0.239003286f, 0.463304132f},
-std::array<float,2>{0.657007575f, 0.733993053f},
-std::array<float,2>{0.996593595f, 0.255811721f},
-std::array<float,2>{0.325569093f, 0.560094774f},
-std::array<float,2>{0.175010964f, 0.242633417f},
-std::array<float,2>{0.707866013f, 0.989374757f},
-std::array<float,2>{0.609690845f, 0.0631460249f},
-std::array<float,2>{0.0796275437f, 0.787982583f},
-std::array<float,2>{0.408616126f, 0.375732452f},
-std::array<float,2>{0.843674302f, 0.626460254f},
-std::array<float,2>{0.65123111f, 0.485130757f},
-std::array<float,2>{0.216064602f, 0.7017079f},
-std::array<float,2>{0.251539707f, 0.0122101866f},
-std::array<float,2>{0.879877031f, 0.824266136f},
-std::array<float,2>{0.750832617f, 0.157108307f},
-std::array<float,2>{0.477157146f, 0.903205991f},
-std::array<float,2>{0.0387605987f, 0.325703561f},
-std::array<float,2>{0.506189585f, 0.609298527f},
-std::array<float,2>{0.896092594f, 0.452710271f},
-std::array<float,2>{0.277261347f, 0.74007529f},
-std::array<float,2>{0.194477066f, 0.0547876135f},
-std::array<float,2>{0.628283024f, 0.859138072f},
-std::array<float,2>{0.525558174f, 0.125693083f},
-std::array<float,2>{0.0574021898f, 0.913900375f},
-std::array<float,2>{0.48595196f, 0.343859434f},
-std::array<float,2>{0.780132949f, 0.563918054f},
-std::array<float,2>{0.695509195f, 0.294145375f},
-std::array<float,2>{0.158870623f, 0.523316085f},
-std::array<float,2>{0.331148863f, 0.1908779f},
-std::array<float,2>{0.973707378f, 0.954716742f},
-std::array<float,2>{0.820100248f, 0.121374667f},
-std::array<float,2>{0.430363774f, 0.76889503f},
-std::array<float,2>{0.0673990697f, 0.43477577f},
-std::array<float,2>{0.598233819f, 0.674595416f},
-std::array<float,2>{0.810427666f, 0.331522822f},
-std::array<float,2>{0.448987722f, 0.621385276f},
-std::array<float,2>{0.000171225271f, 0.174101457f},
-std::array<float,2>{0.556536913f, 0.885531962f},
-std::array<float,2>{0.674201548f, 0.0265686978f},
-std::array<float,2>{0.23124072f, 0.830682039f},
-std::array<float,2>{0.305367351f, 0.48361972f},
-std::array<float,2>{0.92573458f, 0.717684031f},
-std::array<float,2>{0.575392962f, 0.395162791f},
-std::array<float,2>{0.0949217081f, 0.648176312f},
-std::array<float,2>{0.383328199f, 0.0900875926f},
-std::array<float,2>{0.87478894f, 0.807229996f},
-std::array<float,2>{0.966392398f, 0.222713888f},
-std::array<float,2>{0.374690682f, 0.971410215f},
-std::array<float,2>{0.125329018f, 0.268134981f},
-std::array<float,2>{0.722507954f, 0.531484663f},
-std::array<float,2>{0.768651247f, 0.475689411f},
-std::array<float,2>{0.492777646f, 0.706475973f},
-std::array<float,2>{0.0509676076f, 0.0198713634f},
-std::array<float,2>{0.522660255f, 0.843695343f},
-std::array<float,2>{0.637288153f, 0.185784489f},
-std::array<float,2>{0.19703652f, 0.877146721f},
-std::array<float,2>{0.267739713f, 0.341565788f},
-std::array<float,2>{0.90544039f, 0.611133873f},
-std::array<float,2>{0.609046996f, 0.278023362f},
-std::array<float,2>{0.0704359561f, 0.539397955f},
-std::array<float,2>{0.427794904f, 0.229165822f},
-std::array<float,2>{0.821338594f, 0.983013451f},
-std::array<float,2>{0.978411376f, 0.0832739547f},
-std::array<float,2>{0.337046295f, 0.799104333f},
-std::array<float,2>{0.169191316f, 0.399148017f},
-std::array<float,2>{0.691271126f, 0.655555844f},
-std::array<float,2>{0.934119999f, 0.356752038f},
-std::array<float,2>{0.301466078f, 0.575405359f},
-std::array<float,2>{0.219040483f, 0.134422928f},
-std::array<float,2>{0.681510985f, 0.920385897f},
-std::array<float,2>{0.551653802f, 0.0498265103f},
-std::array<float,2>{0.0120203244f, 0.845523715f},
-std::array<float,2>{0.440207571f, 0.442810088f},
-std::array<float,2>{0.804521561f, 0.742316961f},
-std::array<float,2>{0.733351648f, 0.425699264f},
-std::array<float,2>{0.138594925f, 0.685437858f},
-std::array<float,2>{0.360615253f, 0.114059426f},
-std::array<float,2>{0.953196466f, 0.775165379f},
-std::array<float,2>{0.86366266f, 0.197634801f},
-std::array<float,2>{0.380509645f, 0.962963998f},
-std::array<float,2>{0.102664642f, 0.286553085f},
-std::array<float,2>{0.570169806f, 0.524988174f},
-std::array<float,2>{0.942166269f, 0.383623242f},
-std::array<float,2>{0.344106376f, 0.635014296f},
-std::array<float,2>{0.140867695f, 0.0738902539f},
-std::array<float,2>{0.747176528f, 0.789445519f},
-std::array<float,2>{0.582143247f, 0.242008924f},
-std::array<float,2>{0.11963363f, 0.9929111f},
-std::array<float,2>{0.39410162f, 0.265284836f},
-std::array<float,2>{0.850822091f, 0.548979282f},
-std::array<float,2>{0.664396346f, 0.313950598f},
-std::array<float,2>{0.243002608f, 0.599899471f},
-std::array<float,2>{0.293956012f, 0.167542234f},
-std::array<float,2>{0.913357556f, 0.892218232f},
-std::array<float,2>{0.79353863f, 0.00195631012f},
-std::array<float,2>{0.4563393f, 0.814507842f},
-std::array<float,2>{0.0288107451f, 0.495732635f},
-std::array<float,2>{0.53476125f, 0.691191256f},
-std::array<float,2>{0.829022169f, 0.304944992f},
-std::array<float,2>{0.418654293f, 0.514142156f},
-std::array<float,2>{0.0861832798f, 0.209947094f},
-std::array<float,2>{0.617891192f, 0.94557786f},
-std::array<float,2>{0.714208603f, 0.105226822f},
-std::array<float,2>{0.180647805f, 0.765406668f},
-std::array<float,2>{0.312642246f, 0.407579988f},
-std::array<float,2>{0.991475821f, 0.660059094f},
-std::array<float,2>{0.514269233f, 0.454020113f},
-std::array<float,2>{0.0395180695f, 0.719406605f},
-std::array<float,2>{0.474234015f, 0.035917528f},
-std::array<float,2>{0.764813662f, 0.860012114f},
-std::array<float,2>{0.885914385f, 0.144694015f},
-std::array<float,2>{0.26123479f, 0.936466098f},
-std::array<float,2>{0.209411159f, 0.3723903f},
-std::array<float,2>{0.64260447f, 0.593281627f},
-std::array<float,2>{0.81501025f, 0.497163445f},
-std::array<float,2>{0.435999751f, 0.691956222f},
-std::array<float,2>{0.0627301186f, 0.0066313874f},
-std::array<float,2>{0.596556604f, 0.818445683f},
-std::array<float,2>{0.700990796f, 0.169501588f},
-std::array<float,2>{0.164026111f, 0.896740794f},
-std::array<float,2>{0.333629876f, 0.318282992f},
-std::array<float,2>{0.971909761f, 0.594336033f},
-std::array<float,2>{0.528387845f, 0.260395199f},
-std::array<float,2>{0.0621189959f, 0.552584231f},
-std::array<float,2>{0.490516305f, 0.235079542f},
-std::array<float,2>{0.776850343f, 0.998561561f},
-std::array<float,2>{0.89418751f, 0.0771389678f},
-std::array<float,2>{0.279692709f, 0.793347776f},
-std::array<float,2>{0.187824324f, 0.389618933f},
-std::array<float,2>{0.629878938f, 0.640530288f},
-std::array<float,2>{0.96406436f, 0.370061219f},
-std::array<float,2>{0.370001823f, 0.587162435f},
-std::array<float,2>{0.130920947f, 0.141503334f},
-std::array<float,2>{0.726486742f, 0.93229872f},
-std::array<float,2>{0.573151052f, 0.0324414261f},
-std::array<float,2>{0.0984300375f, 0.863572776f},
-std::array<float,2>{0.390112013f, 0.460840553f},
-std::array<float,2>{0.870245755f, 0.725362301f},
-std::array<float,2>{0.6771577f, 0.41263175f},
-std::array<float,2>{0.229606628f, 0.663564384f},
-std::array<float,2>{0.310981274f, 0.107733496f},
-std::array<float,2>{0.929397881f, 0.760100007f},
-std::array<float,2>{0.80819571f, 0.205932096f},
-std::array<float,2>{0.45306024f, 0.952934921f},
-std::array<float,2>{0.0073581473f, 0.311732739f},
-std::array<float,2>{0.560992062f, 0.50956744f},
-std::array<float,2>{0.914648831f, 0.403634191f},
-std::array<float,2>{0.282886088f, 0.65046221f},
-std::array<float,2>{0.237240419f, 0.080305174f},
-std::array<float,2>{0.663822114f, 0.803641677f},
-std::array<float,2>{0.540055811f, 0.231430635f},
-std::array<float,2>{0.0219235867f, 0.979363501f},
-std::array<float,2>{0.462430209f, 0.274456531f},
-std::array<float,2>{0.7862131f, 0.54575479f},
-std::array<float,2>{0.737835467f, 0.336285323f},
-std::array<float,2>{0.155493543f, 0.615520537f},
-std::array<float,2>{0.351801157f, 0.181407809f},
-std::array<float,2>{0.951806903f, 0.87947619f},
-std::array<float,2>{0.859124005f, 0.0159494728f},
-std::array<float,2>{0.40492931f, 0.839230657f},
-std::array<float,2>{0.111985549f, 0.471766025f},
-std::array<float,2>{0.592023313f, 0.707440078f},
-std::array<float,2>{0.756799281f, 0.282593369f},
-std::array<float,2>{0.480604738f, 0.530628979f},
-std::array<float,2>{0.033861082f, 0.202905774f},
-std::array<float,2>{0.502496481f, 0.967129469f},
-std::array<float,2>{0.655428648f, 0.109429412f},
-std::array<float,2>{0.212204382f, 0.780805171f},
-std::array<float,2>{0.256876886f, 0.425929248f},
-std::array<float,2>{0.876102507f, 0.683410704f},
-std::array<float,2>{0.614272296f, 0.438955128f},
-std::array<float,2>{0.0839441791f, 0.749142885f},
-std::array<float,2>{0.411119193f, 0.0537316091f},
-std::array<float,2>{0.838723838f, 0.851329327f},
-std::array<float,2>{0.993181825f, 0.138726667f},
-std::array<float,2>{0.321375698f, 0.915970862f},
-std::array<float,2>{0.178814679f, 0.352307737f},
-std::array<float,2>{0.70619601f, 0.573702931f},
-std::array<float,2>{0.79072386f, 0.431576192f},
-std::array<float,2>{0.459211916f, 0.676108241f},
-std::array<float,2>{0.0269813985f, 0.118092015f},
-std::array<float,2>{0.536397815f, 0.76984632f},
-std::array<float,2>{0.66861546f, 0.191445902f},
-std::array<float,2>{0.24875693f, 0.960162759f},
-std::array<float,2>{0.291115254f, 0.290362179f},
-std::array<float,2>{0.906637132f, 0.517450035f},
-std::array<float,2>{0.58196187f, 0.350073248f},
-std::array<float,2>{0.123669825f, 0.566895366f},
-std::array<float,2>{0.394713104f, 0.132196367f},
-std::array<float,2>{0.846186101f, 0.908571661f},
-std::array<float,2>{0.938884497f, 0.0594493188f},
-std::array<float,2>{0.350954354f, 0.854513466f},
-std::array<float,2>{0.145515084f, 0.44790104f},
-std::array<float,2>{0.745430827f, 0.738123298f},
-std::array<float,2>{0.890533328f, 0.269875437f},
-std::array<float,2>{0.263731867f, 0.538639724f},
-std::array<float,2>{0.206587806f, 0.219122082f},
-std::array<float,2>{0.646001697f, 0.976036906f},
-std::array<float,2>{0.508520424f, 0.0861163363f},
-std::array<float,2>{0.0463527031f, 0.811603904f},
-std::array<float,2>{0.472394615f, 0.394159079f},
-std::array<float,2>{0.760485709f, 0.642097712f},
-std::array<float,2>{0.715933144f, 0.479686975f},
-std::array<float,2>{0.18599388f, 0.712079883f},
-std::array<float,2>{0.31697765f, 0.0300998129f},
-std::array<float,2>{0.985647917f, 0.835201323f},
-std::array<float,2>{0.833368719f, 0.17912297f},
-std::array<float,2>{0.415254295f, 0.887001276f},
-std::array<float,2>{0.0931462869f, 0.334946215f},
-std::array<float,2>{0.624795973f, 0.617320776f},
-std::array<float,2>{0.982147932f, 0.468491942f},
-std::array<float,2>{0.343561083f, 0.726934731f},
-std::array<float,2>{0.167104423f, 0.0436269082f},
-std::array<float,2>{0.69191438f, 0.873223484f},
-std::array<float,2>{0.60365808f, 0.153661609f},
-std::array<float,2>{0.0750667676f, 0.923225164f},
-std::array<float,2>{0.425262392f, 0.364625245f},
-std::array<float,2>{0.827668309f, 0.582847059f},
-std::array<float,2>{0.635791183f, 0.301549673f},
-std::array<float,2>{0.19942233f, 0.504135013f},
-std::array<float,2>{0.27034694f, 0.216303468f},
-std::array<float,2>{0.901907861f, 0.942078173f},
-std::array<float,2>{0.773157477f, 0.101516426f},
-std::array<float,2>{0.498562068f, 0.75693506f},
-std::array<float,2>{0.0490193702f, 0.417964131f},
-std::array<float,2>{0.517264307f, 0.670219183f},
-std::array<float,2>{0.862313271f, 0.322338641f},
-std::array<float,2>{0.376286834f, 0.60438478f},
-std::array<float,2>{0.108592562f, 0.160683349f},
-std::array<float,2>{0.565994322f, 0.902228415f},
-std::array<float,2>{0.727186143f, 0.00850251224f},
-std::array<float,2>{0.13332592f, 0.823530376f},
-std::array<float,2>{0.365517974f, 0.492095798f},
-std::array<float,2>{0.957940876f, 0.696041942f},
-std::array<float,2>{0.549792945f, 0.382388651f},
-std::array<float,2>{0.00874977466f, 0.63063395f},
-std::array<float,2>{0.442940235f, 0.0674556941f},
-std::array<float,2>{0.798374236f, 0.783184111f},
-std::array<float,2>{0.930962741f, 0.247507036f},
-std::array<float,2>{0.299922377f, 0.987669528f},
-std::array<float,2>{0.224591449f, 0.251814634f},
-std::array<float,2>{0.686894f, 0.555284262f},
-std::array<float,2>{0.85124141f, 0.386072993f},
-std::array<float,2>{0.393617481f, 0.634651959f},
-std::array<float,2>{0.119261995f, 0.070893541f},
-std::array<float,2>{0.582570791f, 0.791040659f},
-std::array<float,2>{0.747667074f, 0.239623129f},
-std::array<float,2>{0.1414437f, 0.994666338f},
-std::array<float,2>{0.344382614f, 0.262956679f},
-std::array<float,2>{0.941697359f, 0.54808569f},
-std::array<float,2>{0.534267485f, 0.316041797f},
-std::array<float,2>{0.0283654667f, 0.598844469f},
-std::array<float,2>{0.456885487f, 0.165366173f},
-std::array<float,2>{0.793152511f, 0.893743694f},
-std::array<float,2>{0.913988829f, 0.00103692792f},
-std::array<float,2>{0.294671178f, 0.813312471f},
-std::array<float,2>{0.242645144f, 0.494058371f},
-std::array<float,2>{0.665033996f, 0.688742816f},
-std::array<float,2>{0.991778433f, 0.307962358f},
-std::array<float,2>{0.313386738f, 0.512404978f},
-std::array<float,2>{0.180031687f, 0.208806023f},
-std::array<float,2>{0.714426458f, 0.948447526f},
-std::array<float,2>{0.617273092f, 0.101676591f},
-std::array<float,2>{0.0865392759f, 0.762609661f},
-std::array<float,2>{0.418453336f, 0.409218967f},
-std::array<float,2>{0.828359783f, 0.657552898f},
-std::array<float,2>{0.643326461f, 0.455725908f},
-std::array<float,2>{0.209823444f, 0.72151196f},
-std::array<float,2>{0.261162549f, 0.0371489599f},
-std::array<float,2>{0.886551678f, 0.862043142f},
-std::array<float,2>{0.765501976f, 0.148258597f},
-std::array<float,2>{0.473762453f, 0.933656931f},
-std::array<float,2>{0.0396217853f, 0.374746889f},
-std::array<float,2>{0.513845921f, 0.590953588f},
-std::array<float,2>{0.906149149f, 0.474500686f},
-std::array<float,2>{0.268461406f, 0.703483701f},
-std::array<float,2>{0.196566492f, 0.0225353669f},
-std::array<float,2>{0.63696754f, 0.839919746f},
-std::array<float,2>{0.523300648f, 0.185453981f},
-std::array<float,2>{0.0512768999f, 0.87527597f},
-std::array<float,2>{0.492515415f, 0.342126638f},
-std::array<float,2>{0.769390523f, 0.612259507f},
-std::array<float,2>{0.690432429f, 0.279891819f},
-std::array<float,2>{0.169516534f, 0.541696489f},
-std::array<float,2>{0.337873042f, 0.227051333f},
-std::array<float,2>{0.977634013f, 0.980708778f},
-std::array<float,2>{0.821915388f, 0.085559763f},
-std::array<float,2>{0.428383708f, 0.797169089f},
-std::array<float,2>{0.0708534792f, 0.400857657f},
-std::array<float,2>{0.608639181f, 0.652756989f},
-std::array<float,2>{0.804011762f, 0.35823673f},
-std::array<float,2>{0.439585209f, 0.576501787f},
-std::array<float,2>{0.0125563061f, 0.136376336f},
-std::array<float,2>{0.550847292f, 0.919348478f},
-std::array<float,2>{0.681001067f, 0.0475428067f},
-std::array<float,2>{0.219656542f, 0.847254932f},
-std::array<float,2>{0.301071674f, 0.444163799f},
-std::array<float,2>{0.933595419f, 0.744956732f},
-std::array<float,2>{0.569498718f, 0.423390895f},
-std::array<float,2>{0.103466697f, 0.686099827f},
-std::array<float,2>{0.380104244f, 0.116826594f},
-std::array<float,2>{0.863986373f, 0.777318299f},
-std::array<float,2>{0.953970432f, 0.197095394f},
-std::array<float,2>{0.361062735f, 0.96102941f},
-std::array<float,2>{0.13773495f, 0.287873834f},
-std::array<float,2>{0.732676566f, 0.52626431f},
-std::array<float,2>{0.77961731f, 0.45023492f},
-std::array<float,2>{0.48576504f, 0.742047012f},
-std::array<float,2>{0.0569371507f, 0.0572743751f},
-std::array<float,2>{0.525994897f, 0.856098175f},
-std::array<float,2>{0.628504336f, 0.127201825f},
-std::array<float,2>{0.195270747f, 0.911405563f},
-std::array<float,2>{0.276832312f, 0.347639471f},
-std::array<float,2>{0.895719886f, 0.564489484f},
-std::array<float,2>{0.597794116f, 0.296803683f},
-std::array<float,2>{0.0678898618f, 0.521149337f},
-std::array<float,2>{0.429938436f, 0.188120857f},
-std::array<float,2>{0.819417357f, 0.956593454f},
-std::array<float,2>{0.974565446f, 0.123883292f},
-std::array<float,2>{0.332002878f, 0.7660622f},
-std::array<float,2>{0.158687532f, 0.436618805f},
-std::array<float,2>{0.696074843f, 0.672219992f},
-std::array<float,2>{0.924914062f, 0.328262538f},
-std::array<float,2>{0.304687738f, 0.623763561f},
-std::array<float,2>{0.230611712f, 0.172407448f},
-std::array<float,2>{0.674762547f, 0.884750545f},
-std::array<float,2>{0.555792093f, 0.0249946918f},
-std::array<float,2>{0.000886376656f, 0.828751862f},
-std::array<float,2>{0.448249787f, 0.482338488f},
-std::array<float,2>{0.809936583f, 0.716259241f},
-std::array<float,2>{0.722044587f, 0.398139238f},
-std::array<float,2>{0.125587195f, 0.64468801f},
-std::array<float,2>{0.374434263f, 0.0926311985f},
-std::array<float,2>{0.966121018f, 0.806602716f},
-std::array<float,2>{0.874416173f, 0.225398436f},
-std::array<float,2>{0.383237034f, 0.969536841f},
-std::array<float,2>{0.0956224501f, 0.267256826f},
-std::array<float,2>{0.576031446f, 0.533307493f},
-std::array<float,2>{0.947588503f, 0.421570301f},
-std::array<float,2>{0.357337087f, 0.665725708f},
-std::array<float,2>{0.148927361f, 0.0967399701f},
-std::array<float,2>{0.739766777f, 0.750217259f},
-std::array<float,2>{0.58613956f, 0.211077899f},
-std::array<float,2>{0.114285007f, 0.937751472f},
-std::array<float,2>{0.400769681f, 0.298666954f},
-std::array<float,2>{0.853703976f, 0.503681064f},
-std::array<float,2>{0.656487405f, 0.362730443f},
-std::array<float,2>{0.238298163f, 0.579591334f},
-std::array<float,2>{0.289005131f, 0.149004981f},
-std::array<float,2>{0.920085251f, 0.929345369f},
-std::array<float,2>{0.782189012f, 0.0395884588f},
-std::array<float,2>{0.466965735f, 0.869782865f},
-std::array<float,2>{0.0163946841f, 0.461835027f},
-std::array<float,2>{0.546097875f, 0.732256651f},
-std::array<float,2>{0.842817485f, 0.256703913f},
-std::array<float,2>{0.409022391f, 0.561527848f},
-std::array<float,2>{0.0795415714f, 0.245761514f},
-std::array<float,2>{0.610082805f, 0.990651846f},
-std::array<float,2>{0.70726496f, 0.0657371432f},
-std::array<float,2>{0.175675482f, 0.786241114f},
-std::array<float,2>{0.325988978f, 0.378871381f},
-std::array<float,2>{0.996171892f, 0.628053844f},
-std::array<float,2>{0.506578624f, 0.488229603f},
-std::array<float,2>{0.0381277241f, 0.700172365f},
-std::array<float,2>{0.477050185f, 0.0144592114f},
-std::array<float,2>{0.750082552f, 0.827476144f},
-std::array<float,2>{0.879186034f, 0.158969998f},
-std::array<float,2>{0.251320213f, 0.904326797f},
-std::array<float,2>{0.216662973f, 0.326544553f},
-std::array<float,2>{0.650726259f, 0.607335985f},
-std::array<float,2>{0.867874146f, 0.457906991f},
-std::array<float,2>{0.387147903f, 0.723651707f},
-std::array<float,2>{0.101335809f, 0.0336074419f},
-std::array<float,2>{0.571128905f, 0.866097152f},
-std::array<float,2>{0.723816574f, 0.143056229f},
-std::array<float,2>{0.128956586f, 0.930598021f},
-std::array<float,2>{0.367702991f, 0.368601799f},
-std::array<float,2>{0.961603642f, 0.588481426f},
-std::array<float,2>{0.559830487f, 0.308762729f},
-std::array<float,2>{0.00579362409f, 0.509985209f},
-std::array<float,2>{0.449908316f, 0.205070898f},
-std::array<float,2>{0.806500614f, 0.950598598f},
-std::array<float,2>{0.926193297f, 0.106971554f},
-std::array<float,2>{0.310287774f, 0.759256959f},
-std::array<float,2>{0.227527201f, 0.41018939f},
-std::array<float,2>{0.677921534f, 0.661527336f},
-std::array<float,2>{0.969129562f, 0.318568975f},
-std::array<float,2>{0.335796505f, 0.596773684f},
-std::array<float,2>{0.161610246f, 0.17015022f},
-std::array<float,2>{0.702780008f, 0.895071507f},
-std::array<float,2>{0.595508218f, 0.00395786809f},
-std::array<float,2>{0.0652010664f, 0.816472888f},
-std::array<float,2>{0.435016155f, 0.498428136f},
-std::array<float,2>{0.813165009f, 0.693412006f},
-std::array<float,2>{0.632632434f, 0.388173342f},
-std::array<float,2>{0.18950434f, 0.638460338f},
-std::array<float,2>{0.278426707f, 0.0757957026f},
-std::array<float,2>{0.892415106f, 0.795668304f},
-std::array<float,2>{0.775001228f, 0.237067804f},
-std::array<float,2>{0.489742637f, 0.997730732f},
-std::array<float,2>{0.05998509f, 0.258436292f},
-std::array<float,2>{0.529456139f, 0.552746058f},
-std::array<float,2>{0.878134191f, 0.427984655f},
-std::array<float,2>{0.255014092f, 0.681329787f},
-std::array<float,2>{0.213914409f, 0.11233516f},
-std::array<float,2>{0.653595209f, 0.778710186f},
-std::array<float,2>{0.500859261f, 0.19987981f},
-std::array<float,2>{0.0325577445f, 0.966159821f},
-std::array<float,2>{0.483211368f, 0.283340961f},
-std::array<float,2>{0.754710793f, 0.528783202f},
-std::array<float,2>{0.703130662f, 0.354173422f},
-std::array<float,2>{0.17647405f, 0.570370913f},
-std::array<float,2>{0.322403669f, 0.137820616f},
-std::array<float,2>{0.995159924f, 0.917529583f},
-std::array<float,2>{0.83727783f, 0.0525566563f},
-std::array<float,2>{0.413829088f, 0.848685324f},
-std::array<float,2>{0.0857281163f, 0.440574795f},
-std::array<float,2>{0.616543651f, 0.747114599f},
-std::array<float,2>{0.788043976f, 0.275916249f},
-std::array<float,2>{0.464035928f, 0.544449687f},
-std::array<float,2>{0.0211930927f, 0.234115377f},
-std::array<float,2>{0.541707933f, 0.977042675f},
-std::array<float,2>{0.660330772f, 0.0785421133f},
-std::array<float,2>{0.234990224f, 0.802091062f},
-std::array<float,2>{0.28397271f, 0.404437959f},
-std::array<float,2>{0.916496396f, 0.650063634f},
-std::array<float,2>{0.591412127f, 0.46921885f},
-std::array<float,2>{0.10967955f, 0.710218728f},
-std::array<float,2>{0.40267241f, 0.0177820157f},
-std::array<float,2>{0.8566311f, 0.837253273f},
-std::array<float,2>{0.950467944f, 0.181831837f},
-std::array<float,2>{0.353685141f, 0.881687999f},
-std::array<float,2>{0.15301922f, 0.339151263f},
-std::array<float,2>{0.735077679f, 0.613522768f},
-std::array<float,2>{0.75936991f, 0.390648693f},
-std::array<float,2>{0.47029537f, 0.64345479f},
-std::array<float,2>{0.0442266725f, 0.0885373354f},
-std::array<float,2>{0.510482848f, 0.809633017f},
-std::array<float,2>{0.647833645f, 0.222192198f},
-std::array<float,2>{0.204919323f, 0.973680615f},
-std::array<float,2>{0.262664258f, 0.272631794f},
-std::array<float,2>{0.887765646f, 0.535883963f},
-std::array<float,2>{0.621558607f, 0.333619744f},
-std::array<float,2>{0.0911047682f, 0.620862424f},
-std::array<float,2>{0.416460186f, 0.177158028f},
-std::array<float,2>{0.835737705f, 0.889653385f},
-std::array<float,2>{0.986602306f, 0.0284224711f},
-std::array<float,2>{0.318756074f, 0.833081603f},
-std::array<float,2>{0.18373917f, 0.478310555f},
-std::array<float,2>{0.718413174f, 0.71335429f},
-std::array<float,2>{0.90866375f, 0.292863548f},
-std::array<float,2>{0.289666235f, 0.518173933f},
-std::array<float,2>{0.246364191f, 0.193370998f},
-std::array<float,2>{0.671746314f, 0.958768129f},
-std::array<float,2>{0.538639486f, 0.119378418f},
-std::array<float,2>{0.0249591842f, 0.772481263f},
-std::array<float,2>{0.457716525f, 0.431913495f},
-std::array<float,2>{0.792580009f, 0.679162025f},
-std::array<float,2>{0.742568552f, 0.446441859f},
-std::array<float,2>{0.147077769f, 0.735281646f},
-std::array<float,2>{0.347949386f, 0.0613264441f},
-std::array<float,2>{0.939461529f, 0.851999819f},
-std::array<float,2>{0.845073164f, 0.130025163f},
-std::array<float,2>{0.398070782f, 0.906567574f},
-std::array<float,2>{0.12221764f, 0.347913355f},
-std::array<float,2>{0.579566658f, 0.569033146f},
-std::array<float,2>{0.959997296f, 0.489535838f},
-std::array<float,2>{0.364419967f, 0.697284102f},
-std::array<float,2>{0.134962589f, 0.00986138545f},
-std::array<float,2>{0.730238378f, 0.821992636f},
-std::array<float,2>{0.564187586f, 0.163114384f},
-std::array<float,2>{0.105751261f, 0.898509681f},
-std::array<float,2>{0.378866613f, 0.320428818f},
-std::array<float,2>{0.860403657f, 0.601805568f},
-std::array<float,2>{0.683613241f, 0.253461063f},
-std::array<float,2>{0.224708885f, 0.556971788f},
-std::array<float,2>{0.297696859f, 0.248191789f},
-std::array<float,2>{0.933360219f, 0.985818386f},
-std::array<float,2>{0.799899399f, 0.0685482472f},
-std::array<float,2>{0.445113838f, 0.783724427f},
-std::array<float,2>{0.00991669018f, 0.380425334f},
-std::array<float,2>{0.547166109f, 0.632460058f},
-std::array<float,2>{0.824853539f, 0.367177993f},
-std::array<float,2>{0.422164798f, 0.583994627f},
-std::array<float,2>{0.0763530508f, 0.156050488f},
-std::array<float,2>{0.602873683f, 0.9255777f},
-std::array<float,2>{0.693955898f, 0.0465173982f},
-std::array<float,2>{0.164405659f, 0.87170136f},
-std::array<float,2>{0.340953529f, 0.466380239f},
-std::array<float,2>{0.983475566f, 0.728920162f},
-std::array<float,2>{0.519048274f, 0.415771365f},
-std::array<float,2>{0.0468929894f, 0.668308854f},
-std::array<float,2>{0.496431321f, 0.0985436365f},
-std::array<float,2>{0.769872725f, 0.755574942f},
-std::array<float,2>{0.900109112f, 0.216825232f},
-std::array<float,2>{0.272203892f, 0.944535851f},
-std::array<float,2>{0.201219618f, 0.303663075f},
-std::array<float,2>{0.633694232f, 0.507615685f},
-std::array<float,2>{0.831349492f, 0.408108592f},
-std::array<float,2>{0.420805663f, 0.659532368f},
-std::array<float,2>{0.0880164653f, 0.104532465f},
-std::array<float,2>{0.62033242f, 0.765001059f},
-std::array<float,2>{0.712688386f, 0.209016919f},
-std::array<float,2>{0.183263823f, 0.946210086f},
-std::array<float,2>{0.315686554f, 0.305541188f},
-std::array<float,2>{0.988369703f, 0.514336169f},
-std::array<float,2>{0.511735678f, 0.372654557f},
-std::array<float,2>{0.0417496227f, 0.592968404f},
-std::array<float,2>{0.474973202f, 0.145064026f},
-std::array<float,2>{0.763263464f, 0.935598373f},
-std::array<float,2>{0.883321762f, 0.0351668559f},
-std::array<float,2>{0.258976042f, 0.859493256f},
-std::array<float,2>{0.207570925f, 0.453357667f},
-std::array<float,2>{0.640848219f, 0.719211221f},
-std::array<float,2>{0.94368118f, 0.264990926f},
-std::array<float,2>{0.346037805f, 0.549347162f},
-std::array<float,2>{0.143023551f, 0.241432399f},
-std::array<float,2>{0.748618364f, 0.992606997f},
-std::array<float,2>{0.584286094f, 0.0734463781f},
-std::array<float,2>{0.118928798f, 0.7898013f},
-std::array<float,2>{0.39244926f, 0.383227378f},
-std::array<float,2>{0.847745299f, 0.635440886f},
-std::array<float,2>{0.667782068f, 0.495416105f},
-std::array<float,2>{0.244221136f, 0.690438092f},
-std::array<float,2>{0.29648f, 0.00289973104f},
-std::array<float,2>{0.910981417f, 0.815068007f},
-std::array<float,2>{0.795716465f, 0.16707024f},
-std::array<float,2>{0.453344405f, 0.891674936f},
-std::array<float,2>{0.0293986183f, 0.314069808f},
-std::array<float,2>{0.532664537f, 0.600233555f},
-std::array<float,2>{0.936378241f, 0.442909807f},
-std::array<float,2>{0.304520994f, 0.743054271f},
-std::array<float,2>{0.222164169f, 0.0505494475f},
-std::array<float,2>{0.682015896f, 0.844863772f},
-std::array<float,2>{0.553831697f, 0.134027883f},
-std::array<float,2>{0.0155992461f, 0.920548558f},
-std::array<float,2>{0.437612146f, 0.35708487f},
-std::array<float,2>{0.802315652f, 0.575967491f},
-std::array<float,2>{0.730872691f, 0.286788136f},
-std::array<float,2>{0.140214503f, 0.52461195f},
-std::array<float,2>{0.362773329f, 0.198140934f},
-std::array<float,2>{0.955500722f, 0.963469863f},
-std::array<float,2>{0.865683258f, 0.113383017f},
-std::array<float,2>{0.382463157f, 0.774665117f},
-std::array<float,2>{0.105243608f, 0.425266057f},
-std::array<float,2>{0.567488313f, 0.684941769f},
-std::array<float,2>{0.766485035f, 0.340879738f},
-std::array<float,2>{0.494400859f, 0.610393465f},
-std::array<float,2>{0.0543165803f, 0.186207265f},
-std::array<float,2>{0.520859897f, 0.877729595f},
-std::array<float,2>{0.640051544f, 0.0202807672f},
-std::array<float,2>{0.199202791f, 0.843249977f},
-std::array<float,2>{0.266270876f, 0.476432174f},
-std::array<float,2>{0.902664721f, 0.706561148f},
-std::array<float,2>{0.60699296f, 0.39890632f},
-std::array<float,2>{0.0729699656f, 0.655801296f},
-std::array<float,2>{0.427446455f, 0.0839501023f},
-std::array<float,2>{0.822719991f, 0.799600184f},
-std::array<float,2>{0.97995615f, 0.2289377f},
-std::array<float,2>{0.338020921f, 0.982687235f},
-std::array<float,2>{0.171301901f, 0.277597845f},
-std::array<float,2>{0.688979983f, 0.539826334f},
-std::array<float,2>{0.811107099f, 0.484301537f},
-std::array<float,2>{0.445931345f, 0.716838539f},
-std::array<float,2>{0.00379068428f, 0.0273205992f},
-std::array<float,2>{0.557604611f, 0.830173671f},
-std::array<float,2>{0.67306304f, 0.174368843f},
-std::array<float,2>{0.234126359f, 0.885135293f},
-std::array<float,2>{0.307186782f, 0.332009614f},
-std::array<float,2>{0.923650801f, 0.622029126f},
-std::array<float,2>{0.576759934f, 0.26773116f},
-std::array<float,2>{0.0963563025f, 0.532072246f},
-std::array<float,2>{0.386717081f, 0.223224461f},
-std::array<float,2>{0.872121215f, 0.971002638f},
-std::array<float,2>{0.967674017f, 0.0907056406f},
-std::array<float,2>{0.37230739f, 0.806816995f},
-std::array<float,2>{0.128515273f, 0.394935966f},
-std::array<float,2>{0.71961683f, 0.64755398f},
-std::array<float,2>{0.897917807f, 0.344561547f},
-std::array<float,2>{0.275198787f, 0.564310789f},
-std::array<float,2>{0.191482738f, 0.125055835f},
-std::array<float,2>{0.626220524f, 0.913321078f},
-std::array<float,2>{0.523685455f, 0.0552512035f},
-std::array<float,2>{0.0547944419f, 0.858863711f},
-std::array<float,2>{0.488203049f, 0.452325493f},
-std::array<float,2>{0.777745724f, 0.739535689f},
-std::array<float,2>{0.699140072f, 0.435341299f},
-std::array<float,2>{0.157260031f, 0.673882008f},
-std::array<float,2>{0.328481883f, 0.12194816f},
-std::array<float,2>{0.975476444f, 0.769336998f},
-std::array<float,2>{0.81651938f, 0.190993071f},
-std::array<float,2>{0.432032466f, 0.954222918f},
-std::array<float,2>{0.0685739443f, 0.294532299f},
-std::array<float,2>{0.599620044f, 0.522711337f},
-std::array<float,2>{0.999858022f, 0.375350624f},
-std::array<float,2>{0.327152997f, 0.626839399f},
-std::array<float,2>{0.172719583f, 0.0627422854f},
-std::array<float,2>{0.709542811f, 0.787356198f},
-std::array<float,2>{0.613182127f, 0.242907152f},
-std::array<float,2>{0.0805963576f, 0.989867866f},
-std::array<float,2>{0.407260895f, 0.254981428f},
-std::array<float,2>{0.840542853f, 0.559664547f},
-std::array<float,2>{0.649023175f, 0.325673938f},
-std::array<float,2>{0.217646629f, 0.608582497f},
-std::array<float,2>{0.253700107f, 0.156669125f},
-std::array<float,2>{0.880977452f, 0.902456164f},
-std::array<float,2>{0.753162563f, 0.0117295012f},
-std::array<float,2>{0.478995591f, 0.824726164f},
-std::array<float,2>{0.0365623944f, 0.484443516f},
-std::array<float,2>{0.50434804f, 0.701260507f},
-std::array<float,2>{0.852585793f, 0.29928565f},
-std::array<float,2>{0.400283188f, 0.500659525f},
-std::array<float,2>{0.116509676f, 0.214652479f},
-std::array<float,2>{0.588145673f, 0.940155268f},
-std::array<float,2>{0.741650641f, 0.0937524289f},
-std::array<float,2>{0.150880605f, 0.7526564f},
-std::array<float,2>{0.357471436f, 0.419471353f},
-std::array<float,2>{0.947186828f, 0.667499006f},
-std::array<float,2>{0.543065846f, 0.463744998f},
-std::array<float,2>{0.0190079268f, 0.73344934f},
-std::array<float,2>{0.465566993f, 0.0417475514f},
-std::array<float,2>{0.784948945f, 0.867327869f},
-std::array<float,2>{0.918042779f, 0.150684446f},
-std::array<float,2>{0.286762297f, 0.927402854f},
-std::array<float,2>{0.241541103f, 0.360186189f},
-std::array<float,2>{0.659626603f, 0.581056178f},
-std::array<float,2>{0.855664551f, 0.471364766f},
-std::array<float,2>{0.403353333f, 0.708811522f},
-std::array<float,2>{0.111154594f, 0.0172351096f},
-std::array<float,2>{0.590762496f, 0.838594258f},
-std::array<float,2>{0.735747278f, 0.180387512f},
-std::array<float,2>{0.153702334f, 0.880658686f},
-std::array<float,2>{0.355224639f, 0.33777824f},
-std::array<float,2>{0.94960171f, 0.616642356f},
-std::array<float,2>{0.542643249f, 0.273673594f},
-std::array<float,2>{0.0201783404f, 0.546771049f},
-std::array<float,2>{0.463657409f, 0.231962577f},
-std::array<float,2>{0.788173079f, 0.979801118f},
-std::array<float,2>{0.917187452f, 0.081797123f},
-std::array<float,2>{0.2848562f, 0.803999245f},
-std::array<float,2>{0.235447869f, 0.403038412f},
-std::array<float,2>{0.661694944f, 0.651490152f},
-std::array<float,2>{0.994805694f, 0.352595776f},
-std::array<float,2>{0.323888093f, 0.572457731f},
-std::array<float,2>{0.177107811f, 0.139977843f},
-std::array<float,2>{0.704567313f, 0.914797902f},
-std::array<float,2>{0.615377307f, 0.0532592013f},
-std::array<float,2>{0.0840032771f, 0.850121737f},
-std::array<float,2>{0.412893742f, 0.438053757f},
-std::array<float,2>{0.836156726f, 0.748487294f},
-std::array<float,2>{0.652499974f, 0.427587956f},
-std::array<float,2>{0.213136345f, 0.682078779f},
-std::array<float,2>{0.254416704f, 0.110925987f},
-std::array<float,2>{0.877524793f, 0.780171156f},
-std::array<float,2>{0.75575757f, 0.201222092f},
-std::array<float,2>{0.483850747f, 0.968671679f},
-std::array<float,2>{0.0313446894f, 0.28168717f},
-std::array<float,2>{0.501360595f, 0.529731333f},
-std::array<float,2>{0.891391516f, 0.390317649f},
-std::array<float,2>{0.277688086f, 0.639508843f},
-std::array<float,2>{0.190643162f, 0.0776657313f},
-std::array<float,2>{0.631483614f, 0.79403168f},
-std::array<float,2>{0.530884027f, 0.235384673f},
-std::array<float,2>{0.0594374388f, 0.999395251f},
-std::array<float,2>{0.489087641f, 0.261133283f},
-std::array<float,2>{0.773959994f, 0.551702559f},
-std::array<float,2>{0.701912642f, 0.316949904f},
-std::array<float,2>{0.1604155f, 0.594858587f},
-std::array<float,2>{0.334436983f, 0.168329149f},
-std::array<float,2>{0.970507681f, 0.898196936f},
-std::array<float,2>{0.813675165f, 0.0072372728f},
-std::array<float,2>{0.433805645f, 0.820092738f},
-std::array<float,2>{0.0655800179f, 0.496601224f},
-std::array<float,2>{0.594241858f, 0.692581356f},
-std::array<float,2>{0.804950058f, 0.311110377f},
-std::array<float,2>{0.450943708f, 0.508681536f},
-std::array<float,2>{0.00423519639f, 0.206598639f},
-std::array<float,2>{0.558822036f, 0.951271355f},
-std::array<float,2>{0.679319561f, 0.108433589f},
-std::array<float,2>{0.228073016f, 0.760808229f},
-std::array<float,2>{0.308711231f, 0.413615257f},
-std::array<float,2>{0.927374125f, 0.662938535f},
-std::array<float,2>{0.572210908f, 0.459459454f},
-std::array<float,2>{0.100126095f, 0.726555109f},
-std::array<float,2>{0.387738585f, 0.0320905373f},
-std::array<float,2>{0.868230045f, 0.864407063f},
-std::array<float,2>{0.96261704f, 0.142216399f},
-std::array<float,2>{0.368564159f, 0.932786882f},
-std::array<float,2>{0.130532995f, 0.370966494f},
-std::array<float,2>{0.723433912f, 0.586390972f},
-std::array<float,2>{0.771061838f, 0.416666478f},
-std::array<float,2>{0.497217715f, 0.670919716f},
-std::array<float,2>{0.0485089757f, 0.100497253f},
-std::array<float,2>{0.517712831f, 0.756481588f},
-std::array<float,2>{0.634496808f, 0.215408459f},
-std::array<float,2>{0.202494547f, 0.942648947f},
-std::array<float,2>{0.272647709f, 0.301798731f},
-std::array<float,2>{0.898465574f, 0.504899979f},
-std::array<float,2>{0.601576447f, 0.363957703f},
-std::array<float,2>{0.0773616135f, 0.583505332f},
-std::array<float,2>{0.422977835f, 0.152482659f},
-std::array<float,2>{0.825747788f, 0.921926081f},
-std::array<float,2>{0.982728779f, 0.0448427498f},
-std::array<float,2>{0.340666592f, 0.874592304f},
-std::array<float,2>{0.165112838f, 0.467045009f},
-std::array<float,2>{0.694766998f, 0.727729499f},
-std::array<float,2>{0.932079852f, 0.250424027f},
-std::array<float,2>{0.29809624f, 0.556382477f},
-std::array<float,2>{0.226095393f, 0.246415555f},
-std::array<float,2>{0.6854195f, 0.986764908f},
-std::array<float,2>{0.548617303f, 0.0669836253f},
-std::array<float,2>{0.0108027365f, 0.781285703f},
-std::array<float,2>{0.443710864f, 0.380864203f},
-std::array<float,2>{0.799541175f, 0.629454792f},
-std::array<float,2>{0.728702426f, 0.490554601f},
-std::array<float,2>{0.135865793f, 0.696345687f},
-std::array<float,2>{0.363575041f, 0.00974582508f},
-std::array<float,2>{0.959208131f, 0.823116183f},
-std::array<float,2>{0.859777808f, 0.161137104f},
-std::array<float,2>{0.37732175f, 0.90064317f},
-std::array<float,2>{0.106608294f, 0.323869377f},
-std::array<float,2>{0.563244641f, 0.604587734f},
-std::array<float,2>{0.940561771f, 0.44880864f},
-std::array<float,2>{0.34934324f, 0.737229645f},
-std::array<float,2>{0.147771105f, 0.0597665459f},
-std::array<float,2>{0.743780851f, 0.85406059f},
-std::array<float,2>{0.579025328f, 0.131536171f},
-std::array<float,2>{0.121394701f, 0.909947157f},
-std::array<float,2>{0.396652192f, 0.351299077f},
-std::array<float,2>{0.844132006f, 0.567921937f},
-std::array<float,2>{0.670476854f, 0.289116174f},
-std::array<float,2>{0.247779787f, 0.516018927f},
-std::array<float,2>{0.290486693f, 0.192565814f},
-std::array<float,2>{0.909288585f, 0.959639847f},
-std::array<float,2>{0.791800976f, 0.118236773f},
-std::array<float,2>{0.45862174f, 0.771103978f},
-std::array<float,2>{0.0242122505f, 0.430612504f},
-std::array<float,2>{0.537862539f, 0.677130997f},
-std::array<float,2>{0.834184825f, 0.335463196f},
-std::array<float,2>{0.417122632f, 0.618236661f},
-std::array<float,2>{0.0906689167f, 0.178548157f},
-std::array<float,2>{0.622808397f, 0.888231575f},
-std::array<float,2>{0.716808677f, 0.0303272959f},
-std::array<float,2>{0.18508625f, 0.834371984f},
-std::array<float,2>{0.319718271f, 0.479455292f},
-std::array<float,2>{0.987628877f, 0.711841047f},
-std::array<float,2>{0.511435509f, 0.39276877f},
-std::array<float,2>{0.043070782f, 0.640704751f},
-std::array<float,2>{0.46923703f, 0.0877378359f},
-std::array<float,2>{0.75856638f, 0.810710192f},
-std::array<float,2>{0.887082398f, 0.22020556f},
-std::array<float,2>{0.263443321f, 0.975572348f},
-std::array<float,2>{0.203182518f, 0.271306008f},
-std::array<float,2>{0.647154808f, 0.53736192f},
-std::array<float,2>{0.82403791f, 0.401849627f},
-std::array<float,2>{0.426756591f, 0.653517425f},
-std::array<float,2>{0.0734245107f, 0.0844100937f},
-std::array<float,2>{0.606285334f, 0.798066556f},
-std::array<float,2>{0.687623084f, 0.228240892f},
-std::array<float,2>{0.170095176f, 0.981636822f},
-std::array<float,2>{0.338960588f, 0.280482382f},
-std::array<float,2>{0.979278088f, 0.542728305f},
-std::array<float,2>{0.519831717f, 0.343650222f},
-std::array<float,2>{0.0529643707f, 0.613235772f},
-std::array<float,2>{0.495688051f, 0.184202254f},
-std::array<float,2>{0.766832709f, 0.876658201f},
-std::array<float,2>{0.903993428f, 0.0219874904f},
-std::array<float,2>{0.267371714f, 0.841130435f},
-std::array<float,2>{0.197742596f, 0.473258674f},
-std::array<float,2>{0.639219284f, 0.704728782f},
-std::array<float,2>{0.956606865f, 0.288536072f},
-std::array<float,2>{0.361582249f, 0.526450515f},
-std::array<float,2>{0.139110178f, 0.196263343f},
-std::array<float,2>{0.731586695f, 0.962634027f},
-std::array<float,2>{0.567182839f, 0.11593613f},
-std::array<float,2>{0.103786096f, 0.776309967f},
-std::array<float,2>{0.381315291f, 0.421969563f},
-std::array<float,2>{0.866894841f, 0.686886787f},
-std::array<float,2>{0.683525681f, 0.444550365f},
-std::array<float,2>{0.221070454f, 0.745853186f},
-std::array<float,2>{0.303665102f, 0.0485519357f},
-std::array<float,2>{0.937128305f, 0.845800757f},
-std::array<float,2>{0.801081717f, 0.135241225f},
-std::array<float,2>{0.439182788f, 0.918716133f},
-std::array<float,2>{0.0142567921f, 0.359165281f},
-std::array<float,2>{0.553529382f, 0.577202678f},
-std::array<float,2>{0.911419868f, 0.492939085f},
-std::array<float,2>{0.295892388f, 0.688379645f},
-std::array<float,2>{0.2454184f, 0.000869934855f},
-std::array<float,2>{0.666920006f, 0.813545704f},
-std::array<float,2>{0.532012701f, 0.164804205f},
-std::array<float,2>{0.0311753824f, 0.89330256f},
-std::array<float,2>{0.454522789f, 0.314727187f},
-std::array<float,2>{0.796228707f, 0.59820658f},
-std::array<float,2>{0.749512196f, 0.26217854f},
-std::array<float,2>{0.144186914f, 0.547749758f},
-std::array<float,2>{0.346702635f, 0.238694191f},
-std::array<float,2>{0.944864154f, 0.995513618f},
-std::array<float,2>{0.849444568f, 0.0714113563f},
-std::array<float,2>{0.390926272f, 0.792408109f},
-std::array<float,2>{0.117187671f, 0.384816736f},
-std::array<float,2>{0.585858881f, 0.632975399f},
-std::array<float,2>{0.762614965f, 0.37340647f},
-std::array<float,2>{0.475681961f, 0.590746462f},
-std::array<float,2>{0.0429468527f, 0.147422194f},
-std::array<float,2>{0.512962162f, 0.934790432f},
-std::array<float,2>{0.64208585f, 0.0388168693f},
-std::array<float,2>{0.208572626f, 0.86247921f},
-std::array<float,2>{0.257969677f, 0.456512779f},
-std::array<float,2>{0.884207666f, 0.722475708f},
-std::array<float,2>{0.619960189f, 0.408421069f},
-std::array<float,2>{0.0896792561f, 0.656799078f},
-std::array<float,2>{0.420937419f, 0.102977887f},
-std::array<float,2>{0.830655932f, 0.763196647f},
-std::array<float,2>{0.990120351f, 0.207805529f},
-std::array<float,2>{0.314582914f, 0.948024213f},
-std::array<float,2>{0.181903422f, 0.306806684f},
-std::array<float,2>{0.711435199f, 0.513333857f},
-std::array<float,2>{0.783965051f, 0.462863535f},
-std::array<float,2>{0.46661222f, 0.731279671f},
-std::array<float,2>{0.0178301763f, 0.0409157835f},
-std::array<float,2>{0.544782162f, 0.870903969f},
-std::array<float,2>{0.658732355f, 0.149866596f},
-std::array<float,2>{0.240758032f, 0.928408027f},
-std::array<float,2>{0.285522968f, 0.362041473f},
-std::array<float,2>{0.919801116f, 0.578326225f},
-std::array<float,2>{0.589811981f, 0.297532141f},
-std::array<float,2>{0.1158823f, 0.502923012f},
-std::array<float,2>{0.399046838f, 0.212825462f},
-std::array<float,2>{0.852114439f, 0.938839257f},
-std::array<float,2>{0.946281195f, 0.0962183699f},
-std::array<float,2>{0.3589724f, 0.751545131f},
-std::array<float,2>{0.152286559f, 0.420767993f},
-std::array<float,2>{0.740914762f, 0.66500783f},
-std::array<float,2>{0.882192135f, 0.327467442f},
-std::array<float,2>{0.252183139f, 0.60562551f},
-std::array<float,2>{0.218375191f, 0.159230098f},
-std::array<float,2>{0.650345922f, 0.90569967f},
-std::array<float,2>{0.505167425f, 0.0149417976f},
-std::array<float,2>{0.03537599f, 0.826951206f},
-std::array<float,2>{0.48036921f, 0.486962348f},
-std::array<float,2>{0.752302885f, 0.700846314f},
-std::array<float,2>{0.71073848f, 0.377055734f},
-std::array<float,2>{0.172867373f, 0.627448797f},
-std::array<float,2>{0.326729178f, 0.0652518421f},
-std::array<float,2>{0.998268723f, 0.785939634f},
-std::array<float,2>{0.841206312f, 0.244746551f},
-std::array<float,2>{0.406811446f, 0.992152631f},
-std::array<float,2>{0.081443131f, 0.257196367f},
-std::array<float,2>{0.611981511f, 0.560687363f},
-std::array<float,2>{0.976317525f, 0.436350703f},
-std::array<float,2>{0.329212785f, 0.673824251f},
-std::array<float,2>{0.156626195f, 0.124928661f},
-std::array<float,2>{0.698114753f, 0.767064035f},
-std::array<float,2>{0.601219475f, 0.188969105f},
-std::array<float,2>{0.0697564334f, 0.955723584f},
-std::array<float,2>{0.432932824f, 0.295695573f},
-std::array<float,2>{0.818053842f, 0.51973772f},
-std::array<float,2>{0.625808716f, 0.346225768f},
-std::array<float,2>{0.192694634f, 0.566253185f},
-std::array<float,2>{0.273617208f, 0.128016531f},
-std::array<float,2>{0.896583736f, 0.910212994f},
-std::array<float,2>{0.778855205f, 0.0585094504f},
-std::array<float,2>{0.486627936f, 0.856603622f},
-std::array<float,2>{0.0560725555f, 0.449689478f},
-std::array<float,2>{0.525049329f, 0.740627229f},
-std::array<float,2>{0.871131837f, 0.26573813f},
-std::array<float,2>{0.385713339f, 0.534444392f},
-std::array<float,2>{0.0972934812f, 0.226406723f},
-std::array<float,2>{0.577240825f, 0.970497191f},
-std::array<float,2>{0.71976018f, 0.0930053964f},
-std::array<float,2>{0.127042919f, 0.805231392f},
-std::array<float,2>{0.371946961f, 0.39695999f},
-std::array<float,2>{0.968103707f, 0.646271825f},
-std::array<float,2>{0.557984889f, 0.481076539f},
-std::array<float,2>{0.00207420508f, 0.715280056f},
-std::array<float,2>{0.447132438f, 0.0241029821f},
-std::array<float,2>{0.811809003f, 0.829619884f},
-std::array<float,2>{0.92279619f, 0.173284411f},
-std::array<float,2>{0.308137029f, 0.883489847f},
-std::array<float,2>{0.233156398f, 0.329107851f},
-std::array<float,2>{0.672251344f, 0.624212921f},
-std::array<float,2>{0.839249074f, 0.440007806f},
-std::array<float,2>{0.411281466f, 0.746231616f},
-std::array<float,2>{0.0824461728f, 0.0511532202f},
-std::array<float,2>{0.613282561f, 0.848246038f},
-std::array<float,2>{0.705984294f, 0.137400925f},
-std::array<float,2>{0.177952096f, 0.916582942f},
-std::array<float,2>{0.32117793f, 0.355230182f},
-std::array<float,2>{0.993130267f, 0.571521342f},
-std::array<float,2>{0.503525317f, 0.284404665f},
-std::array<float,2>{0.0350743309f, 0.52764982f},
-std::array<float,2>{0.481892377f, 0.201021343f},
-std::array<float,2>{0.757077456f, 0.965307355f},
-std::array<float,2>{0.875083327f, 0.112275705f},
-std::array<float,2>{0.255873144f, 0.777422607f},
-std::array<float,2>{0.211791381f, 0.429047257f},
-std::array<float,2>{0.655263126f, 0.680532753f},
-std::array<float,2>{0.952228427f, 0.338612258f},
-std::array<float,2>{0.353167832f, 0.614631116f},
-std::array<float,2>{0.154968843f, 0.18282555f},
-std::array<float,2>{0.736337125f, 0.882155955f},
-std::array<float,2>{0.59333086f, 0.0190204158f},
-std::array<float,2>{0.112789236f, 0.836762547f},
-std::array<float,2>{0.405777097f, 0.470200211f},
-std::array<float,2>{0.85839659f, 0.709204674f},
-std::array<float,2>{0.662516773f, 0.406105518f},
-std::array<float,2>{0.238221571f, 0.648637056f},
-std::array<float,2>{0.281719059f, 0.0792526305f},
-std::array<float,2>{0.915101767f, 0.801163137f},
-std::array<float,2>{0.78581512f, 0.232969925f},
-std::array<float,2>{0.460992157f, 0.977998257f},
-std::array<float,2>{0.0225887913f, 0.277255803f},
-std::array<float,2>{0.53978622f, 0.54327637f},
-std::array<float,2>{0.928099632f, 0.411383301f},
-std::array<float,2>{0.311656386f, 0.660648763f},
-std::array<float,2>{0.228789419f, 0.105672486f},
-std::array<float,2>{0.676282048f, 0.758243859f},
-std::array<float,2>{0.562102437f, 0.203673363f},
-std::array<float,2>{0.00671916781f, 0.949804604f},
-std::array<float,2>{0.451665789f, 0.309762329f},
-std::array<float,2>{0.807295918f, 0.5111956f},
-std::array<float,2>{0.725000739f, 0.367331028f},
-std::array<float,2>{0.13275592f, 0.589499295f},
-std::array<float,2>{0.370391846f, 0.143698201f},
-std::array<float,2>{0.962901235f, 0.931397438f},
-std::array<float,2>{0.869467854f, 0.0348039754f},
-std::array<float,2>{0.389520139f, 0.866407633f},
-std::array<float,2>{0.0990002155f, 0.458330274f},
-std::array<float,2>{0.573898315f, 0.722883403f},
-std::array<float,2>{0.776019692f, 0.259702504f},
-std::array<float,2>{0.491938472f, 0.553943694f},
-std::array<float,2>{0.0613754503f, 0.238266096f},
-std::array<float,2>{0.527884305f, 0.99677217f},
-std::array<float,2>{0.630655885f, 0.0747592002f},
-std::array<float,2>{0.188787103f, 0.796125889f},
-std::array<float,2>{0.281169742f, 0.386793971f},
-std::array<float,2>{0.893453956f, 0.63766712f},
-std::array<float,2>{0.596750617f, 0.499095052f},
-std::array<float,2>{0.0638617948f, 0.694987476f},
-std::array<float,2>{0.437430263f, 0.0057982672f},
-std::array<float,2>{0.816192865f, 0.818088531f},
-std::array<float,2>{0.971363842f, 0.171210021f},
-std::array<float,2>{0.332541138f, 0.896449327f},
-std::array<float,2>{0.163064852f, 0.320116758f},
-std::array<float,2>{0.699483097f, 0.595786631f},
-std::array<float,2>{0.797757387f, 0.378950864f},
-std::array<float,2>{0.441873789f, 0.630978823f},
-std::array<float,2>{0.00892950036f, 0.0701982453f},
-std::array<float,2>{0.55071795f, 0.784230709f},
-std::array<float,2>{0.685770214f, 0.24952662f},
-std::array<float,2>{0.223138928f, 0.984912097f},
-std::array<float,2>{0.299751461f, 0.252897412f},
-std::array<float,2>{0.930633724f, 0.55785358f},
-std::array<float,2>{0.56498909f, 0.321696222f},
-std::array<float,2>{0.107660905f, 0.60256964f},
-std::array<float,2>{0.375928462f, 0.162854835f},
-std::array<float,2>{0.861580729f, 0.900323451f},
-std::array<float,2>{0.958126545f, 0.0113863191f},
-std::array<float,2>{0.366239399f, 0.820425749f},
-std::array<float,2>{0.134623453f, 0.488755584f},
-std::array<float,2>{0.728318155f, 0.698467553f},
-std::array<float,2>{0.900863886f, 0.304448992f},
-std::array<float,2>{0.27079761f, 0.506790102f},
-std::array<float,2>{0.200966001f, 0.217930764f},
-std::array<float,2>{0.635174751f, 0.943418205f},
-std::array<float,2>{0.516507745f, 0.0989888385f},
-std::array<float,2>{0.0505251847f, 0.754015863f},
-std::array<float,2>{0.499666125f, 0.414775521f},
-std::array<float,2>{0.772179544f, 0.668974221f},
-std::array<float,2>{0.692605019f, 0.465115041f},
-std::array<float,2>{0.166347548f, 0.730418921f},
-std::array<float,2>{0.342173904f, 0.0457414389f},
-std::array<float,2>{0.980713367f, 0.872396052f},
-std::array<float,2>{0.826573253f, 0.154657125f},
-std::array<float,2>{0.424276769f, 0.924802125f},
-std::array<float,2>{0.0757740587f, 0.366126388f},
-std::array<float,2>{0.604550362f, 0.585378349f},
-std::array<float,2>{0.985191762f, 0.476607203f},
-std::array<float,2>{0.31765908f, 0.71440345f},
-std::array<float,2>{0.187102973f, 0.0276660006f},
-std::array<float,2>{0.71515429f, 0.832419872f},
-std::array<float,2>{0.623153746f, 0.175855473f},
-std::array<float,2>{0.0922301188f, 0.889316976f},
-std::array<float,2>{0.414577216f, 0.332950741f},
-std::array<float,2>{0.832866073f, 0.619930208f},
-std::array<float,2>{0.645097435f, 0.2717475f},
-std::array<float,2>{0.205216959f, 0.536175489f},
-std::array<float,2>{0.2646631f, 0.220851421f},
-std::array<float,2>{0.889051378f, 0.972991168f},
-std::array<float,2>{0.761050165f, 0.0897470489f},
-std::array<float,2>{0.471505046f, 0.809481323f},
-std::array<float,2>{0.0454331562f, 0.391910344f},
-std::array<float,2>{0.509067416f, 0.643802524f},
-std::array<float,2>{0.84714824f, 0.349589348f},
-std::array<float,2>{0.395538509f, 0.57006377f},
-std::array<float,2>{0.124077395f, 0.129843041f},
-std::array<float,2>{0.580325603f, 0.907524645f},
-std::array<float,2>{0.74455893f, 0.0615237392f},
-std::array<float,2>{0.144589961f, 0.853122771f},
-std::array<float,2>{0.349617004f, 0.44545418f},
-std::array<float,2>{0.937623382f, 0.735834956f},
-std::array<float,2>{0.535315633f, 0.432968765f},
-std::array<float,2>{0.0259499401f, 0.677843273f},
-std::array<float,2>{0.460476726f, 0.120763868f},
-std::array<float,2>{0.789905965f, 0.772202194f},
-std::array<float,2>{0.907509506f, 0.195033789f},
-std::array<float,2>{0.292684764f, 0.957996845f},
-std::array<float,2>{0.2498236f, 0.291116089f},
-std::array<float,2>{0.669202983f, 0.519058108f},
-std::array<float,2>{0.865026057f, 0.424744546f},
-std::array<float,2>{0.379763395f, 0.684293091f},
-std::array<float,2>{0.101849727f, 0.114911936f},
-std::array<float,2>{0.568927169f, 0.774364054f},
-std::array<float,2>{0.733970642f, 0.198527768f},
-std::array<float,2>{0.137181878f, 0.964083612f},
-std::array<float,2>{0.3596012f, 0.285211205f},
-std::array<float,2>{0.954468608f, 0.5241642f},
-std::array<float,2>{0.552154064f, 0.356136143f},
-std::array<float,2>{0.0128473518f, 0.574961603f},
-std::array<float,2>{0.440715998f, 0.133211851f},
-std::array<float,2>{0.803092182f, 0.921826601f},
-std::array<float,2>{0.934686601f, 0.0497112311f},
-std::array<float,2>{0.301857263f, 0.843783975f},
-std::array<float,2>{0.220054746f, 0.44197312f},
-std::array<float,2>{0.680109143f, 0.743506134f},
-std::array<float,2>{0.977294862f, 0.278955728f},
-std::array<float,2>{0.335976541f, 0.540763319f},
-std::array<float,2>{0.168031454f, 0.229847804f},
-std::array<float,2>{0.690225124f, 0.983877182f},
-std::array<float,2>{0.607658029f, 0.0825037211f},
-std::array<float,2>{0.072240375f, 0.800387919f},
-std::array<float,2>{0.429032534f, 0.399498343f},
-std::array<float,2>{0.821250618f, 0.654743075f},
-std::array<float,2>{0.637780368f, 0.474879831f},
-std::array<float,2>{0.195357591f, 0.705943763f},
-std::array<float,2>{0.268989533f, 0.0205113273f},
-std::array<float,2>{0.90505141f, 0.841938138f},
-std::array<float,2>{0.768235981f, 0.187133133f},
-std::array<float,2>{0.493848264f, 0.878685594f},
-std::array<float,2>{0.0518811308f, 0.340110719f},
-std::array<float,2>{0.522200346f, 0.609563112f},
-std::array<float,2>{0.885629833f, 0.454781741f},
-std::array<float,2>{0.260623723f, 0.720111966f},
-std::array<float,2>{0.210120097f, 0.0365119912f},
-std::array<float,2>{0.643749654f, 0.861132026f},
-std::array<float,2>{0.515224934f, 0.145623639f},
-std::array<float,2>{0.0401375145f, 0.936821103f},
-std::array<float,2>{0.472772598f, 0.371808708f},
-std::array<float,2>{0.763679326f, 0.592502713f},
-std::array<float,2>{0.712900937f, 0.305772036f},
-std::array<float,2>{0.180901691f, 0.514906466f},
-std::array<float,2>{0.314303517f, 0.210527673f},
-std::array<float,2>{0.991082191f, 0.946931124f},
-std::array<float,2>{0.829821706f, 0.104126655f},
-std::array<float,2>{0.419067591f, 0.763900042f},
-std::array<float,2>{0.0878133327f, 0.406353295f},
-std::array<float,2>{0.619086742f, 0.659090519f},
-std::array<float,2>{0.794641018f, 0.312763304f},
-std::array<float,2>{0.455198944f, 0.601213098f},
-std::array<float,2>{0.0276412237f, 0.166450143f},
-std::array<float,2>{0.533757329f, 0.890999615f},
-std::array<float,2>{0.66593039f, 0.00341294589f},
-std::array<float,2>{0.243435174f, 0.815990269f},
-std::array<float,2>{0.2933321f, 0.494633704f},
-std::array<float,2>{0.912552893f, 0.690047443f},
-std::array<float,2>{0.58310473f, 0.384431809f},
-std::array<float,2>{0.120331168f, 0.635826528f},
-std::array<float,2>{0.392698497f, 0.0729025006f},
-std::array<float,2>{0.850126863f, 0.790463984f},
-std::array<float,2>{0.942904592f, 0.240504369f},
-std::array<float,2>{0.345510662f, 0.993419588f},
-std::array<float,2>{0.142542228f, 0.264135301f},
-std::array<float,2>{0.74627161f, 0.549850583f},
-std::array<float,2>{0.751884937f, 0.485551536f},
-std::array<float,2>{0.478348315f, 0.703111708f},
-std::array<float,2>{0.0371566191f, 0.0133143105f},
-std::array<float,2>{0.507051468f, 0.825746775f},
-std::array<float,2>{0.651634037f, 0.158150673f},
-std::array<float,2>{0.21579355f, 0.90358603f},
-std::array<float,2>{0.250465751f, 0.324668944f},
-std::array<float,2>{0.879902303f, 0.607537091f},
-std::array<float,2>{0.610424995f, 0.254092425f},
-std::array<float,2>{0.0786887333f, 0.559383631f},
-std::array<float,2>{0.409661144f, 0.243506685f},
-std::array<float,2>{0.842485607f, 0.989149451f},
-std::array<float,2>{0.997646332f, 0.063995108f},
-std::array<float,2>{0.3242549f, 0.788967013f},
-std::array<float,2>{0.174248531f, 0.376507342f},
-std::array<float,2>{0.708100021f, 0.625167847f},
-std::array<float,2>{0.921301246f, 0.360554695f},
-std::array<float,2>{0.287774295f, 0.58105278f},
-std::array<float,2>{0.240216658f, 0.15215975f},
-std::array<float,2>{0.657948494f, 0.926403821f},
-std::array<float,2>{0.545512795f, 0.0421066433f},
-std::array<float,2>{0.0166065767f, 0.868728817f},
-std::array<float,2>{0.468163669f, 0.463946521f},
-std::array<float,2>{0.782931626f, 0.733139277f},
-std::array<float,2>{0.739239454f, 0.418055415f},
-std::array<float,2>{0.149712771f, 0.666561186f},
-std::array<float,2>{0.355609685f, 0.0955064669f},
-std::array<float,2>{0.948700964f, 0.753135145f},
-std::array<float,2>{0.855375469f, 0.213148147f},
-std::array<float,2>{0.402174383f, 0.940840721f},
-std::array<float,2>{0.113459885f, 0.300695181f},
-std::array<float,2>{0.587055087f, 0.501579642f},
-std::array<float,2>{0.965026915f, 0.395719349f},
-std::array<float,2>{0.37345916f, 0.646947563f},
-std::array<float,2>{0.126409993f, 0.0911003351f},
-std::array<float,2>{0.721587479f, 0.808255076f},
-std::array<float,2>{0.574235976f, 0.224524543f},
-std::array<float,2>{0.0943243131f, 0.972441673f},
-std::array<float,2>{0.384714335f, 0.268842041f},
-std::array<float,2>{0.873809576f, 0.532455146f},
-std::array<float,2>{0.675523996f, 0.330733001f},
-std::array<float,2>{0.231987894f, 0.622382045f},
-std::array<float,2>{0.306292653f, 0.175346404f},
-std::array<float,2>{0.924718857f, 0.886233687f},
-std::array<float,2>{0.808891952f, 0.0258092936f},
-std::array<float,2>{0.448200375f, 0.831112623f},
-std::array<float,2>{0.00182425743f, 0.483080149f},
-std::array<float,2>{0.554864168f, 0.718697488f},
-std::array<float,2>{0.818877161f, 0.293780059f},
-std::array<float,2>{0.430913538f, 0.521807194f},
-std::array<float,2>{0.0669408217f, 0.189793989f},
-std::array<float,2>{0.5993613f, 0.953785479f},
-std::array<float,2>{0.696594059f, 0.12273705f},
-std::array<float,2>{0.159403339f, 0.768455088f},
-std::array<float,2>{0.330742925f, 0.4345465f},
-std::array<float,2>{0.972862184f, 0.674806356f},
-std::array<float,2>{0.526745915f, 0.451337934f},
-std::array<float,2>{0.0578243546f, 0.739126682f},
-std::array<float,2>{0.485335588f, 0.0560825095f},
-std::array<float,2>{0.781157792f, 0.857750535f},
-std::array<float,2>{0.895038962f, 0.126720414f},
-std::array<float,2>{0.276203662f, 0.912986875f},
-std::array<float,2>{0.193967447f, 0.345349282f},
-std::array<float,2>{0.627190053f, 0.563189387f}}
\ No newline at end of file
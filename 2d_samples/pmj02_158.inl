@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.9892717f, 0.894277453f},
-std::array<float,2>{0.133767188f, 0.0893242583f},
-std::array<float,2>{0.521694601f, 0.4078933f},
-std::array<float,2>{0.327456236f, 0.693003953f},
-std::array<float,2>{0.745384097f, 0.571794808f},
-std::array<float,2>{0.406782866f, 0.309955478f},
-std::array<float,2>{0.755620062f, 0.126720101f},
-std::array<float,2>{0.100046329f, 0.778617084f},
-std::array<float,2>{0.582967401f, 0.852851868f},
-std::array<float,2>{0.259182185f, 0.210122779f},
-std::array<float,2>{0.90239507f, 0.341751337f},
-std::array<float,2>{0.216473505f, 0.552745819f},
-std::array<float,2>{0.849110901f, 0.675550818f},
-std::array<float,2>{0.0252009556f, 0.487484068f},
-std::array<float,2>{0.666548431f, 0.00417898782f},
-std::array<float,2>{0.480452925f, 0.954907596f},
-std::array<float,2>{0.806460798f, 0.784053743f},
-std::array<float,2>{0.0931809098f, 0.166281238f},
-std::array<float,2>{0.716282547f, 0.272216201f},
-std::array<float,2>{0.378225088f, 0.599448919f},
-std::array<float,2>{0.55425787f, 0.728731036f},
-std::array<float,2>{0.369284838f, 0.383396238f},
-std::array<float,2>{0.942459464f, 0.123609819f},
-std::array<float,2>{0.18637605f, 0.907776475f},
-std::array<float,2>{0.646686375f, 0.999647737f},
-std::array<float,2>{0.458007008f, 0.0513011999f},
-std::array<float,2>{0.837444961f, 0.437572926f},
-std::array<float,2>{0.0327406749f, 0.644733369f},
-std::array<float,2>{0.910668254f, 0.501592755f},
-std::array<float,2>{0.239562437f, 0.355821013f},
-std::array<float,2>{0.615689933f, 0.219248146f},
-std::array<float,2>{0.29306972f, 0.820976973f},
-std::array<float,2>{0.815995395f, 0.951870203f},
-std::array<float,2>{0.060312625f, 0.0309140272f},
-std::array<float,2>{0.64024204f, 0.473894328f},
-std::array<float,2>{0.450510442f, 0.668024302f},
-std::array<float,2>{0.593989253f, 0.543651342f},
-std::array<float,2>{0.298201591f, 0.315257311f},
-std::array<float,2>{0.926364183f, 0.189959198f},
-std::array<float,2>{0.225425139f, 0.873287141f},
-std::array<float,2>{0.700845718f, 0.764154851f},
-std::array<float,2>{0.403446168f, 0.141885579f},
-std::array<float,2>{0.781860769f, 0.292813122f},
-std::array<float,2>{0.0707827061f, 0.581802845f},
-std::array<float,2>{0.964804411f, 0.708460093f},
-std::array<float,2>{0.158812076f, 0.4368487f},
-std::array<float,2>{0.542824864f, 0.0709767789f},
-std::array<float,2>{0.357775629f, 0.880510271f},
-std::array<float,2>{0.885228992f, 0.828700602f},
-std::array<float,2>{0.201373711f, 0.244702965f},
-std::array<float,2>{0.564234734f, 0.371189386f},
-std::array<float,2>{0.278224528f, 0.522757113f},
-std::array<float,2>{0.676636398f, 0.629142582f},
-std::array<float,2>{0.499395251f, 0.464218497f},
-std::array<float,2>{0.872393429f, 0.0318331197f},
-std::array<float,2>{0.0119474949f, 0.982278645f},
-std::array<float,2>{0.510329127f, 0.937051296f},
-std::array<float,2>{0.328966111f, 0.102783605f},
-std::array<float,2>{0.982903719f, 0.395750612f},
-std::array<float,2>{0.151431471f, 0.742967248f},
-std::array<float,2>{0.766194999f, 0.620362043f},
-std::array<float,2>{0.123405211f, 0.252329916f},
-std::array<float,2>{0.727160096f, 0.185349196f},
-std::array<float,2>{0.423840493f, 0.802235305f},
-std::array<float,2>{0.929753244f, 0.970710039f},
-std::array<float,2>{0.232239947f, 0.0448592156f},
-std::array<float,2>{0.604282498f, 0.460291833f},
-std::array<float,2>{0.305699766f, 0.634278834f},
-std::array<float,2>{0.629347622f, 0.525339246f},
-std::array<float,2>{0.441159934f, 0.36564061f},
-std::array<float,2>{0.825912356f, 0.237024218f},
-std::array<float,2>{0.0543489978f, 0.83847785f},
-std::array<float,2>{0.534730375f, 0.806515634f},
-std::array<float,2>{0.344077229f, 0.176961854f},
-std::array<float,2>{0.954370141f, 0.259188473f},
-std::array<float,2>{0.170897678f, 0.613706946f},
-std::array<float,2>{0.791009188f, 0.741243482f},
-std::array<float,2>{0.0684666261f, 0.405655563f},
-std::array<float,2>{0.688468814f, 0.0961993337f},
-std::array<float,2>{0.393862426f, 0.928035438f},
-std::array<float,2>{0.866709828f, 0.860970914f},
-std::array<float,2>{0.00345907267f, 0.201536268f},
-std::array<float,2>{0.68708235f, 0.327989578f},
-std::array<float,2>{0.486030847f, 0.534411609f},
-std::array<float,2>{0.577810466f, 0.661557257f},
-std::array<float,2>{0.267594635f, 0.481854618f},
-std::array<float,2>{0.878808737f, 0.0187523812f},
-std::array<float,2>{0.194891647f, 0.938374341f},
-std::array<float,2>{0.723162711f, 0.888485432f},
-std::array<float,2>{0.431838989f, 0.0664313361f},
-std::array<float,2>{0.778309703f, 0.427396625f},
-std::array<float,2>{0.113788977f, 0.713688791f},
-std::array<float,2>{0.969056189f, 0.588093758f},
-std::array<float,2>{0.144198135f, 0.282532841f},
-std::array<float,2>{0.500531435f, 0.154850781f},
-std::array<float,2>{0.343487918f, 0.756653488f},
-std::array<float,2>{0.763949156f, 0.914192677f},
-std::array<float,2>{0.108661525f, 0.110904589f},
-std::array<float,2>{0.735845089f, 0.378193825f},
-std::array<float,2>{0.421552598f, 0.72056365f},
-std::array<float,2>{0.526634634f, 0.607611537f},
-std::array<float,2>{0.314426154f, 0.277657568f},
-std::array<float,2>{0.99841696f, 0.161884665f},
-std::array<float,2>{0.126066148f, 0.792832494f},
-std::array<float,2>{0.663846493f, 0.815413415f},
-std::array<float,2>{0.474549681f, 0.231497943f},
-std::array<float,2>{0.85653007f, 0.350807309f},
-std::array<float,2>{0.0221750382f, 0.51347822f},
-std::array<float,2>{0.89523381f, 0.653966606f},
-std::array<float,2>{0.209461227f, 0.449918389f},
-std::array<float,2>{0.586924195f, 0.0583726428f},
-std::array<float,2>{0.250771224f, 0.985277891f},
-std::array<float,2>{0.94619602f, 0.772320926f},
-std::array<float,2>{0.176652968f, 0.134898499f},
-std::array<float,2>{0.558443844f, 0.300696284f},
-std::array<float,2>{0.360296816f, 0.565859735f},
-std::array<float,2>{0.706326663f, 0.698914289f},
-std::array<float,2>{0.388959229f, 0.417028368f},
-std::array<float,2>{0.796904624f, 0.0801637918f},
-std::array<float,2>{0.0810888931f, 0.89899826f},
-std::array<float,2>{0.620451748f, 0.965205848f},
-std::array<float,2>{0.282145739f, 0.00878643803f},
-std::array<float,2>{0.918737173f, 0.494084716f},
-std::array<float,2>{0.242737427f, 0.683485329f},
-std::array<float,2>{0.834885478f, 0.559078515f},
-std::array<float,2>{0.0401162282f, 0.333506018f},
-std::array<float,2>{0.655041456f, 0.216043204f},
-std::array<float,2>{0.468056023f, 0.844191313f},
-std::array<float,2>{0.900608361f, 0.922478676f},
-std::array<float,2>{0.211509958f, 0.0986506939f},
-std::array<float,2>{0.581800342f, 0.402259171f},
-std::array<float,2>{0.261913687f, 0.736103594f},
-std::array<float,2>{0.671790957f, 0.610203803f},
-std::array<float,2>{0.484053642f, 0.265120208f},
-std::array<float,2>{0.846950769f, 0.175464034f},
-std::array<float,2>{0.0304504428f, 0.80967778f},
-std::array<float,2>{0.518372178f, 0.840501845f},
-std::array<float,2>{0.322681665f, 0.239674851f},
-std::array<float,2>{0.988198638f, 0.362409145f},
-std::array<float,2>{0.137711242f, 0.529385448f},
-std::array<float,2>{0.751087666f, 0.640134037f},
-std::array<float,2>{0.0965799168f, 0.454978377f},
-std::array<float,2>{0.748892963f, 0.0419784859f},
-std::array<float,2>{0.413069308f, 0.973634422f},
-std::array<float,2>{0.843513489f, 0.751183808f},
-std::array<float,2>{0.0383936055f, 0.150793418f},
-std::array<float,2>{0.642785192f, 0.288290828f},
-std::array<float,2>{0.455597579f, 0.593035996f},
-std::array<float,2>{0.612068892f, 0.715019345f},
-std::array<float,2>{0.292347401f, 0.422084719f},
-std::array<float,2>{0.907376885f, 0.0657664388f},
-std::array<float,2>{0.235521346f, 0.884421229f},
-std::array<float,2>{0.712439835f, 0.943685651f},
-std::array<float,2>{0.380560309f, 0.0227057617f},
-std::array<float,2>{0.809230745f, 0.478561878f},
-std::array<float,2>{0.0869356096f, 0.659103274f},
-std::array<float,2>{0.939690053f, 0.536937952f},
-std::array<float,2>{0.181626767f, 0.320483446f},
-std::array<float,2>{0.548248112f, 0.19674176f},
-std::array<float,2>{0.371252805f, 0.863467634f},
-std::array<float,2>{0.785448492f, 0.991285384f},
-std::array<float,2>{0.0768777207f, 0.0610638633f},
-std::array<float,2>{0.69711858f, 0.446892112f},
-std::array<float,2>{0.400894552f, 0.650492489f},
-std::array<float,2>{0.546399236f, 0.509828866f},
-std::array<float,2>{0.351631969f, 0.344828725f},
-std::array<float,2>{0.966499567f, 0.22798954f},
-std::array<float,2>{0.161626711f, 0.817712724f},
-std::array<float,2>{0.636092186f, 0.795486391f},
-std::array<float,2>{0.447416216f, 0.159283802f},
-std::array<float,2>{0.819737434f, 0.275248557f},
-std::array<float,2>{0.0571062267f, 0.604862988f},
-std::array<float,2>{0.925448f, 0.72451818f},
-std::array<float,2>{0.218927667f, 0.382091999f},
-std::array<float,2>{0.599381566f, 0.116086029f},
-std::array<float,2>{0.302455753f, 0.918957114f},
-std::array<float,2>{0.979634464f, 0.849582791f},
-std::array<float,2>{0.156067654f, 0.214813098f},
-std::array<float,2>{0.51525259f, 0.330172807f},
-std::array<float,2>{0.335588664f, 0.556425631f},
-std::array<float,2>{0.731740892f, 0.684813619f},
-std::array<float,2>{0.426493078f, 0.497000515f},
-std::array<float,2>{0.771996379f, 0.0139783537f},
-std::array<float,2>{0.118204772f, 0.963599384f},
-std::array<float,2>{0.566747785f, 0.905907631f},
-std::array<float,2>{0.275244594f, 0.0822036043f},
-std::array<float,2>{0.889841735f, 0.418150187f},
-std::array<float,2>{0.19632405f, 0.700897753f},
-std::array<float,2>{0.869192839f, 0.568806708f},
-std::array<float,2>{0.00853790808f, 0.303982764f},
-std::array<float,2>{0.673700273f, 0.139058486f},
-std::array<float,2>{0.493057489f, 0.765787244f},
-std::array<float,2>{0.958886087f, 0.959699512f},
-std::array<float,2>{0.166326091f, 0.00348682632f},
-std::array<float,2>{0.536067247f, 0.490514904f},
-std::array<float,2>{0.349256366f, 0.678993762f},
-std::array<float,2>{0.69309479f, 0.550078392f},
-std::array<float,2>{0.395116895f, 0.33920306f},
-std::array<float,2>{0.795435488f, 0.205671653f},
-std::array<float,2>{0.0635921359f, 0.856988072f},
-std::array<float,2>{0.60675925f, 0.777288973f},
-std::array<float,2>{0.31067723f, 0.129846126f},
-std::array<float,2>{0.935010374f, 0.306703627f},
-std::array<float,2>{0.230418518f, 0.576997221f},
-std::array<float,2>{0.823984325f, 0.689148366f},
-std::array<float,2>{0.0470822416f, 0.413202554f},
-std::array<float,2>{0.625077188f, 0.0913572162f},
-std::array<float,2>{0.445254952f, 0.897870123f},
-std::array<float,2>{0.775244892f, 0.827001631f},
-std::array<float,2>{0.109939314f, 0.22643891f},
-std::array<float,2>{0.722401977f, 0.353604078f},
-std::array<float,2>{0.436448425f, 0.505502462f},
-std::array<float,2>{0.505975485f, 0.64080143f},
-std::array<float,2>{0.335990697f, 0.442782879f},
-std::array<float,2>{0.97411108f, 0.0478911847f},
-std::array<float,2>{0.144654378f, 0.993015587f},
-std::array<float,2>{0.683543742f, 0.912921906f},
-std::array<float,2>{0.489466399f, 0.117406964f},
-std::array<float,2>{0.859702229f, 0.389789045f},
-std::array<float,2>{0.00667982968f, 0.734249473f},
-std::array<float,2>{0.879891396f, 0.595037162f},
-std::array<float,2>{0.190809295f, 0.266322553f},
-std::array<float,2>{0.574192643f, 0.168362811f},
-std::array<float,2>{0.2717686f, 0.78903389f},
-std::array<float,2>{0.854914606f, 0.876801491f},
-std::array<float,2>{0.0180525426f, 0.0777339265f},
-std::array<float,2>{0.65728128f, 0.432169586f},
-std::array<float,2>{0.469803095f, 0.706290066f},
-std::array<float,2>{0.591497123f, 0.584087312f},
-std::array<float,2>{0.255655915f, 0.293372691f},
-std::array<float,2>{0.892987311f, 0.147529885f},
-std::array<float,2>{0.205638185f, 0.761125684f},
-std::array<float,2>{0.741263449f, 0.86922431f},
-std::array<float,2>{0.414640456f, 0.194836527f},
-std::array<float,2>{0.760518193f, 0.319605112f},
-std::array<float,2>{0.102117226f, 0.541760564f},
-std::array<float,2>{0.994666815f, 0.665983737f},
-std::array<float,2>{0.130520359f, 0.469610631f},
-std::array<float,2>{0.530470908f, 0.0249775127f},
-std::array<float,2>{0.319516659f, 0.948104441f},
-std::array<float,2>{0.916132689f, 0.800591588f},
-std::array<float,2>{0.247879267f, 0.179895192f},
-std::array<float,2>{0.622521579f, 0.254801631f},
-std::array<float,2>{0.287966311f, 0.624878228f},
-std::array<float,2>{0.651594818f, 0.749228299f},
-std::array<float,2>{0.462095588f, 0.394211233f},
-std::array<float,2>{0.829303145f, 0.107707962f},
-std::array<float,2>{0.0459346808f, 0.930524051f},
-std::array<float,2>{0.560325325f, 0.979061902f},
-std::array<float,2>{0.364697039f, 0.0380773172f},
-std::array<float,2>{0.949617803f, 0.468273371f},
-std::array<float,2>{0.174444899f, 0.628852427f},
-std::array<float,2>{0.801864743f, 0.518201053f},
-std::array<float,2>{0.0845165923f, 0.368764818f},
-std::array<float,2>{0.709717572f, 0.24977687f},
-std::array<float,2>{0.385565758f, 0.835660338f},
-std::array<float,2>{0.945166409f, 0.909281254f},
-std::array<float,2>{0.183881655f, 0.122506008f},
-std::array<float,2>{0.550810039f, 0.385561764f},
-std::array<float,2>{0.368058801f, 0.7279917f},
-std::array<float,2>{0.717450619f, 0.600848675f},
-std::array<float,2>{0.376492292f, 0.270988017f},
-std::array<float,2>{0.808154523f, 0.16600661f},
-std::array<float,2>{0.0917635188f, 0.783167899f},
-std::array<float,2>{0.614044845f, 0.823521733f},
-std::array<float,2>{0.295622379f, 0.221393883f},
-std::array<float,2>{0.912196279f, 0.358705252f},
-std::array<float,2>{0.242072105f, 0.503211021f},
-std::array<float,2>{0.83799547f, 0.647191644f},
-std::array<float,2>{0.0347423665f, 0.440639734f},
-std::array<float,2>{0.645049036f, 0.0538232811f},
-std::array<float,2>{0.460859567f, 0.997341573f},
-std::array<float,2>{0.756442308f, 0.780982554f},
-std::array<float,2>{0.0976861492f, 0.127562597f},
-std::array<float,2>{0.743072033f, 0.310565978f},
-std::array<float,2>{0.409790754f, 0.574027121f},
-std::array<float,2>{0.520737469f, 0.693712294f},
-std::array<float,2>{0.325579643f, 0.40948239f},
-std::array<float,2>{0.991210282f, 0.086908944f},
-std::array<float,2>{0.136188582f, 0.891291678f},
-std::array<float,2>{0.665171802f, 0.956686676f},
-std::array<float,2>{0.478303015f, 0.00675316248f},
-std::array<float,2>{0.850404382f, 0.484398007f},
-std::array<float,2>{0.0272315741f, 0.673614621f},
-std::array<float,2>{0.906041563f, 0.552318394f},
-std::array<float,2>{0.217656583f, 0.342379004f},
-std::array<float,2>{0.58470875f, 0.208112314f},
-std::array<float,2>{0.260959178f, 0.855205417f},
-std::array<float,2>{0.873938084f, 0.982423365f},
-std::array<float,2>{0.0152368648f, 0.0344227701f},
-std::array<float,2>{0.679439068f, 0.460995346f},
-std::array<float,2>{0.496135265f, 0.632791758f},
-std::array<float,2>{0.565182626f, 0.520085037f},
-std::array<float,2>{0.279990345f, 0.374973804f},
-std::array<float,2>{0.884271622f, 0.24303548f},
-std::array<float,2>{0.200795874f, 0.830784678f},
-std::array<float,2>{0.729024589f, 0.803327441f},
-std::array<float,2>{0.422198504f, 0.186624199f},
-std::array<float,2>{0.768102586f, 0.250974685f},
-std::array<float,2>{0.121430598f, 0.617656827f},
-std::array<float,2>{0.98181355f, 0.744273365f},
-std::array<float,2>{0.148885652f, 0.397461116f},
-std::array<float,2>{0.509258926f, 0.10369461f},
-std::array<float,2>{0.330828816f, 0.934914291f},
-std::array<float,2>{0.927994728f, 0.87240839f},
-std::array<float,2>{0.224484131f, 0.189031288f},
-std::array<float,2>{0.59728235f, 0.313788742f},
-std::array<float,2>{0.299249053f, 0.545804083f},
-std::array<float,2>{0.637781799f, 0.671373427f},
-std::array<float,2>{0.452653259f, 0.474980921f},
-std::array<float,2>{0.813646317f, 0.0275546666f},
-std::array<float,2>{0.0611019991f, 0.95073247f},
-std::array<float,2>{0.540647507f, 0.882245362f},
-std::array<float,2>{0.355913937f, 0.0733697489f},
-std::array<float,2>{0.961927354f, 0.435018361f},
-std::array<float,2>{0.156710714f, 0.710163355f},
-std::array<float,2>{0.784783602f, 0.579018712f},
-std::array<float,2>{0.0730390847f, 0.289365828f},
-std::array<float,2>{0.701556146f, 0.143551856f},
-std::array<float,2>{0.405132234f, 0.763492703f},
-std::array<float,2>{0.875551581f, 0.940684378f},
-std::array<float,2>{0.193130225f, 0.0157179702f},
-std::array<float,2>{0.574486732f, 0.483343601f},
-std::array<float,2>{0.267133951f, 0.662692726f},
-std::array<float,2>{0.684108257f, 0.532008052f},
-std::array<float,2>{0.487877518f, 0.326015204f},
-std::array<float,2>{0.863535225f, 0.20075804f},
-std::array<float,2>{0.000599280582f, 0.862206757f},
-std::array<float,2>{0.503164887f, 0.754929364f},
-std::array<float,2>{0.340448797f, 0.152449802f},
-std::array<float,2>{0.972468436f, 0.283931822f},
-std::array<float,2>{0.142228335f, 0.586614192f},
-std::array<float,2>{0.779304802f, 0.711935997f},
-std::array<float,2>{0.116116785f, 0.429446369f},
-std::array<float,2>{0.726088881f, 0.0694214702f},
-std::array<float,2>{0.431159258f, 0.889846385f},
-std::array<float,2>{0.827758431f, 0.837836564f},
-std::array<float,2>{0.0511298776f, 0.234605864f},
-std::array<float,2>{0.632790387f, 0.363784045f},
-std::array<float,2>{0.438552469f, 0.526193202f},
-std::array<float,2>{0.601875722f, 0.636630654f},
-std::array<float,2>{0.308169097f, 0.458053619f},
-std::array<float,2>{0.931780934f, 0.045364026f},
-std::array<float,2>{0.234171674f, 0.970377982f},
-std::array<float,2>{0.69132024f, 0.926989973f},
-std::array<float,2>{0.392433584f, 0.0950223058f},
-std::array<float,2>{0.792119563f, 0.403586775f},
-std::array<float,2>{0.0682554543f, 0.738693118f},
-std::array<float,2>{0.95692718f, 0.61680305f},
-std::array<float,2>{0.168808356f, 0.260701478f},
-std::array<float,2>{0.531856477f, 0.178660616f},
-std::array<float,2>{0.346906424f, 0.806861579f},
-std::array<float,2>{0.799853802f, 0.901539207f},
-std::array<float,2>{0.0786428526f, 0.0794585869f},
-std::array<float,2>{0.704971731f, 0.414582342f},
-std::array<float,2>{0.387530386f, 0.696323335f},
-std::array<float,2>{0.556030154f, 0.564143121f},
-std::array<float,2>{0.363006651f, 0.298483044f},
-std::array<float,2>{0.948767066f, 0.134495631f},
-std::array<float,2>{0.179314226f, 0.77131772f},
-std::array<float,2>{0.654177666f, 0.845781088f},
-std::array<float,2>{0.466766298f, 0.217217952f},
-std::array<float,2>{0.83265996f, 0.335684061f},
-std::array<float,2>{0.0422321185f, 0.561954379f},
-std::array<float,2>{0.92031002f, 0.68087095f},
-std::array<float,2>{0.244982854f, 0.495463252f},
-std::array<float,2>{0.617203772f, 0.00987706985f},
-std::array<float,2>{0.283916712f, 0.968002915f},
-std::array<float,2>{0.997808337f, 0.789140642f},
-std::array<float,2>{0.127162054f, 0.162153527f},
-std::array<float,2>{0.525062084f, 0.28122133f},
-std::array<float,2>{0.314575613f, 0.607121468f},
-std::array<float,2>{0.737245917f, 0.720779598f},
-std::array<float,2>{0.418817371f, 0.375711352f},
-std::array<float,2>{0.763009548f, 0.111952394f},
-std::array<float,2>{0.106953844f, 0.916461945f},
-std::array<float,2>{0.589160442f, 0.987056553f},
-std::array<float,2>{0.252431214f, 0.0553420223f},
-std::array<float,2>{0.897690773f, 0.451349139f},
-std::array<float,2>{0.20885849f, 0.655214787f},
-std::array<float,2>{0.857555628f, 0.514390528f},
-std::array<float,2>{0.0206747893f, 0.348442763f},
-std::array<float,2>{0.661656499f, 0.234334812f},
-std::array<float,2>{0.474942356f, 0.813517511f},
-std::array<float,2>{0.908276558f, 0.885234833f},
-std::array<float,2>{0.237739667f, 0.0641715899f},
-std::array<float,2>{0.610129118f, 0.425469518f},
-std::array<float,2>{0.289624542f, 0.718113244f},
-std::array<float,2>{0.641291499f, 0.591093957f},
-std::array<float,2>{0.453382403f, 0.286959946f},
-std::array<float,2>{0.840695024f, 0.150102645f},
-std::array<float,2>{0.0362949073f, 0.752189457f},
-std::array<float,2>{0.550183535f, 0.865673125f},
-std::array<float,2>{0.373949379f, 0.197851926f},
-std::array<float,2>{0.938699782f, 0.322512299f},
-std::array<float,2>{0.182039812f, 0.538466156f},
-std::array<float,2>{0.811326444f, 0.657178521f},
-std::array<float,2>{0.0886492431f, 0.477626443f},
-std::array<float,2>{0.713293195f, 0.0213690046f},
-std::array<float,2>{0.382719368f, 0.942849219f},
-std::array<float,2>{0.845247209f, 0.811086655f},
-std::array<float,2>{0.0276263095f, 0.172912136f},
-std::array<float,2>{0.668193936f, 0.263025969f},
-std::array<float,2>{0.480830491f, 0.611329317f},
-std::array<float,2>{0.579541862f, 0.737831771f},
-std::array<float,2>{0.265022188f, 0.400331229f},
-std::array<float,2>{0.899783075f, 0.101371385f},
-std::array<float,2>{0.213828012f, 0.924440145f},
-std::array<float,2>{0.747903287f, 0.974616766f},
-std::array<float,2>{0.411745459f, 0.0390696079f},
-std::array<float,2>{0.752731204f, 0.45580548f},
-std::array<float,2>{0.0944792554f, 0.636891067f},
-std::array<float,2>{0.985564947f, 0.527666211f},
-std::array<float,2>{0.1404019f, 0.360509038f},
-std::array<float,2>{0.517533183f, 0.240390897f},
-std::array<float,2>{0.321325481f, 0.843603909f},
-std::array<float,2>{0.769585252f, 0.961555243f},
-std::array<float,2>{0.120209314f, 0.0129976962f},
-std::array<float,2>{0.734221518f, 0.499335349f},
-std::array<float,2>{0.428553253f, 0.686903656f},
-std::array<float,2>{0.513054788f, 0.558307767f},
-std::array<float,2>{0.333298475f, 0.329485863f},
-std::array<float,2>{0.976805747f, 0.211528882f},
-std::array<float,2>{0.153071553f, 0.851014912f},
-std::array<float,2>{0.674104154f, 0.768004835f},
-std::array<float,2>{0.495420784f, 0.136878625f},
-std::array<float,2>{0.867578208f, 0.300912261f},
-std::array<float,2>{0.011664426f, 0.56834048f},
-std::array<float,2>{0.888493776f, 0.701763928f},
-std::array<float,2>{0.199093968f, 0.420358717f},
-std::array<float,2>{0.5700562f, 0.0854787678f},
-std::array<float,2>{0.276113331f, 0.903267324f},
-std::array<float,2>{0.967140555f, 0.819689929f},
-std::array<float,2>{0.162737131f, 0.230207905f},
-std::array<float,2>{0.543360174f, 0.347574145f},
-std::array<float,2>{0.354013652f, 0.509478211f},
-std::array<float,2>{0.698041499f, 0.649234712f},
-std::array<float,2>{0.400184602f, 0.447869182f},
-std::array<float,2>{0.788457751f, 0.059471447f},
-std::array<float,2>{0.0742274895f, 0.988757432f},
-std::array<float,2>{0.599821508f, 0.921028256f},
-std::array<float,2>{0.303443789f, 0.113452725f},
-std::array<float,2>{0.923808515f, 0.379228085f},
-std::array<float,2>{0.222240925f, 0.725722194f},
-std::array<float,2>{0.818097293f, 0.602634311f},
-std::array<float,2>{0.0557259284f, 0.277118504f},
-std::array<float,2>{0.634177744f, 0.156338423f},
-std::array<float,2>{0.446577489f, 0.794687808f},
-std::array<float,2>{0.975968122f, 0.994500875f},
-std::array<float,2>{0.147810936f, 0.0501266867f},
-std::array<float,2>{0.505648613f, 0.44375965f},
-std::array<float,2>{0.338701338f, 0.643739522f},
-std::array<float,2>{0.720070779f, 0.506948769f},
-std::array<float,2>{0.434972405f, 0.353426665f},
-std::array<float,2>{0.775930703f, 0.223697409f},
-std::array<float,2>{0.11240457f, 0.825582147f},
-std::array<float,2>{0.571641386f, 0.785189509f},
-std::array<float,2>{0.270187348f, 0.170116022f},
-std::array<float,2>{0.882552743f, 0.268572122f},
-std::array<float,2>{0.188452959f, 0.595774591f},
-std::array<float,2>{0.861543f, 0.732396722f},
-std::array<float,2>{0.00530545833f, 0.387013286f},
-std::array<float,2>{0.680211365f, 0.119314849f},
-std::array<float,2>{0.491648525f, 0.911862016f},
-std::array<float,2>{0.793943286f, 0.858336568f},
-std::array<float,2>{0.0647302493f, 0.204425722f},
-std::array<float,2>{0.69397825f, 0.336251229f},
-std::array<float,2>{0.396695733f, 0.547818005f},
-std::array<float,2>{0.537637889f, 0.675846696f},
-std::array<float,2>{0.350379199f, 0.488732576f},
-std::array<float,2>{0.960284889f, 0.000565685099f},
-std::array<float,2>{0.164487109f, 0.958320498f},
-std::array<float,2>{0.628570378f, 0.896171093f},
-std::array<float,2>{0.443050951f, 0.0928445235f},
-std::array<float,2>{0.821394563f, 0.411403239f},
-std::array<float,2>{0.0504386351f, 0.690995097f},
-std::array<float,2>{0.937362432f, 0.575058639f},
-std::array<float,2>{0.228366867f, 0.304856837f},
-std::array<float,2>{0.608565748f, 0.131258801f},
-std::array<float,2>{0.31051904f, 0.774956763f},
-std::array<float,2>{0.830659866f, 0.932730913f},
-std::array<float,2>{0.0439395718f, 0.106303126f},
-std::array<float,2>{0.648638785f, 0.390803218f},
-std::array<float,2>{0.463019788f, 0.747984409f},
-std::array<float,2>{0.62373203f, 0.622486949f},
-std::array<float,2>{0.286534488f, 0.257065833f},
-std::array<float,2>{0.914605379f, 0.182355404f},
-std::array<float,2>{0.248737887f, 0.797963858f},
-std::array<float,2>{0.707178354f, 0.833762705f},
-std::array<float,2>{0.383829206f, 0.246312648f},
-std::array<float,2>{0.803785384f, 0.369166344f},
-std::array<float,2>{0.082369931f, 0.516498208f},
-std::array<float,2>{0.952410221f, 0.62512356f},
-std::array<float,2>{0.173025593f, 0.466623694f},
-std::array<float,2>{0.561710596f, 0.036147438f},
-std::array<float,2>{0.365400165f, 0.977952361f},
-std::array<float,2>{0.891601682f, 0.759076655f},
-std::array<float,2>{0.204814166f, 0.144711897f},
-std::array<float,2>{0.592733622f, 0.29613325f},
-std::array<float,2>{0.257354528f, 0.582368195f},
-std::array<float,2>{0.658617318f, 0.7042256f},
-std::array<float,2>{0.472433716f, 0.43108663f},
-std::array<float,2>{0.851711571f, 0.0752064511f},
-std::array<float,2>{0.0174051113f, 0.877293706f},
-std::array<float,2>{0.528442264f, 0.946339071f},
-std::array<float,2>{0.317465663f, 0.0272010583f},
-std::array<float,2>{0.993542492f, 0.470857114f},
-std::array<float,2>{0.132672369f, 0.666895449f},
-std::array<float,2>{0.758667469f, 0.540741086f},
-std::array<float,2>{0.104879446f, 0.318310976f},
-std::array<float,2>{0.739125073f, 0.192862898f},
-std::array<float,2>{0.417836785f, 0.868554652f},
-std::array<float,2>{0.983460009f, 0.9345119f},
-std::array<float,2>{0.150396451f, 0.105194904f},
-std::array<float,2>{0.511370182f, 0.397122175f},
-std::array<float,2>{0.329127103f, 0.745132983f},
-std::array<float,2>{0.727951527f, 0.618455708f},
-std::array<float,2>{0.425654858f, 0.251754075f},
-std::array<float,2>{0.76724726f, 0.186215788f},
-std::array<float,2>{0.124660403f, 0.804681599f},
-std::array<float,2>{0.563417077f, 0.831338882f},
-std::array<float,2>{0.278522253f, 0.24357833f},
-std::array<float,2>{0.886397302f, 0.373070449f},
-std::array<float,2>{0.202528059f, 0.520649135f},
-std::array<float,2>{0.871992707f, 0.63116312f},
-std::array<float,2>{0.0130143641f, 0.46253255f},
-std::array<float,2>{0.677290857f, 0.0338746272f},
-std::array<float,2>{0.498093545f, 0.98388207f},
-std::array<float,2>{0.782646716f, 0.762075663f},
-std::array<float,2>{0.0714005679f, 0.143810123f},
-std::array<float,2>{0.699563563f, 0.290341258f},
-std::array<float,2>{0.402489156f, 0.579672992f},
-std::array<float,2>{0.541512072f, 0.70950824f},
-std::array<float,2>{0.358504117f, 0.433719546f},
-std::array<float,2>{0.963686526f, 0.0723283142f},
-std::array<float,2>{0.159601942f, 0.881536961f},
-std::array<float,2>{0.639206529f, 0.949795365f},
-std::array<float,2>{0.449497104f, 0.0288718194f},
-std::array<float,2>{0.815420866f, 0.476029158f},
-std::array<float,2>{0.0591271259f, 0.67020303f},
-std::array<float,2>{0.927571237f, 0.546786308f},
-std::array<float,2>{0.22630994f, 0.312696517f},
-std::array<float,2>{0.59516871f, 0.187516674f},
-std::array<float,2>{0.297733963f, 0.871655405f},
-std::array<float,2>{0.836210728f, 0.996166646f},
-std::array<float,2>{0.0317586139f, 0.0530347079f},
-std::array<float,2>{0.647506297f, 0.439883679f},
-std::array<float,2>{0.458807915f, 0.647803128f},
-std::array<float,2>{0.616325796f, 0.50272882f},
-std::array<float,2>{0.294538707f, 0.357818663f},
-std::array<float,2>{0.912100732f, 0.222424224f},
-std::array<float,2>{0.238999695f, 0.822966456f},
-std::array<float,2>{0.715673566f, 0.781697571f},
-std::array<float,2>{0.377753377f, 0.16495733f},
-std::array<float,2>{0.804838717f, 0.269569963f},
-std::array<float,2>{0.0922986269f, 0.600504994f},
-std::array<float,2>{0.941506565f, 0.72681725f},
-std::array<float,2>{0.18698296f, 0.386533469f},
-std::array<float,2>{0.55320847f, 0.121614844f},
-std::array<float,2>{0.370502889f, 0.908368945f},
-std::array<float,2>{0.903916121f, 0.854483485f},
-std::array<float,2>{0.215698987f, 0.207917303f},
-std::array<float,2>{0.583499312f, 0.343252361f},
-std::array<float,2>{0.258768469f, 0.551470876f},
-std::array<float,2>{0.667594731f, 0.672026098f},
-std::array<float,2>{0.47902143f, 0.485640883f},
-std::array<float,2>{0.848241925f, 0.0074504409f},
-std::array<float,2>{0.0240632929f, 0.955247164f},
-std::array<float,2>{0.523026764f, 0.891648054f},
-std::array<float,2>{0.326268524f, 0.0875927731f},
-std::array<float,2>{0.988386333f, 0.408381075f},
-std::array<float,2>{0.134053573f, 0.694381356f},
-std::array<float,2>{0.754004121f, 0.572502553f},
-std::array<float,2>{0.101560108f, 0.312282115f},
-std::array<float,2>{0.744694948f, 0.128122032f},
-std::array<float,2>{0.408051372f, 0.779655278f},
-std::array<float,2>{0.919001997f, 0.967163861f},
-std::array<float,2>{0.243889093f, 0.0107555455f},
-std::array<float,2>{0.619508028f, 0.49430567f},
-std::array<float,2>{0.283005953f, 0.680548072f},
-std::array<float,2>{0.655719876f, 0.5607602f},
-std::array<float,2>{0.467641294f, 0.334100723f},
-std::array<float,2>{0.835447848f, 0.218166262f},
-std::array<float,2>{0.0397943258f, 0.846730173f},
-std::array<float,2>{0.557094276f, 0.76972115f},
-std::array<float,2>{0.361243457f, 0.133669972f},
-std::array<float,2>{0.946666777f, 0.297810674f},
-std::array<float,2>{0.176784053f, 0.562866211f},
-std::array<float,2>{0.798533261f, 0.695983827f},
-std::array<float,2>{0.080966413f, 0.415743351f},
-std::array<float,2>{0.705421925f, 0.0791013017f},
-std::array<float,2>{0.389954329f, 0.900853634f},
-std::array<float,2>{0.856296122f, 0.813229799f},
-std::array<float,2>{0.0230001938f, 0.232786164f},
-std::array<float,2>{0.662919879f, 0.348673016f},
-std::array<float,2>{0.473084062f, 0.515079021f},
-std::array<float,2>{0.586000383f, 0.656175137f},
-std::array<float,2>{0.251399547f, 0.453033686f},
-std::array<float,2>{0.896380067f, 0.0566282682f},
-std::array<float,2>{0.210278943f, 0.987661183f},
-std::array<float,2>{0.735321701f, 0.917591453f},
-std::array<float,2>{0.420772135f, 0.112909004f},
-std::array<float,2>{0.765499711f, 0.37682879f},
-std::array<float,2>{0.108197637f, 0.722519755f},
-std::array<float,2>{0.99946779f, 0.605803549f},
-std::array<float,2>{0.125583515f, 0.280168891f},
-std::array<float,2>{0.526009202f, 0.163372606f},
-std::array<float,2>{0.313052386f, 0.790127933f},
-std::array<float,2>{0.778587759f, 0.888984144f},
-std::array<float,2>{0.115094364f, 0.0686368793f},
-std::array<float,2>{0.723714709f, 0.428515077f},
-std::array<float,2>{0.433333218f, 0.711541891f},
-std::array<float,2>{0.501528382f, 0.586958706f},
-std::array<float,2>{0.342164099f, 0.284684181f},
-std::array<float,2>{0.970115602f, 0.153844923f},
-std::array<float,2>{0.142754346f, 0.754451513f},
-std::array<float,2>{0.685848475f, 0.863187134f},
-std::array<float,2>{0.48456347f, 0.199956983f},
-std::array<float,2>{0.865808785f, 0.324587941f},
-std::array<float,2>{0.00267491187f, 0.532612026f},
-std::array<float,2>{0.877488613f, 0.663406551f},
-std::array<float,2>{0.193969846f, 0.483428478f},
-std::array<float,2>{0.576871037f, 0.0171091463f},
-std::array<float,2>{0.268604249f, 0.939805627f},
-std::array<float,2>{0.953882635f, 0.807832062f},
-std::array<float,2>{0.171748415f, 0.179099455f},
-std::array<float,2>{0.533587098f, 0.261135072f},
-std::array<float,2>{0.345470339f, 0.615829349f},
-std::array<float,2>{0.689272821f, 0.739411592f},
-std::array<float,2>{0.393007159f, 0.402793705f},
-std::array<float,2>{0.789254248f, 0.0941534117f},
-std::array<float,2>{0.0696619749f, 0.926168084f},
-std::array<float,2>{0.604783237f, 0.969603658f},
-std::array<float,2>{0.30554384f, 0.0461072475f},
-std::array<float,2>{0.931638181f, 0.457755595f},
-std::array<float,2>{0.230997995f, 0.634972215f},
-std::array<float,2>{0.824963748f, 0.527182043f},
-std::array<float,2>{0.0531212576f, 0.364892989f},
-std::array<float,2>{0.630469739f, 0.23545447f},
-std::array<float,2>{0.439477861f, 0.836606324f},
-std::array<float,2>{0.888675153f, 0.904227257f},
-std::array<float,2>{0.195527881f, 0.0841518641f},
-std::array<float,2>{0.568075657f, 0.421297491f},
-std::array<float,2>{0.273926556f, 0.702989697f},
-std::array<float,2>{0.672331333f, 0.567161441f},
-std::array<float,2>{0.493402123f, 0.302095234f},
-std::array<float,2>{0.870355427f, 0.138601437f},
-std::array<float,2>{0.00948419049f, 0.768803895f},
-std::array<float,2>{0.514246702f, 0.849817932f},
-std::array<float,2>{0.334629118f, 0.212118313f},
-std::array<float,2>{0.978679121f, 0.328700364f},
-std::array<float,2>{0.154774889f, 0.557531238f},
-std::array<float,2>{0.773029923f, 0.686007619f},
-std::array<float,2>{0.117197111f, 0.498778403f},
-std::array<float,2>{0.731440783f, 0.0119754355f},
-std::array<float,2>{0.427144349f, 0.962856174f},
-std::array<float,2>{0.818957806f, 0.793051124f},
-std::array<float,2>{0.0584718175f, 0.1574779f},
-std::array<float,2>{0.635628879f, 0.276325434f},
-std::array<float,2>{0.44868511f, 0.60195601f},
-std::array<float,2>{0.597999454f, 0.725402832f},
-std::array<float,2>{0.301486284f, 0.379884958f},
-std::array<float,2>{0.924664319f, 0.114528306f},
-std::array<float,2>{0.219845578f, 0.92051363f},
-std::array<float,2>{0.696074665f, 0.989895582f},
-std::array<float,2>{0.401872873f, 0.0600418262f},
-std::array<float,2>{0.786592424f, 0.448622853f},
-std::array<float,2>{0.0776598826f, 0.649675965f},
-std::array<float,2>{0.964885235f, 0.508203924f},
-std::array<float,2>{0.160397962f, 0.346378058f},
-std::array<float,2>{0.545289397f, 0.228706926f},
-std::array<float,2>{0.352782935f, 0.818902254f},
-std::array<float,2>{0.809760988f, 0.941722035f},
-std::array<float,2>{0.0860596374f, 0.0203278642f},
-std::array<float,2>{0.711520493f, 0.477154642f},
-std::array<float,2>{0.379823446f, 0.657607138f},
-std::array<float,2>{0.547271967f, 0.538021266f},
-std::array<float,2>{0.372624487f, 0.32412681f},
-std::array<float,2>{0.94084096f, 0.199168459f},
-std::array<float,2>{0.180023864f, 0.866446972f},
-std::array<float,2>{0.644152284f, 0.752985358f},
-std::array<float,2>{0.456737369f, 0.148576066f},
-std::array<float,2>{0.84236902f, 0.285774648f},
-std::array<float,2>{0.0375895835f, 0.590476036f},
-std::array<float,2>{0.906907499f, 0.717394412f},
-std::array<float,2>{0.235134572f, 0.424468309f},
-std::array<float,2>{0.612603724f, 0.0630822703f},
-std::array<float,2>{0.291194826f, 0.885904312f},
-std::array<float,2>{0.986965001f, 0.842698812f},
-std::array<float,2>{0.137602851f, 0.242057368f},
-std::array<float,2>{0.519013286f, 0.35981217f},
-std::array<float,2>{0.323585778f, 0.52872777f},
-std::array<float,2>{0.749302626f, 0.638293564f},
-std::array<float,2>{0.413999289f, 0.456678629f},
-std::array<float,2>{0.750676632f, 0.0401227996f},
-std::array<float,2>{0.0976277664f, 0.97613436f},
-std::array<float,2>{0.580589354f, 0.925700128f},
-std::array<float,2>{0.263596773f, 0.10052038f},
-std::array<float,2>{0.901673377f, 0.399297416f},
-std::array<float,2>{0.212759554f, 0.736976743f},
-std::array<float,2>{0.845977187f, 0.612948179f},
-std::array<float,2>{0.0302180257f, 0.262315452f},
-std::array<float,2>{0.670851171f, 0.171989307f},
-std::array<float,2>{0.483217865f, 0.811767876f},
-std::array<float,2>{0.950349748f, 0.977073371f},
-std::array<float,2>{0.175584152f, 0.0351785235f},
-std::array<float,2>{0.558749378f, 0.465070128f},
-std::array<float,2>{0.364252567f, 0.626556337f},
-std::array<float,2>{0.710701048f, 0.517447054f},
-std::array<float,2>{0.386242867f, 0.370395452f},
-std::array<float,2>{0.801656306f, 0.247271806f},
-std::array<float,2>{0.0855142474f, 0.832921505f},
-std::array<float,2>{0.62180388f, 0.797350824f},
-std::array<float,2>{0.288512945f, 0.183108374f},
-std::array<float,2>{0.917364001f, 0.256228447f},
-std::array<float,2>{0.246795401f, 0.621915758f},
-std::array<float,2>{0.829015672f, 0.746687949f},
-std::array<float,2>{0.0450579077f, 0.392575443f},
-std::array<float,2>{0.65109694f, 0.106529601f},
-std::array<float,2>{0.461367667f, 0.932610869f},
-std::array<float,2>{0.760944843f, 0.867886603f},
-std::array<float,2>{0.102787763f, 0.19212313f},
-std::array<float,2>{0.740705073f, 0.316836387f},
-std::array<float,2>{0.415982902f, 0.539787531f},
-std::array<float,2>{0.530051112f, 0.667579651f},
-std::array<float,2>{0.318495482f, 0.472132593f},
-std::array<float,2>{0.995819271f, 0.0262263604f},
-std::array<float,2>{0.129485264f, 0.945661724f},
-std::array<float,2>{0.656314313f, 0.878279269f},
-std::array<float,2>{0.46914503f, 0.0743216425f},
-std::array<float,2>{0.854105175f, 0.430216581f},
-std::array<float,2>{0.0186803322f, 0.704057455f},
-std::array<float,2>{0.894163072f, 0.583790481f},
-std::array<float,2>{0.206117138f, 0.295281321f},
-std::array<float,2>{0.59000057f, 0.146148711f},
-std::array<float,2>{0.253938437f, 0.758695781f},
-std::array<float,2>{0.860713542f, 0.910868406f},
-std::array<float,2>{0.00714395847f, 0.120328128f},
-std::array<float,2>{0.68188113f, 0.388390779f},
-std::array<float,2>{0.48838985f, 0.73090297f},
-std::array<float,2>{0.573017418f, 0.597560048f},
-std::array<float,2>{0.272511542f, 0.26783365f},
-std::array<float,2>{0.879656136f, 0.171310931f},
-std::array<float,2>{0.19011417f, 0.787075937f},
-std::array<float,2>{0.72167927f, 0.824680984f},
-std::array<float,2>{0.437052101f, 0.223593444f},
-std::array<float,2>{0.774118543f, 0.351564705f},
-std::array<float,2>{0.110459283f, 0.50589931f},
-std::array<float,2>{0.973459244f, 0.643248498f},
-std::array<float,2>{0.146289662f, 0.44446817f},
-std::array<float,2>{0.507662237f, 0.0495867394f},
-std::array<float,2>{0.337734163f, 0.995646715f},
-std::array<float,2>{0.934090555f, 0.774360716f},
-std::array<float,2>{0.228731632f, 0.132389143f},
-std::array<float,2>{0.606125116f, 0.306344032f},
-std::array<float,2>{0.312043339f, 0.575455844f},
-std::array<float,2>{0.626678288f, 0.690247476f},
-std::array<float,2>{0.444165498f, 0.411046445f},
-std::array<float,2>{0.822767377f, 0.0925630033f},
-std::array<float,2>{0.0481460132f, 0.894698501f},
-std::array<float,2>{0.536993146f, 0.95747745f},
-std::array<float,2>{0.348248869f, 0.00107539655f},
-std::array<float,2>{0.957681775f, 0.49021104f},
-std::array<float,2>{0.1678904f, 0.676986635f},
-std::array<float,2>{0.79606235f, 0.548321247f},
-std::array<float,2>{0.0633539185f, 0.336952597f},
-std::array<float,2>{0.692031384f, 0.203552783f},
-std::array<float,2>{0.39584285f, 0.858584106f},
-std::array<float,2>{0.960961878f, 0.879273772f},
-std::array<float,2>{0.15734978f, 0.0719394088f},
-std::array<float,2>{0.539851487f, 0.435896099f},
-std::array<float,2>{0.356710732f, 0.707259238f},
-std::array<float,2>{0.702953339f, 0.580691874f},
-std::array<float,2>{0.405756354f, 0.291278571f},
-std::array<float,2>{0.783757865f, 0.141039982f},
-std::array<float,2>{0.0741953775f, 0.765451014f},
-std::array<float,2>{0.596196175f, 0.874584138f},
-std::array<float,2>{0.300776422f, 0.190988496f},
-std::array<float,2>{0.929230332f, 0.316250533f},
-std::array<float,2>{0.22284767f, 0.544752657f},
-std::array<float,2>{0.813428521f, 0.66905725f},
-std::array<float,2>{0.0619029552f, 0.473229706f},
-std::array<float,2>{0.63723892f, 0.0293314718f},
-std::array<float,2>{0.451998234f, 0.952537835f},
-std::array<float,2>{0.76893878f, 0.801615953f},
-std::array<float,2>{0.122498728f, 0.183949381f},
-std::array<float,2>{0.730031252f, 0.253426701f},
-std::array<float,2>{0.423172951f, 0.619582653f},
-std::array<float,2>{0.508214235f, 0.743484676f},
-std::array<float,2>{0.331323802f, 0.395083785f},
-std::array<float,2>{0.981148422f, 0.102394231f},
-std::array<float,2>{0.149906412f, 0.936429262f},
-std::array<float,2>{0.678026259f, 0.981099784f},
-std::array<float,2>{0.497375458f, 0.0323326029f},
-std::array<float,2>{0.874593854f, 0.462934852f},
-std::array<float,2>{0.014573724f, 0.630634069f},
-std::array<float,2>{0.883674622f, 0.52214545f},
-std::array<float,2>{0.199330822f, 0.372745454f},
-std::array<float,2>{0.565465748f, 0.246082708f},
-std::array<float,2>{0.28112179f, 0.829503894f},
-std::array<float,2>{0.851548314f, 0.953520238f},
-std::array<float,2>{0.0257643927f, 0.00553870015f},
-std::array<float,2>{0.664357841f, 0.486797154f},
-std::array<float,2>{0.477338791f, 0.674147964f},
-std::array<float,2>{0.585140288f, 0.554559946f},
-std::array<float,2>{0.260200858f, 0.340576261f},
-std::array<float,2>{0.904493749f, 0.209231898f},
-std::array<float,2>{0.218316779f, 0.852374613f},
-std::array<float,2>{0.743462324f, 0.777506888f},
-std::array<float,2>{0.409056693f, 0.125344664f},
-std::array<float,2>{0.757691383f, 0.308615237f},
-std::array<float,2>{0.0995073542f, 0.571235418f},
-std::array<float,2>{0.991900146f, 0.69183141f},
-std::array<float,2>{0.13521333f, 0.406532109f},
-std::array<float,2>{0.519830704f, 0.088004075f},
-std::array<float,2>{0.324415207f, 0.893062413f},
-std::array<float,2>{0.913202405f, 0.821495354f},
-std::array<float,2>{0.240546718f, 0.220231161f},
-std::array<float,2>{0.61485976f, 0.35670194f},
-std::array<float,2>{0.295984775f, 0.500964701f},
-std::array<float,2>{0.645671308f, 0.645590365f},
-std::array<float,2>{0.459728032f, 0.438955635f},
-std::array<float,2>{0.839226127f, 0.0520409122f},
-std::array<float,2>{0.0336179063f, 0.99827534f},
-std::array<float,2>{0.551788926f, 0.906905532f},
-std::array<float,2>{0.368280441f, 0.124879166f},
-std::array<float,2>{0.943889797f, 0.384205163f},
-std::array<float,2>{0.185530663f, 0.730403602f},
-std::array<float,2>{0.806872845f, 0.598059177f},
-std::array<float,2>{0.0907695368f, 0.272695512f},
-std::array<float,2>{0.718106389f, 0.167140096f},
-std::array<float,2>{0.375521123f, 0.784994066f},
-std::array<float,2>{0.897027969f, 0.986120522f},
-std::array<float,2>{0.207999989f, 0.0568392314f},
-std::array<float,2>{0.588820755f, 0.450431913f},
-std::array<float,2>{0.253089517f, 0.652718425f},
-std::array<float,2>{0.660324752f, 0.512356222f},
-std::array<float,2>{0.476280332f, 0.349820077f},
-std::array<float,2>{0.858745575f, 0.231289089f},
-std::array<float,2>{0.0195770264f, 0.815714061f},
-std::array<float,2>{0.523706377f, 0.791054904f},
-std::array<float,2>{0.315834731f, 0.160874307f},
-std::array<float,2>{0.996926367f, 0.278921455f},
-std::array<float,2>{0.12826322f, 0.609062076f},
-std::array<float,2>{0.762134254f, 0.71922034f},
-std::array<float,2>{0.105544001f, 0.377132475f},
-std::array<float,2>{0.738251746f, 0.10953667f},
-std::array<float,2>{0.418953568f, 0.91594249f},
-std::array<float,2>{0.833146453f, 0.845070124f},
-std::array<float,2>{0.0416745134f, 0.215405524f},
-std::array<float,2>{0.653149426f, 0.332365215f},
-std::array<float,2>{0.465155274f, 0.560244441f},
-std::array<float,2>{0.618465662f, 0.682041824f},
-std::array<float,2>{0.285046518f, 0.492465943f},
-std::array<float,2>{0.921156704f, 0.00962399505f},
-std::array<float,2>{0.245120138f, 0.966203094f},
-std::array<float,2>{0.703444719f, 0.900104523f},
-std::array<float,2>{0.388303816f, 0.0814387053f},
-std::array<float,2>{0.799452901f, 0.416398674f},
-std::array<float,2>{0.0794118196f, 0.69726783f},
-std::array<float,2>{0.947617948f, 0.564507127f},
-std::array<float,2>{0.178358242f, 0.299397081f},
-std::array<float,2>{0.555096269f, 0.135811031f},
-std::array<float,2>{0.361874193f, 0.773246169f},
-std::array<float,2>{0.791692317f, 0.929408014f},
-std::array<float,2>{0.0671807826f, 0.0966981351f},
-std::array<float,2>{0.690144837f, 0.405169249f},
-std::array<float,2>{0.391210049f, 0.740332723f},
-std::array<float,2>{0.533060849f, 0.615155578f},
-std::array<float,2>{0.346604675f, 0.257929832f},
-std::array<float,2>{0.955943286f, 0.175926417f},
-std::array<float,2>{0.169287711f, 0.80552268f},
-std::array<float,2>{0.631752014f, 0.839491963f},
-std::array<float,2>{0.437959939f, 0.237950057f},
-std::array<float,2>{0.826291382f, 0.366341442f},
-std::array<float,2>{0.0526074879f, 0.523451686f},
-std::array<float,2>{0.93331778f, 0.633028984f},
-std::array<float,2>{0.232921407f, 0.459571302f},
-std::array<float,2>{0.602891505f, 0.0434545167f},
-std::array<float,2>{0.306911826f, 0.971761703f},
-std::array<float,2>{0.971342623f, 0.757557929f},
-std::array<float,2>{0.141023248f, 0.155664131f},
-std::array<float,2>{0.502131462f, 0.282010734f},
-std::array<float,2>{0.341008216f, 0.588883936f},
-std::array<float,2>{0.725182891f, 0.714730799f},
-std::array<float,2>{0.4304654f, 0.42621547f},
-std::array<float,2>{0.780673087f, 0.0682643801f},
-std::array<float,2>{0.116878472f, 0.887591362f},
-std::array<float,2>{0.575443149f, 0.939083993f},
-std::array<float,2>{0.26613456f, 0.0183251761f},
-std::array<float,2>{0.876120865f, 0.480791479f},
-std::array<float,2>{0.191448331f, 0.66095525f},
-std::array<float,2>{0.865150034f, 0.534116209f},
-std::array<float,2>{0.00105998968f, 0.326611429f},
-std::array<float,2>{0.685097992f, 0.203089431f},
-std::array<float,2>{0.48643738f, 0.859437346f},
-std::array<float,2>{0.922228992f, 0.918338478f},
-std::array<float,2>{0.221431419f, 0.116682984f},
-std::array<float,2>{0.600791156f, 0.380974263f},
-std::array<float,2>{0.304022968f, 0.723578632f},
-std::array<float,2>{0.633760452f, 0.603696883f},
-std::array<float,2>{0.445978016f, 0.274053693f},
-std::array<float,2>{0.816665053f, 0.158960685f},
-std::array<float,2>{0.0550140589f, 0.796499014f},
-std::array<float,2>{0.544909179f, 0.816702425f},
-std::array<float,2>{0.355339617f, 0.226848826f},
-std::array<float,2>{0.968115747f, 0.344207764f},
-std::array<float,2>{0.163351327f, 0.511112988f},
-std::array<float,2>{0.787325382f, 0.6521824f},
-std::array<float,2>{0.0758916512f, 0.445966989f},
-std::array<float,2>{0.69899404f, 0.0615609623f},
-std::array<float,2>{0.398615599f, 0.991093755f},
-std::array<float,2>{0.868487716f, 0.766713262f},
-std::array<float,2>{0.0100617902f, 0.140144318f},
-std::array<float,2>{0.675490677f, 0.303403765f},
-std::array<float,2>{0.494986147f, 0.570224226f},
-std::array<float,2>{0.569126129f, 0.70010972f},
-std::array<float,2>{0.276831269f, 0.419537365f},
-std::array<float,2>{0.8871364f, 0.0836619809f},
-std::array<float,2>{0.1981121f, 0.904503942f},
-std::array<float,2>{0.73299253f, 0.964787483f},
-std::array<float,2>{0.429187655f, 0.0153399073f},
-std::array<float,2>{0.771393597f, 0.497579008f},
-std::array<float,2>{0.11955563f, 0.684134185f},
-std::array<float,2>{0.977991104f, 0.554964781f},
-std::array<float,2>{0.153923422f, 0.331634969f},
-std::array<float,2>{0.511784971f, 0.213538557f},
-std::array<float,2>{0.332264811f, 0.848619342f},
-std::array<float,2>{0.752958059f, 0.97300148f},
-std::array<float,2>{0.0951485485f, 0.0422113165f},
-std::array<float,2>{0.746918261f, 0.453499049f},
-std::array<float,2>{0.410903364f, 0.639441848f},
-std::array<float,2>{0.516152024f, 0.530633986f},
-std::array<float,2>{0.320471555f, 0.362209082f},
-std::array<float,2>{0.984913945f, 0.23913528f},
-std::array<float,2>{0.139398858f, 0.841687083f},
-std::array<float,2>{0.669430017f, 0.808683515f},
-std::array<float,2>{0.481921524f, 0.174769476f},
-std::array<float,2>{0.843925714f, 0.264270633f},
-std::array<float,2>{0.0290639903f, 0.611090779f},
-std::array<float,2>{0.898989916f, 0.735055685f},
-std::array<float,2>{0.214500338f, 0.400883108f},
-std::array<float,2>{0.579033852f, 0.0977542996f},
-std::array<float,2>{0.264527649f, 0.923447609f},
-std::array<float,2>{0.938014269f, 0.864419818f},
-std::array<float,2>{0.18334128f, 0.196187571f},
-std::array<float,2>{0.549385071f, 0.321411401f},
-std::array<float,2>{0.374506831f, 0.53540951f},
-std::array<float,2>{0.713994384f, 0.65922153f},
-std::array<float,2>{0.380983323f, 0.479577482f},
-std::array<float,2>{0.811843216f, 0.0221814979f},
-std::array<float,2>{0.0897516161f, 0.94454354f},
-std::array<float,2>{0.610449851f, 0.883575201f},
-std::array<float,2>{0.290501595f, 0.0648390651f},
-std::array<float,2>{0.909813762f, 0.42302832f},
-std::array<float,2>{0.236699879f, 0.716619074f},
-std::array<float,2>{0.841494322f, 0.592117488f},
-std::array<float,2>{0.0353925973f, 0.287229031f},
-std::array<float,2>{0.642073214f, 0.151434049f},
-std::array<float,2>{0.454693288f, 0.750965595f},
-std::array<float,2>{0.992962539f, 0.94838661f},
-std::array<float,2>{0.131385729f, 0.0236351993f},
-std::array<float,2>{0.527537644f, 0.469989777f},
-std::array<float,2>{0.317156076f, 0.66463083f},
-std::array<float,2>{0.740148127f, 0.542282879f},
-std::array<float,2>{0.416218489f, 0.319120556f},
-std::array<float,2>{0.759190917f, 0.193942726f},
-std::array<float,2>{0.104066379f, 0.870863616f},
-std::array<float,2>{0.593355715f, 0.76037544f},
-std::array<float,2>{0.256499499f, 0.147158891f},
-std::array<float,2>{0.890658975f, 0.294260114f},
-std::array<float,2>{0.204084754f, 0.585746109f},
-std::array<float,2>{0.852682412f, 0.705864072f},
-std::array<float,2>{0.0162466448f, 0.433081269f},
-std::array<float,2>{0.659446716f, 0.0763531402f},
-std::array<float,2>{0.471189678f, 0.875017405f},
-std::array<float,2>{0.803093493f, 0.834742844f},
-std::array<float,2>{0.0839147866f, 0.248691484f},
-std::array<float,2>{0.7080217f, 0.368141145f},
-std::array<float,2>{0.383069903f, 0.519296467f},
-std::array<float,2>{0.561065137f, 0.626977623f},
-std::array<float,2>{0.366642445f, 0.467225522f},
-std::array<float,2>{0.951311052f, 0.0383324474f},
-std::array<float,2>{0.172176361f, 0.980246544f},
-std::array<float,2>{0.649973392f, 0.931060135f},
-std::array<float,2>{0.464791864f, 0.108435169f},
-std::array<float,2>{0.831581056f, 0.392845422f},
-std::array<float,2>{0.0440736488f, 0.748912811f},
-std::array<float,2>{0.91535598f, 0.623554587f},
-std::array<float,2>{0.249746233f, 0.254982948f},
-std::array<float,2>{0.624603391f, 0.181370929f},
-std::array<float,2>{0.285964698f, 0.799200416f},
-std::array<float,2>{0.82087791f, 0.89743042f},
-std::array<float,2>{0.0489452109f, 0.0898665711f},
-std::array<float,2>{0.627624094f, 0.412199587f},
-std::array<float,2>{0.441958219f, 0.687632501f},
-std::array<float,2>{0.608089983f, 0.577334106f},
-std::array<float,2>{0.308864236f, 0.308299571f},
-std::array<float,2>{0.935906947f, 0.130746812f},
-std::array<float,2>{0.227070928f, 0.77624017f},
-std::array<float,2>{0.694577873f, 0.855558693f},
-std::array<float,2>{0.39820835f, 0.206785113f},
-std::array<float,2>{0.794457257f, 0.338586986f},
-std::array<float,2>{0.0659989342f, 0.549033344f},
-std::array<float,2>{0.959738076f, 0.678061008f},
-std::array<float,2>{0.165440306f, 0.49168542f},
-std::array<float,2>{0.538921654f, 0.00285997824f},
-std::array<float,2>{0.351157784f, 0.960079014f},
-std::array<float,2>{0.881456971f, 0.788008153f},
-std::array<float,2>{0.188963309f, 0.169162944f},
-std::array<float,2>{0.570322931f, 0.267236203f},
-std::array<float,2>{0.270615429f, 0.594118476f},
-std::array<float,2>{0.68069458f, 0.733020484f},
-std::array<float,2>{0.49049297f, 0.389391035f},
-std::array<float,2>{0.862555504f, 0.118222959f},
-std::array<float,2>{0.00427368889f, 0.913138032f},
-std::array<float,2>{0.504250884f, 0.994099379f},
-std::array<float,2>{0.339532524f, 0.046986226f},
-std::array<float,2>{0.974797547f, 0.441565722f},
-std::array<float,2>{0.146624565f, 0.642337143f},
-std::array<float,2>{0.777125359f, 0.504193306f},
-std::array<float,2>{0.111775815f, 0.355202436f},
-std::array<float,2>{0.718939006f, 0.224635735f},
-std::array<float,2>{0.433746696f, 0.827784359f},
-std::array<float,2>{0.970484734f, 0.887110293f},
-std::array<float,2>{0.143198639f, 0.067437008f},
-std::array<float,2>{0.501289248f, 0.426354498f},
-std::array<float,2>{0.342701256f, 0.71404469f},
-std::array<float,2>{0.724578679f, 0.589810491f},
-std::array<float,2>{0.43275401f, 0.281596988f},
-std::array<float,2>{0.778994441f, 0.155993477f},
-std::array<float,2>{0.11450091f, 0.757235348f},
-std::array<float,2>{0.576484442f, 0.860198557f},
-std::array<float,2>{0.269311577f, 0.20233427f},
-std::array<float,2>{0.876995087f, 0.327057093f},
-std::array<float,2>{0.193814948f, 0.533555329f},
-std::array<float,2>{0.865650892f, 0.660169303f},
-std::array<float,2>{0.00214803708f, 0.481001735f},
-std::array<float,2>{0.686344624f, 0.0180125888f},
-std::array<float,2>{0.485144943f, 0.938857913f},
-std::array<float,2>{0.789645612f, 0.804747581f},
-std::array<float,2>{0.0700688735f, 0.176551104f},
-std::array<float,2>{0.688627601f, 0.258565247f},
-std::array<float,2>{0.393417776f, 0.614283264f},
-std::array<float,2>{0.533814728f, 0.741135895f},
-std::array<float,2>{0.345117599f, 0.404593915f},
-std::array<float,2>{0.953519166f, 0.0975225046f},
-std::array<float,2>{0.171128869f, 0.928743243f},
-std::array<float,2>{0.630050898f, 0.972255468f},
-std::array<float,2>{0.440073758f, 0.0435324833f},
-std::array<float,2>{0.824289024f, 0.459134132f},
-std::array<float,2>{0.0535663255f, 0.633627832f},
-std::array<float,2>{0.930777431f, 0.524343371f},
-std::array<float,2>{0.230509967f, 0.367128462f},
-std::array<float,2>{0.605386734f, 0.237354547f},
-std::array<float,2>{0.305166453f, 0.838908911f},
-std::array<float,2>{0.835674465f, 0.966614723f},
-std::array<float,2>{0.0391613245f, 0.00893721636f},
-std::array<float,2>{0.656110108f, 0.493097067f},
-std::array<float,2>{0.467151344f, 0.682598293f},
-std::array<float,2>{0.620004892f, 0.560046673f},
-std::array<float,2>{0.282390267f, 0.332992643f},
-std::array<float,2>{0.919781864f, 0.215067789f},
-std::array<float,2>{0.243609324f, 0.845425665f},
-std::array<float,2>{0.705767274f, 0.772948444f},
-std::array<float,2>{0.390386552f, 0.136269107f},
-std::array<float,2>{0.798105121f, 0.299220979f},
-std::array<float,2>{0.0802259892f, 0.565221786f},
-std::array<float,2>{0.947007895f, 0.697870195f},
-std::array<float,2>{0.177262664f, 0.416725785f},
-std::array<float,2>{0.557319045f, 0.0816242322f},
-std::array<float,2>{0.360452503f, 0.899786651f},
-std::array<float,2>{0.895731866f, 0.816031456f},
-std::array<float,2>{0.21075584f, 0.230691835f},
-std::array<float,2>{0.586822331f, 0.350537062f},
-std::array<float,2>{0.251743406f, 0.512150705f},
-std::array<float,2>{0.662526131f, 0.652862966f},
-std::array<float,2>{0.473279864f, 0.451054633f},
-std::array<float,2>{0.85581696f, 0.0575204492f},
-std::array<float,2>{0.0224922691f, 0.985535264f},
-std::array<float,2>{0.525773346f, 0.915411711f},
-std::array<float,2>{0.312937796f, 0.110262692f},
-std::array<float,2>{0.999666214f, 0.37758401f},
-std::array<float,2>{0.125000045f, 0.719492316f},
-std::array<float,2>{0.764712751f, 0.608836651f},
-std::array<float,2>{0.107763067f, 0.278621525f},
-std::array<float,2>{0.734730363f, 0.16029951f},
-std::array<float,2>{0.420220017f, 0.791849136f},
-std::array<float,2>{0.911359131f, 0.998768747f},
-std::array<float,2>{0.23840943f, 0.0526406057f},
-std::array<float,2>{0.616914034f, 0.439378113f},
-std::array<float,2>{0.294183075f, 0.646413326f},
-std::array<float,2>{0.648391008f, 0.500174046f},
-std::array<float,2>{0.45825541f, 0.357018948f},
-std::array<float,2>{0.836858571f, 0.219849154f},
-std::array<float,2>{0.0313052684f, 0.822063565f},
-std::array<float,2>{0.553227365f, 0.784396291f},
-std::array<float,2>{0.370892495f, 0.16755788f},
-std::array<float,2>{0.94211036f, 0.273217469f},
-std::array<float,2>{0.187088415f, 0.598219573f},
-std::array<float,2>{0.805628896f, 0.729884863f},
-std::array<float,2>{0.092114374f, 0.384370595f},
-std::array<float,2>{0.715176284f, 0.124483153f},
-std::array<float,2>{0.377020121f, 0.906415164f},
-std::array<float,2>{0.847762346f, 0.851606488f},
-std::array<float,2>{0.0235618632f, 0.209545806f},
-std::array<float,2>{0.667213798f, 0.339847088f},
-std::array<float,2>{0.478691041f, 0.554138184f},
-std::array<float,2>{0.583150744f, 0.674515665f},
-std::array<float,2>{0.258090615f, 0.487057596f},
-std::array<float,2>{0.9037866f, 0.00512935035f},
-std::array<float,2>{0.215170428f, 0.953674912f},
-std::array<float,2>{0.744528055f, 0.893373191f},
-std::array<float,2>{0.407309383f, 0.0888100117f},
-std::array<float,2>{0.754796326f, 0.406848311f},
-std::array<float,2>{0.101059176f, 0.691923499f},
-std::array<float,2>{0.989111662f, 0.570566058f},
-std::array<float,2>{0.134411037f, 0.309430927f},
-std::array<float,2>{0.522694468f, 0.125599384f},
-std::array<float,2>{0.327045709f, 0.778186381f},
-std::array<float,2>{0.766966164f, 0.935611188f},
-std::array<float,2>{0.12450999f, 0.101590574f},
-std::array<float,2>{0.728050053f, 0.394634277f},
-std::array<float,2>{0.425035059f, 0.743697047f},
-std::array<float,2>{0.510904133f, 0.620059907f},
-std::array<float,2>{0.329780698f, 0.25318718f},
-std::array<float,2>{0.983906627f, 0.184549555f},
-std::array<float,2>{0.150997475f, 0.80104506f},
-std::array<float,2>{0.67691052f, 0.829864144f},
-std::array<float,2>{0.498906255f, 0.245176509f},
-std::array<float,2>{0.871194243f, 0.3722561f},
-std::array<float,2>{0.0133504011f, 0.521868289f},
-std::array<float,2>{0.886017978f, 0.630368412f},
-std::array<float,2>{0.20307298f, 0.463651359f},
-std::array<float,2>{0.562657475f, 0.0330650099f},
-std::array<float,2>{0.279209673f, 0.980739415f},
-std::array<float,2>{0.962928236f, 0.765069783f},
-std::array<float,2>{0.159939393f, 0.14130111f},
-std::array<float,2>{0.541246474f, 0.291564047f},
-std::array<float,2>{0.359151363f, 0.580088317f},
-std::array<float,2>{0.700093627f, 0.707753897f},
-std::array<float,2>{0.403247446f, 0.436269134f},
-std::array<float,2>{0.782846093f, 0.0717299655f},
-std::array<float,2>{0.0719084665f, 0.879562795f},
-std::array<float,2>{0.59552604f, 0.95291692f},
-std::array<float,2>{0.297336936f, 0.0298740063f},
-std::array<float,2>{0.927168012f, 0.472789854f},
-std::array<float,2>{0.225917935f, 0.669567287f},
-std::array<float,2>{0.814464688f, 0.544193983f},
-std::array<float,2>{0.0586279444f, 0.315611541f},
-std::array<float,2>{0.639096677f, 0.190914407f},
-std::array<float,2>{0.449782699f, 0.874251604f},
-std::array<float,2>{0.878913224f, 0.913853049f},
-std::array<float,2>{0.189539105f, 0.118735798f},
-std::array<float,2>{0.572465301f, 0.388750583f},
-std::array<float,2>{0.273262441f, 0.732619464f},
-std::array<float,2>{0.682204425f, 0.594558299f},
-std::array<float,2>{0.489098847f, 0.266853273f},
-std::array<float,2>{0.861264229f, 0.169849262f},
-std::array<float,2>{0.00762618845f, 0.787111342f},
-std::array<float,2>{0.506989658f, 0.827393234f},
-std::array<float,2>{0.337134957f, 0.225556687f},
-std::array<float,2>{0.972806334f, 0.35479477f},
-std::array<float,2>{0.145533934f, 0.504659891f},
-std::array<float,2>{0.773518622f, 0.64190352f},
-std::array<float,2>{0.110932887f, 0.442340165f},
-std::array<float,2>{0.720838785f, 0.0477227718f},
-std::array<float,2>{0.436749965f, 0.993254542f},
-std::array<float,2>{0.822387159f, 0.775672138f},
-std::array<float,2>{0.0486695394f, 0.13020514f},
-std::array<float,2>{0.626203656f, 0.307909936f},
-std::array<float,2>{0.443762571f, 0.578041434f},
-std::array<float,2>{0.60574007f, 0.687996149f},
-std::array<float,2>{0.311892152f, 0.412901759f},
-std::array<float,2>{0.933692276f, 0.0905847251f},
-std::array<float,2>{0.229096368f, 0.896806538f},
-std::array<float,2>{0.691612065f, 0.960466146f},
-std::array<float,2>{0.396399707f, 0.00211081235f},
-std::array<float,2>{0.796488047f, 0.491722137f},
-std::array<float,2>{0.0628451183f, 0.678597927f},
-std::array<float,2>{0.957284212f, 0.54976809f},
-std::array<float,2>{0.167288899f, 0.338119775f},
-std::array<float,2>{0.53631866f, 0.206321716f},
-std::array<float,2>{0.347976565f, 0.856200218f},
-std::array<float,2>{0.800921917f, 0.979799628f},
-std::array<float,2>{0.0849917307f, 0.0389499962f},
-std::array<float,2>{0.709991515f, 0.467768699f},
-std::array<float,2>{0.386100173f, 0.627881825f},
-std::array<float,2>{0.559189439f, 0.518748879f},
-std::array<float,2>{0.363345861f, 0.367479116f},
-std::array<float,2>{0.950815618f, 0.248323366f},
-std::array<float,2>{0.174878418f, 0.834100068f},
-std::array<float,2>{0.65080601f, 0.799767792f},
-std::array<float,2>{0.461753696f, 0.180809304f},
-std::array<float,2>{0.828343868f, 0.255856901f},
-std::array<float,2>{0.0458200723f, 0.623272896f},
-std::array<float,2>{0.917592824f, 0.748135149f},
-std::array<float,2>{0.246213734f, 0.393230647f},
-std::array<float,2>{0.621480823f, 0.109291106f},
-std::array<float,2>{0.289017469f, 0.931440413f},
-std::array<float,2>{0.995274782f, 0.870266199f},
-std::array<float,2>{0.129062444f, 0.193793744f},
-std::array<float,2>{0.529330194f, 0.318739593f},
-std::array<float,2>{0.319248825f, 0.542694747f},
-std::array<float,2>{0.740945399f, 0.664251685f},
-std::array<float,2>{0.415367365f, 0.47067073f},
-std::array<float,2>{0.76159215f, 0.0239524897f},
-std::array<float,2>{0.103049375f, 0.948762596f},
-std::array<float,2>{0.590360761f, 0.875772774f},
-std::array<float,2>{0.254760414f, 0.0771313831f},
-std::array<float,2>{0.893628061f, 0.433164269f},
-std::array<float,2>{0.206873134f, 0.705120921f},
-std::array<float,2>{0.85398376f, 0.585195422f},
-std::array<float,2>{0.019304961f, 0.294784635f},
-std::array<float,2>{0.657002807f, 0.146825209f},
-std::array<float,2>{0.469615459f, 0.760022521f},
-std::array<float,2>{0.941170156f, 0.94488585f},
-std::array<float,2>{0.180395827f, 0.021721255f},
-std::array<float,2>{0.547539115f, 0.480304688f},
-std::array<float,2>{0.37236312f, 0.660013676f},
-std::array<float,2>{0.711095452f, 0.535977244f},
-std::array<float,2>{0.378930122f, 0.321893007f},
-std::array<float,2>{0.810113728f, 0.195468754f},
-std::array<float,2>{0.0866970792f, 0.864904642f},
-std::array<float,2>{0.612957001f, 0.750352681f},
-std::array<float,2>{0.291827857f, 0.152065843f},
-std::array<float,2>{0.90670675f, 0.287865818f},
-std::array<float,2>{0.234438539f, 0.592459738f},
-std::array<float,2>{0.841867149f, 0.716027677f},
-std::array<float,2>{0.0377185419f, 0.423751712f},
-std::array<float,2>{0.643842101f, 0.0650145411f},
-std::array<float,2>{0.456287712f, 0.883048356f},
-std::array<float,2>{0.750255585f, 0.841261029f},
-std::array<float,2>{0.0970930234f, 0.238734007f},
-std::array<float,2>{0.749637902f, 0.361682355f},
-std::array<float,2>{0.413204253f, 0.531180203f},
-std::array<float,2>{0.519301057f, 0.638692498f},
-std::array<float,2>{0.323870301f, 0.45407185f},
-std::array<float,2>{0.986382902f, 0.0426961221f},
-std::array<float,2>{0.136774227f, 0.973480642f},
-std::array<float,2>{0.670249403f, 0.923170328f},
-std::array<float,2>{0.482441097f, 0.0985112786f},
-std::array<float,2>{0.846673906f, 0.400540799f},
-std::array<float,2>{0.0297621451f, 0.734694779f},
-std::array<float,2>{0.902220011f, 0.610760331f},
-std::array<float,2>{0.212265775f, 0.263803571f},
-std::array<float,2>{0.580240786f, 0.173829064f},
-std::array<float,2>{0.262773246f, 0.809085011f},
-std::array<float,2>{0.870740294f, 0.905266047f},
-std::array<float,2>{0.00925891381f, 0.0834522918f},
-std::array<float,2>{0.672822952f, 0.419019371f},
-std::array<float,2>{0.493654966f, 0.699332058f},
-std::array<float,2>{0.567436993f, 0.569806516f},
-std::array<float,2>{0.273670375f, 0.302982301f},
-std::array<float,2>{0.889486611f, 0.140016615f},
-std::array<float,2>{0.196003884f, 0.767564237f},
-std::array<float,2>{0.730796099f, 0.84798646f},
-std::array<float,2>{0.427656054f, 0.213176563f},
-std::array<float,2>{0.772804081f, 0.331534803f},
-std::array<float,2>{0.118086331f, 0.5555619f},
-std::array<float,2>{0.979135156f, 0.683975816f},
-std::array<float,2>{0.155101568f, 0.497166306f},
-std::array<float,2>{0.513954341f, 0.014659062f},
-std::array<float,2>{0.334263355f, 0.964071691f},
-std::array<float,2>{0.924155831f, 0.796001434f},
-std::array<float,2>{0.220576689f, 0.158548966f},
-std::array<float,2>{0.598332226f, 0.273463994f},
-std::array<float,2>{0.300819308f, 0.604462266f},
-std::array<float,2>{0.635071576f, 0.723132312f},
-std::array<float,2>{0.448848963f, 0.381454378f},
-std::array<float,2>{0.81841284f, 0.116976872f},
-std::array<float,2>{0.0580823533f, 0.918582618f},
-std::array<float,2>{0.545476258f, 0.990664601f},
-std::array<float,2>{0.35305509f, 0.0622082651f},
-std::array<float,2>{0.965739131f, 0.445436776f},
-std::array<float,2>{0.160932168f, 0.651587963f},
-std::array<float,2>{0.786992073f, 0.511531651f},
-std::array<float,2>{0.0771986768f, 0.344325572f},
-std::array<float,2>{0.695326209f, 0.227118313f},
-std::array<float,2>{0.401623279f, 0.816995382f},
-std::array<float,2>{0.955449998f, 0.926707387f},
-std::array<float,2>{0.169456244f, 0.0944920331f},
-std::array<float,2>{0.532669544f, 0.402944952f},
-std::array<float,2>{0.346044689f, 0.740066469f},
-std::array<float,2>{0.689855576f, 0.615259707f},
-std::array<float,2>{0.390980184f, 0.261345834f},
-std::array<float,2>{0.791394174f, 0.17949222f},
-std::array<float,2>{0.0666276962f, 0.808350146f},
-std::array<float,2>{0.603158414f, 0.835939586f},
-std::array<float,2>{0.307179362f, 0.236184254f},
-std::array<float,2>{0.932710767f, 0.364586174f},
-std::array<float,2>{0.232888654f, 0.526608527f},
-std::array<float,2>{0.827027202f, 0.635504127f},
-std::array<float,2>{0.0520497896f, 0.457508266f},
-std::array<float,2>{0.631095767f, 0.0465521999f},
-std::array<float,2>{0.438379288f, 0.968831658f},
-std::array<float,2>{0.780786276f, 0.754275799f},
-std::array<float,2>{0.116368294f, 0.153483137f},
-std::array<float,2>{0.724738479f, 0.284465224f},
-std::array<float,2>{0.430012375f, 0.587679863f},
-std::array<float,2>{0.502508223f, 0.711103141f},
-std::array<float,2>{0.341362953f, 0.428116232f},
-std::array<float,2>{0.970818222f, 0.0689161792f},
-std::array<float,2>{0.141455606f, 0.889289439f},
-std::array<float,2>{0.684766889f, 0.940419972f},
-std::array<float,2>{0.486946136f, 0.0166139733f},
-std::array<float,2>{0.86437279f, 0.484192193f},
-std::array<float,2>{0.00152955076f, 0.663708627f},
-std::array<float,2>{0.876906574f, 0.533193827f},
-std::array<float,2>{0.192372322f, 0.325041354f},
-std::array<float,2>{0.575903654f, 0.199483678f},
-std::array<float,2>{0.266036421f, 0.862365305f},
-std::array<float,2>{0.859189987f, 0.988153458f},
-std::array<float,2>{0.0200885776f, 0.0559912175f},
-std::array<float,2>{0.661122799f, 0.452324659f},
-std::array<float,2>{0.475672811f, 0.655450344f},
-std::array<float,2>{0.588315248f, 0.515564978f},
-std::array<float,2>{0.25375551f, 0.349231303f},
-std::array<float,2>{0.896692157f, 0.233032629f},
-std::array<float,2>{0.207505494f, 0.812537253f},
-std::array<float,2>{0.737457335f, 0.790783763f},
-std::array<float,2>{0.419724941f, 0.164023682f},
-std::array<float,2>{0.762436926f, 0.279405713f},
-std::array<float,2>{0.106325783f, 0.605980754f},
-std::array<float,2>{0.996558607f, 0.722131133f},
-std::array<float,2>{0.128449112f, 0.37643674f},
-std::array<float,2>{0.52397126f, 0.112588555f},
-std::array<float,2>{0.31626749f, 0.917439342f},
-std::array<float,2>{0.921775639f, 0.847511053f},
-std::array<float,2>{0.245683894f, 0.218518749f},
-std::array<float,2>{0.618914902f, 0.334826171f},
-std::array<float,2>{0.284567833f, 0.561472595f},
-std::array<float,2>{0.652488887f, 0.679786742f},
-std::array<float,2>{0.465508252f, 0.494851023f},
-std::array<float,2>{0.833511233f, 0.0113591915f},
-std::array<float,2>{0.0414981768f, 0.967692971f},
-std::array<float,2>{0.55534023f, 0.901245594f},
-std::array<float,2>{0.36153844f, 0.0782026649f},
-std::array<float,2>{0.947818696f, 0.415297598f},
-std::array<float,2>{0.177849278f, 0.695500493f},
-std::array<float,2>{0.799151421f, 0.562996089f},
-std::array<float,2>{0.0795966834f, 0.296941996f},
-std::array<float,2>{0.703919232f, 0.132919595f},
-std::array<float,2>{0.388120055f, 0.770290554f},
-std::array<float,2>{0.905126989f, 0.955827653f},
-std::array<float,2>{0.218094856f, 0.00688523427f},
-std::array<float,2>{0.585821569f, 0.485995948f},
-std::array<float,2>{0.260679394f, 0.672397614f},
-std::array<float,2>{0.664595425f, 0.551053584f},
-std::array<float,2>{0.476931751f, 0.343403697f},
-std::array<float,2>{0.850995898f, 0.207415745f},
-std::array<float,2>{0.0261324141f, 0.853686571f},
-std::array<float,2>{0.520304918f, 0.780173719f},
-std::array<float,2>{0.324764371f, 0.128609851f},
-std::array<float,2>{0.991558611f, 0.311992109f},
-std::array<float,2>{0.135722786f, 0.57310617f},
-std::array<float,2>{0.757116556f, 0.694858789f},
-std::array<float,2>{0.0988236964f, 0.40903008f},
-std::array<float,2>{0.743927062f, 0.0872675478f},
-std::array<float,2>{0.40823102f, 0.892159402f},
-std::array<float,2>{0.839520037f, 0.822697639f},
-std::array<float,2>{0.033874277f, 0.222150937f},
-std::array<float,2>{0.64610064f, 0.358143896f},
-std::array<float,2>{0.459131181f, 0.502328873f},
-std::array<float,2>{0.614307821f, 0.648280561f},
-std::array<float,2>{0.296699822f, 0.440195233f},
-std::array<float,2>{0.91381079f, 0.0533955842f},
-std::array<float,2>{0.240790412f, 0.996631026f},
-std::array<float,2>{0.718474448f, 0.908799469f},
-std::array<float,2>{0.375081956f, 0.121439151f},
-std::array<float,2>{0.807386756f, 0.386086881f},
-std::array<float,2>{0.0900851563f, 0.727372766f},
-std::array<float,2>{0.943828881f, 0.599855483f},
-std::array<float,2>{0.184628949f, 0.27003634f},
-std::array<float,2>{0.552637339f, 0.164427742f},
-std::array<float,2>{0.368687838f, 0.781892955f},
-std::array<float,2>{0.783245564f, 0.881269038f},
-std::array<float,2>{0.0736178011f, 0.0729105324f},
-std::array<float,2>{0.70221436f, 0.434547335f},
-std::array<float,2>{0.405810148f, 0.709459007f},
-std::array<float,2>{0.539295375f, 0.579401493f},
-std::array<float,2>{0.357291311f, 0.290824205f},
-std::array<float,2>{0.961499214f, 0.144285783f},
-std::array<float,2>{0.157942176f, 0.762495637f},
-std::array<float,2>{0.636996984f, 0.871561289f},
-std::array<float,2>{0.451192081f, 0.188194156f},
-std::array<float,2>{0.81288296f, 0.313168347f},
-std::array<float,2>{0.0624929368f, 0.546197534f},
-std::array<float,2>{0.928956628f, 0.670545161f},
-std::array<float,2>{0.223219424f, 0.476181746f},
-std::array<float,2>{0.596190572f, 0.028735891f},
-std::array<float,2>{0.300044566f, 0.949455082f},
-std::array<float,2>{0.980683088f, 0.803924024f},
-std::array<float,2>{0.14949441f, 0.185721502f},
-std::array<float,2>{0.508598387f, 0.251247078f},
-std::array<float,2>{0.331870735f, 0.618785083f},
-std::array<float,2>{0.729581118f, 0.745934904f},
-std::array<float,2>{0.423435003f, 0.396620214f},
-std::array<float,2>{0.769358635f, 0.104535185f},
-std::array<float,2>{0.123007163f, 0.934004068f},
-std::array<float,2>{0.566295445f, 0.983894229f},
-std::array<float,2>{0.280543029f, 0.033486817f},
-std::array<float,2>{0.883037686f, 0.462045789f},
-std::array<float,2>{0.199949905f, 0.631791294f},
-std::array<float,2>{0.874401987f, 0.521412134f},
-std::array<float,2>{0.013784972f, 0.373716712f},
-std::array<float,2>{0.678433716f, 0.243677109f},
-std::array<float,2>{0.497784615f, 0.831906617f},
-std::array<float,2>{0.936274469f, 0.895037055f},
-std::array<float,2>{0.226704538f, 0.0918927342f},
-std::array<float,2>{0.607717335f, 0.410515904f},
-std::array<float,2>{0.309189737f, 0.68977046f},
-std::array<float,2>{0.627006948f, 0.575967789f},
-std::array<float,2>{0.441464037f, 0.306052566f},
-std::array<float,2>{0.82039541f, 0.131876945f},
-std::array<float,2>{0.0497833379f, 0.773634136f},
-std::array<float,2>{0.538537025f, 0.858976603f},
-std::array<float,2>{0.351031125f, 0.203926221f},
-std::array<float,2>{0.959326029f, 0.337603062f},
-std::array<float,2>{0.165541932f, 0.548657537f},
-std::array<float,2>{0.794138014f, 0.677289128f},
-std::array<float,2>{0.0655282438f, 0.489556879f},
-std::array<float,2>{0.695273042f, 0.00153983f},
-std::array<float,2>{0.397767365f, 0.957974374f},
-std::array<float,2>{0.862957478f, 0.786578834f},
-std::array<float,2>{0.00488204882f, 0.171403527f},
-std::array<float,2>{0.681300402f, 0.268479198f},
-std::array<float,2>{0.490970314f, 0.597089767f},
-std::array<float,2>{0.570983648f, 0.73099333f},
-std::array<float,2>{0.271160841f, 0.3880665f},
-std::array<float,2>{0.881011367f, 0.120832041f},
-std::array<float,2>{0.189391941f, 0.910599947f},
-std::array<float,2>{0.719564974f, 0.995541751f},
-std::array<float,2>{0.434169769f, 0.0489356294f},
-std::array<float,2>{0.77684021f, 0.445155025f},
-std::array<float,2>{0.111917123f, 0.643048644f},
-std::array<float,2>{0.975422442f, 0.506729841f},
-std::array<float,2>{0.147444502f, 0.352307767f},
-std::array<float,2>{0.504746318f, 0.222877115f},
-std::array<float,2>{0.339000285f, 0.825155735f},
-std::array<float,2>{0.759601355f, 0.946227789f},
-std::array<float,2>{0.103639565f, 0.0255144909f},
-std::array<float,2>{0.739564717f, 0.47251597f},
-std::array<float,2>{0.416845709f, 0.667226851f},
-std::array<float,2>{0.528017879f, 0.539494812f},
-std::array<float,2>{0.31657356f, 0.316984624f},
-std::array<float,2>{0.992618799f, 0.191762939f},
-std::array<float,2>{0.131046876f, 0.867489755f},
-std::array<float,2>{0.660050094f, 0.757972181f},
-std::array<float,2>{0.471470863f, 0.145591617f},
-std::array<float,2>{0.853178084f, 0.295487553f},
-std::array<float,2>{0.0160784535f, 0.58325398f},
-std::array<float,2>{0.891563833f, 0.70356679f},
-std::array<float,2>{0.203506395f, 0.429849237f},
-std::array<float,2>{0.593136489f, 0.0749839172f},
-std::array<float,2>{0.255918145f, 0.878636777f},
-std::array<float,2>{0.952009261f, 0.83228302f},
-std::array<float,2>{0.172757626f, 0.24804391f},
-std::array<float,2>{0.560887873f, 0.370895416f},
-std::array<float,2>{0.366878211f, 0.516718328f},
-std::array<float,2>{0.70865202f, 0.626080871f},
-std::array<float,2>{0.383433461f, 0.465541899f},
-std::array<float,2>{0.803305387f, 0.0358992144f},
-std::array<float,2>{0.0830854177f, 0.976790428f},
-std::array<float,2>{0.624028444f, 0.931771755f},
-std::array<float,2>{0.285603374f, 0.107324392f},
-std::array<float,2>{0.915854931f, 0.392033666f},
-std::array<float,2>{0.24911657f, 0.746406198f},
-std::array<float,2>{0.831141055f, 0.6214661f},
-std::array<float,2>{0.0445580818f, 0.256584913f},
-std::array<float,2>{0.649505734f, 0.182758033f},
-std::array<float,2>{0.463945746f, 0.797846317f},
-std::array<float,2>{0.984604299f, 0.975889504f},
-std::array<float,2>{0.139040872f, 0.0405637957f},
-std::array<float,2>{0.515802801f, 0.456517339f},
-std::array<float,2>{0.321155846f, 0.638143003f},
-std::array<float,2>{0.74648124f, 0.529128492f},
-std::array<float,2>{0.410521984f, 0.360337228f},
-std::array<float,2>{0.753529549f, 0.241397217f},
-std::array<float,2>{0.0954772681f, 0.841932058f},
-std::array<float,2>{0.578437984f, 0.812247574f},
-std::array<float,2>{0.263931632f, 0.172753096f},
-std::array<float,2>{0.898615181f, 0.261946619f},
-std::array<float,2>{0.214315891f, 0.612443447f},
-std::array<float,2>{0.844265997f, 0.736578345f},
-std::array<float,2>{0.0287555493f, 0.398838937f},
-std::array<float,2>{0.669566214f, 0.0997487754f},
-std::array<float,2>{0.481958598f, 0.925162435f},
-std::array<float,2>{0.812389612f, 0.866948128f},
-std::array<float,2>{0.0891540274f, 0.198588043f},
-std::array<float,2>{0.714671373f, 0.323318124f},
-std::array<float,2>{0.381483048f, 0.53752327f},
-std::array<float,2>{0.549132347f, 0.657765567f},
-std::array<float,2>{0.374680519f, 0.476919144f},
-std::array<float,2>{0.937672555f, 0.019924555f},
-std::array<float,2>{0.182952374f, 0.942295253f},
-std::array<float,2>{0.642126739f, 0.886478424f},
-std::array<float,2>{0.45433566f, 0.0629030764f},
-std::array<float,2>{0.840840816f, 0.424112171f},
-std::array<float,2>{0.0358548798f, 0.716840267f},
-std::array<float,2>{0.90940249f, 0.590009212f},
-std::array<float,2>{0.236899599f, 0.285539895f},
-std::array<float,2>{0.611227334f, 0.149334967f},
-std::array<float,2>{0.29096657f, 0.753608465f},
-std::array<float,2>{0.817345858f, 0.920097709f},
-std::array<float,2>{0.0552367568f, 0.114899822f},
-std::array<float,2>{0.633160412f, 0.380529225f},
-std::array<float,2>{0.445524067f, 0.724837959f},
-std::array<float,2>{0.601077497f, 0.602520645f},
-std::array<float,2>{0.304230243f, 0.27552408f},
-std::array<float,2>{0.92275387f, 0.158042192f},
-std::array<float,2>{0.221045062f, 0.793640494f},
-std::array<float,2>{0.698498726f, 0.818445623f},
-std::array<float,2>{0.399361163f, 0.229144752f},
-std::array<float,2>{0.788005829f, 0.346103311f},
-std::array<float,2>{0.0754537359f, 0.508330762f},
-std::array<float,2>{0.96846503f, 0.649916291f},
-std::array<float,2>{0.163578123f, 0.448774844f},
-std::array<float,2>{0.544395626f, 0.0600667037f},
-std::array<float,2>{0.354587883f, 0.98971349f},
-std::array<float,2>{0.887405813f, 0.769243002f},
-std::array<float,2>{0.197731644f, 0.137990296f},
-std::array<float,2>{0.568615198f, 0.302450895f},
-std::array<float,2>{0.276925802f, 0.566783905f},
-std::array<float,2>{0.675180793f, 0.702384293f},
-std::array<float,2>{0.494297504f, 0.421465099f},
-std::array<float,2>{0.868897438f, 0.0848952532f},
-std::array<float,2>{0.0105494456f, 0.903698623f},
-std::array<float,2>{0.512655556f, 0.962392628f},
-std::array<float,2>{0.332864732f, 0.0123776915f},
-std::array<float,2>{0.978204906f, 0.498181552f},
-std::array<float,2>{0.153410554f, 0.686248899f},
-std::array<float,2>{0.770524144f, 0.556751907f},
-std::array<float,2>{0.119942389f, 0.328380316f},
-std::array<float,2>{0.732645333f, 0.212635458f},
-std::array<float,2>{0.429565489f, 0.850167513f},
-std::array<float,2>{0.99888134f, 0.916774631f},
-std::array<float,2>{0.12669377f, 0.111337312f},
-std::array<float,2>{0.527192533f, 0.37535584f},
-std::array<float,2>{0.313919842f, 0.721626461f},
-std::array<float,2>{0.735486984f, 0.606541574f},
-std::array<float,2>{0.420939565f, 0.280644f},
-std::array<float,2>{0.764258981f, 0.162951067f},
-std::array<float,2>{0.109195061f, 0.789901733f},
-std::array<float,2>{0.587446392f, 0.81410104f},
-std::array<float,2>{0.250055939f, 0.233559042f},
-std::array<float,2>{0.894635558f, 0.348016888f},
-std::array<float,2>{0.209657341f, 0.513702989f},
-std::array<float,2>{0.857195795f, 0.654387057f},
-std::array<float,2>{0.0217039138f, 0.452046484f},
-std::array<float,2>{0.663435876f, 0.0548832417f},
-std::array<float,2>{0.474022806f, 0.986770689f},
-std::array<float,2>{0.797585368f, 0.770903051f},
-std::array<float,2>{0.0817162544f, 0.134031832f},
-std::array<float,2>{0.706632733f, 0.298134953f},
-std::array<float,2>{0.389428228f, 0.563910007f},
-std::array<float,2>{0.557685077f, 0.696828663f},
-std::array<float,2>{0.359804899f, 0.414538473f},
-std::array<float,2>{0.945533872f, 0.0798660815f},
-std::array<float,2>{0.17596738f, 0.902051449f},
-std::array<float,2>{0.654430687f, 0.96856612f},
-std::array<float,2>{0.468435287f, 0.0103761898f},
-std::array<float,2>{0.834210932f, 0.495735347f},
-std::array<float,2>{0.0408217199f, 0.681557178f},
-std::array<float,2>{0.918214321f, 0.562425792f},
-std::array<float,2>{0.242538154f, 0.33515352f},
-std::array<float,2>{0.620878696f, 0.217645854f},
-std::array<float,2>{0.281625897f, 0.846484363f},
-std::array<float,2>{0.82561481f, 0.969840288f},
-std::array<float,2>{0.0541323721f, 0.0458754785f},
-std::array<float,2>{0.629585743f, 0.458913028f},
-std::array<float,2>{0.440811604f, 0.636130512f},
-std::array<float,2>{0.603777945f, 0.525519371f},
-std::array<float,2>{0.306182951f, 0.363713145f},
-std::array<float,2>{0.930599511f, 0.235040188f},
-std::array<float,2>{0.231602311f, 0.837134123f},
-std::array<float,2>{0.687863469f, 0.807381034f},
-std::array<float,2>{0.394486874f, 0.177938879f},
-std::array<float,2>{0.790354788f, 0.260227889f},
-std::array<float,2>{0.0689429492f, 0.616424143f},
-std::array<float,2>{0.9548136f, 0.739097536f},
-std::array<float,2>{0.170321256f, 0.40394333f},
-std::array<float,2>{0.534482241f, 0.0954583064f},
-std::array<float,2>{0.344689488f, 0.92761302f},
-std::array<float,2>{0.877946377f, 0.861497879f},
-std::array<float,2>{0.19466491f, 0.200363383f},
-std::array<float,2>{0.577302516f, 0.325330585f},
-std::array<float,2>{0.26847738f, 0.531660259f},
-std::array<float,2>{0.686935723f, 0.662180662f},
-std::array<float,2>{0.485802442f, 0.482579052f},
-std::array<float,2>{0.866409957f, 0.0165503286f},
-std::array<float,2>{0.00337714911f, 0.941022277f},
-std::array<float,2>{0.500062108f, 0.890407324f},
-std::array<float,2>{0.343110055f, 0.0702729449f},
-std::array<float,2>{0.96951139f, 0.428853244f},
-std::array<float,2>{0.143887624f, 0.712772608f},
-std::array<float,2>{0.777662873f, 0.586072028f},
-std::array<float,2>{0.113714397f, 0.28322643f},
-std::array<float,2>{0.722919881f, 0.152859658f},
-std::array<float,2>{0.432586044f, 0.755555451f},
-std::array<float,2>{0.925810635f, 0.950216532f},
-std::array<float,2>{0.225037172f, 0.0281756036f},
-std::array<float,2>{0.594291687f, 0.475271672f},
-std::array<float,2>{0.298716724f, 0.671761155f},
-std::array<float,2>{0.639950991f, 0.54499507f},
-std::array<float,2>{0.451168001f, 0.313969702f},
-std::array<float,2>{0.81578964f, 0.18887724f},
-std::array<float,2>{0.0599180348f, 0.872703195f},
-std::array<float,2>{0.542122424f, 0.762924135f},
-std::array<float,2>{0.358248264f, 0.142830297f},
-std::array<float,2>{0.964043975f, 0.289917111f},
-std::array<float,2>{0.1586041f, 0.578482807f},
-std::array<float,2>{0.781735718f, 0.710841298f},
-std::array<float,2>{0.0710667744f, 0.43542105f},
-std::array<float,2>{0.700363696f, 0.0739891455f},
-std::array<float,2>{0.404199392f, 0.882636011f},
-std::array<float,2>{0.872947812f, 0.83016324f},
-std::array<float,2>{0.0122749936f, 0.242281869f},
-std::array<float,2>{0.676184475f, 0.374134451f},
-std::array<float,2>{0.499911726f, 0.519865036f},
-std::array<float,2>{0.563720942f, 0.631884873f},
-std::array<float,2>{0.27750358f, 0.46160087f},
-std::array<float,2>{0.885496795f, 0.0349938497f},
-std::array<float,2>{0.201716557f, 0.983089089f},
-std::array<float,2>{0.726575792f, 0.935229599f},
-std::array<float,2>{0.424418747f, 0.104152925f},
-std::array<float,2>{0.765788853f, 0.398246109f},
-std::array<float,2>{0.123547003f, 0.744856596f},
-std::array<float,2>{0.982914686f, 0.61815995f},
-std::array<float,2>{0.152188182f, 0.250215024f},
-std::array<float,2>{0.510220885f, 0.18723546f},
-std::array<float,2>{0.328449607f, 0.802843094f},
-std::array<float,2>{0.75511235f, 0.890638173f},
-std::array<float,2>{0.100314349f, 0.0862124786f},
-std::array<float,2>{0.74589777f, 0.409783572f},
-std::array<float,2>{0.406306237f, 0.69392848f},
-std::array<float,2>{0.522116482f, 0.573696434f},
-std::array<float,2>{0.327745199f, 0.311496913f},
-std::array<float,2>{0.989906669f, 0.127057835f},
-std::array<float,2>{0.133021072f, 0.780344427f},
-std::array<float,2>{0.666333795f, 0.854734302f},
-std::array<float,2>{0.479620486f, 0.20859918f},
-std::array<float,2>{0.849300742f, 0.341852784f},
-std::array<float,2>{0.0245639347f, 0.551783025f},
-std::array<float,2>{0.902942121f, 0.673144341f},
-std::array<float,2>{0.21588783f, 0.485227257f},
-std::array<float,2>{0.582031429f, 0.00586595712f},
-std::array<float,2>{0.259654641f, 0.956213832f},
-std::array<float,2>{0.943269789f, 0.782512009f},
-std::array<float,2>{0.185632512f, 0.165154323f},
-std::array<float,2>{0.554180264f, 0.271105587f},
-std::array<float,2>{0.370082527f, 0.601351798f},
-std::array<float,2>{0.716444671f, 0.728500009f},
-std::array<float,2>{0.378609568f, 0.384910822f},
-std::array<float,2>{0.805685818f, 0.123012908f},
-std::array<float,2>{0.0933364481f, 0.909723163f},
-std::array<float,2>{0.61578232f, 0.997918665f},
-std::array<float,2>{0.293564677f, 0.0546075888f},
-std::array<float,2>{0.910598755f, 0.441195995f},
-std::array<float,2>{0.24004519f, 0.646535993f},
-std::array<float,2>{0.837079823f, 0.503636658f},
-std::array<float,2>{0.0326184891f, 0.359127283f},
-std::array<float,2>{0.647106349f, 0.220869213f},
-std::array<float,2>{0.457428694f, 0.824083447f},
-std::array<float,2>{0.89307344f, 0.877863586f},
-std::array<float,2>{0.205195308f, 0.0760875493f},
-std::array<float,2>{0.590972662f, 0.431419253f},
-std::array<float,2>{0.255017489f, 0.704813123f},
-std::array<float,2>{0.657880902f, 0.58283639f},
-std::array<float,2>{0.470534801f, 0.296754181f},
-std::array<float,2>{0.855331063f, 0.145081416f},
-std::array<float,2>{0.0185176712f, 0.759763062f},
-std::array<float,2>{0.53118968f, 0.868694901f},
-std::array<float,2>{0.319891602f, 0.19294703f},
-std::array<float,2>{0.994408667f, 0.317502439f},
-std::array<float,2>{0.130139828f, 0.540501118f},
-std::array<float,2>{0.760098934f, 0.666121066f},
-std::array<float,2>{0.101943888f, 0.471205056f},
-std::array<float,2>{0.74202776f, 0.0267960262f},
-std::array<float,2>{0.414232999f, 0.946923852f},
-std::array<float,2>{0.830007374f, 0.798378229f},
-std::array<float,2>{0.0466218106f, 0.181776434f},
-std::array<float,2>{0.652077734f, 0.257481575f},
-std::array<float,2>{0.462489098f, 0.622976124f},
-std::array<float,2>{0.62286526f, 0.747489929f},
-std::array<float,2>{0.287386507f, 0.39146322f},
-std::array<float,2>{0.916560769f, 0.105891503f},
-std::array<float,2>{0.247451276f, 0.933386445f},
-std::array<float,2>{0.709463179f, 0.978399992f},
-std::array<float,2>{0.385188043f, 0.0368406512f},
-std::array<float,2>{0.802557886f, 0.465965837f},
-std::array<float,2>{0.0842982754f, 0.625624061f},
-std::array<float,2>{0.949799418f, 0.515654385f},
-std::array<float,2>{0.174010307f, 0.369737089f},
-std::array<float,2>{0.560043871f, 0.246953398f},
-std::array<float,2>{0.364769995f, 0.833304107f},
-std::array<float,2>{0.795370817f, 0.958557367f},
-std::array<float,2>{0.0643175319f, 1.49519365e-05f},
-std::array<float,2>{0.692667305f, 0.489095688f},
-std::array<float,2>{0.394874543f, 0.676654339f},
-std::array<float,2>{0.535551608f, 0.547088206f},
-std::array<float,2>{0.348999977f, 0.336759478f},
-std::array<float,2>{0.958358645f, 0.204967156f},
-std::array<float,2>{0.166901022f, 0.857526064f},
-std::array<float,2>{0.625976205f, 0.774809301f},
-std::array<float,2>{0.444691151f, 0.131826818f},
-std::array<float,2>{0.823566914f, 0.305643231f},
-std::array<float,2>{0.0477118529f, 0.574497938f},
-std::array<float,2>{0.93507576f, 0.690645754f},
-std::array<float,2>{0.229746267f, 0.41198644f},
-std::array<float,2>{0.607116461f, 0.0934381187f},
-std::array<float,2>{0.311510444f, 0.895819128f},
-std::array<float,2>{0.974443257f, 0.825840235f},
-std::array<float,2>{0.14503926f, 0.22422047f},
-std::array<float,2>{0.506613374f, 0.352877587f},
-std::array<float,2>{0.336735219f, 0.507412136f},
-std::array<float,2>{0.721995533f, 0.644452095f},
-std::array<float,2>{0.435769439f, 0.443914741f},
-std::array<float,2>{0.774597228f, 0.0506742224f},
-std::array<float,2>{0.10975261f, 0.994738758f},
-std::array<float,2>{0.57363373f, 0.91159302f},
-std::array<float,2>{0.272002667f, 0.120091319f},
-std::array<float,2>{0.880447745f, 0.387282342f},
-std::array<float,2>{0.191014081f, 0.731649935f},
-std::array<float,2>{0.860106409f, 0.596221268f},
-std::array<float,2>{0.00627121609f, 0.269288838f},
-std::array<float,2>{0.682834625f, 0.170580819f},
-std::array<float,2>{0.489863217f, 0.7857458f},
-std::array<float,2>{0.966066539f, 0.989192307f},
-std::array<float,2>{0.161327869f, 0.0589641295f},
-std::array<float,2>{0.546034098f, 0.447372198f},
-std::array<float,2>{0.352444172f, 0.648593009f},
-std::array<float,2>{0.696401f, 0.509089708f},
-std::array<float,2>{0.400450945f, 0.346820116f},
-std::array<float,2>{0.785819888f, 0.229547575f},
-std::array<float,2>{0.0762960911f, 0.820089638f},
-std::array<float,2>{0.599086285f, 0.794191539f},
-std::array<float,2>{0.30181697f, 0.156914875f},
-std::array<float,2>{0.924992859f, 0.276525229f},
-std::array<float,2>{0.219536483f, 0.603238404f},
-std::array<float,2>{0.820110202f, 0.72632283f},
-std::array<float,2>{0.0574215613f, 0.379421264f},
-std::array<float,2>{0.636638045f, 0.113771409f},
-std::array<float,2>{0.447990298f, 0.921824694f},
-std::array<float,2>{0.771576583f, 0.851220787f},
-std::array<float,2>{0.119024679f, 0.211219594f},
-std::array<float,2>{0.731940866f, 0.329655796f},
-std::array<float,2>{0.426160663f, 0.55804652f},
-std::array<float,2>{0.514889359f, 0.687028229f},
-std::array<float,2>{0.335050166f, 0.499623299f},
-std::array<float,2>{0.980356812f, 0.0135080237f},
-std::array<float,2>{0.155523211f, 0.961161852f},
-std::array<float,2>{0.673059285f, 0.902743995f},
-std::array<float,2>{0.492375165f, 0.0852065757f},
-std::array<float,2>{0.870011151f, 0.420590937f},
-std::array<float,2>{0.00810541864f, 0.701605439f},
-std::array<float,2>{0.890191019f, 0.567798316f},
-std::array<float,2>{0.197002798f, 0.301300138f},
-std::array<float,2>{0.567292631f, 0.13742207f},
-std::array<float,2>{0.274629951f, 0.768534482f},
-std::array<float,2>{0.847218037f, 0.924057603f},
-std::array<float,2>{0.0308202654f, 0.100732557f},
-std::array<float,2>{0.67111063f, 0.399542302f},
-std::array<float,2>{0.483491629f, 0.737734318f},
-std::array<float,2>{0.581247866f, 0.611849487f},
-std::array<float,2>{0.262222141f, 0.263420284f},
-std::array<float,2>{0.900936484f, 0.173529401f},
-std::array<float,2>{0.211344257f, 0.810985684f},
-std::array<float,2>{0.74835366f, 0.842858613f},
-std::array<float,2>{0.412384599f, 0.240990907f},
-std::array<float,2>{0.751730919f, 0.360932589f},
-std::array<float,2>{0.095826298f, 0.527987599f},
-std::array<float,2>{0.987333834f, 0.637343049f},
-std::array<float,2>{0.138403729f, 0.455091298f},
-std::array<float,2>{0.517875493f, 0.0397350863f},
-std::array<float,2>{0.322975457f, 0.97510308f},
-std::array<float,2>{0.907951951f, 0.752603412f},
-std::array<float,2>{0.236092389f, 0.149827614f},
-std::array<float,2>{0.611548781f, 0.286350548f},
-std::array<float,2>{0.292482585f, 0.591555834f},
-std::array<float,2>{0.643378079f, 0.718506336f},
-std::array<float,2>{0.455220699f, 0.424990654f},
-std::array<float,2>{0.84301734f, 0.063728258f},
-std::array<float,2>{0.0387920588f, 0.885400176f},
-std::array<float,2>{0.548474669f, 0.943067729f},
-std::array<float,2>{0.371630162f, 0.0206533838f},
-std::array<float,2>{0.94017309f, 0.478477418f},
-std::array<float,2>{0.180794731f, 0.656625807f},
-std::array<float,2>{0.808661103f, 0.538734138f},
-std::array<float,2>{0.08773987f, 0.322825164f},
-std::array<float,2>{0.71216017f, 0.197686791f},
-std::array<float,2>{0.38009581f, 0.866033733f},
-std::array<float,2>{0.948409975f, 0.89849472f},
-std::array<float,2>{0.178738713f, 0.0809889063f},
-std::array<float,2>{0.556351662f, 0.417928964f},
-std::array<float,2>{0.362733215f, 0.698366046f},
-std::array<float,2>{0.704285264f, 0.566373169f},
-std::array<float,2>{0.386953503f, 0.300222516f},
-std::array<float,2>{0.800540864f, 0.135603949f},
-std::array<float,2>{0.0783185363f, 0.771501303f},
-std::array<float,2>{0.617707908f, 0.844537377f},
-std::array<float,2>{0.28362f, 0.216646492f},
-std::array<float,2>{0.920734465f, 0.333061367f},
-std::array<float,2>{0.244142294f, 0.559319079f},
-std::array<float,2>{0.832192481f, 0.682980716f},
-std::array<float,2>{0.0428808779f, 0.493345708f},
-std::array<float,2>{0.653786361f, 0.00809500553f},
-std::array<float,2>{0.466282219f, 0.965731382f},
-std::array<float,2>{0.763471007f, 0.792439938f},
-std::array<float,2>{0.106840923f, 0.16137591f},
-std::array<float,2>{0.736693978f, 0.277942449f},
-std::array<float,2>{0.418212235f, 0.608120084f},
-std::array<float,2>{0.524884462f, 0.719875097f},
-std::array<float,2>{0.315198094f, 0.378843784f},
-std::array<float,2>{0.9971205f, 0.110520184f},
-std::array<float,2>{0.127873376f, 0.914595187f},
-std::array<float,2>{0.661497176f, 0.98443675f},
-std::array<float,2>{0.475570977f, 0.0580395013f},
-std::array<float,2>{0.858022153f, 0.449490607f},
-std::array<float,2>{0.0210077148f, 0.653492093f},
-std::array<float,2>{0.89837724f, 0.512726605f},
-std::array<float,2>{0.208144486f, 0.351162255f},
-std::array<float,2>{0.589705527f, 0.232095852f},
-std::array<float,2>{0.252618074f, 0.814618587f},
-std::array<float,2>{0.863955319f, 0.937553704f},
-std::array<float,2>{0.000119933226f, 0.0193936992f},
-std::array<float,2>{0.684006512f, 0.482060969f},
-std::array<float,2>{0.48753497f, 0.661856055f},
-std::array<float,2>{0.575112462f, 0.534841657f},
-std::array<float,2>{0.26679641f, 0.327250361f},
-std::array<float,2>{0.87504977f, 0.201927334f},
-std::array<float,2>{0.192685306f, 0.860664368f},
-std::array<float,2>{0.725824893f, 0.755918682f},
-std::array<float,2>{0.430764705f, 0.154763833f},
-std::array<float,2>{0.78009218f, 0.283057511f},
-std::array<float,2>{0.115389697f, 0.588788509f},
-std::array<float,2>{0.971994042f, 0.713158011f},
-std::array<float,2>{0.142014474f, 0.426873684f},
-std::array<float,2>{0.503685415f, 0.067364797f},
-std::array<float,2>{0.340283304f, 0.887926102f},
-std::array<float,2>{0.93258661f, 0.837986827f},
-std::array<float,2>{0.233601764f, 0.236546353f},
-std::array<float,2>{0.602405429f, 0.365738332f},
-std::array<float,2>{0.307760596f, 0.524667561f},
-std::array<float,2>{0.632221222f, 0.634212732f},
-std::array<float,2>{0.439125419f, 0.460584372f},
-std::array<float,2>{0.827250063f, 0.0442518704f},
-std::array<float,2>{0.0515030809f, 0.971248806f},
-std::array<float,2>{0.531295419f, 0.928337634f},
-std::array<float,2>{0.347409695f, 0.0959257483f},
-std::array<float,2>{0.956360221f, 0.405941486f},
-std::array<float,2>{0.168096721f, 0.742147684f},
-std::array<float,2>{0.792783499f, 0.613859117f},
-std::array<float,2>{0.0674952045f, 0.259450465f},
-std::array<float,2>{0.690811455f, 0.177256837f},
-std::array<float,2>{0.391935378f, 0.805723488f},
-std::array<float,2>{0.884280145f, 0.981778026f},
-std::array<float,2>{0.20054926f, 0.0315380953f},
-std::array<float,2>{0.564915478f, 0.46451354f},
-std::array<float,2>{0.279575676f, 0.629621267f},
-std::array<float,2>{0.678970516f, 0.523189545f},
-std::array<float,2>{0.4970119f, 0.372050911f},
-std::array<float,2>{0.873514712f, 0.244321465f},
-std::array<float,2>{0.0147653315f, 0.828285575f},
-std::array<float,2>{0.509363949f, 0.80253756f},
-std::array<float,2>{0.330475599f, 0.184874237f},
-std::array<float,2>{0.982040584f, 0.252517343f},
-std::array<float,2>{0.149297088f, 0.621024966f},
-std::array<float,2>{0.767998993f, 0.742606044f},
-std::array<float,2>{0.121791705f, 0.396175653f},
-std::array<float,2>{0.728603482f, 0.103322797f},
-std::array<float,2>{0.42273441f, 0.936968684f},
-std::array<float,2>{0.814227641f, 0.873828471f},
-std::array<float,2>{0.0605669916f, 0.189608678f},
-std::array<float,2>{0.638652384f, 0.314855635f},
-std::array<float,2>{0.452267468f, 0.543301821f},
-std::array<float,2>{0.597081721f, 0.668466568f},
-std::array<float,2>{0.299379498f, 0.47432363f},
-std::array<float,2>{0.928445518f, 0.0305064842f},
-std::array<float,2>{0.224075004f, 0.951579094f},
-std::array<float,2>{0.701772749f, 0.880093336f},
-std::array<float,2>{0.404755801f, 0.0705092326f},
-std::array<float,2>{0.784652591f, 0.437325597f},
-std::array<float,2>{0.0726979077f, 0.708712757f},
-std::array<float,2>{0.962524831f, 0.581085384f},
-std::array<float,2>{0.157070756f, 0.292372435f},
-std::array<float,2>{0.540076137f, 0.142333925f},
-std::array<float,2>{0.356235981f, 0.764195144f},
-std::array<float,2>{0.807722688f, 0.907463968f},
-std::array<float,2>{0.0911376774f, 0.123062089f},
-std::array<float,2>{0.717055142f, 0.383279264f},
-std::array<float,2>{0.376234591f, 0.729219437f},
-std::array<float,2>{0.551682055f, 0.598673999f},
-std::array<float,2>{0.367317975f, 0.271558553f},
-std::array<float,2>{0.944538474f, 0.166598693f},
-std::array<float,2>{0.184437484f, 0.7833637f},
-std::array<float,2>{0.644837916f, 0.820426583f},
-std::array<float,2>{0.460274041f, 0.218907878f},
-std::array<float,2>{0.838601589f, 0.356075794f},
-std::array<float,2>{0.0342889354f, 0.501242876f},
-std::array<float,2>{0.912906289f, 0.64512217f},
-std::array<float,2>{0.241559163f, 0.438219905f},
-std::array<float,2>{0.613673866f, 0.0510314517f},
-std::array<float,2>{0.295068443f, 0.999305964f},
-std::array<float,2>{0.990536511f, 0.778885424f},
-std::array<float,2>{0.136286288f, 0.126155719f},
-std::array<float,2>{0.521283507f, 0.310135186f},
-std::array<float,2>{0.326058924f, 0.571535349f},
-std::array<float,2>{0.742584646f, 0.692689836f},
-std::array<float,2>{0.409313917f, 0.407337159f},
-std::array<float,2>{0.756146789f, 0.0896362886f},
-std::array<float,2>{0.0985436216f, 0.893576622f},
-std::array<float,2>{0.584427953f, 0.954110801f},
-std::array<float,2>{0.261609942f, 0.00448835036f},
-std::array<float,2>{0.90551585f, 0.488216579f},
-std::array<float,2>{0.2168587f, 0.675008655f},
-std::array<float,2>{0.850013077f, 0.55329299f},
-std::array<float,2>{0.0265902635f, 0.340987593f},
-std::array<float,2>{0.66586417f, 0.210685238f},
-std::array<float,2>{0.477879673f, 0.853209078f},
-std::array<float,2>{0.914174795f, 0.930070758f},
-std::array<float,2>{0.248525217f, 0.108034521f},
-std::array<float,2>{0.623152196f, 0.394001931f},
-std::array<float,2>{0.286851794f, 0.749817491f},
-std::array<float,2>{0.649282634f, 0.624364197f},
-std::array<float,2>{0.463867098f, 0.253976911f},
-std::array<float,2>{0.830458403f, 0.180644155f},
-std::array<float,2>{0.0431498103f, 0.799929142f},
-std::array<float,2>{0.562264264f, 0.83542186f},
-std::array<float,2>{0.365900338f, 0.249173701f},
-std::array<float,2>{0.953016102f, 0.368227273f},
-std::array<float,2>{0.173776999f, 0.517903566f},
-std::array<float,2>{0.804618895f, 0.628411353f},
-std::array<float,2>{0.0829056129f, 0.468201876f},
-std::array<float,2>{0.707592964f, 0.0375545695f},
-std::array<float,2>{0.384391516f, 0.978696644f},
-std::array<float,2>{0.852416754f, 0.761239052f},
-std::array<float,2>{0.0169024672f, 0.148014128f},
-std::array<float,2>{0.658927083f, 0.293483973f},
-std::array<float,2>{0.472000569f, 0.584582627f},
-std::array<float,2>{0.591882944f, 0.706617773f},
-std::array<float,2>{0.256855249f, 0.431741357f},
-std::array<float,2>{0.892243683f, 0.0773379207f},
-std::array<float,2>{0.204297498f, 0.876298189f},
-std::array<float,2>{0.738611639f, 0.947499394f},
-std::array<float,2>{0.417122066f, 0.024524698f},
-std::array<float,2>{0.758083165f, 0.468910336f},
-std::array<float,2>{0.10518083f, 0.665142119f},
-std::array<float,2>{0.994129062f, 0.541218996f},
-std::array<float,2>{0.131908804f, 0.319879711f},
-std::array<float,2>{0.529272795f, 0.194574237f},
-std::array<float,2>{0.318053335f, 0.870049f},
-std::array<float,2>{0.775675893f, 0.992545426f},
-std::array<float,2>{0.113242924f, 0.0486154482f},
-std::array<float,2>{0.720486939f, 0.442969263f},
-std::array<float,2>{0.435120523f, 0.641345382f},
-std::array<float,2>{0.50515449f, 0.505357146f},
-std::array<float,2>{0.33833462f, 0.354388475f},
-std::array<float,2>{0.976394117f, 0.225695208f},
-std::array<float,2>{0.148415282f, 0.826565504f},
-std::array<float,2>{0.679797888f, 0.788178861f},
-std::array<float,2>{0.491794199f, 0.168931708f},
-std::array<float,2>{0.862100422f, 0.266001672f},
-std::array<float,2>{0.00539280754f, 0.59562695f},
-std::array<float,2>{0.882045448f, 0.733423412f},
-std::array<float,2>{0.187806383f, 0.39031598f},
-std::array<float,2>{0.572066188f, 0.117697909f},
-std::array<float,2>{0.269857585f, 0.912415028f},
-std::array<float,2>{0.960791647f, 0.856753051f},
-std::array<float,2>{0.164700925f, 0.205408707f},
-std::array<float,2>{0.537517369f, 0.339416444f},
-std::array<float,2>{0.349709034f, 0.550422847f},
-std::array<float,2>{0.69380188f, 0.679461539f},
-std::array<float,2>{0.397116184f, 0.491051018f},
-std::array<float,2>{0.793423831f, 0.00305856601f},
-std::array<float,2>{0.06517075f, 0.959258974f},
-std::array<float,2>{0.609172463f, 0.897995651f},
-std::array<float,2>{0.310031623f, 0.0912875831f},
-std::array<float,2>{0.936617851f, 0.4136765f},
-std::array<float,2>{0.228007078f, 0.688565254f},
-std::array<float,2>{0.821862161f, 0.576247334f},
-std::array<float,2>{0.0498731174f, 0.307450056f},
-std::array<float,2>{0.628350496f, 0.12929216f},
-std::array<float,2>{0.442555636f, 0.776642561f},
-std::array<float,2>{0.977313697f, 0.963261068f},
-std::array<float,2>{0.152796686f, 0.0145596648f},
-std::array<float,2>{0.513191521f, 0.496317714f},
-std::array<float,2>{0.333908051f, 0.685149372f},
-std::array<float,2>{0.733688414f, 0.556119502f},
-std::array<float,2>{0.428062141f, 0.330928355f},
-std::array<float,2>{0.770238519f, 0.213994175f},
-std::array<float,2>{0.120853849f, 0.849113703f},
-std::array<float,2>{0.569509566f, 0.766338885f},
-std::array<float,2>{0.275660187f, 0.139442906f},
-std::array<float,2>{0.88773042f, 0.304248154f},
-std::array<float,2>{0.19859831f, 0.569061816f},
-std::array<float,2>{0.867885292f, 0.700426877f},
-std::array<float,2>{0.011157929f, 0.418521553f},
-std::array<float,2>{0.674789906f, 0.0829506367f},
-std::array<float,2>{0.49603191f, 0.905468225f},
-std::array<float,2>{0.788780808f, 0.818035364f},
-std::array<float,2>{0.0749915093f, 0.228446111f},
-std::array<float,2>{0.697454631f, 0.345331013f},
-std::array<float,2>{0.399490297f, 0.510741711f},
-std::array<float,2>{0.543512106f, 0.651300669f},
-std::array<float,2>{0.353663594f, 0.446436822f},
-std::array<float,2>{0.967682004f, 0.0607083775f},
-std::array<float,2>{0.162571624f, 0.992109954f},
-std::array<float,2>{0.634709358f, 0.919517338f},
-std::array<float,2>{0.447230607f, 0.115561895f},
-std::array<float,2>{0.817601621f, 0.382561803f},
-std::array<float,2>{0.0565881543f, 0.723748326f},
-std::array<float,2>{0.923102558f, 0.605082572f},
-std::array<float,2>{0.222048849f, 0.274588555f},
-std::array<float,2>{0.600303054f, 0.160086304f},
-std::array<float,2>{0.302880198f, 0.795101047f},
-std::array<float,2>{0.839903355f, 0.883977413f},
-std::array<float,2>{0.0371028446f, 0.0663648248f},
-std::array<float,2>{0.640648127f, 0.422542036f},
-std::array<float,2>{0.453869462f, 0.715470254f},
-std::array<float,2>{0.609436512f, 0.593411922f},
-std::array<float,2>{0.289133847f, 0.288895249f},
-std::array<float,2>{0.909110487f, 0.151123777f},
-std::array<float,2>{0.237923712f, 0.751488328f},
-std::array<float,2>{0.713852823f, 0.864237905f},
-std::array<float,2>{0.382023782f, 0.196929902f},
-std::array<float,2>{0.810737133f, 0.321224689f},
-std::array<float,2>{0.0883312598f, 0.536173105f},
-std::array<float,2>{0.939013481f, 0.658241689f},
-std::array<float,2>{0.182518557f, 0.479398876f},
-std::array<float,2>{0.550348401f, 0.0229555592f},
-std::array<float,2>{0.373483151f, 0.944025934f},
-std::array<float,2>{0.899963439f, 0.810400128f},
-std::array<float,2>{0.212904245f, 0.174873963f},
-std::array<float,2>{0.579939485f, 0.265376687f},
-std::array<float,2>{0.265439838f, 0.609440088f},
-std::array<float,2>{0.66852814f, 0.735809803f},
-std::array<float,2>{0.481217176f, 0.401806712f},
-std::array<float,2>{0.844788611f, 0.0991756618f},
-std::array<float,2>{0.0279146936f, 0.922181964f},
-std::array<float,2>{0.516680419f, 0.974285305f},
-std::array<float,2>{0.32220149f, 0.0413949899f},
-std::array<float,2>{0.986310601f, 0.454221666f},
-std::array<float,2>{0.140001476f, 0.640548229f},
-std::array<float,2>{0.752195477f, 0.530198455f},
-std::array<float,2>{0.0939482376f, 0.363100439f},
-std::array<float,2>{0.747161448f, 0.239931241f},
-std::array<float,2>{0.411373466f, 0.839877248f},
-std::array<float,2>{0.994226396f, 0.875265896f},
-std::array<float,2>{0.130026326f, 0.0765375495f},
-std::array<float,2>{0.530914783f, 0.4327811f},
-std::array<float,2>{0.320216f, 0.705676436f},
-std::array<float,2>{0.741834462f, 0.585479379f},
-std::array<float,2>{0.414507985f, 0.294083118f},
-std::array<float,2>{0.759950519f, 0.147313371f},
-std::array<float,2>{0.101665244f, 0.760650098f},
-std::array<float,2>{0.591081917f, 0.870637894f},
-std::array<float,2>{0.255334318f, 0.194186196f},
-std::array<float,2>{0.893498719f, 0.318893701f},
-std::array<float,2>{0.20546712f, 0.542118788f},
-std::array<float,2>{0.855057597f, 0.665009558f},
-std::array<float,2>{0.0180982314f, 0.469731331f},
-std::array<float,2>{0.658109546f, 0.0237446465f},
-std::array<float,2>{0.470372409f, 0.948676109f},
-std::array<float,2>{0.802406013f, 0.798945367f},
-std::array<float,2>{0.0842198506f, 0.181490466f},
-std::array<float,2>{0.709157765f, 0.25530538f},
-std::array<float,2>{0.384946615f, 0.623864293f},
-std::array<float,2>{0.559602559f, 0.748695195f},
-std::array<float,2>{0.365214854f, 0.392600358f},
-std::array<float,2>{0.95017451f, 0.108752191f},
-std::array<float,2>{0.174203202f, 0.93067795f},
-std::array<float,2>{0.652223945f, 0.980061114f},
-std::array<float,2>{0.462729394f, 0.0381939076f},
-std::array<float,2>{0.829751551f, 0.466919929f},
-std::array<float,2>{0.0467801429f, 0.627315342f},
-std::array<float,2>{0.916889846f, 0.519197881f},
-std::array<float,2>{0.247230649f, 0.367884904f},
-std::array<float,2>{0.622743487f, 0.248779967f},
-std::array<float,2>{0.287189752f, 0.834519863f},
-std::array<float,2>{0.823262274f, 0.960426986f},
-std::array<float,2>{0.047484491f, 0.00252049882f},
-std::array<float,2>{0.625557184f, 0.49133417f},
-std::array<float,2>{0.444431096f, 0.677918553f},
-std::array<float,2>{0.607391894f, 0.549269199f},
-std::array<float,2>{0.311230242f, 0.33879748f},
-std::array<float,2>{0.935420811f, 0.206939965f},
-std::array<float,2>{0.229501769f, 0.85576582f},
-std::array<float,2>{0.692391515f, 0.775900364f},
-std::array<float,2>{0.39471817f, 0.130510673f},
-std::array<float,2>{0.795056403f, 0.308532059f},
-std::array<float,2>{0.0641956106f, 0.57754606f},
-std::array<float,2>{0.958080888f, 0.687976599f},
-std::array<float,2>{0.166554153f, 0.41250065f},
-std::array<float,2>{0.53535217f, 0.0902194753f},
-std::array<float,2>{0.348862708f, 0.897037566f},
-std::array<float,2>{0.880699337f, 0.827927113f},
-std::array<float,2>{0.191242024f, 0.225058705f},
-std::array<float,2>{0.57342869f, 0.35525918f},
-std::array<float,2>{0.272220165f, 0.504042208f},
-std::array<float,2>{0.683085442f, 0.642173111f},
-std::array<float,2>{0.48999536f, 0.441787541f},
-std::array<float,2>{0.86014837f, 0.0471801758f},
-std::array<float,2>{0.00597157516f, 0.993828893f},
-std::array<float,2>{0.506456137f, 0.913520336f},
-std::array<float,2>{0.336547136f, 0.118651323f},
-std::array<float,2>{0.974229932f, 0.389492184f},
-std::array<float,2>{0.145335168f, 0.733382642f},
-std::array<float,2>{0.774672568f, 0.593990207f},
-std::array<float,2>{0.10949789f, 0.267406136f},
-std::array<float,2>{0.721886277f, 0.16938521f},
-std::array<float,2>{0.436033845f, 0.787687302f},
-std::array<float,2>{0.925120533f, 0.990833521f},
-std::array<float,2>{0.219344154f, 0.0619429946f},
-std::array<float,2>{0.59884578f, 0.446252763f},
-std::array<float,2>{0.302220464f, 0.651999652f},
-std::array<float,2>{0.636255682f, 0.510984302f},
-std::array<float,2>{0.448020339f, 0.343953818f},
-std::array<float,2>{0.819956899f, 0.226596951f},
-std::array<float,2>{0.0571292751f, 0.816440284f},
-std::array<float,2>{0.546268225f, 0.796760082f},
-std::array<float,2>{0.352119297f, 0.158915713f},
-std::array<float,2>{0.965906382f, 0.27420944f},
-std::array<float,2>{0.161423266f, 0.60393095f},
-std::array<float,2>{0.785967946f, 0.723265469f},
-std::array<float,2>{0.0765913725f, 0.381115466f},
-std::array<float,2>{0.696666658f, 0.116411969f},
-std::array<float,2>{0.400811911f, 0.918129623f},
-std::array<float,2>{0.869717836f, 0.84815526f},
-std::array<float,2>{0.00786953233f, 0.213757038f},
-std::array<float,2>{0.673149884f, 0.331791818f},
-std::array<float,2>{0.492495894f, 0.554723382f},
-std::array<float,2>{0.567042053f, 0.684446335f},
-std::array<float,2>{0.274879009f, 0.498003691f},
-std::array<float,2>{0.890391529f, 0.0154200261f},
-std::array<float,2>{0.197085217f, 0.964489579f},
-std::array<float,2>{0.732232988f, 0.904634118f},
-std::array<float,2>{0.425969303f, 0.083966665f},
-std::array<float,2>{0.771784723f, 0.419857085f},
-std::array<float,2>{0.118890271f, 0.699762464f},
-std::array<float,2>{0.980102718f, 0.569943011f},
-std::array<float,2>{0.155324101f, 0.303686053f},
-std::array<float,2>{0.515052676f, 0.140504688f},
-std::array<float,2>{0.335238218f, 0.766852498f},
-std::array<float,2>{0.751618981f, 0.923720956f},
-std::array<float,2>{0.0959875137f, 0.0981060416f},
-std::array<float,2>{0.748156071f, 0.401302934f},
-std::array<float,2>{0.412142068f, 0.735241532f},
-std::array<float,2>{0.517663479f, 0.610919952f},
-std::array<float,2>{0.323031396f, 0.264506102f},
-std::array<float,2>{0.987649918f, 0.17436038f},
-std::array<float,2>{0.138671368f, 0.809029222f},
-std::array<float,2>{0.671186864f, 0.841403127f},
-std::array<float,2>{0.483744085f, 0.238957584f},
-std::array<float,2>{0.847571075f, 0.361839563f},
-std::array<float,2>{0.0311470311f, 0.530338645f},
-std::array<float,2>{0.90125221f, 0.639205039f},
-std::array<float,2>{0.211121991f, 0.453167468f},
-std::array<float,2>{0.58134079f, 0.0424495451f},
-std::array<float,2>{0.262457073f, 0.972874463f},
-std::array<float,2>{0.940227091f, 0.750722289f},
-std::array<float,2>{0.181032419f, 0.151626438f},
-std::array<float,2>{0.548687756f, 0.287408233f},
-std::array<float,2>{0.371829182f, 0.591941655f},
-std::array<float,2>{0.712076008f, 0.716551661f},
-std::array<float,2>{0.380267322f, 0.42312932f},
-std::array<float,2>{0.809058309f, 0.0645101815f},
-std::array<float,2>{0.0875773951f, 0.883441508f},
-std::array<float,2>{0.61166203f, 0.944653153f},
-std::array<float,2>{0.292926818f, 0.0222955756f},
-std::array<float,2>{0.908173025f, 0.47993955f},
-std::array<float,2>{0.235971436f, 0.659429312f},
-std::array<float,2>{0.843191147f, 0.535182357f},
-std::array<float,2>{0.0388341546f, 0.321639895f},
-std::array<float,2>{0.643157005f, 0.195913255f},
-std::array<float,2>{0.455368012f, 0.864577353f},
-std::array<float,2>{0.894952536f, 0.91555202f},
-std::array<float,2>{0.209930509f, 0.109651424f},
-std::array<float,2>{0.587842405f, 0.377237886f},
-std::array<float,2>{0.250430375f, 0.718773067f},
-std::array<float,2>{0.663308322f, 0.609241307f},
-std::array<float,2>{0.473861128f, 0.279234529f},
-std::array<float,2>{0.857138634f, 0.160965428f},
-std::array<float,2>{0.0219155569f, 0.791497469f},
-std::array<float,2>{0.526987374f, 0.815464497f},
-std::array<float,2>{0.313576519f, 0.23101972f},
-std::array<float,2>{0.998737037f, 0.350023419f},
-std::array<float,2>{0.126858264f, 0.512554705f},
-std::array<float,2>{0.764648378f, 0.652569413f},
-std::array<float,2>{0.108900055f, 0.450594783f},
-std::array<float,2>{0.735649109f, 0.0569741242f},
-std::array<float,2>{0.421157807f, 0.986063957f},
-std::array<float,2>{0.834258974f, 0.773140311f},
-std::array<float,2>{0.0406229198f, 0.136020541f},
-std::array<float,2>{0.654689133f, 0.299633473f},
-std::array<float,2>{0.46851626f, 0.564712405f},
-std::array<float,2>{0.620789766f, 0.697723329f},
-std::array<float,2>{0.281421304f, 0.416176081f},
-std::array<float,2>{0.918096125f, 0.0812885612f},
-std::array<float,2>{0.24227497f, 0.900214732f},
-std::array<float,2>{0.706815839f, 0.965920925f},
-std::array<float,2>{0.389228821f, 0.00948677491f},
-std::array<float,2>{0.797788382f, 0.492194861f},
-std::array<float,2>{0.0819832608f, 0.681680918f},
-std::array<float,2>{0.94561094f, 0.560503125f},
-std::array<float,2>{0.176099837f, 0.332162112f},
-std::array<float,2>{0.557957053f, 0.215721816f},
-std::array<float,2>{0.359561473f, 0.844953299f},
-std::array<float,2>{0.790131509f, 0.972149968f},
-std::array<float,2>{0.0691482872f, 0.0431954265f},
-std::array<float,2>{0.687727809f, 0.459788412f},
-std::array<float,2>{0.394047439f, 0.633074284f},
-std::array<float,2>{0.534328997f, 0.523908019f},
-std::array<float,2>{0.344427735f, 0.366587222f},
-std::array<float,2>{0.954988539f, 0.23805365f},
-std::array<float,2>{0.169922829f, 0.839802325f},
-std::array<float,2>{0.629658163f, 0.805281162f},
-std::array<float,2>{0.440563589f, 0.176141918f},
-std::array<float,2>{0.825393856f, 0.258250207f},
-std::array<float,2>{0.0537812486f, 0.614958286f},
-std::array<float,2>{0.93038851f, 0.740562439f},
-std::array<float,2>{0.231849581f, 0.404970556f},
-std::array<float,2>{0.603676379f, 0.0969415307f},
-std::array<float,2>{0.306508869f, 0.929566681f},
-std::array<float,2>{0.96946013f, 0.859824181f},
-std::array<float,2>{0.143569753f, 0.202778563f},
-std::array<float,2>{0.500325203f, 0.326357394f},
-std::array<float,2>{0.342850506f, 0.533826351f},
-std::array<float,2>{0.72285372f, 0.660651505f},
-std::array<float,2>{0.432248265f, 0.480625629f},
-std::array<float,2>{0.777383029f, 0.0182168502f},
-std::array<float,2>{0.113446899f, 0.939283311f},
-std::array<float,2>{0.577507257f, 0.887304366f},
-std::array<float,2>{0.268284619f, 0.0680437312f},
-std::array<float,2>{0.878366351f, 0.425860465f},
-std::array<float,2>{0.194465742f, 0.714499176f},
-std::array<float,2>{0.866468847f, 0.58935374f},
-std::array<float,2>{0.00309151062f, 0.28194508f},
-std::array<float,2>{0.68672961f, 0.15538913f},
-std::array<float,2>{0.485489994f, 0.757637262f},
-std::array<float,2>{0.964141965f, 0.95234853f},
-std::array<float,2>{0.15836376f, 0.0296401195f},
-std::array<float,2>{0.542421579f, 0.473613679f},
-std::array<float,2>{0.357972622f, 0.669220924f},
-std::array<float,2>{0.70044291f, 0.544498086f},
-std::array<float,2>{0.403982013f, 0.315976441f},
-std::array<float,2>{0.781331956f, 0.191360667f},
-std::array<float,2>{0.0709357783f, 0.874937415f},
-std::array<float,2>{0.594603896f, 0.765357077f},
-std::array<float,2>{0.298501283f, 0.140809238f},
-std::array<float,2>{0.926170111f, 0.29110235f},
-std::array<float,2>{0.224837944f, 0.580992162f},
-std::array<float,2>{0.815533042f, 0.707417428f},
-std::array<float,2>{0.0597186089f, 0.435754627f},
-std::array<float,2>{0.639675617f, 0.0722263306f},
-std::array<float,2>{0.450781286f, 0.878952503f},
-std::array<float,2>{0.765955746f, 0.829330862f},
-std::array<float,2>{0.12390472f, 0.24581854f},
-std::array<float,2>{0.726866841f, 0.372934103f},
-std::array<float,2>{0.424695671f, 0.522341609f},
-std::array<float,2>{0.509878457f, 0.630408347f},
-std::array<float,2>{0.32835421f, 0.463222653f},
-std::array<float,2>{0.983248055f, 0.0325771905f},
-std::array<float,2>{0.152089432f, 0.981390953f},
-std::array<float,2>{0.67581743f, 0.936092913f},
-std::array<float,2>{0.499730557f, 0.102174483f},
-std::array<float,2>{0.872598708f, 0.395381838f},
-std::array<float,2>{0.0126889953f, 0.74329102f},
-std::array<float,2>{0.88552469f, 0.619224966f},
-std::array<float,2>{0.202114224f, 0.253762633f},
-std::array<float,2>{0.563592553f, 0.183774799f},
-std::array<float,2>{0.27781412f, 0.801324189f},
-std::array<float,2>{0.849513769f, 0.892703414f},
-std::array<float,2>{0.0247205682f, 0.0882851854f},
-std::array<float,2>{0.666222513f, 0.406369597f},
-std::array<float,2>{0.479875058f, 0.691608429f},
-std::array<float,2>{0.582308948f, 0.5709849f},
-std::array<float,2>{0.259298891f, 0.309052169f},
-std::array<float,2>{0.903302848f, 0.125175998f},
-std::array<float,2>{0.216115147f, 0.777756333f},
-std::array<float,2>{0.745837331f, 0.852174163f},
-std::array<float,2>{0.406662047f, 0.20917362f},
-std::array<float,2>{0.755280018f, 0.34048903f},
-std::array<float,2>{0.10035748f, 0.554314196f},
-std::array<float,2>{0.990231752f, 0.674027324f},
-std::array<float,2>{0.133281246f, 0.486509353f},
-std::array<float,2>{0.522228658f, 0.00568327028f},
-std::array<float,2>{0.328075916f, 0.953363597f},
-std::array<float,2>{0.910295129f, 0.784757137f},
-std::array<float,2>{0.239880636f, 0.167435557f},
-std::array<float,2>{0.616112947f, 0.27272591f},
-std::array<float,2>{0.293724984f, 0.59785068f},
-std::array<float,2>{0.647326946f, 0.730160654f},
-std::array<float,2>{0.457169682f, 0.383924663f},
-std::array<float,2>{0.837230861f, 0.124688178f},
-std::array<float,2>{0.0323478915f, 0.907009304f},
-std::array<float,2>{0.553867996f, 0.998340189f},
-std::array<float,2>{0.369671434f, 0.0518682674f},
-std::array<float,2>{0.942993939f, 0.438537717f},
-std::array<float,2>{0.185967997f, 0.645827115f},
-std::array<float,2>{0.806149542f, 0.500727177f},
-std::array<float,2>{0.0936470032f, 0.356569529f},
-std::array<float,2>{0.716691315f, 0.22049579f},
-std::array<float,2>{0.37867406f, 0.821540058f},
-std::array<float,2>{0.952846706f, 0.932338357f},
-std::array<float,2>{0.173369542f, 0.106815666f},
-std::array<float,2>{0.562014282f, 0.39211306f},
-std::array<float,2>{0.365973592f, 0.746856689f},
-std::array<float,2>{0.707976401f, 0.621785879f},
-std::array<float,2>{0.384694487f, 0.256024331f},
-std::array<float,2>{0.804372668f, 0.183475211f},
-std::array<float,2>{0.0826246291f, 0.797011077f},
-std::array<float,2>{0.62344557f, 0.832691669f},
-std::array<float,2>{0.28698799f, 0.24749732f},
-std::array<float,2>{0.914519191f, 0.370302796f},
-std::array<float,2>{0.248111531f, 0.517255127f},
-std::array<float,2>{0.830172241f, 0.626786232f},
-std::array<float,2>{0.0432812572f, 0.465238452f},
-std::array<float,2>{0.649036348f, 0.0354586914f},
-std::array<float,2>{0.463415802f, 0.977319658f},
-std::array<float,2>{0.757896185f, 0.758341908f},
-std::array<float,2>{0.105249278f, 0.146401092f},
-std::array<float,2>{0.738404453f, 0.295023173f},
-std::array<float,2>{0.417343378f, 0.583729804f},
-std::array<float,2>{0.528988242f, 0.70383811f},
-std::array<float,2>{0.318219006f, 0.430521637f},
-std::array<float,2>{0.993740082f, 0.0745361224f},
-std::array<float,2>{0.132080704f, 0.878025353f},
-std::array<float,2>{0.659175456f, 0.945439219f},
-std::array<float,2>{0.471811175f, 0.0259115845f},
-std::array<float,2>{0.852278292f, 0.471891433f},
-std::array<float,2>{0.016667299f, 0.667772114f},
-std::array<float,2>{0.89241606f, 0.539805651f},
-std::array<float,2>{0.204587489f, 0.316432506f},
-std::array<float,2>{0.592274964f, 0.192290246f},
-std::array<float,2>{0.257269114f, 0.868098855f},
-std::array<float,2>{0.861960888f, 0.996084809f},
-std::array<float,2>{0.00584575813f, 0.0493811332f},
-std::array<float,2>{0.680137575f, 0.444784671f},
-std::array<float,2>{0.491954386f, 0.643373847f},
-std::array<float,2>{0.571813226f, 0.506219983f},
-std::array<float,2>{0.269586593f, 0.351822495f},
-std::array<float,2>{0.882083058f, 0.223249748f},
-std::array<float,2>{0.187654644f, 0.824311137f},
-std::array<float,2>{0.720351875f, 0.78663069f},
-std::array<float,2>{0.435468674f, 0.171040416f},
-std::array<float,2>{0.775512159f, 0.267756015f},
-std::array<float,2>{0.11299251f, 0.597294271f},
-std::array<float,2>{0.976133525f, 0.730525851f},
-std::array<float,2>{0.147997096f, 0.388526648f},
-std::array<float,2>{0.504993916f, 0.120474398f},
-std::array<float,2>{0.337914884f, 0.911098182f},
-std::array<float,2>{0.936844587f, 0.858791292f},
-std::array<float,2>{0.227692589f, 0.203349158f},
-std::array<float,2>{0.609013617f, 0.337288737f},
-std::array<float,2>{0.309640646f, 0.54801333f},
-std::array<float,2>{0.628048837f, 0.677050114f},
-std::array<float,2>{0.442746848f, 0.48996076f},
-std::array<float,2>{0.822064221f, 0.00142408244f},
-std::array<float,2>{0.0502429865f, 0.957196414f},
-std::array<float,2>{0.53715831f, 0.894862711f},
-std::array<float,2>{0.349938244f, 0.0924137756f},
-std::array<float,2>{0.960511982f, 0.410764664f},
-std::array<float,2>{0.16491951f, 0.690178812f},
-std::array<float,2>{0.79310596f, 0.575373828f},
-std::array<float,2>{0.0652498454f, 0.30651927f},
-std::array<float,2>{0.69357127f, 0.13276875f},
-std::array<float,2>{0.397392809f, 0.774108291f},
-std::array<float,2>{0.888179123f, 0.962513864f},
-std::array<float,2>{0.198330805f, 0.0119374441f},
-std::array<float,2>{0.569607913f, 0.498870462f},
-std::array<float,2>{0.275551468f, 0.685746193f},
-std::array<float,2>{0.674550235f, 0.557273507f},
-std::array<float,2>{0.49574399f, 0.328933179f},
-std::array<float,2>{0.86811924f, 0.212221682f},
-std::array<float,2>{0.0107799927f, 0.850054741f},
-std::array<float,2>{0.513485909f, 0.768566549f},
-std::array<float,2>{0.333551407f, 0.138329357f},
-std::array<float,2>{0.977265358f, 0.30186668f},
-std::array<float,2>{0.152545825f, 0.566989601f},
-std::array<float,2>{0.770453751f, 0.702730715f},
-std::array<float,2>{0.120619707f, 0.420910299f},
-std::array<float,2>{0.733617485f, 0.0843495801f},
-std::array<float,2>{0.427788228f, 0.903838277f},
-std::array<float,2>{0.817754745f, 0.8191998f},
-std::array<float,2>{0.0561880432f, 0.228772253f},
-std::array<float,2>{0.634427726f, 0.346519828f},
-std::array<float,2>{0.446778923f, 0.507858992f},
-std::array<float,2>{0.600460052f, 0.649648905f},
-std::array<float,2>{0.30319646f, 0.448359609f},
-std::array<float,2>{0.922866762f, 0.0595807917f},
-std::array<float,2>{0.221803218f, 0.990159869f},
-std::array<float,2>{0.697533846f, 0.92067045f},
-std::array<float,2>{0.399888873f, 0.114329778f},
-std::array<float,2>{0.789041758f, 0.38015914f},
-std::array<float,2>{0.0747496188f, 0.725310922f},
-std::array<float,2>{0.967520535f, 0.601738989f},
-std::array<float,2>{0.162186623f, 0.275976568f},
-std::array<float,2>{0.543746173f, 0.157237098f},
-std::array<float,2>{0.353782535f, 0.793447137f},
-std::array<float,2>{0.810892045f, 0.886157215f},
-std::array<float,2>{0.0880736038f, 0.0633648559f},
-std::array<float,2>{0.713552594f, 0.424800009f},
-std::array<float,2>{0.382296354f, 0.717744708f},
-std::array<float,2>{0.550769031f, 0.590640068f},
-std::array<float,2>{0.373201728f, 0.286018819f},
-std::array<float,2>{0.939446032f, 0.148857772f},
-std::array<float,2>{0.182182893f, 0.753353f},
-std::array<float,2>{0.641088724f, 0.866618991f},
-std::array<float,2>{0.453842551f, 0.198811427f},
-std::array<float,2>{0.840313315f, 0.323908806f},
-std::array<float,2>{0.036772687f, 0.537652791f},
-std::array<float,2>{0.908886492f, 0.657310486f},
-std::array<float,2>{0.238215253f, 0.477442145f},
-std::array<float,2>{0.609843612f, 0.0200660639f},
-std::array<float,2>{0.289370894f, 0.941578388f},
-std::array<float,2>{0.985928297f, 0.811744273f},
-std::array<float,2>{0.139862463f, 0.17215313f},
-std::array<float,2>{0.517072618f, 0.262523144f},
-std::array<float,2>{0.321948737f, 0.613185167f},
-std::array<float,2>{0.747459888f, 0.73717314f},
-std::array<float,2>{0.411607772f, 0.399159253f},
-std::array<float,2>{0.752344787f, 0.100341074f},
-std::array<float,2>{0.0940098241f, 0.925382257f},
-std::array<float,2>{0.579742789f, 0.976426065f},
-std::array<float,2>{0.265216321f, 0.0404871404f},
-std::array<float,2>{0.900317311f, 0.456863463f},
-std::array<float,2>{0.213274166f, 0.638542771f},
-std::array<float,2>{0.845069408f, 0.528399348f},
-std::array<float,2>{0.0280965734f, 0.359562784f},
-std::array<float,2>{0.668924093f, 0.241809145f},
-std::array<float,2>{0.481147528f, 0.842325985f},
-std::array<float,2>{0.92045027f, 0.900475144f},
-std::array<float,2>{0.244431362f, 0.0786876231f},
-std::array<float,2>{0.618107975f, 0.416010678f},
-std::array<float,2>{0.283286959f, 0.696076334f},
-std::array<float,2>{0.653382361f, 0.562676907f},
-std::array<float,2>{0.466002643f, 0.297386527f},
-std::array<float,2>{0.832353055f, 0.133423641f},
-std::array<float,2>{0.0426394567f, 0.76989305f},
-std::array<float,2>{0.556553662f, 0.846997976f},
-std::array<float,2>{0.362438738f, 0.217860699f},
-std::array<float,2>{0.94870913f, 0.334343404f},
-std::array<float,2>{0.17911227f, 0.560944557f},
-std::array<float,2>{0.800341785f, 0.680260539f},
-std::array<float,2>{0.0785173923f, 0.494564772f},
-std::array<float,2>{0.70451498f, 0.0110440133f},
-std::array<float,2>{0.38710323f, 0.966862857f},
-std::array<float,2>{0.858295977f, 0.790439367f},
-std::array<float,2>{0.0212624744f, 0.163262323f},
-std::array<float,2>{0.661297023f, 0.2799941f},
-std::array<float,2>{0.475193828f, 0.605556965f},
-std::array<float,2>{0.589502275f, 0.722389519f},
-std::array<float,2>{0.252757937f, 0.376676321f},
-std::array<float,2>{0.898030877f, 0.113252439f},
-std::array<float,2>{0.208373666f, 0.917848229f},
-std::array<float,2>{0.736404777f, 0.987307668f},
-std::array<float,2>{0.418446749f, 0.0563235953f},
-std::array<float,2>{0.763310373f, 0.452824533f},
-std::array<float,2>{0.106487095f, 0.655872047f},
-std::array<float,2>{0.997461259f, 0.514791727f},
-std::array<float,2>{0.127637491f, 0.349047124f},
-std::array<float,2>{0.524478734f, 0.232516512f},
-std::array<float,2>{0.315089554f, 0.813450575f},
-std::array<float,2>{0.779948592f, 0.939466536f},
-std::array<float,2>{0.115547918f, 0.0175053179f},
-std::array<float,2>{0.725961447f, 0.483846009f},
-std::array<float,2>{0.431086421f, 0.663227499f},
-std::array<float,2>{0.503567457f, 0.532332361f},
-std::array<float,2>{0.339924455f, 0.324381948f},
-std::array<float,2>{0.971918225f, 0.199787572f},
-std::array<float,2>{0.14176397f, 0.862978518f},
-std::array<float,2>{0.683796644f, 0.754748285f},
-std::array<float,2>{0.487713724f, 0.154175937f},
-std::array<float,2>{0.864197612f, 0.285102695f},
-std::array<float,2>{0.00044403004f, 0.58724612f},
-std::array<float,2>{0.875430226f, 0.711692393f},
-std::array<float,2>{0.1926184f, 0.428423077f},
-std::array<float,2>{0.574830115f, 0.0685493276f},
-std::array<float,2>{0.267003894f, 0.888756752f},
-std::array<float,2>{0.956145287f, 0.836715221f},
-std::array<float,2>{0.168348461f, 0.235642657f},
-std::array<float,2>{0.531538546f, 0.365230888f},
-std::array<float,2>{0.347432971f, 0.526887298f},
-std::array<float,2>{0.690644681f, 0.635083437f},
-std::array<float,2>{0.391844541f, 0.457799524f},
-std::array<float,2>{0.792535007f, 0.0462715328f},
-std::array<float,2>{0.0678478554f, 0.969264507f},
-std::array<float,2>{0.602187395f, 0.925913036f},
-std::array<float,2>{0.308010787f, 0.0939357206f},
-std::array<float,2>{0.932289124f, 0.402396917f},
-std::array<float,2>{0.233722463f, 0.739721298f},
-std::array<float,2>{0.827563524f, 0.61617583f},
-std::array<float,2>{0.0516388975f, 0.260792226f},
-std::array<float,2>{0.631956756f, 0.178847164f},
-std::array<float,2>{0.439263612f, 0.807880461f},
-std::array<float,2>{0.982306182f, 0.983573437f},
-std::array<float,2>{0.148947209f, 0.0340726152f},
-std::array<float,2>{0.509546518f, 0.462701291f},
-std::array<float,2>{0.330220878f, 0.630998254f},
-std::array<float,2>{0.728807449f, 0.520995438f},
-std::array<float,2>{0.422535002f, 0.373518527f},
-std::array<float,2>{0.767686367f, 0.243284404f},
-std::array<float,2>{0.122058623f, 0.831238449f},
-std::array<float,2>{0.564543664f, 0.80437237f},
-std::array<float,2>{0.279518872f, 0.186487466f},
-std::array<float,2>{0.88463062f, 0.251491517f},
-std::array<float,2>{0.200420871f, 0.618222117f},
-std::array<float,2>{0.873051047f, 0.745432317f},
-std::array<float,2>{0.015024133f, 0.397312939f},
-std::array<float,2>{0.67892772f, 0.105445951f},
-std::array<float,2>{0.496815145f, 0.934279978f},
-std::array<float,2>{0.784397244f, 0.871991396f},
-std::array<float,2>{0.0725006014f, 0.187928587f},
-std::array<float,2>{0.701914251f, 0.312944591f},
-std::array<float,2>{0.404333055f, 0.546571851f},
-std::array<float,2>{0.54041183f, 0.670092046f},
-std::array<float,2>{0.356188327f, 0.475801617f},
-std::array<float,2>{0.962780058f, 0.0291142724f},
-std::array<float,2>{0.156757236f, 0.950012863f},
-std::array<float,2>{0.638308167f, 0.88175869f},
-std::array<float,2>{0.452439755f, 0.0725472346f},
-std::array<float,2>{0.813999534f, 0.433864117f},
-std::array<float,2>{0.0608984679f, 0.709854901f},
-std::array<float,2>{0.928652108f, 0.580061078f},
-std::array<float,2>{0.223650753f, 0.290274203f},
-std::array<float,2>{0.596687019f, 0.143634349f},
-std::array<float,2>{0.299753189f, 0.761724234f},
-std::array<float,2>{0.83882004f, 0.908587396f},
-std::array<float,2>{0.0344775096f, 0.121924758f},
-std::array<float,2>{0.644560337f, 0.386271328f},
-std::array<float,2>{0.460189223f, 0.726707757f},
-std::array<float,2>{0.613428533f, 0.600261271f},
-std::array<float,2>{0.295368373f, 0.269941211f},
-std::array<float,2>{0.912637591f, 0.164783135f},
-std::array<float,2>{0.241344079f, 0.781410217f},
-std::array<float,2>{0.716972649f, 0.823194146f},
-std::array<float,2>{0.376042664f, 0.222385183f},
-std::array<float,2>{0.80787617f, 0.357438356f},
-std::array<float,2>{0.0910324082f, 0.502676964f},
-std::array<float,2>{0.944821954f, 0.647620678f},
-std::array<float,2>{0.184174508f, 0.439627707f},
-std::array<float,2>{0.551306844f, 0.0529060401f},
-std::array<float,2>{0.367672503f, 0.996441245f},
-std::array<float,2>{0.905597746f, 0.779305518f},
-std::array<float,2>{0.21721755f, 0.128399074f},
-std::array<float,2>{0.584227264f, 0.312088758f},
-std::array<float,2>{0.261328697f, 0.572584867f},
-std::array<float,2>{0.665758848f, 0.694805324f},
-std::array<float,2>{0.477676868f, 0.408571243f},
-std::array<float,2>{0.849695742f, 0.0876838043f},
-std::array<float,2>{0.0268052723f, 0.891887426f},
-std::array<float,2>{0.521094561f, 0.955404222f},
-std::array<float,2>{0.325915277f, 0.00765225058f},
-std::array<float,2>{0.990475297f, 0.485369086f},
-std::array<float,2>{0.136668861f, 0.672305763f},
-std::array<float,2>{0.755916595f, 0.551569581f},
-std::array<float,2>{0.0982757285f, 0.342810512f},
-std::array<float,2>{0.742349744f, 0.207533628f},
-std::array<float,2>{0.409483373f, 0.854121447f},
-std::array<float,2>{0.973135769f, 0.912071228f},
-std::array<float,2>{0.145887241f, 0.119432271f},
-std::array<float,2>{0.507308125f, 0.386842072f},
-std::array<float,2>{0.337355554f, 0.732130647f},
-std::array<float,2>{0.72115171f, 0.596151173f},
-std::array<float,2>{0.436806828f, 0.268819749f},
-std::array<float,2>{0.773774624f, 0.170346782f},
-std::array<float,2>{0.111231253f, 0.785412073f},
-std::array<float,2>{0.572709203f, 0.825316608f},
-std::array<float,2>{0.27309829f, 0.22387886f},
-std::array<float,2>{0.87926209f, 0.353074461f},
-std::array<float,2>{0.189778149f, 0.507250607f},
-std::array<float,2>{0.860917449f, 0.643829167f},
-std::array<float,2>{0.00740611786f, 0.443434566f},
-std::array<float,2>{0.682391286f, 0.0500254631f},
-std::array<float,2>{0.488977969f, 0.994190037f},
-std::array<float,2>{0.796783566f, 0.77532357f},
-std::array<float,2>{0.0625949949f, 0.130971953f},
-std::array<float,2>{0.691823959f, 0.305133909f},
-std::array<float,2>{0.39609468f, 0.574832439f},
-std::array<float,2>{0.53638345f, 0.691372156f},
-std::array<float,2>{0.347873956f, 0.411234945f},
-std::array<float,2>{0.957154095f, 0.0931905061f},
-std::array<float,2>{0.167103022f, 0.896352768f},
-std::array<float,2>{0.626226664f, 0.958046019f},
-std::array<float,2>{0.443392813f, 0.000830260746f},
-std::array<float,2>{0.82259208f, 0.488400429f},
-std::array<float,2>{0.0485695265f, 0.6762532f},
-std::array<float,2>{0.933887124f, 0.547441721f},
-std::array<float,2>{0.229427144f, 0.335941046f},
-std::array<float,2>{0.605669558f, 0.204299599f},
-std::array<float,2>{0.311722964f, 0.857947946f},
-std::array<float,2>{0.828570604f, 0.977598131f},
-std::array<float,2>{0.0455349833f, 0.0365705304f},
-std::array<float,2>{0.650506198f, 0.466531008f},
-std::array<float,2>{0.461483181f, 0.625405371f},
-std::array<float,2>{0.621186972f, 0.516345561f},
-std::array<float,2>{0.288704664f, 0.369422734f},
-std::array<float,2>{0.917835116f, 0.246365815f},
-std::array<float,2>{0.246346131f, 0.833570123f},
-std::array<float,2>{0.710362494f, 0.798130274f},
-std::array<float,2>{0.385904044f, 0.182442605f},
-std::array<float,2>{0.801196396f, 0.257092118f},
-std::array<float,2>{0.0853475258f, 0.622212172f},
-std::array<float,2>{0.950929582f, 0.747569859f},
-std::array<float,2>{0.17524533f, 0.390923738f},
-std::array<float,2>{0.55937022f, 0.106179468f},
-std::array<float,2>{0.363696694f, 0.932966471f},
-std::array<float,2>{0.894016147f, 0.868274748f},
-std::array<float,2>{0.206561416f, 0.192396075f},
-std::array<float,2>{0.590698779f, 0.317928344f},
-std::array<float,2>{0.254596055f, 0.540878952f},
-std::array<float,2>{0.65687573f, 0.666631699f},
-std::array<float,2>{0.469323367f, 0.471016765f},
-std::array<float,2>{0.853741705f, 0.0269437749f},
-std::array<float,2>{0.0192790739f, 0.946598232f},
-std::array<float,2>{0.529609919f, 0.8771891f},
-std::array<float,2>{0.318872154f, 0.0755172744f},
-std::array<float,2>{0.995409846f, 0.430865258f},
-std::array<float,2>{0.129373938f, 0.704472601f},
-std::array<float,2>{0.76145947f, 0.582143486f},
-std::array<float,2>{0.103398651f, 0.296209902f},
-std::array<float,2>{0.741073608f, 0.145013213f},
-std::array<float,2>{0.415263116f, 0.759021044f},
-std::array<float,2>{0.906353354f, 0.942573667f},
-std::array<float,2>{0.234779269f, 0.0210996699f},
-std::array<float,2>{0.613093197f, 0.477814406f},
-std::array<float,2>{0.291742474f, 0.656775355f},
-std::array<float,2>{0.643792033f, 0.538120031f},
-std::array<float,2>{0.456300855f, 0.322374642f},
-std::array<float,2>{0.842207909f, 0.198014155f},
-std::array<float,2>{0.0379397869f, 0.865449488f},
-std::array<float,2>{0.547746539f, 0.752255499f},
-std::array<float,2>{0.372242123f, 0.1503077f},
-std::array<float,2>{0.941100895f, 0.286713392f},
-std::array<float,2>{0.180592194f, 0.590826511f},
-std::array<float,2>{0.810332179f, 0.717938006f},
-std::array<float,2>{0.0864383727f, 0.425669581f},
-std::array<float,2>{0.711347818f, 0.0644497797f},
-std::array<float,2>{0.379184127f, 0.884791672f},
-std::array<float,2>{0.846209288f, 0.843502998f},
-std::array<float,2>{0.029444024f, 0.240617558f},
-std::array<float,2>{0.669988811f, 0.360674262f},
-std::array<float,2>{0.482901543f, 0.527502596f},
-std::array<float,2>{0.580480516f, 0.637174726f},
-std::array<float,2>{0.263113886f, 0.455932498f},
-std::array<float,2>{0.902002156f, 0.0394189879f},
-std::array<float,2>{0.212037921f, 0.974944949f},
-std::array<float,2>{0.749941111f, 0.924661875f},
-std::array<float,2>{0.413547903f, 0.101304233f},
-std::array<float,2>{0.750240862f, 0.399981588f},
-std::array<float,2>{0.0967186764f, 0.738254309f},
-std::array<float,2>{0.986627698f, 0.611663699f},
-std::array<float,2>{0.137021005f, 0.262830675f},
-std::array<float,2>{0.519204021f, 0.17317903f},
-std::array<float,2>{0.324217081f, 0.811285913f},
-std::array<float,2>{0.772541344f, 0.903039873f},
-std::array<float,2>{0.117710523f, 0.0857167691f},
-std::array<float,2>{0.730696857f, 0.420015365f},
-std::array<float,2>{0.427386492f, 0.702099264f},
-std::array<float,2>{0.513784826f, 0.567912936f},
-std::array<float,2>{0.334137619f, 0.301084101f},
-std::array<float,2>{0.979343235f, 0.137105852f},
-std::array<float,2>{0.154968381f, 0.76776886f},
-std::array<float,2>{0.672446549f, 0.850610793f},
-std::array<float,2>{0.493952423f, 0.211802319f},
-std::array<float,2>{0.870863497f, 0.329181373f},
-std::array<float,2>{0.00887923408f, 0.558546901f},
-std::array<float,2>{0.88932997f, 0.686621785f},
-std::array<float,2>{0.196251541f, 0.499228388f},
-std::array<float,2>{0.567719519f, 0.0129154157f},
-std::array<float,2>{0.273844719f, 0.96185863f},
-std::array<float,2>{0.96556896f, 0.794530094f},
-std::array<float,2>{0.160741463f, 0.156628326f},
-std::array<float,2>{0.545655668f, 0.276986986f},
-std::array<float,2>{0.353440285f, 0.602875173f},
-std::array<float,2>{0.695785284f, 0.726007223f},
-std::array<float,2>{0.401381433f, 0.379000157f},
-std::array<float,2>{0.786668539f, 0.113563336f},
-std::array<float,2>{0.0775917917f, 0.921183169f},
-std::array<float,2>{0.598622561f, 0.988512039f},
-std::array<float,2>{0.301167578f, 0.0593224615f},
-std::array<float,2>{0.923838615f, 0.44820264f},
-std::array<float,2>{0.220274627f, 0.649053991f},
-std::array<float,2>{0.818724632f, 0.50958693f},
-std::array<float,2>{0.0577231981f, 0.347212166f},
-std::array<float,2>{0.634902894f, 0.230412215f},
-std::array<float,2>{0.44920817f, 0.819430888f},
-std::array<float,2>{0.877331316f, 0.890032172f},
-std::array<float,2>{0.193396449f, 0.0697376281f},
-std::array<float,2>{0.576296568f, 0.429413825f},
-std::array<float,2>{0.26914981f, 0.712265372f},
-std::array<float,2>{0.686112642f, 0.586824775f},
-std::array<float,2>{0.484936416f, 0.284178674f},
-std::array<float,2>{0.865437627f, 0.152718082f},
-std::array<float,2>{0.00224034721f, 0.755368412f},
-std::array<float,2>{0.501109958f, 0.86191839f},
-std::array<float,2>{0.342414856f, 0.200967208f},
-std::array<float,2>{0.970231116f, 0.325911701f},
-std::array<float,2>{0.143392652f, 0.531784058f},
-std::array<float,2>{0.779221117f, 0.663049161f},
-std::array<float,2>{0.11450801f, 0.482928246f},
-std::array<float,2>{0.724165916f, 0.0158947632f},
-std::array<float,2>{0.432902277f, 0.940535486f},
-std::array<float,2>{0.824658155f, 0.806946993f},
-std::array<float,2>{0.0532585867f, 0.178466588f},
-std::array<float,2>{0.630180478f, 0.260488629f},
-std::array<float,2>{0.440391719f, 0.617114604f},
-std::array<float,2>{0.605028093f, 0.738476753f},
-std::array<float,2>{0.304902643f, 0.403528064f},
-std::array<float,2>{0.930992007f, 0.0948619545f},
-std::array<float,2>{0.23076658f, 0.927062869f},
-std::array<float,2>{0.688954711f, 0.970555544f},
-std::array<float,2>{0.393212318f, 0.0449491106f},
-std::array<float,2>{0.789893806f, 0.458268821f},
-std::array<float,2>{0.0698622838f, 0.63637197f},
-std::array<float,2>{0.953155458f, 0.526044607f},
-std::array<float,2>{0.171256244f, 0.364066541f},
-std::array<float,2>{0.534177005f, 0.234758466f},
-std::array<float,2>{0.344788104f, 0.837426007f},
-std::array<float,2>{0.797925651f, 0.968259573f},
-std::array<float,2>{0.08050327f, 0.0101485131f},
-std::array<float,2>{0.705941081f, 0.495293885f},
-std::array<float,2>{0.390367627f, 0.681114197f},
-std::array<float,2>{0.557420075f, 0.56161654f},
-std::array<float,2>{0.360822171f, 0.335868418f},
-std::array<float,2>{0.947197914f, 0.216873541f},
-std::array<float,2>{0.177615166f, 0.845952511f},
-std::array<float,2>{0.65596652f, 0.771184862f},
-std::array<float,2>{0.466887295f, 0.134671643f},
-std::array<float,2>{0.835705876f, 0.298591733f},
-std::array<float,2>{0.0394088551f, 0.564360499f},
-std::array<float,2>{0.919462323f, 0.696728528f},
-std::array<float,2>{0.243341476f, 0.414796054f},
-std::array<float,2>{0.619743288f, 0.0792846158f},
-std::array<float,2>{0.282591283f, 0.901846766f},
-std::array<float,2>{0.99978739f, 0.81394738f},
-std::array<float,2>{0.125283256f, 0.234032154f},
-std::array<float,2>{0.525402784f, 0.348369658f},
-std::array<float,2>{0.312619567f, 0.514640331f},
-std::array<float,2>{0.734433591f, 0.655014694f},
-std::array<float,2>{0.420142859f, 0.451622069f},
-std::array<float,2>{0.765131116f, 0.0554532744f},
-std::array<float,2>{0.10757678f, 0.987083077f},
-std::array<float,2>{0.586502969f, 0.916026711f},
-std::array<float,2>{0.251489758f, 0.112143442f},
-std::array<float,2>{0.895976126f, 0.375759602f},
-std::array<float,2>{0.210551366f, 0.721035779f},
-std::array<float,2>{0.855649412f, 0.607250869f},
-std::array<float,2>{0.0229226295f, 0.280871511f},
-std::array<float,2>{0.662253559f, 0.162550375f},
-std::array<float,2>{0.473521739f, 0.789438963f},
-std::array<float,2>{0.942354143f, 0.997135639f},
-std::array<float,2>{0.187361747f, 0.0540535189f},
-std::array<float,2>{0.553469002f, 0.440901518f},
-std::array<float,2>{0.370842904f, 0.64728725f},
-std::array<float,2>{0.714892924f, 0.503102899f},
-std::array<float,2>{0.377220273f, 0.358492732f},
-std::array<float,2>{0.805293977f, 0.221631855f},
-std::array<float,2>{0.0919653028f, 0.82326293f},
-std::array<float,2>{0.617175281f, 0.78291738f},
-std::array<float,2>{0.294319212f, 0.165528834f},
-std::array<float,2>{0.911529243f, 0.270693034f},
-std::array<float,2>{0.238681272f, 0.60060209f},
-std::array<float,2>{0.836616814f, 0.727579594f},
-std::array<float,2>{0.0315966122f, 0.385368973f},
-std::array<float,2>{0.648006916f, 0.122092031f},
-std::array<float,2>{0.458124042f, 0.9095608f},
-std::array<float,2>{0.754425824f, 0.85536623f},
-std::array<float,2>{0.100791618f, 0.208325341f},
-std::array<float,2>{0.744284809f, 0.342739344f},
-std::array<float,2>{0.40747568f, 0.552605271f},
-std::array<float,2>{0.522944748f, 0.673521876f},
-std::array<float,2>{0.326778531f, 0.484861344f},
-std::array<float,2>{0.988891006f, 0.00644962722f},
-std::array<float,2>{0.134571061f, 0.957023263f},
-std::array<float,2>{0.667327583f, 0.891467512f},
-std::array<float,2>{0.478814006f, 0.0865858868f},
-std::array<float,2>{0.847927094f, 0.409294039f},
-std::array<float,2>{0.0238329675f, 0.693395317f},
-std::array<float,2>{0.903498709f, 0.573799253f},
-std::array<float,2>{0.214867696f, 0.311005622f},
-std::array<float,2>{0.583349049f, 0.127714366f},
-std::array<float,2>{0.257960349f, 0.781048954f},
-std::array<float,2>{0.871344268f, 0.934741378f},
-std::array<float,2>{0.0135049643f, 0.103913046f},
-std::array<float,2>{0.677163661f, 0.39794597f},
-std::array<float,2>{0.498684108f, 0.744615078f},
-std::array<float,2>{0.562936604f, 0.61723423f},
-std::array<float,2>{0.278986663f, 0.250700712f},
-std::array<float,2>{0.885949314f, 0.186993673f},
-std::array<float,2>{0.202811539f, 0.803503692f},
-std::array<float,2>{0.72843039f, 0.830911696f},
-std::array<float,2>{0.425188392f, 0.242794514f},
-std::array<float,2>{0.766707659f, 0.374683857f},
-std::array<float,2>{0.124025919f, 0.520362735f},
-std::array<float,2>{0.98415935f, 0.632465005f},
-std::array<float,2>{0.151239723f, 0.461292624f},
-std::array<float,2>{0.511013746f, 0.0346383639f},
-std::array<float,2>{0.330010384f, 0.982891798f},
-std::array<float,2>{0.92693305f, 0.763186991f},
-std::array<float,2>{0.225707501f, 0.143287286f},
-std::array<float,2>{0.595382273f, 0.289063275f},
-std::array<float,2>{0.296916813f, 0.578829885f},
-std::array<float,2>{0.638889551f, 0.710375369f},
-std::array<float,2>{0.449955761f, 0.434699595f},
-std::array<float,2>{0.814925909f, 0.0736102909f},
-std::array<float,2>{0.0589715876f, 0.881994843f},
-std::array<float,2>{0.541318655f, 0.951150596f},
-std::array<float,2>{0.359112144f, 0.0277652573f},
-std::array<float,2>{0.963154376f, 0.474649936f},
-std::array<float,2>{0.159709901f, 0.671000421f},
-std::array<float,2>{0.783117235f, 0.545421243f},
-std::array<float,2>{0.072183378f, 0.313707501f},
-std::array<float,2>{0.699892223f, 0.189346939f},
-std::array<float,2>{0.402860045f, 0.872279048f},
-std::array<float,2>{0.959178388f, 0.897664487f},
-std::array<float,2>{0.165839359f, 0.0916883498f},
-std::array<float,2>{0.538313508f, 0.413514644f},
-std::array<float,2>{0.35066548f, 0.689305127f},
-std::array<float,2>{0.694965005f, 0.576881766f},
-std::array<float,2>{0.397685558f, 0.306890577f},
-std::array<float,2>{0.794336319f, 0.129490733f},
-std::array<float,2>{0.0657831356f, 0.777019978f},
-std::array<float,2>{0.607614696f, 0.857352853f},
-std::array<float,2>{0.309372723f, 0.205872372f},
-std::array<float,2>{0.936467886f, 0.339058101f},
-std::array<float,2>{0.227029756f, 0.549969137f},
-std::array<float,2>{0.82065171f, 0.67871654f},
-std::array<float,2>{0.0494542792f, 0.490294904f},
-std::array<float,2>{0.627283871f, 0.00377821224f},
-std::array<float,2>{0.441774219f, 0.959773004f},
-std::array<float,2>{0.776454747f, 0.788586736f},
-std::array<float,2>{0.112284437f, 0.168080181f},
-std::array<float,2>{0.719402075f, 0.266594797f},
-std::array<float,2>{0.434566736f, 0.594901621f},
-std::array<float,2>{0.504430413f, 0.734032452f},
-std::array<float,2>{0.339286923f, 0.390122682f},
-std::array<float,2>{0.975139618f, 0.117515981f},
-std::array<float,2>{0.147011772f, 0.912756801f},
-std::array<float,2>{0.68163693f, 0.992719471f},
-std::array<float,2>{0.490869224f, 0.0482891276f},
-std::array<float,2>{0.863264799f, 0.442530155f},
-std::array<float,2>{0.00454508187f, 0.64099586f},
-std::array<float,2>{0.881300867f, 0.505752265f},
-std::array<float,2>{0.189115986f, 0.353976011f},
-std::array<float,2>{0.571208715f, 0.226187244f},
-std::array<float,2>{0.271370083f, 0.826812685f},
-std::array<float,2>{0.853304684f, 0.947807252f},
-std::array<float,2>{0.0156689696f, 0.0253618415f},
-std::array<float,2>{0.659879148f, 0.46931538f},
-std::array<float,2>{0.471395522f, 0.665703654f},
-std::array<float,2>{0.592823029f, 0.541656494f},
-std::array<float,2>{0.256274998f, 0.319432467f},
-std::array<float,2>{0.891180634f, 0.195312142f},
-std::array<float,2>{0.20313102f, 0.86947161f},
-std::array<float,2>{0.739281535f, 0.760842741f},
-std::array<float,2>{0.416639179f, 0.147759795f},
-std::array<float,2>{0.759442806f, 0.293062985f},
-std::array<float,2>{0.103977717f, 0.584258676f},
-std::array<float,2>{0.992290914f, 0.706324458f},
-std::array<float,2>{0.131303906f, 0.432420701f},
-std::array<float,2>{0.528293312f, 0.077931419f},
-std::array<float,2>{0.316808611f, 0.876685381f},
-std::array<float,2>{0.915724099f, 0.835700154f},
-std::array<float,2>{0.249458179f, 0.249746874f},
-std::array<float,2>{0.624381423f, 0.369019568f},
-std::array<float,2>{0.285225481f, 0.518388093f},
-std::array<float,2>{0.64980489f, 0.628594995f},
-std::array<float,2>{0.464147836f, 0.468569845f},
-std::array<float,2>{0.831527293f, 0.0376480706f},
-std::array<float,2>{0.0448382087f, 0.979440212f},
-std::array<float,2>{0.560611188f, 0.930233657f},
-std::array<float,2>{0.367127419f, 0.107488923f},
-std::array<float,2>{0.951759875f, 0.394449085f},
-std::array<float,2>{0.172586128f, 0.749406874f},
-std::array<float,2>{0.803645074f, 0.624546647f},
-std::array<float,2>{0.0833887234f, 0.254555374f},
-std::array<float,2>{0.708971322f, 0.180127904f},
-std::array<float,2>{0.383633852f, 0.800479829f},
-std::array<float,2>{0.898921549f, 0.97402662f},
-std::array<float,2>{0.213900194f, 0.0417477712f},
-std::array<float,2>{0.578166068f, 0.454728842f},
-std::array<float,2>{0.263703436f, 0.639742851f},
-std::array<float,2>{0.669735849f, 0.529696763f},
-std::array<float,2>{0.482216954f, 0.362726122f},
-std::array<float,2>{0.84466964f, 0.239343286f},
-std::array<float,2>{0.0285301823f, 0.840698719f},
-std::array<float,2>{0.515917122f, 0.80986774f},
-std::array<float,2>{0.320888668f, 0.175602689f},
-std::array<float,2>{0.984800696f, 0.264763534f},
-std::array<float,2>{0.138729483f, 0.610091627f},
-std::array<float,2>{0.753748655f, 0.735975325f},
-std::array<float,2>{0.095256865f, 0.401895374f},
-std::array<float,2>{0.746323287f, 0.0990417004f},
-std::array<float,2>{0.410205632f, 0.922743857f},
-std::array<float,2>{0.841079533f, 0.86368221f},
-std::array<float,2>{0.0360366255f, 0.196408838f},
-std::array<float,2>{0.642371655f, 0.32072854f},
-std::array<float,2>{0.454425246f, 0.536700249f},
-std::array<float,2>{0.611059666f, 0.658831656f},
-std::array<float,2>{0.290548563f, 0.478762418f},
-std::array<float,2>{0.909490466f, 0.022506047f},
-std::array<float,2>{0.237118363f, 0.943381429f},
-std::array<float,2>{0.714364588f, 0.884635568f},
-std::array<float,2>{0.381764293f, 0.0654524639f},
-std::array<float,2>{0.812134385f, 0.422234386f},
-std::array<float,2>{0.0888895094f, 0.715170979f},
-std::array<float,2>{0.937877297f, 0.59290421f},
-std::array<float,2>{0.182650059f, 0.288512826f},
-std::array<float,2>{0.548843861f, 0.150516376f},
-std::array<float,2>{0.374925733f, 0.751462936f},
-std::array<float,2>{0.7876122f, 0.91930449f},
-std::array<float,2>{0.0753137246f, 0.115888931f},
-std::array<float,2>{0.698401093f, 0.382073969f},
-std::array<float,2>{0.399159461f, 0.724171162f},
-std::array<float,2>{0.544022262f, 0.60451442f},
-std::array<float,2>{0.354832292f, 0.274923027f},
-std::array<float,2>{0.96859014f, 0.159490123f},
-std::array<float,2>{0.163984329f, 0.795778096f},
-std::array<float,2>{0.632829487f, 0.817621052f},
-std::array<float,2>{0.44578445f, 0.22775428f},
-std::array<float,2>{0.817061365f, 0.345148712f},
-std::array<float,2>{0.0555224605f, 0.510101318f},
-std::array<float,2>{0.92238903f, 0.650664806f},
-std::array<float,2>{0.220908061f, 0.447198778f},
-std::array<float,2>{0.60139972f, 0.061358396f},
-std::array<float,2>{0.304544836f, 0.991604149f},
-std::array<float,2>{0.978491366f, 0.766024947f},
-std::array<float,2>{0.153643355f, 0.138735965f},
-std::array<float,2>{0.512424052f, 0.303760022f},
-std::array<float,2>{0.332558155f, 0.568421423f},
-std::array<float,2>{0.732832551f, 0.701029837f},
-std::array<float,2>{0.429272801f, 0.418234557f},
-std::array<float,2>{0.770922184f, 0.0824143142f},
-std::array<float,2>{0.119640186f, 0.906150758f},
-std::array<float,2>{0.568568051f, 0.963646293f},
-std::array<float,2>{0.277138084f, 0.0137168877f},
-std::array<float,2>{0.887471616f, 0.496809214f},
-std::array<float,2>{0.197321534f, 0.684939981f},
-std::array<float,2>{0.868799865f, 0.55616498f},
-std::array<float,2>{0.0103697283f, 0.33043623f},
-std::array<float,2>{0.67482686f, 0.214385077f},
-std::array<float,2>{0.494423896f, 0.849354804f},
-std::array<float,2>{0.933010757f, 0.927766204f},
-std::array<float,2>{0.232505679f, 0.0964524224f},
-std::array<float,2>{0.603449821f, 0.405332237f},
-std::array<float,2>{0.307399213f, 0.741594553f},
-std::array<float,2>{0.631120145f, 0.613284171f},
-std::array<float,2>{0.438111931f, 0.258991212f},
-std::array<float,2>{0.826877058f, 0.177182361f},
-std::array<float,2>{0.0518957824f, 0.806211829f},
-std::array<float,2>{0.53225565f, 0.838848591f},
-std::array<float,2>{0.345807642f, 0.237293899f},
-std::array<float,2>{0.95524931f, 0.365409493f},
-std::array<float,2>{0.169864967f, 0.525068939f},
-std::array<float,2>{0.791187704f, 0.634662628f},
-std::array<float,2>{0.0667043105f, 0.460065961f},
-std::array<float,2>{0.689585328f, 0.0444456972f},
-std::array<float,2>{0.390748858f, 0.970971107f},
-std::array<float,2>{0.864591837f, 0.756492317f},
-std::array<float,2>{0.00176893233f, 0.155154213f},
-std::array<float,2>{0.684927106f, 0.282282323f},
-std::array<float,2>{0.487210333f, 0.588266015f},
-std::array<float,2>{0.575948f, 0.713493347f},
-std::array<float,2>{0.265857786f, 0.427497327f},
-std::array<float,2>{0.876639605f, 0.0668578669f},
-std::array<float,2>{0.19190523f, 0.888374627f},
-std::array<float,2>{0.724917948f, 0.938117623f},
-std::array<float,2>{0.429919511f, 0.0190399438f},
-std::array<float,2>{0.781148851f, 0.481563598f},
-std::array<float,2>{0.116595961f, 0.661161005f},
-std::array<float,2>{0.970970273f, 0.534433603f},
-std::array<float,2>{0.14114204f, 0.327765435f},
-std::array<float,2>{0.502732813f, 0.201177746f},
-std::array<float,2>{0.341601223f, 0.861300766f},
-std::array<float,2>{0.762619376f, 0.984926283f},
-std::array<float,2>{0.106036223f, 0.0582437702f},
-std::array<float,2>{0.737783909f, 0.450182468f},
-std::array<float,2>{0.419437051f, 0.654158473f},
-std::array<float,2>{0.524397075f, 0.513270557f},
-std::array<float,2>{0.316160977f, 0.350934237f},
-std::array<float,2>{0.996248484f, 0.231922731f},
-std::array<float,2>{0.128789842f, 0.815108776f},
-std::array<float,2>{0.660722196f, 0.792631447f},
-std::array<float,2>{0.475931972f, 0.161844969f},
-std::array<float,2>{0.859038293f, 0.277562201f},
-std::array<float,2>{0.0204086434f, 0.607859075f},
-std::array<float,2>{0.896833837f, 0.720329523f},
-std::array<float,2>{0.207070723f, 0.378068388f},
-std::array<float,2>{0.58793962f, 0.111259416f},
-std::array<float,2>{0.253442168f, 0.914311111f},
-std::array<float,2>{0.948082864f, 0.843927324f},
-std::array<float,2>{0.178056464f, 0.216286823f},
-std::array<float,2>{0.555435717f, 0.333980292f},
-std::array<float,2>{0.361604869f, 0.558733165f},
-std::array<float,2>{0.703676462f, 0.683244944f},
-std::array<float,2>{0.387867153f, 0.493709117f},
-std::array<float,2>{0.799004078f, 0.0084080603f},
-std::array<float,2>{0.0800026804f, 0.964932263f},
-std::array<float,2>{0.618880391f, 0.899346113f},
-std::array<float,2>{0.284180999f, 0.0805389658f},
-std::array<float,2>{0.921468854f, 0.417246759f},
-std::array<float,2>{0.246046111f, 0.69915849f},
-std::array<float,2>{0.833951354f, 0.565600753f},
-std::array<float,2>{0.0410394557f, 0.30032444f},
-std::array<float,2>{0.652788222f, 0.135072082f},
-std::array<float,2>{0.465765119f, 0.772153318f},
-std::array<float,2>{0.991273701f, 0.954616129f},
-std::array<float,2>{0.135315597f, 0.00397139881f},
-std::array<float,2>{0.520247817f, 0.487663001f},
-std::array<float,2>{0.325000495f, 0.675323427f},
-std::array<float,2>{0.743820429f, 0.553009868f},
-std::array<float,2>{0.40865916f, 0.341380507f},
-std::array<float,2>{0.756967008f, 0.21035026f},
-std::array<float,2>{0.0990605056f, 0.852643311f},
-std::array<float,2>{0.585553229f, 0.778499424f},
-std::array<float,2>{0.260265023f, 0.126484558f},
-std::array<float,2>{0.904857278f, 0.309812963f},
-std::array<float,2>{0.217893258f, 0.572074771f},
-std::array<float,2>{0.850689769f, 0.693299532f},
-std::array<float,2>{0.0259804875f, 0.408030808f},
-std::array<float,2>{0.664872885f, 0.0889807343f},
-std::array<float,2>{0.476616383f, 0.894379854f},
-std::array<float,2>{0.807144523f, 0.82114768f},
-std::array<float,2>{0.0900977179f, 0.219569728f},
-std::array<float,2>{0.718527257f, 0.355668604f},
-std::array<float,2>{0.375312537f, 0.501892984f},
-std::array<float,2>{0.552369237f, 0.644861937f},
-std::array<float,2>{0.369109869f, 0.437784314f},
-std::array<float,2>{0.94358927f, 0.051532235f},
-std::array<float,2>{0.18501538f, 0.999843776f},
-std::array<float,2>{0.646437407f, 0.908067167f},
-std::array<float,2>{0.459339947f, 0.123906858f},
-std::array<float,2>{0.839807212f, 0.383546025f},
-std::array<float,2>{0.0341168046f, 0.728844345f},
-std::array<float,2>{0.91383481f, 0.59935075f},
-std::array<float,2>{0.240998894f, 0.27226612f},
-std::array<float,2>{0.614646852f, 0.166185781f},
-std::array<float,2>{0.29650104f, 0.783725739f},
-std::array<float,2>{0.812735021f, 0.880779803f},
-std::array<float,2>{0.0622299165f, 0.0711700544f},
-std::array<float,2>{0.63678956f, 0.436701089f},
-std::array<float,2>{0.451497346f, 0.708187521f},
-std::array<float,2>{0.595926106f, 0.58164835f},
-std::array<float,2>{0.300085634f, 0.292710453f},
-std::array<float,2>{0.928854346f, 0.141653016f},
-std::array<float,2>{0.22339049f, 0.763838708f},
-std::array<float,2>{0.702539682f, 0.873411179f},
-std::array<float,2>{0.406152576f, 0.190363809f},
-std::array<float,2>{0.78363961f, 0.315178573f},
-std::array<float,2>{0.0734831467f, 0.543722272f},
-std::array<float,2>{0.961698055f, 0.66831249f},
-std::array<float,2>{0.15802452f, 0.473865956f},
-std::array<float,2>{0.539446771f, 0.0310218949f},
-std::array<float,2>{0.35694927f, 0.951996982f},
-std::array<float,2>{0.88323462f, 0.8018682f},
-std::array<float,2>{0.200124845f, 0.185245797f},
-std::array<float,2>{0.566112399f, 0.252015114f},
-std::array<float,2>{0.280483514f, 0.620259225f},
-std::array<float,2>{0.678706884f, 0.742778361f},
-std::array<float,2>{0.498013914f, 0.395907372f},
-std::array<float,2>{0.874133945f, 0.102707364f},
-std::array<float,2>{0.0141101219f, 0.937320113f},
-std::array<float,2>{0.508521438f, 0.981991351f},
-std::array<float,2>{0.331616938f, 0.0321678519f},
-std::array<float,2>{0.980953634f, 0.464067817f},
-std::array<float,2>{0.149699137f, 0.629181266f},
-std::array<float,2>{0.769250453f, 0.522570372f},
-std::array<float,2>{0.122588128f, 0.371423304f},
-std::array<float,2>{0.72995615f, 0.245030642f},
-std::array<float,2>{0.423808187f, 0.82888335f},
-std::array<float,2>{0.978805125f, 0.905740082f},
-std::array<float,2>{0.154417619f, 0.0825575367f},
-std::array<float,2>{0.51462394f, 0.418822497f},
-std::array<float,2>{0.334876567f, 0.700627685f},
-std::array<float,2>{0.731049061f, 0.569133997f},
-std::array<float,2>{0.426789194f, 0.30449459f},
-std::array<float,2>{0.773261547f, 0.139199525f},
-std::array<float,2>{0.117642686f, 0.766406834f},
-std::array<float,2>{0.568337619f, 0.848708749f},
-std::array<float,2>{0.274283856f, 0.214180008f},
-std::array<float,2>{0.888956666f, 0.33056879f},
-std::array<float,2>{0.195650294f, 0.5556795f},
-std::array<float,2>{0.870508373f, 0.685434401f},
-std::array<float,2>{0.00959357433f, 0.496429741f},
-std::array<float,2>{0.671902359f, 0.0142546818f},
-std::array<float,2>{0.493616492f, 0.962923288f},
-std::array<float,2>{0.786373019f, 0.795298517f},
-std::array<float,2>{0.0780742392f, 0.159816355f},
-std::array<float,2>{0.69596684f, 0.274731964f},
-std::array<float,2>{0.40210405f, 0.605413079f},
-std::array<float,2>{0.545061946f, 0.724066138f},
-std::array<float,2>{0.352846056f, 0.38274464f},
-std::array<float,2>{0.96509105f, 0.115274541f},
-std::array<float,2>{0.160560861f, 0.919738114f},
-std::array<float,2>{0.635398746f, 0.991930664f},
-std::array<float,2>{0.44835037f, 0.0608145297f},
-std::array<float,2>{0.819137514f, 0.446618587f},
-std::array<float,2>{0.0581660643f, 0.651010096f},
-std::array<float,2>{0.924537361f, 0.510442257f},
-std::array<float,2>{0.220122039f, 0.34548682f},
-std::array<float,2>{0.597824454f, 0.228050143f},
-std::array<float,2>{0.301677734f, 0.818150342f},
-std::array<float,2>{0.842743993f, 0.944274843f},
-std::array<float,2>{0.0372451507f, 0.0232364181f},
-std::array<float,2>{0.644326985f, 0.479047269f},
-std::array<float,2>{0.456804335f, 0.658487976f},
-std::array<float,2>{0.612544358f, 0.536455929f},
-std::array<float,2>{0.291449517f, 0.320817024f},
-std::array<float,2>{0.907136202f, 0.197131678f},
-std::array<float,2>{0.235070303f, 0.863885999f},
-std::array<float,2>{0.711716354f, 0.751765013f},
-std::array<float,2>{0.379602194f, 0.151016772f},
-std::array<float,2>{0.810051084f, 0.288651556f},
-std::array<float,2>{0.0862650573f, 0.593608201f},
-std::array<float,2>{0.940589607f, 0.715819359f},
-std::array<float,2>{0.179730535f, 0.422816306f},
-std::array<float,2>{0.547119021f, 0.0660462454f},
-std::array<float,2>{0.372963428f, 0.884081423f},
-std::array<float,2>{0.901546776f, 0.840156317f},
-std::array<float,2>{0.212604165f, 0.240148246f},
-std::array<float,2>{0.581013441f, 0.362926036f},
-std::array<float,2>{0.263237596f, 0.530019343f},
-std::array<float,2>{0.670528889f, 0.64017725f},
-std::array<float,2>{0.482928902f, 0.454557925f},
-std::array<float,2>{0.845746219f, 0.0411075428f},
-std::array<float,2>{0.0299970545f, 0.974371016f},
-std::array<float,2>{0.518752754f, 0.921896398f},
-std::array<float,2>{0.323399246f, 0.0995822847f},
-std::array<float,2>{0.987103581f, 0.401605695f},
-std::array<float,2>{0.137360752f, 0.735502541f},
-std::array<float,2>{0.750847459f, 0.609799027f},
-std::array<float,2>{0.0972135738f, 0.265518993f},
-std::array<float,2>{0.749199629f, 0.175280407f},
-std::array<float,2>{0.413630515f, 0.810275197f},
-std::array<float,2>{0.917014301f, 0.978763998f},
-std::array<float,2>{0.246863887f, 0.0372948013f},
-std::array<float,2>{0.622013509f, 0.467931271f},
-std::array<float,2>{0.288329363f, 0.627972305f},
-std::array<float,2>{0.651302874f, 0.517613351f},
-std::array<float,2>{0.461125493f, 0.368440002f},
-std::array<float,2>{0.828683853f, 0.249469027f},
-std::array<float,2>{0.045298446f, 0.835024953f},
-std::array<float,2>{0.559026957f, 0.800263107f},
-std::array<float,2>{0.363833368f, 0.180377826f},
-std::array<float,2>{0.950551867f, 0.254317492f},
-std::array<float,2>{0.175435945f, 0.62412107f},
-std::array<float,2>{0.801344812f, 0.749705672f},
-std::array<float,2>{0.0859197304f, 0.393698007f},
-std::array<float,2>{0.710658193f, 0.108202375f},
-std::array<float,2>{0.386620164f, 0.929810166f},
-std::array<float,2>{0.854452014f, 0.8697474f},
-std::array<float,2>{0.0188512914f, 0.194712326f},
-std::array<float,2>{0.656590998f, 0.320212603f},
-std::array<float,2>{0.468975753f, 0.541260481f},
-std::array<float,2>{0.590145528f, 0.665512085f},
-std::array<float,2>{0.254205167f, 0.469178736f},
-std::array<float,2>{0.894319952f, 0.0246959254f},
-std::array<float,2>{0.206310198f, 0.947683096f},
-std::array<float,2>{0.740467131f, 0.876071095f},
-std::array<float,2>{0.41555059f, 0.0774144456f},
-std::array<float,2>{0.761028767f, 0.432109922f},
-std::array<float,2>{0.102701023f, 0.706950784f},
-std::array<float,2>{0.996041954f, 0.584819019f},
-std::array<float,2>{0.129737526f, 0.293857843f},
-std::array<float,2>{0.529870927f, 0.148239553f},
-std::array<float,2>{0.318820685f, 0.761534154f},
-std::array<float,2>{0.774324059f, 0.912338138f},
-std::array<float,2>{0.110666029f, 0.118147351f},
-std::array<float,2>{0.721266806f, 0.390453041f},
-std::array<float,2>{0.437372535f, 0.733718812f},
-std::array<float,2>{0.507464111f, 0.595340371f},
-std::array<float,2>{0.337617368f, 0.26564762f},
-std::array<float,2>{0.973202109f, 0.168650016f},
-std::array<float,2>{0.14600414f, 0.788534343f},
-std::array<float,2>{0.682081521f, 0.826347709f},
-std::array<float,2>{0.488552749f, 0.226071313f},
-std::array<float,2>{0.860377252f, 0.354182988f},
-std::array<float,2>{0.00684903329f, 0.504926205f},
-std::array<float,2>{0.87961334f, 0.64139235f},
-std::array<float,2>{0.190234199f, 0.443185776f},
-std::array<float,2>{0.572846293f, 0.0485114604f},
-std::array<float,2>{0.272705555f, 0.992301762f},
-std::array<float,2>{0.957953215f, 0.776553988f},
-std::array<float,2>{0.1675556f, 0.129020154f},
-std::array<float,2>{0.53674376f, 0.307300359f},
-std::array<float,2>{0.348520696f, 0.576417685f},
-std::array<float,2>{0.692301929f, 0.688897014f},
-std::array<float,2>{0.395553261f, 0.413821876f},
-std::array<float,2>{0.796220541f, 0.0909633413f},
-std::array<float,2>{0.0630700141f, 0.898313224f},
-std::array<float,2>{0.606347203f, 0.959149241f},
-std::array<float,2>{0.312300205f, 0.0032542441f},
-std::array<float,2>{0.934411168f, 0.490917683f},
-std::array<float,2>{0.228937f, 0.679349422f},
-std::array<float,2>{0.823052585f, 0.550666869f},
-std::array<float,2>{0.0479946323f, 0.33975932f},
-std::array<float,2>{0.626929641f, 0.205105528f},
-std::array<float,2>{0.443961918f, 0.856548309f},
-std::array<float,2>{0.886614144f, 0.93661797f},
-std::array<float,2>{0.202364892f, 0.103074253f},
-std::array<float,2>{0.563166976f, 0.396474987f},
-std::array<float,2>{0.278718293f, 0.742414355f},
-std::array<float,2>{0.67773056f, 0.620764315f},
-std::array<float,2>{0.498316705f, 0.252734601f},
-std::array<float,2>{0.871676981f, 0.184718221f},
-std::array<float,2>{0.0128986966f, 0.802323878f},
-std::array<float,2>{0.511664867f, 0.828573585f},
-std::array<float,2>{0.329457909f, 0.244479239f},
-std::array<float,2>{0.98387748f, 0.371699214f},
-std::array<float,2>{0.150701091f, 0.52324307f},
-std::array<float,2>{0.767435193f, 0.629685223f},
-std::array<float,2>{0.124973752f, 0.464751095f},
-std::array<float,2>{0.727627218f, 0.031294886f},
-std::array<float,2>{0.425341874f, 0.981540799f},
-std::array<float,2>{0.815057874f, 0.764478922f},
-std::array<float,2>{0.0593374632f, 0.142396793f},
-std::array<float,2>{0.639549017f, 0.292121291f},
-std::array<float,2>{0.449319988f, 0.581376255f},
-std::array<float,2>{0.594887376f, 0.708768427f},
-std::array<float,2>{0.297400564f, 0.437048227f},
-std::array<float,2>{0.927395165f, 0.0705935359f},
-std::array<float,2>{0.226354331f, 0.880333781f},
-std::array<float,2>{0.699432492f, 0.951355159f},
-std::array<float,2>{0.402634501f, 0.0307477191f},
-std::array<float,2>{0.782248259f, 0.474536836f},
-std::array<float,2>{0.0716356635f, 0.668878496f},
-std::array<float,2>{0.963424861f, 0.543173969f},
-std::array<float,2>{0.159385011f, 0.314494371f},
-std::array<float,2>{0.541758299f, 0.189752355f},
-std::array<float,2>{0.358809322f, 0.873751223f},
-std::array<float,2>{0.805099308f, 0.999050975f},
-std::array<float,2>{0.0925298482f, 0.050984975f},
-std::array<float,2>{0.715435207f, 0.43839097f},
-std::array<float,2>{0.377445281f, 0.645329475f},
-std::array<float,2>{0.552960277f, 0.501042962f},
-std::array<float,2>{0.370272458f, 0.356362224f},
-std::array<float,2>{0.941759169f, 0.219160601f},
-std::array<float,2>{0.186616465f, 0.820693612f},
-std::array<float,2>{0.647897065f, 0.783670604f},
-std::array<float,2>{0.45849818f, 0.166791469f},
-std::array<float,2>{0.835993409f, 0.271826982f},
-std::array<float,2>{0.0322059914f, 0.598916769f},
-std::array<float,2>{0.911839545f, 0.729465902f},
-std::array<float,2>{0.239171967f, 0.38299641f},
-std::array<float,2>{0.616657674f, 0.123464525f},
-std::array<float,2>{0.294681847f, 0.907651842f},
-std::array<float,2>{0.988761544f, 0.853343546f},
-std::array<float,2>{0.133872911f, 0.210826084f},
-std::array<float,2>{0.523215055f, 0.341264307f},
-std::array<float,2>{0.326516449f, 0.553528488f},
-std::array<float,2>{0.745048404f, 0.675271928f},
-std::array<float,2>{0.407786667f, 0.488004148f},
-std::array<float,2>{0.754157305f, 0.00479628285f},
-std::array<float,2>{0.101150513f, 0.954547644f},
-std::array<float,2>{0.583896339f, 0.893890262f},
-std::array<float,2>{0.25833413f, 0.0895129442f},
-std::array<float,2>{0.904230893f, 0.407593548f},
-std::array<float,2>{0.215500027f, 0.692529917f},
-std::array<float,2>{0.848511338f, 0.571366489f},
-std::array<float,2>{0.024407791f, 0.310332179f},
-std::array<float,2>{0.667960107f, 0.126444653f},
-std::array<float,2>{0.479349226f, 0.779083312f},
-std::array<float,2>{0.946315646f, 0.965379357f},
-std::array<float,2>{0.177074164f, 0.0079198936f},
-std::array<float,2>{0.556854844f, 0.493550003f},
-std::array<float,2>{0.36095956f, 0.682639956f},
-std::array<float,2>{0.705308974f, 0.559387326f},
-std::array<float,2>{0.389811724f, 0.333348751f},
-std::array<float,2>{0.798801839f, 0.216406494f},
-std::array<float,2>{0.0805822685f, 0.844265103f},
-std::array<float,2>{0.619188368f, 0.771812379f},
-std::array<float,2>{0.282790065f, 0.135345206f},
-std::array<float,2>{0.919321716f, 0.299958736f},
-std::array<float,2>{0.244037688f, 0.566049695f},
-std::array<float,2>{0.835082531f, 0.698496878f},
-std::array<float,2>{0.0398698114f, 0.417591691f},
-std::array<float,2>{0.655496836f, 0.0807309896f},
-std::array<float,2>{0.467503607f, 0.898776412f},
-std::array<float,2>{0.765313029f, 0.81487608f},
-std::array<float,2>{0.107969292f, 0.232207686f},
-std::array<float,2>{0.734888852f, 0.351398975f},
-std::array<float,2>{0.42051807f, 0.513136208f},
-std::array<float,2>{0.526155353f, 0.653692603f},
-std::array<float,2>{0.313294202f, 0.449275076f},
-std::array<float,2>{0.999133646f, 0.057745751f},
-std::array<float,2>{0.125891656f, 0.984767497f},
-std::array<float,2>{0.66266048f, 0.914845765f},
-std::array<float,2>{0.472815573f, 0.110736541f},
-std::array<float,2>{0.856083453f, 0.37847361f},
-std::array<float,2>{0.0232543685f, 0.720213592f},
-std::array<float,2>{0.896203518f, 0.60823071f},
-std::array<float,2>{0.21002005f, 0.278201789f},
-std::array<float,2>{0.586235821f, 0.161598548f},
-std::array<float,2>{0.251105905f, 0.792045832f},
-std::array<float,2>{0.8660689f, 0.888123274f},
-std::array<float,2>{0.00277728378f, 0.0669543296f},
-std::array<float,2>{0.685700059f, 0.427027881f},
-std::array<float,2>{0.48480764f, 0.713083982f},
-std::array<float,2>{0.577077389f, 0.588449538f},
-std::array<float,2>{0.269021153f, 0.282747746f},
-std::array<float,2>{0.877732575f, 0.15442799f},
-std::array<float,2>{0.194197416f, 0.756254971f},
-std::array<float,2>{0.723931015f, 0.860376596f},
-std::array<float,2>{0.433586389f, 0.201853082f},
-std::array<float,2>{0.778517127f, 0.327466995f},
-std::array<float,2>{0.114984885f, 0.535079837f},
-std::array<float,2>{0.969867945f, 0.661987126f},
-std::array<float,2>{0.143003866f, 0.482289374f},
-std::array<float,2>{0.501910508f, 0.0191617981f},
-std::array<float,2>{0.341996342f, 0.937922895f},
-std::array<float,2>{0.931193709f, 0.805988133f},
-std::array<float,2>{0.23127538f, 0.177582845f},
-std::array<float,2>{0.604507923f, 0.259689629f},
-std::array<float,2>{0.305206627f, 0.614117801f},
-std::array<float,2>{0.63082391f, 0.74187243f},
-std::array<float,2>{0.439765155f, 0.406100571f},
-std::array<float,2>{0.824914634f, 0.0961280763f},
-std::array<float,2>{0.0527375117f, 0.928581297f},
-std::array<float,2>{0.533370197f, 0.971522331f},
-std::array<float,2>{0.345250636f, 0.0441293456f},
-std::array<float,2>{0.953637958f, 0.460907429f},
-std::array<float,2>{0.171611041f, 0.633813322f},
-std::array<float,2>{0.789337099f, 0.524531782f},
-std::array<float,2>{0.0694814473f, 0.366182238f},
-std::array<float,2>{0.688999534f, 0.236670062f},
-std::array<float,2>{0.392585874f, 0.838293314f},
-std::array<float,2>{0.967864215f, 0.921504438f},
-std::array<float,2>{0.163187489f, 0.114172019f},
-std::array<float,2>{0.544482946f, 0.379868269f},
-std::array<float,2>{0.355079293f, 0.726100743f},
-std::array<float,2>{0.698892593f, 0.603417516f},
-std::array<float,2>{0.398687303f, 0.276815683f},
-std::array<float,2>{0.787516654f, 0.157075286f},
-std::array<float,2>{0.0761294886f, 0.79399699f},
-std::array<float,2>{0.601030827f, 0.819854259f},
-std::array<float,2>{0.303931266f, 0.22988081f},
-std::array<float,2>{0.921983242f, 0.346970379f},
-std::array<float,2>{0.221499264f, 0.508859456f},
-std::array<float,2>{0.816556096f, 0.64869231f},
-std::array<float,2>{0.0547653921f, 0.447575897f},
-std::array<float,2>{0.633490026f, 0.0586900674f},
-std::array<float,2>{0.446211576f, 0.988856792f},
-std::array<float,2>{0.77104193f, 0.768224955f},
-std::array<float,2>{0.119198807f, 0.137592584f},
-std::array<float,2>{0.733262897f, 0.301702321f},
-std::array<float,2>{0.428762615f, 0.567408264f},
-std::array<float,2>{0.512112498f, 0.70124948f},
-std::array<float,2>{0.332322955f, 0.420859307f},
-std::array<float,2>{0.977644861f, 0.0850359723f},
-std::array<float,2>{0.154221565f, 0.902500331f},
-std::array<float,2>{0.675577283f, 0.961191058f},
-std::array<float,2>{0.49470064f, 0.0132241258f},
-std::array<float,2>{0.868282318f, 0.49977383f},
-std::array<float,2>{0.00995187648f, 0.687261522f},
-std::array<float,2>{0.886900544f, 0.557658911f},
-std::array<float,2>{0.19790405f, 0.33000496f},
-std::array<float,2>{0.568944991f, 0.211084962f},
-std::array<float,2>{0.276449054f, 0.851501584f},
-std::array<float,2>{0.844112396f, 0.9754498f},
-std::array<float,2>{0.0288860053f, 0.0398270115f},
-std::array<float,2>{0.669158101f, 0.455415547f},
-std::array<float,2>{0.481600553f, 0.637613356f},
-std::array<float,2>{0.578819692f, 0.528166175f},
-std::array<float,2>{0.264306277f, 0.361273795f},
-std::array<float,2>{0.899372399f, 0.240898773f},
-std::array<float,2>{0.214801103f, 0.843053341f},
-std::array<float,2>{0.746582389f, 0.810589492f},
-std::array<float,2>{0.410771012f, 0.173670143f},
-std::array<float,2>{0.753366888f, 0.263538897f},
-std::array<float,2>{0.0947293267f, 0.612243831f},
-std::array<float,2>{0.985276341f, 0.73739481f},
-std::array<float,2>{0.139447898f, 0.399756819f},
-std::array<float,2>{0.516529083f, 0.101055361f},
-std::array<float,2>{0.320621222f, 0.924248993f},
-std::array<float,2>{0.909978867f, 0.865953743f},
-std::array<float,2>{0.236531109f, 0.197395295f},
-std::array<float,2>{0.610753894f, 0.323215336f},
-std::array<float,2>{0.290068865f, 0.538861811f},
-std::array<float,2>{0.641606569f, 0.656365216f},
-std::array<float,2>{0.454863042f, 0.478052646f},
-std::array<float,2>{0.841774046f, 0.0207594279f},
-std::array<float,2>{0.0356157236f, 0.943227828f},
-std::array<float,2>{0.549748778f, 0.885733783f},
-std::array<float,2>{0.374243855f, 0.0637142211f},
-std::array<float,2>{0.938329101f, 0.42523405f},
-std::array<float,2>{0.183413267f, 0.718300521f},
-std::array<float,2>{0.811607063f, 0.591381133f},
-std::array<float,2>{0.0894082561f, 0.286554992f},
-std::array<float,2>{0.714202464f, 0.1495855f},
-std::array<float,2>{0.381328851f, 0.75279963f},
-std::array<float,2>{0.890914619f, 0.947223127f},
-std::array<float,2>{0.203814864f, 0.0266092252f},
-std::array<float,2>{0.593730569f, 0.47163561f},
-std::array<float,2>{0.256634802f, 0.666269243f},
-std::array<float,2>{0.659328222f, 0.540237963f},
-std::array<float,2>{0.470941633f, 0.317798138f},
-std::array<float,2>{0.852802753f, 0.19332011f},
-std::array<float,2>{0.0165111888f, 0.86910069f},
-std::array<float,2>{0.527784705f, 0.759501636f},
-std::array<float,2>{0.316902429f, 0.145376444f},
-std::array<float,2>{0.992811084f, 0.296454012f},
-std::array<float,2>{0.131827772f, 0.582607508f},
-std::array<float,2>{0.758970082f, 0.704942644f},
-std::array<float,2>{0.10435883f, 0.431275636f},
-std::array<float,2>{0.739978075f, 0.0757554024f},
-std::array<float,2>{0.416350693f, 0.877667844f},
-std::array<float,2>{0.83199501f, 0.833239675f},
-std::array<float,2>{0.0443250649f, 0.246625587f},
-std::array<float,2>{0.650375605f, 0.370026916f},
-std::array<float,2>{0.464538962f, 0.516105056f},
-std::array<float,2>{0.624870479f, 0.625802815f},
-std::array<float,2>{0.285679489f, 0.466295928f},
-std::array<float,2>{0.915195227f, 0.0370286256f},
-std::array<float,2>{0.249774978f, 0.978052735f},
-std::array<float,2>{0.70831722f, 0.93334496f},
-std::array<float,2>{0.382899642f, 0.105471581f},
-std::array<float,2>{0.802952409f, 0.391158462f},
-std::array<float,2>{0.0835557729f, 0.747149467f},
-std::array<float,2>{0.951442063f, 0.622651041f},
-std::array<float,2>{0.171985209f, 0.257785738f},
-std::array<float,2>{0.561394393f, 0.18211852f},
-std::array<float,2>{0.36622709f, 0.798784673f},
-std::array<float,2>{0.794722438f, 0.895615697f},
-std::array<float,2>{0.0663570762f, 0.0936228707f},
-std::array<float,2>{0.694813132f, 0.411624253f},
-std::array<float,2>{0.398074538f, 0.690716207f},
-std::array<float,2>{0.538766026f, 0.574267149f},
-std::array<float,2>{0.351390749f, 0.30521974f},
-std::array<float,2>{0.959553003f, 0.131403431f},
-std::array<float,2>{0.165057838f, 0.774543643f},
-std::array<float,2>{0.627728939f, 0.857793689f},
-std::array<float,2>{0.442301899f, 0.204635605f},
-std::array<float,2>{0.821252465f, 0.33659628f},
-std::array<float,2>{0.0492914692f, 0.547305346f},
-std::array<float,2>{0.935711861f, 0.676481783f},
-std::array<float,2>{0.227391019f, 0.488914073f},
-std::array<float,2>{0.608396709f, 0.000349928625f},
-std::array<float,2>{0.3086676f, 0.958939373f},
-std::array<float,2>{0.974880219f, 0.786053777f},
-std::array<float,2>{0.146966189f, 0.170755953f},
-std::array<float,2>{0.503990471f, 0.269074261f},
-std::array<float,2>{0.339822799f, 0.596510768f},
-std::array<float,2>{0.719177246f, 0.731692255f},
-std::array<float,2>{0.433896154f, 0.38764134f},
-std::array<float,2>{0.776871681f, 0.119806066f},
-std::array<float,2>{0.111523688f, 0.911197543f},
-std::array<float,2>{0.570793986f, 0.994982779f},
-std::array<float,2>{0.270884335f, 0.0502947941f},
-std::array<float,2>{0.881802201f, 0.444316477f},
-std::array<float,2>{0.18865709f, 0.644229412f},
-std::array<float,2>{0.862442911f, 0.507737577f},
-std::array<float,2>{0.00412762817f, 0.352734715f},
-std::array<float,2>{0.68091315f, 0.224509776f},
-std::array<float,2>{0.490295321f, 0.82596004f},
-std::array<float,2>{0.929504037f, 0.882485449f},
-std::array<float,2>{0.223134786f, 0.0737336725f},
-std::array<float,2>{0.596617818f, 0.435147524f},
-std::array<float,2>{0.300478548f, 0.71047169f},
-std::array<float,2>{0.63747257f, 0.5782727f},
-std::array<float,2>{0.451868176f, 0.289567173f},
-std::array<float,2>{0.813180506f, 0.142602354f},
-std::array<float,2>{0.061729908f, 0.763117731f},
-std::array<float,2>{0.539670885f, 0.872889757f},
-std::array<float,2>{0.356638908f, 0.188681185f},
-std::array<float,2>{0.961365461f, 0.314397782f},
-std::array<float,2>{0.157654002f, 0.545173287f},
-std::array<float,2>{0.783940434f, 0.671388566f},
-std::array<float,2>{0.0738156363f, 0.475396961f},
-std::array<float,2>{0.702786982f, 0.0280226525f},
-std::array<float,2>{0.405401438f, 0.950608671f},
-std::array<float,2>{0.874814034f, 0.803174555f},
-std::array<float,2>{0.0142546147f, 0.187322199f},
-std::array<float,2>{0.677794516f, 0.250261128f},
-std::array<float,2>{0.497291058f, 0.61780864f},
-std::array<float,2>{0.565766037f, 0.745087564f},
-std::array<float,2>{0.280968308f, 0.398044884f},
-std::array<float,2>{0.883332133f, 0.104390137f},
-std::array<float,2>{0.199561536f, 0.93531841f},
-std::array<float,2>{0.73032248f, 0.983388662f},
-std::array<float,2>{0.422905415f, 0.0348172523f},
-std::array<float,2>{0.768648922f, 0.461764902f},
-std::array<float,2>{0.122304596f, 0.63224256f},
-std::array<float,2>{0.981423676f, 0.519653559f},
-std::array<float,2>{0.150268599f, 0.374363184f},
-std::array<float,2>{0.508050442f, 0.242511064f},
-std::array<float,2>{0.331296533f, 0.830329478f},
-std::array<float,2>{0.75747031f, 0.956542015f},
-std::array<float,2>{0.0991332009f, 0.00619951123f},
-std::array<float,2>{0.74336499f, 0.485033095f},
-std::array<float,2>{0.408888876f, 0.67305994f},
-std::array<float,2>{0.519593656f, 0.552052557f},
-std::array<float,2>{0.324604839f, 0.342174739f},
-std::array<float,2>{0.992155313f, 0.208962187f},
-std::array<float,2>{0.134825289f, 0.854944468f},
-std::array<float,2>{0.664110184f, 0.780747175f},
-std::array<float,2>{0.477246791f, 0.12720339f},
-std::array<float,2>{0.851137817f, 0.31108278f},
-std::array<float,2>{0.0255041644f, 0.573281467f},
-std::array<float,2>{0.904622853f, 0.694113433f},
-std::array<float,2>{0.218721598f, 0.409959942f},
-std::array<float,2>{0.585266531f, 0.0859732404f},
-std::array<float,2>{0.25988704f, 0.890998721f},
-std::array<float,2>{0.94416666f, 0.823731124f},
-std::array<float,2>{0.185202658f, 0.221141249f},
-std::array<float,2>{0.552187502f, 0.359340042f},
-std::array<float,2>{0.368525505f, 0.503725767f},
-std::array<float,2>{0.717986345f, 0.64685595f},
-std::array<float,2>{0.37574172f, 0.44113037f},
-std::array<float,2>{0.807118356f, 0.0543286689f},
-std::array<float,2>{0.0904794335f, 0.997643113f},
-std::array<float,2>{0.61513108f, 0.909912944f},
-std::array<float,2>{0.296309114f, 0.122683145f},
-std::array<float,2>{0.91353184f, 0.385092258f},
-std::array<float,2>{0.240308017f, 0.728166699f},
-std::array<float,2>{0.839044571f, 0.601204872f},
-std::array<float,2>{0.0333062448f, 0.271459311f},
-std::array<float,2>{0.64591372f, 0.165327802f},
-std::array<float,2>{0.459479064f, 0.782448411f},
-std::array<float,2>{0.996789753f, 0.986525178f},
-std::array<float,2>{0.128040716f, 0.0551115014f},
-std::array<float,2>{0.523507953f, 0.451756328f},
-std::array<float,2>{0.315533638f, 0.654751301f},
-std::array<float,2>{0.73792243f, 0.514090717f},
-std::array<float,2>{0.419423878f, 0.347803622f},
-std::array<float,2>{0.761740267f, 0.233672783f},
-std::array<float,2>{0.105956286f, 0.81423229f},
-std::array<float,2>{0.588490844f, 0.789615571f},
-std::array<float,2>{0.253292948f, 0.162832916f},
-std::array<float,2>{0.897381246f, 0.280421019f},
-std::array<float,2>{0.207690045f, 0.606918097f},
-std::array<float,2>{0.858412206f, 0.7213341f},
-std::array<float,2>{0.0199260004f, 0.375148803f},
-std::array<float,2>{0.660440743f, 0.111572914f},
-std::array<float,2>{0.476454139f, 0.916517615f},
-std::array<float,2>{0.799726427f, 0.846348822f},
-std::array<float,2>{0.079225637f, 0.217285976f},
-std::array<float,2>{0.703170717f, 0.335446239f},
-std::array<float,2>{0.388547838f, 0.56213069f},
-std::array<float,2>{0.55483216f, 0.681294978f},
-std::array<float,2>{0.362124175f, 0.49590835f},
-std::array<float,2>{0.947383046f, 0.0105617661f},
-std::array<float,2>{0.178583249f, 0.968263805f},
-std::array<float,2>{0.65303576f, 0.902276754f},
-std::array<float,2>{0.465043634f, 0.079677321f},
-std::array<float,2>{0.833422661f, 0.414255977f},
-std::array<float,2>{0.0418624543f, 0.697117805f},
-std::array<float,2>{0.920979738f, 0.563668549f},
-std::array<float,2>{0.245501727f, 0.298078299f},
-std::array<float,2>{0.618374348f, 0.134107068f},
-std::array<float,2>{0.284896612f, 0.770594776f},
-std::array<float,2>{0.826507747f, 0.927275419f},
-std::array<float,2>{0.0523620658f, 0.0955183581f},
-std::array<float,2>{0.63151443f, 0.404068619f},
-std::array<float,2>{0.437740535f, 0.738990784f},
-std::array<float,2>{0.602691293f, 0.61654979f},
-std::array<float,2>{0.306795031f, 0.259808332f},
-std::array<float,2>{0.933445632f, 0.178162664f},
-std::array<float,2>{0.233212337f, 0.807225764f},
-std::array<float,2>{0.690250695f, 0.83735466f},
-std::array<float,2>{0.391458094f, 0.235130668f},
-std::array<float,2>{0.791869164f, 0.363417f},
-std::array<float,2>{0.0670076534f, 0.525659204f},
-std::array<float,2>{0.95578593f, 0.635828257f},
-std::array<float,2>{0.16910708f, 0.458676249f},
-std::array<float,2>{0.532856345f, 0.0454288051f},
-std::array<float,2>{0.346245468f, 0.970026433f},
-std::array<float,2>{0.876345396f, 0.755669475f},
-std::array<float,2>{0.191774011f, 0.153140992f},
-std::array<float,2>{0.575367153f, 0.283657908f},
-std::array<float,2>{0.266518235f, 0.586378872f},
-std::array<float,2>{0.685348988f, 0.712537646f},
-std::array<float,2>{0.48658973f, 0.429134279f},
-std::array<float,2>{0.864814878f, 0.0698269159f},
-std::array<float,2>{0.00130011747f, 0.890298724f},
-std::array<float,2>{0.502269447f, 0.941266537f},
-std::array<float,2>{0.341147453f, 0.0161843728f},
-std::array<float,2>{0.971674979f, 0.482904851f},
-std::array<float,2>{0.140687332f, 0.66254878f},
-std::array<float,2>{0.780493438f, 0.531453073f},
-std::array<float,2>{0.117074132f, 0.325588882f},
-std::array<float,2>{0.725578249f, 0.200594544f},
-std::array<float,2>{0.430205554f, 0.861751795f},
-std::array<float,2>{0.98788178f, 0.92494303f},
-std::array<float,2>{0.137994334f, 0.100039005f},
-std::array<float,2>{0.518191636f, 0.398589343f},
-std::array<float,2>{0.322341025f, 0.73655957f},
-std::array<float,2>{0.748707354f, 0.612564027f},
-std::array<float,2>{0.412794769f, 0.262095869f},
-std::array<float,2>{0.75136292f, 0.172496513f},
-std::array<float,2>{0.0963176787f, 0.812263906f},
-std::array<float,2>{0.581587374f, 0.842042148f},
-std::array<float,2>{0.262135506f, 0.241646111f},
-std::array<float,2>{0.900695026f, 0.360061795f},
-std::array<float,2>{0.211907819f, 0.528839171f},
-std::array<float,2>{0.846878409f, 0.637733817f},
-std::array<float,2>{0.0305466503f, 0.456199378f},
-std::array<float,2>{0.6716066f, 0.0408355519f},
-std::array<float,2>{0.484273195f, 0.975679696f},
-std::array<float,2>{0.809464872f, 0.753739953f},
-std::array<float,2>{0.0871615782f, 0.149017453f},
-std::array<float,2>{0.71267277f, 0.285235167f},
-std::array<float,2>{0.380623668f, 0.590098739f},
-std::array<float,2>{0.547877491f, 0.717220306f},
-std::array<float,2>{0.371338755f, 0.424001366f},
-std::array<float,2>{0.939699471f, 0.0627061278f},
-std::array<float,2>{0.181227818f, 0.88637954f},
-std::array<float,2>{0.642926216f, 0.941923916f},
-std::array<float,2>{0.456022441f, 0.0196483303f},
-std::array<float,2>{0.843343914f, 0.476708174f},
-std::array<float,2>{0.0381431729f, 0.658058643f},
-std::array<float,2>{0.907531619f, 0.537305892f},
-std::array<float,2>{0.235782132f, 0.323595852f},
-std::array<float,2>{0.612023592f, 0.198485419f},
-std::array<float,2>{0.292203248f, 0.866713107f},
-std::array<float,2>{0.819525003f, 0.98932147f},
-std::array<float,2>{0.0566874743f, 0.0603180714f},
-std::array<float,2>{0.63590306f, 0.449137717f},
-std::array<float,2>{0.447540969f, 0.650343478f},
-std::array<float,2>{0.599265754f, 0.508786142f},
-std::array<float,2>{0.302551329f, 0.345781773f},
-std::array<float,2>{0.925768375f, 0.2293908f},
-std::array<float,2>{0.219082192f, 0.818606198f},
-std::array<float,2>{0.696818888f, 0.793868601f},
-std::array<float,2>{0.401168853f, 0.157801598f},
-std::array<float,2>{0.785335362f, 0.275781184f},
-std::array<float,2>{0.076988548f, 0.602282941f},
-std::array<float,2>{0.966754138f, 0.724944949f},
-std::array<float,2>{0.162079036f, 0.380678803f},
-std::array<float,2>{0.546840012f, 0.115037784f},
-std::array<float,2>{0.351897359f, 0.920259297f},
-std::array<float,2>{0.889980614f, 0.85046345f},
-std::array<float,2>{0.196592361f, 0.212881446f},
-std::array<float,2>{0.566489458f, 0.328145683f},
-std::array<float,2>{0.275066972f, 0.556892991f},
-std::array<float,2>{0.673570693f, 0.686284721f},
-std::array<float,2>{0.49268347f, 0.49849093f},
-std::array<float,2>{0.869403303f, 0.0125600109f},
-std::array<float,2>{0.00868336204f, 0.961935103f},
-std::array<float,2>{0.515573502f, 0.903351665f},
-std::array<float,2>{0.335894167f, 0.0846059397f},
-std::array<float,2>{0.979880154f, 0.421871185f},
-std::array<float,2>{0.155849114f, 0.702606022f},
-std::array<float,2>{0.772383094f, 0.566627443f},
-std::array<float,2>{0.118560277f, 0.302707702f},
-std::array<float,2>{0.731567085f, 0.137896925f},
-std::array<float,2>{0.426535219f, 0.769325137f},
-std::array<float,2>{0.934682846f, 0.957638741f},
-std::array<float,2>{0.23021476f, 0.00185285229f},
-std::array<float,2>{0.606477916f, 0.489320964f},
-std::array<float,2>{0.310884804f, 0.677708387f},
-std::array<float,2>{0.62533021f, 0.548521578f},
-std::array<float,2>{0.445013821f, 0.337670147f},
-std::array<float,2>{0.823796809f, 0.203797281f},
-std::array<float,2>{0.0472083353f, 0.859284163f},
-std::array<float,2>{0.535829484f, 0.773779929f},
-std::array<float,2>{0.349422038f, 0.132173821f},
-std::array<float,2>{0.958631277f, 0.30577758f},
-std::array<float,2>{0.166026756f, 0.57576257f},
-std::array<float,2>{0.795725405f, 0.689490199f},
-std::array<float,2>{0.0639533028f, 0.410365552f},
-std::array<float,2>{0.693222523f, 0.0921332389f},
-std::array<float,2>{0.395380914f, 0.895423234f},
-std::array<float,2>{0.85941118f, 0.824879229f},
-std::array<float,2>{0.00658299914f, 0.223090291f},
-std::array<float,2>{0.683262229f, 0.35220015f},
-std::array<float,2>{0.489569336f, 0.506362319f},
-std::array<float,2>{0.573821664f, 0.642787993f},
-std::array<float,2>{0.27156359f, 0.444909304f},
-std::array<float,2>{0.880215883f, 0.0491965264f},
-std::array<float,2>{0.190525219f, 0.995171905f},
-std::array<float,2>{0.722592175f, 0.910247982f},
-std::array<float,2>{0.436058313f, 0.120950393f},
-std::array<float,2>{0.774992228f, 0.38782081f},
-std::array<float,2>{0.110339463f, 0.731403649f},
-std::array<float,2>{0.973798394f, 0.596831799f},
-std::array<float,2>{0.144970074f, 0.268088192f},
-std::array<float,2>{0.506284952f, 0.17172201f},
-std::array<float,2>{0.336217344f, 0.786197245f},
-std::array<float,2>{0.760311902f, 0.878700852f},
-std::array<float,2>{0.10247042f, 0.0747944489f},
-std::array<float,2>{0.74152863f, 0.4299393f},
-std::array<float,2>{0.414927006f, 0.703363955f},
-std::array<float,2>{0.530589938f, 0.58315593f},
-std::array<float,2>{0.319631785f, 0.295774579f},
-std::array<float,2>{0.995003521f, 0.145967051f},
-std::array<float,2>{0.130852401f, 0.7580989f},
-std::array<float,2>{0.657686949f, 0.867302597f},
-std::array<float,2>{0.470095187f, 0.191499546f},
-std::array<float,2>{0.854689956f, 0.317162663f},
-std::array<float,2>{0.0175965689f, 0.539271533f},
-std::array<float,2>{0.892585933f, 0.667285144f},
-std::array<float,2>{0.205946505f, 0.472219884f},
-std::array<float,2>{0.591714561f, 0.025695879f},
-std::array<float,2>{0.255555272f, 0.94587636f},
-std::array<float,2>{0.949284077f, 0.797443151f},
-std::array<float,2>{0.17460385f, 0.183000833f},
-std::array<float,2>{0.560138822f, 0.256675005f},
-std::array<float,2>{0.364374667f, 0.62113595f},
-std::array<float,2>{0.709496737f, 0.746266365f},
-std::array<float,2>{0.385442406f, 0.391629249f},
-std::array<float,2>{0.802016914f, 0.10695453f},
-std::array<float,2>{0.0848560482f, 0.932109237f},
-std::array<float,2>{0.622081518f, 0.976904035f},
-std::array<float,2>{0.287753314f, 0.0357181355f},
-std::array<float,2>{0.916299462f, 0.465755284f},
-std::array<float,2>{0.247633204f, 0.6264323f},
-std::array<float,2>{0.829360723f, 0.51695174f},
-std::array<float,2>{0.0463082157f, 0.370629549f},
-std::array<float,2>{0.651646435f, 0.24764061f},
-std::array<float,2>{0.462383598f, 0.832058012f},
-std::array<float,2>{0.902620554f, 0.892382622f},
-std::array<float,2>{0.216770604f, 0.0870471448f},
-std::array<float,2>{0.582641602f, 0.408857673f},
-std::array<float,2>{0.258869648f, 0.695298612f},
-std::array<float,2>{0.666838229f, 0.572941065f},
-std::array<float,2>{0.48005259f, 0.311528653f},
-std::array<float,2>{0.848733842f, 0.12883158f},
-std::array<float,2>{0.0249187555f, 0.779923379f},
-std::array<float,2>{0.521835983f, 0.853775144f},
-std::array<float,2>{0.327360779f, 0.207115769f},
-std::array<float,2>{0.989604592f, 0.343612939f},
-std::array<float,2>{0.133368105f, 0.550977409f},
-std::array<float,2>{0.755589783f, 0.672679424f},
-std::array<float,2>{0.0996663868f, 0.486182809f},
-std::array<float,2>{0.745312512f, 0.00717276707f},
-std::array<float,2>{0.407082468f, 0.955744267f},
-std::array<float,2>{0.837780654f, 0.782141328f},
-std::array<float,2>{0.0331717096f, 0.164248392f},
-std::array<float,2>{0.646763742f, 0.270269185f},
-std::array<float,2>{0.457713217f, 0.599771142f},
-std::array<float,2>{0.615324855f, 0.72718823f},
-std::array<float,2>{0.293403447f, 0.385868669f},
-std::array<float,2>{0.910925567f, 0.121320456f},
-std::array<float,2>{0.239277422f, 0.909074724f},
-std::array<float,2>{0.715926468f, 0.997004211f},
-std::array<float,2>{0.377955943f, 0.0535026193f},
-std::array<float,2>{0.806325018f, 0.440137416f},
-std::array<float,2>{0.0929837897f, 0.648069441f},
-std::array<float,2>{0.942696989f, 0.502013862f},
-std::array<float,2>{0.186262965f, 0.3581734f},
-std::array<float,2>{0.554619312f, 0.221689969f},
-std::array<float,2>{0.36942482f, 0.822330892f},
-std::array<float,2>{0.782026708f, 0.949472785f},
-std::array<float,2>{0.0703945011f, 0.0284871217f},
-std::array<float,2>{0.701145113f, 0.476433098f},
-std::array<float,2>{0.40373978f, 0.670754492f},
-std::array<float,2>{0.542492986f, 0.546122909f},
-std::array<float,2>{0.35764727f, 0.31323275f},
-std::array<float,2>{0.96442914f, 0.188367128f},
-std::array<float,2>{0.159065634f, 0.871167779f},
-std::array<float,2>{0.640486658f, 0.76223588f},
-std::array<float,2>{0.450232714f, 0.144289225f},
-std::array<float,2>{0.816197157f, 0.290576756f},
-std::array<float,2>{0.0602504238f, 0.579179525f},
-std::array<float,2>{0.926715136f, 0.709167778f},
-std::array<float,2>{0.22521928f, 0.43421793f},
-std::array<float,2>{0.59422791f, 0.0730167925f},
-std::array<float,2>{0.297985524f, 0.881081462f},
-std::array<float,2>{0.982568264f, 0.831646383f},
-std::array<float,2>{0.151752666f, 0.243958205f},
-std::array<float,2>{0.510517478f, 0.373981088f},
-std::array<float,2>{0.32863003f, 0.521208584f},
-std::array<float,2>{0.727395833f, 0.631355166f},
-std::array<float,2>{0.424073935f, 0.462393492f},
-std::array<float,2>{0.766577601f, 0.0332649536f},
-std::array<float,2>{0.123078629f, 0.984311879f},
-std::array<float,2>{0.564206779f, 0.933691263f},
-std::array<float,2>{0.278000951f, 0.10495051f},
-std::array<float,2>{0.8849231f, 0.396874696f},
-std::array<float,2>{0.201470897f, 0.745696604f},
-std::array<float,2>{0.872313023f, 0.61890763f},
-std::array<float,2>{0.0120299216f, 0.251056969f},
-std::array<float,2>{0.676481843f, 0.185906917f},
-std::array<float,2>{0.499235928f, 0.804131687f},
-std::array<float,2>{0.954104781f, 0.969210386f},
-std::array<float,2>{0.170480371f, 0.0466623008f},
-std::array<float,2>{0.5349437f, 0.457199931f},
-std::array<float,2>{0.34375897f, 0.635396183f},
-std::array<float,2>{0.688180923f, 0.526708126f},
-std::array<float,2>{0.393572837f, 0.364298105f},
-std::array<float,2>{0.79071939f, 0.235908195f},
-std::array<float,2>{0.068821162f, 0.8363626f},
-std::array<float,2>{0.604172111f, 0.808345675f},
-std::array<float,2>{0.306055993f, 0.179283634f},
-std::array<float,2>{0.930152893f, 0.261499465f},
-std::array<float,2>{0.231999114f, 0.615594625f},
-std::array<float,2>{0.826067746f, 0.73997432f},
-std::array<float,2>{0.0546753369f, 0.40308544f},
-std::array<float,2>{0.628943026f, 0.0944658592f},
-std::array<float,2>{0.441167116f, 0.926454663f},
-std::array<float,2>{0.777932346f, 0.862721503f},
-std::array<float,2>{0.114093065f, 0.199259922f},
-std::array<float,2>{0.723468721f, 0.324843079f},
-std::array<float,2>{0.431947082f, 0.53284198f},
-std::array<float,2>{0.500912547f, 0.663999796f},
-std::array<float,2>{0.343722343f, 0.484123945f},
-std::array<float,2>{0.968904674f, 0.0169994403f},
-std::array<float,2>{0.144474149f, 0.94011265f},
-std::array<float,2>{0.687402904f, 0.88956219f},
-std::array<float,2>{0.486147195f, 0.0691671818f},
-std::array<float,2>{0.867031038f, 0.427963346f},
-std::array<float,2>{0.00376511621f, 0.711399853f},
-std::array<float,2>{0.878607869f, 0.587567925f},
-std::array<float,2>{0.195126787f, 0.284270763f},
-std::array<float,2>{0.578092217f, 0.153647691f},
-std::array<float,2>{0.268025905f, 0.753954828f},
-std::array<float,2>{0.856783867f, 0.91700846f},
-std::array<float,2>{0.0223759115f, 0.112358637f},
-std::array<float,2>{0.663783252f, 0.376021922f},
-std::array<float,2>{0.474213094f, 0.721797228f},
-std::array<float,2>{0.587384105f, 0.606277525f},
-std::array<float,2>{0.250676602f, 0.279579043f},
-std::array<float,2>{0.895381451f, 0.163769737f},
-std::array<float,2>{0.209049016f, 0.790766478f},
-std::array<float,2>{0.736177921f, 0.812797427f},
-std::array<float,2>{0.421677113f, 0.233196706f},
-std::array<float,2>{0.763903677f, 0.349539906f},
-std::array<float,2>{0.1084399f, 0.515136957f},
-std::array<float,2>{0.998081684f, 0.655718386f},
-std::array<float,2>{0.126241341f, 0.452550918f},
-std::array<float,2>{0.526371419f, 0.055852402f},
-std::array<float,2>{0.314146221f, 0.987868965f},
-std::array<float,2>{0.918509483f, 0.770097852f},
-std::array<float,2>{0.243036777f, 0.133160681f},
-std::array<float,2>{0.620193779f, 0.297126204f},
-std::array<float,2>{0.281961024f, 0.563315094f},
-std::array<float,2>{0.65502423f, 0.695587397f},
-std::array<float,2>{0.467930973f, 0.415260106f},
-std::array<float,2>{0.834615469f, 0.0783822015f},
-std::array<float,2>{0.040520329f, 0.900961518f},
-std::array<float,2>{0.558119714f, 0.967433035f},
-std::array<float,2>{0.359942406f, 0.0116475532f},
-std::array<float,2>{0.945877016f, 0.494949698f},
-std::array<float,2>{0.176307544f, 0.680166185f},
-std::array<float,2>{0.797122419f, 0.561036289f},
-std::array<float,2>{0.0813849121f, 0.334629625f},
-std::array<float,2>{0.706258535f, 0.218463778f},
-std::array<float,2>{0.388804108f, 0.847267866f},
-std::array<float,2>{0.938783824f, 0.883298039f},
-std::array<float,2>{0.181714252f, 0.0653297827f},
-std::array<float,2>{0.549978077f, 0.423551053f},
-std::array<float,2>{0.373627037f, 0.716260374f},
-std::array<float,2>{0.713111937f, 0.592571437f},
-std::array<float,2>{0.382346511f, 0.287659824f},
-std::array<float,2>{0.811120749f, 0.152194202f},
-std::array<float,2>{0.0884276181f, 0.750206172f},
-std::array<float,2>{0.610046864f, 0.86513412f},
-std::array<float,2>{0.289993376f, 0.195727214f},
-std::array<float,2>{0.908456564f, 0.322141826f},
-std::array<float,2>{0.237476796f, 0.535748899f},
-std::array<float,2>{0.840556085f, 0.659790039f},
-std::array<float,2>{0.03651876f, 0.480013371f},
-std::array<float,2>{0.641364574f, 0.0219449159f},
-std::array<float,2>{0.453231603f, 0.945186317f},
-std::array<float,2>{0.752478838f, 0.809447289f},
-std::array<float,2>{0.0946363956f, 0.174273685f},
-std::array<float,2>{0.747623742f, 0.263961345f},
-std::array<float,2>{0.412052989f, 0.610450923f},
-std::array<float,2>{0.517331541f, 0.734469175f},
-std::array<float,2>{0.321612984f, 0.400661737f},
-std::array<float,2>{0.98574698f, 0.0982120186f},
-std::array<float,2>{0.140363798f, 0.922903597f},
-std::array<float,2>{0.668427169f, 0.9732306f},
-std::array<float,2>{0.480642647f, 0.042766396f},
-std::array<float,2>{0.845503092f, 0.4536286f},
-std::array<float,2>{0.0275528338f, 0.638989389f},
-std::array<float,2>{0.899639487f, 0.530785561f},
-std::array<float,2>{0.21351929f, 0.361454904f},
-std::array<float,2>{0.579149842f, 0.238418221f},
-std::array<float,2>{0.264730185f, 0.840915263f},
-std::array<float,2>{0.867305756f, 0.964316547f},
-std::array<float,2>{0.0114430767f, 0.0150958225f},
-std::array<float,2>{0.673855245f, 0.49733296f},
-std::array<float,2>{0.495147139f, 0.683737218f},
-std::array<float,2>{0.570170105f, 0.555203438f},
-std::array<float,2>{0.276168138f, 0.331293404f},
-std::array<float,2>{0.888419807f, 0.213051572f},
-std::array<float,2>{0.198833868f, 0.847675204f},
-std::array<float,2>{0.733960688f, 0.767112255f},
-std::array<float,2>{0.428310513f, 0.139665097f},
-std::array<float,2>{0.769977212f, 0.302772194f},
-std::array<float,2>{0.120494053f, 0.569452643f},
-std::array<float,2>{0.976942241f, 0.699490011f},
-std::array<float,2>{0.153148204f, 0.419427723f},
-std::array<float,2>{0.512924612f, 0.083177723f},
-std::array<float,2>{0.333213121f, 0.904942393f},
-std::array<float,2>{0.92334187f, 0.817220151f},
-std::array<float,2>{0.22258158f, 0.227440938f},
-std::array<float,2>{0.599955261f, 0.344694048f},
-std::array<float,2>{0.303551078f, 0.511396706f},
-std::array<float,2>{0.633983493f, 0.651796877f},
-std::array<float,2>{0.44634372f, 0.445779085f},
-std::array<float,2>{0.818305492f, 0.0624446608f},
-std::array<float,2>{0.0561219528f, 0.990238726f},
-std::array<float,2>{0.543129325f, 0.91893667f},
-std::array<float,2>{0.354287148f, 0.116905145f},
-std::array<float,2>{0.966914296f, 0.381766975f},
-std::array<float,2>{0.162903666f, 0.722799301f},
-std::array<float,2>{0.788292766f, 0.604010284f},
-std::array<float,2>{0.0744750053f, 0.273902476f},
-std::array<float,2>{0.69798857f, 0.158288419f},
-std::array<float,2>{0.399939537f, 0.796258628f},
-std::array<float,2>{0.882642686f, 0.993563533f},
-std::array<float,2>{0.188153177f, 0.0473693013f},
-std::array<float,2>{0.571522236f, 0.442133486f},
-std::array<float,2>{0.270392865f, 0.641667068f},
-std::array<float,2>{0.680479765f, 0.504422247f},
-std::array<float,2>{0.491336614f, 0.354569048f},
-std::array<float,2>{0.861610353f, 0.225152746f},
-std::array<float,2>{0.00509572634f, 0.827339232f},
-std::array<float,2>{0.505432904f, 0.787494898f},
-std::array<float,2>{0.338558614f, 0.169440731f},
-std::array<float,2>{0.975645602f, 0.266606063f},
-std::array<float,2>{0.14749296f, 0.594341815f},
-std::array<float,2>{0.776202857f, 0.732678473f},
-std::array<float,2>{0.112602457f, 0.389032304f},
-std::array<float,2>{0.719850123f, 0.11911536f},
-std::array<float,2>{0.434619427f, 0.913754165f},
-std::array<float,2>{0.8217116f, 0.856365323f},
-std::array<float,2>{0.0506325103f, 0.206098497f},
-std::array<float,2>{0.628862977f, 0.33832255f},
-std::array<float,2>{0.443148285f, 0.549371839f},
-std::array<float,2>{0.60870707f, 0.678233683f},
-std::array<float,2>{0.310065985f, 0.492027372f},
-std::array<float,2>{0.937064707f, 0.00240752962f},
-std::array<float,2>{0.228070274f, 0.960809946f},
-std::array<float,2>{0.69410497f, 0.896603584f},
-std::array<float,2>{0.396870345f, 0.0905467272f},
-std::array<float,2>{0.793645859f, 0.412701815f},
-std::array<float,2>{0.0645438209f, 0.688434541f},
-std::array<float,2>{0.959977388f, 0.577783406f},
-std::array<float,2>{0.164092332f, 0.307778418f},
-std::array<float,2>{0.538016379f, 0.12993741f},
-std::array<float,2>{0.350250572f, 0.775540233f},
-std::array<float,2>{0.804152071f, 0.931346297f},
-std::array<float,2>{0.0821057409f, 0.109083056f},
-std::array<float,2>{0.707446814f, 0.393362731f},
-std::array<float,2>{0.38410902f, 0.748302639f},
-std::array<float,2>{0.561945558f, 0.623348057f},
-std::array<float,2>{0.365703732f, 0.255451769f},
-std::array<float,2>{0.952263951f, 0.181088895f},
-std::array<float,2>{0.173161358f, 0.799322844f},
-std::array<float,2>{0.648919761f, 0.834363878f},
-std::array<float,2>{0.463359594f, 0.248238385f},
-std::array<float,2>{0.831015408f, 0.367348135f},
-std::array<float,2>{0.0435325019f, 0.518963337f},
-std::array<float,2>{0.914844453f, 0.627619803f},
-std::array<float,2>{0.248895124f, 0.46749115f},
-std::array<float,2>{0.624016821f, 0.0388048515f},
-std::array<float,2>{0.286275953f, 0.979567468f},
-std::array<float,2>{0.99326545f, 0.759928286f},
-std::array<float,2>{0.132340789f, 0.146711543f},
-std::array<float,2>{0.528705776f, 0.294551015f},
-std::array<float,2>{0.317657739f, 0.585328698f},
-std::array<float,2>{0.738879263f, 0.705405772f},
-std::array<float,2>{0.417687535f, 0.433525383f},
-std::array<float,2>{0.758393645f, 0.0766882151f},
-std::array<float,2>{0.104605645f, 0.875574291f},
-std::array<float,2>{0.592313588f, 0.94901365f},
-std::array<float,2>{0.257615328f, 0.0242273137f},
-std::array<float,2>{0.891910493f, 0.470388472f},
-std::array<float,2>{0.20506677f, 0.66439116f},
-std::array<float,2>{0.852024794f, 0.542764843f},
-std::array<float,2>{0.0171742216f, 0.318547219f},
-std::array<float,2>{0.658256471f, 0.193408296f},
-std::array<float,2>{0.472174168f, 0.870549262f},
-std::array<float,2>{0.91239953f, 0.906526327f},
-std::array<float,2>{0.241797253f, 0.12404497f},
-std::array<float,2>{0.61400032f, 0.384719729f},
-std::array<float,2>{0.295814902f, 0.729715884f},
-std::array<float,2>{0.645270586f, 0.598626673f},
-std::array<float,2>{0.460642993f, 0.273192376f},
-std::array<float,2>{0.838208199f, 0.167783946f},
-std::array<float,2>{0.0350685753f, 0.784561992f},
-std::array<float,2>{0.551261365f, 0.821989477f},
-std::array<float,2>{0.367835134f, 0.220139727f},
-std::array<float,2>{0.944976568f, 0.357235312f},
-std::array<float,2>{0.183634371f, 0.500473142f},
-std::array<float,2>{0.808497071f, 0.646235049f},
-std::array<float,2>{0.0913940296f, 0.439054072f},
-std::array<float,2>{0.717769504f, 0.0523874201f},
-std::array<float,2>{0.376788259f, 0.998863518f},
-std::array<float,2>{0.850280762f, 0.777906477f},
-std::array<float,2>{0.0270980224f, 0.12578766f},
-std::array<float,2>{0.665388405f, 0.309104651f},
-std::array<float,2>{0.478027612f, 0.570343733f},
-std::array<float,2>{0.584777772f, 0.692274332f},
-std::array<float,2>{0.261135042f, 0.406992316f},
-std::array<float,2>{0.905965507f, 0.088437371f},
-std::array<float,2>{0.217415035f, 0.893204212f},
-std::array<float,2>{0.742765069f, 0.953926206f},
-std::array<float,2>{0.409976631f, 0.0050009829f},
-std::array<float,2>{0.75670296f, 0.487157941f},
-std::array<float,2>{0.0979059041f, 0.674633145f},
-std::array<float,2>{0.990947783f, 0.553837478f},
-std::array<float,2>{0.135810241f, 0.340245157f},
-std::array<float,2>{0.520765543f, 0.209923476f},
-std::array<float,2>{0.325316757f, 0.851992726f},
-std::array<float,2>{0.768460989f, 0.980694652f},
-std::array<float,2>{0.121318795f, 0.0329552144f},
-std::array<float,2>{0.729453444f, 0.463533998f},
-std::array<float,2>{0.422060698f, 0.63010776f},
-std::array<float,2>{0.508809507f, 0.521653116f},
-std::array<float,2>{0.330789626f, 0.372534871f},
-std::array<float,2>{0.981564105f, 0.245601848f},
-std::array<float,2>{0.148514614f, 0.829713166f},
-std::array<float,2>{0.679673374f, 0.801008582f},
-std::array<float,2>{0.496555358f, 0.184084669f},
-std::array<float,2>{0.873755038f, 0.253134221f},
-std::array<float,2>{0.0155962324f, 0.619775951f},
-std::array<float,2>{0.884029329f, 0.744050562f},
-std::array<float,2>{0.201099291f, 0.394934773f},
-std::array<float,2>{0.565402031f, 0.10188137f},
-std::array<float,2>{0.280124992f, 0.935896158f},
-std::array<float,2>{0.962169886f, 0.874338925f},
-std::array<float,2>{0.156407237f, 0.190615714f},
-std::array<float,2>{0.54092145f, 0.315760255f},
-std::array<float,2>{0.355575144f, 0.543983579f},
-std::array<float,2>{0.701215386f, 0.669704139f},
-std::array<float,2>{0.404999882f, 0.473127842f},
-std::array<float,2>{0.785068393f, 0.0301049594f},
-std::array<float,2>{0.0729580075f, 0.952767611f},
-std::array<float,2>{0.597548068f, 0.879683614f},
-std::array<float,2>{0.299068779f, 0.0714490861f},
-std::array<float,2>{0.927903652f, 0.436429024f},
-std::array<float,2>{0.224312142f, 0.707782686f},
-std::array<float,2>{0.813863456f, 0.580559313f},
-std::array<float,2>{0.0614758693f, 0.291991472f},
-std::array<float,2>{0.638164997f, 0.141403005f},
-std::array<float,2>{0.453007191f, 0.76481235f},
-std::array<float,2>{0.972346187f, 0.938610494f},
-std::array<float,2>{0.142526388f, 0.0177505389f},
-std::array<float,2>{0.503252864f, 0.481405497f},
-std::array<float,2>{0.340628654f, 0.660455227f},
-std::array<float,2>{0.726502061f, 0.533434331f},
-std::array<float,2>{0.431419939f, 0.326856256f},
-std::array<float,2>{0.779554665f, 0.202503845f},
-std::array<float,2>{0.115737297f, 0.859964907f},
-std::array<float,2>{0.574280322f, 0.757000685f},
-std::array<float,2>{0.267350405f, 0.156224445f},
-std::array<float,2>{0.875790775f, 0.281441778f},
-std::array<float,2>{0.193033978f, 0.589595795f},
-std::array<float,2>{0.863303483f, 0.714230239f},
-std::array<float,2>{0.000868842588f, 0.426664352f},
-std::array<float,2>{0.684486687f, 0.0678545833f},
-std::array<float,2>{0.488056302f, 0.886942923f},
-std::array<float,2>{0.792381763f, 0.839213967f},
-std::array<float,2>{0.0678719059f, 0.237685248f},
-std::array<float,2>{0.690942705f, 0.366775692f},
-std::array<float,2>{0.392149746f, 0.524146438f},
-std::array<float,2>{0.532067835f, 0.633478582f},
-std::array<float,2>{0.347075582f, 0.45929569f},
-std::array<float,2>{0.956550419f, 0.043800056f},
-std::array<float,2>{0.168606907f, 0.972542107f},
-std::array<float,2>{0.632398605f, 0.929000616f},
-std::array<float,2>{0.438803822f, 0.0971785933f},
-std::array<float,2>{0.827995956f, 0.404407144f},
-std::array<float,2>{0.0507904142f, 0.740888357f},
-std::array<float,2>{0.932078779f, 0.614601135f},
-std::array<float,2>{0.234123901f, 0.258482218f},
-std::array<float,2>{0.601640105f, 0.176496834f},
-std::array<float,2>{0.308412194f, 0.805081964f},
-std::array<float,2>{0.832867801f, 0.899448752f},
-std::array<float,2>{0.0423008427f, 0.0819819495f},
-std::array<float,2>{0.653981924f, 0.4167867f},
-std::array<float,2>{0.46645987f, 0.698206663f},
-std::array<float,2>{0.617596686f, 0.565108597f},
-std::array<float,2>{0.283997983f, 0.298930049f},
-std::array<float,2>{0.920062482f, 0.136704221f},
-std::array<float,2>{0.24471812f, 0.772478104f},
-std::array<float,2>{0.704792082f, 0.845465124f},
-std::array<float,2>{0.387411267f, 0.21512489f},
-std::array<float,2>{0.80026418f, 0.332722604f},
-std::array<float,2>{0.0788684562f, 0.559748173f},
-std::array<float,2>{0.949027061f, 0.682276726f},
-std::array<float,2>{0.179671928f, 0.492866009f},
-std::array<float,2>{0.555872619f, 0.00926263165f},
-std::array<float,2>{0.363232791f, 0.966322303f},
-std::array<float,2>{0.897943318f, 0.791646719f},
-std::array<float,2>{0.208698675f, 0.16050519f},
-std::array<float,2>{0.589033246f, 0.278474092f},
-std::array<float,2>{0.25203833f, 0.608564377f},
-std::array<float,2>{0.662107944f, 0.719458163f},
-std::array<float,2>{0.474632472f, 0.37786302f},
-std::array<float,2>{0.857870698f, 0.109958775f},
-std::array<float,2>{0.0209679399f, 0.915137708f},
-std::array<float,2>{0.5251562f, 0.985803485f},
-std::array<float,2>{0.314853281f, 0.0573380999f},
-std::array<float,2>{0.997604191f, 0.450704902f},
-std::array<float,2>{0.127230451f, 0.653109252f},
-std::array<float,2>{0.76293534f, 0.511768878f},
-std::array<float,2>{0.10737098f, 0.350107491f},
-std::array<float,2>{0.736933053f, 0.230791301f},
-std::array<float,2>{0.418656468f, 0.816182375f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.931918323f, 0.472535372f},
-std::array<float,2>{0.480176151f, 0.651975632f},
-std::array<float,2>{0.229126781f, 0.19526577f},
-std::array<float,2>{0.695527256f, 0.790228605f},
-std::array<float,2>{0.593742371f, 0.0640494376f},
-std::array<float,2>{0.0114328638f, 0.976489842f},
-std::array<float,2>{0.309818804f, 0.281270325f},
-std::array<float,2>{0.832670569f, 0.568307817f},
-std::array<float,2>{0.672901988f, 0.373472393f},
-std::array<float,2>{0.158904076f, 0.523239136f},
-std::array<float,2>{0.386539072f, 0.0128962966f},
-std::array<float,2>{0.952449799f, 0.909027576f},
-std::array<float,2>{0.791496873f, 0.185496807f},
-std::array<float,2>{0.367631227f, 0.837285697f},
-std::array<float,2>{0.0887704417f, 0.393062443f},
-std::array<float,2>{0.551465392f, 0.690103412f},
-std::array<float,2>{0.863161445f, 0.280710965f},
-std::array<float,2>{0.257770777f, 0.598511279f},
-std::array<float,2>{0.0334752835f, 0.118278719f},
-std::array<float,2>{0.605613708f, 0.944248021f},
-std::array<float,2>{0.721472144f, 0.236038968f},
-std::array<float,2>{0.199970543f, 0.779928148f},
-std::array<float,2>{0.462514997f, 0.463622123f},
-std::array<float,2>{0.888434112f, 0.683056176f},
-std::array<float,2>{0.521746755f, 0.4082205f},
-std::array<float,2>{0.109481767f, 0.741890192f},
-std::array<float,2>{0.334737808f, 0.1507456f},
-std::array<float,2>{0.772211015f, 0.870738149f},
-std::array<float,2>{0.990974069f, 0.0371244662f},
-std::array<float,2>{0.40641287f, 0.901817977f},
-std::array<float,2>{0.1307033f, 0.321511537f},
-std::array<float,2>{0.649047554f, 0.556034565f},
-std::array<float,2>{0.757346272f, 0.378519416f},
-std::array<float,2>{0.318451524f, 0.715814352f},
-std::array<float,2>{0.0951147154f, 0.167819619f},
-std::array<float,2>{0.507888317f, 0.826518357f},
-std::array<float,2>{0.636850893f, 0.0283477213f},
-std::array<float,2>{0.153716549f, 0.92230624f},
-std::array<float,2>{0.42397517f, 0.3524248f},
-std::array<float,2>{0.974916816f, 0.514448464f},
-std::array<float,2>{0.61893481f, 0.308535963f},
-std::array<float,2>{0.0532325581f, 0.589569449f},
-std::array<float,2>{0.274008185f, 0.0789092705f},
-std::array<float,2>{0.858729005f, 0.994363129f},
-std::array<float,2>{0.905563354f, 0.216143802f},
-std::array<float,2>{0.439813882f, 0.799458086f},
-std::array<float,2>{0.214048028f, 0.497834414f},
-std::array<float,2>{0.741308391f, 0.626657367f},
-std::array<float,2>{0.957148314f, 0.340108186f},
-std::array<float,2>{0.406205982f, 0.53371501f},
-std::array<float,2>{0.179274529f, 0.0497458801f},
-std::array<float,2>{0.663509429f, 0.887791574f},
-std::array<float,2>{0.541324198f, 0.137956291f},
-std::array<float,2>{0.0692398995f, 0.847803235f},
-std::array<float,2>{0.349533826f, 0.425740153f},
-std::array<float,2>{0.803952038f, 0.725893915f},
-std::array<float,2>{0.709070802f, 0.437556118f},
-std::array<float,2>{0.244233325f, 0.664564908f},
-std::array<float,2>{0.498513311f, 0.233166113f},
-std::array<float,2>{0.908767164f, 0.752828181f},
-std::array<float,2>{0.824844539f, 0.10325405f},
-std::array<float,2>{0.285955369f, 0.9612782f},
-std::array<float,2>{0.0190403853f, 0.254022002f},
-std::array<float,2>{0.562786579f, 0.624944031f},
-std::array<float,2>{0.978020668f, 0.432058424f},
-std::array<float,2>{0.431147575f, 0.730571747f},
-std::array<float,2>{0.14424409f, 0.129869059f},
-std::array<float,2>{0.627490878f, 0.857239962f},
-std::array<float,2>{0.501997352f, 0.0603326522f},
-std::array<float,2>{0.108585171f, 0.877328634f},
-std::array<float,2>{0.325897723f, 0.32996878f},
-std::array<float,2>{0.759297073f, 0.54504019f},
-std::array<float,2>{0.749051213f, 0.259939194f},
-std::array<float,2>{0.20319289f, 0.612169325f},
-std::array<float,2>{0.452427536f, 0.0971547589f},
-std::array<float,2>{0.894838631f, 0.95992291f},
-std::array<float,2>{0.84397155f, 0.226412416f},
-std::array<float,2>{0.269934952f, 0.761850774f},
-std::array<float,2>{0.0574011095f, 0.445881933f},
-std::array<float,2>{0.613113761f, 0.659267783f},
-std::array<float,2>{0.807495654f, 0.346097916f},
-std::array<float,2>{0.353791535f, 0.50554508f},
-std::array<float,2>{0.0742028579f, 0.021075001f},
-std::array<float,2>{0.533091247f, 0.933922946f},
-std::array<float,2>{0.668138325f, 0.163356975f},
-std::array<float,2>{0.184243694f, 0.818429291f},
-std::array<float,2>{0.393822312f, 0.382845402f},
-std::array<float,2>{0.964961469f, 0.705440581f},
-std::array<float,2>{0.576114714f, 0.484405369f},
-std::array<float,2>{0.025981497f, 0.638493061f},
-std::array<float,2>{0.296420425f, 0.208336622f},
-std::array<float,2>{0.814168334f, 0.811619937f},
-std::array<float,2>{0.914866745f, 0.0894936845f},
-std::array<float,2>{0.489434421f, 0.984673321f},
-std::array<float,2>{0.236335009f, 0.299322218f},
-std::array<float,2>{0.715821624f, 0.580349207f},
-std::array<float,2>{0.8363657f, 0.456114113f},
-std::array<float,2>{0.301861614f, 0.674843609f},
-std::array<float,2>{0.00630805595f, 0.243006408f},
-std::array<float,2>{0.578218997f, 0.771111786f},
-std::array<float,2>{0.694122136f, 0.11209029f},
-std::array<float,2>{0.221145779f, 0.947725713f},
-std::array<float,2>{0.472139418f, 0.270365953f},
-std::array<float,2>{0.927853405f, 0.607821524f},
-std::array<float,2>{0.560080945f, 0.316999316f},
-std::array<float,2>{0.0852454379f, 0.54752475f},
-std::array<float,2>{0.366004348f, 0.045037277f},
-std::array<float,2>{0.781936705f, 0.897813439f},
-std::array<float,2>{0.93923974f, 0.146831378f},
-std::array<float,2>{0.379852593f, 0.865826964f},
-std::array<float,2>{0.168038979f, 0.414833009f},
-std::array<float,2>{0.687178373f, 0.746798694f},
-std::array<float,2>{0.880473316f, 0.29147929f},
-std::array<float,2>{0.45864749f, 0.575886846f},
-std::array<float,2>{0.19450599f, 0.0728231668f},
-std::array<float,2>{0.733995378f, 0.981866241f},
-std::array<float,2>{0.601067901f, 0.200435638f},
-std::array<float,2>{0.0417064615f, 0.786264956f},
-std::array<float,2>{0.260726899f, 0.481961012f},
-std::array<float,2>{0.87085557f, 0.640705109f},
-std::array<float,2>{0.641610622f, 0.401717603f},
-std::array<float,2>{0.134697825f, 0.698476672f},
-std::array<float,2>{0.417189747f, 0.172251552f},
-std::array<float,2>{0.996259272f, 0.833351493f},
-std::array<float,2>{0.780919135f, 0.00442696549f},
-std::array<float,2>{0.337572277f, 0.918405712f},
-std::array<float,2>{0.117578201f, 0.361445457f},
-std::array<float,2>{0.527632296f, 0.527701914f},
-std::array<float,2>{0.893411219f, 0.398145765f},
-std::array<float,2>{0.448616147f, 0.692810178f},
-std::array<float,2>{0.208812907f, 0.182651594f},
-std::array<float,2>{0.742512167f, 0.840950429f},
-std::array<float,2>{0.613623321f, 0.0101498719f},
-std::array<float,2>{0.0603194609f, 0.913417101f},
-std::array<float,2>{0.268199801f, 0.369762838f},
-std::array<float,2>{0.849148154f, 0.51881361f},
-std::array<float,2>{0.630318642f, 0.28699711f},
-std::array<float,2>{0.148370236f, 0.565847695f},
-std::array<float,2>{0.435694128f, 0.0664676055f},
-std::array<float,2>{0.982784271f, 0.969455421f},
-std::array<float,2>{0.765447259f, 0.188525811f},
-std::array<float,2>{0.32405746f, 0.794367909f},
-std::array<float,2>{0.102417409f, 0.475864232f},
-std::array<float,2>{0.507009625f, 0.653792918f},
-std::array<float,2>{0.819083989f, 0.326012194f},
-std::array<float,2>{0.291110009f, 0.561727643f},
-std::array<float,2>{0.0290644635f, 0.0335431807f},
-std::array<float,2>{0.57124269f, 0.90466845f},
-std::array<float,2>{0.711118221f, 0.15599227f},
-std::array<float,2>{0.241847381f, 0.872674286f},
-std::array<float,2>{0.484744668f, 0.412759423f},
-std::array<float,2>{0.920882881f, 0.73560065f},
-std::array<float,2>{0.535738945f, 0.467992693f},
-std::array<float,2>{0.0749589205f, 0.684348166f},
-std::array<float,2>{0.356238902f, 0.239125252f},
-std::array<float,2>{0.808812439f, 0.776405692f},
-std::array<float,2>{0.963807404f, 0.124186732f},
-std::array<float,2>{0.398327142f, 0.937790215f},
-std::array<float,2>{0.181785494f, 0.274167508f},
-std::array<float,2>{0.664931059f, 0.593973815f},
-std::array<float,2>{0.787964463f, 0.494573325f},
-std::array<float,2>{0.361752242f, 0.632092714f},
-std::array<float,2>{0.0791583359f, 0.212857366f},
-std::array<float,2>{0.558485985f, 0.802778959f},
-std::array<float,2>{0.683067203f, 0.0840076506f},
-std::array<float,2>{0.16702731f, 0.996407688f},
-std::array<float,2>{0.375299305f, 0.312166452f},
-std::array<float,2>{0.944306076f, 0.589989662f},
-std::array<float,2>{0.585270882f, 0.357925892f},
-std::array<float,2>{0.00292756432f, 0.510577142f},
-std::array<float,2>{0.300621808f, 0.0264611728f},
-std::array<float,2>{0.842899144f, 0.926004112f},
-std::array<float,2>{0.921911836f, 0.168414757f},
-std::array<float,2>{0.475770205f, 0.823808253f},
-std::array<float,2>{0.224799126f, 0.381245464f},
-std::array<float,2>{0.691228747f, 0.712482512f},
-std::array<float,2>{0.992197573f, 0.250780672f},
-std::array<float,2>{0.41833657f, 0.619851589f},
-std::array<float,2>{0.139930859f, 0.106494762f},
-std::array<float,2>{0.645629942f, 0.964870632f},
-std::array<float,2>{0.524863482f, 0.229073584f},
-std::array<float,2>{0.121855929f, 0.755691886f},
-std::array<float,2>{0.340848267f, 0.442263395f},
-std::array<float,2>{0.774897456f, 0.668046534f},
-std::array<float,2>{0.729715526f, 0.428870261f},
-std::array<float,2>{0.191127107f, 0.722186267f},
-std::array<float,2>{0.453956902f, 0.133709744f},
-std::array<float,2>{0.877401233f, 0.847509801f},
-std::array<float,2>{0.871637642f, 0.0514985323f},
-std::array<float,2>{0.262594759f, 0.885029376f},
-std::array<float,2>{0.0432167724f, 0.338255852f},
-std::array<float,2>{0.595615447f, 0.538032293f},
-std::array<float,2>{0.947167456f, 0.452999204f},
-std::array<float,2>{0.387536854f, 0.663435936f},
-std::array<float,2>{0.16334419f, 0.219188631f},
-std::array<float,2>{0.676377952f, 0.758993626f},
-std::array<float,2>{0.548644662f, 0.100324281f},
-std::array<float,2>{0.0911979377f, 0.956505537f},
-std::array<float,2>{0.373245418f, 0.265491873f},
-std::array<float,2>{0.796435773f, 0.615059257f},
-std::array<float,2>{0.699839056f, 0.335220754f},
-std::array<float,2>{0.233806297f, 0.539587557f},
-std::array<float,2>{0.481692672f, 0.0565243214f},
-std::array<float,2>{0.934174061f, 0.881571591f},
-std::array<float,2>{0.829075754f, 0.1257388f},
-std::array<float,2>{0.307395577f, 0.852401912f},
-std::array<float,2>{0.0125774927f, 0.434276372f},
-std::array<float,2>{0.587954402f, 0.730233252f},
-std::array<float,2>{0.765804291f, 0.301435411f},
-std::array<float,2>{0.329339057f, 0.584836483f},
-std::array<float,2>{0.11366424f, 0.0918687209f},
-std::array<float,2>{0.51751399f, 0.991764486f},
-std::array<float,2>{0.653835952f, 0.206408054f},
-std::array<float,2>{0.126671046f, 0.808001697f},
-std::array<float,2>{0.410832196f, 0.491209179f},
-std::array<float,2>{0.986898363f, 0.632854939f},
-std::array<float,2>{0.601899087f, 0.389008671f},
-std::array<float,2>{0.0384175144f, 0.710500121f},
-std::array<float,2>{0.250169814f, 0.158549488f},
-std::array<float,2>{0.865462124f, 0.812902272f},
-std::array<float,2>{0.88315922f, 0.0191968642f},
-std::array<float,2>{0.46530959f, 0.931413889f},
-std::array<float,2>{0.197595686f, 0.349222153f},
-std::array<float,2>{0.723990321f, 0.501124799f},
-std::array<float,2>{0.851888657f, 0.420140982f},
-std::array<float,2>{0.278756499f, 0.74584955f},
-std::array<float,2>{0.0471859388f, 0.141761512f},
-std::array<float,2>{0.621493459f, 0.859393537f},
-std::array<float,2>{0.736256659f, 0.0413807631f},
-std::array<float,2>{0.21767433f, 0.892129064f},
-std::array<float,2>{0.443746626f, 0.316237032f},
-std::array<float,2>{0.899455965f, 0.552566826f},
-std::array<float,2>{0.513336241f, 0.266403049f},
-std::array<float,2>{0.0996302143f, 0.604842961f},
-std::array<float,2>{0.315837741f, 0.113641158f},
-std::array<float,2>{0.751396894f, 0.950885057f},
-std::array<float,2>{0.972270191f, 0.248611256f},
-std::array<float,2>{0.427100688f, 0.766556442f},
-std::array<float,2>{0.151909322f, 0.460338473f},
-std::array<float,2>{0.635467827f, 0.677265227f},
-std::array<float,2>{0.911030412f, 0.364199847f},
-std::array<float,2>{0.493655562f, 0.525925934f},
-std::array<float,2>{0.247817755f, 0.00280706654f},
-std::array<float,2>{0.703455746f, 0.917219341f},
-std::array<float,2>{0.568855345f, 0.179233074f},
-std::array<float,2>{0.0197248124f, 0.828450739f},
-std::array<float,2>{0.283360869f, 0.403246969f},
-std::array<float,2>{0.822318614f, 0.700225651f},
-std::array<float,2>{0.659371495f, 0.479380727f},
-std::array<float,2>{0.17418012f, 0.64456141f},
-std::array<float,2>{0.401168525f, 0.196076199f},
-std::array<float,2>{0.956513166f, 0.784065723f},
-std::array<float,2>{0.797389746f, 0.0743756592f},
-std::array<float,2>{0.347091585f, 0.97901541f},
-std::array<float,2>{0.0635172948f, 0.29310739f},
-std::array<float,2>{0.544659793f, 0.570371926f},
-std::array<float,2>{0.889029622f, 0.462146133f},
-std::array<float,2>{0.46409145f, 0.679821312f},
-std::array<float,2>{0.202205673f, 0.236425906f},
-std::array<float,2>{0.720700324f, 0.778419018f},
-std::array<float,2>{0.60838604f, 0.120948739f},
-std::array<float,2>{0.0324442573f, 0.942901254f},
-std::array<float,2>{0.255500764f, 0.277504146f},
-std::array<float,2>{0.861060143f, 0.601263821f},
-std::array<float,2>{0.6505391f, 0.32397449f},
-std::array<float,2>{0.132233024f, 0.557683349f},
-std::array<float,2>{0.408469737f, 0.0356901176f},
-std::array<float,2>{0.989160776f, 0.899238706f},
-std::array<float,2>{0.771030128f, 0.150176525f},
-std::array<float,2>{0.33375743f, 0.867317915f},
-std::array<float,2>{0.111551158f, 0.406361192f},
-std::array<float,2>{0.521143675f, 0.739572227f},
-std::array<float,2>{0.834529281f, 0.283960134f},
-std::array<float,2>{0.311712265f, 0.569308221f},
-std::array<float,2>{0.00959489774f, 0.0646438897f},
-std::array<float,2>{0.591501355f, 0.973793268f},
-std::array<float,2>{0.698168099f, 0.193022132f},
-std::array<float,2>{0.227349043f, 0.792679369f},
-std::array<float,2>{0.476710707f, 0.468826622f},
-std::array<float,2>{0.930097699f, 0.648710072f},
-std::array<float,2>{0.554481626f, 0.392079264f},
-std::array<float,2>{0.0860461369f, 0.688151181f},
-std::array<float,2>{0.370329827f, 0.18722932f},
-std::array<float,2>{0.789206624f, 0.839210689f},
-std::array<float,2>{0.950402617f, 0.0151392119f},
-std::array<float,2>{0.383751124f, 0.907969177f},
-std::array<float,2>{0.157232478f, 0.371136546f},
-std::array<float,2>{0.674196005f, 0.520524979f},
-std::array<float,2>{0.802521229f, 0.423016936f},
-std::array<float,2>{0.351263255f, 0.723844528f},
-std::array<float,2>{0.0664078891f, 0.139327347f},
-std::array<float,2>{0.539852619f, 0.850551069f},
-std::array<float,2>{0.661964953f, 0.0484979115f},
-std::array<float,2>{0.176796153f, 0.888976455f},
-std::array<float,2>{0.403590411f, 0.341886044f},
-std::array<float,2>{0.959837258f, 0.531503677f},
-std::array<float,2>{0.56526655f, 0.257217228f},
-std::array<float,2>{0.0156323779f, 0.621892571f},
-std::array<float,2>{0.287225842f, 0.10412237f},
-std::array<float,2>{0.827373326f, 0.963473737f},
-std::array<float,2>{0.906433165f, 0.230632618f},
-std::array<float,2>{0.496487528f, 0.751309097f},
-std::array<float,2>{0.242403239f, 0.441032588f},
-std::array<float,2>{0.708531916f, 0.667223513f},
-std::array<float,2>{0.973174632f, 0.354541004f},
-std::array<float,2>{0.422079206f, 0.513122976f},
-std::array<float,2>{0.154532641f, 0.0304467101f},
-std::array<float,2>{0.638987541f, 0.925534964f},
-std::array<float,2>{0.511391342f, 0.164564133f},
-std::array<float,2>{0.0967300907f, 0.825635552f},
-std::array<float,2>{0.317225426f, 0.376909226f},
-std::array<float,2>{0.754672289f, 0.718224823f},
-std::array<float,2>{0.739017785f, 0.498255998f},
-std::array<float,2>{0.211474672f, 0.627951026f},
-std::array<float,2>{0.438796163f, 0.217974722f},
-std::array<float,2>{0.903340578f, 0.79754436f},
-std::array<float,2>{0.857152402f, 0.0810540318f},
-std::array<float,2>{0.277159035f, 0.993967652f},
-std::array<float,2>{0.0525023825f, 0.306592256f},
-std::array<float,2>{0.620804787f, 0.58598119f},
-std::array<float,2>{0.967505455f, 0.386016101f},
-std::array<float,2>{0.390751004f, 0.704968095f},
-std::array<float,2>{0.186344758f, 0.161674887f},
-std::array<float,2>{0.671764195f, 0.816806257f},
-std::array<float,2>{0.533400834f, 0.021610843f},
-std::array<float,2>{0.0716345906f, 0.937012315f},
-std::array<float,2>{0.351883948f, 0.343888044f},
-std::array<float,2>{0.805918157f, 0.506144226f},
-std::array<float,2>{0.717418134f, 0.297551274f},
-std::array<float,2>{0.234571606f, 0.579682171f},
-std::array<float,2>{0.491432101f, 0.0873056427f},
-std::array<float,2>{0.916407704f, 0.987817049f},
-std::array<float,2>{0.814795494f, 0.210188851f},
-std::array<float,2>{0.293974847f, 0.809304655f},
-std::array<float,2>{0.0242356639f, 0.487650931f},
-std::array<float,2>{0.578010142f, 0.639804602f},
-std::array<float,2>{0.759987295f, 0.33089146f},
-std::array<float,2>{0.327912867f, 0.544737339f},
-std::array<float,2>{0.106436118f, 0.0619351417f},
-std::array<float,2>{0.500741899f, 0.875848472f},
-std::array<float,2>{0.625799596f, 0.132150382f},
-std::array<float,2>{0.141006693f, 0.857927322f},
-std::array<float,2>{0.431966007f, 0.430820912f},
-std::array<float,2>{0.979197145f, 0.732745588f},
-std::array<float,2>{0.61007899f, 0.447427541f},
-std::array<float,2>{0.0565666817f, 0.65806663f},
-std::array<float,2>{0.272137552f, 0.223796055f},
-std::array<float,2>{0.846726f, 0.764948308f},
-std::array<float,2>{0.897054076f, 0.0949594006f},
-std::array<float,2>{0.450212926f, 0.958573878f},
-std::array<float,2>{0.20555754f, 0.25899455f},
-std::array<float,2>{0.74647361f, 0.611037314f},
-std::array<float,2>{0.867411494f, 0.482503861f},
-std::array<float,2>{0.259732932f, 0.642811537f},
-std::array<float,2>{0.0406941064f, 0.203013793f},
-std::array<float,2>{0.599292874f, 0.788198829f},
-std::array<float,2>{0.731725395f, 0.0715822726f},
-std::array<float,2>{0.193192795f, 0.984107137f},
-std::array<float,2>{0.459027916f, 0.289852291f},
-std::array<float,2>{0.882552922f, 0.576709807f},
-std::array<float,2>{0.530237019f, 0.360142052f},
-std::array<float,2>{0.120217681f, 0.530272067f},
-std::array<float,2>{0.339153916f, 0.0073186676f},
-std::array<float,2>{0.777425468f, 0.920615673f},
-std::array<float,2>{0.998376667f, 0.175737783f},
-std::array<float,2>{0.415508091f, 0.835049272f},
-std::array<float,2>{0.135710865f, 0.399010718f},
-std::array<float,2>{0.643526435f, 0.696936548f},
-std::array<float,2>{0.926924229f, 0.27203694f},
-std::array<float,2>{0.470190763f, 0.607061207f},
-std::array<float,2>{0.219516486f, 0.111155987f},
-std::array<float,2>{0.692847908f, 0.946260512f},
-std::array<float,2>{0.581892669f, 0.244761661f},
-std::array<float,2>{0.00578999054f, 0.771841168f},
-std::array<float,2>{0.303034276f, 0.454920977f},
-std::array<float,2>{0.839423001f, 0.672440171f},
-std::array<float,2>{0.684830725f, 0.417445183f},
-std::array<float,2>{0.17034927f, 0.748929262f},
-std::array<float,2>{0.382368267f, 0.145127237f},
-std::array<float,2>{0.940260589f, 0.8639099f},
-std::array<float,2>{0.783612609f, 0.0444602147f},
-std::array<float,2>{0.364140242f, 0.895310223f},
-std::array<float,2>{0.0827937573f, 0.319719911f},
-std::array<float,2>{0.561647594f, 0.549072385f},
-std::array<float,2>{0.918989599f, 0.410177171f},
-std::array<float,2>{0.487838805f, 0.736486375f},
-std::array<float,2>{0.238499492f, 0.153185546f},
-std::array<float,2>{0.713448107f, 0.873649299f},
-std::array<float,2>{0.573718667f, 0.0319669805f},
-std::array<float,2>{0.0303511936f, 0.904024839f},
-std::array<float,2>{0.289459467f, 0.327402532f},
-std::array<float,2>{0.816890895f, 0.560126841f},
-std::array<float,2>{0.66701591f, 0.275399745f},
-std::array<float,2>{0.18004775f, 0.595982611f},
-std::array<float,2>{0.395742446f, 0.122928426f},
-std::array<float,2>{0.962380588f, 0.941135824f},
-std::array<float,2>{0.811135054f, 0.240854189f},
-std::array<float,2>{0.357481062f, 0.774238825f},
-std::array<float,2>{0.0775412321f, 0.46489042f},
-std::array<float,2>{0.53800118f, 0.685918689f},
-std::array<float,2>{0.849646688f, 0.368420601f},
-std::array<float,2>{0.266378284f, 0.516490042f},
-std::array<float,2>{0.0613685474f, 0.00782439578f},
-std::array<float,2>{0.616503f, 0.911341727f},
-std::array<float,2>{0.745610595f, 0.18063812f},
-std::array<float,2>{0.209767148f, 0.842632949f},
-std::array<float,2>{0.445805132f, 0.39462164f},
-std::array<float,2>{0.890793562f, 0.694706261f},
-std::array<float,2>{0.504780889f, 0.47441712f},
-std::array<float,2>{0.103773065f, 0.656116426f},
-std::array<float,2>{0.322078824f, 0.191234484f},
-std::array<float,2>{0.763341069f, 0.795885801f},
-std::array<float,2>{0.982012928f, 0.0700564161f},
-std::array<float,2>{0.434184551f, 0.97165072f},
-std::array<float,2>{0.144929692f, 0.287308604f},
-std::array<float,2>{0.632662833f, 0.563450813f},
-std::array<float,2>{0.775439739f, 0.443574846f},
-std::array<float,2>{0.343439043f, 0.670502484f},
-std::array<float,2>{0.124686792f, 0.228067711f},
-std::array<float,2>{0.527103543f, 0.757577717f},
-std::array<float,2>{0.647907376f, 0.107762441f},
-std::array<float,2>{0.13727279f, 0.967732906f},
-std::array<float,2>{0.42139411f, 0.252505451f},
-std::array<float,2>{0.995026529f, 0.618980467f},
-std::array<float,2>{0.597516537f, 0.336168706f},
-std::array<float,2>{0.0456161983f, 0.535694063f},
-std::array<float,2>{0.263968438f, 0.0544464439f},
-std::array<float,2>{0.873374581f, 0.882933021f},
-std::array<float,2>{0.875441253f, 0.135823309f},
-std::array<float,2>{0.455173045f, 0.845000982f},
-std::array<float,2>{0.189384893f, 0.425810605f},
-std::array<float,2>{0.726833582f, 0.719008982f},
-std::array<float,2>{0.941623509f, 0.308598608f},
-std::array<float,2>{0.378035605f, 0.592197359f},
-std::array<float,2>{0.16415526f, 0.0828469247f},
-std::array<float,2>{0.680450618f, 0.998707533f},
-std::array<float,2>{0.555539131f, 0.214585409f},
-std::array<float,2>{0.0819704682f, 0.801158249f},
-std::array<float,2>{0.360389858f, 0.494110376f},
-std::array<float,2>{0.785273194f, 0.629425347f},
-std::array<float,2>{0.687847316f, 0.380456746f},
-std::array<float,2>{0.224072054f, 0.713241279f},
-std::array<float,2>{0.473389655f, 0.170287743f},
-std::array<float,2>{0.92445457f, 0.820699155f},
-std::array<float,2>{0.841520071f, 0.0236489736f},
-std::array<float,2>{0.298732698f, 0.92854172f},
-std::array<float,2>{0.000238072287f, 0.356087446f},
-std::array<float,2>{0.583764613f, 0.509051502f},
-std::array<float,2>{0.984792888f, 0.488505363f},
-std::array<float,2>{0.412626624f, 0.63580209f},
-std::array<float,2>{0.128066152f, 0.204922408f},
-std::array<float,2>{0.656200826f, 0.805270076f},
-std::array<float,2>{0.519097149f, 0.0906366333f},
-std::array<float,2>{0.115538068f, 0.988343596f},
-std::array<float,2>{0.331891f, 0.30310455f},
-std::array<float,2>{0.769120634f, 0.582868516f},
-std::array<float,2>{0.725380123f, 0.349885136f},
-std::array<float,2>{0.197201714f, 0.503355324f},
-std::array<float,2>{0.46734485f, 0.0161355119f},
-std::array<float,2>{0.885741949f, 0.932878554f},
-std::array<float,2>{0.863642752f, 0.158148825f},
-std::array<float,2>{0.252287924f, 0.816353261f},
-std::array<float,2>{0.0354539789f, 0.387533396f},
-std::array<float,2>{0.604518831f, 0.708752215f},
-std::array<float,2>{0.793496132f, 0.262727708f},
-std::array<float,2>{0.372443289f, 0.615481496f},
-std::array<float,2>{0.0924772248f, 0.0992109329f},
-std::array<float,2>{0.550140142f, 0.954469979f},
-std::array<float,2>{0.679269195f, 0.221354812f},
-std::array<float,2>{0.161857739f, 0.760310352f},
-std::array<float,2>{0.390324354f, 0.450081229f},
-std::array<float,2>{0.948377967f, 0.66111064f},
-std::array<float,2>{0.586719334f, 0.437330782f},
-std::array<float,2>{0.0148512227f, 0.728090882f},
-std::array<float,2>{0.305392981f, 0.128778398f},
-std::array<float,2>{0.831259727f, 0.854749143f},
-std::array<float,2>{0.937118948f, 0.0578815751f},
-std::array<float,2>{0.482885659f, 0.879705071f},
-std::array<float,2>{0.231943682f, 0.332613558f},
-std::array<float,2>{0.701956987f, 0.54243046f},
-std::array<float,2>{0.821566939f, 0.4052203f},
-std::array<float,2>{0.282400906f, 0.701298416f},
-std::array<float,2>{0.0225225314f, 0.175981149f},
-std::array<float,2>{0.566453695f, 0.83057344f},
-std::array<float,2>{0.705620468f, 0.000608838338f},
-std::array<float,2>{0.249468327f, 0.9146685f},
-std::array<float,2>{0.495727062f, 0.366624117f},
-std::array<float,2>{0.912801683f, 0.523925304f},
-std::array<float,2>{0.546648562f, 0.294947982f},
-std::array<float,2>{0.0659179911f, 0.573482335f},
-std::array<float,2>{0.344894737f, 0.0778496563f},
-std::array<float,2>{0.799998224f, 0.97800684f},
-std::array<float,2>{0.953583896f, 0.197933033f},
-std::array<float,2>{0.399099618f, 0.783023179f},
-std::array<float,2>{0.173138753f, 0.477873504f},
-std::array<float,2>{0.658066332f, 0.647792697f},
-std::array<float,2>{0.901504755f, 0.314085811f},
-std::array<float,2>{0.442849308f, 0.554561496f},
-std::array<float,2>{0.215596989f, 0.0403945148f},
-std::array<float,2>{0.737652659f, 0.893341362f},
-std::array<float,2>{0.624618948f, 0.144486785f},
-std::array<float,2>{0.0500439294f, 0.861920118f},
-std::array<float,2>{0.280131698f, 0.41991511f},
-std::array<float,2>{0.854139626f, 0.743029952f},
-std::array<float,2>{0.634134531f, 0.458813041f},
-std::array<float,2>{0.148489714f, 0.679119229f},
-std::array<float,2>{0.429192841f, 0.247113094f},
-std::array<float,2>{0.97008878f, 0.768610239f},
-std::array<float,2>{0.753427804f, 0.115619481f},
-std::array<float,2>{0.314319849f, 0.951672494f},
-std::array<float,2>{0.0992500782f, 0.269208729f},
-std::array<float,2>{0.514152527f, 0.60253489f},
-std::array<float,2>{0.903288722f, 0.496691287f},
-std::array<float,2>{0.43794474f, 0.625308394f},
-std::array<float,2>{0.212199748f, 0.21565932f},
-std::array<float,2>{0.739325106f, 0.800311565f},
-std::array<float,2>{0.619541049f, 0.0797867253f},
-std::array<float,2>{0.051307831f, 0.995325685f},
-std::array<float,2>{0.275863945f, 0.307259232f},
-std::array<float,2>{0.856078386f, 0.588212132f},
-std::array<float,2>{0.6405316f, 0.352599144f},
-std::array<float,2>{0.15619497f, 0.515091836f},
-std::array<float,2>{0.423351973f, 0.0282774381f},
-std::array<float,2>{0.973736048f, 0.92363286f},
-std::array<float,2>{0.755766511f, 0.166550234f},
-std::array<float,2>{0.317446053f, 0.827829838f},
-std::array<float,2>{0.0961087793f, 0.377013743f},
-std::array<float,2>{0.510521889f, 0.716287076f},
-std::array<float,2>{0.826289654f, 0.255120307f},
-std::array<float,2>{0.288841486f, 0.62322104f},
-std::array<float,2>{0.0172750093f, 0.102392383f},
-std::array<float,2>{0.565991879f, 0.962171614f},
-std::array<float,2>{0.707638264f, 0.233890414f},
-std::array<float,2>{0.243381947f, 0.753698766f},
-std::array<float,2>{0.497083604f, 0.439251781f},
-std::array<float,2>{0.908062816f, 0.665875733f},
-std::array<float,2>{0.540449202f, 0.424563944f},
-std::array<float,2>{0.0678189546f, 0.725016296f},
-std::array<float,2>{0.349653542f, 0.137537718f},
-std::array<float,2>{0.801013231f, 0.849575877f},
-std::array<float,2>{0.96040976f, 0.0502915345f},
-std::array<float,2>{0.402734488f, 0.886733651f},
-std::array<float,2>{0.176653594f, 0.340985715f},
-std::array<float,2>{0.660917699f, 0.534939408f},
-std::array<float,2>{0.79091984f, 0.394010901f},
-std::array<float,2>{0.369677693f, 0.69137609f},
-std::array<float,2>{0.0876992941f, 0.184538051f},
-std::array<float,2>{0.552980304f, 0.835958481f},
-std::array<float,2>{0.675524354f, 0.0118250661f},
-std::array<float,2>{0.156297863f, 0.909928679f},
-std::array<float,2>{0.383850008f, 0.374883533f},
-std::array<float,2>{0.949258327f, 0.521594524f},
-std::array<float,2>{0.59077996f, 0.282313108f},
-std::array<float,2>{0.00856616348f, 0.567260027f},
-std::array<float,2>{0.310827851f, 0.0631744042f},
-std::array<float,2>{0.835619926f, 0.975377977f},
-std::array<float,2>{0.930802941f, 0.193935454f},
-std::array<float,2>{0.477636158f, 0.789281249f},
-std::array<float,2>{0.227943212f, 0.470958859f},
-std::array<float,2>{0.699184f, 0.650428891f},
-std::array<float,2>{0.989348829f, 0.32041049f},
-std::array<float,2>{0.409460068f, 0.555350125f},
-std::array<float,2>{0.13115561f, 0.0389973857f},
-std::array<float,2>{0.652105868f, 0.901311696f},
-std::array<float,2>{0.519735038f, 0.152005315f},
-std::array<float,2>{0.112391278f, 0.869863331f},
-std::array<float,2>{0.332157105f, 0.409781247f},
-std::array<float,2>{0.770041585f, 0.740650535f},
-std::array<float,2>{0.718965411f, 0.464180291f},
-std::array<float,2>{0.201785713f, 0.682155728f},
-std::array<float,2>{0.463636369f, 0.235218331f},
-std::array<float,2>{0.890040576f, 0.780776858f},
-std::array<float,2>{0.860291779f, 0.117857188f},
-std::array<float,2>{0.254181176f, 0.945194364f},
-std::array<float,2>{0.0321573801f, 0.280193627f},
-std::array<float,2>{0.608747125f, 0.598896205f},
-std::array<float,2>{0.941347659f, 0.415234983f},
-std::array<float,2>{0.38150692f, 0.74797678f},
-std::array<float,2>{0.171690941f, 0.148089424f},
-std::array<float,2>{0.684212565f, 0.866734564f},
-std::array<float,2>{0.561508596f, 0.0459511578f},
-std::array<float,2>{0.0839528292f, 0.89724946f},
-std::array<float,2>{0.364592224f, 0.317791969f},
-std::array<float,2>{0.784567177f, 0.547974706f},
-std::array<float,2>{0.692315161f, 0.271071315f},
-std::array<float,2>{0.2198883f, 0.608847141f},
-std::array<float,2>{0.469252259f, 0.112612359f},
-std::array<float,2>{0.926031888f, 0.949195325f},
-std::array<float,2>{0.838017106f, 0.244009554f},
-std::array<float,2>{0.303999901f, 0.769554436f},
-std::array<float,2>{0.00458852667f, 0.455313802f},
-std::array<float,2>{0.580427408f, 0.674506187f},
-std::array<float,2>{0.778857112f, 0.362617075f},
-std::array<float,2>{0.338390738f, 0.529231012f},
-std::array<float,2>{0.119742677f, 0.00534701487f},
-std::array<float,2>{0.530971169f, 0.919351995f},
-std::array<float,2>{0.643579185f, 0.173007324f},
-std::array<float,2>{0.136305451f, 0.832863927f},
-std::array<float,2>{0.414526612f, 0.401116788f},
-std::array<float,2>{0.999452591f, 0.697340965f},
-std::array<float,2>{0.598234236f, 0.480654627f},
-std::array<float,2>{0.0392337106f, 0.642450988f},
-std::array<float,2>{0.258194149f, 0.200082511f},
-std::array<float,2>{0.869136989f, 0.785817921f},
-std::array<float,2>{0.881520867f, 0.0739087611f},
-std::array<float,2>{0.460117757f, 0.98071599f},
-std::array<float,2>{0.191935271f, 0.292244613f},
-std::array<float,2>{0.731207848f, 0.574806392f},
-std::array<float,2>{0.846422672f, 0.446956575f},
-std::array<float,2>{0.272817433f, 0.658973217f},
-std::array<float,2>{0.0556439944f, 0.225226581f},
-std::array<float,2>{0.611259818f, 0.76329869f},
-std::array<float,2>{0.747298181f, 0.0965247229f},
-std::array<float,2>{0.206267774f, 0.960676253f},
-std::array<float,2>{0.449280471f, 0.261446834f},
-std::array<float,2>{0.897798061f, 0.612873018f},
-std::array<float,2>{0.501641214f, 0.328373075f},
-std::array<float,2>{0.106451645f, 0.546512842f},
-std::array<float,2>{0.326207727f, 0.0591248684f},
-std::array<float,2>{0.761398971f, 0.878813386f},
-std::array<float,2>{0.980324626f, 0.130817667f},
-std::array<float,2>{0.433390707f, 0.855721831f},
-std::array<float,2>{0.142543122f, 0.433167994f},
-std::array<float,2>{0.626710534f, 0.73176378f},
-std::array<float,2>{0.917465031f, 0.300230384f},
-std::array<float,2>{0.491068304f, 0.581307828f},
-std::array<float,2>{0.235805243f, 0.0885507762f},
-std::array<float,2>{0.717927456f, 0.985565186f},
-std::array<float,2>{0.576342821f, 0.207646295f},
-std::array<float,2>{0.0250377357f, 0.811433613f},
-std::array<float,2>{0.29369837f, 0.486222088f},
-std::array<float,2>{0.816379488f, 0.637103379f},
-std::array<float,2>{0.670485973f, 0.384669363f},
-std::array<float,2>{0.187170431f, 0.706580162f},
-std::array<float,2>{0.391702771f, 0.16305545f},
-std::array<float,2>{0.968182683f, 0.819600403f},
-std::array<float,2>{0.805398405f, 0.0196318049f},
-std::array<float,2>{0.353478044f, 0.935051858f},
-std::array<float,2>{0.0710329637f, 0.347174793f},
-std::array<float,2>{0.534542143f, 0.504244804f},
-std::array<float,2>{0.925109029f, 0.38254112f},
-std::array<float,2>{0.474580824f, 0.711640954f},
-std::array<float,2>{0.223249808f, 0.169882149f},
-std::array<float,2>{0.688895226f, 0.822284162f},
-std::array<float,2>{0.582805336f, 0.0262923669f},
-std::array<float,2>{0.00141011144f, 0.926854849f},
-std::array<float,2>{0.297169507f, 0.359085172f},
-std::array<float,2>{0.840333283f, 0.511597812f},
-std::array<float,2>{0.681403041f, 0.311351985f},
-std::array<float,2>{0.165296867f, 0.59166497f},
-std::array<float,2>{0.377473921f, 0.085052669f},
-std::array<float,2>{0.94335109f, 0.99737823f},
-std::array<float,2>{0.786229312f, 0.211022183f},
-std::array<float,2>{0.359581321f, 0.804631352f},
-std::array<float,2>{0.0804533884f, 0.495327592f},
-std::array<float,2>{0.555776834f, 0.631124735f},
-std::array<float,2>{0.874628007f, 0.338975817f},
-std::array<float,2>{0.264775395f, 0.538617849f},
-std::array<float,2>{0.0459004343f, 0.0518663451f},
-std::array<float,2>{0.595782518f, 0.886077762f},
-std::array<float,2>{0.728110492f, 0.134687841f},
-std::array<float,2>{0.188289806f, 0.846009731f},
-std::array<float,2>{0.456841797f, 0.428230911f},
-std::array<float,2>{0.876938283f, 0.72156322f},
-std::array<float,2>{0.526165307f, 0.443279624f},
-std::array<float,2>{0.123835355f, 0.669856369f},
-std::array<float,2>{0.341819882f, 0.229567707f},
-std::array<float,2>{0.776464224f, 0.754731715f},
-std::array<float,2>{0.995970845f, 0.10596817f},
-std::array<float,2>{0.420072645f, 0.9667328f},
-std::array<float,2>{0.138009414f, 0.251556098f},
-std::array<float,2>{0.647243977f, 0.620829701f},
-std::array<float,2>{0.762616754f, 0.474626064f},
-std::array<float,2>{0.320468009f, 0.652369559f},
-std::array<float,2>{0.105012007f, 0.188255221f},
-std::array<float,2>{0.505393207f, 0.793423772f},
-std::array<float,2>{0.631658077f, 0.0680674985f},
-std::array<float,2>{0.145778f, 0.970549464f},
-std::array<float,2>{0.434627414f, 0.285654753f},
-std::array<float,2>{0.981058002f, 0.564887702f},
-std::array<float,2>{0.615621805f, 0.370343536f},
-std::array<float,2>{0.0621501766f, 0.518510818f},
-std::array<float,2>{0.266739547f, 0.0116493776f},
-std::array<float,2>{0.850895703f, 0.912231266f},
-std::array<float,2>{0.892142832f, 0.181987599f},
-std::array<float,2>{0.44630453f, 0.840001583f},
-std::array<float,2>{0.210882694f, 0.397397846f},
-std::array<float,2>{0.744854212f, 0.691830039f},
-std::array<float,2>{0.961261749f, 0.274520487f},
-std::array<float,2>{0.395022929f, 0.595681369f},
-std::array<float,2>{0.181321025f, 0.123285688f},
-std::array<float,2>{0.666607738f, 0.93916142f},
-std::array<float,2>{0.538864434f, 0.239362553f},
-std::array<float,2>{0.0770648122f, 0.776102304f},
-std::array<float,2>{0.358496308f, 0.467650741f},
-std::array<float,2>{0.812171757f, 0.684823036f},
-std::array<float,2>{0.714018524f, 0.413571417f},
-std::array<float,2>{0.24020499f, 0.735083938f},
-std::array<float,2>{0.487147421f, 0.15500471f},
-std::array<float,2>{0.91809845f, 0.871577322f},
-std::array<float,2>{0.817644536f, 0.0344287306f},
-std::array<float,2>{0.290196538f, 0.906145632f},
-std::array<float,2>{0.0299891774f, 0.325020403f},
-std::array<float,2>{0.572336137f, 0.561326683f},
-std::array<float,2>{0.96877569f, 0.459640354f},
-std::array<float,2>{0.427743435f, 0.676113963f},
-std::array<float,2>{0.149729192f, 0.249279872f},
-std::array<float,2>{0.632853568f, 0.767290473f},
-std::array<float,2>{0.51464951f, 0.114786178f},
-std::array<float,2>{0.0981202424f, 0.949948311f},
-std::array<float,2>{0.31252265f, 0.26738587f},
-std::array<float,2>{0.752228916f, 0.604412138f},
-std::array<float,2>{0.736787736f, 0.315193087f},
-std::array<float,2>{0.216390669f, 0.551324427f},
-std::array<float,2>{0.441857606f, 0.0423077419f},
-std::array<float,2>{0.901329696f, 0.891091466f},
-std::array<float,2>{0.855300784f, 0.141484067f},
-std::array<float,2>{0.280328304f, 0.861013412f},
-std::array<float,2>{0.0490231588f, 0.421679676f},
-std::array<float,2>{0.623238087f, 0.744993627f},
-std::array<float,2>{0.799419403f, 0.29402408f},
-std::array<float,2>{0.343922436f, 0.571675122f},
-std::array<float,2>{0.0645654723f, 0.0759581178f},
-std::array<float,2>{0.545676231f, 0.979684174f},
-std::array<float,2>{0.656671107f, 0.196525574f},
-std::array<float,2>{0.172245443f, 0.785046935f},
-std::array<float,2>{0.399923891f, 0.479697078f},
-std::array<float,2>{0.954910755f, 0.646092355f},
-std::array<float,2>{0.568186045f, 0.403936118f},
-std::array<float,2>{0.0224595685f, 0.699853361f},
-std::array<float,2>{0.281712323f, 0.178281069f},
-std::array<float,2>{0.820563912f, 0.829402864f},
-std::array<float,2>{0.913850367f, 0.00341846654f},
-std::array<float,2>{0.494986534f, 0.916983366f},
-std::array<float,2>{0.248639956f, 0.36426574f},
-std::array<float,2>{0.706192791f, 0.527132571f},
-std::array<float,2>{0.830310941f, 0.434752792f},
-std::array<float,2>{0.306577384f, 0.729391277f},
-std::array<float,2>{0.0137312105f, 0.126575097f},
-std::array<float,2>{0.587491035f, 0.853175819f},
-std::array<float,2>{0.702735305f, 0.0553312711f},
-std::array<float,2>{0.230731517f, 0.882743001f},
-std::array<float,2>{0.48376137f, 0.334139228f},
-std::array<float,2>{0.936290979f, 0.54055649f},
-std::array<float,2>{0.54903537f, 0.263736308f},
-std::array<float,2>{0.093716152f, 0.613711953f},
-std::array<float,2>{0.371287107f, 0.101317011f},
-std::array<float,2>{0.794457436f, 0.955374539f},
-std::array<float,2>{0.94791019f, 0.220645949f},
-std::array<float,2>{0.389496803f, 0.758689344f},
-std::array<float,2>{0.161028862f, 0.451365232f},
-std::array<float,2>{0.678482354f, 0.662677586f},
-std::array<float,2>{0.886232197f, 0.347833961f},
-std::array<float,2>{0.468231618f, 0.500398755f},
-std::array<float,2>{0.195609897f, 0.018022351f},
-std::array<float,2>{0.726258874f, 0.930243373f},
-std::array<float,2>{0.603679478f, 0.159229755f},
-std::array<float,2>{0.036272984f, 0.814446092f},
-std::array<float,2>{0.253776103f, 0.390080959f},
-std::array<float,2>{0.864884675f, 0.709008873f},
-std::array<float,2>{0.654308379f, 0.492177367f},
-std::array<float,2>{0.127248645f, 0.634068668f},
-std::array<float,2>{0.413101256f, 0.205844492f},
-std::array<float,2>{0.985364497f, 0.806837559f},
-std::array<float,2>{0.76804477f, 0.0934185013f},
-std::array<float,2>{0.330321044f, 0.990904808f},
-std::array<float,2>{0.11710725f, 0.302604944f},
-std::array<float,2>{0.518337488f, 0.585137129f},
-std::array<float,2>{0.909876585f, 0.440049917f},
-std::array<float,2>{0.499209881f, 0.666726887f},
-std::array<float,2>{0.245688692f, 0.231933668f},
-std::array<float,2>{0.710340738f, 0.750035346f},
-std::array<float,2>{0.563537478f, 0.105274133f},
-std::array<float,2>{0.0179738123f, 0.963895202f},
-std::array<float,2>{0.286587715f, 0.255880773f},
-std::array<float,2>{0.825615048f, 0.62295258f},
-std::array<float,2>{0.662433982f, 0.343523175f},
-std::array<float,2>{0.178126559f, 0.532507002f},
-std::array<float,2>{0.404500991f, 0.0476447195f},
-std::array<float,2>{0.958642542f, 0.889697373f},
-std::array<float,2>{0.802864254f, 0.139708385f},
-std::array<float,2>{0.348113745f, 0.851429701f},
-std::array<float,2>{0.0701358616f, 0.422088802f},
-std::array<float,2>{0.542654335f, 0.723141432f},
-std::array<float,2>{0.858312964f, 0.305061758f},
-std::array<float,2>{0.274524719f, 0.587591767f},
-std::array<float,2>{0.054395102f, 0.0819230825f},
-std::array<float,2>{0.617936671f, 0.992755413f},
-std::array<float,2>{0.740873277f, 0.216866449f},
-std::array<float,2>{0.213738173f, 0.798668623f},
-std::array<float,2>{0.440624595f, 0.49999699f},
-std::array<float,2>{0.905130863f, 0.627613962f},
-std::array<float,2>{0.509569407f, 0.375647753f},
-std::array<float,2>{0.0938117653f, 0.717182636f},
-std::array<float,2>{0.320082396f, 0.165101469f},
-std::array<float,2>{0.756081402f, 0.824384153f},
-std::array<float,2>{0.976460934f, 0.0297458414f},
-std::array<float,2>{0.425365627f, 0.924250007f},
-std::array<float,2>{0.152994156f, 0.354461849f},
-std::array<float,2>{0.638433158f, 0.512441754f},
-std::array<float,2>{0.773293078f, 0.407951534f},
-std::array<float,2>{0.335439354f, 0.738880575f},
-std::array<float,2>{0.110714108f, 0.149410933f},
-std::array<float,2>{0.522616088f, 0.868684471f},
-std::array<float,2>{0.650124669f, 0.03622609f},
-std::array<float,2>{0.129843652f, 0.900019169f},
-std::array<float,2>{0.407469481f, 0.323177278f},
-std::array<float,2>{0.991250098f, 0.557111561f},
-std::array<float,2>{0.606898427f, 0.27857247f},
-std::array<float,2>{0.0347757414f, 0.59979099f},
-std::array<float,2>{0.256156683f, 0.119227797f},
-std::array<float,2>{0.861702561f, 0.941518545f},
-std::array<float,2>{0.887334704f, 0.237486929f},
-std::array<float,2>{0.461885244f, 0.777953386f},
-std::array<float,2>{0.200453311f, 0.461723953f},
-std::array<float,2>{0.721737087f, 0.681060791f},
-std::array<float,2>{0.952023387f, 0.372340947f},
-std::array<float,2>{0.385149419f, 0.519657671f},
-std::array<float,2>{0.15987128f, 0.0145398015f},
-std::array<float,2>{0.672219992f, 0.906923652f},
-std::array<float,2>{0.552603781f, 0.185661033f},
-std::array<float,2>{0.0890637264f, 0.838806033f},
-std::array<float,2>{0.368507981f, 0.391207933f},
-std::array<float,2>{0.792498648f, 0.689319432f},
-std::array<float,2>{0.696736634f, 0.469943404f},
-std::array<float,2>{0.230083674f, 0.649616182f},
-std::array<float,2>{0.479457915f, 0.191457003f},
-std::array<float,2>{0.933084011f, 0.791741073f},
-std::array<float,2>{0.83318913f, 0.0655204654f},
-std::array<float,2>{0.309317172f, 0.972679675f},
-std::array<float,2>{0.0104548093f, 0.285114288f},
-std::array<float,2>{0.592705131f, 0.570021868f},
-std::array<float,2>{0.997091413f, 0.399541765f},
-std::array<float,2>{0.416201919f, 0.695961237f},
-std::array<float,2>{0.133364037f, 0.174213365f},
-std::array<float,2>{0.641183257f, 0.834487081f},
-std::array<float,2>{0.52878207f, 0.00622780062f},
-std::array<float,2>{0.118654467f, 0.921152055f},
-std::array<float,2>{0.336447418f, 0.360598326f},
-std::array<float,2>{0.780231416f, 0.530364871f},
-std::array<float,2>{0.732757747f, 0.290902793f},
-std::array<float,2>{0.193650648f, 0.577472389f},
-std::array<float,2>{0.457232118f, 0.070796214f},
-std::array<float,2>{0.87964803f, 0.982634783f},
-std::array<float,2>{0.869297266f, 0.201194257f},
-std::array<float,2>{0.261214912f, 0.78725332f},
-std::array<float,2>{0.0427457839f, 0.484221697f},
-std::array<float,2>{0.600212216f, 0.643788457f},
-std::array<float,2>{0.78310281f, 0.318720162f},
-std::array<float,2>{0.366895705f, 0.549910307f},
-std::array<float,2>{0.084442988f, 0.0437772162f},
-std::array<float,2>{0.559198618f, 0.895894051f},
-std::array<float,2>{0.686026931f, 0.146252424f},
-std::array<float,2>{0.169365764f, 0.865082979f},
-std::array<float,2>{0.380787134f, 0.416903317f},
-std::array<float,2>{0.937576592f, 0.749143779f},
-std::array<float,2>{0.579746604f, 0.453555882f},
-std::array<float,2>{0.00716487085f, 0.673740506f},
-std::array<float,2>{0.301560313f, 0.245624259f},
-std::array<float,2>{0.837064028f, 0.773236454f},
-std::array<float,2>{0.929112852f, 0.110191517f},
-std::array<float,2>{0.471513778f, 0.946771085f},
-std::array<float,2>{0.222020388f, 0.273189336f},
-std::array<float,2>{0.694587648f, 0.60590297f},
-std::array<float,2>{0.812694967f, 0.486768901f},
-std::array<float,2>{0.295833439f, 0.639192045f},
-std::array<float,2>{0.0269382317f, 0.209634811f},
-std::array<float,2>{0.574517369f, 0.809878945f},
-std::array<float,2>{0.714922011f, 0.0864720717f},
-std::array<float,2>{0.237858951f, 0.986839473f},
-std::array<float,2>{0.48924315f, 0.298261046f},
-std::array<float,2>{0.915572703f, 0.578721106f},
-std::array<float,2>{0.53187567f, 0.345190197f},
-std::array<float,2>{0.0724515542f, 0.507207453f},
-std::array<float,2>{0.354880035f, 0.022478845f},
-std::array<float,2>{0.808205187f, 0.936392605f},
-std::array<float,2>{0.966305733f, 0.160531819f},
-std::array<float,2>{0.392592549f, 0.817541003f},
-std::array<float,2>{0.185326412f, 0.38514185f},
-std::array<float,2>{0.669530332f, 0.704082429f},
-std::array<float,2>{0.896187723f, 0.25817436f},
-std::array<float,2>{0.452089041f, 0.610289991f},
-std::array<float,2>{0.204104051f, 0.0942886248f},
-std::array<float,2>{0.74862504f, 0.957759321f},
-std::array<float,2>{0.611476481f, 0.223478913f},
-std::array<float,2>{0.0585872047f, 0.763799071f},
-std::array<float,2>{0.271019131f, 0.448901355f},
-std::array<float,2>{0.84486717f, 0.656759202f},
-std::array<float,2>{0.628717899f, 0.43063733f},
-std::array<float,2>{0.143093303f, 0.733756363f},
-std::array<float,2>{0.430220634f, 0.131015286f},
-std::array<float,2>{0.97689712f, 0.858427942f},
-std::array<float,2>{0.758118093f, 0.0614949241f},
-std::array<float,2>{0.324989259f, 0.876519084f},
-std::array<float,2>{0.107796565f, 0.331457824f},
-std::array<float,2>{0.503077924f, 0.543735147f},
-std::array<float,2>{0.878432631f, 0.427147985f},
-std::array<float,2>{0.455033302f, 0.720203638f},
-std::array<float,2>{0.18951197f, 0.134939298f},
-std::array<float,2>{0.729057968f, 0.844192624f},
-std::array<float,2>{0.594302118f, 0.0531137176f},
-std::array<float,2>{0.0441651493f, 0.884301245f},
-std::array<float,2>{0.263141781f, 0.337286502f},
-std::array<float,2>{0.872970164f, 0.536467075f},
-std::array<float,2>{0.645507097f, 0.253430933f},
-std::array<float,2>{0.139443204f, 0.617600322f},
-std::array<float,2>{0.419735312f, 0.108607642f},
-std::array<float,2>{0.994104564f, 0.968279123f},
-std::array<float,2>{0.773727357f, 0.226761326f},
-std::array<float,2>{0.33997184f, 0.75645107f},
-std::array<float,2>{0.122621827f, 0.444785595f},
-std::array<float,2>{0.523556352f, 0.671141267f},
-std::array<float,2>{0.842102826f, 0.356970429f},
-std::array<float,2>{0.299304992f, 0.508286893f},
-std::array<float,2>{0.0035031999f, 0.0253889989f},
-std::array<float,2>{0.584658146f, 0.929275453f},
-std::array<float,2>{0.690029681f, 0.171261922f},
-std::array<float,2>{0.226519465f, 0.822178125f},
-std::array<float,2>{0.475397855f, 0.378958941f},
-std::array<float,2>{0.923055112f, 0.714093804f},
-std::array<float,2>{0.55719763f, 0.492227584f},
-std::array<float,2>{0.0786864012f, 0.630690873f},
-std::array<float,2>{0.36234206f, 0.213101536f},
-std::array<float,2>{0.788655579f, 0.802000403f},
-std::array<float,2>{0.944902599f, 0.0834148675f},
-std::array<float,2>{0.37689662f, 0.999296188f},
-std::array<float,2>{0.166668102f, 0.310286433f},
-std::array<float,2>{0.681682765f, 0.593067467f},
-std::array<float,2>{0.810272038f, 0.466221124f},
-std::array<float,2>{0.356509447f, 0.687019527f},
-std::array<float,2>{0.0754727274f, 0.24157539f},
-std::array<float,2>{0.536231041f, 0.774458468f},
-std::array<float,2>{0.665620327f, 0.121763192f},
-std::array<float,2>{0.183010012f, 0.940215051f},
-std::array<float,2>{0.397302449f, 0.27642256f},
-std::array<float,2>{0.964720011f, 0.597620606f},
-std::array<float,2>{0.571388721f, 0.326901942f},
-std::array<float,2>{0.0279879943f, 0.559331059f},
-std::array<float,2>{0.292679638f, 0.0329322293f},
-std::array<float,2>{0.819643378f, 0.902957618f},
-std::array<float,2>{0.921766043f, 0.153997093f},
-std::array<float,2>{0.485944301f, 0.874301016f},
-std::array<float,2>{0.240326777f, 0.411368072f},
-std::array<float,2>{0.712650239f, 0.738181472f},
-std::array<float,2>{0.984291077f, 0.288736314f},
-std::array<float,2>{0.436692208f, 0.564261079f},
-std::array<float,2>{0.146606535f, 0.0691248178f},
-std::array<float,2>{0.629827976f, 0.972504258f},
-std::array<float,2>{0.506207168f, 0.189916462f},
-std::array<float,2>{0.102959186f, 0.796217978f},
-std::array<float,2>{0.322474658f, 0.473272294f},
-std::array<float,2>{0.764056087f, 0.655048072f},
-std::array<float,2>{0.743717134f, 0.395744264f},
-std::array<float,2>{0.207158104f, 0.694207191f},
-std::array<float,2>{0.447970241f, 0.181557968f},
-std::array<float,2>{0.894470274f, 0.843361378f},
-std::array<float,2>{0.848419487f, 0.00881201122f},
-std::array<float,2>{0.26929152f, 0.911127448f},
-std::array<float,2>{0.0592897981f, 0.36790213f},
-std::array<float,2>{0.614355803f, 0.51682061f},
-std::array<float,2>{0.955660939f, 0.477149218f},
-std::array<float,2>{0.401961774f, 0.646738708f},
-std::array<float,2>{0.175073951f, 0.198592693f},
-std::array<float,2>{0.658667505f, 0.781456351f},
-std::array<float,2>{0.543807924f, 0.0764180049f},
-std::array<float,2>{0.0626299456f, 0.977163494f},
-std::array<float,2>{0.346532553f, 0.296492875f},
-std::array<float,2>{0.798219919f, 0.573145568f},
-std::array<float,2>{0.704163849f, 0.366142452f},
-std::array<float,2>{0.24617146f, 0.525268972f},
-std::array<float,2>{0.492340893f, 0.00115917285f},
-std::array<float,2>{0.911468983f, 0.915905416f},
-std::array<float,2>{0.823712349f, 0.177078828f},
-std::array<float,2>{0.284561157f, 0.831967771f},
-std::array<float,2>{0.0210687201f, 0.405328721f},
-std::array<float,2>{0.569728374f, 0.702643454f},
-std::array<float,2>{0.750472605f, 0.268038869f},
-std::array<float,2>{0.314911813f, 0.602762282f},
-std::array<float,2>{0.101393655f, 0.116358966f},
-std::array<float,2>{0.512592614f, 0.953078508f},
-std::array<float,2>{0.636417747f, 0.246155232f},
-std::array<float,2>{0.150885507f, 0.767871022f},
-std::array<float,2>{0.425827086f, 0.457563043f},
-std::array<float,2>{0.971332669f, 0.678245842f},
-std::array<float,2>{0.622536898f, 0.418396533f},
-std::array<float,2>{0.0481987633f, 0.744069219f},
-std::array<float,2>{0.27781263f, 0.143001661f},
-std::array<float,2>{0.853108108f, 0.862432361f},
-std::array<float,2>{0.89884603f, 0.0398404673f},
-std::array<float,2>{0.444381535f, 0.894014359f},
-std::array<float,2>{0.218440324f, 0.312569529f},
-std::array<float,2>{0.735018373f, 0.553259671f},
-std::array<float,2>{0.866501331f, 0.388236851f},
-std::array<float,2>{0.251871288f, 0.70778656f},
-std::array<float,2>{0.0378755964f, 0.156266466f},
-std::array<float,2>{0.603235245f, 0.815217555f},
-std::array<float,2>{0.723139167f, 0.0171802118f},
-std::array<float,2>{0.198544621f, 0.932022393f},
-std::array<float,2>{0.466214687f, 0.350660473f},
-std::array<float,2>{0.88447684f, 0.502747715f},
-std::array<float,2>{0.516191542f, 0.304192513f},
-std::array<float,2>{0.115171544f, 0.583632171f},
-std::array<float,2>{0.328243554f, 0.0910634324f},
-std::array<float,2>{0.766868234f, 0.9901793f},
-std::array<float,2>{0.988083243f, 0.203454614f},
-std::array<float,2>{0.411440879f, 0.806025982f},
-std::array<float,2>{0.125087932f, 0.489943266f},
-std::array<float,2>{0.653026521f, 0.635044515f},
-std::array<float,2>{0.934891939f, 0.333662361f},
-std::array<float,2>{0.480702937f, 0.541616857f},
-std::array<float,2>{0.232778087f, 0.0572051294f},
-std::array<float,2>{0.70093286f, 0.8802917f},
-std::array<float,2>{0.589285314f, 0.127080739f},
-std::array<float,2>{0.0131902499f, 0.854258716f},
-std::array<float,2>{0.308037728f, 0.436031133f},
-std::array<float,2>{0.829852879f, 0.727390409f},
-std::array<float,2>{0.677358568f, 0.450430632f},
-std::array<float,2>{0.162908733f, 0.661548018f},
-std::array<float,2>{0.388067961f, 0.222054303f},
-std::array<float,2>{0.946183681f, 0.761350453f},
-std::array<float,2>{0.795352817f, 0.097769551f},
-std::array<float,2>{0.374968857f, 0.953481853f},
-std::array<float,2>{0.090493232f, 0.262514651f},
-std::array<float,2>{0.547501385f, 0.616622746f},
-std::array<float,2>{0.915241003f, 0.485784411f},
-std::array<float,2>{0.48853904f, 0.637687087f},
-std::array<float,2>{0.237685204f, 0.20712994f},
-std::array<float,2>{0.715356767f, 0.810743272f},
-std::array<float,2>{0.575007975f, 0.0879235044f},
-std::array<float,2>{0.0264979172f, 0.98603183f},
-std::array<float,2>{0.295369834f, 0.300510705f},
-std::array<float,2>{0.813299596f, 0.581650198f},
-std::array<float,2>{0.669103265f, 0.34668228f},
-std::array<float,2>{0.184749976f, 0.504463434f},
-std::array<float,2>{0.393180579f, 0.0202146415f},
-std::array<float,2>{0.96635139f, 0.935384989f},
-std::array<float,2>{0.807791233f, 0.162202448f},
-std::array<float,2>{0.355139673f, 0.819988191f},
-std::array<float,2>{0.0728151426f, 0.384199113f},
-std::array<float,2>{0.531621397f, 0.706447423f},
-std::array<float,2>{0.845597148f, 0.260804117f},
-std::array<float,2>{0.270544589f, 0.612647474f},
-std::array<float,2>{0.057999488f, 0.0960982591f},
-std::array<float,2>{0.612009287f, 0.960069358f},
-std::array<float,2>{0.748133183f, 0.224991351f},
-std::array<float,2>{0.20478572f, 0.76290834f},
-std::array<float,2>{0.451644719f, 0.446464241f},
-std::array<float,2>{0.895731568f, 0.658466995f},
-std::array<float,2>{0.503884733f, 0.433078617f},
-std::array<float,2>{0.107948825f, 0.732313395f},
-std::array<float,2>{0.324268937f, 0.130110398f},
-std::array<float,2>{0.758452892f, 0.856081367f},
-std::array<float,2>{0.97733295f, 0.0586815327f},
-std::array<float,2>{0.429694891f, 0.87794143f},
-std::array<float,2>{0.142722666f, 0.328944176f},
-std::array<float,2>{0.628324509f, 0.546028614f},
-std::array<float,2>{0.77959168f, 0.400542378f},
-std::array<float,2>{0.33634001f, 0.697944641f},
-std::array<float,2>{0.118340634f, 0.173422202f},
-std::array<float,2>{0.529191911f, 0.832274556f},
-std::array<float,2>{0.640636742f, 0.00559875136f},
-std::array<float,2>{0.132924378f, 0.919843137f},
-std::array<float,2>{0.416733652f, 0.362940371f},
-std::array<float,2>{0.997692645f, 0.528400838f},
-std::array<float,2>{0.599711061f, 0.292881668f},
-std::array<float,2>{0.042234499f, 0.574566066f},
-std::array<float,2>{0.261503279f, 0.0732636228f},
-std::array<float,2>{0.869922757f, 0.980975807f},
-std::array<float,2>{0.879220605f, 0.19964467f},
-std::array<float,2>{0.457849711f, 0.785404503f},
-std::array<float,2>{0.194239289f, 0.48116222f},
-std::array<float,2>{0.733273387f, 0.642010629f},
-std::array<float,2>{0.938053191f, 0.317886114f},
-std::array<float,2>{0.380005985f, 0.548609912f},
-std::array<float,2>{0.169537351f, 0.0466223434f},
-std::array<float,2>{0.686162114f, 0.896919429f},
-std::array<float,2>{0.558757603f, 0.147817805f},
-std::array<float,2>{0.0846141577f, 0.866439104f},
-std::array<float,2>{0.366407692f, 0.415870279f},
-std::array<float,2>{0.782499075f, 0.747359335f},
-std::array<float,2>{0.694857955f, 0.455782861f},
-std::array<float,2>{0.222242564f, 0.673855782f},
-std::array<float,2>{0.471116751f, 0.243607312f},
-std::array<float,2>{0.929282546f, 0.770341277f},
-std::array<float,2>{0.837648451f, 0.113121875f},
-std::array<float,2>{0.300933599f, 0.948524833f},
-std::array<float,2>{0.00745315384f, 0.27064997f},
-std::array<float,2>{0.579113185f, 0.609348357f},
-std::array<float,2>{0.991737843f, 0.409497857f},
-std::array<float,2>{0.407920152f, 0.741184771f},
-std::array<float,2>{0.1292665f, 0.1515681f},
-std::array<float,2>{0.649772227f, 0.869294643f},
-std::array<float,2>{0.523285568f, 0.03814096f},
-std::array<float,2>{0.110946596f, 0.900876105f},
-std::array<float,2>{0.335642308f, 0.321288586f},
-std::array<float,2>{0.77271378f, 0.554925203f},
-std::array<float,2>{0.722448707f, 0.279645085f},
-std::array<float,2>{0.200995222f, 0.599212945f},
-std::array<float,2>{0.461252838f, 0.117624544f},
-std::array<float,2>{0.886979759f, 0.944648445f},
-std::array<float,2>{0.862097919f, 0.234668627f},
-std::array<float,2>{0.256610632f, 0.78073895f},
-std::array<float,2>{0.0343942456f, 0.464468867f},
-std::array<float,2>{0.607025921f, 0.681912124f},
-std::array<float,2>{0.792117834f, 0.374485254f},
-std::array<float,2>{0.368948758f, 0.52222544f},
-std::array<float,2>{0.0896201506f, 0.0123224081f},
-std::array<float,2>{0.552231729f, 0.909325778f},
-std::array<float,2>{0.672587872f, 0.183801457f},
-std::array<float,2>{0.159583941f, 0.836811066f},
-std::array<float,2>{0.385627657f, 0.394381553f},
-std::array<float,2>{0.951423645f, 0.690498412f},
-std::array<float,2>{0.592027485f, 0.471397579f},
-std::array<float,2>{0.01009282f, 0.650993824f},
-std::array<float,2>{0.309027612f, 0.193723753f},
-std::array<float,2>{0.833805025f, 0.789886892f},
-std::array<float,2>{0.933187485f, 0.0629613474f},
-std::array<float,2>{0.478896588f, 0.975050449f},
-std::array<float,2>{0.229887307f, 0.282892227f},
-std::array<float,2>{0.696881294f, 0.566465676f},
-std::array<float,2>{0.826160491f, 0.438553095f},
-std::array<float,2>{0.286737621f, 0.665052116f},
-std::array<float,2>{0.0180793144f, 0.233680308f},
-std::array<float,2>{0.564400673f, 0.753302813f},
-std::array<float,2>{0.710622847f, 0.101773337f},
-std::array<float,2>{0.2451846f, 0.962673068f},
-std::array<float,2>{0.499895543f, 0.255381495f},
-std::array<float,2>{0.909300923f, 0.623820186f},
-std::array<float,2>{0.542026877f, 0.341443121f},
-std::array<float,2>{0.0697124079f, 0.534272671f},
-std::array<float,2>{0.348518997f, 0.0505714528f},
-std::array<float,2>{0.803587317f, 0.887368798f},
-std::array<float,2>{0.958431959f, 0.136882663f},
-std::array<float,2>{0.404849768f, 0.848878622f},
-std::array<float,2>{0.178312823f, 0.423986852f},
-std::array<float,2>{0.662657678f, 0.725225925f},
-std::array<float,2>{0.904540122f, 0.30670771f},
-std::array<float,2>{0.441045254f, 0.588649511f},
-std::array<float,2>{0.213292837f, 0.0794694498f},
-std::array<float,2>{0.74033463f, 0.995609999f},
-std::array<float,2>{0.617486477f, 0.214898154f},
-std::array<float,2>{0.0540505238f, 0.800075293f},
-std::array<float,2>{0.275294006f, 0.496272862f},
-std::array<float,2>{0.857477963f, 0.625727534f},
-std::array<float,2>{0.637713015f, 0.377795577f},
-std::array<float,2>{0.152548909f, 0.716459632f},
-std::array<float,2>{0.424972892f, 0.166378915f},
-std::array<float,2>{0.975604892f, 0.827168882f},
-std::array<float,2>{0.756483078f, 0.0274890121f},
-std::array<float,2>{0.319750398f, 0.923334956f},
-std::array<float,2>{0.0947142467f, 0.353233337f},
-std::array<float,2>{0.508823276f, 0.515143037f},
-std::array<float,2>{0.883806705f, 0.390505493f},
-std::array<float,2>{0.466612399f, 0.709501922f},
-std::array<float,2>{0.198755726f, 0.159953937f},
-std::array<float,2>{0.723331094f, 0.813883185f},
-std::array<float,2>{0.602865696f, 0.0184352342f},
-std::array<float,2>{0.0373199508f, 0.92976594f},
-std::array<float,2>{0.251068383f, 0.34828341f},
-std::array<float,2>{0.867178977f, 0.50081259f},
-std::array<float,2>{0.652516067f, 0.301779151f},
-std::array<float,2>{0.125677228f, 0.585881829f},
-std::array<float,2>{0.411785245f, 0.0931616649f},
-std::array<float,2>{0.987775147f, 0.990275502f},
-std::array<float,2>{0.767163157f, 0.205292046f},
-std::array<float,2>{0.328625828f, 0.807169199f},
-std::array<float,2>{0.114330046f, 0.491482466f},
-std::array<float,2>{0.515799403f, 0.634680629f},
-std::array<float,2>{0.829581797f, 0.334641099f},
-std::array<float,2>{0.308585018f, 0.540457904f},
-std::array<float,2>{0.0130390944f, 0.0548383482f},
-std::array<float,2>{0.589818537f, 0.881950796f},
-std::array<float,2>{0.70033896f, 0.126031011f},
-std::array<float,2>{0.233058929f, 0.852814734f},
-std::array<float,2>{0.481293887f, 0.435447276f},
-std::array<float,2>{0.935342371f, 0.72863853f},
-std::array<float,2>{0.547075331f, 0.451958299f},
-std::array<float,2>{0.0899395347f, 0.662355244f},
-std::array<float,2>{0.374353826f, 0.219848022f},
-std::array<float,2>{0.795837045f, 0.758140862f},
-std::array<float,2>{0.945354879f, 0.101026282f},
-std::array<float,2>{0.388628662f, 0.955926776f},
-std::array<float,2>{0.162414208f, 0.264315724f},
-std::array<float,2>{0.676948309f, 0.613960743f},
-std::array<float,2>{0.798532307f, 0.480057448f},
-std::array<float,2>{0.346049488f, 0.64560324f},
-std::array<float,2>{0.0632171854f, 0.196932212f},
-std::array<float,2>{0.543248117f, 0.78436327f},
-std::array<float,2>{0.65889734f, 0.0753645971f},
-std::array<float,2>{0.175372988f, 0.980287135f},
-std::array<float,2>{0.401413709f, 0.294619709f},
-std::array<float,2>{0.95550102f, 0.572243989f},
-std::array<float,2>{0.569933951f, 0.365075558f},
-std::array<float,2>{0.0205472764f, 0.526824892f},
-std::array<float,2>{0.284858435f, 0.0032617508f},
-std::array<float,2>{0.824016631f, 0.916286409f},
-std::array<float,2>{0.911672175f, 0.17799367f},
-std::array<float,2>{0.493050903f, 0.829685628f},
-std::array<float,2>{0.247034892f, 0.403330803f},
-std::array<float,2>{0.704719245f, 0.699541688f},
-std::array<float,2>{0.970907509f, 0.266827345f},
-std::array<float,2>{0.426270783f, 0.603638351f},
-std::array<float,2>{0.150416166f, 0.114341445f},
-std::array<float,2>{0.635866225f, 0.94952786f},
-std::array<float,2>{0.511786282f, 0.249867305f},
-std::array<float,2>{0.100941345f, 0.767072856f},
-std::array<float,2>{0.315402806f, 0.459283829f},
-std::array<float,2>{0.750798643f, 0.676286578f},
-std::array<float,2>{0.734493136f, 0.420975596f},
-std::array<float,2>{0.217795894f, 0.744348824f},
-std::array<float,2>{0.444898069f, 0.140954763f},
-std::array<float,2>{0.899043083f, 0.86036551f},
-std::array<float,2>{0.85273093f, 0.04295405f},
-std::array<float,2>{0.278146923f, 0.891298473f},
-std::array<float,2>{0.0487308614f, 0.314885944f},
-std::array<float,2>{0.622715831f, 0.551243544f},
-std::array<float,2>{0.964256644f, 0.467224926f},
-std::array<float,2>{0.39673987f, 0.685101926f},
-std::array<float,2>{0.183490008f, 0.240228757f},
-std::array<float,2>{0.665113747f, 0.775445282f},
-std::array<float,2>{0.536845982f, 0.123993307f},
-std::array<float,2>{0.0759845302f, 0.93887949f},
-std::array<float,2>{0.357296705f, 0.275352538f},
-std::array<float,2>{0.809596002f, 0.595008254f},
-std::array<float,2>{0.712231934f, 0.324373275f},
-std::array<float,2>{0.240962937f, 0.560876012f},
-std::array<float,2>{0.485462159f, 0.0350765251f},
-std::array<float,2>{0.921201885f, 0.905492663f},
-std::array<float,2>{0.82024473f, 0.154644072f},
-std::array<float,2>{0.292325556f, 0.871812761f},
-std::array<float,2>{0.0273624565f, 0.414049745f},
-std::array<float,2>{0.572064519f, 0.734781981f},
-std::array<float,2>{0.764181376f, 0.285365105f},
-std::array<float,2>{0.323111296f, 0.565074503f},
-std::array<float,2>{0.103168041f, 0.0678166375f},
-std::array<float,2>{0.50675863f, 0.970158696f},
-std::array<float,2>{0.628953695f, 0.1879379f},
-std::array<float,2>{0.147146314f, 0.793721795f},
-std::array<float,2>{0.43745178f, 0.475272983f},
-std::array<float,2>{0.983653605f, 0.653219938f},
-std::array<float,2>{0.614962995f, 0.396959126f},
-std::array<float,2>{0.0589843877f, 0.692023814f},
-std::array<float,2>{0.268718392f, 0.182532996f},
-std::array<float,2>{0.848124325f, 0.840669632f},
-std::array<float,2>{0.893650651f, 0.0111106168f},
-std::array<float,2>{0.447461814f, 0.912915349f},
-std::array<float,2>{0.208002493f, 0.370773226f},
-std::array<float,2>{0.743464708f, 0.517636538f},
-std::array<float,2>{0.872384548f, 0.427867323f},
-std::array<float,2>{0.26347056f, 0.720766366f},
-std::array<float,2>{0.0447831079f, 0.133880243f},
-std::array<float,2>{0.593768299f, 0.846410513f},
-std::array<float,2>{0.728819668f, 0.0525875986f},
-std::array<float,2>{0.190084532f, 0.886317492f},
-std::array<float,2>{0.454180211f, 0.339435905f},
-std::array<float,2>{0.878148317f, 0.53814292f},
-std::array<float,2>{0.524264395f, 0.251027435f},
-std::array<float,2>{0.122472003f, 0.620580256f},
-std::array<float,2>{0.340356112f, 0.1056128f},
-std::array<float,2>{0.773941815f, 0.965891302f},
-std::array<float,2>{0.993509948f, 0.230016813f},
-std::array<float,2>{0.419287145f, 0.753924668f},
-std::array<float,2>{0.138685599f, 0.442732692f},
-std::array<float,2>{0.644829154f, 0.669123709f},
-std::array<float,2>{0.923528194f, 0.358520687f},
-std::array<float,2>{0.474783123f, 0.511168957f},
-std::array<float,2>{0.226025641f, 0.0257516615f},
-std::array<float,2>{0.689569235f, 0.927684307f},
-std::array<float,2>{0.584311843f, 0.168972477f},
-std::array<float,2>{0.00328313117f, 0.822995961f},
-std::array<float,2>{0.299382746f, 0.382260889f},
-std::array<float,2>{0.842576325f, 0.711007774f},
-std::array<float,2>{0.682592571f, 0.495776981f},
-std::array<float,2>{0.166176006f, 0.631600618f},
-std::array<float,2>{0.376085907f, 0.211762667f},
-std::array<float,2>{0.944470227f, 0.803870022f},
-std::array<float,2>{0.788561583f, 0.0856774822f},
-std::array<float,2>{0.362924308f, 0.997716784f},
-std::array<float,2>{0.0782917589f, 0.310598284f},
-std::array<float,2>{0.557055354f, 0.590829432f},
-std::array<float,2>{0.898281157f, 0.448448539f},
-std::array<float,2>{0.449934751f, 0.656409204f},
-std::array<float,2>{0.206831276f, 0.222996712f},
-std::array<float,2>{0.747938573f, 0.764513016f},
-std::array<float,2>{0.610428572f, 0.0941520631f},
-std::array<float,2>{0.0549725778f, 0.957181215f},
-std::array<float,2>{0.273148596f, 0.258625716f},
-std::array<float,2>{0.845803201f, 0.609768152f},
-std::array<float,2>{0.6262393f, 0.331949115f},
-std::array<float,2>{0.141899377f, 0.54341352f},
-std::array<float,2>{0.432805359f, 0.0609849133f},
-std::array<float,2>{0.979692817f, 0.876220763f},
-std::array<float,2>{0.761076927f, 0.13156873f},
-std::array<float,2>{0.327101082f, 0.859338224f},
-std::array<float,2>{0.107105486f, 0.429991752f},
-std::array<float,2>{0.50132066f, 0.734316826f},
-std::array<float,2>{0.815631866f, 0.298424661f},
-std::array<float,2>{0.293412954f, 0.57846272f},
-std::array<float,2>{0.0248402208f, 0.0860092565f},
-std::array<float,2>{0.576851964f, 0.98661989f},
-std::array<float,2>{0.718334615f, 0.209192172f},
-std::array<float,2>{0.236141533f, 0.810306013f},
-std::array<float,2>{0.490376592f, 0.486825496f},
-std::array<float,2>{0.91767025f, 0.63882035f},
-std::array<float,2>{0.535075009f, 0.385443479f},
-std::array<float,2>{0.0705119297f, 0.703517139f},
-std::array<float,2>{0.352655858f, 0.160757631f},
-std::array<float,2>{0.804719985f, 0.818062782f},
-std::array<float,2>{0.968624949f, 0.0234098546f},
-std::array<float,2>{0.392495573f, 0.935779929f},
-std::array<float,2>{0.186985806f, 0.345625579f},
-std::array<float,2>{0.669926167f, 0.507686019f},
-std::array<float,2>{0.785076678f, 0.416475415f},
-std::array<float,2>{0.364885658f, 0.749516547f},
-std::array<float,2>{0.0834161788f, 0.145870507f},
-std::array<float,2>{0.560623646f, 0.86430949f},
-std::array<float,2>{0.683870852f, 0.043331936f},
-std::array<float,2>{0.171179995f, 0.896414399f},
-std::array<float,2>{0.381178737f, 0.319313645f},
-std::array<float,2>{0.94055146f, 0.550643861f},
-std::array<float,2>{0.580676079f, 0.272473872f},
-std::array<float,2>{0.00438667322f, 0.606139421f},
-std::array<float,2>{0.304605514f, 0.109830253f},
-std::array<float,2>{0.838623405f, 0.947118402f},
-std::array<float,2>{0.926538706f, 0.245554015f},
-std::array<float,2>{0.46908769f, 0.772688985f},
-std::array<float,2>{0.220467776f, 0.453920484f},
-std::array<float,2>{0.691860318f, 0.673009634f},
-std::array<float,2>{0.999777019f, 0.361004084f},
-std::array<float,2>{0.414939046f, 0.530810416f},
-std::array<float,2>{0.13614063f, 0.00667874189f},
-std::array<float,2>{0.644464493f, 0.921773493f},
-std::array<float,2>{0.530465901f, 0.17435874f},
-std::array<float,2>{0.119149983f, 0.834145606f},
-std::array<float,2>{0.337987214f, 0.400335252f},
-std::array<float,2>{0.77875632f, 0.695327342f},
-std::array<float,2>{0.730909467f, 0.483767748f},
-std::array<float,2>{0.191844791f, 0.644496083f},
-std::array<float,2>{0.460511208f, 0.201963112f},
-std::array<float,2>{0.881217122f, 0.787954152f},
-std::array<float,2>{0.868252873f, 0.070845142f},
-std::array<float,2>{0.258384138f, 0.983176589f},
-std::array<float,2>{0.0395652466f, 0.29032582f},
-std::array<float,2>{0.597875655f, 0.577936113f},
-std::array<float,2>{0.949709475f, 0.390850782f},
-std::array<float,2>{0.384357035f, 0.688812613f},
-std::array<float,2>{0.157192513f, 0.18614848f},
-std::array<float,2>{0.674932539f, 0.838188887f},
-std::array<float,2>{0.553644121f, 0.0140294516f},
-std::array<float,2>{0.0873109475f, 0.906489491f},
-std::array<float,2>{0.369494021f, 0.372581273f},
-std::array<float,2>{0.790231943f, 0.52031368f},
-std::array<float,2>{0.698655009f, 0.2843768f},
-std::array<float,2>{0.228157848f, 0.569538534f},
-std::array<float,2>{0.478482485f, 0.0663770884f},
-std::array<float,2>{0.93129921f, 0.973188698f},
-std::array<float,2>{0.835417509f, 0.192211509f},
-std::array<float,2>{0.311163872f, 0.79113245f},
-std::array<float,2>{0.00808485318f, 0.470656484f},
-std::array<float,2>{0.590239763f, 0.650003374f},
-std::array<float,2>{0.770018578f, 0.322520852f},
-std::array<float,2>{0.332627475f, 0.55751431f},
-std::array<float,2>{0.113040976f, 0.0367192253f},
-std::array<float,2>{0.520286202f, 0.899671435f},
-std::array<float,2>{0.65180707f, 0.148456529f},
-std::array<float,2>{0.131407008f, 0.868611634f},
-std::array<float,2>{0.410023391f, 0.4076536f},
-std::array<float,2>{0.989981771f, 0.738675058f},
-std::array<float,2>{0.6090312f, 0.461363822f},
-std::array<float,2>{0.0313440077f, 0.681269109f},
-std::array<float,2>{0.254710734f, 0.238222525f},
-std::array<float,2>{0.859475672f, 0.77780807f},
-std::array<float,2>{0.890456915f, 0.120022565f},
-std::array<float,2>{0.463310301f, 0.942207694f},
-std::array<float,2>{0.201173037f, 0.278946221f},
-std::array<float,2>{0.7193712f, 0.600256801f},
-std::array<float,2>{0.855771184f, 0.499096543f},
-std::array<float,2>{0.275891811f, 0.627115071f},
-std::array<float,2>{0.0508803874f, 0.21771045f},
-std::array<float,2>{0.619723499f, 0.798187971f},
-std::array<float,2>{0.739778042f, 0.0812183693f},
-std::array<float,2>{0.212778419f, 0.992518723f},
-std::array<float,2>{0.438257486f, 0.305594355f},
-std::array<float,2>{0.902498245f, 0.586924076f},
-std::array<float,2>{0.510090828f, 0.353862971f},
-std::array<float,2>{0.096645318f, 0.5118168f},
-std::array<float,2>{0.31828174f, 0.0301334318f},
-std::array<float,2>{0.75497824f, 0.924472332f},
-std::array<float,2>{0.974217415f, 0.165925711f},
-std::array<float,2>{0.423328459f, 0.824785113f},
-std::array<float,2>{0.1557246f, 0.375147939f},
-std::array<float,2>{0.640050054f, 0.717770219f},
-std::array<float,2>{0.90746218f, 0.256381959f},
-std::array<float,2>{0.498022318f, 0.622170866f},
-std::array<float,2>{0.244043127f, 0.104937658f},
-std::array<float,2>{0.707427263f, 0.964376867f},
-std::array<float,2>{0.565837562f, 0.231524676f},
-std::array<float,2>{0.0170562398f, 0.750761569f},
-std::array<float,2>{0.288524687f, 0.439842701f},
-std::array<float,2>{0.826766789f, 0.666326582f},
-std::array<float,2>{0.66045022f, 0.422369987f},
-std::array<float,2>{0.175887048f, 0.723362386f},
-std::array<float,2>{0.403084278f, 0.140593484f},
-std::array<float,2>{0.960691988f, 0.850916684f},
-std::array<float,2>{0.801387191f, 0.0471589454f},
-std::array<float,2>{0.350230575f, 0.890307367f},
-std::array<float,2>{0.0682356805f, 0.343078882f},
-std::array<float,2>{0.54072237f, 0.532801807f},
-std::array<float,2>{0.935934603f, 0.436371058f},
-std::array<float,2>{0.484172106f, 0.72663939f},
-std::array<float,2>{0.231104076f, 0.127918616f},
-std::array<float,2>{0.702494264f, 0.853913963f},
-std::array<float,2>{0.587170482f, 0.0570076928f},
-std::array<float,2>{0.0145069407f, 0.880603075f},
-std::array<float,2>{0.305692077f, 0.333306074f},
-std::array<float,2>{0.830790043f, 0.541348398f},
-std::array<float,2>{0.678136885f, 0.261925131f},
-std::array<float,2>{0.160544187f, 0.616795778f},
-std::array<float,2>{0.389104307f, 0.0983830616f},
-std::array<float,2>{0.947458148f, 0.953964174f},
-std::array<float,2>{0.794071555f, 0.222247824f},
-std::array<float,2>{0.371969968f, 0.761026204f},
-std::array<float,2>{0.0928108618f, 0.451113194f},
-std::array<float,2>{0.549578369f, 0.662053108f},
-std::array<float,2>{0.86449939f, 0.35148561f},
-std::array<float,2>{0.252943993f, 0.502234995f},
-std::array<float,2>{0.0367268473f, 0.0168964118f},
-std::array<float,2>{0.604438901f, 0.932204127f},
-std::array<float,2>{0.725715399f, 0.156930387f},
-std::array<float,2>{0.196065098f, 0.814813435f},
-std::array<float,2>{0.468364298f, 0.387870252f},
-std::array<float,2>{0.886088908f, 0.707485139f},
-std::array<float,2>{0.517887771f, 0.489391327f},
-std::array<float,2>{0.116444185f, 0.635335445f},
-std::array<float,2>{0.330714732f, 0.20388183f},
-std::array<float,2>{0.768115222f, 0.806568384f},
-std::array<float,2>{0.985916972f, 0.0917909965f},
-std::array<float,2>{0.413913637f, 0.989508629f},
-std::array<float,2>{0.127573073f, 0.304652691f},
-std::array<float,2>{0.654984474f, 0.583451688f},
-std::array<float,2>{0.752780437f, 0.457469642f},
-std::array<float,2>{0.312995076f, 0.678074241f},
-std::array<float,2>{0.0984702408f, 0.24661316f},
-std::array<float,2>{0.515460908f, 0.768547952f},
-std::array<float,2>{0.63330996f, 0.116909318f},
-std::array<float,2>{0.150345922f, 0.952562988f},
-std::array<float,2>{0.428597748f, 0.268432111f},
-std::array<float,2>{0.969364583f, 0.603151977f},
-std::array<float,2>{0.623945057f, 0.313322753f},
-std::array<float,2>{0.0494042411f, 0.552941382f},
-std::array<float,2>{0.281113714f, 0.0394612402f},
-std::array<float,2>{0.854722738f, 0.89424175f},
-std::array<float,2>{0.900703669f, 0.143316075f},
-std::array<float,2>{0.441914946f, 0.862939537f},
-std::array<float,2>{0.215928376f, 0.418703198f},
-std::array<float,2>{0.737212956f, 0.74351126f},
-std::array<float,2>{0.954523921f, 0.295906365f},
-std::array<float,2>{0.399834305f, 0.572341144f},
-std::array<float,2>{0.172713593f, 0.0766891316f},
-std::array<float,2>{0.65682292f, 0.976829231f},
-std::array<float,2>{0.545017123f, 0.19897832f},
-std::array<float,2>{0.0650138706f, 0.782000482f},
-std::array<float,2>{0.344281703f, 0.476907462f},
-std::array<float,2>{0.798974097f, 0.647384882f},
-std::array<float,2>{0.706759393f, 0.405928642f},
-std::array<float,2>{0.248193324f, 0.702171743f},
-std::array<float,2>{0.494454116f, 0.177297324f},
-std::array<float,2>{0.913305223f, 0.831300139f},
-std::array<float,2>{0.821232677f, 0.00167192728f},
-std::array<float,2>{0.282106698f, 0.915301681f},
-std::array<float,2>{0.0216229912f, 0.365436852f},
-std::array<float,2>{0.567648649f, 0.524822474f},
-std::array<float,2>{0.980476499f, 0.472794086f},
-std::array<float,2>{0.435416132f, 0.654327214f},
-std::array<float,2>{0.146331325f, 0.190287292f},
-std::array<float,2>{0.631134033f, 0.796553731f},
-std::array<float,2>{0.504998684f, 0.0685978457f},
-std::array<float,2>{0.104903989f, 0.97169745f},
-std::array<float,2>{0.320906073f, 0.288170218f},
-std::array<float,2>{0.761913538f, 0.563519061f},
-std::array<float,2>{0.744252503f, 0.367530316f},
-std::array<float,2>{0.210215256f, 0.517379761f},
-std::array<float,2>{0.447211385f, 0.00946125202f},
-std::array<float,2>{0.891818464f, 0.910303175f},
-std::array<float,2>{0.851112664f, 0.180798709f},
-std::array<float,2>{0.267286152f, 0.842938006f},
-std::array<float,2>{0.06180932f, 0.396377355f},
-std::array<float,2>{0.615803897f, 0.693673015f},
-std::array<float,2>{0.811575711f, 0.277218431f},
-std::array<float,2>{0.359223902f, 0.596708357f},
-std::array<float,2>{0.0766529813f, 0.121192321f},
-std::array<float,2>{0.53815335f, 0.939536095f},
-std::array<float,2>{0.66636622f, 0.241977766f},
-std::array<float,2>{0.180857658f, 0.775378466f},
-std::array<float,2>{0.394826353f, 0.466726691f},
-std::array<float,2>{0.961433232f, 0.686931252f},
-std::array<float,2>{0.573225141f, 0.411964744f},
-std::array<float,2>{0.0294047389f, 0.737675905f},
-std::array<float,2>{0.290642202f, 0.153435335f},
-std::array<float,2>{0.818199337f, 0.874928415f},
-std::array<float,2>{0.918854713f, 0.0323212296f},
-std::array<float,2>{0.486393094f, 0.902408659f},
-std::array<float,2>{0.239527106f, 0.326617867f},
-std::array<float,2>{0.714768827f, 0.55897975f},
-std::array<float,2>{0.840018272f, 0.379847527f},
-std::array<float,2>{0.297697037f, 0.714595258f},
-std::array<float,2>{0.00148674822f, 0.171585977f},
-std::array<float,2>{0.582387686f, 0.821656466f},
-std::array<float,2>{0.688965917f, 0.0246869307f},
-std::array<float,2>{0.22313039f, 0.92899698f},
-std::array<float,2>{0.473837018f, 0.356675595f},
-std::array<float,2>{0.925516427f, 0.508458376f},
-std::array<float,2>{0.556199193f, 0.309769601f},
-std::array<float,2>{0.0810039937f, 0.593441606f},
-std::array<float,2>{0.360109389f, 0.083598122f},
-std::array<float,2>{0.787073195f, 0.999859333f},
-std::array<float,2>{0.9425596f, 0.213536099f},
-std::array<float,2>{0.377010673f, 0.80226326f},
-std::array<float,2>{0.165836647f, 0.492905408f},
-std::array<float,2>{0.680891097f, 0.630328298f},
-std::array<float,2>{0.876045465f, 0.337807417f},
-std::array<float,2>{0.456105322f, 0.537080407f},
-std::array<float,2>{0.187720492f, 0.0535363145f},
-std::array<float,2>{0.727623403f, 0.883881986f},
-std::array<float,2>{0.596247673f, 0.135332733f},
-std::array<float,2>{0.0468173921f, 0.844321012f},
-std::array<float,2>{0.265603274f, 0.427311659f},
-std::array<float,2>{0.874423504f, 0.720617831f},
-std::array<float,2>{0.646871746f, 0.444829851f},
-std::array<float,2>{0.138619587f, 0.671541393f},
-std::array<float,2>{0.420810491f, 0.227277994f},
-std::array<float,2>{0.995562434f, 0.756183386f},
-std::array<float,2>{0.777041733f, 0.108931258f},
-std::array<float,2>{0.342689991f, 0.968050241f},
-std::array<float,2>{0.123386234f, 0.253401756f},
-std::array<float,2>{0.525721669f, 0.618114114f},
-std::array<float,2>{0.881868839f, 0.481689215f},
-std::array<float,2>{0.459588796f, 0.641414881f},
-std::array<float,2>{0.192845419f, 0.200964645f},
-std::array<float,2>{0.732328176f, 0.786679149f},
-std::array<float,2>{0.59886384f, 0.0725606903f},
-std::array<float,2>{0.0405200385f, 0.982347071f},
-std::array<float,2>{0.259104401f, 0.291807234f},
-std::array<float,2>{0.867701948f, 0.575466871f},
-std::array<float,2>{0.642900527f, 0.361990154f},
-std::array<float,2>{0.135226443f, 0.527911425f},
-std::array<float,2>{0.415766716f, 0.00400833879f},
-std::array<float,2>{0.998786151f, 0.918931544f},
-std::array<float,2>{0.7783041f, 0.172678187f},
-std::array<float,2>{0.339782268f, 0.833781898f},
-std::array<float,2>{0.120997347f, 0.402130216f},
-std::array<float,2>{0.529519796f, 0.69900769f},
-std::array<float,2>{0.83906424f, 0.269833833f},
-std::array<float,2>{0.30327937f, 0.608317375f},
-std::array<float,2>{0.00501120789f, 0.111648902f},
-std::array<float,2>{0.581302464f, 0.947807491f},
-std::array<float,2>{0.693330586f, 0.242663786f},
-std::array<float,2>{0.219046712f, 0.770900428f},
-std::array<float,2>{0.470293671f, 0.45672214f},
-std::array<float,2>{0.927607894f, 0.675620794f},
-std::array<float,2>{0.562437892f, 0.414477527f},
-std::array<float,2>{0.0825006142f, 0.746200502f},
-std::array<float,2>{0.363567412f, 0.147164851f},
-std::array<float,2>{0.783964932f, 0.865368783f},
-std::array<float,2>{0.939725518f, 0.0457514077f},
-std::array<float,2>{0.382100999f, 0.898074508f},
-std::array<float,2>{0.170743793f, 0.316740751f},
-std::array<float,2>{0.685116827f, 0.5470981f},
-std::array<float,2>{0.806529045f, 0.383364409f},
-std::array<float,2>{0.352475405f, 0.706050694f},
-std::array<float,2>{0.0720459521f, 0.163578629f},
-std::array<float,2>{0.534023106f, 0.818941772f},
-std::array<float,2>{0.670917034f, 0.0205183253f},
-std::array<float,2>{0.185639918f, 0.934522867f},
-std::array<float,2>{0.391346544f, 0.3464939f},
-std::array<float,2>{0.966847658f, 0.504933f},
-std::array<float,2>{0.577323616f, 0.29899776f},
-std::array<float,2>{0.0236120205f, 0.580668092f},
-std::array<float,2>{0.294576526f, 0.0889807567f},
-std::array<float,2>{0.815185189f, 0.985139072f},
-std::array<float,2>{0.916941166f, 0.20882085f},
-std::array<float,2>{0.491785288f, 0.812470496f},
-std::array<float,2>{0.235239178f, 0.48506391f},
-std::array<float,2>{0.717271864f, 0.637917042f},
-std::array<float,2>{0.978853643f, 0.329170197f},
-std::array<float,2>{0.432602316f, 0.545474648f},
-std::array<float,2>{0.141580567f, 0.059942957f},
-std::array<float,2>{0.625244319f, 0.877515614f},
-std::array<float,2>{0.500173748f, 0.128909126f},
-std::array<float,2>{0.105553038f, 0.856892288f},
-std::array<float,2>{0.32727918f, 0.432511985f},
-std::array<float,2>{0.760367572f, 0.731261134f},
-std::array<float,2>{0.746629715f, 0.445331812f},
-std::array<float,2>{0.206023648f, 0.659731328f},
-std::array<float,2>{0.450709164f, 0.225611806f},
-std::array<float,2>{0.896652579f, 0.762651026f},
-std::array<float,2>{0.847643495f, 0.0975499898f},
-std::array<float,2>{0.271912187f, 0.959313273f},
-std::array<float,2>{0.0556660146f, 0.260573745f},
-std::array<float,2>{0.609536886f, 0.611642003f},
-std::array<float,2>{0.959135115f, 0.425213516f},
-std::array<float,2>{0.404180318f, 0.726243854f},
-std::array<float,2>{0.177682087f, 0.138607308f},
-std::array<float,2>{0.661388874f, 0.848210871f},
-std::array<float,2>{0.539308012f, 0.0489585251f},
-std::array<float,2>{0.0671141446f, 0.888244331f},
-std::array<float,2>{0.35080266f, 0.340336412f},
-std::array<float,2>{0.802201986f, 0.533229709f},
-std::array<float,2>{0.708205581f, 0.254683584f},
-std::array<float,2>{0.242677033f, 0.624317586f},
-std::array<float,2>{0.496927887f, 0.102670178f},
-std::array<float,2>{0.907093048f, 0.961888492f},
-std::array<float,2>{0.8279441f, 0.232812047f},
-std::array<float,2>{0.287951827f, 0.752054036f},
-std::array<float,2>{0.016437985f, 0.438050389f},
-std::array<float,2>{0.564904988f, 0.664160788f},
-std::array<float,2>{0.754067004f, 0.351997584f},
-std::array<float,2>{0.316605896f, 0.514155924f},
-std::array<float,2>{0.0972487777f, 0.0291733779f},
-std::array<float,2>{0.511082351f, 0.922737718f},
-std::array<float,2>{0.639598548f, 0.167150497f},
-std::array<float,2>{0.154957235f, 0.826768696f},
-std::array<float,2>{0.422815055f, 0.378139943f},
-std::array<float,2>{0.972695947f, 0.715224326f},
-std::array<float,2>{0.62030381f, 0.497522235f},
-std::array<float,2>{0.0521390662f, 0.625991404f},
-std::array<float,2>{0.276489764f, 0.21649833f},
-std::array<float,2>{0.856805503f, 0.799259841f},
-std::array<float,2>{0.904203117f, 0.0781684965f},
-std::array<float,2>{0.439271271f, 0.994783163f},
-std::array<float,2>{0.21121259f, 0.30774188f},
-std::array<float,2>{0.738391042f, 0.589338064f},
-std::array<float,2>{0.860395074f, 0.462978929f},
-std::array<float,2>{0.254885495f, 0.68338275f},
-std::array<float,2>{0.0331529602f, 0.23583959f},
-std::array<float,2>{0.607843757f, 0.779699564f},
-std::array<float,2>{0.720017433f, 0.119068265f},
-std::array<float,2>{0.202813134f, 0.943386018f},
-std::array<float,2>{0.464624733f, 0.281148463f},
-std::array<float,2>{0.889601409f, 0.597971082f},
-std::array<float,2>{0.520628452f, 0.322065204f},
-std::array<float,2>{0.111976512f, 0.556161225f},
-std::array<float,2>{0.333175689f, 0.038069278f},
-std::array<float,2>{0.770991921f, 0.902029932f},
-std::array<float,2>{0.988342106f, 0.151089385f},
-std::array<float,2>{0.408921063f, 0.870249867f},
-std::array<float,2>{0.132346228f, 0.40912804f},
-std::array<float,2>{0.651298404f, 0.741419315f},
-std::array<float,2>{0.930345535f, 0.282165676f},
-std::array<float,2>{0.477238357f, 0.567810118f},
-std::array<float,2>{0.226618379f, 0.0635687858f},
-std::array<float,2>{0.697580338f, 0.975744903f},
-std::array<float,2>{0.591189623f, 0.194485754f},
-std::array<float,2>{0.00888869725f, 0.790742576f},
-std::array<float,2>{0.312352717f, 0.472052604f},
-std::array<float,2>{0.83446455f, 0.651484907f},
-std::array<float,2>{0.674670815f, 0.393229872f},
-std::array<float,2>{0.157892033f, 0.689791679f},
-std::array<float,2>{0.382933915f, 0.184686944f},
-std::array<float,2>{0.95110184f, 0.837794304f},
-std::array<float,2>{0.789691806f, 0.0132453479f},
-std::array<float,2>{0.370966226f, 0.908268929f},
-std::array<float,2>{0.0866396353f, 0.373597324f},
-std::array<float,2>{0.553719163f, 0.522918463f},
-std::array<float,2>{0.912390649f, 0.402644485f},
-std::array<float,2>{0.495124519f, 0.701144993f},
-std::array<float,2>{0.249548391f, 0.178723395f},
-std::array<float,2>{0.705316842f, 0.829002082f},
-std::array<float,2>{0.567029774f, 0.00206815382f},
-std::array<float,2>{0.0229992997f, 0.917815745f},
-std::array<float,2>{0.283127815f, 0.363494635f},
-std::array<float,2>{0.821905017f, 0.525561631f},
-std::array<float,2>{0.657525063f, 0.293673724f},
-std::array<float,2>{0.173501477f, 0.571051955f},
-std::array<float,2>{0.398664683f, 0.0749287456f},
-std::array<float,2>{0.953668237f, 0.978800535f},
-std::array<float,2>{0.800543368f, 0.195616439f},
-std::array<float,2>{0.345565856f, 0.783590376f},
-std::array<float,2>{0.0655247867f, 0.478627205f},
-std::array<float,2>{0.546166122f, 0.645423055f},
-std::array<float,2>{0.853629768f, 0.31591624f},
-std::array<float,2>{0.279405236f, 0.551820278f},
-std::array<float,2>{0.050457757f, 0.0418264903f},
-std::array<float,2>{0.624295056f, 0.891688466f},
-std::array<float,2>{0.738211155f, 0.142186493f},
-std::array<float,2>{0.214993671f, 0.859911025f},
-std::array<float,2>{0.443339705f, 0.420889854f},
-std::array<float,2>{0.902305543f, 0.745470226f},
-std::array<float,2>{0.514452279f, 0.460800648f},
-std::array<float,2>{0.0987976268f, 0.676842511f},
-std::array<float,2>{0.313614041f, 0.248396054f},
-std::array<float,2>{0.753245652f, 0.765933752f},
-std::array<float,2>{0.970588446f, 0.113844551f},
-std::array<float,2>{0.429304212f, 0.950315118f},
-std::array<float,2>{0.149281263f, 0.265954852f},
-std::array<float,2>{0.63446188f, 0.605276883f},
-std::array<float,2>{0.768736184f, 0.490294993f},
-std::array<float,2>{0.331382334f, 0.633650541f},
-std::array<float,2>{0.115964785f, 0.206902176f},
-std::array<float,2>{0.518596947f, 0.808226943f},
-std::array<float,2>{0.655507982f, 0.092369549f},
-std::array<float,2>{0.128767237f, 0.991571546f},
-std::array<float,2>{0.412118554f, 0.300861627f},
-std::array<float,2>{0.985109329f, 0.584171653f},
-std::array<float,2>{0.60511142f, 0.348820716f},
-std::array<float,2>{0.0359201171f, 0.501777112f},
-std::array<float,2>{0.252520978f, 0.018966781f},
-std::array<float,2>{0.863796949f, 0.930969536f},
-std::array<float,2>{0.884868264f, 0.158735156f},
-std::array<float,2>{0.466861218f, 0.813273072f},
-std::array<float,2>{0.196744621f, 0.389330029f},
-std::array<float,2>{0.724721253f, 0.710422456f},
-std::array<float,2>{0.948772073f, 0.264886707f},
-std::array<float,2>{0.389753431f, 0.614503503f},
-std::array<float,2>{0.161386117f, 0.0996688753f},
-std::array<float,2>{0.67897296f, 0.956766963f},
-std::array<float,2>{0.550613582f, 0.219595149f},
-std::array<float,2>{0.0920337737f, 0.759437621f},
-std::array<float,2>{0.37267819f, 0.452400625f},
-std::array<float,2>{0.793446779f, 0.663733602f},
-std::array<float,2>{0.701572895f, 0.434015334f},
-std::array<float,2>{0.231889367f, 0.72993964f},
-std::array<float,2>{0.482974708f, 0.125069797f},
-std::array<float,2>{0.936836183f, 0.851747096f},
-std::array<float,2>{0.831620753f, 0.0558700077f},
-std::array<float,2>{0.304732829f, 0.881161153f},
-std::array<float,2>{0.0151590323f, 0.335663259f},
-std::array<float,2>{0.586107731f, 0.53925395f},
-std::array<float,2>{0.994536459f, 0.441792786f},
-std::array<float,2>{0.421080858f, 0.668548942f},
-std::array<float,2>{0.137120828f, 0.228560716f},
-std::array<float,2>{0.6483953f, 0.755343437f},
-std::array<float,2>{0.526672006f, 0.107259601f},
-std::array<float,2>{0.124038793f, 0.965436459f},
-std::array<float,2>{0.343019426f, 0.250197709f},
-std::array<float,2>{0.775901198f, 0.619391501f},
-std::array<float,2>{0.727282107f, 0.338397115f},
-std::array<float,2>{0.188550577f, 0.53741014f},
-std::array<float,2>{0.455617905f, 0.0507949218f},
-std::array<float,2>{0.875741839f, 0.885361433f},
-std::array<float,2>{0.87372303f, 0.132815942f},
-std::array<float,2>{0.264212012f, 0.846842408f},
-std::array<float,2>{0.0453405343f, 0.429657221f},
-std::array<float,2>{0.596914887f, 0.722007692f},
-std::array<float,2>{0.786032557f, 0.311944306f},
-std::array<float,2>{0.36109522f, 0.590402067f},
-std::array<float,2>{0.0815099776f, 0.0846142843f},
-std::array<float,2>{0.554720104f, 0.996691942f},
-std::array<float,2>{0.680116475f, 0.212313056f},
-std::array<float,2>{0.164668828f, 0.803563058f},
-std::array<float,2>{0.378511101f, 0.494944096f},
-std::array<float,2>{0.94221735f, 0.632406116f},
-std::array<float,2>{0.58330822f, 0.381579459f},
-std::array<float,2>{0.00078160665f, 0.712210298f},
-std::array<float,2>{0.297854364f, 0.168507129f},
-std::array<float,2>{0.8411237f, 0.823255479f},
-std::array<float,2>{0.924152732f, 0.0269995704f},
-std::array<float,2>{0.473006189f, 0.926414728f},
-std::array<float,2>{0.224343151f, 0.357683629f},
-std::array<float,2>{0.688318253f, 0.510163009f},
-std::array<float,2>{0.817331672f, 0.412562907f},
-std::array<float,2>{0.289857f, 0.735937715f},
-std::array<float,2>{0.0310684238f, 0.155363396f},
-std::array<float,2>{0.573862731f, 0.872295141f},
-std::array<float,2>{0.71308428f, 0.0338550918f},
-std::array<float,2>{0.239052773f, 0.904817879f},
-std::array<float,2>{0.487360716f, 0.325287372f},
-std::array<float,2>{0.919585049f, 0.562023997f},
-std::array<float,2>{0.537129998f, 0.273463219f},
-std::array<float,2>{0.0777757093f, 0.594454706f},
-std::array<float,2>{0.358354747f, 0.124961689f},
-std::array<float,2>{0.810816765f, 0.938200116f},
-std::array<float,2>{0.962582469f, 0.238629922f},
-std::array<float,2>{0.396286786f, 0.777135253f},
-std::array<float,2>{0.18039912f, 0.468502551f},
-std::array<float,2>{0.667591751f, 0.68389684f},
-std::array<float,2>{0.891208351f, 0.369456738f},
-std::array<float,2>{0.445496559f, 0.519282937f},
-std::array<float,2>{0.209022596f, 0.0102772862f},
-std::array<float,2>{0.745438576f, 0.913919985f},
-std::array<float,2>{0.617101967f, 0.183186665f},
-std::array<float,2>{0.0606013387f, 0.84143573f},
-std::array<float,2>{0.265654117f, 0.397518903f},
-std::array<float,2>{0.850366473f, 0.692882717f},
-std::array<float,2>{0.63211745f, 0.476466149f},
-std::array<float,2>{0.145130336f, 0.653832912f},
-std::array<float,2>{0.433732361f, 0.189257652f},
-std::array<float,2>{0.981537938f, 0.794764042f},
-std::array<float,2>{0.762976468f, 0.0672783181f},
-std::array<float,2>{0.321763039f, 0.969171166f},
-std::array<float,2>{0.104170382f, 0.286283255f},
-std::array<float,2>{0.504149258f, 0.566088855f},
-std::array<float,2>{0.928517282f, 0.45446822f},
-std::array<float,2>{0.472173482f, 0.671928287f},
-std::array<float,2>{0.22135523f, 0.244451612f},
-std::array<float,2>{0.693590105f, 0.77245295f},
-std::array<float,2>{0.579097033f, 0.110357314f},
-std::array<float,2>{0.00675189635f, 0.945506871f},
-std::array<float,2>{0.302276701f, 0.27175191f},
-std::array<float,2>{0.836719275f, 0.606603205f},
-std::array<float,2>{0.686621845f, 0.319868118f},
-std::array<float,2>{0.168838352f, 0.549531281f},
-std::array<float,2>{0.379135668f, 0.0444018021f},
-std::array<float,2>{0.938926995f, 0.894608259f},
-std::array<float,2>{0.781617701f, 0.144538715f},
-std::array<float,2>{0.365676194f, 0.863389373f},
-std::array<float,2>{0.0857543796f, 0.417666763f},
-std::array<float,2>{0.559639812f, 0.748435736f},
-std::array<float,2>{0.870370388f, 0.289233208f},
-std::array<float,2>{0.259826392f, 0.576358855f},
-std::array<float,2>{0.0413678698f, 0.0720770955f},
-std::array<float,2>{0.601513028f, 0.983813047f},
-std::array<float,2>{0.733450294f, 0.202621117f},
-std::array<float,2>{0.195210129f, 0.788821459f},
-std::array<float,2>{0.458387882f, 0.483139962f},
-std::array<float,2>{0.879900694f, 0.64321661f},
-std::array<float,2>{0.527885079f, 0.398562163f},
-std::array<float,2>{0.117869638f, 0.696626425f},
-std::array<float,2>{0.337392807f, 0.174823746f},
-std::array<float,2>{0.780707598f, 0.835927248f},
-std::array<float,2>{0.996851683f, 0.00753291324f},
-std::array<float,2>{0.417922318f, 0.919956267f},
-std::array<float,2>{0.134180531f, 0.359736264f},
-std::array<float,2>{0.642310143f, 0.529664457f},
-std::array<float,2>{0.759275615f, 0.431239992f},
-std::array<float,2>{0.325624794f, 0.73307997f},
-std::array<float,2>{0.109166354f, 0.1323504f},
-std::array<float,2>{0.502892733f, 0.857737958f},
-std::array<float,2>{0.627115965f, 0.0623329431f},
-std::array<float,2>{0.143738866f, 0.875249982f},
-std::array<float,2>{0.43134442f, 0.330374032f},
-std::array<float,2>{0.978493273f, 0.544049919f},
-std::array<float,2>{0.612327218f, 0.259497553f},
-std::array<float,2>{0.0569470152f, 0.610789835f},
-std::array<float,2>{0.270468742f, 0.0952575132f},
-std::array<float,2>{0.844356537f, 0.958128333f},
-std::array<float,2>{0.895405054f, 0.22423619f},
-std::array<float,2>{0.452825129f, 0.765433013f},
-std::array<float,2>{0.203887895f, 0.448160797f},
-std::array<float,2>{0.749993324f, 0.657497048f},
-std::array<float,2>{0.965540588f, 0.344246596f},
-std::array<float,2>{0.394313425f, 0.506808519f},
-std::array<float,2>{0.183769062f, 0.022234058f},
-std::array<float,2>{0.668537259f, 0.936899185f},
-std::array<float,2>{0.532304347f, 0.161251664f},
-std::array<float,2>{0.0736394301f, 0.817243576f},
-std::array<float,2>{0.354459286f, 0.386650234f},
-std::array<float,2>{0.80678314f, 0.70454669f},
-std::array<float,2>{0.716740787f, 0.488175869f},
-std::array<float,2>{0.237296119f, 0.640437841f},
-std::array<float,2>{0.490064919f, 0.210524216f},
-std::array<float,2>{0.914208591f, 0.809008598f},
-std::array<float,2>{0.813673615f, 0.0874959454f},
-std::array<float,2>{0.295981854f, 0.987366915f},
-std::array<float,2>{0.0256547611f, 0.297102869f},
-std::array<float,2>{0.575235605f, 0.579314768f},
-std::array<float,2>{0.97536844f, 0.376189411f},
-std::array<float,2>{0.4245058f, 0.718675077f},
-std::array<float,2>{0.154243723f, 0.164197028f},
-std::array<float,2>{0.637330413f, 0.826035261f},
-std::array<float,2>{0.508313715f, 0.0310813263f},
-std::array<float,2>{0.0952694267f, 0.924840212f},
-std::array<float,2>{0.319137394f, 0.354988277f},
-std::array<float,2>{0.756990492f, 0.513392866f},
-std::array<float,2>{0.741814435f, 0.305924088f},
-std::array<float,2>{0.214628652f, 0.586454213f},
-std::array<float,2>{0.439985305f, 0.0803587586f},
-std::array<float,2>{0.906118035f, 0.993584633f},
-std::array<float,2>{0.859158516f, 0.218368366f},
-std::array<float,2>{0.273644596f, 0.797231078f},
-std::array<float,2>{0.0531573519f, 0.498953253f},
-std::array<float,2>{0.618316054f, 0.628660977f},
-std::array<float,2>{0.804535091f, 0.342727214f},
-std::array<float,2>{0.348978877f, 0.532222748f},
-std::array<float,2>{0.0686638802f, 0.0483125299f},
-std::array<float,2>{0.541668236f, 0.889413059f},
-std::array<float,2>{0.663652122f, 0.138895869f},
-std::array<float,2>{0.17917414f, 0.849670172f},
-std::array<float,2>{0.405543745f, 0.423512906f},
-std::array<float,2>{0.957926273f, 0.724536657f},
-std::array<float,2>{0.563359857f, 0.440523088f},
-std::array<float,2>{0.0191758461f, 0.667897522f},
-std::array<float,2>{0.285166353f, 0.231330097f},
-std::array<float,2>{0.824548483f, 0.751594305f},
-std::array<float,2>{0.908640742f, 0.103660136f},
-std::array<float,2>{0.498729855f, 0.962972999f},
-std::array<float,2>{0.244900703f, 0.257341325f},
-std::array<float,2>{0.7098943f, 0.621320605f},
-std::array<float,2>{0.832363725f, 0.469585627f},
-std::array<float,2>{0.31053853f, 0.649012625f},
-std::array<float,2>{0.0112134367f, 0.19268249f},
-std::array<float,2>{0.592823625f, 0.792103231f},
-std::array<float,2>{0.696203709f, 0.0653283224f},
-std::array<float,2>{0.22868301f, 0.974186182f},
-std::array<float,2>{0.479886144f, 0.283650339f},
-std::array<float,2>{0.932523012f, 0.568651617f},
-std::array<float,2>{0.550856531f, 0.371893793f},
-std::array<float,2>{0.08798334f, 0.52107656f},
-std::array<float,2>{0.367676437f, 0.0148555767f},
-std::array<float,2>{0.791785061f, 0.907574058f},
-std::array<float,2>{0.952899396f, 0.186764911f},
-std::array<float,2>{0.385894239f, 0.839729011f},
-std::array<float,2>{0.158662021f, 0.392359763f},
-std::array<float,2>{0.673519492f, 0.687873483f},
-std::array<float,2>{0.888125539f, 0.278071165f},
-std::array<float,2>{0.462022096f, 0.600968599f},
-std::array<float,2>{0.199643478f, 0.120371066f},
-std::array<float,2>{0.721170127f, 0.94244349f},
-std::array<float,2>{0.606038451f, 0.236863777f},
-std::array<float,2>{0.034176562f, 0.778997302f},
-std::array<float,2>{0.257146299f, 0.46273911f},
-std::array<float,2>{0.862513185f, 0.680573165f},
-std::array<float,2>{0.648883104f, 0.40694052f},
-std::array<float,2>{0.130009502f, 0.740089953f},
-std::array<float,2>{0.406882584f, 0.149577275f},
-std::array<float,2>{0.990444362f, 0.867900074f},
-std::array<float,2>{0.771626949f, 0.0356136933f},
-std::array<float,2>{0.334229916f, 0.898483455f},
-std::array<float,2>{0.110124826f, 0.323514611f},
-std::array<float,2>{0.522275746f, 0.558163583f},
-std::array<float,2>{0.900239468f, 0.419096112f},
-std::array<float,2>{0.444150656f, 0.742431045f},
-std::array<float,2>{0.217079207f, 0.143571422f},
-std::array<float,2>{0.735522807f, 0.861664593f},
-std::array<float,2>{0.621621072f, 0.0408722274f},
-std::array<float,2>{0.0473889522f, 0.892736018f},
-std::array<float,2>{0.279032111f, 0.313608706f},
-std::array<float,2>{0.852163076f, 0.553897142f},
-std::array<float,2>{0.634788871f, 0.268694103f},
-std::array<float,2>{0.151565045f, 0.6017344f},
-std::array<float,2>{0.427315205f, 0.115926109f},
-std::array<float,2>{0.971825123f, 0.951518774f},
-std::array<float,2>{0.751714289f, 0.24800989f},
-std::array<float,2>{0.316272616f, 0.769055605f},
-std::array<float,2>{0.100355059f, 0.458340794f},
-std::array<float,2>{0.512991667f, 0.679572165f},
-std::array<float,2>{0.822989643f, 0.366795748f},
-std::array<float,2>{0.283961922f, 0.524327815f},
-std::array<float,2>{0.020356534f, 0.000177123642f},
-std::array<float,2>{0.568833947f, 0.914481819f},
-std::array<float,2>{0.703988492f, 0.176387295f},
-std::array<float,2>{0.24734576f, 0.830446541f},
-std::array<float,2>{0.493469089f, 0.404631466f},
-std::array<float,2>{0.910468698f, 0.701711655f},
-std::array<float,2>{0.54434514f, 0.478332847f},
-std::array<float,2>{0.0640634671f, 0.648267031f},
-std::array<float,2>{0.347322971f, 0.197442606f},
-std::array<float,2>{0.796976507f, 0.782266378f},
-std::array<float,2>{0.956877112f, 0.0775184035f},
-std::array<float,2>{0.40084365f, 0.978308618f},
-std::array<float,2>{0.174793601f, 0.295719862f},
-std::array<float,2>{0.659823537f, 0.574094415f},
-std::array<float,2>{0.796077013f, 0.449696928f},
-std::array<float,2>{0.373862416f, 0.660622418f},
-std::array<float,2>{0.0916301087f, 0.220954314f},
-std::array<float,2>{0.548207402f, 0.76017648f},
-std::array<float,2>{0.675874889f, 0.0990967155f},
-std::array<float,2>{0.163795546f, 0.954685926f},
-std::array<float,2>{0.386773795f, 0.26353094f},
-std::array<float,2>{0.946531296f, 0.61607486f},
-std::array<float,2>{0.588719547f, 0.332068443f},
-std::array<float,2>{0.0121196946f, 0.542618394f},
-std::array<float,2>{0.306861073f, 0.0582966283f},
-std::array<float,2>{0.828242779f, 0.879276514f},
-std::array<float,2>{0.933684349f, 0.128356308f},
-std::array<float,2>{0.482071072f, 0.855197191f},
-std::array<float,2>{0.233975157f, 0.436855882f},
-std::array<float,2>{0.699435294f, 0.727813482f},
-std::array<float,2>{0.986482084f, 0.303308517f},
-std::array<float,2>{0.410485774f, 0.582195878f},
-std::array<float,2>{0.126363918f, 0.0902860612f},
-std::array<float,2>{0.653783262f, 0.988959253f},
-std::array<float,2>{0.516790748f, 0.204504877f},
-std::array<float,2>{0.113882899f, 0.804834425f},
-std::array<float,2>{0.329716146f, 0.488809466f},
-std::array<float,2>{0.766418636f, 0.636298716f},
-std::array<float,2>{0.724174142f, 0.38688004f},
-std::array<float,2>{0.19778505f, 0.708235502f},
-std::array<float,2>{0.465673089f, 0.157391757f},
-std::array<float,2>{0.883722603f, 0.815575123f},
-std::array<float,2>{0.865974903f, 0.0157260485f},
-std::array<float,2>{0.250635922f, 0.933315456f},
-std::array<float,2>{0.0386304893f, 0.350292116f},
-std::array<float,2>{0.602223456f, 0.503592074f},
-std::array<float,2>{0.943763494f, 0.493219376f},
-std::array<float,2>{0.375914454f, 0.628994644f},
-std::array<float,2>{0.16762197f, 0.214145213f},
-std::array<float,2>{0.683304012f, 0.801597059f},
-std::array<float,2>{0.557923675f, 0.082092911f},
-std::array<float,2>{0.0795912966f, 0.998285711f},
-std::array<float,2>{0.361862302f, 0.309379518f},
-std::array<float,2>{0.787256837f, 0.592713118f},
-std::array<float,2>{0.690714896f, 0.355562955f},
-std::array<float,2>{0.22551921f, 0.509552598f},
-std::array<float,2>{0.476497561f, 0.0241090842f},
-std::array<float,2>{0.922579944f, 0.927899182f},
-std::array<float,2>{0.843263149f, 0.170673832f},
-std::array<float,2>{0.299877197f, 0.820942581f},
-std::array<float,2>{0.0023285558f, 0.380067378f},
-std::array<float,2>{0.585904956f, 0.713585854f},
-std::array<float,2>{0.775138438f, 0.252206028f},
-std::array<float,2>{0.341506481f, 0.618232608f},
-std::array<float,2>{0.121380322f, 0.108288564f},
-std::array<float,2>{0.525049806f, 0.966907501f},
-std::array<float,2>{0.646024883f, 0.22779423f},
-std::array<float,2>{0.140588924f, 0.75702554f},
-std::array<float,2>{0.418923736f, 0.444070399f},
-std::array<float,2>{0.992798984f, 0.670233905f},
-std::array<float,2>{0.595022202f, 0.426368117f},
-std::array<float,2>{0.0435087867f, 0.719591796f},
-std::array<float,2>{0.261841357f, 0.136657447f},
-std::array<float,2>{0.871512413f, 0.845444679f},
-std::array<float,2>{0.877749562f, 0.0537131466f},
-std::array<float,2>{0.453371197f, 0.883325875f},
-std::array<float,2>{0.190643191f, 0.336863965f},
-std::array<float,2>{0.730420351f, 0.535546601f},
-std::array<float,2>{0.849013805f, 0.395291358f},
-std::array<float,2>{0.267751366f, 0.695010602f},
-std::array<float,2>{0.0595932044f, 0.179733619f},
-std::array<float,2>{0.614221334f, 0.84212625f},
-std::array<float,2>{0.742858052f, 0.00832229387f},
-std::array<float,2>{0.208433658f, 0.91187048f},
-std::array<float,2>{0.448749483f, 0.36893639f},
-std::array<float,2>{0.892836511f, 0.515762925f},
-std::array<float,2>{0.507698417f, 0.287751198f},
-std::array<float,2>{0.102044292f, 0.56257993f},
-std::array<float,2>{0.323596627f, 0.0695244819f},
-std::array<float,2>{0.765112817f, 0.971144199f},
-std::array<float,2>{0.983115494f, 0.190485388f},
-std::array<float,2>{0.43628931f, 0.795015275f},
-std::array<float,2>{0.14781414f, 0.473967969f},
-std::array<float,2>{0.630833626f, 0.655603707f},
-std::array<float,2>{0.92025739f, 0.328028947f},
-std::array<float,2>{0.484946489f, 0.559909701f},
-std::array<float,2>{0.241211414f, 0.0314608738f},
-std::array<float,2>{0.711834013f, 0.903486729f},
-std::array<float,2>{0.570784032f, 0.152543992f},
-std::array<float,2>{0.0286818314f, 0.873214304f},
-std::array<float,2>{0.291851521f, 0.410766721f},
-std::array<float,2>{0.818791449f, 0.737216115f},
-std::array<float,2>{0.664425075f, 0.46579355f},
-std::array<float,2>{0.182593942f, 0.68629539f},
-std::array<float,2>{0.397463232f, 0.240411669f},
-std::array<float,2>{0.963063717f, 0.773921311f},
-std::array<float,2>{0.809202492f, 0.122132905f},
-std::array<float,2>{0.355643183f, 0.940435827f},
-std::array<float,2>{0.0744834468f, 0.276337177f},
-std::array<float,2>{0.535283625f, 0.596297681f},
-std::array<float,2>{0.922637284f, 0.495475143f},
-std::array<float,2>{0.476182073f, 0.631062567f},
-std::array<float,2>{0.225167781f, 0.211225331f},
-std::array<float,2>{0.690627038f, 0.804406404f},
-std::array<float,2>{0.585566461f, 0.0854415596f},
-std::array<float,2>{0.00216771825f, 0.997250617f},
-std::array<float,2>{0.300254375f, 0.31116578f},
-std::array<float,2>{0.843676269f, 0.591335893f},
-std::array<float,2>{0.683366239f, 0.35928458f},
-std::array<float,2>{0.167879388f, 0.511367798f},
-std::array<float,2>{0.375629246f, 0.0259036887f},
-std::array<float,2>{0.943387628f, 0.927147985f},
-std::array<float,2>{0.787510097f, 0.16964516f},
-std::array<float,2>{0.362288743f, 0.822657764f},
-std::array<float,2>{0.0800421983f, 0.38263762f},
-std::array<float,2>{0.557801008f, 0.711684167f},
-std::array<float,2>{0.871180296f, 0.251729846f},
-std::array<float,2>{0.262104362f, 0.621022522f},
-std::array<float,2>{0.0437877961f, 0.10642688f},
-std::array<float,2>{0.594804227f, 0.966503561f},
-std::array<float,2>{0.730010033f, 0.229756579f},
-std::array<float,2>{0.190760374f, 0.754424036f},
-std::array<float,2>{0.45312655f, 0.442953318f},
-std::array<float,2>{0.877465069f, 0.669503391f},
-std::array<float,2>{0.525255978f, 0.42868641f},
-std::array<float,2>{0.121306635f, 0.721366704f},
-std::array<float,2>{0.34169358f, 0.134459808f},
-std::array<float,2>{0.775353611f, 0.845758438f},
-std::array<float,2>{0.993011415f, 0.0521957465f},
-std::array<float,2>{0.418608129f, 0.885967672f},
-std::array<float,2>{0.140137255f, 0.339226514f},
-std::array<float,2>{0.646468282f, 0.538968205f},
-std::array<float,2>{0.764744699f, 0.397147506f},
-std::array<float,2>{0.323336005f, 0.691497982f},
-std::array<float,2>{0.10159871f, 0.1816798f},
-std::array<float,2>{0.507494152f, 0.840144277f},
-std::array<float,2>{0.630420625f, 0.0113008386f},
-std::array<float,2>{0.147560716f, 0.912529826f},
-std::array<float,2>{0.43608579f, 0.370397449f},
-std::array<float,2>{0.983281255f, 0.518281639f},
-std::array<float,2>{0.613929629f, 0.286027431f},
-std::array<float,2>{0.0599615723f, 0.564690292f},
-std::array<float,2>{0.267898083f, 0.0681358203f},
-std::array<float,2>{0.848750591f, 0.97032398f},
-std::array<float,2>{0.892675757f, 0.188209981f},
-std::array<float,2>{0.449184269f, 0.793008924f},
-std::array<float,2>{0.20804058f, 0.475051016f},
-std::array<float,2>{0.742932141f, 0.652754903f},
-std::array<float,2>{0.963197112f, 0.324791133f},
-std::array<float,2>{0.397903562f, 0.561231017f},
-std::array<float,2>{0.182222292f, 0.0343625247f},
-std::array<float,2>{0.664105833f, 0.905880511f},
-std::array<float,2>{0.535557032f, 0.155204058f},
-std::array<float,2>{0.0744429305f, 0.871305168f},
-std::array<float,2>{0.355866134f, 0.413282454f},
-std::array<float,2>{0.809366703f, 0.735334933f},
-std::array<float,2>{0.711618125f, 0.467397392f},
-std::array<float,2>{0.241688088f, 0.684744179f},
-std::array<float,2>{0.485187829f, 0.239579663f},
-std::array<float,2>{0.919982493f, 0.776266873f},
-std::array<float,2>{0.818496048f, 0.123363234f},
-std::array<float,2>{0.291571409f, 0.939230144f},
-std::array<float,2>{0.0283637941f, 0.27470243f},
-std::array<float,2>{0.570324957f, 0.595312655f},
-std::array<float,2>{0.972119391f, 0.421391755f},
-std::array<float,2>{0.427708894f, 0.744737566f},
-std::array<float,2>{0.151649818f, 0.141321674f},
-std::array<float,2>{0.635173738f, 0.861196756f},
-std::array<float,2>{0.512798429f, 0.0421632715f},
-std::array<float,2>{0.100222424f, 0.890691876f},
-std::array<float,2>{0.316061765f, 0.314992636f},
-std::array<float,2>{0.751644909f, 0.551652253f},
-std::array<float,2>{0.735746443f, 0.26726073f},
-std::array<float,2>{0.216864392f, 0.604183078f},
-std::array<float,2>{0.443882376f, 0.114990734f},
-std::array<float,2>{0.899983585f, 0.949955285f},
-std::array<float,2>{0.852416992f, 0.249054134f},
-std::array<float,2>{0.279135853f, 0.767343581f},
-std::array<float,2>{0.04772605f, 0.459799677f},
-std::array<float,2>{0.622012079f, 0.675896585f},
-std::array<float,2>{0.797174513f, 0.36463055f},
-std::array<float,2>{0.347530425f, 0.527058125f},
-std::array<float,2>{0.0642951578f, 0.00373995421f},
-std::array<float,2>{0.544141352f, 0.916747808f},
-std::array<float,2>{0.660119534f, 0.178669244f},
-std::array<float,2>{0.174531624f, 0.829193592f},
-std::array<float,2>{0.400494814f, 0.404286444f},
-std::array<float,2>{0.956589937f, 0.699998736f},
-std::array<float,2>{0.568567574f, 0.479763925f},
-std::array<float,2>{0.0201913025f, 0.646287143f},
-std::array<float,2>{0.283851385f, 0.196585864f},
-std::array<float,2>{0.823047936f, 0.784682035f},
-std::array<float,2>{0.910176158f, 0.0757696927f},
-std::array<float,2>{0.493278533f, 0.979781091f},
-std::array<float,2>{0.24722074f, 0.294289529f},
-std::array<float,2>{0.703722119f, 0.571372867f},
-std::array<float,2>{0.828520477f, 0.451656997f},
-std::array<float,2>{0.307005763f, 0.662864387f},
-std::array<float,2>{0.0118794302f, 0.220455721f},
-std::array<float,2>{0.588620007f, 0.758425713f},
-std::array<float,2>{0.699666858f, 0.101379625f},
-std::array<float,2>{0.234275013f, 0.955202162f},
-std::array<float,2>{0.482231975f, 0.264048636f},
-std::array<float,2>{0.9340114f, 0.613500595f},
-std::array<float,2>{0.547868848f, 0.334379017f},
-std::array<float,2>{0.0914475769f, 0.540785789f},
-std::array<float,2>{0.373589784f, 0.0554303229f},
-std::array<float,2>{0.79633671f, 0.882417023f},
-std::array<float,2>{0.946690798f, 0.126746207f},
-std::array<float,2>{0.387158245f, 0.853484809f},
-std::array<float,2>{0.163858876f, 0.434900731f},
-std::array<float,2>{0.676151693f, 0.729165316f},
-std::array<float,2>{0.883471787f, 0.302395284f},
-std::array<float,2>{0.465435416f, 0.585277736f},
-std::array<float,2>{0.198069066f, 0.0936767235f},
-std::array<float,2>{0.724548519f, 0.991149247f},
-std::array<float,2>{0.60238415f, 0.205691665f},
-std::array<float,2>{0.0390196182f, 0.807063401f},
-std::array<float,2>{0.250801623f, 0.491875112f},
-std::array<float,2>{0.865834296f, 0.633832514f},
-std::array<float,2>{0.653478086f, 0.389743894f},
-std::array<float,2>{0.126017854f, 0.709426403f},
-std::array<float,2>{0.410181612f, 0.159510225f},
-std::array<float,2>{0.986622632f, 0.814154267f},
-std::array<float,2>{0.766261697f, 0.0177969374f},
-std::array<float,2>{0.329981297f, 0.93051368f},
-std::array<float,2>{0.114026539f, 0.347949326f},
-std::array<float,2>{0.517038941f, 0.500125051f},
-std::array<float,2>{0.905973971f, 0.377418309f},
-std::array<float,2>{0.440421522f, 0.715919435f},
-std::array<float,2>{0.214462817f, 0.166990101f},
-std::array<float,2>{0.742055595f, 0.828040838f},
-std::array<float,2>{0.618587554f, 0.0280020535f},
-std::array<float,2>{0.0529524572f, 0.923508644f},
-std::array<float,2>{0.273744166f, 0.352945298f},
-std::array<float,2>{0.859129369f, 0.514886558f},
-std::array<float,2>{0.637470186f, 0.307470411f},
-std::array<float,2>{0.153958142f, 0.587956429f},
-std::array<float,2>{0.424617648f, 0.0800556317f},
-std::array<float,2>{0.975270629f, 0.995367408f},
-std::array<float,2>{0.757275581f, 0.215361014f},
-std::array<float,2>{0.319004089f, 0.800763845f},
-std::array<float,2>{0.095505394f, 0.497068018f},
-std::array<float,2>{0.508646727f, 0.625181258f},
-std::array<float,2>{0.824221909f, 0.341195434f},
-std::array<float,2>{0.285436451f, 0.534873724f},
-std::array<float,2>{0.0194594525f, 0.0499927662f},
-std::array<float,2>{0.563152194f, 0.886991143f},
-std::array<float,2>{0.709583163f, 0.137317345f},
-std::array<float,2>{0.244758278f, 0.849153936f},
-std::array<float,2>{0.498854488f, 0.424402207f},
-std::array<float,2>{0.908214092f, 0.724753559f},
-std::array<float,2>{0.541847885f, 0.439055383f},
-std::array<float,2>{0.0685532838f, 0.665730238f},
-std::array<float,2>{0.348826826f, 0.234265506f},
-std::array<float,2>{0.804208398f, 0.75357312f},
-std::array<float,2>{0.957604766f, 0.102117136f},
-std::array<float,2>{0.405387908f, 0.961977661f},
-std::array<float,2>{0.178915903f, 0.255236328f},
-std::array<float,2>{0.6638515f, 0.623479307f},
-std::array<float,2>{0.791633904f, 0.470826715f},
-std::array<float,2>{0.368072331f, 0.650685668f},
-std::array<float,2>{0.0881524011f, 0.194220036f},
-std::array<float,2>{0.551269412f, 0.789484441f},
-std::array<float,2>{0.673648417f, 0.0634219795f},
-std::array<float,2>{0.158386439f, 0.975182533f},
-std::array<float,2>{0.386021912f, 0.282574713f},
-std::array<float,2>{0.952709198f, 0.567040205f},
-std::array<float,2>{0.593105435f, 0.374642581f},
-std::array<float,2>{0.0109237749f, 0.521761835f},
-std::array<float,2>{0.310136467f, 0.0120571349f},
-std::array<float,2>{0.832145095f, 0.909681737f},
-std::array<float,2>{0.932195067f, 0.184121907f},
-std::array<float,2>{0.479721427f, 0.836204469f},
-std::array<float,2>{0.228870839f, 0.393718809f},
-std::array<float,2>{0.69581151f, 0.691126525f},
-std::array<float,2>{0.990511656f, 0.279796928f},
-std::array<float,2>{0.407061607f, 0.598870039f},
-std::array<float,2>{0.13035436f, 0.118034095f},
-std::array<float,2>{0.648453534f, 0.945067644f},
-std::array<float,2>{0.522010565f, 0.235060334f},
-std::array<float,2>{0.109931506f, 0.781207204f},
-std::array<float,2>{0.334004581f, 0.464064986f},
-std::array<float,2>{0.771760404f, 0.682465434f},
-std::array<float,2>{0.720767021f, 0.409949899f},
-std::array<float,2>{0.199354917f, 0.740251601f},
-std::array<float,2>{0.462160856f, 0.152302951f},
-std::array<float,2>{0.887937665f, 0.870098889f},
-std::array<float,2>{0.862745225f, 0.0386648774f},
-std::array<float,2>{0.256956518f, 0.901081204f},
-std::array<float,2>{0.0338634066f, 0.320655406f},
-std::array<float,2>{0.606416583f, 0.555524886f},
-std::array<float,2>{0.938688517f, 0.455473989f},
-std::array<float,2>{0.379333138f, 0.674701273f},
-std::array<float,2>{0.168669492f, 0.243815035f},
-std::array<float,2>{0.686803579f, 0.769820869f},
-std::array<float,2>{0.559878826f, 0.112535365f},
-std::array<float,2>{0.0855439529f, 0.948764503f},
-std::array<float,2>{0.365376025f, 0.271284163f},
-std::array<float,2>{0.78137666f, 0.608426929f},
-std::array<float,2>{0.693830431f, 0.317410439f},
-std::array<float,2>{0.221437007f, 0.548140764f},
-std::array<float,2>{0.472485989f, 0.0463257357f},
-std::array<float,2>{0.928447545f, 0.897158921f},
-std::array<float,2>{0.836545169f, 0.148208827f},
-std::array<float,2>{0.302510649f, 0.86717397f},
-std::array<float,2>{0.00645015202f, 0.415311456f},
-std::array<float,2>{0.57869935f, 0.747561812f},
-std::array<float,2>{0.780306399f, 0.292137712f},
-std::array<float,2>{0.336958915f, 0.575150847f},
-std::array<float,2>{0.117986292f, 0.0740095526f},
-std::array<float,2>{0.528181791f, 0.980680048f},
-std::array<float,2>{0.642356336f, 0.199718893f},
-std::array<float,2>{0.133808091f, 0.786096275f},
-std::array<float,2>{0.417529553f, 0.480853677f},
-std::array<float,2>{0.996673763f, 0.642246842f},
-std::array<float,2>{0.601194859f, 0.401333004f},
-std::array<float,2>{0.0410910696f, 0.697579205f},
-std::array<float,2>{0.260034233f, 0.17319335f},
-std::array<float,2>{0.870187521f, 0.832524478f},
-std::array<float,2>{0.880155742f, 0.0050758021f},
-std::array<float,2>{0.458149195f, 0.919098556f},
-std::array<float,2>{0.194983393f, 0.362488896f},
-std::array<float,2>{0.733875453f, 0.528932512f},
-std::array<float,2>{0.844586432f, 0.433378428f},
-std::array<float,2>{0.270237654f, 0.731640279f},
-std::array<float,2>{0.0568029173f, 0.130536512f},
-std::array<float,2>{0.612634599f, 0.855537951f},
-std::array<float,2>{0.749720931f, 0.0593651906f},
-std::array<float,2>{0.203738809f, 0.878481746f},
-std::array<float,2>{0.453093052f, 0.328308433f},
-std::array<float,2>{0.895190477f, 0.546717405f},
-std::array<float,2>{0.502574444f, 0.26171279f},
-std::array<float,2>{0.108943552f, 0.613279045f},
-std::array<float,2>{0.325435042f, 0.0964086577f},
-std::array<float,2>{0.758924603f, 0.96085012f},
-std::array<float,2>{0.978135347f, 0.225361183f},
-std::array<float,2>{0.43160978f, 0.763656199f},
-std::array<float,2>{0.143882528f, 0.447155625f},
-std::array<float,2>{0.627422929f, 0.658764482f},
-std::array<float,2>{0.91443491f, 0.347523749f},
-std::array<float,2>{0.48987484f, 0.504096329f},
-std::array<float,2>{0.236949608f, 0.019873675f},
-std::array<float,2>{0.716545939f, 0.9347471f},
-std::array<float,2>{0.575637698f, 0.162699655f},
-std::array<float,2>{0.0254776571f, 0.819376111f},
-std::array<float,2>{0.296274573f, 0.384295762f},
-std::array<float,2>{0.813754082f, 0.706946611f},
-std::array<float,2>{0.668862581f, 0.485851467f},
-std::array<float,2>{0.184009746f, 0.63681823f},
-std::array<float,2>{0.394129515f, 0.207952842f},
-std::array<float,2>{0.965577602f, 0.811184049f},
-std::array<float,2>{0.806984484f, 0.0888369828f},
-std::array<float,2>{0.354041994f, 0.985753357f},
-std::array<float,2>{0.0733102709f, 0.299835891f},
-std::array<float,2>{0.532645464f, 0.581080437f},
-std::array<float,2>{0.875563741f, 0.444416493f},
-std::array<float,2>{0.456018388f, 0.671285689f},
-std::array<float,2>{0.188860536f, 0.226913258f},
-std::array<float,2>{0.727518678f, 0.756768644f},
-std::array<float,2>{0.597079992f, 0.108702444f},
-std::array<float,2>{0.0449722148f, 0.968593001f},
-std::array<float,2>{0.264467597f, 0.253754169f},
-std::array<float,2>{0.873842776f, 0.617380381f},
-std::array<float,2>{0.647976696f, 0.337067872f},
-std::array<float,2>{0.136937141f, 0.536192417f},
-std::array<float,2>{0.421193153f, 0.0529509783f},
-std::array<float,2>{0.994355619f, 0.884708762f},
-std::array<float,2>{0.776242137f, 0.135011792f},
-std::array<float,2>{0.342809141f, 0.843799412f},
-std::array<float,2>{0.124492146f, 0.426762313f},
-std::array<float,2>{0.526584983f, 0.71991092f},
-std::array<float,2>{0.841007471f, 0.310495436f},
-std::array<float,2>{0.29821986f, 0.592799067f},
-std::array<float,2>{0.000679139455f, 0.0832232907f},
-std::array<float,2>{0.58311981f, 0.999263287f},
-std::array<float,2>{0.688064814f, 0.213291794f},
-std::array<float,2>{0.224392533f, 0.80201292f},
-std::array<float,2>{0.47279945f, 0.492569566f},
-std::array<float,2>{0.923939645f, 0.630491853f},
-std::array<float,2>{0.555089355f, 0.379362315f},
-std::array<float,2>{0.081217058f, 0.714244902f},
-std::array<float,2>{0.36087361f, 0.171070784f},
-std::array<float,2>{0.785725832f, 0.821858466f},
-std::array<float,2>{0.941922069f, 0.0250779595f},
-std::array<float,2>{0.378849238f, 0.92949456f},
-std::array<float,2>{0.164803311f, 0.357304633f},
-std::array<float,2>{0.67976433f, 0.507985592f},
-std::array<float,2>{0.810695112f, 0.41158855f},
-std::array<float,2>{0.358062565f, 0.737893045f},
-std::array<float,2>{0.0780611411f, 0.154165015f},
-std::array<float,2>{0.537420034f, 0.874047756f},
-std::array<float,2>{0.667788506f, 0.0331447385f},
-std::array<float,2>{0.180524886f, 0.903307498f},
-std::array<float,2>{0.395999074f, 0.32695201f},
-std::array<float,2>{0.962716281f, 0.559226036f},
-std::array<float,2>{0.574064493f, 0.276718855f},
-std::array<float,2>{0.0308301039f, 0.597177565f},
-std::array<float,2>{0.289788008f, 0.121985488f},
-std::array<float,2>{0.816935718f, 0.939956725f},
-std::array<float,2>{0.919899225f, 0.241288081f},
-std::array<float,2>{0.487681985f, 0.774672329f},
-std::array<float,2>{0.238880023f, 0.466001838f},
-std::array<float,2>{0.71332562f, 0.687427282f},
-std::array<float,2>{0.981910229f, 0.368043363f},
-std::array<float,2>{0.433868557f, 0.516943574f},
-std::array<float,2>{0.145445839f, 0.00915741734f},
-std::array<float,2>{0.631987691f, 0.910741568f},
-std::array<float,2>{0.504164517f, 0.181218058f},
-std::array<float,2>{0.104459725f, 0.843662858f},
-std::array<float,2>{0.321296513f, 0.395793736f},
-std::array<float,2>{0.7627123f, 0.694001555f},
-std::array<float,2>{0.745261073f, 0.473506153f},
-std::array<float,2>{0.209282726f, 0.654989541f},
-std::array<float,2>{0.445740223f, 0.189576983f},
-std::array<float,2>{0.891530573f, 0.796128511f},
-std::array<float,2>{0.8503263f, 0.0689275861f},
-std::array<float,2>{0.266110659f, 0.972276509f},
-std::array<float,2>{0.0609378219f, 0.289020181f},
-std::array<float,2>{0.616900265f, 0.564097941f},
-std::array<float,2>{0.953963995f, 0.40561378f},
-std::array<float,2>{0.398845196f, 0.702912092f},
-std::array<float,2>{0.173797905f, 0.17697835f},
-std::array<float,2>{0.657362938f, 0.83171761f},
-std::array<float,2>{0.545976341f, 0.00129346526f},
-std::array<float,2>{0.0657043606f, 0.915654063f},
-std::array<float,2>{0.345291793f, 0.365911603f},
-std::array<float,2>{0.80033046f, 0.525128841f},
-std::array<float,2>{0.70555073f, 0.296797097f},
-std::array<float,2>{0.249862865f, 0.572851181f},
-std::array<float,2>{0.49546212f, 0.0763223022f},
-std::array<float,2>{0.912194192f, 0.977390945f},
-std::array<float,2>{0.822237194f, 0.19847782f},
-std::array<float,2>{0.282730997f, 0.781680882f},
-std::array<float,2>{0.0233429931f, 0.477327734f},
-std::array<float,2>{0.567221463f, 0.646501184f},
-std::array<float,2>{0.753021657f, 0.312854588f},
-std::array<float,2>{0.313833892f, 0.553705633f},
-std::array<float,2>{0.0990760699f, 0.0397682227f},
-std::array<float,2>{0.514176071f, 0.893711984f},
-std::array<float,2>{0.634676099f, 0.142629355f},
-std::array<float,2>{0.149129614f, 0.862765014f},
-std::array<float,2>{0.429564327f, 0.418132484f},
-std::array<float,2>{0.970259726f, 0.743829429f},
-std::array<float,2>{0.624239087f, 0.457922786f},
-std::array<float,2>{0.0505598262f, 0.678629398f},
-std::array<float,2>{0.279651165f, 0.246475935f},
-std::array<float,2>{0.853879511f, 0.767668068f},
-std::array<float,2>{0.9020136f, 0.116618089f},
-std::array<float,2>{0.442925841f, 0.952832818f},
-std::array<float,2>{0.215194717f, 0.267610073f},
-std::array<float,2>{0.738019049f, 0.60296911f},
-std::array<float,2>{0.864050686f, 0.490053773f},
-std::array<float,2>{0.252919257f, 0.634991229f},
-std::array<float,2>{0.0356480516f, 0.20332408f},
-std::array<float,2>{0.605359435f, 0.805736482f},
-std::array<float,2>{0.725051224f, 0.0912921205f},
-std::array<float,2>{0.196467176f, 0.989867926f},
-std::array<float,2>{0.467177063f, 0.303840488f},
-std::array<float,2>{0.885042191f, 0.583977282f},
-std::array<float,2>{0.518821716f, 0.351043969f},
-std::array<float,2>{0.116078064f, 0.502675772f},
-std::array<float,2>{0.331216961f, 0.0174490232f},
-std::array<float,2>{0.768983424f, 0.931816459f},
-std::array<float,2>{0.984947622f, 0.156647623f},
-std::array<float,2>{0.412459254f, 0.815167606f},
-std::array<float,2>{0.128452465f, 0.388512045f},
-std::array<float,2>{0.65562588f, 0.707692921f},
-std::array<float,2>{0.936548233f, 0.262341708f},
-std::array<float,2>{0.483315796f, 0.616261721f},
-std::array<float,2>{0.23152864f, 0.0981194079f},
-std::array<float,2>{0.701302409f, 0.953292608f},
-std::array<float,2>{0.586346805f, 0.221810073f},
-std::array<float,2>{0.0154125895f, 0.761616766f},
-std::array<float,2>{0.305052787f, 0.450592339f},
-std::array<float,2>{0.831787944f, 0.661269903f},
-std::array<float,2>{0.678750217f, 0.43569985f},
-std::array<float,2>{0.161185265f, 0.727084041f},
-std::array<float,2>{0.390036821f, 0.127365991f},
-std::array<float,2>{0.949145436f, 0.854151428f},
-std::array<float,2>{0.792984545f, 0.0573847219f},
-std::array<float,2>{0.372890979f, 0.879964709f},
-std::array<float,2>{0.0921653658f, 0.33384341f},
-std::array<float,2>{0.550398707f, 0.541852415f},
-std::array<float,2>{0.906770229f, 0.422361672f},
-std::array<float,2>{0.496668011f, 0.722808421f},
-std::array<float,2>{0.243052289f, 0.139956132f},
-std::array<float,2>{0.708395362f, 0.851076305f},
-std::array<float,2>{0.564662158f, 0.0473951213f},
-std::array<float,2>{0.0162235145f, 0.889934003f},
-std::array<float,2>{0.287736565f, 0.34337759f},
-std::array<float,2>{0.827674627f, 0.532230198f},
-std::array<float,2>{0.661254108f, 0.256192505f},
-std::array<float,2>{0.177464366f, 0.622639477f},
-std::array<float,2>{0.403962523f, 0.104987271f},
-std::array<float,2>{0.959353209f, 0.964334905f},
-std::array<float,2>{0.801993847f, 0.232224062f},
-std::array<float,2>{0.351040125f, 0.750352323f},
-std::array<float,2>{0.0672228709f, 0.440288365f},
-std::array<float,2>{0.539232135f, 0.666933835f},
-std::array<float,2>{0.856553853f, 0.354041725f},
-std::array<float,2>{0.276833922f, 0.512640595f},
-std::array<float,2>{0.0519730262f, 0.0293763708f},
-std::array<float,2>{0.620554268f, 0.924004555f},
-std::array<float,2>{0.738741934f, 0.165517762f},
-std::array<float,2>{0.210979655f, 0.824581385f},
-std::array<float,2>{0.439010888f, 0.375911742f},
-std::array<float,2>{0.903827548f, 0.716812789f},
-std::array<float,2>{0.510972261f, 0.499519199f},
-std::array<float,2>{0.0976205319f, 0.627897859f},
-std::array<float,2>{0.31677413f, 0.217143342f},
-std::array<float,2>{0.754241168f, 0.798455f},
-std::array<float,2>{0.972990453f, 0.0815900937f},
-std::array<float,2>{0.422576338f, 0.993144572f},
-std::array<float,2>{0.155051574f, 0.304884374f},
-std::array<float,2>{0.639379144f, 0.587652385f},
-std::array<float,2>{0.770665944f, 0.461599857f},
-std::array<float,2>{0.333261967f, 0.680828869f},
-std::array<float,2>{0.112204261f, 0.23777622f},
-std::array<float,2>{0.520869553f, 0.77810812f},
-std::array<float,2>{0.651047885f, 0.119557768f},
-std::array<float,2>{0.13279283f, 0.94170326f},
-std::array<float,2>{0.409039855f, 0.278464228f},
-std::array<float,2>{0.988576233f, 0.59993583f},
-std::array<float,2>{0.607641995f, 0.322794497f},
-std::array<float,2>{0.0327331685f, 0.556722939f},
-std::array<float,2>{0.255333871f, 0.0364970006f},
-std::array<float,2>{0.860681057f, 0.900253654f},
-std::array<float,2>{0.889340043f, 0.149100423f},
-std::array<float,2>{0.464509398f, 0.869073391f},
-std::array<float,2>{0.203094825f, 0.408194184f},
-std::array<float,2>{0.719899535f, 0.739025354f},
-std::array<float,2>{0.950800419f, 0.284684926f},
-std::array<float,2>{0.383297861f, 0.570068657f},
-std::array<float,2>{0.15814364f, 0.0657285452f},
-std::array<float,2>{0.674368739f, 0.973003626f},
-std::array<float,2>{0.553969264f, 0.191850141f},
-std::array<float,2>{0.0868566409f, 0.791897357f},
-std::array<float,2>{0.370812178f, 0.470111758f},
-std::array<float,2>{0.789821863f, 0.649660349f},
-std::array<float,2>{0.697357476f, 0.391534656f},
-std::array<float,2>{0.226908937f, 0.689200163f},
-std::array<float,2>{0.477409512f, 0.18602857f},
-std::array<float,2>{0.930441856f, 0.838595927f},
-std::array<float,2>{0.834045112f, 0.0143185472f},
-std::array<float,2>{0.312089264f, 0.907034993f},
-std::array<float,2>{0.00904934481f, 0.372276366f},
-std::array<float,2>{0.590959191f, 0.519988477f},
-std::array<float,2>{0.998730838f, 0.483895451f},
-std::array<float,2>{0.415906101f, 0.644026339f},
-std::array<float,2>{0.134931415f, 0.201437443f},
-std::array<float,2>{0.642745078f, 0.787588656f},
-std::array<float,2>{0.52971983f, 0.0703783929f},
-std::array<float,2>{0.120638996f, 0.982888818f},
-std::array<float,2>{0.339388937f, 0.290764034f},
-std::array<float,2>{0.777917445f, 0.577158988f},
-std::array<float,2>{0.731967092f, 0.360370189f},
-std::array<float,2>{0.192447394f, 0.530568361f},
-std::array<float,2>{0.459796339f, 0.00601033121f},
-std::array<float,2>{0.882083237f, 0.920926034f},
-std::array<float,2>{0.868006647f, 0.173911482f},
-std::array<float,2>{0.258902252f, 0.834825516f},
-std::array<float,2>{0.0401382521f, 0.399693578f},
-std::array<float,2>{0.598959267f, 0.696270049f},
-std::array<float,2>{0.783893824f, 0.273388714f},
-std::array<float,2>{0.363427758f, 0.605490446f},
-std::array<float,2>{0.0821759328f, 0.109905817f},
-std::array<float,2>{0.562149942f, 0.946328998f},
-std::array<float,2>{0.685532331f, 0.245956331f},
-std::array<float,2>{0.170418486f, 0.773038328f},
-std::array<float,2>{0.381940007f, 0.453256398f},
-std::array<float,2>{0.939610481f, 0.673449039f},
-std::array<float,2>{0.581181288f, 0.416601509f},
-std::array<float,2>{0.00521684624f, 0.749380291f},
-std::array<float,2>{0.303645432f, 0.146041021f},
-std::array<float,2>{0.839185238f, 0.8647632f},
-std::array<float,2>{0.927306235f, 0.0434804559f},
-std::array<float,2>{0.470563948f, 0.895568609f},
-std::array<float,2>{0.218891487f, 0.318388373f},
-std::array<float,2>{0.693016589f, 0.550161541f},
-std::array<float,2>{0.815391779f, 0.384808958f},
-std::array<float,2>{0.294893861f, 0.703719616f},
-std::array<float,2>{0.0237543099f, 0.160215423f},
-std::array<float,2>{0.577584684f, 0.817637026f},
-std::array<float,2>{0.71691525f, 0.0228401553f},
-std::array<float,2>{0.235029578f, 0.936204433f},
-std::array<float,2>{0.492175937f, 0.344767302f},
-std::array<float,2>{0.916738153f, 0.506893516f},
-std::array<float,2>{0.533933342f, 0.297900259f},
-std::array<float,2>{0.0720096603f, 0.579038441f},
-std::array<float,2>{0.352216482f, 0.0867190808f},
-std::array<float,2>{0.806287587f, 0.987135231f},
-std::array<float,2>{0.967217684f, 0.209724113f},
-std::array<float,2>{0.391440064f, 0.809699535f},
-std::array<float,2>{0.185934231f, 0.486400157f},
-std::array<float,2>{0.671199799f, 0.639622986f},
-std::array<float,2>{0.896915734f, 0.331059575f},
-std::array<float,2>{0.450990885f, 0.543584406f},
-std::array<float,2>{0.205698207f, 0.061132744f},
-std::array<float,2>{0.746942401f, 0.876745105f},
-std::array<float,2>{0.609648108f, 0.131199226f},
-std::array<float,2>{0.0560202487f, 0.858793736f},
-std::array<float,2>{0.271487981f, 0.430393279f},
-std::array<float,2>{0.847345471f, 0.733550668f},
-std::array<float,2>{0.625088871f, 0.449049354f},
-std::array<float,2>{0.141179129f, 0.657109439f},
-std::array<float,2>{0.432293802f, 0.223293439f},
-std::array<float,2>{0.978517115f, 0.763986528f},
-std::array<float,2>{0.760539949f, 0.0945567861f},
-std::array<float,2>{0.32758981f, 0.957856655f},
-std::array<float,2>{0.105842523f, 0.258020461f},
-std::array<float,2>{0.500321448f, 0.609953582f},
-std::array<float,2>{0.891876817f, 0.475647509f},
-std::array<float,2>{0.446894437f, 0.653383195f},
-std::array<float,2>{0.210054457f, 0.18878758f},
-std::array<float,2>{0.74447751f, 0.793976724f},
-std::array<float,2>{0.616189897f, 0.0668584108f},
-std::array<float,2>{0.0616630688f, 0.969696522f},
-std::array<float,2>{0.267434299f, 0.286647707f},
-std::array<float,2>{0.851410925f, 0.565546334f},
-std::array<float,2>{0.630925775f, 0.36998105f},
-std::array<float,2>{0.14599891f, 0.518653572f},
-std::array<float,2>{0.435073733f, 0.00993479788f},
-std::array<float,2>{0.980746269f, 0.913236439f},
-std::array<float,2>{0.761995077f, 0.182933763f},
-std::array<float,2>{0.321084231f, 0.841210604f},
-std::array<float,2>{0.104567662f, 0.398278683f},
-std::array<float,2>{0.505161941f, 0.692476094f},
-std::array<float,2>{0.817905366f, 0.274343371f},
-std::array<float,2>{0.290964514f, 0.594064415f},
-std::array<float,2>{0.0297677107f, 0.124502912f},
-std::array<float,2>{0.57299614f, 0.937577426f},
-std::array<float,2>{0.714540601f, 0.23890546f},
-std::array<float,2>{0.239347756f, 0.776843309f},
-std::array<float,2>{0.486672103f, 0.468207091f},
-std::array<float,2>{0.918462515f, 0.684268594f},
-std::array<float,2>{0.538541257f, 0.412999988f},
-std::array<float,2>{0.0762090832f, 0.735532761f},
-std::array<float,2>{0.359106332f, 0.156239524f},
-std::array<float,2>{0.811793804f, 0.872871041f},
-std::array<float,2>{0.961813569f, 0.0332368873f},
-std::array<float,2>{0.394584209f, 0.904327273f},
-std::array<float,2>{0.181151673f, 0.325911045f},
-std::array<float,2>{0.666095436f, 0.561840177f},
-std::array<float,2>{0.786635756f, 0.380992353f},
-std::array<float,2>{0.359878838f, 0.71287179f},
-std::array<float,2>{0.080793187f, 0.168017223f},
-std::array<float,2>{0.556595623f, 0.824143887f},
-std::array<float,2>{0.68096441f, 0.0267725252f},
-std::array<float,2>{0.165701598f, 0.926163912f},
-std::array<float,2>{0.377397478f, 0.358278722f},
-std::array<float,2>{0.942685425f, 0.510306597f},
-std::array<float,2>{0.582193375f, 0.31239593f},
-std::array<float,2>{0.00179203041f, 0.590258539f},
-std::array<float,2>{0.297480553f, 0.0843851268f},
-std::array<float,2>{0.840244532f, 0.996284068f},
-std::array<float,2>{0.925745785f, 0.212645605f},
-std::array<float,2>{0.473932445f, 0.803028286f},
-std::array<float,2>{0.222702533f, 0.494252831f},
-std::array<float,2>{0.689293683f, 0.631982088f},
-std::array<float,2>{0.995152891f, 0.338054538f},
-std::array<float,2>{0.420560867f, 0.537837386f},
-std::array<float,2>{0.138341904f, 0.0517360158f},
-std::array<float,2>{0.64652133f, 0.88484323f},
-std::array<float,2>{0.525626898f, 0.133464113f},
-std::array<float,2>{0.12328545f, 0.847314119f},
-std::array<float,2>{0.342436165f, 0.429171562f},
-std::array<float,2>{0.777253568f, 0.722617328f},
-std::array<float,2>{0.727875769f, 0.442138493f},
-std::array<float,2>{0.187778369f, 0.668435574f},
-std::array<float,2>{0.45647049f, 0.229447782f},
-std::array<float,2>{0.876280725f, 0.755523205f},
-std::array<float,2>{0.874172211f, 0.106874622f},
-std::array<float,2>{0.265186161f, 0.965274394f},
-std::array<float,2>{0.0465846583f, 0.250647604f},
-std::array<float,2>{0.596576333f, 0.619952738f},
-std::array<float,2>{0.947690487f, 0.434417129f},
-std::array<float,2>{0.388747633f, 0.730022311f},
-std::array<float,2>{0.160370007f, 0.125731274f},
-std::array<float,2>{0.677738309f, 0.852258384f},
-std::array<float,2>{0.54946059f, 0.0562984012f},
-std::array<float,2>{0.0931954086f, 0.881784141f},
-std::array<float,2>{0.371704131f, 0.335202396f},
-std::array<float,2>{0.794399977f, 0.539834142f},
-std::array<float,2>{0.702262163f, 0.265316099f},
-std::array<float,2>{0.231319621f, 0.614917696f},
-std::array<float,2>{0.483920515f, 0.100575209f},
-std::array<float,2>{0.935562909f, 0.956164539f},
-std::array<float,2>{0.830860972f, 0.218854547f},
-std::array<float,2>{0.306142509f, 0.759057939f},
-std::array<float,2>{0.014267548f, 0.452819496f},
-std::array<float,2>{0.587123156f, 0.663287163f},
-std::array<float,2>{0.768505216f, 0.349514693f},
-std::array<float,2>{0.330893308f, 0.501265943f},
-std::array<float,2>{0.116586968f, 0.0194478892f},
-std::array<float,2>{0.517793238f, 0.931186616f},
-std::array<float,2>{0.655062199f, 0.158208773f},
-std::array<float,2>{0.127787665f, 0.812726796f},
-std::array<float,2>{0.41378653f, 0.388876051f},
-std::array<float,2>{0.98612076f, 0.710780561f},
-std::array<float,2>{0.604071379f, 0.490834773f},
-std::array<float,2>{0.0370812789f, 0.633212268f},
-std::array<float,2>{0.253277808f, 0.206272081f},
-std::array<float,2>{0.864609718f, 0.807792485f},
-std::array<float,2>{0.885915518f, 0.092054747f},
-std::array<float,2>{0.468747556f, 0.99216181f},
-std::array<float,2>{0.195878476f, 0.301633149f},
-std::array<float,2>{0.725890875f, 0.58455795f},
-std::array<float,2>{0.854795396f, 0.460145235f},
-std::array<float,2>{0.28089717f, 0.677680731f},
-std::array<float,2>{0.0496917479f, 0.24891305f},
-std::array<float,2>{0.623696685f, 0.766234398f},
-std::array<float,2>{0.736941338f, 0.113292567f},
-std::array<float,2>{0.216189742f, 0.951066077f},
-std::array<float,2>{0.442373306f, 0.266260445f},
-std::array<float,2>{0.90051353f, 0.604620695f},
-std::array<float,2>{0.515197277f, 0.315963566f},
-std::array<float,2>{0.0983665809f, 0.552452326f},
-std::array<float,2>{0.313264936f, 0.0410393365f},
-std::array<float,2>{0.752512753f, 0.892433167f},
-std::array<float,2>{0.969670355f, 0.141983688f},
-std::array<float,2>{0.428355157f, 0.859699249f},
-std::array<float,2>{0.150047362f, 0.420200318f},
-std::array<float,2>{0.633570433f, 0.745947003f},
-std::array<float,2>{0.913475811f, 0.293407917f},
-std::array<float,2>{0.494291127f, 0.570726514f},
-std::array<float,2>{0.248405606f, 0.0745159909f},
-std::array<float,2>{0.707003057f, 0.979325771f},
-std::array<float,2>{0.567393303f, 0.195867673f},
-std::array<float,2>{0.0218786448f, 0.783906639f},
-std::array<float,2>{0.281854868f, 0.479096502f},
-std::array<float,2>{0.821029723f, 0.644910097f},
-std::array<float,2>{0.657023489f, 0.402966619f},
-std::array<float,2>{0.172406629f, 0.700681806f},
-std::array<float,2>{0.399506778f, 0.179644883f},
-std::array<float,2>{0.954299927f, 0.82829231f},
-std::array<float,2>{0.799095094f, 0.00255341316f},
-std::array<float,2>{0.344614148f, 0.91730386f},
-std::array<float,2>{0.0652227774f, 0.36380589f},
-std::array<float,2>{0.545257807f, 0.526332498f},
-std::array<float,2>{0.931583405f, 0.392584801f},
-std::array<float,2>{0.478074878f, 0.690327525f},
-std::array<float,2>{0.228437871f, 0.185253397f},
-std::array<float,2>{0.698277354f, 0.837096572f},
-std::array<float,2>{0.589931488f, 0.0129680792f},
-std::array<float,2>{0.0079926271f, 0.908783317f},
-std::array<float,2>{0.311424226f, 0.373226106f},
-std::array<float,2>{0.835184038f, 0.523138106f},
-std::array<float,2>{0.675175667f, 0.281725258f},
-std::array<float,2>{0.156961232f, 0.567873776f},
-std::array<float,2>{0.384695381f, 0.0643283129f},
-std::array<float,2>{0.950146258f, 0.976245344f},
-std::array<float,2>{0.790369809f, 0.195000917f},
-std::array<float,2>{0.369294524f, 0.790391922f},
-std::array<float,2>{0.0869633257f, 0.472257167f},
-std::array<float,2>{0.55326122f, 0.652250051f},
-std::array<float,2>{0.859709978f, 0.321535975f},
-std::array<float,2>{0.254482597f, 0.555850863f},
-std::array<float,2>{0.0316824913f, 0.0375273414f},
-std::array<float,2>{0.609182894f, 0.901585042f},
-std::array<float,2>{0.719552338f, 0.150417522f},
-std::array<float,2>{0.201507092f, 0.871019602f},
-std::array<float,2>{0.463061035f, 0.40862596f},
-std::array<float,2>{0.890361249f, 0.742119133f},
-std::array<float,2>{0.520141244f, 0.463797033f},
-std::array<float,2>{0.112953529f, 0.682734072f},
-std::array<float,2>{0.332906842f, 0.236321777f},
-std::array<float,2>{0.769706726f, 0.780201972f},
-std::array<float,2>{0.990208447f, 0.118638486f},
-std::array<float,2>{0.409869134f, 0.944043875f},
-std::array<float,2>{0.131677836f, 0.280282855f},
-std::array<float,2>{0.651454031f, 0.59837985f},
-std::array<float,2>{0.755143285f, 0.497631103f},
-std::array<float,2>{0.318061858f, 0.626879752f},
-std::array<float,2>{0.0961953849f, 0.215823933f},
-std::array<float,2>{0.50996387f, 0.79972446f},
-std::array<float,2>{0.639851272f, 0.0786166117f},
-std::array<float,2>{0.155274987f, 0.994572699f},
-std::array<float,2>{0.42301771f, 0.308276802f},
-std::array<float,2>{0.974419355f, 0.589836359f},
-std::array<float,2>{0.620057344f, 0.352053642f},
-std::array<float,2>{0.0512618236f, 0.514161348f},
-std::array<float,2>{0.276339948f, 0.0288025346f},
-std::array<float,2>{0.855542243f, 0.922021866f},
-std::array<float,2>{0.902813375f, 0.167665154f},
-std::array<float,2>{0.438190818f, 0.826242924f},
-std::array<float,2>{0.212407157f, 0.378748745f},
-std::array<float,2>{0.740063667f, 0.71554482f},
-std::array<float,2>{0.960753739f, 0.25436455f},
-std::array<float,2>{0.40291813f, 0.624597251f},
-std::array<float,2>{0.176268756f, 0.103300735f},
-std::array<float,2>{0.660259545f, 0.96096009f},
-std::array<float,2>{0.540911317f, 0.23295109f},
-std::array<float,2>{0.0679900721f, 0.752485693f},
-std::array<float,2>{0.350534916f, 0.437802702f},
-std::array<float,2>{0.801694453f, 0.664916396f},
-std::array<float,2>{0.707265854f, 0.425442517f},
-std::array<float,2>{0.243795231f, 0.725667f},
-std::array<float,2>{0.497681826f, 0.137874633f},
-std::array<float,2>{0.907575309f, 0.847953677f},
-std::array<float,2>{0.827044904f, 0.049493514f},
-std::array<float,2>{0.288201511f, 0.88801229f},
-std::array<float,2>{0.0166470539f, 0.339868456f},
-std::array<float,2>{0.56560272f, 0.534013391f},
-std::array<float,2>{0.979895949f, 0.446076632f},
-std::array<float,2>{0.433003843f, 0.659616709f},
-std::array<float,2>{0.14178583f, 0.226133481f},
-std::array<float,2>{0.626001179f, 0.762173057f},
-std::array<float,2>{0.501172066f, 0.0966898873f},
-std::array<float,2>{0.107419424f, 0.959559619f},
-std::array<float,2>{0.326859474f, 0.260228008f},
-std::array<float,2>{0.760815144f, 0.611832559f},
-std::array<float,2>{0.747792184f, 0.329797029f},
-std::array<float,2>{0.206606969f, 0.54529345f},
-std::array<float,2>{0.450157076f, 0.0602101162f},
-std::array<float,2>{0.898001254f, 0.876984417f},
-std::array<float,2>{0.846020281f, 0.129561633f},
-std::array<float,2>{0.27336359f, 0.857055724f},
-std::array<float,2>{0.0547339208f, 0.431872666f},
-std::array<float,2>{0.610595763f, 0.730814159f},
-std::array<float,2>{0.805007577f, 0.299692065f},
-std::array<float,2>{0.352825969f, 0.580138743f},
-std::array<float,2>{0.0707729235f, 0.0897104517f},
-std::array<float,2>{0.53477335f, 0.98442477f},
-std::array<float,2>{0.670386434f, 0.208239257f},
-std::array<float,2>{0.186642483f, 0.811903775f},
-std::array<float,2>{0.392329484f, 0.484720439f},
-std::array<float,2>{0.968377292f, 0.638252139f},
-std::array<float,2>{0.577064991f, 0.383146852f},
-std::array<float,2>{0.0244907793f, 0.705302119f},
-std::array<float,2>{0.293046206f, 0.163224995f},
-std::array<float,2>{0.815689147f, 0.818610668f},
-std::array<float,2>{0.91790843f, 0.02132429f},
-std::array<float,2>{0.490521222f, 0.933810472f},
-std::array<float,2>{0.235862911f, 0.345737249f},
-std::array<float,2>{0.71851486f, 0.505846739f},
-std::array<float,2>{0.838464379f, 0.414716035f},
-std::array<float,2>{0.304430246f, 0.746858418f},
-std::array<float,2>{0.00404674374f, 0.146652922f},
-std::array<float,2>{0.580853999f, 0.866186082f},
-std::array<float,2>{0.691506088f, 0.045189023f},
-std::array<float,2>{0.220369235f, 0.897475064f},
-std::array<float,2>{0.468937069f, 0.317216814f},
-std::array<float,2>{0.926300526f, 0.547644615f},
-std::array<float,2>{0.560885787f, 0.270078748f},
-std::array<float,2>{0.0830527917f, 0.607663929f},
-std::array<float,2>{0.365180224f, 0.111846238f},
-std::array<float,2>{0.784668684f, 0.947269499f},
-std::array<float,2>{0.940846205f, 0.242685467f},
-std::array<float,2>{0.380893737f, 0.771295071f},
-std::array<float,2>{0.171028033f, 0.45633015f},
-std::array<float,2>{0.68372643f, 0.675279021f},
-std::array<float,2>{0.880939782f, 0.361768603f},
-std::array<float,2>{0.460908949f, 0.527472913f},
-std::array<float,2>{0.1914168f, 0.00482978718f},
-std::array<float,2>{0.730565131f, 0.918181717f},
-std::array<float,2>{0.597954512f, 0.171942994f},
-std::array<float,2>{0.0398866534f, 0.833173096f},
-std::array<float,2>{0.258705944f, 0.401511073f},
-std::array<float,2>{0.868452728f, 0.698684931f},
-std::array<float,2>{0.644221783f, 0.482327342f},
-std::array<float,2>{0.135840878f, 0.640951812f},
-std::array<float,2>{0.41476953f, 0.20058693f},
-std::array<float,2>{0.99952054f, 0.786560476f},
-std::array<float,2>{0.778333902f, 0.0732409284f},
-std::array<float,2>{0.338157743f, 0.981660903f},
-std::array<float,2>{0.119586796f, 0.291050106f},
-std::array<float,2>{0.530731201f, 0.575931847f},
-std::array<float,2>{0.920899451f, 0.465233415f},
-std::array<float,2>{0.485839486f, 0.685557306f},
-std::array<float,2>{0.240982115f, 0.241133198f},
-std::array<float,2>{0.711956561f, 0.773944974f},
-std::array<float,2>{0.571932733f, 0.122660384f},
-std::array<float,2>{0.0276184622f, 0.941210151f},
-std::array<float,2>{0.292094886f, 0.275667101f},
-std::array<float,2>{0.819983661f, 0.595824122f},
-std::array<float,2>{0.665468633f, 0.327246726f},
-std::array<float,2>{0.183144018f, 0.560483098f},
-std::array<float,2>{0.396642059f, 0.0320974551f},
-std::array<float,2>{0.964027882f, 0.904092669f},
-std::array<float,2>{0.809842885f, 0.152869537f},
-std::array<float,2>{0.357106328f, 0.873800516f},
-std::array<float,2>{0.0759228691f, 0.410418093f},
-std::array<float,2>{0.537045002f, 0.736672759f},
-std::array<float,2>{0.84774524f, 0.287484616f},
-std::array<float,2>{0.268937111f, 0.563120067f},
-std::array<float,2>{0.0586395487f, 0.0700917169f},
-std::array<float,2>{0.615186691f, 0.971238971f},
-std::array<float,2>{0.743312538f, 0.191119239f},
-std::array<float,2>{0.207717642f, 0.79544425f},
-std::array<float,2>{0.447730958f, 0.474358439f},
-std::array<float,2>{0.893799186f, 0.655873656f},
-std::array<float,2>{0.506572902f, 0.394833267f},
-std::array<float,2>{0.103340454f, 0.694577813f},
-std::array<float,2>{0.322770983f, 0.180333659f},
-std::array<float,2>{0.764434099f, 0.842529058f},
-std::array<float,2>{0.983640492f, 0.00806558039f},
-std::array<float,2>{0.43707779f, 0.91139406f},
-std::array<float,2>{0.147378668f, 0.368330896f},
-std::array<float,2>{0.629271686f, 0.516235948f},
-std::array<float,2>{0.774196446f, 0.426216364f},
-std::array<float,2>{0.34073329f, 0.718854666f},
-std::array<float,2>{0.122129671f, 0.136065021f},
-std::array<float,2>{0.524149716f, 0.844774246f},
-std::array<float,2>{0.644747674f, 0.054397516f},
-std::array<float,2>{0.139130488f, 0.883192837f},
-std::array<float,2>{0.41903463f, 0.336374342f},
-std::array<float,2>{0.993399441f, 0.53597939f},
-std::array<float,2>{0.594043493f, 0.252791256f},
-std::array<float,2>{0.0444552749f, 0.618701994f},
-std::array<float,2>{0.263389856f, 0.107511625f},
-std::array<float,2>{0.872237444f, 0.967312038f},
-std::array<float,2>{0.878407121f, 0.228350729f},
-std::array<float,2>{0.454407513f, 0.757521331f},
-std::array<float,2>{0.190399215f, 0.443610549f},
-std::array<float,2>{0.728623152f, 0.670743108f},
-std::array<float,2>{0.944791019f, 0.356432259f},
-std::array<float,2>{0.376265228f, 0.508884966f},
-std::array<float,2>{0.166361764f, 0.0238595847f},
-std::array<float,2>{0.682257056f, 0.928247035f},
-std::array<float,2>{0.556660414f, 0.169962838f},
-std::array<float,2>{0.0783710256f, 0.820364058f},
-std::array<float,2>{0.363110274f, 0.380743831f},
-std::array<float,2>{0.788153291f, 0.713113844f},
-std::array<float,2>{0.689787269f, 0.493668467f},
-std::array<float,2>{0.225702107f, 0.629873455f},
-std::array<float,2>{0.475008428f, 0.214767084f},
-std::array<float,2>{0.923797727f, 0.801020741f},
-std::array<float,2>{0.842339218f, 0.0826219246f},
-std::array<float,2>{0.299591184f, 0.999016583f},
-std::array<float,2>{0.00317331916f, 0.309026569f},
-std::array<float,2>{0.584143996f, 0.592016578f},
-std::array<float,2>{0.987522423f, 0.38726294f},
-std::array<float,2>{0.412006229f, 0.708529115f},
-std::array<float,2>{0.125839889f, 0.15774034f},
-std::array<float,2>{0.652730107f, 0.816108525f},
-std::array<float,2>{0.515905797f, 0.0164508615f},
-std::array<float,2>{0.114622094f, 0.932696819f},
-std::array<float,2>{0.329084367f, 0.349644959f},
-std::array<float,2>{0.767498374f, 0.503053427f},
-std::array<float,2>{0.723580301f, 0.302871138f},
-std::array<float,2>{0.19921194f, 0.582564533f},
-std::array<float,2>{0.466315359f, 0.0904621407f},
-std::array<float,2>{0.884119272f, 0.988569319f},
-std::array<float,2>{0.866768122f, 0.204697192f},
-std::array<float,2>{0.25125277f, 0.805551827f},
-std::array<float,2>{0.0374465212f, 0.488564998f},
-std::array<float,2>{0.602730095f, 0.636182368f},
-std::array<float,2>{0.795422375f, 0.332921594f},
-std::array<float,2>{0.374134123f, 0.542053044f},
-std::array<float,2>{0.0903248116f, 0.0576853789f},
-std::array<float,2>{0.547226727f, 0.879422963f},
-std::array<float,2>{0.677082062f, 0.128574938f},
-std::array<float,2>{0.162169889f, 0.854582131f},
-std::array<float,2>{0.388259292f, 0.437225252f},
-std::array<float,2>{0.945767045f, 0.728279948f},
-std::array<float,2>{0.589392841f, 0.449855655f},
-std::array<float,2>{0.0128120268f, 0.66071564f},
-std::array<float,2>{0.308159947f, 0.221625254f},
-std::array<float,2>{0.829318106f, 0.760729969f},
-std::array<float,2>{0.935301006f, 0.0994004309f},
-std::array<float,2>{0.481155932f, 0.954142928f},
-std::array<float,2>{0.23337841f, 0.263178885f},
-std::array<float,2>{0.700676382f, 0.615375459f},
-std::array<float,2>{0.823896348f, 0.477566302f},
-std::array<float,2>{0.28511253f, 0.64756161f},
-std::array<float,2>{0.0208302829f, 0.198139846f},
-std::array<float,2>{0.570197463f, 0.782942057f},
-std::array<float,2>{0.704865932f, 0.0780918896f},
-std::array<float,2>{0.246771008f, 0.977555692f},
-std::array<float,2>{0.492896855f, 0.29529801f},
-std::array<float,2>{0.911950111f, 0.573653579f},
-std::array<float,2>{0.543021202f, 0.366435826f},
-std::array<float,2>{0.0632804111f, 0.52358681f},
-std::array<float,2>{0.34594366f, 0.000787764147f},
-std::array<float,2>{0.798690856f, 0.91481173f},
-std::array<float,2>{0.955298722f, 0.176063418f},
-std::array<float,2>{0.401771873f, 0.831016719f},
-std::array<float,2>{0.175548315f, 0.404957056f},
-std::array<float,2>{0.659053981f, 0.701656699f},
-std::array<float,2>{0.899264634f, 0.269515485f},
-std::array<float,2>{0.44524157f, 0.602260292f},
-std::array<float,2>{0.218231454f, 0.115341f},
-std::array<float,2>{0.734775901f, 0.952013791f},
-std::array<float,2>{0.622804523f, 0.247451872f},
-std::array<float,2>{0.0484117121f, 0.76892364f},
-std::array<float,2>{0.277867734f, 0.458719075f},
-std::array<float,2>{0.852796257f, 0.678893626f},
-std::array<float,2>{0.636192262f, 0.419632167f},
-std::array<float,2>{0.150839329f, 0.74284184f},
-std::array<float,2>{0.426703215f, 0.144229859f},
-std::array<float,2>{0.971011698f, 0.86206758f},
-std::array<float,2>{0.750501156f, 0.0402279459f},
-std::array<float,2>{0.315136433f, 0.893159568f},
-std::array<float,2>{0.100627594f, 0.314353645f},
-std::array<float,2>{0.512175202f, 0.554218411f},
-std::array<float,2>{0.886855602f, 0.406550854f},
-std::array<float,2>{0.461046875f, 0.739385247f},
-std::array<float,2>{0.200887263f, 0.149955675f},
-std::array<float,2>{0.722391725f, 0.867466271f},
-std::array<float,2>{0.607209027f, 0.0360127985f},
-std::array<float,2>{0.0345071182f, 0.899157047f},
-std::array<float,2>{0.256389081f, 0.324080765f},
-std::array<float,2>{0.861848593f, 0.55797565f},
-std::array<float,2>{0.649463356f, 0.277826577f},
-std::array<float,2>{0.129063189f, 0.601331651f},
-std::array<float,2>{0.408038616f, 0.120621033f},
-std::array<float,2>{0.991987109f, 0.943331361f},
-std::array<float,2>{0.772633314f, 0.236613438f},
-std::array<float,2>{0.335900158f, 0.778583646f},
-std::array<float,2>{0.111212939f, 0.462393254f},
-std::array<float,2>{0.523035944f, 0.680037796f},
-std::array<float,2>{0.833640933f, 0.371368229f},
-std::array<float,2>{0.308809608f, 0.520763636f},
-std::array<float,2>{0.00987099297f, 0.0154625326f},
-std::array<float,2>{0.5922212f, 0.907879114f},
-std::array<float,2>{0.697153568f, 0.187320828f},
-std::array<float,2>{0.229732797f, 0.839106798f},
-std::array<float,2>{0.47853291f, 0.391650856f},
-std::array<float,2>{0.933411777f, 0.688397527f},
-std::array<float,2>{0.551828563f, 0.468997538f},
-std::array<float,2>{0.0894626826f, 0.648664176f},
-std::array<float,2>{0.368729442f, 0.193284959f},
-std::array<float,2>{0.792351544f, 0.792743325f},
-std::array<float,2>{0.951305211f, 0.0648638159f},
-std::array<float,2>{0.385306746f, 0.974051654f},
-std::array<float,2>{0.159254566f, 0.283820182f},
-std::array<float,2>{0.672684371f, 0.568936288f},
-std::array<float,2>{0.803443193f, 0.441208184f},
-std::array<float,2>{0.348286182f, 0.667471826f},
-std::array<float,2>{0.0694340244f, 0.230746925f},
-std::array<float,2>{0.542340815f, 0.751164675f},
-std::array<float,2>{0.663020909f, 0.104427837f},
-std::array<float,2>{0.178561345f, 0.963862002f},
-std::array<float,2>{0.405035526f, 0.256844878f},
-std::array<float,2>{0.958236814f, 0.621731997f},
-std::array<float,2>{0.564149499f, 0.342241436f},
-std::array<float,2>{0.0183504988f, 0.531309247f},
-std::array<float,2>{0.286965162f, 0.0487159826f},
-std::array<float,2>{0.825780869f, 0.8888641f},
-std::array<float,2>{0.909573615f, 0.139539734f},
-std::array<float,2>{0.499605983f, 0.850340605f},
-std::array<float,2>{0.245480567f, 0.423098564f},
-std::array<float,2>{0.710915089f, 0.724070966f},
-std::array<float,2>{0.976044357f, 0.306267977f},
-std::array<float,2>{0.425251871f, 0.586337984f},
-std::array<float,2>{0.152779579f, 0.0807798952f},
-std::array<float,2>{0.638134778f, 0.993696511f},
-std::array<float,2>{0.509113133f, 0.21815145f},
-std::array<float,2>{0.0943429321f, 0.797725677f},
-std::array<float,2>{0.319553941f, 0.498374909f},
-std::array<float,2>{0.75672251f, 0.628242791f},
-std::array<float,2>{0.74050796f, 0.376500249f},
-std::array<float,2>{0.212955579f, 0.717795074f},
-std::array<float,2>{0.441375136f, 0.164956793f},
-std::array<float,2>{0.904584289f, 0.825325668f},
-std::array<float,2>{0.857850194f, 0.0306522381f},
-std::array<float,2>{0.274982691f, 0.925585747f},
-std::array<float,2>{0.0539470762f, 0.354753792f},
-std::array<float,2>{0.617388606f, 0.512714326f},
-std::array<float,2>{0.966772377f, 0.487439245f},
-std::array<float,2>{0.393326044f, 0.639952004f},
-std::array<float,2>{0.184868872f, 0.210239142f},
-std::array<float,2>{0.669407845f, 0.809342802f},
-std::array<float,2>{0.531427443f, 0.0869416445f},
-std::array<float,2>{0.0730790198f, 0.988222897f},
-std::array<float,2>{0.355286628f, 0.297739238f},
-std::array<float,2>{0.807976425f, 0.579964399f},
-std::array<float,2>{0.715580642f, 0.3441149f},
-std::array<float,2>{0.237452582f, 0.505862892f},
-std::array<float,2>{0.488505274f, 0.0218423977f},
-std::array<float,2>{0.915321112f, 0.937491238f},
-std::array<float,2>{0.813153267f, 0.161950096f},
-std::array<float,2>{0.294968396f, 0.816634774f},
-std::array<float,2>{0.0268295631f, 0.3859137f},
-std::array<float,2>{0.574935377f, 0.704648554f},
-std::array<float,2>{0.758561611f, 0.259116441f},
-std::array<float,2>{0.324656874f, 0.611310244f},
-std::array<float,2>{0.108270839f, 0.0951292589f},
-std::array<float,2>{0.503595829f, 0.958956718f},
-std::array<float,2>{0.628152192f, 0.224093467f},
-std::array<float,2>{0.142979518f, 0.764701188f},
-std::array<float,2>{0.430022448f, 0.447742969f},
-std::array<float,2>{0.977073967f, 0.657720506f},
-std::array<float,2>{0.612120092f, 0.431136608f},
-std::array<float,2>{0.0577020086f, 0.732556224f},
-std::array<float,2>{0.270949274f, 0.131996721f},
-std::array<float,2>{0.845412254f, 0.858326972f},
-std::array<float,2>{0.895968854f, 0.0616961494f},
-std::array<float,2>{0.451338768f, 0.875559032f},
-std::array<float,2>{0.204870552f, 0.330663085f},
-std::array<float,2>{0.748383164f, 0.544605732f},
-std::array<float,2>{0.869791508f, 0.399238944f},
-std::array<float,2>{0.261433035f, 0.697137535f},
-std::array<float,2>{0.0424718037f, 0.175405085f},
-std::array<float,2>{0.600011051f, 0.83530426f},
-std::array<float,2>{0.73311609f, 0.00692011742f},
-std::array<float,2>{0.193893805f, 0.920800507f},
-std::array<float,2>{0.457613587f, 0.359998792f},
-std::array<float,2>{0.879012525f, 0.52995801f},
-std::array<float,2>{0.528949618f, 0.289616883f},
-std::array<float,2>{0.118633375f, 0.577119946f},
-std::array<float,2>{0.336006939f, 0.0713182986f},
-std::array<float,2>{0.779380977f, 0.984254777f},
-std::array<float,2>{0.997859538f, 0.202765122f},
-std::array<float,2>{0.416804075f, 0.788473427f},
-std::array<float,2>{0.133093759f, 0.482899934f},
-std::array<float,2>{0.641067743f, 0.643025875f},
-std::array<float,2>{0.929540515f, 0.31939587f},
-std::array<float,2>{0.470769346f, 0.54901123f},
-std::array<float,2>{0.222492799f, 0.0448464826f},
-std::array<float,2>{0.69519043f, 0.895076454f},
-std::array<float,2>{0.579442501f, 0.14533487f},
-std::array<float,2>{0.00770217599f, 0.864200175f},
-std::array<float,2>{0.301178843f, 0.417008281f},
-std::array<float,2>{0.837525129f, 0.748743355f},
-std::array<float,2>{0.686417758f, 0.454772711f},
-std::array<float,2>{0.16981712f, 0.672642231f},
-std::array<float,2>{0.380199581f, 0.244878173f},
-std::array<float,2>{0.93832171f, 0.771686018f},
-std::array<float,2>{0.782440484f, 0.110956006f},
-std::array<float,2>{0.366468281f, 0.945881844f},
-std::array<float,2>{0.0849105567f, 0.272349626f},
-std::array<float,2>{0.558948398f, 0.607305408f},
-std::array<float,2>{0.911250114f, 0.478832573f},
-std::array<float,2>{0.49250266f, 0.645111859f},
-std::array<float,2>{0.246552303f, 0.195370898f},
-std::array<float,2>{0.704583764f, 0.783349574f},
-std::array<float,2>{0.569562256f, 0.0751735941f},
-std::array<float,2>{0.0214270912f, 0.978543282f},
-std::array<float,2>{0.284291863f, 0.293701708f},
-std::array<float,2>{0.823282897f, 0.570926785f},
-std::array<float,2>{0.658322215f, 0.36370182f},
-std::array<float,2>{0.174879014f, 0.52563715f},
-std::array<float,2>{0.402153313f, 0.00237250538f},
-std::array<float,2>{0.955990016f, 0.917697728f},
-std::array<float,2>{0.79801178f, 0.179046199f},
-std::array<float,2>{0.346323639f, 0.828835607f},
-std::array<float,2>{0.0628596172f, 0.402549356f},
-std::array<float,2>{0.543474019f, 0.70090884f},
-std::array<float,2>{0.853343606f, 0.265671164f},
-std::array<float,2>{0.277585298f, 0.60514468f},
-std::array<float,2>{0.0480604358f, 0.114060946f},
-std::array<float,2>{0.622094512f, 0.950640619f},
-std::array<float,2>{0.735286832f, 0.248177156f},
-std::array<float,2>{0.218610242f, 0.765686512f},
-std::array<float,2>{0.444795996f, 0.460473657f},
-std::array<float,2>{0.898506045f, 0.677145064f},
-std::array<float,2>{0.512340546f, 0.42060405f},
-std::array<float,2>{0.10111405f, 0.745257318f},
-std::array<float,2>{0.31449002f, 0.14250356f},
-std::array<float,2>{0.750188947f, 0.860338807f},
-std::array<float,2>{0.97158885f, 0.0415131003f},
-std::array<float,2>{0.426171899f, 0.891879499f},
-std::array<float,2>{0.15124312f, 0.315452456f},
-std::array<float,2>{0.636707425f, 0.552234292f},
-std::array<float,2>{0.766689539f, 0.389602512f},
-std::array<float,2>{0.328369826f, 0.710174084f},
-std::array<float,2>{0.114933886f, 0.159149349f},
-std::array<float,2>{0.516454399f, 0.813072264f},
-std::array<float,2>{0.65308851f, 0.0186833125f},
-std::array<float,2>{0.125333816f, 0.930762053f},
-std::array<float,2>{0.411133558f, 0.348932594f},
-std::array<float,2>{0.988014817f, 0.501661599f},
-std::array<float,2>{0.603402019f, 0.301242292f},
-std::array<float,2>{0.0376793258f, 0.5842309f},
-std::array<float,2>{0.251586646f, 0.0925942287f},
-std::array<float,2>{0.866217196f, 0.991289198f},
-std::array<float,2>{0.884600818f, 0.206775367f},
-std::array<float,2>{0.466020942f, 0.808414936f},
-std::array<float,2>{0.19829528f, 0.490550458f},
-std::array<float,2>{0.722817242f, 0.633517146f},
-std::array<float,2>{0.9459216f, 0.335723639f},
-std::array<float,2>{0.387750328f, 0.539390802f},
-std::array<float,2>{0.162814066f, 0.0561491065f},
-std::array<float,2>{0.677716196f, 0.881036282f},
-std::array<float,2>{0.547777593f, 0.125341028f},
-std::array<float,2>{0.0906029716f, 0.852010965f},
-std::array<float,2>{0.374755502f, 0.433772475f},
-std::array<float,2>{0.794973493f, 0.729644418f},
-std::array<float,2>{0.700874746f, 0.452248305f},
-std::array<float,2>{0.232563406f, 0.664004982f},
-std::array<float,2>{0.480917156f, 0.219401836f},
-std::array<float,2>{0.934784174f, 0.759681702f},
-std::array<float,2>{0.829799533f, 0.0998862535f},
-std::array<float,2>{0.307733864f, 0.957011223f},
-std::array<float,2>{0.0134696681f, 0.264931917f},
-std::array<float,2>{0.589084268f, 0.614423275f},
-std::array<float,2>{0.993742347f, 0.429345846f},
-std::array<float,2>{0.419636011f, 0.721908808f},
-std::array<float,2>{0.139352754f, 0.133187085f},
-std::array<float,2>{0.645086765f, 0.847118855f},
-std::array<float,2>{0.523883164f, 0.0511318482f},
-std::array<float,2>{0.12288896f, 0.88572973f},
-std::array<float,2>{0.340121597f, 0.338698626f},
-std::array<float,2>{0.773441851f, 0.537227273f},
-std::array<float,2>{0.729364574f, 0.250439048f},
-std::array<float,2>{0.189821988f, 0.619235992f},
-std::array<float,2>{0.454755306f, 0.107055716f},
-std::array<float,2>{0.878905773f, 0.965705812f},
-std::array<float,2>{0.872603297f, 0.228957966f},
-std::array<float,2>{0.262751698f, 0.754950166f},
-std::array<float,2>{0.0442894213f, 0.441499025f},
-std::array<float,2>{0.594685733f, 0.668735683f},
-std::array<float,2>{0.788871586f, 0.35746789f},
-std::array<float,2>{0.362677395f, 0.509860516f},
-std::array<float,2>{0.07905972f, 0.0272210501f},
-std::array<float,2>{0.557487071f, 0.926670909f},
-std::array<float,2>{0.682021201f, 0.168916449f},
-std::array<float,2>{0.166853398f, 0.82372129f},
-std::array<float,2>{0.376556396f, 0.381739467f},
-std::array<float,2>{0.945166647f, 0.712019384f},
-std::array<float,2>{0.58491236f, 0.494832844f},
-std::array<float,2>{0.0038737338f, 0.632692456f},
-std::array<float,2>{0.298916906f, 0.212062955f},
-std::array<float,2>{0.842033565f, 0.803254366f},
-std::array<float,2>{0.923178375f, 0.0848776177f},
-std::array<float,2>{0.475200415f, 0.996928632f},
-std::array<float,2>{0.226106226f, 0.311613202f},
-std::array<float,2>{0.690289676f, 0.59057653f},
-std::array<float,2>{0.819401443f, 0.468692571f},
-std::array<float,2>{0.292861074f, 0.683660507f},
-std::array<float,2>{0.0280930195f, 0.238349572f},
-std::array<float,2>{0.571693063f, 0.777007937f},
-std::array<float,2>{0.712513804f, 0.124584205f},
-std::array<float,2>{0.240506321f, 0.938467622f},
-std::array<float,2>{0.486285955f, 0.273739934f},
-std::array<float,2>{0.921442211f, 0.59455961f},
-std::array<float,2>{0.536445379f, 0.325583994f},
-std::array<float,2>{0.0753768906f, 0.562313974f},
-std::array<float,2>{0.356787443f, 0.0341796316f},
-std::array<float,2>{0.81033814f, 0.905183911f},
-std::array<float,2>{0.964524508f, 0.155731171f},
-std::array<float,2>{0.397206426f, 0.872556984f},
-std::array<float,2>{0.182856858f, 0.412342221f},
-std::array<float,2>{0.665836453f, 0.736243367f},
-std::array<float,2>{0.894049704f, 0.286503643f},
-std::array<float,2>{0.448184788f, 0.566289604f},
-std::array<float,2>{0.207411438f, 0.0669139996f},
-std::array<float,2>{0.743963957f, 0.968908548f},
-std::array<float,2>{0.61456567f, 0.189088628f},
-std::array<float,2>{0.0595341697f, 0.794469714f},
-std::array<float,2>{0.269149452f, 0.476311564f},
-std::array<float,2>{0.848352373f, 0.6541906f},
-std::array<float,2>{0.629487455f, 0.397911966f},
-std::array<float,2>{0.146819457f, 0.693177044f},
-std::array<float,2>{0.436990231f, 0.183569074f},
-std::array<float,2>{0.983898044f, 0.841686487f},
-std::array<float,2>{0.763785362f, 0.0107109332f},
-std::array<float,2>{0.322753191f, 0.913815677f},
-std::array<float,2>{0.102653727f, 0.369157851f},
-std::array<float,2>{0.506063342f, 0.519357026f},
-std::array<float,2>{0.879500985f, 0.40193516f},
-std::array<float,2>{0.457287848f, 0.698931158f},
-std::array<float,2>{0.193436086f, 0.172416687f},
-std::array<float,2>{0.732571065f, 0.833560288f},
-std::array<float,2>{0.600434542f, 0.00418061251f},
-std::array<float,2>{0.0424972922f, 0.918512404f},
-std::array<float,2>{0.260745257f, 0.362137914f},
-std::array<float,2>{0.869535446f, 0.528157473f},
-std::array<float,2>{0.641492009f, 0.291623414f},
-std::array<float,2>{0.133633211f, 0.57543546f},
-std::array<float,2>{0.416343331f, 0.072471723f},
-std::array<float,2>{0.99744153f, 0.98212862f},
-std::array<float,2>{0.779929698f, 0.200817555f},
-std::array<float,2>{0.336904377f, 0.786955059f},
-std::array<float,2>{0.118976206f, 0.481875092f},
-std::array<float,2>{0.528530836f, 0.641232014f},
-std::array<float,2>{0.837300718f, 0.316600651f},
-std::array<float,2>{0.301423788f, 0.547322273f},
-std::array<float,2>{0.00688903779f, 0.0456520319f},
-std::array<float,2>{0.579886198f, 0.898302078f},
-std::array<float,2>{0.694357097f, 0.147457778f},
-std::array<float,2>{0.221834496f, 0.865555048f},
-std::array<float,2>{0.471257061f, 0.41415751f},
-std::array<float,2>{0.928811252f, 0.746569872f},
-std::array<float,2>{0.559390545f, 0.456804603f},
-std::array<float,2>{0.0840736628f, 0.675298512f},
-std::array<float,2>{0.367006093f, 0.242265508f},
-std::array<float,2>{0.782910824f, 0.770579457f},
-std::array<float,2>{0.937935948f, 0.111338921f},
-std::array<float,2>{0.380531162f, 0.948055148f},
-std::array<float,2>{0.16895245f, 0.269729048f},
-std::array<float,2>{0.685707688f, 0.607968986f},
-std::array<float,2>{0.808358729f, 0.485351115f},
-std::array<float,2>{0.354494303f, 0.637999058f},
-std::array<float,2>{0.07252267f, 0.208557859f},
-std::array<float,2>{0.532090425f, 0.812051892f},
-std::array<float,2>{0.669752359f, 0.0892628133f},
-std::array<float,2>{0.185122445f, 0.985062838f},
-std::array<float,2>{0.392832905f, 0.299269289f},
-std::array<float,2>{0.965875983f, 0.580925524f},
-std::array<float,2>{0.574302197f, 0.346222699f},
-std::array<float,2>{0.0271326471f, 0.505228043f},
-std::array<float,2>{0.295627177f, 0.0207684115f},
-std::array<float,2>{0.812768698f, 0.934262156f},
-std::array<float,2>{0.915918171f, 0.163995668f},
-std::array<float,2>{0.488882512f, 0.819099009f},
-std::array<float,2>{0.238207221f, 0.383588374f},
-std::array<float,2>{0.715244591f, 0.705789089f},
-std::array<float,2>{0.97677654f, 0.260425925f},
-std::array<float,2>{0.430662245f, 0.611461341f},
-std::array<float,2>{0.143539637f, 0.0973861292f},
-std::array<float,2>{0.628462017f, 0.959007263f},
-std::array<float,2>{0.503226995f, 0.225962579f},
-std::array<float,2>{0.107461482f, 0.762328327f},
-std::array<float,2>{0.324849069f, 0.445754707f},
-std::array<float,2>{0.758037031f, 0.659929156f},
-std::array<float,2>{0.748831868f, 0.432141393f},
-std::array<float,2>{0.204365507f, 0.73099637f},
-std::array<float,2>{0.451665103f, 0.129369602f},
-std::array<float,2>{0.896413565f, 0.856652379f},
-std::array<float,2>{0.844975471f, 0.0597814657f},
-std::array<float,2>{0.271412641f, 0.877880037f},
-std::array<float,2>{0.0581925176f, 0.329463661f},
-std::array<float,2>{0.611673713f, 0.54568857f},
-std::array<float,2>{0.958771229f, 0.438333809f},
-std::array<float,2>{0.404621094f, 0.664312065f},
-std::array<float,2>{0.177881449f, 0.232531935f},
-std::array<float,2>{0.662116349f, 0.752381504f},
-std::array<float,2>{0.542801023f, 0.10283117f},
-std::array<float,2>{0.0700246766f, 0.96166712f},
-std::array<float,2>{0.347867012f, 0.254466325f},
-std::array<float,2>{0.803016484f, 0.624121189f},
-std::array<float,2>{0.710149705f, 0.34062919f},
-std::array<float,2>{0.245875016f, 0.533671796f},
-std::array<float,2>{0.499277562f, 0.04927608f},
-std::array<float,2>{0.910023868f, 0.88856709f},
-std::array<float,2>{0.825223029f, 0.138274431f},
-std::array<float,2>{0.286289901f, 0.848541796f},
-std::array<float,2>{0.0176855698f, 0.425044954f},
-std::array<float,2>{0.563824356f, 0.726374924f},
-std::array<float,2>{0.756144106f, 0.307910055f},
-std::array<float,2>{0.319972813f, 0.589045167f},
-std::array<float,2>{0.0940358937f, 0.0783779472f},
-std::array<float,2>{0.509499788f, 0.995046258f},
-std::array<float,2>{0.638258636f, 0.216559961f},
-std::array<float,2>{0.153167322f, 0.79900533f},
-std::array<float,2>{0.425610751f, 0.497080028f},
-std::array<float,2>{0.976182163f, 0.626447976f},
-std::array<float,2>{0.617748618f, 0.378223926f},
-std::array<float,2>{0.0545205995f, 0.714893222f},
-std::array<float,2>{0.274767071f, 0.167262793f},
-std::array<float,2>{0.858017683f, 0.826912701f},
-std::array<float,2>{0.904890418f, 0.0290044658f},
-std::array<float,2>{0.440833598f, 0.922578871f},
-std::array<float,2>{0.213605896f, 0.351573974f},
-std::array<float,2>{0.74105674f, 0.513826132f},
-std::array<float,2>{0.861446679f, 0.408859104f},
-std::array<float,2>{0.256078839f, 0.741612196f},
-std::array<float,2>{0.0349564999f, 0.151229069f},
-std::array<float,2>{0.606487691f, 0.870556891f},
-std::array<float,2>{0.722132921f, 0.0376875661f},
-std::array<float,2>{0.200387552f, 0.902183115f},
-std::array<float,2>{0.461450547f, 0.321850866f},
-std::array<float,2>{0.887688637f, 0.556525409f},
-std::array<float,2>{0.522875309f, 0.28079024f},
-std::array<float,2>{0.110371917f, 0.59775883f},
-std::array<float,2>{0.335148722f, 0.11875847f},
-std::array<float,2>{0.773170114f, 0.943701863f},
-std::array<float,2>{0.991470933f, 0.235408738f},
-std::array<float,2>{0.407513559f, 0.779481232f},
-std::array<float,2>{0.129424572f, 0.463350803f},
-std::array<float,2>{0.650359273f, 0.683174491f},
-std::array<float,2>{0.932846129f, 0.373954892f},
-std::array<float,2>{0.47902742f, 0.522531927f},
-std::array<float,2>{0.230288342f, 0.0135507062f},
-std::array<float,2>{0.696521223f, 0.908631325f},
-std::array<float,2>{0.592359126f, 0.184945896f},
-std::array<float,2>{0.0106575741f, 0.837450385f},
-std::array<float,2>{0.309551239f, 0.393329829f},
-std::array<float,2>{0.833444059f, 0.689520299f},
-std::array<float,2>{0.672061861f, 0.471756101f},
-std::array<float,2>{0.160138175f, 0.651616752f},
-std::array<float,2>{0.384874731f, 0.194597796f},
-std::array<float,2>{0.951839328f, 0.790841877f},
-std::array<float,2>{0.792731166f, 0.0638932958f},
-std::array<float,2>{0.368328899f, 0.976051271f},
-std::array<float,2>{0.0891243592f, 0.28194046f},
-std::array<float,2>{0.552386582f, 0.567613959f},
-std::array<float,2>{0.901024818f, 0.45812124f},
-std::array<float,2>{0.441443056f, 0.679251611f},
-std::array<float,2>{0.216645509f, 0.247740924f},
-std::array<float,2>{0.736343801f, 0.769407094f},
-std::array<float,2>{0.623475969f, 0.116182975f},
-std::array<float,2>{0.0492599085f, 0.951224625f},
-std::array<float,2>{0.280572444f, 0.268841714f},
-std::array<float,2>{0.855200946f, 0.601926863f},
-std::array<float,2>{0.633079827f, 0.31394884f},
-std::array<float,2>{0.149520263f, 0.554062665f},
-std::array<float,2>{0.428038657f, 0.0405846871f},
-std::array<float,2>{0.96917212f, 0.892924368f},
-std::array<float,2>{0.752132654f, 0.143870175f},
-std::array<float,2>{0.31291461f, 0.86142087f},
-std::array<float,2>{0.0978571996f, 0.419269502f},
-std::array<float,2>{0.514963567f, 0.74253875f},
-std::array<float,2>{0.820346177f, 0.295510173f},
-std::array<float,2>{0.281473219f, 0.573939562f},
-std::array<float,2>{0.0220627878f, 0.0772440359f},
-std::array<float,2>{0.568113148f, 0.978235066f},
-std::array<float,2>{0.706334114f, 0.197592989f},
-std::array<float,2>{0.248944566f, 0.782488286f},
-std::array<float,2>{0.494862825f, 0.478045911f},
-std::array<float,2>{0.913618088f, 0.648054242f},
-std::array<float,2>{0.545455992f, 0.404426873f},
-std::array<float,2>{0.0648529902f, 0.70212245f},
-std::array<float,2>{0.344138056f, 0.176746696f},
-std::array<float,2>{0.799709558f, 0.830149531f},
-std::array<float,2>{0.954737902f, 0.000298504485f},
-std::array<float,2>{0.400152951f, 0.9142223f},
-std::array<float,2>{0.171884015f, 0.367016464f},
-std::array<float,2>{0.656299949f, 0.523982167f},
-std::array<float,2>{0.794683337f, 0.436630666f},
-std::array<float,2>{0.371565878f, 0.727692008f},
-std::array<float,2>{0.0934181362f, 0.127978683f},
-std::array<float,2>{0.549075484f, 0.855260551f},
-std::array<float,2>{0.678454399f, 0.0584067591f},
-std::array<float,2>{0.160800591f, 0.878993213f},
-std::array<float,2>{0.389236391f, 0.33246541f},
-std::array<float,2>{0.948204517f, 0.542890251f},
-std::array<float,2>{0.587740183f, 0.263289809f},
-std::array<float,2>{0.0141334347f, 0.615926325f},
-std::array<float,2>{0.306163311f, 0.0987367854f},
-std::array<float,2>{0.83032304f, 0.954966784f},
-std::array<float,2>{0.936219513f, 0.220928043f},
-std::array<float,2>{0.483631849f, 0.759949148f},
-std::array<float,2>{0.230477497f, 0.449234456f},
-std::array<float,2>{0.702880919f, 0.66038692f},
-std::array<float,2>{0.985838771f, 0.350387096f},
-std::array<float,2>{0.413526088f, 0.503792226f},
-std::array<float,2>{0.127040133f, 0.0159240067f},
-std::array<float,2>{0.654549181f, 0.933362544f},
-std::array<float,2>{0.518214762f, 0.157575712f},
-std::array<float,2>{0.116742127f, 0.815787315f},
-std::array<float,2>{0.33033964f, 0.387026459f},
-std::array<float,2>{0.767756224f, 0.708354652f},
-std::array<float,2>{0.726399541f, 0.489015222f},
-std::array<float,2>{0.195457235f, 0.636533976f},
-std::array<float,2>{0.4679133f, 0.204131976f},
-std::array<float,2>{0.886708677f, 0.805130541f},
-std::array<float,2>{0.865233302f, 0.0899131522f},
-std::array<float,2>{0.253540128f, 0.989193141f},
-std::array<float,2>{0.036421001f, 0.30362615f},
-std::array<float,2>{0.603898168f, 0.58244884f},
-std::array<float,2>{0.943066835f, 0.380342484f},
-std::array<float,2>{0.377702802f, 0.713683784f},
-std::array<float,2>{0.165111631f, 0.170496583f},
-std::array<float,2>{0.681263983f, 0.821159482f},
-std::array<float,2>{0.55602622f, 0.0242915843f},
-std::array<float,2>{0.0801100805f, 0.928196073f},
-std::array<float,2>{0.359727889f, 0.355856925f},
-std::array<float,2>{0.786482632f, 0.509401143f},
-std::array<float,2>{0.688708484f, 0.309103608f},
-std::array<float,2>{0.223597795f, 0.592462003f},
-std::array<float,2>{0.474221796f, 0.0824301466f},
-std::array<float,2>{0.924814999f, 0.998400092f},
-std::array<float,2>{0.840599418f, 0.214086503f},
-std::array<float,2>{0.296988875f, 0.80147773f},
-std::array<float,2>{0.00106368447f, 0.493478864f},
-std::array<float,2>{0.582651317f, 0.629284263f},
-std::array<float,2>{0.776779711f, 0.336433083f},
-std::array<float,2>{0.342121035f, 0.535267174f},
-std::array<float,2>{0.123654455f, 0.0539767183f},
-std::array<float,2>{0.526038051f, 0.883684754f},
-std::array<float,2>{0.647158146f, 0.136354387f},
-std::array<float,2>{0.137820348f, 0.845653594f},
-std::array<float,2>{0.420191437f, 0.426539093f},
-std::array<float,2>{0.995849311f, 0.719450831f},
-std::array<float,2>{0.595967591f, 0.444161862f},
-std::array<float,2>{0.0463174656f, 0.670017362f},
-std::array<float,2>{0.264941514f, 0.227588981f},
-std::array<float,2>{0.874942541f, 0.757186592f},
-std::array<float,2>{0.876596212f, 0.108028188f},
-std::array<float,2>{0.456652582f, 0.967063427f},
-std::array<float,2>{0.187990382f, 0.252122521f},
-std::array<float,2>{0.728298545f, 0.618447363f},
-std::array<float,2>{0.850628555f, 0.473665446f},
-std::array<float,2>{0.266886383f, 0.655360818f},
-std::array<float,2>{0.0622671843f, 0.190748051f},
-std::array<float,2>{0.615321875f, 0.795198441f},
-std::array<float,2>{0.745075762f, 0.0696325228f},
-std::array<float,2>{0.210466817f, 0.970906496f},
-std::array<float,2>{0.446606994f, 0.287872314f},
-std::array<float,2>{0.892420769f, 0.562846303f},
-std::array<float,2>{0.505810082f, 0.368681937f},
-std::array<float,2>{0.10540133f, 0.516030848f},
-std::array<float,2>{0.32057637f, 0.00864582416f},
-std::array<float,2>{0.762251198f, 0.911643982f},
-std::array<float,2>{0.981377304f, 0.180055544f},
-std::array<float,2>{0.434891284f, 0.841831326f},
-std::array<float,2>{0.145720944f, 0.395239234f},
-std::array<float,2>{0.631467581f, 0.695215166f},
-std::array<float,2>{0.918368816f, 0.275961012f},
-std::array<float,2>{0.486960769f, 0.596663475f},
-std::array<float,2>{0.239815041f, 0.122548617f},
-std::array<float,2>{0.714348614f, 0.940870047f},
-std::array<float,2>{0.572614431f, 0.240558222f},
-std::array<float,2>{0.0302257668f, 0.773542285f},
-std::array<float,2>{0.290480882f, 0.465561211f},
-std::array<float,2>{0.817492008f, 0.686139107f},
-std::array<float,2>{0.666970849f, 0.410940468f},
-std::array<float,2>{0.181567028f, 0.736856341f},
-std::array<float,2>{0.395480156f, 0.152693287f},
-std::array<float,2>{0.960985661f, 0.873508513f},
-std::array<float,2>{0.812478542f, 0.0316632949f},
-std::array<float,2>{0.35870555f, 0.903780758f},
-std::array<float,2>{0.0767625794f, 0.327857822f},
-std::array<float,2>{0.53878206f, 0.559740663f},
-std::array<float,2>{0.92588377f, 0.41774267f},
-std::array<float,2>{0.469507456f, 0.748097301f},
-std::array<float,2>{0.220200583f, 0.144896999f},
-std::array<float,2>{0.691939116f, 0.863559544f},
-std::array<float,2>{0.580206394f, 0.0440510772f},
-std::array<float,2>{0.00485779392f, 0.894809008f},
-std::array<float,2>{0.303922892f, 0.320194364f},
-std::array<float,2>{0.838218212f, 0.549753964f},
-std::array<float,2>{0.684396505f, 0.271559566f},
-std::array<float,2>{0.17157732f, 0.60675633f},
-std::array<float,2>{0.381693035f, 0.110717058f},
-std::array<float,2>{0.941073f, 0.945744216f},
-std::array<float,2>{0.784412622f, 0.244263485f},
-std::array<float,2>{0.364350468f, 0.772201061f},
-std::array<float,2>{0.083714895f, 0.454129815f},
-std::array<float,2>{0.561117709f, 0.672279f},
-std::array<float,2>{0.868858397f, 0.359495908f},
-std::array<float,2>{0.257877111f, 0.529330373f},
-std::array<float,2>{0.0395037942f, 0.00768100983f},
-std::array<float,2>{0.598410845f, 0.920226693f},
-std::array<float,2>{0.731021941f, 0.175075904f},
-std::array<float,2>{0.192184582f, 0.835670769f},
-std::array<float,2>{0.460321099f, 0.39886117f},
-std::array<float,2>{0.881672859f, 0.696312249f},
-std::array<float,2>{0.531195104f, 0.483392447f},
-std::array<float,2>{0.120117009f, 0.643469751f},
-std::array<float,2>{0.338729739f, 0.202328607f},
-std::array<float,2>{0.779080749f, 0.78866303f},
-std::array<float,2>{0.999262571f, 0.0718533024f},
-std::array<float,2>{0.414170235f, 0.983413994f},
-std::array<float,2>{0.136550024f, 0.289368749f},
-std::array<float,2>{0.643878102f, 0.576516628f},
-std::array<float,2>{0.761689007f, 0.44792974f},
-std::array<float,2>{0.326526403f, 0.657436907f},
-std::array<float,2>{0.106824651f, 0.224374816f},
-std::array<float,2>{0.501754344f, 0.765365183f},
-std::array<float,2>{0.626676977f, 0.0956958979f},
-std::array<float,2>{0.142148957f, 0.958320558f},
-std::array<float,2>{0.433268756f, 0.259682864f},
-std::array<float,2>{0.980033457f, 0.610537946f},
-std::array<float,2>{0.610978365f, 0.330226809f},
-std::array<float,2>{0.0553022549f, 0.544370115f},
-std::array<float,2>{0.272562474f, 0.0620181076f},
-std::array<float,2>{0.846451819f, 0.875018179f},
-std::array<float,2>{0.897616327f, 0.132802084f},
-std::array<float,2>{0.449463457f, 0.857485116f},
-std::array<float,2>{0.20641391f, 0.43153742f},
-std::array<float,2>{0.747497499f, 0.733382165f},
-std::array<float,2>{0.967810214f, 0.297331482f},
-std::array<float,2>{0.391851336f, 0.579440117f},
-std::array<float,2>{0.187465936f, 0.0878761783f},
-std::array<float,2>{0.670741916f, 0.987741172f},
-std::array<float,2>{0.534368873f, 0.210820049f},
-std::array<float,2>{0.0712055489f, 0.808631301f},
-std::array<float,2>{0.353236675f, 0.487854749f},
-std::array<float,2>{0.805559039f, 0.640365839f},
-std::array<float,2>{0.718101799f, 0.386473715f},
-std::array<float,2>{0.235358715f, 0.704119205f},
-std::array<float,2>{0.490896732f, 0.161534369f},
-std::array<float,2>{0.917141199f, 0.817075431f},
-std::array<float,2>{0.815922916f, 0.0221868865f},
-std::array<float,2>{0.293842942f, 0.936694622f},
-std::array<float,2>{0.025327161f, 0.344539404f},
-std::array<float,2>{0.576564848f, 0.50646323f},
-std::array<float,2>{0.9739663f, 0.498762131f},
-std::array<float,2>{0.423628211f, 0.628884077f},
-std::array<float,2>{0.155815929f, 0.218596175f},
-std::array<float,2>{0.640325606f, 0.796979249f},
-std::array<float,2>{0.51043731f, 0.080097802f},
-std::array<float,2>{0.0958356708f, 0.993300855f},
-std::array<float,2>{0.317655206f, 0.305711508f},
-std::array<float,2>{0.755431235f, 0.586770654f},
-std::array<float,2>{0.739588916f, 0.355373532f},
-std::array<float,2>{0.212101206f, 0.513491392f},
-std::array<float,2>{0.437531471f, 0.0309489053f},
-std::array<float,2>{0.902834713f, 0.92526406f},
-std::array<float,2>{0.856324315f, 0.164317995f},
-std::array<float,2>{0.275626779f, 0.825696409f},
-std::array<float,2>{0.0516211018f, 0.376392931f},
-std::array<float,2>{0.619248509f, 0.718274772f},
-std::array<float,2>{0.801195145f, 0.25768137f},
-std::array<float,2>{0.349886745f, 0.621519744f},
-std::array<float,2>{0.0674073622f, 0.10394983f},
-std::array<float,2>{0.540116549f, 0.963142693f},
-std::array<float,2>{0.660745323f, 0.231013447f},
-std::array<float,2>{0.176295698f, 0.751801014f},
-std::array<float,2>{0.40245387f, 0.440723628f},
-std::array<float,2>{0.960075557f, 0.667544425f},
-std::array<float,2>{0.56633544f, 0.423721492f},
-std::array<float,2>{0.0173957273f, 0.724195063f},
-std::array<float,2>{0.288727254f, 0.139127806f},
-std::array<float,2>{0.826424122f, 0.849994123f},
-std::array<float,2>{0.907839596f, 0.0480453558f},
-std::array<float,2>{0.497321457f, 0.889328003f},
-std::array<float,2>{0.2434953f, 0.342404664f},
-std::array<float,2>{0.70793736f, 0.531962752f},
-std::array<float,2>{0.835774004f, 0.392202765f},
-std::array<float,2>{0.310599238f, 0.687657535f},
-std::array<float,2>{0.00842004456f, 0.186790273f},
-std::array<float,2>{0.590438068f, 0.839505136f},
-std::array<float,2>{0.698800325f, 0.0150913307f},
-std::array<float,2>{0.227591485f, 0.907353282f},
-std::array<float,2>{0.477945864f, 0.371582091f},
-std::array<float,2>{0.930981159f, 0.521402419f},
-std::array<float,2>{0.552894413f, 0.283245176f},
-std::array<float,2>{0.0876189172f, 0.568413556f},
-std::array<float,2>{0.370102465f, 0.0651817694f},
-std::array<float,2>{0.790664673f, 0.974577308f},
-std::array<float,2>{0.94949168f, 0.192547947f},
-std::array<float,2>{0.38410598f, 0.792399526f},
-std::array<float,2>{0.156685725f, 0.469409466f},
-std::array<float,2>{0.675655186f, 0.649246633f},
-std::array<float,2>{0.889835f, 0.323398232f},
-std::array<float,2>{0.46361056f, 0.558452368f},
-std::array<float,2>{0.201942682f, 0.0352709815f},
-std::array<float,2>{0.719044626f, 0.898907781f},
-std::array<float,2>{0.608430803f, 0.149711058f},
-std::array<float,2>{0.0317690969f, 0.868021071f},
-std::array<float,2>{0.254133075f, 0.407155305f},
-std::array<float,2>{0.859958231f, 0.739898801f},
-std::array<float,2>{0.652025878f, 0.46251604f},
-std::array<float,2>{0.130946383f, 0.680299282f},
-std::array<float,2>{0.409275413f, 0.237168178f},
-std::array<float,2>{0.989527345f, 0.779291511f},
-std::array<float,2>{0.770328104f, 0.120262891f},
-std::array<float,2>{0.332501024f, 0.942685843f},
-std::array<float,2>{0.112578534f, 0.278233021f},
-std::array<float,2>{0.519803405f, 0.600778997f},
-std::array<float,2>{0.885306478f, 0.491230369f},
-std::array<float,2>{0.467558324f, 0.634508669f},
-std::array<float,2>{0.196977288f, 0.205490306f},
-std::array<float,2>{0.725305557f, 0.807587028f},
-std::array<float,2>{0.604911625f, 0.0928106904f},
-std::array<float,2>{0.0352197699f, 0.990621924f},
-std::array<float,2>{0.25197053f, 0.302022964f},
-std::array<float,2>{0.863465071f, 0.585521877f},
-std::array<float,2>{0.65599072f, 0.348471701f},
-std::array<float,2>{0.128175437f, 0.500518084f},
-std::array<float,2>{0.41293937f, 0.0180974267f},
-std::array<float,2>{0.984534204f, 0.929977477f},
-std::array<float,2>{0.769321561f, 0.159851789f},
-std::array<float,2>{0.331766546f, 0.813684881f},
-std::array<float,2>{0.115440942f, 0.390375525f},
-std::array<float,2>{0.519484818f, 0.709796786f},
-std::array<float,2>{0.831359863f, 0.264594227f},
-std::array<float,2>{0.305627644f, 0.614216805f},
-std::array<float,2>{0.0149208019f, 0.100759998f},
-std::array<float,2>{0.586646676f, 0.955599785f},
-std::array<float,2>{0.701808512f, 0.220009089f},
-std::array<float,2>{0.232387289f, 0.757959485f},
-std::array<float,2>{0.482455671f, 0.451761782f},
-std::array<float,2>{0.937385798f, 0.662298858f},
-std::array<float,2>{0.549900472f, 0.43521452f},
-std::array<float,2>{0.0926071405f, 0.728812277f},
-std::array<float,2>{0.372231215f, 0.126269296f},
-std::array<float,2>{0.793928862f, 0.852575958f},
-std::array<float,2>{0.948708236f, 0.0550014749f},
-std::array<float,2>{0.390469819f, 0.882309556f},
-std::array<float,2>{0.162040502f, 0.334838539f},
-std::array<float,2>{0.67957896f, 0.540267229f},
-std::array<float,2>{0.80027771f, 0.403599173f},
-std::array<float,2>{0.34513694f, 0.69927913f},
-std::array<float,2>{0.0662541017f, 0.177840665f},
-std::array<float,2>{0.546585083f, 0.829908669f},
-std::array<float,2>{0.657746732f, 0.00315716886f},
-std::array<float,2>{0.173085704f, 0.91621685f},
-std::array<float,2>{0.399324566f, 0.364943564f},
-std::array<float,2>{0.953245878f, 0.526398838f},
-std::array<float,2>{0.566831291f, 0.294921696f},
-std::array<float,2>{0.0227881894f, 0.5718683f},
-std::array<float,2>{0.282685101f, 0.075618431f},
-std::array<float,2>{0.821289897f, 0.980182052f},
-std::array<float,2>{0.9129076f, 0.197262079f},
-std::array<float,2>{0.496017307f, 0.784559071f},
-std::array<float,2>{0.249033511f, 0.480316997f},
-std::array<float,2>{0.705850184f, 0.645974338f},
-std::array<float,2>{0.969967961f, 0.314613312f},
-std::array<float,2>{0.42881757f, 0.550875425f},
-std::array<float,2>{0.148762107f, 0.0425701439f},
-std::array<float,2>{0.634030581f, 0.891515017f},
-std::array<float,2>{0.51368016f, 0.140683487f},
-std::array<float,2>{0.099389933f, 0.860650361f},
-std::array<float,2>{0.314033538f, 0.421265692f},
-std::array<float,2>{0.75375998f, 0.744454503f},
-std::array<float,2>{0.737342119f, 0.459020406f},
-std::array<float,2>{0.215383172f, 0.676686347f},
-std::array<float,2>{0.442426324f, 0.249606028f},
-std::array<float,2>{0.901688218f, 0.766788065f},
-std::array<float,2>{0.854353487f, 0.114606462f},
-std::array<float,2>{0.279961735f, 0.949258745f},
-std::array<float,2>{0.0501249433f, 0.26688382f},
-std::array<float,2>{0.624827981f, 0.603838801f},
-std::array<float,2>{0.962040782f, 0.413753182f},
-std::array<float,2>{0.395938933f, 0.734434068f},
-std::array<float,2>{0.179810941f, 0.154436454f},
-std::array<float,2>{0.667449117f, 0.871854544f},
-std::array<float,2>{0.537712216f, 0.034784738f},
-std::array<float,2>{0.0772104636f, 0.905522048f},
-std::array<float,2>{0.357791811f, 0.324550718f},
-std::array<float,2>{0.811439693f, 0.560574949f},
-std::array<float,2>{0.71365279f, 0.275035053f},
-std::array<float,2>{0.238628507f, 0.594748497f},
-std::array<float,2>{0.488093197f, 0.123687111f},
-std::array<float,2>{0.91939646f, 0.93853271f},
-std::array<float,2>{0.81661737f, 0.239878595f},
-std::array<float,2>{0.289163738f, 0.775778115f},
-std::array<float,2>{0.0305681527f, 0.466939509f},
-std::array<float,2>{0.573316276f, 0.685312808f},
-std::array<float,2>{0.763474584f, 0.370986998f},
-std::array<float,2>{0.321790308f, 0.518060088f},
-std::array<float,2>{0.103682905f, 0.0107959071f},
-std::array<float,2>{0.504432559f, 0.912788033f},
-std::array<float,2>{0.632484674f, 0.182159975f},
-std::array<float,2>{0.14466238f, 0.840528965f},
-std::array<float,2>{0.434520602f, 0.396530271f},
-std::array<float,2>{0.98221153f, 0.692172766f},
-std::array<float,2>{0.616404772f, 0.475511104f},
-std::array<float,2>{0.0611056983f, 0.652904153f},
-std::array<float,2>{0.266148388f, 0.187717557f},
-std::array<float,2>{0.850031137f, 0.793576241f},
-std::array<float,2>{0.891038597f, 0.0675818622f},
-std::array<float,2>{0.446183056f, 0.969916999f},
-std::array<float,2>{0.209702745f, 0.285428703f},
-std::array<float,2>{0.746085048f, 0.565223873f},
-std::array<float,2>{0.873176515f, 0.442416281f},
-std::array<float,2>{0.263880461f, 0.669398069f},
-std::array<float,2>{0.0456853658f, 0.230347961f},
-std::array<float,2>{0.597281396f, 0.754363596f},
-std::array<float,2>{0.726763964f, 0.105739675f},
-std::array<float,2>{0.189182371f, 0.96621424f},
-std::array<float,2>{0.455337346f, 0.251333356f},
-std::array<float,2>{0.875053406f, 0.620178103f},
-std::array<float,2>{0.527084529f, 0.339730084f},
-std::array<float,2>{0.12475872f, 0.538486779f},
-std::array<float,2>{0.343705118f, 0.0523292273f},
-std::array<float,2>{0.775706112f, 0.886520445f},
-std::array<float,2>{0.994712472f, 0.134055629f},
-std::array<float,2>{0.421714753f, 0.84644419f},
-std::array<float,2>{0.137496829f, 0.428139389f},
-std::array<float,2>{0.647647321f, 0.721172571f},
-std::array<float,2>{0.924569964f, 0.310992122f},
-std::array<float,2>{0.473360598f, 0.591281533f},
-std::array<float,2>{0.223642766f, 0.0857904255f},
-std::array<float,2>{0.687708378f, 0.998034537f},
-std::array<float,2>{0.583547831f, 0.211649954f},
-std::array<float,2>{0.000288833864f, 0.804142118f},
-std::array<float,2>{0.298389137f, 0.495909274f},
-std::array<float,2>{0.841793597f, 0.631415665f},
-std::array<float,2>{0.680389464f, 0.38185069f},
-std::array<float,2>{0.164533854f, 0.711339831f},
-std::array<float,2>{0.378268749f, 0.169216365f},
-std::array<float,2>{0.941788375f, 0.823112667f},
-std::array<float,2>{0.785509348f, 0.0256013367f},
-std::array<float,2>{0.360785872f, 0.927379668f},
-std::array<float,2>{0.0816905424f, 0.358807683f},
-std::array<float,2>{0.555334747f, 0.51082921f},
-std::array<float,2>{0.916132212f, 0.383976132f},
-std::array<float,2>{0.491517097f, 0.706249833f},
-std::array<float,2>{0.234711438f, 0.162578121f},
-std::array<float,2>{0.717761695f, 0.820077837f},
-std::array<float,2>{0.577655315f, 0.0202988945f},
-std::array<float,2>{0.0240098909f, 0.935144246f},
-std::array<float,2>{0.29432708f, 0.347049803f},
-std::array<float,2>{0.814466298f, 0.504720151f},
-std::array<float,2>{0.671394587f, 0.300633729f},
-std::array<float,2>{0.18604897f, 0.581859291f},
-std::array<float,2>{0.391042858f, 0.0882330313f},
-std::array<float,2>{0.967652738f, 0.986109138f},
-std::array<float,2>{0.805700183f, 0.207339272f},
-std::array<float,2>{0.351730794f, 0.810908914f},
-std::array<float,2>{0.0713212788f, 0.485524476f},
-std::array<float,2>{0.53362745f, 0.637439132f},
-std::array<float,2>{0.847134173f, 0.328798681f},
-std::array<float,2>{0.272255629f, 0.546299636f},
-std::array<float,2>{0.0561808534f, 0.0590555072f},
-std::array<float,2>{0.610347748f, 0.878186941f},
-std::array<float,2>{0.746220052f, 0.130210996f},
-std::array<float,2>{0.205117673f, 0.856226683f},
-std::array<float,2>{0.450533211f, 0.432670087f},
-std::array<float,2>{0.897382736f, 0.731994629f},
-std::array<float,2>{0.500627398f, 0.446601033f},
-std::array<float,2>{0.106135771f, 0.658305407f},
-std::array<float,2>{0.327841759f, 0.22464408f},
-std::array<float,2>{0.76017487f, 0.763141334f},
-std::array<float,2>{0.979284227f, 0.0958078355f},
-std::array<float,2>{0.431739807f, 0.960380793f},
-std::array<float,2>{0.140630752f, 0.261012912f},
-std::array<float,2>{0.625659049f, 0.612331569f},
-std::array<float,2>{0.777819037f, 0.481341332f},
-std::array<float,2>{0.339007854f, 0.641611457f},
-std::array<float,2>{0.120417885f, 0.199426636f},
-std::array<float,2>{0.529957533f, 0.785256743f},
-std::array<float,2>{0.643205523f, 0.0736972615f},
-std::array<float,2>{0.135309801f, 0.981301427f},
-std::array<float,2>{0.415221959f, 0.29252243f},
-std::array<float,2>{0.99824065f, 0.574384749f},
-std::array<float,2>{0.599575102f, 0.363159269f},
-std::array<float,2>{0.0408525355f, 0.528656065f},
-std::array<float,2>{0.259391576f, 0.00581904082f},
-std::array<float,2>{0.867538989f, 0.919517815f},
-std::array<float,2>{0.882721782f, 0.173724964f},
-std::array<float,2>{0.459406525f, 0.832326949f},
-std::array<float,2>{0.193012789f, 0.400717109f},
-std::array<float,2>{0.731669903f, 0.698025465f},
-std::array<float,2>{0.940042555f, 0.270930827f},
-std::array<float,2>{0.382643431f, 0.609074652f},
-std::array<float,2>{0.170004666f, 0.113026194f},
-std::array<float,2>{0.68460989f, 0.948467195f},
-std::array<float,2>{0.56186223f, 0.24339813f},
-std::array<float,2>{0.0827408433f, 0.770202398f},
-std::array<float,2>{0.363908052f, 0.455935299f},
-std::array<float,2>{0.783379912f, 0.674156785f},
-std::array<float,2>{0.692518711f, 0.415641338f},
-std::array<float,2>{0.21924828f, 0.747291863f},
-std::array<float,2>{0.469771713f, 0.147674024f},
-std::array<float,2>{0.927079797f, 0.866666555f},
-std::array<float,2>{0.839716971f, 0.0468412451f},
-std::array<float,2>{0.302878678f, 0.896566451f},
-std::array<float,2>{0.00545115909f, 0.318305939f},
-std::array<float,2>{0.581677377f, 0.548467755f},
-std::array<float,2>{0.989011884f, 0.464658678f},
-std::array<float,2>{0.408421457f, 0.681880295f},
-std::array<float,2>{0.131866708f, 0.23458229f},
-std::array<float,2>{0.650722444f, 0.780403912f},
-std::array<float,2>{0.521468461f, 0.117426105f},
-std::array<float,2>{0.111722685f, 0.944432259f},
-std::array<float,2>{0.333592504f, 0.279415429f},
-std::array<float,2>{0.77140218f, 0.599370599f},
-std::array<float,2>{0.72041142f, 0.320910811f},
-std::array<float,2>{0.202524439f, 0.555102587f},
-std::array<float,2>{0.464185327f, 0.0384900607f},
-std::array<float,2>{0.888837218f, 0.900558412f},
-std::array<float,2>{0.861086249f, 0.151787594f},
-std::array<float,2>{0.255825132f, 0.869530976f},
-std::array<float,2>{0.0324757099f, 0.40927133f},
-std::array<float,2>{0.608023167f, 0.740948558f},
-std::array<float,2>{0.789477646f, 0.282982498f},
-std::array<float,2>{0.370551974f, 0.566725135f},
-std::array<float,2>{0.0863747373f, 0.0625104159f},
-std::array<float,2>{0.554369688f, 0.974783242f},
-std::array<float,2>{0.674033165f, 0.193414658f},
-std::array<float,2>{0.157707736f, 0.789588213f},
-std::array<float,2>{0.383458346f, 0.471596241f},
-std::array<float,2>{0.950473905f, 0.651167989f},
-std::array<float,2>{0.591591418f, 0.394073308f},
-std::array<float,2>{0.00951774884f, 0.69090265f},
-std::array<float,2>{0.311856121f, 0.183955729f},
-std::array<float,2>{0.834800243f, 0.836595058f},
-std::array<float,2>{0.929882169f, 0.0124564739f},
-std::array<float,2>{0.476920128f, 0.909552217f},
-std::array<float,2>{0.22710371f, 0.374266326f},
-std::array<float,2>{0.697818279f, 0.522115707f},
-std::array<float,2>{0.827428997f, 0.424166709f},
-std::array<float,2>{0.287394255f, 0.725509405f},
-std::array<float,2>{0.0160873365f, 0.136982322f},
-std::array<float,2>{0.565124691f, 0.84878099f},
-std::array<float,2>{0.708799183f, 0.0503371507f},
-std::array<float,2>{0.242507964f, 0.887629926f},
-std::array<float,2>{0.496133059f, 0.341791362f},
-std::array<float,2>{0.906692803f, 0.534425497f},
-std::array<float,2>{0.539575398f, 0.255690783f},
-std::array<float,2>{0.0668706968f, 0.623664439f},
-std::array<float,2>{0.351547837f, 0.101969652f},
-std::array<float,2>{0.80246073f, 0.962472677f},
-std::array<float,2>{0.959638238f, 0.233525142f},
-std::array<float,2>{0.403476119f, 0.753052056f},
-std::array<float,2>{0.177090406f, 0.43885228f},
-std::array<float,2>{0.661802471f, 0.665379226f},
-std::array<float,2>{0.903745472f, 0.353514731f},
-std::array<float,2>{0.43850559f, 0.515466988f},
-std::array<float,2>{0.211727753f, 0.0278018378f},
-std::array<float,2>{0.738939703f, 0.923004866f},
-std::array<float,2>{0.620953977f, 0.166068882f},
-std::array<float,2>{0.0523032658f, 0.827541411f},
-std::array<float,2>{0.277041256f, 0.377610415f},
-std::array<float,2>{0.857280374f, 0.716620862f},
-std::array<float,2>{0.63891536f, 0.49635306f},
-std::array<float,2>{0.154711738f, 0.625863612f},
-std::array<float,2>{0.422203451f, 0.215288207f},
-std::array<float,2>{0.973464906f, 0.799969673f},
-std::array<float,2>{0.754476368f, 0.0793006644f},
-std::array<float,2>{0.317030698f, 0.995853722f},
-std::array<float,2>{0.0969685912f, 0.30689165f},
-std::array<float,2>{0.511545837f, 0.588532031f},
-std::array<float,2>{0.934351861f, 0.450747639f},
-std::array<float,2>{0.481484503f, 0.661628187f},
-std::array<float,2>{0.233544677f, 0.222416088f},
-std::array<float,2>{0.700145781f, 0.76098305f},
-std::array<float,2>{0.588291347f, 0.0985940024f},
-std::array<float,2>{0.0123286098f, 0.953670681f},
-std::array<float,2>{0.307358176f, 0.262139499f},
-std::array<float,2>{0.82870394f, 0.617136955f},
-std::array<float,2>{0.676544309f, 0.333151996f},
-std::array<float,2>{0.163148984f, 0.54107672f},
-std::array<float,2>{0.387358159f, 0.0567367785f},
-std::array<float,2>{0.946979702f, 0.880696893f},
-std::array<float,2>{0.796681643f, 0.127470806f},
-std::array<float,2>{0.37346077f, 0.853759289f},
-std::array<float,2>{0.0908334404f, 0.436213017f},
-std::array<float,2>{0.548502684f, 0.726872683f},
-std::array<float,2>{0.865489066f, 0.304297715f},
-std::array<float,2>{0.250422776f, 0.583121717f},
-std::array<float,2>{0.0382464863f, 0.0914168581f},
-std::array<float,2>{0.601746678f, 0.989495337f},
-std::array<float,2>{0.723843813f, 0.203777671f},
-std::array<float,2>{0.197402567f, 0.806352973f},
-std::array<float,2>{0.465035379f, 0.489706337f},
-std::array<float,2>{0.882850468f, 0.635548174f},
-std::array<float,2>{0.517205298f, 0.387993097f},
-std::array<float,2>{0.113349117f, 0.707146823f},
-std::array<float,2>{0.329400629f, 0.157023981f},
-std::array<float,2>{0.765993059f, 0.814590633f},
-std::array<float,2>{0.987253666f, 0.0166111104f},
-std::array<float,2>{0.411096215f, 0.932606936f},
-std::array<float,2>{0.126949549f, 0.351088554f},
-std::array<float,2>{0.654244959f, 0.502030551f},
-std::array<float,2>{0.751153886f, 0.418638498f},
-std::array<float,2>{0.315601856f, 0.74318707f},
-std::array<float,2>{0.100068055f, 0.143215492f},
-std::array<float,2>{0.513564229f, 0.863113999f},
-std::array<float,2>{0.635669649f, 0.0391141176f},
-std::array<float,2>{0.152232423f, 0.894516528f},
-std::array<float,2>{0.426915318f, 0.313033491f},
-std::array<float,2>{0.972452879f, 0.553052545f},
-std::array<float,2>{0.621153653f, 0.268168688f},
-std::array<float,2>{0.0469097905f, 0.603308558f},
-std::array<float,2>{0.278464913f, 0.117081545f},
-std::array<float,2>{0.851790488f, 0.95216459f},
-std::array<float,2>{0.899786234f, 0.247066051f},
-std::array<float,2>{0.443523824f, 0.768236041f},
-std::array<float,2>{0.217527568f, 0.457217932f},
-std::array<float,2>{0.735961735f, 0.677740216f},
-std::array<float,2>{0.956252575f, 0.365492761f},
-std::array<float,2>{0.401122808f, 0.524438798f},
-std::array<float,2>{0.173893914f, 0.00184427912f},
-std::array<float,2>{0.659495592f, 0.915246785f},
-std::array<float,2>{0.544783175f, 0.177682072f},
-std::array<float,2>{0.0639058799f, 0.831086338f},
-std::array<float,2>{0.346804708f, 0.406146795f},
-std::array<float,2>{0.797845423f, 0.702457488f},
-std::array<float,2>{0.703360856f, 0.47678113f},
-std::array<float,2>{0.24779442f, 0.647023678f},
-std::array<float,2>{0.493919075f, 0.198900878f},
-std::array<float,2>{0.910837471f, 0.781889021f},
-std::array<float,2>{0.822679698f, 0.0769761503f},
-std::array<float,2>{0.283673733f, 0.976597786f},
-std::array<float,2>{0.0198803134f, 0.296358317f},
-std::array<float,2>{0.569114566f, 0.572659075f},
-std::array<float,2>{0.982449353f, 0.396064341f},
-std::array<float,2>{0.43587631f, 0.69354403f},
-std::array<float,2>{0.148169175f, 0.180953339f},
-std::array<float,2>{0.630004048f, 0.843259156f},
-std::array<float,2>{0.507284284f, 0.00970620289f},
-std::array<float,2>{0.10214977f, 0.910635352f},
-std::array<float,2>{0.323911101f, 0.367402017f},
-std::array<float,2>{0.765197754f, 0.517287612f},
-std::array<float,2>{0.742369652f, 0.288442433f},
-std::array<float,2>{0.208567172f, 0.563738286f},
-std::array<float,2>{0.448429286f, 0.0687390491f},
-std::array<float,2>{0.89307797f, 0.972030044f},
-std::array<float,2>{0.849452853f, 0.190100104f},
-std::array<float,2>{0.268335462f, 0.796644449f},
-std::array<float,2>{0.0601205453f, 0.473099172f},
-std::array<float,2>{0.61350292f, 0.654612899f},
-std::array<float,2>{0.809031129f, 0.326354504f},
-std::array<float,2>{0.356004536f, 0.558723748f},
-std::array<float,2>{0.0748506263f, 0.0324728601f},
-std::array<float,2>{0.536092818f, 0.902684867f},
-std::array<float,2>{0.66463536f, 0.153684333f},
-std::array<float,2>{0.182101101f, 0.874652207f},
-std::array<float,2>{0.39805153f, 0.411750644f},
-std::array<float,2>{0.963473618f, 0.737515807f},
-std::array<float,2>{0.570895851f, 0.466375083f},
-std::array<float,2>{0.02901976f, 0.686645806f},
-std::array<float,2>{0.291297823f, 0.241805613f},
-std::array<float,2>{0.819193482f, 0.775081754f},
-std::array<float,2>{0.920549333f, 0.121441826f},
-std::array<float,2>{0.484450012f, 0.939768612f},
-std::array<float,2>{0.242098272f, 0.277075857f},
-std::array<float,2>{0.711331666f, 0.596935809f},
-std::array<float,2>{0.843097985f, 0.493087977f},
-std::array<float,2>{0.300427884f, 0.629904091f},
-std::array<float,2>{0.00260103075f, 0.213756859f},
-std::array<float,2>{0.584966838f, 0.80270654f},
-std::array<float,2>{0.691159189f, 0.0837550014f},
-std::array<float,2>{0.224984154f, 0.999669969f},
-std::array<float,2>{0.475951105f, 0.310055137f},
-std::array<float,2>{0.922280252f, 0.5936777f},
-std::array<float,2>{0.558303893f, 0.356795281f},
-std::array<float,2>{0.0793606415f, 0.508647263f},
-std::array<float,2>{0.36135757f, 0.0244917776f},
-std::array<float,2>{0.787834287f, 0.928713381f},
-std::array<float,2>{0.944027245f, 0.171637937f},
-std::array<float,2>{0.375079781f, 0.821406007f},
-std::array<float,2>{0.167245418f, 0.379582465f},
-std::array<float,2>{0.68275404f, 0.714608312f},
-std::array<float,2>{0.87703079f, 0.253146768f},
-std::array<float,2>{0.453680485f, 0.617786169f},
-std::array<float,2>{0.191294476f, 0.109226383f},
-std::array<float,2>{0.729772866f, 0.967861533f},
-std::array<float,2>{0.595251143f, 0.227453008f},
-std::array<float,2>{0.0431725867f, 0.756066978f},
-std::array<float,2>{0.262280881f, 0.44521293f},
-std::array<float,2>{0.872045517f, 0.671761215f},
-std::array<float,2>{0.645905674f, 0.427515566f},
-std::array<float,2>{0.139689311f, 0.720376253f},
-std::array<float,2>{0.418102115f, 0.135515183f},
-std::array<float,2>{0.992574871f, 0.844532132f},
-std::array<float,2>{0.774646521f, 0.0533199683f},
-std::array<float,2>{0.341173887f, 0.884161532f},
-std::array<float,2>{0.121759631f, 0.33741191f},
-std::array<float,2>{0.524618924f, 0.536853433f},
-std::array<float,2>{0.894560933f, 0.429744512f},
-std::array<float,2>{0.452202857f, 0.73409611f},
-std::array<float,2>{0.203424588f, 0.131713748f},
-std::array<float,2>{0.74930495f, 0.8588925f},
-std::array<float,2>{0.612923145f, 0.060575705f},
-std::array<float,2>{0.057219252f, 0.876186371f},
-std::array<float,2>{0.269749314f, 0.331717402f},
-std::array<float,2>{0.844228506f, 0.543085337f},
-std::array<float,2>{0.627906084f, 0.258401036f},
-std::array<float,2>{0.14444758f, 0.60955447f},
-std::array<float,2>{0.430871844f, 0.0938982815f},
-std::array<float,2>{0.977576017f, 0.957329869f},
-std::array<float,2>{0.759650469f, 0.222672418f},
-std::array<float,2>{0.326049089f, 0.764283299f},
-std::array<float,2>{0.108644918f, 0.448571086f},
-std::array<float,2>{0.502198875f, 0.656678081f},
-std::array<float,2>{0.814361513f, 0.345312506f},
-std::array<float,2>{0.296716154f, 0.507565498f},
-std::array<float,2>{0.0261841081f, 0.0231414493f},
-std::array<float,2>{0.575772583f, 0.935983181f},
-std::array<float,2>{0.716113687f, 0.161092937f},
-std::array<float,2>{0.236725539f, 0.8183496f},
-std::array<float,2>{0.489608735f, 0.38557452f},
-std::array<float,2>{0.914621949f, 0.70326066f},
-std::array<float,2>{0.532778263f, 0.487208664f},
-std::array<float,2>{0.0738155544f, 0.639015496f},
-std::array<float,2>{0.353580683f, 0.209261701f},
-std::array<float,2>{0.807311893f, 0.810244679f},
-std::array<float,2>{0.965198338f, 0.0862078369f},
-std::array<float,2>{0.393686324f, 0.986379385f},
-std::array<float,2>{0.184473976f, 0.298709869f},
-std::array<float,2>{0.668303013f, 0.578327119f},
-std::array<float,2>{0.782091141f, 0.453657866f},
-std::array<float,2>{0.36580655f, 0.673236012f},
-std::array<float,2>{0.0851431489f, 0.2451998f},
-std::array<float,2>{0.560524404f, 0.772824407f},
-std::array<float,2>{0.687293112f, 0.109581083f},
-std::array<float,2>{0.168262541f, 0.947005033f},
-std::array<float,2>{0.379611045f, 0.272825986f},
-std::array<float,2>{0.939131796f, 0.606315315f},
-std::array<float,2>{0.578375101f, 0.319052905f},
-std::array<float,2>{0.00598945329f, 0.550330043f},
-std::array<float,2>{0.30212602f, 0.0429855548f},
-std::array<float,2>{0.835967958f, 0.896164596f},
-std::array<float,2>{0.928170621f, 0.145665348f},
-std::array<float,2>{0.471737415f, 0.864506423f},
-std::array<float,2>{0.220832616f, 0.416227967f},
-std::array<float,2>{0.693975151f, 0.749767363f},
-std::array<float,2>{0.996471584f, 0.290261984f},
-std::array<float,2>{0.417330921f, 0.577820003f},
-std::array<float,2>{0.134428188f, 0.0711131766f},
-std::array<float,2>{0.641876519f, 0.983150661f},
-std::array<float,2>{0.52744168f, 0.201832309f},
-std::array<float,2>{0.117408097f, 0.78761059f},
-std::array<float,2>{0.33768025f, 0.483588785f},
-std::array<float,2>{0.781101286f, 0.644274473f},
-std::array<float,2>{0.734254241f, 0.399969131f},
-std::array<float,2>{0.194724858f, 0.695657432f},
-std::array<float,2>{0.45897913f, 0.174712911f},
-std::array<float,2>{0.880657554f, 0.834430039f},
-std::array<float,2>{0.870721936f, 0.00653777877f},
-std::array<float,2>{0.260296464f, 0.921487749f},
-std::array<float,2>{0.0419275649f, 0.361242175f},
-std::array<float,2>{0.600727022f, 0.531183124f},
-std::array<float,2>{0.952322304f, 0.470324427f},
-std::array<float,2>{0.386352777f, 0.650282204f},
-std::array<float,2>{0.158942848f, 0.192129508f},
-std::array<float,2>{0.673332334f, 0.791451931f},
-std::array<float,2>{0.551588118f, 0.0661369339f},
-std::array<float,2>{0.0884827673f, 0.973606288f},
-std::array<float,2>{0.367201567f, 0.284561694f},
-std::array<float,2>{0.79115057f, 0.569668412f},
-std::array<float,2>{0.695575774f, 0.372804165f},
-std::array<float,2>{0.229280919f, 0.520183444f},
-std::array<float,2>{0.480380476f, 0.0137428641f},
-std::array<float,2>{0.931872547f, 0.906671882f},
-std::array<float,2>{0.832896888f, 0.186387122f},
-std::array<float,2>{0.309622139f, 0.838110209f},
-std::array<float,2>{0.0115355309f, 0.391072482f},
-std::array<float,2>{0.593487501f, 0.688491523f},
-std::array<float,2>{0.772370875f, 0.279152274f},
-std::array<float,2>{0.334482342f, 0.600584149f},
-std::array<float,2>{0.109797992f, 0.119760722f},
-std::array<float,2>{0.521670282f, 0.942120612f},
-std::array<float,2>{0.649185359f, 0.237981752f},
-std::array<float,2>{0.130554885f, 0.777524173f},
-std::array<float,2>{0.406715393f, 0.461135715f},
-std::array<float,2>{0.990807652f, 0.681632102f},
-std::array<float,2>{0.605734706f, 0.407346368f},
-std::array<float,2>{0.0333649889f, 0.738479614f},
-std::array<float,2>{0.257395267f, 0.148696557f},
-std::array<float,2>{0.862982392f, 0.868306398f},
-std::array<float,2>{0.888368011f, 0.036977876f},
-std::array<float,2>{0.462775856f, 0.899628222f},
-std::array<float,2>{0.199895754f, 0.322409302f},
-std::array<float,2>{0.721302032f, 0.557233274f},
-std::array<float,2>{0.858466804f, 0.375433296f},
-std::array<float,2>{0.274308503f, 0.717505336f},
-std::array<float,2>{0.0534990877f, 0.165740058f},
-std::array<float,2>{0.618723929f, 0.825106859f},
-std::array<float,2>{0.741620123f, 0.0299179126f},
-std::array<float,2>{0.214167103f, 0.924600363f},
-std::array<float,2>{0.439646661f, 0.353548735f},
-std::array<float,2>{0.905517399f, 0.512081087f},
-std::array<float,2>{0.50811094f, 0.305380106f},
-std::array<float,2>{0.0949114487f, 0.587376475f},
-std::array<float,2>{0.318662375f, 0.0815372765f},
-std::array<float,2>{0.75768137f, 0.992410839f},
-std::array<float,2>{0.974611759f, 0.21731028f},
-std::array<float,2>{0.424252212f, 0.797982514f},
-std::array<float,2>{0.1534179f, 0.499481052f},
-std::array<float,2>{0.63705039f, 0.627251148f},
-std::array<float,2>{0.909031212f, 0.342891872f},
-std::array<float,2>{0.498171508f, 0.532994986f},
-std::array<float,2>{0.244554147f, 0.0470324084f},
-std::array<float,2>{0.709277034f, 0.890468776f},
-std::array<float,2>{0.562526226f, 0.140253082f},
-std::array<float,2>{0.0186578501f, 0.850678504f},
-std::array<float,2>{0.285696179f, 0.422636062f},
-std::array<float,2>{0.825001955f, 0.723557472f},
-std::array<float,2>{0.663305342f, 0.439511091f},
-std::array<float,2>{0.179675877f, 0.666228592f},
-std::array<float,2>{0.405880094f, 0.231931448f},
-std::array<float,2>{0.95743978f, 0.750731945f},
-std::array<float,2>{0.804143608f, 0.104685299f},
-std::array<float,2>{0.349159628f, 0.964658797f},
-std::array<float,2>{0.0689064935f, 0.256628335f},
-std::array<float,2>{0.541161418f, 0.622366726f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.638786018f, 0.968107581f},
-std::array<float,2>{0.26123029f, 0.164625108f},
-std::array<float,2>{0.190697789f, 0.73474896f},
-std::array<float,2>{0.939570367f, 0.320506394f},
-std::array<float,2>{0.78374505f, 0.545304f},
-std::array<float,2>{0.0712499321f, 0.379325718f},
-std::array<float,2>{0.443402886f, 0.865011871f},
-std::array<float,2>{0.594690442f, 0.0486240089f},
-std::array<float,2>{0.535702646f, 0.628563344f},
-std::array<float,2>{0.391958117f, 0.288942516f},
-std::array<float,2>{0.0446421728f, 0.923196971f},
-std::array<float,2>{0.871721148f, 0.207176089f},
-std::array<float,2>{0.893573225f, 0.761808872f},
-std::array<float,2>{0.147450373f, 0.0764075592f},
-std::array<float,2>{0.33528766f, 0.618351221f},
-std::array<float,2>{0.728641629f, 0.438590407f},
-std::array<float,2>{0.590214372f, 0.813761771f},
-std::array<float,2>{0.490394711f, 0.010772597f},
-std::array<float,2>{0.105310813f, 0.50879842f},
-std::array<float,2>{0.759820521f, 0.420317709f},
-std::array<float,2>{0.971629798f, 0.687745631f},
-std::array<float,2>{0.230222508f, 0.369264424f},
-std::array<float,2>{0.296126425f, 0.983530462f},
-std::array<float,2>{0.679864168f, 0.14621526f},
-std::array<float,2>{0.702689528f, 0.580548823f},
-std::array<float,2>{0.360301673f, 0.489124835f},
-std::array<float,2>{0.181880638f, 0.797359824f},
-std::array<float,2>{0.907684147f, 0.117547885f},
-std::array<float,2>{0.838872969f, 0.898824096f},
-std::array<float,2>{0.00606378587f, 0.242448524f},
-std::array<float,2>{0.436053485f, 0.686588645f},
-std::array<float,2>{0.520106494f, 0.262680858f},
-std::array<float,2>{0.512644887f, 0.9106552f},
-std::array<float,2>{0.414575636f, 0.18793194f},
-std::array<float,2>{0.0209178217f, 0.646911681f},
-std::array<float,2>{0.820851028f, 0.305069387f},
-std::array<float,2>{0.935348809f, 0.594290137f},
-std::array<float,2>{0.163335964f, 0.460961491f},
-std::array<float,2>{0.357516855f, 0.766182542f},
-std::array<float,2>{0.713264942f, 0.0891856775f},
-std::array<float,2>{0.664591432f, 0.726008892f},
-std::array<float,2>{0.308613449f, 0.337668002f},
-std::array<float,2>{0.24130702f, 0.940793216f},
-std::array<float,2>{0.996467352f, 0.180627927f},
-std::array<float,2>{0.774825394f, 0.857691944f},
-std::array<float,2>{0.118802316f, 0.0438215993f},
-std::array<float,2>{0.469877094f, 0.555908382f},
-std::array<float,2>{0.574997306f, 0.391267449f},
-std::array<float,2>{0.74663341f, 0.79684639f},
-std::array<float,2>{0.318261474f, 0.0951601118f},
-std::array<float,2>{0.13395606f, 0.573476851f},
-std::array<float,2>{0.878521204f, 0.48300159f},
-std::array<float,2>{0.847801924f, 0.656542599f},
-std::array<float,2>{0.0530631468f, 0.277959228f},
-std::array<float,2>{0.380251914f, 0.876957238f},
-std::array<float,2>{0.546887577f, 0.231264785f},
-std::array<float,2>{0.614371777f, 0.51973021f},
-std::array<float,2>{0.459182203f, 0.426037252f},
-std::array<float,2>{0.0897201151f, 0.842676997f},
-std::array<float,2>{0.803732276f, 0.0293257162f},
-std::array<float,2>{0.957529187f, 0.994706452f},
-std::array<float,2>{0.207265556f, 0.137411863f},
-std::array<float,2>{0.279182374f, 0.713697374f},
-std::array<float,2>{0.656097949f, 0.356011063f},
-std::array<float,2>{0.705334246f, 0.883464813f},
-std::array<float,2>{0.344828248f, 0.222751603f},
-std::array<float,2>{0.171512157f, 0.670121014f},
-std::array<float,2>{0.925961494f, 0.271013767f},
-std::array<float,2>{0.816211402f, 0.56682241f},
-std::array<float,2>{0.0261648241f, 0.473640114f},
-std::array<float,2>{0.410271168f, 0.783140182f},
-std::array<float,2>{0.504247248f, 0.104728855f},
-std::array<float,2>{0.562915623f, 0.70435375f},
-std::array<float,2>{0.482166708f, 0.346205086f},
-std::array<float,2>{0.114894241f, 0.985219955f},
-std::array<float,2>{0.76932323f, 0.126547411f},
-std::array<float,2>{0.988977194f, 0.835649788f},
-std::array<float,2>{0.243281782f, 0.0178091321f},
-std::array<float,2>{0.303179592f, 0.528579891f},
-std::array<float,2>{0.65954715f, 0.43289414f},
-std::array<float,2>{0.560947418f, 0.777522504f},
-std::array<float,2>{0.385715991f, 0.0798916891f},
-std::array<float,2>{0.056687694f, 0.605429709f},
-std::array<float,2>{0.855303466f, 0.455880016f},
-std::array<float,2>{0.887086868f, 0.649026036f},
-std::array<float,2>{0.129939303f, 0.302454442f},
-std::array<float,2>{0.324860245f, 0.916160941f},
-std::array<float,2>{0.737727344f, 0.1984694f},
-std::array<float,2>{0.647841215f, 0.55347532f},
-std::array<float,2>{0.265795499f, 0.398632854f},
-std::array<float,2>{0.211900309f, 0.850188017f},
-std::array<float,2>{0.963308454f, 0.0365216322f},
-std::array<float,2>{0.811299801f, 0.949773729f},
-std::array<float,2>{0.0839689523f, 0.179026335f},
-std::array<float,2>{0.466313809f, 0.73110348f},
-std::array<float,2>{0.622714102f, 0.333137453f},
-std::array<float,2>{0.606552303f, 0.97370398f},
-std::array<float,2>{0.452899158f, 0.150792584f},
-std::array<float,2>{0.0639469773f, 0.698736966f},
-std::array<float,2>{0.789712787f, 0.365368247f},
-std::array<float,2>{0.945993125f, 0.505145192f},
-std::array<float,2>{0.201609761f, 0.411153376f},
-std::array<float,2>{0.250593483f, 0.822326541f},
-std::array<float,2>{0.625474453f, 0.00326366932f},
-std::array<float,2>{0.721293509f, 0.678610027f},
-std::array<float,2>{0.343234748f, 0.252553076f},
-std::array<float,2>{0.149990007f, 0.893004119f},
-std::array<float,2>{0.898442745f, 0.23725687f},
-std::array<float,2>{0.860897183f, 0.809171379f},
-std::array<float,2>{0.0349152982f, 0.111778297f},
-std::array<float,2>{0.399659634f, 0.586931765f},
-std::array<float,2>{0.544395089f, 0.493211865f},
-std::array<float,2>{0.673949242f, 0.868948936f},
-std::array<float,2>{0.287251174f, 0.0552663468f},
-std::array<float,2>{0.220344558f, 0.538011253f},
-std::array<float,2>{0.982125044f, 0.387486815f},
-std::array<float,2>{0.756757379f, 0.747870684f},
-std::array<float,2>{0.101104498f, 0.314412266f},
-std::array<float,2>{0.495235205f, 0.959776282f},
-std::array<float,2>{0.57992506f, 0.163325503f},
-std::array<float,2>{0.530649304f, 0.611832798f},
-std::array<float,2>{0.425631791f, 0.451522022f},
-std::array<float,2>{0.0141883371f, 0.753322542f},
-std::array<float,2>{0.828824282f, 0.0678055361f},
-std::array<float,2>{0.915186405f, 0.932509601f},
-std::array<float,2>{0.172794566f, 0.215739086f},
-std::array<float,2>{0.370743483f, 0.635278761f},
-std::array<float,2>{0.690537035f, 0.296864748f},
-std::array<float,2>{0.731145144f, 0.988774598f},
-std::array<float,2>{0.330204785f, 0.130661726f},
-std::array<float,2>{0.143193454f, 0.710330784f},
-std::array<float,2>{0.897016227f, 0.350454718f},
-std::array<float,2>{0.868076086f, 0.525023162f},
-std::array<float,2>{0.0397938117f, 0.436024964f},
-std::array<float,2>{0.398288697f, 0.830354571f},
-std::array<float,2>{0.531723082f, 0.0232448895f},
-std::array<float,2>{0.600575209f, 0.667472124f},
-std::array<float,2>{0.440920681f, 0.265892744f},
-std::array<float,2>{0.0745596662f, 0.888383389f},
-std::array<float,2>{0.78799051f, 0.221918076f},
-std::array<float,2>{0.942521453f, 0.786020041f},
-std::array<float,2>{0.191569895f, 0.10785041f},
-std::array<float,2>{0.26322186f, 0.566015959f},
-std::array<float,2>{0.632958055f, 0.468776286f},
-std::array<float,2>{0.518539071f, 0.84733808f},
-std::array<float,2>{0.430266351f, 0.0331861638f},
-std::array<float,2>{0.00274034101f, 0.548322976f},
-std::array<float,2>{0.841617763f, 0.405534208f},
-std::array<float,2>{0.913569808f, 0.73011893f},
-std::array<float,2>{0.183640853f, 0.329356223f},
-std::array<float,2>{0.366405457f, 0.9486624f},
-std::array<float,2>{0.698096633f, 0.172749728f},
-std::array<float,2>{0.684694409f, 0.606070876f},
-std::array<float,2>{0.290911287f, 0.458320975f},
-std::array<float,2>{0.231371716f, 0.775072634f},
-std::array<float,2>{0.974335551f, 0.0846162513f},
-std::array<float,2>{0.763914943f, 0.920149326f},
-std::array<float,2>{0.108297646f, 0.202018574f},
-std::array<float,2>{0.48493433f, 0.653893948f},
-std::array<float,2>{0.589675665f, 0.29794836f},
-std::array<float,2>{0.571740389f, 0.896223009f},
-std::array<float,2>{0.476320624f, 0.239986837f},
-std::array<float,2>{0.123441279f, 0.673666835f},
-std::array<float,2>{0.779288471f, 0.255694181f},
-std::array<float,2>{0.994009018f, 0.593378007f},
-std::array<float,2>{0.236482918f, 0.496477962f},
-std::array<float,2>{0.305225194f, 0.805757105f},
-std::array<float,2>{0.669636607f, 0.116090558f},
-std::array<float,2>{0.717175663f, 0.701152503f},
-std::array<float,2>{0.355448693f, 0.36256811f},
-std::array<float,2>{0.157266811f, 0.971369386f},
-std::array<float,2>{0.93347311f, 0.154403359f},
-std::array<float,2>{0.826184332f, 0.824293792f},
-std::array<float,2>{0.018213179f, 0.00684593385f},
-std::array<float,2>{0.418312043f, 0.500793636f},
-std::array<float,2>{0.510329127f, 0.40813309f},
-std::array<float,2>{0.650835812f, 0.757031798f},
-std::array<float,2>{0.276438713f, 0.0633677468f},
-std::array<float,2>{0.20658119f, 0.617148638f},
-std::array<float,2>{0.955479026f, 0.446929753f},
-std::array<float,2>{0.797297299f, 0.638023913f},
-std::array<float,2>{0.0911142379f, 0.289154023f},
-std::array<float,2>{0.453546137f, 0.93511349f},
-std::array<float,2>{0.613259494f, 0.213929668f},
-std::array<float,2>{0.551579177f, 0.533104718f},
-std::array<float,2>{0.375744373f, 0.383784324f},
-std::array<float,2>{0.0500847436f, 0.8745206f},
-std::array<float,2>{0.846863508f, 0.0608640537f},
-std::array<float,2>{0.88112092f, 0.953842878f},
-std::array<float,2>{0.139285803f, 0.15840815f},
-std::array<float,2>{0.313067883f, 0.743126631f},
-std::array<float,2>{0.742593765f, 0.318455458f},
-std::array<float,2>{0.661826015f, 0.927149653f},
-std::array<float,2>{0.299437553f, 0.204422653f},
-std::array<float,2>{0.248314098f, 0.629490018f},
-std::array<float,2>{0.986600101f, 0.284471989f},
-std::array<float,2>{0.773341179f, 0.622727275f},
-std::array<float,2>{0.110693239f, 0.443406075f},
-std::array<float,2>{0.480291843f, 0.760095537f},
-std::array<float,2>{0.567453265f, 0.0722198188f},
-std::array<float,2>{0.503185332f, 0.741422713f},
-std::array<float,2>{0.407944679f, 0.327743441f},
-std::array<float,2>{0.0310685821f, 0.963723719f},
-std::array<float,2>{0.818376064f, 0.171592847f},
-std::array<float,2>{0.924764335f, 0.862960458f},
-std::array<float,2>{0.167608961f, 0.0523577705f},
-std::array<float,2>{0.351107866f, 0.541663051f},
-std::array<float,2>{0.710174322f, 0.378489375f},
-std::array<float,2>{0.617519617f, 0.801547766f},
-std::array<float,2>{0.461652368f, 0.124150984f},
-std::array<float,2>{0.0809042826f, 0.585269868f},
-std::array<float,2>{0.807804644f, 0.48576194f},
-std::array<float,2>{0.968214631f, 0.680437207f},
-std::array<float,2>{0.217515305f, 0.259554774f},
-std::array<float,2>{0.269909173f, 0.903435707f},
-std::array<float,2>{0.641221404f, 0.24656418f},
-std::array<float,2>{0.740893066f, 0.51433897f},
-std::array<float,2>{0.3230097f, 0.414548427f},
-std::array<float,2>{0.12875922f, 0.818688989f},
-std::array<float,2>{0.886598051f, 0.0153731788f},
-std::array<float,2>{0.857991219f, 0.97775805f},
-std::array<float,2>{0.0609709099f, 0.144302249f},
-std::array<float,2>{0.387231052f, 0.694952011f},
-std::array<float,2>{0.555668116f, 0.372860253f},
-std::array<float,2>{0.541023076f, 0.943049014f},
-std::array<float,2>{0.403770745f, 0.186946288f},
-std::array<float,2>{0.0382705107f, 0.719067276f},
-std::array<float,2>{0.863665164f, 0.343712568f},
-std::array<float,2>{0.903923154f, 0.560225904f},
-std::array<float,2>{0.154503256f, 0.394948602f},
-std::array<float,2>{0.336622685f, 0.852205396f},
-std::array<float,2>{0.724986255f, 0.040960338f},
-std::array<float,2>{0.628924429f, 0.642702222f},
-std::array<float,2>{0.257696748f, 0.310126662f},
-std::array<float,2>{0.197251171f, 0.906301081f},
-std::array<float,2>{0.949625731f, 0.194106311f},
-std::array<float,2>{0.79309994f, 0.773350537f},
-std::array<float,2>{0.0678957626f, 0.090314433f},
-std::array<float,2>{0.4469634f, 0.597717226f},
-std::array<float,2>{0.602768123f, 0.467381924f},
-std::array<float,2>{0.693020403f, 0.838053107f},
-std::array<float,2>{0.372431606f, 0.0251778588f},
-std::array<float,2>{0.176684424f, 0.516227424f},
-std::array<float,2>{0.921788871f, 0.424891084f},
-std::array<float,2>{0.832365513f, 0.715123057f},
-std::array<float,2>{0.00921088085f, 0.353307754f},
-std::array<float,2>{0.429586053f, 0.997407377f},
-std::array<float,2>{0.523599029f, 0.133986518f},
-std::array<float,2>{0.582909644f, 0.575466871f},
-std::array<float,2>{0.496520907f, 0.47661832f},
-std::array<float,2>{0.0961374268f, 0.790371537f},
-std::array<float,2>{0.753444493f, 0.0985168442f},
-std::array<float,2>{0.978182852f, 0.880087018f},
-std::array<float,2>{0.225411564f, 0.230218709f},
-std::array<float,2>{0.281567484f, 0.662560642f},
-std::array<float,2>{0.675862014f, 0.274418503f},
-std::array<float,2>{0.682919741f, 0.980902195f},
-std::array<float,2>{0.293426692f, 0.146780342f},
-std::array<float,2>{0.226642698f, 0.690955937f},
-std::array<float,2>{0.970068634f, 0.368975967f},
-std::array<float,2>{0.758661568f, 0.511240482f},
-std::array<float,2>{0.103220135f, 0.418187231f},
-std::array<float,2>{0.488309681f, 0.81537962f},
-std::array<float,2>{0.593123376f, 0.00909203943f},
-std::array<float,2>{0.523367703f, 0.684912503f},
-std::array<float,2>{0.434350997f, 0.264571935f},
-std::array<float,2>{0.00484033721f, 0.901968181f},
-std::array<float,2>{0.837004066f, 0.245591789f},
-std::array<float,2>{0.908273041f, 0.79964906f},
-std::array<float,2>{0.18023634f, 0.120965242f},
-std::array<float,2>{0.362392694f, 0.578389227f},
-std::array<float,2>{0.700159132f, 0.490284741f},
-std::array<float,2>{0.597378254f, 0.866219401f},
-std::array<float,2>{0.443281382f, 0.0490741506f},
-std::array<float,2>{0.0734194517f, 0.544673026f},
-std::array<float,2>{0.782521307f, 0.382746845f},
-std::array<float,2>{0.939452291f, 0.737886369f},
-std::array<float,2>{0.188940421f, 0.324069113f},
-std::array<float,2>{0.258843422f, 0.965867817f},
-std::array<float,2>{0.638423443f, 0.166259885f},
-std::array<float,2>{0.727272928f, 0.620145559f},
-std::array<float,2>{0.332275659f, 0.439810336f},
-std::array<float,2>{0.144936725f, 0.764392972f},
-std::array<float,2>{0.891275883f, 0.0752698109f},
-std::array<float,2>{0.873234034f, 0.924095631f},
-std::array<float,2>{0.0457532704f, 0.210550413f},
-std::array<float,2>{0.392650753f, 0.626386583f},
-std::array<float,2>{0.537163794f, 0.285839379f},
-std::array<float,2>{0.550487399f, 0.875054002f},
-std::array<float,2>{0.382329524f, 0.232528552f},
-std::array<float,2>{0.0514759272f, 0.658229351f},
-std::array<float,2>{0.850705087f, 0.280944198f},
-std::array<float,2>{0.87511003f, 0.571903944f},
-std::array<float,2>{0.135221988f, 0.481189609f},
-std::array<float,2>{0.319321096f, 0.794624746f},
-std::array<float,2>{0.748436391f, 0.0959852338f},
-std::array<float,2>{0.653747261f, 0.712523699f},
-std::array<float,2>{0.280666649f, 0.358424217f},
-std::array<float,2>{0.2106148f, 0.99297744f},
-std::array<float,2>{0.960249305f, 0.139370844f},
-std::array<float,2>{0.802559853f, 0.841748238f},
-std::array<float,2>{0.0873862132f, 0.0277375933f},
-std::array<float,2>{0.457410157f, 0.521939456f},
-std::array<float,2>{0.616170406f, 0.429210722f},
-std::array<float,2>{0.711831927f, 0.768911242f},
-std::array<float,2>{0.356873631f, 0.0876682177f},
-std::array<float,2>{0.16047278f, 0.59631902f},
-std::array<float,2>{0.936837792f, 0.462971509f},
-std::array<float,2>{0.824216366f, 0.645559192f},
-std::array<float,2>{0.0226302892f, 0.30705303f},
-std::array<float,2>{0.416372031f, 0.912736773f},
-std::array<float,2>{0.514756739f, 0.190035313f},
-std::array<float,2>{0.577486455f, 0.557649732f},
-std::array<float,2>{0.471234202f, 0.394020349f},
-std::array<float,2>{0.119807303f, 0.856259227f},
-std::array<float,2>{0.776854455f, 0.0467328802f},
-std::array<float,2>{0.998209953f, 0.93777287f},
-std::array<float,2>{0.239136472f, 0.1826922f},
-std::array<float,2>{0.31169641f, 0.724474311f},
-std::array<float,2>{0.666128993f, 0.338805914f},
-std::array<float,2>{0.734821022f, 0.914643586f},
-std::array<float,2>{0.327945113f, 0.196749717f},
-std::array<float,2>{0.131396294f, 0.65128684f},
-std::array<float,2>{0.890409768f, 0.302754611f},
-std::array<float,2>{0.853092849f, 0.601699352f},
-std::array<float,2>{0.0562450401f, 0.454743236f},
-std::array<float,2>{0.384419143f, 0.780186713f},
-std::array<float,2>{0.560106754f, 0.0806683898f},
-std::array<float,2>{0.623860002f, 0.734164834f},
-std::array<float,2>{0.468718141f, 0.334896356f},
-std::array<float,2>{0.0847259313f, 0.951229751f},
-std::array<float,2>{0.809919238f, 0.176546648f},
-std::array<float,2>{0.962091863f, 0.848108351f},
-std::array<float,2>{0.214509234f, 0.0383763537f},
-std::array<float,2>{0.268929243f, 0.552372456f},
-std::array<float,2>{0.645710528f, 0.401987404f},
-std::array<float,2>{0.507199466f, 0.78350693f},
-std::array<float,2>{0.412128568f, 0.10296502f},
-std::array<float,2>{0.0236338843f, 0.56904161f},
-std::array<float,2>{0.813835621f, 0.476129472f},
-std::array<float,2>{0.929358304f, 0.669147313f},
-std::array<float,2>{0.168442369f, 0.272082776f},
-std::array<float,2>{0.346255749f, 0.885014117f},
-std::array<float,2>{0.70314759f, 0.226414531f},
-std::array<float,2>{0.656377137f, 0.530423462f},
-std::array<float,2>{0.300802976f, 0.431535006f},
-std::array<float,2>{0.244546011f, 0.832976937f},
-std::array<float,2>{0.990902007f, 0.0173201691f},
-std::array<float,2>{0.765873015f, 0.987595677f},
-std::array<float,2>{0.1153896f, 0.128370434f},
-std::array<float,2>{0.483436197f, 0.706835389f},
-std::array<float,2>{0.565911114f, 0.345241934f},
-std::array<float,2>{0.581320405f, 0.958520412f},
-std::array<float,2>{0.493978709f, 0.161343321f},
-std::array<float,2>{0.0988201126f, 0.748088956f},
-std::array<float,2>{0.753933191f, 0.314522445f},
-std::array<float,2>{0.983405709f, 0.535457194f},
-std::array<float,2>{0.221227482f, 0.38914749f},
-std::array<float,2>{0.286067933f, 0.869584084f},
-std::array<float,2>{0.672141075f, 0.0569559149f},
-std::array<float,2>{0.688270986f, 0.633481801f},
-std::array<float,2>{0.368675053f, 0.294826776f},
-std::array<float,2>{0.175613746f, 0.931147397f},
-std::array<float,2>{0.916151226f, 0.218333259f},
-std::array<float,2>{0.831028819f, 0.751333714f},
-std::array<float,2>{0.0132500688f, 0.0697328895f},
-std::array<float,2>{0.423722863f, 0.610769451f},
-std::array<float,2>{0.527632296f, 0.450468987f},
-std::array<float,2>{0.627992928f, 0.820699751f},
-std::array<float,2>{0.253353775f, 0.000411649875f},
-std::array<float,2>{0.200932473f, 0.506037414f},
-std::array<float,2>{0.947958112f, 0.413621038f},
-std::array<float,2>{0.791740358f, 0.696181655f},
-std::array<float,2>{0.0659236833f, 0.363974333f},
-std::array<float,2>{0.450263202f, 0.975382924f},
-std::array<float,2>{0.608830631f, 0.150310084f},
-std::array<float,2>{0.545419574f, 0.588745713f},
-std::array<float,2>{0.402194142f, 0.494905502f},
-std::array<float,2>{0.0325408503f, 0.81115067f},
-std::array<float,2>{0.861740112f, 0.110283889f},
-std::array<float,2>{0.90087527f, 0.892381072f},
-std::array<float,2>{0.151234582f, 0.236106783f},
-std::array<float,2>{0.341056347f, 0.675857127f},
-std::array<float,2>{0.719081521f, 0.25137955f},
-std::array<float,2>{0.696316719f, 0.945902288f},
-std::array<float,2>{0.364331067f, 0.173892677f},
-std::array<float,2>{0.186556295f, 0.726947606f},
-std::array<float,2>{0.911990345f, 0.331905246f},
-std::array<float,2>{0.843674839f, 0.549580693f},
-std::array<float,2>{0.000401680212f, 0.403980851f},
-std::array<float,2>{0.432148069f, 0.844352484f},
-std::array<float,2>{0.516958416f, 0.034695033f},
-std::array<float,2>{0.587466836f, 0.655783951f},
-std::array<float,2>{0.487763375f, 0.298906952f},
-std::array<float,2>{0.105638094f, 0.919591129f},
-std::array<float,2>{0.762649179f, 0.20080708f},
-std::array<float,2>{0.976552665f, 0.777201116f},
-std::array<float,2>{0.232544139f, 0.0828915536f},
-std::array<float,2>{0.292535692f, 0.608858049f},
-std::array<float,2>{0.6873101f, 0.460491866f},
-std::array<float,2>{0.534231842f, 0.829593956f},
-std::array<float,2>{0.394996703f, 0.0212650467f},
-std::array<float,2>{0.0419523977f, 0.525693357f},
-std::array<float,2>{0.870336711f, 0.433813363f},
-std::array<float,2>{0.896175385f, 0.707254589f},
-std::array<float,2>{0.140727893f, 0.349107295f},
-std::array<float,2>{0.329632342f, 0.991093278f},
-std::array<float,2>{0.733683467f, 0.131733477f},
-std::array<float,2>{0.63629359f, 0.564031899f},
-std::array<float,2>{0.264895499f, 0.471808255f},
-std::array<float,2>{0.195308596f, 0.788411677f},
-std::array<float,2>{0.944520354f, 0.106481731f},
-std::array<float,2>{0.786200345f, 0.889056563f},
-std::array<float,2>{0.0767979845f, 0.219690934f},
-std::array<float,2>{0.437642455f, 0.665726244f},
-std::array<float,2>{0.599559128f, 0.26802808f},
-std::array<float,2>{0.610003471f, 0.936730981f},
-std::array<float,2>{0.455299765f, 0.212062508f},
-std::array<float,2>{0.0923790559f, 0.640518963f},
-std::array<float,2>{0.798930466f, 0.292154431f},
-std::array<float,2>{0.954765499f, 0.613646626f},
-std::array<float,2>{0.204139873f, 0.448194653f},
-std::array<float,2>{0.273468792f, 0.754165649f},
-std::array<float,2>{0.650318444f, 0.0654651523f},
-std::array<float,2>{0.74543494f, 0.745612383f},
-std::array<float,2>{0.316287279f, 0.316908568f},
-std::array<float,2>{0.136764899f, 0.955367506f},
-std::array<float,2>{0.879631341f, 0.1570438f},
-std::array<float,2>{0.845218301f, 0.87126565f},
-std::array<float,2>{0.0480945222f, 0.0599766895f},
-std::array<float,2>{0.378578246f, 0.534226f},
-std::array<float,2>{0.55299437f, 0.385168374f},
-std::array<float,2>{0.671378672f, 0.807201445f},
-std::array<float,2>{0.307624787f, 0.113568671f},
-std::array<float,2>{0.234812886f, 0.590994954f},
-std::array<float,2>{0.99532795f, 0.499834985f},
-std::array<float,2>{0.780967355f, 0.675027311f},
-std::array<float,2>{0.121857122f, 0.257427692f},
-std::array<float,2>{0.472886145f, 0.896731675f},
-std::array<float,2>{0.573115766f, 0.242062047f},
-std::array<float,2>{0.508963346f, 0.503682852f},
-std::array<float,2>{0.421703696f, 0.409481883f},
-std::array<float,2>{0.0164716505f, 0.827734411f},
-std::array<float,2>{0.824678063f, 0.00444820523f},
-std::array<float,2>{0.929863751f, 0.969997823f},
-std::array<float,2>{0.159970492f, 0.1523716f},
-std::array<float,2>{0.353495926f, 0.701720417f},
-std::array<float,2>{0.716528952f, 0.359514207f},
-std::array<float,2>{0.643776476f, 0.90575105f},
-std::array<float,2>{0.272559971f, 0.248977453f},
-std::array<float,2>{0.214900911f, 0.681826711f},
-std::array<float,2>{0.964900672f, 0.261000752f},
-std::array<float,2>{0.806315124f, 0.583188176f},
-std::array<float,2>{0.0789100081f, 0.486400634f},
-std::array<float,2>{0.464279056f, 0.804671943f},
-std::array<float,2>{0.619920969f, 0.122339949f},
-std::array<float,2>{0.557313681f, 0.691440523f},
-std::array<float,2>{0.389549583f, 0.374936819f},
-std::array<float,2>{0.0604494549f, 0.979814947f},
-std::array<float,2>{0.855758548f, 0.140789121f},
-std::array<float,2>{0.882971168f, 0.817372799f},
-std::array<float,2>{0.126185313f, 0.0117556527f},
-std::array<float,2>{0.32051602f, 0.512402296f},
-std::array<float,2>{0.738662601f, 0.41707772f},
-std::array<float,2>{0.569716692f, 0.759720862f},
-std::array<float,2>{0.478176445f, 0.0723002777f},
-std::array<float,2>{0.112908088f, 0.623329341f},
-std::array<float,2>{0.77066803f, 0.442755252f},
-std::array<float,2>{0.985028923f, 0.632618546f},
-std::array<float,2>{0.247465447f, 0.282695502f},
-std::array<float,2>{0.298789144f, 0.929166317f},
-std::array<float,2>{0.664046407f, 0.206553534f},
-std::array<float,2>{0.708753526f, 0.539238036f},
-std::array<float,2>{0.347954333f, 0.376813859f},
-std::array<float,2>{0.165354058f, 0.860591114f},
-std::array<float,2>{0.922140121f, 0.0537881367f},
-std::array<float,2>{0.81694597f, 0.961151004f},
-std::array<float,2>{0.0278607011f, 0.168648645f},
-std::array<float,2>{0.408729345f, 0.740089655f},
-std::array<float,2>{0.500078022f, 0.324750692f},
-std::array<float,2>{0.527108312f, 0.999434769f},
-std::array<float,2>{0.426958233f, 0.135138795f},
-std::array<float,2>{0.0106668519f, 0.717184663f},
-std::array<float,2>{0.834752858f, 0.354208112f},
-std::array<float,2>{0.918469131f, 0.518505752f},
-std::array<float,2>{0.178401008f, 0.423333615f},
-std::array<float,2>{0.373757213f, 0.837414503f},
-std::array<float,2>{0.693490684f, 0.0255871806f},
-std::array<float,2>{0.678191364f, 0.661144137f},
-std::array<float,2>{0.285134703f, 0.275477558f},
-std::array<float,2>{0.222719565f, 0.882743895f},
-std::array<float,2>{0.979546428f, 0.227969974f},
-std::array<float,2>{0.751036644f, 0.791154087f},
-std::array<float,2>{0.0943858996f, 0.10060709f},
-std::array<float,2>{0.498968154f, 0.576589525f},
-std::array<float,2>{0.585846424f, 0.479469866f},
-std::array<float,2>{0.724293649f, 0.8552773f},
-std::array<float,2>{0.338476092f, 0.0415512025f},
-std::array<float,2>{0.154107705f, 0.561415076f},
-std::array<float,2>{0.905817628f, 0.396815032f},
-std::array<float,2>{0.86531812f, 0.721916795f},
-std::array<float,2>{0.0361354984f, 0.341487914f},
-std::array<float,2>{0.404771358f, 0.943538427f},
-std::array<float,2>{0.539080083f, 0.185104191f},
-std::array<float,2>{0.604388773f, 0.599682212f},
-std::array<float,2>{0.448839366f, 0.465085089f},
-std::array<float,2>{0.0695288107f, 0.769568264f},
-std::array<float,2>{0.796042562f, 0.0936596692f},
-std::array<float,2>{0.952410281f, 0.909018755f},
-std::array<float,2>{0.197886825f, 0.191622511f},
-std::array<float,2>{0.254981518f, 0.642230809f},
-std::array<float,2>{0.631570101f, 0.311065048f},
-std::array<float,2>{0.654990017f, 0.993834078f},
-std::array<float,2>{0.278198183f, 0.14039655f},
-std::array<float,2>{0.208306745f, 0.711746514f},
-std::array<float,2>{0.958820522f, 0.358263135f},
-std::array<float,2>{0.80280757f, 0.523302197f},
-std::array<float,2>{0.0883244872f, 0.428617239f},
-std::array<float,2>{0.460840315f, 0.839911819f},
-std::array<float,2>{0.613988757f, 0.0285957046f},
-std::array<float,2>{0.548470795f, 0.659245849f},
-std::array<float,2>{0.379463375f, 0.27958411f},
-std::array<float,2>{0.0541209728f, 0.876826108f},
-std::array<float,2>{0.849529922f, 0.234322429f},
-std::array<float,2>{0.877254009f, 0.793902099f},
-std::array<float,2>{0.133522317f, 0.0973051339f},
-std::array<float,2>{0.317324132f, 0.570624471f},
-std::array<float,2>{0.74792248f, 0.482061148f},
-std::array<float,2>{0.575414181f, 0.857219875f},
-std::array<float,2>{0.46965158f, 0.0453443192f},
-std::array<float,2>{0.118080966f, 0.557605326f},
-std::array<float,2>{0.774047494f, 0.393379748f},
-std::array<float,2>{0.997503221f, 0.722903728f},
-std::array<float,2>{0.241165847f, 0.338904113f},
-std::array<float,2>{0.30987218f, 0.938693166f},
-std::array<float,2>{0.665161431f, 0.181714624f},
-std::array<float,2>{0.713869572f, 0.596985757f},
-std::array<float,2>{0.358807266f, 0.464056134f},
-std::array<float,2>{0.162544951f, 0.767754972f},
-std::array<float,2>{0.933817804f, 0.0861115605f},
-std::array<float,2>{0.822016001f, 0.913964868f},
-std::array<float,2>{0.0202914774f, 0.190972075f},
-std::array<float,2>{0.415685892f, 0.645484924f},
-std::array<float,2>{0.512943923f, 0.307638615f},
-std::array<float,2>{0.521333158f, 0.901174366f},
-std::array<float,2>{0.437290668f, 0.245111719f},
-std::array<float,2>{0.0076734391f, 0.684550166f},
-std::array<float,2>{0.837943435f, 0.265280485f},
-std::array<float,2>{0.906513095f, 0.579723537f},
-std::array<float,2>{0.18328993f, 0.491446525f},
-std::array<float,2>{0.360531718f, 0.800199032f},
-std::array<float,2>{0.701347411f, 0.119902067f},
-std::array<float,2>{0.681327641f, 0.690103173f},
-std::array<float,2>{0.295118958f, 0.367340893f},
-std::array<float,2>{0.229373917f, 0.981702089f},
-std::array<float,2>{0.972572863f, 0.147816107f},
-std::array<float,2>{0.761033177f, 0.815777898f},
-std::array<float,2>{0.104314253f, 0.00836052559f},
-std::array<float,2>{0.49174723f, 0.510291517f},
-std::array<float,2>{0.590880752f, 0.419367403f},
-std::array<float,2>{0.730421066f, 0.765414953f},
-std::array<float,2>{0.334866256f, 0.0750308037f},
-std::array<float,2>{0.147644058f, 0.619859993f},
-std::array<float,2>{0.892644227f, 0.441273391f},
-std::array<float,2>{0.872630894f, 0.62570411f},
-std::array<float,2>{0.0433803238f, 0.286719859f},
-std::array<float,2>{0.390797228f, 0.925383449f},
-std::array<float,2>{0.537060142f, 0.209843144f},
-std::array<float,2>{0.595701933f, 0.543726206f},
-std::array<float,2>{0.444513708f, 0.381807327f},
-std::array<float,2>{0.0721236914f, 0.866202652f},
-std::array<float,2>{0.784535408f, 0.0499475971f},
-std::array<float,2>{0.9409284f, 0.965573549f},
-std::array<float,2>{0.189731061f, 0.167315647f},
-std::array<float,2>{0.260114938f, 0.736374319f},
-std::array<float,2>{0.639954031f, 0.322277337f},
-std::array<float,2>{0.689611793f, 0.929871559f},
-std::array<float,2>{0.369688392f, 0.216925651f},
-std::array<float,2>{0.17303367f, 0.634150326f},
-std::array<float,2>{0.914571404f, 0.293067396f},
-std::array<float,2>{0.829594731f, 0.609657109f},
-std::array<float,2>{0.0155987339f, 0.449426234f},
-std::array<float,2>{0.424393624f, 0.750279367f},
-std::array<float,2>{0.530254662f, 0.0689026192f},
-std::array<float,2>{0.578358829f, 0.749449849f},
-std::array<float,2>{0.495001316f, 0.316380858f},
-std::array<float,2>{0.0998773128f, 0.957252741f},
-std::array<float,2>{0.757263601f, 0.160379693f},
-std::array<float,2>{0.980656028f, 0.870967388f},
-std::array<float,2>{0.218817919f, 0.0576822758f},
-std::array<float,2>{0.288803339f, 0.536610961f},
-std::array<float,2>{0.675366938f, 0.389761776f},
-std::array<float,2>{0.543604553f, 0.811749339f},
-std::array<float,2>{0.398956686f, 0.11115136f},
-std::array<float,2>{0.0338605456f, 0.589601934f},
-std::array<float,2>{0.860341609f, 0.495793253f},
-std::array<float,2>{0.899890304f, 0.67730689f},
-std::array<float,2>{0.149029389f, 0.250439227f},
-std::array<float,2>{0.342107981f, 0.890946686f},
-std::array<float,2>{0.721978009f, 0.235178307f},
-std::array<float,2>{0.626869619f, 0.507609546f},
-std::array<float,2>{0.251537055f, 0.412616968f},
-std::array<float,2>{0.202632055f, 0.821509063f},
-std::array<float,2>{0.946702421f, 0.00118313369f},
-std::array<float,2>{0.790369153f, 0.976133347f},
-std::array<float,2>{0.0626722276f, 0.149121761f},
-std::array<float,2>{0.451560676f, 0.696709275f},
-std::array<float,2>{0.605590045f, 0.364528865f},
-std::array<float,2>{0.621860504f, 0.952150404f},
-std::array<float,2>{0.46543169f, 0.177230284f},
-std::array<float,2>{0.0824560598f, 0.733265817f},
-std::array<float,2>{0.812430322f, 0.335810214f},
-std::array<float,2>{0.964580238f, 0.551543832f},
-std::array<float,2>{0.212595209f, 0.400962949f},
-std::array<float,2>{0.26674971f, 0.849057019f},
-std::array<float,2>{0.646652341f, 0.0373168029f},
-std::array<float,2>{0.736338615f, 0.651913047f},
-std::array<float,2>{0.325208515f, 0.303967834f},
-std::array<float,2>{0.129167601f, 0.91554296f},
-std::array<float,2>{0.887826383f, 0.195836484f},
-std::array<float,2>{0.853715241f, 0.780769587f},
-std::array<float,2>{0.0585155375f, 0.0813185945f},
-std::array<float,2>{0.386370718f, 0.60339582f},
-std::array<float,2>{0.562182665f, 0.453524858f},
-std::array<float,2>{0.658780158f, 0.833392799f},
-std::array<float,2>{0.304549336f, 0.0158569589f},
-std::array<float,2>{0.24242568f, 0.529722631f},
-std::array<float,2>{0.989358366f, 0.430459976f},
-std::array<float,2>{0.767605722f, 0.705874622f},
-std::array<float,2>{0.114094019f, 0.344623119f},
-std::array<float,2>{0.480552405f, 0.987025857f},
-std::array<float,2>{0.56438607f, 0.127717674f},
-std::array<float,2>{0.505729854f, 0.569408119f},
-std::array<float,2>{0.41207996f, 0.47510305f},
-std::array<float,2>{0.0272407699f, 0.784832954f},
-std::array<float,2>{0.814939737f, 0.102227867f},
-std::array<float,2>{0.926959991f, 0.886596441f},
-std::array<float,2>{0.170505881f, 0.225017458f},
-std::array<float,2>{0.344355196f, 0.668879092f},
-std::array<float,2>{0.706843317f, 0.272603631f},
-std::array<float,2>{0.743218362f, 0.956661761f},
-std::array<float,2>{0.314447731f, 0.157463506f},
-std::array<float,2>{0.140328333f, 0.74463892f},
-std::array<float,2>{0.882064939f, 0.317611516f},
-std::array<float,2>{0.846619308f, 0.533659637f},
-std::array<float,2>{0.0493167229f, 0.386706471f},
-std::array<float,2>{0.376323313f, 0.8726089f},
-std::array<float,2>{0.5519979f, 0.0592560768f},
-std::array<float,2>{0.611944973f, 0.638677001f},
-std::array<float,2>{0.454608619f, 0.291389823f},
-std::array<float,2>{0.0905499831f, 0.936444521f},
-std::array<float,2>{0.79834348f, 0.211825565f},
-std::array<float,2>{0.956569135f, 0.755325913f},
-std::array<float,2>{0.206007019f, 0.0653007403f},
-std::array<float,2>{0.276223958f, 0.614283919f},
-std::array<float,2>{0.651878119f, 0.448887616f},
-std::array<float,2>{0.511272013f, 0.826328754f},
-std::array<float,2>{0.419350147f, 0.00517998496f},
-std::array<float,2>{0.0186894108f, 0.502567649f},
-std::array<float,2>{0.827289283f, 0.408665419f},
-std::array<float,2>{0.931758642f, 0.703054786f},
-std::array<float,2>{0.157104999f, 0.360402465f},
-std::array<float,2>{0.354109317f, 0.96917361f},
-std::array<float,2>{0.718679786f, 0.154239431f},
-std::array<float,2>{0.668012917f, 0.590661526f},
-std::array<float,2>{0.306062996f, 0.498118609f},
-std::array<float,2>{0.237941161f, 0.808426261f},
-std::array<float,2>{0.992818177f, 0.11479038f},
-std::array<float,2>{0.777880013f, 0.897992074f},
-std::array<float,2>{0.124547981f, 0.240854859f},
-std::array<float,2>{0.47508046f, 0.674254119f},
-std::array<float,2>{0.570355117f, 0.256097168f},
-std::array<float,2>{0.588858068f, 0.918091834f},
-std::array<float,2>{0.48572886f, 0.199528337f},
-std::array<float,2>{0.108764559f, 0.654514253f},
-std::array<float,2>{0.76559186f, 0.299820781f},
-std::array<float,2>{0.972958684f, 0.607559144f},
-std::array<float,2>{0.232062027f, 0.45925644f},
-std::array<float,2>{0.289135098f, 0.775876105f},
-std::array<float,2>{0.683694422f, 0.0833006501f},
-std::array<float,2>{0.698816299f, 0.727610648f},
-std::array<float,2>{0.365326136f, 0.33092609f},
-std::array<float,2>{0.185466424f, 0.946763217f},
-std::array<float,2>{0.912205637f, 0.175655097f},
-std::array<float,2>{0.840008199f, 0.845698476f},
-std::array<float,2>{0.00326805818f, 0.0332110785f},
-std::array<float,2>{0.430988818f, 0.549996793f},
-std::array<float,2>{0.518868864f, 0.403057933f},
-std::array<float,2>{0.634302616f, 0.787941337f},
-std::array<float,2>{0.262115031f, 0.10566923f},
-std::array<float,2>{0.193033338f, 0.563107252f},
-std::array<float,2>{0.941790462f, 0.470919162f},
-std::array<float,2>{0.788348913f, 0.664065003f},
-std::array<float,2>{0.0753874183f, 0.269527376f},
-std::array<float,2>{0.439535558f, 0.88968873f},
-std::array<float,2>{0.601259828f, 0.219737351f},
-std::array<float,2>{0.532857001f, 0.526970387f},
-std::array<float,2>{0.396576673f, 0.434730589f},
-std::array<float,2>{0.040212851f, 0.828221381f},
-std::array<float,2>{0.869071424f, 0.0198773686f},
-std::array<float,2>{0.897800803f, 0.991324782f},
-std::array<float,2>{0.143916994f, 0.131838024f},
-std::array<float,2>{0.332008898f, 0.708379984f},
-std::array<float,2>{0.732002199f, 0.348390758f},
-std::array<float,2>{0.67749244f, 0.881803453f},
-std::array<float,2>{0.283181518f, 0.22727111f},
-std::array<float,2>{0.226242915f, 0.660240293f},
-std::array<float,2>{0.977020681f, 0.276385844f},
-std::array<float,2>{0.751965642f, 0.577885747f},
-std::array<float,2>{0.0970906466f, 0.479642868f},
-std::array<float,2>{0.49802953f, 0.792564094f},
-std::array<float,2>{0.583489597f, 0.0999279469f},
-std::array<float,2>{0.525126934f, 0.717929363f},
-std::array<float,2>{0.42819342f, 0.354604572f},
-std::array<float,2>{0.00784362946f, 0.998615265f},
-std::array<float,2>{0.833293259f, 0.136696681f},
-std::array<float,2>{0.920687556f, 0.836362779f},
-std::array<float,2>{0.177108809f, 0.027226923f},
-std::array<float,2>{0.371172994f, 0.519091487f},
-std::array<float,2>{0.691495597f, 0.421882331f},
-std::array<float,2>{0.60182029f, 0.771241844f},
-std::array<float,2>{0.445370018f, 0.091804333f},
-std::array<float,2>{0.0665320531f, 0.600927353f},
-std::array<float,2>{0.794765413f, 0.466072291f},
-std::array<float,2>{0.950537682f, 0.641294241f},
-std::array<float,2>{0.19554244f, 0.312300712f},
-std::array<float,2>{0.256793708f, 0.910093844f},
-std::array<float,2>{0.630609751f, 0.192804784f},
-std::array<float,2>{0.725790322f, 0.562226355f},
-std::array<float,2>{0.336950183f, 0.397504747f},
-std::array<float,2>{0.155525073f, 0.854445159f},
-std::array<float,2>{0.902378082f, 0.0423095822f},
-std::array<float,2>{0.864802897f, 0.944572389f},
-std::array<float,2>{0.0372686908f, 0.18431212f},
-std::array<float,2>{0.402975976f, 0.721467793f},
-std::array<float,2>{0.542072833f, 0.340500414f},
-std::array<float,2>{0.555211365f, 0.979035258f},
-std::array<float,2>{0.387700051f, 0.141973138f},
-std::array<float,2>{0.0618866235f, 0.692479312f},
-std::array<float,2>{0.858821094f, 0.373829931f},
-std::array<float,2>{0.884947658f, 0.512859106f},
-std::array<float,2>{0.127511919f, 0.416844338f},
-std::array<float,2>{0.323942244f, 0.818104506f},
-std::array<float,2>{0.741482794f, 0.0134958578f},
-std::array<float,2>{0.641904473f, 0.683246017f},
-std::array<float,2>{0.271289319f, 0.259982914f},
-std::array<float,2>{0.217946649f, 0.904768944f},
-std::array<float,2>{0.967137039f, 0.249883547f},
-std::array<float,2>{0.807571888f, 0.803653359f},
-std::array<float,2>{0.0812830031f, 0.122039028f},
-std::array<float,2>{0.462050289f, 0.58218801f},
-std::array<float,2>{0.61832422f, 0.487589598f},
-std::array<float,2>{0.709832609f, 0.860261738f},
-std::array<float,2>{0.350562215f, 0.0529941283f},
-std::array<float,2>{0.166805878f, 0.540573597f},
-std::array<float,2>{0.925160587f, 0.375138432f},
-std::array<float,2>{0.820145845f, 0.738644123f},
-std::array<float,2>{0.0294631664f, 0.325829774f},
-std::array<float,2>{0.406919658f, 0.962007999f},
-std::array<float,2>{0.502315462f, 0.169791937f},
-std::array<float,2>{0.566778481f, 0.6248945f},
-std::array<float,2>{0.479363739f, 0.44206053f},
-std::array<float,2>{0.110141315f, 0.757975876f},
-std::array<float,2>{0.772145629f, 0.0740208402f},
-std::array<float,2>{0.987886429f, 0.928072095f},
-std::array<float,2>{0.249873266f, 0.205382928f},
-std::array<float,2>{0.299890846f, 0.631237924f},
-std::array<float,2>{0.660727859f, 0.281975269f},
-std::array<float,2>{0.667187333f, 0.939994693f},
-std::array<float,2>{0.311420262f, 0.181339949f},
-std::array<float,2>{0.240061522f, 0.725571454f},
-std::array<float,2>{0.999576032f, 0.335937709f},
-std::array<float,2>{0.776355505f, 0.555504262f},
-std::array<float,2>{0.120127998f, 0.392183423f},
-std::array<float,2>{0.472287655f, 0.858679831f},
-std::array<float,2>{0.57620883f, 0.0440242253f},
-std::array<float,2>{0.514389813f, 0.648331165f},
-std::array<float,2>{0.417586863f, 0.306590885f},
-std::array<float,2>{0.0220361259f, 0.911902428f},
-std::array<float,2>{0.823047876f, 0.18866013f},
-std::array<float,2>{0.936110258f, 0.767288268f},
-std::array<float,2>{0.161624491f, 0.087903589f},
-std::array<float,2>{0.355819702f, 0.59500587f},
-std::array<float,2>{0.712272584f, 0.462495357f},
-std::array<float,2>{0.617009282f, 0.843617022f},
-std::array<float,2>{0.458917469f, 0.0309093818f},
-std::array<float,2>{0.0864376277f, 0.52115798f},
-std::array<float,2>{0.801413357f, 0.426900119f},
-std::array<float,2>{0.959541559f, 0.714670181f},
-std::array<float,2>{0.20943822f, 0.35646686f},
-std::array<float,2>{0.279572159f, 0.995731831f},
-std::array<float,2>{0.652420819f, 0.137936264f},
-std::array<float,2>{0.749516368f, 0.572302401f},
-std::array<float,2>{0.319827586f, 0.484020144f},
-std::array<float,2>{0.136522636f, 0.795622468f},
-std::array<float,2>{0.876042485f, 0.0941215158f},
-std::array<float,2>{0.849796176f, 0.878341436f},
-std::array<float,2>{0.0518113114f, 0.232084617f},
-std::array<float,2>{0.38167575f, 0.657647729f},
-std::array<float,2>{0.54955554f, 0.279295951f},
-std::array<float,2>{0.538896084f, 0.922018886f},
-std::array<float,2>{0.393945187f, 0.208009273f},
-std::array<float,2>{0.0466486476f, 0.627061248f},
-std::array<float,2>{0.874149978f, 0.287877858f},
-std::array<float,2>{0.892127275f, 0.617912292f},
-std::array<float,2>{0.146328539f, 0.437760741f},
-std::array<float,2>{0.333056867f, 0.762773454f},
-std::array<float,2>{0.728319824f, 0.0774134472f},
-std::array<float,2>{0.637234569f, 0.735741496f},
-std::array<float,2>{0.258766234f, 0.322128564f},
-std::array<float,2>{0.188472882f, 0.966813445f},
-std::array<float,2>{0.938032389f, 0.165172547f},
-std::array<float,2>{0.781411707f, 0.864105582f},
-std::array<float,2>{0.0725245327f, 0.0469706506f},
-std::array<float,2>{0.442056388f, 0.546756327f},
-std::array<float,2>{0.596380413f, 0.380669117f},
-std::array<float,2>{0.70096308f, 0.798127174f},
-std::array<float,2>{0.361700088f, 0.118921369f},
-std::array<float,2>{0.180684626f, 0.581518054f},
-std::array<float,2>{0.909892678f, 0.4897663f},
-std::array<float,2>{0.836395025f, 0.685744524f},
-std::array<float,2>{0.00504538324f, 0.262796998f},
-std::array<float,2>{0.435274005f, 0.899777949f},
-std::array<float,2>{0.521534979f, 0.243452236f},
-std::array<float,2>{0.592583418f, 0.508673251f},
-std::array<float,2>{0.489893556f, 0.421735525f},
-std::array<float,2>{0.102327935f, 0.812691867f},
-std::array<float,2>{0.759679675f, 0.010112402f},
-std::array<float,2>{0.969196558f, 0.982872128f},
-std::array<float,2>{0.227893427f, 0.145102322f},
-std::array<float,2>{0.293977708f, 0.688959837f},
-std::array<float,2>{0.681897283f, 0.37091881f},
-std::array<float,2>{0.72046715f, 0.893585861f},
-std::array<float,2>{0.339973092f, 0.238044828f},
-std::array<float,2>{0.151423022f, 0.679410815f},
-std::array<float,2>{0.901772857f, 0.253569603f},
-std::array<float,2>{0.863129318f, 0.586113155f},
-std::array<float,2>{0.0314616039f, 0.492641032f},
-std::array<float,2>{0.401316792f, 0.810034454f},
-std::array<float,2>{0.54673481f, 0.113229901f},
-std::array<float,2>{0.607505143f, 0.697883129f},
-std::array<float,2>{0.449742079f, 0.366678089f},
-std::array<float,2>{0.0653906018f, 0.973549962f},
-std::array<float,2>{0.792539716f, 0.151884049f},
-std::array<float,2>{0.948310018f, 0.823282659f},
-std::array<float,2>{0.200064391f, 0.00289924396f},
-std::array<float,2>{0.25276649f, 0.504863024f},
-std::array<float,2>{0.62701726f, 0.410660625f},
-std::array<float,2>{0.52921468f, 0.752730787f},
-std::array<float,2>{0.421972603f, 0.0666337833f},
-std::array<float,2>{0.0122552821f, 0.612800002f},
-std::array<float,2>{0.831394613f, 0.452594995f},
-std::array<float,2>{0.917850256f, 0.636698604f},
-std::array<float,2>{0.174519569f, 0.294971347f},
-std::array<float,2>{0.367887974f, 0.933349669f},
-std::array<float,2>{0.688830376f, 0.216682732f},
-std::array<float,2>{0.673636377f, 0.538689852f},
-std::array<float,2>{0.286577761f, 0.387815952f},
-std::array<float,2>{0.222216576f, 0.868011236f},
-std::array<float,2>{0.98255825f, 0.056495402f},
-std::array<float,2>{0.755211055f, 0.960794389f},
-std::array<float,2>{0.0980835333f, 0.16216515f},
-std::array<float,2>{0.492974788f, 0.746390224f},
-std::array<float,2>{0.580714166f, 0.312599927f},
-std::array<float,2>{0.565277219f, 0.985627949f},
-std::array<float,2>{0.48289904f, 0.125130534f},
-std::array<float,2>{0.11690519f, 0.703456223f},
-std::array<float,2>{0.767543674f, 0.346903503f},
-std::array<float,2>{0.991871953f, 0.527985513f},
-std::array<float,2>{0.24571085f, 0.432366282f},
-std::array<float,2>{0.301915675f, 0.834607184f},
-std::array<float,2>{0.657501936f, 0.0189691279f},
-std::array<float,2>{0.704145193f, 0.671585798f},
-std::array<float,2>{0.347537547f, 0.270465076f},
-std::array<float,2>{0.169744536f, 0.884595633f},
-std::array<float,2>{0.928507328f, 0.224062726f},
-std::array<float,2>{0.813142836f, 0.781821787f},
-std::array<float,2>{0.0244529508f, 0.10370785f},
-std::array<float,2>{0.413976908f, 0.567451954f},
-std::array<float,2>{0.506780386f, 0.473266155f},
-std::array<float,2>{0.645297647f, 0.851198733f},
-std::array<float,2>{0.268222094f, 0.0353985652f},
-std::array<float,2>{0.213699475f, 0.553959787f},
-std::array<float,2>{0.961913168f, 0.40016678f},
-std::array<float,2>{0.808631063f, 0.732417703f},
-std::array<float,2>{0.0856107995f, 0.332950294f},
-std::array<float,2>{0.466993153f, 0.950223863f},
-std::array<float,2>{0.624178112f, 0.17836839f},
-std::array<float,2>{0.558912694f, 0.603775918f},
-std::array<float,2>{0.383304358f, 0.456700176f},
-std::array<float,2>{0.0551932044f, 0.779135108f},
-std::array<float,2>{0.852344871f, 0.0784768313f},
-std::array<float,2>{0.889306247f, 0.917176902f},
-std::array<float,2>{0.131994888f, 0.197950855f},
-std::array<float,2>{0.326779127f, 0.650025964f},
-std::array<float,2>{0.736104608f, 0.301024407f},
-std::array<float,2>{0.715518296f, 0.971774161f},
-std::array<float,2>{0.352431625f, 0.155710742f},
-std::array<float,2>{0.158440381f, 0.69982183f},
-std::array<float,2>{0.930955768f, 0.361529291f},
-std::array<float,2>{0.825424194f, 0.501561821f},
-std::array<float,2>{0.0173550323f, 0.406590879f},
-std::array<float,2>{0.420651287f, 0.825213552f},
-std::array<float,2>{0.508043289f, 0.00639921287f},
-std::array<float,2>{0.574057579f, 0.672789335f},
-std::array<float,2>{0.474462569f, 0.254368275f},
-std::array<float,2>{0.122721814f, 0.89535588f},
-std::array<float,2>{0.779424131f, 0.238787621f},
-std::array<float,2>{0.994920671f, 0.805109918f},
-std::array<float,2>{0.235734865f, 0.116569117f},
-std::array<float,2>{0.307168275f, 0.592030466f},
-std::array<float,2>{0.670411646f, 0.497349352f},
-std::array<float,2>{0.554543316f, 0.873606324f},
-std::array<float,2>{0.377858013f, 0.062494766f},
-std::array<float,2>{0.0470396392f, 0.532023132f},
-std::array<float,2>{0.844615459f, 0.38419643f},
-std::array<float,2>{0.880734861f, 0.743893027f},
-std::array<float,2>{0.137733698f, 0.320308626f},
-std::array<float,2>{0.315389633f, 0.954133034f},
-std::array<float,2>{0.744902253f, 0.159449697f},
-std::array<float,2>{0.649324238f, 0.61546123f},
-std::array<float,2>{0.275349259f, 0.445923507f},
-std::array<float,2>{0.203212082f, 0.7564888f},
-std::array<float,2>{0.953851044f, 0.063918829f},
-std::array<float,2>{0.799970031f, 0.933791339f},
-std::array<float,2>{0.0936309546f, 0.213170201f},
-std::array<float,2>{0.457014233f, 0.636898696f},
-std::array<float,2>{0.610587895f, 0.290223658f},
-std::array<float,2>{0.598437488f, 0.887690842f},
-std::array<float,2>{0.439369857f, 0.221317574f},
-std::array<float,2>{0.077839002f, 0.666442573f},
-std::array<float,2>{0.78560847f, 0.267414719f},
-std::array<float,2>{0.94359529f, 0.564889431f},
-std::array<float,2>{0.193552464f, 0.469950318f},
-std::array<float,2>{0.264507234f, 0.786975265f},
-std::array<float,2>{0.635027289f, 0.108671717f},
-std::array<float,2>{0.732566714f, 0.709706306f},
-std::array<float,2>{0.328707963f, 0.351179093f},
-std::array<float,2>{0.142020449f, 0.989727139f},
-std::array<float,2>{0.895177484f, 0.129276156f},
-std::array<float,2>{0.869277477f, 0.831482649f},
-std::array<float,2>{0.0427123383f, 0.0218991004f},
-std::array<float,2>{0.39618969f, 0.523518145f},
-std::array<float,2>{0.534139991f, 0.437443376f},
-std::array<float,2>{0.686197996f, 0.773676276f},
-std::array<float,2>{0.291344225f, 0.085703142f},
-std::array<float,2>{0.23426795f, 0.607271075f},
-std::array<float,2>{0.974923432f, 0.457689136f},
-std::array<float,2>{0.76355046f, 0.652746975f},
-std::array<float,2>{0.106921196f, 0.297317058f},
-std::array<float,2>{0.487297356f, 0.92105782f},
-std::array<float,2>{0.586814463f, 0.202782482f},
-std::array<float,2>{0.51657474f, 0.547591746f},
-std::array<float,2>{0.433508515f, 0.404714137f},
-std::array<float,2>{0.00109317887f, 0.846671462f},
-std::array<float,2>{0.842633426f, 0.0314799435f},
-std::array<float,2>{0.910255194f, 0.947871029f},
-std::array<float,2>{0.186124697f, 0.173712015f},
-std::array<float,2>{0.363925129f, 0.729211688f},
-std::array<float,2>{0.696162641f, 0.328813821f},
-std::array<float,2>{0.632034242f, 0.907819927f},
-std::array<float,2>{0.254652768f, 0.194995984f},
-std::array<float,2>{0.198851392f, 0.643571556f},
-std::array<float,2>{0.951647639f, 0.309064686f},
-std::array<float,2>{0.795731127f, 0.598988175f},
-std::array<float,2>{0.0691380873f, 0.468593389f},
-std::array<float,2>{0.448102474f, 0.772301853f},
-std::array<float,2>{0.604545712f, 0.091530636f},
-std::array<float,2>{0.540296257f, 0.720324159f},
-std::array<float,2>{0.406185389f, 0.342652053f},
-std::array<float,2>{0.0359072089f, 0.942134619f},
-std::array<float,2>{0.866665304f, 0.186075553f},
-std::array<float,2>{0.904559195f, 0.853148282f},
-std::array<float,2>{0.152936548f, 0.0397245847f},
-std::array<float,2>{0.339226305f, 0.558909774f},
-std::array<float,2>{0.723482609f, 0.396167189f},
-std::array<float,2>{0.584895909f, 0.789420128f},
-std::array<float,2>{0.49963972f, 0.0993929878f},
-std::array<float,2>{0.0948475376f, 0.574819386f},
-std::array<float,2>{0.750562489f, 0.477982014f},
-std::array<float,2>{0.978948355f, 0.663418055f},
-std::array<float,2>{0.224074796f, 0.274282992f},
-std::array<float,2>{0.283674687f, 0.87958622f},
-std::array<float,2>{0.679576039f, 0.22907488f},
-std::array<float,2>{0.694996357f, 0.517577589f},
-std::array<float,2>{0.374187499f, 0.424096704f},
-std::array<float,2>{0.179479271f, 0.839005888f},
-std::array<float,2>{0.919210553f, 0.0243337769f},
-std::array<float,2>{0.835511208f, 0.996982694f},
-std::array<float,2>{0.0113967797f, 0.133709773f},
-std::array<float,2>{0.426433355f, 0.716567218f},
-std::array<float,2>{0.525652111f, 0.352441251f},
-std::array<float,2>{0.501952529f, 0.964788795f},
-std::array<float,2>{0.409929872f, 0.170599639f},
-std::array<float,2>{0.0285597183f, 0.740439951f},
-std::array<float,2>{0.817726314f, 0.326565772f},
-std::array<float,2>{0.923378825f, 0.542054415f},
-std::array<float,2>{0.164878502f, 0.377888381f},
-std::array<float,2>{0.349139363f, 0.861600161f},
-std::array<float,2>{0.707137167f, 0.0513024256f},
-std::array<float,2>{0.662960947f, 0.630081236f},
-std::array<float,2>{0.297176242f, 0.283950031f},
-std::array<float,2>{0.246152684f, 0.926668227f},
-std::array<float,2>{0.985595226f, 0.203844219f},
-std::array<float,2>{0.770215213f, 0.760746241f},
-std::array<float,2>{0.112102464f, 0.0708712861f},
-std::array<float,2>{0.47697106f, 0.621687949f},
-std::array<float,2>{0.568615675f, 0.445270449f},
-std::array<float,2>{0.739336967f, 0.81945312f},
-std::array<float,2>{0.321886271f, 0.0138396136f},
-std::array<float,2>{0.125664294f, 0.515577734f},
-std::array<float,2>{0.884741426f, 0.415617168f},
-std::array<float,2>{0.856777549f, 0.693873286f},
-std::array<float,2>{0.0589575656f, 0.371182323f},
-std::array<float,2>{0.390226007f, 0.976944149f},
-std::array<float,2>{0.55791676f, 0.143209755f},
-std::array<float,2>{0.620449662f, 0.584149301f},
-std::array<float,2>{0.463487446f, 0.484610021f},
-std::array<float,2>{0.0791770965f, 0.802549541f},
-std::array<float,2>{0.804738104f, 0.123248763f},
-std::array<float,2>{0.966251671f, 0.902660966f},
-std::array<float,2>{0.216691226f, 0.247934908f},
-std::array<float,2>{0.271928936f, 0.681568086f},
-std::array<float,2>{0.64340812f, 0.258749932f},
-std::array<float,2>{0.647170365f, 0.951084316f},
-std::array<float,2>{0.26736787f, 0.178219587f},
-std::array<float,2>{0.212314427f, 0.731869578f},
-std::array<float,2>{0.963967383f, 0.33232221f},
-std::array<float,2>{0.811677814f, 0.554627001f},
-std::array<float,2>{0.0826878473f, 0.399829298f},
-std::array<float,2>{0.465231985f, 0.850753903f},
-std::array<float,2>{0.621363699f, 0.0361305252f},
-std::array<float,2>{0.561524391f, 0.649735093f},
-std::array<float,2>{0.385809958f, 0.301738322f},
-std::array<float,2>{0.0578748733f, 0.917916358f},
-std::array<float,2>{0.854339182f, 0.19765085f},
-std::array<float,2>{0.888319135f, 0.778648436f},
-std::array<float,2>{0.12963669f, 0.0790204257f},
-std::array<float,2>{0.325691909f, 0.604129732f},
-std::array<float,2>{0.737224638f, 0.456113726f},
-std::array<float,2>{0.563633442f, 0.834146917f},
-std::array<float,2>{0.481129915f, 0.0194007754f},
-std::array<float,2>{0.113324612f, 0.527575552f},
-std::array<float,2>{0.76821816f, 0.431796432f},
-std::array<float,2>{0.989749134f, 0.703955948f},
-std::array<float,2>{0.243093461f, 0.347360432f},
-std::array<float,2>{0.303860515f, 0.985911012f},
-std::array<float,2>{0.658427596f, 0.125844747f},
-std::array<float,2>{0.70647651f, 0.567919612f},
-std::array<float,2>{0.343822092f, 0.47306487f},
-std::array<float,2>{0.170139685f, 0.78165406f},
-std::array<float,2>{0.927366078f, 0.104441337f},
-std::array<float,2>{0.815126836f, 0.883853912f},
-std::array<float,2>{0.0267030522f, 0.224402338f},
-std::array<float,2>{0.411602914f, 0.671342492f},
-std::array<float,2>{0.504934072f, 0.269810557f},
-std::array<float,2>{0.529628992f, 0.932617843f},
-std::array<float,2>{0.424031436f, 0.216063783f},
-std::array<float,2>{0.0148127172f, 0.635925531f},
-std::array<float,2>{0.829382539f, 0.295856118f},
-std::array<float,2>{0.914419949f, 0.612653255f},
-std::array<float,2>{0.173596501f, 0.453070968f},
-std::array<float,2>{0.369231313f, 0.752020895f},
-std::array<float,2>{0.690399051f, 0.0669670925f},
-std::array<float,2>{0.674966931f, 0.746932268f},
-std::array<float,2>{0.288319945f, 0.313284099f},
-std::array<float,2>{0.219283834f, 0.96033591f},
-std::array<float,2>{0.981388092f, 0.163063467f},
-std::array<float,2>{0.757781804f, 0.867497504f},
-std::array<float,2>{0.100122705f, 0.0559169799f},
-std::array<float,2>{0.494567215f, 0.538222134f},
-std::array<float,2>{0.578633547f, 0.38823086f},
-std::array<float,2>{0.722192764f, 0.810074508f},
-std::array<float,2>{0.342622787f, 0.112761967f},
-std::array<float,2>{0.148904234f, 0.586443841f},
-std::array<float,2>{0.900341451f, 0.492936045f},
-std::array<float,2>{0.859657407f, 0.678797781f},
-std::array<float,2>{0.0336384736f, 0.253193229f},
-std::array<float,2>{0.39881435f, 0.894452274f},
-std::array<float,2>{0.543038428f, 0.237685218f},
-std::array<float,2>{0.606099188f, 0.504085958f},
-std::array<float,2>{0.451838255f, 0.410308778f},
-std::array<float,2>{0.063159503f, 0.824195862f},
-std::array<float,2>{0.790980518f, 0.00232741446f},
-std::array<float,2>{0.947174132f, 0.97272712f},
-std::array<float,2>{0.203004956f, 0.151686937f},
-std::array<float,2>{0.251291811f, 0.697289705f},
-std::array<float,2>{0.626027584f, 0.366950154f},
-std::array<float,2>{0.701893628f, 0.900195897f},
-std::array<float,2>{0.361168683f, 0.243759841f},
-std::array<float,2>{0.182655931f, 0.686165929f},
-std::array<float,2>{0.906887293f, 0.26323235f},
-std::array<float,2>{0.838559985f, 0.581619859f},
-std::array<float,2>{0.00699162623f, 0.489707351f},
-std::array<float,2>{0.43667841f, 0.798694193f},
-std::array<float,2>{0.52068007f, 0.118436523f},
-std::array<float,2>{0.591718614f, 0.689338446f},
-std::array<float,2>{0.491615802f, 0.370220214f},
-std::array<float,2>{0.103945933f, 0.983003736f},
-std::array<float,2>{0.761400759f, 0.144640729f},
-std::array<float,2>{0.972108483f, 0.813215494f},
-std::array<float,2>{0.228811696f, 0.0103745339f},
-std::array<float,2>{0.295887738f, 0.508081019f},
-std::array<float,2>{0.68107456f, 0.421055764f},
-std::array<float,2>{0.536138535f, 0.763308823f},
-std::array<float,2>{0.391306162f, 0.0778387934f},
-std::array<float,2>{0.0437899567f, 0.617442787f},
-std::array<float,2>{0.872501612f, 0.438265413f},
-std::array<float,2>{0.893142223f, 0.627777159f},
-std::array<float,2>{0.148404762f, 0.28742668f},
-std::array<float,2>{0.334444314f, 0.922698021f},
-std::array<float,2>{0.729844093f, 0.20853816f},
-std::array<float,2>{0.640402496f, 0.546178639f},
-std::array<float,2>{0.260278046f, 0.380237192f},
-std::array<float,2>{0.190233037f, 0.863622785f},
-std::array<float,2>{0.940642059f, 0.0476791896f},
-std::array<float,2>{0.784743071f, 0.96775645f},
-std::array<float,2>{0.0717015415f, 0.165861651f},
-std::array<float,2>{0.44504723f, 0.735921323f},
-std::array<float,2>{0.594947159f, 0.321570039f},
-std::array<float,2>{0.61364311f, 0.995512724f},
-std::array<float,2>{0.460391343f, 0.138246253f},
-std::array<float,2>{0.0885699242f, 0.714154899f},
-std::array<float,2>{0.803606927f, 0.357060969f},
-std::array<float,2>{0.958189368f, 0.520764232f},
-std::array<float,2>{0.208555385f, 0.427355677f},
-std::array<float,2>{0.277434021f, 0.842984855f},
-std::array<float,2>{0.654539585f, 0.0307256207f},
-std::array<float,2>{0.747523487f, 0.658163011f},
-std::array<float,2>{0.316813648f, 0.278439313f},
-std::array<float,2>{0.132836714f, 0.878755271f},
-std::array<float,2>{0.877458453f, 0.231486663f},
-std::array<float,2>{0.849030614f, 0.795219839f},
-std::array<float,2>{0.0544488542f, 0.0945804045f},
-std::array<float,2>{0.379235834f, 0.572964787f},
-std::array<float,2>{0.548162997f, 0.483828723f},
-std::array<float,2>{0.665791333f, 0.858962536f},
-std::array<float,2>{0.310155779f, 0.0446221307f},
-std::array<float,2>{0.240304932f, 0.55503875f},
-std::array<float,2>{0.998040736f, 0.392035007f},
-std::array<float,2>{0.773660541f, 0.725057781f},
-std::array<float,2>{0.117223039f, 0.336756229f},
-std::array<float,2>{0.468911707f, 0.939847291f},
-std::array<float,2>{0.575920284f, 0.18113178f},
-std::array<float,2>{0.513233602f, 0.595638514f},
-std::array<float,2>{0.41519776f, 0.461968869f},
-std::array<float,2>{0.0198237896f, 0.766762853f},
-std::array<float,2>{0.821757615f, 0.0885311961f},
-std::array<float,2>{0.934139013f, 0.911419809f},
-std::array<float,2>{0.162703872f, 0.189070195f},
-std::array<float,2>{0.358991534f, 0.647781909f},
-std::array<float,2>{0.714811504f, 0.306127161f},
-std::array<float,2>{0.742100716f, 0.977498889f},
-std::array<float,2>{0.323702335f, 0.142616734f},
-std::array<float,2>{0.127090245f, 0.693478763f},
-std::array<float,2>{0.885285795f, 0.371997446f},
-std::array<float,2>{0.858996093f, 0.514725566f},
-std::array<float,2>{0.0621099472f, 0.415287793f},
-std::array<float,2>{0.388466001f, 0.82017231f},
-std::array<float,2>{0.554908335f, 0.0142458733f},
-std::array<float,2>{0.61882782f, 0.680672169f},
-std::array<float,2>{0.462735444f, 0.257992566f},
-std::array<float,2>{0.0817393064f, 0.902914882f},
-std::array<float,2>{0.806791961f, 0.247451708f},
-std::array<float,2>{0.967590928f, 0.801864564f},
-std::array<float,2>{0.218694299f, 0.123821832f},
-std::array<float,2>{0.270905614f, 0.584886193f},
-std::array<float,2>{0.642251432f, 0.484879762f},
-std::array<float,2>{0.502781749f, 0.862005413f},
-std::array<float,2>{0.40654552f, 0.0508359224f},
-std::array<float,2>{0.0298843291f, 0.542686999f},
-std::array<float,2>{0.819572747f, 0.377141327f},
-std::array<float,2>{0.925718665f, 0.740803123f},
-std::array<float,2>{0.166361123f, 0.326840639f},
-std::array<float,2>{0.349816322f, 0.964317381f},
-std::array<float,2>{0.709131181f, 0.170108408f},
-std::array<float,2>{0.660462379f, 0.621482849f},
-std::array<float,2>{0.300357252f, 0.444423795f},
-std::array<float,2>{0.249309897f, 0.761609256f},
-std::array<float,2>{0.987312376f, 0.0707490519f},
-std::array<float,2>{0.771755517f, 0.926109791f},
-std::array<float,2>{0.109655783f, 0.203258038f},
-std::array<float,2>{0.478756994f, 0.630437493f},
-std::array<float,2>{0.56725347f, 0.283314675f},
-std::array<float,2>{0.583525836f, 0.879143059f},
-std::array<float,2>{0.497337252f, 0.228751406f},
-std::array<float,2>{0.0976079032f, 0.664013386f},
-std::array<float,2>{0.752873003f, 0.2737948f},
-std::array<float,2>{0.97726953f, 0.574569583f},
-std::array<float,2>{0.225647971f, 0.478201896f},
-std::array<float,2>{0.282712638f, 0.789617598f},
-std::array<float,2>{0.677158177f, 0.0988612399f},
-std::array<float,2>{0.692149222f, 0.716027081f},
-std::array<float,2>{0.372003794f, 0.351597875f},
-std::array<float,2>{0.177403077f, 0.996224403f},
-std::array<float,2>{0.920069754f, 0.132968828f},
-std::array<float,2>{0.833883822f, 0.83963573f},
-std::array<float,2>{0.00873716921f, 0.0235402044f},
-std::array<float,2>{0.428308696f, 0.516769588f},
-std::array<float,2>{0.524432242f, 0.424467444f},
-std::array<float,2>{0.629939318f, 0.771965623f},
-std::array<float,2>{0.25586462f, 0.0911188051f},
-std::array<float,2>{0.19612065f, 0.599525154f},
-std::array<float,2>{0.950772345f, 0.468178749f},
-std::array<float,2>{0.794381201f, 0.644235432f},
-std::array<float,2>{0.0673759133f, 0.309203297f},
-std::array<float,2>{0.445887476f, 0.907674849f},
-std::array<float,2>{0.60218823f, 0.194719836f},
-std::array<float,2>{0.542948544f, 0.559508562f},
-std::array<float,2>{0.40243116f, 0.395672798f},
-std::array<float,2>{0.0380707532f, 0.852695644f},
-std::array<float,2>{0.864346027f, 0.0395228863f},
-std::array<float,2>{0.902938962f, 0.94157666f},
-std::array<float,2>{0.155939132f, 0.185598999f},
-std::array<float,2>{0.337890446f, 0.719984651f},
-std::array<float,2>{0.726334512f, 0.342152566f},
-std::array<float,2>{0.684231818f, 0.921558261f},
-std::array<float,2>{0.289556324f, 0.202593878f},
-std::array<float,2>{0.231859758f, 0.653152466f},
-std::array<float,2>{0.973600864f, 0.297804534f},
-std::array<float,2>{0.764858365f, 0.606679559f},
-std::array<float,2>{0.109199978f, 0.457430035f},
-std::array<float,2>{0.485969156f, 0.774243414f},
-std::array<float,2>{0.588007033f, 0.0850759298f},
-std::array<float,2>{0.519499719f, 0.728819728f},
-std::array<float,2>{0.431459248f, 0.328339577f},
-std::array<float,2>{0.0036627776f, 0.947670341f},
-std::array<float,2>{0.840471864f, 0.173220202f},
-std::array<float,2>{0.91268599f, 0.845778584f},
-std::array<float,2>{0.18493326f, 0.031932842f},
-std::array<float,2>{0.365891218f, 0.547062516f},
-std::array<float,2>{0.698585987f, 0.404874235f},
-std::array<float,2>{0.600690126f, 0.786183655f},
-std::array<float,2>{0.440382451f, 0.109120809f},
-std::array<float,2>{0.075766556f, 0.565355122f},
-std::array<float,2>{0.788916349f, 0.470321745f},
-std::array<float,2>{0.941934586f, 0.66664362f},
-std::array<float,2>{0.192739412f, 0.267087072f},
-std::array<float,2>{0.262621373f, 0.886815786f},
-std::array<float,2>{0.633846223f, 0.220767468f},
-std::array<float,2>{0.731723428f, 0.524313807f},
-std::array<float,2>{0.331442684f, 0.43655169f},
-std::array<float,2>{0.144440979f, 0.831806302f},
-std::array<float,2>{0.897991359f, 0.0222827587f},
-std::array<float,2>{0.868630111f, 0.990023613f},
-std::array<float,2>{0.0407103449f, 0.129774779f},
-std::array<float,2>{0.397123218f, 0.709233701f},
-std::array<float,2>{0.532352805f, 0.350859612f},
-std::array<float,2>{0.552682519f, 0.954729021f},
-std::array<float,2>{0.376910865f, 0.159817353f},
-std::array<float,2>{0.0490528569f, 0.743634522f},
-std::array<float,2>{0.84575665f, 0.319667935f},
-std::array<float,2>{0.882663488f, 0.531508267f},
-std::array<float,2>{0.140097007f, 0.38445878f},
-std::array<float,2>{0.313631773f, 0.873495281f},
-std::array<float,2>{0.743841887f, 0.0619479045f},
-std::array<float,2>{0.651836634f, 0.6374771f},
-std::array<float,2>{0.275451481f, 0.290696949f},
-std::array<float,2>{0.205103889f, 0.934084356f},
-std::array<float,2>{0.956180394f, 0.213431343f},
-std::array<float,2>{0.798024774f, 0.756202519f},
-std::array<float,2>{0.0902020261f, 0.0640721023f},
-std::array<float,2>{0.454472989f, 0.615815639f},
-std::array<float,2>{0.611752868f, 0.445596755f},
-std::array<float,2>{0.718135715f, 0.825791955f},
-std::array<float,2>{0.353583336f, 0.00616505323f},
-std::array<float,2>{0.156651407f, 0.501319945f},
-std::array<float,2>{0.932237387f, 0.407220215f},
-std::array<float,2>{0.827893674f, 0.699418783f},
-std::array<float,2>{0.019435266f, 0.362038255f},
-std::array<float,2>{0.419610471f, 0.972324669f},
-std::array<float,2>{0.510911345f, 0.155886382f},
-std::array<float,2>{0.571035802f, 0.592558622f},
-std::array<float,2>{0.475226283f, 0.497673512f},
-std::array<float,2>{0.124365158f, 0.805262208f},
-std::array<float,2>{0.77770555f, 0.116979823f},
-std::array<float,2>{0.992194355f, 0.894768238f},
-std::array<float,2>{0.237646088f, 0.238499984f},
-std::array<float,2>{0.306583792f, 0.672230661f},
-std::array<float,2>{0.668669939f, 0.254729837f},
-std::array<float,2>{0.657893538f, 0.986735404f},
-std::array<float,2>{0.302717984f, 0.127342314f},
-std::array<float,2>{0.245184511f, 0.705332875f},
-std::array<float,2>{0.991322696f, 0.344026089f},
-std::array<float,2>{0.76660502f, 0.530144632f},
-std::array<float,2>{0.116368651f, 0.42994678f},
-std::array<float,2>{0.48334682f, 0.833591819f},
-std::array<float,2>{0.564868152f, 0.0164964814f},
-std::array<float,2>{0.50628531f, 0.668041825f},
-std::array<float,2>{0.413411528f, 0.273130536f},
-std::array<float,2>{0.0250859316f, 0.885978997f},
-std::array<float,2>{0.812829494f, 0.225385144f},
-std::array<float,2>{0.928170145f, 0.784320414f},
-std::array<float,2>{0.169098318f, 0.102012455f},
-std::array<float,2>{0.346738189f, 0.569991648f},
-std::array<float,2>{0.704928875f, 0.474616408f},
-std::array<float,2>{0.62457931f, 0.849592447f},
-std::array<float,2>{0.467516273f, 0.0377286077f},
-std::array<float,2>{0.0852067173f, 0.550992787f},
-std::array<float,2>{0.809137583f, 0.400826454f},
-std::array<float,2>{0.961077332f, 0.732438624f},
-std::array<float,2>{0.212910399f, 0.335152447f},
-std::array<float,2>{0.268029213f, 0.952918768f},
-std::array<float,2>{0.644554794f, 0.177299097f},
-std::array<float,2>{0.735495865f, 0.602929533f},
-std::array<float,2>{0.326400816f, 0.45406422f},
-std::array<float,2>{0.132797435f, 0.7805565f},
-std::array<float,2>{0.888817906f, 0.0819068998f},
-std::array<float,2>{0.851806343f, 0.91530472f},
-std::array<float,2>{0.0548982024f, 0.195474595f},
-std::array<float,2>{0.383051455f, 0.65185082f},
-std::array<float,2>{0.559321165f, 0.304415256f},
-std::array<float,2>{0.546100438f, 0.891458631f},
-std::array<float,2>{0.400561333f, 0.234808147f},
-std::array<float,2>{0.0321516991f, 0.677081048f},
-std::array<float,2>{0.862541258f, 0.250841677f},
-std::array<float,2>{0.902054429f, 0.58918339f},
-std::array<float,2>{0.152072996f, 0.495463789f},
-std::array<float,2>{0.340510637f, 0.812426925f},
-std::array<float,2>{0.719762981f, 0.11076799f},
-std::array<float,2>{0.627732217f, 0.697122037f},
-std::array<float,2>{0.252189487f, 0.365075201f},
-std::array<float,2>{0.199399561f, 0.97580874f},
-std::array<float,2>{0.948965728f, 0.14860481f},
-std::array<float,2>{0.792272151f, 0.821829081f},
-std::array<float,2>{0.0648829415f, 0.00185912766f},
-std::array<float,2>{0.44937411f, 0.506848037f},
-std::array<float,2>{0.607957125f, 0.41218105f},
-std::array<float,2>{0.689015329f, 0.750923872f},
-std::array<float,2>{0.367315173f, 0.0687381104f},
-std::array<float,2>{0.173894718f, 0.610178351f},
-std::array<float,2>{0.917161107f, 0.449891716f},
-std::array<float,2>{0.832027555f, 0.634465516f},
-std::array<float,2>{0.0118724825f, 0.293509185f},
-std::array<float,2>{0.422689348f, 0.930415273f},
-std::array<float,2>{0.528360188f, 0.217512086f},
-std::array<float,2>{0.580430925f, 0.537022412f},
-std::array<float,2>{0.492447704f, 0.390272439f},
-std::array<float,2>{0.0981535986f, 0.870546997f},
-std::array<float,2>{0.755541742f, 0.058577735f},
-std::array<float,2>{0.982930243f, 0.957712233f},
-std::array<float,2>{0.221835539f, 0.161072731f},
-std::array<float,2>{0.286754489f, 0.749639988f},
-std::array<float,2>{0.673326254f, 0.315615743f},
-std::array<float,2>{0.727809489f, 0.924968898f},
-std::array<float,2>{0.333591223f, 0.209121689f},
-std::array<float,2>{0.145794332f, 0.625148714f},
-std::array<float,2>{0.891775548f, 0.286277056f},
-std::array<float,2>{0.874860704f, 0.619490266f},
-std::array<float,2>{0.0459226519f, 0.440685123f},
-std::array<float,2>{0.394327432f, 0.765089929f},
-std::array<float,2>{0.538353801f, 0.0742806196f},
-std::array<float,2>{0.59578222f, 0.736898541f},
-std::array<float,2>{0.441500247f, 0.32277745f},
-std::array<float,2>{0.0732023641f, 0.96510464f},
-std::array<float,2>{0.781748772f, 0.16779162f},
-std::array<float,2>{0.937826514f, 0.865452588f},
-std::array<float,2>{0.187639415f, 0.0503615178f},
-std::array<float,2>{0.257890373f, 0.543059945f},
-std::array<float,2>{0.637169182f, 0.381296784f},
-std::array<float,2>{0.522105396f, 0.80076313f},
-std::array<float,2>{0.434736997f, 0.119567163f},
-std::array<float,2>{0.00569908926f, 0.579218149f},
-std::array<float,2>{0.836654067f, 0.491761535f},
-std::array<float,2>{0.909388244f, 0.683942199f},
-std::array<float,2>{0.181558177f, 0.264844209f},
-std::array<float,2>{0.362176627f, 0.900568068f},
-std::array<float,2>{0.700301945f, 0.244242013f},
-std::array<float,2>{0.68261677f, 0.509881556f},
-std::array<float,2>{0.294600815f, 0.419476807f},
-std::array<float,2>{0.228351235f, 0.816044986f},
-std::array<float,2>{0.969350338f, 0.00791681744f},
-std::array<float,2>{0.759001732f, 0.982205391f},
-std::array<float,2>{0.101896748f, 0.148123398f},
-std::array<float,2>{0.489590287f, 0.689465642f},
-std::array<float,2>{0.592153847f, 0.368115366f},
-std::array<float,2>{0.576678514f, 0.939391255f},
-std::array<float,2>{0.471984029f, 0.18242313f},
-std::array<float,2>{0.121041842f, 0.723380446f},
-std::array<float,2>{0.775571287f, 0.339610994f},
-std::array<float,2>{0.999391854f, 0.557102561f},
-std::array<float,2>{0.239618734f, 0.392946422f},
-std::array<float,2>{0.310931534f, 0.856847644f},
-std::array<float,2>{0.667950928f, 0.0454951972f},
-std::array<float,2>{0.712473214f, 0.644615829f},
-std::array<float,2>{0.356403112f, 0.308291912f},
-std::array<float,2>{0.161214724f, 0.913109243f},
-std::array<float,2>{0.936026454f, 0.190576285f},
-std::array<float,2>{0.822276115f, 0.768268049f},
-std::array<float,2>{0.0216259658f, 0.0865986943f},
-std::array<float,2>{0.417239308f, 0.597452462f},
-std::array<float,2>{0.514086902f, 0.464808792f},
-std::array<float,2>{0.653255224f, 0.840526164f},
-std::array<float,2>{0.280080348f, 0.0290696602f},
-std::array<float,2>{0.209807113f, 0.522558868f},
-std::array<float,2>{0.959412515f, 0.428181291f},
-std::array<float,2>{0.80096221f, 0.710954547f},
-std::array<float,2>{0.0862644911f, 0.357809931f},
-std::array<float,2>{0.458119154f, 0.993553638f},
-std::array<float,2>{0.616351783f, 0.139744237f},
-std::array<float,2>{0.549021721f, 0.570873976f},
-std::array<float,2>{0.381083161f, 0.481896758f},
-std::array<float,2>{0.0526427813f, 0.792972445f},
-std::array<float,2>{0.850120008f, 0.0967834815f},
-std::array<float,2>{0.876804531f, 0.876205444f},
-std::array<float,2>{0.136172608f, 0.23350592f},
-std::array<float,2>{0.319609046f, 0.65990746f},
-std::array<float,2>{0.749224842f, 0.280248493f},
-std::array<float,2>{0.707942307f, 0.962737024f},
-std::array<float,2>{0.348867863f, 0.169234753f},
-std::array<float,2>{0.164103791f, 0.739176512f},
-std::array<float,2>{0.923052549f, 0.325391054f},
-std::array<float,2>{0.817926347f, 0.540341794f},
-std::array<float,2>{0.0292167366f, 0.375669807f},
-std::array<float,2>{0.409623265f, 0.859600842f},
-std::array<float,2>{0.501412392f, 0.0536253005f},
-std::array<float,2>{0.568967521f, 0.631505311f},
-std::array<float,2>{0.477449894f, 0.281404316f},
-std::array<float,2>{0.111345276f, 0.928305209f},
-std::array<float,2>{0.769797862f, 0.205839261f},
-std::array<float,2>{0.985944629f, 0.758788884f},
-std::array<float,2>{0.246656224f, 0.0735384896f},
-std::array<float,2>{0.297618449f, 0.624288857f},
-std::array<float,2>{0.662504017f, 0.441861421f},
-std::array<float,2>{0.55831778f, 0.817749321f},
-std::array<float,2>{0.390087128f, 0.0127406437f},
-std::array<float,2>{0.0593706183f, 0.513401151f},
-std::array<float,2>{0.856992602f, 0.416241825f},
-std::array<float,2>{0.884197891f, 0.693032742f},
-std::array<float,2>{0.125417918f, 0.373262137f},
-std::array<float,2>{0.321746141f, 0.97895807f},
-std::array<float,2>{0.740119934f, 0.142268509f},
-std::array<float,2>{0.642688096f, 0.582853854f},
-std::array<float,2>{0.27244857f, 0.487808168f},
-std::array<float,2>{0.216135189f, 0.803138137f},
-std::array<float,2>{0.966585219f, 0.121366806f},
-std::array<float,2>{0.805296004f, 0.90489608f},
-std::array<float,2>{0.0798871368f, 0.24920024f},
-std::array<float,2>{0.463315129f, 0.682852685f},
-std::array<float,2>{0.620632648f, 0.26053682f},
-std::array<float,2>{0.60500598f, 0.909187555f},
-std::array<float,2>{0.447472215f, 0.193221331f},
-std::array<float,2>{0.0686521009f, 0.640860498f},
-std::array<float,2>{0.795231879f, 0.311903864f},
-std::array<float,2>{0.951940417f, 0.601281464f},
-std::array<float,2>{0.198254392f, 0.466448754f},
-std::array<float,2>{0.253908277f, 0.770635247f},
-std::array<float,2>{0.632410944f, 0.092605941f},
-std::array<float,2>{0.723021567f, 0.721111834f},
-std::array<float,2>{0.339375675f, 0.340287745f},
-std::array<float,2>{0.152351305f, 0.944960713f},
-std::array<float,2>{0.904999256f, 0.183746606f},
-std::array<float,2>{0.866976142f, 0.853634119f},
-std::array<float,2>{0.0352444313f, 0.0425678194f},
-std::array<float,2>{0.405543566f, 0.561610401f},
-std::array<float,2>{0.540924788f, 0.397972226f},
-std::array<float,2>{0.679037392f, 0.792402685f},
-std::array<float,2>{0.283916801f, 0.100238308f},
-std::array<float,2>{0.224263445f, 0.577237785f},
-std::array<float,2>{0.979319036f, 0.480210096f},
-std::array<float,2>{0.750385046f, 0.661030948f},
-std::array<float,2>{0.0956661478f, 0.276988178f},
-std::array<float,2>{0.499227196f, 0.881026268f},
-std::array<float,2>{0.584109128f, 0.226669744f},
-std::array<float,2>{0.526330531f, 0.519026995f},
-std::array<float,2>{0.426004589f, 0.422588825f},
-std::array<float,2>{0.0109090907f, 0.836451113f},
-std::array<float,2>{0.834999979f, 0.0264707897f},
-std::array<float,2>{0.919593751f, 0.998509824f},
-std::array<float,2>{0.178996012f, 0.136063188f},
-std::array<float,2>{0.374970943f, 0.718369961f},
-std::array<float,2>{0.694448352f, 0.355139703f},
-std::array<float,2>{0.635700941f, 0.890165031f},
-std::array<float,2>{0.263935834f, 0.220622033f},
-std::array<float,2>{0.193940476f, 0.664609611f},
-std::array<float,2>{0.944086611f, 0.268556476f},
-std::array<float,2>{0.785668969f, 0.562797129f},
-std::array<float,2>{0.0776164234f, 0.471675307f},
-std::array<float,2>{0.438536674f, 0.787310362f},
-std::array<float,2>{0.597685933f, 0.106344759f},
-std::array<float,2>{0.533319294f, 0.708645582f},
-std::array<float,2>{0.395915806f, 0.347832829f},
-std::array<float,2>{0.0422232002f, 0.991829574f},
-std::array<float,2>{0.869981527f, 0.132656232f},
-std::array<float,2>{0.894895494f, 0.828866124f},
-std::array<float,2>{0.142228678f, 0.0200957414f},
-std::array<float,2>{0.328611434f, 0.526520073f},
-std::array<float,2>{0.733092129f, 0.435463279f},
-std::array<float,2>{0.586318552f, 0.776183963f},
-std::array<float,2>{0.486676216f, 0.0837279856f},
-std::array<float,2>{0.10729593f, 0.608223736f},
-std::array<float,2>{0.763052166f, 0.459715724f},
-std::array<float,2>{0.975394487f, 0.654805005f},
-std::array<float,2>{0.233718604f, 0.30058673f},
-std::array<float,2>{0.291932613f, 0.918803692f},
-std::array<float,2>{0.685641289f, 0.200190172f},
-std::array<float,2>{0.695741057f, 0.550472677f},
-std::array<float,2>{0.363415271f, 0.402606577f},
-std::array<float,2>{0.185565889f, 0.84512645f},
-std::array<float,2>{0.91079998f, 0.0341772139f},
-std::array<float,2>{0.841949701f, 0.947063446f},
-std::array<float,2>{0.00170058315f, 0.175277293f},
-std::array<float,2>{0.43280834f, 0.728127003f},
-std::array<float,2>{0.51588583f, 0.330175161f},
-std::array<float,2>{0.508472502f, 0.969553769f},
-std::array<float,2>{0.420303792f, 0.15371947f},
-std::array<float,2>{0.016768517f, 0.702580273f},
-std::array<float,2>{0.82575798f, 0.361014843f},
-std::array<float,2>{0.931610227f, 0.502197564f},
-std::array<float,2>{0.158826515f, 0.408875167f},
-std::array<float,2>{0.351675093f, 0.827011645f},
-std::array<float,2>{0.715013623f, 0.00576331792f},
-std::array<float,2>{0.670114338f, 0.674345493f},
-std::array<float,2>{0.306668341f, 0.256363153f},
-std::array<float,2>{0.23596257f, 0.897487283f},
-std::array<float,2>{0.99420166f, 0.240687832f},
-std::array<float,2>{0.779938161f, 0.807959735f},
-std::array<float,2>{0.122149691f, 0.114361785f},
-std::array<float,2>{0.473637998f, 0.590139449f},
-std::array<float,2>{0.573540509f, 0.498536348f},
-std::array<float,2>{0.744186103f, 0.872376859f},
-std::array<float,2>{0.314662069f, 0.0586605519f},
-std::array<float,2>{0.138187736f, 0.53402555f},
-std::array<float,2>{0.880251765f, 0.385789186f},
-std::array<float,2>{0.8439762f, 0.744302332f},
-std::array<float,2>{0.0477358289f, 0.318091303f},
-std::array<float,2>{0.377421409f, 0.956308961f},
-std::array<float,2>{0.554026484f, 0.157830998f},
-std::array<float,2>{0.611186445f, 0.614998937f},
-std::array<float,2>{0.45649755f, 0.448481023f},
-std::array<float,2>{0.0929954052f, 0.755431414f},
-std::array<float,2>{0.800506413f, 0.0647766665f},
-std::array<float,2>{0.953485668f, 0.93579483f},
-std::array<float,2>{0.203832448f, 0.21107994f},
-std::array<float,2>{0.274458915f, 0.63939184f},
-std::array<float,2>{0.648627162f, 0.291778833f},
-std::array<float,2>{0.625731051f, 0.974675894f},
-std::array<float,2>{0.250177324f, 0.149793118f},
-std::array<float,2>{0.201804891f, 0.695436954f},
-std::array<float,2>{0.945725501f, 0.363560379f},
-std::array<float,2>{0.78922081f, 0.506443501f},
-std::array<float,2>{0.06411203f, 0.413191319f},
-std::array<float,2>{0.452269495f, 0.821193159f},
-std::array<float,2>{0.607291162f, 0.000550711295f},
-std::array<float,2>{0.544529796f, 0.676641703f},
-std::array<float,2>{0.400325567f, 0.251901776f},
-std::array<float,2>{0.0346384756f, 0.891803205f},
-std::array<float,2>{0.860823333f, 0.235568807f},
-std::array<float,2>{0.899151802f, 0.810738146f},
-std::array<float,2>{0.149648458f, 0.109796047f},
-std::array<float,2>{0.343702555f, 0.588178277f},
-std::array<float,2>{0.721082628f, 0.494617045f},
-std::array<float,2>{0.579200625f, 0.869989157f},
-std::array<float,2>{0.495781571f, 0.0573693886f},
-std::array<float,2>{0.100659311f, 0.536132038f},
-std::array<float,2>{0.756255865f, 0.389446825f},
-std::array<float,2>{0.981668591f, 0.748625219f},
-std::array<float,2>{0.220052958f, 0.315386564f},
-std::array<float,2>{0.288045913f, 0.958302319f},
-std::array<float,2>{0.674368083f, 0.161837712f},
-std::array<float,2>{0.691136658f, 0.610968232f},
-std::array<float,2>{0.370352834f, 0.451050609f},
-std::array<float,2>{0.172301084f, 0.751875281f},
-std::array<float,2>{0.915745676f, 0.0700086281f},
-std::array<float,2>{0.828518927f, 0.931253135f},
-std::array<float,2>{0.0139518082f, 0.218166336f},
-std::array<float,2>{0.425267309f, 0.632906079f},
-std::array<float,2>{0.53097266f, 0.293988258f},
-std::array<float,2>{0.504736781f, 0.885591149f},
-std::array<float,2>{0.410718888f, 0.225830778f},
-std::array<float,2>{0.0256087966f, 0.669552982f},
-std::array<float,2>{0.815743685f, 0.271740645f},
-std::array<float,2>{0.92638731f, 0.568611741f},
-std::array<float,2>{0.171296895f, 0.475791812f},
-std::array<float,2>{0.345493793f, 0.784003258f},
-std::array<float,2>{0.705722511f, 0.103035912f},
-std::array<float,2>{0.659950852f, 0.706133902f},
-std::array<float,2>{0.303584814f, 0.344958425f},
-std::array<float,2>{0.243813887f, 0.98781395f},
-std::array<float,2>{0.988508701f, 0.128555983f},
-std::array<float,2>{0.768717229f, 0.832165301f},
-std::array<float,2>{0.114393406f, 0.01691439f},
-std::array<float,2>{0.481551796f, 0.531108141f},
-std::array<float,2>{0.563361406f, 0.430856854f},
-std::array<float,2>{0.738210499f, 0.779665887f},
-std::array<float,2>{0.324238151f, 0.0802201256f},
-std::array<float,2>{0.130505681f, 0.602183342f},
-std::array<float,2>{0.887410223f, 0.454209089f},
-std::array<float,2>{0.854507864f, 0.650837004f},
-std::array<float,2>{0.0573811568f, 0.303497642f},
-std::array<float,2>{0.384940803f, 0.91452992f},
-std::array<float,2>{0.561391711f, 0.197060123f},
-std::array<float,2>{0.622408211f, 0.552172899f},
-std::array<float,2>{0.465979546f, 0.401776373f},
-std::array<float,2>{0.0834925324f, 0.848286331f},
-std::array<float,2>{0.810695231f, 0.0389696695f},
-std::array<float,2>{0.96350497f, 0.951753914f},
-std::array<float,2>{0.211038306f, 0.175965324f},
-std::array<float,2>{0.266400009f, 0.733402908f},
-std::array<float,2>{0.648244739f, 0.334419489f},
-std::array<float,2>{0.713769674f, 0.912352204f},
-std::array<float,2>{0.35802123f, 0.189475849f},
-std::array<float,2>{0.16360046f, 0.64612484f},
-std::array<float,2>{0.934771836f, 0.307395518f},
-std::array<float,2>{0.820439875f, 0.595863938f},
-std::array<float,2>{0.0214197487f, 0.463731647f},
-std::array<float,2>{0.414420277f, 0.7693488f},
-std::array<float,2>{0.512192488f, 0.0872796923f},
-std::array<float,2>{0.574318528f, 0.723881125f},
-std::array<float,2>{0.470642567f, 0.338297069f},
-std::array<float,2>{0.118258737f, 0.938451529f},
-std::array<float,2>{0.775357962f, 0.183488339f},
-std::array<float,2>{0.996627331f, 0.855597973f},
-std::array<float,2>{0.241963893f, 0.0460457988f},
-std::array<float,2>{0.30931893f, 0.558145761f},
-std::array<float,2>{0.66416806f, 0.394444376f},
-std::array<float,2>{0.547492385f, 0.794120431f},
-std::array<float,2>{0.380647987f, 0.0965364501f},
-std::array<float,2>{0.0536453687f, 0.571496129f},
-std::array<float,2>{0.848411381f, 0.480524778f},
-std::array<float,2>{0.878327012f, 0.659168541f},
-std::array<float,2>{0.134529129f, 0.280429512f},
-std::array<float,2>{0.317476898f, 0.875749171f},
-std::array<float,2>{0.74642241f, 0.233063459f},
-std::array<float,2>{0.655743003f, 0.522241831f},
-std::array<float,2>{0.278755128f, 0.428765088f},
-std::array<float,2>{0.207809597f, 0.840888321f},
-std::array<float,2>{0.957043171f, 0.0279763974f},
-std::array<float,2>{0.804491878f, 0.992643416f},
-std::array<float,2>{0.0889866352f, 0.138904557f},
-std::array<float,2>{0.459912449f, 0.71192807f},
-std::array<float,2>{0.614885509f, 0.359357208f},
-std::array<float,2>{0.594038308f, 0.966779649f},
-std::array<float,2>{0.444227934f, 0.166637421f},
-std::array<float,2>{0.07076855f, 0.737469494f},
-std::array<float,2>{0.783671737f, 0.323464811f},
-std::array<float,2>{0.940081954f, 0.543953359f},
-std::array<float,2>{0.191348284f, 0.382050276f},
-std::array<float,2>{0.261548758f, 0.867065072f},
-std::array<float,2>{0.639522731f, 0.0495345704f},
-std::array<float,2>{0.729182363f, 0.626876593f},
-std::array<float,2>{0.335633278f, 0.285491914f},
-std::array<float,2>{0.146878287f, 0.924404383f},
-std::array<float,2>{0.894201636f, 0.20998992f},
-std::array<float,2>{0.871186793f, 0.76395154f},
-std::array<float,2>{0.0442271009f, 0.0759364367f},
-std::array<float,2>{0.392300218f, 0.620931089f},
-std::array<float,2>{0.535438061f, 0.440229923f},
-std::array<float,2>{0.680491686f, 0.814607739f},
-std::array<float,2>{0.296441704f, 0.00970706064f},
-std::array<float,2>{0.229615584f, 0.510970354f},
-std::array<float,2>{0.971140504f, 0.418551594f},
-std::array<float,2>{0.760684848f, 0.690446079f},
-std::array<float,2>{0.10473901f, 0.368417442f},
-std::array<float,2>{0.490901411f, 0.981163979f},
-std::array<float,2>{0.590393782f, 0.147413626f},
-std::array<float,2>{0.51966393f, 0.579087734f},
-std::array<float,2>{0.436002582f, 0.491009921f},
-std::array<float,2>{0.00667644246f, 0.798994839f},
-std::array<float,2>{0.839557588f, 0.120590359f},
-std::array<float,2>{0.90798521f, 0.901789904f},
-std::array<float,2>{0.182450458f, 0.245826215f},
-std::array<float,2>{0.359769046f, 0.685065627f},
-std::array<float,2>{0.702351868f, 0.263718665f},
-std::array<float,2>{0.725248277f, 0.943896532f},
-std::array<float,2>{0.33614412f, 0.18470785f},
-std::array<float,2>{0.154869556f, 0.722481549f},
-std::array<float,2>{0.903621078f, 0.34112367f},
-std::array<float,2>{0.864055634f, 0.560802996f},
-std::array<float,2>{0.0390532799f, 0.397166669f},
-std::array<float,2>{0.403910339f, 0.854941368f},
-std::array<float,2>{0.54167372f, 0.0411218405f},
-std::array<float,2>{0.603063285f, 0.641778827f},
-std::array<float,2>{0.446377039f, 0.311034352f},
-std::array<float,2>{0.0678701624f, 0.908657074f},
-std::array<float,2>{0.793573976f, 0.192225501f},
-std::array<float,2>{0.950085402f, 0.7700243f},
-std::array<float,2>{0.196745843f, 0.0929776505f},
-std::array<float,2>{0.257098317f, 0.600355148f},
-std::array<float,2>{0.629465044f, 0.465643287f},
-std::array<float,2>{0.524342179f, 0.837288857f},
-std::array<float,2>{0.429177046f, 0.0260835905f},
-std::array<float,2>{0.00931718666f, 0.517896056f},
-std::array<float,2>{0.832682431f, 0.423422635f},
-std::array<float,2>{0.921092331f, 0.717695534f},
-std::array<float,2>{0.176070139f, 0.353797704f},
-std::array<float,2>{0.372671723f, 0.999841809f},
-std::array<float,2>{0.692441642f, 0.135372803f},
-std::array<float,2>{0.676346064f, 0.576850176f},
-std::array<float,2>{0.281850815f, 0.47877261f},
-std::array<float,2>{0.224987939f, 0.791576147f},
-std::array<float,2>{0.977671146f, 0.101364665f},
-std::array<float,2>{0.753271699f, 0.882040441f},
-std::array<float,2>{0.0963107049f, 0.228305474f},
-std::array<float,2>{0.496996433f, 0.66163379f},
-std::array<float,2>{0.582128286f, 0.276287019f},
-std::array<float,2>{0.56801492f, 0.929228902f},
-std::array<float,2>{0.479902953f, 0.206380442f},
-std::array<float,2>{0.111011654f, 0.632246852f},
-std::array<float,2>{0.772733927f, 0.282716185f},
-std::array<float,2>{0.987111211f, 0.623570085f},
-std::array<float,2>{0.24866128f, 0.443204433f},
-std::array<float,2>{0.299004287f, 0.759200931f},
-std::array<float,2>{0.66149652f, 0.0728220642f},
-std::array<float,2>{0.710874081f, 0.739434361f},
-std::array<float,2>{0.35103792f, 0.324445724f},
-std::array<float,2>{0.167414501f, 0.961878359f},
-std::array<float,2>{0.923990726f, 0.168208703f},
-std::array<float,2>{0.818985105f, 0.861143887f},
-std::array<float,2>{0.030362865f, 0.0544345193f},
-std::array<float,2>{0.40739426f, 0.539602399f},
-std::array<float,2>{0.503426433f, 0.376037836f},
-std::array<float,2>{0.640653193f, 0.804168046f},
-std::array<float,2>{0.270130992f, 0.122863978f},
-std::array<float,2>{0.21693483f, 0.583521962f},
-std::array<float,2>{0.968595445f, 0.486834019f},
-std::array<float,2>{0.808469236f, 0.682598591f},
-std::array<float,2>{0.0801904574f, 0.261346877f},
-std::array<float,2>{0.461237043f, 0.905915499f},
-std::array<float,2>{0.617884576f, 0.248529613f},
-std::array<float,2>{0.556359589f, 0.512016118f},
-std::array<float,2>{0.386783153f, 0.417967856f},
-std::array<float,2>{0.0611584559f, 0.816505253f},
-std::array<float,2>{0.857685566f, 0.0124353319f},
-std::array<float,2>{0.886220455f, 0.980078578f},
-std::array<float,2>{0.128372878f, 0.141152218f},
-std::array<float,2>{0.322547466f, 0.692288697f},
-std::array<float,2>{0.740366876f, 0.37447831f},
-std::array<float,2>{0.669089615f, 0.897341967f},
-std::array<float,2>{0.304737508f, 0.241353348f},
-std::array<float,2>{0.236966431f, 0.675647318f},
-std::array<float,2>{0.993578315f, 0.257273763f},
-std::array<float,2>{0.778495908f, 0.591411352f},
-std::array<float,2>{0.123808265f, 0.499325186f},
-std::array<float,2>{0.47603482f, 0.80700469f},
-std::array<float,2>{0.571827233f, 0.113911748f},
-std::array<float,2>{0.50980556f, 0.7014817f},
-std::array<float,2>{0.418601364f, 0.360065669f},
-std::array<float,2>{0.018042542f, 0.970677555f},
-std::array<float,2>{0.826704919f, 0.152928323f},
-std::array<float,2>{0.933011532f, 0.827511072f},
-std::array<float,2>{0.157788172f, 0.00410207268f},
-std::array<float,2>{0.354706675f, 0.502980947f},
-std::array<float,2>{0.717598855f, 0.409692824f},
-std::array<float,2>{0.612316072f, 0.754519165f},
-std::array<float,2>{0.454100996f, 0.0661599785f},
-std::array<float,2>{0.0915584564f, 0.613833249f},
-std::array<float,2>{0.797469556f, 0.447695762f},
-std::array<float,2>{0.955915987f, 0.639849603f},
-std::array<float,2>{0.206269145f, 0.292628795f},
-std::array<float,2>{0.276919186f, 0.937250733f},
-std::array<float,2>{0.65134269f, 0.212479383f},
-std::array<float,2>{0.742892563f, 0.534951866f},
-std::array<float,2>{0.312592477f, 0.385524124f},
-std::array<float,2>{0.138936743f, 0.871982634f},
-std::array<float,2>{0.881700277f, 0.0603245944f},
-std::array<float,2>{0.84717226f, 0.95595628f},
-std::array<float,2>{0.050752338f, 0.156629801f},
-std::array<float,2>{0.375219822f, 0.745504856f},
-std::array<float,2>{0.551137149f, 0.316631377f},
-std::array<float,2>{0.531748652f, 0.990677178f},
-std::array<float,2>{0.397562414f, 0.131263673f},
-std::array<float,2>{0.0395087637f, 0.707827687f},
-std::array<float,2>{0.867287278f, 0.349142849f},
-std::array<float,2>{0.896487236f, 0.526341558f},
-std::array<float,2>{0.142856747f, 0.434211135f},
-std::array<float,2>{0.330730915f, 0.829193234f},
-std::array<float,2>{0.730606258f, 0.0207053479f},
-std::array<float,2>{0.633564591f, 0.665404439f},
-std::array<float,2>{0.262714356f, 0.26825276f},
-std::array<float,2>{0.192159429f, 0.889429212f},
-std::array<float,2>{0.943240047f, 0.219057292f},
-std::array<float,2>{0.787449479f, 0.788886368f},
-std::array<float,2>{0.0750440583f, 0.107306182f},
-std::array<float,2>{0.440644145f, 0.563559711f},
-std::array<float,2>{0.60007745f, 0.472352237f},
-std::array<float,2>{0.697351217f, 0.844071984f},
-std::array<float,2>{0.366976649f, 0.0342773534f},
-std::array<float,2>{0.18449612f, 0.548868477f},
-std::array<float,2>{0.913907886f, 0.403625548f},
-std::array<float,2>{0.841192901f, 0.727096975f},
-std::array<float,2>{0.00234232494f, 0.331417143f},
-std::array<float,2>{0.430144161f, 0.945313394f},
-std::array<float,2>{0.517610669f, 0.174628764f},
-std::array<float,2>{0.588967741f, 0.609006464f},
-std::array<float,2>{0.484747708f, 0.460372895f},
-std::array<float,2>{0.107563145f, 0.776367724f},
-std::array<float,2>{0.764614642f, 0.082325384f},
-std::array<float,2>{0.973731279f, 0.918981135f},
-std::array<float,2>{0.230693802f, 0.200249135f},
-std::array<float,2>{0.290250838f, 0.655524075f},
-std::array<float,2>{0.685317159f, 0.299797446f},
-std::array<float,2>{0.67256999f, 0.95925504f},
-std::array<float,2>{0.285277367f, 0.163886115f},
-std::array<float,2>{0.221170068f, 0.747080803f},
-std::array<float,2>{0.984325171f, 0.313651055f},
-std::array<float,2>{0.754802227f, 0.537481546f},
-std::array<float,2>{0.0991257206f, 0.386757493f},
-std::array<float,2>{0.493201166f, 0.868409812f},
-std::array<float,2>{0.581963062f, 0.0547740683f},
-std::array<float,2>{0.528187871f, 0.635042667f},
-std::array<float,2>{0.423002809f, 0.296007365f},
-std::array<float,2>{0.0131233493f, 0.931700468f},
-std::array<float,2>{0.830102265f, 0.215109915f},
-std::array<float,2>{0.91696161f, 0.753892243f},
-std::array<float,2>{0.174878448f, 0.0680417642f},
-std::array<float,2>{0.368400007f, 0.611349821f},
-std::array<float,2>{0.687830687f, 0.452147514f},
-std::array<float,2>{0.609124243f, 0.823130429f},
-std::array<float,2>{0.450946808f, 0.00387180247f},
-std::array<float,2>{0.0655029863f, 0.505395472f},
-std::array<float,2>{0.791086078f, 0.411662668f},
-std::array<float,2>{0.947558999f, 0.698678613f},
-std::array<float,2>{0.200416327f, 0.366020918f},
-std::array<float,2>{0.253851563f, 0.974263966f},
-std::array<float,2>{0.62866205f, 0.151014894f},
-std::array<float,2>{0.719701529f, 0.587468386f},
-std::array<float,2>{0.34156996f, 0.493713111f},
-std::array<float,2>{0.150535136f, 0.808831632f},
-std::array<float,2>{0.901033998f, 0.111844689f},
-std::array<float,2>{0.862089574f, 0.893357992f},
-std::array<float,2>{0.0331973843f, 0.236424878f},
-std::array<float,2>{0.401462495f, 0.677766562f},
-std::array<float,2>{0.545074284f, 0.252054513f},
-std::array<float,2>{0.559993565f, 0.916874349f},
-std::array<float,2>{0.384107083f, 0.199046195f},
-std::array<float,2>{0.0561294183f, 0.648477256f},
-std::array<float,2>{0.852696002f, 0.302026182f},
-std::array<float,2>{0.889999449f, 0.604878962f},
-std::array<float,2>{0.131096095f, 0.455275744f},
-std::array<float,2>{0.327544272f, 0.778054893f},
-std::array<float,2>{0.734890163f, 0.0791552514f},
-std::array<float,2>{0.64628005f, 0.730811298f},
-std::array<float,2>{0.269179672f, 0.333945483f},
-std::array<float,2>{0.213980913f, 0.949222803f},
-std::array<float,2>{0.962761223f, 0.179672688f},
-std::array<float,2>{0.810340524f, 0.850036979f},
-std::array<float,2>{0.0841715634f, 0.0367609411f},
-std::array<float,2>{0.467860371f, 0.553028643f},
-std::array<float,2>{0.623451531f, 0.399231791f},
-std::array<float,2>{0.703945458f, 0.782362461f},
-std::array<float,2>{0.345706016f, 0.105304487f},
-std::array<float,2>{0.168594077f, 0.56731534f},
-std::array<float,2>{0.928824067f, 0.474376053f},
-std::array<float,2>{0.814220786f, 0.670643687f},
-std::array<float,2>{0.0240388438f, 0.270776033f},
-std::array<float,2>{0.412772685f, 0.883045912f},
-std::array<float,2>{0.507723272f, 0.223275021f},
-std::array<float,2>{0.566188693f, 0.529009461f},
-std::array<float,2>{0.48426947f, 0.433208585f},
-std::array<float,2>{0.115988277f, 0.835041761f},
-std::array<float,2>{0.766159952f, 0.0185167361f},
-std::array<float,2>{0.990253866f, 0.984393835f},
-std::array<float,2>{0.244852692f, 0.126272678f},
-std::array<float,2>{0.301469415f, 0.704897285f},
-std::array<float,2>{0.657056987f, 0.345810831f},
-std::array<float,2>{0.748562753f, 0.877545834f},
-std::array<float,2>{0.318464726f, 0.230568826f},
-std::array<float,2>{0.135533512f, 0.656956255f},
-std::array<float,2>{0.875603557f, 0.277739048f},
-std::array<float,2>{0.851467371f, 0.574124336f},
-std::array<float,2>{0.0509454012f, 0.482875377f},
-std::array<float,2>{0.38193661f, 0.79601568f},
-std::array<float,2>{0.550225317f, 0.0956433937f},
-std::array<float,2>{0.615459383f, 0.713285267f},
-std::array<float,2>{0.457574517f, 0.355629086f},
-std::array<float,2>{0.0874180719f, 0.994538426f},
-std::array<float,2>{0.801770508f, 0.136867821f},
-std::array<float,2>{0.960695565f, 0.842132092f},
-std::array<float,2>{0.210086107f, 0.030154122f},
-std::array<float,2>{0.280858278f, 0.5204373f},
-std::array<float,2>{0.653930187f, 0.42642957f},
-std::array<float,2>{0.515322387f, 0.765998542f},
-std::array<float,2>{0.416862488f, 0.0894514099f},
-std::array<float,2>{0.0233002193f, 0.593863666f},
-std::array<float,2>{0.823480427f, 0.461480647f},
-std::array<float,2>{0.937389135f, 0.647407472f},
-std::array<float,2>{0.160749123f, 0.305269837f},
-std::array<float,2>{0.356957465f, 0.91051358f},
-std::array<float,2>{0.711383343f, 0.188091636f},
-std::array<float,2>{0.666866839f, 0.556334376f},
-std::array<float,2>{0.312364787f, 0.390862972f},
-std::array<float,2>{0.238509357f, 0.85830617f},
-std::array<float,2>{0.99900943f, 0.0432250462f},
-std::array<float,2>{0.777309358f, 0.941041052f},
-std::array<float,2>{0.119580232f, 0.180110842f},
-std::array<float,2>{0.470722318f, 0.72622782f},
-std::array<float,2>{0.577678144f, 0.337064445f},
-std::array<float,2>{0.59373039f, 0.984000742f},
-std::array<float,2>{0.488863528f, 0.145974755f},
-std::array<float,2>{0.102578454f, 0.688101768f},
-std::array<float,2>{0.757870913f, 0.370037436f},
-std::array<float,2>{0.970255733f, 0.509432554f},
-std::array<float,2>{0.227495924f, 0.420506537f},
-std::array<float,2>{0.29361102f, 0.814030886f},
-std::array<float,2>{0.683579922f, 0.0116445357f},
-std::array<float,2>{0.699617922f, 0.687475204f},
-std::array<float,2>{0.363187701f, 0.261908412f},
-std::array<float,2>{0.179726318f, 0.899030209f},
-std::array<float,2>{0.908814967f, 0.243152097f},
-std::array<float,2>{0.837648332f, 0.797609568f},
-std::array<float,2>{0.00426719896f, 0.118087754f},
-std::array<float,2>{0.433631629f, 0.580667913f},
-std::array<float,2>{0.522700608f, 0.488572836f},
-std::array<float,2>{0.637951374f, 0.864277124f},
-std::array<float,2>{0.259404898f, 0.0481196269f},
-std::array<float,2>{0.189393833f, 0.545538902f},
-std::array<float,2>{0.938516498f, 0.379603714f},
-std::array<float,2>{0.782734454f, 0.735126078f},
-std::array<float,2>{0.0740652233f, 0.321144998f},
-std::array<float,2>{0.442605615f, 0.96848017f},
-std::array<float,2>{0.597113371f, 0.164471313f},
-std::array<float,2>{0.537822247f, 0.618785918f},
-std::array<float,2>{0.393520057f, 0.43927294f},
-std::array<float,2>{0.045293171f, 0.762311995f},
-std::array<float,2>{0.873972595f, 0.0768384635f},
-std::array<float,2>{0.890742719f, 0.923811615f},
-std::array<float,2>{0.145495683f, 0.208004624f},
-std::array<float,2>{0.332868934f, 0.628043354f},
-std::array<float,2>{0.726665676f, 0.288342685f},
-std::array<float,2>{0.694328368f, 0.997753918f},
-std::array<float,2>{0.373327762f, 0.134422764f},
-std::array<float,2>{0.178131267f, 0.71543473f},
-std::array<float,2>{0.918439984f, 0.352839738f},
-std::array<float,2>{0.834177256f, 0.515850544f},
-std::array<float,2>{0.0100746956f, 0.42552793f},
-std::array<float,2>{0.427437752f, 0.838567078f},
-std::array<float,2>{0.526487052f, 0.0244185012f},
-std::array<float,2>{0.585377812f, 0.662760437f},
-std::array<float,2>{0.498465478f, 0.275135845f},
-std::array<float,2>{0.0942176357f, 0.88041538f},
-std::array<float,2>{0.751555204f, 0.229725584f},
-std::array<float,2>{0.980054319f, 0.790627778f},
-std::array<float,2>{0.223493189f, 0.0976710618f},
-std::array<float,2>{0.284209222f, 0.576040328f},
-std::array<float,2>{0.678245008f, 0.477221489f},
-std::array<float,2>{0.539990783f, 0.851982594f},
-std::array<float,2>{0.405192256f, 0.0403794795f},
-std::array<float,2>{0.0368550494f, 0.559580982f},
-std::array<float,2>{0.865926504f, 0.395052284f},
-std::array<float,2>{0.905326724f, 0.719478965f},
-std::array<float,2>{0.153635666f, 0.343227684f},
-std::array<float,2>{0.33800289f, 0.942395568f},
-std::array<float,2>{0.724089146f, 0.187132075f},
-std::array<float,2>{0.631001592f, 0.598460734f},
-std::array<float,2>{0.255661488f, 0.467146099f},
-std::array<float,2>{0.197502136f, 0.7727983f},
-std::array<float,2>{0.952679753f, 0.0905621573f},
-std::array<float,2>{0.796441913f, 0.907166064f},
-std::array<float,2>{0.0699358732f, 0.193507761f},
-std::array<float,2>{0.448584884f, 0.643111885f},
-std::array<float,2>{0.603563905f, 0.309626937f},
-std::array<float,2>{0.619404852f, 0.903874278f},
-std::array<float,2>{0.464463145f, 0.24686791f},
-std::array<float,2>{0.0783645362f, 0.679815531f},
-std::array<float,2>{0.806020379f, 0.25904128f},
-std::array<float,2>{0.965580404f, 0.585482061f},
-std::array<float,2>{0.215702698f, 0.485936075f},
-std::array<float,2>{0.273389578f, 0.801244318f},
-std::array<float,2>{0.644153059f, 0.124847606f},
-std::array<float,2>{0.738786578f, 0.694378674f},
-std::array<float,2>{0.321064144f, 0.372416556f},
-std::array<float,2>{0.126763552f, 0.978094757f},
-std::array<float,2>{0.883305013f, 0.143589288f},
-std::array<float,2>{0.856089175f, 0.819252431f},
-std::array<float,2>{0.0599310733f, 0.0147312293f},
-std::array<float,2>{0.388734609f, 0.513691843f},
-std::array<float,2>{0.557127833f, 0.414593995f},
-std::array<float,2>{0.663471878f, 0.760277748f},
-std::array<float,2>{0.298245788f, 0.0714397207f},
-std::array<float,2>{0.247871131f, 0.622203171f},
-std::array<float,2>{0.984474957f, 0.444101661f},
-std::array<float,2>{0.771213293f, 0.629157305f},
-std::array<float,2>{0.112580843f, 0.285094947f},
-std::array<float,2>{0.477843195f, 0.927713037f},
-std::array<float,2>{0.570028543f, 0.205069169f},
-std::array<float,2>{0.500955522f, 0.541125417f},
-std::array<float,2>{0.408251971f, 0.377967954f},
-std::array<float,2>{0.0273679234f, 0.862760723f},
-std::array<float,2>{0.816629887f, 0.0521234013f},
-std::array<float,2>{0.922606945f, 0.963105798f},
-std::array<float,2>{0.165530905f, 0.171289951f},
-std::array<float,2>{0.348530114f, 0.741784871f},
-std::array<float,2>{0.708110511f, 0.327293634f},
-std::array<float,2>{0.649674892f, 0.934942722f},
-std::array<float,2>{0.274108469f, 0.214656487f},
-std::array<float,2>{0.204748765f, 0.638310969f},
-std::array<float,2>{0.954247355f, 0.28985858f},
-std::array<float,2>{0.799753308f, 0.616664886f},
-std::array<float,2>{0.0920082331f, 0.446436524f},
-std::array<float,2>{0.455686599f, 0.75739491f},
-std::array<float,2>{0.60984081f, 0.0627589673f},
-std::array<float,2>{0.553533494f, 0.742604673f},
-std::array<float,2>{0.377939731f, 0.319138139f},
-std::array<float,2>{0.0487019047f, 0.953346014f},
-std::array<float,2>{0.844862759f, 0.158718318f},
-std::array<float,2>{0.879367709f, 0.874215841f},
-std::array<float,2>{0.137263402f, 0.0612228848f},
-std::array<float,2>{0.315916091f, 0.53242439f},
-std::array<float,2>{0.745996416f, 0.382882267f},
-std::array<float,2>{0.57247287f, 0.806565106f},
-std::array<float,2>{0.473191828f, 0.11537642f},
-std::array<float,2>{0.121273592f, 0.592918932f},
-std::array<float,2>{0.780673862f, 0.496612877f},
-std::array<float,2>{0.995929658f, 0.673101902f},
-std::array<float,2>{0.235341057f, 0.254941881f},
-std::array<float,2>{0.308205009f, 0.895561516f},
-std::array<float,2>{0.671564877f, 0.239703119f},
-std::array<float,2>{0.715978622f, 0.500484884f},
-std::array<float,2>{0.352732509f, 0.407492131f},
-std::array<float,2>{0.159510612f, 0.824998021f},
-std::array<float,2>{0.930292666f, 0.00751550542f},
-std::array<float,2>{0.824962199f, 0.970745206f},
-std::array<float,2>{0.0156508237f, 0.155218676f},
-std::array<float,2>{0.421081722f, 0.700553119f},
-std::array<float,2>{0.509571493f, 0.362997741f},
-std::array<float,2>{0.517335713f, 0.948858917f},
-std::array<float,2>{0.431947827f, 0.172323629f},
-std::array<float,2>{0.000826518459f, 0.729917824f},
-std::array<float,2>{0.84289813f, 0.330049872f},
-std::array<float,2>{0.9112041f, 0.548620999f},
-std::array<float,2>{0.187109143f, 0.406151235f},
-std::array<float,2>{0.365143955f, 0.8467592f},
-std::array<float,2>{0.697139323f, 0.0323722735f},
-std::array<float,2>{0.68666929f, 0.653470516f},
-std::array<float,2>{0.292037308f, 0.298706412f},
-std::array<float,2>{0.233161956f, 0.920486927f},
-std::array<float,2>{0.975990236f, 0.201528803f},
-std::array<float,2>{0.761841834f, 0.774852455f},
-std::array<float,2>{0.106228083f, 0.0841084346f},
-std::array<float,2>{0.487843215f, 0.605502725f},
-std::array<float,2>{0.587370813f, 0.458659589f},
-std::array<float,2>{0.733994722f, 0.830948353f},
-std::array<float,2>{0.32910192f, 0.0224911813f},
-std::array<float,2>{0.14156203f, 0.524796426f},
-std::array<float,2>{0.895929933f, 0.43636626f},
-std::array<float,2>{0.871057928f, 0.710484684f},
-std::array<float,2>{0.0411277786f, 0.349641889f},
-std::array<float,2>{0.395498574f, 0.988411307f},
-std::array<float,2>{0.534800649f, 0.130211458f},
-std::array<float,2>{0.598950326f, 0.565575182f},
-std::array<float,2>{0.438231945f, 0.469266146f},
-std::array<float,2>{0.076200664f, 0.785235643f},
-std::array<float,2>{0.787076771f, 0.108162463f},
-std::array<float,2>{0.944884419f, 0.887733221f},
-std::array<float,2>{0.194417179f, 0.222227171f},
-std::array<float,2>{0.265324593f, 0.667957187f},
-std::array<float,2>{0.63575083f, 0.266325861f},
-std::array<float,2>{0.65216136f, 0.953613162f},
-std::array<float,2>{0.276022166f, 0.159095868f},
-std::array<float,2>{0.205803022f, 0.74235791f},
-std::array<float,2>{0.956948876f, 0.319031239f},
-std::array<float,2>{0.798731208f, 0.532613456f},
-std::array<float,2>{0.0907632038f, 0.383186221f},
-std::array<float,2>{0.454975486f, 0.874396741f},
-std::array<float,2>{0.612259507f, 0.0614905469f},
-std::array<float,2>{0.55206573f, 0.638436913f},
-std::array<float,2>{0.376066983f, 0.289631486f},
-std::array<float,2>{0.0496773683f, 0.934646308f},
-std::array<float,2>{0.846386313f, 0.214545026f},
-std::array<float,2>{0.882242024f, 0.757682025f},
-std::array<float,2>{0.140583038f, 0.0626863465f},
-std::array<float,2>{0.314080566f, 0.616279721f},
-std::array<float,2>{0.743578017f, 0.446709067f},
-std::array<float,2>{0.570655107f, 0.824834406f},
-std::array<float,2>{0.474722445f, 0.0077599152f},
-std::array<float,2>{0.124841847f, 0.500080645f},
-std::array<float,2>{0.778270543f, 0.407230228f},
-std::array<float,2>{0.992932618f, 0.700434327f},
-std::array<float,2>{0.238263845f, 0.363079548f},
-std::array<float,2>{0.305716753f, 0.971139491f},
-std::array<float,2>{0.668294728f, 0.154881373f},
-std::array<float,2>{0.718332708f, 0.593118787f},
-std::array<float,2>{0.354373127f, 0.496947825f},
-std::array<float,2>{0.156906486f, 0.806351066f},
-std::array<float,2>{0.932000279f, 0.115504086f},
-std::array<float,2>{0.827428281f, 0.895836353f},
-std::array<float,2>{0.0189627782f, 0.239383385f},
-std::array<float,2>{0.419078141f, 0.672951937f},
-std::array<float,2>{0.511700749f, 0.255138069f},
-std::array<float,2>{0.518760622f, 0.920673192f},
-std::array<float,2>{0.430690765f, 0.201305032f},
-std::array<float,2>{0.00311727147f, 0.653665066f},
-std::array<float,2>{0.840095639f, 0.298565626f},
-std::array<float,2>{0.912528634f, 0.605812728f},
-std::array<float,2>{0.185113356f, 0.458820283f},
-std::array<float,2>{0.365503132f, 0.774623454f},
-std::array<float,2>{0.699209392f, 0.0843480676f},
-std::array<float,2>{0.684073389f, 0.729620636f},
-std::array<float,2>{0.289527684f, 0.329825222f},
-std::array<float,2>{0.232280672f, 0.949188292f},
-std::array<float,2>{0.972742677f, 0.172048703f},
-std::array<float,2>{0.765158892f, 0.847101331f},
-std::array<float,2>{0.108453542f, 0.032698445f},
-std::array<float,2>{0.485387564f, 0.548566461f},
-std::array<float,2>{0.58855015f, 0.405930251f},
-std::array<float,2>{0.732328057f, 0.785620213f},
-std::array<float,2>{0.33163324f, 0.107963271f},
-std::array<float,2>{0.143648997f, 0.565836012f},
-std::array<float,2>{0.897482872f, 0.469570369f},
-std::array<float,2>{0.868670881f, 0.667535722f},
-std::array<float,2>{0.0402966589f, 0.266575843f},
-std::array<float,2>{0.396837711f, 0.887954891f},
-std::array<float,2>{0.53297013f, 0.222547024f},
-std::array<float,2>{0.601372063f, 0.524502873f},
-std::array<float,2>{0.439799875f, 0.436099857f},
-std::array<float,2>{0.0755964294f, 0.830583155f},
-std::array<float,2>{0.788266063f, 0.0227743834f},
-std::array<float,2>{0.941431463f, 0.988729239f},
-std::array<float,2>{0.193173096f, 0.129955932f},
-std::array<float,2>{0.261729628f, 0.710712075f},
-std::array<float,2>{0.63452667f, 0.34991774f},
-std::array<float,2>{0.69165355f, 0.880678356f},
-std::array<float,2>{0.371495605f, 0.229871437f},
-std::array<float,2>{0.176919237f, 0.662876248f},
-std::array<float,2>{0.920532048f, 0.275331467f},
-std::array<float,2>{0.833168149f, 0.575914681f},
-std::array<float,2>{0.0081681814f, 0.477379382f},
-std::array<float,2>{0.427893728f, 0.79094702f},
-std::array<float,2>{0.525375605f, 0.0980004221f},
-std::array<float,2>{0.583182275f, 0.715720356f},
-std::array<float,2>{0.497563481f, 0.35268569f},
-std::array<float,2>{0.0968710855f, 0.997982085f},
-std::array<float,2>{0.752342403f, 0.134522319f},
-std::array<float,2>{0.976648867f, 0.838638127f},
-std::array<float,2>{0.226555273f, 0.0247909185f},
-std::array<float,2>{0.282887608f, 0.515958607f},
-std::array<float,2>{0.677288771f, 0.425630391f},
-std::array<float,2>{0.54224062f, 0.772698224f},
-std::array<float,2>{0.403201908f, 0.0907114074f},
-std::array<float,2>{0.0374772586f, 0.598315835f},
-std::array<float,2>{0.865046144f, 0.466834128f},
-std::array<float,2>{0.902819693f, 0.643438399f},
-std::array<float,2>{0.155470207f, 0.309934288f},
-std::array<float,2>{0.337232023f, 0.906979322f},
-std::array<float,2>{0.725946307f, 0.193613157f},
-std::array<float,2>{0.63083148f, 0.559839249f},
-std::array<float,2>{0.256454825f, 0.395397574f},
-std::array<float,2>{0.195673719f, 0.851795018f},
-std::array<float,2>{0.950424969f, 0.0402739719f},
-std::array<float,2>{0.794498742f, 0.942773283f},
-std::array<float,2>{0.0668243691f, 0.187470973f},
-std::array<float,2>{0.445567757f, 0.719532728f},
-std::array<float,2>{0.601665437f, 0.343009204f},
-std::array<float,2>{0.618544042f, 0.978297234f},
-std::array<float,2>{0.462258756f, 0.143885836f},
-std::array<float,2>{0.0813928545f, 0.694627941f},
-std::array<float,2>{0.807197154f, 0.372116089f},
-std::array<float,2>{0.966908455f, 0.513977051f},
-std::array<float,2>{0.218031988f, 0.414825588f},
-std::array<float,2>{0.271182984f, 0.819025636f},
-std::array<float,2>{0.641773582f, 0.0150121786f},
-std::array<float,2>{0.741285563f, 0.680119574f},
-std::array<float,2>{0.324020892f, 0.258822799f},
-std::array<float,2>{0.127718598f, 0.904088557f},
-std::array<float,2>{0.885115921f, 0.246611193f},
-std::array<float,2>{0.85841763f, 0.800828218f},
-std::array<float,2>{0.0615249127f, 0.124589294f},
-std::array<float,2>{0.387991846f, 0.585803092f},
-std::array<float,2>{0.555585206f, 0.486261845f},
-std::array<float,2>{0.661004603f, 0.86249733f},
-std::array<float,2>{0.300087571f, 0.0517891087f},
-std::array<float,2>{0.249533549f, 0.541295469f},
-std::array<float,2>{0.988078713f, 0.378287613f},
-std::array<float,2>{0.772267878f, 0.742147267f},
-std::array<float,2>{0.110074461f, 0.327471137f},
-std::array<float,2>{0.479087561f, 0.963170528f},
-std::array<float,2>{0.566495776f, 0.17094636f},
-std::array<float,2>{0.502113879f, 0.622514367f},
-std::array<float,2>{0.407144457f, 0.443973541f},
-std::array<float,2>{0.0296931937f, 0.760728896f},
-std::array<float,2>{0.819843054f, 0.0717264339f},
-std::array<float,2>{0.924839556f, 0.927397847f},
-std::array<float,2>{0.166605204f, 0.20476748f},
-std::array<float,2>{0.350150734f, 0.628956556f},
-std::array<float,2>{0.709671676f, 0.284740746f},
-std::array<float,2>{0.747690737f, 0.994294703f},
-std::array<float,2>{0.31692788f, 0.137064606f},
-std::array<float,2>{0.133655608f, 0.712891281f},
-std::array<float,2>{0.877026975f, 0.355909407f},
-std::array<float,2>{0.849346936f, 0.520195305f},
-std::array<float,2>{0.0538218729f, 0.426744133f},
-std::array<float,2>{0.379684359f, 0.841980278f},
-std::array<float,2>{0.548701823f, 0.0300047379f},
-std::array<float,2>{0.614207804f, 0.657220244f},
-std::array<float,2>{0.460619748f, 0.277356178f},
-std::array<float,2>{0.0879870653f, 0.877845764f},
-std::array<float,2>{0.803012669f, 0.230816081f},
-std::array<float,2>{0.958542049f, 0.796384037f},
-std::array<float,2>{0.208037317f, 0.0953388065f},
-std::array<float,2>{0.277955085f, 0.573925555f},
-std::array<float,2>{0.655272901f, 0.482442588f},
-std::array<float,2>{0.512784362f, 0.857990265f},
-std::array<float,2>{0.415966362f, 0.0431734994f},
-std::array<float,2>{0.0201171897f, 0.556555867f},
-std::array<float,2>{0.822259128f, 0.391081542f},
-std::array<float,2>{0.933843315f, 0.726492226f},
-std::array<float,2>{0.162212178f, 0.337345898f},
-std::array<float,2>{0.358509749f, 0.941233754f},
-std::array<float,2>{0.71422857f, 0.17985101f},
-std::array<float,2>{0.66533941f, 0.594213426f},
-std::array<float,2>{0.30978018f, 0.461816251f},
-std::array<float,2>{0.2409385f, 0.7657758f},
-std::array<float,2>{0.997118711f, 0.0896296129f},
-std::array<float,2>{0.774331093f, 0.910311937f},
-std::array<float,2>{0.117871262f, 0.188473165f},
-std::array<float,2>{0.469443142f, 0.647205412f},
-std::array<float,2>{0.575660944f, 0.305559993f},
-std::array<float,2>{0.591131449f, 0.899331629f},
-std::array<float,2>{0.492066294f, 0.242917851f},
-std::array<float,2>{0.104194276f, 0.687224329f},
-std::array<float,2>{0.760775626f, 0.262094736f},
-std::array<float,2>{0.972385705f, 0.580893755f},
-std::array<float,2>{0.229165852f, 0.488475382f},
-std::array<float,2>{0.295278281f, 0.797424316f},
-std::array<float,2>{0.681469619f, 0.117882699f},
-std::array<float,2>{0.701492906f, 0.68845576f},
-std::array<float,2>{0.360792428f, 0.369727045f},
-std::array<float,2>{0.183501124f, 0.984135687f},
-std::array<float,2>{0.906335235f, 0.14568156f},
-std::array<float,2>{0.838342369f, 0.814388335f},
-std::array<float,2>{0.00742851431f, 0.0113627827f},
-std::array<float,2>{0.437177777f, 0.509559453f},
-std::array<float,2>{0.52103585f, 0.42082423f},
-std::array<float,2>{0.639827251f, 0.762658417f},
-std::array<float,2>{0.259838492f, 0.0770477578f},
-std::array<float,2>{0.189471453f, 0.619081557f},
-std::array<float,2>{0.941346884f, 0.438965589f},
-std::array<float,2>{0.784208179f, 0.62817508f},
-std::array<float,2>{0.071862556f, 0.288117945f},
-std::array<float,2>{0.444670588f, 0.923567832f},
-std::array<float,2>{0.595375478f, 0.207574412f},
-std::array<float,2>{0.536739826f, 0.545693874f},
-std::array<float,2>{0.39097324f, 0.37984103f},
-std::array<float,2>{0.0429690629f, 0.8646366f},
-std::array<float,2>{0.872985244f, 0.047958117f},
-std::array<float,2>{0.892986715f, 0.968681455f},
-std::array<float,2>{0.147818446f, 0.164188072f},
-std::array<float,2>{0.334668398f, 0.735007107f},
-std::array<float,2>{0.730010152f, 0.320818871f},
-std::array<float,2>{0.675727665f, 0.932089448f},
-std::array<float,2>{0.288848698f, 0.214938059f},
-std::array<float,2>{0.219096527f, 0.63499409f},
-std::array<float,2>{0.980781853f, 0.296236128f},
-std::array<float,2>{0.756943047f, 0.611615777f},
-std::array<float,2>{0.0996885672f, 0.451723099f},
-std::array<float,2>{0.494799584f, 0.753571808f},
-std::array<float,2>{0.578442872f, 0.0681548864f},
-std::array<float,2>{0.529986024f, 0.747387528f},
-std::array<float,2>{0.424748957f, 0.313928038f},
-std::array<float,2>{0.0153218592f, 0.959221482f},
-std::array<float,2>{0.8299523f, 0.163788021f},
-std::array<float,2>{0.914975226f, 0.868362427f},
-std::array<float,2>{0.17322056f, 0.0550172478f},
-std::array<float,2>{0.370051116f, 0.537120163f},
-std::array<float,2>{0.68984282f, 0.386962891f},
-std::array<float,2>{0.605833054f, 0.808988869f},
-std::array<float,2>{0.451323867f, 0.112285718f},
-std::array<float,2>{0.0627831072f, 0.587685764f},
-std::array<float,2>{0.790254414f, 0.494066179f},
-std::array<float,2>{0.946445704f, 0.678158581f},
-std::array<float,2>{0.202365726f, 0.252373636f},
-std::array<float,2>{0.251877278f, 0.893152177f},
-std::array<float,2>{0.626535058f, 0.236797825f},
-std::array<float,2>{0.721831977f, 0.505693018f},
-std::array<float,2>{0.341807872f, 0.41194284f},
-std::array<float,2>{0.149320394f, 0.822957695f},
-std::array<float,2>{0.899594069f, 0.00342358928f},
-std::array<float,2>{0.860019445f, 0.974403858f},
-std::array<float,2>{0.034147948f, 0.151159555f},
-std::array<float,2>{0.399392635f, 0.698258698f},
-std::array<float,2>{0.543836176f, 0.365931273f},
-std::array<float,2>{0.562465787f, 0.949687839f},
-std::array<float,2>{0.38671121f, 0.179268911f},
-std::array<float,2>{0.0583155118f, 0.730551064f},
-std::array<float,2>{0.853994012f, 0.333537579f},
-std::array<float,2>{0.887955546f, 0.552901685f},
-std::array<float,2>{0.128909335f, 0.398953885f},
-std::array<float,2>{0.325497389f, 0.849780858f},
-std::array<float,2>{0.736650527f, 0.0369850174f},
-std::array<float,2>{0.64697051f, 0.648788214f},
-std::array<float,2>{0.266906142f, 0.301849782f},
-std::array<float,2>{0.212754697f, 0.916707456f},
-std::array<float,2>{0.964733243f, 0.19886446f},
-std::array<float,2>{0.812030792f, 0.778144956f},
-std::array<float,2>{0.0820538029f, 0.0795272887f},
-std::array<float,2>{0.465649188f, 0.604714155f},
-std::array<float,2>{0.62180829f, 0.455515087f},
-std::array<float,2>{0.706571579f, 0.835348606f},
-std::array<float,2>{0.344611079f, 0.0181422196f},
-std::array<float,2>{0.170763344f, 0.529233217f},
-std::array<float,2>{0.927156329f, 0.433541417f},
-std::array<float,2>{0.814577818f, 0.704627991f},
-std::array<float,2>{0.0269858018f, 0.346068889f},
-std::array<float,2>{0.411625475f, 0.984620273f},
-std::array<float,2>{0.505549133f, 0.126065612f},
-std::array<float,2>{0.564071476f, 0.567027271f},
-std::array<float,2>{0.480792314f, 0.474355936f},
-std::array<float,2>{0.113989301f, 0.782498837f},
-std::array<float,2>{0.767922103f, 0.10501112f},
-std::array<float,2>{0.989739358f, 0.883278728f},
-std::array<float,2>{0.242631853f, 0.22359623f},
-std::array<float,2>{0.304360092f, 0.670801461f},
-std::array<float,2>{0.658943355f, 0.270559907f},
-std::array<float,2>{0.670879662f, 0.97033906f},
-std::array<float,2>{0.307443142f, 0.153313443f},
-std::array<float,2>{0.235579848f, 0.701314151f},
-std::array<float,2>{0.994775057f, 0.360148013f},
-std::array<float,2>{0.779565215f, 0.503244102f},
-std::array<float,2>{0.123042874f, 0.409922481f},
-std::array<float,2>{0.474342763f, 0.827193022f},
-std::array<float,2>{0.573829591f, 0.00438643759f},
-std::array<float,2>{0.508095324f, 0.675480783f},
-std::array<float,2>{0.420891941f, 0.256910592f},
-std::array<float,2>{0.0172329135f, 0.89698559f},
-std::array<float,2>{0.825593174f, 0.241547585f},
-std::array<float,2>{0.930734456f, 0.806706071f},
-std::array<float,2>{0.158493266f, 0.114109933f},
-std::array<float,2>{0.352198511f, 0.591590047f},
-std::array<float,2>{0.715723276f, 0.499038428f},
-std::array<float,2>{0.610837996f, 0.871797085f},
-std::array<float,2>{0.456635654f, 0.0602744035f},
-std::array<float,2>{0.0933230519f, 0.534805894f},
-std::array<float,2>{0.800267816f, 0.385289758f},
-std::array<float,2>{0.95389539f, 0.745265782f},
-std::array<float,2>{0.20348841f, 0.316725284f},
-std::array<float,2>{0.274920523f, 0.955706418f},
-std::array<float,2>{0.649067819f, 0.156324863f},
-std::array<float,2>{0.744721889f, 0.614017904f},
-std::array<float,2>{0.314961493f, 0.447378099f},
-std::array<float,2>{0.138141274f, 0.754872382f},
-std::array<float,2>{0.880541921f, 0.0662334338f},
-std::array<float,2>{0.844435275f, 0.937287867f},
-std::array<float,2>{0.0471210256f, 0.212815851f},
-std::array<float,2>{0.377598047f, 0.64001888f},
-std::array<float,2>{0.554318368f, 0.292856395f},
-std::array<float,2>{0.533778548f, 0.889321864f},
-std::array<float,2>{0.396307021f, 0.218905985f},
-std::array<float,2>{0.042727787f, 0.665041387f},
-std::array<float,2>{0.869509161f, 0.268444657f},
-std::array<float,2>{0.895338178f, 0.563735187f},
-std::array<float,2>{0.14177528f, 0.472431093f},
-std::array<float,2>{0.328938276f, 0.788675666f},
-std::array<float,2>{0.732713759f, 0.1070977f},
-std::array<float,2>{0.634928167f, 0.707736254f},
-std::array<float,2>{0.264269829f, 0.349553049f},
-std::array<float,2>{0.193660364f, 0.990298688f},
-std::array<float,2>{0.943713129f, 0.13096723f},
-std::array<float,2>{0.785164475f, 0.829460442f},
-std::array<float,2>{0.0780484378f, 0.0209311396f},
-std::array<float,2>{0.439090461f, 0.526111424f},
-std::array<float,2>{0.598267734f, 0.434493124f},
-std::array<float,2>{0.695979118f, 0.77685535f},
-std::array<float,2>{0.364110053f, 0.0821469873f},
-std::array<float,2>{0.186290652f, 0.609180033f},
-std::array<float,2>{0.910642922f, 0.460016966f},
-std::array<float,2>{0.842309117f, 0.655502081f},
-std::array<float,2>{0.00138612546f, 0.299412102f},
-std::array<float,2>{0.433244854f, 0.919279873f},
-std::array<float,2>{0.516172528f, 0.200483143f},
-std::array<float,2>{0.586450875f, 0.549093306f},
-std::array<float,2>{0.486997128f, 0.403424233f},
-std::array<float,2>{0.106665954f, 0.843888819f},
-std::array<float,2>{0.763400376f, 0.0345549136f},
-std::array<float,2>{0.974682271f, 0.945663452f},
-std::array<float,2>{0.233934343f, 0.174463958f},
-std::array<float,2>{0.291153997f, 0.727401316f},
-std::array<float,2>{0.686373591f, 0.331207782f},
-std::array<float,2>{0.723337173f, 0.908398688f},
-std::array<float,2>{0.339091629f, 0.191901863f},
-std::array<float,2>{0.15309675f, 0.641873419f},
-std::array<float,2>{0.904361963f, 0.310789824f},
-std::array<float,2>{0.866378665f, 0.600198865f},
-std::array<float,2>{0.0358439237f, 0.465362549f},
-std::array<float,2>{0.405801624f, 0.770492196f},
-std::array<float,2>{0.540195227f, 0.0932027623f},
-std::array<float,2>{0.60494554f, 0.722406805f},
-std::array<float,2>{0.44797191f, 0.34096989f},
-std::array<float,2>{0.069083184f, 0.94429332f},
-std::array<float,2>{0.795646787f, 0.184851155f},
-std::array<float,2>{0.95135057f, 0.854723632f},
-std::array<float,2>{0.199016362f, 0.0413641259f},
-std::array<float,2>{0.254602522f, 0.560789049f},
-std::array<float,2>{0.632168531f, 0.397325933f},
-std::array<float,2>{0.525584757f, 0.791802943f},
-std::array<float,2>{0.426659763f, 0.101131186f},
-std::array<float,2>{0.0115309907f, 0.577037811f},
-std::array<float,2>{0.835742414f, 0.478627503f},
-std::array<float,2>{0.919067621f, 0.661896229f},
-std::array<float,2>{0.179318562f, 0.275885761f},
-std::array<float,2>{0.37431711f, 0.882088184f},
-std::array<float,2>{0.695248663f, 0.228188351f},
-std::array<float,2>{0.679379761f, 0.517579377f},
-std::array<float,2>{0.283260494f, 0.423676938f},
-std::array<float,2>{0.22386235f, 0.836953223f},
-std::array<float,2>{0.97864145f, 0.0261825919f},
-std::array<float,2>{0.750834703f, 0.99975419f},
-std::array<float,2>{0.0951043665f, 0.135542646f},
-std::array<float,2>{0.499841273f, 0.717513859f},
-std::array<float,2>{0.584589422f, 0.353660882f},
-std::array<float,2>{0.568516254f, 0.961512446f},
-std::array<float,2>{0.476741493f, 0.168389663f},
-std::array<float,2>{0.111955792f, 0.739519656f},
-std::array<float,2>{0.770505667f, 0.324489683f},
-std::array<float,2>{0.985732615f, 0.539971113f},
-std::array<float,2>{0.246386886f, 0.376374662f},
-std::array<float,2>{0.297086895f, 0.860924661f},
-std::array<float,2>{0.662752151f, 0.0545164682f},
-std::array<float,2>{0.707479715f, 0.631939054f},
-std::array<float,2>{0.349415898f, 0.283073008f},
-std::array<float,2>{0.164765581f, 0.929581225f},
-std::array<float,2>{0.923711896f, 0.206123412f},
-std::array<float,2>{0.81745702f, 0.758842051f},
-std::array<float,2>{0.0286040865f, 0.0731163472f},
-std::array<float,2>{0.409858435f, 0.623871922f},
-std::array<float,2>{0.501694202f, 0.443012267f},
-std::array<float,2>{0.643286347f, 0.816723585f},
-std::array<float,2>{0.271574318f, 0.0126231071f},
-std::array<float,2>{0.216399208f, 0.511933565f},
-std::array<float,2>{0.965937257f, 0.417592496f},
-std::array<float,2>{0.805014253f, 0.692037344f},
-std::array<float,2>{0.0793620497f, 0.374151826f},
-std::array<float,2>{0.463740408f, 0.980462968f},
-std::array<float,2>{0.620159268f, 0.141396493f},
-std::array<float,2>{0.557650566f, 0.58376503f},
-std::array<float,2>{0.390557259f, 0.487297267f},
-std::array<float,2>{0.0586973689f, 0.80372256f},
-std::array<float,2>{0.856657565f, 0.122612275f},
-std::array<float,2>{0.884439051f, 0.906097233f},
-std::array<float,2>{0.125958666f, 0.248058677f},
-std::array<float,2>{0.322077602f, 0.682164669f},
-std::array<float,2>{0.739512682f, 0.261690646f},
-std::array<float,2>{0.712023556f, 0.938088f},
-std::array<float,2>{0.35551706f, 0.183209404f},
-std::array<float,2>{0.161958471f, 0.723767519f},
-std::array<float,2>{0.936475515f, 0.337999165f},
-std::array<float,2>{0.822928905f, 0.558411062f},
-std::array<float,2>{0.0223639123f, 0.394217223f},
-std::array<float,2>{0.417832136f, 0.855773807f},
-std::array<float,2>{0.514597118f, 0.0463630036f},
-std::array<float,2>{0.576617002f, 0.646245003f},
-std::array<float,2>{0.472481221f, 0.307297528f},
-std::array<float,2>{0.120528765f, 0.912571132f},
-std::array<float,2>{0.775934279f, 0.189808995f},
-std::array<float,2>{0.999881268f, 0.769250035f},
-std::array<float,2>{0.239961028f, 0.0869585425f},
-std::array<float,2>{0.31106323f, 0.596048594f},
-std::array<float,2>{0.667459965f, 0.463513851f},
-std::array<float,2>{0.549671948f, 0.841303408f},
-std::array<float,2>{0.381384492f, 0.0281165652f},
-std::array<float,2>{0.0521742776f, 0.521980762f},
-std::array<float,2>{0.849984467f, 0.42898491f},
-std::array<float,2>{0.876338363f, 0.712188959f},
-std::array<float,2>{0.136349335f, 0.35907656f},
-std::array<float,2>{0.320145458f, 0.992340326f},
-std::array<float,2>{0.749814749f, 0.139082491f},
-std::array<float,2>{0.652601302f, 0.571536362f},
-std::array<float,2>{0.279452771f, 0.48082909f},
-std::array<float,2>{0.209010467f, 0.794424713f},
-std::array<float,2>{0.959887803f, 0.0963867307f},
-std::array<float,2>{0.801632404f, 0.875585854f},
-std::array<float,2>{0.0869033113f, 0.233394966f},
-std::array<float,2>{0.458681881f, 0.658905447f},
-std::array<float,2>{0.616917431f, 0.280652761f},
-std::array<float,2>{0.596673906f, 0.924661458f},
-std::array<float,2>{0.442335874f, 0.210267097f},
-std::array<float,2>{0.072473757f, 0.626514733f},
-std::array<float,2>{0.781729281f, 0.28534773f},
-std::array<float,2>{0.938348949f, 0.620621145f},
-std::array<float,2>{0.188214973f, 0.440133691f},
-std::array<float,2>{0.258412778f, 0.763683021f},
-std::array<float,2>{0.63762182f, 0.0758540556f},
-std::array<float,2>{0.728169024f, 0.737788439f},
-std::array<float,2>{0.333322942f, 0.32350859f},
-std::array<float,2>{0.146001369f, 0.96649003f},
-std::array<float,2>{0.892444074f, 0.166932255f},
-std::array<float,2>{0.874485135f, 0.866849244f},
-std::array<float,2>{0.0465785302f, 0.0498017929f},
-std::array<float,2>{0.393707037f, 0.544415951f},
-std::array<float,2>{0.538733363f, 0.382145286f},
-std::array<float,2>{0.681868613f, 0.799096525f},
-std::array<float,2>{0.294229746f, 0.12024606f},
-std::array<float,2>{0.227646276f, 0.578760147f},
-std::array<float,2>{0.968760431f, 0.49090755f},
-std::array<float,2>{0.759506643f, 0.685375273f},
-std::array<float,2>{0.10224653f, 0.264023155f},
-std::array<float,2>{0.490038425f, 0.901519835f},
-std::array<float,2>{0.592507064f, 0.246034235f},
-std::array<float,2>{0.521755755f, 0.511087418f},
-std::array<float,2>{0.435414523f, 0.418777525f},
-std::array<float,2>{0.0052648494f, 0.814925432f},
-std::array<float,2>{0.836143911f, 0.00943192467f},
-std::array<float,2>{0.910034239f, 0.981254995f},
-std::array<float,2>{0.181101844f, 0.147084743f},
-std::array<float,2>{0.361557692f, 0.690839469f},
-std::array<float,2>{0.700840116f, 0.368215561f},
-std::array<float,2>{0.627283216f, 0.891917408f},
-std::array<float,2>{0.252649575f, 0.235757113f},
-std::array<float,2>{0.199732959f, 0.676436305f},
-std::array<float,2>{0.9486534f, 0.251499742f},
-std::array<float,2>{0.792760313f, 0.587967873f},
-std::array<float,2>{0.0650711879f, 0.494253635f},
-std::array<float,2>{0.449994206f, 0.810976446f},
-std::array<float,2>{0.607766092f, 0.109536476f},
-std::array<float,2>{0.546615481f, 0.695644617f},
-std::array<float,2>{0.400991112f, 0.363482565f},
-std::array<float,2>{0.0316872932f, 0.974956334f},
-std::array<float,2>{0.862875879f, 0.149417162f},
-std::array<float,2>{0.901551604f, 0.820805609f},
-std::array<float,2>{0.151620388f, 0.000751591346f},
-std::array<float,2>{0.340223521f, 0.506765008f},
-std::array<float,2>{0.720390916f, 0.413528472f},
-std::array<float,2>{0.580931723f, 0.751530349f},
-std::array<float,2>{0.492817551f, 0.0702562481f},
-std::array<float,2>{0.0977232531f, 0.611235797f},
-std::array<float,2>{0.754965186f, 0.450687855f},
-std::array<float,2>{0.982674718f, 0.633174241f},
-std::array<float,2>{0.222471148f, 0.294366807f},
-std::array<float,2>{0.286228746f, 0.931500137f},
-std::array<float,2>{0.67354244f, 0.217892215f},
-std::array<float,2>{0.688643157f, 0.535875082f},
-std::array<float,2>{0.368132174f, 0.389221787f},
-std::array<float,2>{0.174637705f, 0.869843602f},
-std::array<float,2>{0.917586625f, 0.0575228073f},
-std::array<float,2>{0.831057191f, 0.958097935f},
-std::array<float,2>{0.0124710537f, 0.162029922f},
-std::array<float,2>{0.422144443f, 0.74887985f},
-std::array<float,2>{0.528832495f, 0.315016985f},
-std::array<float,2>{0.506526411f, 0.988272905f},
-std::array<float,2>{0.413729042f, 0.128749862f},
-std::array<float,2>{0.0246760808f, 0.70631659f},
-std::array<float,2>{0.813282728f, 0.345024228f},
-std::array<float,2>{0.928373277f, 0.53088522f},
-std::array<float,2>{0.169645935f, 0.431068629f},
-std::array<float,2>{0.347390264f, 0.832377732f},
-std::array<float,2>{0.704403341f, 0.0166785829f},
-std::array<float,2>{0.657234311f, 0.669804931f},
-std::array<float,2>{0.302157104f, 0.271702468f},
-std::array<float,2>{0.246004969f, 0.885301232f},
-std::array<float,2>{0.991988063f, 0.225749373f},
-std::array<float,2>{0.767315507f, 0.783859849f},
-std::array<float,2>{0.117099084f, 0.103415668f},
-std::array<float,2>{0.482592672f, 0.56840229f},
-std::array<float,2>{0.564945579f, 0.47584179f},
-std::array<float,2>{0.735988498f, 0.848585665f},
-std::array<float,2>{0.327144951f, 0.0387488306f},
-std::array<float,2>{0.132314816f, 0.551823974f},
-std::array<float,2>{0.889425576f, 0.401489109f},
-std::array<float,2>{0.852104306f, 0.733745217f},
-std::array<float,2>{0.0554848462f, 0.334016532f},
-std::array<float,2>{0.383677334f, 0.951967776f},
-std::array<float,2>{0.558743715f, 0.176217169f},
-std::array<float,2>{0.62440747f, 0.602303207f},
-std::array<float,2>{0.467151552f, 0.454491824f},
-std::array<float,2>{0.0858563706f, 0.779460669f},
-std::array<float,2>{0.80894357f, 0.0805345699f},
-std::array<float,2>{0.961465061f, 0.914102614f},
-std::array<float,2>{0.213387012f, 0.196937591f},
-std::array<float,2>{0.268324882f, 0.650398076f},
-std::array<float,2>{0.645039916f, 0.303314f},
-std::array<float,2>{0.63328582f, 0.992160261f},
-std::array<float,2>{0.263561428f, 0.13251245f},
-std::array<float,2>{0.19182092f, 0.708910406f},
-std::array<float,2>{0.94268322f, 0.34801355f},
-std::array<float,2>{0.787743509f, 0.526794851f},
-std::array<float,2>{0.0742762014f, 0.435299873f},
-std::array<float,2>{0.441195279f, 0.828775406f},
-std::array<float,2>{0.600143194f, 0.0202895477f},
-std::array<float,2>{0.531435847f, 0.664949f},
-std::array<float,2>{0.397975594f, 0.268920183f},
-std::array<float,2>{0.039853707f, 0.890384853f},
-std::array<float,2>{0.867911816f, 0.220264643f},
-std::array<float,2>{0.897328198f, 0.78745538f},
-std::array<float,2>{0.143360734f, 0.10597048f},
-std::array<float,2>{0.330458552f, 0.562722385f},
-std::array<float,2>{0.731402755f, 0.47123605f},
-std::array<float,2>{0.589599073f, 0.84476763f},
-std::array<float,2>{0.485288739f, 0.0339148305f},
-std::array<float,2>{0.107922263f, 0.550541461f},
-std::array<float,2>{0.764067531f, 0.402362138f},
-std::array<float,2>{0.97452271f, 0.728317499f},
-std::array<float,2>{0.230996102f, 0.330354333f},
-std::array<float,2>{0.290649474f, 0.94693923f},
-std::array<float,2>{0.684905887f, 0.17497693f},
-std::array<float,2>{0.697937608f, 0.607952595f},
-std::array<float,2>{0.366571546f, 0.459956735f},
-std::array<float,2>{0.184043556f, 0.776013076f},
-std::array<float,2>{0.913164496f, 0.0838603005f},
-std::array<float,2>{0.841373026f, 0.918671966f},
-std::array<float,2>{0.00257975096f, 0.199805871f},
-std::array<float,2>{0.430547357f, 0.655076087f},
-std::array<float,2>{0.518257916f, 0.300508976f},
-std::array<float,2>{0.510534525f, 0.897935629f},
-std::array<float,2>{0.41805473f, 0.240423769f},
-std::array<float,2>{0.0183881968f, 0.674677193f},
-std::array<float,2>{0.826489747f, 0.256818742f},
-std::array<float,2>{0.933277905f, 0.590001523f},
-std::array<float,2>{0.157520428f, 0.499019831f},
-std::array<float,2>{0.35520649f, 0.807826936f},
-std::array<float,2>{0.716918886f, 0.114704609f},
-std::array<float,2>{0.669868469f, 0.702167034f},
-std::array<float,2>{0.305426151f, 0.361173213f},
-std::array<float,2>{0.236624062f, 0.969240725f},
-std::array<float,2>{0.993817806f, 0.153423592f},
-std::array<float,2>{0.779002011f, 0.826669812f},
-std::array<float,2>{0.123271406f, 0.00548645575f},
-std::array<float,2>{0.476153105f, 0.502099752f},
-std::array<float,2>{0.571401536f, 0.409069479f},
-std::array<float,2>{0.742220521f, 0.755834639f},
-std::array<float,2>{0.31327191f, 0.0645335317f},
-std::array<float,2>{0.139647529f, 0.614948988f},
-std::array<float,2>{0.880970299f, 0.448608547f},
-std::array<float,2>{0.846931636f, 0.639504492f},
-std::array<float,2>{0.0499843843f, 0.291591644f},
-std::array<float,2>{0.375511885f, 0.93557018f},
-std::array<float,2>{0.551433325f, 0.211303979f},
-std::array<float,2>{0.612815499f, 0.533830166f},
-std::array<float,2>{0.453332424f, 0.386101127f},
-std::array<float,2>{0.0908977017f, 0.872226596f},
-std::array<float,2>{0.796981215f, 0.0589559451f},
-std::array<float,2>{0.955238342f, 0.956156969f},
-std::array<float,2>{0.206823111f, 0.157992512f},
-std::array<float,2>{0.276773423f, 0.744413733f},
-std::array<float,2>{0.650526285f, 0.318235308f},
-std::array<float,2>{0.710286617f, 0.928652942f},
-std::array<float,2>{0.351503581f, 0.205623329f},
-std::array<float,2>{0.167788506f, 0.631642044f},
-std::array<float,2>{0.92445308f, 0.281737685f},
-std::array<float,2>{0.818821371f, 0.624055624f},
-std::array<float,2>{0.0309061408f, 0.44147259f},
-std::array<float,2>{0.408121437f, 0.758501768f},
-std::array<float,2>{0.50306648f, 0.0734669119f},
-std::array<float,2>{0.56783247f, 0.738909543f},
-std::array<float,2>{0.480136067f, 0.325570524f},
-std::array<float,2>{0.110564157f, 0.962576687f},
-std::array<float,2>{0.773006916f, 0.169081941f},
-std::array<float,2>{0.986356795f, 0.859803617f},
-std::array<float,2>{0.248122692f, 0.0534330718f},
-std::array<float,2>{0.299761474f, 0.540096998f},
-std::array<float,2>{0.661967516f, 0.375889689f},
-std::array<float,2>{0.556040168f, 0.802897453f},
-std::array<float,2>{0.387613297f, 0.121246234f},
-std::array<float,2>{0.0606013574f, 0.582655668f},
-std::array<float,2>{0.858225465f, 0.488193452f},
-std::array<float,2>{0.886392832f, 0.682993829f},
-std::array<float,2>{0.128420889f, 0.260314763f},
-std::array<float,2>{0.322780401f, 0.90524745f},
-std::array<float,2>{0.741023064f, 0.24945493f},
-std::array<float,2>{0.641532481f, 0.513478577f},
-std::array<float,2>{0.269547135f, 0.416295171f},
-std::array<float,2>{0.21772854f, 0.817616343f},
-std::array<float,2>{0.967841148f, 0.0129966f},
-std::array<float,2>{0.807861567f, 0.978597581f},
-std::array<float,2>{0.0806717575f, 0.142362431f},
-std::array<float,2>{0.461883456f, 0.693193555f},
-std::array<float,2>{0.617202342f, 0.373426169f},
-std::array<float,2>{0.602939606f, 0.945167303f},
-std::array<float,2>{0.447183579f, 0.183982819f},
-std::array<float,2>{0.0681985915f, 0.720843613f},
-std::array<float,2>{0.793422997f, 0.339998871f},
-std::array<float,2>{0.949436128f, 0.561917305f},
-std::array<float,2>{0.196801722f, 0.398346394f},
-std::array<float,2>{0.257432491f, 0.853779316f},
-std::array<float,2>{0.62936765f, 0.0429504029f},
-std::array<float,2>{0.724782348f, 0.641055107f},
-std::array<float,2>{0.336747855f, 0.311609268f},
-std::array<float,2>{0.154690847f, 0.909523427f},
-std::array<float,2>{0.904091001f, 0.193093315f},
-std::array<float,2>{0.863509536f, 0.770934284f},
-std::array<float,2>{0.0383354351f, 0.092451781f},
-std::array<float,2>{0.403401554f, 0.601489246f},
-std::array<float,2>{0.541329861f, 0.466727912f},
-std::array<float,2>{0.676070809f, 0.836883485f},
-std::array<float,2>{0.281377345f, 0.0268508345f},
-std::array<float,2>{0.225177363f, 0.518584311f},
-std::array<float,2>{0.978318036f, 0.422677547f},
-std::array<float,2>{0.753844917f, 0.718540609f},
-std::array<float,2>{0.0958753079f, 0.35537383f},
-std::array<float,2>{0.496262401f, 0.998272538f},
-std::array<float,2>{0.58252877f, 0.135883912f},
-std::array<float,2>{0.523867011f, 0.577616632f},
-std::array<float,2>{0.429420531f, 0.480436295f},
-std::array<float,2>{0.00901735108f, 0.792052507f},
-std::array<float,2>{0.832099557f, 0.100398116f},
-std::array<float,2>{0.921539426f, 0.881179392f},
-std::array<float,2>{0.17646727f, 0.226819009f},
-std::array<float,2>{0.37221998f, 0.660732388f},
-std::array<float,2>{0.693154216f, 0.277127385f},
-std::array<float,2>{0.728996873f, 0.964882791f},
-std::array<float,2>{0.335105866f, 0.167523712f},
-std::array<float,2>{0.147189409f, 0.737138331f},
-std::array<float,2>{0.893895268f, 0.323124886f},
-std::array<float,2>{0.871944666f, 0.543266773f},
-std::array<float,2>{0.0448422618f, 0.38108173f},
-std::array<float,2>{0.391664177f, 0.86555922f},
-std::array<float,2>{0.536062658f, 0.0505907685f},
-std::array<float,2>{0.59435147f, 0.625277102f},
-std::array<float,2>{0.443701416f, 0.286568046f},
-std::array<float,2>{0.0708630309f, 0.925137103f},
-std::array<float,2>{0.784113109f, 0.209434882f},
-std::array<float,2>{0.939734221f, 0.764882147f},
-std::array<float,2>{0.190522388f, 0.0745391995f},
-std::array<float,2>{0.260748357f, 0.619215429f},
-std::array<float,2>{0.63896364f, 0.440532416f},
-std::array<float,2>{0.520457685f, 0.816353261f},
-std::array<float,2>{0.436356336f, 0.00813193806f},
-std::array<float,2>{0.0062468322f, 0.510025561f},
-std::array<float,2>{0.839113951f, 0.41976288f},
-std::array<float,2>{0.907387197f, 0.689890862f},
-std::array<float,2>{0.181967661f, 0.367723942f},
-std::array<float,2>{0.360017002f, 0.982162476f},
-std::array<float,2>{0.703046083f, 0.148256451f},
-std::array<float,2>{0.679964006f, 0.579541385f},
-std::array<float,2>{0.296347111f, 0.492168725f},
-std::array<float,2>{0.230229169f, 0.800419748f},
-std::array<float,2>{0.971379459f, 0.119373873f},
-std::array<float,2>{0.760177374f, 0.900843143f},
-std::array<float,2>{0.105133832f, 0.244469851f},
-std::array<float,2>{0.490618974f, 0.68378067f},
-std::array<float,2>{0.590037048f, 0.264900804f},
-std::array<float,2>{0.574914098f, 0.913361192f},
-std::array<float,2>{0.470115393f, 0.19088015f},
-std::array<float,2>{0.118943021f, 0.644835472f},
-std::array<float,2>{0.774505615f, 0.308501869f},
-std::array<float,2>{0.996297538f, 0.597370267f},
-std::array<float,2>{0.241550788f, 0.464524359f},
-std::array<float,2>{0.308899224f, 0.768439412f},
-std::array<float,2>{0.664924502f, 0.0868901759f},
-std::array<float,2>{0.71292299f, 0.723395646f},
-std::array<float,2>{0.357851744f, 0.339377493f},
-std::array<float,2>{0.163186982f, 0.939129472f},
-std::array<float,2>{0.935257554f, 0.182245791f},
-std::array<float,2>{0.821257412f, 0.856658697f},
-std::array<float,2>{0.0205086693f, 0.0458405912f},
-std::array<float,2>{0.415027022f, 0.556700408f},
-std::array<float,2>{0.512378752f, 0.392752647f},
-std::array<float,2>{0.655801296f, 0.793347538f},
-std::array<float,2>{0.278940946f, 0.0970114619f},
-std::array<float,2>{0.207494348f, 0.571166694f},
-std::array<float,2>{0.957837105f, 0.481667757f},
-std::array<float,2>{0.804082751f, 0.659912825f},
-std::array<float,2>{0.0895689204f, 0.279914349f},
-std::array<float,2>{0.45925653f, 0.876385033f},
-std::array<float,2>{0.614691675f, 0.233680934f},
-std::array<float,2>{0.547328711f, 0.522877932f},
-std::array<float,2>{0.380061299f, 0.427848876f},
-std::array<float,2>{0.0528229289f, 0.840721548f},
-std::array<float,2>{0.848003864f, 0.0289260726f},
-std::array<float,2>{0.878807843f, 0.993386209f},
-std::array<float,2>{0.134274349f, 0.140116379f},
-std::array<float,2>{0.318019092f, 0.711202621f},
-std::array<float,2>{0.746929765f, 0.357472301f},
-std::array<float,2>{0.659206033f, 0.886089802f},
-std::array<float,2>{0.302756488f, 0.225326627f},
-std::array<float,2>{0.243650138f, 0.668301344f},
-std::array<float,2>{0.98922646f, 0.273278743f},
-std::array<float,2>{0.769209683f, 0.570293844f},
-std::array<float,2>{0.114993677f, 0.474914461f},
-std::array<float,2>{0.482222736f, 0.784562051f},
-std::array<float,2>{0.562618852f, 0.101677418f},
-std::array<float,2>{0.50401485f, 0.705156684f},
-std::array<float,2>{0.41041398f, 0.343911469f},
-std::array<float,2>{0.0260653589f, 0.986409009f},
-std::array<float,2>{0.816087246f, 0.127048731f},
-std::array<float,2>{0.926054478f, 0.833983421f},
-std::array<float,2>{0.171724528f, 0.0162230395f},
-std::array<float,2>{0.345042229f, 0.529986322f},
-std::array<float,2>{0.705243766f, 0.429824471f},
-std::array<float,2>{0.622933984f, 0.780295372f},
-std::array<float,2>{0.46656099f, 0.0815447792f},
-std::array<float,2>{0.0837128833f, 0.602659523f},
-std::array<float,2>{0.811275601f, 0.45372206f},
-std::array<float,2>{0.96308887f, 0.651371241f},
-std::array<float,2>{0.21145764f, 0.304472357f},
-std::array<float,2>{0.266061068f, 0.915074944f},
-std::array<float,2>{0.64747721f, 0.195794761f},
-std::array<float,2>{0.737357438f, 0.551234722f},
-std::array<float,2>{0.325046748f, 0.400602043f},
-std::array<float,2>{0.130198434f, 0.849231124f},
-std::array<float,2>{0.886742771f, 0.0380588397f},
-std::array<float,2>{0.855032146f, 0.95286566f},
-std::array<float,2>{0.0570393205f, 0.177628756f},
-std::array<float,2>{0.385363996f, 0.732855439f},
-std::array<float,2>{0.560770512f, 0.335232109f},
-std::array<float,2>{0.543976068f, 0.976025522f},
-std::array<float,2>{0.399599612f, 0.148791879f},
-std::array<float,2>{0.0346746631f, 0.697016478f},
-std::array<float,2>{0.861126482f, 0.364890903f},
-std::array<float,2>{0.898759484f, 0.507108569f},
-std::array<float,2>{0.150298581f, 0.412582725f},
-std::array<float,2>{0.342890859f, 0.822057605f},
-std::array<float,2>{0.721679211f, 0.00153982977f},
-std::array<float,2>{0.625201821f, 0.676965952f},
-std::array<float,2>{0.250869513f, 0.250546157f},
-std::array<float,2>{0.201264411f, 0.891254723f},
-std::array<float,2>{0.946176589f, 0.234544873f},
-std::array<float,2>{0.789873064f, 0.812189817f},
-std::array<float,2>{0.063496083f, 0.110368863f},
-std::array<float,2>{0.452665865f, 0.589086354f},
-std::array<float,2>{0.606916308f, 0.495333344f},
-std::array<float,2>{0.690783203f, 0.870353222f},
-std::array<float,2>{0.370985955f, 0.0581079759f},
-std::array<float,2>{0.172605187f, 0.536704659f},
-std::array<float,2>{0.915519297f, 0.390508413f},
-std::array<float,2>{0.82899648f, 0.749913931f},
-std::array<float,2>{0.0145990681f, 0.31589213f},
-std::array<float,2>{0.425317436f, 0.957942128f},
-std::array<float,2>{0.530275583f, 0.160842821f},
-std::array<float,2>{0.579777777f, 0.609999716f},
-std::array<float,2>{0.495567024f, 0.450182587f},
-std::array<float,2>{0.101480663f, 0.750621974f},
-std::array<float,2>{0.756480336f, 0.0683716238f},
-std::array<float,2>{0.982417941f, 0.930548728f},
-std::array<float,2>{0.220603421f, 0.217544228f},
-std::array<float,2>{0.287396878f, 0.634607732f},
-std::array<float,2>{0.674140871f, 0.293730557f},
-std::array<float,2>{0.687196076f, 0.947470665f},
-std::array<float,2>{0.29289192f, 0.173037007f},
-std::array<float,2>{0.232900947f, 0.728717387f},
-std::array<float,2>{0.976131082f, 0.328395516f},
-std::array<float,2>{0.762401998f, 0.547260463f},
-std::array<float,2>{0.105820581f, 0.40516147f},
-std::array<float,2>{0.487528235f, 0.846093833f},
-std::array<float,2>{0.587774754f, 0.0320743769f},
-std::array<float,2>{0.516628921f, 0.652971208f},
-std::array<float,2>{0.432447106f, 0.297527969f},
-std::array<float,2>{0.000169969979f, 0.921664774f},
-std::array<float,2>{0.84332943f, 0.202217221f},
-std::array<float,2>{0.911825478f, 0.774158955f},
-std::array<float,2>{0.186846316f, 0.0853218138f},
-std::array<float,2>{0.364532083f, 0.606861293f},
-std::array<float,2>{0.696766794f, 0.457188129f},
-std::array<float,2>{0.599236727f, 0.831752956f},
-std::array<float,2>{0.437938958f, 0.0221323874f},
-std::array<float,2>{0.0769207105f, 0.524130106f},
-std::array<float,2>{0.786437809f, 0.436935514f},
-std::array<float,2>{0.944815516f, 0.709087014f},
-std::array<float,2>{0.194994092f, 0.35061574f},
-std::array<float,2>{0.264680654f, 0.989924908f},
-std::array<float,2>{0.636602104f, 0.129578397f},
-std::array<float,2>{0.73351115f, 0.564971507f},
-std::array<float,2>{0.329925388f, 0.470665634f},
-std::array<float,2>{0.141041145f, 0.786564767f},
-std::array<float,2>{0.896283805f, 0.109360114f},
-std::array<float,2>{0.870520294f, 0.887084663f},
-std::array<float,2>{0.0417101979f, 0.221050411f},
-std::array<float,2>{0.394713581f, 0.666763961f},
-std::array<float,2>{0.534489751f, 0.266608536f},
-std::array<float,2>{0.552776694f, 0.934339404f},
-std::array<float,2>{0.378813833f, 0.213656396f},
-std::array<float,2>{0.048203256f, 0.637284279f},
-std::array<float,2>{0.845525026f, 0.290790826f},
-std::array<float,2>{0.879779577f, 0.616098285f},
-std::array<float,2>{0.13704057f, 0.445509017f},
-std::array<float,2>{0.316039056f, 0.755948424f},
-std::array<float,2>{0.745214522f, 0.0644035637f},
-std::array<float,2>{0.650127053f, 0.74330914f},
-std::array<float,2>{0.27391699f, 0.319443047f},
-std::array<float,2>{0.204559535f, 0.954999864f},
-std::array<float,2>{0.955057383f, 0.160078228f},
-std::array<float,2>{0.799126208f, 0.873232305f},
-std::array<float,2>{0.0927586555f, 0.0617642403f},
-std::array<float,2>{0.455536157f, 0.531370461f},
-std::array<float,2>{0.610134423f, 0.384578675f},
-std::array<float,2>{0.716753602f, 0.805605948f},
-std::array<float,2>{0.353100955f, 0.116780348f},
-std::array<float,2>{0.15983206f, 0.592332542f},
-std::array<float,2>{0.930067122f, 0.498034596f},
-std::array<float,2>{0.824446797f, 0.672081351f},
-std::array<float,2>{0.0161248073f, 0.254435897f},
-std::array<float,2>{0.421562642f, 0.894930303f},
-std::array<float,2>{0.509068668f, 0.238652721f},
-std::array<float,2>{0.57292062f, 0.501134157f},
-std::array<float,2>{0.472999603f, 0.406939298f},
-std::array<float,2>{0.121667556f, 0.826127529f},
-std::array<float,2>{0.781187892f, 0.0058790287f},
-std::array<float,2>{0.99552381f, 0.972643077f},
-std::array<float,2>{0.234554112f, 0.156124845f},
-std::array<float,2>{0.307889074f, 0.699578643f},
-std::array<float,2>{0.671015561f, 0.362183273f},
-std::array<float,2>{0.738355935f, 0.90328604f},
-std::array<float,2>{0.320743799f, 0.247181401f},
-std::array<float,2>{0.126299605f, 0.681068242f},
-std::array<float,2>{0.883181036f, 0.258224249f},
-std::array<float,2>{0.8555848f, 0.584560037f},
-std::array<float,2>{0.0602566674f, 0.485199571f},
-std::array<float,2>{0.389219105f, 0.802065194f},
-std::array<float,2>{0.557578325f, 0.123589203f},
-std::array<float,2>{0.619745135f, 0.693628609f},
-std::array<float,2>{0.46403867f, 0.371677697f},
-std::array<float,2>{0.0787552968f, 0.977177799f},
-std::array<float,2>{0.806494057f, 0.142969221f},
-std::array<float,2>{0.96514523f, 0.819872916f},
-std::array<float,2>{0.215312049f, 0.0145815574f},
-std::array<float,2>{0.272749573f, 0.514910996f},
-std::array<float,2>{0.643984258f, 0.415132374f},
-std::array<float,2>{0.500251114f, 0.76137495f},
-std::array<float,2>{0.409024984f, 0.0705175176f},
-std::array<float,2>{0.0282132868f, 0.62129885f},
-std::array<float,2>{0.817169428f, 0.444726586f},
-std::array<float,2>{0.921990514f, 0.630824149f},
-std::array<float,2>{0.165057421f, 0.283453912f},
-std::array<float,2>{0.347700685f, 0.925980628f},
-std::array<float,2>{0.708621442f, 0.203409851f},
-std::array<float,2>{0.663593888f, 0.54280895f},
-std::array<float,2>{0.29858163f, 0.377220094f},
-std::array<float,2>{0.24712643f, 0.862211585f},
-std::array<float,2>{0.985132039f, 0.0510596447f},
-std::array<float,2>{0.770855129f, 0.963867188f},
-std::array<float,2>{0.11310102f, 0.170293391f},
-std::array<float,2>{0.478493273f, 0.741069436f},
-std::array<float,2>{0.569430232f, 0.32701385f},
-std::array<float,2>{0.585642576f, 0.996453285f},
-std::array<float,2>{0.498631954f, 0.133295894f},
-std::array<float,2>{0.0947071537f, 0.716168284f},
-std::array<float,2>{0.751280904f, 0.351932466f},
-std::array<float,2>{0.979976118f, 0.516988099f},
-std::array<float,2>{0.223046243f, 0.424624562f},
-std::array<float,2>{0.284718156f, 0.839552224f},
-std::array<float,2>{0.677819967f, 0.0239202324f},
-std::array<float,2>{0.693808496f, 0.663597763f},
-std::array<float,2>{0.37387374f, 0.273558766f},
-std::array<float,2>{0.178470045f, 0.879328966f},
-std::array<float,2>{0.918773115f, 0.228841707f},
-std::array<float,2>{0.83464092f, 0.790021896f},
-std::array<float,2>{0.0104234358f, 0.0989872143f},
-std::array<float,2>{0.42716819f, 0.574400604f},
-std::array<float,2>{0.526920736f, 0.478300393f},
-std::array<float,2>{0.631757081f, 0.852992296f},
-std::array<float,2>{0.255315036f, 0.039075885f},
-std::array<float,2>{0.198179096f, 0.559117794f},
-std::array<float,2>{0.952235401f, 0.395932645f},
-std::array<float,2>{0.796166778f, 0.719926953f},
-std::array<float,2>{0.0697944313f, 0.341903061f},
-std::array<float,2>{0.449212849f, 0.941731751f},
-std::array<float,2>{0.604240358f, 0.185870692f},
-std::array<float,2>{0.539361238f, 0.599148154f},
-std::array<float,2>{0.404352456f, 0.467861533f},
-std::array<float,2>{0.0363857597f, 0.771587372f},
-std::array<float,2>{0.865633607f, 0.0908298194f},
-std::array<float,2>{0.906230986f, 0.907447517f},
-std::array<float,2>{0.153940916f, 0.194432259f},
-std::array<float,2>{0.338807374f, 0.644375682f},
-std::array<float,2>{0.724540353f, 0.309401304f},
-std::array<float,2>{0.699919224f, 0.983209729f},
-std::array<float,2>{0.362635344f, 0.144812748f},
-std::array<float,2>{0.180464774f, 0.68909663f},
-std::array<float,2>{0.908657849f, 0.370403737f},
-std::array<float,2>{0.837207735f, 0.507839382f},
-std::array<float,2>{0.00444760872f, 0.4212704f},
-std::array<float,2>{0.434268564f, 0.813363194f},
-std::array<float,2>{0.523135602f, 0.0107279746f},
-std::array<float,2>{0.592957199f, 0.686473548f},
-std::array<float,2>{0.488541573f, 0.26349467f},
-std::array<float,2>{0.103349157f, 0.899953425f},
-std::array<float,2>{0.758526921f, 0.244084343f},
-std::array<float,2>{0.969741583f, 0.798475862f},
-std::array<float,2>{0.22694248f, 0.118230872f},
-std::array<float,2>{0.293176591f, 0.58190012f},
-std::array<float,2>{0.682764173f, 0.489278436f},
-std::array<float,2>{0.537393153f, 0.863314807f},
-std::array<float,2>{0.392852187f, 0.0474776439f},
-std::array<float,2>{0.0456035435f, 0.545914292f},
-std::array<float,2>{0.873399436f, 0.380051523f},
-std::array<float,2>{0.891522169f, 0.736216128f},
-std::array<float,2>{0.14467828f, 0.321383268f},
-std::array<float,2>{0.332149208f, 0.967398703f},
-std::array<float,2>{0.727389634f, 0.165540174f},
-std::array<float,2>{0.638586223f, 0.617271721f},
-std::array<float,2>{0.259102553f, 0.438105464f},
-std::array<float,2>{0.188580319f, 0.763476074f},
-std::array<float,2>{0.938974977f, 0.0780779719f},
-std::array<float,2>{0.782312393f, 0.922607005f},
-std::array<float,2>{0.0736364275f, 0.208756626f},
-std::array<float,2>{0.442890376f, 0.62763226f},
-std::array<float,2>{0.597423792f, 0.28714034f},
-std::array<float,2>{0.61588496f, 0.878595293f},
-std::array<float,2>{0.457112759f, 0.231802478f},
-std::array<float,2>{0.0871578455f, 0.65793401f},
-std::array<float,2>{0.802348614f, 0.278709531f},
-std::array<float,2>{0.960052431f, 0.573135436f},
-std::array<float,2>{0.210911989f, 0.483467788f},
-std::array<float,2>{0.280508041f, 0.795131385f},
-std::array<float,2>{0.653544366f, 0.0944524631f},
-std::array<float,2>{0.748214781f, 0.713907123f},
-std::array<float,2>{0.318924516f, 0.357337922f},
-std::array<float,2>{0.134859398f, 0.9952721f},
-std::array<float,2>{0.875382066f, 0.138531983f},
-std::array<float,2>{0.851052999f, 0.843225777f},
-std::array<float,2>{0.0516056716f, 0.030323999f},
-std::array<float,2>{0.382725149f, 0.520737946f},
-std::array<float,2>{0.550667524f, 0.427551955f},
-std::array<float,2>{0.666491866f, 0.766908944f},
-std::array<float,2>{0.311791182f, 0.0887457654f},
-std::array<float,2>{0.239005551f, 0.595300078f},
-std::array<float,2>{0.998487353f, 0.462401986f},
-std::array<float,2>{0.776399851f, 0.647671163f},
-std::array<float,2>{0.119970627f, 0.305835038f},
-std::array<float,2>{0.471524358f, 0.911295235f},
-std::array<float,2>{0.577362835f, 0.18937172f},
-std::array<float,2>{0.515052557f, 0.554818153f},
-std::array<float,2>{0.416152358f, 0.391604364f},
-std::array<float,2>{0.0228266362f, 0.85918504f},
-std::array<float,2>{0.823836923f, 0.0448691137f},
-std::array<float,2>{0.93671608f, 0.939503312f},
-std::array<float,2>{0.160312667f, 0.180715665f},
-std::array<float,2>{0.356485933f, 0.724790037f},
-std::array<float,2>{0.711442351f, 0.336516827f},
-std::array<float,2>{0.645879328f, 0.917649031f},
-std::array<float,2>{0.268569976f, 0.197319999f},
-std::array<float,2>{0.214714393f, 0.649459898f},
-std::array<float,2>{0.962159634f, 0.301358759f},
-std::array<float,2>{0.809627771f, 0.604448915f},
-std::array<float,2>{0.0845958441f, 0.456487864f},
-std::array<float,2>{0.468275428f, 0.778366983f},
-std::array<float,2>{0.623593271f, 0.078673631f},
-std::array<float,2>{0.560428619f, 0.73161453f},
-std::array<float,2>{0.384645522f, 0.332102686f},
-std::array<float,2>{0.0564310551f, 0.950918615f},
-std::array<float,2>{0.853322804f, 0.177830964f},
-std::array<float,2>{0.890337229f, 0.850887179f},
-std::array<float,2>{0.131595567f, 0.0358434506f},
-std::array<float,2>{0.327845186f, 0.554440737f},
-std::array<float,2>{0.734389901f, 0.399482697f},
-std::array<float,2>{0.565529168f, 0.781348526f},
-std::array<float,2>{0.483799398f, 0.104232326f},
-std::array<float,2>{0.115716353f, 0.568230927f},
-std::array<float,2>{0.765635967f, 0.472717017f},
-std::array<float,2>{0.990978003f, 0.67104739f},
-std::array<float,2>{0.244197264f, 0.269690335f},
-std::array<float,2>{0.301063538f, 0.884106994f},
-std::array<float,2>{0.656681001f, 0.224181771f},
-std::array<float,2>{0.703535378f, 0.527733564f},
-std::array<float,2>{0.346548676f, 0.431932598f},
-std::array<float,2>{0.168033227f, 0.834447503f},
-std::array<float,2>{0.929496467f, 0.0190966073f},
-std::array<float,2>{0.813714623f, 0.986221731f},
-std::array<float,2>{0.0237672254f, 0.125667974f},
-std::array<float,2>{0.412413508f, 0.703657687f},
-std::array<float,2>{0.507017136f, 0.347637385f},
-std::array<float,2>{0.527541935f, 0.959977746f},
-std::array<float,2>{0.423444271f, 0.162690684f},
-std::array<float,2>{0.0135031724f, 0.746646762f},
-std::array<float,2>{0.830659509f, 0.313221544f},
-std::array<float,2>{0.916437924f, 0.538364589f},
-std::array<float,2>{0.175366759f, 0.388602942f},
-std::array<float,2>{0.368931442f, 0.867355585f},
-std::array<float,2>{0.688005865f, 0.0557195768f},
-std::array<float,2>{0.671988666f, 0.636034787f},
-std::array<float,2>{0.285751581f, 0.295610309f},
-std::array<float,2>{0.221448809f, 0.932888925f},
-std::array<float,2>{0.983745992f, 0.21614401f},
-std::array<float,2>{0.754315794f, 0.752295852f},
-std::array<float,2>{0.0988979489f, 0.0672951341f},
-std::array<float,2>{0.493884057f, 0.612478435f},
-std::array<float,2>{0.581115723f, 0.45274213f},
-std::array<float,2>{0.718985558f, 0.823873699f},
-std::array<float,2>{0.341263115f, 0.00199541682f},
-std::array<float,2>{0.151101992f, 0.50435853f},
-std::array<float,2>{0.900423765f, 0.410644054f},
-std::array<float,2>{0.861359775f, 0.69767803f},
-std::array<float,2>{0.0323342644f, 0.366792798f},
-std::array<float,2>{0.401905805f, 0.972976089f},
-std::array<float,2>{0.545814633f, 0.15143539f},
-std::array<float,2>{0.608487368f, 0.586699486f},
-std::array<float,2>{0.450443476f, 0.492705345f},
-std::array<float,2>{0.066393286f, 0.810448587f},
-std::array<float,2>{0.791983306f, 0.112538517f},
-std::array<float,2>{0.94801873f, 0.894215763f},
-std::array<float,2>{0.200906023f, 0.237442121f},
-std::array<float,2>{0.252955079f, 0.67915225f},
-std::array<float,2>{0.628267109f, 0.253130764f},
-std::array<float,2>{0.629743338f, 0.942146063f},
-std::array<float,2>{0.25691852f, 0.186478138f},
-std::array<float,2>{0.196441844f, 0.720536053f},
-std::array<float,2>{0.949931681f, 0.342401206f},
-std::array<float,2>{0.793877661f, 0.558712602f},
-std::array<float,2>{0.0674730092f, 0.396272659f},
-std::array<float,2>{0.446554214f, 0.853294432f},
-std::array<float,2>{0.603473902f, 0.0399194695f},
-std::array<float,2>{0.541815102f, 0.643849075f},
-std::array<float,2>{0.404295921f, 0.308607787f},
-std::array<float,2>{0.0385928713f, 0.908182979f},
-std::array<float,2>{0.863963008f, 0.195125639f},
-std::array<float,2>{0.903519273f, 0.772212684f},
-std::array<float,2>{0.155207559f, 0.0916596726f},
-std::array<float,2>{0.336264163f, 0.598837912f},
-std::array<float,2>{0.725482881f, 0.468487799f},
-std::array<float,2>{0.582321167f, 0.839275062f},
-std::array<float,2>{0.496730983f, 0.0240356158f},
-std::array<float,2>{0.0965694711f, 0.51719588f},
-std::array<float,2>{0.753108799f, 0.423878968f},
-std::array<float,2>{0.977928042f, 0.716317773f},
-std::array<float,2>{0.224817365f, 0.352184713f},
-std::array<float,2>{0.282173991f, 0.996599793f},
-std::array<float,2>{0.676563263f, 0.133541763f},
-std::array<float,2>{0.692860484f, 0.574984789f},
-std::array<float,2>{0.372928649f, 0.477717817f},
-std::array<float,2>{0.175997272f, 0.789082706f},
-std::array<float,2>{0.921160996f, 0.0993082076f},
-std::array<float,2>{0.832851291f, 0.879814386f},
-std::array<float,2>{0.00971568096f, 0.229260176f},
-std::array<float,2>{0.42891109f, 0.663294017f},
-std::array<float,2>{0.524164379f, 0.274096727f},
-std::array<float,2>{0.503760159f, 0.926334202f},
-std::array<float,2>{0.407711416f, 0.204068244f},
-std::array<float,2>{0.0305583235f, 0.630303323f},
-std::array<float,2>{0.819300234f, 0.283777118f},
-std::array<float,2>{0.924195468f, 0.621894121f},
-std::array<float,2>{0.167095318f, 0.445017606f},
-std::array<float,2>{0.35060966f, 0.761138082f},
-std::array<float,2>{0.71054101f, 0.0710853264f},
-std::array<float,2>{0.661352754f, 0.74055934f},
-std::array<float,2>{0.299092442f, 0.3263098f},
-std::array<float,2>{0.24881272f, 0.964538336f},
-std::array<float,2>{0.987045407f, 0.1708709f},
-std::array<float,2>{0.772604764f, 0.861553431f},
-std::array<float,2>{0.111193851f, 0.0516899079f},
-std::array<float,2>{0.479519576f, 0.542451859f},
-std::array<float,2>{0.568185747f, 0.377676189f},
-std::array<float,2>{0.740530729f, 0.802304506f},
-std::array<float,2>{0.322345823f, 0.123515017f},
-std::array<float,2>{0.128076807f, 0.584363699f},
-std::array<float,2>{0.885954678f, 0.484825611f},
-std::array<float,2>{0.857539296f, 0.681204975f},
-std::array<float,2>{0.0614027381f, 0.258322626f},
-std::array<float,2>{0.386979342f, 0.902437508f},
-std::array<float,2>{0.556497574f, 0.247575745f},
-std::array<float,2>{0.617996693f, 0.515191615f},
-std::array<float,2>{0.460988939f, 0.415989429f},
-std::array<float,2>{0.0803348497f, 0.819734454f},
-std::array<float,2>{0.808248878f, 0.0139479879f},
-std::array<float,2>{0.968423605f, 0.976654291f},
-std::array<float,2>{0.217170149f, 0.143381774f},
-std::array<float,2>{0.270367295f, 0.694203556f},
-std::array<float,2>{0.641059518f, 0.371411204f},
-std::array<float,2>{0.717342138f, 0.895087719f},
-std::array<float,2>{0.354795307f, 0.239111573f},
-std::array<float,2>{0.158028156f, 0.672529101f},
-std::array<float,2>{0.932817161f, 0.254060358f},
-std::array<float,2>{0.827053666f, 0.592082143f},
-std::array<float,2>{0.0178179331f, 0.497224063f},
-std::array<float,2>{0.418845594f, 0.804701626f},
-std::array<float,2>{0.510011613f, 0.116288118f},
-std::array<float,2>{0.572226167f, 0.700033963f},
-std::array<float,2>{0.475749701f, 0.361628741f},
-std::array<float,2>{0.123545267f, 0.972117186f},
-std::array<float,2>{0.778717339f, 0.155303925f},
-std::array<float,2>{0.993221819f, 0.82545954f},
-std::array<float,2>{0.237133667f, 0.00680631399f},
-std::array<float,2>{0.305043072f, 0.501784682f},
-std::array<float,2>{0.6692518f, 0.406479418f},
-std::array<float,2>{0.550850928f, 0.756739497f},
-std::array<float,2>{0.375372946f, 0.0636282712f},
-std::array<float,2>{0.0504650585f, 0.615652502f},
-std::array<float,2>{0.847634017f, 0.446138114f},
-std::array<float,2>{0.881549418f, 0.637065232f},
-std::array<float,2>{0.138728768f, 0.29046914f},
-std::array<float,2>{0.31280458f, 0.933971703f},
-std::array<float,2>{0.742921889f, 0.213085085f},
-std::array<float,2>{0.651081979f, 0.531894505f},
-std::array<float,2>{0.277221471f, 0.383935213f},
-std::array<float,2>{0.206352413f, 0.873849034f},
-std::array<float,2>{0.955669999f, 0.0622045659f},
-std::array<float,2>{0.797783494f, 0.954477489f},
-std::array<float,2>{0.0915115699f, 0.159215167f},
-std::array<float,2>{0.453659981f, 0.743899584f},
-std::array<float,2>{0.612653136f, 0.320007175f},
-std::array<float,2>{0.599612236f, 0.989328921f},
-std::array<float,2>{0.440836728f, 0.128911972f},
-std::array<float,2>{0.0747728199f, 0.709917068f},
-std::array<float,2>{0.787326276f, 0.351422995f},
-std::array<float,2>{0.943100333f, 0.523777127f},
-std::array<float,2>{0.19203797f, 0.437176019f},
-std::array<float,2>{0.263065368f, 0.83127898f},
-std::array<float,2>{0.6333251f, 0.0215478167f},
-std::array<float,2>{0.730873108f, 0.666258276f},
-std::array<float,2>{0.330810964f, 0.267163783f},
-std::array<float,2>{0.142683402f, 0.887243927f},
-std::array<float,2>{0.896913588f, 0.221544698f},
-std::array<float,2>{0.867647111f, 0.78663981f},
-std::array<float,2>{0.0392226167f, 0.108434409f},
-std::array<float,2>{0.397948593f, 0.564501107f},
-std::array<float,2>{0.53215456f, 0.469981134f},
-std::array<float,2>{0.685245693f, 0.846425712f},
-std::array<float,2>{0.290333152f, 0.0316081718f},
-std::array<float,2>{0.230776533f, 0.547660887f},
-std::array<float,2>{0.973905623f, 0.40450421f},
-std::array<float,2>{0.764227867f, 0.729256511f},
-std::array<float,2>{0.107856669f, 0.329079986f},
-std::array<float,2>{0.484422803f, 0.948205054f},
-std::array<float,2>{0.589171827f, 0.17339161f},
-std::array<float,2>{0.517847538f, 0.607046843f},
-std::array<float,2>{0.429873317f, 0.457800299f},
-std::array<float,2>{0.00208118604f, 0.773733497f},
-std::array<float,2>{0.840852439f, 0.0856215879f},
-std::array<float,2>{0.913748384f, 0.921314001f},
-std::array<float,2>{0.184151128f, 0.202936381f},
-std::array<float,2>{0.366748929f, 0.652512133f},
-std::array<float,2>{0.697637022f, 0.297105372f},
-std::array<float,2>{0.720863104f, 0.973241448f},
-std::array<float,2>{0.343281507f, 0.152229592f},
-std::array<float,2>{0.149736553f, 0.69809109f},
-std::array<float,2>{0.899369061f, 0.366315722f},
-std::array<float,2>{0.860379159f, 0.504628122f},
-std::array<float,2>{0.0343370326f, 0.410985887f},
-std::array<float,2>{0.400057942f, 0.823702335f},
-std::array<float,2>{0.54483372f, 0.00252656266f},
-std::array<float,2>{0.607142746f, 0.679595172f},
-std::array<float,2>{0.452494502f, 0.253664553f},
-std::array<float,2>{0.0643480867f, 0.893960834f},
-std::array<float,2>{0.789524794f, 0.237985849f},
-std::array<float,2>{0.945474446f, 0.809780478f},
-std::array<float,2>{0.20209603f, 0.112955146f},
-std::array<float,2>{0.250481874f, 0.586341023f},
-std::array<float,2>{0.625835121f, 0.49222976f},
-std::array<float,2>{0.531241357f, 0.867780626f},
-std::array<float,2>{0.42495048f, 0.0563797951f},
-std::array<float,2>{0.0137611413f, 0.539042294f},
-std::array<float,2>{0.82816571f, 0.388044864f},
-std::array<float,2>{0.915839016f, 0.746219277f},
-std::array<float,2>{0.172068655f, 0.312821448f},
-std::array<float,2>{0.370486051f, 0.960493267f},
-std::array<float,2>{0.691172004f, 0.162436798f},
-std::array<float,2>{0.674602807f, 0.6132195f},
-std::array<float,2>{0.287609786f, 0.452165097f},
-std::array<float,2>{0.219867721f, 0.75264889f},
-std::array<float,2>{0.98183912f, 0.0667446777f},
-std::array<float,2>{0.756088078f, 0.933328927f},
-std::array<float,2>{0.100843735f, 0.216469392f},
-std::array<float,2>{0.495904505f, 0.636387646f},
-std::array<float,2>{0.579494476f, 0.295368344f},
-std::array<float,2>{0.563210487f, 0.884355068f},
-std::array<float,2>{0.481756896f, 0.223775759f},
-std::array<float,2>{0.114677906f, 0.671764433f},
-std::array<float,2>{0.76892966f, 0.270040035f},
-std::array<float,2>{0.988609076f, 0.567763329f},
-std::array<float,2>{0.244027987f, 0.473396778f},
-std::array<float,2>{0.303303272f, 0.782017231f},
-std::array<float,2>{0.659672081f, 0.103936799f},
-std::array<float,2>{0.705863059f, 0.703359008f},
-std::array<float,2>{0.345274985f, 0.347158134f},
-std::array<float,2>{0.171130881f, 0.985407174f},
-std::array<float,2>{0.926706791f, 0.125268668f},
-std::array<float,2>{0.815639555f, 0.834878087f},
-std::array<float,2>{0.0257958863f, 0.0187427402f},
-std::array<float,2>{0.410990238f, 0.528238416f},
-std::array<float,2>{0.504495144f, 0.432478547f},
-std::array<float,2>{0.648110688f, 0.778819501f},
-std::array<float,2>{0.266229928f, 0.0783135965f},
-std::array<float,2>{0.211320281f, 0.603518248f},
-std::array<float,2>{0.963794172f, 0.456816286f},
-std::array<float,2>{0.810817182f, 0.650183856f},
-std::array<float,2>{0.0832331255f, 0.301128447f},
-std::array<float,2>{0.466099709f, 0.917412221f},
-std::array<float,2>{0.62215662f, 0.198070079f},
-std::array<float,2>{0.561156332f, 0.553749025f},
-std::array<float,2>{0.385027289f, 0.399983674f},
-std::array<float,2>{0.0572471432f, 0.851349711f},
-std::array<float,2>{0.854949474f, 0.0354289971f},
-std::array<float,2>{0.887573063f, 0.950480998f},
-std::array<float,2>{0.130685404f, 0.178598359f},
-std::array<float,2>{0.32457149f, 0.731996655f},
-std::array<float,2>{0.737799585f, 0.332543194f},
-std::array<float,2>{0.664317012f, 0.911650956f},
-std::array<float,2>{0.309481293f, 0.18888624f},
-std::array<float,2>{0.241908848f, 0.64795357f},
-std::array<float,2>{0.996883333f, 0.30628708f},
-std::array<float,2>{0.775105894f, 0.594770372f},
-std::array<float,2>{0.118591405f, 0.462882936f},
-std::array<float,2>{0.470384002f, 0.767517447f},
-std::array<float,2>{0.574594319f, 0.0883166194f},
-std::array<float,2>{0.511918962f, 0.7251724f},
-std::array<float,2>{0.414255947f, 0.33631748f},
-std::array<float,2>{0.0211144816f, 0.940259993f},
-std::array<float,2>{0.820572317f, 0.181522235f},
-std::array<float,2>{0.934969246f, 0.858435154f},
-std::array<float,2>{0.164050743f, 0.0444012173f},
-std::array<float,2>{0.358202666f, 0.555235147f},
-std::array<float,2>{0.713395834f, 0.392431021f},
-std::array<float,2>{0.615228117f, 0.795743227f},
-std::array<float,2>{0.459555686f, 0.0938231945f},
-std::array<float,2>{0.0893287063f, 0.572570026f},
-std::array<float,2>{0.804295123f, 0.484294951f},
-std::array<float,2>{0.957278848f, 0.657422006f},
-std::array<float,2>{0.207692459f, 0.27886039f},
-std::array<float,2>{0.278465092f, 0.877986789f},
-std::array<float,2>{0.655496776f, 0.232417285f},
-std::array<float,2>{0.746134162f, 0.521405816f},
-std::array<float,2>{0.317746133f, 0.42709744f},
-std::array<float,2>{0.134328574f, 0.843319654f},
-std::array<float,2>{0.878007233f, 0.0310272537f},
-std::array<float,2>{0.848210037f, 0.995915651f},
-std::array<float,2>{0.0534456596f, 0.138037309f},
-std::array<float,2>{0.380379826f, 0.71442765f},
-std::array<float,2>{0.547703326f, 0.356713712f},
-std::array<float,2>{0.535307586f, 0.967248142f},
-std::array<float,2>{0.392491668f, 0.165427491f},
-std::array<float,2>{0.0440176241f, 0.735351741f},
-std::array<float,2>{0.871428192f, 0.321828127f},
-std::array<float,2>{0.894420624f, 0.546563745f},
-std::array<float,2>{0.146588251f, 0.380433679f},
-std::array<float,2>{0.335801274f, 0.863931715f},
-std::array<float,2>{0.729418635f, 0.0471848473f},
-std::array<float,2>{0.63934058f, 0.627207041f},
-std::array<float,2>{0.26142934f, 0.287757903f},
-std::array<float,2>{0.190989599f, 0.92217344f},
-std::array<float,2>{0.940404952f, 0.208424032f},
-std::array<float,2>{0.783444345f, 0.762983203f},
-std::array<float,2>{0.0704114586f, 0.0772825405f},
-std::array<float,2>{0.44393447f, 0.618142188f},
-std::array<float,2>{0.593937457f, 0.437661797f},
-std::array<float,2>{0.70256716f, 0.812797368f},
-std::array<float,2>{0.359577477f, 0.00980342831f},
-std::array<float,2>{0.182165354f, 0.50830245f},
-std::array<float,2>{0.907956004f, 0.421459615f},
-std::array<float,2>{0.839612067f, 0.688710868f},
-std::array<float,2>{0.00654775603f, 0.370749265f},
-std::array<float,2>{0.435745031f, 0.982652247f},
-std::array<float,2>{0.519955456f, 0.145327121f},
-std::array<float,2>{0.59059155f, 0.581133008f},
-std::array<float,2>{0.491115391f, 0.490178168f},
-std::array<float,2>{0.104723983f, 0.797896504f},
-std::array<float,2>{0.760490477f, 0.118778005f},
-std::array<float,2>{0.970704257f, 0.899576783f},
-std::array<float,2>{0.229922876f, 0.243309394f},
-std::array<float,2>{0.296845019f, 0.685897887f},
-std::array<float,2>{0.680208683f, 0.263120055f},
-std::array<float,2>{0.67849499f, 0.998889744f},
-std::array<float,2>{0.28459844f, 0.136371031f},
-std::array<float,2>{0.22337079f, 0.718224645f},
-std::array<float,2>{0.980261385f, 0.354759544f},
-std::array<float,2>{0.751762211f, 0.519366682f},
-std::array<float,2>{0.0939599723f, 0.422131538f},
-std::array<float,2>{0.498212934f, 0.836086929f},
-std::array<float,2>{0.585018277f, 0.0270178672f},
-std::array<float,2>{0.526686847f, 0.660625756f},
-std::array<float,2>{0.427659422f, 0.276641786f},
-std::array<float,2>{0.00994724687f, 0.88147521f},
-std::array<float,2>{0.834409356f, 0.227308542f},
-std::array<float,2>{0.917969227f, 0.792815208f},
-std::array<float,2>{0.17786479f, 0.0996835604f},
-std::array<float,2>{0.373245001f, 0.577870071f},
-std::array<float,2>{0.693929791f, 0.47985974f},
-std::array<float,2>{0.604000747f, 0.854242206f},
-std::array<float,2>{0.448320776f, 0.0419948585f},
-std::array<float,2>{0.0701948255f, 0.56249398f},
-std::array<float,2>{0.796784878f, 0.397931963f},
-std::array<float,2>{0.952933431f, 0.721222758f},
-std::array<float,2>{0.197556108f, 0.34075132f},
-std::array<float,2>{0.25545007f, 0.94469142f},
-std::array<float,2>{0.631181955f, 0.184423253f},
-std::array<float,2>{0.723639369f, 0.600720167f},
-std::array<float,2>{0.338375956f, 0.465968341f},
-std::array<float,2>{0.153448835f, 0.77120024f},
-std::array<float,2>{0.905675471f, 0.0922666788f},
-std::array<float,2>{0.866205275f, 0.909699023f},
-std::array<float,2>{0.0368946381f, 0.19244419f},
-std::array<float,2>{0.404916227f, 0.641566932f},
-std::array<float,2>{0.539578915f, 0.312223852f},
-std::array<float,2>{0.556715786f, 0.904444337f},
-std::array<float,2>{0.388991117f, 0.249559045f},
-std::array<float,2>{0.059755303f, 0.683424115f},
-std::array<float,2>{0.856426775f, 0.260130405f},
-std::array<float,2>{0.883609831f, 0.5825001f},
-std::array<float,2>{0.126542568f, 0.487322986f},
-std::array<float,2>{0.320940852f, 0.803411961f},
-std::array<float,2>{0.739152968f, 0.121736363f},
-std::array<float,2>{0.644419491f, 0.692761123f},
-std::array<float,2>{0.272974044f, 0.373633623f},
-std::array<float,2>{0.215406016f, 0.979309618f},
-std::array<float,2>{0.965510726f, 0.141786709f},
-std::array<float,2>{0.805775464f, 0.818237185f},
-std::array<float,2>{0.0785640255f, 0.0132224737f},
-std::array<float,2>{0.464841306f, 0.513152242f},
-std::array<float,2>{0.619216323f, 0.416523904f},
-std::array<float,2>{0.708482981f, 0.75825274f},
-std::array<float,2>{0.348199815f, 0.0738577619f},
-std::array<float,2>{0.165983334f, 0.624636471f},
-std::array<float,2>{0.922726274f, 0.442213863f},
-std::array<float,2>{0.816850543f, 0.630913079f},
-std::array<float,2>{0.0278131478f, 0.282140911f},
-std::array<float,2>{0.408496857f, 0.927912831f},
-std::array<float,2>{0.500697911f, 0.205251887f},
-std::array<float,2>{0.570213258f, 0.54096967f},
-std::array<float,2>{0.477680176f, 0.375277072f},
-std::array<float,2>{0.112403788f, 0.860061288f},
-std::array<float,2>{0.771381378f, 0.0527849495f},
-std::array<float,2>{0.984714985f, 0.962321401f},
-std::array<float,2>{0.24769786f, 0.169591665f},
-std::array<float,2>{0.297993094f, 0.738425314f},
-std::array<float,2>{0.663106501f, 0.325957865f},
-std::array<float,2>{0.745781958f, 0.93620491f},
-std::array<float,2>{0.315514863f, 0.211514845f},
-std::array<float,2>{0.137579843f, 0.638946295f},
-std::array<float,2>{0.87914896f, 0.291084647f},
-std::array<float,2>{0.845005572f, 0.614634871f},
-std::array<float,2>{0.0484025963f, 0.449066192f},
-std::array<float,2>{0.37827003f, 0.75492239f},
-std::array<float,2>{0.553383708f, 0.064993754f},
-std::array<float,2>{0.609592855f, 0.744957507f},
-std::array<float,2>{0.455842406f, 0.317765594f},
-std::array<float,2>{0.0921749696f, 0.956955791f},
-std::array<float,2>{0.799486279f, 0.157628924f},
-std::array<float,2>{0.954501331f, 0.872871757f},
-std::array<float,2>{0.204991847f, 0.0594074205f},
-std::array<float,2>{0.274178535f, 0.53330332f},
-std::array<float,2>{0.649508595f, 0.386435658f},
-std::array<float,2>{0.509348214f, 0.808346808f},
-std::array<float,2>{0.421264887f, 0.114995398f},
-std::array<float,2>{0.0160439406f, 0.590529323f},
-std::array<float,2>{0.824736178f, 0.498525381f},
-std::array<float,2>{0.930578351f, 0.673928678f},
-std::array<float,2>{0.15938969f, 0.256115317f},
-std::array<float,2>{0.352872521f, 0.898252964f},
-std::array<float,2>{0.71614182f, 0.241078496f},
-std::array<float,2>{0.671870291f, 0.502737641f},
-std::array<float,2>{0.308469713f, 0.40844214f},
-std::array<float,2>{0.235089853f, 0.82661581f},
-std::array<float,2>{0.995807648f, 0.00509302877f},
-std::array<float,2>{0.780309677f, 0.968926132f},
-std::array<float,2>{0.121531077f, 0.15403226f},
-std::array<float,2>{0.473532617f, 0.702748537f},
-std::array<float,2>{0.572614789f, 0.360673547f},
-std::array<float,2>{0.586956263f, 0.946314871f},
-std::array<float,2>{0.488239676f, 0.175308913f},
-std::array<float,2>{0.106121913f, 0.727967501f},
-std::array<float,2>{0.762015879f, 0.330628663f},
-std::array<float,2>{0.975733221f, 0.550225019f},
-std::array<float,2>{0.232927009f, 0.403257608f},
-std::array<float,2>{0.292281598f, 0.845422566f},
-std::array<float,2>{0.6868397f, 0.0334887207f},
-std::array<float,2>{0.697018623f, 0.654700518f},
-std::array<float,2>{0.364918709f, 0.300240755f},
-std::array<float,2>{0.187351197f, 0.918447018f},
-std::array<float,2>{0.911472976f, 0.199235007f},
-std::array<float,2>{0.843056917f, 0.775631011f},
-std::array<float,2>{0.000596878701f, 0.0831824094f},
-std::array<float,2>{0.431796074f, 0.607745171f},
-std::array<float,2>{0.517279387f, 0.459085405f},
-std::array<float,2>{0.636005521f, 0.828373492f},
-std::array<float,2>{0.265385896f, 0.0197736081f},
-std::array<float,2>{0.194822073f, 0.527208388f},
-std::array<float,2>{0.945268095f, 0.434985638f},
-std::array<float,2>{0.786684573f, 0.708024323f},
-std::array<float,2>{0.0764206052f, 0.348278493f},
-std::array<float,2>{0.438263327f, 0.991673827f},
-std::array<float,2>{0.598822773f, 0.132238716f},
-std::array<float,2>{0.534980595f, 0.563254237f},
-std::array<float,2>{0.395241141f, 0.470991075f},
-std::array<float,2>{0.0414355993f, 0.787794173f},
-std::array<float,2>{0.870768845f, 0.105783604f},
-std::array<float,2>{0.895536959f, 0.889978528f},
-std::array<float,2>{0.141164869f, 0.220197156f},
-std::array<float,2>{0.329416454f, 0.664503396f},
-std::array<float,2>{0.734229088f, 0.269150764f},
-std::array<float,2>{0.68761003f, 0.957395375f},
-std::array<float,2>{0.368480086f, 0.160517588f},
-std::array<float,2>{0.175214559f, 0.749153852f},
-std::array<float,2>{0.916510105f, 0.315974236f},
-std::array<float,2>{0.830387652f, 0.53625226f},
-std::array<float,2>{0.012727743f, 0.3899661f},
-std::array<float,2>{0.423253596f, 0.870780647f},
-std::array<float,2>{0.527996182f, 0.0579792857f},
-std::array<float,2>{0.581737399f, 0.633789062f},
-std::array<float,2>{0.493428022f, 0.293274701f},
-std::array<float,2>{0.0994704738f, 0.930066168f},
-std::array<float,2>{0.754546165f, 0.21705164f},
-std::array<float,2>{0.984048545f, 0.750118256f},
-std::array<float,2>{0.220930949f, 0.0692185313f},
-std::array<float,2>{0.285499722f, 0.609611213f},
-std::array<float,2>{0.672699451f, 0.449477255f},
-std::array<float,2>{0.545337439f, 0.821604192f},
-std::array<float,2>{0.401689023f, 0.00145702844f},
-std::array<float,2>{0.0327347554f, 0.507481456f},
-std::array<float,2>{0.861871839f, 0.413034171f},
-std::array<float,2>{0.901303053f, 0.696499467f},
-std::array<float,2>{0.15082027f, 0.364488512f},
-std::array<float,2>{0.341519922f, 0.976369023f},
-std::array<float,2>{0.71943754f, 0.149258509f},
-std::array<float,2>{0.628867567f, 0.589595258f},
-std::array<float,2>{0.253441662f, 0.495962709f},
-std::array<float,2>{0.200634256f, 0.811799765f},
-std::array<float,2>{0.947377503f, 0.110855781f},
-std::array<float,2>{0.791287303f, 0.890779972f},
-std::array<float,2>{0.0658179224f, 0.234914199f},
-std::array<float,2>{0.450850189f, 0.677719891f},
-std::array<float,2>{0.609216571f, 0.250051737f},
-std::array<float,2>{0.623166978f, 0.915902257f},
-std::array<float,2>{0.468236446f, 0.196084231f},
-std::array<float,2>{0.08430098f, 0.652228594f},
-std::array<float,2>{0.810064316f, 0.303886443f},
-std::array<float,2>{0.962628603f, 0.6031546f},
-std::array<float,2>{0.214172915f, 0.453137636f},
-std::array<float,2>{0.269309193f, 0.781237543f},
-std::array<float,2>{0.646071017f, 0.0811603442f},
-std::array<float,2>{0.735119343f, 0.732968748f},
-std::array<float,2>{0.32718724f, 0.335641563f},
-std::array<float,2>{0.131125301f, 0.952596426f},
-std::array<float,2>{0.889790654f, 0.17695494f},
-std::array<float,2>{0.852871954f, 0.848850608f},
-std::array<float,2>{0.0558174327f, 0.0374399237f},
-std::array<float,2>{0.383865982f, 0.551512897f},
-std::array<float,2>{0.559689224f, 0.401153535f},
-std::array<float,2>{0.656952381f, 0.78503114f},
-std::array<float,2>{0.301543325f, 0.102411538f},
-std::array<float,2>{0.244990051f, 0.569615066f},
-std::array<float,2>{0.990520358f, 0.475547791f},
-std::array<float,2>{0.766391039f, 0.668515563f},
-std::array<float,2>{0.11588642f, 0.272727489f},
-std::array<float,2>{0.483957022f, 0.886348248f},
-std::array<float,2>{0.565991104f, 0.224675357f},
-std::array<float,2>{0.507351339f, 0.529367208f},
-std::array<float,2>{0.412907302f, 0.430416167f},
-std::array<float,2>{0.0241894275f, 0.833170652f},
-std::array<float,2>{0.814023376f, 0.0160357859f},
-std::array<float,2>{0.929127038f, 0.987188518f},
-std::array<float,2>{0.168912932f, 0.127598032f},
-std::array<float,2>{0.346163273f, 0.705694616f},
-std::array<float,2>{0.703851044f, 0.344432354f},
-std::array<float,2>{0.654277444f, 0.876674175f},
-std::array<float,2>{0.281071782f, 0.23404637f},
-std::array<float,2>{0.210399225f, 0.659632266f},
-std::array<float,2>{0.96066612f, 0.279455096f},
-std::array<float,2>{0.802138925f, 0.570422173f},
-std::array<float,2>{0.0876881257f, 0.4823488f},
-std::array<float,2>{0.457909107f, 0.793600857f},
-std::array<float,2>{0.615510464f, 0.097498931f},
-std::array<float,2>{0.550035596f, 0.711438715f},
-std::array<float,2>{0.382086903f, 0.357979149f},
-std::array<float,2>{0.0512434766f, 0.993974805f},
-std::array<float,2>{0.851231217f, 0.140377298f},
-std::array<float,2>{0.87593329f, 0.840132296f},
-std::array<float,2>{0.135405257f, 0.0283418614f},
-std::array<float,2>{0.318791926f, 0.523117781f},
-std::array<float,2>{0.748916984f, 0.428237855f},
-std::array<float,2>{0.578060985f, 0.768024206f},
-std::array<float,2>{0.471180737f, 0.086204268f},
-std::array<float,2>{0.119206846f, 0.596787214f},
-std::array<float,2>{0.776942551f, 0.464245647f},
-std::array<float,2>{0.998547435f, 0.645164192f},
-std::array<float,2>{0.238552302f, 0.307946324f},
-std::array<float,2>{0.312178731f, 0.913759768f},
-std::array<float,2>{0.66667372f, 0.191245407f},
-std::array<float,2>{0.710971892f, 0.557342112f},
-std::array<float,2>{0.357389212f, 0.393240929f},
-std::array<float,2>{0.161117017f, 0.85702008f},
-std::array<float,2>{0.937214255f, 0.0450377055f},
-std::array<float,2>{0.823638797f, 0.938944042f},
-std::array<float,2>{0.0229901392f, 0.182014525f},
-std::array<float,2>{0.416713327f, 0.722849369f},
-std::array<float,2>{0.515497327f, 0.339339584f},
-std::array<float,2>{0.522917271f, 0.981550097f},
-std::array<float,2>{0.43389675f, 0.14762643f},
-std::array<float,2>{0.00394795695f, 0.690288723f},
-std::array<float,2>{0.837403953f, 0.367549062f},
-std::array<float,2>{0.908962309f, 0.510699093f},
-std::array<float,2>{0.180111691f, 0.419140995f},
-std::array<float,2>{0.363034636f, 0.8156479f},
-std::array<float,2>{0.699375749f, 0.00875806436f},
-std::array<float,2>{0.683269203f, 0.68410486f},
-std::array<float,2>{0.293898612f, 0.265602708f},
-std::array<float,2>{0.227171317f, 0.9010185f},
-std::array<float,2>{0.970516443f, 0.244673967f},
-std::array<float,2>{0.758151531f, 0.799862623f},
-std::array<float,2>{0.102792002f, 0.119733825f},
-std::array<float,2>{0.489234656f, 0.579990625f},
-std::array<float,2>{0.593399823f, 0.491524667f},
-std::array<float,2>{0.726994991f, 0.865765035f},
-std::array<float,2>{0.332551301f, 0.0501676612f},
-std::array<float,2>{0.145122737f, 0.543638766f},
-std::array<float,2>{0.891006112f, 0.381349951f},
-std::array<float,2>{0.873582721f, 0.736690581f},
-std::array<float,2>{0.0451205447f, 0.322566241f},
-std::array<float,2>{0.39307934f, 0.965732276f},
-std::array<float,2>{0.537935674f, 0.167125434f},
-std::array<float,2>{0.596819282f, 0.619888663f},
-std::array<float,2>{0.442765772f, 0.441141784f},
-std::array<float,2>{0.073786445f, 0.765282035f},
-std::array<float,2>{0.782999575f, 0.0749142766f},
-std::array<float,2>{0.938825369f, 0.925548851f},
-std::array<float,2>{0.189147368f, 0.209554479f},
-std::array<float,2>{0.25956586f, 0.625733256f},
-std::array<float,2>{0.637749374f, 0.286968023f},
-std::array<float,2>{0.642442286f, 0.979543924f},
-std::array<float,2>{0.270540982f, 0.140927255f},
-std::array<float,2>{0.218304828f, 0.691720247f},
-std::array<float,2>{0.96749711f, 0.374710947f},
-std::array<float,2>{0.807018161f, 0.512523115f},
-std::array<float,2>{0.0818079114f, 0.417269588f},
-std::array<float,2>{0.462448329f, 0.816988111f},
-std::array<float,2>{0.61910677f, 0.012124558f},
-std::array<float,2>{0.554943383f, 0.681991935f},
-std::array<float,2>{0.388194978f, 0.260794014f},
-std::array<float,2>{0.0624014512f, 0.905365169f},
-std::array<float,2>{0.8593027f, 0.248614833f},
-std::array<float,2>{0.885573447f, 0.804440498f},
-std::array<float,2>{0.127390549f, 0.122263312f},
-std::array<float,2>{0.323433965f, 0.583411872f},
-std::array<float,2>{0.741856933f, 0.486598819f},
-std::array<float,2>{0.566980243f, 0.860821247f},
-std::array<float,2>{0.478849173f, 0.054093603f},
-std::array<float,2>{0.109446481f, 0.539516449f},
-std::array<float,2>{0.771620691f, 0.376636028f},
-std::array<float,2>{0.98775202f, 0.739848375f},
-std::array<float,2>{0.24905248f, 0.325127095f},
-std::array<float,2>{0.300592482f, 0.96118319f},
-std::array<float,2>{0.660369456f, 0.168865368f},
-std::array<float,2>{0.709435165f, 0.623122036f},
-std::array<float,2>{0.35005933f, 0.442466617f},
-std::array<float,2>{0.16612041f, 0.759334922f},
-std::array<float,2>{0.925342381f, 0.0725218281f},
-std::array<float,2>{0.819801748f, 0.92887485f},
-std::array<float,2>{0.0301785972f, 0.206965223f},
-std::array<float,2>{0.406375229f, 0.632392526f},
-std::array<float,2>{0.502466917f, 0.28225264f},
-std::array<float,2>{0.524897277f, 0.882490516f},
-std::array<float,2>{0.428518564f, 0.227756426f},
-std::array<float,2>{0.00852778926f, 0.661552608f},
-std::array<float,2>{0.833568811f, 0.275640309f},
-std::array<float,2>{0.920355797f, 0.57621026f},
-std::array<float,2>{0.17754291f, 0.479233831f},
-std::array<float,2>{0.371680468f, 0.791466355f},
-std::array<float,2>{0.692093074f, 0.100835994f},
-std::array<float,2>{0.676858425f, 0.716861904f},
-std::array<float,2>{0.282441348f, 0.354424506f},
-std::array<float,2>{0.226044104f, 0.999078155f},
-std::array<float,2>{0.977342188f, 0.134765789f},
-std::array<float,2>{0.752618074f, 0.837683558f},
-std::array<float,2>{0.0973777547f, 0.0257565975f},
-std::array<float,2>{0.497090667f, 0.518193841f},
-std::array<float,2>{0.583785832f, 0.422880948f},
-std::array<float,2>{0.726241231f, 0.769863486f},
-std::array<float,2>{0.337630302f, 0.0933198705f},
-std::array<float,2>{0.156138465f, 0.599902272f},
-std::array<float,2>{0.903182566f, 0.465186477f},
-std::array<float,2>{0.864544153f, 0.642409623f},
-std::array<float,2>{0.0378170162f, 0.311513245f},
-std::array<float,2>{0.40264383f, 0.908780217f},
-std::array<float,2>{0.542506754f, 0.191683918f},
-std::array<float,2>{0.602364898f, 0.56104815f},
-std::array<float,2>{0.446114242f, 0.396559089f},
-std::array<float,2>{0.0669253543f, 0.855201721f},
-std::array<float,2>{0.79403466f, 0.0418613479f},
-std::array<float,2>{0.951074302f, 0.943715155f},
-std::array<float,2>{0.19602932f, 0.185465276f},
-std::array<float,2>{0.256150991f, 0.722003937f},
-std::array<float,2>{0.630277216f, 0.341620952f},
-std::array<float,2>{0.698451221f, 0.919785738f},
-std::array<float,2>{0.366021574f, 0.201035053f},
-std::array<float,2>{0.184712648f, 0.656173825f},
-std::array<float,2>{0.912906408f, 0.299309164f},
-std::array<float,2>{0.840725482f, 0.608571172f},
-std::array<float,2>{0.00349524268f, 0.460718691f},
-std::array<float,2>{0.431366354f, 0.776905596f},
-std::array<float,2>{0.519281566f, 0.0826955959f},
-std::array<float,2>{0.588249445f, 0.726638973f},
-std::array<float,2>{0.48610419f, 0.331675082f},
-std::array<float,2>{0.109077357f, 0.946099579f},
-std::array<float,2>{0.765123785f, 0.174277797f},
-std::array<float,2>{0.97323817f, 0.844602764f},
-std::array<float,2>{0.231561035f, 0.0351392701f},
-std::array<float,2>{0.289799124f, 0.549463868f},
-std::array<float,2>{0.684357345f, 0.404205203f},
-std::array<float,2>{0.532575428f, 0.788234532f},
-std::array<float,2>{0.397415012f, 0.106856674f},
-std::array<float,2>{0.0409251302f, 0.564286292f},
-std::array<float,2>{0.868332863f, 0.472083449f},
-std::array<float,2>{0.89834106f, 0.665867448f},
-std::array<float,2>{0.144248843f, 0.267700166f},
-std::array<float,2>{0.331269115f, 0.888769209f},
-std::array<float,2>{0.731589079f, 0.219346046f},
-std::array<float,2>{0.634200633f, 0.525519252f},
-std::array<float,2>{0.262408435f, 0.434001178f},
-std::array<float,2>{0.192425102f, 0.829941034f},
-std::array<float,2>{0.942323029f, 0.0210627224f},
-std::array<float,2>{0.788612962f, 0.990798116f},
-std::array<float,2>{0.0760483965f, 0.131575689f},
-std::array<float,2>{0.44013983f, 0.707452297f},
-std::array<float,2>{0.600959003f, 0.348721027f},
-std::array<float,2>{0.611359656f, 0.955283284f},
-std::array<float,2>{0.45431f, 0.156803176f},
-std::array<float,2>{0.0899055451f, 0.746007502f},
-std::array<float,2>{0.798205554f, 0.317344129f},
-std::array<float,2>{0.956372142f, 0.534464478f},
-std::array<float,2>{0.205335706f, 0.384952396f},
-std::array<float,2>{0.275709093f, 0.871488154f},
-std::array<float,2>{0.651441276f, 0.0596009865f},
-std::array<float,2>{0.743991673f, 0.640341759f},
-std::array<float,2>{0.313789874f, 0.292354912f},
-std::array<float,2>{0.13974306f, 0.936817884f},
-std::array<float,2>{0.882355869f, 0.212402284f},
-std::array<float,2>{0.845997214f, 0.754086077f},
-std::array<float,2>{0.0492987335f, 0.065677017f},
-std::array<float,2>{0.376565784f, 0.613376737f},
-std::array<float,2>{0.552399933f, 0.447854817f},
-std::array<float,2>{0.668873608f, 0.828057349f},
-std::array<float,2>{0.306289792f, 0.00485723699f},
-std::array<float,2>{0.23735033f, 0.503424346f},
-std::array<float,2>{0.992477655f, 0.409218818f},
-std::array<float,2>{0.777370453f, 0.701943636f},
-std::array<float,2>{0.124197692f, 0.35980919f},
-std::array<float,2>{0.475379437f, 0.969863534f},
-std::array<float,2>{0.571172178f, 0.152633905f},
-std::array<float,2>{0.511223078f, 0.591223776f},
-std::array<float,2>{0.419900566f, 0.499566138f},
-std::array<float,2>{0.0191401783f, 0.807460666f},
-std::array<float,2>{0.827822149f, 0.113412887f},
-std::array<float,2>{0.932583213f, 0.896720052f},
-std::array<float,2>{0.156321704f, 0.241920948f},
-std::array<float,2>{0.353891343f, 0.675190389f},
-std::array<float,2>{0.718014717f, 0.257722288f},
-std::array<float,2>{0.736965477f, 0.95157367f},
-std::array<float,2>{0.326161265f, 0.176506117f},
-std::array<float,2>{0.129725054f, 0.734036505f},
-std::array<float,2>{0.888567984f, 0.334544122f},
-std::array<float,2>{0.854202032f, 0.552733123f},
-std::array<float,2>{0.0576212369f, 0.402163267f},
-std::array<float,2>{0.386156291f, 0.847699583f},
-std::array<float,2>{0.56197226f, 0.0383223966f},
-std::array<float,2>{0.621209979f, 0.651088059f},
-std::array<float,2>{0.464908093f, 0.303186595f},
-std::array<float,2>{0.0828558728f, 0.914889216f},
-std::array<float,2>{0.811866343f, 0.196328953f},
-std::array<float,2>{0.964243174f, 0.779847801f},
-std::array<float,2>{0.212067336f, 0.0809577256f},
-std::array<float,2>{0.26713863f, 0.601811171f},
-std::array<float,2>{0.647281945f, 0.455049962f},
-std::array<float,2>{0.505253613f, 0.832549572f},
-std::array<float,2>{0.411294222f, 0.0175153464f},
-std::array<float,2>{0.0263742525f, 0.530560195f},
-std::array<float,2>{0.815283954f, 0.431344986f},
-std::array<float,2>{0.927733362f, 0.706628323f},
-std::array<float,2>{0.170293391f, 0.34556669f},
-std::array<float,2>{0.34403187f, 0.987404883f},
-std::array<float,2>{0.706176877f, 0.128105164f},
-std::array<float,2>{0.658518672f, 0.569172323f},
-std::array<float,2>{0.3040995f, 0.476428509f},
-std::array<float,2>{0.242713094f, 0.783234477f},
-std::array<float,2>{0.989997923f, 0.102656007f},
-std::array<float,2>{0.768516183f, 0.88487345f},
-std::array<float,2>{0.113709502f, 0.226280287f},
-std::array<float,2>{0.481349349f, 0.669336259f},
-std::array<float,2>{0.563882828f, 0.272244006f},
-std::array<float,2>{0.578904748f, 0.930740356f},
-std::array<float,2>{0.494336128f, 0.218544543f},
-std::array<float,2>{0.100350343f, 0.633602798f},
-std::array<float,2>{0.757345855f, 0.294532716f},
-std::array<float,2>{0.981163681f, 0.610408068f},
-std::array<float,2>{0.219553232f, 0.450304925f},
-std::array<float,2>{0.288559765f, 0.751115799f},
-std::array<float,2>{0.675093949f, 0.0693640634f},
-std::array<float,2>{0.690057993f, 0.748448431f},
-std::array<float,2>{0.36957258f, 0.314859807f},
-std::array<float,2>{0.173500702f, 0.958867311f},
-std::array<float,2>{0.914261103f, 0.161405757f},
-std::array<float,2>{0.829151154f, 0.869357169f},
-std::array<float,2>{0.0150708025f, 0.0566529818f},
-std::array<float,2>{0.424217194f, 0.53523314f},
-std::array<float,2>{0.529482186f, 0.388730168f},
-std::array<float,2>{0.62631917f, 0.811487198f},
-std::array<float,2>{0.251050264f, 0.109874152f},
-std::array<float,2>{0.202860743f, 0.588418543f},
-std::array<float,2>{0.946848392f, 0.494710356f},
-std::array<float,2>{0.790571511f, 0.676096976f},
-std::array<float,2>{0.0632631928f, 0.251143932f},
-std::array<float,2>{0.452023208f, 0.892112732f},
-std::array<float,2>{0.606404364f, 0.235846564f},
-std::array<float,2>{0.543367207f, 0.506279588f},
-std::array<float,2>{0.39846462f, 0.413985282f},
-std::array<float,2>{0.0334312432f, 0.82033217f},
-std::array<float,2>{0.859545648f, 0.000169592968f},
-std::array<float,2>{0.899920762f, 0.975282729f},
-std::array<float,2>{0.148545131f, 0.150144607f},
-std::array<float,2>{0.342469215f, 0.695920348f},
-std::array<float,2>{0.722470343f, 0.364158571f},
-std::array<float,2>{0.680773199f, 0.902317107f},
-std::array<float,2>{0.295549631f, 0.245248482f},
-std::array<float,2>{0.22856614f, 0.684761524f},
-std::array<float,2>{0.971783519f, 0.264380246f},
-std::array<float,2>{0.761681914f, 0.578207254f},
-std::array<float,2>{0.103592612f, 0.490647793f},
-std::array<float,2>{0.491268605f, 0.799389005f},
-std::array<float,2>{0.591385305f, 0.120742857f},
-std::array<float,2>{0.520978332f, 0.691238821f},
-std::array<float,2>{0.436872303f, 0.368738621f},
-std::array<float,2>{0.00710828789f, 0.98065418f},
-std::array<float,2>{0.838769376f, 0.146682411f},
-std::array<float,2>{0.907078445f, 0.814953625f},
-std::array<float,2>{0.182970822f, 0.00886914413f},
-std::array<float,2>{0.361055642f, 0.511655033f},
-std::array<float,2>{0.702095628f, 0.418221444f},
-std::array<float,2>{0.594994724f, 0.764550447f},
-std::array<float,2>{0.445240706f, 0.0754468068f},
-std::array<float,2>{0.0714237839f, 0.62051034f},
-std::array<float,2>{0.785000682f, 0.439491212f},
-std::array<float,2>{0.940738082f, 0.62609446f},
-std::array<float,2>{0.190043136f, 0.285984069f},
-std::array<float,2>{0.260706425f, 0.923950851f},
-std::array<float,2>{0.640376985f, 0.210781485f},
-std::array<float,2>{0.729650259f, 0.544748425f},
-std::array<float,2>{0.334223539f, 0.38245374f},
-std::array<float,2>{0.147958294f, 0.866518319f},
-std::array<float,2>{0.893391132f, 0.0490525588f},
-std::array<float,2>{0.872165918f, 0.966303706f},
-std::array<float,2>{0.0435713343f, 0.166054368f},
-std::array<float,2>{0.391569734f, 0.738253713f},
-std::array<float,2>{0.536469042f, 0.32391274f},
-std::array<float,2>{0.547874093f, 0.992804468f},
-std::array<float,2>{0.379107445f, 0.139644355f},
-std::array<float,2>{0.0542699359f, 0.712865531f},
-std::array<float,2>{0.848709524f, 0.358831435f},
-std::array<float,2>{0.877884805f, 0.521588683f},
-std::array<float,2>{0.133146644f, 0.429683149f},
-std::array<float,2>{0.316569984f, 0.841520667f},
-std::array<float,2>{0.747109592f, 0.0274207257f},
-std::array<float,2>{0.654583335f, 0.658466876f},
-std::array<float,2>{0.277709812f, 0.281180859f},
-std::array<float,2>{0.208799854f, 0.875336111f},
-std::array<float,2>{0.958415151f, 0.232829362f},
-std::array<float,2>{0.803256392f, 0.794787228f},
-std::array<float,2>{0.0887876824f, 0.095919393f},
-std::array<float,2>{0.460035503f, 0.572106719f},
-std::array<float,2>{0.613296807f, 0.481381297f},
-std::array<float,2>{0.714512825f, 0.856063366f},
-std::array<float,2>{0.359298497f, 0.0464714728f},
-std::array<float,2>{0.163064569f, 0.557931244f},
-std::array<float,2>{0.93455708f, 0.393556148f},
-std::array<float,2>{0.821433842f, 0.724161029f},
-std::array<float,2>{0.0197496247f, 0.33847025f},
-std::array<float,2>{0.415381521f, 0.937731087f},
-std::array<float,2>{0.513535142f, 0.183101326f},
-std::array<float,2>{0.57607621f, 0.596529543f},
-std::array<float,2>{0.469225109f, 0.463292837f},
-std::array<float,2>{0.117577389f, 0.768594503f},
-std::array<float,2>{0.773868859f, 0.087497063f},
-std::array<float,2>{0.997784853f, 0.91293174f},
-std::array<float,2>{0.240509793f, 0.190388396f},
-std::array<float,2>{0.310545444f, 0.64586556f},
-std::array<float,2>{0.665527999f, 0.306658447f},
-std::array<float,2>{0.662164807f, 0.963513434f},
-std::array<float,2>{0.297382832f, 0.171667278f},
-std::array<float,2>{0.246963963f, 0.741492867f},
-std::array<float,2>{0.986316323f, 0.328012228f},
-std::array<float,2>{0.769671619f, 0.541765749f},
-std::array<float,2>{0.111664921f, 0.378687918f},
-std::array<float,2>{0.477139533f, 0.863141775f},
-std::array<float,2>{0.569140315f, 0.0526836403f},
-std::array<float,2>{0.501193464f, 0.629821539f},
-std::array<float,2>{0.409336686f, 0.284229875f},
-std::array<float,2>{0.0289593134f, 0.926926613f},
-std::array<float,2>{0.818231702f, 0.20418261f},
-std::array<float,2>{0.923155725f, 0.759788156f},
-std::array<float,2>{0.164434284f, 0.0719544217f},
-std::array<float,2>{0.349118501f, 0.622802913f},
-std::array<float,2>{0.707536042f, 0.443820864f},
-std::array<float,2>{0.621015906f, 0.818417013f},
-std::array<float,2>{0.463021606f, 0.0156064145f},
-std::array<float,2>{0.0797003955f, 0.514512479f},
-std::array<float,2>{0.805633903f, 0.414175689f},
-std::array<float,2>{0.96652633f, 0.695241332f},
-std::array<float,2>{0.215838805f, 0.372792631f},
-std::array<float,2>{0.272090197f, 0.978025496f},
-std::array<float,2>{0.642983794f, 0.144080624f},
-std::array<float,2>{0.739895344f, 0.585183918f},
-std::array<float,2>{0.321408033f, 0.485408515f},
-std::array<float,2>{0.125131309f, 0.80131793f},
-std::array<float,2>{0.883915722f, 0.124336042f},
-std::array<float,2>{0.85729593f, 0.903780758f},
-std::array<float,2>{0.0592445731f, 0.246198297f},
-std::array<float,2>{0.389742196f, 0.680406213f},
-std::array<float,2>{0.558578968f, 0.259391636f},
-std::array<float,2>{0.540551364f, 0.906658292f},
-std::array<float,2>{0.405353397f, 0.194069788f},
-std::array<float,2>{0.0355057344f, 0.642860949f},
-std::array<float,2>{0.866872847f, 0.310374975f},
-std::array<float,2>{0.905087411f, 0.597971559f},
-std::array<float,2>{0.152824879f, 0.467717946f},
-std::array<float,2>{0.339786291f, 0.773135424f},
-std::array<float,2>{0.722826302f, 0.0900801048f},
-std::array<float,2>{0.632582247f, 0.718866885f},
-std::array<float,2>{0.254193276f, 0.343419492f},
-std::array<float,2>{0.198702514f, 0.943117082f},
-std::array<float,2>{0.951701105f, 0.186714336f},
-std::array<float,2>{0.794953167f, 0.852335691f},
-std::array<float,2>{0.0685370192f, 0.0407376215f},
-std::array<float,2>{0.447536886f, 0.560332954f},
-std::array<float,2>{0.605258763f, 0.39455986f},
-std::array<float,2>{0.694698632f, 0.790131509f},
-std::array<float,2>{0.37458396f, 0.0982378721f},
-std::array<float,2>{0.178747237f, 0.575323462f},
-std::array<float,2>{0.919781387f, 0.476995945f},
-std::array<float,2>{0.835329175f, 0.662305892f},
-std::array<float,2>{0.0112238955f, 0.274820566f},
-std::array<float,2>{0.426086813f, 0.880230904f},
-std::array<float,2>{0.52601862f, 0.230224714f},
-std::array<float,2>{0.584260523f, 0.516390622f},
-std::array<float,2>{0.499423087f, 0.425276667f},
-std::array<float,2>{0.0953211784f, 0.838163376f},
-std::array<float,2>{0.75023967f, 0.0250207745f},
-std::array<float,2>{0.979052365f, 0.997163534f},
-std::array<float,2>{0.224499479f, 0.134128675f},
-std::array<float,2>{0.284048587f, 0.715083539f},
-std::array<float,2>{0.678782403f, 0.353165418f},
-std::array<float,2>{0.733352482f, 0.88860172f},
-std::array<float,2>{0.328215778f, 0.2221044f},
-std::array<float,2>{0.142428532f, 0.667028248f},
-std::array<float,2>{0.894606173f, 0.265651703f},
-std::array<float,2>{0.869631827f, 0.566349566f},
-std::array<float,2>{0.0424462743f, 0.469195127f},
-std::array<float,2>{0.395749569f, 0.785706043f},
-std::array<float,2>{0.533537865f, 0.107429244f},
-std::array<float,2>{0.597982705f, 0.710043073f},
-std::array<float,2>{0.43887946f, 0.350151271f},
-std::array<float,2>{0.0771627352f, 0.989115f},
-std::array<float,2>{0.785933077f, 0.130472943f},
-std::array<float,2>{0.944288194f, 0.830249906f},
-std::array<float,2>{0.194277734f, 0.0231782403f},
-std::array<float,2>{0.263812065f, 0.525223196f},
-std::array<float,2>{0.635255635f, 0.435651332f},
-std::array<float,2>{0.515702963f, 0.775271595f},
-std::array<float,2>{0.4330796f, 0.0848440975f},
-std::array<float,2>{0.00192784693f, 0.606208742f},
-std::array<float,2>{0.842210829f, 0.458059281f},
-std::array<float,2>{0.911049426f, 0.654239953f},
-std::array<float,2>{0.185873955f, 0.298212022f},
-std::array<float,2>{0.363619059f, 0.920391619f},
-std::array<float,2>{0.695498347f, 0.201753512f},
-std::array<float,2>{0.685920537f, 0.547886133f},
-std::array<float,2>{0.291559219f, 0.405278593f},
-std::array<float,2>{0.233570024f, 0.847453177f},
-std::array<float,2>{0.975269139f, 0.0328697637f},
-std::array<float,2>{0.762905061f, 0.948331892f},
-std::array<float,2>{0.107118756f, 0.172535658f},
-std::array<float,2>{0.486542493f, 0.730460703f},
-std::array<float,2>{0.585963726f, 0.329165548f},
-std::array<float,2>{0.573247075f, 0.971640825f},
-std::array<float,2>{0.474021733f, 0.154553741f},
-std::array<float,2>{0.122341968f, 0.70078671f},
-std::array<float,2>{0.780049622f, 0.362511814f},
-std::array<float,2>{0.994603276f, 0.500528753f},
-std::array<float,2>{0.236111179f, 0.407820612f},
-std::array<float,2>{0.306906253f, 0.824531496f},
-std::array<float,2>{0.670182347f, 0.00725587597f},
-std::array<float,2>{0.715291262f, 0.673552334f},
-std::array<float,2>{0.35189262f, 0.255425453f},
-std::array<float,2>{0.158975333f, 0.896406651f},
-std::array<float,2>{0.931281388f, 0.240067378f},
-std::array<float,2>{0.825993478f, 0.806016803f},
-std::array<float,2>{0.0169452559f, 0.115741529f},
-std::array<float,2>{0.420152217f, 0.593744636f},
-std::array<float,2>{0.50856179f, 0.4962897f},
-std::array<float,2>{0.648785889f, 0.874941349f},
-std::array<float,2>{0.274742365f, 0.0605871826f},
-std::array<float,2>{0.203941762f, 0.532800913f},
-std::array<float,2>{0.953355968f, 0.383523494f},
-std::array<float,2>{0.800649285f, 0.742867112f},
-std::array<float,2>{0.0931216255f, 0.318629026f},
-std::array<float,2>{0.456127465f, 0.953996003f},
-std::array<float,2>{0.611017823f, 0.158616558f},
-std::array<float,2>{0.553782284f, 0.616882265f},
-std::array<float,2>{0.376992196f, 0.447179347f},
-std::array<float,2>{0.047376845f, 0.757249236f},
-std::array<float,2>{0.84402585f, 0.0629995391f},
-std::array<float,2>{0.879958272f, 0.935372174f},
-std::array<float,2>{0.138589904f, 0.214245439f},
-std::array<float,2>{0.314811647f, 0.637714267f},
-std::array<float,2>{0.744605422f, 0.289398104f},
-std::array<float,2>{0.704685152f, 0.985030055f},
-std::array<float,2>{0.346929938f, 0.126766354f},
-std::array<float,2>{0.169398487f, 0.704262555f},
-std::array<float,2>{0.927914798f, 0.346446633f},
-std::array<float,2>{0.812684655f, 0.528366268f},
-std::array<float,2>{0.0252322853f, 0.432638288f},
-std::array<float,2>{0.413150549f, 0.835919857f},
-std::array<float,2>{0.506074309f, 0.0178530663f},
-std::array<float,2>{0.564453959f, 0.670369804f},
-std::array<float,2>{0.482986152f, 0.271302193f},
-std::array<float,2>{0.116497964f, 0.883766532f},
-std::array<float,2>{0.767025471f, 0.22301805f},
-std::array<float,2>{0.991640449f, 0.782724261f},
-std::array<float,2>{0.245540634f, 0.104900837f},
-std::array<float,2>{0.302350372f, 0.566437781f},
-std::array<float,2>{0.658152819f, 0.474063784f},
-std::array<float,2>{0.559399784f, 0.85038048f},
-std::array<float,2>{0.383170485f, 0.0361591391f},
-std::array<float,2>{0.0550262816f, 0.553355396f},
-std::array<float,2>{0.851988614f, 0.398873329f},
-std::array<float,2>{0.889070094f, 0.73127681f},
-std::array<float,2>{0.132360637f, 0.333386093f},
-std::array<float,2>{0.326564074f, 0.950015366f},
-std::array<float,2>{0.735767484f, 0.178779468f},
-std::array<float,2>{0.644885421f, 0.605198562f},
-std::array<float,2>{0.267658979f, 0.455597758f},
-std::array<float,2>{0.213352039f, 0.777684093f},
-std::array<float,2>{0.961191654f, 0.0798140541f},
-std::array<float,2>{0.8093732f, 0.916383207f},
-std::array<float,2>{0.0850448906f, 0.198697522f},
-std::array<float,2>{0.467541605f, 0.649372816f},
-std::array<float,2>{0.624833882f, 0.302670062f},
-std::array<float,2>{0.608195186f, 0.892638862f},
-std::array<float,2>{0.449529588f, 0.236962199f},
-std::array<float,2>{0.0646885261f, 0.678401351f},
-std::array<float,2>{0.792063534f, 0.25270924f},
-std::array<float,2>{0.949002266f, 0.587390006f},
-std::array<float,2>{0.199650228f, 0.493647426f},
-std::array<float,2>{0.252380461f, 0.809483826f},
-std::array<float,2>{0.627541363f, 0.111488074f},
-std::array<float,2>{0.720149755f, 0.698978364f},
-std::array<float,2>{0.34066844f, 0.365621954f},
-std::array<float,2>{0.152328834f, 0.97411716f},
-std::array<float,2>{0.902137458f, 0.150441885f},
-std::array<float,2>{0.86262387f, 0.822534144f},
-std::array<float,2>{0.0317956954f, 0.00303755724f},
-std::array<float,2>{0.400803208f, 0.504992723f},
-std::array<float,2>{0.546184421f, 0.411480159f},
-std::array<float,2>{0.672890007f, 0.753096819f},
-std::array<float,2>{0.287101299f, 0.0675254241f},
-std::array<float,2>{0.221952274f, 0.612236917f},
-std::array<float,2>{0.983382821f, 0.451357335f},
-std::array<float,2>{0.755740643f, 0.635555029f},
-std::array<float,2>{0.0984880552f, 0.296474636f},
-std::array<float,2>{0.49238804f, 0.932161868f},
-std::array<float,2>{0.580244124f, 0.215444729f},
-std::array<float,2>{0.528771281f, 0.537804127f},
-std::array<float,2>{0.42260164f, 0.387291253f},
-std::array<float,2>{0.0121242637f, 0.868821204f},
-std::array<float,2>{0.831740916f, 0.0554794706f},
-std::array<float,2>{0.917356253f, 0.959572494f},
-std::array<float,2>{0.174200431f, 0.163401797f},
-std::array<float,2>{0.367435426f, 0.747715712f},
-std::array<float,2>{0.689327955f, 0.314082831f},
-std::array<float,2>{0.636811674f, 0.922896087f},
-std::array<float,2>{0.258265048f, 0.207507774f},
-std::array<float,2>{0.187983513f, 0.628773153f},
-std::array<float,2>{0.937679052f, 0.288606524f},
-std::array<float,2>{0.782050192f, 0.618532419f},
-std::array<float,2>{0.0727825835f, 0.438807607f},
-std::array<float,2>{0.441745609f, 0.761965454f},
-std::array<float,2>{0.596098363f, 0.0765762031f},
-std::array<float,2>{0.538117409f, 0.734484434f},
-std::array<float,2>{0.394075215f, 0.320577979f},
-std::array<float,2>{0.0461577699f, 0.967881024f},
-std::array<float,2>{0.874649942f, 0.164900616f},
-std::array<float,2>{0.892056346f, 0.864760101f},
-std::array<float,2>{0.145670161f, 0.0483421274f},
-std::array<float,2>{0.333836615f, 0.545156002f},
-std::array<float,2>{0.727600992f, 0.37909615f},
-std::array<float,2>{0.591802418f, 0.79710418f},
-std::array<float,2>{0.489305347f, 0.117254697f},
-std::array<float,2>{0.101749755f, 0.58030808f},
-std::array<float,2>{0.759082556f, 0.488979965f},
-std::array<float,2>{0.969626546f, 0.686879337f},
-std::array<float,2>{0.228045672f, 0.262332499f},
-std::array<float,2>{0.294913858f, 0.898448706f},
-std::array<float,2>{0.682299674f, 0.24240081f},
-std::array<float,2>{0.700583518f, 0.509210467f},
-std::array<float,2>{0.361895084f, 0.420048296f},
-std::array<float,2>{0.181157127f, 0.81358254f},
-std::array<float,2>{0.909481108f, 0.0110957492f},
-std::array<float,2>{0.836703658f, 0.983849585f},
-std::array<float,2>{0.00549907051f, 0.146409541f},
-std::array<float,2>{0.434954345f, 0.687741458f},
-std::array<float,2>{0.522410691f, 0.369528651f},
-std::array<float,2>{0.513776779f, 0.94060415f},
-std::array<float,2>{0.417107552f, 0.180355862f},
-std::array<float,2>{0.021847168f, 0.725805879f},
-std::array<float,2>{0.822525442f, 0.337601691f},
-std::array<float,2>{0.9355582f, 0.5556705f},
-std::array<float,2>{0.161534622f, 0.391405821f},
-std::array<float,2>{0.356158584f, 0.857436955f},
-std::array<float,2>{0.71284914f, 0.0436216891f},
-std::array<float,2>{0.667481601f, 0.646666169f},
-std::array<float,2>{0.31056875f, 0.304906815f},
-std::array<float,2>{0.239291027f, 0.911066175f},
-std::array<float,2>{0.999126494f, 0.18765004f},
-std::array<float,2>{0.775745153f, 0.766600966f},
-std::array<float,2>{0.120660469f, 0.0888781026f},
-std::array<float,2>{0.471728832f, 0.594592988f},
-std::array<float,2>{0.577132344f, 0.461273283f},
-std::array<float,2>{0.749396801f, 0.842438936f},
-std::array<float,2>{0.319407254f, 0.0295612533f},
-std::array<float,2>{0.135745734f, 0.519966304f},
-std::array<float,2>{0.876499176f, 0.425983578f},
-std::array<float,2>{0.850372016f, 0.713550329f},
-std::array<float,2>{0.0522505268f, 0.356396019f},
-std::array<float,2>{0.381244987f, 0.995060563f},
-std::array<float,2>{0.549250126f, 0.137654647f},
-std::array<float,2>{0.616630554f, 0.573553562f},
-std::array<float,2>{0.458266705f, 0.483378142f},
-std::array<float,2>{0.0859418735f, 0.796575844f},
-std::array<float,2>{0.801073313f, 0.0948682651f},
-std::array<float,2>{0.959064305f, 0.877397716f},
-std::array<float,2>{0.209533185f, 0.231144801f},
-std::array<float,2>{0.279835194f, 0.656391084f},
-std::array<float,2>{0.653068304f, 0.278180122f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0276917182f, 0.257932782f},
-std::array<float,2>{0.739197135f, 0.527236402f},
-std::array<float,2>{0.366700351f, 0.915740371f},
-std::array<float,2>{0.923856616f, 0.221778944f},
-std::array<float,2>{0.432263553f, 0.0056715766f},
-std::array<float,2>{0.824470997f, 0.829176664f},
-std::array<float,2>{0.145382866f, 0.689514697f},
-std::array<float,2>{0.582985997f, 0.470231473f},
-std::array<float,2>{0.213978782f, 0.148402408f},
-std::array<float,2>{0.54923737f, 0.999771059f},
-std::array<float,2>{0.49343878f, 0.589368284f},
-std::array<float,2>{0.760167539f, 0.347841799f},
-std::array<float,2>{0.287345231f, 0.375163794f},
-std::array<float,2>{0.95178628f, 0.641375124f},
-std::array<float,2>{0.0733340681f, 0.784716547f},
-std::array<float,2>{0.629619539f, 0.0793493465f},
-std::array<float,2>{0.159914196f, 0.458190262f},
-std::array<float,2>{0.608330607f, 0.737539411f},
-std::array<float,2>{0.396690667f, 0.863855064f},
-std::array<float,2>{0.865232885f, 0.0319233052f},
-std::array<float,2>{0.326107055f, 0.205507338f},
-std::array<float,2>{0.901089609f, 0.876143992f},
-std::array<float,2>{0.0597980842f, 0.560617864f},
-std::array<float,2>{0.711331725f, 0.284263313f},
-std::array<float,2>{0.100084059f, 0.118789718f},
-std::array<float,2>{0.657801509f, 0.761559665f},
-std::array<float,2>{0.269547731f, 0.684969127f},
-std::array<float,2>{0.982006907f, 0.428614855f},
-std::array<float,2>{0.465919375f, 0.33319366f},
-std::array<float,2>{0.789107621f, 0.602890491f},
-std::array<float,2>{0.23262611f, 0.946805358f},
-std::array<float,2>{0.510771394f, 0.159037247f},
-std::array<float,2>{0.0859147087f, 0.412479818f},
-std::array<float,2>{0.649813831f, 0.6618613f},
-std::array<float,2>{0.306551814f, 0.768195689f},
-std::array<float,2>{0.961896718f, 0.0969857499f},
-std::array<float,2>{0.482516766f, 0.180486411f},
-std::array<float,2>{0.774597943f, 0.953391552f},
-std::array<float,2>{0.196079463f, 0.614067197f},
-std::array<float,2>{0.539076447f, 0.313346714f},
-std::array<float,2>{0.1337367f, 0.0553089939f},
-std::array<float,2>{0.577208221f, 0.854731917f},
-std::array<float,2>{0.410938084f, 0.733043134f},
-std::array<float,2>{0.835067153f, 0.452927321f},
-std::array<float,2>{0.349130392f, 0.300436169f},
-std::array<float,2>{0.914619029f, 0.545449018f},
-std::array<float,2>{0.0136826718f, 0.899580836f},
-std::array<float,2>{0.726602018f, 0.199919254f},
-std::array<float,2>{0.244425952f, 0.362409115f},
-std::array<float,2>{0.530722082f, 0.571077287f},
-std::array<float,2>{0.440613359f, 0.969694912f},
-std::array<float,2>{0.801911712f, 0.139616832f},
-std::array<float,2>{0.251541078f, 0.0718033835f},
-std::array<float,2>{0.9969576f, 0.805030882f},
-std::array<float,2>{0.11112307f, 0.628751993f},
-std::array<float,2>{0.678577244f, 0.397432059f},
-std::array<float,2>{0.0403909199f, 0.235401765f},
-std::array<float,2>{0.695450723f, 0.931686223f},
-std::array<float,2>{0.336998165f, 0.511262059f},
-std::array<float,2>{0.875226319f, 0.26811105f},
-std::array<float,2>{0.376247078f, 0.498105139f},
-std::array<float,2>{0.851757169f, 0.714837134f},
-std::array<float,2>{0.173592031f, 0.81998992f},
-std::array<float,2>{0.616035461f, 0.0195482261f},
-std::array<float,2>{0.123275548f, 0.325273246f},
-std::array<float,2>{0.686395764f, 0.619378805f},
-std::array<float,2>{0.260343134f, 0.968018234f},
-std::array<float,2>{0.988210142f, 0.177234963f},
-std::array<float,2>{0.447747827f, 0.1035809f},
-std::array<float,2>{0.808469653f, 0.780718446f},
-std::array<float,2>{0.236083671f, 0.66418004f},
-std::array<float,2>{0.51793921f, 0.421517164f},
-std::array<float,2>{0.182898119f, 0.191449538f},
-std::array<float,2>{0.621853113f, 0.893689334f},
-std::array<float,2>{0.39021197f, 0.535798073f},
-std::array<float,2>{0.851333559f, 0.305455834f},
-std::array<float,2>{0.331852764f, 0.44192192f},
-std::array<float,2>{0.883104563f, 0.721573651f},
-std::array<float,2>{0.0364789888f, 0.850354314f},
-std::array<float,2>{0.689493358f, 0.0543668307f},
-std::array<float,2>{0.188387007f, 0.399566561f},
-std::array<float,2>{0.538597763f, 0.635435164f},
-std::array<float,2>{0.471058905f, 0.798185945f},
-std::array<float,2>{0.769106805f, 0.0632319227f},
-std::array<float,2>{0.300022572f, 0.132544979f},
-std::array<float,2>{0.960838377f, 0.981289029f},
-std::array<float,2>{0.0899274871f, 0.568447351f},
-std::array<float,2>{0.644029737f, 0.369161725f},
-std::array<float,2>{0.0044513694f, 0.0265709572f},
-std::array<float,2>{0.724138439f, 0.826872826f},
-std::array<float,2>{0.354008526f, 0.707405031f},
-std::array<float,2>{0.90770936f, 0.484783679f},
-std::array<float,2>{0.420638174f, 0.276503474f},
-std::array<float,2>{0.83816731f, 0.503038764f},
-std::array<float,2>{0.128963351f, 0.927512944f},
-std::array<float,2>{0.569780469f, 0.246601477f},
-std::array<float,2>{0.0499465056f, 0.477270186f},
-std::array<float,2>{0.710539222f, 0.700241089f},
-std::array<float,2>{0.318777889f, 0.842651188f},
-std::array<float,2>{0.893141925f, 0.0119135119f},
-std::array<float,2>{0.400487036f, 0.23082146f},
-std::array<float,2>{0.872639f, 0.912126243f},
-std::array<float,2>{0.166299865f, 0.517660916f},
-std::array<float,2>{0.601511061f, 0.252299011f},
-std::array<float,2>{0.219540834f, 0.0886940733f},
-std::array<float,2>{0.502346694f, 0.792273521f},
-std::array<float,2>{0.45855999f, 0.655615211f},
-std::array<float,2>{0.788042009f, 0.389271855f},
-std::array<float,2>{0.275622666f, 0.352877021f},
-std::array<float,2>{0.972798705f, 0.58561182f},
-std::array<float,2>{0.10712155f, 0.987385333f},
-std::array<float,2>{0.668810368f, 0.15585427f},
-std::array<float,2>{0.154103726f, 0.2964966f},
-std::array<float,2>{0.591403961f, 0.551237702f},
-std::array<float,2>{0.42645511f, 0.885535181f},
-std::array<float,2>{0.813630164f, 0.211301968f},
-std::array<float,2>{0.367712319f, 0.0447427295f},
-std::array<float,2>{0.933247685f, 0.869239032f},
-std::array<float,2>{0.0215024259f, 0.749714851f},
-std::array<float,2>{0.7424106f, 0.463336527f},
-std::array<float,2>{0.0656722486f, 0.166354924f},
-std::array<float,2>{0.634805202f, 0.940719962f},
-std::array<float,2>{0.292762488f, 0.594444633f},
-std::array<float,2>{0.94114238f, 0.340370297f},
-std::array<float,2>{0.490803361f, 0.434754461f},
-std::array<float,2>{0.75233376f, 0.672465444f},
-std::array<float,2>{0.204490528f, 0.753218889f},
-std::array<float,2>{0.56080991f, 0.116187498f},
-std::array<float,2>{0.0759880245f, 0.310025275f},
-std::array<float,2>{0.625299573f, 0.531593263f},
-std::array<float,2>{0.283850938f, 0.897232711f},
-std::array<float,2>{0.945994973f, 0.191093743f},
-std::array<float,2>{0.498067021f, 0.0469029024f},
-std::array<float,2>{0.763929665f, 0.847431481f},
-std::array<float,2>{0.217645898f, 0.725753367f},
-std::array<float,2>{0.552094996f, 0.438345701f},
-std::array<float,2>{0.142196789f, 0.173417166f},
-std::array<float,2>{0.57878983f, 0.963024557f},
-std::array<float,2>{0.434446752f, 0.621136367f},
-std::array<float,2>{0.820405006f, 0.323306054f},
-std::array<float,2>{0.362133563f, 0.417186469f},
-std::array<float,2>{0.929195642f, 0.671017826f},
-std::array<float,2>{0.0246665776f, 0.776695788f},
-std::array<float,2>{0.737738907f, 0.106451012f},
-std::array<float,2>{0.227958053f, 0.489641875f},
-std::array<float,2>{0.511847258f, 0.70540005f},
-std::array<float,2>{0.461263746f, 0.823284924f},
-std::array<float,2>{0.794102907f, 0.0282386132f},
-std::array<float,2>{0.268007517f, 0.243426576f},
-std::array<float,2>{0.978447258f, 0.923558176f},
-std::array<float,2>{0.0948701352f, 0.505278945f},
-std::array<float,2>{0.662353575f, 0.277381092f},
-std::array<float,2>{0.0570970476f, 0.0693765208f},
-std::array<float,2>{0.716588855f, 0.803346694f},
-std::array<float,2>{0.322806776f, 0.636868358f},
-std::array<float,2>{0.903979242f, 0.403777391f},
-std::array<float,2>{0.392894834f, 0.371967137f},
-std::array<float,2>{0.861171782f, 0.565011799f},
-std::array<float,2>{0.161616668f, 0.97896874f},
-std::array<float,2>{0.603793561f, 0.125443339f},
-std::array<float,2>{0.0094448505f, 0.38386032f},
-std::array<float,2>{0.733242154f, 0.651446819f},
-std::array<float,2>{0.345757186f, 0.794510841f},
-std::array<float,2>{0.91872859f, 0.0908345506f},
-std::array<float,2>{0.406292528f, 0.149231225f},
-std::array<float,2>{0.829991043f, 0.989582896f},
-std::array<float,2>{0.137017772f, 0.580184996f},
-std::array<float,2>{0.570718288f, 0.358005375f},
-std::array<float,2>{0.202342942f, 0.0080486387f},
-std::array<float,2>{0.545055449f, 0.839533806f},
-std::array<float,2>{0.479040027f, 0.696246743f},
-std::array<float,2>{0.778907239f, 0.481135339f},
-std::array<float,2>{0.310787737f, 0.255720913f},
-std::array<float,2>{0.966764808f, 0.522885561f},
-std::array<float,2>{0.0818028077f, 0.906609535f},
-std::array<float,2>{0.654295683f, 0.227267802f},
-std::array<float,2>{0.178089321f, 0.338250041f},
-std::array<float,2>{0.611311316f, 0.599639833f},
-std::array<float,2>{0.38079825f, 0.944280922f},
-std::array<float,2>{0.855682671f, 0.171554387f},
-std::array<float,2>{0.341808826f, 0.112202674f},
-std::array<float,2>{0.879278004f, 0.755198181f},
-std::array<float,2>{0.0457950681f, 0.677896559f},
-std::array<float,2>{0.701666296f, 0.432537317f},
-std::array<float,2>{0.116044924f, 0.216746524f},
-std::array<float,2>{0.675274372f, 0.887903571f},
-std::array<float,2>{0.255723238f, 0.548082411f},
-std::array<float,2>{0.992902994f, 0.290259093f},
-std::array<float,2>{0.44522655f, 0.467462718f},
-std::array<float,2>{0.797213614f, 0.744435966f},
-std::array<float,2>{0.248692945f, 0.872680008f},
-std::array<float,2>{0.525697112f, 0.041217342f},
-std::array<float,2>{0.0330590345f, 0.3471376f},
-std::array<float,2>{0.693360448f, 0.590778053f},
-std::array<float,2>{0.335199565f, 0.993288219f},
-std::array<float,2>{0.889023185f, 0.142675221f},
-std::array<float,2>{0.38496241f, 0.083217077f},
-std::array<float,2>{0.844488978f, 0.787228703f},
-std::array<float,2>{0.18440713f, 0.646095693f},
-std::array<float,2>{0.618669927f, 0.381020039f},
-std::array<float,2>{0.239681259f, 0.223232627f},
-std::array<float,2>{0.522851706f, 0.921293616f},
-std::array<float,2>{0.450767696f, 0.530773818f},
-std::array<float,2>{0.809285522f, 0.264669538f},
-std::array<float,2>{0.265191406f, 0.474910438f},
-std::array<float,2>{0.989071846f, 0.694689929f},
-std::array<float,2>{0.11993397f, 0.833391309f},
-std::array<float,2>{0.682100594f, 0.000848308904f},
-std::array<float,2>{0.128670052f, 0.422829539f},
-std::array<float,2>{0.565502584f, 0.681044459f},
-std::array<float,2>{0.416432112f, 0.763127863f},
-std::array<float,2>{0.843524814f, 0.124045141f},
-std::array<float,2>{0.357109815f, 0.160976708f},
-std::array<float,2>{0.912372231f, 0.950375974f},
-std::array<float,2>{0.00175388902f, 0.606777549f},
-std::array<float,2>{0.722313643f, 0.329646051f},
-std::array<float,2>{0.089802824f, 0.0371557325f},
-std::array<float,2>{0.646213651f, 0.862859666f},
-std::array<float,2>{0.30332914f, 0.740977705f},
-std::array<float,2>{0.953866243f, 0.457029581f},
-std::array<float,2>{0.473946273f, 0.288382977f},
-std::array<float,2>{0.771279931f, 0.557468832f},
-std::array<float,2>{0.191433206f, 0.879415214f},
-std::array<float,2>{0.534764707f, 0.208734661f},
-std::array<float,2>{0.105443291f, 0.449052572f},
-std::array<float,2>{0.667098761f, 0.726903558f},
-std::array<float,2>{0.278194994f, 0.856850803f},
-std::array<float,2>{0.970483005f, 0.0613161661f},
-std::array<float,2>{0.454327792f, 0.198129922f},
-std::array<float,2>{0.782630205f, 0.90553838f},
-std::array<float,2>{0.226386949f, 0.540886641f},
-std::array<float,2>{0.504984319f, 0.301857799f},
-std::array<float,2>{0.169075891f, 0.0977949128f},
-std::array<float,2>{0.59618938f, 0.773232043f},
-std::array<float,2>{0.402488589f, 0.656852722f},
-std::array<float,2>{0.869933784f, 0.407710254f},
-std::array<float,2>{0.315880388f, 0.317263007f},
-std::array<float,2>{0.897544205f, 0.610208333f},
-std::array<float,2>{0.0539823808f, 0.958208323f},
-std::array<float,2>{0.703877032f, 0.186991319f},
-std::array<float,2>{0.210508227f, 0.272820294f},
-std::array<float,2>{0.55507046f, 0.512709379f},
-std::array<float,2>{0.485271215f, 0.936389804f},
-std::array<float,2>{0.756189525f, 0.241001204f},
-std::array<float,2>{0.293455511f, 0.0188573841f},
-std::array<float,2>{0.94447279f, 0.813419521f},
-std::array<float,2>{0.0702628046f, 0.717779875f},
-std::array<float,2>{0.640041888f, 0.494524688f},
-std::array<float,2>{0.0192329325f, 0.134936184f},
-std::array<float,2>{0.746183872f, 0.975929141f},
-std::array<float,2>{0.373739868f, 0.575936496f},
-std::array<float,2>{0.937059283f, 0.363811016f},
-std::array<float,2>{0.424354941f, 0.394524246f},
-std::array<float,2>{0.819717705f, 0.630778134f},
-std::array<float,2>{0.149321809f, 0.811532021f},
-std::array<float,2>{0.588398874f, 0.0745606422f},
-std::array<float,2>{0.0608187243f, 0.282967716f},
-std::array<float,2>{0.713507473f, 0.559847355f},
-std::array<float,2>{0.327904671f, 0.877000332f},
-std::array<float,2>{0.898693383f, 0.204866678f},
-std::array<float,2>{0.395832807f, 0.0333319865f},
-std::array<float,2>{0.866875529f, 0.865394354f},
-std::array<float,2>{0.156953648f, 0.73448962f},
-std::array<float,2>{0.607157826f, 0.459353864f},
-std::array<float,2>{0.231921181f, 0.156948134f},
-std::array<float,2>{0.508085907f, 0.948468149f},
-std::array<float,2>{0.467025727f, 0.604002357f},
-std::array<float,2>{0.791598499f, 0.33522737f},
-std::array<float,2>{0.271958143f, 0.426908463f},
-std::array<float,2>{0.98345387f, 0.686500788f},
-std::array<float,2>{0.0988651216f, 0.757821441f},
-std::array<float,2>{0.659802139f, 0.119772509f},
-std::array<float,2>{0.148118511f, 0.471036434f},
-std::array<float,2>{0.584255159f, 0.688822269f},
-std::array<float,2>{0.430719912f, 0.830543935f},
-std::array<float,2>{0.827224851f, 0.00686018588f},
-std::array<float,2>{0.365159422f, 0.220244959f},
-std::array<float,2>{0.922378004f, 0.917380333f},
-std::array<float,2>{0.0295475069f, 0.524298251f},
-std::array<float,2>{0.74134773f, 0.261539549f},
-std::array<float,2>{0.0706083998f, 0.08123108f},
-std::array<float,2>{0.632654727f, 0.783167779f},
-std::array<float,2>{0.285355508f, 0.644123971f},
-std::array<float,2>{0.949915588f, 0.378600776f},
-std::array<float,2>{0.494768083f, 0.349707782f},
-std::array<float,2>{0.758231997f, 0.586869538f},
-std::array<float,2>{0.212730348f, 0.997295797f},
-std::array<float,2>{0.547821403f, 0.146399185f},
-std::array<float,2>{0.113065407f, 0.396470934f},
-std::array<float,2>{0.676932931f, 0.626247525f},
-std::array<float,2>{0.252181858f, 0.807971358f},
-std::array<float,2>{0.998838603f, 0.0740095153f},
-std::array<float,2>{0.437581122f, 0.137468114f},
-std::array<float,2>{0.804385185f, 0.972267807f},
-std::array<float,2>{0.242997438f, 0.572489381f},
-std::array<float,2>{0.528204799f, 0.359859496f},
-std::array<float,2>{0.174837559f, 0.0229092073f},
-std::array<float,2>{0.614752591f, 0.816789806f},
-std::array<float,2>{0.378067076f, 0.711315691f},
-std::array<float,2>{0.854829013f, 0.496679097f},
-std::array<float,2>{0.339607924f, 0.2661587f},
-std::array<float,2>{0.878144979f, 0.509488225f},
-std::array<float,2>{0.0413677692f, 0.929877639f},
-std::array<float,2>{0.698185921f, 0.237635449f},
-std::array<float,2>{0.197517768f, 0.315111399f},
-std::array<float,2>{0.542906046f, 0.616539121f},
-std::array<float,2>{0.480716497f, 0.95569551f},
-std::array<float,2>{0.776612699f, 0.182319582f},
-std::array<float,2>{0.307424545f, 0.0947833806f},
-std::array<float,2>{0.964759767f, 0.767257631f},
-std::array<float,2>{0.0835074931f, 0.663328946f},
-std::array<float,2>{0.650773048f, 0.410774112f},
-std::array<float,2>{0.0127385017f, 0.201950967f},
-std::array<float,2>{0.728690505f, 0.900921524f},
-std::array<float,2>{0.350387782f, 0.544620037f},
-std::array<float,2>{0.917210817f, 0.298822284f},
-std::array<float,2>{0.413449824f, 0.44982481f},
-std::array<float,2>{0.833234668f, 0.731082201f},
-std::array<float,2>{0.135689676f, 0.852031231f},
-std::array<float,2>{0.575969696f, 0.0585868657f},
-std::array<float,2>{0.0923751071f, 0.367331922f},
-std::array<float,2>{0.640813947f, 0.567346931f},
-std::array<float,2>{0.297442824f, 0.983870983f},
-std::array<float,2>{0.958083451f, 0.130492315f},
-std::array<float,2>{0.470148265f, 0.0660713837f},
-std::array<float,2>{0.767332494f, 0.799242973f},
-std::array<float,2>{0.190474898f, 0.634064019f},
-std::array<float,2>{0.536651611f, 0.401848555f},
-std::array<float,2>{0.13275142f, 0.248201698f},
-std::array<float,2>{0.566854537f, 0.929286659f},
-std::array<float,2>{0.419730574f, 0.500776947f},
-std::array<float,2>{0.837326646f, 0.273467511f},
-std::array<float,2>{0.351844192f, 0.487868905f},
-std::array<float,2>{0.909902215f, 0.709474504f},
-std::array<float,2>{0.00606404338f, 0.825288773f},
-std::array<float,2>{0.725532532f, 0.0242068656f},
-std::array<float,2>{0.237469494f, 0.418574214f},
-std::array<float,2>{0.516893864f, 0.667305708f},
-std::array<float,2>{0.446755797f, 0.777476907f},
-std::array<float,2>{0.805018842f, 0.10177879f},
-std::array<float,2>{0.258856982f, 0.179138497f},
-std::array<float,2>{0.986216307f, 0.965260148f},
-std::array<float,2>{0.122953042f, 0.618288219f},
-std::array<float,2>{0.683747768f, 0.327484936f},
-std::array<float,2>{0.0389312692f, 0.0513753332f},
-std::array<float,2>{0.688590169f, 0.84906131f},
-std::array<float,2>{0.328183383f, 0.719771385f},
-std::array<float,2>{0.885406792f, 0.444838375f},
-std::array<float,2>{0.388535887f, 0.308313787f},
-std::array<float,2>{0.84869343f, 0.53871119f},
-std::array<float,2>{0.179813713f, 0.891115308f},
-std::array<float,2>{0.623447061f, 0.193682939f},
-std::array<float,2>{0.0214292817f, 0.460989416f},
-std::array<float,2>{0.745388806f, 0.747511148f},
-std::array<float,2>{0.369577348f, 0.867367089f},
-std::array<float,2>{0.930045307f, 0.0464641154f},
-std::array<float,2>{0.427990526f, 0.213182032f},
-std::array<float,2>{0.815329313f, 0.88319546f},
-std::array<float,2>{0.155982822f, 0.554022551f},
-std::array<float,2>{0.593040526f, 0.293762773f},
-std::array<float,2>{0.205894127f, 0.114117898f},
-std::array<float,2>{0.559252322f, 0.750782907f},
-std::array<float,2>{0.489814788f, 0.675348461f},
-std::array<float,2>{0.751564085f, 0.43618989f},
-std::array<float,2>{0.289743632f, 0.342053741f},
-std::array<float,2>{0.939359009f, 0.597100914f},
-std::array<float,2>{0.062714465f, 0.939121485f},
-std::array<float,2>{0.633377016f, 0.164578244f},
-std::array<float,2>{0.165546805f, 0.251230031f},
-std::array<float,2>{0.598994851f, 0.516614616f},
-std::array<float,2>{0.398719251f, 0.910973012f},
-std::array<float,2>{0.873634815f, 0.234116346f},
-std::array<float,2>{0.317607462f, 0.0141977128f},
-std::array<float,2>{0.891204715f, 0.841166973f},
-std::array<float,2>{0.0471586101f, 0.701218784f},
-std::array<float,2>{0.707511425f, 0.479218066f},
-std::array<float,2>{0.108960673f, 0.152937889f},
-std::array<float,2>{0.671737373f, 0.986240029f},
-std::array<float,2>{0.274085313f, 0.583959579f},
-std::array<float,2>{0.975168705f, 0.355137408f},
-std::array<float,2>{0.459341496f, 0.386722296f},
-std::array<float,2>{0.786253989f, 0.652497888f},
-std::array<float,2>{0.222202018f, 0.791006625f},
-std::array<float,2>{0.500034034f, 0.0869269744f},
-std::array<float,2>{0.0964779779f, 0.280666649f},
-std::array<float,2>{0.660733938f, 0.506574988f},
-std::array<float,2>{0.26590082f, 0.924256742f},
-std::array<float,2>{0.978953481f, 0.24545984f},
-std::array<float,2>{0.463468611f, 0.0295722242f},
-std::array<float,2>{0.796039999f, 0.820619226f},
-std::array<float,2>{0.228918001f, 0.703691483f},
-std::array<float,2>{0.514280438f, 0.492160767f},
-std::array<float,2>{0.162668005f, 0.128896341f},
-std::array<float,2>{0.602710903f, 0.976674438f},
-std::array<float,2>{0.391044229f, 0.564182997f},
-std::array<float,2>{0.861480653f, 0.374024123f},
-std::array<float,2>{0.321207047f, 0.405029774f},
-std::array<float,2>{0.905059338f, 0.639840066f},
-std::array<float,2>{0.0547792166f, 0.802408814f},
-std::array<float,2>{0.718509078f, 0.0673562512f},
-std::array<float,2>{0.215043962f, 0.440321922f},
-std::array<float,2>{0.553130686f, 0.724130511f},
-std::array<float,2>{0.497184068f, 0.845249116f},
-std::array<float,2>{0.762869716f, 0.0506365746f},
-std::array<float,2>{0.282616019f, 0.187787965f},
-std::array<float,2>{0.947438598f, 0.895227432f},
-std::array<float,2>{0.0774702802f, 0.534867167f},
-std::array<float,2>{0.628162503f, 0.310681432f},
-std::array<float,2>{0.026101239f, 0.10889817f},
-std::array<float,2>{0.735409915f, 0.774859786f},
-std::array<float,2>{0.3608796f, 0.668655932f},
-std::array<float,2>{0.926180124f, 0.41579923f},
-std::array<float,2>{0.436171621f, 0.320519f},
-std::array<float,2>{0.823109984f, 0.623232305f},
-std::array<float,2>{0.143149465f, 0.962341785f},
-std::array<float,2>{0.580374777f, 0.175602764f},
-std::array<float,2>{0.0430409759f, 0.431303024f},
-std::array<float,2>{0.700858355f, 0.676831901f},
-std::array<float,2>{0.341595441f, 0.757726908f},
-std::array<float,2>{0.88274169f, 0.110616505f},
-std::array<float,2>{0.382358164f, 0.168256015f},
-std::array<float,2>{0.859125137f, 0.942127824f},
-std::array<float,2>{0.177187949f, 0.598954737f},
-std::array<float,2>{0.612565219f, 0.337007731f},
-std::array<float,2>{0.247989655f, 0.0398095436f},
-std::array<float,2>{0.524712682f, 0.873774707f},
-std::array<float,2>{0.442283899f, 0.742618501f},
-std::array<float,2>{0.799588799f, 0.465721577f},
-std::array<float,2>{0.256295085f, 0.291168272f},
-std::array<float,2>{0.994803429f, 0.549871504f},
-std::array<float,2>{0.114618428f, 0.889765322f},
-std::array<float,2>{0.672753751f, 0.218688086f},
-std::array<float,2>{0.139644757f, 0.356997341f},
-std::array<float,2>{0.57268393f, 0.579745233f},
-std::array<float,2>{0.408583134f, 0.99052006f},
-std::array<float,2>{0.83102268f, 0.15040423f},
-std::array<float,2>{0.345201939f, 0.0933373794f},
-std::array<float,2>{0.921847463f, 0.796543658f},
-std::array<float,2>{0.0103107672f, 0.65001905f},
-std::array<float,2>{0.731752217f, 0.384823859f},
-std::array<float,2>{0.0787250698f, 0.229558393f},
-std::array<float,2>{0.655578196f, 0.908611119f},
-std::array<float,2>{0.308935285f, 0.521246135f},
-std::array<float,2>{0.96733743f, 0.256790072f},
-std::array<float,2>{0.477052152f, 0.483939409f},
-std::array<float,2>{0.780185997f, 0.698444963f},
-std::array<float,2>{0.200094819f, 0.836710453f},
-std::array<float,2>{0.544309795f, 0.00981908292f},
-std::array<float,2>{0.00370267592f, 0.330618411f},
-std::array<float,2>{0.720411003f, 0.608936191f},
-std::array<float,2>{0.35794422f, 0.952210665f},
-std::array<float,2>{0.911808074f, 0.163211688f},
-std::array<float,2>{0.414349467f, 0.122599438f},
-std::array<float,2>{0.8412202f, 0.764249742f},
-std::array<float,2>{0.126673475f, 0.683254838f},
-std::array<float,2>{0.563950837f, 0.424527287f},
-std::array<float,2>{0.193509281f, 0.209156826f},
-std::array<float,2>{0.532164156f, 0.882769227f},
-std::array<float,2>{0.475577265f, 0.555815279f},
-std::array<float,2>{0.772347867f, 0.286636949f},
-std::array<float,2>{0.302314162f, 0.453898519f},
-std::array<float,2>{0.95597744f, 0.738433301f},
-std::array<float,2>{0.0867794976f, 0.859552383f},
-std::array<float,2>{0.647431493f, 0.0357750542f},
-std::array<float,2>{0.185939074f, 0.379221708f},
-std::array<float,2>{0.620084405f, 0.647337377f},
-std::array<float,2>{0.383151859f, 0.786997318f},
-std::array<float,2>{0.846399069f, 0.0841428041f},
-std::array<float,2>{0.333114207f, 0.140710816f},
-std::array<float,2>{0.886764586f, 0.995902002f},
-std::array<float,2>{0.0339305997f, 0.592669785f},
-std::array<float,2>{0.693006516f, 0.345196187f},
-std::array<float,2>{0.118315302f, 0.00259840349f},
-std::array<float,2>{0.67969662f, 0.834238172f},
-std::array<float,2>{0.262837082f, 0.692708492f},
-std::array<float,2>{0.991902888f, 0.474600703f},
-std::array<float,2>{0.451500088f, 0.262845397f},
-std::array<float,2>{0.810980737f, 0.529146254f},
-std::array<float,2>{0.241136909f, 0.91971606f},
-std::array<float,2>{0.521480322f, 0.225549683f},
-std::array<float,2>{0.0678802654f, 0.494044662f},
-std::array<float,2>{0.638325036f, 0.715907514f},
-std::array<float,2>{0.296775579f, 0.815354049f},
-std::array<float,2>{0.942640722f, 0.0171790347f},
-std::array<float,2>{0.486831307f, 0.239741236f},
-std::array<float,2>{0.755706489f, 0.934084177f},
-std::array<float,2>{0.208261043f, 0.513778627f},
-std::array<float,2>{0.558059633f, 0.270726204f},
-std::array<float,2>{0.151917502f, 0.077748619f},
-std::array<float,2>{0.587741792f, 0.809276581f},
-std::array<float,2>{0.423271477f, 0.631326079f},
-std::array<float,2>{0.816756129f, 0.392367303f},
-std::array<float,2>{0.371373087f, 0.365526617f},
-std::array<float,2>{0.934044123f, 0.578017354f},
-std::array<float,2>{0.0161508247f, 0.97388047f},
-std::array<float,2>{0.749428749f, 0.133454219f},
-std::array<float,2>{0.22451815f, 0.303425819f},
-std::array<float,2>{0.5061782f, 0.542737961f},
-std::array<float,2>{0.455655754f, 0.902511716f},
-std::array<float,2>{0.783562601f, 0.195960879f},
-std::array<float,2>{0.280507594f, 0.0596532486f},
-std::array<float,2>{0.971125662f, 0.858111858f},
-std::array<float,2>{0.102016427f, 0.728645384f},
-std::array<float,2>{0.665302873f, 0.446913511f},
-std::array<float,2>{0.0524168797f, 0.184022039f},
-std::array<float,2>{0.705903351f, 0.960001528f},
-std::array<float,2>{0.313397944f, 0.612983823f},
-std::array<float,2>{0.895310044f, 0.318498313f},
-std::array<float,2>{0.405615479f, 0.409753621f},
-std::array<float,2>{0.868293822f, 0.659228921f},
-std::array<float,2>{0.171670526f, 0.771430373f},
-std::array<float,2>{0.594555259f, 0.0996523649f},
-std::array<float,2>{0.0155816479f, 0.297443658f},
-std::array<float,2>{0.728055179f, 0.542983055f},
-std::array<float,2>{0.348320514f, 0.901606917f},
-std::array<float,2>{0.91525352f, 0.202414915f},
-std::array<float,2>{0.411843777f, 0.0573748648f},
-std::array<float,2>{0.834575355f, 0.853044093f},
-std::array<float,2>{0.134064123f, 0.732236028f},
-std::array<float,2>{0.576931357f, 0.451085746f},
-std::array<float,2>{0.196679473f, 0.182903156f},
-std::array<float,2>{0.540677488f, 0.956291735f},
-std::array<float,2>{0.483617961f, 0.615455449f},
-std::array<float,2>{0.774312615f, 0.315642029f},
-std::array<float,2>{0.304831445f, 0.412007719f},
-std::array<float,2>{0.96265769f, 0.662969768f},
-std::array<float,2>{0.0840483159f, 0.766565263f},
-std::array<float,2>{0.649377167f, 0.0942945555f},
-std::array<float,2>{0.172621369f, 0.497795254f},
-std::array<float,2>{0.616841137f, 0.712453485f},
-std::array<float,2>{0.37522611f, 0.817723751f},
-std::array<float,2>{0.853104055f, 0.0221311636f},
-std::array<float,2>{0.336244792f, 0.236584246f},
-std::array<float,2>{0.876562238f, 0.930705309f},
-std::array<float,2>{0.0396202095f, 0.508650839f},
-std::array<float,2>{0.696408451f, 0.266699314f},
-std::array<float,2>{0.110006951f, 0.0722950324f},
-std::array<float,2>{0.679121137f, 0.807147622f},
-std::array<float,2>{0.250846446f, 0.625550866f},
-std::array<float,2>{0.997310042f, 0.394892156f},
-std::array<float,2>{0.440009266f, 0.360451967f},
-std::array<float,2>{0.801246703f, 0.574044645f},
-std::array<float,2>{0.245789975f, 0.970778942f},
-std::array<float,2>{0.530139685f, 0.13798359f},
-std::array<float,2>{0.0725423396f, 0.377580464f},
-std::array<float,2>{0.630088687f, 0.642946899f},
-std::array<float,2>{0.28830868f, 0.781963587f},
-std::array<float,2>{0.953036487f, 0.08063481f},
-std::array<float,2>{0.492918134f, 0.144843206f},
-std::array<float,2>{0.761443257f, 0.996316969f},
-std::array<float,2>{0.213284358f, 0.58753556f},
-std::array<float,2>{0.549873233f, 0.351157725f},
-std::array<float,2>{0.145536795f, 0.00678715575f},
-std::array<float,2>{0.583708525f, 0.831949115f},
-std::array<float,2>{0.432757974f, 0.687588751f},
-std::array<float,2>{0.825291157f, 0.471904635f},
-std::array<float,2>{0.365326017f, 0.260528356f},
-std::array<float,2>{0.925105095f, 0.524572551f},
-std::array<float,2>{0.0283840504f, 0.916719198f},
-std::array<float,2>{0.739293575f, 0.219294578f},
-std::array<float,2>{0.233931467f, 0.33494249f},
-std::array<float,2>{0.510670185f, 0.605103731f},
-std::array<float,2>{0.464853615f, 0.948183417f},
-std::array<float,2>{0.790906191f, 0.15722689f},
-std::array<float,2>{0.271283031f, 0.120674372f},
-std::array<float,2>{0.980645895f, 0.759081841f},
-std::array<float,2>{0.101007432f, 0.686951339f},
-std::array<float,2>{0.657134771f, 0.426372558f},
-std::array<float,2>{0.0591008589f, 0.203956753f},
-std::array<float,2>{0.712032378f, 0.878700852f},
-std::array<float,2>{0.324907422f, 0.55949682f},
-std::array<float,2>{0.902087808f, 0.281274408f},
-std::array<float,2>{0.397657961f, 0.460749537f},
-std::array<float,2>{0.86364609f, 0.735656857f},
-std::array<float,2>{0.158570677f, 0.867046237f},
-std::array<float,2>{0.609119058f, 0.0350090265f},
-std::array<float,2>{0.105480827f, 0.354306638f},
-std::array<float,2>{0.669183493f, 0.582199991f},
-std::array<float,2>{0.276668072f, 0.984458327f},
-std::array<float,2>{0.973643064f, 0.15374288f},
-std::array<float,2>{0.457646906f, 0.0868935362f},
-std::array<float,2>{0.788102567f, 0.789283991f},
-std::array<float,2>{0.220628545f, 0.653965533f},
-std::array<float,2>{0.503108442f, 0.387751669f},
-std::array<float,2>{0.167546809f, 0.232820287f},
-std::array<float,2>{0.599879146f, 0.911366403f},
-std::array<float,2>{0.402337104f, 0.51581341f},
-std::array<float,2>{0.871688068f, 0.250845313f},
-std::array<float,2>{0.319991082f, 0.479678392f},
-std::array<float,2>{0.894345164f, 0.702389359f},
-std::array<float,2>{0.0491431467f, 0.840125263f},
-std::array<float,2>{0.70929724f, 0.0148297474f},
-std::array<float,2>{0.203652427f, 0.437285244f},
-std::array<float,2>{0.562048197f, 0.673922181f},
-std::array<float,2>{0.491708577f, 0.751880169f},
-std::array<float,2>{0.753791749f, 0.114567697f},
-std::array<float,2>{0.291216463f, 0.165815368f},
-std::array<float,2>{0.93986541f, 0.938215613f},
-std::array<float,2>{0.0647936612f, 0.596474469f},
-std::array<float,2>{0.635848343f, 0.343563646f},
-std::array<float,2>{0.0225062575f, 0.0451104566f},
-std::array<float,2>{0.743314922f, 0.86816889f},
-std::array<float,2>{0.36904034f, 0.746098936f},
-std::array<float,2>{0.931761563f, 0.462663531f},
-std::array<float,2>{0.426778823f, 0.294015408f},
-std::array<float,2>{0.812923849f, 0.553099215f},
-std::array<float,2>{0.152728036f, 0.884131312f},
-std::array<float,2>{0.590086818f, 0.213951826f},
-std::array<float,2>{0.0353389382f, 0.443953097f},
-std::array<float,2>{0.690485179f, 0.719128609f},
-std::array<float,2>{0.330782861f, 0.847947538f},
-std::array<float,2>{0.88422823f, 0.052278623f},
-std::array<float,2>{0.389244795f, 0.19448556f},
-std::array<float,2>{0.849694729f, 0.892411768f},
-std::array<float,2>{0.182605788f, 0.537368417f},
-std::array<float,2>{0.62257123f, 0.307359368f},
-std::array<float,2>{0.234908253f, 0.103025302f},
-std::array<float,2>{0.519125402f, 0.778968871f},
-std::array<float,2>{0.448495656f, 0.666788578f},
-std::array<float,2>{0.807249486f, 0.419026226f},
-std::array<float,2>{0.261594892f, 0.326251f},
-std::array<float,2>{0.986846507f, 0.617756188f},
-std::array<float,2>{0.12441203f, 0.966399789f},
-std::array<float,2>{0.686772883f, 0.17811349f},
-std::array<float,2>{0.130841061f, 0.275229096f},
-std::array<float,2>{0.569015563f, 0.501168728f},
-std::array<float,2>{0.421192378f, 0.928162932f},
-std::array<float,2>{0.839081645f, 0.249171689f},
-std::array<float,2>{0.355327994f, 0.0250486899f},
-std::array<float,2>{0.906671464f, 0.824336112f},
-std::array<float,2>{0.00535676489f, 0.710626006f},
-std::array<float,2>{0.723339856f, 0.48708111f},
-std::array<float,2>{0.0912863165f, 0.129580989f},
-std::array<float,2>{0.643417537f, 0.983032286f},
-std::array<float,2>{0.29886198f, 0.568051577f},
-std::array<float,2>{0.959052444f, 0.36846751f},
-std::array<float,2>{0.472084612f, 0.400845706f},
-std::array<float,2>{0.768012822f, 0.633152962f},
-std::array<float,2>{0.188838899f, 0.800397217f},
-std::array<float,2>{0.53779161f, 0.0645616129f},
-std::array<float,2>{0.0807005689f, 0.25713709f},
-std::array<float,2>{0.652455509f, 0.51959753f},
-std::array<float,2>{0.311864763f, 0.909476936f},
-std::array<float,2>{0.964886844f, 0.228660703f},
-std::array<float,2>{0.47968775f, 0.0111793894f},
-std::array<float,2>{0.777492642f, 0.836920917f},
-std::array<float,2>{0.201533064f, 0.697398841f},
-std::array<float,2>{0.546811938f, 0.482915252f},
-std::array<float,2>{0.138440832f, 0.152215168f},
-std::array<float,2>{0.571533442f, 0.992172182f},
-std::array<float,2>{0.407477349f, 0.578150511f},
-std::array<float,2>{0.828657448f, 0.356106132f},
-std::array<float,2>{0.347319573f, 0.385898501f},
-std::array<float,2>{0.919621587f, 0.64900136f},
-std::array<float,2>{0.00853652693f, 0.795776188f},
-std::array<float,2>{0.733910084f, 0.0921416506f},
-std::array<float,2>{0.249293372f, 0.466322571f},
-std::array<float,2>{0.526616514f, 0.743193507f},
-std::array<float,2>{0.444230974f, 0.87449789f},
-std::array<float,2>{0.798113108f, 0.0408786014f},
-std::array<float,2>{0.254690349f, 0.217137665f},
-std::array<float,2>{0.993699968f, 0.889278531f},
-std::array<float,2>{0.11706908f, 0.54977572f},
-std::array<float,2>{0.674663842f, 0.292028546f},
-std::array<float,2>{0.0459020399f, 0.109424978f},
-std::array<float,2>{0.702404201f, 0.756580591f},
-std::array<float,2>{0.343388885f, 0.676589549f},
-std::array<float,2>{0.880626082f, 0.430363715f},
-std::array<float,2>{0.379373223f, 0.336319685f},
-std::array<float,2>{0.857083023f, 0.598458946f},
-std::array<float,2>{0.178957f, 0.942705393f},
-std::array<float,2>{0.609617293f, 0.169720054f},
-std::array<float,2>{0.0236252137f, 0.414504319f},
-std::array<float,2>{0.73663801f, 0.669618607f},
-std::array<float,2>{0.362881392f, 0.773437679f},
-std::array<float,2>{0.928481579f, 0.107847869f},
-std::array<float,2>{0.435264856f, 0.174657166f},
-std::array<float,2>{0.822146297f, 0.961766124f},
-std::array<float,2>{0.141006455f, 0.624756992f},
-std::array<float,2>{0.579781473f, 0.321549475f},
-std::array<float,2>{0.218302831f, 0.0488960184f},
-std::array<float,2>{0.551477432f, 0.844436944f},
-std::array<float,2>{0.499587744f, 0.723317206f},
-std::array<float,2>{0.764796615f, 0.440864682f},
-std::array<float,2>{0.285129905f, 0.312431246f},
-std::array<float,2>{0.946804225f, 0.534060299f},
-std::array<float,2>{0.074460797f, 0.895583093f},
-std::array<float,2>{0.626145661f, 0.189107373f},
-std::array<float,2>{0.161019266f, 0.373375595f},
-std::array<float,2>{0.605384409f, 0.563219368f},
-std::array<float,2>{0.393716753f, 0.978269279f},
-std::array<float,2>{0.859841704f, 0.127488852f},
-std::array<float,2>{0.323952138f, 0.0675547794f},
-std::array<float,2>{0.902420402f, 0.801542163f},
-std::array<float,2>{0.0584439263f, 0.639353037f},
-std::array<float,2>{0.715195596f, 0.405404627f},
-std::array<float,2>{0.0939943492f, 0.244270504f},
-std::array<float,2>{0.663863778f, 0.925564349f},
-std::array<float,2>{0.26857993f, 0.507576823f},
-std::array<float,2>{0.977402329f, 0.279312193f},
-std::array<float,2>{0.462535948f, 0.490312487f},
-std::array<float,2>{0.793678522f, 0.704144359f},
-std::array<float,2>{0.227190152f, 0.821634531f},
-std::array<float,2>{0.513058245f, 0.0311835203f},
-std::array<float,2>{0.0533950217f, 0.32006076f},
-std::array<float,2>{0.705068707f, 0.612056494f},
-std::array<float,2>{0.315299839f, 0.959332407f},
-std::array<float,2>{0.897063434f, 0.18530333f},
-std::array<float,2>{0.403637916f, 0.10133411f},
-std::array<float,2>{0.870401144f, 0.769581556f},
-std::array<float,2>{0.168762013f, 0.658275783f},
-std::array<float,2>{0.596857607f, 0.408287734f},
-std::array<float,2>{0.224666297f, 0.197062328f},
-std::array<float,2>{0.504367888f, 0.903766453f},
-std::array<float,2>{0.453224212f, 0.541511238f},
-std::array<float,2>{0.781481922f, 0.3041915f},
-std::array<float,2>{0.27879414f, 0.446055144f},
-std::array<float,2>{0.968999267f, 0.73019886f},
-std::array<float,2>{0.104014635f, 0.858804047f},
-std::array<float,2>{0.66611886f, 0.0592752583f},
-std::array<float,2>{0.149945602f, 0.390850633f},
-std::array<float,2>{0.588882983f, 0.632665694f},
-std::array<float,2>{0.425092876f, 0.809799552f},
-std::array<float,2>{0.818970144f, 0.0766518489f},
-std::array<float,2>{0.374082446f, 0.134449989f},
-std::array<float,2>{0.935871601f, 0.972793818f},
-std::array<float,2>{0.0184506048f, 0.576532066f},
-std::array<float,2>{0.74723804f, 0.367099941f},
-std::array<float,2>{0.0688345656f, 0.0159198921f},
-std::array<float,2>{0.639420629f, 0.815617979f},
-std::array<float,2>{0.2939502f, 0.714950502f},
-std::array<float,2>{0.943814337f, 0.492741495f},
-std::array<float,2>{0.486171484f, 0.269945025f},
-std::array<float,2>{0.757166386f, 0.514684856f},
-std::array<float,2>{0.209620625f, 0.935508788f},
-std::array<float,2>{0.556057036f, 0.238724634f},
-std::array<float,2>{0.120863229f, 0.472967535f},
-std::array<float,2>{0.683466494f, 0.692213118f},
-std::array<float,2>{0.263700128f, 0.835923553f},
-std::array<float,2>{0.990029395f, 0.00316443946f},
-std::array<float,2>{0.450017542f, 0.225893185f},
-std::array<float,2>{0.809824407f, 0.918529093f},
-std::array<float,2>{0.238375798f, 0.527681112f},
-std::array<float,2>{0.521744967f, 0.261722386f},
-std::array<float,2>{0.185243636f, 0.0858286917f},
-std::array<float,2>{0.617639244f, 0.786069036f},
-std::array<float,2>{0.386561275f, 0.647837341f},
-std::array<float,2>{0.844799876f, 0.38076216f},
-std::array<float,2>{0.334760278f, 0.344673514f},
-std::array<float,2>{0.890213966f, 0.59321028f},
-std::array<float,2>{0.0318319015f, 0.994976342f},
-std::array<float,2>{0.694713473f, 0.142456189f},
-std::array<float,2>{0.193188727f, 0.285237402f},
-std::array<float,2>{0.533671319f, 0.555180252f},
-std::array<float,2>{0.473196477f, 0.880886316f},
-std::array<float,2>{0.77002573f, 0.210451007f},
-std::array<float,2>{0.304260522f, 0.0361509658f},
-std::array<float,2>{0.95506376f, 0.861117482f},
-std::array<float,2>{0.0887700468f, 0.73937273f},
-std::array<float,2>{0.645285845f, 0.454272836f},
-std::array<float,2>{0.000101178499f, 0.162760496f},
-std::array<float,2>{0.721637845f, 0.951895833f},
-std::array<float,2>{0.355744302f, 0.608105361f},
-std::array<float,2>{0.913329899f, 0.331222475f},
-std::array<float,2>{0.417413741f, 0.425260186f},
-std::array<float,2>{0.842447996f, 0.681951404f},
-std::array<float,2>{0.127506211f, 0.764730811f},
-std::array<float,2>{0.565070271f, 0.12203712f},
-std::array<float,2>{0.0427129269f, 0.269523293f},
-std::array<float,2>{0.698304176f, 0.510322094f},
-std::array<float,2>{0.338555247f, 0.933456779f},
-std::array<float,2>{0.877759337f, 0.234383702f},
-std::array<float,2>{0.377468348f, 0.0205604713f},
-std::array<float,2>{0.85391736f, 0.818426907f},
-std::array<float,2>{0.174777985f, 0.712899804f},
-std::array<float,2>{0.613748908f, 0.499973238f},
-std::array<float,2>{0.243265152f, 0.140292376f},
-std::array<float,2>{0.52893126f, 0.969877183f},
-std::array<float,2>{0.439221472f, 0.571584463f},
-std::array<float,2>{0.803001523f, 0.362230062f},
-std::array<float,2>{0.253299356f, 0.398367643f},
-std::array<float,2>{0.999930084f, 0.627587736f},
-std::array<float,2>{0.111484505f, 0.806241393f},
-std::array<float,2>{0.675787687f, 0.0709936544f},
-std::array<float,2>{0.136287123f, 0.45117256f},
-std::array<float,2>{0.574335396f, 0.733659863f},
-std::array<float,2>{0.412612826f, 0.85445118f},
-std::array<float,2>{0.832160354f, 0.0563943759f},
-std::array<float,2>{0.350780278f, 0.200783044f},
-std::array<float,2>{0.916705489f, 0.899169266f},
-std::array<float,2>{0.0118530858f, 0.546396911f},
-std::array<float,2>{0.729702592f, 0.299500495f},
-std::array<float,2>{0.0822446644f, 0.0958170295f},
-std::array<float,2>{0.652037919f, 0.768560052f},
-std::array<float,2>{0.307853192f, 0.661107361f},
-std::array<float,2>{0.963793695f, 0.414061159f},
-std::array<float,2>{0.481750429f, 0.314127982f},
-std::array<float,2>{0.775445342f, 0.614407718f},
-std::array<float,2>{0.199075699f, 0.954797685f},
-std::array<float,2>{0.541153669f, 0.181029484f},
-std::array<float,2>{0.0986047909f, 0.429312438f},
-std::array<float,2>{0.658805609f, 0.683851838f},
-std::array<float,2>{0.272558182f, 0.760202706f},
-std::array<float,2>{0.982649565f, 0.118016414f},
-std::array<float,2>{0.467939705f, 0.160082161f},
-std::array<float,2>{0.792323112f, 0.94604069f},
-std::array<float,2>{0.231316432f, 0.601821244f},
-std::array<float,2>{0.508892536f, 0.332779825f},
-std::array<float,2>{0.158168808f, 0.0331144333f},
-std::array<float,2>{0.606195509f, 0.864893496f},
-std::array<float,2>{0.394718438f, 0.736437619f},
-std::array<float,2>{0.86535728f, 0.457597911f},
-std::array<float,2>{0.326615423f, 0.283625543f},
-std::array<float,2>{0.899676442f, 0.562445879f},
-std::array<float,2>{0.0624301322f, 0.87513572f},
-std::array<float,2>{0.713953614f, 0.206300527f},
-std::array<float,2>{0.211081982f, 0.348801762f},
-std::array<float,2>{0.548178017f, 0.58815515f},
-std::array<float,2>{0.496064484f, 0.998522997f},
-std::array<float,2>{0.758927464f, 0.147087395f},
-std::array<float,2>{0.287048489f, 0.0790281147f},
-std::array<float,2>{0.9511621f, 0.783541501f},
-std::array<float,2>{0.0714557245f, 0.642518401f},
-std::array<float,2>{0.631700754f, 0.376426846f},
-std::array<float,2>{0.0309098251f, 0.221572965f},
-std::array<float,2>{0.740242183f, 0.914880991f},
-std::array<float,2>{0.363563657f, 0.525632918f},
-std::array<float,2>{0.923724711f, 0.25921905f},
-std::array<float,2>{0.430488378f, 0.469498396f},
-std::array<float,2>{0.82692802f, 0.690548241f},
-std::array<float,2>{0.146507978f, 0.828271747f},
-std::array<float,2>{0.585868299f, 0.00422488712f},
-std::array<float,2>{0.0642611235f, 0.341218054f},
-std::array<float,2>{0.634135127f, 0.595557332f},
-std::array<float,2>{0.290369421f, 0.940345526f},
-std::array<float,2>{0.937678397f, 0.167022064f},
-std::array<float,2>{0.488308132f, 0.116462059f},
-std::array<float,2>{0.750470519f, 0.751992941f},
-std::array<float,2>{0.206938177f, 0.673496842f},
-std::array<float,2>{0.560474932f, 0.434301078f},
-std::array<float,2>{0.154561475f, 0.212449312f},
-std::array<float,2>{0.59274143f, 0.886558473f},
-std::array<float,2>{0.429012656f, 0.551949322f},
-std::array<float,2>{0.815920651f, 0.295208335f},
-std::array<float,2>{0.37018767f, 0.464725107f},
-std::array<float,2>{0.931555212f, 0.748991013f},
-std::array<float,2>{0.0202068333f, 0.870705545f},
-std::array<float,2>{0.744416177f, 0.0439285152f},
-std::array<float,2>{0.220919877f, 0.389835626f},
-std::array<float,2>{0.501592398f, 0.654544175f},
-std::array<float,2>{0.460391998f, 0.791823387f},
-std::array<float,2>{0.785939872f, 0.0897067562f},
-std::array<float,2>{0.274700522f, 0.154608667f},
-std::array<float,2>{0.975663185f, 0.986644745f},
-std::array<float,2>{0.107789502f, 0.584068418f},
-std::array<float,2>{0.670199811f, 0.351863384f},
-std::array<float,2>{0.0481715463f, 0.0130506195f},
-std::array<float,2>{0.708136678f, 0.843294024f},
-std::array<float,2>{0.316804677f, 0.699673831f},
-std::array<float,2>{0.891616344f, 0.478489578f},
-std::array<float,2>{0.399723023f, 0.253681421f},
-std::array<float,2>{0.874736726f, 0.519091785f},
-std::array<float,2>{0.164597571f, 0.913153529f},
-std::array<float,2>{0.59815073f, 0.231779844f},
-std::array<float,2>{0.00756073417f, 0.485606641f},
-std::array<float,2>{0.726287663f, 0.70848465f},
-std::array<float,2>{0.353032649f, 0.827545762f},
-std::array<float,2>{0.908433676f, 0.02584837f},
-std::array<float,2>{0.418384016f, 0.247307107f},
-std::array<float,2>{0.836203814f, 0.926084399f},
-std::array<float,2>{0.131217778f, 0.502698362f},
-std::array<float,2>{0.567474008f, 0.276094645f},
-std::array<float,2>{0.190140024f, 0.0641222745f},
-std::array<float,2>{0.53542316f, 0.797647178f},
-std::array<float,2>{0.469166756f, 0.636250913f},
-std::array<float,2>{0.765795708f, 0.399022818f},
-std::array<float,2>{0.298014194f, 0.370981693f},
-std::array<float,2>{0.957140923f, 0.57030189f},
-std::array<float,2>{0.0934324339f, 0.981541634f},
-std::array<float,2>{0.64212513f, 0.131229058f},
-std::array<float,2>{0.180688038f, 0.306254596f},
-std::array<float,2>{0.624079823f, 0.537088215f},
-std::array<float,2>{0.386825293f, 0.893453002f},
-std::array<float,2>{0.847794175f, 0.192681387f},
-std::array<float,2>{0.329390317f, 0.0537084341f},
-std::array<float,2>{0.885983706f, 0.851000011f},
-std::array<float,2>{0.037940748f, 0.721851289f},
-std::array<float,2>{0.688309908f, 0.442960978f},
-std::array<float,2>{0.121403627f, 0.176652223f},
-std::array<float,2>{0.684937954f, 0.967525721f},
-std::array<float,2>{0.257845074f, 0.620856881f},
-std::array<float,2>{0.984461427f, 0.324250907f},
-std::array<float,2>{0.44623524f, 0.420080125f},
-std::array<float,2>{0.805732071f, 0.665768504f},
-std::array<float,2>{0.237210318f, 0.779302001f},
-std::array<float,2>{0.516409695f, 0.105172314f},
-std::array<float,2>{0.113462858f, 0.289954454f},
-std::array<float,2>{0.673073888f, 0.547599316f},
-std::array<float,2>{0.257193059f, 0.886815667f},
-std::array<float,2>{0.995293379f, 0.215213716f},
-std::array<float,2>{0.44262141f, 0.0424976945f},
-std::array<float,2>{0.800058842f, 0.87202996f},
-std::array<float,2>{0.246870309f, 0.745482683f},
-std::array<float,2>{0.523525834f, 0.4684605f},
-std::array<float,2>{0.176272631f, 0.170843542f},
-std::array<float,2>{0.611517191f, 0.945010662f},
-std::array<float,2>{0.380907267f, 0.600826621f},
-std::array<float,2>{0.85813725f, 0.339269727f},
-std::array<float,2>{0.340264499f, 0.433170915f},
-std::array<float,2>{0.881472409f, 0.679274857f},
-std::array<float,2>{0.0444106199f, 0.754352868f},
-std::array<float,2>{0.69982183f, 0.113172069f},
-std::array<float,2>{0.200435758f, 0.482200325f},
-std::array<float,2>{0.543034434f, 0.697035491f},
-std::array<float,2>{0.477774054f, 0.83857125f},
-std::array<float,2>{0.781115174f, 0.00923940726f},
-std::array<float,2>{0.309794575f, 0.228264675f},
-std::array<float,2>{0.968609333f, 0.907425642f},
-std::array<float,2>{0.0796970725f, 0.522147059f},
-std::array<float,2>{0.655260921f, 0.254420757f},
-std::array<float,2>{0.0112152714f, 0.0905213356f},
-std::array<float,2>{0.73095715f, 0.793474019f},
-std::array<float,2>{0.344644606f, 0.650893331f},
-std::array<float,2>{0.920564473f, 0.383550316f},
-std::array<float,2>{0.409695774f, 0.359277397f},
-std::array<float,2>{0.831990302f, 0.581130087f},
-std::array<float,2>{0.140099943f, 0.988984108f},
-std::array<float,2>{0.573477983f, 0.149642482f},
-std::array<float,2>{0.0562607497f, 0.402952313f},
-std::array<float,2>{0.717091978f, 0.638485372f},
-std::array<float,2>{0.32148087f, 0.803955615f},
-std::array<float,2>{0.905350864f, 0.0688078329f},
-std::array<float,2>{0.391716957f, 0.126387253f},
-std::array<float,2>{0.863059938f, 0.980071962f},
-std::array<float,2>{0.16393739f, 0.56560111f},
-std::array<float,2>{0.601792216f, 0.372906983f},
-std::array<float,2>{0.230417594f, 0.0287726987f},
-std::array<float,2>{0.515014052f, 0.822599113f},
-std::array<float,2>{0.464614242f, 0.706991792f},
-std::array<float,2>{0.794998109f, 0.488850862f},
-std::array<float,2>{0.266789228f, 0.27887404f},
-std::array<float,2>{0.980171502f, 0.504337132f},
-std::array<float,2>{0.0973142982f, 0.922286093f},
-std::array<float,2>{0.661203027f, 0.24289465f},
-std::array<float,2>{0.143767715f, 0.322888404f},
-std::array<float,2>{0.58123827f, 0.622332215f},
-std::array<float,2>{0.436567903f, 0.964399636f},
-std::array<float,2>{0.824079692f, 0.172166631f},
-std::array<float,2>{0.359564155f, 0.106052257f},
-std::array<float,2>{0.927397788f, 0.775805771f},
-std::array<float,2>{0.0271329097f, 0.670051515f},
-std::array<float,2>{0.735070527f, 0.416849464f},
-std::array<float,2>{0.0769274086f, 0.190246806f},
-std::array<float,2>{0.62719059f, 0.897510827f},
-std::array<float,2>{0.281338036f, 0.532389164f},
-std::array<float,2>{0.948373079f, 0.308655232f},
-std::array<float,2>{0.496150464f, 0.438536853f},
-std::array<float,2>{0.76213485f, 0.725012183f},
-std::array<float,2>{0.216475993f, 0.845711231f},
-std::array<float,2>{0.554450631f, 0.0481218547f},
-std::array<float,2>{0.0174790751f, 0.365105093f},
-std::array<float,2>{0.748399973f, 0.574398875f},
-std::array<float,2>{0.372710347f, 0.974905193f},
-std::array<float,2>{0.934604108f, 0.135853425f},
-std::array<float,2>{0.422458291f, 0.0756132975f},
-std::array<float,2>{0.817584753f, 0.811499059f},
-std::array<float,2>{0.151114151f, 0.629284382f},
-std::array<float,2>{0.586480379f, 0.393372178f},
-std::array<float,2>{0.207917541f, 0.241272703f},
-std::array<float,2>{0.556921303f, 0.936591566f},
-std::array<float,2>{0.487548023f, 0.512418568f},
-std::array<float,2>{0.75454098f, 0.271808088f},
-std::array<float,2>{0.295793593f, 0.495207518f},
-std::array<float,2>{0.942016959f, 0.717031956f},
-std::array<float,2>{0.0667732209f, 0.814185858f},
-std::array<float,2>{0.63685596f, 0.0177777559f},
-std::array<float,2>{0.170094058f, 0.406980008f},
-std::array<float,2>{0.595647573f, 0.65763247f},
-std::array<float,2>{0.404652566f, 0.771666646f},
-std::array<float,2>{0.867508292f, 0.099334076f},
-std::array<float,2>{0.314108312f, 0.185700923f},
-std::array<float,2>{0.896287799f, 0.957047939f},
-std::array<float,2>{0.0515061989f, 0.610405445f},
-std::array<float,2>{0.706322253f, 0.317620039f},
-std::array<float,2>{0.102693319f, 0.0620828867f},
-std::array<float,2>{0.664326191f, 0.855866671f},
-std::array<float,2>{0.280139446f, 0.727881968f},
-std::array<float,2>{0.971883774f, 0.448058158f},
-std::array<float,2>{0.456835002f, 0.301564455f},
-std::array<float,2>{0.784554839f, 0.539883137f},
-std::array<float,2>{0.223435998f, 0.904462755f},
-std::array<float,2>{0.506902993f, 0.198805243f},
-std::array<float,2>{0.087630026f, 0.455565631f},
-std::array<float,2>{0.648241639f, 0.741987765f},
-std::array<float,2>{0.301225811f, 0.861729443f},
-std::array<float,2>{0.956299901f, 0.0384550989f},
-std::array<float,2>{0.476458102f, 0.207631737f},
-std::array<float,2>{0.772983253f, 0.880766749f},
-std::array<float,2>{0.195229799f, 0.558128834f},
-std::array<float,2>{0.533144891f, 0.287448376f},
-std::array<float,2>{0.125816956f, 0.123480186f},
-std::array<float,2>{0.562970936f, 0.762112021f},
-std::array<float,2>{0.415061831f, 0.680122435f},
-std::array<float,2>{0.840575695f, 0.42310527f},
-std::array<float,2>{0.358733326f, 0.328896821f},
-std::array<float,2>{0.910550416f, 0.606211364f},
-std::array<float,2>{0.00219243648f, 0.949842453f},
-std::array<float,2>{0.718898177f, 0.161279529f},
-std::array<float,2>{0.241375193f, 0.263783216f},
-std::array<float,2>{0.520456791f, 0.529556572f},
-std::array<float,2>{0.453011006f, 0.920677722f},
-std::array<float,2>{0.812053978f, 0.224071696f},
-std::array<float,2>{0.261956066f, 0.00140368682f},
-std::array<float,2>{0.990647912f, 0.832243681f},
-std::array<float,2>{0.118012778f, 0.694209576f},
-std::array<float,2>{0.680696428f, 0.475913495f},
-std::array<float,2>{0.0347834714f, 0.144044101f},
-std::array<float,2>{0.691691995f, 0.992330015f},
-std::array<float,2>{0.332091242f, 0.591608584f},
-std::array<float,2>{0.888127863f, 0.346354723f},
-std::array<float,2>{0.383959502f, 0.382407933f},
-std::array<float,2>{0.846793294f, 0.645117044f},
-std::array<float,2>{0.187354401f, 0.788850725f},
-std::array<float,2>{0.620707691f, 0.0823857263f},
-std::array<float,2>{0.00543395383f, 0.275675058f},
-std::array<float,2>{0.722748756f, 0.502234042f},
-std::array<float,2>{0.354825228f, 0.926589668f},
-std::array<float,2>{0.907070696f, 0.247955784f},
-std::array<float,2>{0.421868265f, 0.0260061491f},
-std::array<float,2>{0.839522183f, 0.827678025f},
-std::array<float,2>{0.13026005f, 0.708801687f},
-std::array<float,2>{0.568840683f, 0.486325085f},
-std::array<float,2>{0.189023465f, 0.131780684f},
-std::array<float,2>{0.537284732f, 0.982249022f},
-std::array<float,2>{0.472175688f, 0.569416344f},
-std::array<float,2>{0.768192768f, 0.370139897f},
-std::array<float,2>{0.299596459f, 0.398579836f},
-std::array<float,2>{0.95969969f, 0.635954559f},
-std::array<float,2>{0.0914983675f, 0.797186613f},
-std::array<float,2>{0.642634749f, 0.0638538972f},
-std::array<float,2>{0.181953609f, 0.442763805f},
-std::array<float,2>{0.622323692f, 0.722647488f},
-std::array<float,2>{0.388921022f, 0.851467192f},
-std::array<float,2>{0.850112379f, 0.0528136007f},
-std::array<float,2>{0.330304325f, 0.193030775f},
-std::array<float,2>{0.884388089f, 0.892581284f},
-std::array<float,2>{0.0358774029f, 0.536377907f},
-std::array<float,2>{0.691192865f, 0.306139112f},
-std::array<float,2>{0.124957457f, 0.104604013f},
-std::array<float,2>{0.687100947f, 0.780092001f},
-std::array<float,2>{0.260772109f, 0.665427387f},
-std::array<float,2>{0.986804545f, 0.420671731f},
-std::array<float,2>{0.449173987f, 0.324877143f},
-std::array<float,2>{0.806992769f, 0.620530248f},
-std::array<float,2>{0.234827176f, 0.966879189f},
-std::array<float,2>{0.518743277f, 0.175855562f},
-std::array<float,2>{0.0650657564f, 0.433991224f},
-std::array<float,2>{0.636365116f, 0.673054516f},
-std::array<float,2>{0.291911155f, 0.752505124f},
-std::array<float,2>{0.940153122f, 0.116937786f},
-std::array<float,2>{0.491619706f, 0.167851269f},
-std::array<float,2>{0.753277898f, 0.939655423f},
-std::array<float,2>{0.203382254f, 0.595045269f},
-std::array<float,2>{0.561604738f, 0.34170875f},
-std::array<float,2>{0.153179675f, 0.0433601923f},
-std::array<float,2>{0.59063077f, 0.870365381f},
-std::array<float,2>{0.42731294f, 0.74811089f},
-std::array<float,2>{0.813263535f, 0.464194953f},
-std::array<float,2>{0.368243337f, 0.29551217f},
-std::array<float,2>{0.932136714f, 0.552374482f},
-std::array<float,2>{0.0229708813f, 0.886221409f},
-std::array<float,2>{0.743910551f, 0.211993724f},
-std::array<float,2>{0.21973744f, 0.352203041f},
-std::array<float,2>{0.503653586f, 0.584723353f},
-std::array<float,2>{0.457321137f, 0.986834586f},
-std::array<float,2>{0.788889349f, 0.155108005f},
-std::array<float,2>{0.277215838f, 0.0892918929f},
-std::array<float,2>{0.974409878f, 0.791264892f},
-std::array<float,2>{0.105962187f, 0.654812098f},
-std::array<float,2>{0.669508576f, 0.390464276f},
-std::array<float,2>{0.049546659f, 0.232403263f},
-std::array<float,2>{0.70985502f, 0.913660467f},
-std::array<float,2>{0.319747597f, 0.518732607f},
-std::array<float,2>{0.893918037f, 0.253303528f},
-std::array<float,2>{0.401385248f, 0.477577269f},
-std::array<float,2>{0.871291637f, 0.699842453f},
-std::array<float,2>{0.167114466f, 0.842860818f},
-std::array<float,2>{0.600412786f, 0.0134972231f},
-std::array<float,2>{0.101169832f, 0.332327217f},
-std::array<float,2>{0.656620681f, 0.602388442f},
-std::array<float,2>{0.270665586f, 0.945487618f},
-std::array<float,2>{0.981115401f, 0.159620792f},
-std::array<float,2>{0.465799123f, 0.117487103f},
-std::array<float,2>{0.790221214f, 0.760548234f},
-std::array<float,2>{0.233531818f, 0.684349f},
-std::array<float,2>{0.510044277f, 0.428763121f},
-std::array<float,2>{0.158937722f, 0.20701015f},
-std::array<float,2>{0.608458221f, 0.875854373f},
-std::array<float,2>{0.397960395f, 0.561542869f},
-std::array<float,2>{0.863902867f, 0.283783168f},
-std::array<float,2>{0.324440986f, 0.457105517f},
-std::array<float,2>{0.901666641f, 0.73711282f},
-std::array<float,2>{0.0589878187f, 0.864717245f},
-std::array<float,2>{0.712513089f, 0.032391239f},
-std::array<float,2>{0.213767827f, 0.376782626f},
-std::array<float,2>{0.550563753f, 0.642047107f},
-std::array<float,2>{0.492533147f, 0.783776224f},
-std::array<float,2>{0.761028349f, 0.0784642249f},
-std::array<float,2>{0.288954705f, 0.146579757f},
-std::array<float,2>{0.952385783f, 0.99853915f},
-std::array<float,2>{0.0730299205f, 0.588452101f},
-std::array<float,2>{0.630477965f, 0.34922272f},
-std::array<float,2>{0.0291617382f, 0.00478151347f},
-std::array<float,2>{0.739848256f, 0.828732431f},
-std::array<float,2>{0.36577183f, 0.691245914f},
-std::array<float,2>{0.925306976f, 0.469169408f},
-std::array<float,2>{0.433355629f, 0.25944832f},
-std::array<float,2>{0.825894296f, 0.526120245f},
-std::array<float,2>{0.146393776f, 0.914118052f},
-std::array<float,2>{0.58319068f, 0.220825627f},
-std::array<float,2>{0.0393244363f, 0.499366611f},
-std::array<float,2>{0.696872532f, 0.713667631f},
-std::array<float,2>{0.336435318f, 0.818945885f},
-std::array<float,2>{0.876036346f, 0.0212522931f},
-std::array<float,2>{0.375499129f, 0.23526749f},
-std::array<float,2>{0.852746964f, 0.932727814f},
-std::array<float,2>{0.172005326f, 0.51003319f},
-std::array<float,2>{0.616669893f, 0.269002557f},
-std::array<float,2>{0.245574728f, 0.0706282929f},
-std::array<float,2>{0.529504478f, 0.805936635f},
-std::array<float,2>{0.439911276f, 0.627204835f},
-std::array<float,2>{0.801567554f, 0.397813797f},
-std::array<float,2>{0.25045523f, 0.361696362f},
-std::array<float,2>{0.998007476f, 0.572052419f},
-std::array<float,2>{0.109411895f, 0.970416367f},
-std::array<float,2>{0.67960602f, 0.139867976f},
-std::array<float,2>{0.134678692f, 0.298936099f},
-std::array<float,2>{0.57663393f, 0.54610604f},
-std::array<float,2>{0.41118443f, 0.898836911f},
-std::array<float,2>{0.834168017f, 0.200639606f},
-std::array<float,2>{0.348011971f, 0.0561470501f},
-std::array<float,2>{0.915529013f, 0.853733242f},
-std::array<float,2>{0.0146859176f, 0.734267831f},
-std::array<float,2>{0.727963805f, 0.451752543f},
-std::array<float,2>{0.0848825499f, 0.18123132f},
-std::array<float,2>{0.648550451f, 0.954586744f},
-std::array<float,2>{0.30556637f, 0.61521095f},
-std::array<float,2>{0.962097824f, 0.313617706f},
-std::array<float,2>{0.484226704f, 0.413094282f},
-std::array<float,2>{0.773643792f, 0.660580575f},
-std::array<float,2>{0.197196335f, 0.769072533f},
-std::array<float,2>{0.540522873f, 0.0963010862f},
-std::array<float,2>{0.0880479068f, 0.28793174f},
-std::array<float,2>{0.644922316f, 0.55797255f},
-std::array<float,2>{0.303893715f, 0.88013649f},
-std::array<float,2>{0.954486549f, 0.207118794f},
-std::array<float,2>{0.472961128f, 0.0388052799f},
-std::array<float,2>{0.769576728f, 0.861834407f},
-std::array<float,2>{0.192399234f, 0.741584957f},
-std::array<float,2>{0.534157395f, 0.456001878f},
-std::array<float,2>{0.126999155f, 0.161905736f},
-std::array<float,2>{0.564533532f, 0.949594259f},
-std::array<float,2>{0.417702645f, 0.605792761f},
-std::array<float,2>{0.842206776f, 0.328596473f},
-std::array<float,2>{0.356357515f, 0.423598289f},
-std::array<float,2>{0.913855374f, 0.680325687f},
-std::array<float,2>{0.000934162643f, 0.762383997f},
-std::array<float,2>{0.720945418f, 0.123953335f},
-std::array<float,2>{0.238852948f, 0.476393163f},
-std::array<float,2>{0.522311509f, 0.693498194f},
-std::array<float,2>{0.449401081f, 0.832817376f},
-std::array<float,2>{0.810517609f, 0.00157915836f},
-std::array<float,2>{0.264478654f, 0.224298149f},
-std::array<float,2>{0.989576221f, 0.920007885f},
-std::array<float,2>{0.120313309f, 0.529794991f},
-std::array<float,2>{0.682751477f, 0.264429569f},
-std::array<float,2>{0.0314250588f, 0.0828287676f},
-std::array<float,2>{0.695108533f, 0.788384616f},
-std::array<float,2>{0.334244877f, 0.644633651f},
-std::array<float,2>{0.890066326f, 0.38198939f},
-std::array<float,2>{0.386061817f, 0.345787197f},
-std::array<float,2>{0.845517874f, 0.591193914f},
-std::array<float,2>{0.184721336f, 0.992786646f},
-std::array<float,2>{0.617848754f, 0.143888265f},
-std::array<float,2>{0.0178170074f, 0.392908692f},
-std::array<float,2>{0.74801755f, 0.62946707f},
-std::array<float,2>{0.374748051f, 0.811017096f},
-std::array<float,2>{0.936509907f, 0.0760245994f},
-std::array<float,2>{0.425471902f, 0.136642843f},
-std::array<float,2>{0.818659067f, 0.975227892f},
-std::array<float,2>{0.149847031f, 0.575148344f},
-std::array<float,2>{0.589778364f, 0.364469975f},
-std::array<float,2>{0.209231734f, 0.018377509f},
-std::array<float,2>{0.556572199f, 0.813553631f},
-std::array<float,2>{0.485379517f, 0.717468798f},
-std::array<float,2>{0.757567525f, 0.495886743f},
-std::array<float,2>{0.294701725f, 0.272457957f},
-std::array<float,2>{0.943912506f, 0.512109816f},
-std::array<float,2>{0.069028981f, 0.937315822f},
-std::array<float,2>{0.639137387f, 0.24208191f},
-std::array<float,2>{0.168099925f, 0.318272978f},
-std::array<float,2>{0.597399592f, 0.611075997f},
-std::array<float,2>{0.403845936f, 0.957579255f},
-std::array<float,2>{0.870615602f, 0.186351329f},
-std::array<float,2>{0.314629763f, 0.0989388451f},
-std::array<float,2>{0.896488309f, 0.772216856f},
-std::array<float,2>{0.0528460406f, 0.657915115f},
-std::array<float,2>{0.704501331f, 0.406536549f},
-std::array<float,2>{0.103570335f, 0.198685482f},
-std::array<float,2>{0.66667521f, 0.905068874f},
-std::array<float,2>{0.279048115f, 0.539458454f},
-std::array<float,2>{0.969716191f, 0.301068783f},
-std::array<float,2>{0.453877032f, 0.447347164f},
-std::array<float,2>{0.782187521f, 0.72841835f},
-std::array<float,2>{0.225572482f, 0.856350124f},
-std::array<float,2>{0.50485456f, 0.0615692213f},
-std::array<float,2>{0.0580776781f, 0.372386307f},
-std::array<float,2>{0.715682387f, 0.566171169f},
-std::array<float,2>{0.323558778f, 0.979667723f},
-std::array<float,2>{0.903196394f, 0.126895919f},
-std::array<float,2>{0.394384682f, 0.0691500977f},
-std::array<float,2>{0.860128284f, 0.804469705f},
-std::array<float,2>{0.160307005f, 0.638137519f},
-std::array<float,2>{0.60456121f, 0.402624011f},
-std::array<float,2>{0.226903364f, 0.242643788f},
-std::array<float,2>{0.513480961f, 0.922566772f},
-std::array<float,2>{0.462158114f, 0.504548967f},
-std::array<float,2>{0.792970002f, 0.278410435f},
-std::array<float,2>{0.269283503f, 0.488521606f},
-std::array<float,2>{0.976884484f, 0.706291556f},
-std::array<float,2>{0.0942751691f, 0.823232234f},
-std::array<float,2>{0.663543403f, 0.0292875748f},
-std::array<float,2>{0.141480163f, 0.416187584f},
-std::array<float,2>{0.579179227f, 0.670871139f},
-std::array<float,2>{0.435013711f, 0.776083827f},
-std::array<float,2>{0.821775913f, 0.105521567f},
-std::array<float,2>{0.362692446f, 0.172417894f},
-std::array<float,2>{0.928157449f, 0.964302838f},
-std::array<float,2>{0.024202561f, 0.622637272f},
-std::array<float,2>{0.736819386f, 0.32243669f},
-std::array<float,2>{0.0747330785f, 0.0486299694f},
-std::array<float,2>{0.626862824f, 0.846211553f},
-std::array<float,2>{0.284595609f, 0.72542882f},
-std::array<float,2>{0.946367383f, 0.439110875f},
-std::array<float,2>{0.499030888f, 0.309305131f},
-std::array<float,2>{0.765202641f, 0.533163905f},
-std::array<float,2>{0.218221053f, 0.898163617f},
-std::array<float,2>{0.550831258f, 0.189768761f},
-std::array<float,2>{0.116650291f, 0.467855215f},
-std::array<float,2>{0.674090981f, 0.745805144f},
-std::array<float,2>{0.254198432f, 0.87124294f},
-std::array<float,2>{0.993300259f, 0.0421681367f},
-std::array<float,2>{0.443656117f, 0.215546235f},
-std::array<float,2>{0.798686981f, 0.887616575f},
-std::array<float,2>{0.249904066f, 0.547231555f},
-std::array<float,2>{0.5271734f, 0.289435595f},
-std::array<float,2>{0.179256558f, 0.112738349f},
-std::array<float,2>{0.610300601f, 0.754857421f},
-std::array<float,2>{0.379581124f, 0.678959727f},
-std::array<float,2>{0.856653094f, 0.432796627f},
-std::array<float,2>{0.343078196f, 0.339607447f},
-std::array<float,2>{0.880250752f, 0.60134083f},
-std::array<float,2>{0.0468497761f, 0.944637001f},
-std::array<float,2>{0.702752173f, 0.170322433f},
-std::array<float,2>{0.201853275f, 0.254349142f},
-std::array<float,2>{0.54607141f, 0.521582425f},
-std::array<float,2>{0.480026752f, 0.908170104f},
-std::array<float,2>{0.77790153f, 0.22769551f},
-std::array<float,2>{0.312375605f, 0.00951298326f},
-std::array<float,2>{0.965534866f, 0.838143945f},
-std::array<float,2>{0.0803300962f, 0.696703017f},
-std::array<float,2>{0.653307617f, 0.48165521f},
-std::array<float,2>{0.00793896709f, 0.150236428f},
-std::array<float,2>{0.733580291f, 0.988373518f},
-std::array<float,2>{0.346925735f, 0.582015336f},
-std::array<float,2>{0.919210374f, 0.358614564f},
-std::array<float,2>{0.408045709f, 0.38294524f},
-std::array<float,2>{0.828606367f, 0.650475144f},
-std::array<float,2>{0.137826234f, 0.793159485f},
-std::array<float,2>{0.571913004f, 0.0903220475f},
-std::array<float,2>{0.037516918f, 0.306687176f},
-std::array<float,2>{0.687669814f, 0.537697434f},
-std::array<float,2>{0.329795361f, 0.892029822f},
-std::array<float,2>{0.886631131f, 0.195234761f},
-std::array<float,2>{0.387659311f, 0.0520370677f},
-std::array<float,2>{0.848409832f, 0.848317981f},
-std::array<float,2>{0.181340888f, 0.719371915f},
-std::array<float,2>{0.6247437f, 0.443808258f},
-std::array<float,2>{0.236733913f, 0.178405881f},
-std::array<float,2>{0.515666246f, 0.965870619f},
-std::array<float,2>{0.445596129f, 0.617432892f},
-std::array<float,2>{0.806387544f, 0.326960713f},
-std::array<float,2>{0.258636594f, 0.419871479f},
-std::array<float,2>{0.984894276f, 0.66638273f},
-std::array<float,2>{0.121899404f, 0.778570116f},
-std::array<float,2>{0.685113132f, 0.103270262f},
-std::array<float,2>{0.131695598f, 0.486377865f},
-std::array<float,2>{0.568014622f, 0.710434556f},
-std::array<float,2>{0.418826342f, 0.825110912f},
-std::array<float,2>{0.836811185f, 0.0247731525f},
-std::array<float,2>{0.35285303f, 0.249712855f},
-std::array<float,2>{0.909145534f, 0.928610444f},
-std::array<float,2>{0.00718020694f, 0.501597166f},
-std::array<float,2>{0.725668848f, 0.274896175f},
-std::array<float,2>{0.0930490792f, 0.0650646463f},
-std::array<float,2>{0.642032146f, 0.800141454f},
-std::array<float,2>{0.298681051f, 0.633512795f},
-std::array<float,2>{0.957737029f, 0.401236027f},
-std::array<float,2>{0.469626576f, 0.369059265f},
-std::array<float,2>{0.7665205f, 0.567516804f},
-std::array<float,2>{0.189780369f, 0.982716262f},
-std::array<float,2>{0.535823882f, 0.129085258f},
-std::array<float,2>{0.108353175f, 0.388643444f},
-std::array<float,2>{0.670808196f, 0.653799832f},
-std::array<float,2>{0.274959773f, 0.789763153f},
-std::array<float,2>{0.976198196f, 0.0860911533f},
-std::array<float,2>{0.460917741f, 0.154205397f},
-std::array<float,2>{0.785287738f, 0.985225618f},
-std::array<float,2>{0.221506864f, 0.582694173f},
-std::array<float,2>{0.501451552f, 0.353796244f},
-std::array<float,2>{0.164092705f, 0.0151746143f},
-std::array<float,2>{0.598065794f, 0.840570807f},
-std::array<float,2>{0.400251061f, 0.703016043f},
-std::array<float,2>{0.874240637f, 0.480298519f},
-std::array<float,2>{0.317352712f, 0.250175357f},
-std::array<float,2>{0.892470121f, 0.516158283f},
-std::array<float,2>{0.0487939604f, 0.911784947f},
-std::array<float,2>{0.708860397f, 0.233124897f},
-std::array<float,2>{0.206492886f, 0.343211442f},
-std::array<float,2>{0.559728026f, 0.595939338f},
-std::array<float,2>{0.488800049f, 0.937579811f},
-std::array<float,2>{0.7508021f, 0.165455729f},
-std::array<float,2>{0.290965676f, 0.114931777f},
-std::array<float,2>{0.938160837f, 0.751001179f},
-std::array<float,2>{0.0637673289f, 0.674659908f},
-std::array<float,2>{0.634665489f, 0.436780185f},
-std::array<float,2>{0.0197041258f, 0.214737639f},
-std::array<float,2>{0.744969606f, 0.884453237f},
-std::array<float,2>{0.370705098f, 0.553657532f},
-std::array<float,2>{0.930695772f, 0.294919133f},
-std::array<float,2>{0.429473102f, 0.461994737f},
-std::array<float,2>{0.815799296f, 0.746882081f},
-std::array<float,2>{0.154919475f, 0.869002044f},
-std::array<float,2>{0.592187345f, 0.0456804186f},
-std::array<float,2>{0.0720087588f, 0.350927204f},
-std::array<float,2>{0.631045818f, 0.587254584f},
-std::array<float,2>{0.286239028f, 0.996803939f},
-std::array<float,2>{0.950408518f, 0.145064175f},
-std::array<float,2>{0.495119691f, 0.0803490728f},
-std::array<float,2>{0.759346902f, 0.781287909f},
-std::array<float,2>{0.211770296f, 0.643513203f},
-std::array<float,2>{0.548811138f, 0.377162278f},
-std::array<float,2>{0.147208825f, 0.218885854f},
-std::array<float,2>{0.585101962f, 0.916078389f},
-std::array<float,2>{0.430098385f, 0.524958253f},
-std::array<float,2>{0.826401651f, 0.259844333f},
-std::array<float,2>{0.363999933f, 0.472280353f},
-std::array<float,2>{0.923140228f, 0.688169956f},
-std::array<float,2>{0.0302785542f, 0.831100166f},
-std::array<float,2>{0.741142213f, 0.00613971753f},
-std::array<float,2>{0.230604976f, 0.425953865f},
-std::array<float,2>{0.50939095f, 0.687157989f},
-std::array<float,2>{0.46847415f, 0.759558678f},
-std::array<float,2>{0.792651057f, 0.120363355f},
-std::array<float,2>{0.273379177f, 0.157933503f},
-std::array<float,2>{0.983271599f, 0.947509348f},
-std::array<float,2>{0.0979451761f, 0.604934275f},
-std::array<float,2>{0.658213198f, 0.334275424f},
-std::array<float,2>{0.0619785152f, 0.0343300477f},
-std::array<float,2>{0.714458466f, 0.866672933f},
-std::array<float,2>{0.327091813f, 0.736297786f},
-std::array<float,2>{0.899964213f, 0.460156083f},
-std::array<float,2>{0.395324469f, 0.281945735f},
-std::array<float,2>{0.865772605f, 0.5587883f},
-std::array<float,2>{0.157709047f, 0.878095925f},
-std::array<float,2>{0.60575211f, 0.203256235f},
-std::array<float,2>{0.0123199206f, 0.450469911f},
-std::array<float,2>{0.730353296f, 0.73179251f},
-std::array<float,2>{0.351099908f, 0.853001237f},
-std::array<float,2>{0.916120529f, 0.0568212382f},
-std::array<float,2>{0.412291527f, 0.203062803f},
-std::array<float,2>{0.832677722f, 0.902013242f},
-std::array<float,2>{0.136129901f, 0.543677866f},
-std::array<float,2>{0.574992657f, 0.297126293f},
-std::array<float,2>{0.198368117f, 0.0939231515f},
-std::array<float,2>{0.541612685f, 0.765697598f},
-std::array<float,2>{0.482014209f, 0.662297666f},
-std::array<float,2>{0.776286006f, 0.411457896f},
-std::array<float,2>{0.308418602f, 0.316151142f},
-std::array<float,2>{0.963103652f, 0.616206348f},
-std::array<float,2>{0.0825568363f, 0.956635118f},
-std::array<float,2>{0.651480377f, 0.183319077f},
-std::array<float,2>{0.174258456f, 0.267162383f},
-std::array<float,2>{0.613941729f, 0.508182347f},
-std::array<float,2>{0.377035916f, 0.931235313f},
-std::array<float,2>{0.854303122f, 0.237001285f},
-std::array<float,2>{0.338157803f, 0.0216455013f},
-std::array<float,2>{0.877044678f, 0.818084896f},
-std::array<float,2>{0.0422030725f, 0.712380469f},
-std::array<float,2>{0.699156642f, 0.497542322f},
-std::array<float,2>{0.112116292f, 0.138505027f},
-std::array<float,2>{0.676282644f, 0.971393764f},
-std::array<float,2>{0.253863245f, 0.573716521f},
-std::array<float,2>{0.99918139f, 0.360984564f},
-std::array<float,2>{0.438565999f, 0.395075679f},
-std::array<float,2>{0.803264439f, 0.625469387f},
-std::array<float,2>{0.243725687f, 0.806858838f},
-std::array<float,2>{0.528721035f, 0.0731783807f},
-std::array<float,2>{0.117626481f, 0.262479812f},
-std::array<float,2>{0.681234837f, 0.528234899f},
-std::array<float,2>{0.262223989f, 0.918219745f},
-std::array<float,2>{0.99095428f, 0.226429388f},
-std::array<float,2>{0.452468097f, 0.00375542114f},
-std::array<float,2>{0.811793387f, 0.835256457f},
-std::array<float,2>{0.241819829f, 0.691706657f},
-std::array<float,2>{0.51995635f, 0.473401576f},
-std::array<float,2>{0.186546266f, 0.141916454f},
-std::array<float,2>{0.620577037f, 0.994460285f},
-std::array<float,2>{0.384441733f, 0.593650579f},
-std::array<float,2>{0.847187817f, 0.343806207f},
-std::array<float,2>{0.332898259f, 0.380200148f},
-std::array<float,2>{0.888405979f, 0.648241758f},
-std::array<float,2>{0.0343650505f, 0.785250962f},
-std::array<float,2>{0.692327201f, 0.085333012f},
-std::array<float,2>{0.194348618f, 0.454662532f},
-std::array<float,2>{0.532617331f, 0.740030944f},
-std::array<float,2>{0.475697398f, 0.860510111f},
-std::array<float,2>{0.772494316f, 0.0369167402f},
-std::array<float,2>{0.301334113f, 0.210068583f},
-std::array<float,2>{0.956670344f, 0.881508708f},
-std::array<float,2>{0.0869421214f, 0.555095077f},
-std::array<float,2>{0.647822142f, 0.286068171f},
-std::array<float,2>{0.00249268115f, 0.121424049f},
-std::array<float,2>{0.7194978f, 0.765141129f},
-std::array<float,2>{0.359314919f, 0.682142556f},
-std::array<float,2>{0.910826981f, 0.425449222f},
-std::array<float,2>{0.415834218f, 0.331569344f},
-std::array<float,2>{0.840196908f, 0.60769248f},
-std::array<float,2>{0.125340313f, 0.951550961f},
-std::array<float,2>{0.563249767f, 0.162523806f},
-std::array<float,2>{0.0509507693f, 0.408992589f},
-std::array<float,2>{0.706780195f, 0.659070849f},
-std::array<float,2>{0.313894004f, 0.770235181f},
-std::array<float,2>{0.895731688f, 0.100964732f},
-std::array<float,2>{0.405133575f, 0.184866846f},
-std::array<float,2>{0.867784798f, 0.959482491f},
-std::array<float,2>{0.170882419f, 0.611801207f},
-std::array<float,2>{0.594905198f, 0.319809198f},
-std::array<float,2>{0.222978041f, 0.0587575547f},
-std::array<float,2>{0.507376254f, 0.859043717f},
-std::array<float,2>{0.456166446f, 0.729903877f},
-std::array<float,2>{0.784896851f, 0.445537001f},
-std::array<float,2>{0.279364377f, 0.304438025f},
-std::array<float,2>{0.972421229f, 0.541311145f},
-std::array<float,2>{0.103478044f, 0.904102445f},
-std::array<float,2>{0.664932609f, 0.19651255f},
-std::array<float,2>{0.150535017f, 0.36644882f},
-std::array<float,2>{0.586107373f, 0.57697767f},
-std::array<float,2>{0.422154993f, 0.973536968f},
-std::array<float,2>{0.818230271f, 0.134250954f},
-std::array<float,2>{0.372224152f, 0.0768202096f},
-std::array<float,2>{0.935198784f, 0.810207665f},
-std::array<float,2>{0.0166322552f, 0.632299006f},
-std::array<float,2>{0.748865545f, 0.391152173f},
-std::array<float,2>{0.0670183599f, 0.239159375f},
-std::array<float,2>{0.637431681f, 0.934825778f},
-std::array<float,2>{0.295227677f, 0.515526414f},
-std::array<float,2>{0.941782176f, 0.270097703f},
-std::array<float,2>{0.488056362f, 0.492480665f},
-std::array<float,2>{0.754093349f, 0.715557933f},
-std::array<float,2>{0.207096681f, 0.816361129f},
-std::array<float,2>{0.557487071f, 0.0162026621f},
-std::array<float,2>{0.0265683215f, 0.322003931f},
-std::array<float,2>{0.734771311f, 0.624322951f},
-std::array<float,2>{0.360007316f, 0.961020768f},
-std::array<float,2>{0.927139163f, 0.174230263f},
-std::array<float,2>{0.437033236f, 0.1081862f},
-std::array<float,2>{0.82327491f, 0.774158955f},
-std::array<float,2>{0.144488677f, 0.66907084f},
-std::array<float,2>{0.581867933f, 0.414792895f},
-std::array<float,2>{0.216294006f, 0.188644052f},
-std::array<float,2>{0.553870916f, 0.896272004f},
-std::array<float,2>{0.496930838f, 0.53344357f},
-std::array<float,2>{0.762433171f, 0.311872452f},
-std::array<float,2>{0.281956494f, 0.440948308f},
-std::array<float,2>{0.949048638f, 0.723017335f},
-std::array<float,2>{0.0765844956f, 0.84399873f},
-std::array<float,2>{0.627613306f, 0.0497636907f},
-std::array<float,2>{0.163538262f, 0.40609628f},
-std::array<float,2>{0.602425218f, 0.638784468f},
-std::array<float,2>{0.392118752f, 0.800802886f},
-std::array<float,2>{0.86236161f, 0.0683587044f},
-std::array<float,2>{0.322005451f, 0.126986876f},
-std::array<float,2>{0.906189919f, 0.977690518f},
-std::array<float,2>{0.0560090467f, 0.562773407f},
-std::array<float,2>{0.71729815f, 0.373736322f},
-std::array<float,2>{0.0971086174f, 0.0305277873f},
-std::array<float,2>{0.662068367f, 0.821985781f},
-std::array<float,2>{0.26755628f, 0.704714358f},
-std::array<float,2>{0.979711115f, 0.490864038f},
-std::array<float,2>{0.464349568f, 0.280194163f},
-std::array<float,2>{0.795544922f, 0.507001281f},
-std::array<float,2>{0.229614288f, 0.92524451f},
-std::array<float,2>{0.515139759f, 0.245100826f},
-std::array<float,2>{0.079232417f, 0.482647061f},
-std::array<float,2>{0.654530525f, 0.698052347f},
-std::array<float,2>{0.310098737f, 0.837728143f},
-std::array<float,2>{0.968258977f, 0.0117120445f},
-std::array<float,2>{0.478284836f, 0.229079425f},
-std::array<float,2>{0.780606568f, 0.909818828f},
-std::array<float,2>{0.201078162f, 0.520277262f},
-std::array<float,2>{0.543665409f, 0.25750947f},
-std::array<float,2>{0.140176207f, 0.0923000798f},
-std::array<float,2>{0.574169159f, 0.795401871f},
-std::array<float,2>{0.409629405f, 0.64878118f},
-std::array<float,2>{0.831115425f, 0.386334836f},
-std::array<float,2>{0.344113171f, 0.355660081f},
-std::array<float,2>{0.920064986f, 0.578689873f},
-std::array<float,2>{0.0115403198f, 0.991331398f},
-std::array<float,2>{0.730824292f, 0.151813492f},
-std::array<float,2>{0.246251166f, 0.292520344f},
-std::array<float,2>{0.524413049f, 0.548881531f},
-std::array<float,2>{0.442918181f, 0.888855755f},
-std::array<float,2>{0.800689876f, 0.217773378f},
-std::array<float,2>{0.257746547f, 0.0405135714f},
-std::array<float,2>{0.995997012f, 0.874631643f},
-std::array<float,2>{0.114132896f, 0.744103551f},
-std::array<float,2>{0.673607767f, 0.466140121f},
-std::array<float,2>{0.0447240509f, 0.168960944f},
-std::array<float,2>{0.699675381f, 0.943056047f},
-std::array<float,2>{0.340405822f, 0.597973347f},
-std::array<float,2>{0.881195426f, 0.33663699f},
-std::array<float,2>{0.381429523f, 0.430121988f},
-std::array<float,2>{0.857499063f, 0.676039159f},
-std::array<float,2>{0.176155448f, 0.756077051f},
-std::array<float,2>{0.611934006f, 0.110320181f},
-std::array<float,2>{0.0220204201f, 0.293260813f},
-std::array<float,2>{0.743148625f, 0.554520428f},
-std::array<float,2>{0.367534578f, 0.883403301f},
-std::array<float,2>{0.932936907f, 0.213645369f},
-std::array<float,2>{0.426251411f, 0.0459754579f},
-std::array<float,2>{0.814319491f, 0.867854178f},
-std::array<float,2>{0.153390631f, 0.748010337f},
-std::array<float,2>{0.591026485f, 0.461503714f},
-std::array<float,2>{0.204877257f, 0.164203003f},
-std::array<float,2>{0.561151505f, 0.938738644f},
-std::array<float,2>{0.490376294f, 0.597300828f},
-std::array<float,2>{0.75261718f, 0.342321277f},
-std::array<float,2>{0.292402387f, 0.435791969f},
-std::array<float,2>{0.940881371f, 0.675005078f},
-std::array<float,2>{0.065922305f, 0.750475287f},
-std::array<float,2>{0.635435522f, 0.113733858f},
-std::array<float,2>{0.166849971f, 0.478615701f},
-std::array<float,2>{0.600879908f, 0.701711655f},
-std::array<float,2>{0.400892526f, 0.841796577f},
-std::array<float,2>{0.872149944f, 0.0138231227f},
-std::array<float,2>{0.3192406f, 0.233425871f},
-std::array<float,2>{0.892770112f, 0.910408258f},
-std::array<float,2>{0.0505696461f, 0.517164171f},
-std::array<float,2>{0.710270286f, 0.25175637f},
-std::array<float,2>{0.106517382f, 0.0875436589f},
-std::array<float,2>{0.668430984f, 0.790165544f},
-std::array<float,2>{0.276117235f, 0.653209865f},
-std::array<float,2>{0.973477304f, 0.387557179f},
-std::array<float,2>{0.458105415f, 0.354727894f},
-std::array<float,2>{0.787494779f, 0.583256483f},
-std::array<float,2>{0.21908474f, 0.985788405f},
-std::array<float,2>{0.502737999f, 0.152398244f},
-std::array<float,2>{0.0905540586f, 0.402185529f},
-std::array<float,2>{0.644194484f, 0.634722888f},
-std::array<float,2>{0.300480247f, 0.7993505f},
-std::array<float,2>{0.960311055f, 0.0656151399f},
-std::array<float,2>{0.471610904f, 0.129903629f},
-std::array<float,2>{0.768755913f, 0.984038174f},
-std::array<float,2>{0.187781677f, 0.566802442f},
-std::array<float,2>{0.538327098f, 0.367945224f},
-std::array<float,2>{0.129440263f, 0.0238521863f},
-std::array<float,2>{0.570191979f, 0.825719893f},
-std::array<float,2>{0.420281678f, 0.709067941f},
-std::array<float,2>{0.838807762f, 0.48743853f},
-std::array<float,2>{0.353526652f, 0.274346292f},
-std::array<float,2>{0.908147931f, 0.500183702f},
-std::array<float,2>{0.00398741243f, 0.928870976f},
-std::array<float,2>{0.723857224f, 0.248925626f},
-std::array<float,2>{0.235516146f, 0.327812791f},
-std::array<float,2>{0.518179357f, 0.619116187f},
-std::array<float,2>{0.448197842f, 0.965761304f},
-std::array<float,2>{0.807876885f, 0.179425061f},
-std::array<float,2>{0.259993881f, 0.102326415f},
-std::array<float,2>{0.987446606f, 0.777834356f},
-std::array<float,2>{0.123938702f, 0.6678406f},
-std::array<float,2>{0.685685515f, 0.418097675f},
-std::array<float,2>{0.0366399772f, 0.194199234f},
-std::array<float,2>{0.69042927f, 0.89088434f},
-std::array<float,2>{0.331373423f, 0.538252294f},
-std::array<float,2>{0.883599043f, 0.308072895f},
-std::array<float,2>{0.389884353f, 0.444689035f},
-std::array<float,2>{0.850774527f, 0.720291853f},
-std::array<float,2>{0.183223218f, 0.849378288f},
-std::array<float,2>{0.621439755f, 0.0512002818f},
-std::array<float,2>{0.110715903f, 0.360153794f},
-std::array<float,2>{0.677982509f, 0.572792888f},
-std::array<float,2>{0.251161754f, 0.972072601f},
-std::array<float,2>{0.996361971f, 0.137204796f},
-std::array<float,2>{0.441254705f, 0.0732870698f},
-std::array<float,2>{0.802638948f, 0.808217168f},
-std::array<float,2>{0.244929284f, 0.626788437f},
-std::array<float,2>{0.530913115f, 0.395677388f},
-std::array<float,2>{0.172958419f, 0.237924203f},
-std::array<float,2>{0.6154176f, 0.930373132f},
-std::array<float,2>{0.37694326f, 0.50927341f},
-std::array<float,2>{0.852411568f, 0.265928358f},
-std::array<float,2>{0.33780396f, 0.496386379f},
-std::array<float,2>{0.875603378f, 0.711854875f},
-std::array<float,2>{0.0409574695f, 0.817025602f},
-std::array<float,2>{0.696053803f, 0.0234343689f},
-std::array<float,2>{0.195640087f, 0.410602421f},
-std::array<float,2>{0.539763868f, 0.664048314f},
-std::array<float,2>{0.482960016f, 0.767063737f},
-std::array<float,2>{0.775293052f, 0.0956705809f},
-std::array<float,2>{0.305748969f, 0.181988508f},
-std::array<float,2>{0.960991204f, 0.955315769f},
-std::array<float,2>{0.0850491598f, 0.617069006f},
-std::array<float,2>{0.650311172f, 0.314840645f},
-std::array<float,2>{0.0141808316f, 0.0578091517f},
-std::array<float,2>{0.727463484f, 0.852080226f},
-std::array<float,2>{0.349082142f, 0.730887353f},
-std::array<float,2>{0.914411247f, 0.44968918f},
-std::array<float,2>{0.41040957f, 0.298087865f},
-std::array<float,2>{0.83572793f, 0.544118166f},
-std::array<float,2>{0.132864863f, 0.900685072f},
-std::array<float,2>{0.577638328f, 0.201342121f},
-std::array<float,2>{0.0603905059f, 0.459605426f},
-std::array<float,2>{0.711795688f, 0.734930456f},
-std::array<float,2>{0.325597763f, 0.865745306f},
-std::array<float,2>{0.900797546f, 0.0341032147f},
-std::array<float,2>{0.397049487f, 0.204116866f},
-std::array<float,2>{0.864667773f, 0.877866089f},
-std::array<float,2>{0.159509733f, 0.560353339f},
-std::array<float,2>{0.607517838f, 0.282623887f},
-std::array<float,2>{0.233099461f, 0.119568504f},
-std::array<float,2>{0.511460841f, 0.758618236f},
-std::array<float,2>{0.466707557f, 0.685941458f},
-std::array<float,2>{0.789694905f, 0.427595586f},
-std::array<float,2>{0.270297825f, 0.335865974f},
-std::array<float,2>{0.981738508f, 0.604074538f},
-std::array<float,2>{0.100344941f, 0.948764265f},
-std::array<float,2>{0.657692075f, 0.156541586f},
-std::array<float,2>{0.144961879f, 0.26120007f},
-std::array<float,2>{0.582297146f, 0.523774385f},
-std::array<float,2>{0.432052583f, 0.917687535f},
-std::array<float,2>{0.824776053f, 0.219967559f},
-std::array<float,2>{0.366254419f, 0.00768630486f},
-std::array<float,2>{0.924384594f, 0.830659151f},
-std::array<float,2>{0.0282690432f, 0.689026833f},
-std::array<float,2>{0.738459647f, 0.471243531f},
-std::array<float,2>{0.0741305053f, 0.145816416f},
-std::array<float,2>{0.629164696f, 0.997890353f},
-std::array<float,2>{0.287897766f, 0.586331487f},
-std::array<float,2>{0.951481342f, 0.350290388f},
-std::array<float,2>{0.49366805f, 0.378279001f},
-std::array<float,2>{0.76042062f, 0.643641293f},
-std::array<float,2>{0.214711756f, 0.782643318f},
-std::array<float,2>{0.549408972f, 0.0818753615f},
-std::array<float,2>{0.0697365701f, 0.271273464f},
-std::array<float,2>{0.640302896f, 0.514624774f},
-std::array<float,2>{0.29394272f, 0.933704734f},
-std::array<float,2>{0.945100904f, 0.239763573f},
-std::array<float,2>{0.484438658f, 0.0169452056f},
-std::array<float,2>{0.756584048f, 0.814862609f},
-std::array<float,2>{0.210049763f, 0.71657306f},
-std::array<float,2>{0.555335283f, 0.493646741f},
-std::array<float,2>{0.148866594f, 0.133092672f},
-std::array<float,2>{0.588354945f, 0.974151015f},
-std::array<float,2>{0.423983961f, 0.577526212f},
-std::array<float,2>{0.820054233f, 0.366152346f},
-std::array<float,2>{0.373438418f, 0.391819686f},
-std::array<float,2>{0.936951697f, 0.631452978f},
-std::array<float,2>{0.0189502034f, 0.80894345f},
-std::array<float,2>{0.746846616f, 0.0773956031f},
-std::array<float,2>{0.225869402f, 0.446642578f},
-std::array<float,2>{0.505383372f, 0.72942251f},
-std::array<float,2>{0.454800844f, 0.857905805f},
-std::array<float,2>{0.782945395f, 0.060081359f},
-std::array<float,2>{0.277651519f, 0.195427582f},
-std::array<float,2>{0.969995737f, 0.902952433f},
-std::array<float,2>{0.104780525f, 0.542077005f},
-std::array<float,2>{0.667728543f, 0.302752733f},
-std::array<float,2>{0.0542531163f, 0.100499287f},
-std::array<float,2>{0.703276992f, 0.770554364f},
-std::array<float,2>{0.316218555f, 0.659817576f},
-std::array<float,2>{0.89815104f, 0.409359574f},
-std::array<float,2>{0.402860552f, 0.319140464f},
-std::array<float,2>{0.869212985f, 0.612680256f},
-std::array<float,2>{0.169709802f, 0.960787952f},
-std::array<float,2>{0.596373439f, 0.184187442f},
-std::array<float,2>{0.00116810598f, 0.42395708f},
-std::array<float,2>{0.72191757f, 0.682918549f},
-std::array<float,2>{0.3567774f, 0.764003515f},
-std::array<float,2>{0.913004935f, 0.122082137f},
-std::array<float,2>{0.416718841f, 0.163905501f},
-std::array<float,2>{0.842792749f, 0.952722132f},
-std::array<float,2>{0.128162697f, 0.608810425f},
-std::array<float,2>{0.566123068f, 0.330362439f},
-std::array<float,2>{0.192208901f, 0.0352414586f},
-std::array<float,2>{0.534595668f, 0.860221565f},
-std::array<float,2>{0.474221528f, 0.738989651f},
-std::array<float,2>{0.770912349f, 0.453477532f},
-std::array<float,2>{0.303151667f, 0.286591262f},
-std::array<float,2>{0.953206658f, 0.556531787f},
-std::array<float,2>{0.088873744f, 0.881897986f},
-std::array<float,2>{0.645738542f, 0.209876433f},
-std::array<float,2>{0.18403472f, 0.345611393f},
-std::array<float,2>{0.618440211f, 0.591907799f},
-std::array<float,2>{0.385483235f, 0.995491326f},
-std::array<float,2>{0.843776762f, 0.14149113f},
-std::array<float,2>{0.335901916f, 0.0848673359f},
-std::array<float,2>{0.889166176f, 0.786376238f},
-std::array<float,2>{0.0323963575f, 0.646521747f},
-std::array<float,2>{0.693999171f, 0.379517078f},
-std::array<float,2>{0.119564235f, 0.224887699f},
-std::array<float,2>{0.682253957f, 0.919259965f},
-std::array<float,2>{0.264931053f, 0.528506696f},
-std::array<float,2>{0.98876363f, 0.263662666f},
-std::array<float,2>{0.450404704f, 0.473866045f},
-std::array<float,2>{0.808868408f, 0.693059266f},
-std::array<float,2>{0.240055889f, 0.834764779f},
-std::array<float,2>{0.52305299f, 0.00203144574f},
-std::array<float,2>{0.0452527851f, 0.337605715f},
-std::array<float,2>{0.701386392f, 0.599137664f},
-std::array<float,2>{0.342653245f, 0.941762149f},
-std::array<float,2>{0.879466832f, 0.168863401f},
-std::array<float,2>{0.380103737f, 0.110978924f},
-std::array<float,2>{0.856214464f, 0.757069826f},
-std::array<float,2>{0.178255618f, 0.677559435f},
-std::array<float,2>{0.610703349f, 0.430977225f},
-std::array<float,2>{0.248300776f, 0.218151852f},
-std::array<float,2>{0.526008487f, 0.890549064f},
-std::array<float,2>{0.444627225f, 0.550489247f},
-std::array<float,2>{0.797529459f, 0.291886389f},
-std::array<float,2>{0.255100131f, 0.464967936f},
-std::array<float,2>{0.992240489f, 0.742766023f},
-std::array<float,2>{0.115695573f, 0.873084426f},
-std::array<float,2>{0.675369442f, 0.0391333289f},
-std::array<float,2>{0.137254357f, 0.385328472f},
-std::array<float,2>{0.571123064f, 0.649845719f},
-std::array<float,2>{0.406900197f, 0.796367049f},
-std::array<float,2>{0.829182029f, 0.0932117328f},
-std::array<float,2>{0.346648753f, 0.15097557f},
-std::array<float,2>{0.918296278f, 0.990939856f},
-std::array<float,2>{0.0091560483f, 0.57912755f},
-std::array<float,2>{0.732877672f, 0.356889039f},
-std::array<float,2>{0.0811317191f, 0.0104046613f},
-std::array<float,2>{0.653639972f, 0.835998952f},
-std::array<float,2>{0.311119586f, 0.699009895f},
-std::array<float,2>{0.965947866f, 0.483733118f},
-std::array<float,2>{0.478831738f, 0.255889446f},
-std::array<float,2>{0.778461635f, 0.520660639f},
-std::array<float,2>{0.203096598f, 0.908709764f},
-std::array<float,2>{0.545809448f, 0.23015818f},
-std::array<float,2>{0.0954322293f, 0.491655886f},
-std::array<float,2>{0.663004398f, 0.703341007f},
-std::array<float,2>{0.268090785f, 0.820882916f},
-std::array<float,2>{0.977764666f, 0.0298719462f},
-std::array<float,2>{0.461873651f, 0.246026129f},
-std::array<float,2>{0.794763148f, 0.924546599f},
-std::array<float,2>{0.228311837f, 0.506114185f},
-std::array<float,2>{0.512522161f, 0.280948818f},
-std::array<float,2>{0.161691323f, 0.0665335283f},
-std::array<float,2>{0.604361176f, 0.801761448f},
-std::array<float,2>{0.393330067f, 0.640558541f},
-std::array<float,2>{0.860779047f, 0.404772878f},
-std::array<float,2>{0.322638273f, 0.374521345f},
-std::array<float,2>{0.903366923f, 0.563847363f},
-std::array<float,2>{0.0571572371f, 0.977338195f},
-std::array<float,2>{0.715989411f, 0.128066644f},
-std::array<float,2>{0.21712029f, 0.311156183f},
-std::array<float,2>{0.552544117f, 0.534231901f},
-std::array<float,2>{0.498987079f, 0.894742072f},
-std::array<float,2>{0.764346838f, 0.188177213f},
-std::array<float,2>{0.283324599f, 0.0502161384f},
-std::array<float,2>{0.945452571f, 0.845165372f},
-std::array<float,2>{0.0755395517f, 0.723745167f},
-std::array<float,2>{0.6256814f, 0.439730823f},
-std::array<float,2>{0.0253704302f, 0.17494677f},
-std::array<float,2>{0.738241553f, 0.962743044f},
-std::array<float,2>{0.361809969f, 0.623617887f},
-std::array<float,2>{0.929674149f, 0.320994884f},
-std::array<float,2>{0.433640569f, 0.415498972f},
-std::array<float,2>{0.821038365f, 0.668399274f},
-std::array<float,2>{0.141915023f, 0.77510798f},
-std::array<float,2>{0.578189731f, 0.108452946f},
-std::array<float,2>{0.0477470011f, 0.252470046f},
-std::array<float,2>{0.707587063f, 0.518253744f},
-std::array<float,2>{0.318155915f, 0.912971079f},
-std::array<float,2>{0.890631318f, 0.231134534f},
-std::array<float,2>{0.399237692f, 0.0125238029f},
-std::array<float,2>{0.873532832f, 0.842066884f},
-std::array<float,2>{0.165358841f, 0.700874388f},
-std::array<float,2>{0.599588037f, 0.476899445f},
-std::array<float,2>{0.221718714f, 0.155650869f},
-std::array<float,2>{0.500972152f, 0.9880988f},
-std::array<float,2>{0.459916711f, 0.585285544f},
-std::array<float,2>{0.786727607f, 0.353222787f},
-std::array<float,2>{0.273879498f, 0.388961315f},
-std::array<float,2>{0.974620879f, 0.656040668f},
-std::array<float,2>{0.108688869f, 0.792619944f},
-std::array<float,2>{0.671111643f, 0.0883115679f},
-std::array<float,2>{0.155549496f, 0.463785917f},
-std::array<float,2>{0.593639255f, 0.749452472f},
-std::array<float,2>{0.42857939f, 0.86971271f},
-std::array<float,2>{0.814666152f, 0.0442364477f},
-std::array<float,2>{0.369777977f, 0.21169737f},
-std::array<float,2>{0.930654466f, 0.885023177f},
-std::array<float,2>{0.0209086873f, 0.551575124f},
-std::array<float,2>{0.745713174f, 0.295945734f},
-std::array<float,2>{0.0632867292f, 0.115414761f},
-std::array<float,2>{0.633128405f, 0.753442228f},
-std::array<float,2>{0.28933242f, 0.672193587f},
-std::array<float,2>{0.938805282f, 0.435248762f},
-std::array<float,2>{0.489390731f, 0.340196222f},
-std::array<float,2>{0.751247406f, 0.594114423f},
-std::array<float,2>{0.205169171f, 0.94106102f},
-std::array<float,2>{0.558820844f, 0.166580096f},
-std::array<float,2>{0.122079574f, 0.421152204f},
-std::array<float,2>{0.684400499f, 0.664802611f},
-std::array<float,2>{0.259391904f, 0.780892015f},
-std::array<float,2>{0.985410571f, 0.104017951f},
-std::array<float,2>{0.446941584f, 0.177457258f},
-std::array<float,2>{0.805621028f, 0.968589187f},
-std::array<float,2>{0.238151759f, 0.620094895f},
-std::array<float,2>{0.517200589f, 0.326121539f},
-std::array<float,2>{0.180376083f, 0.0540546775f},
-std::array<float,2>{0.623823166f, 0.849767983f},
-std::array<float,2>{0.388000548f, 0.720961034f},
-std::array<float,2>{0.849410594f, 0.441594541f},
-std::array<float,2>{0.329072684f, 0.305012971f},
-std::array<float,2>{0.884836316f, 0.535226703f},
-std::array<float,2>{0.0381600186f, 0.894062638f},
-std::array<float,2>{0.689210117f, 0.191944212f},
-std::array<float,2>{0.191114888f, 0.37004894f},
-std::array<float,2>{0.536388636f, 0.569081962f},
-std::array<float,2>{0.470536768f, 0.980844736f},
-std::array<float,2>{0.766623259f, 0.132247165f},
-std::array<float,2>{0.297060102f, 0.0628334656f},
-std::array<float,2>{0.958697319f, 0.798399508f},
-std::array<float,2>{0.0920053944f, 0.635061085f},
-std::array<float,2>{0.641267538f, 0.400163889f},
-std::array<float,2>{0.00640994729f, 0.24646686f},
-std::array<float,2>{0.724995136f, 0.926990747f},
-std::array<float,2>{0.352200806f, 0.503441572f},
-std::array<float,2>{0.909452438f, 0.277168721f},
-std::array<float,2>{0.41902101f, 0.485129386f},
-std::array<float,2>{0.837862909f, 0.707932651f},
-std::array<float,2>{0.132285029f, 0.82643491f},
-std::array<float,2>{0.567004919f, 0.0273208451f},
-std::array<float,2>{0.0834121928f, 0.312587351f},
-std::array<float,2>{0.651158988f, 0.613408804f},
-std::array<float,2>{0.307009667f, 0.954054773f},
-std::array<float,2>{0.963980317f, 0.18010211f},
-std::array<float,2>{0.48131609f, 0.0974484459f},
-std::array<float,2>{0.777176082f, 0.767932236f},
-std::array<float,2>{0.198152333f, 0.661271214f},
-std::array<float,2>{0.542116582f, 0.41297856f},
-std::array<float,2>{0.135238975f, 0.199385628f},
-std::array<float,2>{0.575201333f, 0.900082469f},
-std::array<float,2>{0.413811982f, 0.545021236f},
-std::array<float,2>{0.833573461f, 0.299976915f},
-std::array<float,2>{0.350063771f, 0.452557743f},
-std::array<float,2>{0.917492568f, 0.732613683f},
-std::array<float,2>{0.0131884245f, 0.855107129f},
-std::array<float,2>{0.729165614f, 0.0550649427f},
-std::array<float,2>{0.242278621f, 0.396651775f},
-std::array<float,2>{0.527433872f, 0.628317237f},
-std::array<float,2>{0.438401699f, 0.805233061f},
-std::array<float,2>{0.803846657f, 0.0713539571f},
-std::array<float,2>{0.252628297f, 0.139093846f},
-std::array<float,2>{0.998340309f, 0.968829334f},
-std::array<float,2>{0.112305008f, 0.570490658f},
-std::array<float,2>{0.677526951f, 0.362798631f},
-std::array<float,2>{0.0415044241f, 0.0203870237f},
-std::array<float,2>{0.697288752f, 0.819792688f},
-std::array<float,2>{0.339084595f, 0.714050651f},
-std::array<float,2>{0.878778875f, 0.498615026f},
-std::array<float,2>{0.378638059f, 0.267910063f},
-std::array<float,2>{0.855406225f, 0.510780334f},
-std::array<float,2>{0.175670162f, 0.932522118f},
-std::array<float,2>{0.614617765f, 0.236055315f},
-std::array<float,2>{0.0298154578f, 0.470127851f},
-std::array<float,2>{0.742179573f, 0.690339386f},
-std::array<float,2>{0.364295751f, 0.829767466f},
-std::array<float,2>{0.92201525f, 0.00496229064f},
-std::array<float,2>{0.431218654f, 0.222538009f},
-std::array<float,2>{0.827709377f, 0.915363073f},
-std::array<float,2>{0.147741139f, 0.526561618f},
-std::array<float,2>{0.584905684f, 0.258500129f},
-std::array<float,2>{0.2121526f, 0.079885073f},
-std::array<float,2>{0.547180533f, 0.784552693f},
-std::array<float,2>{0.494209051f, 0.640765846f},
-std::array<float,2>{0.758700252f, 0.375707239f},
-std::array<float,2>{0.285743952f, 0.348385811f},
-std::array<float,2>{0.949455559f, 0.588980019f},
-std::array<float,2>{0.0708340704f, 0.999385178f},
-std::array<float,2>{0.632006407f, 0.147558525f},
-std::array<float,2>{0.156451255f, 0.284717858f},
-std::array<float,2>{0.606853306f, 0.561384916f},
-std::array<float,2>{0.396090508f, 0.87652427f},
-std::array<float,2>{0.866249859f, 0.205685288f},
-std::array<float,2>{0.32729134f, 0.0313154124f},
-std::array<float,2>{0.899338841f, 0.863602579f},
-std::array<float,2>{0.0614028461f, 0.738160193f},
-std::array<float,2>{0.713342309f, 0.458923876f},
-std::array<float,2>{0.0995982736f, 0.158325732f},
-std::array<float,2>{0.659347653f, 0.946393967f},
-std::array<float,2>{0.272209823f, 0.603262067f},
-std::array<float,2>{0.984299839f, 0.333961695f},
-std::array<float,2>{0.467759997f, 0.427747995f},
-std::array<float,2>{0.791083694f, 0.685332775f},
-std::array<float,2>{0.231973127f, 0.760804951f},
-std::array<float,2>{0.508342028f, 0.11856351f},
-std::array<float,2>{0.102349423f, 0.302614421f},
-std::array<float,2>{0.665696323f, 0.54045409f},
-std::array<float,2>{0.281134278f, 0.905995727f},
-std::array<float,2>{0.971198678f, 0.197626755f},
-std::array<float,2>{0.455353737f, 0.0606350228f},
-std::array<float,2>{0.783750117f, 0.856951952f},
-std::array<float,2>{0.223909184f, 0.727252245f},
-std::array<float,2>{0.506544292f, 0.44844988f},
-std::array<float,2>{0.171371356f, 0.187220186f},
-std::array<float,2>{0.593810976f, 0.958963335f},
-std::array<float,2>{0.406004161f, 0.60959363f},
-std::array<float,2>{0.868679225f, 0.316476226f},
-std::array<float,2>{0.312726945f, 0.408202589f},
-std::array<float,2>{0.894693017f, 0.656413257f},
-std::array<float,2>{0.0519687459f, 0.772685647f},
-std::array<float,2>{0.705098569f, 0.0984360278f},
-std::array<float,2>{0.208847269f, 0.494794965f},
-std::array<float,2>{0.558412313f, 0.718385816f},
-std::array<float,2>{0.486429542f, 0.812977612f},
-std::array<float,2>{0.755192876f, 0.0190467834f},
-std::array<float,2>{0.29605788f, 0.24034518f},
-std::array<float,2>{0.942945898f, 0.935918927f},
-std::array<float,2>{0.0676794127f, 0.513608634f},
-std::array<float,2>{0.637885571f, 0.27334851f},
-std::array<float,2>{0.0161101278f, 0.0748136342f},
-std::array<float,2>{0.749979615f, 0.812160015f},
-std::array<float,2>{0.371729225f, 0.63032794f},
-std::array<float,2>{0.934286594f, 0.393684715f},
-std::array<float,2>{0.423383772f, 0.363403767f},
-std::array<float,2>{0.816963911f, 0.575292766f},
-std::array<float,2>{0.151767477f, 0.97649169f},
-std::array<float,2>{0.587045789f, 0.135640681f},
-std::array<float,2>{0.0334185846f, 0.381611347f},
-std::array<float,2>{0.692663968f, 0.645548999f},
-std::array<float,2>{0.333744705f, 0.788075626f},
-std::array<float,2>{0.887622178f, 0.0838354304f},
-std::array<float,2>{0.383529514f, 0.143163264f},
-std::array<float,2>{0.846146405f, 0.993954659f},
-std::array<float,2>{0.186368838f, 0.590319932f},
-std::array<float,2>{0.619562209f, 0.347426593f},
-std::array<float,2>{0.240456387f, 8.03130388e-05f},
-std::array<float,2>{0.520914435f, 0.833719373f},
-std::array<float,2>{0.451898158f, 0.694933057f},
-std::array<float,2>{0.81127274f, 0.475104123f},
-std::array<float,2>{0.263543606f, 0.26534003f},
-std::array<float,2>{0.991424084f, 0.530731857f},
-std::array<float,2>{0.118759692f, 0.92150861f},
-std::array<float,2>{0.680617988f, 0.223025188f},
-std::array<float,2>{0.126132309f, 0.329514354f},
-std::array<float,2>{0.564155638f, 0.607196033f},
-std::array<float,2>{0.414851606f, 0.951038122f},
-std::array<float,2>{0.841784656f, 0.160542235f},
-std::array<float,2>{0.357714146f, 0.124582112f},
-std::array<float,2>{0.911276519f, 0.763509393f},
-std::array<float,2>{0.00336616952f, 0.681429982f},
-std::array<float,2>{0.720135748f, 0.421896636f},
-std::array<float,2>{0.0861576051f, 0.208027974f},
-std::array<float,2>{0.646812558f, 0.879182577f},
-std::array<float,2>{0.302018851f, 0.557090461f},
-std::array<float,2>{0.95548749f, 0.289033234f},
-std::array<float,2>{0.474984437f, 0.456437409f},
-std::array<float,2>{0.771726131f, 0.740666926f},
-std::array<float,2>{0.194277972f, 0.862666786f},
-std::array<float,2>{0.531695008f, 0.0380614102f},
-std::array<float,2>{0.00994333532f, 0.357714832f},
-std::array<float,2>{0.731941402f, 0.580870628f},
-std::array<float,2>{0.345430911f, 0.989856303f},
-std::array<float,2>{0.921129704f, 0.148542091f},
-std::array<float,2>{0.408843189f, 0.0917237327f},
-std::array<float,2>{0.830562234f, 0.793979704f},
-std::array<float,2>{0.138992369f, 0.652115464f},
-std::array<float,2>{0.572763085f, 0.384344399f},
-std::array<float,2>{0.199577689f, 0.226596355f},
-std::array<float,2>{0.544701636f, 0.906763136f},
-std::array<float,2>{0.476623714f, 0.523018479f},
-std::array<float,2>{0.779627025f, 0.255239725f},
-std::array<float,2>{0.309313774f, 0.480742812f},
-std::array<float,2>{0.966799736f, 0.695450723f},
-std::array<float,2>{0.0783484876f, 0.838905692f},
-std::array<float,2>{0.655977964f, 0.00833305065f},
-std::array<float,2>{0.177722335f, 0.431946129f},
-std::array<float,2>{0.612951815f, 0.678335547f},
-std::array<float,2>{0.382207602f, 0.755751729f},
-std::array<float,2>{0.858703732f, 0.111440279f},
-std::array<float,2>{0.341268629f, 0.171162069f},
-std::array<float,2>{0.882142782f, 0.943825424f},
-std::array<float,2>{0.0438758694f, 0.600349665f},
-std::array<float,2>{0.700558662f, 0.338398278f},
-std::array<float,2>{0.11504215f, 0.0418713465f},
-std::array<float,2>{0.672209263f, 0.872340202f},
-std::array<float,2>{0.25654754f, 0.744706035f},
-std::array<float,2>{0.994334936f, 0.466919661f},
-std::array<float,2>{0.441603184f, 0.290663928f},
-std::array<float,2>{0.798871517f, 0.548759758f},
-std::array<float,2>{0.247199669f, 0.888198912f},
-std::array<float,2>{0.525095999f, 0.215864465f},
-std::array<float,2>{0.0780395195f, 0.43772462f},
-std::array<float,2>{0.628723085f, 0.726359665f},
-std::array<float,2>{0.283084303f, 0.847017407f},
-std::array<float,2>{0.948080838f, 0.0477006957f},
-std::array<float,2>{0.49777925f, 0.1906351f},
-std::array<float,2>{0.763402522f, 0.896503031f},
-std::array<float,2>{0.215426221f, 0.531818032f},
-std::array<float,2>{0.553520977f, 0.31047526f},
-std::array<float,2>{0.142914936f, 0.107243001f},
-std::array<float,2>{0.58066988f, 0.77726233f},
-std::array<float,2>{0.435958952f, 0.671526909f},
-std::array<float,2>{0.822652042f, 0.417926669f},
-std::array<float,2>{0.360561341f, 0.323853314f},
-std::array<float,2>{0.926482022f, 0.621869445f},
-std::array<float,2>{0.025600234f, 0.963704646f},
-std::array<float,2>{0.736177921f, 0.17318733f},
-std::array<float,2>{0.229237109f, 0.277854085f},
-std::array<float,2>{0.513824165f, 0.505681872f},
-std::array<float,2>{0.46334523f, 0.923098266f},
-std::array<float,2>{0.796866238f, 0.243974477f},
-std::array<float,2>{0.266225308f, 0.0276656169f},
-std::array<float,2>{0.979264915f, 0.823779523f},
-std::array<float,2>{0.095896408f, 0.705832958f},
-std::array<float,2>{0.660278857f, 0.490055531f},
-std::array<float,2>{0.0552982464f, 0.125723734f},
-std::array<float,2>{0.718231082f, 0.97941184f},
-std::array<float,2>{0.320720702f, 0.564846814f},
-std::array<float,2>{0.904664695f, 0.371473432f},
-std::array<float,2>{0.39137429f, 0.404163629f},
-std::array<float,2>{0.862122297f, 0.637453437f},
-std::array<float,2>{0.162521243f, 0.803169072f},
-std::array<float,2>{0.603280962f, 0.0701810196f},
-std::array<float,2>{0.0085772099f, 0.254941851f},
-std::array<float,2>{0.734155297f, 0.523266733f},
-std::array<float,2>{0.347430319f, 0.907186568f},
-std::array<float,2>{0.91968143f, 0.22682558f},
-std::array<float,2>{0.407406241f, 0.00870516989f},
-std::array<float,2>{0.829058409f, 0.8393507f},
-std::array<float,2>{0.138209268f, 0.695616007f},
-std::array<float,2>{0.571301162f, 0.480503738f},
-std::array<float,2>{0.201222971f, 0.148839429f},
-std::array<float,2>{0.546578467f, 0.990098774f},
-std::array<float,2>{0.479892075f, 0.580785871f},
-std::array<float,2>{0.777802646f, 0.357548326f},
-std::array<float,2>{0.311648339f, 0.384569347f},
-std::array<float,2>{0.965124607f, 0.652091861f},
-std::array<float,2>{0.0810218453f, 0.79435122f},
-std::array<float,2>{0.652608633f, 0.0914173052f},
-std::array<float,2>{0.178940639f, 0.467080742f},
-std::array<float,2>{0.60967052f, 0.745035291f},
-std::array<float,2>{0.379067421f, 0.872256994f},
-std::array<float,2>{0.857207477f, 0.041601561f},
-std::array<float,2>{0.343632936f, 0.216103926f},
-std::array<float,2>{0.880397201f, 0.888508976f},
-std::array<float,2>{0.0463469476f, 0.548424661f},
-std::array<float,2>{0.702183783f, 0.290870816f},
-std::array<float,2>{0.116838805f, 0.111814946f},
-std::array<float,2>{0.674531996f, 0.755492151f},
-std::array<float,2>{0.254607856f, 0.678511083f},
-std::array<float,2>{0.993970037f, 0.431661576f},
-std::array<float,2>{0.443944186f, 0.338718116f},
-std::array<float,2>{0.797969818f, 0.600321591f},
-std::array<float,2>{0.249201268f, 0.943437636f},
-std::array<float,2>{0.5266096f, 0.171106577f},
-std::array<float,2>{0.0746036246f, 0.41758275f},
-std::array<float,2>{0.626292944f, 0.671648264f},
-std::array<float,2>{0.284707099f, 0.777091324f},
-std::array<float,2>{0.947227418f, 0.107093155f},
-std::array<float,2>{0.499904126f, 0.172870547f},
-std::array<float,2>{0.764897525f, 0.963452935f},
-std::array<float,2>{0.218537062f, 0.621590853f},
-std::array<float,2>{0.551724851f, 0.324125051f},
-std::array<float,2>{0.140726507f, 0.0475737937f},
-std::array<float,2>{0.579914689f, 0.846803129f},
-std::array<float,2>{0.435328454f, 0.72625643f},
-std::array<float,2>{0.821971297f, 0.437840968f},
-std::array<float,2>{0.363131613f, 0.310240299f},
-std::array<float,2>{0.928294718f, 0.532193899f},
-std::array<float,2>{0.0239194855f, 0.89683795f},
-std::array<float,2>{0.736565769f, 0.190840945f},
-std::array<float,2>{0.227298632f, 0.371106267f},
-std::array<float,2>{0.512818635f, 0.564564884f},
-std::array<float,2>{0.462766796f, 0.979113877f},
-std::array<float,2>{0.793763459f, 0.125858605f},
-std::array<float,2>{0.269033045f, 0.0699228868f},
-std::array<float,2>{0.977136374f, 0.802742124f},
-std::array<float,2>{0.0939797834f, 0.637420475f},
-std::array<float,2>{0.663575649f, 0.403862774f},
-std::array<float,2>{0.0582708269f, 0.243728295f},
-std::array<float,2>{0.714863241f, 0.923002243f},
-std::array<float,2>{0.324029595f, 0.505502641f},
-std::array<float,2>{0.902589202f, 0.278129041f},
-std::array<float,2>{0.393882334f, 0.489912331f},
-std::array<float,2>{0.859401941f, 0.705583811f},
-std::array<float,2>{0.160857201f, 0.824195385f},
-std::array<float,2>{0.605030179f, 0.0273957402f},
-std::array<float,2>{0.104412228f, 0.316787153f},
-std::array<float,2>{0.666414201f, 0.609643042f},
-std::array<float,2>{0.278510273f, 0.958535373f},
-std::array<float,2>{0.968850076f, 0.187387958f},
-std::array<float,2>{0.453472197f, 0.0982577577f},
-std::array<float,2>{0.781615376f, 0.772785068f},
-std::array<float,2>{0.225029618f, 0.656504512f},
-std::array<float,2>{0.503997326f, 0.407829404f},
-std::array<float,2>{0.168551728f, 0.197418109f},
-std::array<float,2>{0.597053587f, 0.906016707f},
-std::array<float,2>{0.403447241f, 0.540200174f},
-std::array<float,2>{0.870152891f, 0.302432269f},
-std::array<float,2>{0.315095425f, 0.448697269f},
-std::array<float,2>{0.897245944f, 0.727425516f},
-std::array<float,2>{0.0535938144f, 0.857235909f},
-std::array<float,2>{0.70467782f, 0.0608168542f},
-std::array<float,2>{0.209792241f, 0.393895447f},
-std::array<float,2>{0.555728674f, 0.630054951f},
-std::array<float,2>{0.486063659f, 0.812306762f},
-std::array<float,2>{0.756914616f, 0.0750789121f},
-std::array<float,2>{0.294389904f, 0.13537775f},
-std::array<float,2>{0.943368554f, 0.976109147f},
-std::array<float,2>{0.06847018f, 0.575597167f},
-std::array<float,2>{0.639315069f, 0.363745987f},
-std::array<float,2>{0.0182725545f, 0.0194646046f},
-std::array<float,2>{0.747452617f, 0.812646687f},
-std::array<float,2>{0.374325007f, 0.718741119f},
-std::array<float,2>{0.935718715f, 0.495052963f},
-std::array<float,2>{0.424850672f, 0.273086458f},
-std::array<float,2>{0.819139183f, 0.513415098f},
-std::array<float,2>{0.150235608f, 0.935774803f},
-std::array<float,2>{0.589336395f, 0.240683749f},
-std::array<float,2>{0.0321645252f, 0.4755252f},
-std::array<float,2>{0.694548845f, 0.695217311f},
-std::array<float,2>{0.334586948f, 0.833955944f},
-std::array<float,2>{0.89061743f, 0.0002473364f},
-std::array<float,2>{0.386283547f, 0.222741067f},
-std::array<float,2>{0.845136702f, 0.92185837f},
-std::array<float,2>{0.185424268f, 0.530339539f},
-std::array<float,2>{0.617297173f, 0.265488625f},
-std::array<float,2>{0.238681138f, 0.0835482106f},
-std::array<float,2>{0.521620572f, 0.787827075f},
-std::array<float,2>{0.449846774f, 0.645792067f},
-std::array<float,2>{0.80979389f, 0.38149789f},
-std::array<float,2>{0.264158905f, 0.347306281f},
-std::array<float,2>{0.989971578f, 0.590055168f},
-std::array<float,2>{0.120831788f, 0.993790746f},
-std::array<float,2>{0.683276415f, 0.1433772f},
-std::array<float,2>{0.127832025f, 0.288810462f},
-std::array<float,2>{0.565365613f, 0.556819618f},
-std::array<float,2>{0.417022854f, 0.879099548f},
-std::array<float,2>{0.842745304f, 0.208375216f},
-std::array<float,2>{0.355555594f, 0.0376361236f},
-std::array<float,2>{0.91346252f, 0.862308919f},
-std::array<float,2>{0.000474823697f, 0.740327895f},
-std::array<float,2>{0.721210003f, 0.456177264f},
-std::array<float,2>{0.0885931253f, 0.160158485f},
-std::array<float,2>{0.645188332f, 0.950801611f},
-std::array<float,2>{0.30450058f, 0.606965184f},
-std::array<float,2>{0.95465076f, 0.329121143f},
-std::array<float,2>{0.473600209f, 0.422271281f},
-std::array<float,2>{0.770354331f, 0.681193411f},
-std::array<float,2>{0.193021014f, 0.7633093f},
-std::array<float,2>{0.533316493f, 0.124826096f},
-std::array<float,2>{0.0843119621f, 0.30027023f},
-std::array<float,2>{0.649046481f, 0.545251846f},
-std::array<float,2>{0.305051535f, 0.900177836f},
-std::array<float,2>{0.962434411f, 0.199626461f},
-std::array<float,2>{0.483861893f, 0.0548106693f},
-std::array<float,2>{0.774152756f, 0.855378985f},
-std::array<float,2>{0.196306452f, 0.732860327f},
-std::array<float,2>{0.541010261f, 0.452330768f},
-std::array<float,2>{0.133922771f, 0.179696232f},
-std::array<float,2>{0.576667964f, 0.953677118f},
-std::array<float,2>{0.412002414f, 0.613598645f},
-std::array<float,2>{0.834763706f, 0.312757432f},
-std::array<float,2>{0.348482639f, 0.412686616f},
-std::array<float,2>{0.915403783f, 0.661391616f},
-std::array<float,2>{0.015222881f, 0.767637372f},
-std::array<float,2>{0.728289425f, 0.0973587334f},
-std::array<float,2>{0.246061265f, 0.498947769f},
-std::array<float,2>{0.529852509f, 0.714119911f},
-std::array<float,2>{0.440257102f, 0.819561064f},
-std::array<float,2>{0.80083859f, 0.0201565474f},
-std::array<float,2>{0.250532538f, 0.236254603f},
-std::array<float,2>{0.997488439f, 0.932281256f},
-std::array<float,2>{0.110257842f, 0.511155844f},
-std::array<float,2>{0.678936958f, 0.267787576f},
-std::array<float,2>{0.0399736613f, 0.0717514455f},
-std::array<float,2>{0.696627915f, 0.805650949f},
-std::array<float,2>{0.336009294f, 0.628097177f},
-std::array<float,2>{0.876872301f, 0.396877646f},
-std::array<float,2>{0.375424892f, 0.363258332f},
-std::array<float,2>{0.853390396f, 0.570799768f},
-std::array<float,2>{0.172550142f, 0.969057858f},
-std::array<float,2>{0.61694622f, 0.138908848f},
-std::array<float,2>{0.0286779441f, 0.37588644f},
-std::array<float,2>{0.739653051f, 0.640916049f},
-std::array<float,2>{0.365518123f, 0.784305215f},
-std::array<float,2>{0.924863756f, 0.0797572136f},
-std::array<float,2>{0.432967186f, 0.14779447f},
-std::array<float,2>{0.825584471f, 0.999213278f},
-std::array<float,2>{0.145781934f, 0.589181125f},
-std::array<float,2>{0.583787441f, 0.3485367f},
-std::array<float,2>{0.213030443f, 0.00518512819f},
-std::array<float,2>{0.550212622f, 0.829871118f},
-std::array<float,2>{0.492994517f, 0.690133452f},
-std::array<float,2>{0.761632383f, 0.469746858f},
-std::array<float,2>{0.288493186f, 0.258778542f},
-std::array<float,2>{0.952736318f, 0.526786923f},
-std::array<float,2>{0.0723368973f, 0.915072501f},
-std::array<float,2>{0.630264759f, 0.222314149f},
-std::array<float,2>{0.158431426f, 0.333502948f},
-std::array<float,2>{0.609180748f, 0.60342598f},
-std::array<float,2>{0.397711962f, 0.946737826f},
-std::array<float,2>{0.863293707f, 0.158469066f},
-std::array<float,2>{0.324979693f, 0.118212506f},
-std::array<float,2>{0.902215898f, 0.761193395f},
-std::array<float,2>{0.0593634062f, 0.685072005f},
-std::array<float,2>{0.712222576f, 0.42819047f},
-std::array<float,2>{0.100703664f, 0.205963552f},
-std::array<float,2>{0.656876206f, 0.876719832f},
-std::array<float,2>{0.271008015f, 0.561046422f},
-std::array<float,2>{0.9809497f, 0.284974933f},
-std::array<float,2>{0.46524933f, 0.458639473f},
-std::array<float,2>{0.790628374f, 0.737891793f},
-std::array<float,2>{0.234292731f, 0.863290489f},
-std::array<float,2>{0.510311186f, 0.0317147858f},
-std::array<float,2>{0.0490459986f, 0.353377551f},
-std::array<float,2>{0.709031999f, 0.585177958f},
-std::array<float,2>{0.320308775f, 0.987819552f},
-std::array<float,2>{0.894138336f, 0.155500561f},
-std::array<float,2>{0.40195179f, 0.0879435986f},
-std::array<float,2>{0.872063875f, 0.792761743f},
-std::array<float,2>{0.167915776f, 0.655852556f},
-std::array<float,2>{0.599657297f, 0.388881594f},
-std::array<float,2>{0.220234558f, 0.231216908f},
-std::array<float,2>{0.503273308f, 0.912657022f},
-std::array<float,2>{0.457958728f, 0.518384218f},
-std::array<float,2>{0.788494229f, 0.252687782f},
-std::array<float,2>{0.27650553f, 0.476675838f},
-std::array<float,2>{0.973892331f, 0.70100981f},
-std::array<float,2>{0.105751216f, 0.841902792f},
-std::array<float,2>{0.669223666f, 0.0123613328f},
-std::array<float,2>{0.152562544f, 0.435391337f},
-std::array<float,2>{0.590115309f, 0.67190522f},
-std::array<float,2>{0.427094877f, 0.753807843f},
-std::array<float,2>{0.81256038f, 0.115682825f},
-std::array<float,2>{0.368836671f, 0.16677551f},
-std::array<float,2>{0.931913316f, 0.941215396f},
-std::array<float,2>{0.0228486825f, 0.593866408f},
-std::array<float,2>{0.743522286f, 0.339861989f},
-std::array<float,2>{0.0644725487f, 0.0439517573f},
-std::array<float,2>{0.636027813f, 0.869893432f},
-std::array<float,2>{0.291457683f, 0.749166429f},
-std::array<float,2>{0.939599216f, 0.463490665f},
-std::array<float,2>{0.491957754f, 0.29621762f},
-std::array<float,2>{0.753606975f, 0.551319242f},
-std::array<float,2>{0.203929484f, 0.885009706f},
-std::array<float,2>{0.56231308f, 0.211462557f},
-std::array<float,2>{0.124050498f, 0.441702336f},
-std::array<float,2>{0.686634541f, 0.72085464f},
-std::array<float,2>{0.261389107f, 0.849979103f},
-std::array<float,2>{0.987276435f, 0.0538904369f},
-std::array<float,2>{0.448304027f, 0.19234243f},
-std::array<float,2>{0.807465792f, 0.894336104f},
-std::array<float,2>{0.235275641f, 0.53547883f},
-std::array<float,2>{0.51945287f, 0.304722518f},
-std::array<float,2>{0.182305694f, 0.104397908f},
-std::array<float,2>{0.622975349f, 0.781143606f},
-std::array<float,2>{0.389549464f, 0.664792895f},
-std::array<float,2>{0.849889576f, 0.420898497f},
-std::array<float,2>{0.331006527f, 0.325690776f},
-std::array<float,2>{0.884031892f, 0.619680345f},
-std::array<float,2>{0.0356098935f, 0.968288243f},
-std::array<float,2>{0.690679073f, 0.177629739f},
-std::array<float,2>{0.188565761f, 0.276902944f},
-std::array<float,2>{0.537886381f, 0.503742993f},
-std::array<float,2>{0.471693546f, 0.927017808f},
-std::array<float,2>{0.767676532f, 0.246120334f},
-std::array<float,2>{0.299265712f, 0.0270084087f},
-std::array<float,2>{0.959261417f, 0.826354206f},
-std::array<float,2>{0.0910336971f, 0.707687557f},
-std::array<float,2>{0.643121421f, 0.485004455f},
-std::array<float,2>{0.00508902268f, 0.131983876f},
-std::array<float,2>{0.723474324f, 0.980677187f},
-std::array<float,2>{0.355163664f, 0.569228828f},
-std::array<float,2>{0.906312406f, 0.369793236f},
-std::array<float,2>{0.420943528f, 0.399906904f},
-std::array<float,2>{0.839345098f, 0.634813368f},
-std::array<float,2>{0.13046059f, 0.798597813f},
-std::array<float,2>{0.569305182f, 0.0625354946f},
-std::array<float,2>{0.0441739373f, 0.291583836f},
-std::array<float,2>{0.700005472f, 0.550563693f},
-std::array<float,2>{0.339932799f, 0.890364528f},
-std::array<float,2>{0.88169831f, 0.217883497f},
-std::array<float,2>{0.381220996f, 0.0394709297f},
-std::array<float,2>{0.858229935f, 0.873301804f},
-std::array<float,2>{0.176746488f, 0.743121147f},
-std::array<float,2>{0.611814022f, 0.46524176f},
-std::array<float,2>{0.24664624f, 0.168617189f},
-std::array<float,2>{0.523864508f, 0.941470027f},
-std::array<float,2>{0.44264403f, 0.599425435f},
-std::array<float,2>{0.799905419f, 0.337812126f},
-std::array<float,2>{0.256943524f, 0.430674523f},
-std::array<float,2>{0.995438099f, 0.677324712f},
-std::array<float,2>{0.113656439f, 0.757160425f},
-std::array<float,2>{0.673282623f, 0.111148804f},
-std::array<float,2>{0.1397264f, 0.483452976f},
-std::array<float,2>{0.57362318f, 0.698739469f},
-std::array<float,2>{0.410065353f, 0.836380124f},
-std::array<float,2>{0.831610739f, 0.0106551144f},
-std::array<float,2>{0.34425208f, 0.230351195f},
-std::array<float,2>{0.920865357f, 0.909075975f},
-std::array<float,2>{0.0109770549f, 0.520768881f},
-std::array<float,2>{0.731257975f, 0.256339639f},
-std::array<float,2>{0.079895243f, 0.0929161534f},
-std::array<float,2>{0.654898822f, 0.795930326f},
-std::array<float,2>{0.310005277f, 0.649506032f},
-std::array<float,2>{0.968439758f, 0.385516316f},
-std::array<float,2>{0.477843821f, 0.356484741f},
-std::array<float,2>{0.780985951f, 0.579418302f},
-std::array<float,2>{0.200501636f, 0.991197228f},
-std::array<float,2>{0.543438792f, 0.151308075f},
-std::array<float,2>{0.0974932909f, 0.40440461f},
-std::array<float,2>{0.661385953f, 0.640325308f},
-std::array<float,2>{0.26703766f, 0.802193522f},
-std::array<float,2>{0.980325043f, 0.0667943805f},
-std::array<float,2>{0.464432597f, 0.128245875f},
-std::array<float,2>{0.795181334f, 0.977237105f},
-std::array<float,2>{0.230152607f, 0.563566744f},
-std::array<float,2>{0.514751494f, 0.374817133f},
-std::array<float,2>{0.163585603f, 0.0301115103f},
-std::array<float,2>{0.601968884f, 0.82113713f},
-std::array<float,2>{0.392061025f, 0.703580856f},
-std::array<float,2>{0.862842441f, 0.491413116f},
-std::array<float,2>{0.321766198f, 0.281141609f},
-std::array<float,2>{0.905741274f, 0.506101549f},
-std::array<float,2>{0.0565525964f, 0.924566507f},
-std::array<float,2>{0.71694237f, 0.245787144f},
-std::array<float,2>{0.216578886f, 0.321101308f},
-std::array<float,2>{0.554340422f, 0.623886406f},
-std::array<float,2>{0.496443748f, 0.962605834f},
-std::array<float,2>{0.761788607f, 0.175183997f},
-std::array<float,2>{0.281503558f, 0.108831838f},
-std::array<float,2>{0.948720634f, 0.775375068f},
-std::array<float,2>{0.0768705383f, 0.668055713f},
-std::array<float,2>{0.627254963f, 0.415225089f},
-std::array<float,2>{0.0270577613f, 0.188410282f},
-std::array<float,2>{0.735153794f, 0.894872546f},
-std::array<float,2>{0.359840542f, 0.534529269f},
-std::array<float,2>{0.927535117f, 0.311291903f},
-std::array<float,2>{0.436841011f, 0.43964994f},
-std::array<float,2>{0.823924482f, 0.724105418f},
-std::array<float,2>{0.143970743f, 0.84486264f},
-std::array<float,2>{0.581505656f, 0.050045941f},
-std::array<float,2>{0.0664558187f, 0.365882993f},
-std::array<float,2>{0.637013018f, 0.577325463f},
-std::array<float,2>{0.295504957f, 0.974433601f},
-std::array<float,2>{0.942175329f, 0.132894561f},
-std::array<float,2>{0.487564892f, 0.0772762597f},
-std::array<float,2>{0.754654884f, 0.808709264f},
-std::array<float,2>{0.207627282f, 0.63176924f},
-std::array<float,2>{0.556802571f, 0.392024934f},
-std::array<float,2>{0.151151329f, 0.240043625f},
-std::array<float,2>{0.586779594f, 0.933936715f},
-std::array<float,2>{0.422617882f, 0.514377773f},
-std::array<float,2>{0.817738056f, 0.271162897f},
-std::array<float,2>{0.372926295f, 0.49332419f},
-std::array<float,2>{0.935008049f, 0.716358781f},
-std::array<float,2>{0.0172463488f, 0.814574122f},
-std::array<float,2>{0.74819088f, 0.0167967509f},
-std::array<float,2>{0.223292038f, 0.409597278f},
-std::array<float,2>{0.50723958f, 0.660081506f},
-std::array<float,2>{0.456576526f, 0.770752728f},
-std::array<float,2>{0.784254074f, 0.100135714f},
-std::array<float,2>{0.279910117f, 0.184462547f},
-std::array<float,2>{0.972058356f, 0.960522234f},
-std::array<float,2>{0.102982745f, 0.612365603f},
-std::array<float,2>{0.664142072f, 0.319043189f},
-std::array<float,2>{0.0516127534f, 0.0604070276f},
-std::array<float,2>{0.706080377f, 0.857480764f},
-std::array<float,2>{0.314370155f, 0.729241669f},
-std::array<float,2>{0.896103799f, 0.446332127f},
-std::array<float,2>{0.404404104f, 0.302994817f},
-std::array<float,2>{0.867250443f, 0.542397261f},
-std::array<float,2>{0.170267865f, 0.903161645f},
-std::array<float,2>{0.59543997f, 0.195764214f},
-std::array<float,2>{0.00221765111f, 0.453190625f},
-std::array<float,2>{0.719032526f, 0.739092767f},
-std::array<float,2>{0.358610094f, 0.860094428f},
-std::array<float,2>{0.910370231f, 0.0355253629f},
-std::array<float,2>{0.415335208f, 0.209703669f},
-std::array<float,2>{0.840782464f, 0.882146358f},
-std::array<float,2>{0.125674978f, 0.556310236f},
-std::array<float,2>{0.562624753f, 0.286279321f},
-std::array<float,2>{0.194840804f, 0.122392677f},
-std::array<float,2>{0.532923222f, 0.763764024f},
-std::array<float,2>{0.476292282f, 0.682734966f},
-std::array<float,2>{0.773299396f, 0.424213856f},
-std::array<float,2>{0.300781876f, 0.330228686f},
-std::array<float,2>{0.956159174f, 0.608624578f},
-std::array<float,2>{0.0878424719f, 0.953073502f},
-std::array<float,2>{0.647965431f, 0.163775578f},
-std::array<float,2>{0.187077537f, 0.263278693f},
-std::array<float,2>{0.621024549f, 0.528613627f},
-std::array<float,2>{0.38421315f, 0.919036448f},
-std::array<float,2>{0.847068846f, 0.224819869f},
-std::array<float,2>{0.332286954f, 0.00227166689f},
-std::array<float,2>{0.887931883f, 0.834683478f},
-std::array<float,2>{0.0350074545f, 0.693283916f},
-std::array<float,2>{0.69140631f, 0.473930001f},
-std::array<float,2>{0.117754333f, 0.14120923f},
-std::array<float,2>{0.680989444f, 0.99514854f},
-std::array<float,2>{0.262032688f, 0.592238009f},
-std::array<float,2>{0.990261674f, 0.345454365f},
-std::array<float,2>{0.45282349f, 0.379834443f},
-std::array<float,2>{0.812484622f, 0.646735609f},
-std::array<float,2>{0.241500884f, 0.786610663f},
-std::array<float,2>{0.520021498f, 0.0845191404f},
-std::array<float,2>{0.111756988f, 0.265793711f},
-std::array<float,2>{0.676208079f, 0.508871198f},
-std::array<float,2>{0.252944529f, 0.930532992f},
-std::array<float,2>{0.999740243f, 0.23820895f},
-std::array<float,2>{0.439030826f, 0.0230739042f},
-std::array<float,2>{0.802901089f, 0.817179203f},
-std::array<float,2>{0.243529975f, 0.711645067f},
-std::array<float,2>{0.529234529f, 0.49619478f},
-std::array<float,2>{0.17449452f, 0.136728778f},
-std::array<float,2>{0.613339245f, 0.971796751f},
-std::array<float,2>{0.377846956f, 0.573073566f},
-std::array<float,2>{0.853630781f, 0.360021919f},
-std::array<float,2>{0.338782579f, 0.395888358f},
-std::array<float,2>{0.87764895f, 0.626669228f},
-std::array<float,2>{0.0428340733f, 0.808356583f},
-std::array<float,2>{0.698660791f, 0.0735599101f},
-std::array<float,2>{0.198822632f, 0.449440211f},
-std::array<float,2>{0.541498184f, 0.730590403f},
-std::array<float,2>{0.481626481f, 0.852355003f},
-std::array<float,2>{0.775840819f, 0.0580873601f},
-std::array<float,2>{0.308003277f, 0.201523006f},
-std::array<float,2>{0.963478982f, 0.900526285f},
-std::array<float,2>{0.0823078901f, 0.544379115f},
-std::array<float,2>{0.65233779f, 0.298197716f},
-std::array<float,2>{0.0120668933f, 0.095246762f},
-std::array<float,2>{0.729926586f, 0.766623914f},
-std::array<float,2>{0.350965828f, 0.663660944f},
-std::array<float,2>{0.916869104f, 0.410297364f},
-std::array<float,2>{0.413011283f, 0.314599097f},
-std::array<float,2>{0.832420111f, 0.616773546f},
-std::array<float,2>{0.136510283f, 0.955344439f},
-std::array<float,2>{0.574492276f, 0.181767598f},
-std::array<float,2>{0.0620474331f, 0.427384853f},
-std::array<float,2>{0.714164257f, 0.685578167f},
-std::array<float,2>{0.326374978f, 0.758512855f},
-std::array<float,2>{0.899464667f, 0.119194381f},
-std::array<float,2>{0.395012915f, 0.156294435f},
-std::array<float,2>{0.865596056f, 0.949013174f},
-std::array<float,2>{0.157898217f, 0.604261816f},
-std::array<float,2>{0.606233597f, 0.335636407f},
-std::array<float,2>{0.231012583f, 0.0337327719f},
-std::array<float,2>{0.509267151f, 0.866012514f},
-std::array<float,2>{0.46810925f, 0.735131621f},
-std::array<float,2>{0.792045116f, 0.459730059f},
-std::array<float,2>{0.272733837f, 0.282389909f},
-std::array<float,2>{0.982791126f, 0.560253501f},
-std::array<float,2>{0.0982241556f, 0.877492428f},
-std::array<float,2>{0.658941507f, 0.204384461f},
-std::array<float,2>{0.146865666f, 0.350468963f},
-std::array<float,2>{0.585495472f, 0.586113751f},
-std::array<float,2>{0.430380046f, 0.997794747f},
-std::array<float,2>{0.826866567f, 0.145579427f},
-std::array<float,2>{0.363422602f, 0.0816366002f},
-std::array<float,2>{0.923482537f, 0.782459021f},
-std::array<float,2>{0.0311031137f, 0.643967569f},
-std::array<float,2>{0.740602553f, 0.378067851f},
-std::array<float,2>{0.0716841221f, 0.220082909f},
-std::array<float,2>{0.631455719f, 0.917776108f},
-std::array<float,2>{0.286655694f, 0.523537815f},
-std::array<float,2>{0.950776935f, 0.260759234f},
-std::array<float,2>{0.495721728f, 0.471655309f},
-std::array<float,2>{0.759056985f, 0.689351678f},
-std::array<float,2>{0.211414292f, 0.830952168f},
-std::array<float,2>{0.548000157f, 0.00735302316f},
-std::array<float,2>{0.0203442834f, 0.3427369f},
-std::array<float,2>{0.744173527f, 0.597553611f},
-std::array<float,2>{0.370519221f, 0.938650668f},
-std::array<float,2>{0.931352198f, 0.164431989f},
-std::array<float,2>{0.428867131f, 0.113449432f},
-std::array<float,2>{0.81629771f, 0.750131726f},
-std::array<float,2>{0.154410392f, 0.675049365f},
-std::array<float,2>{0.592487216f, 0.435605794f},
-std::array<float,2>{0.206578642f, 0.213448495f},
-std::array<float,2>{0.560132146f, 0.883689404f},
-std::array<float,2>{0.488689065f, 0.554230571f},
-std::array<float,2>{0.750223875f, 0.29302749f},
-std::array<float,2>{0.290081739f, 0.4617953f},
-std::array<float,2>{0.937840581f, 0.747690916f},
-std::array<float,2>{0.0640647337f, 0.868142068f},
-std::array<float,2>{0.633992612f, 0.0463097356f},
-std::array<float,2>{0.165015116f, 0.387219787f},
-std::array<float,2>{0.59847939f, 0.652916133f},
-std::array<float,2>{0.399446994f, 0.790464044f},
-std::array<float,2>{0.874984384f, 0.0876534209f},
-std::array<float,2>{0.316500843f, 0.152825132f},
-std::array<float,2>{0.892009914f, 0.985366046f},
-std::array<float,2>{0.0479086079f, 0.583092749f},
-std::array<float,2>{0.708326459f, 0.354914844f},
-std::array<float,2>{0.107429788f, 0.0139567396f},
-std::array<float,2>{0.670051038f, 0.841486096f},
-std::array<float,2>{0.274634868f, 0.702105343f},
-std::array<float,2>{0.97601825f, 0.47895208f},
-std::array<float,2>{0.460082978f, 0.251552314f},
-std::array<float,2>{0.78579247f, 0.517454922f},
-std::array<float,2>{0.221168533f, 0.91018647f},
-std::array<float,2>{0.501801014f, 0.23387377f},
-std::array<float,2>{0.0935380012f, 0.487761229f},
-std::array<float,2>{0.642493188f, 0.709340155f},
-std::array<float,2>{0.298308194f, 0.82599479f},
-std::array<float,2>{0.95727849f, 0.0234527104f},
-std::array<float,2>{0.468933046f, 0.248643145f},
-std::array<float,2>{0.765892923f, 0.928971589f},
-std::array<float,2>{0.190253332f, 0.500459313f},
-std::array<float,2>{0.535309136f, 0.273984641f},
-std::array<float,2>{0.131067842f, 0.0658133328f},
-std::array<float,2>{0.567787111f, 0.799593687f},
-std::array<float,2>{0.418031842f, 0.634362698f},
-std::array<float,2>{0.836122453f, 0.402051926f},
-std::array<float,2>{0.353403986f, 0.367739826f},
-std::array<float,2>{0.908632278f, 0.566431284f},
-std::array<float,2>{0.00762250414f, 0.984342277f},
-std::array<float,2>{0.726558506f, 0.130160034f},
-std::array<float,2>{0.23705247f, 0.307816863f},
-std::array<float,2>{0.516344488f, 0.538556814f},
-std::array<float,2>{0.445970118f, 0.890829444f},
-std::array<float,2>{0.805971444f, 0.194061786f},
-std::array<float,2>{0.258230239f, 0.0508879051f},
-std::array<float,2>{0.98484844f, 0.849286139f},
-std::array<float,2>{0.121211499f, 0.72058934f},
-std::array<float,2>{0.684803665f, 0.444570988f},
-std::array<float,2>{0.037840575f, 0.179525271f},
-std::array<float,2>{0.688033044f, 0.965442181f},
-std::array<float,2>{0.329308122f, 0.618894398f},
-std::array<float,2>{0.886036873f, 0.32812193f},
-std::array<float,2>{0.387029976f, 0.418416291f},
-std::array<float,2>{0.847975314f, 0.66751653f},
-std::array<float,2>{0.180939406f, 0.778202236f},
-std::array<float,2>{0.624305844f, 0.102143832f},
-std::array<float,2>{0.0244581811f, 0.311683714f},
-std::array<float,2>{0.737454653f, 0.533616424f},
-std::array<float,2>{0.361974388f, 0.896037579f},
-std::array<float,2>{0.928869486f, 0.188780546f},
-std::array<float,2>{0.434141278f, 0.0493243337f},
-std::array<float,2>{0.820589066f, 0.843878984f},
-std::array<float,2>{0.14245905f, 0.72280997f},
-std::array<float,2>{0.57901454f, 0.441275567f},
-std::array<float,2>{0.217487454f, 0.173998863f},
-std::array<float,2>{0.551822722f, 0.961295009f},
-std::array<float,2>{0.498504937f, 0.624218285f},
-std::array<float,2>{0.763739109f, 0.322199494f},
-std::array<float,2>{0.283998787f, 0.414815307f},
-std::array<float,2>{0.946061492f, 0.669393301f},
-std::array<float,2>{0.0758907944f, 0.774201632f},
-std::array<float,2>{0.625168085f, 0.107915804f},
-std::array<float,2>{0.161230251f, 0.491157889f},
-std::array<float,2>{0.603553116f, 0.704972923f},
-std::array<float,2>{0.392781764f, 0.822126269f},
-std::array<float,2>{0.860892236f, 0.0303606074f},
-std::array<float,2>{0.323152393f, 0.244788483f},
-std::array<float,2>{0.904256105f, 0.924980938f},
-std::array<float,2>{0.0568110943f, 0.507293701f},
-std::array<float,2>{0.716550052f, 0.279973f},
-std::array<float,2>{0.0950406566f, 0.06790483f},
-std::array<float,2>{0.662349641f, 0.801235974f},
-std::array<float,2>{0.267814368f, 0.639012277f},
-std::array<float,2>{0.978233278f, 0.405985743f},
-std::array<float,2>{0.461163849f, 0.37401551f},
-std::array<float,2>{0.794225037f, 0.56257534f},
-std::array<float,2>{0.227761701f, 0.977825046f},
-std::array<float,2>{0.512111783f, 0.127233669f},
-std::array<float,2>{0.0815943182f, 0.386576533f},
-std::array<float,2>{0.653875351f, 0.648467243f},
-std::array<float,2>{0.310857296f, 0.795137286f},
-std::array<float,2>{0.966488183f, 0.0926852077f},
-std::array<float,2>{0.479313403f, 0.151545107f},
-std::array<float,2>{0.779069543f, 0.991525531f},
-std::array<float,2>{0.202614129f, 0.578988731f},
-std::array<float,2>{0.545387089f, 0.355755538f},
-std::array<float,2>{0.136933267f, 0.0114421817f},
-std::array<float,2>{0.57053858f, 0.837461293f},
-std::array<float,2>{0.406534672f, 0.69776994f},
-std::array<float,2>{0.829657555f, 0.482689708f},
-std::array<float,2>{0.346045762f, 0.257691175f},
-std::array<float,2>{0.918615222f, 0.520055711f},
-std::array<float,2>{0.00970672723f, 0.909990251f},
-std::array<float,2>{0.733029366f, 0.229353651f},
-std::array<float,2>{0.248866931f, 0.336769521f},
-std::array<float,2>{0.525527418f, 0.597665489f},
-std::array<float,2>{0.44505927f, 0.943324327f},
-std::array<float,2>{0.797098815f, 0.169323087f},
-std::array<float,2>{0.25556156f, 0.109895565f},
-std::array<float,2>{0.993002117f, 0.756331027f},
-std::array<float,2>{0.115727559f, 0.675952315f},
-std::array<float,2>{0.674978435f, 0.429802746f},
-std::array<float,2>{0.0456266291f, 0.21751225f},
-std::array<float,2>{0.701931119f, 0.889053881f},
-std::array<float,2>{0.342069864f, 0.549157381f},
-std::array<float,2>{0.87908119f, 0.292830944f},
-std::array<float,2>{0.380582988f, 0.465928674f},
-std::array<float,2>{0.855784416f, 0.743702948f},
-std::array<float,2>{0.177855149f, 0.874804795f},
-std::array<float,2>{0.610850275f, 0.0401042551f},
-std::array<float,2>{0.119760424f, 0.344016701f},
-std::array<float,2>{0.681843638f, 0.593409956f},
-std::array<float,2>{0.265589178f, 0.994303405f},
-std::array<float,2>{0.988994658f, 0.141685709f},
-std::array<float,2>{0.451134801f, 0.0850121602f},
-std::array<float,2>{0.80938983f, 0.785548866f},
-std::array<float,2>{0.239429772f, 0.647962689f},
-std::array<float,2>{0.522562683f, 0.379921764f},
-std::array<float,2>{0.184293479f, 0.226250187f},
-std::array<float,2>{0.61901176f, 0.918059289f},
-std::array<float,2>{0.385011494f, 0.527893603f},
-std::array<float,2>{0.84431833f, 0.262228012f},
-std::array<float,2>{0.335369945f, 0.473220348f},
-std::array<float,2>{0.888777196f, 0.691523135f},
-std::array<float,2>{0.0328742489f, 0.835084021f},
-std::array<float,2>{0.693721533f, 0.003481413f},
-std::array<float,2>{0.191718489f, 0.425716907f},
-std::array<float,2>{0.535066962f, 0.682489872f},
-std::array<float,2>{0.473707438f, 0.765546858f},
-std::array<float,2>{0.771024227f, 0.121097356f},
-std::array<float,2>{0.303640991f, 0.162147194f},
-std::array<float,2>{0.953643382f, 0.951256335f},
-std::array<float,2>{0.0895244032f, 0.607630908f},
-std::array<float,2>{0.646305799f, 0.331814677f},
-std::array<float,2>{0.00170308584f, 0.0368174613f},
-std::array<float,2>{0.722527802f, 0.860754192f},
-std::array<float,2>{0.357381523f, 0.739905655f},
-std::array<float,2>{0.912214875f, 0.454952776f},
-std::array<float,2>{0.416177928f, 0.285702348f},
-std::array<float,2>{0.843476832f, 0.554775715f},
-std::array<float,2>{0.128582656f, 0.881701529f},
-std::array<float,2>{0.565885127f, 0.210380897f},
-std::array<float,2>{0.0538408421f, 0.445754945f},
-std::array<float,2>{0.703640103f, 0.729496002f},
-std::array<float,2>{0.315434247f, 0.859366536f},
-std::array<float,2>{0.897761464f, 0.0589159168f},
-std::array<float,2>{0.40277192f, 0.196740746f},
-std::array<float,2>{0.869854271f, 0.904052556f},
-std::array<float,2>{0.16935201f, 0.541235507f},
-std::array<float,2>{0.595709741f, 0.304561049f},
-std::array<float,2>{0.226123959f, 0.100741208f},
-std::array<float,2>{0.505182445f, 0.7704615f},
-std::array<float,2>{0.454450101f, 0.658907831f},
-std::array<float,2>{0.782264709f, 0.408840925f},
-std::array<float,2>{0.278051347f, 0.319341749f},
-std::array<float,2>{0.970319927f, 0.611379087f},
-std::array<float,2>{0.105193622f, 0.959880769f},
-std::array<float,2>{0.66737175f, 0.184762716f},
-std::array<float,2>{0.149047568f, 0.270465612f},
-std::array<float,2>{0.588735282f, 0.515361667f},
-std::array<float,2>{0.424699932f, 0.934639394f},
-std::array<float,2>{0.819521725f, 0.238807231f},
-std::array<float,2>{0.37388432f, 0.016369747f},
-std::array<float,2>{0.937299907f, 0.815956175f},
-std::array<float,2>{0.019464273f, 0.715735495f},
-std::array<float,2>{0.746393502f, 0.492413908f},
-std::array<float,2>{0.070017457f, 0.134020954f},
-std::array<float,2>{0.639693081f, 0.973292828f},
-std::array<float,2>{0.293134958f, 0.576801777f},
-std::array<float,2>{0.944647133f, 0.366485059f},
-std::array<float,2>{0.485022962f, 0.391432345f},
-std::array<float,2>{0.756006479f, 0.631974041f},
-std::array<float,2>{0.21078749f, 0.810331106f},
-std::array<float,2>{0.554733276f, 0.0770869628f},
-std::array<float,2>{0.0736457258f, 0.260115981f},
-std::array<float,2>{0.629709959f, 0.525279522f},
-std::array<float,2>{0.287432581f, 0.916424513f},
-std::array<float,2>{0.951987386f, 0.219126076f},
-std::array<float,2>{0.493175805f, 0.0059700124f},
-std::array<float,2>{0.760006368f, 0.831473887f},
-std::array<float,2>{0.214224055f, 0.688251555f},
-std::array<float,2>{0.548946083f, 0.472426444f},
-std::array<float,2>{0.145116329f, 0.145451665f},
-std::array<float,2>{0.582731783f, 0.996960163f},
-std::array<float,2>{0.432546884f, 0.586989164f},
-std::array<float,2>{0.82444185f, 0.35080117f},
-std::array<float,2>{0.36706987f, 0.377427757f},
-std::array<float,2>{0.924206913f, 0.643130362f},
-std::array<float,2>{0.0274820868f, 0.781557143f},
-std::array<float,2>{0.738788068f, 0.0801312327f},
-std::array<float,2>{0.232789874f, 0.460321069f},
-std::array<float,2>{0.511017382f, 0.735955954f},
-std::array<float,2>{0.466157526f, 0.866285443f},
-std::array<float,2>{0.789427459f, 0.0345470197f},
-std::array<float,2>{0.269985139f, 0.203554347f},
-std::array<float,2>{0.982322574f, 0.87838167f},
-std::array<float,2>{0.0996444896f, 0.5589028f},
-std::array<float,2>{0.658193409f, 0.282160431f},
-std::array<float,2>{0.0598958731f, 0.120157197f},
-std::array<float,2>{0.710969925f, 0.759346306f},
-std::array<float,2>{0.32568863f, 0.68736583f},
-std::array<float,2>{0.901162267f, 0.426041126f},
-std::array<float,2>{0.396928459f, 0.334162384f},
-std::array<float,2>{0.864753664f, 0.604655206f},
-std::array<float,2>{0.159774482f, 0.947701812f},
-std::array<float,2>{0.608014166f, 0.158105403f},
-std::array<float,2>{0.0139334667f, 0.411299407f},
-std::array<float,2>{0.726855457f, 0.662558138f},
-std::array<float,2>{0.349530786f, 0.765890121f},
-std::array<float,2>{0.915006101f, 0.0941968858f},
-std::array<float,2>{0.410843253f, 0.183548301f},
-std::array<float,2>{0.835269868f, 0.956821442f},
-std::array<float,2>{0.133526936f, 0.615820706f},
-std::array<float,2>{0.577399373f, 0.316166401f},
-std::array<float,2>{0.195896462f, 0.0570746027f},
-std::array<float,2>{0.539407849f, 0.852643192f},
-std::array<float,2>{0.482756853f, 0.73154521f},
-std::array<float,2>{0.774879277f, 0.450259805f},
-std::array<float,2>{0.306196779f, 0.29689163f},
-std::array<float,2>{0.961530149f, 0.543923199f},
-std::array<float,2>{0.0856484175f, 0.902131557f},
-std::array<float,2>{0.649444818f, 0.20286721f},
-std::array<float,2>{0.173517555f, 0.361316144f},
-std::array<float,2>{0.615895987f, 0.573417127f},
-std::array<float,2>{0.376026809f, 0.971571922f},
-std::array<float,2>{0.851879716f, 0.13828972f},
-std::array<float,2>{0.33729285f, 0.0728605762f},
-std::array<float,2>{0.875432968f, 0.807115436f},
-std::array<float,2>{0.0401367582f, 0.625209928f},
-std::array<float,2>{0.695566475f, 0.395293027f},
-std::array<float,2>{0.110871814f, 0.237063751f},
-std::array<float,2>{0.678351998f, 0.931597471f},
-std::array<float,2>{0.2518107f, 0.507990181f},
-std::array<float,2>{0.996685624f, 0.26739496f},
-std::array<float,2>{0.440870196f, 0.497258157f},
-std::array<float,2>{0.802193105f, 0.712064385f},
-std::array<float,2>{0.244161814f, 0.818260431f},
-std::array<float,2>{0.530326426f, 0.0219134428f},
-std::array<float,2>{0.0363606066f, 0.326848537f},
-std::array<float,2>{0.689864993f, 0.617216229f},
-std::array<float,2>{0.331580043f, 0.966084421f},
-std::array<float,2>{0.883016825f, 0.178661555f},
-std::array<float,2>{0.39061752f, 0.103423223f},
-std::array<float,2>{0.851093471f, 0.778412998f},
-std::array<float,2>{0.182716638f, 0.666174114f},
-std::array<float,2>{0.621761978f, 0.419482738f},
-std::array<float,2>{0.236144662f, 0.195041329f},
-std::array<float,2>{0.517656267f, 0.891720891f},
-std::array<float,2>{0.447351098f, 0.537911236f},
-std::array<float,2>{0.808326006f, 0.307027519f},
-std::array<float,2>{0.260730326f, 0.443459898f},
-std::array<float,2>{0.987886071f, 0.719492972f},
-std::array<float,2>{0.123511754f, 0.848503768f},
-std::array<float,2>{0.686217725f, 0.0518827364f},
-std::array<float,2>{0.129297122f, 0.401044667f},
-std::array<float,2>{0.569479406f, 0.633660436f},
-std::array<float,2>{0.420701802f, 0.800014317f},
-std::array<float,2>{0.838113606f, 0.065391466f},
-std::array<float,2>{0.354424506f, 0.129344031f},
-std::array<float,2>{0.907300055f, 0.982580543f},
-std::array<float,2>{0.00482443674f, 0.567628086f},
-std::array<float,2>{0.724447966f, 0.368741691f},
-std::array<float,2>{0.0901701003f, 0.0244144872f},
-std::array<float,2>{0.643716156f, 0.824908853f},
-std::array<float,2>{0.300142944f, 0.710051537f},
-std::array<float,2>{0.960563838f, 0.486596465f},
-std::array<float,2>{0.470884144f, 0.274641216f},
-std::array<float,2>{0.769315243f, 0.501763105f},
-std::array<float,2>{0.188025028f, 0.928389788f},
-std::array<float,2>{0.538938463f, 0.249790564f},
-std::array<float,2>{0.107420355f, 0.480039895f},
-std::array<float,2>{0.668495536f, 0.702712297f},
-std::array<float,2>{0.275747389f, 0.840820074f},
-std::array<float,2>{0.972943723f, 0.0155419568f},
-std::array<float,2>{0.458855599f, 0.233166546f},
-std::array<float,2>{0.78770721f, 0.911934376f},
-std::array<float,2>{0.219259068f, 0.516423643f},
-std::array<float,2>{0.502024114f, 0.250466198f},
-std::array<float,2>{0.166037038f, 0.0861918628f},
-std::array<float,2>{0.601135015f, 0.789802194f},
-std::array<float,2>{0.400697261f, 0.653374791f},
-std::array<float,2>{0.872843385f, 0.388383716f},
-std::array<float,2>{0.318413854f, 0.353591621f},
-std::array<float,2>{0.893435895f, 0.582836807f},
-std::array<float,2>{0.0502706133f, 0.984908104f},
-std::array<float,2>{0.710897267f, 0.15402177f},
-std::array<float,2>{0.204195738f, 0.294629186f},
-std::array<float,2>{0.560559392f, 0.553306282f},
-std::array<float,2>{0.491128534f, 0.884522796f},
-std::array<float,2>{0.75196135f, 0.214361429f},
-std::array<float,2>{0.292539924f, 0.0455990508f},
-std::array<float,2>{0.941187799f, 0.868806362f},
-std::array<float,2>{0.0658580437f, 0.746788502f},
-std::array<float,2>{0.635186434f, 0.462234437f},
-std::array<float,2>{0.021930119f, 0.165266305f},
-std::array<float,2>{0.742653191f, 0.937776029f},
-std::array<float,2>{0.368157893f, 0.595979869f},
-std::array<float,2>{0.933361709f, 0.342880487f},
-std::array<float,2>{0.426586092f, 0.436748624f},
-std::array<float,2>{0.813879073f, 0.674474776f},
-std::array<float,2>{0.15384753f, 0.751377344f},
-std::array<float,2>{0.591600537f, 0.115135103f},
-std::array<float,2>{0.0550577305f, 0.278576821f},
-std::array<float,2>{0.718372285f, 0.504728317f},
-std::array<float,2>{0.321043313f, 0.922809422f},
-std::array<float,2>{0.90500772f, 0.242368579f},
-std::array<float,2>{0.390793204f, 0.0290434193f},
-std::array<float,2>{0.861808717f, 0.822925746f},
-std::array<float,2>{0.163016021f, 0.706384361f},
-std::array<float,2>{0.602796435f, 0.488722444f},
-std::array<float,2>{0.228560343f, 0.126576483f},
-std::array<float,2>{0.51457417f, 0.97975117f},
-std::array<float,2>{0.463789523f, 0.566055655f},
-std::array<float,2>{0.796358049f, 0.372117102f},
-std::array<float,2>{0.265776515f, 0.40236026f},
-std::array<float,2>{0.978525519f, 0.637758076f},
-std::array<float,2>{0.0962746441f, 0.804204106f},
-std::array<float,2>{0.661041856f, 0.0688983798f},
-std::array<float,2>{0.14339225f, 0.439343661f},
-std::array<float,2>{0.580295086f, 0.725176752f},
-std::array<float,2>{0.436481476f, 0.84664458f},
-std::array<float,2>{0.822949588f, 0.0485045314f},
-std::array<float,2>{0.361292124f, 0.189688951f},
-std::array<float,2>{0.925918221f, 0.898238063f},
-std::array<float,2>{0.0261604749f, 0.532764614f},
-std::array<float,2>{0.735729992f, 0.309380502f},
-std::array<float,2>{0.0771714747f, 0.105944283f},
-std::array<float,2>{0.62828958f, 0.776146352f},
-std::array<float,2>{0.282278389f, 0.670602024f},
-std::array<float,2>{0.947560191f, 0.416262299f},
-std::array<float,2>{0.497362792f, 0.322658211f},
-std::array<float,2>{0.763015628f, 0.622895777f},
-std::array<float,2>{0.215279624f, 0.964089811f},
-std::array<float,2>{0.552772999f, 0.172843441f},
-std::array<float,2>{0.114366829f, 0.432968974f},
-std::array<float,2>{0.672531307f, 0.678811252f},
-std::array<float,2>{0.255907208f, 0.754402697f},
-std::array<float,2>{0.994896591f, 0.112544388f},
-std::array<float,2>{0.442051947f, 0.170032635f},
-std::array<float,2>{0.79941529f, 0.944354713f},
-std::array<float,2>{0.247560352f, 0.601316512f},
-std::array<float,2>{0.524580419f, 0.33939001f},
-std::array<float,2>{0.176811948f, 0.0424258262f},
-std::array<float,2>{0.612444997f, 0.871504724f},
-std::array<float,2>{0.382658541f, 0.745872736f},
-std::array<float,2>{0.859373093f, 0.468134493f},
-std::array<float,2>{0.341465384f, 0.289177537f},
-std::array<float,2>{0.88241291f, 0.546938181f},
-std::array<float,2>{0.0433386788f, 0.887316287f},
-std::array<float,2>{0.701058507f, 0.215589181f},
-std::array<float,2>{0.199707747f, 0.358780295f},
-std::array<float,2>{0.544120252f, 0.581564784f},
-std::array<float,2>{0.477377564f, 0.988686681f},
-std::array<float,2>{0.779852688f, 0.150126413f},
-std::array<float,2>{0.30869776f, 0.0898560286f},
-std::array<float,2>{0.96777302f, 0.793259382f},
-std::array<float,2>{0.0790375322f, 0.650772035f},
-std::array<float,2>{0.65534693f, 0.383123457f},
-std::array<float,2>{0.010696616f, 0.227897331f},
-std::array<float,2>{0.731588125f, 0.907752395f},
-std::array<float,2>{0.344739437f, 0.521814346f},
-std::array<float,2>{0.921528339f, 0.254137307f},
-std::array<float,2>{0.408301085f, 0.481893301f},
-std::array<float,2>{0.830747843f, 0.696419895f},
-std::array<float,2>{0.139185846f, 0.838088095f},
-std::array<float,2>{0.572473884f, 0.00972622912f},
-std::array<float,2>{0.086586602f, 0.328366041f},
-std::array<float,2>{0.646977603f, 0.605563939f},
-std::array<float,2>{0.302623928f, 0.949306965f},
-std::array<float,2>{0.955614746f, 0.161733851f},
-std::array<float,2>{0.475133955f, 0.123712108f},
-std::array<float,2>{0.771978378f, 0.762617409f},
-std::array<float,2>{0.193806887f, 0.680641174f},
-std::array<float,2>{0.531754255f, 0.423342973f},
-std::array<float,2>{0.126752689f, 0.207275867f},
-std::array<float,2>{0.563678265f, 0.88008368f},
-std::array<float,2>{0.414186537f, 0.557708919f},
-std::array<float,2>{0.840910494f, 0.287626296f},
-std::array<float,2>{0.358396202f, 0.455796182f},
-std::array<float,2>{0.911911845f, 0.741218269f},
-std::array<float,2>{0.00349174766f, 0.862297356f},
-std::array<float,2>{0.720575273f, 0.0389351062f},
-std::array<float,2>{0.240753368f, 0.382206172f},
-std::array<float,2>{0.521146119f, 0.644833326f},
-std::array<float,2>{0.451325536f, 0.788165748f},
-std::array<float,2>{0.810595989f, 0.082699433f},
-std::array<float,2>{0.263054401f, 0.143618003f},
-std::array<float,2>{0.992034197f, 0.993077815f},
-std::array<float,2>{0.11863596f, 0.590848029f},
-std::array<float,2>{0.680143833f, 0.346176684f},
-std::array<float,2>{0.0339537747f, 0.00192393141f},
-std::array<float,2>{0.693332255f, 0.832604229f},
-std::array<float,2>{0.333271295f, 0.693614244f},
-std::array<float,2>{0.887170792f, 0.476124376f},
-std::array<float,2>{0.38299346f, 0.26424253f},
-std::array<float,2>{0.846677721f, 0.530272067f},
-std::array<float,2>{0.185566992f, 0.920198619f},
-std::array<float,2>{0.619638383f, 0.224527866f},
-std::array<float,2>{0.0164810866f, 0.495835215f},
-std::array<float,2>{0.749223828f, 0.7177338f},
-std::array<float,2>{0.371293694f, 0.813756824f},
-std::array<float,2>{0.933739066f, 0.0181408115f},
-std::array<float,2>{0.422880083f, 0.241796389f},
-std::array<float,2>{0.816644013f, 0.937068284f},
-std::array<float,2>{0.15230301f, 0.51194942f},
-std::array<float,2>{0.587594092f, 0.272088975f},
-std::array<float,2>{0.208224058f, 0.0757539794f},
-std::array<float,2>{0.55770272f, 0.810732543f},
-std::array<float,2>{0.487130195f, 0.629829645f},
-std::array<float,2>{0.755423725f, 0.392800748f},
-std::array<float,2>{0.296611041f, 0.364657015f},
-std::array<float,2>{0.942583621f, 0.574851155f},
-std::array<float,2>{0.0683378503f, 0.975350559f},
-std::array<float,2>{0.638623536f, 0.136324704f},
-std::array<float,2>{0.171613783f, 0.300805181f},
-std::array<float,2>{0.594279349f, 0.539125562f},
-std::array<float,2>{0.405274481f, 0.904837191f},
-std::array<float,2>{0.868447423f, 0.198273286f},
-std::array<float,2>{0.313154101f, 0.0619071536f},
-std::array<float,2>{0.895246625f, 0.856080234f},
-std::array<float,2>{0.0526939109f, 0.728128433f},
-std::array<float,2>{0.705673218f, 0.447659999f},
-std::array<float,2>{0.101650804f, 0.186164454f},
-std::array<float,2>{0.665177584f, 0.957905769f},
-std::array<float,2>{0.280548871f, 0.611305475f},
-std::array<float,2>{0.970894873f, 0.317999244f},
-std::array<float,2>{0.455833256f, 0.406449199f},
-std::array<float,2>{0.783232331f, 0.658039749f},
-std::array<float,2>{0.224315256f, 0.772158623f},
-std::array<float,2>{0.505982578f, 0.0987864286f},
-std::array<float,2>{0.0990230292f, 0.284117073f},
-std::array<float,2>{0.659928858f, 0.561884463f},
-std::array<float,2>{0.271574974f, 0.875543594f},
-std::array<float,2>{0.98371774f, 0.206624746f},
-std::array<float,2>{0.467263043f, 0.0324742757f},
-std::array<float,2>{0.791823626f, 0.864412427f},
-std::array<float,2>{0.231624469f, 0.736981809f},
-std::array<float,2>{0.50797087f, 0.457304806f},
-std::array<float,2>{0.15722017f, 0.159215063f},
-std::array<float,2>{0.607393563f, 0.945722044f},
-std::array<float,2>{0.395613074f, 0.602218568f},
-std::array<float,2>{0.866970837f, 0.332246542f},
-std::array<float,2>{0.32774058f, 0.429137617f},
-std::array<float,2>{0.898666978f, 0.684208691f},
-std::array<float,2>{0.0605695099f, 0.760267258f},
-std::array<float,2>{0.713735282f, 0.11720258f},
-std::array<float,2>{0.212536633f, 0.468882143f},
-std::array<float,2>{0.547576249f, 0.690936923f},
-std::array<float,2>{0.49499613f, 0.828876019f},
-std::array<float,2>{0.757954776f, 0.00454947492f},
-std::array<float,2>{0.285440356f, 0.221168771f},
-std::array<float,2>{0.950062573f, 0.91434449f},
-std::array<float,2>{0.070491381f, 0.5262357f},
-std::array<float,2>{0.632543623f, 0.259582669f},
-std::array<float,2>{0.0293800682f, 0.0782055929f},
-std::array<float,2>{0.741621256f, 0.784108579f},
-std::array<float,2>{0.364955306f, 0.641701043f},
-std::array<float,2>{0.922788739f, 0.376677364f},
-std::array<float,2>{0.431048989f, 0.349495649f},
-std::array<float,2>{0.827564895f, 0.588850081f},
-std::array<float,2>{0.148326471f, 0.998869717f},
-std::array<float,2>{0.584040463f, 0.146875083f},
-std::array<float,2>{0.0411326811f, 0.397545308f},
-std::array<float,2>{0.69782424f, 0.626971424f},
-std::array<float,2>{0.339556336f, 0.805789053f},
-std::array<float,2>{0.87822783f, 0.0705455095f},
-std::array<float,2>{0.378203541f, 0.140032351f},
-std::array<float,2>{0.854665995f, 0.9706617f},
-std::array<float,2>{0.175083786f, 0.571840286f},
-std::array<float,2>{0.615090549f, 0.361480474f},
-std::array<float,2>{0.242791012f, 0.0212178808f},
-std::array<float,2>{0.528064549f, 0.819192886f},
-std::array<float,2>{0.437762886f, 0.71346426f},
-std::array<float,2>{0.804648161f, 0.499098271f},
-std::array<float,2>{0.252340347f, 0.268646598f},
-std::array<float,2>{0.998669982f, 0.509827912f},
-std::array<float,2>{0.113011241f, 0.932965398f},
-std::array<float,2>{0.677063048f, 0.23502323f},
-std::array<float,2>{0.135370001f, 0.313928276f},
-std::array<float,2>{0.575726092f, 0.614771307f},
-std::array<float,2>{0.413327426f, 0.954334855f},
-std::array<float,2>{0.833395839f, 0.181408271f},
-std::array<float,2>{0.350267619f, 0.0965658054f},
-std::array<float,2>{0.917391241f, 0.76933521f},
-std::array<float,2>{0.0130319903f, 0.660264015f},
-std::array<float,2>{0.728869081f, 0.413340509f},
-std::array<float,2>{0.0839426666f, 0.200310662f},
-std::array<float,2>{0.650551081f, 0.898655474f},
-std::array<float,2>{0.307263583f, 0.546312451f},
-std::array<float,2>{0.96440208f, 0.299312204f},
-std::array<float,2>{0.480469674f, 0.452052921f},
-std::array<float,2>{0.776548386f, 0.733968258f},
-std::array<float,2>{0.197491631f, 0.85398829f},
-std::array<float,2>{0.542532206f, 0.0557515956f},
-std::array<float,2>{0.00624251831f, 0.370535403f},
-std::array<float,2>{0.725138307f, 0.569783211f},
-std::array<float,2>{0.351579428f, 0.982159197f},
-std::array<float,2>{0.910124123f, 0.131437868f},
-std::array<float,2>{0.419621348f, 0.0635196939f},
-std::array<float,2>{0.83709228f, 0.797112823f},
-std::array<float,2>{0.132563174f, 0.63612771f},
-std::array<float,2>{0.566446006f, 0.398918331f},
-std::array<float,2>{0.190697953f, 0.247675657f},
-std::array<float,2>{0.536935985f, 0.926377058f},
-std::array<float,2>{0.469749153f, 0.502016068f},
-std::array<float,2>{0.767446697f, 0.275581777f},
-std::array<float,2>{0.297701955f, 0.485953718f},
-std::array<float,2>{0.958348989f, 0.708567381f},
-std::array<float,2>{0.0926121473f, 0.828014493f},
-std::array<float,2>{0.640902042f, 0.0263328888f},
-std::array<float,2>{0.180115566f, 0.420480847f},
-std::array<float,2>{0.623283327f, 0.665192902f},
-std::array<float,2>{0.388370663f, 0.779903948f},
-std::array<float,2>{0.849022508f, 0.104804426f},
-std::array<float,2>{0.328594655f, 0.176166654f},
-std::array<float,2>{0.885545433f, 0.967232168f},
-std::array<float,2>{0.038782429f, 0.620144606f},
-std::array<float,2>{0.688931108f, 0.325006306f},
-std::array<float,2>{0.122753464f, 0.0532106087f},
-std::array<float,2>{0.684078038f, 0.85107547f},
-std::array<float,2>{0.259257913f, 0.722305179f},
-std::array<float,2>{0.985898495f, 0.442537338f},
-std::array<float,2>{0.446375966f, 0.30586502f},
-std::array<float,2>{0.804780126f, 0.536310911f},
-std::array<float,2>{0.237608418f, 0.892866969f},
-std::array<float,2>{0.516624928f, 0.193118587f},
-std::array<float,2>{0.0627476871f, 0.464107364f},
-std::array<float,2>{0.633622587f, 0.748357654f},
-std::array<float,2>{0.289867789f, 0.870328307f},
-std::array<float,2>{0.939157069f, 0.0431726128f},
-std::array<float,2>{0.490119636f, 0.21229732f},
-std::array<float,2>{0.751908839f, 0.885789812f},
-std::array<float,2>{0.205747828f, 0.552575171f},
-std::array<float,2>{0.55949384f, 0.295860618f},
-std::array<float,2>{0.156020284f, 0.11707487f},
-std::array<float,2>{0.592790604f, 0.752760947f},
-std::array<float,2>{0.427893698f, 0.673326373f},
-std::array<float,2>{0.814952433f, 0.433772057f},
-std::array<float,2>{0.369357854f, 0.34135583f},
-std::array<float,2>{0.929700494f, 0.594862819f},
-std::array<float,2>{0.0211336873f, 0.939723432f},
-std::array<float,2>{0.745357811f, 0.167499259f},
-std::array<float,2>{0.222546384f, 0.253013223f},
-std::array<float,2>{0.500366867f, 0.519034266f},
-std::array<float,2>{0.459160835f, 0.914019465f},
-std::array<float,2>{0.786598921f, 0.232059598f},
-std::array<float,2>{0.274293363f, 0.0132247955f},
-std::array<float,2>{0.975510001f, 0.843211353f},
-std::array<float,2>{0.109301947f, 0.700025797f},
-std::array<float,2>{0.671593189f, 0.477790028f},
-std::array<float,2>{0.0470608622f, 0.155022547f},
-std::array<float,2>{0.707217097f, 0.987131655f},
-std::array<float,2>{0.317699522f, 0.584573269f},
-std::array<float,2>{0.891593397f, 0.352425635f},
-std::array<float,2>{0.398679674f, 0.390268862f},
-std::array<float,2>{0.873966336f, 0.655175447f},
-std::array<float,2>{0.165893868f, 0.79123193f},
-std::array<float,2>{0.598876297f, 0.0889665335f},
-std::array<float,2>{0.0186984353f, 0.271679074f},
-std::array<float,2>{0.746737242f, 0.512458801f},
-std::array<float,2>{0.373280615f, 0.936930537f},
-std::array<float,2>{0.936689138f, 0.241516739f},
-std::array<float,2>{0.424191803f, 0.0180117022f},
-std::array<float,2>{0.820154309f, 0.81440866f},
-std::array<float,2>{0.148596793f, 0.71707654f},
-std::array<float,2>{0.587989867f, 0.495413482f},
-std::array<float,2>{0.210336283f, 0.136198089f},
-std::array<float,2>{0.555438161f, 0.974774539f},
-std::array<float,2>{0.484836549f, 0.574612319f},
-std::array<float,2>{0.756779552f, 0.364822447f},
-std::array<float,2>{0.293519586f, 0.393071294f},
-std::array<float,2>{0.9450441f, 0.629139662f},
-std::array<float,2>{0.0695594177f, 0.811037481f},
-std::array<float,2>{0.64046973f, 0.0753868148f},
-std::array<float,2>{0.169464856f, 0.447954208f},
-std::array<float,2>{0.596677423f, 0.727641404f},
-std::array<float,2>{0.4032377f, 0.855591893f},
-std::array<float,2>{0.869612157f, 0.0623035803f},
-std::array<float,2>{0.316146016f, 0.199100807f},
-std::array<float,2>{0.898383141f, 0.904628992f},
-std::array<float,2>{0.0545612574f, 0.539663732f},
-std::array<float,2>{0.70356226f, 0.301352143f},
-std::array<float,2>{0.10467644f, 0.0994828343f},
-std::array<float,2>{0.667610943f, 0.771895349f},
-std::array<float,2>{0.277528584f, 0.657427251f},
-std::array<float,2>{0.969771445f, 0.407210141f},
-std::array<float,2>{0.455020875f, 0.317656159f},
-std::array<float,2>{0.783155143f, 0.610792458f},
-std::array<float,2>{0.225708887f, 0.957500577f},
-std::array<float,2>{0.505710542f, 0.185933799f},
-std::array<float,2>{0.0891774893f, 0.422985703f},
-std::array<float,2>{0.645994842f, 0.67973268f},
-std::array<float,2>{0.302910417f, 0.76192838f},
-std::array<float,2>{0.953399479f, 0.123200305f},
-std::array<float,2>{0.474580467f, 0.161514908f},
-std::array<float,2>{0.770517468f, 0.950109482f},
-std::array<float,2>{0.191928342f, 0.606114089f},
-std::array<float,2>{0.534319878f, 0.328616112f},
-std::array<float,2>{0.128383234f, 0.0381088145f},
-std::array<float,2>{0.566391408f, 0.861406684f},
-std::array<float,2>{0.416881502f, 0.741801441f},
-std::array<float,2>{0.84313792f, 0.455314428f},
-std::array<float,2>{0.356538206f, 0.287262321f},
-std::array<float,2>{0.912758946f, 0.558378518f},
-std::array<float,2>{0.00124896609f, 0.880503297f},
-std::array<float,2>{0.722117662f, 0.207875252f},
-std::array<float,2>{0.239810094f, 0.346474826f},
-std::array<float,2>{0.523418009f, 0.591355562f},
-std::array<float,2>{0.450478643f, 0.992542624f},
-std::array<float,2>{0.808698297f, 0.144513175f},
-std::array<float,2>{0.264773488f, 0.0822505057f},
-std::array<float,2>{0.988364398f, 0.788579583f},
-std::array<float,2>{0.119230516f, 0.645346344f},
-std::array<float,2>{0.682507277f, 0.382641822f},
-std::array<float,2>{0.0326892138f, 0.223851487f},
-std::array<float,2>{0.694188356f, 0.920622885f},
-std::array<float,2>{0.335628301f, 0.529475212f},
-std::array<float,2>{0.889622509f, 0.264034659f},
-std::array<float,2>{0.385532975f, 0.47574386f},
-std::array<float,2>{0.84423548f, 0.694028854f},
-std::array<float,2>{0.183615506f, 0.832429767f},
-std::array<float,2>{0.618286371f, 0.00113999622f},
-std::array<float,2>{0.115363978f, 0.339061856f},
-std::array<float,2>{0.675558448f, 0.600873768f},
-std::array<float,2>{0.255332321f, 0.945184529f},
-std::array<float,2>{0.992555618f, 0.170448497f},
-std::array<float,2>{0.444520533f, 0.112849824f},
-std::array<float,2>{0.797796667f, 0.754095197f},
-std::array<float,2>{0.248207837f, 0.679586768f},
-std::array<float,2>{0.526229441f, 0.433449775f},
-std::array<float,2>{0.178538114f, 0.215030655f},
-std::array<float,2>{0.610499918f, 0.887092769f},
-std::array<float,2>{0.380255729f, 0.547748864f},
-std::array<float,2>{0.85602802f, 0.289739013f},
-std::array<float,2>{0.342426091f, 0.468589276f},
-std::array<float,2>{0.87974602f, 0.745182812f},
-std::array<float,2>{0.0451220423f, 0.871791303f},
-std::array<float,2>{0.701637149f, 0.042832803f},
-std::array<float,2>{0.202867925f, 0.383388966f},
-std::array<float,2>{0.545606792f, 0.65126133f},
-std::array<float,2>{0.47862184f, 0.793744445f},
-std::array<float,2>{0.778702676f, 0.0905788168f},
-std::array<float,2>{0.311303198f, 0.149879202f},
-std::array<float,2>{0.966268241f, 0.98909831f},
-std::array<float,2>{0.0814821944f, 0.581377745f},
-std::array<float,2>{0.653551698f, 0.359114915f},
-std::array<float,2>{0.00889862329f, 0.00885892939f},
-std::array<float,2>{0.732649744f, 0.8386361f},
-std::array<float,2>{0.346339524f, 0.696912706f},
-std::array<float,2>{0.918211699f, 0.482069522f},
-std::array<float,2>{0.406993389f, 0.254671007f},
-std::array<float,2>{0.829448164f, 0.522441149f},
-std::array<float,2>{0.137462497f, 0.907484591f},
-std::array<float,2>{0.570820749f, 0.228358477f},
-std::array<float,2>{0.0574270748f, 0.489174694f},
-std::array<float,2>{0.716208577f, 0.70678395f},
-std::array<float,2>{0.322296143f, 0.822508752f},
-std::array<float,2>{0.903793752f, 0.028517874f},
-std::array<float,2>{0.393200338f, 0.243016273f},
-std::array<float,2>{0.860506475f, 0.921974123f},
-std::array<float,2>{0.162003398f, 0.503987372f},
-std::array<float,2>{0.604082525f, 0.279151082f},
-std::array<float,2>{0.228059992f, 0.0683634132f},
-std::array<float,2>{0.512214959f, 0.803714991f},
-std::array<float,2>{0.461555213f, 0.638306916f},
-std::array<float,2>{0.794590831f, 0.403309613f},
-std::array<float,2>{0.268423975f, 0.372760326f},
-std::array<float,2>{0.977840841f, 0.565876245f},
-std::array<float,2>{0.0956956595f, 0.980270863f},
-std::array<float,2>{0.662655354f, 0.126013502f},
-std::array<float,2>{0.141790122f, 0.308906853f},
-std::array<float,2>{0.578444421f, 0.532674968f},
-std::array<float,2>{0.433881462f, 0.897710562f},
-std::array<float,2>{0.821208f, 0.189943448f},
-std::array<float,2>{0.361490577f, 0.0479599945f},
-std::array<float,2>{0.929210663f, 0.845962226f},
-std::array<float,2>{0.0249158051f, 0.724684715f},
-std::array<float,2>{0.737940192f, 0.438918799f},
-std::array<float,2>{0.0753612369f, 0.172023967f},
-std::array<float,2>{0.625842869f, 0.964668691f},
-std::array<float,2>{0.283526212f, 0.62227416f},
-std::array<float,2>{0.945708692f, 0.323238015f},
-std::array<float,2>{0.498592496f, 0.416644871f},
-std::array<float,2>{0.764620245f, 0.670231402f},
-std::array<float,2>{0.216980249f, 0.775439203f},
-std::array<float,2>{0.552473783f, 0.106306128f},
-std::array<float,2>{0.0663528517f, 0.295067817f},
-std::array<float,2>{0.635643125f, 0.552176297f},
-std::array<float,2>{0.292208821f, 0.886427224f},
-std::array<float,2>{0.940665007f, 0.212821558f},
-std::array<float,2>{0.490522295f, 0.0435472094f},
-std::array<float,2>{0.752828956f, 0.871070206f},
-std::array<float,2>{0.204605982f, 0.748589218f},
-std::array<float,2>{0.561321676f, 0.464500487f},
-std::array<float,2>{0.153568f, 0.167322218f},
-std::array<float,2>{0.591308534f, 0.940170169f},
-std::array<float,2>{0.425991476f, 0.595346868f},
-std::array<float,2>{0.814105451f, 0.340906054f},
-std::array<float,2>{0.367410928f, 0.434553385f},
-std::array<float,2>{0.932666123f, 0.673671603f},
-std::array<float,2>{0.0224049985f, 0.752208591f},
-std::array<float,2>{0.742908359f, 0.116330452f},
-std::array<float,2>{0.218765125f, 0.478130341f},
-std::array<float,2>{0.502592266f, 0.699224889f},
-std::array<float,2>{0.458381712f, 0.843613029f},
-std::array<float,2>{0.787169635f, 0.0129387956f},
-std::array<float,2>{0.276297897f, 0.231483787f},
-std::array<float,2>{0.973244429f, 0.913523555f},
-std::array<float,2>{0.106896944f, 0.519507468f},
-std::array<float,2>{0.668167055f, 0.253538579f},
-std::array<float,2>{0.0503678396f, 0.0893556923f},
-std::array<float,2>{0.710131586f, 0.791553497f},
-std::array<float,2>{0.318997234f, 0.654540241f},
-std::array<float,2>{0.89304179f, 0.389986366f},
-std::array<float,2>{0.401133478f, 0.351600498f},
-std::array<float,2>{0.872525096f, 0.584296286f},
-std::array<float,2>{0.166577443f, 0.986481369f},
-std::array<float,2>{0.600800097f, 0.154512048f},
-std::array<float,2>{0.00425013667f, 0.399234205f},
-std::array<float,2>{0.723935366f, 0.636530519f},
-std::array<float,2>{0.353936851f, 0.797458529f},
-std::array<float,2>{0.907929122f, 0.0642690286f},
-std::array<float,2>{0.420156479f, 0.130949706f},
-std::array<float,2>{0.838560462f, 0.98177141f},
-std::array<float,2>{0.129874408f, 0.569964111f},
-std::array<float,2>{0.570068181f, 0.370817035f},
-std::array<float,2>{0.187640503f, 0.0254233479f},
-std::array<float,2>{0.538394213f, 0.827161252f},
-std::array<float,2>{0.471301407f, 0.70807606f},
-std::array<float,2>{0.768874943f, 0.485488504f},
-std::array<float,2>{0.300555199f, 0.276301712f},
-std::array<float,2>{0.960098565f, 0.502454996f},
-std::array<float,2>{0.0907851309f, 0.925968051f},
-std::array<float,2>{0.64440006f, 0.247428983f},
-std::array<float,2>{0.183427677f, 0.324652225f},
-std::array<float,2>{0.621312737f, 0.620800793f},
-std::array<float,2>{0.390015185f, 0.967598796f},
-std::array<float,2>{0.850836158f, 0.176324114f},
-std::array<float,2>{0.331272453f, 0.10536588f},
-std::array<float,2>{0.883415639f, 0.779763579f},
-std::array<float,2>{0.0370274745f, 0.665819466f},
-std::array<float,2>{0.690024555f, 0.420279384f},
-std::array<float,2>{0.12355075f, 0.192426965f},
-std::array<float,2>{0.685804486f, 0.893213511f},
-std::array<float,2>{0.260197341f, 0.536862731f},
-std::array<float,2>{0.987604201f, 0.306446999f},
-std::array<float,2>{0.447914422f, 0.443133563f},
-std::array<float,2>{0.807625175f, 0.722105265f},
-std::array<float,2>{0.235613286f, 0.850665569f},
-std::array<float,2>{0.518365324f, 0.0533097275f},
-std::array<float,2>{0.0406926051f, 0.36200878f},
-std::array<float,2>{0.695949852f, 0.571426034f},
-std::array<float,2>{0.337504596f, 0.969971895f},
-std::array<float,2>{0.875946701f, 0.140579447f},
-std::array<float,2>{0.376568913f, 0.071221143f},
-std::array<float,2>{0.852057874f, 0.80646342f},
-std::array<float,2>{0.173316166f, 0.627718389f},
-std::array<float,2>{0.615569472f, 0.397954434f},
-std::array<float,2>{0.244758815f, 0.234818935f},
-std::array<float,2>{0.531120896f, 0.933222711f},
-std::array<float,2>{0.440939546f, 0.510594904f},
-std::array<float,2>{0.802459538f, 0.269135296f},
-std::array<float,2>{0.251249909f, 0.499590605f},
-std::array<float,2>{0.996273637f, 0.713268399f},
-std::array<float,2>{0.110533789f, 0.818706751f},
-std::array<float,2>{0.677793622f, 0.0208449941f},
-std::array<float,2>{0.133271337f, 0.413755983f},
-std::array<float,2>{0.577999532f, 0.660728931f},
-std::array<float,2>{0.410338014f, 0.768847406f},
-std::array<float,2>{0.835481584f, 0.0961365402f},
-std::array<float,2>{0.348746747f, 0.180728927f},
-std::array<float,2>{0.914168179f, 0.955034196f},
-std::array<float,2>{0.0146165965f, 0.614698291f},
-std::array<float,2>{0.727249622f, 0.314301103f},
-std::array<float,2>{0.0853131711f, 0.0564420521f},
-std::array<float,2>{0.650035918f, 0.854214668f},
-std::array<float,2>{0.306044281f, 0.733486533f},
-std::array<float,2>{0.961390555f, 0.451576173f},
-std::array<float,2>{0.483382136f, 0.299571186f},
-std::array<float,2>{0.775100172f, 0.546699584f},
-std::array<float,2>{0.195408657f, 0.89923203f},
-std::array<float,2>{0.53994751f, 0.20114769f},
-std::array<float,2>{0.100097671f, 0.457939595f},
-std::array<float,2>{0.657299638f, 0.736703873f},
-std::array<float,2>{0.270236194f, 0.865040421f},
-std::array<float,2>{0.981660247f, 0.0329197124f},
-std::array<float,2>{0.466536045f, 0.20608075f},
-std::array<float,2>{0.78982985f, 0.875355065f},
-std::array<float,2>{0.233348608f, 0.56205982f},
-std::array<float,2>{0.51163882f, 0.283377349f},
-std::array<float,2>{0.159345299f, 0.117812313f},
-std::array<float,2>{0.607900083f, 0.759928048f},
-std::array<float,2>{0.397336543f, 0.683809221f},
-std::array<float,2>{0.864489019f, 0.429481596f},
-std::array<float,2>{0.325239539f, 0.332731605f},
-std::array<float,2>{0.900463462f, 0.601626515f},
-std::array<float,2>{0.0602104589f, 0.946162581f},
-std::array<float,2>{0.711606801f, 0.159687206f},
-std::array<float,2>{0.214387268f, 0.258946985f},
-std::array<float,2>{0.549744904f, 0.525818944f},
-std::array<float,2>{0.494056284f, 0.914732993f},
-std::array<float,2>{0.760538459f, 0.221402407f},
-std::array<float,2>{0.287672371f, 0.00406603981f},
-std::array<float,2>{0.951314032f, 0.828486323f},
-std::array<float,2>{0.073785685f, 0.690903425f},
-std::array<float,2>{0.629143894f, 0.469299257f},
-std::array<float,2>{0.0278522503f, 0.147440732f},
-std::array<float,2>{0.738741875f, 0.998206139f},
-std::array<float,2>{0.366473556f, 0.587982297f},
-std::array<float,2>{0.924801469f, 0.348891407f},
-std::array<float,2>{0.431713343f, 0.376021296f},
-std::array<float,2>{0.825127542f, 0.642138362f},
-std::array<float,2>{0.144739941f, 0.783369482f},
-std::array<float,2>{0.58220613f, 0.0786176324f},
-std::array<float,2>{0.0520265475f, 0.303848624f},
-std::array<float,2>{0.70547688f, 0.541944623f},
-std::array<float,2>{0.312963247f, 0.903491378f},
-std::array<float,2>{0.89486891f, 0.197012514f},
-std::array<float,2>{0.406130493f, 0.0594820455f},
-std::array<float,2>{0.868994892f, 0.858405828f},
-std::array<float,2>{0.170958564f, 0.730403602f},
-std::array<float,2>{0.594033659f, 0.446031809f},
-std::array<float,2>{0.223740324f, 0.18517831f},
-std::array<float,2>{0.506753147f, 0.959208846f},
-std::array<float,2>{0.455244392f, 0.612214029f},
-std::array<float,2>{0.784140468f, 0.320284218f},
-std::array<float,2>{0.280785024f, 0.408509344f},
-std::array<float,2>{0.971572995f, 0.658685088f},
-std::array<float,2>{0.102212623f, 0.769926429f},
-std::array<float,2>{0.665808082f, 0.101237677f},
-std::array<float,2>{0.151559561f, 0.49307391f},
-std::array<float,2>{0.587240934f, 0.715246677f},
-std::array<float,2>{0.423615545f, 0.815812826f},
-std::array<float,2>{0.817156017f, 0.0157549232f},
-std::array<float,2>{0.371870637f, 0.238381907f},
-std::array<float,2>{0.934548736f, 0.935287952f},
-std::array<float,2>{0.0158110559f, 0.514912784f},
-std::array<float,2>{0.749518692f, 0.269762337f},
-std::array<float,2>{0.0675975233f, 0.0763899088f},
-std::array<float,2>{0.638114631f, 0.809975564f},
-std::array<float,2>{0.2961604f, 0.632425129f},
-std::array<float,2>{0.943220496f, 0.391048849f},
-std::array<float,2>{0.486587971f, 0.366841644f},
-std::array<float,2>{0.75509274f, 0.576224446f},
-std::array<float,2>{0.208699793f, 0.973011851f},
-std::array<float,2>{0.558275819f, 0.13458322f},
-std::array<float,2>{0.118897103f, 0.380536765f},
-std::array<float,2>{0.680397689f, 0.647565901f},
-std::array<float,2>{0.263276666f, 0.785695076f},
-std::array<float,2>{0.991567135f, 0.085508883f},
-std::array<float,2>{0.452003777f, 0.142274261f},
-std::array<float,2>{0.811445892f, 0.994841933f},
-std::array<float,2>{0.240626454f, 0.592817008f},
-std::array<float,2>{0.520704091f, 0.344352454f},
-std::array<float,2>{0.186073512f, 0.00337123661f},
-std::array<float,2>{0.619319916f, 0.835653305f},
-std::array<float,2>{0.383705974f, 0.692122221f},
-std::array<float,2>{0.845914006f, 0.472827137f},
-std::array<float,2>{0.33352682f, 0.262041241f},
-std::array<float,2>{0.887409568f, 0.527495444f},
-std::array<float,2>{0.0336731337f, 0.918928027f},
-std::array<float,2>{0.692468524f, 0.22578153f},
-std::array<float,2>{0.193986148f, 0.331517339f},
-std::array<float,2>{0.53135401f, 0.608242512f},
-std::array<float,2>{0.474830866f, 0.951992333f},
-std::array<float,2>{0.771920085f, 0.163083866f},
-std::array<float,2>{0.301980108f, 0.121757559f},
-std::array<float,2>{0.955079257f, 0.765128732f},
-std::array<float,2>{0.0861839354f, 0.681739867f},
-std::array<float,2>{0.646686792f, 0.424948007f},
-std::array<float,2>{0.00314803072f, 0.210794538f},
-std::array<float,2>{0.719963193f, 0.881303847f},
-std::array<float,2>{0.357646286f, 0.55555445f},
-std::array<float,2>{0.911417842f, 0.285634279f},
-std::array<float,2>{0.414641201f, 0.454535156f},
-std::array<float,2>{0.841473281f, 0.739694834f},
-std::array<float,2>{0.126335397f, 0.861022115f},
-std::array<float,2>{0.564338386f, 0.0364256352f},
-std::array<float,2>{0.0784397721f, 0.356321216f},
-std::array<float,2>{0.656198621f, 0.578534424f},
-std::array<float,2>{0.309520245f, 0.991804242f},
-std::array<float,2>{0.967178285f, 0.151999459f},
-std::array<float,2>{0.476843804f, 0.0918636024f},
-std::array<float,2>{0.779508471f, 0.79562825f},
-std::array<float,2>{0.199411348f, 0.649234831f},
-std::array<float,2>{0.544441402f, 0.386142224f},
-std::array<float,2>{0.138801694f, 0.228961945f},
-std::array<float,2>{0.57306838f, 0.909270525f},
-std::array<float,2>{0.409054697f, 0.519883037f},
-std::array<float,2>{0.830137014f, 0.256874084f},
-std::array<float,2>{0.345472693f, 0.483241439f},
-std::array<float,2>{0.92120862f, 0.697700202f},
-std::array<float,2>{0.010084589f, 0.837264776f},
-std::array<float,2>{0.732299745f, 0.0107548917f},
-std::array<float,2>{0.247398287f, 0.430540383f},
-std::array<float,2>{0.525345325f, 0.676333487f},
-std::array<float,2>{0.441819757f, 0.756692469f},
-std::array<float,2>{0.799146235f, 0.109691761f},
-std::array<float,2>{0.256653696f, 0.169463873f},
-std::array<float,2>{0.994564533f, 0.942526877f},
-std::array<float,2>{0.114857011f, 0.598189771f},
-std::array<float,2>{0.672095776f, 0.336050659f},
-std::array<float,2>{0.043615628f, 0.0406780504f},
-std::array<float,2>{0.700270176f, 0.874234617f},
-std::array<float,2>{0.341051757f, 0.743605793f},
-std::array<float,2>{0.881851315f, 0.46674493f},
-std::array<float,2>{0.381968379f, 0.292406589f},
-std::array<float,2>{0.858641148f, 0.549547017f},
-std::array<float,2>{0.177378014f, 0.889579833f},
-std::array<float,2>{0.613176942f, 0.21690926f},
-std::array<float,2>{0.0258552395f, 0.440638632f},
-std::array<float,2>{0.73585552f, 0.723598361f},
-std::array<float,2>{0.360713571f, 0.844507217f},
-std::array<float,2>{0.92653507f, 0.0492571406f},
-std::array<float,2>{0.435666829f, 0.18937248f},
-std::array<float,2>{0.822266996f, 0.89590615f},
-std::array<float,2>{0.142606318f, 0.53389132f},
-std::array<float,2>{0.580898523f, 0.312179863f},
-std::array<float,2>{0.21563679f, 0.107549876f},
-std::array<float,2>{0.553233743f, 0.773771942f},
-std::array<float,2>{0.497986346f, 0.669745207f},
-std::array<float,2>{0.763496518f, 0.41420415f},
-std::array<float,2>{0.282752186f, 0.321423531f},
-std::array<float,2>{0.947851717f, 0.624596238f},
-std::array<float,2>{0.0776567981f, 0.961629152f},
-std::array<float,2>{0.628596604f, 0.174319595f},
-std::array<float,2>{0.162218511f, 0.279586941f},
-std::array<float,2>{0.60321641f, 0.507501185f},
-std::array<float,2>{0.39120695f, 0.925342381f},
-std::array<float,2>{0.861916125f, 0.244504079f},
-std::array<float,2>{0.320532411f, 0.0308830552f},
-std::array<float,2>{0.904358327f, 0.821463108f},
-std::array<float,2>{0.0555234998f, 0.704560876f},
-std::array<float,2>{0.717897952f, 0.490496576f},
-std::array<float,2>{0.0961119756f, 0.127914369f},
-std::array<float,2>{0.660633743f, 0.97834146f},
-std::array<float,2>{0.266366363f, 0.563300848f},
-std::array<float,2>{0.979213715f, 0.373268932f},
-std::array<float,2>{0.463008612f, 0.405721635f},
-std::array<float,2>{0.796577454f, 0.639620125f},
-std::array<float,2>{0.229255706f, 0.801337183f},
-std::array<float,2>{0.514013648f, 0.067647405f},
-std::array<float,2>{0.108574793f, 0.250531733f},
-std::array<float,2>{0.671309948f, 0.516105652f},
-std::array<float,2>{0.273488104f, 0.911551595f},
-std::array<float,2>{0.974964857f, 0.232493043f},
-std::array<float,2>{0.459697217f, 0.0150301224f},
-std::array<float,2>{0.786987245f, 0.840085208f},
-std::array<float,2>{0.222034097f, 0.702490568f},
-std::array<float,2>{0.500688851f, 0.479743123f},
-std::array<float,2>{0.165223703f, 0.153343469f},
-std::array<float,2>{0.59932363f, 0.984855056f},
-std::array<float,2>{0.399159044f, 0.582405686f},
-std::array<float,2>{0.87319088f, 0.35406363f},
-std::array<float,2>{0.317999721f, 0.38817361f},
-std::array<float,2>{0.890950143f, 0.654269159f},
-std::array<float,2>{0.0475692339f, 0.789522052f},
-std::array<float,2>{0.708007455f, 0.0866496935f},
-std::array<float,2>{0.205328166f, 0.462538362f},
-std::array<float,2>{0.558971286f, 0.746477425f},
-std::array<float,2>{0.489602029f, 0.868502736f},
-std::array<float,2>{0.751043797f, 0.0452554598f},
-std::array<float,2>{0.289151698f, 0.214276209f},
-std::array<float,2>{0.938558102f, 0.883937716f},
-std::array<float,2>{0.0630139112f, 0.55278635f},
-std::array<float,2>{0.633035302f, 0.294236451f},
-std::array<float,2>{0.0206726398f, 0.114288367f},
-std::array<float,2>{0.746077895f, 0.751572728f},
-std::array<float,2>{0.370103866f, 0.674297035f},
-std::array<float,2>{0.930182517f, 0.437212408f},
-std::array<float,2>{0.428355634f, 0.343367726f},
-std::array<float,2>{0.814919233f, 0.596279681f},
-std::array<float,2>{0.15551047f, 0.938327134f},
-std::array<float,2>{0.593417943f, 0.165764436f},
-std::array<float,2>{0.0384705812f, 0.419366866f},
-std::array<float,2>{0.689102948f, 0.666640997f},
-std::array<float,2>{0.328632385f, 0.779057801f},
-std::array<float,2>{0.88514626f, 0.102733061f},
-std::array<float,2>{0.387788564f, 0.17796506f},
-std::array<float,2>{0.849307477f, 0.96673131f},
-std::array<float,2>{0.180563167f, 0.618061602f},
-std::array<float,2>{0.623758137f, 0.326565027f},
-std::array<float,2>{0.237892658f, 0.052629184f},
-std::array<float,2>{0.517534733f, 0.847865462f},
-std::array<float,2>{0.447100878f, 0.718914807f},
-std::array<float,2>{0.805339217f, 0.444240838f},
-std::array<float,2>{0.259563655f, 0.307602882f},
-std::array<float,2>{0.985597968f, 0.537264526f},
-std::array<float,2>{0.122371398f, 0.892177224f},
-std::array<float,2>{0.684125781f, 0.194787502f},
-std::array<float,2>{0.131932244f, 0.368385613f},
-std::array<float,2>{0.567183733f, 0.568274081f},
-std::array<float,2>{0.419424593f, 0.983271241f},
-std::array<float,2>{0.837526023f, 0.12978074f},
-std::array<float,2>{0.352339089f, 0.0648051426f},
-std::array<float,2>{0.909361601f, 0.800738692f},
-std::array<float,2>{0.00671428395f, 0.633030295f},
-std::array<float,2>{0.724689603f, 0.400430918f},
-std::array<float,2>{0.0921235159f, 0.249288499f},
-std::array<float,2>{0.641551673f, 0.927975953f},
-std::array<float,2>{0.297359377f, 0.501276851f},
-std::array<float,2>{0.958787858f, 0.275126487f},
-std::array<float,2>{0.470272273f, 0.487039179f},
-std::array<float,2>{0.767014861f, 0.710841775f},
-std::array<float,2>{0.191278785f, 0.824688911f},
-std::array<float,2>{0.53621161f, 0.0253162421f},
-std::array<float,2>{0.0135406237f, 0.315858841f},
-std::array<float,2>{0.729253531f, 0.615672886f},
-std::array<float,2>{0.349731565f, 0.95650959f},
-std::array<float,2>{0.917800128f, 0.182756007f},
-std::array<float,2>{0.414031029f, 0.0946581438f},
-std::array<float,2>{0.833808839f, 0.766179323f},
-std::array<float,2>{0.134985209f, 0.662602901f},
-std::array<float,2>{0.575449049f, 0.411808282f},
-std::array<float,2>{0.197895765f, 0.202185705f},
-std::array<float,2>{0.542362928f, 0.901777625f},
-std::array<float,2>{0.481010735f, 0.54343915f},
-std::array<float,2>{0.776857972f, 0.297698021f},
-std::array<float,2>{0.306858778f, 0.450869948f},
-std::array<float,2>{0.964211524f, 0.732090533f},
-std::array<float,2>{0.08316686f, 0.853406191f},
-std::array<float,2>{0.651020646f, 0.0573294461f},
-std::array<float,2>{0.175485238f, 0.394538581f},
-std::array<float,2>{0.614418685f, 0.625886321f},
-std::array<float,2>{0.378828675f, 0.8074224f},
-std::array<float,2>{0.855101824f, 0.0725567564f},
-std::array<float,2>{0.339344412f, 0.137817979f},
-std::array<float,2>{0.878516197f, 0.970950067f},
-std::array<float,2>{0.0419000313f, 0.573889732f},
-std::array<float,2>{0.697590113f, 0.360624373f},
-std::array<float,2>{0.11258328f, 0.0222838614f},
-std::array<float,2>{0.677286923f, 0.817513168f},
-std::array<float,2>{0.25270474f, 0.712662995f},
-std::array<float,2>{0.998094082f, 0.497837365f},
-std::array<float,2>{0.43807897f, 0.266848385f},
-std::array<float,2>{0.804052472f, 0.508527935f},
-std::array<float,2>{0.242674828f, 0.931040704f},
-std::array<float,2>{0.527628124f, 0.236397207f},
-std::array<float,2>{0.0712849721f, 0.471980006f},
-std::array<float,2>{0.63229394f, 0.687916815f},
-std::array<float,2>{0.28589341f, 0.831775486f},
-std::array<float,2>{0.949642122f, 0.00647906447f},
-std::array<float,2>{0.49440673f, 0.21958594f},
-std::array<float,2>{0.758421063f, 0.916870713f},
-std::array<float,2>{0.212196231f, 0.524841607f},
-std::array<float,2>{0.547111094f, 0.260400623f},
-std::array<float,2>{0.147508547f, 0.0810373574f},
-std::array<float,2>{0.584547043f, 0.782076955f},
-std::array<float,2>{0.431598008f, 0.642629504f},
-std::array<float,2>{0.827962577f, 0.377766848f},
-std::array<float,2>{0.364656419f, 0.351482689f},
-std::array<float,2>{0.92218864f, 0.587662637f},
-std::array<float,2>{0.0302051939f, 0.996499181f},
-std::array<float,2>{0.74193716f, 0.144577965f},
-std::array<float,2>{0.232338786f, 0.281563312f},
-std::array<float,2>{0.508672833f, 0.559210598f},
-std::array<float,2>{0.467297465f, 0.878535032f},
-std::array<float,2>{0.791273177f, 0.20369564f},
-std::array<float,2>{0.272363633f, 0.0348572508f},
-std::array<float,2>{0.983929157f, 0.866791844f},
-std::array<float,2>{0.0993286818f, 0.735590518f},
-std::array<float,2>{0.659663856f, 0.460680902f},
-std::array<float,2>{0.0611915812f, 0.157499298f},
-std::array<float,2>{0.712901652f, 0.947887719f},
-std::array<float,2>{0.327625871f, 0.605379581f},
-std::array<float,2>{0.899076998f, 0.334532946f},
-std::array<float,2>{0.396335006f, 0.426696062f},
-std::array<float,2>{0.866568089f, 0.686705351f},
-std::array<float,2>{0.156542808f, 0.758817554f},
-std::array<float,2>{0.606470585f, 0.12107335f},
-std::array<float,2>{0.000727469276f, 0.286866903f},
-std::array<float,2>{0.720990419f, 0.556045353f},
-std::array<float,2>{0.356088936f, 0.882445872f},
-std::array<float,2>{0.913652301f, 0.209248319f},
-std::array<float,2>{0.417827904f, 0.0359099172f},
-std::array<float,2>{0.842000246f, 0.859847784f},
-std::array<float,2>{0.127390668f, 0.738547385f},
-std::array<float,2>{0.564883351f, 0.453828037f},
-std::array<float,2>{0.192678601f, 0.163541257f},
-std::array<float,2>{0.533855557f, 0.95256722f},
-std::array<float,2>{0.472848833f, 0.609158218f},
-std::array<float,2>{0.769824684f, 0.330889493f},
-std::array<float,2>{0.303991646f, 0.424760371f},
-std::array<float,2>{0.954233229f, 0.683537781f},
-std::array<float,2>{0.0883068219f, 0.764631391f},
-std::array<float,2>{0.644581974f, 0.123008169f},
-std::array<float,2>{0.184863552f, 0.474224716f},
-std::array<float,2>{0.618161082f, 0.69241631f},
-std::array<float,2>{0.38578099f, 0.834127545f},
-std::array<float,2>{0.845439672f, 0.00283024996f},
-std::array<float,2>{0.334042221f, 0.225337505f},
-std::array<float,2>{0.889860034f, 0.919619501f},
-std::array<float,2>{0.0316697769f, 0.528876007f},
-std::array<float,2>{0.694838405f, 0.263082951f},
-std::array<float,2>{0.120500699f, 0.0844167992f},
-std::array<float,2>{0.682875574f, 0.786741674f},
-std::array<float,2>{0.264324874f, 0.647164285f},
-std::array<float,2>{0.989454448f, 0.378948838f},
-std::array<float,2>{0.449686736f, 0.344960153f},
-std::array<float,2>{0.810258329f, 0.592472732f},
-std::array<float,2>{0.239097536f, 0.99567914f},
-std::array<float,2>{0.52199775f, 0.141017005f},
-std::array<float,2>{0.0692635402f, 0.39223659f},
-std::array<float,2>{0.638862431f, 0.631057918f},
-std::array<float,2>{0.294666976f, 0.809507847f},
-std::array<float,2>{0.944252968f, 0.0779253021f},
-std::array<float,2>{0.485790849f, 0.133552819f},
-std::array<float,2>{0.757748365f, 0.973716617f},
-std::array<float,2>{0.209069356f, 0.577808142f},
-std::array<float,2>{0.556238234f, 0.365237206f},
-std::array<float,2>{0.149562433f, 0.0173647273f},
-std::array<float,2>{0.589447737f, 0.815012574f},
-std::array<float,2>{0.425739586f, 0.716239512f},
-std::array<float,2>{0.818591297f, 0.493872225f},
-std::array<float,2>{0.374991864f, 0.270979226f},
-std::array<float,2>{0.936096966f, 0.513952732f},
-std::array<float,2>{0.0180581175f, 0.934330404f},
-std::array<float,2>{0.747655869f, 0.23940146f},
-std::array<float,2>{0.225152895f, 0.318821996f},
-std::array<float,2>{0.504438102f, 0.61319679f},
-std::array<float,2>{0.45381102f, 0.960217118f},
-std::array<float,2>{0.781755388f, 0.18378216f},
-std::array<float,2>{0.279148906f, 0.100052789f},
-std::array<float,2>{0.969444335f, 0.771027148f},
-std::array<float,2>{0.103963353f, 0.65959084f},
-std::array<float,2>{0.666854143f, 0.410151482f},
-std::array<float,2>{0.0532030575f, 0.196162552f},
-std::array<float,2>{0.704127312f, 0.902664423f},
-std::array<float,2>{0.314736962f, 0.542713881f},
-std::array<float,2>{0.896845818f, 0.303543776f},
-std::array<float,2>{0.404149413f, 0.447102845f},
-std::array<float,2>{0.870972216f, 0.728831291f},
-std::array<float,2>{0.168350652f, 0.858234107f},
-std::array<float,2>{0.597430766f, 0.0600323193f},
-std::array<float,2>{0.0945132673f, 0.374487311f},
-std::array<float,2>{0.66311729f, 0.564375758f},
-std::array<float,2>{0.269469261f, 0.976863623f},
-std::array<float,2>{0.976774037f, 0.128535911f},
-std::array<float,2>{0.462400347f, 0.0668969676f},
-std::array<float,2>{0.793400228f, 0.802591026f},
-std::array<float,2>{0.226739764f, 0.640015304f},
-std::array<float,2>{0.513187051f, 0.404837996f},
-std::array<float,2>{0.16059871f, 0.245307207f},
-std::array<float,2>{0.604818583f, 0.924035132f},
-std::array<float,2>{0.394047171f, 0.506816983f},
-std::array<float,2>{0.859868228f, 0.280331045f},
-std::array<float,2>{0.323448569f, 0.491811335f},
-std::array<float,2>{0.902950108f, 0.703980327f},
-std::array<float,2>{0.0577899814f, 0.820469856f},
-std::array<float,2>{0.715352118f, 0.0295238569f},
-std::array<float,2>{0.217985347f, 0.415609688f},
-std::array<float,2>{0.551063001f, 0.668842793f},
-std::array<float,2>{0.499358296f, 0.774631262f},
-std::array<float,2>{0.765613794f, 0.109219454f},
-std::array<float,2>{0.284303308f, 0.17549178f},
-std::array<float,2>{0.946673393f, 0.961990058f},
-std::array<float,2>{0.0751545578f, 0.623452425f},
-std::array<float,2>{0.626568615f, 0.320773304f},
-std::array<float,2>{0.0239442438f, 0.050358355f},
-std::array<float,2>{0.737200618f, 0.845570982f},
-std::array<float,2>{0.362367362f, 0.724473894f},
-std::array<float,2>{0.927897692f, 0.440142542f},
-std::array<float,2>{0.434660852f, 0.311015993f},
-std::array<float,2>{0.821295977f, 0.535034478f},
-std::array<float,2>{0.141322002f, 0.895321488f},
-std::array<float,2>{0.579517007f, 0.187546983f},
-std::array<float,2>{0.0465166569f, 0.465367973f},
-std::array<float,2>{0.702986598f, 0.742360592f},
-std::array<float,2>{0.3428725f, 0.87384361f},
-std::array<float,2>{0.880093396f, 0.0397058576f},
-std::array<float,2>{0.379786253f, 0.218375325f},
-std::array<float,2>{0.856689513f, 0.890020192f},
-std::array<float,2>{0.179552346f, 0.550085723f},
-std::array<float,2>{0.60993892f, 0.291476578f},
-std::array<float,2>{0.249589995f, 0.110510394f},
-std::array<float,2>{0.52700007f, 0.757374048f},
-std::array<float,2>{0.443592995f, 0.677099049f},
-std::array<float,2>{0.798348725f, 0.431593418f},
-std::array<float,2>{0.254014671f, 0.337358385f},
-std::array<float,2>{0.993574262f, 0.598786831f},
-std::array<float,2>{0.116436221f, 0.942327678f},
-std::array<float,2>{0.674054861f, 0.168199554f},
-std::array<float,2>{0.138173133f, 0.256551176f},
-std::array<float,2>{0.572113216f, 0.521163404f},
-std::array<float,2>{0.407890201f, 0.908364534f},
-std::array<float,2>{0.828167081f, 0.229884312f},
-std::array<float,2>{0.34683305f, 0.010240213f},
-std::array<float,2>{0.919066668f, 0.836483479f},
-std::array<float,2>{0.00823505968f, 0.698509216f},
-std::array<float,2>{0.733852625f, 0.484367222f},
-std::array<float,2>{0.0802124292f, 0.150667831f},
-std::array<float,2>{0.652914882f, 0.990368783f},
-std::array<float,2>{0.312021583f, 0.580046058f},
-std::array<float,2>{0.96558398f, 0.357331723f},
-std::array<float,2>{0.480264813f, 0.385080695f},
-std::array<float,2>{0.778243244f, 0.650197923f},
-std::array<float,2>{0.202139184f, 0.796761751f},
-std::array<float,2>{0.546368301f, 0.0937221274f},
-std::array<float,2>{0.0917809904f, 0.273800641f},
-std::array<float,2>{0.642991245f, 0.500608325f},
-std::array<float,2>{0.299357176f, 0.929524183f},
-std::array<float,2>{0.959801078f, 0.248309493f},
-std::array<float,2>{0.472536743f, 0.0239314511f},
-std::array<float,2>{0.768492341f, 0.825613081f},
-std::array<float,2>{0.189231202f, 0.709745944f},
-std::array<float,2>{0.537546158f, 0.488090843f},
-std::array<float,2>{0.130118072f, 0.130813658f},
-std::array<float,2>{0.568424284f, 0.983443022f},
-std::array<float,2>{0.421462595f, 0.56705004f},
-std::array<float,2>{0.839609087f, 0.36765492f},
-std::array<float,2>{0.354564279f, 0.401569217f},
-std::array<float,2>{0.90685755f, 0.633891702f},
-std::array<float,2>{0.00571693061f, 0.798982322f},
-std::array<float,2>{0.723054588f, 0.0662387162f},
-std::array<float,2>{0.23445648f, 0.445076317f},
-std::array<float,2>{0.518955469f, 0.719971299f},
-std::array<float,2>{0.448761374f, 0.848718703f},
-std::array<float,2>{0.806655407f, 0.0516129695f},
-std::array<float,2>{0.261129379f, 0.193384022f},
-std::array<float,2>{0.986531198f, 0.891491234f},
-std::array<float,2>{0.124752738f, 0.538886964f},
-std::array<float,2>{0.687474608f, 0.308463186f},
-std::array<float,2>{0.0360718854f, 0.101904191f},
-std::array<float,2>{0.691131353f, 0.777604103f},
-std::array<float,2>{0.330386341f, 0.667032182f},
-std::array<float,2>{0.884607017f, 0.418864936f},
-std::array<float,2>{0.38869217f, 0.3272084f},
-std::array<float,2>{0.850372612f, 0.618620336f},
-std::array<float,2>{0.18171373f, 0.964926958f},
-std::array<float,2>{0.622215331f, 0.178831667f},
-std::array<float,2>{0.0232192483f, 0.436300099f},
-std::array<float,2>{0.74380362f, 0.675595999f},
-std::array<float,2>{0.368469715f, 0.750607371f},
-std::array<float,2>{0.932434678f, 0.113948375f},
-std::array<float,2>{0.42766121f, 0.164959341f},
-std::array<float,2>{0.813091934f, 0.939334214f},
-std::array<float,2>{0.152978525f, 0.596739888f},
-std::array<float,2>{0.590377748f, 0.341827571f},
-std::array<float,2>{0.203324378f, 0.0468273312f},
-std::array<float,2>{0.561974347f, 0.867662966f},
-std::array<float,2>{0.491283208f, 0.747149408f},
-std::array<float,2>{0.752952516f, 0.46136272f},
-std::array<float,2>{0.291712672f, 0.293659002f},
-std::array<float,2>{0.94027245f, 0.55371207f},
-std::array<float,2>{0.0652017891f, 0.883044302f},
-std::array<float,2>{0.636647522f, 0.213026538f},
-std::array<float,2>{0.16744329f, 0.355298042f},
-std::array<float,2>{0.600119114f, 0.583543301f},
-std::array<float,2>{0.401724964f, 0.986020863f},
-std::array<float,2>{0.871434808f, 0.153191224f},
-std::array<float,2>{0.319568545f, 0.0873346329f},
-std::array<float,2>{0.893676877f, 0.790579915f},
-std::array<float,2>{0.0495619103f, 0.652609646f},
-std::array<float,2>{0.709669173f, 0.387034178f},
-std::array<float,2>{0.106411166f, 0.2341941f},
-std::array<float,2>{0.669805467f, 0.910672545f},
-std::array<float,2>{0.277068496f, 0.516936064f},
-std::array<float,2>{0.974159718f, 0.25120014f},
-std::array<float,2>{0.457143068f, 0.479328841f},
-std::array<float,2>{0.788764894f, 0.701503098f},
-std::array<float,2>{0.220182508f, 0.841036499f},
-std::array<float,2>{0.503841937f, 0.0144554991f},
-std::array<float,2>{0.0586406589f, 0.335105866f},
-std::array<float,2>{0.712702751f, 0.603600562f},
-std::array<float,2>{0.324629068f, 0.948730111f},
-std::array<float,2>{0.901390135f, 0.157153353f},
-std::array<float,2>{0.398431689f, 0.120106749f},
-std::array<float,2>{0.864136338f, 0.758201182f},
-std::array<float,2>{0.158703744f, 0.686168611f},
-std::array<float,2>{0.608699203f, 0.42716381f},
-std::array<float,2>{0.233859092f, 0.204793215f},
-std::array<float,2>{0.50990653f, 0.877249122f},
-std::array<float,2>{0.46555078f, 0.559578955f},
-std::array<float,2>{0.790441692f, 0.28276068f},
-std::array<float,2>{0.270787954f, 0.459109515f},
-std::array<float,2>{0.981226623f, 0.734623671f},
-std::array<float,2>{0.10147173f, 0.86552012f},
-std::array<float,2>{0.656259894f, 0.0334561393f},
-std::array<float,2>{0.146080032f, 0.378748178f},
-std::array<float,2>{0.583294809f, 0.64443481f},
-std::array<float,2>{0.433345497f, 0.782792568f},
-std::array<float,2>{0.826089501f, 0.0813434944f},
-std::array<float,2>{0.366044223f, 0.146163419f},
-std::array<float,2>{0.925603032f, 0.997478843f},
-std::array<float,2>{0.0289600063f, 0.586531997f},
-std::array<float,2>{0.740047812f, 0.35001114f},
-std::array<float,2>{0.0729847476f, 0.00721535832f},
-std::array<float,2>{0.63075918f, 0.830202758f},
-std::array<float,2>{0.288677901f, 0.68859911f},
-std::array<float,2>{0.952542484f, 0.470920324f},
-std::array<float,2>{0.492197394f, 0.261244953f},
-std::array<float,2>{0.760982871f, 0.524004936f},
-std::array<float,2>{0.213617474f, 0.917098761f},
-std::array<float,2>{0.550360322f, 0.220511913f},
-std::array<float,2>{0.109697148f, 0.497056484f},
-std::array<float,2>{0.679260671f, 0.710976481f},
-std::array<float,2>{0.250028044f, 0.816631675f},
-std::array<float,2>{0.997757256f, 0.0227009095f},
-std::array<float,2>{0.439612389f, 0.237418115f},
-std::array<float,2>{0.801293015f, 0.930080652f},
-std::array<float,2>{0.245223671f, 0.509620249f},
-std::array<float,2>{0.529643834f, 0.266432136f},
-std::array<float,2>{0.172350541f, 0.0737515613f},
-std::array<float,2>{0.616319478f, 0.807709754f},
-std::array<float,2>{0.375951827f, 0.626053035f},
-std::array<float,2>{0.852910817f, 0.396107346f},
-std::array<float,2>{0.33671087f, 0.359413892f},
-std::array<float,2>{0.876258731f, 0.572706878f},
-std::array<float,2>{0.0391794927f, 0.972641289f},
-std::array<float,2>{0.697208703f, 0.137449503f},
-std::array<float,2>{0.19697018f, 0.298385262f},
-std::array<float,2>{0.540055871f, 0.544743538f},
-std::array<float,2>{0.48400268f, 0.901185274f},
-std::array<float,2>{0.773833275f, 0.201722339f},
-std::array<float,2>{0.305231988f, 0.0581543446f},
-std::array<float,2>{0.962397039f, 0.851708472f},
-std::array<float,2>{0.0845520571f, 0.73143357f},
-std::array<float,2>{0.648924351f, 0.450161517f},
-std::array<float,2>{0.0149559909f, 0.18259871f},
-std::array<float,2>{0.727664411f, 0.955968916f},
-std::array<float,2>{0.347782969f, 0.616339803f},
-std::array<float,2>{0.91582948f, 0.31539315f},
-std::array<float,2>{0.411550432f, 0.411065489f},
-std::array<float,2>{0.834266543f, 0.66343981f},
-std::array<float,2>{0.134421229f, 0.767561615f},
-std::array<float,2>{0.576333106f, 0.0951445475f},
-std::array<float,2>{0.0345271006f, 0.265041232f},
-std::array<float,2>{0.692051709f, 0.531042814f},
-std::array<float,2>{0.332534134f, 0.920978963f},
-std::array<float,2>{0.888655603f, 0.223629296f},
-std::array<float,2>{0.384688705f, 0.000536505075f},
-std::array<float,2>{0.847610533f, 0.833011508f},
-std::array<float,2>{0.186942741f, 0.694426894f},
-std::array<float,2>{0.620154858f, 0.474662662f},
-std::array<float,2>{0.242081895f, 0.142993361f},
-std::array<float,2>{0.519580424f, 0.993623078f},
-std::array<float,2>{0.452244848f, 0.590417325f},
-std::array<float,2>{0.81153965f, 0.346907318f},
-std::array<float,2>{0.262682289f, 0.381135821f},
-std::array<float,2>{0.991022527f, 0.646317363f},
-std::array<float,2>{0.117288724f, 0.787365437f},
-std::array<float,2>{0.681402087f, 0.0833774433f},
-std::array<float,2>{0.125006735f, 0.456555277f},
-std::array<float,2>{0.563073575f, 0.740748286f},
-std::array<float,2>{0.415754288f, 0.86327529f},
-std::array<float,2>{0.839858532f, 0.0374107026f},
-std::array<float,2>{0.359089464f, 0.208809301f},
-std::array<float,2>{0.911038876f, 0.879776835f},
-std::array<float,2>{0.00283870706f, 0.557231545f},
-std::array<float,2>{0.719423294f, 0.288307667f},
-std::array<float,2>{0.0874015689f, 0.124389417f},
-std::array<float,2>{0.647650898f, 0.762710094f},
-std::array<float,2>{0.301754028f, 0.680691242f},
-std::array<float,2>{0.956836522f, 0.422605157f},
-std::array<float,2>{0.47588858f, 0.330071032f},
-std::array<float,2>{0.772901177f, 0.606620014f},
-std::array<float,2>{0.194764242f, 0.950449169f},
-std::array<float,2>{0.532378376f, 0.160869971f},
-std::array<float,2>{0.103043549f, 0.407445937f},
-std::array<float,2>{0.664660811f, 0.657178581f},
-std::array<float,2>{0.279695153f, 0.773168802f},
-std::array<float,2>{0.972381175f, 0.0980968997f},
-std::array<float,2>{0.456523597f, 0.186711475f},
-std::array<float,2>{0.784959435f, 0.958468676f},
-std::array<float,2>{0.222882897f, 0.609998524f},
-std::array<float,2>{0.507762492f, 0.316905975f},
-std::array<float,2>{0.170520425f, 0.0610878281f},
-std::array<float,2>{0.59501034f, 0.856570542f},
-std::array<float,2>{0.405026942f, 0.72674799f},
-std::array<float,2>{0.868110418f, 0.448974192f},
-std::array<float,2>{0.313695401f, 0.302024096f},
-std::array<float,2>{0.895774186f, 0.540623963f},
-std::array<float,2>{0.0512542464f, 0.905316412f},
-std::array<float,2>{0.706791461f, 0.197949052f},
-std::array<float,2>{0.207496539f, 0.364127696f},
-std::array<float,2>{0.557317019f, 0.575924397f},
-std::array<float,2>{0.487966269f, 0.975818276f},
-std::array<float,2>{0.754246652f, 0.135183886f},
-std::array<float,2>{0.294968903f, 0.0742339939f},
-std::array<float,2>{0.94160831f, 0.811876655f},
-std::array<float,2>{0.0673517734f, 0.630403697f},
-std::array<float,2>{0.637622178f, 0.39414832f},
-std::array<float,2>{0.0169075541f, 0.240883872f},
-std::array<float,2>{0.748599172f, 0.936242044f},
-std::array<float,2>{0.372473866f, 0.513027072f},
-std::array<float,2>{0.935428262f, 0.272534817f},
-std::array<float,2>{0.421925753f, 0.494183809f},
-std::array<float,2>{0.818046451f, 0.718251824f},
-std::array<float,2>{0.150838375f, 0.813115358f},
-std::array<float,2>{0.586342692f, 0.0186705627f},
-std::array<float,2>{0.076361686f, 0.323562771f},
-std::array<float,2>{0.62778753f, 0.621524811f},
-std::array<float,2>{0.282182693f, 0.963208139f},
-std::array<float,2>{0.948771358f, 0.173780948f},
-std::array<float,2>{0.496625066f, 0.106709816f},
-std::array<float,2>{0.762533426f, 0.776397586f},
-std::array<float,2>{0.215875626f, 0.671374261f},
-std::array<float,2>{0.55414933f, 0.417407036f},
-std::array<float,2>{0.144102529f, 0.191378579f},
-std::array<float,2>{0.581778288f, 0.897150338f},
-std::array<float,2>{0.437257379f, 0.531272471f},
-std::array<float,2>{0.823592365f, 0.309814125f},
-std::array<float,2>{0.360296279f, 0.438029647f},
-std::array<float,2>{0.926908374f, 0.725883245f},
-std::array<float,2>{0.0267788917f, 0.847308695f},
-std::array<float,2>{0.734533966f, 0.0472064465f},
-std::array<float,2>{0.229967043f, 0.403490096f},
-std::array<float,2>{0.515609801f, 0.637023509f},
-std::array<float,2>{0.464098573f, 0.803543925f},
-std::array<float,2>{0.795807838f, 0.0696470961f},
-std::array<float,2>{0.267317623f, 0.125100031f},
-std::array<float,2>{0.97995168f, 0.97855401f},
-std::array<float,2>{0.0966827869f, 0.565300822f},
-std::array<float,2>{0.661669254f, 0.37159124f},
-std::array<float,2>{0.0558838695f, 0.0279639345f},
-std::array<float,2>{0.717733681f, 0.823588967f},
-std::array<float,2>{0.322140813f, 0.705192804f},
-std::array<float,2>{0.905950844f, 0.489339471f},
-std::array<float,2>{0.392528504f, 0.27762875f},
-std::array<float,2>{0.8626706f, 0.50494498f},
-std::array<float,2>{0.163329959f, 0.92368114f},
-std::array<float,2>{0.602282405f, 0.24321641f},
-std::array<float,2>{0.011338627f, 0.481405795f},
-std::array<float,2>{0.730621338f, 0.695824027f},
-std::array<float,2>{0.343866199f, 0.839672446f},
-std::array<float,2>{0.920335591f, 0.00825418346f},
-std::array<float,2>{0.409298688f, 0.22745645f},
-std::array<float,2>{0.831506193f, 0.906333089f},
-std::array<float,2>{0.140561983f, 0.522506237f},
-std::array<float,2>{0.573884726f, 0.255589426f},
-std::array<float,2>{0.20070371f, 0.091180861f},
-std::array<float,2>{0.543876946f, 0.794840515f},
-std::array<float,2>{0.478077829f, 0.65175432f},
-std::array<float,2>{0.780513227f, 0.384148657f},
-std::array<float,2>{0.310319215f, 0.358184069f},
-std::array<float,2>{0.967830181f, 0.58035624f},
-std::array<float,2>{0.079533048f, 0.989378452f},
-std::array<float,2>{0.654578924f, 0.149019986f},
-std::array<float,2>{0.175894126f, 0.290472597f},
-std::array<float,2>{0.612280011f, 0.548225403f},
-std::array<float,2>{0.381659329f, 0.888141453f},
-std::array<float,2>{0.857690394f, 0.216546088f},
-std::array<float,2>{0.340688884f, 0.0413461328f},
-std::array<float,2>{0.880860507f, 0.872906029f},
-std::array<float,2>{0.0444350056f, 0.744350433f},
-std::array<float,2>{0.699241281f, 0.467584521f},
-std::array<float,2>{0.113816224f, 0.171715349f},
-std::array<float,2>{0.673498988f, 0.94388777f},
-std::array<float,2>{0.257411331f, 0.600078642f},
-std::array<float,2>{0.995814025f, 0.337893605f},
-std::array<float,2>{0.443336636f, 0.43215245f},
-std::array<float,2>{0.80037719f, 0.678042412f},
-std::array<float,2>{0.246418044f, 0.754952788f},
-std::array<float,2>{0.523954332f, 0.112049259f},
-std::array<float,2>{0.121826068f, 0.305413127f},
-std::array<float,2>{0.685423374f, 0.535937309f},
-std::array<float,2>{0.258333266f, 0.893879175f},
-std::array<float,2>{0.985135972f, 0.191782087f},
-std::array<float,2>{0.445555031f, 0.0546662733f},
-std::array<float,2>{0.806495547f, 0.850128293f},
-std::array<float,2>{0.236559376f, 0.721293926f},
-std::array<float,2>{0.51609242f, 0.442289621f},
-std::array<float,2>{0.181616589f, 0.176783413f},
-std::array<float,2>{0.624951422f, 0.967921495f},
-std::array<float,2>{0.387209237f, 0.619467854f},
-std::array<float,2>{0.848347843f, 0.325474441f},
-std::array<float,2>{0.329913408f, 0.421822101f},
-std::array<float,2>{0.886402428f, 0.664387226f},
-std::array<float,2>{0.0371781737f, 0.780293703f},
-std::array<float,2>{0.687974036f, 0.103846706f},
-std::array<float,2>{0.189534873f, 0.484450519f},
-std::array<float,2>{0.535905719f, 0.707087994f},
-std::array<float,2>{0.469430059f, 0.826987445f},
-std::array<float,2>{0.766157091f, 0.0266297217f},
-std::array<float,2>{0.298382729f, 0.246857807f},
-std::array<float,2>{0.957879543f, 0.927328348f},
-std::array<float,2>{0.0928587168f, 0.503258049f},
-std::array<float,2>{0.641733408f, 0.276815474f},
-std::array<float,2>{0.00707388483f, 0.0633937418f},
-std::array<float,2>{0.725999177f, 0.797901452f},
-std::array<float,2>{0.352557212f, 0.635529041f},
-std::array<float,2>{0.908727229f, 0.399889618f},
-std::array<float,2>{0.418614209f, 0.369579405f},
-std::array<float,2>{0.836489379f, 0.568833947f},
-std::array<float,2>{0.131414488f, 0.981034219f},
-std::array<float,2>{0.568209648f, 0.132633865f},
-std::array<float,2>{0.0484358445f, 0.389603168f},
-std::array<float,2>{0.708547652f, 0.6553725f},
-std::array<float,2>{0.317122072f, 0.792017221f},
-std::array<float,2>{0.892257631f, 0.0884203613f},
-std::array<float,2>{0.399959564f, 0.156249464f},
-std::array<float,2>{0.874367476f, 0.987555027f},
-std::array<float,2>{0.164356485f, 0.585897207f},
-std::array<float,2>{0.597726822f, 0.352629811f},
-std::array<float,2>{0.221374542f, 0.0120388065f},
-std::array<float,2>{0.501022398f, 0.842403233f},
-std::array<float,2>{0.460690975f, 0.700666189f},
-std::array<float,2>{0.785477757f, 0.477297723f},
-std::array<float,2>{0.275295883f, 0.252022266f},
-std::array<float,2>{0.976451755f, 0.518015802f},
-std::array<float,2>{0.108073078f, 0.912439764f},
-std::array<float,2>{0.670517325f, 0.230606779f},
-std::array<float,2>{0.155241892f, 0.340627849f},
-std::array<float,2>{0.591945052f, 0.594577253f},
-std::array<float,2>{0.429317147f, 0.940616131f},
-std::array<float,2>{0.815538645f, 0.166258499f},
-std::array<float,2>{0.370897442f, 0.115917273f},
-std::array<float,2>{0.930916727f, 0.753085911f},
-std::array<float,2>{0.019839352f, 0.672763884f},
-std::array<float,2>{0.744651496f, 0.434815198f},
-std::array<float,2>{0.0635160953f, 0.211153671f},
-std::array<float,2>{0.634490311f, 0.885469317f},
-std::array<float,2>{0.290666401f, 0.550969541f},
-std::array<float,2>{0.938313663f, 0.296692669f},
-std::array<float,2>{0.48907873f, 0.463125408f},
-std::array<float,2>{0.750696301f, 0.74979049f},
-std::array<float,2>{0.206274122f, 0.869401813f},
-std::array<float,2>{0.560053825f, 0.0446101725f},
-std::array<float,2>{0.0306184515f, 0.347907424f},
-std::array<float,2>{0.74074322f, 0.589629591f},
-std::array<float,2>{0.364174992f, 0.999754906f},
-std::array<float,2>{0.922853827f, 0.147991881f},
-std::array<float,2>{0.429858416f, 0.0792767182f},
-std::array<float,2>{0.826540232f, 0.785044372f},
-std::array<float,2>{0.147268116f, 0.641136408f},
-std::array<float,2>{0.585210204f, 0.375367075f},
-std::array<float,2>{0.21146822f, 0.222027078f},
-std::array<float,2>{0.54841423f, 0.915848434f},
-std::array<float,2>{0.495438188f, 0.527043283f},
-std::array<float,2>{0.759617031f, 0.25818029f},
-std::array<float,2>{0.286427647f, 0.470487416f},
-std::array<float,2>{0.950606108f, 0.689751744f},
-std::array<float,2>{0.072111249f, 0.829481304f},
-std::array<float,2>{0.631307125f, 0.00544790132f},
-std::array<float,2>{0.157391876f, 0.42845282f},
-std::array<float,2>{0.605666876f, 0.684761822f},
-std::array<float,2>{0.395185292f, 0.761284888f},
-std::array<float,2>{0.866183519f, 0.118899181f},
-std::array<float,2>{0.32680729f, 0.158901587f},
-std::array<float,2>{0.900368333f, 0.947080731f},
-std::array<float,2>{0.0617358983f, 0.602757573f},
-std::array<float,2>{0.71469444f, 0.333396852f},
-std::array<float,2>{0.097850807f, 0.0321203694f},
-std::array<float,2>{0.658680618f, 0.864025593f},
-std::array<float,2>{0.27312994f, 0.737741113f},
-std::array<float,2>{0.983120859f, 0.458420575f},
-std::array<float,2>{0.468737751f, 0.284576207f},
-std::array<float,2>{0.792852342f, 0.560905457f},
-std::array<float,2>{0.23079291f, 0.876331449f},
-std::array<float,2>{0.509625614f, 0.205173209f},
-std::array<float,2>{0.0828399211f, 0.452730149f},
-std::array<float,2>{0.651839077f, 0.733178914f},
-std::array<float,2>{0.308112055f, 0.854750037f},
-std::array<float,2>{0.963176668f, 0.0555796586f},
-std::array<float,2>{0.482363909f, 0.200195074f},
-std::array<float,2>{0.776089609f, 0.899791896f},
-std::array<float,2>{0.198574558f, 0.5457744f},
-std::array<float,2>{0.541900098f, 0.300690383f},
-std::array<float,2>{0.135748416f, 0.096771203f},
-std::array<float,2>{0.574755132f, 0.768532515f},
-std::array<float,2>{0.41245994f, 0.662028015f},
-std::array<float,2>{0.832944036f, 0.41234532f},
-std::array<float,2>{0.351391137f, 0.313023001f},
-std::array<float,2>{0.916459084f, 0.613932133f},
-std::array<float,2>{0.0125954645f, 0.953198731f},
-std::array<float,2>{0.730086684f, 0.180307284f},
-std::array<float,2>{0.244078383f, 0.268340498f},
-std::array<float,2>{0.528495371f, 0.511539936f},
-std::array<float,2>{0.438931018f, 0.931913018f},
-std::array<float,2>{0.803594649f, 0.235744163f},
-std::array<float,2>{0.253633767f, 0.0200106669f},
-std::array<float,2>{0.999323487f, 0.820176303f},
-std::array<float,2>{0.111904934f, 0.714417458f},
-std::array<float,2>{0.676718891f, 0.498532146f},
-std::array<float,2>{0.042371124f, 0.139356792f},
-std::array<float,2>{0.698911905f, 0.969314754f},
-std::array<float,2>{0.337893039f, 0.570983589f},
-std::array<float,2>{0.877210021f, 0.362703145f},
-std::array<float,2>{0.377228141f, 0.396990895f},
-std::array<float,2>{0.854092121f, 0.628481686f},
-std::array<float,2>{0.173851013f, 0.804862201f},
-std::array<float,2>{0.614046991f, 0.0722435787f}}
\ No newline at end of file
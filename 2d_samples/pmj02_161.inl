@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.708386302f, 0.477962375f},
-std::array<float,2>{0.254443973f, 0.604516089f},
-std::array<float,2>{0.0341398306f, 0.0477089398f},
-std::array<float,2>{0.836607516f, 0.949119866f},
-std::array<float,2>{0.929256916f, 0.142316729f},
-std::array<float,2>{0.203496799f, 0.76438427f},
-std::array<float,2>{0.486771673f, 0.277524203f},
-std::array<float,2>{0.514795244f, 0.68281436f},
-std::array<float,2>{0.800936878f, 0.316862375f},
-std::array<float,2>{0.0768326223f, 0.696983635f},
-std::array<float,2>{0.325318992f, 0.21112895f},
-std::array<float,2>{0.662651956f, 0.816897988f},
-std::array<float,2>{0.602624118f, 0.106750354f},
-std::array<float,2>{0.377318054f, 0.921659648f},
-std::array<float,2>{0.171894461f, 0.387450635f},
-std::array<float,2>{0.995398879f, 0.516985595f},
-std::array<float,2>{0.558214128f, 0.294888645f},
-std::array<float,2>{0.454369605f, 0.650990963f},
-std::array<float,2>{0.228298247f, 0.170154884f},
-std::array<float,2>{0.889775336f, 0.79928875f},
-std::array<float,2>{0.871280432f, 0.013509715f},
-std::array<float,2>{0.0113849118f, 0.982155263f},
-std::array<float,2>{0.295099646f, 0.440224886f},
-std::array<float,2>{0.748353422f, 0.57844907f},
-std::array<float,2>{0.964014232f, 0.414207935f},
-std::array<float,2>{0.143960565f, 0.545322239f},
-std::array<float,2>{0.416817248f, 0.0711364523f},
-std::array<float,2>{0.58551991f, 0.898490071f},
-std::array<float,2>{0.641109824f, 0.224831283f},
-std::array<float,2>{0.368121356f, 0.855396271f},
-std::array<float,2>{0.121003456f, 0.374714434f},
-std::array<float,2>{0.752622306f, 0.745784104f},
-std::array<float,2>{0.683211386f, 0.352767676f},
-std::array<float,2>{0.334332943f, 0.732853055f},
-std::array<float,2>{0.0879450813f, 0.246438399f},
-std::array<float,2>{0.782603025f, 0.866619349f},
-std::array<float,2>{0.981726408f, 0.0930806249f},
-std::array<float,2>{0.167943835f, 0.884391665f},
-std::array<float,2>{0.396307796f, 0.430461317f},
-std::array<float,2>{0.618127763f, 0.551099241f},
-std::array<float,2>{0.825838685f, 0.459659904f},
-std::array<float,2>{0.0614367761f, 0.577017903f},
-std::array<float,2>{0.268816054f, 0.0309589524f},
-std::array<float,2>{0.700841248f, 0.993075192f},
-std::array<float,2>{0.529151261f, 0.17866011f},
-std::array<float,2>{0.472585052f, 0.790109456f},
-std::array<float,2>{0.199396446f, 0.303668022f},
-std::array<float,2>{0.912111759f, 0.637156487f},
-std::array<float,2>{0.576409698f, 0.394296974f},
-std::array<float,2>{0.426979989f, 0.5028705f},
-std::array<float,2>{0.131382242f, 0.11549747f},
-std::array<float,2>{0.949714303f, 0.934901416f},
-std::array<float,2>{0.769963503f, 0.192908809f},
-std::array<float,2>{0.102621719f, 0.842389464f},
-std::array<float,2>{0.349046141f, 0.341355741f},
-std::array<float,2>{0.634620607f, 0.713946223f},
-std::array<float,2>{0.896517634f, 0.250403106f},
-std::array<float,2>{0.237543821f, 0.67149514f},
-std::array<float,2>{0.44053632f, 0.130586132f},
-std::array<float,2>{0.540783882f, 0.77142489f},
-std::array<float,2>{0.72078526f, 0.0461583845f},
-std::array<float,2>{0.30356285f, 0.960295498f},
-std::array<float,2>{0.0229306556f, 0.490013003f},
-std::array<float,2>{0.845775306f, 0.619521022f},
-std::array<float,2>{0.630387008f, 0.42844668f},
-std::array<float,2>{0.356525809f, 0.558728993f},
-std::array<float,2>{0.0998184979f, 0.0809478462f},
-std::array<float,2>{0.774208546f, 0.87830919f},
-std::array<float,2>{0.944847167f, 0.238911003f},
-std::array<float,2>{0.13733685f, 0.874572039f},
-std::array<float,2>{0.434141695f, 0.347766131f},
-std::array<float,2>{0.566162109f, 0.72303313f},
-std::array<float,2>{0.851803064f, 0.305482775f},
-std::array<float,2>{0.0281702802f, 0.628569901f},
-std::array<float,2>{0.304905802f, 0.185695395f},
-std::array<float,2>{0.728870451f, 0.783900678f},
-std::array<float,2>{0.533500612f, 0.01574919f},
-std::array<float,2>{0.446346641f, 0.989673853f},
-std::array<float,2>{0.244554937f, 0.46423012f},
-std::array<float,2>{0.899094343f, 0.569335282f},
-std::array<float,2>{0.613023698f, 0.332768857f},
-std::array<float,2>{0.402040094f, 0.707077265f},
-std::array<float,2>{0.159686998f, 0.196735337f},
-std::array<float,2>{0.969436109f, 0.830974877f},
-std::array<float,2>{0.796629786f, 0.123924054f},
-std::array<float,2>{0.0826071873f, 0.929365158f},
-std::array<float,2>{0.336616278f, 0.403137445f},
-std::array<float,2>{0.672234297f, 0.509215534f},
-std::array<float,2>{0.915219069f, 0.493195504f},
-std::array<float,2>{0.192375898f, 0.611334622f},
-std::array<float,2>{0.477122843f, 0.0388938487f},
-std::array<float,2>{0.517462313f, 0.96263659f},
-std::array<float,2>{0.688965678f, 0.138076067f},
-std::array<float,2>{0.27481541f, 0.778575182f},
-std::array<float,2>{0.0490183905f, 0.262113035f},
-std::array<float,2>{0.818343937f, 0.663523555f},
-std::array<float,2>{0.738153756f, 0.270411342f},
-std::array<float,2>{0.283821732f, 0.675814033f},
-std::array<float,2>{0.00557329878f, 0.150266081f},
-std::array<float,2>{0.862540841f, 0.75053525f},
-std::array<float,2>{0.880724907f, 0.0609615482f},
-std::array<float,2>{0.221517459f, 0.94008714f},
-std::array<float,2>{0.466546983f, 0.471745014f},
-std::array<float,2>{0.551697969f, 0.599932015f},
-std::array<float,2>{0.762588799f, 0.382695794f},
-std::array<float,2>{0.109736606f, 0.528898835f},
-std::array<float,2>{0.36417526f, 0.0967467204f},
-std::array<float,2>{0.655937731f, 0.906845033f},
-std::array<float,2>{0.587240696f, 0.208021879f},
-std::array<float,2>{0.409278572f, 0.821424842f},
-std::array<float,2>{0.152635947f, 0.321653426f},
-std::array<float,2>{0.960907519f, 0.69166857f},
-std::array<float,2>{0.502717435f, 0.448146403f},
-std::array<float,2>{0.493141741f, 0.591473997f},
-std::array<float,2>{0.217072368f, 0.00195631222f},
-std::array<float,2>{0.931295276f, 0.9744578f},
-std::array<float,2>{0.831817627f, 0.16171357f},
-std::array<float,2>{0.0463258401f, 0.810052752f},
-std::array<float,2>{0.26408127f, 0.284442931f},
-std::array<float,2>{0.715967059f, 0.647761106f},
-std::array<float,2>{0.990270138f, 0.364337593f},
-std::array<float,2>{0.180532247f, 0.737728477f},
-std::array<float,2>{0.389679879f, 0.227183372f},
-std::array<float,2>{0.597756863f, 0.850592673f},
-std::array<float,2>{0.665473878f, 0.0671598092f},
-std::array<float,2>{0.3130683f, 0.896914423f},
-std::array<float,2>{0.0652302653f, 0.413835257f},
-std::array<float,2>{0.811363041f, 0.538603425f},
-std::array<float,2>{0.659885466f, 0.4660258f},
-std::array<float,2>{0.320541143f, 0.564558804f},
-std::array<float,2>{0.0706178844f, 0.0227428749f},
-std::array<float,2>{0.797066212f, 0.985133946f},
-std::array<float,2>{0.999546289f, 0.179868266f},
-std::array<float,2>{0.177012771f, 0.787145734f},
-std::array<float,2>{0.379959881f, 0.3121759f},
-std::array<float,2>{0.605826199f, 0.629278958f},
-std::array<float,2>{0.842157066f, 0.345147014f},
-std::array<float,2>{0.0380227081f, 0.719592512f},
-std::array<float,2>{0.253545702f, 0.238140017f},
-std::array<float,2>{0.705618739f, 0.870784223f},
-std::array<float,2>{0.507891238f, 0.0825177804f},
-std::array<float,2>{0.49162811f, 0.881217957f},
-std::array<float,2>{0.209593326f, 0.42470789f},
-std::array<float,2>{0.925106823f, 0.557311952f},
-std::array<float,2>{0.581103861f, 0.26057601f},
-std::array<float,2>{0.421562105f, 0.657435f},
-std::array<float,2>{0.146915644f, 0.133955121f},
-std::array<float,2>{0.967626572f, 0.774842501f},
-std::array<float,2>{0.757092834f, 0.034269888f},
-std::array<float,2>{0.123460203f, 0.966138601f},
-std::array<float,2>{0.371827692f, 0.496489763f},
-std::array<float,2>{0.645593882f, 0.616502821f},
-std::array<float,2>{0.886439919f, 0.401763648f},
-std::array<float,2>{0.233389646f, 0.515268922f},
-std::array<float,2>{0.457547247f, 0.119154163f},
-std::array<float,2>{0.561687768f, 0.925774157f},
-std::array<float,2>{0.7445243f, 0.201984182f},
-std::array<float,2>{0.289211273f, 0.832112432f},
-std::array<float,2>{0.0152827511f, 0.328906834f},
-std::array<float,2>{0.867608249f, 0.704485714f},
-std::array<float,2>{0.696895003f, 0.328074247f},
-std::array<float,2>{0.270423204f, 0.688519299f},
-std::array<float,2>{0.0579062141f, 0.206731617f},
-std::array<float,2>{0.820601106f, 0.828100264f},
-std::array<float,2>{0.908574343f, 0.0998227075f},
-std::array<float,2>{0.198953941f, 0.913523734f},
-std::array<float,2>{0.475262105f, 0.376366764f},
-std::array<float,2>{0.525484741f, 0.52526772f},
-std::array<float,2>{0.785429716f, 0.474490225f},
-std::array<float,2>{0.093259193f, 0.594431162f},
-std::array<float,2>{0.331025392f, 0.0584539287f},
-std::array<float,2>{0.685818255f, 0.943632066f},
-std::array<float,2>{0.621975541f, 0.156121477f},
-std::array<float,2>{0.391935289f, 0.756550074f},
-std::array<float,2>{0.169445485f, 0.268756688f},
-std::array<float,2>{0.979652405f, 0.672728062f},
-std::array<float,2>{0.543081582f, 0.409921229f},
-std::array<float,2>{0.443793952f, 0.533837378f},
-std::array<float,2>{0.240693882f, 0.0650123358f},
-std::array<float,2>{0.893421292f, 0.892633677f},
-std::array<float,2>{0.848457277f, 0.234346539f},
-std::array<float,2>{0.0167633016f, 0.843789637f},
-std::array<float,2>{0.297940314f, 0.359397054f},
-std::array<float,2>{0.726098239f, 0.74179405f},
-std::array<float,2>{0.946187377f, 0.28643173f},
-std::array<float,2>{0.125094518f, 0.643407762f},
-std::array<float,2>{0.421989977f, 0.157583624f},
-std::array<float,2>{0.573432624f, 0.807253957f},
-std::array<float,2>{0.638493419f, 0.00655231439f},
-std::array<float,2>{0.345977813f, 0.969352901f},
-std::array<float,2>{0.106142424f, 0.451998442f},
-std::array<float,2>{0.767278016f, 0.587209165f},
-std::array<float,2>{0.731062412f, 0.384006053f},
-std::array<float,2>{0.311810613f, 0.521397531f},
-std::array<float,2>{0.0249173865f, 0.102208145f},
-std::array<float,2>{0.85904783f, 0.917373002f},
-std::array<float,2>{0.905361354f, 0.216141537f},
-std::array<float,2>{0.246460095f, 0.812678397f},
-std::array<float,2>{0.451429337f, 0.312764108f},
-std::array<float,2>{0.536385655f, 0.701986074f},
-std::array<float,2>{0.777632654f, 0.274311125f},
-std::array<float,2>{0.0961430594f, 0.683984041f},
-std::array<float,2>{0.354249388f, 0.14824082f},
-std::array<float,2>{0.625932574f, 0.761113465f},
-std::array<float,2>{0.56745708f, 0.0515599959f},
-std::array<float,2>{0.4304097f, 0.951222062f},
-std::array<float,2>{0.134017229f, 0.482218355f},
-std::array<float,2>{0.938366771f, 0.607009768f},
-std::array<float,2>{0.521485806f, 0.370994478f},
-std::array<float,2>{0.484091192f, 0.747152269f},
-std::array<float,2>{0.190412655f, 0.222419232f},
-std::array<float,2>{0.920719802f, 0.856495559f},
-std::array<float,2>{0.814492583f, 0.0747268349f},
-std::array<float,2>{0.0537831858f, 0.906136453f},
-std::array<float,2>{0.277868569f, 0.419909149f},
-std::array<float,2>{0.692626595f, 0.541043699f},
-std::array<float,2>{0.973023176f, 0.442611396f},
-std::array<float,2>{0.162942439f, 0.584118724f},
-std::array<float,2>{0.404795527f, 0.0116206119f},
-std::array<float,2>{0.61401552f, 0.977759242f},
-std::array<float,2>{0.676979303f, 0.165052086f},
-std::array<float,2>{0.340813249f, 0.804673493f},
-std::array<float,2>{0.0808469355f, 0.290496081f},
-std::array<float,2>{0.792657733f, 0.652858853f},
-std::array<float,2>{0.651870966f, 0.296907127f},
-std::array<float,2>{0.361760616f, 0.635690212f},
-std::array<float,2>{0.114574865f, 0.175502345f},
-std::array<float,2>{0.758811295f, 0.794513404f},
-std::array<float,2>{0.956499279f, 0.0259361546f},
-std::array<float,2>{0.148791894f, 0.997930348f},
-std::array<float,2>{0.410377264f, 0.455937058f},
-std::array<float,2>{0.591263473f, 0.571939826f},
-std::array<float,2>{0.863403261f, 0.436648309f},
-std::array<float,2>{0.00249488559f, 0.547378957f},
-std::array<float,2>{0.285725772f, 0.0862798765f},
-std::array<float,2>{0.741320729f, 0.890191138f},
-std::array<float,2>{0.549459338f, 0.242802843f},
-std::array<float,2>{0.462025702f, 0.862332225f},
-std::array<float,2>{0.223296061f, 0.357410997f},
-std::array<float,2>{0.878355265f, 0.726613522f},
-std::array<float,2>{0.594344735f, 0.486010849f},
-std::array<float,2>{0.385751158f, 0.623956084f},
-std::array<float,2>{0.187007844f, 0.0401928015f},
-std::array<float,2>{0.987977207f, 0.954026401f},
-std::array<float,2>{0.806886852f, 0.127035156f},
-std::array<float,2>{0.0700835213f, 0.768402696f},
-std::array<float,2>{0.318359345f, 0.254752845f},
-std::array<float,2>{0.6682657f, 0.664359629f},
-std::array<float,2>{0.936791599f, 0.337026805f},
-std::array<float,2>{0.214732572f, 0.71580416f},
-std::array<float,2>{0.497627199f, 0.187658295f},
-std::array<float,2>{0.504815698f, 0.839653015f},
-std::array<float,2>{0.711098611f, 0.113197684f},
-std::array<float,2>{0.261337817f, 0.930695295f},
-std::array<float,2>{0.0399679206f, 0.397851348f},
-std::array<float,2>{0.835801601f, 0.50489223f},
-std::array<float,2>{0.747838259f, 0.438745201f},
-std::array<float,2>{0.29394269f, 0.580390692f},
-std::array<float,2>{0.00840771943f, 0.0155643951f},
-std::array<float,2>{0.873308122f, 0.982456744f},
-std::array<float,2>{0.887145281f, 0.1684701f},
-std::array<float,2>{0.229134545f, 0.797829807f},
-std::array<float,2>{0.45622018f, 0.295327157f},
-std::array<float,2>{0.554719746f, 0.650167048f},
-std::array<float,2>{0.750164151f, 0.372206181f},
-std::array<float,2>{0.118001603f, 0.743601143f},
-std::array<float,2>{0.369491309f, 0.223569855f},
-std::array<float,2>{0.643427134f, 0.852891326f},
-std::array<float,2>{0.582283378f, 0.0736262649f},
-std::array<float,2>{0.414097279f, 0.90216589f},
-std::array<float,2>{0.141972765f, 0.417587101f},
-std::array<float,2>{0.961836278f, 0.543051064f},
-std::array<float,2>{0.51336062f, 0.279712647f},
-std::array<float,2>{0.484956563f, 0.679837823f},
-std::array<float,2>{0.206931338f, 0.143038541f},
-std::array<float,2>{0.927434266f, 0.763590515f},
-std::array<float,2>{0.839496911f, 0.0491288193f},
-std::array<float,2>{0.0322995111f, 0.945493102f},
-std::array<float,2>{0.256126404f, 0.480165005f},
-std::array<float,2>{0.709281921f, 0.601784289f},
-std::array<float,2>{0.994101524f, 0.390053511f},
-std::array<float,2>{0.175255165f, 0.519406378f},
-std::array<float,2>{0.375147939f, 0.109132871f},
-std::array<float,2>{0.605138958f, 0.919484258f},
-std::array<float,2>{0.661277771f, 0.213737801f},
-std::array<float,2>{0.327293575f, 0.818791449f},
-std::array<float,2>{0.0754607841f, 0.31958127f},
-std::array<float,2>{0.803074479f, 0.698858202f},
-std::array<float,2>{0.636168957f, 0.343580842f},
-std::array<float,2>{0.350752473f, 0.712246299f},
-std::array<float,2>{0.105291232f, 0.195290908f},
-std::array<float,2>{0.77187866f, 0.840242565f},
-std::array<float,2>{0.952077925f, 0.114871085f},
-std::array<float,2>{0.129656583f, 0.937390506f},
-std::array<float,2>{0.428494573f, 0.3906672f},
-std::array<float,2>{0.575362325f, 0.501803577f},
-std::array<float,2>{0.843898833f, 0.490570128f},
-std::array<float,2>{0.0212928914f, 0.617449582f},
-std::array<float,2>{0.302010834f, 0.0434813537f},
-std::array<float,2>{0.719061017f, 0.95778048f},
-std::array<float,2>{0.541478276f, 0.13141112f},
-std::array<float,2>{0.438999087f, 0.772291303f},
-std::array<float,2>{0.234469086f, 0.253209352f},
-std::array<float,2>{0.896159828f, 0.668781817f},
-std::array<float,2>{0.619635105f, 0.432655156f},
-std::array<float,2>{0.398370177f, 0.552859306f},
-std::array<float,2>{0.165756106f, 0.0901234671f},
-std::array<float,2>{0.98437053f, 0.886383593f},
-std::array<float,2>{0.784445941f, 0.248903155f},
-std::array<float,2>{0.0863493085f, 0.864772201f},
-std::array<float,2>{0.332972914f, 0.354339182f},
-std::array<float,2>{0.680757642f, 0.730785966f},
-std::array<float,2>{0.910460055f, 0.302714854f},
-std::array<float,2>{0.201221868f, 0.639927864f},
-std::array<float,2>{0.468853295f, 0.176256537f},
-std::array<float,2>{0.529381812f, 0.792365015f},
-std::array<float,2>{0.702355862f, 0.0280598123f},
-std::array<float,2>{0.267265409f, 0.996022999f},
-std::array<float,2>{0.0592483543f, 0.457191259f},
-std::array<float,2>{0.827983081f, 0.574700177f},
-std::array<float,2>{0.673950434f, 0.405861914f},
-std::array<float,2>{0.338899255f, 0.510788977f},
-std::array<float,2>{0.0846199319f, 0.122456618f},
-std::array<float,2>{0.794533253f, 0.927430034f},
-std::array<float,2>{0.971599996f, 0.197477996f},
-std::array<float,2>{0.156364307f, 0.829640865f},
-std::array<float,2>{0.398788869f, 0.335192859f},
-std::array<float,2>{0.609854937f, 0.709300995f},
-std::array<float,2>{0.82016778f, 0.26501143f},
-std::array<float,2>{0.0469948649f, 0.661762834f},
-std::array<float,2>{0.276905358f, 0.139089286f},
-std::array<float,2>{0.68950808f, 0.779327989f},
-std::array<float,2>{0.518429101f, 0.0359109044f},
-std::array<float,2>{0.478699237f, 0.963370919f},
-std::array<float,2>{0.19394125f, 0.495594621f},
-std::array<float,2>{0.91675216f, 0.610191643f},
-std::array<float,2>{0.563040018f, 0.349611431f},
-std::array<float,2>{0.436573386f, 0.726379335f},
-std::array<float,2>{0.139488533f, 0.241447747f},
-std::array<float,2>{0.942452073f, 0.871464968f},
-std::array<float,2>{0.77727586f, 0.0787458792f},
-std::array<float,2>{0.0990035236f, 0.876944482f},
-std::array<float,2>{0.359072387f, 0.425947994f},
-std::array<float,2>{0.632098019f, 0.561192691f},
-std::array<float,2>{0.902033269f, 0.462028861f},
-std::array<float,2>{0.242685556f, 0.566953599f},
-std::array<float,2>{0.44793421f, 0.0180807337f},
-std::array<float,2>{0.532001495f, 0.992017388f},
-std::array<float,2>{0.72768575f, 0.183893904f},
-std::array<float,2>{0.307592601f, 0.782460809f},
-std::array<float,2>{0.0300364047f, 0.308427989f},
-std::array<float,2>{0.854243517f, 0.625193179f},
-std::array<float,2>{0.71828264f, 0.281669378f},
-std::array<float,2>{0.262170404f, 0.64544028f},
-std::array<float,2>{0.0445377976f, 0.163719833f},
-std::array<float,2>{0.828411281f, 0.812430978f},
-std::array<float,2>{0.933479786f, 0.00188522483f},
-std::array<float,2>{0.216259852f, 0.975330889f},
-std::array<float,2>{0.495436847f, 0.446000546f},
-std::array<float,2>{0.500150561f, 0.592751861f},
-std::array<float,2>{0.809673786f, 0.411761314f},
-std::array<float,2>{0.062636517f, 0.53649801f},
-std::array<float,2>{0.315737754f, 0.0691310689f},
-std::array<float,2>{0.667507052f, 0.895184517f},
-std::array<float,2>{0.60120827f, 0.228999659f},
-std::array<float,2>{0.387083679f, 0.848044455f},
-std::array<float,2>{0.183441058f, 0.366829276f},
-std::array<float,2>{0.989754975f, 0.734662712f},
-std::array<float,2>{0.5528723f, 0.469731867f},
-std::array<float,2>{0.468072832f, 0.59937048f},
-std::array<float,2>{0.220269084f, 0.0595967844f},
-std::array<float,2>{0.881358981f, 0.938631892f},
-std::array<float,2>{0.860687315f, 0.15064241f},
-std::array<float,2>{0.00769297732f, 0.753156602f},
-std::array<float,2>{0.281391442f, 0.272969127f},
-std::array<float,2>{0.734992445f, 0.678089023f},
-std::array<float,2>{0.958043158f, 0.323279113f},
-std::array<float,2>{0.155466601f, 0.694386601f},
-std::array<float,2>{0.407944858f, 0.210401431f},
-std::array<float,2>{0.588560939f, 0.822518229f},
-std::array<float,2>{0.653081119f, 0.0944920406f},
-std::array<float,2>{0.366212517f, 0.909815252f},
-std::array<float,2>{0.111656196f, 0.380274266f},
-std::array<float,2>{0.765502632f, 0.530173898f},
-std::array<float,2>{0.648205817f, 0.498787552f},
-std::array<float,2>{0.374803483f, 0.613703668f},
-std::array<float,2>{0.122040682f, 0.0326636694f},
-std::array<float,2>{0.754884422f, 0.968240142f},
-std::array<float,2>{0.966107488f, 0.136153609f},
-std::array<float,2>{0.144906417f, 0.777301669f},
-std::array<float,2>{0.418198884f, 0.259269387f},
-std::array<float,2>{0.579269886f, 0.65876931f},
-std::array<float,2>{0.869606316f, 0.330208659f},
-std::array<float,2>{0.0124027822f, 0.706443965f},
-std::array<float,2>{0.291183889f, 0.200829372f},
-std::array<float,2>{0.743683279f, 0.835049689f},
-std::array<float,2>{0.559951901f, 0.117829941f},
-std::array<float,2>{0.460377097f, 0.922977448f},
-std::array<float,2>{0.232235461f, 0.399411589f},
-std::array<float,2>{0.883367181f, 0.513541162f},
-std::array<float,2>{0.609264553f, 0.308659226f},
-std::array<float,2>{0.382699162f, 0.631563246f},
-std::array<float,2>{0.178121164f, 0.18241249f},
-std::array<float,2>{0.996504545f, 0.785980105f},
-std::array<float,2>{0.799944937f, 0.0200912133f},
-std::array<float,2>{0.0739158392f, 0.98806107f},
-std::array<float,2>{0.322671622f, 0.468174905f},
-std::array<float,2>{0.657345176f, 0.5640288f},
-std::array<float,2>{0.92260319f, 0.423737705f},
-std::array<float,2>{0.207752392f, 0.555125117f},
-std::array<float,2>{0.488896102f, 0.084390685f},
-std::array<float,2>{0.511609197f, 0.879079103f},
-std::array<float,2>{0.705053508f, 0.235430539f},
-std::array<float,2>{0.250923455f, 0.8674559f},
-std::array<float,2>{0.036433205f, 0.345936865f},
-std::array<float,2>{0.84120971f, 0.722289979f},
-std::array<float,2>{0.723601162f, 0.363230616f},
-std::array<float,2>{0.299571753f, 0.738454461f},
-std::array<float,2>{0.0182782952f, 0.231657505f},
-std::array<float,2>{0.850367248f, 0.847586155f},
-std::array<float,2>{0.891492128f, 0.0638273656f},
-std::array<float,2>{0.24003835f, 0.892244995f},
-std::array<float,2>{0.442218125f, 0.407897472f},
-std::array<float,2>{0.546332002f, 0.532783091f},
-std::array<float,2>{0.767617285f, 0.450032115f},
-std::array<float,2>{0.109027371f, 0.589784265f},
-std::array<float,2>{0.344759494f, 0.00477235066f},
-std::array<float,2>{0.638704777f, 0.971479774f},
-std::array<float,2>{0.571747363f, 0.158909738f},
-std::array<float,2>{0.424375474f, 0.806348145f},
-std::array<float,2>{0.127086177f, 0.287525386f},
-std::array<float,2>{0.947783053f, 0.641064584f},
-std::array<float,2>{0.524891496f, 0.377729923f},
-std::array<float,2>{0.473283112f, 0.525571287f},
-std::array<float,2>{0.196048498f, 0.0987321287f},
-std::array<float,2>{0.908164501f, 0.910683393f},
-std::array<float,2>{0.823167264f, 0.203935459f},
-std::array<float,2>{0.0561255217f, 0.824766576f},
-std::array<float,2>{0.272543311f, 0.325949281f},
-std::array<float,2>{0.698363483f, 0.69028616f},
-std::array<float,2>{0.977832377f, 0.265843362f},
-std::array<float,2>{0.169969141f, 0.674684942f},
-std::array<float,2>{0.394527167f, 0.154151037f},
-std::array<float,2>{0.624367952f, 0.755076289f},
-std::array<float,2>{0.684265971f, 0.0556663983f},
-std::array<float,2>{0.328732371f, 0.942882001f},
-std::array<float,2>{0.0912852362f, 0.47632587f},
-std::array<float,2>{0.787485957f, 0.596314311f},
-std::array<float,2>{0.694403291f, 0.421013713f},
-std::array<float,2>{0.28053984f, 0.539191365f},
-std::array<float,2>{0.0516024865f, 0.0765414611f},
-std::array<float,2>{0.812736928f, 0.903116167f},
-std::array<float,2>{0.919690728f, 0.219801128f},
-std::array<float,2>{0.189259782f, 0.859203696f},
-std::array<float,2>{0.481232554f, 0.367970079f},
-std::array<float,2>{0.520473063f, 0.748339474f},
-std::array<float,2>{0.789738476f, 0.2917611f},
-std::array<float,2>{0.0796213299f, 0.654788971f},
-std::array<float,2>{0.342722446f, 0.167095602f},
-std::array<float,2>{0.679339528f, 0.802704573f},
-std::array<float,2>{0.616170049f, 0.00942346081f},
-std::array<float,2>{0.404135317f, 0.979041457f},
-std::array<float,2>{0.161322162f, 0.443687618f},
-std::array<float,2>{0.976200044f, 0.582420647f},
-std::array<float,2>{0.538168788f, 0.315946877f},
-std::array<float,2>{0.450240225f, 0.699447572f},
-std::array<float,2>{0.249933913f, 0.217030227f},
-std::array<float,2>{0.904101908f, 0.814716697f},
-std::array<float,2>{0.857258916f, 0.103592031f},
-std::array<float,2>{0.0271041393f, 0.914455295f},
-std::array<float,2>{0.309183717f, 0.385693699f},
-std::array<float,2>{0.73400867f, 0.522101223f},
-std::array<float,2>{0.940900862f, 0.483971894f},
-std::array<float,2>{0.135827675f, 0.607913911f},
-std::array<float,2>{0.433454663f, 0.0528887473f},
-std::array<float,2>{0.569119751f, 0.949696064f},
-std::array<float,2>{0.628637075f, 0.146054015f},
-std::array<float,2>{0.353023589f, 0.758487642f},
-std::array<float,2>{0.0948448107f, 0.276788116f},
-std::array<float,2>{0.779988945f, 0.686560929f},
-std::array<float,2>{0.670817375f, 0.256811857f},
-std::array<float,2>{0.318810403f, 0.666584134f},
-std::array<float,2>{0.0676574856f, 0.125790253f},
-std::array<float,2>{0.804770291f, 0.766328633f},
-std::array<float,2>{0.986263275f, 0.0414754823f},
-std::array<float,2>{0.184074f, 0.956908107f},
-std::array<float,2>{0.382916749f, 0.487837344f},
-std::array<float,2>{0.596825778f, 0.622999907f},
-std::array<float,2>{0.832342267f, 0.396050781f},
-std::array<float,2>{0.0429244004f, 0.506712794f},
-std::array<float,2>{0.258421361f, 0.109478712f},
-std::array<float,2>{0.713080227f, 0.933145702f},
-std::array<float,2>{0.505987287f, 0.190358847f},
-std::array<float,2>{0.498357236f, 0.835951447f},
-std::array<float,2>{0.212645099f, 0.338670343f},
-std::array<float,2>{0.934932649f, 0.716921389f},
-std::array<float,2>{0.593283236f, 0.454631448f},
-std::array<float,2>{0.413791478f, 0.573785782f},
-std::array<float,2>{0.150597766f, 0.024206724f},
-std::array<float,2>{0.95384407f, 0.998670578f},
-std::array<float,2>{0.760958135f, 0.17211628f},
-std::array<float,2>{0.116902903f, 0.795101225f},
-std::array<float,2>{0.361276776f, 0.299695909f},
-std::array<float,2>{0.650339246f, 0.634455025f},
-std::array<float,2>{0.876191556f, 0.357537866f},
-std::array<float,2>{0.225934952f, 0.728619397f},
-std::array<float,2>{0.464545161f, 0.244762421f},
-std::array<float,2>{0.547404289f, 0.861038089f},
-std::array<float,2>{0.738441706f, 0.0894919336f},
-std::array<float,2>{0.288596958f, 0.888396859f},
-std::array<float,2>{0.00125914521f, 0.434227467f},
-std::array<float,2>{0.866796851f, 0.55056107f},
-std::array<float,2>{0.72049129f, 0.488613933f},
-std::array<float,2>{0.301191717f, 0.620270014f},
-std::array<float,2>{0.0197336376f, 0.0454997271f},
-std::array<float,2>{0.845372617f, 0.959352493f},
-std::array<float,2>{0.895475149f, 0.129283562f},
-std::array<float,2>{0.235650942f, 0.770480871f},
-std::array<float,2>{0.438437492f, 0.251725078f},
-std::array<float,2>{0.542425573f, 0.670602202f},
-std::array<float,2>{0.772585392f, 0.340524167f},
-std::array<float,2>{0.104363911f, 0.713845313f},
-std::array<float,2>{0.349957734f, 0.191497162f},
-std::array<float,2>{0.635518789f, 0.84360379f},
-std::array<float,2>{0.574993432f, 0.116218336f},
-std::array<float,2>{0.429115295f, 0.93369031f},
-std::array<float,2>{0.130176023f, 0.392717689f},
-std::array<float,2>{0.952262938f, 0.503460944f},
-std::array<float,2>{0.5309636f, 0.304125041f},
-std::array<float,2>{0.470026523f, 0.637956679f},
-std::array<float,2>{0.202561215f, 0.179402858f},
-std::array<float,2>{0.911229253f, 0.789482594f},
-std::array<float,2>{0.826531589f, 0.0296480451f},
-std::array<float,2>{0.059700869f, 0.993626833f},
-std::array<float,2>{0.265662819f, 0.460226387f},
-std::array<float,2>{0.701932788f, 0.577849627f},
-std::array<float,2>{0.982966363f, 0.431034207f},
-std::array<float,2>{0.164820969f, 0.552316368f},
-std::array<float,2>{0.39656657f, 0.0923690945f},
-std::array<float,2>{0.620260835f, 0.883717835f},
-std::array<float,2>{0.67985028f, 0.247590527f},
-std::array<float,2>{0.333293468f, 0.866028786f},
-std::array<float,2>{0.0878779441f, 0.352340072f},
-std::array<float,2>{0.783307791f, 0.733586669f},
-std::array<float,2>{0.643666565f, 0.373578429f},
-std::array<float,2>{0.371080875f, 0.744433105f},
-std::array<float,2>{0.11834155f, 0.225853413f},
-std::array<float,2>{0.751591265f, 0.853908896f},
-std::array<float,2>{0.962771177f, 0.0717357248f},
-std::array<float,2>{0.141545832f, 0.899947286f},
-std::array<float,2>{0.41545251f, 0.41551581f},
-std::array<float,2>{0.583616316f, 0.546027005f},
-std::array<float,2>{0.874733508f, 0.440503925f},
-std::array<float,2>{0.00939289946f, 0.579240143f},
-std::array<float,2>{0.294402063f, 0.0118266428f},
-std::array<float,2>{0.746443093f, 0.981188834f},
-std::array<float,2>{0.556399286f, 0.171472803f},
-std::array<float,2>{0.4554905f, 0.800753415f},
-std::array<float,2>{0.229696885f, 0.293111861f},
-std::array<float,2>{0.888426661f, 0.651619196f},
-std::array<float,2>{0.603951156f, 0.388600111f},
-std::array<float,2>{0.376006931f, 0.516408682f},
-std::array<float,2>{0.174681187f, 0.105983622f},
-std::array<float,2>{0.992696524f, 0.92067796f},
-std::array<float,2>{0.803886354f, 0.212496981f},
-std::array<float,2>{0.0750534981f, 0.817607701f},
-std::array<float,2>{0.326254219f, 0.317537665f},
-std::array<float,2>{0.660353959f, 0.696253538f},
-std::array<float,2>{0.926142335f, 0.279289365f},
-std::array<float,2>{0.205734164f, 0.682379484f},
-std::array<float,2>{0.485629588f, 0.141378269f},
-std::array<float,2>{0.512221456f, 0.764706314f},
-std::array<float,2>{0.710904419f, 0.0481808037f},
-std::array<float,2>{0.257194042f, 0.94782573f},
-std::array<float,2>{0.0314338878f, 0.477311283f},
-std::array<float,2>{0.838367105f, 0.603561223f},
-std::array<float,2>{0.666775644f, 0.413048178f},
-std::array<float,2>{0.315387577f, 0.537439764f},
-std::array<float,2>{0.0635901466f, 0.067531541f},
-std::array<float,2>{0.809102595f, 0.898399353f},
-std::array<float,2>{0.988769531f, 0.227563709f},
-std::array<float,2>{0.182159752f, 0.850110233f},
-std::array<float,2>{0.387726635f, 0.363404691f},
-std::array<float,2>{0.599649251f, 0.736898661f},
-std::array<float,2>{0.829960108f, 0.283942759f},
-std::array<float,2>{0.0436628945f, 0.647025645f},
-std::array<float,2>{0.263178974f, 0.160193354f},
-std::array<float,2>{0.716987014f, 0.808945239f},
-std::array<float,2>{0.501514792f, 0.00341976574f},
-std::array<float,2>{0.494846433f, 0.973583877f},
-std::array<float,2>{0.215193018f, 0.448716491f},
-std::array<float,2>{0.932248712f, 0.590665996f},
-std::array<float,2>{0.589508355f, 0.32041505f},
-std::array<float,2>{0.406447172f, 0.69295603f},
-std::array<float,2>{0.154888317f, 0.207597822f},
-std::array<float,2>{0.957261801f, 0.820815444f},
-std::array<float,2>{0.763930678f, 0.0965591148f},
-std::array<float,2>{0.112453274f, 0.907561779f},
-std::array<float,2>{0.365497887f, 0.381693274f},
-std::array<float,2>{0.654161036f, 0.527429461f},
-std::array<float,2>{0.882558465f, 0.471642673f},
-std::array<float,2>{0.219608158f, 0.601179719f},
-std::array<float,2>{0.466979653f, 0.0623384118f},
-std::array<float,2>{0.553837121f, 0.940667868f},
-std::array<float,2>{0.735998571f, 0.148864344f},
-std::array<float,2>{0.282755256f, 0.751041591f},
-std::array<float,2>{0.00631950144f, 0.271311134f},
-std::array<float,2>{0.859717309f, 0.677099884f},
-std::array<float,2>{0.690679848f, 0.26320219f},
-std::array<float,2>{0.275651932f, 0.662861645f},
-std::array<float,2>{0.0481371656f, 0.13705717f},
-std::array<float,2>{0.819185317f, 0.777548552f},
-std::array<float,2>{0.917606711f, 0.0372093916f},
-std::array<float,2>{0.194729954f, 0.961492777f},
-std::array<float,2>{0.480382323f, 0.492891252f},
-std::array<float,2>{0.51887238f, 0.612814188f},
-std::array<float,2>{0.793268681f, 0.403567135f},
-std::array<float,2>{0.0858750418f, 0.508650184f},
-std::array<float,2>{0.338431835f, 0.124129772f},
-std::array<float,2>{0.674808562f, 0.927998722f},
-std::array<float,2>{0.611064911f, 0.195709422f},
-std::array<float,2>{0.400075316f, 0.831547737f},
-std::array<float,2>{0.157992303f, 0.333385348f},
-std::array<float,2>{0.971686423f, 0.708419442f},
-std::array<float,2>{0.53289032f, 0.463199973f},
-std::array<float,2>{0.449211657f, 0.569669724f},
-std::array<float,2>{0.243974775f, 0.0167753752f},
-std::array<float,2>{0.900705338f, 0.988733888f},
-std::array<float,2>{0.855062068f, 0.186843351f},
-std::array<float,2>{0.0307032652f, 0.785148084f},
-std::array<float,2>{0.308428645f, 0.306242168f},
-std::array<float,2>{0.726635098f, 0.62732619f},
-std::array<float,2>{0.94226408f, 0.349576771f},
-std::array<float,2>{0.140162364f, 0.724101722f},
-std::array<float,2>{0.436101764f, 0.239487678f},
-std::array<float,2>{0.564248264f, 0.8739748f},
-std::array<float,2>{0.631620228f, 0.0816616118f},
-std::array<float,2>{0.35781163f, 0.87782526f},
-std::array<float,2>{0.0981427282f, 0.428890616f},
-std::array<float,2>{0.77586323f, 0.559848428f},
-std::array<float,2>{0.640563786f, 0.452662319f},
-std::array<float,2>{0.344308406f, 0.586554348f},
-std::array<float,2>{0.108212195f, 0.00773491245f},
-std::array<float,2>{0.769420803f, 0.970411599f},
-std::array<float,2>{0.948729813f, 0.156995922f},
-std::array<float,2>{0.127947584f, 0.807907045f},
-std::array<float,2>{0.425019473f, 0.285977274f},
-std::array<float,2>{0.570859551f, 0.643969834f},
-std::array<float,2>{0.850668967f, 0.360580057f},
-std::array<float,2>{0.0187559184f, 0.740579963f},
-std::array<float,2>{0.300743759f, 0.233326957f},
-std::array<float,2>{0.72377938f, 0.845661879f},
-std::array<float,2>{0.545625448f, 0.0659184679f},
-std::array<float,2>{0.442781955f, 0.894059539f},
-std::array<float,2>{0.239065215f, 0.408632755f},
-std::array<float,2>{0.89252007f, 0.534415603f},
-std::array<float,2>{0.623548388f, 0.26833728f},
-std::array<float,2>{0.393443346f, 0.673418522f},
-std::array<float,2>{0.171564758f, 0.154745847f},
-std::array<float,2>{0.976895273f, 0.757108033f},
-std::array<float,2>{0.788468838f, 0.057246346f},
-std::array<float,2>{0.0905288905f, 0.944482148f},
-std::array<float,2>{0.330055177f, 0.472771347f},
-std::array<float,2>{0.684792697f, 0.595494628f},
-std::array<float,2>{0.907129347f, 0.375414759f},
-std::array<float,2>{0.196487114f, 0.523562372f},
-std::array<float,2>{0.474248946f, 0.101341538f},
-std::array<float,2>{0.524191499f, 0.91217494f},
-std::array<float,2>{0.698045611f, 0.205598161f},
-std::array<float,2>{0.271633118f, 0.826294243f},
-std::array<float,2>{0.0556011759f, 0.326605082f},
-std::array<float,2>{0.823634624f, 0.687811196f},
-std::array<float,2>{0.7426126f, 0.330009699f},
-std::array<float,2>{0.292679638f, 0.703942716f},
-std::array<float,2>{0.0135660581f, 0.202966005f},
-std::array<float,2>{0.870656252f, 0.833111584f},
-std::array<float,2>{0.884551644f, 0.120544307f},
-std::array<float,2>{0.230534047f, 0.923916757f},
-std::array<float,2>{0.459910542f, 0.401227176f},
-std::array<float,2>{0.559175849f, 0.514130831f},
-std::array<float,2>{0.754023373f, 0.497205555f},
-std::array<float,2>{0.12265528f, 0.6155985f},
-std::array<float,2>{0.373368591f, 0.0341114327f},
-std::array<float,2>{0.646782756f, 0.965464592f},
-std::array<float,2>{0.578709245f, 0.132903621f},
-std::array<float,2>{0.419286251f, 0.773516595f},
-std::array<float,2>{0.145782858f, 0.261623532f},
-std::array<float,2>{0.965101242f, 0.656441033f},
-std::array<float,2>{0.510675251f, 0.425644219f},
-std::array<float,2>{0.489385277f, 0.558418274f},
-std::array<float,2>{0.208649814f, 0.0830257088f},
-std::array<float,2>{0.923647404f, 0.882000387f},
-std::array<float,2>{0.84027952f, 0.236642748f},
-std::array<float,2>{0.0359713882f, 0.869418919f},
-std::array<float,2>{0.251343369f, 0.343818933f},
-std::array<float,2>{0.703579307f, 0.720285118f},
-std::array<float,2>{0.997423053f, 0.310792148f},
-std::array<float,2>{0.179685697f, 0.630084932f},
-std::array<float,2>{0.381066501f, 0.18071638f},
-std::array<float,2>{0.607675731f, 0.788254499f},
-std::array<float,2>{0.657022834f, 0.02237425f},
-std::array<float,2>{0.324197561f, 0.985725403f},
-std::array<float,2>{0.0725855976f, 0.465750694f},
-std::array<float,2>{0.799078286f, 0.56629163f},
-std::array<float,2>{0.71467483f, 0.397174865f},
-std::array<float,2>{0.258869678f, 0.504323781f},
-std::array<float,2>{0.0414904281f, 0.111737341f},
-std::array<float,2>{0.833636522f, 0.929752409f},
-std::array<float,2>{0.934490979f, 0.18888852f},
-std::array<float,2>{0.211361244f, 0.838460863f},
-std::array<float,2>{0.499737382f, 0.336316645f},
-std::array<float,2>{0.506892025f, 0.716067553f},
-std::array<float,2>{0.806076944f, 0.255581677f},
-std::array<float,2>{0.0670156181f, 0.665040612f},
-std::array<float,2>{0.319448173f, 0.128179446f},
-std::array<float,2>{0.671326935f, 0.768873155f},
-std::array<float,2>{0.595892787f, 0.0397964381f},
-std::array<float,2>{0.384444892f, 0.954137921f},
-std::array<float,2>{0.185425624f, 0.484453648f},
-std::array<float,2>{0.985204756f, 0.624085724f},
-std::array<float,2>{0.548694253f, 0.356209368f},
-std::array<float,2>{0.463457197f, 0.727850139f},
-std::array<float,2>{0.225188404f, 0.2432428f},
-std::array<float,2>{0.875220537f, 0.862175643f},
-std::array<float,2>{0.866175711f, 0.0873899981f},
-std::array<float,2>{0.000580031949f, 0.889483392f},
-std::array<float,2>{0.287981093f, 0.436502218f},
-std::array<float,2>{0.739490628f, 0.547992527f},
-std::array<float,2>{0.954803944f, 0.456596076f},
-std::array<float,2>{0.151466206f, 0.571268499f},
-std::array<float,2>{0.412628144f, 0.0267560333f},
-std::array<float,2>{0.59252888f, 0.996730864f},
-std::array<float,2>{0.649279177f, 0.174564481f},
-std::array<float,2>{0.359449983f, 0.793606281f},
-std::array<float,2>{0.116019085f, 0.298689723f},
-std::array<float,2>{0.760320306f, 0.636138618f},
-std::array<float,2>{0.678557813f, 0.289707214f},
-std::array<float,2>{0.343004853f, 0.653585553f},
-std::array<float,2>{0.0783636719f, 0.164591029f},
-std::array<float,2>{0.790692985f, 0.802743375f},
-std::array<float,2>{0.975349903f, 0.0104973707f},
-std::array<float,2>{0.160717264f, 0.976867735f},
-std::array<float,2>{0.40312466f, 0.442324191f},
-std::array<float,2>{0.616324067f, 0.585032463f},
-std::array<float,2>{0.814392865f, 0.418417841f},
-std::array<float,2>{0.0521121696f, 0.542256236f},
-std::array<float,2>{0.280035317f, 0.0758948326f},
-std::array<float,2>{0.694201648f, 0.904962301f},
-std::array<float,2>{0.520958483f, 0.221445575f},
-std::array<float,2>{0.482043505f, 0.856035888f},
-std::array<float,2>{0.187587902f, 0.369568706f},
-std::array<float,2>{0.918434262f, 0.746277511f},
-std::array<float,2>{0.569722593f, 0.4805004f},
-std::array<float,2>{0.431926012f, 0.606030166f},
-std::array<float,2>{0.135219708f, 0.0521045998f},
-std::array<float,2>{0.939771831f, 0.953032613f},
-std::array<float,2>{0.78089118f, 0.146582991f},
-std::array<float,2>{0.0940990448f, 0.760058582f},
-std::array<float,2>{0.351969391f, 0.275232971f},
-std::array<float,2>{0.627385914f, 0.685290933f},
-std::array<float,2>{0.902448773f, 0.313702434f},
-std::array<float,2>{0.248178303f, 0.702163041f},
-std::array<float,2>{0.449612588f, 0.215104222f},
-std::array<float,2>{0.537956893f, 0.813960135f},
-std::array<float,2>{0.732688367f, 0.103488833f},
-std::array<float,2>{0.31035611f, 0.916507185f},
-std::array<float,2>{0.026014369f, 0.383278638f},
-std::array<float,2>{0.856211185f, 0.519828022f},
-std::array<float,2>{0.699610054f, 0.458128482f},
-std::array<float,2>{0.267754436f, 0.575934589f},
-std::array<float,2>{0.0616780184f, 0.028618427f},
-std::array<float,2>{0.824456751f, 0.994999588f},
-std::array<float,2>{0.913298726f, 0.177282944f},
-std::array<float,2>{0.200277269f, 0.791218162f},
-std::array<float,2>{0.470956057f, 0.300922781f},
-std::array<float,2>{0.527845144f, 0.639050961f},
-std::array<float,2>{0.781584859f, 0.355257809f},
-std::array<float,2>{0.0893858373f, 0.73221314f},
-std::array<float,2>{0.335228145f, 0.249429837f},
-std::array<float,2>{0.682360113f, 0.863319457f},
-std::array<float,2>{0.618682504f, 0.0912491083f},
-std::array<float,2>{0.395420521f, 0.884888232f},
-std::array<float,2>{0.166764975f, 0.431808859f},
-std::array<float,2>{0.981161773f, 0.554225087f},
-std::array<float,2>{0.539123595f, 0.252409726f},
-std::array<float,2>{0.440374315f, 0.669160247f},
-std::array<float,2>{0.23721233f, 0.132266387f},
-std::array<float,2>{0.898335874f, 0.772816479f},
-std::array<float,2>{0.847628534f, 0.0445392542f},
-std::array<float,2>{0.0216820445f, 0.958470166f},
-std::array<float,2>{0.304442406f, 0.491264224f},
-std::array<float,2>{0.721893609f, 0.619140506f},
-std::array<float,2>{0.950521946f, 0.392049372f},
-std::array<float,2>{0.132034987f, 0.500681102f},
-std::array<float,2>{0.426756769f, 0.113509178f},
-std::array<float,2>{0.577337444f, 0.93611747f},
-std::array<float,2>{0.632982492f, 0.194103196f},
-std::array<float,2>{0.347734481f, 0.841286957f},
-std::array<float,2>{0.102506153f, 0.342737943f},
-std::array<float,2>{0.771035671f, 0.71112442f},
-std::array<float,2>{0.663585424f, 0.318740666f},
-std::array<float,2>{0.324933499f, 0.698044181f},
-std::array<float,2>{0.077496767f, 0.214831784f},
-std::array<float,2>{0.802724302f, 0.819615066f},
-std::array<float,2>{0.994250596f, 0.107600808f},
-std::array<float,2>{0.173429683f, 0.918860972f},
-std::array<float,2>{0.378205895f, 0.389282793f},
-std::array<float,2>{0.601918697f, 0.517640471f},
-std::array<float,2>{0.837144673f, 0.47859624f},
-std::array<float,2>{0.0348458439f, 0.602738023f},
-std::array<float,2>{0.255179733f, 0.0507059954f},
-std::array<float,2>{0.707217872f, 0.94646132f},
-std::array<float,2>{0.51382184f, 0.143891498f},
-std::array<float,2>{0.487624317f, 0.761755407f},
-std::array<float,2>{0.20417437f, 0.280941933f},
-std::array<float,2>{0.928467572f, 0.680885673f},
-std::array<float,2>{0.584135473f, 0.416125953f},
-std::array<float,2>{0.417270392f, 0.544419885f},
-std::array<float,2>{0.143093824f, 0.0730397627f},
-std::array<float,2>{0.963736176f, 0.901328206f},
-std::array<float,2>{0.753086984f, 0.224600449f},
-std::array<float,2>{0.119957805f, 0.852204919f},
-std::array<float,2>{0.368568093f, 0.371118814f},
-std::array<float,2>{0.642022729f, 0.74303478f},
-std::array<float,2>{0.88900882f, 0.296000034f},
-std::array<float,2>{0.227038011f, 0.649271131f},
-std::array<float,2>{0.453250855f, 0.169884175f},
-std::array<float,2>{0.556845427f, 0.798200488f},
-std::array<float,2>{0.749693871f, 0.0139468303f},
-std::array<float,2>{0.296105921f, 0.984353185f},
-std::array<float,2>{0.0106117772f, 0.438279599f},
-std::array<float,2>{0.872359455f, 0.581328392f},
-std::array<float,2>{0.654636741f, 0.379519969f},
-std::array<float,2>{0.364359677f, 0.530410886f},
-std::array<float,2>{0.11078117f, 0.0956218615f},
-std::array<float,2>{0.763629496f, 0.908329487f},
-std::array<float,2>{0.959435105f, 0.20925355f},
-std::array<float,2>{0.153359503f, 0.823435068f},
-std::array<float,2>{0.408376843f, 0.322976321f},
-std::array<float,2>{0.586645901f, 0.694118977f},
-std::array<float,2>{0.862051904f, 0.272304058f},
-std::array<float,2>{0.00473624514f, 0.679059803f},
-std::array<float,2>{0.284280568f, 0.152088106f},
-std::array<float,2>{0.737282753f, 0.752126455f},
-std::array<float,2>{0.552554011f, 0.0591218434f},
-std::array<float,2>{0.46495536f, 0.938349545f},
-std::array<float,2>{0.221738175f, 0.469037414f},
-std::array<float,2>{0.879160404f, 0.598399699f},
-std::array<float,2>{0.599510193f, 0.365769953f},
-std::array<float,2>{0.388733506f, 0.73579818f},
-std::array<float,2>{0.180860817f, 0.229619041f},
-std::array<float,2>{0.991558671f, 0.849276066f},
-std::array<float,2>{0.812057078f, 0.0695839897f},
-std::array<float,2>{0.0656389445f, 0.896160424f},
-std::array<float,2>{0.313784659f, 0.410844117f},
-std::array<float,2>{0.664907992f, 0.535343766f},
-std::array<float,2>{0.929858744f, 0.446659029f},
-std::array<float,2>{0.218589619f, 0.593418539f},
-std::array<float,2>{0.494015127f, 0.000763625139f},
-std::array<float,2>{0.50313288f, 0.976058662f},
-std::array<float,2>{0.715045333f, 0.162998155f},
-std::array<float,2>{0.265342176f, 0.810987055f},
-std::array<float,2>{0.0452063084f, 0.282461643f},
-std::array<float,2>{0.831032634f, 0.645966649f},
-std::array<float,2>{0.730349481f, 0.3073349f},
-std::array<float,2>{0.305827409f, 0.626909792f},
-std::array<float,2>{0.0284042414f, 0.184682176f},
-std::array<float,2>{0.852614641f, 0.78195852f},
-std::array<float,2>{0.900023818f, 0.0186887607f},
-std::array<float,2>{0.245769769f, 0.991176069f},
-std::array<float,2>{0.446065187f, 0.461591959f},
-std::array<float,2>{0.534386575f, 0.56823045f},
-std::array<float,2>{0.775211036f, 0.42762664f},
-std::array<float,2>{0.101239584f, 0.562041461f},
-std::array<float,2>{0.355735332f, 0.0799112767f},
-std::array<float,2>{0.629250586f, 0.875125766f},
-std::array<float,2>{0.564456165f, 0.240662888f},
-std::array<float,2>{0.435056895f, 0.872737825f},
-std::array<float,2>{0.137843028f, 0.351526737f},
-std::array<float,2>{0.943609297f, 0.72473675f},
-std::array<float,2>{0.516362727f, 0.494442523f},
-std::array<float,2>{0.477617413f, 0.610868633f},
-std::array<float,2>{0.192705169f, 0.0368273668f},
-std::array<float,2>{0.914822221f, 0.964157999f},
-std::array<float,2>{0.817221761f, 0.140409946f},
-std::array<float,2>{0.0499644093f, 0.781056941f},
-std::array<float,2>{0.274178267f, 0.26422435f},
-std::array<float,2>{0.687763453f, 0.660898209f},
-std::array<float,2>{0.970354021f, 0.33492285f},
-std::array<float,2>{0.158854738f, 0.710393369f},
-std::array<float,2>{0.40105477f, 0.198280036f},
-std::array<float,2>{0.611886024f, 0.828332424f},
-std::array<float,2>{0.673541009f, 0.121453337f},
-std::array<float,2>{0.337860972f, 0.926447272f},
-std::array<float,2>{0.0831155777f, 0.40467453f},
-std::array<float,2>{0.795333683f, 0.510517836f},
-std::array<float,2>{0.68733263f, 0.475308836f},
-std::array<float,2>{0.331709057f, 0.597319424f},
-std::array<float,2>{0.0926010534f, 0.0550836623f},
-std::array<float,2>{0.786619306f, 0.941840589f},
-std::array<float,2>{0.979212105f, 0.152857259f},
-std::array<float,2>{0.16811946f, 0.754338682f},
-std::array<float,2>{0.391175091f, 0.267031401f},
-std::array<float,2>{0.622726321f, 0.675144374f},
-std::array<float,2>{0.821332812f, 0.324894637f},
-std::array<float,2>{0.0570086017f, 0.690920889f},
-std::array<float,2>{0.270592123f, 0.204627112f},
-std::array<float,2>{0.696205914f, 0.825481892f},
-std::array<float,2>{0.527280033f, 0.0977582112f},
-std::array<float,2>{0.476312071f, 0.911937654f},
-std::array<float,2>{0.19809477f, 0.378120393f},
-std::array<float,2>{0.909701288f, 0.526540279f},
-std::array<float,2>{0.572524965f, 0.288275331f},
-std::array<float,2>{0.422878295f, 0.642055452f},
-std::array<float,2>{0.126155362f, 0.159736454f},
-std::array<float,2>{0.947241902f, 0.805097461f},
-std::array<float,2>{0.766008198f, 0.00525499508f},
-std::array<float,2>{0.106453739f, 0.972461104f},
-std::array<float,2>{0.347358197f, 0.451043427f},
-std::array<float,2>{0.637116969f, 0.588087618f},
-std::array<float,2>{0.894009471f, 0.406506777f},
-std::array<float,2>{0.241392776f, 0.53167814f},
-std::array<float,2>{0.445120841f, 0.0629949942f},
-std::array<float,2>{0.544586599f, 0.89112395f},
-std::array<float,2>{0.725094974f, 0.231172085f},
-std::array<float,2>{0.297708958f, 0.84652102f},
-std::array<float,2>{0.0160547402f, 0.362273753f},
-std::array<float,2>{0.84916079f, 0.739853382f},
-std::array<float,2>{0.706231833f, 0.346979529f},
-std::array<float,2>{0.252900302f, 0.72162205f},
-std::array<float,2>{0.038997639f, 0.235042036f},
-std::array<float,2>{0.843584955f, 0.868413389f},
-std::array<float,2>{0.924801946f, 0.0855449289f},
-std::array<float,2>{0.210482061f, 0.880137384f},
-std::array<float,2>{0.490388274f, 0.422229171f},
-std::array<float,2>{0.509328604f, 0.555750549f},
-std::array<float,2>{0.797966063f, 0.467527151f},
-std::array<float,2>{0.0715388507f, 0.562979698f},
-std::array<float,2>{0.322093278f, 0.021300178f},
-std::array<float,2>{0.658723891f, 0.986600995f},
-std::array<float,2>{0.606689036f, 0.182799876f},
-std::array<float,2>{0.379105777f, 0.786711872f},
-std::array<float,2>{0.176554665f, 0.310092688f},
-std::array<float,2>{0.998861253f, 0.632745802f},
-std::array<float,2>{0.561272025f, 0.400369167f},
-std::array<float,2>{0.458165169f, 0.51265341f},
-std::array<float,2>{0.233791709f, 0.118330911f},
-std::array<float,2>{0.885668457f, 0.922082841f},
-std::array<float,2>{0.868336678f, 0.199278846f},
-std::array<float,2>{0.0144769428f, 0.834900081f},
-std::array<float,2>{0.290660143f, 0.331573963f},
-std::array<float,2>{0.745784283f, 0.705275059f},
-std::array<float,2>{0.968337893f, 0.258072734f},
-std::array<float,2>{0.147490337f, 0.660021961f},
-std::array<float,2>{0.420126915f, 0.135658473f},
-std::array<float,2>{0.5806669f, 0.776128888f},
-std::array<float,2>{0.645301878f, 0.0317439847f},
-std::array<float,2>{0.372319609f, 0.967342675f},
-std::array<float,2>{0.124465801f, 0.499740571f},
-std::array<float,2>{0.756070733f, 0.615004182f},
-std::array<float,2>{0.740839422f, 0.434869438f},
-std::array<float,2>{0.286309034f, 0.549793303f},
-std::array<float,2>{0.00363118527f, 0.0884305984f},
-std::array<float,2>{0.864327908f, 0.886915207f},
-std::array<float,2>{0.877590477f, 0.245525569f},
-std::array<float,2>{0.224421814f, 0.859453201f},
-std::array<float,2>{0.461083412f, 0.358702421f},
-std::array<float,2>{0.550353169f, 0.730366647f},
-std::array<float,2>{0.757862985f, 0.300583601f},
-std::array<float,2>{0.113791808f, 0.633551955f},
-std::array<float,2>{0.3632375f, 0.17364794f},
-std::array<float,2>{0.651316524f, 0.796488523f},
-std::array<float,2>{0.590392411f, 0.0244433507f},
-std::array<float,2>{0.411812603f, 0.999355197f},
-std::array<float,2>{0.150214449f, 0.453784525f},
-std::array<float,2>{0.955725491f, 0.572785914f},
-std::array<float,2>{0.505084336f, 0.339470655f},
-std::array<float,2>{0.496812314f, 0.718735635f},
-std::array<float,2>{0.213777333f, 0.190548316f},
-std::array<float,2>{0.935792446f, 0.83709991f},
-std::array<float,2>{0.834065855f, 0.111309953f},
-std::array<float,2>{0.0403282605f, 0.931876004f},
-std::array<float,2>{0.260409117f, 0.395186752f},
-std::array<float,2>{0.712467074f, 0.50742346f},
-std::array<float,2>{0.986963868f, 0.486379772f},
-std::array<float,2>{0.186481297f, 0.621605396f},
-std::array<float,2>{0.385737956f, 0.0423829108f},
-std::array<float,2>{0.595477998f, 0.955293834f},
-std::array<float,2>{0.669097006f, 0.126315698f},
-std::array<float,2>{0.317299545f, 0.767486453f},
-std::array<float,2>{0.0685883313f, 0.257690072f},
-std::array<float,2>{0.80820924f, 0.667628825f},
-std::array<float,2>{0.626315355f, 0.27633813f},
-std::array<float,2>{0.355105102f, 0.685610235f},
-std::array<float,2>{0.0975594744f, 0.144987032f},
-std::array<float,2>{0.778910518f, 0.758812428f},
-std::array<float,2>{0.938842833f, 0.0543905422f},
-std::array<float,2>{0.133218944f, 0.950501502f},
-std::array<float,2>{0.430929631f, 0.482870698f},
-std::array<float,2>{0.566636384f, 0.608817041f},
-std::array<float,2>{0.858160496f, 0.385787785f},
-std::array<float,2>{0.0237317234f, 0.523366272f},
-std::array<float,2>{0.311508626f, 0.10495811f},
-std::array<float,2>{0.732135773f, 0.915808082f},
-std::array<float,2>{0.535228729f, 0.218644127f},
-std::array<float,2>{0.452253431f, 0.816012383f},
-std::array<float,2>{0.247658953f, 0.314540774f},
-std::array<float,2>{0.905045927f, 0.700484872f},
-std::array<float,2>{0.614349961f, 0.444750935f},
-std::array<float,2>{0.405563176f, 0.583581567f},
-std::array<float,2>{0.163292602f, 0.00805178657f},
-std::array<float,2>{0.974387169f, 0.980078638f},
-std::array<float,2>{0.791787922f, 0.166604578f},
-std::array<float,2>{0.0811576992f, 0.801471591f},
-std::array<float,2>{0.341405034f, 0.292524427f},
-std::array<float,2>{0.675871789f, 0.655587196f},
-std::array<float,2>{0.921614051f, 0.368400544f},
-std::array<float,2>{0.190588295f, 0.749606133f},
-std::array<float,2>{0.482484877f, 0.219234452f},
-std::array<float,2>{0.523011088f, 0.858121395f},
-std::array<float,2>{0.691879869f, 0.0773750246f},
-std::array<float,2>{0.279295295f, 0.903610826f},
-std::array<float,2>{0.0532902591f, 0.42040512f},
-std::array<float,2>{0.815622151f, 0.540373862f},
-std::array<float,2>{0.68837887f, 0.492232889f},
-std::array<float,2>{0.273903638f, 0.612676501f},
-std::array<float,2>{0.0504780076f, 0.0379384272f},
-std::array<float,2>{0.81668359f, 0.96117574f},
-std::array<float,2>{0.914333344f, 0.137683302f},
-std::array<float,2>{0.193118721f, 0.778293908f},
-std::array<float,2>{0.478400439f, 0.262722164f},
-std::array<float,2>{0.515829325f, 0.662441254f},
-std::array<float,2>{0.79564321f, 0.333568752f},
-std::array<float,2>{0.0836074203f, 0.708782494f},
-std::array<float,2>{0.337076664f, 0.196176142f},
-std::array<float,2>{0.673326194f, 0.831261575f},
-std::array<float,2>{0.611366212f, 0.124568418f},
-std::array<float,2>{0.400540233f, 0.928616524f},
-std::array<float,2>{0.15847297f, 0.404029936f},
-std::array<float,2>{0.969997287f, 0.508050382f},
-std::array<float,2>{0.535000265f, 0.30598855f},
-std::array<float,2>{0.445555925f, 0.627625585f},
-std::array<float,2>{0.245484844f, 0.187069237f},
-std::array<float,2>{0.899440527f, 0.784183085f},
-std::array<float,2>{0.853037179f, 0.017403435f},
-std::array<float,2>{0.0292621888f, 0.988855422f},
-std::array<float,2>{0.306340426f, 0.463432521f},
-std::array<float,2>{0.72964555f, 0.56982547f},
-std::array<float,2>{0.943991661f, 0.429240972f},
-std::array<float,2>{0.138354018f, 0.560126424f},
-std::array<float,2>{0.435119808f, 0.0811999068f},
-std::array<float,2>{0.565404177f, 0.877426684f},
-std::array<float,2>{0.629497111f, 0.239865005f},
-std::array<float,2>{0.356372654f, 0.873118281f},
-std::array<float,2>{0.100771673f, 0.348794699f},
-std::array<float,2>{0.774614632f, 0.724229395f},
-std::array<float,2>{0.664270461f, 0.363853693f},
-std::array<float,2>{0.314071745f, 0.736402869f},
-std::array<float,2>{0.0661742091f, 0.228080109f},
-std::array<float,2>{0.811568141f, 0.849714279f},
-std::array<float,2>{0.99212122f, 0.0681859925f},
-std::array<float,2>{0.181239858f, 0.897763073f},
-std::array<float,2>{0.389300883f, 0.412555844f},
-std::array<float,2>{0.599040151f, 0.53805995f},
-std::array<float,2>{0.830218434f, 0.449134201f},
-std::array<float,2>{0.0454369001f, 0.589893401f},
-std::array<float,2>{0.264933497f, 0.00327153923f},
-std::array<float,2>{0.715337455f, 0.972951353f},
-std::array<float,2>{0.503464758f, 0.161045f},
-std::array<float,2>{0.493487567f, 0.809544444f},
-std::array<float,2>{0.217954144f, 0.283592105f},
-std::array<float,2>{0.93057245f, 0.646608055f},
-std::array<float,2>{0.586369634f, 0.381177813f},
-std::array<float,2>{0.409001499f, 0.52821368f},
-std::array<float,2>{0.154072762f, 0.0959072039f},
-std::array<float,2>{0.959560275f, 0.908030033f},
-std::array<float,2>{0.763157725f, 0.20722191f},
-std::array<float,2>{0.111217678f, 0.820700884f},
-std::array<float,2>{0.364817977f, 0.320960075f},
-std::array<float,2>{0.655154586f, 0.692835689f},
-std::array<float,2>{0.879658878f, 0.27095744f},
-std::array<float,2>{0.222572088f, 0.67773056f},
-std::array<float,2>{0.465637743f, 0.149015844f},
-std::array<float,2>{0.55210501f, 0.75184077f},
-std::array<float,2>{0.736532748f, 0.0619711056f},
-std::array<float,2>{0.284747183f, 0.941048443f},
-std::array<float,2>{0.00427662814f, 0.471188188f},
-std::array<float,2>{0.861482561f, 0.600649774f},
-std::array<float,2>{0.642469108f, 0.41590634f},
-std::array<float,2>{0.368712246f, 0.546819627f},
-std::array<float,2>{0.119476005f, 0.0719382167f},
-std::array<float,2>{0.753569245f, 0.899739861f},
-std::array<float,2>{0.963308573f, 0.226505429f},
-std::array<float,2>{0.14268896f, 0.854131579f},
-std::array<float,2>{0.417896479f, 0.373075455f},
-std::array<float,2>{0.584550679f, 0.744826913f},
-std::array<float,2>{0.872704268f, 0.29364574f},
-std::array<float,2>{0.0098984465f, 0.651943326f},
-std::array<float,2>{0.296643555f, 0.171272352f},
-std::array<float,2>{0.749421299f, 0.800251365f},
-std::array<float,2>{0.557572842f, 0.0126268864f},
-std::array<float,2>{0.454040378f, 0.980888605f},
-std::array<float,2>{0.227059051f, 0.441059262f},
-std::array<float,2>{0.889532149f, 0.579770446f},
-std::array<float,2>{0.602525532f, 0.318054557f},
-std::array<float,2>{0.378753364f, 0.695594609f},
-std::array<float,2>{0.17310816f, 0.212012827f},
-std::array<float,2>{0.994880021f, 0.817905724f},
-std::array<float,2>{0.802131891f, 0.105593011f},
-std::array<float,2>{0.0776539743f, 0.920062542f},
-std::array<float,2>{0.324302077f, 0.387991786f},
-std::array<float,2>{0.663552344f, 0.515764832f},
-std::array<float,2>{0.927951515f, 0.476916492f},
-std::array<float,2>{0.20475775f, 0.604118824f},
-std::array<float,2>{0.488099635f, 0.0486128442f},
-std::array<float,2>{0.51435864f, 0.947639823f},
-std::array<float,2>{0.707556546f, 0.141065761f},
-std::array<float,2>{0.255786419f, 0.765353382f},
-std::array<float,2>{0.0343024321f, 0.278504103f},
-std::array<float,2>{0.83744669f, 0.681884587f},
-std::array<float,2>{0.722384632f, 0.251044214f},
-std::array<float,2>{0.303790122f, 0.670157671f},
-std::array<float,2>{0.022312006f, 0.129842743f},
-std::array<float,2>{0.847105265f, 0.769607365f},
-std::array<float,2>{0.897815764f, 0.0450057201f},
-std::array<float,2>{0.23664853f, 0.959494531f},
-std::array<float,2>{0.439631045f, 0.488975376f},
-std::array<float,2>{0.539575338f, 0.620871127f},
-std::array<float,2>{0.770514369f, 0.393346071f},
-std::array<float,2>{0.101977244f, 0.503035128f},
-std::array<float,2>{0.348512024f, 0.117034227f},
-std::array<float,2>{0.633444667f, 0.93456167f},
-std::array<float,2>{0.577742279f, 0.192026973f},
-std::array<float,2>{0.426044017f, 0.842974663f},
-std::array<float,2>{0.132371992f, 0.339927047f},
-std::array<float,2>{0.950712144f, 0.713331044f},
-std::array<float,2>{0.527379453f, 0.460831821f},
-std::array<float,2>{0.471572071f, 0.577406824f},
-std::array<float,2>{0.201093674f, 0.0299563613f},
-std::array<float,2>{0.914008498f, 0.993949652f},
-std::array<float,2>{0.824729443f, 0.179018036f},
-std::array<float,2>{0.0622304529f, 0.789572895f},
-std::array<float,2>{0.268416435f, 0.304237098f},
-std::array<float,2>{0.699842632f, 0.638456523f},
-std::array<float,2>{0.980567813f, 0.35182789f},
-std::array<float,2>{0.166028127f, 0.734013319f},
-std::array<float,2>{0.394874722f, 0.247539535f},
-std::array<float,2>{0.618421197f, 0.865333736f},
-std::array<float,2>{0.681665361f, 0.0921735615f},
-std::array<float,2>{0.335870415f, 0.883103251f},
-std::array<float,2>{0.0890987515f, 0.431298465f},
-std::array<float,2>{0.782017648f, 0.551994026f},
-std::array<float,2>{0.676582575f, 0.441876322f},
-std::array<float,2>{0.341297776f, 0.585872769f},
-std::array<float,2>{0.0819432586f, 0.00983986538f},
-std::array<float,2>{0.791136563f, 0.977428615f},
-std::array<float,2>{0.974003196f, 0.164326489f},
-std::array<float,2>{0.163776666f, 0.803250074f},
-std::array<float,2>{0.406188458f, 0.289096475f},
-std::array<float,2>{0.614918232f, 0.654261112f},
-std::array<float,2>{0.816194057f, 0.369968742f},
-std::array<float,2>{0.0530330688f, 0.747033656f},
-std::array<float,2>{0.278431654f, 0.221007437f},
-std::array<float,2>{0.692020714f, 0.855805755f},
-std::array<float,2>{0.522850752f, 0.0754724517f},
-std::array<float,2>{0.482936293f, 0.904617012f},
-std::array<float,2>{0.191120714f, 0.418770432f},
-std::array<float,2>{0.921368182f, 0.54290688f},
-std::array<float,2>{0.567310691f, 0.274892956f},
-std::array<float,2>{0.431510746f, 0.684672654f},
-std::array<float,2>{0.133307561f, 0.1472653f},
-std::array<float,2>{0.939200222f, 0.760658801f},
-std::array<float,2>{0.778383911f, 0.0523300432f},
-std::array<float,2>{0.0967487022f, 0.95233345f},
-std::array<float,2>{0.354725093f, 0.481171727f},
-std::array<float,2>{0.626769364f, 0.605761349f},
-std::array<float,2>{0.904644251f, 0.383440435f},
-std::array<float,2>{0.24708651f, 0.520355403f},
-std::array<float,2>{0.452730328f, 0.102578633f},
-std::array<float,2>{0.53610152f, 0.916094065f},
-std::array<float,2>{0.731870651f, 0.215593785f},
-std::array<float,2>{0.310833901f, 0.814023495f},
-std::array<float,2>{0.0242527425f, 0.31412679f},
-std::array<float,2>{0.857844174f, 0.702961326f},
-std::array<float,2>{0.712233067f, 0.33690533f},
-std::array<float,2>{0.259821177f, 0.716446459f},
-std::array<float,2>{0.0407044701f, 0.189196214f},
-std::array<float,2>{0.834571958f, 0.838074148f},
-std::array<float,2>{0.936055481f, 0.112280436f},
-std::array<float,2>{0.213250652f, 0.930636823f},
-std::array<float,2>{0.496317804f, 0.396519423f},
-std::array<float,2>{0.505751848f, 0.504565656f},
-std::array<float,2>{0.807682276f, 0.485322982f},
-std::array<float,2>{0.0691181347f, 0.624921262f},
-std::array<float,2>{0.316654027f, 0.0393897481f},
-std::array<float,2>{0.669664025f, 0.954909146f},
-std::array<float,2>{0.595010757f, 0.12857914f},
-std::array<float,2>{0.385184079f, 0.769243538f},
-std::array<float,2>{0.186031073f, 0.255083144f},
-std::array<float,2>{0.986747921f, 0.665988386f},
-std::array<float,2>{0.550203979f, 0.435631305f},
-std::array<float,2>{0.461508781f, 0.548754275f},
-std::array<float,2>{0.22391966f, 0.0875115097f},
-std::array<float,2>{0.877219558f, 0.889021516f},
-std::array<float,2>{0.864764273f, 0.243777886f},
-std::array<float,2>{0.00297630951f, 0.861717343f},
-std::array<float,2>{0.286738038f, 0.355493605f},
-std::array<float,2>{0.74070859f, 0.728368878f},
-std::array<float,2>{0.955241084f, 0.298225969f},
-std::array<float,2>{0.149516776f, 0.636615396f},
-std::array<float,2>{0.4113141f, 0.174102202f},
-std::array<float,2>{0.589887261f, 0.792988658f},
-std::array<float,2>{0.650726438f, 0.026978258f},
-std::array<float,2>{0.362381995f, 0.996338427f},
-std::array<float,2>{0.113482729f, 0.456287891f},
-std::array<float,2>{0.75871563f, 0.570673287f},
-std::array<float,2>{0.745440423f, 0.400547922f},
-std::array<float,2>{0.290221035f, 0.514307976f},
-std::array<float,2>{0.013814521f, 0.120964475f},
-std::array<float,2>{0.868809283f, 0.924765825f},
-std::array<float,2>{0.885209501f, 0.202417746f},
-std::array<float,2>{0.233944058f, 0.833709478f},
-std::array<float,2>{0.458525926f, 0.329542249f},
-std::array<float,2>{0.56075567f, 0.703160644f},
-std::array<float,2>{0.75662142f, 0.260763824f},
-std::array<float,2>{0.124635935f, 0.657180727f},
-std::array<float,2>{0.37288481f, 0.133667395f},
-std::array<float,2>{0.64498651f, 0.773979545f},
-std::array<float,2>{0.580343723f, 0.0336764567f},
-std::array<float,2>{0.42056784f, 0.965085387f},
-std::array<float,2>{0.148286909f, 0.497642756f},
-std::array<float,2>{0.968169153f, 0.616018534f},
-std::array<float,2>{0.509053767f, 0.344276994f},
-std::array<float,2>{0.490730107f, 0.719788909f},
-std::array<float,2>{0.209966004f, 0.236920446f},
-std::array<float,2>{0.924092233f, 0.870029688f},
-std::array<float,2>{0.843027592f, 0.0839157104f},
-std::array<float,2>{0.038129922f, 0.882756054f},
-std::array<float,2>{0.252197981f, 0.425147355f},
-std::array<float,2>{0.706857204f, 0.557659328f},
-std::array<float,2>{0.998229086f, 0.465239167f},
-std::array<float,2>{0.175960317f, 0.56569612f},
-std::array<float,2>{0.379850894f, 0.0218916945f},
-std::array<float,2>{0.60736841f, 0.986211658f},
-std::array<float,2>{0.658351958f, 0.181246325f},
-std::array<float,2>{0.321541339f, 0.788998246f},
-std::array<float,2>{0.0722222999f, 0.311101288f},
-std::array<float,2>{0.79838109f, 0.630405724f},
-std::array<float,2>{0.637302876f, 0.285399497f},
-std::array<float,2>{0.346930921f, 0.644523501f},
-std::array<float,2>{0.107096568f, 0.156681389f},
-std::array<float,2>{0.76616925f, 0.808264017f},
-std::array<float,2>{0.946628451f, 0.00724645657f},
-std::array<float,2>{0.126622245f, 0.96979183f},
-std::array<float,2>{0.423563749f, 0.452521265f},
-std::array<float,2>{0.57316047f, 0.586321771f},
-std::array<float,2>{0.848978996f, 0.409099698f},
-std::array<float,2>{0.0162895732f, 0.535124779f},
-std::array<float,2>{0.297310382f, 0.0657472908f},
-std::array<float,2>{0.72524935f, 0.893642843f},
-std::array<float,2>{0.544406652f, 0.232804507f},
-std::array<float,2>{0.444407582f, 0.84509635f},
-std::array<float,2>{0.241743609f, 0.361204505f},
-std::array<float,2>{0.894095838f, 0.741028666f},
-std::array<float,2>{0.622143924f, 0.473479271f},
-std::array<float,2>{0.390936852f, 0.595013678f},
-std::array<float,2>{0.168914855f, 0.0569741689f},
-std::array<float,2>{0.97855401f, 0.945266962f},
-std::array<float,2>{0.787036896f, 0.154820502f},
-std::array<float,2>{0.0919029713f, 0.757495105f},
-std::array<float,2>{0.331355244f, 0.267908186f},
-std::array<float,2>{0.686796129f, 0.672964931f},
-std::array<float,2>{0.909596026f, 0.327090234f},
-std::array<float,2>{0.197642788f, 0.688005984f},
-std::array<float,2>{0.476049304f, 0.205412909f},
-std::array<float,2>{0.526615441f, 0.826943755f},
-std::array<float,2>{0.695783377f, 0.101001769f},
-std::array<float,2>{0.271353573f, 0.91277498f},
-std::array<float,2>{0.0573514253f, 0.375524849f},
-std::array<float,2>{0.821779072f, 0.524121225f},
-std::array<float,2>{0.727300286f, 0.460995913f},
-std::array<float,2>{0.308060765f, 0.567667842f},
-std::array<float,2>{0.0312018413f, 0.0193074513f},
-std::array<float,2>{0.854939222f, 0.990287423f},
-std::array<float,2>{0.900973618f, 0.185484365f},
-std::array<float,2>{0.243650675f, 0.781637371f},
-std::array<float,2>{0.448422968f, 0.307060093f},
-std::array<float,2>{0.532256186f, 0.626384735f},
-std::array<float,2>{0.776184142f, 0.35088554f},
-std::array<float,2>{0.0982513949f, 0.725542963f},
-std::array<float,2>{0.358065695f, 0.240732223f},
-std::array<float,2>{0.630924344f, 0.872180045f},
-std::array<float,2>{0.563896716f, 0.0791792274f},
-std::array<float,2>{0.435752183f, 0.875835538f},
-std::array<float,2>{0.139729455f, 0.426836103f},
-std::array<float,2>{0.941702127f, 0.561986148f},
-std::array<float,2>{0.519506335f, 0.263950765f},
-std::array<float,2>{0.479828924f, 0.660333633f},
-std::array<float,2>{0.195283309f, 0.139932051f},
-std::array<float,2>{0.917096257f, 0.780452609f},
-std::array<float,2>{0.818506181f, 0.036321111f},
-std::array<float,2>{0.0484794565f, 0.96444422f},
-std::array<float,2>{0.276320428f, 0.494998157f},
-std::array<float,2>{0.691132545f, 0.610498309f},
-std::array<float,2>{0.972310364f, 0.40518707f},
-std::array<float,2>{0.157528132f, 0.509956598f},
-std::array<float,2>{0.399803191f, 0.121728018f},
-std::array<float,2>{0.610396862f, 0.926129699f},
-std::array<float,2>{0.675594389f, 0.199169144f},
-std::array<float,2>{0.338091671f, 0.828883767f},
-std::array<float,2>{0.0852254778f, 0.334196627f},
-std::array<float,2>{0.793615997f, 0.710921049f},
-std::array<float,2>{0.653637052f, 0.322616965f},
-std::array<float,2>{0.365802169f, 0.693576753f},
-std::array<float,2>{0.113016367f, 0.209905371f},
-std::array<float,2>{0.764337957f, 0.8238433f},
-std::array<float,2>{0.957792401f, 0.0949461386f},
-std::array<float,2>{0.154431581f, 0.909079909f},
-std::array<float,2>{0.407104135f, 0.379089832f},
-std::array<float,2>{0.589260519f, 0.530875027f},
-std::array<float,2>{0.859933674f, 0.469470948f},
-std::array<float,2>{0.00644428097f, 0.59802717f},
-std::array<float,2>{0.28262192f, 0.0590312257f},
-std::array<float,2>{0.735414982f, 0.937774241f},
-std::array<float,2>{0.554350257f, 0.151546329f},
-std::array<float,2>{0.467318475f, 0.752524495f},
-std::array<float,2>{0.218999773f, 0.271733552f},
-std::array<float,2>{0.881992936f, 0.679496944f},
-std::array<float,2>{0.600330353f, 0.410489917f},
-std::array<float,2>{0.388580501f, 0.535978973f},
-std::array<float,2>{0.181873813f, 0.070053421f},
-std::array<float,2>{0.988734603f, 0.895779967f},
-std::array<float,2>{0.808888733f, 0.229983732f},
-std::array<float,2>{0.0641910285f, 0.849042594f},
-std::array<float,2>{0.314612329f, 0.365573734f},
-std::array<float,2>{0.666380703f, 0.736176252f},
-std::array<float,2>{0.931839943f, 0.282733321f},
-std::array<float,2>{0.215757683f, 0.646335781f},
-std::array<float,2>{0.494474351f, 0.162427053f},
-std::array<float,2>{0.501319587f, 0.811357021f},
-std::array<float,2>{0.717517912f, 0.000400322082f},
-std::array<float,2>{0.263222605f, 0.976103961f},
-std::array<float,2>{0.0431180745f, 0.447247952f},
-std::array<float,2>{0.829392135f, 0.593045831f},
-std::array<float,2>{0.660784781f, 0.38893503f},
-std::array<float,2>{0.327021241f, 0.518495381f},
-std::array<float,2>{0.0743187815f, 0.108273178f},
-std::array<float,2>{0.804530263f, 0.91836828f},
-std::array<float,2>{0.992422342f, 0.213956594f},
-std::array<float,2>{0.174220473f, 0.820097506f},
-std::array<float,2>{0.376672745f, 0.319072306f},
-std::array<float,2>{0.604305327f, 0.697562695f},
-std::array<float,2>{0.83847481f, 0.280535847f},
-std::array<float,2>{0.0318293199f, 0.681289256f},
-std::array<float,2>{0.257392019f, 0.144236997f},
-std::array<float,2>{0.71004039f, 0.762691438f},
-std::array<float,2>{0.511863053f, 0.050055135f},
-std::array<float,2>{0.486205727f, 0.947230637f},
-std::array<float,2>{0.20538801f, 0.479095072f},
-std::array<float,2>{0.926322043f, 0.603282988f},
-std::array<float,2>{0.583097696f, 0.37170592f},
-std::array<float,2>{0.415612936f, 0.742271006f},
-std::array<float,2>{0.141058251f, 0.224005893f},
-std::array<float,2>{0.962094486f, 0.85185945f},
-std::array<float,2>{0.751266897f, 0.0723024756f},
-std::array<float,2>{0.118721873f, 0.900560558f},
-std::array<float,2>{0.37014246f, 0.416530758f},
-std::array<float,2>{0.644185305f, 0.544467866f},
-std::array<float,2>{0.88769722f, 0.43757239f},
-std::array<float,2>{0.230446279f, 0.581910789f},
-std::array<float,2>{0.455866039f, 0.0144479079f},
-std::array<float,2>{0.555994153f, 0.983472288f},
-std::array<float,2>{0.746827304f, 0.169139609f},
-std::array<float,2>{0.29488188f, 0.798583806f},
-std::array<float,2>{0.0091998484f, 0.296612203f},
-std::array<float,2>{0.874122441f, 0.648906052f},
-std::array<float,2>{0.701325476f, 0.301496655f},
-std::array<float,2>{0.266151041f, 0.639317632f},
-std::array<float,2>{0.0601687655f, 0.17715387f},
-std::array<float,2>{0.827084661f, 0.791850865f},
-std::array<float,2>{0.911860526f, 0.0292826556f},
-std::array<float,2>{0.203033537f, 0.994206548f},
-std::array<float,2>{0.470370948f, 0.458608747f},
-std::array<float,2>{0.530694306f, 0.57521081f},
-std::array<float,2>{0.783756435f, 0.432130754f},
-std::array<float,2>{0.0871613175f, 0.553781152f},
-std::array<float,2>{0.333979398f, 0.0916965604f},
-std::array<float,2>{0.680482447f, 0.885325074f},
-std::array<float,2>{0.620689571f, 0.249693796f},
-std::array<float,2>{0.397379249f, 0.864161432f},
-std::array<float,2>{0.164126173f, 0.354911536f},
-std::array<float,2>{0.982554197f, 0.731669545f},
-std::array<float,2>{0.542499602f, 0.491832286f},
-std::array<float,2>{0.437567204f, 0.618447542f},
-std::array<float,2>{0.236253977f, 0.0441746339f},
-std::array<float,2>{0.894675434f, 0.958625257f},
-std::array<float,2>{0.844988942f, 0.132439896f},
-std::array<float,2>{0.0203784667f, 0.773329675f},
-std::array<float,2>{0.301288307f, 0.252699345f},
-std::array<float,2>{0.720165491f, 0.669569075f},
-std::array<float,2>{0.952924669f, 0.342196524f},
-std::array<float,2>{0.130548105f, 0.711903095f},
-std::array<float,2>{0.429451197f, 0.193649352f},
-std::array<float,2>{0.574559033f, 0.84150821f},
-std::array<float,2>{0.635146081f, 0.113900818f},
-std::array<float,2>{0.350404114f, 0.935909212f},
-std::array<float,2>{0.103976481f, 0.392207205f},
-std::array<float,2>{0.772983968f, 0.500165105f},
-std::array<float,2>{0.627494037f, 0.483087629f},
-std::array<float,2>{0.352475584f, 0.60916096f},
-std::array<float,2>{0.0946751386f, 0.0540281758f},
-std::array<float,2>{0.780492902f, 0.950939119f},
-std::array<float,2>{0.940243363f, 0.145103499f},
-std::array<float,2>{0.135320902f, 0.759746671f},
-std::array<float,2>{0.432606667f, 0.275839239f},
-std::array<float,2>{0.570239127f, 0.686271966f},
-std::array<float,2>{0.855695486f, 0.315278083f},
-std::array<float,2>{0.0255990531f, 0.700966716f},
-std::array<float,2>{0.309980005f, 0.218051881f},
-std::array<float,2>{0.733165443f, 0.815456748f},
-std::array<float,2>{0.537176132f, 0.10526561f},
-std::array<float,2>{0.449940652f, 0.915369809f},
-std::array<float,2>{0.248704165f, 0.386277825f},
-std::array<float,2>{0.903219104f, 0.52283895f},
-std::array<float,2>{0.617132008f, 0.292452931f},
-std::array<float,2>{0.402423292f, 0.656212032f},
-std::array<float,2>{0.160523281f, 0.166117147f},
-std::array<float,2>{0.974965274f, 0.80120796f},
-std::array<float,2>{0.790338039f, 0.00868694205f},
-std::array<float,2>{0.07870996f, 0.979812264f},
-std::array<float,2>{0.34339866f, 0.444838196f},
-std::array<float,2>{0.677973151f, 0.583121181f},
-std::array<float,2>{0.918805182f, 0.420489937f},
-std::array<float,2>{0.188302591f, 0.540647209f},
-std::array<float,2>{0.481626093f, 0.0780716091f},
-std::array<float,2>{0.52105844f, 0.903962493f},
-std::array<float,2>{0.693807542f, 0.219703376f},
-std::array<float,2>{0.279360443f, 0.857654631f},
-std::array<float,2>{0.0522941239f, 0.368743479f},
-std::array<float,2>{0.813485622f, 0.749489367f},
-std::array<float,2>{0.740003169f, 0.359204918f},
-std::array<float,2>{0.287355453f, 0.729613721f},
-std::array<float,2>{0.000352163217f, 0.245929435f},
-std::array<float,2>{0.865684152f, 0.860139668f},
-std::array<float,2>{0.87549597f, 0.0883299932f},
-std::array<float,2>{0.224863276f, 0.887260556f},
-std::array<float,2>{0.462953955f, 0.43544063f},
-std::array<float,2>{0.548177481f, 0.548882604f},
-std::array<float,2>{0.760229945f, 0.453579366f},
-std::array<float,2>{0.115616985f, 0.572348654f},
-std::array<float,2>{0.360075235f, 0.0252876952f},
-std::array<float,2>{0.648777187f, 0.999763727f},
-std::array<float,2>{0.591975272f, 0.172903672f},
-std::array<float,2>{0.412410468f, 0.796116054f},
-std::array<float,2>{0.152086481f, 0.300216407f},
-std::array<float,2>{0.954108059f, 0.632957339f},
-std::array<float,2>{0.507563353f, 0.394887179f},
-std::array<float,2>{0.499045372f, 0.506890655f},
-std::array<float,2>{0.211582571f, 0.110473692f},
-std::array<float,2>{0.933825254f, 0.932468593f},
-std::array<float,2>{0.833494425f, 0.191127047f},
-std::array<float,2>{0.041567985f, 0.837753475f},
-std::array<float,2>{0.259281456f, 0.338900745f},
-std::array<float,2>{0.71400255f, 0.718234479f},
-std::array<float,2>{0.984648883f, 0.257310122f},
-std::array<float,2>{0.1847893f, 0.667055607f},
-std::array<float,2>{0.383829832f, 0.126516134f},
-std::array<float,2>{0.596577883f, 0.767050803f},
-std::array<float,2>{0.671527863f, 0.0426241979f},
-std::array<float,2>{0.319885582f, 0.955873907f},
-std::array<float,2>{0.0668152645f, 0.486927152f},
-std::array<float,2>{0.806449771f, 0.62111032f},
-std::array<float,2>{0.703895867f, 0.422445655f},
-std::array<float,2>{0.251624197f, 0.556446254f},
-std::array<float,2>{0.0353940129f, 0.0852729231f},
-std::array<float,2>{0.840428472f, 0.880550206f},
-std::array<float,2>{0.92298013f, 0.234576255f},
-std::array<float,2>{0.208405703f, 0.868708968f},
-std::array<float,2>{0.490207762f, 0.347217858f},
-std::array<float,2>{0.51018995f, 0.720802486f},
-std::array<float,2>{0.799771249f, 0.309709609f},
-std::array<float,2>{0.0728741661f, 0.632285118f},
-std::array<float,2>{0.323294908f, 0.183284104f},
-std::array<float,2>{0.656447887f, 0.786344767f},
-std::array<float,2>{0.608242929f, 0.0209518541f},
-std::array<float,2>{0.381793141f, 0.987247109f},
-std::array<float,2>{0.179055005f, 0.467270732f},
-std::array<float,2>{0.997564495f, 0.563474119f},
-std::array<float,2>{0.558881462f, 0.331057668f},
-std::array<float,2>{0.459061652f, 0.706009865f},
-std::array<float,2>{0.230999604f, 0.200170711f},
-std::array<float,2>{0.883993447f, 0.83418715f},
-std::array<float,2>{0.870542705f, 0.119132459f},
-std::array<float,2>{0.0129501512f, 0.9226982f},
-std::array<float,2>{0.292307466f, 0.399841338f},
-std::array<float,2>{0.742929578f, 0.512180805f},
-std::array<float,2>{0.965440392f, 0.499200493f},
-std::array<float,2>{0.146005467f, 0.61470747f},
-std::array<float,2>{0.419772089f, 0.0317001566f},
-std::array<float,2>{0.578300416f, 0.967015505f},
-std::array<float,2>{0.647262931f, 0.134785369f},
-std::array<float,2>{0.37393409f, 0.775508463f},
-std::array<float,2>{0.122535944f, 0.25874266f},
-std::array<float,2>{0.754751861f, 0.659525752f},
-std::array<float,2>{0.685437918f, 0.267298698f},
-std::array<float,2>{0.329199255f, 0.675406635f},
-std::array<float,2>{0.0902891085f, 0.152443066f},
-std::array<float,2>{0.789006174f, 0.754478931f},
-std::array<float,2>{0.977358162f, 0.0552489944f},
-std::array<float,2>{0.171185791f, 0.94194597f},
-std::array<float,2>{0.392743647f, 0.474699974f},
-std::array<float,2>{0.623054802f, 0.596716285f},
-std::array<float,2>{0.824184656f, 0.378786206f},
-std::array<float,2>{0.0551253036f, 0.527044892f},
-std::array<float,2>{0.272133708f, 0.0984188989f},
-std::array<float,2>{0.697587848f, 0.911541224f},
-std::array<float,2>{0.52357167f, 0.20445396f},
-std::array<float,2>{0.473680705f, 0.825950921f},
-std::array<float,2>{0.197176576f, 0.324615806f},
-std::array<float,2>{0.906577289f, 0.690456212f},
-std::array<float,2>{0.57057476f, 0.450431645f},
-std::array<float,2>{0.425762922f, 0.588749766f},
-std::array<float,2>{0.128480241f, 0.00566292834f},
-std::array<float,2>{0.94913888f, 0.971967518f},
-std::array<float,2>{0.768615901f, 0.159349307f},
-std::array<float,2>{0.107448474f, 0.805443227f},
-std::array<float,2>{0.343764961f, 0.288750708f},
-std::array<float,2>{0.639849007f, 0.642232716f},
-std::array<float,2>{0.892019629f, 0.361633122f},
-std::array<float,2>{0.238511339f, 0.739282727f},
-std::array<float,2>{0.443024457f, 0.230858356f},
-std::array<float,2>{0.545090079f, 0.845956028f},
-std::array<float,2>{0.724580348f, 0.062587969f},
-std::array<float,2>{0.299807727f, 0.890811682f},
-std::array<float,2>{0.0191816483f, 0.406895876f},
-std::array<float,2>{0.851344109f, 0.531864583f},
-std::array<float,2>{0.734806955f, 0.472201049f},
-std::array<float,2>{0.282141745f, 0.600248754f},
-std::array<float,2>{0.00685040606f, 0.0612053238f},
-std::array<float,2>{0.861219704f, 0.939702809f},
-std::array<float,2>{0.880927742f, 0.149740443f},
-std::array<float,2>{0.219901517f, 0.750446141f},
-std::array<float,2>{0.468494713f, 0.269908041f},
-std::array<float,2>{0.553387105f, 0.676599383f},
-std::array<float,2>{0.764836252f, 0.32178545f},
-std::array<float,2>{0.112125233f, 0.692057669f},
-std::array<float,2>{0.366958529f, 0.208583772f},
-std::array<float,2>{0.652806222f, 0.821972072f},
-std::array<float,2>{0.588166237f, 0.0976539701f},
-std::array<float,2>{0.407331318f, 0.90668875f},
-std::array<float,2>{0.155905336f, 0.381988674f},
-std::array<float,2>{0.958501101f, 0.52847749f},
-std::array<float,2>{0.500618756f, 0.284760058f},
-std::array<float,2>{0.495763004f, 0.648227036f},
-std::array<float,2>{0.216371119f, 0.161320329f},
-std::array<float,2>{0.932909489f, 0.810512364f},
-std::array<float,2>{0.828891695f, 0.00286820484f},
-std::array<float,2>{0.0440180376f, 0.973812103f},
-std::array<float,2>{0.262483329f, 0.447598398f},
-std::array<float,2>{0.718157887f, 0.591204762f},
-std::array<float,2>{0.989473879f, 0.413502812f},
-std::array<float,2>{0.182638973f, 0.538366616f},
-std::array<float,2>{0.387506187f, 0.0666835755f},
-std::array<float,2>{0.600969672f, 0.897383511f},
-std::array<float,2>{0.667085946f, 0.226883128f},
-std::array<float,2>{0.315938592f, 0.851155221f},
-std::array<float,2>{0.0632062033f, 0.364978909f},
-std::array<float,2>{0.810290933f, 0.737836182f},
-std::array<float,2>{0.63276726f, 0.348181278f},
-std::array<float,2>{0.358605206f, 0.723550022f},
-std::array<float,2>{0.0993188918f, 0.238739967f},
-std::array<float,2>{0.776663959f, 0.874394178f},
-std::array<float,2>{0.943002999f, 0.0803609714f},
-std::array<float,2>{0.138883278f, 0.878746152f},
-std::array<float,2>{0.437287033f, 0.427958935f},
-std::array<float,2>{0.562510908f, 0.559095502f},
-std::array<float,2>{0.853835344f, 0.464771837f},
-std::array<float,2>{0.0294587947f, 0.568434656f},
-std::array<float,2>{0.307050377f, 0.0165684614f},
-std::array<float,2>{0.728484452f, 0.989970922f},
-std::array<float,2>{0.531317294f, 0.186409175f},
-std::array<float,2>{0.447356462f, 0.783503711f},
-std::array<float,2>{0.242494181f, 0.304944634f},
-std::array<float,2>{0.901696146f, 0.628300071f},
-std::array<float,2>{0.610218227f, 0.402689785f},
-std::array<float,2>{0.398946524f, 0.509563744f},
-std::array<float,2>{0.156851977f, 0.123083964f},
-std::array<float,2>{0.970905244f, 0.928991437f},
-std::array<float,2>{0.794176757f, 0.197221667f},
-std::array<float,2>{0.0842586234f, 0.830364823f},
-std::array<float,2>{0.339636952f, 0.332494855f},
-std::array<float,2>{0.674393117f, 0.707958519f},
-std::array<float,2>{0.91626662f, 0.262358755f},
-std::array<float,2>{0.193575293f, 0.663965106f},
-std::array<float,2>{0.479402274f, 0.138231784f},
-std::array<float,2>{0.517963767f, 0.779279411f},
-std::array<float,2>{0.69037801f, 0.038417127f},
-std::array<float,2>{0.276548892f, 0.96237421f},
-std::array<float,2>{0.0475279838f, 0.49366653f},
-std::array<float,2>{0.819684327f, 0.611998379f},
-std::array<float,2>{0.681530714f, 0.429894626f},
-std::array<float,2>{0.332321107f, 0.551431298f},
-std::array<float,2>{0.0866581127f, 0.0935668424f},
-std::array<float,2>{0.784871161f, 0.884117067f},
-std::array<float,2>{0.983832538f, 0.247059971f},
-std::array<float,2>{0.165173039f, 0.866983473f},
-std::array<float,2>{0.397835314f, 0.353215605f},
-std::array<float,2>{0.619454563f, 0.733199596f},
-std::array<float,2>{0.827257931f, 0.303139538f},
-std::array<float,2>{0.0587952994f, 0.637452841f},
-std::array<float,2>{0.267051578f, 0.177826717f},
-std::array<float,2>{0.702825248f, 0.790988564f},
-std::array<float,2>{0.529962599f, 0.0303437915f},
-std::array<float,2>{0.469597787f, 0.992645621f},
-std::array<float,2>{0.201908812f, 0.459407866f},
-std::array<float,2>{0.910884619f, 0.5764395f},
-std::array<float,2>{0.57586956f, 0.341271996f},
-std::array<float,2>{0.428141803f, 0.714508653f},
-std::array<float,2>{0.129118875f, 0.192866459f},
-std::array<float,2>{0.951354444f, 0.842227221f},
-std::array<float,2>{0.772354424f, 0.116082676f},
-std::array<float,2>{0.104716271f, 0.935325801f},
-std::array<float,2>{0.351335555f, 0.393951893f},
-std::array<float,2>{0.636320472f, 0.502016902f},
-std::array<float,2>{0.895612478f, 0.489644647f},
-std::array<float,2>{0.235033527f, 0.619942188f},
-std::array<float,2>{0.438795298f, 0.0464026555f},
-std::array<float,2>{0.541886449f, 0.96055162f},
-std::array<float,2>{0.719490051f, 0.129904747f},
-std::array<float,2>{0.302391052f, 0.770572662f},
-std::array<float,2>{0.0209425781f, 0.250687748f},
-std::array<float,2>{0.844281077f, 0.671004593f},
-std::array<float,2>{0.709925354f, 0.278084815f},
-std::array<float,2>{0.256583989f, 0.683384657f},
-std::array<float,2>{0.0329410248f, 0.141863853f},
-std::array<float,2>{0.839198768f, 0.763928652f},
-std::array<float,2>{0.927085936f, 0.0471378565f},
-std::array<float,2>{0.206103489f, 0.948266685f},
-std::array<float,2>{0.484668702f, 0.478161097f},
-std::array<float,2>{0.513041198f, 0.605134249f},
-std::array<float,2>{0.803658485f, 0.386939287f},
-std::array<float,2>{0.0760647357f, 0.517517328f},
-std::array<float,2>{0.328028888f, 0.10726741f},
-std::array<float,2>{0.661982298f, 0.921052098f},
-std::array<float,2>{0.604938805f, 0.211810112f},
-std::array<float,2>{0.375930399f, 0.816512764f},
-std::array<float,2>{0.175502986f, 0.316962272f},
-std::array<float,2>{0.993270397f, 0.696700692f},
-std::array<float,2>{0.555279851f, 0.439736664f},
-std::array<float,2>{0.456729144f, 0.579009712f},
-std::array<float,2>{0.228782356f, 0.0129513294f},
-std::array<float,2>{0.887345016f, 0.981915474f},
-std::array<float,2>{0.873781025f, 0.170733079f},
-std::array<float,2>{0.00792340189f, 0.799763203f},
-std::array<float,2>{0.293268412f, 0.293984592f},
-std::array<float,2>{0.747082174f, 0.650614977f},
-std::array<float,2>{0.960995555f, 0.374322951f},
-std::array<float,2>{0.142115206f, 0.745382249f},
-std::array<float,2>{0.415025651f, 0.225358635f},
-std::array<float,2>{0.582980454f, 0.854540944f},
-std::array<float,2>{0.642952502f, 0.0707917884f},
-std::array<float,2>{0.369683266f, 0.899181485f},
-std::array<float,2>{0.117260337f, 0.414767951f},
-std::array<float,2>{0.750852644f, 0.545436144f},
-std::array<float,2>{0.649616182f, 0.455280185f},
-std::array<float,2>{0.360420495f, 0.571309805f},
-std::array<float,2>{0.116326384f, 0.0255193766f},
-std::array<float,2>{0.761262476f, 0.997363865f},
-std::array<float,2>{0.953496754f, 0.174957231f},
-std::array<float,2>{0.150895998f, 0.794365823f},
-std::array<float,2>{0.413251787f, 0.297522247f},
-std::array<float,2>{0.593113601f, 0.634771287f},
-std::array<float,2>{0.86663729f, 0.356769562f},
-std::array<float,2>{0.00162340316f, 0.727417588f},
-std::array<float,2>{0.288127393f, 0.242245227f},
-std::array<float,2>{0.739149451f, 0.862837553f},
-std::array<float,2>{0.547323585f, 0.0868395939f},
-std::array<float,2>{0.463974059f, 0.889745295f},
-std::array<float,2>{0.226447627f, 0.437394887f},
-std::array<float,2>{0.876696587f, 0.547285259f},
-std::array<float,2>{0.597603202f, 0.254163206f},
-std::array<float,2>{0.383773625f, 0.66456759f},
-std::array<float,2>{0.184384286f, 0.127892882f},
-std::array<float,2>{0.985402524f, 0.767937839f},
-std::array<float,2>{0.805421472f, 0.0407593064f},
-std::array<float,2>{0.0682466179f, 0.953160048f},
-std::array<float,2>{0.319136888f, 0.485744566f},
-std::array<float,2>{0.670041144f, 0.623091221f},
-std::array<float,2>{0.935526609f, 0.398251444f},
-std::array<float,2>{0.212186426f, 0.505392075f},
-std::array<float,2>{0.498808295f, 0.112395793f},
-std::array<float,2>{0.506697297f, 0.931297481f},
-std::array<float,2>{0.713509798f, 0.188160866f},
-std::array<float,2>{0.257945627f, 0.839263797f},
-std::array<float,2>{0.0421106257f, 0.337730795f},
-std::array<float,2>{0.832783461f, 0.715045989f},
-std::array<float,2>{0.733714283f, 0.312996298f},
-std::array<float,2>{0.308965832f, 0.701501429f},
-std::array<float,2>{0.0265804548f, 0.216723278f},
-std::array<float,2>{0.85662663f, 0.813038588f},
-std::array<float,2>{0.903676629f, 0.101713672f},
-std::array<float,2>{0.24935545f, 0.917960107f},
-std::array<float,2>{0.450806826f, 0.384752542f},
-std::array<float,2>{0.538900375f, 0.520868778f},
-std::array<float,2>{0.779565156f, 0.481855273f},
-std::array<float,2>{0.0953070298f, 0.606893659f},
-std::array<float,2>{0.35339734f, 0.0509199053f},
-std::array<float,2>{0.628364861f, 0.95192337f},
-std::array<float,2>{0.568369925f, 0.147666186f},
-std::array<float,2>{0.432965845f, 0.761357963f},
-std::array<float,2>{0.136640862f, 0.273854405f},
-std::array<float,2>{0.940978765f, 0.684086859f},
-std::array<float,2>{0.519727468f, 0.419006944f},
-std::array<float,2>{0.480946422f, 0.541678071f},
-std::array<float,2>{0.188536882f, 0.0744524524f},
-std::array<float,2>{0.919033587f, 0.905653715f},
-std::array<float,2>{0.813112378f, 0.222036615f},
-std::array<float,2>{0.0508857965f, 0.857273817f},
-std::array<float,2>{0.280848265f, 0.370143175f},
-std::array<float,2>{0.695245862f, 0.74783814f},
-std::array<float,2>{0.976070702f, 0.290843397f},
-std::array<float,2>{0.161919847f, 0.652485847f},
-std::array<float,2>{0.403802693f, 0.165633693f},
-std::array<float,2>{0.615706265f, 0.803826213f},
-std::array<float,2>{0.679196477f, 0.0111386403f},
-std::array<float,2>{0.342143029f, 0.978045404f},
-std::array<float,2>{0.0795748532f, 0.443310738f},
-std::array<float,2>{0.789197803f, 0.584802508f},
-std::array<float,2>{0.698835671f, 0.376661807f},
-std::array<float,2>{0.273348391f, 0.524534762f},
-std::array<float,2>{0.0562420003f, 0.100166596f},
-std::array<float,2>{0.822674334f, 0.913957834f},
-std::array<float,2>{0.907405376f, 0.206370339f},
-std::array<float,2>{0.195655674f, 0.827578425f},
-std::array<float,2>{0.473125011f, 0.327520877f},
-std::array<float,2>{0.525141418f, 0.689358175f},
-std::array<float,2>{0.787833869f, 0.269243389f},
-std::array<float,2>{0.0913653597f, 0.671928406f},
-std::array<float,2>{0.328346968f, 0.155423686f},
-std::array<float,2>{0.68363589f, 0.75604248f},
-std::array<float,2>{0.624765038f, 0.0577485114f},
-std::array<float,2>{0.393985063f, 0.944222808f},
-std::array<float,2>{0.170664787f, 0.473884523f},
-std::array<float,2>{0.978260159f, 0.593762815f},
-std::array<float,2>{0.54667753f, 0.359978437f},
-std::array<float,2>{0.441544592f, 0.741602778f},
-std::array<float,2>{0.239445537f, 0.233696714f},
-std::array<float,2>{0.890748799f, 0.844278812f},
-std::array<float,2>{0.849754274f, 0.0646415725f},
-std::array<float,2>{0.0179283973f, 0.893075526f},
-std::array<float,2>{0.299242437f, 0.409568042f},
-std::array<float,2>{0.722843289f, 0.533561349f},
-std::array<float,2>{0.947592795f, 0.451249868f},
-std::array<float,2>{0.127474025f, 0.58743459f},
-std::array<float,2>{0.423860788f, 0.00598718692f},
-std::array<float,2>{0.5721699f, 0.969110668f},
-std::array<float,2>{0.639193416f, 0.15812549f},
-std::array<float,2>{0.345295995f, 0.806730986f},
-std::array<float,2>{0.108774394f, 0.286622554f},
-std::array<float,2>{0.768078387f, 0.643014967f},
-std::array<float,2>{0.658153594f, 0.311572433f},
-std::array<float,2>{0.322782844f, 0.629710734f},
-std::array<float,2>{0.0733089596f, 0.180297583f},
-std::array<float,2>{0.800485313f, 0.787600815f},
-std::array<float,2>{0.996969104f, 0.0231749956f},
-std::array<float,2>{0.178503916f, 0.984508216f},
-std::array<float,2>{0.381945193f, 0.466346562f},
-std::array<float,2>{0.608463705f, 0.565145671f},
-std::array<float,2>{0.841320574f, 0.424064398f},
-std::array<float,2>{0.0368000157f, 0.557024717f},
-std::array<float,2>{0.250055403f, 0.0827160999f},
-std::array<float,2>{0.704202771f, 0.881444514f},
-std::array<float,2>{0.510987937f, 0.237613901f},
-std::array<float,2>{0.488521725f, 0.870149016f},
-std::array<float,2>{0.207094043f, 0.345317662f},
-std::array<float,2>{0.922132194f, 0.71893841f},
-std::array<float,2>{0.579847276f, 0.496681392f},
-std::array<float,2>{0.418749213f, 0.616714597f},
-std::array<float,2>{0.145359665f, 0.0350364596f},
-std::array<float,2>{0.96633178f, 0.966788054f},
-std::array<float,2>{0.755637407f, 0.13442795f},
-std::array<float,2>{0.12125513f, 0.775289297f},
-std::array<float,2>{0.374271303f, 0.259801656f},
-std::array<float,2>{0.647796094f, 0.657755613f},
-std::array<float,2>{0.883142591f, 0.328362375f},
-std::array<float,2>{0.23161374f, 0.70461905f},
-std::array<float,2>{0.46050334f, 0.201306954f},
-std::array<float,2>{0.560406685f, 0.832578182f},
-std::array<float,2>{0.743497312f, 0.120110415f},
-std::array<float,2>{0.291904658f, 0.92515099f},
-std::array<float,2>{0.0121482834f, 0.402093291f},
-std::array<float,2>{0.869661212f, 0.51511246f},
-std::array<float,2>{0.716422081f, 0.44578582f},
-std::array<float,2>{0.264437914f, 0.592185676f},
-std::array<float,2>{0.0464561209f, 0.00103452289f},
-std::array<float,2>{0.831338108f, 0.974650443f},
-std::array<float,2>{0.931068599f, 0.163317412f},
-std::array<float,2>{0.217524126f, 0.811872423f},
-std::array<float,2>{0.4926579f, 0.28203395f},
-std::array<float,2>{0.502161801f, 0.644591868f},
-std::array<float,2>{0.810834169f, 0.366674095f},
-std::array<float,2>{0.0644553378f, 0.735109568f},
-std::array<float,2>{0.312507927f, 0.229273826f},
-std::array<float,2>{0.665748894f, 0.84856838f},
-std::array<float,2>{0.598537385f, 0.0687888861f},
-std::array<float,2>{0.390528291f, 0.894595861f},
-std::array<float,2>{0.180103257f, 0.411393464f},
-std::array<float,2>{0.990865529f, 0.537028968f},
-std::array<float,2>{0.55084306f, 0.272769243f},
-std::array<float,2>{0.465852439f, 0.678447962f},
-std::array<float,2>{0.220748007f, 0.150882021f},
-std::array<float,2>{0.880071998f, 0.753714025f},
-std::array<float,2>{0.863039136f, 0.0601102598f},
-std::array<float,2>{0.0053156144f, 0.939421594f},
-std::array<float,2>{0.283679903f, 0.470428407f},
-std::array<float,2>{0.737350702f, 0.598810554f},
-std::array<float,2>{0.960217416f, 0.380381733f},
-std::array<float,2>{0.153162837f, 0.529362082f},
-std::array<float,2>{0.409811914f, 0.0939550847f},
-std::array<float,2>{0.587652683f, 0.909332216f},
-std::array<float,2>{0.655527055f, 0.210723087f},
-std::array<float,2>{0.363375068f, 0.822805464f},
-std::array<float,2>{0.110280052f, 0.32403329f},
-std::array<float,2>{0.762159288f, 0.695103467f},
-std::array<float,2>{0.672449887f, 0.335644692f},
-std::array<float,2>{0.335948974f, 0.709858894f},
-std::array<float,2>{0.0821351185f, 0.198053867f},
-std::array<float,2>{0.796175659f, 0.829123974f},
-std::array<float,2>{0.969194949f, 0.122977965f},
-std::array<float,2>{0.159241021f, 0.926938355f},
-std::array<float,2>{0.401815087f, 0.405354708f},
-std::array<float,2>{0.612533867f, 0.511552036f},
-std::array<float,2>{0.817528069f, 0.496030867f},
-std::array<float,2>{0.0495579913f, 0.609801888f},
-std::array<float,2>{0.275153816f, 0.0352764353f},
-std::array<float,2>{0.688767552f, 0.96379894f},
-std::array<float,2>{0.51673609f, 0.139618203f},
-std::array<float,2>{0.476969898f, 0.780064344f},
-std::array<float,2>{0.191413522f, 0.265579075f},
-std::array<float,2>{0.915956616f, 0.661203861f},
-std::array<float,2>{0.565787613f, 0.426707119f},
-std::array<float,2>{0.434077531f, 0.561002374f},
-std::array<float,2>{0.136920765f, 0.0784410909f},
-std::array<float,2>{0.94443804f, 0.876290262f},
-std::array<float,2>{0.773539782f, 0.241841644f},
-std::array<float,2>{0.100174814f, 0.871970356f},
-std::array<float,2>{0.357318699f, 0.350230783f},
-std::array<float,2>{0.630320013f, 0.725772679f},
-std::array<float,2>{0.898541331f, 0.307732403f},
-std::array<float,2>{0.244973928f, 0.625926793f},
-std::array<float,2>{0.446878195f, 0.18418169f},
-std::array<float,2>{0.534041643f, 0.783075154f},
-std::array<float,2>{0.729230285f, 0.0178301614f},
-std::array<float,2>{0.305597246f, 0.991379738f},
-std::array<float,2>{0.0277561918f, 0.462522626f},
-std::array<float,2>{0.852488101f, 0.566523552f},
-std::array<float,2>{0.633825541f, 0.391308755f},
-std::array<float,2>{0.349227816f, 0.501444399f},
-std::array<float,2>{0.103250563f, 0.114259511f},
-std::array<float,2>{0.770333171f, 0.936888635f},
-std::array<float,2>{0.949283659f, 0.194624484f},
-std::array<float,2>{0.131207213f, 0.840423703f},
-std::array<float,2>{0.427368253f, 0.34280628f},
-std::array<float,2>{0.576853633f, 0.712690651f},
-std::array<float,2>{0.846661508f, 0.253500164f},
-std::array<float,2>{0.0231741946f, 0.668343842f},
-std::array<float,2>{0.302820295f, 0.130930945f},
-std::array<float,2>{0.721597373f, 0.771618366f},
-std::array<float,2>{0.540307403f, 0.0433207378f},
-std::array<float,2>{0.441052139f, 0.957327962f},
-std::array<float,2>{0.238237113f, 0.491165996f},
-std::array<float,2>{0.897346318f, 0.617985189f},
-std::array<float,2>{0.617430806f, 0.353854507f},
-std::array<float,2>{0.395682245f, 0.731052637f},
-std::array<float,2>{0.167311177f, 0.248308316f},
-std::array<float,2>{0.982252121f, 0.864343226f},
-std::array<float,2>{0.782895744f, 0.090736039f},
-std::array<float,2>{0.0884298161f, 0.885795414f},
-std::array<float,2>{0.334602982f, 0.433252245f},
-std::array<float,2>{0.683044255f, 0.553550661f},
-std::array<float,2>{0.913076818f, 0.457851052f},
-std::array<float,2>{0.199842319f, 0.574785173f},
-std::array<float,2>{0.471700877f, 0.0276429299f},
-std::array<float,2>{0.528351843f, 0.995146573f},
-std::array<float,2>{0.700464189f, 0.176559284f},
-std::array<float,2>{0.269128799f, 0.792723596f},
-std::array<float,2>{0.0610084943f, 0.3019315f},
-std::array<float,2>{0.82566005f, 0.640379429f},
-std::array<float,2>{0.748661697f, 0.295679688f},
-std::array<float,2>{0.295829117f, 0.649485648f},
-std::array<float,2>{0.0111726271f, 0.168279484f},
-std::array<float,2>{0.871628642f, 0.796906054f},
-std::array<float,2>{0.890242875f, 0.015002531f},
-std::array<float,2>{0.227886871f, 0.982932091f},
-std::array<float,2>{0.454895735f, 0.439375877f},
-std::array<float,2>{0.557931364f, 0.580845773f},
-std::array<float,2>{0.752270997f, 0.417188317f},
-std::array<float,2>{0.120542601f, 0.543808043f},
-std::array<float,2>{0.367610604f, 0.0741398931f},
-std::array<float,2>{0.641467929f, 0.901574731f},
-std::array<float,2>{0.584972739f, 0.223081604f},
-std::array<float,2>{0.41618529f, 0.853483319f},
-std::array<float,2>{0.144414604f, 0.373004377f},
-std::array<float,2>{0.964751065f, 0.743785739f},
-std::array<float,2>{0.515612125f, 0.479599416f},
-std::array<float,2>{0.487065822f, 0.602483988f},
-std::array<float,2>{0.204062328f, 0.0494704656f},
-std::array<float,2>{0.928974271f, 0.945923686f},
-std::array<float,2>{0.83626312f, 0.143476024f},
-std::array<float,2>{0.0332881361f, 0.762889683f},
-std::array<float,2>{0.25409171f, 0.279881179f},
-std::array<float,2>{0.708607316f, 0.680493176f},
-std::array<float,2>{0.995891392f, 0.320268452f},
-std::array<float,2>{0.172819525f, 0.698407292f},
-std::array<float,2>{0.377544999f, 0.212979227f},
-std::array<float,2>{0.603412688f, 0.819330335f},
-std::array<float,2>{0.662515163f, 0.108446993f},
-std::array<float,2>{0.325743049f, 0.919203937f},
-std::array<float,2>{0.0762117282f, 0.39058274f},
-std::array<float,2>{0.801387906f, 0.51885438f},
-std::array<float,2>{0.668884933f, 0.487521142f},
-std::array<float,2>{0.317524701f, 0.622483492f},
-std::array<float,2>{0.0696960837f, 0.0415429883f},
-std::array<float,2>{0.807438016f, 0.956186831f},
-std::array<float,2>{0.987578809f, 0.125187829f},
-std::array<float,2>{0.187481239f, 0.765693426f},
-std::array<float,2>{0.386646152f, 0.25586766f},
-std::array<float,2>{0.593846977f, 0.666477978f},
-std::array<float,2>{0.834989011f, 0.338299364f},
-std::array<float,2>{0.0391192362f, 0.717755437f},
-std::array<float,2>{0.261144459f, 0.189722329f},
-std::array<float,2>{0.71162653f, 0.836818457f},
-std::array<float,2>{0.504121184f, 0.109913327f},
-std::array<float,2>{0.49748528f, 0.932656288f},
-std::array<float,2>{0.214051515f, 0.395919919f},
-std::array<float,2>{0.937124074f, 0.50603801f},
-std::array<float,2>{0.591720104f, 0.298902392f},
-std::array<float,2>{0.410751492f, 0.634264231f},
-std::array<float,2>{0.14898929f, 0.172437072f},
-std::array<float,2>{0.956980824f, 0.795413673f},
-std::array<float,2>{0.759709954f, 0.0235784147f},
-std::array<float,2>{0.114951931f, 0.99838382f},
-std::array<float,2>{0.362263352f, 0.454485774f},
-std::array<float,2>{0.651386201f, 0.573683381f},
-std::array<float,2>{0.878575563f, 0.433734298f},
-std::array<float,2>{0.222810537f, 0.550097108f},
-std::array<float,2>{0.46282047f, 0.0890380442f},
-std::array<float,2>{0.548956573f, 0.88793093f},
-std::array<float,2>{0.742151976f, 0.244217396f},
-std::array<float,2>{0.285561562f, 0.860666096f},
-std::array<float,2>{0.00241778255f, 0.358299464f},
-std::array<float,2>{0.863884151f, 0.729480922f},
-std::array<float,2>{0.69315213f, 0.367333293f},
-std::array<float,2>{0.277807921f, 0.748756945f},
-std::array<float,2>{0.0542382486f, 0.220565379f},
-std::array<float,2>{0.814962626f, 0.858473063f},
-std::array<float,2>{0.920401096f, 0.0770657659f},
-std::array<float,2>{0.189745679f, 0.902403772f},
-std::array<float,2>{0.48353532f, 0.421833962f},
-std::array<float,2>{0.522048712f, 0.539720535f},
-std::array<float,2>{0.792007089f, 0.443855762f},
-std::array<float,2>{0.080194965f, 0.582743108f},
-std::array<float,2>{0.34032014f, 0.00922124088f},
-std::array<float,2>{0.677701712f, 0.9786461f},
-std::array<float,2>{0.613313019f, 0.1678873f},
-std::array<float,2>{0.404651374f, 0.801766872f},
-std::array<float,2>{0.162510082f, 0.291169226f},
-std::array<float,2>{0.973627508f, 0.654736519f},
-std::array<float,2>{0.536646128f, 0.385096043f},
-std::array<float,2>{0.451822519f, 0.521589756f},
-std::array<float,2>{0.247047037f, 0.104289733f},
-std::array<float,2>{0.906113863f, 0.914892972f},
-std::array<float,2>{0.858719409f, 0.217329115f},
-std::array<float,2>{0.0245598909f, 0.815417588f},
-std::array<float,2>{0.312226981f, 0.315751433f},
-std::array<float,2>{0.730819583f, 0.699923813f},
-std::array<float,2>{0.937976301f, 0.277125955f},
-std::array<float,2>{0.134565771f, 0.687115908f},
-std::array<float,2>{0.429969192f, 0.145628721f},
-std::array<float,2>{0.567931592f, 0.757969379f},
-std::array<float,2>{0.625045776f, 0.0534634739f},
-std::array<float,2>{0.35358724f, 0.949756205f},
-std::array<float,2>{0.0964887962f, 0.483516246f},
-std::array<float,2>{0.777972996f, 0.607442737f},
-std::array<float,2>{0.726071596f, 0.407281339f},
-std::array<float,2>{0.298674494f, 0.532340467f},
-std::array<float,2>{0.0171256661f, 0.06405247f},
-std::array<float,2>{0.848083138f, 0.891986489f},
-std::array<float,2>{0.89294976f, 0.232304797f},
-std::array<float,2>{0.241210356f, 0.846731007f},
-std::array<float,2>{0.44393304f, 0.362565845f},
-std::array<float,2>{0.543511212f, 0.739118576f},
-std::array<float,2>{0.767042994f, 0.287972331f},
-std::array<float,2>{0.10585919f, 0.641438544f},
-std::array<float,2>{0.34626478f, 0.158314645f},
-std::array<float,2>{0.637878716f, 0.806078851f},
-std::array<float,2>{0.573864162f, 0.00399277313f},
-std::array<float,2>{0.422733009f, 0.970947146f},
-std::array<float,2>{0.125739112f, 0.449586749f},
-std::array<float,2>{0.945409954f, 0.58908993f},
-std::array<float,2>{0.526351333f, 0.325452566f},
-std::array<float,2>{0.474719733f, 0.689852297f},
-std::array<float,2>{0.19845216f, 0.203322023f},
-std::array<float,2>{0.908960462f, 0.824473441f},
-std::array<float,2>{0.821216464f, 0.0992938131f},
-std::array<float,2>{0.0584531613f, 0.910384417f},
-std::array<float,2>{0.269978136f, 0.377221316f},
-std::array<float,2>{0.696759224f, 0.525949121f},
-std::array<float,2>{0.980375409f, 0.476071268f},
-std::array<float,2>{0.169135079f, 0.596065044f},
-std::array<float,2>{0.392540127f, 0.0565844104f},
-std::array<float,2>{0.621222258f, 0.942655504f},
-std::array<float,2>{0.686489165f, 0.153685376f},
-std::array<float,2>{0.330358326f, 0.755846918f},
-std::array<float,2>{0.0933486f, 0.266125411f},
-std::array<float,2>{0.785757899f, 0.674226463f},
-std::array<float,2>{0.646184742f, 0.259628862f},
-std::array<float,2>{0.371320814f, 0.658313215f},
-std::array<float,2>{0.123984121f, 0.136384413f},
-std::array<float,2>{0.757529199f, 0.776512504f},
-std::array<float,2>{0.967237949f, 0.0329469442f},
-std::array<float,2>{0.147136018f, 0.968343377f},
-std::array<float,2>{0.421335667f, 0.498362452f},
-std::array<float,2>{0.581721246f, 0.613785505f},
-std::array<float,2>{0.867982566f, 0.398556948f},
-std::array<float,2>{0.0148432227f, 0.512947679f},
-std::array<float,2>{0.289881796f, 0.117272489f},
-std::array<float,2>{0.744972706f, 0.923369229f},
-std::array<float,2>{0.562352121f, 0.20056133f},
-std::array<float,2>{0.457300663f, 0.835527301f},
-std::array<float,2>{0.232527241f, 0.331013232f},
-std::array<float,2>{0.88586086f, 0.706950188f},
-std::array<float,2>{0.606048644f, 0.468676269f},
-std::array<float,2>{0.380654871f, 0.563923597f},
-std::array<float,2>{0.177494854f, 0.0195906349f},
-std::array<float,2>{0.999455154f, 0.987692356f},
-std::array<float,2>{0.797447324f, 0.182060599f},
-std::array<float,2>{0.0711350366f, 0.785325348f},
-std::array<float,2>{0.321191967f, 0.309405833f},
-std::array<float,2>{0.659475327f, 0.63112253f},
-std::array<float,2>{0.925447106f, 0.346383601f},
-std::array<float,2>{0.209297061f, 0.721740901f},
-std::array<float,2>{0.491734505f, 0.236020684f},
-std::array<float,2>{0.508716702f, 0.867690563f},
-std::array<float,2>{0.705554605f, 0.084906213f},
-std::array<float,2>{0.252939105f, 0.879555225f},
-std::array<float,2>{0.0372508578f, 0.42309165f},
-std::array<float,2>{0.842404485f, 0.555532932f},
-std::array<float,2>{0.711829126f, 0.48474589f},
-std::array<float,2>{0.260935485f, 0.624327183f},
-std::array<float,2>{0.0394424088f, 0.0396314003f},
-std::array<float,2>{0.835291624f, 0.95448494f},
-std::array<float,2>{0.937471509f, 0.128011212f},
-std::array<float,2>{0.214270264f, 0.768640459f},
-std::array<float,2>{0.497179449f, 0.255765557f},
-std::array<float,2>{0.504241109f, 0.66538775f},
-std::array<float,2>{0.807305694f, 0.336140156f},
-std::array<float,2>{0.0694285408f, 0.715897918f},
-std::array<float,2>{0.317680091f, 0.188516423f},
-std::array<float,2>{0.668640018f, 0.838724673f},
-std::array<float,2>{0.594119668f, 0.111354463f},
-std::array<float,2>{0.386389613f, 0.930045784f},
-std::array<float,2>{0.18722263f, 0.397301584f},
-std::array<float,2>{0.987338483f, 0.5039469f},
-std::array<float,2>{0.549132049f, 0.298485518f},
-std::array<float,2>{0.462558717f, 0.635808945f},
-std::array<float,2>{0.223114297f, 0.174387902f},
-std::array<float,2>{0.878726721f, 0.793942869f},
-std::array<float,2>{0.864142716f, 0.0265437141f},
-std::array<float,2>{0.00214495393f, 0.997048676f},
-std::array<float,2>{0.285228372f, 0.456908166f},
-std::array<float,2>{0.74172312f, 0.570891201f},
-std::array<float,2>{0.956605554f, 0.43607527f},
-std::array<float,2>{0.149349913f, 0.548109412f},
-std::array<float,2>{0.410987169f, 0.087036483f},
-std::array<float,2>{0.591347098f, 0.889208972f},
-std::array<float,2>{0.651677668f, 0.243478701f},
-std::array<float,2>{0.361908078f, 0.862043798f},
-std::array<float,2>{0.115024187f, 0.356144607f},
-std::array<float,2>{0.759340048f, 0.72768259f},
-std::array<float,2>{0.67733264f, 0.369358182f},
-std::array<float,2>{0.339900255f, 0.746470571f},
-std::array<float,2>{0.0804753453f, 0.221363693f},
-std::array<float,2>{0.792242706f, 0.856412053f},
-std::array<float,2>{0.973387241f, 0.0760110542f},
-std::array<float,2>{0.162258938f, 0.905221641f},
-std::array<float,2>{0.404409438f, 0.418065608f},
-std::array<float,2>{0.613595128f, 0.542123258f},
-std::array<float,2>{0.815350771f, 0.441976726f},
-std::array<float,2>{0.0546681844f, 0.585349023f},
-std::array<float,2>{0.27755487f, 0.010655445f},
-std::array<float,2>{0.692886114f, 0.976613164f},
-std::array<float,2>{0.522289515f, 0.164991409f},
-std::array<float,2>{0.483654976f, 0.803053141f},
-std::array<float,2>{0.189679042f, 0.289961308f},
-std::array<float,2>{0.920142233f, 0.653404534f},
-std::array<float,2>{0.56813252f, 0.382873714f},
-std::array<float,2>{0.429706603f, 0.519550502f},
-std::array<float,2>{0.134366065f, 0.103116915f},
-std::array<float,2>{0.937685907f, 0.916918397f},
-std::array<float,2>{0.778148949f, 0.215034783f},
-std::array<float,2>{0.0962570161f, 0.813655436f},
-std::array<float,2>{0.353784293f, 0.31378594f},
-std::array<float,2>{0.625268459f, 0.702634394f},
-std::array<float,2>{0.905892432f, 0.275126159f},
-std::array<float,2>{0.24676919f, 0.685465336f},
-std::array<float,2>{0.452049702f, 0.146939725f},
-std::array<float,2>{0.537032068f, 0.759779155f},
-std::array<float,2>{0.73058939f, 0.0520016216f},
-std::array<float,2>{0.31245172f, 0.952715755f},
-std::array<float,2>{0.0247012991f, 0.480746001f},
-std::array<float,2>{0.858638525f, 0.606247544f},
-std::array<float,2>{0.638178527f, 0.408260196f},
-std::array<float,2>{0.346634865f, 0.534545124f},
-std::array<float,2>{0.105533555f, 0.0663901642f},
-std::array<float,2>{0.766767502f, 0.89449954f},
-std::array<float,2>{0.945644379f, 0.233038619f},
-std::array<float,2>{0.12560764f, 0.845450521f},
-std::array<float,2>{0.422517896f, 0.360615611f},
-std::array<float,2>{0.574112594f, 0.740387022f},
-std::array<float,2>{0.847715557f, 0.285749197f},
-std::array<float,2>{0.0174292475f, 0.643619537f},
-std::array<float,2>{0.298459947f, 0.156931356f},
-std::array<float,2>{0.725670516f, 0.807736993f},
-std::array<float,2>{0.543770134f, 0.00750636775f},
-std::array<float,2>{0.444263279f, 0.970670342f},
-std::array<float,2>{0.240800351f, 0.453119844f},
-std::array<float,2>{0.892733335f, 0.586884737f},
-std::array<float,2>{0.621339381f, 0.326356322f},
-std::array<float,2>{0.392111361f, 0.687639475f},
-std::array<float,2>{0.169218644f, 0.205838889f},
-std::array<float,2>{0.980068743f, 0.826625884f},
-std::array<float,2>{0.786007226f, 0.101130478f},
-std::array<float,2>{0.0935614258f, 0.912458897f},
-std::array<float,2>{0.330217749f, 0.375030607f},
-std::array<float,2>{0.686275244f, 0.523923814f},
-std::array<float,2>{0.9086954f, 0.473139495f},
-std::array<float,2>{0.198729858f, 0.595267773f},
-std::array<float,2>{0.474951833f, 0.0573897585f},
-std::array<float,2>{0.526044488f, 0.944700301f},
-std::array<float,2>{0.696489573f, 0.154301688f},
-std::array<float,2>{0.26971224f, 0.756941557f},
-std::array<float,2>{0.0583075695f, 0.268218994f},
-std::array<float,2>{0.820819736f, 0.673620403f},
-std::array<float,2>{0.744657695f, 0.261300951f},
-std::array<float,2>{0.289619297f, 0.656689227f},
-std::array<float,2>{0.0150552318f, 0.13312988f},
-std::array<float,2>{0.867871821f, 0.773751915f},
-std::array<float,2>{0.886100829f, 0.0338422619f},
-std::array<float,2>{0.232712999f, 0.965812385f},
-std::array<float,2>{0.457146466f, 0.497549295f},
-std::array<float,2>{0.562104166f, 0.615374923f},
-std::array<float,2>{0.75759697f, 0.40107882f},
-std::array<float,2>{0.123552144f, 0.51368165f},
-std::array<float,2>{0.371413589f, 0.120226882f},
-std::array<float,2>{0.646432161f, 0.924194574f},
-std::array<float,2>{0.58201462f, 0.202864349f},
-std::array<float,2>{0.421004772f, 0.833489895f},
-std::array<float,2>{0.147390321f, 0.329804242f},
-std::array<float,2>{0.96703434f, 0.703816712f},
-std::array<float,2>{0.508469284f, 0.465517759f},
-std::array<float,2>{0.492041618f, 0.566103995f},
-std::array<float,2>{0.209102958f, 0.0221657753f},
-std::array<float,2>{0.925718069f, 0.985461235f},
-std::array<float,2>{0.8427279f, 0.181061059f},
-std::array<float,2>{0.0375825688f, 0.788534999f},
-std::array<float,2>{0.253385633f, 0.310738534f},
-std::array<float,2>{0.705308974f, 0.630183101f},
-std::array<float,2>{0.999063611f, 0.344108701f},
-std::array<float,2>{0.177371696f, 0.720533133f},
-std::array<float,2>{0.380496353f, 0.236453563f},
-std::array<float,2>{0.606210172f, 0.869316518f},
-std::array<float,2>{0.659197807f, 0.0832602158f},
-std::array<float,2>{0.320994228f, 0.882304907f},
-std::array<float,2>{0.0709321871f, 0.425308079f},
-std::array<float,2>{0.797744513f, 0.558321536f},
-std::array<float,2>{0.665913403f, 0.448373318f},
-std::array<float,2>{0.312978894f, 0.590554774f},
-std::array<float,2>{0.0647388026f, 0.00366245909f},
-std::array<float,2>{0.810774446f, 0.973159909f},
-std::array<float,2>{0.991166413f, 0.160446316f},
-std::array<float,2>{0.179739162f, 0.808744729f},
-std::array<float,2>{0.390142053f, 0.283883691f},
-std::array<float,2>{0.598315358f, 0.647413135f},
-std::array<float,2>{0.831135988f, 0.363639712f},
-std::array<float,2>{0.0466965511f, 0.73717916f},
-std::array<float,2>{0.264264762f, 0.2278056f},
-std::array<float,2>{0.716697693f, 0.850397229f},
-std::array<float,2>{0.502356291f, 0.0676883385f},
-std::array<float,2>{0.492408246f, 0.898103535f},
-std::array<float,2>{0.21762529f, 0.412703097f},
-std::array<float,2>{0.93071866f, 0.537304938f},
-std::array<float,2>{0.587403059f, 0.270998269f},
-std::array<float,2>{0.410008907f, 0.676900864f},
-std::array<float,2>{0.153010577f, 0.14852199f},
-std::array<float,2>{0.960164428f, 0.751303136f},
-std::array<float,2>{0.761780441f, 0.0621234141f},
-std::array<float,2>{0.109951191f, 0.940699458f},
-std::array<float,2>{0.363692999f, 0.471286833f},
-std::array<float,2>{0.655396342f, 0.601376474f},
-std::array<float,2>{0.8803159f, 0.381400198f},
-std::array<float,2>{0.221172884f, 0.527827203f},
-std::array<float,2>{0.46629411f, 0.0962954313f},
-std::array<float,2>{0.55103302f, 0.907283485f},
-std::array<float,2>{0.737607419f, 0.207888231f},
-std::array<float,2>{0.283285379f, 0.821146905f},
-std::array<float,2>{0.00489018764f, 0.320631504f},
-std::array<float,2>{0.863033891f, 0.693234503f},
-std::array<float,2>{0.688653409f, 0.333163112f},
-std::array<float,2>{0.274927318f, 0.708028018f},
-std::array<float,2>{0.0495898351f, 0.195544228f},
-std::array<float,2>{0.817695498f, 0.831902564f},
-std::array<float,2>{0.915720463f, 0.12427219f},
-std::array<float,2>{0.191748917f, 0.927769303f},
-std::array<float,2>{0.476626754f, 0.403496385f},
-std::array<float,2>{0.517038107f, 0.508426249f},
-std::array<float,2>{0.796013236f, 0.492942631f},
-std::array<float,2>{0.0823611394f, 0.61316669f},
-std::array<float,2>{0.33620882f, 0.0375425853f},
-std::array<float,2>{0.672742128f, 0.961870253f},
-std::array<float,2>{0.612633765f, 0.136831298f},
-std::array<float,2>{0.401425302f, 0.777647197f},
-std::array<float,2>{0.159537151f, 0.263430059f},
-std::array<float,2>{0.968914151f, 0.662753582f},
-std::array<float,2>{0.533826351f, 0.429199219f},
-std::array<float,2>{0.447134525f, 0.559643626f},
-std::array<float,2>{0.244817063f, 0.0819620714f},
-std::array<float,2>{0.89882654f, 0.877560973f},
-std::array<float,2>{0.852125108f, 0.23974213f},
-std::array<float,2>{0.0274304487f, 0.873552024f},
-std::array<float,2>{0.305227637f, 0.349123776f},
-std::array<float,2>{0.729312778f, 0.72371453f},
-std::array<float,2>{0.944751203f, 0.306476861f},
-std::array<float,2>{0.136975795f, 0.627143085f},
-std::array<float,2>{0.433682024f, 0.186663717f},
-std::array<float,2>{0.565651357f, 0.784677148f},
-std::array<float,2>{0.62993902f, 0.0168686323f},
-std::array<float,2>{0.357075006f, 0.988410532f},
-std::array<float,2>{0.100518048f, 0.463044763f},
-std::array<float,2>{0.773752809f, 0.569488049f},
-std::array<float,2>{0.72121191f, 0.392864048f},
-std::array<float,2>{0.303061217f, 0.503804147f},
-std::array<float,2>{0.0233782791f, 0.116650753f},
-std::array<float,2>{0.846232831f, 0.933875263f},
-std::array<float,2>{0.89711082f, 0.191753298f},
-std::array<float,2>{0.237859413f, 0.843286037f},
-std::array<float,2>{0.441263437f, 0.340613037f},
-std::array<float,2>{0.540274918f, 0.713451624f},
-std::array<float,2>{0.770036459f, 0.251506776f},
-std::array<float,2>{0.10346397f, 0.670814276f},
-std::array<float,2>{0.349519283f, 0.128907368f},
-std::array<float,2>{0.634171307f, 0.770021379f},
-std::array<float,2>{0.577112257f, 0.0457611345f},
-std::array<float,2>{0.427715749f, 0.959128439f},
-std::array<float,2>{0.131001279f, 0.488472402f},
-std::array<float,2>{0.949624002f, 0.620363116f},
-std::array<float,2>{0.528603792f, 0.352070749f},
-std::array<float,2>{0.471991539f, 0.733688593f},
-std::array<float,2>{0.200164869f, 0.247864977f},
-std::array<float,2>{0.912778735f, 0.865795314f},
-std::array<float,2>{0.82541132f, 0.0927152038f},
-std::array<float,2>{0.0606964231f, 0.883353949f},
-std::array<float,2>{0.269473761f, 0.430886f},
-std::array<float,2>{0.700286865f, 0.552700996f},
-std::array<float,2>{0.981975675f, 0.460045129f},
-std::array<float,2>{0.166993767f, 0.577979565f},
-std::array<float,2>{0.395804912f, 0.0293560009f},
-std::array<float,2>{0.617432415f, 0.993370891f},
-std::array<float,2>{0.682745755f, 0.179534793f},
-std::array<float,2>{0.334815443f, 0.78914696f},
-std::array<float,2>{0.0886870027f, 0.303836137f},
-std::array<float,2>{0.78296423f, 0.637744009f},
-std::array<float,2>{0.64123863f, 0.293368161f},
-std::array<float,2>{0.367418438f, 0.651437402f},
-std::array<float,2>{0.120274335f, 0.171868041f},
-std::array<float,2>{0.752067983f, 0.80044359f},
-std::array<float,2>{0.964385927f, 0.0120000597f},
-std::array<float,2>{0.144250423f, 0.981431246f},
-std::array<float,2>{0.416355371f, 0.440781772f},
-std::array<float,2>{0.585408986f, 0.579385698f},
-std::array<float,2>{0.872003138f, 0.415126652f},
-std::array<float,2>{0.0109506715f, 0.546213508f},
-std::array<float,2>{0.295645297f, 0.0713913515f},
-std::array<float,2>{0.748922408f, 0.900163651f},
-std::array<float,2>{0.557623565f, 0.225829229f},
-std::array<float,2>{0.454595894f, 0.853577018f},
-std::array<float,2>{0.227589592f, 0.37389338f},
-std::array<float,2>{0.890498579f, 0.744320571f},
-std::array<float,2>{0.603066564f, 0.477235347f},
-std::array<float,2>{0.377827555f, 0.603798926f},
-std::array<float,2>{0.172503427f, 0.0480525792f},
-std::array<float,2>{0.995753407f, 0.94811517f},
-std::array<float,2>{0.801617205f, 0.141120791f},
-std::array<float,2>{0.0765980929f, 0.765123665f},
-std::array<float,2>{0.325982749f, 0.278834194f},
-std::array<float,2>{0.662305832f, 0.682173431f},
-std::array<float,2>{0.928793788f, 0.317670435f},
-std::array<float,2>{0.203762457f, 0.695891559f},
-std::array<float,2>{0.486841291f, 0.212832555f},
-std::array<float,2>{0.515239f, 0.817649603f},
-std::array<float,2>{0.708817482f, 0.106243052f},
-std::array<float,2>{0.254159123f, 0.920643508f},
-std::array<float,2>{0.0335388072f, 0.388235599f},
-std::array<float,2>{0.835972726f, 0.516265571f},
-std::array<float,2>{0.738786995f, 0.453888059f},
-std::array<float,2>{0.288330674f, 0.573134899f},
-std::array<float,2>{0.0019281772f, 0.0246963277f},
-std::array<float,2>{0.866238117f, 0.99916321f},
-std::array<float,2>{0.876785278f, 0.173470348f},
-std::array<float,2>{0.226090267f, 0.796800494f},
-std::array<float,2>{0.464155763f, 0.300480485f},
-std::array<float,2>{0.547102571f, 0.63345468f},
-std::array<float,2>{0.761620998f, 0.358504981f},
-std::array<float,2>{0.116590105f, 0.730013669f},
-std::array<float,2>{0.360677212f, 0.245247588f},
-std::array<float,2>{0.649847925f, 0.859705389f},
-std::array<float,2>{0.59278661f, 0.0886364058f},
-std::array<float,2>{0.413480967f, 0.886986434f},
-std::array<float,2>{0.151176259f, 0.434682697f},
-std::array<float,2>{0.953310311f, 0.549474478f},
-std::array<float,2>{0.506573558f, 0.25744766f},
-std::array<float,2>{0.498542517f, 0.6677562f},
-std::array<float,2>{0.21208261f, 0.126160517f},
-std::array<float,2>{0.935216904f, 0.767124355f},
-std::array<float,2>{0.832549095f, 0.0421620682f},
-std::array<float,2>{0.0424369164f, 0.955562532f},
-std::array<float,2>{0.258074403f, 0.486773282f},
-std::array<float,2>{0.713668585f, 0.622041821f},
-std::array<float,2>{0.985675335f, 0.39547947f},
-std::array<float,2>{0.184097022f, 0.507568836f},
-std::array<float,2>{0.383364975f, 0.110966519f},
-std::array<float,2>{0.59728992f, 0.932025015f},
-std::array<float,2>{0.670272529f, 0.190735996f},
-std::array<float,2>{0.318899125f, 0.837293208f},
-std::array<float,2>{0.0678794011f, 0.339753836f},
-std::array<float,2>{0.805372298f, 0.718498528f},
-std::array<float,2>{0.628015816f, 0.314833462f},
-std::array<float,2>{0.353031188f, 0.700244844f},
-std::array<float,2>{0.0956128165f, 0.218413338f},
-std::array<float,2>{0.779347003f, 0.816394508f},
-std::array<float,2>{0.94122833f, 0.10470739f},
-std::array<float,2>{0.136307552f, 0.915727556f},
-std::array<float,2>{0.432754576f, 0.38601023f},
-std::array<float,2>{0.568732262f, 0.523145854f},
-std::array<float,2>{0.856848955f, 0.482583195f},
-std::array<float,2>{0.0266143251f, 0.608568549f},
-std::array<float,2>{0.308811694f, 0.054659266f},
-std::array<float,2>{0.733634651f, 0.950259626f},
-std::array<float,2>{0.53858918f, 0.144734487f},
-std::array<float,2>{0.450964928f, 0.759161472f},
-std::array<float,2>{0.249061555f, 0.275945723f},
-std::array<float,2>{0.903528869f, 0.685816288f},
-std::array<float,2>{0.615274191f, 0.420100242f},
-std::array<float,2>{0.403345138f, 0.540135145f},
-std::array<float,2>{0.161827728f, 0.0775552467f},
-std::array<float,2>{0.975677907f, 0.903502107f},
-std::array<float,2>{0.7894243f, 0.218958274f},
-std::array<float,2>{0.0791472346f, 0.85826695f},
-std::array<float,2>{0.341994464f, 0.368620723f},
-std::array<float,2>{0.678722858f, 0.749970973f},
-std::array<float,2>{0.919261396f, 0.292951584f},
-std::array<float,2>{0.188740492f, 0.655455053f},
-std::array<float,2>{0.480505049f, 0.166844606f},
-std::array<float,2>{0.519915164f, 0.801539123f},
-std::array<float,2>{0.694869518f, 0.00811626669f},
-std::array<float,2>{0.2810812f, 0.98042959f},
-std::array<float,2>{0.0510405302f, 0.444555223f},
-std::array<float,2>{0.813436627f, 0.583943009f},
-std::array<float,2>{0.683980107f, 0.378331721f},
-std::array<float,2>{0.328418612f, 0.526790261f},
-std::array<float,2>{0.0917119011f, 0.0980460644f},
-std::array<float,2>{0.787937999f, 0.911807537f},
-std::array<float,2>{0.978353202f, 0.204978243f},
-std::array<float,2>{0.170588985f, 0.825275481f},
-std::array<float,2>{0.393794477f, 0.325179756f},
-std::array<float,2>{0.624619067f, 0.691273689f},
-std::array<float,2>{0.822435677f, 0.266770184f},
-std::array<float,2>{0.056475237f, 0.674870133f},
-std::array<float,2>{0.273020655f, 0.153213024f},
-std::array<float,2>{0.699195445f, 0.753994167f},
-std::array<float,2>{0.525149286f, 0.0548125952f},
-std::array<float,2>{0.472666711f, 0.941476166f},
-std::array<float,2>{0.195341021f, 0.475388765f},
-std::array<float,2>{0.907578468f, 0.597473979f},
-std::array<float,2>{0.57186389f, 0.361979306f},
-std::array<float,2>{0.424266428f, 0.740038037f},
-std::array<float,2>{0.127788976f, 0.231439069f},
-std::array<float,2>{0.947437465f, 0.846382141f},
-std::array<float,2>{0.768539786f, 0.0632406473f},
-std::array<float,2>{0.108402155f, 0.891404331f},
-std::array<float,2>{0.345479369f, 0.406477064f},
-std::array<float,2>{0.639447153f, 0.531282067f},
-std::array<float,2>{0.890966952f, 0.450716734f},
-std::array<float,2>{0.239662081f, 0.588212669f},
-std::array<float,2>{0.441862047f, 0.00506667793f},
-std::array<float,2>{0.546480298f, 0.972227752f},
-std::array<float,2>{0.723052561f, 0.159954548f},
-std::array<float,2>{0.299018621f, 0.804917097f},
-std::array<float,2>{0.0177048948f, 0.288336039f},
-std::array<float,2>{0.850081503f, 0.641805232f},
-std::array<float,2>{0.704561591f, 0.310450047f},
-std::array<float,2>{0.250338495f, 0.632331789f},
-std::array<float,2>{0.0369781181f, 0.183102086f},
-std::array<float,2>{0.841633141f, 0.78705436f},
-std::array<float,2>{0.922019899f, 0.0212234035f},
-std::array<float,2>{0.207494617f, 0.986465096f},
-std::array<float,2>{0.488596559f, 0.467653692f},
-std::array<float,2>{0.510915756f, 0.562682927f},
-std::array<float,2>{0.800753951f, 0.42193383f},
-std::array<float,2>{0.0736154914f, 0.556089759f},
-std::array<float,2>{0.323224932f, 0.0858513415f},
-std::array<float,2>{0.657943308f, 0.880004704f},
-std::array<float,2>{0.60888505f, 0.235153183f},
-std::array<float,2>{0.382155597f, 0.8681885f},
-std::array<float,2>{0.178452298f, 0.34691149f},
-std::array<float,2>{0.996824443f, 0.721336603f},
-std::array<float,2>{0.560166478f, 0.499891639f},
-std::array<float,2>{0.460800588f, 0.614767432f},
-std::array<float,2>{0.231859282f, 0.0320140198f},
-std::array<float,2>{0.882944882f, 0.96775794f},
-std::array<float,2>{0.869919181f, 0.135428697f},
-std::array<float,2>{0.011767922f, 0.775966406f},
-std::array<float,2>{0.29165718f, 0.257945299f},
-std::array<float,2>{0.743356168f, 0.659703195f},
-std::array<float,2>{0.966746449f, 0.332024634f},
-std::array<float,2>{0.145111322f, 0.705548108f},
-std::array<float,2>{0.418667644f, 0.199482128f},
-std::array<float,2>{0.579651594f, 0.834688365f},
-std::array<float,2>{0.647590101f, 0.118579537f},
-std::array<float,2>{0.374181569f, 0.922263384f},
-std::array<float,2>{0.121496193f, 0.399903327f},
-std::array<float,2>{0.755481601f, 0.512407064f},
-std::array<float,2>{0.652368426f, 0.468768209f},
-std::array<float,2>{0.366796285f, 0.598261356f},
-std::array<float,2>{0.11205823f, 0.0594386831f},
-std::array<float,2>{0.764948368f, 0.938010991f},
-std::array<float,2>{0.958953679f, 0.152328148f},
-std::array<float,2>{0.156145915f, 0.752203941f},
-std::array<float,2>{0.407472879f, 0.272171825f},
-std::array<float,2>{0.58800292f, 0.678786039f},
-std::array<float,2>{0.860843658f, 0.323207468f},
-std::array<float,2>{0.00727368938f, 0.69387573f},
-std::array<float,2>{0.281860471f, 0.209214747f},
-std::array<float,2>{0.73446691f, 0.823675275f},
-std::array<float,2>{0.553645432f, 0.0954309702f},
-std::array<float,2>{0.468530953f, 0.908450186f},
-std::array<float,2>{0.220059738f, 0.379708081f},
-std::array<float,2>{0.881307781f, 0.530693829f},
-std::array<float,2>{0.600736976f, 0.2826868f},
-std::array<float,2>{0.387252241f, 0.645525694f},
-std::array<float,2>{0.182926536f, 0.162731066f},
-std::array<float,2>{0.989641964f, 0.810706198f},
-std::array<float,2>{0.810465217f, 0.000689149427f},
-std::array<float,2>{0.0634487718f, 0.975813746f},
-std::array<float,2>{0.316377342f, 0.446296602f},
-std::array<float,2>{0.667302787f, 0.593738854f},
-std::array<float,2>{0.932684183f, 0.410979331f},
-std::array<float,2>{0.216611162f, 0.535457909f},
-std::array<float,2>{0.49605161f, 0.0693811178f},
-std::array<float,2>{0.500940859f, 0.896434188f},
-std::array<float,2>{0.717900038f, 0.229831308f},
-std::array<float,2>{0.262335777f, 0.849374056f},
-std::array<float,2>{0.0442424901f, 0.366157353f},
-std::array<float,2>{0.828628063f, 0.735418916f},
-std::array<float,2>{0.728154659f, 0.351181924f},
-std::array<float,2>{0.306754589f, 0.724994481f},
-std::array<float,2>{0.0295665786f, 0.240345225f},
-std::array<float,2>{0.853743374f, 0.873015106f},
-std::array<float,2>{0.901517868f, 0.0796486288f},
-std::array<float,2>{0.242386296f, 0.875480056f},
-std::array<float,2>{0.447553426f, 0.427427888f},
-std::array<float,2>{0.531622052f, 0.562460542f},
-std::array<float,2>{0.776607931f, 0.461732358f},
-std::array<float,2>{0.0995090231f, 0.568061352f},
-std::array<float,2>{0.358649462f, 0.0190282147f},
-std::array<float,2>{0.632443964f, 0.990735114f},
-std::array<float,2>{0.562933147f, 0.184836209f},
-std::array<float,2>{0.437032282f, 0.78206569f},
-std::array<float,2>{0.139008507f, 0.307467937f},
-std::array<float,2>{0.943211854f, 0.626647294f},
-std::array<float,2>{0.517756939f, 0.404523581f},
-std::array<float,2>{0.479222119f, 0.510279775f},
-std::array<float,2>{0.193686128f, 0.121131226f},
-std::array<float,2>{0.916150153f, 0.926519752f},
-std::array<float,2>{0.819421172f, 0.19854486f},
-std::array<float,2>{0.0477194563f, 0.828405857f},
-std::array<float,2>{0.276679099f, 0.334526122f},
-std::array<float,2>{0.690178931f, 0.710054517f},
-std::array<float,2>{0.971184433f, 0.264598966f},
-std::array<float,2>{0.157224447f, 0.660749853f},
-std::array<float,2>{0.399234951f, 0.140142173f},
-std::array<float,2>{0.609882951f, 0.780993283f},
-std::array<float,2>{0.674667358f, 0.0371076651f},
-std::array<float,2>{0.33939141f, 0.963906527f},
-std::array<float,2>{0.0842183158f, 0.494336426f},
-std::array<float,2>{0.794296622f, 0.611311913f},
-std::array<float,2>{0.70294255f, 0.432068944f},
-std::array<float,2>{0.266638935f, 0.554552495f},
-std::array<float,2>{0.0589291826f, 0.0909775272f},
-std::array<float,2>{0.82757467f, 0.885142446f},
-std::array<float,2>{0.910931289f, 0.24924916f},
-std::array<float,2>{0.201698184f, 0.863746285f},
-std::array<float,2>{0.469475865f, 0.355066866f},
-std::array<float,2>{0.530121565f, 0.732018709f},
-std::array<float,2>{0.785004318f, 0.301208109f},
-std::array<float,2>{0.0867995918f, 0.638764262f},
-std::array<float,2>{0.332227916f, 0.177490845f},
-std::array<float,2>{0.681260765f, 0.791371226f},
-std::array<float,2>{0.619169116f, 0.0285558011f},
-std::array<float,2>{0.397627115f, 0.994836271f},
-std::array<float,2>{0.165418476f, 0.458274186f},
-std::array<float,2>{0.98346287f, 0.575748265f},
-std::array<float,2>{0.541688859f, 0.342472613f},
-std::array<float,2>{0.438526034f, 0.711396635f},
-std::array<float,2>{0.235179856f, 0.194063708f},
-std::array<float,2>{0.895875752f, 0.841003895f},
-std::array<float,2>{0.844668984f, 0.113743559f},
-std::array<float,2>{0.0205254667f, 0.936285019f},
-std::array<float,2>{0.302646339f, 0.391615629f},
-std::array<float,2>{0.719279885f, 0.500907779f},
-std::array<float,2>{0.951492429f, 0.491623551f},
-std::array<float,2>{0.129298642f, 0.6187374f},
-std::array<float,2>{0.427884072f, 0.0449034795f},
-std::array<float,2>{0.575974584f, 0.958014905f},
-std::array<float,2>{0.636540174f, 0.131980136f},
-std::array<float,2>{0.351227224f, 0.772569716f},
-std::array<float,2>{0.104823276f, 0.251984507f},
-std::array<float,2>{0.772058249f, 0.669213295f},
-std::array<float,2>{0.661788344f, 0.28115049f},
-std::array<float,2>{0.32765466f, 0.681123316f},
-std::array<float,2>{0.0759258568f, 0.143589154f},
-std::array<float,2>{0.803283036f, 0.762037218f},
-std::array<float,2>{0.993435621f, 0.0504575409f},
-std::array<float,2>{0.175577104f, 0.946756005f},
-std::array<float,2>{0.375597477f, 0.478877664f},
-std::array<float,2>{0.604568064f, 0.602981269f},
-std::array<float,2>{0.839064717f, 0.389406174f},
-std::array<float,2>{0.0331725441f, 0.518036425f},
-std::array<float,2>{0.256592572f, 0.107674189f},
-std::array<float,2>{0.70960629f, 0.918630362f},
-std::array<float,2>{0.512823701f, 0.214474663f},
-std::array<float,2>{0.484383762f, 0.81946373f},
-std::array<float,2>{0.206457824f, 0.318407148f},
-std::array<float,2>{0.92684269f, 0.697990954f},
-std::array<float,2>{0.582685113f, 0.438079983f},
-std::array<float,2>{0.414729625f, 0.581232786f},
-std::array<float,2>{0.142451376f, 0.0137863867f},
-std::array<float,2>{0.961245596f, 0.984012008f},
-std::array<float,2>{0.750518382f, 0.169581816f},
-std::array<float,2>{0.117639333f, 0.798073888f},
-std::array<float,2>{0.370063633f, 0.296307296f},
-std::array<float,2>{0.642809629f, 0.648983717f},
-std::array<float,2>{0.887601733f, 0.371566981f},
-std::array<float,2>{0.228546485f, 0.742788076f},
-std::array<float,2>{0.456905991f, 0.22431539f},
-std::array<float,2>{0.555454075f, 0.852443099f},
-std::array<float,2>{0.747419894f, 0.0728620961f},
-std::array<float,2>{0.292991996f, 0.901009023f},
-std::array<float,2>{0.00817134976f, 0.416408122f},
-std::array<float,2>{0.873622715f, 0.544053495f},
-std::array<float,2>{0.733105719f, 0.482023805f},
-std::array<float,2>{0.309813231f, 0.607246041f},
-std::array<float,2>{0.0257955212f, 0.0512791798f},
-std::array<float,2>{0.855767787f, 0.951497138f},
-std::array<float,2>{0.902894378f, 0.148097128f},
-std::array<float,2>{0.24883166f, 0.760890841f},
-std::array<float,2>{0.44999519f, 0.274125487f},
-std::array<float,2>{0.537426472f, 0.683686256f},
-std::array<float,2>{0.780676544f, 0.312587678f},
-std::array<float,2>{0.0943263024f, 0.701844752f},
-std::array<float,2>{0.35222882f, 0.215956539f},
-std::array<float,2>{0.627693117f, 0.812860131f},
-std::array<float,2>{0.569904089f, 0.10238263f},
-std::array<float,2>{0.432371914f, 0.917045236f},
-std::array<float,2>{0.135565102f, 0.384155035f},
-std::array<float,2>{0.939958036f, 0.521038294f},
-std::array<float,2>{0.521455944f, 0.290280938f},
-std::array<float,2>{0.481907964f, 0.653217137f},
-std::array<float,2>{0.188075691f, 0.165328607f},
-std::array<float,2>{0.918680847f, 0.804395378f},
-std::array<float,2>{0.813763022f, 0.0114624333f},
-std::array<float,2>{0.0526912324f, 0.977936029f},
-std::array<float,2>{0.279660761f, 0.442783087f},
-std::array<float,2>{0.693551719f, 0.584383547f},
-std::array<float,2>{0.974845588f, 0.419534862f},
-std::array<float,2>{0.160260335f, 0.541372478f},
-std::array<float,2>{0.402698338f, 0.0751050711f},
-std::array<float,2>{0.616811812f, 0.905979395f},
-std::array<float,2>{0.678044736f, 0.222400859f},
-std::array<float,2>{0.343551695f, 0.856737256f},
-std::array<float,2>{0.0788985714f, 0.370768666f},
-std::array<float,2>{0.790139973f, 0.747499347f},
-std::array<float,2>{0.648448646f, 0.357105881f},
-std::array<float,2>{0.360113055f, 0.726824462f},
-std::array<float,2>{0.115311332f, 0.242983907f},
-std::array<float,2>{0.759905875f, 0.862780988f},
-std::array<float,2>{0.954442322f, 0.0860895291f},
-std::array<float,2>{0.152255148f, 0.890452206f},
-std::array<float,2>{0.412296683f, 0.436785966f},
-std::array<float,2>{0.592261553f, 0.547831059f},
-std::array<float,2>{0.86532861f, 0.45578602f},
-std::array<float,2>{0.000241996808f, 0.572128713f},
-std::array<float,2>{0.28724134f, 0.0262095779f},
-std::array<float,2>{0.739789069f, 0.997600675f},
-std::array<float,2>{0.547949493f, 0.175638929f},
-std::array<float,2>{0.46318385f, 0.794894934f},
-std::array<float,2>{0.224796504f, 0.29719305f},
-std::array<float,2>{0.875762701f, 0.635408461f},
-std::array<float,2>{0.596328855f, 0.397690624f},
-std::array<float,2>{0.384070754f, 0.505207539f},
-std::array<float,2>{0.185012311f, 0.112938106f},
-std::array<float,2>{0.984501004f, 0.930946469f},
-std::array<float,2>{0.806308329f, 0.187839404f},
-std::array<float,2>{0.0665604621f, 0.8395468f},
-std::array<float,2>{0.320299894f, 0.337309897f},
-std::array<float,2>{0.671713114f, 0.715398312f},
-std::array<float,2>{0.933908641f, 0.254533559f},
-std::array<float,2>{0.211856335f, 0.66406709f},
-std::array<float,2>{0.499415666f, 0.127304688f},
-std::array<float,2>{0.507614613f, 0.768132448f},
-std::array<float,2>{0.714184999f, 0.0402937122f},
-std::array<float,2>{0.259742975f, 0.953729033f},
-std::array<float,2>{0.0418974347f, 0.486253977f},
-std::array<float,2>{0.833081126f, 0.623572886f},
-std::array<float,2>{0.656668901f, 0.424544007f},
-std::array<float,2>{0.323583752f, 0.557493389f},
-std::array<float,2>{0.0731152967f, 0.0821631178f},
-std::array<float,2>{0.799337804f, 0.880941451f},
-std::array<float,2>{0.998000681f, 0.237850547f},
-std::array<float,2>{0.178788617f, 0.871030569f},
-std::array<float,2>{0.381553173f, 0.344896197f},
-std::array<float,2>{0.607930303f, 0.719480038f},
-std::array<float,2>{0.840589285f, 0.31237936f},
-std::array<float,2>{0.0354226306f, 0.628949881f},
-std::array<float,2>{0.251720786f, 0.180096626f},
-std::array<float,2>{0.70372051f, 0.787572443f},
-std::array<float,2>{0.509918928f, 0.0226381179f},
-std::array<float,2>{0.489924252f, 0.984874904f},
-std::array<float,2>{0.208209053f, 0.466073066f},
-std::array<float,2>{0.923164964f, 0.564751685f},
-std::array<float,2>{0.578496933f, 0.328850389f},
-std::array<float,2>{0.419552475f, 0.70421207f},
-std::array<float,2>{0.146429569f, 0.201754957f},
-std::array<float,2>{0.965693593f, 0.832383096f},
-std::array<float,2>{0.754534304f, 0.119562984f},
-std::array<float,2>{0.122242734f, 0.925385535f},
-std::array<float,2>{0.373575002f, 0.401544452f},
-std::array<float,2>{0.64700973f, 0.515444398f},
-std::array<float,2>{0.884061575f, 0.496264875f},
-std::array<float,2>{0.231221288f, 0.616259813f},
-std::array<float,2>{0.459261626f, 0.0346338376f},
-std::array<float,2>{0.558675051f, 0.965980589f},
-std::array<float,2>{0.742707074f, 0.134221867f},
-std::array<float,2>{0.292094469f, 0.774616241f},
-std::array<float,2>{0.0129234642f, 0.260396153f},
-std::array<float,2>{0.870256543f, 0.657656372f},
-std::array<float,2>{0.697452128f, 0.268962681f},
-std::array<float,2>{0.272440016f, 0.672448695f},
-std::array<float,2>{0.054771591f, 0.155791119f},
-std::array<float,2>{0.823931456f, 0.756609559f},
-std::array<float,2>{0.906374872f, 0.0581741035f},
-std::array<float,2>{0.196976408f, 0.943464696f},
-std::array<float,2>{0.47408554f, 0.474358737f},
-std::array<float,2>{0.523816645f, 0.59453392f},
-std::array<float,2>{0.788795829f, 0.376001924f},
-std::array<float,2>{0.090084672f, 0.525076926f},
-std::array<float,2>{0.329459548f, 0.100071527f},
-std::array<float,2>{0.685136616f, 0.913167477f},
-std::array<float,2>{0.623364866f, 0.206897274f},
-std::array<float,2>{0.392866045f, 0.827811778f},
-std::array<float,2>{0.171142206f, 0.32768321f},
-std::array<float,2>{0.977223516f, 0.688957453f},
-std::array<float,2>{0.545236111f, 0.451676518f},
-std::array<float,2>{0.443131328f, 0.587089777f},
-std::array<float,2>{0.238638923f, 0.00680953125f},
-std::array<float,2>{0.891620576f, 0.969544411f},
-std::array<float,2>{0.851167977f, 0.157411322f},
-std::array<float,2>{0.0193788856f, 0.807471156f},
-std::array<float,2>{0.300156862f, 0.286332726f},
-std::array<float,2>{0.724357069f, 0.643270314f},
-std::array<float,2>{0.948961318f, 0.359822422f},
-std::array<float,2>{0.128753319f, 0.741999984f},
-std::array<float,2>{0.425364107f, 0.233946785f},
-std::array<float,2>{0.570366085f, 0.843996286f},
-std::array<float,2>{0.640050232f, 0.0652480051f},
-std::array<float,2>{0.344163835f, 0.892935097f},
-std::array<float,2>{0.107872181f, 0.409722924f},
-std::array<float,2>{0.768983483f, 0.533999622f},
-std::array<float,2>{0.631188452f, 0.464042485f},
-std::array<float,2>{0.358345032f, 0.568961143f},
-std::array<float,2>{0.0986230597f, 0.0160791241f},
-std::array<float,2>{0.775944769f, 0.989385962f},
-std::array<float,2>{0.941439688f, 0.185824826f},
-std::array<float,2>{0.139973432f, 0.783962131f},
-std::array<float,2>{0.435913414f, 0.305309802f},
-std::array<float,2>{0.563526928f, 0.628888428f},
-std::array<float,2>{0.854562044f, 0.348013669f},
-std::array<float,2>{0.0309800152f, 0.722741961f},
-std::array<float,2>{0.307745636f, 0.239173129f},
-std::array<float,2>{0.727244914f, 0.874964476f},
-std::array<float,2>{0.532693028f, 0.0807223842f},
-std::array<float,2>{0.448706716f, 0.87806505f},
-std::array<float,2>{0.243405685f, 0.428497821f},
-std::array<float,2>{0.901186943f, 0.559034467f},
-std::array<float,2>{0.610803187f, 0.261946738f},
-std::array<float,2>{0.399515718f, 0.663205147f},
-std::array<float,2>{0.157429487f, 0.137916863f},
-std::array<float,2>{0.972620845f, 0.778553307f},
-std::array<float,2>{0.793750346f, 0.0387840495f},
-std::array<float,2>{0.0851881057f, 0.962678313f},
-std::array<float,2>{0.338302284f, 0.493632764f},
-std::array<float,2>{0.675391197f, 0.611698329f},
-std::array<float,2>{0.917453289f, 0.402885199f},
-std::array<float,2>{0.19492048f, 0.508930743f},
-std::array<float,2>{0.479501724f, 0.123593763f},
-std::array<float,2>{0.519141674f, 0.929611087f},
-std::array<float,2>{0.691358864f, 0.196340859f},
-std::array<float,2>{0.275933385f, 0.830751956f},
-std::array<float,2>{0.0487642139f, 0.332662404f},
-std::array<float,2>{0.818696439f, 0.707431376f},
-std::array<float,2>{0.735646367f, 0.32141009f},
-std::array<float,2>{0.282262623f, 0.691420317f},
-std::array<float,2>{0.00659686839f, 0.208364621f},
-std::array<float,2>{0.860315442f, 0.821728766f},
-std::array<float,2>{0.882272422f, 0.0969601944f},
-std::array<float,2>{0.218805254f, 0.90709281f},
-std::array<float,2>{0.467641711f, 0.382517725f},
-std::array<float,2>{0.554565728f, 0.529093087f},
-std::array<float,2>{0.764563918f, 0.472063631f},
-std::array<float,2>{0.113041945f, 0.59962815f},
-std::array<float,2>{0.36608234f, 0.0606929064f},
-std::array<float,2>{0.653472722f, 0.940250933f},
-std::array<float,2>{0.588932931f, 0.149964213f},
-std::array<float,2>{0.406902879f, 0.750767827f},
-std::array<float,2>{0.154559329f, 0.270076692f},
-std::array<float,2>{0.957716703f, 0.676227927f},
-std::array<float,2>{0.501042664f, 0.413694054f},
-std::array<float,2>{0.494250298f, 0.538915217f},
-std::array<float,2>{0.21551311f, 0.067120336f},
-std::array<float,2>{0.93198514f, 0.896721065f},
-std::array<float,2>{0.829101861f, 0.227498591f},
-std::array<float,2>{0.0433927812f, 0.850858688f},
-std::array<float,2>{0.263575554f, 0.364631623f},
-std::array<float,2>{0.71776849f, 0.737358332f},
-std::array<float,2>{0.988388002f, 0.284252375f},
-std::array<float,2>{0.182085395f, 0.647585034f},
-std::array<float,2>{0.388236403f, 0.162042052f},
-std::array<float,2>{0.600386918f, 0.809703708f},
-std::array<float,2>{0.666103303f, 0.00240193726f},
-std::array<float,2>{0.314813703f, 0.974235177f},
-std::array<float,2>{0.0642800704f, 0.447814703f},
-std::array<float,2>{0.80859828f, 0.591795683f},
-std::array<float,2>{0.710312903f, 0.38755244f},
-std::array<float,2>{0.257582575f, 0.516709685f},
-std::array<float,2>{0.0322262682f, 0.106622972f},
-std::array<float,2>{0.83867079f, 0.92161113f},
-std::array<float,2>{0.926634014f, 0.211424857f},
-std::array<float,2>{0.205142677f, 0.81717211f},
-std::array<float,2>{0.485895991f, 0.316527069f},
-std::array<float,2>{0.512191474f, 0.697252512f},
-std::array<float,2>{0.8042503f, 0.27766794f},
-std::array<float,2>{0.0746766701f, 0.682903349f},
-std::array<float,2>{0.326779425f, 0.142339617f},
-std::array<float,2>{0.661002755f, 0.764527082f},
-std::array<float,2>{0.604012191f, 0.0475915335f},
-std::array<float,2>{0.376884967f, 0.948879719f},
-std::array<float,2>{0.173952132f, 0.477579325f},
-std::array<float,2>{0.992438138f, 0.6049124f},
-std::array<float,2>{0.555691421f, 0.374808967f},
-std::array<float,2>{0.455603719f, 0.745853007f},
-std::array<float,2>{0.230124861f, 0.225069687f},
-std::array<float,2>{0.88810426f, 0.855082333f},
-std::array<float,2>{0.874306798f, 0.0708296373f},
-std::array<float,2>{0.00891561806f, 0.89873904f},
-std::array<float,2>{0.294524223f, 0.414514393f},
-std::array<float,2>{0.746719658f, 0.545099378f},
-std::array<float,2>{0.962191582f, 0.440011829f},
-std::array<float,2>{0.140730217f, 0.578151762f},
-std::array<float,2>{0.415888846f, 0.013422288f},
-std::array<float,2>{0.583320081f, 0.982180595f},
-std::array<float,2>{0.644382238f, 0.170261964f},
-std::array<float,2>{0.370452076f, 0.799057424f},
-std::array<float,2>{0.118948922f, 0.294493407f},
-std::array<float,2>{0.750980914f, 0.651324034f},
-std::array<float,2>{0.680219412f, 0.303408176f},
-std::array<float,2>{0.333610594f, 0.636855185f},
-std::array<float,2>{0.0869515762f, 0.178247571f},
-std::array<float,2>{0.784108996f, 0.790378213f},
-std::array<float,2>{0.982705832f, 0.0310926307f},
-std::array<float,2>{0.164532691f, 0.992803156f},
-std::array<float,2>{0.397201598f, 0.459821224f},
-std::array<float,2>{0.620985925f, 0.576762438f},
-std::array<float,2>{0.826812148f, 0.430414289f},
-std::array<float,2>{0.0603620932f, 0.55090487f},
-std::array<float,2>{0.266450524f, 0.0928388834f},
-std::array<float,2>{0.701424956f, 0.884723127f},
-std::array<float,2>{0.530447841f, 0.246183619f},
-std::array<float,2>{0.470661938f, 0.86632055f},
-std::array<float,2>{0.202827588f, 0.352911949f},
-std::array<float,2>{0.911922812f, 0.732656956f},
-std::array<float,2>{0.574377835f, 0.48975578f},
-std::array<float,2>{0.429327637f, 0.619217217f},
-std::array<float,2>{0.130832911f, 0.0460013524f},
-std::array<float,2>{0.952724576f, 0.96015799f},
-std::array<float,2>{0.773414493f, 0.130707964f},
-std::array<float,2>{0.103745192f, 0.771223187f},
-std::array<float,2>{0.350145042f, 0.250213921f},
-std::array<float,2>{0.634925842f, 0.671855807f},
-std::array<float,2>{0.894791961f, 0.341573536f},
-std::array<float,2>{0.236015052f, 0.714349806f},
-std::array<float,2>{0.437887043f, 0.193129212f},
-std::array<float,2>{0.542946458f, 0.842640221f},
-std::array<float,2>{0.71988827f, 0.115461513f},
-std::array<float,2>{0.301660091f, 0.934577048f},
-std::array<float,2>{0.020164961f, 0.394169271f},
-std::array<float,2>{0.844843566f, 0.502580583f},
-std::array<float,2>{0.692151904f, 0.443601996f},
-std::array<float,2>{0.278634846f, 0.582190812f},
-std::array<float,2>{0.0529122539f, 0.00961654633f},
-std::array<float,2>{0.815987766f, 0.979276776f},
-std::array<float,2>{0.921053946f, 0.167277619f},
-std::array<float,2>{0.191378057f, 0.802350521f},
-std::array<float,2>{0.483354181f, 0.291575998f},
-std::array<float,2>{0.522502184f, 0.655191302f},
-std::array<float,2>{0.791406214f, 0.367768973f},
-std::array<float,2>{0.0816845968f, 0.748179376f},
-std::array<float,2>{0.341008037f, 0.2202117f},
-std::array<float,2>{0.676501215f, 0.859030604f},
-std::array<float,2>{0.615154326f, 0.0762293413f},
-std::array<float,2>{0.40588516f, 0.902993977f},
-std::array<float,2>{0.163958192f, 0.421338648f},
-std::array<float,2>{0.973846316f, 0.539523959f},
-std::array<float,2>{0.535707653f, 0.276542962f},
-std::array<float,2>{0.452882171f, 0.686967552f},
-std::array<float,2>{0.247460783f, 0.146354526f},
-std::array<float,2>{0.904301941f, 0.758635879f},
-std::array<float,2>{0.857566833f, 0.0531343482f},
-std::array<float,2>{0.0241437629f, 0.949376464f},
-std::array<float,2>{0.310708612f, 0.484276682f},
-std::array<float,2>{0.731615603f, 0.608338177f},
-std::array<float,2>{0.939226151f, 0.385274947f},
-std::array<float,2>{0.13372393f, 0.522295475f},
-std::array<float,2>{0.43116343f, 0.103987738f},
-std::array<float,2>{0.567060947f, 0.914072514f},
-std::array<float,2>{0.626542151f, 0.217062101f},
-std::array<float,2>{0.354869932f, 0.814652383f},
-std::array<float,2>{0.097138755f, 0.316253841f},
-std::array<float,2>{0.778629005f, 0.699527681f},
-std::array<float,2>{0.669874966f, 0.338425964f},
-std::array<float,2>{0.316489518f, 0.717060506f},
-std::array<float,2>{0.069069609f, 0.190108061f},
-std::array<float,2>{0.808011115f, 0.836234868f},
-std::array<float,2>{0.9865219f, 0.109856457f},
-std::array<float,2>{0.185739756f, 0.933513343f},
-std::array<float,2>{0.38477388f, 0.396479398f},
-std::array<float,2>{0.594949186f, 0.506474674f},
-std::array<float,2>{0.834920049f, 0.488227934f},
-std::array<float,2>{0.0408284441f, 0.622741044f},
-std::array<float,2>{0.260043114f, 0.0410695225f},
-std::array<float,2>{0.712032974f, 0.956687272f},
-std::array<float,2>{0.505548537f, 0.125595704f},
-std::array<float,2>{0.496569455f, 0.766385615f},
-std::array<float,2>{0.213009f, 0.256457955f},
-std::array<float,2>{0.936375916f, 0.666749895f},
-std::array<float,2>{0.590215981f, 0.434494674f},
-std::array<float,2>{0.411541224f, 0.550382495f},
-std::array<float,2>{0.149669841f, 0.0896686018f},
-std::array<float,2>{0.955507815f, 0.888584375f},
-std::array<float,2>{0.75844115f, 0.245037019f},
-std::array<float,2>{0.113587834f, 0.861170232f},
-std::array<float,2>{0.362704962f, 0.357870728f},
-std::array<float,2>{0.650446177f, 0.728796005f},
-std::array<float,2>{0.877082169f, 0.299359351f},
-std::array<float,2>{0.223670527f, 0.63457042f},
-std::array<float,2>{0.461772054f, 0.172236025f},
-std::array<float,2>{0.549891949f, 0.795358539f},
-std::array<float,2>{0.740294874f, 0.0240983237f},
-std::array<float,2>{0.286961079f, 0.998985827f},
-std::array<float,2>{0.00318536023f, 0.454933345f},
-std::array<float,2>{0.865024447f, 0.574200451f},
-std::array<float,2>{0.644693315f, 0.399141669f},
-std::array<float,2>{0.372686982f, 0.513204515f},
-std::array<float,2>{0.124767378f, 0.117930263f},
-std::array<float,2>{0.756431103f, 0.923122108f},
-std::array<float,2>{0.967970788f, 0.201062828f},
-std::array<float,2>{0.148176342f, 0.835227907f},
-std::array<float,2>{0.420884013f, 0.330362648f},
-std::array<float,2>{0.580280542f, 0.706207633f},
-std::array<float,2>{0.869133651f, 0.258809417f},
-std::array<float,2>{0.0141324811f, 0.658937216f},
-std::array<float,2>{0.290324718f, 0.13580054f},
-std::array<float,2>{0.745130897f, 0.777090251f},
-std::array<float,2>{0.560979426f, 0.0324163176f},
-std::array<float,2>{0.458957791f, 0.967790008f},
-std::array<float,2>{0.234193325f, 0.498730212f},
-std::array<float,2>{0.884861052f, 0.613311052f},
-std::array<float,2>{0.607051313f, 0.346051008f},
-std::array<float,2>{0.379504114f, 0.722547948f},
-std::array<float,2>{0.176095888f, 0.235699177f},
-std::array<float,2>{0.998345554f, 0.867190182f},
-std::array<float,2>{0.798708916f, 0.0839872509f},
-std::array<float,2>{0.0719309002f, 0.879313707f},
-std::array<float,2>{0.321472853f, 0.423572421f},
-std::array<float,2>{0.658681691f, 0.554807007f},
-std::array<float,2>{0.923914373f, 0.46798861f},
-std::array<float,2>{0.210251585f, 0.56444025f},
-std::array<float,2>{0.491090178f, 0.020303918f},
-std::array<float,2>{0.508954287f, 0.988013744f},
-std::array<float,2>{0.706715822f, 0.182176769f},
-std::array<float,2>{0.252020657f, 0.785820186f},
-std::array<float,2>{0.0383729786f, 0.309048563f},
-std::array<float,2>{0.842900097f, 0.631793082f},
-std::array<float,2>{0.725385666f, 0.287352473f},
-std::array<float,2>{0.296936125f, 0.640844166f},
-std::array<float,2>{0.0164015871f, 0.158964187f},
-std::array<float,2>{0.848855019f, 0.806625843f},
-std::array<float,2>{0.894312024f, 0.00452333409f},
-std::array<float,2>{0.242062211f, 0.971315265f},
-std::array<float,2>{0.444746822f, 0.449779332f},
-std::array<float,2>{0.543989122f, 0.589502931f},
-std::array<float,2>{0.76651454f, 0.4079732f},
-std::array<float,2>{0.107326239f, 0.533048749f},
-std::array<float,2>{0.346891522f, 0.0635911077f},
-std::array<float,2>{0.637619555f, 0.892337084f},
-std::array<float,2>{0.572797596f, 0.231711358f},
-std::array<float,2>{0.423797935f, 0.847310424f},
-std::array<float,2>{0.126719892f, 0.363012433f},
-std::array<float,2>{0.94653064f, 0.738668084f},
-std::array<float,2>{0.526504517f, 0.476240456f},
-std::array<float,2>{0.475653499f, 0.596629262f},
-std::array<float,2>{0.197501361f, 0.056056425f},
-std::array<float,2>{0.909421086f, 0.943153918f},
-std::array<float,2>{0.822179675f, 0.153870359f},
-std::array<float,2>{0.0575123802f, 0.755250335f},
-std::array<float,2>{0.27115339f, 0.266098797f},
-std::array<float,2>{0.695471764f, 0.674321234f},
-std::array<float,2>{0.978900075f, 0.325684786f},
-std::array<float,2>{0.168559089f, 0.689951301f},
-std::array<float,2>{0.390669793f, 0.203809142f},
-std::array<float,2>{0.622525275f, 0.824963868f},
-std::array<float,2>{0.686719656f, 0.0990046933f},
-std::array<float,2>{0.331286758f, 0.911127388f},
-std::array<float,2>{0.09227819f, 0.377631605f},
-std::array<float,2>{0.786678135f, 0.525856316f},
-std::array<float,2>{0.67293179f, 0.495305687f},
-std::array<float,2>{0.337237626f, 0.609902084f},
-std::array<float,2>{0.0838982388f, 0.0357408859f},
-std::array<float,2>{0.79581511f, 0.963086367f},
-std::array<float,2>{0.96989435f, 0.138853759f},
-std::array<float,2>{0.158216149f, 0.779558122f},
-std::array<float,2>{0.400713831f, 0.264863312f},
-std::array<float,2>{0.611669183f, 0.661890268f},
-std::array<float,2>{0.816522837f, 0.335233629f},
-std::array<float,2>{0.0505894236f, 0.70913893f},
-std::array<float,2>{0.27344051f, 0.197695166f},
-std::array<float,2>{0.688071072f, 0.829843283f},
-std::array<float,2>{0.516020179f, 0.122107878f},
-std::array<float,2>{0.478087932f, 0.927534282f},
-std::array<float,2>{0.193021134f, 0.406210184f},
-std::array<float,2>{0.914139748f, 0.511029482f},
-std::array<float,2>{0.565169394f, 0.308124542f},
-std::array<float,2>{0.435411334f, 0.625396848f},
-std::array<float,2>{0.138547912f, 0.183813512f},
-std::array<float,2>{0.944175482f, 0.782502651f},
-std::array<float,2>{0.774661124f, 0.0184366181f},
-std::array<float,2>{0.100999735f, 0.99191153f},
-std::array<float,2>{0.355972975f, 0.462224483f},
-std::array<float,2>{0.629789531f, 0.567243695f},
-std::array<float,2>{0.899808288f, 0.426132977f},
-std::array<float,2>{0.245284393f, 0.561384499f},
-std::array<float,2>{0.445615768f, 0.0789985657f},
-std::array<float,2>{0.534866869f, 0.876616597f},
-std::array<float,2>{0.72984165f, 0.241573796f},
-std::array<float,2>{0.30646044f, 0.871106148f},
-std::array<float,2>{0.0289178807f, 0.349921525f},
-std::array<float,2>{0.853308082f, 0.726192474f},
-std::array<float,2>{0.715608776f, 0.367087007f},
-std::array<float,2>{0.264880359f, 0.734572589f},
-std::array<float,2>{0.0458052568f, 0.228726223f},
-std::array<float,2>{0.830413759f, 0.847707152f},
-std::array<float,2>{0.930276811f, 0.0689579695f},
-std::array<float,2>{0.218124315f, 0.895497561f},
-std::array<float,2>{0.493356019f, 0.411883652f},
-std::array<float,2>{0.503738821f, 0.536233127f},
-std::array<float,2>{0.811915457f, 0.446102768f},
-std::array<float,2>{0.0661341101f, 0.592312872f},
-std::array<float,2>{0.314279407f, 0.00149398332f},
-std::array<float,2>{0.664526343f, 0.97552228f},
-std::array<float,2>{0.598634601f, 0.16389291f},
-std::array<float,2>{0.389472485f, 0.812158823f},
-std::array<float,2>{0.181409463f, 0.281321496f},
-std::array<float,2>{0.991803765f, 0.645054281f},
-std::array<float,2>{0.551764309f, 0.380040646f},
-std::array<float,2>{0.465400934f, 0.530013621f},
-std::array<float,2>{0.222391322f, 0.0943569019f},
-std::array<float,2>{0.879467607f, 0.90999949f},
-std::array<float,2>{0.861696541f, 0.210036397f},
-std::array<float,2>{0.00397011591f, 0.822368264f},
-std::array<float,2>{0.284997553f, 0.323574692f},
-std::array<float,2>{0.736620367f, 0.694770694f},
-std::array<float,2>{0.959932804f, 0.273368537f},
-std::array<float,2>{0.15395245f, 0.677797675f},
-std::array<float,2>{0.408905149f, 0.150521874f},
-std::array<float,2>{0.586010754f, 0.75332731f},
-std::array<float,2>{0.654989123f, 0.059961345f},
-std::array<float,2>{0.365033239f, 0.938829899f},
-std::array<float,2>{0.110950015f, 0.470210016f},
-std::array<float,2>{0.762916625f, 0.599187613f},
-std::array<float,2>{0.749078512f, 0.417946219f},
-std::array<float,2>{0.296423584f, 0.54345566f},
-std::array<float,2>{0.0100808358f, 0.0733649284f},
-std::array<float,2>{0.872979164f, 0.902017713f},
-std::array<float,2>{0.889382839f, 0.223250806f},
-std::array<float,2>{0.227476716f, 0.852636516f},
-std::array<float,2>{0.453785598f, 0.37247932f},
-std::array<float,2>{0.557241499f, 0.743308246f},
-std::array<float,2>{0.753674865f, 0.29493013f},
-std::array<float,2>{0.11920397f, 0.650118768f},
-std::array<float,2>{0.368932158f, 0.168890417f},
-std::array<float,2>{0.642304122f, 0.797420442f},
-std::array<float,2>{0.584824622f, 0.0152270794f},
-std::array<float,2>{0.417623371f, 0.982900202f},
-std::array<float,2>{0.142842799f, 0.438618749f},
-std::array<float,2>{0.96291405f, 0.580102801f},
-std::array<float,2>{0.514541686f, 0.319449514f},
-std::array<float,2>{0.487852454f, 0.699174702f},
-std::array<float,2>{0.204868987f, 0.213589936f},
-std::array<float,2>{0.927980065f, 0.818428874f},
-std::array<float,2>{0.8378793f, 0.108959846f},
-std::array<float,2>{0.0344616733f, 0.919725418f},
-std::array<float,2>{0.255585551f, 0.389736712f},
-std::array<float,2>{0.707848251f, 0.519257903f},
-std::array<float,2>{0.994843304f, 0.48026222f},
-std::array<float,2>{0.173015341f, 0.601886749f},
-std::array<float,2>{0.378582984f, 0.0489976406f},
-std::array<float,2>{0.602283657f, 0.945587575f},
-std::array<float,2>{0.663232088f, 0.142760798f},
-std::array<float,2>{0.324565619f, 0.763406336f},
-std::array<float,2>{0.0780863389f, 0.279348403f},
-std::array<float,2>{0.801968455f, 0.679979801f},
-std::array<float,2>{0.633595467f, 0.253122091f},
-std::array<float,2>{0.348161161f, 0.668512225f},
-std::array<float,2>{0.101573594f, 0.131622091f},
-std::array<float,2>{0.770940304f, 0.772120714f},
-std::array<float,2>{0.9510988f, 0.0439382941f},
-std::array<float,2>{0.132791728f, 0.957674086f},
-std::array<float,2>{0.425888032f, 0.490417898f},
-std::array<float,2>{0.578092217f, 0.61728847f},
-std::array<float,2>{0.846903741f, 0.391104311f},
-std::array<float,2>{0.0221869294f, 0.501662791f},
-std::array<float,2>{0.304055482f, 0.115134127f},
-std::array<float,2>{0.722518146f, 0.937163174f},
-std::array<float,2>{0.539845705f, 0.194925159f},
-std::array<float,2>{0.439813584f, 0.839925945f},
-std::array<float,2>{0.23643595f, 0.343490094f},
-std::array<float,2>{0.897608459f, 0.712137401f},
-std::array<float,2>{0.618320048f, 0.457361966f},
-std::array<float,2>{0.394628555f, 0.574252784f},
-std::array<float,2>{0.166365594f, 0.0282614063f},
-std::array<float,2>{0.980843604f, 0.995794594f},
-std::array<float,2>{0.781894863f, 0.175995156f},
-std::array<float,2>{0.0892810449f, 0.792002678f},
-std::array<float,2>{0.335614383f, 0.302431315f},
-std::array<float,2>{0.681972444f, 0.639889181f},
-std::array<float,2>{0.913752437f, 0.354052782f},
-std::array<float,2>{0.200748563f, 0.730666459f},
-std::array<float,2>{0.471317381f, 0.24865137f},
-std::array<float,2>{0.52783066f, 0.865102112f},
-std::array<float,2>{0.700037777f, 0.0899876654f},
-std::array<float,2>{0.268225461f, 0.886614859f},
-std::array<float,2>{0.0624339283f, 0.433036119f},
-std::array<float,2>{0.825148165f, 0.553032875f},
-std::array<float,2>{0.695910394f, 0.473869026f},
-std::array<float,2>{0.270758867f, 0.594090939f},
-std::array<float,2>{0.0567877218f, 0.0580043718f},
-std::array<float,2>{0.821675003f, 0.944051385f},
-std::array<float,2>{0.909918606f, 0.155719519f},
-std::array<float,2>{0.197942033f, 0.756308973f},
-std::array<float,2>{0.47645095f, 0.269355625f},
-std::array<float,2>{0.527012706f, 0.672317147f},
-std::array<float,2>{0.786184967f, 0.327220291f},
-std::array<float,2>{0.0924255103f, 0.689145744f},
-std::array<float,2>{0.33182627f, 0.206269115f},
-std::array<float,2>{0.687221467f, 0.827261746f},
-std::array<float,2>{0.622956634f, 0.100342311f},
-std::array<float,2>{0.39146024f, 0.91379863f},
-std::array<float,2>{0.168412223f, 0.376825809f},
-std::array<float,2>{0.979459167f, 0.524843276f},
-std::array<float,2>{0.544853687f, 0.287093163f},
-std::array<float,2>{0.445017219f, 0.642704606f},
-std::array<float,2>{0.24167636f, 0.157910362f},
-std::array<float,2>{0.893737853f, 0.806962848f},
-std::array<float,2>{0.849443853f, 0.00612101192f},
-std::array<float,2>{0.0156967808f, 0.968788147f},
-std::array<float,2>{0.297439009f, 0.45164749f},
-std::array<float,2>{0.724778116f, 0.58779335f},
-std::array<float,2>{0.947003782f, 0.409415036f},
-std::array<float,2>{0.126389176f, 0.533418298f},
-std::array<float,2>{0.42323783f, 0.0648335814f},
-std::array<float,2>{0.572482049f, 0.893415451f},
-std::array<float,2>{0.636874914f, 0.233607575f},
-std::array<float,2>{0.347547293f, 0.844589114f},
-std::array<float,2>{0.106882803f, 0.360202849f},
-std::array<float,2>{0.765794396f, 0.741422534f},
-std::array<float,2>{0.659052551f, 0.345480561f},
-std::array<float,2>{0.322021335f, 0.71921581f},
-std::array<float,2>{0.0713562518f, 0.237460166f},
-std::array<float,2>{0.798269391f, 0.870560348f},
-std::array<float,2>{0.998696387f, 0.0828248858f},
-std::array<float,2>{0.176422149f, 0.881612062f},
-std::array<float,2>{0.379291445f, 0.424271762f},
-std::array<float,2>{0.606798649f, 0.556787133f},
-std::array<float,2>{0.843295991f, 0.466658175f},
-std::array<float,2>{0.0388124734f, 0.565207124f},
-std::array<float,2>{0.252527982f, 0.0234251972f},
-std::array<float,2>{0.7063905f, 0.98481518f},
-std::array<float,2>{0.509583175f, 0.180602327f},
-std::array<float,2>{0.490480095f, 0.787963808f},
-std::array<float,2>{0.210811645f, 0.312010288f},
-std::array<float,2>{0.924405754f, 0.629629314f},
-std::array<float,2>{0.580831468f, 0.402287066f},
-std::array<float,2>{0.420334011f, 0.514781177f},
-std::array<float,2>{0.147859246f, 0.119734019f},
-std::array<float,2>{0.968532681f, 0.92487067f},
-std::array<float,2>{0.756251097f, 0.201456815f},
-std::array<float,2>{0.124215797f, 0.832831085f},
-std::array<float,2>{0.372121304f, 0.328566402f},
-std::array<float,2>{0.645145059f, 0.704937935f},
-std::array<float,2>{0.885332882f, 0.260156989f},
-std::array<float,2>{0.233611539f, 0.658111095f},
-std::array<float,2>{0.458349556f, 0.134525046f},
-std::array<float,2>{0.561356187f, 0.775014579f},
-std::array<float,2>{0.746020496f, 0.0348695926f},
-std::array<float,2>{0.290781558f, 0.966325164f},
-std::array<float,2>{0.0142952465f, 0.497001737f},
-std::array<float,2>{0.868454576f, 0.617048442f},
-std::array<float,2>{0.650943637f, 0.437144846f},
-std::array<float,2>{0.362824082f, 0.547080874f},
-std::array<float,2>{0.114237711f, 0.0864350572f},
-std::array<float,2>{0.758160472f, 0.890019f},
-std::array<float,2>{0.955824971f, 0.242575347f},
-std::array<float,2>{0.150105849f, 0.863124013f},
-std::array<float,2>{0.411979616f, 0.356687963f},
-std::array<float,2>{0.590744376f, 0.727122545f},
-std::array<float,2>{0.864662826f, 0.297786266f},
-std::array<float,2>{0.00369187398f, 0.635014951f},
-std::array<float,2>{0.286471307f, 0.175212294f},
-std::array<float,2>{0.740991831f, 0.794180691f},
-std::array<float,2>{0.550667048f, 0.0257589351f},
-std::array<float,2>{0.4613536f, 0.997104645f},
-std::array<float,2>{0.224326178f, 0.455444247f},
-std::array<float,2>{0.877731323f, 0.571591198f},
-std::array<float,2>{0.595424592f, 0.33763206f},
-std::array<float,2>{0.385393471f, 0.715260088f},
-std::array<float,2>{0.186098382f, 0.188254878f},
-std::array<float,2>{0.98716253f, 0.839034021f},
-std::array<float,2>{0.808412552f, 0.112741381f},
-std::array<float,2>{0.0687865242f, 0.931409359f},
-std::array<float,2>{0.31700179f, 0.398176789f},
-std::array<float,2>{0.66931349f, 0.505798697f},
-std::array<float,2>{0.935722113f, 0.485459059f},
-std::array<float,2>{0.21342127f, 0.623387635f},
-std::array<float,2>{0.496924609f, 0.0407927334f},
-std::array<float,2>{0.505148828f, 0.953470051f},
-std::array<float,2>{0.712739825f, 0.127575144f},
-std::array<float,2>{0.260654002f, 0.767806828f},
-std::array<float,2>{0.0401793271f, 0.254130483f},
-std::array<float,2>{0.834351659f, 0.66497165f},
-std::array<float,2>{0.732400775f, 0.273627192f},
-std::array<float,2>{0.31119138f, 0.684399903f},
-std::array<float,2>{0.0234722402f, 0.14776434f},
-std::array<float,2>{0.858151436f, 0.761698186f},
-std::array<float,2>{0.904790223f, 0.0512004681f},
-std::array<float,2>{0.247873247f, 0.95170188f},
-std::array<float,2>{0.452400118f, 0.481618196f},
-std::array<float,2>{0.535443008f, 0.606535375f},
-std::array<float,2>{0.779114783f, 0.384456515f},
-std::array<float,2>{0.0972218886f, 0.520598233f},
-std::array<float,2>{0.355436504f, 0.101811357f},
-std::array<float,2>{0.625998616f, 0.917481303f},
-std::array<float,2>{0.56678009f, 0.21633856f},
-std::array<float,2>{0.430785298f, 0.813243568f},
-std::array<float,2>{0.133024544f, 0.313463986f},
-std::array<float,2>{0.938592851f, 0.701310754f},
-std::array<float,2>{0.523371279f, 0.443034112f},
-std::array<float,2>{0.482886434f, 0.584626853f},
-std::array<float,2>{0.19091633f, 0.0108198253f},
-std::array<float,2>{0.921670437f, 0.978362262f},
-std::array<float,2>{0.815776467f, 0.165953696f},
-std::array<float,2>{0.0534672029f, 0.80395633f},
-std::array<float,2>{0.278862119f, 0.29071334f},
-std::array<float,2>{0.691589892f, 0.652756393f},
-std::array<float,2>{0.974274158f, 0.370503724f},
-std::array<float,2>{0.163467348f, 0.747622848f},
-std::array<float,2>{0.405329078f, 0.221734494f},
-std::array<float,2>{0.614601791f, 0.857114255f},
-std::array<float,2>{0.676211596f, 0.0745883733f},
-std::array<float,2>{0.341763437f, 0.905462086f},
-std::array<float,2>{0.0814290941f, 0.419317931f},
-std::array<float,2>{0.791534603f, 0.541770458f},
-std::array<float,2>{0.682504773f, 0.459093392f},
-std::array<float,2>{0.335042328f, 0.576245189f},
-std::array<float,2>{0.0898346975f, 0.0305264648f},
-std::array<float,2>{0.781406879f, 0.992401183f},
-std::array<float,2>{0.981221974f, 0.178065032f},
-std::array<float,2>{0.166687533f, 0.790677309f},
-std::array<float,2>{0.395098895f, 0.302919269f},
-std::array<float,2>{0.619017422f, 0.637299538f},
-std::array<float,2>{0.824552715f, 0.353273541f},
-std::array<float,2>{0.0617935583f, 0.733017623f},
-std::array<float,2>{0.267877549f, 0.246648312f},
-std::array<float,2>{0.69929266f, 0.866790056f},
-std::array<float,2>{0.528146982f, 0.0933401883f},
-std::array<float,2>{0.470820874f, 0.88398391f},
-std::array<float,2>{0.200459465f, 0.430143595f},
-std::array<float,2>{0.913548172f, 0.551719248f},
-std::array<float,2>{0.577548504f, 0.250972301f},
-std::array<float,2>{0.4263888f, 0.671284854f},
-std::array<float,2>{0.132287011f, 0.130344689f},
-std::array<float,2>{0.950269938f, 0.770810783f},
-std::array<float,2>{0.771246433f, 0.0466455817f},
-std::array<float,2>{0.102165557f, 0.960834265f},
-std::array<float,2>{0.348034263f, 0.489325285f},
-std::array<float,2>{0.633225918f, 0.619734526f},
-std::array<float,2>{0.898024321f, 0.393796235f},
-std::array<float,2>{0.237043679f, 0.502300084f},
-std::array<float,2>{0.440119892f, 0.115903981f},
-std::array<float,2>{0.539482534f, 0.935273767f},
-std::array<float,2>{0.722123504f, 0.192525104f},
-std::array<float,2>{0.304658681f, 0.84191215f},
-std::array<float,2>{0.0218638629f, 0.340853542f},
-std::array<float,2>{0.8474105f, 0.71464932f},
-std::array<float,2>{0.707428098f, 0.317316622f},
-std::array<float,2>{0.255123615f, 0.696290076f},
-std::array<float,2>{0.0350038148f, 0.211621359f},
-std::array<float,2>{0.837394953f, 0.816796958f},
-std::array<float,2>{0.928398669f, 0.106985338f},
-std::array<float,2>{0.204582825f, 0.921214819f},
-std::array<float,2>{0.487487733f, 0.387193263f},
-std::array<float,2>{0.514050245f, 0.517138839f},
-std::array<float,2>{0.802479088f, 0.478326887f},
-std::array<float,2>{0.077349171f, 0.605410933f},
-std::array<float,2>{0.32518819f, 0.0470401011f},
-std::array<float,2>{0.663824558f, 0.948572338f},
-std::array<float,2>{0.601610839f, 0.141738534f},
-std::array<float,2>{0.377977043f, 0.763682723f},
-std::array<float,2>{0.173714817f, 0.277980447f},
-std::array<float,2>{0.994520605f, 0.683291078f},
-std::array<float,2>{0.557018697f, 0.415036023f},
-std::array<float,2>{0.453398019f, 0.545855701f},
-std::array<float,2>{0.226653218f, 0.0705510825f},
-std::array<float,2>{0.888777316f, 0.899086416f},
-std::array<float,2>{0.872247815f, 0.225099161f},
-std::array<float,2>{0.0103515256f, 0.854964674f},
-std::array<float,2>{0.29622373f, 0.374260932f},
-std::array<float,2>{0.749995649f, 0.745222867f},
-std::array<float,2>{0.963522792f, 0.294394106f},
-std::array<float,2>{0.143338904f, 0.650781512f},
-std::array<float,2>{0.417180657f, 0.170436889f},
-std::array<float,2>{0.584358931f, 0.799522281f},
-std::array<float,2>{0.641825497f, 0.0127534568f},
-std::array<float,2>{0.368221462f, 0.981455088f},
-std::array<float,2>{0.119844317f, 0.439632982f},
-std::array<float,2>{0.753240108f, 0.578814805f},
-std::array<float,2>{0.736821413f, 0.382142872f},
-std::array<float,2>{0.284523427f, 0.528623521f},
-std::array<float,2>{0.00450253487f, 0.0971705317f},
-std::array<float,2>{0.862211049f, 0.906408608f},
-std::array<float,2>{0.879108429f, 0.208750069f},
-std::array<float,2>{0.222072557f, 0.822089374f},
-std::array<float,2>{0.465089679f, 0.322033316f},
-std::array<float,2>{0.552322447f, 0.692279279f},
-std::array<float,2>{0.763263047f, 0.26968202f},
-std::array<float,2>{0.110439293f, 0.676451266f},
-std::array<float,2>{0.36454919f, 0.149546087f},
-std::array<float,2>{0.654307961f, 0.750099897f},
-std::array<float,2>{0.586749732f, 0.0614349693f},
-std::array<float,2>{0.408478171f, 0.939529538f},
-std::array<float,2>{0.153785333f, 0.4724347f},
-std::array<float,2>{0.958998919f, 0.600554705f},
-std::array<float,2>{0.503196657f, 0.365037739f},
-std::array<float,2>{0.493657529f, 0.738264143f},
-std::array<float,2>{0.218364954f, 0.226599395f},
-std::array<float,2>{0.930108607f, 0.851527691f},
-std::array<float,2>{0.830702007f, 0.0665120631f},
-std::array<float,2>{0.0450478047f, 0.897091627f},
-std::array<float,2>{0.265554547f, 0.413127899f},
-std::array<float,2>{0.715134799f, 0.538161278f},
-std::array<float,2>{0.991356432f, 0.447464406f},
-std::array<float,2>{0.181009278f, 0.590827167f},
-std::array<float,2>{0.388934731f, 0.00258945534f},
-std::array<float,2>{0.59921217f, 0.973956585f},
-std::array<float,2>{0.664612532f, 0.161594123f},
-std::array<float,2>{0.313690722f, 0.810115993f},
-std::array<float,2>{0.0657803938f, 0.285117388f},
-std::array<float,2>{0.812325478f, 0.648074031f},
-std::array<float,2>{0.628930151f, 0.304922789f},
-std::array<float,2>{0.355707735f, 0.628077626f},
-std::array<float,2>{0.101410329f, 0.186124176f},
-std::array<float,2>{0.775128961f, 0.783342481f},
-std::array<float,2>{0.943588674f, 0.0163425244f},
-std::array<float,2>{0.138107151f, 0.990045726f},
-std::array<float,2>{0.434626758f, 0.46458143f},
-std::array<float,2>{0.564794362f, 0.568741143f},
-std::array<float,2>{0.853027284f, 0.428033769f},
-std::array<float,2>{0.0287130475f, 0.55947262f},
-std::array<float,2>{0.30610013f, 0.0802195743f},
-std::array<float,2>{0.73017782f, 0.87852174f},
-std::array<float,2>{0.534456134f, 0.238443032f},
-std::array<float,2>{0.445813864f, 0.874049604f},
-std::array<float,2>{0.245977327f, 0.348612666f},
-std::array<float,2>{0.900368512f, 0.72316587f},
-std::array<float,2>{0.612274826f, 0.493935168f},
-std::array<float,2>{0.401335746f, 0.612252593f},
-std::array<float,2>{0.159155875f, 0.0382791124f},
-std::array<float,2>{0.97060591f, 0.962102771f},
-std::array<float,2>{0.795016825f, 0.138660461f},
-std::array<float,2>{0.0834847838f, 0.778982997f},
-std::array<float,2>{0.337571979f, 0.262642354f},
-std::array<float,2>{0.673747957f, 0.663771749f},
-std::array<float,2>{0.91475755f, 0.332262546f},
-std::array<float,2>{0.192601293f, 0.707685769f},
-std::array<float,2>{0.477888912f, 0.197000235f},
-std::array<float,2>{0.516207695f, 0.830188453f},
-std::array<float,2>{0.687682271f, 0.123358823f},
-std::array<float,2>{0.273973376f, 0.928907931f},
-std::array<float,2>{0.0502101704f, 0.402494997f},
-std::array<float,2>{0.817091405f, 0.509482384f},
-std::array<float,2>{0.723894656f, 0.449433565f},
-std::array<float,2>{0.300374299f, 0.589240372f},
-std::array<float,2>{0.0188774113f, 0.00436599785f},
-std::array<float,2>{0.850983322f, 0.970967293f},
-std::array<float,2>{0.892128944f, 0.158589736f},
-std::array<float,2>{0.238806441f, 0.805799603f},
-std::array<float,2>{0.442516923f, 0.287767142f},
-std::array<float,2>{0.545807898f, 0.641128659f},
-std::array<float,2>{0.769104242f, 0.362363458f},
-std::array<float,2>{0.108132817f, 0.738936901f},
-std::array<float,2>{0.344608635f, 0.23198168f},
-std::array<float,2>{0.640218675f, 0.847165942f},
-std::array<float,2>{0.571273983f, 0.0644003451f},
-std::array<float,2>{0.425146461f, 0.891748011f},
-std::array<float,2>{0.128243864f, 0.40753594f},
-std::array<float,2>{0.948364675f, 0.532527626f},
-std::array<float,2>{0.524066508f, 0.266528547f},
-std::array<float,2>{0.474508941f, 0.674010158f},
-std::array<float,2>{0.196613491f, 0.15347974f},
-std::array<float,2>{0.906848311f, 0.755534947f},
-std::array<float,2>{0.82326746f, 0.0561620854f},
-std::array<float,2>{0.055243317f, 0.942438722f},
-std::array<float,2>{0.271777987f, 0.475632906f},
-std::array<float,2>{0.69781065f, 0.595864534f},
-std::array<float,2>{0.976572573f, 0.377000481f},
-std::array<float,2>{0.1716775f, 0.526137173f},
-std::array<float,2>{0.393161356f, 0.0995349437f},
-std::array<float,2>{0.623916805f, 0.910441458f},
-std::array<float,2>{0.684880733f, 0.203396067f},
-std::array<float,2>{0.329602331f, 0.824453533f},
-std::array<float,2>{0.0908100456f, 0.325329006f},
-std::array<float,2>{0.788181126f, 0.689506471f},
-std::array<float,2>{0.64659816f, 0.330783248f},
-std::array<float,2>{0.373100281f, 0.706786394f},
-std::array<float,2>{0.122977272f, 0.200372383f},
-std::array<float,2>{0.754273951f, 0.835754812f},
-std::array<float,2>{0.965016127f, 0.117512584f},
-std::array<float,2>{0.145747751f, 0.923780382f},
-std::array<float,2>{0.419157624f, 0.398853183f},
-std::array<float,2>{0.578960776f, 0.51280278f},
-std::array<float,2>{0.871073902f, 0.498206735f},
-std::array<float,2>{0.0134168807f, 0.614162445f},
-std::array<float,2>{0.292825073f, 0.0331847556f},
-std::array<float,2>{0.74221015f, 0.968600035f},
-std::array<float,2>{0.559496045f, 0.136497259f},
-std::array<float,2>{0.459608316f, 0.776841938f},
-std::array<float,2>{0.230869487f, 0.259300619f},
-std::array<float,2>{0.884391367f, 0.658612251f},
-std::array<float,2>{0.607543588f, 0.423299223f},
-std::array<float,2>{0.381286621f, 0.555252373f},
-std::array<float,2>{0.179258406f, 0.0845449194f},
-std::array<float,2>{0.997099876f, 0.879685044f},
-std::array<float,2>{0.798900306f, 0.236092344f},
-std::array<float,2>{0.0723755509f, 0.867994368f},
-std::array<float,2>{0.32376039f, 0.346665263f},
-std::array<float,2>{0.656909108f, 0.722077906f},
-std::array<float,2>{0.923552811f, 0.309155017f},
-std::array<float,2>{0.208909154f, 0.631012499f},
-std::array<float,2>{0.48960647f, 0.181788519f},
-std::array<float,2>{0.510297358f, 0.785489023f},
-std::array<float,2>{0.703264296f, 0.0198972002f},
-std::array<float,2>{0.251123011f, 0.987367749f},
-std::array<float,2>{0.0357255675f, 0.468318105f},
-std::array<float,2>{0.839982867f, 0.563666701f},
-std::array<float,2>{0.671029568f, 0.395584226f},
-std::array<float,2>{0.319778264f, 0.506194174f},
-std::array<float,2>{0.0673301741f, 0.110233545f},
-std::array<float,2>{0.8058815f, 0.932910025f},
-std::array<float,2>{0.98494339f, 0.189663321f},
-std::array<float,2>{0.185238481f, 0.836627483f},
-std::array<float,2>{0.384615481f, 0.337935716f},
-std::array<float,2>{0.59595108f, 0.717525721f},
-std::array<float,2>{0.833782256f, 0.256225288f},
-std::array<float,2>{0.0410325527f, 0.666137278f},
-std::array<float,2>{0.25919652f, 0.125316098f},
-std::array<float,2>{0.714380026f, 0.766041636f},
-std::array<float,2>{0.507220149f, 0.0419465005f},
-std::array<float,2>{0.499853432f, 0.956387162f},
-std::array<float,2>{0.211018875f, 0.487686098f},
-std::array<float,2>{0.934224844f, 0.622176111f},
-std::array<float,2>{0.592567027f, 0.358021379f},
-std::array<float,2>{0.412927955f, 0.729142964f},
-std::array<float,2>{0.151852891f, 0.244475424f},
-std::array<float,2>{0.954936743f, 0.86038959f},
-std::array<float,2>{0.760701597f, 0.0892326757f},
-std::array<float,2>{0.11574816f, 0.888080716f},
-std::array<float,2>{0.359625816f, 0.434017241f},
-std::array<float,2>{0.649012983f, 0.549839914f},
-std::array<float,2>{0.875420213f, 0.4543235f},
-std::array<float,2>{0.22553286f, 0.573283076f},
-std::array<float,2>{0.463751614f, 0.0237326194f},
-std::array<float,2>{0.548384428f, 0.998155236f},
-std::array<float,2>{0.739596963f, 0.172650859f},
-std::array<float,2>{0.287768304f, 0.795685709f},
-std::array<float,2>{0.000895676552f, 0.299101353f},
-std::array<float,2>{0.865958989f, 0.633801222f},
-std::array<float,2>{0.694021821f, 0.29133442f},
-std::array<float,2>{0.27987206f, 0.65431875f},
-std::array<float,2>{0.0519891419f, 0.16758205f},
-std::array<float,2>{0.814142466f, 0.802233577f},
-std::array<float,2>{0.918014586f, 0.00897843577f},
-std::array<float,2>{0.187915027f, 0.978877008f},
-std::array<float,2>{0.482383519f, 0.444244951f},
-std::array<float,2>{0.520553172f, 0.582999766f},
-std::array<float,2>{0.790975213f, 0.421613216f},
-std::array<float,2>{0.078586638f, 0.5398947f},
-std::array<float,2>{0.343019903f, 0.0767788589f},
-std::array<float,2>{0.67833817f, 0.902591765f},
-std::array<float,2>{0.616695404f, 0.220271558f},
-std::array<float,2>{0.402842641f, 0.858820558f},
-std::array<float,2>{0.160891786f, 0.367440045f},
-std::array<float,2>{0.975176811f, 0.748974979f},
-std::array<float,2>{0.537634492f, 0.483695358f},
-std::array<float,2>{0.449271083f, 0.607909501f},
-std::array<float,2>{0.248521104f, 0.0536422469f},
-std::array<float,2>{0.902664602f, 0.950015664f},
-std::array<float,2>{0.856019616f, 0.145828158f},
-std::array<float,2>{0.0263367146f, 0.758159578f},
-std::array<float,2>{0.31013152f, 0.27688691f},
-std::array<float,2>{0.732443869f, 0.687271476f},
-std::array<float,2>{0.939678371f, 0.315563947f},
-std::array<float,2>{0.134976059f, 0.699983835f},
-std::array<float,2>{0.431662261f, 0.217760652f},
-std::array<float,2>{0.569444001f, 0.815019369f},
-std::array<float,2>{0.627174675f, 0.104150712f},
-std::array<float,2>{0.351681828f, 0.914746284f},
-std::array<float,2>{0.0938129798f, 0.384944499f},
-std::array<float,2>{0.781062841f, 0.52196914f},
-std::array<float,2>{0.635355353f, 0.490728527f},
-std::array<float,2>{0.349679917f, 0.617750883f},
-std::array<float,2>{0.104198158f, 0.0431583486f},
-std::array<float,2>{0.772932172f, 0.957131267f},
-std::array<float,2>{0.952495515f, 0.131247118f},
-std::array<float,2>{0.130047411f, 0.771832168f},
-std::array<float,2>{0.428894997f, 0.253764391f},
-std::array<float,2>{0.574717283f, 0.66813755f},
-std::array<float,2>{0.84561801f, 0.343057305f},
-std::array<float,2>{0.0199362338f, 0.712500215f},
-std::array<float,2>{0.300971478f, 0.194362849f},
-std::array<float,2>{0.720377564f, 0.840697646f},
-std::array<float,2>{0.542226672f, 0.114574745f},
-std::array<float,2>{0.438208431f, 0.936651289f},
-std::array<float,2>{0.23557426f, 0.391536146f},
-std::array<float,2>{0.895052969f, 0.501216769f},
-std::array<float,2>{0.620465338f, 0.302041769f},
-std::array<float,2>{0.396850318f, 0.640421867f},
-std::array<float,2>{0.164703101f, 0.176359311f},
-std::array<float,2>{0.983226836f, 0.792940378f},
-std::array<float,2>{0.783689499f, 0.0274828449f},
-std::array<float,2>{0.0874837935f, 0.995413303f},
-std::array<float,2>{0.333011359f, 0.457686335f},
-std::array<float,2>{0.680039823f, 0.575104177f},
-std::array<float,2>{0.911450148f, 0.433416516f},
-std::array<float,2>{0.202266812f, 0.553256989f},
-std::array<float,2>{0.469820619f, 0.0904090255f},
-std::array<float,2>{0.531209409f, 0.885998428f},
-std::array<float,2>{0.701780438f, 0.248091251f},
-std::array<float,2>{0.265950322f, 0.864713907f},
-std::array<float,2>{0.0600261167f, 0.353584647f},
-std::array<float,2>{0.826332569f, 0.731428802f},
-std::array<float,2>{0.746204793f, 0.372645438f},
-std::array<float,2>{0.294134259f, 0.74391526f},
-std::array<float,2>{0.00958268438f, 0.222845182f},
-std::array<float,2>{0.874905169f, 0.853133917f},
-std::array<float,2>{0.888495564f, 0.0738911778f},
-std::array<float,2>{0.229926109f, 0.901807845f},
-std::array<float,2>{0.455214649f, 0.417268008f},
-std::array<float,2>{0.556266427f, 0.54354465f},
-std::array<float,2>{0.751767993f, 0.438968718f},
-std::array<float,2>{0.118556529f, 0.580736816f},
-std::array<float,2>{0.370668977f, 0.0148903579f},
-std::array<float,2>{0.643814743f, 0.983373344f},
-std::array<float,2>{0.583904088f, 0.168082312f},
-std::array<float,2>{0.415174782f, 0.797360241f},
-std::array<float,2>{0.141118437f, 0.295577884f},
-std::array<float,2>{0.962615132f, 0.649704158f},
-std::array<float,2>{0.512617111f, 0.390359461f},
-std::array<float,2>{0.485470563f, 0.518594682f},
-std::array<float,2>{0.206000626f, 0.108797088f},
-std::array<float,2>{0.925877154f, 0.919139326f},
-std::array<float,2>{0.837986827f, 0.213231772f},
-std::array<float,2>{0.0316882692f, 0.819025695f},
-std::array<float,2>{0.256959707f, 0.319996983f},
-std::array<float,2>{0.710545003f, 0.698497593f},
-std::array<float,2>{0.992946386f, 0.280035645f},
-std::array<float,2>{0.174523026f, 0.680256724f},
-std::array<float,2>{0.37646082f, 0.143249646f},
-std::array<float,2>{0.603535891f, 0.763003826f},
-std::array<float,2>{0.660595715f, 0.049662523f},
-std::array<float,2>{0.326420754f, 0.946159303f},
-std::array<float,2>{0.0748982653f, 0.479831159f},
-std::array<float,2>{0.804089963f, 0.602063835f},
-std::array<float,2>{0.717127919f, 0.411325783f},
-std::array<float,2>{0.262777835f, 0.536718369f},
-std::array<float,2>{0.0437133275f, 0.0683677271f},
-std::array<float,2>{0.829618514f, 0.894925356f},
-std::array<float,2>{0.93258512f, 0.229039833f},
-std::array<float,2>{0.214942649f, 0.84823215f},
-std::array<float,2>{0.494949609f, 0.366329044f},
-std::array<float,2>{0.50191021f, 0.734881163f},
-std::array<float,2>{0.809350491f, 0.281980634f},
-std::array<float,2>{0.0638603941f, 0.644854784f},
-std::array<float,2>{0.314999878f, 0.163391709f},
-std::array<float,2>{0.666511118f, 0.811541796f},
-std::array<float,2>{0.599960446f, 0.00137435051f},
-std::array<float,2>{0.388038099f, 0.974912584f},
-std::array<float,2>{0.182523936f, 0.445352525f},
-std::array<float,2>{0.989256382f, 0.591796935f},
-std::array<float,2>{0.554105461f, 0.323843479f},
-std::array<float,2>{0.467138678f, 0.69505173f},
-std::array<float,2>{0.219328612f, 0.210601255f},
-std::array<float,2>{0.882674456f, 0.823110044f},
-std::array<float,2>{0.859465003f, 0.0941601396f},
-std::array<float,2>{0.00606845226f, 0.909571886f},
-std::array<float,2>{0.283174157f, 0.380738735f},
-std::array<float,2>{0.736150742f, 0.529606938f},
-std::array<float,2>{0.95738399f, 0.470507413f},
-std::array<float,2>{0.155203864f, 0.598884225f},
-std::array<float,2>{0.406677157f, 0.0603635795f},
-std::array<float,2>{0.589839637f, 0.939033687f},
-std::array<float,2>{0.653998256f, 0.151352897f},
-std::array<float,2>{0.365240991f, 0.753454387f},
-std::array<float,2>{0.112690061f, 0.272567242f},
-std::array<float,2>{0.76378262f, 0.67869556f},
-std::array<float,2>{0.675125062f, 0.265256584f},
-std::array<float,2>{0.33882156f, 0.661565661f},
-std::array<float,2>{0.0855761841f, 0.139320552f},
-std::array<float,2>{0.793030918f, 0.779896557f},
-std::array<float,2>{0.971928716f, 0.0356033221f},
-std::array<float,2>{0.157826662f, 0.963554919f},
-std::array<float,2>{0.400362283f, 0.495738506f},
-std::array<float,2>{0.611153722f, 0.609447122f},
-std::array<float,2>{0.818879783f, 0.405598789f},
-std::array<float,2>{0.0478767008f, 0.51133734f},
-std::array<float,2>{0.275620937f, 0.122770689f},
-std::array<float,2>{0.690443218f, 0.9271245f},
-std::array<float,2>{0.518790126f, 0.19798933f},
-std::array<float,2>{0.480129749f, 0.829581201f},
-std::array<float,2>{0.19438453f, 0.335724324f},
-std::array<float,2>{0.917950451f, 0.709541202f},
-std::array<float,2>{0.564149499f, 0.462779522f},
-std::array<float,2>{0.436299294f, 0.566797137f},
-std::array<float,2>{0.140585884f, 0.0177371744f},
-std::array<float,2>{0.942037046f, 0.991504431f},
-std::array<float,2>{0.775414586f, 0.184546426f},
-std::array<float,2>{0.0977607965f, 0.782882631f},
-std::array<float,2>{0.357539028f, 0.308036834f},
-std::array<float,2>{0.631358564f, 0.625505507f},
-std::array<float,2>{0.900547564f, 0.350375384f},
-std::array<float,2>{0.243703648f, 0.726025879f},
-std::array<float,2>{0.448794395f, 0.242016211f},
-std::array<float,2>{0.533177733f, 0.871761441f},
-std::array<float,2>{0.726964474f, 0.0781563893f},
-std::array<float,2>{0.308223009f, 0.876189113f},
-std::array<float,2>{0.030393986f, 0.426465571f},
-std::array<float,2>{0.855381191f, 0.560585022f},
-std::array<float,2>{0.744137526f, 0.49783811f},
-std::array<float,2>{0.291296333f, 0.615890265f},
-std::array<float,2>{0.0125356754f, 0.033226911f},
-std::array<float,2>{0.86926651f, 0.965251982f},
-std::array<float,2>{0.883709252f, 0.133522615f},
-std::array<float,2>{0.232130915f, 0.774265468f},
-std::array<float,2>{0.460011959f, 0.261181533f},
-std::array<float,2>{0.559758961f, 0.656743646f},
-std::array<float,2>{0.755316436f, 0.329227656f},
-std::array<float,2>{0.121796787f, 0.703557551f},
-std::array<float,2>{0.374651492f, 0.202200606f},
-std::array<float,2>{0.648095667f, 0.833814085f},
-std::array<float,2>{0.579525948f, 0.120703198f},
-std::array<float,2>{0.418456972f, 0.924518228f},
-std::array<float,2>{0.144729406f, 0.400740206f},
-std::array<float,2>{0.966014981f, 0.514454484f},
-std::array<float,2>{0.51125294f, 0.311304927f},
-std::array<float,2>{0.489230186f, 0.63067311f},
-std::array<float,2>{0.207865536f, 0.18154417f},
-std::array<float,2>{0.922806799f, 0.788665831f},
-std::array<float,2>{0.840938926f, 0.0215283949f},
-std::array<float,2>{0.0363238491f, 0.986041009f},
-std::array<float,2>{0.250631154f, 0.465065777f},
-std::array<float,2>{0.704777896f, 0.565479279f},
-std::array<float,2>{0.99611181f, 0.42486316f},
-std::array<float,2>{0.177832901f, 0.557987332f},
-std::array<float,2>{0.382364333f, 0.0837170184f},
-std::array<float,2>{0.608963668f, 0.882361472f},
-std::array<float,2>{0.657530189f, 0.237063125f},
-std::array<float,2>{0.322498024f, 0.869774938f},
-std::array<float,2>{0.0741516575f, 0.344553381f},
-std::array<float,2>{0.800105572f, 0.72020036f},
-std::array<float,2>{0.639035761f, 0.36097613f},
-std::array<float,2>{0.345073402f, 0.740867615f},
-std::array<float,2>{0.109283939f, 0.232533976f},
-std::array<float,2>{0.767975211f, 0.844762385f},
-std::array<float,2>{0.948021114f, 0.06548547f},
-std::array<float,2>{0.127285451f, 0.893965364f},
-std::array<float,2>{0.424757034f, 0.40884459f},
-std::array<float,2>{0.571418703f, 0.534685075f},
-std::array<float,2>{0.850243866f, 0.452371061f},
-std::array<float,2>{0.0184800792f, 0.586152852f},
-std::array<float,2>{0.299389124f, 0.00684889592f},
-std::array<float,2>{0.723285973f, 0.970188856f},
-std::array<float,2>{0.546113491f, 0.156413108f},
-std::array<float,2>{0.441979051f, 0.808477819f},
-std::array<float,2>{0.239760786f, 0.285552055f},
-std::array<float,2>{0.891217768f, 0.644124448f},
-std::array<float,2>{0.624030411f, 0.375814527f},
-std::array<float,2>{0.394230127f, 0.524405181f},
-std::array<float,2>{0.170360982f, 0.100598693f},
-std::array<float,2>{0.97774905f, 0.912957668f},
-std::array<float,2>{0.787225902f, 0.205221146f},
-std::array<float,2>{0.0910288244f, 0.826778352f},
-std::array<float,2>{0.328884989f, 0.326698035f},
-std::array<float,2>{0.684368014f, 0.688421309f},
-std::array<float,2>{0.90775758f, 0.267760009f},
-std::array<float,2>{0.195938393f, 0.673124969f},
-std::array<float,2>{0.473582119f, 0.155241013f},
-std::array<float,2>{0.52456069f, 0.757663786f},
-std::array<float,2>{0.698637545f, 0.0567931086f},
-std::array<float,2>{0.272846431f, 0.945007563f},
-std::array<float,2>{0.0558999293f, 0.473300189f},
-std::array<float,2>{0.822927892f, 0.594766498f},
-std::array<float,2>{0.679653049f, 0.418573588f},
-std::array<float,2>{0.342288613f, 0.542686701f},
-std::array<float,2>{0.0799491256f, 0.0753733739f},
-std::array<float,2>{0.789795399f, 0.90444231f},
-std::array<float,2>{0.976410091f, 0.220918357f},
-std::array<float,2>{0.161464617f, 0.855699718f},
-std::array<float,2>{0.403906554f, 0.369769841f},
-std::array<float,2>{0.615779757f, 0.746772051f},
-std::array<float,2>{0.812950075f, 0.289409757f},
-std::array<float,2>{0.0513176247f, 0.653900564f},
-std::array<float,2>{0.280510157f, 0.164197221f},
-std::array<float,2>{0.694648445f, 0.803499579f},
-std::array<float,2>{0.520201504f, 0.0101454491f},
-std::array<float,2>{0.481045634f, 0.977151096f},
-std::array<float,2>{0.189071193f, 0.441614538f},
-std::array<float,2>{0.919667304f, 0.5856902f},
-std::array<float,2>{0.569003344f, 0.314245582f},
-std::array<float,2>{0.433332354f, 0.702696979f},
-std::array<float,2>{0.136016831f, 0.215492383f},
-std::array<float,2>{0.940624595f, 0.814448833f},
-std::array<float,2>{0.78022033f, 0.102932759f},
-std::array<float,2>{0.0950416252f, 0.916425943f},
-std::array<float,2>{0.352732688f, 0.383606404f},
-std::array<float,2>{0.6287871f, 0.520139992f},
-std::array<float,2>{0.904020905f, 0.481241673f},
-std::array<float,2>{0.249702752f, 0.605674803f},
-std::array<float,2>{0.450464338f, 0.0524963327f},
-std::array<float,2>{0.538453162f, 0.952595711f},
-std::array<float,2>{0.734333098f, 0.147160843f},
-std::array<float,2>{0.309472382f, 0.760486603f},
-std::array<float,2>{0.0270280372f, 0.274520904f},
-std::array<float,2>{0.856944382f, 0.684964478f},
-std::array<float,2>{0.713304043f, 0.255139709f},
-std::array<float,2>{0.258545041f, 0.665608168f},
-std::array<float,2>{0.0425266065f, 0.128824115f},
-std::array<float,2>{0.832263649f, 0.769344509f},
-std::array<float,2>{0.93470341f, 0.0392385237f},
-std::array<float,2>{0.212701276f, 0.95477438f},
-std::array<float,2>{0.498188376f, 0.48492077f},
-std::array<float,2>{0.506141782f, 0.624625802f},
-std::array<float,2>{0.804971635f, 0.396823287f},
-std::array<float,2>{0.0674322993f, 0.50486958f},
-std::array<float,2>{0.318447709f, 0.111816533f},
-std::array<float,2>{0.670524776f, 0.930410445f},
-std::array<float,2>{0.597098649f, 0.18941617f},
-std::array<float,2>{0.383101583f, 0.838235438f},
-std::array<float,2>{0.183776572f, 0.336569726f},
-std::array<float,2>{0.985884905f, 0.716582656f},
-std::array<float,2>{0.54769069f, 0.45635888f},
-std::array<float,2>{0.464766085f, 0.570473611f},
-std::array<float,2>{0.225736707f, 0.0271033458f},
-std::array<float,2>{0.876327038f, 0.996104598f},
-std::array<float,2>{0.867096961f, 0.173847079f},
-std::array<float,2>{0.00107382087f, 0.793283701f},
-std::array<float,2>{0.289039046f, 0.298042476f},
-std::array<float,2>{0.738696218f, 0.636315525f},
-std::array<float,2>{0.95403105f, 0.355935037f},
-std::array<float,2>{0.15073511f, 0.72808814f},
-std::array<float,2>{0.413897157f, 0.244088233f},
-std::array<float,2>{0.593578815f, 0.86147505f},
-std::array<float,2>{0.650033116f, 0.0878354982f},
-std::array<float,2>{0.360888928f, 0.888778985f},
-std::array<float,2>{0.116990186f, 0.43595463f},
-std::array<float,2>{0.761032283f, 0.548517823f},
-std::array<float,2>{0.643209994f, 0.441228837f},
-std::array<float,2>{0.369152904f, 0.579835832f},
-std::array<float,2>{0.11789903f, 0.012442397f},
-std::array<float,2>{0.750400722f, 0.980626822f},
-std::array<float,2>{0.961446345f, 0.17098546f},
-std::array<float,2>{0.141817227f, 0.799961746f},
-std::array<float,2>{0.414452732f, 0.293882757f},
-std::array<float,2>{0.582187891f, 0.652302265f},
-std::array<float,2>{0.873139799f, 0.373442709f},
-std::array<float,2>{0.00863434467f, 0.74507457f},
-std::array<float,2>{0.293643206f, 0.226268068f},
-std::array<float,2>{0.747684479f, 0.854264259f},
-std::array<float,2>{0.555113375f, 0.0721553117f},
-std::array<float,2>{0.456486672f, 0.899653852f},
-std::array<float,2>{0.229353294f, 0.415675193f},
-std::array<float,2>{0.886906981f, 0.546593249f},
-std::array<float,2>{0.605325997f, 0.278703243f},
-std::array<float,2>{0.375393897f, 0.681967258f},
-std::array<float,2>{0.174871162f, 0.140660807f},
-std::array<float,2>{0.993721247f, 0.765448451f},
-std::array<float,2>{0.802740693f, 0.0484391563f},
-std::array<float,2>{0.0752083808f, 0.947419167f},
-std::array<float,2>{0.32750532f, 0.476695627f},
-std::array<float,2>{0.661583126f, 0.604340374f},
-std::array<float,2>{0.927577376f, 0.387887061f},
-std::array<float,2>{0.206588507f, 0.516083717f},
-std::array<float,2>{0.485134631f, 0.105917178f},
-std::array<float,2>{0.513543427f, 0.920296192f},
-std::array<float,2>{0.709183693f, 0.21225068f},
-std::array<float,2>{0.256017298f, 0.818356216f},
-std::array<float,2>{0.032698825f, 0.318308204f},
-std::array<float,2>{0.839763939f, 0.695540249f},
-std::array<float,2>{0.718870938f, 0.340151072f},
-std::array<float,2>{0.301965058f, 0.712983966f},
-std::array<float,2>{0.0211649258f, 0.192162916f},
-std::array<float,2>{0.844097257f, 0.843078077f},
-std::array<float,2>{0.896400809f, 0.116753884f},
-std::array<float,2>{0.234819248f, 0.934292495f},
-std::array<float,2>{0.439449131f, 0.393273145f},
-std::array<float,2>{0.541156352f, 0.503409207f},
-std::array<float,2>{0.771715701f, 0.489160299f},
-std::array<float,2>{0.105109125f, 0.620628238f},
-std::array<float,2>{0.350937128f, 0.045207642f},
-std::array<float,2>{0.635982275f, 0.959859133f},
-std::array<float,2>{0.575599909f, 0.129597574f},
-std::array<float,2>{0.428415358f, 0.769863367f},
-std::array<float,2>{0.129625812f, 0.251388222f},
-std::array<float,2>{0.95178771f, 0.670169234f},
-std::array<float,2>{0.529634476f, 0.431629658f},
-std::array<float,2>{0.469214052f, 0.552087069f},
-std::array<float,2>{0.201541454f, 0.0918851718f},
-std::array<float,2>{0.910295665f, 0.882902622f},
-std::array<float,2>{0.827875555f, 0.247148886f},
-std::array<float,2>{0.0593673326f, 0.865609586f},
-std::array<float,2>{0.267342746f, 0.351608247f},
-std::array<float,2>{0.702429593f, 0.734216273f},
-std::array<float,2>{0.984056652f, 0.304465324f},
-std::array<float,2>{0.165928289f, 0.638272107f},
-std::array<float,2>{0.397986412f, 0.178742692f},
-std::array<float,2>{0.619889319f, 0.789885938f},
-std::array<float,2>{0.680909038f, 0.0300906356f},
-std::array<float,2>{0.332728505f, 0.993687272f},
-std::array<float,2>{0.0859658867f, 0.460683137f},
-std::array<float,2>{0.78432405f, 0.577172935f},
-std::array<float,2>{0.689737678f, 0.404213965f},
-std::array<float,2>{0.277209163f, 0.508093238f},
-std::array<float,2>{0.0473422147f, 0.124766797f},
-std::array<float,2>{0.81987536f, 0.928338587f},
-std::array<float,2>{0.916620076f, 0.195875958f},
-std::array<float,2>{0.194259837f, 0.831521034f},
-std::array<float,2>{0.478777945f, 0.333799541f},
-std::array<float,2>{0.518083096f, 0.708538473f},
-std::array<float,2>{0.794717312f, 0.263080806f},
-std::array<float,2>{0.08495076f, 0.662332058f},
-std::array<float,2>{0.339189678f, 0.137438774f},
-std::array<float,2>{0.674274325f, 0.777890921f},
-std::array<float,2>{0.609468818f, 0.0377075821f},
-std::array<float,2>{0.398658007f, 0.961344957f},
-std::array<float,2>{0.156627283f, 0.492669374f},
-std::array<float,2>{0.97124064f, 0.612506449f},
-std::array<float,2>{0.53180486f, 0.349102587f},
-std::array<float,2>{0.448043853f, 0.724606454f},
-std::array<float,2>{0.243069291f, 0.240070134f},
-std::array<float,2>{0.90211165f, 0.873293757f},
-std::array<float,2>{0.854336977f, 0.0813278481f},
-std::array<float,2>{0.0299672987f, 0.876992822f},
-std::array<float,2>{0.307133138f, 0.429648727f},
-std::array<float,2>{0.727942586f, 0.560350239f},
-std::array<float,2>{0.942750216f, 0.463746011f},
-std::array<float,2>{0.139327109f, 0.570114374f},
-std::array<float,2>{0.436852962f, 0.0171490889f},
-std::array<float,2>{0.563472211f, 0.989189506f},
-std::array<float,2>{0.631933987f, 0.187258467f},
-std::array<float,2>{0.359252304f, 0.784534752f},
-std::array<float,2>{0.098828584f, 0.305696577f},
-std::array<float,2>{0.776912868f, 0.627804637f},
-std::array<float,2>{0.667909801f, 0.283242613f},
-std::array<float,2>{0.315461516f, 0.646760702f},
-std::array<float,2>{0.0628415123f, 0.160660937f},
-std::array<float,2>{0.809862494f, 0.809194744f},
-std::array<float,2>{0.990170896f, 0.00299470033f},
-std::array<float,2>{0.183194533f, 0.97277838f},
-std::array<float,2>{0.386845231f, 0.448902845f},
-std::array<float,2>{0.601448298f, 0.59030062f},
-std::array<float,2>{0.828316271f, 0.412127495f},
-std::array<float,2>{0.0448967852f, 0.537728667f},
-std::array<float,2>{0.261912078f, 0.067985408f},
-std::array<float,2>{0.718598604f, 0.897583961f},
-std::array<float,2>{0.500303686f, 0.228487626f},
-std::array<float,2>{0.495215654f, 0.849998295f},
-std::array<float,2>{0.216019109f, 0.364185989f},
-std::array<float,2>{0.933179259f, 0.736602068f},
-std::array<float,2>{0.588826656f, 0.470798761f},
-std::array<float,2>{0.40806812f, 0.600972533f},
-std::array<float,2>{0.155579954f, 0.0615676753f},
-std::array<float,2>{0.958342969f, 0.941279888f},
-std::array<float,2>{0.76529485f, 0.149389133f},
-std::array<float,2>{0.1114925f, 0.751607418f},
-std::array<float,2>{0.366666883f, 0.270569772f},
-std::array<float,2>{0.653006196f, 0.677338839f},
-std::array<float,2>{0.881744623f, 0.321284115f},
-std::array<float,2>{0.220683247f, 0.692433536f},
-std::array<float,2>{0.467942357f, 0.207328081f},
-std::array<float,2>{0.553002536f, 0.820464075f},
-std::array<float,2>{0.73512125f, 0.0960370675f},
-std::array<float,2>{0.281665623f, 0.907956421f},
-std::array<float,2>{0.00755612785f, 0.380953908f},
-std::array<float,2>{0.860368431f, 0.52803421f},
-std::array<float,2>{0.706025839f, 0.466934443f},
-std::array<float,2>{0.253754377f, 0.56320256f},
-std::array<float,2>{0.0378407761f, 0.0205345042f},
-std::array<float,2>{0.841829956f, 0.986826897f},
-std::array<float,2>{0.924847364f, 0.183533385f},
-std::array<float,2>{0.209955722f, 0.786571383f},
-std::array<float,2>{0.491415083f, 0.309893489f},
-std::array<float,2>{0.508271158f, 0.632052541f},
-std::array<float,2>{0.797176719f, 0.347519875f},
-std::array<float,2>{0.0704081133f, 0.720950782f},
-std::array<float,2>{0.320726603f, 0.23473464f},
-std::array<float,2>{0.660101533f, 0.86905998f},
-std::array<float,2>{0.605493248f, 0.0849642232f},
-std::array<float,2>{0.380242735f, 0.880844176f},
-std::array<float,2>{0.176809683f, 0.422720164f},
-std::array<float,2>{0.999961853f, 0.556322455f},
-std::array<float,2>{0.561789274f, 0.258319587f},
-std::array<float,2>{0.457949668f, 0.659201801f},
-std::array<float,2>{0.232945248f, 0.135132268f},
-std::array<float,2>{0.886696041f, 0.77581352f},
-std::array<float,2>{0.867211401f, 0.0313770622f},
-std::array<float,2>{0.0155282887f, 0.967143059f},
-std::array<float,2>{0.289511919f, 0.499502689f},
-std::array<float,2>{0.744357347f, 0.614498377f},
-std::array<float,2>{0.96737504f, 0.399606973f},
-std::array<float,2>{0.146571785f, 0.511829853f},
-std::array<float,2>{0.421832532f, 0.118772537f},
-std::array<float,2>{0.581426561f, 0.922464132f},
-std::array<float,2>{0.645943642f, 0.199827969f},
-std::array<float,2>{0.371674627f, 0.834385157f},
-std::array<float,2>{0.123133764f, 0.331337214f},
-std::array<float,2>{0.757004976f, 0.705710948f},
-std::array<float,2>{0.685591757f, 0.324323833f},
-std::array<float,2>{0.33066088f, 0.69071275f},
-std::array<float,2>{0.0928610191f, 0.204103798f},
-std::array<float,2>{0.785218954f, 0.825880051f},
-std::array<float,2>{0.979977489f, 0.0983173847f},
-std::array<float,2>{0.16973713f, 0.911317706f},
-std::array<float,2>{0.391784459f, 0.378524482f},
-std::array<float,2>{0.621699035f, 0.527128816f},
-std::array<float,2>{0.820506096f, 0.474891841f},
-std::array<float,2>{0.0577575602f, 0.596972227f},
-std::array<float,2>{0.270132393f, 0.0555482022f},
-std::array<float,2>{0.697185695f, 0.942248702f},
-std::array<float,2>{0.5258075f, 0.152689427f},
-std::array<float,2>{0.47537598f, 0.754851639f},
-std::array<float,2>{0.199210107f, 0.267384619f},
-std::array<float,2>{0.908436537f, 0.67553997f},
-std::array<float,2>{0.573665977f, 0.407078087f},
-std::array<float,2>{0.422279686f, 0.532078862f},
-std::array<float,2>{0.125407889f, 0.0627756044f},
-std::array<float,2>{0.945876539f, 0.890944958f},
-std::array<float,2>{0.767486453f, 0.230644062f},
-std::array<float,2>{0.10636209f, 0.84577018f},
-std::array<float,2>{0.34581092f, 0.361518204f},
-std::array<float,2>{0.638226867f, 0.739725053f},
-std::array<float,2>{0.893267572f, 0.289052427f},
-std::array<float,2>{0.24038668f, 0.642436564f},
-std::array<float,2>{0.443569183f, 0.159438431f},
-std::array<float,2>{0.543303788f, 0.805222511f},
-std::array<float,2>{0.726513803f, 0.00556365307f},
-std::array<float,2>{0.298104107f, 0.971816778f},
-std::array<float,2>{0.0168460812f, 0.45047307f},
-std::array<float,2>{0.8481462f, 0.588387311f},
-std::array<float,2>{0.625577986f, 0.386669606f},
-std::array<float,2>{0.354061246f, 0.522660375f},
-std::array<float,2>{0.0958959758f, 0.105170183f},
-std::array<float,2>{0.777418137f, 0.915221989f},
-std::array<float,2>{0.938025951f, 0.217950717f},
-std::array<float,2>{0.134268343f, 0.815881789f},
-std::array<float,2>{0.430611908f, 0.315036535f},
-std::array<float,2>{0.567764938f, 0.700763345f},
-std::array<float,2>{0.85923928f, 0.275393963f},
-std::array<float,2>{0.0251877345f, 0.686348259f},
-std::array<float,2>{0.311613083f, 0.145419747f},
-std::array<float,2>{0.73144412f, 0.75951755f},
-std::array<float,2>{0.536314249f, 0.0538330339f},
-std::array<float,2>{0.451213926f, 0.950725496f},
-std::array<float,2>{0.246105403f, 0.483314693f},
-std::array<float,2>{0.905522227f, 0.609075606f},
-std::array<float,2>{0.613827586f, 0.369106472f},
-std::array<float,2>{0.40516597f, 0.749179006f},
-std::array<float,2>{0.162606403f, 0.219242647f},
-std::array<float,2>{0.972662032f, 0.857835829f},
-std::array<float,2>{0.792875886f, 0.077823244f},
-std::array<float,2>{0.0806444585f, 0.90405637f},
-std::array<float,2>{0.340504199f, 0.420745671f},
-std::array<float,2>{0.677025259f, 0.540784597f},
-std::array<float,2>{0.920642138f, 0.445164591f},
-std::array<float,2>{0.189973697f, 0.583419442f},
-std::array<float,2>{0.48419112f, 0.00833842997f},
-std::array<float,2>{0.521839797f, 0.979543805f},
-std::array<float,2>{0.692754269f, 0.166500792f},
-std::array<float,2>{0.278205305f, 0.80097878f},
-std::array<float,2>{0.0540020913f, 0.292073667f},
-std::array<float,2>{0.814894736f, 0.655917287f},
-std::array<float,2>{0.741588891f, 0.299892634f},
-std::array<float,2>{0.28591451f, 0.633105159f},
-std::array<float,2>{0.00274823257f, 0.173292309f},
-std::array<float,2>{0.86356765f, 0.796192646f},
-std::array<float,2>{0.877955317f, 0.024924621f},
-std::array<float,2>{0.223604932f, 0.999529183f},
-std::array<float,2>{0.462242931f, 0.453287184f},
-std::array<float,2>{0.549563825f, 0.572527647f},
-std::array<float,2>{0.759253025f, 0.43526572f},
-std::array<float,2>{0.114388958f, 0.549222827f},
-std::array<float,2>{0.361445814f, 0.0879297256f},
-std::array<float,2>{0.652299881f, 0.887569785f},
-std::array<float,2>{0.590841353f, 0.245819628f},
-std::array<float,2>{0.4105784f, 0.859952331f},
-std::array<float,2>{0.148617163f, 0.359076977f},
-std::array<float,2>{0.956212997f, 0.729862273f},
-std::array<float,2>{0.504524887f, 0.487085909f},
-std::array<float,2>{0.497977018f, 0.621481061f},
-std::array<float,2>{0.214525849f, 0.0429030582f},
-std::array<float,2>{0.936734855f, 0.95568347f},
-std::array<float,2>{0.835464597f, 0.126760319f},
-std::array<float,2>{0.0396237895f, 0.766690016f},
-std::array<float,2>{0.261586636f, 0.256943941f},
-std::array<float,2>{0.711423814f, 0.667330503f},
-std::array<float,2>{0.988194406f, 0.33933261f},
-std::array<float,2>{0.186656088f, 0.717962325f},
-std::array<float,2>{0.386166692f, 0.191289648f},
-std::array<float,2>{0.594548404f, 0.837489486f},
-std::array<float,2>{0.668092132f, 0.110739917f},
-std::array<float,2>{0.318032295f, 0.932367146f},
-std::array<float,2>{0.0699086562f, 0.394674063f},
-std::array<float,2>{0.806777537f, 0.50712198f},
-std::array<float,2>{0.662868559f, 0.479427397f},
-std::array<float,2>{0.325621992f, 0.603124082f},
-std::array<float,2>{0.0770778358f, 0.0499693565f},
-std::array<float,2>{0.801196694f, 0.946926594f},
-std::array<float,2>{0.995193422f, 0.144507304f},
-std::array<float,2>{0.172229186f, 0.762289584f},
-std::array<float,2>{0.377090275f, 0.280507118f},
-std::array<float,2>{0.602902591f, 0.68161428f},
-std::array<float,2>{0.836697519f, 0.319268465f},
-std::array<float,2>{0.0337718725f, 0.697336078f},
-std::array<float,2>{0.254752219f, 0.214118242f},
-std::array<float,2>{0.708237112f, 0.819914937f},
-std::array<float,2>{0.51499182f, 0.108035915f},
-std::array<float,2>{0.486468703f, 0.9181481f},
-std::array<float,2>{0.203138843f, 0.388835073f},
-std::array<float,2>{0.929587603f, 0.518176913f},
-std::array<float,2>{0.585918665f, 0.296685219f},
-std::array<float,2>{0.416660696f, 0.648613632f},
-std::array<float,2>{0.143683523f, 0.169310972f},
-std::array<float,2>{0.964349747f, 0.798646271f},
-std::array<float,2>{0.752736509f, 0.0143348956f},
-std::array<float,2>{0.120829672f, 0.983675063f},
-std::array<float,2>{0.367866784f, 0.437905282f},
-std::array<float,2>{0.640779555f, 0.581625283f},
-std::array<float,2>{0.88994354f, 0.416970462f},
-std::array<float,2>{0.228270039f, 0.544840813f},
-std::array<float,2>{0.454266131f, 0.072592169f},
-std::array<float,2>{0.558376133f, 0.900635362f},
-std::array<float,2>{0.748085022f, 0.223721564f},
-std::array<float,2>{0.29529053f, 0.85157162f},
-std::array<float,2>{0.0115962531f, 0.372022659f},
-std::array<float,2>{0.871567369f, 0.742662966f},
-std::array<float,2>{0.701036036f, 0.354734182f},
-std::array<float,2>{0.268683106f, 0.731814206f},
-std::array<float,2>{0.0612103604f, 0.249805555f},
-std::array<float,2>{0.826037705f, 0.86379689f},
-std::array<float,2>{0.912511766f, 0.0915159807f},
-std::array<float,2>{0.199500605f, 0.885659397f},
-std::array<float,2>{0.472382993f, 0.432391435f},
-std::array<float,2>{0.528830826f, 0.553992987f},
-std::array<float,2>{0.78243959f, 0.458783031f},
-std::array<float,2>{0.0883625224f, 0.575608313f},
-std::array<float,2>{0.333989412f, 0.0289720912f},
-std::array<float,2>{0.683412731f, 0.994551122f},
-std::array<float,2>{0.617729366f, 0.176949278f},
-std::array<float,2>{0.396077365f, 0.791683197f},
-std::array<float,2>{0.167596549f, 0.301599562f},
-std::array<float,2>{0.981581032f, 0.639416456f},
-std::array<float,2>{0.540761948f, 0.392565042f},
-std::array<float,2>{0.440860897f, 0.500291705f},
-std::array<float,2>{0.237571612f, 0.114135832f},
-std::array<float,2>{0.896762133f, 0.935602844f},
-std::array<float,2>{0.846068323f, 0.193413854f},
-std::array<float,2>{0.0225320235f, 0.841653109f},
-std::array<float,2>{0.303388208f, 0.341906041f},
-std::array<float,2>{0.721069813f, 0.711658835f},
-std::array<float,2>{0.950152397f, 0.25246945f},
-std::array<float,2>{0.131716073f, 0.669790506f},
-std::array<float,2>{0.42713061f, 0.132781148f},
-std::array<float,2>{0.576437473f, 0.772983789f},
-std::array<float,2>{0.634296775f, 0.0443995111f},
-std::array<float,2>{0.348644912f, 0.958946764f},
-std::array<float,2>{0.102868676f, 0.492157131f},
-std::array<float,2>{0.769606054f, 0.618202567f},
-std::array<float,2>{0.728719354f, 0.427134216f},
-std::array<float,2>{0.30500859f, 0.561636448f},
-std::array<float,2>{0.0278917253f, 0.0795306489f},
-std::array<float,2>{0.852023661f, 0.875549674f},
-std::array<float,2>{0.89937228f, 0.241199464f},
-std::array<float,2>{0.244194716f, 0.872342885f},
-std::array<float,2>{0.446758538f, 0.35062027f},
-std::array<float,2>{0.533229291f, 0.725275815f},
-std::array<float,2>{0.774109304f, 0.306713104f},
-std::array<float,2>{0.0998644978f, 0.626012921f},
-std::array<float,2>{0.356729239f, 0.185071722f},
-std::array<float,2>{0.630692005f, 0.781324029f},
-std::array<float,2>{0.566393137f, 0.0190529395f},
-std::array<float,2>{0.434521437f, 0.990499914f},
-std::array<float,2>{0.13760148f, 0.461251855f},
-std::array<float,2>{0.945227265f, 0.56747359f},
-std::array<float,2>{0.517271399f, 0.33443743f},
-std::array<float,2>{0.477503568f, 0.710624635f},
-std::array<float,2>{0.191995218f, 0.198968768f},
-std::array<float,2>{0.915320814f, 0.828849614f},
-std::array<float,2>{0.817872584f, 0.12192519f},
-std::array<float,2>{0.0492586531f, 0.925945818f},
-std::array<float,2>{0.274542868f, 0.405011028f},
-std::array<float,2>{0.689239204f, 0.51010859f},
-std::array<float,2>{0.969497561f, 0.494651467f},
-std::array<float,2>{0.159946382f, 0.61076659f},
-std::array<float,2>{0.402253121f, 0.0364625528f},
-std::array<float,2>{0.613089025f, 0.96461767f},
-std::array<float,2>{0.671967149f, 0.139659509f},
-std::array<float,2>{0.336882263f, 0.780652285f},
-std::array<float,2>{0.082973741f, 0.263695598f},
-std::array<float,2>{0.796860218f, 0.660450995f},
-std::array<float,2>{0.656149268f, 0.271665633f},
-std::array<float,2>{0.363821685f, 0.679328144f},
-std::array<float,2>{0.109573014f, 0.151661471f},
-std::array<float,2>{0.762383699f, 0.752854526f},
-std::array<float,2>{0.960466623f, 0.0587831177f},
-std::array<float,2>{0.15234451f, 0.937685907f},
-std::array<float,2>{0.409470439f, 0.469697714f},
-std::array<float,2>{0.58704114f, 0.597707331f},
-std::array<float,2>{0.86270386f, 0.379276037f},
-std::array<float,2>{0.00575584453f, 0.531205535f},
-std::array<float,2>{0.284054577f, 0.0951892585f},
-std::array<float,2>{0.737822473f, 0.908910692f},
-std::array<float,2>{0.551308036f, 0.20951581f},
-std::array<float,2>{0.466761172f, 0.824192762f},
-std::array<float,2>{0.221390396f, 0.322462231f},
-std::array<float,2>{0.880596399f, 0.693657637f},
-std::array<float,2>{0.598101139f, 0.446784973f},
-std::array<float,2>{0.390026569f, 0.59281379f},
-std::array<float,2>{0.18029657f, 0.000168841492f},
-std::array<float,2>{0.990699828f, 0.976517141f},
-std::array<float,2>{0.811159432f, 0.162339568f},
-std::array<float,2>{0.065056406f, 0.811120093f},
-std::array<float,2>{0.313460618f, 0.28309226f},
-std::array<float,2>{0.66528064f, 0.646030605f},
-std::array<float,2>{0.931476772f, 0.365410894f},
-std::array<float,2>{0.21689029f, 0.73600781f},
-std::array<float,2>{0.492798686f, 0.230405673f},
-std::array<float,2>{0.502627194f, 0.848742425f},
-std::array<float,2>{0.716064692f, 0.0701803342f},
-std::array<float,2>{0.263689339f, 0.895510733f},
-std::array<float,2>{0.0460628383f, 0.410262167f},
-std::array<float,2>{0.83157444f, 0.535725176f}}
\ No newline at end of file
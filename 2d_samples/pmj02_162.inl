@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.956257463f, 0.112481646f},
-std::array<float,2>{0.473143756f, 0.72348249f},
-std::array<float,2>{0.125091121f, 0.336972862f},
-std::array<float,2>{0.510022044f, 0.960734427f},
-std::array<float,2>{0.644742608f, 0.468958348f},
-std::array<float,2>{0.0439355113f, 0.82461822f},
-std::array<float,2>{0.287088037f, 0.198408157f},
-std::array<float,2>{0.775335491f, 0.505379915f},
-std::array<float,2>{0.828938127f, 0.306952745f},
-std::array<float,2>{0.356048852f, 0.892715752f},
-std::array<float,2>{0.12393225f, 0.000669029774f},
-std::array<float,2>{0.724529088f, 0.667437673f},
-std::array<float,2>{0.60014981f, 0.126412898f},
-std::array<float,2>{0.206726789f, 0.594405353f},
-std::array<float,2>{0.407839358f, 0.423440844f},
-std::array<float,2>{0.921033025f, 0.769676089f},
-std::array<float,2>{0.796239018f, 0.228419796f},
-std::array<float,2>{0.273197323f, 0.543948472f},
-std::array<float,2>{0.0147473179f, 0.447742939f},
-std::array<float,2>{0.663729668f, 0.873402119f},
-std::array<float,2>{0.548255682f, 0.372692436f},
-std::array<float,2>{0.157255948f, 0.981488645f},
-std::array<float,2>{0.462656885f, 0.0697035715f},
-std::array<float,2>{0.974416435f, 0.688796043f},
-std::array<float,2>{0.883301556f, 0.386068761f},
-std::array<float,2>{0.388035655f, 0.80317229f},
-std::array<float,2>{0.226219356f, 0.156360805f},
-std::array<float,2>{0.569847524f, 0.592023909f},
-std::array<float,2>{0.687714398f, 0.0445605516f},
-std::array<float,2>{0.085628435f, 0.631320238f},
-std::array<float,2>{0.333046615f, 0.260409653f},
-std::array<float,2>{0.865360796f, 0.907715976f},
-std::array<float,2>{0.926293373f, 0.185364008f},
-std::array<float,2>{0.434333056f, 0.566964447f},
-std::array<float,2>{0.188056648f, 0.400416136f},
-std::array<float,2>{0.617685795f, 0.784301162f},
-std::array<float,2>{0.744771242f, 0.272977471f},
-std::array<float,2>{0.0956038162f, 0.929422855f},
-std::array<float,2>{0.364339858f, 0.0539676175f},
-std::array<float,2>{0.826090097f, 0.655844629f},
-std::array<float,2>{0.753854752f, 0.462896407f},
-std::array<float,2>{0.311133385f, 0.853495181f},
-std::array<float,2>{0.0516530834f, 0.236060545f},
-std::array<float,2>{0.632079244f, 0.547627985f},
-std::array<float,2>{0.530628443f, 0.0921851769f},
-std::array<float,2>{0.140753999f, 0.705244541f},
-std::array<float,2>{0.491042465f, 0.355465144f},
-std::array<float,2>{0.940695226f, 0.991806269f},
-std::array<float,2>{0.84447372f, 0.0299684536f},
-std::array<float,2>{0.317911446f, 0.678917408f},
-std::array<float,2>{0.0711334348f, 0.288749844f},
-std::array<float,2>{0.703278303f, 0.875086725f},
-std::array<float,2>{0.580895066f, 0.414841235f},
-std::array<float,2>{0.237953559f, 0.751115143f},
-std::array<float,2>{0.402336061f, 0.149614319f},
-std::array<float,2>{0.901081324f, 0.612406671f},
-std::array<float,2>{0.985847533f, 0.320232928f},
-std::array<float,2>{0.451599151f, 0.948974133f},
-std::array<float,2>{0.177184775f, 0.107861139f},
-std::array<float,2>{0.532526076f, 0.741161287f},
-std::array<float,2>{0.676280916f, 0.203885749f},
-std::array<float,2>{0.0311225466f, 0.527699113f},
-std::array<float,2>{0.254066169f, 0.488674194f},
-std::array<float,2>{0.808900476f, 0.83999902f},
-std::array<float,2>{0.893836021f, 0.0562839359f},
-std::array<float,2>{0.391034424f, 0.64443779f},
-std::array<float,2>{0.245628566f, 0.275724173f},
-std::array<float,2>{0.586228728f, 0.933330655f},
-std::array<float,2>{0.714178979f, 0.395105422f},
-std::array<float,2>{0.0637362823f, 0.79653132f},
-std::array<float,2>{0.321264714f, 0.172076762f},
-std::array<float,2>{0.858701944f, 0.576323211f},
-std::array<float,2>{0.804590046f, 0.345560074f},
-std::array<float,2>{0.26471135f, 0.998718917f},
-std::array<float,2>{0.0184623487f, 0.0849126726f},
-std::array<float,2>{0.685006976f, 0.711068928f},
-std::array<float,2>{0.544792831f, 0.249431252f},
-std::array<float,2>{0.181486413f, 0.554956734f},
-std::array<float,2>{0.439142257f, 0.453852892f},
-std::array<float,2>{0.997643054f, 0.848815084f},
-std::array<float,2>{0.819457531f, 0.14101848f},
-std::array<float,2>{0.373309702f, 0.622161329f},
-std::array<float,2>{0.108430758f, 0.408019185f},
-std::array<float,2>{0.739390731f, 0.758341849f},
-std::array<float,2>{0.614908874f, 0.291902095f},
-std::array<float,2>{0.198878005f, 0.886261106f},
-std::array<float,2>{0.428402096f, 0.0210618116f},
-std::array<float,2>{0.93152827f, 0.685915947f},
-std::array<float,2>{0.948874056f, 0.493083686f},
-std::array<float,2>{0.496264756f, 0.830297947f},
-std::array<float,2>{0.15092507f, 0.217233643f},
-std::array<float,2>{0.516997218f, 0.520283282f},
-std::array<float,2>{0.633767784f, 0.101253144f},
-std::array<float,2>{0.0574360341f, 0.747913241f},
-std::array<float,2>{0.300659478f, 0.32502526f},
-std::array<float,2>{0.765300453f, 0.940017045f},
-std::array<float,2>{0.976893008f, 0.192659959f},
-std::array<float,2>{0.455601215f, 0.512147367f},
-std::array<float,2>{0.166941747f, 0.480402112f},
-std::array<float,2>{0.557138324f, 0.814186394f},
-std::array<float,2>{0.671460569f, 0.330848634f},
-std::array<float,2>{0.00239950954f, 0.961714923f},
-std::array<float,2>{0.275233865f, 0.117840186f},
-std::array<float,2>{0.786090255f, 0.733538568f},
-std::array<float,2>{0.870069981f, 0.43370381f},
-std::array<float,2>{0.336046487f, 0.775110185f},
-std::array<float,2>{0.0903049782f, 0.13656792f},
-std::array<float,2>{0.696409404f, 0.602475882f},
-std::array<float,2>{0.573806822f, 0.0105921468f},
-std::array<float,2>{0.23312135f, 0.663790762f},
-std::array<float,2>{0.380132377f, 0.298169136f},
-std::array<float,2>{0.881437719f, 0.902281106f},
-std::array<float,2>{0.766059458f, 0.0717577189f},
-std::array<float,2>{0.292115897f, 0.698159158f},
-std::array<float,2>{0.036871668f, 0.364892334f},
-std::array<float,2>{0.652954817f, 0.976478875f},
-std::array<float,2>{0.503001213f, 0.439393818f},
-std::array<float,2>{0.138201907f, 0.866082191f},
-std::array<float,2>{0.478016287f, 0.221066996f},
-std::array<float,2>{0.964344025f, 0.537673891f},
-std::array<float,2>{0.911737263f, 0.255997896f},
-std::array<float,2>{0.420947939f, 0.921351254f},
-std::array<float,2>{0.216840044f, 0.0362050422f},
-std::array<float,2>{0.602866888f, 0.635701716f},
-std::array<float,2>{0.733159482f, 0.171255037f},
-std::array<float,2>{0.109699309f, 0.580633283f},
-std::array<float,2>{0.346865237f, 0.380057871f},
-std::array<float,2>{0.841903329f, 0.806439102f},
-std::array<float,2>{0.99570328f, 0.00606480194f},
-std::array<float,2>{0.443039238f, 0.668881893f},
-std::array<float,2>{0.184739321f, 0.312393188f},
-std::array<float,2>{0.539918303f, 0.894860685f},
-std::array<float,2>{0.681268513f, 0.427041829f},
-std::array<float,2>{0.022525765f, 0.766242027f},
-std::array<float,2>{0.259349614f, 0.131634474f},
-std::array<float,2>{0.798146844f, 0.59783107f},
-std::array<float,2>{0.854112506f, 0.342285812f},
-std::array<float,2>{0.326277196f, 0.953845263f},
-std::array<float,2>{0.0668289587f, 0.115766168f},
-std::array<float,2>{0.717798769f, 0.71904242f},
-std::array<float,2>{0.593149841f, 0.201257974f},
-std::array<float,2>{0.248807624f, 0.502703369f},
-std::array<float,2>{0.396913528f, 0.476180524f},
-std::array<float,2>{0.89547807f, 0.824079633f},
-std::array<float,2>{0.75980413f, 0.162192971f},
-std::array<float,2>{0.30453068f, 0.588197291f},
-std::array<float,2>{0.0612723008f, 0.386897534f},
-std::array<float,2>{0.637061059f, 0.797297895f},
-std::array<float,2>{0.522791326f, 0.264508545f},
-std::array<float,2>{0.153049529f, 0.910732031f},
-std::array<float,2>{0.494930983f, 0.0418059379f},
-std::array<float,2>{0.951374054f, 0.628083289f},
-std::array<float,2>{0.936051786f, 0.453066975f},
-std::array<float,2>{0.423152477f, 0.86901021f},
-std::array<float,2>{0.199245796f, 0.231596336f},
-std::array<float,2>{0.613133073f, 0.540410221f},
-std::array<float,2>{0.735894978f, 0.064549461f},
-std::array<float,2>{0.105380334f, 0.694033146f},
-std::array<float,2>{0.367319465f, 0.370064169f},
-std::array<float,2>{0.815216362f, 0.979578018f},
-std::array<float,2>{0.877563536f, 0.240747318f},
-std::array<float,2>{0.375284225f, 0.553912103f},
-std::array<float,2>{0.229862288f, 0.46776405f},
-std::array<float,2>{0.57423687f, 0.858759522f},
-std::array<float,2>{0.702135801f, 0.358113736f},
-std::array<float,2>{0.0878858045f, 0.987881124f},
-std::array<float,2>{0.343232512f, 0.0873216987f},
-std::array<float,2>{0.871171772f, 0.709369421f},
-std::array<float,2>{0.781277776f, 0.405231208f},
-std::array<float,2>{0.277891368f, 0.788865924f},
-std::array<float,2>{0.00706943264f, 0.181668863f},
-std::array<float,2>{0.665945053f, 0.563503802f},
-std::array<float,2>{0.562449992f, 0.0480002314f},
-std::array<float,2>{0.169923216f, 0.650543988f},
-std::array<float,2>{0.45835048f, 0.269236833f},
-std::array<float,2>{0.981276631f, 0.924034715f},
-std::array<float,2>{0.837495387f, 0.102165021f},
-std::array<float,2>{0.348688871f, 0.737936378f},
-std::array<float,2>{0.115122095f, 0.313640088f},
-std::array<float,2>{0.728318572f, 0.952510118f},
-std::array<float,2>{0.606899381f, 0.486589253f},
-std::array<float,2>{0.212441429f, 0.837194383f},
-std::array<float,2>{0.414615721f, 0.210892811f},
-std::array<float,2>{0.908556163f, 0.524544477f},
-std::array<float,2>{0.967568338f, 0.284170747f},
-std::array<float,2>{0.48403284f, 0.881058276f},
-std::array<float,2>{0.135330707f, 0.0249107536f},
-std::array<float,2>{0.50706017f, 0.671881497f},
-std::array<float,2>{0.649000168f, 0.155267239f},
-std::array<float,2>{0.031709563f, 0.617053509f},
-std::array<float,2>{0.295347303f, 0.418380231f},
-std::array<float,2>{0.772611856f, 0.757264495f},
-std::array<float,2>{0.916541815f, 0.0785068423f},
-std::array<float,2>{0.413852125f, 0.715999842f},
-std::array<float,2>{0.208005056f, 0.349733531f},
-std::array<float,2>{0.597296774f, 0.993913472f},
-std::array<float,2>{0.719006956f, 0.460434318f},
-std::array<float,2>{0.11857219f, 0.84750843f},
-std::array<float,2>{0.353752047f, 0.243481785f},
-std::array<float,2>{0.833855927f, 0.562416613f},
-std::array<float,2>{0.780408978f, 0.280401498f},
-std::array<float,2>{0.283697814f, 0.937082589f},
-std::array<float,2>{0.0397273302f, 0.0618201531f},
-std::array<float,2>{0.642220199f, 0.647409141f},
-std::array<float,2>{0.513720155f, 0.177019194f},
-std::array<float,2>{0.130859435f, 0.570985138f},
-std::array<float,2>{0.471209407f, 0.391957104f},
-std::array<float,2>{0.957653284f, 0.791249216f},
-std::array<float,2>{0.859957159f, 0.211632416f},
-std::array<float,2>{0.330797106f, 0.517648518f},
-std::array<float,2>{0.0811005533f, 0.499540329f},
-std::array<float,2>{0.69147867f, 0.833689213f},
-std::array<float,2>{0.565151811f, 0.322259903f},
-std::array<float,2>{0.220141843f, 0.944279611f},
-std::array<float,2>{0.386458009f, 0.0964220539f},
-std::array<float,2>{0.887176871f, 0.743704796f},
-std::array<float,2>{0.971912444f, 0.410467654f},
-std::array<float,2>{0.468659848f, 0.765577555f},
-std::array<float,2>{0.163158447f, 0.146369711f},
-std::array<float,2>{0.552983642f, 0.620686769f},
-std::array<float,2>{0.659071445f, 0.0160067119f},
-std::array<float,2>{0.010416613f, 0.682765543f},
-std::array<float,2>{0.267500877f, 0.296517819f},
-std::array<float,2>{0.791603684f, 0.889801204f},
-std::array<float,2>{0.943496168f, 0.137493044f},
-std::array<float,2>{0.484654099f, 0.607979715f},
-std::array<float,2>{0.14619799f, 0.429765552f},
-std::array<float,2>{0.524332106f, 0.778753042f},
-std::array<float,2>{0.625961661f, 0.302435428f},
-std::array<float,2>{0.0495690107f, 0.903230846f},
-std::array<float,2>{0.306132287f, 0.0126555609f},
-std::array<float,2>{0.756287992f, 0.658104718f},
-std::array<float,2>{0.821352363f, 0.48340413f},
-std::array<float,2>{0.361793429f, 0.818687141f},
-std::array<float,2>{0.100779973f, 0.190748081f},
-std::array<float,2>{0.748131573f, 0.510567486f},
-std::array<float,2>{0.622997701f, 0.121998638f},
-std::array<float,2>{0.19494921f, 0.730099499f},
-std::array<float,2>{0.430012792f, 0.332095593f},
-std::array<float,2>{0.922097564f, 0.966065109f},
-std::array<float,2>{0.808138251f, 0.0339859203f},
-std::array<float,2>{0.250296831f, 0.639575601f},
-std::array<float,2>{0.0245549455f, 0.251432598f},
-std::array<float,2>{0.674453616f, 0.915424824f},
-std::array<float,2>{0.538804173f, 0.37824294f},
-std::array<float,2>{0.17225486f, 0.812296748f},
-std::array<float,2>{0.448103964f, 0.167254969f},
-std::array<float,2>{0.991256297f, 0.585827172f},
-std::array<float,2>{0.903546572f, 0.362978518f},
-std::array<float,2>{0.404347092f, 0.972101629f},
-std::array<float,2>{0.240123436f, 0.0779471695f},
-std::array<float,2>{0.583985567f, 0.701171696f},
-std::array<float,2>{0.707619011f, 0.224176794f},
-std::array<float,2>{0.0744068474f, 0.532827973f},
-std::array<float,2>{0.315800518f, 0.444488913f},
-std::array<float,2>{0.850444138f, 0.861066282f},
-std::array<float,2>{0.976011693f, 0.0680485591f},
-std::array<float,2>{0.463369071f, 0.69027853f},
-std::array<float,2>{0.158209562f, 0.374905705f},
-std::array<float,2>{0.548895419f, 0.984085023f},
-std::array<float,2>{0.661835909f, 0.446887434f},
-std::array<float,2>{0.0124674197f, 0.872802436f},
-std::array<float,2>{0.270249605f, 0.229660705f},
-std::array<float,2>{0.793970704f, 0.545137584f},
-std::array<float,2>{0.863382638f, 0.258030266f},
-std::array<float,2>{0.335908145f, 0.908601224f},
-std::array<float,2>{0.0829042867f, 0.0452727713f},
-std::array<float,2>{0.690557539f, 0.629337788f},
-std::array<float,2>{0.568208873f, 0.15971911f},
-std::array<float,2>{0.223948821f, 0.590881765f},
-std::array<float,2>{0.389498293f, 0.383663863f},
-std::array<float,2>{0.886526704f, 0.801353574f},
-std::array<float,2>{0.776534617f, 0.195324272f},
-std::array<float,2>{0.287703365f, 0.506552756f},
-std::array<float,2>{0.0452033393f, 0.471009642f},
-std::array<float,2>{0.647896707f, 0.827612281f},
-std::array<float,2>{0.508443475f, 0.339309692f},
-std::array<float,2>{0.128100052f, 0.957768917f},
-std::array<float,2>{0.475454122f, 0.110101931f},
-std::array<float,2>{0.954469562f, 0.72636652f},
-std::array<float,2>{0.919665873f, 0.425578713f},
-std::array<float,2>{0.408914745f, 0.773109436f},
-std::array<float,2>{0.204158604f, 0.127657503f},
-std::array<float,2>{0.598532677f, 0.597588539f},
-std::array<float,2>{0.725047708f, 0.0034503676f},
-std::array<float,2>{0.121483944f, 0.66414535f},
-std::array<float,2>{0.358389646f, 0.3064107f},
-std::array<float,2>{0.831124663f, 0.890978158f},
-std::array<float,2>{0.90004468f, 0.150975153f},
-std::array<float,2>{0.400280446f, 0.610463858f},
-std::array<float,2>{0.23458457f, 0.417064995f},
-std::array<float,2>{0.578270555f, 0.753888249f},
-std::array<float,2>{0.706996381f, 0.286846071f},
-std::array<float,2>{0.0739181191f, 0.878205419f},
-std::array<float,2>{0.319712043f, 0.0292534642f},
-std::array<float,2>{0.847022951f, 0.676564157f},
-std::array<float,2>{0.812371552f, 0.491729438f},
-std::array<float,2>{0.25659579f, 0.843511283f},
-std::array<float,2>{0.027477704f, 0.20596458f},
-std::array<float,2>{0.677847326f, 0.530293822f},
-std::array<float,2>{0.533492506f, 0.106454752f},
-std::array<float,2>{0.178472131f, 0.740129709f},
-std::array<float,2>{0.449935168f, 0.316612512f},
-std::array<float,2>{0.987598062f, 0.945888519f},
-std::array<float,2>{0.826685786f, 0.0516574979f},
-std::array<float,2>{0.365345329f, 0.654167831f},
-std::array<float,2>{0.0973201841f, 0.27114293f},
-std::array<float,2>{0.742615342f, 0.927593708f},
-std::array<float,2>{0.620595217f, 0.399442881f},
-std::array<float,2>{0.190273404f, 0.781722724f},
-std::array<float,2>{0.436613649f, 0.185629681f},
-std::array<float,2>{0.928926706f, 0.56880945f},
-std::array<float,2>{0.939061701f, 0.352997452f},
-std::array<float,2>{0.489979744f, 0.988781929f},
-std::array<float,2>{0.144010767f, 0.0901194438f},
-std::array<float,2>{0.528398514f, 0.703897774f},
-std::array<float,2>{0.630433619f, 0.237691835f},
-std::array<float,2>{0.0546000637f, 0.549053669f},
-std::array<float,2>{0.309219658f, 0.461104333f},
-std::array<float,2>{0.750499964f, 0.854649544f},
-std::array<float,2>{0.933514535f, 0.0232798401f},
-std::array<float,2>{0.427404463f, 0.684157073f},
-std::array<float,2>{0.195913672f, 0.289901793f},
-std::array<float,2>{0.615759552f, 0.883482933f},
-std::array<float,2>{0.74133271f, 0.410100728f},
-std::array<float,2>{0.107005931f, 0.760327518f},
-std::array<float,2>{0.372520566f, 0.144520059f},
-std::array<float,2>{0.817092299f, 0.623812675f},
-std::array<float,2>{0.763443291f, 0.327439338f},
-std::array<float,2>{0.29752478f, 0.938649058f},
-std::array<float,2>{0.0562596396f, 0.0993887559f},
-std::array<float,2>{0.636490226f, 0.748816729f},
-std::array<float,2>{0.519286096f, 0.216405615f},
-std::array<float,2>{0.150225371f, 0.523401618f},
-std::array<float,2>{0.499483973f, 0.496010303f},
-std::array<float,2>{0.945557594f, 0.828384221f},
-std::array<float,2>{0.856105745f, 0.173877239f},
-std::array<float,2>{0.323893875f, 0.574836135f},
-std::array<float,2>{0.0652432889f, 0.397040546f},
-std::array<float,2>{0.711941302f, 0.794465005f},
-std::array<float,2>{0.588161409f, 0.273973972f},
-std::array<float,2>{0.243810311f, 0.9307307f},
-std::array<float,2>{0.393845499f, 0.0572092608f},
-std::array<float,2>{0.891772687f, 0.64071548f},
-std::array<float,2>{0.998939335f, 0.456383258f},
-std::array<float,2>{0.441125542f, 0.850721717f},
-std::array<float,2>{0.183550119f, 0.247774199f},
-std::array<float,2>{0.545557141f, 0.556755245f},
-std::array<float,2>{0.685953856f, 0.0823197961f},
-std::array<float,2>{0.0165329482f, 0.713054061f},
-std::array<float,2>{0.262030512f, 0.34607327f},
-std::array<float,2>{0.802019715f, 0.996217191f},
-std::array<float,2>{0.961115956f, 0.219177574f},
-std::array<float,2>{0.479821205f, 0.537033498f},
-std::array<float,2>{0.139812469f, 0.441128671f},
-std::array<float,2>{0.501425266f, 0.863525748f},
-std::array<float,2>{0.65479511f, 0.36666438f},
-std::array<float,2>{0.0379037708f, 0.974572003f},
-std::array<float,2>{0.290187031f, 0.0727770403f},
-std::array<float,2>{0.767817676f, 0.69600296f},
-std::array<float,2>{0.841615498f, 0.381677061f},
-std::array<float,2>{0.344977379f, 0.807395399f},
-std::array<float,2>{0.112489656f, 0.168931991f},
-std::array<float,2>{0.731022f, 0.578810692f},
-std::array<float,2>{0.604941607f, 0.038539961f},
-std::array<float,2>{0.215921849f, 0.634570837f},
-std::array<float,2>{0.41892615f, 0.254820138f},
-std::array<float,2>{0.913962543f, 0.9192788f},
-std::array<float,2>{0.787701964f, 0.119959146f},
-std::array<float,2>{0.276009262f, 0.732413054f},
-std::array<float,2>{0.00194660411f, 0.328943104f},
-std::array<float,2>{0.66831553f, 0.963249862f},
-std::array<float,2>{0.555958748f, 0.476872116f},
-std::array<float,2>{0.165246263f, 0.814570665f},
-std::array<float,2>{0.454811692f, 0.193878695f},
-std::array<float,2>{0.979073167f, 0.514829397f},
-std::array<float,2>{0.880608141f, 0.299119353f},
-std::array<float,2>{0.382457614f, 0.899142921f},
-std::array<float,2>{0.232240617f, 0.00975596532f},
-std::array<float,2>{0.570577443f, 0.660169005f},
-std::array<float,2>{0.697986066f, 0.134346575f},
-std::array<float,2>{0.0935855955f, 0.603547156f},
-std::array<float,2>{0.339258313f, 0.4355762f},
-std::array<float,2>{0.867684066f, 0.776567042f},
-std::array<float,2>{0.950564742f, 0.0403100476f},
-std::array<float,2>{0.492287338f, 0.625363231f},
-std::array<float,2>{0.154644877f, 0.263182312f},
-std::array<float,2>{0.521083355f, 0.912998021f},
-std::array<float,2>{0.639563084f, 0.389121741f},
-std::array<float,2>{0.0596328378f, 0.799067438f},
-std::array<float,2>{0.302072704f, 0.160341427f},
-std::array<float,2>{0.758128166f, 0.586779654f},
-std::array<float,2>{0.814159811f, 0.367904961f},
-std::array<float,2>{0.369244397f, 0.97734642f},
-std::array<float,2>{0.101786897f, 0.0641214326f},
-std::array<float,2>{0.736899137f, 0.692868173f},
-std::array<float,2>{0.609446049f, 0.232683495f},
-std::array<float,2>{0.201308236f, 0.54175061f},
-std::array<float,2>{0.425273627f, 0.450937897f},
-std::array<float,2>{0.933826983f, 0.869441152f},
-std::array<float,2>{0.799759388f, 0.130595535f},
-std::array<float,2>{0.261440098f, 0.599879742f},
-std::array<float,2>{0.0207303856f, 0.428164482f},
-std::array<float,2>{0.681896269f, 0.768111885f},
-std::array<float,2>{0.542316318f, 0.308596551f},
-std::array<float,2>{0.187292174f, 0.896720111f},
-std::array<float,2>{0.443971425f, 0.00509556709f},
-std::array<float,2>{0.993165195f, 0.670881689f},
-std::array<float,2>{0.897808552f, 0.473884165f},
-std::array<float,2>{0.396113396f, 0.821610868f},
-std::array<float,2>{0.247535303f, 0.199567541f},
-std::array<float,2>{0.589983463f, 0.501623333f},
-std::array<float,2>{0.716314971f, 0.114076361f},
-std::array<float,2>{0.0686191022f, 0.721556306f},
-std::array<float,2>{0.324883699f, 0.341572046f},
-std::array<float,2>{0.85206908f, 0.957024038f},
-std::array<float,2>{0.907938361f, 0.208088756f},
-std::array<float,2>{0.416030496f, 0.52703625f},
-std::array<float,2>{0.213967487f, 0.485446095f},
-std::array<float,2>{0.607868135f, 0.83816582f},
-std::array<float,2>{0.729989707f, 0.316114604f},
-std::array<float,2>{0.115519881f, 0.950984299f},
-std::array<float,2>{0.350663602f, 0.105064638f},
-std::array<float,2>{0.839370131f, 0.735721886f},
-std::array<float,2>{0.7697559f, 0.421595871f},
-std::array<float,2>{0.294817537f, 0.755096614f},
-std::array<float,2>{0.0348255113f, 0.152490601f},
-std::array<float,2>{0.652209997f, 0.614420295f},
-std::array<float,2>{0.505825341f, 0.0268555135f},
-std::array<float,2>{0.133391455f, 0.674014151f},
-std::array<float,2>{0.481326371f, 0.282288015f},
-std::array<float,2>{0.966341913f, 0.879539192f},
-std::array<float,2>{0.874690115f, 0.0887951627f},
-std::array<float,2>{0.340112746f, 0.708962679f},
-std::array<float,2>{0.0896712616f, 0.355964512f},
-std::array<float,2>{0.700001061f, 0.98598516f},
-std::array<float,2>{0.577251911f, 0.465443492f},
-std::array<float,2>{0.227267504f, 0.855934799f},
-std::array<float,2>{0.378720194f, 0.238724381f},
-std::array<float,2>{0.875832081f, 0.551892281f},
-std::array<float,2>{0.982914031f, 0.266460568f},
-std::array<float,2>{0.460097849f, 0.922852159f},
-std::array<float,2>{0.16885592f, 0.0493003912f},
-std::array<float,2>{0.559209347f, 0.648704648f},
-std::array<float,2>{0.667596281f, 0.179797843f},
-std::array<float,2>{0.00539269857f, 0.566197693f},
-std::array<float,2>{0.280412287f, 0.402572602f},
-std::array<float,2>{0.784540534f, 0.785570443f},
-std::array<float,2>{0.889943659f, 0.0954208672f},
-std::array<float,2>{0.38314572f, 0.745020151f},
-std::array<float,2>{0.222466454f, 0.322616935f},
-std::array<float,2>{0.562568069f, 0.942834973f},
-std::array<float,2>{0.694844604f, 0.496370018f},
-std::array<float,2>{0.078987658f, 0.83511436f},
-std::array<float,2>{0.329228818f, 0.213040933f},
-std::array<float,2>{0.861754715f, 0.516945481f},
-std::array<float,2>{0.7900877f, 0.29398632f},
-std::array<float,2>{0.267991006f, 0.887021661f},
-std::array<float,2>{0.00816851854f, 0.0182662606f},
-std::array<float,2>{0.656879067f, 0.681470394f},
-std::array<float,2>{0.550828636f, 0.147633538f},
-std::array<float,2>{0.161096349f, 0.61728704f},
-std::array<float,2>{0.465530097f, 0.412587643f},
-std::array<float,2>{0.969930649f, 0.763274074f},
-std::array<float,2>{0.835392237f, 0.244755268f},
-std::array<float,2>{0.351754695f, 0.560389578f},
-std::array<float,2>{0.12026044f, 0.457437903f},
-std::array<float,2>{0.721354246f, 0.844616652f},
-std::array<float,2>{0.594104826f, 0.349114597f},
-std::array<float,2>{0.209989816f, 0.995717347f},
-std::array<float,2>{0.411590785f, 0.0802132264f},
-std::array<float,2>{0.915931642f, 0.717765033f},
-std::array<float,2>{0.960175514f, 0.393491536f},
-std::array<float,2>{0.470353186f, 0.789949656f},
-std::array<float,2>{0.129101202f, 0.178600907f},
-std::array<float,2>{0.511816859f, 0.574040234f},
-std::array<float,2>{0.644352257f, 0.0594507456f},
-std::array<float,2>{0.0429139659f, 0.645047784f},
-std::array<float,2>{0.281993449f, 0.277649641f},
-std::array<float,2>{0.778441072f, 0.934871972f},
-std::array<float,2>{0.989193797f, 0.165958837f},
-std::array<float,2>{0.446094602f, 0.583172381f},
-std::array<float,2>{0.174394578f, 0.376380324f},
-std::array<float,2>{0.536920905f, 0.81000936f},
-std::array<float,2>{0.673227429f, 0.252994269f},
-std::array<float,2>{0.0260786004f, 0.916731298f},
-std::array<float,2>{0.253568351f, 0.0318951868f},
-std::array<float,2>{0.8061378f, 0.637874603f},
-std::array<float,2>{0.848962843f, 0.441658646f},
-std::array<float,2>{0.31371817f, 0.86323911f},
-std::array<float,2>{0.076886937f, 0.22534278f},
-std::array<float,2>{0.709885716f, 0.533689201f},
-std::array<float,2>{0.583602786f, 0.0752466545f},
-std::array<float,2>{0.241152823f, 0.702546775f},
-std::array<float,2>{0.403001904f, 0.360918671f},
-std::array<float,2>{0.904859424f, 0.970665693f},
-std::array<float,2>{0.754415989f, 0.0153407324f},
-std::array<float,2>{0.306921959f, 0.6589185f},
-std::array<float,2>{0.0468892492f, 0.303555995f},
-std::array<float,2>{0.627713501f, 0.905183971f},
-std::array<float,2>{0.526813209f, 0.431672305f},
-std::array<float,2>{0.147759244f, 0.780870557f},
-std::array<float,2>{0.486391604f, 0.140138432f},
-std::array<float,2>{0.942322969f, 0.606359601f},
-std::array<float,2>{0.925472498f, 0.33539927f},
-std::array<float,2>{0.433496535f, 0.967657268f},
-std::array<float,2>{0.191497952f, 0.123229273f},
-std::array<float,2>{0.624052703f, 0.728461087f},
-std::array<float,2>{0.747367382f, 0.188069254f},
-std::array<float,2>{0.0988107696f, 0.508320749f},
-std::array<float,2>{0.360320657f, 0.482358426f},
-std::array<float,2>{0.823973954f, 0.817536116f},
-std::array<float,2>{0.986892641f, 0.10911984f},
-std::array<float,2>{0.451041877f, 0.741586983f},
-std::array<float,2>{0.179396033f, 0.318926662f},
-std::array<float,2>{0.534238994f, 0.94775176f},
-std::array<float,2>{0.679679334f, 0.489672124f},
-std::array<float,2>{0.0284512974f, 0.841468334f},
-std::array<float,2>{0.257375091f, 0.204756424f},
-std::array<float,2>{0.811383307f, 0.529203951f},
-std::array<float,2>{0.845820904f, 0.28748697f},
-std::array<float,2>{0.318808079f, 0.876077116f},
-std::array<float,2>{0.0730292052f, 0.0303302612f},
-std::array<float,2>{0.705775797f, 0.678161204f},
-std::array<float,2>{0.579781473f, 0.148724675f},
-std::array<float,2>{0.235805795f, 0.611860752f},
-std::array<float,2>{0.398784071f, 0.415541798f},
-std::array<float,2>{0.899025381f, 0.750435233f},
-std::array<float,2>{0.751662374f, 0.234693885f},
-std::array<float,2>{0.309738934f, 0.548816681f},
-std::array<float,2>{0.0534563959f, 0.464121491f},
-std::array<float,2>{0.629007041f, 0.851576626f},
-std::array<float,2>{0.527655423f, 0.353742272f},
-std::array<float,2>{0.142972156f, 0.9911744f},
-std::array<float,2>{0.489081085f, 0.0928816274f},
-std::array<float,2>{0.93832171f, 0.706283391f},
-std::array<float,2>{0.928132474f, 0.401595652f},
-std::array<float,2>{0.435594082f, 0.784021974f},
-std::array<float,2>{0.190492481f, 0.18456912f},
-std::array<float,2>{0.619883657f, 0.568103433f},
-std::array<float,2>{0.743447542f, 0.0533671416f},
-std::array<float,2>{0.096346505f, 0.654995263f},
-std::array<float,2>{0.367001384f, 0.271882117f},
-std::array<float,2>{0.827469826f, 0.928013504f},
-std::array<float,2>{0.885130763f, 0.157681093f},
-std::array<float,2>{0.390503794f, 0.59349829f},
-std::array<float,2>{0.223267481f, 0.38560766f},
-std::array<float,2>{0.566441238f, 0.803798795f},
-std::array<float,2>{0.689467311f, 0.261018127f},
-std::array<float,2>{0.083070308f, 0.906297028f},
-std::array<float,2>{0.334219664f, 0.0435366184f},
-std::array<float,2>{0.865134478f, 0.632280231f},
-std::array<float,2>{0.793302238f, 0.448460072f},
-std::array<float,2>{0.270711094f, 0.874563277f},
-std::array<float,2>{0.0130921183f, 0.227509379f},
-std::array<float,2>{0.660412729f, 0.543226182f},
-std::array<float,2>{0.55011493f, 0.0684731454f},
-std::array<float,2>{0.15954414f, 0.687751114f},
-std::array<float,2>{0.464736551f, 0.371437609f},
-std::array<float,2>{0.974869609f, 0.981123686f},
-std::array<float,2>{0.830875516f, 0.00140143593f},
-std::array<float,2>{0.35894984f, 0.666585088f},
-std::array<float,2>{0.122374952f, 0.308194011f},
-std::array<float,2>{0.72619617f, 0.893945217f},
-std::array<float,2>{0.599421382f, 0.421875536f},
-std::array<float,2>{0.203751206f, 0.771216869f},
-std::array<float,2>{0.409747541f, 0.125331357f},
-std::array<float,2>{0.917997718f, 0.594747663f},
-std::array<float,2>{0.95385915f, 0.335991144f},
-std::array<float,2>{0.475922734f, 0.95921886f},
-std::array<float,2>{0.127438784f, 0.112084679f},
-std::array<float,2>{0.508792818f, 0.724257827f},
-std::array<float,2>{0.646672308f, 0.197316721f},
-std::array<float,2>{0.0461140834f, 0.504324853f},
-std::array<float,2>{0.288131684f, 0.470201284f},
-std::array<float,2>{0.776245236f, 0.825350523f},
-std::array<float,2>{0.912360609f, 0.0359365717f},
-std::array<float,2>{0.419498324f, 0.636636853f},
-std::array<float,2>{0.2152123f, 0.257323474f},
-std::array<float,2>{0.603663146f, 0.920752823f},
-std::array<float,2>{0.732204318f, 0.379185885f},
-std::array<float,2>{0.112284414f, 0.804709435f},
-std::array<float,2>{0.344104618f, 0.170290023f},
-std::array<float,2>{0.840735972f, 0.581700742f},
-std::array<float,2>{0.769334376f, 0.363484323f},
-std::array<float,2>{0.289143622f, 0.975393713f},
-std::array<float,2>{0.0384629071f, 0.0711384192f},
-std::array<float,2>{0.655682802f, 0.698692024f},
-std::array<float,2>{0.500170469f, 0.221834973f},
-std::array<float,2>{0.138762251f, 0.538188875f},
-std::array<float,2>{0.479249746f, 0.437633514f},
-std::array<float,2>{0.962140977f, 0.867180705f},
-std::array<float,2>{0.868719161f, 0.135604545f},
-std::array<float,2>{0.338718385f, 0.603431523f},
-std::array<float,2>{0.0926402584f, 0.434941471f},
-std::array<float,2>{0.698610663f, 0.773616135f},
-std::array<float,2>{0.571930408f, 0.297471702f},
-std::array<float,2>{0.231404126f, 0.90062809f},
-std::array<float,2>{0.381763786f, 0.0112188123f},
-std::array<float,2>{0.879596353f, 0.662121832f},
-std::array<float,2>{0.980291605f, 0.479009688f},
-std::array<float,2>{0.453352869f, 0.812820852f},
-std::array<float,2>{0.164694503f, 0.191754922f},
-std::array<float,2>{0.554878175f, 0.513442039f},
-std::array<float,2>{0.669406533f, 0.118942671f},
-std::array<float,2>{0.000477492285f, 0.733163178f},
-std::array<float,2>{0.277166307f, 0.33171007f},
-std::array<float,2>{0.788344324f, 0.962141216f},
-std::array<float,2>{0.947089553f, 0.218151584f},
-std::array<float,2>{0.498162925f, 0.520762205f},
-std::array<float,2>{0.148641884f, 0.493615508f},
-std::array<float,2>{0.5183478f, 0.831627071f},
-std::array<float,2>{0.63545692f, 0.325352997f},
-std::array<float,2>{0.0552081801f, 0.940591931f},
-std::array<float,2>{0.298746079f, 0.100044198f},
-std::array<float,2>{0.762001991f, 0.74693346f},
-std::array<float,2>{0.818210423f, 0.407010287f},
-std::array<float,2>{0.371616989f, 0.759533942f},
-std::array<float,2>{0.106052913f, 0.141915068f},
-std::array<float,2>{0.740280747f, 0.621833444f},
-std::array<float,2>{0.616485298f, 0.0203237645f},
-std::array<float,2>{0.19652763f, 0.686563551f},
-std::array<float,2>{0.426011086f, 0.292126566f},
-std::array<float,2>{0.932589233f, 0.885415137f},
-std::array<float,2>{0.801233888f, 0.0855194032f},
-std::array<float,2>{0.263349324f, 0.71235007f},
-std::array<float,2>{0.0169557296f, 0.344112009f},
-std::array<float,2>{0.686988473f, 0.999771953f},
-std::array<float,2>{0.546152353f, 0.454883844f},
-std::array<float,2>{0.181986392f, 0.848450184f},
-std::array<float,2>{0.439820498f, 0.2484501f},
-std::array<float,2>{0.999661863f, 0.55606401f},
-std::array<float,2>{0.891049027f, 0.277145982f},
-std::array<float,2>{0.393207729f, 0.932233632f},
-std::array<float,2>{0.242975965f, 0.0546878614f},
-std::array<float,2>{0.589329541f, 0.643307865f},
-std::array<float,2>{0.711605966f, 0.173454076f},
-std::array<float,2>{0.0655995011f, 0.577687144f},
-std::array<float,2>{0.322448224f, 0.396100551f},
-std::array<float,2>{0.85655576f, 0.794935346f},
-std::array<float,2>{0.965358675f, 0.0241781585f},
-std::array<float,2>{0.481830209f, 0.672943175f},
-std::array<float,2>{0.133907348f, 0.284274131f},
-std::array<float,2>{0.504602015f, 0.882771492f},
-std::array<float,2>{0.651100159f, 0.419307321f},
-std::array<float,2>{0.0339934006f, 0.756121993f},
-std::array<float,2>{0.293380827f, 0.155790329f},
-std::array<float,2>{0.771081984f, 0.615533233f},
-std::array<float,2>{0.838130474f, 0.31310007f},
-std::array<float,2>{0.349939585f, 0.951686502f},
-std::array<float,2>{0.117129654f, 0.103193916f},
-std::array<float,2>{0.729016721f, 0.736923754f},
-std::array<float,2>{0.609118044f, 0.209313169f},
-std::array<float,2>{0.213603303f, 0.524313271f},
-std::array<float,2>{0.417612731f, 0.487989306f},
-std::array<float,2>{0.906265974f, 0.836049199f},
-std::array<float,2>{0.78328383f, 0.182697296f},
-std::array<float,2>{0.280171961f, 0.562913001f},
-std::array<float,2>{0.00404115533f, 0.406139344f},
-std::array<float,2>{0.666632175f, 0.787204444f},
-std::array<float,2>{0.559836507f, 0.268355161f},
-std::array<float,2>{0.169191822f, 0.924859822f},
-std::array<float,2>{0.459506571f, 0.0476725101f},
-std::array<float,2>{0.984276474f, 0.651589453f},
-std::array<float,2>{0.876599431f, 0.468054682f},
-std::array<float,2>{0.377107382f, 0.85781312f},
-std::array<float,2>{0.228325769f, 0.241568506f},
-std::array<float,2>{0.576235771f, 0.552963912f},
-std::array<float,2>{0.700209498f, 0.0865715444f},
-std::array<float,2>{0.0884843916f, 0.71044594f},
-std::array<float,2>{0.340967f, 0.35901618f},
-std::array<float,2>{0.87379086f, 0.987264574f},
-std::array<float,2>{0.93481952f, 0.230881125f},
-std::array<float,2>{0.423936635f, 0.53963387f},
-std::array<float,2>{0.203124478f, 0.451645344f},
-std::array<float,2>{0.61099565f, 0.86749649f},
-std::array<float,2>{0.737495363f, 0.370654315f},
-std::array<float,2>{0.103050068f, 0.979156375f},
-std::array<float,2>{0.370230734f, 0.0661379695f},
-std::array<float,2>{0.813419819f, 0.694982111f},
-std::array<float,2>{0.759587586f, 0.387766242f},
-std::array<float,2>{0.300884485f, 0.798336267f},
-std::array<float,2>{0.0593737103f, 0.163972706f},
-std::array<float,2>{0.639852822f, 0.589634657f},
-std::array<float,2>{0.519536912f, 0.0429380052f},
-std::array<float,2>{0.155453935f, 0.626982152f},
-std::array<float,2>{0.493647009f, 0.265400857f},
-std::array<float,2>{0.949621737f, 0.912108481f},
-std::array<float,2>{0.853011906f, 0.116854154f},
-std::array<float,2>{0.326071173f, 0.72027868f},
-std::array<float,2>{0.0699997395f, 0.343437374f},
-std::array<float,2>{0.715761244f, 0.954342902f},
-std::array<float,2>{0.590893209f, 0.474859834f},
-std::array<float,2>{0.246699676f, 0.82312572f},
-std::array<float,2>{0.39531523f, 0.202319503f},
-std::array<float,2>{0.896741748f, 0.503072739f},
-std::array<float,2>{0.992360771f, 0.311398387f},
-std::array<float,2>{0.444702506f, 0.896186709f},
-std::array<float,2>{0.186353639f, 0.007157858f},
-std::array<float,2>{0.541983485f, 0.669449866f},
-std::array<float,2>{0.682773829f, 0.132246509f},
-std::array<float,2>{0.0199033041f, 0.599142432f},
-std::array<float,2>{0.260531306f, 0.425800025f},
-std::array<float,2>{0.80027324f, 0.767359853f},
-std::array<float,2>{0.905538678f, 0.0768599287f},
-std::array<float,2>{0.40364185f, 0.699282706f},
-std::array<float,2>{0.241613567f, 0.362059265f},
-std::array<float,2>{0.582527757f, 0.971585095f},
-std::array<float,2>{0.710765779f, 0.443638235f},
-std::array<float,2>{0.0772199929f, 0.860040486f},
-std::array<float,2>{0.313365668f, 0.222961813f},
-std::array<float,2>{0.848344445f, 0.532072484f},
-std::array<float,2>{0.805197895f, 0.250866771f},
-std::array<float,2>{0.2524876f, 0.914943993f},
-std::array<float,2>{0.0263892505f, 0.0349038355f},
-std::array<float,2>{0.672023952f, 0.640126705f},
-std::array<float,2>{0.535787046f, 0.166558281f},
-std::array<float,2>{0.175378695f, 0.58465153f},
-std::array<float,2>{0.447002739f, 0.377325684f},
-std::array<float,2>{0.990026891f, 0.811015189f},
-std::array<float,2>{0.822802365f, 0.189887449f},
-std::array<float,2>{0.360557288f, 0.511242747f},
-std::array<float,2>{0.0984046534f, 0.482526809f},
-std::array<float,2>{0.747026742f, 0.820207357f},
-std::array<float,2>{0.623206079f, 0.333326191f},
-std::array<float,2>{0.192495957f, 0.965023398f},
-std::array<float,2>{0.432226866f, 0.122656308f},
-std::array<float,2>{0.924499154f, 0.728924394f},
-std::array<float,2>{0.943282664f, 0.430990309f},
-std::array<float,2>{0.488253146f, 0.778241754f},
-std::array<float,2>{0.14697957f, 0.138574436f},
-std::array<float,2>{0.526293516f, 0.608670235f},
-std::array<float,2>{0.628682375f, 0.0129231187f},
-std::array<float,2>{0.0479634739f, 0.656276166f},
-std::array<float,2>{0.307972729f, 0.301155448f},
-std::array<float,2>{0.755123377f, 0.903395355f},
-std::array<float,2>{0.969362736f, 0.145201832f},
-std::array<float,2>{0.465854734f, 0.619827867f},
-std::array<float,2>{0.161869556f, 0.411583811f},
-std::array<float,2>{0.552703679f, 0.764425337f},
-std::array<float,2>{0.657717943f, 0.295612633f},
-std::array<float,2>{0.00965352822f, 0.889518917f},
-std::array<float,2>{0.269461513f, 0.0166821089f},
-std::array<float,2>{0.789586604f, 0.681869149f},
-std::array<float,2>{0.862343609f, 0.498536348f},
-std::array<float,2>{0.328677058f, 0.832197607f},
-std::array<float,2>{0.0798676386f, 0.212003335f},
-std::array<float,2>{0.693862915f, 0.518974721f},
-std::array<float,2>{0.564242125f, 0.0972956121f},
-std::array<float,2>{0.220762312f, 0.742696226f},
-std::array<float,2>{0.384343415f, 0.321117938f},
-std::array<float,2>{0.88903898f, 0.944382429f},
-std::array<float,2>{0.778148115f, 0.0610214137f},
-std::array<float,2>{0.282473654f, 0.647932708f},
-std::array<float,2>{0.0419624746f, 0.280230552f},
-std::array<float,2>{0.64290607f, 0.93617624f},
-std::array<float,2>{0.512698293f, 0.391516924f},
-std::array<float,2>{0.130671561f, 0.792446434f},
-std::array<float,2>{0.469663382f, 0.17593652f},
-std::array<float,2>{0.959337652f, 0.571775615f},
-std::array<float,2>{0.914942801f, 0.351314515f},
-std::array<float,2>{0.410640568f, 0.992575109f},
-std::array<float,2>{0.209318995f, 0.0794293657f},
-std::array<float,2>{0.595627606f, 0.715210557f},
-std::array<float,2>{0.721782923f, 0.242913768f},
-std::array<float,2>{0.119313151f, 0.560748339f},
-std::array<float,2>{0.352990627f, 0.459523886f},
-std::array<float,2>{0.834041357f, 0.846244156f},
-std::array<float,2>{0.940318227f, 0.0908918977f},
-std::array<float,2>{0.49158144f, 0.704576135f},
-std::array<float,2>{0.142385364f, 0.351786524f},
-std::array<float,2>{0.529355645f, 0.989692152f},
-std::array<float,2>{0.631552279f, 0.462326705f},
-std::array<float,2>{0.0520891286f, 0.854228735f},
-std::array<float,2>{0.311896443f, 0.236648753f},
-std::array<float,2>{0.752652586f, 0.550767481f},
-std::array<float,2>{0.824793398f, 0.269674242f},
-std::array<float,2>{0.364256471f, 0.925900936f},
-std::array<float,2>{0.093980059f, 0.0519204065f},
-std::array<float,2>{0.745695353f, 0.653101981f},
-std::array<float,2>{0.618639827f, 0.186739981f},
-std::array<float,2>{0.189131007f, 0.569498718f},
-std::array<float,2>{0.435075343f, 0.399281502f},
-std::array<float,2>{0.927172601f, 0.782590687f},
-std::array<float,2>{0.810366869f, 0.206642091f},
-std::array<float,2>{0.255782634f, 0.529701769f},
-std::array<float,2>{0.0294334162f, 0.490865886f},
-std::array<float,2>{0.676769078f, 0.84206742f},
-std::array<float,2>{0.531559706f, 0.318124354f},
-std::array<float,2>{0.176523298f, 0.946690083f},
-std::array<float,2>{0.452519953f, 0.105554841f},
-std::array<float,2>{0.984904647f, 0.738886178f},
-std::array<float,2>{0.901757479f, 0.416990548f},
-std::array<float,2>{0.401340187f, 0.752033591f},
-std::array<float,2>{0.23671779f, 0.151703849f},
-std::array<float,2>{0.581427038f, 0.609483898f},
-std::array<float,2>{0.704886377f, 0.0279946495f},
-std::array<float,2>{0.0716391355f, 0.676813722f},
-std::array<float,2>{0.317310095f, 0.28545171f},
-std::array<float,2>{0.844935179f, 0.877864897f},
-std::array<float,2>{0.920094192f, 0.128554016f},
-std::array<float,2>{0.407210708f, 0.595938325f},
-std::array<float,2>{0.205107883f, 0.424762696f},
-std::array<float,2>{0.600798666f, 0.771759391f},
-std::array<float,2>{0.723055363f, 0.305483192f},
-std::array<float,2>{0.12420132f, 0.892502069f},
-std::array<float,2>{0.356591851f, 0.00259499112f},
-std::array<float,2>{0.829454005f, 0.665130258f},
-std::array<float,2>{0.774183333f, 0.472227961f},
-std::array<float,2>{0.285162091f, 0.826604545f},
-std::array<float,2>{0.0446738489f, 0.197064176f},
-std::array<float,2>{0.646342635f, 0.507117391f},
-std::array<float,2>{0.511390686f, 0.110753052f},
-std::array<float,2>{0.126382753f, 0.724962294f},
-std::array<float,2>{0.473656416f, 0.337964237f},
-std::array<float,2>{0.955515027f, 0.958193898f},
-std::array<float,2>{0.866909504f, 0.0467339568f},
-std::array<float,2>{0.332984537f, 0.630076349f},
-std::array<float,2>{0.0843146294f, 0.259292483f},
-std::array<float,2>{0.68853116f, 0.910134912f},
-std::array<float,2>{0.569119751f, 0.383953661f},
-std::array<float,2>{0.225524038f, 0.802370131f},
-std::array<float,2>{0.387187839f, 0.158336714f},
-std::array<float,2>{0.883919895f, 0.589932561f},
-std::array<float,2>{0.972775578f, 0.373769015f},
-std::array<float,2>{0.461179942f, 0.982463658f},
-std::array<float,2>{0.156787217f, 0.067205295f},
-std::array<float,2>{0.547630966f, 0.690829635f},
-std::array<float,2>{0.662160575f, 0.228806481f},
-std::array<float,2>{0.0145306224f, 0.546663463f},
-std::array<float,2>{0.272442669f, 0.445763022f},
-std::array<float,2>{0.79572618f, 0.871731341f},
-std::array<float,2>{0.881887317f, 0.00787738804f},
-std::array<float,2>{0.379355997f, 0.661880791f},
-std::array<float,2>{0.234174773f, 0.300230354f},
-std::array<float,2>{0.573210299f, 0.899894774f},
-std::array<float,2>{0.695968509f, 0.437141836f},
-std::array<float,2>{0.0910665914f, 0.775954366f},
-std::array<float,2>{0.337551594f, 0.133660674f},
-std::array<float,2>{0.870275497f, 0.604611754f},
-std::array<float,2>{0.786495149f, 0.329788923f},
-std::array<float,2>{0.273818672f, 0.964101613f},
-std::array<float,2>{0.00383547158f, 0.120123535f},
-std::array<float,2>{0.670669198f, 0.731327355f},
-std::array<float,2>{0.558196306f, 0.195273161f},
-std::array<float,2>{0.167608961f, 0.514268637f},
-std::array<float,2>{0.456961483f, 0.478296101f},
-std::array<float,2>{0.978473067f, 0.816259146f},
-std::array<float,2>{0.842814207f, 0.169688091f},
-std::array<float,2>{0.346581489f, 0.579314947f},
-std::array<float,2>{0.1112139f, 0.38192907f},
-std::array<float,2>{0.733494043f, 0.808150768f},
-std::array<float,2>{0.601821959f, 0.255854219f},
-std::array<float,2>{0.218373075f, 0.918888807f},
-std::array<float,2>{0.420325696f, 0.0379553549f},
-std::array<float,2>{0.91043359f, 0.633158803f},
-std::array<float,2>{0.963001311f, 0.440137565f},
-std::array<float,2>{0.477199972f, 0.864364505f},
-std::array<float,2>{0.137211263f, 0.219807431f},
-std::array<float,2>{0.502832949f, 0.535579026f},
-std::array<float,2>{0.653486609f, 0.0737665743f},
-std::array<float,2>{0.0360212997f, 0.697151482f},
-std::array<float,2>{0.291173548f, 0.365729928f},
-std::array<float,2>{0.767335236f, 0.97294265f},
-std::array<float,2>{0.996469438f, 0.246197999f},
-std::array<float,2>{0.437803298f, 0.557897389f},
-std::array<float,2>{0.180341378f, 0.455894768f},
-std::array<float,2>{0.543289483f, 0.849666059f},
-std::array<float,2>{0.684281766f, 0.347386807f},
-std::array<float,2>{0.0193463638f, 0.997899652f},
-std::array<float,2>{0.264258355f, 0.0838107914f},
-std::array<float,2>{0.803232431f, 0.713886917f},
-std::array<float,2>{0.857534826f, 0.398330212f},
-std::array<float,2>{0.322139531f, 0.793234825f},
-std::array<float,2>{0.0634371564f, 0.175551236f},
-std::array<float,2>{0.713799298f, 0.576130629f},
-std::array<float,2>{0.587354124f, 0.0585507527f},
-std::array<float,2>{0.244809315f, 0.641676247f},
-std::array<float,2>{0.39163357f, 0.274753124f},
-std::array<float,2>{0.893228054f, 0.930454791f},
-std::array<float,2>{0.764054894f, 0.0979250968f},
-std::array<float,2>{0.299014807f, 0.74941349f},
-std::array<float,2>{0.0578482337f, 0.326383621f},
-std::array<float,2>{0.634542942f, 0.938195825f},
-std::array<float,2>{0.516019762f, 0.494787008f},
-std::array<float,2>{0.15173167f, 0.829630792f},
-std::array<float,2>{0.49736321f, 0.215396687f},
-std::array<float,2>{0.947623968f, 0.521763802f},
-std::array<float,2>{0.930618703f, 0.290586799f},
-std::array<float,2>{0.428966165f, 0.884273291f},
-std::array<float,2>{0.198051721f, 0.0221881606f},
-std::array<float,2>{0.613836229f, 0.684989452f},
-std::array<float,2>{0.738536775f, 0.143497169f},
-std::array<float,2>{0.107900999f, 0.624473929f},
-std::array<float,2>{0.374731243f, 0.408921152f},
-std::array<float,2>{0.819223523f, 0.761637866f},
-std::array<float,2>{0.981681228f, 0.0504788458f},
-std::array<float,2>{0.457199395f, 0.650359869f},
-std::array<float,2>{0.171553597f, 0.266753346f},
-std::array<float,2>{0.560628295f, 0.922248602f},
-std::array<float,2>{0.664313793f, 0.403684586f},
-std::array<float,2>{0.00640259497f, 0.786226809f},
-std::array<float,2>{0.278793246f, 0.181332052f},
-std::array<float,2>{0.782802284f, 0.565086424f},
-std::array<float,2>{0.872677386f, 0.356841981f},
-std::array<float,2>{0.341992974f, 0.984572172f},
-std::array<float,2>{0.0866875499f, 0.0894744843f},
-std::array<float,2>{0.702886939f, 0.707075596f},
-std::array<float,2>{0.575475395f, 0.239755258f},
-std::array<float,2>{0.229349345f, 0.551753938f},
-std::array<float,2>{0.376066566f, 0.465823978f},
-std::array<float,2>{0.878891885f, 0.856966436f},
-std::array<float,2>{0.772379518f, 0.154230163f},
-std::array<float,2>{0.296149939f, 0.613950253f},
-std::array<float,2>{0.0329616815f, 0.419977456f},
-std::array<float,2>{0.649827659f, 0.754673481f},
-std::array<float,2>{0.506283581f, 0.281995505f},
-std::array<float,2>{0.136490017f, 0.879948854f},
-std::array<float,2>{0.483075708f, 0.0262767412f},
-std::array<float,2>{0.968488693f, 0.675409257f},
-std::array<float,2>{0.910091162f, 0.485138774f},
-std::array<float,2>{0.415881634f, 0.83960712f},
-std::array<float,2>{0.211460263f, 0.207304895f},
-std::array<float,2>{0.606432021f, 0.526284933f},
-std::array<float,2>{0.726698875f, 0.104157805f},
-std::array<float,2>{0.114138782f, 0.735038817f},
-std::array<float,2>{0.348340124f, 0.314904451f},
-std::array<float,2>{0.836671054f, 0.949863493f},
-std::array<float,2>{0.896255612f, 0.200243145f},
-std::array<float,2>{0.398144424f, 0.500106812f},
-std::array<float,2>{0.249234632f, 0.472784668f},
-std::array<float,2>{0.591836154f, 0.821219325f},
-std::array<float,2>{0.716900408f, 0.34025237f},
-std::array<float,2>{0.0679188296f, 0.955224395f},
-std::array<float,2>{0.327857226f, 0.114656992f},
-std::array<float,2>{0.85501945f, 0.7220487f},
-std::array<float,2>{0.797569811f, 0.428801894f},
-std::array<float,2>{0.258065045f, 0.76913017f},
-std::array<float,2>{0.0223992541f, 0.129326016f},
-std::array<float,2>{0.680451632f, 0.601224184f},
-std::array<float,2>{0.540433705f, 0.00478578405f},
-std::array<float,2>{0.184523121f, 0.671326399f},
-std::array<float,2>{0.442047536f, 0.309983313f},
-std::array<float,2>{0.994735837f, 0.89802736f},
-std::array<float,2>{0.815570235f, 0.0629682243f},
-std::array<float,2>{0.369017005f, 0.691467166f},
-std::array<float,2>{0.103896618f, 0.368991762f},
-std::array<float,2>{0.735272825f, 0.978190064f},
-std::array<float,2>{0.611621559f, 0.449916542f},
-std::array<float,2>{0.200724661f, 0.870258987f},
-std::array<float,2>{0.422564596f, 0.233599693f},
-std::array<float,2>{0.93730402f, 0.542584062f},
-std::array<float,2>{0.952970266f, 0.261835188f},
-std::array<float,2>{0.495261878f, 0.913762927f},
-std::array<float,2>{0.154128402f, 0.0391908064f},
-std::array<float,2>{0.522258759f, 0.626294434f},
-std::array<float,2>{0.637748182f, 0.162094533f},
-std::array<float,2>{0.0617337748f, 0.586935163f},
-std::array<float,2>{0.303553969f, 0.39033398f},
-std::array<float,2>{0.761050045f, 0.800753355f},
-std::array<float,2>{0.923201978f, 0.124098584f},
-std::array<float,2>{0.431453705f, 0.727423966f},
-std::array<float,2>{0.194248274f, 0.334721208f},
-std::array<float,2>{0.621462643f, 0.967953622f},
-std::array<float,2>{0.749107599f, 0.480834693f},
-std::array<float,2>{0.100016519f, 0.81724745f},
-std::array<float,2>{0.362836063f, 0.188958541f},
-std::array<float,2>{0.820983112f, 0.508914649f},
-std::array<float,2>{0.757004201f, 0.304453522f},
-std::array<float,2>{0.305126429f, 0.906166553f},
-std::array<float,2>{0.0500798188f, 0.0141550982f},
-std::array<float,2>{0.626706302f, 0.659919262f},
-std::array<float,2>{0.524907589f, 0.139568627f},
-std::array<float,2>{0.14521499f, 0.606549501f},
-std::array<float,2>{0.485690475f, 0.433441907f},
-std::array<float,2>{0.944563091f, 0.779763877f},
-std::array<float,2>{0.85155046f, 0.226278812f},
-std::array<float,2>{0.314897835f, 0.535019875f},
-std::array<float,2>{0.0752909482f, 0.443147331f},
-std::array<float,2>{0.708430886f, 0.861790776f},
-std::array<float,2>{0.585728526f, 0.360228062f},
-std::array<float,2>{0.238569245f, 0.969699383f},
-std::array<float,2>{0.405383289f, 0.0745431334f},
-std::array<float,2>{0.90251106f, 0.701509178f},
-std::array<float,2>{0.990527093f, 0.375331223f},
-std::array<float,2>{0.44907555f, 0.808809638f},
-std::array<float,2>{0.172971383f, 0.164963141f},
-std::array<float,2>{0.537259042f, 0.582654357f},
-std::array<float,2>{0.675379097f, 0.0328478105f},
-std::array<float,2>{0.0237014052f, 0.636997581f},
-std::array<float,2>{0.251875073f, 0.252181351f},
-std::array<float,2>{0.807187617f, 0.917920411f},
-std::array<float,2>{0.958171248f, 0.178718537f},
-std::array<float,2>{0.472226679f, 0.57283783f},
-std::array<float,2>{0.13260527f, 0.393926531f},
-std::array<float,2>{0.515421093f, 0.790207446f},
-std::array<float,2>{0.641274869f, 0.278913945f},
-std::array<float,2>{0.0405022092f, 0.933893442f},
-std::array<float,2>{0.284903109f, 0.0601216927f},
-std::array<float,2>{0.779922366f, 0.645636261f},
-std::array<float,2>{0.832652926f, 0.458893567f},
-std::array<float,2>{0.355147511f, 0.845079482f},
-std::array<float,2>{0.117660761f, 0.245218948f},
-std::array<float,2>{0.720029175f, 0.559393644f},
-std::array<float,2>{0.596453428f, 0.0818928927f},
-std::array<float,2>{0.208209246f, 0.718735218f},
-std::array<float,2>{0.412834287f, 0.347688466f},
-std::array<float,2>{0.917863429f, 0.994669378f},
-std::array<float,2>{0.792584896f, 0.0193948131f},
-std::array<float,2>{0.266022921f, 0.679817975f},
-std::array<float,2>{0.0111091621f, 0.293009281f},
-std::array<float,2>{0.659583628f, 0.887803614f},
-std::array<float,2>{0.554059029f, 0.41370067f},
-std::array<float,2>{0.162154183f, 0.761729419f},
-std::array<float,2>{0.466903239f, 0.147385329f},
-std::array<float,2>{0.970842361f, 0.618692577f},
-std::array<float,2>{0.888528645f, 0.324011594f},
-std::array<float,2>{0.385248959f, 0.941612422f},
-std::array<float,2>{0.219432235f, 0.0938016847f},
-std::array<float,2>{0.565842986f, 0.745848f},
-std::array<float,2>{0.692848742f, 0.214584976f},
-std::array<float,2>{0.0806776136f, 0.516543269f},
-std::array<float,2>{0.331654757f, 0.49776265f},
-std::array<float,2>{0.860603809f, 0.834282041f},
-std::array<float,2>{0.948030412f, 0.100102551f},
-std::array<float,2>{0.497814924f, 0.746378005f},
-std::array<float,2>{0.151995555f, 0.325893044f},
-std::array<float,2>{0.516316712f, 0.941167653f},
-std::array<float,2>{0.634263575f, 0.493819892f},
-std::array<float,2>{0.0585793108f, 0.83127898f},
-std::array<float,2>{0.299571812f, 0.218704328f},
-std::array<float,2>{0.7646088f, 0.521052361f},
-std::array<float,2>{0.818645418f, 0.29257071f},
-std::array<float,2>{0.374044031f, 0.884772301f},
-std::array<float,2>{0.108190119f, 0.0196895562f},
-std::array<float,2>{0.739160657f, 0.687200367f},
-std::array<float,2>{0.613652766f, 0.142301574f},
-std::array<float,2>{0.197621986f, 0.621517718f},
-std::array<float,2>{0.42950803f, 0.406309575f},
-std::array<float,2>{0.9298715f, 0.759002864f},
-std::array<float,2>{0.803069651f, 0.248580977f},
-std::array<float,2>{0.264051229f, 0.55632472f},
-std::array<float,2>{0.0187205207f, 0.45433259f},
-std::array<float,2>{0.684065878f, 0.847854197f},
-std::array<float,2>{0.543740749f, 0.344360352f},
-std::array<float,2>{0.179962367f, 0.999232709f},
-std::array<float,2>{0.438006341f, 0.0850072727f},
-std::array<float,2>{0.996637404f, 0.712558031f},
-std::array<float,2>{0.892903328f, 0.39562881f},
-std::array<float,2>{0.392334104f, 0.795722187f},
-std::array<float,2>{0.244342968f, 0.173078775f},
-std::array<float,2>{0.587574005f, 0.577343702f},
-std::array<float,2>{0.713348508f, 0.0551853627f},
-std::array<float,2>{0.062662214f, 0.642585099f},
-std::array<float,2>{0.321626216f, 0.276490182f},
-std::array<float,2>{0.857995152f, 0.932067871f},
-std::array<float,2>{0.910807729f, 0.170816049f},
-std::array<float,2>{0.420579374f, 0.581056833f},
-std::array<float,2>{0.217867881f, 0.379719704f},
-std::array<float,2>{0.602074265f, 0.805516303f},
-std::array<float,2>{0.733973145f, 0.257479161f},
-std::array<float,2>{0.110614963f, 0.91994077f},
-std::array<float,2>{0.346050084f, 0.0355660655f},
-std::array<float,2>{0.843288243f, 0.636187911f},
-std::array<float,2>{0.766786754f, 0.43822363f},
-std::array<float,2>{0.2915093f, 0.866679132f},
-std::array<float,2>{0.0352749676f, 0.222325966f},
-std::array<float,2>{0.653813779f, 0.538630664f},
-std::array<float,2>{0.502372265f, 0.0707627982f},
-std::array<float,2>{0.136973113f, 0.699207008f},
-std::array<float,2>{0.476775229f, 0.36409083f},
-std::array<float,2>{0.963465214f, 0.975077271f},
-std::array<float,2>{0.87090677f, 0.011319573f},
-std::array<float,2>{0.337086588f, 0.663049221f},
-std::array<float,2>{0.0917010456f, 0.296904564f},
-std::array<float,2>{0.695754349f, 0.901059568f},
-std::array<float,2>{0.57227093f, 0.435477257f},
-std::array<float,2>{0.233590618f, 0.774164259f},
-std::array<float,2>{0.379590899f, 0.135049582f},
-std::array<float,2>{0.882707834f, 0.602767944f},
-std::array<float,2>{0.97791326f, 0.331056446f},
-std::array<float,2>{0.456479996f, 0.962440252f},
-std::array<float,2>{0.167075574f, 0.118299134f},
-std::array<float,2>{0.557620168f, 0.732569635f},
-std::array<float,2>{0.670120239f, 0.192062467f},
-std::array<float,2>{0.00293258578f, 0.512827635f},
-std::array<float,2>{0.274381638f, 0.478811741f},
-std::array<float,2>{0.787064254f, 0.813083947f},
-std::array<float,2>{0.884548664f, 0.0431512371f},
-std::array<float,2>{0.38723579f, 0.632493258f},
-std::array<float,2>{0.224618196f, 0.261339068f},
-std::array<float,2>{0.568599224f, 0.906833589f},
-std::array<float,2>{0.68909806f, 0.384787589f},
-std::array<float,2>{0.0845212489f, 0.804589093f},
-std::array<float,2>{0.332413644f, 0.158109888f},
-std::array<float,2>{0.866627693f, 0.592832088f},
-std::array<float,2>{0.795049429f, 0.37196508f},
-std::array<float,2>{0.271915138f, 0.98077929f},
-std::array<float,2>{0.0139536299f, 0.0692846477f},
-std::array<float,2>{0.662724555f, 0.688403547f},
-std::array<float,2>{0.547228754f, 0.226892486f},
-std::array<float,2>{0.156462729f, 0.543613732f},
-std::array<float,2>{0.461571008f, 0.449164033f},
-std::array<float,2>{0.973609149f, 0.874423385f},
-std::array<float,2>{0.829613149f, 0.125515833f},
-std::array<float,2>{0.35721153f, 0.595439494f},
-std::array<float,2>{0.124750465f, 0.422794282f},
-std::array<float,2>{0.723336279f, 0.770924211f},
-std::array<float,2>{0.601433337f, 0.307853848f},
-std::array<float,2>{0.205764964f, 0.894067287f},
-std::array<float,2>{0.406389862f, 0.00192635763f},
-std::array<float,2>{0.920841455f, 0.666452169f},
-std::array<float,2>{0.955781758f, 0.470556408f},
-std::array<float,2>{0.474372566f, 0.825695515f},
-std::array<float,2>{0.126539484f, 0.198003635f},
-std::array<float,2>{0.511014044f, 0.504561365f},
-std::array<float,2>{0.645961046f, 0.111695729f},
-std::array<float,2>{0.0439910255f, 0.723745406f},
-std::array<float,2>{0.285938978f, 0.33665204f},
-std::array<float,2>{0.773443699f, 0.959785044f},
-std::array<float,2>{0.984494328f, 0.204514503f},
-std::array<float,2>{0.452663124f, 0.528491855f},
-std::array<float,2>{0.176261604f, 0.490201354f},
-std::array<float,2>{0.532071769f, 0.841075122f},
-std::array<float,2>{0.677499831f, 0.318591148f},
-std::array<float,2>{0.0299196057f, 0.948159635f},
-std::array<float,2>{0.255135834f, 0.108827181f},
-std::array<float,2>{0.809801042f, 0.741929591f},
-std::array<float,2>{0.845409334f, 0.415145338f},
-std::array<float,2>{0.316559345f, 0.750534654f},
-std::array<float,2>{0.0722611472f, 0.149044454f},
-std::array<float,2>{0.704323351f, 0.611378312f},
-std::array<float,2>{0.581613183f, 0.0309475269f},
-std::array<float,2>{0.236973092f, 0.67867887f},
-std::array<float,2>{0.400862575f, 0.28783983f},
-std::array<float,2>{0.902067721f, 0.876819551f},
-std::array<float,2>{0.752122819f, 0.0937278718f},
-std::array<float,2>{0.312380075f, 0.70663476f},
-std::array<float,2>{0.0524991639f, 0.354084849f},
-std::array<float,2>{0.631003022f, 0.990591764f},
-std::array<float,2>{0.529932499f, 0.464585841f},
-std::array<float,2>{0.142031193f, 0.852379143f},
-std::array<float,2>{0.491950303f, 0.235333338f},
-std::array<float,2>{0.939846873f, 0.547946274f},
-std::array<float,2>{0.927250147f, 0.272458494f},
-std::array<float,2>{0.434958965f, 0.928478181f},
-std::array<float,2>{0.188933775f, 0.0530235097f},
-std::array<float,2>{0.618725836f, 0.654499471f},
-std::array<float,2>{0.745552003f, 0.183610126f},
-std::array<float,2>{0.0945138335f, 0.567424595f},
-std::array<float,2>{0.36355561f, 0.402034372f},
-std::array<float,2>{0.824226379f, 0.783212125f},
-std::array<float,2>{0.971297979f, 0.0172374826f},
-std::array<float,2>{0.467597961f, 0.68219763f},
-std::array<float,2>{0.162688226f, 0.295388371f},
-std::array<float,2>{0.554496825f, 0.888995349f},
-std::array<float,2>{0.659774005f, 0.411921471f},
-std::array<float,2>{0.0114743961f, 0.763937593f},
-std::array<float,2>{0.266423136f, 0.144728512f},
-std::array<float,2>{0.792108834f, 0.619575322f},
-std::array<float,2>{0.861013234f, 0.320605546f},
-std::array<float,2>{0.331219941f, 0.945177794f},
-std::array<float,2>{0.0800851732f, 0.0970241949f},
-std::array<float,2>{0.693226576f, 0.742379487f},
-std::array<float,2>{0.566352904f, 0.212502718f},
-std::array<float,2>{0.21877487f, 0.519183934f},
-std::array<float,2>{0.385708392f, 0.498280525f},
-std::array<float,2>{0.887799382f, 0.832674384f},
-std::array<float,2>{0.779320657f, 0.176683649f},
-std::array<float,2>{0.284361154f, 0.572228491f},
-std::array<float,2>{0.0405429415f, 0.390744656f},
-std::array<float,2>{0.64108485f, 0.792950809f},
-std::array<float,2>{0.514866352f, 0.279761732f},
-std::array<float,2>{0.132241279f, 0.935990393f},
-std::array<float,2>{0.471825182f, 0.0612478964f},
-std::array<float,2>{0.95879662f, 0.648148656f},
-std::array<float,2>{0.917303145f, 0.459074229f},
-std::array<float,2>{0.412557214f, 0.84618926f},
-std::array<float,2>{0.20870322f, 0.242442265f},
-std::array<float,2>{0.595727682f, 0.561447918f},
-std::array<float,2>{0.720631719f, 0.0800140798f},
-std::array<float,2>{0.11812526f, 0.715468228f},
-std::array<float,2>{0.354907066f, 0.350736827f},
-std::array<float,2>{0.832404137f, 0.992764831f},
-std::array<float,2>{0.90302515f, 0.223461315f},
-std::array<float,2>{0.406249613f, 0.531615078f},
-std::array<float,2>{0.239025384f, 0.444061041f},
-std::array<float,2>{0.585220397f, 0.859453499f},
-std::array<float,2>{0.708601654f, 0.361646414f},
-std::array<float,2>{0.0758513138f, 0.971019804f},
-std::array<float,2>{0.315166235f, 0.0764345452f},
-std::array<float,2>{0.850880146f, 0.700151742f},
-std::array<float,2>{0.807030916f, 0.37784043f},
-std::array<float,2>{0.251298994f, 0.811490059f},
-std::array<float,2>{0.0239629727f, 0.16603063f},
-std::array<float,2>{0.675111055f, 0.584234655f},
-std::array<float,2>{0.537800431f, 0.0342006236f},
-std::array<float,2>{0.173655123f, 0.64015907f},
-std::array<float,2>{0.448390961f, 0.250383049f},
-std::array<float,2>{0.991092384f, 0.914449394f},
-std::array<float,2>{0.82055968f, 0.122374572f},
-std::array<float,2>{0.362422287f, 0.729126275f},
-std::array<float,2>{0.100214072f, 0.333798349f},
-std::array<float,2>{0.749562502f, 0.965817869f},
-std::array<float,2>{0.622054458f, 0.482921451f},
-std::array<float,2>{0.193454355f, 0.819532573f},
-std::array<float,2>{0.431141734f, 0.190110683f},
-std::array<float,2>{0.923766613f, 0.511081159f},
-std::array<float,2>{0.944837391f, 0.301517904f},
-std::array<float,2>{0.486269206f, 0.9042418f},
-std::array<float,2>{0.144632056f, 0.0134865968f},
-std::array<float,2>{0.524787247f, 0.657194734f},
-std::array<float,2>{0.626209438f, 0.137705147f},
-std::array<float,2>{0.0503989793f, 0.608940601f},
-std::array<float,2>{0.305410445f, 0.431321293f},
-std::array<float,2>{0.757324338f, 0.777517498f},
-std::array<float,2>{0.936761916f, 0.0657600984f},
-std::array<float,2>{0.422091872f, 0.694705486f},
-std::array<float,2>{0.200460047f, 0.370577604f},
-std::array<float,2>{0.612248719f, 0.978638887f},
-std::array<float,2>{0.734556615f, 0.451743603f},
-std::array<float,2>{0.104354836f, 0.868112743f},
-std::array<float,2>{0.368409097f, 0.231036112f},
-std::array<float,2>{0.816109896f, 0.539432883f},
-std::array<float,2>{0.761491954f, 0.264978498f},
-std::array<float,2>{0.302806109f, 0.911497176f},
-std::array<float,2>{0.0623147711f, 0.0422435068f},
-std::array<float,2>{0.638187766f, 0.627567828f},
-std::array<float,2>{0.521528125f, 0.163354591f},
-std::array<float,2>{0.153564379f, 0.588981807f},
-std::array<float,2>{0.496055335f, 0.388402015f},
-std::array<float,2>{0.952243328f, 0.798783779f},
-std::array<float,2>{0.854729891f, 0.202933267f},
-std::array<float,2>{0.327295899f, 0.503764749f},
-std::array<float,2>{0.0676886067f, 0.475378841f},
-std::array<float,2>{0.717397213f, 0.822274864f},
-std::array<float,2>{0.59259212f, 0.343084246f},
-std::array<float,2>{0.249824494f, 0.954858065f},
-std::array<float,2>{0.397640467f, 0.116661265f},
-std::array<float,2>{0.895552635f, 0.719950676f},
-std::array<float,2>{0.994406343f, 0.426572889f},
-std::array<float,2>{0.441429973f, 0.767017245f},
-std::array<float,2>{0.183597758f, 0.132465705f},
-std::array<float,2>{0.54052794f, 0.598749459f},
-std::array<float,2>{0.679810286f, 0.00751116173f},
-std::array<float,2>{0.0215719715f, 0.669178367f},
-std::array<float,2>{0.258518398f, 0.310762793f},
-std::array<float,2>{0.797094285f, 0.89565587f},
-std::array<float,2>{0.968250751f, 0.155731663f},
-std::array<float,2>{0.482670665f, 0.61578685f},
-std::array<float,2>{0.136145234f, 0.419502348f},
-std::array<float,2>{0.506432533f, 0.756464243f},
-std::array<float,2>{0.649977148f, 0.284812123f},
-std::array<float,2>{0.0324521698f, 0.882106662f},
-std::array<float,2>{0.296611249f, 0.0238689184f},
-std::array<float,2>{0.771752119f, 0.673631608f},
-std::array<float,2>{0.836037159f, 0.487363398f},
-std::array<float,2>{0.347823292f, 0.836472273f},
-std::array<float,2>{0.113331765f, 0.209569842f},
-std::array<float,2>{0.727382064f, 0.52382648f},
-std::array<float,2>{0.605655611f, 0.102817833f},
-std::array<float,2>{0.21101284f, 0.73640269f},
-std::array<float,2>{0.415424049f, 0.31293425f},
-std::array<float,2>{0.909317076f, 0.951193154f},
-std::array<float,2>{0.782260895f, 0.0472809672f},
-std::array<float,2>{0.279071778f, 0.652185559f},
-std::array<float,2>{0.00616529165f, 0.267775804f},
-std::array<float,2>{0.664628208f, 0.925734818f},
-std::array<float,2>{0.561285555f, 0.405425459f},
-std::array<float,2>{0.171020702f, 0.787640929f},
-std::array<float,2>{0.457574546f, 0.183422402f},
-std::array<float,2>{0.982007325f, 0.563031912f},
-std::array<float,2>{0.878266871f, 0.358592361f},
-std::array<float,2>{0.37656489f, 0.986657202f},
-std::array<float,2>{0.228766173f, 0.0864231437f},
-std::array<float,2>{0.575951874f, 0.710918665f},
-std::array<float,2>{0.702268839f, 0.241895974f},
-std::array<float,2>{0.0861749798f, 0.553260922f},
-std::array<float,2>{0.34232825f, 0.468725741f},
-std::array<float,2>{0.872435391f, 0.858133316f},
-std::array<float,2>{0.999284506f, 0.0834933221f},
-std::array<float,2>{0.440342396f, 0.714807391f},
-std::array<float,2>{0.182392672f, 0.347151667f},
-std::array<float,2>{0.546625078f, 0.997134268f},
-std::array<float,2>{0.687314332f, 0.455457181f},
-std::array<float,2>{0.0175300166f, 0.850390553f},
-std::array<float,2>{0.26313296f, 0.246584132f},
-std::array<float,2>{0.801302671f, 0.55815351f},
-std::array<float,2>{0.856991947f, 0.275025338f},
-std::array<float,2>{0.32312268f, 0.929697156f},
-std::array<float,2>{0.0660951659f, 0.0576477908f},
-std::array<float,2>{0.711002886f, 0.64242661f},
-std::array<float,2>{0.589664161f, 0.175073877f},
-std::array<float,2>{0.242198765f, 0.575555563f},
-std::array<float,2>{0.392995983f, 0.397870809f},
-std::array<float,2>{0.891300857f, 0.793616951f},
-std::array<float,2>{0.762425601f, 0.215101227f},
-std::array<float,2>{0.29818517f, 0.522238612f},
-std::array<float,2>{0.0549151823f, 0.494174153f},
-std::array<float,2>{0.635220647f, 0.82922399f},
-std::array<float,2>{0.518052161f, 0.326832205f},
-std::array<float,2>{0.149147943f, 0.937671602f},
-std::array<float,2>{0.498629898f, 0.0982533544f},
-std::array<float,2>{0.946670115f, 0.749659956f},
-std::array<float,2>{0.931889772f, 0.408312976f},
-std::array<float,2>{0.426689357f, 0.760951042f},
-std::array<float,2>{0.197004169f, 0.142878249f},
-std::array<float,2>{0.616702795f, 0.624595523f},
-std::array<float,2>{0.740992188f, 0.0218191985f},
-std::array<float,2>{0.105808347f, 0.685297072f},
-std::array<float,2>{0.371337324f, 0.290094912f},
-std::array<float,2>{0.817388713f, 0.884609759f},
-std::array<float,2>{0.879362047f, 0.133107215f},
-std::array<float,2>{0.381299227f, 0.605235577f},
-std::array<float,2>{0.230891079f, 0.436722457f},
-std::array<float,2>{0.571695387f, 0.775837481f},
-std::array<float,2>{0.698964655f, 0.30065766f},
-std::array<float,2>{0.0920930281f, 0.900117517f},
-std::array<float,2>{0.338082165f, 0.00845423434f},
-std::array<float,2>{0.868452013f, 0.661360204f},
-std::array<float,2>{0.788598001f, 0.478004485f},
-std::array<float,2>{0.276689231f, 0.815686285f},
-std::array<float,2>{0.000604102621f, 0.194515094f},
-std::array<float,2>{0.669920444f, 0.514130771f},
-std::array<float,2>{0.555357516f, 0.120874994f},
-std::array<float,2>{0.164099485f, 0.730513871f},
-std::array<float,2>{0.45394966f, 0.329128474f},
-std::array<float,2>{0.979746342f, 0.96455878f},
-std::array<float,2>{0.839861691f, 0.0375737697f},
-std::array<float,2>{0.344283223f, 0.633513927f},
-std::array<float,2>{0.111708865f, 0.255173206f},
-std::array<float,2>{0.731762648f, 0.918225467f},
-std::array<float,2>{0.604106486f, 0.382704675f},
-std::array<float,2>{0.215647429f, 0.807709694f},
-std::array<float,2>{0.419265836f, 0.169075251f},
-std::array<float,2>{0.912776947f, 0.579752445f},
-std::array<float,2>{0.962532043f, 0.365609169f},
-std::array<float,2>{0.478726178f, 0.973321319f},
-std::array<float,2>{0.139648244f, 0.0733294189f},
-std::array<float,2>{0.500658751f, 0.696374774f},
-std::array<float,2>{0.656085551f, 0.220406696f},
-std::array<float,2>{0.0386171751f, 0.535903275f},
-std::array<float,2>{0.290033042f, 0.439749211f},
-std::array<float,2>{0.768970609f, 0.865202427f},
-std::array<float,2>{0.918716729f, 0.00236374629f},
-std::array<float,2>{0.409484208f, 0.665633976f},
-std::array<float,2>{0.203548104f, 0.304867953f},
-std::array<float,2>{0.598698437f, 0.891949654f},
-std::array<float,2>{0.725763559f, 0.424204439f},
-std::array<float,2>{0.122689173f, 0.772358358f},
-std::array<float,2>{0.358644813f, 0.128353626f},
-std::array<float,2>{0.830169022f, 0.59654665f},
-std::array<float,2>{0.775853336f, 0.338738531f},
-std::array<float,2>{0.288647562f, 0.958532274f},
-std::array<float,2>{0.0465432741f, 0.111000374f},
-std::array<float,2>{0.646988451f, 0.725463271f},
-std::array<float,2>{0.509699225f, 0.196427286f},
-std::array<float,2>{0.127462611f, 0.507408857f},
-std::array<float,2>{0.476431698f, 0.471852362f},
-std::array<float,2>{0.95313549f, 0.82690829f},
-std::array<float,2>{0.86447835f, 0.159164563f},
-std::array<float,2>{0.334511608f, 0.590614378f},
-std::array<float,2>{0.0839063451f, 0.384418786f},
-std::array<float,2>{0.690023184f, 0.802111804f},
-std::array<float,2>{0.567248583f, 0.258821696f},
-std::array<float,2>{0.223036438f, 0.909202278f},
-std::array<float,2>{0.390068799f, 0.0462589078f},
-std::array<float,2>{0.885299683f, 0.630696952f},
-std::array<float,2>{0.975289106f, 0.446224153f},
-std::array<float,2>{0.464019835f, 0.871218204f},
-std::array<float,2>{0.160039678f, 0.229201391f},
-std::array<float,2>{0.550465286f, 0.546049237f},
-std::array<float,2>{0.661007106f, 0.0666912645f},
-std::array<float,2>{0.0135632949f, 0.690991461f},
-std::array<float,2>{0.271404982f, 0.373459309f},
-std::array<float,2>{0.79348731f, 0.983333409f},
-std::array<float,2>{0.937574685f, 0.237035125f},
-std::array<float,2>{0.488537073f, 0.549828053f},
-std::array<float,2>{0.143435076f, 0.462744087f},
-std::array<float,2>{0.527979314f, 0.853941381f},
-std::array<float,2>{0.629718542f, 0.35248071f},
-std::array<float,2>{0.053105697f, 0.990077138f},
-std::array<float,2>{0.310445338f, 0.0914472193f},
-std::array<float,2>{0.751296937f, 0.705031276f},
-std::array<float,2>{0.82801193f, 0.398634076f},
-std::array<float,2>{0.366670579f, 0.783093035f},
-std::array<float,2>{0.0961245969f, 0.187065423f},
-std::array<float,2>{0.744127393f, 0.569832265f},
-std::array<float,2>{0.619394481f, 0.0525726192f},
-std::array<float,2>{0.191355959f, 0.652467847f},
-std::array<float,2>{0.436377168f, 0.270191193f},
-std::array<float,2>{0.928539574f, 0.926728547f},
-std::array<float,2>{0.810629845f, 0.106012851f},
-std::array<float,2>{0.257122248f, 0.738491595f},
-std::array<float,2>{0.0289257914f, 0.317550868f},
-std::array<float,2>{0.67884022f, 0.94687736f},
-std::array<float,2>{0.535011292f, 0.490700901f},
-std::array<float,2>{0.179058194f, 0.842493892f},
-std::array<float,2>{0.450478613f, 0.20642975f},
-std::array<float,2>{0.986334145f, 0.530249536f},
-std::array<float,2>{0.898477554f, 0.285672903f},
-std::array<float,2>{0.398930401f, 0.877099037f},
-std::array<float,2>{0.2358623f, 0.0276891273f},
-std::array<float,2>{0.579391241f, 0.677334547f},
-std::array<float,2>{0.705431044f, 0.151910588f},
-std::array<float,2>{0.0725131482f, 0.609877288f},
-std::array<float,2>{0.319305807f, 0.416419327f},
-std::array<float,2>{0.846677363f, 0.752592444f},
-std::array<float,2>{0.959486544f, 0.0599596314f},
-std::array<float,2>{0.468891978f, 0.646178484f},
-std::array<float,2>{0.129969954f, 0.278586626f},
-std::array<float,2>{0.513207018f, 0.934425056f},
-std::array<float,2>{0.643419087f, 0.394443929f},
-std::array<float,2>{0.0410558358f, 0.791006505f},
-std::array<float,2>{0.2830109f, 0.179677412f},
-std::array<float,2>{0.77773273f, 0.572309077f},
-std::array<float,2>{0.834905505f, 0.348586082f},
-std::array<float,2>{0.353405029f, 0.994182765f},
-std::array<float,2>{0.119741254f, 0.081194438f},
-std::array<float,2>{0.722577035f, 0.718088865f},
-std::array<float,2>{0.595067441f, 0.246092603f},
-std::array<float,2>{0.209538653f, 0.558992326f},
-std::array<float,2>{0.411092103f, 0.458244801f},
-std::array<float,2>{0.914072871f, 0.845597267f},
-std::array<float,2>{0.789365172f, 0.14688924f},
-std::array<float,2>{0.268783629f, 0.618229568f},
-std::array<float,2>{0.00895838439f, 0.413175374f},
-std::array<float,2>{0.657391191f, 0.762491703f},
-std::array<float,2>{0.551895976f, 0.293750376f},
-std::array<float,2>{0.161485136f, 0.888493299f},
-std::array<float,2>{0.466331065f, 0.018763883f},
-std::array<float,2>{0.968996704f, 0.680542827f},
-std::array<float,2>{0.889236271f, 0.497227073f},
-std::array<float,2>{0.38414526f, 0.834794879f},
-std::array<float,2>{0.221516222f, 0.213891596f},
-std::array<float,2>{0.563881934f, 0.515850604f},
-std::array<float,2>{0.693359494f, 0.0945203826f},
-std::array<float,2>{0.0791348293f, 0.745429933f},
-std::array<float,2>{0.328446984f, 0.323604494f},
-std::array<float,2>{0.862806916f, 0.941986859f},
-std::array<float,2>{0.924165249f, 0.189165741f},
-std::array<float,2>{0.431908995f, 0.509546578f},
-std::array<float,2>{0.193110779f, 0.481137663f},
-std::array<float,2>{0.623794556f, 0.816755056f},
-std::array<float,2>{0.746397734f, 0.334236473f},
-std::array<float,2>{0.0979191586f, 0.968282938f},
-std::array<float,2>{0.360866845f, 0.124735147f},
-std::array<float,2>{0.8225227f, 0.726828873f},
-std::array<float,2>{0.755413949f, 0.432870895f},
-std::array<float,2>{0.308293432f, 0.779940307f},
-std::array<float,2>{0.0485731326f, 0.138735861f},
-std::array<float,2>{0.62814492f, 0.607037783f},
-std::array<float,2>{0.525540233f, 0.0146297673f},
-std::array<float,2>{0.146617904f, 0.65942508f},
-std::array<float,2>{0.487720728f, 0.304087192f},
-std::array<float,2>{0.942612529f, 0.905358195f},
-std::array<float,2>{0.847757578f, 0.0747514069f},
-std::array<float,2>{0.312505722f, 0.701863289f},
-std::array<float,2>{0.0777851418f, 0.359746903f},
-std::array<float,2>{0.710113049f, 0.969164431f},
-std::array<float,2>{0.582442582f, 0.442610592f},
-std::array<float,2>{0.241941035f, 0.862295032f},
-std::array<float,2>{0.403878808f, 0.225665793f},
-std::array<float,2>{0.906086683f, 0.534660161f},
-std::array<float,2>{0.989670217f, 0.252814084f},
-std::array<float,2>{0.446305394f, 0.917254984f},
-std::array<float,2>{0.174869135f, 0.0325420275f},
-std::array<float,2>{0.535247147f, 0.637403846f},
-std::array<float,2>{0.67253238f, 0.164257944f},
-std::array<float,2>{0.0269566998f, 0.582460701f},
-std::array<float,2>{0.252126694f, 0.375597686f},
-std::array<float,2>{0.804786444f, 0.809369802f},
-std::array<float,2>{0.897248566f, 0.114760205f},
-std::array<float,2>{0.394844443f, 0.722522736f},
-std::array<float,2>{0.246448979f, 0.340352595f},
-std::array<float,2>{0.591332257f, 0.955962598f},
-std::array<float,2>{0.715267837f, 0.473162085f},
-std::array<float,2>{0.0693608299f, 0.820702612f},
-std::array<float,2>{0.325639486f, 0.200996444f},
-std::array<float,2>{0.853039563f, 0.500674546f},
-std::array<float,2>{0.800504923f, 0.3104375f},
-std::array<float,2>{0.259831756f, 0.897631884f},
-std::array<float,2>{0.0204202347f, 0.00430806726f},
-std::array<float,2>{0.683517158f, 0.671836495f},
-std::array<float,2>{0.541142106f, 0.129741773f},
-std::array<float,2>{0.185673803f, 0.600934684f},
-std::array<float,2>{0.444854319f, 0.42920652f},
-std::array<float,2>{0.992684245f, 0.76882571f},
-std::array<float,2>{0.812970996f, 0.234092057f},
-std::array<float,2>{0.370997369f, 0.542007148f},
-std::array<float,2>{0.102689363f, 0.449696332f},
-std::array<float,2>{0.738095284f, 0.870644569f},
-std::array<float,2>{0.610354483f, 0.368504018f},
-std::array<float,2>{0.202626288f, 0.977862418f},
-std::array<float,2>{0.424522161f, 0.0632823333f},
-std::array<float,2>{0.935345054f, 0.692038655f},
-std::array<float,2>{0.950034559f, 0.389957011f},
-std::array<float,2>{0.493788958f, 0.799817443f},
-std::array<float,2>{0.156121477f, 0.161418393f},
-std::array<float,2>{0.520268142f, 0.587741971f},
-std::array<float,2>{0.64051795f, 0.0399817824f},
-std::array<float,2>{0.0586315803f, 0.626486361f},
-std::array<float,2>{0.3014144f, 0.26221475f},
-std::array<float,2>{0.759083152f, 0.913520455f},
-std::array<float,2>{0.983806789f, 0.180729717f},
-std::array<float,2>{0.459456176f, 0.564573109f},
-std::array<float,2>{0.169679224f, 0.403938591f},
-std::array<float,2>{0.560525537f, 0.786713779f},
-std::array<float,2>{0.666225553f, 0.267472476f},
-std::array<float,2>{0.00481779873f, 0.922619402f},
-std::array<float,2>{0.279389888f, 0.0502257906f},
-std::array<float,2>{0.783800542f, 0.649859607f},
-std::array<float,2>{0.873158574f, 0.466440469f},
-std::array<float,2>{0.34152326f, 0.856598854f},
-std::array<float,2>{0.0883587152f, 0.239682302f},
-std::array<float,2>{0.701111615f, 0.550997794f},
-std::array<float,2>{0.577120841f, 0.0890975371f},
-std::array<float,2>{0.228014767f, 0.707632244f},
-std::array<float,2>{0.377562106f, 0.357270688f},
-std::array<float,2>{0.876443624f, 0.985047519f},
-std::array<float,2>{0.770773768f, 0.0258423444f},
-std::array<float,2>{0.293776274f, 0.675215006f},
-std::array<float,2>{0.0336283781f, 0.28170827f},
-std::array<float,2>{0.650734305f, 0.880433857f},
-std::array<float,2>{0.504371703f, 0.420608819f},
-std::array<float,2>{0.134496152f, 0.754372895f},
-std::array<float,2>{0.482159525f, 0.153648779f},
-std::array<float,2>{0.96498841f, 0.613465309f},
-std::array<float,2>{0.906785727f, 0.314947456f},
-std::array<float,2>{0.417391837f, 0.94922477f},
-std::array<float,2>{0.21294108f, 0.103785306f},
-std::array<float,2>{0.608495772f, 0.734665096f},
-std::array<float,2>{0.728993714f, 0.207961813f},
-std::array<float,2>{0.116449997f, 0.525546193f},
-std::array<float,2>{0.350242674f, 0.484693438f},
-std::array<float,2>{0.838660479f, 0.839116335f},
-std::array<float,2>{0.978619516f, 0.117629021f},
-std::array<float,2>{0.454279453f, 0.734312892f},
-std::array<float,2>{0.165615186f, 0.330124855f},
-std::array<float,2>{0.556562066f, 0.96128875f},
-std::array<float,2>{0.668756723f, 0.479923129f},
-std::array<float,2>{0.00134207844f, 0.813550889f},
-std::array<float,2>{0.275391936f, 0.193132088f},
-std::array<float,2>{0.787248433f, 0.512446225f},
-std::array<float,2>{0.867268026f, 0.298347592f},
-std::array<float,2>{0.339388132f, 0.901630998f},
-std::array<float,2>{0.0927787498f, 0.00995076727f},
-std::array<float,2>{0.697496772f, 0.663255095f},
-std::array<float,2>{0.571278811f, 0.135824457f},
-std::array<float,2>{0.231857061f, 0.601960659f},
-std::array<float,2>{0.382043362f, 0.434343368f},
-std::array<float,2>{0.880254924f, 0.774463296f},
-std::array<float,2>{0.768529832f, 0.221668348f},
-std::array<float,2>{0.290691942f, 0.53729099f},
-std::array<float,2>{0.0374953225f, 0.438797981f},
-std::array<float,2>{0.654328704f, 0.865400553f},
-std::array<float,2>{0.50167048f, 0.364469469f},
-std::array<float,2>{0.140229598f, 0.976003408f},
-std::array<float,2>{0.480232924f, 0.0720434934f},
-std::array<float,2>{0.961724102f, 0.697464228f},
-std::array<float,2>{0.913089931f, 0.380758524f},
-std::array<float,2>{0.418328702f, 0.805791914f},
-std::array<float,2>{0.216376349f, 0.171711966f},
-std::array<float,2>{0.605318725f, 0.580231369f},
-std::array<float,2>{0.730890214f, 0.0366600081f},
-std::array<float,2>{0.113272324f, 0.635210514f},
-std::array<float,2>{0.345592141f, 0.256519049f},
-std::array<float,2>{0.841124713f, 0.921515465f},
-std::array<float,2>{0.892485619f, 0.172738627f},
-std::array<float,2>{0.394169748f, 0.576904833f},
-std::array<float,2>{0.243634403f, 0.394537926f},
-std::array<float,2>{0.588803291f, 0.796214163f},
-std::array<float,2>{0.712821066f, 0.276216418f},
-std::array<float,2>{0.0647859052f, 0.932713568f},
-std::array<float,2>{0.323695302f, 0.0561444946f},
-std::array<float,2>{0.855501533f, 0.643705904f},
-std::array<float,2>{0.802464545f, 0.4531959f},
-std::array<float,2>{0.262264878f, 0.849526823f},
-std::array<float,2>{0.0159249231f, 0.249638259f},
-std::array<float,2>{0.686096013f, 0.555592179f},
-std::array<float,2>{0.544950664f, 0.0840472579f},
-std::array<float,2>{0.183028579f, 0.711699486f},
-std::array<float,2>{0.440741569f, 0.344889522f},
-std::array<float,2>{0.998450994f, 0.998485208f},
-std::array<float,2>{0.816684902f, 0.0207831729f},
-std::array<float,2>{0.372635931f, 0.686269224f},
-std::array<float,2>{0.106707945f, 0.291287243f},
-std::array<float,2>{0.742064595f, 0.886217594f},
-std::array<float,2>{0.615642965f, 0.407449096f},
-std::array<float,2>{0.195546046f, 0.758100808f},
-std::array<float,2>{0.427059263f, 0.141387999f},
-std::array<float,2>{0.933066845f, 0.623003006f},
-std::array<float,2>{0.946151912f, 0.324653983f},
-std::array<float,2>{0.499786139f, 0.939872801f},
-std::array<float,2>{0.149467841f, 0.100998111f},
-std::array<float,2>{0.518838823f, 0.747217536f},
-std::array<float,2>{0.635892153f, 0.21745272f},
-std::array<float,2>{0.0561058149f, 0.519873857f},
-std::array<float,2>{0.297079384f, 0.492464989f},
-std::array<float,2>{0.762835264f, 0.83104533f},
-std::array<float,2>{0.929217458f, 0.0542166233f},
-std::array<float,2>{0.437068015f, 0.655729115f},
-std::array<float,2>{0.189594194f, 0.272894025f},
-std::array<float,2>{0.621006072f, 0.92904985f},
-std::array<float,2>{0.742970467f, 0.401072115f},
-std::array<float,2>{0.0970646963f, 0.784711659f},
-std::array<float,2>{0.366051584f, 0.184586599f},
-std::array<float,2>{0.826604843f, 0.566529572f},
-std::array<float,2>{0.750144482f, 0.354916215f},
-std::array<float,2>{0.308950692f, 0.991557896f},
-std::array<float,2>{0.0538683757f, 0.0923143029f},
-std::array<float,2>{0.630310714f, 0.705911398f},
-std::array<float,2>{0.52893424f, 0.23547858f},
-std::array<float,2>{0.144093901f, 0.546889186f},
-std::array<float,2>{0.489465266f, 0.463525742f},
-std::array<float,2>{0.938903153f, 0.852990687f},
-std::array<float,2>{0.847316384f, 0.150172263f},
-std::array<float,2>{0.320067793f, 0.613265038f},
-std::array<float,2>{0.0735742599f, 0.414279908f},
-std::array<float,2>{0.706112266f, 0.751666963f},
-std::array<float,2>{0.578796744f, 0.288284659f},
-std::array<float,2>{0.235025018f, 0.875905037f},
-std::array<float,2>{0.399665058f, 0.0297103506f},
-std::array<float,2>{0.899783731f, 0.67947036f},
-std::array<float,2>{0.988194585f, 0.488848627f},
-std::array<float,2>{0.449604571f, 0.84034878f},
-std::array<float,2>{0.177757412f, 0.203222349f},
-std::array<float,2>{0.53400439f, 0.528171957f},
-std::array<float,2>{0.678689361f, 0.108348653f},
-std::array<float,2>{0.0280259419f, 0.74037683f},
-std::array<float,2>{0.256187975f, 0.319387078f},
-std::array<float,2>{0.811974525f, 0.948468685f},
-std::array<float,2>{0.95501399f, 0.199058115f},
-std::array<float,2>{0.474644661f, 0.505350411f},
-std::array<float,2>{0.128695995f, 0.46946758f},
-std::array<float,2>{0.508218288f, 0.824714541f},
-std::array<float,2>{0.648351073f, 0.337633699f},
-std::array<float,2>{0.045474831f, 0.960371256f},
-std::array<float,2>{0.28748703f, 0.113039277f},
-std::array<float,2>{0.776886046f, 0.723058283f},
-std::array<float,2>{0.831983566f, 0.42331782f},
-std::array<float,2>{0.357582241f, 0.770143688f},
-std::array<float,2>{0.121776231f, 0.126837477f},
-std::array<float,2>{0.725402832f, 0.593761206f},
-std::array<float,2>{0.598123372f, 0.000264136557f},
-std::array<float,2>{0.20489046f, 0.667826474f},
-std::array<float,2>{0.408229411f, 0.307542056f},
-std::array<float,2>{0.919426799f, 0.893127263f},
-std::array<float,2>{0.794547677f, 0.0699916109f},
-std::array<float,2>{0.269650429f, 0.689014912f},
-std::array<float,2>{0.011934855f, 0.37232697f},
-std::array<float,2>{0.661554515f, 0.98205179f},
-std::array<float,2>{0.549526989f, 0.447992921f},
-std::array<float,2>{0.15881817f, 0.873776317f},
-std::array<float,2>{0.46379289f, 0.22774905f},
-std::array<float,2>{0.976259887f, 0.544594884f},
-std::array<float,2>{0.886110008f, 0.259839892f},
-std::array<float,2>{0.388805509f, 0.907229006f},
-std::array<float,2>{0.224507079f, 0.044018928f},
-std::array<float,2>{0.567697108f, 0.63143748f},
-std::array<float,2>{0.69116503f, 0.156810388f},
-std::array<float,2>{0.0822982565f, 0.592648208f},
-std::array<float,2>{0.335254788f, 0.386704117f},
-std::array<float,2>{0.863997221f, 0.803628862f},
-std::array<float,2>{0.941859007f, 0.0118544996f},
-std::array<float,2>{0.486972034f, 0.657543778f},
-std::array<float,2>{0.148384303f, 0.301979661f},
-std::array<float,2>{0.527132511f, 0.902624011f},
-std::array<float,2>{0.62706238f, 0.430662632f},
-std::array<float,2>{0.0477139764f, 0.778910995f},
-std::array<float,2>{0.307510942f, 0.137087807f},
-std::array<float,2>{0.753950477f, 0.607520103f},
-std::array<float,2>{0.823524714f, 0.332649648f},
-std::array<float,2>{0.359710902f, 0.966791511f},
-std::array<float,2>{0.0992603451f, 0.121111296f},
-std::array<float,2>{0.747792602f, 0.729548693f},
-std::array<float,2>{0.624718904f, 0.19131133f},
-std::array<float,2>{0.192039326f, 0.51017499f},
-std::array<float,2>{0.433091193f, 0.48392722f},
-std::array<float,2>{0.92512691f, 0.818973899f},
-std::array<float,2>{0.806414723f, 0.167756975f},
-std::array<float,2>{0.253347486f, 0.585330307f},
-std::array<float,2>{0.0258604884f, 0.378565788f},
-std::array<float,2>{0.673704386f, 0.811728239f},
-std::array<float,2>{0.536484718f, 0.251707464f},
-std::array<float,2>{0.173972934f, 0.915830314f},
-std::array<float,2>{0.445545733f, 0.03364053f},
-std::array<float,2>{0.988346159f, 0.638722956f},
-std::array<float,2>{0.904614031f, 0.445298076f},
-std::array<float,2>{0.402420789f, 0.860479414f},
-std::array<float,2>{0.240365297f, 0.22364825f},
-std::array<float,2>{0.583158016f, 0.532707274f},
-std::array<float,2>{0.709002554f, 0.0775808394f},
-std::array<float,2>{0.0763403401f, 0.70056659f},
-std::array<float,2>{0.314280599f, 0.362411499f},
-std::array<float,2>{0.849183977f, 0.972336709f},
-std::array<float,2>{0.915490746f, 0.243744925f},
-std::array<float,2>{0.411626637f, 0.561728656f},
-std::array<float,2>{0.210559979f, 0.460576445f},
-std::array<float,2>{0.594283819f, 0.846838057f},
-std::array<float,2>{0.720993876f, 0.35039708f},
-std::array<float,2>{0.121015273f, 0.993463576f},
-std::array<float,2>{0.352427065f, 0.0788597018f},
-std::array<float,2>{0.835655153f, 0.716406941f},
-std::array<float,2>{0.779110193f, 0.392377943f},
-std::array<float,2>{0.281524807f, 0.791788459f},
-std::array<float,2>{0.0420691147f, 0.177393094f},
-std::array<float,2>{0.643662691f, 0.570376575f},
-std::array<float,2>{0.512361467f, 0.0624511726f},
-std::array<float,2>{0.129614398f, 0.646508873f},
-std::array<float,2>{0.469868094f, 0.280887574f},
-std::array<float,2>{0.960646927f, 0.936681271f},
-std::array<float,2>{0.862077117f, 0.0958187282f},
-std::array<float,2>{0.329860896f, 0.743282199f},
-std::array<float,2>{0.0783774331f, 0.321657926f},
-std::array<float,2>{0.694478691f, 0.943779767f},
-std::array<float,2>{0.563239574f, 0.499068499f},
-std::array<float,2>{0.221754268f, 0.833300531f},
-std::array<float,2>{0.383395106f, 0.211125597f},
-std::array<float,2>{0.890505493f, 0.518482566f},
-std::array<float,2>{0.970595062f, 0.296259612f},
-std::array<float,2>{0.465209156f, 0.890288591f},
-std::array<float,2>{0.16027385f, 0.0165296867f},
-std::array<float,2>{0.551279187f, 0.683588803f},
-std::array<float,2>{0.656721294f, 0.145841032f},
-std::array<float,2>{0.00875396468f, 0.620308757f},
-std::array<float,2>{0.268541157f, 0.410743535f},
-std::array<float,2>{0.790614247f, 0.764835835f},
-std::array<float,2>{0.875397861f, 0.0878832415f},
-std::array<float,2>{0.378172666f, 0.709641516f},
-std::array<float,2>{0.226694316f, 0.357662469f},
-std::array<float,2>{0.577922523f, 0.987757206f},
-std::array<float,2>{0.699635565f, 0.467227638f},
-std::array<float,2>{0.0892674252f, 0.859062791f},
-std::array<float,2>{0.34045592f, 0.240602717f},
-std::array<float,2>{0.874245524f, 0.554686069f},
-std::array<float,2>{0.785086334f, 0.268837333f},
-std::array<float,2>{0.281232297f, 0.924519837f},
-std::array<float,2>{0.00496251136f, 0.0485805646f},
-std::array<float,2>{0.6674546f, 0.650887132f},
-std::array<float,2>{0.558684111f, 0.182522967f},
-std::array<float,2>{0.168303579f, 0.564404368f},
-std::array<float,2>{0.460618883f, 0.404408485f},
-std::array<float,2>{0.982833564f, 0.788491547f},
-std::array<float,2>{0.839161694f, 0.210410178f},
-std::array<float,2>{0.351412565f, 0.52492851f},
-std::array<float,2>{0.116056316f, 0.487056732f},
-std::array<float,2>{0.729744434f, 0.837434888f},
-std::array<float,2>{0.608332813f, 0.313986957f},
-std::array<float,2>{0.214504927f, 0.952929616f},
-std::array<float,2>{0.416663468f, 0.101770617f},
-std::array<float,2>{0.907411039f, 0.737695932f},
-std::array<float,2>{0.966302931f, 0.418479681f},
-std::array<float,2>{0.480475962f, 0.75743109f},
-std::array<float,2>{0.133012816f, 0.154425755f},
-std::array<float,2>{0.50518465f, 0.616620302f},
-std::array<float,2>{0.651511312f, 0.0244209524f},
-std::array<float,2>{0.034301389f, 0.672516823f},
-std::array<float,2>{0.293973744f, 0.28357625f},
-std::array<float,2>{0.770406067f, 0.88183099f},
-std::array<float,2>{0.994052887f, 0.131129727f},
-std::array<float,2>{0.443632036f, 0.598421037f},
-std::array<float,2>{0.186580792f, 0.427597046f},
-std::array<float,2>{0.542763054f, 0.766076505f},
-std::array<float,2>{0.682238221f, 0.31181258f},
-std::array<float,2>{0.0213731527f, 0.895365536f},
-std::array<float,2>{0.261002988f, 0.00672578393f},
-std::array<float,2>{0.799027741f, 0.6683864f},
-std::array<float,2>{0.851971388f, 0.475718945f},
-std::array<float,2>{0.324553549f, 0.823397756f},
-std::array<float,2>{0.0692131296f, 0.201905206f},
-std::array<float,2>{0.716197252f, 0.502259374f},
-std::array<float,2>{0.59047544f, 0.115417294f},
-std::array<float,2>{0.247729078f, 0.719640613f},
-std::array<float,2>{0.395906925f, 0.341886461f},
-std::array<float,2>{0.898246348f, 0.953600526f},
-std::array<float,2>{0.75847739f, 0.0413124524f},
-std::array<float,2>{0.302503526f, 0.628511965f},
-std::array<float,2>{0.0604545251f, 0.263736039f},
-std::array<float,2>{0.638747156f, 0.910488665f},
-std::array<float,2>{0.520548701f, 0.387386084f},
-std::array<float,2>{0.154854f, 0.797782421f},
-std::array<float,2>{0.492770821f, 0.16270721f},
-std::array<float,2>{0.95105511f, 0.588518202f},
-std::array<float,2>{0.934506238f, 0.369491756f},
-std::array<float,2>{0.425418526f, 0.980208039f},
-std::array<float,2>{0.201921567f, 0.0651647002f},
-std::array<float,2>{0.610252976f, 0.693793893f},
-std::array<float,2>{0.736605942f, 0.232318044f},
-std::array<float,2>{0.102229096f, 0.540900528f},
-std::array<float,2>{0.370092243f, 0.45226261f},
-std::array<float,2>{0.813616037f, 0.868635893f},
-std::array<float,2>{0.964550138f, 0.0723541901f},
-std::array<float,2>{0.478449851f, 0.69543314f},
-std::array<float,2>{0.137838632f, 0.367140353f},
-std::array<float,2>{0.503434002f, 0.974057794f},
-std::array<float,2>{0.652484477f, 0.440542936f},
-std::array<float,2>{0.0364915878f, 0.863847494f},
-std::array<float,2>{0.292664021f, 0.219618544f},
-std::array<float,2>{0.766433001f, 0.53625077f},
-std::array<float,2>{0.8423419f, 0.253942341f},
-std::array<float,2>{0.347489148f, 0.919628799f},
-std::array<float,2>{0.109904453f, 0.0388274305f},
-std::array<float,2>{0.732517242f, 0.634196937f},
-std::array<float,2>{0.603126109f, 0.168149814f},
-std::array<float,2>{0.217655122f, 0.578258991f},
-std::array<float,2>{0.421633482f, 0.381346166f},
-std::array<float,2>{0.911427259f, 0.806810498f},
-std::array<float,2>{0.785302222f, 0.19382754f},
-std::array<float,2>{0.274830401f, 0.515360057f},
-std::array<float,2>{0.00281238207f, 0.477442443f},
-std::array<float,2>{0.671007931f, 0.815154076f},
-std::array<float,2>{0.556951702f, 0.328249902f},
-std::array<float,2>{0.166271925f, 0.963560402f},
-std::array<float,2>{0.455238074f, 0.119203828f},
-std::array<float,2>{0.977427721f, 0.731702924f},
-std::array<float,2>{0.881053448f, 0.436454296f},
-std::array<float,2>{0.380707592f, 0.777254462f},
-std::array<float,2>{0.232850015f, 0.134126931f},
-std::array<float,2>{0.57326436f, 0.604148805f},
-std::array<float,2>{0.697086215f, 0.00911905244f},
-std::array<float,2>{0.0903384611f, 0.660648763f},
-std::array<float,2>{0.336708814f, 0.299745291f},
-std::array<float,2>{0.869520724f, 0.898841798f},
-std::array<float,2>{0.930757165f, 0.143791288f},
-std::array<float,2>{0.427806377f, 0.623237312f},
-std::array<float,2>{0.19829686f, 0.409300566f},
-std::array<float,2>{0.614368916f, 0.759881377f},
-std::array<float,2>{0.739904583f, 0.289423525f},
-std::array<float,2>{0.109362587f, 0.882975876f},
-std::array<float,2>{0.373774797f, 0.0225428101f},
-std::array<float,2>{0.820170939f, 0.684020996f},
-std::array<float,2>{0.764893472f, 0.495125771f},
-std::array<float,2>{0.299878687f, 0.828697145f},
-std::array<float,2>{0.0569474399f, 0.216101095f},
-std::array<float,2>{0.633014858f, 0.522928476f},
-std::array<float,2>{0.517563164f, 0.0986650959f},
-std::array<float,2>{0.150550336f, 0.748415589f},
-std::array<float,2>{0.49679327f, 0.327751786f},
-std::array<float,2>{0.948639631f, 0.939380109f},
-std::array<float,2>{0.859162748f, 0.0571077093f},
-std::array<float,2>{0.320389569f, 0.641576231f},
-std::array<float,2>{0.0640597865f, 0.273526579f},
-std::array<float,2>{0.714789331f, 0.931314051f},
-std::array<float,2>{0.586496949f, 0.396845877f},
-std::array<float,2>{0.245436221f, 0.79431814f},
-std::array<float,2>{0.391256928f, 0.17449604f},
-std::array<float,2>{0.894205213f, 0.574555635f},
-std::array<float,2>{0.997363448f, 0.346399009f},
-std::array<float,2>{0.438541412f, 0.996812284f},
-std::array<float,2>{0.180732757f, 0.0828999802f},
-std::array<float,2>{0.544330239f, 0.713401735f},
-std::array<float,2>{0.685116172f, 0.247072265f},
-std::array<float,2>{0.0179108344f, 0.557290077f},
-std::array<float,2>{0.265522748f, 0.456557423f},
-std::array<float,2>{0.803745687f, 0.85117346f},
-std::array<float,2>{0.900560975f, 0.0285000373f},
-std::array<float,2>{0.401683718f, 0.675903738f},
-std::array<float,2>{0.237602383f, 0.286446065f},
-std::array<float,2>{0.580540419f, 0.878548026f},
-std::array<float,2>{0.703632772f, 0.417526245f},
-std::array<float,2>{0.0706461519f, 0.752948999f},
-std::array<float,2>{0.317764759f, 0.150432169f},
-std::array<float,2>{0.843831301f, 0.611326873f},
-std::array<float,2>{0.809144378f, 0.317120373f},
-std::array<float,2>{0.254877716f, 0.945746779f},
-std::array<float,2>{0.0303876251f, 0.106967844f},
-std::array<float,2>{0.67601043f, 0.739745557f},
-std::array<float,2>{0.532961547f, 0.205502823f},
-std::array<float,2>{0.177723378f, 0.530927777f},
-std::array<float,2>{0.45176962f, 0.491523117f},
-std::array<float,2>{0.98545742f, 0.843164563f},
-std::array<float,2>{0.825560808f, 0.186125755f},
-std::array<float,2>{0.364965588f, 0.568894327f},
-std::array<float,2>{0.0951285213f, 0.400340647f},
-std::array<float,2>{0.744573236f, 0.781935871f},
-std::array<float,2>{0.61738503f, 0.270933509f},
-std::array<float,2>{0.187914103f, 0.92681098f},
-std::array<float,2>{0.433964729f, 0.051104553f},
-std::array<float,2>{0.925864697f, 0.653392196f},
-std::array<float,2>{0.940948308f, 0.461522192f},
-std::array<float,2>{0.49070394f, 0.855455518f},
-std::array<float,2>{0.141263276f, 0.237919793f},
-std::array<float,2>{0.530782521f, 0.549433291f},
-std::array<float,2>{0.632428765f, 0.0903748125f},
-std::array<float,2>{0.0511893593f, 0.703566134f},
-std::array<float,2>{0.310594022f, 0.35345453f},
-std::array<float,2>{0.753408909f, 0.988469481f},
-std::array<float,2>{0.973681331f, 0.230367914f},
-std::array<float,2>{0.461982608f, 0.545646727f},
-std::array<float,2>{0.158035681f, 0.446451604f},
-std::array<float,2>{0.548732877f, 0.87249577f},
-std::array<float,2>{0.663289964f, 0.374493212f},
-std::array<float,2>{0.0156134637f, 0.983801067f},
-std::array<float,2>{0.272827089f, 0.0675844252f},
-std::array<float,2>{0.796527207f, 0.689753711f},
-std::array<float,2>{0.866032004f, 0.382869691f},
-std::array<float,2>{0.333505392f, 0.801214933f},
-std::array<float,2>{0.0854167342f, 0.159316316f},
-std::array<float,2>{0.688018501f, 0.591681659f},
-std::array<float,2>{0.569455624f, 0.0457937717f},
-std::array<float,2>{0.225974709f, 0.629678309f},
-std::array<float,2>{0.388207763f, 0.25855276f},
-std::array<float,2>{0.883221269f, 0.908984303f},
-std::array<float,2>{0.774570048f, 0.109524198f},
-std::array<float,2>{0.28625524f, 0.726055562f},
-std::array<float,2>{0.0433168858f, 0.339657336f},
-std::array<float,2>{0.645176888f, 0.957185388f},
-std::array<float,2>{0.510608971f, 0.471509308f},
-std::array<float,2>{0.125704035f, 0.828041732f},
-std::array<float,2>{0.473402202f, 0.19622688f},
-std::array<float,2>{0.956810892f, 0.506004572f},
-std::array<float,2>{0.921582401f, 0.305805355f},
-std::array<float,2>{0.407552183f, 0.891393006f},
-std::array<float,2>{0.206488431f, 0.00299983984f},
-std::array<float,2>{0.599960089f, 0.664817452f},
-std::array<float,2>{0.72391063f, 0.127269983f},
-std::array<float,2>{0.123393245f, 0.596730709f},
-std::array<float,2>{0.355491161f, 0.424967289f},
-std::array<float,2>{0.828387141f, 0.772575855f},
-std::array<float,2>{0.991755903f, 0.0316214226f},
-std::array<float,2>{0.447658271f, 0.638308167f},
-std::array<float,2>{0.172698319f, 0.253570855f},
-std::array<float,2>{0.538176835f, 0.916194141f},
-std::array<float,2>{0.674295723f, 0.376531482f},
-std::array<float,2>{0.0250884071f, 0.810408652f},
-std::array<float,2>{0.250529587f, 0.165479675f},
-std::array<float,2>{0.808105052f, 0.583635926f},
-std::array<float,2>{0.849781036f, 0.360359669f},
-std::array<float,2>{0.315947324f, 0.969933689f},
-std::array<float,2>{0.0749084428f, 0.0758285075f},
-std::array<float,2>{0.707110763f, 0.702820539f},
-std::array<float,2>{0.584682405f, 0.224870577f},
-std::array<float,2>{0.239336342f, 0.534172058f},
-std::array<float,2>{0.40484488f, 0.44223094f},
-std::array<float,2>{0.903868973f, 0.86233443f},
-std::array<float,2>{0.756382585f, 0.139660776f},
-std::array<float,2>{0.306479305f, 0.605688751f},
-std::array<float,2>{0.0490689091f, 0.432400793f},
-std::array<float,2>{0.625074506f, 0.780297458f},
-std::array<float,2>{0.523865521f, 0.302928746f},
-std::array<float,2>{0.145547956f, 0.904501498f},
-std::array<float,2>{0.485082209f, 0.0150643801f},
-std::array<float,2>{0.943918705f, 0.658241868f},
-std::array<float,2>{0.922477484f, 0.48158434f},
-std::array<float,2>{0.430487603f, 0.818297327f},
-std::array<float,2>{0.19451192f, 0.187904596f},
-std::array<float,2>{0.622294962f, 0.508156061f},
-std::array<float,2>{0.749021053f, 0.123901151f},
-std::array<float,2>{0.101384051f, 0.727827787f},
-std::array<float,2>{0.361838192f, 0.335850924f},
-std::array<float,2>{0.82207191f, 0.967235148f},
-std::array<float,2>{0.887492478f, 0.213677034f},
-std::array<float,2>{0.386028677f, 0.517106533f},
-std::array<float,2>{0.220477819f, 0.496741205f},
-std::array<float,2>{0.56446439f, 0.835884094f},
-std::array<float,2>{0.691914916f, 0.323194355f},
-std::array<float,2>{0.0818301439f, 0.943073571f},
-std::array<float,2>{0.33009702f, 0.0948852599f},
-std::array<float,2>{0.85941726f, 0.744536698f},
-std::array<float,2>{0.791273355f, 0.412865311f},
-std::array<float,2>{0.266812474f, 0.763047874f},
-std::array<float,2>{0.00981656928f, 0.148173675f},
-std::array<float,2>{0.65829885f, 0.618052006f},
-std::array<float,2>{0.553275585f, 0.0176648386f},
-std::array<float,2>{0.163619667f, 0.680974424f},
-std::array<float,2>{0.467840999f, 0.294533819f},
-std::array<float,2>{0.972469151f, 0.88765347f},
-std::array<float,2>{0.833104134f, 0.0808513537f},
-std::array<float,2>{0.354241431f, 0.716970503f},
-std::array<float,2>{0.11908f, 0.349456251f},
-std::array<float,2>{0.719532609f, 0.995543122f},
-std::array<float,2>{0.597067416f, 0.457920372f},
-std::array<float,2>{0.20717676f, 0.843945205f},
-std::array<float,2>{0.413307041f, 0.244604781f},
-std::array<float,2>{0.916419387f, 0.559900522f},
-std::array<float,2>{0.957097113f, 0.27825886f},
-std::array<float,2>{0.47094506f, 0.935530484f},
-std::array<float,2>{0.13176176f, 0.0586200655f},
-std::array<float,2>{0.514524579f, 0.644832671f},
-std::array<float,2>{0.64193517f, 0.178157032f},
-std::array<float,2>{0.0392686203f, 0.573650956f},
-std::array<float,2>{0.283240438f, 0.392633796f},
-std::array<float,2>{0.780934453f, 0.789126515f},
-std::array<float,2>{0.908940375f, 0.104620017f},
-std::array<float,2>{0.414084136f, 0.736323595f},
-std::array<float,2>{0.212364733f, 0.315509826f},
-std::array<float,2>{0.607101917f, 0.950230479f},
-std::array<float,2>{0.727717757f, 0.485891491f},
-std::array<float,2>{0.114716344f, 0.838692844f},
-std::array<float,2>{0.349226505f, 0.208983064f},
-std::array<float,2>{0.837354541f, 0.526560128f},
-std::array<float,2>{0.773375154f, 0.282871425f},
-std::array<float,2>{0.295581311f, 0.879172385f},
-std::array<float,2>{0.0319819339f, 0.026508702f},
-std::array<float,2>{0.648501575f, 0.674570441f},
-std::array<float,2>{0.507724464f, 0.153254732f},
-std::array<float,2>{0.135094628f, 0.615036905f},
-std::array<float,2>{0.48376444f, 0.421325177f},
-std::array<float,2>{0.966833889f, 0.75545311f},
-std::array<float,2>{0.871818364f, 0.239251316f},
-std::array<float,2>{0.343667507f, 0.552449584f},
-std::array<float,2>{0.0869743526f, 0.465042531f},
-std::array<float,2>{0.701456308f, 0.856196463f},
-std::array<float,2>{0.575133324f, 0.355724782f},
-std::array<float,2>{0.229994625f, 0.985629022f},
-std::array<float,2>{0.375710934f, 0.0879584029f},
-std::array<float,2>{0.877248883f, 0.708106399f},
-std::array<float,2>{0.980925262f, 0.403216392f},
-std::array<float,2>{0.458637089f, 0.785857081f},
-std::array<float,2>{0.170798644f, 0.180493429f},
-std::array<float,2>{0.561986685f, 0.565749228f},
-std::array<float,2>{0.665295303f, 0.0494097508f},
-std::array<float,2>{0.00741999177f, 0.649204969f},
-std::array<float,2>{0.277403653f, 0.265647769f},
-std::array<float,2>{0.781855047f, 0.923430979f},
-std::array<float,2>{0.951754093f, 0.160774291f},
-std::array<float,2>{0.494223088f, 0.58641082f},
-std::array<float,2>{0.152472019f, 0.389298707f},
-std::array<float,2>{0.523148119f, 0.799601257f},
-std::array<float,2>{0.637263894f, 0.263320774f},
-std::array<float,2>{0.0608901568f, 0.912292004f},
-std::array<float,2>{0.303864658f, 0.0409604982f},
-std::array<float,2>{0.760529876f, 0.625684023f},
-std::array<float,2>{0.81460166f, 0.450642556f},
-std::array<float,2>{0.368106633f, 0.869870186f},
-std::array<float,2>{0.104556032f, 0.233199909f},
-std::array<float,2>{0.73542881f, 0.54128021f},
-std::array<float,2>{0.61247313f, 0.0639168173f},
-std::array<float,2>{0.199773878f, 0.693338931f},
-std::array<float,2>{0.42367202f, 0.367472082f},
-std::array<float,2>{0.935569584f, 0.976850152f},
-std::array<float,2>{0.798734486f, 0.00581669714f},
-std::array<float,2>{0.258867383f, 0.670166731f},
-std::array<float,2>{0.0233188476f, 0.309525311f},
-std::array<float,2>{0.681016505f, 0.897327125f},
-std::array<float,2>{0.539068341f, 0.428236842f},
-std::array<float,2>{0.185433492f, 0.767903805f},
-std::array<float,2>{0.44253543f, 0.130184829f},
-std::array<float,2>{0.995471656f, 0.600446165f},
-std::array<float,2>{0.894655943f, 0.340850741f},
-std::array<float,2>{0.39725861f, 0.956451952f},
-std::array<float,2>{0.24808614f, 0.113499053f},
-std::array<float,2>{0.593421459f, 0.721144795f},
-std::array<float,2>{0.718566895f, 0.199992463f},
-std::array<float,2>{0.0669286177f, 0.501284242f},
-std::array<float,2>{0.326982528f, 0.474391252f},
-std::array<float,2>{0.853818476f, 0.821902096f},
-std::array<float,2>{0.944709539f, 0.121530257f},
-std::array<float,2>{0.485456944f, 0.729790568f},
-std::array<float,2>{0.14544113f, 0.332990468f},
-std::array<float,2>{0.525312066f, 0.966386497f},
-std::array<float,2>{0.626714349f, 0.484359086f},
-std::array<float,2>{0.049879089f, 0.819192469f},
-std::array<float,2>{0.304909617f, 0.191125244f},
-std::array<float,2>{0.757181287f, 0.509884536f},
-std::array<float,2>{0.821246564f, 0.302111715f},
-std::array<float,2>{0.36322394f, 0.902364075f},
-std::array<float,2>{0.0996623412f, 0.0121582244f},
-std::array<float,2>{0.749398589f, 0.65745604f},
-std::array<float,2>{0.621174932f, 0.136800632f},
-std::array<float,2>{0.193947598f, 0.607791066f},
-std::array<float,2>{0.431346804f, 0.430383652f},
-std::array<float,2>{0.923006415f, 0.779225349f},
-std::array<float,2>{0.807485044f, 0.223970324f},
-std::array<float,2>{0.251703769f, 0.53238976f},
-std::array<float,2>{0.0236770418f, 0.444952071f},
-std::array<float,2>{0.675600767f, 0.860771239f},
-std::array<float,2>{0.537397802f, 0.362684518f},
-std::array<float,2>{0.173122808f, 0.972548902f},
-std::array<float,2>{0.448836625f, 0.0773125291f},
-std::array<float,2>{0.990384996f, 0.700250924f},
-std::array<float,2>{0.902778804f, 0.378682852f},
-std::array<float,2>{0.405658066f, 0.811819792f},
-std::array<float,2>{0.238525078f, 0.167703956f},
-std::array<float,2>{0.585610926f, 0.585182488f},
-std::array<float,2>{0.708110392f, 0.0333630368f},
-std::array<float,2>{0.0756516233f, 0.638929367f},
-std::array<float,2>{0.314618647f, 0.251913488f},
-std::array<float,2>{0.851271451f, 0.915572882f},
-std::array<float,2>{0.91760993f, 0.177721515f},
-std::array<float,2>{0.412852883f, 0.570572197f},
-std::array<float,2>{0.208370477f, 0.392222852f},
-std::array<float,2>{0.596371591f, 0.79171741f},
-std::array<float,2>{0.719906151f, 0.281096458f},
-std::array<float,2>{0.117405534f, 0.936808884f},
-std::array<float,2>{0.355366409f, 0.0621180087f},
-std::array<float,2>{0.832911253f, 0.64682889f},
-std::array<float,2>{0.780131519f, 0.46080479f},
-std::array<float,2>{0.285048366f, 0.84705925f},
-std::array<float,2>{0.0402074791f, 0.243961722f},
-std::array<float,2>{0.641564667f, 0.561839581f},
-std::array<float,2>{0.515164196f, 0.0786474124f},
-std::array<float,2>{0.132516995f, 0.716657996f},
-std::array<float,2>{0.472607762f, 0.350300044f},
-std::array<float,2>{0.95842284f, 0.993359208f},
-std::array<float,2>{0.860573113f, 0.0163096488f},
-std::array<float,2>{0.331831783f, 0.683342338f},
-std::array<float,2>{0.080965884f, 0.296101063f},
-std::array<float,2>{0.692411244f, 0.890613437f},
-std::array<float,2>{0.565596819f, 0.4110502f},
-std::array<float,2>{0.219716802f, 0.765130341f},
-std::array<float,2>{0.384788185f, 0.145657852f},
-std::array<float,2>{0.888276696f, 0.620524108f},
-std::array<float,2>{0.970958054f, 0.321479857f},
-std::array<float,2>{0.467146397f, 0.943525255f},
-std::array<float,2>{0.162372321f, 0.0960939378f},
-std::array<float,2>{0.553863585f, 0.743570447f},
-std::array<float,2>{0.659207821f, 0.211325139f},
-std::array<float,2>{0.0107675884f, 0.51813072f},
-std::array<float,2>{0.265729278f, 0.499313176f},
-std::array<float,2>{0.792851269f, 0.833030224f},
-std::array<float,2>{0.878641427f, 0.0487384424f},
-std::array<float,2>{0.376262039f, 0.651344776f},
-std::array<float,2>{0.229102671f, 0.268718392f},
-std::array<float,2>{0.575264454f, 0.92473048f},
-std::array<float,2>{0.702668667f, 0.404663593f},
-std::array<float,2>{0.0866074115f, 0.788306236f},
-std::array<float,2>{0.342262417f, 0.182253957f},
-std::array<float,2>{0.872940361f, 0.564040422f},
-std::array<float,2>{0.783070982f, 0.357854098f},
-std::array<float,2>{0.278447449f, 0.987515748f},
-std::array<float,2>{0.00682996633f, 0.0876369625f},
-std::array<float,2>{0.664302647f, 0.709960043f},
-std::array<float,2>{0.560851812f, 0.240346387f},
-std::array<float,2>{0.171802863f, 0.554403782f},
-std::array<float,2>{0.45730418f, 0.466967732f},
-std::array<float,2>{0.981809378f, 0.859305561f},
-std::array<float,2>{0.8366009f, 0.154783964f},
-std::array<float,2>{0.348412037f, 0.616263211f},
-std::array<float,2>{0.113870934f, 0.418771923f},
-std::array<float,2>{0.726872623f, 0.757804692f},
-std::array<float,2>{0.605972588f, 0.283280253f},
-std::array<float,2>{0.211707279f, 0.881473005f},
-std::array<float,2>{0.415734708f, 0.0247709937f},
-std::array<float,2>{0.909772813f, 0.672730744f},
-std::array<float,2>{0.96860534f, 0.487092316f},
-std::array<float,2>{0.483355045f, 0.837868094f},
-std::array<float,2>{0.136410415f, 0.210104927f},
-std::array<float,2>{0.506056786f, 0.525265932f},
-std::array<float,2>{0.649651527f, 0.101953395f},
-std::array<float,2>{0.0328657031f, 0.737396181f},
-std::array<float,2>{0.295911729f, 0.314437449f},
-std::array<float,2>{0.772024214f, 0.952781856f},
-std::array<float,2>{0.994941652f, 0.201784372f},
-std::array<float,2>{0.442234993f, 0.502155364f},
-std::array<float,2>{0.184294835f, 0.475967854f},
-std::array<float,2>{0.540166438f, 0.823534727f},
-std::array<float,2>{0.680211306f, 0.342119366f},
-std::array<float,2>{0.0221576337f, 0.953344345f},
-std::array<float,2>{0.25787881f, 0.115516499f},
-std::array<float,2>{0.797804415f, 0.719424605f},
-std::array<float,2>{0.855319321f, 0.427458853f},
-std::array<float,2>{0.327926457f, 0.7657336f},
-std::array<float,2>{0.068355985f, 0.130972072f},
-std::array<float,2>{0.717176139f, 0.598359108f},
-std::array<float,2>{0.592254519f, 0.00642479584f},
-std::array<float,2>{0.249502063f, 0.667993724f},
-std::array<float,2>{0.398375571f, 0.311704814f},
-std::array<float,2>{0.896058261f, 0.895208895f},
-std::array<float,2>{0.760944724f, 0.0652021244f},
-std::array<float,2>{0.303421259f, 0.693526626f},
-std::array<float,2>{0.0618490987f, 0.3691535f},
-std::array<float,2>{0.638087869f, 0.980388522f},
-std::array<float,2>{0.522057533f, 0.452449113f},
-std::array<float,2>{0.153946221f, 0.868212938f},
-std::array<float,2>{0.495422781f, 0.232059002f},
-std::array<float,2>{0.952708125f, 0.540538967f},
-std::array<float,2>{0.937167346f, 0.264119953f},
-std::array<float,2>{0.422756821f, 0.910160303f},
-std::array<float,2>{0.201123491f, 0.0412067175f},
-std::array<float,2>{0.611496508f, 0.628690004f},
-std::array<float,2>{0.735048592f, 0.162938446f},
-std::array<float,2>{0.103633381f, 0.588795602f},
-std::array<float,2>{0.368888438f, 0.38756451f},
-std::array<float,2>{0.815863848f, 0.797364891f},
-std::array<float,2>{0.978197992f, 0.0100885304f},
-std::array<float,2>{0.456682622f, 0.663386524f},
-std::array<float,2>{0.167736158f, 0.298825324f},
-std::array<float,2>{0.558476269f, 0.90159148f},
-std::array<float,2>{0.670471847f, 0.434121788f},
-std::array<float,2>{0.0034739417f, 0.774725795f},
-std::array<float,2>{0.273453832f, 0.136064872f},
-std::array<float,2>{0.786255836f, 0.601688862f},
-std::array<float,2>{0.870542109f, 0.33041048f},
-std::array<float,2>{0.33771494f, 0.961036384f},
-std::array<float,2>{0.0910011381f, 0.117304079f},
-std::array<float,2>{0.696085751f, 0.733990073f},
-std::array<float,2>{0.572778285f, 0.192906588f},
-std::array<float,2>{0.23391591f, 0.512536883f},
-std::array<float,2>{0.379044831f, 0.479629099f},
-std::array<float,2>{0.882276654f, 0.81395191f},
-std::array<float,2>{0.767214f, 0.171456426f},
-std::array<float,2>{0.291467607f, 0.580468357f},
-std::array<float,2>{0.0356445797f, 0.380581021f},
-std::array<float,2>{0.653609633f, 0.806122303f},
-std::array<float,2>{0.502448022f, 0.256596386f},
-std::array<float,2>{0.137527287f, 0.921739936f},
-std::array<float,2>{0.477359414f, 0.037040107f},
-std::array<float,2>{0.963224769f, 0.634795547f},
-std::array<float,2>{0.910305023f, 0.438641429f},
-std::array<float,2>{0.420007169f, 0.86560154f},
-std::array<float,2>{0.218612134f, 0.221315786f},
-std::array<float,2>{0.601659775f, 0.537391484f},
-std::array<float,2>{0.733847976f, 0.0720058084f},
-std::array<float,2>{0.110842183f, 0.697650433f},
-std::array<float,2>{0.3463853f, 0.364653498f},
-std::array<float,2>{0.843052745f, 0.975726366f},
-std::array<float,2>{0.893368721f, 0.249903977f},
-std::array<float,2>{0.392076433f, 0.555256188f},
-std::array<float,2>{0.244949952f, 0.453406841f},
-std::array<float,2>{0.587018907f, 0.849175394f},
-std::array<float,2>{0.713446558f, 0.344996303f},
-std::array<float,2>{0.0632182583f, 0.998257637f},
-std::array<float,2>{0.321998835f, 0.0844267905f},
-std::array<float,2>{0.857815087f, 0.71159482f},
-std::array<float,2>{0.803532183f, 0.394874096f},
-std::array<float,2>{0.264437795f, 0.795984566f},
-std::array<float,2>{0.0191017967f, 0.172474578f},
-std::array<float,2>{0.684333742f, 0.576669633f},
-std::array<float,2>{0.542984128f, 0.0557329841f},
-std::array<float,2>{0.180559441f, 0.643954635f},
-std::array<float,2>{0.437695324f, 0.275925726f},
-std::array<float,2>{0.996226072f, 0.932884991f},
-std::array<float,2>{0.819082439f, 0.100625843f},
-std::array<float,2>{0.374950737f, 0.747428775f},
-std::array<float,2>{0.107443079f, 0.324451417f},
-std::array<float,2>{0.738293529f, 0.939521551f},
-std::array<float,2>{0.614014208f, 0.49218902f},
-std::array<float,2>{0.197892919f, 0.830606818f},
-std::array<float,2>{0.428744823f, 0.217552036f},
-std::array<float,2>{0.930341125f, 0.519771874f},
-std::array<float,2>{0.94742626f, 0.291187704f},
-std::array<float,2>{0.497219294f, 0.885973692f},
-std::array<float,2>{0.151439041f, 0.0207277406f},
-std::array<float,2>{0.515729785f, 0.686344862f},
-std::array<float,2>{0.634454191f, 0.141213879f},
-std::array<float,2>{0.0579337664f, 0.622641921f},
-std::array<float,2>{0.299157709f, 0.40766266f},
-std::array<float,2>{0.763679147f, 0.757984698f},
-std::array<float,2>{0.9269014f, 0.0926025659f},
-std::array<float,2>{0.435532808f, 0.705602527f},
-std::array<float,2>{0.189359725f, 0.354716569f},
-std::array<float,2>{0.618191898f, 0.991223693f},
-std::array<float,2>{0.746052384f, 0.46373561f},
-std::array<float,2>{0.0941114947f, 0.852729559f},
-std::array<float,2>{0.363889724f, 0.235608503f},
-std::array<float,2>{0.825098455f, 0.547145844f},
-std::array<float,2>{0.752776623f, 0.272656828f},
-std::array<float,2>{0.311533034f, 0.928878903f},
-std::array<float,2>{0.0519695356f, 0.0545118675f},
-std::array<float,2>{0.631750107f, 0.655312061f},
-std::array<float,2>{0.529768169f, 0.184877723f},
-std::array<float,2>{0.142304987f, 0.566714883f},
-std::array<float,2>{0.491332561f, 0.401259661f},
-std::array<float,2>{0.940168202f, 0.785072505f},
-std::array<float,2>{0.845065176f, 0.20353967f},
-std::array<float,2>{0.317093909f, 0.527872741f},
-std::array<float,2>{0.0714739859f, 0.489052564f},
-std::array<float,2>{0.704719543f, 0.84081763f},
-std::array<float,2>{0.581063926f, 0.319796443f},
-std::array<float,2>{0.23635906f, 0.948590755f},
-std::array<float,2>{0.400920212f, 0.107942902f},
-std::array<float,2>{0.901396215f, 0.740612805f},
-std::array<float,2>{0.985260487f, 0.414503843f},
-std::array<float,2>{0.45238474f, 0.751950741f},
-std::array<float,2>{0.176502913f, 0.149968743f},
-std::array<float,2>{0.53131336f, 0.612889588f},
-std::array<float,2>{0.677202344f, 0.0293876585f},
-std::array<float,2>{0.0297259912f, 0.679361522f},
-std::array<float,2>{0.255399138f, 0.288349479f},
-std::array<float,2>{0.810248435f, 0.875644922f},
-std::array<float,2>{0.955192208f, 0.126670346f},
-std::array<float,2>{0.474017471f, 0.594127834f},
-std::array<float,2>{0.126200125f, 0.423006773f},
-std::array<float,2>{0.511665106f, 0.770336151f},
-std::array<float,2>{0.646119416f, 0.307218045f},
-std::array<float,2>{0.0448837541f, 0.893471777f},
-std::array<float,2>{0.285450041f, 0.000176106376f},
-std::array<float,2>{0.773966074f, 0.667631328f},
-std::array<float,2>{0.829276383f, 0.469704896f},
-std::array<float,2>{0.35681662f, 0.825094044f},
-std::array<float,2>{0.124475576f, 0.198872298f},
-std::array<float,2>{0.722737432f, 0.504990458f},
-std::array<float,2>{0.601055145f, 0.112898812f},
-std::array<float,2>{0.205363274f, 0.722736478f},
-std::array<float,2>{0.406877458f, 0.337805539f},
-std::array<float,2>{0.920237064f, 0.960132003f},
-std::array<float,2>{0.795649588f, 0.0442932658f},
-std::array<float,2>{0.272119641f, 0.631695688f},
-std::array<float,2>{0.0142839458f, 0.260158271f},
-std::array<float,2>{0.662434936f, 0.90769273f},
-std::array<float,2>{0.547515035f, 0.386438966f},
-std::array<float,2>{0.157190502f, 0.803290725f},
-std::array<float,2>{0.461425573f, 0.157005847f},
-std::array<float,2>{0.973029852f, 0.592336118f},
-std::array<float,2>{0.88410455f, 0.37227127f},
-std::array<float,2>{0.386881649f, 0.982195556f},
-std::array<float,2>{0.22510016f, 0.0702754632f},
-std::array<float,2>{0.569067657f, 0.689427555f},
-std::array<float,2>{0.688730359f, 0.227990657f},
-std::array<float,2>{0.0841830447f, 0.544875085f},
-std::array<float,2>{0.332553148f, 0.448046297f},
-std::array<float,2>{0.86715132f, 0.873941183f},
-std::array<float,2>{0.989877224f, 0.0761311799f},
-std::array<float,2>{0.447259337f, 0.70306319f},
-std::array<float,2>{0.175583586f, 0.36069423f},
-std::array<float,2>{0.536042452f, 0.970187545f},
-std::array<float,2>{0.672324002f, 0.441938758f},
-std::array<float,2>{0.0268195439f, 0.862699568f},
-std::array<float,2>{0.252857596f, 0.224850163f},
-std::array<float,2>{0.805574119f, 0.533835173f},
-std::array<float,2>{0.848488748f, 0.253774107f},
-std::array<float,2>{0.313210189f, 0.916442394f},
-std::array<float,2>{0.0775387958f, 0.0312645063f},
-std::array<float,2>{0.710578322f, 0.638531566f},
-std::array<float,2>{0.582809091f, 0.165209085f},
-std::array<float,2>{0.24135825f, 0.583778143f},
-std::array<float,2>{0.403477609f, 0.37687993f},
-std::array<float,2>{0.905286789f, 0.810115516f},
-std::array<float,2>{0.755300283f, 0.187542334f},
-std::array<float,2>{0.307622641f, 0.507983804f},
-std::array<float,2>{0.0482278541f, 0.481788665f},
-std::array<float,2>{0.628498614f, 0.818098664f},
-std::array<float,2>{0.526064038f, 0.335495621f},
-std::array<float,2>{0.147277147f, 0.966899633f},
-std::array<float,2>{0.487802297f, 0.123653933f},
-std::array<float,2>{0.942960441f, 0.72756952f},
-std::array<float,2>{0.924662948f, 0.432144731f},
-std::array<float,2>{0.432602644f, 0.780569494f},
-std::array<float,2>{0.192700848f, 0.140052184f},
-std::array<float,2>{0.623320282f, 0.605837524f},
-std::array<float,2>{0.746797562f, 0.0146612795f},
-std::array<float,2>{0.0983725339f, 0.658464968f},
-std::array<float,2>{0.360644162f, 0.303100556f},
-std::array<float,2>{0.823008001f, 0.904766858f},
-std::array<float,2>{0.888803899f, 0.148195922f},
-std::array<float,2>{0.384685338f, 0.617831469f},
-std::array<float,2>{0.221182466f, 0.412758678f},
-std::array<float,2>{0.563986301f, 0.76286453f},
-std::array<float,2>{0.694169283f, 0.294720203f},
-std::array<float,2>{0.0797490627f, 0.887392461f},
-std::array<float,2>{0.328971893f, 0.01792459f},
-std::array<float,2>{0.862782001f, 0.68087256f},
-std::array<float,2>{0.789805114f, 0.496872783f},
-std::array<float,2>{0.269113064f, 0.8355937f},
-std::array<float,2>{0.00949306227f, 0.213527352f},
-std::array<float,2>{0.658062339f, 0.517357826f},
-std::array<float,2>{0.552362263f, 0.0951637998f},
-std::array<float,2>{0.161717713f, 0.744278491f},
-std::array<float,2>{0.466162413f, 0.322865278f},
-std::array<float,2>{0.969543874f, 0.943313003f},
-std::array<float,2>{0.834333181f, 0.05885325f},
-std::array<float,2>{0.352562875f, 0.644670606f},
-std::array<float,2>{0.119440883f, 0.278060526f},
-std::array<float,2>{0.721925199f, 0.9350788f},
-std::array<float,2>{0.595449984f, 0.393016547f},
-std::array<float,2>{0.20912987f, 0.789381504f},
-std::array<float,2>{0.410185486f, 0.177831739f},
-std::array<float,2>{0.914583921f, 0.573317468f},
-std::array<float,2>{0.959173203f, 0.349142641f},
-std::array<float,2>{0.469335735f, 0.995293677f},
-std::array<float,2>{0.130401194f, 0.0806130096f},
-std::array<float,2>{0.513046443f, 0.717046201f},
-std::array<float,2>{0.642624795f, 0.244166434f},
-std::array<float,2>{0.041668795f, 0.559754312f},
-std::array<float,2>{0.282381535f, 0.457725644f},
-std::array<float,2>{0.777962208f, 0.844092548f},
-std::array<float,2>{0.90654248f, 0.026703503f},
-std::array<float,2>{0.417819083f, 0.674361289f},
-std::array<float,2>{0.213697791f, 0.283001781f},
-std::array<float,2>{0.609279454f, 0.879146338f},
-std::array<float,2>{0.729262888f, 0.420920044f},
-std::array<float,2>{0.116927847f, 0.755646288f},
-std::array<float,2>{0.349705637f, 0.152897581f},
-std::array<float,2>{0.838312685f, 0.614885092f},
-std::array<float,2>{0.771353841f, 0.315879554f},
-std::array<float,2>{0.293014646f, 0.950542629f},
-std::array<float,2>{0.033818081f, 0.104826637f},
-std::array<float,2>{0.651243269f, 0.735981643f},
-std::array<float,2>{0.504710972f, 0.208590344f},
-std::array<float,2>{0.134066015f, 0.52677381f},
-std::array<float,2>{0.48148486f, 0.486195982f},
-std::array<float,2>{0.965771556f, 0.838467598f},
-std::array<float,2>{0.873617411f, 0.180362806f},
-std::array<float,2>{0.341295004f, 0.565586925f},
-std::array<float,2>{0.0887758285f, 0.40291518f},
-std::array<float,2>{0.700473845f, 0.78610146f},
-std::array<float,2>{0.576432526f, 0.265977353f},
-std::array<float,2>{0.228174537f, 0.923673809f},
-std::array<float,2>{0.37733072f, 0.0496657863f},
-std::array<float,2>{0.876776695f, 0.649106205f},
-std::array<float,2>{0.984040022f, 0.46511054f},
-std::array<float,2>{0.459774017f, 0.856365561f},
-std::array<float,2>{0.169050068f, 0.238785416f},
-std::array<float,2>{0.559668958f, 0.552586436f},
-std::array<float,2>{0.666845322f, 0.0883780867f},
-std::array<float,2>{0.00435886625f, 0.708454192f},
-std::array<float,2>{0.279898494f, 0.355534971f},
-std::array<float,2>{0.783596575f, 0.985523343f},
-std::array<float,2>{0.949342608f, 0.232980117f},
-std::array<float,2>{0.493318677f, 0.541258633f},
-std::array<float,2>{0.155584365f, 0.450334549f},
-std::array<float,2>{0.51997292f, 0.869926929f},
-std::array<float,2>{0.6400159f, 0.367405444f},
-std::array<float,2>{0.0592149906f, 0.976693988f},
-std::array<float,2>{0.301180899f, 0.0636439994f},
-std::array<float,2>{0.759330094f, 0.693044424f},
-std::array<float,2>{0.813013494f, 0.389414012f},
-std::array<float,2>{0.370474935f, 0.799490333f},
-std::array<float,2>{0.103415839f, 0.161064506f},
-std::array<float,2>{0.737621844f, 0.586016893f},
-std::array<float,2>{0.611304581f, 0.0407296494f},
-std::array<float,2>{0.202853248f, 0.625784695f},
-std::array<float,2>{0.424215257f, 0.263520092f},
-std::array<float,2>{0.934628844f, 0.912570477f},
-std::array<float,2>{0.799950838f, 0.113604255f},
-std::array<float,2>{0.260425299f, 0.720880508f},
-std::array<float,2>{0.0196776129f, 0.341271579f},
-std::array<float,2>{0.682862937f, 0.956216276f},
-std::array<float,2>{0.541724205f, 0.474199951f},
-std::array<float,2>{0.186220497f, 0.822194159f},
-std::array<float,2>{0.44452408f, 0.199766621f},
-std::array<float,2>{0.992626011f, 0.501169384f},
-std::array<float,2>{0.896512985f, 0.309164643f},
-std::array<float,2>{0.395176053f, 0.897133827f},
-std::array<float,2>{0.246838033f, 0.00543610333f},
-std::array<float,2>{0.59128958f, 0.670138299f},
-std::array<float,2>{0.715455651f, 0.129888982f},
-std::array<float,2>{0.0702341571f, 0.600202084f},
-std::array<float,2>{0.325879693f, 0.428557426f},
-std::array<float,2>{0.852747083f, 0.767750442f},
-std::array<float,2>{0.962227166f, 0.0386029184f},
-std::array<float,2>{0.47923699f, 0.633868217f},
-std::array<float,2>{0.138986915f, 0.254199535f},
-std::array<float,2>{0.500418246f, 0.919856608f},
-std::array<float,2>{0.655484378f, 0.380971521f},
-std::array<float,2>{0.038330026f, 0.806973636f},
-std::array<float,2>{0.289387226f, 0.168450564f},
-std::array<float,2>{0.769047141f, 0.578452468f},
-std::array<float,2>{0.84034127f, 0.366765171f},
-std::array<float,2>{0.34393841f, 0.973657727f},
-std::array<float,2>{0.111877576f, 0.0726062283f},
-std::array<float,2>{0.732138216f, 0.69558984f},
-std::array<float,2>{0.603762448f, 0.219331935f},
-std::array<float,2>{0.214875251f, 0.536558867f},
-std::array<float,2>{0.4197326f, 0.440808296f},
-std::array<float,2>{0.912296414f, 0.864089668f},
-std::array<float,2>{0.788258374f, 0.133880451f},
-std::array<float,2>{0.276940674f, 0.604389429f},
-std::array<float,2>{7.31648615e-05f, 0.436272025f},
-std::array<float,2>{0.669026852f, 0.77693361f},
-std::array<float,2>{0.55496949f, 0.29951781f},
-std::array<float,2>{0.16500926f, 0.898611903f},
-std::array<float,2>{0.453545094f, 0.00881086569f},
-std::array<float,2>{0.980166614f, 0.661043882f},
-std::array<float,2>{0.879791319f, 0.477262139f},
-std::array<float,2>{0.381518006f, 0.815319121f},
-std::array<float,2>{0.230995908f, 0.193484411f},
-std::array<float,2>{0.572231174f, 0.515448153f},
-std::array<float,2>{0.698450685f, 0.119399779f},
-std::array<float,2>{0.0922924802f, 0.731589854f},
-std::array<float,2>{0.33861658f, 0.328553498f},
-std::array<float,2>{0.869097769f, 0.963626266f},
-std::array<float,2>{0.932204068f, 0.215982765f},
-std::array<float,2>{0.426140487f, 0.522475123f},
-std::array<float,2>{0.196619883f, 0.495481938f},
-std::array<float,2>{0.616244614f, 0.8288849f},
-std::array<float,2>{0.740482271f, 0.327973008f},
-std::array<float,2>{0.106419086f, 0.938969672f},
-std::array<float,2>{0.37187019f, 0.0990023166f},
-std::array<float,2>{0.818056762f, 0.748232663f},
-std::array<float,2>{0.761766672f, 0.409609884f},
-std::array<float,2>{0.298567146f, 0.760235131f},
-std::array<float,2>{0.0555972047f, 0.143946886f},
-std::array<float,2>{0.635725379f, 0.623520076f},
-std::array<float,2>{0.518213093f, 0.0227463059f},
-std::array<float,2>{0.148890406f, 0.683815122f},
-std::array<float,2>{0.498395294f, 0.289082497f},
-std::array<float,2>{0.946813285f, 0.883147538f},
-std::array<float,2>{0.856866241f, 0.0827574581f},
-std::array<float,2>{0.322531313f, 0.713624239f},
-std::array<float,2>{0.0656831861f, 0.346582979f},
-std::array<float,2>{0.71172744f, 0.996902108f},
-std::array<float,2>{0.589066386f, 0.456986487f},
-std::array<float,2>{0.242912143f, 0.851375461f},
-std::array<float,2>{0.393407673f, 0.247341678f},
-std::array<float,2>{0.890866339f, 0.557379961f},
-std::array<float,2>{0.999850988f, 0.27382338f},
-std::array<float,2>{0.439579368f, 0.93153286f},
-std::array<float,2>{0.181813717f, 0.056843508f},
-std::array<float,2>{0.546071708f, 0.641185224f},
-std::array<float,2>{0.686660051f, 0.174704388f},
-std::array<float,2>{0.0168080963f, 0.574220836f},
-std::array<float,2>{0.263481259f, 0.396664321f},
-std::array<float,2>{0.800876617f, 0.794177115f},
-std::array<float,2>{0.899251401f, 0.107274003f},
-std::array<float,2>{0.398440987f, 0.739491165f},
-std::array<float,2>{0.235401556f, 0.317333758f},
-std::array<float,2>{0.580067456f, 0.945495248f},
-std::array<float,2>{0.705899537f, 0.491330832f},
-std::array<float,2>{0.0729667395f, 0.842977762f},
-std::array<float,2>{0.318588942f, 0.205255285f},
-std::array<float,2>{0.846067011f, 0.53119874f},
-std::array<float,2>{0.811275721f, 0.286209434f},
-std::array<float,2>{0.257771522f, 0.878729105f},
-std::array<float,2>{0.0287108421f, 0.0286348797f},
-std::array<float,2>{0.679243505f, 0.676079214f},
-std::array<float,2>{0.534663558f, 0.150814652f},
-std::array<float,2>{0.179679736f, 0.611068428f},
-std::array<float,2>{0.450824708f, 0.417764515f},
-std::array<float,2>{0.987259328f, 0.753360033f},
-std::array<float,2>{0.827229023f, 0.238172904f},
-std::array<float,2>{0.366941214f, 0.54972589f},
-std::array<float,2>{0.0966742784f, 0.461681843f},
-std::array<float,2>{0.743250132f, 0.855031788f},
-std::array<float,2>{0.619821608f, 0.353190899f},
-std::array<float,2>{0.19089976f, 0.988661289f},
-std::array<float,2>{0.435894608f, 0.0906976908f},
-std::array<float,2>{0.927832842f, 0.70325774f},
-std::array<float,2>{0.938096523f, 0.400136054f},
-std::array<float,2>{0.488903701f, 0.782019198f},
-std::array<float,2>{0.142804265f, 0.186344221f},
-std::array<float,2>{0.527380109f, 0.569143236f},
-std::array<float,2>{0.629193068f, 0.0509074368f},
-std::array<float,2>{0.0536498837f, 0.653617859f},
-std::array<float,2>{0.309932023f, 0.270614862f},
-std::array<float,2>{0.751834631f, 0.927236259f},
-std::array<float,2>{0.974733889f, 0.159521729f},
-std::array<float,2>{0.464594305f, 0.591394842f},
-std::array<float,2>{0.15922752f, 0.383138716f},
-std::array<float,2>{0.549998105f, 0.801005542f},
-std::array<float,2>{0.660346448f, 0.258450449f},
-std::array<float,2>{0.0128255952f, 0.908915997f},
-std::array<float,2>{0.270762235f, 0.045611959f},
-std::array<float,2>{0.793128192f, 0.629616737f},
-std::array<float,2>{0.864786685f, 0.446586698f},
-std::array<float,2>{0.33428061f, 0.872211337f},
-std::array<float,2>{0.0832607672f, 0.230006978f},
-std::array<float,2>{0.689865589f, 0.545766652f},
-std::array<float,2>{0.566748619f, 0.0678440332f},
-std::array<float,2>{0.22351037f, 0.689633548f},
-std::array<float,2>{0.390334219f, 0.374094009f},
-std::array<float,2>{0.884859145f, 0.983596623f},
-std::array<float,2>{0.775946558f, 0.0032108489f},
-std::array<float,2>{0.288384408f, 0.664751112f},
-std::array<float,2>{0.0463826321f, 0.305976868f},
-std::array<float,2>{0.646793365f, 0.891225636f},
-std::array<float,2>{0.509176493f, 0.425252706f},
-std::array<float,2>{0.127082735f, 0.772720098f},
-std::array<float,2>{0.475600392f, 0.127178431f},
-std::array<float,2>{0.953812659f, 0.597047091f},
-std::array<float,2>{0.918305159f, 0.339457303f},
-std::array<float,2>{0.409993887f, 0.95728904f},
-std::array<float,2>{0.204052165f, 0.109786108f},
-std::array<float,2>{0.599287748f, 0.725688219f},
-std::array<float,2>{0.726555884f, 0.19601801f},
-std::array<float,2>{0.122309208f, 0.50623095f},
-std::array<float,2>{0.359309882f, 0.471220881f},
-std::array<float,2>{0.830784798f, 0.827694893f},
-std::array<float,2>{0.970156848f, 0.0967540815f},
-std::array<float,2>{0.465777546f, 0.742626846f},
-std::array<float,2>{0.160844341f, 0.320318073f},
-std::array<float,2>{0.55110842f, 0.944888353f},
-std::array<float,2>{0.65705663f, 0.49835673f},
-std::array<float,2>{0.00802916195f, 0.832804441f},
-std::array<float,2>{0.267744213f, 0.212702572f},
-std::array<float,2>{0.790459871f, 0.519375682f},
-std::array<float,2>{0.861358047f, 0.295045584f},
-std::array<float,2>{0.32945025f, 0.888806939f},
-std::array<float,2>{0.0788410977f, 0.0175426845f},
-std::array<float,2>{0.695222974f, 0.682515442f},
-std::array<float,2>{0.562752843f, 0.144814998f},
-std::array<float,2>{0.222308964f, 0.619250357f},
-std::array<float,2>{0.382844508f, 0.411767632f},
-std::array<float,2>{0.889817536f, 0.763755739f},
-std::array<float,2>{0.778657734f, 0.242337033f},
-std::array<float,2>{0.281845301f, 0.561131656f},
-std::array<float,2>{0.0426646844f, 0.459466398f},
-std::array<float,2>{0.644165039f, 0.845817149f},
-std::array<float,2>{0.512166739f, 0.350843906f},
-std::array<float,2>{0.129266202f, 0.993005514f},
-std::array<float,2>{0.470502436f, 0.0796485096f},
-std::array<float,2>{0.960263491f, 0.715802431f},
-std::array<float,2>{0.915685177f, 0.390893549f},
-std::array<float,2>{0.411238819f, 0.792723775f},
-std::array<float,2>{0.210247248f, 0.176418826f},
-std::array<float,2>{0.5939852f, 0.571917474f},
-std::array<float,2>{0.721549392f, 0.0614702217f},
-std::array<float,2>{0.120382071f, 0.64837116f},
-std::array<float,2>{0.351968288f, 0.279534101f},
-std::array<float,2>{0.835014582f, 0.9356094f},
-std::array<float,2>{0.905228853f, 0.166387722f},
-std::array<float,2>{0.403108716f, 0.584133804f},
-std::array<float,2>{0.240924209f, 0.377515286f},
-std::array<float,2>{0.583841562f, 0.81112963f},
-std::array<float,2>{0.709672928f, 0.250239521f},
-std::array<float,2>{0.0769088939f, 0.9142223f},
-std::array<float,2>{0.313955396f, 0.0346576348f},
-std::array<float,2>{0.848869443f, 0.64046061f},
-std::array<float,2>{0.805824459f, 0.444280982f},
-std::array<float,2>{0.253752083f, 0.859793365f},
-std::array<float,2>{0.0262627155f, 0.223335534f},
-std::array<float,2>{0.672916889f, 0.531441331f},
-std::array<float,2>{0.53665936f, 0.0762257725f},
-std::array<float,2>{0.174582675f, 0.699839115f},
-std::array<float,2>{0.44594112f, 0.361542195f},
-std::array<float,2>{0.988839209f, 0.97077173f},
-std::array<float,2>{0.824004054f, 0.0131866531f},
-std::array<float,2>{0.360086501f, 0.656901062f},
-std::array<float,2>{0.0988957286f, 0.301390916f},
-std::array<float,2>{0.747261524f, 0.903983414f},
-std::array<float,2>{0.624442279f, 0.431636304f},
-std::array<float,2>{0.191865087f, 0.777635217f},
-std::array<float,2>{0.433183461f, 0.138167351f},
-std::array<float,2>{0.925612926f, 0.609329343f},
-std::array<float,2>{0.941922188f, 0.333629102f},
-std::array<float,2>{0.486656547f, 0.965340316f},
-std::array<float,2>{0.147702977f, 0.122210272f},
-std::array<float,2>{0.526426256f, 0.729312956f},
-std::array<float,2>{0.627491117f, 0.190234512f},
-std::array<float,2>{0.0473284684f, 0.510818124f},
-std::array<float,2>{0.306806147f, 0.483242571f},
-std::array<float,2>{0.75468576f, 0.819631457f},
-std::array<float,2>{0.933885753f, 0.0420909226f},
-std::array<float,2>{0.42484358f, 0.627737761f},
-std::array<float,2>{0.20149003f, 0.264770091f},
-std::array<float,2>{0.60976845f, 0.911291361f},
-std::array<float,2>{0.737138331f, 0.388561308f},
-std::array<float,2>{0.101872489f, 0.798572659f},
-std::array<float,2>{0.369412512f, 0.16310209f},
-std::array<float,2>{0.814376354f, 0.589164853f},
-std::array<float,2>{0.757993579f, 0.370174199f},
-std::array<float,2>{0.301801145f, 0.978904843f},
-std::array<float,2>{0.0600063428f, 0.0655660704f},
-std::array<float,2>{0.63924402f, 0.694414139f},
-std::array<float,2>{0.521254599f, 0.231344357f},
-std::array<float,2>{0.154356778f, 0.539268494f},
-std::array<float,2>{0.492530018f, 0.452018559f},
-std::array<float,2>{0.95024693f, 0.867774308f},
-std::array<float,2>{0.852302909f, 0.132588044f},
-std::array<float,2>{0.324974954f, 0.598901153f},
-std::array<float,2>{0.0685812235f, 0.426393986f},
-std::array<float,2>{0.716576993f, 0.76675719f},
-std::array<float,2>{0.590222418f, 0.310966879f},
-std::array<float,2>{0.247130662f, 0.895839393f},
-std::array<float,2>{0.396366447f, 0.0077049667f},
-std::array<float,2>{0.897540569f, 0.669299126f},
-std::array<float,2>{0.993637502f, 0.475275248f},
-std::array<float,2>{0.444134772f, 0.822752714f},
-std::array<float,2>{0.187066317f, 0.202854753f},
-std::array<float,2>{0.542227507f, 0.503444493f},
-std::array<float,2>{0.681840956f, 0.116340443f},
-std::array<float,2>{0.0209047534f, 0.720142484f},
-std::array<float,2>{0.261618674f, 0.342794061f},
-std::array<float,2>{0.799410343f, 0.954827964f},
-std::array<float,2>{0.966650426f, 0.209944189f},
-std::array<float,2>{0.481200099f, 0.523622215f},
-std::array<float,2>{0.133664787f, 0.487679064f},
-std::array<float,2>{0.505591154f, 0.836848974f},
-std::array<float,2>{0.651939869f, 0.312518537f},
-std::array<float,2>{0.0349822752f, 0.951469243f},
-std::array<float,2>{0.294650882f, 0.102571495f},
-std::array<float,2>{0.769907892f, 0.736587524f},
-std::array<float,2>{0.839630842f, 0.41985324f},
-std::array<float,2>{0.350876451f, 0.756712496f},
-std::array<float,2>{0.115449198f, 0.155369267f},
-std::array<float,2>{0.730258524f, 0.616120279f},
-std::array<float,2>{0.607431769f, 0.0236312095f},
-std::array<float,2>{0.214174688f, 0.673487306f},
-std::array<float,2>{0.416345388f, 0.285140634f},
-std::array<float,2>{0.908057809f, 0.881959796f},
-std::array<float,2>{0.78437382f, 0.0859954804f},
-std::array<float,2>{0.28075093f, 0.710536063f},
-std::array<float,2>{0.00573429186f, 0.358742177f},
-std::array<float,2>{0.66792798f, 0.986451089f},
-std::array<float,2>{0.559489131f, 0.468366623f},
-std::array<float,2>{0.168531552f, 0.858251452f},
-std::array<float,2>{0.460290492f, 0.242123932f},
-std::array<float,2>{0.983347893f, 0.553505242f},
-std::array<float,2>{0.875610411f, 0.267891228f},
-std::array<float,2>{0.378492504f, 0.92537272f},
-std::array<float,2>{0.227519363f, 0.0469799861f},
-std::array<float,2>{0.577467978f, 0.652019799f},
-std::array<float,2>{0.699748755f, 0.183257774f},
-std::array<float,2>{0.0893918052f, 0.563442469f},
-std::array<float,2>{0.340061814f, 0.405587345f},
-std::array<float,2>{0.874809802f, 0.788044274f},
-std::array<float,2>{0.945424199f, 0.0198521037f},
-std::array<float,2>{0.499030232f, 0.687316537f},
-std::array<float,2>{0.149996072f, 0.292767286f},
-std::array<float,2>{0.519304633f, 0.885088861f},
-std::array<float,2>{0.636233091f, 0.406674564f},
-std::array<float,2>{0.0564005189f, 0.759195447f},
-std::array<float,2>{0.297686607f, 0.14240624f},
-std::array<float,2>{0.763227642f, 0.621111095f},
-std::array<float,2>{0.817181408f, 0.326119423f},
-std::array<float,2>{0.372297883f, 0.941021204f},
-std::array<float,2>{0.107265815f, 0.100465387f},
-std::array<float,2>{0.741591036f, 0.746275902f},
-std::array<float,2>{0.616054475f, 0.218272284f},
-std::array<float,2>{0.196154743f, 0.521253467f},
-std::array<float,2>{0.42761305f, 0.494089425f},
-std::array<float,2>{0.933271646f, 0.831302524f},
-std::array<float,2>{0.801916063f, 0.173209414f},
-std::array<float,2>{0.261758387f, 0.577542007f},
-std::array<float,2>{0.016122086f, 0.3959876f},
-std::array<float,2>{0.685787618f, 0.795651615f},
-std::array<float,2>{0.545870066f, 0.276755869f},
-std::array<float,2>{0.183192119f, 0.931816876f},
-std::array<float,2>{0.441297442f, 0.0554722473f},
-std::array<float,2>{0.998638809f, 0.643007278f},
-std::array<float,2>{0.892085016f, 0.454363585f},
-std::array<float,2>{0.393695951f, 0.847964764f},
-std::array<float,2>{0.244119868f, 0.248990595f},
-std::array<float,2>{0.587903142f, 0.556455016f},
-std::array<float,2>{0.712189794f, 0.0852630809f},
-std::array<float,2>{0.0651150048f, 0.712880909f},
-std::array<float,2>{0.324152648f, 0.344534963f},
-std::array<float,2>{0.856208146f, 0.999286413f},
-std::array<float,2>{0.913752973f, 0.222452298f},
-std::array<float,2>{0.418505222f, 0.538929939f},
-std::array<float,2>{0.216084421f, 0.438433558f},
-std::array<float,2>{0.60454309f, 0.866440892f},
-std::array<float,2>{0.731293261f, 0.36381501f},
-std::array<float,2>{0.112741955f, 0.974772751f},
-std::array<float,2>{0.344935179f, 0.070503749f},
-std::array<float,2>{0.841488481f, 0.698916376f},
-std::array<float,2>{0.767873526f, 0.379409194f},
-std::array<float,2>{0.290293902f, 0.805273473f},
-std::array<float,2>{0.0377093181f, 0.170614108f},
-std::array<float,2>{0.655077875f, 0.581493556f},
-std::array<float,2>{0.501015007f, 0.0353813693f},
-std::array<float,2>{0.139980331f, 0.635800838f},
-std::array<float,2>{0.479659796f, 0.257713705f},
-std::array<float,2>{0.961239696f, 0.920361876f},
-std::array<float,2>{0.867957056f, 0.11843086f},
-std::array<float,2>{0.338909f, 0.732711494f},
-std::array<float,2>{0.0934959054f, 0.33147645f},
-std::array<float,2>{0.698019445f, 0.962739885f},
-std::array<float,2>{0.570367098f, 0.478569657f},
-std::array<float,2>{0.231984138f, 0.813273668f},
-std::array<float,2>{0.382764399f, 0.192206085f},
-std::array<float,2>{0.880786896f, 0.512972772f},
-std::array<float,2>{0.979320407f, 0.297177672f},
-std::array<float,2>{0.455006629f, 0.901334703f},
-std::array<float,2>{0.165510133f, 0.0116824321f},
-std::array<float,2>{0.555871844f, 0.662598133f},
-std::array<float,2>{0.667971373f, 0.134874508f},
-std::array<float,2>{0.00149971794f, 0.602784693f},
-std::array<float,2>{0.27615273f, 0.435111165f},
-std::array<float,2>{0.788072526f, 0.774314821f},
-std::array<float,2>{0.886254191f, 0.0690047294f},
-std::array<float,2>{0.389313936f, 0.688133895f},
-std::array<float,2>{0.223767728f, 0.371681154f},
-std::array<float,2>{0.567894816f, 0.980553985f},
-std::array<float,2>{0.690888286f, 0.448763549f},
-std::array<float,2>{0.0826941282f, 0.87408036f},
-std::array<float,2>{0.335651189f, 0.226688266f},
-std::array<float,2>{0.863670766f, 0.543730319f},
-std::array<float,2>{0.794219613f, 0.261582047f},
-std::array<float,2>{0.270440847f, 0.907038331f},
-std::array<float,2>{0.012305811f, 0.0434443615f},
-std::array<float,2>{0.662070811f, 0.632654965f},
-std::array<float,2>{0.549293518f, 0.157773748f},
-std::array<float,2>{0.158609584f, 0.59312433f},
-std::array<float,2>{0.463115573f, 0.385125905f},
-std::array<float,2>{0.975803018f, 0.804211557f},
-std::array<float,2>{0.831536651f, 0.197849706f},
-std::array<float,2>{0.358103454f, 0.504834831f},
-std::array<float,2>{0.121191092f, 0.470327377f},
-std::array<float,2>{0.724723995f, 0.826088548f},
-std::array<float,2>{0.598178506f, 0.336909205f},
-std::array<float,2>{0.204375014f, 0.959607661f},
-std::array<float,2>{0.40898335f, 0.111408673f},
-std::array<float,2>{0.919886112f, 0.723995984f},
-std::array<float,2>{0.954236925f, 0.422577977f},
-std::array<float,2>{0.475301176f, 0.770526946f},
-std::array<float,2>{0.128262639f, 0.125883371f},
-std::array<float,2>{0.508753061f, 0.595617592f},
-std::array<float,2>{0.64751488f, 0.00149043964f},
-std::array<float,2>{0.0449845269f, 0.666171432f},
-std::array<float,2>{0.287861824f, 0.308095515f},
-std::array<float,2>{0.776733756f, 0.89437294f},
-std::array<float,2>{0.987548113f, 0.149397999f},
-std::array<float,2>{0.450111002f, 0.611690044f},
-std::array<float,2>{0.178455099f, 0.415526658f},
-std::array<float,2>{0.533365011f, 0.750935376f},
-std::array<float,2>{0.678132594f, 0.287847698f},
-std::array<float,2>{0.0276477449f, 0.876618505f},
-std::array<float,2>{0.256373435f, 0.0310779214f},
-std::array<float,2>{0.812254786f, 0.678303242f},
-std::array<float,2>{0.846918523f, 0.489880025f},
-std::array<float,2>{0.319507778f, 0.84103471f},
-std::array<float,2>{0.0741564855f, 0.204286754f},
-std::array<float,2>{0.706786752f, 0.528734505f},
-std::array<float,2>{0.578557491f, 0.108413972f},
-std::array<float,2>{0.23480463f, 0.742154896f},
-std::array<float,2>{0.400010437f, 0.318630904f},
-std::array<float,2>{0.900235653f, 0.947926342f},
-std::array<float,2>{0.7509076f, 0.052737534f},
-std::array<float,2>{0.30954963f, 0.654689491f},
-std::array<float,2>{0.0544243865f, 0.272124231f},
-std::array<float,2>{0.630624115f, 0.9284361f},
-std::array<float,2>{0.528640807f, 0.402265519f},
-std::array<float,2>{0.143640637f, 0.783525348f},
-std::array<float,2>{0.490160108f, 0.183846161f},
-std::array<float,2>{0.939392269f, 0.567780554f},
-std::array<float,2>{0.929037273f, 0.354417145f},
-std::array<float,2>{0.436798871f, 0.990236461f},
-std::array<float,2>{0.189973712f, 0.0933024213f},
-std::array<float,2>{0.620345592f, 0.706990421f},
-std::array<float,2>{0.742292285f, 0.235105097f},
-std::array<float,2>{0.0975438431f, 0.548316658f},
-std::array<float,2>{0.365478843f, 0.464686215f},
-std::array<float,2>{0.827103555f, 0.852114379f},
-std::array<float,2>{0.957939148f, 0.0815296248f},
-std::array<float,2>{0.471669227f, 0.717926979f},
-std::array<float,2>{0.131173968f, 0.348267227f},
-std::array<float,2>{0.514114559f, 0.994461298f},
-std::array<float,2>{0.642449439f, 0.458316356f},
-std::array<float,2>{0.03981461f, 0.845413387f},
-std::array<float,2>{0.284164608f, 0.245740518f},
-std::array<float,2>{0.780691504f, 0.55878824f},
-std::array<float,2>{0.833501756f, 0.278437674f},
-std::array<float,2>{0.353832781f, 0.934277475f},
-std::array<float,2>{0.1183872f, 0.059626963f},
-std::array<float,2>{0.718891501f, 0.646348238f},
-std::array<float,2>{0.597558081f, 0.179376528f},
-std::array<float,2>{0.207759872f, 0.57251662f},
-std::array<float,2>{0.413632482f, 0.394281805f},
-std::array<float,2>{0.916975021f, 0.790723085f},
-std::array<float,2>{0.791762173f, 0.214165032f},
-std::array<float,2>{0.267190576f, 0.516058743f},
-std::array<float,2>{0.0105692744f, 0.497476429f},
-std::array<float,2>{0.658724606f, 0.834613681f},
-std::array<float,2>{0.552942157f, 0.323398829f},
-std::array<float,2>{0.163412899f, 0.942375898f},
-std::array<float,2>{0.468311757f, 0.0942816511f},
-std::array<float,2>{0.972087979f, 0.745317996f},
-std::array<float,2>{0.886882007f, 0.413347006f},
-std::array<float,2>{0.386531115f, 0.762390494f},
-std::array<float,2>{0.21976383f, 0.146651134f},
-std::array<float,2>{0.565427125f, 0.618475616f},
-std::array<float,2>{0.691748083f, 0.019015003f},
-std::array<float,2>{0.0813497305f, 0.680354953f},
-std::array<float,2>{0.330915213f, 0.293527752f},
-std::array<float,2>{0.860177994f, 0.888304591f},
-std::array<float,2>{0.92217797f, 0.139007509f},
-std::array<float,2>{0.429851741f, 0.607226431f},
-std::array<float,2>{0.195202976f, 0.432779342f},
-std::array<float,2>{0.622569382f, 0.780085325f},
-std::array<float,2>{0.748409152f, 0.303836375f},
-std::array<float,2>{0.100897275f, 0.905722678f},
-std::array<float,2>{0.361475527f, 0.0142958472f},
-std::array<float,2>{0.821765006f, 0.659247339f},
-std::array<float,2>{0.755886555f, 0.481266528f},
-std::array<float,2>{0.305793852f, 0.816446424f},
-std::array<float,2>{0.049395781f, 0.189353094f},
-std::array<float,2>{0.625635564f, 0.509393513f},
-std::array<float,2>{0.523940921f, 0.124835134f},
-std::array<float,2>{0.146325439f, 0.72676158f},
-std::array<float,2>{0.484565437f, 0.334106922f},
-std::array<float,2>{0.943799675f, 0.968518138f},
-std::array<float,2>{0.850327313f, 0.032255426f},
-std::array<float,2>{0.315554827f, 0.637654483f},
-std::array<float,2>{0.0744916573f, 0.252633542f},
-std::array<float,2>{0.707865655f, 0.917220473f},
-std::array<float,2>{0.584425509f, 0.375909328f},
-std::array<float,2>{0.239893064f, 0.809286296f},
-std::array<float,2>{0.404765695f, 0.164480239f},
-std::array<float,2>{0.903672099f, 0.582138836f},
-std::array<float,2>{0.991581023f, 0.3594459f},
-std::array<float,2>{0.44798404f, 0.968900502f},
-std::array<float,2>{0.171890646f, 0.075122036f},
-std::array<float,2>{0.538853109f, 0.702023923f},
-std::array<float,2>{0.674639165f, 0.2260544f},
-std::array<float,2>{0.0248028077f, 0.534416199f},
-std::array<float,2>{0.250014484f, 0.44266659f},
-std::array<float,2>{0.808430254f, 0.861928403f},
-std::array<float,2>{0.895213187f, 0.00403801305f},
-std::array<float,2>{0.396636873f, 0.67151618f},
-std::array<float,2>{0.24858214f, 0.31012848f},
-std::array<float,2>{0.592898965f, 0.897734344f},
-std::array<float,2>{0.718157411f, 0.429686606f},
-std::array<float,2>{0.0664980337f, 0.76870507f},
-std::array<float,2>{0.326599687f, 0.12943849f},
-std::array<float,2>{0.854379475f, 0.600693464f},
-std::array<float,2>{0.797900975f, 0.340649366f},
-std::array<float,2>{0.259717673f, 0.955631554f},
-std::array<float,2>{0.022891527f, 0.115036614f},
-std::array<float,2>{0.681469679f, 0.722339213f},
-std::array<float,2>{0.53975457f, 0.200799927f},
-std::array<float,2>{0.184886381f, 0.500861406f},
-std::array<float,2>{0.44327563f, 0.473419636f},
-std::array<float,2>{0.995967567f, 0.820443869f},
-std::array<float,2>{0.81516093f, 0.1611837f},
-std::array<float,2>{0.36744529f, 0.587486386f},
-std::array<float,2>{0.1051732f, 0.38988623f},
-std::array<float,2>{0.736287653f, 0.800138652f},
-std::array<float,2>{0.612864733f, 0.26248306f},
-std::array<float,2>{0.199466273f, 0.91309464f},
-std::array<float,2>{0.42285952f, 0.0396021195f},
-std::array<float,2>{0.936424911f, 0.626739144f},
-std::array<float,2>{0.951475382f, 0.44924891f},
-std::array<float,2>{0.494772375f, 0.8710078f},
-std::array<float,2>{0.15315789f, 0.234187245f},
-std::array<float,2>{0.522644699f, 0.5423311f},
-std::array<float,2>{0.636823893f, 0.0631687343f},
-std::array<float,2>{0.0613672659f, 0.692258477f},
-std::array<float,2>{0.3042472f, 0.368357837f},
-std::array<float,2>{0.76005137f, 0.977782309f},
-std::array<float,2>{0.980971932f, 0.239398211f},
-std::array<float,2>{0.458177835f, 0.551090181f},
-std::array<float,2>{0.17026487f, 0.466733336f},
-std::array<float,2>{0.562195539f, 0.856724083f},
-std::array<float,2>{0.665751278f, 0.357009798f},
-std::array<float,2>{0.0071925926f, 0.985262454f},
-std::array<float,2>{0.278118134f, 0.0891145691f},
-std::array<float,2>{0.781727016f, 0.707885385f},
-std::array<float,2>{0.871467173f, 0.404250354f},
-std::array<float,2>{0.342895091f, 0.787007987f},
-std::array<float,2>{0.0874712616f, 0.181137428f},
-std::array<float,2>{0.701849639f, 0.564746022f},
-std::array<float,2>{0.574681699f, 0.0498496145f},
-std::array<float,2>{0.229595467f, 0.649505675f},
-std::array<float,2>{0.37518996f, 0.267297834f},
-std::array<float,2>{0.877795339f, 0.922381461f},
-std::array<float,2>{0.77274859f, 0.103675365f},
-std::array<float,2>{0.294927031f, 0.734509706f},
-std::array<float,2>{0.0313139819f, 0.315400898f},
-std::array<float,2>{0.649170816f, 0.949605823f},
-std::array<float,2>{0.507140934f, 0.484415412f},
-std::array<float,2>{0.13573648f, 0.838873208f},
-std::array<float,2>{0.484302282f, 0.207720369f},
-std::array<float,2>{0.967488408f, 0.52569586f},
-std::array<float,2>{0.908311069f, 0.281310707f},
-std::array<float,2>{0.414857447f, 0.88077265f},
-std::array<float,2>{0.212736204f, 0.025598349f},
-std::array<float,2>{0.606526971f, 0.67490083f},
-std::array<float,2>{0.72805059f, 0.153327599f},
-std::array<float,2>{0.114814498f, 0.613564253f},
-std::array<float,2>{0.349063456f, 0.420813322f},
-std::array<float,2>{0.837730646f, 0.754051387f},
-std::array<float,2>{0.997883737f, 0.0579163507f},
-std::array<float,2>{0.439222306f, 0.642092228f},
-std::array<float,2>{0.181341872f, 0.27538833f},
-std::array<float,2>{0.544463694f, 0.929934204f},
-std::array<float,2>{0.684633374f, 0.397568107f},
-std::array<float,2>{0.0181661472f, 0.793766081f},
-std::array<float,2>{0.265014887f, 0.175010473f},
-std::array<float,2>{0.804213285f, 0.575291812f},
-std::array<float,2>{0.858509779f, 0.346697152f},
-std::array<float,2>{0.320899099f, 0.997317731f},
-std::array<float,2>{0.0634979308f, 0.0830973387f},
-std::array<float,2>{0.714080155f, 0.71447736f},
-std::array<float,2>{0.5860129f, 0.24705486f},
-std::array<float,2>{0.245949879f, 0.558442891f},
-std::array<float,2>{0.39082402f, 0.455205888f},
-std::array<float,2>{0.893696666f, 0.850225329f},
-std::array<float,2>{0.765507877f, 0.142818749f},
-std::array<float,2>{0.3005189f, 0.624977648f},
-std::array<float,2>{0.0573530421f, 0.408650339f},
-std::array<float,2>{0.633369386f, 0.761054575f},
-std::array<float,2>{0.51670444f, 0.290389538f},
-std::array<float,2>{0.151130199f, 0.884418488f},
-std::array<float,2>{0.49652642f, 0.021549318f},
-std::array<float,2>{0.949146926f, 0.685314119f},
-std::array<float,2>{0.931362033f, 0.494386911f},
-std::array<float,2>{0.428495616f, 0.829442441f},
-std::array<float,2>{0.199133173f, 0.214869186f},
-std::array<float,2>{0.614996552f, 0.522100389f},
-std::array<float,2>{0.739642143f, 0.0984054506f},
-std::array<float,2>{0.108777203f, 0.749776542f},
-std::array<float,2>{0.37319681f, 0.327133656f},
-std::array<float,2>{0.819750547f, 0.937952936f},
-std::array<float,2>{0.881764114f, 0.194657758f},
-std::array<float,2>{0.379959971f, 0.513822198f},
-std::array<float,2>{0.233359948f, 0.477596849f},
-std::array<float,2>{0.574174047f, 0.815487325f},
-std::array<float,2>{0.696762919f, 0.329419196f},
-std::array<float,2>{0.0899110138f, 0.964703679f},
-std::array<float,2>{0.336212784f, 0.120649844f},
-std::array<float,2>{0.869826019f, 0.730907321f},
-std::array<float,2>{0.785832524f, 0.436894149f},
-std::array<float,2>{0.274962246f, 0.77553606f},
-std::array<float,2>{0.00206987583f, 0.132985756f},
-std::array<float,2>{0.671868265f, 0.605000496f},
-std::array<float,2>{0.55753392f, 0.00873682275f},
-std::array<float,2>{0.166714221f, 0.661406577f},
-std::array<float,2>{0.455912501f, 0.300293207f},
-std::array<float,2>{0.976684988f, 0.900276482f},
-std::array<float,2>{0.842246771f, 0.0735042691f},
-std::array<float,2>{0.347157001f, 0.696693003f},
-std::array<float,2>{0.109557427f, 0.365449041f},
-std::array<float,2>{0.73299706f, 0.973535538f},
-std::array<float,2>{0.602594554f, 0.43949157f},
-std::array<float,2>{0.217271611f, 0.86485666f},
-std::array<float,2>{0.421229273f, 0.220677063f},
-std::array<float,2>{0.911875129f, 0.535781264f},
-std::array<float,2>{0.964004278f, 0.254952043f},
-std::array<float,2>{0.47769472f, 0.918067157f},
-std::array<float,2>{0.138551131f, 0.0372670889f},
-std::array<float,2>{0.503343761f, 0.633554637f},
-std::array<float,2>{0.653231621f, 0.169299081f},
-std::array<float,2>{0.0368027166f, 0.579989552f},
-std::array<float,2>{0.292367607f, 0.382567704f},
-std::array<float,2>{0.76566112f, 0.80803448f},
-std::array<float,2>{0.921219289f, 0.111282013f},
-std::array<float,2>{0.4079853f, 0.725282252f},
-std::array<float,2>{0.206844404f, 0.338467717f},
-std::array<float,2>{0.600499272f, 0.95875603f},
-std::array<float,2>{0.724224329f, 0.472039014f},
-std::array<float,2>{0.123772211f, 0.826821208f},
-std::array<float,2>{0.356248558f, 0.196658447f},
-std::array<float,2>{0.82867676f, 0.507653415f},
-std::array<float,2>{0.774909556f, 0.305131644f},
-std::array<float,2>{0.28684929f, 0.891832292f},
-std::array<float,2>{0.04362211f, 0.00209601503f},
-std::array<float,2>{0.644981563f, 0.665905297f},
-std::array<float,2>{0.509828031f, 0.128018096f},
-std::array<float,2>{0.125288874f, 0.59632045f},
-std::array<float,2>{0.472679585f, 0.42404601f},
-std::array<float,2>{0.956410825f, 0.772162616f},
-std::array<float,2>{0.865527511f, 0.229359135f},
-std::array<float,2>{0.333465964f, 0.546367407f},
-std::array<float,2>{0.0857944191f, 0.445822388f},
-std::array<float,2>{0.687834918f, 0.871550322f},
-std::array<float,2>{0.570108593f, 0.373232514f},
-std::array<float,2>{0.226490393f, 0.982924283f},
-std::array<float,2>{0.387808412f, 0.0665384531f},
-std::array<float,2>{0.883680284f, 0.69135052f},
-std::array<float,2>{0.974293649f, 0.384712428f},
-std::array<float,2>{0.462491393f, 0.801819503f},
-std::array<float,2>{0.157574773f, 0.158865228f},
-std::array<float,2>{0.547930002f, 0.590448558f},
-std::array<float,2>{0.663905799f, 0.0461244732f},
-std::array<float,2>{0.0150831603f, 0.630523801f},
-std::array<float,2>{0.273119241f, 0.259169221f},
-std::array<float,2>{0.796126485f, 0.909488976f},
-std::array<float,2>{0.940623581f, 0.187479869f},
-std::array<float,2>{0.49094063f, 0.570220232f},
-std::array<float,2>{0.14092876f, 0.398765802f},
-std::array<float,2>{0.530494452f, 0.782724798f},
-std::array<float,2>{0.63215673f, 0.270403028f},
-std::array<float,2>{0.0513659604f, 0.926416576f},
-std::array<float,2>{0.311350107f, 0.0523923077f},
-std::array<float,2>{0.753584981f, 0.652614415f},
-std::array<float,2>{0.825898051f, 0.462474048f},
-std::array<float,2>{0.364655197f, 0.853661001f},
-std::array<float,2>{0.095323585f, 0.237185612f},
-std::array<float,2>{0.744924009f, 0.550226033f},
-std::array<float,2>{0.618001759f, 0.0915552899f},
-std::array<float,2>{0.18826656f, 0.70473361f},
-std::array<float,2>{0.43422842f, 0.352051586f},
-std::array<float,2>{0.926513851f, 0.989766598f},
-std::array<float,2>{0.808828413f, 0.0275384616f},
-std::array<float,2>{0.254191816f, 0.677515149f},
-std::array<float,2>{0.0308455806f, 0.286074609f},
-std::array<float,2>{0.676735401f, 0.877411067f},
-std::array<float,2>{0.532277822f, 0.416125536f},
-std::array<float,2>{0.176948518f, 0.752904236f},
-std::array<float,2>{0.45124495f, 0.152143642f},
-std::array<float,2>{0.986248851f, 0.610156655f},
-std::array<float,2>{0.901299357f, 0.317815393f},
-std::array<float,2>{0.401997983f, 0.947221577f},
-std::array<float,2>{0.238082543f, 0.106434725f},
-std::array<float,2>{0.580708265f, 0.738633335f},
-std::array<float,2>{0.703551412f, 0.206243128f},
-std::array<float,2>{0.070953235f, 0.529950202f},
-std::array<float,2>{0.31827724f, 0.490361989f},
-std::array<float,2>{0.844530404f, 0.842689455f},
-std::array<float,2>{0.967105448f, 0.103511453f},
-std::array<float,2>{0.483447313f, 0.737076581f},
-std::array<float,2>{0.134978086f, 0.313416451f},
-std::array<float,2>{0.507519841f, 0.952128708f},
-std::array<float,2>{0.648751259f, 0.488170594f},
-std::array<float,2>{0.0321137235f, 0.836309493f},
-std::array<float,2>{0.295654774f, 0.209020689f},
-std::array<float,2>{0.773074627f, 0.523929894f},
-std::array<float,2>{0.837011635f, 0.284554303f},
-std::array<float,2>{0.349389076f, 0.882466376f},
-std::array<float,2>{0.114411741f, 0.0241096504f},
-std::array<float,2>{0.727975309f, 0.673150063f},
-std::array<float,2>{0.607307911f, 0.156213507f},
-std::array<float,2>{0.212054744f, 0.615289152f},
-std::array<float,2>{0.414459258f, 0.419160277f},
-std::array<float,2>{0.908915877f, 0.755977571f},
-std::array<float,2>{0.782189071f, 0.241291508f},
-std::array<float,2>{0.277605236f, 0.553166211f},
-std::array<float,2>{0.00775166322f, 0.467903942f},
-std::array<float,2>{0.665220678f, 0.857592702f},
-std::array<float,2>{0.561550796f, 0.359268576f},
-std::array<float,2>{0.170524016f, 0.986975312f},
-std::array<float,2>{0.458937764f, 0.0868359655f},
-std::array<float,2>{0.980569303f, 0.710162878f},
-std::array<float,2>{0.877066255f, 0.405764818f},
-std::array<float,2>{0.37589556f, 0.787485123f},
-std::array<float,2>{0.230268478f, 0.183080405f},
-std::array<float,2>{0.574862599f, 0.562635899f},
-std::array<float,2>{0.701237261f, 0.0475770012f},
-std::array<float,2>{0.0872086659f, 0.651812732f},
-std::array<float,2>{0.343269646f, 0.268080115f},
-std::array<float,2>{0.871831417f, 0.925231576f},
-std::array<float,2>{0.935913801f, 0.163611501f},
-std::array<float,2>{0.423386365f, 0.589463174f},
-std::array<float,2>{0.2000622f, 0.388156295f},
-std::array<float,2>{0.612592399f, 0.797936976f},
-std::array<float,2>{0.735742629f, 0.265137285f},
-std::array<float,2>{0.10495054f, 0.911763906f},
-std::array<float,2>{0.367712319f, 0.0425624289f},
-std::array<float,2>{0.814929187f, 0.627298117f},
-std::array<float,2>{0.760268986f, 0.451389164f},
-std::array<float,2>{0.303972661f, 0.867307961f},
-std::array<float,2>{0.0605656952f, 0.230575487f},
-std::array<float,2>{0.637616813f, 0.539904892f},
-std::array<float,2>{0.523345709f, 0.0663703308f},
-std::array<float,2>{0.152789682f, 0.695214987f},
-std::array<float,2>{0.494590104f, 0.370966494f},
-std::array<float,2>{0.952116966f, 0.979319513f},
-std::array<float,2>{0.853694439f, 0.00694561284f},
-std::array<float,2>{0.326885819f, 0.669760466f},
-std::array<float,2>{0.0672912374f, 0.311070651f},
-std::array<float,2>{0.718322277f, 0.896373868f},
-std::array<float,2>{0.59358871f, 0.426073164f},
-std::array<float,2>{0.248389557f, 0.767121971f},
-std::array<float,2>{0.397133887f, 0.13198328f},
-std::array<float,2>{0.894932568f, 0.599512041f},
-std::array<float,2>{0.995254636f, 0.343548685f},
-std::array<float,2>{0.442628771f, 0.95441854f},
-std::array<float,2>{0.185130954f, 0.117164202f},
-std::array<float,2>{0.539455235f, 0.7205863f},
-std::array<float,2>{0.680705607f, 0.202486679f},
-std::array<float,2>{0.0231502913f, 0.503255129f},
-std::array<float,2>{0.259263545f, 0.474789262f},
-std::array<float,2>{0.798474133f, 0.822915375f},
-std::array<float,2>{0.904094517f, 0.0351491347f},
-std::array<float,2>{0.40513587f, 0.639768541f},
-std::array<float,2>{0.239692539f, 0.250562519f},
-std::array<float,2>{0.584835172f, 0.914576471f},
-std::array<float,2>{0.70732981f, 0.377127647f},
-std::array<float,2>{0.0750135332f, 0.810578167f},
-std::array<float,2>{0.316223234f, 0.166755155f},
-std::array<float,2>{0.849928558f, 0.584833086f},
-std::array<float,2>{0.807767212f, 0.362085015f},
-std::array<float,2>{0.250930548f, 0.971377254f},
-std::array<float,2>{0.0253747944f, 0.0771102682f},
-std::array<float,2>{0.674010932f, 0.699683726f},
-std::array<float,2>{0.538446128f, 0.222796768f},
-std::array<float,2>{0.172594592f, 0.531791151f},
-std::array<float,2>{0.447458386f, 0.443383604f},
-std::array<float,2>{0.992075741f, 0.860116124f},
-std::array<float,2>{0.822013199f, 0.138223559f},
-std::array<float,2>{0.362253696f, 0.608414352f},
-std::array<float,2>{0.101316616f, 0.43077442f},
-std::array<float,2>{0.74869293f, 0.777984023f},
-std::array<float,2>{0.622396827f, 0.300904006f},
-std::array<float,2>{0.194773883f, 0.903624952f},
-std::array<float,2>{0.430348873f, 0.0131431818f},
-std::array<float,2>{0.922740459f, 0.65652281f},
-std::array<float,2>{0.944124281f, 0.482806504f},
-std::array<float,2>{0.485112995f, 0.819895804f},
-std::array<float,2>{0.145853907f, 0.189532071f},
-std::array<float,2>{0.523654878f, 0.511480093f},
-std::array<float,2>{0.625369132f, 0.122869074f},
-std::array<float,2>{0.0491118617f, 0.728708267f},
-std::array<float,2>{0.306372017f, 0.333204985f},
-std::array<float,2>{0.756666899f, 0.965150833f},
-std::array<float,2>{0.972377241f, 0.212381199f},
-std::array<float,2>{0.468159705f, 0.518712044f},
-std::array<float,2>{0.164033949f, 0.499018162f},
-std::array<float,2>{0.553516209f, 0.832361996f},
-std::array<float,2>{0.658578873f, 0.320914656f},
-std::array<float,2>{0.0100373914f, 0.944772184f},
-std::array<float,2>{0.267036349f, 0.0976354331f},
-std::array<float,2>{0.791136026f, 0.743020594f},
-std::array<float,2>{0.859781325f, 0.411372274f},
-std::array<float,2>{0.33037883f, 0.764391065f},
-std::array<float,2>{0.081656836f, 0.14539209f},
-std::array<float,2>{0.692200005f, 0.619981587f},
-std::array<float,2>{0.564748645f, 0.0169500951f},
-std::array<float,2>{0.220345944f, 0.682033479f},
-std::array<float,2>{0.385764867f, 0.295766771f},
-std::array<float,2>{0.887364507f, 0.889240384f},
-std::array<float,2>{0.781141877f, 0.0793056861f},
-std::array<float,2>{0.283636034f, 0.715052187f},
-std::array<float,2>{0.0393353663f, 0.351399988f},
-std::array<float,2>{0.641665101f, 0.992223799f},
-std::array<float,2>{0.514373958f, 0.459924817f},
-std::array<float,2>{0.131580099f, 0.846481323f},
-std::array<float,2>{0.471028894f, 0.242970482f},
-std::array<float,2>{0.957502007f, 0.56103313f},
-std::array<float,2>{0.916049659f, 0.279840559f},
-std::array<float,2>{0.413543254f, 0.936440408f},
-std::array<float,2>{0.207277551f, 0.0605565496f},
-std::array<float,2>{0.59670049f, 0.647466898f},
-std::array<float,2>{0.719311774f, 0.176069438f},
-std::array<float,2>{0.118761174f, 0.571413338f},
-std::array<float,2>{0.354296476f, 0.391171157f},
-std::array<float,2>{0.833336771f, 0.792173147f},
-std::array<float,2>{0.985636473f, 0.0307224002f},
-std::array<float,2>{0.451914072f, 0.677847207f},
-std::array<float,2>{0.177348271f, 0.287130505f},
-std::array<float,2>{0.532848775f, 0.876386046f},
-std::array<float,2>{0.676214278f, 0.415932983f},
-std::array<float,2>{0.0306974556f, 0.75004679f},
-std::array<float,2>{0.254430741f, 0.148624405f},
-std::array<float,2>{0.809387326f, 0.612237632f},
-std::array<float,2>{0.844066918f, 0.319280267f},
-std::array<float,2>{0.317558438f, 0.947502315f},
-std::array<float,2>{0.070483014f, 0.109324552f},
-std::array<float,2>{0.703927517f, 0.74134326f},
-std::array<float,2>{0.580209613f, 0.205045134f},
-std::array<float,2>{0.237304881f, 0.529028893f},
-std::array<float,2>{0.401377231f, 0.489452899f},
-std::array<float,2>{0.900789857f, 0.841720164f},
-std::array<float,2>{0.752988994f, 0.184134856f},
-std::array<float,2>{0.310930371f, 0.568295479f},
-std::array<float,2>{0.0508057736f, 0.401679844f},
-std::array<float,2>{0.632682204f, 0.783733428f},
-std::array<float,2>{0.531214118f, 0.271655738f},
-std::array<float,2>{0.14140901f, 0.927877605f},
-std::array<float,2>{0.49040705f, 0.0534803234f},
-std::array<float,2>{0.941231132f, 0.655270278f},
-std::array<float,2>{0.926027894f, 0.463990301f},
-std::array<float,2>{0.433687091f, 0.851967156f},
-std::array<float,2>{0.187728092f, 0.234566376f},
-std::array<float,2>{0.617472112f, 0.548526764f},
-std::array<float,2>{0.744239926f, 0.093026787f},
-std::array<float,2>{0.0947481915f, 0.706382513f},
-std::array<float,2>{0.365141511f, 0.353776246f},
-std::array<float,2>{0.825243235f, 0.990926206f},
-std::array<float,2>{0.88294822f, 0.227285191f},
-std::array<float,2>{0.388516247f, 0.543027163f},
-std::array<float,2>{0.225682005f, 0.448685765f},
-std::array<float,2>{0.569712818f, 0.874778271f},
-std::array<float,2>{0.688394189f, 0.371222168f},
-std::array<float,2>{0.0850949436f, 0.981205642f},
-std::array<float,2>{0.333783329f, 0.0686353892f},
-std::array<float,2>{0.865795135f, 0.687611282f},
-std::array<float,2>{0.796824872f, 0.385496855f},
-std::array<float,2>{0.272544444f, 0.804110587f},
-std::array<float,2>{0.0151806716f, 0.157304317f},
-std::array<float,2>{0.663449764f, 0.593620658f},
-std::array<float,2>{0.548508525f, 0.0438131839f},
-std::array<float,2>{0.157860935f, 0.631923556f},
-std::array<float,2>{0.462186337f, 0.260866612f},
-std::array<float,2>{0.974098086f, 0.906613231f},
-std::array<float,2>{0.828159809f, 0.112032548f},
-std::array<float,2>{0.355780065f, 0.724387288f},
-std::array<float,2>{0.123203143f, 0.336302698f},
-std::array<float,2>{0.723645031f, 0.959465325f},
-std::array<float,2>{0.599661291f, 0.469912559f},
-std::array<float,2>{0.206255972f, 0.825591445f},
-std::array<float,2>{0.407384008f, 0.197558582f},
-std::array<float,2>{0.921653628f, 0.504113376f},
-std::array<float,2>{0.956632853f, 0.308462709f},
-std::array<float,2>{0.473191172f, 0.893714428f},
-std::array<float,2>{0.125752538f, 0.00117954868f},
-std::array<float,2>{0.510338783f, 0.66679734f},
-std::array<float,2>{0.645446599f, 0.125067249f},
-std::array<float,2>{0.043025028f, 0.595033169f},
-std::array<float,2>{0.286412865f, 0.422224939f},
-std::array<float,2>{0.77474463f, 0.771343827f},
-std::array<float,2>{0.911202967f, 0.0709855184f},
-std::array<float,2>{0.421551138f, 0.698344052f},
-std::array<float,2>{0.217380375f, 0.363723367f},
-std::array<float,2>{0.603281796f, 0.97528559f},
-std::array<float,2>{0.732814372f, 0.437971056f},
-std::array<float,2>{0.110249698f, 0.866905451f},
-std::array<float,2>{0.347333431f, 0.221989378f},
-std::array<float,2>{0.842714608f, 0.538524151f},
-std::array<float,2>{0.76624912f, 0.257074386f},
-std::array<float,2>{0.292765856f, 0.920623302f},
-std::array<float,2>{0.0363401361f, 0.035853859f},
-std::array<float,2>{0.652706802f, 0.636268675f},
-std::array<float,2>{0.503702283f, 0.170064792f},
-std::array<float,2>{0.138083488f, 0.581983685f},
-std::array<float,2>{0.478091002f, 0.379079491f},
-std::array<float,2>{0.964613199f, 0.805007875f},
-std::array<float,2>{0.86923939f, 0.191426724f},
-std::array<float,2>{0.33646822f, 0.513347924f},
-std::array<float,2>{0.0907411873f, 0.479362756f},
-std::array<float,2>{0.696846783f, 0.812562764f},
-std::array<float,2>{0.57358402f, 0.331866264f},
-std::array<float,2>{0.232652813f, 0.962391555f},
-std::array<float,2>{0.380575806f, 0.118764944f},
-std::array<float,2>{0.881268501f, 0.732928753f},
-std::array<float,2>{0.977170706f, 0.434648514f},
-std::array<float,2>{0.455519736f, 0.773682714f},
-std::array<float,2>{0.16611883f, 0.135318696f},
-std::array<float,2>{0.556877613f, 0.603204012f},
-std::array<float,2>{0.671281815f, 0.0108176954f},
-std::array<float,2>{0.00267978944f, 0.662595928f},
-std::array<float,2>{0.274417341f, 0.29762736f},
-std::array<float,2>{0.785572171f, 0.900657713f},
-std::array<float,2>{0.948289096f, 0.141676486f},
-std::array<float,2>{0.497012258f, 0.621691763f},
-std::array<float,2>{0.15069069f, 0.406949282f},
-std::array<float,2>{0.517281294f, 0.759491026f},
-std::array<float,2>{0.633219242f, 0.292378277f},
-std::array<float,2>{0.0567090027f, 0.885707676f},
-std::array<float,2>{0.300132453f, 0.0201177876f},
-std::array<float,2>{0.764792979f, 0.686776221f},
-std::array<float,2>{0.819884837f, 0.493357062f},
-std::array<float,2>{0.373847276f, 0.832027435f},
-std::array<float,2>{0.108919643f, 0.217934713f},
-std::array<float,2>{0.740216315f, 0.520519972f},
-std::array<float,2>{0.61462146f, 0.0997320786f},
-std::array<float,2>{0.198520377f, 0.746695101f},
-std::array<float,2>{0.428195953f, 0.325611979f},
-std::array<float,2>{0.931081593f, 0.940756202f},
-std::array<float,2>{0.803983331f, 0.0550547503f},
-std::array<float,2>{0.265318513f, 0.643553376f},
-std::array<float,2>{0.0178194735f, 0.276909977f},
-std::array<float,2>{0.685505629f, 0.932570338f},
-std::array<float,2>{0.544185758f, 0.396313727f},
-std::array<float,2>{0.180933461f, 0.795218587f},
-std::array<float,2>{0.438721478f, 0.173765048f},
-std::array<float,2>{0.997208059f, 0.578100562f},
-std::array<float,2>{0.894420266f, 0.34390083f},
-std::array<float,2>{0.391498417f, 0.999586463f},
-std::array<float,2>{0.245292634f, 0.0859144554f},
-std::array<float,2>{0.586814761f, 0.712136865f},
-std::array<float,2>{0.714454055f, 0.248118579f},
-std::array<float,2>{0.0642410144f, 0.555803776f},
-std::array<float,2>{0.320633709f, 0.454739541f},
-std::array<float,2>{0.858950794f, 0.848189294f},
-std::array<float,2>{0.982581854f, 0.0896967873f},
-std::array<float,2>{0.460920841f, 0.707446456f},
-std::array<float,2>{0.167970464f, 0.35668546f},
-std::array<float,2>{0.558913291f, 0.984713912f},
-std::array<float,2>{0.667069316f, 0.46617955f},
-std::array<float,2>{0.00529942708f, 0.857397735f},
-std::array<float,2>{0.280763119f, 0.240036726f},
-std::array<float,2>{0.784793258f, 0.551488519f},
-std::array<float,2>{0.874469459f, 0.266967058f},
-std::array<float,2>{0.340580434f, 0.922082126f},
-std::array<float,2>{0.0889365301f, 0.0507575721f},
-std::array<float,2>{0.699228704f, 0.650028944f},
-std::array<float,2>{0.577772915f, 0.181414217f},
-std::array<float,2>{0.226925895f, 0.565330267f},
-std::array<float,2>{0.378204018f, 0.403424054f},
-std::array<float,2>{0.875174522f, 0.786605775f},
-std::array<float,2>{0.770184934f, 0.207190976f},
-std::array<float,2>{0.29436022f, 0.526040494f},
-std::array<float,2>{0.0345485993f, 0.485020339f},
-std::array<float,2>{0.651646435f, 0.83937043f},
-std::array<float,2>{0.505075574f, 0.314557761f},
-std::array<float,2>{0.133164674f, 0.950019538f},
-std::array<float,2>{0.480812371f, 0.104251273f},
-std::array<float,2>{0.9658283f, 0.735315681f},
-std::array<float,2>{0.907665968f, 0.420210004f},
-std::array<float,2>{0.416962057f, 0.754483879f},
-std::array<float,2>{0.214678496f, 0.153935552f},
-std::array<float,2>{0.607928693f, 0.614213347f},
-std::array<float,2>{0.729638755f, 0.0259865224f},
-std::array<float,2>{0.115941703f, 0.675571084f},
-std::array<float,2>{0.351162583f, 0.281813502f},
-std::array<float,2>{0.839010656f, 0.880274415f},
-std::array<float,2>{0.898161829f, 0.129103199f},
-std::array<float,2>{0.395727247f, 0.601359069f},
-std::array<float,2>{0.247837752f, 0.429149419f},
-std::array<float,2>{0.590667844f, 0.769493878f},
-std::array<float,2>{0.71605438f, 0.309579521f},
-std::array<float,2>{0.068958208f, 0.898233652f},
-std::array<float,2>{0.324379116f, 0.00457739877f},
-std::array<float,2>{0.851669252f, 0.671046853f},
-std::array<float,2>{0.799266696f, 0.472996205f},
-std::array<float,2>{0.26088652f, 0.820804417f},
-std::array<float,2>{0.0210632849f, 0.200465322f},
-std::array<float,2>{0.682594538f, 0.500331283f},
-std::array<float,2>{0.542489588f, 0.114261761f},
-std::array<float,2>{0.186956778f, 0.721707225f},
-std::array<float,2>{0.443502873f, 0.339905858f},
-std::array<float,2>{0.993879437f, 0.955539942f},
-std::array<float,2>{0.813777864f, 0.0394969136f},
-std::array<float,2>{0.369783521f, 0.62610358f},
-std::array<float,2>{0.102334447f, 0.262085587f},
-std::array<float,2>{0.736500025f, 0.913908124f},
-std::array<float,2>{0.609976172f, 0.390569806f},
-std::array<float,2>{0.20170404f, 0.800451219f},
-std::array<float,2>{0.425653845f, 0.161751315f},
-std::array<float,2>{0.934108555f, 0.587209761f},
-std::array<float,2>{0.950897455f, 0.368662089f},
-std::array<float,2>{0.492959976f, 0.978301108f},
-std::array<float,2>{0.155105799f, 0.062717393f},
-std::array<float,2>{0.520860672f, 0.691689968f},
-std::array<float,2>{0.639029503f, 0.233826414f},
-std::array<float,2>{0.0602937564f, 0.542929351f},
-std::array<float,2>{0.302286297f, 0.450016469f},
-std::array<float,2>{0.758692861f, 0.870484054f},
-std::array<float,2>{0.924962819f, 0.0138424179f},
-std::array<float,2>{0.432654768f, 0.659893632f},
-std::array<float,2>{0.192214042f, 0.30430451f},
-std::array<float,2>{0.624866426f, 0.905830741f},
-std::array<float,2>{0.747891486f, 0.433210224f},
-std::array<float,2>{0.0994418338f, 0.779328883f},
-std::array<float,2>{0.359498709f, 0.139210239f},
-std::array<float,2>{0.823360443f, 0.60672456f},
-std::array<float,2>{0.75430721f, 0.334542423f},
-std::array<float,2>{0.307265431f, 0.968181133f},
-std::array<float,2>{0.0474484526f, 0.124276385f},
-std::array<float,2>{0.627304137f, 0.727140605f},
-std::array<float,2>{0.527026951f, 0.188581094f},
-std::array<float,2>{0.14797622f, 0.509134233f},
-std::array<float,2>{0.487234086f, 0.480670035f},
-std::array<float,2>{0.941586912f, 0.817054689f},
-std::array<float,2>{0.849579334f, 0.164743751f},
-std::array<float,2>{0.314087063f, 0.582918048f},
-std::array<float,2>{0.0766269863f, 0.375161111f},
-std::array<float,2>{0.709389985f, 0.809046507f},
-std::array<float,2>{0.5834198f, 0.252277434f},
-std::array<float,2>{0.240527451f, 0.917661905f},
-std::array<float,2>{0.402644306f, 0.0331880935f},
-std::array<float,2>{0.904452085f, 0.636862636f},
-std::array<float,2>{0.988702297f, 0.442946851f},
-std::array<float,2>{0.445786446f, 0.861421704f},
-std::array<float,2>{0.174163014f, 0.226439297f},
-std::array<float,2>{0.53630662f, 0.534860015f},
-std::array<float,2>{0.67348212f, 0.0744102076f},
-std::array<float,2>{0.025461467f, 0.701339126f},
-std::array<float,2>{0.252966881f, 0.359982193f},
-std::array<float,2>{0.806349277f, 0.969476402f},
-std::array<float,2>{0.960717976f, 0.245453104f},
-std::array<float,2>{0.469994098f, 0.55927074f},
-std::array<float,2>{0.129646808f, 0.458520681f},
-std::array<float,2>{0.512504637f, 0.844897807f},
-std::array<float,2>{0.643905997f, 0.348143131f},
-std::array<float,2>{0.0424110442f, 0.995116413f},
-std::array<float,2>{0.281455517f, 0.0816903263f},
-std::array<float,2>{0.77897495f, 0.718330622f},
-std::array<float,2>{0.835912287f, 0.393627405f},
-std::array<float,2>{0.352178812f, 0.790303171f},
-std::array<float,2>{0.120739087f, 0.179001957f},
-std::array<float,2>{0.720910549f, 0.573044181f},
-std::array<float,2>{0.59470135f, 0.0604029112f},
-std::array<float,2>{0.210896179f, 0.645832956f},
-std::array<float,2>{0.411933899f, 0.27926001f},
-std::array<float,2>{0.915213108f, 0.933735132f},
-std::array<float,2>{0.790841997f, 0.0940078497f},
-std::array<float,2>{0.268261224f, 0.746073246f},
-std::array<float,2>{0.00835182425f, 0.323751956f},
-std::array<float,2>{0.656313539f, 0.941848338f},
-std::array<float,2>{0.55169332f, 0.497955471f},
-std::array<float,2>{0.160484061f, 0.834141016f},
-std::array<float,2>{0.464925438f, 0.214615911f},
-std::array<float,2>{0.97039628f, 0.516257167f},
-std::array<float,2>{0.890358031f, 0.293396175f},
-std::array<float,2>{0.383787066f, 0.88812834f},
-std::array<float,2>{0.22200799f, 0.0192855187f},
-std::array<float,2>{0.563211024f, 0.680061638f},
-std::array<float,2>{0.694770753f, 0.147147492f},
-std::array<float,2>{0.0781446472f, 0.61905098f},
-std::array<float,2>{0.329789996f, 0.414044648f},
-std::array<float,2>{0.861900389f, 0.762084186f},
-std::array<float,2>{0.938689351f, 0.0520899445f},
-std::array<float,2>{0.489629596f, 0.652973056f},
-std::array<float,2>{0.144321784f, 0.269903868f},
-std::array<float,2>{0.529272079f, 0.926041365f},
-std::array<float,2>{0.630041599f, 0.399029076f},
-std::array<float,2>{0.0539679304f, 0.78236407f},
-std::array<float,2>{0.308791101f, 0.186942935f},
-std::array<float,2>{0.750274777f, 0.569647253f},
-std::array<float,2>{0.826176763f, 0.351941228f},
-std::array<float,2>{0.365868688f, 0.989410579f},
-std::array<float,2>{0.0967948139f, 0.0912547559f},
-std::array<float,2>{0.742686212f, 0.704248607f},
-std::array<float,2>{0.620760918f, 0.236462876f},
-std::array<float,2>{0.189916417f, 0.550295293f},
-std::array<float,2>{0.437406391f, 0.462082088f},
-std::array<float,2>{0.929494321f, 0.854419589f},
-std::array<float,2>{0.811709762f, 0.151450053f},
-std::array<float,2>{0.255944848f, 0.609631062f},
-std::array<float,2>{0.0280913562f, 0.416707277f},
-std::array<float,2>{0.678291738f, 0.752224207f},
-std::array<float,2>{0.533743918f, 0.285227627f},
-std::array<float,2>{0.178048462f, 0.877558112f},
-std::array<float,2>{0.449363321f, 0.0282619763f},
-std::array<float,2>{0.987838328f, 0.67701149f},
-std::array<float,2>{0.899467051f, 0.490983903f},
-std::array<float,2>{0.399529606f, 0.84182626f},
-std::array<float,2>{0.23531805f, 0.207000598f},
-std::array<float,2>{0.578967929f, 0.529479504f},
-std::array<float,2>{0.706443131f, 0.105804838f},
-std::array<float,2>{0.0733348355f, 0.739087403f},
-std::array<float,2>{0.320158571f, 0.317998141f},
-std::array<float,2>{0.847487926f, 0.946475744f},
-std::array<float,2>{0.918981671f, 0.196937248f},
-std::array<float,2>{0.408582747f, 0.506844461f},
-std::array<float,2>{0.20480825f, 0.472583115f},
-std::array<float,2>{0.597802877f, 0.826233804f},
-std::array<float,2>{0.725183666f, 0.338230282f},
-std::array<float,2>{0.121952869f, 0.958415627f},
-std::array<float,2>{0.357851416f, 0.110514708f},
-std::array<float,2>{0.831573784f, 0.724723577f},
-std::array<float,2>{0.777254105f, 0.424518853f},
-std::array<float,2>{0.287322849f, 0.771659195f},
-std::array<float,2>{0.0458553769f, 0.128832713f},
-std::array<float,2>{0.648077786f, 0.595984042f},
-std::array<float,2>{0.507942379f, 0.00272155134f},
-std::array<float,2>{0.128476307f, 0.665488005f},
-std::array<float,2>{0.47497201f, 0.305346996f},
-std::array<float,2>{0.954655707f, 0.892183542f},
-std::array<float,2>{0.864189804f, 0.0669366121f},
-std::array<float,2>{0.335002065f, 0.690590024f},
-std::array<float,2>{0.0821956396f, 0.373813182f},
-std::array<float,2>{0.691091716f, 0.982749224f},
-std::array<float,2>{0.567449093f, 0.445332199f},
-std::array<float,2>{0.224196061f, 0.871873796f},
-std::array<float,2>{0.388960034f, 0.228556529f},
-std::array<float,2>{0.885873973f, 0.546460211f},
-std::array<float,2>{0.976324558f, 0.259625852f},
-std::array<float,2>{0.463386834f, 0.909744918f},
-std::array<float,2>{0.159133047f, 0.0464028232f},
-std::array<float,2>{0.549650013f, 0.630223811f},
-std::array<float,2>{0.661153674f, 0.158688396f},
-std::array<float,2>{0.0120063107f, 0.590227902f},
-std::array<float,2>{0.2698735f, 0.384155184f},
-std::array<float,2>{0.794893503f, 0.802521288f},
-std::array<float,2>{0.879964471f, 0.120494954f},
-std::array<float,2>{0.382135868f, 0.731032729f},
-std::array<float,2>{0.23155205f, 0.329972297f},
-std::array<float,2>{0.571015775f, 0.964327693f},
-std::array<float,2>{0.697537065f, 0.478069097f},
-std::array<float,2>{0.0930648297f, 0.81602186f},
-std::array<float,2>{0.339831173f, 0.194943622f},
-std::array<float,2>{0.86765939f, 0.514427662f},
-std::array<float,2>{0.787575364f, 0.299853772f},
-std::array<float,2>{0.275785953f, 0.89949137f},
-std::array<float,2>{0.00117393734f, 0.00814659521f},
-std::array<float,2>{0.668522418f, 0.661765695f},
-std::array<float,2>{0.556310534f, 0.133456185f},
-std::array<float,2>{0.165978953f, 0.604890049f},
-std::array<float,2>{0.454569757f, 0.437390208f},
-std::array<float,2>{0.978982568f, 0.77634716f},
-std::array<float,2>{0.840993464f, 0.220073968f},
-std::array<float,2>{0.345249176f, 0.535216033f},
-std::array<float,2>{0.112870172f, 0.440395206f},
-std::array<float,2>{0.730499268f, 0.864609838f},
-std::array<float,2>{0.60504055f, 0.366185904f},
-std::array<float,2>{0.216647074f, 0.972894847f},
-std::array<float,2>{0.418117255f, 0.0740803033f},
-std::array<float,2>{0.913421214f, 0.696789682f},
-std::array<float,2>{0.961576402f, 0.382097632f},
-std::array<float,2>{0.480064183f, 0.80853343f},
-std::array<float,2>{0.140536204f, 0.169646651f},
-std::array<float,2>{0.501846135f, 0.579401791f},
-std::array<float,2>{0.654774249f, 0.0377339274f},
-std::array<float,2>{0.0373286679f, 0.63293165f},
-std::array<float,2>{0.290847063f, 0.255443245f},
-std::array<float,2>{0.768145859f, 0.918626368f},
-std::array<float,2>{0.998150229f, 0.175363958f},
-std::array<float,2>{0.440515578f, 0.575784028f},
-std::array<float,2>{0.182689101f, 0.398053557f},
-std::array<float,2>{0.545196652f, 0.793140292f},
-std::array<float,2>{0.686338484f, 0.27450195f},
-std::array<float,2>{0.0157551989f, 0.930383563f},
-std::array<float,2>{0.262512475f, 0.0583455451f},
-std::array<float,2>{0.802727461f, 0.641980052f},
-std::array<float,2>{0.855911314f, 0.455654651f},
-std::array<float,2>{0.323243171f, 0.849945128f},
-std::array<float,2>{0.0645564869f, 0.246465608f},
-std::array<float,2>{0.712588608f, 0.557791233f},
-std::array<float,2>{0.588501453f, 0.0835974067f},
-std::array<float,2>{0.243241563f, 0.714157581f},
-std::array<float,2>{0.394519031f, 0.34743616f},
-std::array<float,2>{0.892129719f, 0.997738123f},
-std::array<float,2>{0.763068557f, 0.022363361f},
-std::array<float,2>{0.297291398f, 0.684676707f},
-std::array<float,2>{0.0557189919f, 0.290917039f},
-std::array<float,2>{0.636006296f, 0.88391912f},
-std::array<float,2>{0.518765748f, 0.409158111f},
-std::array<float,2>{0.149706438f, 0.761412263f},
-std::array<float,2>{0.499744177f, 0.143309176f},
-std::array<float,2>{0.946030021f, 0.624174356f},
-std::array<float,2>{0.932671845f, 0.326574773f},
-std::array<float,2>{0.426800638f, 0.938388109f},
-std::array<float,2>{0.195618495f, 0.0978268161f},
-std::array<float,2>{0.615350366f, 0.749153078f},
-std::array<float,2>{0.741921365f, 0.215746537f},
-std::array<float,2>{0.106445603f, 0.521687746f},
-std::array<float,2>{0.372898549f, 0.49511376f},
-std::array<float,2>{0.816514671f, 0.829889178f},
-std::array<float,2>{0.993095636f, 0.11597953f},
-std::array<float,2>{0.445103228f, 0.718961358f},
-std::array<float,2>{0.185852766f, 0.342702478f},
-std::array<float,2>{0.541447282f, 0.954027474f},
-std::array<float,2>{0.683249652f, 0.476548404f},
-std::array<float,2>{0.0201831218f, 0.823961079f},
-std::array<float,2>{0.260044962f, 0.201615259f},
-std::array<float,2>{0.800712347f, 0.502457976f},
-std::array<float,2>{0.853433788f, 0.312136382f},
-std::array<float,2>{0.325424641f, 0.894659698f},
-std::array<float,2>{0.0695928112f, 0.00633148616f},
-std::array<float,2>{0.7149055f, 0.668614864f},
-std::array<float,2>{0.591555953f, 0.131401226f},
-std::array<float,2>{0.246116698f, 0.597924054f},
-std::array<float,2>{0.394607633f, 0.426771075f},
-std::array<float,2>{0.897108018f, 0.766593874f},
-std::array<float,2>{0.758867502f, 0.231732383f},
-std::array<float,2>{0.301652879f, 0.540132761f},
-std::array<float,2>{0.0589098968f, 0.45282349f},
-std::array<float,2>{0.640222073f, 0.868852139f},
-std::array<float,2>{0.520074308f, 0.369767845f},
-std::array<float,2>{0.155782938f, 0.979788363f},
-std::array<float,2>{0.494003326f, 0.0648327395f},
-std::array<float,2>{0.949795425f, 0.694252431f},
-std::array<float,2>{0.935141623f, 0.387187868f},
-std::array<float,2>{0.424765676f, 0.797053158f},
-std::array<float,2>{0.202296451f, 0.162457511f},
-std::array<float,2>{0.610662878f, 0.588099897f},
-std::array<float,2>{0.737942338f, 0.0416445211f},
-std::array<float,2>{0.102932937f, 0.628307998f},
-std::array<float,2>{0.370704114f, 0.264372379f},
-std::array<float,2>{0.812680483f, 0.911132634f},
-std::array<float,2>{0.876042545f, 0.182115242f},
-std::array<float,2>{0.377779663f, 0.56387949f},
-std::array<float,2>{0.227622598f, 0.404850662f},
-std::array<float,2>{0.576709688f, 0.788645267f},
-std::array<float,2>{0.700884938f, 0.269408613f},
-std::array<float,2>{0.0880035385f, 0.924226165f},
-std::array<float,2>{0.341719598f, 0.0483345501f},
-std::array<float,2>{0.873330355f, 0.650874019f},
-std::array<float,2>{0.784073412f, 0.467528522f},
-std::array<float,2>{0.279595912f, 0.858541667f},
-std::array<float,2>{0.00463214517f, 0.241198733f},
-std::array<float,2>{0.666477263f, 0.554067492f},
-std::array<float,2>{0.560223937f, 0.0871440247f},
-std::array<float,2>{0.169533849f, 0.7090258f},
-std::array<float,2>{0.459101588f, 0.358367056f},
-std::array<float,2>{0.983433366f, 0.988113821f},
-std::array<float,2>{0.838591397f, 0.0252250731f},
-std::array<float,2>{0.350528598f, 0.672291636f},
-std::array<float,2>{0.116558351f, 0.283857763f},
-std::array<float,2>{0.728706121f, 0.881239057f},
-std::array<float,2>{0.608845115f, 0.418051809f},
-std::array<float,2>{0.21330747f, 0.757052183f},
-std::array<float,2>{0.417188227f, 0.15490374f},
-std::array<float,2>{0.907176137f, 0.616903186f},
-std::array<float,2>{0.965120971f, 0.313835144f},
-std::array<float,2>{0.482304543f, 0.952368498f},
-std::array<float,2>{0.134533048f, 0.102378666f},
-std::array<float,2>{0.503916264f, 0.738086522f},
-std::array<float,2>{0.650561333f, 0.210643902f},
-std::array<float,2>{0.0332453102f, 0.52482307f},
-std::array<float,2>{0.293687463f, 0.486355931f},
-std::array<float,2>{0.770521045f, 0.837068439f},
-std::array<float,2>{0.914337575f, 0.0615729168f},
-std::array<float,2>{0.410850167f, 0.646985412f},
-std::array<float,2>{0.209960923f, 0.280650616f},
-std::array<float,2>{0.594790936f, 0.937455416f},
-std::array<float,2>{0.72240901f, 0.391718686f},
-std::array<float,2>{0.119905554f, 0.791428924f},
-std::array<float,2>{0.353146315f, 0.176783949f},
-std::array<float,2>{0.83464396f, 0.57114321f},
-std::array<float,2>{0.777518451f, 0.349859208f},
-std::array<float,2>{0.282792687f, 0.993749499f},
-std::array<float,2>{0.0412735268f, 0.078149423f},
-std::array<float,2>{0.643155813f, 0.716181874f},
-std::array<float,2>{0.51352042f, 0.243268654f},
-std::array<float,2>{0.130366638f, 0.562192261f},
-std::array<float,2>{0.469207197f, 0.460038185f},
-std::array<float,2>{0.959774911f, 0.847361147f},
-std::array<float,2>{0.863267124f, 0.146035001f},
-std::array<float,2>{0.328316271f, 0.620950818f},
-std::array<float,2>{0.0793584287f, 0.41037485f},
-std::array<float,2>{0.693846643f, 0.765299797f},
-std::array<float,2>{0.563494742f, 0.296720088f},
-std::array<float,2>{0.221270755f, 0.890129983f},
-std::array<float,2>{0.383966476f, 0.0158574823f},
-std::array<float,2>{0.889541626f, 0.682899714f},
-std::array<float,2>{0.968851566f, 0.499807209f},
-std::array<float,2>{0.466670543f, 0.833770156f},
-std::array<float,2>{0.161292255f, 0.211819381f},
-std::array<float,2>{0.552202702f, 0.518024921f},
-std::array<float,2>{0.657679796f, 0.0965184122f},
-std::array<float,2>{0.00908162631f, 0.744013727f},
-std::array<float,2>{0.26884073f, 0.321789145f},
-std::array<float,2>{0.789187431f, 0.94396925f},
-std::array<float,2>{0.942628086f, 0.190658897f},
-std::array<float,2>{0.487339526f, 0.510389864f},
-std::array<float,2>{0.146970868f, 0.483700126f},
-std::array<float,2>{0.525833666f, 0.818409681f},
-std::array<float,2>{0.628406525f, 0.332490951f},
-std::array<float,2>{0.0486681201f, 0.965971828f},
-std::array<float,2>{0.308519036f, 0.121748239f},
-std::array<float,2>{0.755813301f, 0.730315328f},
-std::array<float,2>{0.82236439f, 0.4299891f},
-std::array<float,2>{0.3613168f, 0.778506517f},
-std::array<float,2>{0.0978053436f, 0.137365296f},
-std::array<float,2>{0.746173918f, 0.608264029f},
-std::array<float,2>{0.623761594f, 0.0123489192f},
-std::array<float,2>{0.193226516f, 0.657909036f},
-std::array<float,2>{0.431864083f, 0.302517951f},
-std::array<float,2>{0.924002051f, 0.903013051f},
-std::array<float,2>{0.805075943f, 0.07769683f},
-std::array<float,2>{0.252374202f, 0.70083046f},
-std::array<float,2>{0.027295094f, 0.363196373f},
-std::array<float,2>{0.672828376f, 0.971819341f},
-std::array<float,2>{0.535414159f, 0.444618911f},
-std::array<float,2>{0.175158367f, 0.86126852f},
-std::array<float,2>{0.446564794f, 0.224475712f},
-std::array<float,2>{0.989310384f, 0.533180237f},
-std::array<float,2>{0.905928969f, 0.251112103f},
-std::array<float,2>{0.404286772f, 0.915218055f},
-std::array<float,2>{0.242151439f, 0.0338914841f},
-std::array<float,2>{0.582129121f, 0.639278531f},
-std::array<float,2>{0.710316598f, 0.167160541f},
-std::array<float,2>{0.0779861063f, 0.585574269f},
-std::array<float,2>{0.312946975f, 0.378032684f},
-std::array<float,2>{0.848074377f, 0.81208992f},
-std::array<float,2>{0.953396857f, 0.0009483514f},
-std::array<float,2>{0.476266325f, 0.667141378f},
-std::array<float,2>{0.127781332f, 0.306808144f},
-std::array<float,2>{0.50941205f, 0.893039703f},
-std::array<float,2>{0.647345364f, 0.423818171f},
-std::array<float,2>{0.0467225686f, 0.769847631f},
-std::array<float,2>{0.289021432f, 0.126058057f},
-std::array<float,2>{0.775394619f, 0.594693303f},
-std::array<float,2>{0.830479801f, 0.337279975f},
-std::array<float,2>{0.358431399f, 0.960669219f},
-std::array<float,2>{0.122941516f, 0.112553015f},
-std::array<float,2>{0.726008058f, 0.723367333f},
-std::array<float,2>{0.598896801f, 0.198496953f},
-std::array<float,2>{0.203299582f, 0.505797565f},
-std::array<float,2>{0.409225404f, 0.469047129f},
-std::array<float,2>{0.918467224f, 0.824237108f},
-std::array<float,2>{0.793750763f, 0.156676188f},
-std::array<float,2>{0.271127582f, 0.592202425f},
-std::array<float,2>{0.0133476565f, 0.385880917f},
-std::array<float,2>{0.660646319f, 0.802778423f},
-std::array<float,2>{0.550569057f, 0.260612547f},
-std::array<float,2>{0.159769565f, 0.908059001f},
-std::array<float,2>{0.464218408f, 0.0447764695f},
-std::array<float,2>{0.9754439f, 0.630982518f},
-std::array<float,2>{0.885699451f, 0.447421372f},
-std::array<float,2>{0.389860511f, 0.873178005f},
-std::array<float,2>{0.222848013f, 0.228151023f},
-std::array<float,2>{0.566937625f, 0.544315219f},
-std::array<float,2>{0.690213382f, 0.0695057809f},
-std::array<float,2>{0.0836075917f, 0.688576341f},
-std::array<float,2>{0.334763467f, 0.372877657f},
-std::array<float,2>{0.864675581f, 0.981716394f},
-std::array<float,2>{0.928451121f, 0.236114353f},
-std::array<float,2>{0.436080009f, 0.547546744f},
-std::array<float,2>{0.191138163f, 0.463275462f},
-std::array<float,2>{0.619346976f, 0.853261471f},
-std::array<float,2>{0.743692279f, 0.35503605f},
-std::array<float,2>{0.0958530307f, 0.992032886f},
-std::array<float,2>{0.366212994f, 0.0919216648f},
-std::array<float,2>{0.827655971f, 0.70554775f},
-std::array<float,2>{0.751185417f, 0.400730342f},
-std::array<float,2>{0.310276031f, 0.784486294f},
-std::array<float,2>{0.0529536121f, 0.18513453f},
-std::array<float,2>{0.62962997f, 0.567297399f},
-std::array<float,2>{0.528179407f, 0.0539005063f},
-std::array<float,2>{0.143105894f, 0.656010091f},
-std::array<float,2>{0.488328218f, 0.27324152f},
-std::array<float,2>{0.937753856f, 0.929676175f},
-std::array<float,2>{0.846349418f, 0.107522488f},
-std::array<float,2>{0.319077194f, 0.740735352f},
-std::array<float,2>{0.0723496154f, 0.320018351f},
-std::array<float,2>{0.705201805f, 0.949103057f},
-std::array<float,2>{0.579174578f, 0.488447785f},
-std::array<float,2>{0.236119434f, 0.84029609f},
-std::array<float,2>{0.399258703f, 0.203791276f},
-std::array<float,2>{0.898696423f, 0.527467489f},
-std::array<float,2>{0.986720204f, 0.288856983f},
-std::array<float,2>{0.450424582f, 0.875329256f},
-std::array<float,2>{0.178721085f, 0.0301799607f},
-std::array<float,2>{0.534796357f, 0.679067612f},
-std::array<float,2>{0.679051459f, 0.14981012f},
-std::array<float,2>{0.029199088f, 0.612771749f},
-std::array<float,2>{0.256888807f, 0.414793462f},
-std::array<float,2>{0.810799181f, 0.751226127f},
-std::array<float,2>{0.891411006f, 0.0845729858f},
-std::array<float,2>{0.392631888f, 0.711221278f},
-std::array<float,2>{0.242447063f, 0.34534654f},
-std::array<float,2>{0.589577317f, 0.998953998f},
-std::array<float,2>{0.711224198f, 0.45397684f},
-std::array<float,2>{0.0662431642f, 0.848906934f},
-std::array<float,2>{0.322823316f, 0.249202654f},
-std::array<float,2>{0.857405186f, 0.554697216f},
-std::array<float,2>{0.80164212f, 0.275524586f},
-std::array<float,2>{0.262753636f, 0.933435798f},
-std::array<float,2>{0.0171682816f, 0.0565965772f},
-std::array<float,2>{0.68719852f, 0.644275725f},
-std::array<float,2>{0.546768308f, 0.172324881f},
-std::array<float,2>{0.18234691f, 0.576592207f},
-std::array<float,2>{0.440119892f, 0.395448953f},
-std::array<float,2>{0.999023676f, 0.796760499f},
-std::array<float,2>{0.817704499f, 0.216893733f},
-std::array<float,2>{0.371579856f, 0.520103335f},
-std::array<float,2>{0.10569869f, 0.49273929f},
-std::array<float,2>{0.74076283f, 0.830449402f},
-std::array<float,2>{0.616974771f, 0.324798912f},
-std::array<float,2>{0.197081745f, 0.94036907f},
-std::array<float,2>{0.426443815f, 0.101370066f},
-std::array<float,2>{0.931872487f, 0.747619867f},
-std::array<float,2>{0.946502149f, 0.407835931f},
-std::array<float,2>{0.499021083f, 0.758547425f},
-std::array<float,2>{0.149236009f, 0.140679047f},
-std::array<float,2>{0.517806649f, 0.622528911f},
-std::array<float,2>{0.634930491f, 0.0214348063f},
-std::array<float,2>{0.0550242923f, 0.685599208f},
-std::array<float,2>{0.297939152f, 0.291611254f},
-std::array<float,2>{0.76252687f, 0.886681914f},
-std::array<float,2>{0.979690611f, 0.136349931f},
-std::array<float,2>{0.453839213f, 0.602205157f},
-std::array<float,2>{0.164378509f, 0.433887333f},
-std::array<float,2>{0.555444956f, 0.775226831f},
-std::array<float,2>{0.6696347f, 0.297949851f},
-std::array<float,2>{0.000815944339f, 0.90188247f},
-std::array<float,2>{0.276596278f, 0.0102668703f},
-std::array<float,2>{0.788966f, 0.663984537f},
-std::array<float,2>{0.868213177f, 0.480103433f},
-std::array<float,2>{0.33828786f, 0.814231813f},
-std::array<float,2>{0.092009753f, 0.192605108f},
-std::array<float,2>{0.69908613f, 0.511777282f},
-std::array<float,2>{0.571525276f, 0.118004516f},
-std::array<float,2>{0.230540305f, 0.733817518f},
-std::array<float,2>{0.380953372f, 0.330789775f},
-std::array<float,2>{0.878969729f, 0.961600363f},
-std::array<float,2>{0.76875484f, 0.036587745f},
-std::array<float,2>{0.289767683f, 0.635323167f},
-std::array<float,2>{0.0388573371f, 0.256236851f},
-std::array<float,2>{0.655889511f, 0.920985043f},
-std::array<float,2>{0.500911713f, 0.380206883f},
-std::array<float,2>{0.139393345f, 0.806299031f},
-std::array<float,2>{0.478809029f, 0.171056956f},
-std::array<float,2>{0.962706387f, 0.581013799f},
-std::array<float,2>{0.912944555f, 0.365195453f},
-std::array<float,2>{0.419071496f, 0.976118445f},
-std::array<float,2>{0.21556057f, 0.0713489354f},
-std::array<float,2>{0.604469359f, 0.697800934f},
-std::array<float,2>{0.731687367f, 0.220817074f},
-std::array<float,2>{0.111405909f, 0.538026452f},
-std::array<float,2>{0.344584376f, 0.439186394f},
-std::array<float,2>{0.840179861f, 0.865837038f},
-std::array<float,2>{0.952517152f, 0.0642279983f},
-std::array<float,2>{0.495815128f, 0.692513347f},
-std::array<float,2>{0.153637111f, 0.368154883f},
-std::array<float,2>{0.521776259f, 0.977222562f},
-std::array<float,2>{0.638595819f, 0.450701058f},
-std::array<float,2>{0.0620264672f, 0.869285464f},
-std::array<float,2>{0.30318898f, 0.232479021f},
-std::array<float,2>{0.761432409f, 0.541581035f},
-std::array<float,2>{0.816321492f, 0.262855172f},
-std::array<float,2>{0.368245333f, 0.912791193f},
-std::array<float,2>{0.10424649f, 0.0401904099f},
-std::array<float,2>{0.734837294f, 0.625105023f},
-std::array<float,2>{0.61202848f, 0.160537168f},
-std::array<float,2>{0.200406194f, 0.586478174f},
-std::array<float,2>{0.422239006f, 0.388758004f},
-std::array<float,2>{0.936983585f, 0.799232721f},
-std::array<float,2>{0.797139406f, 0.199332207f},
-std::array<float,2>{0.258650005f, 0.501834929f},
-std::array<float,2>{0.0218541846f, 0.473635852f},
-std::array<float,2>{0.680167794f, 0.821305871f},
-std::array<float,2>{0.540817261f, 0.341447651f},
-std::array<float,2>{0.183877453f, 0.956578016f},
-std::array<float,2>{0.441722125f, 0.113963f},
-std::array<float,2>{0.994236648f, 0.721381247f},
-std::array<float,2>{0.895807803f, 0.427769363f},
-std::array<float,2>{0.397909313f, 0.768390059f},
-std::array<float,2>{0.249679476f, 0.130647525f},
-std::array<float,2>{0.592476547f, 0.59982717f},
-std::array<float,2>{0.717645288f, 0.00519018527f},
-std::array<float,2>{0.0675406232f, 0.670428514f},
-std::array<float,2>{0.327515632f, 0.308957815f},
-std::array<float,2>{0.854871571f, 0.896840274f},
-std::array<float,2>{0.909577966f, 0.152683109f},
-std::array<float,2>{0.415081203f, 0.614586234f},
-std::array<float,2>{0.211298525f, 0.421869397f},
-std::array<float,2>{0.605836749f, 0.755145431f},
-std::array<float,2>{0.727122784f, 0.282523066f},
-std::array<float,2>{0.113657214f, 0.879822731f},
-std::array<float,2>{0.348088175f, 0.0272209011f},
-std::array<float,2>{0.836243629f, 0.674258828f},
-std::array<float,2>{0.771612287f, 0.485780537f},
-std::array<float,2>{0.296759248f, 0.837892771f},
-std::array<float,2>{0.0326514244f, 0.208468378f},
-std::array<float,2>{0.650309086f, 0.527134776f},
-std::array<float,2>{0.506804168f, 0.105250798f},
-std::array<float,2>{0.135830402f, 0.735476255f},
-std::array<float,2>{0.482598782f, 0.31626603f},
-std::array<float,2>{0.967991412f, 0.950767517f},
-std::array<float,2>{0.872234404f, 0.0490472168f},
-std::array<float,2>{0.342679948f, 0.648567796f},
-std::array<float,2>{0.0863882676f, 0.266239226f},
-std::array<float,2>{0.702577233f, 0.923131526f},
-std::array<float,2>{0.575702786f, 0.402644575f},
-std::array<float,2>{0.228712499f, 0.785344303f},
-std::array<float,2>{0.376858443f, 0.18009384f},
-std::array<float,2>{0.878134072f, 0.566048145f},
-std::array<float,2>{0.982324541f, 0.356380731f},
-std::array<float,2>{0.457832396f, 0.986204267f},
-std::array<float,2>{0.171223387f, 0.0886116773f},
-std::array<float,2>{0.561227739f, 0.708730102f},
-std::array<float,2>{0.664993346f, 0.238362134f},
-std::array<float,2>{0.00609486504f, 0.552061796f},
-std::array<float,2>{0.278941095f, 0.465782881f},
-std::array<float,2>{0.782586217f, 0.855586767f},
-std::array<float,2>{0.888069212f, 0.0185387023f},
-std::array<float,2>{0.385390341f, 0.681186914f},
-std::array<float,2>{0.219172508f, 0.294347376f},
-std::array<float,2>{0.566008747f, 0.886774004f},
-std::array<float,2>{0.693019807f, 0.412353337f},
-std::array<float,2>{0.0804929361f, 0.76364404f},
-std::array<float,2>{0.331363142f, 0.147914827f},
-std::array<float,2>{0.861313939f, 0.617650032f},
-std::array<float,2>{0.792422414f, 0.322269857f},
-std::array<float,2>{0.266192585f, 0.942576706f},
-std::array<float,2>{0.0114846993f, 0.0956799313f},
-std::array<float,2>{0.66014415f, 0.744819105f},
-std::array<float,2>{0.554352641f, 0.21323593f},
-std::array<float,2>{0.163014546f, 0.516621411f},
-std::array<float,2>{0.467512757f, 0.496192306f},
-std::array<float,2>{0.971652567f, 0.835309803f},
-std::array<float,2>{0.832136154f, 0.178291485f},
-std::array<float,2>{0.354660839f, 0.573906779f},
-std::array<float,2>{0.117758878f, 0.393170089f},
-std::array<float,2>{0.7204234f, 0.789703667f},
-std::array<float,2>{0.595970035f, 0.277556449f},
-std::array<float,2>{0.208904132f, 0.934697151f},
-std::array<float,2>{0.412141889f, 0.0591612123f},
-std::array<float,2>{0.917103887f, 0.64537102f},
-std::array<float,2>{0.958680987f, 0.457071304f},
-std::array<float,2>{0.472039253f, 0.844400227f},
-std::array<float,2>{0.132046908f, 0.244913056f},
-std::array<float,2>{0.515125155f, 0.560225129f},
-std::array<float,2>{0.640663564f, 0.0805463269f},
-std::array<float,2>{0.0409588292f, 0.71734041f},
-std::array<float,2>{0.284502387f, 0.348650098f},
-std::array<float,2>{0.77970165f, 0.995931208f},
-std::array<float,2>{0.990862966f, 0.225155324f},
-std::array<float,2>{0.448554128f, 0.533303082f},
-std::array<float,2>{0.173346683f, 0.44158721f},
-std::array<float,2>{0.537889659f, 0.862931728f},
-std::array<float,2>{0.674954414f, 0.361134797f},
-std::array<float,2>{0.0242295098f, 0.970258951f},
-std::array<float,2>{0.251202762f, 0.0756151527f},
-std::array<float,2>{0.80676198f, 0.702356577f},
-std::array<float,2>{0.850595176f, 0.376045048f},
-std::array<float,2>{0.315268248f, 0.809670866f},
-std::array<float,2>{0.0759469718f, 0.165761143f},
-std::array<float,2>{0.708900273f, 0.583356559f},
-std::array<float,2>{0.585006773f, 0.0321582034f},
-std::array<float,2>{0.238918796f, 0.63813597f},
-std::array<float,2>{0.405941099f, 0.25341168f},
-std::array<float,2>{0.903250039f, 0.916906416f},
-std::array<float,2>{0.757749915f, 0.123534985f},
-std::array<float,2>{0.30543673f, 0.728225946f},
-std::array<float,2>{0.0505711138f, 0.334961146f},
-std::array<float,2>{0.626417279f, 0.967380464f},
-std::array<float,2>{0.524597585f, 0.482014418f},
-std::array<float,2>{0.144840762f, 0.817652583f},
-std::array<float,2>{0.486083686f, 0.188300565f},
-std::array<float,2>{0.945125818f, 0.50870645f},
-std::array<float,2>{0.923384905f, 0.303462118f},
-std::array<float,2>{0.430854529f, 0.904898107f},
-std::array<float,2>{0.193650812f, 0.0154984258f},
-std::array<float,2>{0.621810734f, 0.659001827f},
-std::array<float,2>{0.749759614f, 0.140442073f},
-std::array<float,2>{0.100556552f, 0.605967641f},
-std::array<float,2>{0.362707794f, 0.431932747f},
-std::array<float,2>{0.820426524f, 0.781224787f},
-std::array<float,2>{0.973383844f, 0.0449858345f},
-std::array<float,2>{0.461876988f, 0.628974974f},
-std::array<float,2>{0.156515673f, 0.258259654f},
-std::array<float,2>{0.546971917f, 0.908331156f},
-std::array<float,2>{0.662959099f, 0.383434713f},
-std::array<float,2>{0.0139045781f, 0.801589191f},
-std::array<float,2>{0.271549553f, 0.160056949f},
-std::array<float,2>{0.795202434f, 0.591092765f},
-std::array<float,2>{0.866360545f, 0.374512196f},
-std::array<float,2>{0.332138896f, 0.984141648f},
-std::array<float,2>{0.0849186927f, 0.0681928471f},
-std::array<float,2>{0.689279437f, 0.690043986f},
-std::array<float,2>{0.56863898f, 0.229870707f},
-std::array<float,2>{0.225087687f, 0.545276999f},
-std::array<float,2>{0.387460649f, 0.447089195f},
-std::array<float,2>{0.884498775f, 0.872964084f},
-std::array<float,2>{0.773835957f, 0.127714261f},
-std::array<float,2>{0.285709798f, 0.597352624f},
-std::array<float,2>{0.0443119816f, 0.42544353f},
-std::array<float,2>{0.645598471f, 0.773425281f},
-std::array<float,2>{0.510964096f, 0.306165457f},
-std::array<float,2>{0.126796588f, 0.890843868f},
-std::array<float,2>{0.474198282f, 0.00372242462f},
-std::array<float,2>{0.956013203f, 0.664334953f},
-std::array<float,2>{0.920483112f, 0.470724195f},
-std::array<float,2>{0.406665742f, 0.827340066f},
-std::array<float,2>{0.205810726f, 0.195673048f},
-std::array<float,2>{0.601255f, 0.5066064f},
-std::array<float,2>{0.723524094f, 0.110251635f},
-std::array<float,2>{0.124769531f, 0.726143658f},
-std::array<float,2>{0.357024282f, 0.339055151f},
-std::array<float,2>{0.830017626f, 0.957611382f},
-std::array<float,2>{0.902117372f, 0.205737934f},
-std::array<float,2>{0.400622278f, 0.530539274f},
-std::array<float,2>{0.237201273f, 0.492046386f},
-std::array<float,2>{0.581871629f, 0.843299389f},
-std::array<float,2>{0.704550624f, 0.316744089f},
-std::array<float,2>{0.0717988759f, 0.946052551f},
-std::array<float,2>{0.316837579f, 0.106810309f},
-std::array<float,2>{0.845579445f, 0.739840686f},
-std::array<float,2>{0.809855223f, 0.417333156f},
-std::array<float,2>{0.255085111f, 0.753538847f},
-std::array<float,2>{0.0302407667f, 0.151144117f},
-std::array<float,2>{0.677467167f, 0.610653818f},
-std::array<float,2>{0.531789958f, 0.0288496409f},
-std::array<float,2>{0.175978735f, 0.676507652f},
-std::array<float,2>{0.452910095f, 0.287037998f},
-std::array<float,2>{0.984639347f, 0.878135622f},
-std::array<float,2>{0.824642658f, 0.0900186449f},
-std::array<float,2>{0.363493174f, 0.703844607f},
-std::array<float,2>{0.0944487378f, 0.352544636f},
-std::array<float,2>{0.745329976f, 0.989230573f},
-std::array<float,2>{0.618952274f, 0.461408317f},
-std::array<float,2>{0.188709125f, 0.854976654f},
-std::array<float,2>{0.434689343f, 0.237406969f},
-std::array<float,2>{0.927587986f, 0.549236059f},
-std::array<float,2>{0.939630687f, 0.271381497f},
-std::array<float,2>{0.491861045f, 0.927407026f},
-std::array<float,2>{0.141706586f, 0.051327996f},
-std::array<float,2>{0.530084252f, 0.654010296f},
-std::array<float,2>{0.631169736f, 0.185982957f},
-std::array<float,2>{0.0524826944f, 0.568497419f},
-std::array<float,2>{0.312099397f, 0.399744809f},
-std::array<float,2>{0.752426922f, 0.7814399f},
-std::array<float,2>{0.930026472f, 0.0993535444f},
-std::array<float,2>{0.429350853f, 0.748744488f},
-std::array<float,2>{0.197444931f, 0.327262908f},
-std::array<float,2>{0.613434136f, 0.938781857f},
-std::array<float,2>{0.738996863f, 0.495798409f},
-std::array<float,2>{0.10796611f, 0.82818681f},
-std::array<float,2>{0.374390423f, 0.216579467f},
-std::array<float,2>{0.818510294f, 0.523111582f},
-std::array<float,2>{0.764324069f, 0.289668262f},
-std::array<float,2>{0.299541086f, 0.883701384f},
-std::array<float,2>{0.0581543744f, 0.0229738094f},
-std::array<float,2>{0.633855104f, 0.684480906f},
-std::array<float,2>{0.516427755f, 0.144251511f},
-std::array<float,2>{0.15213339f, 0.623754263f},
-std::array<float,2>{0.497574925f, 0.409704685f},
-std::array<float,2>{0.947918653f, 0.760626614f},
-std::array<float,2>{0.858225584f, 0.24800542f},
-std::array<float,2>{0.3215262f, 0.556918979f},
-std::array<float,2>{0.0629609004f, 0.456223756f},
-std::array<float,2>{0.712908208f, 0.850854099f},
-std::array<float,2>{0.587722123f, 0.345868349f},
-std::array<float,2>{0.244542763f, 0.996532679f},
-std::array<float,2>{0.392274886f, 0.0820328444f},
-std::array<float,2>{0.892692804f, 0.713227868f},
-std::array<float,2>{0.996932566f, 0.397249371f},
-std::array<float,2>{0.43838805f, 0.794873238f},
-std::array<float,2>{0.179807201f, 0.174249291f},
-std::array<float,2>{0.543549359f, 0.574995697f},
-std::array<float,2>{0.683788896f, 0.05750167f},
-std::array<float,2>{0.0188332424f, 0.640919685f},
-std::array<float,2>{0.263676912f, 0.27437228f},
-std::array<float,2>{0.80279994f, 0.9310776f},
-std::array<float,2>{0.963686883f, 0.168636516f},
-std::array<float,2>{0.476885438f, 0.578956068f},
-std::array<float,2>{0.136825114f, 0.381444216f},
-std::array<float,2>{0.502022862f, 0.807143688f},
-std::array<float,2>{0.654190481f, 0.254557699f},
-std::array<float,2>{0.0355613157f, 0.919067442f},
-std::array<float,2>{0.291864693f, 0.0383156873f},
-std::array<float,2>{0.766872287f, 0.634433329f},
-std::array<float,2>{0.84364301f, 0.441215664f},
-std::array<float,2>{0.345840037f, 0.863486946f},
-std::array<float,2>{0.110378958f, 0.218885556f},
-std::array<float,2>{0.734215319f, 0.536808014f},
-std::array<float,2>{0.602337122f, 0.0731838271f},
-std::array<float,2>{0.218250304f, 0.696224809f},
-std::array<float,2>{0.420816898f, 0.366388023f},
-std::array<float,2>{0.911029935f, 0.974319994f},
-std::array<float,2>{0.786860466f, 0.00942709204f},
-std::array<float,2>{0.273943633f, 0.660400569f},
-std::array<float,2>{0.00320267002f, 0.298998356f},
-std::array<float,2>{0.670217872f, 0.899277508f},
-std::array<float,2>{0.558020532f, 0.436026573f},
-std::array<float,2>{0.167425916f, 0.776658237f},
-std::array<float,2>{0.456194878f, 0.13469556f},
-std::array<float,2>{0.977755725f, 0.603968799f},
-std::array<float,2>{0.882339418f, 0.328817397f},
-std::array<float,2>{0.379662097f, 0.96308583f},
-std::array<float,2>{0.233808249f, 0.119814388f},
-std::array<float,2>{0.572554767f, 0.7320081f},
-std::array<float,2>{0.695319414f, 0.194163769f},
-std::array<float,2>{0.0915323123f, 0.514927447f},
-std::array<float,2>{0.337203532f, 0.476707131f},
-std::array<float,2>{0.870736182f, 0.814753413f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.470779568f, 0.324687451f},
-std::array<float,2>{0.945389271f, 0.57978797f},
-std::array<float,2>{0.0884921923f, 0.995196581f},
-std::array<float,2>{0.53858453f, 0.144397438f},
-std::array<float,2>{0.187284127f, 0.109153554f},
-std::array<float,2>{0.71180886f, 0.758586764f},
-std::array<float,2>{0.33173582f, 0.682545304f},
-std::array<float,2>{0.850231409f, 0.42714107f},
-std::array<float,2>{0.310693145f, 0.237381309f},
-std::array<float,2>{0.754126847f, 0.886016726f},
-std::array<float,2>{0.199597463f, 0.520640314f},
-std::array<float,2>{0.665636897f, 0.266197234f},
-std::array<float,2>{0.0539135858f, 0.481955141f},
-std::array<float,2>{0.583635151f, 0.713279963f},
-std::array<float,2>{0.402169943f, 0.844109416f},
-std::array<float,2>{0.924146831f, 0.00862106401f},
-std::array<float,2>{0.347569853f, 0.391494215f},
-std::array<float,2>{0.824402988f, 0.63588655f},
-std::array<float,2>{0.133026883f, 0.797987044f},
-std::array<float,2>{0.731807113f, 0.0881415829f},
-std::array<float,2>{0.10769102f, 0.172481865f},
-std::array<float,2>{0.530278563f, 0.953267336f},
-std::array<float,2>{0.456824303f, 0.602094829f},
-std::array<float,2>{0.972307205f, 0.373013765f},
-std::array<float,2>{0.435066521f, 0.0364633799f},
-std::array<float,2>{0.882604957f, 0.818120062f},
-std::array<float,2>{0.0250299536f, 0.738616526f},
-std::array<float,2>{0.602397561f, 0.462648362f},
-std::array<float,2>{0.24587597f, 0.307691842f},
-std::array<float,2>{0.629674256f, 0.552763939f},
-std::array<float,2>{0.264153838f, 0.931454837f},
-std::array<float,2>{0.781252503f, 0.204680249f},
-std::array<float,2>{0.388231993f, 0.438530594f},
-std::array<float,2>{0.918001115f, 0.728914618f},
-std::array<float,2>{0.0314368233f, 0.838377774f},
-std::array<float,2>{0.57012403f, 0.0603016242f},
-std::array<float,2>{0.217630476f, 0.198964089f},
-std::array<float,2>{0.67229867f, 0.914467454f},
-std::array<float,2>{0.290439099f, 0.541747749f},
-std::array<float,2>{0.774173737f, 0.286551267f},
-std::array<float,2>{0.319112599f, 0.0710588396f},
-std::array<float,2>{0.865307152f, 0.787406325f},
-std::array<float,2>{0.16307582f, 0.650669634f},
-std::array<float,2>{0.69089222f, 0.388926357f},
-std::array<float,2>{0.0761942267f, 0.354561716f},
-std::array<float,2>{0.548050225f, 0.609425843f},
-std::array<float,2>{0.499268889f, 0.95029521f},
-std::array<float,2>{0.960883141f, 0.15795365f},
-std::array<float,2>{0.27998355f, 0.262328506f},
-std::array<float,2>{0.798057377f, 0.511101961f},
-std::array<float,2>{0.226963535f, 0.904223382f},
-std::array<float,2>{0.640971661f, 0.226547956f},
-std::array<float,2>{0.0150325457f, 0.0246242024f},
-std::array<float,2>{0.618284881f, 0.863921523f},
-std::array<float,2>{0.417445421f, 0.690021873f},
-std::array<float,2>{0.890672743f, 0.490277678f},
-std::array<float,2>{0.444520384f, 0.127473027f},
-std::array<float,2>{0.987065494f, 0.97235322f},
-std::array<float,2>{0.123179354f, 0.569536448f},
-std::array<float,2>{0.500484169f, 0.335104138f},
-std::array<float,2>{0.149815887f, 0.420665175f},
-std::array<float,2>{0.747289777f, 0.670580387f},
-std::array<float,2>{0.367231756f, 0.778307378f},
-std::array<float,2>{0.842095554f, 0.124918237f},
-std::array<float,2>{0.40919745f, 0.295360386f},
-std::array<float,2>{0.901289582f, 0.537499309f},
-std::array<float,2>{0.00214131665f, 0.908688962f},
-std::array<float,2>{0.616579711f, 0.19249329f},
-std::array<float,2>{0.220581487f, 0.0536252558f},
-std::array<float,2>{0.650119126f, 0.83421737f},
-std::array<float,2>{0.268121928f, 0.725138307f},
-std::array<float,2>{0.805736065f, 0.449473768f},
-std::array<float,2>{0.364426136f, 0.170215309f},
-std::array<float,2>{0.832496583f, 0.939991653f},
-std::array<float,2>{0.147042468f, 0.618151248f},
-std::array<float,2>{0.734526217f, 0.345559001f},
-std::array<float,2>{0.109743871f, 0.376352906f},
-std::array<float,2>{0.511846483f, 0.645581961f},
-std::array<float,2>{0.448550016f, 0.792863965f},
-std::array<float,2>{0.993092835f, 0.0671675652f},
-std::array<float,2>{0.285672635f, 0.494031161f},
-std::array<float,2>{0.768079877f, 0.697147369f},
-std::array<float,2>{0.203275651f, 0.869731903f},
-std::array<float,2>{0.683962286f, 0.0233508479f},
-std::array<float,2>{0.0428581312f, 0.231397912f},
-std::array<float,2>{0.572203159f, 0.89219135f},
-std::array<float,2>{0.381693661f, 0.503094435f},
-std::array<float,2>{0.914048374f, 0.254974663f},
-std::array<float,2>{0.485135019f, 0.111421086f},
-std::array<float,2>{0.968407154f, 0.770666003f},
-std::array<float,2>{0.0631069392f, 0.658964217f},
-std::array<float,2>{0.555118024f, 0.410450369f},
-std::array<float,2>{0.170072779f, 0.338302672f},
-std::array<float,2>{0.695749283f, 0.570559561f},
-std::array<float,2>{0.322397262f, 0.977905214f},
-std::array<float,2>{0.867850304f, 0.138280064f},
-std::array<float,2>{0.468734205f, 0.432095587f},
-std::array<float,2>{0.979995906f, 0.677665949f},
-std::array<float,2>{0.0963980183f, 0.756453037f},
-std::array<float,2>{0.517667115f, 0.0964075029f},
-std::array<float,2>{0.126860663f, 0.156059995f},
-std::array<float,2>{0.726263463f, 0.984663188f},
-std::array<float,2>{0.355599552f, 0.591675401f},
-std::array<float,2>{0.819857419f, 0.315252215f},
-std::array<float,2>{0.251049519f, 0.00642597675f},
-std::array<float,2>{0.792045116f, 0.856705606f},
-std::array<float,2>{0.237607613f, 0.703246653f},
-std::array<float,2>{0.636813343f, 0.474081963f},
-std::array<float,2>{0.0227728002f, 0.279073566f},
-std::array<float,2>{0.593916416f, 0.523759007f},
-std::array<float,2>{0.42271322f, 0.877425671f},
-std::array<float,2>{0.88947165f, 0.246782035f},
-std::array<float,2>{0.337998211f, 0.360596001f},
-std::array<float,2>{0.852870822f, 0.594759703f},
-std::array<float,2>{0.173467085f, 0.964813888f},
-std::array<float,2>{0.707617164f, 0.180977434f},
-std::array<float,2>{0.0821334049f, 0.0832564756f},
-std::array<float,2>{0.539543509f, 0.809289813f},
-std::array<float,2>{0.480370134f, 0.631882012f},
-std::array<float,2>{0.941973865f, 0.398929238f},
-std::array<float,2>{0.39638418f, 0.217485026f},
-std::array<float,2>{0.935489058f, 0.924495816f},
-std::array<float,2>{0.0604206957f, 0.557216585f},
-std::array<float,2>{0.59006381f, 0.298617393f},
-std::array<float,2>{0.188380867f, 0.460850686f},
-std::array<float,2>{0.657915413f, 0.744304061f},
-std::array<float,2>{0.303498596f, 0.821380258f},
-std::array<float,2>{0.758291483f, 0.0447937474f},
-std::array<float,2>{0.452061594f, 0.273425192f},
-std::array<float,2>{0.998273313f, 0.518787205f},
-std::array<float,2>{0.117145255f, 0.887808859f},
-std::array<float,2>{0.510431111f, 0.241467163f},
-std::array<float,2>{0.143267855f, 0.0117697427f},
-std::array<float,2>{0.738342047f, 0.849117637f},
-std::array<float,2>{0.363249898f, 0.716842592f},
-std::array<float,2>{0.831017256f, 0.47712177f},
-std::array<float,2>{0.272760659f, 0.144689932f},
-std::array<float,2>{0.810617685f, 0.997440875f},
-std::array<float,2>{0.222746566f, 0.582657397f},
-std::array<float,2>{0.654064596f, 0.32353285f},
-std::array<float,2>{0.00766171934f, 0.424751192f},
-std::array<float,2>{0.60950458f, 0.686554551f},
-std::array<float,2>{0.411671907f, 0.762210369f},
-std::array<float,2>{0.9042961f, 0.10274332f},
-std::array<float,2>{0.325169802f, 0.467594653f},
-std::array<float,2>{0.87153089f, 0.736834645f},
-std::array<float,2>{0.165932402f, 0.812994599f},
-std::array<float,2>{0.701143026f, 0.033683978f},
-std::array<float,2>{0.0677708387f, 0.208009616f},
-std::array<float,2>{0.558731675f, 0.935734093f},
-std::array<float,2>{0.490734786f, 0.547588348f},
-std::array<float,2>{0.962214231f, 0.30948931f},
-std::array<float,2>{0.378791034f, 0.0906601697f},
-std::array<float,2>{0.910095513f, 0.803354681f},
-std::array<float,2>{0.0458813608f, 0.640502453f},
-std::array<float,2>{0.578068197f, 0.396658301f},
-std::array<float,2>{0.209060997f, 0.367491275f},
-std::array<float,2>{0.68305999f, 0.60576129f},
-std::array<float,2>{0.282749861f, 0.959582686f},
-std::array<float,2>{0.772048235f, 0.176584944f},
-std::array<float,2>{0.42959854f, 0.383747697f},
-std::array<float,2>{0.884019434f, 0.652696371f},
-std::array<float,2>{0.016720593f, 0.782834768f},
-std::array<float,2>{0.598417521f, 0.0766321123f},
-std::array<float,2>{0.239602163f, 0.160564363f},
-std::array<float,2>{0.633291841f, 0.94539547f},
-std::array<float,2>{0.254579782f, 0.613651454f},
-std::array<float,2>{0.795072675f, 0.356251955f},
-std::array<float,2>{0.355392128f, 0.0548310131f},
-std::array<float,2>{0.81625849f, 0.841997027f},
-std::array<float,2>{0.131356865f, 0.733359516f},
-std::array<float,2>{0.720742047f, 0.444882333f},
-std::array<float,2>{0.101282731f, 0.282381952f},
-std::array<float,2>{0.520373106f, 0.545875728f},
-std::array<float,2>{0.462138921f, 0.920616388f},
-std::array<float,2>{0.982376158f, 0.202039212f},
-std::array<float,2>{0.300700128f, 0.331795692f},
-std::array<float,2>{0.764829516f, 0.563587129f},
-std::array<float,2>{0.194578409f, 0.974520683f},
-std::array<float,2>{0.663231492f, 0.130635992f},
-std::array<float,2>{0.0573125854f, 0.119774111f},
-std::array<float,2>{0.589158297f, 0.776031256f},
-std::array<float,2>{0.392746329f, 0.664685905f},
-std::array<float,2>{0.930259109f, 0.416419953f},
-std::array<float,2>{0.482207328f, 0.219921038f},
-std::array<float,2>{0.941288233f, 0.899365306f},
-std::array<float,2>{0.079962559f, 0.513499439f},
-std::array<float,2>{0.543978035f, 0.260765851f},
-std::array<float,2>{0.178982779f, 0.485333174f},
-std::array<float,2>{0.705336452f, 0.695063233f},
-std::array<float,2>{0.342285275f, 0.863169909f},
-std::array<float,2>{0.857717693f, 0.0278613586f},
-std::array<float,2>{0.40486446f, 0.349910021f},
-std::array<float,2>{0.929646134f, 0.622110844f},
-std::array<float,2>{0.0474809967f, 0.942133904f},
-std::array<float,2>{0.581221998f, 0.166733846f},
-std::array<float,2>{0.198708475f, 0.0627935082f},
-std::array<float,2>{0.668613493f, 0.793375015f},
-std::array<float,2>{0.306456178f, 0.641635239f},
-std::array<float,2>{0.75133425f, 0.380261987f},
-std::array<float,2>{0.335175782f, 0.190443799f},
-std::array<float,2>{0.84640795f, 0.913297057f},
-std::array<float,2>{0.181221545f, 0.53137207f},
-std::array<float,2>{0.714953899f, 0.289863318f},
-std::array<float,2>{0.0917734131f, 0.448724002f},
-std::array<float,2>{0.533647776f, 0.721189559f},
-std::array<float,2>{0.473866969f, 0.830395758f},
-std::array<float,2>{0.950960517f, 0.0488394164f},
-std::array<float,2>{0.26034376f, 0.407825351f},
-std::array<float,2>{0.785920382f, 0.662962854f},
-std::array<float,2>{0.246847034f, 0.76745677f},
-std::array<float,2>{0.625121951f, 0.113294274f},
-std::array<float,2>{0.0282471757f, 0.133464456f},
-std::array<float,2>{0.607071221f, 0.983077347f},
-std::array<float,2>{0.432543039f, 0.577022433f},
-std::array<float,2>{0.876107693f, 0.34172532f},
-std::array<float,2>{0.458759934f, 0.0177550372f},
-std::array<float,2>{0.97568965f, 0.873156786f},
-std::array<float,2>{0.103314392f, 0.700989902f},
-std::array<float,2>{0.527125895f, 0.496638536f},
-std::array<float,2>{0.137849793f, 0.251853794f},
-std::array<float,2>{0.726812482f, 0.504364371f},
-std::array<float,2>{0.349275589f, 0.897460043f},
-std::array<float,2>{0.82197845f, 0.228233859f},
-std::array<float,2>{0.494651377f, 0.469989955f},
-std::array<float,2>{0.954241395f, 0.708965003f},
-std::array<float,2>{0.0735109001f, 0.855356097f},
-std::array<float,2>{0.552964032f, 0.00383840315f},
-std::array<float,2>{0.156483278f, 0.243890241f},
-std::array<float,2>{0.694853902f, 0.880861461f},
-std::array<float,2>{0.315629154f, 0.52838695f},
-std::array<float,2>{0.862369955f, 0.277310938f},
-std::array<float,2>{0.294619679f, 0.0982419401f},
-std::array<float,2>{0.778948128f, 0.751244307f},
-std::array<float,2>{0.212530673f, 0.673183262f},
-std::array<float,2>{0.675793707f, 0.43385765f},
-std::array<float,2>{0.0372535624f, 0.316412717f},
-std::array<float,2>{0.564837158f, 0.588309526f},
-std::array<float,2>{0.384156048f, 0.992094159f},
-std::array<float,2>{0.917363405f, 0.151784748f},
-std::array<float,2>{0.373782367f, 0.302459568f},
-std::array<float,2>{0.836636722f, 0.561127543f},
-std::array<float,2>{0.154636234f, 0.928571284f},
-std::array<float,2>{0.745345652f, 0.212914273f},
-std::array<float,2>{0.119777396f, 0.0394374505f},
-std::array<float,2>{0.506278455f, 0.825604916f},
-std::array<float,2>{0.441032946f, 0.746439874f},
-std::array<float,2>{0.989257455f, 0.453785449f},
-std::array<float,2>{0.418581277f, 0.187191904f},
-std::array<float,2>{0.894739985f, 0.965358675f},
-std::array<float,2>{0.0116459485f, 0.600419521f},
-std::array<float,2>{0.622928143f, 0.367163688f},
-std::array<float,2>{0.232258275f, 0.406031728f},
-std::array<float,2>{0.644747019f, 0.625028431f},
-std::array<float,2>{0.273802251f, 0.804689348f},
-std::array<float,2>{0.800880671f, 0.0800708011f},
-std::array<float,2>{0.454157621f, 0.373708457f},
-std::array<float,2>{0.969962955f, 0.604319155f},
-std::array<float,2>{0.105813764f, 0.955409467f},
-std::array<float,2>{0.528513134f, 0.17475155f},
-std::array<float,2>{0.135429218f, 0.0859645084f},
-std::array<float,2>{0.7328071f, 0.800725996f},
-std::array<float,2>{0.345414281f, 0.633258224f},
-std::array<float,2>{0.826906204f, 0.393848002f},
-std::array<float,2>{0.263159454f, 0.206528068f},
-std::array<float,2>{0.783513129f, 0.933038056f},
-std::array<float,2>{0.243703842f, 0.550991178f},
-std::array<float,2>{0.631481469f, 0.305319279f},
-std::array<float,2>{0.0253934171f, 0.464032382f},
-std::array<float,2>{0.605092168f, 0.740346193f},
-std::array<float,2>{0.435974926f, 0.819544256f},
-std::array<float,2>{0.879397571f, 0.0378395468f},
-std::array<float,2>{0.329710543f, 0.428173572f},
-std::array<float,2>{0.848395407f, 0.679899037f},
-std::array<float,2>{0.185240299f, 0.760665953f},
-std::array<float,2>{0.714558363f, 0.106135122f},
-std::array<float,2>{0.0868920982f, 0.140710846f},
-std::array<float,2>{0.536572874f, 0.993538797f},
-std::array<float,2>{0.469920188f, 0.580724478f},
-std::array<float,2>{0.947643638f, 0.327576786f},
-std::array<float,2>{0.400010228f, 0.0104375277f},
-std::array<float,2>{0.923114061f, 0.847143471f},
-std::array<float,2>{0.0526238866f, 0.711818099f},
-std::array<float,2>{0.584377348f, 0.483767033f},
-std::array<float,2>{0.201213971f, 0.268989921f},
-std::array<float,2>{0.666488588f, 0.521912336f},
-std::array<float,2>{0.308745623f, 0.883380413f},
-std::array<float,2>{0.756635427f, 0.235122874f},
-std::array<float,2>{0.415765524f, 0.489281833f},
-std::array<float,2>{0.893980563f, 0.689256072f},
-std::array<float,2>{0.0119102625f, 0.867002428f},
-std::array<float,2>{0.619550288f, 0.0256386157f},
-std::array<float,2>{0.230174825f, 0.224197492f},
-std::array<float,2>{0.643365324f, 0.904702127f},
-std::array<float,2>{0.278549016f, 0.508507311f},
-std::array<float,2>{0.800650299f, 0.263989419f},
-std::array<float,2>{0.37002182f, 0.121521816f},
-std::array<float,2>{0.840782881f, 0.780155063f},
-std::array<float,2>{0.150645271f, 0.669766784f},
-std::array<float,2>{0.749334872f, 0.419224948f},
-std::array<float,2>{0.122661501f, 0.33362636f},
-std::array<float,2>{0.502405822f, 0.566732347f},
-std::array<float,2>{0.442390621f, 0.970009506f},
-std::array<float,2>{0.985597372f, 0.126527429f},
-std::array<float,2>{0.291745961f, 0.287611753f},
-std::array<float,2>{0.775911033f, 0.540604711f},
-std::array<float,2>{0.215712503f, 0.916654587f},
-std::array<float,2>{0.673952937f, 0.196582332f},
-std::array<float,2>{0.0333491974f, 0.0619265884f},
-std::array<float,2>{0.567078829f, 0.83661145f},
-std::array<float,2>{0.388774455f, 0.727493227f},
-std::array<float,2>{0.921377242f, 0.441123307f},
-std::array<float,2>{0.496246099f, 0.159530938f},
-std::array<float,2>{0.957440197f, 0.952778816f},
-std::array<float,2>{0.0748679191f, 0.612369359f},
-std::array<float,2>{0.550139785f, 0.35156703f},
-std::array<float,2>{0.161989301f, 0.388057619f},
-std::array<float,2>{0.687755764f, 0.649533391f},
-std::array<float,2>{0.317900628f, 0.785588205f},
-std::array<float,2>{0.863754034f, 0.0742112771f},
-std::array<float,2>{0.380418956f, 0.257199138f},
-std::array<float,2>{0.911074638f, 0.501529098f},
-std::array<float,2>{0.040890865f, 0.892931223f},
-std::array<float,2>{0.573772609f, 0.233659923f},
-std::array<float,2>{0.205564693f, 0.0206105057f},
-std::array<float,2>{0.685843289f, 0.867269635f},
-std::array<float,2>{0.287637174f, 0.699014246f},
-std::array<float,2>{0.765680611f, 0.495266497f},
-std::array<float,2>{0.321866155f, 0.138921961f},
-std::array<float,2>{0.869347751f, 0.979165435f},
-std::array<float,2>{0.169788286f, 0.574156463f},
-std::array<float,2>{0.699111998f, 0.337513536f},
-std::array<float,2>{0.0650078356f, 0.41256845f},
-std::array<float,2>{0.556915939f, 0.657294691f},
-std::array<float,2>{0.486765236f, 0.772116184f},
-std::array<float,2>{0.96488589f, 0.110875569f},
-std::array<float,2>{0.267169356f, 0.451599866f},
-std::array<float,2>{0.807238698f, 0.724357426f},
-std::array<float,2>{0.221864581f, 0.833606541f},
-std::array<float,2>{0.65193063f, 0.0516875759f},
-std::array<float,2>{0.000556742714f, 0.195113719f},
-std::array<float,2>{0.614029706f, 0.907905161f},
-std::array<float,2>{0.407789409f, 0.536408544f},
-std::array<float,2>{0.900147796f, 0.293687344f},
-std::array<float,2>{0.447155416f, 0.0701664388f},
-std::array<float,2>{0.994416118f, 0.789212286f},
-std::array<float,2>{0.111794911f, 0.647435248f},
-std::array<float,2>{0.514490187f, 0.378713965f},
-std::array<float,2>{0.144679725f, 0.346321285f},
-std::array<float,2>{0.738182306f, 0.620802701f},
-std::array<float,2>{0.366438061f, 0.939064682f},
-std::array<float,2>{0.834567964f, 0.169767335f},
-std::array<float,2>{0.476572722f, 0.40124625f},
-std::array<float,2>{0.944565058f, 0.62900573f},
-std::array<float,2>{0.0858050063f, 0.812393427f},
-std::array<float,2>{0.542815268f, 0.084478952f},
-std::array<float,2>{0.174921826f, 0.18250072f},
-std::array<float,2>{0.710384488f, 0.960968733f},
-std::array<float,2>{0.336685181f, 0.596363246f},
-std::array<float,2>{0.855302155f, 0.362698942f},
-std::array<float,2>{0.302144915f, 0.0466436259f},
-std::array<float,2>{0.760037303f, 0.823638976f},
-std::array<float,2>{0.190825939f, 0.744105518f},
-std::array<float,2>{0.658776999f, 0.45795545f},
-std::array<float,2>{0.0606468357f, 0.300080329f},
-std::array<float,2>{0.593333364f, 0.555700839f},
-std::array<float,2>{0.396757782f, 0.92367965f},
-std::array<float,2>{0.935576677f, 0.214876041f},
-std::array<float,2>{0.357817829f, 0.312999725f},
-std::array<float,2>{0.818146884f, 0.593645215f},
-std::array<float,2>{0.127934545f, 0.988101661f},
-std::array<float,2>{0.722765326f, 0.153200537f},
-std::array<float,2>{0.0951585472f, 0.095529221f},
-std::array<float,2>{0.51595974f, 0.754787564f},
-std::array<float,2>{0.466018409f, 0.678935945f},
-std::array<float,2>{0.977079451f, 0.430027634f},
-std::array<float,2>{0.425759286f, 0.2481765f},
-std::array<float,2>{0.887663841f, 0.875158787f},
-std::array<float,2>{0.0203070845f, 0.526681781f},
-std::array<float,2>{0.597430587f, 0.280127794f},
-std::array<float,2>{0.236271814f, 0.475109369f},
-std::array<float,2>{0.640191197f, 0.706383884f},
-std::array<float,2>{0.252922893f, 0.858365238f},
-std::array<float,2>{0.789977133f, 0.00577091239f},
-std::array<float,2>{0.488735646f, 0.31077221f},
-std::array<float,2>{0.96326375f, 0.549289763f},
-std::array<float,2>{0.0696907565f, 0.934405267f},
-std::array<float,2>{0.561817706f, 0.210921273f},
-std::array<float,2>{0.167185307f, 0.0327922367f},
-std::array<float,2>{0.702105224f, 0.815720499f},
-std::array<float,2>{0.328052312f, 0.735060573f},
-std::array<float,2>{0.874068201f, 0.466010481f},
-std::array<float,2>{0.284197003f, 0.177920461f},
-std::array<float,2>{0.771200716f, 0.957274079f},
-std::array<float,2>{0.208628669f, 0.609327614f},
-std::array<float,2>{0.680944622f, 0.36950779f},
-std::array<float,2>{0.0439712442f, 0.395578027f},
-std::array<float,2>{0.575588048f, 0.638442218f},
-std::array<float,2>{0.376774818f, 0.801442623f},
-std::array<float,2>{0.907835722f, 0.0930357054f},
-std::array<float,2>{0.360764652f, 0.47900486f},
-std::array<float,2>{0.829533339f, 0.715900183f},
-std::array<float,2>{0.142257929f, 0.850760818f},
-std::array<float,2>{0.740443051f, 0.0137291085f},
-std::array<float,2>{0.113753214f, 0.238929629f},
-std::array<float,2>{0.508784652f, 0.88910675f},
-std::array<float,2>{0.450526685f, 0.516221821f},
-std::array<float,2>{0.997625709f, 0.271285683f},
-std::array<float,2>{0.413659185f, 0.103682905f},
-std::array<float,2>{0.904520631f, 0.764027596f},
-std::array<float,2>{0.00519043067f, 0.685347855f},
-std::array<float,2>{0.613007724f, 0.42322585f},
-std::array<float,2>{0.225022957f, 0.320388258f},
-std::array<float,2>{0.655891955f, 0.58563596f},
-std::array<float,2>{0.270589322f, 0.999956787f},
-std::array<float,2>{0.809312284f, 0.147642732f},
-std::array<float,2>{0.392118871f, 0.414944828f},
-std::array<float,2>{0.933213949f, 0.666465163f},
-std::array<float,2>{0.0549403615f, 0.773831069f},
-std::array<float,2>{0.587568402f, 0.118539482f},
-std::array<float,2>{0.192685038f, 0.131139606f},
-std::array<float,2>{0.660424709f, 0.974688113f},
-std::array<float,2>{0.297204375f, 0.564634621f},
-std::array<float,2>{0.762621343f, 0.329463124f},
-std::array<float,2>{0.341366559f, 0.0300185382f},
-std::array<float,2>{0.855953455f, 0.86068505f},
-std::array<float,2>{0.177152976f, 0.693338096f},
-std::array<float,2>{0.705057144f, 0.486738026f},
-std::array<float,2>{0.0808077604f, 0.259471565f},
-std::array<float,2>{0.546143711f, 0.515422404f},
-std::array<float,2>{0.483235627f, 0.90049094f},
-std::array<float,2>{0.938538611f, 0.222198665f},
-std::array<float,2>{0.255937606f, 0.358740509f},
-std::array<float,2>{0.793830395f, 0.61629504f},
-std::array<float,2>{0.242034018f, 0.94858098f},
-std::array<float,2>{0.634881318f, 0.1623175f},
-std::array<float,2>{0.0195205212f, 0.0750315115f},
-std::array<float,2>{0.600105643f, 0.784124851f},
-std::array<float,2>{0.425788462f, 0.655195773f},
-std::array<float,2>{0.886279523f, 0.384859115f},
-std::array<float,2>{0.464377254f, 0.199534133f},
-std::array<float,2>{0.983987391f, 0.918644428f},
-std::array<float,2>{0.0990185291f, 0.544215977f},
-std::array<float,2>{0.522870481f, 0.284923822f},
-std::array<float,2>{0.129101828f, 0.443340331f},
-std::array<float,2>{0.720202088f, 0.731425285f},
-std::array<float,2>{0.352255195f, 0.840892076f},
-std::array<float,2>{0.813912332f, 0.0585210733f},
-std::array<float,2>{0.431343824f, 0.342538059f},
-std::array<float,2>{0.878158569f, 0.574827373f},
-std::array<float,2>{0.0300758909f, 0.981602013f},
-std::array<float,2>{0.608112931f, 0.135000065f},
-std::array<float,2>{0.249801502f, 0.116795838f},
-std::array<float,2>{0.627544463f, 0.768216431f},
-std::array<float,2>{0.258365899f, 0.660759807f},
-std::array<float,2>{0.788794458f, 0.408748448f},
-std::array<float,2>{0.350913286f, 0.230258539f},
-std::array<float,2>{0.822555959f, 0.895908892f},
-std::array<float,2>{0.140522689f, 0.507594645f},
-std::array<float,2>{0.729093373f, 0.25334695f},
-std::array<float,2>{0.103639305f, 0.498356462f},
-std::array<float,2>{0.524483204f, 0.702399969f},
-std::array<float,2>{0.460236102f, 0.87245667f},
-std::array<float,2>{0.974593341f, 0.0167253315f},
-std::array<float,2>{0.308486193f, 0.381305039f},
-std::array<float,2>{0.752544641f, 0.643942773f},
-std::array<float,2>{0.197254792f, 0.795943558f},
-std::array<float,2>{0.670216978f, 0.0646291599f},
-std::array<float,2>{0.0503245071f, 0.165846676f},
-std::array<float,2>{0.5791381f, 0.943572104f},
-std::array<float,2>{0.403536499f, 0.624218941f},
-std::array<float,2>{0.926827669f, 0.348402619f},
-std::array<float,2>{0.476157904f, 0.0470402688f},
-std::array<float,2>{0.952509642f, 0.828886867f},
-std::array<float,2>{0.093236126f, 0.720317841f},
-std::array<float,2>{0.532261729f, 0.445327014f},
-std::array<float,2>{0.182333261f, 0.292451441f},
-std::array<float,2>{0.718232572f, 0.535126925f},
-std::array<float,2>{0.333448082f, 0.911461473f},
-std::array<float,2>{0.844336569f, 0.187563583f},
-std::array<float,2>{0.437822133f, 0.455801308f},
-std::array<float,2>{0.991969407f, 0.748163104f},
-std::array<float,2>{0.118712045f, 0.827280581f},
-std::array<float,2>{0.504005313f, 0.0424479693f},
-std::array<float,2>{0.15265812f, 0.211760953f},
-std::array<float,2>{0.742419541f, 0.927248955f},
-std::array<float,2>{0.37276721f, 0.558605492f},
-std::array<float,2>{0.839312375f, 0.303428769f},
-std::array<float,2>{0.276319295f, 0.0804554075f},
-std::array<float,2>{0.804627776f, 0.808007479f},
-std::array<float,2>{0.233169228f, 0.627747297f},
-std::array<float,2>{0.648023367f, 0.402354926f},
-std::array<float,2>{0.0083700791f, 0.364428133f},
-std::array<float,2>{0.624465704f, 0.598721325f},
-std::array<float,2>{0.419942886f, 0.967963636f},
-std::array<float,2>{0.89780432f, 0.184793591f},
-std::array<float,2>{0.313122272f, 0.273520529f},
-std::array<float,2>{0.859581649f, 0.530628026f},
-std::array<float,2>{0.158357173f, 0.880745351f},
-std::array<float,2>{0.693137348f, 0.244703472f},
-std::array<float,2>{0.0714638904f, 0.00136191887f},
-std::array<float,2>{0.551316082f, 0.853488982f},
-std::array<float,2>{0.493395865f, 0.709086359f},
-std::array<float,2>{0.95657146f, 0.47250703f},
-std::array<float,2>{0.385303915f, 0.149279892f},
-std::array<float,2>{0.914895535f, 0.988456726f},
-std::array<float,2>{0.035753604f, 0.586819172f},
-std::array<float,2>{0.562590837f, 0.318753183f},
-std::array<float,2>{0.213325292f, 0.435868025f},
-std::array<float,2>{0.678534329f, 0.674216807f},
-std::array<float,2>{0.29600808f, 0.753227293f},
-std::array<float,2>{0.78112632f, 0.0996965617f},
-std::array<float,2>{0.44143644f, 0.334313333f},
-std::array<float,2>{0.984462619f, 0.568362713f},
-std::array<float,2>{0.121568151f, 0.970869482f},
-std::array<float,2>{0.503647625f, 0.128261819f},
-std::array<float,2>{0.152142927f, 0.123449318f},
-std::array<float,2>{0.748762488f, 0.778537214f},
-std::array<float,2>{0.370536804f, 0.671364903f},
-std::array<float,2>{0.841113448f, 0.421666026f},
-std::array<float,2>{0.278258741f, 0.225074112f},
-std::array<float,2>{0.79945749f, 0.902782619f},
-std::array<float,2>{0.229350626f, 0.510673344f},
-std::array<float,2>{0.644392073f, 0.263345122f},
-std::array<float,2>{0.012757333f, 0.491240412f},
-std::array<float,2>{0.620256841f, 0.690875351f},
-std::array<float,2>{0.414608657f, 0.8646245f},
-std::array<float,2>{0.892727137f, 0.0239477139f},
-std::array<float,2>{0.317335695f, 0.390541822f},
-std::array<float,2>{0.865181625f, 0.651632905f},
-std::array<float,2>{0.160739496f, 0.788798034f},
-std::array<float,2>{0.689120233f, 0.0718353391f},
-std::array<float,2>{0.0756177604f, 0.157034069f},
-std::array<float,2>{0.549014688f, 0.949816346f},
-std::array<float,2>{0.497546613f, 0.611196458f},
-std::array<float,2>{0.958526552f, 0.353829622f},
-std::array<float,2>{0.390394807f, 0.0593273975f},
-std::array<float,2>{0.92022717f, 0.839771569f},
-std::array<float,2>{0.0344874747f, 0.729785562f},
-std::array<float,2>{0.567463338f, 0.43763721f},
-std::array<float,2>{0.216332003f, 0.285812259f},
-std::array<float,2>{0.674827754f, 0.542154372f},
-std::array<float,2>{0.292556673f, 0.915762544f},
-std::array<float,2>{0.776612878f, 0.198183045f},
-std::array<float,2>{0.436840147f, 0.461077601f},
-std::array<float,2>{0.880281925f, 0.739827216f},
-std::array<float,2>{0.0272582043f, 0.817097723f},
-std::array<float,2>{0.604312599f, 0.0356953666f},
-std::array<float,2>{0.242468193f, 0.203413233f},
-std::array<float,2>{0.632131815f, 0.930103242f},
-std::array<float,2>{0.261726379f, 0.553852856f},
-std::array<float,2>{0.784800112f, 0.306832999f},
-std::array<float,2>{0.344474792f, 0.0897925273f},
-std::array<float,2>{0.827485502f, 0.797380686f},
-std::array<float,2>{0.13581048f, 0.634898603f},
-std::array<float,2>{0.733834803f, 0.392273009f},
-std::array<float,2>{0.107078128f, 0.371517062f},
-std::array<float,2>{0.52784878f, 0.602952421f},
-std::array<float,2>{0.453773081f, 0.954759896f},
-std::array<float,2>{0.968959033f, 0.172876f},
-std::array<float,2>{0.309675097f, 0.266772538f},
-std::array<float,2>{0.757671237f, 0.519976437f},
-std::array<float,2>{0.203028873f, 0.885005295f},
-std::array<float,2>{0.66770649f, 0.237260073f},
-std::array<float,2>{0.0510679521f, 0.00961045828f},
-std::array<float,2>{0.58557266f, 0.845002353f},
-std::array<float,2>{0.399283916f, 0.713879585f},
-std::array<float,2>{0.92196846f, 0.481211632f},
-std::array<float,2>{0.469371647f, 0.142730132f},
-std::array<float,2>{0.948884606f, 0.9949404f},
-std::array<float,2>{0.086975731f, 0.578726411f},
-std::array<float,2>{0.535654843f, 0.325703442f},
-std::array<float,2>{0.184071705f, 0.426344872f},
-std::array<float,2>{0.713505805f, 0.683538616f},
-std::array<float,2>{0.3286874f, 0.75879842f},
-std::array<float,2>{0.849434257f, 0.10832762f},
-std::array<float,2>{0.397708952f, 0.29732728f},
-std::array<float,2>{0.937260509f, 0.557998538f},
-std::array<float,2>{0.0616062954f, 0.925732911f},
-std::array<float,2>{0.592252493f, 0.218022674f},
-std::array<float,2>{0.190040067f, 0.0435513109f},
-std::array<float,2>{0.659359455f, 0.821033418f},
-std::array<float,2>{0.301606208f, 0.745595038f},
-std::array<float,2>{0.761484027f, 0.459234148f},
-std::array<float,2>{0.33732149f, 0.179828331f},
-std::array<float,2>{0.853702009f, 0.963295937f},
-std::array<float,2>{0.173828676f, 0.594725311f},
-std::array<float,2>{0.709277332f, 0.359548867f},
-std::array<float,2>{0.084901832f, 0.399972379f},
-std::array<float,2>{0.541353166f, 0.6318295f},
-std::array<float,2>{0.478359044f, 0.809753776f},
-std::array<float,2>{0.944198012f, 0.0822740495f},
-std::array<float,2>{0.253034353f, 0.473516285f},
-std::array<float,2>{0.790449917f, 0.70486033f},
-std::array<float,2>{0.235169426f, 0.856167018f},
-std::array<float,2>{0.638769567f, 0.00776633993f},
-std::array<float,2>{0.020991819f, 0.247627378f},
-std::array<float,2>{0.596168816f, 0.878522158f},
-std::array<float,2>{0.424576819f, 0.525110781f},
-std::array<float,2>{0.887897551f, 0.277504653f},
-std::array<float,2>{0.465242326f, 0.0967401117f},
-std::array<float,2>{0.978381515f, 0.757240117f},
-std::array<float,2>{0.0945231393f, 0.676459551f},
-std::array<float,2>{0.516848922f, 0.432634354f},
-std::array<float,2>{0.127819687f, 0.316375166f},
-std::array<float,2>{0.723988116f, 0.590443015f},
-std::array<float,2>{0.358840704f, 0.986291885f},
-std::array<float,2>{0.816409647f, 0.15516454f},
-std::array<float,2>{0.487513304f, 0.411944956f},
-std::array<float,2>{0.966079354f, 0.66014719f},
-std::array<float,2>{0.0661416948f, 0.770097911f},
-std::array<float,2>{0.55800283f, 0.113031551f},
-std::array<float,2>{0.16870971f, 0.137616798f},
-std::array<float,2>{0.697840929f, 0.977538824f},
-std::array<float,2>{0.321094841f, 0.571457982f},
-std::array<float,2>{0.870575547f, 0.339220852f},
-std::array<float,2>{0.288583338f, 0.0214861017f},
-std::array<float,2>{0.766781688f, 0.870229423f},
-std::array<float,2>{0.206846744f, 0.695509732f},
-std::array<float,2>{0.687068641f, 0.49245131f},
-std::array<float,2>{0.0398184992f, 0.254786968f},
-std::array<float,2>{0.573161185f, 0.502388179f},
-std::array<float,2>{0.378912538f, 0.891474724f},
-std::array<float,2>{0.912075222f, 0.232213929f},
-std::array<float,2>{0.365715683f, 0.343955308f},
-std::array<float,2>{0.83564198f, 0.618453264f},
-std::array<float,2>{0.145824194f, 0.940667748f},
-std::array<float,2>{0.736819148f, 0.171525374f},
-std::array<float,2>{0.112325996f, 0.0675455555f},
-std::array<float,2>{0.515269399f, 0.791584551f},
-std::array<float,2>{0.445955276f, 0.645014048f},
-std::array<float,2>{0.995616138f, 0.37507391f},
-std::array<float,2>{0.406335711f, 0.192198768f},
-std::array<float,2>{0.898504436f, 0.909186006f},
-std::array<float,2>{0.00140806264f, 0.53846103f},
-std::array<float,2>{0.614259124f, 0.296674371f},
-std::array<float,2>{0.220852971f, 0.450624615f},
-std::array<float,2>{0.651000917f, 0.726098001f},
-std::array<float,2>{0.265839458f, 0.835370183f},
-std::array<float,2>{0.808122218f, 0.0541008972f},
-std::array<float,2>{0.484038204f, 0.260165334f},
-std::array<float,2>{0.938163638f, 0.51259017f},
-std::array<float,2>{0.0815934613f, 0.900364101f},
-std::array<float,2>{0.54518038f, 0.218772501f},
-std::array<float,2>{0.176661208f, 0.0287075937f},
-std::array<float,2>{0.703738987f, 0.861911893f},
-std::array<float,2>{0.340807557f, 0.69388938f},
-std::array<float,2>{0.857337832f, 0.48549509f},
-std::array<float,2>{0.298684061f, 0.129151925f},
-std::array<float,2>{0.763484359f, 0.973387003f},
-std::array<float,2>{0.192349195f, 0.562672853f},
-std::array<float,2>{0.66202122f, 0.330183923f},
-std::array<float,2>{0.0561452918f, 0.417671204f},
-std::array<float,2>{0.586343169f, 0.665523827f},
-std::array<float,2>{0.391173422f, 0.777031898f},
-std::array<float,2>{0.931744933f, 0.120494008f},
-std::array<float,2>{0.353127062f, 0.443913311f},
-std::array<float,2>{0.813293874f, 0.733839035f},
-std::array<float,2>{0.130058616f, 0.842821181f},
-std::array<float,2>{0.719678462f, 0.0558625981f},
-std::array<float,2>{0.0980167389f, 0.203031853f},
-std::array<float,2>{0.52176702f, 0.921732068f},
-std::array<float,2>{0.463135898f, 0.546002567f},
-std::array<float,2>{0.983329535f, 0.28219828f},
-std::array<float,2>{0.427037001f, 0.0778976232f},
-std::array<float,2>{0.885268152f, 0.78183651f},
-std::array<float,2>{0.0176922791f, 0.6537956f},
-std::array<float,2>{0.601213098f, 0.384162247f},
-std::array<float,2>{0.241197035f, 0.356472433f},
-std::array<float,2>{0.636279285f, 0.614887118f},
-std::array<float,2>{0.25722301f, 0.946889639f},
-std::array<float,2>{0.79446888f, 0.161450818f},
-std::array<float,2>{0.375098318f, 0.398054838f},
-std::array<float,2>{0.906564116f, 0.639208198f},
-std::array<float,2>{0.0438647531f, 0.803981781f},
-std::array<float,2>{0.574756384f, 0.0916741118f},
-std::array<float,2>{0.207423583f, 0.176758155f},
-std::array<float,2>{0.680075586f, 0.960311353f},
-std::array<float,2>{0.28339234f, 0.607272267f},
-std::array<float,2>{0.770417213f, 0.368802637f},
-std::array<float,2>{0.32661292f, 0.0348967016f},
-std::array<float,2>{0.873637915f, 0.813593268f},
-std::array<float,2>{0.16689907f, 0.737587333f},
-std::array<float,2>{0.702406466f, 0.468044907f},
-std::array<float,2>{0.0683995634f, 0.310298681f},
-std::array<float,2>{0.561219752f, 0.548505902f},
-std::array<float,2>{0.489944845f, 0.936723471f},
-std::array<float,2>{0.964683771f, 0.20704563f},
-std::array<float,2>{0.270475447f, 0.32270056f},
-std::array<float,2>{0.809692919f, 0.583975315f},
-std::array<float,2>{0.226496384f, 0.996560216f},
-std::array<float,2>{0.654606819f, 0.145713016f},
-std::array<float,2>{0.00466349814f, 0.101948015f},
-std::array<float,2>{0.612279713f, 0.763579667f},
-std::array<float,2>{0.41307959f, 0.686174512f},
-std::array<float,2>{0.906183422f, 0.425363809f},
-std::array<float,2>{0.450149864f, 0.240944147f},
-std::array<float,2>{0.996178329f, 0.886940718f},
-std::array<float,2>{0.114642918f, 0.518281817f},
-std::array<float,2>{0.509727061f, 0.271861196f},
-std::array<float,2>{0.141464815f, 0.478369504f},
-std::array<float,2>{0.741530478f, 0.718207955f},
-std::array<float,2>{0.360080868f, 0.847915351f},
-std::array<float,2>{0.828414381f, 0.0127572417f},
-std::array<float,2>{0.421510905f, 0.366203755f},
-std::array<float,2>{0.896597624f, 0.600609422f},
-std::array<float,2>{0.00906417798f, 0.966106355f},
-std::array<float,2>{0.623301983f, 0.186513543f},
-std::array<float,2>{0.233872429f, 0.0789070204f},
-std::array<float,2>{0.647227287f, 0.806179106f},
-std::array<float,2>{0.276630044f, 0.626471341f},
-std::array<float,2>{0.803619504f, 0.404421598f},
-std::array<float,2>{0.372019738f, 0.214340433f},
-std::array<float,2>{0.838345945f, 0.928775549f},
-std::array<float,2>{0.154047787f, 0.561923981f},
-std::array<float,2>{0.743190587f, 0.300910532f},
-std::array<float,2>{0.117353551f, 0.454604745f},
-std::array<float,2>{0.50493592f, 0.747544408f},
-std::array<float,2>{0.438823491f, 0.824345887f},
-std::array<float,2>{0.99089855f, 0.0407480858f},
-std::array<float,2>{0.295244902f, 0.435532123f},
-std::array<float,2>{0.779830813f, 0.672098398f},
-std::array<float,2>{0.214420572f, 0.750636518f},
-std::array<float,2>{0.679142237f, 0.099238351f},
-std::array<float,2>{0.0365377143f, 0.150513902f},
-std::array<float,2>{0.563910902f, 0.990243077f},
-std::array<float,2>{0.386056185f, 0.589327097f},
-std::array<float,2>{0.915165126f, 0.317860782f},
-std::array<float,2>{0.492698789f, 0.00210223999f},
-std::array<float,2>{0.95542866f, 0.853820384f},
-std::array<float,2>{0.0711617917f, 0.70752871f},
-std::array<float,2>{0.55256778f, 0.469135314f},
-std::array<float,2>{0.159775466f, 0.275704026f},
-std::array<float,2>{0.691527665f, 0.527495086f},
-std::array<float,2>{0.313795269f, 0.882717252f},
-std::array<float,2>{0.861010313f, 0.242517412f},
-std::array<float,2>{0.459466308f, 0.497808784f},
-std::array<float,2>{0.973115444f, 0.699505925f},
-std::array<float,2>{0.105240032f, 0.874522746f},
-std::array<float,2>{0.523700714f, 0.0188484788f},
-std::array<float,2>{0.138796657f, 0.226991534f},
-std::array<float,2>{0.729607821f, 0.898420691f},
-std::array<float,2>{0.349727452f, 0.50583601f},
-std::array<float,2>{0.823533416f, 0.250820339f},
-std::array<float,2>{0.259260356f, 0.114682853f},
-std::array<float,2>{0.787603498f, 0.765638411f},
-std::array<float,2>{0.248335212f, 0.663462579f},
-std::array<float,2>{0.627989769f, 0.40643844f},
-std::array<float,2>{0.0310144443f, 0.340039074f},
-std::array<float,2>{0.609297693f, 0.577911913f},
-std::array<float,2>{0.430479079f, 0.984090209f},
-std::array<float,2>{0.87767601f, 0.134546041f},
-std::array<float,2>{0.332262844f, 0.290830761f},
-std::array<float,2>{0.844801962f, 0.532694459f},
-std::array<float,2>{0.182879567f, 0.91291976f},
-std::array<float,2>{0.717536032f, 0.189748973f},
-std::array<float,2>{0.0923216268f, 0.0503037721f},
-std::array<float,2>{0.531422555f, 0.831094146f},
-std::array<float,2>{0.475244373f, 0.722414494f},
-std::array<float,2>{0.951904237f, 0.447983861f},
-std::array<float,2>{0.402832299f, 0.167644531f},
-std::array<float,2>{0.926271141f, 0.943266928f},
-std::array<float,2>{0.0497090444f, 0.62135011f},
-std::array<float,2>{0.57828474f, 0.351123899f},
-std::array<float,2>{0.195874915f, 0.378970236f},
-std::array<float,2>{0.671795547f, 0.641299427f},
-std::array<float,2>{0.307504356f, 0.794450402f},
-std::array<float,2>{0.753676534f, 0.0637330264f},
-std::array<float,2>{0.499021649f, 0.353470832f},
-std::array<float,2>{0.959764957f, 0.611345708f},
-std::array<float,2>{0.077578634f, 0.951762438f},
-std::array<float,2>{0.54766649f, 0.158810601f},
-std::array<float,2>{0.163205311f, 0.0730960518f},
-std::array<float,2>{0.689972281f, 0.786678731f},
-std::array<float,2>{0.319352776f, 0.649140716f},
-std::array<float,2>{0.866224587f, 0.387457967f},
-std::array<float,2>{0.289154947f, 0.19552052f},
-std::array<float,2>{0.774902523f, 0.917934835f},
-std::array<float,2>{0.218082666f, 0.539434314f},
-std::array<float,2>{0.673534572f, 0.288119614f},
-std::array<float,2>{0.0328954346f, 0.439759701f},
-std::array<float,2>{0.569080889f, 0.728347182f},
-std::array<float,2>{0.387616694f, 0.837484837f},
-std::array<float,2>{0.919068873f, 0.0613282248f},
-std::array<float,2>{0.368356436f, 0.418068379f},
-std::array<float,2>{0.843452275f, 0.668482721f},
-std::array<float,2>{0.149062619f, 0.781233013f},
-std::array<float,2>{0.747017443f, 0.122999556f},
-std::array<float,2>{0.1243487f, 0.125483185f},
-std::array<float,2>{0.501856327f, 0.969069898f},
-std::array<float,2>{0.443769008f, 0.567822814f},
-std::array<float,2>{0.988195717f, 0.3323524f},
-std::array<float,2>{0.416358441f, 0.0270678233f},
-std::array<float,2>{0.892221034f, 0.865614295f},
-std::array<float,2>{0.0139499819f, 0.688417375f},
-std::array<float,2>{0.618063569f, 0.489198327f},
-std::array<float,2>{0.227754459f, 0.265165359f},
-std::array<float,2>{0.642539859f, 0.509158134f},
-std::array<float,2>{0.280987889f, 0.905628562f},
-std::array<float,2>{0.796893358f, 0.223070741f},
-std::array<float,2>{0.400718629f, 0.483255386f},
-std::array<float,2>{0.924848616f, 0.712627172f},
-std::array<float,2>{0.0530092679f, 0.846434474f},
-std::array<float,2>{0.582218051f, 0.0117047969f},
-std::array<float,2>{0.200679287f, 0.236258745f},
-std::array<float,2>{0.664816976f, 0.884500563f},
-std::array<float,2>{0.312412828f, 0.522770464f},
-std::array<float,2>{0.755449951f, 0.267947942f},
-std::array<float,2>{0.330864668f, 0.106470972f},
-std::array<float,2>{0.85144496f, 0.761103451f},
-std::array<float,2>{0.186173633f, 0.681349933f},
-std::array<float,2>{0.71208781f, 0.429258943f},
-std::array<float,2>{0.0891519859f, 0.326898843f},
-std::array<float,2>{0.537166119f, 0.581719458f},
-std::array<float,2>{0.472509414f, 0.992435098f},
-std::array<float,2>{0.946668446f, 0.141911238f},
-std::array<float,2>{0.265187413f, 0.306210667f},
-std::array<float,2>{0.782846212f, 0.55209446f},
-std::array<float,2>{0.244206995f, 0.931665003f},
-std::array<float,2>{0.630119562f, 0.205611408f},
-std::array<float,2>{0.0239654891f, 0.0384465419f},
-std::array<float,2>{0.6029284f, 0.819219589f},
-std::array<float,2>{0.434057683f, 0.741564393f},
-std::array<float,2>{0.881778657f, 0.463552535f},
-std::array<float,2>{0.45529747f, 0.175271705f},
-std::array<float,2>{0.970891833f, 0.956221581f},
-std::array<float,2>{0.108812034f, 0.60484153f},
-std::array<float,2>{0.529391527f, 0.374624729f},
-std::array<float,2>{0.133996457f, 0.392955303f},
-std::array<float,2>{0.730516255f, 0.634536326f},
-std::array<float,2>{0.346463174f, 0.798903048f},
-std::array<float,2>{0.825854659f, 0.0875337273f},
-std::array<float,2>{0.4234896f, 0.280710906f},
-std::array<float,2>{0.890442967f, 0.526174366f},
-std::array<float,2>{0.0221864674f, 0.876443386f},
-std::array<float,2>{0.595076144f, 0.24908042f},
-std::array<float,2>{0.237188533f, 0.00483458117f},
-std::array<float,2>{0.638290107f, 0.858851969f},
-std::array<float,2>{0.250436068f, 0.70574981f},
-std::array<float,2>{0.791824222f, 0.476144761f},
-std::array<float,2>{0.356746614f, 0.153515622f},
-std::array<float,2>{0.819333911f, 0.98671931f},
-std::array<float,2>{0.125916228f, 0.591893673f},
-std::array<float,2>{0.725507677f, 0.314441264f},
-std::array<float,2>{0.096879594f, 0.431152731f},
-std::array<float,2>{0.519031048f, 0.678645313f},
-std::array<float,2>{0.46764338f, 0.75526911f},
-std::array<float,2>{0.979156435f, 0.0944498256f},
-std::array<float,2>{0.304272562f, 0.45863688f},
-std::array<float,2>{0.758795857f, 0.743059814f},
-std::array<float,2>{0.188885897f, 0.822311461f},
-std::array<float,2>{0.656535447f, 0.0455477796f},
-std::array<float,2>{0.0590345748f, 0.216626316f},
-std::array<float,2>{0.591484129f, 0.921945274f},
-std::array<float,2>{0.394625753f, 0.555068672f},
-std::array<float,2>{0.933976412f, 0.299161553f},
-std::array<float,2>{0.478959233f, 0.0850172713f},
-std::array<float,2>{0.943015933f, 0.811404049f},
-std::array<float,2>{0.0835966244f, 0.630084574f},
-std::array<float,2>{0.540355206f, 0.401926458f},
-std::array<float,2>{0.172814012f, 0.362101257f},
-std::array<float,2>{0.708867133f, 0.597121894f},
-std::array<float,2>{0.33945024f, 0.962303221f},
-std::array<float,2>{0.851906419f, 0.183062732f},
-std::array<float,2>{0.447293639f, 0.37791124f},
-std::array<float,2>{0.993299425f, 0.648018718f},
-std::array<float,2>{0.110375285f, 0.790797055f},
-std::array<float,2>{0.512765229f, 0.069065474f},
-std::array<float,2>{0.147943601f, 0.168077171f},
-std::array<float,2>{0.736116052f, 0.93807596f},
-std::array<float,2>{0.363605529f, 0.619934022f},
-std::array<float,2>{0.833921432f, 0.347501099f},
-std::array<float,2>{0.269379735f, 0.0521583781f},
-std::array<float,2>{0.805184066f, 0.832042277f},
-std::array<float,2>{0.218831614f, 0.723112643f},
-std::array<float,2>{0.648551524f, 0.452726573f},
-std::array<float,2>{0.00308484631f, 0.29397732f},
-std::array<float,2>{0.616024613f, 0.535496712f},
-std::array<float,2>{0.408417851f, 0.906478465f},
-std::array<float,2>{0.902253389f, 0.193884671f},
-std::array<float,2>{0.323868155f, 0.336080611f},
-std::array<float,2>{0.868862033f, 0.572682798f},
-std::array<float,2>{0.170935377f, 0.979778647f},
-std::array<float,2>{0.696718991f, 0.14045158f},
-std::array<float,2>{0.063776657f, 0.110012606f},
-std::array<float,2>{0.5560624f, 0.773227155f},
-std::array<float,2>{0.48622036f, 0.656398833f},
-std::array<float,2>{0.967395782f, 0.413543105f},
-std::array<float,2>{0.381966174f, 0.233278453f},
-std::array<float,2>{0.912759542f, 0.894298255f},
-std::array<float,2>{0.04150673f, 0.500104785f},
-std::array<float,2>{0.5704965f, 0.255902231f},
-std::array<float,2>{0.205059022f, 0.494410783f},
-std::array<float,2>{0.685314655f, 0.697916627f},
-std::array<float,2>{0.286442041f, 0.868966281f},
-std::array<float,2>{0.769498944f, 0.0202834662f},
-std::array<float,2>{0.461729646f, 0.283386648f},
-std::array<float,2>{0.981236517f, 0.54380703f},
-std::array<float,2>{0.0997192189f, 0.919783115f},
-std::array<float,2>{0.521220326f, 0.200718358f},
-std::array<float,2>{0.132522404f, 0.0568212755f},
-std::array<float,2>{0.722110808f, 0.839882672f},
-std::array<float,2>{0.35417515f, 0.732197106f},
-std::array<float,2>{0.815320969f, 0.442134231f},
-std::array<float,2>{0.255642354f, 0.163858056f},
-std::array<float,2>{0.795927644f, 0.947752357f},
-std::array<float,2>{0.238821059f, 0.615526736f},
-std::array<float,2>{0.634694874f, 0.357660115f},
-std::array<float,2>{0.0156719442f, 0.386283815f},
-std::array<float,2>{0.599233449f, 0.65618521f},
-std::array<float,2>{0.428607821f, 0.784789085f},
-std::array<float,2>{0.883482039f, 0.075693965f},
-std::array<float,2>{0.342818737f, 0.487735271f},
-std::array<float,2>{0.858449817f, 0.691420674f},
-std::array<float,2>{0.178594783f, 0.860254526f},
-std::array<float,2>{0.70626992f, 0.0305779614f},
-std::array<float,2>{0.0781599283f, 0.220743403f},
-std::array<float,2>{0.543335378f, 0.901986122f},
-std::array<float,2>{0.481374115f, 0.514042199f},
-std::array<float,2>{0.939698279f, 0.258624166f},
-std::array<float,2>{0.393651217f, 0.117575824f},
-std::array<float,2>{0.93079865f, 0.775058031f},
-std::array<float,2>{0.0584545732f, 0.667708576f},
-std::array<float,2>{0.588603258f, 0.415586859f},
-std::array<float,2>{0.19432652f, 0.328999549f},
-std::array<float,2>{0.662374079f, 0.565521061f},
-std::array<float,2>{0.299544901f, 0.976273477f},
-std::array<float,2>{0.763958871f, 0.132597089f},
-std::array<float,2>{0.411073357f, 0.422606051f},
-std::array<float,2>{0.902806044f, 0.684548974f},
-std::array<float,2>{0.00647642743f, 0.76546216f},
-std::array<float,2>{0.610797167f, 0.105342485f},
-std::array<float,2>{0.223905742f, 0.147163421f},
-std::array<float,2>{0.652384579f, 0.998798847f},
-std::array<float,2>{0.272193193f, 0.584205508f},
-std::array<float,2>{0.811783612f, 0.321306467f},
-std::array<float,2>{0.362036288f, 0.015192342f},
-std::array<float,2>{0.831935167f, 0.849894166f},
-std::array<float,2>{0.143931895f, 0.715770185f},
-std::array<float,2>{0.739788175f, 0.479615569f},
-std::array<float,2>{0.116145253f, 0.270221502f},
-std::array<float,2>{0.511396527f, 0.517576456f},
-std::array<float,2>{0.452989757f, 0.890385091f},
-std::array<float,2>{0.999196649f, 0.239651546f},
-std::array<float,2>{0.281309515f, 0.371037662f},
-std::array<float,2>{0.773057282f, 0.608252466f},
-std::array<float,2>{0.210747883f, 0.958859622f},
-std::array<float,2>{0.681982577f, 0.17963621f},
-std::array<float,2>{0.0465457998f, 0.0922237188f},
-std::array<float,2>{0.577006817f, 0.802627742f},
-std::array<float,2>{0.37710467f, 0.637449622f},
-std::array<float,2>{0.908967793f, 0.395344287f},
-std::array<float,2>{0.491819829f, 0.209338233f},
-std::array<float,2>{0.961876869f, 0.93481797f},
-std::array<float,2>{0.0664285049f, 0.549828172f},
-std::array<float,2>{0.560526848f, 0.312088251f},
-std::array<float,2>{0.164270192f, 0.465507478f},
-std::array<float,2>{0.699974298f, 0.735845685f},
-std::array<float,2>{0.325998068f, 0.814746678f},
-std::array<float,2>{0.872452974f, 0.0316377468f},
-std::array<float,2>{0.383390218f, 0.319964349f},
-std::array<float,2>{0.916585207f, 0.587844789f},
-std::array<float,2>{0.0384342894f, 0.989659667f},
-std::array<float,2>{0.565698981f, 0.150146484f},
-std::array<float,2>{0.211748332f, 0.100791842f},
-std::array<float,2>{0.677367151f, 0.752044141f},
-std::array<float,2>{0.293447047f, 0.674875617f},
-std::array<float,2>{0.777902782f, 0.437201411f},
-std::array<float,2>{0.314476281f, 0.245182782f},
-std::array<float,2>{0.86216253f, 0.879566371f},
-std::array<float,2>{0.15807189f, 0.529442072f},
-std::array<float,2>{0.694118917f, 0.27478826f},
-std::array<float,2>{0.0730208755f, 0.471165091f},
-std::array<float,2>{0.553852916f, 0.710830629f},
-std::array<float,2>{0.49549526f, 0.851744175f},
-std::array<float,2>{0.953128934f, 0.000652484945f},
-std::array<float,2>{0.274631023f, 0.403719068f},
-std::array<float,2>{0.802321374f, 0.627938032f},
-std::array<float,2>{0.230902344f, 0.807522655f},
-std::array<float,2>{0.64559865f, 0.0814698935f},
-std::array<float,2>{0.0100911651f, 0.183659539f},
-std::array<float,2>{0.621967614f, 0.967195392f},
-std::array<float,2>{0.419148505f, 0.598017573f},
-std::array<float,2>{0.895770371f, 0.363751471f},
-std::array<float,2>{0.440281004f, 0.0414710119f},
-std::array<float,2>{0.98997736f, 0.826786995f},
-std::array<float,2>{0.120138854f, 0.749750912f},
-std::array<float,2>{0.507739186f, 0.456737429f},
-std::array<float,2>{0.155981556f, 0.304503173f},
-std::array<float,2>{0.745068133f, 0.559799969f},
-std::array<float,2>{0.374791384f, 0.926452994f},
-std::array<float,2>{0.837841153f, 0.212188914f},
-std::array<float,2>{0.472686112f, 0.447190434f},
-std::array<float,2>{0.949760377f, 0.719589651f},
-std::array<float,2>{0.0904374793f, 0.829823673f},
-std::array<float,2>{0.53422761f, 0.0486871041f},
-std::array<float,2>{0.179944888f, 0.189274177f},
-std::array<float,2>{0.71677053f, 0.911054194f},
-std::array<float,2>{0.33421272f, 0.533982515f},
-std::array<float,2>{0.847082555f, 0.291300833f},
-std::array<float,2>{0.305191696f, 0.0656329542f},
-std::array<float,2>{0.750463307f, 0.795866549f},
-std::array<float,2>{0.197494596f, 0.642650008f},
-std::array<float,2>{0.669687212f, 0.382579744f},
-std::array<float,2>{0.0479470938f, 0.348770976f},
-std::array<float,2>{0.580497384f, 0.623510122f},
-std::array<float,2>{0.406165689f, 0.945175469f},
-std::array<float,2>{0.928487062f, 0.164599702f},
-std::array<float,2>{0.348070532f, 0.252426118f},
-std::array<float,2>{0.821079373f, 0.506118298f},
-std::array<float,2>{0.136956066f, 0.895423412f},
-std::array<float,2>{0.727757156f, 0.229329228f},
-std::array<float,2>{0.102352925f, 0.0157822873f},
-std::array<float,2>{0.525894284f, 0.871925533f},
-std::array<float,2>{0.457778037f, 0.702078998f},
-std::array<float,2>{0.975282729f, 0.499685913f},
-std::array<float,2>{0.433147728f, 0.135938421f},
-std::array<float,2>{0.875413656f, 0.980539918f},
-std::array<float,2>{0.0283678155f, 0.57555151f},
-std::array<float,2>{0.605699301f, 0.343742013f},
-std::array<float,2>{0.247164324f, 0.409876257f},
-std::array<float,2>{0.626707792f, 0.661673546f},
-std::array<float,2>{0.261296839f, 0.768927395f},
-std::array<float,2>{0.786710918f, 0.115862623f},
-std::array<float,2>{0.485555053f, 0.339663804f},
-std::array<float,2>{0.967060328f, 0.572206855f},
-std::array<float,2>{0.0640683994f, 0.9766711f},
-std::array<float,2>{0.556448877f, 0.13711749f},
-std::array<float,2>{0.171594277f, 0.112554841f},
-std::array<float,2>{0.69682759f, 0.769759893f},
-std::array<float,2>{0.323444635f, 0.659238279f},
-std::array<float,2>{0.868312359f, 0.411268145f},
-std::array<float,2>{0.286979586f, 0.231916323f},
-std::array<float,2>{0.76859951f, 0.891008317f},
-std::array<float,2>{0.204336792f, 0.502748966f},
-std::array<float,2>{0.684691906f, 0.254230171f},
-std::array<float,2>{0.0413891822f, 0.492808521f},
-std::array<float,2>{0.571175635f, 0.696104109f},
-std::array<float,2>{0.38277027f, 0.870755672f},
-std::array<float,2>{0.912130475f, 0.02202994f},
-std::array<float,2>{0.363820732f, 0.375804991f},
-std::array<float,2>{0.833188415f, 0.645268857f},
-std::array<float,2>{0.148145124f, 0.791285694f},
-std::array<float,2>{0.735807836f, 0.0682309195f},
-std::array<float,2>{0.111274317f, 0.171105221f},
-std::array<float,2>{0.513415992f, 0.941150367f},
-std::array<float,2>{0.447964668f, 0.619075835f},
-std::array<float,2>{0.994023323f, 0.344527692f},
-std::array<float,2>{0.408976138f, 0.0543966778f},
-std::array<float,2>{0.90165621f, 0.835553885f},
-std::array<float,2>{0.0035143327f, 0.726050675f},
-std::array<float,2>{0.615673602f, 0.450811565f},
-std::array<float,2>{0.219639897f, 0.295936823f},
-std::array<float,2>{0.64930135f, 0.538962543f},
-std::array<float,2>{0.268932968f, 0.909830987f},
-std::array<float,2>{0.804983854f, 0.191433191f},
-std::array<float,2>{0.395259708f, 0.459479153f},
-std::array<float,2>{0.934504271f, 0.745835066f},
-std::array<float,2>{0.0593855716f, 0.820661068f},
-std::array<float,2>{0.591036141f, 0.04328252f},
-std::array<float,2>{0.189182237f, 0.218615144f},
-std::array<float,2>{0.657119393f, 0.924818575f},
-std::array<float,2>{0.3037422f, 0.558359146f},
-std::array<float,2>{0.759439707f, 0.297454596f},
-std::array<float,2>{0.339257389f, 0.0827998668f},
-std::array<float,2>{0.852349043f, 0.810249329f},
-std::array<float,2>{0.172075406f, 0.631091714f},
-std::array<float,2>{0.708395779f, 0.39977625f},
-std::array<float,2>{0.0830698758f, 0.36001718f},
-std::array<float,2>{0.540546775f, 0.593795478f},
-std::array<float,2>{0.479283452f, 0.963588834f},
-std::array<float,2>{0.942683578f, 0.1804066f},
-std::array<float,2>{0.250517219f, 0.27817589f},
-std::array<float,2>{0.791397214f, 0.524644911f},
-std::array<float,2>{0.236333132f, 0.878230274f},
-std::array<float,2>{0.637755871f, 0.247091576f},
-std::array<float,2>{0.0214962251f, 0.00693887146f},
-std::array<float,2>{0.595294356f, 0.855778277f},
-std::array<float,2>{0.422939777f, 0.704248667f},
-std::array<float,2>{0.890030861f, 0.4727678f},
-std::array<float,2>{0.466857105f, 0.154782265f},
-std::array<float,2>{0.97900176f, 0.985515535f},
-std::array<float,2>{0.0973314717f, 0.590107739f},
-std::array<float,2>{0.519236624f, 0.315827996f},
-std::array<float,2>{0.125415102f, 0.433376878f},
-std::array<float,2>{0.72461009f, 0.675805807f},
-std::array<float,2>{0.357351065f, 0.757677436f},
-std::array<float,2>{0.818713486f, 0.0974546075f},
-std::array<float,2>{0.434238344f, 0.30758369f},
-std::array<float,2>{0.881258428f, 0.554655731f},
-std::array<float,2>{0.0234484151f, 0.930309474f},
-std::array<float,2>{0.603393674f, 0.204033926f},
-std::array<float,2>{0.244888186f, 0.0352633446f},
-std::array<float,2>{0.630819619f, 0.816791117f},
-std::array<float,2>{0.265099794f, 0.739574909f},
-std::array<float,2>{0.782439709f, 0.461681306f},
-std::array<float,2>{0.345753461f, 0.173637375f},
-std::array<float,2>{0.825250208f, 0.954368472f},
-std::array<float,2>{0.134643525f, 0.603184342f},
-std::array<float,2>{0.731308222f, 0.371979684f},
-std::array<float,2>{0.109019876f, 0.391723752f},
-std::array<float,2>{0.530205429f, 0.635726869f},
-std::array<float,2>{0.455882937f, 0.797216475f},
-std::array<float,2>{0.971639633f, 0.0888891965f},
-std::array<float,2>{0.311721176f, 0.480594695f},
-std::array<float,2>{0.755096734f, 0.714669526f},
-std::array<float,2>{0.201116011f, 0.845587254f},
-std::array<float,2>{0.664332926f, 0.00898690149f},
-std::array<float,2>{0.0533594191f, 0.236747608f},
-std::array<float,2>{0.582886994f, 0.885374784f},
-std::array<float,2>{0.400918722f, 0.520117939f},
-std::array<float,2>{0.925775945f, 0.26712516f},
-std::array<float,2>{0.472133577f, 0.107634403f},
-std::array<float,2>{0.947187304f, 0.759646297f},
-std::array<float,2>{0.0893953964f, 0.682961822f},
-std::array<float,2>{0.537763f, 0.426219791f},
-std::array<float,2>{0.185912624f, 0.325609386f},
-std::array<float,2>{0.712511361f, 0.57845664f},
-std::array<float,2>{0.330495983f, 0.99421984f},
-std::array<float,2>{0.851034343f, 0.143376306f},
-std::array<float,2>{0.444063574f, 0.421119064f},
-std::array<float,2>{0.987667501f, 0.671392918f},
-std::array<float,2>{0.124777503f, 0.778908491f},
-std::array<float,2>{0.5012784f, 0.123807564f},
-std::array<float,2>{0.148808986f, 0.128440335f},
-std::array<float,2>{0.746183395f, 0.971651733f},
-std::array<float,2>{0.368743211f, 0.569258213f},
-std::array<float,2>{0.843222558f, 0.334724247f},
-std::array<float,2>{0.280732542f, 0.023723701f},
-std::array<float,2>{0.79740262f, 0.864751577f},
-std::array<float,2>{0.228351235f, 0.691175818f},
-std::array<float,2>{0.641905546f, 0.491729945f},
-std::array<float,2>{0.0142944371f, 0.262767762f},
-std::array<float,2>{0.61757642f, 0.510226309f},
-std::array<float,2>{0.416519374f, 0.903097153f},
-std::array<float,2>{0.891794741f, 0.225260243f},
-std::array<float,2>{0.319995731f, 0.354047507f},
-std::array<float,2>{0.867044389f, 0.610628068f},
-std::array<float,2>{0.163914695f, 0.949693084f},
-std::array<float,2>{0.689541161f, 0.156266674f},
-std::array<float,2>{0.0777625889f, 0.0714465678f},
-std::array<float,2>{0.546879709f, 0.788557947f},
-std::array<float,2>{0.49846369f, 0.651980877f},
-std::array<float,2>{0.959377766f, 0.389707059f},
-std::array<float,2>{0.386794627f, 0.19763267f},
-std::array<float,2>{0.919501185f, 0.915232003f},
-std::array<float,2>{0.0324165933f, 0.542946577f},
-std::array<float,2>{0.568802118f, 0.2852422f},
-std::array<float,2>{0.218462616f, 0.438341796f},
-std::array<float,2>{0.672980368f, 0.73037219f},
-std::array<float,2>{0.289616555f, 0.838905811f},
-std::array<float,2>{0.774795234f, 0.0589454323f},
-std::array<float,2>{0.457355499f, 0.25016132f},
-std::array<float,2>{0.974633217f, 0.504969478f},
-std::array<float,2>{0.102009505f, 0.89780575f},
-std::array<float,2>{0.525482297f, 0.227463052f},
-std::array<float,2>{0.137334436f, 0.0193443038f},
-std::array<float,2>{0.728430688f, 0.874315262f},
-std::array<float,2>{0.348209351f, 0.699838519f},
-std::array<float,2>{0.820369542f, 0.497438252f},
-std::array<float,2>{0.261040717f, 0.134136617f},
-std::array<float,2>{0.786196113f, 0.983702123f},
-std::array<float,2>{0.247612476f, 0.577530205f},
-std::array<float,2>{0.626314104f, 0.340741366f},
-std::array<float,2>{0.0292638969f, 0.407139897f},
-std::array<float,2>{0.605974317f, 0.663890481f},
-std::array<float,2>{0.432817429f, 0.766163528f},
-std::array<float,2>{0.87563169f, 0.114955932f},
-std::array<float,2>{0.334899336f, 0.44745037f},
-std::array<float,2>{0.847268939f, 0.721804798f},
-std::array<float,2>{0.180185542f, 0.831731856f},
-std::array<float,2>{0.716073453f, 0.0501312166f},
-std::array<float,2>{0.0901875347f, 0.190387368f},
-std::array<float,2>{0.534852982f, 0.912201464f},
-std::array<float,2>{0.47360456f, 0.533106208f},
-std::array<float,2>{0.949463606f, 0.29051137f},
-std::array<float,2>{0.405329138f, 0.0640249401f},
-std::array<float,2>{0.927945733f, 0.79424876f},
-std::array<float,2>{0.0483798608f, 0.640744328f},
-std::array<float,2>{0.580991924f, 0.379813164f},
-std::array<float,2>{0.197802678f, 0.350812942f},
-std::array<float,2>{0.669328094f, 0.621888697f},
-std::array<float,2>{0.305092543f, 0.942570806f},
-std::array<float,2>{0.750948489f, 0.167036042f},
-std::array<float,2>{0.419828564f, 0.405086577f},
-std::array<float,2>{0.896133959f, 0.626199007f},
-std::array<float,2>{0.0105281658f, 0.806037545f},
-std::array<float,2>{0.621152282f, 0.0781364143f},
-std::array<float,2>{0.231055856f, 0.185708687f},
-std::array<float,2>{0.646444738f, 0.966684937f},
-std::array<float,2>{0.274995059f, 0.601507664f},
-std::array<float,2>{0.801868737f, 0.365481108f},
-std::array<float,2>{0.374362797f, 0.0403032936f},
-std::array<float,2>{0.837182224f, 0.825130224f},
-std::array<float,2>{0.155437395f, 0.74803251f},
-std::array<float,2>{0.744453549f, 0.454492509f},
-std::array<float,2>{0.121089667f, 0.301591665f},
-std::array<float,2>{0.507223785f, 0.562258363f},
-std::array<float,2>{0.439473957f, 0.929232538f},
-std::array<float,2>{0.989336133f, 0.214665294f},
-std::array<float,2>{0.293678164f, 0.318165809f},
-std::array<float,2>{0.777562082f, 0.589653611f},
-std::array<float,2>{0.210998923f, 0.990744948f},
-std::array<float,2>{0.676854253f, 0.151125431f},
-std::array<float,2>{0.0387604125f, 0.0990302041f},
-std::array<float,2>{0.566191912f, 0.750390291f},
-std::array<float,2>{0.38312766f, 0.672378123f},
-std::array<float,2>{0.916337132f, 0.434772372f},
-std::array<float,2>{0.495712698f, 0.242888868f},
-std::array<float,2>{0.953981638f, 0.88200897f},
-std::array<float,2>{0.0725734234f, 0.528293192f},
-std::array<float,2>{0.554614663f, 0.276247203f},
-std::array<float,2>{0.157287717f, 0.469473571f},
-std::array<float,2>{0.693724036f, 0.707142949f},
-std::array<float,2>{0.3153162f, 0.854284585f},
-std::array<float,2>{0.861753285f, 0.00273512816f},
-std::array<float,2>{0.377643675f, 0.368254274f},
-std::array<float,2>{0.908367515f, 0.606640637f},
-std::array<float,2>{0.0462293178f, 0.960511148f},
-std::array<float,2>{0.576513648f, 0.177457854f},
-std::array<float,2>{0.210179523f, 0.0909123123f},
-std::array<float,2>{0.682482004f, 0.804505885f},
-std::array<float,2>{0.282167047f, 0.638764799f},
-std::array<float,2>{0.772680819f, 0.397727966f},
-std::array<float,2>{0.325431347f, 0.207543179f},
-std::array<float,2>{0.872955382f, 0.93734628f},
-std::array<float,2>{0.164551482f, 0.547863603f},
-std::array<float,2>{0.699422777f, 0.309798062f},
-std::array<float,2>{0.0669522732f, 0.468731999f},
-std::array<float,2>{0.559899688f, 0.737802029f},
-std::array<float,2>{0.491605401f, 0.814008236f},
-std::array<float,2>{0.960948944f, 0.0344730057f},
-std::array<float,2>{0.271559328f, 0.425061941f},
-std::array<float,2>{0.812446833f, 0.685757399f},
-std::array<float,2>{0.224392086f, 0.762908757f},
-std::array<float,2>{0.653061092f, 0.102347113f},
-std::array<float,2>{0.00633229874f, 0.146157786f},
-std::array<float,2>{0.611043215f, 0.997012615f},
-std::array<float,2>{0.410613745f, 0.583445847f},
-std::array<float,2>{0.903195083f, 0.32278952f},
-std::array<float,2>{0.45245561f, 0.0135435257f},
-std::array<float,2>{0.999806881f, 0.848148823f},
-std::array<float,2>{0.115298249f, 0.718622983f},
-std::array<float,2>{0.51119411f, 0.477984995f},
-std::array<float,2>{0.144295245f, 0.272393167f},
-std::array<float,2>{0.739646375f, 0.517847598f},
-std::array<float,2>{0.361618906f, 0.887575507f},
-std::array<float,2>{0.831099629f, 0.240702644f},
-std::array<float,2>{0.480520844f, 0.48622641f},
-std::array<float,2>{0.940037251f, 0.693383932f},
-std::array<float,2>{0.0789507404f, 0.861425221f},
-std::array<float,2>{0.54382509f, 0.0292203333f},
-std::array<float,2>{0.178100929f, 0.219260916f},
-std::array<float,2>{0.706760824f, 0.899645746f},
-std::array<float,2>{0.343346804f, 0.512092888f},
-std::array<float,2>{0.859168589f, 0.260735065f},
-std::array<float,2>{0.299236953f, 0.120617494f},
-std::array<float,2>{0.76423049f, 0.77674365f},
-std::array<float,2>{0.193383962f, 0.665945709f},
-std::array<float,2>{0.66288954f, 0.417098016f},
-std::array<float,2>{0.0579621904f, 0.330804557f},
-std::array<float,2>{0.588054419f, 0.563450396f},
-std::array<float,2>{0.394262999f, 0.973073304f},
-std::array<float,2>{0.931588173f, 0.129636884f},
-std::array<float,2>{0.353929847f, 0.281731755f},
-std::array<float,2>{0.814748764f, 0.546463072f},
-std::array<float,2>{0.13214691f, 0.920953274f},
-std::array<float,2>{0.722439766f, 0.202630192f},
-std::array<float,2>{0.100562401f, 0.0563129187f},
-std::array<float,2>{0.52074033f, 0.843708396f},
-std::array<float,2>{0.461248279f, 0.733979106f},
-std::array<float,2>{0.980509281f, 0.443410128f},
-std::array<float,2>{0.428087592f, 0.161665574f},
-std::array<float,2>{0.883053064f, 0.946494162f},
-std::array<float,2>{0.0165861063f, 0.614267349f},
-std::array<float,2>{0.598949075f, 0.35708636f},
-std::array<float,2>{0.238727242f, 0.38430199f},
-std::array<float,2>{0.634103715f, 0.653849483f},
-std::array<float,2>{0.255037159f, 0.781645954f},
-std::array<float,2>{0.796658695f, 0.0774874911f},
-std::array<float,2>{0.445448101f, 0.347048908f},
-std::array<float,2>{0.995359302f, 0.619404256f},
-std::array<float,2>{0.112957209f, 0.937910378f},
-std::array<float,2>{0.515105128f, 0.168891162f},
-std::array<float,2>{0.146294221f, 0.0687710568f},
-std::array<float,2>{0.736667216f, 0.790047884f},
-std::array<float,2>{0.365875602f, 0.647692919f},
-std::array<float,2>{0.835103869f, 0.377218276f},
-std::array<float,2>{0.266174763f, 0.193507358f},
-std::array<float,2>{0.807676077f, 0.907216549f},
-std::array<float,2>{0.221363619f, 0.53594929f},
-std::array<float,2>{0.650464833f, 0.294540763f},
-std::array<float,2>{0.0018363985f, 0.452323109f},
-std::array<float,2>{0.614871323f, 0.72325182f},
-std::array<float,2>{0.407182544f, 0.83287847f},
-std::array<float,2>{0.899019003f, 0.0526143648f},
-std::array<float,2>{0.320762306f, 0.413619459f},
-std::array<float,2>{0.870890498f, 0.656755447f},
-std::array<float,2>{0.168299451f, 0.772921264f},
-std::array<float,2>{0.697653532f, 0.109435387f},
-std::array<float,2>{0.0658916235f, 0.139745012f},
-std::array<float,2>{0.558177173f, 0.980378211f},
-std::array<float,2>{0.48789227f, 0.573206842f},
-std::array<float,2>{0.966733336f, 0.336504787f},
-std::array<float,2>{0.379773259f, 0.0196979474f},
-std::array<float,2>{0.911445737f, 0.868627787f},
-std::array<float,2>{0.0392877422f, 0.697319746f},
-std::array<float,2>{0.572394192f, 0.494785011f},
-std::array<float,2>{0.206295028f, 0.256443292f},
-std::array<float,2>{0.686604261f, 0.500659347f},
-std::array<float,2>{0.288207918f, 0.893946946f},
-std::array<float,2>{0.767384946f, 0.232903019f},
-std::array<float,2>{0.424208343f, 0.476033151f},
-std::array<float,2>{0.888635218f, 0.705192685f},
-std::array<float,2>{0.0211529955f, 0.859080851f},
-std::array<float,2>{0.596494913f, 0.00399279548f},
-std::array<float,2>{0.234802514f, 0.249967664f},
-std::array<float,2>{0.639318287f, 0.876863062f},
-std::array<float,2>{0.253593057f, 0.525680125f},
-std::array<float,2>{0.790528476f, 0.281211168f},
-std::array<float,2>{0.3589257f, 0.0939438045f},
-std::array<float,2>{0.816907108f, 0.755636036f},
-std::array<float,2>{0.127309158f, 0.677911997f},
-std::array<float,2>{0.724574864f, 0.431106567f},
-std::array<float,2>{0.0940643772f, 0.313685626f},
-std::array<float,2>{0.517247438f, 0.592646062f},
-std::array<float,2>{0.465777665f, 0.986994565f},
-std::array<float,2>{0.977979541f, 0.154185921f},
-std::array<float,2>{0.301033705f, 0.299613118f},
-std::array<float,2>{0.761129379f, 0.555435717f},
-std::array<float,2>{0.189694956f, 0.922482371f},
-std::array<float,2>{0.659685552f, 0.21614337f},
-std::array<float,2>{0.0624391027f, 0.0452804528f},
-std::array<float,2>{0.592716336f, 0.823131263f},
-std::array<float,2>{0.398411691f, 0.742351472f},
-std::array<float,2>{0.936770141f, 0.458403409f},
-std::array<float,2>{0.477547795f, 0.183108255f},
-std::array<float,2>{0.943732917f, 0.962486684f},
-std::array<float,2>{0.0843519121f, 0.597604454f},
-std::array<float,2>{0.541706562f, 0.361614794f},
-std::array<float,2>{0.174349219f, 0.401372641f},
-std::array<float,2>{0.709834754f, 0.630827963f},
-std::array<float,2>{0.33760035f, 0.810930312f},
-std::array<float,2>{0.854029179f, 0.0857364461f},
-std::array<float,2>{0.398455083f, 0.268499881f},
-std::array<float,2>{0.922769904f, 0.523072064f},
-std::array<float,2>{0.0513699651f, 0.884011447f},
-std::array<float,2>{0.585057378f, 0.235806018f},
-std::array<float,2>{0.202326566f, 0.0111743994f},
-std::array<float,2>{0.667089283f, 0.845795095f},
-std::array<float,2>{0.310512573f, 0.71214968f},
-std::array<float,2>{0.757125199f, 0.48256129f},
-std::array<float,2>{0.328343898f, 0.142093927f},
-std::array<float,2>{0.848772228f, 0.992691994f},
-std::array<float,2>{0.184121877f, 0.581376076f},
-std::array<float,2>{0.713370144f, 0.32643497f},
-std::array<float,2>{0.0877274871f, 0.429140866f},
-std::array<float,2>{0.535257041f, 0.68098551f},
-std::array<float,2>{0.469125837f, 0.761698961f},
-std::array<float,2>{0.948389053f, 0.106947824f},
-std::array<float,2>{0.262482643f, 0.46331501f},
-std::array<float,2>{0.784256876f, 0.74187994f},
-std::array<float,2>{0.242679939f, 0.818423212f},
-std::array<float,2>{0.632440805f, 0.0388084091f},
-std::array<float,2>{0.0265301708f, 0.205522567f},
-std::array<float,2>{0.603809118f, 0.932229877f},
-std::array<float,2>{0.43730098f, 0.55227524f},
-std::array<float,2>{0.88053143f, 0.306089163f},
-std::array<float,2>{0.453191519f, 0.087004602f},
-std::array<float,2>{0.969618082f, 0.79956156f},
-std::array<float,2>{0.106787734f, 0.634026587f},
-std::array<float,2>{0.527666569f, 0.393347174f},
-std::array<float,2>{0.136253789f, 0.37448132f},
-std::array<float,2>{0.734281778f, 0.605188251f},
-std::array<float,2>{0.344174922f, 0.956992507f},
-std::array<float,2>{0.827923775f, 0.175571784f},
-std::array<float,2>{0.49780041f, 0.386804283f},
-std::array<float,2>{0.958491385f, 0.648810446f},
-std::array<float,2>{0.0758035854f, 0.78632766f},
-std::array<float,2>{0.549532115f, 0.0723477527f},
-std::array<float,2>{0.160456568f, 0.158357695f},
-std::array<float,2>{0.688530743f, 0.951251686f},
-std::array<float,2>{0.3168585f, 0.612239659f},
-std::array<float,2>{0.864363134f, 0.352678299f},
-std::array<float,2>{0.292442083f, 0.0607132129f},
-std::array<float,2>{0.777340591f, 0.837128997f},
-std::array<float,2>{0.215945303f, 0.727877378f},
-std::array<float,2>{0.675745368f, 0.440121114f},
-std::array<float,2>{0.0346740037f, 0.288925976f},
-std::array<float,2>{0.568354189f, 0.539981544f},
-std::array<float,2>{0.389957666f, 0.917402267f},
-std::array<float,2>{0.920723081f, 0.195924863f},
-std::array<float,2>{0.370919287f, 0.332705498f},
-std::array<float,2>{0.841669559f, 0.568165541f},
-std::array<float,2>{0.151726246f, 0.9693591f},
-std::array<float,2>{0.748516083f, 0.125912145f},
-std::array<float,2>{0.121945538f, 0.122432902f},
-std::array<float,2>{0.503077626f, 0.78060174f},
-std::array<float,2>{0.44212994f, 0.668279052f},
-std::array<float,2>{0.98531425f, 0.418503344f},
-std::array<float,2>{0.41420266f, 0.223165333f},
-std::array<float,2>{0.893214643f, 0.905856073f},
-std::array<float,2>{0.0135464733f, 0.509502232f},
-std::array<float,2>{0.620899141f, 0.264912009f},
-std::array<float,2>{0.228835404f, 0.488656253f},
-std::array<float,2>{0.643555403f, 0.687928259f},
-std::array<float,2>{0.277469605f, 0.866181195f},
-std::array<float,2>{0.799146295f, 0.0265330598f},
-std::array<float,2>{0.47497046f, 0.291512787f},
-std::array<float,2>{0.951424718f, 0.533489883f},
-std::array<float,2>{0.0918163732f, 0.910558045f},
-std::array<float,2>{0.531930745f, 0.188607857f},
-std::array<float,2>{0.183196604f, 0.0481217206f},
-std::array<float,2>{0.716989696f, 0.829250097f},
-std::array<float,2>{0.332852066f, 0.718894541f},
-std::array<float,2>{0.845444262f, 0.446468294f},
-std::array<float,2>{0.307074487f, 0.164096549f},
-std::array<float,2>{0.753224373f, 0.944623649f},
-std::array<float,2>{0.195755467f, 0.6237607f},
-std::array<float,2>{0.671317458f, 0.349318027f},
-std::array<float,2>{0.0491992719f, 0.382303894f},
-std::array<float,2>{0.578688264f, 0.643443584f},
-std::array<float,2>{0.402825296f, 0.795206308f},
-std::array<float,2>{0.926036417f, 0.0663651973f},
-std::array<float,2>{0.350101769f, 0.499264687f},
-std::array<float,2>{0.823756456f, 0.70134604f},
-std::array<float,2>{0.139533952f, 0.871108472f},
-std::array<float,2>{0.730270088f, 0.0165090747f},
-std::array<float,2>{0.104741365f, 0.228609234f},
-std::array<float,2>{0.524073601f, 0.894531429f},
-std::array<float,2>{0.459807068f, 0.506466985f},
-std::array<float,2>{0.973624647f, 0.252493113f},
-std::array<float,2>{0.429957181f, 0.115663618f},
-std::array<float,2>{0.877200425f, 0.769193828f},
-std::array<float,2>{0.030383084f, 0.661453307f},
-std::array<float,2>{0.60851723f, 0.409247667f},
-std::array<float,2>{0.248645082f, 0.343102485f},
-std::array<float,2>{0.628552258f, 0.576091707f},
-std::array<float,2>{0.259654343f, 0.981308341f},
-std::array<float,2>{0.787550271f, 0.136467129f},
-std::array<float,2>{0.386652619f, 0.436529219f},
-std::array<float,2>{0.915687382f, 0.675619245f},
-std::array<float,2>{0.0367679186f, 0.752811253f},
-std::array<float,2>{0.564109504f, 0.101382546f},
-std::array<float,2>{0.214118987f, 0.149473146f},
-std::array<float,2>{0.679283082f, 0.989897549f},
-std::array<float,2>{0.295882165f, 0.587249815f},
-std::array<float,2>{0.779299855f, 0.319787115f},
-std::array<float,2>{0.314005226f, 0.000291460659f},
-std::array<float,2>{0.86046207f, 0.85217154f},
-std::array<float,2>{0.159196287f, 0.710355759f},
-std::array<float,2>{0.69191581f, 0.471480757f},
-std::array<float,2>{0.0706898123f, 0.275045276f},
-std::array<float,2>{0.551974833f, 0.530174255f},
-std::array<float,2>{0.492200017f, 0.879205704f},
-std::array<float,2>{0.955826938f, 0.246008217f},
-std::array<float,2>{0.277291745f, 0.363839418f},
-std::array<float,2>{0.802910328f, 0.598191381f},
-std::array<float,2>{0.233975932f, 0.967484951f},
-std::array<float,2>{0.646793544f, 0.184364676f},
-std::array<float,2>{0.00969316158f, 0.0818325877f},
-std::array<float,2>{0.623875618f, 0.806763053f},
-std::array<float,2>{0.421238273f, 0.628835618f},
-std::array<float,2>{0.897334158f, 0.403988928f},
-std::array<float,2>{0.439225018f, 0.21262753f},
-std::array<float,2>{0.990702093f, 0.9261567f},
-std::array<float,2>{0.117867142f, 0.560233593f},
-std::array<float,2>{0.505515099f, 0.304191798f},
-std::array<float,2>{0.153373256f, 0.456294686f},
-std::array<float,2>{0.7438007f, 0.749504626f},
-std::array<float,2>{0.37145862f, 0.826323628f},
-std::array<float,2>{0.838551044f, 0.0415694565f},
-std::array<float,2>{0.412379533f, 0.321980059f},
-std::array<float,2>{0.905477643f, 0.584531188f},
-std::array<float,2>{0.0041920403f, 0.998224914f},
-std::array<float,2>{0.611504495f, 0.146692336f},
-std::array<float,2>{0.226070762f, 0.1047948f},
-std::array<float,2>{0.655252814f, 0.764872313f},
-std::array<float,2>{0.269851148f, 0.683961809f},
-std::array<float,2>{0.81046319f, 0.422220677f},
-std::array<float,2>{0.359682113f, 0.239809543f},
-std::array<float,2>{0.82874012f, 0.889991105f},
-std::array<float,2>{0.140921474f, 0.517069101f},
-std::array<float,2>{0.742089987f, 0.269976914f},
-std::array<float,2>{0.114763707f, 0.480102181f},
-std::array<float,2>{0.509128332f, 0.715127528f},
-std::array<float,2>{0.449255645f, 0.850183129f},
-std::array<float,2>{0.996867955f, 0.0150719834f},
-std::array<float,2>{0.284009963f, 0.394738585f},
-std::array<float,2>{0.769869685f, 0.636767566f},
-std::array<float,2>{0.207865506f, 0.802075982f},
-std::array<float,2>{0.680526972f, 0.0927297398f},
-std::array<float,2>{0.0432758592f, 0.178930625f},
-std::array<float,2>{0.57461834f, 0.958349228f},
-std::array<float,2>{0.375640392f, 0.607543707f},
-std::array<float,2>{0.907182097f, 0.370601714f},
-std::array<float,2>{0.489383191f, 0.0321650393f},
-std::array<float,2>{0.964270771f, 0.815264523f},
-std::array<float,2>{0.0692886412f, 0.735808313f},
-std::array<float,2>{0.56061089f, 0.46494478f},
-std::array<float,2>{0.166070059f, 0.311855823f},
-std::array<float,2>{0.702817082f, 0.550551772f},
-std::array<float,2>{0.326686025f, 0.935434103f},
-std::array<float,2>{0.873463452f, 0.20995006f},
-std::array<float,2>{0.463814616f, 0.441636235f},
-std::array<float,2>{0.982573032f, 0.731532931f},
-std::array<float,2>{0.0985805467f, 0.840744197f},
-std::array<float,2>{0.52231282f, 0.0575103909f},
-std::array<float,2>{0.13044253f, 0.200213909f},
-std::array<float,2>{0.71911937f, 0.919405997f},
-std::array<float,2>{0.352606744f, 0.543141007f},
-std::array<float,2>{0.812537611f, 0.283910483f},
-std::array<float,2>{0.257506698f, 0.0756288692f},
-std::array<float,2>{0.794230163f, 0.784491897f},
-std::array<float,2>{0.240250036f, 0.655445039f},
-std::array<float,2>{0.636067867f, 0.386182427f},
-std::array<float,2>{0.0182233024f, 0.358064592f},
-std::array<float,2>{0.600931525f, 0.61598295f},
-std::array<float,2>{0.427627414f, 0.947758555f},
-std::array<float,2>{0.885128319f, 0.16345717f},
-std::array<float,2>{0.340024054f, 0.258017629f},
-std::array<float,2>{0.856565356f, 0.514417291f},
-std::array<float,2>{0.1761069f, 0.901501954f},
-std::array<float,2>{0.703591049f, 0.221414641f},
-std::array<float,2>{0.0810949653f, 0.0307912789f},
-std::array<float,2>{0.545416117f, 0.859507442f},
-std::array<float,2>{0.483762801f, 0.692044318f},
-std::array<float,2>{0.937895417f, 0.488108367f},
-std::array<float,2>{0.390849322f, 0.131919697f},
-std::array<float,2>{0.932137012f, 0.975744724f},
-std::array<float,2>{0.0563603006f, 0.566095591f},
-std::array<float,2>{0.586654425f, 0.328227609f},
-std::array<float,2>{0.191621184f, 0.41530785f},
-std::array<float,2>{0.661192715f, 0.667252481f},
-std::array<float,2>{0.298218489f, 0.77444911f},
-std::array<float,2>{0.762733757f, 0.117802113f},
-std::array<float,2>{0.466690242f, 0.314522862f},
-std::array<float,2>{0.976859272f, 0.590865254f},
-std::array<float,2>{0.0952497572f, 0.984969497f},
-std::array<float,2>{0.516116977f, 0.155739963f},
-std::array<float,2>{0.128419578f, 0.0960036814f},
-std::array<float,2>{0.723285139f, 0.756115317f},
-std::array<float,2>{0.358139962f, 0.677038193f},
-std::array<float,2>{0.81760937f, 0.432498693f},
-std::array<float,2>{0.252071172f, 0.246107519f},
-std::array<float,2>{0.789475322f, 0.877864361f},
-std::array<float,2>{0.235719413f, 0.524164319f},
-std::array<float,2>{0.64006722f, 0.278667897f},
-std::array<float,2>{0.0197036844f, 0.474227399f},
-std::array<float,2>{0.596928537f, 0.703974664f},
-std::array<float,2>{0.424907625f, 0.857289255f},
-std::array<float,2>{0.886909425f, 0.0062817242f},
-std::array<float,2>{0.336380124f, 0.39852649f},
-std::array<float,2>{0.854722977f, 0.63241291f},
-std::array<float,2>{0.175597563f, 0.80886358f},
-std::array<float,2>{0.710750163f, 0.0839132071f},
-std::array<float,2>{0.0850978196f, 0.181166887f},
-std::array<float,2>{0.542186081f, 0.964173377f},
-std::array<float,2>{0.47722733f, 0.595440567f},
-std::array<float,2>{0.94503206f, 0.361010611f},
-std::array<float,2>{0.397312135f, 0.0439584441f},
-std::array<float,2>{0.936226547f, 0.821962655f},
-std::array<float,2>{0.0612340011f, 0.744789183f},
-std::array<float,2>{0.593206406f, 0.460294962f},
-std::array<float,2>{0.191015571f, 0.297891229f},
-std::array<float,2>{0.658321321f, 0.556686759f},
-std::array<float,2>{0.302489191f, 0.924264371f},
-std::array<float,2>{0.760558784f, 0.217278972f},
-std::array<float,2>{0.4076868f, 0.450181812f},
-std::array<float,2>{0.899659812f, 0.724892795f},
-std::array<float,2>{3.24085813e-05f, 0.834844291f},
-std::array<float,2>{0.613437414f, 0.0528944209f},
-std::array<float,2>{0.222576186f, 0.193174362f},
-std::array<float,2>{0.651712298f, 0.908834994f},
-std::array<float,2>{0.266754985f, 0.537790358f},
-std::array<float,2>{0.807089627f, 0.295570731f},
-std::array<float,2>{0.366982281f, 0.0666814819f},
-std::array<float,2>{0.834332347f, 0.792275548f},
-std::array<float,2>{0.145236209f, 0.646451473f},
-std::array<float,2>{0.737394631f, 0.37674132f},
-std::array<float,2>{0.112243339f, 0.344871432f},
-std::array<float,2>{0.513735831f, 0.617629766f},
-std::array<float,2>{0.446412861f, 0.939862311f},
-std::array<float,2>{0.995054662f, 0.170594886f},
-std::array<float,2>{0.287573814f, 0.255518645f},
-std::array<float,2>{0.76621294f, 0.503658772f},
-std::array<float,2>{0.206052989f, 0.8919909f},
-std::array<float,2>{0.686471105f, 0.230706215f},
-std::array<float,2>{0.040316686f, 0.022758713f},
-std::array<float,2>{0.57345593f, 0.869472504f},
-std::array<float,2>{0.380134135f, 0.696543396f},
-std::array<float,2>{0.91036576f, 0.493480712f},
-std::array<float,2>{0.48709175f, 0.137750402f},
-std::array<float,2>{0.965768278f, 0.978111684f},
-std::array<float,2>{0.0648610517f, 0.570907831f},
-std::array<float,2>{0.557446837f, 0.338594705f},
-std::array<float,2>{0.169236809f, 0.410769284f},
-std::array<float,2>{0.69829452f, 0.658620477f},
-std::array<float,2>{0.321354032f, 0.771098197f},
-std::array<float,2>{0.86999619f, 0.111852989f},
-std::array<float,2>{0.389404923f, 0.286645412f},
-std::array<float,2>{0.921477973f, 0.541197777f},
-std::array<float,2>{0.0338699855f, 0.914570212f},
-std::array<float,2>{0.566436708f, 0.198317081f},
-std::array<float,2>{0.215044141f, 0.0599266179f},
-std::array<float,2>{0.674549282f, 0.838445008f},
-std::array<float,2>{0.291366845f, 0.729200721f},
-std::array<float,2>{0.775872648f, 0.439238548f},
-std::array<float,2>{0.31758827f, 0.157465041f},
-std::array<float,2>{0.86379981f, 0.951066375f},
-std::array<float,2>{0.161459804f, 0.610091329f},
-std::array<float,2>{0.688187718f, 0.355175674f},
-std::array<float,2>{0.0745945722f, 0.389580876f},
-std::array<float,2>{0.550454557f, 0.650975347f},
-std::array<float,2>{0.497023582f, 0.788037062f},
-std::array<float,2>{0.957914233f, 0.0705287904f},
-std::array<float,2>{0.279118448f, 0.490912557f},
-std::array<float,2>{0.799862206f, 0.689810574f},
-std::array<float,2>{0.229680985f, 0.863449097f},
-std::array<float,2>{0.643014073f, 0.0250753146f},
-std::array<float,2>{0.012674409f, 0.225894764f},
-std::array<float,2>{0.620046437f, 0.903597474f},
-std::array<float,2>{0.415415466f, 0.511238337f},
-std::array<float,2>{0.89405638f, 0.262185216f},
-std::array<float,2>{0.443298101f, 0.124292813f},
-std::array<float,2>{0.986018181f, 0.777401268f},
-std::array<float,2>{0.122510716f, 0.669940531f},
-std::array<float,2>{0.502901852f, 0.420148164f},
-std::array<float,2>{0.151112258f, 0.335823029f},
-std::array<float,2>{0.749836147f, 0.570166528f},
-std::array<float,2>{0.369526625f, 0.971699476f},
-std::array<float,2>{0.839912474f, 0.127284154f},
-std::array<float,2>{0.470449954f, 0.42772004f},
-std::array<float,2>{0.948000431f, 0.681962013f},
-std::array<float,2>{0.0863865837f, 0.758114874f},
-std::array<float,2>{0.536996663f, 0.108679079f},
-std::array<float,2>{0.184930578f, 0.144022539f},
-std::array<float,2>{0.713944018f, 0.995784938f},
-std::array<float,2>{0.329166323f, 0.579492092f},
-std::array<float,2>{0.848056316f, 0.325099796f},
-std::array<float,2>{0.309520066f, 0.00814040098f},
-std::array<float,2>{0.755930245f, 0.844338536f},
-std::array<float,2>{0.202048764f, 0.713417351f},
-std::array<float,2>{0.666534305f, 0.481555402f},
-std::array<float,2>{0.0521665588f, 0.265706658f},
-std::array<float,2>{0.584834337f, 0.521172941f},
-std::array<float,2>{0.399831355f, 0.886418641f},
-std::array<float,2>{0.923519731f, 0.238078982f},
-std::array<float,2>{0.344870001f, 0.372156948f},
-std::array<float,2>{0.826375782f, 0.601948559f},
-std::array<float,2>{0.135073662f, 0.954015255f},
-std::array<float,2>{0.733184159f, 0.171933457f},
-std::array<float,2>{0.106418386f, 0.088553682f},
-std::array<float,2>{0.528940082f, 0.798741698f},
-std::array<float,2>{0.454708159f, 0.636463165f},
-std::array<float,2>{0.970406711f, 0.390725821f},
-std::array<float,2>{0.436132878f, 0.204435706f},
-std::array<float,2>{0.879227996f, 0.930860162f},
-std::array<float,2>{0.0260748211f, 0.553334653f},
-std::array<float,2>{0.604850769f, 0.3085455f},
-std::array<float,2>{0.2435738f, 0.462228507f},
-std::array<float,2>{0.631112993f, 0.739118874f},
-std::array<float,2>{0.263239682f, 0.817674816f},
-std::array<float,2>{0.783829212f, 0.0366650224f},
-std::array<float,2>{0.493891299f, 0.27684325f},
-std::array<float,2>{0.956223726f, 0.528938055f},
-std::array<float,2>{0.0720908493f, 0.881771684f},
-std::array<float,2>{0.550957501f, 0.243365243f},
-std::array<float,2>{0.158811778f, 0.00302007073f},
-std::array<float,2>{0.692463279f, 0.854840696f},
-std::array<float,2>{0.312605917f, 0.708153844f},
-std::array<float,2>{0.85995394f, 0.470375359f},
-std::array<float,2>{0.296533138f, 0.151953638f},
-std::array<float,2>{0.780656278f, 0.991567254f},
-std::array<float,2>{0.213478208f, 0.588701785f},
-std::array<float,2>{0.678092599f, 0.317185789f},
-std::array<float,2>{0.0354783945f, 0.434411466f},
-std::array<float,2>{0.563002408f, 0.673807859f},
-std::array<float,2>{0.384905159f, 0.751930773f},
-std::array<float,2>{0.914190769f, 0.0978616551f},
-std::array<float,2>{0.372416675f, 0.453136861f},
-std::array<float,2>{0.839519382f, 0.746814251f},
-std::array<float,2>{0.153151989f, 0.825870872f},
-std::array<float,2>{0.742910504f, 0.039941676f},
-std::array<float,2>{0.118431002f, 0.213587001f},
-std::array<float,2>{0.504635811f, 0.92820102f},
-std::array<float,2>{0.438074321f, 0.560613453f},
-std::array<float,2>{0.9915663f, 0.301921576f},
-std::array<float,2>{0.420499414f, 0.0794209987f},
-std::array<float,2>{0.898181975f, 0.805554807f},
-std::array<float,2>{0.00815647934f, 0.625599146f},
-std::array<float,2>{0.624909639f, 0.405650556f},
-std::array<float,2>{0.232847646f, 0.366602987f},
-std::array<float,2>{0.647512496f, 0.599844396f},
-std::array<float,2>{0.275407284f, 0.964947283f},
-std::array<float,2>{0.803968012f, 0.186904162f},
-std::array<float,2>{0.404044241f, 0.380728781f},
-std::array<float,2>{0.927516997f, 0.642108977f},
-std::array<float,2>{0.0500729121f, 0.793616951f},
-std::array<float,2>{0.579814255f, 0.0632368177f},
-std::array<float,2>{0.196653768f, 0.166304737f},
-std::array<float,2>{0.670526922f, 0.941800237f},
-std::array<float,2>{0.308101118f, 0.622908235f},
-std::array<float,2>{0.752321601f, 0.350514323f},
-std::array<float,2>{0.33365652f, 0.0493796021f},
-std::array<float,2>{0.843915105f, 0.830618024f},
-std::array<float,2>{0.181662232f, 0.721305311f},
-std::array<float,2>{0.718650043f, 0.449042261f},
-std::array<float,2>{0.0935503766f, 0.289308399f},
-std::array<float,2>{0.533108711f, 0.532154679f},
-std::array<float,2>{0.475996137f, 0.913987994f},
-std::array<float,2>{0.952675402f, 0.191189408f},
-std::array<float,2>{0.258151829f, 0.340923101f},
-std::array<float,2>{0.788303375f, 0.576579928f},
-std::array<float,2>{0.249356136f, 0.982445598f},
-std::array<float,2>{0.627174675f, 0.133260578f},
-std::array<float,2>{0.0295180306f, 0.114056513f},
-std::array<float,2>{0.607909977f, 0.766955614f},
-std::array<float,2>{0.430983365f, 0.662187099f},
-std::array<float,2>{0.878435969f, 0.407607436f},
-std::array<float,2>{0.460504502f, 0.227908522f},
-std::array<float,2>{0.974016368f, 0.896523356f},
-std::array<float,2>{0.104147471f, 0.504517019f},
-std::array<float,2>{0.525222898f, 0.251145184f},
-std::array<float,2>{0.139972135f, 0.496464074f},
-std::array<float,2>{0.72899121f, 0.700206518f},
-std::array<float,2>{0.351099342f, 0.873743474f},
-std::array<float,2>{0.82276541f, 0.0184515584f},
-std::array<float,2>{0.426652253f, 0.355842143f},
-std::array<float,2>{0.885870814f, 0.614242375f},
-std::array<float,2>{0.018691998f, 0.94588846f},
-std::array<float,2>{0.600001574f, 0.161031723f},
-std::array<float,2>{0.241684094f, 0.0770182014f},
-std::array<float,2>{0.635602772f, 0.782519639f},
-std::array<float,2>{0.256468087f, 0.653066516f},
-std::array<float,2>{0.793184161f, 0.382987738f},
-std::array<float,2>{0.351641625f, 0.201218054f},
-std::array<float,2>{0.813983381f, 0.920108795f},
-std::array<float,2>{0.129520953f, 0.545050025f},
-std::array<float,2>{0.720294178f, 0.283181548f},
-std::array<float,2>{0.0993962735f, 0.444603205f},
-std::array<float,2>{0.523285508f, 0.732815444f},
-std::array<float,2>{0.463996142f, 0.842564642f},
-std::array<float,2>{0.983507812f, 0.0553917438f},
-std::array<float,2>{0.297461361f, 0.416932791f},
-std::array<float,2>{0.761811197f, 0.664141655f},
-std::array<float,2>{0.193285346f, 0.775400162f},
-std::array<float,2>{0.66084224f, 0.119374298f},
-std::array<float,2>{0.0554055162f, 0.130079955f},
-std::array<float,2>{0.587006748f, 0.973897934f},
-std::array<float,2>{0.39204827f, 0.564124048f},
-std::array<float,2>{0.933040023f, 0.331332535f},
-std::array<float,2>{0.482762009f, 0.027348917f},
-std::array<float,2>{0.939220846f, 0.862752736f},
-std::array<float,2>{0.0800869092f, 0.694599032f},
-std::array<float,2>{0.546790421f, 0.484696388f},
-std::array<float,2>{0.177257955f, 0.261573881f},
-std::array<float,2>{0.704379559f, 0.513070881f},
-std::array<float,2>{0.341267854f, 0.898656905f},
-std::array<float,2>{0.85622555f, 0.220215827f},
-std::array<float,2>{0.45115456f, 0.476741433f},
-std::array<float,2>{0.99732244f, 0.717514873f},
-std::array<float,2>{0.113911487f, 0.849165857f},
-std::array<float,2>{0.508251309f, 0.0125989728f},
-std::array<float,2>{0.141679898f, 0.241795406f},
-std::array<float,2>{0.740782082f, 0.888356864f},
-std::array<float,2>{0.360989571f, 0.519212782f},
-std::array<float,2>{0.829729438f, 0.27249527f},
-std::array<float,2>{0.271398038f, 0.103305131f},
-std::array<float,2>{0.80898279f, 0.762035429f},
-std::array<float,2>{0.225152835f, 0.687020123f},
-std::array<float,2>{0.655671835f, 0.424305797f},
-std::array<float,2>{0.00547534227f, 0.323784888f},
-std::array<float,2>{0.612557054f, 0.582344353f},
-std::array<float,2>{0.413222402f, 0.997936249f},
-std::array<float,2>{0.90506345f, 0.145146146f},
-std::array<float,2>{0.327168375f, 0.30876556f},
-std::array<float,2>{0.874587476f, 0.547071755f},
-std::array<float,2>{0.167581037f, 0.936410069f},
-std::array<float,2>{0.701366603f, 0.20867379f},
-std::array<float,2>{0.0701567829f, 0.033926025f},
-std::array<float,2>{0.562295914f, 0.812775612f},
-std::array<float,2>{0.488982826f, 0.736456692f},
-std::array<float,2>{0.963765323f, 0.467226237f},
-std::array<float,2>{0.376234293f, 0.176175356f},
-std::array<float,2>{0.907617569f, 0.959399283f},
-std::array<float,2>{0.0448638536f, 0.606341004f},
-std::array<float,2>{0.575985193f, 0.367723495f},
-std::array<float,2>{0.208028346f, 0.397388488f},
-std::array<float,2>{0.681508005f, 0.639817715f},
-std::array<float,2>{0.284871757f, 0.80275172f},
-std::array<float,2>{0.770573378f, 0.0900624245f},
-std::array<float,2>{0.47972402f, 0.362989068f},
-std::array<float,2>{0.941578507f, 0.596019089f},
-std::array<float,2>{0.0829375833f, 0.961874425f},
-std::array<float,2>{0.539728284f, 0.182058841f},
-std::array<float,2>{0.172900379f, 0.0840837508f},
-std::array<float,2>{0.707484841f, 0.811730564f},
-std::array<float,2>{0.338762641f, 0.62953347f},
-std::array<float,2>{0.853321373f, 0.400848567f},
-std::array<float,2>{0.30294463f, 0.215695754f},
-std::array<float,2>{0.758543253f, 0.923217654f},
-std::array<float,2>{0.187698647f, 0.556546032f},
-std::array<float,2>{0.657553375f, 0.300507545f},
-std::array<float,2>{0.0599316284f, 0.457509041f},
-std::array<float,2>{0.590369165f, 0.743176579f},
-std::array<float,2>{0.395700395f, 0.82381624f},
-std::array<float,2>{0.934803009f, 0.046306394f},
-std::array<float,2>{0.356147617f, 0.430393368f},
-std::array<float,2>{0.819622993f, 0.67939353f},
-std::array<float,2>{0.126421615f, 0.754007816f},
-std::array<float,2>{0.726020992f, 0.0950982943f},
-std::array<float,2>{0.0961600095f, 0.152678028f},
-std::array<float,2>{0.518380582f, 0.987549007f},
-std::array<float,2>{0.46789369f, 0.592821062f},
-std::array<float,2>{0.979842424f, 0.312505364f},
-std::array<float,2>{0.421880007f, 0.00503607979f},
-std::array<float,2>{0.888724267f, 0.85764277f},
-std::array<float,2>{0.0233986415f, 0.706616879f},
-std::array<float,2>{0.594336748f, 0.474747121f},
-std::array<float,2>{0.2382254f, 0.279433846f},
-std::array<float,2>{0.637312829f, 0.527288675f},
-std::array<float,2>{0.251682162f, 0.875843406f},
-std::array<float,2>{0.792628169f, 0.248980775f},
-std::array<float,2>{0.38117519f, 0.495919704f},
-std::array<float,2>{0.913252413f, 0.698553264f},
-std::array<float,2>{0.042192772f, 0.868002117f},
-std::array<float,2>{0.571334958f, 0.0210915245f},
-std::array<float,2>{0.203964546f, 0.23412092f},
-std::array<float,2>{0.684550464f, 0.893325329f},
-std::array<float,2>{0.285492718f, 0.501042485f},
-std::array<float,2>{0.767977059f, 0.257609814f},
-std::array<float,2>{0.323081166f, 0.110769659f},
-std::array<float,2>{0.867439628f, 0.771541595f},
-std::array<float,2>{0.170648366f, 0.658066213f},
-std::array<float,2>{0.696148455f, 0.413056225f},
-std::array<float,2>{0.062955156f, 0.337030709f},
-std::array<float,2>{0.55552119f, 0.573273599f},
-std::array<float,2>{0.484533638f, 0.978584468f},
-std::array<float,2>{0.967867374f, 0.139610142f},
-std::array<float,2>{0.267744839f, 0.293168217f},
-std::array<float,2>{0.806304634f, 0.536749482f},
-std::array<float,2>{0.220014215f, 0.907714069f},
-std::array<float,2>{0.649540186f, 0.194621503f},
-std::array<float,2>{0.0027849935f, 0.0508128107f},
-std::array<float,2>{0.616885841f, 0.833480954f},
-std::array<float,2>{0.409875363f, 0.723936439f},
-std::array<float,2>{0.900565386f, 0.452081978f},
-std::array<float,2>{0.44877103f, 0.1690588f},
-std::array<float,2>{0.992379963f, 0.938962162f},
-std::array<float,2>{0.110061407f, 0.620356798f},
-std::array<float,2>{0.512319565f, 0.346120566f},
-std::array<float,2>{0.146800965f, 0.378369391f},
-std::array<float,2>{0.7351228f, 0.646664202f},
-std::array<float,2>{0.365166336f, 0.78996104f},
-std::array<float,2>{0.832590461f, 0.0697141886f},
-std::array<float,2>{0.417920858f, 0.26450038f},
-std::array<float,2>{0.891600907f, 0.50824827f},
-std::array<float,2>{0.0151378429f, 0.905030966f},
-std::array<float,2>{0.618896127f, 0.223960549f},
-std::array<float,2>{0.227200985f, 0.0262035858f},
-std::array<float,2>{0.641142845f, 0.866426528f},
-std::array<float,2>{0.279530793f, 0.688574612f},
-std::array<float,2>{0.798764169f, 0.490007758f},
-std::array<float,2>{0.368067861f, 0.126086026f},
-std::array<float,2>{0.84269172f, 0.970456362f},
-std::array<float,2>{0.150050104f, 0.567016363f},
-std::array<float,2>{0.747856498f, 0.333358139f},
-std::array<float,2>{0.123870023f, 0.41972664f},
-std::array<float,2>{0.500491321f, 0.668999553f},
-std::array<float,2>{0.445092529f, 0.779596567f},
-std::array<float,2>{0.986628532f, 0.121769153f},
-std::array<float,2>{0.29070437f, 0.440627396f},
-std::array<float,2>{0.773617506f, 0.726622641f},
-std::array<float,2>{0.216978595f, 0.83600533f},
-std::array<float,2>{0.672541857f, 0.0620800667f},
-std::array<float,2>{0.0320451558f, 0.197230279f},
-std::array<float,2>{0.569618404f, 0.916228235f},
-std::array<float,2>{0.387718916f, 0.540314615f},
-std::array<float,2>{0.918554604f, 0.287508994f},
-std::array<float,2>{0.499809772f, 0.0736096054f},
-std::array<float,2>{0.960074127f, 0.785803497f},
-std::array<float,2>{0.0767969415f, 0.650024235f},
-std::array<float,2>{0.548818052f, 0.38866052f},
-std::array<float,2>{0.162571713f, 0.352248639f},
-std::array<float,2>{0.691161096f, 0.612812459f},
-std::array<float,2>{0.318802327f, 0.952440321f},
-std::array<float,2>{0.865951121f, 0.159944803f},
-std::array<float,2>{0.456380844f, 0.394468635f},
-std::array<float,2>{0.972134709f, 0.633661866f},
-std::array<float,2>{0.108247906f, 0.799977601f},
-std::array<float,2>{0.530841351f, 0.0866684541f},
-std::array<float,2>{0.133706391f, 0.174180418f},
-std::array<float,2>{0.731994033f, 0.955927014f},
-std::array<float,2>{0.346884251f, 0.603707433f},
-std::array<float,2>{0.824965775f, 0.373474568f},
-std::array<float,2>{0.264483362f, 0.0371687524f},
-std::array<float,2>{0.781765103f, 0.819935977f},
-std::array<float,2>{0.245426103f, 0.740973055f},
-std::array<float,2>{0.62906146f, 0.464720994f},
-std::array<float,2>{0.0245132707f, 0.305170149f},
-std::array<float,2>{0.602012992f, 0.551528692f},
-std::array<float,2>{0.43482098f, 0.933522701f},
-std::array<float,2>{0.882072031f, 0.206849322f},
-std::array<float,2>{0.331095666f, 0.327747434f},
-std::array<float,2>{0.84969753f, 0.580456853f},
-std::array<float,2>{0.186585888f, 0.993702769f},
-std::array<float,2>{0.711308539f, 0.141292557f},
-std::array<float,2>{0.0879448354f, 0.105659805f},
-std::array<float,2>{0.538496435f, 0.760032535f},
-std::array<float,2>{0.471311241f, 0.680310249f},
-std::array<float,2>{0.946178734f, 0.428659767f},
-std::array<float,2>{0.401827484f, 0.234406114f},
-std::array<float,2>{0.924657106f, 0.882994533f},
-std::array<float,2>{0.0545484908f, 0.52211374f},
-std::array<float,2>{0.583276868f, 0.269174576f},
-std::array<float,2>{0.199958071f, 0.484294176f},
-std::array<float,2>{0.665139854f, 0.711100757f},
-std::array<float,2>{0.311050743f, 0.847590625f},
-std::array<float,2>{0.75444001f, 0.00978132058f},
-std::array<float,2>{0.440702677f, 0.302883774f},
-std::array<float,2>{0.988451302f, 0.559516788f},
-std::array<float,2>{0.119510643f, 0.927142143f},
-std::array<float,2>{0.506369948f, 0.211374208f},
-std::array<float,2>{0.155158088f, 0.0424974039f},
-std::array<float,2>{0.745683849f, 0.827806771f},
-std::array<float,2>{0.373117089f, 0.748700738f},
-std::array<float,2>{0.836081743f, 0.455296546f},
-std::array<float,2>{0.274384379f, 0.185426325f},
-std::array<float,2>{0.801422834f, 0.968269765f},
-std::array<float,2>{0.231693104f, 0.599591374f},
-std::array<float,2>{0.645495892f, 0.364762157f},
-std::array<float,2>{0.0109985424f, 0.403279126f},
-std::array<float,2>{0.62250948f, 0.627224326f},
-std::array<float,2>{0.418037623f, 0.808491051f},
-std::array<float,2>{0.895322561f, 0.0806426108f},
-std::array<float,2>{0.3161605f, 0.471744895f},
-std::array<float,2>{0.863239825f, 0.709895253f},
-std::array<float,2>{0.156862423f, 0.852691293f},
-std::array<float,2>{0.694765031f, 0.00153192168f},
-std::array<float,2>{0.0740119219f, 0.244198203f},
-std::array<float,2>{0.553541958f, 0.879996181f},
-std::array<float,2>{0.494479209f, 0.531199038f},
-std::array<float,2>{0.954889476f, 0.27436319f},
-std::array<float,2>{0.384572059f, 0.100556046f},
-std::array<float,2>{0.91783458f, 0.753644943f},
-std::array<float,2>{0.0379364491f, 0.674663305f},
-std::array<float,2>{0.565051079f, 0.436354011f},
-std::array<float,2>{0.212287679f, 0.319172114f},
-std::array<float,2>{0.676577389f, 0.585938156f},
-std::array<float,2>{0.294084281f, 0.988931835f},
-std::array<float,2>{0.778701901f, 0.148714349f},
-std::array<float,2>{0.431644708f, 0.408207744f},
-std::array<float,2>{0.876813531f, 0.660467684f},
-std::array<float,2>{0.0276449285f, 0.767786086f},
-std::array<float,2>{0.60666728f, 0.116360255f},
-std::array<float,2>{0.24653326f, 0.135389403f},
-std::array<float,2>{0.625732541f, 0.98227483f},
-std::array<float,2>{0.259961218f, 0.574486494f},
-std::array<float,2>{0.785188496f, 0.341939837f},
-std::array<float,2>{0.348964393f, 0.0174203534f},
-std::array<float,2>{0.821722329f, 0.872861922f},
-std::array<float,2>{0.138487577f, 0.702922285f},
-std::array<float,2>{0.727206826f, 0.498981088f},
-std::array<float,2>{0.102793403f, 0.253590316f},
-std::array<float,2>{0.526406109f, 0.506934524f},
-std::array<float,2>{0.458346754f, 0.896140456f},
-std::array<float,2>{0.976469338f, 0.229746252f},
-std::array<float,2>{0.305944294f, 0.347925544f},
-std::array<float,2>{0.751578093f, 0.624563038f},
-std::array<float,2>{0.199214995f, 0.944171369f},
-std::array<float,2>{0.668134868f, 0.165084973f},
-std::array<float,2>{0.0473486856f, 0.065157406f},
-std::array<float,2>{0.58165431f, 0.796782553f},
-std::array<float,2>{0.404700339f, 0.644210517f},
-std::array<float,2>{0.928778291f, 0.381763339f},
-std::array<float,2>{0.474457413f, 0.188156247f},
-std::array<float,2>{0.950431406f, 0.911980331f},
-std::array<float,2>{0.090992339f, 0.53447777f},
-std::array<float,2>{0.533717334f, 0.292492062f},
-std::array<float,2>{0.180992573f, 0.446156979f},
-std::array<float,2>{0.715774477f, 0.720018327f},
-std::array<float,2>{0.335762411f, 0.828462005f},
-std::array<float,2>{0.845854044f, 0.0478031002f},
-std::array<float,2>{0.393394411f, 0.329890072f},
-std::array<float,2>{0.930141807f, 0.565382779f},
-std::array<float,2>{0.0569017418f, 0.97537154f},
-std::array<float,2>{0.589658618f, 0.131713241f},
-std::array<float,2>{0.195199907f, 0.118676804f},
-std::array<float,2>{0.663832486f, 0.774121165f},
-std::array<float,2>{0.300172955f, 0.666893363f},
-std::array<float,2>{0.765169322f, 0.414105743f},
-std::array<float,2>{0.34218803f, 0.222019523f},
-std::array<float,2>{0.858002305f, 0.901297688f},
-std::array<float,2>{0.179257259f, 0.514943242f},
-std::array<float,2>{0.705762506f, 0.259263963f},
-std::array<float,2>{0.0792920366f, 0.486827165f},
-std::array<float,2>{0.544746459f, 0.692797542f},
-std::array<float,2>{0.48147127f, 0.861006796f},
-std::array<float,2>{0.940808892f, 0.0297225621f},
-std::array<float,2>{0.254382819f, 0.385271281f},
-std::array<float,2>{0.795726001f, 0.654763937f},
-std::array<float,2>{0.240073174f, 0.783425272f},
-std::array<float,2>{0.63375634f, 0.0746278092f},
-std::array<float,2>{0.017119674f, 0.162799701f},
-std::array<float,2>{0.59774971f, 0.949136853f},
-std::array<float,2>{0.428954542f, 0.616828024f},
-std::array<float,2>{0.884332061f, 0.35923335f},
-std::array<float,2>{0.462585121f, 0.0578659214f},
-std::array<float,2>{0.981785834f, 0.841448188f},
-std::array<float,2>{0.100998677f, 0.730724812f},
-std::array<float,2>{0.519549608f, 0.442436218f},
-std::array<float,2>{0.131234586f, 0.284210175f},
-std::array<float,2>{0.721319556f, 0.544839919f},
-std::array<float,2>{0.354838043f, 0.918224633f},
-std::array<float,2>{0.815449238f, 0.199960843f},
-std::array<float,2>{0.49040544f, 0.466413289f},
-std::array<float,2>{0.962580085f, 0.734811962f},
-std::array<float,2>{0.0679083243f, 0.816047251f},
-std::array<float,2>{0.559256434f, 0.0326855406f},
-std::array<float,2>{0.165260747f, 0.210234001f},
-std::array<float,2>{0.700500309f, 0.933870077f},
-std::array<float,2>{0.324594229f, 0.549541652f},
-std::array<float,2>{0.871598542f, 0.31106019f},
-std::array<float,2>{0.282368124f, 0.0932987407f},
-std::array<float,2>{0.771841347f, 0.800812125f},
-std::array<float,2>{0.20986928f, 0.637950063f},
-std::array<float,2>{0.68336612f, 0.396086395f},
-std::array<float,2>{0.0449419729f, 0.369659245f},
-std::array<float,2>{0.577543378f, 0.608405948f},
-std::array<float,2>{0.377987176f, 0.957932413f},
-std::array<float,2>{0.909520566f, 0.178673729f},
-std::array<float,2>{0.362419754f, 0.270552397f},
-std::array<float,2>{0.830516934f, 0.515748262f},
-std::array<float,2>{0.142829061f, 0.889402449f},
-std::array<float,2>{0.738973737f, 0.238328919f},
-std::array<float,2>{0.116372652f, 0.0141973794f},
-std::array<float,2>{0.509998798f, 0.851447523f},
-std::array<float,2>{0.451385856f, 0.716731846f},
-std::array<float,2>{0.998687863f, 0.478959233f},
-std::array<float,2>{0.411586046f, 0.148339316f},
-std::array<float,2>{0.903481305f, 0.999040663f},
-std::array<float,2>{0.00720987469f, 0.585366786f},
-std::array<float,2>{0.610276282f, 0.321213305f},
-std::array<float,2>{0.223270699f, 0.423740238f},
-std::array<float,2>{0.653433502f, 0.685012817f},
-std::array<float,2>{0.27320388f, 0.764592469f},
-std::array<float,2>{0.811106741f, 0.104109704f},
-std::array<float,2>{0.495252222f, 0.317056656f},
-std::array<float,2>{0.953447521f, 0.588519037f},
-std::array<float,2>{0.072872214f, 0.99127847f},
-std::array<float,2>{0.554021478f, 0.152234584f},
-std::array<float,2>{0.15783523f, 0.0980275199f},
-std::array<float,2>{0.694067776f, 0.751465082f},
-std::array<float,2>{0.314869046f, 0.673549891f},
-std::array<float,2>{0.861996055f, 0.434108764f},
-std::array<float,2>{0.29314366f, 0.243581682f},
-std::array<float,2>{0.778176427f, 0.881396115f},
-std::array<float,2>{0.211447075f, 0.529093146f},
-std::array<float,2>{0.677537262f, 0.276542783f},
-std::array<float,2>{0.038232442f, 0.470664859f},
-std::array<float,2>{0.56553185f, 0.708378971f},
-std::array<float,2>{0.383729964f, 0.854505837f},
-std::array<float,2>{0.916839242f, 0.0033973502f},
-std::array<float,2>{0.37474817f, 0.405475765f},
-std::array<float,2>{0.837415934f, 0.625846744f},
-std::array<float,2>{0.156230077f, 0.805221915f},
-std::array<float,2>{0.744751394f, 0.0792966709f},
-std::array<float,2>{0.120460555f, 0.186558798f},
-std::array<float,2>{0.507395864f, 0.96521306f},
-std::array<float,2>{0.440146714f, 0.599938631f},
-std::array<float,2>{0.990132332f, 0.366245657f},
-std::array<float,2>{0.41942665f, 0.0396075435f},
-std::array<float,2>{0.895746469f, 0.826131344f},
-std::array<float,2>{0.00995650422f, 0.747023284f},
-std::array<float,2>{0.621723711f, 0.453569055f},
-std::array<float,2>{0.23064217f, 0.302043468f},
-std::array<float,2>{0.645816267f, 0.560866594f},
-std::array<float,2>{0.274764746f, 0.927830994f},
-std::array<float,2>{0.802548587f, 0.213764399f},
-std::array<float,2>{0.405811489f, 0.448868066f},
-std::array<float,2>{0.928393304f, 0.721643269f},
-std::array<float,2>{0.0482226014f, 0.830920041f},
-std::array<float,2>{0.580188036f, 0.0497779846f},
-std::array<float,2>{0.197752267f, 0.190938488f},
-std::array<float,2>{0.669455349f, 0.913675189f},
-std::array<float,2>{0.305511951f, 0.53177762f},
-std::array<float,2>{0.750026107f, 0.289282799f},
-std::array<float,2>{0.334240288f, 0.0630691126f},
-std::array<float,2>{0.846797824f, 0.793717146f},
-std::array<float,2>{0.179877385f, 0.642350435f},
-std::array<float,2>{0.716324151f, 0.380608618f},
-std::array<float,2>{0.0906300172f, 0.350199252f},
-std::array<float,2>{0.534488797f, 0.622695029f},
-std::array<float,2>{0.472994745f, 0.941521704f},
-std::array<float,2>{0.949988663f, 0.166074604f},
-std::array<float,2>{0.261511505f, 0.251378447f},
-std::array<float,2>{0.786912203f, 0.504739106f},
-std::array<float,2>{0.247350305f, 0.896759927f},
-std::array<float,2>{0.626748741f, 0.22758323f},
-std::array<float,2>{0.0287099108f, 0.0180685557f},
-std::array<float,2>{0.605866671f, 0.87381947f},
-std::array<float,2>{0.433591723f, 0.70065105f},
-std::array<float,2>{0.875087678f, 0.496203065f},
-std::array<float,2>{0.457538754f, 0.133036047f},
-std::array<float,2>{0.97552979f, 0.982798517f},
-std::array<float,2>{0.102095671f, 0.576308548f},
-std::array<float,2>{0.526123285f, 0.341198981f},
-std::array<float,2>{0.137151599f, 0.407362342f},
-std::array<float,2>{0.72785902f, 0.662459016f},
-std::array<float,2>{0.347820669f, 0.766601801f},
-std::array<float,2>{0.820937216f, 0.113948151f},
-std::array<float,2>{0.428312033f, 0.282784045f},
-std::array<float,2>{0.883755267f, 0.545221329f},
-std::array<float,2>{0.0160672665f, 0.920346558f},
-std::array<float,2>{0.599486411f, 0.201604724f},
-std::array<float,2>{0.23912771f, 0.0554399602f},
-std::array<float,2>{0.634488344f, 0.842315674f},
-std::array<float,2>{0.255430132f, 0.732531428f},
-std::array<float,2>{0.796323657f, 0.444444835f},
-std::array<float,2>{0.354306519f, 0.160857797f},
-std::array<float,2>{0.815054476f, 0.946185589f},
-std::array<float,2>{0.132659376f, 0.613793552f},
-std::array<float,2>{0.721766412f, 0.355709165f},
-std::array<float,2>{0.100070089f, 0.383107066f},
-std::array<float,2>{0.521255016f, 0.653280079f},
-std::array<float,2>{0.461658895f, 0.782341242f},
-std::array<float,2>{0.980961323f, 0.0766966715f},
-std::array<float,2>{0.299663961f, 0.484481126f},
-std::array<float,2>{0.76377809f, 0.694368958f},
-std::array<float,2>{0.193918124f, 0.8624717f},
-std::array<float,2>{0.66217345f, 0.027649885f},
-std::array<float,2>{0.0581123978f, 0.220611244f},
-std::array<float,2>{0.588677168f, 0.898901939f},
-std::array<float,2>{0.393922746f, 0.512824237f},
-std::array<float,2>{0.931015491f, 0.261247426f},
-std::array<float,2>{0.481003404f, 0.119493462f},
-std::array<float,2>{0.939553797f, 0.775779963f},
-std::array<float,2>{0.0783982649f, 0.664535999f},
-std::array<float,2>{0.542993248f, 0.41655013f},
-std::array<float,2>{0.178418145f, 0.331161141f},
-std::array<float,2>{0.706428707f, 0.564222157f},
-std::array<float,2>{0.343202263f, 0.973765016f},
-std::array<float,2>{0.85875988f, 0.130207136f},
-std::array<float,2>{0.452813238f, 0.424032003f},
-std::array<float,2>{0.999336779f, 0.687370718f},
-std::array<float,2>{0.115899675f, 0.761949718f},
-std::array<float,2>{0.511534631f, 0.103209369f},
-std::array<float,2>{0.143613279f, 0.145401925f},
-std::array<float,2>{0.740107179f, 0.997674823f},
-std::array<float,2>{0.362144083f, 0.582245052f},
-std::array<float,2>{0.831611037f, 0.324207693f},
-std::array<float,2>{0.272226393f, 0.0124347489f},
-std::array<float,2>{0.811694682f, 0.849460483f},
-std::array<float,2>{0.223871827f, 0.717624784f},
-std::array<float,2>{0.652712822f, 0.476862073f},
-std::array<float,2>{0.00664912444f, 0.272738457f},
-std::array<float,2>{0.610437632f, 0.519410133f},
-std::array<float,2>{0.410757065f, 0.888643801f},
-std::array<float,2>{0.902587175f, 0.242053419f},
-std::array<float,2>{0.325894177f, 0.36793974f},
-std::array<float,2>{0.872075438f, 0.606087506f},
-std::array<float,2>{0.164400861f, 0.958985448f},
-std::array<float,2>{0.699819148f, 0.175831974f},
-std::array<float,2>{0.0668942034f, 0.0902661458f},
-std::array<float,2>{0.560129285f, 0.803113818f},
-std::array<float,2>{0.492169976f, 0.639960647f},
-std::array<float,2>{0.961666763f, 0.397092938f},
-std::array<float,2>{0.377223372f, 0.208908781f},
-std::array<float,2>{0.908703208f, 0.9362185f},
-std::array<float,2>{0.0466665365f, 0.547177255f},
-std::array<float,2>{0.576800644f, 0.309007853f},
-std::array<float,2>{0.210510835f, 0.466873914f},
-std::array<float,2>{0.681765497f, 0.736695111f},
-std::array<float,2>{0.281700343f, 0.812515378f},
-std::array<float,2>{0.773404181f, 0.0339711942f},
-std::array<float,2>{0.467413068f, 0.278337866f},
-std::array<float,2>{0.979346335f, 0.524386525f},
-std::array<float,2>{0.0970227569f, 0.877648234f},
-std::array<float,2>{0.518627584f, 0.246498108f},
-std::array<float,2>{0.125601679f, 0.00587702636f},
-std::array<float,2>{0.725118279f, 0.857048512f},
-std::array<float,2>{0.356625438f, 0.703818321f},
-std::array<float,2>{0.818888783f, 0.474427611f},
-std::array<float,2>{0.250106007f, 0.155312881f},
-std::array<float,2>{0.791668952f, 0.985163808f},
-std::array<float,2>{0.236863926f, 0.591272295f},
-std::array<float,2>{0.638462305f, 0.31486237f},
-std::array<float,2>{0.0224442892f, 0.43227765f},
-std::array<float,2>{0.594818532f, 0.676840961f},
-std::array<float,2>{0.423789144f, 0.756083369f},
-std::array<float,2>{0.890349329f, 0.0957309306f},
-std::array<float,2>{0.33980459f, 0.460142374f},
-std::array<float,2>{0.851777136f, 0.745027006f},
-std::array<float,2>{0.172533661f, 0.822162569f},
-std::array<float,2>{0.708731949f, 0.0443654917f},
-std::array<float,2>{0.0839602351f, 0.216917872f},
-std::array<float,2>{0.5401209f, 0.923828542f},
-std::array<float,2>{0.478671879f, 0.556960046f},
-std::array<float,2>{0.943290949f, 0.298269242f},
-std::array<float,2>{0.394796997f, 0.0836006552f},
-std::array<float,2>{0.933724642f, 0.808712125f},
-std::array<float,2>{0.058666978f, 0.632809937f},
-std::array<float,2>{0.591661513f, 0.398703992f},
-std::array<float,2>{0.188534662f, 0.361147106f},
-std::array<float,2>{0.656287491f, 0.595679641f},
-std::array<float,2>{0.304566622f, 0.963960648f},
-std::array<float,2>{0.759047449f, 0.181535125f},
-std::array<float,2>{0.408670366f, 0.376512915f},
-std::array<float,2>{0.901872396f, 0.646165967f},
-std::array<float,2>{0.003386172f, 0.792194486f},
-std::array<float,2>{0.615924835f, 0.0664063469f},
-std::array<float,2>{0.219005749f, 0.170868292f},
-std::array<float,2>{0.648902595f, 0.939690948f},
-std::array<float,2>{0.269114166f, 0.617251992f},
-std::array<float,2>{0.805484354f, 0.345119208f},
-std::array<float,2>{0.3632842f, 0.0529798865f},
-std::array<float,2>{0.833643973f, 0.834712803f},
-std::array<float,2>{0.147651479f, 0.724770069f},
-std::array<float,2>{0.735934913f, 0.449916154f},
-std::array<float,2>{0.110665344f, 0.295746118f},
-std::array<float,2>{0.51308459f, 0.53803575f},
-std::array<float,2>{0.447532237f, 0.909032643f},
-std::array<float,2>{0.993580937f, 0.192968354f},
-std::array<float,2>{0.286159545f, 0.338826448f},
-std::array<float,2>{0.769164443f, 0.571130931f},
-std::array<float,2>{0.204619214f, 0.97834599f},
-std::array<float,2>{0.685299158f, 0.13797684f},
-std::array<float,2>{0.0418128893f, 0.112269752f},
-std::array<float,2>{0.570756257f, 0.771434367f},
-std::array<float,2>{0.382273883f, 0.658281088f},
-std::array<float,2>{0.913027585f, 0.41101566f},
-std::array<float,2>{0.485881776f, 0.230799645f},
-std::array<float,2>{0.967660427f, 0.891836822f},
-std::array<float,2>{0.0635040924f, 0.503768742f},
-std::array<float,2>{0.555668712f, 0.255739629f},
-std::array<float,2>{0.171142966f, 0.49318558f},
-std::array<float,2>{0.696391702f, 0.69633007f},
-std::array<float,2>{0.32404235f, 0.869338274f},
-std::array<float,2>{0.86907208f, 0.0226146001f},
-std::array<float,2>{0.387360185f, 0.355324686f},
-std::array<float,2>{0.919262886f, 0.610220909f},
-std::array<float,2>{0.0330590308f, 0.950903058f},
-std::array<float,2>{0.56915617f, 0.157579422f},
-std::array<float,2>{0.217888132f, 0.0706176683f},
-std::array<float,2>{0.673601568f, 0.78769058f},
-std::array<float,2>{0.289481848f, 0.65129149f},
-std::array<float,2>{0.775252402f, 0.389389873f},
-std::array<float,2>{0.319630474f, 0.198721319f},
-std::array<float,2>{0.866697013f, 0.915023923f},
-std::array<float,2>{0.163519159f, 0.541356742f},
-std::array<float,2>{0.690384626f, 0.287085205f},
-std::array<float,2>{0.0773370937f, 0.439065605f},
-std::array<float,2>{0.54753828f, 0.729477882f},
-std::array<float,2>{0.498706758f, 0.838770211f},
-std::array<float,2>{0.959583521f, 0.0597519651f},
-std::array<float,2>{0.281248271f, 0.420247197f},
-std::array<float,2>{0.797260046f, 0.670265436f},
-std::array<float,2>{0.227939829f, 0.777831912f},
-std::array<float,2>{0.642157853f, 0.124134518f},
-std::array<float,2>{0.013778775f, 0.127154633f},
-std::array<float,2>{0.617905915f, 0.97198087f},
-std::array<float,2>{0.416214943f, 0.570018709f},
-std::array<float,2>{0.892456353f, 0.335644603f},
-std::array<float,2>{0.443573564f, 0.025154274f},
-std::array<float,2>{0.98780334f, 0.863691032f},
-std::array<float,2>{0.124173991f, 0.689476252f},
-std::array<float,2>{0.501556814f, 0.491035193f},
-std::array<float,2>{0.149310529f, 0.261750937f},
-std::array<float,2>{0.746774018f, 0.511706471f},
-std::array<float,2>{0.368505716f, 0.903557181f},
-std::array<float,2>{0.843553126f, 0.225814775f},
-std::array<float,2>{0.472224712f, 0.481923819f},
-std::array<float,2>{0.946435928f, 0.713731408f},
-std::array<float,2>{0.0890650153f, 0.844717681f},
-std::array<float,2>{0.537509441f, 0.00781279523f},
-std::array<float,2>{0.186433122f, 0.23781468f},
-std::array<float,2>{0.712332189f, 0.886705458f},
-std::array<float,2>{0.330758959f, 0.521291375f},
-std::array<float,2>{0.851080537f, 0.265979528f},
-std::array<float,2>{0.312204868f, 0.108642086f},
-std::array<float,2>{0.755803764f, 0.757987559f},
-std::array<float,2>{0.200286269f, 0.681668282f},
-std::array<float,2>{0.664774477f, 0.427422613f},
-std::array<float,2>{0.0527654029f, 0.324767917f},
-std::array<float,2>{0.582386315f, 0.579166532f},
-std::array<float,2>{0.400605351f, 0.99587208f},
-std::array<float,2>{0.925200224f, 0.143691137f},
-std::array<float,2>{0.346346259f, 0.308200568f},
-std::array<float,2>{0.826077998f, 0.553563476f},
-std::array<float,2>{0.134241343f, 0.931008995f},
-std::array<float,2>{0.730876446f, 0.204230785f},
-std::array<float,2>{0.10860607f, 0.0371012464f},
-std::array<float,2>{0.529720962f, 0.817461371f},
-std::array<float,2>{0.455381721f, 0.738997042f},
-std::array<float,2>{0.971138716f, 0.462022275f},
-std::array<float,2>{0.433817387f, 0.172283426f},
-std::array<float,2>{0.881459951f, 0.953702569f},
-std::array<float,2>{0.0242217164f, 0.601775169f},
-std::array<float,2>{0.602540076f, 0.372402132f},
-std::array<float,2>{0.244441241f, 0.39098236f},
-std::array<float,2>{0.630279779f, 0.636701405f},
-std::array<float,2>{0.26561451f, 0.798518598f},
-std::array<float,2>{0.783138037f, 0.0887821019f},
-std::array<float,2>{0.438552558f, 0.365202785f},
-std::array<float,2>{0.991137505f, 0.599354386f},
-std::array<float,2>{0.117548116f, 0.968650699f},
-std::array<float,2>{0.505297899f, 0.185190096f},
-std::array<float,2>{0.154199049f, 0.0808253437f},
-std::array<float,2>{0.74343878f, 0.808209121f},
-std::array<float,2>{0.371732712f, 0.627047598f},
-std::array<float,2>{0.837957263f, 0.402835578f},
-std::array<float,2>{0.27649048f, 0.211120427f},
-std::array<float,2>{0.803225756f, 0.926975071f},
-std::array<float,2>{0.233587429f, 0.559299648f},
-std::array<float,2>{0.647069871f, 0.303017676f},
-std::array<float,2>{0.00886514597f, 0.455484957f},
-std::array<float,2>{0.62308687f, 0.748958468f},
-std::array<float,2>{0.421727657f, 0.82806921f},
-std::array<float,2>{0.89687115f, 0.042930983f},
-std::array<float,2>{0.313678414f, 0.436076999f},
-std::array<float,2>{0.861238003f, 0.674323559f},
-std::array<float,2>{0.16003944f, 0.753781676f},
-std::array<float,2>{0.691733241f, 0.100315064f},
-std::array<float,2>{0.0708020106f, 0.148493499f},
-std::array<float,2>{0.552376866f, 0.989142001f},
-std::array<float,2>{0.493032366f, 0.586322486f},
-std::array<float,2>{0.9552387f, 0.318956614f},
-std::array<float,2>{0.385890335f, 0.00182732695f},
-std::array<float,2>{0.91543752f, 0.852822721f},
-std::array<float,2>{0.0361822471f, 0.709712327f},
-std::array<float,2>{0.563539982f, 0.472056776f},
-std::array<float,2>{0.214702681f, 0.274161488f},
-std::array<float,2>{0.678795397f, 0.530853093f},
-std::array<float,2>{0.295069933f, 0.880218029f},
-std::array<float,2>{0.780103385f, 0.244560957f},
-std::array<float,2>{0.430282116f, 0.498743057f},
-std::array<float,2>{0.877849042f, 0.702719569f},
-std::array<float,2>{0.030887099f, 0.87277621f},
-std::array<float,2>{0.60892427f, 0.0172384065f},
-std::array<float,2>{0.248112455f, 0.22957316f},
-std::array<float,2>{0.628370225f, 0.896465003f},
-std::array<float,2>{0.258870482f, 0.50726819f},
-std::array<float,2>{0.788015187f, 0.253786772f},
-std::array<float,2>{0.349946916f, 0.116623349f},
-std::array<float,2>{0.823265254f, 0.767908812f},
-std::array<float,2>{0.139077157f, 0.66018194f},
-std::array<float,2>{0.729771614f, 0.408625603f},
-std::array<float,2>{0.105203055f, 0.342139363f},
-std::array<float,2>{0.523558497f, 0.574311733f},
-std::array<float,2>{0.459134966f, 0.982109189f},
-std::array<float,2>{0.972807467f, 0.135678932f},
-std::array<float,2>{0.307256371f, 0.292779386f},
-std::array<float,2>{0.753637969f, 0.534393251f},
-std::array<float,2>{0.196148857f, 0.911851048f},
-std::array<float,2>{0.671603501f, 0.188430652f},
-std::array<float,2>{0.0494498685f, 0.047502894f},
-std::array<float,2>{0.578567266f, 0.828348696f},
-std::array<float,2>{0.403229743f, 0.719789684f},
-std::array<float,2>{0.926537573f, 0.445971251f},
-std::array<float,2>{0.475518554f, 0.165450931f},
-std::array<float,2>{0.952063978f, 0.943986952f},
-std::array<float,2>{0.0927297249f, 0.624983788f},
-std::array<float,2>{0.531705797f, 0.347878456f},
-std::array<float,2>{0.182715029f, 0.381382793f},
-std::array<float,2>{0.717498481f, 0.644300103f},
-std::array<float,2>{0.33242631f, 0.796629429f},
-std::array<float,2>{0.845001519f, 0.0653777346f},
-std::array<float,2>{0.39136225f, 0.258824885f},
-std::array<float,2>{0.932053566f, 0.514872789f},
-std::array<float,2>{0.0556802303f, 0.900962412f},
-std::array<float,2>{0.586030424f, 0.221901983f},
-std::array<float,2>{0.191908464f, 0.0294296071f},
-std::array<float,2>{0.661792815f, 0.861179054f},
-std::array<float,2>{0.298433661f, 0.692398131f},
-std::array<float,2>{0.763265312f, 0.487202555f},
-std::array<float,2>{0.340460807f, 0.131517723f},
-std::array<float,2>{0.857114673f, 0.975285053f},
-std::array<float,2>{0.176486075f, 0.564984381f},
-std::array<float,2>{0.704100132f, 0.329607129f},
-std::array<float,2>{0.081817776f, 0.414380729f},
-std::array<float,2>{0.544967353f, 0.666631401f},
-std::array<float,2>{0.484240949f, 0.774315059f},
-std::array<float,2>{0.938342035f, 0.119048782f},
-std::array<float,2>{0.256871164f, 0.442712903f},
-std::array<float,2>{0.7948277f, 0.73059535f},
-std::array<float,2>{0.240790546f, 0.841728508f},
-std::array<float,2>{0.636652946f, 0.0576230772f},
-std::array<float,2>{0.0178702082f, 0.199901074f},
-std::array<float,2>{0.601467609f, 0.918011904f},
-std::array<float,2>{0.42687732f, 0.544579506f},
-std::array<float,2>{0.885739446f, 0.284646273f},
-std::array<float,2>{0.463100612f, 0.074454844f},
-std::array<float,2>{0.982924819f, 0.783486009f},
-std::array<float,2>{0.0977516994f, 0.654307127f},
-std::array<float,2>{0.521534085f, 0.385666192f},
-std::array<float,2>{0.130355224f, 0.359082848f},
-std::array<float,2>{0.719270825f, 0.61700058f},
-std::array<float,2>{0.353387684f, 0.948857844f},
-std::array<float,2>{0.813194275f, 0.162868574f},
-std::array<float,2>{0.490166873f, 0.396330684f},
-std::array<float,2>{0.96453619f, 0.637785554f},
-std::array<float,2>{0.0687324926f, 0.801231921f},
-std::array<float,2>{0.561477661f, 0.0937161893f},
-std::array<float,2>{0.166600034f, 0.17823875f},
-std::array<float,2>{0.702352405f, 0.957526565f},
-std::array<float,2>{0.326251924f, 0.608694375f},
-std::array<float,2>{0.873889089f, 0.369937569f},
-std::array<float,2>{0.2834782f, 0.032258831f},
-std::array<float,2>{0.770149291f, 0.816297412f},
-std::array<float,2>{0.207156032f, 0.734377563f},
-std::array<float,2>{0.679764152f, 0.466640234f},
-std::array<float,2>{0.0435104333f, 0.3114568f},
-std::array<float,2>{0.575175643f, 0.549749732f},
-std::array<float,2>{0.375394911f, 0.933595896f},
-std::array<float,2>{0.906308889f, 0.210160062f},
-std::array<float,2>{0.360237122f, 0.320976287f},
-std::array<float,2>{0.828321934f, 0.584981799f},
-std::array<float,2>{0.141215503f, 0.999326706f},
-std::array<float,2>{0.741330683f, 0.147998631f},
-std::array<float,2>{0.114374682f, 0.104374938f},
-std::array<float,2>{0.509506106f, 0.76432395f},
-std::array<float,2>{0.44991836f, 0.684800804f},
-std::array<float,2>{0.99654305f, 0.423522204f},
-std::array<float,2>{0.412755311f, 0.238695219f},
-std::array<float,2>{0.905769765f, 0.889532924f},
-std::array<float,2>{0.00450290693f, 0.516080976f},
-std::array<float,2>{0.611885428f, 0.270922869f},
-std::array<float,2>{0.226161391f, 0.478751481f},
-std::array<float,2>{0.654370308f, 0.716497958f},
-std::array<float,2>{0.270026296f, 0.851145625f},
-std::array<float,2>{0.81003207f, 0.0144063747f},
-std::array<float,2>{0.478250444f, 0.300780505f},
-std::array<float,2>{0.943924785f, 0.556305826f},
-std::array<float,2>{0.0846246183f, 0.922912598f},
-std::array<float,2>{0.541052461f, 0.215425164f},
-std::array<float,2>{0.174086049f, 0.0460283943f},
-std::array<float,2>{0.708992422f, 0.824013054f},
-std::array<float,2>{0.337135524f, 0.743517697f},
-std::array<float,2>{0.853845298f, 0.457273245f},
-std::array<float,2>{0.301465064f, 0.181854784f},
-std::array<float,2>{0.761262298f, 0.961458027f},
-std::array<float,2>{0.190315276f, 0.595935762f},
-std::array<float,2>{0.659482718f, 0.363038749f},
-std::array<float,2>{0.0619107001f, 0.400402457f},
-std::array<float,2>{0.591935992f, 0.629731238f},
-std::array<float,2>{0.397538275f, 0.811850667f},
-std::array<float,2>{0.937156022f, 0.0842707008f},
-std::array<float,2>{0.358544111f, 0.475020677f},
-std::array<float,2>{0.816747189f, 0.706984103f},
-std::array<float,2>{0.127520323f, 0.857822478f},
-std::array<float,2>{0.723675072f, 0.00519238925f},
-std::array<float,2>{0.094336316f, 0.248698756f},
-std::array<float,2>{0.51667428f, 0.87571156f},
-std::array<float,2>{0.464898229f, 0.526942134f},
-std::array<float,2>{0.978270113f, 0.279634923f},
-std::array<float,2>{0.424437314f, 0.0948316157f},
-std::array<float,2>{0.888150156f, 0.75415349f},
-std::array<float,2>{0.0206957962f, 0.679535627f},
-std::array<float,2>{0.595783234f, 0.430463731f},
-std::array<float,2>{0.234979153f, 0.312839389f},
-std::array<float,2>{0.638961315f, 0.593138278f},
-std::array<float,2>{0.253378481f, 0.987520814f},
-std::array<float,2>{0.790138245f, 0.152516425f},
-std::array<float,2>{0.379190505f, 0.412735492f},
-std::array<float,2>{0.911636531f, 0.657924473f},
-std::array<float,2>{0.0395701975f, 0.771735787f},
-std::array<float,2>{0.572988451f, 0.110500731f},
-std::array<float,2>{0.206714511f, 0.139174059f},
-std::array<float,2>{0.687376261f, 0.978796005f},
-std::array<float,2>{0.289027274f, 0.573632956f},
-std::array<float,2>{0.76684761f, 0.337336868f},
-std::array<float,2>{0.320911586f, 0.0213484745f},
-std::array<float,2>{0.870307088f, 0.867703497f},
-std::array<float,2>{0.168613136f, 0.698355615f},
-std::array<float,2>{0.698151708f, 0.495623171f},
-std::array<float,2>{0.066295132f, 0.257409364f},
-std::array<float,2>{0.557668149f, 0.501452088f},
-std::array<float,2>{0.487768024f, 0.893142939f},
-std::array<float,2>{0.965972185f, 0.234264866f},
-std::array<float,2>{0.265953422f, 0.345716059f},
-std::array<float,2>{0.808448792f, 0.620436907f},
-std::array<float,2>{0.220971674f, 0.938500285f},
-std::array<float,2>{0.651329875f, 0.169195235f},
-std::array<float,2>{0.00112921861f, 0.0694995373f},
-std::array<float,2>{0.614697814f, 0.789594531f},
-std::array<float,2>{0.406621218f, 0.646750093f},
-std::array<float,2>{0.898789406f, 0.377933443f},
-std::array<float,2>{0.44616887f, 0.194548532f},
-std::array<float,2>{0.995862901f, 0.907383204f},
-std::array<float,2>{0.112572946f, 0.536878884f},
-std::array<float,2>{0.515383959f, 0.293256402f},
-std::array<float,2>{0.145557597f, 0.451798767f},
-std::array<float,2>{0.73723197f, 0.723757267f},
-std::array<float,2>{0.365288585f, 0.833189309f},
-std::array<float,2>{0.835698962f, 0.0511753187f},
-std::array<float,2>{0.414956063f, 0.333076596f},
-std::array<float,2>{0.893010378f, 0.567217231f},
-std::array<float,2>{0.013131367f, 0.970492005f},
-std::array<float,2>{0.620503426f, 0.126265362f},
-std::array<float,2>{0.229056895f, 0.121971428f},
-std::array<float,2>{0.644105375f, 0.779520392f},
-std::array<float,2>{0.278068513f, 0.669409871f},
-std::array<float,2>{0.799765825f, 0.419579417f},
-std::array<float,2>{0.370176524f, 0.223783121f},
-std::array<float,2>{0.841057539f, 0.904971659f},
-std::array<float,2>{0.151920736f, 0.50800699f},
-std::array<float,2>{0.749017656f, 0.264173985f},
-std::array<float,2>{0.121271707f, 0.489918858f},
-std::array<float,2>{0.503768146f, 0.688828349f},
-std::array<float,2>{0.441670328f, 0.866500378f},
-std::array<float,2>{0.984725595f, 0.0261073224f},
-std::array<float,2>{0.292812943f, 0.388304114f},
-std::array<float,2>{0.776458502f, 0.650304258f},
-std::array<float,2>{0.21670191f, 0.785920262f},
-std::array<float,2>{0.675290942f, 0.0732441992f},
-std::array<float,2>{0.0342441127f, 0.15982604f},
-std::array<float,2>{0.567691624f, 0.952203751f},
-std::array<float,2>{0.390290707f, 0.613163233f},
-std::array<float,2>{0.919944167f, 0.352406949f},
-std::array<float,2>{0.497172803f, 0.0622964315f},
-std::array<float,2>{0.958849251f, 0.836307883f},
-std::array<float,2>{0.0754166171f, 0.726835668f},
-std::array<float,2>{0.549139857f, 0.44076696f},
-std::array<float,2>{0.161115885f, 0.287175536f},
-std::array<float,2>{0.689332724f, 0.540109098f},
-std::array<float,2>{0.316928476f, 0.916288614f},
-std::array<float,2>{0.864903152f, 0.196857229f},
-std::array<float,2>{0.453870684f, 0.464522898f},
-std::array<float,2>{0.969178736f, 0.74082917f},
-std::array<float,2>{0.107332088f, 0.820171177f},
-std::array<float,2>{0.528099597f, 0.0374599993f},
-std::array<float,2>{0.136209086f, 0.20676446f},
-std::array<float,2>{0.733614743f, 0.933238268f},
-std::array<float,2>{0.344495207f, 0.551496625f},
-std::array<float,2>{0.82716769f, 0.304909259f},
-std::array<float,2>{0.262104541f, 0.0866874084f},
-std::array<float,2>{0.785156131f, 0.800176263f},
-std::array<float,2>{0.242399246f, 0.633464336f},
-std::array<float,2>{0.632041872f, 0.394240469f},
-std::array<float,2>{0.0270829648f, 0.373280376f},
-std::array<float,2>{0.604012311f, 0.603821218f},
-std::array<float,2>{0.436764538f, 0.955671608f},
-std::array<float,2>{0.879962802f, 0.17400451f},
-std::array<float,2>{0.328987628f, 0.269508362f},
-std::array<float,2>{0.849279284f, 0.522247255f},
-std::array<float,2>{0.183763102f, 0.883196235f},
-std::array<float,2>{0.713846743f, 0.234680995f},
-std::array<float,2>{0.0872360319f, 0.0101749059f},
-std::array<float,2>{0.536018491f, 0.847289562f},
-std::array<float,2>{0.469577014f, 0.711247623f},
-std::array<float,2>{0.94917357f, 0.48388797f},
-std::array<float,2>{0.399037987f, 0.14145501f},
-std::array<float,2>{0.922203541f, 0.994010091f},
-std::array<float,2>{0.0508033074f, 0.580182493f},
-std::array<float,2>{0.585708022f, 0.32796362f},
-std::array<float,2>{0.202758774f, 0.428364396f},
-std::array<float,2>{0.667736709f, 0.680563331f},
-std::array<float,2>{0.309948772f, 0.759855926f},
-std::array<float,2>{0.757345498f, 0.105806157f},
-std::array<float,2>{0.460140884f, 0.340346664f},
-std::array<float,2>{0.974256754f, 0.577383697f},
-std::array<float,2>{0.103933714f, 0.983499825f},
-std::array<float,2>{0.524811327f, 0.133880556f},
-std::array<float,2>{0.140371665f, 0.115094408f},
-std::array<float,2>{0.729255557f, 0.766496003f},
-std::array<float,2>{0.350756198f, 0.663704216f},
-std::array<float,2>{0.822393119f, 0.406787306f},
-std::array<float,2>{0.258638203f, 0.227256715f},
-std::array<float,2>{0.789041638f, 0.897623956f},
-std::array<float,2>{0.249600798f, 0.505169272f},
-std::array<float,2>{0.627775609f, 0.250354439f},
-std::array<float,2>{0.02983764f, 0.497143388f},
-std::array<float,2>{0.608303905f, 0.700123727f},
-std::array<float,2>{0.431406558f, 0.874170244f},
-std::array<float,2>{0.878261626f, 0.0191353969f},
-std::array<float,2>{0.333038718f, 0.379428089f},
-std::array<float,2>{0.84467864f, 0.641036451f},
-std::array<float,2>{0.182444543f, 0.794131339f},
-std::array<float,2>{0.717917323f, 0.0643585622f},
-std::array<float,2>{0.0927971527f, 0.167260617f},
-std::array<float,2>{0.532610714f, 0.94272697f},
-std::array<float,2>{0.47644949f, 0.62177223f},
-std::array<float,2>{0.952241123f, 0.351012975f},
-std::array<float,2>{0.403569609f, 0.0499574468f},
-std::array<float,2>{0.927002728f, 0.83196187f},
-std::array<float,2>{0.0506950431f, 0.722045183f},
-std::array<float,2>{0.579452455f, 0.447640687f},
-std::array<float,2>{0.196883768f, 0.290132701f},
-std::array<float,2>{0.669950902f, 0.532915533f},
-std::array<float,2>{0.308276623f, 0.912396371f},
-std::array<float,2>{0.75285399f, 0.190106735f},
-std::array<float,2>{0.420214772f, 0.45430693f},
-std::array<float,2>{0.897619307f, 0.747777045f},
-std::array<float,2>{0.00862224214f, 0.824827194f},
-std::array<float,2>{0.624146223f, 0.0401030928f},
-std::array<float,2>{0.233125657f, 0.214439586f},
-std::array<float,2>{0.648198903f, 0.929476023f},
-std::array<float,2>{0.275946021f, 0.56211561f},
-std::array<float,2>{0.804395497f, 0.301398128f},
-std::array<float,2>{0.37296778f, 0.078569293f},
-std::array<float,2>{0.839110613f, 0.80587554f},
-std::array<float,2>{0.152434453f, 0.6262604f},
-std::array<float,2>{0.742589295f, 0.404842407f},
-std::array<float,2>{0.11893335f, 0.36547789f},
-std::array<float,2>{0.50432092f, 0.601302147f},
-std::array<float,2>{0.437592864f, 0.966405272f},
-std::array<float,2>{0.991783023f, 0.185936138f},
-std::array<float,2>{0.296169907f, 0.275940001f},
-std::array<float,2>{0.780953228f, 0.527919233f},
-std::array<float,2>{0.21301955f, 0.882191002f},
-std::array<float,2>{0.678333163f, 0.243042886f},
-std::array<float,2>{0.036025092f, 0.00260436977f},
-std::array<float,2>{0.562909305f, 0.854165733f},
-std::array<float,2>{0.38561067f, 0.707435548f},
-std::array<float,2>{0.914647281f, 0.469725251f},
-std::array<float,2>{0.49349609f, 0.151069477f},
-std::array<float,2>{0.956849754f, 0.991180956f},
-std::array<float,2>{0.0715860203f, 0.589488804f},
-std::array<float,2>{0.551546574f, 0.318012208f},
-std::array<float,2>{0.158583358f, 0.434941918f},
-std::array<float,2>{0.69294405f, 0.672667801f},
-std::array<float,2>{0.313410997f, 0.750223577f},
-std::array<float,2>{0.859659255f, 0.0987000689f},
-std::array<float,2>{0.376551598f, 0.309931576f},
-std::array<float,2>{0.908057988f, 0.548195601f},
-std::array<float,2>{0.044275254f, 0.937113822f},
-std::array<float,2>{0.575369358f, 0.207785696f},
-std::array<float,2>{0.208910197f, 0.0342659242f},
-std::array<float,2>{0.680774093f, 0.814425111f},
-std::array<float,2>{0.284459054f, 0.738222122f},
-std::array<float,2>{0.771371901f, 0.46838057f},
-std::array<float,2>{0.32777667f, 0.177592471f},
-std::array<float,2>{0.874384105f, 0.960814714f},
-std::array<float,2>{0.167422608f, 0.606790662f},
-std::array<float,2>{0.701763093f, 0.36848411f},
-std::array<float,2>{0.0693845972f, 0.397641927f},
-std::array<float,2>{0.56157136f, 0.639111876f},
-std::array<float,2>{0.488448977f, 0.804211915f},
-std::array<float,2>{0.963130057f, 0.0912669078f},
-std::array<float,2>{0.270772785f, 0.477653801f},
-std::array<float,2>{0.809435725f, 0.718416631f},
-std::array<float,2>{0.224849567f, 0.848418057f},
-std::array<float,2>{0.65601778f, 0.0133622242f},
-std::array<float,2>{0.00506057171f, 0.240374029f},
-std::array<float,2>{0.613064766f, 0.887359679f},
-std::array<float,2>{0.413849264f, 0.517778575f},
-std::array<float,2>{0.904663801f, 0.27207759f},
-std::array<float,2>{0.450366378f, 0.102103911f},
-std::array<float,2>{0.998013914f, 0.763106048f},
-std::array<float,2>{0.113413818f, 0.685956299f},
-std::array<float,2>{0.508455157f, 0.425025582f},
-std::array<float,2>{0.142549813f, 0.323024452f},
-std::array<float,2>{0.740574062f, 0.58313632f},
-std::array<float,2>{0.360456318f, 0.996759236f},
-std::array<float,2>{0.829234719f, 0.14627488f},
-std::array<float,2>{0.482964486f, 0.417417794f},
-std::array<float,2>{0.93881911f, 0.665745914f},
-std::array<float,2>{0.0809563175f, 0.776542604f},
-std::array<float,2>{0.546017587f, 0.120980099f},
-std::array<float,2>{0.176805273f, 0.129763633f},
-std::array<float,2>{0.704599559f, 0.972848237f},
-std::array<float,2>{0.341742396f, 0.56317991f},
-std::array<float,2>{0.85559386f, 0.33088398f},
-std::array<float,2>{0.296954483f, 0.0289695896f},
-std::array<float,2>{0.762431383f, 0.86172992f},
-std::array<float,2>{0.192533955f, 0.693779469f},
-std::array<float,2>{0.660338104f, 0.486065537f},
-std::array<float,2>{0.0548735298f, 0.260397017f},
-std::array<float,2>{0.587708294f, 0.511831045f},
-std::array<float,2>{0.392545193f, 0.8997522f},
-std::array<float,2>{0.933461785f, 0.219590828f},
-std::array<float,2>{0.352348417f, 0.35738501f},
-std::array<float,2>{0.813657343f, 0.614685476f},
-std::array<float,2>{0.129351571f, 0.946756959f},
-std::array<float,2>{0.719813347f, 0.16194427f},
-std::array<float,2>{0.0987096056f, 0.0772029385f},
-std::array<float,2>{0.522598207f, 0.781263053f},
-std::array<float,2>{0.464645982f, 0.654120982f},
-std::array<float,2>{0.984168768f, 0.384695709f},
-std::array<float,2>{0.426196486f, 0.202237204f},
-std::array<float,2>{0.886597753f, 0.92133379f},
-std::array<float,2>{0.0192420632f, 0.546874762f},
-std::array<float,2>{0.600450039f, 0.281252146f},
-std::array<float,2>{0.241712332f, 0.443690658f},
-std::array<float,2>{0.635111988f, 0.734263062f},
-std::array<float,2>{0.256231248f, 0.843267798f},
-std::array<float,2>{0.793551862f, 0.0564596988f},
-std::array<float,2>{0.48644498f, 0.253990293f},
-std::array<float,2>{0.965318739f, 0.50250107f},
-std::array<float,2>{0.0653434545f, 0.890803993f},
-std::array<float,2>{0.556732237f, 0.231492847f},
-std::array<float,2>{0.169580847f, 0.0224582329f},
-std::array<float,2>{0.69893986f, 0.870854437f},
-std::array<float,2>{0.322115004f, 0.695831895f},
-std::array<float,2>{0.869515002f, 0.49298209f},
-std::array<float,2>{0.288061887f, 0.136783093f},
-std::array<float,2>{0.766085327f, 0.97696507f},
-std::array<float,2>{0.205203772f, 0.571881413f},
-std::array<float,2>{0.68562305f, 0.339400917f},
-std::array<float,2>{0.0407479294f, 0.411430299f},
-std::array<float,2>{0.574151695f, 0.659515202f},
-std::array<float,2>{0.380820274f, 0.769860387f},
-std::array<float,2>{0.910826802f, 0.112320185f},
-std::array<float,2>{0.366646439f, 0.451153308f},
-std::array<float,2>{0.834825456f, 0.725782037f},
-std::array<float,2>{0.145014375f, 0.835847914f},
-std::array<float,2>{0.737821996f, 0.0546704717f},
-std::array<float,2>{0.111423887f, 0.191767186f},
-std::array<float,2>{0.514184833f, 0.910079718f},
-std::array<float,2>{0.447009772f, 0.538655221f},
-std::array<float,2>{0.994204879f, 0.296323538f},
-std::array<float,2>{0.408090353f, 0.0679428279f},
-std::array<float,2>{0.900138557f, 0.791217864f},
-std::array<float,2>{0.000907806447f, 0.645255744f},
-std::array<float,2>{0.613855302f, 0.375607997f},
-std::array<float,2>{0.222103029f, 0.344304055f},
-std::array<float,2>{0.65213728f, 0.618858397f},
-std::array<float,2>{0.267363101f, 0.941210806f},
-std::array<float,2>{0.807484567f, 0.171167076f},
-std::array<float,2>{0.396669954f, 0.399598122f},
-std::array<float,2>{0.935797632f, 0.631290793f},
-std::array<float,2>{0.0609806478f, 0.810354888f},
-std::array<float,2>{0.593525231f, 0.0825783089f},
-std::array<float,2>{0.190532759f, 0.18046625f},
-std::array<float,2>{0.659169555f, 0.963627219f},
-std::array<float,2>{0.301963538f, 0.594018757f},
-std::array<float,2>{0.759885192f, 0.360237539f},
-std::array<float,2>{0.336503059f, 0.0432079583f},
-std::array<float,2>{0.855140209f, 0.820531964f},
-std::array<float,2>{0.175075278f, 0.745920181f},
-std::array<float,2>{0.710090578f, 0.45975849f},
-std::array<float,2>{0.085634768f, 0.297649145f},
-std::array<float,2>{0.542720199f, 0.558227956f},
-std::array<float,2>{0.476857126f, 0.925153852f},
-std::array<float,2>{0.944744945f, 0.218296111f},
-std::array<float,2>{0.2525585f, 0.315493703f},
-std::array<float,2>{0.78964293f, 0.589987338f},
-std::array<float,2>{0.235958204f, 0.985759914f},
-std::array<float,2>{0.640564978f, 0.154452622f},
-std::array<float,2>{0.0200440735f, 0.0972934887f},
-std::array<float,2>{0.59721899f, 0.757488668f},
-std::array<float,2>{0.425522685f, 0.676223934f},
-std::array<float,2>{0.887367368f, 0.433273822f},
-std::array<float,2>{0.466305792f, 0.247533545f},
-std::array<float,2>{0.977428079f, 0.878089249f},
-std::array<float,2>{0.0948814899f, 0.524783432f},
-std::array<float,2>{0.515730619f, 0.277919471f},
-std::array<float,2>{0.128191069f, 0.473058969f},
-std::array<float,2>{0.7229321f, 0.704426229f},
-std::array<float,2>{0.357607931f, 0.855515957f},
-std::array<float,2>{0.817941725f, 0.00718837371f},
-std::array<float,2>{0.435679525f, 0.371633917f},
-std::array<float,2>{0.879739881f, 0.603491783f},
-std::array<float,2>{0.025774505f, 0.954327345f},
-std::array<float,2>{0.605372369f, 0.173518926f},
-std::array<float,2>{0.243976787f, 0.0891952515f},
-std::array<float,2>{0.631713688f, 0.79700911f},
-std::array<float,2>{0.262806863f, 0.635493577f},
-std::array<float,2>{0.783333361f, 0.3919411f},
-std::array<float,2>{0.345674217f, 0.203757897f},
-std::array<float,2>{0.826842368f, 0.930449426f},
-std::array<float,2>{0.135681152f, 0.554290414f},
-std::array<float,2>{0.732599199f, 0.307146341f},
-std::array<float,2>{0.105655022f, 0.461579412f},
-std::array<float,2>{0.528695822f, 0.73939091f},
-std::array<float,2>{0.454535097f, 0.816512227f},
-std::array<float,2>{0.970132887f, 0.0355552435f},
-std::array<float,2>{0.309062034f, 0.42585665f},
-std::array<float,2>{0.756408393f, 0.682795763f},
-std::array<float,2>{0.201541603f, 0.759285808f},
-std::array<float,2>{0.666237235f, 0.10779617f},
-std::array<float,2>{0.0523405969f, 0.143140897f},
-std::array<float,2>{0.584053814f, 0.994485915f},
-std::array<float,2>{0.400286019f, 0.578246832f},
-std::array<float,2>{0.922955573f, 0.325256139f},
-std::array<float,2>{0.470214218f, 0.00906702224f},
-std::array<float,2>{0.947403789f, 0.845277309f},
-std::array<float,2>{0.0865521654f, 0.714456022f},
-std::array<float,2>{0.536318958f, 0.480735421f},
-std::array<float,2>{0.185335249f, 0.267501324f},
-std::array<float,2>{0.714622676f, 0.520401359f},
-std::array<float,2>{0.330021441f, 0.885611594f},
-std::array<float,2>{0.848319471f, 0.236568511f},
-std::array<float,2>{0.442740411f, 0.492098093f},
-std::array<float,2>{0.985354722f, 0.691114724f},
-std::array<float,2>{0.123009212f, 0.864990354f},
-std::array<float,2>{0.502051353f, 0.0235951804f},
-std::array<float,2>{0.15046379f, 0.225472972f},
-std::array<float,2>{0.749037862f, 0.902887583f},
-std::array<float,2>{0.369684398f, 0.509938896f},
-std::array<float,2>{0.840372384f, 0.263174564f},
-std::array<float,2>{0.278675914f, 0.123624988f},
-std::array<float,2>{0.800527036f, 0.779266536f},
-std::array<float,2>{0.230398998f, 0.671682179f},
-std::array<float,2>{0.643250883f, 0.421284258f},
-std::array<float,2>{0.0121200355f, 0.334546298f},
-std::array<float,2>{0.619215131f, 0.568883657f},
-std::array<float,2>{0.415829659f, 0.971225739f},
-std::array<float,2>{0.893703699f, 0.128812477f},
-std::array<float,2>{0.318320721f, 0.285437405f},
-std::array<float,2>{0.863508224f, 0.542629719f},
-std::array<float,2>{0.161621854f, 0.915465772f},
-std::array<float,2>{0.687715173f, 0.197282523f},
-std::array<float,2>{0.0751791298f, 0.0587241501f},
-std::array<float,2>{0.550033927f, 0.8392995f},
-std::array<float,2>{0.496504605f, 0.73000139f},
-std::array<float,2>{0.957065582f, 0.438211948f},
-std::array<float,2>{0.389029533f, 0.156587437f},
-std::array<float,2>{0.921079636f, 0.949365497f},
-std::array<float,2>{0.0336486474f, 0.61058718f},
-std::array<float,2>{0.567222714f, 0.354409516f},
-std::array<float,2>{0.215423465f, 0.38992247f},
-std::array<float,2>{0.67419976f, 0.652165174f},
-std::array<float,2>{0.291815728f, 0.788196206f},
-std::array<float,2>{0.776328504f, 0.0717243999f},
-std::array<float,2>{0.473978311f, 0.349409938f},
-std::array<float,2>{0.950784266f, 0.623814464f},
-std::array<float,2>{0.0913438052f, 0.944435239f},
-std::array<float,2>{0.53330791f, 0.164332658f},
-std::array<float,2>{0.181435913f, 0.0659202188f},
-std::array<float,2>{0.715210736f, 0.795048654f},
-std::array<float,2>{0.33535555f, 0.643211067f},
-std::array<float,2>{0.846601665f, 0.382023007f},
-std::array<float,2>{0.306395292f, 0.188858762f},
-std::array<float,2>{0.751067579f, 0.910328329f},
-std::array<float,2>{0.198474273f, 0.53336066f},
-std::array<float,2>{0.668791175f, 0.291893959f},
-std::array<float,2>{0.0476717055f, 0.446683705f},
-std::array<float,2>{0.581483483f, 0.719111741f},
-std::array<float,2>{0.405157477f, 0.829522312f},
-std::array<float,2>{0.92937398f, 0.047903385f},
-std::array<float,2>{0.349500388f, 0.409474701f},
-std::array<float,2>{0.822038651f, 0.661365271f},
-std::array<float,2>{0.138175368f, 0.769464195f},
-std::array<float,2>{0.726599455f, 0.115361728f},
-std::array<float,2>{0.103141703f, 0.136648312f},
-std::array<float,2>{0.526943386f, 0.981148303f},
-std::array<float,2>{0.458670139f, 0.57573694f},
-std::array<float,2>{0.976001203f, 0.342944264f},
-std::array<float,2>{0.432335466f, 0.0162655599f},
-std::array<float,2>{0.876412511f, 0.871489763f},
-std::array<float,2>{0.0279355813f, 0.701599896f},
-std::array<float,2>{0.607341826f, 0.499495804f},
-std::array<float,2>{0.246774793f, 0.252879411f},
-std::array<float,2>{0.625400901f, 0.506737649f},
-std::array<float,2>{0.260535955f, 0.894960761f},
-std::array<float,2>{0.78580004f, 0.228806049f},
-std::array<float,2>{0.383891344f, 0.471422672f},
-std::array<float,2>{0.917043626f, 0.710107267f},
-std::array<float,2>{0.0374678113f, 0.85229677f},
-std::array<float,2>{0.564667642f, 6.51007795e-05f},
-std::array<float,2>{0.212839082f, 0.245844886f},
-std::array<float,2>{0.676199794f, 0.879122794f},
-std::array<float,2>{0.294681281f, 0.529907227f},
-std::array<float,2>{0.779274702f, 0.275173515f},
-std::array<float,2>{0.315764129f, 0.101209827f},
-std::array<float,2>{0.862654746f, 0.752580762f},
-std::array<float,2>{0.156710014f, 0.675300837f},
-std::array<float,2>{0.695258141f, 0.436897784f},
-std::array<float,2>{0.0734272599f, 0.319361925f},
-std::array<float,2>{0.552989483f, 0.587008297f},
-std::array<float,2>{0.495091438f, 0.990149856f},
-std::array<float,2>{0.954395831f, 0.149857149f},
-std::array<float,2>{0.273654699f, 0.303723693f},
-std::array<float,2>{0.80116272f, 0.560530484f},
-std::array<float,2>{0.232011437f, 0.925978124f},
-std::array<float,2>{0.644921899f, 0.212653816f},
-std::array<float,2>{0.0114679085f, 0.0418697633f},
-std::array<float,2>{0.62277621f, 0.826540112f},
-std::array<float,2>{0.418749511f, 0.749129951f},
-std::array<float,2>{0.894929707f, 0.4563182f},
-std::array<float,2>{0.44137755f, 0.184171036f},
-std::array<float,2>{0.988988221f, 0.967702985f},
-std::array<float,2>{0.11994493f, 0.598463058f},
-std::array<float,2>{0.505976737f, 0.364060551f},
-std::array<float,2>{0.154369727f, 0.404135615f},
-std::array<float,2>{0.745475411f, 0.628608823f},
-std::array<float,2>{0.373600394f, 0.806963861f},
-std::array<float,2>{0.836763084f, 0.0816755518f},
-std::array<float,2>{0.412011236f, 0.269750625f},
-std::array<float,2>{0.903887093f, 0.516733944f},
-std::array<float,2>{0.00733933877f, 0.889674485f},
-std::array<float,2>{0.609638751f, 0.240012363f},
-std::array<float,2>{0.222946152f, 0.0146769844f},
-std::array<float,2>{0.653871059f, 0.850452602f},
-std::array<float,2>{0.27252093f, 0.714887321f},
-std::array<float,2>{0.810943604f, 0.480352879f},
-std::array<float,2>{0.362951159f, 0.146863744f},
-std::array<float,2>{0.830653787f, 0.998365283f},
-std::array<float,2>{0.143360585f, 0.584753692f},
-std::array<float,2>{0.738572955f, 0.322056204f},
-std::array<float,2>{0.116845794f, 0.421920896f},
-std::array<float,2>{0.51061964f, 0.683818579f},
-std::array<float,2>{0.451786309f, 0.765133083f},
-std::array<float,2>{0.998505235f, 0.104617588f},
-std::array<float,2>{0.283084959f, 0.465320826f},
-std::array<float,2>{0.772391677f, 0.735358655f},
-std::array<float,2>{0.209440172f, 0.814959407f},
-std::array<float,2>{0.682859063f, 0.0317407437f},
-std::array<float,2>{0.0455044396f, 0.209588498f},
-std::array<float,2>{0.57780987f, 0.935272336f},
-std::array<float,2>{0.378541142f, 0.550307989f},
-std::array<float,2>{0.909683168f, 0.311608374f},
-std::array<float,2>{0.491173446f, 0.0924314111f},
-std::array<float,2>{0.962127507f, 0.801836073f},
-std::array<float,2>{0.0674588382f, 0.637177408f},
-std::array<float,2>{0.558871329f, 0.394906491f},
-std::array<float,2>{0.16553162f, 0.370287001f},
-std::array<float,2>{0.700875342f, 0.6078583f},
-std::array<float,2>{0.324838698f, 0.958162248f},
-std::array<float,2>{0.871109009f, 0.178976446f},
-std::array<float,2>{0.462226331f, 0.385787487f},
-std::array<float,2>{0.982110143f, 0.655735433f},
-std::array<float,2>{0.101368763f, 0.784276426f},
-std::array<float,2>{0.520193219f, 0.0753970295f},
-std::array<float,2>{0.13165915f, 0.163193971f},
-std::array<float,2>{0.72114712f, 0.94814229f},
-std::array<float,2>{0.355212778f, 0.615800142f},
-std::array<float,2>{0.816066444f, 0.358397812f},
-std::array<float,2>{0.254868567f, 0.0573021248f},
-std::array<float,2>{0.795351446f, 0.840562344f},
-std::array<float,2>{0.239280432f, 0.731912374f},
-std::array<float,2>{0.63289851f, 0.441815376f},
-std::array<float,2>{0.0169208366f, 0.284031779f},
-std::array<float,2>{0.598244727f, 0.54335779f},
-std::array<float,2>{0.429309696f, 0.919070184f},
-std::array<float,2>{0.884076357f, 0.200541034f},
-std::array<float,2>{0.342644006f, 0.328373849f},
-std::array<float,2>{0.857569516f, 0.566237867f},
-std::array<float,2>{0.178939536f, 0.976032317f},
-std::array<float,2>{0.705282569f, 0.132290617f},
-std::array<float,2>{0.0798017904f, 0.118028283f},
-std::array<float,2>{0.544356823f, 0.774788618f},
-std::array<float,2>{0.481938332f, 0.667176545f},
-std::array<float,2>{0.941040754f, 0.415132731f},
-std::array<float,2>{0.393038809f, 0.221544534f},
-std::array<float,2>{0.930553615f, 0.901614308f},
-std::array<float,2>{0.0575325638f, 0.514328361f},
-std::array<float,2>{0.588941872f, 0.258104295f},
-std::array<float,2>{0.194755778f, 0.487998217f},
-std::array<float,2>{0.663571537f, 0.692378283f},
-std::array<float,2>{0.300347716f, 0.859861016f},
-std::array<float,2>{0.765019715f, 0.0310114343f},
-std::array<float,2>{0.448393345f, 0.294843793f},
-std::array<float,2>{0.992747247f, 0.535802305f},
-std::array<float,2>{0.10961324f, 0.906939626f},
-std::array<float,2>{0.512141347f, 0.193654567f},
-std::array<float,2>{0.147407621f, 0.0523282029f},
-std::array<float,2>{0.734823406f, 0.832600296f},
-std::array<float,2>{0.364623368f, 0.723522961f},
-std::array<float,2>{0.832076192f, 0.45247516f},
-std::array<float,2>{0.26843825f, 0.168699875f},
-std::array<float,2>{0.806126714f, 0.93770653f},
-std::array<float,2>{0.220375687f, 0.619280457f},
-std::array<float,2>{0.650188684f, 0.346706003f},
-std::array<float,2>{0.0023259623f, 0.377117306f},
-std::array<float,2>{0.616356313f, 0.64773345f},
-std::array<float,2>{0.409538418f, 0.790412009f},
-std::array<float,2>{0.900959492f, 0.0683951229f},
-std::array<float,2>{0.32253176f, 0.495040208f},
-std::array<float,2>{0.868146718f, 0.697642803f},
-std::array<float,2>{0.170306206f, 0.868264496f},
-std::array<float,2>{0.695448756f, 0.019827215f},
-std::array<float,2>{0.0633938089f, 0.232660636f},
-std::array<float,2>{0.554743767f, 0.893618286f},
-std::array<float,2>{0.485004246f, 0.500878453f},
-std::array<float,2>{0.968573868f, 0.256814152f},
-std::array<float,2>{0.381431103f, 0.109853119f},
-std::array<float,2>{0.913669646f, 0.77270484f},
-std::array<float,2>{0.0426794551f, 0.657200933f},
-std::array<float,2>{0.571948647f, 0.414051116f},
-std::array<float,2>{0.20353505f, 0.336730808f},
-std::array<float,2>{0.683763862f, 0.572985291f},
-std::array<float,2>{0.286004514f, 0.98018074f},
-std::array<float,2>{0.768394411f, 0.139904037f},
-std::array<float,2>{0.422566891f, 0.430681616f},
-std::array<float,2>{0.889303982f, 0.678064108f},
-std::array<float,2>{0.0225165915f, 0.755452931f},
-std::array<float,2>{0.59414804f, 0.0940952897f},
-std::array<float,2>{0.237334475f, 0.154006869f},
-std::array<float,2>{0.637162149f, 0.987227082f},
-std::array<float,2>{0.251463443f, 0.592496097f},
-std::array<float,2>{0.792422831f, 0.313826382f},
-std::array<float,2>{0.355932564f, 0.00429069856f},
-std::array<float,2>{0.820240855f, 0.859336913f},
-std::array<float,2>{0.126621768f, 0.705489337f},
-std::array<float,2>{0.726380706f, 0.475642115f},
-std::array<float,2>{0.0966426879f, 0.280942202f},
-std::array<float,2>{0.51796174f, 0.52545768f},
-std::array<float,2>{0.468281657f, 0.87658155f},
-std::array<float,2>{0.980391562f, 0.249665812f},
-std::array<float,2>{0.303402841f, 0.361423463f},
-std::array<float,2>{0.757876098f, 0.597358465f},
-std::array<float,2>{0.188030496f, 0.962848127f},
-std::array<float,2>{0.658121586f, 0.183378786f},
-std::array<float,2>{0.0602526069f, 0.085578151f},
-std::array<float,2>{0.590171397f, 0.81061542f},
-std::array<float,2>{0.396080047f, 0.630499065f},
-std::array<float,2>{0.935145915f, 0.401663631f},
-std::array<float,2>{0.480214506f, 0.215898305f},
-std::array<float,2>{0.942242205f, 0.922750115f},
-std::array<float,2>{0.0824460387f, 0.555248916f},
-std::array<float,2>{0.539274335f, 0.299446285f},
-std::array<float,2>{0.173692569f, 0.458127379f},
-std::array<float,2>{0.707928538f, 0.742659926f},
-std::array<float,2>{0.338191777f, 0.822869539f},
-std::array<float,2>{0.852693915f, 0.0451041497f},
-std::array<float,2>{0.401949674f, 0.326288223f},
-std::array<float,2>{0.923988581f, 0.58125186f},
-std::array<float,2>{0.0541799627f, 0.993055284f},
-std::array<float,2>{0.583903313f, 0.142510369f},
-std::array<float,2>{0.199222982f, 0.107235305f},
-std::array<float,2>{0.665911674f, 0.761293769f},
-std::array<float,2>{0.310846448f, 0.680675626f},
-std::array<float,2>{0.754295647f, 0.428793252f},
-std::array<float,2>{0.331998736f, 0.235367835f},
-std::array<float,2>{0.850355446f, 0.884143293f},
-std::array<float,2>{0.18710497f, 0.523437142f},
-std::array<float,2>{0.711475372f, 0.268239766f},
-std::array<float,2>{0.0887698904f, 0.482737899f},
-std::array<float,2>{0.538919628f, 0.712290704f},
-std::array<float,2>{0.47110191f, 0.846025825f},
-std::array<float,2>{0.945720196f, 0.0108238542f},
-std::array<float,2>{0.263751358f, 0.39321807f},
-std::array<float,2>{0.781563282f, 0.634043753f},
-std::array<float,2>{0.245806471f, 0.799467921f},
-std::array<float,2>{0.629406869f, 0.0872875154f},
-std::array<float,2>{0.0251731463f, 0.175332308f},
-std::array<float,2>{0.602254987f, 0.956711531f},
-std::array<float,2>{0.435542762f, 0.605381191f},
-std::array<float,2>{0.882462621f, 0.374211282f},
-std::array<float,2>{0.456682533f, 0.0388439968f},
-std::array<float,2>{0.972539783f, 0.818719268f},
-std::array<float,2>{0.107574843f, 0.742024779f},
-std::array<float,2>{0.530630767f, 0.463029116f},
-std::array<float,2>{0.133267775f, 0.305758566f},
-std::array<float,2>{0.731453359f, 0.552607834f},
-std::array<float,2>{0.347224236f, 0.932602406f},
-std::array<float,2>{0.82450074f, 0.205200449f},
-std::array<float,2>{0.499171674f, 0.440389365f},
-std::array<float,2>{0.960628271f, 0.727629066f},
-std::array<float,2>{0.0764762387f, 0.837287843f},
-std::array<float,2>{0.548263013f, 0.060863018f},
-std::array<float,2>{0.162696332f, 0.196106225f},
-std::array<float,2>{0.690669417f, 0.91713202f},
-std::array<float,2>{0.318921536f, 0.539685965f},
-std::array<float,2>{0.865662098f, 0.288649291f},
-std::array<float,2>{0.29019177f, 0.0725771114f},
-std::array<float,2>{0.774161518f, 0.786587179f},
-std::array<float,2>{0.217383444f, 0.648631454f},
-std::array<float,2>{0.672027409f, 0.386976838f},
-std::array<float,2>{0.0317128375f, 0.352875829f},
-std::array<float,2>{0.569845736f, 0.611853302f},
-std::array<float,2>{0.388433963f, 0.951616824f},
-std::array<float,2>{0.918260872f, 0.158479482f},
-std::array<float,2>{0.367631078f, 0.264677018f},
-std::array<float,2>{0.841901064f, 0.509522676f},
-std::array<float,2>{0.149528667f, 0.906046331f},
-std::array<float,2>{0.747412562f, 0.223483443f},
-std::array<float,2>{0.123395681f, 0.0268386453f},
-std::array<float,2>{0.500239193f, 0.865858495f},
-std::array<float,2>{0.444610029f, 0.687628508f},
-std::array<float,2>{0.98682332f, 0.488473296f},
-std::array<float,2>{0.4171516f, 0.125493169f},
-std::array<float,2>{0.890970051f, 0.969492555f},
-std::array<float,2>{0.0148123056f, 0.567887187f},
-std::array<float,2>{0.61863333f, 0.332808435f},
-std::array<float,2>{0.22675392f, 0.418732494f},
-std::array<float,2>{0.640628159f, 0.667979896f},
-std::array<float,2>{0.280161083f, 0.780512452f},
-std::array<float,2>{0.798169553f, 0.122218899f},
-std::array<float,2>{0.481735289f, 0.330416441f},
-std::array<float,2>{0.940663695f, 0.562806427f},
-std::array<float,2>{0.0794797242f, 0.973495722f},
-std::array<float,2>{0.544671714f, 0.129130378f},
-std::array<float,2>{0.179587618f, 0.120232746f},
-std::array<float,2>{0.705948174f, 0.777286351f},
-std::array<float,2>{0.341923028f, 0.665089786f},
-std::array<float,2>{0.858315408f, 0.417851835f},
-std::array<float,2>{0.299809366f, 0.219082475f},
-std::array<float,2>{0.765464902f, 0.900086462f},
-std::array<float,2>{0.194999918f, 0.512222111f},
-std::array<float,2>{0.663599968f, 0.259912819f},
-std::array<float,2>{0.0567479283f, 0.485829353f},
-std::array<float,2>{0.589529216f, 0.694210649f},
-std::array<float,2>{0.393146873f, 0.862151265f},
-std::array<float,2>{0.929850161f, 0.0284263771f},
-std::array<float,2>{0.354605585f, 0.383908927f},
-std::array<float,2>{0.8157956f, 0.653457344f},
-std::array<float,2>{0.131015837f, 0.782197535f},
-std::array<float,2>{0.721467197f, 0.0778586045f},
-std::array<float,2>{0.100730374f, 0.161282182f},
-std::array<float,2>{0.519878864f, 0.947059095f},
-std::array<float,2>{0.462707281f, 0.615038753f},
-std::array<float,2>{0.981461465f, 0.356775403f},
-std::array<float,2>{0.429093838f, 0.0561165065f},
-std::array<float,2>{0.884546638f, 0.843068838f},
-std::array<float,2>{0.017527204f, 0.73359257f},
-std::array<float,2>{0.598098218f, 0.444228888f},
-std::array<float,2>{0.23993285f, 0.28194803f},
-std::array<float,2>{0.633530021f, 0.546254337f},
-std::array<float,2>{0.253909826f, 0.921500564f},
-std::array<float,2>{0.79542619f, 0.202764094f},
-std::array<float,2>{0.378251016f, 0.467828661f},
-std::array<float,2>{0.909238875f, 0.737328887f},
-std::array<float,2>{0.0452628247f, 0.813947737f},
-std::array<float,2>{0.577355742f, 0.0351417325f},
-std::array<float,2>{0.209540665f, 0.207415745f},
-std::array<float,2>{0.683210969f, 0.936798036f},
-std::array<float,2>{0.282588243f, 0.548715353f},
-std::array<float,2>{0.771625519f, 0.310441613f},
-std::array<float,2>{0.324309975f, 0.0913248658f},
-std::array<float,2>{0.871950805f, 0.803873837f},
-std::array<float,2>{0.165415838f, 0.639431179f},
-std::array<float,2>{0.70021379f, 0.398403794f},
-std::array<float,2>{0.0682133883f, 0.36889872f},
-std::array<float,2>{0.559380829f, 0.607030034f},
-std::array<float,2>{0.490487963f, 0.960021079f},
-std::array<float,2>{0.962709606f, 0.177085742f},
-std::array<float,2>{0.273184717f, 0.271537811f},
-std::array<float,2>{0.811304986f, 0.518489301f},
-std::array<float,2>{0.223543555f, 0.887029588f},
-std::array<float,2>{0.653648913f, 0.240979716f},
-std::array<float,2>{0.00699361134f, 0.0129716992f},
-std::array<float,2>{0.610054135f, 0.847745299f},
-std::array<float,2>{0.41125837f, 0.717971563f},
-std::array<float,2>{0.903625906f, 0.478102982f},
-std::array<float,2>{0.451643795f, 0.145809382f},
-std::array<float,2>{0.998998106f, 0.996324837f},
-std::array<float,2>{0.116478525f, 0.583594918f},
-std::array<float,2>{0.510028005f, 0.322354227f},
-std::array<float,2>{0.14279902f, 0.425651252f},
-std::array<float,2>{0.73901844f, 0.686432123f},
-std::array<float,2>{0.362711161f, 0.763285041f},
-std::array<float,2>{0.83013469f, 0.101609886f},
-std::array<float,2>{0.418314874f, 0.301033437f},
-std::array<float,2>{0.895201564f, 0.561570406f},
-std::array<float,2>{0.0109525351f, 0.929070413f},
-std::array<float,2>{0.622313142f, 0.214012578f},
-std::array<float,2>{0.231477946f, 0.040824756f},
-std::array<float,2>{0.645094335f, 0.824587405f},
-std::array<float,2>{0.274162978f, 0.747164369f},
-std::array<float,2>{0.80162245f, 0.454949081f},
-std::array<float,2>{0.373431653f, 0.186138466f},
-std::array<float,2>{0.836197376f, 0.965920091f},
-std::array<float,2>{0.154789865f, 0.601065516f},
-std::array<float,2>{0.745852411f, 0.365851849f},
-std::array<float,2>{0.119357333f, 0.404771209f},
-std::array<float,2>{0.50659889f, 0.626867652f},
-std::array<float,2>{0.440643668f, 0.806561828f},
-std::array<float,2>{0.988636911f, 0.078615725f},
-std::array<float,2>{0.294260055f, 0.468897104f},
-std::array<float,2>{0.778342307f, 0.707972169f},
-std::array<float,2>{0.212156966f, 0.853602827f},
-std::array<float,2>{0.676402032f, 0.0022298838f},
-std::array<float,2>{0.0377426259f, 0.242217228f},
-std::array<float,2>{0.565314114f, 0.882362366f},
-std::array<float,2>{0.384330779f, 0.527768254f},
-std::array<float,2>{0.917640448f, 0.27555275f},
-std::array<float,2>{0.494262606f, 0.0994945914f},
-std::array<float,2>{0.954653025f, 0.750772178f},
-std::array<float,2>{0.0739405751f, 0.672163427f},
-std::array<float,2>{0.553246558f, 0.435254991f},
-std::array<float,2>{0.157051131f, 0.317540646f},
-std::array<float,2>{0.694490254f, 0.588919044f},
-std::array<float,2>{0.316367865f, 0.990500093f},
-std::array<float,2>{0.862984657f, 0.150643572f},
-std::array<float,2>{0.458080173f, 0.406559914f},
-std::array<float,2>{0.976229548f, 0.663152635f},
-std::array<float,2>{0.102621377f, 0.766108155f},
-std::array<float,2>{0.526684046f, 0.114400826f},
-std::array<float,2>{0.138285041f, 0.134347633f},
-std::array<float,2>{0.72744137f, 0.984373868f},
-std::array<float,2>{0.348655283f, 0.577745199f},
-std::array<float,2>{0.821396947f, 0.340243787f},
-std::array<float,2>{0.260040224f, 0.0186516289f},
-std::array<float,2>{0.785555542f, 0.874762535f},
-std::array<float,2>{0.246237472f, 0.699295938f},
-std::array<float,2>{0.625585973f, 0.497776508f},
-std::array<float,2>{0.0275874399f, 0.250569701f},
-std::array<float,2>{0.606772304f, 0.50552386f},
-std::array<float,2>{0.432002515f, 0.89802146f},
-std::array<float,2>{0.876494646f, 0.226586357f},
-std::array<float,2>{0.335579842f, 0.35155338f},
-std::array<float,2>{0.846158504f, 0.621114314f},
-std::array<float,2>{0.18087776f, 0.943046153f},
-std::array<float,2>{0.715431631f, 0.167856023f},
-std::array<float,2>{0.0910798833f, 0.0636686757f},
-std::array<float,2>{0.534112096f, 0.794860899f},
-std::array<float,2>{0.474350661f, 0.641421378f},
-std::array<float,2>{0.950650036f, 0.379338741f},
-std::array<float,2>{0.404529929f, 0.189471066f},
-std::array<float,2>{0.928984642f, 0.912717223f},
-std::array<float,2>{0.0470885672f, 0.532331824f},
-std::array<float,2>{0.581946433f, 0.290658146f},
-std::array<float,2>{0.198906586f, 0.448163033f},
-std::array<float,2>{0.668343246f, 0.722293615f},
-std::array<float,2>{0.305812359f, 0.83150965f},
-std::array<float,2>{0.751896441f, 0.0505852252f},
-std::array<float,2>{0.445063472f, 0.263575315f},
-std::array<float,2>{0.98647964f, 0.51049149f},
-std::array<float,2>{0.123775661f, 0.902499199f},
-std::array<float,2>{0.500924885f, 0.224787429f},
-std::array<float,2>{0.150328666f, 0.0243767649f},
-std::array<float,2>{0.747783363f, 0.864320815f},
-std::array<float,2>{0.367911845f, 0.690621614f},
-std::array<float,2>{0.842526913f, 0.491532207f},
-std::array<float,2>{0.279697776f, 0.128042236f},
-std::array<float,2>{0.79849875f, 0.971188843f},
-std::array<float,2>{0.227439761f, 0.568785369f},
-std::array<float,2>{0.641456425f, 0.334081084f},
-std::array<float,2>{0.0155772045f, 0.421431541f},
-std::array<float,2>{0.619006157f, 0.671139598f},
-std::array<float,2>{0.417707324f, 0.778657258f},
-std::array<float,2>{0.891346931f, 0.12306685f},
-std::array<float,2>{0.318439186f, 0.437791049f},
-std::array<float,2>{0.866018713f, 0.729592025f},
-std::array<float,2>{0.162310392f, 0.839514375f},
-std::array<float,2>{0.691183031f, 0.0593091585f},
-std::array<float,2>{0.0770356059f, 0.197996542f},
-std::array<float,2>{0.548435628f, 0.915838659f},
-std::array<float,2>{0.499578804f, 0.54236263f},
-std::array<float,2>{0.960259438f, 0.286072522f},
-std::array<float,2>{0.388134241f, 0.0721775964f},
-std::array<float,2>{0.918907344f, 0.788849771f},
-std::array<float,2>{0.0317811072f, 0.651548564f},
-std::array<float,2>{0.569390655f, 0.390291065f},
-std::array<float,2>{0.217099041f, 0.353746742f},
-std::array<float,2>{0.67262274f, 0.610887349f},
-std::array<float,2>{0.290932983f, 0.950033247f},
-std::array<float,2>{0.773808241f, 0.15694277f},
-std::array<float,2>{0.434807718f, 0.392347336f},
-std::array<float,2>{0.88212204f, 0.635048985f},
-std::array<float,2>{0.0246677529f, 0.797669053f},
-std::array<float,2>{0.601710796f, 0.0895136371f},
-std::array<float,2>{0.245151371f, 0.173241183f},
-std::array<float,2>{0.629216373f, 0.954964459f},
-std::array<float,2>{0.264365464f, 0.602568388f},
-std::array<float,2>{0.782123744f, 0.371097296f},
-std::array<float,2>{0.347008556f, 0.0360415094f},
-std::array<float,2>{0.824712098f, 0.817168593f},
-std::array<float,2>{0.133331493f, 0.740096271f},
-std::array<float,2>{0.732337952f, 0.461289167f},
-std::array<float,2>{0.108061895f, 0.306958318f},
-std::array<float,2>{0.531200707f, 0.553984046f},
-std::array<float,2>{0.456097722f, 0.92984134f},
-std::array<float,2>{0.97177726f, 0.203149229f},
-std::array<float,2>{0.311337769f, 0.32604453f},
-std::array<float,2>{0.754754841f, 0.578877687f},
-std::array<float,2>{0.199916765f, 0.994756043f},
-std::array<float,2>{0.665498734f, 0.143013746f},
-std::array<float,2>{0.0542495437f, 0.107919179f},
-std::array<float,2>{0.583240151f, 0.759177387f},
-std::array<float,2>{0.40154916f, 0.683274686f},
-std::array<float,2>{0.92446816f, 0.426586866f},
-std::array<float,2>{0.471654892f, 0.23686102f},
-std::array<float,2>{0.945906162f, 0.885014415f},
-std::array<float,2>{0.0881557688f, 0.519600868f},
-std::array<float,2>{0.538152337f, 0.26698035f},
-std::array<float,2>{0.186869442f, 0.480992913f},
-std::array<float,2>{0.711024404f, 0.714350522f},
-std::array<float,2>{0.331314921f, 0.844796419f},
-std::array<float,2>{0.850060046f, 0.00940559618f},
-std::array<float,2>{0.395805746f, 0.359721661f},
-std::array<float,2>{0.935046732f, 0.594435215f},
-std::array<float,2>{0.0597463325f, 0.962991238f},
-std::array<float,2>{0.590581f, 0.180143803f},
-std::array<float,2>{0.18795611f, 0.0823321193f},
-std::array<float,2>{0.657257497f, 0.809854269f},
-std::array<float,2>{0.30311808f, 0.631452024f},
-std::array<float,2>{0.758622289f, 0.400228739f},
-std::array<float,2>{0.338478506f, 0.217823297f},
-std::array<float,2>{0.85324055f, 0.925469279f},
-std::array<float,2>{0.173170298f, 0.55777514f},
-std::array<float,2>{0.707265317f, 0.296959162f},
-std::array<float,2>{0.0827394947f, 0.459118605f},
-std::array<float,2>{0.53986907f, 0.745119214f},
-std::array<float,2>{0.479863554f, 0.821148694f},
-std::array<float,2>{0.941717148f, 0.0439113416f},
-std::array<float,2>{0.251925766f, 0.432978392f},
-std::array<float,2>{0.792870104f, 0.676573396f},
-std::array<float,2>{0.237961709f, 0.756994426f},
-std::array<float,2>{0.637486041f, 0.0969465449f},
-std::array<float,2>{0.0229813233f, 0.154920131f},
-std::array<float,2>{0.594487429f, 0.986049652f},
-std::array<float,2>{0.422272801f, 0.59062326f},
-std::array<float,2>{0.889056444f, 0.316036254f},
-std::array<float,2>{0.468145847f, 0.00734370388f},
-std::array<float,2>{0.979607761f, 0.856296301f},
-std::array<float,2>{0.0958346575f, 0.704809308f},
-std::array<float,2>{0.518075943f, 0.473170072f},
-std::array<float,2>{0.12620613f, 0.277671009f},
-std::array<float,2>{0.725640535f, 0.525152624f},
-std::array<float,2>{0.35627386f, 0.878692985f},
-std::array<float,2>{0.819569886f, 0.24780792f},
-std::array<float,2>{0.484735101f, 0.492360532f},
-std::array<float,2>{0.968150735f, 0.695606887f},
-std::array<float,2>{0.0625410378f, 0.870379806f},
-std::array<float,2>{0.555378795f, 0.0218827408f},
-std::array<float,2>{0.170872346f, 0.231970862f},
-std::array<float,2>{0.695822477f, 0.891210258f},
-std::array<float,2>{0.322807431f, 0.502056539f},
-std::array<float,2>{0.867293954f, 0.254435748f},
-std::array<float,2>{0.285396695f, 0.11304713f},
-std::array<float,2>{0.767748654f, 0.770359874f},
-std::array<float,2>{0.203666255f, 0.659668326f},
-std::array<float,2>{0.684274554f, 0.411694318f},
-std::array<float,2>{0.0423984565f, 0.339037269f},
-std::array<float,2>{0.571760714f, 0.57167232f},
-std::array<float,2>{0.380894929f, 0.9771474f},
-std::array<float,2>{0.913499355f, 0.137284458f},
-std::array<float,2>{0.36481905f, 0.29658255f},
-std::array<float,2>{0.83292675f, 0.538164735f},
-std::array<float,2>{0.146615535f, 0.909631371f},
-std::array<float,2>{0.734944999f, 0.192023471f},
-std::array<float,2>{0.110143885f, 0.0538475886f},
-std::array<float,2>{0.51265496f, 0.835121393f},
-std::array<float,2>{0.449138761f, 0.726484776f},
-std::array<float,2>{0.992517233f, 0.450413972f},
-std::array<float,2>{0.409975767f, 0.171793625f},
-std::array<float,2>{0.900674105f, 0.940763533f},
-std::array<float,2>{0.00252435333f, 0.618408144f},
-std::array<float,2>{0.617126703f, 0.34412697f},
-std::array<float,2>{0.219914272f, 0.375284284f},
-std::array<float,2>{0.649682522f, 0.644648194f},
-std::array<float,2>{0.26805684f, 0.791876614f},
-std::array<float,2>{0.80661869f, 0.0676362514f},
-std::array<float,2>{0.464128077f, 0.357757032f},
-std::array<float,2>{0.983793974f, 0.615303397f},
-std::array<float,2>{0.099146165f, 0.94731307f},
-std::array<float,2>{0.523085654f, 0.163636699f},
-std::array<float,2>{0.129709244f, 0.0760658458f},
-std::array<float,2>{0.720625997f, 0.78513211f},
-std::array<float,2>{0.352044493f, 0.655930758f},
-std::array<float,2>{0.814406037f, 0.386703312f},
-std::array<float,2>{0.256619632f, 0.20109807f},
-std::array<float,2>{0.793346286f, 0.919545114f},
-std::array<float,2>{0.241441116f, 0.543495953f},
-std::array<float,2>{0.635292888f, 0.283655316f},
-std::array<float,2>{0.0188550912f, 0.442273408f},
-std::array<float,2>{0.599668741f, 0.732149184f},
-std::array<float,2>{0.426412284f, 0.840207219f},
-std::array<float,2>{0.886073589f, 0.0570622347f},
-std::array<float,2>{0.340857983f, 0.415778548f},
-std::array<float,2>{0.856079161f, 0.66772747f},
-std::array<float,2>{0.177698404f, 0.775186539f},
-std::array<float,2>{0.704128504f, 0.117335461f},
-std::array<float,2>{0.0805556178f, 0.132354423f},
-std::array<float,2>{0.546567857f, 0.9765082f},
-std::array<float,2>{0.482531756f, 0.565865457f},
-std::array<float,2>{0.939167976f, 0.328678399f},
-std::array<float,2>{0.391829312f, 0.0304271225f},
-std::array<float,2>{0.932754219f, 0.859971166f},
-std::array<float,2>{0.0555562079f, 0.691698253f},
-std::array<float,2>{0.587296367f, 0.487513095f},
-std::array<float,2>{0.192884207f, 0.258363694f},
-std::array<float,2>{0.660968959f, 0.513681889f},
-std::array<float,2>{0.297762692f, 0.902226388f},
-std::array<float,2>{0.761991918f, 0.220987171f},
-std::array<float,2>{0.413528591f, 0.479913384f},
-std::array<float,2>{0.904800415f, 0.71549356f},
-std::array<float,2>{0.00566911278f, 0.849692643f},
-std::array<float,2>{0.61247474f, 0.0155562414f},
-std::array<float,2>{0.225495279f, 0.239490926f},
-std::array<float,2>{0.655389488f, 0.89014852f},
-std::array<float,2>{0.271027446f, 0.517093003f},
-std::array<float,2>{0.808645189f, 0.270381957f},
-std::array<float,2>{0.361259729f, 0.105218835f},
-std::array<float,2>{0.829970539f, 0.765222371f},
-std::array<float,2>{0.14191629f, 0.684169888f},
-std::array<float,2>{0.741034985f, 0.422689378f},
-std::array<float,2>{0.114053465f, 0.321646959f},
-std::array<float,2>{0.507843018f, 0.584271729f},
-std::array<float,2>{0.450804144f, 0.998570204f},
-std::array<float,2>{0.997306705f, 0.147271305f},
-std::array<float,2>{0.285043985f, 0.312478215f},
-std::array<float,2>{0.77085799f, 0.550210714f},
-std::array<float,2>{0.208415717f, 0.934628248f},
-std::array<float,2>{0.681194723f, 0.209062934f},
-std::array<float,2>{0.0445275009f, 0.0313216895f},
-std::array<float,2>{0.575683951f, 0.814668059f},
-std::array<float,2>{0.376049697f, 0.736249387f},
-std::array<float,2>{0.907405555f, 0.465577662f},
-std::array<float,2>{0.489075154f, 0.179311112f},
-std::array<float,2>{0.963510513f, 0.958604515f},
-std::array<float,2>{0.0699779913f, 0.608047724f},
-std::array<float,2>{0.56215477f, 0.370847374f},
-std::array<float,2>{0.167739227f, 0.395116925f},
-std::array<float,2>{0.701575577f, 0.637635887f},
-std::array<float,2>{0.327628881f, 0.802280068f},
-std::array<float,2>{0.874971509f, 0.092004329f},
-std::array<float,2>{0.385113865f, 0.274434984f},
-std::array<float,2>{0.914361179f, 0.529639661f},
-std::array<float,2>{0.0353540629f, 0.879690945f},
-std::array<float,2>{0.563319862f, 0.245400175f},
-std::array<float,2>{0.213862613f, 0.00076643785f},
-std::array<float,2>{0.677777231f, 0.851954877f},
-std::array<float,2>{0.296776533f, 0.710674286f},
-std::array<float,2>{0.780494034f, 0.470933735f},
-std::array<float,2>{0.312812418f, 0.149996012f},
-std::array<float,2>{0.860296905f, 0.989326239f},
-std::array<float,2>{0.15897496f, 0.587636828f},
-std::array<float,2>{0.692674398f, 0.320183039f},
-std::array<float,2>{0.0718269274f, 0.437453896f},
-std::array<float,2>{0.55117178f, 0.675060332f},
-std::array<float,2>{0.493941009f, 0.752425194f},
-std::array<float,2>{0.956353724f, 0.100949772f},
-std::array<float,2>{0.275772423f, 0.456848919f},
-std::array<float,2>{0.803814173f, 0.749970078f},
-std::array<float,2>{0.232534081f, 0.827121913f},
-std::array<float,2>{0.647943437f, 0.0410658121f},
-std::array<float,2>{0.00794163253f, 0.21209915f},
-std::array<float,2>{0.624664783f, 0.9265486f},
-std::array<float,2>{0.420761824f, 0.559898555f},
-std::array<float,2>{0.898297668f, 0.304217964f},
-std::array<float,2>{0.438284725f, 0.081065096f},
-std::array<float,2>{0.991331816f, 0.807238281f},
-std::array<float,2>{0.118406892f, 0.628341854f},
-std::array<float,2>{0.504684508f, 0.403413296f},
-std::array<float,2>{0.152946904f, 0.363520026f},
-std::array<float,2>{0.743156374f, 0.597703159f},
-std::array<float,2>{0.372160226f, 0.9670223f},
-std::array<float,2>{0.839836597f, 0.184062213f},
-std::array<float,2>{0.475649118f, 0.382544965f},
-std::array<float,2>{0.953094542f, 0.642858922f},
-std::array<float,2>{0.0933972672f, 0.795463324f},
-std::array<float,2>{0.53279382f, 0.0658815727f},
-std::array<float,2>{0.181915998f, 0.165034354f},
-std::array<float,2>{0.718350232f, 0.944878817f},
-std::array<float,2>{0.333886236f, 0.623238623f},
-std::array<float,2>{0.844219267f, 0.348932892f},
-std::array<float,2>{0.307760715f, 0.0485659167f},
-std::array<float,2>{0.751981139f, 0.829895318f},
-std::array<float,2>{0.196442604f, 0.719425261f},
-std::array<float,2>{0.670660615f, 0.44699508f},
-std::array<float,2>{0.0498446561f, 0.291081607f},
-std::array<float,2>{0.579963565f, 0.53380698f},
-std::array<float,2>{0.40421012f, 0.910788894f},
-std::array<float,2>{0.927369356f, 0.189010948f},
-std::array<float,2>{0.351416498f, 0.343490541f},
-std::array<float,2>{0.82313782f, 0.575344145f},
-std::array<float,2>{0.139684349f, 0.980758607f},
-std::array<float,2>{0.728642285f, 0.136160702f},
-std::array<float,2>{0.104443341f, 0.116037011f},
-std::array<float,2>{0.525084972f, 0.768765748f},
-std::array<float,2>{0.460802913f, 0.661928833f},
-std::array<float,2>{0.973781884f, 0.410007924f},
-std::array<float,2>{0.43083322f, 0.229183808f},
-std::array<float,2>{0.878756523f, 0.895255387f},
-std::array<float,2>{0.0296328887f, 0.505948722f},
-std::array<float,2>{0.607635617f, 0.252138644f},
-std::array<float,2>{0.249128595f, 0.499946773f},
-std::array<float,2>{0.627316594f, 0.70190078f},
-std::array<float,2>{0.257987767f, 0.871593654f},
-std::array<float,2>{0.788444817f, 0.0160347186f},
-std::array<float,2>{0.496775717f, 0.288454741f},
-std::array<float,2>{0.95756799f, 0.539105177f},
-std::array<float,2>{0.0744097903f, 0.917544484f},
-std::array<float,2>{0.550627649f, 0.195629492f},
-std::array<float,2>{0.161152765f, 0.061071042f},
-std::array<float,2>{0.688461125f, 0.837668598f},
-std::array<float,2>{0.317829758f, 0.728075147f},
-std::array<float,2>{0.864189446f, 0.439626455f},
-std::array<float,2>{0.291244745f, 0.158941507f},
-std::array<float,2>{0.775519252f, 0.951984465f},
-std::array<float,2>{0.215130106f, 0.611582577f},
-std::array<float,2>{0.674789488f, 0.353055626f},
-std::array<float,2>{0.0340455584f, 0.387435168f},
-std::array<float,2>{0.566830933f, 0.649406433f},
-std::array<float,2>{0.38921544f, 0.786920667f},
-std::array<float,2>{0.921831369f, 0.0728866681f},
-std::array<float,2>{0.369330585f, 0.488873273f},
-std::array<float,2>{0.840246618f, 0.687998652f},
-std::array<float,2>{0.151126355f, 0.865423977f},
-std::array<float,2>{0.749753177f, 0.0271438118f},
-std::array<float,2>{0.122242339f, 0.22283043f},
-std::array<float,2>{0.502555788f, 0.9054901f},
-std::array<float,2>{0.442968756f, 0.508811533f},
-std::array<float,2>{0.986156464f, 0.265472293f},
-std::array<float,2>{0.415215433f, 0.122670859f},
-std::array<float,2>{0.894500196f, 0.780857325f},
-std::array<float,2>{0.0122753466f, 0.66878587f},
-std::array<float,2>{0.619814098f, 0.418438613f},
-std::array<float,2>{0.229788437f, 0.33203277f},
-std::array<float,2>{0.642623246f, 0.567564547f},
-std::array<float,2>{0.278904468f, 0.968783319f},
-std::array<float,2>{0.800105631f, 0.12516813f},
-std::array<float,2>{0.399588197f, 0.429555416f},
-std::array<float,2>{0.923741043f, 0.681561112f},
-std::array<float,2>{0.0519520305f, 0.76091665f},
-std::array<float,2>{0.584689796f, 0.106808066f},
-std::array<float,2>{0.201688185f, 0.141835138f},
-std::array<float,2>{0.666804194f, 0.992203593f},
-std::array<float,2>{0.309200078f, 0.581934154f},
-std::array<float,2>{0.756300271f, 0.327051729f},
-std::array<float,2>{0.329558909f, 0.0112604881f},
-std::array<float,2>{0.847804129f, 0.846612036f},
-std::array<float,2>{0.184613541f, 0.712746203f},
-std::array<float,2>{0.714223742f, 0.483056873f},
-std::array<float,2>{0.0860269889f, 0.2677221f},
-std::array<float,2>{0.536651611f, 0.522460938f},
-std::array<float,2>{0.470529765f, 0.884699285f},
-std::array<float,2>{0.947926641f, 0.235986903f},
-std::array<float,2>{0.263636976f, 0.374843031f},
-std::array<float,2>{0.784086466f, 0.604709148f},
-std::array<float,2>{0.243187994f, 0.956479788f},
-std::array<float,2>{0.631006181f, 0.175041765f},
-std::array<float,2>{0.0263637453f, 0.0878001526f},
-std::array<float,2>{0.604615033f, 0.799283743f},
-std::array<float,2>{0.43637079f, 0.634346247f},
-std::array<float,2>{0.879039705f, 0.392783493f},
-std::array<float,2>{0.454887331f, 0.20588316f},
-std::array<float,2>{0.970680237f, 0.931950152f},
-std::array<float,2>{0.106093906f, 0.55186069f},
-std::array<float,2>{0.529146254f, 0.306448013f},
-std::array<float,2>{0.134968713f, 0.463733673f},
-std::array<float,2>{0.733061254f, 0.741394162f},
-std::array<float,2>{0.345169514f, 0.819040418f},
-std::array<float,2>{0.826519728f, 0.0383015014f},
-std::array<float,2>{0.425232023f, 0.314079225f},
-std::array<float,2>{0.886975527f, 0.592276394f},
-std::array<float,2>{0.0198347587f, 0.986567497f},
-std::array<float,2>{0.596770942f, 0.153664589f},
-std::array<float,2>{0.235556543f, 0.094675906f},
-std::array<float,2>{0.639805079f, 0.755111039f},
-std::array<float,2>{0.252341002f, 0.678461194f},
-std::array<float,2>{0.789259195f, 0.431559712f},
-std::array<float,2>{0.35839504f, 0.249394536f},
-std::array<float,2>{0.817816556f, 0.876133025f},
-std::array<float,2>{0.128745332f, 0.526119709f},
-std::array<float,2>{0.723625124f, 0.280364424f},
-std::array<float,2>{0.0955121368f, 0.476539671f},
-std::array<float,2>{0.516364694f, 0.706023216f},
-std::array<float,2>{0.466436535f, 0.858589768f},
-std::array<float,2>{0.976676345f, 0.00443697907f},
-std::array<float,2>{0.302631021f, 0.402148485f},
-std::array<float,2>{0.760291755f, 0.630319357f},
-std::array<float,2>{0.191332206f, 0.811061859f},
-std::array<float,2>{0.658527255f, 0.0852677301f},
-std::array<float,2>{0.0614334084f, 0.182638049f},
-std::array<float,2>{0.593000233f, 0.96199894f},
-std::array<float,2>{0.397021919f, 0.596686184f},
-std::array<float,2>{0.936453462f, 0.362045556f},
-std::array<float,2>{0.477328479f, 0.0458417945f},
-std::array<float,2>{0.945162296f, 0.822695017f},
-std::array<float,2>{0.0852622837f, 0.742728174f},
-std::array<float,2>{0.542455375f, 0.458955705f},
-std::array<float,2>{0.175322831f, 0.299050003f},
-std::array<float,2>{0.710473299f, 0.554867566f},
-std::array<float,2>{0.335981816f, 0.922246814f},
-std::array<float,2>{0.854785621f, 0.216371432f},
-std::array<float,2>{0.446546227f, 0.452998489f},
-std::array<float,2>{0.994859517f, 0.722812891f},
-std::array<float,2>{0.112045281f, 0.83251071f},
-std::array<float,2>{0.514040828f, 0.0518371351f},
-std::array<float,2>{0.145461842f, 0.194276273f},
-std::array<float,2>{0.737742841f, 0.906702876f},
-std::array<float,2>{0.366720349f, 0.535167992f},
-std::array<float,2>{0.834043503f, 0.294308424f},
-std::array<float,2>{0.266989708f, 0.0691426992f},
-std::array<float,2>{0.806715548f, 0.790594399f},
-std::array<float,2>{0.222304553f, 0.648359954f},
-std::array<float,2>{0.651555836f, 0.37759167f},
-std::array<float,2>{0.000475479901f, 0.34734869f},
-std::array<float,2>{0.613676667f, 0.619678736f},
-std::array<float,2>{0.407304198f, 0.938293517f},
-std::array<float,2>{0.899484992f, 0.168289706f},
-std::array<float,2>{0.321708113f, 0.256317139f},
-std::array<float,2>{0.869642258f, 0.500318587f},
-std::array<float,2>{0.168953881f, 0.894064724f},
-std::array<float,2>{0.698643088f, 0.233085245f},
-std::array<float,2>{0.0644789711f, 0.0201780144f},
-std::array<float,2>{0.557174742f, 0.868662775f},
-std::array<float,2>{0.486856163f, 0.698186755f},
-std::array<float,2>{0.965444863f, 0.494366199f},
-std::array<float,2>{0.380008012f, 0.140213177f},
-std::array<float,2>{0.910454333f, 0.979508877f},
-std::array<float,2>{0.0402329229f, 0.572314858f},
-std::array<float,2>{0.573492169f, 0.336242139f},
-std::array<float,2>{0.205635101f, 0.413238645f},
-std::array<float,2>{0.686054528f, 0.656592607f},
-std::array<float,2>{0.287133694f, 0.772960424f},
-std::array<float,2>{0.766522706f, 0.110164069f},
-std::array<float,2>{0.449500382f, 0.32338509f},
-std::array<float,2>{0.996602416f, 0.582938254f},
-std::array<float,2>{0.115066923f, 0.997274756f},
-std::array<float,2>{0.508902788f, 0.144893065f},
-std::array<float,2>{0.140756696f, 0.102998428f},
-std::array<float,2>{0.741830826f, 0.762613356f},
-std::array<float,2>{0.35951522f, 0.686918795f},
-std::array<float,2>{0.828911245f, 0.424512863f},
-std::array<float,2>{0.269560754f, 0.241401166f},
-std::array<float,2>{0.810111523f, 0.887996078f},
-std::array<float,2>{0.22559987f, 0.518805623f},
-std::array<float,2>{0.654821277f, 0.273071826f},
-std::array<float,2>{0.0040032072f, 0.477328062f},
-std::array<float,2>{0.61163038f, 0.717163622f},
-std::array<float,2>{0.412216008f, 0.848868787f},
-std::array<float,2>{0.90555805f, 0.0121167926f},
-std::array<float,2>{0.326915085f, 0.396780491f},
-std::array<float,2>{0.873083532f, 0.640226305f},
-std::array<float,2>{0.166324407f, 0.803509176f},
-std::array<float,2>{0.703110397f, 0.0903770402f},
-std::array<float,2>{0.0688766241f, 0.176302761f},
-std::array<float,2>{0.560996294f, 0.959827423f},
-std::array<float,2>{0.489721805f, 0.60555768f},
-std::array<float,2>{0.964026451f, 0.367196798f},
-std::array<float,2>{0.375855535f, 0.0332610235f},
-std::array<float,2>{0.9069103f, 0.813441634f},
-std::array<float,2>{0.0430978388f, 0.737233102f},
-std::array<float,2>{0.574437857f, 0.467456758f},
-std::array<float,2>{0.207672566f, 0.309124291f},
-std::array<float,2>{0.680220902f, 0.547843874f},
-std::array<float,2>{0.283798009f, 0.935801566f},
-std::array<float,2>{0.769678831f, 0.208478704f},
-std::array<float,2>{0.427451015f, 0.445086002f},
-std::array<float,2>{0.884797513f, 0.733149171f},
-std::array<float,2>{0.0183971059f, 0.842070401f},
-std::array<float,2>{0.600665927f, 0.0551108792f},
-std::array<float,2>{0.2407206f, 0.201864213f},
-std::array<float,2>{0.63576299f, 0.920660257f},
-std::array<float,2>{0.257767648f, 0.545512557f},
-std::array<float,2>{0.794140458f, 0.28250587f},
-std::array<float,2>{0.352955103f, 0.0764000639f},
-std::array<float,2>{0.812816799f, 0.783092737f},
-std::array<float,2>{0.130735651f, 0.652464688f},
-std::array<float,2>{0.718766749f, 0.383412838f},
-std::array<float,2>{0.098268196f, 0.356192619f},
-std::array<float,2>{0.52207619f, 0.613459468f},
-std::array<float,2>{0.463437766f, 0.945705116f},
-std::array<float,2>{0.98289752f, 0.160275027f},
-std::array<float,2>{0.297953904f, 0.261108249f},
-std::array<float,2>{0.762939453f, 0.513396919f},
-std::array<float,2>{0.191868961f, 0.899034917f},
-std::array<float,2>{0.661518753f, 0.22008279f},
-std::array<float,2>{0.0564483106f, 0.0283004493f},
-std::array<float,2>{0.586910665f, 0.862994134f},
-std::array<float,2>{0.391091138f, 0.695075393f},
-std::array<float,2>{0.932483315f, 0.484942496f},
-std::array<float,2>{0.483558446f, 0.130423948f},
-std::array<float,2>{0.937507093f, 0.974209726f},
-std::array<float,2>{0.0813490301f, 0.563865364f},
-std::array<float,2>{0.54588598f, 0.331552565f},
-std::array<float,2>{0.175873518f, 0.416080892f},
-std::array<float,2>{0.70328021f, 0.664993286f},
-std::array<float,2>{0.340279669f, 0.776128054f},
-std::array<float,2>{0.856888294f, 0.119888239f},
-std::array<float,2>{0.402514279f, 0.289632887f},
-std::array<float,2>{0.925950885f, 0.531704366f},
-std::array<float,2>{0.0488845147f, 0.913491726f},
-std::array<float,2>{0.578994691f, 0.19077307f},
-std::array<float,2>{0.195326924f, 0.0490988195f},
-std::array<float,2>{0.671043694f, 0.830099642f},
-std::array<float,2>{0.306692898f, 0.720715821f},
-std::array<float,2>{0.753163993f, 0.448390424f},
-std::array<float,2>{0.332656384f, 0.166827634f},
-std::array<float,2>{0.845548451f, 0.942302287f},
-std::array<float,2>{0.183510408f, 0.622444808f},
-std::array<float,2>{0.717206359f, 0.349635363f},
-std::array<float,2>{0.0922252908f, 0.379920632f},
-std::array<float,2>{0.532082915f, 0.641889036f},
-std::array<float,2>{0.47477904f, 0.793133855f},
-std::array<float,2>{0.951242805f, 0.0625770316f},
-std::array<float,2>{0.259309381f, 0.49687323f},
-std::array<float,2>{0.787334263f, 0.700919151f},
-std::array<float,2>{0.248856038f, 0.873445332f},
-std::array<float,2>{0.628822327f, 0.0178923849f},
-std::array<float,2>{0.0306496266f, 0.228425905f},
-std::array<float,2>{0.608754516f, 0.897094786f},
-std::array<float,2>{0.429772973f, 0.503966868f},
-std::array<float,2>{0.877025247f, 0.251510888f},
-std::array<float,2>{0.459667861f, 0.113662191f},
-std::array<float,2>{0.973351717f, 0.767322361f},
-std::array<float,2>{0.104727626f, 0.662816465f},
-std::array<float,2>{0.524269462f, 0.407967061f},
-std::array<float,2>{0.1392643f, 0.341322392f},
-std::array<float,2>{0.730152488f, 0.576838076f},
-std::array<float,2>{0.350484699f, 0.983231544f},
-std::array<float,2>{0.824198365f, 0.13366811f},
-std::array<float,2>{0.492433667f, 0.433618009f},
-std::array<float,2>{0.955591023f, 0.673078179f},
-std::array<float,2>{0.070469439f, 0.751013875f},
-std::array<float,2>{0.552101195f, 0.0985398293f},
-std::array<float,2>{0.159500048f, 0.151465654f},
-std::array<float,2>{0.692358136f, 0.991880298f},
-std::array<float,2>{0.314401001f, 0.588002682f},
-std::array<float,2>{0.860827804f, 0.316838115f},
-std::array<float,2>{0.295544744f, 0.00347262667f},
-std::array<float,2>{0.779686511f, 0.855088115f},
-std::array<float,2>{0.213967621f, 0.708574831f},
-std::array<float,2>{0.679664433f, 0.469911277f},
-std::array<float,2>{0.0368723013f, 0.277018845f},
-std::array<float,2>{0.564240336f, 0.528786004f},
-std::array<float,2>{0.386424512f, 0.881253064f},
-std::array<float,2>{0.915921748f, 0.243949443f},
-std::array<float,2>{0.371253937f, 0.366915166f},
-std::array<float,2>{0.838773847f, 0.600301981f},
-std::array<float,2>{0.153568208f, 0.965770721f},
-std::array<float,2>{0.744035065f, 0.187320888f},
-std::array<float,2>{0.117926553f, 0.0797698423f},
-std::array<float,2>{0.505716741f, 0.805099189f},
-std::array<float,2>{0.439039081f, 0.625247657f},
-std::array<float,2>{0.990355372f, 0.405965626f},
-std::array<float,2>{0.420909107f, 0.213338703f},
-std::array<float,2>{0.897183001f, 0.928382874f},
-std::array<float,2>{0.00937857851f, 0.561370373f},
-std::array<float,2>{0.623682201f, 0.302665263f},
-std::array<float,2>{0.234340921f, 0.454034716f},
-std::array<float,2>{0.646493018f, 0.746277332f},
-std::array<float,2>{0.277098864f, 0.825215459f},
-std::array<float,2>{0.80312264f, 0.0391892456f},
-std::array<float,2>{0.468755573f, 0.266448915f},
-std::array<float,2>{0.948616683f, 0.520789504f},
-std::array<float,2>{0.087412402f, 0.88593334f},
-std::array<float,2>{0.535569847f, 0.237753257f},
-std::array<float,2>{0.184398338f, 0.00845398009f},
-std::array<float,2>{0.713047683f, 0.843946517f},
-std::array<float,2>{0.328550011f, 0.712965369f},
-std::array<float,2>{0.848921895f, 0.482215971f},
-std::array<float,2>{0.310161591f, 0.144091874f},
-std::array<float,2>{0.756955445f, 0.99547416f},
-std::array<float,2>{0.202497989f, 0.579921603f},
-std::array<float,2>{0.667424202f, 0.324424475f},
-std::array<float,2>{0.0516533554f, 0.42676872f},
-std::array<float,2>{0.585290074f, 0.68235749f},
-std::array<float,2>{0.398922116f, 0.75839597f},
-std::array<float,2>{0.922455907f, 0.109112464f},
-std::array<float,2>{0.343829185f, 0.462483734f},
-std::array<float,2>{0.827669144f, 0.738427401f},
-std::array<float,2>{0.136593834f, 0.818100989f},
-std::array<float,2>{0.734063685f, 0.0362991653f},
-std::array<float,2>{0.106590554f, 0.204959318f},
-std::array<float,2>{0.527457476f, 0.931158125f},
-std::array<float,2>{0.453608781f, 0.553147852f},
-std::array<float,2>{0.9694646f, 0.307959646f},
-std::array<float,2>{0.437207311f, 0.0879458487f},
-std::array<float,2>{0.880617797f, 0.798097014f},
-std::array<float,2>{0.0268399175f, 0.636069536f},
-std::array<float,2>{0.603690565f, 0.391312987f},
-std::array<float,2>{0.243080184f, 0.372730911f},
-std::array<float,2>{0.632794082f, 0.602354705f},
-std::array<float,2>{0.262366742f, 0.953435421f},
-std::array<float,2>{0.784497023f, 0.172731057f},
-std::array<float,2>{0.389783263f, 0.388678133f},
-std::array<float,2>{0.920628607f, 0.650432289f},
-std::array<float,2>{0.0351186171f, 0.787184119f},
-std::array<float,2>{0.568045139f, 0.0709997863f},
-std::array<float,2>{0.216136053f, 0.158000872f},
-std::array<float,2>{0.675346255f, 0.950447381f},
-std::array<float,2>{0.29204905f, 0.609623134f},
-std::array<float,2>{0.777095497f, 0.354808658f},
-std::array<float,2>{0.316489905f, 0.0603816584f},
-std::array<float,2>{0.864715278f, 0.838031352f},
-std::array<float,2>{0.160325781f, 0.728720069f},
-std::array<float,2>{0.688895226f, 0.438892335f},
-std::array<float,2>{0.0760310963f, 0.28632465f},
-std::array<float,2>{0.549677312f, 0.541790247f},
-std::array<float,2>{0.497986823f, 0.914189219f},
-std::array<float,2>{0.958175659f, 0.199183106f},
-std::array<float,2>{0.277674198f, 0.33534199f},
-std::array<float,2>{0.79895556f, 0.569607377f},
-std::array<float,2>{0.228520826f, 0.972506702f},
-std::array<float,2>{0.644040287f, 0.127887309f},
-std::array<float,2>{0.0133550558f, 0.124581046f},
-std::array<float,2>{0.620732605f, 0.778026223f},
-std::array<float,2>{0.414541095f, 0.670821249f},
-std::array<float,2>{0.893513083f, 0.420494348f},
-std::array<float,2>{0.4422068f, 0.226142749f},
-std::array<float,2>{0.984953463f, 0.903874099f},
-std::array<float,2>{0.121686153f, 0.510926962f},
-std::array<float,2>{0.503221631f, 0.262570769f},
-std::array<float,2>{0.151520133f, 0.490713716f},
-std::array<float,2>{0.748196483f, 0.690299451f},
-std::array<float,2>{0.370609522f, 0.864054263f},
-std::array<float,2>{0.841431677f, 0.0248881783f},
-std::array<float,2>{0.406930983f, 0.345285445f},
-std::array<float,2>{0.899173439f, 0.61769259f},
-std::array<float,2>{0.00170063169f, 0.940203905f},
-std::array<float,2>{0.615125597f, 0.169958562f},
-std::array<float,2>{0.221561164f, 0.0669932514f},
-std::array<float,2>{0.650658548f, 0.792621493f},
-std::array<float,2>{0.266493201f, 0.645792186f},
-std::array<float,2>{0.807972312f, 0.376201868f},
-std::array<float,2>{0.366000265f, 0.192659989f},
-std::array<float,2>{0.83532846f, 0.908294439f},
-std::array<float,2>{0.14610599f, 0.537344694f},
-std::array<float,2>{0.736466289f, 0.294969708f},
-std::array<float,2>{0.113259315f, 0.449451387f},
-std::array<float,2>{0.514869392f, 0.725450635f},
-std::array<float,2>{0.445634097f, 0.834301412f},
-std::array<float,2>{0.995509207f, 0.0532910042f},
-std::array<float,2>{0.288393646f, 0.410178244f},
-std::array<float,2>{0.767223537f, 0.658868253f},
-std::array<float,2>{0.206319109f, 0.770880222f},
-std::array<float,2>{0.686837256f, 0.111620992f},
-std::array<float,2>{0.0393151492f, 0.138588905f},
-std::array<float,2>{0.572624683f, 0.977582097f},
-std::array<float,2>{0.379615724f, 0.570392311f},
-std::array<float,2>{0.911267161f, 0.33801043f},
-std::array<float,2>{0.488189578f, 0.0230219439f},
-std::array<float,2>{0.966431439f, 0.869907081f},
-std::array<float,2>{0.0654708445f, 0.696886539f},
-std::array<float,2>{0.55840373f, 0.493740857f},
-std::array<float,2>{0.168076575f, 0.255359918f},
-std::array<float,2>{0.697397113f, 0.503325105f},
-std::array<float,2>{0.32038638f, 0.892496288f},
-std::array<float,2>{0.870674312f, 0.231031522f},
-std::array<float,2>{0.465534747f, 0.473761946f},
-std::array<float,2>{0.977560759f, 0.703445554f},
-std::array<float,2>{0.0939918384f, 0.85660845f},
-std::array<float,2>{0.517455697f, 0.00668628747f},
-std::array<float,2>{0.127019286f, 0.246987253f},
-std::array<float,2>{0.724322259f, 0.877090037f},
-std::array<float,2>{0.359135062f, 0.523456872f},
-std::array<float,2>{0.81722194f, 0.278833002f},
-std::array<float,2>{0.253874749f, 0.0966153592f},
-std::array<float,2>{0.790939808f, 0.756638348f},
-std::array<float,2>{0.234447896f, 0.677361548f},
-std::array<float,2>{0.639647543f, 0.431671739f},
-std::array<float,2>{0.0214145556f, 0.314990133f},
-std::array<float,2>{0.5963642f, 0.591394842f},
-std::array<float,2>{0.424054623f, 0.98441273f},
-std::array<float,2>{0.888296783f, 0.155896112f},
-std::array<float,2>{0.337868631f, 0.298550814f},
-std::array<float,2>{0.854462802f, 0.557388127f},
-std::array<float,2>{0.174680755f, 0.924765229f},
-std::array<float,2>{0.709568024f, 0.217696071f},
-std::array<float,2>{0.0841702744f, 0.0446724556f},
-std::array<float,2>{0.541767299f, 0.821617782f},
-std::array<float,2>{0.47787568f, 0.744480491f},
-std::array<float,2>{0.943503916f, 0.46060726f},
-std::array<float,2>{0.398129076f, 0.180681765f},
-std::array<float,2>{0.936765432f, 0.964555025f},
-std::array<float,2>{0.0621150732f, 0.595160723f},
-std::array<float,2>{0.592470467f, 0.360537052f},
-std::array<float,2>{0.189831167f, 0.399301231f},
-std::array<float,2>{0.660037458f, 0.632184863f},
-std::array<float,2>{0.300828159f, 0.809564412f},
-std::array<float,2>{0.760870516f, 0.0831378698f},
-std::array<float,2>{0.491340369f, 0.369237632f},
-std::array<float,2>{0.961364985f, 0.608937979f},
-std::array<float,2>{0.0673638582f, 0.95742929f},
-std::array<float,2>{0.55973798f, 0.178087026f},
-std::array<float,2>{0.165013462f, 0.092820324f},
-std::array<float,2>{0.699622869f, 0.801652908f},
-std::array<float,2>{0.32553938f, 0.638348043f},
-std::array<float,2>{0.872579455f, 0.395820588f},
-std::array<float,2>{0.281862766f, 0.210474059f},
-std::array<float,2>{0.77276063f, 0.93410778f},
-std::array<float,2>{0.210419044f, 0.548858821f},
-std::array<float,2>{0.682164013f, 0.310800195f},
-std::array<float,2>{0.0460460298f, 0.466269612f},
-std::array<float,2>{0.576272905f, 0.735271931f},
-std::array<float,2>{0.37774995f, 0.815528154f},
-std::array<float,2>{0.908627689f, 0.0330595151f},
-std::array<float,2>{0.361495137f, 0.423037469f},
-std::array<float,2>{0.8315323f, 0.68514514f},
-std::array<float,2>{0.144120231f, 0.763828635f},
-std::array<float,2>{0.73928231f, 0.103993021f},
-std::array<float,2>{0.115671232f, 0.147783101f},
-std::array<float,2>{0.510887742f, 0.999529362f},
-std::array<float,2>{0.452184707f, 0.58590734f},
-std::array<float,2>{0.999729276f, 0.320672631f},
-std::array<float,2>{0.410263062f, 0.0139284916f},
-std::array<float,2>{0.902932048f, 0.85101217f},
-std::array<float,2>{0.00603736425f, 0.716184974f},
-std::array<float,2>{0.611130595f, 0.479379088f},
-std::array<float,2>{0.224307343f, 0.271018475f},
-std::array<float,2>{0.65318948f, 0.516406f},
-std::array<float,2>{0.27196604f, 0.888914049f},
-std::array<float,2>{0.812174082f, 0.239214465f},
-std::array<float,2>{0.394375056f, 0.486559808f},
-std::array<float,2>{0.931378365f, 0.693067431f},
-std::array<float,2>{0.057724122f, 0.860537291f},
-std::array<float,2>{0.588173866f, 0.030135693f},
-std::array<float,2>{0.193693683f, 0.222599149f},
-std::array<float,2>{0.662657797f, 0.900696695f},
-std::array<float,2>{0.29891488f, 0.515304089f},
-std::array<float,2>{0.764464557f, 0.259695053f},
-std::array<float,2>{0.343670815f, 0.118322939f},
-std::array<float,2>{0.859099925f, 0.773660421f},
-std::array<float,2>{0.177804112f, 0.666065276f},
-std::array<float,2>{0.70686847f, 0.414759159f},
-std::array<float,2>{0.0787367299f, 0.329262316f},
-std::array<float,2>{0.543482006f, 0.564714968f},
-std::array<float,2>{0.480888754f, 0.97503233f},
-std::array<float,2>{0.940345764f, 0.130998358f},
-std::array<float,2>{0.255264938f, 0.28480202f},
-std::array<float,2>{0.796389401f, 0.54416585f},
-std::array<float,2>{0.238363028f, 0.918865383f},
-std::array<float,2>{0.633883595f, 0.199292675f},
-std::array<float,2>{0.0163533073f, 0.0583441779f},
-std::array<float,2>{0.598861039f, 0.841179907f},
-std::array<float,2>{0.427759707f, 0.730979204f},
-std::array<float,2>{0.883182883f, 0.442949563f},
-std::array<float,2>{0.461104989f, 0.16249232f},
-std::array<float,2>{0.980885327f, 0.948450506f},
-std::array<float,2>{0.100143231f, 0.616511703f},
-std::array<float,2>{0.520838678f, 0.35853526f},
-std::array<float,2>{0.131913751f, 0.385085523f},
-std::array<float,2>{0.722295165f, 0.654954255f},
-std::array<float,2>{0.353635192f, 0.783820629f},
-std::array<float,2>{0.814453423f, 0.0747098029f},
-std::array<float,2>{0.43300283f, 0.253040791f},
-std::array<float,2>{0.875838697f, 0.507567048f},
-std::array<float,2>{0.0289898105f, 0.895592511f},
-std::array<float,2>{0.606290758f, 0.229988709f},
-std::array<float,2>{0.247970313f, 0.0169292763f},
-std::array<float,2>{0.6261639f, 0.872230053f},
-std::array<float,2>{0.260907441f, 0.702335238f},
-std::array<float,2>{0.78653264f, 0.498072326f},
-std::array<float,2>{0.348437607f, 0.135064036f},
-std::array<float,2>{0.820657194f, 0.98174715f},
-std::array<float,2>{0.137451842f, 0.574996293f},
-std::array<float,2>{0.728115499f, 0.342342645f},
-std::array<float,2>{0.101619467f, 0.409095109f},
-std::array<float,2>{0.525707424f, 0.661001265f},
-std::array<float,2>{0.457079262f, 0.768546879f},
-std::array<float,2>{0.974916458f, 0.117128246f},
-std::array<float,2>{0.304707825f, 0.445637435f},
-std::array<float,2>{0.750516057f, 0.720546484f},
-std::array<float,2>{0.198193669f, 0.82883662f},
-std::array<float,2>{0.669132531f, 0.0472775474f},
-std::array<float,2>{0.0487016439f, 0.187889084f},
-std::array<float,2>{0.580791891f, 0.911310434f},
-std::array<float,2>{0.405736476f, 0.534671068f},
-std::array<float,2>{0.928074181f, 0.292228937f},
-std::array<float,2>{0.473305672f, 0.0648465529f},
-std::array<float,2>{0.949235201f, 0.796287596f},
-std::array<float,2>{0.0900250524f, 0.64377588f},
-std::array<float,2>{0.534983873f, 0.380872488f},
-std::array<float,2>{0.18046239f, 0.348167509f},
-std::array<float,2>{0.715961158f, 0.624395072f},
-std::array<float,2>{0.334508657f, 0.943636715f},
-std::array<float,2>{0.847544909f, 0.165637165f},
-std::array<float,2>{0.439777464f, 0.402821183f},
-std::array<float,2>{0.989603102f, 0.627586484f},
-std::array<float,2>{0.120719507f, 0.807704091f},
-std::array<float,2>{0.506957889f, 0.0801685676f},
-std::array<float,2>{0.155537307f, 0.184856385f},
-std::array<float,2>{0.744365633f, 0.968141615f},
-std::array<float,2>{0.374085039f, 0.599039257f},
-std::array<float,2>{0.837098718f, 0.364539742f},
-std::array<float,2>{0.275310248f, 0.0422302969f},
-std::array<float,2>{0.802067757f, 0.827478051f},
-std::array<float,2>{0.231270134f, 0.748336077f},
-std::array<float,2>{0.646201313f, 0.456023723f},
-std::array<float,2>{0.0102921445f, 0.303562701f},
-std::array<float,2>{0.621570051f, 0.559049666f},
-std::array<float,2>{0.419668525f, 0.927554786f},
-std::array<float,2>{0.896275878f, 0.211647958f},
-std::array<float,2>{0.315131217f, 0.318499535f},
-std::array<float,2>{0.861477494f, 0.586648822f},
-std::array<float,2>{0.157515809f, 0.988535106f},
-std::array<float,2>{0.693395793f, 0.149152219f},
-std::array<float,2>{0.0724313557f, 0.100083426f},
-std::array<float,2>{0.554214299f, 0.753057361f},
-std::array<float,2>{0.495896667f, 0.674065709f},
-std::array<float,2>{0.953629673f, 0.435548067f},
-std::array<float,2>{0.382902056f, 0.245032698f},
-std::array<float,2>{0.91610384f, 0.880397737f},
-std::array<float,2>{0.0388519764f, 0.530354202f},
-std::array<float,2>{0.565959215f, 0.273861051f},
-std::array<float,2>{0.211280599f, 0.472283095f},
-std::array<float,2>{0.67704165f, 0.709348857f},
-std::array<float,2>{0.293836325f, 0.853251576f},
-std::array<float,2>{0.777654767f, 0.00100716448f},
-std::array<float,2>{0.455736727f, 0.305539221f},
-std::array<float,2>{0.971298337f, 0.551067412f},
-std::array<float,2>{0.109319299f, 0.932860196f},
-std::array<float,2>{0.529804885f, 0.206125468f},
-std::array<float,2>{0.134279221f, 0.0379773304f},
-std::array<float,2>{0.731179416f, 0.819600642f},
-std::array<float,2>{0.345995158f, 0.740687013f},
-std::array<float,2>{0.825516284f, 0.464341313f},
-std::array<float,2>{0.264816612f, 0.174392611f},
-std::array<float,2>{0.78247875f, 0.955117226f},
-std::array<float,2>{0.24483043f, 0.604133666f},
-std::array<float,2>{0.630536616f, 0.374005735f},
-std::array<float,2>{0.0237947926f, 0.393584013f},
-std::array<float,2>{0.603238642f, 0.632817805f},
-std::array<float,2>{0.434541911f, 0.800443828f},
-std::array<float,2>{0.880879581f, 0.0863939896f},
-std::array<float,2>{0.330294728f, 0.4835549f},
-std::array<float,2>{0.850823104f, 0.711601973f},
-std::array<float,2>{0.185585082f, 0.84687984f},
-std::array<float,2>{0.712748945f, 0.010599209f},
-std::array<float,2>{0.0897729769f, 0.234909907f},
-std::array<float,2>{0.537842989f, 0.883691907f},
-std::array<float,2>{0.471818417f, 0.521720231f},
-std::array<float,2>{0.946878374f, 0.268566161f},
-std::array<float,2>{0.401174098f, 0.106416583f},
-std::array<float,2>{0.925524354f, 0.760391891f},
-std::array<float,2>{0.053647358f, 0.679998279f},
-std::array<float,2>{0.582753599f, 0.427908957f},
-std::array<float,2>{0.200731575f, 0.327320099f},
-std::array<float,2>{0.664257944f, 0.580934882f},
-std::array<float,2>{0.3118985f, 0.993234098f},
-std::array<float,2>{0.755357742f, 0.14091301f},
-std::array<float,2>{0.416867316f, 0.419039011f},
-std::array<float,2>{0.891953886f, 0.669573009f},
-std::array<float,2>{0.0144934459f, 0.77999866f},
-std::array<float,2>{0.617335498f, 0.121313825f},
-std::array<float,2>{0.228084177f, 0.126860529f},
-std::array<float,2>{0.641607821f, 0.969857872f},
-std::array<float,2>{0.280422628f, 0.566495597f},
-std::array<float,2>{0.797756076f, 0.333778083f},
-std::array<float,2>{0.368952572f, 0.025577724f},
-std::array<float,2>{0.842927456f, 0.866930425f},
-std::array<float,2>{0.148473904f, 0.688993812f},
-std::array<float,2>{0.746433079f, 0.489710659f},
-std::array<float,2>{0.124542691f, 0.263838947f},
-std::array<float,2>{0.501199007f, 0.50875026f},
-std::array<float,2>{0.444257945f, 0.904509306f},
-std::array<float,2>{0.987503767f, 0.224423304f},
-std::array<float,2>{0.290013313f, 0.351898879f},
-std::array<float,2>{0.774520576f, 0.612603962f},
-std::array<float,2>{0.218656629f, 0.953115642f},
-std::array<float,2>{0.673254907f, 0.159310326f},
-std::array<float,2>{0.0326195657f, 0.0738024339f},
-std::array<float,2>{0.568598926f, 0.785345495f},
-std::array<float,2>{0.387200236f, 0.649725437f},
-std::array<float,2>{0.919887781f, 0.387818545f},
-std::array<float,2>{0.49820444f, 0.196508899f},
-std::array<float,2>{0.959176958f, 0.916830719f},
-std::array<float,2>{0.0779391304f, 0.540820479f},
-std::array<float,2>{0.547252178f, 0.288016677f},
-std::array<float,2>{0.16366145f, 0.44139865f},
-std::array<float,2>{0.689806819f, 0.727216661f},
-std::array<float,2>{0.320156306f, 0.836805344f},
-std::array<float,2>{0.866869271f, 0.0615623444f},
-std::array<float,2>{0.382518411f, 0.337869108f},
-std::array<float,2>{0.912569046f, 0.573818564f},
-std::array<float,2>{0.0411155112f, 0.979472816f},
-std::array<float,2>{0.570938528f, 0.1387593f},
-std::array<float,2>{0.204463363f, 0.111188911f},
-std::array<float,2>{0.684825838f, 0.772415578f},
-std::array<float,2>{0.286722928f, 0.657609642f},
-std::array<float,2>{0.76901114f, 0.412117958f},
-std::array<float,2>{0.323489547f, 0.23356694f},
-std::array<float,2>{0.868556678f, 0.892764688f},
-std::array<float,2>{0.171758115f, 0.50179404f},
-std::array<float,2>{0.697141409f, 0.256843686f},
-std::array<float,2>{0.0642304942f, 0.495495945f},
-std::array<float,2>{0.556323171f, 0.698742628f},
-std::array<float,2>{0.485814154f, 0.867663145f},
-std::array<float,2>{0.966983259f, 0.020795254f},
-std::array<float,2>{0.268601865f, 0.37861082f},
-std::array<float,2>{0.804874897f, 0.647170484f},
-std::array<float,2>{0.219306633f, 0.789363325f},
-std::array<float,2>{0.649100363f, 0.0699187815f},
-std::array<float,2>{0.00366774132f, 0.169526443f},
-std::array<float,2>{0.615426123f, 0.939399481f},
-std::array<float,2>{0.40877229f, 0.621027589f},
-std::array<float,2>{0.901552379f, 0.346654654f},
-std::array<float,2>{0.448212028f, 0.0514680706f},
-std::array<float,2>{0.993855715f, 0.83386457f},
-std::array<float,2>{0.110945709f, 0.724465251f},
-std::array<float,2>{0.51349014f, 0.451395392f},
-std::array<float,2>{0.148353487f, 0.293908685f},
-std::array<float,2>{0.735484242f, 0.536327779f},
-std::array<float,2>{0.364096373f, 0.908063531f},
-std::array<float,2>{0.833292365f, 0.194976345f},
-std::array<float,2>{0.479230523f, 0.457701057f},
-std::array<float,2>{0.942619145f, 0.743893325f},
-std::array<float,2>{0.0834708139f, 0.823483169f},
-std::array<float,2>{0.540955007f, 0.0465431437f},
-std::array<float,2>{0.172193244f, 0.215109333f},
-std::array<float,2>{0.708143651f, 0.923467636f},
-std::array<float,2>{0.339064568f, 0.555918694f},
-std::array<float,2>{0.852204621f, 0.299941957f},
-std::array<float,2>{0.304124951f, 0.0847237036f},
-std::array<float,2>{0.759651065f, 0.81207329f},
-std::array<float,2>{0.189243272f, 0.629185498f},
-std::array<float,2>{0.656885564f, 0.401034802f},
-std::array<float,2>{0.0590852462f, 0.362377107f},
-std::array<float,2>{0.591248453f, 0.596648276f},
-std::array<float,2>{0.395389557f, 0.96130091f},
-std::array<float,2>{0.93431282f, 0.182263404f},
-std::array<float,2>{0.357035935f, 0.279928625f},
-std::array<float,2>{0.818429887f, 0.526527643f},
-std::array<float,2>{0.125064865f, 0.875398874f},
-std::array<float,2>{0.725003898f, 0.248471811f},
-std::array<float,2>{0.0976494625f, 0.00547063304f},
-std::array<float,2>{0.519316316f, 0.858058333f},
-std::array<float,2>{0.467193872f, 0.706101716f},
-std::array<float,2>{0.978731573f, 0.475420743f},
-std::array<float,2>{0.423289925f, 0.152973458f},
-std::array<float,2>{0.889736176f, 0.987931609f},
-std::array<float,2>{0.0219660047f, 0.593340337f},
-std::array<float,2>{0.595528185f, 0.313317746f},
-std::array<float,2>{0.236680448f, 0.429896533f},
-std::array<float,2>{0.638138294f, 0.679142773f},
-std::array<float,2>{0.250791699f, 0.75442493f},
-std::array<float,2>{0.791175187f, 0.0952265859f}}
\ No newline at end of file
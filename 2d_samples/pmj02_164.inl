@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.544565022f, 0.494705707f},
-std::array<float,2>{0.43904236f, 0.87770009f},
-std::array<float,2>{0.944633782f, 0.724606812f},
-std::array<float,2>{0.188309565f, 0.241254956f},
-std::array<float,2>{0.776562035f, 0.0308131203f},
-std::array<float,2>{0.0259134229f, 0.593862116f},
-std::array<float,2>{0.722723544f, 0.781954944f},
-std::array<float,2>{0.281217813f, 0.287470937f},
-std::array<float,2>{0.644950449f, 0.167972088f},
-std::array<float,2>{0.330334812f, 0.685134053f},
-std::array<float,2>{0.822330058f, 0.959831297f},
-std::array<float,2>{0.0975655913f, 0.42968148f},
-std::array<float,2>{0.927865922f, 0.333404332f},
-std::array<float,2>{0.130089879f, 0.817919195f},
-std::array<float,2>{0.594308197f, 0.557061732f},
-std::array<float,2>{0.408313006f, 0.10872747f},
-std::array<float,2>{0.709314942f, 0.252524048f},
-std::array<float,2>{0.289700389f, 0.770348728f},
-std::array<float,2>{0.808820903f, 0.5674119f},
-std::array<float,2>{0.0341419652f, 0.0545709468f},
-std::array<float,2>{0.982018888f, 0.212302238f},
-std::array<float,2>{0.233000621f, 0.702173352f},
-std::array<float,2>{0.511852205f, 0.926053047f},
-std::array<float,2>{0.495801687f, 0.463177413f},
-std::array<float,2>{0.580207467f, 0.0714711696f},
-std::array<float,2>{0.385882825f, 0.509287894f},
-std::array<float,2>{0.896495044f, 0.84641403f},
-std::array<float,2>{0.185925603f, 0.364786536f},
-std::array<float,2>{0.86215806f, 0.398053586f},
-std::array<float,2>{0.0935547501f, 0.976581633f},
-std::array<float,2>{0.676068068f, 0.655331135f},
-std::array<float,2>{0.355659008f, 0.13977395f},
-std::array<float,2>{0.666023016f, 0.40740189f},
-std::array<float,2>{0.363766253f, 0.947451115f},
-std::array<float,2>{0.855911911f, 0.666945159f},
-std::array<float,2>{0.0752747729f, 0.181447387f},
-std::array<float,2>{0.8805089f, 0.124693863f},
-std::array<float,2>{0.169962332f, 0.535337329f},
-std::array<float,2>{0.577484369f, 0.837307394f},
-std::array<float,2>{0.397212535f, 0.313040495f},
-std::array<float,2>{0.525649667f, 0.229425997f},
-std::array<float,2>{0.477775007f, 0.739052892f},
-std::array<float,2>{0.98609823f, 0.892220676f},
-std::array<float,2>{0.243029758f, 0.477247089f},
-std::array<float,2>{0.786515653f, 0.299407244f},
-std::array<float,2>{0.0518125296f, 0.812141955f},
-std::array<float,2>{0.692167401f, 0.6141873f},
-std::array<float,2>{0.310642928f, 0.00343475072f},
-std::array<float,2>{0.622847855f, 0.352651775f},
-std::array<float,2>{0.429598808f, 0.863798857f},
-std::array<float,2>{0.921402395f, 0.526118934f},
-std::array<float,2>{0.151320949f, 0.082924597f},
-std::array<float,2>{0.831799924f, 0.148497164f},
-std::array<float,2>{0.118587643f, 0.627245247f},
-std::array<float,2>{0.638069093f, 0.996220946f},
-std::array<float,2>{0.312862754f, 0.38005653f},
-std::array<float,2>{0.748348236f, 0.0462698564f},
-std::array<float,2>{0.260476828f, 0.591128051f},
-std::array<float,2>{0.762624085f, 0.763429105f},
-std::array<float,2>{0.0103609348f, 0.26980871f},
-std::array<float,2>{0.958097696f, 0.437817395f},
-std::array<float,2>{0.206371292f, 0.921399355f},
-std::array<float,2>{0.55918175f, 0.710421264f},
-std::array<float,2>{0.468593925f, 0.187839836f},
-std::array<float,2>{0.567117453f, 0.389676899f},
-std::array<float,2>{0.404663652f, 0.985930026f},
-std::array<float,2>{0.886136591f, 0.634960771f},
-std::array<float,2>{0.156539381f, 0.145060509f},
-std::array<float,2>{0.850075424f, 0.0887049511f},
-std::array<float,2>{0.0659447759f, 0.517720461f},
-std::array<float,2>{0.657684505f, 0.869353652f},
-std::array<float,2>{0.374671489f, 0.347335398f},
-std::array<float,2>{0.696685374f, 0.198055029f},
-std::array<float,2>{0.29884848f, 0.717970133f},
-std::array<float,2>{0.796382606f, 0.912001908f},
-std::array<float,2>{0.0574496463f, 0.452959955f},
-std::array<float,2>{0.994854569f, 0.279041916f},
-std::array<float,2>{0.240664169f, 0.75402379f},
-std::array<float,2>{0.520412445f, 0.582278132f},
-std::array<float,2>{0.470658779f, 0.038298741f},
-std::array<float,2>{0.627289951f, 0.322783262f},
-std::array<float,2>{0.326519281f, 0.834417343f},
-std::array<float,2>{0.840215087f, 0.542461455f},
-std::array<float,2>{0.116399199f, 0.115078032f},
-std::array<float,2>{0.910643518f, 0.179416269f},
-std::array<float,2>{0.145809412f, 0.657051325f},
-std::array<float,2>{0.613823712f, 0.942005336f},
-std::array<float,2>{0.432177663f, 0.418215424f},
-std::array<float,2>{0.547039688f, 0.0110208662f},
-std::array<float,2>{0.460462838f, 0.619029105f},
-std::array<float,2>{0.966062188f, 0.796929359f},
-std::array<float,2>{0.216558918f, 0.30928576f},
-std::array<float,2>{0.757531226f, 0.473664969f},
-std::array<float,2>{0.00252110395f, 0.903070033f},
-std::array<float,2>{0.736545503f, 0.749055207f},
-std::array<float,2>{0.256054014f, 0.221547619f},
-std::array<float,2>{0.732064426f, 0.459344715f},
-std::array<float,2>{0.266270846f, 0.931557953f},
-std::array<float,2>{0.767565846f, 0.691469252f},
-std::array<float,2>{0.0218448937f, 0.203780338f},
-std::array<float,2>{0.950411201f, 0.0609062053f},
-std::array<float,2>{0.198813319f, 0.576186657f},
-std::array<float,2>{0.534739256f, 0.776493609f},
-std::array<float,2>{0.449685454f, 0.262163758f},
-std::array<float,2>{0.605445921f, 0.132679865f},
-std::array<float,2>{0.420295745f, 0.643332362f},
-std::array<float,2>{0.932110965f, 0.970870793f},
-std::array<float,2>{0.136915982f, 0.405370325f},
-std::array<float,2>{0.813829482f, 0.36790812f},
-std::array<float,2>{0.103029445f, 0.859016716f},
-std::array<float,2>{0.653510213f, 0.505233288f},
-std::array<float,2>{0.343168348f, 0.0654843301f},
-std::array<float,2>{0.504666924f, 0.289560765f},
-std::array<float,2>{0.488707751f, 0.79578954f},
-std::array<float,2>{0.975812912f, 0.608172417f},
-std::array<float,2>{0.219352305f, 0.0218895338f},
-std::array<float,2>{0.800838709f, 0.248008966f},
-std::array<float,2>{0.0405232087f, 0.730108678f},
-std::array<float,2>{0.714324772f, 0.890532553f},
-std::array<float,2>{0.287874281f, 0.49194321f},
-std::array<float,2>{0.679971576f, 0.0944330767f},
-std::array<float,2>{0.348642975f, 0.554006577f},
-std::array<float,2>{0.868312895f, 0.821737647f},
-std::array<float,2>{0.0792717189f, 0.337322921f},
-std::array<float,2>{0.905904531f, 0.430512071f},
-std::array<float,2>{0.179391623f, 0.961654067f},
-std::array<float,2>{0.593287706f, 0.676081955f},
-std::array<float,2>{0.375575453f, 0.158912584f},
-std::array<float,2>{0.600745142f, 0.448501885f},
-std::array<float,2>{0.412136942f, 0.908768713f},
-std::array<float,2>{0.922111154f, 0.712398291f},
-std::array<float,2>{0.128295943f, 0.199240044f},
-std::array<float,2>{0.82797116f, 0.0349732377f},
-std::array<float,2>{0.100166693f, 0.581523836f},
-std::array<float,2>{0.640840769f, 0.75034976f},
-std::array<float,2>{0.334229857f, 0.274635792f},
-std::array<float,2>{0.722402275f, 0.141855076f},
-std::array<float,2>{0.276184827f, 0.636755526f},
-std::array<float,2>{0.778074265f, 0.989228547f},
-std::array<float,2>{0.0287988968f, 0.384021252f},
-std::array<float,2>{0.938779175f, 0.348388106f},
-std::array<float,2>{0.19277823f, 0.874587715f},
-std::array<float,2>{0.542646945f, 0.520283878f},
-std::array<float,2>{0.441717058f, 0.0908310786f},
-std::array<float,2>{0.675280631f, 0.307713509f},
-std::array<float,2>{0.354681134f, 0.801428854f},
-std::array<float,2>{0.864191055f, 0.62113595f},
-std::array<float,2>{0.0868538469f, 0.0150900586f},
-std::array<float,2>{0.893822014f, 0.226150364f},
-std::array<float,2>{0.181924522f, 0.743398368f},
-std::array<float,2>{0.582515001f, 0.900316119f},
-std::array<float,2>{0.389034957f, 0.472082943f},
-std::array<float,2>{0.50983882f, 0.112682842f},
-std::array<float,2>{0.497528911f, 0.546199799f},
-std::array<float,2>{0.980003715f, 0.828312278f},
-std::array<float,2>{0.228322402f, 0.324764907f},
-std::array<float,2>{0.806695879f, 0.417797118f},
-std::array<float,2>{0.0354131609f, 0.938915074f},
-std::array<float,2>{0.70373565f, 0.662763774f},
-std::array<float,2>{0.29462114f, 0.174133524f},
-std::array<float,2>{0.690702379f, 0.399537086f},
-std::array<float,2>{0.305799216f, 0.972986579f},
-std::array<float,2>{0.784028947f, 0.647847354f},
-std::array<float,2>{0.0495142192f, 0.127140522f},
-std::array<float,2>{0.988389432f, 0.0702281669f},
-std::array<float,2>{0.247495875f, 0.501577497f},
-std::array<float,2>{0.528041363f, 0.854511857f},
-std::array<float,2>{0.48204428f, 0.372324973f},
-std::array<float,2>{0.571947575f, 0.209193468f},
-std::array<float,2>{0.390807807f, 0.689888954f},
-std::array<float,2>{0.875900388f, 0.933849931f},
-std::array<float,2>{0.166540146f, 0.45683068f},
-std::array<float,2>{0.853247881f, 0.260852307f},
-std::array<float,2>{0.073094748f, 0.777637482f},
-std::array<float,2>{0.670501113f, 0.57197386f},
-std::array<float,2>{0.359757006f, 0.0553121269f},
-std::array<float,2>{0.558343947f, 0.342919588f},
-std::array<float,2>{0.463522196f, 0.827792287f},
-std::array<float,2>{0.956674039f, 0.549180508f},
-std::array<float,2>{0.210898384f, 0.0996848494f},
-std::array<float,2>{0.76139611f, 0.161766738f},
-std::array<float,2>{0.0135974912f, 0.674578846f},
-std::array<float,2>{0.743278027f, 0.968022823f},
-std::array<float,2>{0.261750966f, 0.436853886f},
-std::array<float,2>{0.63343519f, 0.0187698975f},
-std::array<float,2>{0.316963851f, 0.604716718f},
-std::array<float,2>{0.832061231f, 0.792131066f},
-std::array<float,2>{0.123946615f, 0.293086052f},
-std::array<float,2>{0.916325808f, 0.486466676f},
-std::array<float,2>{0.154528648f, 0.884924591f},
-std::array<float,2>{0.620593607f, 0.731036246f},
-std::array<float,2>{0.422708601f, 0.2432549f},
-std::array<float,2>{0.51755172f, 0.425294757f},
-std::array<float,2>{0.473005265f, 0.956858575f},
-std::array<float,2>{0.99990052f, 0.682670414f},
-std::array<float,2>{0.234515637f, 0.167310789f},
-std::array<float,2>{0.792689264f, 0.103409104f},
-std::array<float,2>{0.0617281422f, 0.562109649f},
-std::array<float,2>{0.701235831f, 0.815088272f},
-std::array<float,2>{0.302944601f, 0.331340939f},
-std::array<float,2>{0.660234809f, 0.234673232f},
-std::array<float,2>{0.367196411f, 0.721416831f},
-std::array<float,2>{0.845365524f, 0.881347537f},
-std::array<float,2>{0.0694124326f, 0.499330431f},
-std::array<float,2>{0.886729121f, 0.284450173f},
-std::array<float,2>{0.163057774f, 0.788002074f},
-std::array<float,2>{0.564058065f, 0.601524174f},
-std::array<float,2>{0.399297297f, 0.0269735139f},
-std::array<float,2>{0.741359472f, 0.36011529f},
-std::array<float,2>{0.251310706f, 0.847989857f},
-std::array<float,2>{0.753653109f, 0.513862729f},
-std::array<float,2>{0.00535815395f, 0.0760968551f},
-std::array<float,2>{0.9641065f, 0.133666679f},
-std::array<float,2>{0.212221205f, 0.648590565f},
-std::array<float,2>{0.554651499f, 0.982960641f},
-std::array<float,2>{0.454385608f, 0.392686069f},
-std::array<float,2>{0.611668766f, 0.0494455583f},
-std::array<float,2>{0.434444368f, 0.564653933f},
-std::array<float,2>{0.909936428f, 0.767446995f},
-std::array<float,2>{0.142025799f, 0.256128788f},
-std::array<float,2>{0.837737501f, 0.468242317f},
-std::array<float,2>{0.112365268f, 0.923986137f},
-std::array<float,2>{0.632654965f, 0.698432684f},
-std::array<float,2>{0.320345193f, 0.218124643f},
-std::array<float,2>{0.651898563f, 0.480878502f},
-std::array<float,2>{0.33811298f, 0.897333384f},
-std::array<float,2>{0.816522777f, 0.73669672f},
-std::array<float,2>{0.10757269f, 0.231773332f},
-std::array<float,2>{0.937234461f, 0.00553099811f},
-std::array<float,2>{0.133805737f, 0.609861612f},
-std::array<float,2>{0.608972728f, 0.8076846f},
-std::array<float,2>{0.41612193f, 0.302384615f},
-std::array<float,2>{0.535483301f, 0.18588163f},
-std::array<float,2>{0.446088582f, 0.671522141f},
-std::array<float,2>{0.946740389f, 0.951595008f},
-std::array<float,2>{0.201229736f, 0.411729574f},
-std::array<float,2>{0.770254016f, 0.318734527f},
-std::array<float,2>{0.0164994579f, 0.841545463f},
-std::array<float,2>{0.728118777f, 0.532050073f},
-std::array<float,2>{0.27042827f, 0.118089832f},
-std::array<float,2>{0.586674154f, 0.268111348f},
-std::array<float,2>{0.381666839f, 0.760118842f},
-std::array<float,2>{0.900866687f, 0.586846232f},
-std::array<float,2>{0.17201364f, 0.0412777178f},
-std::array<float,2>{0.873138845f, 0.195119157f},
-std::array<float,2>{0.0835131258f, 0.70539695f},
-std::array<float,2>{0.685055733f, 0.916755497f},
-std::array<float,2>{0.344231546f, 0.443775892f},
-std::array<float,2>{0.716565132f, 0.0783813745f},
-std::array<float,2>{0.282387733f, 0.529329598f},
-std::array<float,2>{0.797684371f, 0.863107502f},
-std::array<float,2>{0.0467402898f, 0.357373446f},
-std::array<float,2>{0.970397294f, 0.376425564f},
-std::array<float,2>{0.223950386f, 0.992733657f},
-std::array<float,2>{0.50113517f, 0.629731655f},
-std::array<float,2>{0.487587065f, 0.15257144f},
-std::array<float,2>{0.515161395f, 0.46203205f},
-std::array<float,2>{0.492820621f, 0.929263353f},
-std::array<float,2>{0.983507574f, 0.699829638f},
-std::array<float,2>{0.230670482f, 0.214672372f},
-std::array<float,2>{0.811016738f, 0.0517390631f},
-std::array<float,2>{0.0330959521f, 0.569615483f},
-std::array<float,2>{0.708186924f, 0.771631956f},
-std::array<float,2>{0.292183787f, 0.251514524f},
-std::array<float,2>{0.677800775f, 0.137515157f},
-std::array<float,2>{0.358512342f, 0.654056609f},
-std::array<float,2>{0.861180782f, 0.979456007f},
-std::array<float,2>{0.0904070884f, 0.394686073f},
-std::array<float,2>{0.896481752f, 0.366505027f},
-std::array<float,2>{0.184881061f, 0.845591009f},
-std::array<float,2>{0.579711795f, 0.5111444f},
-std::array<float,2>{0.383170724f, 0.0737950876f},
-std::array<float,2>{0.725614369f, 0.286888361f},
-std::array<float,2>{0.278330863f, 0.783475578f},
-std::array<float,2>{0.774078071f, 0.596167564f},
-std::array<float,2>{0.0243437234f, 0.0285197236f},
-std::array<float,2>{0.941787302f, 0.240224183f},
-std::array<float,2>{0.191346765f, 0.725786448f},
-std::array<float,2>{0.545024276f, 0.875470281f},
-std::array<float,2>{0.440667957f, 0.493220091f},
-std::array<float,2>{0.597303271f, 0.107128426f},
-std::array<float,2>{0.406543225f, 0.555233717f},
-std::array<float,2>{0.927361488f, 0.81838274f},
-std::array<float,2>{0.132479623f, 0.334983289f},
-std::array<float,2>{0.82142967f, 0.427675128f},
-std::array<float,2>{0.0939529836f, 0.957410693f},
-std::array<float,2>{0.64670366f, 0.687086523f},
-std::array<float,2>{0.328805029f, 0.171528801f},
-std::array<float,2>{0.638764918f, 0.38245815f},
-std::array<float,2>{0.315915257f, 0.999075294f},
-std::array<float,2>{0.828730524f, 0.626350164f},
-std::array<float,2>{0.11929898f, 0.150463089f},
-std::array<float,2>{0.918916464f, 0.0850368366f},
-std::array<float,2>{0.149499178f, 0.524643242f},
-std::array<float,2>{0.623391271f, 0.866279662f},
-std::array<float,2>{0.426908791f, 0.354073584f},
-std::array<float,2>{0.560973704f, 0.19083558f},
-std::array<float,2>{0.466146886f, 0.708318651f},
-std::array<float,2>{0.960129142f, 0.918637931f},
-std::array<float,2>{0.20439665f, 0.440534741f},
-std::array<float,2>{0.764032543f, 0.272143006f},
-std::array<float,2>{0.00880117249f, 0.764434695f},
-std::array<float,2>{0.746259928f, 0.593310475f},
-std::array<float,2>{0.258527189f, 0.044401966f},
-std::array<float,2>{0.575249314f, 0.315527618f},
-std::array<float,2>{0.396374911f, 0.839460552f},
-std::array<float,2>{0.88222909f, 0.537128806f},
-std::array<float,2>{0.169116899f, 0.122518197f},
-std::array<float,2>{0.857598603f, 0.183339387f},
-std::array<float,2>{0.0764958113f, 0.664169371f},
-std::array<float,2>{0.665930331f, 0.94633919f},
-std::array<float,2>{0.365991771f, 0.409456819f},
-std::array<float,2>{0.695135951f, 0.000672039983f},
-std::array<float,2>{0.309460104f, 0.616069853f},
-std::array<float,2>{0.788343549f, 0.809954643f},
-std::array<float,2>{0.0542322397f, 0.297775865f},
-std::array<float,2>{0.987511516f, 0.479498416f},
-std::array<float,2>{0.244984031f, 0.893657148f},
-std::array<float,2>{0.524131298f, 0.741073132f},
-std::array<float,2>{0.48042354f, 0.22791189f},
-std::array<float,2>{0.616623342f, 0.420118213f},
-std::array<float,2>{0.431079119f, 0.943755448f},
-std::array<float,2>{0.913265347f, 0.659851789f},
-std::array<float,2>{0.14753972f, 0.177412808f},
-std::array<float,2>{0.842340946f, 0.116288796f},
-std::array<float,2>{0.114497386f, 0.53934139f},
-std::array<float,2>{0.625840366f, 0.832200587f},
-std::array<float,2>{0.325758308f, 0.321391761f},
-std::array<float,2>{0.736088932f, 0.219734207f},
-std::array<float,2>{0.255391717f, 0.746129513f},
-std::array<float,2>{0.755334556f, 0.905322134f},
-std::array<float,2>{0.00102132245f, 0.47477743f},
-std::array<float,2>{0.968467295f, 0.310942322f},
-std::array<float,2>{0.217104957f, 0.800522208f},
-std::array<float,2>{0.549342394f, 0.620799005f},
-std::array<float,2>{0.458201975f, 0.00957915001f},
-std::array<float,2>{0.658398688f, 0.345331877f},
-std::array<float,2>{0.371850938f, 0.868104935f},
-std::array<float,2>{0.849162042f, 0.516185343f},
-std::array<float,2>{0.0629386157f, 0.0865075216f},
-std::array<float,2>{0.883493066f, 0.147017986f},
-std::array<float,2>{0.158403471f, 0.634033918f},
-std::array<float,2>{0.569623172f, 0.987041533f},
-std::array<float,2>{0.403329939f, 0.386811167f},
-std::array<float,2>{0.522757649f, 0.0366894566f},
-std::array<float,2>{0.470707595f, 0.585624397f},
-std::array<float,2>{0.992452443f, 0.756117404f},
-std::array<float,2>{0.239171311f, 0.281122178f},
-std::array<float,2>{0.794290841f, 0.450941324f},
-std::array<float,2>{0.05652944f, 0.912663579f},
-std::array<float,2>{0.697626233f, 0.715489149f},
-std::array<float,2>{0.297096729f, 0.196689054f},
-std::array<float,2>{0.711685538f, 0.489108831f},
-std::array<float,2>{0.28692764f, 0.88801527f},
-std::array<float,2>{0.803861499f, 0.728416681f},
-std::array<float,2>{0.0426762588f, 0.248278767f},
-std::array<float,2>{0.973519027f, 0.020722311f},
-std::array<float,2>{0.221343949f, 0.607125044f},
-std::array<float,2>{0.507443249f, 0.794858336f},
-std::array<float,2>{0.490750372f, 0.292648286f},
-std::array<float,2>{0.590475142f, 0.15769884f},
-std::array<float,2>{0.378148586f, 0.678461611f},
-std::array<float,2>{0.903959513f, 0.964793861f},
-std::array<float,2>{0.176495314f, 0.432497591f},
-std::array<float,2>{0.870206833f, 0.338916749f},
-std::array<float,2>{0.0804232135f, 0.823544741f},
-std::array<float,2>{0.682587087f, 0.552054465f},
-std::array<float,2>{0.350535899f, 0.096041128f},
-std::array<float,2>{0.532533228f, 0.264034301f},
-std::array<float,2>{0.453119576f, 0.773587406f},
-std::array<float,2>{0.952704728f, 0.575673878f},
-std::array<float,2>{0.195760682f, 0.0592052862f},
-std::array<float,2>{0.767984807f, 0.205838457f},
-std::array<float,2>{0.0197832994f, 0.693664372f},
-std::array<float,2>{0.732515156f, 0.932893038f},
-std::array<float,2>{0.267834008f, 0.457856506f},
-std::array<float,2>{0.655861557f, 0.0627416968f},
-std::array<float,2>{0.340208828f, 0.506257713f},
-std::array<float,2>{0.814686716f, 0.85558635f},
-std::array<float,2>{0.105157912f, 0.369486809f},
-std::array<float,2>{0.930305481f, 0.403154492f},
-std::array<float,2>{0.138691723f, 0.970107853f},
-std::array<float,2>{0.601934433f, 0.641612768f},
-std::array<float,2>{0.419843167f, 0.130325094f},
-std::array<float,2>{0.584336996f, 0.470232874f},
-std::array<float,2>{0.388597101f, 0.900487125f},
-std::array<float,2>{0.892486632f, 0.744842947f},
-std::array<float,2>{0.179764003f, 0.224301487f},
-std::array<float,2>{0.866785347f, 0.0127001656f},
-std::array<float,2>{0.0889239833f, 0.62396872f},
-std::array<float,2>{0.672366858f, 0.803334713f},
-std::array<float,2>{0.352986127f, 0.306120515f},
-std::array<float,2>{0.7055071f, 0.17324461f},
-std::array<float,2>{0.295059234f, 0.660883009f},
-std::array<float,2>{0.805733621f, 0.940805256f},
-std::array<float,2>{0.0379703492f, 0.414478779f},
-std::array<float,2>{0.976747751f, 0.327291965f},
-std::array<float,2>{0.22927393f, 0.830720186f},
-std::array<float,2>{0.509723127f, 0.543660164f},
-std::array<float,2>{0.498602718f, 0.110906079f},
-std::array<float,2>{0.64333421f, 0.276435524f},
-std::array<float,2>{0.333756208f, 0.753456771f},
-std::array<float,2>{0.824688494f, 0.579432189f},
-std::array<float,2>{0.0986803025f, 0.0322753638f},
-std::array<float,2>{0.925689399f, 0.202847734f},
-std::array<float,2>{0.125181079f, 0.714571595f},
-std::array<float,2>{0.59950918f, 0.907013357f},
-std::array<float,2>{0.410746723f, 0.445495665f},
-std::array<float,2>{0.539575636f, 0.093620874f},
-std::array<float,2>{0.443701357f, 0.521495819f},
-std::array<float,2>{0.940115988f, 0.872976065f},
-std::array<float,2>{0.194850549f, 0.351079017f},
-std::array<float,2>{0.780025899f, 0.386600912f},
-std::array<float,2>{0.0295181759f, 0.991841435f},
-std::array<float,2>{0.719518244f, 0.640480697f},
-std::array<float,2>{0.274980992f, 0.142912328f},
-std::array<float,2>{0.744522214f, 0.43430531f},
-std::array<float,2>{0.264903992f, 0.965775132f},
-std::array<float,2>{0.758958817f, 0.672429621f},
-std::array<float,2>{0.0142186536f, 0.163648993f},
-std::array<float,2>{0.95451957f, 0.0983413085f},
-std::array<float,2>{0.208920538f, 0.548303425f},
-std::array<float,2>{0.554944992f, 0.824617565f},
-std::array<float,2>{0.461843282f, 0.341374665f},
-std::array<float,2>{0.617429733f, 0.244521871f},
-std::array<float,2>{0.424478263f, 0.733118355f},
-std::array<float,2>{0.914893568f, 0.884164572f},
-std::array<float,2>{0.152346015f, 0.485136628f},
-std::array<float,2>{0.835472643f, 0.296819985f},
-std::array<float,2>{0.122213274f, 0.790472806f},
-std::array<float,2>{0.634889424f, 0.602392554f},
-std::array<float,2>{0.320093423f, 0.0160109159f},
-std::array<float,2>{0.530834377f, 0.373917282f},
-std::array<float,2>{0.483351022f, 0.852077484f},
-std::array<float,2>{0.991729975f, 0.503379583f},
-std::array<float,2>{0.249813303f, 0.067251876f},
-std::array<float,2>{0.782734454f, 0.125121146f},
-std::array<float,2>{0.0481737182f, 0.644991815f},
-std::array<float,2>{0.689392686f, 0.975072324f},
-std::array<float,2>{0.307761759f, 0.40098983f},
-std::array<float,2>{0.668651164f, 0.0585367717f},
-std::array<float,2>{0.362359852f, 0.572404981f},
-std::array<float,2>{0.854966342f, 0.781029344f},
-std::array<float,2>{0.0713594779f, 0.25912571f},
-std::array<float,2>{0.876961887f, 0.453627884f},
-std::array<float,2>{0.164612442f, 0.937039077f},
-std::array<float,2>{0.573151469f, 0.688230693f},
-std::array<float,2>{0.392784625f, 0.207971558f},
-std::array<float,2>{0.552337289f, 0.392223209f},
-std::array<float,2>{0.455685765f, 0.982088923f},
-std::array<float,2>{0.961202562f, 0.650746047f},
-std::array<float,2>{0.214514375f, 0.135069743f},
-std::array<float,2>{0.751575589f, 0.0768499076f},
-std::array<float,2>{0.0066192192f, 0.51302892f},
-std::array<float,2>{0.739932656f, 0.851216018f},
-std::array<float,2>{0.253758639f, 0.36183098f},
-std::array<float,2>{0.629142404f, 0.21579884f},
-std::array<float,2>{0.323068708f, 0.695709169f},
-std::array<float,2>{0.839764416f, 0.922760665f},
-std::array<float,2>{0.109691285f, 0.46532464f},
-std::array<float,2>{0.907536805f, 0.255264938f},
-std::array<float,2>{0.142823622f, 0.767687559f},
-std::array<float,2>{0.610592484f, 0.563641429f},
-std::array<float,2>{0.436655939f, 0.0470318832f},
-std::array<float,2>{0.700781226f, 0.328851372f},
-std::array<float,2>{0.301716954f, 0.814311087f},
-std::array<float,2>{0.789958537f, 0.559562206f},
-std::array<float,2>{0.0602020919f, 0.105312355f},
-std::array<float,2>{0.997650504f, 0.164156273f},
-std::array<float,2>{0.238235876f, 0.680718362f},
-std::array<float,2>{0.519044876f, 0.954934835f},
-std::array<float,2>{0.475544512f, 0.423455864f},
-std::array<float,2>{0.565593421f, 0.0252954829f},
-std::array<float,2>{0.401087403f, 0.598849297f},
-std::array<float,2>{0.890560567f, 0.785386622f},
-std::array<float,2>{0.161597818f, 0.282420963f},
-std::array<float,2>{0.846629798f, 0.496690303f},
-std::array<float,2>{0.0683510005f, 0.880226493f},
-std::array<float,2>{0.663109243f, 0.718869567f},
-std::array<float,2>{0.369476855f, 0.236350477f},
-std::array<float,2>{0.686616898f, 0.442487836f},
-std::array<float,2>{0.347113013f, 0.914800525f},
-std::array<float,2>{0.87241292f, 0.704410255f},
-std::array<float,2>{0.0845378488f, 0.191635087f},
-std::array<float,2>{0.900297761f, 0.0393869281f},
-std::array<float,2>{0.173970878f, 0.588063717f},
-std::array<float,2>{0.589373231f, 0.758507788f},
-std::array<float,2>{0.379266948f, 0.266499072f},
-std::array<float,2>{0.502608061f, 0.155793846f},
-std::array<float,2>{0.485119641f, 0.632803977f},
-std::array<float,2>{0.971841514f, 0.994541705f},
-std::array<float,2>{0.225619212f, 0.378362447f},
-std::array<float,2>{0.799988031f, 0.358097523f},
-std::array<float,2>{0.0446512438f, 0.861014724f},
-std::array<float,2>{0.716816545f, 0.52899456f},
-std::array<float,2>{0.285052329f, 0.0819837824f},
-std::array<float,2>{0.607293665f, 0.302902877f},
-std::array<float,2>{0.414721549f, 0.805198133f},
-std::array<float,2>{0.934293807f, 0.611766458f},
-std::array<float,2>{0.135623068f, 0.00699561881f},
-std::array<float,2>{0.819653213f, 0.233146578f},
-std::array<float,2>{0.105485335f, 0.736315548f},
-std::array<float,2>{0.649147749f, 0.895873785f},
-std::array<float,2>{0.336142927f, 0.483048111f},
-std::array<float,2>{0.729668736f, 0.120520838f},
-std::array<float,2>{0.272604465f, 0.533919513f},
-std::array<float,2>{0.771759093f, 0.842602134f},
-std::array<float,2>{0.019405622f, 0.316943258f},
-std::array<float,2>{0.94797498f, 0.414058566f},
-std::array<float,2>{0.200482443f, 0.949773014f},
-std::array<float,2>{0.538573384f, 0.668543458f},
-std::array<float,2>{0.449085951f, 0.183949336f},
-std::array<float,2>{0.525098205f, 0.478207678f},
-std::array<float,2>{0.478839904f, 0.890872002f},
-std::array<float,2>{0.986913383f, 0.739987791f},
-std::array<float,2>{0.245365679f, 0.230096862f},
-std::array<float,2>{0.787584007f, 0.00210583862f},
-std::array<float,2>{0.0532451421f, 0.614597917f},
-std::array<float,2>{0.694200277f, 0.811114907f},
-std::array<float,2>{0.310153455f, 0.300050169f},
-std::array<float,2>{0.664315164f, 0.179925099f},
-std::array<float,2>{0.366256654f, 0.66743654f},
-std::array<float,2>{0.858426392f, 0.948505878f},
-std::array<float,2>{0.0778113231f, 0.407198668f},
-std::array<float,2>{0.881641805f, 0.314135104f},
-std::array<float,2>{0.16877459f, 0.836372912f},
-std::array<float,2>{0.575116336f, 0.536747873f},
-std::array<float,2>{0.394871086f, 0.123201877f},
-std::array<float,2>{0.747819543f, 0.271007389f},
-std::array<float,2>{0.258974016f, 0.761981368f},
-std::array<float,2>{0.76532042f, 0.590245247f},
-std::array<float,2>{0.0080125276f, 0.0451518148f},
-std::array<float,2>{0.959888101f, 0.188788414f},
-std::array<float,2>{0.204020679f, 0.709335923f},
-std::array<float,2>{0.561959803f, 0.920703948f},
-std::array<float,2>{0.465664417f, 0.439399481f},
-std::array<float,2>{0.624794602f, 0.0838479549f},
-std::array<float,2>{0.425810218f, 0.527061224f},
-std::array<float,2>{0.919110417f, 0.864994645f},
-std::array<float,2>{0.14899376f, 0.352396846f},
-std::array<float,2>{0.829162955f, 0.379605025f},
-std::array<float,2>{0.120234169f, 0.998008728f},
-std::array<float,2>{0.640352249f, 0.62801218f},
-std::array<float,2>{0.314858675f, 0.150100529f},
-std::array<float,2>{0.648431003f, 0.428566366f},
-std::array<float,2>{0.329497159f, 0.96057117f},
-std::array<float,2>{0.820411742f, 0.683638513f},
-std::array<float,2>{0.095271863f, 0.169118464f},
-std::array<float,2>{0.926032722f, 0.107558601f},
-std::array<float,2>{0.131521612f, 0.558211505f},
-std::array<float,2>{0.596209228f, 0.817282498f},
-std::array<float,2>{0.407843679f, 0.332404315f},
-std::array<float,2>{0.546798289f, 0.241158679f},
-std::array<float,2>{0.439786553f, 0.723511875f},
-std::array<float,2>{0.942455828f, 0.878010571f},
-std::array<float,2>{0.189884439f, 0.49553591f},
-std::array<float,2>{0.774984419f, 0.28833878f},
-std::array<float,2>{0.0250156745f, 0.782699108f},
-std::array<float,2>{0.725355208f, 0.595089972f},
-std::array<float,2>{0.277374268f, 0.0293690674f},
-std::array<float,2>{0.578332186f, 0.364210308f},
-std::array<float,2>{0.384637356f, 0.847049057f},
-std::array<float,2>{0.894566f, 0.508586943f},
-std::array<float,2>{0.184420496f, 0.0704690069f},
-std::array<float,2>{0.859646678f, 0.138993293f},
-std::array<float,2>{0.0913509876f, 0.654300153f},
-std::array<float,2>{0.679031968f, 0.978199184f},
-std::array<float,2>{0.35752964f, 0.396669507f},
-std::array<float,2>{0.707354724f, 0.0536720455f},
-std::array<float,2>{0.291576207f, 0.567354739f},
-std::array<float,2>{0.811562002f, 0.770739496f},
-std::array<float,2>{0.0321128964f, 0.253351301f},
-std::array<float,2>{0.983243704f, 0.464649916f},
-std::array<float,2>{0.231721565f, 0.927317917f},
-std::array<float,2>{0.514249384f, 0.701520383f},
-std::array<float,2>{0.49336189f, 0.211790457f},
-std::array<float,2>{0.603399992f, 0.404472679f},
-std::array<float,2>{0.417970508f, 0.972478867f},
-std::array<float,2>{0.931408346f, 0.644256353f},
-std::array<float,2>{0.140213743f, 0.130877778f},
-std::array<float,2>{0.815526187f, 0.0646369085f},
-std::array<float,2>{0.104336098f, 0.50406158f},
-std::array<float,2>{0.655094683f, 0.858165085f},
-std::array<float,2>{0.341130853f, 0.368870676f},
-std::array<float,2>{0.733661115f, 0.204865366f},
-std::array<float,2>{0.268860608f, 0.692393005f},
-std::array<float,2>{0.7687217f, 0.930375099f},
-std::array<float,2>{0.0208866149f, 0.460716665f},
-std::array<float,2>{0.95127219f, 0.262712359f},
-std::array<float,2>{0.196907029f, 0.776060522f},
-std::array<float,2>{0.531412542f, 0.577763319f},
-std::array<float,2>{0.45132795f, 0.0620062202f},
-std::array<float,2>{0.682992995f, 0.336758673f},
-std::array<float,2>{0.351384819f, 0.820426583f},
-std::array<float,2>{0.869628787f, 0.553228199f},
-std::array<float,2>{0.0813810229f, 0.0956070423f},
-std::array<float,2>{0.902348995f, 0.159812853f},
-std::array<float,2>{0.177570432f, 0.676930249f},
-std::array<float,2>{0.591710746f, 0.961944878f},
-std::array<float,2>{0.377061993f, 0.431425661f},
-std::array<float,2>{0.506372273f, 0.0230486263f},
-std::array<float,2>{0.4916991f, 0.60910362f},
-std::array<float,2>{0.973773003f, 0.796050966f},
-std::array<float,2>{0.222478703f, 0.29030484f},
-std::array<float,2>{0.803006232f, 0.490886033f},
-std::array<float,2>{0.0412963554f, 0.889594615f},
-std::array<float,2>{0.712253928f, 0.729443669f},
-std::array<float,2>{0.285589755f, 0.246936634f},
-std::array<float,2>{0.698291421f, 0.451275736f},
-std::array<float,2>{0.298186839f, 0.910555184f},
-std::array<float,2>{0.793798327f, 0.717570007f},
-std::array<float,2>{0.0556593463f, 0.198653042f},
-std::array<float,2>{0.993821383f, 0.0373518281f},
-std::array<float,2>{0.239668489f, 0.583026707f},
-std::array<float,2>{0.522342801f, 0.755164087f},
-std::array<float,2>{0.472539395f, 0.278144062f},
-std::array<float,2>{0.568360448f, 0.145775378f},
-std::array<float,2>{0.403026938f, 0.636134505f},
-std::array<float,2>{0.883893013f, 0.985066116f},
-std::array<float,2>{0.159229457f, 0.389047444f},
-std::array<float,2>{0.847927809f, 0.34616816f},
-std::array<float,2>{0.0638103262f, 0.870810747f},
-std::array<float,2>{0.659608901f, 0.519035101f},
-std::array<float,2>{0.372383565f, 0.0890110061f},
-std::array<float,2>{0.5498541f, 0.310457617f},
-std::array<float,2>{0.457247972f, 0.798108399f},
-std::array<float,2>{0.967437446f, 0.617373288f},
-std::array<float,2>{0.218567476f, 0.0103895115f},
-std::array<float,2>{0.754813671f, 0.222165808f},
-std::array<float,2>{0.000157779068f, 0.748490512f},
-std::array<float,2>{0.734502673f, 0.903575897f},
-std::array<float,2>{0.254320055f, 0.472729832f},
-std::array<float,2>{0.626452029f, 0.113576218f},
-std::array<float,2>{0.324279964f, 0.541474998f},
-std::array<float,2>{0.843030035f, 0.835885108f},
-std::array<float,2>{0.114153855f, 0.323443025f},
-std::array<float,2>{0.91213572f, 0.419904798f},
-std::array<float,2>{0.146793172f, 0.942602098f},
-std::array<float,2>{0.615650594f, 0.657500982f},
-std::array<float,2>{0.430310428f, 0.178569168f},
-std::array<float,2>{0.573790312f, 0.45513016f},
-std::array<float,2>{0.39428851f, 0.93468225f},
-std::array<float,2>{0.878101468f, 0.690810502f},
-std::array<float,2>{0.165920421f, 0.210022569f},
-std::array<float,2>{0.854132831f, 0.0563781485f},
-std::array<float,2>{0.0704323053f, 0.570496738f},
-std::array<float,2>{0.66912061f, 0.77864939f},
-std::array<float,2>{0.361780077f, 0.26009801f},
-std::array<float,2>{0.688065588f, 0.128515303f},
-std::array<float,2>{0.307064027f, 0.647378087f},
-std::array<float,2>{0.781454027f, 0.974023223f},
-std::array<float,2>{0.047814656f, 0.39847362f},
-std::array<float,2>{0.991028428f, 0.371970505f},
-std::array<float,2>{0.248918742f, 0.853762567f},
-std::array<float,2>{0.530103505f, 0.500105798f},
-std::array<float,2>{0.483740032f, 0.0689144284f},
-std::array<float,2>{0.635809779f, 0.294353455f},
-std::array<float,2>{0.318503737f, 0.791803181f},
-std::array<float,2>{0.834278345f, 0.603951395f},
-std::array<float,2>{0.121356539f, 0.0177384783f},
-std::array<float,2>{0.915805757f, 0.242693946f},
-std::array<float,2>{0.153823078f, 0.7320081f},
-std::array<float,2>{0.618782043f, 0.88641727f},
-std::array<float,2>{0.425538927f, 0.487987489f},
-std::array<float,2>{0.556574464f, 0.100691549f},
-std::array<float,2>{0.462723106f, 0.550712824f},
-std::array<float,2>{0.953401566f, 0.827130139f},
-std::array<float,2>{0.207197651f, 0.342195749f},
-std::array<float,2>{0.757932603f, 0.436079621f},
-std::array<float,2>{0.014772349f, 0.967408717f},
-std::array<float,2>{0.745561481f, 0.675070465f},
-std::array<float,2>{0.264338434f, 0.160820052f},
-std::array<float,2>{0.720444083f, 0.382842451f},
-std::array<float,2>{0.273712963f, 0.989354253f},
-std::array<float,2>{0.781221867f, 0.63849932f},
-std::array<float,2>{0.030377578f, 0.141020834f},
-std::array<float,2>{0.940708399f, 0.0898757279f},
-std::array<float,2>{0.194165468f, 0.520594776f},
-std::array<float,2>{0.540744185f, 0.873815f},
-std::array<float,2>{0.444576234f, 0.348849982f},
-std::array<float,2>{0.59847492f, 0.200805128f},
-std::array<float,2>{0.411138177f, 0.71156615f},
-std::array<float,2>{0.924112916f, 0.909321547f},
-std::array<float,2>{0.126704991f, 0.447834611f},
-std::array<float,2>{0.825931668f, 0.274317473f},
-std::array<float,2>{0.0977986902f, 0.751508772f},
-std::array<float,2>{0.644260764f, 0.580261886f},
-std::array<float,2>{0.332515836f, 0.0340139605f},
-std::array<float,2>{0.507977843f, 0.32557559f},
-std::array<float,2>{0.499682486f, 0.829117894f},
-std::array<float,2>{0.97793144f, 0.545062661f},
-std::array<float,2>{0.229702845f, 0.111493267f},
-std::array<float,2>{0.805010319f, 0.17539075f},
-std::array<float,2>{0.0389571786f, 0.66368109f},
-std::array<float,2>{0.706768811f, 0.937893987f},
-std::array<float,2>{0.296529263f, 0.416515112f},
-std::array<float,2>{0.673149049f, 0.0139763365f},
-std::array<float,2>{0.352366328f, 0.6225366f},
-std::array<float,2>{0.866037667f, 0.802333057f},
-std::array<float,2>{0.0888149664f, 0.307045221f},
-std::array<float,2>{0.890811384f, 0.471084684f},
-std::array<float,2>{0.181503385f, 0.899265945f},
-std::array<float,2>{0.585665047f, 0.742676198f},
-std::array<float,2>{0.387243867f, 0.225182846f},
-std::array<float,2>{0.537646592f, 0.410821944f},
-std::array<float,2>{0.447305173f, 0.952836812f},
-std::array<float,2>{0.948923171f, 0.670498729f},
-std::array<float,2>{0.20018293f, 0.187472433f},
-std::array<float,2>{0.772665083f, 0.118526764f},
-std::array<float,2>{0.0178396553f, 0.532989502f},
-std::array<float,2>{0.728534222f, 0.840015829f},
-std::array<float,2>{0.272135794f, 0.320124f},
-std::array<float,2>{0.650228679f, 0.231029868f},
-std::array<float,2>{0.337683082f, 0.737444997f},
-std::array<float,2>{0.818769395f, 0.898318589f},
-std::array<float,2>{0.107245058f, 0.481569171f},
-std::array<float,2>{0.935472071f, 0.301198334f},
-std::array<float,2>{0.136038467f, 0.806694746f},
-std::array<float,2>{0.60575217f, 0.611176133f},
-std::array<float,2>{0.416002393f, 0.0039664316f},
-std::array<float,2>{0.717819929f, 0.355972767f},
-std::array<float,2>{0.28395167f, 0.861606956f},
-std::array<float,2>{0.7989586f, 0.530429184f},
-std::array<float,2>{0.0432864949f, 0.0798407346f},
-std::array<float,2>{0.971548736f, 0.153879344f},
-std::array<float,2>{0.225373656f, 0.629925907f},
-std::array<float,2>{0.503210366f, 0.993260741f},
-std::array<float,2>{0.48614493f, 0.375559539f},
-std::array<float,2>{0.588134408f, 0.042781122f},
-std::array<float,2>{0.380742639f, 0.587879479f},
-std::array<float,2>{0.899199843f, 0.761645436f},
-std::array<float,2>{0.175189689f, 0.268715948f},
-std::array<float,2>{0.872045875f, 0.444542229f},
-std::array<float,2>{0.0853793621f, 0.917253017f},
-std::array<float,2>{0.686061919f, 0.706583202f},
-std::array<float,2>{0.345912576f, 0.194045439f},
-std::array<float,2>{0.662906826f, 0.498429149f},
-std::array<float,2>{0.370637774f, 0.881997824f},
-std::array<float,2>{0.847186506f, 0.722198784f},
-std::array<float,2>{0.0664859414f, 0.236206025f},
-std::array<float,2>{0.888782382f, 0.0254376139f},
-std::array<float,2>{0.16074723f, 0.600234926f},
-std::array<float,2>{0.565263212f, 0.788322985f},
-std::array<float,2>{0.402337193f, 0.283923417f},
-std::array<float,2>{0.518271029f, 0.166215986f},
-std::array<float,2>{0.476171523f, 0.682538033f},
-std::array<float,2>{0.996434629f, 0.955478072f},
-std::array<float,2>{0.236801818f, 0.424076647f},
-std::array<float,2>{0.790281594f, 0.330914557f},
-std::array<float,2>{0.0585945621f, 0.815734744f},
-std::array<float,2>{0.699235916f, 0.560987055f},
-std::array<float,2>{0.302506059f, 0.101599894f},
-std::array<float,2>{0.609940171f, 0.257472724f},
-std::array<float,2>{0.436410874f, 0.766067684f},
-std::array<float,2>{0.907188714f, 0.566339791f},
-std::array<float,2>{0.144138634f, 0.0504305065f},
-std::array<float,2>{0.838486135f, 0.217381373f},
-std::array<float,2>{0.111078113f, 0.69812876f},
-std::array<float,2>{0.630686522f, 0.924920261f},
-std::array<float,2>{0.323588133f, 0.466812283f},
-std::array<float,2>{0.738797307f, 0.0747995302f},
-std::array<float,2>{0.252366394f, 0.515083551f},
-std::array<float,2>{0.750521839f, 0.848942041f},
-std::array<float,2>{0.00756046921f, 0.360771239f},
-std::array<float,2>{0.96250248f, 0.394298434f},
-std::array<float,2>{0.21355243f, 0.98389852f},
-std::array<float,2>{0.551114559f, 0.649505138f},
-std::array<float,2>{0.456582606f, 0.134549096f},
-std::array<float,2>{0.560340166f, 0.439947814f},
-std::array<float,2>{0.467178255f, 0.919422209f},
-std::array<float,2>{0.957429767f, 0.70747596f},
-std::array<float,2>{0.205352262f, 0.19001025f},
-std::array<float,2>{0.76297307f, 0.0435042605f},
-std::array<float,2>{0.011055897f, 0.592221856f},
-std::array<float,2>{0.749596596f, 0.765269637f},
-std::array<float,2>{0.261201054f, 0.272726208f},
-std::array<float,2>{0.636839092f, 0.151977941f},
-std::array<float,2>{0.313782454f, 0.625906885f},
-std::array<float,2>{0.830905497f, 0.998256683f},
-std::array<float,2>{0.117972516f, 0.381526709f},
-std::array<float,2>{0.920684397f, 0.3551566f},
-std::array<float,2>{0.152336225f, 0.865295291f},
-std::array<float,2>{0.621782541f, 0.523574889f},
-std::array<float,2>{0.428311735f, 0.0846849382f},
-std::array<float,2>{0.692836285f, 0.298203081f},
-std::array<float,2>{0.312072039f, 0.809012413f},
-std::array<float,2>{0.78540051f, 0.617088079f},
-std::array<float,2>{0.0510652997f, 0.00190957054f},
-std::array<float,2>{0.985048592f, 0.226977333f},
-std::array<float,2>{0.24382934f, 0.741724551f},
-std::array<float,2>{0.526632607f, 0.893354118f},
-std::array<float,2>{0.476862341f, 0.478652f},
-std::array<float,2>{0.576725781f, 0.121115968f},
-std::array<float,2>{0.398229927f, 0.538279653f},
-std::array<float,2>{0.878954947f, 0.838697791f},
-std::array<float,2>{0.170969173f, 0.315105915f},
-std::array<float,2>{0.856542647f, 0.408452898f},
-std::array<float,2>{0.0749601349f, 0.945773482f},
-std::array<float,2>{0.667078733f, 0.665162623f},
-std::array<float,2>{0.364675164f, 0.182089403f},
-std::array<float,2>{0.676830471f, 0.395624846f},
-std::array<float,2>{0.356884867f, 0.980033219f},
-std::array<float,2>{0.862540543f, 0.65273279f},
-std::array<float,2>{0.0924115032f, 0.138304874f},
-std::array<float,2>{0.898100853f, 0.0723974183f},
-std::array<float,2>{0.187341124f, 0.510618865f},
-std::array<float,2>{0.582004666f, 0.84471035f},
-std::array<float,2>{0.38496995f, 0.366051763f},
-std::array<float,2>{0.512853265f, 0.213058129f},
-std::array<float,2>{0.49442941f, 0.700920522f},
-std::array<float,2>{0.980873585f, 0.928457856f},
-std::array<float,2>{0.233942002f, 0.461785018f},
-std::array<float,2>{0.810049713f, 0.250517428f},
-std::array<float,2>{0.0343560353f, 0.772955656f},
-std::array<float,2>{0.710415423f, 0.569234312f},
-std::array<float,2>{0.290183336f, 0.052007284f},
-std::array<float,2>{0.594758272f, 0.334596008f},
-std::array<float,2>{0.409665734f, 0.819827497f},
-std::array<float,2>{0.929620028f, 0.556544125f},
-std::array<float,2>{0.128993005f, 0.105545737f},
-std::array<float,2>{0.823286235f, 0.170042112f},
-std::array<float,2>{0.0958228111f, 0.68637991f},
-std::array<float,2>{0.646175921f, 0.958083928f},
-std::array<float,2>{0.331538022f, 0.426650077f},
-std::array<float,2>{0.724431038f, 0.0275393669f},
-std::array<float,2>{0.279722303f, 0.596761584f},
-std::array<float,2>{0.776218235f, 0.7851336f},
-std::array<float,2>{0.0273023024f, 0.285910815f},
-std::array<float,2>{0.944075406f, 0.492372751f},
-std::array<float,2>{0.189386219f, 0.876749456f},
-std::array<float,2>{0.543744743f, 0.725477457f},
-std::array<float,2>{0.438021213f, 0.238736913f},
-std::array<float,2>{0.591808915f, 0.433087438f},
-std::array<float,2>{0.376807541f, 0.963443279f},
-std::array<float,2>{0.904832184f, 0.679462433f},
-std::array<float,2>{0.178072691f, 0.156270623f},
-std::array<float,2>{0.867499828f, 0.0966908783f},
-std::array<float,2>{0.0789619535f, 0.551386952f},
-std::array<float,2>{0.680899441f, 0.823130846f},
-std::array<float,2>{0.348405063f, 0.338435501f},
-std::array<float,2>{0.713098943f, 0.249776527f},
-std::array<float,2>{0.288877875f, 0.726625502f},
-std::array<float,2>{0.801929832f, 0.88740015f},
-std::array<float,2>{0.0391561203f, 0.489614189f},
-std::array<float,2>{0.975458026f, 0.291540891f},
-std::array<float,2>{0.22011213f, 0.793535173f},
-std::array<float,2>{0.505524218f, 0.606250703f},
-std::array<float,2>{0.489502072f, 0.0196656026f},
-std::array<float,2>{0.652474999f, 0.370725483f},
-std::array<float,2>{0.341929227f, 0.856807947f},
-std::array<float,2>{0.813101709f, 0.507211149f},
-std::array<float,2>{0.102414094f, 0.063936621f},
-std::array<float,2>{0.933121562f, 0.129857853f},
-std::array<float,2>{0.137958795f, 0.641359746f},
-std::array<float,2>{0.60426265f, 0.969391465f},
-std::array<float,2>{0.420983404f, 0.403457284f},
-std::array<float,2>{0.533385456f, 0.0602516197f},
-std::array<float,2>{0.450847119f, 0.57446748f},
-std::array<float,2>{0.950184345f, 0.77512753f},
-std::array<float,2>{0.197732195f, 0.264842212f},
-std::array<float,2>{0.765840828f, 0.458479196f},
-std::array<float,2>{0.0230616983f, 0.932247043f},
-std::array<float,2>{0.730939806f, 0.694896519f},
-std::array<float,2>{0.267451823f, 0.206902832f},
-std::array<float,2>{0.73761481f, 0.476506948f},
-std::array<float,2>{0.257735223f, 0.904830813f},
-std::array<float,2>{0.75607127f, 0.747247279f},
-std::array<float,2>{0.00364690158f, 0.219213709f},
-std::array<float,2>{0.965584338f, 0.00857446902f},
-std::array<float,2>{0.215517104f, 0.620077193f},
-std::array<float,2>{0.548822284f, 0.798878312f},
-std::array<float,2>{0.459475875f, 0.312410474f},
-std::array<float,2>{0.615131795f, 0.176133901f},
-std::array<float,2>{0.433269203f, 0.659179509f},
-std::array<float,2>{0.911302805f, 0.94480443f},
-std::array<float,2>{0.144826755f, 0.42094022f},
-std::array<float,2>{0.840968132f, 0.321202964f},
-std::array<float,2>{0.115663081f, 0.833858788f},
-std::array<float,2>{0.628872514f, 0.540268481f},
-std::array<float,2>{0.327931404f, 0.115749896f},
-std::array<float,2>{0.520810962f, 0.28010577f},
-std::array<float,2>{0.46944356f, 0.756952465f},
-std::array<float,2>{0.995471418f, 0.584867358f},
-std::array<float,2>{0.241405189f, 0.0354570523f},
-std::array<float,2>{0.79512763f, 0.196261525f},
-std::array<float,2>{0.058463674f, 0.715845883f},
-std::array<float,2>{0.695411444f, 0.913930833f},
-std::array<float,2>{0.300315589f, 0.449983537f},
-std::array<float,2>{0.656427622f, 0.0872198194f},
-std::array<float,2>{0.373328388f, 0.51735121f},
-std::array<float,2>{0.850978255f, 0.868935466f},
-std::array<float,2>{0.0654145479f, 0.344396591f},
-std::array<float,2>{0.885061741f, 0.388507575f},
-std::array<float,2>{0.157337934f, 0.988192856f},
-std::array<float,2>{0.56816572f, 0.63365525f},
-std::array<float,2>{0.405874521f, 0.147548229f},
-std::array<float,2>{0.620095551f, 0.485610604f},
-std::array<float,2>{0.423560202f, 0.883523881f},
-std::array<float,2>{0.91707921f, 0.733679235f},
-std::array<float,2>{0.156146049f, 0.246078193f},
-std::array<float,2>{0.833819032f, 0.0167140625f},
-std::array<float,2>{0.124350742f, 0.603495479f},
-std::array<float,2>{0.634183109f, 0.789615691f},
-std::array<float,2>{0.317639023f, 0.29505679f},
-std::array<float,2>{0.742713451f, 0.162616402f},
-std::array<float,2>{0.262764633f, 0.673065722f},
-std::array<float,2>{0.760048389f, 0.96614331f},
-std::array<float,2>{0.0125998333f, 0.435328394f},
-std::array<float,2>{0.955344856f, 0.340749621f},
-std::array<float,2>{0.209497824f, 0.826064229f},
-std::array<float,2>{0.55727005f, 0.547748268f},
-std::array<float,2>{0.464114666f, 0.0993527025f},
-std::array<float,2>{0.671243608f, 0.258677334f},
-std::array<float,2>{0.36131978f, 0.779595196f},
-std::array<float,2>{0.852387428f, 0.573913157f},
-std::array<float,2>{0.0741330013f, 0.0573877618f},
-std::array<float,2>{0.875987589f, 0.208085179f},
-std::array<float,2>{0.167625397f, 0.688710511f},
-std::array<float,2>{0.570728123f, 0.936243713f},
-std::array<float,2>{0.392469853f, 0.454366297f},
-std::array<float,2>{0.528912008f, 0.0677691102f},
-std::array<float,2>{0.480594635f, 0.502752483f},
-std::array<float,2>{0.989800096f, 0.853177547f},
-std::array<float,2>{0.246314943f, 0.374993265f},
-std::array<float,2>{0.785048068f, 0.402163863f},
-std::array<float,2>{0.0501723215f, 0.975718558f},
-std::array<float,2>{0.689779341f, 0.646151721f},
-std::array<float,2>{0.304868907f, 0.12674354f},
-std::array<float,2>{0.704495013f, 0.415560544f},
-std::array<float,2>{0.293712497f, 0.939587355f},
-std::array<float,2>{0.808470011f, 0.661368191f},
-std::array<float,2>{0.0362144224f, 0.172192693f},
-std::array<float,2>{0.979466617f, 0.10962446f},
-std::array<float,2>{0.227375284f, 0.544064343f},
-std::array<float,2>{0.511521041f, 0.83125788f},
-std::array<float,2>{0.496977419f, 0.327086717f},
-std::array<float,2>{0.583123684f, 0.222771659f},
-std::array<float,2>{0.390405238f, 0.745569646f},
-std::array<float,2>{0.892919064f, 0.902095258f},
-std::array<float,2>{0.182877779f, 0.469409198f},
-std::array<float,2>{0.864736497f, 0.304947317f},
-std::array<float,2>{0.0878220946f, 0.803825796f},
-std::array<float,2>{0.674319863f, 0.624587715f},
-std::array<float,2>{0.35436213f, 0.0125729572f},
-std::array<float,2>{0.541785717f, 0.350576103f},
-std::array<float,2>{0.443172395f, 0.871954024f},
-std::array<float,2>{0.938112557f, 0.523026705f},
-std::array<float,2>{0.192022204f, 0.0922066793f},
-std::array<float,2>{0.779149413f, 0.144529015f},
-std::array<float,2>{0.0282456391f, 0.639312088f},
-std::array<float,2>{0.720976949f, 0.990547061f},
-std::array<float,2>{0.276711732f, 0.384851635f},
-std::array<float,2>{0.642509758f, 0.0319045931f},
-std::array<float,2>{0.335217297f, 0.578351319f},
-std::array<float,2>{0.826971173f, 0.752568781f},
-std::array<float,2>{0.100605033f, 0.276128799f},
-std::array<float,2>{0.92308104f, 0.446649641f},
-std::array<float,2>{0.12714465f, 0.90802002f},
-std::array<float,2>{0.600321591f, 0.712924898f},
-std::array<float,2>{0.413997144f, 0.201519266f},
-std::array<float,2>{0.500840425f, 0.377452046f},
-std::array<float,2>{0.487160981f, 0.99520427f},
-std::array<float,2>{0.969364345f, 0.631207108f},
-std::array<float,2>{0.223204151f, 0.154917464f},
-std::array<float,2>{0.798464596f, 0.0808324665f},
-std::array<float,2>{0.0451470017f, 0.528064191f},
-std::array<float,2>{0.71521759f, 0.859794378f},
-std::array<float,2>{0.281782269f, 0.358735204f},
-std::array<float,2>{0.68375659f, 0.192726672f},
-std::array<float,2>{0.345297217f, 0.703184247f},
-std::array<float,2>{0.874579787f, 0.915175796f},
-std::array<float,2>{0.0824417993f, 0.441438407f},
-std::array<float,2>{0.902213454f, 0.267539173f},
-std::array<float,2>{0.173483804f, 0.759076953f},
-std::array<float,2>{0.587164402f, 0.589137495f},
-std::array<float,2>{0.382777512f, 0.0409353636f},
-std::array<float,2>{0.727151811f, 0.317837924f},
-std::array<float,2>{0.271220058f, 0.843074381f},
-std::array<float,2>{0.771389186f, 0.534250617f},
-std::array<float,2>{0.0172298923f, 0.119510569f},
-std::array<float,2>{0.945445359f, 0.185408875f},
-std::array<float,2>{0.202542275f, 0.668958902f},
-std::array<float,2>{0.536194265f, 0.950213313f},
-std::array<float,2>{0.446896523f, 0.413001478f},
-std::array<float,2>{0.608034909f, 0.00658692513f},
-std::array<float,2>{0.417202145f, 0.613224626f},
-std::array<float,2>{0.936451018f, 0.806390882f},
-std::array<float,2>{0.133029923f, 0.304436296f},
-std::array<float,2>{0.817513824f, 0.483672261f},
-std::array<float,2>{0.109130248f, 0.895359755f},
-std::array<float,2>{0.650708497f, 0.735324681f},
-std::array<float,2>{0.339732766f, 0.233887255f},
-std::array<float,2>{0.630876064f, 0.466473699f},
-std::array<float,2>{0.321803957f, 0.922918797f},
-std::array<float,2>{0.836491048f, 0.696825266f},
-std::array<float,2>{0.111725554f, 0.216129124f},
-std::array<float,2>{0.908599615f, 0.0485697165f},
-std::array<float,2>{0.141561955f, 0.56308496f},
-std::array<float,2>{0.612867475f, 0.768693089f},
-std::array<float,2>{0.434640467f, 0.25449118f},
-std::array<float,2>{0.553508043f, 0.136274084f},
-std::array<float,2>{0.453228533f, 0.652112961f},
-std::array<float,2>{0.963047981f, 0.980769217f},
-std::array<float,2>{0.211721659f, 0.391195923f},
-std::array<float,2>{0.752763987f, 0.363123775f},
-std::array<float,2>{0.00440640422f, 0.849728286f},
-std::array<float,2>{0.740463197f, 0.512203634f},
-std::array<float,2>{0.250263125f, 0.0780713707f},
-std::array<float,2>{0.563305497f, 0.281531304f},
-std::array<float,2>{0.400388151f, 0.786168933f},
-std::array<float,2>{0.888124287f, 0.597995043f},
-std::array<float,2>{0.163239866f, 0.0237500239f},
-std::array<float,2>{0.843807638f, 0.238072962f},
-std::array<float,2>{0.0690556392f, 0.720207512f},
-std::array<float,2>{0.66142714f, 0.879626691f},
-std::array<float,2>{0.368677616f, 0.497297615f},
-std::array<float,2>{0.702363372f, 0.104144238f},
-std::array<float,2>{0.304548562f, 0.559889317f},
-std::array<float,2>{0.791220605f, 0.812633157f},
-std::array<float,2>{0.0605833568f, 0.329843879f},
-std::array<float,2>{0.998936117f, 0.422217816f},
-std::array<float,2>{0.235770509f, 0.953554928f},
-std::array<float,2>{0.515855551f, 0.680516779f},
-std::array<float,2>{0.474227756f, 0.165139511f},
-std::array<float,2>{0.548092008f, 0.473595738f},
-std::array<float,2>{0.459392786f, 0.903829217f},
-std::array<float,2>{0.96527648f, 0.748573005f},
-std::array<float,2>{0.214848071f, 0.222178593f},
-std::array<float,2>{0.756585121f, 0.00988717657f},
-std::array<float,2>{0.00340319425f, 0.618084908f},
-std::array<float,2>{0.738061428f, 0.798634946f},
-std::array<float,2>{0.256862372f, 0.309655696f},
-std::array<float,2>{0.628188312f, 0.177758485f},
-std::array<float,2>{0.327225387f, 0.657888532f},
-std::array<float,2>{0.841319919f, 0.943255723f},
-std::array<float,2>{0.116171241f, 0.418949127f},
-std::array<float,2>{0.911726832f, 0.3242158f},
-std::array<float,2>{0.145502567f, 0.835315943f},
-std::array<float,2>{0.61452049f, 0.541941404f},
-std::array<float,2>{0.433075249f, 0.114047006f},
-std::array<float,2>{0.696123779f, 0.277464092f},
-std::array<float,2>{0.300118446f, 0.7554546f},
-std::array<float,2>{0.795485735f, 0.583523154f},
-std::array<float,2>{0.057972461f, 0.0377209671f},
-std::array<float,2>{0.995663047f, 0.199207708f},
-std::array<float,2>{0.24206762f, 0.717276454f},
-std::array<float,2>{0.521449387f, 0.91111362f},
-std::array<float,2>{0.469166487f, 0.452030271f},
-std::array<float,2>{0.567394078f, 0.0893778056f},
-std::array<float,2>{0.40541774f, 0.519402802f},
-std::array<float,2>{0.885578871f, 0.870323181f},
-std::array<float,2>{0.15788044f, 0.34637478f},
-std::array<float,2>{0.851526201f, 0.389460891f},
-std::array<float,2>{0.0648581013f, 0.984765053f},
-std::array<float,2>{0.657063425f, 0.636636257f},
-std::array<float,2>{0.373721719f, 0.146246374f},
-std::array<float,2>{0.681528866f, 0.431131154f},
-std::array<float,2>{0.347741336f, 0.962716639f},
-std::array<float,2>{0.868114173f, 0.677376568f},
-std::array<float,2>{0.0784834027f, 0.159614339f},
-std::array<float,2>{0.904459178f, 0.0950495228f},
-std::array<float,2>{0.178460568f, 0.553212762f},
-std::array<float,2>{0.59240824f, 0.821207345f},
-std::array<float,2>{0.376192212f, 0.335993111f},
-std::array<float,2>{0.50488627f, 0.24633871f},
-std::array<float,2>{0.49021852f, 0.728584349f},
-std::array<float,2>{0.974623501f, 0.888913929f},
-std::array<float,2>{0.220469803f, 0.490684152f},
-std::array<float,2>{0.802681744f, 0.290540904f},
-std::array<float,2>{0.039922975f, 0.796580732f},
-std::array<float,2>{0.713532627f, 0.608795345f},
-std::array<float,2>{0.2884776f, 0.0226726327f},
-std::array<float,2>{0.60378468f, 0.36840108f},
-std::array<float,2>{0.421589524f, 0.857746959f},
-std::array<float,2>{0.933061123f, 0.504483402f},
-std::array<float,2>{0.13865836f, 0.0652213395f},
-std::array<float,2>{0.812630296f, 0.131651059f},
-std::array<float,2>{0.101954825f, 0.643948197f},
-std::array<float,2>{0.652918637f, 0.971705258f},
-std::array<float,2>{0.342343152f, 0.405049413f},
-std::array<float,2>{0.731003881f, 0.0620914698f},
-std::array<float,2>{0.266937256f, 0.577326298f},
-std::array<float,2>{0.766488433f, 0.775670707f},
-std::array<float,2>{0.0225358699f, 0.263241559f},
-std::array<float,2>{0.94952184f, 0.460317999f},
-std::array<float,2>{0.198213652f, 0.929783702f},
-std::array<float,2>{0.533748984f, 0.693057299f},
-std::array<float,2>{0.450449109f, 0.20439519f},
-std::array<float,2>{0.581279397f, 0.397224426f},
-std::array<float,2>{0.385447413f, 0.977910757f},
-std::array<float,2>{0.897634745f, 0.655005455f},
-std::array<float,2>{0.186942309f, 0.139536306f},
-std::array<float,2>{0.863149881f, 0.0708140209f},
-std::array<float,2>{0.0920859277f, 0.508277118f},
-std::array<float,2>{0.677279294f, 0.847615898f},
-std::array<float,2>{0.357278407f, 0.363353461f},
-std::array<float,2>{0.710926414f, 0.211175412f},
-std::array<float,2>{0.290544748f, 0.701795697f},
-std::array<float,2>{0.810355723f, 0.927147627f},
-std::array<float,2>{0.0351394154f, 0.464206368f},
-std::array<float,2>{0.981391311f, 0.253599882f},
-std::array<float,2>{0.233597234f, 0.771096706f},
-std::array<float,2>{0.513478458f, 0.566891551f},
-std::array<float,2>{0.494927645f, 0.0531582609f},
-std::array<float,2>{0.645947576f, 0.332552671f},
-std::array<float,2>{0.331584364f, 0.81679064f},
-std::array<float,2>{0.823910952f, 0.557844877f},
-std::array<float,2>{0.0966166183f, 0.108307809f},
-std::array<float,2>{0.929001808f, 0.169637755f},
-std::array<float,2>{0.129774153f, 0.684463501f},
-std::array<float,2>{0.595481694f, 0.960027099f},
-std::array<float,2>{0.409902692f, 0.427921027f},
-std::array<float,2>{0.543433607f, 0.029867461f},
-std::array<float,2>{0.437665105f, 0.595537364f},
-std::array<float,2>{0.943435967f, 0.782752872f},
-std::array<float,2>{0.188949794f, 0.28887853f},
-std::array<float,2>{0.775827467f, 0.495757878f},
-std::array<float,2>{0.0265980158f, 0.878740489f},
-std::array<float,2>{0.724004269f, 0.722871661f},
-std::array<float,2>{0.280271024f, 0.240721852f},
-std::array<float,2>{0.749462306f, 0.438480675f},
-std::array<float,2>{0.261263698f, 0.92038852f},
-std::array<float,2>{0.76352483f, 0.709520698f},
-std::array<float,2>{0.0115976483f, 0.18940489f},
-std::array<float,2>{0.957966983f, 0.0456317216f},
-std::array<float,2>{0.205795467f, 0.590652943f},
-std::array<float,2>{0.560052514f, 0.762237191f},
-std::array<float,2>{0.467675388f, 0.270810366f},
-std::array<float,2>{0.621453404f, 0.149644285f},
-std::array<float,2>{0.42778334f, 0.628561854f},
-std::array<float,2>{0.920304894f, 0.997217298f},
-std::array<float,2>{0.151648179f, 0.379224122f},
-std::array<float,2>{0.830525279f, 0.351850361f},
-std::array<float,2>{0.117608123f, 0.864336073f},
-std::array<float,2>{0.637590349f, 0.526710689f},
-std::array<float,2>{0.314410836f, 0.0834644511f},
-std::array<float,2>{0.527077615f, 0.300704956f},
-std::array<float,2>{0.477102995f, 0.810739815f},
-std::array<float,2>{0.984394968f, 0.615111887f},
-std::array<float,2>{0.24341318f, 0.00282704714f},
-std::array<float,2>{0.785942137f, 0.229923218f},
-std::array<float,2>{0.0515031219f, 0.739479125f},
-std::array<float,2>{0.693302512f, 0.891113579f},
-std::array<float,2>{0.311686575f, 0.477840155f},
-std::array<float,2>{0.667620599f, 0.123589344f},
-std::array<float,2>{0.365178823f, 0.536428809f},
-std::array<float,2>{0.857228756f, 0.836603284f},
-std::array<float,2>{0.0743590966f, 0.31363818f},
-std::array<float,2>{0.879783213f, 0.406485796f},
-std::array<float,2>{0.17165108f, 0.948994398f},
-std::array<float,2>{0.576331437f, 0.667651176f},
-std::array<float,2>{0.39778173f, 0.180629015f},
-std::array<float,2>{0.612599134f, 0.467606634f},
-std::array<float,2>{0.435127616f, 0.92569077f},
-std::array<float,2>{0.908893943f, 0.697651088f},
-std::array<float,2>{0.140890673f, 0.217064589f},
-std::array<float,2>{0.836167514f, 0.0499211438f},
-std::array<float,2>{0.111986585f, 0.565810323f},
-std::array<float,2>{0.631450593f, 0.766120315f},
-std::array<float,2>{0.321680278f, 0.257167757f},
-std::array<float,2>{0.740802646f, 0.133805633f},
-std::array<float,2>{0.250954032f, 0.650338054f},
-std::array<float,2>{0.752396643f, 0.983468473f},
-std::array<float,2>{0.004241494f, 0.393758476f},
-std::array<float,2>{0.963675022f, 0.360851377f},
-std::array<float,2>{0.211150929f, 0.849460006f},
-std::array<float,2>{0.552962124f, 0.515227377f},
-std::array<float,2>{0.453705519f, 0.0744168237f},
-std::array<float,2>{0.662022233f, 0.283252776f},
-std::array<float,2>{0.368232667f, 0.788857818f},
-std::array<float,2>{0.844479442f, 0.599884808f},
-std::array<float,2>{0.0688266754f, 0.0259389728f},
-std::array<float,2>{0.888594389f, 0.235434368f},
-std::array<float,2>{0.163739368f, 0.72185576f},
-std::array<float,2>{0.562584221f, 0.88247478f},
-std::array<float,2>{0.399733603f, 0.498886734f},
-std::array<float,2>{0.516158819f, 0.102322608f},
-std::array<float,2>{0.473803759f, 0.561252773f},
-std::array<float,2>{0.998071969f, 0.816245079f},
-std::array<float,2>{0.236268789f, 0.330358386f},
-std::array<float,2>{0.791912019f, 0.424655229f},
-std::array<float,2>{0.0611520335f, 0.955976725f},
-std::array<float,2>{0.703079045f, 0.681769013f},
-std::array<float,2>{0.304150313f, 0.166828334f},
-std::array<float,2>{0.715364814f, 0.375132591f},
-std::array<float,2>{0.281302154f, 0.993676126f},
-std::array<float,2>{0.797946274f, 0.630586326f},
-std::array<float,2>{0.0458102822f, 0.153421804f},
-std::array<float,2>{0.968797863f, 0.0792402253f},
-std::array<float,2>{0.222785532f, 0.530818582f},
-std::array<float,2>{0.500006437f, 0.862074673f},
-std::array<float,2>{0.486660302f, 0.355669945f},
-std::array<float,2>{0.587439775f, 0.193413675f},
-std::array<float,2>{0.382149905f, 0.706413686f},
-std::array<float,2>{0.901404738f, 0.917545259f},
-std::array<float,2>{0.172971308f, 0.444920897f},
-std::array<float,2>{0.874302685f, 0.269163817f},
-std::array<float,2>{0.0827333182f, 0.760988653f},
-std::array<float,2>{0.684208989f, 0.587253511f},
-std::array<float,2>{0.34505114f, 0.0423393399f},
-std::array<float,2>{0.536757171f, 0.31976366f},
-std::array<float,2>{0.446577072f, 0.840375364f},
-std::array<float,2>{0.946286798f, 0.532376647f},
-std::array<float,2>{0.202918842f, 0.118980318f},
-std::array<float,2>{0.770560682f, 0.18670091f},
-std::array<float,2>{0.0169968102f, 0.670105994f},
-std::array<float,2>{0.726985753f, 0.952263951f},
-std::array<float,2>{0.270973951f, 0.41016975f},
-std::array<float,2>{0.65106374f, 0.00471103331f},
-std::array<float,2>{0.338958681f, 0.610725522f},
-std::array<float,2>{0.818157375f, 0.80739224f},
-std::array<float,2>{0.10878855f, 0.301571727f},
-std::array<float,2>{0.935968339f, 0.482058436f},
-std::array<float,2>{0.133373722f, 0.897769809f},
-std::array<float,2>{0.607433677f, 0.7380656f},
-std::array<float,2>{0.417945623f, 0.230734721f},
-std::array<float,2>{0.511073828f, 0.416160196f},
-std::array<float,2>{0.496495187f, 0.938462794f},
-std::array<float,2>{0.978633463f, 0.663420379f},
-std::array<float,2>{0.226994917f, 0.174926147f},
-std::array<float,2>{0.807875156f, 0.111832045f},
-std::array<float,2>{0.0366257206f, 0.545720041f},
-std::array<float,2>{0.704744399f, 0.829891741f},
-std::array<float,2>{0.293424547f, 0.326073974f},
-std::array<float,2>{0.674257874f, 0.225032017f},
-std::array<float,2>{0.353867888f, 0.742653251f},
-std::array<float,2>{0.865144312f, 0.89847219f},
-std::array<float,2>{0.0869969428f, 0.471468568f},
-std::array<float,2>{0.893229544f, 0.307227105f},
-std::array<float,2>{0.18332611f, 0.801835775f},
-std::array<float,2>{0.583979487f, 0.622979641f},
-std::array<float,2>{0.389972866f, 0.0146407476f},
-std::array<float,2>{0.721553206f, 0.349504083f},
-std::array<float,2>{0.277080804f, 0.873306692f},
-std::array<float,2>{0.778572857f, 0.521479785f},
-std::array<float,2>{0.0277745482f, 0.0905978754f},
-std::array<float,2>{0.937871933f, 0.141412243f},
-std::array<float,2>{0.191485062f, 0.638004065f},
-std::array<float,2>{0.541348994f, 0.990064383f},
-std::array<float,2>{0.442678064f, 0.383682489f},
-std::array<float,2>{0.6000489f, 0.0332133397f},
-std::array<float,2>{0.413120836f, 0.581020653f},
-std::array<float,2>{0.923744917f, 0.75102073f},
-std::array<float,2>{0.127463818f, 0.273778081f},
-std::array<float,2>{0.826337516f, 0.447647244f},
-std::array<float,2>{0.101281084f, 0.910124719f},
-std::array<float,2>{0.641666949f, 0.71137327f},
-std::array<float,2>{0.335679322f, 0.200583324f},
-std::array<float,2>{0.634668827f, 0.487749815f},
-std::array<float,2>{0.318255663f, 0.885997951f},
-std::array<float,2>{0.833444595f, 0.731766582f},
-std::array<float,2>{0.124622114f, 0.242197424f},
-std::array<float,2>{0.91748935f, 0.0182792526f},
-std::array<float,2>{0.155341819f, 0.604248166f},
-std::array<float,2>{0.619221449f, 0.79115659f},
-std::array<float,2>{0.42333886f, 0.294548035f},
-std::array<float,2>{0.556805313f, 0.160561517f},
-std::array<float,2>{0.464484781f, 0.675662518f},
-std::array<float,2>{0.955641031f, 0.967061996f},
-std::array<float,2>{0.20942007f, 0.435829312f},
-std::array<float,2>{0.760662556f, 0.34246856f},
-std::array<float,2>{0.0120250368f, 0.826361597f},
-std::array<float,2>{0.74257195f, 0.550038218f},
-std::array<float,2>{0.263657749f, 0.101502784f},
-std::array<float,2>{0.571239829f, 0.260729551f},
-std::array<float,2>{0.391780078f, 0.779169679f},
-std::array<float,2>{0.876491785f, 0.57103467f},
-std::array<float,2>{0.167284712f, 0.0557522289f},
-std::array<float,2>{0.851986468f, 0.210755572f},
-std::array<float,2>{0.0733755678f, 0.691129446f},
-std::array<float,2>{0.671461582f, 0.935248911f},
-std::array<float,2>{0.360533446f, 0.455615759f},
-std::array<float,2>{0.690240264f, 0.0684071034f},
-std::array<float,2>{0.305361748f, 0.500605822f},
-std::array<float,2>{0.784363687f, 0.854355872f},
-std::array<float,2>{0.0503694154f, 0.371487379f},
-std::array<float,2>{0.989698827f, 0.399260789f},
-std::array<float,2>{0.246882409f, 0.974529207f},
-std::array<float,2>{0.52879554f, 0.646827579f},
-std::array<float,2>{0.481373161f, 0.128400207f},
-std::array<float,2>{0.521961391f, 0.449414223f},
-std::array<float,2>{0.471943229f, 0.913340747f},
-std::array<float,2>{0.993558049f, 0.716785729f},
-std::array<float,2>{0.239817888f, 0.195752174f},
-std::array<float,2>{0.793238521f, 0.0357604958f},
-std::array<float,2>{0.0550428368f, 0.584249675f},
-std::array<float,2>{0.699059188f, 0.757587075f},
-std::array<float,2>{0.298626751f, 0.279302388f},
-std::array<float,2>{0.659717262f, 0.147989959f},
-std::array<float,2>{0.372583449f, 0.632885456f},
-std::array<float,2>{0.848343074f, 0.987355351f},
-std::array<float,2>{0.0640614182f, 0.388049334f},
-std::array<float,2>{0.884668887f, 0.343903571f},
-std::array<float,2>{0.160012797f, 0.868507862f},
-std::array<float,2>{0.568941534f, 0.516823292f},
-std::array<float,2>{0.402348787f, 0.0877489001f},
-std::array<float,2>{0.735267103f, 0.311978161f},
-std::array<float,2>{0.254757434f, 0.799362838f},
-std::array<float,2>{0.754324138f, 0.619387448f},
-std::array<float,2>{0.00090149272f, 0.00786956586f},
-std::array<float,2>{0.967226624f, 0.219456896f},
-std::array<float,2>{0.218158066f, 0.747925937f},
-std::array<float,2>{0.550458312f, 0.904363811f},
-std::array<float,2>{0.457767963f, 0.475849748f},
-std::array<float,2>{0.615942955f, 0.115480021f},
-std::array<float,2>{0.429797262f, 0.540588319f},
-std::array<float,2>{0.91268295f, 0.833340347f},
-std::array<float,2>{0.147411972f, 0.320545167f},
-std::array<float,2>{0.843389034f, 0.421677738f},
-std::array<float,2>{0.113737054f, 0.944873691f},
-std::array<float,2>{0.626534998f, 0.658661246f},
-std::array<float,2>{0.324981928f, 0.176447511f},
-std::array<float,2>{0.654619157f, 0.404065967f},
-std::array<float,2>{0.34131372f, 0.969017148f},
-std::array<float,2>{0.81599319f, 0.640962124f},
-std::array<float,2>{0.103598654f, 0.129290774f},
-std::array<float,2>{0.930929244f, 0.064117901f},
-std::array<float,2>{0.139996037f, 0.507759094f},
-std::array<float,2>{0.602862835f, 0.857358158f},
-std::array<float,2>{0.418862522f, 0.370552003f},
-std::array<float,2>{0.531996071f, 0.206407905f},
-std::array<float,2>{0.451817304f, 0.694641948f},
-std::array<float,2>{0.951991737f, 0.931864917f},
-std::array<float,2>{0.196333244f, 0.458780885f},
-std::array<float,2>{0.769349217f, 0.265610218f},
-std::array<float,2>{0.0213866271f, 0.774431825f},
-std::array<float,2>{0.733915329f, 0.574922621f},
-std::array<float,2>{0.26947248f, 0.0599757023f},
-std::array<float,2>{0.590993762f, 0.338139594f},
-std::array<float,2>{0.377490848f, 0.822325587f},
-std::array<float,2>{0.903092861f, 0.551251173f},
-std::array<float,2>{0.177159667f, 0.0972118005f},
-std::array<float,2>{0.869716465f, 0.157093987f},
-std::array<float,2>{0.0818066075f, 0.678882837f},
-std::array<float,2>{0.683318973f, 0.963057816f},
-std::array<float,2>{0.350669712f, 0.43320024f},
-std::array<float,2>{0.712699592f, 0.0203738753f},
-std::array<float,2>{0.286120534f, 0.605535209f},
-std::array<float,2>{0.80366534f, 0.793244898f},
-std::array<float,2>{0.0416063629f, 0.291171044f},
-std::array<float,2>{0.97426188f, 0.489795417f},
-std::array<float,2>{0.221725419f, 0.886867583f},
-std::array<float,2>{0.505977988f, 0.727359772f},
-std::array<float,2>{0.491818219f, 0.249475822f},
-std::array<float,2>{0.595899343f, 0.425998867f},
-std::array<float,2>{0.40766263f, 0.958964288f},
-std::array<float,2>{0.926700056f, 0.685759008f},
-std::array<float,2>{0.131187364f, 0.170421705f},
-std::array<float,2>{0.821288288f, 0.106091253f},
-std::array<float,2>{0.0948846638f, 0.555933118f},
-std::array<float,2>{0.647905648f, 0.819547176f},
-std::array<float,2>{0.330067217f, 0.334119916f},
-std::array<float,2>{0.724828005f, 0.239146486f},
-std::array<float,2>{0.278093457f, 0.724651694f},
-std::array<float,2>{0.774861515f, 0.876198113f},
-std::array<float,2>{0.0247958209f, 0.493022442f},
-std::array<float,2>{0.943010211f, 0.285576403f},
-std::array<float,2>{0.190284953f, 0.784573734f},
-std::array<float,2>{0.54616344f, 0.597466946f},
-std::array<float,2>{0.440155923f, 0.0280018561f},
-std::array<float,2>{0.679586291f, 0.365415335f},
-std::array<float,2>{0.358109325f, 0.843931496f},
-std::array<float,2>{0.860155404f, 0.509955883f},
-std::array<float,2>{0.0911326036f, 0.0728799105f},
-std::array<float,2>{0.895344079f, 0.137751728f},
-std::array<float,2>{0.183821648f, 0.653020501f},
-std::array<float,2>{0.578710377f, 0.979945183f},
-std::array<float,2>{0.383799881f, 0.396238387f},
-std::array<float,2>{0.51391691f, 0.0524927787f},
-std::array<float,2>{0.493961751f, 0.568502665f},
-std::array<float,2>{0.982554197f, 0.772690713f},
-std::array<float,2>{0.231980443f, 0.25032872f},
-std::array<float,2>{0.812119663f, 0.461224675f},
-std::array<float,2>{0.0313663483f, 0.927878082f},
-std::array<float,2>{0.707904458f, 0.700232923f},
-std::array<float,2>{0.291197985f, 0.213446066f},
-std::array<float,2>{0.693648696f, 0.479046732f},
-std::array<float,2>{0.310035348f, 0.893050909f},
-std::array<float,2>{0.787933052f, 0.741225243f},
-std::array<float,2>{0.0530802235f, 0.227173388f},
-std::array<float,2>{0.986743331f, 0.00101074658f},
-std::array<float,2>{0.245647013f, 0.616416752f},
-std::array<float,2>{0.524645865f, 0.809458613f},
-std::array<float,2>{0.479481459f, 0.298660487f},
-std::array<float,2>{0.574292779f, 0.182449982f},
-std::array<float,2>{0.395255744f, 0.665592492f},
-std::array<float,2>{0.880895317f, 0.946012199f},
-std::array<float,2>{0.168436408f, 0.409108132f},
-std::array<float,2>{0.85911876f, 0.314528316f},
-std::array<float,2>{0.0772161335f, 0.838196576f},
-std::array<float,2>{0.664799631f, 0.538822234f},
-std::array<float,2>{0.366775632f, 0.121960253f},
-std::array<float,2>{0.562090814f, 0.2730425f},
-std::array<float,2>{0.465283632f, 0.764881313f},
-std::array<float,2>{0.959459424f, 0.592713296f},
-std::array<float,2>{0.203417525f, 0.0430986546f},
-std::array<float,2>{0.76482743f, 0.189814776f},
-std::array<float,2>{0.00878094696f, 0.707878411f},
-std::array<float,2>{0.747477353f, 0.919897079f},
-std::array<float,2>{0.259394139f, 0.439677864f},
-std::array<float,2>{0.639873922f, 0.084453769f},
-std::array<float,2>{0.315039009f, 0.523945808f},
-std::array<float,2>{0.830070198f, 0.866043925f},
-std::array<float,2>{0.120688789f, 0.354598105f},
-std::array<float,2>{0.919907808f, 0.381010383f},
-std::array<float,2>{0.148859873f, 0.998549163f},
-std::array<float,2>{0.624504089f, 0.625355065f},
-std::array<float,2>{0.426522195f, 0.151733726f},
-std::array<float,2>{0.564906597f, 0.497577578f},
-std::array<float,2>{0.401629031f, 0.878994346f},
-std::array<float,2>{0.88947624f, 0.720593572f},
-std::array<float,2>{0.160301492f, 0.237640694f},
-std::array<float,2>{0.84705627f, 0.0239762478f},
-std::array<float,2>{0.0672899261f, 0.598570585f},
-std::array<float,2>{0.662573278f, 0.786783099f},
-std::array<float,2>{0.370288521f, 0.281893492f},
-std::array<float,2>{0.700061917f, 0.16575636f},
-std::array<float,2>{0.301934332f, 0.679950953f},
-std::array<float,2>{0.790827036f, 0.953757107f},
-std::array<float,2>{0.0593420602f, 0.422498763f},
-std::array<float,2>{0.996726036f, 0.32920453f},
-std::array<float,2>{0.236902356f, 0.813415587f},
-std::array<float,2>{0.518001854f, 0.560366511f},
-std::array<float,2>{0.475732744f, 0.103800222f},
-std::array<float,2>{0.630309641f, 0.254240394f},
-std::array<float,2>{0.32377252f, 0.769066155f},
-std::array<float,2>{0.838169396f, 0.562779367f},
-std::array<float,2>{0.110352471f, 0.0480073765f},
-std::array<float,2>{0.906681597f, 0.216501355f},
-std::array<float,2>{0.14370124f, 0.696723938f},
-std::array<float,2>{0.609787881f, 0.923686683f},
-std::array<float,2>{0.435579836f, 0.466149956f},
-std::array<float,2>{0.551357865f, 0.0771579742f},
-std::array<float,2>{0.456070662f, 0.512415886f},
-std::array<float,2>{0.96203953f, 0.850308597f},
-std::array<float,2>{0.21310319f, 0.362506539f},
-std::array<float,2>{0.750386298f, 0.390988708f},
-std::array<float,2>{0.0071747317f, 0.980961978f},
-std::array<float,2>{0.73863709f, 0.651502311f},
-std::array<float,2>{0.252724022f, 0.135795966f},
-std::array<float,2>{0.729460895f, 0.412474066f},
-std::array<float,2>{0.271883249f, 0.950834811f},
-std::array<float,2>{0.773241043f, 0.669567347f},
-std::array<float,2>{0.0180701595f, 0.18464449f},
-std::array<float,2>{0.948479295f, 0.119633511f},
-std::array<float,2>{0.199288145f, 0.534752905f},
-std::array<float,2>{0.537479103f, 0.843502223f},
-std::array<float,2>{0.447787076f, 0.318149745f},
-std::array<float,2>{0.606438935f, 0.233521715f},
-std::array<float,2>{0.415504903f, 0.734842062f},
-std::array<float,2>{0.934976578f, 0.894628763f},
-std::array<float,2>{0.136346146f, 0.483994722f},
-std::array<float,2>{0.818927526f, 0.30418399f},
-std::array<float,2>{0.106532834f, 0.8059901f},
-std::array<float,2>{0.649742126f, 0.612664521f},
-std::array<float,2>{0.337224722f, 0.00611001672f},
-std::array<float,2>{0.503740966f, 0.359148085f},
-std::array<float,2>{0.485434413f, 0.860175669f},
-std::array<float,2>{0.971020818f, 0.527720809f},
-std::array<float,2>{0.224841088f, 0.0802851394f},
-std::array<float,2>{0.799717844f, 0.154378682f},
-std::array<float,2>{0.0436443575f, 0.631608546f},
-std::array<float,2>{0.71838969f, 0.995617032f},
-std::array<float,2>{0.28360796f, 0.37714678f},
-std::array<float,2>{0.685987055f, 0.0404218696f},
-std::array<float,2>{0.346457779f, 0.589705467f},
-std::array<float,2>{0.871507823f, 0.75969708f},
-std::array<float,2>{0.0857187659f, 0.266957283f},
-std::array<float,2>{0.898527801f, 0.441924214f},
-std::array<float,2>{0.175513268f, 0.915784121f},
-std::array<float,2>{0.588492334f, 0.703998625f},
-std::array<float,2>{0.380152524f, 0.193153098f},
-std::array<float,2>{0.540093303f, 0.385299742f},
-std::array<float,2>{0.444952905f, 0.9908939f},
-std::array<float,2>{0.941092134f, 0.63892436f},
-std::array<float,2>{0.193781048f, 0.143715903f},
-std::array<float,2>{0.780411959f, 0.0925470963f},
-std::array<float,2>{0.0308189131f, 0.522790313f},
-std::array<float,2>{0.719924212f, 0.871410251f},
-std::array<float,2>{0.274009198f, 0.349865049f},
-std::array<float,2>{0.643839002f, 0.201757967f},
-std::array<float,2>{0.332535058f, 0.713631153f},
-std::array<float,2>{0.825383544f, 0.907594204f},
-std::array<float,2>{0.0982404351f, 0.44704476f},
-std::array<float,2>{0.924671352f, 0.275801569f},
-std::array<float,2>{0.126324132f, 0.752213717f},
-std::array<float,2>{0.597999513f, 0.578874171f},
-std::array<float,2>{0.411743462f, 0.0316605754f},
-std::array<float,2>{0.706387699f, 0.3265329f},
-std::array<float,2>{0.295937836f, 0.83180362f},
-std::array<float,2>{0.805345476f, 0.544901729f},
-std::array<float,2>{0.038496621f, 0.110334329f},
-std::array<float,2>{0.978128195f, 0.172850087f},
-std::array<float,2>{0.230416358f, 0.661807775f},
-std::array<float,2>{0.508500457f, 0.940007865f},
-std::array<float,2>{0.49920091f, 0.4154208f},
-std::array<float,2>{0.585374713f, 0.0117200604f},
-std::array<float,2>{0.386793137f, 0.62408936f},
-std::array<float,2>{0.891253054f, 0.804635048f},
-std::array<float,2>{0.181136668f, 0.305280149f},
-std::array<float,2>{0.865644872f, 0.469015837f},
-std::array<float,2>{0.0880526751f, 0.901691794f},
-std::array<float,2>{0.673741877f, 0.745826542f},
-std::array<float,2>{0.35196209f, 0.223184586f},
-std::array<float,2>{0.669592559f, 0.454884082f},
-std::array<float,2>{0.361862004f, 0.935796976f},
-std::array<float,2>{0.853918314f, 0.68906641f},
-std::array<float,2>{0.0710699335f, 0.208653301f},
-std::array<float,2>{0.878431797f, 0.0570662357f},
-std::array<float,2>{0.165110528f, 0.573564768f},
-std::array<float,2>{0.57360673f, 0.780200064f},
-std::array<float,2>{0.393951803f, 0.257990271f},
-std::array<float,2>{0.529504836f, 0.126183167f},
-std::array<float,2>{0.484327912f, 0.645558357f},
-std::array<float,2>{0.990584373f, 0.976095974f},
-std::array<float,2>{0.248441741f, 0.401775479f},
-std::array<float,2>{0.78178364f, 0.374091625f},
-std::array<float,2>{0.0470222682f, 0.852897525f},
-std::array<float,2>{0.687854707f, 0.502143085f},
-std::array<float,2>{0.307222813f, 0.0683097392f},
-std::array<float,2>{0.618630111f, 0.295594275f},
-std::array<float,2>{0.424878925f, 0.789292157f},
-std::array<float,2>{0.915355563f, 0.602780521f},
-std::array<float,2>{0.153566748f, 0.017574463f},
-std::array<float,2>{0.834584117f, 0.24554038f},
-std::array<float,2>{0.121857256f, 0.734333336f},
-std::array<float,2>{0.636245489f, 0.883208632f},
-std::array<float,2>{0.318868279f, 0.486053258f},
-std::array<float,2>{0.745747507f, 0.0986583009f},
-std::array<float,2>{0.263991475f, 0.54732734f},
-std::array<float,2>{0.758658469f, 0.825398028f},
-std::array<float,2>{0.015401925f, 0.340083897f},
-std::array<float,2>{0.953815639f, 0.434862673f},
-std::array<float,2>{0.207523465f, 0.96644187f},
-std::array<float,2>{0.555839181f, 0.673770964f},
-std::array<float,2>{0.462256968f, 0.162450194f},
-std::array<float,2>{0.506875753f, 0.49165827f},
-std::array<float,2>{0.490579516f, 0.889850557f},
-std::array<float,2>{0.972785532f, 0.729631186f},
-std::array<float,2>{0.220932782f, 0.247159198f},
-std::array<float,2>{0.804357171f, 0.0221627224f},
-std::array<float,2>{0.042462986f, 0.607863724f},
-std::array<float,2>{0.711175978f, 0.795038223f},
-std::array<float,2>{0.286389917f, 0.289242208f},
-std::array<float,2>{0.682070076f, 0.158455864f},
-std::array<float,2>{0.349824429f, 0.676399708f},
-std::array<float,2>{0.870859563f, 0.961407959f},
-std::array<float,2>{0.0805869848f, 0.430015057f},
-std::array<float,2>{0.903652787f, 0.337789357f},
-std::array<float,2>{0.175999671f, 0.821852684f},
-std::array<float,2>{0.589973569f, 0.554370344f},
-std::array<float,2>{0.378515124f, 0.0940762088f},
-std::array<float,2>{0.732971013f, 0.262373418f},
-std::array<float,2>{0.268485636f, 0.777234256f},
-std::array<float,2>{0.76814431f, 0.577025652f},
-std::array<float,2>{0.0203920342f, 0.0612783208f},
-std::array<float,2>{0.952269793f, 0.203456998f},
-std::array<float,2>{0.196069971f, 0.691916287f},
-std::array<float,2>{0.533026099f, 0.930757761f},
-std::array<float,2>{0.45227924f, 0.459787041f},
-std::array<float,2>{0.602383554f, 0.0663011596f},
-std::array<float,2>{0.419122845f, 0.505785406f},
-std::array<float,2>{0.929849744f, 0.858842015f},
-std::array<float,2>{0.139335021f, 0.367430568f},
-std::array<float,2>{0.814968526f, 0.406079978f},
-std::array<float,2>{0.104715236f, 0.971333921f},
-std::array<float,2>{0.655329823f, 0.643041015f},
-std::array<float,2>{0.340689361f, 0.131996199f},
-std::array<float,2>{0.62518394f, 0.418732375f},
-std::array<float,2>{0.325659096f, 0.941668987f},
-std::array<float,2>{0.842075527f, 0.656355083f},
-std::array<float,2>{0.114964165f, 0.178940773f},
-std::array<float,2>{0.913927376f, 0.114723712f},
-std::array<float,2>{0.148140997f, 0.542617083f},
-std::array<float,2>{0.616753936f, 0.834764481f},
-std::array<float,2>{0.431168348f, 0.322346717f},
-std::array<float,2>{0.548882306f, 0.220923573f},
-std::array<float,2>{0.458970964f, 0.749729812f},
-std::array<float,2>{0.967912793f, 0.902780533f},
-std::array<float,2>{0.217464894f, 0.474553734f},
-std::array<float,2>{0.755577743f, 0.309022546f},
-std::array<float,2>{0.00164281845f, 0.797537446f},
-std::array<float,2>{0.735361814f, 0.618293345f},
-std::array<float,2>{0.255287439f, 0.0113236932f},
-std::array<float,2>{0.570171535f, 0.346955508f},
-std::array<float,2>{0.404143035f, 0.869814932f},
-std::array<float,2>{0.882932484f, 0.518489599f},
-std::array<float,2>{0.158806294f, 0.0881182328f},
-std::array<float,2>{0.848718166f, 0.14453958f},
-std::array<float,2>{0.0632071272f, 0.635367572f},
-std::array<float,2>{0.659052312f, 0.98579061f},
-std::array<float,2>{0.371215701f, 0.390137255f},
-std::array<float,2>{0.698039532f, 0.0389582179f},
-std::array<float,2>{0.297374904f, 0.582658589f},
-std::array<float,2>{0.794820547f, 0.754855514f},
-std::array<float,2>{0.0559095442f, 0.278349549f},
-std::array<float,2>{0.993103564f, 0.452626854f},
-std::array<float,2>{0.238563851f, 0.911535203f},
-std::array<float,2>{0.52296263f, 0.718378842f},
-std::array<float,2>{0.471500129f, 0.197710797f},
-std::array<float,2>{0.623835742f, 0.380717516f},
-std::array<float,2>{0.427711397f, 0.996601105f},
-std::array<float,2>{0.918362141f, 0.627483428f},
-std::array<float,2>{0.150265172f, 0.14918983f},
-std::array<float,2>{0.828382492f, 0.0822826549f},
-std::array<float,2>{0.120055497f, 0.52570188f},
-std::array<float,2>{0.639279664f, 0.863720119f},
-std::array<float,2>{0.316103458f, 0.353399605f},
-std::array<float,2>{0.746956468f, 0.188143179f},
-std::array<float,2>{0.258237839f, 0.710845113f},
-std::array<float,2>{0.764297366f, 0.921062231f},
-std::array<float,2>{0.00947076455f, 0.438183993f},
-std::array<float,2>{0.960516393f, 0.27025798f},
-std::array<float,2>{0.204820603f, 0.763139486f},
-std::array<float,2>{0.56115067f, 0.591428936f},
-std::array<float,2>{0.466749847f, 0.0465356968f},
-std::array<float,2>{0.665462911f, 0.312805593f},
-std::array<float,2>{0.365440071f, 0.837712884f},
-std::array<float,2>{0.858324647f, 0.535680592f},
-std::array<float,2>{0.0770561844f, 0.124452449f},
-std::array<float,2>{0.88278532f, 0.181014255f},
-std::array<float,2>{0.169440344f, 0.666356742f},
-std::array<float,2>{0.575696051f, 0.948108852f},
-std::array<float,2>{0.39563638f, 0.408060968f},
-std::array<float,2>{0.523744941f, 0.00328812888f},
-std::array<float,2>{0.479741752f, 0.613421798f},
-std::array<float,2>{0.988208115f, 0.812010646f},
-std::array<float,2>{0.244233847f, 0.299259692f},
-std::array<float,2>{0.788719416f, 0.476662457f},
-std::array<float,2>{0.0537544936f, 0.891879141f},
-std::array<float,2>{0.694394529f, 0.738462985f},
-std::array<float,2>{0.309070289f, 0.228604406f},
-std::array<float,2>{0.708906829f, 0.463855743f},
-std::array<float,2>{0.292886823f, 0.926279128f},
-std::array<float,2>{0.811295688f, 0.703096151f},
-std::array<float,2>{0.0322867632f, 0.212796032f},
-std::array<float,2>{0.983901739f, 0.0540864915f},
-std::array<float,2>{0.231341228f, 0.568003953f},
-std::array<float,2>{0.51466167f, 0.769725084f},
-std::array<float,2>{0.492603123f, 0.252119035f},
-std::array<float,2>{0.579512954f, 0.140251338f},
-std::array<float,2>{0.383593768f, 0.656084299f},
-std::array<float,2>{0.895612836f, 0.977275789f},
-std::array<float,2>{0.185441062f, 0.397856981f},
-std::array<float,2>{0.860728323f, 0.364426702f},
-std::array<float,2>{0.0900181234f, 0.84576869f},
-std::array<float,2>{0.678224981f, 0.509233475f},
-std::array<float,2>{0.359086245f, 0.0720805973f},
-std::array<float,2>{0.545733571f, 0.28804031f},
-std::array<float,2>{0.441066921f, 0.781473935f},
-std::array<float,2>{0.94190383f, 0.594244182f},
-std::array<float,2>{0.190574497f, 0.0307278205f},
-std::array<float,2>{0.773866832f, 0.241908491f},
-std::array<float,2>{0.0236808788f, 0.723632991f},
-std::array<float,2>{0.726406991f, 0.876972437f},
-std::array<float,2>{0.279225022f, 0.494141072f},
-std::array<float,2>{0.647276521f, 0.108958721f},
-std::array<float,2>{0.328506231f, 0.557606161f},
-std::array<float,2>{0.822014451f, 0.817521036f},
-std::array<float,2>{0.0944220051f, 0.333875179f},
-std::array<float,2>{0.927214682f, 0.428899795f},
-std::array<float,2>{0.132216483f, 0.959109962f},
-std::array<float,2>{0.596870303f, 0.684725046f},
-std::array<float,2>{0.406921715f, 0.168648735f},
-std::array<float,2>{0.588907599f, 0.443915814f},
-std::array<float,2>{0.379448235f, 0.916076958f},
-std::array<float,2>{0.899679542f, 0.705875576f},
-std::array<float,2>{0.174720168f, 0.194576502f},
-std::array<float,2>{0.872948587f, 0.0415389873f},
-std::array<float,2>{0.0841038004f, 0.586225748f},
-std::array<float,2>{0.687431633f, 0.760611951f},
-std::array<float,2>{0.347180843f, 0.268008113f},
-std::array<float,2>{0.717716694f, 0.152863532f},
-std::array<float,2>{0.284469128f, 0.629339576f},
-std::array<float,2>{0.800637841f, 0.992534041f},
-std::array<float,2>{0.0441165566f, 0.37689212f},
-std::array<float,2>{0.972554743f, 0.356796116f},
-std::array<float,2>{0.226234868f, 0.862554133f},
-std::array<float,2>{0.501983106f, 0.530145943f},
-std::array<float,2>{0.484732687f, 0.079024069f},
-std::array<float,2>{0.648752749f, 0.302066177f},
-std::array<float,2>{0.336485595f, 0.808245957f},
-std::array<float,2>{0.820247948f, 0.610013962f},
-std::array<float,2>{0.106443502f, 0.00534848263f},
-std::array<float,2>{0.933650434f, 0.232261822f},
-std::array<float,2>{0.135111809f, 0.737039149f},
-std::array<float,2>{0.606710374f, 0.89678961f},
-std::array<float,2>{0.414296806f, 0.481293023f},
-std::array<float,2>{0.538720727f, 0.117475174f},
-std::array<float,2>{0.448438227f, 0.531535566f},
-std::array<float,2>{0.947402239f, 0.841282785f},
-std::array<float,2>{0.200690433f, 0.319097072f},
-std::array<float,2>{0.772368252f, 0.411540568f},
-std::array<float,2>{0.0186615735f, 0.951810896f},
-std::array<float,2>{0.730423152f, 0.671002626f},
-std::array<float,2>{0.272982508f, 0.186454892f},
-std::array<float,2>{0.739264011f, 0.393156826f},
-std::array<float,2>{0.253302693f, 0.982591152f},
-std::array<float,2>{0.751273453f, 0.649179578f},
-std::array<float,2>{0.00599254714f, 0.133122995f},
-std::array<float,2>{0.961795807f, 0.0753474683f},
-std::array<float,2>{0.214017525f, 0.514637649f},
-std::array<float,2>{0.551825643f, 0.848600686f},
-std::array<float,2>{0.45532465f, 0.359491497f},
-std::array<float,2>{0.611075461f, 0.218580231f},
-std::array<float,2>{0.437417507f, 0.698908508f},
-std::array<float,2>{0.908053458f, 0.924429178f},
-std::array<float,2>{0.143336698f, 0.468432665f},
-std::array<float,2>{0.839349747f, 0.256388307f},
-std::array<float,2>{0.1100749f, 0.766707838f},
-std::array<float,2>{0.629403651f, 0.564964294f},
-std::array<float,2>{0.322312683f, 0.049286671f},
-std::array<float,2>{0.518903732f, 0.331745863f},
-std::array<float,2>{0.474847585f, 0.814851284f},
-std::array<float,2>{0.997350931f, 0.561609328f},
-std::array<float,2>{0.23750706f, 0.102669433f},
-std::array<float,2>{0.789357424f, 0.167678624f},
-std::array<float,2>{0.0596798137f, 0.683188856f},
-std::array<float,2>{0.700457633f, 0.956172645f},
-std::array<float,2>{0.301098704f, 0.425148934f},
-std::array<float,2>{0.663871825f, 0.0265525561f},
-std::array<float,2>{0.369847447f, 0.600967586f},
-std::array<float,2>{0.845877349f, 0.787399232f},
-std::array<float,2>{0.0676080287f, 0.284865916f},
-std::array<float,2>{0.889720142f, 0.499892861f},
-std::array<float,2>{0.161953554f, 0.881762803f},
-std::array<float,2>{0.565926611f, 0.720858932f},
-std::array<float,2>{0.400857925f, 0.235032797f},
-std::array<float,2>{0.555330575f, 0.437108099f},
-std::array<float,2>{0.460975528f, 0.968603253f},
-std::array<float,2>{0.954969943f, 0.674166203f},
-std::array<float,2>{0.208326012f, 0.161310881f},
-std::array<float,2>{0.759363472f, 0.100301683f},
-std::array<float,2>{0.0141079184f, 0.549621463f},
-std::array<float,2>{0.744699895f, 0.827522933f},
-std::array<float,2>{0.265380859f, 0.343726367f},
-std::array<float,2>{0.635369062f, 0.243953779f},
-std::array<float,2>{0.319692761f, 0.730741441f},
-std::array<float,2>{0.835255563f, 0.885343254f},
-std::array<float,2>{0.12276902f, 0.487020671f},
-std::array<float,2>{0.914273381f, 0.293575287f},
-std::array<float,2>{0.153170779f, 0.792716682f},
-std::array<float,2>{0.617965162f, 0.605108678f},
-std::array<float,2>{0.424213439f, 0.0192264225f},
-std::array<float,2>{0.68884331f, 0.372644722f},
-std::array<float,2>{0.308129013f, 0.855255604f},
-std::array<float,2>{0.782678604f, 0.501389265f},
-std::array<float,2>{0.0486779399f, 0.0694946796f},
-std::array<float,2>{0.991341352f, 0.127858803f},
-std::array<float,2>{0.249427989f, 0.648324132f},
-std::array<float,2>{0.53054142f, 0.973513663f},
-std::array<float,2>{0.482774019f, 0.399943173f},
-std::array<float,2>{0.572296619f, 0.0551192872f},
-std::array<float,2>{0.393219978f, 0.571770608f},
-std::array<float,2>{0.877541423f, 0.778057694f},
-std::array<float,2>{0.16406782f, 0.261282712f},
-std::array<float,2>{0.855048358f, 0.456386805f},
-std::array<float,2>{0.0720435157f, 0.934514403f},
-std::array<float,2>{0.668186247f, 0.690401912f},
-std::array<float,2>{0.363275796f, 0.209666848f},
-std::array<float,2>{0.672069788f, 0.472461253f},
-std::array<float,2>{0.353125721f, 0.89969629f},
-std::array<float,2>{0.866348147f, 0.744123876f},
-std::array<float,2>{0.0897316858f, 0.22583279f},
-std::array<float,2>{0.89167428f, 0.0154717099f},
-std::array<float,2>{0.180218875f, 0.6220631f},
-std::array<float,2>{0.584708214f, 0.801106334f},
-std::array<float,2>{0.387791604f, 0.308428109f},
-std::array<float,2>{0.508944154f, 0.174781486f},
-std::array<float,2>{0.498405367f, 0.662413716f},
-std::array<float,2>{0.977206707f, 0.939415216f},
-std::array<float,2>{0.228689015f, 0.417448252f},
-std::array<float,2>{0.806481302f, 0.324584246f},
-std::array<float,2>{0.0373660773f, 0.829076588f},
-std::array<float,2>{0.705577254f, 0.546716452f},
-std::array<float,2>{0.295837045f, 0.113023125f},
-std::array<float,2>{0.598870516f, 0.275095642f},
-std::array<float,2>{0.410366237f, 0.750683844f},
-std::array<float,2>{0.924896359f, 0.581731379f},
-std::array<float,2>{0.125915527f, 0.0342467651f},
-std::array<float,2>{0.824981928f, 0.200147569f},
-std::array<float,2>{0.0995847657f, 0.712886333f},
-std::array<float,2>{0.642651618f, 0.908206403f},
-std::array<float,2>{0.333379626f, 0.449005783f},
-std::array<float,2>{0.719039381f, 0.0913777575f},
-std::array<float,2>{0.274799436f, 0.519951522f},
-std::array<float,2>{0.779741228f, 0.874378979f},
-std::array<float,2>{0.0302461069f, 0.34810245f},
-std::array<float,2>{0.939456105f, 0.384738684f},
-std::array<float,2>{0.194678426f, 0.988758504f},
-std::array<float,2>{0.539320946f, 0.637567103f},
-std::array<float,2>{0.443927377f, 0.142429501f},
-std::array<float,2>{0.53439784f, 0.457255304f},
-std::array<float,2>{0.44990778f, 0.933474481f},
-std::array<float,2>{0.950896442f, 0.694163561f},
-std::array<float,2>{0.198647514f, 0.205278188f},
-std::array<float,2>{0.766959369f, 0.0586045235f},
-std::array<float,2>{0.0223954581f, 0.576008499f},
-std::array<float,2>{0.73184967f, 0.774346769f},
-std::array<float,2>{0.266042113f, 0.264558554f},
-std::array<float,2>{0.653846145f, 0.130587056f},
-std::array<float,2>{0.343278408f, 0.642431319f},
-std::array<float,2>{0.814156175f, 0.970283508f},
-std::array<float,2>{0.102601372f, 0.402725488f},
-std::array<float,2>{0.932206988f, 0.369784057f},
-std::array<float,2>{0.137366697f, 0.856019735f},
-std::array<float,2>{0.604773462f, 0.506487131f},
-std::array<float,2>{0.420865983f, 0.0634438172f},
-std::array<float,2>{0.714464843f, 0.292327106f},
-std::array<float,2>{0.287521929f, 0.793954313f},
-std::array<float,2>{0.80140686f, 0.606722355f},
-std::array<float,2>{0.0408958346f, 0.0210405514f},
-std::array<float,2>{0.976331949f, 0.248870596f},
-std::array<float,2>{0.218932703f, 0.727804422f},
-std::array<float,2>{0.504043579f, 0.88833952f},
-std::array<float,2>{0.488824219f, 0.488724291f},
-std::array<float,2>{0.593202591f, 0.0966279656f},
-std::array<float,2>{0.375436217f, 0.552266121f},
-std::array<float,2>{0.905737758f, 0.824154854f},
-std::array<float,2>{0.178861037f, 0.339423209f},
-std::array<float,2>{0.86876595f, 0.432062984f},
-std::array<float,2>{0.0800007656f, 0.964041889f},
-std::array<float,2>{0.680464029f, 0.678154409f},
-std::array<float,2>{0.34930715f, 0.158038512f},
-std::array<float,2>{0.658066034f, 0.387616962f},
-std::array<float,2>{0.374092489f, 0.986704588f},
-std::array<float,2>{0.850392342f, 0.634328544f},
-std::array<float,2>{0.0655437484f, 0.146686614f},
-std::array<float,2>{0.88649112f, 0.0859705731f},
-std::array<float,2>{0.157215923f, 0.516004562f},
-std::array<float,2>{0.566835225f, 0.867591918f},
-std::array<float,2>{0.404797435f, 0.345150232f},
-std::array<float,2>{0.519668579f, 0.197204858f},
-std::array<float,2>{0.470161438f, 0.714911044f},
-std::array<float,2>{0.994307041f, 0.912265658f},
-std::array<float,2>{0.241032094f, 0.450249344f},
-std::array<float,2>{0.796757519f, 0.280748904f},
-std::array<float,2>{0.0571138561f, 0.756609857f},
-std::array<float,2>{0.697125494f, 0.585021317f},
-std::array<float,2>{0.299453199f, 0.0363354646f},
-std::array<float,2>{0.613368571f, 0.32214129f},
-std::array<float,2>{0.431987137f, 0.832627535f},
-std::array<float,2>{0.910908818f, 0.539869666f},
-std::array<float,2>{0.146479309f, 0.116729453f},
-std::array<float,2>{0.84066236f, 0.177165747f},
-std::array<float,2>{0.116888963f, 0.659268737f},
-std::array<float,2>{0.627910554f, 0.944112837f},
-std::array<float,2>{0.326811403f, 0.420779437f},
-std::array<float,2>{0.737128258f, 0.00902674161f},
-std::array<float,2>{0.2564964f, 0.62047708f},
-std::array<float,2>{0.756930649f, 0.800057292f},
-std::array<float,2>{0.00239982386f, 0.311511457f},
-std::array<float,2>{0.966742456f, 0.475134015f},
-std::array<float,2>{0.215981171f, 0.905832946f},
-std::array<float,2>{0.547556818f, 0.746934533f},
-std::array<float,2>{0.459998161f, 0.220505819f},
-std::array<float,2>{0.578068435f, 0.410033047f},
-std::array<float,2>{0.396913469f, 0.947182059f},
-std::array<float,2>{0.880155861f, 0.664688528f},
-std::array<float,2>{0.170741916f, 0.182769865f},
-std::array<float,2>{0.856186152f, 0.123019047f},
-std::array<float,2>{0.0761404932f, 0.537732959f},
-std::array<float,2>{0.666983187f, 0.838917196f},
-std::array<float,2>{0.364124268f, 0.315925896f},
-std::array<float,2>{0.691881955f, 0.228482664f},
-std::array<float,2>{0.3113662f, 0.740281224f},
-std::array<float,2>{0.786982417f, 0.894394696f},
-std::array<float,2>{0.0525207743f, 0.480313212f},
-std::array<float,2>{0.985570788f, 0.297050297f},
-std::array<float,2>{0.242454246f, 0.810429513f},
-std::array<float,2>{0.525936961f, 0.615352571f},
-std::array<float,2>{0.478415549f, 0.000229024183f},
-std::array<float,2>{0.638601124f, 0.353713274f},
-std::array<float,2>{0.313412309f, 0.867165327f},
-std::array<float,2>{0.831274152f, 0.525059462f},
-std::array<float,2>{0.118857034f, 0.0856697932f},
-std::array<float,2>{0.920939684f, 0.151301816f},
-std::array<float,2>{0.150620252f, 0.626656651f},
-std::array<float,2>{0.622090042f, 0.999899447f},
-std::array<float,2>{0.4289819f, 0.382308394f},
-std::array<float,2>{0.558815241f, 0.0445470922f},
-std::array<float,2>{0.468185753f, 0.593173623f},
-std::array<float,2>{0.958654761f, 0.763797462f},
-std::array<float,2>{0.206800833f, 0.271836787f},
-std::array<float,2>{0.762109935f, 0.44101581f},
-std::array<float,2>{0.010002397f, 0.918045819f},
-std::array<float,2>{0.749006987f, 0.708831489f},
-std::array<float,2>{0.260013103f, 0.191268072f},
-std::array<float,2>{0.723556459f, 0.493785977f},
-std::array<float,2>{0.280465454f, 0.875723839f},
-std::array<float,2>{0.776864409f, 0.726108134f},
-std::array<float,2>{0.0256108772f, 0.23973529f},
-std::array<float,2>{0.945242107f, 0.028887298f},
-std::array<float,2>{0.187541589f, 0.596197724f},
-std::array<float,2>{0.544034362f, 0.784149408f},
-std::array<float,2>{0.438600868f, 0.286571145f},
-std::array<float,2>{0.594004571f, 0.171374217f},
-std::array<float,2>{0.408824563f, 0.68669486f},
-std::array<float,2>{0.928392589f, 0.957567155f},
-std::array<float,2>{0.130472377f, 0.426934779f},
-std::array<float,2>{0.82275486f, 0.335843951f},
-std::array<float,2>{0.097074315f, 0.819006801f},
-std::array<float,2>{0.645502687f, 0.554942548f},
-std::array<float,2>{0.330999821f, 0.106609076f},
-std::array<float,2>{0.512323856f, 0.251118332f},
-std::array<float,2>{0.495461017f, 0.772272885f},
-std::array<float,2>{0.981857896f, 0.570159853f},
-std::array<float,2>{0.232704163f, 0.0509384945f},
-std::array<float,2>{0.809340298f, 0.21406807f},
-std::array<float,2>{0.033334516f, 0.699321628f},
-std::array<float,2>{0.709737003f, 0.928727925f},
-std::array<float,2>{0.289261878f, 0.462437928f},
-std::array<float,2>{0.67651844f, 0.0736597478f},
-std::array<float,2>{0.355995595f, 0.511523128f},
-std::array<float,2>{0.861409426f, 0.844828069f},
-std::array<float,2>{0.0930223837f, 0.367031842f},
-std::array<float,2>{0.897057056f, 0.395329297f},
-std::array<float,2>{0.186042786f, 0.978720367f},
-std::array<float,2>{0.580673277f, 0.65344578f},
-std::array<float,2>{0.38664183f, 0.137005419f},
-std::array<float,2>{0.608812094f, 0.482602835f},
-std::array<float,2>{0.416790396f, 0.896206915f},
-std::array<float,2>{0.936727464f, 0.735426664f},
-std::array<float,2>{0.134574801f, 0.232899487f},
-std::array<float,2>{0.817333698f, 0.00761490269f},
-std::array<float,2>{0.108292259f, 0.612043619f},
-std::array<float,2>{0.65183115f, 0.805169046f},
-std::array<float,2>{0.338414818f, 0.303405493f},
-std::array<float,2>{0.727792263f, 0.184124991f},
-std::array<float,2>{0.270009011f, 0.668165267f},
-std::array<float,2>{0.769657493f, 0.949534774f},
-std::array<float,2>{0.0158168711f, 0.413573623f},
-std::array<float,2>{0.947158456f, 0.316818327f},
-std::array<float,2>{0.201896891f, 0.841849506f},
-std::array<float,2>{0.535919964f, 0.533553302f},
-std::array<float,2>{0.445371956f, 0.121008568f},
-std::array<float,2>{0.685117424f, 0.265691638f},
-std::array<float,2>{0.344487637f, 0.7582919f},
-std::array<float,2>{0.873856306f, 0.588509798f},
-std::array<float,2>{0.0833248273f, 0.039959114f},
-std::array<float,2>{0.901194096f, 0.192245871f},
-std::array<float,2>{0.172520787f, 0.704880297f},
-std::array<float,2>{0.586026371f, 0.914258718f},
-std::array<float,2>{0.380958647f, 0.44306618f},
-std::array<float,2>{0.501607478f, 0.0811640993f},
-std::array<float,2>{0.48810181f, 0.528776586f},
-std::array<float,2>{0.969902158f, 0.860408783f},
-std::array<float,2>{0.224391222f, 0.357725888f},
-std::array<float,2>{0.797195792f, 0.378442407f},
-std::array<float,2>{0.0461823456f, 0.994997442f},
-std::array<float,2>{0.715984344f, 0.632283568f},
-std::array<float,2>{0.282871187f, 0.155722082f},
-std::array<float,2>{0.701908529f, 0.423204541f},
-std::array<float,2>{0.303511918f, 0.954509199f},
-std::array<float,2>{0.792186677f, 0.681495368f},
-std::array<float,2>{0.0621219017f, 0.164631501f},
-std::array<float,2>{0.999096155f, 0.104610428f},
-std::array<float,2>{0.235181257f, 0.558641613f},
-std::array<float,2>{0.516897917f, 0.813512743f},
-std::array<float,2>{0.473305494f, 0.328451574f},
-std::array<float,2>{0.563604236f, 0.236847028f},
-std::array<float,2>{0.398668319f, 0.719434261f},
-std::array<float,2>{0.887538135f, 0.880672634f},
-std::array<float,2>{0.162236497f, 0.496115357f},
-std::array<float,2>{0.844777465f, 0.28277266f},
-std::array<float,2>{0.0701751858f, 0.785846651f},
-std::array<float,2>{0.661060989f, 0.599214733f},
-std::array<float,2>{0.367879599f, 0.0244454071f},
-std::array<float,2>{0.553967416f, 0.361688763f},
-std::array<float,2>{0.454830945f, 0.850940168f},
-std::array<float,2>{0.964458346f, 0.513407946f},
-std::array<float,2>{0.212824345f, 0.0763608143f},
-std::array<float,2>{0.752977312f, 0.135447174f},
-std::array<float,2>{0.00571795832f, 0.65097481f},
-std::array<float,2>{0.741886675f, 0.981758654f},
-std::array<float,2>{0.251721561f, 0.392071903f},
-std::array<float,2>{0.632219732f, 0.0476699956f},
-std::array<float,2>{0.321109354f, 0.564368963f},
-std::array<float,2>{0.837014556f, 0.768074036f},
-std::array<float,2>{0.112976551f, 0.255799025f},
-std::array<float,2>{0.90942657f, 0.465334326f},
-std::array<float,2>{0.142434642f, 0.922237873f},
-std::array<float,2>{0.612027347f, 0.696163833f},
-std::array<float,2>{0.433962137f, 0.214873701f},
-std::array<float,2>{0.527407825f, 0.40047881f},
-std::array<float,2>{0.481471241f, 0.97513479f},
-std::array<float,2>{0.988809109f, 0.645326972f},
-std::array<float,2>{0.247586325f, 0.125881463f},
-std::array<float,2>{0.783587515f, 0.0667198971f},
-std::array<float,2>{0.0488505885f, 0.503594816f},
-std::array<float,2>{0.691059411f, 0.851731718f},
-std::array<float,2>{0.306392103f, 0.373482406f},
-std::array<float,2>{0.670110703f, 0.207085013f},
-std::array<float,2>{0.359992653f, 0.687663257f},
-std::array<float,2>{0.852663934f, 0.936714351f},
-std::array<float,2>{0.072612755f, 0.453337073f},
-std::array<float,2>{0.875298321f, 0.259572774f},
-std::array<float,2>{0.166453585f, 0.78028208f},
-std::array<float,2>{0.571334183f, 0.572952509f},
-std::array<float,2>{0.391363382f, 0.0576946363f},
-std::array<float,2>{0.743689597f, 0.34096688f},
-std::array<float,2>{0.262260646f, 0.824976921f},
-std::array<float,2>{0.761120379f, 0.548779666f},
-std::array<float,2>{0.0130205061f, 0.0978542864f},
-std::array<float,2>{0.956077397f, 0.163362235f},
-std::array<float,2>{0.210220382f, 0.672240078f},
-std::array<float,2>{0.557735264f, 0.965171516f},
-std::array<float,2>{0.462948799f, 0.433633298f},
-std::array<float,2>{0.620913208f, 0.0164105333f},
-std::array<float,2>{0.422308803f, 0.60169965f},
-std::array<float,2>{0.916961551f, 0.790895939f},
-std::array<float,2>{0.155027106f, 0.296079516f},
-std::array<float,2>{0.832958877f, 0.484782517f},
-std::array<float,2>{0.123316437f, 0.884341359f},
-std::array<float,2>{0.633004785f, 0.732555985f},
-std::array<float,2>{0.316524923f, 0.244891763f},
-std::array<float,2>{0.641297817f, 0.446074635f},
-std::array<float,2>{0.334777534f, 0.906645477f},
-std::array<float,2>{0.827444613f, 0.714139283f},
-std::array<float,2>{0.100044586f, 0.202381879f},
-std::array<float,2>{0.922754467f, 0.032750275f},
-std::array<float,2>{0.128456682f, 0.579602361f},
-std::array<float,2>{0.601143658f, 0.753274441f},
-std::array<float,2>{0.413055182f, 0.277073234f},
-std::array<float,2>{0.542115688f, 0.143283173f},
-std::array<float,2>{0.442076445f, 0.639859855f},
-std::array<float,2>{0.939413786f, 0.991658032f},
-std::array<float,2>{0.19299233f, 0.385857016f},
-std::array<float,2>{0.77759248f, 0.350927293f},
-std::array<float,2>{0.0290171504f, 0.872178674f},
-std::array<float,2>{0.721807778f, 0.522218049f},
-std::array<float,2>{0.275589317f, 0.0930842832f},
-std::array<float,2>{0.582977653f, 0.306563258f},
-std::array<float,2>{0.389472812f, 0.802759349f},
-std::array<float,2>{0.894505739f, 0.62326169f},
-std::array<float,2>{0.182604685f, 0.0133684929f},
-std::array<float,2>{0.8634395f, 0.22411406f},
-std::array<float,2>{0.0860012323f, 0.744398415f},
-std::array<float,2>{0.675643563f, 0.901194334f},
-std::array<float,2>{0.355119228f, 0.469837189f},
-std::array<float,2>{0.703481376f, 0.110708192f},
-std::array<float,2>{0.294140697f, 0.543029547f},
-std::array<float,2>{0.80758667f, 0.830541134f},
-std::array<float,2>{0.0361081697f, 0.328048617f},
-std::array<float,2>{0.979807913f, 0.414581478f},
-std::array<float,2>{0.227830499f, 0.941312551f},
-std::array<float,2>{0.510487139f, 0.660601199f},
-std::array<float,2>{0.497564435f, 0.173463821f},
-std::array<float,2>{0.535734713f, 0.481826305f},
-std::array<float,2>{0.445749193f, 0.89796102f},
-std::array<float,2>{0.946842134f, 0.737595916f},
-std::array<float,2>{0.202038646f, 0.231303617f},
-std::array<float,2>{0.769901276f, 0.00420971354f},
-std::array<float,2>{0.0159046929f, 0.611033022f},
-std::array<float,2>{0.727542996f, 0.807100177f},
-std::array<float,2>{0.269754201f, 0.300967008f},
-std::array<float,2>{0.651510715f, 0.187210858f},
-std::array<float,2>{0.338761538f, 0.670792103f},
-std::array<float,2>{0.816950619f, 0.952883363f},
-std::array<float,2>{0.10801705f, 0.411026597f},
-std::array<float,2>{0.936840653f, 0.319891423f},
-std::array<float,2>{0.134494573f, 0.840199292f},
-std::array<float,2>{0.608538747f, 0.532723069f},
-std::array<float,2>{0.416647553f, 0.118338041f},
-std::array<float,2>{0.71607101f, 0.268832415f},
-std::array<float,2>{0.283166796f, 0.761441052f},
-std::array<float,2>{0.797047675f, 0.587570786f},
-std::array<float,2>{0.0459724739f, 0.0425787605f},
-std::array<float,2>{0.970152557f, 0.194258615f},
-std::array<float,2>{0.224214897f, 0.706951976f},
-std::array<float,2>{0.50186497f, 0.917228281f},
-std::array<float,2>{0.487923682f, 0.444685459f},
-std::array<float,2>{0.586239696f, 0.0797936916f},
-std::array<float,2>{0.381210893f, 0.530522346f},
-std::array<float,2>{0.900978982f, 0.861480236f},
-std::array<float,2>{0.17274338f, 0.356343716f},
-std::array<float,2>{0.873778999f, 0.375934273f},
-std::array<float,2>{0.0831817687f, 0.993424833f},
-std::array<float,2>{0.685393214f, 0.63015306f},
-std::array<float,2>{0.344354361f, 0.154233888f},
-std::array<float,2>{0.660654902f, 0.423909783f},
-std::array<float,2>{0.368069619f, 0.955101609f},
-std::array<float,2>{0.845123231f, 0.682336271f},
-std::array<float,2>{0.0699300915f, 0.166451842f},
-std::array<float,2>{0.887208402f, 0.101952255f},
-std::array<float,2>{0.162588507f, 0.560621619f},
-std::array<float,2>{0.56379509f, 0.815470815f},
-std::array<float,2>{0.398814112f, 0.330792338f},
-std::array<float,2>{0.516807318f, 0.235852823f},
-std::array<float,2>{0.473391205f, 0.722475946f},
-std::array<float,2>{0.999366283f, 0.882307589f},
-std::array<float,2>{0.235007778f, 0.498119414f},
-std::array<float,2>{0.792338967f, 0.28409031f},
-std::array<float,2>{0.0623298772f, 0.78840673f},
-std::array<float,2>{0.701819777f, 0.600491643f},
-std::array<float,2>{0.303391844f, 0.025837658f},
-std::array<float,2>{0.612223387f, 0.360579729f},
-std::array<float,2>{0.433729649f, 0.848752201f},
-std::array<float,2>{0.909267843f, 0.514835715f},
-std::array<float,2>{0.142243207f, 0.0751908347f},
-std::array<float,2>{0.837376595f, 0.134448752f},
-std::array<float,2>{0.113131367f, 0.649803221f},
-std::array<float,2>{0.631934464f, 0.984178722f},
-std::array<float,2>{0.320994943f, 0.394082606f},
-std::array<float,2>{0.742037594f, 0.0506629385f},
-std::array<float,2>{0.251643032f, 0.566135228f},
-std::array<float,2>{0.753211617f, 0.765700817f},
-std::array<float,2>{0.00552846072f, 0.257762879f},
-std::array<float,2>{0.964678586f, 0.467156082f},
-std::array<float,2>{0.212627649f, 0.925192237f},
-std::array<float,2>{0.55375725f, 0.697833836f},
-std::array<float,2>{0.454881281f, 0.217683971f},
-std::array<float,2>{0.571766257f, 0.398803234f},
-std::array<float,2>{0.391135395f, 0.973639965f},
-std::array<float,2>{0.875018239f, 0.647070944f},
-std::array<float,2>{0.166158706f, 0.128870025f},
-std::array<float,2>{0.852867901f, 0.0692238361f},
-std::array<float,2>{0.0723265484f, 0.50039959f},
-std::array<float,2>{0.670325756f, 0.853745461f},
-std::array<float,2>{0.360194206f, 0.37182501f},
-std::array<float,2>{0.691379607f, 0.210238859f},
-std::array<float,2>{0.3064197f, 0.69054383f},
-std::array<float,2>{0.783328712f, 0.934929907f},
-std::array<float,2>{0.0493027717f, 0.45535475f},
-std::array<float,2>{0.989230514f, 0.259874076f},
-std::array<float,2>{0.247989416f, 0.778323948f},
-std::array<float,2>{0.527642369f, 0.570737839f},
-std::array<float,2>{0.481771916f, 0.056461554f},
-std::array<float,2>{0.633216202f, 0.341867387f},
-std::array<float,2>{0.316694051f, 0.826771557f},
-std::array<float,2>{0.832633972f, 0.550306797f},
-std::array<float,2>{0.123068228f, 0.100905478f},
-std::array<float,2>{0.916716278f, 0.160968661f},
-std::array<float,2>{0.155165195f, 0.674994528f},
-std::array<float,2>{0.62073946f, 0.967635393f},
-std::array<float,2>{0.422014505f, 0.4363949f},
-std::array<float,2>{0.557973623f, 0.0180507787f},
-std::array<float,2>{0.463150024f, 0.603670597f},
-std::array<float,2>{0.956333995f, 0.791612923f},
-std::array<float,2>{0.20997481f, 0.293964684f},
-std::array<float,2>{0.760943234f, 0.488166749f},
-std::array<float,2>{0.0128284637f, 0.88669771f},
-std::array<float,2>{0.744125485f, 0.732369125f},
-std::array<float,2>{0.262478828f, 0.243020028f},
-std::array<float,2>{0.722058475f, 0.448200971f},
-std::array<float,2>{0.275783807f, 0.909460068f},
-std::array<float,2>{0.777395368f, 0.71172297f},
-std::array<float,2>{0.0290824324f, 0.201104954f},
-std::array<float,2>{0.939092636f, 0.0339003503f},
-std::array<float,2>{0.193157673f, 0.580451369f},
-std::array<float,2>{0.54232198f, 0.751895785f},
-std::array<float,2>{0.442234159f, 0.274077147f},
-std::array<float,2>{0.60147506f, 0.140773594f},
-std::array<float,2>{0.412806213f, 0.638193488f},
-std::array<float,2>{0.922449887f, 0.989686608f},
-std::array<float,2>{0.128685221f, 0.383226484f},
-std::array<float,2>{0.827376664f, 0.348944247f},
-std::array<float,2>{0.0996932909f, 0.873750031f},
-std::array<float,2>{0.641598165f, 0.520865202f},
-std::array<float,2>{0.334708184f, 0.0901322961f},
-std::array<float,2>{0.510681808f, 0.306715041f},
-std::array<float,2>{0.497945726f, 0.802719176f},
-std::array<float,2>{0.979709208f, 0.622078896f},
-std::array<float,2>{0.227657825f, 0.0138947293f},
-std::array<float,2>{0.807282448f, 0.225529492f},
-std::array<float,2>{0.0358804204f, 0.742946386f},
-std::array<float,2>{0.703271806f, 0.899102867f},
-std::array<float,2>{0.294304788f, 0.470745593f},
-std::array<float,2>{0.675327659f, 0.111702472f},
-std::array<float,2>{0.355377495f, 0.545367002f},
-std::array<float,2>{0.863636017f, 0.829383671f},
-std::array<float,2>{0.08641579f, 0.325421304f},
-std::array<float,2>{0.894069314f, 0.416958928f},
-std::array<float,2>{0.182130143f, 0.93754828f},
-std::array<float,2>{0.582607031f, 0.663862288f},
-std::array<float,2>{0.389386386f, 0.175604358f},
-std::array<float,2>{0.60460043f, 0.460499138f},
-std::array<float,2>{0.420450419f, 0.930625618f},
-std::array<float,2>{0.932469428f, 0.692866862f},
-std::array<float,2>{0.137585074f, 0.204674512f},
-std::array<float,2>{0.814355314f, 0.0616318211f},
-std::array<float,2>{0.102875337f, 0.578104138f},
-std::array<float,2>{0.654282749f, 0.776246846f},
-std::array<float,2>{0.343748063f, 0.263065249f},
-std::array<float,2>{0.731600881f, 0.131300688f},
-std::array<float,2>{0.265749007f, 0.644441068f},
-std::array<float,2>{0.766841292f, 0.972184479f},
-std::array<float,2>{0.0221687257f, 0.404620141f},
-std::array<float,2>{0.9511531f, 0.369076699f},
-std::array<float,2>{0.198270231f, 0.85800904f},
-std::array<float,2>{0.534590721f, 0.504255176f},
-std::array<float,2>{0.449959815f, 0.0648764223f},
-std::array<float,2>{0.680301964f, 0.290165573f},
-std::array<float,2>{0.349389046f, 0.796359897f},
-std::array<float,2>{0.868936121f, 0.609151542f},
-std::array<float,2>{0.0796362236f, 0.0232244302f},
-std::array<float,2>{0.905385435f, 0.246797979f},
-std::array<float,2>{0.179082066f, 0.729036868f},
-std::array<float,2>{0.593004405f, 0.889294207f},
-std::array<float,2>{0.375201404f, 0.490977854f},
-std::array<float,2>{0.504342258f, 0.095400691f},
-std::array<float,2>{0.489169955f, 0.553635359f},
-std::array<float,2>{0.976204932f, 0.820711792f},
-std::array<float,2>{0.219025925f, 0.33653146f},
-std::array<float,2>{0.801748276f, 0.43130669f},
-std::array<float,2>{0.0406338684f, 0.962347746f},
-std::array<float,2>{0.714700758f, 0.67702508f},
-std::array<float,2>{0.287311137f, 0.160016119f},
-std::array<float,2>{0.696883798f, 0.388718873f},
-std::array<float,2>{0.299603134f, 0.985167086f},
-std::array<float,2>{0.796599686f, 0.635963798f},
-std::array<float,2>{0.0567282364f, 0.145728439f},
-std::array<float,2>{0.994517028f, 0.0892815292f},
-std::array<float,2>{0.240859434f, 0.518651068f},
-std::array<float,2>{0.519947827f, 0.87092346f},
-std::array<float,2>{0.469915241f, 0.345813572f},
-std::array<float,2>{0.566525877f, 0.198427647f},
-std::array<float,2>{0.405066371f, 0.717365205f},
-std::array<float,2>{0.886248291f, 0.910193145f},
-std::array<float,2>{0.156766891f, 0.451640457f},
-std::array<float,2>{0.850213051f, 0.277907223f},
-std::array<float,2>{0.065907754f, 0.755108953f},
-std::array<float,2>{0.657724679f, 0.583428025f},
-std::array<float,2>{0.374319017f, 0.0373581685f},
-std::array<float,2>{0.547743499f, 0.323688596f},
-std::array<float,2>{0.460367888f, 0.835571408f},
-std::array<float,2>{0.966533005f, 0.541218936f},
-std::array<float,2>{0.216101632f, 0.113328755f},
-std::array<float,2>{0.757174492f, 0.178362161f},
-std::array<float,2>{0.00204482139f, 0.657449424f},
-std::array<float,2>{0.736967623f, 0.942754865f},
-std::array<float,2>{0.256647408f, 0.419519395f},
-std::array<float,2>{0.627492726f, 0.0105712023f},
-std::array<float,2>{0.327135026f, 0.617475569f},
-std::array<float,2>{0.840468466f, 0.797983825f},
-std::array<float,2>{0.117110997f, 0.310168177f},
-std::array<float,2>{0.910805762f, 0.473039895f},
-std::array<float,2>{0.146105677f, 0.903528214f},
-std::array<float,2>{0.61361599f, 0.748095453f},
-std::array<float,2>{0.431701213f, 0.221739277f},
-std::array<float,2>{0.526311278f, 0.406937122f},
-std::array<float,2>{0.478199482f, 0.948348939f},
-std::array<float,2>{0.985668838f, 0.667068541f},
-std::array<float,2>{0.242321134f, 0.180020362f},
-std::array<float,2>{0.786794424f, 0.123423725f},
-std::array<float,2>{0.0524281375f, 0.536932409f},
-std::array<float,2>{0.691507638f, 0.836093664f},
-std::array<float,2>{0.311234176f, 0.314355075f},
-std::array<float,2>{0.666537642f, 0.230330065f},
-std::array<float,2>{0.364012927f, 0.740068913f},
-std::array<float,2>{0.856346965f, 0.890759349f},
-std::array<float,2>{0.0757373795f, 0.478304744f},
-std::array<float,2>{0.879962504f, 0.299850941f},
-std::array<float,2>{0.170592502f, 0.811511636f},
-std::array<float,2>{0.577723384f, 0.61440897f},
-std::array<float,2>{0.39651221f, 0.0023564829f},
-std::array<float,2>{0.748684108f, 0.3522048f},
-std::array<float,2>{0.259772509f, 0.864989102f},
-std::array<float,2>{0.761905372f, 0.527161062f},
-std::array<float,2>{0.010059976f, 0.0836311504f},
-std::array<float,2>{0.958842337f, 0.150384083f},
-std::array<float,2>{0.206595361f, 0.628185928f},
-std::array<float,2>{0.558878422f, 0.997769713f},
-std::array<float,2>{0.467902392f, 0.379830986f},
-std::array<float,2>{0.62233144f, 0.0452259108f},
-std::array<float,2>{0.428815544f, 0.590052009f},
-std::array<float,2>{0.921221554f, 0.761906326f},
-std::array<float,2>{0.150743872f, 0.271310091f},
-std::array<float,2>{0.831437469f, 0.439021736f},
-std::array<float,2>{0.119030662f, 0.920580626f},
-std::array<float,2>{0.638225138f, 0.708986402f},
-std::array<float,2>{0.313127846f, 0.188532799f},
-std::array<float,2>{0.645082414f, 0.495334625f},
-std::array<float,2>{0.330701649f, 0.878367364f},
-std::array<float,2>{0.823124528f, 0.723229289f},
-std::array<float,2>{0.0966911092f, 0.240878254f},
-std::array<float,2>{0.928621173f, 0.0295970198f},
-std::array<float,2>{0.130710155f, 0.594823003f},
-std::array<float,2>{0.593766451f, 0.782227337f},
-std::array<float,2>{0.409023881f, 0.288171947f},
-std::array<float,2>{0.544241726f, 0.169313028f},
-std::array<float,2>{0.438911915f, 0.684028208f},
-std::array<float,2>{0.945014536f, 0.960849583f},
-std::array<float,2>{0.187854767f, 0.428364366f},
-std::array<float,2>{0.777194083f, 0.332112998f},
-std::array<float,2>{0.0258620437f, 0.816982448f},
-std::array<float,2>{0.723314345f, 0.558358073f},
-std::array<float,2>{0.280692309f, 0.107762069f},
-std::array<float,2>{0.580985367f, 0.252954453f},
-std::array<float,2>{0.386391282f, 0.770822644f},
-std::array<float,2>{0.897381842f, 0.567080379f},
-std::array<float,2>{0.186389714f, 0.053430073f},
-std::array<float,2>{0.861762404f, 0.21151267f},
-std::array<float,2>{0.0928859189f, 0.701384425f},
-std::array<float,2>{0.676472604f, 0.927726805f},
-std::array<float,2>{0.356384575f, 0.46455875f},
-std::array<float,2>{0.709611714f, 0.0707743317f},
-std::array<float,2>{0.28931883f, 0.508410752f},
-std::array<float,2>{0.809226632f, 0.846736193f},
-std::array<float,2>{0.0335105211f, 0.363863081f},
-std::array<float,2>{0.981501162f, 0.396955043f},
-std::array<float,2>{0.232582435f, 0.978395164f},
-std::array<float,2>{0.512470186f, 0.654586434f},
-std::array<float,2>{0.495172054f, 0.13867338f},
-std::array<float,2>{0.502436101f, 0.441872597f},
-std::array<float,2>{0.484562516f, 0.9154073f},
-std::array<float,2>{0.972406685f, 0.703430414f},
-std::array<float,2>{0.226495102f, 0.192503929f},
-std::array<float,2>{0.800396144f, 0.0407513529f},
-std::array<float,2>{0.0443270393f, 0.588907778f},
-std::array<float,2>{0.717378139f, 0.758887827f},
-std::array<float,2>{0.284325451f, 0.267130136f},
-std::array<float,2>{0.687168121f, 0.155107051f},
-std::array<float,2>{0.347495437f, 0.630909026f},
-std::array<float,2>{0.872795045f, 0.995486081f},
-std::array<float,2>{0.0843320563f, 0.377904922f},
-std::array<float,2>{0.899447978f, 0.358541101f},
-std::array<float,2>{0.174508795f, 0.859594762f},
-std::array<float,2>{0.589125752f, 0.528313041f},
-std::array<float,2>{0.379735649f, 0.0806740224f},
-std::array<float,2>{0.730151892f, 0.304465353f},
-std::array<float,2>{0.273297846f, 0.806501091f},
-std::array<float,2>{0.771998525f, 0.612815022f},
-std::array<float,2>{0.0189036336f, 0.0067805252f},
-std::array<float,2>{0.947743833f, 0.23434338f},
-std::array<float,2>{0.20093663f, 0.735063672f},
-std::array<float,2>{0.538859427f, 0.895042181f},
-std::array<float,2>{0.448706478f, 0.483491063f},
-std::array<float,2>{0.606532693f, 0.1191632f},
-std::array<float,2>{0.414534271f, 0.534444392f},
-std::array<float,2>{0.934030592f, 0.842819095f},
-std::array<float,2>{0.134775743f, 0.317524046f},
-std::array<float,2>{0.819971502f, 0.412795633f},
-std::array<float,2>{0.106111303f, 0.950561404f},
-std::array<float,2>{0.648553193f, 0.66930294f},
-std::array<float,2>{0.336741984f, 0.185283676f},
-std::array<float,2>{0.629687488f, 0.391509831f},
-std::array<float,2>{0.322575986f, 0.980661571f},
-std::array<float,2>{0.838948488f, 0.651963949f},
-std::array<float,2>{0.110171027f, 0.136528552f},
-std::array<float,2>{0.907933116f, 0.0778708532f},
-std::array<float,2>{0.143075719f, 0.51172483f},
-std::array<float,2>{0.611098826f, 0.85005337f},
-std::array<float,2>{0.437232345f, 0.36298418f},
-std::array<float,2>{0.552072883f, 0.215838701f},
-std::array<float,2>{0.455302f, 0.69714421f},
-std::array<float,2>{0.961496651f, 0.923308969f},
-std::array<float,2>{0.214204654f, 0.466754138f},
-std::array<float,2>{0.751084864f, 0.254720122f},
-std::array<float,2>{0.00614322023f, 0.768886507f},
-std::array<float,2>{0.739625156f, 0.563414752f},
-std::array<float,2>{0.253122479f, 0.0486290343f},
-std::array<float,2>{0.566306472f, 0.32967943f},
-std::array<float,2>{0.400531173f, 0.812827528f},
-std::array<float,2>{0.889953852f, 0.559730828f},
-std::array<float,2>{0.161853105f, 0.104379386f},
-std::array<float,2>{0.846175075f, 0.16551508f},
-std::array<float,2>{0.0678606853f, 0.680375695f},
-std::array<float,2>{0.663680673f, 0.953203857f},
-std::array<float,2>{0.370024681f, 0.421965808f},
-std::array<float,2>{0.700403571f, 0.0236584451f},
-std::array<float,2>{0.300936729f, 0.597900033f},
-std::array<float,2>{0.78917712f, 0.786589086f},
-std::array<float,2>{0.0599471331f, 0.281338036f},
-std::array<float,2>{0.997283936f, 0.497386247f},
-std::array<float,2>{0.237788215f, 0.879837751f},
-std::array<float,2>{0.518613815f, 0.719967306f},
-std::array<float,2>{0.474948436f, 0.237835005f},
-std::array<float,2>{0.61780107f, 0.43510437f},
-std::array<float,2>{0.423887938f, 0.96595633f},
-std::array<float,2>{0.91446799f, 0.673199534f},
-std::array<float,2>{0.152981505f, 0.163073987f},
-std::array<float,2>{0.835101128f, 0.0993835479f},
-std::array<float,2>{0.122891143f, 0.547416329f},
-std::array<float,2>{0.635614693f, 0.82581991f},
-std::array<float,2>{0.319537669f, 0.340461016f},
-std::array<float,2>{0.745058954f, 0.245706946f},
-std::array<float,2>{0.265227169f, 0.733621836f},
-std::array<float,2>{0.759761512f, 0.883556426f},
-std::array<float,2>{0.0137079954f, 0.485429972f},
-std::array<float,2>{0.954631031f, 0.295329928f},
-std::array<float,2>{0.208029807f, 0.78997004f},
-std::array<float,2>{0.555592299f, 0.603234351f},
-std::array<float,2>{0.461329252f, 0.0168750733f},
-std::array<float,2>{0.668371141f, 0.374673694f},
-std::array<float,2>{0.362812787f, 0.853410959f},
-std::array<float,2>{0.855266929f, 0.502619684f},
-std::array<float,2>{0.0719157308f, 0.0674464107f},
-std::array<float,2>{0.877803624f, 0.126630083f},
-std::array<float,2>{0.164459646f, 0.646407127f},
-std::array<float,2>{0.572578669f, 0.975906551f},
-std::array<float,2>{0.393463254f, 0.401939481f},
-std::array<float,2>{0.530347049f, 0.0573224165f},
-std::array<float,2>{0.482550353f, 0.574059129f},
-std::array<float,2>{0.991559267f, 0.77947849f},
-std::array<float,2>{0.249143332f, 0.258333892f},
-std::array<float,2>{0.782318056f, 0.454264313f},
-std::array<float,2>{0.0483532064f, 0.936492205f},
-std::array<float,2>{0.688560009f, 0.688889742f},
-std::array<float,2>{0.308427989f, 0.208434567f},
-std::array<float,2>{0.705855489f, 0.469561964f},
-std::array<float,2>{0.295633495f, 0.902261078f},
-std::array<float,2>{0.806261837f, 0.745309949f},
-std::array<float,2>{0.0372092649f, 0.223090291f},
-std::array<float,2>{0.977485836f, 0.0122659942f},
-std::array<float,2>{0.228846297f, 0.624777853f},
-std::array<float,2>{0.50913465f, 0.803987145f},
-std::array<float,2>{0.498067677f, 0.304723382f},
-std::array<float,2>{0.584921658f, 0.172038183f},
-std::array<float,2>{0.388160944f, 0.661461771f},
-std::array<float,2>{0.891951084f, 0.93985033f},
-std::array<float,2>{0.180558428f, 0.415815145f},
-std::array<float,2>{0.866657853f, 0.326720089f},
-std::array<float,2>{0.0894528478f, 0.831517577f},
-std::array<float,2>{0.672325015f, 0.544406116f},
-std::array<float,2>{0.353354663f, 0.10946019f},
-std::array<float,2>{0.539262116f, 0.276025385f},
-std::array<float,2>{0.444232643f, 0.75282079f},
-std::array<float,2>{0.939752817f, 0.578502536f},
-std::array<float,2>{0.194364652f, 0.0322192796f},
-std::array<float,2>{0.779357076f, 0.201189369f},
-std::array<float,2>{0.0300084818f, 0.7131567f},
-std::array<float,2>{0.718820453f, 0.907739818f},
-std::array<float,2>{0.27447924f, 0.446410954f},
-std::array<float,2>{0.64293021f, 0.0919186324f},
-std::array<float,2>{0.333115697f, 0.523260236f},
-std::array<float,2>{0.824710369f, 0.871710837f},
-std::array<float,2>{0.0992389098f, 0.350316823f},
-std::array<float,2>{0.925070465f, 0.385043114f},
-std::array<float,2>{0.125607356f, 0.990447998f},
-std::array<float,2>{0.598912656f, 0.639599264f},
-std::array<float,2>{0.41052106f, 0.144064039f},
-std::array<float,2>{0.590235889f, 0.489377141f},
-std::array<float,2>{0.378825396f, 0.887541771f},
-std::array<float,2>{0.903560579f, 0.726855516f},
-std::array<float,2>{0.176217243f, 0.249601081f},
-std::array<float,2>{0.87068516f, 0.0198552627f},
-std::array<float,2>{0.0809936449f, 0.605960488f},
-std::array<float,2>{0.681758463f, 0.793907762f},
-std::array<float,2>{0.350090951f, 0.291904777f},
-std::array<float,2>{0.711273074f, 0.156554386f},
-std::array<float,2>{0.286189944f, 0.67939657f},
-std::array<float,2>{0.804484785f, 0.963804305f},
-std::array<float,2>{0.0421906896f, 0.432736605f},
-std::array<float,2>{0.972937167f, 0.338834494f},
-std::array<float,2>{0.221097514f, 0.822777927f},
-std::array<float,2>{0.507317126f, 0.551665783f},
-std::array<float,2>{0.490329027f, 0.0970849469f},
-std::array<float,2>{0.655640602f, 0.265015721f},
-std::array<float,2>{0.340485722f, 0.775357187f},
-std::array<float,2>{0.815314829f, 0.57429415f},
-std::array<float,2>{0.104846634f, 0.0604412891f},
-std::array<float,2>{0.930088639f, 0.206766516f},
-std::array<float,2>{0.139547601f, 0.69514513f},
-std::array<float,2>{0.602234304f, 0.932598948f},
-std::array<float,2>{0.419349492f, 0.458054096f},
-std::array<float,2>{0.532715142f, 0.0635691211f},
-std::array<float,2>{0.452488452f, 0.506927669f},
-std::array<float,2>{0.952496111f, 0.856567919f},
-std::array<float,2>{0.195876211f, 0.370942801f},
-std::array<float,2>{0.76843071f, 0.403663963f},
-std::array<float,2>{0.0201566853f, 0.969507039f},
-std::array<float,2>{0.733366907f, 0.641349077f},
-std::array<float,2>{0.268246323f, 0.129509479f},
-std::array<float,2>{0.735799909f, 0.421186715f},
-std::array<float,2>{0.255072087f, 0.944433987f},
-std::array<float,2>{0.755780101f, 0.65869844f},
-std::array<float,2>{0.00191595301f, 0.175997406f},
-std::array<float,2>{0.968090057f, 0.116097994f},
-std::array<float,2>{0.217590511f, 0.540408313f},
-std::array<float,2>{0.549252629f, 0.833663583f},
-std::array<float,2>{0.458693355f, 0.320915282f},
-std::array<float,2>{0.61704886f, 0.21894756f},
-std::array<float,2>{0.431396693f, 0.747551978f},
-std::array<float,2>{0.913809776f, 0.905116439f},
-std::array<float,2>{0.148225412f, 0.476245075f},
-std::array<float,2>{0.841860056f, 0.312047422f},
-std::array<float,2>{0.114993088f, 0.799266458f},
-std::array<float,2>{0.625423312f, 0.619751692f},
-std::array<float,2>{0.325222701f, 0.00844175927f},
-std::array<float,2>{0.523401141f, 0.344547123f},
-std::array<float,2>{0.471251488f, 0.868803084f},
-std::array<float,2>{0.992706418f, 0.517148197f},
-std::array<float,2>{0.238412008f, 0.0871188268f},
-std::array<float,2>{0.794595182f, 0.147944763f},
-std::array<float,2>{0.0557891726f, 0.633438587f},
-std::array<float,2>{0.697818875f, 0.987837434f},
-std::array<float,2>{0.297671437f, 0.388367891f},
-std::array<float,2>{0.658855855f, 0.0353929289f},
-std::array<float,2>{0.371518314f, 0.584623933f},
-std::array<float,2>{0.849000096f, 0.757167816f},
-std::array<float,2>{0.0632562637f, 0.279886127f},
-std::array<float,2>{0.883144081f, 0.449922442f},
-std::array<float,2>{0.159067854f, 0.91367346f},
-std::array<float,2>{0.569995582f, 0.716248631f},
-std::array<float,2>{0.404001802f, 0.19603008f},
-std::array<float,2>{0.561400473f, 0.381675661f},
-std::array<float,2>{0.46633032f, 0.998450637f},
-std::array<float,2>{0.960844159f, 0.62563467f},
-std::array<float,2>{0.205076396f, 0.152202174f},
-std::array<float,2>{0.76446718f, 0.0849337205f},
-std::array<float,2>{0.00974568725f, 0.523688376f},
-std::array<float,2>{0.746754348f, 0.865622401f},
-std::array<float,2>{0.257832348f, 0.35542056f},
-std::array<float,2>{0.639523208f, 0.190278873f},
-std::array<float,2>{0.316247672f, 0.707103133f},
-std::array<float,2>{0.828198016f, 0.91896981f},
-std::array<float,2>{0.119771861f, 0.4404172f},
-std::array<float,2>{0.918114483f, 0.272594422f},
-std::array<float,2>{0.150023177f, 0.765452743f},
-std::array<float,2>{0.623608589f, 0.591821849f},
-std::array<float,2>{0.427394778f, 0.0438711941f},
-std::array<float,2>{0.694589376f, 0.315223783f},
-std::array<float,2>{0.308664143f, 0.838577569f},
-std::array<float,2>{0.788954794f, 0.538352489f},
-std::array<float,2>{0.0540299341f, 0.121435799f},
-std::array<float,2>{0.987819493f, 0.181738868f},
-std::array<float,2>{0.244420663f, 0.665374279f},
-std::array<float,2>{0.523671329f, 0.945433676f},
-std::array<float,2>{0.479512542f, 0.408373415f},
-std::array<float,2>{0.575974405f, 0.00158158969f},
-std::array<float,2>{0.395796806f, 0.616883099f},
-std::array<float,2>{0.882423222f, 0.808677197f},
-std::array<float,2>{0.169752538f, 0.297908962f},
-std::array<float,2>{0.858043671f, 0.478986233f},
-std::array<float,2>{0.0767419487f, 0.893233895f},
-std::array<float,2>{0.665265083f, 0.741990447f},
-std::array<float,2>{0.365637124f, 0.226642817f},
-std::array<float,2>{0.678703427f, 0.461549908f},
-std::array<float,2>{0.359242946f, 0.928548276f},
-std::array<float,2>{0.860461652f, 0.701060414f},
-std::array<float,2>{0.0901282579f, 0.213136658f},
-std::array<float,2>{0.8958413f, 0.0519013554f},
-std::array<float,2>{0.185152933f, 0.568854332f},
-std::array<float,2>{0.579172909f, 0.773215711f},
-std::array<float,2>{0.38346076f, 0.250831813f},
-std::array<float,2>{0.515129149f, 0.138514102f},
-std::array<float,2>{0.492273092f, 0.652448773f},
-std::array<float,2>{0.98413229f, 0.980273187f},
-std::array<float,2>{0.231067777f, 0.395909011f},
-std::array<float,2>{0.811199129f, 0.365878791f},
-std::array<float,2>{0.0325053446f, 0.844290137f},
-std::array<float,2>{0.708583295f, 0.510282278f},
-std::array<float,2>{0.292558074f, 0.0726147443f},
-std::array<float,2>{0.597023368f, 0.285720706f},
-std::array<float,2>{0.407096267f, 0.784780622f},
-std::array<float,2>{0.926791549f, 0.596963346f},
-std::array<float,2>{0.131920546f, 0.0276967771f},
-std::array<float,2>{0.822048128f, 0.238374934f},
-std::array<float,2>{0.0946787521f, 0.725180089f},
-std::array<float,2>{0.647001028f, 0.876659334f},
-std::array<float,2>{0.328318149f, 0.49247095f},
-std::array<float,2>{0.72616905f, 0.105828695f},
-std::array<float,2>{0.279030353f, 0.556243718f},
-std::array<float,2>{0.773619235f, 0.820162535f},
-std::array<float,2>{0.0238826741f, 0.3348068f},
-std::array<float,2>{0.942162275f, 0.426295638f},
-std::array<float,2>{0.190878347f, 0.958439469f},
-std::array<float,2>{0.545511961f, 0.686166644f},
-std::array<float,2>{0.44129464f, 0.170403317f},
-std::array<float,2>{0.5176934f, 0.499249965f},
-std::array<float,2>{0.475982159f, 0.881062984f},
-std::array<float,2>{0.996948659f, 0.721647859f},
-std::array<float,2>{0.237216368f, 0.234409228f},
-std::array<float,2>{0.790757179f, 0.0272017028f},
-std::array<float,2>{0.0592683107f, 0.601116538f},
-std::array<float,2>{0.699797273f, 0.787691474f},
-std::array<float,2>{0.302041858f, 0.284235507f},
-std::array<float,2>{0.662299216f, 0.167135656f},
-std::array<float,2>{0.370603502f, 0.68308413f},
-std::array<float,2>{0.846796036f, 0.956559956f},
-std::array<float,2>{0.0671056136f, 0.425548583f},
-std::array<float,2>{0.889231384f, 0.331252903f},
-std::array<float,2>{0.160467446f, 0.815353096f},
-std::array<float,2>{0.564617038f, 0.562480211f},
-std::array<float,2>{0.401385635f, 0.103137657f},
-std::array<float,2>{0.738413036f, 0.256092161f},
-std::array<float,2>{0.252633363f, 0.767297089f},
-std::array<float,2>{0.750180662f, 0.564729691f},
-std::array<float,2>{0.00690561533f, 0.0497333966f},
-std::array<float,2>{0.962294579f, 0.217793345f},
-std::array<float,2>{0.213367879f, 0.698565245f},
-std::array<float,2>{0.551739335f, 0.9242661f},
-std::array<float,2>{0.456463248f, 0.467894256f},
-std::array<float,2>{0.609586179f, 0.075879626f},
-std::array<float,2>{0.435997725f, 0.513926446f},
-std::array<float,2>{0.906479955f, 0.847855031f},
-std::array<float,2>{0.143950239f, 0.359872758f},
-std::array<float,2>{0.837909043f, 0.3930282f},
-std::array<float,2>{0.110821784f, 0.983196795f},
-std::array<float,2>{0.629927516f, 0.648830593f},
-std::array<float,2>{0.324197352f, 0.133447662f},
-std::array<float,2>{0.649558902f, 0.412090153f},
-std::array<float,2>{0.337032497f, 0.951265752f},
-std::array<float,2>{0.81931752f, 0.671862125f},
-std::array<float,2>{0.106873669f, 0.185558945f},
-std::array<float,2>{0.934789598f, 0.117794156f},
-std::array<float,2>{0.136703357f, 0.531755865f},
-std::array<float,2>{0.606158853f, 0.841571331f},
-std::array<float,2>{0.415219188f, 0.318401366f},
-std::array<float,2>{0.537247002f, 0.231635258f},
-std::array<float,2>{0.448235214f, 0.736358047f},
-std::array<float,2>{0.948512852f, 0.897155702f},
-std::array<float,2>{0.199582011f, 0.480591267f},
-std::array<float,2>{0.773036063f, 0.30257985f},
-std::array<float,2>{0.018530678f, 0.807976961f},
-std::array<float,2>{0.729101539f, 0.609593689f},
-std::array<float,2>{0.271609068f, 0.00564694917f},
-std::array<float,2>{0.58872062f, 0.357018739f},
-std::array<float,2>{0.380115807f, 0.862839878f},
-std::array<float,2>{0.898904145f, 0.529569507f},
-std::array<float,2>{0.175660998f, 0.0782714337f},
-std::array<float,2>{0.871143758f, 0.15272589f},
-std::array<float,2>{0.0854691118f, 0.629454851f},
-std::array<float,2>{0.685772777f, 0.993139207f},
-std::array<float,2>{0.346397519f, 0.376122892f},
-std::array<float,2>{0.718563139f, 0.0411025248f},
-std::array<float,2>{0.283229142f, 0.586597741f},
-std::array<float,2>{0.799356282f, 0.759962857f},
-std::array<float,2>{0.0437302627f, 0.268380672f},
-std::array<float,2>{0.970804334f, 0.443491518f},
-std::array<float,2>{0.22497116f, 0.916602373f},
-std::array<float,2>{0.503503144f, 0.705176055f},
-std::array<float,2>{0.48580721f, 0.195010439f},
-std::array<float,2>{0.597785652f, 0.384240806f},
-std::array<float,2>{0.411878228f, 0.988779783f},
-std::array<float,2>{0.924509823f, 0.636987865f},
-std::array<float,2>{0.126138002f, 0.141633883f},
-std::array<float,2>{0.825645864f, 0.0911135525f},
-std::array<float,2>{0.0985222757f, 0.520078123f},
-std::array<float,2>{0.643609285f, 0.874772131f},
-std::array<float,2>{0.332994282f, 0.34863025f},
-std::array<float,2>{0.720002055f, 0.199589297f},
-std::array<float,2>{0.274333566f, 0.711950302f},
-std::array<float,2>{0.780595481f, 0.909149051f},
-std::array<float,2>{0.0311333425f, 0.448308736f},
-std::array<float,2>{0.941369176f, 0.274683505f},
-std::array<float,2>{0.193477288f, 0.750223577f},
-std::array<float,2>{0.540342748f, 0.581173897f},
-std::array<float,2>{0.445260912f, 0.0348268263f},
-std::array<float,2>{0.673492134f, 0.325108558f},
-std::array<float,2>{0.351775587f, 0.828453541f},
-std::array<float,2>{0.8653f, 0.546081007f},
-std::array<float,2>{0.0882458985f, 0.112542838f},
-std::array<float,2>{0.891485572f, 0.17392984f},
-std::array<float,2>{0.180873483f, 0.663046777f},
-std::array<float,2>{0.585119426f, 0.938566744f},
-std::array<float,2>{0.387154728f, 0.417681158f},
-std::array<float,2>{0.508725941f, 0.0148851844f},
-std::array<float,2>{0.499291956f, 0.621477246f},
-std::array<float,2>{0.978333235f, 0.801757097f},
-std::array<float,2>{0.230088994f, 0.308104724f},
-std::array<float,2>{0.805517673f, 0.471693456f},
-std::array<float,2>{0.0383114628f, 0.899940729f},
-std::array<float,2>{0.706212282f, 0.743528247f},
-std::array<float,2>{0.296212137f, 0.226346955f},
-std::array<float,2>{0.68765384f, 0.456608355f},
-std::array<float,2>{0.30738306f, 0.933744252f},
-std::array<float,2>{0.782216907f, 0.689647675f},
-std::array<float,2>{0.0473395623f, 0.209420905f},
-std::array<float,2>{0.990351915f, 0.0555219017f},
-std::array<float,2>{0.248085901f, 0.572197616f},
-std::array<float,2>{0.529706478f, 0.777413905f},
-std::array<float,2>{0.484002233f, 0.261173576f},
-std::array<float,2>{0.573422313f, 0.1272856f},
-std::array<float,2>{0.393663645f, 0.647628069f},
-std::array<float,2>{0.878887236f, 0.972821653f},
-std::array<float,2>{0.165365413f, 0.399852365f},
-std::array<float,2>{0.853646934f, 0.372092962f},
-std::array<float,2>{0.0708592385f, 0.85474205f},
-std::array<float,2>{0.669891655f, 0.50183481f},
-std::array<float,2>{0.362144232f, 0.0699192509f},
-std::array<float,2>{0.556053758f, 0.293433696f},
-std::array<float,2>{0.462054968f, 0.792389572f},
-std::array<float,2>{0.953992903f, 0.604905188f},
-std::array<float,2>{0.207888842f, 0.0190271568f},
-std::array<float,2>{0.758355319f, 0.243447989f},
-std::array<float,2>{0.0153380502f, 0.731382906f},
-std::array<float,2>{0.745990098f, 0.885048211f},
-std::array<float,2>{0.263878822f, 0.486732185f},
-std::array<float,2>{0.636601865f, 0.0998537615f},
-std::array<float,2>{0.319300711f, 0.548897088f},
-std::array<float,2>{0.834841847f, 0.827889144f},
-std::array<float,2>{0.121642046f, 0.343158603f},
-std::array<float,2>{0.915244281f, 0.436529666f},
-std::array<float,2>{0.153440341f, 0.967836618f},
-std::array<float,2>{0.618165851f, 0.67452997f},
-std::array<float,2>{0.425130904f, 0.161968872f},
-std::array<float,2>{0.569206417f, 0.452752441f},
-std::array<float,2>{0.402599901f, 0.911851704f},
-std::array<float,2>{0.884312332f, 0.718104362f},
-std::array<float,2>{0.159670621f, 0.197796926f},
-std::array<float,2>{0.848601639f, 0.0384234972f},
-std::array<float,2>{0.0642355978f, 0.582033336f},
-std::array<float,2>{0.660039663f, 0.754230738f},
-std::array<float,2>{0.372904867f, 0.279160023f},
-std::array<float,2>{0.698829055f, 0.145459801f},
-std::array<float,2>{0.29847309f, 0.635187447f},
-std::array<float,2>{0.793143392f, 0.98609221f},
-std::array<float,2>{0.0547660626f, 0.390028894f},
-std::array<float,2>{0.993336022f, 0.347559869f},
-std::array<float,2>{0.24008733f, 0.869430959f},
-std::array<float,2>{0.521666288f, 0.517995477f},
-std::array<float,2>{0.47170192f, 0.0884567052f},
-std::array<float,2>{0.626826227f, 0.30946973f},
-std::array<float,2>{0.32491979f, 0.797168314f},
-std::array<float,2>{0.843534291f, 0.618748724f},
-std::array<float,2>{0.113480628f, 0.0108008478f},
-std::array<float,2>{0.913080633f, 0.221260145f},
-std::array<float,2>{0.147080988f, 0.749455988f},
-std::array<float,2>{0.616011202f, 0.903148949f},
-std::array<float,2>{0.429998249f, 0.474087089f},
-std::array<float,2>{0.550666332f, 0.114889808f},
-std::array<float,2>{0.457725525f, 0.542157412f},
-std::array<float,2>{0.966906369f, 0.834052205f},
-std::array<float,2>{0.217971802f, 0.323060125f},
-std::array<float,2>{0.754105389f, 0.417991847f},
-std::array<float,2>{0.000622174121f, 0.942172885f},
-std::array<float,2>{0.735007346f, 0.656813025f},
-std::array<float,2>{0.254620224f, 0.17953454f},
-std::array<float,2>{0.734225094f, 0.405577481f},
-std::array<float,2>{0.269271016f, 0.970960379f},
-std::array<float,2>{0.769182861f, 0.64306742f},
-std::array<float,2>{0.0212196726f, 0.132478833f},
-std::array<float,2>{0.951682508f, 0.0656822398f},
-std::array<float,2>{0.196577683f, 0.50506711f},
-std::array<float,2>{0.531817317f, 0.859210312f},
-std::array<float,2>{0.452054352f, 0.368129194f},
-std::array<float,2>{0.602545738f, 0.203862265f},
-std::array<float,2>{0.418657213f, 0.691859305f},
-std::array<float,2>{0.930745184f, 0.931244373f},
-std::array<float,2>{0.139764175f, 0.45917812f},
-std::array<float,2>{0.81632489f, 0.261752546f},
-std::array<float,2>{0.103948958f, 0.776628673f},
-std::array<float,2>{0.654409289f, 0.576503873f},
-std::array<float,2>{0.341690809f, 0.0607602187f},
-std::array<float,2>{0.506171584f, 0.337080657f},
-std::array<float,2>{0.492062688f, 0.821353257f},
-std::array<float,2>{0.97442311f, 0.553717315f},
-std::array<float,2>{0.22209698f, 0.0946801156f},
-std::array<float,2>{0.803327739f, 0.159117162f},
-std::array<float,2>{0.0418141633f, 0.675976872f},
-std::array<float,2>{0.712554276f, 0.961850047f},
-std::array<float,2>{0.285820514f, 0.430226535f},
-std::array<float,2>{0.683439672f, 0.0215806495f},
-std::array<float,2>{0.350833654f, 0.608011186f},
-std::array<float,2>{0.869917333f, 0.795460224f},
-std::array<float,2>{0.0815713778f, 0.289893746f},
-std::array<float,2>{0.902913749f, 0.492134333f},
-std::array<float,2>{0.176940456f, 0.890340686f},
-std::array<float,2>{0.591172099f, 0.730275571f},
-std::array<float,2>{0.377830565f, 0.247612849f},
-std::array<float,2>{0.546083629f, 0.429318219f},
-std::array<float,2>{0.440406412f, 0.959662318f},
-std::array<float,2>{0.943322122f, 0.68531841f},
-std::array<float,2>{0.189964831f, 0.168277934f},
-std::array<float,2>{0.774511993f, 0.108436644f},
-std::array<float,2>{0.0245545805f, 0.556757331f},
-std::array<float,2>{0.724918485f, 0.818127692f},
-std::array<float,2>{0.277881414f, 0.333181232f},
-std::array<float,2>{0.647571802f, 0.241676271f},
-std::array<float,2>{0.32979849f, 0.724141896f},
-std::array<float,2>{0.8208009f, 0.877617121f},
-std::array<float,2>{0.0951525569f, 0.495003462f},
-std::array<float,2>{0.926306725f, 0.287232339f},
-std::array<float,2>{0.130878597f, 0.782022953f},
-std::array<float,2>{0.596117377f, 0.594116747f},
-std::array<float,2>{0.40740639f, 0.0310922563f},
-std::array<float,2>{0.707534969f, 0.364993989f},
-std::array<float,2>{0.291304767f, 0.846652925f},
-std::array<float,2>{0.812489271f, 0.509718537f},
-std::array<float,2>{0.0315030403f, 0.0715417713f},
-std::array<float,2>{0.982773125f, 0.140046716f},
-std::array<float,2>{0.232219025f, 0.655752718f},
-std::array<float,2>{0.513884544f, 0.976862013f},
-std::array<float,2>{0.49373135f, 0.398424208f},
-std::array<float,2>{0.579034567f, 0.0543150902f},
-std::array<float,2>{0.384086251f, 0.567782998f},
-std::array<float,2>{0.895147979f, 0.770078421f},
-std::array<float,2>{0.183908343f, 0.252853751f},
-std::array<float,2>{0.859878719f, 0.46303317f},
-std::array<float,2>{0.0910415575f, 0.925944507f},
-std::array<float,2>{0.679378211f, 0.702413142f},
-std::array<float,2>{0.358382285f, 0.211968631f},
-std::array<float,2>{0.664571166f, 0.477535009f},
-std::array<float,2>{0.36714837f, 0.892473698f},
-std::array<float,2>{0.859216213f, 0.738920569f},
-std::array<float,2>{0.0775140598f, 0.229065076f},
-std::array<float,2>{0.881126642f, 0.00367692206f},
-std::array<float,2>{0.167977899f, 0.61393708f},
-std::array<float,2>{0.574607611f, 0.812334478f},
-std::array<float,2>{0.395267993f, 0.299646825f},
-std::array<float,2>{0.524785042f, 0.181394115f},
-std::array<float,2>{0.479101241f, 0.666677535f},
-std::array<float,2>{0.986436605f, 0.947666705f},
-std::array<float,2>{0.246051088f, 0.407503158f},
-std::array<float,2>{0.787646115f, 0.313295037f},
-std::array<float,2>{0.0529022552f, 0.837051213f},
-std::array<float,2>{0.693571329f, 0.535515487f},
-std::array<float,2>{0.309797436f, 0.124820493f},
-std::array<float,2>{0.624215782f, 0.269702852f},
-std::array<float,2>{0.426441342f, 0.763243675f},
-std::array<float,2>{0.919503272f, 0.590867281f},
-std::array<float,2>{0.148661956f, 0.0459171161f},
-std::array<float,2>{0.829829514f, 0.187709972f},
-std::array<float,2>{0.121045351f, 0.710153222f},
-std::array<float,2>{0.639927328f, 0.921703696f},
-std::array<float,2>{0.315304428f, 0.437613457f},
-std::array<float,2>{0.747089803f, 0.0825228393f},
-std::array<float,2>{0.259576946f, 0.526232839f},
-std::array<float,2>{0.765051305f, 0.864080846f},
-std::array<float,2>{0.00840556994f, 0.352945596f},
-std::array<float,2>{0.959199309f, 0.380273163f},
-std::array<float,2>{0.203166723f, 0.996536613f},
-std::array<float,2>{0.562440991f, 0.627049387f},
-std::array<float,2>{0.464863926f, 0.148840234f},
-std::array<float,2>{0.553180814f, 0.465085238f},
-std::array<float,2>{0.45401457f, 0.922388017f},
-std::array<float,2>{0.963393152f, 0.69534117f},
-std::array<float,2>{0.211307496f, 0.21554184f},
-std::array<float,2>{0.751993716f, 0.047311604f},
-std::array<float,2>{0.00409156783f, 0.563937962f},
-std::array<float,2>{0.741101265f, 0.767943978f},
-std::array<float,2>{0.250619829f, 0.254934043f},
-std::array<float,2>{0.631652236f, 0.134862348f},
-std::array<float,2>{0.321289986f, 0.650485158f},
-std::array<float,2>{0.836360097f, 0.982203722f},
-std::array<float,2>{0.112200834f, 0.392441034f},
-std::array<float,2>{0.909127355f, 0.362136304f},
-std::array<float,2>{0.140663579f, 0.851410568f},
-std::array<float,2>{0.612405896f, 0.512843072f},
-std::array<float,2>{0.43541348f, 0.07705044f},
-std::array<float,2>{0.702719569f, 0.282592863f},
-std::array<float,2>{0.303753823f, 0.785473526f},
-std::array<float,2>{0.79164356f, 0.598967373f},
-std::array<float,2>{0.0615112707f, 0.02514337f},
-std::array<float,2>{0.998386562f, 0.236757115f},
-std::array<float,2>{0.235943556f, 0.719230175f},
-std::array<float,2>{0.516592085f, 0.880082965f},
-std::array<float,2>{0.473957837f, 0.496843457f},
-std::array<float,2>{0.562844753f, 0.105114534f},
-std::array<float,2>{0.399454266f, 0.559276223f},
-std::array<float,2>{0.88827467f, 0.814162493f},
-std::array<float,2>{0.164031431f, 0.329027563f},
-std::array<float,2>{0.844669402f, 0.423600644f},
-std::array<float,2>{0.0685692728f, 0.954810858f},
-std::array<float,2>{0.661726713f, 0.681133747f},
-std::array<float,2>{0.368489295f, 0.164393842f},
-std::array<float,2>{0.6845631f, 0.37807849f},
-std::array<float,2>{0.344778776f, 0.994309306f},
-std::array<float,2>{0.874030054f, 0.632346451f},
-std::array<float,2>{0.0830043182f, 0.156067252f},
-std::array<float,2>{0.901845455f, 0.0816303268f},
-std::array<float,2>{0.173254699f, 0.529261827f},
-std::array<float,2>{0.587723851f, 0.861086547f},
-std::array<float,2>{0.381873369f, 0.358290046f},
-std::array<float,2>{0.500413001f, 0.191816717f},
-std::array<float,2>{0.486418486f, 0.704312444f},
-std::array<float,2>{0.969190419f, 0.914563835f},
-std::array<float,2>{0.223107234f, 0.442846388f},
-std::array<float,2>{0.798139095f, 0.266186774f},
-std::array<float,2>{0.0456157178f, 0.75872612f},
-std::array<float,2>{0.715795219f, 0.588223159f},
-std::array<float,2>{0.281623065f, 0.0391631313f},
-std::array<float,2>{0.607745349f, 0.317322195f},
-std::array<float,2>{0.41771543f, 0.842300653f},
-std::array<float,2>{0.935591042f, 0.53408134f},
-std::array<float,2>{0.133645788f, 0.120174617f},
-std::array<float,2>{0.817998171f, 0.183815747f},
-std::array<float,2>{0.108423889f, 0.668735921f},
-std::array<float,2>{0.651246846f, 0.95018208f},
-std::array<float,2>{0.339332253f, 0.413671732f},
-std::array<float,2>{0.726652086f, 0.00730280904f},
-std::array<float,2>{0.27070114f, 0.611382127f},
-std::array<float,2>{0.770944953f, 0.805584669f},
-std::array<float,2>{0.0166839398f, 0.303108215f},
-std::array<float,2>{0.945804954f, 0.483290941f},
-std::array<float,2>{0.202839583f, 0.895614266f},
-std::array<float,2>{0.536998749f, 0.735952079f},
-std::array<float,2>{0.446429759f, 0.233299717f},
-std::array<float,2>{0.583624303f, 0.414210528f},
-std::array<float,2>{0.389662594f, 0.940502942f},
-std::array<float,2>{0.893490136f, 0.661058068f},
-std::array<float,2>{0.183393672f, 0.173094437f},
-std::array<float,2>{0.864950597f, 0.111086093f},
-std::array<float,2>{0.0873488486f, 0.543890357f},
-std::array<float,2>{0.674060285f, 0.830965221f},
-std::array<float,2>{0.35375756f, 0.327566832f},
-std::array<float,2>{0.704941392f, 0.224511638f},
-std::array<float,2>{0.293143898f, 0.745082557f},
-std::array<float,2>{0.80779916f, 0.900817513f},
-std::array<float,2>{0.0368805267f, 0.470638752f},
-std::array<float,2>{0.978833437f, 0.305839688f},
-std::array<float,2>{0.226762056f, 0.803590059f},
-std::array<float,2>{0.510938108f, 0.623749852f},
-std::array<float,2>{0.496251643f, 0.0129568316f},
-std::array<float,2>{0.641860664f, 0.351352066f},
-std::array<float,2>{0.335760087f, 0.872666001f},
-std::array<float,2>{0.826507449f, 0.521790326f},
-std::array<float,2>{0.101420626f, 0.0934935659f},
-std::array<float,2>{0.923521757f, 0.142749056f},
-std::array<float,2>{0.127897561f, 0.640170932f},
-std::array<float,2>{0.599807978f, 0.992024064f},
-std::array<float,2>{0.41340673f, 0.386249185f},
-std::array<float,2>{0.541072786f, 0.03259046f},
-std::array<float,2>{0.44260332f, 0.579340696f},
-std::array<float,2>{0.937723756f, 0.753878415f},
-std::array<float,2>{0.191672802f, 0.276620716f},
-std::array<float,2>{0.778523803f, 0.445695013f},
-std::array<float,2>{0.0275599994f, 0.906805992f},
-std::array<float,2>{0.72125566f, 0.714780092f},
-std::array<float,2>{0.277276933f, 0.202903032f},
-std::array<float,2>{0.742273986f, 0.485024571f},
-std::array<float,2>{0.263288289f, 0.883880079f},
-std::array<float,2>{0.760323107f, 0.73339498f},
-std::array<float,2>{0.0117817894f, 0.244339347f},
-std::array<float,2>{0.955915451f, 0.0156470072f},
-std::array<float,2>{0.20917812f, 0.602182746f},
-std::array<float,2>{0.556891322f, 0.790234923f},
-std::array<float,2>{0.464714646f, 0.296588957f},
-std::array<float,2>{0.619397163f, 0.16400364f},
-std::array<float,2>{0.423009485f, 0.672751248f},
-std::array<float,2>{0.917859495f, 0.96552676f},
-std::array<float,2>{0.155708641f, 0.434522808f},
-std::array<float,2>{0.833153903f, 0.341662735f},
-std::array<float,2>{0.124883093f, 0.824387252f},
-std::array<float,2>{0.634384751f, 0.547897816f},
-std::array<float,2>{0.317931503f, 0.0984481499f},
-std::array<float,2>{0.528354287f, 0.258958369f},
-std::array<float,2>{0.481191427f, 0.78078419f},
-std::array<float,2>{0.989476681f, 0.572530985f},
-std::array<float,2>{0.246691823f, 0.0582415648f},
-std::array<float,2>{0.784568131f, 0.207687646f},
-std::array<float,2>{0.0505785942f, 0.68826133f},
-std::array<float,2>{0.690139115f, 0.937456667f},
-std::array<float,2>{0.305523604f, 0.453995138f},
-std::array<float,2>{0.671739161f, 0.0669635087f},
-std::array<float,2>{0.360765129f, 0.5029549f},
-std::array<float,2>{0.851586044f, 0.852352321f},
-std::array<float,2>{0.0737219974f, 0.373541713f},
-std::array<float,2>{0.876865566f, 0.401210278f},
-std::array<float,2>{0.16704832f, 0.974711239f},
-std::array<float,2>{0.571034908f, 0.644689143f},
-std::array<float,2>{0.391926825f, 0.125390932f},
-std::array<float,2>{0.614268124f, 0.474887997f},
-std::array<float,2>{0.432671249f, 0.90560329f},
-std::array<float,2>{0.912031054f, 0.746408284f},
-std::array<float,2>{0.145248964f, 0.220018342f},
-std::array<float,2>{0.841622055f, 0.00949429814f},
-std::array<float,2>{0.115931146f, 0.621007442f},
-std::array<float,2>{0.627993524f, 0.800770283f},
-std::array<float,2>{0.327529788f, 0.310573399f},
-std::array<float,2>{0.73796618f, 0.177571565f},
-std::array<float,2>{0.257252455f, 0.660111248f},
-std::array<float,2>{0.75679934f, 0.943563581f},
-std::array<float,2>{0.00303249736f, 0.420297116f},
-std::array<float,2>{0.964974165f, 0.321588218f},
-std::array<float,2>{0.215160191f, 0.832407415f},
-std::array<float,2>{0.548112929f, 0.539300561f},
-std::array<float,2>{0.4591223f, 0.116497427f},
-std::array<float,2>{0.656898916f, 0.280997366f},
-std::array<float,2>{0.373781025f, 0.755935192f},
-std::array<float,2>{0.851117313f, 0.585926116f},
-std::array<float,2>{0.0646329299f, 0.037006449f},
-std::array<float,2>{0.885314524f, 0.196319312f},
-std::array<float,2>{0.158138812f, 0.715807915f},
-std::array<float,2>{0.567855597f, 0.91295445f},
-std::array<float,2>{0.405759245f, 0.450828016f},
-std::array<float,2>{0.521228492f, 0.0867697001f},
-std::array<float,2>{0.468973011f, 0.516461849f},
-std::array<float,2>{0.995902956f, 0.867755592f},
-std::array<float,2>{0.241899848f, 0.345668197f},
-std::array<float,2>{0.795896947f, 0.387037158f},
-std::array<float,2>{0.0577537008f, 0.987206042f},
-std::array<float,2>{0.69598037f, 0.633939266f},
-std::array<float,2>{0.299917519f, 0.14734073f},
-std::array<float,2>{0.713823795f, 0.43227011f},
-std::array<float,2>{0.288206369f, 0.964554369f},
-std::array<float,2>{0.802334607f, 0.678606212f},
-std::array<float,2>{0.0397498012f, 0.157282874f},
-std::array<float,2>{0.974879026f, 0.0959210321f},
-std::array<float,2>{0.220418081f, 0.551959574f},
-std::array<float,2>{0.505166054f, 0.823367655f},
-std::array<float,2>{0.48998788f, 0.339223862f},
-std::array<float,2>{0.592546344f, 0.248368233f},
-std::array<float,2>{0.376417577f, 0.728161931f},
-std::array<float,2>{0.904782832f, 0.887808502f},
-std::array<float,2>{0.178585395f, 0.488791943f},
-std::array<float,2>{0.867690802f, 0.292732865f},
-std::array<float,2>{0.0781625658f, 0.794570386f},
-std::array<float,2>{0.681394339f, 0.607300639f},
-std::array<float,2>{0.347906113f, 0.0207664128f},
-std::array<float,2>{0.533952177f, 0.369155973f},
-std::array<float,2>{0.450312972f, 0.8557145f},
-std::array<float,2>{0.949344337f, 0.506008685f},
-std::array<float,2>{0.19797042f, 0.0629492477f},
-std::array<float,2>{0.766298473f, 0.129972503f},
-std::array<float,2>{0.0229357071f, 0.642040789f},
-std::array<float,2>{0.731390238f, 0.969924331f},
-std::array<float,2>{0.266800702f, 0.403048605f},
-std::array<float,2>{0.653156102f, 0.0595109016f},
-std::array<float,2>{0.342534184f, 0.575196445f},
-std::array<float,2>{0.812977195f, 0.773859024f},
-std::array<float,2>{0.101620756f, 0.263728231f},
-std::array<float,2>{0.932641566f, 0.457540393f},
-std::array<float,2>{0.138328001f, 0.932685673f},
-std::array<float,2>{0.603575289f, 0.693507493f},
-std::array<float,2>{0.421699435f, 0.205771938f},
-std::array<float,2>{0.513374388f, 0.394986212f},
-std::array<float,2>{0.494639486f, 0.979091883f},
-std::array<float,2>{0.981143117f, 0.653991342f},
-std::array<float,2>{0.233692423f, 0.137347266f},
-std::array<float,2>{0.810067892f, 0.0741832554f},
-std::array<float,2>{0.0348278657f, 0.5108549f},
-std::array<float,2>{0.710560858f, 0.845260262f},
-std::array<float,2>{0.290837169f, 0.366360396f},
-std::array<float,2>{0.677573144f, 0.214516729f},
-std::array<float,2>{0.357125401f, 0.700016916f},
-std::array<float,2>{0.86281991f, 0.929621279f},
-std::array<float,2>{0.0919960216f, 0.46236971f},
-std::array<float,2>{0.897785604f, 0.251892626f},
-std::array<float,2>{0.18673341f, 0.771794021f},
-std::array<float,2>{0.581518531f, 0.569474876f},
-std::array<float,2>{0.385685742f, 0.0512796864f},
-std::array<float,2>{0.723641753f, 0.335367262f},
-std::array<float,2>{0.279937357f, 0.81876272f},
-std::array<float,2>{0.775545657f, 0.555516779f},
-std::array<float,2>{0.0266298745f, 0.107190788f},
-std::array<float,2>{0.943632603f, 0.171643585f},
-std::array<float,2>{0.188658699f, 0.68731463f},
-std::array<float,2>{0.542990088f, 0.957108915f},
-std::array<float,2>{0.437884927f, 0.427339196f},
-std::array<float,2>{0.595257938f, 0.0286466274f},
-std::array<float,2>{0.409994274f, 0.595755458f},
-std::array<float,2>{0.928887427f, 0.783256829f},
-std::array<float,2>{0.129484743f, 0.286700487f},
-std::array<float,2>{0.824031949f, 0.493464261f},
-std::array<float,2>{0.0962542221f, 0.875238657f},
-std::array<float,2>{0.645527184f, 0.72592026f},
-std::array<float,2>{0.332018346f, 0.239806592f},
-std::array<float,2>{0.637227654f, 0.440889746f},
-std::array<float,2>{0.314093739f, 0.918926716f},
-std::array<float,2>{0.830246031f, 0.708184898f},
-std::array<float,2>{0.117302746f, 0.190439582f},
-std::array<float,2>{0.919948757f, 0.0441880487f},
-std::array<float,2>{0.151468143f, 0.593610942f},
-std::array<float,2>{0.621182561f, 0.764294803f},
-std::array<float,2>{0.428129673f, 0.272422016f},
-std::array<float,2>{0.559789538f, 0.15063493f},
-std::array<float,2>{0.467375219f, 0.626043856f},
-std::array<float,2>{0.957665622f, 0.99946183f},
-std::array<float,2>{0.205874205f, 0.382660031f},
-std::array<float,2>{0.763303578f, 0.354334235f},
-std::array<float,2>{0.0113724899f, 0.866596222f},
-std::array<float,2>{0.749023676f, 0.524690092f},
-std::array<float,2>{0.261554331f, 0.0853344277f},
-std::array<float,2>{0.576492071f, 0.297436059f},
-std::array<float,2>{0.397660285f, 0.809667647f},
-std::array<float,2>{0.879396856f, 0.615924478f},
-std::array<float,2>{0.171493858f, 0.000733742258f},
-std::array<float,2>{0.856959581f, 0.227744281f},
-std::array<float,2>{0.0745623931f, 0.740790784f},
-std::array<float,2>{0.667834699f, 0.893831968f},
-std::array<float,2>{0.364813f, 0.479929f},
-std::array<float,2>{0.693076491f, 0.122114398f},
-std::array<float,2>{0.311889827f, 0.537363529f},
-std::array<float,2>{0.785843134f, 0.839806676f},
-std::array<float,2>{0.0515315905f, 0.315822273f},
-std::array<float,2>{0.984781742f, 0.409198314f},
-std::array<float,2>{0.243282586f, 0.946563184f},
-std::array<float,2>{0.527256489f, 0.664336681f},
-std::array<float,2>{0.477339327f, 0.183550045f},
-std::array<float,2>{0.557456076f, 0.487183124f},
-std::array<float,2>{0.46393767f, 0.885538816f},
-std::array<float,2>{0.955316126f, 0.730568707f},
-std::array<float,2>{0.209764078f, 0.243849546f},
-std::array<float,2>{0.759928465f, 0.0194039829f},
-std::array<float,2>{0.0122105051f, 0.605302513f},
-std::array<float,2>{0.742928922f, 0.792779028f},
-std::array<float,2>{0.263138235f, 0.293934852f},
-std::array<float,2>{0.633877277f, 0.161606133f},
-std::array<float,2>{0.317619532f, 0.673889995f},
-std::array<float,2>{0.833650231f, 0.968298674f},
-std::array<float,2>{0.124266304f, 0.437306255f},
-std::array<float,2>{0.917258084f, 0.343477905f},
-std::array<float,2>{0.155876264f, 0.827272892f},
-std::array<float,2>{0.619856775f, 0.549480319f},
-std::array<float,2>{0.423613727f, 0.100369833f},
-std::array<float,2>{0.689543545f, 0.261597455f},
-std::array<float,2>{0.305125356f, 0.778238177f},
-std::array<float,2>{0.784680188f, 0.571510911f},
-std::array<float,2>{0.0500026569f, 0.0548383854f},
-std::array<float,2>{0.990067959f, 0.209819302f},
-std::array<float,2>{0.246538132f, 0.690035045f},
-std::array<float,2>{0.529257774f, 0.934120297f},
-std::array<float,2>{0.480804145f, 0.456133515f},
-std::array<float,2>{0.570471883f, 0.0696470067f},
-std::array<float,2>{0.392294973f, 0.501125276f},
-std::array<float,2>{0.87644738f, 0.854992986f},
-std::array<float,2>{0.167786583f, 0.372951359f},
-std::array<float,2>{0.852282345f, 0.400309443f},
-std::array<float,2>{0.0738091096f, 0.97335577f},
-std::array<float,2>{0.670962632f, 0.648130417f},
-std::array<float,2>{0.361078858f, 0.127557218f},
-std::array<float,2>{0.674657226f, 0.417199939f},
-std::array<float,2>{0.354006529f, 0.939114571f},
-std::array<float,2>{0.864454687f, 0.662284553f},
-std::array<float,2>{0.0874123722f, 0.174386308f},
-std::array<float,2>{0.892731428f, 0.11317724f},
-std::array<float,2>{0.182827652f, 0.546448588f},
-std::array<float,2>{0.583305597f, 0.828830659f},
-std::array<float,2>{0.390366077f, 0.324338347f},
-std::array<float,2>{0.511468112f, 0.225703001f},
-std::array<float,2>{0.496611863f, 0.743832648f},
-std::array<float,2>{0.979131043f, 0.899578214f},
-std::array<float,2>{0.227145076f, 0.472255737f},
-std::array<float,2>{0.808249652f, 0.308271289f},
-std::array<float,2>{0.0364336297f, 0.80092454f},
-std::array<float,2>{0.704127252f, 0.621764421f},
-std::array<float,2>{0.293628484f, 0.0153647829f},
-std::array<float,2>{0.600538075f, 0.34776777f},
-std::array<float,2>{0.413705319f, 0.874023855f},
-std::array<float,2>{0.923192322f, 0.519634008f},
-std::array<float,2>{0.127267525f, 0.0915868729f},
-std::array<float,2>{0.826719642f, 0.142174467f},
-std::array<float,2>{0.100962937f, 0.637393534f},
-std::array<float,2>{0.642136693f, 0.988292336f},
-std::array<float,2>{0.33509928f, 0.384469479f},
-std::array<float,2>{0.72083813f, 0.034508843f},
-std::array<float,2>{0.276481926f, 0.581993043f},
-std::array<float,2>{0.779032707f, 0.750855923f},
-std::array<float,2>{0.0279718172f, 0.275196731f},
-std::array<float,2>{0.93836242f, 0.448946804f},
-std::array<float,2>{0.192175552f, 0.908656359f},
-std::array<float,2>{0.541594625f, 0.71253854f},
-std::array<float,2>{0.443012863f, 0.199944764f},
-std::array<float,2>{0.586933434f, 0.376555741f},
-std::array<float,2>{0.382426888f, 0.992248535f},
-std::array<float,2>{0.901929259f, 0.628921688f},
-std::array<float,2>{0.173823282f, 0.153116703f},
-std::array<float,2>{0.874832869f, 0.0787984431f},
-std::array<float,2>{0.0821865946f, 0.52993834f},
-std::array<float,2>{0.683873415f, 0.86244303f},
-std::array<float,2>{0.345651001f, 0.356590062f},
-std::array<float,2>{0.715084553f, 0.194610208f},
-std::array<float,2>{0.281997353f, 0.705790997f},
-std::array<float,2>{0.798689365f, 0.916348577f},
-std::array<float,2>{0.0453546122f, 0.444207311f},
-std::array<float,2>{0.969680905f, 0.267788708f},
-std::array<float,2>{0.223436773f, 0.760493398f},
-std::array<float,2>{0.500677407f, 0.586035073f},
-std::array<float,2>{0.486897707f, 0.0418034084f},
-std::array<float,2>{0.650423169f, 0.318990171f},
-std::array<float,2>{0.339398175f, 0.840931714f},
-std::array<float,2>{0.817775667f, 0.531278491f},
-std::array<float,2>{0.1092804f, 0.117305122f},
-std::array<float,2>{0.936193347f, 0.1860504f},
-std::array<float,2>{0.133297756f, 0.671353161f},
-std::array<float,2>{0.608271062f, 0.952006042f},
-std::array<float,2>{0.417427242f, 0.411289424f},
-std::array<float,2>{0.536549509f, 0.00489813415f},
-std::array<float,2>{0.447262555f, 0.610305488f},
-std::array<float,2>{0.945765376f, 0.808377385f},
-std::array<float,2>{0.202333406f, 0.301901549f},
-std::array<float,2>{0.7710042f, 0.481197864f},
-std::array<float,2>{0.0173811242f, 0.89665097f},
-std::array<float,2>{0.727347016f, 0.73729974f},
-std::array<float,2>{0.271386027f, 0.231981903f},
-std::array<float,2>{0.740498841f, 0.468577325f},
-std::array<float,2>{0.250047863f, 0.924604714f},
-std::array<float,2>{0.752542794f, 0.699044406f},
-std::array<float,2>{0.00468247058f, 0.218374506f},
-std::array<float,2>{0.96336025f, 0.0489845909f},
-std::array<float,2>{0.211626053f, 0.565238774f},
-std::array<float,2>{0.553238153f, 0.76689285f},
-std::array<float,2>{0.453574926f, 0.25667274f},
-std::array<float,2>{0.613056898f, 0.132854685f},
-std::array<float,2>{0.434816062f, 0.64895314f},
-std::array<float,2>{0.908224702f, 0.982788265f},
-std::array<float,2>{0.141208619f, 0.393387228f},
-std::array<float,2>{0.836786985f, 0.359734207f},
-std::array<float,2>{0.111407846f, 0.848193228f},
-std::array<float,2>{0.631213486f, 0.514164805f},
-std::array<float,2>{0.322130829f, 0.0756796971f},
-std::array<float,2>{0.516106367f, 0.285010487f},
-std::array<float,2>{0.474552512f, 0.78717953f},
-std::array<float,2>{0.998648047f, 0.600621223f},
-std::array<float,2>{0.235367566f, 0.0268099736f},
-std::array<float,2>{0.791434884f, 0.235218406f},
-std::array<float,2>{0.0610163659f, 0.721132815f},
-std::array<float,2>{0.702587903f, 0.88136512f},
-std::array<float,2>{0.304201633f, 0.499643415f},
-std::array<float,2>{0.661197722f, 0.102939777f},
-std::array<float,2>{0.369137615f, 0.561985672f},
-std::array<float,2>{0.844170213f, 0.814569414f},
-std::array<float,2>{0.0692489892f, 0.331983417f},
-std::array<float,2>{0.887793481f, 0.424906939f},
-std::array<float,2>{0.163522005f, 0.956414104f},
-std::array<float,2>{0.563044012f, 0.683493376f},
-std::array<float,2>{0.399931461f, 0.167932615f},
-std::array<float,2>{0.622057736f, 0.438446879f},
-std::array<float,2>{0.42850551f, 0.921197355f},
-std::array<float,2>{0.920560837f, 0.710490346f},
-std::array<float,2>{0.152046829f, 0.188403174f},
-std::array<float,2>{0.830614805f, 0.046839077f},
-std::array<float,2>{0.117753632f, 0.591789663f},
-std::array<float,2>{0.637170732f, 0.762899876f},
-std::array<float,2>{0.313685864f, 0.270347774f},
-std::array<float,2>{0.74990356f, 0.148942471f},
-std::array<float,2>{0.260798961f, 0.627704084f},
-std::array<float,2>{0.762796164f, 0.997022212f},
-std::array<float,2>{0.0107635166f, 0.380562246f},
-std::array<float,2>{0.957039475f, 0.353098691f},
-std::array<float,2>{0.20508185f, 0.86334157f},
-std::array<float,2>{0.560254335f, 0.525505066f},
-std::array<float,2>{0.466990232f, 0.0822028369f},
-std::array<float,2>{0.66727072f, 0.298865378f},
-std::array<float,2>{0.364481181f, 0.811601937f},
-std::array<float,2>{0.856737733f, 0.613555849f},
-std::array<float,2>{0.0749177933f, 0.00305430242f},
-std::array<float,2>{0.87936008f, 0.228886202f},
-std::array<float,2>{0.171337083f, 0.738701761f},
-std::array<float,2>{0.577143908f, 0.89169395f},
-std::array<float,2>{0.398055017f, 0.477020919f},
-std::array<float,2>{0.526475906f, 0.124110281f},
-std::array<float,2>{0.476571649f, 0.53598839f},
-std::array<float,2>{0.985128641f, 0.837476432f},
-std::array<float,2>{0.244023681f, 0.312714934f},
-std::array<float,2>{0.785305917f, 0.407955825f},
-std::array<float,2>{0.0510068387f, 0.947900712f},
-std::array<float,2>{0.692448378f, 0.666208506f},
-std::array<float,2>{0.312299013f, 0.180806473f},
-std::array<float,2>{0.71011287f, 0.39751491f},
-std::array<float,2>{0.290435225f, 0.977438986f},
-std::array<float,2>{0.80977726f, 0.655946314f},
-std::array<float,2>{0.0345045999f, 0.140446872f},
-std::array<float,2>{0.98052603f, 0.0718128607f},
-std::array<float,2>{0.234139919f, 0.50892055f},
-std::array<float,2>{0.513007224f, 0.84615761f},
-std::array<float,2>{0.494199634f, 0.36453259f},
-std::array<float,2>{0.581658006f, 0.212505832f},
-std::array<float,2>{0.385127872f, 0.702817202f},
-std::array<float,2>{0.89831239f, 0.926621139f},
-std::array<float,2>{0.187093824f, 0.463547587f},
-std::array<float,2>{0.86255163f, 0.252269953f},
-std::array<float,2>{0.0927662775f, 0.769860208f},
-std::array<float,2>{0.677056134f, 0.568118811f},
-std::array<float,2>{0.356507629f, 0.0537147224f},
-std::array<float,2>{0.543585181f, 0.333667845f},
-std::array<float,2>{0.438426137f, 0.817831635f},
-std::array<float,2>{0.944095254f, 0.55733484f},
-std::array<float,2>{0.189172193f, 0.109314658f},
-std::array<float,2>{0.776050329f, 0.168849051f},
-std::array<float,2>{0.0270891022f, 0.684952915f},
-std::array<float,2>{0.724325657f, 0.959372818f},
-std::array<float,2>{0.279357612f, 0.428980023f},
-std::array<float,2>{0.646442354f, 0.0304179695f},
-std::array<float,2>{0.331069976f, 0.594655573f},
-std::array<float,2>{0.823717594f, 0.781733334f},
-std::array<float,2>{0.0959569141f, 0.287641853f},
-std::array<float,2>{0.929403901f, 0.494460046f},
-std::array<float,2>{0.129269972f, 0.877200603f},
-std::array<float,2>{0.595040858f, 0.723933876f},
-std::array<float,2>{0.409232885f, 0.241993845f},
-std::array<float,2>{0.505619943f, 0.429931372f},
-std::array<float,2>{0.48947975f, 0.960997105f},
-std::array<float,2>{0.975114763f, 0.676718235f},
-std::array<float,2>{0.219932348f, 0.158419356f},
-std::array<float,2>{0.802068412f, 0.0939117745f},
-std::array<float,2>{0.0394993685f, 0.554477394f},
-std::array<float,2>{0.713349462f, 0.822259486f},
-std::array<float,2>{0.288606942f, 0.337516874f},
-std::array<float,2>{0.681023479f, 0.247406662f},
-std::array<float,2>{0.348157078f, 0.729957581f},
-std::array<float,2>{0.867233098f, 0.889989614f},
-std::array<float,2>{0.0788467377f, 0.491420388f},
-std::array<float,2>{0.905135572f, 0.289311171f},
-std::array<float,2>{0.177806839f, 0.795246303f},
-std::array<float,2>{0.592275918f, 0.607439339f},
-std::array<float,2>{0.376650184f, 0.0223724265f},
-std::array<float,2>{0.730519712f, 0.36755535f},
-std::array<float,2>{0.267250031f, 0.858540833f},
-std::array<float,2>{0.766070843f, 0.505481243f},
-std::array<float,2>{0.0233815983f, 0.0659561008f},
-std::array<float,2>{0.949890316f, 0.132209465f},
-std::array<float,2>{0.197367951f, 0.642770052f},
-std::array<float,2>{0.533516407f, 0.971467972f},
-std::array<float,2>{0.451102734f, 0.405965269f},
-std::array<float,2>{0.604075789f, 0.0614300855f},
-std::array<float,2>{0.421278894f, 0.576883137f},
-std::array<float,2>{0.933578551f, 0.776916564f},
-std::array<float,2>{0.137830243f, 0.262598455f},
-std::array<float,2>{0.813411653f, 0.459658712f},
-std::array<float,2>{0.102267355f, 0.931115508f},
-std::array<float,2>{0.652618885f, 0.692234218f},
-std::array<float,2>{0.34213829f, 0.203188479f},
-std::array<float,2>{0.628639817f, 0.4743523f},
-std::array<float,2>{0.327758938f, 0.902389348f},
-std::array<float,2>{0.841236174f, 0.749822855f},
-std::array<float,2>{0.115440004f, 0.220962286f},
-std::array<float,2>{0.911579669f, 0.0115435328f},
-std::array<float,2>{0.144555449f, 0.618550718f},
-std::array<float,2>{0.614831209f, 0.797640502f},
-std::array<float,2>{0.433458954f, 0.308738858f},
-std::array<float,2>{0.548428297f, 0.1789985f},
-std::array<float,2>{0.459918052f, 0.656635761f},
-std::array<float,2>{0.965535641f, 0.941462457f},
-std::array<float,2>{0.215636283f, 0.418673575f},
-std::array<float,2>{0.756228328f, 0.322565913f},
-std::array<float,2>{0.00381540204f, 0.834711671f},
-std::array<float,2>{0.737463295f, 0.542935371f},
-std::array<float,2>{0.257347018f, 0.114392221f},
-std::array<float,2>{0.567944825f, 0.278788954f},
-std::array<float,2>{0.406243235f, 0.754419148f},
-std::array<float,2>{0.884864151f, 0.582849205f},
-std::array<float,2>{0.157484531f, 0.0387482941f},
-std::array<float,2>{0.850693941f, 0.197402433f},
-std::array<float,2>{0.065110974f, 0.718655825f},
-std::array<float,2>{0.6566571f, 0.911330581f},
-std::array<float,2>{0.373174906f, 0.452234298f},
-std::array<float,2>{0.695659697f, 0.0882643312f},
-std::array<float,2>{0.300603539f, 0.518096745f},
-std::array<float,2>{0.795325458f, 0.86992383f},
-std::array<float,2>{0.0581161603f, 0.346747905f},
-std::array<float,2>{0.995127797f, 0.390528113f},
-std::array<float,2>{0.241613373f, 0.985577583f},
-std::array<float,2>{0.520536661f, 0.635574818f},
-std::array<float,2>{0.46948567f, 0.14488475f},
-std::array<float,2>{0.52998966f, 0.453539401f},
-std::array<float,2>{0.483547866f, 0.936814368f},
-std::array<float,2>{0.990938842f, 0.687908113f},
-std::array<float,2>{0.248655155f, 0.207424968f},
-std::array<float,2>{0.78173399f, 0.0580597073f},
-std::array<float,2>{0.0473885499f, 0.573105633f},
-std::array<float,2>{0.688434541f, 0.780643523f},
-std::array<float,2>{0.306789696f, 0.259387493f},
-std::array<float,2>{0.66928941f, 0.125601023f},
-std::array<float,2>{0.361408323f, 0.645102262f},
-std::array<float,2>{0.854284942f, 0.975548148f},
-std::array<float,2>{0.0706636682f, 0.400840074f},
-std::array<float,2>{0.878347814f, 0.373089254f},
-std::array<float,2>{0.165591493f, 0.851910055f},
-std::array<float,2>{0.573996723f, 0.50380671f},
-std::array<float,2>{0.39414832f, 0.0666123629f},
-std::array<float,2>{0.745135069f, 0.296249986f},
-std::array<float,2>{0.264503628f, 0.790770113f},
-std::array<float,2>{0.758240521f, 0.60182482f},
-std::array<float,2>{0.0149800321f, 0.0162468702f},
-std::array<float,2>{0.953130186f, 0.244635701f},
-std::array<float,2>{0.207299113f, 0.732810259f},
-std::array<float,2>{0.556352675f, 0.884534478f},
-std::array<float,2>{0.462583363f, 0.484465241f},
-std::array<float,2>{0.619014382f, 0.0979056507f},
-std::array<float,2>{0.425422877f, 0.54857111f},
-std::array<float,2>{0.915582478f, 0.82479465f},
-std::array<float,2>{0.154106274f, 0.341208488f},
-std::array<float,2>{0.834155858f, 0.433864534f},
-std::array<float,2>{0.121207073f, 0.964975774f},
-std::array<float,2>{0.636012435f, 0.672039866f},
-std::array<float,2>{0.318639547f, 0.163165465f},
-std::array<float,2>{0.64444828f, 0.38620764f},
-std::array<float,2>{0.332210898f, 0.991377056f},
-std::array<float,2>{0.825810373f, 0.639939606f},
-std::array<float,2>{0.0979839489f, 0.143451422f},
-std::array<float,2>{0.92399919f, 0.0928120762f},
-std::array<float,2>{0.126951605f, 0.522201717f},
-std::array<float,2>{0.598253608f, 0.872373104f},
-std::array<float,2>{0.411555767f, 0.350631297f},
-std::array<float,2>{0.540857911f, 0.202415928f},
-std::array<float,2>{0.444712311f, 0.713996887f},
-std::array<float,2>{0.940524042f, 0.906404197f},
-std::array<float,2>{0.193914473f, 0.445864975f},
-std::array<float,2>{0.780811191f, 0.277337193f},
-std::array<float,2>{0.0307483356f, 0.753122389f},
-std::array<float,2>{0.720670283f, 0.57995218f},
-std::array<float,2>{0.273509383f, 0.032966923f},
-std::array<float,2>{0.585919499f, 0.327830285f},
-std::array<float,2>{0.387544453f, 0.830110192f},
-std::array<float,2>{0.890982211f, 0.543348432f},
-std::array<float,2>{0.181276187f, 0.110409252f},
-std::array<float,2>{0.865799487f, 0.173619002f},
-std::array<float,2>{0.0885923952f, 0.660208762f},
-std::array<float,2>{0.672878802f, 0.940920472f},
-std::array<float,2>{0.352066159f, 0.415004551f},
-std::array<float,2>{0.707027853f, 0.0136568444f},
-std::array<float,2>{0.2968162f, 0.623439968f},
-std::array<float,2>{0.804901421f, 0.803205311f},
-std::array<float,2>{0.0386840366f, 0.30621469f},
-std::array<float,2>{0.977750301f, 0.469974786f},
-std::array<float,2>{0.229798213f, 0.900961637f},
-std::array<float,2>{0.508172333f, 0.74418956f},
-std::array<float,2>{0.499798238f, 0.223787025f},
-std::array<float,2>{0.605577886f, 0.413092077f},
-std::array<float,2>{0.415726125f, 0.949353278f},
-std::array<float,2>{0.935095191f, 0.66841042f},
-std::array<float,2>{0.135839969f, 0.184471652f},
-std::array<float,2>{0.818534493f, 0.120671995f},
-std::array<float,2>{0.107163116f, 0.533274174f},
-std::array<float,2>{0.65003413f, 0.842123508f},
-std::array<float,2>{0.337537646f, 0.316477716f},
-std::array<float,2>{0.728975117f, 0.232436672f},
-std::array<float,2>{0.272360891f, 0.735801697f},
-std::array<float,2>{0.772814512f, 0.896306932f},
-std::array<float,2>{0.0177431554f, 0.482895106f},
-std::array<float,2>{0.949141204f, 0.30349797f},
-std::array<float,2>{0.199853882f, 0.80477041f},
-std::array<float,2>{0.537880123f, 0.612189174f},
-std::array<float,2>{0.447531521f, 0.00742206583f},
-std::array<float,2>{0.686327159f, 0.357510298f},
-std::array<float,2>{0.346031368f, 0.86072135f},
-std::array<float,2>{0.871583045f, 0.52848953f},
-std::array<float,2>{0.0849659443f, 0.0814870819f},
-std::array<float,2>{0.898944438f, 0.15533866f},
-std::array<float,2>{0.174983904f, 0.632060826f},
-std::array<float,2>{0.588346243f, 0.994750381f},
-std::array<float,2>{0.38055867f, 0.378664196f},
-std::array<float,2>{0.502957225f, 0.0397673436f},
-std::array<float,2>{0.48588568f, 0.588629484f},
-std::array<float,2>{0.971411109f, 0.757975996f},
-std::array<float,2>{0.225192502f, 0.265917659f},
-std::array<float,2>{0.799172044f, 0.443185061f},
-std::array<float,2>{0.0429720245f, 0.91436255f},
-std::array<float,2>{0.718100488f, 0.704633892f},
-std::array<float,2>{0.283807695f, 0.19212836f},
-std::array<float,2>{0.699687302f, 0.496544391f},
-std::array<float,2>{0.30237478f, 0.880575001f},
-std::array<float,2>{0.790431678f, 0.71949321f},
-std::array<float,2>{0.0589083433f, 0.237090752f},
-std::array<float,2>{0.996115386f, 0.0248836502f},
-std::array<float,2>{0.236336157f, 0.599465668f},
-std::array<float,2>{0.518484533f, 0.786044896f},
-std::array<float,2>{0.476431817f, 0.283013433f},
-std::array<float,2>{0.564955533f, 0.164934829f},
-std::array<float,2>{0.401943684f, 0.681395054f},
-std::array<float,2>{0.888980806f, 0.9542799f},
-std::array<float,2>{0.161118403f, 0.422985375f},
-std::array<float,2>{0.847428679f, 0.32820496f},
-std::array<float,2>{0.0668416992f, 0.813827038f},
-std::array<float,2>{0.662612021f, 0.559078991f},
-std::array<float,2>{0.371015161f, 0.104932934f},
-std::array<float,2>{0.550943792f, 0.25538981f},
-std::array<float,2>{0.45693779f, 0.768368423f},
-std::array<float,2>{0.962719858f, 0.564096928f},
-std::array<float,2>{0.213745102f, 0.0474385507f},
-std::array<float,2>{0.750972629f, 0.215253562f},
-std::array<float,2>{0.00774710253f, 0.695891321f},
-std::array<float,2>{0.739089727f, 0.921900153f},
-std::array<float,2>{0.252125382f, 0.465764225f},
-std::array<float,2>{0.630435884f, 0.0766532719f},
-std::array<float,2>{0.323475003f, 0.513586998f},
-std::array<float,2>{0.838818133f, 0.850785911f},
-std::array<float,2>{0.111195929f, 0.361405641f},
-std::array<float,2>{0.906912923f, 0.391834348f},
-std::array<float,2>{0.144444913f, 0.981667101f},
-std::array<float,2>{0.610347152f, 0.651334822f},
-std::array<float,2>{0.436159134f, 0.135563806f},
-std::array<float,2>{0.574723363f, 0.48000443f},
-std::array<float,2>{0.39469102f, 0.894125521f},
-std::array<float,2>{0.881474793f, 0.740544379f},
-std::array<float,2>{0.168527201f, 0.228030279f},
-std::array<float,2>{0.858652294f, 0.00039774648f},
-std::array<float,2>{0.0779759884f, 0.615598738f},
-std::array<float,2>{0.664232254f, 0.810300231f},
-std::array<float,2>{0.366591483f, 0.29734388f},
-std::array<float,2>{0.693887711f, 0.182976514f},
-std::array<float,2>{0.31046617f, 0.664797127f},
-std::array<float,2>{0.787272811f, 0.946844041f},
-std::array<float,2>{0.0535933077f, 0.409721464f},
-std::array<float,2>{0.987297714f, 0.31618759f},
-std::array<float,2>{0.245247066f, 0.839144528f},
-std::array<float,2>{0.525324285f, 0.537879705f},
-std::array<float,2>{0.478628576f, 0.122704796f},
-std::array<float,2>{0.640477717f, 0.271643549f},
-std::array<float,2>{0.314472467f, 0.764106333f},
-std::array<float,2>{0.829421699f, 0.592950523f},
-std::array<float,2>{0.120581448f, 0.0448781177f},
-std::array<float,2>{0.919204533f, 0.191048875f},
-std::array<float,2>{0.149196774f, 0.708615005f},
-std::array<float,2>{0.624655962f, 0.918359995f},
-std::array<float,2>{0.426105171f, 0.441396475f},
-std::array<float,2>{0.561714649f, 0.0858581364f},
-std::array<float,2>{0.465453207f, 0.525271237f},
-std::array<float,2>{0.959625244f, 0.866931677f},
-std::array<float,2>{0.203825638f, 0.353911012f},
-std::array<float,2>{0.765470684f, 0.382050663f},
-std::array<float,2>{0.00810067449f, 0.999692082f},
-std::array<float,2>{0.747666001f, 0.626849473f},
-std::array<float,2>{0.259069562f, 0.150921255f},
-std::array<float,2>{0.725215435f, 0.427100182f},
-std::array<float,2>{0.277699023f, 0.957908928f},
-std::array<float,2>{0.775287747f, 0.686971605f},
-std::array<float,2>{0.0252799708f, 0.170956984f},
-std::array<float,2>{0.942819953f, 0.106759809f},
-std::array<float,2>{0.189574465f, 0.554858446f},
-std::array<float,2>{0.546595812f, 0.819288254f},
-std::array<float,2>{0.43965295f, 0.335633487f},
-std::array<float,2>{0.596621573f, 0.239446715f},
-std::array<float,2>{0.408162743f, 0.726545393f},
-std::array<float,2>{0.92582494f, 0.875955522f},
-std::array<float,2>{0.13168098f, 0.493977338f},
-std::array<float,2>{0.820749164f, 0.286284864f},
-std::array<float,2>{0.095640704f, 0.783867419f},
-std::array<float,2>{0.64819026f, 0.59653306f},
-std::array<float,2>{0.329277962f, 0.0292863194f},
-std::array<float,2>{0.51455617f, 0.366912276f},
-std::array<float,2>{0.493643552f, 0.844989896f},
-std::array<float,2>{0.983042896f, 0.511232078f},
-std::array<float,2>{0.231574669f, 0.0732609555f},
-std::array<float,2>{0.812000334f, 0.136793047f},
-std::array<float,2>{0.0319069736f, 0.653713703f},
-std::array<float,2>{0.707250714f, 0.978980243f},
-std::array<float,2>{0.291920334f, 0.395133466f},
-std::array<float,2>{0.678905785f, 0.0510876551f},
-std::array<float,2>{0.357828915f, 0.569966495f},
-std::array<float,2>{0.859489501f, 0.772045672f},
-std::array<float,2>{0.0917925686f, 0.251423538f},
-std::array<float,2>{0.894868433f, 0.462846398f},
-std::array<float,2>{0.184146568f, 0.929030418f},
-std::array<float,2>{0.578581512f, 0.699519217f},
-std::array<float,2>{0.384426147f, 0.214312166f},
-std::array<float,2>{0.531719685f, 0.402498543f},
-std::array<float,2>{0.451490462f, 0.97061038f},
-std::array<float,2>{0.951546013f, 0.642275751f},
-std::array<float,2>{0.197104067f, 0.130781382f},
-std::array<float,2>{0.768927872f, 0.0630174503f},
-std::array<float,2>{0.0205816906f, 0.506634712f},
-std::array<float,2>{0.733545065f, 0.856231928f},
-std::array<float,2>{0.268658876f, 0.369971842f},
-std::array<float,2>{0.654833019f, 0.205358177f},
-std::array<float,2>{0.340987742f, 0.693947017f},
-std::array<float,2>{0.815704525f, 0.933319211f},
-std::array<float,2>{0.104127295f, 0.457481414f},
-std::array<float,2>{0.931370318f, 0.264366269f},
-std::array<float,2>{0.140603602f, 0.774145246f},
-std::array<float,2>{0.603145361f, 0.575697184f},
-std::array<float,2>{0.41830188f, 0.058839146f},
-std::array<float,2>{0.711914837f, 0.339684337f},
-std::array<float,2>{0.28515631f, 0.823747277f},
-std::array<float,2>{0.802855313f, 0.552600443f},
-std::array<float,2>{0.0410441235f, 0.0963345692f},
-std::array<float,2>{0.973923326f, 0.15792644f},
-std::array<float,2>{0.222363904f, 0.677977264f},
-std::array<float,2>{0.506668091f, 0.964261055f},
-std::array<float,2>{0.491214067f, 0.431697071f},
-std::array<float,2>{0.591507673f, 0.0213372447f},
-std::array<float,2>{0.377400905f, 0.606495023f},
-std::array<float,2>{0.902776659f, 0.794390142f},
-std::array<float,2>{0.177389696f, 0.292054683f},
-std::array<float,2>{0.86935854f, 0.488388866f},
-std::array<float,2>{0.0811702013f, 0.888457358f},
-std::array<float,2>{0.682803154f, 0.727555513f},
-std::array<float,2>{0.351140678f, 0.248708352f},
-std::array<float,2>{0.659204245f, 0.450579733f},
-std::array<float,2>{0.372232109f, 0.912527859f},
-std::array<float,2>{0.847851694f, 0.715242267f},
-std::array<float,2>{0.0636454374f, 0.196880266f},
-std::array<float,2>{0.884057045f, 0.0366034955f},
-std::array<float,2>{0.159439012f, 0.585414588f},
-std::array<float,2>{0.568827629f, 0.756367445f},
-std::array<float,2>{0.40319854f, 0.280336618f},
-std::array<float,2>{0.522215605f, 0.146884739f},
-std::array<float,2>{0.472261429f, 0.634558976f},
-std::array<float,2>{0.994004309f, 0.986432374f},
-std::array<float,2>{0.239433363f, 0.387336522f},
-std::array<float,2>{0.793464482f, 0.344967425f},
-std::array<float,2>{0.0552235544f, 0.867333591f},
-std::array<float,2>{0.698643327f, 0.515714049f},
-std::array<float,2>{0.2980735f, 0.0862774625f},
-std::array<float,2>{0.615335882f, 0.311217785f},
-std::array<float,2>{0.430631012f, 0.800026f},
-std::array<float,2>{0.912501991f, 0.620348036f},
-std::array<float,2>{0.146662056f, 0.00916424766f},
-std::array<float,2>{0.842959225f, 0.220430702f},
-std::array<float,2>{0.113789037f, 0.746626258f},
-std::array<float,2>{0.626074731f, 0.906169593f},
-std::array<float,2>{0.324577957f, 0.475375354f},
-std::array<float,2>{0.734834909f, 0.117113791f},
-std::array<float,2>{0.254130006f, 0.539651096f},
-std::array<float,2>{0.754634857f, 0.832934558f},
-std::array<float,2>{0.000288206007f, 0.321913481f},
-std::array<float,2>{0.967670202f, 0.420606375f},
-std::array<float,2>{0.218402624f, 0.943958342f},
-std::array<float,2>{0.550212502f, 0.659424484f},
-std::array<float,2>{0.457333982f, 0.176777139f},
-std::array<float,2>{0.509441257f, 0.471246988f},
-std::array<float,2>{0.498865455f, 0.898824751f},
-std::array<float,2>{0.976861894f, 0.742302001f},
-std::array<float,2>{0.229044035f, 0.22463493f},
-std::array<float,2>{0.80602169f, 0.0142554212f},
-std::array<float,2>{0.0377867296f, 0.622784257f},
-std::array<float,2>{0.705214739f, 0.802082837f},
-std::array<float,2>{0.295401067f, 0.307432204f},
-std::array<float,2>{0.672667384f, 0.175051659f},
-std::array<float,2>{0.352736175f, 0.663210392f},
-std::array<float,2>{0.866952479f, 0.938132763f},
-std::array<float,2>{0.0892651156f, 0.416264981f},
-std::array<float,2>{0.89215821f, 0.325912237f},
-std::array<float,2>{0.180160299f, 0.829702854f},
-std::array<float,2>{0.584098339f, 0.545558691f},
-std::array<float,2>{0.388222158f, 0.112123698f},
-std::array<float,2>{0.71924305f, 0.273529679f},
-std::array<float,2>{0.275321722f, 0.75137645f},
-std::array<float,2>{0.78007555f, 0.580637217f},
-std::array<float,2>{0.0296632852f, 0.0336018801f},
-std::array<float,2>{0.940421581f, 0.200393215f},
-std::array<float,2>{0.195293859f, 0.711127698f},
-std::array<float,2>{0.539874613f, 0.909748912f},
-std::array<float,2>{0.443405539f, 0.447393477f},
-std::array<float,2>{0.599122226f, 0.090352498f},
-std::array<float,2>{0.411074072f, 0.521186829f},
-std::array<float,2>{0.925349176f, 0.873141825f},
-std::array<float,2>{0.125376582f, 0.349178761f},
-std::array<float,2>{0.824383855f, 0.383438587f},
-std::array<float,2>{0.0991150737f, 0.98995173f},
-std::array<float,2>{0.643177807f, 0.637876093f},
-std::array<float,2>{0.333667099f, 0.141245022f},
-std::array<float,2>{0.635070384f, 0.435745627f},
-std::array<float,2>{0.319858819f, 0.96687454f},
-std::array<float,2>{0.835702419f, 0.675324857f},
-std::array<float,2>{0.122532472f, 0.160294399f},
-std::array<float,2>{0.914779067f, 0.101093523f},
-std::array<float,2>{0.152608126f, 0.550262749f},
-std::array<float,2>{0.617601097f, 0.82664299f},
-std::array<float,2>{0.424579203f, 0.34266603f},
-std::array<float,2>{0.554886341f, 0.242552578f},
-std::array<float,2>{0.461566687f, 0.731508374f},
-std::array<float,2>{0.954184413f, 0.885898769f},
-std::array<float,2>{0.208499372f, 0.487377733f},
-std::array<float,2>{0.759174824f, 0.294804782f},
-std::array<float,2>{0.0145804686f, 0.791409791f},
-std::array<float,2>{0.744280696f, 0.604152381f},
-std::array<float,2>{0.264759004f, 0.018466251f},
-std::array<float,2>{0.57292074f, 0.371187449f},
-std::array<float,2>{0.39305076f, 0.854129851f},
-std::array<float,2>{0.877292216f, 0.500747561f},
-std::array<float,2>{0.164824426f, 0.0687094107f},
-std::array<float,2>{0.854530036f, 0.12802887f},
-std::array<float,2>{0.071578607f, 0.646646559f},
-std::array<float,2>{0.668792188f, 0.974225283f},
-std::array<float,2>{0.36277017f, 0.39904362f},
-std::array<float,2>{0.688970149f, 0.0561141632f},
-std::array<float,2>{0.307872057f, 0.571084738f},
-std::array<float,2>{0.782960892f, 0.779006362f},
-std::array<float,2>{0.0480709001f, 0.260452837f},
-std::array<float,2>{0.991969466f, 0.455982149f},
-std::array<float,2>{0.24963437f, 0.93552804f},
-std::array<float,2>{0.531169415f, 0.691361487f},
-std::array<float,2>{0.482968718f, 0.210502923f},
-std::array<float,2>{0.610737205f, 0.393899828f},
-std::array<float,2>{0.436783701f, 0.983664811f},
-std::array<float,2>{0.907230735f, 0.6500175f},
-std::array<float,2>{0.142594337f, 0.134056062f},
-std::array<float,2>{0.839443147f, 0.0745228305f},
-std::array<float,2>{0.109452955f, 0.515605032f},
-std::array<float,2>{0.629335225f, 0.849279225f},
-std::array<float,2>{0.32277438f, 0.36111477f},
-std::array<float,2>{0.740028262f, 0.216856912f},
-std::array<float,2>{0.253575087f, 0.697463155f},
-std::array<float,2>{0.751749814f, 0.925480902f},
-std::array<float,2>{0.00637651607f, 0.467352629f},
-std::array<float,2>{0.961051285f, 0.256942302f},
-std::array<float,2>{0.214698479f, 0.766510546f},
-std::array<float,2>{0.552607834f, 0.565670192f},
-std::array<float,2>{0.455819309f, 0.05025208f},
-std::array<float,2>{0.663478374f, 0.330305845f},
-std::array<float,2>{0.369174689f, 0.816146612f},
-std::array<float,2>{0.846293867f, 0.561402917f},
-std::array<float,2>{0.0679963529f, 0.102120437f},
-std::array<float,2>{0.890319228f, 0.166574389f},
-std::array<float,2>{0.161232293f, 0.681898177f},
-std::array<float,2>{0.56572473f, 0.955754936f},
-std::array<float,2>{0.401195735f, 0.424452305f},
-std::array<float,2>{0.519494176f, 0.0262944568f},
-std::array<float,2>{0.475231469f, 0.599774182f},
-std::array<float,2>{0.997893095f, 0.788794756f},
-std::array<float,2>{0.237941384f, 0.283532649f},
-std::array<float,2>{0.789551616f, 0.498753428f},
-std::array<float,2>{0.0604999848f, 0.882593572f},
-std::array<float,2>{0.701139331f, 0.722153783f},
-std::array<float,2>{0.30137822f, 0.235736221f},
-std::array<float,2>{0.717261195f, 0.445149601f},
-std::array<float,2>{0.284732044f, 0.917913795f},
-std::array<float,2>{0.800167561f, 0.7061432f},
-std::array<float,2>{0.0448560975f, 0.193624422f},
-std::array<float,2>{0.972091436f, 0.0421213284f},
-std::array<float,2>{0.22594735f, 0.587014019f},
-std::array<float,2>{0.502900004f, 0.760889232f},
-std::array<float,2>{0.484874398f, 0.269333184f},
-std::array<float,2>{0.589694083f, 0.153612524f},
-std::array<float,2>{0.379061848f, 0.630714476f},
-std::array<float,2>{0.900107861f, 0.993897617f},
-std::array<float,2>{0.174305588f, 0.37533024f},
-std::array<float,2>{0.872261882f, 0.355855763f},
-std::array<float,2>{0.0848659202f, 0.862060249f},
-std::array<float,2>{0.686785281f, 0.531074166f},
-std::array<float,2>{0.346809357f, 0.0794285759f},
-std::array<float,2>{0.538322985f, 0.301290452f},
-std::array<float,2>{0.448928803f, 0.807318747f},
-std::array<float,2>{0.948001742f, 0.610531211f},
-std::array<float,2>{0.200356215f, 0.00444331625f},
-std::array<float,2>{0.771558404f, 0.230511129f},
-std::array<float,2>{0.019065883f, 0.737898171f},
-std::array<float,2>{0.729824603f, 0.897677958f},
-std::array<float,2>{0.272785723f, 0.482367128f},
-std::array<float,2>{0.649346709f, 0.118743479f},
-std::array<float,2>{0.336227715f, 0.532511234f},
-std::array<float,2>{0.819400311f, 0.840784311f},
-std::array<float,2>{0.105723538f, 0.31956622f},
-std::array<float,2>{0.934551299f, 0.410521388f},
-std::array<float,2>{0.135293111f, 0.952448189f},
-std::array<float,2>{0.60711509f, 0.670391619f},
-std::array<float,2>{0.414970458f, 0.186967835f},
-std::array<float,2>{0.579875648f, 0.46395123f},
-std::array<float,2>{0.382927001f, 0.926978528f},
-std::array<float,2>{0.896062613f, 0.701976776f},
-std::array<float,2>{0.184646547f, 0.211392224f},
-std::array<float,2>{0.861007512f, 0.0528827198f},
-std::array<float,2>{0.090731211f, 0.566560805f},
-std::array<float,2>{0.678077757f, 0.771249712f},
-std::array<float,2>{0.358840615f, 0.253713906f},
-std::array<float,2>{0.708482623f, 0.139295757f},
-std::array<float,2>{0.292265058f, 0.655181706f},
-std::array<float,2>{0.810580134f, 0.977627933f},
-std::array<float,2>{0.0328804739f, 0.397163391f},
-std::array<float,2>{0.983876288f, 0.363725305f},
-std::array<float,2>{0.230906352f, 0.847359657f},
-std::array<float,2>{0.515602231f, 0.507964432f},
-std::array<float,2>{0.493109256f, 0.0710544363f},
-std::array<float,2>{0.646744132f, 0.288594037f},
-std::array<float,2>{0.328954399f, 0.783020377f},
-std::array<float,2>{0.821706593f, 0.595229506f},
-std::array<float,2>{0.0940334797f, 0.0301662292f},
-std::array<float,2>{0.927582741f, 0.240474567f},
-std::array<float,2>{0.132666379f, 0.722954512f},
-std::array<float,2>{0.597497702f, 0.878561616f},
-std::array<float,2>{0.406297803f, 0.495976806f},
-std::array<float,2>{0.545292139f, 0.10797406f},
-std::array<float,2>{0.440717667f, 0.558043361f},
-std::array<float,2>{0.941601515f, 0.816492796f},
-std::array<float,2>{0.191083342f, 0.332992464f},
-std::array<float,2>{0.774318814f, 0.428183556f},
-std::array<float,2>{0.0240728166f, 0.96040684f},
-std::array<float,2>{0.725984275f, 0.684114337f},
-std::array<float,2>{0.278672874f, 0.169830695f},
-std::array<float,2>{0.746367455f, 0.379099756f},
-std::array<float,2>{0.25873372f, 0.997449815f},
-std::array<float,2>{0.76387769f, 0.628791809f},
-std::array<float,2>{0.00914337952f, 0.149665311f},
-std::array<float,2>{0.960379124f, 0.0830113217f},
-std::array<float,2>{0.204239801f, 0.526424706f},
-std::array<float,2>{0.560725749f, 0.864640415f},
-std::array<float,2>{0.466033727f, 0.351722836f},
-std::array<float,2>{0.623164177f, 0.189023331f},
-std::array<float,2>{0.427092701f, 0.709830761f},
-std::array<float,2>{0.918671966f, 0.919929206f},
-std::array<float,2>{0.149804443f, 0.438869715f},
-std::array<float,2>{0.828911126f, 0.270547956f},
-std::array<float,2>{0.119505897f, 0.76248008f},
-std::array<float,2>{0.639078379f, 0.59048754f},
-std::array<float,2>{0.315561146f, 0.0458529256f},
-std::array<float,2>{0.524251282f, 0.313794971f},
-std::array<float,2>{0.480062336f, 0.836726427f},
-std::array<float,2>{0.987714767f, 0.536136568f},
-std::array<float,2>{0.244640335f, 0.12397325f},
-std::array<float,2>{0.788247824f, 0.180190384f},
-std::array<float,2>{0.0546680577f, 0.667835951f},
-std::array<float,2>{0.695046842f, 0.948879004f},
-std::array<float,2>{0.309250355f, 0.406602472f},
-std::array<float,2>{0.665584981f, 0.00264533306f},
-std::array<float,2>{0.365891546f, 0.614924669f},
-std::array<float,2>{0.857845962f, 0.810971737f},
-std::array<float,2>{0.0762540027f, 0.300480366f},
-std::array<float,2>{0.881972849f, 0.477624089f},
-std::array<float,2>{0.169360444f, 0.891414225f},
-std::array<float,2>{0.575627327f, 0.739734173f},
-std::array<float,2>{0.396188378f, 0.22968474f},
-std::array<float,2>{0.549790502f, 0.419413626f},
-std::array<float,2>{0.458377779f, 0.942989349f},
-std::array<float,2>{0.968746543f, 0.658032596f},
-std::array<float,2>{0.216969028f, 0.178160176f},
-std::array<float,2>{0.755062044f, 0.113984458f},
-std::array<float,2>{0.00127440493f, 0.541596115f},
-std::array<float,2>{0.735967577f, 0.835000455f},
-std::array<float,2>{0.255791396f, 0.323745996f},
-std::array<float,2>{0.625512302f, 0.222625107f},
-std::array<float,2>{0.325970054f, 0.748851776f},
-std::array<float,2>{0.842649877f, 0.904201925f},
-std::array<float,2>{0.114669673f, 0.47332716f},
-std::array<float,2>{0.913503706f, 0.310016155f},
-std::array<float,2>{0.147821799f, 0.79852128f},
-std::array<float,2>{0.616255283f, 0.617764533f},
-std::array<float,2>{0.430734575f, 0.0100537464f},
-std::array<float,2>{0.697502851f, 0.346511722f},
-std::array<float,2>{0.297180474f, 0.87038517f},
-std::array<float,2>{0.794169605f, 0.519059241f},
-std::array<float,2>{0.0562005863f, 0.0897819772f},
-std::array<float,2>{0.992210686f, 0.14612788f},
-std::array<float,2>{0.238818601f, 0.636309385f},
-std::array<float,2>{0.52251631f, 0.984592855f},
-std::array<float,2>{0.471170276f, 0.389180213f},
-std::array<float,2>{0.56943655f, 0.037921723f},
-std::array<float,2>{0.403634191f, 0.583885729f},
-std::array<float,2>{0.88374871f, 0.755681276f},
-std::array<float,2>{0.158630997f, 0.277700722f},
-std::array<float,2>{0.849525392f, 0.45176959f},
-std::array<float,2>{0.0627335459f, 0.910816312f},
-std::array<float,2>{0.65859735f, 0.716996908f},
-std::array<float,2>{0.371801436f, 0.198778644f},
-std::array<float,2>{0.682244599f, 0.490405947f},
-std::array<float,2>{0.350262523f, 0.889011145f},
-std::array<float,2>{0.870462418f, 0.728995562f},
-std::array<float,2>{0.0801686049f, 0.246312782f},
-std::array<float,2>{0.90428102f, 0.0228246078f},
-std::array<float,2>{0.176688507f, 0.608607054f},
-std::array<float,2>{0.590588927f, 0.796826065f},
-std::array<float,2>{0.378182739f, 0.290864706f},
-std::array<float,2>{0.507647753f, 0.159331009f},
-std::array<float,2>{0.491063505f, 0.677527547f},
-std::array<float,2>{0.973307252f, 0.962433398f},
-std::array<float,2>{0.221552595f, 0.430815279f},
-std::array<float,2>{0.803975046f, 0.336233288f},
-std::array<float,2>{0.0427334979f, 0.820936561f},
-std::array<float,2>{0.711601675f, 0.552962065f},
-std::array<float,2>{0.286835223f, 0.0949063823f},
-std::array<float,2>{0.601739705f, 0.263541877f},
-std::array<float,2>{0.419541508f, 0.775543988f},
-std::array<float,2>{0.93065834f, 0.577460229f},
-std::array<float,2>{0.139134273f, 0.0623491742f},
-std::array<float,2>{0.81475693f, 0.204160944f},
-std::array<float,2>{0.105227731f, 0.693253815f},
-std::array<float,2>{0.656031251f, 0.930105567f},
-std::array<float,2>{0.340046972f, 0.460082263f},
-std::array<float,2>{0.732782125f, 0.0650359541f},
-std::array<float,2>{0.26779449f, 0.504792273f},
-std::array<float,2>{0.767684579f, 0.857565939f},
-std::array<float,2>{0.0197422244f, 0.368607759f},
-std::array<float,2>{0.953047693f, 0.404868215f},
-std::array<float,2>{0.195464328f, 0.972079575f},
-std::array<float,2>{0.532302856f, 0.643654943f},
-std::array<float,2>{0.452739388f, 0.131462231f},
-std::array<float,2>{0.542913675f, 0.446917683f},
-std::array<float,2>{0.441598088f, 0.907378793f},
-std::array<float,2>{0.938673973f, 0.713488817f},
-std::array<float,2>{0.192398235f, 0.202126712f},
-std::array<float,2>{0.778222024f, 0.0314723179f},
-std::array<float,2>{0.0284812897f, 0.578788519f},
-std::array<float,2>{0.722628772f, 0.751962602f},
-std::array<float,2>{0.275906116f, 0.275569767f},
-std::array<float,2>{0.640905261f, 0.143937245f},
-std::array<float,2>{0.334154129f, 0.638686061f},
-std::array<float,2>{0.827815413f, 0.991023302f},
-std::array<float,2>{0.100454375f, 0.385707617f},
-std::array<float,2>{0.922221363f, 0.349642217f},
-std::array<float,2>{0.128135651f, 0.871106446f},
-std::array<float,2>{0.60106957f, 0.522610307f},
-std::array<float,2>{0.412355185f, 0.0924665779f},
-std::array<float,2>{0.703993261f, 0.305555224f},
-std::array<float,2>{0.294881612f, 0.804223359f},
-std::array<float,2>{0.806997478f, 0.624424756f},
-std::array<float,2>{0.035283003f, 0.0121277459f},
-std::array<float,2>{0.980391681f, 0.223527223f},
-std::array<float,2>{0.228250191f, 0.74604094f},
-std::array<float,2>{0.510249555f, 0.901497662f},
-std::array<float,2>{0.497130007f, 0.468974024f},
-std::array<float,2>{0.582058311f, 0.109987661f},
-std::array<float,2>{0.388913035f, 0.544595718f},
-std::array<float,2>{0.893707335f, 0.831584811f},
-std::array<float,2>{0.181878075f, 0.326351911f},
-std::array<float,2>{0.863917708f, 0.415260136f},
-std::array<float,2>{0.0866075382f, 0.94036752f},
-std::array<float,2>{0.674980223f, 0.661974609f},
-std::array<float,2>{0.354916304f, 0.172392085f},
-std::array<float,2>{0.670675576f, 0.401413947f},
-std::array<float,2>{0.359568477f, 0.976429224f},
-std::array<float,2>{0.853336334f, 0.645805359f},
-std::array<float,2>{0.0729144365f, 0.126455814f},
-std::array<float,2>{0.875510812f, 0.0678815618f},
-std::array<float,2>{0.16678369f, 0.502275467f},
-std::array<float,2>{0.572221696f, 0.852698803f},
-std::array<float,2>{0.390999556f, 0.374340802f},
-std::array<float,2>{0.528096139f, 0.208868936f},
-std::array<float,2>{0.482330829f, 0.689450204f},
-std::array<float,2>{0.98866576f, 0.935572982f},
-std::array<float,2>{0.247173473f, 0.45478037f},
-std::array<float,2>{0.78384757f, 0.25816983f},
-std::array<float,2>{0.0496399961f, 0.77988106f},
-std::array<float,2>{0.690504432f, 0.573432207f},
-std::array<float,2>{0.306093931f, 0.0567326136f},
-std::array<float,2>{0.620143294f, 0.340312749f},
-std::array<float,2>{0.422581613f, 0.825548232f},
-std::array<float,2>{0.916207194f, 0.5469594f},
-std::array<float,2>{0.154564738f, 0.0988879427f},
-std::array<float,2>{0.832435846f, 0.162147745f},
-std::array<float,2>{0.123594098f, 0.673551023f},
-std::array<float,2>{0.633685589f, 0.966670752f},
-std::array<float,2>{0.317378163f, 0.434589028f},
-std::array<float,2>{0.743509591f, 0.0172434784f},
-std::array<float,2>{0.262026757f, 0.602809012f},
-std::array<float,2>{0.761543989f, 0.789334536f},
-std::array<float,2>{0.0132934842f, 0.295710176f},
-std::array<float,2>{0.957012057f, 0.486302167f},
-std::array<float,2>{0.210535064f, 0.882887781f},
-std::array<float,2>{0.558539808f, 0.733937085f},
-std::array<float,2>{0.463678956f, 0.24529475f},
-std::array<float,2>{0.564387918f, 0.422764987f},
-std::array<float,2>{0.399081171f, 0.95399946f},
-std::array<float,2>{0.88719368f, 0.679833591f},
-std::array<float,2>{0.162695602f, 0.16578427f},
-std::array<float,2>{0.845695019f, 0.103569902f},
-std::array<float,2>{0.0696023554f, 0.560065687f},
-std::array<float,2>{0.660477161f, 0.813043177f},
-std::array<float,2>{0.367497057f, 0.32937485f},
-std::array<float,2>{0.701419413f, 0.23738493f},
-std::array<float,2>{0.303192377f, 0.720282316f},
-std::array<float,2>{0.792916298f, 0.879393935f},
-std::array<float,2>{0.061946094f, 0.498011023f},
-std::array<float,2>{0.999644876f, 0.282111287f},
-std::array<float,2>{0.234780759f, 0.78709954f},
-std::array<float,2>{0.517178893f, 0.598217487f},
-std::array<float,2>{0.472867429f, 0.0243415348f},
-std::array<float,2>{0.632456183f, 0.362715185f},
-std::array<float,2>{0.320750117f, 0.850498319f},
-std::array<float,2>{0.837631524f, 0.512515962f},
-std::array<float,2>{0.112759098f, 0.0775672719f},
-std::array<float,2>{0.909788132f, 0.136022225f},
-std::array<float,2>{0.141726896f, 0.651799381f},
-std::array<float,2>{0.611531258f, 0.981433809f},
-std::array<float,2>{0.434230417f, 0.390791923f},
-std::array<float,2>{0.554262519f, 0.0482250974f},
-std::array<float,2>{0.454293281f, 0.562659681f},
-std::array<float,2>{0.964323521f, 0.769517124f},
-std::array<float,2>{0.212076962f, 0.254145354f},
-std::array<float,2>{0.753817976f, 0.465894282f},
-std::array<float,2>{0.00508565549f, 0.923473716f},
-std::array<float,2>{0.741469741f, 0.69644177f},
-std::array<float,2>{0.251176357f, 0.216780454f},
-std::array<float,2>{0.728448153f, 0.484167874f},
-std::array<float,2>{0.270086229f, 0.8948282f},
-std::array<float,2>{0.770457268f, 0.734605849f},
-std::array<float,2>{0.0161430072f, 0.233661726f},
-std::array<float,2>{0.946316004f, 0.00592111377f},
-std::array<float,2>{0.201609254f, 0.612497151f},
-std::array<float,2>{0.535261512f, 0.80583322f},
-std::array<float,2>{0.445809841f, 0.303894728f},
-std::array<float,2>{0.609314084f, 0.184957638f},
-std::array<float,2>{0.41639778f, 0.669810891f},
-std::array<float,2>{0.937398851f, 0.950944483f},
-std::array<float,2>{0.134037867f, 0.412174374f},
-std::array<float,2>{0.816750765f, 0.317951918f},
-std::array<float,2>{0.107795991f, 0.84367156f},
-std::array<float,2>{0.652145922f, 0.535128415f},
-std::array<float,2>{0.338335037f, 0.120065711f},
-std::array<float,2>{0.501342952f, 0.266841441f},
-std::array<float,2>{0.487353086f, 0.759434819f},
-std::array<float,2>{0.970648348f, 0.589464486f},
-std::array<float,2>{0.223745555f, 0.0401212834f},
-std::array<float,2>{0.797472298f, 0.19310461f},
-std::array<float,2>{0.0465891473f, 0.703817844f},
-std::array<float,2>{0.716442466f, 0.915743887f},
-std::array<float,2>{0.282581538f, 0.442257553f},
-std::array<float,2>{0.6847229f, 0.0805119723f},
-std::array<float,2>{0.343871027f, 0.52754873f},
-std::array<float,2>{0.873496115f, 0.860004485f},
-std::array<float,2>{0.0837538242f, 0.35895294f},
-std::array<float,2>{0.900549769f, 0.377427071f},
-std::array<float,2>{0.172228068f, 0.996006906f},
-std::array<float,2>{0.58653605f, 0.631583691f},
-std::array<float,2>{0.381452888f, 0.154756218f},
-std::array<float,2>{0.594664752f, 0.492761403f},
-std::array<float,2>{0.408494979f, 0.876303494f},
-std::array<float,2>{0.928188264f, 0.725071073f},
-std::array<float,2>{0.130323306f, 0.238996282f},
-std::array<float,2>{0.822751701f, 0.0281247888f},
-std::array<float,2>{0.0971776545f, 0.59728384f},
-std::array<float,2>{0.644728959f, 0.784337163f},
-std::array<float,2>{0.330219239f, 0.285284489f},
-std::array<float,2>{0.723052561f, 0.170764759f},
-std::array<float,2>{0.280986637f, 0.6857934f},
-std::array<float,2>{0.776700437f, 0.958516181f},
-std::array<float,2>{0.0263002086f, 0.426204771f},
-std::array<float,2>{0.944506168f, 0.334285557f},
-std::array<float,2>{0.188159436f, 0.819767237f},
-std::array<float,2>{0.544764996f, 0.555731952f},
-std::array<float,2>{0.439269245f, 0.106301539f},
-std::array<float,2>{0.675896168f, 0.250064135f},
-std::array<float,2>{0.355806351f, 0.772710323f},
-std::array<float,2>{0.861966312f, 0.568712473f},
-std::array<float,2>{0.0932875946f, 0.0523283966f},
-std::array<float,2>{0.896829784f, 0.21381171f},
-std::array<float,2>{0.185583189f, 0.700576067f},
-std::array<float,2>{0.580408394f, 0.928214967f},
-std::array<float,2>{0.386083513f, 0.461174339f},
-std::array<float,2>{0.512157798f, 0.0730703101f},
-std::array<float,2>{0.495983392f, 0.510015666f},
-std::array<float,2>{0.982313812f, 0.844102204f},
-std::array<float,2>{0.233344331f, 0.365601093f},
-std::array<float,2>{0.809047103f, 0.39631477f},
-std::array<float,2>{0.033853434f, 0.979551494f},
-std::array<float,2>{0.709088147f, 0.653113067f},
-std::array<float,2>{0.289847314f, 0.137999848f},
-std::array<float,2>{0.692021787f, 0.408828229f},
-std::array<float,2>{0.310834587f, 0.946181417f},
-std::array<float,2>{0.786164165f, 0.665913105f},
-std::array<float,2>{0.0522455126f, 0.182185963f},
-std::array<float,2>{0.986059546f, 0.121695504f},
-std::array<float,2>{0.2427084f, 0.538583338f},
-std::array<float,2>{0.525538683f, 0.837943375f},
-std::array<float,2>{0.477895081f, 0.314799011f},
-std::array<float,2>{0.577203929f, 0.227441818f},
-std::array<float,2>{0.397384197f, 0.74146688f},
-std::array<float,2>{0.880842447f, 0.892708123f},
-std::array<float,2>{0.170185611f, 0.479443789f},
-std::array<float,2>{0.855538547f, 0.298523813f},
-std::array<float,2>{0.0755260587f, 0.80916369f},
-std::array<float,2>{0.666334867f, 0.6165483f},
-std::array<float,2>{0.363411367f, 0.00137130544f},
-std::array<float,2>{0.559496343f, 0.354762673f},
-std::array<float,2>{0.468271673f, 0.86581552f},
-std::array<float,2>{0.958470166f, 0.524402797f},
-std::array<float,2>{0.206221074f, 0.0839854479f},
-std::array<float,2>{0.762428343f, 0.151465788f},
-std::array<float,2>{0.0105162561f, 0.625074983f},
-std::array<float,2>{0.74814713f, 0.998909652f},
-std::array<float,2>{0.260523856f, 0.381161332f},
-std::array<float,2>{0.637872219f, 0.0433176644f},
-std::array<float,2>{0.312517554f, 0.592427492f},
-std::array<float,2>{0.831773341f, 0.764896512f},
-std::array<float,2>{0.118401796f, 0.273205221f},
-std::array<float,2>{0.921760738f, 0.4397479f},
-std::array<float,2>{0.151104853f, 0.919629037f},
-std::array<float,2>{0.622603357f, 0.707758009f},
-std::array<float,2>{0.429226875f, 0.189552024f},
-std::array<float,2>{0.520066202f, 0.387931406f},
-std::array<float,2>{0.470385134f, 0.987781584f},
-std::array<float,2>{0.99509573f, 0.633238196f},
-std::array<float,2>{0.240318239f, 0.148420647f},
-std::array<float,2>{0.795968473f, 0.0875832066f},
-std::array<float,2>{0.0572451204f, 0.51708281f},
-std::array<float,2>{0.696465135f, 0.868406355f},
-std::array<float,2>{0.299309313f, 0.344116092f},
-std::array<float,2>{0.657227278f, 0.195491478f},
-std::array<float,2>{0.37495321f, 0.716530085f},
-std::array<float,2>{0.849764943f, 0.913124859f},
-std::array<float,2>{0.0663539022f, 0.449697584f},
-std::array<float,2>{0.885944605f, 0.279717386f},
-std::array<float,2>{0.156471923f, 0.757346988f},
-std::array<float,2>{0.567323625f, 0.584184587f},
-std::array<float,2>{0.404384762f, 0.0360277817f},
-std::array<float,2>{0.736635208f, 0.320775777f},
-std::array<float,2>{0.256112158f, 0.833240926f},
-std::array<float,2>{0.757635891f, 0.540964782f},
-std::array<float,2>{0.00276706205f, 0.115366913f},
-std::array<float,2>{0.966105163f, 0.176701024f},
-std::array<float,2>{0.216477692f, 0.658297062f},
-std::array<float,2>{0.547174573f, 0.945086658f},
-std::array<float,2>{0.460932881f, 0.421459466f},
-std::array<float,2>{0.614081264f, 0.00813243445f},
-std::array<float,2>{0.432576954f, 0.619148731f},
-std::array<float,2>{0.91018641f, 0.799605429f},
-std::array<float,2>{0.145570606f, 0.31170705f},
-std::array<float,2>{0.840047836f, 0.475684911f},
-std::array<float,2>{0.116653837f, 0.904731214f},
-std::array<float,2>{0.627135515f, 0.747759044f},
-std::array<float,2>{0.326412976f, 0.219697252f},
-std::array<float,2>{0.653727353f, 0.458580852f},
-std::array<float,2>{0.342925727f, 0.932084441f},
-std::array<float,2>{0.813686967f, 0.694503307f},
-std::array<float,2>{0.103388816f, 0.206157908f},
-std::array<float,2>{0.931876957f, 0.0597437546f},
-std::array<float,2>{0.137112156f, 0.575052738f},
-std::array<float,2>{0.605029523f, 0.774722993f},
-std::array<float,2>{0.41994223f, 0.26522857f},
-std::array<float,2>{0.534964085f, 0.129074842f},
-std::array<float,2>{0.449276328f, 0.640700102f},
-std::array<float,2>{0.950556517f, 0.968861759f},
-std::array<float,2>{0.199147597f, 0.404033452f},
-std::array<float,2>{0.767150879f, 0.370355308f},
-std::array<float,2>{0.0215140805f, 0.857096314f},
-std::array<float,2>{0.73238641f, 0.507396996f},
-std::array<float,2>{0.266390085f, 0.0644356683f},
-std::array<float,2>{0.593518615f, 0.291395634f},
-std::array<float,2>{0.375733674f, 0.793035448f},
-std::array<float,2>{0.906196058f, 0.605765879f},
-std::array<float,2>{0.179646492f, 0.020232752f},
-std::array<float,2>{0.868490934f, 0.249032035f},
-std::array<float,2>{0.0794110522f, 0.727094233f},
-std::array<float,2>{0.679728091f, 0.886967421f},
-std::array<float,2>{0.349107444f, 0.490119249f},
-std::array<float,2>{0.713991702f, 0.0974719077f},
-std::array<float,2>{0.287769079f, 0.550910056f},
-std::array<float,2>{0.801215053f, 0.822564363f},
-std::array<float,2>{0.0402033068f, 0.33799848f},
-std::array<float,2>{0.975896955f, 0.43349418f},
-std::array<float,2>{0.219607681f, 0.963156998f},
-std::array<float,2>{0.504476905f, 0.679023981f},
-std::array<float,2>{0.488420874f, 0.15679501f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.946023941f, 0.879728019f},
-std::array<float,2>{0.316841632f, 0.285128415f},
-std::array<float,2>{0.243290007f, 0.595096529f},
-std::array<float,2>{0.557477534f, 0.230856776f},
-std::array<float,2>{0.731391311f, 0.629031539f},
-std::array<float,2>{0.0569854416f, 0.104296446f},
-std::array<float,2>{0.478643209f, 0.802344024f},
-std::array<float,2>{0.859757841f, 0.389112115f},
-std::array<float,2>{0.797298849f, 0.512393653f},
-std::array<float,2>{0.382062733f, 0.134493768f},
-std::array<float,2>{0.106669731f, 0.94476068f},
-std::array<float,2>{0.659668148f, 0.332333863f},
-std::array<float,2>{0.615241885f, 0.863460898f},
-std::array<float,2>{0.143931195f, 0.462161034f},
-std::array<float,2>{0.269983292f, 0.696719229f},
-std::array<float,2>{0.901969612f, 0.0431674533f},
-std::array<float,2>{0.82176125f, 0.769435763f},
-std::array<float,2>{0.454232484f, 0.432411999f},
-std::array<float,2>{0.0174667947f, 0.68667829f},
-std::array<float,2>{0.688073277f, 0.0641682371f},
-std::array<float,2>{0.502721608f, 0.569070816f},
-std::array<float,2>{0.199061707f, 0.212844938f},
-std::array<float,2>{0.373446792f, 0.912970006f},
-std::array<float,2>{0.97983104f, 0.260855615f},
-std::array<float,2>{0.915041625f, 0.730603278f},
-std::array<float,2>{0.284188896f, 0.00815309212f},
-std::array<float,2>{0.160671085f, 0.841972411f},
-std::array<float,2>{0.590643585f, 0.470411658f},
-std::array<float,2>{0.650853097f, 0.995980978f},
-std::array<float,2>{0.0667680129f, 0.356484473f},
-std::array<float,2>{0.418281794f, 0.562060356f},
-std::array<float,2>{0.767448187f, 0.157027006f},
-std::array<float,2>{0.888535559f, 0.814484179f},
-std::array<float,2>{0.262619764f, 0.485465258f},
-std::array<float,2>{0.132576764f, 0.737199306f},
-std::array<float,2>{0.594998062f, 0.023254104f},
-std::array<float,2>{0.682402074f, 0.542689681f},
-std::array<float,2>{0.119124383f, 0.186297998f},
-std::array<float,2>{0.396552682f, 0.970432103f},
-std::array<float,2>{0.792040288f, 0.372978985f},
-std::array<float,2>{0.846341074f, 0.665545285f},
-std::array<float,2>{0.49505803f, 0.0787704512f},
-std::array<float,2>{0.0415798724f, 0.758071125f},
-std::array<float,2>{0.740928888f, 0.418799788f},
-std::array<float,2>{0.534848988f, 0.923166096f},
-std::array<float,2>{0.229054719f, 0.275463879f},
-std::array<float,2>{0.341066062f, 0.579312861f},
-std::array<float,2>{0.964776397f, 0.201141864f},
-std::array<float,2>{0.753990114f, 0.956147134f},
-std::array<float,2>{0.423153728f, 0.321790367f},
-std::array<float,2>{0.0908276886f, 0.523681462f},
-std::array<float,2>{0.635773659f, 0.148472741f},
-std::array<float,2>{0.564033508f, 0.711248577f},
-std::array<float,2>{0.183237717f, 0.0506912395f},
-std::array<float,2>{0.309758842f, 0.852876306f},
-std::array<float,2>{0.936268806f, 0.451447368f},
-std::array<float,2>{0.99418354f, 0.621588945f},
-std::array<float,2>{0.349590093f, 0.242621899f},
-std::array<float,2>{0.211181298f, 0.90616405f},
-std::array<float,2>{0.528294683f, 0.299809843f},
-std::array<float,2>{0.707619011f, 0.787413895f},
-std::array<float,2>{0.012477031f, 0.393508613f},
-std::array<float,2>{0.448448002f, 0.646671236f},
-std::array<float,2>{0.833928525f, 0.124382041f},
-std::array<float,2>{0.925597429f, 0.978509605f},
-std::array<float,2>{0.303752959f, 0.363457352f},
-std::array<float,2>{0.174981609f, 0.532709539f},
-std::array<float,2>{0.576464355f, 0.178153023f},
-std::array<float,2>{0.6285851f, 0.745009363f},
-std::array<float,2>{0.0787024274f, 0.0235333461f},
-std::array<float,2>{0.430450082f, 0.821392536f},
-std::array<float,2>{0.759595692f, 0.492760986f},
-std::array<float,2>{0.836489975f, 0.591757357f},
-std::array<float,2>{0.440711528f, 0.194522411f},
-std::array<float,2>{0.000775320339f, 0.934003413f},
-std::array<float,2>{0.711868107f, 0.26590386f},
-std::array<float,2>{0.518191397f, 0.750705183f},
-std::array<float,2>{0.206231698f, 0.406655103f},
-std::array<float,2>{0.356431872f, 0.659653366f},
-std::array<float,2>{0.985349655f, 0.0888893381f},
-std::array<float,2>{0.785830259f, 0.851434052f},
-std::array<float,2>{0.400834024f, 0.441796035f},
-std::array<float,2>{0.114651039f, 0.709285259f},
-std::array<float,2>{0.676376998f, 0.0622560866f},
-std::array<float,2>{0.607060671f, 0.52148068f},
-std::array<float,2>{0.133047178f, 0.144998968f},
-std::array<float,2>{0.253155619f, 0.961804211f},
-std::array<float,2>{0.876776993f, 0.317454457f},
-std::array<float,2>{0.955917716f, 0.656138599f},
-std::array<float,2>{0.332487285f, 0.111326069f},
-std::array<float,2>{0.219761908f, 0.793092906f},
-std::array<float,2>{0.541280746f, 0.399836153f},
-std::array<float,2>{0.745344102f, 0.897258699f},
-std::array<float,2>{0.0314392261f, 0.308023334f},
-std::array<float,2>{0.491657645f, 0.611895919f},
-std::array<float,2>{0.857530832f, 0.236358911f},
-std::array<float,2>{0.97407496f, 0.810704708f},
-std::array<float,2>{0.365438879f, 0.376711279f},
-std::array<float,2>{0.188037083f, 0.633013189f},
-std::array<float,2>{0.509587288f, 0.0959808156f},
-std::array<float,2>{0.701661229f, 0.603003383f},
-std::array<float,2>{0.0254230816f, 0.220648035f},
-std::array<float,2>{0.461732268f, 0.890601993f},
-std::array<float,2>{0.816896796f, 0.289580911f},
-std::array<float,2>{0.779960871f, 0.689225197f},
-std::array<float,2>{0.412232816f, 0.0369080603f},
-std::array<float,2>{0.0725952685f, 0.873104692f},
-std::array<float,2>{0.64453584f, 0.456528515f},
-std::array<float,2>{0.581281006f, 0.948655128f},
-std::array<float,2>{0.167020589f, 0.337505132f},
-std::array<float,2>{0.292218715f, 0.504268765f},
-std::array<float,2>{0.908092141f, 0.126330122f},
-std::array<float,2>{0.874866784f, 0.916325033f},
-std::array<float,2>{0.471383691f, 0.254513443f},
-std::array<float,2>{0.0481613204f, 0.576137185f},
-std::array<float,2>{0.720072329f, 0.205442831f},
-std::array<float,2>{0.547592878f, 0.678108513f},
-std::array<float,2>{0.241483584f, 0.0765325353f},
-std::array<float,2>{0.323769331f, 0.777076423f},
-std::array<float,2>{0.944972396f, 0.427044481f},
-std::array<float,2>{0.894980133f, 0.548636794f},
-std::array<float,2>{0.277701914f, 0.167742208f},
-std::array<float,2>{0.150575086f, 0.986983657f},
-std::array<float,2>{0.62085849f, 0.350930482f},
-std::array<float,2>{0.66935581f, 0.831707716f},
-std::array<float,2>{0.09638533f, 0.484102905f},
-std::array<float,2>{0.385511398f, 0.718803823f},
-std::array<float,2>{0.808601379f, 0.00773485424f},
-std::array<float,2>{0.990938425f, 0.940921485f},
-std::array<float,2>{0.353505194f, 0.329407573f},
-std::array<float,2>{0.208876416f, 0.508718729f},
-std::array<float,2>{0.520267248f, 0.137166098f},
-std::array<float,2>{0.716275632f, 0.700912833f},
-std::array<float,2>{0.00520719029f, 0.0392562002f},
-std::array<float,2>{0.444624573f, 0.862958133f},
-std::array<float,2>{0.843039691f, 0.467891812f},
-std::array<float,2>{0.764145255f, 0.598353386f},
-std::array<float,2>{0.435912609f, 0.227297217f},
-std::array<float,2>{0.083999455f, 0.876547277f},
-std::array<float,2>{0.63000679f, 0.285510927f},
-std::array<float,2>{0.570793688f, 0.798313856f},
-std::array<float,2>{0.178184673f, 0.385388672f},
-std::array<float,2>{0.299747258f, 0.628215849f},
-std::array<float,2>{0.927176952f, 0.108900771f},
-std::array<float,2>{0.852938831f, 0.837587833f},
-std::array<float,2>{0.487610698f, 0.472828925f},
-std::array<float,2>{0.0355706736f, 0.730188489f},
-std::array<float,2>{0.748619378f, 0.0137619544f},
-std::array<float,2>{0.544438124f, 0.55541724f},
-std::array<float,2>{0.226409003f, 0.163751677f},
-std::array<float,2>{0.329201102f, 0.998261213f},
-std::array<float,2>{0.958134949f, 0.355314344f},
-std::array<float,2>{0.881537378f, 0.680346131f},
-std::array<float,2>{0.25493136f, 0.0664406419f},
-std::array<float,2>{0.138731271f, 0.769631267f},
-std::array<float,2>{0.601923525f, 0.434202641f},
-std::array<float,2>{0.673043549f, 0.906397402f},
-std::array<float,2>{0.110350095f, 0.26385653f},
-std::array<float,2>{0.405782729f, 0.565165699f},
-std::array<float,2>{0.784668326f, 0.215901628f},
-std::array<float,2>{0.911255121f, 0.764129221f},
-std::array<float,2>{0.294837028f, 0.4158521f},
-std::array<float,2>{0.171122983f, 0.668470263f},
-std::array<float,2>{0.584898949f, 0.0851781517f},
-std::array<float,2>{0.641047597f, 0.584067881f},
-std::array<float,2>{0.0769337416f, 0.195723653f},
-std::array<float,2>{0.408345491f, 0.928686917f},
-std::array<float,2>{0.773541212f, 0.278267831f},
-std::array<float,2>{0.814796388f, 0.741636336f},
-std::array<float,2>{0.466305315f, 0.0182109997f},
-std::array<float,2>{0.030689016f, 0.819196284f},
-std::array<float,2>{0.695706069f, 0.488757312f},
-std::array<float,2>{0.512059748f, 0.97464627f},
-std::array<float,2>{0.19206813f, 0.370973498f},
-std::array<float,2>{0.359752327f, 0.546280742f},
-std::array<float,2>{0.969857335f, 0.180137157f},
-std::array<float,2>{0.805925071f, 0.900003076f},
-std::array<float,2>{0.387736887f, 0.302074164f},
-std::array<float,2>{0.100756146f, 0.619223952f},
-std::array<float,2>{0.664216161f, 0.248438954f},
-std::array<float,2>{0.622253954f, 0.643225431f},
-std::array<float,2>{0.154737771f, 0.117549703f},
-std::array<float,2>{0.276588082f, 0.784382105f},
-std::array<float,2>{0.894139886f, 0.397508442f},
-std::array<float,2>{0.938693464f, 0.530705631f},
-std::array<float,2>{0.325714231f, 0.153522566f},
-std::array<float,2>{0.235023335f, 0.960785866f},
-std::array<float,2>{0.553116739f, 0.327334106f},
-std::array<float,2>{0.723796129f, 0.857577682f},
-std::array<float,2>{0.0515648127f, 0.446557373f},
-std::array<float,2>{0.476364702f, 0.715750098f},
-std::array<float,2>{0.870436192f, 0.0542291701f},
-std::array<float,2>{0.902932882f, 0.931462765f},
-std::array<float,2>{0.266758621f, 0.27237764f},
-std::array<float,2>{0.1484171f, 0.588028669f},
-std::array<float,2>{0.611396849f, 0.189230233f},
-std::array<float,2>{0.66138047f, 0.662458479f},
-std::array<float,2>{0.102137581f, 0.0927324742f},
-std::array<float,2>{0.37771821f, 0.757088959f},
-std::array<float,2>{0.80434835f, 0.411370575f},
-std::array<float,2>{0.865813434f, 0.536068797f},
-std::array<float,2>{0.48429817f, 0.172833368f},
-std::array<float,2>{0.059140984f, 0.98140645f},
-std::array<float,2>{0.729189813f, 0.362354189f},
-std::array<float,2>{0.560711324f, 0.826279998f},
-std::array<float,2>{0.247116372f, 0.498786867f},
-std::array<float,2>{0.313909501f, 0.7484411f},
-std::array<float,2>{0.951767027f, 0.0309854094f},
-std::array<float,2>{0.770082891f, 0.78908217f},
-std::array<float,2>{0.417495728f, 0.403764307f},
-std::array<float,2>{0.0649994761f, 0.651453674f},
-std::array<float,2>{0.655335367f, 0.113411717f},
-std::array<float,2>{0.587940037f, 0.61532253f},
-std::array<float,2>{0.158032686f, 0.241567373f},
-std::array<float,2>{0.285287261f, 0.892605066f},
-std::array<float,2>{0.921424985f, 0.312499076f},
-std::array<float,2>{0.982970953f, 0.706289887f},
-std::array<float,2>{0.36865899f, 0.0563688017f},
-std::array<float,2>{0.202446461f, 0.845510066f},
-std::array<float,2>{0.507537544f, 0.43779543f},
-std::array<float,2>{0.69369936f, 0.9661268f},
-std::array<float,2>{0.0213373806f, 0.313988239f},
-std::array<float,2>{0.460557699f, 0.518333375f},
-std::array<float,2>{0.824865937f, 0.142572388f},
-std::array<float,2>{0.968340814f, 0.870448112f},
-std::array<float,2>{0.338447273f, 0.459467411f},
-std::array<float,2>{0.230516627f, 0.694667339f},
-std::array<float,2>{0.538862944f, 0.0329852104f},
-std::array<float,2>{0.736742079f, 0.501340449f},
-std::array<float,2>{0.0448213965f, 0.130166665f},
-std::array<float,2>{0.497500896f, 0.949837208f},
-std::array<float,2>{0.849458456f, 0.342125326f},
-std::array<float,2>{0.794481277f, 0.639636219f},
-std::array<float,2>{0.391338974f, 0.0994968489f},
-std::array<float,2>{0.123416737f, 0.8051337f},
-std::array<float,2>{0.686033189f, 0.380985081f},
-std::array<float,2>{0.600975871f, 0.884092271f},
-std::array<float,2>{0.125800401f, 0.296132684f},
-std::array<float,2>{0.25889501f, 0.606718421f},
-std::array<float,2>{0.884296954f, 0.224032164f},
-std::array<float,2>{0.830507755f, 0.990785539f},
-std::array<float,2>{0.450216919f, 0.346164167f},
-std::array<float,2>{0.00916726515f, 0.552835345f},
-std::array<float,2>{0.705380797f, 0.16898647f},
-std::array<float,2>{0.526510179f, 0.725816786f},
-std::array<float,2>{0.215353638f, 0.00231439457f},
-std::array<float,2>{0.346651942f, 0.833353341f},
-std::array<float,2>{0.999160886f, 0.477258563f},
-std::array<float,2>{0.932006478f, 0.573311031f},
-std::array<float,2>{0.308146596f, 0.209615171f},
-std::array<float,2>{0.187241673f, 0.919494629f},
-std::array<float,2>{0.569048464f, 0.252543092f},
-std::array<float,2>{0.639931619f, 0.78008604f},
-std::array<float,2>{0.0877865553f, 0.422869831f},
-std::array<float,2>{0.428277373f, 0.674058795f},
-std::array<float,2>{0.753393888f, 0.0725046471f},
-std::array<float,2>{0.977228284f, 0.910663903f},
-std::array<float,2>{0.371403307f, 0.259140432f},
-std::array<float,2>{0.196708485f, 0.566964269f},
-std::array<float,2>{0.50089699f, 0.214772537f},
-std::array<float,2>{0.690480113f, 0.684678197f},
-std::array<float,2>{0.0187924337f, 0.0645805895f},
-std::array<float,2>{0.4566558f, 0.76700443f},
-std::array<float,2>{0.823092997f, 0.431293279f},
-std::array<float,2>{0.76935637f, 0.558627129f},
-std::array<float,2>{0.421480864f, 0.158250034f},
-std::array<float,2>{0.0686724856f, 0.993813097f},
-std::array<float,2>{0.648733318f, 0.359042764f},
-std::array<float,2>{0.591996253f, 0.840724051f},
-std::array<float,2>{0.162305534f, 0.472584039f},
-std::array<float,2>{0.282174408f, 0.733670712f},
-std::array<float,2>{0.917869806f, 0.0114768809f},
-std::array<float,2>{0.861939549f, 0.803932965f},
-std::array<float,2>{0.477915436f, 0.387677759f},
-std::array<float,2>{0.0546888001f, 0.630933464f},
-std::array<float,2>{0.734354496f, 0.101603493f},
-std::array<float,2>{0.555021048f, 0.596043587f},
-std::array<float,2>{0.244919226f, 0.233407706f},
-std::array<float,2>{0.319570333f, 0.881141663f},
-std::array<float,2>{0.947270095f, 0.281912684f},
-std::array<float,2>{0.898904026f, 0.698557198f},
-std::array<float,2>{0.272644371f, 0.0458621904f},
-std::array<float,2>{0.140770689f, 0.867139161f},
-std::array<float,2>{0.614067852f, 0.464525849f},
-std::array<float,2>{0.65674758f, 0.943085372f},
-std::array<float,2>{0.108378582f, 0.334154129f},
-std::array<float,2>{0.380638421f, 0.515584707f},
-std::array<float,2>{0.800756872f, 0.135226458f},
-std::array<float,2>{0.9337672f, 0.854846001f},
-std::array<float,2>{0.310784459f, 0.449218929f},
-std::array<float,2>{0.181357279f, 0.713380039f},
-std::array<float,2>{0.565516353f, 0.0484191552f},
-std::array<float,2>{0.634568155f, 0.526457191f},
-std::array<float,2>{0.0930461437f, 0.152332813f},
-std::array<float,2>{0.424666107f, 0.953294396f},
-std::array<float,2>{0.756352186f, 0.323372632f},
-std::array<float,2>{0.834462166f, 0.645186722f},
-std::array<float,2>{0.446097314f, 0.122938819f},
-std::array<float,2>{0.0139391553f, 0.787060916f},
-std::array<float,2>{0.710423112f, 0.391850799f},
-std::array<float,2>{0.530944884f, 0.902774453f},
-std::array<float,2>{0.213119224f, 0.298346043f},
-std::array<float,2>{0.350485504f, 0.623503685f},
-std::array<float,2>{0.992326677f, 0.245840773f},
-std::array<float,2>{0.790071905f, 0.971194923f},
-std::array<float,2>{0.395246923f, 0.374409139f},
-std::array<float,2>{0.119450852f, 0.539239585f},
-std::array<float,2>{0.681212187f, 0.183899611f},
-std::array<float,2>{0.596819282f, 0.734490991f},
-std::array<float,2>{0.129870906f, 0.0203958713f},
-std::array<float,2>{0.264069676f, 0.812953293f},
-std::array<float,2>{0.889660358f, 0.487277836f},
-std::array<float,2>{0.962065041f, 0.581731617f},
-std::array<float,2>{0.34354493f, 0.201568902f},
-std::array<float,2>{0.228451356f, 0.925608158f},
-std::array<float,2>{0.531512499f, 0.274843693f},
-std::array<float,2>{0.739896894f, 0.760742724f},
-std::array<float,2>{0.0408325531f, 0.420082688f},
-std::array<float,2>{0.493208706f, 0.666567326f},
-std::array<float,2>{0.845234394f, 0.0813081786f},
-std::array<float,2>{0.878627479f, 0.963310421f},
-std::array<float,2>{0.25096333f, 0.320281982f},
-std::array<float,2>{0.136505753f, 0.523403466f},
-std::array<float,2>{0.609098911f, 0.147112951f},
-std::array<float,2>{0.678967714f, 0.70892185f},
-std::array<float,2>{0.115446098f, 0.060464073f},
-std::array<float,2>{0.399073064f, 0.849141538f},
-std::array<float,2>{0.787558317f, 0.444240779f},
-std::array<float,2>{0.856804729f, 0.611153066f},
-std::array<float,2>{0.488751262f, 0.234922379f},
-std::array<float,2>{0.0341058336f, 0.895792425f},
-std::array<float,2>{0.743534088f, 0.306189746f},
-std::array<float,2>{0.539159656f, 0.79551357f},
-std::array<float,2>{0.221572056f, 0.401854932f},
-std::array<float,2>{0.334726751f, 0.65405786f},
-std::array<float,2>{0.953195572f, 0.112951986f},
-std::array<float,2>{0.760366261f, 0.824184477f},
-std::array<float,2>{0.432329744f, 0.494550526f},
-std::array<float,2>{0.0814566389f, 0.743321121f},
-std::array<float,2>{0.625783086f, 0.0263622906f},
-std::array<float,2>{0.574457943f, 0.533690512f},
-std::array<float,2>{0.173515573f, 0.176298425f},
-std::array<float,2>{0.301502258f, 0.979223192f},
-std::array<float,2>{0.922315776f, 0.366812974f},
-std::array<float,2>{0.987282336f, 0.656305134f},
-std::array<float,2>{0.357593387f, 0.0872378945f},
-std::array<float,2>{0.204411656f, 0.753371358f},
-std::array<float,2>{0.515965044f, 0.408961207f},
-std::array<float,2>{0.713540971f, 0.936715722f},
-std::array<float,2>{0.00220733252f, 0.268000454f},
-std::array<float,2>{0.439086169f, 0.592922509f},
-std::array<float,2>{0.838028967f, 0.193217993f},
-std::array<float,2>{0.942942202f, 0.774739206f},
-std::array<float,2>{0.321138352f, 0.428444177f},
-std::array<float,2>{0.238888413f, 0.677188158f},
-std::array<float,2>{0.549186528f, 0.0758539438f},
-std::array<float,2>{0.722232819f, 0.577930391f},
-std::array<float,2>{0.0490160994f, 0.204955444f},
-std::array<float,2>{0.468835145f, 0.915373564f},
-std::array<float,2>{0.871346951f, 0.257454753f},
-std::array<float,2>{0.811202228f, 0.720714808f},
-std::array<float,2>{0.383063704f, 0.00488200504f},
-std::array<float,2>{0.0946385339f, 0.829097211f},
-std::array<float,2>{0.6712569f, 0.481931686f},
-std::array<float,2>{0.618777037f, 0.985504627f},
-std::array<float,2>{0.148457721f, 0.348968029f},
-std::array<float,2>{0.280367553f, 0.55014956f},
-std::array<float,2>{0.898293793f, 0.164665103f},
-std::array<float,2>{0.819038808f, 0.888461173f},
-std::array<float,2>{0.463674337f, 0.291260958f},
-std::array<float,2>{0.0235718433f, 0.604055047f},
-std::array<float,2>{0.701042116f, 0.221703172f},
-std::array<float,2>{0.511489987f, 0.634869993f},
-std::array<float,2>{0.190840274f, 0.0944398493f},
-std::array<float,2>{0.36365059f, 0.809337735f},
-std::array<float,2>{0.975594878f, 0.378011674f},
-std::array<float,2>{0.908636868f, 0.507754505f},
-std::array<float,2>{0.290023386f, 0.12792632f},
-std::array<float,2>{0.164289311f, 0.945980191f},
-std::array<float,2>{0.578774273f, 0.339722723f},
-std::array<float,2>{0.648087144f, 0.872217655f},
-std::array<float,2>{0.0721412078f, 0.454231858f},
-std::array<float,2>{0.411480576f, 0.689579368f},
-std::array<float,2>{0.778185666f, 0.0375629812f},
-std::array<float,2>{0.960760117f, 0.997040927f},
-std::array<float,2>{0.330454171f, 0.353420317f},
-std::array<float,2>{0.223796234f, 0.558111787f},
-std::array<float,2>{0.546308994f, 0.160650089f},
-std::array<float,2>{0.746492684f, 0.727376878f},
-std::array<float,2>{0.0375972502f, 0.0135134021f},
-std::array<float,2>{0.484721303f, 0.838519394f},
-std::array<float,2>{0.853949249f, 0.474749327f},
-std::array<float,2>{0.783017159f, 0.563889384f},
-std::array<float,2>{0.403356135f, 0.21837163f},
-std::array<float,2>{0.112623021f, 0.909532845f},
-std::array<float,2>{0.675439954f, 0.263478011f},
-std::array<float,2>{0.604528666f, 0.771869719f},
-std::array<float,2>{0.138406828f, 0.436113685f},
-std::array<float,2>{0.255964309f, 0.682405233f},
-std::array<float,2>{0.880504608f, 0.0696841478f},
-std::array<float,2>{0.84000963f, 0.859980762f},
-std::array<float,2>{0.442260623f, 0.46678406f},
-std::array<float,2>{0.0064912797f, 0.702062786f},
-std::array<float,2>{0.718732297f, 0.0425748713f},
-std::array<float,2>{0.522076428f, 0.511059225f},
-std::array<float,2>{0.209138215f, 0.13979511f},
-std::array<float,2>{0.354571015f, 0.938302338f},
-std::array<float,2>{0.989435852f, 0.331201494f},
-std::array<float,2>{0.927759409f, 0.62636739f},
-std::array<float,2>{0.297636211f, 0.10656815f},
-std::array<float,2>{0.175914675f, 0.799248636f},
-std::array<float,2>{0.573922932f, 0.383050889f},
-std::array<float,2>{0.632157683f, 0.876984775f},
-std::array<float,2>{0.0835939795f, 0.28845787f},
-std::array<float,2>{0.434655368f, 0.600091696f},
-std::array<float,2>{0.762156606f, 0.230298147f},
-std::array<float,2>{0.890791237f, 0.782916844f},
-std::array<float,2>{0.273670137f, 0.395368189f},
-std::array<float,2>{0.153715059f, 0.640809178f},
-std::array<float,2>{0.624955297f, 0.120711572f},
-std::array<float,2>{0.667713106f, 0.617754698f},
-std::array<float,2>{0.0986701474f, 0.247244909f},
-std::array<float,2>{0.389602214f, 0.901343465f},
-std::array<float,2>{0.808001339f, 0.304098278f},
-std::array<float,2>{0.86848259f, 0.716908693f},
-std::array<float,2>{0.473908097f, 0.0513583831f},
-std::array<float,2>{0.0530337319f, 0.856473684f},
-std::array<float,2>{0.724816918f, 0.448777974f},
-std::array<float,2>{0.551981211f, 0.958803296f},
-std::array<float,2>{0.237561211f, 0.325008512f},
-std::array<float,2>{0.327880085f, 0.528235137f},
-std::array<float,2>{0.939704537f, 0.155721948f},
-std::array<float,2>{0.777225673f, 0.926284075f},
-std::array<float,2>{0.407537699f, 0.279517263f},
-std::array<float,2>{0.0759276822f, 0.583070338f},
-std::array<float,2>{0.643799007f, 0.197873786f},
-std::array<float,2>{0.583242655f, 0.671420753f},
-std::array<float,2>{0.16870369f, 0.0824761167f},
-std::array<float,2>{0.29656446f, 0.762648642f},
-std::array<float,2>{0.913419127f, 0.417255729f},
-std::array<float,2>{0.972294033f, 0.544891357f},
-std::array<float,2>{0.362048417f, 0.182234198f},
-std::array<float,2>{0.195281506f, 0.974078417f},
-std::array<float,2>{0.514080822f, 0.367465049f},
-std::array<float,2>{0.698333681f, 0.816907525f},
-std::array<float,2>{0.0282152742f, 0.491358578f},
-std::array<float,2>{0.467435896f, 0.739387393f},
-std::array<float,2>{0.814376593f, 0.0174164772f},
-std::array<float,2>{0.918511391f, 0.890843153f},
-std::array<float,2>{0.288832754f, 0.310173899f},
-std::array<float,2>{0.159068868f, 0.613911211f},
-std::array<float,2>{0.587192953f, 0.239150584f},
-std::array<float,2>{0.652717769f, 0.65005815f},
-std::array<float,2>{0.0642974079f, 0.116929114f},
-std::array<float,2>{0.414121687f, 0.791137218f},
-std::array<float,2>{0.771791816f, 0.405959845f},
-std::array<float,2>{0.82767719f, 0.51737684f},
-std::array<float,2>{0.45714739f, 0.143312782f},
-std::array<float,2>{0.0217369255f, 0.967179954f},
-std::array<float,2>{0.69171232f, 0.315267682f},
-std::array<float,2>{0.504636765f, 0.84686017f},
-std::array<float,2>{0.199475601f, 0.440372348f},
-std::array<float,2>{0.370001584f, 0.704466045f},
-std::array<float,2>{0.981403589f, 0.057448376f},
-std::array<float,2>{0.800971687f, 0.754173279f},
-std::array<float,2>{0.375580758f, 0.413620323f},
-std::array<float,2>{0.105323397f, 0.661718905f},
-std::array<float,2>{0.663714945f, 0.0899258256f},
-std::array<float,2>{0.610255241f, 0.587228775f},
-std::array<float,2>{0.145957842f, 0.190569952f},
-std::array<float,2>{0.26935026f, 0.933108509f},
-std::array<float,2>{0.904793203f, 0.270454556f},
-std::array<float,2>{0.949339151f, 0.746933579f},
-std::array<float,2>{0.31574738f, 0.0281134266f},
-std::array<float,2>{0.249714717f, 0.826021671f},
-std::array<float,2>{0.559781075f, 0.497035593f},
-std::array<float,2>{0.727592111f, 0.982469082f},
-std::array<float,2>{0.0624074265f, 0.36100632f},
-std::array<float,2>{0.482129991f, 0.538818002f},
-std::array<float,2>{0.864702642f, 0.174213812f},
-std::array<float,2>{0.997433782f, 0.835212052f},
-std::array<float,2>{0.345455915f, 0.480169147f},
-std::array<float,2>{0.216951445f, 0.72271198f},
-std::array<float,2>{0.525310457f, 0.000466859026f},
-std::array<float,2>{0.703436017f, 0.552136183f},
-std::array<float,2>{0.0109782042f, 0.170446604f},
-std::array<float,2>{0.452552348f, 0.988711119f},
-std::array<float,2>{0.828272223f, 0.34544611f},
-std::array<float,2>{0.750681639f, 0.673575938f},
-std::array<float,2>{0.42752105f, 0.0709749907f},
-std::array<float,2>{0.088834174f, 0.778709888f},
-std::array<float,2>{0.637533844f, 0.424947172f},
-std::array<float,2>{0.566880643f, 0.919925094f},
-std::array<float,2>{0.18444702f, 0.251870066f},
-std::array<float,2>{0.304878563f, 0.571287632f},
-std::array<float,2>{0.931627691f, 0.208000749f},
-std::array<float,2>{0.85047245f, 0.951485634f},
-std::array<float,2>{0.498489588f, 0.340602666f},
-std::array<float,2>{0.0455516241f, 0.50221324f},
-std::array<float,2>{0.736182332f, 0.131094828f},
-std::array<float,2>{0.536759675f, 0.692337573f},
-std::array<float,2>{0.233707815f, 0.033839751f},
-std::array<float,2>{0.33657673f, 0.868517697f},
-std::array<float,2>{0.966599762f, 0.457204998f},
-std::array<float,2>{0.884893656f, 0.608878911f},
-std::array<float,2>{0.260236144f, 0.224679843f},
-std::array<float,2>{0.127114609f, 0.885863543f},
-std::array<float,2>{0.59809202f, 0.29351759f},
-std::array<float,2>{0.685069501f, 0.808317125f},
-std::array<float,2>{0.12289983f, 0.380805314f},
-std::array<float,2>{0.392918438f, 0.638258278f},
-std::array<float,2>{0.795977354f, 0.100580394f},
-std::array<float,2>{0.963691175f, 0.924119711f},
-std::array<float,2>{0.340649992f, 0.274306983f},
-std::array<float,2>{0.229643643f, 0.580903649f},
-std::array<float,2>{0.533670723f, 0.202823177f},
-std::array<float,2>{0.741567969f, 0.66787529f},
-std::array<float,2>{0.0423309691f, 0.080771558f},
-std::array<float,2>{0.496040136f, 0.760042965f},
-std::array<float,2>{0.847333789f, 0.421001077f},
-std::array<float,2>{0.791927874f, 0.540941894f},
-std::array<float,2>{0.39750728f, 0.184768513f},
-std::array<float,2>{0.118031822f, 0.971793234f},
-std::array<float,2>{0.683205068f, 0.37362811f},
-std::array<float,2>{0.594042897f, 0.813523471f},
-std::array<float,2>{0.131387576f, 0.487734824f},
-std::array<float,2>{0.262731314f, 0.736208677f},
-std::array<float,2>{0.887552679f, 0.0211458374f},
-std::array<float,2>{0.83216238f, 0.785924435f},
-std::array<float,2>{0.448012859f, 0.391521007f},
-std::array<float,2>{0.0133443996f, 0.645911098f},
-std::array<float,2>{0.708248973f, 0.121732399f},
-std::array<float,2>{0.529137671f, 0.624595463f},
-std::array<float,2>{0.212693274f, 0.244354472f},
-std::array<float,2>{0.347739697f, 0.903368592f},
-std::array<float,2>{0.995975673f, 0.297666281f},
-std::array<float,2>{0.93697536f, 0.71469003f},
-std::array<float,2>{0.309455425f, 0.0477548167f},
-std::array<float,2>{0.182418332f, 0.854358792f},
-std::array<float,2>{0.563377142f, 0.451055378f},
-std::array<float,2>{0.635041058f, 0.95474261f},
-std::array<float,2>{0.090082407f, 0.322868437f},
-std::array<float,2>{0.42207098f, 0.526142657f},
-std::array<float,2>{0.755016327f, 0.151265681f},
-std::array<float,2>{0.900696397f, 0.866005003f},
-std::array<float,2>{0.270964772f, 0.463783205f},
-std::array<float,2>{0.142762646f, 0.697429359f},
-std::array<float,2>{0.616779983f, 0.0467423163f},
-std::array<float,2>{0.658757985f, 0.514194787f},
-std::array<float,2>{0.106418937f, 0.135914564f},
-std::array<float,2>{0.381541073f, 0.94191128f},
-std::array<float,2>{0.797917724f, 0.3354626f},
-std::array<float,2>{0.860435605f, 0.632285118f},
-std::array<float,2>{0.479568064f, 0.103120252f},
-std::array<float,2>{0.0576962866f, 0.803672373f},
-std::array<float,2>{0.731855989f, 0.387938738f},
-std::array<float,2>{0.558066666f, 0.881930649f},
-std::array<float,2>{0.242307693f, 0.283106387f},
-std::array<float,2>{0.317475259f, 0.597369015f},
-std::array<float,2>{0.946753144f, 0.23323901f},
-std::array<float,2>{0.766520202f, 0.992203474f},
-std::array<float,2>{0.419459283f, 0.357427746f},
-std::array<float,2>{0.0682810098f, 0.56006819f},
-std::array<float,2>{0.652036369f, 0.159292862f},
-std::array<float,2>{0.590851307f, 0.732700109f},
-std::array<float,2>{0.161258653f, 0.0102248816f},
-std::array<float,2>{0.283343226f, 0.841429532f},
-std::array<float,2>{0.914707124f, 0.471283942f},
-std::array<float,2>{0.979464471f, 0.568092406f},
-std::array<float,2>{0.374649256f, 0.213137999f},
-std::array<float,2>{0.197501287f, 0.91199249f},
-std::array<float,2>{0.50375694f, 0.257996053f},
-std::array<float,2>{0.689186335f, 0.76650703f},
-std::array<float,2>{0.0160623938f, 0.430642426f},
-std::array<float,2>{0.45402649f, 0.68456161f},
-std::array<float,2>{0.821283877f, 0.0660692602f},
-std::array<float,2>{0.906956315f, 0.946555912f},
-std::array<float,2>{0.291509569f, 0.338360816f},
-std::array<float,2>{0.166252643f, 0.50679642f},
-std::array<float,2>{0.580908895f, 0.128229916f},
-std::array<float,2>{0.645915091f, 0.691301823f},
-std::array<float,2>{0.0732585564f, 0.0383115634f},
-std::array<float,2>{0.413852662f, 0.871292591f},
-std::array<float,2>{0.780810833f, 0.454094827f},
-std::array<float,2>{0.817673922f, 0.605238497f},
-std::array<float,2>{0.462714136f, 0.221334159f},
-std::array<float,2>{0.0266747139f, 0.887605846f},
-std::array<float,2>{0.702393115f, 0.292085648f},
-std::array<float,2>{0.507902205f, 0.810061932f},
-std::array<float,2>{0.189293727f, 0.377031654f},
-std::array<float,2>{0.366678298f, 0.635895014f},
-std::array<float,2>{0.973153949f, 0.0954433978f},
-std::array<float,2>{0.809987009f, 0.829438031f},
-std::array<float,2>{0.386505932f, 0.481125385f},
-std::array<float,2>{0.0967339724f, 0.721932888f},
-std::array<float,2>{0.668592393f, 0.00497329282f},
-std::array<float,2>{0.619256973f, 0.549318075f},
-std::array<float,2>{0.151894107f, 0.165156335f},
-std::array<float,2>{0.278960437f, 0.985202372f},
-std::array<float,2>{0.896044374f, 0.347822905f},
-std::array<float,2>{0.943589568f, 0.676347673f},
-std::array<float,2>{0.322931081f, 0.0743124783f},
-std::array<float,2>{0.240556419f, 0.77367717f},
-std::array<float,2>{0.548185229f, 0.428744316f},
-std::array<float,2>{0.71900028f, 0.914148986f},
-std::array<float,2>{0.0472353995f, 0.256614417f},
-std::array<float,2>{0.471761286f, 0.576275587f},
-std::array<float,2>{0.873059332f, 0.203372493f},
-std::array<float,2>{0.986258149f, 0.752398014f},
-std::array<float,2>{0.35651952f, 0.409735203f},
-std::array<float,2>{0.20581001f, 0.658061683f},
-std::array<float,2>{0.519423902f, 0.0862953961f},
-std::array<float,2>{0.71282953f, 0.592205048f},
-std::array<float,2>{0.00104101608f, 0.192240313f},
-std::array<float,2>{0.440157622f, 0.936252236f},
-std::array<float,2>{0.837885916f, 0.269067079f},
-std::array<float,2>{0.758427441f, 0.74282223f},
-std::array<float,2>{0.431391895f, 0.0263842884f},
-std::array<float,2>{0.079766579f, 0.822898865f},
-std::array<float,2>{0.627180099f, 0.49542582f},
-std::array<float,2>{0.577747941f, 0.98015213f},
-std::array<float,2>{0.174554497f, 0.365849197f},
-std::array<float,2>{0.303413093f, 0.535059214f},
-std::array<float,2>{0.924537897f, 0.1772663f},
-std::array<float,2>{0.858951628f, 0.895029604f},
-std::array<float,2>{0.490999222f, 0.304703265f},
-std::array<float,2>{0.0324930586f, 0.609475732f},
-std::array<float,2>{0.744339406f, 0.235832006f},
-std::array<float,2>{0.542167246f, 0.652518928f},
-std::array<float,2>{0.219029397f, 0.112116359f},
-std::array<float,2>{0.333035916f, 0.796629846f},
-std::array<float,2>{0.956515908f, 0.400712043f},
-std::array<float,2>{0.875171125f, 0.52221638f},
-std::array<float,2>{0.252468616f, 0.148283064f},
-std::array<float,2>{0.13465181f, 0.964066863f},
-std::array<float,2>{0.606146097f, 0.318778276f},
-std::array<float,2>{0.67678535f, 0.848632634f},
-std::array<float,2>{0.113673903f, 0.444548935f},
-std::array<float,2>{0.401691198f, 0.707796156f},
-std::array<float,2>{0.786203325f, 0.0595485605f},
-std::array<float,2>{0.969272852f, 0.972903192f},
-std::array<float,2>{0.360702008f, 0.368976355f},
-std::array<float,2>{0.192443475f, 0.543573976f},
-std::array<float,2>{0.512712479f, 0.183497801f},
-std::array<float,2>{0.696832597f, 0.739051402f},
-std::array<float,2>{0.0301286224f, 0.0161851961f},
-std::array<float,2>{0.465300322f, 0.817560971f},
-std::array<float,2>{0.816337287f, 0.490477383f},
-std::array<float,2>{0.77482146f, 0.582901716f},
-std::array<float,2>{0.409771651f, 0.19889763f},
-std::array<float,2>{0.0779610872f, 0.927602172f},
-std::array<float,2>{0.642313659f, 0.281029135f},
-std::array<float,2>{0.585781038f, 0.763658822f},
-std::array<float,2>{0.170131832f, 0.416341007f},
-std::array<float,2>{0.29359135f, 0.670011461f},
-std::array<float,2>{0.911099792f, 0.0838844702f},
-std::array<float,2>{0.869802058f, 0.855975628f},
-std::array<float,2>{0.475273699f, 0.447624743f},
-std::array<float,2>{0.0523216315f, 0.718492508f},
-std::array<float,2>{0.723344564f, 0.0524902642f},
-std::array<float,2>{0.553945303f, 0.528840959f},
-std::array<float,2>{0.236325085f, 0.155099556f},
-std::array<float,2>{0.325147688f, 0.957314789f},
-std::array<float,2>{0.938035309f, 0.326052934f},
-std::array<float,2>{0.892911851f, 0.641633034f},
-std::array<float,2>{0.275811613f, 0.119207419f},
-std::array<float,2>{0.156036511f, 0.781602144f},
-std::array<float,2>{0.6216048f, 0.395813107f},
-std::array<float,2>{0.665472507f, 0.90143472f},
-std::array<float,2>{0.100428559f, 0.303484589f},
-std::array<float,2>{0.387098402f, 0.618530154f},
-std::array<float,2>{0.805659533f, 0.246174768f},
-std::array<float,2>{0.925825059f, 0.800212145f},
-std::array<float,2>{0.300201297f, 0.384109586f},
-std::array<float,2>{0.179604381f, 0.625827789f},
-std::array<float,2>{0.572018921f, 0.106416285f},
-std::array<float,2>{0.629559815f, 0.601176798f},
-std::array<float,2>{0.0856588781f, 0.228905365f},
-std::array<float,2>{0.43672964f, 0.877938807f},
-std::array<float,2>{0.765462339f, 0.287248313f},
-std::array<float,2>{0.842554212f, 0.702532768f},
-std::array<float,2>{0.443471372f, 0.0415383913f},
-std::array<float,2>{0.0043734503f, 0.861037672f},
-std::array<float,2>{0.715005934f, 0.465534568f},
-std::array<float,2>{0.521200061f, 0.93895334f},
-std::array<float,2>{0.207218215f, 0.330831915f},
-std::array<float,2>{0.352458686f, 0.510445297f},
-std::array<float,2>{0.991482615f, 0.139553934f},
-std::array<float,2>{0.783491731f, 0.90908587f},
-std::array<float,2>{0.404811472f, 0.262545943f},
-std::array<float,2>{0.111267455f, 0.563270628f},
-std::array<float,2>{0.672530949f, 0.217622325f},
-std::array<float,2>{0.602905571f, 0.68355f},
-std::array<float,2>{0.140149206f, 0.0691796392f},
-std::array<float,2>{0.254564613f, 0.77316612f},
-std::array<float,2>{0.882387578f, 0.436684519f},
-std::array<float,2>{0.957409501f, 0.557245553f},
-std::array<float,2>{0.328553259f, 0.161406949f},
-std::array<float,2>{0.224748969f, 0.997615457f},
-std::array<float,2>{0.543630064f, 0.352480292f},
-std::array<float,2>{0.749917388f, 0.839710176f},
-std::array<float,2>{0.0370340012f, 0.475862175f},
-std::array<float,2>{0.486550808f, 0.728422344f},
-std::array<float,2>{0.852057517f, 0.0119255343f},
-std::array<float,2>{0.882864833f, 0.884915173f},
-std::array<float,2>{0.258631498f, 0.294053227f},
-std::array<float,2>{0.126568615f, 0.607565999f},
-std::array<float,2>{0.599611759f, 0.226216182f},
-std::array<float,2>{0.687154949f, 0.637327075f},
-std::array<float,2>{0.124784641f, 0.101057775f},
-std::array<float,2>{0.391670287f, 0.80749476f},
-std::array<float,2>{0.793216228f, 0.37934947f},
-std::array<float,2>{0.848084271f, 0.503159165f},
-std::array<float,2>{0.496604711f, 0.132449895f},
-std::array<float,2>{0.0437682532f, 0.952494979f},
-std::array<float,2>{0.738178432f, 0.341257662f},
-std::array<float,2>{0.537697613f, 0.867850065f},
-std::array<float,2>{0.231608853f, 0.458883673f},
-std::array<float,2>{0.339137882f, 0.693315923f},
-std::array<float,2>{0.966810524f, 0.0347093791f},
-std::array<float,2>{0.752749324f, 0.77780515f},
-std::array<float,2>{0.429105341f, 0.42387104f},
-std::array<float,2>{0.0864561051f, 0.672207177f},
-std::array<float,2>{0.638932049f, 0.0717276856f},
-std::array<float,2>{0.570229828f, 0.571361244f},
-std::array<float,2>{0.185990974f, 0.208054721f},
-std::array<float,2>{0.306825012f, 0.921112895f},
-std::array<float,2>{0.933472216f, 0.250526905f},
-std::array<float,2>{0.998444617f, 0.723851025f},
-std::array<float,2>{0.346692771f, 0.00150672719f},
-std::array<float,2>{0.216434881f, 0.834016562f},
-std::array<float,2>{0.526294768f, 0.479191631f},
-std::array<float,2>{0.706721246f, 0.989941537f},
-std::array<float,2>{0.0086562708f, 0.343923479f},
-std::array<float,2>{0.449767143f, 0.55149436f},
-std::array<float,2>{0.831120968f, 0.171041712f},
-std::array<float,2>{0.952243388f, 0.825155139f},
-std::array<float,2>{0.313007593f, 0.497328013f},
-std::array<float,2>{0.246806964f, 0.747201562f},
-std::array<float,2>{0.561793387f, 0.0286929663f},
-std::array<float,2>{0.729587078f, 0.537688076f},
-std::array<float,2>{0.0598867238f, 0.175604209f},
-std::array<float,2>{0.482619852f, 0.984029174f},
-std::array<float,2>{0.867056966f, 0.360079527f},
-std::array<float,2>{0.802981555f, 0.660416722f},
-std::array<float,2>{0.378069311f, 0.0908599943f},
-std::array<float,2>{0.103310578f, 0.755854905f},
-std::array<float,2>{0.660953164f, 0.41233024f},
-std::array<float,2>{0.612336576f, 0.932244718f},
-std::array<float,2>{0.14712882f, 0.271394163f},
-std::array<float,2>{0.265965223f, 0.586604893f},
-std::array<float,2>{0.903909445f, 0.190154299f},
-std::array<float,2>{0.82613337f, 0.968447626f},
-std::array<float,2>{0.459588796f, 0.315514594f},
-std::array<float,2>{0.0204666033f, 0.515654743f},
-std::array<float,2>{0.694357932f, 0.143652275f},
-std::array<float,2>{0.506253958f, 0.70343405f},
-std::array<float,2>{0.201277837f, 0.0582463332f},
-std::array<float,2>{0.367850959f, 0.845999062f},
-std::array<float,2>{0.984107852f, 0.440481395f},
-std::array<float,2>{0.920447588f, 0.615127802f},
-std::array<float,2>{0.28650406f, 0.239276126f},
-std::array<float,2>{0.156768456f, 0.891783178f},
-std::array<float,2>{0.5888713f, 0.308717787f},
-std::array<float,2>{0.654758275f, 0.792872965f},
-std::array<float,2>{0.0663691685f, 0.404324859f},
-std::array<float,2>{0.41612795f, 0.648454785f},
-std::array<float,2>{0.771133184f, 0.115775682f},
-std::array<float,2>{0.993737102f, 0.904840052f},
-std::array<float,2>{0.350940377f, 0.299177676f},
-std::array<float,2>{0.214125946f, 0.622436643f},
-std::array<float,2>{0.529769123f, 0.243366033f},
-std::array<float,2>{0.70953387f, 0.647878051f},
-std::array<float,2>{0.0154227959f, 0.123883419f},
-std::array<float,2>{0.44724372f, 0.788585603f},
-std::array<float,2>{0.835848212f, 0.394097835f},
-std::array<float,2>{0.757094622f, 0.524663746f},
-std::array<float,2>{0.424813449f, 0.150130138f},
-std::array<float,2>{0.0918564945f, 0.955261409f},
-std::array<float,2>{0.633604586f, 0.320699066f},
-std::array<float,2>{0.565075815f, 0.852363169f},
-std::array<float,2>{0.180326417f, 0.452393085f},
-std::array<float,2>{0.311569005f, 0.712713361f},
-std::array<float,2>{0.935376465f, 0.0494145751f},
-std::array<float,2>{0.844418228f, 0.758791625f},
-std::array<float,2>{0.492957562f, 0.41936937f},
-std::array<float,2>{0.0396124311f, 0.66434902f},
-std::array<float,2>{0.738454163f, 0.0795541182f},
-std::array<float,2>{0.533145487f, 0.578965008f},
-std::array<float,2>{0.226635128f, 0.199362889f},
-std::array<float,2>{0.342045277f, 0.922674596f},
-std::array<float,2>{0.960981488f, 0.276851654f},
-std::array<float,2>{0.889275491f, 0.738064885f},
-std::array<float,2>{0.265044481f, 0.0224417988f},
-std::array<float,2>{0.13066572f, 0.815565586f},
-std::array<float,2>{0.596044242f, 0.48494643f},
-std::array<float,2>{0.680075586f, 0.968924046f},
-std::array<float,2>{0.120728925f, 0.371522009f},
-std::array<float,2>{0.395935893f, 0.541240454f},
-std::array<float,2>{0.789139986f, 0.187154979f},
-std::array<float,2>{0.916913807f, 0.843382359f},
-std::array<float,2>{0.282782882f, 0.468796194f},
-std::array<float,2>{0.163460821f, 0.731852412f},
-std::array<float,2>{0.592899203f, 0.00935621839f},
-std::array<float,2>{0.650054038f, 0.560870886f},
-std::array<float,2>{0.0698374882f, 0.1573333f},
-std::array<float,2>{0.420201123f, 0.994842112f},
-std::array<float,2>{0.767934263f, 0.355789065f},
-std::array<float,2>{0.823995769f, 0.685634792f},
-std::array<float,2>{0.455219477f, 0.0627213717f},
-std::array<float,2>{0.0182578731f, 0.767695129f},
-std::array<float,2>{0.6902349f, 0.43330428f},
-std::array<float,2>{0.501827538f, 0.913593948f},
-std::array<float,2>{0.195695341f, 0.259977639f},
-std::array<float,2>{0.372826159f, 0.570085347f},
-std::array<float,2>{0.978368938f, 0.211898625f},
-std::array<float,2>{0.798995137f, 0.94354564f},
-std::array<float,2>{0.378954977f, 0.333208352f},
-std::array<float,2>{0.109146908f, 0.513262272f},
-std::array<float,2>{0.65803951f, 0.133630902f},
-std::array<float,2>{0.614370942f, 0.69555676f},
-std::array<float,2>{0.142247662f, 0.0447690822f},
-std::array<float,2>{0.271903545f, 0.864619374f},
-std::array<float,2>{0.900077283f, 0.461535871f},
-std::array<float,2>{0.948542774f, 0.594596803f},
-std::array<float,2>{0.318811983f, 0.2323993f},
-std::array<float,2>{0.245318726f, 0.880708575f},
-std::array<float,2>{0.555709541f, 0.284019262f},
-std::array<float,2>{0.732637823f, 0.801217437f},
-std::array<float,2>{0.0556975044f, 0.390487403f},
-std::array<float,2>{0.476835012f, 0.630090177f},
-std::array<float,2>{0.863163233f, 0.104663268f},
-std::array<float,2>{0.896855533f, 0.988015354f},
-std::array<float,2>{0.28008613f, 0.3501288f},
-std::array<float,2>{0.150358856f, 0.547303736f},
-std::array<float,2>{0.617879152f, 0.166949868f},
-std::array<float,2>{0.670878768f, 0.720254421f},
-std::array<float,2>{0.0948997959f, 0.0067856214f},
-std::array<float,2>{0.384403497f, 0.830423713f},
-std::array<float,2>{0.812491536f, 0.482852936f},
-std::array<float,2>{0.872436583f, 0.574670255f},
-std::array<float,2>{0.4700059f, 0.20701763f},
-std::array<float,2>{0.0502908826f, 0.917738676f},
-std::array<float,2>{0.721281588f, 0.255028427f},
-std::array<float,2>{0.550162852f, 0.775544703f},
-std::array<float,2>{0.240020066f, 0.426122874f},
-std::array<float,2>{0.321558177f, 0.679659665f},
-std::array<float,2>{0.941448987f, 0.0778701454f},
-std::array<float,2>{0.778650343f, 0.874378502f},
-std::array<float,2>{0.410403609f, 0.456038713f},
-std::array<float,2>{0.0706516504f, 0.687836111f},
-std::array<float,2>{0.646567702f, 0.0358224623f},
-std::array<float,2>{0.579716325f, 0.505004704f},
-std::array<float,2>{0.165526927f, 0.125831738f},
-std::array<float,2>{0.290150046f, 0.94738692f},
-std::array<float,2>{0.909985065f, 0.335943282f},
-std::array<float,2>{0.97557652f, 0.634552002f},
-std::array<float,2>{0.364862919f, 0.0976260751f},
-std::array<float,2>{0.190345198f, 0.811613381f},
-std::array<float,2>{0.51012361f, 0.375591516f},
-std::array<float,2>{0.699773729f, 0.888824284f},
-std::array<float,2>{0.0247166399f, 0.29079181f},
-std::array<float,2>{0.463998079f, 0.602228642f},
-std::array<float,2>{0.819771886f, 0.219540641f},
-std::array<float,2>{0.9543854f, 0.794476449f},
-std::array<float,2>{0.335406482f, 0.399026811f},
-std::array<float,2>{0.221810088f, 0.654477417f},
-std::array<float,2>{0.540206909f, 0.109488226f},
-std::array<float,2>{0.742223918f, 0.613000691f},
-std::array<float,2>{0.0345360972f, 0.237912714f},
-std::array<float,2>{0.489515543f, 0.898321569f},
-std::array<float,2>{0.856336534f, 0.307145447f},
-std::array<float,2>{0.788945496f, 0.710853755f},
-std::array<float,2>{0.399903655f, 0.0614717789f},
-std::array<float,2>{0.117090672f, 0.850559115f},
-std::array<float,2>{0.678197384f, 0.442763984f},
-std::array<float,2>{0.60810101f, 0.962252557f},
-std::array<float,2>{0.135410145f, 0.316880792f},
-std::array<float,2>{0.251353204f, 0.520329595f},
-std::array<float,2>{0.877044857f, 0.146203861f},
-std::array<float,2>{0.839115024f, 0.935356975f},
-std::array<float,2>{0.438019305f, 0.267282635f},
-std::array<float,2>{0.00305371778f, 0.590491116f},
-std::array<float,2>{0.714703262f, 0.194094345f},
-std::array<float,2>{0.516920209f, 0.659034193f},
-std::array<float,2>{0.204035237f, 0.0888342559f},
-std::array<float,2>{0.358788013f, 0.751370609f},
-std::array<float,2>{0.987520635f, 0.407846063f},
-std::array<float,2>{0.923112929f, 0.531428933f},
-std::array<float,2>{0.302190393f, 0.179457784f},
-std::array<float,2>{0.172725618f, 0.976745367f},
-std::array<float,2>{0.575960457f, 0.365030944f},
-std::array<float,2>{0.626015663f, 0.821148217f},
-std::array<float,2>{0.0802843124f, 0.493298471f},
-std::array<float,2>{0.433053225f, 0.746028721f},
-std::array<float,2>{0.760774255f, 0.0251019094f},
-std::array<float,2>{0.941234469f, 0.959548652f},
-std::array<float,2>{0.326734632f, 0.326481819f},
-std::array<float,2>{0.237211257f, 0.529539645f},
-std::array<float,2>{0.551702201f, 0.152705833f},
-std::array<float,2>{0.726550639f, 0.71655494f},
-std::array<float,2>{0.0543757416f, 0.0530179664f},
-std::array<float,2>{0.473222256f, 0.85919714f},
-std::array<float,2>{0.86721617f, 0.445587277f},
-std::array<float,2>{0.807089627f, 0.621050298f},
-std::array<float,2>{0.389856339f, 0.249330685f},
-std::array<float,2>{0.0980240926f, 0.898789763f},
-std::array<float,2>{0.666101873f, 0.301050335f},
-std::array<float,2>{0.624012411f, 0.783651352f},
-std::array<float,2>{0.15329273f, 0.397149622f},
-std::array<float,2>{0.275068253f, 0.643769383f},
-std::array<float,2>{0.891765118f, 0.118752286f},
-std::array<float,2>{0.813189805f, 0.819870412f},
-std::array<float,2>{0.467893273f, 0.489928484f},
-std::array<float,2>{0.0291675683f, 0.740909278f},
-std::array<float,2>{0.697756648f, 0.0191805959f},
-std::array<float,2>{0.514802277f, 0.545098841f},
-std::array<float,2>{0.194312036f, 0.181381971f},
-std::array<float,2>{0.363178045f, 0.975914776f},
-std::array<float,2>{0.971491158f, 0.370001137f},
-std::array<float,2>{0.912511826f, 0.669020295f},
-std::array<float,2>{0.295642287f, 0.0842388868f},
-std::array<float,2>{0.169081122f, 0.765354335f},
-std::array<float,2>{0.582632601f, 0.414324373f},
-std::array<float,2>{0.64288187f, 0.929137826f},
-std::array<float,2>{0.0749373138f, 0.278600305f},
-std::array<float,2>{0.40647307f, 0.585511088f},
-std::array<float,2>{0.776195049f, 0.196983323f},
-std::array<float,2>{0.879566967f, 0.771107614f},
-std::array<float,2>{0.257183135f, 0.435233086f},
-std::array<float,2>{0.137433067f, 0.680774391f},
-std::array<float,2>{0.603656828f, 0.0675968304f},
-std::array<float,2>{0.674188137f, 0.565685689f},
-std::array<float,2>{0.112044089f, 0.214990243f},
-std::array<float,2>{0.402958304f, 0.908122122f},
-std::array<float,2>{0.781267285f, 0.264925569f},
-std::array<float,2>{0.85462743f, 0.728675008f},
-std::array<float,2>{0.485778034f, 0.0150472308f},
-std::array<float,2>{0.0381010696f, 0.836696208f},
-std::array<float,2>{0.747305214f, 0.474028975f},
-std::array<float,2>{0.544988751f, 0.999768853f},
-std::array<float,2>{0.222906381f, 0.353626788f},
-std::array<float,2>{0.331574649f, 0.556557f},
-std::array<float,2>{0.958988607f, 0.162977591f},
-std::array<float,2>{0.762923479f, 0.875648737f},
-std::array<float,2>{0.433974355f, 0.287093073f},
-std::array<float,2>{0.0826114714f, 0.599248111f},
-std::array<float,2>{0.631231844f, 0.228465274f},
-std::array<float,2>{0.573059797f, 0.627832353f},
-std::array<float,2>{0.176866025f, 0.10786844f},
-std::array<float,2>{0.29801771f, 0.797521412f},
-std::array<float,2>{0.929599762f, 0.386179f},
-std::array<float,2>{0.989150345f, 0.508905947f},
-std::array<float,2>{0.354397565f, 0.138191298f},
-std::array<float,2>{0.210009083f, 0.940178454f},
-std::array<float,2>{0.522582769f, 0.328796953f},
-std::array<float,2>{0.717679977f, 0.861717284f},
-std::array<float,2>{0.00750617124f, 0.467684895f},
-std::array<float,2>{0.443048388f, 0.700127661f},
-std::array<float,2>{0.841631889f, 0.0402746424f},
-std::array<float,2>{0.929937243f, 0.918617427f},
-std::array<float,2>{0.306229681f, 0.253405064f},
-std::array<float,2>{0.185528919f, 0.573093772f},
-std::array<float,2>{0.567528844f, 0.209977061f},
-std::array<float,2>{0.637935817f, 0.675110757f},
-std::array<float,2>{0.0893509462f, 0.0732855499f},
-std::array<float,2>{0.425967574f, 0.780290782f},
-std::array<float,2>{0.751697302f, 0.422784895f},
-std::array<float,2>{0.829796314f, 0.554625869f},
-std::array<float,2>{0.45132634f, 0.168276936f},
-std::array<float,2>{0.0103763053f, 0.991859317f},
-std::array<float,2>{0.70480752f, 0.346962154f},
-std::array<float,2>{0.523477376f, 0.832212746f},
-std::array<float,2>{0.218448237f, 0.478270382f},
-std::array<float,2>{0.343796343f, 0.72551322f},
-std::array<float,2>{0.996999264f, 0.00374387181f},
-std::array<float,2>{0.795868516f, 0.806259453f},
-std::array<float,2>{0.393997669f, 0.382073045f},
-std::array<float,2>{0.121542774f, 0.63979876f},
-std::array<float,2>{0.683873713f, 0.0978306755f},
-std::array<float,2>{0.598986149f, 0.60571599f},
-std::array<float,2>{0.12798664f, 0.223080501f},
-std::array<float,2>{0.261070669f, 0.883619666f},
-std::array<float,2>{0.88621974f, 0.295372546f},
-std::array<float,2>{0.965358675f, 0.694120407f},
-std::array<float,2>{0.337322354f, 0.0320770442f},
-std::array<float,2>{0.232945725f, 0.869393885f},
-std::array<float,2>{0.535199583f, 0.460806251f},
-std::array<float,2>{0.734783292f, 0.950750411f},
-std::array<float,2>{0.0463105962f, 0.343690097f},
-std::array<float,2>{0.499466777f, 0.500228405f},
-std::array<float,2>{0.851468265f, 0.129314616f},
-std::array<float,2>{0.982256651f, 0.844059408f},
-std::array<float,2>{0.370790094f, 0.439206034f},
-std::array<float,2>{0.200265884f, 0.705275953f},
-std::array<float,2>{0.505487978f, 0.0552565157f},
-std::array<float,2>{0.692570448f, 0.518876374f},
-std::array<float,2>{0.0227305926f, 0.140772238f},
-std::array<float,2>{0.458136082f, 0.964900613f},
-std::array<float,2>{0.826395273f, 0.312777281f},
-std::array<float,2>{0.773024797f, 0.650799513f},
-std::array<float,2>{0.41523093f, 0.115213126f},
-std::array<float,2>{0.063459754f, 0.790109754f},
-std::array<float,2>{0.653899372f, 0.40249148f},
-std::array<float,2>{0.58690083f, 0.894452572f},
-std::array<float,2>{0.160097569f, 0.310813248f},
-std::array<float,2>{0.287394941f, 0.616750062f},
-std::array<float,2>{0.91907382f, 0.240924448f},
-std::array<float,2>{0.863642871f, 0.981473386f},
-std::array<float,2>{0.480966955f, 0.36205557f},
-std::array<float,2>{0.0613553524f, 0.536206841f},
-std::array<float,2>{0.727263927f, 0.173196301f},
-std::array<float,2>{0.559192896f, 0.749648571f},
-std::array<float,2>{0.248316929f, 0.0298334975f},
-std::array<float,2>{0.31448248f, 0.827934265f},
-std::array<float,2>{0.950961471f, 0.499827504f},
-std::array<float,2>{0.905578256f, 0.589683294f},
-std::array<float,2>{0.268281043f, 0.18817766f},
-std::array<float,2>{0.145061851f, 0.930559635f},
-std::array<float,2>{0.610976994f, 0.273090392f},
-std::array<float,2>{0.662854135f, 0.75605613f},
-std::array<float,2>{0.103934392f, 0.410704076f},
-std::array<float,2>{0.376120269f, 0.663953185f},
-std::array<float,2>{0.80214256f, 0.0932203457f},
-std::array<float,2>{0.95691824f, 0.897821367f},
-std::array<float,2>{0.333580196f, 0.306643277f},
-std::array<float,2>{0.219564021f, 0.612363636f},
-std::array<float,2>{0.542893767f, 0.237533048f},
-std::array<float,2>{0.745015681f, 0.654910564f},
-std::array<float,2>{0.0328557007f, 0.109977022f},
-std::array<float,2>{0.490580857f, 0.794383466f},
-std::array<float,2>{0.858872473f, 0.398755997f},
-std::array<float,2>{0.787102401f, 0.519884646f},
-std::array<float,2>{0.401983827f, 0.145554081f},
-std::array<float,2>{0.113946743f, 0.962792695f},
-std::array<float,2>{0.677375078f, 0.316997439f},
-std::array<float,2>{0.605578959f, 0.849796534f},
-std::array<float,2>{0.134046763f, 0.443278044f},
-std::array<float,2>{0.252189934f, 0.710178554f},
-std::array<float,2>{0.875711739f, 0.0607166924f},
-std::array<float,2>{0.837249398f, 0.751505673f},
-std::array<float,2>{0.439697683f, 0.407626897f},
-std::array<float,2>{0.0019192216f, 0.658582389f},
-std::array<float,2>{0.712067783f, 0.0882868469f},
-std::array<float,2>{0.518726408f, 0.589924455f},
-std::array<float,2>{0.205371216f, 0.19338949f},
-std::array<float,2>{0.357219934f, 0.934798002f},
-std::array<float,2>{0.985659957f, 0.267031014f},
-std::array<float,2>{0.923903525f, 0.745307028f},
-std::array<float,2>{0.303136677f, 0.0245940126f},
-std::array<float,2>{0.173877984f, 0.820553541f},
-std::array<float,2>{0.57732892f, 0.494044214f},
-std::array<float,2>{0.627901912f, 0.977112234f},
-std::array<float,2>{0.0793766975f, 0.364565611f},
-std::array<float,2>{0.430960864f, 0.532049537f},
-std::array<float,2>{0.757909775f, 0.178790554f},
-std::array<float,2>{0.895714521f, 0.830906391f},
-std::array<float,2>{0.278496236f, 0.483152986f},
-std::array<float,2>{0.151648283f, 0.720049977f},
-std::array<float,2>{0.620067418f, 0.00590951415f},
-std::array<float,2>{0.668090582f, 0.547581196f},
-std::array<float,2>{0.0972391367f, 0.166106567f},
-std::array<float,2>{0.386174291f, 0.987398863f},
-std::array<float,2>{0.810082972f, 0.349659145f},
-std::array<float,2>{0.873900712f, 0.678750098f},
-std::array<float,2>{0.472326666f, 0.0775810778f},
-std::array<float,2>{0.0477691405f, 0.775912106f},
-std::array<float,2>{0.719439507f, 0.426408291f},
-std::array<float,2>{0.54856497f, 0.917456925f},
-std::array<float,2>{0.24110429f, 0.255604446f},
-std::array<float,2>{0.32230705f, 0.574737012f},
-std::array<float,2>{0.944183648f, 0.206508607f},
-std::array<float,2>{0.780742407f, 0.948190808f},
-std::array<float,2>{0.413152903f, 0.336742014f},
-std::array<float,2>{0.0738795921f, 0.505774915f},
-std::array<float,2>{0.646190286f, 0.125291422f},
-std::array<float,2>{0.580457687f, 0.688121259f},
-std::array<float,2>{0.166779324f, 0.0356243253f},
-std::array<float,2>{0.291347861f, 0.874827504f},
-std::array<float,2>{0.906695604f, 0.455338418f},
-std::array<float,2>{0.972999394f, 0.602029562f},
-std::array<float,2>{0.366779715f, 0.219069198f},
-std::array<float,2>{0.188767746f, 0.889603853f},
-std::array<float,2>{0.508323908f, 0.290283591f},
-std::array<float,2>{0.702869773f, 0.812140048f},
-std::array<float,2>{0.027136188f, 0.37505722f},
-std::array<float,2>{0.462285161f, 0.63392067f},
-std::array<float,2>{0.818097293f, 0.0970215648f},
-std::array<float,2>{0.914062679f, 0.994520068f},
-std::array<float,2>{0.283855736f, 0.356000632f},
-std::array<float,2>{0.161635041f, 0.56121552f},
-std::array<float,2>{0.591636539f, 0.157977f},
-std::array<float,2>{0.651722729f, 0.732128322f},
-std::array<float,2>{0.0677725449f, 0.0089919921f},
-std::array<float,2>{0.41925931f, 0.842823386f},
-std::array<float,2>{0.766023099f, 0.469388992f},
-std::array<float,2>{0.820462286f, 0.569530129f},
-std::array<float,2>{0.453402877f, 0.211411923f},
-std::array<float,2>{0.0161806736f, 0.913164198f},
-std::array<float,2>{0.688937724f, 0.260352731f},
-std::array<float,2>{0.503072202f, 0.768222094f},
-std::array<float,2>{0.19823803f, 0.432801425f},
-std::array<float,2>{0.374472231f, 0.686226487f},
-std::array<float,2>{0.978682816f, 0.0632741526f},
-std::array<float,2>{0.79880774f, 0.865025699f},
-std::array<float,2>{0.380996704f, 0.461321712f},
-std::array<float,2>{0.105700083f, 0.695841849f},
-std::array<float,2>{0.658237815f, 0.044187393f},
-std::array<float,2>{0.616577446f, 0.512861133f},
-std::array<float,2>{0.143190384f, 0.133086726f},
-std::array<float,2>{0.271395206f, 0.944042623f},
-std::array<float,2>{0.901265502f, 0.333681613f},
-std::array<float,2>{0.947096944f, 0.630851686f},
-std::array<float,2>{0.318047166f, 0.105318554f},
-std::array<float,2>{0.243110403f, 0.801390827f},
-std::array<float,2>{0.558147013f, 0.390098125f},
-std::array<float,2>{0.732355535f, 0.880178034f},
-std::array<float,2>{0.0581828021f, 0.283484399f},
-std::array<float,2>{0.480066627f, 0.593841791f},
-std::array<float,2>{0.861097574f, 0.231845364f},
-std::array<float,2>{0.995572805f, 0.788460314f},
-std::array<float,2>{0.348280489f, 0.393666416f},
-std::array<float,2>{0.211965546f, 0.648207009f},
-std::array<float,2>{0.528574884f, 0.123088367f},
-std::array<float,2>{0.708550155f, 0.623012185f},
-std::array<float,2>{0.0129263978f, 0.243972525f},
-std::array<float,2>{0.447605878f, 0.904658377f},
-std::array<float,2>{0.832535684f, 0.299660087f},
-std::array<float,2>{0.75551331f, 0.712314725f},
-std::array<float,2>{0.422489226f, 0.0488626845f},
-std::array<float,2>{0.0903895348f, 0.851750851f},
-std::array<float,2>{0.635590732f, 0.452865005f},
-std::array<float,2>{0.562828541f, 0.955764592f},
-std::array<float,2>{0.181785509f, 0.321122944f},
-std::array<float,2>{0.308606625f, 0.525094867f},
-std::array<float,2>{0.937214732f, 0.149645835f},
-std::array<float,2>{0.846869171f, 0.922074974f},
-std::array<float,2>{0.495300591f, 0.276919067f},
-std::array<float,2>{0.0426793136f, 0.578300655f},
-std::array<float,2>{0.741891682f, 0.200014189f},
-std::array<float,2>{0.533914804f, 0.664682686f},
-std::array<float,2>{0.230158985f, 0.0797692835f},
-std::array<float,2>{0.340295792f, 0.759746552f},
-std::array<float,2>{0.963338554f, 0.419685394f},
-std::array<float,2>{0.886992455f, 0.541520655f},
-std::array<float,2>{0.263620287f, 0.186703861f},
-std::array<float,2>{0.131142467f, 0.969460309f},
-std::array<float,2>{0.594721913f, 0.372041941f},
-std::array<float,2>{0.682662904f, 0.815950572f},
-std::array<float,2>{0.117617406f, 0.484722465f},
-std::array<float,2>{0.398171842f, 0.737633705f},
-std::array<float,2>{0.79116565f, 0.0215733312f},
-std::array<float,2>{0.983628392f, 0.96542877f},
-std::array<float,2>{0.367257178f, 0.313035667f},
-std::array<float,2>{0.201889217f, 0.519306898f},
-std::array<float,2>{0.506786287f, 0.141545728f},
-std::array<float,2>{0.695237041f, 0.705855787f},
-std::array<float,2>{0.0199740399f, 0.0550352298f},
-std::array<float,2>{0.459162712f, 0.844434321f},
-std::array<float,2>{0.825605273f, 0.43882224f},
-std::array<float,2>{0.770612538f, 0.616563797f},
-std::array<float,2>{0.416526884f, 0.240333423f},
-std::array<float,2>{0.065539442f, 0.8937608f},
-std::array<float,2>{0.655100703f, 0.31134069f},
-std::array<float,2>{0.589693546f, 0.790615082f},
-std::array<float,2>{0.156672969f, 0.403211147f},
-std::array<float,2>{0.286811411f, 0.650932312f},
-std::array<float,2>{0.9199965f, 0.114485413f},
-std::array<float,2>{0.866572082f, 0.827433705f},
-std::array<float,2>{0.482951105f, 0.499457419f},
-std::array<float,2>{0.0601923652f, 0.749127746f},
-std::array<float,2>{0.730118155f, 0.0296209883f},
-std::array<float,2>{0.562193811f, 0.536685705f},
-std::array<float,2>{0.246567667f, 0.173470572f},
-std::array<float,2>{0.312620878f, 0.982415318f},
-std::array<float,2>{0.952852309f, 0.361479551f},
-std::array<float,2>{0.903584659f, 0.663458943f},
-std::array<float,2>{0.266461849f, 0.0937156454f},
-std::array<float,2>{0.146875903f, 0.756665468f},
-std::array<float,2>{0.61284411f, 0.410588622f},
-std::array<float,2>{0.660367072f, 0.930034161f},
-std::array<float,2>{0.102546751f, 0.272925854f},
-std::array<float,2>{0.37880224f, 0.589247823f},
-std::array<float,2>{0.803534508f, 0.187838882f},
-std::array<float,2>{0.932731807f, 0.780929685f},
-std::array<float,2>{0.30729717f, 0.422340095f},
-std::array<float,2>{0.186386421f, 0.675744116f},
-std::array<float,2>{0.569379151f, 0.0741393119f},
-std::array<float,2>{0.63947463f, 0.57247144f},
-std::array<float,2>{0.0860930085f, 0.210766971f},
-std::array<float,2>{0.429337561f, 0.918322504f},
-std::array<float,2>{0.752035677f, 0.253503084f},
-std::array<float,2>{0.831658185f, 0.724978626f},
-std::array<float,2>{0.449371308f, 0.00302156364f},
-std::array<float,2>{0.00783334766f, 0.832982719f},
-std::array<float,2>{0.706391752f, 0.477918029f},
-std::array<float,2>{0.525437772f, 0.991343498f},
-std::array<float,2>{0.216046646f, 0.347383946f},
-std::array<float,2>{0.347287714f, 0.553862214f},
-std::array<float,2>{0.998888493f, 0.168690711f},
-std::array<float,2>{0.793465495f, 0.882860303f},
-std::array<float,2>{0.392577142f, 0.295822889f},
-std::array<float,2>{0.124067284f, 0.606164694f},
-std::array<float,2>{0.686854541f, 0.223562896f},
-std::array<float,2>{0.600219369f, 0.640464544f},
-std::array<float,2>{0.126290888f, 0.0982445553f},
-std::array<float,2>{0.25828433f, 0.805975139f},
-std::array<float,2>{0.883532703f, 0.382769704f},
-std::array<float,2>{0.967486262f, 0.500947714f},
-std::array<float,2>{0.339417547f, 0.129553452f},
-std::array<float,2>{0.232346028f, 0.950528502f},
-std::array<float,2>{0.537260473f, 0.342776477f},
-std::array<float,2>{0.737326324f, 0.870099187f},
-std::array<float,2>{0.0433301032f, 0.460095406f},
-std::array<float,2>{0.496427774f, 0.693714857f},
-std::array<float,2>{0.848365188f, 0.03158262f},
-std::array<float,2>{0.881895602f, 0.907458246f},
-std::array<float,2>{0.254309922f, 0.265514553f},
-std::array<float,2>{0.139916465f, 0.565925419f},
-std::array<float,2>{0.603456616f, 0.215608448f},
-std::array<float,2>{0.672304809f, 0.681487799f},
-std::array<float,2>{0.110677011f, 0.0681215897f},
-std::array<float,2>{0.404607832f, 0.770635307f},
-std::array<float,2>{0.783912718f, 0.434612453f},
-std::array<float,2>{0.851763368f, 0.556029558f},
-std::array<float,2>{0.487239897f, 0.162378833f},
-std::array<float,2>{0.0365178697f, 0.999084771f},
-std::array<float,2>{0.749352396f, 0.354429066f},
-std::array<float,2>{0.543393552f, 0.836228132f},
-std::array<float,2>{0.225109726f, 0.474330336f},
-std::array<float,2>{0.328729719f, 0.729144752f},
-std::array<float,2>{0.957861722f, 0.0154923163f},
-std::array<float,2>{0.765131772f, 0.797142208f},
-std::array<float,2>{0.437194169f, 0.386489809f},
-std::array<float,2>{0.0850266516f, 0.62735045f},
-std::array<float,2>{0.629079044f, 0.107955553f},
-std::array<float,2>{0.571578383f, 0.59910655f},
-std::array<float,2>{0.178882644f, 0.227746725f},
-std::array<float,2>{0.300585777f, 0.875305057f},
-std::array<float,2>{0.926546335f, 0.286362529f},
-std::array<float,2>{0.992158413f, 0.699614942f},
-std::array<float,2>{0.352034658f, 0.0408336222f},
-std::array<float,2>{0.207918674f, 0.862149954f},
-std::array<float,2>{0.520885527f, 0.466965288f},
-std::array<float,2>{0.715628743f, 0.939823449f},
-std::array<float,2>{0.00449794857f, 0.328478426f},
-std::array<float,2>{0.444263726f, 0.509405494f},
-std::array<float,2>{0.841897964f, 0.137720138f},
-std::array<float,2>{0.93771255f, 0.858662128f},
-std::array<float,2>{0.324290782f, 0.445923835f},
-std::array<float,2>{0.235462725f, 0.71601367f},
-std::array<float,2>{0.55465728f, 0.0535760038f},
-std::array<float,2>{0.722901046f, 0.529962957f},
-std::array<float,2>{0.0517628565f, 0.153200388f},
-std::array<float,2>{0.47486338f, 0.959056556f},
-std::array<float,2>{0.86920917f, 0.326740891f},
-std::array<float,2>{0.804961741f, 0.644373953f},
-std::array<float,2>{0.387256116f, 0.118456095f},
-std::array<float,2>{0.0999046341f, 0.784015954f},
-std::array<float,2>{0.66594249f, 0.396810323f},
-std::array<float,2>{0.621299922f, 0.899377227f},
-std::array<float,2>{0.155636549f, 0.301593721f},
-std::array<float,2>{0.276049614f, 0.62059468f},
-std::array<float,2>{0.893520653f, 0.249924242f},
-std::array<float,2>{0.815901935f, 0.976386368f},
-std::array<float,2>{0.46559155f, 0.369285196f},
-std::array<float,2>{0.0296764541f, 0.545865953f},
-std::array<float,2>{0.696721733f, 0.1809652f},
-std::array<float,2>{0.513516784f, 0.740379453f},
-std::array<float,2>{0.193029314f, 0.0188580267f},
-std::array<float,2>{0.360898912f, 0.819424033f},
-std::array<float,2>{0.968852043f, 0.489613116f},
-std::array<float,2>{0.910329521f, 0.585344911f},
-std::array<float,2>{0.293135405f, 0.196595326f},
-std::array<float,2>{0.170418352f, 0.929538906f},
-std::array<float,2>{0.585074723f, 0.279254109f},
-std::array<float,2>{0.641874969f, 0.764924765f},
-std::array<float,2>{0.0773881748f, 0.414605647f},
-std::array<float,2>{0.409593016f, 0.669631362f},
-std::array<float,2>{0.775025964f, 0.084855102f},
-std::array<float,2>{0.988194525f, 0.935775816f},
-std::array<float,2>{0.358996302f, 0.268904358f},
-std::array<float,2>{0.203137934f, 0.59235847f},
-std::array<float,2>{0.517182708f, 0.19173193f},
-std::array<float,2>{0.713940978f, 0.657390296f},
-std::array<float,2>{0.00361450831f, 0.0865768567f},
-std::array<float,2>{0.437583059f, 0.75292927f},
-std::array<float,2>{0.839418352f, 0.409335405f},
-std::array<float,2>{0.761283338f, 0.534525454f},
-std::array<float,2>{0.433296084f, 0.176911071f},
-std::array<float,2>{0.0807186067f, 0.979732633f},
-std::array<float,2>{0.626674592f, 0.36546734f},
-std::array<float,2>{0.575485647f, 0.822533727f},
-std::array<float,2>{0.172306195f, 0.495867223f},
-std::array<float,2>{0.302607387f, 0.742273808f},
-std::array<float,2>{0.923729002f, 0.0269878767f},
-std::array<float,2>{0.855885088f, 0.79619056f},
-std::array<float,2>{0.490231544f, 0.401297867f},
-std::array<float,2>{0.0347700082f, 0.653312504f},
-std::array<float,2>{0.742970109f, 0.111642905f},
-std::array<float,2>{0.540885866f, 0.609951854f},
-std::array<float,2>{0.222253188f, 0.235971525f},
-std::array<float,2>{0.335589617f, 0.894546509f},
-std::array<float,2>{0.955007732f, 0.305180013f},
-std::array<float,2>{0.877884865f, 0.707105637f},
-std::array<float,2>{0.251859069f, 0.058685679f},
-std::array<float,2>{0.135222659f, 0.847659349f},
-std::array<float,2>{0.607499957f, 0.4450351f},
-std::array<float,2>{0.678244293f, 0.964757919f},
-std::array<float,2>{0.116677843f, 0.319016159f},
-std::array<float,2>{0.399844646f, 0.521577001f},
-std::array<float,2>{0.788503528f, 0.147685841f},
-std::array<float,2>{0.909225643f, 0.871645868f},
-std::array<float,2>{0.290892303f, 0.453333527f},
-std::array<float,2>{0.165887237f, 0.690842211f},
-std::array<float,2>{0.579511583f, 0.0388815328f},
-std::array<float,2>{0.647398174f, 0.506299496f},
-std::array<float,2>{0.0712028965f, 0.128565475f},
-std::array<float,2>{0.410965085f, 0.946963906f},
-std::array<float,2>{0.778811872f, 0.33885932f},
-std::array<float,2>{0.819918811f, 0.636240602f},
-std::array<float,2>{0.464470804f, 0.0949892923f},
-std::array<float,2>{0.0249712728f, 0.809709013f},
-std::array<float,2>{0.699269354f, 0.377640724f},
-std::array<float,2>{0.510597289f, 0.887183964f},
-std::array<float,2>{0.189513475f, 0.292885482f},
-std::array<float,2>{0.364584714f, 0.604874492f},
-std::array<float,2>{0.974864721f, 0.220892012f},
-std::array<float,2>{0.811578929f, 0.984836519f},
-std::array<float,2>{0.383979738f, 0.34824118f},
-std::array<float,2>{0.0952292383f, 0.548864841f},
-std::array<float,2>{0.670006692f, 0.165820926f},
-std::array<float,2>{0.617304742f, 0.722559512f},
-std::array<float,2>{0.149770454f, 0.0054764119f},
-std::array<float,2>{0.279427916f, 0.829959452f},
-std::array<float,2>{0.897288024f, 0.480477899f},
-std::array<float,2>{0.942092061f, 0.576764405f},
-std::array<float,2>{0.322076052f, 0.203919396f},
-std::array<float,2>{0.239399001f, 0.914847076f},
-std::array<float,2>{0.550299704f, 0.255920172f},
-std::array<float,2>{0.720782816f, 0.774394453f},
-std::array<float,2>{0.0506952517f, 0.429480106f},
-std::array<float,2>{0.470458508f, 0.676004589f},
-std::array<float,2>{0.872806966f, 0.0751599595f},
-std::array<float,2>{0.899754465f, 0.941681743f},
-std::array<float,2>{0.272328913f, 0.335028678f},
-std::array<float,2>{0.142055616f, 0.513843536f},
-std::array<float,2>{0.615173995f, 0.13655144f},
-std::array<float,2>{0.657679021f, 0.697791636f},
-std::array<float,2>{0.108682163f, 0.0462542698f},
-std::array<float,2>{0.379426301f, 0.865294874f},
-std::array<float,2>{0.799462199f, 0.463008016f},
-std::array<float,2>{0.862493515f, 0.596859813f},
-std::array<float,2>{0.477491379f, 0.232529074f},
-std::array<float,2>{0.0564690009f, 0.882324874f},
-std::array<float,2>{0.733278751f, 0.282399803f},
-std::array<float,2>{0.556615829f, 0.802796364f},
-std::array<float,2>{0.245900929f, 0.388299435f},
-std::array<float,2>{0.31902343f, 0.632750392f},
-std::array<float,2>{0.948856294f, 0.102804005f},
-std::array<float,2>{0.768491149f, 0.840899229f},
-std::array<float,2>{0.420691967f, 0.47113502f},
-std::array<float,2>{0.0693538561f, 0.733377576f},
-std::array<float,2>{0.649704158f, 0.010373841f},
-std::array<float,2>{0.593651354f, 0.559696615f},
-std::array<float,2>{0.163871035f, 0.159988627f},
-std::array<float,2>{0.282294184f, 0.992842019f},
-std::array<float,2>{0.916242242f, 0.358154356f},
-std::array<float,2>{0.977920949f, 0.684045076f},
-std::array<float,2>{0.372234166f, 0.0656991601f},
-std::array<float,2>{0.195889533f, 0.765883446f},
-std::array<float,2>{0.501325071f, 0.429707021f},
-std::array<float,2>{0.689593315f, 0.911430776f},
-std::array<float,2>{0.0179213993f, 0.258776277f},
-std::array<float,2>{0.455795318f, 0.567847431f},
-std::array<float,2>{0.82349509f, 0.213387877f},
-std::array<float,2>{0.961800635f, 0.760615528f},
-std::array<float,2>{0.342711121f, 0.421707243f},
-std::array<float,2>{0.227293894f, 0.667313576f},
-std::array<float,2>{0.532381356f, 0.0804513171f},
-std::array<float,2>{0.739247561f, 0.580099881f},
-std::array<float,2>{0.0393806882f, 0.202630445f},
-std::array<float,2>{0.492315978f, 0.924498677f},
-std::array<float,2>{0.844157517f, 0.273610234f},
-std::array<float,2>{0.789807975f, 0.735458851f},
-std::array<float,2>{0.396089226f, 0.020977769f},
-std::array<float,2>{0.120169617f, 0.814082205f},
-std::array<float,2>{0.680435956f, 0.488156945f},
-std::array<float,2>{0.596278191f, 0.972593129f},
-std::array<float,2>{0.130119815f, 0.373404592f},
-std::array<float,2>{0.265281796f, 0.54012841f},
-std::array<float,2>{0.888905287f, 0.185499847f},
-std::array<float,2>{0.83534956f, 0.904257774f},
-std::array<float,2>{0.446538538f, 0.297348022f},
-std::array<float,2>{0.0147028053f, 0.624416471f},
-std::array<float,2>{0.709361374f, 0.245049238f},
-std::array<float,2>{0.529983699f, 0.64601624f},
-std::array<float,2>{0.21454604f, 0.12133494f},
-std::array<float,2>{0.351425737f, 0.785286427f},
-std::array<float,2>{0.993456364f, 0.391078919f},
-std::array<float,2>{0.934982181f, 0.525441468f},
-std::array<float,2>{0.312081009f, 0.150461242f},
-std::array<float,2>{0.180042237f, 0.954363346f},
-std::array<float,2>{0.564724028f, 0.322634071f},
-std::array<float,2>{0.632932425f, 0.853637934f},
-std::array<float,2>{0.0923576131f, 0.450201273f},
-std::array<float,2>{0.42538029f, 0.714110494f},
-std::array<float,2>{0.757580876f, 0.0472483821f},
-std::array<float,2>{0.950560093f, 0.98387289f},
-std::array<float,2>{0.315334976f, 0.359398991f},
-std::array<float,2>{0.249014363f, 0.53754741f},
-std::array<float,2>{0.558890402f, 0.175159499f},
-std::array<float,2>{0.726925611f, 0.747852266f},
-std::array<float,2>{0.0609858409f, 0.0288548432f},
-std::array<float,2>{0.480872691f, 0.824272752f},
-std::array<float,2>{0.863792002f, 0.497874141f},
-std::array<float,2>{0.802436769f, 0.586123049f},
-std::array<float,2>{0.376715928f, 0.189924881f},
-std::array<float,2>{0.104401082f, 0.931994557f},
-std::array<float,2>{0.66256386f, 0.270775139f},
-std::array<float,2>{0.61062634f, 0.755333543f},
-std::array<float,2>{0.144716009f, 0.412710488f},
-std::array<float,2>{0.268059075f, 0.66102457f},
-std::array<float,2>{0.905777335f, 0.0917209685f},
-std::array<float,2>{0.827046752f, 0.846347451f},
-std::array<float,2>{0.45883733f, 0.441172838f},
-std::array<float,2>{0.0230085813f, 0.703849256f},
-std::array<float,2>{0.693173826f, 0.0576257929f},
-std::array<float,2>{0.505140066f, 0.516486168f},
-std::array<float,2>{0.200993568f, 0.144519255f},
-std::array<float,2>{0.370512217f, 0.967993736f},
-std::array<float,2>{0.981664181f, 0.316172898f},
-std::array<float,2>{0.91950357f, 0.649134517f},
-std::array<float,2>{0.287819922f, 0.115312688f},
-std::array<float,2>{0.159454271f, 0.792333066f},
-std::array<float,2>{0.586059153f, 0.405192673f},
-std::array<float,2>{0.653361142f, 0.892401755f},
-std::array<float,2>{0.0625038445f, 0.309289336f},
-std::array<float,2>{0.415876538f, 0.61433965f},
-std::array<float,2>{0.772658765f, 0.239771336f},
-std::array<float,2>{0.88654995f, 0.806931853f},
-std::array<float,2>{0.261711627f, 0.379738122f},
-std::array<float,2>{0.128616273f, 0.636917174f},
-std::array<float,2>{0.59945792f, 0.101473846f},
-std::array<float,2>{0.68447268f, 0.608128428f},
-std::array<float,2>{0.121797547f, 0.225632101f},
-std::array<float,2>{0.394404918f, 0.885531604f},
-std::array<float,2>{0.7953915f, 0.29454577f},
-std::array<float,2>{0.850668013f, 0.692399979f},
-std::array<float,2>{0.499841005f, 0.0345994271f},
-std::array<float,2>{0.0468643308f, 0.867236853f},
-std::array<float,2>{0.735090911f, 0.458247066f},
-std::array<float,2>{0.536016583f, 0.95274955f},
-std::array<float,2>{0.232634589f, 0.341705412f},
-std::array<float,2>{0.337556452f, 0.503639698f},
-std::array<float,2>{0.964881003f, 0.132194072f},
-std::array<float,2>{0.751373231f, 0.921404839f},
-std::array<float,2>{0.42657125f, 0.250132293f},
-std::array<float,2>{0.0894162059f, 0.571915388f},
-std::array<float,2>{0.638252795f, 0.208507076f},
-std::array<float,2>{0.568240404f, 0.672802031f},
-std::array<float,2>{0.184699267f, 0.0719434693f},
-std::array<float,2>{0.306058884f, 0.77803278f},
-std::array<float,2>{0.930440187f, 0.424339294f},
-std::array<float,2>{0.996222258f, 0.550796092f},
-std::array<float,2>{0.344463944f, 0.171716958f},
-std::array<float,2>{0.218101546f, 0.989516616f},
-std::array<float,2>{0.524023235f, 0.344662815f},
-std::array<float,2>{0.704583108f, 0.834864557f},
-std::array<float,2>{0.00983001105f, 0.47895506f},
-std::array<float,2>{0.45192492f, 0.724573612f},
-std::array<float,2>{0.829427123f, 0.00119360618f},
-std::array<float,2>{0.929189324f, 0.878887057f},
-std::array<float,2>{0.29877758f, 0.287823141f},
-std::array<float,2>{0.17758593f, 0.600886464f},
-std::array<float,2>{0.572365582f, 0.229141623f},
-std::array<float,2>{0.631351292f, 0.625400245f},
-std::array<float,2>{0.08222121f, 0.105877295f},
-std::array<float,2>{0.434196681f, 0.80063647f},
-std::array<float,2>{0.763522565f, 0.384431034f},
-std::array<float,2>{0.840966344f, 0.509780228f},
-std::array<float,2>{0.442783564f, 0.138753802f},
-std::array<float,2>{0.0069184429f, 0.939412832f},
-std::array<float,2>{0.716827273f, 0.330531329f},
-std::array<float,2>{0.523136318f, 0.860727131f},
-std::array<float,2>{0.210631981f, 0.465208888f},
-std::array<float,2>{0.353639573f, 0.702660561f},
-std::array<float,2>{0.988326192f, 0.041436635f},
-std::array<float,2>{0.781738818f, 0.772922635f},
-std::array<float,2>{0.402439713f, 0.437465072f},
-std::array<float,2>{0.111379541f, 0.682826877f},
-std::array<float,2>{0.674357355f, 0.0685038641f},
-std::array<float,2>{0.604153037f, 0.562516391f},
-std::array<float,2>{0.137123987f, 0.217116162f},
-std::array<float,2>{0.257699668f, 0.908483803f},
-std::array<float,2>{0.879066229f, 0.261760086f},
-std::array<float,2>{0.959573448f, 0.727892637f},
-std::array<float,2>{0.331380755f, 0.0126168607f},
-std::array<float,2>{0.223286703f, 0.838948131f},
-std::array<float,2>{0.545637012f, 0.476548046f},
-std::array<float,2>{0.747748673f, 0.997473419f},
-std::array<float,2>{0.0388250202f, 0.351689667f},
-std::array<float,2>{0.486037463f, 0.55700773f},
-std::array<float,2>{0.85528338f, 0.161691964f},
-std::array<float,2>{0.970926464f, 0.817993701f},
-std::array<float,2>{0.362693548f, 0.490951896f},
-std::array<float,2>{0.193430156f, 0.738599718f},
-std::array<float,2>{0.515472949f, 0.0158307981f},
-std::array<float,2>{0.697621584f, 0.543411732f},
-std::array<float,2>{0.0283945594f, 0.182889387f},
-std::array<float,2>{0.468381196f, 0.973144829f},
-std::array<float,2>{0.812775254f, 0.368602544f},
-std::array<float,2>{0.775434256f, 0.670461655f},
-std::array<float,2>{0.407159746f, 0.083135657f},
-std::array<float,2>{0.0746207982f, 0.762768507f},
-std::array<float,2>{0.643257499f, 0.416888863f},
-std::array<float,2>{0.582275629f, 0.927143872f},
-std::array<float,2>{0.169849187f, 0.280717731f},
-std::array<float,2>{0.295397907f, 0.582311034f},
-std::array<float,2>{0.912758827f, 0.198377296f},
-std::array<float,2>{0.868131638f, 0.957943618f},
-std::array<float,2>{0.473089069f, 0.325654685f},
-std::array<float,2>{0.0537336394f, 0.528451145f},
-std::array<float,2>{0.725836456f, 0.15446426f},
-std::array<float,2>{0.55100739f, 0.717975199f},
-std::array<float,2>{0.236422062f, 0.0518513173f},
-std::array<float,2>{0.326483905f, 0.855794132f},
-std::array<float,2>{0.940562963f, 0.448222429f},
-std::array<float,2>{0.892359853f, 0.618974864f},
-std::array<float,2>{0.27487278f, 0.24665451f},
-std::array<float,2>{0.152420387f, 0.902012527f},
-std::array<float,2>{0.623200178f, 0.302992046f},
-std::array<float,2>{0.666827798f, 0.781818092f},
-std::array<float,2>{0.0985084325f, 0.396359146f},
-std::array<float,2>{0.390419275f, 0.642181933f},
-std::array<float,2>{0.807213545f, 0.119783625f},
-std::array<float,2>{0.944797099f, 0.91560322f},
-std::array<float,2>{0.323662668f, 0.257289737f},
-std::array<float,2>{0.241916329f, 0.577282488f},
-std::array<float,2>{0.547076643f, 0.204588845f},
-std::array<float,2>{0.720526576f, 0.677730143f},
-std::array<float,2>{0.0483639427f, 0.0756511986f},
-std::array<float,2>{0.470922202f, 0.775225103f},
-std::array<float,2>{0.874500334f, 0.427753717f},
-std::array<float,2>{0.809311926f, 0.550414085f},
-std::array<float,2>{0.385237962f, 0.164111435f},
-std::array<float,2>{0.0960446894f, 0.985903144f},
-std::array<float,2>{0.669709444f, 0.349238217f},
-std::array<float,2>{0.620320082f, 0.82829982f},
-std::array<float,2>{0.151015982f, 0.482324749f},
-std::array<float,2>{0.277979642f, 0.721655786f},
-std::array<float,2>{0.895170212f, 0.00395951234f},
-std::array<float,2>{0.816747367f, 0.808642566f},
-std::array<float,2>{0.460995317f, 0.378498971f},
-std::array<float,2>{0.0259706508f, 0.635389507f},
-std::array<float,2>{0.701175869f, 0.0938879102f},
-std::array<float,2>{0.508810639f, 0.603782415f},
-std::array<float,2>{0.187567011f, 0.222357377f},
-std::array<float,2>{0.365915239f, 0.888112485f},
-std::array<float,2>{0.974502087f, 0.29180789f},
-std::array<float,2>{0.907242477f, 0.690199554f},
-std::array<float,2>{0.292751372f, 0.0377471298f},
-std::array<float,2>{0.167587548f, 0.872764468f},
-std::array<float,2>{0.581679881f, 0.454858065f},
-std::array<float,2>{0.64534837f, 0.9456743f},
-std::array<float,2>{0.0728657171f, 0.339145154f},
-std::array<float,2>{0.412920892f, 0.507027209f},
-std::array<float,2>{0.779611111f, 0.127081752f},
-std::array<float,2>{0.875982881f, 0.848669767f},
-std::array<float,2>{0.253636301f, 0.443412691f},
-std::array<float,2>{0.133706927f, 0.708400249f},
-std::array<float,2>{0.606882572f, 0.0598049462f},
-std::array<float,2>{0.676027656f, 0.522562504f},
-std::array<float,2>{0.11483714f, 0.146517217f},
-std::array<float,2>{0.401365787f, 0.963804841f},
-std::array<float,2>{0.785507679f, 0.319675654f},
-std::array<float,2>{0.858122289f, 0.653556883f},
-std::array<float,2>{0.492083907f, 0.112551086f},
-std::array<float,2>{0.0319061726f, 0.794960022f},
-std::array<float,2>{0.745731473f, 0.402308285f},
-std::array<float,2>{0.541661263f, 0.896230698f},
-std::array<float,2>{0.220239088f, 0.305839926f},
-std::array<float,2>{0.332761288f, 0.610450685f},
-std::array<float,2>{0.955244482f, 0.234739065f},
-std::array<float,2>{0.758842826f, 0.978711843f},
-std::array<float,2>{0.430150181f, 0.366413713f},
-std::array<float,2>{0.0782305151f, 0.533975422f},
-std::array<float,2>{0.627956212f, 0.175975636f},
-std::array<float,2>{0.576849759f, 0.743876457f},
-std::array<float,2>{0.175619066f, 0.0255185198f},
-std::array<float,2>{0.304205358f, 0.823616147f},
-std::array<float,2>{0.925067544f, 0.495003879f},
-std::array<float,2>{0.984646022f, 0.593497813f},
-std::array<float,2>{0.355518639f, 0.192541614f},
-std::array<float,2>{0.206708893f, 0.937345624f},
-std::array<float,2>{0.518058538f, 0.268465459f},
-std::array<float,2>{0.711367965f, 0.753903091f},
-std::array<float,2>{0.000336894416f, 0.408547968f},
-std::array<float,2>{0.441025913f, 0.657084942f},
-std::array<float,2>{0.836249769f, 0.0875536576f},
-std::array<float,2>{0.935801566f, 0.954072416f},
-std::array<float,2>{0.310296029f, 0.323794633f},
-std::array<float,2>{0.182629481f, 0.527284324f},
-std::array<float,2>{0.563849986f, 0.151400134f},
-std::array<float,2>{0.636588335f, 0.712970793f},
-std::array<float,2>{0.0913732573f, 0.0481863096f},
-std::array<float,2>{0.423520595f, 0.855459213f},
-std::array<float,2>{0.754609168f, 0.450113475f},
-std::array<float,2>{0.833278835f, 0.623971879f},
-std::array<float,2>{0.449115515f, 0.245508134f},
-std::array<float,2>{0.0118204709f, 0.903030455f},
-std::array<float,2>{0.707274675f, 0.297919661f},
-std::array<float,2>{0.527751863f, 0.786198735f},
-std::array<float,2>{0.211722806f, 0.392137647f},
-std::array<float,2>{0.348962903f, 0.644701302f},
-std::array<float,2>{0.994881749f, 0.122282617f},
-std::array<float,2>{0.79286325f, 0.813212693f},
-std::array<float,2>{0.397059768f, 0.486762851f},
-std::array<float,2>{0.118574433f, 0.734876692f},
-std::array<float,2>{0.681666195f, 0.0196537506f},
-std::array<float,2>{0.595425308f, 0.539964557f},
-std::array<float,2>{0.131839946f, 0.184213802f},
-std::array<float,2>{0.261871427f, 0.970905781f},
-std::array<float,2>{0.887777686f, 0.374603391f},
-std::array<float,2>{0.964274943f, 0.666421354f},
-std::array<float,2>{0.341311902f, 0.0820080936f},
-std::array<float,2>{0.228794932f, 0.761464775f},
-std::array<float,2>{0.534319043f, 0.420675188f},
-std::array<float,2>{0.74071306f, 0.925141096f},
-std::array<float,2>{0.0411791503f, 0.275029749f},
-std::array<float,2>{0.49460718f, 0.581499219f},
-std::array<float,2>{0.845959246f, 0.202005759f},
-std::array<float,2>{0.980093598f, 0.767371297f},
-std::array<float,2>{0.373608083f, 0.431129903f},
-std::array<float,2>{0.198294938f, 0.685350239f},
-std::array<float,2>{0.502439678f, 0.064963609f},
-std::array<float,2>{0.687944353f, 0.566681921f},
-std::array<float,2>{0.0169055481f, 0.214260355f},
-std::array<float,2>{0.454643428f, 0.910550535f},
-std::array<float,2>{0.82189095f, 0.259613961f},
-std::array<float,2>{0.766872823f, 0.734038591f},
-std::array<float,2>{0.418551624f, 0.0107435323f},
-std::array<float,2>{0.0670314282f, 0.840046167f},
-std::array<float,2>{0.651284695f, 0.471986204f},
-std::array<float,2>{0.589854121f, 0.993516684f},
-std::array<float,2>{0.160327718f, 0.358621448f},
-std::array<float,2>{0.28501007f, 0.559345663f},
-std::array<float,2>{0.915836036f, 0.159080252f},
-std::array<float,2>{0.859897077f, 0.881406963f},
-std::array<float,2>{0.479377389f, 0.281401157f},
-std::array<float,2>{0.0571792461f, 0.596366882f},
-std::array<float,2>{0.730843604f, 0.233955368f},
-std::array<float,2>{0.55665803f, 0.631474555f},
-std::array<float,2>{0.244134694f, 0.10241542f},
-std::array<float,2>{0.317263722f, 0.80440402f},
-std::array<float,2>{0.945436776f, 0.387196809f},
-std::array<float,2>{0.901564479f, 0.514772832f},
-std::array<float,2>{0.2704916f, 0.135713741f},
-std::array<float,2>{0.144362092f, 0.942436576f},
-std::array<float,2>{0.615974426f, 0.334751397f},
-std::array<float,2>{0.659388781f, 0.866540194f},
-std::array<float,2>{0.10708154f, 0.464184195f},
-std::array<float,2>{0.382682711f, 0.698987663f},
-std::array<float,2>{0.797525823f, 0.0449924953f},
-std::array<float,2>{0.999719501f, 0.988824308f},
-std::array<float,2>{0.346027046f, 0.345001191f},
-std::array<float,2>{0.215116993f, 0.552539349f},
-std::array<float,2>{0.527227521f, 0.16995348f},
-std::array<float,2>{0.705739379f, 0.723394513f},
-std::array<float,2>{0.00950499345f, 0.00083100854f},
-std::array<float,2>{0.450812608f, 0.835507154f},
-std::array<float,2>{0.830979526f, 0.479538053f},
-std::array<float,2>{0.753426313f, 0.570786893f},
-std::array<float,2>{0.427791595f, 0.207455441f},
-std::array<float,2>{0.0873592868f, 0.920698106f},
-std::array<float,2>{0.640608728f, 0.2510387f},
-std::array<float,2>{0.568582833f, 0.77914989f},
-std::array<float,2>{0.186856464f, 0.425772578f},
-std::array<float,2>{0.307874024f, 0.673027158f},
-std::array<float,2>{0.932423532f, 0.0706958845f},
-std::array<float,2>{0.848798871f, 0.868751109f},
-std::array<float,2>{0.498027623f, 0.457998484f},
-std::array<float,2>{0.0444151722f, 0.691588819f},
-std::array<float,2>{0.736920118f, 0.0336046368f},
-std::array<float,2>{0.538113892f, 0.502518833f},
-std::array<float,2>{0.231267348f, 0.131819785f},
-std::array<float,2>{0.338375986f, 0.95211488f},
-std::array<float,2>{0.96806252f, 0.340254426f},
-std::array<float,2>{0.884105802f, 0.637953699f},
-std::array<float,2>{0.259603351f, 0.0998569801f},
-std::array<float,2>{0.125469357f, 0.807777703f},
-std::array<float,2>{0.601461828f, 0.380074948f},
-std::array<float,2>{0.686383545f, 0.886592925f},
-std::array<float,2>{0.123877034f, 0.293183982f},
-std::array<float,2>{0.390917361f, 0.609253407f},
-std::array<float,2>{0.794315398f, 0.225188121f},
-std::array<float,2>{0.921023428f, 0.791535497f},
-std::array<float,2>{0.286132127f, 0.405595452f},
-std::array<float,2>{0.157583788f, 0.649750412f},
-std::array<float,2>{0.588383019f, 0.116371967f},
-std::array<float,2>{0.656196237f, 0.613418877f},
-std::array<float,2>{0.064459011f, 0.238587767f},
-std::array<float,2>{0.417433411f, 0.891342759f},
-std::array<float,2>{0.769714594f, 0.310046196f},
-std::array<float,2>{0.824269772f, 0.704959512f},
-std::array<float,2>{0.460087061f, 0.0569400452f},
-std::array<float,2>{0.0206722096f, 0.847345829f},
-std::array<float,2>{0.694219649f, 0.439526588f},
-std::array<float,2>{0.507142425f, 0.967420518f},
-std::array<float,2>{0.202904657f, 0.31453681f},
-std::array<float,2>{0.36833021f, 0.51661694f},
-std::array<float,2>{0.982875645f, 0.142845199f},
-std::array<float,2>{0.803897798f, 0.932937682f},
-std::array<float,2>{0.377004921f, 0.269855022f},
-std::array<float,2>{0.101926029f, 0.587511003f},
-std::array<float,2>{0.661709249f, 0.19133921f},
-std::array<float,2>{0.611965656f, 0.661337733f},
-std::array<float,2>{0.147818491f, 0.0905054733f},
-std::array<float,2>{0.267333418f, 0.754595101f},
-std::array<float,2>{0.902515054f, 0.413516849f},
-std::array<float,2>{0.951391578f, 0.538171589f},
-std::array<float,2>{0.314023495f, 0.174781218f},
-std::array<float,2>{0.247662455f, 0.983092427f},
-std::array<float,2>{0.561080515f, 0.360449195f},
-std::array<float,2>{0.728680074f, 0.825480878f},
-std::array<float,2>{0.0588376373f, 0.496235639f},
-std::array<float,2>{0.483766615f, 0.746294379f},
-std::array<float,2>{0.865368307f, 0.027537249f},
-std::array<float,2>{0.893594027f, 0.90050602f},
-std::array<float,2>{0.277308792f, 0.304574281f},
-std::array<float,2>{0.155094638f, 0.617414176f},
-std::array<float,2>{0.622730136f, 0.247900739f},
-std::array<float,2>{0.664646327f, 0.641541302f},
-std::array<float,2>{0.101499841f, 0.120254561f},
-std::array<float,2>{0.38827768f, 0.782632113f},
-std::array<float,2>{0.80662483f, 0.394638896f},
-std::array<float,2>{0.870994449f, 0.5276407f},
-std::array<float,2>{0.475990117f, 0.156223819f},
-std::array<float,2>{0.0510450117f, 0.958404303f},
-std::array<float,2>{0.724130332f, 0.324236214f},
-std::array<float,2>{0.553436041f, 0.857098579f},
-std::array<float,2>{0.234635338f, 0.44846499f},
-std::array<float,2>{0.325242221f, 0.717465162f},
-std::array<float,2>{0.939351976f, 0.0511897728f},
-std::array<float,2>{0.773937821f, 0.762040913f},
-std::array<float,2>{0.409014553f, 0.417930245f},
-std::array<float,2>{0.0761877f, 0.671221256f},
-std::array<float,2>{0.641525567f, 0.0825197324f},
-std::array<float,2>{0.584088862f, 0.583945453f},
-std::array<float,2>{0.171446994f, 0.197403178f},
-std::array<float,2>{0.294116318f, 0.925967574f},
-std::array<float,2>{0.911630034f, 0.280038387f},
-std::array<float,2>{0.97044605f, 0.740202487f},
-std::array<float,2>{0.36010921f, 0.0167805497f},
-std::array<float,2>{0.191599816f, 0.816452146f},
-std::array<float,2>{0.512550652f, 0.492037177f},
-std::array<float,2>{0.695891857f, 0.974132001f},
-std::array<float,2>{0.0312263388f, 0.368126512f},
-std::array<float,2>{0.46654734f, 0.544052303f},
-std::array<float,2>{0.815205216f, 0.182042599f},
-std::array<float,2>{0.958879471f, 0.838156998f},
-std::array<float,2>{0.32997781f, 0.475362659f},
-std::array<float,2>{0.225596651f, 0.726674855f},
-std::array<float,2>{0.544151545f, 0.0128324041f},
-std::array<float,2>{0.748431146f, 0.557743967f},
-std::array<float,2>{0.0359783284f, 0.160633504f},
-std::array<float,2>{0.48792091f, 0.996478021f},
-std::array<float,2>{0.853391111f, 0.352556348f},
-std::array<float,2>{0.78452903f, 0.681830466f},
-std::array<float,2>{0.405610323f, 0.0700867996f},
-std::array<float,2>{0.109599538f, 0.772142947f},
-std::array<float,2>{0.673484445f, 0.435686082f},
-std::array<float,2>{0.602276385f, 0.910105884f},
-std::array<float,2>{0.13963519f, 0.262718797f},
-std::array<float,2>{0.255429596f, 0.56442064f},
-std::array<float,2>{0.881332815f, 0.217928141f},
-std::array<float,2>{0.843321443f, 0.937723517f},
-std::array<float,2>{0.445097238f, 0.331639707f},
-std::array<float,2>{0.0054190401f, 0.511619329f},
-std::array<float,2>{0.716424167f, 0.14027229f},
-std::array<float,2>{0.519682467f, 0.701527476f},
-std::array<float,2>{0.208243012f, 0.0422868505f},
-std::array<float,2>{0.353014708f, 0.859457791f},
-std::array<float,2>{0.990602016f, 0.465931058f},
-std::array<float,2>{0.927556396f, 0.600244522f},
-std::array<float,2>{0.299034059f, 0.229626685f},
-std::array<float,2>{0.178671047f, 0.877909243f},
-std::array<float,2>{0.5709185f, 0.288888901f},
-std::array<float,2>{0.630436182f, 0.799786866f},
-std::array<float,2>{0.0844884887f, 0.383588642f},
-std::array<float,2>{0.436194062f, 0.626513839f},
-std::array<float,2>{0.764339268f, 0.107131854f},
-std::array<float,2>{0.976186514f, 0.889860809f},
-std::array<float,2>{0.363960207f, 0.289223224f},
-std::array<float,2>{0.191142455f, 0.603166521f},
-std::array<float,2>{0.510911405f, 0.219835579f},
-std::array<float,2>{0.700479209f, 0.633455396f},
-std::array<float,2>{0.0243860502f, 0.0966644958f},
-std::array<float,2>{0.463300854f, 0.811262727f},
-std::array<float,2>{0.818770409f, 0.376143038f},
-std::array<float,2>{0.777701616f, 0.50447166f},
-std::array<float,2>{0.412051409f, 0.126507506f},
-std::array<float,2>{0.0715535134f, 0.948980272f},
-std::array<float,2>{0.647509336f, 0.337134212f},
-std::array<float,2>{0.578540683f, 0.873972893f},
-std::array<float,2>{0.164710298f, 0.456885874f},
-std::array<float,2>{0.289119005f, 0.688489497f},
-std::array<float,2>{0.909111321f, 0.0365250036f},
-std::array<float,2>{0.871899247f, 0.776647449f},
-std::array<float,2>{0.469452292f, 0.427642226f},
-std::array<float,2>{0.0497591943f, 0.678498626f},
-std::array<float,2>{0.721863925f, 0.0768748894f},
-std::array<float,2>{0.549782038f, 0.575311065f},
-std::array<float,2>{0.238481104f, 0.205959976f},
-std::array<float,2>{0.320753992f, 0.916951835f},
-std::array<float,2>{0.94263953f, 0.254171789f},
-std::array<float,2>{0.897515118f, 0.719424605f},
-std::array<float,2>{0.281145096f, 0.00713078352f},
-std::array<float,2>{0.149194613f, 0.831098795f},
-std::array<float,2>{0.618295014f, 0.483703226f},
-std::array<float,2>{0.671846151f, 0.986373365f},
-std::array<float,2>{0.0939397365f, 0.351325333f},
-std::array<float,2>{0.383545667f, 0.54786396f},
-std::array<float,2>{0.811006188f, 0.167410702f},
-std::array<float,2>{0.922550797f, 0.821958244f},
-std::array<float,2>{0.301083863f, 0.492398322f},
-std::array<float,2>{0.172945723f, 0.744262695f},
-std::array<float,2>{0.575089812f, 0.024266202f},
-std::array<float,2>{0.625139236f, 0.532777369f},
-std::array<float,2>{0.0815730095f, 0.178511441f},
-std::array<float,2>{0.432124585f, 0.977784991f},
-std::array<float,2>{0.759895325f, 0.364221454f},
-std::array<float,2>{0.838701487f, 0.659915388f},
-std::array<float,2>{0.438655853f, 0.0897550508f},
-std::array<float,2>{0.00273480616f, 0.75030005f},
-std::array<float,2>{0.71306628f, 0.407084376f},
-std::array<float,2>{0.516574264f, 0.934085488f},
-std::array<float,2>{0.204679757f, 0.266429931f},
-std::array<float,2>{0.358062863f, 0.590937078f},
-std::array<float,2>{0.986640632f, 0.195014104f},
-std::array<float,2>{0.787672222f, 0.961165071f},
-std::array<float,2>{0.398807079f, 0.31799075f},
-std::array<float,2>{0.116121493f, 0.520954132f},
-std::array<float,2>{0.679206431f, 0.145219773f},
-std::array<float,2>{0.608731151f, 0.709764183f},
-std::array<float,2>{0.135943264f, 0.0616275854f},
-std::array<float,2>{0.250031829f, 0.850986898f},
-std::array<float,2>{0.878415644f, 0.44220233f},
-std::array<float,2>{0.953992724f, 0.61170131f},
-std::array<float,2>{0.334098577f, 0.237057194f},
-std::array<float,2>{0.22117281f, 0.896738946f},
-std::array<float,2>{0.539794624f, 0.308589429f},
-std::array<float,2>{0.744045317f, 0.793801904f},
-std::array<float,2>{0.0333742574f, 0.399996758f},
-std::array<float,2>{0.489045322f, 0.655512691f},
-std::array<float,2>{0.857074559f, 0.110807821f},
-std::array<float,2>{0.89044416f, 0.970058143f},
-std::array<float,2>{0.264426738f, 0.372200996f},
-std::array<float,2>{0.129148468f, 0.542028785f},
-std::array<float,2>{0.597444892f, 0.185919285f},
-std::array<float,2>{0.680904567f, 0.736446977f},
-std::array<float,2>{0.119875439f, 0.0224847496f},
-std::array<float,2>{0.394824237f, 0.815305531f},
-std::array<float,2>{0.790957212f, 0.486235231f},
-std::array<float,2>{0.844953835f, 0.579680383f},
-std::array<float,2>{0.493898243f, 0.200565979f},
-std::array<float,2>{0.0400900878f, 0.923548222f},
-std::array<float,2>{0.739481866f, 0.275964826f},
-std::array<float,2>{0.531775296f, 0.758570969f},
-std::array<float,2>{0.227544323f, 0.418049127f},
-std::array<float,2>{0.343035907f, 0.66510582f},
-std::array<float,2>{0.96283561f, 0.078279309f},
-std::array<float,2>{0.756334722f, 0.853201866f},
-std::array<float,2>{0.424169183f, 0.452003837f},
-std::array<float,2>{0.0937422588f, 0.711536467f},
-std::array<float,2>{0.634145677f, 0.0499319024f},
-std::array<float,2>{0.566218197f, 0.524162471f},
-std::array<float,2>{0.181139156f, 0.149073899f},
-std::array<float,2>{0.311517805f, 0.956764162f},
-std::array<float,2>{0.934102476f, 0.321509778f},
-std::array<float,2>{0.992809772f, 0.647374928f},
-std::array<float,2>{0.349970669f, 0.124837436f},
-std::array<float,2>{0.213412985f, 0.787628412f},
-std::array<float,2>{0.530349314f, 0.392763108f},
-std::array<float,2>{0.71046412f, 0.9054178f},
-std::array<float,2>{0.0143329678f, 0.300603479f},
-std::array<float,2>{0.445702046f, 0.621144116f},
-std::array<float,2>{0.834954977f, 0.242864326f},
-std::array<float,2>{0.948027253f, 0.80205977f},
-std::array<float,2>{0.320039421f, 0.389216006f},
-std::array<float,2>{0.244586304f, 0.629692614f},
-std::array<float,2>{0.555623949f, 0.103777222f},
-std::array<float,2>{0.733862638f, 0.595407248f},
-std::array<float,2>{0.0551956147f, 0.23102428f},
-std::array<float,2>{0.478426963f, 0.87910521f},
-std::array<float,2>{0.861662924f, 0.284508318f},
-std::array<float,2>{0.800097942f, 0.697021067f},
-std::array<float,2>{0.380004346f, 0.0434988961f},
-std::array<float,2>{0.107852697f, 0.863846064f},
-std::array<float,2>{0.656460702f, 0.462739378f},
-std::array<float,2>{0.613645256f, 0.945035338f},
-std::array<float,2>{0.14116092f, 0.332733572f},
-std::array<float,2>{0.273195088f, 0.512021303f},
-std::array<float,2>{0.899318695f, 0.134040222f},
-std::array<float,2>{0.822450161f, 0.912281573f},
-std::array<float,2>{0.456137329f, 0.261239737f},
-std::array<float,2>{0.0192129891f, 0.568603337f},
-std::array<float,2>{0.691164315f, 0.212065145f},
-std::array<float,2>{0.500451684f, 0.687140882f},
-std::array<float,2>{0.197254762f, 0.0636313185f},
-std::array<float,2>{0.372051418f, 0.768641233f},
-std::array<float,2>{0.977034092f, 0.431776971f},
-std::array<float,2>{0.917307258f, 0.561623514f},
-std::array<float,2>{0.281562388f, 0.15625459f},
-std::array<float,2>{0.163081527f, 0.995408416f},
-std::array<float,2>{0.59271431f, 0.357293308f},
-std::array<float,2>{0.649007082f, 0.842315078f},
-std::array<float,2>{0.0692811459f, 0.46985814f},
-std::array<float,2>{0.42094475f, 0.731354892f},
-std::array<float,2>{0.768881559f, 0.00839376636f},
-std::array<float,2>{0.965979278f, 0.949281871f},
-std::array<float,2>{0.336221606f, 0.342411667f},
-std::array<float,2>{0.234105468f, 0.501635134f},
-std::array<float,2>{0.536584139f, 0.130557314f},
-std::array<float,2>{0.735617876f, 0.694871008f},
-std::array<float,2>{0.0452358536f, 0.0324257053f},
-std::array<float,2>{0.498650134f, 0.870829403f},
-std::array<float,2>{0.850023568f, 0.459927201f},
-std::array<float,2>{0.796761394f, 0.607327223f},
-std::array<float,2>{0.393078655f, 0.224409625f},
-std::array<float,2>{0.122283511f, 0.884653449f},
-std::array<float,2>{0.684719145f, 0.296685815f},
-std::array<float,2>{0.598307014f, 0.805330455f},
-std::array<float,2>{0.127899557f, 0.381434679f},
-std::array<float,2>{0.260544091f, 0.638690054f},
-std::array<float,2>{0.885630012f, 0.0986338034f},
-std::array<float,2>{0.828629613f, 0.833626807f},
-std::array<float,2>{0.453104138f, 0.476722986f},
-std::array<float,2>{0.011482208f, 0.726203084f},
-std::array<float,2>{0.703687489f, 0.00292861462f},
-std::array<float,2>{0.524416566f, 0.553689539f},
-std::array<float,2>{0.217402503f, 0.169836238f},
-std::array<float,2>{0.344775081f, 0.990590274f},
-std::array<float,2>{0.997784913f, 0.346649408f},
-std::array<float,2>{0.930813432f, 0.674490929f},
-std::array<float,2>{0.305593342f, 0.0731001869f},
-std::array<float,2>{0.183641851f, 0.779362738f},
-std::array<float,2>{0.567261815f, 0.423353225f},
-std::array<float,2>{0.637179017f, 0.91913569f},
-std::array<float,2>{0.0882523358f, 0.252262086f},
-std::array<float,2>{0.426763505f, 0.573806703f},
-std::array<float,2>{0.750299215f, 0.209295005f},
-std::array<float,2>{0.90453285f, 0.757683575f},
-std::array<float,2>{0.268769443f, 0.411830783f},
-std::array<float,2>{0.146010488f, 0.663050115f},
-std::array<float,2>{0.609721124f, 0.0921009332f},
-std::array<float,2>{0.663158298f, 0.588613749f},
-std::array<float,2>{0.104891896f, 0.188647151f},
-std::array<float,2>{0.375305772f, 0.930742383f},
-std::array<float,2>{0.801552415f, 0.271829724f},
-std::array<float,2>{0.86492306f, 0.748847783f},
-std::array<float,2>{0.481590331f, 0.0306818839f},
-std::array<float,2>{0.0619069152f, 0.827029705f},
-std::array<float,2>{0.728040993f, 0.498445034f},
-std::array<float,2>{0.56034404f, 0.980781794f},
-std::array<float,2>{0.249492869f, 0.362908304f},
-std::array<float,2>{0.316171825f, 0.535343587f},
-std::array<float,2>{0.950078309f, 0.172076523f},
-std::array<float,2>{0.772149026f, 0.893519163f},
-std::array<float,2>{0.414615542f, 0.31186524f},
-std::array<float,2>{0.0636411458f, 0.615725279f},
-std::array<float,2>{0.653294325f, 0.241742402f},
-std::array<float,2>{0.587470472f, 0.652183533f},
-std::array<float,2>{0.15852499f, 0.113912828f},
-std::array<float,2>{0.288179189f, 0.789962709f},
-std::array<float,2>{0.918071806f, 0.404041231f},
-std::array<float,2>{0.980522931f, 0.517801821f},
-std::array<float,2>{0.369168252f, 0.141996652f},
-std::array<float,2>{0.199776381f, 0.966450572f},
-std::array<float,2>{0.504226983f, 0.313678592f},
-std::array<float,2>{0.692014873f, 0.845186889f},
-std::array<float,2>{0.022081051f, 0.43801412f},
-std::array<float,2>{0.457649171f, 0.706793308f},
-std::array<float,2>{0.827502847f, 0.0557647496f},
-std::array<float,2>{0.913905799f, 0.928153574f},
-std::array<float,2>{0.295925081f, 0.277825594f},
-std::array<float,2>{0.168255791f, 0.584675789f},
-std::array<float,2>{0.583773255f, 0.19590342f},
-std::array<float,2>{0.644133151f, 0.668359518f},
-std::array<float,2>{0.0752540529f, 0.0858079195f},
-std::array<float,2>{0.408159107f, 0.76425004f},
-std::array<float,2>{0.776497185f, 0.415210366f},
-std::array<float,2>{0.813890517f, 0.546662211f},
-std::array<float,2>{0.46724087f, 0.180492058f},
-std::array<float,2>{0.0277043507f, 0.975366473f},
-std::array<float,2>{0.699158192f, 0.370183855f},
-std::array<float,2>{0.514278889f, 0.818466246f},
-std::array<float,2>{0.19436419f, 0.489055693f},
-std::array<float,2>{0.361696184f, 0.741787851f},
-std::array<float,2>{0.97212553f, 0.0177206304f},
-std::array<float,2>{0.808524787f, 0.784962296f},
-std::array<float,2>{0.389021993f, 0.397954911f},
-std::array<float,2>{0.0992701277f, 0.642964661f},
-std::array<float,2>{0.667244613f, 0.118010409f},
-std::array<float,2>{0.624070346f, 0.620027423f},
-std::array<float,2>{0.154272839f, 0.248999327f},
-std::array<float,2>{0.274306804f, 0.899624705f},
-std::array<float,2>{0.891439974f, 0.302673697f},
-std::array<float,2>{0.940403402f, 0.714871764f},
-std::array<float,2>{0.327222139f, 0.054092437f},
-std::array<float,2>{0.237818539f, 0.857931018f},
-std::array<float,2>{0.55240202f, 0.447064042f},
-std::array<float,2>{0.725466073f, 0.960098207f},
-std::array<float,2>{0.0536336228f, 0.328041524f},
-std::array<float,2>{0.474608988f, 0.530826986f},
-std::array<float,2>{0.869006455f, 0.154046953f},
-std::array<float,2>{0.990181267f, 0.86254245f},
-std::array<float,2>{0.355277926f, 0.468647838f},
-std::array<float,2>{0.209527031f, 0.700297594f},
-std::array<float,2>{0.521953404f, 0.0396760777f},
-std::array<float,2>{0.718119562f, 0.508273304f},
-std::array<float,2>{0.00619197357f, 0.137368321f},
-std::array<float,2>{0.441613555f, 0.940650046f},
-std::array<float,2>{0.840723515f, 0.329626352f},
-std::array<float,2>{0.762288094f, 0.628418744f},
-std::array<float,2>{0.435313314f, 0.108840473f},
-std::array<float,2>{0.083224304f, 0.798576713f},
-std::array<float,2>{0.632427037f, 0.384922117f},
-std::array<float,2>{0.573418975f, 0.876047671f},
-std::array<float,2>{0.176363364f, 0.285802066f},
-std::array<float,2>{0.297237635f, 0.59771508f},
-std::array<float,2>{0.928457439f, 0.226794153f},
-std::array<float,2>{0.854226232f, 0.998604298f},
-std::array<float,2>{0.484894693f, 0.354848474f},
-std::array<float,2>{0.0376456678f, 0.554946601f},
-std::array<float,2>{0.746913195f, 0.163347781f},
-std::array<float,2>{0.546670079f, 0.72995615f},
-std::array<float,2>{0.224348828f, 0.0143378945f},
-std::array<float,2>{0.330573529f, 0.83735919f},
-std::array<float,2>{0.960297227f, 0.473461449f},
-std::array<float,2>{0.880360544f, 0.564844549f},
-std::array<float,2>{0.256372422f, 0.216475815f},
-std::array<float,2>{0.137697592f, 0.907167435f},
-std::array<float,2>{0.605448425f, 0.264600933f},
-std::array<float,2>{0.674984038f, 0.770221651f},
-std::array<float,2>{0.113022536f, 0.433755398f},
-std::array<float,2>{0.404156864f, 0.679963946f},
-std::array<float,2>{0.782327056f, 0.0673650578f},
-std::array<float,2>{0.939071417f, 0.898626268f},
-std::array<float,2>{0.325652003f, 0.301009417f},
-std::array<float,2>{0.234464198f, 0.620695651f},
-std::array<float,2>{0.553634942f, 0.249085337f},
-std::array<float,2>{0.724537134f, 0.643862545f},
-std::array<float,2>{0.050920371f, 0.119077764f},
-std::array<float,2>{0.475610614f, 0.783355713f},
-std::array<float,2>{0.870607615f, 0.397237837f},
-std::array<float,2>{0.806357801f, 0.52967304f},
-std::array<float,2>{0.388475209f, 0.152509034f},
-std::array<float,2>{0.101153024f, 0.959881067f},
-std::array<float,2>{0.664923251f, 0.326205373f},
-std::array<float,2>{0.622944713f, 0.859092057f},
-std::array<float,2>{0.154992267f, 0.445456594f},
-std::array<float,2>{0.277082443f, 0.716336727f},
-std::array<float,2>{0.893863201f, 0.0527581424f},
-std::array<float,2>{0.815098763f, 0.76547575f},
-std::array<float,2>{0.466672182f, 0.414214373f},
-std::array<float,2>{0.0307932235f, 0.669260263f},
-std::array<float,2>{0.696057737f, 0.0841107517f},
-std::array<float,2>{0.512434959f, 0.585900486f},
-std::array<float,2>{0.191803053f, 0.19718051f},
-std::array<float,2>{0.360021383f, 0.928891957f},
-std::array<float,2>{0.970550358f, 0.278528661f},
-std::array<float,2>{0.912097633f, 0.741087735f},
-std::array<float,2>{0.294381529f, 0.0193238109f},
-std::array<float,2>{0.171825528f, 0.820118129f},
-std::array<float,2>{0.584417403f, 0.490229279f},
-std::array<float,2>{0.641126871f, 0.97575891f},
-std::array<float,2>{0.0765699074f, 0.369768411f},
-std::array<float,2>{0.40870598f, 0.545272708f},
-std::array<float,2>{0.774374843f, 0.18159321f},
-std::array<float,2>{0.880926847f, 0.836667061f},
-std::array<float,2>{0.255817592f, 0.473872662f},
-std::array<float,2>{0.13930878f, 0.728890419f},
-std::array<float,2>{0.602471113f, 0.014698959f},
-std::array<float,2>{0.673772216f, 0.556363702f},
-std::array<float,2>{0.109859534f, 0.162676722f},
-std::array<float,2>{0.405426264f, 0.999568582f},
-std::array<float,2>{0.784189701f, 0.353810966f},
-std::array<float,2>{0.853031576f, 0.681046724f},
-std::array<float,2>{0.488212377f, 0.0678290576f},
-std::array<float,2>{0.0358030833f, 0.77128011f},
-std::array<float,2>{0.748194873f, 0.43542248f},
-std::array<float,2>{0.544250786f, 0.907870889f},
-std::array<float,2>{0.225899905f, 0.264674157f},
-std::array<float,2>{0.329637915f, 0.565600634f},
-std::array<float,2>{0.958503008f, 0.215126306f},
-std::array<float,2>{0.764572501f, 0.940336347f},
-std::array<float,2>{0.436309397f, 0.329003036f},
-std::array<float,2>{0.0847989619f, 0.509091973f},
-std::array<float,2>{0.63067168f, 0.138520077f},
-std::array<float,2>{0.571080327f, 0.69982338f},
-std::array<float,2>{0.178461865f, 0.040394403f},
-std::array<float,2>{0.29926604f, 0.861398578f},
-std::array<float,2>{0.927452147f, 0.467393756f},
-std::array<float,2>{0.990451217f, 0.599407434f},
-std::array<float,2>{0.352722824f, 0.228111908f},
-std::array<float,2>{0.208457217f, 0.875792325f},
-std::array<float,2>{0.520000219f, 0.286646485f},
-std::array<float,2>{0.71673578f, 0.797737002f},
-std::array<float,2>{0.00576547114f, 0.385934055f},
-std::array<float,2>{0.445058465f, 0.627522111f},
-std::array<float,2>{0.843637645f, 0.107613042f},
-std::array<float,2>{0.93236804f, 0.99212271f},
-std::array<float,2>{0.307696939f, 0.3468678f},
-std::array<float,2>{0.186537951f, 0.554325402f},
-std::array<float,2>{0.568640649f, 0.168179631f},
-std::array<float,2>{0.640199304f, 0.725290954f},
-std::array<float,2>{0.087027818f, 0.00355583522f},
-std::array<float,2>{0.428016335f, 0.832492828f},
-std::array<float,2>{0.753776193f, 0.478337646f},
-std::array<float,2>{0.830777764f, 0.572820067f},
-std::array<float,2>{0.451047957f, 0.210252583f},
-std::array<float,2>{0.00969948992f, 0.918892801f},
-std::array<float,2>{0.706046522f, 0.253097653f},
-std::array<float,2>{0.526931167f, 0.780671895f},
-std::array<float,2>{0.215034872f, 0.422520638f},
-std::array<float,2>{0.3458004f, 0.674926043f},
-std::array<float,2>{0.999927223f, 0.0735812709f},
-std::array<float,2>{0.794067204f, 0.869214356f},
-std::array<float,2>{0.390852928f, 0.460625917f},
-std::array<float,2>{0.123580709f, 0.693965852f},
-std::array<float,2>{0.68616122f, 0.0318950154f},
-std::array<float,2>{0.601079941f, 0.500252247f},
-std::array<float,2>{0.12501958f, 0.129056692f},
-std::array<float,2>{0.259384066f, 0.951167941f},
-std::array<float,2>{0.883987665f, 0.343345851f},
-std::array<float,2>{0.967935443f, 0.640003681f},
-std::array<float,2>{0.337902933f, 0.0981046706f},
-std::array<float,2>{0.230992958f, 0.806560636f},
-std::array<float,2>{0.538460076f, 0.382154882f},
-std::array<float,2>{0.737207532f, 0.883422375f},
-std::array<float,2>{0.0440712236f, 0.295068175f},
-std::array<float,2>{0.497664988f, 0.605680823f},
-std::array<float,2>{0.848898411f, 0.222713158f},
-std::array<float,2>{0.982453227f, 0.790480316f},
-std::array<float,2>{0.368630737f, 0.402629495f},
-std::array<float,2>{0.202637836f, 0.650587201f},
-std::array<float,2>{0.506880403f, 0.114984289f},
-std::array<float,2>{0.694060445f, 0.617022693f},
-std::array<float,2>{0.0208184924f, 0.241033345f},
-std::array<float,2>{0.46042338f, 0.894198835f},
-std::array<float,2>{0.824549854f, 0.310637742f},
-std::array<float,2>{0.769922495f, 0.705516696f},
-std::array<float,2>{0.417222977f, 0.0555435643f},
-std::array<float,2>{0.0648885891f, 0.843868017f},
-std::array<float,2>{0.655895412f, 0.439293653f},
-std::array<float,2>{0.588650525f, 0.965149939f},
-std::array<float,2>{0.157291144f, 0.312556684f},
-std::array<float,2>{0.285675675f, 0.518790841f},
-std::array<float,2>{0.921152174f, 0.141007215f},
-std::array<float,2>{0.865619004f, 0.930270612f},
-std::array<float,2>{0.483454913f, 0.273341715f},
-std::array<float,2>{0.0589152053f, 0.589435101f},
-std::array<float,2>{0.728863835f, 0.188338414f},
-std::array<float,2>{0.561379492f, 0.6635952f},
-std::array<float,2>{0.247985587f, 0.0929639339f},
-std::array<float,2>{0.314372927f, 0.756250381f},
-std::array<float,2>{0.951643884f, 0.410916924f},
-std::array<float,2>{0.902779281f, 0.536427617f},
-std::array<float,2>{0.267359674f, 0.172976911f},
-std::array<float,2>{0.147657573f, 0.981755614f},
-std::array<float,2>{0.612254202f, 0.362272471f},
-std::array<float,2>{0.661988854f, 0.827789962f},
-std::array<float,2>{0.10157489f, 0.499709666f},
-std::array<float,2>{0.377296567f, 0.749872744f},
-std::array<float,2>{0.804104447f, 0.0302153099f},
-std::array<float,2>{0.9947052f, 0.955476165f},
-std::array<float,2>{0.348730356f, 0.320526183f},
-std::array<float,2>{0.211507916f, 0.524637759f},
-std::array<float,2>{0.527356505f, 0.150164887f},
-std::array<float,2>{0.707287014f, 0.712641537f},
-std::array<float,2>{0.0121967867f, 0.0496991612f},
-std::array<float,2>{0.448889524f, 0.852146924f},
-std::array<float,2>{0.833144128f, 0.452265203f},
-std::array<float,2>{0.754790366f, 0.622103035f},
-std::array<float,2>{0.423585653f, 0.243650958f},
-std::array<float,2>{0.0916966051f, 0.905153334f},
-std::array<float,2>{0.636330247f, 0.298974097f},
-std::array<float,2>{0.563631058f, 0.788844943f},
-std::array<float,2>{0.183060884f, 0.394297659f},
-std::array<float,2>{0.310431778f, 0.6476897f},
-std::array<float,2>{0.935676634f, 0.123565257f},
-std::array<float,2>{0.845870793f, 0.815684438f},
-std::array<float,2>{0.494279474f, 0.485169262f},
-std::array<float,2>{0.0414734036f, 0.737828076f},
-std::array<float,2>{0.74043864f, 0.0220995005f},
-std::array<float,2>{0.534565806f, 0.541270137f},
-std::array<float,2>{0.228523925f, 0.187376291f},
-std::array<float,2>{0.341554731f, 0.969229877f},
-std::array<float,2>{0.963989556f, 0.371197373f},
-std::array<float,2>{0.88817203f, 0.664160073f},
-std::array<float,2>{0.26215452f, 0.0791289285f},
-std::array<float,2>{0.132114202f, 0.759081364f},
-std::array<float,2>{0.595610023f, 0.418983191f},
-std::array<float,2>{0.682059586f, 0.922606289f},
-std::array<float,2>{0.118406139f, 0.276452482f},
-std::array<float,2>{0.397253454f, 0.578667045f},
-std::array<float,2>{0.792576015f, 0.199625283f},
-std::array<float,2>{0.915766418f, 0.767848194f},
-std::array<float,2>{0.284885466f, 0.433474213f},
-std::array<float,2>{0.160630479f, 0.68589133f},
-std::array<float,2>{0.590235829f, 0.062892817f},
-std::array<float,2>{0.650966525f, 0.570052266f},
-std::array<float,2>{0.0672268942f, 0.211665064f},
-std::array<float,2>{0.418860286f, 0.91386956f},
-std::array<float,2>{0.766761243f, 0.260211289f},
-std::array<float,2>{0.822070241f, 0.731526792f},
-std::array<float,2>{0.454888314f, 0.00955155585f},
-std::array<float,2>{0.0166641474f, 0.843578875f},
-std::array<float,2>{0.687710285f, 0.469203681f},
-std::array<float,2>{0.502077162f, 0.995071709f},
-std::array<float,2>{0.198510155f, 0.355537027f},
-std::array<float,2>{0.373862267f, 0.560592949f},
-std::array<float,2>{0.98041141f, 0.157650352f},
-std::array<float,2>{0.797755659f, 0.880377948f},
-std::array<float,2>{0.382526755f, 0.283867627f},
-std::array<float,2>{0.107331045f, 0.594316006f},
-std::array<float,2>{0.659427643f, 0.232152253f},
-std::array<float,2>{0.615898192f, 0.630310357f},
-std::array<float,2>{0.144235924f, 0.104799852f},
-std::array<float,2>{0.270125002f, 0.800842524f},
-std::array<float,2>{0.901769459f, 0.390148282f},
-std::array<float,2>{0.945657134f, 0.513586402f},
-std::array<float,2>{0.316939503f, 0.133529902f},
-std::array<float,2>{0.243731797f, 0.943620503f},
-std::array<float,2>{0.557114065f, 0.333424538f},
-std::array<float,2>{0.730648935f, 0.864385903f},
-std::array<float,2>{0.0573971383f, 0.461744815f},
-std::array<float,2>{0.479174048f, 0.695371807f},
-std::array<float,2>{0.860278964f, 0.0445411988f},
-std::array<float,2>{0.89530158f, 0.917598546f},
-std::array<float,2>{0.278239757f, 0.255343467f},
-std::array<float,2>{0.151237249f, 0.574344337f},
-std::array<float,2>{0.620419264f, 0.206775501f},
-std::array<float,2>{0.66967231f, 0.679431021f},
-std::array<float,2>{0.0957038179f, 0.0779533312f},
-std::array<float,2>{0.384981275f, 0.775788963f},
-std::array<float,2>{0.809513152f, 0.425977886f},
-std::array<float,2>{0.87414372f, 0.547019362f},
-std::array<float,2>{0.471028f, 0.166698217f},
-std::array<float,2>{0.0487978682f, 0.98817575f},
-std::array<float,2>{0.720393777f, 0.350551039f},
-std::array<float,2>{0.547272325f, 0.83031249f},
-std::array<float,2>{0.242054224f, 0.482443452f},
-std::array<float,2>{0.323323041f, 0.720585287f},
-std::array<float,2>{0.944515705f, 0.00638566772f},
-std::array<float,2>{0.779533029f, 0.812009156f},
-std::array<float,2>{0.4127509f, 0.375732839f},
-std::array<float,2>{0.0732380375f, 0.634402275f},
-std::array<float,2>{0.645031631f, 0.0972722545f},
-std::array<float,2>{0.581890702f, 0.602362216f},
-std::array<float,2>{0.167847127f, 0.219317645f},
-std::array<float,2>{0.292505324f, 0.889120042f},
-std::array<float,2>{0.907687068f, 0.290725291f},
-std::array<float,2>{0.974187851f, 0.687559128f},
-std::array<float,2>{0.366161883f, 0.036089994f},
-std::array<float,2>{0.187814012f, 0.874085307f},
-std::array<float,2>{0.509052753f, 0.455569148f},
-std::array<float,2>{0.701654077f, 0.947707355f},
-std::array<float,2>{0.0262532663f, 0.336361021f},
-std::array<float,2>{0.461340666f, 0.505136907f},
-std::array<float,2>{0.816416383f, 0.125581503f},
-std::array<float,2>{0.955326021f, 0.850138128f},
-std::array<float,2>{0.332930118f, 0.442576826f},
-std::array<float,2>{0.220674425f, 0.710488737f},
-std::array<float,2>{0.541867316f, 0.0611790456f},
-std::array<float,2>{0.746065259f, 0.520075619f},
-std::array<float,2>{0.0319894738f, 0.146308199f},
-std::array<float,2>{0.491771936f, 0.961999238f},
-std::array<float,2>{0.858206272f, 0.316587895f},
-std::array<float,2>{0.78516525f, 0.654629767f},
-std::array<float,2>{0.401104748f, 0.109699577f},
-std::array<float,2>{0.115022115f, 0.794746041f},
-std::array<float,2>{0.675869524f, 0.399357051f},
-std::array<float,2>{0.606610715f, 0.898146033f},
-std::array<float,2>{0.133514702f, 0.30753541f},
-std::array<float,2>{0.25382185f, 0.613234043f},
-std::array<float,2>{0.876445889f, 0.238277346f},
-std::array<float,2>{0.835997939f, 0.977003813f},
-std::array<float,2>{0.441338152f, 0.364794433f},
-std::array<float,2>{0.000131452834f, 0.531661451f},
-std::array<float,2>{0.711093962f, 0.179229647f},
-std::array<float,2>{0.517710924f, 0.745661199f},
-std::array<float,2>{0.20695281f, 0.0253151953f},
-std::array<float,2>{0.355758667f, 0.820878327f},
-std::array<float,2>{0.984430075f, 0.493501395f},
-std::array<float,2>{0.924989104f, 0.590679884f},
-std::array<float,2>{0.304617822f, 0.19404836f},
-std::array<float,2>{0.175338835f, 0.935158014f},
-std::array<float,2>{0.577094853f, 0.267471939f},
-std::array<float,2>{0.628377199f, 0.751077771f},
-std::array<float,2>{0.0784936771f, 0.408186406f},
-std::array<float,2>{0.429888278f, 0.658818364f},
-std::array<float,2>{0.759232581f, 0.0885389373f},
-std::array<float,2>{0.971838474f, 0.927458286f},
-std::array<float,2>{0.361471742f, 0.280932754f},
-std::array<float,2>{0.19464463f, 0.582641602f},
-std::array<float,2>{0.514578581f, 0.199198067f},
-std::array<float,2>{0.698831201f, 0.670310676f},
-std::array<float,2>{0.0275273975f, 0.0837235525f},
-std::array<float,2>{0.467017561f, 0.763358295f},
-std::array<float,2>{0.813588262f, 0.41606313f},
-std::array<float,2>{0.776804447f, 0.543714523f},
-std::array<float,2>{0.407907963f, 0.183337167f},
-std::array<float,2>{0.0756105557f, 0.972671211f},
-std::array<float,2>{0.644329786f, 0.368721187f},
-std::array<float,2>{0.583540618f, 0.817762315f},
-std::array<float,2>{0.167977959f, 0.490600824f},
-std::array<float,2>{0.296154559f, 0.738777339f},
-std::array<float,2>{0.913711727f, 0.0164888017f},
-std::array<float,2>{0.868792892f, 0.781398475f},
-std::array<float,2>{0.474156559f, 0.395560026f},
-std::array<float,2>{0.0533949025f, 0.641930461f},
-std::array<float,2>{0.725146472f, 0.11940866f},
-std::array<float,2>{0.552722216f, 0.618197262f},
-std::array<float,2>{0.23826012f, 0.246572822f},
-std::array<float,2>{0.327509582f, 0.901851594f},
-std::array<float,2>{0.939980745f, 0.30342567f},
-std::array<float,2>{0.891136646f, 0.718576372f},
-std::array<float,2>{0.274092048f, 0.0523491316f},
-std::array<float,2>{0.153888628f, 0.856308281f},
-std::array<float,2>{0.624406755f, 0.447328955f},
-std::array<float,2>{0.667116165f, 0.957169473f},
-std::array<float,2>{0.0994568691f, 0.325849414f},
-std::array<float,2>{0.388841659f, 0.529107988f},
-std::array<float,2>{0.808171034f, 0.154851779f},
-std::array<float,2>{0.928622603f, 0.861212909f},
-std::array<float,2>{0.297020942f, 0.465627462f},
-std::array<float,2>{0.176623672f, 0.702250242f},
-std::array<float,2>{0.573518038f, 0.0419882499f},
-std::array<float,2>{0.632708013f, 0.510549664f},
-std::array<float,2>{0.0834535584f, 0.139252722f},
-std::array<float,2>{0.435218811f, 0.938720703f},
-std::array<float,2>{0.762548268f, 0.330804437f},
-std::array<float,2>{0.840493202f, 0.625658274f},
-std::array<float,2>{0.441686273f, 0.106090315f},
-std::array<float,2>{0.00606144406f, 0.799992085f},
-std::array<float,2>{0.717828393f, 0.383806765f},
-std::array<float,2>{0.521515727f, 0.878327549f},
-std::array<float,2>{0.209855109f, 0.287488639f},
-std::array<float,2>{0.355118066f, 0.601407528f},
-std::array<float,2>{0.98990339f, 0.228608608f},
-std::array<float,2>{0.782614529f, 0.99787569f},
-std::array<float,2>{0.403990597f, 0.352149665f},
-std::array<float,2>{0.113041036f, 0.557390451f},
-std::array<float,2>{0.67516768f, 0.161251679f},
-std::array<float,2>{0.605093062f, 0.728229821f},
-std::array<float,2>{0.137960196f, 0.0119870221f},
-std::array<float,2>{0.256652504f, 0.839575589f},
-std::array<float,2>{0.879915953f, 0.475738168f},
-std::array<float,2>{0.960204601f, 0.563008904f},
-std::array<float,2>{0.330994248f, 0.217329726f},
-std::array<float,2>{0.224596158f, 0.908911049f},
-std::array<float,2>{0.546465278f, 0.262331128f},
-std::array<float,2>{0.746816099f, 0.77321893f},
-std::array<float,2>{0.0378437489f, 0.436823457f},
-std::array<float,2>{0.48513335f, 0.683347046f},
-std::array<float,2>{0.854370594f, 0.068863295f},
-std::array<float,2>{0.885285139f, 0.952251196f},
-std::array<float,2>{0.260254949f, 0.341063619f},
-std::array<float,2>{0.127660543f, 0.503289938f},
-std::array<float,2>{0.598540187f, 0.13279213f},
-std::array<float,2>{0.684879184f, 0.693055272f},
-std::array<float,2>{0.12233641f, 0.034978427f},
-std::array<float,2>{0.393519908f, 0.868073583f},
-std::array<float,2>{0.796481848f, 0.458511412f},
-std::array<float,2>{0.849714696f, 0.607704461f},
-std::array<float,2>{0.498780608f, 0.226367563f},
-std::array<float,2>{0.0451543964f, 0.885196567f},
-std::array<float,2>{0.735480011f, 0.294319153f},
-std::array<float,2>{0.536328912f, 0.807358682f},
-std::array<float,2>{0.234311953f, 0.378977537f},
-std::array<float,2>{0.336114913f, 0.637506425f},
-std::array<float,2>{0.966192365f, 0.100652501f},
-std::array<float,2>{0.750128567f, 0.834466994f},
-std::array<float,2>{0.427206427f, 0.479387403f},
-std::array<float,2>{0.0881282315f, 0.72393167f},
-std::array<float,2>{0.63673538f, 0.00187832699f},
-std::array<float,2>{0.566925108f, 0.551690936f},
-std::array<float,2>{0.183929086f, 0.171308488f},
-std::array<float,2>{0.305338115f, 0.990106881f},
-std::array<float,2>{0.930984437f, 0.344188929f},
-std::array<float,2>{0.997866392f, 0.6719414f},
-std::array<float,2>{0.345086336f, 0.0714972392f},
-std::array<float,2>{0.217547432f, 0.777496576f},
-std::array<float,2>{0.524833083f, 0.4243038f},
-std::array<float,2>{0.703876257f, 0.921379507f},
-std::array<float,2>{0.0113143185f, 0.250947148f},
-std::array<float,2>{0.4528611f, 0.571597576f},
-std::array<float,2>{0.829049468f, 0.208257079f},
-std::array<float,2>{0.949868977f, 0.755605042f},
-std::array<float,2>{0.316128045f, 0.412570745f},
-std::array<float,2>{0.249145046f, 0.660178423f},
-std::array<float,2>{0.560189247f, 0.0911904424f},
-std::array<float,2>{0.728427112f, 0.586798549f},
-std::array<float,2>{0.0616063662f, 0.190244287f},
-std::array<float,2>{0.481734782f, 0.932574272f},
-std::array<float,2>{0.86501801f, 0.271183401f},
-std::array<float,2>{0.801312923f, 0.747463167f},
-std::array<float,2>{0.37509796f, 0.0284653027f},
-std::array<float,2>{0.104722179f, 0.824907184f},
-std::array<float,2>{0.663393319f, 0.497190267f},
-std::array<float,2>{0.609387636f, 0.984221995f},
-std::array<float,2>{0.146286175f, 0.360207766f},
-std::array<float,2>{0.269011796f, 0.538047552f},
-std::array<float,2>{0.904628873f, 0.175345883f},
-std::array<float,2>{0.827238977f, 0.891973138f},
-std::array<float,2>{0.457805067f, 0.308957875f},
-std::array<float,2>{0.0224019568f, 0.614809394f},
-std::array<float,2>{0.69230926f, 0.23960802f},
-std::array<float,2>{0.504078448f, 0.648716867f},
-std::array<float,2>{0.200149879f, 0.116056152f},
-std::array<float,2>{0.369561523f, 0.792707562f},
-std::array<float,2>{0.980941534f, 0.404758334f},
-std::array<float,2>{0.918348849f, 0.5159989f},
-std::array<float,2>{0.288341939f, 0.144028068f},
-std::array<float,2>{0.158435777f, 0.968701005f},
-std::array<float,2>{0.587754369f, 0.315846413f},
-std::array<float,2>{0.652970374f, 0.845816791f},
-std::array<float,2>{0.0638546199f, 0.440844178f},
-std::array<float,2>{0.415029347f, 0.703133583f},
-std::array<float,2>{0.772455752f, 0.0584763959f},
-std::array<float,2>{0.96253264f, 0.971981049f},
-std::array<float,2>{0.342862129f, 0.373999119f},
-std::array<float,2>{0.227962598f, 0.540665209f},
-std::array<float,2>{0.532164335f, 0.184835151f},
-std::array<float,2>{0.739534914f, 0.735851526f},
-std::array<float,2>{0.0403489955f, 0.0214676708f},
-std::array<float,2>{0.493810505f, 0.813808858f},
-std::array<float,2>{0.845081806f, 0.487526089f},
-std::array<float,2>{0.790671229f, 0.580660462f},
-std::array<float,2>{0.39464587f, 0.202994838f},
-std::array<float,2>{0.119753622f, 0.92393595f},
-std::array<float,2>{0.680936456f, 0.273993641f},
-std::array<float,2>{0.597338676f, 0.759954274f},
-std::array<float,2>{0.129393607f, 0.421282798f},
-std::array<float,2>{0.264228642f, 0.66764468f},
-std::array<float,2>{0.890161812f, 0.0810525864f},
-std::array<float,2>{0.834489167f, 0.85404259f},
-std::array<float,2>{0.445473701f, 0.450773478f},
-std::array<float,2>{0.0145669738f, 0.71437788f},
-std::array<float,2>{0.710847139f, 0.0473807789f},
-std::array<float,2>{0.530713141f, 0.525900602f},
-std::array<float,2>{0.213793606f, 0.151023179f},
-std::array<float,2>{0.349731803f, 0.955000401f},
-std::array<float,2>{0.993155181f, 0.323146284f},
-std::array<float,2>{0.934542835f, 0.64559716f},
-std::array<float,2>{0.311219424f, 0.122030474f},
-std::array<float,2>{0.180818826f, 0.785865486f},
-std::array<float,2>{0.566136897f, 0.391182065f},
-std::array<float,2>{0.633901417f, 0.903670728f},
-std::array<float,2>{0.0932807252f, 0.297475398f},
-std::array<float,2>{0.423977673f, 0.624762475f},
-std::array<float,2>{0.755897105f, 0.244539052f},
-std::array<float,2>{0.898989379f, 0.80343014f},
-std::array<float,2>{0.273134947f, 0.388078332f},
-std::array<float,2>{0.141390681f, 0.631860971f},
-std::array<float,2>{0.613417745f, 0.103405587f},
-std::array<float,2>{0.656677186f, 0.597480059f},
-std::array<float,2>{0.107559547f, 0.233077392f},
-std::array<float,2>{0.380322933f, 0.882203758f},
-std::array<float,2>{0.799809515f, 0.282931894f},
-std::array<float,2>{0.861551166f, 0.697608411f},
-std::array<float,2>{0.478073388f, 0.0465507433f},
-std::array<float,2>{0.0554449186f, 0.865931451f},
-std::array<float,2>{0.733633637f, 0.463442475f},
-std::array<float,2>{0.555393159f, 0.942291319f},
-std::array<float,2>{0.244285464f, 0.335845023f},
-std::array<float,2>{0.32013467f, 0.514570355f},
-std::array<float,2>{0.947826743f, 0.136177123f},
-std::array<float,2>{0.768572867f, 0.91162926f},
-std::array<float,2>{0.421242595f, 0.258202106f},
-std::array<float,2>{0.0690162703f, 0.568224847f},
-std::array<float,2>{0.649322748f, 0.213048875f},
-std::array<float,2>{0.592459202f, 0.6842767f},
-std::array<float,2>{0.162637144f, 0.0662832409f},
-std::array<float,2>{0.281445414f, 0.766120493f},
-std::array<float,2>{0.917014301f, 0.430228949f},
-std::array<float,2>{0.976681948f, 0.560423434f},
-std::array<float,2>{0.371621042f, 0.159642115f},
-std::array<float,2>{0.196958333f, 0.992564201f},
-std::array<float,2>{0.500205576f, 0.357822418f},
-std::array<float,2>{0.690918922f, 0.841581404f},
-std::array<float,2>{0.0195145123f, 0.471539706f},
-std::array<float,2>{0.456356019f, 0.732507706f},
-std::array<float,2>{0.822653055f, 0.00980209466f},
-std::array<float,2>{0.908698142f, 0.887374818f},
-std::array<float,2>{0.289367348f, 0.292461872f},
-std::array<float,2>{0.164906174f, 0.605098426f},
-std::array<float,2>{0.578232706f, 0.221482739f},
-std::array<float,2>{0.647785187f, 0.635990858f},
-std::array<float,2>{0.0714968964f, 0.0956132263f},
-std::array<float,2>{0.411653906f, 0.810392618f},
-std::array<float,2>{0.77744776f, 0.377315909f},
-std::array<float,2>{0.818565309f, 0.50640142f},
-std::array<float,2>{0.463096499f, 0.128085285f},
-std::array<float,2>{0.0241119005f, 0.946384966f},
-std::array<float,2>{0.700353146f, 0.337980598f},
-std::array<float,2>{0.511222839f, 0.871565759f},
-std::array<float,2>{0.19137834f, 0.453634202f},
-std::array<float,2>{0.364061058f, 0.691125333f},
-std::array<float,2>{0.976333976f, 0.0385503545f},
-std::array<float,2>{0.810639977f, 0.77386415f},
-std::array<float,2>{0.38333565f, 0.429005831f},
-std::array<float,2>{0.0942198262f, 0.676700413f},
-std::array<float,2>{0.671561122f, 0.0745492503f},
-std::array<float,2>{0.61857307f, 0.576429427f},
-std::array<float,2>{0.148972824f, 0.203290999f},
-std::array<float,2>{0.280840039f, 0.914519966f},
-std::array<float,2>{0.897738814f, 0.256484598f},
-std::array<float,2>{0.942424297f, 0.72180301f},
-std::array<float,2>{0.320342124f, 0.00527281361f},
-std::array<float,2>{0.238588274f, 0.829208791f},
-std::array<float,2>{0.549482346f, 0.481217593f},
-std::array<float,2>{0.721930504f, 0.984937251f},
-std::array<float,2>{0.0495356657f, 0.34790346f},
-std::array<float,2>{0.469560653f, 0.549629509f},
-std::array<float,2>{0.871781647f, 0.165364861f},
-std::array<float,2>{0.98654443f, 0.823189557f},
-std::array<float,2>{0.358321607f, 0.495314896f},
-std::array<float,2>{0.205028385f, 0.743143857f},
-std::array<float,2>{0.516353905f, 0.0266353153f},
-std::array<float,2>{0.713135183f, 0.53478682f},
-std::array<float,2>{0.00264492584f, 0.177583486f},
-std::array<float,2>{0.438916087f, 0.980433822f},
-std::array<float,2>{0.838484287f, 0.36607644f},
-std::array<float,2>{0.760141551f, 0.657770932f},
-std::array<float,2>{0.431843817f, 0.0860624164f},
-std::array<float,2>{0.0819735751f, 0.75214386f},
-std::array<float,2>{0.625445902f, 0.410145968f},
-std::array<float,2>{0.5749349f, 0.936477959f},
-std::array<float,2>{0.173291519f, 0.269488245f},
-std::array<float,2>{0.30082044f, 0.591935515f},
-std::array<float,2>{0.922751427f, 0.192128792f},
-std::array<float,2>{0.857196629f, 0.964127183f},
-std::array<float,2>{0.488939255f, 0.318521351f},
-std::array<float,2>{0.0335504673f, 0.5223279f},
-std::array<float,2>{0.743740082f, 0.148112148f},
-std::array<float,2>{0.539806008f, 0.70755899f},
-std::array<float,2>{0.220809981f, 0.0592846237f},
-std::array<float,2>{0.334465772f, 0.848328888f},
-std::array<float,2>{0.953632951f, 0.444691032f},
-std::array<float,2>{0.877950966f, 0.609772086f},
-std::array<float,2>{0.250484645f, 0.235568076f},
-std::array<float,2>{0.136131808f, 0.895415068f},
-std::array<float,2>{0.608454287f, 0.305014938f},
-std::array<float,2>{0.67954278f, 0.796664834f},
-std::array<float,2>{0.115887344f, 0.400615543f},
-std::array<float,2>{0.39854753f, 0.652658343f},
-std::array<float,2>{0.788063705f, 0.11197117f},
-std::array<float,2>{0.957555175f, 0.909275353f},
-std::array<float,2>{0.328933686f, 0.263380319f},
-std::array<float,2>{0.225372568f, 0.563571274f},
-std::array<float,2>{0.54313916f, 0.218658134f},
-std::array<float,2>{0.749112606f, 0.682136714f},
-std::array<float,2>{0.0362753645f, 0.0693584085f},
-std::array<float,2>{0.48693496f, 0.771585822f},
-std::array<float,2>{0.852015555f, 0.436428517f},
-std::array<float,2>{0.784032941f, 0.558497012f},
-std::array<float,2>{0.404414356f, 0.161034152f},
-std::array<float,2>{0.110417798f, 0.996739686f},
-std::array<float,2>{0.672093213f, 0.353062421f},
-std::array<float,2>{0.603191912f, 0.838812888f},
-std::array<float,2>{0.139672473f, 0.475078434f},
-std::array<float,2>{0.254054129f, 0.727058053f},
-std::array<float,2>{0.88211f, 0.013330048f},
-std::array<float,2>{0.842124343f, 0.79891187f},
-std::array<float,2>{0.444015414f, 0.383206338f},
-std::array<float,2>{0.00478312606f, 0.626132607f},
-std::array<float,2>{0.715458691f, 0.106772013f},
-std::array<float,2>{0.520566404f, 0.599750102f},
-std::array<float,2>{0.20768559f, 0.230038092f},
-std::array<float,2>{0.351651013f, 0.877389371f},
-std::array<float,2>{0.991854846f, 0.288222492f},
-std::array<float,2>{0.926505506f, 0.701687336f},
-std::array<float,2>{0.300474912f, 0.0429442562f},
-std::array<float,2>{0.179041237f, 0.860252023f},
-std::array<float,2>{0.571341097f, 0.46631813f},
-std::array<float,2>{0.629352808f, 0.938020885f},
-std::array<float,2>{0.0854289681f, 0.331499875f},
-std::array<float,2>{0.437439591f, 0.510907948f},
-std::array<float,2>{0.764661014f, 0.140133217f},
-std::array<float,2>{0.893081009f, 0.85691011f},
-std::array<float,2>{0.276153803f, 0.449060529f},
-std::array<float,2>{0.155480474f, 0.717094362f},
-std::array<float,2>{0.62154603f, 0.0515925251f},
-std::array<float,2>{0.66569972f, 0.527870595f},
-std::array<float,2>{0.099698022f, 0.155273691f},
-std::array<float,2>{0.387693524f, 0.95870918f},
-std::array<float,2>{0.804760635f, 0.324810028f},
-std::array<float,2>{0.869403422f, 0.641089678f},
-std::array<float,2>{0.474737853f, 0.121087432f},
-std::array<float,2>{0.0522423387f, 0.783001244f},
-std::array<float,2>{0.722781241f, 0.395183593f},
-std::array<float,2>{0.554238856f, 0.901095271f},
-std::array<float,2>{0.23580806f, 0.303873897f},
-std::array<float,2>{0.324567676f, 0.618091881f},
-std::array<float,2>{0.937971413f, 0.247441217f},
-std::array<float,2>{0.775349855f, 0.973773003f},
-std::array<float,2>{0.409358352f, 0.367268562f},
-std::array<float,2>{0.0775755867f, 0.54459101f},
-std::array<float,2>{0.641767621f, 0.182554141f},
-std::array<float,2>{0.585399508f, 0.739575863f},
-std::array<float,2>{0.170688033f, 0.017155122f},
-std::array<float,2>{0.293456107f, 0.817350566f},
-std::array<float,2>{0.910564065f, 0.491531491f},
-std::array<float,2>{0.969136775f, 0.583339095f},
-std::array<float,2>{0.361233622f, 0.198229939f},
-std::array<float,2>{0.193206146f, 0.926716626f},
-std::array<float,2>{0.51340878f, 0.27963835f},
-std::array<float,2>{0.69643271f, 0.762219965f},
-std::array<float,2>{0.0293498263f, 0.417136103f},
-std::array<float,2>{0.465553641f, 0.671689391f},
-std::array<float,2>{0.815530181f, 0.0820896402f},
-std::array<float,2>{0.920347691f, 0.96681124f},
-std::array<float,2>{0.286987633f, 0.315096349f},
-std::array<float,2>{0.156260699f, 0.517295301f},
-std::array<float,2>{0.58948952f, 0.143308312f},
-std::array<float,2>{0.654969752f, 0.704308629f},
-std::array<float,2>{0.0657765493f, 0.0571683571f},
-std::array<float,2>{0.416878313f, 0.846928656f},
-std::array<float,2>{0.770947695f, 0.440084249f},
-std::array<float,2>{0.825207114f, 0.614041626f},
-std::array<float,2>{0.459244788f, 0.238831073f},
-std::array<float,2>{0.0197256692f, 0.891097367f},
-std::array<float,2>{0.695022821f, 0.310534984f},
-std::array<float,2>{0.506448388f, 0.791383207f},
-std::array<float,2>{0.201920912f, 0.406147033f},
-std::array<float,2>{0.367530972f, 0.650251448f},
-std::array<float,2>{0.983846784f, 0.117037073f},
-std::array<float,2>{0.803313553f, 0.825838864f},
-std::array<float,2>{0.378440738f, 0.496666282f},
-std::array<float,2>{0.102889262f, 0.746759415f},
-std::array<float,2>{0.660552859f, 0.0278389808f},
-std::array<float,2>{0.61316067f, 0.539000452f},
-std::array<float,2>{0.146520764f, 0.173832491f},
-std::array<float,2>{0.266347617f, 0.982898593f},
-std::array<float,2>{0.903449774f, 0.361259162f},
-std::array<float,2>{0.952909112f, 0.661919713f},
-std::array<float,2>{0.312841684f, 0.0901913345f},
-std::array<float,2>{0.24620761f, 0.7541309f},
-std::array<float,2>{0.562259138f, 0.414031982f},
-std::array<float,2>{0.730379164f, 0.933349609f},
-std::array<float,2>{0.0603820384f, 0.270074576f},
-std::array<float,2>{0.48319903f, 0.587011039f},
-std::array<float,2>{0.866301298f, 0.190716937f},
-std::array<float,2>{0.998636425f, 0.77842921f},
-std::array<float,2>{0.347646385f, 0.425194532f},
-std::array<float,2>{0.216073662f, 0.67366004f},
-std::array<float,2>{0.52568841f, 0.0711968839f},
-std::array<float,2>{0.706084788f, 0.571004808f},
-std::array<float,2>{0.00827689841f, 0.207534924f},
-std::array<float,2>{0.449594408f, 0.920322239f},
-std::array<float,2>{0.832011998f, 0.25151071f},
-std::array<float,2>{0.752283514f, 0.722951412f},
-std::array<float,2>{0.42954579f, 0.000109194145f},
-std::array<float,2>{0.0863253251f, 0.834964812f},
-std::array<float,2>{0.639325976f, 0.480352134f},
-std::array<float,2>{0.569635987f, 0.988319516f},
-std::array<float,2>{0.186122522f, 0.345594496f},
-std::array<float,2>{0.307524562f, 0.55186969f},
-std::array<float,2>{0.932880282f, 0.170832872f},
-std::array<float,2>{0.848493934f, 0.886125147f},
-std::array<float,2>{0.496225953f, 0.293754011f},
-std::array<float,2>{0.0431857072f, 0.608490467f},
-std::array<float,2>{0.737662554f, 0.224987447f},
-std::array<float,2>{0.537474453f, 0.63860625f},
-std::array<float,2>{0.232035413f, 0.100133605f},
-std::array<float,2>{0.339738071f, 0.808467329f},
-std::array<float,2>{0.967592239f, 0.380467892f},
-std::array<float,2>{0.883656144f, 0.502025008f},
-std::array<float,2>{0.257965237f, 0.131215423f},
-std::array<float,2>{0.125999525f, 0.951207817f},
-std::array<float,2>{0.600583136f, 0.34039408f},
-std::array<float,2>{0.686751127f, 0.86831969f},
-std::array<float,2>{0.124317639f, 0.457316309f},
-std::array<float,2>{0.392143607f, 0.692102432f},
-std::array<float,2>{0.793813169f, 0.0341706611f},
-std::array<float,2>{0.978822112f, 0.993993521f},
-std::array<float,2>{0.374023646f, 0.359360605f},
-std::array<float,2>{0.197897762f, 0.558973253f},
-std::array<float,2>{0.5034163f, 0.158546358f},
-std::array<float,2>{0.688519835f, 0.733408034f},
-std::array<float,2>{0.0163829383f, 0.0112529583f},
-std::array<float,2>{0.453274429f, 0.840523601f},
-std::array<float,2>{0.820661902f, 0.472395629f},
-std::array<float,2>{0.765723884f, 0.567348957f},
-std::array<float,2>{0.419037819f, 0.21447891f},
-std::array<float,2>{0.0674507618f, 0.910890579f},
-std::array<float,2>{0.651410639f, 0.258856326f},
-std::array<float,2>{0.591403306f, 0.766774893f},
-std::array<float,2>{0.161926389f, 0.431586027f},
-std::array<float,2>{0.28403461f, 0.685046494f},
-std::array<float,2>{0.914476752f, 0.0647762641f},
-std::array<float,2>{0.860986888f, 0.866827309f},
-std::array<float,2>{0.480310202f, 0.464724869f},
-std::array<float,2>{0.0583926402f, 0.698273242f},
-std::array<float,2>{0.731999934f, 0.0455304086f},
-std::array<float,2>{0.55853337f, 0.515207589f},
-std::array<float,2>{0.2427506f, 0.134947732f},
-std::array<float,2>{0.318305045f, 0.943125963f},
-std::array<float,2>{0.94684124f, 0.334373891f},
-std::array<float,2>{0.90105778f, 0.631222248f},
-std::array<float,2>{0.271074742f, 0.102010034f},
-std::array<float,2>{0.143491626f, 0.803985059f},
-std::array<float,2>{0.616336763f, 0.387317926f},
-std::array<float,2>{0.658559978f, 0.88095957f},
-std::array<float,2>{0.10575638f, 0.282153964f},
-std::array<float,2>{0.381335467f, 0.595788181f},
-std::array<float,2>{0.7983886f, 0.233814418f},
-std::array<float,2>{0.937278032f, 0.786809206f},
-std::array<float,2>{0.308967471f, 0.391750157f},
-std::array<float,2>{0.181981176f, 0.64532274f},
-std::array<float,2>{0.56253159f, 0.122741319f},
-std::array<float,2>{0.63548696f, 0.623048782f},
-std::array<float,2>{0.0908048972f, 0.245924294f},
-std::array<float,2>{0.422813028f, 0.902568817f},
-std::array<float,2>{0.755645812f, 0.298827469f},
-std::array<float,2>{0.832984805f, 0.713644505f},
-std::array<float,2>{0.447324097f, 0.0487256944f},
-std::array<float,2>{0.013060811f, 0.854638159f},
-std::array<float,2>{0.7088269f, 0.449497998f},
-std::array<float,2>{0.528520882f, 0.953533709f},
-std::array<float,2>{0.212238103f, 0.323699743f},
-std::array<float,2>{0.348418713f, 0.526820123f},
-std::array<float,2>{0.995145082f, 0.151998222f},
-std::array<float,2>{0.791474402f, 0.925331473f},
-std::array<float,2>{0.398251832f, 0.274614751f},
-std::array<float,2>{0.117211886f, 0.581961513f},
-std::array<float,2>{0.683063626f, 0.20118539f},
-std::array<float,2>{0.594310462f, 0.666807353f},
-std::array<float,2>{0.130916998f, 0.081189625f},
-std::array<float,2>{0.263265729f, 0.761101663f},
-std::array<float,2>{0.886849523f, 0.42036128f},
-std::array<float,2>{0.963046432f, 0.539476514f},
-std::array<float,2>{0.340038776f, 0.183665529f},
-std::array<float,2>{0.230428159f, 0.971592247f},
-std::array<float,2>{0.534081459f, 0.374052614f},
-std::array<float,2>{0.7419554f, 0.812666118f},
-std::array<float,2>{0.0428494141f, 0.486889333f},
-std::array<float,2>{0.495430022f, 0.734725475f},
-std::array<float,2>{0.847033143f, 0.0201922655f},
-std::array<float,2>{0.875815094f, 0.895675302f},
-std::array<float,2>{0.252213478f, 0.306624979f},
-std::array<float,2>{0.133869171f, 0.610975981f},
-std::array<float,2>{0.60584861f, 0.235173553f},
-std::array<float,2>{0.677581191f, 0.653826654f},
-std::array<float,2>{0.114221841f, 0.113249816f},
-std::array<float,2>{0.402144521f, 0.795729458f},
-std::array<float,2>{0.786736906f, 0.401556849f},
-std::array<float,2>{0.8585186f, 0.523136795f},
-std::array<float,2>{0.490437627f, 0.147409543f},
-std::array<float,2>{0.0330517925f, 0.963025391f},
-std::array<float,2>{0.744691849f, 0.319935799f},
-std::array<float,2>{0.54257983f, 0.849399805f},
-std::array<float,2>{0.219413921f, 0.444033235f},
-std::array<float,2>{0.333829582f, 0.708516955f},
-std::array<float,2>{0.956564307f, 0.0601697937f},
-std::array<float,2>{0.758149743f, 0.753170729f},
-std::array<float,2>{0.430835009f, 0.408830881f},
-std::array<float,2>{0.0791816339f, 0.656576872f},
-std::array<float,2>{0.62744683f, 0.0871032327f},
-std::array<float,2>{0.577561319f, 0.593163848f},
-std::array<float,2>{0.174221873f, 0.193044499f},
-std::array<float,2>{0.302753657f, 0.93691653f},
-std::array<float,2>{0.924313784f, 0.267627239f},
-std::array<float,2>{0.985572457f, 0.743635893f},
-std::array<float,2>{0.356969267f, 0.0261077583f},
-std::array<float,2>{0.205268532f, 0.823837519f},
-std::array<float,2>{0.518991172f, 0.494242519f},
-std::array<float,2>{0.712280393f, 0.97927016f},
-std::array<float,2>{0.00157747499f, 0.367107093f},
-std::array<float,2>{0.439594179f, 0.533236623f},
-std::array<float,2>{0.836963952f, 0.176526919f},
-std::array<float,2>{0.943957269f, 0.828788161f},
-std::array<float,2>{0.322742105f, 0.481453419f},
-std::array<float,2>{0.240732566f, 0.721102417f},
-std::array<float,2>{0.54867959f, 0.00449769851f},
-std::array<float,2>{0.719508648f, 0.54993099f},
-std::array<float,2>{0.0474457219f, 0.164829671f},
-std::array<float,2>{0.472599089f, 0.985671699f},
-std::array<float,2>{0.87365371f, 0.348817289f},
-std::array<float,2>{0.810345054f, 0.676901996f},
-std::array<float,2>{0.385847062f, 0.0761642158f},
-std::array<float,2>{0.0974681005f, 0.774418652f},
-std::array<float,2>{0.668401778f, 0.428640246f},
-std::array<float,2>{0.61963892f, 0.915191829f},
-std::array<float,2>{0.151468828f, 0.257724524f},
-std::array<float,2>{0.278645754f, 0.577673793f},
-std::array<float,2>{0.895911038f, 0.204699233f},
-std::array<float,2>{0.818136454f, 0.946265817f},
-std::array<float,2>{0.461970448f, 0.339468807f},
-std::array<float,2>{0.027004987f, 0.507344604f},
-std::array<float,2>{0.703008115f, 0.12744385f},
-std::array<float,2>{0.508725286f, 0.689886212f},
-std::array<float,2>{0.188704371f, 0.0371101052f},
-std::array<float,2>{0.36703068f, 0.872343123f},
-std::array<float,2>{0.972879529f, 0.454450518f},
-std::array<float,2>{0.906454742f, 0.604248703f},
-std::array<float,2>{0.291048825f, 0.222002089f},
-std::array<float,2>{0.166747764f, 0.888235092f},
-std::array<float,2>{0.580152512f, 0.291040689f},
-std::array<float,2>{0.646282554f, 0.809106886f},
-std::array<float,2>{0.0740186051f, 0.378368288f},
-std::array<float,2>{0.413546532f, 0.635023654f},
-std::array<float,2>{0.780425966f, 0.0947174802f},
-std::array<float,2>{0.988531888f, 0.876722574f},
-std::array<float,2>{0.353819668f, 0.285351247f},
-std::array<float,2>{0.210823476f, 0.598405957f},
-std::array<float,2>{0.523214936f, 0.227117524f},
-std::array<float,2>{0.717089534f, 0.628059566f},
-std::array<float,2>{0.00713783782f, 0.109239772f},
-std::array<float,2>{0.442411929f, 0.797879398f},
-std::array<float,2>{0.841298461f, 0.385739028f},
-std::array<float,2>{0.763195813f, 0.508411169f},
-std::array<float,2>{0.43441084f, 0.136769459f},
-std::array<float,2>{0.0824975595f, 0.941370726f},
-std::array<float,2>{0.631647885f, 0.329193652f},
-std::array<float,2>{0.572657049f, 0.863132179f},
-std::array<float,2>{0.17733191f, 0.468037128f},
-std::array<float,2>{0.298542112f, 0.701096177f},
-std::array<float,2>{0.928813875f, 0.0395287611f},
-std::array<float,2>{0.854996741f, 0.769967496f},
-std::array<float,2>{0.486241013f, 0.434539706f},
-std::array<float,2>{0.0386824049f, 0.680542529f},
-std::array<float,2>{0.747944117f, 0.0667803437f},
-std::array<float,2>{0.545840681f, 0.565310657f},
-std::array<float,2>{0.223423198f, 0.216236115f},
-std::array<float,2>{0.331068456f, 0.90665102f},
-std::array<float,2>{0.959828258f, 0.26398316f},
-std::array<float,2>{0.879247427f, 0.730452418f},
-std::array<float,2>{0.257348776f, 0.0141100595f},
-std::array<float,2>{0.136894882f, 0.837735832f},
-std::array<float,2>{0.604279399f, 0.472962022f},
-std::array<float,2>{0.674753428f, 0.998321295f},
-std::array<float,2>{0.111572675f, 0.355098367f},
-std::array<float,2>{0.402735859f, 0.55548358f},
-std::array<float,2>{0.782022357f, 0.164012015f},
-std::array<float,2>{0.912968457f, 0.81902498f},
-std::array<float,2>{0.295134276f, 0.488397717f},
-std::array<float,2>{0.169517651f, 0.741367102f},
-std::array<float,2>{0.582125366f, 0.0184582956f},
-std::array<float,2>{0.643488228f, 0.546068609f},
-std::array<float,2>{0.0743200183f, 0.179751754f},
-std::array<float,2>{0.406886339f, 0.975095451f},
-std::array<float,2>{0.775704503f, 0.370726705f},
-std::array<float,2>{0.81250757f, 0.668719292f},
-std::array<float,2>{0.46872744f, 0.0852854326f},
-std::array<float,2>{0.0285677891f, 0.763864756f},
-std::array<float,2>{0.697479367f, 0.415580332f},
-std::array<float,2>{0.515263915f, 0.92823267f},
-std::array<float,2>{0.19370532f, 0.278026938f},
-std::array<float,2>{0.362529635f, 0.584239423f},
-std::array<float,2>{0.970947981f, 0.195371538f},
-std::array<float,2>{0.807402611f, 0.960616112f},
-std::array<float,2>{0.390176088f, 0.327583581f},
-std::array<float,2>{0.0983237699f, 0.530426741f},
-std::array<float,2>{0.666613877f, 0.153772354f},
-std::array<float,2>{0.623524547f, 0.715543628f},
-std::array<float,2>{0.152610943f, 0.0546781532f},
-std::array<float,2>{0.274643093f, 0.857683003f},
-std::array<float,2>{0.892266035f, 0.446518153f},
-std::array<float,2>{0.940792918f, 0.619390965f},
-std::array<float,2>{0.326209635f, 0.24807331f},
-std::array<float,2>{0.236639872f, 0.90023303f},
-std::array<float,2>{0.551134944f, 0.301758796f},
-std::array<float,2>{0.725770235f, 0.784661949f},
-std::array<float,2>{0.053987138f, 0.397869587f},
-std::array<float,2>{0.472760022f, 0.643520832f},
-std::array<float,2>{0.867892981f, 0.117248558f},
-std::array<float,2>{0.906156719f, 0.98108083f},
-std::array<float,2>{0.267810702f, 0.362783283f},
-std::array<float,2>{0.144961208f, 0.535822451f},
-std::array<float,2>{0.610462904f, 0.172379613f},
-std::array<float,2>{0.66212517f, 0.748088002f},
-std::array<float,2>{0.104242638f, 0.031189952f},
-std::array<float,2>{0.376493216f, 0.826447964f},
-std::array<float,2>{0.802508175f, 0.498668343f},
-std::array<float,2>{0.864165306f, 0.588244975f},
-std::array<float,2>{0.480514675f, 0.188995287f},
-std::array<float,2>{0.0605928302f, 0.931347191f},
-std::array<float,2>{0.726589262f, 0.272116095f},
-std::array<float,2>{0.558771729f, 0.757069468f},
-std::array<float,2>{0.248563886f, 0.411604851f},
-std::array<float,2>{0.315157473f, 0.66218251f},
-std::array<float,2>{0.950260937f, 0.092285946f},
-std::array<float,2>{0.772729278f, 0.845250726f},
-std::array<float,2>{0.415764004f, 0.437675655f},
-std::array<float,2>{0.0628431812f, 0.706435323f},
-std::array<float,2>{0.653575778f, 0.0566240586f},
-std::array<float,2>{0.586248338f, 0.518288553f},
-std::array<float,2>{0.159382373f, 0.142105699f},
-std::array<float,2>{0.287853122f, 0.966023922f},
-std::array<float,2>{0.919757068f, 0.314295501f},
-std::array<float,2>{0.981701255f, 0.651618183f},
-std::array<float,2>{0.370223522f, 0.113622032f},
-std::array<float,2>{0.200881317f, 0.789429128f},
-std::array<float,2>{0.505065143f, 0.403476775f},
-std::array<float,2>{0.692977846f, 0.892847717f},
-std::array<float,2>{0.0233080536f, 0.312126845f},
-std::array<float,2>{0.458561599f, 0.615539074f},
-std::array<float,2>{0.826830745f, 0.241439208f},
-std::array<float,2>{0.965199351f, 0.804847538f},
-std::array<float,2>{0.337788582f, 0.381269336f},
-std::array<float,2>{0.232669339f, 0.639275372f},
-std::array<float,2>{0.535755575f, 0.0991925225f},
-std::array<float,2>{0.735278726f, 0.606679738f},
-std::array<float,2>{0.046575442f, 0.22380361f},
-std::array<float,2>{0.499530196f, 0.883970976f},
-std::array<float,2>{0.850903273f, 0.296362728f},
-std::array<float,2>{0.795163393f, 0.694381535f},
-std::array<float,2>{0.394092351f, 0.0329432972f},
-std::array<float,2>{0.122022197f, 0.870146811f},
-std::array<float,2>{0.684102476f, 0.459133089f},
-std::array<float,2>{0.599278033f, 0.94999212f},
-std::array<float,2>{0.128781214f, 0.341820627f},
-std::array<float,2>{0.261412203f, 0.500989258f},
-std::array<float,2>{0.88624531f, 0.130080566f},
-std::array<float,2>{0.829321682f, 0.919725358f},
-std::array<float,2>{0.451742649f, 0.252765924f},
-std::array<float,2>{0.010133246f, 0.573657453f},
-std::array<float,2>{0.704256713f, 0.209737003f},
-std::array<float,2>{0.524199784f, 0.674089968f},
-std::array<float,2>{0.217924446f, 0.072583735f},
-std::array<float,2>{0.344648957f, 0.779944479f},
-std::array<float,2>{0.9964692f, 0.423195958f},
-std::array<float,2>{0.930296004f, 0.553215146f},
-std::array<float,2>{0.305858999f, 0.169402763f},
-std::array<float,2>{0.184846431f, 0.990971208f},
-std::array<float,2>{0.568085253f, 0.345887721f},
-std::array<float,2>{0.638439596f, 0.833188832f},
-std::array<float,2>{0.089774631f, 0.477336943f},
-std::array<float,2>{0.426479965f, 0.725887597f},
-std::array<float,2>{0.750996888f, 0.00212745788f},
-std::array<float,2>{0.949141383f, 0.944461942f},
-std::array<float,2>{0.319230676f, 0.33221215f},
-std::array<float,2>{0.24570027f, 0.512604833f},
-std::array<float,2>{0.556367099f, 0.134704277f},
-std::array<float,2>{0.733041584f, 0.696484566f},
-std::array<float,2>{0.0563884005f, 0.0434520766f},
-std::array<float,2>{0.477111727f, 0.863533378f},
-std::array<float,2>{0.862738073f, 0.46192956f},
-std::array<float,2>{0.799765289f, 0.59491396f},
-std::array<float,2>{0.37964198f, 0.230648741f},
-std::array<float,2>{0.10856083f, 0.879402041f},
-std::array<float,2>{0.657238662f, 0.284710884f},
-std::array<float,2>{0.614827693f, 0.80251348f},
-std::array<float,2>{0.141837314f, 0.388703555f},
-std::array<float,2>{0.272129387f, 0.629205346f},
-std::array<float,2>{0.899527788f, 0.104204394f},
-std::array<float,2>{0.82329756f, 0.842117012f},
-std::array<float,2>{0.455825061f, 0.470560342f},
-std::array<float,2>{0.0177488662f, 0.730733633f},
-std::array<float,2>{0.689849734f, 0.00797268469f},
-std::array<float,2>{0.501119971f, 0.562469006f},
-std::array<float,2>{0.19614929f, 0.156952396f},
-std::array<float,2>{0.372490644f, 0.99564451f},
-std::array<float,2>{0.977698505f, 0.356818587f},
-std::array<float,2>{0.916439235f, 0.686772406f},
-std::array<float,2>{0.282476604f, 0.0642154366f},
-std::array<float,2>{0.163609177f, 0.769227624f},
-std::array<float,2>{0.593370914f, 0.432368517f},
-std::array<float,2>{0.649632215f, 0.912786007f},
-std::array<float,2>{0.0698205084f, 0.261191279f},
-std::array<float,2>{0.420578212f, 0.569102287f},
-std::array<float,2>{0.768126488f, 0.212523848f},
-std::array<float,2>{0.889065266f, 0.757833362f},
-std::array<float,2>{0.265502393f, 0.418699145f},
-std::array<float,2>{0.130223647f, 0.665825069f},
-std::array<float,2>{0.596491754f, 0.0789881796f},
-std::array<float,2>{0.68030417f, 0.579494894f},
-std::array<float,2>{0.120575815f, 0.200831354f},
-std::array<float,2>{0.396363825f, 0.922887027f},
-std::array<float,2>{0.789554894f, 0.275697738f},
-std::array<float,2>{0.843834698f, 0.7369982f},
-std::array<float,2>{0.492560953f, 0.0229640044f},
-std::array<float,2>{0.0392728411f, 0.814730942f},
-std::array<float,2>{0.738911033f, 0.485675156f},
-std::array<float,2>{0.532679856f, 0.970628917f},
-std::array<float,2>{0.227339f, 0.372797221f},
-std::array<float,2>{0.342364013f, 0.542747557f},
-std::array<float,2>{0.961513817f, 0.186186135f},
-std::array<float,2>{0.757540286f, 0.905828178f},
-std::array<float,2>{0.425774217f, 0.300203323f},
-std::array<float,2>{0.0925419778f, 0.622053981f},
-std::array<float,2>{0.6332407f, 0.242266908f},
-std::array<float,2>{0.564567208f, 0.646962821f},
-std::array<float,2>{0.179815665f, 0.124262594f},
-std::array<float,2>{0.312274873f, 0.787272096f},
-std::array<float,2>{0.934726477f, 0.393205285f},
-std::array<float,2>{0.993228853f, 0.523888767f},
-std::array<float,2>{0.351162493f, 0.148907214f},
-std::array<float,2>{0.214819849f, 0.956415594f},
-std::array<float,2>{0.530240893f, 0.322219491f},
-std::array<float,2>{0.70907414f, 0.852779388f},
-std::array<float,2>{0.0149550503f, 0.451215982f},
-std::array<float,2>{0.446380198f, 0.711034298f},
-std::array<float,2>{0.835156858f, 0.0504000373f},
-std::array<float,2>{0.923501253f, 0.933815956f},
-std::array<float,2>{0.302374303f, 0.265818566f},
-std::array<float,2>{0.171904042f, 0.591357708f},
-std::array<float,2>{0.575216591f, 0.194703951f},
-std::array<float,2>{0.626831591f, 0.659412682f},
-std::array<float,2>{0.0808570161f, 0.0892805457f},
-std::array<float,2>{0.433539659f, 0.750876546f},
-std::array<float,2>{0.76164788f, 0.406308115f},
-std::array<float,2>{0.839652002f, 0.532345474f},
-std::array<float,2>{0.437804192f, 0.177738488f},
-std::array<float,2>{0.00385394786f, 0.978220642f},
-std::array<float,2>{0.714118123f, 0.363726497f},
-std::array<float,2>{0.517528713f, 0.821746707f},
-std::array<float,2>{0.20358254f, 0.493043542f},
-std::array<float,2>{0.359131068f, 0.744869649f},
-std::array<float,2>{0.988016784f, 0.0237007979f},
-std::array<float,2>{0.788284659f, 0.793313324f},
-std::array<float,2>{0.399649501f, 0.399534315f},
-std::array<float,2>{0.116214067f, 0.655903041f},
-std::array<float,2>{0.678673804f, 0.110854551f},
-std::array<float,2>{0.607816994f, 0.612232864f},
-std::array<float,2>{0.135000333f, 0.236578271f},
-std::array<float,2>{0.251604766f, 0.897046089f},
-std::array<float,2>{0.877669215f, 0.307724029f},
-std::array<float,2>{0.954764009f, 0.708998144f},
-std::array<float,2>{0.335880071f, 0.062026266f},
-std::array<float,2>{0.222589672f, 0.851218164f},
-std::array<float,2>{0.540686727f, 0.441588253f},
-std::array<float,2>{0.742682815f, 0.961462319f},
-std::array<float,2>{0.0351050161f, 0.317859292f},
-std::array<float,2>{0.489946216f, 0.521216333f},
-std::array<float,2>{0.855491281f, 0.144711167f},
-std::array<float,2>{0.974640191f, 0.873308241f},
-std::array<float,2>{0.36426121f, 0.456127912f},
-std::array<float,2>{0.189697325f, 0.68901968f},
-std::array<float,2>{0.510283172f, 0.0366964675f},
-std::array<float,2>{0.699555457f, 0.504086554f},
-std::array<float,2>{0.0252655372f, 0.12618804f},
-std::array<float,2>{0.464661688f, 0.948260903f},
-std::array<float,2>{0.820259511f, 0.337720364f},
-std::array<float,2>{0.779174328f, 0.633145511f},
-std::array<float,2>{0.410809577f, 0.0957166627f},
-std::array<float,2>{0.0708193332f, 0.811010122f},
-std::array<float,2>{0.64720428f, 0.37658146f},
-std::array<float,2>{0.579204798f, 0.890181541f},
-std::array<float,2>{0.165593907f, 0.289849997f},
-std::array<float,2>{0.29059431f, 0.602753878f},
-std::array<float,2>{0.90960139f, 0.220380381f},
-std::array<float,2>{0.872745574f, 0.987082779f},
-std::array<float,2>{0.470605075f, 0.350812107f},
-std::array<float,2>{0.0504153259f, 0.548455298f},
-std::array<float,2>{0.721107721f, 0.167659625f},
-std::array<float,2>{0.550729573f, 0.719034433f},
-std::array<float,2>{0.239718422f, 0.00741776871f},
-std::array<float,2>{0.321996421f, 0.831797719f},
-std::array<float,2>{0.942218721f, 0.484191626f},
-std::array<float,2>{0.897082448f, 0.575701475f},
-std::array<float,2>{0.279699355f, 0.205321684f},
-std::array<float,2>{0.149545014f, 0.91612196f},
-std::array<float,2>{0.617466211f, 0.254736483f},
-std::array<float,2>{0.670401514f, 0.777202368f},
-std::array<float,2>{0.0956377313f, 0.426963925f},
-std::array<float,2>{0.384180367f, 0.677886546f},
-std::array<float,2>{0.811914027f, 0.0763438791f},
-std::array<float,2>{0.967110872f, 0.8844136f},
-std::array<float,2>{0.338894635f, 0.296503365f},
-std::array<float,2>{0.231835634f, 0.606975675f},
-std::array<float,2>{0.538084388f, 0.224224567f},
-std::array<float,2>{0.737921536f, 0.638979733f},
-std::array<float,2>{0.0435366035f, 0.0989819691f},
-std::array<float,2>{0.496992826f, 0.805635273f},
-std::array<float,2>{0.847825348f, 0.381710231f},
-std::array<float,2>{0.793188274f, 0.501949728f},
-std::array<float,2>{0.392074794f, 0.130645096f},
-std::array<float,2>{0.124613598f, 0.949651241f},
-std::array<float,2>{0.687328875f, 0.3426072f},
-std::array<float,2>{0.600096643f, 0.871035457f},
-std::array<float,2>{0.126724362f, 0.459671468f},
-std::array<float,2>{0.25834012f, 0.695209801f},
-std::array<float,2>{0.883115888f, 0.0326281376f},
-std::array<float,2>{0.83133018f, 0.779685199f},
-std::array<float,2>{0.450115919f, 0.423684061f},
-std::array<float,2>{0.00853744149f, 0.674802184f},
-std::array<float,2>{0.706849158f, 0.0727555305f},
-std::array<float,2>{0.525987625f, 0.573981345f},
-std::array<float,2>{0.216624126f, 0.209210485f},
-std::array<float,2>{0.347100854f, 0.919230342f},
-std::array<float,2>{0.998097837f, 0.252184719f},
-std::array<float,2>{0.933217168f, 0.726490498f},
-std::array<float,2>{0.307101816f, 0.0025110417f},
-std::array<float,2>{0.185711205f, 0.833816767f},
-std::array<float,2>{0.569985747f, 0.476946443f},
-std::array<float,2>{0.638828695f, 0.990455866f},
-std::array<float,2>{0.0867080539f, 0.346321911f},
-std::array<float,2>{0.42871955f, 0.553300798f},
-std::array<float,2>{0.752501607f, 0.169504002f},
-std::array<float,2>{0.90407151f, 0.826895237f},
-std::array<float,2>{0.265778422f, 0.498094708f},
-std::array<float,2>{0.147257194f, 0.748566031f},
-std::array<float,2>{0.612633467f, 0.0303323139f},
-std::array<float,2>{0.660688698f, 0.535639107f},
-std::array<float,2>{0.10326346f, 0.172210693f},
-std::array<float,2>{0.378173858f, 0.980473161f},
-std::array<float,2>{0.802921593f, 0.363221288f},
-std::array<float,2>{0.866754949f, 0.662613511f},
-std::array<float,2>{0.482849538f, 0.091888316f},
-std::array<float,2>{0.0597434379f, 0.757448733f},
-std::array<float,2>{0.729748368f, 0.412089378f},
-std::array<float,2>{0.561762571f, 0.931030154f},
-std::array<float,2>{0.246979147f, 0.271538258f},
-std::array<float,2>{0.313371867f, 0.588631392f},
-std::array<float,2>{0.952597797f, 0.188758269f},
-std::array<float,2>{0.771265805f, 0.966564894f},
-std::array<float,2>{0.416324377f, 0.313766003f},
-std::array<float,2>{0.065929085f, 0.517936289f},
-std::array<float,2>{0.654435396f, 0.141623259f},
-std::array<float,2>{0.589303553f, 0.706661582f},
-std::array<float,2>{0.157074586f, 0.0559663139f},
-std::array<float,2>{0.286329895f, 0.844764829f},
-std::array<float,2>{0.920809388f, 0.43847096f},
-std::array<float,2>{0.984231055f, 0.616192162f},
-std::array<float,2>{0.367982477f, 0.24211584f},
-std::array<float,2>{0.201501757f, 0.893200219f},
-std::array<float,2>{0.506025136f, 0.311603725f},
-std::array<float,2>{0.694641292f, 0.789610147f},
-std::array<float,2>{0.02012413f, 0.404139191f},
-std::array<float,2>{0.459911555f, 0.651898801f},
-std::array<float,2>{0.825684071f, 0.114151455f},
-std::array<float,2>{0.910767257f, 0.975157261f},
-std::array<float,2>{0.293829411f, 0.370530337f},
-std::array<float,2>{0.170253634f, 0.546529591f},
-std::array<float,2>{0.585561514f, 0.180350721f},
-std::array<float,2>{0.642349064f, 0.742175937f},
-std::array<float,2>{0.0778085515f, 0.0178644098f},
-std::array<float,2>{0.409924656f, 0.818637371f},
-std::array<float,2>{0.774591267f, 0.48879692f},
-std::array<float,2>{0.816120863f, 0.584935725f},
-std::array<float,2>{0.465072066f, 0.196051314f},
-std::array<float,2>{0.0299917664f, 0.927936256f},
-std::array<float,2>{0.697182775f, 0.277515054f},
-std::array<float,2>{0.513178825f, 0.764588416f},
-std::array<float,2>{0.192728922f, 0.415508568f},
-std::array<float,2>{0.360435575f, 0.668019593f},
-std::array<float,2>{0.969599843f, 0.0855729133f},
-std::array<float,2>{0.805303574f, 0.858215272f},
-std::array<float,2>{0.386956871f, 0.446968257f},
-std::array<float,2>{0.100116648f, 0.715175509f},
-std::array<float,2>{0.665264368f, 0.0538498983f},
-std::array<float,2>{0.622014344f, 0.531181395f},
-std::array<float,2>{0.155789882f, 0.154185757f},
-std::array<float,2>{0.275419176f, 0.960448861f},
-std::array<float,2>{0.892711759f, 0.327692628f},
-std::array<float,2>{0.93842715f, 0.642609775f},
-std::array<float,2>{0.324835509f, 0.117709137f},
-std::array<float,2>{0.235925123f, 0.784906387f},
-std::array<float,2>{0.554182887f, 0.398214847f},
-std::array<float,2>{0.72352761f, 0.899702966f},
-std::array<float,2>{0.0526507385f, 0.302419156f},
-std::array<float,2>{0.475363225f, 0.619753122f},
-std::array<float,2>{0.870052278f, 0.248543143f},
-std::array<float,2>{0.991316378f, 0.798692822f},
-std::array<float,2>{0.352064788f, 0.385015994f},
-std::array<float,2>{0.207467228f, 0.628905118f},
-std::array<float,2>{0.521249771f, 0.108552918f},
-std::array<float,2>{0.715126276f, 0.597949386f},
-std::array<float,2>{0.00413473789f, 0.226873636f},
-std::array<float,2>{0.443764269f, 0.876350701f},
-std::array<float,2>{0.84252435f, 0.286003649f},
-std::array<float,2>{0.765227795f, 0.700516701f},
-std::array<float,2>{0.436873823f, 0.0398501493f},
-std::array<float,2>{0.085715577f, 0.862564385f},
-std::array<float,2>{0.629770875f, 0.468449175f},
-std::array<float,2>{0.572213769f, 0.940863013f},
-std::array<float,2>{0.17925027f, 0.329907387f},
-std::array<float,2>{0.299974769f, 0.508052886f},
-std::array<float,2>{0.926225185f, 0.137462333f},
-std::array<float,2>{0.85243243f, 0.906749189f},
-std::array<float,2>{0.486576855f, 0.264204919f},
-std::array<float,2>{0.0367936455f, 0.564659655f},
-std::array<float,2>{0.749645472f, 0.216791689f},
-std::array<float,2>{0.543718338f, 0.679784834f},
-std::array<float,2>{0.225088954f, 0.0670073405f},
-std::array<float,2>{0.328291595f, 0.770427763f},
-std::array<float,2>{0.957165062f, 0.433964223f},
-std::array<float,2>{0.882608175f, 0.5548774f},
-std::array<float,2>{0.254649311f, 0.163157344f},
-std::array<float,2>{0.140452847f, 0.99891609f},
-std::array<float,2>{0.602698803f, 0.354538858f},
-std::array<float,2>{0.672719121f, 0.837072551f},
-std::array<float,2>{0.110917836f, 0.4733136f},
-std::array<float,2>{0.40519464f, 0.729510665f},
-std::array<float,2>{0.783243179f, 0.0146361059f},
-std::array<float,2>{0.973486245f, 0.948739886f},
-std::array<float,2>{0.366231859f, 0.337266833f},
-std::array<float,2>{0.189044386f, 0.504869342f},
-std::array<float,2>{0.508297324f, 0.126726612f},
-std::array<float,2>{0.702304661f, 0.688944638f},
-std::array<float,2>{0.0265552141f, 0.0361532755f},
-std::array<float,2>{0.462508857f, 0.873598516f},
-std::array<float,2>{0.817476094f, 0.456554711f},
-std::array<float,2>{0.781217039f, 0.603328943f},
-std::array<float,2>{0.413763046f, 0.220002949f},
-std::array<float,2>{0.073605448f, 0.889982164f},
-std::array<float,2>{0.64572233f, 0.289537698f},
-std::array<float,2>{0.580632329f, 0.811448157f},
-std::array<float,2>{0.166261673f, 0.376386672f},
-std::array<float,2>{0.291971117f, 0.633642733f},
-std::array<float,2>{0.9071064f, 0.0961940512f},
-std::array<float,2>{0.873401284f, 0.831383407f},
-std::array<float,2>{0.472014576f, 0.483458668f},
-std::array<float,2>{0.0470594987f, 0.719679475f},
-std::array<float,2>{0.718923688f, 0.00696843117f},
-std::array<float,2>{0.547876179f, 0.54818821f},
-std::array<float,2>{0.240315363f, 0.16708529f},
-std::array<float,2>{0.323006719f, 0.986652672f},
-std::array<float,2>{0.943682671f, 0.351170152f},
-std::array<float,2>{0.896324039f, 0.678257763f},
-std::array<float,2>{0.279086232f, 0.0770516023f},
-std::array<float,2>{0.152296528f, 0.77644968f},
-std::array<float,2>{0.619422078f, 0.42741093f},
-std::array<float,2>{0.668751061f, 0.916582108f},
-std::array<float,2>{0.0969473422f, 0.254134238f},
-std::array<float,2>{0.386410475f, 0.575660348f},
-std::array<float,2>{0.809786141f, 0.205739856f},
-std::array<float,2>{0.924788833f, 0.7501508f},
-std::array<float,2>{0.303559959f, 0.406835854f},
-std::array<float,2>{0.174779058f, 0.659744382f},
-std::array<float,2>{0.578002036f, 0.089430809f},
-std::array<float,2>{0.62724179f, 0.59124434f},
-std::array<float,2>{0.0799819976f, 0.195157975f},
-std::array<float,2>{0.431617796f, 0.934394062f},
-std::array<float,2>{0.758745074f, 0.266157061f},
-std::array<float,2>{0.837586045f, 0.744615614f},
-std::array<float,2>{0.440187305f, 0.0240473896f},
-std::array<float,2>{0.00127672788f, 0.822083294f},
-std::array<float,2>{0.71250385f, 0.4925026f},
-std::array<float,2>{0.519199669f, 0.977725089f},
-std::array<float,2>{0.205965638f, 0.363913059f},
-std::array<float,2>{0.356855035f, 0.533143878f},
-std::array<float,2>{0.985845506f, 0.178330466f},
-std::array<float,2>{0.786609709f, 0.896575689f},
-std::array<float,2>{0.401460111f, 0.308291465f},
-std::array<float,2>{0.113453723f, 0.611367464f},
-std::array<float,2>{0.67707634f, 0.23727411f},
-std::array<float,2>{0.606325746f, 0.655644178f},
-std::array<float,2>{0.134285495f, 0.110367402f},
-std::array<float,2>{0.252909064f, 0.793676555f},
-std::array<float,2>{0.875410318f, 0.400208473f},
-std::array<float,2>{0.956205785f, 0.520703912f},
-std::array<float,2>{0.333337545f, 0.145498052f},
-std::array<float,2>{0.218865886f, 0.961359441f},
-std::array<float,2>{0.542418003f, 0.3183375f},
-std::array<float,2>{0.744515181f, 0.850671053f},
-std::array<float,2>{0.0324412212f, 0.441910893f},
-std::array<float,2>{0.490756512f, 0.709711492f},
-std::array<float,2>{0.859346747f, 0.0619564392f},
-std::array<float,2>{0.88744235f, 0.923635364f},
-std::array<float,2>{0.263077229f, 0.276144028f},
-std::array<float,2>{0.131757036f, 0.580006182f},
-std::array<float,2>{0.593904793f, 0.200311199f},
-std::array<float,2>{0.683364153f, 0.665341973f},
-std::array<float,2>{0.117838293f, 0.07854864f},
-std::array<float,2>{0.397770435f, 0.758372426f},
-std::array<float,2>{0.791677892f, 0.418360949f},
-std::array<float,2>{0.847444355f, 0.542299271f},
-std::array<float,2>{0.495657384f, 0.185784072f},
-std::array<float,2>{0.0421575978f, 0.96995306f},
-std::array<float,2>{0.741276503f, 0.372431308f},
-std::array<float,2>{0.5333395f, 0.815022528f},
-std::array<float,2>{0.229922533f, 0.485857308f},
-std::array<float,2>{0.340487897f, 0.73678571f},
-std::array<float,2>{0.963549852f, 0.0227892306f},
-std::array<float,2>{0.755243242f, 0.787866533f},
-std::array<float,2>{0.422181875f, 0.392974734f},
-std::array<float,2>{0.0902025178f, 0.646989107f},
-std::array<float,2>{0.634968996f, 0.124595299f},
-std::array<float,2>{0.563036442f, 0.62138772f},
-std::array<float,2>{0.182265252f, 0.242928714f},
-std::array<float,2>{0.309193015f, 0.905602515f},
-std::array<float,2>{0.936725914f, 0.300432742f},
-std::array<float,2>{0.995725691f, 0.711745679f},
-std::array<float,2>{0.347907454f, 0.0502316467f},
-std::array<float,2>{0.212560743f, 0.853430808f},
-std::array<float,2>{0.52897203f, 0.451714635f},
-std::array<float,2>{0.708280265f, 0.956848025f},
-std::array<float,2>{0.013570914f, 0.321585178f},
-std::array<float,2>{0.447951347f, 0.524413764f},
-std::array<float,2>{0.832481861f, 0.149329752f},
-std::array<float,2>{0.946313977f, 0.8642084f},
-std::array<float,2>{0.31777218f, 0.462526947f},
-std::array<float,2>{0.242643759f, 0.697103977f},
-std::array<float,2>{0.557751119f, 0.0437762029f},
-std::array<float,2>{0.731665313f, 0.511788249f},
-std::array<float,2>{0.0578638613f, 0.133798346f},
-std::array<float,2>{0.479951322f, 0.945248246f},
-std::array<float,2>{0.860827744f, 0.332809031f},
-std::array<float,2>{0.798178256f, 0.629633665f},
-std::array<float,2>{0.381623298f, 0.103743918f},
-std::array<float,2>{0.105993994f, 0.801941574f},
-std::array<float,2>{0.659032762f, 0.38949734f},
-std::array<float,2>{0.616996169f, 0.879153788f},
-std::array<float,2>{0.143017709f, 0.284292698f},
-std::array<float,2>{0.270617604f, 0.595500827f},
-std::array<float,2>{0.900470734f, 0.231395423f},
-std::array<float,2>{0.820972264f, 0.995163262f},
-std::array<float,2>{0.453645021f, 0.356993556f},
-std::array<float,2>{0.015643375f, 0.561871469f},
-std::array<float,2>{0.689443529f, 0.156670675f},
-std::array<float,2>{0.503567517f, 0.731025159f},
-std::array<float,2>{0.197683573f, 0.00876076892f},
-std::array<float,2>{0.374816567f, 0.842750907f},
-std::array<float,2>{0.979064941f, 0.470118821f},
-std::array<float,2>{0.914875507f, 0.568643689f},
-std::array<float,2>{0.283572406f, 0.212191597f},
-std::array<float,2>{0.161563963f, 0.912454545f},
-std::array<float,2>{0.591279805f, 0.261696368f},
-std::array<float,2>{0.652343571f, 0.768863738f},
-std::array<float,2>{0.0679598451f, 0.431909144f},
-std::array<float,2>{0.41978085f, 0.687277555f},
-std::array<float,2>{0.766331613f, 0.0638899282f},
-std::array<float,2>{0.996707857f, 0.920474231f},
-std::array<float,2>{0.3442083f, 0.251289427f},
-std::array<float,2>{0.218545422f, 0.570527077f},
-std::array<float,2>{0.523796737f, 0.20721136f},
-std::array<float,2>{0.705069244f, 0.673274517f},
-std::array<float,2>{0.0105970511f, 0.0705305412f},
-std::array<float,2>{0.451649994f, 0.778845608f},
-std::array<float,2>{0.82996887f, 0.425373137f},
-std::array<float,2>{0.751868367f, 0.552450001f},
-std::array<float,2>{0.426216096f, 0.170198396f},
-std::array<float,2>{0.0889629647f, 0.989195228f},
-std::array<float,2>{0.638108015f, 0.344954669f},
-std::array<float,2>{0.567834556f, 0.835902631f},
-std::array<float,2>{0.185061947f, 0.47974965f},
-std::array<float,2>{0.306463659f, 0.7232306f},
-std::array<float,2>{0.929788113f, 0.000567625975f},
-std::array<float,2>{0.851082206f, 0.80790627f},
-std::array<float,2>{0.499104321f, 0.380274177f},
-std::array<float,2>{0.046007473f, 0.637827873f},
-std::array<float,2>{0.734437466f, 0.0997384563f},
-std::array<float,2>{0.535509229f, 0.609039366f},
-std::array<float,2>{0.23335357f, 0.225491181f},
-std::array<float,2>{0.337011039f, 0.886245549f},
-std::array<float,2>{0.965633035f, 0.293341309f},
-std::array<float,2>{0.885820985f, 0.691816032f},
-std::array<float,2>{0.260828525f, 0.033437226f},
-std::array<float,2>{0.128330022f, 0.869131386f},
-std::array<float,2>{0.598740518f, 0.457553357f},
-std::array<float,2>{0.683657706f, 0.951741695f},
-std::array<float,2>{0.121114478f, 0.339864254f},
-std::array<float,2>{0.39367187f, 0.502801836f},
-std::array<float,2>{0.795410395f, 0.131536514f},
-std::array<float,2>{0.919370234f, 0.84746176f},
-std::array<float,2>{0.287217677f, 0.439840674f},
-std::array<float,2>{0.15988715f, 0.704685688f},
-std::array<float,2>{0.586517453f, 0.0566652678f},
-std::array<float,2>{0.654236197f, 0.516890526f},
-std::array<float,2>{0.0632274225f, 0.142646208f},
-std::array<float,2>{0.415325046f, 0.967661381f},
-std::array<float,2>{0.77337116f, 0.314817578f},
-std::array<float,2>{0.826482415f, 0.649504006f},
-std::array<float,2>{0.458264321f, 0.116631836f},
-std::array<float,2>{0.0226146709f, 0.791972637f},
-std::array<float,2>{0.692775071f, 0.405405045f},
-std::array<float,2>{0.505646765f, 0.891440153f},
-std::array<float,2>{0.200614795f, 0.309793681f},
-std::array<float,2>{0.370929152f, 0.613755763f},
-std::array<float,2>{0.982151449f, 0.238318324f},
-std::array<float,2>{0.80192095f, 0.98335135f},
-std::array<float,2>{0.376251876f, 0.360758215f},
-std::array<float,2>{0.103605084f, 0.538425505f},
-std::array<float,2>{0.662639022f, 0.174429044f},
-std::array<float,2>{0.611193836f, 0.746456504f},
-std::array<float,2>{0.145387918f, 0.0276881475f},
-std::array<float,2>{0.26843971f, 0.825359821f},
-std::array<float,2>{0.905434191f, 0.496505469f},
-std::array<float,2>{0.950736046f, 0.587685227f},
-std::array<float,2>{0.314909041f, 0.191161782f},
-std::array<float,2>{0.248141289f, 0.932824194f},
-std::array<float,2>{0.559365869f, 0.269752413f},
-std::array<float,2>{0.727429032f, 0.754709303f},
-std::array<float,2>{0.0612019226f, 0.413223118f},
-std::array<float,2>{0.481201828f, 0.661440253f},
-std::array<float,2>{0.863337457f, 0.0906591341f},
-std::array<float,2>{0.892035127f, 0.958057344f},
-std::array<float,2>{0.275227904f, 0.32454139f},
-std::array<float,2>{0.152930051f, 0.527404726f},
-std::array<float,2>{0.623704255f, 0.155788898f},
-std::array<float,2>{0.666297913f, 0.717733443f},
-std::array<float,2>{0.09779156f, 0.050834652f},
-std::array<float,2>{0.389995873f, 0.857373416f},
-std::array<float,2>{0.806771815f, 0.448598832f},
-std::array<float,2>{0.867469013f, 0.617601216f},
-std::array<float,2>{0.473418534f, 0.24758479f},
-std::array<float,2>{0.0546758063f, 0.900846839f},
-std::array<float,2>{0.726241291f, 0.304318935f},
-std::array<float,2>{0.551407635f, 0.782241702f},
-std::array<float,2>{0.236835182f, 0.394994885f},
-std::array<float,2>{0.327089399f, 0.641240835f},
-std::array<float,2>{0.941117883f, 0.120419562f},
-std::array<float,2>{0.776027381f, 0.816758752f},
-std::array<float,2>{0.406655937f, 0.491790116f},
-std::array<float,2>{0.075082697f, 0.739876926f},
-std::array<float,2>{0.642710388f, 0.0170573778f},
-std::array<float,2>{0.582883239f, 0.544299185f},
-std::array<float,2>{0.169289589f, 0.181694925f},
-std::array<float,2>{0.295841873f, 0.974585772f},
-std::array<float,2>{0.912201047f, 0.367826611f},
-std::array<float,2>{0.971237421f, 0.671073496f},
-std::array<float,2>{0.362880856f, 0.0827828422f},
-std::array<float,2>{0.194036305f, 0.761956632f},
-std::array<float,2>{0.515117764f, 0.417566031f},
-std::array<float,2>{0.698135376f, 0.92610383f},
-std::array<float,2>{0.0288864523f, 0.280026019f},
-std::array<float,2>{0.468145519f, 0.583722889f},
-std::array<float,2>{0.813278437f, 0.197668359f},
-std::array<float,2>{0.959450722f, 0.772316575f},
-std::array<float,2>{0.331832916f, 0.435840487f},
-std::array<float,2>{0.222808257f, 0.681960523f},
-std::array<float,2>{0.545295358f, 0.0699826032f},
-std::array<float,2>{0.747443199f, 0.564103067f},
-std::array<float,2>{0.0385191776f, 0.218237311f},
-std::array<float,2>{0.485525876f, 0.909807801f},
-std::array<float,2>{0.854967833f, 0.263022035f},
-std::array<float,2>{0.781495988f, 0.726811051f},
-std::array<float,2>{0.403178394f, 0.0130384499f},
-std::array<float,2>{0.112192005f, 0.837910414f},
-std::array<float,2>{0.673921406f, 0.475312382f},
-std::array<float,2>{0.603819609f, 0.996119261f},
-std::array<float,2>{0.137468711f, 0.35288167f},
-std::array<float,2>{0.256837606f, 0.557871878f},
-std::array<float,2>{0.879811645f, 0.160230115f},
-std::array<float,2>{0.841320038f, 0.877618313f},
-std::array<float,2>{0.443144232f, 0.288786381f},
-std::array<float,2>{0.00761880353f, 0.600424349f},
-std::array<float,2>{0.717437863f, 0.229874268f},
-std::array<float,2>{0.52294904f, 0.626763761f},
-std::array<float,2>{0.210364968f, 0.10727419f},
-std::array<float,2>{0.354039162f, 0.799557745f},
-std::array<float,2>{0.988870144f, 0.383499891f},
-std::array<float,2>{0.929238319f, 0.511234462f},
-std::array<float,2>{0.298227638f, 0.140440345f},
-std::array<float,2>{0.177043512f, 0.937894464f},
-std::array<float,2>{0.572846413f, 0.331820428f},
-std::array<float,2>{0.631068349f, 0.859629333f},
-std::array<float,2>{0.0828052983f, 0.46629867f},
-std::array<float,2>{0.433693647f, 0.701394558f},
-std::array<float,2>{0.763018668f, 0.042084001f},
-std::array<float,2>{0.941727042f, 0.986263037f},
-std::array<float,2>{0.321359485f, 0.349477947f},
-std::array<float,2>{0.239755601f, 0.55075562f},
-std::array<float,2>{0.550016344f, 0.164380461f},
-std::array<float,2>{0.721464217f, 0.721391916f},
-std::array<float,2>{0.0498599149f, 0.00422078092f},
-std::array<float,2>{0.469785064f, 0.828482091f},
-std::array<float,2>{0.872149348f, 0.482077479f},
-std::array<float,2>{0.812244058f, 0.577492177f},
-std::array<float,2>{0.38473773f, 0.204113856f},
-std::array<float,2>{0.0950548872f, 0.915817201f},
-std::array<float,2>{0.670526445f, 0.257041782f},
-std::array<float,2>{0.617995024f, 0.775007248f},
-std::array<float,2>{0.150074318f, 0.428053737f},
-std::array<float,2>{0.279953301f, 0.677453756f},
-std::array<float,2>{0.896664321f, 0.0752089992f},
-std::array<float,2>{0.819369793f, 0.872946203f},
-std::array<float,2>{0.464184701f, 0.454759896f},
-std::array<float,2>{0.0244432576f, 0.690110624f},
-std::array<float,2>{0.700163364f, 0.0379240774f},
-std::array<float,2>{0.509885609f, 0.507106721f},
-std::array<float,2>{0.190039128f, 0.127213269f},
-std::array<float,2>{0.365099043f, 0.945451975f},
-std::array<float,2>{0.975252807f, 0.338941157f},
-std::array<float,2>{0.909784198f, 0.635554314f},
-std::array<float,2>{0.290482759f, 0.0941487327f},
-std::array<float,2>{0.165205061f, 0.80900842f},
-std::array<float,2>{0.579850614f, 0.378862768f},
-std::array<float,2>{0.646889329f, 0.887726784f},
-std::array<float,2>{0.0703361481f, 0.291576654f},
-std::array<float,2>{0.410176426f, 0.603573859f},
-std::array<float,2>{0.778478682f, 0.222546563f},
-std::array<float,2>{0.87727046f, 0.79533112f},
-std::array<float,2>{0.251166224f, 0.401998669f},
-std::array<float,2>{0.135612741f, 0.653759897f},
-std::array<float,2>{0.608335197f, 0.112329245f},
-std::array<float,2>{0.677789152f, 0.610724986f},
-std::array<float,2>{0.116931759f, 0.234452546f},
-std::array<float,2>{0.400282651f, 0.896404326f},
-std::array<float,2>{0.788775086f, 0.306109458f},
-std::array<float,2>{0.856037438f, 0.708080173f},
-std::array<float,2>{0.48931554f, 0.0598552376f},
-std::array<float,2>{0.0342452675f, 0.848896086f},
-std::array<float,2>{0.742579818f, 0.44363904f},
-std::array<float,2>{0.54043442f, 0.9635337f},
-std::array<float,2>{0.222118422f, 0.319412708f},
-std::array<float,2>{0.335079998f, 0.522946239f},
-std::array<float,2>{0.954167962f, 0.146971628f},
-std::array<float,2>{0.761055171f, 0.937115729f},
-std::array<float,2>{0.432653099f, 0.268268108f},
-std::array<float,2>{0.0804881006f, 0.593604445f},
-std::array<float,2>{0.626399755f, 0.192663655f},
-std::array<float,2>{0.575904071f, 0.656746328f},
-std::array<float,2>{0.172535151f, 0.0876769498f},
-std::array<float,2>{0.301895291f, 0.753580391f},
-std::array<float,2>{0.923092008f, 0.408380568f},
-std::array<float,2>{0.987670004f, 0.533786297f},
-std::array<float,2>{0.358448565f, 0.176183343f},
-std::array<float,2>{0.203805f, 0.978764057f},
-std::array<float,2>{0.51671052f, 0.366558969f},
-std::array<float,2>{0.714571178f, 0.823278606f},
-std::array<float,2>{0.00324306102f, 0.494715869f},
-std::array<float,2>{0.438238621f, 0.744091034f},
-std::array<float,2>{0.838938415f, 0.0258239359f},
-std::array<float,2>{0.935130954f, 0.903113604f},
-std::array<float,2>{0.311774343f, 0.298336416f},
-std::array<float,2>{0.180617571f, 0.62354964f},
-std::array<float,2>{0.565373123f, 0.245227665f},
-std::array<float,2>{0.633533955f, 0.644811213f},
-std::array<float,2>{0.0920838565f, 0.122385398f},
-std::array<float,2>{0.425285697f, 0.786543489f},
-std::array<float,2>{0.757014871f, 0.392436504f},
-std::array<float,2>{0.835606575f, 0.527029932f},
-std::array<float,2>{0.446947098f, 0.151706114f},
-std::array<float,2>{0.01536752f, 0.953707457f},
-std::array<float,2>{0.709822178f, 0.323997319f},
-std::array<float,2>{0.529322445f, 0.854999661f},
-std::array<float,2>{0.213955119f, 0.449727654f},
-std::array<float,2>{0.350708008f, 0.713138998f},
-std::array<float,2>{0.993960321f, 0.048073791f},
-std::array<float,2>{0.789401531f, 0.761656821f},
-std::array<float,2>{0.395705909f, 0.420606732f},
-std::array<float,2>{0.120972671f, 0.666170299f},
-std::array<float,2>{0.679688811f, 0.0815717056f},
-std::array<float,2>{0.595899284f, 0.581117153f},
-std::array<float,2>{0.13045761f, 0.201667041f},
-std::array<float,2>{0.264873296f, 0.925002515f},
-std::array<float,2>{0.889534295f, 0.27526471f},
-std::array<float,2>{0.961224616f, 0.735119641f},
-std::array<float,2>{0.341862351f, 0.0198490415f},
-std::array<float,2>{0.227014646f, 0.81340915f},
-std::array<float,2>{0.532894492f, 0.486556023f},
-std::array<float,2>{0.738572299f, 0.971075892f},
-std::array<float,2>{0.0400082208f, 0.374936759f},
-std::array<float,2>{0.492879778f, 0.539734006f},
-std::array<float,2>{0.84470135f, 0.18435286f},
-std::array<float,2>{0.978054166f, 0.840329587f},
-std::array<float,2>{0.372796297f, 0.471716195f},
-std::array<float,2>{0.195423663f, 0.734176517f},
-std::array<float,2>{0.501539111f, 0.0110855475f},
-std::array<float,2>{0.690058947f, 0.559120119f},
-std::array<float,2>{0.0184827317f, 0.15879336f},
-std::array<float,2>{0.455412477f, 0.99325335f},
-std::array<float,2>{0.823925078f, 0.358733952f},
-std::array<float,2>{0.767647624f, 0.685229897f},
-std::array<float,2>{0.42014271f, 0.065258123f},
-std::array<float,2>{0.0702374727f, 0.767278254f},
-std::array<float,2>{0.650160968f, 0.430773258f},
-std::array<float,2>{0.593075633f, 0.910245419f},
-std::array<float,2>{0.163286403f, 0.259448618f},
-std::array<float,2>{0.283023089f, 0.566530764f},
-std::array<float,2>{0.916664898f, 0.214043215f},
-std::array<float,2>{0.86294359f, 0.942775905f},
-std::array<float,2>{0.476706296f, 0.33463499f},
-std::array<float,2>{0.0559130572f, 0.515006602f},
-std::array<float,2>{0.732834756f, 0.135284498f},
-std::array<float,2>{0.556069493f, 0.698763192f},
-std::array<float,2>{0.245484769f, 0.0452428423f},
-std::array<float,2>{0.318508297f, 0.866353393f},
-std::array<float,2>{0.948454618f, 0.463889867f},
-std::array<float,2>{0.900216222f, 0.596503079f},
-std::array<float,2>{0.271498054f, 0.23422794f},
-std::array<float,2>{0.142528698f, 0.88179481f},
-std::array<float,2>{0.614619493f, 0.281734169f},
-std::array<float,2>{0.657791853f, 0.804514706f},
-std::array<float,2>{0.109064706f, 0.386828214f},
-std::array<float,2>{0.379237324f, 0.6316486f},
-std::array<float,2>{0.799192429f, 0.102084689f},
-std::array<float,2>{0.952060461f, 0.931723177f},
-std::array<float,2>{0.313591778f, 0.270729482f},
-std::array<float,2>{0.247389778f, 0.58618623f},
-std::array<float,2>{0.560822904f, 0.189456433f},
-std::array<float,2>{0.729302049f, 0.660759687f},
-std::array<float,2>{0.0593529455f, 0.0913807675f},
-std::array<float,2>{0.48401615f, 0.754889846f},
-std::array<float,2>{0.866162121f, 0.412852883f},
-std::array<float,2>{0.804643273f, 0.537114441f},
-std::array<float,2>{0.377556533f, 0.174980178f},
-std::array<float,2>{0.102397792f, 0.983512878f},
-std::array<float,2>{0.661272764f, 0.359637231f},
-std::array<float,2>{0.611638427f, 0.824573994f},
-std::array<float,2>{0.148125812f, 0.497695565f},
-std::array<float,2>{0.26687938f, 0.747677445f},
-std::array<float,2>{0.903166771f, 0.0291891638f},
-std::array<float,2>{0.82515192f, 0.792218268f},
-std::array<float,2>{0.460819542f, 0.40485245f},
-std::array<float,2>{0.0210736599f, 0.649349511f},
-std::array<float,2>{0.693537831f, 0.11560718f},
-std::array<float,2>{0.507579982f, 0.614554048f},
-std::array<float,2>{0.202158183f, 0.240202785f},
-std::array<float,2>{0.368967801f, 0.892268062f},
-std::array<float,2>{0.983199537f, 0.309452802f},
-std::array<float,2>{0.921858072f, 0.703887999f},
-std::array<float,2>{0.285439074f, 0.0580963343f},
-std::array<float,2>{0.157784626f, 0.846597254f},
-std::array<float,2>{0.58837837f, 0.441142976f},
-std::array<float,2>{0.655720711f, 0.968185723f},
-std::array<float,2>{0.0652461872f, 0.315945774f},
-std::array<float,2>{0.417870522f, 0.516337156f},
-std::array<float,2>{0.77043879f, 0.144096032f},
-std::array<float,2>{0.884565949f, 0.867449284f},
-std::array<float,2>{0.259127676f, 0.458290726f},
-std::array<float,2>{0.125617668f, 0.692864835f},
-std::array<float,2>{0.600752115f, 0.0343556963f},
-std::array<float,2>{0.685735762f, 0.503712595f},
-std::array<float,2>{0.123242855f, 0.131908029f},
-std::array<float,2>{0.391468853f, 0.953101277f},
-std::array<float,2>{0.794755995f, 0.34134987f},
-std::array<float,2>{0.849122167f, 0.637044072f},
-std::array<float,2>{0.497110367f, 0.101234645f},
-std::array<float,2>{0.0445577949f, 0.806809366f},
-std::array<float,2>{0.73649621f, 0.379604965f},
-std::array<float,2>{0.538726985f, 0.885398507f},
-std::array<float,2>{0.230867147f, 0.294875324f},
-std::array<float,2>{0.338762432f, 0.608252883f},
-std::array<float,2>{0.968571067f, 0.226002574f},
-std::array<float,2>{0.753123999f, 0.989452183f},
-std::array<float,2>{0.428593218f, 0.344384104f},
-std::array<float,2>{0.0875375643f, 0.551180542f},
-std::array<float,2>{0.639822245f, 0.171625718f},
-std::array<float,2>{0.569201589f, 0.724205375f},
-std::array<float,2>{0.187287167f, 0.00137295155f},
-std::array<float,2>{0.308365226f, 0.834682286f},
-std::array<float,2>{0.931848645f, 0.478671342f},
-std::array<float,2>{0.999370694f, 0.572168589f},
-std::array<float,2>{0.346406311f, 0.208834544f},
-std::array<float,2>{0.215637147f, 0.921845496f},
-std::array<float,2>{0.526618481f, 0.250392884f},
-std::array<float,2>{0.705167949f, 0.778306663f},
-std::array<float,2>{0.00881217141f, 0.424726337f},
-std::array<float,2>{0.450441003f, 0.67248565f},
-std::array<float,2>{0.830186903f, 0.0722378418f},
-std::array<float,2>{0.926886022f, 0.938992441f},
-std::array<float,2>{0.299419433f, 0.330169052f},
-std::array<float,2>{0.177845836f, 0.510179937f},
-std::array<float,2>{0.570555449f, 0.139158234f},
-std::array<float,2>{0.630304456f, 0.703075826f},
-std::array<float,2>{0.0844173506f, 0.041059386f},
-std::array<float,2>{0.435705602f, 0.860595405f},
-std::array<float,2>{0.763869524f, 0.465030581f},
-std::array<float,2>{0.842810988f, 0.6007061f},
-std::array<float,2>{0.44441098f, 0.229352072f},
-std::array<float,2>{0.00506587652f, 0.878547668f},
-std::array<float,2>{0.715906143f, 0.287964076f},
-std::array<float,2>{0.520195484f, 0.800424933f},
-std::array<float,2>{0.208607391f, 0.384631574f},
-std::array<float,2>{0.353256375f, 0.62500149f},
-std::array<float,2>{0.991207063f, 0.105505504f},
-std::array<float,2>{0.784957469f, 0.839277983f},
-std::array<float,2>{0.406069875f, 0.476096958f},
-std::array<float,2>{0.110098571f, 0.727692366f},
-std::array<float,2>{0.673295677f, 0.0124021359f},
-std::array<float,2>{0.601649165f, 0.556671321f},
-std::array<float,2>{0.139079005f, 0.162104368f},
-std::array<float,2>{0.255152881f, 0.997140825f},
-std::array<float,2>{0.881698608f, 0.35203895f},
-std::array<float,2>{0.958270907f, 0.682953835f},
-std::array<float,2>{0.329406589f, 0.0687363595f},
-std::array<float,2>{0.226083055f, 0.772614598f},
-std::array<float,2>{0.544680417f, 0.437126428f},
-std::array<float,2>{0.748805702f, 0.908385575f},
-std::array<float,2>{0.035244409f, 0.262197286f},
-std::array<float,2>{0.487486959f, 0.562865436f},
-std::array<float,2>{0.85274595f, 0.216915444f},
-std::array<float,2>{0.970146358f, 0.763020277f},
-std::array<float,2>{0.359462351f, 0.416732609f},
-std::array<float,2>{0.192163259f, 0.670758128f},
-std::array<float,2>{0.511798203f, 0.0833230764f},
-std::array<float,2>{0.695347726f, 0.582220733f},
-std::array<float,2>{0.0304072779f, 0.198512554f},
-std::array<float,2>{0.465916455f, 0.926984251f},
-std::array<float,2>{0.81448102f, 0.280440331f},
-std::array<float,2>{0.773818016f, 0.738507628f},
-std::array<float,2>{0.408677727f, 0.0158930141f},
-std::array<float,2>{0.0767491087f, 0.818330228f},
-std::array<float,2>{0.640640199f, 0.491179794f},
-std::array<float,2>{0.584667087f, 0.973514557f},
-std::array<float,2>{0.171300158f, 0.368282467f},
-std::array<float,2>{0.294437349f, 0.543024719f},
-std::array<float,2>{0.911486864f, 0.182631955f},
-std::array<float,2>{0.870334864f, 0.902288795f},
-std::array<float,2>{0.476170003f, 0.302978456f},
-std::array<float,2>{0.0512932204f, 0.618791342f},
-std::array<float,2>{0.723952949f, 0.247020528f},
-std::array<float,2>{0.552918673f, 0.642380893f},
-std::array<float,2>{0.235315576f, 0.119920753f},
-std::array<float,2>{0.325953782f, 0.781992555f},
-std::array<float,2>{0.938796818f, 0.396123409f},
-std::array<float,2>{0.894310057f, 0.528808117f},
-std::array<float,2>{0.276759416f, 0.154699802f},
-std::array<float,2>{0.15451698f, 0.957569063f},
-std::array<float,2>{0.622440279f, 0.325344741f},
-std::array<float,2>{0.664388239f, 0.855519295f},
-std::array<float,2>{0.100968458f, 0.44776088f},
-std::array<float,2>{0.387943208f, 0.718019009f},
-std::array<float,2>{0.805832148f, 0.0521450005f},
-std::array<float,2>{0.984946668f, 0.979894996f},
-std::array<float,2>{0.356127799f, 0.365514487f},
-std::array<float,2>{0.20640111f, 0.53441304f},
-std::array<float,2>{0.518405378f, 0.177182496f},
-std::array<float,2>{0.711554766f, 0.742456079f},
-std::array<float,2>{0.000573710015f, 0.0271438491f},
-std::array<float,2>{0.440572619f, 0.82228452f},
-std::array<float,2>{0.836849213f, 0.495795637f},
-std::array<float,2>{0.75950557f, 0.592670321f},
-std::array<float,2>{0.430368274f, 0.191589028f},
-std::array<float,2>{0.0790280551f, 0.935996532f},
-std::array<float,2>{0.628890514f, 0.268629581f},
-std::array<float,2>{0.576332867f, 0.752542019f},
-std::array<float,2>{0.175110146f, 0.409639955f},
-std::array<float,2>{0.304086775f, 0.65749985f},
-std::array<float,2>{0.925311923f, 0.0866756067f},
-std::array<float,2>{0.857705832f, 0.847969234f},
-std::array<float,2>{0.491366953f, 0.445270568f},
-std::array<float,2>{0.0316077732f, 0.707323551f},
-std::array<float,2>{0.745457351f, 0.0590634979f},
-std::array<float,2>{0.541068375f, 0.52181685f},
-std::array<float,2>{0.220165372f, 0.14774093f},
-std::array<float,2>{0.332199246f, 0.964461088f},
-std::array<float,2>{0.955625653f, 0.319253683f},
-std::array<float,2>{0.876598358f, 0.652908504f},
-std::array<float,2>{0.253188431f, 0.111434355f},
-std::array<float,2>{0.133189216f, 0.796103954f},
-std::array<float,2>{0.607181787f, 0.400990158f},
-std::array<float,2>{0.676524639f, 0.894796193f},
-std::array<float,2>{0.114377744f, 0.305624306f},
-std::array<float,2>{0.400530308f, 0.610207021f},
-std::array<float,2>{0.785906911f, 0.236110523f},
-std::array<float,2>{0.907897234f, 0.809947073f},
-std::array<float,2>{0.292253792f, 0.377926707f},
-std::array<float,2>{0.167289928f, 0.636530936f},
-std::array<float,2>{0.581360459f, 0.0949350595f},
-std::array<float,2>{0.64498508f, 0.60472095f},
-std::array<float,2>{0.0724785477f, 0.221159384f},
-std::array<float,2>{0.412491113f, 0.886909425f},
-std::array<float,2>{0.780213118f, 0.292617738f},
-std::array<float,2>{0.817255497f, 0.6906299f},
-std::array<float,2>{0.461632371f, 0.0387301818f},
-std::array<float,2>{0.0257153381f, 0.871969044f},
-std::array<float,2>{0.702056766f, 0.453572839f},
-std::array<float,2>{0.509421229f, 0.947220862f},
-std::array<float,2>{0.188255757f, 0.338582605f},
-std::array<float,2>{0.365694255f, 0.505893767f},
-std::array<float,2>{0.973665118f, 0.128897607f},
-std::array<float,2>{0.808891714f, 0.91458261f},
-std::array<float,2>{0.385277778f, 0.256252557f},
-std::array<float,2>{0.0966117159f, 0.576920211f},
-std::array<float,2>{0.66908145f, 0.203696951f},
-std::array<float,2>{0.620838165f, 0.676039577f},
-std::array<float,2>{0.150780067f, 0.0748820528f},
-std::array<float,2>{0.2773453f, 0.774114847f},
-std::array<float,2>{0.894619703f, 0.429434389f},
-std::array<float,2>{0.945075512f, 0.549246788f},
-std::array<float,2>{0.324143261f, 0.165676355f},
-std::array<float,2>{0.241379604f, 0.984497368f},
-std::array<float,2>{0.547692239f, 0.348507524f},
-std::array<float,2>{0.719935179f, 0.829801619f},
-std::array<float,2>{0.0479677692f, 0.480782002f},
-std::array<float,2>{0.471465826f, 0.722407997f},
-std::array<float,2>{0.874688745f, 0.00566838821f},
-std::array<float,2>{0.902324021f, 0.882655263f},
-std::array<float,2>{0.269774109f, 0.282589823f},
-std::array<float,2>{0.143681258f, 0.597001314f},
-std::array<float,2>{0.615698814f, 0.232909918f},
-std::array<float,2>{0.660053909f, 0.63236028f},
-std::array<float,2>{0.106835492f, 0.102636009f},
-std::array<float,2>{0.382221311f, 0.803105056f},
-std::array<float,2>{0.797035992f, 0.388661683f},
-std::array<float,2>{0.859614968f, 0.514042377f},
-std::array<float,2>{0.478980392f, 0.136257723f},
-std::array<float,2>{0.0566514879f, 0.94159168f},
-std::array<float,2>{0.730983377f, 0.335443377f},
-std::array<float,2>{0.557342529f, 0.865652204f},
-std::array<float,2>{0.243549675f, 0.46333763f},
-std::array<float,2>{0.316482365f, 0.698145092f},
-std::array<float,2>{0.946256399f, 0.0460338108f},
-std::array<float,2>{0.767291903f, 0.765793979f},
-std::array<float,2>{0.418057591f, 0.430070728f},
-std::array<float,2>{0.0664692596f, 0.683638155f},
-std::array<float,2>{0.650502622f, 0.0654331967f},
-std::array<float,2>{0.590530455f, 0.567414343f},
-std::array<float,2>{0.161002308f, 0.213756397f},
-std::array<float,2>{0.284482837f, 0.911266565f},
-std::array<float,2>{0.91541189f, 0.25838691f},
-std::array<float,2>{0.97967118f, 0.732975602f},
-std::array<float,2>{0.373119295f, 0.0106871175f},
-std::array<float,2>{0.198874429f, 0.841256261f},
-std::array<float,2>{0.502467036f, 0.470860124f},
-std::array<float,2>{0.68830353f, 0.993008733f},
-std::array<float,2>{0.0172965527f, 0.35798347f},
-std::array<float,2>{0.454586923f, 0.559835613f},
-std::array<float,2>{0.821316838f, 0.159910366f},
-std::array<float,2>{0.964593768f, 0.814329147f},
-std::array<float,2>{0.340923846f, 0.487867504f},
-std::array<float,2>{0.2292649f, 0.735811174f},
-std::array<float,2>{0.535081029f, 0.0206735451f},
-std::array<float,2>{0.741182685f, 0.540447533f},
-std::array<float,2>{0.0418042876f, 0.185142368f},
-std::array<float,2>{0.494675905f, 0.9723441f},
-std::array<float,2>{0.846560955f, 0.37315768f},
-std::array<float,2>{0.79232645f, 0.667227209f},
-std::array<float,2>{0.396943897f, 0.0800873041f},
-std::array<float,2>{0.118834384f, 0.760421336f},
-std::array<float,2>{0.68227309f, 0.421534538f},
-std::array<float,2>{0.594917476f, 0.924689889f},
-std::array<float,2>{0.132539377f, 0.273852915f},
-std::array<float,2>{0.262372971f, 0.580386162f},
-std::array<float,2>{0.888254881f, 0.202233806f},
-std::array<float,2>{0.833652318f, 0.954271257f},
-std::array<float,2>{0.448629558f, 0.322336555f},
-std::array<float,2>{0.0123301754f, 0.525783598f},
-std::array<float,2>{0.707965314f, 0.150858432f},
-std::array<float,2>{0.527906835f, 0.714278281f},
-std::array<float,2>{0.211361557f, 0.0468764119f},
-std::array<float,2>{0.349279314f, 0.853766441f},
-std::array<float,2>{0.994519651f, 0.450628698f},
-std::array<float,2>{0.936482489f, 0.624113202f},
-std::array<float,2>{0.309859186f, 0.244690046f},
-std::array<float,2>{0.1834957f, 0.90386188f},
-std::array<float,2>{0.564345539f, 0.296888769f},
-std::array<float,2>{0.635992765f, 0.78549546f},
-std::array<float,2>{0.0911963135f, 0.390715688f},
-std::array<float,2>{0.422881216f, 0.646381676f},
-std::array<float,2>{0.754289687f, 0.121572018f},
-std::array<float,2>{0.981122792f, 0.89398396f},
-std::array<float,2>{0.36983189f, 0.311244547f},
-std::array<float,2>{0.199397251f, 0.616385639f},
-std::array<float,2>{0.504796863f, 0.240653411f},
-std::array<float,2>{0.69156009f, 0.651315331f},
-std::array<float,2>{0.0216823816f, 0.11467126f},
-std::array<float,2>{0.45734939f, 0.790919483f},
-std::array<float,2>{0.828102052f, 0.402841479f},
-std::array<float,2>{0.771611631f, 0.519182503f},
-std::array<float,2>{0.414376885f, 0.141287535f},
-std::array<float,2>{0.0641595051f, 0.965769112f},
-std::array<float,2>{0.652377486f, 0.313462555f},
-std::array<float,2>{0.586951196f, 0.84467274f},
-std::array<float,2>{0.158799246f, 0.438625723f},
-std::array<float,2>{0.288688928f, 0.705760002f},
-std::array<float,2>{0.918924868f, 0.054794006f},
-std::array<float,2>{0.864483118f, 0.756468058f},
-std::array<float,2>{0.482293338f, 0.410280317f},
-std::array<float,2>{0.0620590113f, 0.663224578f},
-std::array<float,2>{0.72784549f, 0.0932800323f},
-std::array<float,2>{0.559986413f, 0.589083254f},
-std::array<float,2>{0.249766082f, 0.18754065f},
-std::array<float,2>{0.315629959f, 0.929799139f},
-std::array<float,2>{0.949640155f, 0.272692949f},
-std::array<float,2>{0.905056298f, 0.749358952f},
-std::array<float,2>{0.26908046f, 0.029299248f},
-std::array<float,2>{0.145586297f, 0.827151358f},
-std::array<float,2>{0.609895051f, 0.499046028f},
-std::array<float,2>{0.663823664f, 0.98202908f},
-std::array<float,2>{0.105119511f, 0.361717403f},
-std::array<float,2>{0.375812382f, 0.536937237f},
-std::array<float,2>{0.801174283f, 0.173665315f},
-std::array<float,2>{0.931161165f, 0.832630217f},
-std::array<float,2>{0.305065393f, 0.477626085f},
-std::array<float,2>{0.184153348f, 0.724796474f},
-std::array<float,2>{0.566618204f, 0.00334181334f},
-std::array<float,2>{0.637322068f, 0.554141045f},
-std::array<float,2>{0.0886193216f, 0.168711632f},
-std::array<float,2>{0.427374929f, 0.991490126f},
-std::array<float,2>{0.750795066f, 0.347475052f},
-std::array<float,2>{0.828389406f, 0.675473273f},
-std::array<float,2>{0.452371031f, 0.0738490149f},
-std::array<float,2>{0.0110166669f, 0.781084359f},
-std::array<float,2>{0.703326702f, 0.421998829f},
-std::array<float,2>{0.525126278f, 0.918199182f},
-std::array<float,2>{0.217166692f, 0.253892303f},
-std::array<float,2>{0.345567703f, 0.572728813f},
-std::array<float,2>{0.997137964f, 0.210457534f},
-std::array<float,2>{0.7962448f, 0.95024544f},
-std::array<float,2>{0.392613918f, 0.343256086f},
-std::array<float,2>{0.122621827f, 0.500615716f},
-std::array<float,2>{0.685486376f, 0.129775256f},
-std::array<float,2>{0.597838819f, 0.693468928f},
-std::array<float,2>{0.127324358f, 0.0312752724f},
-std::array<float,2>{0.259815931f, 0.869802594f},
-std::array<float,2>{0.885056257f, 0.460419178f},
-std::array<float,2>{0.966449618f, 0.606415451f},
-std::array<float,2>{0.336847872f, 0.223155886f},
-std::array<float,2>{0.233632296f, 0.883208275f},
-std::array<float,2>{0.53690356f, 0.295424283f},
-std::array<float,2>{0.735947132f, 0.805804729f},
-std::array<float,2>{0.0458691008f, 0.382446736f},
-std::array<float,2>{0.498220623f, 0.640277803f},
-std::array<float,2>{0.850303948f, 0.0985535756f},
-std::array<float,2>{0.880741358f, 0.999377131f},
-std::array<float,2>{0.256120235f, 0.354226112f},
-std::array<float,2>{0.138510898f, 0.55569452f},
-std::array<float,2>{0.604903638f, 0.162134498f},
-std::array<float,2>{0.675742626f, 0.729317367f},
-std::array<float,2>{0.112435877f, 0.0153186265f},
-std::array<float,2>{0.403766364f, 0.835956931f},
-std::array<float,2>{0.782752693f, 0.474505961f},
-std::array<float,2>{0.853622377f, 0.566399872f},
-std::array<float,2>{0.484424561f, 0.215449914f},
-std::array<float,2>{0.0371286497f, 0.907477379f},
-std::array<float,2>{0.746278048f, 0.265275031f},
-std::array<float,2>{0.545960188f, 0.77088809f},
-std::array<float,2>{0.223977357f, 0.434942871f},
-std::array<float,2>{0.33012557f, 0.681280553f},
-std::array<float,2>{0.960652649f, 0.0680216849f},
-std::array<float,2>{0.761739492f, 0.861859143f},
-std::array<float,2>{0.435033858f, 0.467219472f},
-std::array<float,2>{0.0838828683f, 0.699235916f},
-std::array<float,2>{0.631912112f, 0.0405625775f},
-std::array<float,2>{0.574005008f, 0.509608328f},
-std::array<float,2>{0.17607519f, 0.138036221f},
-std::array<float,2>{0.29737851f, 0.939642012f},
-std::array<float,2>{0.928112507f, 0.328336716f},
-std::array<float,2>{0.989577293f, 0.627028286f},
-std::array<float,2>{0.354792684f, 0.108357854f},
-std::array<float,2>{0.209405869f, 0.797017455f},
-std::array<float,2>{0.522440195f, 0.386464238f},
-std::array<float,2>{0.718283057f, 0.875243723f},
-std::array<float,2>{0.00674690073f, 0.286384434f},
-std::array<float,2>{0.441934347f, 0.598865807f},
-std::array<float,2>{0.84022665f, 0.227836743f},
-std::array<float,2>{0.939637959f, 0.783854425f},
-std::array<float,2>{0.328054249f, 0.396538645f},
-std::array<float,2>{0.237411484f, 0.644231915f},
-std::array<float,2>{0.552108645f, 0.118254393f},
-std::array<float,2>{0.724913061f, 0.620197952f},
-std::array<float,2>{0.0528161414f, 0.249522388f},
-std::array<float,2>{0.473711401f, 0.898983419f},
-std::array<float,2>{0.868232608f, 0.301491112f},
-std::array<float,2>{0.807756186f, 0.716278553f},
-std::array<float,2>{0.389353633f, 0.0533531718f},
-std::array<float,2>{0.0989646539f, 0.858440578f},
-std::array<float,2>{0.667913377f, 0.446180373f},
-std::array<float,2>{0.624558449f, 0.95935905f},
-std::array<float,2>{0.153523669f, 0.327048749f},
-std::array<float,2>{0.27372244f, 0.530238807f},
-std::array<float,2>{0.891024351f, 0.152858585f},
-std::array<float,2>{0.814075828f, 0.929399788f},
-std::array<float,2>{0.467542619f, 0.278935939f},
-std::array<float,2>{0.028033914f, 0.585155547f},
-std::array<float,2>{0.698493361f, 0.196350634f},
-std::array<float,2>{0.513805509f, 0.669749975f},
-std::array<float,2>{0.194917828f, 0.0846365988f},
-std::array<float,2>{0.362227231f, 0.764806449f},
-std::array<float,2>{0.972515941f, 0.414997011f},
-std::array<float,2>{0.91312623f, 0.545588255f},
-std::array<float,2>{0.296785802f, 0.180780768f},
-std::array<float,2>{0.168539286f, 0.976091802f},
-std::array<float,2>{0.583490551f, 0.369586319f},
-std::array<float,2>{0.643728733f, 0.819793999f},
-std::array<float,2>{0.0760941133f, 0.489379436f},
-std::array<float,2>{0.407409668f, 0.740720272f},
-std::array<float,2>{0.777047575f, 0.018709505f},
-std::array<float,2>{0.953548729f, 0.962477565f},
-std::array<float,2>{0.334649265f, 0.317195266f},
-std::array<float,2>{0.221301168f, 0.519657373f},
-std::array<float,2>{0.539430678f, 0.145983055f},
-std::array<float,2>{0.743339479f, 0.710254431f},
-std::array<float,2>{0.0338565558f, 0.0608614013f},
-std::array<float,2>{0.488424182f, 0.85003984f},
-std::array<float,2>{0.856624722f, 0.443105429f},
-std::array<float,2>{0.787348509f, 0.612563372f},
-std::array<float,2>{0.399264246f, 0.237787262f},
-std::array<float,2>{0.115631163f, 0.897518635f},
-std::array<float,2>{0.678924441f, 0.307004243f},
-std::array<float,2>{0.609330475f, 0.794018447f},
-std::array<float,2>{0.136435226f, 0.398565143f},
-std::array<float,2>{0.250665367f, 0.655113459f},
-std::array<float,2>{0.878758669f, 0.110279031f},
-std::array<float,2>{0.83837533f, 0.820630074f},
-std::array<float,2>{0.439411938f, 0.493809223f},
-std::array<float,2>{0.00197510654f, 0.745399117f},
-std::array<float,2>{0.71367079f, 0.0248993207f},
-std::array<float,2>{0.515654266f, 0.531910241f},
-std::array<float,2>{0.20429866f, 0.179090574f},
-std::array<float,2>{0.357714355f, 0.977509797f},
-std::array<float,2>{0.986933351f, 0.364490807f},
-std::array<float,2>{0.921878815f, 0.658334017f},
-std::array<float,2>{0.30174908f, 0.0878946632f},
-std::array<float,2>{0.173607975f, 0.751826584f},
-std::array<float,2>{0.574584246f, 0.407446265f},
-std::array<float,2>{0.62569201f, 0.934868157f},
-std::array<float,2>{0.0812240019f, 0.266642064f},
-std::array<float,2>{0.432383746f, 0.590097487f},
-std::array<float,2>{0.76064676f, 0.193647534f},
-std::array<float,2>{0.898079872f, 0.776345015f},
-std::array<float,2>{0.280659169f, 0.426551014f},
-std::array<float,2>{0.148797989f, 0.679087937f},
-std::array<float,2>{0.619080961f, 0.0772765055f},
-std::array<float,2>{0.671065032f, 0.574988663f},
-std::array<float,2>{0.0942800865f, 0.206172422f},
-std::array<float,2>{0.383009911f, 0.917162061f},
-std::array<float,2>{0.811421096f, 0.255638629f},
-std::array<float,2>{0.871193945f, 0.719747841f},
-std::array<float,2>{0.469028831f, 0.00630417233f},
-std::array<float,2>{0.0492333323f, 0.830646753f},
-std::array<float,2>{0.722527742f, 0.483195752f},
-std::array<float,2>{0.549057424f, 0.987765729f},
-std::array<float,2>{0.23918964f, 0.349886835f},
-std::array<float,2>{0.320831865f, 0.547718227f},
-std::array<float,2>{0.943264782f, 0.166386947f},
-std::array<float,2>{0.777876675f, 0.889369667f},
-std::array<float,2>{0.411280006f, 0.290264696f},
-std::array<float,2>{0.071943894f, 0.601564825f},
-std::array<float,2>{0.648368657f, 0.218866885f},
-std::array<float,2>{0.578992844f, 0.634263635f},
-std::array<float,2>{0.164367825f, 0.0967314094f},
-std::array<float,2>{0.289720744f, 0.812270761f},
-std::array<float,2>{0.908425868f, 0.375282258f},
-std::array<float,2>{0.975896955f, 0.50552851f},
-std::array<float,2>{0.363352388f, 0.125066027f},
-std::array<float,2>{0.190612331f, 0.947994411f},
-std::array<float,2>{0.511452854f, 0.336552054f},
-std::array<float,2>{0.700755537f, 0.874663889f},
-std::array<float,2>{0.0238643251f, 0.45522064f},
-std::array<float,2>{0.463577479f, 0.68839258f},
-std::array<float,2>{0.819236875f, 0.0353693664f},
-std::array<float,2>{0.917605937f, 0.91350621f},
-std::array<float,2>{0.281926662f, 0.260724604f},
-std::array<float,2>{0.162525743f, 0.569703996f},
-std::array<float,2>{0.592069864f, 0.211060792f},
-std::array<float,2>{0.648593903f, 0.686373472f},
-std::array<float,2>{0.0685266554f, 0.063168034f},
-std::array<float,2>{0.421817482f, 0.768350601f},
-std::array<float,2>{0.769080818f, 0.4330827f},
-std::array<float,2>{0.822799861f, 0.561373651f},
-std::array<float,2>{0.456867814f, 0.1579431f},
-std::array<float,2>{0.0189975034f, 0.994329572f},
-std::array<float,2>{0.69086051f, 0.356398761f},
-std::array<float,2>{0.500621378f, 0.843213916f},
-std::array<float,2>{0.196475908f, 0.469689697f},
-std::array<float,2>{0.371179432f, 0.732334793f},
-std::array<float,2>{0.977464557f, 0.00905720796f},
-std::array<float,2>{0.800302088f, 0.801522315f},
-std::array<float,2>{0.38057664f, 0.389820099f},
-std::array<float,2>{0.107982412f, 0.630397797f},
-std::array<float,2>{0.657143474f, 0.105185427f},
-std::array<float,2>{0.613973618f, 0.594098747f},
-std::array<float,2>{0.141109705f, 0.231614441f},
-std::array<float,2>{0.272844195f, 0.880028307f},
-std::array<float,2>{0.898515761f, 0.283281803f},
-std::array<float,2>{0.947645545f, 0.696275711f},
-std::array<float,2>{0.319623023f, 0.044286035f},
-std::array<float,2>{0.244765297f, 0.864789188f},
-std::array<float,2>{0.554770827f, 0.461007386f},
-std::array<float,2>{0.733917415f, 0.94424367f},
-std::array<float,2>{0.0549970642f, 0.33386302f},
-std::array<float,2>{0.477770835f, 0.512948334f},
-std::array<float,2>{0.862170756f, 0.132996514f},
-std::array<float,2>{0.992642999f, 0.851969182f},
-std::array<float,2>{0.350190073f, 0.452921391f},
-std::array<float,2>{0.213280961f, 0.711950958f},
-std::array<float,2>{0.531217873f, 0.0491086319f},
-std::array<float,2>{0.710075021f, 0.525363088f},
-std::array<float,2>{0.0137752276f, 0.149849385f},
-std::array<float,2>{0.445914865f, 0.95599848f},
-std::array<float,2>{0.834133625f, 0.320973903f},
-std::array<float,2>{0.75676918f, 0.648139119f},
-std::array<float,2>{0.424349666f, 0.12340837f},
-std::array<float,2>{0.0929038972f, 0.788157463f},
-std::array<float,2>{0.634313345f, 0.393979371f},
-std::array<float,2>{0.565676153f, 0.90445286f},
-std::array<float,2>{0.181542277f, 0.299374193f},
-std::array<float,2>{0.310810715f, 0.622733355f},
-std::array<float,2>{0.933922768f, 0.243673995f},
-std::array<float,2>{0.845662713f, 0.96965903f},
-std::array<float,2>{0.493506581f, 0.371689498f},
-std::array<float,2>{0.0406923406f, 0.541966856f},
-std::array<float,2>{0.740196586f, 0.186832681f},
-std::array<float,2>{0.531428456f, 0.737436116f},
-std::array<float,2>{0.228164762f, 0.0218535699f},
-std::array<float,2>{0.343312442f, 0.816377044f},
-std::array<float,2>{0.962198079f, 0.484559178f},
-std::array<float,2>{0.889962673f, 0.578580916f},
-std::array<float,2>{0.263810635f, 0.199789062f},
-std::array<float,2>{0.129586041f, 0.922119617f},
-std::array<float,2>{0.597059608f, 0.277257234f},
-std::array<float,2>{0.681635857f, 0.75930059f},
-std::array<float,2>{0.119284786f, 0.419601023f},
-std::array<float,2>{0.395313978f, 0.664815187f},
-std::array<float,2>{0.790459156f, 0.0798781291f}}
\ No newline at end of file
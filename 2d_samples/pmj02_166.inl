@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.305288672f, 0.386578053f},
-std::array<float,2>{0.686249197f, 0.863689363f},
-std::array<float,2>{0.960575402f, 0.0522994362f},
-std::array<float,2>{0.184898049f, 0.649671793f},
-std::array<float,2>{0.0470164828f, 0.126519054f},
-std::array<float,2>{0.833284557f, 0.548294961f},
-std::array<float,2>{0.564172626f, 0.316570282f},
-std::array<float,2>{0.498699665f, 0.967921853f},
-std::array<float,2>{0.222480983f, 0.308048069f},
-std::array<float,2>{0.889086366f, 0.928623259f},
-std::array<float,2>{0.738697052f, 0.198917419f},
-std::array<float,2>{0.321845233f, 0.593063653f},
-std::array<float,2>{0.393413931f, 0.0765138492f},
-std::array<float,2>{0.554509044f, 0.742802799f},
-std::array<float,2>{0.782646954f, 0.44850868f},
-std::array<float,2>{0.0704019368f, 0.76498872f},
-std::array<float,2>{0.450333446f, 0.362421125f},
-std::array<float,2>{0.60580641f, 0.996810734f},
-std::array<float,2>{0.854027033f, 0.184277371f},
-std::array<float,2>{0.000352199393f, 0.521668136f},
-std::array<float,2>{0.131542876f, 0.0284034535f},
-std::array<float,2>{0.973659039f, 0.667926252f},
-std::array<float,2>{0.652663827f, 0.435441554f},
-std::array<float,2>{0.260437548f, 0.831244946f},
-std::array<float,2>{0.100266516f, 0.497012109f},
-std::array<float,2>{0.766169429f, 0.811832905f},
-std::array<float,2>{0.509146214f, 0.105828956f},
-std::array<float,2>{0.417497456f, 0.698690832f},
-std::array<float,2>{0.374521345f, 0.248276904f},
-std::array<float,2>{0.716765523f, 0.623001635f},
-std::array<float,2>{0.920424879f, 0.26671046f},
-std::array<float,2>{0.208085641f, 0.877555549f},
-std::array<float,2>{0.422917336f, 0.453838348f},
-std::array<float,2>{0.523936927f, 0.779007673f},
-std::array<float,2>{0.761231959f, 0.0839241147f},
-std::array<float,2>{0.117261313f, 0.732024848f},
-std::array<float,2>{0.189169049f, 0.217950404f},
-std::array<float,2>{0.935679972f, 0.567968488f},
-std::array<float,2>{0.690907061f, 0.284233361f},
-std::array<float,2>{0.354412615f, 0.919775605f},
-std::array<float,2>{0.0214329083f, 0.334121972f},
-std::array<float,2>{0.866820216f, 0.944338381f},
-std::array<float,2>{0.609646916f, 0.150856227f},
-std::array<float,2>{0.461349905f, 0.54074949f},
-std::array<float,2>{0.270109206f, 0.0360329486f},
-std::array<float,2>{0.634453714f, 0.637395263f},
-std::array<float,2>{0.992457926f, 0.401988745f},
-std::array<float,2>{0.149635062f, 0.847108543f},
-std::array<float,2>{0.336493909f, 0.257839024f},
-std::array<float,2>{0.725813329f, 0.895501852f},
-std::array<float,2>{0.892549872f, 0.223649204f},
-std::array<float,2>{0.235175461f, 0.598163545f},
-std::array<float,2>{0.0787737146f, 0.120768189f},
-std::array<float,2>{0.800031424f, 0.705201983f},
-std::array<float,2>{0.533702135f, 0.471687406f},
-std::array<float,2>{0.376805842f, 0.791672349f},
-std::array<float,2>{0.166149318f, 0.409982681f},
-std::array<float,2>{0.94675374f, 0.822062194f},
-std::array<float,2>{0.656495154f, 0.011082286f},
-std::array<float,2>{0.293195844f, 0.685513794f},
-std::array<float,2>{0.483147591f, 0.166075513f},
-std::array<float,2>{0.592862248f, 0.515169382f},
-std::array<float,2>{0.813418031f, 0.352883846f},
-std::array<float,2>{0.0365746804f, 0.975549757f},
-std::array<float,2>{0.345947444f, 0.479399115f},
-std::array<float,2>{0.698122263f, 0.783813953f},
-std::array<float,2>{0.927362382f, 0.109643333f},
-std::array<float,2>{0.197723731f, 0.71308583f},
-std::array<float,2>{0.111645192f, 0.227868348f},
-std::array<float,2>{0.757377744f, 0.60202688f},
-std::array<float,2>{0.523182452f, 0.252569586f},
-std::array<float,2>{0.434076995f, 0.905569255f},
-std::array<float,2>{0.142507911f, 0.348545074f},
-std::array<float,2>{0.98482728f, 0.984352112f},
-std::array<float,2>{0.627923787f, 0.156919733f},
-std::array<float,2>{0.275170714f, 0.504428625f},
-std::array<float,2>{0.455878228f, 0.00657733204f},
-std::array<float,2>{0.620397627f, 0.67945987f},
-std::array<float,2>{0.868265033f, 0.41623655f},
-std::array<float,2>{0.0234653521f, 0.817305803f},
-std::array<float,2>{0.382827461f, 0.291003346f},
-std::array<float,2>{0.54601568f, 0.911553741f},
-std::array<float,2>{0.809068263f, 0.210928783f},
-std::array<float,2>{0.0901120976f, 0.570966125f},
-std::array<float,2>{0.248312071f, 0.0911555812f},
-std::array<float,2>{0.901634336f, 0.720460474f},
-std::array<float,2>{0.727846861f, 0.46340844f},
-std::array<float,2>{0.328897864f, 0.768908679f},
-std::array<float,2>{0.0414396189f, 0.39141053f},
-std::array<float,2>{0.822680652f, 0.851678669f},
-std::array<float,2>{0.582222283f, 0.0448588356f},
-std::array<float,2>{0.472783446f, 0.627923727f},
-std::array<float,2>{0.281975865f, 0.14674288f},
-std::array<float,2>{0.666528761f, 0.534323573f},
-std::array<float,2>{0.943878353f, 0.340336055f},
-std::array<float,2>{0.163072005f, 0.951409161f},
-std::array<float,2>{0.485748798f, 0.428049892f},
-std::array<float,2>{0.577329934f, 0.840196669f},
-std::array<float,2>{0.839506209f, 0.0209673773f},
-std::array<float,2>{0.0566104129f, 0.658926725f},
-std::array<float,2>{0.178076223f, 0.179585412f},
-std::array<float,2>{0.968228698f, 0.531176984f},
-std::array<float,2>{0.676356912f, 0.369000882f},
-std::array<float,2>{0.299690574f, 0.984582841f},
-std::array<float,2>{0.0666328147f, 0.274180442f},
-std::array<float,2>{0.79377538f, 0.883971274f},
-std::array<float,2>{0.555205047f, 0.238195017f},
-std::array<float,2>{0.398666322f, 0.609928906f},
-std::array<float,2>{0.315549403f, 0.0999184549f},
-std::array<float,2>{0.744741976f, 0.690378189f},
-std::array<float,2>{0.878900588f, 0.485928982f},
-std::array<float,2>{0.227695644f, 0.79811126f},
-std::array<float,2>{0.257739097f, 0.326521546f},
-std::array<float,2>{0.641486585f, 0.958752096f},
-std::array<float,2>{0.977654397f, 0.133969128f},
-std::array<float,2>{0.137882724f, 0.555075645f},
-std::array<float,2>{0.0126858f, 0.0613480732f},
-std::array<float,2>{0.848065317f, 0.645305455f},
-std::array<float,2>{0.597356141f, 0.379486024f},
-std::array<float,2>{0.438924402f, 0.868307292f},
-std::array<float,2>{0.214091852f, 0.443590432f},
-std::array<float,2>{0.912234008f, 0.754000068f},
-std::array<float,2>{0.709367871f, 0.0632823408f},
-std::array<float,2>{0.362349451f, 0.74194622f},
-std::array<float,2>{0.411709815f, 0.191370323f},
-std::array<float,2>{0.502003729f, 0.585758924f},
-std::array<float,2>{0.780200124f, 0.301190943f},
-std::array<float,2>{0.106214926f, 0.93559736f},
-std::array<float,2>{0.325119466f, 0.420085073f},
-std::array<float,2>{0.737414002f, 0.816331148f},
-std::array<float,2>{0.883178532f, 0.000785336713f},
-std::array<float,2>{0.224119857f, 0.675084174f},
-std::array<float,2>{0.0753201917f, 0.163899511f},
-std::array<float,2>{0.785796821f, 0.501067936f},
-std::array<float,2>{0.54821986f, 0.343938857f},
-std::array<float,2>{0.397661865f, 0.977039516f},
-std::array<float,2>{0.182291552f, 0.256497592f},
-std::array<float,2>{0.95554173f, 0.901649475f},
-std::array<float,2>{0.68351841f, 0.234095126f},
-std::array<float,2>{0.312408924f, 0.607475042f},
-std::array<float,2>{0.495045543f, 0.113858022f},
-std::array<float,2>{0.567914546f, 0.716213584f},
-std::array<float,2>{0.829097807f, 0.481599957f},
-std::array<float,2>{0.0536207445f, 0.787561536f},
-std::array<float,2>{0.419970274f, 0.335966915f},
-std::array<float,2>{0.51179564f, 0.949195802f},
-std::array<float,2>{0.772090435f, 0.142198429f},
-std::array<float,2>{0.0962487608f, 0.538379133f},
-std::array<float,2>{0.204595983f, 0.0394198112f},
-std::array<float,2>{0.915070415f, 0.629255474f},
-std::array<float,2>{0.712810695f, 0.396972448f},
-std::array<float,2>{0.367333889f, 0.857212007f},
-std::array<float,2>{0.00688295113f, 0.467690021f},
-std::array<float,2>{0.857895315f, 0.769538522f},
-std::array<float,2>{0.601762414f, 0.0887291804f},
-std::array<float,2>{0.447716653f, 0.723437488f},
-std::array<float,2>{0.262582481f, 0.203967586f},
-std::array<float,2>{0.652200222f, 0.577965736f},
-std::array<float,2>{0.971801281f, 0.295648217f},
-std::array<float,2>{0.125831723f, 0.907073915f},
-std::array<float,2>{0.465969503f, 0.491470963f},
-std::array<float,2>{0.6157974f, 0.802274704f},
-std::array<float,2>{0.85994029f, 0.0973927751f},
-std::array<float,2>{0.0160113983f, 0.694611013f},
-std::array<float,2>{0.155804008f, 0.238312706f},
-std::array<float,2>{0.996822178f, 0.617021024f},
-std::array<float,2>{0.637393832f, 0.281129062f},
-std::array<float,2>{0.268752247f, 0.890503168f},
-std::array<float,2>{0.124046095f, 0.372164667f},
-std::array<float,2>{0.762349188f, 0.990048826f},
-std::array<float,2>{0.529000878f, 0.173532262f},
-std::array<float,2>{0.426613361f, 0.526950538f},
-std::array<float,2>{0.356399059f, 0.0173610225f},
-std::array<float,2>{0.693034947f, 0.660679638f},
-std::array<float,2>{0.932346404f, 0.42361775f},
-std::array<float,2>{0.193130851f, 0.836206973f},
-std::array<float,2>{0.291043431f, 0.298373818f},
-std::array<float,2>{0.660563648f, 0.931662679f},
-std::array<float,2>{0.950734138f, 0.192499951f},
-std::array<float,2>{0.170272082f, 0.578243852f},
-std::array<float,2>{0.0337658897f, 0.0673692897f},
-std::array<float,2>{0.819338679f, 0.737838268f},
-std::array<float,2>{0.588001013f, 0.441112012f},
-std::array<float,2>{0.479357421f, 0.750401139f},
-std::array<float,2>{0.239631429f, 0.375703812f},
-std::array<float,2>{0.896310806f, 0.871125221f},
-std::array<float,2>{0.719140708f, 0.0558781736f},
-std::array<float,2>{0.340697378f, 0.643903971f},
-std::array<float,2>{0.381507516f, 0.139082521f},
-std::array<float,2>{0.537590206f, 0.560360134f},
-std::array<float,2>{0.800986946f, 0.321353436f},
-std::array<float,2>{0.0851212367f, 0.956694961f},
-std::array<float,2>{0.279311121f, 0.450208336f},
-std::array<float,2>{0.630614698f, 0.758776128f},
-std::array<float,2>{0.989041686f, 0.071724616f},
-std::array<float,2>{0.146223798f, 0.749575257f},
-std::array<float,2>{0.0275044087f, 0.201064155f},
-std::array<float,2>{0.873697042f, 0.587718606f},
-std::array<float,2>{0.622696042f, 0.310486048f},
-std::array<float,2>{0.460931689f, 0.924784482f},
-std::array<float,2>{0.202145651f, 0.315510124f},
-std::array<float,2>{0.923922956f, 0.961369038f},
-std::array<float,2>{0.702383518f, 0.129624739f},
-std::array<float,2>{0.349639982f, 0.552336454f},
-std::array<float,2>{0.430400699f, 0.0470868014f},
-std::array<float,2>{0.516469657f, 0.655035496f},
-std::array<float,2>{0.751051724f, 0.388388097f},
-std::array<float,2>{0.115306765f, 0.860422611f},
-std::array<float,2>{0.469211429f, 0.271168023f},
-std::array<float,2>{0.581296146f, 0.882093251f},
-std::array<float,2>{0.824294984f, 0.24593994f},
-std::array<float,2>{0.0454484969f, 0.619549453f},
-std::array<float,2>{0.157806858f, 0.105307892f},
-std::array<float,2>{0.938801289f, 0.701425016f},
-std::array<float,2>{0.669088721f, 0.494637698f},
-std::array<float,2>{0.288119197f, 0.805652857f},
-std::array<float,2>{0.089373149f, 0.431468427f},
-std::array<float,2>{0.80585438f, 0.834234595f},
-std::array<float,2>{0.540994525f, 0.026447691f},
-std::array<float,2>{0.389966279f, 0.668706298f},
-std::array<float,2>{0.334261149f, 0.181937814f},
-std::array<float,2>{0.731914699f, 0.518690467f},
-std::array<float,2>{0.904176176f, 0.365981191f},
-std::array<float,2>{0.244248495f, 0.994866014f},
-std::array<float,2>{0.402647227f, 0.404496461f},
-std::array<float,2>{0.560781121f, 0.848865569f},
-std::array<float,2>{0.791422546f, 0.0325449854f},
-std::array<float,2>{0.0659547746f, 0.632845402f},
-std::array<float,2>{0.230531231f, 0.154827222f},
-std::array<float,2>{0.88146317f, 0.544486284f},
-std::array<float,2>{0.748580873f, 0.331779122f},
-std::array<float,2>{0.318868339f, 0.939574003f},
-std::array<float,2>{0.0591247231f, 0.286442369f},
-std::array<float,2>{0.842530549f, 0.917424321f},
-std::array<float,2>{0.571353436f, 0.214791119f},
-std::array<float,2>{0.489906967f, 0.562768936f},
-std::array<float,2>{0.301750898f, 0.0784964636f},
-std::array<float,2>{0.672382295f, 0.728675365f},
-std::array<float,2>{0.963204861f, 0.457499743f},
-std::array<float,2>{0.173922285f, 0.776240408f},
-std::array<float,2>{0.363590747f, 0.359164953f},
-std::array<float,2>{0.704125643f, 0.969798505f},
-std::array<float,2>{0.9081496f, 0.170978844f},
-std::array<float,2>{0.218099579f, 0.510517418f},
-std::array<float,2>{0.101938359f, 0.0121490471f},
-std::array<float,2>{0.774374008f, 0.68286109f},
-std::array<float,2>{0.506026924f, 0.411075979f},
-std::array<float,2>{0.407999039f, 0.826342702f},
-std::array<float,2>{0.136010572f, 0.473126918f},
-std::array<float,2>{0.98267895f, 0.796117783f},
-std::array<float,2>{0.64840734f, 0.122673661f},
-std::array<float,2>{0.25045678f, 0.710091412f},
-std::array<float,2>{0.443432599f, 0.222039163f},
-std::array<float,2>{0.600230873f, 0.59694165f},
-std::array<float,2>{0.846945643f, 0.265143186f},
-std::array<float,2>{0.00873950217f, 0.893715084f},
-std::array<float,2>{0.258925736f, 0.436428308f},
-std::array<float,2>{0.654408395f, 0.829300761f},
-std::array<float,2>{0.975661993f, 0.0299323611f},
-std::array<float,2>{0.129227415f, 0.664353967f},
-std::array<float,2>{0.00223632413f, 0.186865851f},
-std::array<float,2>{0.853301883f, 0.521119535f},
-std::array<float,2>{0.607927442f, 0.361234993f},
-std::array<float,2>{0.452141494f, 0.998818278f},
-std::array<float,2>{0.209050968f, 0.267991662f},
-std::array<float,2>{0.919469714f, 0.876540363f},
-std::array<float,2>{0.718443871f, 0.247246295f},
-std::array<float,2>{0.372851253f, 0.624770105f},
-std::array<float,2>{0.415492415f, 0.107747912f},
-std::array<float,2>{0.511685073f, 0.696813941f},
-std::array<float,2>{0.768890023f, 0.498342901f},
-std::array<float,2>{0.0991425142f, 0.810068488f},
-std::array<float,2>{0.496341497f, 0.32001096f},
-std::array<float,2>{0.565755785f, 0.965791166f},
-std::array<float,2>{0.83550036f, 0.128010079f},
-std::array<float,2>{0.0489723757f, 0.549647033f},
-std::array<float,2>{0.186839953f, 0.0541870706f},
-std::array<float,2>{0.958117247f, 0.651928246f},
-std::array<float,2>{0.68550235f, 0.384236306f},
-std::array<float,2>{0.308395088f, 0.866810322f},
-std::array<float,2>{0.0724627376f, 0.445786178f},
-std::array<float,2>{0.783846855f, 0.763513982f},
-std::array<float,2>{0.550907135f, 0.0748798475f},
-std::array<float,2>{0.392206877f, 0.746070385f},
-std::array<float,2>{0.322590947f, 0.195715055f},
-std::array<float,2>{0.741227746f, 0.590279996f},
-std::array<float,2>{0.88825053f, 0.306273133f},
-std::array<float,2>{0.219006523f, 0.927471995f},
-std::array<float,2>{0.3783741f, 0.469561458f},
-std::array<float,2>{0.531866133f, 0.790126979f},
-std::array<float,2>{0.797272682f, 0.11782372f},
-std::array<float,2>{0.0806314275f, 0.703914344f},
-std::array<float,2>{0.237812415f, 0.226300806f},
-std::array<float,2>{0.892729104f, 0.600484431f},
-std::array<float,2>{0.723145843f, 0.259996921f},
-std::array<float,2>{0.338911563f, 0.898384094f},
-std::array<float,2>{0.0379811749f, 0.355081379f},
-std::array<float,2>{0.814768493f, 0.973214269f},
-std::array<float,2>{0.591330647f, 0.164953038f},
-std::array<float,2>{0.480895549f, 0.512652755f},
-std::array<float,2>{0.29562366f, 0.0079692807f},
-std::array<float,2>{0.658860028f, 0.685622454f},
-std::array<float,2>{0.948668301f, 0.408157051f},
-std::array<float,2>{0.164407238f, 0.823963642f},
-std::array<float,2>{0.352537245f, 0.28218472f},
-std::array<float,2>{0.688893497f, 0.921076f},
-std::array<float,2>{0.934160948f, 0.216075256f},
-std::array<float,2>{0.191257596f, 0.568491518f},
-std::array<float,2>{0.120911673f, 0.0846207291f},
-std::array<float,2>{0.759095669f, 0.733535469f},
-std::array<float,2>{0.525449336f, 0.455926478f},
-std::array<float,2>{0.425359577f, 0.779641032f},
-std::array<float,2>{0.151731476f, 0.398524612f},
-std::array<float,2>{0.995320559f, 0.844092727f},
-std::array<float,2>{0.635737896f, 0.0379502997f},
-std::array<float,2>{0.272778004f, 0.639643252f},
-std::array<float,2>{0.464780986f, 0.14958398f},
-std::array<float,2>{0.612673879f, 0.541188121f},
-std::array<float,2>{0.864414513f, 0.332103819f},
-std::array<float,2>{0.0226217993f, 0.943044126f},
-std::array<float,2>{0.331795394f, 0.461515635f},
-std::array<float,2>{0.730058074f, 0.766075313f},
-std::array<float,2>{0.900208831f, 0.0928906277f},
-std::array<float,2>{0.24662599f, 0.721487761f},
-std::array<float,2>{0.0925304219f, 0.20731321f},
-std::array<float,2>{0.811964452f, 0.572996676f},
-std::array<float,2>{0.544550776f, 0.292268872f},
-std::array<float,2>{0.385597676f, 0.913907051f},
-std::array<float,2>{0.160742998f, 0.343405426f},
-std::array<float,2>{0.941612899f, 0.950961947f},
-std::array<float,2>{0.66539371f, 0.145997211f},
-std::array<float,2>{0.2847341f, 0.532313466f},
-std::array<float,2>{0.475620151f, 0.0456432812f},
-std::array<float,2>{0.584474385f, 0.625699461f},
-std::array<float,2>{0.821502686f, 0.393120944f},
-std::array<float,2>{0.0407639071f, 0.854138911f},
-std::array<float,2>{0.436542153f, 0.250489622f},
-std::array<float,2>{0.519549012f, 0.903979897f},
-std::array<float,2>{0.754406691f, 0.229710907f},
-std::array<float,2>{0.111268759f, 0.603628099f},
-std::array<float,2>{0.196981639f, 0.113270603f},
-std::array<float,2>{0.928114235f, 0.711907089f},
-std::array<float,2>{0.696693659f, 0.477031112f},
-std::array<float,2>{0.34555313f, 0.781942904f},
-std::array<float,2>{0.025767792f, 0.415066987f},
-std::array<float,2>{0.869301677f, 0.818743467f},
-std::array<float,2>{0.617628217f, 0.00442247977f},
-std::array<float,2>{0.453848988f, 0.677510083f},
-std::array<float,2>{0.276675493f, 0.159177095f},
-std::array<float,2>{0.626793861f, 0.506514847f},
-std::array<float,2>{0.987335622f, 0.350882947f},
-std::array<float,2>{0.143195033f, 0.981358647f},
-std::array<float,2>{0.441085249f, 0.381271005f},
-std::array<float,2>{0.594339609f, 0.870076716f},
-std::array<float,2>{0.851330221f, 0.0598831661f},
-std::array<float,2>{0.0142772216f, 0.647407472f},
-std::array<float,2>{0.140377864f, 0.135568306f},
-std::array<float,2>{0.978662789f, 0.556850791f},
-std::array<float,2>{0.643513143f, 0.325864285f},
-std::array<float,2>{0.254645884f, 0.960270047f},
-std::array<float,2>{0.107509986f, 0.304677516f},
-std::array<float,2>{0.778519511f, 0.934339404f},
-std::array<float,2>{0.500472188f, 0.188751757f},
-std::array<float,2>{0.412273049f, 0.583360076f},
-std::array<float,2>{0.359768748f, 0.0659689531f},
-std::array<float,2>{0.707681119f, 0.739641249f},
-std::array<float,2>{0.911417246f, 0.443123281f},
-std::array<float,2>{0.212577745f, 0.756615758f},
-std::array<float,2>{0.298190683f, 0.369726956f},
-std::array<float,2>{0.678184509f, 0.987259269f},
-std::array<float,2>{0.966494024f, 0.177470878f},
-std::array<float,2>{0.176723808f, 0.528268158f},
-std::array<float,2>{0.0566504709f, 0.0214869399f},
-std::array<float,2>{0.837098658f, 0.656439841f},
-std::array<float,2>{0.574561656f, 0.426094711f},
-std::array<float,2>{0.487359047f, 0.842073262f},
-std::array<float,2>{0.229367107f, 0.487993687f},
-std::array<float,2>{0.87625134f, 0.799283922f},
-std::array<float,2>{0.742870569f, 0.0995791107f},
-std::array<float,2>{0.312528849f, 0.687681794f},
-std::array<float,2>{0.401400536f, 0.234568626f},
-std::array<float,2>{0.556805253f, 0.61224854f},
-std::array<float,2>{0.795666337f, 0.276072919f},
-std::array<float,2>{0.0691820681f, 0.885797024f},
-std::array<float,2>{0.370679498f, 0.39521268f},
-std::array<float,2>{0.713616848f, 0.859297872f},
-std::array<float,2>{0.917068601f, 0.0427002273f},
-std::array<float,2>{0.205809981f, 0.631353974f},
-std::array<float,2>{0.0941651538f, 0.144374341f},
-std::array<float,2>{0.771348119f, 0.535319448f},
-std::array<float,2>{0.515228391f, 0.339125514f},
-std::array<float,2>{0.419475019f, 0.94611603f},
-std::array<float,2>{0.128713921f, 0.294187903f},
-std::array<float,2>{0.968909383f, 0.909081876f},
-std::array<float,2>{0.649078906f, 0.20564653f},
-std::array<float,2>{0.265240818f, 0.575840652f},
-std::array<float,2>{0.447172761f, 0.0871572271f},
-std::array<float,2>{0.604352176f, 0.724785864f},
-std::array<float,2>{0.856083751f, 0.466369838f},
-std::array<float,2>{0.00460241735f, 0.772129655f},
-std::array<float,2>{0.395314753f, 0.347461224f},
-std::array<float,2>{0.549958229f, 0.980138123f},
-std::array<float,2>{0.787232101f, 0.16150786f},
-std::array<float,2>{0.0774650499f, 0.503683031f},
-std::array<float,2>{0.22582829f, 0.0026378748f},
-std::array<float,2>{0.88655287f, 0.673544526f},
-std::array<float,2>{0.735579014f, 0.419840157f},
-std::array<float,2>{0.326394081f, 0.813737452f},
-std::array<float,2>{0.0511711612f, 0.483361989f},
-std::array<float,2>{0.831745803f, 0.786316991f},
-std::array<float,2>{0.569131136f, 0.115317412f},
-std::array<float,2>{0.492226869f, 0.718676209f},
-std::array<float,2>{0.309271008f, 0.232087478f},
-std::array<float,2>{0.679963112f, 0.605799198f},
-std::array<float,2>{0.953336239f, 0.253925443f},
-std::array<float,2>{0.181548923f, 0.899652421f},
-std::array<float,2>{0.477492958f, 0.43839252f},
-std::array<float,2>{0.587710679f, 0.753753483f},
-std::array<float,2>{0.817852259f, 0.0702919438f},
-std::array<float,2>{0.0320869796f, 0.736028433f},
-std::array<float,2>{0.168952852f, 0.194207013f},
-std::array<float,2>{0.952644944f, 0.580722272f},
-std::array<float,2>{0.662435889f, 0.300104648f},
-std::array<float,2>{0.289945483f, 0.931400061f},
-std::array<float,2>{0.0825832933f, 0.323742718f},
-std::array<float,2>{0.803364754f, 0.954494059f},
-std::array<float,2>{0.535387754f, 0.138420194f},
-std::array<float,2>{0.380335361f, 0.561232865f},
-std::array<float,2>{0.342780054f, 0.0572200119f},
-std::array<float,2>{0.721479952f, 0.642059624f},
-std::array<float,2>{0.897182763f, 0.377765387f},
-std::array<float,2>{0.24053371f, 0.873875976f},
-std::array<float,2>{0.266272545f, 0.278851867f},
-std::array<float,2>{0.639079988f, 0.887759745f},
-std::array<float,2>{0.998471916f, 0.240755692f},
-std::array<float,2>{0.153464139f, 0.615102291f},
-std::array<float,2>{0.0191296618f, 0.0948459208f},
-std::array<float,2>{0.862514913f, 0.691495657f},
-std::array<float,2>{0.613302827f, 0.490165681f},
-std::array<float,2>{0.468657017f, 0.804558873f},
-std::array<float,2>{0.193809211f, 0.424849898f},
-std::array<float,2>{0.930499554f, 0.839562297f},
-std::array<float,2>{0.693462551f, 0.0178882852f},
-std::array<float,2>{0.357463896f, 0.663772225f},
-std::array<float,2>{0.428079873f, 0.174345598f},
-std::array<float,2>{0.530198336f, 0.524878681f},
-std::array<float,2>{0.764225721f, 0.37406069f},
-std::array<float,2>{0.122690819f, 0.992171705f},
-std::array<float,2>{0.286383867f, 0.493058383f},
-std::array<float,2>{0.670798361f, 0.807766199f},
-std::array<float,2>{0.940715849f, 0.103051864f},
-std::array<float,2>{0.159940153f, 0.699716747f},
-std::array<float,2>{0.0443023182f, 0.244100541f},
-std::array<float,2>{0.826760113f, 0.617933393f},
-std::array<float,2>{0.579876423f, 0.271897644f},
-std::array<float,2>{0.472319216f, 0.880184054f},
-std::array<float,2>{0.242189646f, 0.363889456f},
-std::array<float,2>{0.905785203f, 0.993741453f},
-std::array<float,2>{0.733712912f, 0.181302086f},
-std::array<float,2>{0.332318068f, 0.516250253f},
-std::array<float,2>{0.387059122f, 0.025309464f},
-std::array<float,2>{0.5421924f, 0.670776367f},
-std::array<float,2>{0.806738317f, 0.432196438f},
-std::array<float,2>{0.086669825f, 0.832145989f},
-std::array<float,2>{0.45866853f, 0.312289327f},
-std::array<float,2>{0.624297798f, 0.922855437f},
-std::array<float,2>{0.87205404f, 0.202333033f},
-std::array<float,2>{0.0296933223f, 0.587915063f},
-std::array<float,2>{0.147046089f, 0.0727691501f},
-std::array<float,2>{0.990885735f, 0.746557474f},
-std::array<float,2>{0.632737279f, 0.453053981f},
-std::array<float,2>{0.277542412f, 0.761215031f},
-std::array<float,2>{0.113493592f, 0.388685822f},
-std::array<float,2>{0.752729356f, 0.861639142f},
-std::array<float,2>{0.518267095f, 0.050649222f},
-std::array<float,2>{0.432074189f, 0.653701365f},
-std::array<float,2>{0.347683996f, 0.131920651f},
-std::array<float,2>{0.700185597f, 0.554109335f},
-std::array<float,2>{0.922124147f, 0.312905014f},
-std::array<float,2>{0.201098561f, 0.963825822f},
-std::array<float,2>{0.409740031f, 0.413307965f},
-std::array<float,2>{0.505855381f, 0.825618207f},
-std::array<float,2>{0.776527405f, 0.0137267308f},
-std::array<float,2>{0.104072124f, 0.679716408f},
-std::array<float,2>{0.215438783f, 0.168056041f},
-std::array<float,2>{0.909853458f, 0.509659827f},
-std::array<float,2>{0.706737638f, 0.356752515f},
-std::array<float,2>{0.365456522f, 0.971426904f},
-std::array<float,2>{0.0114340102f, 0.262584865f},
-std::array<float,2>{0.844980419f, 0.891404152f},
-std::array<float,2>{0.598980486f, 0.220199272f},
-std::array<float,2>{0.442658901f, 0.593943357f},
-std::array<float,2>{0.253085345f, 0.123941444f},
-std::array<float,2>{0.645540953f, 0.707893133f},
-std::array<float,2>{0.982073605f, 0.474801034f},
-std::array<float,2>{0.134545118f, 0.793855727f},
-std::array<float,2>{0.317435503f, 0.329538882f},
-std::array<float,2>{0.747208774f, 0.93802011f},
-std::array<float,2>{0.880144715f, 0.15414688f},
-std::array<float,2>{0.234234259f, 0.545047224f},
-std::array<float,2>{0.0641645491f, 0.0350396372f},
-std::array<float,2>{0.790464282f, 0.636292994f},
-std::array<float,2>{0.558686197f, 0.4038679f},
-std::array<float,2>{0.404636443f, 0.851551235f},
-std::array<float,2>{0.172334895f, 0.459116638f},
-std::array<float,2>{0.961221695f, 0.774971426f},
-std::array<float,2>{0.675493836f, 0.0820093602f},
-std::array<float,2>{0.304207742f, 0.727067471f},
-std::array<float,2>{0.491303682f, 0.212841511f},
-std::array<float,2>{0.573996246f, 0.566017866f},
-std::array<float,2>{0.841059744f, 0.28864494f},
-std::array<float,2>{0.0615690127f, 0.914548159f},
-std::array<float,2>{0.271831483f, 0.400453389f},
-std::array<float,2>{0.635762036f, 0.845714271f},
-std::array<float,2>{0.995060921f, 0.0370365717f},
-std::array<float,2>{0.150899991f, 0.63864553f},
-std::array<float,2>{0.0220899805f, 0.152131155f},
-std::array<float,2>{0.863314867f, 0.539942384f},
-std::array<float,2>{0.611368418f, 0.335253984f},
-std::array<float,2>{0.463243037f, 0.943546355f},
-std::array<float,2>{0.19011794f, 0.283938646f},
-std::array<float,2>{0.934948623f, 0.918111503f},
-std::array<float,2>{0.687579453f, 0.216981679f},
-std::array<float,2>{0.35321188f, 0.566578627f},
-std::array<float,2>{0.42444858f, 0.0822953284f},
-std::array<float,2>{0.526851654f, 0.731304169f},
-std::array<float,2>{0.757849216f, 0.454125464f},
-std::array<float,2>{0.119848095f, 0.77743119f},
-std::array<float,2>{0.482151479f, 0.35176909f},
-std::array<float,2>{0.58989346f, 0.976406753f},
-std::array<float,2>{0.815650582f, 0.167875364f},
-std::array<float,2>{0.0385464095f, 0.514639258f},
-std::array<float,2>{0.165742368f, 0.0099457521f},
-std::array<float,2>{0.948166907f, 0.684173167f},
-std::array<float,2>{0.659295976f, 0.40885818f},
-std::array<float,2>{0.296773255f, 0.821255922f},
-std::array<float,2>{0.0811701268f, 0.471470565f},
-std::array<float,2>{0.798775852f, 0.792150736f},
-std::array<float,2>{0.532582462f, 0.119624324f},
-std::array<float,2>{0.377502114f, 0.706487358f},
-std::array<float,2>{0.338227749f, 0.222872928f},
-std::array<float,2>{0.723787904f, 0.59895134f},
-std::array<float,2>{0.894380987f, 0.259151071f},
-std::array<float,2>{0.236498475f, 0.895634413f},
-std::array<float,2>{0.390625477f, 0.447453976f},
-std::array<float,2>{0.552562654f, 0.76443398f},
-std::array<float,2>{0.784636915f, 0.077344276f},
-std::array<float,2>{0.07418143f, 0.743836403f},
-std::array<float,2>{0.220594928f, 0.197838649f},
-std::array<float,2>{0.886756003f, 0.59271121f},
-std::array<float,2>{0.740828872f, 0.307296574f},
-std::array<float,2>{0.324005395f, 0.929474115f},
-std::array<float,2>{0.0501931943f, 0.317984819f},
-std::array<float,2>{0.83403486f, 0.967306256f},
-std::array<float,2>{0.565142035f, 0.125140265f},
-std::array<float,2>{0.497607082f, 0.547232687f},
-std::array<float,2>{0.306661665f, 0.051725857f},
-std::array<float,2>{0.684347928f, 0.64904362f},
-std::array<float,2>{0.957722783f, 0.385230511f},
-std::array<float,2>{0.186334446f, 0.864356458f},
-std::array<float,2>{0.371638298f, 0.26641053f},
-std::array<float,2>{0.716910958f, 0.8780604f},
-std::array<float,2>{0.918426931f, 0.249709263f},
-std::array<float,2>{0.210036844f, 0.621281207f},
-std::array<float,2>{0.0980515257f, 0.107104294f},
-std::array<float,2>{0.76775074f, 0.697631061f},
-std::array<float,2>{0.510044098f, 0.497947365f},
-std::array<float,2>{0.414333642f, 0.811129093f},
-std::array<float,2>{0.130558804f, 0.434166044f},
-std::array<float,2>{0.975166798f, 0.831038415f},
-std::array<float,2>{0.655997038f, 0.0277402289f},
-std::array<float,2>{0.25836885f, 0.666900694f},
-std::array<float,2>{0.452251226f, 0.184634537f},
-std::array<float,2>{0.608850121f, 0.522966146f},
-std::array<float,2>{0.85196054f, 0.361668825f},
-std::array<float,2>{0.003811148f, 0.997076809f},
-std::array<float,2>{0.313645273f, 0.484407544f},
-std::array<float,2>{0.743974149f, 0.79725647f},
-std::array<float,2>{0.875692189f, 0.100653954f},
-std::array<float,2>{0.230233729f, 0.690561354f},
-std::array<float,2>{0.0699105337f, 0.236880794f},
-std::array<float,2>{0.796203315f, 0.610747993f},
-std::array<float,2>{0.558552921f, 0.274579316f},
-std::array<float,2>{0.400451839f, 0.883425593f},
-std::array<float,2>{0.177663907f, 0.367269784f},
-std::array<float,2>{0.965672791f, 0.985548496f},
-std::array<float,2>{0.679641306f, 0.178582534f},
-std::array<float,2>{0.2971659f, 0.529610932f},
-std::array<float,2>{0.48726511f, 0.0201843828f},
-std::array<float,2>{0.575850725f, 0.659828842f},
-std::array<float,2>{0.836905956f, 0.429227889f},
-std::array<float,2>{0.0581972487f, 0.841770828f},
-std::array<float,2>{0.413189739f, 0.30210802f},
-std::array<float,2>{0.501466572f, 0.937496543f},
-std::array<float,2>{0.77762711f, 0.189491421f},
-std::array<float,2>{0.108437233f, 0.584548414f},
-std::array<float,2>{0.211070299f, 0.0640734583f},
-std::array<float,2>{0.910838962f, 0.741060317f},
-std::array<float,2>{0.708533287f, 0.444539279f},
-std::array<float,2>{0.360736817f, 0.755802572f},
-std::array<float,2>{0.0152533511f, 0.380742908f},
-std::array<float,2>{0.849977911f, 0.868106961f},
-std::array<float,2>{0.595278502f, 0.0615275353f},
-std::array<float,2>{0.439829856f, 0.645627797f},
-std::array<float,2>{0.255101144f, 0.133761525f},
-std::array<float,2>{0.643622398f, 0.55618757f},
-std::array<float,2>{0.98030144f, 0.327618182f},
-std::array<float,2>{0.139499292f, 0.957219779f},
-std::array<float,2>{0.454595953f, 0.417815268f},
-std::array<float,2>{0.61830157f, 0.817533076f},
-std::array<float,2>{0.871054351f, 0.00715973042f},
-std::array<float,2>{0.0267019589f, 0.678527713f},
-std::array<float,2>{0.143774897f, 0.157267541f},
-std::array<float,2>{0.986394227f, 0.505017281f},
-std::array<float,2>{0.625939906f, 0.349106461f},
-std::array<float,2>{0.275901079f, 0.983371913f},
-std::array<float,2>{0.109836839f, 0.253467053f},
-std::array<float,2>{0.755289733f, 0.904992163f},
-std::array<float,2>{0.520545423f, 0.226763815f},
-std::array<float,2>{0.435976774f, 0.60301435f},
-std::array<float,2>{0.344637692f, 0.11067275f},
-std::array<float,2>{0.695703387f, 0.713979542f},
-std::array<float,2>{0.929125309f, 0.480350345f},
-std::array<float,2>{0.195856288f, 0.784944654f},
-std::array<float,2>{0.283386469f, 0.341686636f},
-std::array<float,2>{0.664597332f, 0.952151597f},
-std::array<float,2>{0.943087995f, 0.147629738f},
-std::array<float,2>{0.161866903f, 0.534050167f},
-std::array<float,2>{0.0396402441f, 0.0430290662f},
-std::array<float,2>{0.821127474f, 0.628593683f},
-std::array<float,2>{0.585457087f, 0.392224431f},
-std::array<float,2>{0.474979818f, 0.852759719f},
-std::array<float,2>{0.247931853f, 0.464032263f},
-std::array<float,2>{0.899336338f, 0.767645895f},
-std::array<float,2>{0.72893399f, 0.0899658874f},
-std::array<float,2>{0.330573916f, 0.718752444f},
-std::array<float,2>{0.386142641f, 0.209897965f},
-std::array<float,2>{0.543080747f, 0.571757138f},
-std::array<float,2>{0.811133444f, 0.289719075f},
-std::array<float,2>{0.092791073f, 0.910721004f},
-std::array<float,2>{0.358696252f, 0.422822535f},
-std::array<float,2>{0.694923997f, 0.837615669f},
-std::array<float,2>{0.930945933f, 0.0164381303f},
-std::array<float,2>{0.194740847f, 0.661308348f},
-std::array<float,2>{0.121897347f, 0.172017351f},
-std::array<float,2>{0.764871597f, 0.52595824f},
-std::array<float,2>{0.530609012f, 0.372054487f},
-std::array<float,2>{0.428874075f, 0.988601446f},
-std::array<float,2>{0.152562365f, 0.280223519f},
-std::array<float,2>{0.999897301f, 0.889320731f},
-std::array<float,2>{0.640567005f, 0.240223825f},
-std::array<float,2>{0.266902536f, 0.61562562f},
-std::array<float,2>{0.467284948f, 0.0960377529f},
-std::array<float,2>{0.615079165f, 0.694279373f},
-std::array<float,2>{0.862296641f, 0.490753114f},
-std::array<float,2>{0.0178843662f, 0.801506102f},
-std::array<float,2>{0.379490256f, 0.321011722f},
-std::array<float,2>{0.536872149f, 0.955474079f},
-std::array<float,2>{0.804351985f, 0.140336186f},
-std::array<float,2>{0.0835525841f, 0.558686078f},
-std::array<float,2>{0.241884246f, 0.0550625995f},
-std::array<float,2>{0.897946f, 0.642806411f},
-std::array<float,2>{0.722377896f, 0.376161933f},
-std::array<float,2>{0.342655331f, 0.87225318f},
-std::array<float,2>{0.0325459093f, 0.439569682f},
-std::array<float,2>{0.817267776f, 0.751136065f},
-std::array<float,2>{0.586518228f, 0.0679251775f},
-std::array<float,2>{0.477971524f, 0.736774981f},
-std::array<float,2>{0.290443301f, 0.191992611f},
-std::array<float,2>{0.663386405f, 0.57929194f},
-std::array<float,2>{0.951839685f, 0.297004253f},
-std::array<float,2>{0.168644801f, 0.933540344f},
-std::array<float,2>{0.493473291f, 0.480972767f},
-std::array<float,2>{0.569925785f, 0.788913012f},
-std::array<float,2>{0.830304861f, 0.114600621f},
-std::array<float,2>{0.0526138432f, 0.715009034f},
-std::array<float,2>{0.180026963f, 0.232469648f},
-std::array<float,2>{0.954531014f, 0.60891521f},
-std::array<float,2>{0.681456089f, 0.257774651f},
-std::array<float,2>{0.310529619f, 0.901132524f},
-std::array<float,2>{0.0769409016f, 0.344729424f},
-std::array<float,2>{0.788340092f, 0.978120685f},
-std::array<float,2>{0.549045801f, 0.162464306f},
-std::array<float,2>{0.395753115f, 0.500026882f},
-std::array<float,2>{0.327535361f, 0.00112484733f},
-std::array<float,2>{0.734728575f, 0.674376607f},
-std::array<float,2>{0.885300279f, 0.421860814f},
-std::array<float,2>{0.224970281f, 0.815422893f},
-std::array<float,2>{0.264125884f, 0.296691924f},
-std::array<float,2>{0.649721682f, 0.907826245f},
-std::array<float,2>{0.970171273f, 0.204321504f},
-std::array<float,2>{0.127213076f, 0.577030241f},
-std::array<float,2>{0.00541871507f, 0.0891599655f},
-std::array<float,2>{0.85700649f, 0.723826706f},
-std::array<float,2>{0.604813993f, 0.468370587f},
-std::array<float,2>{0.445475221f, 0.770926297f},
-std::array<float,2>{0.206188858f, 0.398393512f},
-std::array<float,2>{0.916072309f, 0.856255531f},
-std::array<float,2>{0.71429497f, 0.0409835391f},
-std::array<float,2>{0.36943081f, 0.630846441f},
-std::array<float,2>{0.418446988f, 0.140975118f},
-std::array<float,2>{0.5137797f, 0.537144661f},
-std::array<float,2>{0.769780457f, 0.3377994f},
-std::array<float,2>{0.0950971544f, 0.94751972f},
-std::array<float,2>{0.302940845f, 0.458152175f},
-std::array<float,2>{0.674061298f, 0.776832938f},
-std::array<float,2>{0.962091923f, 0.0792605132f},
-std::array<float,2>{0.173349515f, 0.729652584f},
-std::array<float,2>{0.060856536f, 0.213780433f},
-std::array<float,2>{0.840379477f, 0.564162314f},
-std::array<float,2>{0.572406471f, 0.285746247f},
-std::array<float,2>{0.491073221f, 0.916716814f},
-std::array<float,2>{0.23336792f, 0.331034392f},
-std::array<float,2>{0.879214287f, 0.941283762f},
-std::array<float,2>{0.746664107f, 0.155972555f},
-std::array<float,2>{0.316626757f, 0.543663323f},
-std::array<float,2>{0.405759394f, 0.0318981521f},
-std::array<float,2>{0.560033739f, 0.634193182f},
-std::array<float,2>{0.789427936f, 0.406177938f},
-std::array<float,2>{0.0631109551f, 0.847921669f},
-std::array<float,2>{0.44142586f, 0.263979226f},
-std::array<float,2>{0.598003983f, 0.892831326f},
-std::array<float,2>{0.844339967f, 0.220826671f},
-std::array<float,2>{0.00989433378f, 0.595854044f},
-std::array<float,2>{0.133092389f, 0.121112823f},
-std::array<float,2>{0.981053174f, 0.709689856f},
-std::array<float,2>{0.645267665f, 0.474448025f},
-std::array<float,2>{0.252177656f, 0.795176923f},
-std::array<float,2>{0.104565039f, 0.411500424f},
-std::array<float,2>{0.775440633f, 0.828043401f},
-std::array<float,2>{0.504740894f, 0.0131698968f},
-std::array<float,2>{0.408694744f, 0.682599545f},
-std::array<float,2>{0.366229773f, 0.170345843f},
-std::array<float,2>{0.705384076f, 0.510805786f},
-std::array<float,2>{0.908482134f, 0.357825518f},
-std::array<float,2>{0.216101348f, 0.969414473f},
-std::array<float,2>{0.433372349f, 0.386863798f},
-std::array<float,2>{0.518689811f, 0.859664083f},
-std::array<float,2>{0.753553331f, 0.0481009483f},
-std::array<float,2>{0.114816613f, 0.656147897f},
-std::array<float,2>{0.199534789f, 0.130435646f},
-std::array<float,2>{0.923463047f, 0.551105976f},
-std::array<float,2>{0.700332403f, 0.315232337f},
-std::array<float,2>{0.349049538f, 0.962376893f},
-std::array<float,2>{0.0307849981f, 0.30905962f},
-std::array<float,2>{0.872204363f, 0.925642073f},
-std::array<float,2>{0.623046935f, 0.199454144f},
-std::array<float,2>{0.457662821f, 0.58647877f},
-std::array<float,2>{0.279222101f, 0.0711329803f},
-std::array<float,2>{0.631070375f, 0.748236477f},
-std::array<float,2>{0.991608262f, 0.450007945f},
-std::array<float,2>{0.147978291f, 0.759328961f},
-std::array<float,2>{0.333183706f, 0.366766125f},
-std::array<float,2>{0.733052611f, 0.995612323f},
-std::array<float,2>{0.904612541f, 0.183524385f},
-std::array<float,2>{0.244139701f, 0.51769048f},
-std::array<float,2>{0.0878797397f, 0.0257367957f},
-std::array<float,2>{0.80775243f, 0.669048607f},
-std::array<float,2>{0.541336775f, 0.430510491f},
-std::array<float,2>{0.388085127f, 0.835106552f},
-std::array<float,2>{0.158802629f, 0.495158553f},
-std::array<float,2>{0.9399665f, 0.806013286f},
-std::array<float,2>{0.671399355f, 0.104458429f},
-std::array<float,2>{0.285353422f, 0.702365935f},
-std::array<float,2>{0.47166416f, 0.245062724f},
-std::array<float,2>{0.578228951f, 0.620355427f},
-std::array<float,2>{0.827927351f, 0.269785672f},
-std::array<float,2>{0.0436058976f, 0.88148272f},
-std::array<float,2>{0.294748038f, 0.406788021f},
-std::array<float,2>{0.657326519f, 0.822610319f},
-std::array<float,2>{0.945423603f, 0.00913704187f},
-std::array<float,2>{0.167747557f, 0.687215209f},
-std::array<float,2>{0.0352762491f, 0.165429711f},
-std::array<float,2>{0.813789427f, 0.512978375f},
-std::array<float,2>{0.592002451f, 0.35437271f},
-std::array<float,2>{0.484199166f, 0.974337816f},
-std::array<float,2>{0.236019909f, 0.261570871f},
-std::array<float,2>{0.891260147f, 0.897149861f},
-std::array<float,2>{0.724637747f, 0.224992469f},
-std::array<float,2>{0.337423891f, 0.601530612f},
-std::array<float,2>{0.375791967f, 0.118324697f},
-std::array<float,2>{0.534650743f, 0.70415926f},
-std::array<float,2>{0.799067676f, 0.470251948f},
-std::array<float,2>{0.079639174f, 0.789366364f},
-std::array<float,2>{0.462508887f, 0.333699256f},
-std::array<float,2>{0.610440075f, 0.942214727f},
-std::array<float,2>{0.866132677f, 0.149392083f},
-std::array<float,2>{0.0197410248f, 0.542257309f},
-std::array<float,2>{0.148555532f, 0.0386806391f},
-std::array<float,2>{0.993986249f, 0.63988167f},
-std::array<float,2>{0.632823467f, 0.400160402f},
-std::array<float,2>{0.27090022f, 0.844806314f},
-std::array<float,2>{0.118653044f, 0.456306487f},
-std::array<float,2>{0.759827733f, 0.780689418f},
-std::array<float,2>{0.524495006f, 0.0856133923f},
-std::array<float,2>{0.42271927f, 0.732660294f},
-std::array<float,2>{0.354895353f, 0.214941412f},
-std::array<float,2>{0.689684033f, 0.570020914f},
-std::array<float,2>{0.936829388f, 0.282941401f},
-std::array<float,2>{0.188394412f, 0.919959843f},
-std::array<float,2>{0.416844785f, 0.499911666f},
-std::array<float,2>{0.508079708f, 0.809369981f},
-std::array<float,2>{0.767069399f, 0.109351434f},
-std::array<float,2>{0.10097374f, 0.695683777f},
-std::array<float,2>{0.207308128f, 0.246233165f},
-std::array<float,2>{0.921309292f, 0.623815358f},
-std::array<float,2>{0.714922488f, 0.268599689f},
-std::array<float,2>{0.37371099f, 0.875304222f},
-std::array<float,2>{0.00183128729f, 0.359627008f},
-std::array<float,2>{0.855141044f, 0.999968231f},
-std::array<float,2>{0.607320487f, 0.185671717f},
-std::array<float,2>{0.449755281f, 0.519604027f},
-std::array<float,2>{0.260822326f, 0.0308267865f},
-std::array<float,2>{0.654082f, 0.665235996f},
-std::array<float,2>{0.972917795f, 0.436724156f},
-std::array<float,2>{0.132319227f, 0.828860044f},
-std::array<float,2>{0.320695013f, 0.304761559f},
-std::array<float,2>{0.739258707f, 0.926447093f},
-std::array<float,2>{0.889962435f, 0.196378201f},
-std::array<float,2>{0.221316889f, 0.591508031f},
-std::array<float,2>{0.0720568448f, 0.0756668001f},
-std::array<float,2>{0.782022536f, 0.744305909f},
-std::array<float,2>{0.553218246f, 0.446846396f},
-std::array<float,2>{0.393585771f, 0.762232184f},
-std::array<float,2>{0.184234872f, 0.383746177f},
-std::array<float,2>{0.959957659f, 0.865394473f},
-std::array<float,2>{0.68681699f, 0.0529350825f},
-std::array<float,2>{0.306322902f, 0.650718451f},
-std::array<float,2>{0.499985933f, 0.127347574f},
-std::array<float,2>{0.562817574f, 0.550378561f},
-std::array<float,2>{0.832136869f, 0.318552345f},
-std::array<float,2>{0.0487951078f, 0.966028631f},
-std::array<float,2>{0.361482292f, 0.441488653f},
-std::array<float,2>{0.710247695f, 0.757402003f},
-std::array<float,2>{0.913886487f, 0.0645538867f},
-std::array<float,2>{0.213824809f, 0.738545895f},
-std::array<float,2>{0.10719882f, 0.188328013f},
-std::array<float,2>{0.780604184f, 0.582207859f},
-std::array<float,2>{0.503165126f, 0.303439558f},
-std::array<float,2>{0.411055684f, 0.934578419f},
-std::array<float,2>{0.136849925f, 0.324864507f},
-std::array<float,2>{0.977113366f, 0.959152818f},
-std::array<float,2>{0.64180702f, 0.136465654f},
-std::array<float,2>{0.256803602f, 0.557678819f},
-std::array<float,2>{0.438052505f, 0.0593534224f},
-std::array<float,2>{0.596600413f, 0.648084998f},
-std::array<float,2>{0.849387109f, 0.382570356f},
-std::array<float,2>{0.0127964662f, 0.870584309f},
-std::array<float,2>{0.40021497f, 0.276962012f},
-std::array<float,2>{0.555813909f, 0.885037839f},
-std::array<float,2>{0.794677973f, 0.236005157f},
-std::array<float,2>{0.067661643f, 0.612338245f},
-std::array<float,2>{0.226780638f, 0.0982453302f},
-std::array<float,2>{0.877038419f, 0.688484013f},
-std::array<float,2>{0.745434165f, 0.486853242f},
-std::array<float,2>{0.314801455f, 0.800219417f},
-std::array<float,2>{0.0550306328f, 0.426909298f},
-std::array<float,2>{0.838602126f, 0.842900097f},
-std::array<float,2>{0.577053905f, 0.0227689855f},
-std::array<float,2>{0.485013753f, 0.65723753f},
-std::array<float,2>{0.300441504f, 0.176692411f},
-std::array<float,2>{0.677226901f, 0.529080093f},
-std::array<float,2>{0.967744172f, 0.370226115f},
-std::array<float,2>{0.178806201f, 0.987334907f},
-std::array<float,2>{0.474527985f, 0.394526273f},
-std::array<float,2>{0.583665609f, 0.854705155f},
-std::array<float,2>{0.824148774f, 0.0461557843f},
-std::array<float,2>{0.04212806f, 0.626667142f},
-std::array<float,2>{0.16396454f, 0.145141751f},
-std::array<float,2>{0.944553971f, 0.531510651f},
-std::array<float,2>{0.667922616f, 0.342742771f},
-std::array<float,2>{0.282769352f, 0.949861586f},
-std::array<float,2>{0.0917728916f, 0.291487366f},
-std::array<float,2>{0.809898853f, 0.912303567f},
-std::array<float,2>{0.545044482f, 0.208749726f},
-std::array<float,2>{0.384432316f, 0.573624551f},
-std::array<float,2>{0.329846948f, 0.0926244482f},
-std::array<float,2>{0.72705847f, 0.722578347f},
-std::array<float,2>{0.901111722f, 0.462235034f},
-std::array<float,2>{0.249845937f, 0.767470479f},
-std::array<float,2>{0.273524195f, 0.349744946f},
-std::array<float,2>{0.628016174f, 0.981867909f},
-std::array<float,2>{0.986132383f, 0.159611583f},
-std::array<float,2>{0.141322434f, 0.507695913f},
-std::array<float,2>{0.0245822817f, 0.00499820942f},
-std::array<float,2>{0.868116856f, 0.675873816f},
-std::array<float,2>{0.619826376f, 0.414250106f},
-std::array<float,2>{0.456949502f, 0.819490135f},
-std::array<float,2>{0.199044928f, 0.478505492f},
-std::array<float,2>{0.926618576f, 0.782344997f},
-std::array<float,2>{0.699169695f, 0.111930221f},
-std::array<float,2>{0.346840829f, 0.712044001f},
-std::array<float,2>{0.43511045f, 0.229130894f},
-std::array<float,2>{0.521653414f, 0.604874074f},
-std::array<float,2>{0.755895972f, 0.251793206f},
-std::array<float,2>{0.112934262f, 0.902523339f},
-std::array<float,2>{0.341364115f, 0.378405035f},
-std::array<float,2>{0.720546901f, 0.874495566f},
-std::array<float,2>{0.89472872f, 0.0577088557f},
-std::array<float,2>{0.238506243f, 0.641442418f},
-std::array<float,2>{0.0843380541f, 0.136892319f},
-std::array<float,2>{0.802243888f, 0.562328517f},
-std::array<float,2>{0.538934648f, 0.322385788f},
-std::array<float,2>{0.382624179f, 0.953958333f},
-std::array<float,2>{0.171311826f, 0.298884809f},
-std::array<float,2>{0.950192869f, 0.930155158f},
-std::array<float,2>{0.661931515f, 0.194872707f},
-std::array<float,2>{0.29265812f, 0.581438184f},
-std::array<float,2>{0.480228156f, 0.0684370697f},
-std::array<float,2>{0.589019239f, 0.735272586f},
-std::array<float,2>{0.819173396f, 0.438824266f},
-std::array<float,2>{0.0345728025f, 0.752365887f},
-std::array<float,2>{0.426883936f, 0.373873502f},
-std::array<float,2>{0.527966738f, 0.990868747f},
-std::array<float,2>{0.763536632f, 0.175624192f},
-std::array<float,2>{0.123340607f, 0.524184108f},
-std::array<float,2>{0.191537336f, 0.0188042577f},
-std::array<float,2>{0.933163762f, 0.66290617f},
-std::array<float,2>{0.6917786f, 0.42416963f},
-std::array<float,2>{0.357351869f, 0.838191628f},
-std::array<float,2>{0.0168335699f, 0.488570571f},
-std::array<float,2>{0.860751152f, 0.803093731f},
-std::array<float,2>{0.616339624f, 0.0941990018f},
-std::array<float,2>{0.465327382f, 0.693145752f},
-std::array<float,2>{0.267826885f, 0.241290882f},
-std::array<float,2>{0.637772024f, 0.613528073f},
-std::array<float,2>{0.997979581f, 0.277638704f},
-std::array<float,2>{0.155025765f, 0.887098074f},
-std::array<float,2>{0.449155837f, 0.465394586f},
-std::array<float,2>{0.602668464f, 0.7727862f},
-std::array<float,2>{0.859116554f, 0.0863715783f},
-std::array<float,2>{0.00623211591f, 0.72585696f},
-std::array<float,2>{0.126682296f, 0.206420928f},
-std::array<float,2>{0.971526086f, 0.574337363f},
-std::array<float,2>{0.650789142f, 0.293002695f},
-std::array<float,2>{0.263316244f, 0.909264922f},
-std::array<float,2>{0.0973450169f, 0.338302672f},
-std::array<float,2>{0.773044169f, 0.947234035f},
-std::array<float,2>{0.513254344f, 0.143232599f},
-std::array<float,2>{0.421541274f, 0.536576569f},
-std::array<float,2>{0.368497103f, 0.0412397869f},
-std::array<float,2>{0.711058199f, 0.631997049f},
-std::array<float,2>{0.915018916f, 0.396012276f},
-std::array<float,2>{0.203288659f, 0.857447684f},
-std::array<float,2>{0.310561359f, 0.254912764f},
-std::array<float,2>{0.682269216f, 0.898727357f},
-std::array<float,2>{0.95648694f, 0.231421679f},
-std::array<float,2>{0.182863906f, 0.606925607f},
-std::array<float,2>{0.0545039438f, 0.117183596f},
-std::array<float,2>{0.829915822f, 0.717655063f},
-std::array<float,2>{0.566702068f, 0.484235078f},
-std::array<float,2>{0.495486498f, 0.785966218f},
-std::array<float,2>{0.223087296f, 0.418171167f},
-std::array<float,2>{0.884377897f, 0.813108981f},
-std::array<float,2>{0.736600459f, 0.00311807962f},
-std::array<float,2>{0.325278193f, 0.671945095f},
-std::array<float,2>{0.397206813f, 0.160156593f},
-std::array<float,2>{0.547299862f, 0.502756119f},
-std::array<float,2>{0.786571205f, 0.345939815f},
-std::array<float,2>{0.0747382119f, 0.978864074f},
-std::array<float,2>{0.251517385f, 0.475586087f},
-std::array<float,2>{0.646737099f, 0.794627964f},
-std::array<float,2>{0.983810782f, 0.12443123f},
-std::array<float,2>{0.135588139f, 0.708221674f},
-std::array<float,2>{0.00895033032f, 0.219551608f},
-std::array<float,2>{0.846026242f, 0.595402598f},
-std::array<float,2>{0.600942552f, 0.263662279f},
-std::array<float,2>{0.444768995f, 0.891861379f},
-std::array<float,2>{0.217617258f, 0.355680108f},
-std::array<float,2>{0.907122791f, 0.97262001f},
-std::array<float,2>{0.703646302f, 0.168962687f},
-std::array<float,2>{0.364863485f, 0.507912874f},
-std::array<float,2>{0.406420887f, 0.0150896544f},
-std::array<float,2>{0.507406235f, 0.68098098f},
-std::array<float,2>{0.775195599f, 0.412761629f},
-std::array<float,2>{0.103316657f, 0.825079381f},
-std::array<float,2>{0.488826662f, 0.287707329f},
-std::array<float,2>{0.57033962f, 0.91556567f},
-std::array<float,2>{0.842932761f, 0.211242542f},
-std::array<float,2>{0.0597128421f, 0.564510226f},
-std::array<float,2>{0.175058082f, 0.0802866295f},
-std::array<float,2>{0.964293659f, 0.727792621f},
-std::array<float,2>{0.673668802f, 0.460061044f},
-std::array<float,2>{0.301944137f, 0.773884058f},
-std::array<float,2>{0.0652190968f, 0.402670026f},
-std::array<float,2>{0.792185962f, 0.850243807f},
-std::array<float,2>{0.561772645f, 0.033600945f},
-std::array<float,2>{0.40420559f, 0.635067403f},
-std::array<float,2>{0.319379985f, 0.153019726f},
-std::array<float,2>{0.749207139f, 0.545917571f},
-std::array<float,2>{0.882517278f, 0.328135043f},
-std::array<float,2>{0.232273638f, 0.939091265f},
-std::array<float,2>{0.388742566f, 0.433075964f},
-std::array<float,2>{0.539109051f, 0.833659947f},
-std::array<float,2>{0.805324495f, 0.0239376407f},
-std::array<float,2>{0.0887281522f, 0.67134428f},
-std::array<float,2>{0.246033639f, 0.180645674f},
-std::array<float,2>{0.902711451f, 0.517284989f},
-std::array<float,2>{0.730997562f, 0.364520848f},
-std::array<float,2>{0.335311502f, 0.993140936f},
-std::array<float,2>{0.046832066f, 0.273385108f},
-std::array<float,2>{0.82565254f, 0.878994107f},
-std::array<float,2>{0.580702186f, 0.242528945f},
-std::array<float,2>{0.469841421f, 0.618812144f},
-std::array<float,2>{0.287162572f, 0.101812541f},
-std::array<float,2>{0.668484271f, 0.700764537f},
-std::array<float,2>{0.938110054f, 0.494085193f},
-std::array<float,2>{0.156404272f, 0.806703925f},
-std::array<float,2>{0.351474196f, 0.313818097f},
-std::array<float,2>{0.701299191f, 0.963885903f},
-std::array<float,2>{0.924851894f, 0.13136901f},
-std::array<float,2>{0.202911377f, 0.553017378f},
-std::array<float,2>{0.116791874f, 0.0491037369f},
-std::array<float,2>{0.750557482f, 0.652891994f},
-std::array<float,2>{0.516879499f, 0.390212059f},
-std::array<float,2>{0.431235313f, 0.862498641f},
-std::array<float,2>{0.145148158f, 0.452121347f},
-std::array<float,2>{0.989535034f, 0.759971142f},
-std::array<float,2>{0.628974557f, 0.0739112869f},
-std::array<float,2>{0.280914545f, 0.747985601f},
-std::array<float,2>{0.459350616f, 0.201671779f},
-std::array<float,2>{0.622006178f, 0.589545071f},
-std::array<float,2>{0.874702692f, 0.310895741f},
-std::array<float,2>{0.0287058838f, 0.922631383f},
-std::array<float,2>{0.282280743f, 0.391651571f},
-std::array<float,2>{0.667366803f, 0.853259325f},
-std::array<float,2>{0.945310235f, 0.0437450707f},
-std::array<float,2>{0.163205996f, 0.628409863f},
-std::array<float,2>{0.0427768603f, 0.147999331f},
-std::array<float,2>{0.823443413f, 0.533513784f},
-std::array<float,2>{0.583220184f, 0.341031075f},
-std::array<float,2>{0.473711103f, 0.952964544f},
-std::array<float,2>{0.249296293f, 0.28933081f},
-std::array<float,2>{0.900760829f, 0.910446644f},
-std::array<float,2>{0.726904094f, 0.209452659f},
-std::array<float,2>{0.329497635f, 0.572151124f},
-std::array<float,2>{0.383926213f, 0.0904598534f},
-std::array<float,2>{0.545443952f, 0.719307363f},
-std::array<float,2>{0.810271382f, 0.464641988f},
-std::array<float,2>{0.0911912471f, 0.768293858f},
-std::array<float,2>{0.45610708f, 0.349581599f},
-std::array<float,2>{0.619284451f, 0.982648969f},
-std::array<float,2>{0.867259979f, 0.157848626f},
-std::array<float,2>{0.0251428597f, 0.505594552f},
-std::array<float,2>{0.141057327f, 0.0075457748f},
-std::array<float,2>{0.985404551f, 0.677876949f},
-std::array<float,2>{0.628758132f, 0.417295486f},
-std::array<float,2>{0.274179041f, 0.818125904f},
-std::array<float,2>{0.112691358f, 0.47973454f},
-std::array<float,2>{0.756478667f, 0.784487188f},
-std::array<float,2>{0.522440672f, 0.110922433f},
-std::array<float,2>{0.434678674f, 0.714497268f},
-std::array<float,2>{0.347504437f, 0.227310821f},
-std::array<float,2>{0.698582172f, 0.603228867f},
-std::array<float,2>{0.92590642f, 0.253390491f},
-std::array<float,2>{0.198424861f, 0.90469259f},
-std::array<float,2>{0.41048938f, 0.445200264f},
-std::array<float,2>{0.503722429f, 0.755175948f},
-std::array<float,2>{0.781210542f, 0.0638682842f},
-std::array<float,2>{0.106786221f, 0.740529358f},
-std::array<float,2>{0.213316113f, 0.190342426f},
-std::array<float,2>{0.913255155f, 0.584037602f},
-std::array<float,2>{0.710712075f, 0.302556992f},
-std::array<float,2>{0.362296879f, 0.936977208f},
-std::array<float,2>{0.013662532f, 0.327866495f},
-std::array<float,2>{0.848966777f, 0.957566798f},
-std::array<float,2>{0.595804989f, 0.13328898f},
-std::array<float,2>{0.437649101f, 0.555918932f},
-std::array<float,2>{0.256078601f, 0.0621328354f},
-std::array<float,2>{0.642158091f, 0.646213651f},
-std::array<float,2>{0.976625741f, 0.379978687f},
-std::array<float,2>{0.137326911f, 0.867623627f},
-std::array<float,2>{0.315151542f, 0.275237232f},
-std::array<float,2>{0.746074021f, 0.882962048f},
-std::array<float,2>{0.877453446f, 0.23663272f},
-std::array<float,2>{0.227387071f, 0.611190498f},
-std::array<float,2>{0.0683582351f, 0.101468869f},
-std::array<float,2>{0.794266045f, 0.691327095f},
-std::array<float,2>{0.556498468f, 0.485206068f},
-std::array<float,2>{0.399888843f, 0.797400832f},
-std::array<float,2>{0.179278135f, 0.428916544f},
-std::array<float,2>{0.967167377f, 0.841051757f},
-std::array<float,2>{0.677379906f, 0.0197522417f},
-std::array<float,2>{0.299833655f, 0.659620464f},
-std::array<float,2>{0.484388262f, 0.177756354f},
-std::array<float,2>{0.57634002f, 0.529821396f},
-std::array<float,2>{0.83822453f, 0.367830783f},
-std::array<float,2>{0.0554763451f, 0.98614794f},
-std::array<float,2>{0.373054087f, 0.49741438f},
-std::array<float,2>{0.715332627f, 0.810934722f},
-std::array<float,2>{0.921442091f, 0.106872f},
-std::array<float,2>{0.207712591f, 0.698170543f},
-std::array<float,2>{0.101402208f, 0.24925296f},
-std::array<float,2>{0.767477691f, 0.621929169f},
-std::array<float,2>{0.508540869f, 0.266078532f},
-std::array<float,2>{0.416334569f, 0.878601491f},
-std::array<float,2>{0.132527903f, 0.362283826f},
-std::array<float,2>{0.973373532f, 0.997782111f},
-std::array<float,2>{0.653793991f, 0.185460865f},
-std::array<float,2>{0.261533052f, 0.522552371f},
-std::array<float,2>{0.449565947f, 0.0282583516f},
-std::array<float,2>{0.606585443f, 0.666440785f},
-std::array<float,2>{0.854927838f, 0.433910668f},
-std::array<float,2>{0.00119935791f, 0.830174327f},
-std::array<float,2>{0.394512445f, 0.307069272f},
-std::array<float,2>{0.553665638f, 0.928945124f},
-std::array<float,2>{0.781673312f, 0.197346956f},
-std::array<float,2>{0.0714594647f, 0.592226982f},
-std::array<float,2>{0.220825389f, 0.078120172f},
-std::array<float,2>{0.890565515f, 0.743619144f},
-std::array<float,2>{0.739792585f, 0.447799683f},
-std::array<float,2>{0.321246386f, 0.763941884f},
-std::array<float,2>{0.0479500555f, 0.385510504f},
-std::array<float,2>{0.832750201f, 0.864840806f},
-std::array<float,2>{0.563157201f, 0.0510723367f},
-std::array<float,2>{0.499054044f, 0.648756504f},
-std::array<float,2>{0.305812091f, 0.125732169f},
-std::array<float,2>{0.687181771f, 0.547471583f},
-std::array<float,2>{0.959136426f, 0.31755051f},
-std::array<float,2>{0.183948115f, 0.967085063f},
-std::array<float,2>{0.483874828f, 0.408447772f},
-std::array<float,2>{0.592428088f, 0.820414126f},
-std::array<float,2>{0.814027846f, 0.010488064f},
-std::array<float,2>{0.0356470197f, 0.683947742f},
-std::array<float,2>{0.167429671f, 0.167331383f},
-std::array<float,2>{0.94609791f, 0.513879359f},
-std::array<float,2>{0.658025742f, 0.352108985f},
-std::array<float,2>{0.294163376f, 0.975819886f},
-std::array<float,2>{0.0795351341f, 0.259356886f},
-std::array<float,2>{0.799400389f, 0.896089375f},
-std::array<float,2>{0.534949601f, 0.223613665f},
-std::array<float,2>{0.375053138f, 0.599577248f},
-std::array<float,2>{0.337009192f, 0.119788408f},
-std::array<float,2>{0.725484133f, 0.706976593f},
-std::array<float,2>{0.891058028f, 0.471066058f},
-std::array<float,2>{0.235709116f, 0.792924643f},
-std::array<float,2>{0.271229923f, 0.335629702f},
-std::array<float,2>{0.633535266f, 0.944005013f},
-std::array<float,2>{0.993607104f, 0.151465684f},
-std::array<float,2>{0.149209633f, 0.539492548f},
-std::array<float,2>{0.0201829579f, 0.0362953208f},
-std::array<float,2>{0.865698278f, 0.637861848f},
-std::array<float,2>{0.611195028f, 0.401255995f},
-std::array<float,2>{0.462218285f, 0.846260011f},
-std::array<float,2>{0.187617213f, 0.454730511f},
-std::array<float,2>{0.937392235f, 0.778132677f},
-std::array<float,2>{0.690130115f, 0.0826745704f},
-std::array<float,2>{0.355226249f, 0.730653703f},
-std::array<float,2>{0.422147751f, 0.217635512f},
-std::array<float,2>{0.525108218f, 0.567030132f},
-std::array<float,2>{0.760330915f, 0.283473074f},
-std::array<float,2>{0.118540131f, 0.918489754f},
-std::array<float,2>{0.335531563f, 0.430021435f},
-std::array<float,2>{0.730923474f, 0.835854113f},
-std::array<float,2>{0.902940691f, 0.0263413005f},
-std::array<float,2>{0.24521628f, 0.669518232f},
-std::array<float,2>{0.0880386159f, 0.182840496f},
-std::array<float,2>{0.804793f, 0.518483758f},
-std::array<float,2>{0.539828956f, 0.366617203f},
-std::array<float,2>{0.389273435f, 0.995230496f},
-std::array<float,2>{0.156966865f, 0.270080239f},
-std::array<float,2>{0.937811255f, 0.881271183f},
-std::array<float,2>{0.667978048f, 0.244199291f},
-std::array<float,2>{0.28790772f, 0.620905817f},
-std::array<float,2>{0.470587611f, 0.103988297f},
-std::array<float,2>{0.580467999f, 0.70280987f},
-std::array<float,2>{0.82605803f, 0.495633185f},
-std::array<float,2>{0.0461776257f, 0.806283712f},
-std::array<float,2>{0.430689603f, 0.314515352f},
-std::array<float,2>{0.51740694f, 0.962824345f},
-std::array<float,2>{0.750164032f, 0.130016714f},
-std::array<float,2>{0.116272554f, 0.551733315f},
-std::array<float,2>{0.20234254f, 0.0487702414f},
-std::array<float,2>{0.925485075f, 0.655525625f},
-std::array<float,2>{0.701894224f, 0.387300164f},
-std::array<float,2>{0.351019949f, 0.860000193f},
-std::array<float,2>{0.0291267801f, 0.449396938f},
-std::array<float,2>{0.874320388f, 0.759052277f},
-std::array<float,2>{0.621221006f, 0.0706658289f},
-std::array<float,2>{0.459777951f, 0.748797715f},
-std::array<float,2>{0.280278295f, 0.199849382f},
-std::array<float,2>{0.62976557f, 0.585972965f},
-std::array<float,2>{0.990153968f, 0.309320927f},
-std::array<float,2>{0.144931957f, 0.925000489f},
-std::array<float,2>{0.44492054f, 0.4740417f},
-std::array<float,2>{0.601317942f, 0.795580328f},
-std::array<float,2>{0.846284986f, 0.121905163f},
-std::array<float,2>{0.00950166211f, 0.709165514f},
-std::array<float,2>{0.135072485f, 0.221340179f},
-std::array<float,2>{0.984277189f, 0.596220732f},
-std::array<float,2>{0.646985888f, 0.264228761f},
-std::array<float,2>{0.251066685f, 0.893208861f},
-std::array<float,2>{0.102716252f, 0.358282775f},
-std::array<float,2>{0.774887204f, 0.969173491f},
-std::array<float,2>{0.507017195f, 0.17057164f},
-std::array<float,2>{0.407177418f, 0.511684477f},
-std::array<float,2>{0.364429384f, 0.0131891444f},
-std::array<float,2>{0.703347981f, 0.682090938f},
-std::array<float,2>{0.906504154f, 0.411880255f},
-std::array<float,2>{0.217016757f, 0.827537119f},
-std::array<float,2>{0.302247971f, 0.285173208f},
-std::array<float,2>{0.672898471f, 0.916294158f},
-std::array<float,2>{0.964607775f, 0.213322073f},
-std::array<float,2>{0.175758451f, 0.563862801f},
-std::array<float,2>{0.0601621903f, 0.0799308717f},
-std::array<float,2>{0.843561649f, 0.730094552f},
-std::array<float,2>{0.571089268f, 0.458762914f},
-std::array<float,2>{0.488371581f, 0.777239919f},
-std::array<float,2>{0.231525674f, 0.405356139f},
-std::array<float,2>{0.882064641f, 0.848482549f},
-std::array<float,2>{0.749555945f, 0.0312533602f},
-std::array<float,2>{0.320287317f, 0.634534717f},
-std::array<float,2>{0.403500974f, 0.155391335f},
-std::array<float,2>{0.562060654f, 0.54311955f},
-std::array<float,2>{0.792698443f, 0.330491364f},
-std::array<float,2>{0.064939402f, 0.940787315f},
-std::array<float,2>{0.263085991f, 0.468174964f},
-std::array<float,2>{0.651124477f, 0.771176875f},
-std::array<float,2>{0.971170247f, 0.0893559381f},
-std::array<float,2>{0.126339331f, 0.724234998f},
-std::array<float,2>{0.00668301061f, 0.204995871f},
-std::array<float,2>{0.858478308f, 0.576318681f},
-std::array<float,2>{0.603234828f, 0.296212792f},
-std::array<float,2>{0.44845289f, 0.907288969f},
-std::array<float,2>{0.20384863f, 0.336940229f},
-std::array<float,2>{0.914233625f, 0.947936356f},
-std::array<float,2>{0.711692393f, 0.141413778f},
-std::array<float,2>{0.368880451f, 0.537979424f},
-std::array<float,2>{0.421355903f, 0.0403929316f},
-std::array<float,2>{0.513016522f, 0.630202949f},
-std::array<float,2>{0.772797287f, 0.397884458f},
-std::array<float,2>{0.0968434885f, 0.855525792f},
-std::array<float,2>{0.495608568f, 0.257205814f},
-std::array<float,2>{0.566951334f, 0.900714636f},
-std::array<float,2>{0.829324603f, 0.233119354f},
-std::array<float,2>{0.0540953353f, 0.608794391f},
-std::array<float,2>{0.183583573f, 0.114956863f},
-std::array<float,2>{0.957022429f, 0.715789855f},
-std::array<float,2>{0.68170923f, 0.480493397f},
-std::array<float,2>{0.311105341f, 0.788206041f},
-std::array<float,2>{0.0744653195f, 0.421176583f},
-std::array<float,2>{0.786627948f, 0.814489841f},
-std::array<float,2>{0.547559142f, 0.00172931026f},
-std::array<float,2>{0.396790177f, 0.673945129f},
-std::array<float,2>{0.326134473f, 0.162674487f},
-std::array<float,2>{0.736916125f, 0.500612497f},
-std::array<float,2>{0.884244859f, 0.34528327f},
-std::array<float,2>{0.223578975f, 0.977668285f},
-std::array<float,2>{0.382242024f, 0.37647149f},
-std::array<float,2>{0.538182437f, 0.872835815f},
-std::array<float,2>{0.802357852f, 0.0554739796f},
-std::array<float,2>{0.084898673f, 0.643319547f},
-std::array<float,2>{0.238916427f, 0.140016526f},
-std::array<float,2>{0.895376027f, 0.559302747f},
-std::array<float,2>{0.719849288f, 0.320547879f},
-std::array<float,2>{0.341250598f, 0.955696344f},
-std::array<float,2>{0.0351335034f, 0.297509968f},
-std::array<float,2>{0.818484724f, 0.932897687f},
-std::array<float,2>{0.589723706f, 0.191484004f},
-std::array<float,2>{0.479715407f, 0.579877257f},
-std::array<float,2>{0.292141408f, 0.0674961358f},
-std::array<float,2>{0.661176324f, 0.736837566f},
-std::array<float,2>{0.94925648f, 0.440077364f},
-std::array<float,2>{0.171463937f, 0.751736999f},
-std::array<float,2>{0.356591254f, 0.371496171f},
-std::array<float,2>{0.691959679f, 0.988838851f},
-std::array<float,2>{0.932653427f, 0.172411606f},
-std::array<float,2>{0.192003474f, 0.525746524f},
-std::array<float,2>{0.123572618f, 0.0157890525f},
-std::array<float,2>{0.762906313f, 0.661893964f},
-std::array<float,2>{0.527362823f, 0.422324359f},
-std::array<float,2>{0.427519351f, 0.837102294f},
-std::array<float,2>{0.154325917f, 0.490501791f},
-std::array<float,2>{0.997308314f, 0.800899923f},
-std::array<float,2>{0.638639212f, 0.0965957493f},
-std::array<float,2>{0.268290758f, 0.693727493f},
-std::array<float,2>{0.46554479f, 0.239620164f},
-std::array<float,2>{0.616931617f, 0.616162062f},
-std::array<float,2>{0.860966563f, 0.279452711f},
-std::array<float,2>{0.0171320066f, 0.889004707f},
-std::array<float,2>{0.275584966f, 0.414566308f},
-std::array<float,2>{0.625474036f, 0.820056915f},
-std::array<float,2>{0.986953616f, 0.00560898008f},
-std::array<float,2>{0.144423634f, 0.676425695f},
-std::array<float,2>{0.0272407085f, 0.159829959f},
-std::array<float,2>{0.870403588f, 0.507318199f},
-std::array<float,2>{0.618905008f, 0.350535125f},
-std::array<float,2>{0.45423454f, 0.982368469f},
-std::array<float,2>{0.195318609f, 0.251046151f},
-std::array<float,2>{0.929567695f, 0.903281271f},
-std::array<float,2>{0.695877373f, 0.228791967f},
-std::array<float,2>{0.344017863f, 0.605242848f},
-std::array<float,2>{0.436391264f, 0.111608975f},
-std::array<float,2>{0.521479905f, 0.712632179f},
-std::array<float,2>{0.755789816f, 0.477672398f},
-std::array<float,2>{0.109996028f, 0.782997787f},
-std::array<float,2>{0.475293934f, 0.342009902f},
-std::array<float,2>{0.585275531f, 0.949666798f},
-std::array<float,2>{0.820631325f, 0.144928843f},
-std::array<float,2>{0.0391118266f, 0.532127023f},
-std::array<float,2>{0.161462367f, 0.0467350036f},
-std::array<float,2>{0.942645609f, 0.626101971f},
-std::array<float,2>{0.664377928f, 0.393928021f},
-std::array<float,2>{0.283725679f, 0.855452061f},
-std::array<float,2>{0.0933444798f, 0.462653935f},
-std::array<float,2>{0.810671747f, 0.766608655f},
-std::array<float,2>{0.543618917f, 0.0921757519f},
-std::array<float,2>{0.386469394f, 0.721823215f},
-std::array<float,2>{0.330143094f, 0.208299264f},
-std::array<float,2>{0.729248583f, 0.573821664f},
-std::array<float,2>{0.898439407f, 0.291585535f},
-std::array<float,2>{0.247190073f, 0.912991166f},
-std::array<float,2>{0.401004046f, 0.486432225f},
-std::array<float,2>{0.557981431f, 0.80034107f},
-std::array<float,2>{0.796438992f, 0.0979501903f},
-std::array<float,2>{0.0693734214f, 0.689275205f},
-std::array<float,2>{0.229598805f, 0.23572132f},
-std::array<float,2>{0.875216246f, 0.613229752f},
-std::array<float,2>{0.743534148f, 0.276817948f},
-std::array<float,2>{0.314207703f, 0.885279655f},
-std::array<float,2>{0.0581006818f, 0.370942533f},
-std::array<float,2>{0.836368918f, 0.987815678f},
-std::array<float,2>{0.575628638f, 0.175824806f},
-std::array<float,2>{0.486763924f, 0.528410614f},
-std::array<float,2>{0.297666907f, 0.0230913255f},
-std::array<float,2>{0.679142594f, 0.657927036f},
-std::array<float,2>{0.965129256f, 0.427352756f},
-std::array<float,2>{0.176853627f, 0.843372405f},
-std::array<float,2>{0.361063451f, 0.302800119f},
-std::array<float,2>{0.708289325f, 0.935453236f},
-std::array<float,2>{0.910230279f, 0.187949538f},
-std::array<float,2>{0.211723119f, 0.582733631f},
-std::array<float,2>{0.109284677f, 0.0652848557f},
-std::array<float,2>{0.777865589f, 0.739160061f},
-std::array<float,2>{0.501235366f, 0.441927224f},
-std::array<float,2>{0.413672835f, 0.7568838f},
-std::array<float,2>{0.138748929f, 0.382300377f},
-std::array<float,2>{0.979633391f, 0.870879233f},
-std::array<float,2>{0.644164503f, 0.0587225035f},
-std::array<float,2>{0.255699486f, 0.647808671f},
-std::array<float,2>{0.440046132f, 0.135973528f},
-std::array<float,2>{0.594743013f, 0.558592141f},
-std::array<float,2>{0.85028857f, 0.324455202f},
-std::array<float,2>{0.0147306332f, 0.959557772f},
-std::array<float,2>{0.32360822f, 0.446509928f},
-std::array<float,2>{0.740670323f, 0.761996686f},
-std::array<float,2>{0.887447417f, 0.0757111609f},
-std::array<float,2>{0.219979569f, 0.744715691f},
-std::array<float,2>{0.0735899806f, 0.196810231f},
-std::array<float,2>{0.784691393f, 0.590929329f},
-std::array<float,2>{0.552114606f, 0.305611491f},
-std::array<float,2>{0.391502619f, 0.926258385f},
-std::array<float,2>{0.185693607f, 0.319026142f},
-std::array<float,2>{0.957103312f, 0.966701388f},
-std::array<float,2>{0.683756948f, 0.127592817f},
-std::array<float,2>{0.307298064f, 0.549996138f},
-std::array<float,2>{0.497256994f, 0.0533973686f},
-std::array<float,2>{0.564854622f, 0.651172519f},
-std::array<float,2>{0.834562302f, 0.383208543f},
-std::array<float,2>{0.0504382178f, 0.86609441f},
-std::array<float,2>{0.41461134f, 0.269222736f},
-std::array<float,2>{0.51066494f, 0.875757098f},
-std::array<float,2>{0.768132865f, 0.24702619f},
-std::array<float,2>{0.0981531963f, 0.623103023f},
-std::array<float,2>{0.210575297f, 0.108756624f},
-std::array<float,2>{0.918468356f, 0.695841551f},
-std::array<float,2>{0.717470884f, 0.499096692f},
-std::array<float,2>{0.371105164f, 0.808653951f},
-std::array<float,2>{0.00340728718f, 0.437214971f},
-std::array<float,2>{0.85222888f, 0.828370094f},
-std::array<float,2>{0.60914892f, 0.0306203924f},
-std::array<float,2>{0.452806264f, 0.665909529f},
-std::array<float,2>{0.258140922f, 0.186265483f},
-std::array<float,2>{0.655551016f, 0.520343125f},
-std::array<float,2>{0.97462666f, 0.36025703f},
-std::array<float,2>{0.130360872f, 0.999465942f},
-std::array<float,2>{0.463596523f, 0.39984414f},
-std::array<float,2>{0.612230122f, 0.84556818f},
-std::array<float,2>{0.864177048f, 0.0385180227f},
-std::array<float,2>{0.0218333192f, 0.64051497f},
-std::array<float,2>{0.150414005f, 0.14889504f},
-std::array<float,2>{0.994346261f, 0.542842865f},
-std::array<float,2>{0.636695445f, 0.333374232f},
-std::array<float,2>{0.272387654f, 0.941614091f},
-std::array<float,2>{0.119376652f, 0.282697678f},
-std::array<float,2>{0.758682966f, 0.920529366f},
-std::array<float,2>{0.527294874f, 0.215733245f},
-std::array<float,2>{0.423882455f, 0.569784701f},
-std::array<float,2>{0.352838218f, 0.0851339996f},
-std::array<float,2>{0.688139141f, 0.733029544f},
-std::array<float,2>{0.935375094f, 0.457021058f},
-std::array<float,2>{0.189811379f, 0.781174302f},
-std::array<float,2>{0.295964718f, 0.353763878f},
-std::array<float,2>{0.659862876f, 0.973995268f},
-std::array<float,2>{0.947743654f, 0.165649608f},
-std::array<float,2>{0.165279746f, 0.513324618f},
-std::array<float,2>{0.0388609655f, 0.00957317557f},
-std::array<float,2>{0.816403747f, 0.686609685f},
-std::array<float,2>{0.590388834f, 0.406284064f},
-std::array<float,2>{0.481481135f, 0.823208332f},
-std::array<float,2>{0.237045273f, 0.469795406f},
-std::array<float,2>{0.893601537f, 0.789712489f},
-std::array<float,2>{0.724279702f, 0.118742406f},
-std::array<float,2>{0.338703305f, 0.704982758f},
-std::array<float,2>{0.377001584f, 0.225252733f},
-std::array<float,2>{0.532747746f, 0.600828171f},
-std::array<float,2>{0.798306465f, 0.26115784f},
-std::array<float,2>{0.0818856508f, 0.896713495f},
-std::array<float,2>{0.349320084f, 0.390005171f},
-std::array<float,2>{0.701038122f, 0.863039255f},
-std::array<float,2>{0.923059165f, 0.0496396981f},
-std::array<float,2>{0.199930936f, 0.652432024f},
-std::array<float,2>{0.114463948f, 0.131208315f},
-std::array<float,2>{0.753054798f, 0.55324769f},
-std::array<float,2>{0.51919049f, 0.314337939f},
-std::array<float,2>{0.432804555f, 0.96439445f},
-std::array<float,2>{0.147909507f, 0.311047554f},
-std::array<float,2>{0.991978884f, 0.921883523f},
-std::array<float,2>{0.631364644f, 0.201446384f},
-std::array<float,2>{0.27845934f, 0.589033842f},
-std::array<float,2>{0.457136452f, 0.0733771399f},
-std::array<float,2>{0.623695612f, 0.747487485f},
-std::array<float,2>{0.872854173f, 0.451274633f},
-std::array<float,2>{0.030655032f, 0.760525644f},
-std::array<float,2>{0.388300151f, 0.364996791f},
-std::array<float,2>{0.541909039f, 0.992304206f},
-std::array<float,2>{0.808202147f, 0.179991841f},
-std::array<float,2>{0.0869793817f, 0.516749859f},
-std::array<float,2>{0.243374303f, 0.0237375088f},
-std::array<float,2>{0.905258775f, 0.671556711f},
-std::array<float,2>{0.732518911f, 0.433131367f},
-std::array<float,2>{0.333904117f, 0.833210588f},
-std::array<float,2>{0.0431005508f, 0.49345386f},
-std::array<float,2>{0.827497959f, 0.807474494f},
-std::array<float,2>{0.578825116f, 0.102163859f},
-std::array<float,2>{0.471053332f, 0.700362563f},
-std::array<float,2>{0.285863847f, 0.242865488f},
-std::array<float,2>{0.671094179f, 0.618300021f},
-std::array<float,2>{0.939858913f, 0.272777438f},
-std::array<float,2>{0.158306807f, 0.879741669f},
-std::array<float,2>{0.490594923f, 0.460787028f},
-std::array<float,2>{0.572794974f, 0.774072886f},
-std::array<float,2>{0.839943528f, 0.0810192153f},
-std::array<float,2>{0.0611749776f, 0.728121817f},
-std::array<float,2>{0.173166499f, 0.211497158f},
-std::array<float,2>{0.962480545f, 0.56532836f},
-std::array<float,2>{0.674595356f, 0.287163228f},
-std::array<float,2>{0.303313941f, 0.915117562f},
-std::array<float,2>{0.0627667978f, 0.328863561f},
-std::array<float,2>{0.789878309f, 0.938790619f},
-std::array<float,2>{0.560317516f, 0.152544484f},
-std::array<float,2>{0.405784875f, 0.546431243f},
-std::array<float,2>{0.317005932f, 0.0337520391f},
-std::array<float,2>{0.746277392f, 0.635564983f},
-std::array<float,2>{0.879427552f, 0.403122842f},
-std::array<float,2>{0.232454151f, 0.84986949f},
-std::array<float,2>{0.252912015f, 0.262965471f},
-std::array<float,2>{0.644640148f, 0.892122805f},
-std::array<float,2>{0.980748951f, 0.219124809f},
-std::array<float,2>{0.13342391f, 0.594728947f},
-std::array<float,2>{0.0106275762f, 0.124907598f},
-std::array<float,2>{0.844168007f, 0.708684146f},
-std::array<float,2>{0.598558366f, 0.476186842f},
-std::array<float,2>{0.442215562f, 0.794293404f},
-std::array<float,2>{0.216675624f, 0.412288249f},
-std::array<float,2>{0.909122884f, 0.824268878f},
-std::array<float,2>{0.705968201f, 0.0152499219f},
-std::array<float,2>{0.367039233f, 0.681188405f},
-std::array<float,2>{0.408485562f, 0.169727474f},
-std::array<float,2>{0.504089892f, 0.508525789f},
-std::array<float,2>{0.775924623f, 0.356376141f},
-std::array<float,2>{0.105000883f, 0.972082078f},
-std::array<float,2>{0.310040712f, 0.48382625f},
-std::array<float,2>{0.680887103f, 0.785391569f},
-std::array<float,2>{0.954670548f, 0.116673693f},
-std::array<float,2>{0.180608466f, 0.71706152f},
-std::array<float,2>{0.0518537611f, 0.230679661f},
-std::array<float,2>{0.830949247f, 0.607043803f},
-std::array<float,2>{0.569340169f, 0.255802155f},
-std::array<float,2>{0.493911207f, 0.899279654f},
-std::array<float,2>{0.225158811f, 0.346518457f},
-std::array<float,2>{0.884814084f, 0.979307294f},
-std::array<float,2>{0.734864116f, 0.160853162f},
-std::array<float,2>{0.32785064f, 0.502049327f},
-std::array<float,2>{0.396250725f, 0.00363659812f},
-std::array<float,2>{0.549684346f, 0.672424912f},
-std::array<float,2>{0.788582802f, 0.418792307f},
-std::array<float,2>{0.0765737295f, 0.81294322f},
-std::array<float,2>{0.446086138f, 0.293931216f},
-std::array<float,2>{0.605302215f, 0.909797788f},
-std::array<float,2>{0.856661916f, 0.20699206f},
-std::array<float,2>{0.0052132206f, 0.574712694f},
-std::array<float,2>{0.127513126f, 0.0868173093f},
-std::array<float,2>{0.970531166f, 0.726188481f},
-std::array<float,2>{0.650245249f, 0.465025246f},
-std::array<float,2>{0.264423996f, 0.772987306f},
-std::array<float,2>{0.0956005082f, 0.395965308f},
-std::array<float,2>{0.770233512f, 0.858113647f},
-std::array<float,2>{0.514624178f, 0.0417027622f},
-std::array<float,2>{0.418848962f, 0.632675111f},
-std::array<float,2>{0.36964488f, 0.142773688f},
-std::array<float,2>{0.714615464f, 0.536822736f},
-std::array<float,2>{0.916698039f, 0.338669151f},
-std::array<float,2>{0.20685263f, 0.946699798f},
-std::array<float,2>{0.429496408f, 0.42440924f},
-std::array<float,2>{0.5309636f, 0.838748634f},
-std::array<float,2>{0.765329123f, 0.0194030292f},
-std::array<float,2>{0.121516712f, 0.66216439f},
-std::array<float,2>{0.195065051f, 0.175187826f},
-std::array<float,2>{0.931406796f, 0.523443341f},
-std::array<float,2>{0.694748759f, 0.37328276f},
-std::array<float,2>{0.359090686f, 0.990664423f},
-std::array<float,2>{0.0183334015f, 0.277859211f},
-std::array<float,2>{0.861625195f, 0.887592852f},
-std::array<float,2>{0.614715338f, 0.241804287f},
-std::array<float,2>{0.467731118f, 0.614153564f},
-std::array<float,2>{0.267216176f, 0.0945423469f},
-std::array<float,2>{0.639956534f, 0.692557633f},
-std::array<float,2>{0.999390602f, 0.489002019f},
-std::array<float,2>{0.152965099f, 0.803242743f},
-std::array<float,2>{0.342097491f, 0.322792798f},
-std::array<float,2>{0.721887171f, 0.95337683f},
-std::array<float,2>{0.898338258f, 0.13723664f},
-std::array<float,2>{0.241380081f, 0.561919034f},
-std::array<float,2>{0.0834482983f, 0.0585166886f},
-std::array<float,2>{0.803998768f, 0.640679419f},
-std::array<float,2>{0.536576927f, 0.378847808f},
-std::array<float,2>{0.379274368f, 0.874788761f},
-std::array<float,2>{0.168209627f, 0.439381212f},
-std::array<float,2>{0.951547384f, 0.752557993f},
-std::array<float,2>{0.663720429f, 0.0688810423f},
-std::array<float,2>{0.290976673f, 0.734388113f},
-std::array<float,2>{0.478085667f, 0.194617763f},
-std::array<float,2>{0.58595705f, 0.581753552f},
-std::array<float,2>{0.816791117f, 0.299414575f},
-std::array<float,2>{0.0327151306f, 0.930630207f},
-std::array<float,2>{0.254336208f, 0.378969133f},
-std::array<float,2>{0.642983317f, 0.868888557f},
-std::array<float,2>{0.979256451f, 0.0607322603f},
-std::array<float,2>{0.140041023f, 0.645002425f},
-std::array<float,2>{0.0140478835f, 0.13453716f},
-std::array<float,2>{0.850661099f, 0.555549383f},
-std::array<float,2>{0.59394753f, 0.326931655f},
-std::array<float,2>{0.440527409f, 0.958227754f},
-std::array<float,2>{0.212374359f, 0.301655918f},
-std::array<float,2>{0.911785543f, 0.936502874f},
-std::array<float,2>{0.707044005f, 0.190712765f},
-std::array<float,2>{0.360291004f, 0.585276842f},
-std::array<float,2>{0.413015842f, 0.0628361776f},
-std::array<float,2>{0.50063163f, 0.741496801f},
-std::array<float,2>{0.77891624f, 0.444038302f},
-std::array<float,2>{0.108071707f, 0.754747808f},
-std::array<float,2>{0.487870514f, 0.368280888f},
-std::array<float,2>{0.575069904f, 0.985267341f},
-std::array<float,2>{0.83769083f, 0.179163381f},
-std::array<float,2>{0.0575713366f, 0.53035289f},
-std::array<float,2>{0.176082104f, 0.0211673025f},
-std::array<float,2>{0.965909421f, 0.658280313f},
-std::array<float,2>{0.678560734f, 0.428251565f},
-std::array<float,2>{0.29853496f, 0.840773642f},
-std::array<float,2>{0.0686329752f, 0.485825837f},
-std::array<float,2>{0.794970334f, 0.798499405f},
-std::array<float,2>{0.557545781f, 0.100555815f},
-std::array<float,2>{0.401897192f, 0.689503253f},
-std::array<float,2>{0.313369721f, 0.237563863f},
-std::array<float,2>{0.742344022f, 0.609540582f},
-std::array<float,2>{0.876628399f, 0.273452371f},
-std::array<float,2>{0.228773594f, 0.88447541f},
-std::array<float,2>{0.385240585f, 0.463143289f},
-std::array<float,2>{0.544034719f, 0.769261181f},
-std::array<float,2>{0.81227237f, 0.0913689956f},
-std::array<float,2>{0.0922685936f, 0.72005564f},
-std::array<float,2>{0.246224508f, 0.210410088f},
-std::array<float,2>{0.899771512f, 0.570343137f},
-std::array<float,2>{0.729752183f, 0.290236384f},
-std::array<float,2>{0.331480235f, 0.911841273f},
-std::array<float,2>{0.0401329547f, 0.339934558f},
-std::array<float,2>{0.822110951f, 0.951870918f},
-std::array<float,2>{0.584251642f, 0.147357002f},
-std::array<float,2>{0.476392716f, 0.534956694f},
-std::array<float,2>{0.284553409f, 0.0440284647f},
-std::array<float,2>{0.665657938f, 0.627240777f},
-std::array<float,2>{0.942155719f, 0.391084105f},
-std::array<float,2>{0.160486609f, 0.852285802f},
-std::array<float,2>{0.345145583f, 0.252167881f},
-std::array<float,2>{0.697075307f, 0.905869544f},
-std::array<float,2>{0.928661108f, 0.228060454f},
-std::array<float,2>{0.196486428f, 0.602287769f},
-std::array<float,2>{0.1106195f, 0.110104404f},
-std::array<float,2>{0.75430727f, 0.713789761f},
-std::array<float,2>{0.520221353f, 0.47881785f},
-std::array<float,2>{0.437445313f, 0.783507824f},
-std::array<float,2>{0.142939791f, 0.416885763f},
-std::array<float,2>{0.987954795f, 0.816422045f},
-std::array<float,2>{0.626388073f, 0.00605638698f},
-std::array<float,2>{0.277159154f, 0.67881161f},
-std::array<float,2>{0.453595549f, 0.156320915f},
-std::array<float,2>{0.617803216f, 0.504299402f},
-std::array<float,2>{0.869683862f, 0.347860843f},
-std::array<float,2>{0.0262730531f, 0.983727634f},
-std::array<float,2>{0.339679331f, 0.472297817f},
-std::array<float,2>{0.722880006f, 0.791402698f},
-std::array<float,2>{0.893291473f, 0.120333537f},
-std::array<float,2>{0.237539962f, 0.705875516f},
-std::array<float,2>{0.0804891735f, 0.224423692f},
-std::array<float,2>{0.797727585f, 0.598053813f},
-std::array<float,2>{0.531279027f, 0.258346736f},
-std::array<float,2>{0.378430456f, 0.894966364f},
-std::array<float,2>{0.164585009f, 0.353184372f},
-std::array<float,2>{0.948778033f, 0.975042105f},
-std::array<float,2>{0.658338964f, 0.166745305f},
-std::array<float,2>{0.295194298f, 0.514713049f},
-std::array<float,2>{0.481182426f, 0.0115939546f},
-std::array<float,2>{0.591092348f, 0.68463695f},
-std::array<float,2>{0.81516093f, 0.409200758f},
-std::array<float,2>{0.0373593755f, 0.821744382f},
-std::array<float,2>{0.425144285f, 0.285145521f},
-std::array<float,2>{0.526149988f, 0.918967485f},
-std::array<float,2>{0.759303093f, 0.218649358f},
-std::array<float,2>{0.120389506f, 0.567560256f},
-std::array<float,2>{0.190672323f, 0.0833326876f},
-std::array<float,2>{0.933842421f, 0.731651306f},
-std::array<float,2>{0.689376056f, 0.453453213f},
-std::array<float,2>{0.351788759f, 0.778771222f},
-std::array<float,2>{0.023314869f, 0.40152356f},
-std::array<float,2>{0.865041792f, 0.847184062f},
-std::array<float,2>{0.613142073f, 0.0354836322f},
-std::array<float,2>{0.46417442f, 0.637120068f},
-std::array<float,2>{0.273298264f, 0.151093096f},
-std::array<float,2>{0.635216355f, 0.54046458f},
-std::array<float,2>{0.996029317f, 0.334632486f},
-std::array<float,2>{0.15203689f, 0.944829106f},
-std::array<float,2>{0.451385707f, 0.435007721f},
-std::array<float,2>{0.607455432f, 0.832020342f},
-std::array<float,2>{0.852719009f, 0.0291245207f},
-std::array<float,2>{0.00249919668f, 0.667109549f},
-std::array<float,2>{0.129620224f, 0.183962226f},
-std::array<float,2>{0.976397932f, 0.522218823f},
-std::array<float,2>{0.65492326f, 0.363001615f},
-std::array<float,2>{0.259585083f, 0.996094346f},
-std::array<float,2>{0.0990252346f, 0.267292529f},
-std::array<float,2>{0.769479394f, 0.877432764f},
-std::array<float,2>{0.51122278f, 0.248879254f},
-std::array<float,2>{0.415802032f, 0.622411013f},
-std::array<float,2>{0.37225017f, 0.106411815f},
-std::array<float,2>{0.718073905f, 0.698933601f},
-std::array<float,2>{0.919095397f, 0.496429056f},
-std::array<float,2>{0.209617168f, 0.812282443f},
-std::array<float,2>{0.307772487f, 0.316923887f},
-std::array<float,2>{0.684741557f, 0.968350291f},
-std::array<float,2>{0.958888292f, 0.126281142f},
-std::array<float,2>{0.187274367f, 0.548395514f},
-std::array<float,2>{0.0497377887f, 0.0521858297f},
-std::array<float,2>{0.835232496f, 0.650146067f},
-std::array<float,2>{0.565923035f, 0.386004657f},
-std::array<float,2>{0.496759057f, 0.864204109f},
-std::array<float,2>{0.219700113f, 0.449208468f},
-std::array<float,2>{0.88801825f, 0.765304327f},
-std::array<float,2>{0.742019176f, 0.0770564079f},
-std::array<float,2>{0.323069453f, 0.742304683f},
-std::array<float,2>{0.39196834f, 0.198506549f},
-std::array<float,2>{0.55152595f, 0.593741655f},
-std::array<float,2>{0.783636093f, 0.308411211f},
-std::array<float,2>{0.0730719119f, 0.927828372f},
-std::array<float,2>{0.365932167f, 0.410171062f},
-std::array<float,2>{0.706112742f, 0.827076674f},
-std::array<float,2>{0.909438431f, 0.0124598332f},
-std::array<float,2>{0.215254948f, 0.683308661f},
-std::array<float,2>{0.103984401f, 0.171503469f},
-std::array<float,2>{0.776865721f, 0.510089695f},
-std::array<float,2>{0.505289137f, 0.358602107f},
-std::array<float,2>{0.409656495f, 0.970230699f},
-std::array<float,2>{0.133885011f, 0.265081853f},
-std::array<float,2>{0.981645703f, 0.894237876f},
-std::array<float,2>{0.646001935f, 0.222181112f},
-std::array<float,2>{0.253727555f, 0.597325921f},
-std::array<float,2>{0.443300515f, 0.122192897f},
-std::array<float,2>{0.59960717f, 0.710633755f},
-std::array<float,2>{0.845487833f, 0.473311484f},
-std::array<float,2>{0.0108691221f, 0.796453774f},
-std::array<float,2>{0.404969782f, 0.331103414f},
-std::array<float,2>{0.55918479f, 0.940071464f},
-std::array<float,2>{0.790755808f, 0.154309884f},
-std::array<float,2>{0.0634797364f, 0.544398129f},
-std::array<float,2>{0.233505011f, 0.0328673534f},
-std::array<float,2>{0.880470157f, 0.633778334f},
-std::array<float,2>{0.747869492f, 0.404797018f},
-std::array<float,2>{0.318305045f, 0.849459767f},
-std::array<float,2>{0.0620268174f, 0.457925916f},
-std::array<float,2>{0.841431439f, 0.775740027f},
-std::array<float,2>{0.573256552f, 0.0786259249f},
-std::array<float,2>{0.492112815f, 0.729076087f},
-std::array<float,2>{0.303793371f, 0.214035824f},
-std::array<float,2>{0.67485559f, 0.563322246f},
-std::array<float,2>{0.961607456f, 0.286951691f},
-std::array<float,2>{0.172769308f, 0.917919457f},
-std::array<float,2>{0.472070903f, 0.494327933f},
-std::array<float,2>{0.579126f, 0.804705918f},
-std::array<float,2>{0.826316833f, 0.104853116f},
-std::array<float,2>{0.0448405184f, 0.70182097f},
-std::array<float,2>{0.159192294f, 0.245371684f},
-std::array<float,2>{0.941298723f, 0.619886041f},
-std::array<float,2>{0.670249522f, 0.270967931f},
-std::array<float,2>{0.286652982f, 0.882588446f},
-std::array<float,2>{0.0859520361f, 0.365373075f},
-std::array<float,2>{0.807260215f, 0.994601429f},
-std::array<float,2>{0.542815387f, 0.182331696f},
-std::array<float,2>{0.387336075f, 0.519151092f},
-std::array<float,2>{0.332872391f, 0.0270470846f},
-std::array<float,2>{0.734054863f, 0.668019831f},
-std::array<float,2>{0.905540705f, 0.43066889f},
-std::array<float,2>{0.243015245f, 0.83491087f},
-std::array<float,2>{0.278310806f, 0.309655368f},
-std::array<float,2>{0.631859958f, 0.924129665f},
-std::array<float,2>{0.990446508f, 0.200472131f},
-std::array<float,2>{0.146805853f, 0.587135792f},
-std::array<float,2>{0.0302313399f, 0.0721306428f},
-std::array<float,2>{0.871533811f, 0.749498785f},
-std::array<float,2>{0.624754727f, 0.45070231f},
-std::array<float,2>{0.458064973f, 0.758126199f},
-std::array<float,2>{0.200327739f, 0.388112634f},
-std::array<float,2>{0.922555387f, 0.860882461f},
-std::array<float,2>{0.699631751f, 0.0478205159f},
-std::array<float,2>{0.348294646f, 0.654615581f},
-std::array<float,2>{0.432513177f, 0.129049957f},
-std::array<float,2>{0.517793f, 0.551983476f},
-std::array<float,2>{0.752345085f, 0.316106439f},
-std::array<float,2>{0.114248276f, 0.961695015f},
-std::array<float,2>{0.289437562f, 0.44088605f},
-std::array<float,2>{0.662763953f, 0.750824869f},
-std::array<float,2>{0.952218771f, 0.0667876899f},
-std::array<float,2>{0.16964674f, 0.737429857f},
-std::array<float,2>{0.0313711502f, 0.193298638f},
-std::array<float,2>{0.818194211f, 0.578983784f},
-std::array<float,2>{0.587024808f, 0.298098743f},
-std::array<float,2>{0.476936102f, 0.932456493f},
-std::array<float,2>{0.240884334f, 0.321907878f},
-std::array<float,2>{0.896927297f, 0.956537485f},
-std::array<float,2>{0.7209993f, 0.139435098f},
-std::array<float,2>{0.343458056f, 0.559878826f},
-std::array<float,2>{0.380574524f, 0.056390442f},
-std::array<float,2>{0.536020279f, 0.644088924f},
-std::array<float,2>{0.802836299f, 0.375404239f},
-std::array<float,2>{0.0823430568f, 0.871630967f},
-std::array<float,2>{0.467883736f, 0.280635118f},
-std::array<float,2>{0.613980114f, 0.889982998f},
-std::array<float,2>{0.86280638f, 0.238988668f},
-std::array<float,2>{0.0189546403f, 0.616602778f},
-std::array<float,2>{0.154047757f, 0.0967136845f},
-std::array<float,2>{0.998660922f, 0.69510895f},
-std::array<float,2>{0.63924849f, 0.49180156f},
-std::array<float,2>{0.265977323f, 0.801928759f},
-std::array<float,2>{0.122549035f, 0.423089951f},
-std::array<float,2>{0.763835192f, 0.836843252f},
-std::array<float,2>{0.529657602f, 0.0167939719f},
-std::array<float,2>{0.428429484f, 0.660163999f},
-std::array<float,2>{0.358296514f, 0.172905281f},
-std::array<float,2>{0.693883836f, 0.526552856f},
-std::array<float,2>{0.929893911f, 0.372724652f},
-std::array<float,2>{0.194094345f, 0.989501536f},
-std::array<float,2>{0.419402838f, 0.397034734f},
-std::array<float,2>{0.514828622f, 0.856531799f},
-std::array<float,2>{0.770778f, 0.0397136398f},
-std::array<float,2>{0.0947168469f, 0.629411519f},
-std::array<float,2>{0.205228552f, 0.141829997f},
-std::array<float,2>{0.917481482f, 0.538948596f},
-std::array<float,2>{0.712896287f, 0.336873263f},
-std::array<float,2>{0.370137632f, 0.948464692f},
-std::array<float,2>{0.00395771302f, 0.295369685f},
-std::array<float,2>{0.85588938f, 0.906645298f},
-std::array<float,2>{0.603765845f, 0.203468129f},
-std::array<float,2>{0.446618676f, 0.57732445f},
-std::array<float,2>{0.264857173f, 0.0880393013f},
-std::array<float,2>{0.648700655f, 0.72294724f},
-std::array<float,2>{0.96947062f, 0.466836751f},
-std::array<float,2>{0.128082082f, 0.770118713f},
-std::array<float,2>{0.326984942f, 0.344552219f},
-std::array<float,2>{0.736008227f, 0.977226138f},
-std::array<float,2>{0.885992765f, 0.163326547f},
-std::array<float,2>{0.226166621f, 0.501606882f},
-std::array<float,2>{0.0777114779f, 0.000168327795f},
-std::array<float,2>{0.787621379f, 0.675498426f},
-std::array<float,2>{0.550561428f, 0.42083627f},
-std::array<float,2>{0.394562453f, 0.815813005f},
-std::array<float,2>{0.1808431f, 0.482171595f},
-std::array<float,2>{0.953782201f, 0.787783027f},
-std::array<float,2>{0.680589855f, 0.113294035f},
-std::array<float,2>{0.308778316f, 0.716407776f},
-std::array<float,2>{0.493017256f, 0.233745381f},
-std::array<float,2>{0.568675518f, 0.607958376f},
-std::array<float,2>{0.83130604f, 0.255963445f},
-std::array<float,2>{0.0512775183f, 0.902043581f},
-std::array<float,2>{0.298940957f, 0.426517665f},
-std::array<float,2>{0.676046491f, 0.842637777f},
-std::array<float,2>{0.968552351f, 0.0222205501f},
-std::array<float,2>{0.178474322f, 0.656823993f},
-std::array<float,2>{0.0560487434f, 0.177029058f},
-std::array<float,2>{0.839137018f, 0.527793407f},
-std::array<float,2>{0.577952981f, 0.369583219f},
-std::array<float,2>{0.485965192f, 0.986807823f},
-std::array<float,2>{0.228385478f, 0.275430888f},
-std::array<float,2>{0.878247738f, 0.886700392f},
-std::array<float,2>{0.744380534f, 0.235233977f},
-std::array<float,2>{0.316206306f, 0.611582696f},
-std::array<float,2>{0.399176747f, 0.0990975872f},
-std::array<float,2>{0.554999709f, 0.688427031f},
-std::array<float,2>{0.79307723f, 0.487572163f},
-std::array<float,2>{0.0670795068f, 0.799483776f},
-std::array<float,2>{0.439406365f, 0.325252265f},
-std::array<float,2>{0.596794248f, 0.960673034f},
-std::array<float,2>{0.84836185f, 0.135185078f},
-std::array<float,2>{0.0120314853f, 0.557451129f},
-std::array<float,2>{0.138299048f, 0.0605362207f},
-std::array<float,2>{0.978478611f, 0.646624625f},
-std::array<float,2>{0.640646994f, 0.381540209f},
-std::array<float,2>{0.257314563f, 0.869316339f},
-std::array<float,2>{0.105538994f, 0.442430317f},
-std::array<float,2>{0.779456437f, 0.756240726f},
-std::array<float,2>{0.502762496f, 0.0655225962f},
-std::array<float,2>{0.411318839f, 0.740117133f},
-std::array<float,2>{0.362963468f, 0.189026713f},
-std::array<float,2>{0.709630787f, 0.583918691f},
-std::array<float,2>{0.913070083f, 0.303944498f},
-std::array<float,2>{0.214792728f, 0.933834016f},
-std::array<float,2>{0.434149683f, 0.477387428f},
-std::array<float,2>{0.522818029f, 0.781403124f},
-std::array<float,2>{0.756923735f, 0.112711243f},
-std::array<float,2>{0.112179987f, 0.71137327f},
-std::array<float,2>{0.198036924f, 0.230411276f},
-std::array<float,2>{0.927074671f, 0.604297459f},
-std::array<float,2>{0.697679877f, 0.25011456f},
-std::array<float,2>{0.346618176f, 0.90348208f},
-std::array<float,2>{0.0242059678f, 0.351350725f},
-std::array<float,2>{0.868706167f, 0.980718374f},
-std::array<float,2>{0.620935023f, 0.158404291f},
-std::array<float,2>{0.455388933f, 0.50586164f},
-std::array<float,2>{0.274492383f, 0.0039850655f},
-std::array<float,2>{0.627417147f, 0.677027524f},
-std::array<float,2>{0.985302448f, 0.415570766f},
-std::array<float,2>{0.141978174f, 0.818853199f},
-std::array<float,2>{0.32849431f, 0.292701691f},
-std::array<float,2>{0.7283746f, 0.913336694f},
-std::array<float,2>{0.901932657f, 0.207581624f},
-std::array<float,2>{0.24877359f, 0.572525203f},
-std::array<float,2>{0.0906221569f, 0.0936855897f},
-std::array<float,2>{0.809346318f, 0.721036792f},
-std::array<float,2>{0.546652734f, 0.461092174f},
-std::array<float,2>{0.383595735f, 0.76621604f},
-std::array<float,2>{0.162328213f, 0.392947763f},
-std::array<float,2>{0.943682611f, 0.853604198f},
-std::array<float,2>{0.666050911f, 0.0452517681f},
-std::array<float,2>{0.281615078f, 0.625360966f},
-std::array<float,2>{0.473307937f, 0.145726845f},
-std::array<float,2>{0.582734108f, 0.532988131f},
-std::array<float,2>{0.822844148f, 0.342964739f},
-std::array<float,2>{0.0417856798f, 0.950532436f},
-std::array<float,2>{0.354002327f, 0.45519048f},
-std::array<float,2>{0.690927029f, 0.780233502f},
-std::array<float,2>{0.936236382f, 0.084091045f},
-std::array<float,2>{0.188880607f, 0.733935535f},
-std::array<float,2>{0.118142165f, 0.216690049f},
-std::array<float,2>{0.760777771f, 0.569291174f},
-std::array<float,2>{0.523526669f, 0.281600267f},
-std::array<float,2>{0.423547477f, 0.921488881f},
-std::array<float,2>{0.150374338f, 0.332565397f},
-std::array<float,2>{0.993055165f, 0.942669868f},
-std::array<float,2>{0.634124458f, 0.150099874f},
-std::array<float,2>{0.269984514f, 0.541707993f},
-std::array<float,2>{0.461640894f, 0.0375115126f},
-std::array<float,2>{0.60995388f, 0.63883853f},
-std::array<float,2>{0.866570234f, 0.399384975f},
-std::array<float,2>{0.0205997098f, 0.844314635f},
-std::array<float,2>{0.376269072f, 0.260592639f},
-std::array<float,2>{0.53325212f, 0.897489727f},
-std::array<float,2>{0.800693452f, 0.225952819f},
-std::array<float,2>{0.0783128515f, 0.599709809f},
-std::array<float,2>{0.23458977f, 0.117485404f},
-std::array<float,2>{0.892022073f, 0.703302264f},
-std::array<float,2>{0.726241052f, 0.468987465f},
-std::array<float,2>{0.336137027f, 0.79077965f},
-std::array<float,2>{0.0367332809f, 0.407269806f},
-std::array<float,2>{0.812954664f, 0.823655605f},
-std::array<float,2>{0.593483984f, 0.00844084844f},
-std::array<float,2>{0.482437968f, 0.686426342f},
-std::array<float,2>{0.293689519f, 0.164075553f},
-std::array<float,2>{0.656899512f, 0.511917889f},
-std::array<float,2>{0.946909785f, 0.354862511f},
-std::array<float,2>{0.16662319f, 0.972992718f},
-std::array<float,2>{0.498090625f, 0.384740949f},
-std::array<float,2>{0.563595533f, 0.866653025f},
-std::array<float,2>{0.833691239f, 0.0546721965f},
-std::array<float,2>{0.047537107f, 0.651723087f},
-std::array<float,2>{0.185199618f, 0.128425717f},
-std::array<float,2>{0.9603706f, 0.549177289f},
-std::array<float,2>{0.685647011f, 0.319807351f},
-std::array<float,2>{0.304804981f, 0.964902937f},
-std::array<float,2>{0.071271129f, 0.305733919f},
-std::array<float,2>{0.782983005f, 0.927055418f},
-std::array<float,2>{0.554116905f, 0.19613564f},
-std::array<float,2>{0.392947346f, 0.590775311f},
-std::array<float,2>{0.321715802f, 0.0744428486f},
-std::array<float,2>{0.738998175f, 0.745209455f},
-std::array<float,2>{0.88917613f, 0.446143001f},
-std::array<float,2>{0.22191076f, 0.763003111f},
-std::array<float,2>{0.260232359f, 0.360660434f},
-std::array<float,2>{0.653299689f, 0.998349011f},
-std::array<float,2>{0.974127829f, 0.187317714f},
-std::array<float,2>{0.131095737f, 0.520902216f},
-std::array<float,2>{0.000787559431f, 0.0295958109f},
-std::array<float,2>{0.85360992f, 0.664932728f},
-std::array<float,2>{0.605961144f, 0.435952932f},
-std::array<float,2>{0.451096147f, 0.829872906f},
-std::array<float,2>{0.208981037f, 0.498541713f},
-std::array<float,2>{0.919989645f, 0.809622586f},
-std::array<float,2>{0.716125846f, 0.108262129f},
-std::array<float,2>{0.374420792f, 0.696397662f},
-std::array<float,2>{0.417180538f, 0.247688293f},
-std::array<float,2>{0.50942421f, 0.624313712f},
-std::array<float,2>{0.7656582f, 0.268352419f},
-std::array<float,2>{0.0997848362f, 0.876224279f},
-std::array<float,2>{0.318752646f, 0.403550535f},
-std::array<float,2>{0.748124599f, 0.851057887f},
-std::array<float,2>{0.881005526f, 0.0342816785f},
-std::array<float,2>{0.230991423f, 0.635850489f},
-std::array<float,2>{0.0655240044f, 0.15377906f},
-std::array<float,2>{0.791589737f, 0.545545459f},
-std::array<float,2>{0.561461389f, 0.329604208f},
-std::array<float,2>{0.403036118f, 0.937522292f},
-std::array<float,2>{0.174487397f, 0.288418978f},
-std::array<float,2>{0.963647127f, 0.914916158f},
-std::array<float,2>{0.672253013f, 0.2121059f},
-std::array<float,2>{0.301087111f, 0.565835476f},
-std::array<float,2>{0.489284158f, 0.0811734423f},
-std::array<float,2>{0.571786821f, 0.726687849f},
-std::array<float,2>{0.842046201f, 0.459629595f},
-std::array<float,2>{0.0586654432f, 0.774462044f},
-std::array<float,2>{0.407615781f, 0.357021928f},
-std::array<float,2>{0.5065642f, 0.97084409f},
-std::array<float,2>{0.773518026f, 0.168724939f},
-std::array<float,2>{0.102399446f, 0.509065211f},
-std::array<float,2>{0.218578011f, 0.0142163113f},
-std::array<float,2>{0.907660425f, 0.680641711f},
-std::array<float,2>{0.704940379f, 0.413671851f},
-std::array<float,2>{0.363850802f, 0.825931311f},
-std::array<float,2>{0.00828807522f, 0.475458562f},
-std::array<float,2>{0.847537577f, 0.793168426f},
-std::array<float,2>{0.599986851f, 0.123152271f},
-std::array<float,2>{0.443861455f, 0.707297862f},
-std::array<float,2>{0.250730127f, 0.220612079f},
-std::array<float,2>{0.647861421f, 0.594724894f},
-std::array<float,2>{0.983019412f, 0.262103468f},
-std::array<float,2>{0.136302471f, 0.89078939f},
-std::array<float,2>{0.460439771f, 0.45243758f},
-std::array<float,2>{0.622098744f, 0.761463881f},
-std::array<float,2>{0.873531938f, 0.072436206f},
-std::array<float,2>{0.0282601714f, 0.746639729f},
-std::array<float,2>{0.145937189f, 0.202968225f},
-std::array<float,2>{0.988635123f, 0.588418484f},
-std::array<float,2>{0.630005181f, 0.311743647f},
-std::array<float,2>{0.280182034f, 0.923389316f},
-std::array<float,2>{0.11578092f, 0.31313175f},
-std::array<float,2>{0.751869798f, 0.963080466f},
-std::array<float,2>{0.515993893f, 0.132690772f},
-std::array<float,2>{0.430083454f, 0.554495871f},
-std::array<float,2>{0.350320429f, 0.0500995927f},
-std::array<float,2>{0.702695668f, 0.653862715f},
-std::array<float,2>{0.924376309f, 0.389414519f},
-std::array<float,2>{0.201450571f, 0.861879945f},
-std::array<float,2>{0.288841784f, 0.272196025f},
-std::array<float,2>{0.669569194f, 0.8806023f},
-std::array<float,2>{0.938988268f, 0.243633315f},
-std::array<float,2>{0.157382831f, 0.617200375f},
-std::array<float,2>{0.0453803092f, 0.103019595f},
-std::array<float,2>{0.824885964f, 0.699510872f},
-std::array<float,2>{0.581636965f, 0.492321163f},
-std::array<float,2>{0.469291478f, 0.808524609f},
-std::array<float,2>{0.24505651f, 0.432050705f},
-std::array<float,2>{0.903804481f, 0.832997382f},
-std::array<float,2>{0.732073247f, 0.0245755725f},
-std::array<float,2>{0.334487528f, 0.670252204f},
-std::array<float,2>{0.390578032f, 0.180686638f},
-std::array<float,2>{0.540442109f, 0.515804708f},
-std::array<float,2>{0.806599677f, 0.363453627f},
-std::array<float,2>{0.0891612321f, 0.993228912f},
-std::array<float,2>{0.269133121f, 0.489270151f},
-std::array<float,2>{0.636846602f, 0.803853035f},
-std::array<float,2>{0.996438324f, 0.0953994319f},
-std::array<float,2>{0.155648872f, 0.691907823f},
-std::array<float,2>{0.016154144f, 0.240401506f},
-std::array<float,2>{0.859757721f, 0.614601791f},
-std::array<float,2>{0.61552012f, 0.278547645f},
-std::array<float,2>{0.466546446f, 0.888472557f},
-std::array<float,2>{0.192591757f, 0.374541909f},
-std::array<float,2>{0.932059109f, 0.991283178f},
-std::array<float,2>{0.692573845f, 0.174039066f},
-std::array<float,2>{0.35595423f, 0.525249004f},
-std::array<float,2>{0.426146954f, 0.0182997975f},
-std::array<float,2>{0.528753817f, 0.66348511f},
-std::array<float,2>{0.76189512f, 0.425574362f},
-std::array<float,2>{0.124948889f, 0.839254141f},
-std::array<float,2>{0.478980094f, 0.300589889f},
-std::array<float,2>{0.588832438f, 0.930779755f},
-std::array<float,2>{0.820279062f, 0.193575069f},
-std::array<float,2>{0.0334605388f, 0.580184639f},
-std::array<float,2>{0.170851648f, 0.0698105246f},
-std::array<float,2>{0.950226188f, 0.735435665f},
-std::array<float,2>{0.660912871f, 0.43752417f},
-std::array<float,2>{0.291827738f, 0.753222346f},
-std::array<float,2>{0.0857052132f, 0.37710759f},
-std::array<float,2>{0.801480055f, 0.873414397f},
-std::array<float,2>{0.537768304f, 0.056985192f},
-std::array<float,2>{0.381219119f, 0.64234519f},
-std::array<float,2>{0.34007895f, 0.137982875f},
-std::array<float,2>{0.71945709f, 0.560789108f},
-std::array<float,2>{0.895949185f, 0.323673934f},
-std::array<float,2>{0.240003616f, 0.955019116f},
-std::array<float,2>{0.398427665f, 0.418962061f},
-std::array<float,2>{0.548349977f, 0.814225972f},
-std::array<float,2>{0.785323024f, 0.00228553847f},
-std::array<float,2>{0.0758380368f, 0.672956884f},
-std::array<float,2>{0.224605799f, 0.161844417f},
-std::array<float,2>{0.883306146f, 0.50296551f},
-std::array<float,2>{0.738249123f, 0.346742213f},
-std::array<float,2>{0.3243981f, 0.979655862f},
-std::array<float,2>{0.0527683049f, 0.254588604f},
-std::array<float,2>{0.828532219f, 0.900344491f},
-std::array<float,2>{0.567424238f, 0.231509149f},
-std::array<float,2>{0.494550735f, 0.606358349f},
-std::array<float,2>{0.311821759f, 0.11617925f},
-std::array<float,2>{0.682952821f, 0.717896998f},
-std::array<float,2>{0.955822408f, 0.482851595f},
-std::array<float,2>{0.182124421f, 0.786737382f},
-std::array<float,2>{0.367736638f, 0.339705408f},
-std::array<float,2>{0.712372065f, 0.945534945f},
-std::array<float,2>{0.915543497f, 0.14397262f},
-std::array<float,2>{0.20414497f, 0.535797954f},
-std::array<float,2>{0.0961185172f, 0.0424435064f},
-std::array<float,2>{0.771829486f, 0.63105011f},
-std::array<float,2>{0.512353897f, 0.394615442f},
-std::array<float,2>{0.420824766f, 0.85847199f},
-std::array<float,2>{0.125288084f, 0.466186434f},
-std::array<float,2>{0.97249943f, 0.771937788f},
-std::array<float,2>{0.651710927f, 0.0876675323f},
-std::array<float,2>{0.262062639f, 0.725354254f},
-std::array<float,2>{0.448190868f, 0.205561817f},
-std::array<float,2>{0.60219574f, 0.575286925f},
-std::array<float,2>{0.858200788f, 0.294497102f},
-std::array<float,2>{0.0076806047f, 0.908468783f},
-std::array<float,2>{0.292806566f, 0.37522459f},
-std::array<float,2>{0.661839485f, 0.87196219f},
-std::array<float,2>{0.949872315f, 0.0564085878f},
-std::array<float,2>{0.170984194f, 0.644328415f},
-std::array<float,2>{0.0343674906f, 0.139233157f},
-std::array<float,2>{0.818891764f, 0.559727371f},
-std::array<float,2>{0.589224577f, 0.322147071f},
-std::array<float,2>{0.480068386f, 0.956168473f},
-std::array<float,2>{0.238544121f, 0.297859758f},
-std::array<float,2>{0.894964933f, 0.932174742f},
-std::array<float,2>{0.720247626f, 0.192976594f},
-std::array<float,2>{0.341791749f, 0.578733265f},
-std::array<float,2>{0.382506698f, 0.0665043741f},
-std::array<float,2>{0.538740039f, 0.737781942f},
-std::array<float,2>{0.801761448f, 0.440649807f},
-std::array<float,2>{0.0842176378f, 0.750701904f},
-std::array<float,2>{0.464981616f, 0.372874409f},
-std::array<float,2>{0.616628349f, 0.989621878f},
-std::array<float,2>{0.860475719f, 0.173171788f},
-std::array<float,2>{0.0169011224f, 0.526823997f},
-std::array<float,2>{0.155207813f, 0.0169595685f},
-std::array<float,2>{0.997579038f, 0.660478652f},
-std::array<float,2>{0.638026953f, 0.423205793f},
-std::array<float,2>{0.267645925f, 0.836642563f},
-std::array<float,2>{0.123082675f, 0.492026359f},
-std::array<float,2>{0.763238132f, 0.802239716f},
-std::array<float,2>{0.528179407f, 0.0971012414f},
-std::array<float,2>{0.427014381f, 0.694997549f},
-std::array<float,2>{0.357158154f, 0.23907119f},
-std::array<float,2>{0.691588342f, 0.616250575f},
-std::array<float,2>{0.933469892f, 0.280399024f},
-std::array<float,2>{0.191840068f, 0.889687121f},
-std::array<float,2>{0.42174381f, 0.467102617f},
-std::array<float,2>{0.513650179f, 0.770338535f},
-std::array<float,2>{0.773318529f, 0.0882369578f},
-std::array<float,2>{0.0976524428f, 0.722705185f},
-std::array<float,2>{0.20345585f, 0.20333831f},
-std::array<float,2>{0.914691687f, 0.577622473f},
-std::array<float,2>{0.711264193f, 0.295045674f},
-std::array<float,2>{0.368270904f, 0.906340837f},
-std::array<float,2>{0.00604334334f, 0.336480945f},
-std::array<float,2>{0.859192669f, 0.948487341f},
-std::array<float,2>{0.602791905f, 0.141879782f},
-std::array<float,2>{0.448902994f, 0.538671911f},
-std::array<float,2>{0.26348874f, 0.0398174934f},
-std::array<float,2>{0.650405645f, 0.629676163f},
-std::array<float,2>{0.9712556f, 0.397300124f},
-std::array<float,2>{0.126932785f, 0.856854975f},
-std::array<float,2>{0.325460553f, 0.256299078f},
-std::array<float,2>{0.736343324f, 0.902285218f},
-std::array<float,2>{0.884581923f, 0.233488977f},
-std::array<float,2>{0.222865611f, 0.608375728f},
-std::array<float,2>{0.0750837699f, 0.113610521f},
-std::array<float,2>{0.786155879f, 0.716607451f},
-std::array<float,2>{0.547051668f, 0.482352525f},
-std::array<float,2>{0.397382498f, 0.787938774f},
-std::array<float,2>{0.182831332f, 0.42042616f},
-std::array<float,2>{0.956122577f, 0.81560266f},
-std::array<float,2>{0.682495534f, 0.000467579521f},
-std::array<float,2>{0.310977519f, 0.675591052f},
-std::array<float,2>{0.495271295f, 0.163387969f},
-std::array<float,2>{0.566590071f, 0.501887858f},
-std::array<float,2>{0.829789579f, 0.344414055f},
-std::array<float,2>{0.0542088747f, 0.977471888f},
-std::array<float,2>{0.365006477f, 0.473466277f},
-std::array<float,2>{0.703896701f, 0.796665847f},
-std::array<float,2>{0.906818986f, 0.122387856f},
-std::array<float,2>{0.21741654f, 0.710795403f},
-std::array<float,2>{0.103122167f, 0.222556502f},
-std::array<float,2>{0.774949133f, 0.597507834f},
-std::array<float,2>{0.507606745f, 0.264770001f},
-std::array<float,2>{0.406621605f, 0.894458175f},
-std::array<float,2>{0.13545841f, 0.358668327f},
-std::array<float,2>{0.983614862f, 0.970610619f},
-std::array<float,2>{0.646716475f, 0.171815306f},
-std::array<float,2>{0.2518498f, 0.509883583f},
-std::array<float,2>{0.44436276f, 0.0122429151f},
-std::array<float,2>{0.600625694f, 0.683562279f},
-std::array<float,2>{0.845791399f, 0.410539329f},
-std::array<float,2>{0.00914745964f, 0.826886594f},
-std::array<float,2>{0.403943211f, 0.28677249f},
-std::array<float,2>{0.561632872f, 0.917677104f},
-std::array<float,2>{0.792304337f, 0.21430932f},
-std::array<float,2>{0.065040499f, 0.563174367f},
-std::array<float,2>{0.231981084f, 0.0789512917f},
-std::array<float,2>{0.882712543f, 0.729272962f},
-std::array<float,2>{0.7493155f, 0.457748771f},
-std::array<float,2>{0.319693536f, 0.775403321f},
-std::array<float,2>{0.0598186813f, 0.405041844f},
-std::array<float,2>{0.843080878f, 0.849334896f},
-std::array<float,2>{0.570708632f, 0.0329632461f},
-std::array<float,2>{0.489210427f, 0.633431852f},
-std::array<float,2>{0.302026868f, 0.154554605f},
-std::array<float,2>{0.6733706f, 0.544043243f},
-std::array<float,2>{0.963925898f, 0.331358224f},
-std::array<float,2>{0.174922749f, 0.940240979f},
-std::array<float,2>{0.470056802f, 0.431096852f},
-std::array<float,2>{0.580937445f, 0.83453685f},
-std::array<float,2>{0.825413227f, 0.0273187347f},
-std::array<float,2>{0.046599444f, 0.668447375f},
-std::array<float,2>{0.156643197f, 0.182418242f},
-std::array<float,2>{0.938437939f, 0.519441545f},
-std::array<float,2>{0.668719947f, 0.365517527f},
-std::array<float,2>{0.287499845f, 0.994153321f},
-std::array<float,2>{0.0885391831f, 0.27063179f},
-std::array<float,2>{0.805453539f, 0.882428765f},
-std::array<float,2>{0.53946197f, 0.245215207f},
-std::array<float,2>{0.389101833f, 0.619726777f},
-std::array<float,2>{0.335076451f, 0.104566701f},
-std::array<float,2>{0.731395066f, 0.701908946f},
-std::array<float,2>{0.902357101f, 0.494537175f},
-std::array<float,2>{0.245716989f, 0.805081546f},
-std::array<float,2>{0.281156808f, 0.316170424f},
-std::array<float,2>{0.629173338f, 0.961507022f},
-std::array<float,2>{0.989409447f, 0.129155397f},
-std::array<float,2>{0.145371884f, 0.552135289f},
-std::array<float,2>{0.0285588354f, 0.0474573523f},
-std::array<float,2>{0.874769926f, 0.654366732f},
-std::array<float,2>{0.621681571f, 0.38783282f},
-std::array<float,2>{0.45917502f, 0.861109376f},
-std::array<float,2>{0.202785328f, 0.45095849f},
-std::array<float,2>{0.925084651f, 0.757826149f},
-std::array<float,2>{0.701546013f, 0.0720039532f},
-std::array<float,2>{0.351234704f, 0.749080181f},
-std::array<float,2>{0.431597918f, 0.200294986f},
-std::array<float,2>{0.51660198f, 0.587233841f},
-std::array<float,2>{0.750779748f, 0.309842825f},
-std::array<float,2>{0.117119126f, 0.92389977f},
-std::array<float,2>{0.337776989f, 0.409540892f},
-std::array<float,2>{0.72498405f, 0.821413696f},
-std::array<float,2>{0.891511858f, 0.0113516012f},
-std::array<float,2>{0.236106932f, 0.68495661f},
-std::array<float,2>{0.08001481f, 0.166802004f},
-std::array<float,2>{0.799145043f, 0.514938712f},
-std::array<float,2>{0.534317374f, 0.353475958f},
-std::array<float,2>{0.375704885f, 0.974620938f},
-std::array<float,2>{0.167622015f, 0.258731663f},
-std::array<float,2>{0.945784688f, 0.894644141f},
-std::array<float,2>{0.657487333f, 0.22412689f},
-std::array<float,2>{0.294603378f, 0.59771204f},
-std::array<float,2>{0.483965576f, 0.120416969f},
-std::array<float,2>{0.592172205f, 0.705615997f},
-std::array<float,2>{0.813485503f, 0.472476602f},
-std::array<float,2>{0.0354944542f, 0.791082859f},
-std::array<float,2>{0.422547907f, 0.33484453f},
-std::array<float,2>{0.524742067f, 0.945168197f},
-std::array<float,2>{0.760141969f, 0.151174679f},
-std::array<float,2>{0.118914746f, 0.540067315f},
-std::array<float,2>{0.188063234f, 0.0352349021f},
-std::array<float,2>{0.936762035f, 0.636962354f},
-std::array<float,2>{0.689763248f, 0.401641428f},
-std::array<float,2>{0.354733199f, 0.847546756f},
-std::array<float,2>{0.0198991057f, 0.453279585f},
-std::array<float,2>{0.865781426f, 0.778437793f},
-std::array<float,2>{0.610664666f, 0.083223775f},
-std::array<float,2>{0.462805986f, 0.731697142f},
-std::array<float,2>{0.270530373f, 0.218405709f},
-std::array<float,2>{0.63312602f, 0.567859888f},
-std::array<float,2>{0.993875742f, 0.284675896f},
-std::array<float,2>{0.148870081f, 0.919267654f},
-std::array<float,2>{0.45014149f, 0.496195942f},
-std::array<float,2>{0.606968403f, 0.812040329f},
-std::array<float,2>{0.855398595f, 0.106026202f},
-std::array<float,2>{0.00167748565f, 0.699053586f},
-std::array<float,2>{0.132075027f, 0.248593301f},
-std::array<float,2>{0.972714424f, 0.622154653f},
-std::array<float,2>{0.653821886f, 0.267369747f},
-std::array<float,2>{0.261163473f, 0.877151608f},
-std::array<float,2>{0.100785047f, 0.363216609f},
-std::array<float,2>{0.766786695f, 0.996414125f},
-std::array<float,2>{0.507823586f, 0.183679238f},
-std::array<float,2>{0.416743159f, 0.522054374f},
-std::array<float,2>{0.373831272f, 0.0290158484f},
-std::array<float,2>{0.715278983f, 0.667474985f},
-std::array<float,2>{0.921025753f, 0.434665531f},
-std::array<float,2>{0.207129627f, 0.831740379f},
-std::array<float,2>{0.306424677f, 0.308240086f},
-std::array<float,2>{0.686534941f, 0.927999318f},
-std::array<float,2>{0.959515274f, 0.19829379f},
-std::array<float,2>{0.184512988f, 0.593269944f},
-std::array<float,2>{0.0483560488f, 0.0768516585f},
-std::array<float,2>{0.832340419f, 0.742649734f},
-std::array<float,2>{0.56250757f, 0.448868096f},
-std::array<float,2>{0.499618024f, 0.765402734f},
-std::array<float,2>{0.221538007f, 0.385763317f},
-std::array<float,2>{0.889889538f, 0.863947272f},
-std::array<float,2>{0.73961091f, 0.0517696962f},
-std::array<float,2>{0.320507586f, 0.650180519f},
-std::array<float,2>{0.393994451f, 0.126017779f},
-std::array<float,2>{0.55288595f, 0.548767269f},
-std::array<float,2>{0.781841576f, 0.317199171f},
-std::array<float,2>{0.0718898624f, 0.968581557f},
-std::array<float,2>{0.256588995f, 0.444121987f},
-std::array<float,2>{0.641887844f, 0.754534066f},
-std::array<float,2>{0.977351964f, 0.0625751838f},
-std::array<float,2>{0.137151808f, 0.741436005f},
-std::array<float,2>{0.0131699266f, 0.190502718f},
-std::array<float,2>{0.84918344f, 0.585000813f},
-std::array<float,2>{0.596426487f, 0.301288098f},
-std::array<float,2>{0.438329667f, 0.936070979f},
-std::array<float,2>{0.213405266f, 0.326902062f},
-std::array<float,2>{0.913663626f, 0.958295286f},
-std::array<float,2>{0.710026681f, 0.134291887f},
-std::array<float,2>{0.361736894f, 0.555415928f},
-std::array<float,2>{0.410822481f, 0.0609320886f},
-std::array<float,2>{0.503410578f, 0.644711554f},
-std::array<float,2>{0.780325472f, 0.379302353f},
-std::array<float,2>{0.107038386f, 0.868974149f},
-std::array<float,2>{0.485199422f, 0.273889065f},
-std::array<float,2>{0.576891184f, 0.884711444f},
-std::array<float,2>{0.838839471f, 0.237318546f},
-std::array<float,2>{0.0547980331f, 0.609681308f},
-std::array<float,2>{0.179120541f, 0.100217178f},
-std::array<float,2>{0.967445195f, 0.689864159f},
-std::array<float,2>{0.676828444f, 0.485355973f},
-std::array<float,2>{0.300721139f, 0.798823953f},
-std::array<float,2>{0.0674403235f, 0.428612888f},
-std::array<float,2>{0.79447192f, 0.840343058f},
-std::array<float,2>{0.556073546f, 0.0214763135f},
-std::array<float,2>{0.399952143f, 0.658454955f},
-std::array<float,2>{0.314487547f, 0.1787498f},
-std::array<float,2>{0.745158911f, 0.530613363f},
-std::array<float,2>{0.877295732f, 0.368429482f},
-std::array<float,2>{0.226987779f, 0.984900653f},
-std::array<float,2>{0.384747505f, 0.390780061f},
-std::array<float,2>{0.545407414f, 0.852468014f},
-std::array<float,2>{0.809616506f, 0.0443261452f},
-std::array<float,2>{0.0914086848f, 0.627024829f},
-std::array<float,2>{0.249720469f, 0.147167102f},
-std::array<float,2>{0.901162505f, 0.534904718f},
-std::array<float,2>{0.727377474f, 0.340123445f},
-std::array<float,2>{0.329596967f, 0.952011645f},
-std::array<float,2>{0.0422679484f, 0.290414453f},
-std::array<float,2>{0.823750913f, 0.911945105f},
-std::array<float,2>{0.583768725f, 0.2101634f},
-std::array<float,2>{0.474256814f, 0.570630908f},
-std::array<float,2>{0.283087015f, 0.0915842131f},
-std::array<float,2>{0.667607427f, 0.719865501f},
-std::array<float,2>{0.944581389f, 0.462976813f},
-std::array<float,2>{0.163619563f, 0.769348621f},
-std::array<float,2>{0.347096384f, 0.348081291f},
-std::array<float,2>{0.698746622f, 0.983494401f},
-std::array<float,2>{0.926425219f, 0.156684086f},
-std::array<float,2>{0.198872104f, 0.504121482f},
-std::array<float,2>{0.113196805f, 0.00613537058f},
-std::array<float,2>{0.756139755f, 0.679121733f},
-std::array<float,2>{0.521938503f, 0.416735828f},
-std::array<float,2>{0.435471416f, 0.816665351f},
-std::array<float,2>{0.141429752f, 0.478665024f},
-std::array<float,2>{0.98608166f, 0.783364475f},
-std::array<float,2>{0.628379047f, 0.110334486f},
-std::array<float,2>{0.273798794f, 0.713432312f},
-std::array<float,2>{0.45670718f, 0.228497669f},
-std::array<float,2>{0.620033383f, 0.602470875f},
-std::array<float,2>{0.867834449f, 0.252233058f},
-std::array<float,2>{0.0247788224f, 0.906184971f},
-std::array<float,2>{0.266797662f, 0.425314516f},
-std::array<float,2>{0.640141785f, 0.838874578f},
-std::array<float,2>{0.999519527f, 0.0184480883f},
-std::array<float,2>{0.152708635f, 0.66330266f},
-std::array<float,2>{0.0177287143f, 0.174197778f},
-std::array<float,2>{0.861830115f, 0.524936974f},
-std::array<float,2>{0.614884734f, 0.374820083f},
-std::array<float,2>{0.466904223f, 0.991495967f},
-std::array<float,2>{0.194571927f, 0.278607965f},
-std::array<float,2>{0.93079555f, 0.888215005f},
-std::array<float,2>{0.695167065f, 0.240700707f},
-std::array<float,2>{0.35843569f, 0.614340961f},
-std::array<float,2>{0.429063767f, 0.0956415683f},
-std::array<float,2>{0.530377924f, 0.692191362f},
-std::array<float,2>{0.764933467f, 0.489622712f},
-std::array<float,2>{0.121818237f, 0.804190159f},
-std::array<float,2>{0.477661908f, 0.323478639f},
-std::array<float,2>{0.586890399f, 0.954730809f},
-std::array<float,2>{0.817014694f, 0.137795806f},
-std::array<float,2>{0.0322740525f, 0.560936213f},
-std::array<float,2>{0.168852538f, 0.056812074f},
-std::array<float,2>{0.952112436f, 0.642142117f},
-std::array<float,2>{0.663279831f, 0.377261907f},
-std::array<float,2>{0.290097117f, 0.873164117f},
-std::array<float,2>{0.0837632045f, 0.437758625f},
-std::array<float,2>{0.804555118f, 0.753042459f},
-std::array<float,2>{0.536670268f, 0.0694807395f},
-std::array<float,2>{0.379840046f, 0.735606253f},
-std::array<float,2>{0.342352927f, 0.193731248f},
-std::array<float,2>{0.722607911f, 0.580546975f},
-std::array<float,2>{0.897610784f, 0.300457597f},
-std::array<float,2>{0.24195464f, 0.931150913f},
-std::array<float,2>{0.395584285f, 0.482437044f},
-std::array<float,2>{0.54925549f, 0.787004232f},
-std::array<float,2>{0.788320899f, 0.115941867f},
-std::array<float,2>{0.0766685233f, 0.718131959f},
-std::array<float,2>{0.2248362f, 0.231856778f},
-std::array<float,2>{0.885618031f, 0.606159091f},
-std::array<float,2>{0.734512091f, 0.254768491f},
-std::array<float,2>{0.327257812f, 0.900040448f},
-std::array<float,2>{0.0522585995f, 0.346963197f},
-std::array<float,2>{0.830330253f, 0.979739308f},
-std::array<float,2>{0.570198238f, 0.161949992f},
-std::array<float,2>{0.493354559f, 0.503328145f},
-std::array<float,2>{0.310096234f, 0.00196354999f},
-std::array<float,2>{0.681349933f, 0.673324883f},
-std::array<float,2>{0.954283714f, 0.419378817f},
-std::array<float,2>{0.179819942f, 0.814136386f},
-std::array<float,2>{0.369157284f, 0.294800907f},
-std::array<float,2>{0.713967562f, 0.908335328f},
-std::array<float,2>{0.916319549f, 0.20519942f},
-std::array<float,2>{0.206322446f, 0.575565994f},
-std::array<float,2>{0.094851397f, 0.0874437392f},
-std::array<float,2>{0.769588947f, 0.725260258f},
-std::array<float,2>{0.514060318f, 0.46599403f},
-std::array<float,2>{0.418117493f, 0.771705091f},
-std::array<float,2>{0.127088636f, 0.394975036f},
-std::array<float,2>{0.969754875f, 0.858875036f},
-std::array<float,2>{0.649647593f, 0.0420842692f},
-std::array<float,2>{0.263828456f, 0.631341398f},
-std::array<float,2>{0.44578144f, 0.143690914f},
-std::array<float,2>{0.604712725f, 0.535990417f},
-std::array<float,2>{0.857388854f, 0.339581013f},
-std::array<float,2>{0.00578403706f, 0.945709169f},
-std::array<float,2>{0.316766024f, 0.459877431f},
-std::array<float,2>{0.746975362f, 0.774688065f},
-std::array<float,2>{0.87899667f, 0.0813655555f},
-std::array<float,2>{0.233140543f, 0.726830363f},
-std::array<float,2>{0.0632791296f, 0.212290883f},
-std::array<float,2>{0.789085686f, 0.565574408f},
-std::array<float,2>{0.559604108f, 0.288119376f},
-std::array<float,2>{0.4055022f, 0.914689064f},
-std::array<float,2>{0.173675701f, 0.330053598f},
-std::array<float,2>{0.962281287f, 0.93785125f},
-std::array<float,2>{0.674265921f, 0.153521717f},
-std::array<float,2>{0.303136468f, 0.54584372f},
-std::array<float,2>{0.490927368f, 0.0346445963f},
-std::array<float,2>{0.572752297f, 0.635995507f},
-std::array<float,2>{0.840591967f, 0.403570682f},
-std::array<float,2>{0.0606838055f, 0.850694418f},
-std::array<float,2>{0.409148335f, 0.261912256f},
-std::array<float,2>{0.504418254f, 0.891097248f},
-std::array<float,2>{0.775843382f, 0.220379025f},
-std::array<float,2>{0.104972832f, 0.594356477f},
-std::array<float,2>{0.215843871f, 0.123484664f},
-std::array<float,2>{0.908278704f, 0.707214415f},
-std::array<float,2>{0.705167353f, 0.475275099f},
-std::array<float,2>{0.366675913f, 0.79327935f},
-std::array<float,2>{0.0102174189f, 0.414062381f},
-std::array<float,2>{0.844621956f, 0.82586354f},
-std::array<float,2>{0.597883224f, 0.0145021016f},
-std::array<float,2>{0.441754639f, 0.680343568f},
-std::array<float,2>{0.252255619f, 0.168515414f},
-std::array<float,2>{0.645088613f, 0.508938551f},
-std::array<float,2>{0.981245995f, 0.357277215f},
-std::array<float,2>{0.132871553f, 0.97097379f},
-std::array<float,2>{0.457787603f, 0.38930589f},
-std::array<float,2>{0.623519778f, 0.862174094f},
-std::array<float,2>{0.872446299f, 0.0499919988f},
-std::array<float,2>{0.0311433524f, 0.65410471f},
-std::array<float,2>{0.148255676f, 0.132377386f},
-std::array<float,2>{0.991253495f, 0.554403007f},
-std::array<float,2>{0.6312415f, 0.313420624f},
-std::array<float,2>{0.2790066f, 0.963281274f},
-std::array<float,2>{0.114998199f, 0.311909854f},
-std::array<float,2>{0.753779233f, 0.923804462f},
-std::array<float,2>{0.518826246f, 0.202657953f},
-std::array<float,2>{0.433304727f, 0.588806808f},
-std::array<float,2>{0.348840803f, 0.0727174208f},
-std::array<float,2>{0.700610399f, 0.747070193f},
-std::array<float,2>{0.923802435f, 0.452251345f},
-std::array<float,2>{0.199435309f, 0.761650085f},
-std::array<float,2>{0.285446882f, 0.363525838f},
-std::array<float,2>{0.671858609f, 0.993634462f},
-std::array<float,2>{0.940398932f, 0.181057066f},
-std::array<float,2>{0.159004629f, 0.515994728f},
-std::array<float,2>{0.0438447855f, 0.0247730501f},
-std::array<float,2>{0.827877641f, 0.670054138f},
-std::array<float,2>{0.578598499f, 0.431712657f},
-std::array<float,2>{0.471423566f, 0.832627356f},
-std::array<float,2>{0.243833244f, 0.492654681f},
-std::array<float,2>{0.904443264f, 0.808229327f},
-std::array<float,2>{0.733369708f, 0.102764621f},
-std::array<float,2>{0.333294421f, 0.699415803f},
-std::array<float,2>{0.387826115f, 0.243230537f},
-std::array<float,2>{0.541183233f, 0.617579758f},
-std::array<float,2>{0.807904184f, 0.272249609f},
-std::array<float,2>{0.0874426961f, 0.880810618f},
-std::array<float,2>{0.353512198f, 0.399030179f},
-std::array<float,2>{0.687926888f, 0.84456569f},
-std::array<float,2>{0.934750676f, 0.0373244695f},
-std::array<float,2>{0.190425992f, 0.639079273f},
-std::array<float,2>{0.120052762f, 0.150173739f},
-std::array<float,2>{0.758180439f, 0.541847885f},
-std::array<float,2>{0.526497185f, 0.332900554f},
-std::array<float,2>{0.424601048f, 0.942521095f},
-std::array<float,2>{0.151358098f, 0.28125903f},
-std::array<float,2>{0.994778275f, 0.921720862f},
-std::array<float,2>{0.636210084f, 0.216456816f},
-std::array<float,2>{0.271488488f, 0.568979561f},
-std::array<float,2>{0.463024288f, 0.0844620019f},
-std::array<float,2>{0.611600339f, 0.734243155f},
-std::array<float,2>{0.8636989f, 0.455393344f},
-std::array<float,2>{0.0223382283f, 0.779848695f},
-std::array<float,2>{0.377789915f, 0.354511052f},
-std::array<float,2>{0.532344699f, 0.972760975f},
-std::array<float,2>{0.798517942f, 0.164415345f},
-std::array<float,2>{0.0814660937f, 0.512095928f},
-std::array<float,2>{0.236586198f, 0.00856802147f},
-std::array<float,2>{0.894250095f, 0.686163485f},
-std::array<float,2>{0.724106491f, 0.407596707f},
-std::array<float,2>{0.338040829f, 0.823321104f},
-std::array<float,2>{0.0382788777f, 0.469003677f},
-std::array<float,2>{0.815762639f, 0.790687025f},
-std::array<float,2>{0.590226054f, 0.11729487f},
-std::array<float,2>{0.482235581f, 0.703472912f},
-std::array<float,2>{0.296522021f, 0.225621313f},
-std::array<float,2>{0.659502149f, 0.600070834f},
-std::array<float,2>{0.947866976f, 0.260349512f},
-std::array<float,2>{0.165782362f, 0.897924185f},
-std::array<float,2>{0.497992307f, 0.445974112f},
-std::array<float,2>{0.565387487f, 0.762745917f},
-std::array<float,2>{0.834422529f, 0.0744981542f},
-std::array<float,2>{0.0499051102f, 0.745407224f},
-std::array<float,2>{0.186258212f, 0.196033746f},
-std::array<float,2>{0.957830966f, 0.590536714f},
-std::array<float,2>{0.684270203f, 0.306143194f},
-std::array<float,2>{0.306921691f, 0.926816463f},
-std::array<float,2>{0.0738151595f, 0.319538951f},
-std::array<float,2>{0.784273863f, 0.965117753f},
-std::array<float,2>{0.552418828f, 0.128903732f},
-std::array<float,2>{0.39106217f, 0.548889458f},
-std::array<float,2>{0.323857129f, 0.0542400405f},
-std::array<float,2>{0.741018772f, 0.651580036f},
-std::array<float,2>{0.887097776f, 0.384365797f},
-std::array<float,2>{0.22045663f, 0.866277516f},
-std::array<float,2>{0.258545756f, 0.268122047f},
-std::array<float,2>{0.656155825f, 0.875993967f},
-std::array<float,2>{0.975354016f, 0.247877285f},
-std::array<float,2>{0.130850345f, 0.624258101f},
-std::array<float,2>{0.00352391601f, 0.10793753f},
-std::array<float,2>{0.851747632f, 0.696775794f},
-std::array<float,2>{0.608641207f, 0.498986244f},
-std::array<float,2>{0.452438682f, 0.809854209f},
-std::array<float,2>{0.210259259f, 0.43557477f},
-std::array<float,2>{0.918203592f, 0.829657435f},
-std::array<float,2>{0.717141032f, 0.0293104071f},
-std::array<float,2>{0.371860176f, 0.66464138f},
-std::array<float,2>{0.414099991f, 0.187056527f},
-std::array<float,2>{0.509894371f, 0.520531833f},
-std::array<float,2>{0.767894864f, 0.360473275f},
-std::array<float,2>{0.0977076069f, 0.998157084f},
-std::array<float,2>{0.297115624f, 0.487415522f},
-std::array<float,2>{0.679418683f, 0.799653292f},
-std::array<float,2>{0.96536839f, 0.0987772718f},
-std::array<float,2>{0.177249819f, 0.688188016f},
-std::array<float,2>{0.0584725291f, 0.234933197f},
-std::array<float,2>{0.836501777f, 0.611439526f},
-std::array<float,2>{0.576104403f, 0.275726169f},
-std::array<float,2>{0.486839831f, 0.88642323f},
-std::array<float,2>{0.230108827f, 0.369146615f},
-std::array<float,2>{0.87580502f, 0.986511886f},
-std::array<float,2>{0.743819833f, 0.176984698f},
-std::array<float,2>{0.31373769f, 0.527554154f},
-std::array<float,2>{0.400759488f, 0.0221415814f},
-std::array<float,2>{0.558148026f, 0.657075167f},
-std::array<float,2>{0.795989096f, 0.426382244f},
-std::array<float,2>{0.0700928718f, 0.842335165f},
-std::array<float,2>{0.43950507f, 0.304045618f},
-std::array<float,2>{0.595683455f, 0.933880985f},
-std::array<float,2>{0.84969908f, 0.189357862f},
-std::array<float,2>{0.0154993134f, 0.583655536f},
-std::array<float,2>{0.139188364f, 0.0657601058f},
-std::array<float,2>{0.980093479f, 0.739857078f},
-std::array<float,2>{0.643850803f, 0.442670286f},
-std::array<float,2>{0.255329043f, 0.755966425f},
-std::array<float,2>{0.10867466f, 0.381769925f},
-std::array<float,2>{0.777381122f, 0.869468987f},
-std::array<float,2>{0.501772463f, 0.0602561161f},
-std::array<float,2>{0.413436264f, 0.646739841f},
-std::array<float,2>{0.360580504f, 0.134814844f},
-std::array<float,2>{0.70887512f, 0.557343066f},
-std::array<float,2>{0.910929263f, 0.325667858f},
-std::array<float,2>{0.211420059f, 0.960857511f},
-std::array<float,2>{0.43565464f, 0.415843636f},
-std::array<float,2>{0.520870745f, 0.819100201f},
-std::array<float,2>{0.755013883f, 0.00432303175f},
-std::array<float,2>{0.109598964f, 0.676838994f},
-std::array<float,2>{0.196096554f, 0.15848583f},
-std::array<float,2>{0.928856015f, 0.50620079f},
-std::array<float,2>{0.695343077f, 0.351208866f},
-std::array<float,2>{0.344349027f, 0.980478525f},
-std::array<float,2>{0.0264423806f, 0.250453591f},
-std::array<float,2>{0.870656848f, 0.903614759f},
-std::array<float,2>{0.618536532f, 0.230073601f},
-std::array<float,2>{0.455015063f, 0.604239047f},
-std::array<float,2>{0.276176482f, 0.112373151f},
-std::array<float,2>{0.625523865f, 0.711059749f},
-std::array<float,2>{0.986577392f, 0.477203846f},
-std::array<float,2>{0.143921345f, 0.781496286f},
-std::array<float,2>{0.330989033f, 0.343085825f},
-std::array<float,2>{0.728584588f, 0.950433373f},
-std::array<float,2>{0.899119616f, 0.145894453f},
-std::array<float,2>{0.247633249f, 0.532865047f},
-std::array<float,2>{0.0930558294f, 0.0451121479f},
-std::array<float,2>{0.811392963f, 0.625174403f},
-std::array<float,2>{0.543345869f, 0.392587692f},
-std::array<float,2>{0.385802627f, 0.853967905f},
-std::array<float,2>{0.161629796f, 0.46137467f},
-std::array<float,2>{0.943134367f, 0.766481757f},
-std::array<float,2>{0.66489774f, 0.0932682082f},
-std::array<float,2>{0.283625931f, 0.720797479f},
-std::array<float,2>{0.47484827f, 0.207995579f},
-std::array<float,2>{0.585760117f, 0.572376609f},
-std::array<float,2>{0.820923865f, 0.292909145f},
-std::array<float,2>{0.0400352851f, 0.913319647f},
-std::array<float,2>{0.265606225f, 0.397462815f},
-std::array<float,2>{0.649185479f, 0.855901778f},
-std::array<float,2>{0.969133258f, 0.0401610546f},
-std::array<float,2>{0.128486618f, 0.630103707f},
-std::array<float,2>{0.00472359732f, 0.141322568f},
-std::array<float,2>{0.856238067f, 0.537763119f},
-std::array<float,2>{0.604016781f, 0.337396175f},
-std::array<float,2>{0.447004735f, 0.948190272f},
-std::array<float,2>{0.205990881f, 0.296042532f},
-std::array<float,2>{0.917371273f, 0.907691777f},
-std::array<float,2>{0.713726878f, 0.204645112f},
-std::array<float,2>{0.371006906f, 0.576541662f},
-std::array<float,2>{0.419852823f, 0.0898371637f},
-std::array<float,2>{0.515398026f, 0.724603236f},
-std::array<float,2>{0.771032691f, 0.467975438f},
-std::array<float,2>{0.0938305855f, 0.771442413f},
-std::array<float,2>{0.492432594f, 0.34548068f},
-std::array<float,2>{0.568917334f, 0.977830946f},
-std::array<float,2>{0.83192718f, 0.163083225f},
-std::array<float,2>{0.0508733615f, 0.500962555f},
-std::array<float,2>{0.18118073f, 0.00147733698f},
-std::array<float,2>{0.953382671f, 0.674098611f},
-std::array<float,2>{0.679887474f, 0.42097038f},
-std::array<float,2>{0.30937174f, 0.814755499f},
-std::array<float,2>{0.0772674754f, 0.480944216f},
-std::array<float,2>{0.787428916f, 0.788346052f},
-std::array<float,2>{0.550250471f, 0.115102403f},
-std::array<float,2>{0.395115584f, 0.715452075f},
-std::array<float,2>{0.326471657f, 0.233231559f},
-std::array<float,2>{0.735800028f, 0.60841161f},
-std::array<float,2>{0.88632977f, 0.257015288f},
-std::array<float,2>{0.225890383f, 0.900534332f},
-std::array<float,2>{0.379921824f, 0.440229952f},
-std::array<float,2>{0.535452902f, 0.751625299f},
-std::array<float,2>{0.803612173f, 0.0678512156f},
-std::array<float,2>{0.0829238743f, 0.73726064f},
-std::array<float,2>{0.240304887f, 0.191756934f},
-std::array<float,2>{0.897415578f, 0.579784572f},
-std::array<float,2>{0.721321225f, 0.297846526f},
-std::array<float,2>{0.343230903f, 0.932768524f},
-std::array<float,2>{0.0319735892f, 0.320687085f},
-std::array<float,2>{0.817484498f, 0.95599997f},
-std::array<float,2>{0.587543368f, 0.139772639f},
-std::array<float,2>{0.477215946f, 0.559414089f},
-std::array<float,2>{0.289602131f, 0.055371128f},
-std::array<float,2>{0.662199974f, 0.643211126f},
-std::array<float,2>{0.952988744f, 0.376938075f},
-std::array<float,2>{0.16926986f, 0.872778177f},
-std::array<float,2>{0.357771665f, 0.2797499f},
-std::array<float,2>{0.693846762f, 0.888775826f},
-std::array<float,2>{0.93038255f, 0.239271909f},
-std::array<float,2>{0.193459794f, 0.61572367f},
-std::array<float,2>{0.122908153f, 0.0962731615f},
-std::array<float,2>{0.764575005f, 0.693539083f},
-std::array<float,2>{0.53001219f, 0.490309656f},
-std::array<float,2>{0.427857876f, 0.801097631f},
-std::array<float,2>{0.153762877f, 0.421967655f},
-std::array<float,2>{0.998143613f, 0.837215602f},
-std::array<float,2>{0.638732016f, 0.0159144569f},
-std::array<float,2>{0.266436398f, 0.661733925f},
-std::array<float,2>{0.468462735f, 0.172657907f},
-std::array<float,2>{0.613536358f, 0.525442779f},
-std::array<float,2>{0.862779737f, 0.371273726f},
-std::array<float,2>{0.0193981528f, 0.989110708f},
-std::array<float,2>{0.332144767f, 0.495906979f},
-std::array<float,2>{0.733423412f, 0.806588233f},
-std::array<float,2>{0.906027555f, 0.103630446f},
-std::array<float,2>{0.242542237f, 0.703032196f},
-std::array<float,2>{0.0867670104f, 0.24451825f},
-std::array<float,2>{0.807030141f, 0.620614171f},
-std::array<float,2>{0.542397797f, 0.270505905f},
-std::array<float,2>{0.386856288f, 0.881070256f},
-std::array<float,2>{0.159754425f, 0.366450846f},
-std::array<float,2>{0.940440893f, 0.99537468f},
-std::array<float,2>{0.670492887f, 0.183055863f},
-std::array<float,2>{0.286264598f, 0.518211126f},
-std::array<float,2>{0.472476512f, 0.0259223636f},
-std::array<float,2>{0.579749644f, 0.669732571f},
-std::array<float,2>{0.827055454f, 0.429852933f},
-std::array<float,2>{0.0439947061f, 0.835657895f},
-std::array<float,2>{0.43171367f, 0.30940485f},
-std::array<float,2>{0.518427372f, 0.92525661f},
-std::array<float,2>{0.752637386f, 0.200047404f},
-std::array<float,2>{0.113561951f, 0.586273253f},
-std::array<float,2>{0.200852692f, 0.0704963952f},
-std::array<float,2>{0.922071159f, 0.748619378f},
-std::array<float,2>{0.699872911f, 0.449586242f},
-std::array<float,2>{0.347973824f, 0.758889377f},
-std::array<float,2>{0.0295218043f, 0.38746053f},
-std::array<float,2>{0.87179774f, 0.860299349f},
-std::array<float,2>{0.62412405f, 0.0483666547f},
-std::array<float,2>{0.458950907f, 0.655411839f},
-std::array<float,2>{0.277722448f, 0.130369723f},
-std::array<float,2>{0.63236326f, 0.551407039f},
-std::array<float,2>{0.9911623f, 0.314917922f},
-std::array<float,2>{0.147314638f, 0.962404966f},
-std::array<float,2>{0.442480028f, 0.411643177f},
-std::array<float,2>{0.598724425f, 0.827156842f},
-std::array<float,2>{0.844877601f, 0.0134582007f},
-std::array<float,2>{0.0116977729f, 0.681703866f},
-std::array<float,2>{0.13435702f, 0.170806423f},
-std::array<float,2>{0.982228279f, 0.511362612f},
-std::array<float,2>{0.645787179f, 0.357926816f},
-std::array<float,2>{0.253408998f, 0.968759477f},
-std::array<float,2>{0.1044292f, 0.264623255f},
-std::array<float,2>{0.776624143f, 0.89347446f},
-std::array<float,2>{0.505371332f, 0.221571624f},
-std::array<float,2>{0.409966439f, 0.596584797f},
-std::array<float,2>{0.365659982f, 0.121800117f},
-std::array<float,2>{0.707002223f, 0.709288955f},
-std::array<float,2>{0.910089791f, 0.473825812f},
-std::array<float,2>{0.215750068f, 0.795879126f},
-std::array<float,2>{0.30468294f, 0.330228597f},
-std::array<float,2>{0.675594687f, 0.940522194f},
-std::array<float,2>{0.961060703f, 0.155613989f},
-std::array<float,2>{0.171894595f, 0.543391764f},
-std::array<float,2>{0.061859522f, 0.0316438973f},
-std::array<float,2>{0.84130615f, 0.634473026f},
-std::array<float,2>{0.573951781f, 0.405575126f},
-std::array<float,2>{0.491499275f, 0.848368585f},
-std::array<float,2>{0.233948842f, 0.458630472f},
-std::array<float,2>{0.880063474f, 0.776948214f},
-std::array<float,2>{0.7475366f, 0.0797437355f},
-std::array<float,2>{0.317704499f, 0.730374277f},
-std::array<float,2>{0.404382467f, 0.212901458f},
-std::array<float,2>{0.558903217f, 0.563631058f},
-std::array<float,2>{0.790249527f, 0.285583377f},
-std::array<float,2>{0.0642172843f, 0.916092277f},
-std::array<float,2>{0.372696549f, 0.433827072f},
-std::array<float,2>{0.718679547f, 0.830415249f},
-std::array<float,2>{0.919734895f, 0.0278626494f},
-std::array<float,2>{0.209245563f, 0.666039526f},
-std::array<float,2>{0.0995287895f, 0.185267255f},
-std::array<float,2>{0.768606067f, 0.522714138f},
-std::array<float,2>{0.511290133f, 0.361891776f},
-std::array<float,2>{0.415202081f, 0.998000383f},
-std::array<float,2>{0.128934398f, 0.26569289f},
-std::array<float,2>{0.975908041f, 0.878782094f},
-std::array<float,2>{0.65455544f, 0.249301136f},
-std::array<float,2>{0.259170681f, 0.621694267f},
-std::array<float,2>{0.451829672f, 0.106595382f},
-std::array<float,2>{0.608303249f, 0.697889388f},
-std::array<float,2>{0.853051901f, 0.497113824f},
-std::array<float,2>{0.00205309573f, 0.810719371f},
-std::array<float,2>{0.392400593f, 0.317703843f},
-std::array<float,2>{0.55120188f, 0.966806769f},
-std::array<float,2>{0.784014285f, 0.125851035f},
-std::array<float,2>{0.0726875886f, 0.547734618f},
-std::array<float,2>{0.218864515f, 0.0509808473f},
-std::array<float,2>{0.888576806f, 0.648672521f},
-std::array<float,2>{0.741606116f, 0.385292828f},
-std::array<float,2>{0.322414249f, 0.865210474f},
-std::array<float,2>{0.0492576472f, 0.448149025f},
-std::array<float,2>{0.835731387f, 0.763823032f},
-std::array<float,2>{0.565579951f, 0.0776456296f},
-std::array<float,2>{0.496247828f, 0.743249416f},
-std::array<float,2>{0.308215559f, 0.197641134f},
-std::array<float,2>{0.685227096f, 0.591993332f},
-std::array<float,2>{0.958455741f, 0.306869298f},
-std::array<float,2>{0.186583444f, 0.929105282f},
-std::array<float,2>{0.480588138f, 0.470874578f},
-std::array<float,2>{0.591634929f, 0.792713404f},
-std::array<float,2>{0.814494193f, 0.120081104f},
-std::array<float,2>{0.0377944112f, 0.706546605f},
-std::array<float,2>{0.164275497f, 0.223303497f},
-std::array<float,2>{0.948430598f, 0.599180698f},
-std::array<float,2>{0.659081101f, 0.259745598f},
-std::array<float,2>{0.295708209f, 0.896455884f},
-std::array<float,2>{0.0809628814f, 0.352303326f},
-std::array<float,2>{0.797018588f, 0.976002932f},
-std::array<float,2>{0.531982601f, 0.167132288f},
-std::array<float,2>{0.378088951f, 0.514141023f},
-std::array<float,2>{0.339191258f, 0.0105502447f},
-std::array<float,2>{0.723465085f, 0.683703601f},
-std::array<float,2>{0.893051505f, 0.408294797f},
-std::array<float,2>{0.238047689f, 0.820736885f},
-std::array<float,2>{0.272650599f, 0.283279985f},
-std::array<float,2>{0.635475218f, 0.918715f},
-std::array<float,2>{0.99541682f, 0.217319682f},
-std::array<float,2>{0.151486337f, 0.5672279f},
-std::array<float,2>{0.0227183271f, 0.0829270706f},
-std::array<float,2>{0.864650249f, 0.730939686f},
-std::array<float,2>{0.61236614f, 0.454956621f},
-std::array<float,2>{0.464362562f, 0.778010547f},
-std::array<float,2>{0.19092913f, 0.400914937f},
-std::array<float,2>{0.934542537f, 0.846444488f},
-std::array<float,2>{0.688595176f, 0.0365477912f},
-std::array<float,2>{0.352237165f, 0.638072789f},
-std::array<float,2>{0.425753951f, 0.151670605f},
-std::array<float,2>{0.52584058f, 0.539124548f},
-std::array<float,2>{0.758939326f, 0.335758895f},
-std::array<float,2>{0.120782323f, 0.944150448f},
-std::array<float,2>{0.284983069f, 0.464396924f},
-std::array<float,2>{0.665081918f, 0.768358231f},
-std::array<float,2>{0.941795051f, 0.0905917659f},
-std::array<float,2>{0.160920128f, 0.719566226f},
-std::array<float,2>{0.0409624763f, 0.209141642f},
-std::array<float,2>{0.82171613f, 0.571951985f},
-std::array<float,2>{0.584771454f, 0.289067f},
-std::array<float,2>{0.475916803f, 0.910371065f},
-std::array<float,2>{0.24693276f, 0.341304809f},
-std::array<float,2>{0.899909377f, 0.952770591f},
-std::array<float,2>{0.730431139f, 0.148420885f},
-std::array<float,2>{0.331706613f, 0.533342838f},
-std::array<float,2>{0.385340363f, 0.0434882157f},
-std::array<float,2>{0.544689953f, 0.627955377f},
-std::array<float,2>{0.811587512f, 0.391976029f},
-std::array<float,2>{0.0923987776f, 0.85346669f},
-std::array<float,2>{0.453880697f, 0.253151f},
-std::array<float,2>{0.61732012f, 0.904384017f},
-std::array<float,2>{0.86949861f, 0.227107972f},
-std::array<float,2>{0.02556259f, 0.603362024f},
-std::array<float,2>{0.143491939f, 0.111221507f},
-std::array<float,2>{0.987684727f, 0.714710772f},
-std::array<float,2>{0.626496494f, 0.479850203f},
-std::array<float,2>{0.276414841f, 0.784180939f},
-std::array<float,2>{0.1108988f, 0.41709137f},
-std::array<float,2>{0.754640996f, 0.817893863f},
-std::array<float,2>{0.519907176f, 0.00768494513f},
-std::array<float,2>{0.436857879f, 0.678059042f},
-std::array<float,2>{0.345217258f, 0.158101186f},
-std::array<float,2>{0.696354091f, 0.505791843f},
-std::array<float,2>{0.927939832f, 0.349144548f},
-std::array<float,2>{0.19719553f, 0.982821584f},
-std::array<float,2>{0.412483931f, 0.380366206f},
-std::array<float,2>{0.500204086f, 0.867329717f},
-std::array<float,2>{0.778618217f, 0.0623766631f},
-std::array<float,2>{0.107756563f, 0.646292686f},
-std::array<float,2>{0.212648436f, 0.13288489f},
-std::array<float,2>{0.911339581f, 0.555770516f},
-std::array<float,2>{0.707887232f, 0.328052223f},
-std::array<float,2>{0.359519809f, 0.957802594f},
-std::array<float,2>{0.0146445902f, 0.302470922f},
-std::array<float,2>{0.851125181f, 0.936667144f},
-std::array<float,2>{0.594587266f, 0.190122113f},
-std::array<float,2>{0.441211909f, 0.584406555f},
-std::array<float,2>{0.254535556f, 0.0635029078f},
-std::array<float,2>{0.643086255f, 0.740424335f},
-std::array<float,2>{0.97878927f, 0.444830656f},
-std::array<float,2>{0.140603513f, 0.754931152f},
-std::array<float,2>{0.312927932f, 0.368042111f},
-std::array<float,2>{0.742945075f, 0.985978425f},
-std::array<float,2>{0.876065373f, 0.178045914f},
-std::array<float,2>{0.229063109f, 0.530163586f},
-std::array<float,2>{0.0690159127f, 0.0200165417f},
-std::array<float,2>{0.795457661f, 0.659256756f},
-std::array<float,2>{0.556972742f, 0.429065019f},
-std::array<float,2>{0.401765138f, 0.841288984f},
-std::array<float,2>{0.176438227f, 0.484967858f},
-std::array<float,2>{0.966675222f, 0.797607958f},
-std::array<float,2>{0.677800775f, 0.101107605f},
-std::array<float,2>{0.297931463f, 0.690945506f},
-std::array<float,2>{0.487561017f, 0.236519352f},
-std::array<float,2>{0.574295461f, 0.610957325f},
-std::array<float,2>{0.837231398f, 0.275140166f},
-std::array<float,2>{0.0569766872f, 0.883252382f},
-std::array<float,2>{0.312051207f, 0.418491513f},
-std::array<float,2>{0.683152914f, 0.812688172f},
-std::array<float,2>{0.955182195f, 0.00377457356f},
-std::array<float,2>{0.182612285f, 0.672656298f},
-std::array<float,2>{0.0534518883f, 0.161003873f},
-std::array<float,2>{0.82872051f, 0.502348125f},
-std::array<float,2>{0.568181336f, 0.346350819f},
-std::array<float,2>{0.494837314f, 0.979225695f},
-std::array<float,2>{0.223672003f, 0.255475044f},
-std::array<float,2>{0.883014023f, 0.898986101f},
-std::array<float,2>{0.737697303f, 0.230810642f},
-std::array<float,2>{0.324855715f, 0.60737139f},
-std::array<float,2>{0.397747606f, 0.116328321f},
-std::array<float,2>{0.548094571f, 0.716847122f},
-std::array<float,2>{0.785926759f, 0.483461082f},
-std::array<float,2>{0.0756535679f, 0.785537481f},
-std::array<float,2>{0.447316021f, 0.338556647f},
-std::array<float,2>{0.602006912f, 0.946334779f},
-std::array<float,2>{0.857553482f, 0.142930806f},
-std::array<float,2>{0.0071006096f, 0.537037075f},
-std::array<float,2>{0.125673041f, 0.0419121273f},
-std::array<float,2>{0.971944034f, 0.632391334f},
-std::array<float,2>{0.652027905f, 0.395629972f},
-std::array<float,2>{0.262436241f, 0.858344436f},
-std::array<float,2>{0.0964498147f, 0.465317279f},
-std::array<float,2>{0.772431672f, 0.77327913f},
-std::array<float,2>{0.512206852f, 0.0865590125f},
-std::array<float,2>{0.420244128f, 0.726377964f},
-std::array<float,2>{0.367456436f, 0.206682608f},
-std::array<float,2>{0.712443829f, 0.575162292f},
-std::array<float,2>{0.915324986f, 0.293661714f},
-std::array<float,2>{0.20503436f, 0.910138607f},
-std::array<float,2>{0.426395088f, 0.489199668f},
-std::array<float,2>{0.529166698f, 0.803707659f},
-std::array<float,2>{0.762509465f, 0.094300203f},
-std::array<float,2>{0.124392927f, 0.692845166f},
-std::array<float,2>{0.192985386f, 0.242181763f},
-std::array<float,2>{0.932418585f, 0.613901198f},
-std::array<float,2>{0.693147719f, 0.278230101f},
-std::array<float,2>{0.356087506f, 0.887430727f},
-std::array<float,2>{0.015753407f, 0.373343468f},
-std::array<float,2>{0.860179543f, 0.990450203f},
-std::array<float,2>{0.616198242f, 0.174805656f},
-std::array<float,2>{0.466162831f, 0.523801982f},
-std::array<float,2>{0.268888265f, 0.0190987624f},
-std::array<float,2>{0.637650847f, 0.662497401f},
-std::array<float,2>{0.99690181f, 0.42462188f},
-std::array<float,2>{0.156032458f, 0.83854121f},
-std::array<float,2>{0.340444803f, 0.29979524f},
-std::array<float,2>{0.718978465f, 0.930395186f},
-std::array<float,2>{0.896121383f, 0.194404662f},
-std::array<float,2>{0.239391237f, 0.582010746f},
-std::array<float,2>{0.0852114409f, 0.0691936687f},
-std::array<float,2>{0.801165223f, 0.734814405f},
-std::array<float,2>{0.537316859f, 0.439163238f},
-std::array<float,2>{0.381813943f, 0.752704799f},
-std::array<float,2>{0.169978946f, 0.378558457f},
-std::array<float,2>{0.951166391f, 0.874644697f},
-std::array<float,2>{0.660270929f, 0.0582795627f},
-std::array<float,2>{0.291381001f, 0.64098382f},
-std::array<float,2>{0.479191214f, 0.137559593f},
-std::array<float,2>{0.588315308f, 0.561669648f},
-std::array<float,2>{0.819605231f, 0.323154151f},
-std::array<float,2>{0.0341565162f, 0.953172684f},
-std::array<float,2>{0.35007149f, 0.451573908f},
-std::array<float,2>{0.702423275f, 0.760483325f},
-std::array<float,2>{0.924242496f, 0.0736748055f},
-std::array<float,2>{0.201749459f, 0.747282326f},
-std::array<float,2>{0.115680613f, 0.201364756f},
-std::array<float,2>{0.751428127f, 0.589239776f},
-std::array<float,2>{0.516348898f, 0.311486751f},
-std::array<float,2>{0.430561095f, 0.922189116f},
-std::array<float,2>{0.146464244f, 0.313971907f},
-std::array<float,2>{0.988913655f, 0.964639962f},
-std::array<float,2>{0.630634367f, 0.131082758f},
-std::array<float,2>{0.279656708f, 0.553566337f},
-std::array<float,2>{0.460618734f, 0.0493497215f},
-std::array<float,2>{0.622810841f, 0.652818322f},
-std::array<float,2>{0.873945773f, 0.389852047f},
-std::array<float,2>{0.0276813637f, 0.862948179f},
-std::array<float,2>{0.389804184f, 0.272607565f},
-std::array<float,2>{0.540675223f, 0.879499435f},
-std::array<float,2>{0.805948794f, 0.242980763f},
-std::array<float,2>{0.0896161869f, 0.618424833f},
-std::array<float,2>{0.244454771f, 0.102304079f},
-std::array<float,2>{0.903902054f, 0.700445175f},
-std::array<float,2>{0.731545031f, 0.493405372f},
-std::array<float,2>{0.334225208f, 0.80724597f},
-std::array<float,2>{0.0458895676f, 0.433391362f},
-std::array<float,2>{0.824662387f, 0.833283842f},
-std::array<float,2>{0.581491649f, 0.0235212203f},
-std::array<float,2>{0.468756884f, 0.671672463f},
-std::array<float,2>{0.288421988f, 0.179763466f},
-std::array<float,2>{0.669346273f, 0.517057598f},
-std::array<float,2>{0.938514113f, 0.364902079f},
-std::array<float,2>{0.158082664f, 0.992655933f},
-std::array<float,2>{0.490060836f, 0.402976006f},
-std::array<float,2>{0.571652949f, 0.849820614f},
-std::array<float,2>{0.84232074f, 0.0339482948f},
-std::array<float,2>{0.0593324006f, 0.635321319f},
-std::array<float,2>{0.174155533f, 0.152787119f},
-std::array<float,2>{0.962948561f, 0.546854854f},
-std::array<float,2>{0.672823787f, 0.328709155f},
-std::array<float,2>{0.301357776f, 0.93855387f},
-std::array<float,2>{0.0662110373f, 0.287554532f},
-std::array<float,2>{0.791104555f, 0.915457785f},
-std::array<float,2>{0.560804725f, 0.211719319f},
-std::array<float,2>{0.402482301f, 0.564974308f},
-std::array<float,2>{0.319254637f, 0.0807686001f},
-std::array<float,2>{0.748841465f, 0.728358328f},
-std::array<float,2>{0.881767094f, 0.4605048f},
-std::array<float,2>{0.230767101f, 0.774382055f},
-std::array<float,2>{0.25016126f, 0.355980337f},
-std::array<float,2>{0.648102343f, 0.971914053f},
-std::array<float,2>{0.982550919f, 0.169671848f},
-std::array<float,2>{0.135748684f, 0.508603215f},
-std::array<float,2>{0.00848775357f, 0.0155023355f},
-std::array<float,2>{0.846799016f, 0.681529403f},
-std::array<float,2>{0.60055393f, 0.412510782f},
-std::array<float,2>{0.443652004f, 0.824495912f},
-std::array<float,2>{0.217939273f, 0.476496667f},
-std::array<float,2>{0.90793246f, 0.794128239f},
-std::array<float,2>{0.704545319f, 0.124598689f},
-std::array<float,2>{0.363429427f, 0.708845139f},
-std::array<float,2>{0.407850891f, 0.218789324f},
-std::array<float,2>{0.506176829f, 0.595009744f},
-std::array<float,2>{0.774071515f, 0.262791455f},
-std::array<float,2>{0.101742178f, 0.892548919f},
-std::array<float,2>{0.322042853f, 0.382963896f},
-std::array<float,2>{0.738515556f, 0.865822315f},
-std::array<float,2>{0.888862669f, 0.0534938388f},
-std::array<float,2>{0.22217302f, 0.651098967f},
-std::array<float,2>{0.0705683976f, 0.127868608f},
-std::array<float,2>{0.782239318f, 0.550154269f},
-std::array<float,2>{0.554421425f, 0.319219381f},
-std::array<float,2>{0.393150836f, 0.966369629f},
-std::array<float,2>{0.184731692f, 0.305244923f},
-std::array<float,2>{0.960926354f, 0.925845027f},
-std::array<float,2>{0.686422706f, 0.19716616f},
-std::array<float,2>{0.305446506f, 0.59107089f},
-std::array<float,2>{0.499021769f, 0.0761244744f},
-std::array<float,2>{0.564303935f, 0.745036006f},
-std::array<float,2>{0.833185554f, 0.446664929f},
-std::array<float,2>{0.0471356064f, 0.761884511f},
-std::array<float,2>{0.417916745f, 0.360049963f},
-std::array<float,2>{0.50891763f, 0.999203563f},
-std::array<float,2>{0.766380727f, 0.186383083f},
-std::array<float,2>{0.100383662f, 0.520138919f},
-std::array<float,2>{0.208423808f, 0.0304137841f},
-std::array<float,2>{0.920666218f, 0.665762782f},
-std::array<float,2>{0.716463029f, 0.437488019f},
-std::array<float,2>{0.374780983f, 0.828186512f},
-std::array<float,2>{0.000200520386f, 0.499479711f},
-std::array<float,2>{0.854375362f, 0.809017241f},
-std::array<float,2>{0.605507791f, 0.108443111f},
-std::array<float,2>{0.450527668f, 0.69609797f},
-std::array<float,2>{0.260704607f, 0.246653989f},
-std::array<float,2>{0.652420163f, 0.623478889f},
-std::array<float,2>{0.974096298f, 0.269325852f},
-std::array<float,2>{0.131634846f, 0.87555486f},
-std::array<float,2>{0.461136192f, 0.456738561f},
-std::array<float,2>{0.609578371f, 0.780821502f},
-std::array<float,2>{0.867011964f, 0.0853895247f},
-std::array<float,2>{0.021021029f, 0.733394206f},
-std::array<float,2>{0.149883643f, 0.215470836f},
-std::array<float,2>{0.99235338f, 0.569384515f},
-std::array<float,2>{0.634557724f, 0.282293767f},
-std::array<float,2>{0.270280927f, 0.920688212f},
-std::array<float,2>{0.11755459f, 0.333234549f},
-std::array<float,2>{0.761534512f, 0.94165343f},
-std::array<float,2>{0.52436918f, 0.148604318f},
-std::array<float,2>{0.423194557f, 0.542590857f},
-std::array<float,2>{0.354047477f, 0.0381467268f},
-std::array<float,2>{0.690538287f, 0.640252113f},
-std::array<float,2>{0.935801268f, 0.399611652f},
-std::array<float,2>{0.189447001f, 0.845362186f},
-std::array<float,2>{0.293342978f, 0.2609303f},
-std::array<float,2>{0.656388164f, 0.896816432f},
-std::array<float,2>{0.946297348f, 0.225426719f},
-std::array<float,2>{0.166289628f, 0.600888789f},
-std::array<float,2>{0.0363092981f, 0.118978895f},
-std::array<float,2>{0.813183188f, 0.704628885f},
-std::array<float,2>{0.593255162f, 0.469987303f},
-std::array<float,2>{0.483351737f, 0.789951921f},
-std::array<float,2>{0.235045329f, 0.406634629f},
-std::array<float,2>{0.89226824f, 0.822937369f},
-std::array<float,2>{0.726020157f, 0.00928685907f},
-std::array<float,2>{0.336829334f, 0.686971366f},
-std::array<float,2>{0.376657665f, 0.165888011f},
-std::array<float,2>{0.534177125f, 0.513548493f},
-std::array<float,2>{0.800152004f, 0.353728503f},
-std::array<float,2>{0.0790987387f, 0.973734796f},
-std::array<float,2>{0.275121361f, 0.477880388f},
-std::array<float,2>{0.627471328f, 0.782956839f},
-std::array<float,2>{0.984497666f, 0.111415602f},
-std::array<float,2>{0.14214468f, 0.712879777f},
-std::array<float,2>{0.023832893f, 0.228635862f},
-std::array<float,2>{0.868442237f, 0.605098128f},
-std::array<float,2>{0.620296001f, 0.251243085f},
-std::array<float,2>{0.455702841f, 0.903020918f},
-std::array<float,2>{0.19743675f, 0.350301951f},
-std::array<float,2>{0.927651227f, 0.982073784f},
-std::array<float,2>{0.697975218f, 0.16006054f},
-std::array<float,2>{0.345739245f, 0.507035017f},
-std::array<float,2>{0.433620483f, 0.00562747708f},
-std::array<float,2>{0.523436129f, 0.676614165f},
-std::array<float,2>{0.757780135f, 0.414969862f},
-std::array<float,2>{0.111344546f, 0.820172191f},
-std::array<float,2>{0.473080754f, 0.291941583f},
-std::array<float,2>{0.582437694f, 0.912724972f},
-std::array<float,2>{0.822501242f, 0.208152175f},
-std::array<float,2>{0.0410636291f, 0.573995352f},
-std::array<float,2>{0.162619993f, 0.0918230563f},
-std::array<float,2>{0.94426322f, 0.721986175f},
-std::array<float,2>{0.666828096f, 0.462420851f},
-std::array<float,2>{0.282190502f, 0.766916215f},
-std::array<float,2>{0.0899840966f, 0.393737853f},
-std::array<float,2>{0.808827043f, 0.855108023f},
-std::array<float,2>{0.546348155f, 0.0463996492f},
-std::array<float,2>{0.38329643f, 0.626457512f},
-std::array<float,2>{0.328705072f, 0.144592673f},
-std::array<float,2>{0.727602184f, 0.531971991f},
-std::array<float,2>{0.901385784f, 0.342094839f},
-std::array<float,2>{0.248057351f, 0.949268758f},
-std::array<float,2>{0.398717225f, 0.427568734f},
-std::array<float,2>{0.55551374f, 0.843660355f},
-std::array<float,2>{0.793575406f, 0.023307249f},
-std::array<float,2>{0.0668173358f, 0.658056974f},
-std::array<float,2>{0.227896705f, 0.17603004f},
-std::array<float,2>{0.878459454f, 0.528708577f},
-std::array<float,2>{0.745113671f, 0.370676011f},
-std::array<float,2>{0.315731734f, 0.988249362f},
-std::array<float,2>{0.0562849082f, 0.276609659f},
-std::array<float,2>{0.839604676f, 0.885499895f},
-std::array<float,2>{0.577615798f, 0.23535952f},
-std::array<float,2>{0.485565364f, 0.612799942f},
-std::array<float,2>{0.29934141f, 0.0977098867f},
-std::array<float,2>{0.676609218f, 0.689187527f},
-std::array<float,2>{0.967966974f, 0.486669332f},
-std::array<float,2>{0.17791304f, 0.800691724f},
-std::array<float,2>{0.362712145f, 0.324571162f},
-std::array<float,2>{0.709128916f, 0.959822655f},
-std::array<float,2>{0.912578344f, 0.136123046f},
-std::array<float,2>{0.214254916f, 0.558344305f},
-std::array<float,2>{0.106005177f, 0.0588787235f},
-std::array<float,2>{0.77983427f, 0.647703469f},
-std::array<float,2>{0.502260864f, 0.381861627f},
-std::array<float,2>{0.411956519f, 0.870669484f},
-std::array<float,2>{0.138152733f, 0.442171693f},
-std::array<float,2>{0.977806509f, 0.757293344f},
-std::array<float,2>{0.641173482f, 0.0649971068f},
-std::array<float,2>{0.257421553f, 0.738881826f},
-std::array<float,2>{0.438680261f, 0.187648475f},
-std::array<float,2>{0.59760505f, 0.582860172f},
-std::array<float,2>{0.84771353f, 0.303138614f},
-std::array<float,2>{0.0124163991f, 0.935256243f},
-std::array<float,2>{0.300955743f, 0.405909359f},
-std::array<float,2>{0.671950161f, 0.847689748f},
-std::array<float,2>{0.963499129f, 0.0320989341f},
-std::array<float,2>{0.174695194f, 0.633852124f},
-std::array<float,2>{0.0589326471f, 0.156226709f},
-std::array<float,2>{0.841918409f, 0.543740809f},
-std::array<float,2>{0.572122693f, 0.330714762f},
-std::array<float,2>{0.489556193f, 0.94095099f},
-std::array<float,2>{0.231418386f, 0.286100179f},
-std::array<float,2>{0.881164908f, 0.916885734f},
-std::array<float,2>{0.748462617f, 0.213488221f},
-std::array<float,2>{0.318472862f, 0.564437807f},
-std::array<float,2>{0.403095573f, 0.0795325562f},
-std::array<float,2>{0.561075449f, 0.729810774f},
-std::array<float,2>{0.791876972f, 0.458358854f},
-std::array<float,2>{0.0659050494f, 0.776525497f},
-std::array<float,2>{0.444140464f, 0.357528061f},
-std::array<float,2>{0.59971267f, 0.969525516f},
-std::array<float,2>{0.847262383f, 0.170034811f},
-std::array<float,2>{0.0080053946f, 0.511203527f},
-std::array<float,2>{0.136661544f, 0.012706737f},
-std::array<float,2>{0.98327744f, 0.68235451f},
-std::array<float,2>{0.647625804f, 0.411171973f},
-std::array<float,2>{0.250738025f, 0.827674508f},
-std::array<float,2>{0.102252968f, 0.474150509f},
-std::array<float,2>{0.773740351f, 0.79507637f},
-std::array<float,2>{0.506603599f, 0.121404119f},
-std::array<float,2>{0.407451302f, 0.709936917f},
-std::array<float,2>{0.364160627f, 0.221175715f},
-std::array<float,2>{0.704719186f, 0.595991194f},
-std::array<float,2>{0.907259166f, 0.263775676f},
-std::array<float,2>{0.218267843f, 0.892755985f},
-std::array<float,2>{0.429745376f, 0.449864894f},
-std::array<float,2>{0.51571691f, 0.759522319f},
-std::array<float,2>{0.751608908f, 0.0709952042f},
-std::array<float,2>{0.116103187f, 0.748322368f},
-std::array<float,2>{0.201370344f, 0.199523196f},
-std::array<float,2>{0.924598396f, 0.586807966f},
-std::array<float,2>{0.702974916f, 0.308604926f},
-std::array<float,2>{0.350463033f, 0.92552954f},
-std::array<float,2>{0.0278874729f, 0.315054655f},
-std::array<float,2>{0.873199403f, 0.962127268f},
-std::array<float,2>{0.622350335f, 0.130748391f},
-std::array<float,2>{0.460124254f, 0.550785899f},
-std::array<float,2>{0.279936165f, 0.0478918105f},
-std::array<float,2>{0.630192637f, 0.655943573f},
-std::array<float,2>{0.98850596f, 0.386967093f},
-std::array<float,2>{0.145725787f, 0.85954529f},
-std::array<float,2>{0.334810257f, 0.269728303f},
-std::array<float,2>{0.732231557f, 0.881618619f},
-std::array<float,2>{0.90339756f, 0.244777694f},
-std::array<float,2>{0.244773448f, 0.620461404f},
-std::array<float,2>{0.0889587253f, 0.104222268f},
-std::array<float,2>{0.806183696f, 0.702444911f},
-std::array<float,2>{0.540071487f, 0.495393306f},
-std::array<float,2>{0.390141845f, 0.805789471f},
-std::array<float,2>{0.157577351f, 0.430181772f},
-std::array<float,2>{0.939314663f, 0.835407794f},
-std::array<float,2>{0.669912159f, 0.0255888402f},
-std::array<float,2>{0.288794011f, 0.669253588f},
-std::array<float,2>{0.469539613f, 0.183219418f},
-std::array<float,2>{0.581794858f, 0.517874897f},
-std::array<float,2>{0.825090766f, 0.366993517f},
-std::array<float,2>{0.0450147763f, 0.996071994f},
-std::array<float,2>{0.355690211f, 0.491203338f},
-std::array<float,2>{0.692740381f, 0.801597178f},
-std::array<float,2>{0.931658566f, 0.0958020911f},
-std::array<float,2>{0.192835316f, 0.693989635f},
-std::array<float,2>{0.124746583f, 0.239837736f},
-std::array<float,2>{0.762204111f, 0.615280509f},
-std::array<float,2>{0.528538346f, 0.279906988f},
-std::array<float,2>{0.42580846f, 0.889467239f},
-std::array<float,2>{0.155277744f, 0.371667951f},
-std::array<float,2>{0.996095538f, 0.988496125f},
-std::array<float,2>{0.637045979f, 0.172286093f},
-std::array<float,2>{0.269367337f, 0.526124358f},
-std::array<float,2>{0.46678859f, 0.016175041f},
-std::array<float,2>{0.615331531f, 0.661433399f},
-std::array<float,2>{0.859440804f, 0.422489643f},
-std::array<float,2>{0.016519554f, 0.837724924f},
-std::array<float,2>{0.38090089f, 0.297220558f},
-std::array<float,2>{0.538072884f, 0.933247328f},
-std::array<float,2>{0.80171144f, 0.192370504f},
-std::array<float,2>{0.0856605843f, 0.579545379f},
-std::array<float,2>{0.239888132f, 0.0683393478f},
-std::array<float,2>{0.895751297f, 0.736508965f},
-std::array<float,2>{0.719708025f, 0.439897895f},
-std::array<float,2>{0.340123773f, 0.751287758f},
-std::array<float,2>{0.0332645513f, 0.376452565f},
-std::array<float,2>{0.819985867f, 0.872440994f},
-std::array<float,2>{0.588604867f, 0.0549030937f},
-std::array<float,2>{0.478723466f, 0.643002927f},
-std::array<float,2>{0.291657001f, 0.140433177f},
-std::array<float,2>{0.660701394f, 0.558960676f},
-std::array<float,2>{0.950617373f, 0.321251363f},
-std::array<float,2>{0.170652419f, 0.955181301f},
-std::array<float,2>{0.494164884f, 0.421546757f},
-std::array<float,2>{0.567647517f, 0.815167129f},
-std::array<float,2>{0.82812959f, 0.00128253107f},
-std::array<float,2>{0.0530741848f, 0.67465359f},
-std::array<float,2>{0.181691885f, 0.162189767f},
-std::array<float,2>{0.955730259f, 0.500369668f},
-std::array<float,2>{0.682670176f, 0.345158607f},
-std::array<float,2>{0.311588883f, 0.978485107f},
-std::array<float,2>{0.0759620368f, 0.257420987f},
-std::array<float,2>{0.78545922f, 0.90088433f},
-std::array<float,2>{0.548696339f, 0.232836142f},
-std::array<float,2>{0.39803195f, 0.609327912f},
-std::array<float,2>{0.324500769f, 0.114484161f},
-std::array<float,2>{0.737848043f, 0.71511215f},
-std::array<float,2>{0.883664131f, 0.481385767f},
-std::array<float,2>{0.224335015f, 0.788796782f},
-std::array<float,2>{0.261731863f, 0.337530166f},
-std::array<float,2>{0.651567817f, 0.947289288f},
-std::array<float,2>{0.972289801f, 0.140847996f},
-std::array<float,2>{0.125092119f, 0.537589669f},
-std::array<float,2>{0.0073957229f, 0.0405644923f},
-std::array<float,2>{0.858085632f, 0.630505204f},
-std::array<float,2>{0.602483034f, 0.398177654f},
-std::array<float,2>{0.447813869f, 0.856026053f},
-std::array<float,2>{0.204509184f, 0.468660086f},
-std::array<float,2>{0.915928304f, 0.770634413f},
-std::array<float,2>{0.712026358f, 0.0889173001f},
-std::array<float,2>{0.368061453f, 0.724092364f},
-std::array<float,2>{0.420571893f, 0.204447836f},
-std::array<float,2>{0.51265204f, 0.57677722f},
-std::array<float,2>{0.771519721f, 0.29651615f},
-std::array<float,2>{0.0957214311f, 0.908019066f},
-std::array<float,2>{0.316094697f, 0.429624796f},
-std::array<float,2>{0.744540393f, 0.841516614f},
-std::array<float,2>{0.877945542f, 0.0202924423f},
-std::array<float,2>{0.228167921f, 0.660110533f},
-std::array<float,2>{0.0671857148f, 0.178397596f},
-std::array<float,2>{0.79323101f, 0.529318154f},
-std::array<float,2>{0.554837763f, 0.367465496f},
-std::array<float,2>{0.399061382f, 0.985822678f},
-std::array<float,2>{0.178463519f, 0.274751008f},
-std::array<float,2>{0.968342841f, 0.883683741f},
-std::array<float,2>{0.675784767f, 0.237213701f},
-std::array<float,2>{0.299072593f, 0.610460699f},
-std::array<float,2>{0.486321151f, 0.100851476f},
-std::array<float,2>{0.577708721f, 0.690683186f},
-std::array<float,2>{0.839107573f, 0.484669566f},
-std::array<float,2>{0.0558670759f, 0.797047257f},
-std::array<float,2>{0.411554366f, 0.327223241f},
-std::array<float,2>{0.502574921f, 0.957319975f},
-std::array<float,2>{0.779713273f, 0.133453965f},
-std::array<float,2>{0.105804995f, 0.556571841f},
-std::array<float,2>{0.214364469f, 0.0618149303f},
-std::array<float,2>{0.912743926f, 0.645777404f},
-std::array<float,2>{0.709751785f, 0.380377173f},
-std::array<float,2>{0.363143504f, 0.867724955f},
-std::array<float,2>{0.0118519766f, 0.444663227f},
-std::array<float,2>{0.848559141f, 0.755376458f},
-std::array<float,2>{0.597030044f, 0.0643905029f},
-std::array<float,2>{0.439102441f, 0.740856409f},
-std::array<float,2>{0.256837457f, 0.189778149f},
-std::array<float,2>{0.641098261f, 0.584927976f},
-std::array<float,2>{0.978190124f, 0.30197531f},
-std::array<float,2>{0.13851805f, 0.937045515f},
-std::array<float,2>{0.455141306f, 0.480005741f},
-std::array<float,2>{0.620842695f, 0.784885406f},
-std::array<float,2>{0.869036973f, 0.110419698f},
-std::array<float,2>{0.0240177289f, 0.714131773f},
-std::array<float,2>{0.141826674f, 0.227030158f},
-std::array<float,2>{0.984930754f, 0.602733731f},
-std::array<float,2>{0.627145231f, 0.253804743f},
-std::array<float,2>{0.274689108f, 0.905132473f},
-std::array<float,2>{0.112019084f, 0.348794013f},
-std::array<float,2>{0.757175505f, 0.982964814f},
-std::array<float,2>{0.522656918f, 0.157513574f},
-std::array<float,2>{0.434391588f, 0.505306005f},
-std::array<float,2>{0.346401662f, 0.00690970197f},
-std::array<float,2>{0.697424233f, 0.678298116f},
-std::array<float,2>{0.926857531f, 0.41750434f},
-std::array<float,2>{0.19776459f, 0.817673326f},
-std::array<float,2>{0.281351179f, 0.289896995f},
-std::array<float,2>{0.666398525f, 0.910956502f},
-std::array<float,2>{0.943495393f, 0.209597275f},
-std::array<float,2>{0.162509248f, 0.57132113f},
-std::array<float,2>{0.0415620357f, 0.090131782f},
-std::array<float,2>{0.823105514f, 0.719218135f},
-std::array<float,2>{0.582843781f, 0.464336753f},
-std::array<float,2>{0.473396748f, 0.767955959f},
-std::array<float,2>{0.248917326f, 0.39244175f},
-std::array<float,2>{0.90218544f, 0.852955878f},
-std::array<float,2>{0.72808826f, 0.0433707908f},
-std::array<float,2>{0.328299403f, 0.628777146f},
-std::array<float,2>{0.383479983f, 0.14785412f},
-std::array<float,2>{0.546550512f, 0.533697069f},
-std::array<float,2>{0.809247851f, 0.341359049f},
-std::array<float,2>{0.0905459449f, 0.952393711f},
-std::array<float,2>{0.269631833f, 0.454441965f},
-std::array<float,2>{0.633956552f, 0.777737439f},
-std::array<float,2>{0.99283886f, 0.0822680816f},
-std::array<float,2>{0.150138661f, 0.731201112f},
-std::array<float,2>{0.0207869448f, 0.217128247f},
-std::array<float,2>{0.866228998f, 0.56676656f},
-std::array<float,2>{0.610197425f, 0.283888876f},
-std::array<float,2>{0.461738318f, 0.918212891f},
-std::array<float,2>{0.188621908f, 0.335143566f},
-std::array<float,2>{0.936505914f, 0.943682194f},
-std::array<float,2>{0.691167653f, 0.152011588f},
-std::array<float,2>{0.353601515f, 0.539695621f},
-std::array<float,2>{0.423663527f, 0.0368459597f},
-std::array<float,2>{0.52380842f, 0.638377666f},
-std::array<float,2>{0.761160731f, 0.400841266f},
-std::array<float,2>{0.117919311f, 0.846027672f},
-std::array<float,2>{0.482670307f, 0.258945763f},
-std::array<float,2>{0.593568742f, 0.895777404f},
-std::array<float,2>{0.812708676f, 0.223132819f},
-std::array<float,2>{0.0369289406f, 0.598782837f},
-std::array<float,2>{0.166755676f, 0.119189002f},
-std::array<float,2>{0.947026491f, 0.706186652f},
-std::array<float,2>{0.656989276f, 0.47128576f},
-std::array<float,2>{0.293710798f, 0.792474926f},
-std::array<float,2>{0.0785505325f, 0.409091413f},
-std::array<float,2>{0.800346494f, 0.82092315f},
-std::array<float,2>{0.533543825f, 0.0102348346f},
-std::array<float,2>{0.376082927f, 0.684491932f},
-std::array<float,2>{0.336310297f, 0.167622358f},
-std::array<float,2>{0.726392627f, 0.514255047f},
-std::array<float,2>{0.891811609f, 0.351860017f},
-std::array<float,2>{0.234815076f, 0.976093471f},
-std::array<float,2>{0.392692983f, 0.384844899f},
-std::array<float,2>{0.553714216f, 0.864519477f},
-std::array<float,2>{0.782951653f, 0.0513755679f},
-std::array<float,2>{0.0708216056f, 0.649349451f},
-std::array<float,2>{0.221962169f, 0.125476256f},
-std::array<float,2>{0.889636755f, 0.547105908f},
-std::array<float,2>{0.739105225f, 0.318268657f},
-std::array<float,2>{0.321330309f, 0.967731893f},
-std::array<float,2>{0.0477888249f, 0.307501018f},
-std::array<float,2>{0.833871424f, 0.929418623f},
-std::array<float,2>{0.563932598f, 0.198007777f},
-std::array<float,2>{0.498412371f, 0.592312038f},
-std::array<float,2>{0.304994047f, 0.0774842575f},
-std::array<float,2>{0.685910165f, 0.744108558f},
-std::array<float,2>{0.960035503f, 0.447527796f},
-std::array<float,2>{0.185453281f, 0.764223874f},
-std::array<float,2>{0.374201834f, 0.361344665f},
-std::array<float,2>{0.715940714f, 0.997317314f},
-std::array<float,2>{0.920399129f, 0.185010478f},
-std::array<float,2>{0.208605736f, 0.523282647f},
-std::array<float,2>{0.100090347f, 0.0275413115f},
-std::array<float,2>{0.765923202f, 0.666730225f},
-std::array<float,2>{0.509650767f, 0.43446821f},
-std::array<float,2>{0.41735518f, 0.830803216f},
-std::array<float,2>{0.131174877f, 0.497599512f},
-std::array<float,2>{0.974518359f, 0.811406136f},
-std::array<float,2>{0.652833402f, 0.107278816f},
-std::array<float,2>{0.259903669f, 0.6973297f},
-std::array<float,2>{0.450708687f, 0.249859571f},
-std::array<float,2>{0.606350541f, 0.621521413f},
-std::array<float,2>{0.853791237f, 0.266215116f},
-std::array<float,2>{0.000684921339f, 0.878186703f},
-std::array<float,2>{0.253657848f, 0.412879765f},
-std::array<float,2>{0.646314681f, 0.824751258f},
-std::array<float,2>{0.981865287f, 0.0148355579f},
-std::array<float,2>{0.134164989f, 0.68084085f},
-std::array<float,2>{0.0111934384f, 0.169323593f},
-std::array<float,2>{0.845398009f, 0.508135796f},
-std::array<float,2>{0.599254251f, 0.35582602f},
-std::array<float,2>{0.442987978f, 0.97225982f},
-std::array<float,2>{0.214963138f, 0.263189882f},
-std::array<float,2>{0.909346163f, 0.891784549f},
-std::array<float,2>{0.706375122f, 0.219426677f},
-std::array<float,2>{0.365985155f, 0.595493197f},
-std::array<float,2>{0.409231216f, 0.124258928f},
-std::array<float,2>{0.504891157f, 0.708444536f},
-std::array<float,2>{0.777243435f, 0.475880027f},
-std::array<float,2>{0.10372068f, 0.794758558f},
-std::array<float,2>{0.491758049f, 0.328454822f},
-std::array<float,2>{0.573533356f, 0.939234614f},
-std::array<float,2>{0.841711819f, 0.153161123f},
-std::array<float,2>{0.0622560568f, 0.546209991f},
-std::array<float,2>{0.172500968f, 0.0332559086f},
-std::array<float,2>{0.961801052f, 0.634927809f},
-std::array<float,2>{0.675202906f, 0.402546942f},
-std::array<float,2>{0.303957194f, 0.85049957f},
-std::array<float,2>{0.063779138f, 0.460314393f},
-std::array<float,2>{0.790876746f, 0.773582637f},
-std::array<float,2>{0.559547901f, 0.0803923383f},
-std::array<float,2>{0.405222327f, 0.727696776f},
-std::array<float,2>{0.317893595f, 0.210958481f},
-std::array<float,2>{0.747750282f, 0.564804494f},
-std::array<float,2>{0.880749464f, 0.287997067f},
-std::array<float,2>{0.23372592f, 0.915865958f},
-std::array<float,2>{0.387525588f, 0.493728846f},
-std::array<float,2>{0.542645276f, 0.806951821f},
-std::array<float,2>{0.807404041f, 0.10178344f},
-std::array<float,2>{0.0863056481f, 0.701083183f},
-std::array<float,2>{0.242885366f, 0.242375791f},
-std::array<float,2>{0.905328751f, 0.618991792f},
-std::array<float,2>{0.734148502f, 0.273069918f},
-std::array<float,2>{0.332624763f, 0.879317522f},
-std::array<float,2>{0.0446346886f, 0.364412516f},
-std::array<float,2>{0.826451302f, 0.992737532f},
-std::array<float,2>{0.579545975f, 0.180247977f},
-std::array<float,2>{0.471838057f, 0.517346561f},
-std::array<float,2>{0.287082165f, 0.0243083555f},
-std::array<float,2>{0.670097232f, 0.671077788f},
-std::array<float,2>{0.941090345f, 0.432807922f},
-std::array<float,2>{0.159628451f, 0.833868563f},
-std::array<float,2>{0.348521829f, 0.310750872f},
-std::array<float,2>{0.699385524f, 0.92252624f},
-std::array<float,2>{0.922744036f, 0.202020437f},
-std::array<float,2>{0.200508595f, 0.589680612f},
-std::array<float,2>{0.114012092f, 0.0741556138f},
-std::array<float,2>{0.752091646f, 0.747786283f},
-std::array<float,2>{0.517985761f, 0.451794714f},
-std::array<float,2>{0.432210207f, 0.760118842f},
-std::array<float,2>{0.146486074f, 0.390526325f},
-std::array<float,2>{0.990691602f, 0.862629175f},
-std::array<float,2>{0.632107139f, 0.0488654189f},
-std::array<float,2>{0.277966887f, 0.65323621f},
-std::array<float,2>{0.458476871f, 0.131630331f},
-std::array<float,2>{0.624797046f, 0.552735567f},
-std::array<float,2>{0.871127546f, 0.313646078f},
-std::array<float,2>{0.0298461989f, 0.964128137f},
-std::array<float,2>{0.343620002f, 0.438561767f},
-std::array<float,2>{0.720791757f, 0.752022028f},
-std::array<float,2>{0.896508873f, 0.0686157122f},
-std::array<float,2>{0.241114855f, 0.735052466f},
-std::array<float,2>{0.0821647793f, 0.195138127f},
-std::array<float,2>{0.803016305f, 0.581150293f},
-std::array<float,2>{0.535649538f, 0.29911685f},
-std::array<float,2>{0.380679041f, 0.929731011f},
-std::array<float,2>{0.169788823f, 0.322714835f},
-std::array<float,2>{0.952560008f, 0.953684032f},
-std::array<float,2>{0.66288501f, 0.137008458f},
-std::array<float,2>{0.289128006f, 0.562124789f},
-std::array<float,2>{0.476766974f, 0.0579073355f},
-std::array<float,2>{0.587362409f, 0.641340435f},
-std::array<float,2>{0.818015933f, 0.37808013f},
-std::array<float,2>{0.0316864364f, 0.874055803f},
-std::array<float,2>{0.428508252f, 0.277436286f},
-std::array<float,2>{0.529346108f, 0.886885762f},
-std::array<float,2>{0.764030397f, 0.241612762f},
-std::array<float,2>{0.122189596f, 0.613440514f},
-std::array<float,2>{0.194086358f, 0.0938740298f},
-std::array<float,2>{0.929950714f, 0.692956209f},
-std::array<float,2>{0.694296062f, 0.488324404f},
-std::array<float,2>{0.358112872f, 0.802915275f},
-std::array<float,2>{0.0186333135f, 0.423964173f},
-std::array<float,2>{0.863059521f, 0.83803767f},
-std::array<float,2>{0.614090204f, 0.0187167414f},
-std::array<float,2>{0.468048543f, 0.662743151f},
-std::array<float,2>{0.2656672f, 0.175388187f},
-std::array<float,2>{0.639530301f, 0.524046838f},
-std::array<float,2>{0.998851478f, 0.373618603f},
-std::array<float,2>{0.154161304f, 0.991031289f},
-std::array<float,2>{0.446304202f, 0.396409094f},
-std::array<float,2>{0.603720844f, 0.85779047f},
-std::array<float,2>{0.855494082f, 0.0413453169f},
-std::array<float,2>{0.0043743155f, 0.632243693f},
-std::array<float,2>{0.128197074f, 0.143509552f},
-std::array<float,2>{0.969712794f, 0.536179662f},
-std::array<float,2>{0.648609638f, 0.33789888f},
-std::array<float,2>{0.26495862f, 0.946877062f},
-std::array<float,2>{0.0944278985f, 0.293217391f},
-std::array<float,2>{0.770528018f, 0.909474671f},
-std::array<float,2>{0.514983237f, 0.206089139f},
-std::array<float,2>{0.419069916f, 0.574703634f},
-std::array<float,2>{0.370575219f, 0.0859763026f},
-std::array<float,2>{0.713377774f, 0.725606799f},
-std::array<float,2>{0.917861819f, 0.465785474f},
-std::array<float,2>{0.205340192f, 0.772567332f},
-std::array<float,2>{0.308864504f, 0.346121848f},
-std::array<float,2>{0.680388927f, 0.97854811f},
-std::array<float,2>{0.953894019f, 0.160431564f},
-std::array<float,2>{0.181032404f, 0.50252074f},
-std::array<float,2>{0.0516286269f, 0.0032081902f},
-std::array<float,2>{0.831108332f, 0.672160923f},
-std::array<float,2>{0.568477213f, 0.418374091f},
-std::array<float,2>{0.492887735f, 0.813278496f},
-std::array<float,2>{0.226383492f, 0.484025419f},
-std::array<float,2>{0.885848224f, 0.785857201f},
-std::array<float,2>{0.736108243f, 0.116767474f},
-std::array<float,2>{0.32670328f, 0.717517853f},
-std::array<float,2>{0.39489606f, 0.231130883f},
-std::array<float,2>{0.550453067f, 0.606611311f},
-std::array<float,2>{0.788049638f, 0.255160511f},
-std::array<float,2>{0.0780884326f, 0.898549438f},
-std::array<float,2>{0.359989494f, 0.382500678f},
-std::array<float,2>{0.70746249f, 0.870304942f},
-std::array<float,2>{0.912029743f, 0.0592232496f},
-std::array<float,2>{0.212080121f, 0.648412526f},
-std::array<float,2>{0.108397841f, 0.136561319f},
-std::array<float,2>{0.779093921f, 0.558006525f},
-std::array<float,2>{0.50093317f, 0.325037986f},
-std::array<float,2>{0.412810832f, 0.959332943f},
-std::array<float,2>{0.139815912f, 0.303546965f},
-std::array<float,2>{0.979062676f, 0.934830725f},
-std::array<float,2>{0.642742455f, 0.188203573f},
-std::array<float,2>{0.254038483f, 0.582362413f},
-std::array<float,2>{0.440698445f, 0.0648052022f},
-std::array<float,2>{0.594020724f, 0.738523364f},
-std::array<float,2>{0.850986838f, 0.441819727f},
-std::array<float,2>{0.0139063718f, 0.757749259f},
-std::array<float,2>{0.402269334f, 0.370372117f},
-std::array<float,2>{0.557202876f, 0.987662256f},
-std::array<float,2>{0.795193076f, 0.176469669f},
-std::array<float,2>{0.0685749426f, 0.528847635f},
-std::array<float,2>{0.228629425f, 0.0226488188f},
-std::array<float,2>{0.876897275f, 0.657474399f},
-std::array<float,2>{0.742527723f, 0.427139163f},
-std::array<float,2>{0.313136101f, 0.843055964f},
-std::array<float,2>{0.0571953058f, 0.487100333f},
-std::array<float,2>{0.837623417f, 0.799944222f},
-std::array<float,2>{0.574911416f, 0.0984438583f},
-std::array<float,2>{0.488235921f, 0.688826919f},
-std::array<float,2>{0.298773259f, 0.236101553f},
-std::array<float,2>{0.678303123f, 0.612755418f},
-std::array<float,2>{0.966080189f, 0.277268589f},
-std::array<float,2>{0.175855681f, 0.884956062f},
-std::array<float,2>{0.476179868f, 0.462100714f},
-std::array<float,2>{0.584074914f, 0.76715219f},
-std::array<float,2>{0.821961761f, 0.0923048928f},
-std::array<float,2>{0.0404063351f, 0.722389579f},
-std::array<float,2>{0.160382807f, 0.208568409f},
-std::array<float,2>{0.941968501f, 0.573257983f},
-std::array<float,2>{0.665827513f, 0.291208714f},
-std::array<float,2>{0.284419715f, 0.912499964f},
-std::array<float,2>{0.0920214877f, 0.342506468f},
-std::array<float,2>{0.812109709f, 0.950099707f},
-std::array<float,2>{0.544269443f, 0.145272106f},
-std::array<float,2>{0.384973884f, 0.531412303f},
-std::array<float,2>{0.33108142f, 0.0459888168f},
-std::array<float,2>{0.729699254f, 0.626932383f},
-std::array<float,2>{0.899522245f, 0.394218415f},
-std::array<float,2>{0.246356308f, 0.854943454f},
-std::array<float,2>{0.27699843f, 0.25153169f},
-std::array<float,2>{0.626078904f, 0.902675569f},
-std::array<float,2>{0.988243461f, 0.229263619f},
-std::array<float,2>{0.14274323f, 0.60453546f},
-std::array<float,2>{0.0259880349f, 0.112138875f},
-std::array<float,2>{0.870036125f, 0.712190986f},
-std::array<float,2>{0.618112385f, 0.478132218f},
-std::array<float,2>{0.453267932f, 0.782654881f},
-std::array<float,2>{0.196560472f, 0.414521813f},
-std::array<float,2>{0.928363621f, 0.819732249f},
-std::array<float,2>{0.696817517f, 0.00514953304f},
-std::array<float,2>{0.344926178f, 0.676054657f},
-std::array<float,2>{0.437186748f, 0.159401909f},
-std::array<float,2>{0.520466387f, 0.507532001f},
-std::array<float,2>{0.753982842f, 0.349988699f},
-std::array<float,2>{0.110403955f, 0.981686532f},
-std::array<float,2>{0.295064449f, 0.470629036f},
-std::array<float,2>{0.658578515f, 0.789244354f},
-std::array<float,2>{0.949132442f, 0.118421622f},
-std::array<float,2>{0.164958566f, 0.704525411f},
-std::array<float,2>{0.0373141803f, 0.224755868f},
-std::array<float,2>{0.815356016f, 0.601088285f},
-std::array<float,2>{0.590964079f, 0.26147446f},
-std::array<float,2>{0.48133412f, 0.897392094f},
-std::array<float,2>{0.237674817f, 0.354137301f},
-std::array<float,2>{0.89351207f, 0.974535227f},
-std::array<float,2>{0.722909093f, 0.165217236f},
-std::array<float,2>{0.339445591f, 0.512859166f},
-std::array<float,2>{0.378830105f, 0.00893123355f},
-std::array<float,2>{0.531690657f, 0.687326968f},
-std::array<float,2>{0.79737854f, 0.40712595f},
-std::array<float,2>{0.0801630169f, 0.822354674f},
-std::array<float,2>{0.464095175f, 0.283181548f},
-std::array<float,2>{0.612890303f, 0.920268059f},
-std::array<float,2>{0.864867032f, 0.215167314f},
-std::array<float,2>{0.0230811518f, 0.570118129f},
-std::array<float,2>{0.152198613f, 0.0857280791f},
-std::array<float,2>{0.995734155f, 0.732705712f},
-std::array<float,2>{0.635002315f, 0.456194431f},
-std::array<float,2>{0.27299425f, 0.780501246f},
-std::array<float,2>{0.120214127f, 0.399988979f},
-std::array<float,2>{0.759730279f, 0.844992101f},
-std::array<float,2>{0.526035845f, 0.0389405675f},
-std::array<float,2>{0.424977422f, 0.639902234f},
-std::array<float,2>{0.351980567f, 0.148972005f},
-std::array<float,2>{0.689138055f, 0.542123437f},
-std::array<float,2>{0.933636725f, 0.333826095f},
-std::array<float,2>{0.190689489f, 0.941961467f},
-std::array<float,2>{0.41571781f, 0.436961591f},
-std::array<float,2>{0.510944068f, 0.828682542f},
-std::array<float,2>{0.769136369f, 0.0310659576f},
-std::array<float,2>{0.0986471921f, 0.665519476f},
-std::array<float,2>{0.209882051f, 0.186017767f},
-std::array<float,2>{0.919259131f, 0.519795597f},
-std::array<float,2>{0.717863381f, 0.359473437f},
-std::array<float,2>{0.372328013f, 0.999734044f},
-std::array<float,2>{0.00275481865f, 0.268904269f},
-std::array<float,2>{0.852852404f, 0.875052094f},
-std::array<float,2>{0.607756495f, 0.246388569f},
-std::array<float,2>{0.451449841f, 0.623638391f},
-std::array<float,2>{0.259450495f, 0.108970731f},
-std::array<float,2>{0.655214131f, 0.695549846f},
-std::array<float,2>{0.976115704f, 0.499566257f},
-std::array<float,2>{0.129820541f, 0.809278667f},
-std::array<float,2>{0.322779059f, 0.318656266f},
-std::array<float,2>{0.741710603f, 0.966094434f},
-std::array<float,2>{0.887717485f, 0.127166525f},
-std::array<float,2>{0.219443232f, 0.550753355f},
-std::array<float,2>{0.0728324056f, 0.0529932119f},
-std::array<float,2>{0.783344567f, 0.650544226f},
-std::array<float,2>{0.551306546f, 0.383500695f},
-std::array<float,2>{0.391705245f, 0.86558038f},
-std::array<float,2>{0.187206835f, 0.447229385f},
-std::array<float,2>{0.958694518f, 0.762622356f},
-std::array<float,2>{0.684864998f, 0.0754153356f},
-std::array<float,2>{0.307990491f, 0.744505703f},
-std::array<float,2>{0.49705416f, 0.19673948f},
-std::array<float,2>{0.566347659f, 0.591610432f},
-std::array<float,2>{0.8349756f, 0.305065572f},
-std::array<float,2>{0.0494262874f, 0.926714063f},
-std::array<float,2>{0.278719127f, 0.388585746f},
-std::array<float,2>{0.631667972f, 0.860834897f},
-std::array<float,2>{0.991802514f, 0.0471525416f},
-std::array<float,2>{0.147607505f, 0.654959202f},
-std::array<float,2>{0.030288104f, 0.12987867f},
-std::array<float,2>{0.872592807f, 0.552511811f},
-std::array<float,2>{0.623940289f, 0.315675974f},
-std::array<float,2>{0.457481414f, 0.960996807f},
-std::array<float,2>{0.200098842f, 0.310203046f},
-std::array<float,2>{0.923288286f, 0.924332321f},
-std::array<float,2>{0.70080632f, 0.200726658f},
-std::array<float,2>{0.349606216f, 0.587507784f},
-std::array<float,2>{0.432961613f, 0.0714803711f},
-std::array<float,2>{0.519432664f, 0.749875069f},
-std::array<float,2>{0.753229022f, 0.450608939f},
-std::array<float,2>{0.114594698f, 0.758462608f},
-std::array<float,2>{0.470767289f, 0.365781784f},
-std::array<float,2>{0.578867793f, 0.994945109f},
-std::array<float,2>{0.827279389f, 0.181717068f},
-std::array<float,2>{0.0433107167f, 0.518976152f},
-std::array<float,2>{0.158556357f, 0.0267935023f},
-std::array<float,2>{0.939672291f, 0.668687522f},
-std::array<float,2>{0.671200871f, 0.431279272f},
-std::array<float,2>{0.286120355f, 0.83415395f},
-std::array<float,2>{0.0873796716f, 0.494921148f},
-std::array<float,2>{0.80845511f, 0.805302501f},
-std::array<float,2>{0.541653752f, 0.105041027f},
-std::array<float,2>{0.388491333f, 0.701327264f},
-std::array<float,2>{0.333582669f, 0.245609328f},
-std::array<float,2>{0.732795238f, 0.619230032f},
-std::array<float,2>{0.904982865f, 0.271380037f},
-std::array<float,2>{0.243423447f, 0.881985247f},
-std::array<float,2>{0.406079859f, 0.457063526f},
-std::array<float,2>{0.560292423f, 0.775925756f},
-std::array<float,2>{0.789648354f, 0.0781542882f},
-std::array<float,2>{0.0626568794f, 0.728940725f},
-std::array<float,2>{0.232773796f, 0.214491054f},
-std::array<float,2>{0.879731536f, 0.562584519f},
-std::array<float,2>{0.746440768f, 0.28629303f},
-std::array<float,2>{0.31736359f, 0.917207003f},
-std::array<float,2>{0.0614798218f, 0.332001269f},
-std::array<float,2>{0.840091884f, 0.939829767f},
-std::array<float,2>{0.573159873f, 0.155268982f},
-std::array<float,2>{0.490413874f, 0.544827104f},
-std::array<float,2>{0.303688526f, 0.0323457457f},
-std::array<float,2>{0.674426854f, 0.633299232f},
-std::array<float,2>{0.962812841f, 0.404547632f},
-std::array<float,2>{0.172975719f, 0.849074662f},
-std::array<float,2>{0.366857082f, 0.265495032f},
-std::array<float,2>{0.705604315f, 0.893916786f},
-std::array<float,2>{0.908701122f, 0.221755087f},
-std::array<float,2>{0.216429666f, 0.596782982f},
-std::array<float,2>{0.105441943f, 0.122880004f},
-std::array<float,2>{0.776123703f, 0.71033895f},
-std::array<float,2>{0.504295528f, 0.47273007f},
-std::array<float,2>{0.408386648f, 0.796311259f},
-std::array<float,2>{0.133731201f, 0.410713911f},
-std::array<float,2>{0.980689466f, 0.826443195f},
-std::array<float,2>{0.644975662f, 0.0117982337f},
-std::array<float,2>{0.252596438f, 0.6830284f},
-std::array<float,2>{0.441957682f, 0.17123805f},
-std::array<float,2>{0.598255277f, 0.510367155f},
-std::array<float,2>{0.843806863f, 0.358946472f},
-std::array<float,2>{0.010375319f, 0.9699893f},
-std::array<float,2>{0.328036368f, 0.481722325f},
-std::array<float,2>{0.735122561f, 0.787200153f},
-std::array<float,2>{0.885185122f, 0.114074416f},
-std::array<float,2>{0.225564554f, 0.715836108f},
-std::array<float,2>{0.0762418732f, 0.234290466f},
-std::array<float,2>{0.789024353f, 0.607784688f},
-std::array<float,2>{0.549344838f, 0.256798357f},
-std::array<float,2>{0.39620024f, 0.901593149f},
-std::array<float,2>{0.180313185f, 0.344107836f},
-std::array<float,2>{0.955054939f, 0.976748407f},
-std::array<float,2>{0.681034148f, 0.16364482f},
-std::array<float,2>{0.309723854f, 0.501455843f},
-std::array<float,2>{0.493801236f, 0.000650605012f},
-std::array<float,2>{0.569798231f, 0.674979925f},
-std::array<float,2>{0.830793023f, 0.420190424f},
-std::array<float,2>{0.0521669947f, 0.816035807f},
-std::array<float,2>{0.418620199f, 0.295685589f},
-std::array<float,2>{0.514382839f, 0.906887591f},
-std::array<float,2>{0.770472467f, 0.203796744f},
-std::array<float,2>{0.0952701569f, 0.577825308f},
-std::array<float,2>{0.206553191f, 0.0885485634f},
-std::array<float,2>{0.91691947f, 0.723169684f},
-std::array<float,2>{0.714494526f, 0.467383981f},
-std::array<float,2>{0.370010734f, 0.769886851f},
-std::array<float,2>{0.00506092375f, 0.396503478f},
-std::array<float,2>{0.856783092f, 0.857175589f},
-std::array<float,2>{0.605029702f, 0.039297998f},
-std::array<float,2>{0.44594565f, 0.629031301f},
-std::array<float,2>{0.264401823f, 0.142457917f},
-std::array<float,2>{0.650125265f, 0.538272858f},
-std::array<float,2>{0.970454812f, 0.336398244f},
-std::array<float,2>{0.127841651f, 0.948943675f},
-std::array<float,2>{0.467352152f, 0.423467845f},
-std::array<float,2>{0.614451945f, 0.836078525f},
-std::array<float,2>{0.861399233f, 0.0172771942f},
-std::array<float,2>{0.0182221308f, 0.661114514f},
-std::array<float,2>{0.153283715f, 0.173686013f},
-std::array<float,2>{0.999055207f, 0.527131379f},
-std::array<float,2>{0.639855146f, 0.372409999f},
-std::array<float,2>{0.267555833f, 0.989932418f},
-std::array<float,2>{0.121112414f, 0.280927688f},
-std::array<float,2>{0.765571952f, 0.89036423f},
-std::array<float,2>{0.531141162f, 0.238574296f},
-std::array<float,2>{0.429220676f, 0.616775095f},
-std::array<float,2>{0.359239489f, 0.0976338834f},
-std::array<float,2>{0.694419265f, 0.69436574f},
-std::array<float,2>{0.931157112f, 0.491399825f},
-std::array<float,2>{0.195184812f, 0.802684784f},
-std::array<float,2>{0.290661246f, 0.321738601f},
-std::array<float,2>{0.663925469f, 0.956825733f},
-std::array<float,2>{0.951384187f, 0.138912126f},
-std::array<float,2>{0.168230698f, 0.560206294f},
-std::array<float,2>{0.0331626981f, 0.0559250526f},
-std::array<float,2>{0.816457331f, 0.643662035f},
-std::array<float,2>{0.586233377f, 0.375770807f},
-std::array<float,2>{0.478272617f, 0.871411204f},
-std::array<float,2>{0.241586342f, 0.441326201f},
-std::array<float,2>{0.898106039f, 0.75016582f},
-std::array<float,2>{0.722097933f, 0.0670615956f},
-std::array<float,2>{0.341887444f, 0.738162458f},
-std::array<float,2>{0.379121512f, 0.192745313f},
-std::array<float,2>{0.536244392f, 0.57841897f},
-std::array<float,2>{0.803936601f, 0.29878974f},
-std::array<float,2>{0.0830680281f, 0.932024539f},
-std::array<float,2>{0.343857974f, 0.416265726f},
-std::array<float,2>{0.696244061f, 0.817067921f},
-std::array<float,2>{0.929316461f, 0.00676010083f},
-std::array<float,2>{0.19573687f, 0.679369509f},
-std::array<float,2>{0.110219195f, 0.157215372f},
-std::array<float,2>{0.755524933f, 0.50485599f},
-std::array<float,2>{0.521028399f, 0.348190248f},
-std::array<float,2>{0.43604669f, 0.983992457f},
-std::array<float,2>{0.144111916f, 0.252815723f},
-std::array<float,2>{0.987214684f, 0.905367315f},
-std::array<float,2>{0.625198245f, 0.227691352f},
-std::array<float,2>{0.275716305f, 0.601610243f},
-std::array<float,2>{0.454508781f, 0.1095296f},
-std::array<float,2>{0.618802071f, 0.713197291f},
-std::array<float,2>{0.870203555f, 0.479011238f},
-std::array<float,2>{0.0270533413f, 0.784145236f},
-std::array<float,2>{0.386695951f, 0.340598196f},
-std::array<float,2>{0.543872356f, 0.95149821f},
-std::array<float,2>{0.811029077f, 0.146548614f},
-std::array<float,2>{0.0935831442f, 0.53453505f},
-std::array<float,2>{0.247545764f, 0.044584997f},
-std::array<float,2>{0.898758829f, 0.627611279f},
-std::array<float,2>{0.729062557f, 0.3913396f},
-std::array<float,2>{0.330345303f, 0.851892769f},
-std::array<float,2>{0.0395351313f, 0.463799119f},
-std::array<float,2>{0.820436418f, 0.768668413f},
-std::array<float,2>{0.585121632f, 0.0909915194f},
-std::array<float,2>{0.475505382f, 0.720400393f},
-std::array<float,2>{0.284013212f, 0.210674539f},
-std::array<float,2>{0.664114177f, 0.571105182f},
-std::array<float,2>{0.942408204f, 0.290687919f},
-std::array<float,2>{0.161353305f, 0.911209285f},
-std::array<float,2>{0.486547589f, 0.486155212f},
-std::array<float,2>{0.575213909f, 0.798049748f},
-std::array<float,2>{0.836102366f, 0.0997833237f},
-std::array<float,2>{0.0577002764f, 0.69011575f},
-std::array<float,2>{0.17704995f, 0.237869352f},
-std::array<float,2>{0.964890361f, 0.610211611f},
-std::array<float,2>{0.678799272f, 0.274168283f},
-std::array<float,2>{0.297552943f, 0.884105623f},
-std::array<float,2>{0.0697670132f, 0.368724018f},
-std::array<float,2>{0.796701014f, 0.984799206f},
-std::array<float,2>{0.557814717f, 0.179202422f},
-std::array<float,2>{0.401303232f, 0.530955076f},
-std::array<float,2>{0.314432085f, 0.0205888897f},
-std::array<float,2>{0.74320066f, 0.659166515f},
-std::array<float,2>{0.875297368f, 0.427801698f},
-std::array<float,2>{0.229807138f, 0.839868724f},
-std::array<float,2>{0.255468279f, 0.301024973f},
-std::array<float,2>{0.644447207f, 0.935805202f},
-std::array<float,2>{0.979946792f, 0.191155866f},
-std::array<float,2>{0.138940573f, 0.585472941f},
-std::array<float,2>{0.0151299024f, 0.0630772784f},
-std::array<float,2>{0.850566566f, 0.741715848f},
-std::array<float,2>{0.595011711f, 0.44384703f},
-std::array<float,2>{0.440191776f, 0.754222929f},
-std::array<float,2>{0.211533189f, 0.379722238f},
-std::array<float,2>{0.910410464f, 0.868619442f},
-std::array<float,2>{0.708132744f, 0.0611058474f},
-std::array<float,2>{0.361170679f, 0.64512217f},
-std::array<float,2>{0.413997084f, 0.134118795f},
-std::array<float,2>{0.501092017f, 0.554894269f},
-std::array<float,2>{0.778113306f, 0.32640177f},
-std::array<float,2>{0.10890384f, 0.958666861f},
-std::array<float,2>{0.307404727f, 0.44848612f},
-std::array<float,2>{0.683937192f, 0.764664412f},
-std::array<float,2>{0.957458973f, 0.0762360841f},
-std::array<float,2>{0.185906902f, 0.743147612f},
-std::array<float,2>{0.0507496558f, 0.199198171f},
-std::array<float,2>{0.834898353f, 0.592948556f},
-std::array<float,2>{0.564531863f, 0.307798386f},
-std::array<float,2>{0.497491419f, 0.928291678f},
-std::array<float,2>{0.219965592f, 0.316678017f},
-std::array<float,2>{0.887667656f, 0.968051732f},
-std::array<float,2>{0.740397453f, 0.126797751f},
-std::array<float,2>{0.323454738f, 0.548075497f},
-std::array<float,2>{0.391182244f, 0.0526308678f},
-std::array<float,2>{0.551913142f, 0.649461865f},
-std::array<float,2>{0.784940898f, 0.386394113f},
-std::array<float,2>{0.0732568279f, 0.863281667f},
-std::array<float,2>{0.452938735f, 0.266946733f},
-std::array<float,2>{0.608923316f, 0.877803743f},
-std::array<float,2>{0.852485538f, 0.24852781f},
-std::array<float,2>{0.00303296931f, 0.622641444f},
-std::array<float,2>{0.129923359f, 0.105646059f},
-std::array<float,2>{0.975060046f, 0.698334813f},
-std::array<float,2>{0.655495942f, 0.496806234f},
-std::array<float,2>{0.257910758f, 0.811614275f},
-std::array<float,2>{0.0985886678f, 0.435141414f},
-std::array<float,2>{0.768514693f, 0.831309974f},
-std::array<float,2>{0.510472775f, 0.028702734f},
-std::array<float,2>{0.415038258f, 0.667551517f},
-std::array<float,2>{0.371450007f, 0.184570044f},
-std::array<float,2>{0.71765852f, 0.521821022f},
-std::array<float,2>{0.918733358f, 0.362695754f},
-std::array<float,2>{0.210807294f, 0.996898234f},
-std::array<float,2>{0.424298257f, 0.402219266f},
-std::array<float,2>{0.527042091f, 0.846905708f},
-std::array<float,2>{0.758491993f, 0.0358637273f},
-std::array<float,2>{0.119599171f, 0.637630045f},
-std::array<float,2>{0.189623892f, 0.150419354f},
-std::array<float,2>{0.935197592f, 0.541000485f},
-std::array<float,2>{0.688358128f, 0.334302783f},
-std::array<float,2>{0.352630198f, 0.944774926f},
-std::array<float,2>{0.0216568988f, 0.284472972f},
-std::array<float,2>{0.863971651f, 0.919488549f},
-std::array<float,2>{0.611985981f, 0.218188107f},
-std::array<float,2>{0.463827848f, 0.568197906f},
-std::array<float,2>{0.272094578f, 0.0836028159f},
-std::array<float,2>{0.636437297f, 0.732364893f},
-std::array<float,2>{0.994390726f, 0.453939468f},
-std::array<float,2>{0.150793582f, 0.779191613f},
-std::array<float,2>{0.338469326f, 0.352639019f},
-std::array<float,2>{0.724598229f, 0.975318372f},
-std::array<float,2>{0.893984258f, 0.166329488f},
-std::array<float,2>{0.237143978f, 0.515609205f},
-std::array<float,2>{0.0816536248f, 0.0108972946f},
-std::array<float,2>{0.797961175f, 0.685129404f},
-std::array<float,2>{0.533018887f, 0.409683615f},
-std::array<float,2>{0.377347618f, 0.821846068f},
-std::array<float,2>{0.16539599f, 0.472046196f},
-std::array<float,2>{0.947440445f, 0.791761279f},
-std::array<float,2>{0.659928024f, 0.120952711f},
-std::array<float,2>{0.296159863f, 0.705543697f},
-std::array<float,2>{0.481775552f, 0.224102944f},
-std::array<float,2>{0.590759277f, 0.598540246f},
-std::array<float,2>{0.816107929f, 0.258178651f},
-std::array<float,2>{0.038755957f, 0.895105481f},
-std::array<float,2>{0.287699103f, 0.432554841f},
-std::array<float,2>{0.668254256f, 0.832435787f},
-std::array<float,2>{0.937645614f, 0.0249181725f},
-std::array<float,2>{0.157064781f, 0.670417309f},
-std::array<float,2>{0.0460361242f, 0.181563377f},
-std::array<float,2>{0.825739563f, 0.516464949f},
-std::array<float,2>{0.580211639f, 0.364092141f},
-std::array<float,2>{0.470404088f, 0.994134784f},
-std::array<float,2>{0.245490327f, 0.271622449f},
-std::array<float,2>{0.903319478f, 0.879932702f},
-std::array<float,2>{0.730574012f, 0.243708253f},
-std::array<float,2>{0.335774988f, 0.617910385f},
-std::array<float,2>{0.389485121f, 0.103408456f},
-std::array<float,2>{0.539687693f, 0.700139582f},
-std::array<float,2>{0.805068076f, 0.492750257f},
-std::array<float,2>{0.0882742926f, 0.808038056f},
-std::array<float,2>{0.459490687f, 0.312705725f},
-std::array<float,2>{0.621415496f, 0.963532686f},
-std::array<float,2>{0.874097109f, 0.132256746f},
-std::array<float,2>{0.0289702415f, 0.553777516f},
-std::array<float,2>{0.144562989f, 0.0505012125f},
-std::array<float,2>{0.989965856f, 0.65353477f},
-std::array<float,2>{0.629635155f, 0.389151126f},
-std::array<float,2>{0.28057465f, 0.861398816f},
-std::array<float,2>{0.116646208f, 0.452815831f},
-std::array<float,2>{0.750303447f, 0.760972321f},
-std::array<float,2>{0.517306447f, 0.0731123537f},
-std::array<float,2>{0.430939466f, 0.746142328f},
-std::array<float,2>{0.35065189f, 0.202605247f},
-std::array<float,2>{0.702089727f, 0.588137925f},
-std::array<float,2>{0.92567116f, 0.312109172f},
-std::array<float,2>{0.202489361f, 0.923297703f},
-std::array<float,2>{0.406810075f, 0.475072443f},
-std::array<float,2>{0.507099092f, 0.793598175f},
-std::array<float,2>{0.774457753f, 0.123554036f},
-std::array<float,2>{0.102916494f, 0.707542777f},
-std::array<float,2>{0.217220828f, 0.219855353f},
-std::array<float,2>{0.906469405f, 0.594222784f},
-std::array<float,2>{0.703466415f, 0.262387127f},
-std::array<float,2>{0.364669859f, 0.891329885f},
-std::array<float,2>{0.00970301405f, 0.356635958f},
-std::array<float,2>{0.846628726f, 0.971652031f},
-std::array<float,2>{0.601493597f, 0.168280825f},
-std::array<float,2>{0.445308864f, 0.509494007f},
-std::array<float,2>{0.251224339f, 0.0140789375f},
-std::array<float,2>{0.647350371f, 0.680137932f},
-std::array<float,2>{0.983989418f, 0.413409948f},
-std::array<float,2>{0.134855345f, 0.825218737f},
-std::array<float,2>{0.320065558f, 0.288900435f},
-std::array<float,2>{0.749798059f, 0.914064646f},
-std::array<float,2>{0.882276177f, 0.21257858f},
-std::array<float,2>{0.231815502f, 0.566226065f},
-std::array<float,2>{0.0646139756f, 0.0815722495f},
-std::array<float,2>{0.792947829f, 0.727462232f},
-std::array<float,2>{0.562413454f, 0.45938772f},
-std::array<float,2>{0.403720438f, 0.775238037f},
-std::array<float,2>{0.175327197f, 0.404165119f},
-std::array<float,2>{0.964362025f, 0.851271093f},
-std::array<float,2>{0.67320174f, 0.0348929241f},
-std::array<float,2>{0.302618057f, 0.636568069f},
-std::array<float,2>{0.488689363f, 0.15389733f},
-std::array<float,2>{0.570922017f, 0.545240998f},
-std::array<float,2>{0.843335092f, 0.329158485f},
-std::array<float,2>{0.0605422817f, 0.938454092f},
-std::array<float,2>{0.369106859f, 0.466785967f},
-std::array<float,2>{0.711624265f, 0.772433639f},
-std::array<float,2>{0.914328158f, 0.0872853994f},
-std::array<float,2>{0.203935757f, 0.724882424f},
-std::array<float,2>{0.0970364884f, 0.205821961f},
-std::array<float,2>{0.772532225f, 0.575930238f},
-std::array<float,2>{0.512742937f, 0.294228554f},
-std::array<float,2>{0.420927823f, 0.90880394f},
-std::array<float,2>{0.126217887f, 0.3390221f},
-std::array<float,2>{0.970797122f, 0.945863128f},
-std::array<float,2>{0.65088886f, 0.144058853f},
-std::array<float,2>{0.262771487f, 0.535577178f},
-std::array<float,2>{0.448646486f, 0.0427655019f},
-std::array<float,2>{0.603426158f, 0.631656826f},
-std::array<float,2>{0.85869205f, 0.395272255f},
-std::array<float,2>{0.00643561035f, 0.85906297f},
-std::array<float,2>{0.396700263f, 0.254261345f},
-std::array<float,2>{0.547769964f, 0.899748325f},
-std::array<float,2>{0.787061453f, 0.232416138f},
-std::array<float,2>{0.0742828026f, 0.605687916f},
-std::array<float,2>{0.223233327f, 0.115637667f},
-std::array<float,2>{0.883970857f, 0.718298078f},
-std::array<float,2>{0.737085283f, 0.48311922f},
-std::array<float,2>{0.325861365f, 0.7866202f},
-std::array<float,2>{0.0538161136f, 0.419509411f},
-std::array<float,2>{0.829462051f, 0.813664198f},
-std::array<float,2>{0.567224264f, 0.00283710822f},
-std::array<float,2>{0.495969772f, 0.673777461f},
-std::array<float,2>{0.311365396f, 0.161242574f},
-std::array<float,2>{0.682009161f, 0.503549695f},
-std::array<float,2>{0.956750214f, 0.347255677f},
-std::array<float,2>{0.183117568f, 0.980255723f},
-std::array<float,2>{0.479887933f, 0.377543062f},
-std::array<float,2>{0.589444578f, 0.873614609f},
-std::array<float,2>{0.818643272f, 0.0573978759f},
-std::array<float,2>{0.034679953f, 0.641692519f},
-std::array<float,2>{0.171809509f, 0.138602063f},
-std::array<float,2>{0.94964695f, 0.561292171f},
-std::array<float,2>{0.661403954f, 0.324041575f},
-std::array<float,2>{0.292306572f, 0.954129457f},
-std::array<float,2>{0.0845060796f, 0.299972892f},
-std::array<float,2>{0.802651584f, 0.931159079f},
-std::array<float,2>{0.538441241f, 0.193887621f},
-std::array<float,2>{0.381968558f, 0.580899954f},
-std::array<float,2>{0.340969145f, 0.0698301569f},
-std::array<float,2>{0.720175087f, 0.736312449f},
-std::array<float,2>{0.895021677f, 0.438087463f},
-std::array<float,2>{0.23917909f, 0.753539443f},
-std::array<float,2>{0.26839447f, 0.374411702f},
-std::array<float,2>{0.638263226f, 0.99176079f},
-std::array<float,2>{0.997361422f, 0.174642041f},
-std::array<float,2>{0.154692233f, 0.524507403f},
-std::array<float,2>{0.0175226703f, 0.0177503135f},
-std::array<float,2>{0.861208797f, 0.663876891f},
-std::array<float,2>{0.61714679f, 0.42516315f},
-std::array<float,2>{0.465605944f, 0.839750588f},
-std::array<float,2>{0.19218412f, 0.489941448f},
-std::array<float,2>{0.933082998f, 0.804370821f},
-std::array<float,2>{0.692167699f, 0.0951353833f},
-std::array<float,2>{0.356877565f, 0.691764832f},
-std::array<float,2>{0.427301735f, 0.241059512f},
-std::array<float,2>{0.527687311f, 0.614928901f},
-std::array<float,2>{0.763062775f, 0.279154956f},
-std::array<float,2>{0.123913027f, 0.888130248f},
-std::array<float,2>{0.329269737f, 0.393508732f},
-std::array<float,2>{0.72663343f, 0.854455769f},
-std::array<float,2>{0.90060699f, 0.0457900167f},
-std::array<float,2>{0.249184772f, 0.625803709f},
-std::array<float,2>{0.0910612345f, 0.146348074f},
-std::array<float,2>{0.810437977f, 0.53260386f},
-std::array<float,2>{0.545719624f, 0.343646526f},
-std::array<float,2>{0.38422066f, 0.950893164f},
-std::array<float,2>{0.163482353f, 0.29211849f},
-std::array<float,2>{0.945007086f, 0.913759708f},
-std::array<float,2>{0.667132139f, 0.207231075f},
-std::array<float,2>{0.282483995f, 0.573197722f},
-std::array<float,2>{0.474111974f, 0.0932438374f},
-std::array<float,2>{0.583446205f, 0.721417069f},
-std::array<float,2>{0.823706388f, 0.461808562f},
-std::array<float,2>{0.0426773615f, 0.765776396f},
-std::array<float,2>{0.434882492f, 0.350613654f},
-std::array<float,2>{0.522070587f, 0.981185198f},
-std::array<float,2>{0.756750941f, 0.158715263f},
-std::array<float,2>{0.112390853f, 0.506819725f},
-std::array<float,2>{0.198617205f, 0.00469581271f},
-std::array<float,2>{0.926064909f, 0.677402794f},
-std::array<float,2>{0.698244035f, 0.415313393f},
-std::array<float,2>{0.3472417f, 0.818451524f},
-std::array<float,2>{0.0252823215f, 0.476606488f},
-std::array<float,2>{0.867441177f, 0.78209269f},
-std::array<float,2>{0.619523168f, 0.113009669f},
-std::array<float,2>{0.456535757f, 0.71147579f},
-std::array<float,2>{0.274042726f, 0.229905367f},
-std::array<float,2>{0.628654957f, 0.603813469f},
-std::array<float,2>{0.985818744f, 0.250897169f},
-std::array<float,2>{0.140777126f, 0.904150903f},
-std::array<float,2>{0.437937438f, 0.44299975f},
-std::array<float,2>{0.595958948f, 0.75642544f},
-std::array<float,2>{0.848720431f, 0.0663661808f},
-std::array<float,2>{0.0134028057f, 0.739303112f},
-std::array<float,2>{0.137577191f, 0.188607886f},
-std::array<float,2>{0.97693789f, 0.583176196f},
-std::array<float,2>{0.642513275f, 0.304363906f},
-std::array<float,2>{0.256248742f, 0.934101462f},
-std::array<float,2>{0.106501348f, 0.325930297f},
-std::array<float,2>{0.780867517f, 0.9601928f},
-std::array<float,2>{0.503455579f, 0.135343745f},
-std::array<float,2>{0.410373926f, 0.55692476f},
-std::array<float,2>{0.36184454f, 0.0595892891f},
-std::array<float,2>{0.710646451f, 0.647078454f},
-std::array<float,2>{0.913372219f, 0.380961001f},
-std::array<float,2>{0.212946951f, 0.869795918f},
-std::array<float,2>{0.300265163f, 0.276149869f},
-std::array<float,2>{0.677553952f, 0.886229992f},
-std::array<float,2>{0.966953278f, 0.234844193f},
-std::array<float,2>{0.179447666f, 0.611825585f},
-std::array<float,2>{0.0552239716f, 0.0991982594f},
-std::array<float,2>{0.837929726f, 0.687944472f},
-std::array<float,2>{0.576543272f, 0.488084018f},
-std::array<float,2>{0.484696269f, 0.79906857f},
-std::array<float,2>{0.227145478f, 0.425781339f},
-std::array<float,2>{0.877770185f, 0.841966867f},
-std::array<float,2>{0.745661497f, 0.0218084473f},
-std::array<float,2>{0.315328121f, 0.65664804f},
-std::array<float,2>{0.399537921f, 0.177701443f},
-std::array<float,2>{0.55622679f, 0.527938724f},
-std::array<float,2>{0.793991208f, 0.369995177f},
-std::array<float,2>{0.0679158717f, 0.986967027f},
-std::array<float,2>{0.261248082f, 0.498171091f},
-std::array<float,2>{0.653375268f, 0.810358822f},
-std::array<float,2>{0.973534048f, 0.107469857f},
-std::array<float,2>{0.132717535f, 0.69717294f},
-std::array<float,2>{0.00143704202f, 0.247322619f},
-std::array<float,2>{0.854722023f, 0.624699235f},
-std::array<float,2>{0.60691303f, 0.267666638f},
-std::array<float,2>{0.449368328f, 0.87671119f},
-std::array<float,2>{0.207961768f, 0.360978574f},
-std::array<float,2>{0.921864629f, 0.998699486f},
-std::array<float,2>{0.715757966f, 0.186609775f},
-std::array<float,2>{0.373402476f, 0.521462619f},
-std::array<float,2>{0.416151315f, 0.0301670469f},
-std::array<float,2>{0.508664191f, 0.66420871f},
-std::array<float,2>{0.767248034f, 0.436131775f},
-std::array<float,2>{0.101148568f, 0.829491496f},
-std::array<float,2>{0.499423414f, 0.306621462f},
-std::array<float,2>{0.563297689f, 0.927603364f},
-std::array<float,2>{0.832965374f, 0.195441738f},
-std::array<float,2>{0.0481150746f, 0.590038657f},
-std::array<float,2>{0.183661297f, 0.0751450136f},
-std::array<float,2>{0.959464312f, 0.745718896f},
-std::array<float,2>{0.687309742f, 0.445494324f},
-std::array<float,2>{0.305954099f, 0.763237715f},
-std::array<float,2>{0.0716489926f, 0.38395232f},
-std::array<float,2>{0.781395018f, 0.867077529f},
-std::array<float,2>{0.553445578f, 0.0537353531f},
-std::array<float,2>{0.394114345f, 0.652320862f},
-std::array<float,2>{0.321001083f, 0.128256902f},
-std::array<float,2>{0.74001354f, 0.549480557f},
-std::array<float,2>{0.890195608f, 0.320153713f},
-std::array<float,2>{0.221143767f, 0.965441883f},
-std::array<float,2>{0.375291765f, 0.407874733f},
-std::array<float,2>{0.534908891f, 0.824172258f},
-std::array<float,2>{0.799665332f, 0.00810391922f},
-std::array<float,2>{0.0791155398f, 0.68597436f},
-std::array<float,2>{0.235567719f, 0.164789692f},
-std::array<float,2>{0.89065212f, 0.512407243f},
-std::array<float,2>{0.725167215f, 0.355364859f},
-std::array<float,2>{0.337283492f, 0.973565757f},
-std::array<float,2>{0.0360761397f, 0.260177165f},
-std::array<float,2>{0.814346731f, 0.898191214f},
-std::array<float,2>{0.592732489f, 0.226496592f},
-std::array<float,2>{0.48340854f, 0.60027051f},
-std::array<float,2>{0.294250011f, 0.11808607f},
-std::array<float,2>{0.657898784f, 0.703690588f},
-std::array<float,2>{0.945932329f, 0.469357312f},
-std::array<float,2>{0.16720733f, 0.790485322f},
-std::array<float,2>{0.355021477f, 0.332497925f},
-std::array<float,2>{0.690416336f, 0.943269193f},
-std::array<float,2>{0.937229335f, 0.149733424f},
-std::array<float,2>{0.187751472f, 0.541481674f},
-std::array<float,2>{0.11834719f, 0.0377019122f},
-std::array<float,2>{0.760611773f, 0.639201999f},
-std::array<float,2>{0.525340378f, 0.398916185f},
-std::array<float,2>{0.422103792f, 0.843777716f},
-std::array<float,2>{0.148946866f, 0.455810279f},
-std::array<float,2>{0.993387461f, 0.779333055f},
-std::array<float,2>{0.633746386f, 0.0848848745f},
-std::array<float,2>{0.271342129f, 0.733665884f},
-std::array<float,2>{0.462129533f, 0.215881675f},
-std::array<float,2>{0.610908329f, 0.568672061f},
-std::array<float,2>{0.865352333f, 0.281764239f},
-std::array<float,2>{0.0204851814f, 0.921213627f}}
\ No newline at end of file
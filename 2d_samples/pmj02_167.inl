@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.135091379f, 0.46592918f},
-std::array<float,2>{0.86394918f, 0.729941487f},
-std::array<float,2>{0.582761824f, 0.199023724f},
-std::array<float,2>{0.296381444f, 0.91563648f},
-std::array<float,2>{0.495628059f, 0.117374025f},
-std::array<float,2>{0.665717006f, 0.849630773f},
-std::array<float,2>{0.892834365f, 0.290884018f},
-std::array<float,2>{0.11533004f, 0.617049277f},
-std::array<float,2>{0.369741827f, 0.374240398f},
-std::array<float,2>{0.531473517f, 0.528230846f},
-std::array<float,2>{0.774221122f, 0.0266922433f},
-std::array<float,2>{0.247769982f, 0.752912104f},
-std::array<float,2>{0.05184846f, 0.135892048f},
-std::array<float,2>{0.951600909f, 0.980310977f},
-std::array<float,2>{0.701137006f, 0.409665972f},
-std::array<float,2>{0.394822776f, 0.653835177f},
-std::array<float,2>{0.0701191127f, 0.259793252f},
-std::array<float,2>{0.927326262f, 0.571366608f},
-std::array<float,2>{0.628584445f, 0.0898812786f},
-std::array<float,2>{0.457441688f, 0.829183221f},
-std::array<float,2>{0.273347229f, 0.231273547f},
-std::array<float,2>{0.623183668f, 0.894093275f},
-std::array<float,2>{0.83235842f, 0.499325037f},
-std::array<float,2>{0.186604634f, 0.71698457f},
-std::array<float,2>{0.41067186f, 0.379882008f},
-std::array<float,2>{0.742099583f, 0.658501387f},
-std::array<float,2>{0.981223822f, 0.170552745f},
-std::array<float,2>{0.00306492578f, 0.940390408f},
-std::array<float,2>{0.210010663f, 0.0485399067f},
-std::array<float,2>{0.788330913f, 0.793015778f},
-std::array<float,2>{0.523425341f, 0.335949481f},
-std::array<float,2>{0.330100745f, 0.557127416f},
-std::array<float,2>{0.0209118333f, 0.431618094f},
-std::array<float,2>{0.987377167f, 0.630657792f},
-std::array<float,2>{0.723435879f, 0.155238047f},
-std::array<float,2>{0.435927719f, 0.986225963f},
-std::array<float,2>{0.315659821f, 0.0131170135f},
-std::array<float,2>{0.508488834f, 0.78079474f},
-std::array<float,2>{0.803014636f, 0.353064746f},
-std::array<float,2>{0.187687829f, 0.501496732f},
-std::array<float,2>{0.44777897f, 0.311645478f},
-std::array<float,2>{0.650481224f, 0.603966534f},
-std::array<float,2>{0.917153776f, 0.101462431f},
-std::array<float,2>{0.0786324292f, 0.866749227f},
-std::array<float,2>{0.169294178f, 0.209747478f},
-std::array<float,2>{0.820639074f, 0.936937153f},
-std::array<float,2>{0.599869609f, 0.442678154f},
-std::array<float,2>{0.2522268f, 0.742901087f},
-std::array<float,2>{0.229585707f, 0.327194363f},
-std::array<float,2>{0.76058197f, 0.535585284f},
-std::array<float,2>{0.561779022f, 0.0401203074f},
-std::array<float,2>{0.35762763f, 0.806522191f},
-std::array<float,2>{0.385266334f, 0.176645368f},
-std::array<float,2>{0.705751061f, 0.964056015f},
-std::array<float,2>{0.96590662f, 0.398800343f},
-std::array<float,2>{0.0403027907f, 0.679575622f},
-std::array<float,2>{0.309121788f, 0.479127675f},
-std::array<float,2>{0.576210618f, 0.693145216f},
-std::array<float,2>{0.849469006f, 0.245745599f},
-std::array<float,2>{0.145155594f, 0.887017429f},
-std::array<float,2>{0.0951508433f, 0.0715604722f},
-std::array<float,2>{0.884867907f, 0.8254264f},
-std::array<float,2>{0.677893162f, 0.272051275f},
-std::array<float,2>{0.472536117f, 0.578175664f},
-std::array<float,2>{0.195591643f, 0.391523302f},
-std::array<float,2>{0.810516715f, 0.682051539f},
-std::array<float,2>{0.504821122f, 0.185407922f},
-std::array<float,2>{0.327983946f, 0.954856575f},
-std::array<float,2>{0.428509355f, 0.0362715796f},
-std::array<float,2>{0.729183972f, 0.80335176f},
-std::array<float,2>{0.997934699f, 0.318087995f},
-std::array<float,2>{0.0243141837f, 0.541292429f},
-std::array<float,2>{0.263044804f, 0.28034246f},
-std::array<float,2>{0.604332924f, 0.59232831f},
-std::array<float,2>{0.813000083f, 0.0687825829f},
-std::array<float,2>{0.163423985f, 0.819053173f},
-std::array<float,2>{0.0914105177f, 0.239059672f},
-std::array<float,2>{0.906812251f, 0.877160549f},
-std::array<float,2>{0.640855908f, 0.46910733f},
-std::array<float,2>{0.443164825f, 0.697082102f},
-std::array<float,2>{0.0314599983f, 0.345276386f},
-std::array<float,2>{0.953463376f, 0.510072052f},
-std::array<float,2>{0.712769866f, 0.00393586885f},
-std::array<float,2>{0.380936235f, 0.768038988f},
-std::array<float,2>{0.346970558f, 0.141174182f},
-std::array<float,2>{0.551226556f, 0.998819172f},
-std::array<float,2>{0.750120938f, 0.426632106f},
-std::array<float,2>{0.221051559f, 0.634860754f},
-std::array<float,2>{0.479117125f, 0.449822307f},
-std::array<float,2>{0.68078208f, 0.737286389f},
-std::array<float,2>{0.882487833f, 0.21572867f},
-std::array<float,2>{0.107641175f, 0.923796713f},
-std::array<float,2>{0.153396174f, 0.104876615f},
-std::array<float,2>{0.852651477f, 0.874906838f},
-std::array<float,2>{0.56262809f, 0.297129422f},
-std::array<float,2>{0.303285986f, 0.597145081f},
-std::array<float,2>{0.120467179f, 0.49168843f},
-std::array<float,2>{0.899243176f, 0.710839987f},
-std::array<float,2>{0.660722017f, 0.219150633f},
-std::array<float,2>{0.490579784f, 0.899590373f},
-std::array<float,2>{0.286398858f, 0.0786775351f},
-std::array<float,2>{0.586850762f, 0.837294817f},
-std::array<float,2>{0.87183851f, 0.251085639f},
-std::array<float,2>{0.125419647f, 0.565523922f},
-std::array<float,2>{0.402155578f, 0.329829067f},
-std::array<float,2>{0.693984389f, 0.553047836f},
-std::array<float,2>{0.942836642f, 0.057284411f},
-std::array<float,2>{0.0596008971f, 0.782102823f},
-std::array<float,2>{0.237662181f, 0.160846695f},
-std::array<float,2>{0.772045493f, 0.949550152f},
-std::array<float,2>{0.539570093f, 0.388058752f},
-std::array<float,2>{0.361786991f, 0.667443335f},
-std::array<float,2>{0.174629897f, 0.282958746f},
-std::array<float,2>{0.836782932f, 0.617502272f},
-std::array<float,2>{0.614276171f, 0.116760433f},
-std::array<float,2>{0.27714178f, 0.852594256f},
-std::array<float,2>{0.465179414f, 0.188123614f},
-std::array<float,2>{0.633948267f, 0.912709534f},
-std::array<float,2>{0.932625532f, 0.454438806f},
-std::array<float,2>{0.0758519322f, 0.723029077f},
-std::array<float,2>{0.337258637f, 0.418270499f},
-std::array<float,2>{0.527316153f, 0.643084586f},
-std::array<float,2>{0.789149463f, 0.127356514f},
-std::array<float,2>{0.215542957f, 0.969829202f},
-std::array<float,2>{0.0101834349f, 0.0190830454f},
-std::array<float,2>{0.975283027f, 0.764941335f},
-std::array<float,2>{0.743757963f, 0.365284532f},
-std::array<float,2>{0.421598405f, 0.519296944f},
-std::array<float,2>{0.244647682f, 0.47328487f},
-std::array<float,2>{0.780829072f, 0.699280918f},
-std::array<float,2>{0.537584543f, 0.234458983f},
-std::array<float,2>{0.371147096f, 0.881572902f},
-std::array<float,2>{0.393929869f, 0.0652861148f},
-std::array<float,2>{0.698101759f, 0.812667012f},
-std::array<float,2>{0.948543906f, 0.277168304f},
-std::array<float,2>{0.0502612367f, 0.588778138f},
-std::array<float,2>{0.290898651f, 0.314732552f},
-std::array<float,2>{0.581902921f, 0.546625674f},
-std::array<float,2>{0.86083132f, 0.0338389575f},
-std::array<float,2>{0.139055535f, 0.79900527f},
-std::array<float,2>{0.109939687f, 0.180317387f},
-std::array<float,2>{0.895169675f, 0.960563064f},
-std::array<float,2>{0.671581328f, 0.395135581f},
-std::array<float,2>{0.496742547f, 0.685387909f},
-std::array<float,2>{0.00636652298f, 0.303000629f},
-std::array<float,2>{0.97667855f, 0.601456404f},
-std::array<float,2>{0.738120377f, 0.105977587f},
-std::array<float,2>{0.410072446f, 0.867801607f},
-std::array<float,2>{0.332759023f, 0.212502584f},
-std::array<float,2>{0.519226253f, 0.926429093f},
-std::array<float,2>{0.781438708f, 0.448083282f},
-std::array<float,2>{0.20595175f, 0.741551816f},
-std::array<float,2>{0.454451591f, 0.425657868f},
-std::array<float,2>{0.630458355f, 0.640136898f},
-std::array<float,2>{0.924768269f, 0.146052361f},
-std::array<float,2>{0.0636605471f, 0.995428443f},
-std::array<float,2>{0.182874858f, 0.00342200743f},
-std::array<float,2>{0.830303788f, 0.770660043f},
-std::array<float,2>{0.619520068f, 0.347980469f},
-std::array<float,2>{0.266639203f, 0.514072716f},
-std::array<float,2>{0.085135825f, 0.384439498f},
-std::array<float,2>{0.919367552f, 0.668079972f},
-std::array<float,2>{0.654927373f, 0.158802271f},
-std::array<float,2>{0.451076418f, 0.947398603f},
-std::array<float,2>{0.254290789f, 0.0588010699f},
-std::array<float,2>{0.594751716f, 0.788397908f},
-std::array<float,2>{0.824256122f, 0.334895521f},
-std::array<float,2>{0.16730082f, 0.547580481f},
-std::array<float,2>{0.430185705f, 0.255781263f},
-std::array<float,2>{0.721941352f, 0.569752872f},
-std::array<float,2>{0.991997898f, 0.0821304619f},
-std::array<float,2>{0.0173430033f, 0.841983199f},
-std::array<float,2>{0.192700088f, 0.223013639f},
-std::array<float,2>{0.799627423f, 0.902577102f},
-std::array<float,2>{0.512483954f, 0.485319704f},
-std::array<float,2>{0.317684412f, 0.704337656f},
-std::array<float,2>{0.144409001f, 0.362275302f},
-std::array<float,2>{0.845514059f, 0.520493388f},
-std::array<float,2>{0.573751748f, 0.020491099f},
-std::array<float,2>{0.308501273f, 0.761275113f},
-std::array<float,2>{0.474349618f, 0.129308656f},
-std::array<float,2>{0.67547822f, 0.976053715f},
-std::array<float,2>{0.889168978f, 0.414246053f},
-std::array<float,2>{0.0988324732f, 0.64812386f},
-std::array<float,2>{0.355025738f, 0.459196657f},
-std::array<float,2>{0.558402479f, 0.720689237f},
-std::array<float,2>{0.764494896f, 0.193550333f},
-std::array<float,2>{0.230855465f, 0.907568514f},
-std::array<float,2>{0.0449382029f, 0.110693514f},
-std::array<float,2>{0.962649107f, 0.858297884f},
-std::array<float,2>{0.710549057f, 0.285434723f},
-std::array<float,2>{0.386955649f, 0.624821782f},
-std::array<float,2>{0.159732983f, 0.412832677f},
-std::array<float,2>{0.817821026f, 0.649107456f},
-std::array<float,2>{0.606861949f, 0.137080744f},
-std::array<float,2>{0.2589131f, 0.98287791f},
-std::array<float,2>{0.440507203f, 0.0279254969f},
-std::array<float,2>{0.646021426f, 0.755997121f},
-std::array<float,2>{0.913623154f, 0.37043035f},
-std::array<float,2>{0.0887235776f, 0.524656713f},
-std::array<float,2>{0.322735161f, 0.295387924f},
-std::array<float,2>{0.500222981f, 0.609633863f},
-std::array<float,2>{0.804978788f, 0.124537058f},
-std::array<float,2>{0.201609626f, 0.844149172f},
-std::array<float,2>{0.0277259741f, 0.201544598f},
-std::array<float,2>{0.992331624f, 0.920481801f},
-std::array<float,2>{0.730867743f, 0.461298704f},
-std::array<float,2>{0.425724804f, 0.733403862f},
-std::array<float,2>{0.103543721f, 0.343514055f},
-std::array<float,2>{0.87671119f, 0.561263919f},
-std::array<float,2>{0.684379399f, 0.0524447486f},
-std::array<float,2>{0.483763695f, 0.792101681f},
-std::array<float,2>{0.297742218f, 0.166728914f},
-std::array<float,2>{0.570126295f, 0.944581211f},
-std::array<float,2>{0.85860455f, 0.3774077f},
-std::array<float,2>{0.151011869f, 0.660752773f},
-std::array<float,2>{0.375792533f, 0.493685544f},
-std::array<float,2>{0.715901077f, 0.71178025f},
-std::array<float,2>{0.960018158f, 0.228617698f},
-std::array<float,2>{0.0375485122f, 0.896902025f},
-std::array<float,2>{0.226058066f, 0.0862636939f},
-std::array<float,2>{0.755156577f, 0.833856463f},
-std::array<float,2>{0.548817813f, 0.263658553f},
-std::array<float,2>{0.351218373f, 0.575540841f},
-std::array<float,2>{0.0562708378f, 0.437511861f},
-std::array<float,2>{0.93847394f, 0.747591913f},
-std::array<float,2>{0.691400528f, 0.204172224f},
-std::array<float,2>{0.404519558f, 0.933033049f},
-std::array<float,2>{0.365221828f, 0.0966502428f},
-std::array<float,2>{0.545279145f, 0.860272348f},
-std::array<float,2>{0.769102156f, 0.307828575f},
-std::array<float,2>{0.241396472f, 0.608292341f},
-std::array<float,2>{0.486462504f, 0.359362274f},
-std::array<float,2>{0.657568872f, 0.506226599f},
-std::array<float,2>{0.905550361f, 0.0115120225f},
-std::array<float,2>{0.121696196f, 0.776185811f},
-std::array<float,2>{0.129626125f, 0.149361655f},
-std::array<float,2>{0.867292583f, 0.990984917f},
-std::array<float,2>{0.593626261f, 0.434852958f},
-std::array<float,2>{0.281352997f, 0.627272904f},
-std::array<float,2>{0.213300616f, 0.267592311f},
-std::array<float,2>{0.796368897f, 0.58377707f},
-std::array<float,2>{0.527677476f, 0.0763603374f},
-std::array<float,2>{0.341441542f, 0.820823073f},
-std::array<float,2>{0.415467918f, 0.247688323f},
-std::array<float,2>{0.74875617f, 0.884902298f},
-std::array<float,2>{0.97070086f, 0.482320517f},
-std::array<float,2>{0.0148920296f, 0.688937485f},
-std::array<float,2>{0.278855145f, 0.402685612f},
-std::array<float,2>{0.612929106f, 0.673475921f},
-std::array<float,2>{0.841490149f, 0.174147502f},
-std::array<float,2>{0.179099888f, 0.96714586f},
-std::array<float,2>{0.0711824894f, 0.044889573f},
-std::array<float,2>{0.935074866f, 0.809265256f},
-std::array<float,2>{0.637944877f, 0.320446044f},
-std::array<float,2>{0.462160707f, 0.533805966f},
-std::array<float,2>{0.185185507f, 0.496202379f},
-std::array<float,2>{0.835461795f, 0.716749072f},
-std::array<float,2>{0.622786283f, 0.234156221f},
-std::array<float,2>{0.269626528f, 0.89091599f},
-std::array<float,2>{0.460241169f, 0.0927418545f},
-std::array<float,2>{0.625466704f, 0.831680655f},
-std::array<float,2>{0.929645658f, 0.258570731f},
-std::array<float,2>{0.0674252361f, 0.572907448f},
-std::array<float,2>{0.329265207f, 0.338148892f},
-std::array<float,2>{0.520708382f, 0.555901945f},
-std::array<float,2>{0.786213338f, 0.0507649705f},
-std::array<float,2>{0.207956329f, 0.796019793f},
-std::array<float,2>{0.000421066274f, 0.168164119f},
-std::array<float,2>{0.982633233f, 0.938518524f},
-std::array<float,2>{0.739329338f, 0.38127768f},
-std::array<float,2>{0.41242528f, 0.657075286f},
-std::array<float,2>{0.11466264f, 0.291641325f},
-std::array<float,2>{0.892276168f, 0.614230752f},
-std::array<float,2>{0.667291403f, 0.120319098f},
-std::array<float,2>{0.493858725f, 0.84808749f},
-std::array<float,2>{0.293846875f, 0.196941823f},
-std::array<float,2>{0.584102929f, 0.916042209f},
-std::array<float,2>{0.866518199f, 0.46714431f},
-std::array<float,2>{0.133520409f, 0.727642655f},
-std::array<float,2>{0.398343414f, 0.407084078f},
-std::array<float,2>{0.702361822f, 0.65451169f},
-std::array<float,2>{0.949313223f, 0.134713873f},
-std::array<float,2>{0.0533012934f, 0.976969779f},
-std::array<float,2>{0.248442844f, 0.024072241f},
-std::array<float,2>{0.775517166f, 0.750223875f},
-std::array<float,2>{0.53326422f, 0.372814387f},
-std::array<float,2>{0.367861509f, 0.53033787f},
-std::array<float,2>{0.0425758101f, 0.402057052f},
-std::array<float,2>{0.967937231f, 0.676665604f},
-std::array<float,2>{0.704878032f, 0.17838718f},
-std::array<float,2>{0.382825613f, 0.961901486f},
-std::array<float,2>{0.356441706f, 0.0416205749f},
-std::array<float,2>{0.559364736f, 0.808586419f},
-std::array<float,2>{0.759565353f, 0.326136708f},
-std::array<float,2>{0.2275206f, 0.537383378f},
-std::array<float,2>{0.470346183f, 0.271467596f},
-std::array<float,2>{0.67748791f, 0.580884337f},
-std::array<float,2>{0.884521127f, 0.072559908f},
-std::array<float,2>{0.0960892811f, 0.828038692f},
-std::array<float,2>{0.146854937f, 0.24413383f},
-std::array<float,2>{0.851471722f, 0.890377283f},
-std::array<float,2>{0.57518959f, 0.477052301f},
-std::array<float,2>{0.311693668f, 0.694075048f},
-std::array<float,2>{0.190298796f, 0.353902638f},
-std::array<float,2>{0.801889539f, 0.503102362f},
-std::array<float,2>{0.511264503f, 0.0140958102f},
-std::array<float,2>{0.314440429f, 0.778595746f},
-std::array<float,2>{0.435342431f, 0.152385682f},
-std::array<float,2>{0.726000726f, 0.987747669f},
-std::array<float,2>{0.984751344f, 0.433566183f},
-std::array<float,2>{0.0225452278f, 0.631464958f},
-std::array<float,2>{0.250000834f, 0.444827348f},
-std::array<float,2>{0.598252058f, 0.744317591f},
-std::array<float,2>{0.822709441f, 0.207971901f},
-std::array<float,2>{0.170884326f, 0.934164166f},
-std::array<float,2>{0.0816162229f, 0.0981158614f},
-std::array<float,2>{0.914943933f, 0.86360234f},
-std::array<float,2>{0.65028888f, 0.30942601f},
-std::array<float,2>{0.446947485f, 0.601875186f},
-std::array<float,2>{0.220272675f, 0.429570705f},
-std::array<float,2>{0.752516389f, 0.633880019f},
-std::array<float,2>{0.554392993f, 0.143198758f},
-std::array<float,2>{0.345604658f, 0.997564673f},
-std::array<float,2>{0.380660504f, 0.00771865435f},
-std::array<float,2>{0.713310361f, 0.766159475f},
-std::array<float,2>{0.956642807f, 0.346787572f},
-std::array<float,2>{0.0332600288f, 0.508935452f},
-std::array<float,2>{0.301802427f, 0.300469577f},
-std::array<float,2>{0.565877736f, 0.594869196f},
-std::array<float,2>{0.854458809f, 0.101793826f},
-std::array<float,2>{0.155688643f, 0.872200429f},
-std::array<float,2>{0.106668405f, 0.217316017f},
-std::array<float,2>{0.879098833f, 0.924509287f},
-std::array<float,2>{0.682957768f, 0.452270716f},
-std::array<float,2>{0.47818014f, 0.735177994f},
-std::array<float,2>{0.0269528665f, 0.320162535f},
-std::array<float,2>{0.998697877f, 0.539344251f},
-std::array<float,2>{0.728178203f, 0.0384169035f},
-std::array<float,2>{0.426716089f, 0.802601159f},
-std::array<float,2>{0.324250102f, 0.186137214f},
-std::array<float,2>{0.505916059f, 0.955723763f},
-std::array<float,2>{0.811779857f, 0.393507421f},
-std::array<float,2>{0.199169591f, 0.680013001f},
-std::array<float,2>{0.445095956f, 0.471340686f},
-std::array<float,2>{0.643280745f, 0.698993802f},
-std::array<float,2>{0.909823596f, 0.240535006f},
-std::array<float,2>{0.0934480801f, 0.875638843f},
-std::array<float,2>{0.161619216f, 0.0678284019f},
-std::array<float,2>{0.815630794f, 0.817165136f},
-std::array<float,2>{0.601618588f, 0.277727574f},
-std::array<float,2>{0.26383543f, 0.591484964f},
-std::array<float,2>{0.0765171275f, 0.456157237f},
-std::array<float,2>{0.931160092f, 0.724718988f},
-std::array<float,2>{0.635089695f, 0.191073835f},
-std::array<float,2>{0.467468113f, 0.91020596f},
-std::array<float,2>{0.275234193f, 0.11392165f},
-std::array<float,2>{0.61559236f, 0.854617357f},
-std::array<float,2>{0.839177787f, 0.283468932f},
-std::array<float,2>{0.173237115f, 0.620172441f},
-std::array<float,2>{0.419748574f, 0.365201443f},
-std::array<float,2>{0.745139003f, 0.515702486f},
-std::array<float,2>{0.973706961f, 0.0164325293f},
-std::array<float,2>{0.00833155122f, 0.763629735f},
-std::array<float,2>{0.218214363f, 0.126432598f},
-std::array<float,2>{0.792470694f, 0.971764743f},
-std::array<float,2>{0.524162054f, 0.421782672f},
-std::array<float,2>{0.338463962f, 0.641757369f},
-std::array<float,2>{0.127968922f, 0.253870845f},
-std::array<float,2>{0.874883115f, 0.563776553f},
-std::array<float,2>{0.589597285f, 0.0804920122f},
-std::array<float,2>{0.287603647f, 0.838610649f},
-std::array<float,2>{0.489918113f, 0.222042561f},
-std::array<float,2>{0.662137151f, 0.901513517f},
-std::array<float,2>{0.901522756f, 0.489706606f},
-std::array<float,2>{0.118840843f, 0.708271563f},
-std::array<float,2>{0.361090988f, 0.390405089f},
-std::array<float,2>{0.542473972f, 0.664189875f},
-std::array<float,2>{0.770703137f, 0.163558826f},
-std::array<float,2>{0.234772921f, 0.952887058f},
-std::array<float,2>{0.0610676371f, 0.055703897f},
-std::array<float,2>{0.944621146f, 0.783965886f},
-std::array<float,2>{0.692672968f, 0.330494583f},
-std::array<float,2>{0.399765581f, 0.551096916f},
-std::array<float,2>{0.204879329f, 0.445643455f},
-std::array<float,2>{0.784207165f, 0.739490509f},
-std::array<float,2>{0.51732254f, 0.214109451f},
-std::array<float,2>{0.334078223f, 0.928902447f},
-std::array<float,2>{0.406669557f, 0.107870862f},
-std::array<float,2>{0.734999418f, 0.870281935f},
-std::array<float,2>{0.979978502f, 0.30129844f},
-std::array<float,2>{0.00435708929f, 0.597760618f},
-std::array<float,2>{0.268680811f, 0.350869f},
-std::array<float,2>{0.618219793f, 0.51184845f},
-std::array<float,2>{0.828202009f, 0.000738000555f},
-std::array<float,2>{0.180296361f, 0.772406101f},
-std::array<float,2>{0.0645575821f, 0.148141965f},
-std::array<float,2>{0.923002779f, 0.993293643f},
-std::array<float,2>{0.632623076f, 0.422086596f},
-std::array<float,2>{0.455475777f, 0.638016582f},
-std::array<float,2>{0.0474789664f, 0.275179625f},
-std::array<float,2>{0.947085679f, 0.586312294f},
-std::array<float,2>{0.696445107f, 0.062958926f},
-std::array<float,2>{0.392575115f, 0.815633774f},
-std::array<float,2>{0.373536468f, 0.237390578f},
-std::array<float,2>{0.536342502f, 0.880289912f},
-std::array<float,2>{0.778313339f, 0.476202309f},
-std::array<float,2>{0.243117914f, 0.702165365f},
-std::array<float,2>{0.498662919f, 0.396638304f},
-std::array<float,2>{0.669855416f, 0.686615884f},
-std::array<float,2>{0.897988677f, 0.181997105f},
-std::array<float,2>{0.112415142f, 0.957774997f},
-std::array<float,2>{0.138173163f, 0.031713631f},
-std::array<float,2>{0.862511337f, 0.798354268f},
-std::array<float,2>{0.578976154f, 0.312892169f},
-std::array<float,2>{0.291159868f, 0.544245422f},
-std::array<float,2>{0.0998068303f, 0.416507661f},
-std::array<float,2>{0.887514293f, 0.644577622f},
-std::array<float,2>{0.672521114f, 0.131874114f},
-std::array<float,2>{0.475231946f, 0.973428607f},
-std::array<float,2>{0.306264937f, 0.0222999714f},
-std::array<float,2>{0.570927322f, 0.759096384f},
-std::array<float,2>{0.847281039f, 0.359676182f},
-std::array<float,2>{0.141133815f, 0.522313476f},
-std::array<float,2>{0.389579624f, 0.28769961f},
-std::array<float,2>{0.707876444f, 0.622072518f},
-std::array<float,2>{0.964668751f, 0.113043852f},
-std::array<float,2>{0.044752378f, 0.856307209f},
-std::array<float,2>{0.234269261f, 0.192712873f},
-std::array<float,2>{0.762742519f, 0.909840882f},
-std::array<float,2>{0.555573523f, 0.45772621f},
-std::array<float,2>{0.352543741f, 0.720935702f},
-std::array<float,2>{0.165589318f, 0.33212015f},
-std::array<float,2>{0.826447129f, 0.549435854f},
-std::array<float,2>{0.596502066f, 0.0612338409f},
-std::array<float,2>{0.257736415f, 0.786700606f},
-std::array<float,2>{0.452232897f, 0.157942042f},
-std::array<float,2>{0.652704477f, 0.945782125f},
-std::array<float,2>{0.921040118f, 0.385259151f},
-std::array<float,2>{0.0828794241f, 0.670350194f},
-std::array<float,2>{0.319082052f, 0.486483067f},
-std::array<float,2>{0.513869822f, 0.705186367f},
-std::array<float,2>{0.798502624f, 0.224768579f},
-std::array<float,2>{0.19345358f, 0.904537082f},
-std::array<float,2>{0.0180899221f, 0.0858180597f},
-std::array<float,2>{0.988833606f, 0.840070546f},
-std::array<float,2>{0.719315469f, 0.25724557f},
-std::array<float,2>{0.432400495f, 0.56813848f},
-std::array<float,2>{0.150008619f, 0.376496613f},
-std::array<float,2>{0.856021404f, 0.663798869f},
-std::array<float,2>{0.567605436f, 0.165995404f},
-std::array<float,2>{0.299780399f, 0.942900658f},
-std::array<float,2>{0.480632216f, 0.0541601181f},
-std::array<float,2>{0.687447488f, 0.789613485f},
-std::array<float,2>{0.877055883f, 0.34068948f},
-std::array<float,2>{0.103042521f, 0.560025334f},
-std::array<float,2>{0.349544048f, 0.263936907f},
-std::array<float,2>{0.550679982f, 0.577913821f},
-std::array<float,2>{0.755936861f, 0.0895970166f},
-std::array<float,2>{0.224417433f, 0.834885836f},
-std::array<float,2>{0.0355588309f, 0.226606905f},
-std::array<float,2>{0.958396494f, 0.894818842f},
-std::array<float,2>{0.718533635f, 0.494390845f},
-std::array<float,2>{0.378269494f, 0.714321375f},
-std::array<float,2>{0.0863749459f, 0.368962497f},
-std::array<float,2>{0.91081506f, 0.52732873f},
-std::array<float,2>{0.647051275f, 0.0307789017f},
-std::array<float,2>{0.437541366f, 0.755339861f},
-std::array<float,2>{0.259994596f, 0.140504032f},
-std::array<float,2>{0.608587205f, 0.980991423f},
-std::array<float,2>{0.819134891f, 0.411897182f},
-std::array<float,2>{0.157262534f, 0.652042627f},
-std::array<float,2>{0.421935767f, 0.463137507f},
-std::array<float,2>{0.732738078f, 0.732330859f},
-std::array<float,2>{0.995966613f, 0.200358808f},
-std::array<float,2>{0.0306646787f, 0.919034183f},
-std::array<float,2>{0.201122656f, 0.121260799f},
-std::array<float,2>{0.806824982f, 0.847169399f},
-std::array<float,2>{0.50260812f, 0.293477774f},
-std::array<float,2>{0.321922332f, 0.61266017f},
-std::array<float,2>{0.0128122568f, 0.483112097f},
-std::array<float,2>{0.971050084f, 0.690891623f},
-std::array<float,2>{0.746652842f, 0.248298496f},
-std::array<float,2>{0.416684061f, 0.884000957f},
-std::array<float,2>{0.342814207f, 0.0745233595f},
-std::array<float,2>{0.530368686f, 0.824074209f},
-std::array<float,2>{0.79389596f, 0.266993463f},
-std::array<float,2>{0.212825075f, 0.584754169f},
-std::array<float,2>{0.464816302f, 0.323588043f},
-std::array<float,2>{0.638999581f, 0.532544851f},
-std::array<float,2>{0.936738431f, 0.0451978669f},
-std::array<float,2>{0.0731827617f, 0.812024951f},
-std::array<float,2>{0.177053317f, 0.173213065f},
-std::array<float,2>{0.841957748f, 0.966107607f},
-std::array<float,2>{0.610532165f, 0.40498504f},
-std::array<float,2>{0.279648393f, 0.67460078f},
-std::array<float,2>{0.238728657f, 0.30614683f},
-std::array<float,2>{0.767059028f, 0.606487989f},
-std::array<float,2>{0.543001354f, 0.0948743895f},
-std::array<float,2>{0.365613461f, 0.862172067f},
-std::array<float,2>{0.403605908f, 0.206411779f},
-std::array<float,2>{0.687857628f, 0.929880202f},
-std::array<float,2>{0.940999329f, 0.44041875f},
-std::array<float,2>{0.0579609163f, 0.748804986f},
-std::array<float,2>{0.284064442f, 0.437108308f},
-std::array<float,2>{0.589864135f, 0.626474321f},
-std::array<float,2>{0.869891047f, 0.150929525f},
-std::array<float,2>{0.131970599f, 0.989114165f},
-std::array<float,2>{0.124581002f, 0.00950530358f},
-std::array<float,2>{0.904103458f, 0.774666309f},
-std::array<float,2>{0.658848703f, 0.35701251f},
-std::array<float,2>{0.486172438f, 0.504556835f},
-std::array<float,2>{0.171567038f, 0.441941291f},
-std::array<float,2>{0.824111879f, 0.743557274f},
-std::array<float,2>{0.598740518f, 0.210678756f},
-std::array<float,2>{0.251742989f, 0.936415911f},
-std::array<float,2>{0.445867419f, 0.100285448f},
-std::array<float,2>{0.648737729f, 0.866071939f},
-std::array<float,2>{0.915720761f, 0.31058526f},
-std::array<float,2>{0.0806095153f, 0.604882598f},
-std::array<float,2>{0.312673926f, 0.352508038f},
-std::array<float,2>{0.510357022f, 0.500024199f},
-std::array<float,2>{0.801649928f, 0.0119756311f},
-std::array<float,2>{0.190822884f, 0.779429317f},
-std::array<float,2>{0.0219060387f, 0.155286148f},
-std::array<float,2>{0.986205995f, 0.984621763f},
-std::array<float,2>{0.725266576f, 0.430423647f},
-std::array<float,2>{0.434203863f, 0.629603982f},
-std::array<float,2>{0.097045958f, 0.273115277f},
-std::array<float,2>{0.883561969f, 0.579754114f},
-std::array<float,2>{0.676542699f, 0.0709589049f},
-std::array<float,2>{0.46944955f, 0.824315667f},
-std::array<float,2>{0.311094731f, 0.244932488f},
-std::array<float,2>{0.57566601f, 0.88837707f},
-std::array<float,2>{0.849862814f, 0.479976922f},
-std::array<float,2>{0.147464454f, 0.692291915f},
-std::array<float,2>{0.384690791f, 0.399625719f},
-std::array<float,2>{0.703869879f, 0.67865783f},
-std::array<float,2>{0.967511952f, 0.177517638f},
-std::array<float,2>{0.0418802537f, 0.963668227f},
-std::array<float,2>{0.228081733f, 0.0399269871f},
-std::array<float,2>{0.758504272f, 0.805185139f},
-std::array<float,2>{0.559827268f, 0.326792479f},
-std::array<float,2>{0.356749654f, 0.536793709f},
-std::array<float,2>{0.0543342866f, 0.408909947f},
-std::array<float,2>{0.950595498f, 0.652793229f},
-std::array<float,2>{0.701272845f, 0.135062918f},
-std::array<float,2>{0.396993577f, 0.97882539f},
-std::array<float,2>{0.368630707f, 0.0263041593f},
-std::array<float,2>{0.535155475f, 0.753055096f},
-std::array<float,2>{0.776959777f, 0.373665005f},
-std::array<float,2>{0.249354437f, 0.528466225f},
-std::array<float,2>{0.492827207f, 0.289218962f},
-std::array<float,2>{0.666519582f, 0.61548239f},
-std::array<float,2>{0.890866399f, 0.11855597f},
-std::array<float,2>{0.114195138f, 0.851509273f},
-std::array<float,2>{0.134349018f, 0.197759598f},
-std::array<float,2>{0.865371227f, 0.914511979f},
-std::array<float,2>{0.585034251f, 0.465655237f},
-std::array<float,2>{0.294499785f, 0.72878927f},
-std::array<float,2>{0.208534986f, 0.337521374f},
-std::array<float,2>{0.785890758f, 0.557872176f},
-std::array<float,2>{0.520376563f, 0.0477694683f},
-std::array<float,2>{0.32843104f, 0.794515908f},
-std::array<float,2>{0.413140088f, 0.171516508f},
-std::array<float,2>{0.738670707f, 0.941312015f},
-std::array<float,2>{0.983629167f, 0.380303234f},
-std::array<float,2>{0.00124471809f, 0.659459531f},
-std::array<float,2>{0.271305323f, 0.498670578f},
-std::array<float,2>{0.621514618f, 0.718084157f},
-std::array<float,2>{0.83424902f, 0.232266143f},
-std::array<float,2>{0.184216842f, 0.893018186f},
-std::array<float,2>{0.0666248277f, 0.0916544423f},
-std::array<float,2>{0.928317189f, 0.828410029f},
-std::array<float,2>{0.6260764f, 0.260928869f},
-std::array<float,2>{0.459255636f, 0.570879698f},
-std::array<float,2>{0.235565245f, 0.387397528f},
-std::array<float,2>{0.770281971f, 0.666328669f},
-std::array<float,2>{0.541120231f, 0.161667138f},
-std::array<float,2>{0.360121161f, 0.950542271f},
-std::array<float,2>{0.39883548f, 0.0585173443f},
-std::array<float,2>{0.691571414f, 0.782759547f},
-std::array<float,2>{0.943913817f, 0.328714103f},
-std::array<float,2>{0.062322814f, 0.553811431f},
-std::array<float,2>{0.28848803f, 0.250081271f},
-std::array<float,2>{0.588193059f, 0.564787149f},
-std::array<float,2>{0.873737752f, 0.0792977884f},
-std::array<float,2>{0.127543867f, 0.836375415f},
-std::array<float,2>{0.117482014f, 0.220309898f},
-std::array<float,2>{0.900404871f, 0.899375439f},
-std::array<float,2>{0.663784623f, 0.490355253f},
-std::array<float,2>{0.489063889f, 0.709037483f},
-std::array<float,2>{0.00902199f, 0.366474122f},
-std::array<float,2>{0.973546684f, 0.518538177f},
-std::array<float,2>{0.744550705f, 0.0179463364f},
-std::array<float,2>{0.418752789f, 0.764384985f},
-std::array<float,2>{0.339608967f, 0.128015205f},
-std::array<float,2>{0.52498585f, 0.969332635f},
-std::array<float,2>{0.791154861f, 0.418979794f},
-std::array<float,2>{0.217697039f, 0.644120753f},
-std::array<float,2>{0.467838675f, 0.454059273f},
-std::array<float,2>{0.635906219f, 0.724065006f},
-std::array<float,2>{0.930398345f, 0.189270467f},
-std::array<float,2>{0.0777695999f, 0.913681746f},
-std::array<float,2>{0.172012895f, 0.115615457f},
-std::array<float,2>{0.838751316f, 0.851660728f},
-std::array<float,2>{0.616370797f, 0.281757385f},
-std::array<float,2>{0.274171472f, 0.618494511f},
-std::array<float,2>{0.0926871598f, 0.470565498f},
-std::array<float,2>{0.908322573f, 0.695714653f},
-std::array<float,2>{0.64438659f, 0.23969692f},
-std::array<float,2>{0.44361648f, 0.878230929f},
-std::array<float,2>{0.264824182f, 0.0702822953f},
-std::array<float,2>{0.603268743f, 0.819570661f},
-std::array<float,2>{0.814691365f, 0.280211657f},
-std::array<float,2>{0.160573617f, 0.593411684f},
-std::array<float,2>{0.427544683f, 0.316917658f},
-std::array<float,2>{0.726738572f, 0.542896926f},
-std::array<float,2>{0.999469876f, 0.0360315107f},
-std::array<float,2>{0.0256664287f, 0.804340541f},
-std::array<float,2>{0.197853863f, 0.184282511f},
-std::array<float,2>{0.810755312f, 0.953430891f},
-std::array<float,2>{0.50704062f, 0.391918331f},
-std::array<float,2>{0.325984061f, 0.683174789f},
-std::array<float,2>{0.155121922f, 0.298822165f},
-std::array<float,2>{0.855411708f, 0.596640766f},
-std::array<float,2>{0.565011203f, 0.103926763f},
-std::array<float,2>{0.301034063f, 0.873864532f},
-std::array<float,2>{0.476673156f, 0.215986952f},
-std::array<float,2>{0.682224393f, 0.922165275f},
-std::array<float,2>{0.880784631f, 0.450429201f},
-std::array<float,2>{0.106419325f, 0.73797071f},
-std::array<float,2>{0.344589233f, 0.427318692f},
-std::array<float,2>{0.553673923f, 0.636300147f},
-std::array<float,2>{0.753401637f, 0.142243087f},
-std::array<float,2>{0.219527826f, 0.999749839f},
-std::array<float,2>{0.0350238644f, 0.00562368752f},
-std::array<float,2>{0.955506444f, 0.768877447f},
-std::array<float,2>{0.714588702f, 0.344250262f},
-std::array<float,2>{0.379188895f, 0.51106447f},
-std::array<float,2>{0.195280731f, 0.485941797f},
-std::array<float,2>{0.7977615f, 0.703833282f},
-std::array<float,2>{0.515373707f, 0.223981023f},
-std::array<float,2>{0.319551498f, 0.903868854f},
-std::array<float,2>{0.433312148f, 0.0838066936f},
-std::array<float,2>{0.719921827f, 0.843466699f},
-std::array<float,2>{0.989351273f, 0.254661053f},
-std::array<float,2>{0.0188622456f, 0.569130599f},
-std::array<float,2>{0.255972594f, 0.335123628f},
-std::array<float,2>{0.596746087f, 0.547987163f},
-std::array<float,2>{0.827969432f, 0.059739612f},
-std::array<float,2>{0.164893195f, 0.787235022f},
-std::array<float,2>{0.0837612301f, 0.159720883f},
-std::array<float,2>{0.920314908f, 0.949157774f},
-std::array<float,2>{0.653325677f, 0.383191317f},
-std::array<float,2>{0.451752543f, 0.669410765f},
-std::array<float,2>{0.0437410511f, 0.286550105f},
-std::array<float,2>{0.963527024f, 0.623712122f},
-std::array<float,2>{0.708305776f, 0.110317558f},
-std::array<float,2>{0.389781505f, 0.858987331f},
-std::array<float,2>{0.351835668f, 0.1949047f},
-std::array<float,2>{0.556455612f, 0.906563997f},
-std::array<float,2>{0.762541115f, 0.460773081f},
-std::array<float,2>{0.232832685f, 0.719038904f},
-std::array<float,2>{0.47608602f, 0.41504398f},
-std::array<float,2>{0.673418939f, 0.646651447f},
-std::array<float,2>{0.887827396f, 0.130723357f},
-std::array<float,2>{0.100790188f, 0.975531757f},
-std::array<float,2>{0.14204216f, 0.0205939934f},
-std::array<float,2>{0.845821619f, 0.760032654f},
-std::array<float,2>{0.57216239f, 0.362538874f},
-std::array<float,2>{0.305544317f, 0.52096945f},
-std::array<float,2>{0.111536421f, 0.395864218f},
-std::array<float,2>{0.896949172f, 0.683839083f},
-std::array<float,2>{0.668351114f, 0.181477308f},
-std::array<float,2>{0.499617219f, 0.959580123f},
-std::array<float,2>{0.292628109f, 0.0346361957f},
-std::array<float,2>{0.579960763f, 0.800147355f},
-std::array<float,2>{0.862100959f, 0.31543082f},
-std::array<float,2>{0.136907697f, 0.545752704f},
-std::array<float,2>{0.391306609f, 0.275540024f},
-std::array<float,2>{0.696173966f, 0.589578509f},
-std::array<float,2>{0.946070433f, 0.0655581355f},
-std::array<float,2>{0.048656594f, 0.813862264f},
-std::array<float,2>{0.243916005f, 0.235546961f},
-std::array<float,2>{0.778905928f, 0.88229084f},
-std::array<float,2>{0.535936952f, 0.473838151f},
-std::array<float,2>{0.374203265f, 0.70055455f},
-std::array<float,2>{0.180787474f, 0.349039882f},
-std::array<float,2>{0.829808831f, 0.515618563f},
-std::array<float,2>{0.61737746f, 0.00236121262f},
-std::array<float,2>{0.267627925f, 0.770000219f},
-std::array<float,2>{0.456747025f, 0.145109117f},
-std::array<float,2>{0.631305099f, 0.994765103f},
-std::array<float,2>{0.922711074f, 0.423889369f},
-std::array<float,2>{0.0661232844f, 0.639489472f},
-std::array<float,2>{0.335811883f, 0.448997289f},
-std::array<float,2>{0.51604116f, 0.740848362f},
-std::array<float,2>{0.783922195f, 0.211024374f},
-std::array<float,2>{0.204009026f, 0.926760733f},
-std::array<float,2>{0.00582083967f, 0.106836185f},
-std::array<float,2>{0.978926957f, 0.868766546f},
-std::array<float,2>{0.735379577f, 0.304653257f},
-std::array<float,2>{0.408047438f, 0.599975407f},
-std::array<float,2>{0.130955189f, 0.434446812f},
-std::array<float,2>{0.871052504f, 0.627937615f},
-std::array<float,2>{0.591725469f, 0.150100186f},
-std::array<float,2>{0.285053909f, 0.992164433f},
-std::array<float,2>{0.485227644f, 0.0105541963f},
-std::array<float,2>{0.659938276f, 0.776490033f},
-std::array<float,2>{0.903047383f, 0.35757494f},
-std::array<float,2>{0.123086005f, 0.507530868f},
-std::array<float,2>{0.366375148f, 0.306648135f},
-std::array<float,2>{0.544085443f, 0.609203994f},
-std::array<float,2>{0.765788674f, 0.0974422693f},
-std::array<float,2>{0.239880919f, 0.86053741f},
-std::array<float,2>{0.0574015081f, 0.203469515f},
-std::array<float,2>{0.939721048f, 0.93256247f},
-std::array<float,2>{0.688518465f, 0.438759506f},
-std::array<float,2>{0.402787298f, 0.746408761f},
-std::array<float,2>{0.0733276084f, 0.321966141f},
-std::array<float,2>{0.935576558f, 0.534275651f},
-std::array<float,2>{0.63986659f, 0.0432226807f},
-std::array<float,2>{0.463196993f, 0.810241282f},
-std::array<float,2>{0.281063795f, 0.174823508f},
-std::array<float,2>{0.610251129f, 0.968707204f},
-std::array<float,2>{0.843379617f, 0.404287726f},
-std::array<float,2>{0.176226586f, 0.672013402f},
-std::array<float,2>{0.41720733f, 0.480892867f},
-std::array<float,2>{0.747845888f, 0.687755942f},
-std::array<float,2>{0.971991599f, 0.246481627f},
-std::array<float,2>{0.0124671767f, 0.885862529f},
-std::array<float,2>{0.211713925f, 0.0773622766f},
-std::array<float,2>{0.794400692f, 0.821976125f},
-std::array<float,2>{0.529758394f, 0.268923819f},
-std::array<float,2>{0.34222275f, 0.582675874f},
-std::array<float,2>{0.0297860615f, 0.462234408f},
-std::array<float,2>{0.994347692f, 0.732745945f},
-std::array<float,2>{0.73360014f, 0.20265089f},
-std::array<float,2>{0.423324972f, 0.921699822f},
-std::array<float,2>{0.320934683f, 0.123108514f},
-std::array<float,2>{0.503275454f, 0.844826758f},
-std::array<float,2>{0.808387995f, 0.2960383f},
-std::array<float,2>{0.199890867f, 0.611236691f},
-std::array<float,2>{0.439144552f, 0.369741708f},
-std::array<float,2>{0.648351371f, 0.524297893f},
-std::array<float,2>{0.912042558f, 0.0289527513f},
-std::array<float,2>{0.0869988576f, 0.757647336f},
-std::array<float,2>{0.156573668f, 0.138417289f},
-std::array<float,2>{0.819916546f, 0.984229028f},
-std::array<float,2>{0.607435524f, 0.413792074f},
-std::array<float,2>{0.261266559f, 0.649455488f},
-std::array<float,2>{0.223433077f, 0.262641668f},
-std::array<float,2>{0.757312953f, 0.574901164f},
-std::array<float,2>{0.548843324f, 0.0876105577f},
-std::array<float,2>{0.348504335f, 0.832334399f},
-std::array<float,2>{0.377287745f, 0.229966089f},
-std::array<float,2>{0.717072725f, 0.898259401f},
-std::array<float,2>{0.957583189f, 0.49236539f},
-std::array<float,2>{0.0369758457f, 0.712524891f},
-std::array<float,2>{0.300497144f, 0.378863871f},
-std::array<float,2>{0.566848814f, 0.662024498f},
-std::array<float,2>{0.856753886f, 0.167369232f},
-std::array<float,2>{0.148606434f, 0.944037795f},
-std::array<float,2>{0.101995096f, 0.0514757745f},
-std::array<float,2>{0.878733695f, 0.791650116f},
-std::array<float,2>{0.686133027f, 0.34235239f},
-std::array<float,2>{0.482162744f, 0.561906874f},
-std::array<float,2>{0.146048546f, 0.477917761f},
-std::array<float,2>{0.848278522f, 0.694966555f},
-std::array<float,2>{0.578097284f, 0.243140996f},
-std::array<float,2>{0.310003519f, 0.889327824f},
-std::array<float,2>{0.471041739f, 0.0741021559f},
-std::array<float,2>{0.679487765f, 0.826960683f},
-std::array<float,2>{0.885811985f, 0.270428658f},
-std::array<float,2>{0.0939239189f, 0.581115544f},
-std::array<float,2>{0.358471513f, 0.324572742f},
-std::array<float,2>{0.560695052f, 0.539040446f},
-std::array<float,2>{0.76095587f, 0.042435836f},
-std::array<float,2>{0.228781447f, 0.806834519f},
-std::array<float,2>{0.0397016071f, 0.179043561f},
-std::array<float,2>{0.965233386f, 0.962682843f},
-std::array<float,2>{0.70643121f, 0.4006612f},
-std::array<float,2>{0.385893136f, 0.677659273f},
-std::array<float,2>{0.0794941038f, 0.3102476f},
-std::array<float,2>{0.916879058f, 0.602709234f},
-std::array<float,2>{0.651732206f, 0.0988936573f},
-std::array<float,2>{0.448564976f, 0.864305317f},
-std::array<float,2>{0.253198594f, 0.20877558f},
-std::array<float,2>{0.601150572f, 0.934746146f},
-std::array<float,2>{0.821618855f, 0.44340843f},
-std::array<float,2>{0.16875881f, 0.746036172f},
-std::array<float,2>{0.437024921f, 0.432280362f},
-std::array<float,2>{0.723645389f, 0.63269341f},
-std::array<float,2>{0.986671746f, 0.154127479f},
-std::array<float,2>{0.01972677f, 0.986879945f},
-std::array<float,2>{0.189186186f, 0.0154310809f},
-std::array<float,2>{0.80390799f, 0.777455807f},
-std::array<float,2>{0.509569883f, 0.355015278f},
-std::array<float,2>{0.314894259f, 0.502068818f},
-std::array<float,2>{0.00275260233f, 0.382353485f},
-std::array<float,2>{0.982275546f, 0.657263637f},
-std::array<float,2>{0.740276873f, 0.16900593f},
-std::array<float,2>{0.411932498f, 0.937641799f},
-std::array<float,2>{0.331324011f, 0.0493930727f},
-std::array<float,2>{0.521610022f, 0.795540154f},
-std::array<float,2>{0.787932515f, 0.339466125f},
-std::array<float,2>{0.209461465f, 0.555008292f},
-std::array<float,2>{0.458556235f, 0.25944221f},
-std::array<float,2>{0.627926707f, 0.573718786f},
-std::array<float,2>{0.925789177f, 0.0934640318f},
-std::array<float,2>{0.0692073256f, 0.830201268f},
-std::array<float,2>{0.185784742f, 0.232636064f},
-std::array<float,2>{0.833022654f, 0.892388105f},
-std::array<float,2>{0.624398351f, 0.49750337f},
-std::array<float,2>{0.272424996f, 0.715438366f},
-std::array<float,2>{0.246779814f, 0.371608287f},
-std::array<float,2>{0.774837434f, 0.530001283f},
-std::array<float,2>{0.532353163f, 0.0252441578f},
-std::array<float,2>{0.370197356f, 0.751648724f},
-std::array<float,2>{0.396175295f, 0.133325011f},
-std::array<float,2>{0.699290752f, 0.978049278f},
-std::array<float,2>{0.952252686f, 0.4080984f},
-std::array<float,2>{0.0508340746f, 0.655609727f},
-std::array<float,2>{0.295120597f, 0.468184233f},
-std::array<float,2>{0.583295643f, 0.727135599f},
-std::array<float,2>{0.865100443f, 0.195535168f},
-std::array<float,2>{0.13595365f, 0.917171121f},
-std::array<float,2>{0.116373636f, 0.119416401f},
-std::array<float,2>{0.893679678f, 0.849193931f},
-std::array<float,2>{0.664575815f, 0.292957544f},
-std::array<float,2>{0.494564503f, 0.614775717f},
-std::array<float,2>{0.216014758f, 0.420874476f},
-std::array<float,2>{0.790938497f, 0.641336799f},
-std::array<float,2>{0.526256979f, 0.125583574f},
-std::array<float,2>{0.336618572f, 0.971103072f},
-std::array<float,2>{0.42022419f, 0.0174215324f},
-std::array<float,2>{0.74244839f, 0.762108326f},
-std::array<float,2>{0.975637078f, 0.36332804f},
-std::array<float,2>{0.0114921844f, 0.516642332f},
-std::array<float,2>{0.275420338f, 0.284673959f},
-std::array<float,2>{0.613969743f, 0.619619966f},
-std::array<float,2>{0.837481081f, 0.114760302f},
-std::array<float,2>{0.175287247f, 0.854192019f},
-std::array<float,2>{0.0748322159f, 0.190343961f},
-std::array<float,2>{0.932077825f, 0.911429405f},
-std::array<float,2>{0.633656561f, 0.455901802f},
-std::array<float,2>{0.466751724f, 0.725827396f},
-std::array<float,2>{0.0595216975f, 0.331301689f},
-std::array<float,2>{0.941572726f, 0.551872253f},
-std::array<float,2>{0.69465816f, 0.0554037131f},
-std::array<float,2>{0.401217431f, 0.784239113f},
-std::array<float,2>{0.362690866f, 0.162724704f},
-std::array<float,2>{0.540876627f, 0.951407611f},
-std::array<float,2>{0.77310431f, 0.389046162f},
-std::array<float,2>{0.236375391f, 0.665226758f},
-std::array<float,2>{0.4914217f, 0.488535136f},
-std::array<float,2>{0.661154747f, 0.707253456f},
-std::array<float,2>{0.899645209f, 0.220798165f},
-std::array<float,2>{0.120042235f, 0.900615394f},
-std::array<float,2>{0.126162857f, 0.0811362565f},
-std::array<float,2>{0.872523606f, 0.838968098f},
-std::array<float,2>{0.587258637f, 0.252448618f},
-std::array<float,2>{0.285613656f, 0.562794685f},
-std::array<float,2>{0.108996928f, 0.451237112f},
-std::array<float,2>{0.881731868f, 0.735476971f},
-std::array<float,2>{0.679925442f, 0.218285665f},
-std::array<float,2>{0.48036918f, 0.925374031f},
-std::array<float,2>{0.304161936f, 0.103342503f},
-std::array<float,2>{0.563844442f, 0.871375084f},
-std::array<float,2>{0.852418959f, 0.298924148f},
-std::array<float,2>{0.153154492f, 0.594397962f},
-std::array<float,2>{0.38271904f, 0.346476406f},
-std::array<float,2>{0.711181402f, 0.507837474f},
-std::array<float,2>{0.954363286f, 0.00676215999f},
-std::array<float,2>{0.032433264f, 0.766624629f},
-std::array<float,2>{0.222634017f, 0.14392224f},
-std::array<float,2>{0.751435757f, 0.996276021f},
-std::array<float,2>{0.552296162f, 0.428093553f},
-std::array<float,2>{0.346516252f, 0.633354604f},
-std::array<float,2>{0.163028836f, 0.27922821f},
-std::array<float,2>{0.813574016f, 0.59012109f},
-std::array<float,2>{0.604802072f, 0.0673813373f},
-std::array<float,2>{0.261796415f, 0.817893386f},
-std::array<float,2>{0.441735208f, 0.241333619f},
-std::array<float,2>{0.642542124f, 0.876485586f},
-std::array<float,2>{0.907996595f, 0.472163558f},
-std::array<float,2>{0.0905273631f, 0.697776735f},
-std::array<float,2>{0.326978356f, 0.393713504f},
-std::array<float,2>{0.505481899f, 0.680743158f},
-std::array<float,2>{0.809396029f, 0.186762497f},
-std::array<float,2>{0.196876183f, 0.956347644f},
-std::array<float,2>{0.0251237098f, 0.0374548994f},
-std::array<float,2>{0.997022867f, 0.801446199f},
-std::array<float,2>{0.729715705f, 0.319228828f},
-std::array<float,2>{0.42885375f, 0.540362f},
-std::array<float,2>{0.231858164f, 0.458928794f},
-std::array<float,2>{0.765535355f, 0.721780717f},
-std::array<float,2>{0.556809425f, 0.191557318f},
-std::array<float,2>{0.354437858f, 0.90844208f},
-std::array<float,2>{0.387859493f, 0.112279356f},
-std::array<float,2>{0.709672749f, 0.857151151f},
-std::array<float,2>{0.961458087f, 0.288145244f},
-std::array<float,2>{0.0462747775f, 0.621183336f},
-std::array<float,2>{0.307420969f, 0.360576719f},
-std::array<float,2>{0.5728935f, 0.522795618f},
-std::array<float,2>{0.844475508f, 0.0232507139f},
-std::array<float,2>{0.142775401f, 0.757864416f},
-std::array<float,2>{0.098251909f, 0.131537363f},
-std::array<float,2>{0.890611053f, 0.97424829f},
-std::array<float,2>{0.674663782f, 0.417437732f},
-std::array<float,2>{0.473086119f, 0.645776451f},
-std::array<float,2>{0.015893491f, 0.25615117f},
-std::array<float,2>{0.991084397f, 0.567323029f},
-std::array<float,2>{0.721367955f, 0.0841750726f},
-std::array<float,2>{0.431635857f, 0.841097474f},
-std::array<float,2>{0.31730184f, 0.226098105f},
-std::array<float,2>{0.512951314f, 0.90598613f},
-std::array<float,2>{0.800238192f, 0.487667233f},
-std::array<float,2>{0.191958204f, 0.706372797f},
-std::array<float,2>{0.450193822f, 0.385955006f},
-std::array<float,2>{0.655854762f, 0.671242654f},
-std::array<float,2>{0.918043554f, 0.156934559f},
-std::array<float,2>{0.0840629786f, 0.947071075f},
-std::array<float,2>{0.166655928f, 0.0617225915f},
-std::array<float,2>{0.826019883f, 0.785859764f},
-std::array<float,2>{0.594418406f, 0.333422363f},
-std::array<float,2>{0.255307436f, 0.550198913f},
-std::array<float,2>{0.0625159889f, 0.423554242f},
-std::array<float,2>{0.925302088f, 0.636878192f},
-std::array<float,2>{0.629222453f, 0.147319779f},
-std::array<float,2>{0.453262568f, 0.992786169f},
-std::array<float,2>{0.265898794f, 0.00193671405f},
-std::array<float,2>{0.621065617f, 0.773154497f},
-std::array<float,2>{0.831241965f, 0.350442618f},
-std::array<float,2>{0.182087705f, 0.512907267f},
-std::array<float,2>{0.408549011f, 0.302296907f},
-std::array<float,2>{0.736536384f, 0.599246919f},
-std::array<float,2>{0.978212655f, 0.108402319f},
-std::array<float,2>{0.0075466251f, 0.869843185f},
-std::array<float,2>{0.20685862f, 0.21358718f},
-std::array<float,2>{0.782629669f, 0.927861214f},
-std::array<float,2>{0.517993569f, 0.44679749f},
-std::array<float,2>{0.333730072f, 0.738664329f},
-std::array<float,2>{0.139895082f, 0.313748419f},
-std::array<float,2>{0.859882951f, 0.543006659f},
-std::array<float,2>{0.580976605f, 0.0331531242f},
-std::array<float,2>{0.289639533f, 0.797072411f},
-std::array<float,2>{0.497101337f, 0.182853788f},
-std::array<float,2>{0.670542359f, 0.958172321f},
-std::array<float,2>{0.896229684f, 0.39782083f},
-std::array<float,2>{0.111040682f, 0.686368465f},
-std::array<float,2>{0.372728497f, 0.474753886f},
-std::array<float,2>{0.538405955f, 0.701775014f},
-std::array<float,2>{0.780126452f, 0.236347586f},
-std::array<float,2>{0.245949894f, 0.879620433f},
-std::array<float,2>{0.0497774929f, 0.0636020154f},
-std::array<float,2>{0.947777867f, 0.814841032f},
-std::array<float,2>{0.698837459f, 0.273880213f},
-std::array<float,2>{0.392646104f, 0.587448299f},
-std::array<float,2>{0.178642377f, 0.405473858f},
-std::array<float,2>{0.839915752f, 0.674992919f},
-std::array<float,2>{0.61220938f, 0.172793269f},
-std::array<float,2>{0.278234899f, 0.965280533f},
-std::array<float,2>{0.461708903f, 0.0462725088f},
-std::array<float,2>{0.637519479f, 0.810818672f},
-std::array<float,2>{0.933766425f, 0.323022395f},
-std::array<float,2>{0.0713574439f, 0.531967759f},
-std::array<float,2>{0.339982688f, 0.265649259f},
-std::array<float,2>{0.52904886f, 0.585878491f},
-std::array<float,2>{0.795589209f, 0.0759358406f},
-std::array<float,2>{0.213885218f, 0.822582543f},
-std::array<float,2>{0.0142164007f, 0.249782115f},
-std::array<float,2>{0.969567239f, 0.883115292f},
-std::array<float,2>{0.749851823f, 0.483962059f},
-std::array<float,2>{0.414909333f, 0.690079749f},
-std::array<float,2>{0.122701615f, 0.355820179f},
-std::array<float,2>{0.904659986f, 0.505583704f},
-std::array<float,2>{0.656294405f, 0.0078242803f},
-std::array<float,2>{0.488267004f, 0.7735039f},
-std::array<float,2>{0.282907546f, 0.151799798f},
-std::array<float,2>{0.591890395f, 0.989455044f},
-std::array<float,2>{0.868513942f, 0.435577869f},
-std::array<float,2>{0.130815431f, 0.625365376f},
-std::array<float,2>{0.405403793f, 0.440939993f},
-std::array<float,2>{0.690191805f, 0.749548316f},
-std::array<float,2>{0.938538551f, 0.206008196f},
-std::array<float,2>{0.0549913011f, 0.930777669f},
-std::array<float,2>{0.240992039f, 0.0945203081f},
-std::array<float,2>{0.768195152f, 0.863140881f},
-std::array<float,2>{0.546588421f, 0.30496785f},
-std::array<float,2>{0.364202023f, 0.605565667f},
-std::array<float,2>{0.0384789258f, 0.495943993f},
-std::array<float,2>{0.959566057f, 0.713217974f},
-std::array<float,2>{0.715664327f, 0.228044361f},
-std::array<float,2>{0.376456827f, 0.895891249f},
-std::array<float,2>{0.349621564f, 0.0885126144f},
-std::array<float,2>{0.547687531f, 0.835853398f},
-std::array<float,2>{0.754450858f, 0.265282303f},
-std::array<float,2>{0.224892959f, 0.576985657f},
-std::array<float,2>{0.482495815f, 0.341175526f},
-std::array<float,2>{0.685530186f, 0.558885098f},
-std::array<float,2>{0.875481606f, 0.0531658791f},
-std::array<float,2>{0.104830712f, 0.790923476f},
-std::array<float,2>{0.152247652f, 0.164767861f},
-std::array<float,2>{0.857450902f, 0.941411555f},
-std::array<float,2>{0.56846714f, 0.375320107f},
-std::array<float,2>{0.29825592f, 0.662371695f},
-std::array<float,2>{0.202605128f, 0.294411302f},
-std::array<float,2>{0.806376755f, 0.611794531f},
-std::array<float,2>{0.501282394f, 0.122141629f},
-std::array<float,2>{0.323922366f, 0.84605515f},
-std::array<float,2>{0.424687147f, 0.199504986f},
-std::array<float,2>{0.731755137f, 0.918945193f},
-std::array<float,2>{0.993238211f, 0.464363456f},
-std::array<float,2>{0.0286605544f, 0.730912566f},
-std::array<float,2>{0.258114398f, 0.41095084f},
-std::array<float,2>{0.606364071f, 0.650603235f},
-std::array<float,2>{0.816891313f, 0.139333099f},
-std::array<float,2>{0.15854919f, 0.981841743f},
-std::array<float,2>{0.0894324854f, 0.0293249954f},
-std::array<float,2>{0.912359238f, 0.754543781f},
-std::array<float,2>{0.64470607f, 0.367729843f},
-std::array<float,2>{0.440325707f, 0.526144147f},
-std::array<float,2>{0.152755648f, 0.450981081f},
-std::array<float,2>{0.851585269f, 0.737669349f},
-std::array<float,2>{0.564290822f, 0.216688424f},
-std::array<float,2>{0.304330111f, 0.922678709f},
-std::array<float,2>{0.479890466f, 0.104010738f},
-std::array<float,2>{0.680415034f, 0.87318337f},
-std::array<float,2>{0.881018877f, 0.298287004f},
-std::array<float,2>{0.108806148f, 0.595981181f},
-std::array<float,2>{0.345731854f, 0.344015211f},
-std::array<float,2>{0.551767647f, 0.511446357f},
-std::array<float,2>{0.751651764f, 0.00532723963f},
-std::array<float,2>{0.221845388f, 0.769177079f},
-std::array<float,2>{0.0328301266f, 0.141692579f},
-std::array<float,2>{0.955032885f, 0.999200642f},
-std::array<float,2>{0.711545289f, 0.426857859f},
-std::array<float,2>{0.382136405f, 0.635805726f},
-std::array<float,2>{0.0902881548f, 0.279633433f},
-std::array<float,2>{0.907232881f, 0.593236148f},
-std::array<float,2>{0.641654015f, 0.0696036071f},
-std::array<float,2>{0.442171574f, 0.819956243f},
-std::array<float,2>{0.262376338f, 0.239888936f},
-std::array<float,2>{0.605065525f, 0.878691554f},
-std::array<float,2>{0.81408757f, 0.470177114f},
-std::array<float,2>{0.162532568f, 0.696009338f},
-std::array<float,2>{0.429438204f, 0.392405152f},
-std::array<float,2>{0.730181217f, 0.683014274f},
-std::array<float,2>{0.996114016f, 0.184035629f},
-std::array<float,2>{0.0245965756f, 0.95389837f},
-std::array<float,2>{0.196709171f, 0.0352730155f},
-std::array<float,2>{0.80868119f, 0.804000556f},
-std::array<float,2>{0.504971206f, 0.316587359f},
-std::array<float,2>{0.326297671f, 0.542063892f},
-std::array<float,2>{0.0108822789f, 0.419578999f},
-std::array<float,2>{0.976196647f, 0.64371568f},
-std::array<float,2>{0.743145943f, 0.128496632f},
-std::array<float,2>{0.420662701f, 0.969185948f},
-std::array<float,2>{0.335955083f, 0.0182600003f},
-std::array<float,2>{0.525545418f, 0.764087081f},
-std::array<float,2>{0.790227234f, 0.366982937f},
-std::array<float,2>{0.21653904f, 0.517609894f},
-std::array<float,2>{0.466039717f, 0.281599492f},
-std::array<float,2>{0.633253634f, 0.618670404f},
-std::array<float,2>{0.932308912f, 0.116090715f},
-std::array<float,2>{0.0742672533f, 0.852471769f},
-std::array<float,2>{0.175734341f, 0.188870907f},
-std::array<float,2>{0.837254107f, 0.913154066f},
-std::array<float,2>{0.613453746f, 0.453458905f},
-std::array<float,2>{0.276291162f, 0.724342585f},
-std::array<float,2>{0.23715046f, 0.328481972f},
-std::array<float,2>{0.772895694f, 0.554431617f},
-std::array<float,2>{0.540127218f, 0.057880573f},
-std::array<float,2>{0.363053381f, 0.782702923f},
-std::array<float,2>{0.400682271f, 0.161538392f},
-std::array<float,2>{0.694964826f, 0.951062441f},
-std::array<float,2>{0.942317009f, 0.386888891f},
-std::array<float,2>{0.0587859303f, 0.666535079f},
-std::array<float,2>{0.285711735f, 0.49098438f},
-std::array<float,2>{0.58775121f, 0.709857106f},
-std::array<float,2>{0.873014271f, 0.219894633f},
-std::array<float,2>{0.126767203f, 0.898611486f},
-std::array<float,2>{0.119547233f, 0.0797839612f},
-std::array<float,2>{0.900344968f, 0.836676002f},
-std::array<float,2>{0.662052929f, 0.250875443f},
-std::array<float,2>{0.491796196f, 0.565322101f},
-std::array<float,2>{0.209555447f, 0.380695015f},
-std::array<float,2>{0.787237406f, 0.659728169f},
-std::array<float,2>{0.522363544f, 0.171177626f},
-std::array<float,2>{0.331857175f, 0.940741897f},
-std::array<float,2>{0.411154121f, 0.0472875983f},
-std::array<float,2>{0.740963817f, 0.7943331f},
-std::array<float,2>{0.98187381f, 0.337272108f},
-std::array<float,2>{0.00226398977f, 0.558337927f},
-std::array<float,2>{0.271783888f, 0.261586934f},
-std::array<float,2>{0.624988258f, 0.570748389f},
-std::array<float,2>{0.833668709f, 0.0909816325f},
-std::array<float,2>{0.186348021f, 0.828771532f},
-std::array<float,2>{0.0686183572f, 0.231495291f},
-std::array<float,2>{0.926492989f, 0.893452048f},
-std::array<float,2>{0.627410889f, 0.498473316f},
-std::array<float,2>{0.458182454f, 0.718672574f},
-std::array<float,2>{0.0514244772f, 0.373314768f},
-std::array<float,2>{0.953083813f, 0.529042244f},
-std::array<float,2>{0.70010525f, 0.0254090782f},
-std::array<float,2>{0.395768225f, 0.753785014f},
-std::array<float,2>{0.370615423f, 0.135321468f},
-std::array<float,2>{0.532781303f, 0.979400396f},
-std::array<float,2>{0.775014043f, 0.408297718f},
-std::array<float,2>{0.246472687f, 0.653158188f},
-std::array<float,2>{0.494890511f, 0.464930505f},
-std::array<float,2>{0.664205015f, 0.729094088f},
-std::array<float,2>{0.894077301f, 0.197567761f},
-std::array<float,2>{0.116749242f, 0.914796054f},
-std::array<float,2>{0.136496127f, 0.119133189f},
-std::array<float,2>{0.864715815f, 0.850830913f},
-std::array<float,2>{0.58390075f, 0.28964588f},
-std::array<float,2>{0.295550227f, 0.616128922f},
-std::array<float,2>{0.0944685116f, 0.480186045f},
-std::array<float,2>{0.886265934f, 0.691633046f},
-std::array<float,2>{0.678745568f, 0.244594023f},
-std::array<float,2>{0.471403807f, 0.887956142f},
-std::array<float,2>{0.310422868f, 0.0704068542f},
-std::array<float,2>{0.577376366f, 0.825105667f},
-std::array<float,2>{0.847667396f, 0.272479177f},
-std::array<float,2>{0.145769343f, 0.579108894f},
-std::array<float,2>{0.38637957f, 0.326230288f},
-std::array<float,2>{0.706939995f, 0.536321044f},
-std::array<float,2>{0.965506494f, 0.0394667946f},
-std::array<float,2>{0.0390831865f, 0.805134356f},
-std::array<float,2>{0.22901684f, 0.176972747f},
-std::array<float,2>{0.761299312f, 0.963210702f},
-std::array<float,2>{0.561202407f, 0.399926573f},
-std::array<float,2>{0.359229058f, 0.678188562f},
-std::array<float,2>{0.168423012f, 0.311271191f},
-std::array<float,2>{0.821790099f, 0.605374515f},
-std::array<float,2>{0.600986779f, 0.100072034f},
-std::array<float,2>{0.253594548f, 0.865411341f},
-std::array<float,2>{0.449031979f, 0.210237578f},
-std::array<float,2>{0.651936769f, 0.935773253f},
-std::array<float,2>{0.916247725f, 0.441458702f},
-std::array<float,2>{0.0799530596f, 0.743688226f},
-std::array<float,2>{0.315302879f, 0.429800987f},
-std::array<float,2>{0.509015679f, 0.629240513f},
-std::array<float,2>{0.804444373f, 0.156094015f},
-std::array<float,2>{0.188502148f, 0.984987438f},
-std::array<float,2>{0.0201043002f, 0.0123780165f},
-std::array<float,2>{0.987190783f, 0.779971838f},
-std::array<float,2>{0.724214494f, 0.351985693f},
-std::array<float,2>{0.436955541f, 0.500773191f},
-std::array<float,2>{0.22543925f, 0.493042111f},
-std::array<float,2>{0.753980815f, 0.711936057f},
-std::array<float,2>{0.546895146f, 0.230331063f},
-std::array<float,2>{0.350232869f, 0.897874236f},
-std::array<float,2>{0.376821965f, 0.0872062147f},
-std::array<float,2>{0.714864969f, 0.832680523f},
-std::array<float,2>{0.959367275f, 0.262013078f},
-std::array<float,2>{0.0386716425f, 0.574665606f},
-std::array<float,2>{0.298581511f, 0.34184289f},
-std::array<float,2>{0.569024682f, 0.562204778f},
-std::array<float,2>{0.858267486f, 0.050961975f},
-std::array<float,2>{0.151740223f, 0.791441083f},
-std::array<float,2>{0.10514313f, 0.167523593f},
-std::array<float,2>{0.875691473f, 0.94383198f},
-std::array<float,2>{0.684988976f, 0.377937227f},
-std::array<float,2>{0.483319163f, 0.661423504f},
-std::array<float,2>{0.0290668607f, 0.296794355f},
-std::array<float,2>{0.993789911f, 0.610568762f},
-std::array<float,2>{0.732063472f, 0.123674281f},
-std::array<float,2>{0.423964649f, 0.845409155f},
-std::array<float,2>{0.323705733f, 0.202312037f},
-std::array<float,2>{0.501700938f, 0.921305239f},
-std::array<float,2>{0.806079268f, 0.462771088f},
-std::array<float,2>{0.202693358f, 0.733019114f},
-std::array<float,2>{0.439938843f, 0.413543403f},
-std::array<float,2>{0.645042598f, 0.650054276f},
-std::array<float,2>{0.912634194f, 0.137940407f},
-std::array<float,2>{0.0889284164f, 0.983408153f},
-std::array<float,2>{0.158705115f, 0.0284345262f},
-std::array<float,2>{0.816896319f, 0.757005274f},
-std::array<float,2>{0.605473518f, 0.369230896f},
-std::array<float,2>{0.258534789f, 0.523598433f},
-std::array<float,2>{0.0719614923f, 0.40372014f},
-std::array<float,2>{0.934516311f, 0.672426641f},
-std::array<float,2>{0.636738896f, 0.175668314f},
-std::array<float,2>{0.461368173f, 0.968193233f},
-std::array<float,2>{0.27754122f, 0.0439025387f},
-std::array<float,2>{0.611771524f, 0.810032189f},
-std::array<float,2>{0.840680897f, 0.321744412f},
-std::array<float,2>{0.1779771f, 0.5351215f},
-std::array<float,2>{0.414344698f, 0.26916182f},
-std::array<float,2>{0.749290109f, 0.582468808f},
-std::array<float,2>{0.968793869f, 0.0778029859f},
-std::array<float,2>{0.0138503741f, 0.821350753f},
-std::array<float,2>{0.214401394f, 0.246956542f},
-std::array<float,2>{0.795099616f, 0.886683583f},
-std::array<float,2>{0.52868551f, 0.481041908f},
-std::array<float,2>{0.340587586f, 0.688076258f},
-std::array<float,2>{0.130263343f, 0.35820049f},
-std::array<float,2>{0.869016469f, 0.507228315f},
-std::array<float,2>{0.592329323f, 0.00994617026f},
-std::array<float,2>{0.282299936f, 0.777037501f},
-std::array<float,2>{0.487429738f, 0.1495893f},
-std::array<float,2>{0.657104552f, 0.991269767f},
-std::array<float,2>{0.905063033f, 0.434014589f},
-std::array<float,2>{0.122206286f, 0.628497958f},
-std::array<float,2>{0.36336565f, 0.439110339f},
-std::array<float,2>{0.546193182f, 0.746787488f},
-std::array<float,2>{0.767580628f, 0.203982517f},
-std::array<float,2>{0.240510941f, 0.931711853f},
-std::array<float,2>{0.0553642772f, 0.0970910862f},
-std::array<float,2>{0.939002812f, 0.861133277f},
-std::array<float,2>{0.689490438f, 0.307556242f},
-std::array<float,2>{0.406094939f, 0.608412743f},
-std::array<float,2>{0.182443783f, 0.424544811f},
-std::array<float,2>{0.831659853f, 0.638777435f},
-std::array<float,2>{0.620346606f, 0.144874856f},
-std::array<float,2>{0.266318202f, 0.994207382f},
-std::array<float,2>{0.454046607f, 0.00263186684f},
-std::array<float,2>{0.629765034f, 0.770257056f},
-std::array<float,2>{0.924816012f, 0.349184781f},
-std::array<float,2>{0.0632100552f, 0.514741957f},
-std::array<float,2>{0.333296537f, 0.304156393f},
-std::array<float,2>{0.518211842f, 0.600111663f},
-std::array<float,2>{0.783135235f, 0.107256994f},
-std::array<float,2>{0.20646514f, 0.868531108f},
-std::array<float,2>{0.00691011781f, 0.211623624f},
-std::array<float,2>{0.977896869f, 0.927697957f},
-std::array<float,2>{0.73697257f, 0.448414773f},
-std::array<float,2>{0.40911299f, 0.740669131f},
-std::array<float,2>{0.110378981f, 0.316083044f},
-std::array<float,2>{0.895878375f, 0.545407474f},
-std::array<float,2>{0.670010448f, 0.0351014026f},
-std::array<float,2>{0.497960776f, 0.800659537f},
-std::array<float,2>{0.289264977f, 0.180829674f},
-std::array<float,2>{0.580542982f, 0.959094942f},
-std::array<float,2>{0.859541357f, 0.396402448f},
-std::array<float,2>{0.14058055f, 0.684197724f},
-std::array<float,2>{0.393472195f, 0.474399775f},
-std::array<float,2>{0.698309779f, 0.700860381f},
-std::array<float,2>{0.94755584f, 0.235960737f},
-std::array<float,2>{0.0489347503f, 0.882710934f},
-std::array<float,2>{0.245496303f, 0.0661426783f},
-std::array<float,2>{0.779667974f, 0.81433636f},
-std::array<float,2>{0.538830757f, 0.276222765f},
-std::array<float,2>{0.372350961f, 0.589169979f},
-std::array<float,2>{0.0467984602f, 0.460300446f},
-std::array<float,2>{0.961218417f, 0.719389558f},
-std::array<float,2>{0.709288836f, 0.194762021f},
-std::array<float,2>{0.38829878f, 0.907188475f},
-std::array<float,2>{0.353860289f, 0.109764867f},
-std::array<float,2>{0.55725801f, 0.858813345f},
-std::array<float,2>{0.764942706f, 0.287090868f},
-std::array<float,2>{0.23202388f, 0.623457432f},
-std::array<float,2>{0.473523438f, 0.363266885f},
-std::array<float,2>{0.673895895f, 0.52143997f},
-std::array<float,2>{0.890096605f, 0.0211947076f},
-std::array<float,2>{0.0979670659f, 0.760733008f},
-std::array<float,2>{0.143493474f, 0.130270734f},
-std::array<float,2>{0.843848944f, 0.974797249f},
-std::array<float,2>{0.572748601f, 0.415701061f},
-std::array<float,2>{0.306952149f, 0.647055745f},
-std::array<float,2>{0.19179669f, 0.254273593f},
-std::array<float,2>{0.800670087f, 0.568790376f},
-std::array<float,2>{0.513443887f, 0.083469227f},
-std::array<float,2>{0.31643942f, 0.843057275f},
-std::array<float,2>{0.431001306f, 0.22420764f},
-std::array<float,2>{0.720839262f, 0.903763592f},
-std::array<float,2>{0.990346611f, 0.485800445f},
-std::array<float,2>{0.0162584968f, 0.703145087f},
-std::array<float,2>{0.255638421f, 0.383655727f},
-std::array<float,2>{0.59411186f, 0.66958493f},
-std::array<float,2>{0.825635314f, 0.159443185f},
-std::array<float,2>{0.16628097f, 0.948535144f},
-std::array<float,2>{0.084550254f, 0.0602672286f},
-std::array<float,2>{0.918648064f, 0.787896514f},
-std::array<float,2>{0.655463576f, 0.335719049f},
-std::array<float,2>{0.449529827f, 0.548705637f},
-std::array<float,2>{0.1607081f, 0.472568959f},
-std::array<float,2>{0.815380633f, 0.697683752f},
-std::array<float,2>{0.603000939f, 0.241765186f},
-std::array<float,2>{0.265433341f, 0.876198888f},
-std::array<float,2>{0.443869144f, 0.0664550662f},
-std::array<float,2>{0.643613636f, 0.817545474f},
-std::array<float,2>{0.908716142f, 0.278558642f},
-std::array<float,2>{0.0918787494f, 0.590662956f},
-std::array<float,2>{0.32543382f, 0.318626672f},
-std::array<float,2>{0.507398546f, 0.540774286f},
-std::array<float,2>{0.811497867f, 0.0378885455f},
-std::array<float,2>{0.197398752f, 0.800960004f},
-std::array<float,2>{0.0260326192f, 0.187057659f},
-std::array<float,2>{0.999635339f, 0.956611991f},
-std::array<float,2>{0.727471888f, 0.39448595f},
-std::array<float,2>{0.427149296f, 0.681460381f},
-std::array<float,2>{0.105588041f, 0.299488991f},
-std::array<float,2>{0.880371034f, 0.594213247f},
-std::array<float,2>{0.681680441f, 0.102632202f},
-std::array<float,2>{0.477101803f, 0.871697903f},
-std::array<float,2>{0.301477969f, 0.218056753f},
-std::array<float,2>{0.564736068f, 0.92481184f},
-std::array<float,2>{0.854851544f, 0.451713473f},
-std::array<float,2>{0.154681087f, 0.736277819f},
-std::array<float,2>{0.379451036f, 0.428492874f},
-std::array<float,2>{0.713919163f, 0.633076727f},
-std::array<float,2>{0.956011891f, 0.144461557f},
-std::array<float,2>{0.03440734f, 0.996595502f},
-std::array<float,2>{0.218867719f, 0.00632322719f},
-std::array<float,2>{0.753589272f, 0.767542601f},
-std::array<float,2>{0.552987158f, 0.345843017f},
-std::array<float,2>{0.344200373f, 0.508508146f},
-std::array<float,2>{0.0615770556f, 0.389243603f},
-std::array<float,2>{0.943718195f, 0.66572243f},
-std::array<float,2>{0.69208163f, 0.162449047f},
-std::array<float,2>{0.399192154f, 0.9516927f},
-std::array<float,2>{0.359459341f, 0.0550571606f},
-std::array<float,2>{0.54157424f, 0.785116971f},
-std::array<float,2>{0.769737661f, 0.331794649f},
-std::array<float,2>{0.236266986f, 0.552570283f},
-std::array<float,2>{0.488437295f, 0.252207458f},
-std::array<float,2>{0.663327873f, 0.5631603f},
-std::array<float,2>{0.90130955f, 0.0815488175f},
-std::array<float,2>{0.118116409f, 0.839494467f},
-std::array<float,2>{0.127189696f, 0.221280292f},
-std::array<float,2>{0.873245001f, 0.90102607f},
-std::array<float,2>{0.588389814f, 0.489170641f},
-std::array<float,2>{0.288745642f, 0.707984269f},
-std::array<float,2>{0.21725224f, 0.364039421f},
-std::array<float,2>{0.791595519f, 0.517550409f},
-std::array<float,2>{0.524871171f, 0.0169225279f},
-std::array<float,2>{0.338905513f, 0.762221515f},
-std::array<float,2>{0.418292522f, 0.125385955f},
-std::array<float,2>{0.744956911f, 0.971662998f},
-std::array<float,2>{0.97266084f, 0.420371264f},
-std::array<float,2>{0.00954391155f, 0.640935957f},
-std::array<float,2>{0.273593515f, 0.45541212f},
-std::array<float,2>{0.616813958f, 0.72651732f},
-std::array<float,2>{0.838349581f, 0.189656675f},
-std::array<float,2>{0.172382951f, 0.911706984f},
-std::array<float,2>{0.0774235427f, 0.11430911f},
-std::array<float,2>{0.929851532f, 0.853812873f},
-std::array<float,2>{0.636264622f, 0.284314513f},
-std::array<float,2>{0.468262911f, 0.619767308f},
-std::array<float,2>{0.249656066f, 0.40768823f},
-std::array<float,2>{0.776650131f, 0.656234562f},
-std::array<float,2>{0.534625828f, 0.132823125f},
-std::array<float,2>{0.368815273f, 0.978004336f},
-std::array<float,2>{0.39659068f, 0.024563726f},
-std::array<float,2>{0.701913536f, 0.751200616f},
-std::array<float,2>{0.950972855f, 0.371509999f},
-std::array<float,2>{0.054109592f, 0.529574096f},
-std::array<float,2>{0.294130325f, 0.292287201f},
-std::array<float,2>{0.585538328f, 0.614319026f},
-std::array<float,2>{0.865971744f, 0.119816236f},
-std::array<float,2>{0.133914471f, 0.848888099f},
-std::array<float,2>{0.113411911f, 0.196044698f},
-std::array<float,2>{0.891304135f, 0.917676687f},
-std::array<float,2>{0.666472793f, 0.468389541f},
-std::array<float,2>{0.49221459f, 0.726848483f},
-std::array<float,2>{0.0014966561f, 0.339086473f},
-std::array<float,2>{0.984203935f, 0.555228949f},
-std::array<float,2>{0.738801241f, 0.0488370769f},
-std::array<float,2>{0.413600624f, 0.795015156f},
-std::array<float,2>{0.329071224f, 0.169488385f},
-std::array<float,2>{0.519689918f, 0.938096106f},
-std::array<float,2>{0.785371125f, 0.381923705f},
-std::array<float,2>{0.208080143f, 0.658150077f},
-std::array<float,2>{0.459695309f, 0.497586459f},
-std::array<float,2>{0.626677811f, 0.715270638f},
-std::array<float,2>{0.927867949f, 0.232995182f},
-std::array<float,2>{0.067164056f, 0.891781926f},
-std::array<float,2>{0.183700576f, 0.0931616724f},
-std::array<float,2>{0.834524274f, 0.830644488f},
-std::array<float,2>{0.62205261f, 0.259272605f},
-std::array<float,2>{0.270730942f, 0.573986232f},
-std::array<float,2>{0.0803331658f, 0.444171339f},
-std::array<float,2>{0.915163815f, 0.745549679f},
-std::array<float,2>{0.649069607f, 0.208221108f},
-std::array<float,2>{0.445349097f, 0.935306907f},
-std::array<float,2>{0.251048863f, 0.0993292555f},
-std::array<float,2>{0.599350691f, 0.864790082f},
-std::array<float,2>{0.823373854f, 0.30961132f},
-std::array<float,2>{0.170914039f, 0.603038669f},
-std::array<float,2>{0.433609188f, 0.354687542f},
-std::array<float,2>{0.724857152f, 0.502480209f},
-std::array<float,2>{0.985563755f, 0.0149565265f},
-std::array<float,2>{0.0222201739f, 0.778247774f},
-std::array<float,2>{0.191104531f, 0.153651774f},
-std::array<float,2>{0.801221073f, 0.986465812f},
-std::array<float,2>{0.509842336f, 0.432009131f},
-std::array<float,2>{0.31334281f, 0.631895065f},
-std::array<float,2>{0.148330495f, 0.269888163f},
-std::array<float,2>{0.850245237f, 0.581821144f},
-std::array<float,2>{0.575931251f, 0.0736058205f},
-std::array<float,2>{0.310818493f, 0.826655328f},
-std::array<float,2>{0.469125211f, 0.242594451f},
-std::array<float,2>{0.675896883f, 0.889006495f},
-std::array<float,2>{0.882949471f, 0.478191018f},
-std::array<float,2>{0.0974317417f, 0.69467932f},
-std::array<float,2>{0.357007533f, 0.401092649f},
-std::array<float,2>{0.560543537f, 0.676919997f},
-std::array<float,2>{0.758260131f, 0.179314882f},
-std::array<float,2>{0.227859244f, 0.96225667f},
-std::array<float,2>{0.0411055908f, 0.0425152518f},
-std::array<float,2>{0.966964245f, 0.80720824f},
-std::array<float,2>{0.703398049f, 0.324776053f},
-std::array<float,2>{0.38402769f, 0.53841126f},
-std::array<float,2>{0.199449584f, 0.464280277f},
-std::array<float,2>{0.808099627f, 0.731364667f},
-std::array<float,2>{0.503610015f, 0.199821532f},
-std::array<float,2>{0.320541084f, 0.918069124f},
-std::array<float,2>{0.423641235f, 0.122587286f},
-std::array<float,2>{0.734215498f, 0.846431613f},
-std::array<float,2>{0.994744599f, 0.294801444f},
-std::array<float,2>{0.0293032788f, 0.61197412f},
-std::array<float,2>{0.261054963f, 0.367506593f},
-std::array<float,2>{0.607982516f, 0.525823355f},
-std::array<float,2>{0.819636524f, 0.0298081543f},
-std::array<float,2>{0.15674907f, 0.754014432f},
-std::array<float,2>{0.0876358747f, 0.139009103f},
-std::array<float,2>{0.911222398f, 0.982098103f},
-std::array<float,2>{0.647504449f, 0.410456955f},
-std::array<float,2>{0.438618481f, 0.651035309f},
-std::array<float,2>{0.0361536182f, 0.264782637f},
-std::array<float,2>{0.957389355f, 0.576189458f},
-std::array<float,2>{0.717477024f, 0.0879583135f},
-std::array<float,2>{0.377697855f, 0.835355937f},
-std::array<float,2>{0.347760916f, 0.227642208f},
-std::array<float,2>{0.549783766f, 0.896276236f},
-std::array<float,2>{0.757331431f, 0.495194852f},
-std::array<float,2>{0.222955868f, 0.713591695f},
-std::array<float,2>{0.481776804f, 0.375781417f},
-std::array<float,2>{0.685619354f, 0.662751853f},
-std::array<float,2>{0.877987146f, 0.1640843f},
-std::array<float,2>{0.102137387f, 0.941903174f},
-std::array<float,2>{0.149201632f, 0.0533411466f},
-std::array<float,2>{0.857232153f, 0.790234685f},
-std::array<float,2>{0.566920578f, 0.341483682f},
-std::array<float,2>{0.300224453f, 0.559420705f},
-std::array<float,2>{0.123774439f, 0.436313689f},
-std::array<float,2>{0.902810991f, 0.625598609f},
-std::array<float,2>{0.659207404f, 0.152042806f},
-std::array<float,2>{0.48463127f, 0.990065992f},
-std::array<float,2>{0.284433693f, 0.00866190437f},
-std::array<float,2>{0.591154814f, 0.774329007f},
-std::array<float,2>{0.870272577f, 0.356294036f},
-std::array<float,2>{0.131422296f, 0.505227625f},
-std::array<float,2>{0.40292567f, 0.305446118f},
-std::array<float,2>{0.689269185f, 0.606442392f},
-std::array<float,2>{0.940340281f, 0.0938569009f},
-std::array<float,2>{0.0571282953f, 0.862720728f},
-std::array<float,2>{0.239341512f, 0.205371723f},
-std::array<float,2>{0.766531229f, 0.931476235f},
-std::array<float,2>{0.544853508f, 0.440499902f},
-std::array<float,2>{0.36714384f, 0.749057531f},
-std::array<float,2>{0.176480234f, 0.322328925f},
-std::array<float,2>{0.842856705f, 0.531473994f},
-std::array<float,2>{0.60959065f, 0.0465807766f},
-std::array<float,2>{0.280530244f, 0.811514497f},
-std::array<float,2>{0.463453293f, 0.172110587f},
-std::array<float,2>{0.640197694f, 0.96568054f},
-std::array<float,2>{0.936178327f, 0.406069756f},
-std::array<float,2>{0.0738085136f, 0.675378144f},
-std::array<float,2>{0.342436939f, 0.48369357f},
-std::array<float,2>{0.530156255f, 0.68954581f},
-std::array<float,2>{0.794866025f, 0.249379098f},
-std::array<float,2>{0.211017206f, 0.883530438f},
-std::array<float,2>{0.0119859809f, 0.0756403282f},
-std::array<float,2>{0.972644567f, 0.822958708f},
-std::array<float,2>{0.747206211f, 0.266510546f},
-std::array<float,2>{0.417859852f, 0.585190952f},
-std::array<float,2>{0.137393311f, 0.3980591f},
-std::array<float,2>{0.861789048f, 0.685698152f},
-std::array<float,2>{0.579462349f, 0.183278888f},
-std::array<float,2>{0.29238537f, 0.958546102f},
-std::array<float,2>{0.499116212f, 0.0324766301f},
-std::array<float,2>{0.668869376f, 0.797783494f},
-std::array<float,2>{0.896995306f, 0.313982457f},
-std::array<float,2>{0.112234011f, 0.543660641f},
-std::array<float,2>{0.37487784f, 0.274248362f},
-std::array<float,2>{0.535477102f, 0.587191999f},
-std::array<float,2>{0.778461635f, 0.064029552f},
-std::array<float,2>{0.243329704f, 0.81520319f},
-std::array<float,2>{0.0480939038f, 0.237188891f},
-std::array<float,2>{0.945343435f, 0.87897265f},
-std::array<float,2>{0.695697129f, 0.475281924f},
-std::array<float,2>{0.390762657f, 0.701334953f},
-std::array<float,2>{0.0657570213f, 0.349903196f},
-std::array<float,2>{0.921976745f, 0.51355505f},
-std::array<float,2>{0.631381392f, 0.0011951949f},
-std::array<float,2>{0.456257701f, 0.772523582f},
-std::array<float,2>{0.268343776f, 0.146843448f},
-std::array<float,2>{0.61798507f, 0.992206097f},
-std::array<float,2>{0.829315007f, 0.422928989f},
-std::array<float,2>{0.181241646f, 0.63752538f},
-std::array<float,2>{0.407624245f, 0.446417153f},
-std::array<float,2>{0.736150742f, 0.738790572f},
-std::array<float,2>{0.979283273f, 0.212982163f},
-std::array<float,2>{0.00512936525f, 0.928685188f},
-std::array<float,2>{0.203377724f, 0.108951136f},
-std::array<float,2>{0.783301651f, 0.869254291f},
-std::array<float,2>{0.516134799f, 0.301989168f},
-std::array<float,2>{0.335197777f, 0.59905231f},
-std::array<float,2>{0.0193250645f, 0.487863958f},
-std::array<float,2>{0.989861608f, 0.706727266f},
-std::array<float,2>{0.720304608f, 0.225626305f},
-std::array<float,2>{0.432895601f, 0.905573368f},
-std::array<float,2>{0.320269376f, 0.0847288147f},
-std::array<float,2>{0.514978886f, 0.841632605f},
-std::array<float,2>{0.79729861f, 0.256668687f},
-std::array<float,2>{0.194397435f, 0.566592097f},
-std::array<float,2>{0.451479882f, 0.333527714f},
-std::array<float,2>{0.653813303f, 0.550329328f},
-std::array<float,2>{0.92065227f, 0.0623984523f},
-std::array<float,2>{0.083085075f, 0.785215199f},
-std::array<float,2>{0.164105177f, 0.156438977f},
-std::array<float,2>{0.827630937f, 0.946693957f},
-std::array<float,2>{0.59746778f, 0.386388302f},
-std::array<float,2>{0.256463259f, 0.671634138f},
-std::array<float,2>{0.2330589f, 0.288768083f},
-std::array<float,2>{0.761817515f, 0.62183702f},
-std::array<float,2>{0.555889904f, 0.111616604f},
-std::array<float,2>{0.352075875f, 0.856635928f},
-std::array<float,2>{0.390309483f, 0.192163467f},
-std::array<float,2>{0.708752036f, 0.908842564f},
-std::array<float,2>{0.963107288f, 0.458222419f},
-std::array<float,2>{0.043339774f, 0.722181141f},
-std::array<float,2>{0.304922074f, 0.417711705f},
-std::array<float,2>{0.571689129f, 0.646152139f},
-std::array<float,2>{0.846351981f, 0.130868047f},
-std::array<float,2>{0.142424285f, 0.973798096f},
-std::array<float,2>{0.101454467f, 0.0226140004f},
-std::array<float,2>{0.888225734f, 0.758611858f},
-std::array<float,2>{0.673094571f, 0.360846579f},
-std::array<float,2>{0.475767702f, 0.523272753f},
-std::array<float,2>{0.173816219f, 0.454839885f},
-std::array<float,2>{0.839805603f, 0.723250508f},
-std::array<float,2>{0.615867555f, 0.187613353f},
-std::array<float,2>{0.274731219f, 0.912316382f},
-std::array<float,2>{0.467069268f, 0.116587885f},
-std::array<float,2>{0.63526535f, 0.853483617f},
-std::array<float,2>{0.930850923f, 0.282428831f},
-std::array<float,2>{0.076959528f, 0.617947161f},
-std::array<float,2>{0.338027477f, 0.366058171f},
-std::array<float,2>{0.523666739f, 0.51855576f},
-std::array<float,2>{0.792556345f, 0.0185804516f},
-std::array<float,2>{0.218711451f, 0.765419364f},
-std::array<float,2>{0.00820534676f, 0.127567247f},
-std::array<float,2>{0.974341333f, 0.970217824f},
-std::array<float,2>{0.746082842f, 0.41892153f},
-std::array<float,2>{0.419220299f, 0.642774999f},
-std::array<float,2>{0.118463747f, 0.251728892f},
-std::array<float,2>{0.901940405f, 0.565919578f},
-std::array<float,2>{0.662868738f, 0.0782134905f},
-std::array<float,2>{0.48963502f, 0.837804675f},
-std::array<float,2>{0.287454486f, 0.219355121f},
-std::array<float,2>{0.589149535f, 0.900053442f},
-std::array<float,2>{0.874451578f, 0.492025673f},
-std::array<float,2>{0.128825426f, 0.710304201f},
-std::array<float,2>{0.400035948f, 0.388326764f},
-std::array<float,2>{0.69306463f, 0.667609811f},
-std::array<float,2>{0.945189714f, 0.16061683f},
-std::array<float,2>{0.0609084405f, 0.950187862f},
-std::array<float,2>{0.235023677f, 0.0567778684f},
-std::array<float,2>{0.771143973f, 0.781657755f},
-std::array<float,2>{0.542777836f, 0.329179347f},
-std::array<float,2>{0.36056444f, 0.553465426f},
-std::array<float,2>{0.0337317809f, 0.425850451f},
-std::array<float,2>{0.956341386f, 0.635742068f},
-std::array<float,2>{0.713858128f, 0.14065893f},
-std::array<float,2>{0.38011384f, 0.998247623f},
-std::array<float,2>{0.34482497f, 0.00466125505f},
-std::array<float,2>{0.553985298f, 0.768375218f},
-std::array<float,2>{0.752259612f, 0.3447963f},
-std::array<float,2>{0.219800562f, 0.510740459f},
-std::array<float,2>{0.477770746f, 0.297621131f},
-std::array<float,2>{0.683285654f, 0.597451866f},
-std::array<float,2>{0.879614651f, 0.105445608f},
-std::array<float,2>{0.107355058f, 0.874058127f},
-std::array<float,2>{0.155973405f, 0.215139538f},
-std::array<float,2>{0.853886366f, 0.923193216f},
-std::array<float,2>{0.566257298f, 0.449398845f},
-std::array<float,2>{0.302395016f, 0.736600757f},
-std::array<float,2>{0.19825235f, 0.317763448f},
-std::array<float,2>{0.812037349f, 0.541988552f},
-std::array<float,2>{0.506408513f, 0.0367698446f},
-std::array<float,2>{0.324836016f, 0.802830458f},
-std::array<float,2>{0.42626074f, 0.184639663f},
-std::array<float,2>{0.727783561f, 0.95439738f},
-std::array<float,2>{0.998442352f, 0.391008168f},
-std::array<float,2>{0.0267699957f, 0.682518482f},
-std::array<float,2>{0.264367908f, 0.46924296f},
-std::array<float,2>{0.602447927f, 0.696295142f},
-std::array<float,2>{0.816156089f, 0.23871769f},
-std::array<float,2>{0.161918491f, 0.877770424f},
-std::array<float,2>{0.0931604132f, 0.0689515695f},
-std::array<float,2>{0.909180701f, 0.818800569f},
-std::array<float,2>{0.64293772f, 0.280896723f},
-std::array<float,2>{0.444726437f, 0.591997862f},
-std::array<float,2>{0.226691931f, 0.399312079f},
-std::array<float,2>{0.759030998f, 0.6788764f},
-std::array<float,2>{0.558684051f, 0.175893947f},
-std::array<float,2>{0.355889291f, 0.964654386f},
-std::array<float,2>{0.383364558f, 0.0406397358f},
-std::array<float,2>{0.704251945f, 0.805998921f},
-std::array<float,2>{0.968441129f, 0.327900767f},
-std::array<float,2>{0.0424175337f, 0.535653889f},
-std::array<float,2>{0.312315375f, 0.271743387f},
-std::array<float,2>{0.574688137f, 0.578931689f},
-std::array<float,2>{0.85082382f, 0.0719408318f},
-std::array<float,2>{0.146976501f, 0.825995088f},
-std::array<float,2>{0.0966227502f, 0.245332614f},
-std::array<float,2>{0.883839548f, 0.887585104f},
-std::array<float,2>{0.677144825f, 0.47869879f},
-std::array<float,2>{0.469808906f, 0.692449152f},
-std::array<float,2>{0.0230696425f, 0.352911919f},
-std::array<float,2>{0.985157788f, 0.501216292f},
-std::array<float,2>{0.726253927f, 0.0132434536f},
-std::array<float,2>{0.435032904f, 0.780673563f},
-std::array<float,2>{0.313878f, 0.154559731f},
-std::array<float,2>{0.511144936f, 0.985597968f},
-std::array<float,2>{0.802287281f, 0.430786639f},
-std::array<float,2>{0.189793482f, 0.630171895f},
-std::array<float,2>{0.446532547f, 0.443022639f},
-std::array<float,2>{0.649844229f, 0.74232024f},
-std::array<float,2>{0.914480209f, 0.209044844f},
-std::array<float,2>{0.0812094882f, 0.937184453f},
-std::array<float,2>{0.169976756f, 0.100782223f},
-std::array<float,2>{0.823012829f, 0.866216183f},
-std::array<float,2>{0.597993255f, 0.312327147f},
-std::array<float,2>{0.250624627f, 0.604467988f},
-std::array<float,2>{0.0679043308f, 0.499711484f},
-std::array<float,2>{0.929094851f, 0.717556596f},
-std::array<float,2>{0.625590742f, 0.230471328f},
-std::array<float,2>{0.460491806f, 0.893894613f},
-std::array<float,2>{0.270136178f, 0.0904231593f},
-std::array<float,2>{0.622355342f, 0.830046594f},
-std::array<float,2>{0.83526057f, 0.260416746f},
-std::array<float,2>{0.185024738f, 0.57200098f},
-std::array<float,2>{0.412799686f, 0.336857319f},
-std::array<float,2>{0.740136504f, 0.557148755f},
-std::array<float,2>{0.983359456f, 0.0483322032f},
-std::array<float,2>{0.000608817965f, 0.793830872f},
-std::array<float,2>{0.207072929f, 0.1703448f},
-std::array<float,2>{0.786935687f, 0.939711809f},
-std::array<float,2>{0.521413982f, 0.379237205f},
-std::array<float,2>{0.329816878f, 0.65884757f},
-std::array<float,2>{0.133105621f, 0.290059209f},
-std::array<float,2>{0.866976202f, 0.616301656f},
-std::array<float,2>{0.584762335f, 0.117778607f},
-std::array<float,2>{0.293144941f, 0.850460172f},
-std::array<float,2>{0.493405938f, 0.198383853f},
-std::array<float,2>{0.667587698f, 0.915386796f},
-std::array<float,2>{0.891822577f, 0.46674782f},
-std::array<float,2>{0.115217626f, 0.730026186f},
-std::array<float,2>{0.367286056f, 0.410062402f},
-std::array<float,2>{0.533794463f, 0.653658271f},
-std::array<float,2>{0.776147306f, 0.136567473f},
-std::array<float,2>{0.248869374f, 0.979632795f},
-std::array<float,2>{0.053023003f, 0.0272620097f},
-std::array<float,2>{0.949912131f, 0.751977503f},
-std::array<float,2>{0.702790141f, 0.374841094f},
-std::array<float,2>{0.397895277f, 0.527485549f},
-std::array<float,2>{0.212027922f, 0.481587738f},
-std::array<float,2>{0.793095112f, 0.689429045f},
-std::array<float,2>{0.531055093f, 0.247162282f},
-std::array<float,2>{0.343623757f, 0.885470867f},
-std::array<float,2>{0.416107953f, 0.0769626871f},
-std::array<float,2>{0.746364534f, 0.820443273f},
-std::array<float,2>{0.971652448f, 0.268071592f},
-std::array<float,2>{0.013292118f, 0.583272994f},
-std::array<float,2>{0.280095547f, 0.320861936f},
-std::array<float,2>{0.611172915f, 0.533609092f},
-std::array<float,2>{0.842419803f, 0.0439791568f},
-std::array<float,2>{0.177696079f, 0.808660388f},
-std::array<float,2>{0.0726935491f, 0.174571589f},
-std::array<float,2>{0.937289417f, 0.967639208f},
-std::array<float,2>{0.639169812f, 0.402952462f},
-std::array<float,2>{0.463988543f, 0.673091412f},
-std::array<float,2>{0.0583033822f, 0.308452308f},
-std::array<float,2>{0.940761566f, 0.607633412f},
-std::array<float,2>{0.688230395f, 0.0958178788f},
-std::array<float,2>{0.404049605f, 0.859681964f},
-std::array<float,2>{0.365765154f, 0.204678193f},
-std::array<float,2>{0.543820798f, 0.933160603f},
-std::array<float,2>{0.767208397f, 0.438054174f},
-std::array<float,2>{0.238808542f, 0.747076869f},
-std::array<float,2>{0.485617429f, 0.435116053f},
-std::array<float,2>{0.658248425f, 0.627920568f},
-std::array<float,2>{0.903482318f, 0.148508325f},
-std::array<float,2>{0.124094628f, 0.990574062f},
-std::array<float,2>{0.132466078f, 0.0108136646f},
-std::array<float,2>{0.869443715f, 0.775480986f},
-std::array<float,2>{0.590593576f, 0.35866645f},
-std::array<float,2>{0.283365309f, 0.50652796f},
-std::array<float,2>{0.10276559f, 0.377736241f},
-std::array<float,2>{0.87746191f, 0.660298347f},
-std::array<float,2>{0.686736047f, 0.166478395f},
-std::array<float,2>{0.481128722f, 0.945079744f},
-std::array<float,2>{0.298852354f, 0.052051805f},
-std::array<float,2>{0.568226635f, 0.792918682f},
-std::array<float,2>{0.855852664f, 0.343138874f},
-std::array<float,2>{0.149868771f, 0.56084311f},
-std::array<float,2>{0.378823996f, 0.26293695f},
-std::array<float,2>{0.718182564f, 0.575777948f},
-std::array<float,2>{0.958792627f, 0.0866962373f},
-std::array<float,2>{0.0357179753f, 0.833260834f},
-std::array<float,2>{0.22403115f, 0.229108438f},
-std::array<float,2>{0.756473064f, 0.897052646f},
-std::array<float,2>{0.550072432f, 0.493513376f},
-std::array<float,2>{0.349015176f, 0.711126566f},
-std::array<float,2>{0.157983929f, 0.370882422f},
-std::array<float,2>{0.818606377f, 0.525141954f},
-std::array<float,2>{0.609243035f, 0.0274248794f},
-std::array<float,2>{0.260586649f, 0.75635004f},
-std::array<float,2>{0.438409507f, 0.137678742f},
-std::array<float,2>{0.646789491f, 0.98309505f},
-std::array<float,2>{0.910482705f, 0.412552983f},
-std::array<float,2>{0.0867225006f, 0.648489892f},
-std::array<float,2>{0.32148838f, 0.461666703f},
-std::array<float,2>{0.502106011f, 0.733998775f},
-std::array<float,2>{0.807156682f, 0.201683164f},
-std::array<float,2>{0.200297773f, 0.920210779f},
-std::array<float,2>{0.030891981f, 0.124033161f},
-std::array<float,2>{0.995461643f, 0.844487429f},
-std::array<float,2>{0.73330009f, 0.295560867f},
-std::array<float,2>{0.422392398f, 0.610013843f},
-std::array<float,2>{0.140984789f, 0.414932221f},
-std::array<float,2>{0.847165823f, 0.647860765f},
-std::array<float,2>{0.570354939f, 0.129578277f},
-std::array<float,2>{0.305711985f, 0.976370811f},
-std::array<float,2>{0.474892318f, 0.0197430849f},
-std::array<float,2>{0.672094882f, 0.76082927f},
-std::array<float,2>{0.887176812f, 0.361397505f},
-std::array<float,2>{0.100349009f, 0.519927502f},
-std::array<float,2>{0.353150874f, 0.286116719f},
-std::array<float,2>{0.554693818f, 0.624231339f},
-std::array<float,2>{0.763519704f, 0.111273818f},
-std::array<float,2>{0.233612239f, 0.85764575f},
-std::array<float,2>{0.0439978093f, 0.193851739f},
-std::array<float,2>{0.964105427f, 0.908144236f},
-std::array<float,2>{0.707261503f, 0.45976457f},
-std::array<float,2>{0.388679802f, 0.720010281f},
-std::array<float,2>{0.0823338777f, 0.334449887f},
-std::array<float,2>{0.921857476f, 0.547258198f},
-std::array<float,2>{0.653083682f, 0.0592427552f},
-std::array<float,2>{0.45272097f, 0.789029479f},
-std::array<float,2>{0.257125318f, 0.158489689f},
-std::array<float,2>{0.596018553f, 0.948016644f},
-std::array<float,2>{0.826674283f, 0.384020209f},
-std::array<float,2>{0.165346235f, 0.668803751f},
-std::array<float,2>{0.431855232f, 0.484630853f},
-std::array<float,2>{0.718812585f, 0.704624474f},
-std::array<float,2>{0.988552928f, 0.22329165f},
-std::array<float,2>{0.0179606229f, 0.902900755f},
-std::array<float,2>{0.193883315f, 0.0826334879f},
-std::array<float,2>{0.798075616f, 0.842681885f},
-std::array<float,2>{0.514509201f, 0.254918694f},
-std::array<float,2>{0.318762153f, 0.569861352f},
-std::array<float,2>{0.00476768287f, 0.447652638f},
-std::array<float,2>{0.980145574f, 0.741900921f},
-std::array<float,2>{0.734542251f, 0.211935192f},
-std::array<float,2>{0.406837463f, 0.926196516f},
-std::array<float,2>{0.334650427f, 0.105792657f},
-std::array<float,2>{0.516993344f, 0.86734432f},
-std::array<float,2>{0.784946918f, 0.303706527f},
-std::array<float,2>{0.204417169f, 0.600642562f},
-std::array<float,2>{0.455803245f, 0.348547667f},
-std::array<float,2>{0.632162094f, 0.514208674f},
-std::array<float,2>{0.923793912f, 0.00319199474f},
-std::array<float,2>{0.0652868301f, 0.771426022f},
-std::array<float,2>{0.179707766f, 0.145985559f},
-std::array<float,2>{0.828720808f, 0.99600178f},
-std::array<float,2>{0.618831933f, 0.425107211f},
-std::array<float,2>{0.269107342f, 0.639833868f},
-std::array<float,2>{0.242646158f, 0.276408941f},
-std::array<float,2>{0.777488232f, 0.588236094f},
-std::array<float,2>{0.536634922f, 0.0647284016f},
-std::array<float,2>{0.373406887f, 0.81310606f},
-std::array<float,2>{0.391685784f, 0.234875694f},
-std::array<float,2>{0.697233021f, 0.881304204f},
-std::array<float,2>{0.94633007f, 0.473127455f},
-std::array<float,2>{0.0469692498f, 0.700042069f},
-std::array<float,2>{0.291523337f, 0.394754827f},
-std::array<float,2>{0.578404963f, 0.68478173f},
-std::array<float,2>{0.86305064f, 0.179999962f},
-std::array<float,2>{0.138308689f, 0.960061908f},
-std::array<float,2>{0.112808518f, 0.033210624f},
-std::array<float,2>{0.897710085f, 0.799658597f},
-std::array<float,2>{0.669424355f, 0.315156609f},
-std::array<float,2>{0.498204827f, 0.546120644f},
-std::array<float,2>{0.125550136f, 0.490143001f},
-std::array<float,2>{0.871407628f, 0.708893955f},
-std::array<float,2>{0.58609122f, 0.222371802f},
-std::array<float,2>{0.287029475f, 0.901961088f},
-std::array<float,2>{0.491169691f, 0.0809767619f},
-std::array<float,2>{0.660489202f, 0.838356555f},
-std::array<float,2>{0.898479939f, 0.253369927f},
-std::array<float,2>{0.120938838f, 0.564301193f},
-std::array<float,2>{0.361819416f, 0.330624789f},
-std::array<float,2>{0.539441228f, 0.55164969f},
-std::array<float,2>{0.771879375f, 0.0565599054f},
-std::array<float,2>{0.238208041f, 0.783475876f},
-std::array<float,2>{0.0601785295f, 0.163631618f},
-std::array<float,2>{0.943242729f, 0.952460825f},
-std::array<float,2>{0.693505287f, 0.389926136f},
-std::array<float,2>{0.401651353f, 0.664692581f},
-std::array<float,2>{0.0754124299f, 0.284018517f},
-std::array<float,2>{0.933580816f, 0.62101692f},
-std::array<float,2>{0.634356201f, 0.113751829f},
-std::array<float,2>{0.465615302f, 0.855285466f},
-std::array<float,2>{0.276847035f, 0.190727517f},
-std::array<float,2>{0.614888608f, 0.910994768f},
-std::array<float,2>{0.836274862f, 0.456980169f},
-std::array<float,2>{0.174064502f, 0.725494087f},
-std::array<float,2>{0.421231449f, 0.42130971f},
-std::array<float,2>{0.743386269f, 0.642346084f},
-std::array<float,2>{0.974903405f, 0.126776412f},
-std::array<float,2>{0.0106309019f, 0.972636521f},
-std::array<float,2>{0.215214953f, 0.0160286687f},
-std::array<float,2>{0.789802909f, 0.763080895f},
-std::array<float,2>{0.52640301f, 0.364596695f},
-std::array<float,2>{0.337551594f, 0.516248643f},
-std::array<float,2>{0.0234712884f, 0.39272806f},
-std::array<float,2>{0.997285962f, 0.680356979f},
-std::array<float,2>{0.728659809f, 0.185929224f},
-std::array<float,2>{0.428135633f, 0.95554316f},
-std::array<float,2>{0.327282578f, 0.0390563831f},
-std::array<float,2>{0.504005373f, 0.802193165f},
-std::array<float,2>{0.809717357f, 0.319609344f},
-std::array<float,2>{0.196028665f, 0.539567411f},
-std::array<float,2>{0.442445278f, 0.27808243f},
-std::array<float,2>{0.641446888f, 0.591075003f},
-std::array<float,2>{0.906607151f, 0.0683063045f},
-std::array<float,2>{0.0911240578f, 0.816641569f},
-std::array<float,2>{0.163630813f, 0.241197929f},
-std::array<float,2>{0.812761426f, 0.87502408f},
-std::array<float,2>{0.603977799f, 0.470888525f},
-std::array<float,2>{0.263204217f, 0.698469102f},
-std::array<float,2>{0.221429363f, 0.347538173f},
-std::array<float,2>{0.750629663f, 0.509528995f},
-std::array<float,2>{0.55171746f, 0.00685479678f},
-std::array<float,2>{0.34758845f, 0.765791059f},
-std::array<float,2>{0.381551355f, 0.14260456f},
-std::array<float,2>{0.712072074f, 0.997115731f},
-std::array<float,2>{0.953994215f, 0.429077446f},
-std::array<float,2>{0.0320253931f, 0.634378612f},
-std::array<float,2>{0.302810758f, 0.453055203f},
-std::array<float,2>{0.563171864f, 0.734702766f},
-std::array<float,2>{0.853259504f, 0.216890275f},
-std::array<float,2>{0.154068276f, 0.924075007f},
-std::array<float,2>{0.108145081f, 0.102332957f},
-std::array<float,2>{0.882043719f, 0.872748435f},
-std::array<float,2>{0.681555092f, 0.30002436f},
-std::array<float,2>{0.478952557f, 0.595590115f},
-std::array<float,2>{0.188187703f, 0.433056861f},
-std::array<float,2>{0.803483665f, 0.63095212f},
-std::array<float,2>{0.507848263f, 0.153200999f},
-std::array<float,2>{0.316144824f, 0.988105714f},
-std::array<float,2>{0.436439425f, 0.014416608f},
-std::array<float,2>{0.722848237f, 0.778832793f},
-std::array<float,2>{0.988185883f, 0.354459405f},
-std::array<float,2>{0.0214540027f, 0.503614664f},
-std::array<float,2>{0.252522469f, 0.308691531f},
-std::array<float,2>{0.600401402f, 0.602303624f},
-std::array<float,2>{0.821134627f, 0.0985370055f},
-std::array<float,2>{0.169657096f, 0.863881648f},
-std::array<float,2>{0.0785797909f, 0.207285956f},
-std::array<float,2>{0.917607009f, 0.933765411f},
-std::array<float,2>{0.651203096f, 0.444705218f},
-std::array<float,2>{0.447479278f, 0.744932294f},
-std::array<float,2>{0.0408524014f, 0.325570136f},
-std::array<float,2>{0.966638029f, 0.53775245f},
-std::array<float,2>{0.705313981f, 0.041416157f},
-std::array<float,2>{0.384779871f, 0.807800949f},
-std::array<float,2>{0.358254164f, 0.178126246f},
-std::array<float,2>{0.562050402f, 0.961319804f},
-std::array<float,2>{0.759828448f, 0.401367903f},
-std::array<float,2>{0.230004326f, 0.676132023f},
-std::array<float,2>{0.47179383f, 0.477039605f},
-std::array<float,2>{0.67828536f, 0.6937446f},
-std::array<float,2>{0.885436535f, 0.243349299f},
-std::array<float,2>{0.0954830721f, 0.889882743f},
-std::array<float,2>{0.144547313f, 0.073017709f},
-std::array<float,2>{0.8488307f, 0.827478886f},
-std::array<float,2>{0.576898396f, 0.270904571f},
-std::array<float,2>{0.30888626f, 0.58050102f},
-std::array<float,2>{0.115783334f, 0.467594951f},
-std::array<float,2>{0.893385112f, 0.728035867f},
-std::array<float,2>{0.665218234f, 0.196611166f},
-std::array<float,2>{0.495597035f, 0.916511238f},
-std::array<float,2>{0.296722502f, 0.120982394f},
-std::array<float,2>{0.582239449f, 0.848206997f},
-std::array<float,2>{0.863727808f, 0.291220576f},
-std::array<float,2>{0.135690272f, 0.6136778f},
-std::array<float,2>{0.395202935f, 0.372149199f},
-std::array<float,2>{0.700224638f, 0.530890822f},
-std::array<float,2>{0.952024162f, 0.02390524f},
-std::array<float,2>{0.0526824743f, 0.75093168f},
-std::array<float,2>{0.247468472f, 0.134023011f},
-std::array<float,2>{0.773439288f, 0.977310181f},
-std::array<float,2>{0.531950474f, 0.406462401f},
-std::array<float,2>{0.369299293f, 0.654942334f},
-std::array<float,2>{0.187240914f, 0.25795716f},
-std::array<float,2>{0.832673907f, 0.57256633f},
-std::array<float,2>{0.623692811f, 0.0919278413f},
-std::array<float,2>{0.272466481f, 0.831424475f},
-std::array<float,2>{0.457861811f, 0.233866364f},
-std::array<float,2>{0.628245354f, 0.891120672f},
-std::array<float,2>{0.92709887f, 0.496807188f},
-std::array<float,2>{0.0697195381f, 0.716251135f},
-std::array<float,2>{0.330670029f, 0.381731123f},
-std::array<float,2>{0.522948861f, 0.656421661f},
-std::array<float,2>{0.788947582f, 0.168592826f},
-std::array<float,2>{0.210533381f, 0.93926245f},
-std::array<float,2>{0.00355382636f, 0.0498666428f},
-std::array<float,2>{0.980683863f, 0.7966187f},
-std::array<float,2>{0.74136287f, 0.33872661f},
-std::array<float,2>{0.410202414f, 0.556236923f},
-std::array<float,2>{0.242079735f, 0.439893156f},
-std::array<float,2>{0.76877588f, 0.748465896f},
-std::array<float,2>{0.545815885f, 0.206792831f},
-std::array<float,2>{0.364414006f, 0.930287838f},
-std::array<float,2>{0.404939115f, 0.0955077633f},
-std::array<float,2>{0.690726936f, 0.861780226f},
-std::array<float,2>{0.937943876f, 0.306207716f},
-std::array<float,2>{0.0558261424f, 0.606957018f},
-std::array<float,2>{0.282104313f, 0.356913358f},
-std::array<float,2>{0.593049228f, 0.504014552f},
-std::array<float,2>{0.867740989f, 0.00896709692f},
-std::array<float,2>{0.129247516f, 0.774951696f},
-std::array<float,2>{0.12111567f, 0.150819764f},
-std::array<float,2>{0.906078756f, 0.988668144f},
-std::array<float,2>{0.657872558f, 0.436780035f},
-std::array<float,2>{0.486870319f, 0.626303494f},
-std::array<float,2>{0.015367819f, 0.267177045f},
-std::array<float,2>{0.970000744f, 0.584079802f},
-std::array<float,2>{0.74840641f, 0.0749247074f},
-std::array<float,2>{0.415928274f, 0.823263228f},
-std::array<float,2>{0.341239691f, 0.248991668f},
-std::array<float,2>{0.528313041f, 0.884280682f},
-std::array<float,2>{0.796810627f, 0.482795358f},
-std::array<float,2>{0.213821217f, 0.691079438f},
-std::array<float,2>{0.462562472f, 0.404325366f},
-std::array<float,2>{0.638561547f, 0.673882186f},
-std::array<float,2>{0.93489629f, 0.173632786f},
-std::array<float,2>{0.0704920664f, 0.966418028f},
-std::array<float,2>{0.17958571f, 0.0455409773f},
-std::array<float,2>{0.841259122f, 0.811542034f},
-std::array<float,2>{0.612485945f, 0.323911488f},
-std::array<float,2>{0.278719872f, 0.532990754f},
-std::array<float,2>{0.0879520997f, 0.411358804f},
-std::array<float,2>{0.913539231f, 0.651690781f},
-std::array<float,2>{0.645786226f, 0.139807165f},
-std::array<float,2>{0.440957278f, 0.980638504f},
-std::array<float,2>{0.259512007f, 0.0307125095f},
-std::array<float,2>{0.607396781f, 0.755486488f},
-std::array<float,2>{0.818239093f, 0.368461967f},
-std::array<float,2>{0.159446254f, 0.526759267f},
-std::array<float,2>{0.425056219f, 0.29325223f},
-std::array<float,2>{0.731336713f, 0.613020539f},
-std::array<float,2>{0.993061125f, 0.12175478f},
-std::array<float,2>{0.0280017108f, 0.846776783f},
-std::array<float,2>{0.201962382f, 0.201131999f},
-std::array<float,2>{0.805334151f, 0.919473827f},
-std::array<float,2>{0.500657558f, 0.463440597f},
-std::array<float,2>{0.323072433f, 0.731832981f},
-std::array<float,2>{0.150604054f, 0.340000272f},
-std::array<float,2>{0.85929805f, 0.560109437f},
-std::array<float,2>{0.569763124f, 0.0545908734f},
-std::array<float,2>{0.297071695f, 0.789411664f},
-std::array<float,2>{0.483926952f, 0.165489092f},
-std::array<float,2>{0.684002101f, 0.942822158f},
-std::array<float,2>{0.876031518f, 0.376111925f},
-std::array<float,2>{0.104012243f, 0.663552821f},
-std::array<float,2>{0.351007611f, 0.495031714f},
-std::array<float,2>{0.548290491f, 0.714740455f},
-std::array<float,2>{0.755700648f, 0.227526903f},
-std::array<float,2>{0.226169646f, 0.895384252f},
-std::array<float,2>{0.0376027487f, 0.0891223326f},
-std::array<float,2>{0.960618913f, 0.834408581f},
-std::array<float,2>{0.716682971f, 0.264570922f},
-std::array<float,2>{0.375383139f, 0.577151f},
-std::array<float,2>{0.167764276f, 0.385062933f},
-std::array<float,2>{0.824717939f, 0.670800745f},
-std::array<float,2>{0.595520556f, 0.157508269f},
-std::array<float,2>{0.25469172f, 0.945975423f},
-std::array<float,2>{0.450658888f, 0.0605739839f},
-std::array<float,2>{0.654612362f, 0.78650254f},
-std::array<float,2>{0.919551432f, 0.332798868f},
-std::array<float,2>{0.0856523514f, 0.549138188f},
-std::array<float,2>{0.317891896f, 0.257597655f},
-std::array<float,2>{0.511859775f, 0.567415595f},
-std::array<float,2>{0.799227953f, 0.0851955041f},
-std::array<float,2>{0.193122551f, 0.840463042f},
-std::array<float,2>{0.0170100443f, 0.225259528f},
-std::array<float,2>{0.991301179f, 0.904958308f},
-std::array<float,2>{0.722225785f, 0.486877888f},
-std::array<float,2>{0.429765046f, 0.705945373f},
-std::array<float,2>{0.0996056721f, 0.360287338f},
-std::array<float,2>{0.888803482f, 0.521547258f},
-std::array<float,2>{0.675012469f, 0.0215422288f},
-std::array<float,2>{0.473834127f, 0.759693861f},
-std::array<float,2>{0.307771266f, 0.132624879f},
-std::array<float,2>{0.573536754f, 0.972802699f},
-std::array<float,2>{0.84513104f, 0.416031241f},
-std::array<float,2>{0.143817291f, 0.645097971f},
-std::array<float,2>{0.38741684f, 0.457098603f},
-std::array<float,2>{0.710290253f, 0.721357822f},
-std::array<float,2>{0.962056935f, 0.193233639f},
-std::array<float,2>{0.0455401093f, 0.90940088f},
-std::array<float,2>{0.231019989f, 0.112544991f},
-std::array<float,2>{0.763878822f, 0.855861068f},
-std::array<float,2>{0.557894111f, 0.287156254f},
-std::array<float,2>{0.354620814f, 0.622686028f},
-std::array<float,2>{0.0505879074f, 0.475902528f},
-std::array<float,2>{0.949007869f, 0.702868521f},
-std::array<float,2>{0.697338402f, 0.238211274f},
-std::array<float,2>{0.394325435f, 0.880470276f},
-std::array<float,2>{0.371992052f, 0.0632075146f},
-std::array<float,2>{0.537621439f, 0.816243649f},
-std::array<float,2>{0.780283034f, 0.274792969f},
-std::array<float,2>{0.24446702f, 0.586549163f},
-std::array<float,2>{0.496404946f, 0.313461274f},
-std::array<float,2>{0.671250939f, 0.544573724f},
-std::array<float,2>{0.894760072f, 0.0320690237f},
-std::array<float,2>{0.109510995f, 0.797879755f},
-std::array<float,2>{0.139413461f, 0.18227011f},
-std::array<float,2>{0.861014962f, 0.957061172f},
-std::array<float,2>{0.581518948f, 0.397032797f},
-std::array<float,2>{0.290277064f, 0.687121451f},
-std::array<float,2>{0.205445409f, 0.301025003f},
-std::array<float,2>{0.781879842f, 0.598476052f},
-std::array<float,2>{0.518656731f, 0.108125344f},
-std::array<float,2>{0.332244575f, 0.870768726f},
-std::array<float,2>{0.409376264f, 0.214473546f},
-std::array<float,2>{0.737772524f, 0.929496467f},
-std::array<float,2>{0.977271676f, 0.446074694f},
-std::array<float,2>{0.00606417703f, 0.740168869f},
-std::array<float,2>{0.267510653f, 0.422791034f},
-std::array<float,2>{0.62008816f, 0.638314247f},
-std::array<float,2>{0.830865085f, 0.14750509f},
-std::array<float,2>{0.183189496f, 0.993928611f},
-std::array<float,2>{0.064299956f, 0.000197170346f},
-std::array<float,2>{0.923938453f, 0.771552205f},
-std::array<float,2>{0.630103528f, 0.351367474f},
-std::array<float,2>{0.454827666f, 0.512411475f},
-std::array<float,2>{0.128951237f, 0.438630581f},
-std::array<float,2>{0.868096471f, 0.746228337f},
-std::array<float,2>{0.592976332f, 0.203234211f},
-std::array<float,2>{0.281931937f, 0.93215704f},
-std::array<float,2>{0.487166733f, 0.0972309783f},
-std::array<float,2>{0.658083498f, 0.860690892f},
-std::array<float,2>{0.90599966f, 0.306994557f},
-std::array<float,2>{0.121489994f, 0.608930945f},
-std::array<float,2>{0.364735514f, 0.357811123f},
-std::array<float,2>{0.545588195f, 0.507767916f},
-std::array<float,2>{0.768993378f, 0.0103800083f},
-std::array<float,2>{0.241775513f, 0.776775062f},
-std::array<float,2>{0.0559451655f, 0.150213569f},
-std::array<float,2>{0.937533915f, 0.991771281f},
-std::array<float,2>{0.690544963f, 0.434316933f},
-std::array<float,2>{0.405082166f, 0.628379107f},
-std::array<float,2>{0.0707968548f, 0.268729776f},
-std::array<float,2>{0.934638739f, 0.582794487f},
-std::array<float,2>{0.63834703f, 0.0775935426f},
-std::array<float,2>{0.462802738f, 0.822166324f},
-std::array<float,2>{0.278515399f, 0.246173233f},
-std::array<float,2>{0.612662435f, 0.886024475f},
-std::array<float,2>{0.841006815f, 0.480610192f},
-std::array<float,2>{0.179201797f, 0.687616408f},
-std::array<float,2>{0.415742904f, 0.404021561f},
-std::array<float,2>{0.748099983f, 0.672329307f},
-std::array<float,2>{0.969940722f, 0.175086915f},
-std::array<float,2>{0.0155970808f, 0.968377709f},
-std::array<float,2>{0.213607222f, 0.0430217311f},
-std::array<float,2>{0.796417475f, 0.810425937f},
-std::array<float,2>{0.527844608f, 0.322223604f},
-std::array<float,2>{0.34093821f, 0.53454566f},
-std::array<float,2>{0.0281498581f, 0.414013565f},
-std::array<float,2>{0.992906809f, 0.649792969f},
-std::array<float,2>{0.731145203f, 0.138586044f},
-std::array<float,2>{0.424989104f, 0.983947933f},
-std::array<float,2>{0.322780281f, 0.0292915981f},
-std::array<float,2>{0.500745475f, 0.757381797f},
-std::array<float,2>{0.805514514f, 0.370062709f},
-std::array<float,2>{0.201803774f, 0.52396965f},
-std::array<float,2>{0.441343933f, 0.29636699f},
-std::array<float,2>{0.645531535f, 0.610871136f},
-std::array<float,2>{0.913317084f, 0.123328537f},
-std::array<float,2>{0.0881664604f, 0.84497416f},
-std::array<float,2>{0.159236521f, 0.203056037f},
-std::array<float,2>{0.818078458f, 0.921584308f},
-std::array<float,2>{0.60693866f, 0.462148219f},
-std::array<float,2>{0.259595126f, 0.73245424f},
-std::array<float,2>{0.226561055f, 0.342721194f},
-std::array<float,2>{0.755466223f, 0.561577022f},
-std::array<float,2>{0.548050344f, 0.0517244115f},
-std::array<float,2>{0.350619853f, 0.791768193f},
-std::array<float,2>{0.375108659f, 0.167209566f},
-std::array<float,2>{0.716479123f, 0.94432056f},
-std::array<float,2>{0.960864305f, 0.378657132f},
-std::array<float,2>{0.0379792564f, 0.661851943f},
-std::array<float,2>{0.297310323f, 0.492636085f},
-std::array<float,2>{0.569343865f, 0.712679923f},
-std::array<float,2>{0.859058022f, 0.229704842f},
-std::array<float,2>{0.15078181f, 0.898043036f},
-std::array<float,2>{0.104399085f, 0.0877983794f},
-std::array<float,2>{0.87634176f, 0.832182288f},
-std::array<float,2>{0.683678031f, 0.262260407f},
-std::array<float,2>{0.484296024f, 0.574980974f},
-std::array<float,2>{0.193066299f, 0.383021057f},
-std::array<float,2>{0.798937976f, 0.669184864f},
-std::array<float,2>{0.512043715f, 0.160018489f},
-std::array<float,2>{0.318317086f, 0.948789299f},
-std::array<float,2>{0.430010885f, 0.0600364245f},
-std::array<float,2>{0.722602785f, 0.787497938f},
-std::array<float,2>{0.991619229f, 0.33543548f},
-std::array<float,2>{0.0166982133f, 0.548119485f},
-std::array<float,2>{0.254395664f, 0.254412115f},
-std::array<float,2>{0.595434666f, 0.568870664f},
-std::array<float,2>{0.825152814f, 0.0836728588f},
-std::array<float,2>{0.16753304f, 0.84366715f},
-std::array<float,2>{0.0859288201f, 0.223705649f},
-std::array<float,2>{0.919774473f, 0.904213071f},
-std::array<float,2>{0.654419959f, 0.486220121f},
-std::array<float,2>{0.450367182f, 0.703900754f},
-std::array<float,2>{0.0457592197f, 0.362655044f},
-std::array<float,2>{0.962343335f, 0.520619988f},
-std::array<float,2>{0.710058391f, 0.0209623482f},
-std::array<float,2>{0.387615681f, 0.759877145f},
-std::array<float,2>{0.354852766f, 0.13048175f},
-std::array<float,2>{0.557659984f, 0.975200415f},
-std::array<float,2>{0.764076889f, 0.415483057f},
-std::array<float,2>{0.231219321f, 0.64679563f},
-std::array<float,2>{0.47394228f, 0.460608542f},
-std::array<float,2>{0.675245583f, 0.718847513f},
-std::array<float,2>{0.889026284f, 0.195217654f},
-std::array<float,2>{0.0992492959f, 0.906407237f},
-std::array<float,2>{0.143758371f, 0.10995844f},
-std::array<float,2>{0.844787121f, 0.859238386f},
-std::array<float,2>{0.573400676f, 0.286253214f},
-std::array<float,2>{0.307897806f, 0.623866796f},
-std::array<float,2>{0.109680727f, 0.474047303f},
-std::array<float,2>{0.894926071f, 0.700301051f},
-std::array<float,2>{0.671122789f, 0.235792696f},
-std::array<float,2>{0.496319711f, 0.882006109f},
-std::array<float,2>{0.290294558f, 0.0657734275f},
-std::array<float,2>{0.58118546f, 0.813513935f},
-std::array<float,2>{0.861164749f, 0.275683939f},
-std::array<float,2>{0.139341846f, 0.589647233f},
-std::array<float,2>{0.39422825f, 0.315899163f},
-std::array<float,2>{0.697595179f, 0.545638382f},
-std::array<float,2>{0.948896289f, 0.0342865475f},
-std::array<float,2>{0.0504435599f, 0.799879193f},
-std::array<float,2>{0.244186088f, 0.18116045f},
-std::array<float,2>{0.780625761f, 0.959849954f},
-std::array<float,2>{0.538030684f, 0.395619124f},
-std::array<float,2>{0.371600688f, 0.683789074f},
-std::array<float,2>{0.183350131f, 0.304305851f},
-std::array<float,2>{0.830798984f, 0.599834859f},
-std::array<float,2>{0.619871616f, 0.106615841f},
-std::array<float,2>{0.267090946f, 0.868956149f},
-std::array<float,2>{0.454933733f, 0.211314738f},
-std::array<float,2>{0.630276203f, 0.927073121f},
-std::array<float,2>{0.924176693f, 0.448918343f},
-std::array<float,2>{0.0641544238f, 0.741099954f},
-std::array<float,2>{0.332328767f, 0.424119651f},
-std::array<float,2>{0.518969595f, 0.639257431f},
-std::array<float,2>{0.782219529f, 0.145478025f},
-std::array<float,2>{0.205265567f, 0.995048165f},
-std::array<float,2>{0.00633286638f, 0.00217479793f},
-std::array<float,2>{0.977362573f, 0.769765735f},
-std::array<float,2>{0.737514377f, 0.348673701f},
-std::array<float,2>{0.409515291f, 0.515144646f},
-std::array<float,2>{0.237841159f, 0.490678698f},
-std::array<float,2>{0.771571994f, 0.709308684f},
-std::array<float,2>{0.539105654f, 0.220680609f},
-std::array<float,2>{0.36220327f, 0.899080753f},
-std::array<float,2>{0.401610434f, 0.0795757249f},
-std::array<float,2>{0.693782568f, 0.836007655f},
-std::array<float,2>{0.942882597f, 0.250358492f},
-std::array<float,2>{0.0603617579f, 0.564468205f},
-std::array<float,2>{0.286733449f, 0.328956544f},
-std::array<float,2>{0.586227715f, 0.554106116f},
-std::array<float,2>{0.871199787f, 0.0582447574f},
-std::array<float,2>{0.125794828f, 0.783202469f},
-std::array<float,2>{0.120746732f, 0.162035182f},
-std::array<float,2>{0.898795664f, 0.950210035f},
-std::array<float,2>{0.660203159f, 0.38754636f},
-std::array<float,2>{0.490770668f, 0.666142523f},
-std::array<float,2>{0.0103803407f, 0.282004386f},
-std::array<float,2>{0.974728823f, 0.618365943f},
-std::array<float,2>{0.743597567f, 0.115236066f},
-std::array<float,2>{0.42114079f, 0.851810336f},
-std::array<float,2>{0.337749213f, 0.189082623f},
-std::array<float,2>{0.526739419f, 0.914033592f},
-std::array<float,2>{0.789745808f, 0.453766048f},
-std::array<float,2>{0.214951381f, 0.723774672f},
-std::array<float,2>{0.465449572f, 0.419368029f},
-std::array<float,2>{0.634540915f, 0.644359052f},
-std::array<float,2>{0.933317244f, 0.128302425f},
-std::array<float,2>{0.0754500777f, 0.969552815f},
-std::array<float,2>{0.174107984f, 0.0178080462f},
-std::array<float,2>{0.83614707f, 0.764588892f},
-std::array<float,2>{0.615129888f, 0.366347879f},
-std::array<float,2>{0.276521176f, 0.518176436f},
-std::array<float,2>{0.090871796f, 0.391632229f},
-std::array<float,2>{0.906458914f, 0.683378458f},
-std::array<float,2>{0.641247869f, 0.184389561f},
-std::array<float,2>{0.442835748f, 0.953356445f},
-std::array<float,2>{0.263546944f, 0.0357782766f},
-std::array<float,2>{0.603691459f, 0.804530323f},
-std::array<float,2>{0.812528908f, 0.3171435f},
-std::array<float,2>{0.163835153f, 0.542704284f},
-std::array<float,2>{0.427960902f, 0.279923409f},
-std::array<float,2>{0.728760064f, 0.59352535f},
-std::array<float,2>{0.997352958f, 0.0698859319f},
-std::array<float,2>{0.0237186197f, 0.819821835f},
-std::array<float,2>{0.196149915f, 0.239464268f},
-std::array<float,2>{0.809826314f, 0.878123224f},
-std::array<float,2>{0.504259229f, 0.470392197f},
-std::array<float,2>{0.327632368f, 0.695396364f},
-std::array<float,2>{0.153823674f, 0.344525129f},
-std::array<float,2>{0.853437543f, 0.510782301f},
-std::array<float,2>{0.563423276f, 0.00538210478f},
-std::array<float,2>{0.30314517f, 0.768662453f},
-std::array<float,2>{0.478707552f, 0.142535806f},
-std::array<float,2>{0.681202114f, 0.999821723f},
-std::array<float,2>{0.882278204f, 0.427616686f},
-std::array<float,2>{0.108181372f, 0.636605561f},
-std::array<float,2>{0.347266644f, 0.450499386f},
-std::array<float,2>{0.551394224f, 0.738061249f},
-std::array<float,2>{0.75078696f, 0.21624665f},
-std::array<float,2>{0.221519887f, 0.922006965f},
-std::array<float,2>{0.0318606459f, 0.103635535f},
-std::array<float,2>{0.953796327f, 0.873650491f},
-std::array<float,2>{0.71230346f, 0.298391163f},
-std::array<float,2>{0.381725907f, 0.596312582f},
-std::array<float,2>{0.169710234f, 0.430181384f},
-std::array<float,2>{0.820960045f, 0.629696488f},
-std::array<float,2>{0.600229204f, 0.155585572f},
-std::array<float,2>{0.252779633f, 0.984552741f},
-std::array<float,2>{0.447694093f, 0.0118488381f},
-std::array<float,2>{0.650929332f, 0.779759943f},
-std::array<float,2>{0.917873085f, 0.35212329f},
-std::array<float,2>{0.078158617f, 0.50046283f},
-std::array<float,2>{0.316264868f, 0.31091246f},
-std::array<float,2>{0.508176744f, 0.60467869f},
-std::array<float,2>{0.803353965f, 0.100456104f},
-std::array<float,2>{0.188370451f, 0.865802586f},
-std::array<float,2>{0.0210584942f, 0.210787997f},
-std::array<float,2>{0.987795949f, 0.936118424f},
-std::array<float,2>{0.723105609f, 0.442369133f},
-std::array<float,2>{0.436044037f, 0.743289232f},
-std::array<float,2>{0.0954582766f, 0.327136904f},
-std::array<float,2>{0.885555744f, 0.537004113f},
-std::array<float,2>{0.678488493f, 0.0397552438f},
-std::array<float,2>{0.471946865f, 0.805630088f},
-std::array<float,2>{0.308715552f, 0.177481756f},
-std::array<float,2>{0.576976597f, 0.9635337f},
-std::array<float,2>{0.848979533f, 0.399780571f},
-std::array<float,2>{0.144978493f, 0.678451657f},
-std::array<float,2>{0.385032862f, 0.479512781f},
-std::array<float,2>{0.705434442f, 0.692085564f},
-std::array<float,2>{0.966343641f, 0.244827881f},
-std::array<float,2>{0.0405869894f, 0.888639212f},
-std::array<float,2>{0.23040916f, 0.071280241f},
-std::array<float,2>{0.760151207f, 0.824681461f},
-std::array<float,2>{0.56239599f, 0.273361415f},
-std::array<float,2>{0.358052403f, 0.579945385f},
-std::array<float,2>{0.0522554405f, 0.465400398f},
-std::array<float,2>{0.951799989f, 0.728757381f},
-std::array<float,2>{0.700682878f, 0.198145673f},
-std::array<float,2>{0.395326227f, 0.914223671f},
-std::array<float,2>{0.369602054f, 0.118295386f},
-std::array<float,2>{0.532142758f, 0.851206601f},
-std::array<float,2>{0.773748338f, 0.289409846f},
-std::array<float,2>{0.247247919f, 0.615310133f},
-std::array<float,2>{0.495162576f, 0.373983055f},
-std::array<float,2>{0.665374279f, 0.528692663f},
-std::array<float,2>{0.89319998f, 0.025962837f},
-std::array<float,2>{0.116107553f, 0.753329813f},
-std::array<float,2>{0.135388836f, 0.134844393f},
-std::array<float,2>{0.863491356f, 0.978757918f},
-std::array<float,2>{0.582341015f, 0.408997178f},
-std::array<float,2>{0.29640457f, 0.652473271f},
-std::array<float,2>{0.210815117f, 0.261141628f},
-std::array<float,2>{0.788608372f, 0.571210384f},
-std::array<float,2>{0.522692978f, 0.0914271921f},
-std::array<float,2>{0.330984026f, 0.828237474f},
-std::array<float,2>{0.410601377f, 0.232052162f},
-std::array<float,2>{0.741556346f, 0.892659187f},
-std::array<float,2>{0.980812907f, 0.499022007f},
-std::array<float,2>{0.0038723615f, 0.717995822f},
-std::array<float,2>{0.272915781f, 0.379928768f},
-std::array<float,2>{0.62384671f, 0.659218192f},
-std::array<float,2>{0.832814217f, 0.171865687f},
-std::array<float,2>{0.187300161f, 0.941160321f},
-std::array<float,2>{0.0694330558f, 0.0475235134f},
-std::array<float,2>{0.92691946f, 0.794881225f},
-std::array<float,2>{0.6280846f, 0.337802768f},
-std::array<float,2>{0.457727313f, 0.557754993f},
-std::array<float,2>{0.17747654f, 0.484185874f},
-std::array<float,2>{0.842569888f, 0.69023031f},
-std::array<float,2>{0.610881329f, 0.249557674f},
-std::array<float,2>{0.279857516f, 0.883032441f},
-std::array<float,2>{0.464229167f, 0.0759087354f},
-std::array<float,2>{0.639447629f, 0.822395742f},
-std::array<float,2>{0.9371292f, 0.265954554f},
-std::array<float,2>{0.0724603683f, 0.585668683f},
-std::array<float,2>{0.34339124f, 0.322972596f},
-std::array<float,2>{0.530989587f, 0.532055318f},
-std::array<float,2>{0.793414116f, 0.0460841209f},
-std::array<float,2>{0.212294891f, 0.810676157f},
-std::array<float,2>{0.0134496596f, 0.172517553f},
-std::array<float,2>{0.971240938f, 0.964900792f},
-std::array<float,2>{0.746107399f, 0.405724525f},
-std::array<float,2>{0.416432023f, 0.675088882f},
-std::array<float,2>{0.124505483f, 0.304908454f},
-std::array<float,2>{0.903775752f, 0.605803788f},
-std::array<float,2>{0.658455193f, 0.0944665447f},
-std::array<float,2>{0.485377312f, 0.862850845f},
-std::array<float,2>{0.283530533f, 0.205640689f},
-std::array<float,2>{0.590423882f, 0.930997491f},
-std::array<float,2>{0.869325221f, 0.441358835f},
-std::array<float,2>{0.132731259f, 0.749858022f},
-std::array<float,2>{0.404211223f, 0.435975283f},
-std::array<float,2>{0.688289464f, 0.625121415f},
-std::array<float,2>{0.940577984f, 0.151382044f},
-std::array<float,2>{0.0585537441f, 0.989708364f},
-std::array<float,2>{0.239175543f, 0.00814293418f},
-std::array<float,2>{0.767394602f, 0.773743808f},
-std::array<float,2>{0.543526769f, 0.355559111f},
-std::array<float,2>{0.366198212f, 0.505809844f},
-std::array<float,2>{0.0359781906f, 0.375175983f},
-std::array<float,2>{0.958731651f, 0.662157595f},
-std::array<float,2>{0.717949331f, 0.165022016f},
-std::array<float,2>{0.378478944f, 0.941755414f},
-std::array<float,2>{0.348832369f, 0.0528314412f},
-std::array<float,2>{0.550035357f, 0.790547788f},
-std::array<float,2>{0.756637871f, 0.340976357f},
-std::array<float,2>{0.223647803f, 0.558693826f},
-std::array<float,2>{0.481314093f, 0.265423566f},
-std::array<float,2>{0.686810613f, 0.576873362f},
-std::array<float,2>{0.877741218f, 0.0886562094f},
-std::array<float,2>{0.102792047f, 0.835688829f},
-std::array<float,2>{0.14945665f, 0.228321433f},
-std::array<float,2>{0.855532706f, 0.895653248f},
-std::array<float,2>{0.567975998f, 0.495704859f},
-std::array<float,2>{0.299130917f, 0.713012397f},
-std::array<float,2>{0.20059517f, 0.367953271f},
-std::array<float,2>{0.807449281f, 0.526059508f},
-std::array<float,2>{0.502273202f, 0.0297217201f},
-std::array<float,2>{0.321533263f, 0.754872978f},
-std::array<float,2>{0.422662795f, 0.139455616f},
-std::array<float,2>{0.732913196f, 0.981628895f},
-std::array<float,2>{0.995142817f, 0.410710871f},
-std::array<float,2>{0.0311896484f, 0.650781512f},
-std::array<float,2>{0.260457128f, 0.464771837f},
-std::array<float,2>{0.60895592f, 0.73066324f},
-std::array<float,2>{0.818523288f, 0.199256986f},
-std::array<float,2>{0.157782018f, 0.918675542f},
-std::array<float,2>{0.0864915103f, 0.122425452f},
-std::array<float,2>{0.910226405f, 0.845845342f},
-std::array<float,2>{0.646688819f, 0.294129133f},
-std::array<float,2>{0.438049525f, 0.611404717f},
-std::array<float,2>{0.233766198f, 0.417010158f},
-std::array<float,2>{0.763236403f, 0.645671129f},
-std::array<float,2>{0.555078804f, 0.131778643f},
-std::array<float,2>{0.353273243f, 0.974382102f},
-std::array<float,2>{0.389105648f, 0.0231711529f},
-std::array<float,2>{0.707278371f, 0.758194983f},
-std::array<float,2>{0.964267433f, 0.360769719f},
-std::array<float,2>{0.044373177f, 0.522531152f},
-std::array<float,2>{0.306002945f, 0.288491875f},
-std::array<float,2>{0.570666432f, 0.621364176f},
-std::array<float,2>{0.846825957f, 0.111902453f},
-std::array<float,2>{0.140868545f, 0.857323468f},
-std::array<float,2>{0.100334443f, 0.191691414f},
-std::array<float,2>{0.886938512f, 0.908510625f},
-std::array<float,2>{0.672171474f, 0.458706498f},
-std::array<float,2>{0.474624038f, 0.721940458f},
-std::array<float,2>{0.0176607594f, 0.333062261f},
-std::array<float,2>{0.988310933f, 0.549830735f},
-std::array<float,2>{0.719015241f, 0.0618158132f},
-std::array<float,2>{0.432002544f, 0.786126733f},
-std::array<float,2>{0.318429142f, 0.157051608f},
-std::array<float,2>{0.514197767f, 0.946890414f},
-std::array<float,2>{0.798174262f, 0.38611725f},
-std::array<float,2>{0.194166213f, 0.670985639f},
-std::array<float,2>{0.452983499f, 0.487399369f},
-std::array<float,2>{0.65304637f, 0.70619911f},
-std::array<float,2>{0.921490252f, 0.226495251f},
-std::array<float,2>{0.0822676793f, 0.906150222f},
-std::array<float,2>{0.165154591f, 0.0843924507f},
-std::array<float,2>{0.827119112f, 0.840966225f},
-std::array<float,2>{0.595786393f, 0.255896062f},
-std::array<float,2>{0.256973594f, 0.567040324f},
-std::array<float,2>{0.0651367977f, 0.447237492f},
-std::array<float,2>{0.923565209f, 0.738442659f},
-std::array<float,2>{0.631847143f, 0.213752091f},
-std::array<float,2>{0.456034333f, 0.928095341f},
-std::array<float,2>{0.269459933f, 0.108761176f},
-std::array<float,2>{0.619006813f, 0.869914651f},
-std::array<float,2>{0.828931034f, 0.302574694f},
-std::array<float,2>{0.17997016f, 0.599473715f},
-std::array<float,2>{0.407212585f, 0.35010615f},
-std::array<float,2>{0.734852135f, 0.513024747f},
-std::array<float,2>{0.980435252f, 0.00160125759f},
-std::array<float,2>{0.00451782439f, 0.773429751f},
-std::array<float,2>{0.204286546f, 0.147189558f},
-std::array<float,2>{0.7848261f, 0.99303627f},
-std::array<float,2>{0.516662061f, 0.423606068f},
-std::array<float,2>{0.334917426f, 0.637061119f},
-std::array<float,2>{0.138620958f, 0.273596287f},
-std::array<float,2>{0.862854302f, 0.587756217f},
-std::array<float,2>{0.578169763f, 0.0638344139f},
-std::array<float,2>{0.29193452f, 0.814506948f},
-std::array<float,2>{0.498338431f, 0.236757249f},
-std::array<float,2>{0.669022202f, 0.879657388f},
-std::array<float,2>{0.89759177f, 0.47486341f},
-std::array<float,2>{0.113131359f, 0.702127576f},
-std::array<float,2>{0.373079687f, 0.397646278f},
-std::array<float,2>{0.536884844f, 0.686183333f},
-std::array<float,2>{0.777740419f, 0.183027044f},
-std::array<float,2>{0.242211372f, 0.95843029f},
-std::array<float,2>{0.0472585559f, 0.0327858031f},
-std::array<float,2>{0.946703196f, 0.797258556f},
-std::array<float,2>{0.696940005f, 0.31350413f},
-std::array<float,2>{0.391900957f, 0.543283761f},
-std::array<float,2>{0.218391672f, 0.455708742f},
-std::array<float,2>{0.792926013f, 0.725913465f},
-std::array<float,2>{0.523746431f, 0.190016448f},
-std::array<float,2>{0.338160425f, 0.911253631f},
-std::array<float,2>{0.418962181f, 0.115023755f},
-std::array<float,2>{0.745615363f, 0.854366899f},
-std::array<float,2>{0.974420428f, 0.285078019f},
-std::array<float,2>{0.00789515302f, 0.61932385f},
-std::array<float,2>{0.274428755f, 0.363589972f},
-std::array<float,2>{0.616071463f, 0.516888618f},
-std::array<float,2>{0.839390695f, 0.0171546433f},
-std::array<float,2>{0.173383027f, 0.761876643f},
-std::array<float,2>{0.0767868087f, 0.125924245f},
-std::array<float,2>{0.931150556f, 0.970780671f},
-std::array<float,2>{0.635577023f, 0.420491964f},
-std::array<float,2>{0.466837674f, 0.641533434f},
-std::array<float,2>{0.0606110841f, 0.252837926f},
-std::array<float,2>{0.944897115f, 0.56266737f},
-std::array<float,2>{0.693247795f, 0.0813397616f},
-std::array<float,2>{0.400155693f, 0.839253485f},
-std::array<float,2>{0.360652179f, 0.221053123f},
-std::array<float,2>{0.542547345f, 0.900816917f},
-std::array<float,2>{0.771430433f, 0.488343954f},
-std::array<float,2>{0.235239029f, 0.707332671f},
-std::array<float,2>{0.489388376f, 0.388732761f},
-std::array<float,2>{0.662744522f, 0.665491819f},
-std::array<float,2>{0.902160525f, 0.162859336f},
-std::array<float,2>{0.118182674f, 0.951491475f},
-std::array<float,2>{0.128661454f, 0.0555808917f},
-std::array<float,2>{0.874106586f, 0.78461355f},
-std::array<float,2>{0.589056671f, 0.331112772f},
-std::array<float,2>{0.287250936f, 0.552227914f},
-std::array<float,2>{0.107094467f, 0.427922577f},
-std::array<float,2>{0.879693508f, 0.633749604f},
-std::array<float,2>{0.683447838f, 0.143565923f},
-std::array<float,2>{0.477853149f, 0.996537447f},
-std::array<float,2>{0.302503616f, 0.00655336957f},
-std::array<float,2>{0.565937102f, 0.767079473f},
-std::array<float,2>{0.85369575f, 0.346408457f},
-std::array<float,2>{0.156028792f, 0.508072674f},
-std::array<float,2>{0.380333275f, 0.299264997f},
-std::array<float,2>{0.713582337f, 0.594576955f},
-std::array<float,2>{0.956172228f, 0.103077248f},
-std::array<float,2>{0.0339561775f, 0.871253312f},
-std::array<float,2>{0.220089763f, 0.218628421f},
-std::array<float,2>{0.752172172f, 0.92565161f},
-std::array<float,2>{0.553910434f, 0.451531142f},
-std::array<float,2>{0.345195025f, 0.735765696f},
-std::array<float,2>{0.161841318f, 0.318992615f},
-std::array<float,2>{0.816308141f, 0.54004854f},
-std::array<float,2>{0.60209614f, 0.0372220092f},
-std::array<float,2>{0.264539808f, 0.801653743f},
-std::array<float,2>{0.444412321f, 0.18681103f},
-std::array<float,2>{0.64271605f, 0.956054866f},
-std::array<float,2>{0.909573138f, 0.393889278f},
-std::array<float,2>{0.0928640664f, 0.681021035f},
-std::array<float,2>{0.325110167f, 0.471775949f},
-std::array<float,2>{0.506750643f, 0.69818598f},
-std::array<float,2>{0.812493861f, 0.241584614f},
-std::array<float,2>{0.198628217f, 0.876745284f},
-std::array<float,2>{0.0264146309f, 0.0670192316f},
-std::array<float,2>{0.998124063f, 0.818150759f},
-std::array<float,2>{0.727554917f, 0.278850108f},
-std::array<float,2>{0.425796628f, 0.589896381f},
-std::array<float,2>{0.147261739f, 0.400525689f},
-std::array<float,2>{0.850890577f, 0.677410543f},
-std::array<float,2>{0.57430011f, 0.178738013f},
-std::array<float,2>{0.312059313f, 0.96254468f},
-std::array<float,2>{0.470121324f, 0.0421662331f},
-std::array<float,2>{0.676863909f, 0.807031155f},
-std::array<float,2>{0.88426429f, 0.324283838f},
-std::array<float,2>{0.0963978916f, 0.538628817f},
-std::array<float,2>{0.355654985f, 0.270136058f},
-std::array<float,2>{0.558884084f, 0.581502378f},
-std::array<float,2>{0.759102404f, 0.073902458f},
-std::array<float,2>{0.226878896f, 0.82680583f},
-std::array<float,2>{0.0420450419f, 0.242889926f},
-std::array<float,2>{0.96866101f, 0.88953197f},
-std::array<float,2>{0.704448283f, 0.477643818f},
-std::array<float,2>{0.383598685f, 0.695278466f},
-std::array<float,2>{0.0813478529f, 0.355251461f},
-std::array<float,2>{0.914240181f, 0.502229929f},
-std::array<float,2>{0.64960897f, 0.0152364681f},
-std::array<float,2>{0.44655779f, 0.777800322f},
-std::array<float,2>{0.250814408f, 0.153903142f},
-std::array<float,2>{0.597719967f, 0.987145782f},
-std::array<float,2>{0.822757363f, 0.432509422f},
-std::array<float,2>{0.170216486f, 0.632509828f},
-std::array<float,2>{0.434700102f, 0.443834811f},
-std::array<float,2>{0.726433396f, 0.745650172f},
-std::array<float,2>{0.985077441f, 0.208679363f},
-std::array<float,2>{0.0233871061f, 0.934880674f},
-std::array<float,2>{0.189616233f, 0.0987416431f},
-std::array<float,2>{0.802570164f, 0.864545405f},
-std::array<float,2>{0.510889709f, 0.310369849f},
-std::array<float,2>{0.313493222f, 0.603018224f},
-std::array<float,2>{0.00091404689f, 0.497198254f},
-std::array<float,2>{0.983153701f, 0.715659142f},
-std::array<float,2>{0.739923179f, 0.232738301f},
-std::array<float,2>{0.412850142f, 0.892309427f},
-std::array<float,2>{0.330074877f, 0.093583174f},
-std::array<float,2>{0.520996153f, 0.830331862f},
-std::array<float,2>{0.786747575f, 0.259526461f},
-std::array<float,2>{0.207415923f, 0.573266566f},
-std::array<float,2>{0.460870862f, 0.339610308f},
-std::array<float,2>{0.625809908f, 0.554749846f},
-std::array<float,2>{0.92882973f, 0.0495642796f},
-std::array<float,2>{0.0681224465f, 0.795813203f},
-std::array<float,2>{0.184629947f, 0.169342682f},
-std::array<float,2>{0.835026741f, 0.937866628f},
-std::array<float,2>{0.622154355f, 0.382775575f},
-std::array<float,2>{0.27035293f, 0.657612383f},
-std::array<float,2>{0.248558044f, 0.292572528f},
-std::array<float,2>{0.775972605f, 0.615149379f},
-std::array<float,2>{0.53397429f, 0.119346745f},
-std::array<float,2>{0.367474109f, 0.849521041f},
-std::array<float,2>{0.397575796f, 0.195606202f},
-std::array<float,2>{0.703037858f, 0.917366743f},
-std::array<float,2>{0.950181603f, 0.467978805f},
-std::array<float,2>{0.0529745966f, 0.7273283f},
-std::array<float,2>{0.293365449f, 0.407903641f},
-std::array<float,2>{0.584666133f, 0.655312359f},
-std::array<float,2>{0.866793454f, 0.133663863f},
-std::array<float,2>{0.133037314f, 0.978308678f},
-std::array<float,2>{0.114983954f, 0.0250779279f},
-std::array<float,2>{0.891874433f, 0.751802027f},
-std::array<float,2>{0.667775989f, 0.371949852f},
-std::array<float,2>{0.493463904f, 0.530135155f},
-std::array<float,2>{0.157152846f, 0.461163104f},
-std::array<float,2>{0.819498897f, 0.733694434f},
-std::array<float,2>{0.608219326f, 0.201257631f},
-std::array<float,2>{0.260984808f, 0.920719445f},
-std::array<float,2>{0.43894729f, 0.124862678f},
-std::array<float,2>{0.647913873f, 0.843879759f},
-std::array<float,2>{0.911519051f, 0.295091629f},
-std::array<float,2>{0.0878065228f, 0.609395683f},
-std::array<float,2>{0.320575923f, 0.370197147f},
-std::array<float,2>{0.503905118f, 0.524879217f},
-std::array<float,2>{0.807819247f, 0.0281282328f},
-std::array<float,2>{0.199617326f, 0.756332874f},
-std::array<float,2>{0.0297082737f, 0.136907682f},
-std::array<float,2>{0.99494797f, 0.982593715f},
-std::array<float,2>{0.733938158f, 0.412959814f},
-std::array<float,2>{0.42353034f, 0.649250984f},
-std::array<float,2>{0.102494389f, 0.263343424f},
-std::array<float,2>{0.878410101f, 0.575333357f},
-std::array<float,2>{0.685911238f, 0.0861532912f},
-std::array<float,2>{0.48166281f, 0.833656847f},
-std::array<float,2>{0.300013781f, 0.228808552f},
-std::array<float,2>{0.567202151f, 0.896614015f},
-std::array<float,2>{0.856986046f, 0.494005412f},
-std::array<float,2>{0.149118617f, 0.71143496f},
-std::array<float,2>{0.377443641f, 0.37711513f},
-std::array<float,2>{0.717650235f, 0.661036789f},
-std::array<float,2>{0.957253993f, 0.16684787f},
-std::array<float,2>{0.0365908891f, 0.944564223f},
-std::array<float,2>{0.222872555f, 0.0526106581f},
-std::array<float,2>{0.757647395f, 0.792293251f},
-std::array<float,2>{0.549362898f, 0.343356162f},
-std::array<float,2>{0.347935051f, 0.561420798f},
-std::array<float,2>{0.0568618327f, 0.434579432f},
-std::array<float,2>{0.940088928f, 0.627191126f},
-std::array<float,2>{0.689162612f, 0.148944646f},
-std::array<float,2>{0.403257549f, 0.990913033f},
-std::array<float,2>{0.36688754f, 0.0112505807f},
-std::array<float,2>{0.544446945f, 0.776065111f},
-std::array<float,2>{0.766319335f, 0.359012812f},
-std::array<float,2>{0.239722997f, 0.506018341f},
-std::array<float,2>{0.484428823f, 0.307976186f},
-std::array<float,2>{0.65954572f, 0.608054996f},
-std::array<float,2>{0.902449071f, 0.0961986631f},
-std::array<float,2>{0.123924725f, 0.859946251f},
-std::array<float,2>{0.131756917f, 0.20457533f},
-std::array<float,2>{0.870415568f, 0.932767391f},
-std::array<float,2>{0.590950608f, 0.43786782f},
-std::array<float,2>{0.284330606f, 0.747846246f},
-std::array<float,2>{0.211336613f, 0.320594519f},
-std::array<float,2>{0.794641435f, 0.534100413f},
-std::array<float,2>{0.529982746f, 0.0445125327f},
-std::array<float,2>{0.342757165f, 0.809398174f},
-std::array<float,2>{0.417593867f, 0.17397733f},
-std::array<float,2>{0.747341394f, 0.966920733f},
-std::array<float,2>{0.972380579f, 0.402367115f},
-std::array<float,2>{0.0117753362f, 0.673770905f},
-std::array<float,2>{0.280448943f, 0.482165664f},
-std::array<float,2>{0.609748423f, 0.68866384f},
-std::array<float,2>{0.843208015f, 0.24803099f},
-std::array<float,2>{0.176574782f, 0.885217607f},
-std::array<float,2>{0.0740277097f, 0.0766112432f},
-std::array<float,2>{0.936478317f, 0.82121563f},
-std::array<float,2>{0.640533566f, 0.267959207f},
-std::array<float,2>{0.463758826f, 0.583736718f},
-std::array<float,2>{0.24357447f, 0.395340234f},
-std::array<float,2>{0.778716683f, 0.685108483f},
-std::array<float,2>{0.535370588f, 0.180436686f},
-std::array<float,2>{0.374694556f, 0.960821331f},
-std::array<float,2>{0.390879005f, 0.0340586565f},
-std::array<float,2>{0.695443869f, 0.799171865f},
-std::array<float,2>{0.945728183f, 0.314470381f},
-std::array<float,2>{0.0482238345f, 0.546659112f},
-std::array<float,2>{0.292066485f, 0.276999742f},
-std::array<float,2>{0.57923466f, 0.588459134f},
-std::array<float,2>{0.86135745f, 0.06500303f},
-std::array<float,2>{0.137583286f, 0.812845886f},
-std::array<float,2>{0.111898772f, 0.2348198f},
-std::array<float,2>{0.897426307f, 0.881723404f},
-std::array<float,2>{0.66846019f, 0.473577678f},
-std::array<float,2>{0.499287724f, 0.699553728f},
-std::array<float,2>{0.00502393488f, 0.347843766f},
-std::array<float,2>{0.979008853f, 0.513733804f},
-std::array<float,2>{0.735850453f, 0.00377865834f},
-std::array<float,2>{0.40743351f, 0.770771682f},
-std::array<float,2>{0.335302562f, 0.146440685f},
-std::array<float,2>{0.516454518f, 0.99526763f},
-std::array<float,2>{0.783567309f, 0.425317794f},
-std::array<float,2>{0.203363538f, 0.640607953f},
-std::array<float,2>{0.456420392f, 0.447858185f},
-std::array<float,2>{0.631808877f, 0.741337061f},
-std::array<float,2>{0.922241747f, 0.212696388f},
-std::array<float,2>{0.0656247586f, 0.926572621f},
-std::array<float,2>{0.181631699f, 0.106208086f},
-std::array<float,2>{0.829361618f, 0.86806798f},
-std::array<float,2>{0.617840886f, 0.302785605f},
-std::array<float,2>{0.268101692f, 0.601131678f},
-std::array<float,2>{0.0832920894f, 0.484900117f},
-std::array<float,2>{0.920797527f, 0.704491913f},
-std::array<float,2>{0.654112339f, 0.222774848f},
-std::array<float,2>{0.45125863f, 0.902640224f},
-std::array<float,2>{0.256747037f, 0.0823088214f},
-std::array<float,2>{0.59740442f, 0.84205389f},
-std::array<float,2>{0.827237308f, 0.255469471f},
-std::array<float,2>{0.164417565f, 0.56954813f},
-std::array<float,2>{0.432743132f, 0.334560692f},
-std::array<float,2>{0.720610201f, 0.54777658f},
-std::array<float,2>{0.990190983f, 0.0589264333f},
-std::array<float,2>{0.0191100594f, 0.788162947f},
-std::array<float,2>{0.194633067f, 0.158939734f},
-std::array<float,2>{0.797112346f, 0.947520256f},
-std::array<float,2>{0.51481086f, 0.38457191f},
-std::array<float,2>{0.3199386f, 0.668455541f},
-std::array<float,2>{0.142204255f, 0.285293251f},
-std::array<float,2>{0.846478641f, 0.624708891f},
-std::array<float,2>{0.571415007f, 0.110514447f},
-std::array<float,2>{0.30494687f, 0.858085752f},
-std::array<float,2>{0.475927472f, 0.193619311f},
-std::array<float,2>{0.673231483f, 0.90728122f},
-std::array<float,2>{0.888562143f, 0.459232152f},
-std::array<float,2>{0.101284422f, 0.720313549f},
-std::array<float,2>{0.352297306f, 0.414487213f},
-std::array<float,2>{0.556094646f, 0.648408771f},
-std::array<float,2>{0.762182593f, 0.128996506f},
-std::array<float,2>{0.233345419f, 0.975598931f},
-std::array<float,2>{0.043200925f, 0.0201731063f},
-std::array<float,2>{0.963168323f, 0.761656225f},
-std::array<float,2>{0.708565295f, 0.361886829f},
-std::array<float,2>{0.390427619f, 0.520054817f},
-std::array<float,2>{0.197700009f, 0.468798727f},
-std::array<float,2>{0.811100841f, 0.697005391f},
-std::array<float,2>{0.507760048f, 0.238896459f},
-std::array<float,2>{0.325484723f, 0.877338231f},
-std::array<float,2>{0.426773906f, 0.0683691353f},
-std::array<float,2>{0.727096379f, 0.819153547f},
-std::array<float,2>{0.999886215f, 0.280605674f},
-std::array<float,2>{0.0262085069f, 0.592532694f},
-std::array<float,2>{0.265308112f, 0.318241894f},
-std::array<float,2>{0.602545321f, 0.541222274f},
-std::array<float,2>{0.815163553f, 0.0365943983f},
-std::array<float,2>{0.161005914f, 0.803598583f},
-std::array<float,2>{0.092061244f, 0.18526943f},
-std::array<float,2>{0.909041464f, 0.954771042f},
-std::array<float,2>{0.643989205f, 0.391230464f},
-std::array<float,2>{0.444208682f, 0.681781113f},
-std::array<float,2>{0.034509819f, 0.296899885f},
-std::array<float,2>{0.955795586f, 0.596851647f},
-std::array<float,2>{0.714295149f, 0.104516335f},
-std::array<float,2>{0.379840016f, 0.87470603f},
-std::array<float,2>{0.343868464f, 0.215483904f},
-std::array<float,2>{0.552770019f, 0.923502564f},
-std::array<float,2>{0.753750503f, 0.450069159f},
-std::array<float,2>{0.219027862f, 0.736989081f},
-std::array<float,2>{0.477512956f, 0.42641145f},
-std::array<float,2>{0.682034075f, 0.635020018f},
-std::array<float,2>{0.880037725f, 0.141464561f},
-std::array<float,2>{0.105760105f, 0.998766184f},
-std::array<float,2>{0.154493839f, 0.00418165606f},
-std::array<float,2>{0.854535401f, 0.767689884f},
-std::array<float,2>{0.564636707f, 0.345693648f},
-std::array<float,2>{0.301656574f, 0.509977758f},
-std::array<float,2>{0.117856666f, 0.387901366f},
-std::array<float,2>{0.901080668f, 0.66705054f},
-std::array<float,2>{0.663351774f, 0.160920367f},
-std::array<float,2>{0.488659441f, 0.949334025f},
-std::array<float,2>{0.288911939f, 0.0575054102f},
-std::array<float,2>{0.588749528f, 0.781963706f},
-std::array<float,2>{0.873487532f, 0.329948306f},
-std::array<float,2>{0.127342835f, 0.552909374f},
-std::array<float,2>{0.399081767f, 0.251418352f},
-std::array<float,2>{0.692202687f, 0.565881133f},
-std::array<float,2>{0.943462014f, 0.078922525f},
-std::array<float,2>{0.0618765019f, 0.837147295f},
-std::array<float,2>{0.23589243f, 0.218793333f},
-std::array<float,2>{0.769869208f, 0.899699926f},
-std::array<float,2>{0.541758716f, 0.491316199f},
-std::array<float,2>{0.35970822f, 0.710643232f},
-std::array<float,2>{0.172729179f, 0.36550343f},
-std::array<float,2>{0.838056922f, 0.519117892f},
-std::array<float,2>{0.61717093f, 0.0193282813f},
-std::array<float,2>{0.273814917f, 0.76470387f},
-std::array<float,2>{0.468730539f, 0.126980752f},
-std::array<float,2>{0.636612654f, 0.970164478f},
-std::array<float,2>{0.930028439f, 0.417997271f},
-std::array<float,2>{0.0772114843f, 0.643516839f},
-std::array<float,2>{0.339114189f, 0.454333723f},
-std::array<float,2>{0.524464846f, 0.722882867f},
-std::array<float,2>{0.791968703f, 0.188255847f},
-std::array<float,2>{0.216869563f, 0.912997663f},
-std::array<float,2>{0.00935372431f, 0.117074177f},
-std::array<float,2>{0.97292006f, 0.853026867f},
-std::array<float,2>{0.744630456f, 0.283035338f},
-std::array<float,2>{0.418166727f, 0.61720252f},
-std::array<float,2>{0.134147719f, 0.409215212f},
-std::array<float,2>{0.865825593f, 0.654056668f},
-std::array<float,2>{0.585825205f, 0.13616766f},
-std::array<float,2>{0.294419438f, 0.980204284f},
-std::array<float,2>{0.492474407f, 0.0263873432f},
-std::array<float,2>{0.666083097f, 0.752646565f},
-std::array<float,2>{0.891401172f, 0.374321669f},
-std::array<float,2>{0.113554351f, 0.527844965f},
-std::array<float,2>{0.369080573f, 0.290684313f},
-std::array<float,2>{0.534196377f, 0.616711736f},
-std::array<float,2>{0.77651298f, 0.117508329f},
-std::array<float,2>{0.249946296f, 0.84989506f},
-std::array<float,2>{0.0537320785f, 0.198762313f},
-std::array<float,2>{0.950807869f, 0.915919781f},
-std::array<float,2>{0.701768339f, 0.466110587f},
-std::array<float,2>{0.39694342f, 0.729598403f},
-std::array<float,2>{0.0671341121f, 0.336388618f},
-std::array<float,2>{0.928218067f, 0.556677699f},
-std::array<float,2>{0.626869142f, 0.0487127788f},
-std::array<float,2>{0.459808499f, 0.793439209f},
-std::array<float,2>{0.270958334f, 0.170707658f},
-std::array<float,2>{0.621784329f, 0.940061092f},
-std::array<float,2>{0.834931731f, 0.379423022f},
-std::array<float,2>{0.183935016f, 0.658311844f},
-std::array<float,2>{0.413843632f, 0.49910152f},
-std::array<float,2>{0.739115834f, 0.71726048f},
-std::array<float,2>{0.983936787f, 0.231075808f},
-std::array<float,2>{0.00179895607f, 0.894322872f},
-std::array<float,2>{0.208359823f, 0.0902105495f},
-std::array<float,2>{0.785420597f, 0.829401016f},
-std::array<float,2>{0.519938171f, 0.260242105f},
-std::array<float,2>{0.328629524f, 0.571760476f},
-std::array<float,2>{0.022071328f, 0.442487776f},
-std::array<float,2>{0.98563379f, 0.742939949f},
-std::array<float,2>{0.724744022f, 0.209634677f},
-std::array<float,2>{0.43384859f, 0.936614275f},
-std::array<float,2>{0.313049793f, 0.101300649f},
-std::array<float,2>{0.510189235f, 0.867156088f},
-std::array<float,2>{0.800952196f, 0.311863363f},
-std::array<float,2>{0.191406175f, 0.603678703f},
-std::array<float,2>{0.445764303f, 0.353317261f},
-std::array<float,2>{0.649368644f, 0.501773298f},
-std::array<float,2>{0.915508449f, 0.0127662467f},
-std::array<float,2>{0.0802468956f, 0.781153738f},
-std::array<float,2>{0.17130962f, 0.154791757f},
-std::array<float,2>{0.823571265f, 0.986056805f},
-std::array<float,2>{0.599495947f, 0.431353748f},
-std::array<float,2>{0.251413107f, 0.630375922f},
-std::array<float,2>{0.227721021f, 0.27241993f},
-std::array<float,2>{0.758003891f, 0.578577638f},
-std::array<float,2>{0.56019479f, 0.0715252385f},
-std::array<float,2>{0.35741058f, 0.825563908f},
-std::array<float,2>{0.384077311f, 0.246081993f},
-std::array<float,2>{0.703314483f, 0.886927843f},
-std::array<float,2>{0.967091262f, 0.479271382f},
-std::array<float,2>{0.041308701f, 0.69295156f},
-std::array<float,2>{0.310566485f, 0.398599327f},
-std::array<float,2>{0.5757761f, 0.679205418f},
-std::array<float,2>{0.850349188f, 0.17642878f},
-std::array<float,2>{0.148047179f, 0.964339018f},
-std::array<float,2>{0.0971978232f, 0.0403978005f},
-std::array<float,2>{0.883137167f, 0.806224287f},
-std::array<float,2>{0.676059425f, 0.3274979f},
-std::array<float,2>{0.468994051f, 0.535318673f},
-std::array<float,2>{0.151420489f, 0.494240344f},
-std::array<float,2>{0.858039141f, 0.714038014f},
-std::array<float,2>{0.5693084f, 0.226924986f},
-std::array<float,2>{0.298715949f, 0.894738436f},
-std::array<float,2>{0.48293978f, 0.0896402374f},
-std::array<float,2>{0.684680402f, 0.834477246f},
-std::array<float,2>{0.875820518f, 0.263684303f},
-std::array<float,2>{0.105392717f, 0.577774286f},
-std::array<float,2>{0.350584745f, 0.340342194f},
-std::array<float,2>{0.547119379f, 0.559719801f},
-std::array<float,2>{0.754288554f, 0.0538011789f},
-std::array<float,2>{0.225161448f, 0.790038764f},
-std::array<float,2>{0.0388589166f, 0.165769458f},
-std::array<float,2>{0.959184229f, 0.943291903f},
-std::array<float,2>{0.71509856f, 0.376753807f},
-std::array<float,2>{0.376615435f, 0.663871348f},
-std::array<float,2>{0.0893519819f, 0.293906331f},
-std::array<float,2>{0.912948191f, 0.612399578f},
-std::array<float,2>{0.645337582f, 0.121426418f},
-std::array<float,2>{0.439482361f, 0.847631097f},
-std::array<float,2>{0.258642823f, 0.200620919f},
-std::array<float,2>{0.605780005f, 0.919342697f},
-std::array<float,2>{0.817326665f, 0.462998033f},
-std::array<float,2>{0.158983663f, 0.732030034f},
-std::array<float,2>{0.424177885f, 0.411732286f},
-std::array<float,2>{0.73218745f, 0.652279794f},
-std::array<float,2>{0.994107664f, 0.140295222f},
-std::array<float,2>{0.0288837105f, 0.981324255f},
-std::array<float,2>{0.203119904f, 0.0311696157f},
-std::array<float,2>{0.805673063f, 0.754916012f},
-std::array<float,2>{0.501767516f, 0.368795037f},
-std::array<float,2>{0.32334283f, 0.526990294f},
-std::array<float,2>{0.0140106259f, 0.405144632f},
-std::array<float,2>{0.969017148f, 0.674525619f},
-std::array<float,2>{0.749260604f, 0.173055932f},
-std::array<float,2>{0.414294362f, 0.966037393f},
-std::array<float,2>{0.340416342f, 0.0450427495f},
-std::array<float,2>{0.528392613f, 0.812261224f},
-std::array<float,2>{0.795294404f, 0.323476791f},
-std::array<float,2>{0.214676112f, 0.532316685f},
-std::array<float,2>{0.46102038f, 0.266674489f},
-std::array<float,2>{0.637099087f, 0.584567785f},
-std::array<float,2>{0.934187651f, 0.074306123f},
-std::array<float,2>{0.0722579882f, 0.823789537f},
-std::array<float,2>{0.178172052f, 0.248060301f},
-std::array<float,2>{0.84055841f, 0.884230077f},
-std::array<float,2>{0.61156857f, 0.483197689f},
-std::array<float,2>{0.277684867f, 0.690647244f},
-std::array<float,2>{0.240335166f, 0.357322901f},
-std::array<float,2>{0.768050551f, 0.504656076f},
-std::array<float,2>{0.54610765f, 0.00966035761f},
-std::array<float,2>{0.363704175f, 0.774429798f},
-std::array<float,2>{0.40579319f, 0.151214629f},
-std::array<float,2>{0.689902604f, 0.988931775f},
-std::array<float,2>{0.939242661f, 0.437345356f},
-std::array<float,2>{0.0555827506f, 0.62678051f},
-std::array<float,2>{0.282660544f, 0.44014591f},
-std::array<float,2>{0.592557728f, 0.748678148f},
-std::array<float,2>{0.868825316f, 0.206105053f},
-std::array<float,2>{0.130124465f, 0.930117309f},
-std::array<float,2>{0.122432686f, 0.0951397419f},
-std::array<float,2>{0.90482837f, 0.862005949f},
-std::array<float,2>{0.65696764f, 0.305683285f},
-std::array<float,2>{0.487761945f, 0.606794298f},
-std::array<float,2>{0.206130922f, 0.422120601f},
-std::array<float,2>{0.782844484f, 0.637798667f},
-std::array<float,2>{0.518335462f, 0.148233086f},
-std::array<float,2>{0.333218902f, 0.993439496f},
-std::array<float,2>{0.408844799f, 0.000579877291f},
-std::array<float,2>{0.737282217f, 0.772063434f},
-std::array<float,2>{0.977651298f, 0.350790679f},
-std::array<float,2>{0.00721020391f, 0.512021601f},
-std::array<float,2>{0.266598463f, 0.301721215f},
-std::array<float,2>{0.620409012f, 0.597944796f},
-std::array<float,2>{0.831840992f, 0.107544385f},
-std::array<float,2>{0.182154328f, 0.870449007f},
-std::array<float,2>{0.0633160695f, 0.214126781f},
-std::array<float,2>{0.925117135f, 0.929049313f},
-std::array<float,2>{0.629596293f, 0.445435971f},
-std::array<float,2>{0.453761876f, 0.739695251f},
-std::array<float,2>{0.0492917672f, 0.312714547f},
-std::array<float,2>{0.947377682f, 0.543961167f},
-std::array<float,2>{0.698516428f, 0.0313775092f},
-std::array<float,2>{0.393300921f, 0.798636138f},
-std::array<float,2>{0.37218526f, 0.181754887f},
-std::array<float,2>{0.538723588f, 0.957562864f},
-std::array<float,2>{0.779317856f, 0.396909118f},
-std::array<float,2>{0.245163098f, 0.686771333f},
-std::array<float,2>{0.497800201f, 0.476527721f},
-std::array<float,2>{0.670170188f, 0.702403426f},
-std::array<float,2>{0.895605266f, 0.237570748f},
-std::array<float,2>{0.110597424f, 0.879962504f},
-std::array<float,2>{0.140281588f, 0.0625881031f},
-std::array<float,2>{0.859741509f, 0.815721393f},
-std::array<float,2>{0.580175161f, 0.275013059f},
-std::array<float,2>{0.289332092f, 0.586033523f},
-std::array<float,2>{0.0976707637f, 0.457975596f},
-std::array<float,2>{0.889717817f, 0.721039414f},
-std::array<float,2>{0.674262166f, 0.192558631f},
-std::array<float,2>{0.473320097f, 0.909912169f},
-std::array<float,2>{0.306656241f, 0.11297974f},
-std::array<float,2>{0.572504342f, 0.85614866f},
-std::array<float,2>{0.844062388f, 0.288037598f},
-std::array<float,2>{0.143164411f, 0.622318327f},
-std::array<float,2>{0.388433754f, 0.359503359f},
-std::array<float,2>{0.70903939f, 0.522198141f},
-std::array<float,2>{0.961147964f, 0.0220059659f},
-std::array<float,2>{0.046518635f, 0.758960485f},
-std::array<float,2>{0.23223716f, 0.132090539f},
-std::array<float,2>{0.76473254f, 0.973152637f},
-std::array<float,2>{0.557405949f, 0.416780412f},
-std::array<float,2>{0.353596359f, 0.644913435f},
-std::array<float,2>{0.166240245f, 0.256837636f},
-std::array<float,2>{0.825403631f, 0.5680632f},
-std::array<float,2>{0.59394592f, 0.0856772289f},
-std::array<float,2>{0.255465627f, 0.840276301f},
-std::array<float,2>{0.449279606f, 0.225025818f},
-std::array<float,2>{0.655521631f, 0.904685795f},
-std::array<float,2>{0.91876781f, 0.486693382f},
-std::array<float,2>{0.0847770497f, 0.705541193f},
-std::array<float,2>{0.316658944f, 0.385508895f},
-std::array<float,2>{0.513335645f, 0.670075834f},
-std::array<float,2>{0.800399661f, 0.158089653f},
-std::array<float,2>{0.191481143f, 0.945430756f},
-std::array<float,2>{0.0165042058f, 0.0613942817f},
-std::array<float,2>{0.990670145f, 0.786968291f},
-std::array<float,2>{0.721064329f, 0.332492232f},
-std::array<float,2>{0.430878043f, 0.549669683f},
-std::array<float,2>{0.222036451f, 0.452545524f},
-std::array<float,2>{0.751734614f, 0.734988034f},
-std::array<float,2>{0.552129269f, 0.21765022f},
-std::array<float,2>{0.346164405f, 0.924772203f},
-std::array<float,2>{0.38206175f, 0.10196916f},
-std::array<float,2>{0.711906672f, 0.872540772f},
-std::array<float,2>{0.954728007f, 0.300750107f},
-std::array<float,2>{0.0331775285f, 0.595155478f},
-std::array<float,2>{0.304561615f, 0.347024828f},
-std::array<float,2>{0.564198554f, 0.509083152f},
-std::array<float,2>{0.851868451f, 0.00741988979f},
-std::array<float,2>{0.152356818f, 0.766575873f},
-std::array<float,2>{0.108525001f, 0.143521696f},
-std::array<float,2>{0.881151021f, 0.997989774f},
-std::array<float,2>{0.68045336f, 0.429327637f},
-std::array<float,2>{0.479662359f, 0.634035647f},
-std::array<float,2>{0.0247712471f, 0.277585447f},
-std::array<float,2>{0.996353745f, 0.591668904f},
-std::array<float,2>{0.730353475f, 0.0675162151f},
-std::array<float,2>{0.429467857f, 0.817056835f},
-std::array<float,2>{0.326658219f, 0.240417391f},
-std::array<float,2>{0.505225241f, 0.875777721f},
-std::array<float,2>{0.808991909f, 0.471657902f},
-std::array<float,2>{0.196413696f, 0.698790133f},
-std::array<float,2>{0.442024142f, 0.393245459f},
-std::array<float,2>{0.64198792f, 0.679735899f},
-std::array<float,2>{0.907487988f, 0.18643868f},
-std::array<float,2>{0.0900117159f, 0.95582974f},
-std::array<float,2>{0.162251934f, 0.0382377245f},
-std::array<float,2>{0.814412951f, 0.802460015f},
-std::array<float,2>{0.605243206f, 0.319965392f},
-std::array<float,2>{0.262618631f, 0.539240599f},
-std::array<float,2>{0.0745885521f, 0.421448112f},
-std::array<float,2>{0.932584882f, 0.641871512f},
-std::array<float,2>{0.632901371f, 0.126129419f},
-std::array<float,2>{0.466270894f, 0.971967399f},
-std::array<float,2>{0.275906414f, 0.0163396243f},
-std::array<float,2>{0.613734245f, 0.763321519f},
-std::array<float,2>{0.837107301f, 0.364956707f},
-std::array<float,2>{0.175531879f, 0.516001582f},
-std::array<float,2>{0.420520782f, 0.283243567f},
-std::array<float,2>{0.742824614f, 0.620447576f},
-std::array<float,2>{0.976543486f, 0.114248663f},
-std::array<float,2>{0.0111934431f, 0.854838133f},
-std::array<float,2>{0.216790915f, 0.191402122f},
-std::array<float,2>{0.790334761f, 0.910531342f},
-std::array<float,2>{0.525848985f, 0.456468254f},
-std::array<float,2>{0.336421371f, 0.725058734f},
-std::array<float,2>{0.126597002f, 0.330137044f},
-std::array<float,2>{0.872721791f, 0.550884187f},
-std::array<float,2>{0.587439537f, 0.0560526066f},
-std::array<float,2>{0.285950363f, 0.783840418f},
-std::array<float,2>{0.492052972f, 0.163142756f},
-std::array<float,2>{0.661848247f, 0.95280689f},
-std::array<float,2>{0.900097191f, 0.390358895f},
-std::array<float,2>{0.119198196f, 0.664388478f},
-std::array<float,2>{0.362932086f, 0.489264369f},
-std::array<float,2>{0.540418506f, 0.708103299f},
-std::array<float,2>{0.772672296f, 0.221818045f},
-std::array<float,2>{0.236927837f, 0.901768625f},
-std::array<float,2>{0.0589864776f, 0.0801679716f},
-std::array<float,2>{0.942005515f, 0.838750839f},
-std::array<float,2>{0.695157886f, 0.253592789f},
-std::array<float,2>{0.400579095f, 0.563580692f},
-std::array<float,2>{0.186037883f, 0.380955547f},
-std::array<float,2>{0.833872616f, 0.65692848f},
-std::array<float,2>{0.624712765f, 0.168383643f},
-std::array<float,2>{0.27154845f, 0.938959956f},
-std::array<float,2>{0.458398402f, 0.0503647141f},
-std::array<float,2>{0.627170622f, 0.796352386f},
-std::array<float,2>{0.926675558f, 0.338042349f},
-std::array<float,2>{0.0684202984f, 0.556042135f},
-std::array<float,2>{0.331783921f, 0.258431196f},
-std::array<float,2>{0.522003889f, 0.573135316f},
-std::array<float,2>{0.787580669f, 0.0924283639f},
-std::array<float,2>{0.209782392f, 0.831947148f},
-std::array<float,2>{0.00218653772f, 0.234065399f},
-std::array<float,2>{0.981506526f, 0.89067167f},
-std::array<float,2>{0.741125584f, 0.496345699f},
-std::array<float,2>{0.411528051f, 0.716323495f},
-std::array<float,2>{0.116992943f, 0.372619182f},
-std::array<float,2>{0.894468009f, 0.530562401f},
-std::array<float,2>{0.664383769f, 0.0244030766f},
-std::array<float,2>{0.49485594f, 0.75037545f},
-std::array<float,2>{0.295803487f, 0.134445459f},
-std::array<float,2>{0.583497643f, 0.976769328f},
-std::array<float,2>{0.864435494f, 0.406812042f},
-std::array<float,2>{0.13625744f, 0.654782176f},
-std::array<float,2>{0.395591646f, 0.466985077f},
-std::array<float,2>{0.699749708f, 0.727896392f},
-std::array<float,2>{0.952847898f, 0.197060332f},
-std::array<float,2>{0.0516007394f, 0.91649586f},
-std::array<float,2>{0.24628973f, 0.120367795f},
-std::array<float,2>{0.775189757f, 0.847849607f},
-std::array<float,2>{0.533189118f, 0.291942716f},
-std::array<float,2>{0.370944709f, 0.613793731f},
-std::array<float,2>{0.0393677913f, 0.477308631f},
-std::array<float,2>{0.965661407f, 0.694131672f},
-std::array<float,2>{0.706566155f, 0.243805006f},
-std::array<float,2>{0.386687279f, 0.890416205f},
-std::array<float,2>{0.358956516f, 0.0724512711f},
-std::array<float,2>{0.561324179f, 0.827821434f},
-std::array<float,2>{0.761602163f, 0.271176547f},
-std::array<float,2>{0.229362816f, 0.580749512f},
-std::array<float,2>{0.471586138f, 0.325684696f},
-std::array<float,2>{0.679062247f, 0.537304699f},
-std::array<float,2>{0.886501968f, 0.041749537f},
-std::array<float,2>{0.0946726128f, 0.808174431f},
-std::array<float,2>{0.145696685f, 0.178541332f},
-std::array<float,2>{0.847921312f, 0.961434782f},
-std::array<float,2>{0.577550232f, 0.402162403f},
-std::array<float,2>{0.310086638f, 0.676331103f},
-std::array<float,2>{0.188742176f, 0.309174478f},
-std::array<float,2>{0.80433929f, 0.601578772f},
-std::array<float,2>{0.509210169f, 0.0977557078f},
-std::array<float,2>{0.315172493f, 0.863363385f},
-std::array<float,2>{0.436607867f, 0.207548648f},
-std::array<float,2>{0.724559367f, 0.934345782f},
-std::array<float,2>{0.986863673f, 0.445137411f},
-std::array<float,2>{0.02040332f, 0.744538784f},
-std::array<float,2>{0.25381127f, 0.433225602f},
-std::array<float,2>{0.600767612f, 0.631637275f},
-std::array<float,2>{0.822108448f, 0.152728841f},
-std::array<float,2>{0.168073744f, 0.987408102f},
-std::array<float,2>{0.079605341f, 0.0138934907f},
-std::array<float,2>{0.91629231f, 0.778354228f},
-std::array<float,2>{0.652278423f, 0.353601933f},
-std::array<float,2>{0.44883585f, 0.50326699f},
-std::array<float,2>{0.142920539f, 0.459622175f},
-std::array<float,2>{0.8446154f, 0.71985811f},
-std::array<float,2>{0.57308799f, 0.194318429f},
-std::array<float,2>{0.307275414f, 0.907818913f},
-std::array<float,2>{0.472773671f, 0.110948861f},
-std::array<float,2>{0.674331248f, 0.857877076f},
-std::array<float,2>{0.890263319f, 0.285696268f},
-std::array<float,2>{0.0984644666f, 0.624435902f},
-std::array<float,2>{0.354168802f, 0.361811072f},
-std::array<float,2>{0.556975305f, 0.519572914f},
-std::array<float,2>{0.765377104f, 0.0198579151f},
-std::array<float,2>{0.231679201f, 0.761002123f},
-std::array<float,2>{0.046003703f, 0.129752725f},
-std::array<float,2>{0.961732507f, 0.976175845f},
-std::array<float,2>{0.709754348f, 0.414786071f},
-std::array<float,2>{0.388047636f, 0.647540748f},
-std::array<float,2>{0.0843097568f, 0.255167365f},
-std::array<float,2>{0.918433368f, 0.570132434f},
-std::array<float,2>{0.656085074f, 0.082948342f},
-std::array<float,2>{0.449733973f, 0.842472613f},
-std::array<float,2>{0.255083531f, 0.223508671f},
-std::array<float,2>{0.594558239f, 0.903319657f},
-std::array<float,2>{0.825818241f, 0.484524429f},
-std::array<float,2>{0.166788355f, 0.704900205f},
-std::array<float,2>{0.43123883f, 0.384094119f},
-std::array<float,2>{0.721477032f, 0.668562472f},
-std::array<float,2>{0.990746796f, 0.158430666f},
-std::array<float,2>{0.015856741f, 0.947912276f},
-std::array<float,2>{0.192237049f, 0.0594532788f},
-std::array<float,2>{0.799889326f, 0.788801491f},
-std::array<float,2>{0.512798429f, 0.334008098f},
-std::array<float,2>{0.317046553f, 0.546915412f},
-std::array<float,2>{0.00775919855f, 0.424845576f},
-std::array<float,2>{0.978482366f, 0.640034556f},
-std::array<float,2>{0.73663789f, 0.145593584f},
-std::array<float,2>{0.408264309f, 0.995819867f},
-std::array<float,2>{0.33394137f, 0.00305705843f},
-std::array<float,2>{0.517619431f, 0.771080375f},
-std::array<float,2>{0.782406032f, 0.348187506f},
-std::array<float,2>{0.206664741f, 0.514479697f},
-std::array<float,2>{0.453409821f, 0.303432912f},
-std::array<float,2>{0.629012227f, 0.600909114f},
-std::array<float,2>{0.92574805f, 0.105677105f},
-std::array<float,2>{0.0629613549f, 0.867482305f},
-std::array<float,2>{0.181743175f, 0.212304011f},
-std::array<float,2>{0.831326365f, 0.925898135f},
-std::array<float,2>{0.620842338f, 0.44750154f},
-std::array<float,2>{0.265763015f, 0.742113233f},
-std::array<float,2>{0.245618105f, 0.315308809f},
-std::array<float,2>{0.779907167f, 0.546242595f},
-std::array<float,2>{0.538136423f, 0.0336306319f},
-std::array<float,2>{0.372965306f, 0.799344897f},
-std::array<float,2>{0.393013537f, 0.179745942f},
-std::array<float,2>{0.69909817f, 0.960304499f},
-std::array<float,2>{0.948027074f, 0.394970864f},
-std::array<float,2>{0.0494042784f, 0.685005546f},
-std::array<float,2>{0.289866567f, 0.472725987f},
-std::array<float,2>{0.58073467f, 0.699739337f},
-std::array<float,2>{0.860246241f, 0.235299855f},
-std::array<float,2>{0.139724657f, 0.880882859f},
-std::array<float,2>{0.111134924f, 0.0645728782f},
-std::array<float,2>{0.896373808f, 0.813416958f},
-std::array<float,2>{0.670894027f, 0.276645511f},
-std::array<float,2>{0.497555614f, 0.588074386f},
-std::array<float,2>{0.214313075f, 0.403102398f},
-std::array<float,2>{0.795875251f, 0.673228562f},
-std::array<float,2>{0.529268086f, 0.174466535f},
-std::array<float,2>{0.340181947f, 0.967324972f},
-std::array<float,2>{0.414782137f, 0.0444251671f},
-std::array<float,2>{0.749642789f, 0.808910728f},
-std::array<float,2>{0.969282091f, 0.321209788f},
-std::array<float,2>{0.0145148486f, 0.533445299f},
-std::array<float,2>{0.278063834f, 0.268334538f},
-std::array<float,2>{0.611846268f, 0.583105028f},
-std::array<float,2>{0.840310693f, 0.0768560022f},
-std::array<float,2>{0.178376377f, 0.82060349f},
-std::array<float,2>{0.0717629194f, 0.247364596f},
-std::array<float,2>{0.933975339f, 0.88564986f},
-std::array<float,2>{0.637235343f, 0.481881678f},
-std::array<float,2>{0.461611748f, 0.688984632f},
-std::array<float,2>{0.0547498986f, 0.358557642f},
-std::array<float,2>{0.93882221f, 0.506642103f},
-std::array<float,2>{0.689986289f, 0.0110038891f},
-std::array<float,2>{0.405611902f, 0.775767505f},
-std::array<float,2>{0.363790482f, 0.148709878f},
-std::array<float,2>{0.546821952f, 0.990462422f},
-std::array<float,2>{0.768363476f, 0.435449213f},
-std::array<float,2>{0.240929887f, 0.627577722f},
-std::array<float,2>{0.488025308f, 0.438266754f},
-std::array<float,2>{0.656613469f, 0.7473948f},
-std::array<float,2>{0.904366493f, 0.204916537f},
-std::array<float,2>{0.122844324f, 0.93349123f},
-std::array<float,2>{0.13041541f, 0.0960623026f},
-std::array<float,2>{0.868380547f, 0.85947758f},
-std::array<float,2>{0.592197895f, 0.308300227f},
-std::array<float,2>{0.283179015f, 0.607699931f},
-std::array<float,2>{0.104581751f, 0.493214756f},
-std::array<float,2>{0.875038147f, 0.711321056f},
-std::array<float,2>{0.685157537f, 0.229354665f},
-std::array<float,2>{0.482785583f, 0.897247553f},
-std::array<float,2>{0.298095405f, 0.086634703f},
-std::array<float,2>{0.568619192f, 0.833138764f},
-std::array<float,2>{0.857686818f, 0.26303941f},
-std::array<float,2>{0.151999399f, 0.575981796f},
-std::array<float,2>{0.375979424f, 0.342926979f},
-std::array<float,2>{0.715530097f, 0.560785949f},
-std::array<float,2>{0.959797561f, 0.0518090948f},
-std::array<float,2>{0.0382378697f, 0.792532682f},
-std::array<float,2>{0.224805355f, 0.16611284f},
-std::array<float,2>{0.754864097f, 0.944876373f},
-std::array<float,2>{0.547458529f, 0.377617717f},
-std::array<float,2>{0.349910557f, 0.66043961f},
-std::array<float,2>{0.158251911f, 0.2958197f},
-std::array<float,2>{0.816593707f, 0.610168934f},
-std::array<float,2>{0.606051087f, 0.124317572f},
-std::array<float,2>{0.257872671f, 0.844404936f},
-std::array<float,2>{0.440077424f, 0.202104166f},
-std::array<float,2>{0.644887865f, 0.919980407f},
-std::array<float,2>{0.912124097f, 0.461902022f},
-std::array<float,2>{0.0897293538f, 0.734289587f},
-std::array<float,2>{0.324028194f, 0.412130266f},
-std::array<float,2>{0.501189828f, 0.648903549f},
-std::array<float,2>{0.806525886f, 0.137401715f},
-std::array<float,2>{0.202332824f, 0.983163238f},
-std::array<float,2>{0.0284043849f, 0.027669495f},
-std::array<float,2>{0.993540645f, 0.756722689f},
-std::array<float,2>{0.731603444f, 0.370703757f},
-std::array<float,2>{0.424318612f, 0.525284231f},
-std::array<float,2>{0.228576958f, 0.478990346f},
-std::array<float,2>{0.761011362f, 0.692730904f},
-std::array<float,2>{0.56079632f, 0.245500132f},
-std::array<float,2>{0.358680874f, 0.887232959f},
-std::array<float,2>{0.386187106f, 0.0721815899f},
-std::array<float,2>{0.706239462f, 0.825785756f},
-std::array<float,2>{0.964912534f, 0.27164799f},
-std::array<float,2>{0.0398622267f, 0.57878387f},
-std::array<float,2>{0.309803694f, 0.32780683f},
-std::array<float,2>{0.577736795f, 0.536095083f},
-std::array<float,2>{0.84843719f, 0.0408317707f},
-std::array<float,2>{0.146375373f, 0.805664539f},
-std::array<float,2>{0.0940004513f, 0.176201433f},
-std::array<float,2>{0.886147678f, 0.964357138f},
-std::array<float,2>{0.67934221f, 0.399065495f},
-std::array<float,2>{0.470715493f, 0.679121375f},
-std::array<float,2>{0.0199860409f, 0.312106431f},
-std::array<float,2>{0.986379206f, 0.604127526f},
-std::array<float,2>{0.72388041f, 0.101008527f},
-std::array<float,2>{0.437415302f, 0.8665452f},
-std::array<float,2>{0.314504266f, 0.209450975f},
-std::array<float,2>{0.509374261f, 0.937464356f},
-std::array<float,2>{0.803981364f, 0.443217844f},
-std::array<float,2>{0.189363614f, 0.742667913f},
-std::array<float,2>{0.448458999f, 0.431029111f},
-std::array<float,2>{0.651389658f, 0.629892647f},
-std::array<float,2>{0.916745543f, 0.154530719f},
-std::array<float,2>{0.0792440549f, 0.985523582f},
-std::array<float,2>{0.168520674f, 0.0136374403f},
-std::array<float,2>{0.821494758f, 0.780371785f},
-std::array<float,2>{0.601526976f, 0.352570176f},
-std::array<float,2>{0.253125489f, 0.501367629f},
-std::array<float,2>{0.0688646361f, 0.378929347f},
-std::array<float,2>{0.926140845f, 0.65898025f},
-std::array<float,2>{0.627641499f, 0.170108944f},
-std::array<float,2>{0.458891302f, 0.939526975f},
-std::array<float,2>{0.271977931f, 0.0479693115f},
-std::array<float,2>{0.624158204f, 0.793484569f},
-std::array<float,2>{0.833349109f, 0.336568713f},
-std::array<float,2>{0.185962737f, 0.557424545f},
-std::array<float,2>{0.411803633f, 0.260724068f},
-std::array<float,2>{0.740612686f, 0.572174251f},
-std::array<float,2>{0.981938541f, 0.0907683596f},
-std::array<float,2>{0.0026434795f, 0.829827905f},
-std::array<float,2>{0.209036335f, 0.230906174f},
-std::array<float,2>{0.787825882f, 0.893756032f},
-std::array<float,2>{0.52195406f, 0.499827832f},
-std::array<float,2>{0.331217349f, 0.717309773f},
-std::array<float,2>{0.136191159f, 0.374617428f},
-std::array<float,2>{0.864866555f, 0.527612686f},
-std::array<float,2>{0.583248377f, 0.0269816741f},
-std::array<float,2>{0.295381516f, 0.752418458f},
-std::array<float,2>{0.494204968f, 0.136385754f},
-std::array<float,2>{0.665035903f, 0.979814827f},
-std::array<float,2>{0.89396441f, 0.409779549f},
-std::array<float,2>{0.116593495f, 0.653560817f},
-std::array<float,2>{0.370371461f, 0.466479719f},
-std::array<float,2>{0.53260529f, 0.730294585f},
-std::array<float,2>{0.774499774f, 0.198710427f},
-std::array<float,2>{0.247047812f, 0.915080011f},
-std::array<float,2>{0.0510895364f, 0.118077852f},
-std::array<float,2>{0.952543557f, 0.850223839f},
-std::array<float,2>{0.699591041f, 0.290478379f},
-std::array<float,2>{0.396457374f, 0.616635621f},
-std::array<float,2>{0.174868107f, 0.418695778f},
-std::array<float,2>{0.837734044f, 0.643066347f},
-std::array<float,2>{0.614171445f, 0.127908796f},
-std::array<float,2>{0.275864661f, 0.970655084f},
-std::array<float,2>{0.466363251f, 0.018996194f},
-std::array<float,2>{0.633539557f, 0.765169382f},
-std::array<float,2>{0.931794524f, 0.365901679f},
-std::array<float,2>{0.0751428679f, 0.518911242f},
-std::array<float,2>{0.336782128f, 0.282664329f},
-std::array<float,2>{0.525894403f, 0.617857218f},
-std::array<float,2>{0.790673733f, 0.116430365f},
-std::array<float,2>{0.216070727f, 0.853123188f},
-std::array<float,2>{0.0113000749f, 0.187758982f},
-std::array<float,2>{0.975966513f, 0.912422299f},
-std::array<float,2>{0.742218554f, 0.454703569f},
-std::array<float,2>{0.420154184f, 0.723475039f},
-std::array<float,2>{0.119650453f, 0.329585105f},
-std::array<float,2>{0.899762213f, 0.553591251f},
-std::array<float,2>{0.661617279f, 0.0570100695f},
-std::array<float,2>{0.49150157f, 0.78142786f},
-std::array<float,2>{0.285308599f, 0.160256013f},
-std::array<float,2>{0.58704555f, 0.949833214f},
-std::array<float,2>{0.872270048f, 0.388624847f},
-std::array<float,2>{0.126412645f, 0.667886555f},
-std::array<float,2>{0.401024491f, 0.491908461f},
-std::array<float,2>{0.694549084f, 0.709962904f},
-std::array<float,2>{0.941654086f, 0.219680488f},
-std::array<float,2>{0.0592885688f, 0.900314152f},
-std::array<float,2>{0.236755833f, 0.0785160214f},
-std::array<float,2>{0.773220837f, 0.837575376f},
-std::array<float,2>{0.540683389f, 0.251609921f},
-std::array<float,2>{0.362496197f, 0.566328168f},
-std::array<float,2>{0.0325149782f, 0.449665546f},
-std::array<float,2>{0.954227865f, 0.736505926f},
-std::array<float,2>{0.711229026f, 0.215019271f},
-std::array<float,2>{0.382436097f, 0.923095167f},
-std::array<float,2>{0.346272618f, 0.105069682f},
-std::array<float,2>{0.552558959f, 0.874401689f},
-std::array<float,2>{0.751092136f, 0.297575474f},
-std::array<float,2>{0.22224915f, 0.597195804f},
-std::array<float,2>{0.480137914f, 0.345157772f},
-std::array<float,2>{0.679976344f, 0.510426044f},
-std::array<float,2>{0.881370008f, 0.00458083441f},
-std::array<float,2>{0.109275654f, 0.768067777f},
-std::array<float,2>{0.152949229f, 0.141013131f},
-std::array<float,2>{0.852149725f, 0.99842751f},
-std::array<float,2>{0.563620985f, 0.426239669f},
-std::array<float,2>{0.303942233f, 0.635421872f},
-std::array<float,2>{0.197221503f, 0.281216532f},
-std::array<float,2>{0.809164047f, 0.592175603f},
-std::array<float,2>{0.505846858f, 0.0693098903f},
-std::array<float,2>{0.326760709f, 0.81845963f},
-std::array<float,2>{0.429052323f, 0.238374844f},
-std::array<float,2>{0.729867041f, 0.877656937f},
-std::array<float,2>{0.996717989f, 0.469639033f},
-std::array<float,2>{0.0251564216f, 0.696733654f},
-std::array<float,2>{0.262150675f, 0.390685678f},
-std::array<float,2>{0.604730546f, 0.682223439f},
-std::array<float,2>{0.813905716f, 0.185050189f},
-std::array<float,2>{0.162768528f, 0.954242647f},
-std::array<float,2>{0.0908142775f, 0.0368846096f},
-std::array<float,2>{0.907879055f, 0.803003311f},
-std::array<float,2>{0.642147899f, 0.317484409f},
-std::array<float,2>{0.441573739f, 0.541535139f},
-std::array<float,2>{0.164783746f, 0.487147599f},
-std::array<float,2>{0.827737808f, 0.705808818f},
-std::array<float,2>{0.597122431f, 0.225397274f},
-std::array<float,2>{0.256122082f, 0.905235171f},
-std::array<float,2>{0.451963902f, 0.0853548646f},
-std::array<float,2>{0.653567493f, 0.840684354f},
-std::array<float,2>{0.92000562f, 0.257416099f},
-std::array<float,2>{0.0835986137f, 0.567802846f},
-std::array<float,2>{0.319814444f, 0.332555503f},
-std::array<float,2>{0.515505135f, 0.548912585f},
-std::array<float,2>{0.797487497f, 0.0609366968f},
-std::array<float,2>{0.194898114f, 0.786289573f},
-std::array<float,2>{0.0186399724f, 0.157327652f},
-std::array<float,2>{0.989707351f, 0.946146846f},
-std::array<float,2>{0.720012426f, 0.384932846f},
-std::array<float,2>{0.43342036f, 0.670610249f},
-std::array<float,2>{0.101072751f, 0.287555873f},
-std::array<float,2>{0.888092697f, 0.622972488f},
-std::array<float,2>{0.673799694f, 0.112552747f},
-std::array<float,2>{0.476434946f, 0.855662584f},
-std::array<float,2>{0.305190116f, 0.193102971f},
-std::array<float,2>{0.571990967f, 0.909443676f},
-std::array<float,2>{0.845997214f, 0.45748058f},
-std::array<float,2>{0.141749799f, 0.721518815f},
-std::array<float,2>{0.39013344f, 0.416462749f},
-std::array<float,2>{0.708203435f, 0.645488679f},
-std::array<float,2>{0.963718951f, 0.132568106f},
-std::array<float,2>{0.0436883382f, 0.972912908f},
-std::array<float,2>{0.232664853f, 0.0219001807f},
-std::array<float,2>{0.762424767f, 0.759495199f},
-std::array<float,2>{0.556182981f, 0.360002697f},
-std::array<float,2>{0.351805896f, 0.521956205f},
-std::array<float,2>{0.048525054f, 0.397312075f},
-std::array<float,2>{0.946036637f, 0.68729645f},
-std::array<float,2>{0.696000874f, 0.182376668f},
-std::array<float,2>{0.391494572f, 0.957360983f},
-std::array<float,2>{0.374416977f, 0.031870719f},
-std::array<float,2>{0.535823882f, 0.798307478f},
-std::array<float,2>{0.779174328f, 0.313076794f},
-std::array<float,2>{0.243783787f, 0.544882774f},
-std::array<float,2>{0.499859065f, 0.274480611f},
-std::array<float,2>{0.667974651f, 0.586783588f},
-std::array<float,2>{0.896716654f, 0.0632377565f},
-std::array<float,2>{0.111766078f, 0.815940976f},
-std::array<float,2>{0.137167886f, 0.237963036f},
-std::array<float,2>{0.862025976f, 0.880636334f},
-std::array<float,2>{0.579746187f, 0.475742519f},
-std::array<float,2>{0.292773664f, 0.703029513f},
-std::array<float,2>{0.203820378f, 0.351160198f},
-std::array<float,2>{0.783967495f, 0.512562931f},
-std::array<float,2>{0.51586014f, 0.000448851613f},
-std::array<float,2>{0.335466743f, 0.771743596f},
-std::array<float,2>{0.407738715f, 0.147843122f},
-std::array<float,2>{0.735616565f, 0.993705571f},
-std::array<float,2>{0.978733182f, 0.422456652f},
-std::array<float,2>{0.00561419781f, 0.638442993f},
-std::array<float,2>{0.26795885f, 0.445970178f},
-std::array<float,2>{0.617562115f, 0.739870608f},
-std::array<float,2>{0.829873025f, 0.214608818f},
-std::array<float,2>{0.180935115f, 0.929366529f},
-std::array<float,2>{0.0662072301f, 0.108204685f},
-std::array<float,2>{0.922486365f, 0.870961487f},
-std::array<float,2>{0.630986631f, 0.301140487f},
-std::array<float,2>{0.456795484f, 0.598386765f},
-std::array<float,2>{0.240216464f, 0.436739117f},
-std::array<float,2>{0.765984118f, 0.626147687f},
-std::array<float,2>{0.544306099f, 0.150513962f},
-std::array<float,2>{0.366493523f, 0.988396525f},
-std::array<float,2>{0.40250662f, 0.00903941505f},
-std::array<float,2>{0.688850224f, 0.775315225f},
-std::array<float,2>{0.939525306f, 0.356636643f},
-std::array<float,2>{0.0573030226f, 0.504297018f},
-std::array<float,2>{0.28475222f, 0.306592256f},
-std::array<float,2>{0.591365278f, 0.607208431f},
-std::array<float,2>{0.870821416f, 0.0952885598f},
-std::array<float,2>{0.131127328f, 0.861532927f},
-std::array<float,2>{0.12353123f, 0.206753567f},
-std::array<float,2>{0.903143525f, 0.930623055f},
-std::array<float,2>{0.659911036f, 0.439650655f},
-std::array<float,2>{0.485066712f, 0.748257399f},
-std::array<float,2>{0.0123272417f, 0.3240951f},
-std::array<float,2>{0.971794546f, 0.532945573f},
-std::array<float,2>{0.747745097f, 0.0457757413f},
-std::array<float,2>{0.417339444f, 0.812001824f},
-std::array<float,2>{0.341829807f, 0.17342332f},
-std::array<float,2>{0.529298663f, 0.966693223f},
-std::array<float,2>{0.794070065f, 0.404611617f},
-std::array<float,2>{0.21153675f, 0.674204588f},
-std::array<float,2>{0.462981224f, 0.482598037f},
-std::array<float,2>{0.640001774f, 0.691168964f},
-std::array<float,2>{0.935949683f, 0.248605415f},
-std::array<float,2>{0.0737007484f, 0.8846035f},
-std::array<float,2>{0.175919279f, 0.0750016719f},
-std::array<float,2>{0.843645811f, 0.823583484f},
-std::array<float,2>{0.610069692f, 0.267379224f},
-std::array<float,2>{0.280805469f, 0.584409893f},
-std::array<float,2>{0.0872279629f, 0.463836074f},
-std::array<float,2>{0.911639512f, 0.731578708f},
-std::array<float,2>{0.648101032f, 0.200762346f},
-std::array<float,2>{0.439354032f, 0.919815898f},
-std::array<float,2>{0.261693984f, 0.121885657f},
-std::array<float,2>{0.607890904f, 0.846926272f},
-std::array<float,2>{0.820075691f, 0.293180615f},
-std::array<float,2>{0.156459168f, 0.613266587f},
-std::array<float,2>{0.423044384f, 0.368386209f},
-std::array<float,2>{0.733704984f, 0.526461303f},
-std::array<float,2>{0.994512081f, 0.0304320324f},
-std::array<float,2>{0.0301339496f, 0.755679369f},
-std::array<float,2>{0.199980333f, 0.139989138f},
-std::array<float,2>{0.808128178f, 0.980907857f},
-std::array<float,2>{0.503004193f, 0.411448926f},
-std::array<float,2>{0.321132481f, 0.651608348f},
-std::array<float,2>{0.14881368f, 0.264314383f},
-std::array<float,2>{0.856565654f, 0.577600181f},
-std::array<float,2>{0.56647402f, 0.0890566111f},
-std::array<float,2>{0.300659388f, 0.834047914f},
-std::array<float,2>{0.482293785f, 0.227200851f},
-std::array<float,2>{0.686439037f, 0.895195425f},
-std::array<float,2>{0.878601968f, 0.494806409f},
-std::array<float,2>{0.101644516f, 0.714536965f},
-std::array<float,2>{0.348180115f, 0.376233816f},
-std::array<float,2>{0.549309969f, 0.663143754f},
-std::array<float,2>{0.756889462f, 0.165230975f},
-std::array<float,2>{0.223282963f, 0.942619801f},
-std::array<float,2>{0.0368491672f, 0.054252252f},
-std::array<float,2>{0.957956314f, 0.789272845f},
-std::array<float,2>{0.716971755f, 0.340262562f},
-std::array<float,2>{0.377015471f, 0.560531735f},
-std::array<float,2>{0.190662429f, 0.444497585f},
-std::array<float,2>{0.801445782f, 0.744835913f},
-std::array<float,2>{0.510656118f, 0.207148537f},
-std::array<float,2>{0.312903076f, 0.934024334f},
-std::array<float,2>{0.434464395f, 0.09834297f},
-std::array<float,2>{0.725528419f, 0.864132226f},
-std::array<float,2>{0.985855162f, 0.308961898f},
-std::array<float,2>{0.0215896443f, 0.602167308f},
-std::array<float,2>{0.251522779f, 0.354112148f},
-std::array<float,2>{0.599045873f, 0.503894031f},
-std::array<float,2>{0.823778212f, 0.014301084f},
-std::array<float,2>{0.171859354f, 0.779148877f},
-std::array<float,2>{0.0808699206f, 0.153045043f},
-std::array<float,2>{0.915947855f, 0.987957239f},
-std::array<float,2>{0.648598135f, 0.432728112f},
-std::array<float,2>{0.446151674f, 0.631199479f},
-std::array<float,2>{0.0416741297f, 0.270707786f},
-std::array<float,2>{0.967711866f, 0.580162942f},
-std::array<float,2>{0.703747034f, 0.0728687644f},
-std::array<float,2>{0.384295762f, 0.827156603f},
-std::array<float,2>{0.356642604f, 0.243455827f},
-std::array<float,2>{0.559677839f, 0.889917374f},
-std::array<float,2>{0.758758843f, 0.476806551f},
-std::array<float,2>{0.228482053f, 0.693398714f},
-std::array<float,2>{0.469651163f, 0.401812971f},
-std::array<float,2>{0.67627877f, 0.67582643f},
-std::array<float,2>{0.883434296f, 0.177787811f},
-std::array<float,2>{0.0968098864f, 0.96115011f},
-std::array<float,2>{0.147782788f, 0.0411208831f},
-std::array<float,2>{0.849831998f, 0.808103442f},
-std::array<float,2>{0.575215399f, 0.325263232f},
-std::array<float,2>{0.311403662f, 0.537887633f},
-std::array<float,2>{0.113946579f, 0.406568497f},
-std::array<float,2>{0.890974581f, 0.655245781f},
-std::array<float,2>{0.666952193f, 0.13409932f},
-std::array<float,2>{0.493118554f, 0.977212012f},
-std::array<float,2>{0.294887215f, 0.0236123428f},
-std::array<float,2>{0.585356832f, 0.750653386f},
-std::array<float,2>{0.865664661f, 0.372461468f},
-std::array<float,2>{0.134570256f, 0.531175554f},
-std::array<float,2>{0.397300839f, 0.291261792f},
-std::array<float,2>{0.701638937f, 0.613516808f},
-std::array<float,2>{0.950341642f, 0.120723143f},
-std::array<float,2>{0.0544820465f, 0.848505139f},
-std::array<float,2>{0.249226436f, 0.196471483f},
-std::array<float,2>{0.777343512f, 0.916815162f},
-std::array<float,2>{0.534744143f, 0.467352748f},
-std::array<float,2>{0.368337303f, 0.728379369f},
-std::array<float,2>{0.184512481f, 0.338542134f},
-std::array<float,2>{0.834001243f, 0.556517839f},
-std::array<float,2>{0.621248126f, 0.0502234586f},
-std::array<float,2>{0.271093279f, 0.796686888f},
-std::array<float,2>{0.459217757f, 0.168919131f},
-std::array<float,2>{0.626384616f, 0.939151227f},
-std::array<float,2>{0.928624392f, 0.381426245f},
-std::array<float,2>{0.0667553172f, 0.656726062f},
-std::array<float,2>{0.328276753f, 0.496843159f},
-std::array<float,2>{0.52003783f, 0.715944231f},
-std::array<float,2>{0.785790145f, 0.233518943f},
-std::array<float,2>{0.208766431f, 0.891367495f},
-std::array<float,2>{0.00107668107f, 0.092068769f},
-std::array<float,2>{0.983675301f, 0.831291378f},
-std::array<float,2>{0.738450944f, 0.258232027f},
-std::array<float,2>{0.413375199f, 0.572364032f},
-std::array<float,2>{0.127920955f, 0.389816999f},
-std::array<float,2>{0.873975575f, 0.664825499f},
-std::array<float,2>{0.58796823f, 0.164007366f},
-std::array<float,2>{0.288303524f, 0.952259839f},
-std::array<float,2>{0.488945127f, 0.0562377349f},
-std::array<float,2>{0.664007902f, 0.783329308f},
-std::array<float,2>{0.900809944f, 0.330819547f},
-std::array<float,2>{0.117294721f, 0.55129689f},
-std::array<float,2>{0.360061139f, 0.253024548f},
-std::array<float,2>{0.541283607f, 0.56415385f},
-std::array<float,2>{0.770227909f, 0.0807907581f},
-std::array<float,2>{0.235761434f, 0.838092089f},
-std::array<float,2>{0.0622136369f, 0.222506642f},
-std::array<float,2>{0.944127262f, 0.902296424f},
-std::array<float,2>{0.691876173f, 0.489961118f},
-std::array<float,2>{0.398586392f, 0.708671033f},
-std::array<float,2>{0.0780350491f, 0.364373565f},
-std::array<float,2>{0.930634141f, 0.516490519f},
-std::array<float,2>{0.636212587f, 0.0158324596f},
-std::array<float,2>{0.468190193f, 0.762817502f},
-std::array<float,2>{0.2741597f, 0.126676857f},
-std::array<float,2>{0.616518021f, 0.972236872f},
-std::array<float,2>{0.838608623f, 0.421090096f},
-std::array<float,2>{0.172192782f, 0.642147243f},
-std::array<float,2>{0.418639421f, 0.45664084f},
-std::array<float,2>{0.744263053f, 0.725133121f},
-std::array<float,2>{0.973308265f, 0.19046104f},
-std::array<float,2>{0.00921853073f, 0.910701931f},
-std::array<float,2>{0.217405617f, 0.113343693f},
-std::array<float,2>{0.791342676f, 0.855047166f},
-std::array<float,2>{0.52525568f, 0.283908278f},
-std::array<float,2>{0.339548469f, 0.620810807f},
-std::array<float,2>{0.0255767182f, 0.471035808f},
-std::array<float,2>{0.999236107f, 0.698579311f},
-std::array<float,2>{0.726943076f, 0.240877286f},
-std::array<float,2>{0.427299798f, 0.875282407f},
-std::array<float,2>{0.325724781f, 0.0679347739f},
-std::array<float,2>{0.50722599f, 0.816670775f},
-std::array<float,2>{0.810863376f, 0.27788341f},
-std::array<float,2>{0.198232159f, 0.590910852f},
-std::array<float,2>{0.443530232f, 0.319489092f},
-std::array<float,2>{0.644108057f, 0.53990221f},
-std::array<float,2>{0.908664882f, 0.0386671387f},
-std::array<float,2>{0.0924935862f, 0.801821351f},
-std::array<float,2>{0.16021055f, 0.185702801f},
-std::array<float,2>{0.814779162f, 0.955293953f},
-std::array<float,2>{0.603297353f, 0.392848641f},
-std::array<float,2>{0.265033901f, 0.680634975f},
-std::array<float,2>{0.219359413f, 0.300055057f},
-std::array<float,2>{0.753039002f, 0.595241904f},
-std::array<float,2>{0.553374708f, 0.102180302f},
-std::array<float,2>{0.344355166f, 0.872880816f},
-std::array<float,2>{0.378981262f, 0.217111185f},
-std::array<float,2>{0.714803159f, 0.923967957f},
-std::array<float,2>{0.955257952f, 0.452637672f},
-std::array<float,2>{0.0348676555f, 0.73449862f},
-std::array<float,2>{0.300812095f, 0.428806573f},
-std::array<float,2>{0.565187931f, 0.634676337f},
-std::array<float,2>{0.855071843f, 0.143007576f},
-std::array<float,2>{0.154797554f, 0.997323394f},
-std::array<float,2>{0.10599532f, 0.00716239633f},
-std::array<float,2>{0.880493462f, 0.765897095f},
-std::array<float,2>{0.682476401f, 0.347278744f},
-std::array<float,2>{0.476990223f, 0.509317696f},
-std::array<float,2>{0.180615202f, 0.448634565f},
-std::array<float,2>{0.828389049f, 0.740394652f},
-std::array<float,2>{0.618479848f, 0.211702555f},
-std::array<float,2>{0.268939137f, 0.927455246f},
-std::array<float,2>{0.455133438f, 0.107004896f},
-std::array<float,2>{0.632344842f, 0.868227243f},
-std::array<float,2>{0.92312324f, 0.303720742f},
-std::array<float,2>{0.0649240911f, 0.600560009f},
-std::array<float,2>{0.334396273f, 0.349380642f},
-std::array<float,2>{0.517342091f, 0.515049577f},
-std::array<float,2>{0.784542263f, 0.00269710389f},
-std::array<float,2>{0.204727679f, 0.770470083f},
-std::array<float,2>{0.00412464328f, 0.144571528f},
-std::array<float,2>{0.97969538f, 0.994618893f},
-std::array<float,2>{0.735188365f, 0.424776107f},
-std::array<float,2>{0.40645504f, 0.638991535f},
-std::array<float,2>{0.112583347f, 0.275898814f},
-std::array<float,2>{0.898306489f, 0.588991046f},
-std::array<float,2>{0.669487774f, 0.0663659424f},
-std::array<float,2>{0.498858154f, 0.814125419f},
-std::array<float,2>{0.29135862f, 0.236295119f},
-std::array<float,2>{0.578688085f, 0.882482469f},
-std::array<float,2>{0.862711608f, 0.474332958f},
-std::array<float,2>{0.137854755f, 0.701023817f},
-std::array<float,2>{0.392106563f, 0.396114975f},
-std::array<float,2>{0.696627378f, 0.684326887f},
-std::array<float,2>{0.946927845f, 0.181057766f},
-std::array<float,2>{0.0477351658f, 0.959412038f},
-std::array<float,2>{0.242675945f, 0.0347260833f},
-std::array<float,2>{0.777905881f, 0.800444901f},
-std::array<float,2>{0.536487579f, 0.316382587f},
-std::array<float,2>{0.373990208f, 0.545023263f},
-std::array<float,2>{0.0446686968f, 0.415915102f},
-std::array<float,2>{0.964469433f, 0.647303998f},
-std::array<float,2>{0.707683504f, 0.130104423f},
-std::array<float,2>{0.389209002f, 0.975060344f},
-std::array<float,2>{0.352863193f, 0.0214631576f},
-std::array<float,2>{0.555303335f, 0.760423124f},
-std::array<float,2>{0.763015866f, 0.362902373f},
-std::array<float,2>{0.233958662f, 0.521060944f},
-std::array<float,2>{0.475496501f, 0.286677122f},
-std::array<float,2>{0.672626734f, 0.623179317f},
-std::array<float,2>{0.887359142f, 0.109533466f},
-std::array<float,2>{0.0999281406f, 0.858568609f},
-std::array<float,2>{0.141570374f, 0.194537118f},
-std::array<float,2>{0.847457945f, 0.906795025f},
-std::array<float,2>{0.571239889f, 0.460009277f},
-std::array<float,2>{0.306561321f, 0.719513595f},
-std::array<float,2>{0.193812877f, 0.335511327f},
-std::array<float,2>{0.79876101f, 0.548510909f},
-std::array<float,2>{0.514019608f, 0.0604760759f},
-std::array<float,2>{0.319325835f, 0.787824333f},
-std::array<float,2>{0.432217866f, 0.15920189f},
-std::array<float,2>{0.719679117f, 0.948283315f},
-std::array<float,2>{0.989113927f, 0.383402884f},
-std::array<float,2>{0.0183954667f, 0.669741333f},
-std::array<float,2>{0.257483244f, 0.485479951f},
-std::array<float,2>{0.596312404f, 0.703476489f},
-std::array<float,2>{0.826362908f, 0.224420458f},
-std::array<float,2>{0.165933013f, 0.903378367f},
-std::array<float,2>{0.082645908f, 0.0831715316f},
-std::array<float,2>{0.921233714f, 0.842829347f},
-std::array<float,2>{0.652409852f, 0.254118562f},
-std::array<float,2>{0.452602804f, 0.568538606f},
-std::array<float,2>{0.224336982f, 0.378412724f},
-std::array<float,2>{0.756317139f, 0.661366105f},
-std::array<float,2>{0.550456166f, 0.167730346f},
-std::array<float,2>{0.349133849f, 0.943429589f},
-std::array<float,2>{0.377992928f, 0.0512568578f},
-std::array<float,2>{0.718305886f, 0.791154563f},
-std::array<float,2>{0.958185494f, 0.342085332f},
-std::array<float,2>{0.0352918543f, 0.562384129f},
-std::array<float,2>{0.299353272f, 0.261865914f},
-std::array<float,2>{0.567762911f, 0.57425195f},
-std::array<float,2>{0.856244087f, 0.0871404558f},
-std::array<float,2>{0.150348082f, 0.832786024f},
-std::array<float,2>{0.103337608f, 0.230096683f},
-std::array<float,2>{0.877198994f, 0.89763844f},
-std::array<float,2>{0.687151372f, 0.492720217f},
-std::array<float,2>{0.480857641f, 0.712188005f},
-std::array<float,2>{0.030463906f, 0.36948511f},
-std::array<float,2>{0.995683372f, 0.523708522f},
-std::array<float,2>{0.73254174f, 0.0286712497f},
-std::array<float,2>{0.422164083f, 0.757191479f},
-std::array<float,2>{0.322255164f, 0.137741148f},
-std::array<float,2>{0.502857327f, 0.983701527f},
-std::array<float,2>{0.806887865f, 0.413121849f},
-std::array<float,2>{0.200923547f, 0.650337994f},
-std::array<float,2>{0.437919557f, 0.462470621f},
-std::array<float,2>{0.647281647f, 0.733368218f},
-std::array<float,2>{0.910908937f, 0.202598244f},
-std::array<float,2>{0.0859634355f, 0.920939147f},
-std::array<float,2>{0.157558039f, 0.123860672f},
-std::array<float,2>{0.818906009f, 0.845475018f},
-std::array<float,2>{0.608831406f, 0.296551555f},
-std::array<float,2>{0.260143518f, 0.610727608f},
-std::array<float,2>{0.0728567317f, 0.481388509f},
-std::array<float,2>{0.936991632f, 0.688310683f},
-std::array<float,2>{0.638881743f, 0.246650279f},
-std::array<float,2>{0.464380175f, 0.886269033f},
-std::array<float,2>{0.279433459f, 0.0778960139f},
-std::array<float,2>{0.610647321f, 0.821669638f},
-std::array<float,2>{0.842181921f, 0.269483984f},
-std::array<float,2>{0.176977709f, 0.582253218f},
-std::array<float,2>{0.416775048f, 0.321438313f},
-std::array<float,2>{0.746851861f, 0.534751654f},
-std::array<float,2>{0.97087276f, 0.0435665585f},
-std::array<float,2>{0.0131053748f, 0.809682131f},
-std::array<float,2>{0.212428808f, 0.175338537f},
-std::array<float,2>{0.79369545f, 0.967776537f},
-std::array<float,2>{0.530579209f, 0.403378338f},
-std::array<float,2>{0.343259931f, 0.672632217f},
-std::array<float,2>{0.132092744f, 0.307211578f},
-std::array<float,2>{0.869753718f, 0.608719409f},
-std::array<float,2>{0.590299189f, 0.0969082415f},
-std::array<float,2>{0.283793002f, 0.861079752f},
-std::array<float,2>{0.485859305f, 0.203817889f},
-std::array<float,2>{0.658988833f, 0.932001173f},
-std::array<float,2>{0.903809845f, 0.439447165f},
-std::array<float,2>{0.124990061f, 0.746891856f},
-std::array<float,2>{0.36539492f, 0.433742106f},
-std::array<float,2>{0.543281019f, 0.628664792f},
-std::array<float,2>{0.766782641f, 0.149730653f},
-std::array<float,2>{0.238387465f, 0.991512775f},
-std::array<float,2>{0.0577604696f, 0.0101181455f},
-std::array<float,2>{0.941342711f, 0.777179122f},
-std::array<float,2>{0.687690854f, 0.357928604f},
-std::array<float,2>{0.403560042f, 0.507076263f},
-std::array<float,2>{0.207686886f, 0.498055607f},
-std::array<float,2>{0.786470652f, 0.718299568f},
-std::array<float,2>{0.520763755f, 0.231759205f},
-std::array<float,2>{0.329360098f, 0.893249273f},
-std::array<float,2>{0.412296087f, 0.091234006f},
-std::array<float,2>{0.739609361f, 0.828961194f},
-std::array<float,2>{0.982780099f, 0.261381686f},
-std::array<float,2>{0.000162285243f, 0.570371389f},
-std::array<float,2>{0.269788027f, 0.336941719f},
-std::array<float,2>{0.622944474f, 0.558448076f},
-std::array<float,2>{0.835700691f, 0.046939984f},
-std::array<float,2>{0.185542747f, 0.79397136f},
-std::array<float,2>{0.0677112862f, 0.171126708f},
-std::array<float,2>{0.929330289f, 0.940466702f},
-std::array<float,2>{0.625040293f, 0.380571872f},
-std::array<float,2>{0.460093617f, 0.660078406f},
-std::array<float,2>{0.05356621f, 0.289892614f},
-std::array<float,2>{0.94962436f, 0.615787983f},
-std::array<float,2>{0.702542424f, 0.118721731f},
-std::array<float,2>{0.398020327f, 0.850818336f},
-std::array<float,2>{0.367930919f, 0.197419062f},
-std::array<float,2>{0.533513069f, 0.914629281f},
-std::array<float,2>{0.775687933f, 0.465274334f},
-std::array<float,2>{0.248069674f, 0.729392827f},
-std::array<float,2>{0.494012147f, 0.40868327f},
-std::array<float,2>{0.667053223f, 0.652885735f},
-std::array<float,2>{0.892378211f, 0.135500491f},
-std::array<float,2>{0.114381447f, 0.979108095f},
-std::array<float,2>{0.133687332f, 0.0256812666f},
-std::array<float,2>{0.866447747f, 0.753585517f},
-std::array<float,2>{0.584233761f, 0.373196155f},
-std::array<float,2>{0.293457597f, 0.529115021f},
-std::array<float,2>{0.0957927406f, 0.400208503f},
-std::array<float,2>{0.884676576f, 0.677737653f},
-std::array<float,2>{0.677623808f, 0.17709361f},
-std::array<float,2>{0.470638663f, 0.962997496f},
-std::array<float,2>{0.311928809f, 0.0391932055f},
-std::array<float,2>{0.574724138f, 0.804782808f},
-std::array<float,2>{0.851203799f, 0.326564968f},
-std::array<float,2>{0.146629378f, 0.536477923f},
-std::array<float,2>{0.383104742f, 0.272928119f},
-std::array<float,2>{0.704810023f, 0.579543591f},
-std::array<float,2>{0.968068659f, 0.0707260296f},
-std::array<float,2>{0.0428774729f, 0.824872792f},
-std::array<float,2>{0.227215379f, 0.244181603f},
-std::array<float,2>{0.759308279f, 0.887742579f},
-std::array<float,2>{0.559293687f, 0.480283439f},
-std::array<float,2>{0.356143594f, 0.691821814f},
-std::array<float,2>{0.170618579f, 0.35167101f},
-std::array<float,2>{0.822370887f, 0.500704408f},
-std::array<float,2>{0.598425448f, 0.0126453331f},
-std::array<float,2>{0.250323802f, 0.780243278f},
-std::array<float,2>{0.447109461f, 0.155766919f},
-std::array<float,2>{0.649945557f, 0.985275865f},
-std::array<float,2>{0.914695859f, 0.430088103f},
-std::array<float,2>{0.0818445608f, 0.628980815f},
-std::array<float,2>{0.314113468f, 0.441768855f},
-std::array<float,2>{0.511562407f, 0.744092524f},
-std::array<float,2>{0.802152216f, 0.210118502f},
-std::array<float,2>{0.190138996f, 0.935824096f},
-std::array<float,2>{0.0228188969f, 0.0997120738f},
-std::array<float,2>{0.984580994f, 0.865695536f},
-std::array<float,2>{0.725644946f, 0.311509311f},
-std::array<float,2>{0.435215354f, 0.605078518f},
-std::array<float,2>{0.155440077f, 0.42707774f},
-std::array<float,2>{0.854134977f, 0.636115015f},
-std::array<float,2>{0.565480709f, 0.14198035f},
-std::array<float,2>{0.302083164f, 0.999273598f},
-std::array<float,2>{0.478316307f, 0.00501949759f},
-std::array<float,2>{0.682617247f, 0.769477427f},
-std::array<float,2>{0.879244745f, 0.343854785f},
-std::array<float,2>{0.106880471f, 0.511508107f},
-std::array<float,2>{0.345242232f, 0.297924429f},
-std::array<float,2>{0.55449301f, 0.595776677f},
-std::array<float,2>{0.752842784f, 0.10441298f},
-std::array<float,2>{0.220595777f, 0.873432279f},
-std::array<float,2>{0.0336695872f, 0.216543555f},
-std::array<float,2>{0.957007885f, 0.92259115f},
-std::array<float,2>{0.712997079f, 0.450906783f},
-std::array<float,2>{0.380456775f, 0.737475693f},
-std::array<float,2>{0.0936770514f, 0.316685081f},
-std::array<float,2>{0.909914494f, 0.542346656f},
-std::array<float,2>{0.643529773f, 0.0354802161f},
-std::array<float,2>{0.444901109f, 0.803857565f},
-std::array<float,2>{0.264144152f, 0.183809027f},
-std::array<float,2>{0.601812959f, 0.953763783f},
-std::array<float,2>{0.815800548f, 0.392116219f},
-std::array<float,2>{0.161230296f, 0.682675838f},
-std::array<float,2>{0.42629689f, 0.469893903f},
-std::array<float,2>{0.728428483f, 0.69612956f},
-std::array<float,2>{0.998871088f, 0.24003619f},
-std::array<float,2>{0.0272569302f, 0.878626227f},
-std::array<float,2>{0.198972076f, 0.0693566799f},
-std::array<float,2>{0.811700225f, 0.820084333f},
-std::array<float,2>{0.506346643f, 0.27947998f},
-std::array<float,2>{0.324638695f, 0.59280014f},
-std::array<float,2>{0.00855358504f, 0.453173667f},
-std::array<float,2>{0.973931968f, 0.724458754f},
-std::array<float,2>{0.745373785f, 0.188634172f},
-std::array<float,2>{0.419445634f, 0.913502157f},
-std::array<float,2>{0.338663965f, 0.115890644f},
-std::array<float,2>{0.524222136f, 0.852233469f},
-std::array<float,2>{0.792078912f, 0.281345129f},
-std::array<float,2>{0.217794046f, 0.619092822f},
-std::array<float,2>{0.467576146f, 0.366717607f},
-std::array<float,2>{0.634892106f, 0.517874122f},
-std::array<float,2>{0.931582987f, 0.0183247775f},
-std::array<float,2>{0.0762841329f, 0.763801873f},
-std::array<float,2>{0.173062921f, 0.128845632f},
-std::array<float,2>{0.838983476f, 0.968842626f},
-std::array<float,2>{0.615374446f, 0.41974467f},
-std::array<float,2>{0.275118232f, 0.644030511f},
-std::array<float,2>{0.234474793f, 0.250496626f},
-std::array<float,2>{0.770759046f, 0.565021574f},
-std::array<float,2>{0.542080283f, 0.0799602717f},
-std::array<float,2>{0.3608509f, 0.836525977f},
-std::array<float,2>{0.399555266f, 0.220108226f},
-std::array<float,2>{0.69257319f, 0.898847878f},
-std::array<float,2>{0.944482982f, 0.490912944f},
-std::array<float,2>{0.0613015667f, 0.709658742f},
-std::array<float,2>{0.287927061f, 0.387115419f},
-std::array<float,2>{0.589740217f, 0.666838109f},
-std::array<float,2>{0.874557555f, 0.161336988f},
-std::array<float,2>{0.128237277f, 0.950844169f},
-std::array<float,2>{0.11901655f, 0.0577551015f},
-std::array<float,2>{0.90180409f, 0.782405019f},
-std::array<float,2>{0.662579775f, 0.328327328f},
-std::array<float,2>{0.490150511f, 0.554687202f},
-std::array<float,2>{0.138742074f, 0.475410044f},
-std::array<float,2>{0.860509932f, 0.701568484f},
-std::array<float,2>{0.581549764f, 0.236957729f},
-std::array<float,2>{0.290561318f, 0.879227757f},
-std::array<float,2>{0.496985167f, 0.0643603429f},
-std::array<float,2>{0.671747983f, 0.814973354f},
-std::array<float,2>{0.89543581f, 0.274050802f},
-std::array<float,2>{0.110283084f, 0.58706218f},
-std::array<float,2>{0.371466726f, 0.31428501f},
-std::array<float,2>{0.537305057f, 0.543886244f},
-std::array<float,2>{0.781045914f, 0.0322499722f},
-std::array<float,2>{0.245009601f, 0.797571123f},
-std::array<float,2>{0.0498263724f, 0.183568299f},
-std::array<float,2>{0.948286295f, 0.958742142f},
-std::array<float,2>{0.697868347f, 0.398253649f},
-std::array<float,2>{0.393731415f, 0.685907483f},
-std::array<float,2>{0.0637226105f, 0.30204618f},
-std::array<float,2>{0.924488664f, 0.59871459f},
-std::array<float,2>{0.630795181f, 0.10927283f},
-std::array<float,2>{0.45430401f, 0.869581521f},
-std::array<float,2>{0.266971797f, 0.213257045f},
-std::array<float,2>{0.619143963f, 0.928302109f},
-std::array<float,2>{0.830498815f, 0.446752965f},
-std::array<float,2>{0.182635695f, 0.73907268f},
-std::array<float,2>{0.409762621f, 0.423203409f},
-std::array<float,2>{0.737866461f, 0.637327492f},
-std::array<float,2>{0.97689575f, 0.146567166f},
-std::array<float,2>{0.0067048315f, 0.992633402f},
-std::array<float,2>{0.205594137f, 0.00137853622f},
-std::array<float,2>{0.781711757f, 0.772925854f},
-std::array<float,2>{0.519488454f, 0.349782616f},
-std::array<float,2>{0.332994789f, 0.513204515f},
-std::array<float,2>{0.0173277259f, 0.386500806f},
-std::array<float,2>{0.991844177f, 0.671388209f},
-std::array<float,2>{0.721837163f, 0.156615332f},
-std::array<float,2>{0.430646986f, 0.946442425f},
-std::array<float,2>{0.317506164f, 0.0621691756f},
-std::array<float,2>{0.512249827f, 0.785543203f},
-std::array<float,2>{0.799555957f, 0.333903909f},
-std::array<float,2>{0.192601517f, 0.550552249f},
-std::array<float,2>{0.450815529f, 0.256483585f},
-std::array<float,2>{0.655142546f, 0.566733539f},
-std::array<float,2>{0.918957233f, 0.0845040232f},
-std::array<float,2>{0.0854036734f, 0.841448367f},
-std::array<float,2>{0.167061195f, 0.22601147f},
-std::array<float,2>{0.824588776f, 0.905286491f},
-std::array<float,2>{0.595174849f, 0.488094747f},
-std::array<float,2>{0.253924519f, 0.70696342f},
-std::array<float,2>{0.230650291f, 0.361134261f},
-std::array<float,2>{0.764255583f, 0.522950232f},
-std::array<float,2>{0.558322668f, 0.0227882937f},
-std::array<float,2>{0.355289459f, 0.758505702f},
-std::array<float,2>{0.387113214f, 0.131331384f},
-std::array<float,2>{0.710857213f, 0.974111676f},
-std::array<float,2>{0.962548673f, 0.417809069f},
-std::array<float,2>{0.0453999303f, 0.646341622f},
-std::array<float,2>{0.308224618f, 0.458337456f},
-std::array<float,2>{0.574013054f, 0.722649753f},
-std::array<float,2>{0.845354855f, 0.192002282f},
-std::array<float,2>{0.144078717f, 0.908967674f},
-std::array<float,2>{0.0991148874f, 0.1113801f},
-std::array<float,2>{0.889643431f, 0.856759191f},
-std::array<float,2>{0.675716698f, 0.28883037f},
-std::array<float,2>{0.474386245f, 0.62166667f},
-std::array<float,2>{0.201185748f, 0.410377443f},
-std::array<float,2>{0.804800808f, 0.651129425f},
-std::array<float,2>{0.500337005f, 0.138837948f},
-std::array<float,2>{0.322502017f, 0.982194543f},
-std::array<float,2>{0.425370544f, 0.0301018171f},
-std::array<float,2>{0.730710268f, 0.754290998f},
-std::array<float,2>{0.992477f, 0.367235869f},
-std::array<float,2>{0.0275681186f, 0.525548041f},
-std::array<float,2>{0.259121835f, 0.294477522f},
-std::array<float,2>{0.60667634f, 0.612219095f},
-std::array<float,2>{0.817398965f, 0.122950889f},
-std::array<float,2>{0.16009818f, 0.846585393f},
-std::array<float,2>{0.0885812268f, 0.200116098f},
-std::array<float,2>{0.913830698f, 0.918282151f},
-std::array<float,2>{0.646443784f, 0.464107722f},
-std::array<float,2>{0.440767646f, 0.73104775f},
-std::array<float,2>{0.0373157971f, 0.341645598f},
-std::array<float,2>{0.960443676f, 0.559159815f},
-std::array<float,2>{0.716243267f, 0.0536935441f},
-std::array<float,2>{0.375648528f, 0.79045707f},
-std::array<float,2>{0.35134837f, 0.164356276f},
-std::array<float,2>{0.548389673f, 0.942254424f},
-std::array<float,2>{0.755035579f, 0.375575274f},
-std::array<float,2>{0.225760803f, 0.662883341f},
-std::array<float,2>{0.483448982f, 0.495454311f},
-std::array<float,2>{0.684099495f, 0.713772893f},
-std::array<float,2>{0.87662518f, 0.227843732f},
-std::array<float,2>{0.103789344f, 0.896045983f},
-std::array<float,2>{0.151348352f, 0.0882256031f},
-std::array<float,2>{0.858816266f, 0.835027456f},
-std::array<float,2>{0.569887996f, 0.264925152f},
-std::array<float,2>{0.297549278f, 0.576568246f},
-std::array<float,2>{0.121896647f, 0.440727383f},
-std::array<float,2>{0.905388474f, 0.749271095f},
-std::array<float,2>{0.65723002f, 0.205317855f},
-std::array<float,2>{0.486599833f, 0.931389511f},
-std::array<float,2>{0.281683058f, 0.0939978808f},
-std::array<float,2>{0.593386173f, 0.862507045f},
-std::array<float,2>{0.867566586f, 0.305177957f},
-std::array<float,2>{0.129704952f, 0.606177807f},
-std::array<float,2>{0.404662132f, 0.35619241f},
-std::array<float,2>{0.691083014f, 0.505050719f},
-std::array<float,2>{0.938197494f, 0.00850408524f},
-std::array<float,2>{0.0565090403f, 0.773967445f},
-std::array<float,2>{0.241485715f, 0.152303055f},
-std::array<float,2>{0.769359827f, 0.989945769f},
-std::array<float,2>{0.544938743f, 0.436153382f},
-std::array<float,2>{0.364956349f, 0.625953138f},
-std::array<float,2>{0.178929016f, 0.266216218f},
-std::array<float,2>{0.841580272f, 0.585343719f},
-std::array<float,2>{0.613270402f, 0.0753799528f},
-std::array<float,2>{0.279223412f, 0.822999954f},
-std::array<float,2>{0.462156981f, 0.24913916f},
-std::array<float,2>{0.637792647f, 0.883702457f},
-std::array<float,2>{0.935494184f, 0.483408779f},
-std::array<float,2>{0.0709823146f, 0.689699709f},
-std::array<float,2>{0.341774732f, 0.405847996f},
-std::array<float,2>{0.527578235f, 0.675620317f},
-std::array<float,2>{0.796089649f, 0.172250316f},
-std::array<float,2>{0.213060528f, 0.965486944f},
-std::array<float,2>{0.0150276525f, 0.0467679203f},
-std::array<float,2>{0.970364392f, 0.81106931f},
-std::array<float,2>{0.748961806f, 0.322736651f},
-std::array<float,2>{0.415273845f, 0.531623304f},
-std::array<float,2>{0.24781619f, 0.46850884f},
-std::array<float,2>{0.77412039f, 0.726659f},
-std::array<float,2>{0.531724393f, 0.196230978f},
-std::array<float,2>{0.370054632f, 0.91782105f},
-std::array<float,2>{0.394557089f, 0.120107494f},
-std::array<float,2>{0.700782418f, 0.848791659f},
-std::array<float,2>{0.951260209f, 0.292015076f},
-std::array<float,2>{0.0522406884f, 0.614566445f},
-std::array<float,2>{0.295910865f, 0.371337384f},
-std::array<float,2>{0.582813442f, 0.529320061f},
-std::array<float,2>{0.864190519f, 0.0248499326f},
-std::array<float,2>{0.134899959f, 0.751283646f},
-std::array<float,2>{0.115652025f, 0.13325958f},
-std::array<float,2>{0.892820179f, 0.977566302f},
-std::array<float,2>{0.666000307f, 0.407433003f},
-std::array<float,2>{0.495942652f, 0.656001627f},
-std::array<float,2>{0.00328895194f, 0.258989573f},
-std::array<float,2>{0.980974853f, 0.573867619f},
-std::array<float,2>{0.741709232f, 0.0929659456f},
-std::array<float,2>{0.41102457f, 0.831049979f},
-std::array<float,2>{0.330522388f, 0.233349398f},
-std::array<float,2>{0.523124456f, 0.892027855f},
-std::array<float,2>{0.788298726f, 0.497898221f},
-std::array<float,2>{0.210225329f, 0.714918256f},
-std::array<float,2>{0.457140267f, 0.382176489f},
-std::array<float,2>{0.628783286f, 0.657934904f},
-std::array<float,2>{0.927664697f, 0.169721827f},
-std::array<float,2>{0.069957383f, 0.938322961f},
-std::array<float,2>{0.186775491f, 0.0492608249f},
-std::array<float,2>{0.832151771f, 0.795182288f},
-std::array<float,2>{0.623410404f, 0.339226902f},
-std::array<float,2>{0.273149967f, 0.555497289f},
-std::array<float,2>{0.0790141672f, 0.431751579f},
-std::array<float,2>{0.917255282f, 0.632141292f},
-std::array<float,2>{0.650865495f, 0.153338954f},
-std::array<float,2>{0.448150456f, 0.986639023f},
-std::array<float,2>{0.252068341f, 0.0148851592f},
-std::array<float,2>{0.599642932f, 0.777995288f},
-std::array<float,2>{0.820522249f, 0.354835868f},
-std::array<float,2>{0.169074103f, 0.502872646f},
-std::array<float,2>{0.435647875f, 0.309905112f},
-std::array<float,2>{0.723209977f, 0.603355765f},
-std::array<float,2>{0.987692475f, 0.099520281f},
-std::array<float,2>{0.020668393f, 0.865059197f},
-std::array<float,2>{0.187948227f, 0.208424881f},
-std::array<float,2>{0.80296433f, 0.935262978f},
-std::array<float,2>{0.508605719f, 0.443866968f},
-std::array<float,2>{0.315819353f, 0.745237708f},
-std::array<float,2>{0.145315439f, 0.325078398f},
-std::array<float,2>{0.84915024f, 0.53809613f},
-std::array<float,2>{0.576638401f, 0.0427390784f},
-std::array<float,2>{0.309408307f, 0.8075037f},
-std::array<float,2>{0.47226584f, 0.179478332f},
-std::array<float,2>{0.678070307f, 0.962037027f},
-std::array<float,2>{0.885121822f, 0.401333332f},
-std::array<float,2>{0.0947473943f, 0.677237451f},
-std::array<float,2>{0.357750475f, 0.478384078f},
-std::array<float,2>{0.561555624f, 0.6945678f},
-std::array<float,2>{0.76043272f, 0.242339477f},
-std::array<float,2>{0.229851887f, 0.888695955f},
-std::array<float,2>{0.0401770324f, 0.0732504651f},
-std::array<float,2>{0.966262817f, 0.826225936f},
-std::array<float,2>{0.705946922f, 0.269688904f},
-std::array<float,2>{0.385502189f, 0.581780672f},
-std::array<float,2>{0.163086861f, 0.39424926f},
-std::array<float,2>{0.813455582f, 0.681284785f},
-std::array<float,2>{0.604138136f, 0.187429518f},
-std::array<float,2>{0.262897342f, 0.956813812f},
-std::array<float,2>{0.44288981f, 0.0376697406f},
-std::array<float,2>{0.64094907f, 0.801157415f},
-std::array<float,2>{0.907155633f, 0.318376809f},
-std::array<float,2>{0.0917205513f, 0.540615797f},
-std::array<float,2>{0.327724963f, 0.278773785f},
-std::array<float,2>{0.504628718f, 0.590468764f},
-std::array<float,2>{0.810124457f, 0.0667748004f},
-std::array<float,2>{0.195405617f, 0.817791224f},
-std::array<float,2>{0.0241550133f, 0.242167354f},
-std::array<float,2>{0.997796535f, 0.876439929f},
-std::array<float,2>{0.729368925f, 0.472375065f},
-std::array<float,2>{0.428442866f, 0.697407186f},
-std::array<float,2>{0.107824594f, 0.346021354f},
-std::array<float,2>{0.882575631f, 0.508775353f},
-std::array<float,2>{0.681098521f, 0.00592191704f},
-std::array<float,2>{0.479322821f, 0.767208099f},
-std::array<float,2>{0.303692907f, 0.144209877f},
-std::array<float,2>{0.562982619f, 0.996893346f},
-std::array<float,2>{0.852993786f, 0.428303719f},
-std::array<float,2>{0.153770015f, 0.632864773f},
-std::array<float,2>{0.381196558f, 0.451969236f},
-std::array<float,2>{0.712522626f, 0.735988498f},
-std::array<float,2>{0.953205645f, 0.217860654f},
-std::array<float,2>{0.0316493995f, 0.925086141f},
-std::array<float,2>{0.220839188f, 0.102824308f},
-std::array<float,2>{0.750360727f, 0.871969104f},
-std::array<float,2>{0.550828516f, 0.299637139f},
-std::array<float,2>{0.346710712f, 0.593959332f},
-std::array<float,2>{0.0598332435f, 0.48886475f},
-std::array<float,2>{0.942402303f, 0.707539558f},
-std::array<float,2>{0.694135845f, 0.221442327f},
-std::array<float,2>{0.401968926f, 0.901302934f},
-std::array<float,2>{0.361467838f, 0.0818937048f},
-std::array<float,2>{0.539973199f, 0.839703977f},
-std::array<float,2>{0.772443831f, 0.252028108f},
-std::array<float,2>{0.237504289f, 0.56341511f},
-std::array<float,2>{0.490467131f, 0.331772983f},
-std::array<float,2>{0.661122143f, 0.552450538f},
-std::array<float,2>{0.899039268f, 0.0548457913f},
-std::array<float,2>{0.120138019f, 0.784688056f},
-std::array<float,2>{0.125109598f, 0.162185505f},
-std::array<float,2>{0.871653199f, 0.952101529f},
-std::array<float,2>{0.586516857f, 0.389538407f},
-std::array<float,2>{0.28628248f, 0.665975392f},
-std::array<float,2>{0.215594113f, 0.28453806f},
-std::array<float,2>{0.789403558f, 0.620036721f},
-std::array<float,2>{0.52699542f, 0.114513382f},
-std::array<float,2>{0.337029189f, 0.853677392f},
-std::array<float,2>{0.421703309f, 0.189930901f},
-std::array<float,2>{0.744064331f, 0.912010193f},
-std::array<float,2>{0.975581944f, 0.455281407f},
-std::array<float,2>{0.00990924332f, 0.72620821f},
-std::array<float,2>{0.276917845f, 0.420037955f},
-std::array<float,2>{0.614616096f, 0.640740812f},
-std::array<float,2>{0.836545348f, 0.125034124f},
-std::array<float,2>{0.17452614f, 0.971191525f},
-std::array<float,2>{0.0761369839f, 0.0166073907f},
-std::array<float,2>{0.932933748f, 0.762582719f},
-std::array<float,2>{0.634226739f, 0.363849908f},
-std::array<float,2>{0.464872569f, 0.517298996f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.987477481f, 0.561983466f},
-std::array<float,2>{0.239928499f, 0.04349773f},
-std::array<float,2>{0.710862517f, 0.413285553f},
-std::array<float,2>{0.373085707f, 0.934697866f},
-std::array<float,2>{0.550243795f, 0.855884731f},
-std::array<float,2>{0.410807848f, 0.262222499f},
-std::array<float,2>{0.855001628f, 0.127728507f},
-std::array<float,2>{0.0417008325f, 0.690526485f},
-std::array<float,2>{0.660104275f, 0.65437901f},
-std::array<float,2>{0.256483078f, 0.22980535f},
-std::array<float,2>{0.935575724f, 0.320754051f},
-std::array<float,2>{0.13878648f, 0.751236737f},
-std::array<float,2>{0.767357349f, 0.966559291f},
-std::array<float,2>{0.107245915f, 0.478700697f},
-std::array<float,2>{0.583568931f, 0.0910115093f},
-std::array<float,2>{0.4926534f, 0.612401962f},
-std::array<float,2>{0.828319669f, 0.741669834f},
-std::array<float,2>{0.0173319355f, 0.16835694f},
-std::array<float,2>{0.505655885f, 0.287645638f},
-std::array<float,2>{0.40047434f, 0.836526871f},
-std::array<float,2>{0.718957067f, 0.887125075f},
-std::array<float,2>{0.328691989f, 0.384013087f},
-std::array<float,2>{0.940933526f, 0.0056077335f},
-std::array<float,2>{0.194007427f, 0.529110551f},
-std::array<float,2>{0.593994617f, 0.580058515f},
-std::array<float,2>{0.443138659f, 0.124128155f},
-std::array<float,2>{0.793003023f, 0.439417571f},
-std::array<float,2>{0.0770023838f, 0.993236482f},
-std::array<float,2>{0.883023381f, 0.784661531f},
-std::array<float,2>{0.182465255f, 0.355583459f},
-std::array<float,2>{0.656111896f, 0.192286223f},
-std::array<float,2>{0.283847988f, 0.670522332f},
-std::array<float,2>{0.909564197f, 0.680152714f},
-std::array<float,2>{0.152298242f, 0.214617297f},
-std::array<float,2>{0.679035485f, 0.365671039f},
-std::array<float,2>{0.274320424f, 0.807996511f},
-std::array<float,2>{0.572936833f, 0.972119153f},
-std::array<float,2>{0.473656356f, 0.458781451f},
-std::array<float,2>{0.754696965f, 0.0942377523f},
-std::array<float,2>{0.112980492f, 0.56425792f},
-std::array<float,2>{0.698090732f, 0.506216407f},
-std::array<float,2>{0.359147429f, 0.0212598648f},
-std::array<float,2>{0.973196268f, 0.40531081f},
-std::array<float,2>{0.219135404f, 0.895684123f},
-std::array<float,2>{0.866039217f, 0.814115167f},
-std::array<float,2>{0.0553862974f, 0.300315261f},
-std::array<float,2>{0.542133391f, 0.186491862f},
-std::array<float,2>{0.427489877f, 0.727564037f},
-std::array<float,2>{0.807489336f, 0.603588581f},
-std::array<float,2>{0.0794854611f, 0.0755957291f},
-std::array<float,2>{0.617329955f, 0.485163838f},
-std::array<float,2>{0.466945291f, 0.950531125f},
-std::array<float,2>{0.635455132f, 0.771056533f},
-std::array<float,2>{0.301672161f, 0.33068043f},
-std::array<float,2>{0.899896443f, 0.247408807f},
-std::array<float,2>{0.167940468f, 0.631558597f},
-std::array<float,2>{0.525160074f, 0.716760814f},
-std::array<float,2>{0.388171613f, 0.146652654f},
-std::array<float,2>{0.825260997f, 0.271885723f},
-std::array<float,2>{0.0127742654f, 0.862282097f},
-std::array<float,2>{0.957711339f, 0.912386596f},
-std::array<float,2>{0.217592731f, 0.428714395f},
-std::array<float,2>{0.743392527f, 0.0551557653f},
-std::array<float,2>{0.320334673f, 0.542845666f},
-std::array<float,2>{0.897395372f, 0.573669314f},
-std::array<float,2>{0.162873924f, 0.103975877f},
-std::array<float,2>{0.625081241f, 0.465124458f},
-std::array<float,2>{0.309783638f, 0.978193581f},
-std::array<float,2>{0.617003441f, 0.797051728f},
-std::array<float,2>{0.460488021f, 0.370999753f},
-std::array<float,2>{0.797744811f, 0.204857022f},
-std::array<float,2>{0.0909290984f, 0.678833306f},
-std::array<float,2>{0.735679209f, 0.721026182f},
-std::array<float,2>{0.317859381f, 0.178541914f},
-std::array<float,2>{0.966833115f, 0.305502772f},
-std::array<float,2>{0.204398021f, 0.825205684f},
-std::array<float,2>{0.81490308f, 0.90322119f},
-std::array<float,2>{0.00272083492f, 0.39713484f},
-std::array<float,2>{0.520532668f, 0.0308242105f},
-std::array<float,2>{0.37930578f, 0.510421872f},
-std::array<float,2>{0.760923028f, 0.634237647f},
-std::array<float,2>{0.123117164f, 0.234791979f},
-std::array<float,2>{0.56704092f, 0.342425555f},
-std::array<float,2>{0.476687849f, 0.777194798f},
-std::array<float,2>{0.68399179f, 0.945201635f},
-std::array<float,2>{0.265859842f, 0.496577471f},
-std::array<float,2>{0.915474892f, 0.0633317828f},
-std::array<float,2>{0.145950317f, 0.599124253f},
-std::array<float,2>{0.538292766f, 0.535470128f},
-std::array<float,2>{0.430053353f, 0.0510653555f},
-std::array<float,2>{0.873827398f, 0.434330612f},
-std::array<float,2>{0.0543627292f, 0.914233506f},
-std::array<float,2>{0.977217734f, 0.874191165f},
-std::array<float,2>{0.229159534f, 0.27678144f},
-std::array<float,2>{0.687814176f, 0.155234843f},
-std::array<float,2>{0.349442333f, 0.70699048f},
-std::array<float,2>{0.946561038f, 0.69532764f},
-std::array<float,2>{0.196348414f, 0.139587834f},
-std::array<float,2>{0.72660023f, 0.253486097f},
-std::array<float,2>{0.338423967f, 0.84377563f},
-std::array<float,2>{0.512161374f, 0.924197793f},
-std::array<float,2>{0.391427606f, 0.418031901f},
-std::array<float,2>{0.842842042f, 0.0328259245f},
-std::array<float,2>{0.0280553047f, 0.55060643f},
-std::array<float,2>{0.644196153f, 0.620649219f},
-std::array<float,2>{0.294304788f, 0.082841076f},
-std::array<float,2>{0.876513064f, 0.470429689f},
-std::array<float,2>{0.178160802f, 0.956528425f},
-std::array<float,2>{0.78399533f, 0.761155486f},
-std::array<float,2>{0.0625142828f, 0.317947984f},
-std::array<float,2>{0.602768958f, 0.223785907f},
-std::array<float,2>{0.449759454f, 0.641107917f},
-std::array<float,2>{0.84523952f, 0.515685499f},
-std::array<float,2>{0.0350635462f, 0.0098555591f},
-std::array<float,2>{0.56144017f, 0.379713297f},
-std::array<float,2>{0.418119639f, 0.881440699f},
-std::array<float,2>{0.717477083f, 0.829972029f},
-std::array<float,2>{0.364315003f, 0.296529382f},
-std::array<float,2>{0.998384178f, 0.162731349f},
-std::array<float,2>{0.24816145f, 0.749124765f},
-std::array<float,2>{0.589576244f, 0.660874546f},
-std::array<float,2>{0.485496253f, 0.19571878f},
-std::array<float,2>{0.781061113f, 0.347393572f},
-std::array<float,2>{0.0988031179f, 0.792777121f},
-std::array<float,2>{0.925958991f, 0.991457701f},
-std::array<float,2>{0.127630845f, 0.449480891f},
-std::array<float,2>{0.666295767f, 0.116993986f},
-std::array<float,2>{0.265526444f, 0.593266904f},
-std::array<float,2>{0.963410258f, 0.616071403f},
-std::array<float,2>{0.208572984f, 0.0876657963f},
-std::array<float,2>{0.738751292f, 0.480729371f},
-std::array<float,2>{0.315035611f, 0.961418629f},
-std::array<float,2>{0.517583191f, 0.755641043f},
-std::array<float,2>{0.376797885f, 0.325441897f},
-std::array<float,2>{0.819100797f, 0.232044831f},
-std::array<float,2>{0.00633500703f, 0.651649594f},
-std::array<float,2>{0.631922781f, 0.694797695f},
-std::array<float,2>{0.306349367f, 0.131154627f},
-std::array<float,2>{0.893016636f, 0.258174211f},
-std::array<float,2>{0.15934293f, 0.852841496f},
-std::array<float,2>{0.804084659f, 0.930963874f},
-std::array<float,2>{0.0868858993f, 0.409060478f},
-std::array<float,2>{0.611483872f, 0.0412820205f},
-std::array<float,2>{0.455153853f, 0.555015266f},
-std::array<float,2>{0.867391765f, 0.667756021f},
-std::array<float,2>{0.0484824292f, 0.189276487f},
-std::array<float,2>{0.532944739f, 0.353522807f},
-std::array<float,2>{0.434839338f, 0.786361635f},
-std::array<float,2>{0.691837549f, 0.99661231f},
-std::array<float,2>{0.345846921f, 0.442149997f},
-std::array<float,2>{0.981172621f, 0.12028157f},
-std::array<float,2>{0.230942681f, 0.584677458f},
-std::array<float,2>{0.565746427f, 0.526099682f},
-std::array<float,2>{0.480722249f, 0.00207142928f},
-std::array<float,2>{0.762041152f, 0.389983296f},
-std::array<float,2>{0.118249364f, 0.884210765f},
-std::array<float,2>{0.920354962f, 0.843521714f},
-std::array<float,2>{0.143654719f, 0.282597482f},
-std::array<float,2>{0.682941079f, 0.16453217f},
-std::array<float,2>{0.269584835f, 0.735979974f},
-std::array<float,2>{0.881354034f, 0.731976211f},
-std::array<float,2>{0.175384313f, 0.180531099f},
-std::array<float,2>{0.645588815f, 0.300863624f},
-std::array<float,2>{0.290843308f, 0.81712538f},
-std::array<float,2>{0.606207371f, 0.892224193f},
-std::array<float,2>{0.446572572f, 0.400317669f},
-std::array<float,2>{0.786061049f, 0.0191376861f},
-std::array<float,2>{0.0675446093f, 0.503203392f},
-std::array<float,2>{0.731527925f, 0.566525698f},
-std::array<float,2>{0.34320417f, 0.0978293866f},
-std::array<float,2>{0.950861037f, 0.455850035f},
-std::array<float,2>{0.200275317f, 0.976259232f},
-std::array<float,2>{0.83968991f, 0.809697926f},
-std::array<float,2>{0.0262812059f, 0.362320781f},
-std::array<float,2>{0.508306861f, 0.217525825f},
-std::array<float,2>{0.396097362f, 0.686566353f},
-std::array<float,2>{0.776195347f, 0.544626236f},
-std::array<float,2>{0.0945480242f, 0.0588289909f},
-std::array<float,2>{0.590770721f, 0.425115377f},
-std::array<float,2>{0.488328248f, 0.906522036f},
-std::array<float,2>{0.670412719f, 0.864076138f},
-std::array<float,2>{0.261345416f, 0.26607886f},
-std::array<float,2>{0.924667418f, 0.143095911f},
-std::array<float,2>{0.130498677f, 0.714038372f},
-std::array<float,2>{0.558048904f, 0.62636137f},
-std::array<float,2>{0.416811854f, 0.243763834f},
-std::array<float,2>{0.849786043f, 0.335772038f},
-std::array<float,2>{0.0381344929f, 0.767187238f},
-std::array<float,2>{0.994940579f, 0.948146462f},
-std::array<float,2>{0.244121879f, 0.490442634f},
-std::array<float,2>{0.71367687f, 0.0721850023f},
-std::array<float,2>{0.361248791f, 0.607109904f},
-std::array<float,2>{0.933590233f, 0.512398303f},
-std::array<float,2>{0.135483518f, 0.0265757907f},
-std::array<float,2>{0.660945296f, 0.392758131f},
-std::array<float,2>{0.25142464f, 0.901690841f},
-std::array<float,2>{0.578528702f, 0.821644068f},
-std::array<float,2>{0.496392488f, 0.308881253f},
-std::array<float,2>{0.770902216f, 0.173909083f},
-std::array<float,2>{0.103584386f, 0.725342631f},
-std::array<float,2>{0.703151345f, 0.673259914f},
-std::array<float,2>{0.369255275f, 0.209921032f},
-std::array<float,2>{0.99204123f, 0.373868436f},
-std::array<float,2>{0.237126082f, 0.801152349f},
-std::array<float,2>{0.857414961f, 0.982091129f},
-std::array<float,2>{0.0447939746f, 0.462255418f},
-std::array<float,2>{0.55467701f, 0.108095951f},
-std::array<float,2>{0.408117324f, 0.574312329f},
-std::array<float,2>{0.792117417f, 0.710001707f},
-std::array<float,2>{0.0708826035f, 0.150725514f},
-std::array<float,2>{0.599237561f, 0.278464794f},
-std::array<float,2>{0.438621491f, 0.870773137f},
-std::array<float,2>{0.651695907f, 0.920109689f},
-std::array<float,2>{0.288690478f, 0.430042773f},
-std::array<float,2>{0.887653053f, 0.0481420308f},
-std::array<float,2>{0.187042102f, 0.532326877f},
-std::array<float,2>{0.503903449f, 0.595303595f},
-std::array<float,2>{0.40319103f, 0.066742979f},
-std::array<float,2>{0.833459556f, 0.492415935f},
-std::array<float,2>{0.023371987f, 0.937660158f},
-std::array<float,2>{0.941796184f, 0.780449033f},
-std::array<float,2>{0.18785052f, 0.336337358f},
-std::array<float,2>{0.725058794f, 0.240208879f},
-std::array<float,2>{0.335651726f, 0.640105188f},
-std::array<float,2>{0.971904576f, 0.647813976f},
-std::array<float,2>{0.224362865f, 0.218807787f},
-std::array<float,2>{0.702534318f, 0.315300614f},
-std::array<float,2>{0.354026467f, 0.764884651f},
-std::array<float,2>{0.546414495f, 0.95993185f},
-std::array<float,2>{0.424069196f, 0.474064291f},
-std::array<float,2>{0.861172974f, 0.0807960853f},
-std::array<float,2>{0.0594845004f, 0.622300088f},
-std::array<float,2>{0.673454285f, 0.554026663f},
-std::array<float,2>{0.281002551f, 0.0358960778f},
-std::array<float,2>{0.91392231f, 0.415033013f},
-std::array<float,2>{0.153763607f, 0.926096261f},
-std::array<float,2>{0.752678931f, 0.848038137f},
-std::array<float,2>{0.11683511f, 0.25674063f},
-std::array<float,2>{0.576933146f, 0.134162635f},
-std::array<float,2>{0.469771385f, 0.699443936f},
-std::array<float,2>{0.823693752f, 0.586155355f},
-std::array<float,2>{0.00791963097f, 0.109653369f},
-std::array<float,2>{0.527647495f, 0.44713378f},
-std::array<float,2>{0.38586095f, 0.985799849f},
-std::array<float,2>{0.746987581f, 0.79355818f},
-std::array<float,2>{0.324668735f, 0.348722935f},
-std::array<float,2>{0.956749201f, 0.200248256f},
-std::array<float,2>{0.213850409f, 0.658628106f},
-std::array<float,2>{0.62495476f, 0.745872855f},
-std::array<float,2>{0.461856008f, 0.159591451f},
-std::array<float,2>{0.808762789f, 0.292625129f},
-std::array<float,2>{0.0839239061f, 0.835245728f},
-std::array<float,2>{0.904114068f, 0.87833178f},
-std::array<float,2>{0.170512438f, 0.377736121f},
-std::array<float,2>{0.6380983f, 0.0130928028f},
-std::array<float,2>{0.298196673f, 0.520229876f},
-std::array<float,2>{0.937915027f, 0.530750334f},
-std::array<float,2>{0.193145692f, 0.00709467102f},
-std::array<float,2>{0.721571743f, 0.384887755f},
-std::array<float,2>{0.33064425f, 0.889882922f},
-std::array<float,2>{0.507379711f, 0.837929428f},
-std::array<float,2>{0.39948687f, 0.285808593f},
-std::array<float,2>{0.830575883f, 0.170312345f},
-std::array<float,2>{0.0194914844f, 0.739570618f},
-std::array<float,2>{0.654218316f, 0.669870794f},
-std::array<float,2>{0.282401681f, 0.194182083f},
-std::array<float,2>{0.885967493f, 0.357714027f},
-std::array<float,2>{0.180236578f, 0.783179283f},
-std::array<float,2>{0.795744717f, 0.995801389f},
-std::array<float,2>{0.0742365792f, 0.440910071f},
-std::array<float,2>{0.597338259f, 0.122070104f},
-std::array<float,2>{0.443661094f, 0.580418825f},
-std::array<float,2>{0.853013754f, 0.687665761f},
-std::array<float,2>{0.0402539f, 0.126102969f},
-std::array<float,2>{0.547756135f, 0.264896691f},
-std::array<float,2>{0.414014637f, 0.858596921f},
-std::array<float,2>{0.708355963f, 0.937362254f},
-std::array<float,2>{0.371779054f, 0.411851317f},
-std::array<float,2>{0.984871686f, 0.0451198295f},
-std::array<float,2>{0.242177233f, 0.559564114f},
-std::array<float,2>{0.584011197f, 0.611294508f},
-std::array<float,2>{0.495384961f, 0.092547223f},
-std::array<float,2>{0.768544674f, 0.477560043f},
-std::array<float,2>{0.108523145f, 0.968269467f},
-std::array<float,2>{0.934897959f, 0.752639771f},
-std::array<float,2>{0.138091922f, 0.324037194f},
-std::array<float,2>{0.656313896f, 0.228429914f},
-std::array<float,2>{0.254177451f, 0.652495921f},
-std::array<float,2>{0.900934815f, 0.630601406f},
-std::array<float,2>{0.164540112f, 0.249662369f},
-std::array<float,2>{0.633339584f, 0.328278661f},
-std::array<float,2>{0.30427897f, 0.77198422f},
-std::array<float,2>{0.620410979f, 0.95309025f},
-std::array<float,2>{0.465835243f, 0.488023192f},
-std::array<float,2>{0.805150867f, 0.0766073093f},
-std::array<float,2>{0.0804361179f, 0.603017151f},
-std::array<float,2>{0.744884133f, 0.540441453f},
-std::array<float,2>{0.322439492f, 0.0574793369f},
-std::array<float,2>{0.960681021f, 0.426448852f},
-std::array<float,2>{0.215352163f, 0.910749495f},
-std::array<float,2>{0.827130914f, 0.860644519f},
-std::array<float,2>{0.0139719425f, 0.270343125f},
-std::array<float,2>{0.526991069f, 0.14517884f},
-std::array<float,2>{0.389520735f, 0.717160463f},
-std::array<float,2>{0.757474422f, 0.565146029f},
-std::array<float,2>{0.111307085f, 0.0976434872f},
-std::array<float,2>{0.570984244f, 0.460667938f},
-std::array<float,2>{0.475254506f, 0.969428658f},
-std::array<float,2>{0.676492751f, 0.805090725f},
-std::array<float,2>{0.277015686f, 0.365043372f},
-std::array<float,2>{0.906444907f, 0.212119699f},
-std::array<float,2>{0.14950493f, 0.683587968f},
-std::array<float,2>{0.539486468f, 0.728835106f},
-std::array<float,2>{0.429453969f, 0.185076073f},
-std::array<float,2>{0.864815354f, 0.297653794f},
-std::array<float,2>{0.0575036667f, 0.815742135f},
-std::array<float,2>{0.976457834f, 0.898088336f},
-std::array<float,2>{0.221145421f, 0.404179811f},
-std::array<float,2>{0.696990967f, 0.0228168871f},
-std::array<float,2>{0.357131124f, 0.505054772f},
-std::array<float,2>{0.917135835f, 0.59962666f},
-std::array<float,2>{0.147679403f, 0.0653973892f},
-std::array<float,2>{0.686054587f, 0.498342574f},
-std::array<float,2>{0.269368917f, 0.943061054f},
-std::array<float,2>{0.568571627f, 0.773835897f},
-std::array<float,2>{0.478598803f, 0.339904338f},
-std::array<float,2>{0.758330822f, 0.236979872f},
-std::array<float,2>{0.121293023f, 0.635045707f},
-std::array<float,2>{0.691294909f, 0.704096794f},
-std::array<float,2>{0.349636436f, 0.153632954f},
-std::array<float,2>{0.979474425f, 0.274977982f},
-std::array<float,2>{0.228280813f, 0.871549964f},
-std::array<float,2>{0.872980237f, 0.916230619f},
-std::array<float,2>{0.0517160073f, 0.436745852f},
-std::array<float,2>{0.537016153f, 0.0541517287f},
-std::array<float,2>{0.432009071f, 0.538210213f},
-std::array<float,2>{0.799167454f, 0.676090777f},
-std::array<float,2>{0.0924549997f, 0.205665678f},
-std::array<float,2>{0.61482662f, 0.368328243f},
-std::array<float,2>{0.45753029f, 0.800569177f},
-std::array<float,2>{0.62755388f, 0.98026979f},
-std::array<float,2>{0.312037259f, 0.467533737f},
-std::array<float,2>{0.895190299f, 0.102814518f},
-std::array<float,2>{0.16165337f, 0.571659744f},
-std::array<float,2>{0.522190213f, 0.508550525f},
-std::array<float,2>{0.38267985f, 0.0286732018f},
-std::array<float,2>{0.814258933f, 0.395979732f},
-std::array<float,2>{0.00102718046f, 0.905083179f},
-std::array<float,2>{0.964895368f, 0.827930808f},
-std::array<float,2>{0.205155089f, 0.306841165f},
-std::array<float,2>{0.7380777f, 0.176482096f},
-std::array<float,2>{0.319414318f, 0.720340848f},
-std::array<float,2>{0.997381628f, 0.746628165f},
-std::array<float,2>{0.247317314f, 0.161307052f},
-std::array<float,2>{0.714915931f, 0.294047326f},
-std::array<float,2>{0.366414785f, 0.830732584f},
-std::array<float,2>{0.559690416f, 0.880518973f},
-std::array<float,2>{0.421695501f, 0.381570816f},
-std::array<float,2>{0.847219169f, 0.00860259403f},
-std::array<float,2>{0.032955531f, 0.518555164f},
-std::array<float,2>{0.664232075f, 0.591328919f},
-std::array<float,2>{0.262059569f, 0.11429131f},
-std::array<float,2>{0.928389013f, 0.452597857f},
-std::array<float,2>{0.125752553f, 0.990015149f},
-std::array<float,2>{0.777444422f, 0.790442586f},
-std::array<float,2>{0.100629568f, 0.345325202f},
-std::array<float,2>{0.587432086f, 0.197993457f},
-std::array<float,2>{0.487472475f, 0.662568688f},
-std::array<float,2>{0.841581345f, 0.548675299f},
-std::array<float,2>{0.0298834592f, 0.0342955962f},
-std::array<float,2>{0.514208496f, 0.420885086f},
-std::array<float,2>{0.393856436f, 0.92373836f},
-std::array<float,2>{0.728961349f, 0.846399844f},
-std::array<float,2>{0.336916447f, 0.251239419f},
-std::array<float,2>{0.947720528f, 0.13713026f},
-std::array<float,2>{0.198498055f, 0.698402822f},
-std::array<float,2>{0.6036852f, 0.642889619f},
-std::array<float,2>{0.4512963f, 0.224897385f},
-std::array<float,2>{0.783021748f, 0.319123715f},
-std::array<float,2>{0.0661321953f, 0.757953525f},
-std::array<float,2>{0.878662944f, 0.953436017f},
-std::array<float,2>{0.177430138f, 0.47236982f},
-std::array<float,2>{0.641100109f, 0.0851942375f},
-std::array<float,2>{0.296817303f, 0.61882031f},
-std::array<float,2>{0.982980251f, 0.583323061f},
-std::array<float,2>{0.232958451f, 0.117512442f},
-std::array<float,2>{0.694947958f, 0.443627536f},
-std::array<float,2>{0.343873024f, 0.999367177f},
-std::array<float,2>{0.533665538f, 0.787425816f},
-std::array<float,2>{0.436960399f, 0.352461457f},
-std::array<float,2>{0.870619893f, 0.189973339f},
-std::array<float,2>{0.0507571883f, 0.664338589f},
-std::array<float,2>{0.681319118f, 0.737284243f},
-std::array<float,2>{0.27276969f, 0.167540118f},
-std::array<float,2>{0.918692589f, 0.284516186f},
-std::array<float,2>{0.141495436f, 0.841381371f},
-std::array<float,2>{0.765176654f, 0.886102319f},
-std::array<float,2>{0.120381959f, 0.387203306f},
-std::array<float,2>{0.563739359f, 0.0017459736f},
-std::array<float,2>{0.483747482f, 0.52523005f},
-std::array<float,2>{0.81763643f, 0.649322689f},
-std::array<float,2>{0.0047389674f, 0.232452407f},
-std::array<float,2>{0.515703201f, 0.326739818f},
-std::array<float,2>{0.377983183f, 0.756355286f},
-std::array<float,2>{0.742172599f, 0.963949859f},
-std::array<float,2>{0.312847078f, 0.484293848f},
-std::array<float,2>{0.961528063f, 0.0895097926f},
-std::array<float,2>{0.209121823f, 0.61445272f},
-std::array<float,2>{0.610322952f, 0.557549596f},
-std::array<float,2>{0.453756005f, 0.0398061611f},
-std::array<float,2>{0.802650511f, 0.407843351f},
-std::array<float,2>{0.0892525688f, 0.932658672f},
-std::array<float,2>{0.892291188f, 0.854738533f},
-std::array<float,2>{0.158173308f, 0.260585457f},
-std::array<float,2>{0.630317032f, 0.128944829f},
-std::array<float,2>{0.308554858f, 0.692202389f},
-std::array<float,2>{0.923418999f, 0.711839437f},
-std::array<float,2>{0.131723657f, 0.141577676f},
-std::array<float,2>{0.668577671f, 0.268778473f},
-std::array<float,2>{0.259478986f, 0.866234064f},
-std::array<float,2>{0.592052996f, 0.910145938f},
-std::array<float,2>{0.491286963f, 0.423115343f},
-std::array<float,2>{0.774834991f, 0.0612716936f},
-std::array<float,2>{0.0958129168f, 0.546005368f},
-std::array<float,2>{0.712830901f, 0.609164476f},
-std::array<float,2>{0.362606794f, 0.0729300529f},
-std::array<float,2>{0.993629694f, 0.489486128f},
-std::array<float,2>{0.244921431f, 0.947225094f},
-std::array<float,2>{0.847773731f, 0.768631577f},
-std::array<float,2>{0.0357555412f, 0.332091182f},
-std::array<float,2>{0.555665553f, 0.244301021f},
-std::array<float,2>{0.414152563f, 0.627220035f},
-std::array<float,2>{0.78769958f, 0.500184476f},
-std::array<float,2>{0.0691136196f, 0.0167756546f},
-std::array<float,2>{0.609236479f, 0.401828259f},
-std::array<float,2>{0.447635055f, 0.89289248f},
-std::array<float,2>{0.646581292f, 0.819764853f},
-std::array<float,2>{0.29220885f, 0.302763879f},
-std::array<float,2>{0.879811645f, 0.182971969f},
-std::array<float,2>{0.173760951f, 0.732772171f},
-std::array<float,2>{0.51102972f, 0.684143007f},
-std::array<float,2>{0.397739261f, 0.216265157f},
-std::array<float,2>{0.836358726f, 0.360777318f},
-std::array<float,2>{0.0234597027f, 0.812096894f},
-std::array<float,2>{0.951740801f, 0.974234223f},
-std::array<float,2>{0.201898649f, 0.454644293f},
-std::array<float,2>{0.732864141f, 0.100992575f},
-std::array<float,2>{0.340909064f, 0.568697155f},
-std::array<float,2>{0.890304148f, 0.535093427f},
-std::array<float,2>{0.18401958f, 0.0500323474f},
-std::array<float,2>{0.649901271f, 0.431747675f},
-std::array<float,2>{0.287100643f, 0.918572247f},
-std::array<float,2>{0.601145744f, 0.868782699f},
-std::array<float,2>{0.440217972f, 0.281236619f},
-std::array<float,2>{0.790151f, 0.149181634f},
-std::array<float,2>{0.0737152919f, 0.707130671f},
-std::array<float,2>{0.724466801f, 0.637046039f},
-std::array<float,2>{0.333511233f, 0.240518585f},
-std::array<float,2>{0.944370091f, 0.338777244f},
-std::array<float,2>{0.190837473f, 0.777437985f},
-std::array<float,2>{0.835660696f, 0.94008249f},
-std::array<float,2>{0.020436557f, 0.496017218f},
-std::array<float,2>{0.501464605f, 0.0698400438f},
-std::array<float,2>{0.405753344f, 0.596898079f},
-std::array<float,2>{0.773023427f, 0.724249065f},
-std::array<float,2>{0.102977306f, 0.172027171f},
-std::array<float,2>{0.581387639f, 0.311602205f},
-std::array<float,2>{0.498866111f, 0.823587477f},
-std::array<float,2>{0.663223028f, 0.899853051f},
-std::array<float,2>{0.25323686f, 0.392153591f},
-std::array<float,2>{0.931615114f, 0.0241172556f},
-std::array<float,2>{0.13292715f, 0.514066696f},
-std::array<float,2>{0.552099645f, 0.576338649f},
-std::array<float,2>{0.409137756f, 0.106261268f},
-std::array<float,2>{0.857901931f, 0.464527458f},
-std::array<float,2>{0.0450142659f, 0.982905149f},
-std::array<float,2>{0.990049481f, 0.803892553f},
-std::array<float,2>{0.235265061f, 0.37222299f},
-std::array<float,2>{0.70635885f, 0.207906276f},
-std::array<float,2>{0.367540151f, 0.674375534f},
-std::array<float,2>{0.954796672f, 0.657274783f},
-std::array<float,2>{0.212841779f, 0.202244297f},
-std::array<float,2>{0.749406517f, 0.351379782f},
-std::array<float,2>{0.327742636f, 0.795191884f},
-std::array<float,2>{0.530316472f, 0.987038672f},
-std::array<float,2>{0.384460181f, 0.448346645f},
-std::array<float,2>{0.82194221f, 0.112085588f},
-std::array<float,2>{0.0104373526f, 0.589682579f},
-std::array<float,2>{0.639103234f, 0.522366762f},
-std::array<float,2>{0.29992485f, 0.0154893929f},
-std::array<float,2>{0.905668795f, 0.375005454f},
-std::array<float,2>{0.168957144f, 0.876609147f},
-std::array<float,2>{0.810862958f, 0.832554936f},
-std::array<float,2>{0.0857836008f, 0.289927661f},
-std::array<float,2>{0.622877359f, 0.157041192f},
-std::array<float,2>{0.464152992f, 0.743413091f},
-std::array<float,2>{0.862442315f, 0.624686778f},
-std::array<float,2>{0.0619778f, 0.0790139511f},
-std::array<float,2>{0.544852316f, 0.475458205f},
-std::array<float,2>{0.422385901f, 0.958015442f},
-std::array<float,2>{0.70113039f, 0.76203084f},
-std::array<float,2>{0.352808714f, 0.31280303f},
-std::array<float,2>{0.970161676f, 0.222440049f},
-std::array<float,2>{0.225557506f, 0.644807041f},
-std::array<float,2>{0.574940622f, 0.701502144f},
-std::array<float,2>{0.471508414f, 0.136330366f},
-std::array<float,2>{0.750164092f, 0.255657017f},
-std::array<float,2>{0.113629967f, 0.849906504f},
-std::array<float,2>{0.911739826f, 0.928625226f},
-std::array<float,2>{0.15509285f, 0.41771695f},
-std::array<float,2>{0.675540507f, 0.0382521227f},
-std::array<float,2>{0.277719021f, 0.550953031f},
-std::array<float,2>{0.974291027f, 0.503923953f},
-std::array<float,2>{0.22059986f, 0.0217567459f},
-std::array<float,2>{0.698614717f, 0.403115511f},
-std::array<float,2>{0.357540399f, 0.896637201f},
-std::array<float,2>{0.541668355f, 0.814891338f},
-std::array<float,2>{0.426198363f, 0.297907203f},
-std::array<float,2>{0.866995335f, 0.18376793f},
-std::array<float,2>{0.0565011837f, 0.730346024f},
-std::array<float,2>{0.678266644f, 0.682169318f},
-std::array<float,2>{0.274604619f, 0.211389691f},
-std::array<float,2>{0.90869081f, 0.363882452f},
-std::array<float,2>{0.150755182f, 0.805811703f},
-std::array<float,2>{0.755737424f, 0.96998632f},
-std::array<float,2>{0.111904912f, 0.45913437f},
-std::array<float,2>{0.574064136f, 0.0960698873f},
-std::array<float,2>{0.47324127f, 0.566038609f},
-std::array<float,2>{0.825165927f, 0.718345046f},
-std::array<float,2>{0.0125156883f, 0.145563677f},
-std::array<float,2>{0.523470044f, 0.270625532f},
-std::array<float,2>{0.386890739f, 0.859651089f},
-std::array<float,2>{0.742322087f, 0.911594868f},
-std::array<float,2>{0.321955383f, 0.42698881f},
-std::array<float,2>{0.958676875f, 0.0585362129f},
-std::array<float,2>{0.218389973f, 0.539661944f},
-std::array<float,2>{0.618728042f, 0.601884127f},
-std::array<float,2>{0.468048453f, 0.0775143653f},
-std::array<float,2>{0.808158159f, 0.486440778f},
-std::array<float,2>{0.0787782148f, 0.951716483f},
-std::array<float,2>{0.899225712f, 0.773263514f},
-std::array<float,2>{0.166238844f, 0.329263479f},
-std::array<float,2>{0.635778666f, 0.248133466f},
-std::array<float,2>{0.302342474f, 0.629359365f},
-std::array<float,2>{0.936582148f, 0.653775454f},
-std::array<float,2>{0.140429437f, 0.227152571f},
-std::array<float,2>{0.658736408f, 0.323170632f},
-std::array<float,2>{0.257104456f, 0.753210604f},
-std::array<float,2>{0.582589507f, 0.967313647f},
-std::array<float,2>{0.493395209f, 0.476884931f},
-std::array<float,2>{0.765878797f, 0.0933750048f},
-std::array<float,2>{0.105704337f, 0.610227048f},
-std::array<float,2>{0.709866107f, 0.560126424f},
-std::array<float,2>{0.374669671f, 0.0463899225f},
-std::array<float,2>{0.986454487f, 0.411071837f},
-std::array<float,2>{0.238354221f, 0.935875654f},
-std::array<float,2>{0.854066789f, 0.857703269f},
-std::array<float,2>{0.0421299748f, 0.26386407f},
-std::array<float,2>{0.54958564f, 0.125644132f},
-std::array<float,2>{0.411386818f, 0.688799798f},
-std::array<float,2>{0.794809401f, 0.581234336f},
-std::array<float,2>{0.077904731f, 0.122347295f},
-std::array<float,2>{0.5955109f, 0.43999663f},
-std::array<float,2>{0.442141742f, 0.994364858f},
-std::array<float,2>{0.654696286f, 0.781552792f},
-std::array<float,2>{0.284520537f, 0.358530462f},
-std::array<float,2>{0.884308875f, 0.194808304f},
-std::array<float,2>{0.183334917f, 0.668790102f},
-std::array<float,2>{0.50427562f, 0.739064276f},
-std::array<float,2>{0.402183235f, 0.171288401f},
-std::array<float,2>{0.829495788f, 0.286638975f},
-std::array<float,2>{0.0157786477f, 0.839749873f},
-std::array<float,2>{0.940234244f, 0.888952494f},
-std::array<float,2>{0.194980189f, 0.386009812f},
-std::array<float,2>{0.719810247f, 0.00608442631f},
-std::array<float,2>{0.329146922f, 0.529496372f},
-std::array<float,2>{0.875868738f, 0.617334843f},
-std::array<float,2>{0.179545239f, 0.0848404244f},
-std::array<float,2>{0.642907381f, 0.471189916f},
-std::array<float,2>{0.293619812f, 0.954120696f},
-std::array<float,2>{0.601658165f, 0.759051383f},
-std::array<float,2>{0.450326532f, 0.320186079f},
-std::array<float,2>{0.784689903f, 0.226437047f},
-std::array<float,2>{0.0641584396f, 0.644031584f},
-std::array<float,2>{0.727731466f, 0.698205948f},
-std::array<float,2>{0.339120418f, 0.138419911f},
-std::array<float,2>{0.946277142f, 0.250410557f},
-std::array<float,2>{0.1955695f, 0.847271562f},
-std::array<float,2>{0.842256784f, 0.922715724f},
-std::array<float,2>{0.0289000832f, 0.421509832f},
-std::array<float,2>{0.513210177f, 0.0332662053f},
-std::array<float,2>{0.392091662f, 0.546922326f},
-std::array<float,2>{0.779879808f, 0.663493693f},
-std::array<float,2>{0.098189868f, 0.198802695f},
-std::array<float,2>{0.588585019f, 0.344554543f},
-std::array<float,2>{0.485265732f, 0.789445996f},
-std::array<float,2>{0.667663574f, 0.989095449f},
-std::array<float,2>{0.264467239f, 0.451588005f},
-std::array<float,2>{0.927719533f, 0.114160515f},
-std::array<float,2>{0.128636539f, 0.590577185f},
-std::array<float,2>{0.561768472f, 0.518540561f},
-std::array<float,2>{0.419641614f, 0.00934256706f},
-std::array<float,2>{0.844454169f, 0.382006139f},
-std::array<float,2>{0.0334711112f, 0.87948674f},
-std::array<float,2>{0.999776661f, 0.831923366f},
-std::array<float,2>{0.249387383f, 0.293929785f},
-std::array<float,2>{0.718168139f, 0.160877913f},
-std::array<float,2>{0.363330245f, 0.748024583f},
-std::array<float,2>{0.968003511f, 0.718774974f},
-std::array<float,2>{0.203611702f, 0.176821291f},
-std::array<float,2>{0.7348153f, 0.30850184f},
-std::array<float,2>{0.316424757f, 0.827002108f},
-std::array<float,2>{0.520381212f, 0.905412912f},
-std::array<float,2>{0.380451381f, 0.395503074f},
-std::array<float,2>{0.815766752f, 0.0275721941f},
-std::array<float,2>{0.00314050657f, 0.509359598f},
-std::array<float,2>{0.626134098f, 0.571254492f},
-std::array<float,2>{0.308695972f, 0.102463908f},
-std::array<float,2>{0.897848725f, 0.467938364f},
-std::array<float,2>{0.163681716f, 0.978798866f},
-std::array<float,2>{0.798424244f, 0.799403667f},
-std::array<float,2>{0.0904231593f, 0.367216587f},
-std::array<float,2>{0.615312159f, 0.206678033f},
-std::array<float,2>{0.4590514f, 0.676991224f},
-std::array<float,2>{0.874486744f, 0.537169755f},
-std::array<float,2>{0.0530777648f, 0.0532577485f},
-std::array<float,2>{0.537519634f, 0.436187476f},
-std::array<float,2>{0.4309237f, 0.917910099f},
-std::array<float,2>{0.68889153f, 0.872407556f},
-std::array<float,2>{0.34845525f, 0.273670077f},
-std::array<float,2>{0.97810936f, 0.153204769f},
-std::array<float,2>{0.229576424f, 0.704624951f},
-std::array<float,2>{0.568300307f, 0.63656354f},
-std::array<float,2>{0.478394836f, 0.23736155f},
-std::array<float,2>{0.760090232f, 0.341215342f},
-std::array<float,2>{0.124897718f, 0.775241792f},
-std::array<float,2>{0.91497016f, 0.941952825f},
-std::array<float,2>{0.145082027f, 0.499356598f},
-std::array<float,2>{0.685118973f, 0.0655412823f},
-std::array<float,2>{0.266652882f, 0.601082027f},
-std::array<float,2>{0.9496333f, 0.569832385f},
-std::array<float,2>{0.199887276f, 0.100034155f},
-std::array<float,2>{0.731369972f, 0.453330845f},
-std::array<float,2>{0.341800719f, 0.973294139f},
-std::array<float,2>{0.509081244f, 0.811348855f},
-std::array<float,2>{0.395038724f, 0.360040158f},
-std::array<float,2>{0.838478088f, 0.21557717f},
-std::array<float,2>{0.027070798f, 0.684630752f},
-std::array<float,2>{0.645182788f, 0.733950973f},
-std::array<float,2>{0.289981514f, 0.182055265f},
-std::array<float,2>{0.882636368f, 0.303726345f},
-std::array<float,2>{0.174398899f, 0.818581283f},
-std::array<float,2>{0.786764622f, 0.89424926f},
-std::array<float,2>{0.0672049001f, 0.401309848f},
-std::array<float,2>{0.607367635f, 0.0165330302f},
-std::array<float,2>{0.446225613f, 0.50159502f},
-std::array<float,2>{0.851322532f, 0.628429592f},
-std::array<float,2>{0.0380646139f, 0.245521903f},
-std::array<float,2>{0.55699563f, 0.333050877f},
-std::array<float,2>{0.417137057f, 0.768445313f},
-std::array<float,2>{0.714319229f, 0.945536196f},
-std::array<float,2>{0.359552026f, 0.488896698f},
-std::array<float,2>{0.995157719f, 0.0738482326f},
-std::array<float,2>{0.242570058f, 0.608165562f},
-std::array<float,2>{0.591480076f, 0.545779884f},
-std::array<float,2>{0.4900271f, 0.06210256f},
-std::array<float,2>{0.776675224f, 0.422063947f},
-std::array<float,2>{0.0949080661f, 0.908601582f},
-std::array<float,2>{0.925248861f, 0.865509748f},
-std::array<float,2>{0.129437536f, 0.268312991f},
-std::array<float,2>{0.6713956f, 0.142239675f},
-std::array<float,2>{0.259956062f, 0.712029696f},
-std::array<float,2>{0.893642545f, 0.692872465f},
-std::array<float,2>{0.158773527f, 0.13027142f},
-std::array<float,2>{0.631568432f, 0.261019617f},
-std::array<float,2>{0.305505514f, 0.854447424f},
-std::array<float,2>{0.613088787f, 0.932305336f},
-std::array<float,2>{0.45658946f, 0.4063631f},
-std::array<float,2>{0.803613961f, 0.0400487445f},
-std::array<float,2>{0.0877130702f, 0.558079243f},
-std::array<float,2>{0.739401281f, 0.614190221f},
-std::array<float,2>{0.315805465f, 0.0884434879f},
-std::array<float,2>{0.964264512f, 0.48288697f},
-std::array<float,2>{0.20738627f, 0.963833213f},
-std::array<float,2>{0.820267975f, 0.757685661f},
-std::array<float,2>{0.00692555448f, 0.327391177f},
-std::array<float,2>{0.518941164f, 0.234328747f},
-std::array<float,2>{0.375314444f, 0.649683833f},
-std::array<float,2>{0.762796104f, 0.523919523f},
-std::array<float,2>{0.117262699f, 0.000596532947f},
-std::array<float,2>{0.564679444f, 0.388473511f},
-std::array<float,2>{0.481687576f, 0.884933174f},
-std::array<float,2>{0.682290316f, 0.840711474f},
-std::array<float,2>{0.2711353f, 0.283883661f},
-std::array<float,2>{0.921422839f, 0.166804582f},
-std::array<float,2>{0.142900258f, 0.737976909f},
-std::array<float,2>{0.531622946f, 0.665074289f},
-std::array<float,2>{0.433969468f, 0.1905981f},
-std::array<float,2>{0.868385017f, 0.353235751f},
-std::array<float,2>{0.0469591878f, 0.788146079f},
-std::array<float,2>{0.981673241f, 0.998049974f},
-std::array<float,2>{0.231558189f, 0.444789141f},
-std::array<float,2>{0.692414403f, 0.118432671f},
-std::array<float,2>{0.347384959f, 0.582472622f},
-std::array<float,2>{0.912787914f, 0.551975548f},
-std::array<float,2>{0.153084069f, 0.0378683098f},
-std::array<float,2>{0.672425091f, 0.416339189f},
-std::array<float,2>{0.279824048f, 0.929415762f},
-std::array<float,2>{0.577575266f, 0.850826561f},
-std::array<float,2>{0.469601721f, 0.254233688f},
-std::array<float,2>{0.753828406f, 0.135378852f},
-std::array<float,2>{0.11556273f, 0.702230334f},
-std::array<float,2>{0.701423168f, 0.646375656f},
-std::array<float,2>{0.35535416f, 0.220750555f},
-std::array<float,2>{0.970859289f, 0.313816845f},
-std::array<float,2>{0.223444968f, 0.763151765f},
-std::array<float,2>{0.859713495f, 0.957482398f},
-std::array<float,2>{0.0598044544f, 0.476061553f},
-std::array<float,2>{0.545436203f, 0.0796694458f},
-std::array<float,2>{0.425428152f, 0.623719871f},
-std::array<float,2>{0.810131192f, 0.742649198f},
-std::array<float,2>{0.0827362686f, 0.157301322f},
-std::array<float,2>{0.623299181f, 0.290202081f},
-std::array<float,2>{0.462347835f, 0.833866119f},
-std::array<float,2>{0.637037992f, 0.875053763f},
-std::array<float,2>{0.297707826f, 0.376812249f},
-std::array<float,2>{0.903269887f, 0.0143519351f},
-std::array<float,2>{0.171465695f, 0.52258575f},
-std::array<float,2>{0.528778493f, 0.587995648f},
-std::array<float,2>{0.385284007f, 0.11276678f},
-std::array<float,2>{0.82236594f, 0.447855085f},
-std::array<float,2>{0.00966397952f, 0.987429202f},
-std::array<float,2>{0.955682635f, 0.796376467f},
-std::array<float,2>{0.214258268f, 0.350385249f},
-std::array<float,2>{0.747335076f, 0.201447546f},
-std::array<float,2>{0.325611711f, 0.656876028f},
-std::array<float,2>{0.990239978f, 0.675299525f},
-std::array<float,2>{0.237785399f, 0.208884522f},
-std::array<float,2>{0.704387307f, 0.371977687f},
-std::array<float,2>{0.370668858f, 0.803403497f},
-std::array<float,2>{0.55370146f, 0.983848333f},
-std::array<float,2>{0.407040447f, 0.462907851f},
-std::array<float,2>{0.855560899f, 0.107378095f},
-std::array<float,2>{0.0437855124f, 0.577305198f},
-std::array<float,2>{0.66156143f, 0.515091121f},
-std::array<float,2>{0.250189751f, 0.0250526033f},
-std::array<float,2>{0.931788623f, 0.391366392f},
-std::array<float,2>{0.136428609f, 0.898791254f},
-std::array<float,2>{0.769774079f, 0.822654963f},
-std::array<float,2>{0.105429158f, 0.311515868f},
-std::array<float,2>{0.579470277f, 0.173376486f},
-std::array<float,2>{0.49762401f, 0.723248422f},
-std::array<float,2>{0.832796693f, 0.596215904f},
-std::array<float,2>{0.0218081214f, 0.0690532476f},
-std::array<float,2>{0.502414525f, 0.49433893f},
-std::array<float,2>{0.403617382f, 0.941158772f},
-std::array<float,2>{0.726138175f, 0.778780162f},
-std::array<float,2>{0.334934086f, 0.339527398f},
-std::array<float,2>{0.942875862f, 0.242073223f},
-std::array<float,2>{0.188725486f, 0.637851596f},
-std::array<float,2>{0.598429799f, 0.708269f},
-std::array<float,2>{0.438055992f, 0.149647042f},
-std::array<float,2>{0.791499674f, 0.279382229f},
-std::array<float,2>{0.0714464188f, 0.867683053f},
-std::array<float,2>{0.888259828f, 0.919851363f},
-std::array<float,2>{0.186480328f, 0.43295902f},
-std::array<float,2>{0.65129745f, 0.0490523316f},
-std::array<float,2>{0.28719154f, 0.533915937f},
-std::array<float,2>{0.959922731f, 0.541134894f},
-std::array<float,2>{0.215974808f, 0.0560338423f},
-std::array<float,2>{0.745389879f, 0.428199679f},
-std::array<float,2>{0.324030489f, 0.913583577f},
-std::array<float,2>{0.525749385f, 0.862602949f},
-std::array<float,2>{0.390293241f, 0.273286492f},
-std::array<float,2>{0.828051984f, 0.147773743f},
-std::array<float,2>{0.0147871841f, 0.715368211f},
-std::array<float,2>{0.63461405f, 0.632560909f},
-std::array<float,2>{0.302989095f, 0.246954843f},
-std::array<float,2>{0.901952744f, 0.331779331f},
-std::array<float,2>{0.165757671f, 0.77040267f},
-std::array<float,2>{0.806308508f, 0.949333131f},
-std::array<float,2>{0.0816684142f, 0.485973775f},
-std::array<float,2>{0.619353056f, 0.0748064518f},
-std::array<float,2>{0.465202659f, 0.605159998f},
-std::array<float,2>{0.863437831f, 0.727456868f},
-std::array<float,2>{0.0578115582f, 0.187321782f},
-std::array<float,2>{0.540654123f, 0.299553156f},
-std::array<float,2>{0.428136528f, 0.812845886f},
-std::array<float,2>{0.695467651f, 0.89505142f},
-std::array<float,2>{0.355499476f, 0.405220956f},
-std::array<float,2>{0.975027621f, 0.0196102262f},
-std::array<float,2>{0.222539723f, 0.507045507f},
-std::array<float,2>{0.572074652f, 0.563378036f},
-std::array<float,2>{0.476533115f, 0.0950769112f},
-std::array<float,2>{0.756357789f, 0.457555354f},
-std::array<float,2>{0.109696262f, 0.971558034f},
-std::array<float,2>{0.907687187f, 0.807464778f},
-std::array<float,2>{0.148641303f, 0.366723508f},
-std::array<float,2>{0.677518964f, 0.21367158f},
-std::array<float,2>{0.275722593f, 0.681412518f},
-std::array<float,2>{0.885200322f, 0.671547532f},
-std::array<float,2>{0.181530386f, 0.192502618f},
-std::array<float,2>{0.652730703f, 0.3565301f},
-std::array<float,2>{0.281669408f, 0.783527076f},
-std::array<float,2>{0.596318007f, 0.992501259f},
-std::array<float,2>{0.444593698f, 0.438301057f},
-std::array<float,2>{0.796443403f, 0.123342477f},
-std::array<float,2>{0.0751994401f, 0.57882452f},
-std::array<float,2>{0.722167909f, 0.527463198f},
-std::array<float,2>{0.331104845f, 0.0048179552f},
-std::array<float,2>{0.939427018f, 0.383064777f},
-std::array<float,2>{0.191505611f, 0.887969315f},
-std::array<float,2>{0.831913114f, 0.83726573f},
-std::array<float,2>{0.018519178f, 0.288795233f},
-std::array<float,2>{0.506113589f, 0.169367105f},
-std::array<float,2>{0.399335057f, 0.741017044f},
-std::array<float,2>{0.769317448f, 0.612284124f},
-std::array<float,2>{0.108332321f, 0.090534851f},
-std::array<float,2>{0.585515916f, 0.479902118f},
-std::array<float,2>{0.494428217f, 0.965418637f},
-std::array<float,2>{0.657381594f, 0.750299096f},
-std::array<float,2>{0.25564748f, 0.321926117f},
-std::array<float,2>{0.934264123f, 0.229035228f},
-std::array<float,2>{0.137172759f, 0.65617305f},
-std::array<float,2>{0.548825741f, 0.690012157f},
-std::array<float,2>{0.412372321f, 0.128401741f},
-std::array<float,2>{0.851841927f, 0.263117194f},
-std::array<float,2>{0.0390868559f, 0.857017159f},
-std::array<float,2>{0.986242831f, 0.934235096f},
-std::array<float,2>{0.241158962f, 0.412635684f},
-std::array<float,2>{0.707921863f, 0.0439631529f},
-std::array<float,2>{0.372338027f, 0.561074197f},
-std::array<float,2>{0.928934455f, 0.592539191f},
-std::array<float,2>{0.126069918f, 0.11557167f},
-std::array<float,2>{0.665296733f, 0.450980037f},
-std::array<float,2>{0.263512164f, 0.990667999f},
-std::array<float,2>{0.586537421f, 0.791408777f},
-std::array<float,2>{0.486693859f, 0.346608162f},
-std::array<float,2>{0.778644145f, 0.196674347f},
-std::array<float,2>{0.10035865f, 0.661443412f},
-std::array<float,2>{0.716332674f, 0.748222113f},
-std::array<float,2>{0.365666717f, 0.163218826f},
-std::array<float,2>{0.996888995f, 0.295348406f},
-std::array<float,2>{0.2463056f, 0.829097271f},
-std::array<float,2>{0.84637028f, 0.882342577f},
-std::array<float,2>{0.0314072222f, 0.380814582f},
-std::array<float,2>{0.559027612f, 0.0112519218f},
-std::array<float,2>{0.420280546f, 0.5171929f},
-std::array<float,2>{0.782193601f, 0.64245075f},
-std::array<float,2>{0.0648109242f, 0.223007664f},
-std::array<float,2>{0.604609728f, 0.316783339f},
-std::array<float,2>{0.452944607f, 0.76056844f},
-std::array<float,2>{0.64174068f, 0.955721259f},
-std::array<float,2>{0.295735061f, 0.469682455f},
-std::array<float,2>{0.8773821f, 0.0838495865f},
-std::array<float,2>{0.176528692f, 0.619242132f},
-std::array<float,2>{0.515038848f, 0.549150348f},
-std::array<float,2>{0.392597616f, 0.0317259282f},
-std::array<float,2>{0.840085685f, 0.419733018f},
-std::array<float,2>{0.0308827348f, 0.925228536f},
-std::array<float,2>{0.949031174f, 0.845502973f},
-std::array<float,2>{0.197781399f, 0.252645403f},
-std::array<float,2>{0.730054677f, 0.13975212f},
-std::array<float,2>{0.335977465f, 0.696538329f},
-std::array<float,2>{0.98011744f, 0.705522299f},
-std::array<float,2>{0.227189273f, 0.155400008f},
-std::array<float,2>{0.69030875f, 0.276297659f},
-std::array<float,2>{0.350629061f, 0.874020576f},
-std::array<float,2>{0.535214305f, 0.915313184f},
-std::array<float,2>{0.433385551f, 0.435225576f},
-std::array<float,2>{0.871489346f, 0.0522633754f},
-std::array<float,2>{0.0522670858f, 0.536337674f},
-std::array<float,2>{0.687056005f, 0.598014295f},
-std::array<float,2>{0.267727017f, 0.0643665791f},
-std::array<float,2>{0.916321814f, 0.497964293f},
-std::array<float,2>{0.146705031f, 0.944314837f},
-std::array<float,2>{0.759314477f, 0.776291847f},
-std::array<float,2>{0.122312985f, 0.342785865f},
-std::array<float,2>{0.570076048f, 0.235405624f},
-std::array<float,2>{0.479809046f, 0.632956803f},
-std::array<float,2>{0.813388646f, 0.511542976f},
-std::array<float,2>{0.00022981377f, 0.0298953839f},
-std::array<float,2>{0.522611141f, 0.398219466f},
-std::array<float,2>{0.381352663f, 0.903677881f},
-std::array<float,2>{0.736593544f, 0.825106919f},
-std::array<float,2>{0.318702012f, 0.306213528f},
-std::array<float,2>{0.966260612f, 0.179406464f},
-std::array<float,2>{0.206494972f, 0.722470641f},
-std::array<float,2>{0.614152253f, 0.678305984f},
-std::array<float,2>{0.458226681f, 0.203783929f},
-std::array<float,2>{0.800583482f, 0.369829535f},
-std::array<float,2>{0.0934766084f, 0.798789918f},
-std::array<float,2>{0.896387696f, 0.977363408f},
-std::array<float,2>{0.160993263f, 0.466747642f},
-std::array<float,2>{0.627977371f, 0.105283678f},
-std::array<float,2>{0.310930848f, 0.572786808f},
-std::array<float,2>{0.992340446f, 0.606177568f},
-std::array<float,2>{0.245249733f, 0.0709004626f},
-std::array<float,2>{0.711690545f, 0.491491884f},
-std::array<float,2>{0.361376196f, 0.948825479f},
-std::array<float,2>{0.555148959f, 0.766126037f},
-std::array<float,2>{0.415608019f, 0.334454536f},
-std::array<float,2>{0.849032044f, 0.242404938f},
-std::array<float,2>{0.0368113741f, 0.625504613f},
-std::array<float,2>{0.669743598f, 0.713689804f},
-std::array<float,2>{0.25812611f, 0.14434512f},
-std::array<float,2>{0.922046781f, 0.267072082f},
-std::array<float,2>{0.131995231f, 0.864535272f},
-std::array<float,2>{0.773508251f, 0.907512724f},
-std::array<float,2>{0.0975732207f, 0.424005985f},
-std::array<float,2>{0.592794478f, 0.0604452416f},
-std::array<float,2>{0.491208851f, 0.543842316f},
-std::array<float,2>{0.837427855f, 0.686386108f},
-std::array<float,2>{0.0247043837f, 0.217980802f},
-std::array<float,2>{0.510658145f, 0.361555398f},
-std::array<float,2>{0.396895945f, 0.808992803f},
-std::array<float,2>{0.733842731f, 0.975577414f},
-std::array<float,2>{0.340044171f, 0.456133485f},
-std::array<float,2>{0.952538848f, 0.0993837491f},
-std::array<float,2>{0.202303201f, 0.567726791f},
-std::array<float,2>{0.607732356f, 0.502741039f},
-std::array<float,2>{0.448710084f, 0.0179592464f},
-std::array<float,2>{0.788737953f, 0.398893863f},
-std::array<float,2>{0.0698592439f, 0.891266108f},
-std::array<float,2>{0.880365908f, 0.818012178f},
-std::array<float,2>{0.171883464f, 0.3019633f},
-std::array<float,2>{0.648185492f, 0.181214735f},
-std::array<float,2>{0.291479915f, 0.730952621f},
-std::array<float,2>{0.919297695f, 0.734416842f},
-std::array<float,2>{0.141722098f, 0.165483207f},
-std::array<float,2>{0.680156708f, 0.282179207f},
-std::array<float,2>{0.272335738f, 0.842275083f},
-std::array<float,2>{0.563051462f, 0.883192778f},
-std::array<float,2>{0.483333379f, 0.389458328f},
-std::array<float,2>{0.764083624f, 0.00341537129f},
-std::array<float,2>{0.119183719f, 0.526991248f},
-std::array<float,2>{0.693864465f, 0.585483134f},
-std::array<float,2>{0.344860166f, 0.119436085f},
-std::array<float,2>{0.98407048f, 0.442547023f},
-std::array<float,2>{0.23386915f, 0.997509897f},
-std::array<float,2>{0.86936003f, 0.786007345f},
-std::array<float,2>{0.0493392311f, 0.355100453f},
-std::array<float,2>{0.534420431f, 0.187739342f},
-std::array<float,2>{0.436391413f, 0.666496694f},
-std::array<float,2>{0.80164969f, 0.556464314f},
-std::array<float,2>{0.0881834999f, 0.0425281785f},
-std::array<float,2>{0.61061573f, 0.409839451f},
-std::array<float,2>{0.45500657f, 0.929939747f},
-std::array<float,2>{0.629301369f, 0.852252185f},
-std::array<float,2>{0.307415962f, 0.2590819f},
-std::array<float,2>{0.890713573f, 0.132798851f},
-std::array<float,2>{0.156679928f, 0.694237113f},
-std::array<float,2>{0.516603112f, 0.651149809f},
-std::array<float,2>{0.37747851f, 0.231197581f},
-std::array<float,2>{0.816880703f, 0.325006247f},
-std::array<float,2>{0.00526075764f, 0.754818618f},
-std::array<float,2>{0.962556362f, 0.962811112f},
-std::array<float,2>{0.210376933f, 0.481895179f},
-std::array<float,2>{0.740915477f, 0.086660035f},
-std::array<float,2>{0.314116657f, 0.617070019f},
-std::array<float,2>{0.904572487f, 0.520682096f},
-std::array<float,2>{0.168539584f, 0.012474631f},
-std::array<float,2>{0.640126467f, 0.378860474f},
-std::array<float,2>{0.299168259f, 0.877486229f},
-std::array<float,2>{0.62111181f, 0.834921241f},
-std::array<float,2>{0.463111401f, 0.291325361f},
-std::array<float,2>{0.812470317f, 0.158856466f},
-std::array<float,2>{0.0841817334f, 0.744213521f},
-std::array<float,2>{0.748756945f, 0.659677982f},
-std::array<float,2>{0.326309621f, 0.199527875f},
-std::array<float,2>{0.953408182f, 0.348450363f},
-std::array<float,2>{0.21122846f, 0.794119179f},
-std::array<float,2>{0.820459485f, 0.98529911f},
-std::array<float,2>{0.0107975099f, 0.445617646f},
-std::array<float,2>{0.529827416f, 0.110476159f},
-std::array<float,2>{0.382946044f, 0.587284505f},
-std::array<float,2>{0.751539409f, 0.700326502f},
-std::array<float,2>{0.114327215f, 0.133297816f},
-std::array<float,2>{0.575868964f, 0.256931871f},
-std::array<float,2>{0.471975595f, 0.848822415f},
-std::array<float,2>{0.674682379f, 0.927291274f},
-std::array<float,2>{0.279099494f, 0.41550833f},
-std::array<float,2>{0.910399437f, 0.0366959013f},
-std::array<float,2>{0.156023577f, 0.553579807f},
-std::array<float,2>{0.543919265f, 0.621617973f},
-std::array<float,2>{0.423230499f, 0.0813569576f},
-std::array<float,2>{0.862127364f, 0.473201185f},
-std::array<float,2>{0.0606134087f, 0.960929275f},
-std::array<float,2>{0.968842924f, 0.763775766f},
-std::array<float,2>{0.225604147f, 0.315994948f},
-std::array<float,2>{0.699780762f, 0.219851688f},
-std::array<float,2>{0.351780295f, 0.647307277f},
-std::array<float,2>{0.94385469f, 0.639633238f},
-std::array<float,2>{0.190278426f, 0.23886326f},
-std::array<float,2>{0.723199308f, 0.337034792f},
-std::array<float,2>{0.332931876f, 0.779798031f},
-std::array<float,2>{0.500870943f, 0.938507259f},
-std::array<float,2>{0.405163556f, 0.493384033f},
-std::array<float,2>{0.834883749f, 0.0679085106f},
-std::array<float,2>{0.0211096983f, 0.59386903f},
-std::array<float,2>{0.648569882f, 0.531856358f},
-std::array<float,2>{0.285233974f, 0.0468762405f},
-std::array<float,2>{0.889086723f, 0.430904627f},
-std::array<float,2>{0.184846938f, 0.921539724f},
-std::array<float,2>{0.78963542f, 0.869744897f},
-std::array<float,2>{0.0728577897f, 0.277773112f},
-std::array<float,2>{0.599772036f, 0.151724339f},
-std::array<float,2>{0.441215992f, 0.709372163f},
-std::array<float,2>{0.858496249f, 0.575900018f},
-std::array<float,2>{0.0461800471f, 0.109317638f},
-std::array<float,2>{0.550952852f, 0.461674839f},
-std::array<float,2>{0.409945488f, 0.981415331f},
-std::array<float,2>{0.705089927f, 0.801876247f},
-std::array<float,2>{0.368183732f, 0.374442488f},
-std::array<float,2>{0.98911041f, 0.210442066f},
-std::array<float,2>{0.235400319f, 0.672282338f},
-std::array<float,2>{0.580800593f, 0.725988269f},
-std::array<float,2>{0.499916941f, 0.175038412f},
-std::array<float,2>{0.771524429f, 0.31042105f},
-std::array<float,2>{0.101807781f, 0.82079339f},
-std::array<float,2>{0.930262387f, 0.900424361f},
-std::array<float,2>{0.133825034f, 0.39358601f},
-std::array<float,2>{0.662231088f, 0.0256755091f},
-std::array<float,2>{0.252649248f, 0.512922525f},
-std::array<float,2>{0.97766912f, 0.5367167f},
-std::array<float,2>{0.230468556f, 0.0522400364f},
-std::array<float,2>{0.689276159f, 0.434754223f},
-std::array<float,2>{0.34809801f, 0.91560936f},
-std::array<float,2>{0.537649214f, 0.873053908f},
-std::array<float,2>{0.431442201f, 0.275581032f},
-std::array<float,2>{0.874865949f, 0.155827865f},
-std::array<float,2>{0.0532899387f, 0.705941558f},
-std::array<float,2>{0.684655488f, 0.633788764f},
-std::array<float,2>{0.26756224f, 0.236208096f},
-std::array<float,2>{0.914107203f, 0.343617976f},
-std::array<float,2>{0.14472717f, 0.775578618f},
-std::array<float,2>{0.760538697f, 0.9434672f},
-std::array<float,2>{0.124040969f, 0.497346163f},
-std::array<float,2>{0.567459643f, 0.0638252944f},
-std::array<float,2>{0.477817088f, 0.598259151f},
-std::array<float,2>{0.816191018f, 0.722042441f},
-std::array<float,2>{0.00387873454f, 0.178862214f},
-std::array<float,2>{0.51993674f, 0.306105226f},
-std::array<float,2>{0.379996896f, 0.82463336f},
-std::array<float,2>{0.735332131f, 0.90383321f},
-std::array<float,2>{0.317268223f, 0.397631228f},
-std::array<float,2>{0.968421102f, 0.0296677016f},
-std::array<float,2>{0.20369409f, 0.511032224f},
-std::array<float,2>{0.615784764f, 0.572562337f},
-std::array<float,2>{0.459697068f, 0.104734868f},
-std::array<float,2>{0.797996938f, 0.46625632f},
-std::array<float,2>{0.0898888931f, 0.976914942f},
-std::array<float,2>{0.898371458f, 0.798072994f},
-std::array<float,2>{0.163471863f, 0.369567633f},
-std::array<float,2>{0.626711071f, 0.203334898f},
-std::array<float,2>{0.309219122f, 0.67797786f},
-std::array<float,2>{0.926845431f, 0.66179955f},
-std::array<float,2>{0.128019422f, 0.196945637f},
-std::array<float,2>{0.667299032f, 0.346068114f},
-std::array<float,2>{0.264129192f, 0.791558206f},
-std::array<float,2>{0.588096917f, 0.991182625f},
-std::array<float,2>{0.48441124f, 0.450542122f},
-std::array<float,2>{0.77955389f, 0.115973547f},
-std::array<float,2>{0.0981092975f, 0.592204511f},
-std::array<float,2>{0.718546867f, 0.516621768f},
-std::array<float,2>{0.363771558f, 0.0107840346f},
-std::array<float,2>{0.999217927f, 0.380129158f},
-std::array<float,2>{0.249564424f, 0.882257581f},
-std::array<float,2>{0.844098687f, 0.828330576f},
-std::array<float,2>{0.0341500342f, 0.2955634f},
-std::array<float,2>{0.562383413f, 0.163855985f},
-std::array<float,2>{0.419187456f, 0.749000371f},
-std::array<float,2>{0.784494758f, 0.619702041f},
-std::array<float,2>{0.0636402965f, 0.0830995664f},
-std::array<float,2>{0.602091849f, 0.468969047f},
-std::array<float,2>{0.450719476f, 0.955409169f},
-std::array<float,2>{0.643229425f, 0.760229826f},
-std::array<float,2>{0.293171257f, 0.31711334f},
-std::array<float,2>{0.875245512f, 0.223165199f},
-std::array<float,2>{0.178728104f, 0.64169693f},
-std::array<float,2>{0.51312834f, 0.697081983f},
-std::array<float,2>{0.391985565f, 0.140377074f},
-std::array<float,2>{0.842434168f, 0.251958072f},
-std::array<float,2>{0.028454477f, 0.845096648f},
-std::array<float,2>{0.945321679f, 0.925779462f},
-std::array<float,2>{0.195931107f, 0.419171572f},
-std::array<float,2>{0.728079796f, 0.0319006853f},
-std::array<float,2>{0.339493632f, 0.549414039f},
-std::array<float,2>{0.884102345f, 0.578267157f},
-std::array<float,2>{0.182768673f, 0.123676628f},
-std::array<float,2>{0.655054629f, 0.437526703f},
-std::array<float,2>{0.284871608f, 0.993012607f},
-std::array<float,2>{0.595131576f, 0.784172058f},
-std::array<float,2>{0.441711277f, 0.35716176f},
-std::array<float,2>{0.7940256f, 0.193098098f},
-std::array<float,2>{0.0774990618f, 0.671172142f},
-std::array<float,2>{0.720370591f, 0.740673304f},
-std::array<float,2>{0.329980224f, 0.16950798f},
-std::array<float,2>{0.939565599f, 0.288137943f},
-std::array<float,2>{0.194434091f, 0.837734461f},
-std::array<float,2>{0.829659462f, 0.888638914f},
-std::array<float,2>{0.016509667f, 0.383601964f},
-std::array<float,2>{0.50487119f, 0.00425648876f},
-std::array<float,2>{0.401428282f, 0.528025329f},
-std::array<float,2>{0.766552687f, 0.655384004f},
-std::array<float,2>{0.106436715f, 0.22883153f},
-std::array<float,2>{0.582261801f, 0.321558028f},
-std::array<float,2>{0.493992835f, 0.750781775f},
-std::array<float,2>{0.658245742f, 0.964876533f},
-std::array<float,2>{0.257723212f, 0.480301619f},
-std::array<float,2>{0.937302649f, 0.0901440755f},
-std::array<float,2>{0.139807612f, 0.61162293f},
-std::array<float,2>{0.548922002f, 0.560946882f},
-std::array<float,2>{0.41178143f, 0.0446056239f},
-std::array<float,2>{0.853867173f, 0.412269264f},
-std::array<float,2>{0.0425384752f, 0.933788419f},
-std::array<float,2>{0.987057924f, 0.856912613f},
-std::array<float,2>{0.239129871f, 0.263636887f},
-std::array<float,2>{0.709472418f, 0.12886335f},
-std::array<float,2>{0.374075621f, 0.689684153f},
-std::array<float,2>{0.958378017f, 0.715140402f},
-std::array<float,2>{0.21821636f, 0.148196608f},
-std::array<float,2>{0.743080497f, 0.272743821f},
-std::array<float,2>{0.321583092f, 0.863110363f},
-std::array<float,2>{0.524294078f, 0.913302898f},
-std::array<float,2>{0.387542337f, 0.428532988f},
-std::array<float,2>{0.824293494f, 0.0564422458f},
-std::array<float,2>{0.0118007325f, 0.541876912f},
-std::array<float,2>{0.636314809f, 0.604945898f},
-std::array<float,2>{0.301811904f, 0.074349843f},
-std::array<float,2>{0.898580432f, 0.485393167f},
-std::array<float,2>{0.166781411f, 0.950181842f},
-std::array<float,2>{0.80797869f, 0.769679785f},
-std::array<float,2>{0.0781834498f, 0.331152201f},
-std::array<float,2>{0.618576944f, 0.246378675f},
-std::array<float,2>{0.468518645f, 0.632093906f},
-std::array<float,2>{0.866219282f, 0.507756889f},
-std::array<float,2>{0.0557748154f, 0.0201730318f},
-std::array<float,2>{0.541196406f, 0.404685915f},
-std::array<float,2>{0.426313579f, 0.894579411f},
-std::array<float,2>{0.698741794f, 0.81315285f},
-std::array<float,2>{0.358297795f, 0.299281597f},
-std::array<float,2>{0.974007726f, 0.186689958f},
-std::array<float,2>{0.220099181f, 0.726719499f},
-std::array<float,2>{0.573684096f, 0.680932164f},
-std::array<float,2>{0.47312519f, 0.213332221f},
-std::array<float,2>{0.755228519f, 0.366615951f},
-std::array<float,2>{0.111500911f, 0.80695653f},
-std::array<float,2>{0.908891261f, 0.970979273f},
-std::array<float,2>{0.151235029f, 0.457055688f},
-std::array<float,2>{0.677831769f, 0.0954460874f},
-std::array<float,2>{0.275352895f, 0.562942982f},
-std::array<float,2>{0.942681193f, 0.594640613f},
-std::array<float,2>{0.189310685f, 0.0676139221f},
-std::array<float,2>{0.725692809f, 0.493897915f},
-std::array<float,2>{0.33430022f, 0.939364851f},
-std::array<float,2>{0.502747774f, 0.77957499f},
-std::array<float,2>{0.404053092f, 0.337690115f},
-std::array<float,2>{0.832255244f, 0.23832576f},
-std::array<float,2>{0.0221622344f, 0.638692737f},
-std::array<float,2>{0.650760293f, 0.709860504f},
-std::array<float,2>{0.287989497f, 0.152142152f},
-std::array<float,2>{0.887939751f, 0.278214455f},
-std::array<float,2>{0.185557753f, 0.869392633f},
-std::array<float,2>{0.791612029f, 0.921236694f},
-std::array<float,2>{0.0718344748f, 0.431553811f},
-std::array<float,2>{0.598091185f, 0.047441259f},
-std::array<float,2>{0.437605441f, 0.531312108f},
-std::array<float,2>{0.856166184f, 0.672821999f},
-std::array<float,2>{0.0433830842f, 0.210687295f},
-std::array<float,2>{0.553048909f, 0.374804974f},
-std::array<float,2>{0.406281978f, 0.802495837f},
-std::array<float,2>{0.70485431f, 0.980580688f},
-std::array<float,2>{0.370370805f, 0.461293727f},
-std::array<float,2>{0.991071999f, 0.108489886f},
-std::array<float,2>{0.237933695f, 0.575503528f},
-std::array<float,2>{0.579761147f, 0.513387382f},
-std::array<float,2>{0.497161478f, 0.0260004308f},
-std::array<float,2>{0.770267844f, 0.394306779f},
-std::array<float,2>{0.104529426f, 0.901231825f},
-std::array<float,2>{0.932190597f, 0.821122527f},
-std::array<float,2>{0.136093482f, 0.30976969f},
-std::array<float,2>{0.661978245f, 0.175491676f},
-std::array<float,2>{0.250615835f, 0.726311982f},
-std::array<float,2>{0.902387202f, 0.744842052f},
-std::array<float,2>{0.171219677f, 0.158230245f},
-std::array<float,2>{0.637440205f, 0.29178533f},
-std::array<float,2>{0.297080219f, 0.834376454f},
-std::array<float,2>{0.623659253f, 0.877337575f},
-std::array<float,2>{0.46240437f, 0.378359258f},
-std::array<float,2>{0.810003579f, 0.0121104484f},
-std::array<float,2>{0.082279034f, 0.521249235f},
-std::array<float,2>{0.747784674f, 0.587709665f},
-std::array<float,2>{0.325847596f, 0.111273974f},
-std::array<float,2>{0.955534279f, 0.446268559f},
-std::array<float,2>{0.214403555f, 0.984608948f},
-std::array<float,2>{0.823150873f, 0.794556916f},
-std::array<float,2>{0.00910977833f, 0.347908735f},
-std::array<float,2>{0.528892457f, 0.199767247f},
-std::array<float,2>{0.385212153f, 0.659243703f},
-std::array<float,2>{0.753052711f, 0.553155124f},
-std::array<float,2>{0.115963496f, 0.0364135429f},
-std::array<float,2>{0.5776425f, 0.415587574f},
-std::array<float,2>{0.469199121f, 0.926922262f},
-std::array<float,2>{0.671939552f, 0.849427104f},
-std::array<float,2>{0.279609174f, 0.257594019f},
-std::array<float,2>{0.912514746f, 0.133374572f},
-std::array<float,2>{0.152463675f, 0.700961471f},
-std::array<float,2>{0.545382738f, 0.646820605f},
-std::array<float,2>{0.425114751f, 0.220492095f},
-std::array<float,2>{0.860303164f, 0.315653056f},
-std::array<float,2>{0.0604902357f, 0.7642349f},
-std::array<float,2>{0.971572697f, 0.960396528f},
-std::array<float,2>{0.222830966f, 0.472819805f},
-std::array<float,2>{0.701962531f, 0.0815591663f},
-std::array<float,2>{0.35484004f, 0.621488094f},
-std::array<float,2>{0.921201944f, 0.52637291f},
-std::array<float,2>{0.143437311f, 0.00355615607f},
-std::array<float,2>{0.681907713f, 0.38893351f},
-std::array<float,2>{0.270674348f, 0.883743405f},
-std::array<float,2>{0.5651173f, 0.842735827f},
-std::array<float,2>{0.482262403f, 0.281410903f},
-std::array<float,2>{0.763295472f, 0.165672839f},
-std::array<float,2>{0.117954582f, 0.734970987f},
-std::array<float,2>{0.693076372f, 0.66657114f},
-std::array<float,2>{0.346957237f, 0.188124403f},
-std::array<float,2>{0.982208133f, 0.354902536f},
-std::array<float,2>{0.23205404f, 0.785259545f},
-std::array<float,2>{0.868806839f, 0.997758687f},
-std::array<float,2>{0.047708407f, 0.442968905f},
-std::array<float,2>{0.531742275f, 0.119834296f},
-std::array<float,2>{0.434281766f, 0.585170627f},
-std::array<float,2>{0.803037643f, 0.693565667f},
-std::array<float,2>{0.087391451f, 0.132268965f},
-std::array<float,2>{0.612361073f, 0.25966385f},
-std::array<float,2>{0.456335008f, 0.851966739f},
-std::array<float,2>{0.630909562f, 0.930225432f},
-std::array<float,2>{0.304981261f, 0.409193486f},
-std::array<float,2>{0.894084573f, 0.0424212813f},
-std::array<float,2>{0.158683434f, 0.55577141f},
-std::array<float,2>{0.519527853f, 0.616399765f},
-std::array<float,2>{0.375892729f, 0.086364314f},
-std::array<float,2>{0.819729567f, 0.48227948f},
-std::array<float,2>{0.00780737121f, 0.961935818f},
-std::array<float,2>{0.964806437f, 0.754275203f},
-std::array<float,2>{0.207698449f, 0.324681967f},
-std::array<float,2>{0.73975575f, 0.230632886f},
-std::array<float,2>{0.315920591f, 0.650434315f},
-std::array<float,2>{0.995680034f, 0.625199974f},
-std::array<float,2>{0.242943615f, 0.243045941f},
-std::array<float,2>{0.714703798f, 0.334624559f},
-std::array<float,2>{0.359942168f, 0.76606065f},
-std::array<float,2>{0.557227731f, 0.948708415f},
-std::array<float,2>{0.417860031f, 0.49189055f},
-std::array<float,2>{0.851062953f, 0.070600763f},
-std::array<float,2>{0.0371456333f, 0.605606675f},
-std::array<float,2>{0.671195149f, 0.54324019f},
-std::array<float,2>{0.260479063f, 0.059604913f},
-std::array<float,2>{0.925506055f, 0.424374312f},
-std::array<float,2>{0.129316106f, 0.907985628f},
-std::array<float,2>{0.77721101f, 0.865134537f},
-std::array<float,2>{0.0956550613f, 0.267504096f},
-std::array<float,2>{0.591275334f, 0.143736452f},
-std::array<float,2>{0.48948887f, 0.71290642f},
-std::array<float,2>{0.83818382f, 0.568281114f},
-std::array<float,2>{0.0265319459f, 0.0991149843f},
-std::array<float,2>{0.509684205f, 0.456955761f},
-std::array<float,2>{0.394942015f, 0.975010395f},
-std::array<float,2>{0.730852306f, 0.809563577f},
-std::array<float,2>{0.342606276f, 0.362147182f},
-std::array<float,2>{0.949913263f, 0.218534425f},
-std::array<float,2>{0.199606985f, 0.685832977f},
-std::array<float,2>{0.606568813f, 0.731398523f},
-std::array<float,2>{0.445638478f, 0.181121334f},
-std::array<float,2>{0.786352277f, 0.302550495f},
-std::array<float,2>{0.0665437207f, 0.817813098f},
-std::array<float,2>{0.881965578f, 0.890843749f},
-std::array<float,2>{0.174241379f, 0.399156958f},
-std::array<float,2>{0.64466393f, 0.0180892404f},
-std::array<float,2>{0.28930831f, 0.502106667f},
-std::array<float,2>{0.966369331f, 0.509239793f},
-std::array<float,2>{0.206716925f, 0.0282273851f},
-std::array<float,2>{0.73699075f, 0.394946307f},
-std::array<float,2>{0.319002837f, 0.906051755f},
-std::array<float,2>{0.522995591f, 0.826645792f},
-std::array<float,2>{0.380942702f, 0.307739228f},
-std::array<float,2>{0.812532067f, 0.177313238f},
-std::array<float,2>{0.000766504323f, 0.719253004f},
-std::array<float,2>{0.628670454f, 0.677552223f},
-std::array<float,2>{0.311087251f, 0.20634973f},
-std::array<float,2>{0.895967364f, 0.367895573f},
-std::array<float,2>{0.160473138f, 0.799176753f},
-std::array<float,2>{0.799815834f, 0.979171038f},
-std::array<float,2>{0.0930119753f, 0.468307257f},
-std::array<float,2>{0.613474071f, 0.10194838f},
-std::array<float,2>{0.458975464f, 0.570699632f},
-std::array<float,2>{0.871811986f, 0.70419246f},
-std::array<float,2>{0.0520642325f, 0.152747378f},
-std::array<float,2>{0.536017001f, 0.273929626f},
-std::array<float,2>{0.432983905f, 0.872822285f},
-std::array<float,2>{0.689756215f, 0.91720295f},
-std::array<float,2>{0.35156098f, 0.435599416f},
-std::array<float,2>{0.979657948f, 0.0527762622f},
-std::array<float,2>{0.226563573f, 0.537669659f},
-std::array<float,2>{0.569472551f, 0.600897372f},
-std::array<float,2>{0.48006478f, 0.0660426691f},
-std::array<float,2>{0.758986712f, 0.499872714f},
-std::array<float,2>{0.122938849f, 0.941478252f},
-std::array<float,2>{0.916624784f, 0.774457276f},
-std::array<float,2>{0.147428706f, 0.341684073f},
-std::array<float,2>{0.68686986f, 0.238040581f},
-std::array<float,2>{0.268494219f, 0.636192858f},
-std::array<float,2>{0.877671659f, 0.644043744f},
-std::array<float,2>{0.175945431f, 0.225713849f},
-std::array<float,2>{0.642485201f, 0.319416285f},
-std::array<float,2>{0.295291454f, 0.759676993f},
-std::array<float,2>{0.605389237f, 0.954938829f},
-std::array<float,2>{0.452439964f, 0.471327454f},
-std::array<float,2>{0.781538606f, 0.0843853354f},
-std::array<float,2>{0.0650650188f, 0.618058026f},
-std::array<float,2>{0.729975343f, 0.54770726f},
-std::array<float,2>{0.336521655f, 0.0340764783f},
-std::array<float,2>{0.948280334f, 0.420900375f},
-std::array<float,2>{0.197300196f, 0.922168136f},
-std::array<float,2>{0.840700924f, 0.847039819f},
-std::array<float,2>{0.0303958151f, 0.250703812f},
-std::array<float,2>{0.515581846f, 0.137851641f},
-std::array<float,2>{0.393235922f, 0.697551906f},
-std::array<float,2>{0.779252231f, 0.59003365f},
-std::array<float,2>{0.100008488f, 0.113548681f},
-std::array<float,2>{0.585996032f, 0.452023149f},
-std::array<float,2>{0.486938506f, 0.988728762f},
-std::array<float,2>{0.665865004f, 0.789614975f},
-std::array<float,2>{0.263011992f, 0.3439264f},
-std::array<float,2>{0.929321349f, 0.198502943f},
-std::array<float,2>{0.126882002f, 0.664042532f},
-std::array<float,2>{0.559174895f, 0.747510374f},
-std::array<float,2>{0.420805842f, 0.160437673f},
-std::array<float,2>{0.846062601f, 0.293198675f},
-std::array<float,2>{0.0318016782f, 0.831124961f},
-std::array<float,2>{0.996520162f, 0.879325092f},
-std::array<float,2>{0.246835306f, 0.382706344f},
-std::array<float,2>{0.715991974f, 0.00895348378f},
-std::array<float,2>{0.36582467f, 0.51778996f},
-std::array<float,2>{0.934013307f, 0.609379351f},
-std::array<float,2>{0.137241468f, 0.0928432643f},
-std::array<float,2>{0.65815556f, 0.477476746f},
-std::array<float,2>{0.255145371f, 0.96707958f},
-std::array<float,2>{0.584987819f, 0.7538445f},
-std::array<float,2>{0.494891405f, 0.32270807f},
-std::array<float,2>{0.76871264f, 0.226658344f},
-std::array<float,2>{0.107873634f, 0.654188633f},
-std::array<float,2>{0.707065225f, 0.689036667f},
-std::array<float,2>{0.372795373f, 0.125445694f},
-std::array<float,2>{0.985686958f, 0.264472157f},
-std::array<float,2>{0.240641758f, 0.857978761f},
-std::array<float,2>{0.852300763f, 0.936199367f},
-std::array<float,2>{0.0395647399f, 0.410444498f},
-std::array<float,2>{0.547864318f, 0.0461122692f},
-std::array<float,2>{0.413013726f, 0.559755325f},
-std::array<float,2>{0.796191454f, 0.668006659f},
-std::array<float,2>{0.076102294f, 0.194838032f},
-std::array<float,2>{0.596000612f, 0.359029472f},
-std::array<float,2>{0.445179224f, 0.782083035f},
-std::array<float,2>{0.653021991f, 0.994832635f},
-std::array<float,2>{0.282110542f, 0.439767212f},
-std::array<float,2>{0.8856951f, 0.123011328f},
-std::array<float,2>{0.180783734f, 0.581843197f},
-std::array<float,2>{0.50676614f, 0.530068994f},
-std::array<float,2>{0.398726344f, 0.00664491812f},
-std::array<float,2>{0.83142823f, 0.38653636f},
-std::array<float,2>{0.0179239456f, 0.88926214f},
-std::array<float,2>{0.938844442f, 0.839255929f},
-std::array<float,2>{0.191990212f, 0.286175579f},
-std::array<float,2>{0.72265166f, 0.171435937f},
-std::array<float,2>{0.331948429f, 0.738695741f},
-std::array<float,2>{0.975551486f, 0.729924321f},
-std::array<float,2>{0.221818909f, 0.184320778f},
-std::array<float,2>{0.696044922f, 0.298466206f},
-std::array<float,2>{0.356151044f, 0.815338016f},
-std::array<float,2>{0.540352643f, 0.89715898f},
-std::array<float,2>{0.428611308f, 0.402790785f},
-std::array<float,2>{0.864034653f, 0.022169495f},
-std::array<float,2>{0.0582331866f, 0.504730165f},
-std::array<float,2>{0.676859856f, 0.565832555f},
-std::array<float,2>{0.275927603f, 0.096392855f},
-std::array<float,2>{0.907784164f, 0.4595595f},
-std::array<float,2>{0.149034232f, 0.97021848f},
-std::array<float,2>{0.756308615f, 0.80643785f},
-std::array<float,2>{0.109983817f, 0.363537967f},
-std::array<float,2>{0.571458519f, 0.211715117f},
-std::array<float,2>{0.475616574f, 0.681666017f},
-std::array<float,2>{0.827483237f, 0.539177418f},
-std::array<float,2>{0.0152167035f, 0.0581050776f},
-std::array<float,2>{0.525884986f, 0.427621007f},
-std::array<float,2>{0.390008599f, 0.912010193f},
-std::array<float,2>{0.746022761f, 0.85997802f},
-std::array<float,2>{0.323530078f, 0.271043271f},
-std::array<float,2>{0.959236264f, 0.146110922f},
-std::array<float,2>{0.21665898f, 0.717862964f},
-std::array<float,2>{0.619966447f, 0.62951386f},
-std::array<float,2>{0.465638906f, 0.248883367f},
-std::array<float,2>{0.80578655f, 0.329917103f},
-std::array<float,2>{0.081454359f, 0.772599757f},
-std::array<float,2>{0.901561558f, 0.951434851f},
-std::array<float,2>{0.165086433f, 0.486947984f},
-std::array<float,2>{0.633834541f, 0.0778694153f},
-std::array<float,2>{0.303702801f, 0.602108955f},
-std::array<float,2>{0.988366425f, 0.578069806f},
-std::array<float,2>{0.235917419f, 0.106541246f},
-std::array<float,2>{0.705705523f, 0.463681102f},
-std::array<float,2>{0.368671387f, 0.98430115f},
-std::array<float,2>{0.551738918f, 0.802781761f},
-std::array<float,2>{0.40951094f, 0.371260256f},
-std::array<float,2>{0.859034359f, 0.208063737f},
-std::array<float,2>{0.046490144f, 0.675250828f},
-std::array<float,2>{0.662696123f, 0.722843468f},
-std::array<float,2>{0.252137601f, 0.173282236f},
-std::array<float,2>{0.929762125f, 0.310568392f},
-std::array<float,2>{0.134310186f, 0.823121011f},
-std::array<float,2>{0.772006154f, 0.898974597f},
-std::array<float,2>{0.102504142f, 0.390825689f},
-std::array<float,2>{0.580301821f, 0.0244195722f},
-std::array<float,2>{0.499235541f, 0.515446007f},
-std::array<float,2>{0.834346533f, 0.638589323f},
-std::array<float,2>{0.0208817832f, 0.241305724f},
-std::array<float,2>{0.500457942f, 0.339213789f},
-std::array<float,2>{0.404588163f, 0.778827369f},
-std::array<float,2>{0.723067701f, 0.940765798f},
-std::array<float,2>{0.33240366f, 0.49500832f},
-std::array<float,2>{0.94372797f, 0.068561241f},
-std::array<float,2>{0.189702913f, 0.596040189f},
-std::array<float,2>{0.600402415f, 0.533267915f},
-std::array<float,2>{0.440698117f, 0.0493558124f},
-std::array<float,2>{0.789432108f, 0.433523178f},
-std::array<float,2>{0.0725262463f, 0.919218123f},
-std::array<float,2>{0.889328003f, 0.867551923f},
-std::array<float,2>{0.18516998f, 0.279818833f},
-std::array<float,2>{0.649365127f, 0.149954736f},
-std::array<float,2>{0.286040932f, 0.708926499f},
-std::array<float,2>{0.910972059f, 0.702812016f},
-std::array<float,2>{0.155706793f, 0.134956092f},
-std::array<float,2>{0.6740309f, 0.254861176f},
-std::array<float,2>{0.278329343f, 0.851104319f},
-std::array<float,2>{0.575458229f, 0.929008245f},
-std::array<float,2>{0.472599924f, 0.416581213f},
-std::array<float,2>{0.751126051f, 0.0374330245f},
-std::array<float,2>{0.115134604f, 0.552538633f},
-std::array<float,2>{0.699625075f, 0.623180687f},
-std::array<float,2>{0.352401555f, 0.0793454722f},
-std::array<float,2>{0.969247997f, 0.476530373f},
-std::array<float,2>{0.226082698f, 0.957691133f},
-std::array<float,2>{0.861703336f, 0.763658166f},
-std::array<float,2>{0.0614322349f, 0.314432025f},
-std::array<float,2>{0.543285906f, 0.221456826f},
-std::array<float,2>{0.423826784f, 0.645582199f},
-std::array<float,2>{0.811851799f, 0.523435771f},
-std::array<float,2>{0.0846459866f, 0.0137632992f},
-std::array<float,2>{0.62187165f, 0.376307875f},
-std::array<float,2>{0.463428497f, 0.875683904f},
-std::array<float,2>{0.640515804f, 0.833361566f},
-std::array<float,2>{0.29958123f, 0.290649354f},
-std::array<float,2>{0.905139506f, 0.157753125f},
-std::array<float,2>{0.168383867f, 0.743125618f},
-std::array<float,2>{0.529784441f, 0.656338513f},
-std::array<float,2>{0.383567691f, 0.201969311f},
-std::array<float,2>{0.821156323f, 0.349811137f},
-std::array<float,2>{0.0116188154f, 0.796402752f},
-std::array<float,2>{0.953693449f, 0.988068819f},
-std::array<float,2>{0.211497605f, 0.447672814f},
-std::array<float,2>{0.748192012f, 0.112867355f},
-std::array<float,2>{0.32691732f, 0.588626266f},
-std::array<float,2>{0.891135991f, 0.558440924f},
-std::array<float,2>{0.156857938f, 0.0409953855f},
-std::array<float,2>{0.62941438f, 0.407103032f},
-std::array<float,2>{0.306931734f, 0.931783915f},
-std::array<float,2>{0.611311257f, 0.853699625f},
-std::array<float,2>{0.454145521f, 0.26163286f},
-std::array<float,2>{0.801138043f, 0.130800352f},
-std::array<float,2>{0.0883957446f, 0.692687869f},
-std::array<float,2>{0.740575969f, 0.650022209f},
-std::array<float,2>{0.31385386f, 0.23377423f},
-std::array<float,2>{0.962390661f, 0.327886879f},
-std::array<float,2>{0.210745022f, 0.756936669f},
-std::array<float,2>{0.817350566f, 0.963240504f},
-std::array<float,2>{0.00563429249f, 0.483342975f},
-std::array<float,2>{0.51739949f, 0.088246569f},
-std::array<float,2>{0.377410501f, 0.613402069f},
-std::array<float,2>{0.764210641f, 0.737321913f},
-std::array<float,2>{0.119927779f, 0.16632247f},
-std::array<float,2>{0.562562466f, 0.283433855f},
-std::array<float,2>{0.482440084f, 0.839970231f},
-std::array<float,2>{0.680526376f, 0.885562003f},
-std::array<float,2>{0.271860838f, 0.388001561f},
-std::array<float,2>{0.919887722f, 0.000479890819f},
-std::array<float,2>{0.142460227f, 0.524065137f},
-std::array<float,2>{0.534820616f, 0.582945466f},
-std::array<float,2>{0.435565561f, 0.11905665f},
-std::array<float,2>{0.869915843f, 0.445144087f},
-std::array<float,2>{0.0489941537f, 0.998998106f},
-std::array<float,2>{0.983398616f, 0.788936555f},
-std::array<float,2>{0.233999938f, 0.352832615f},
-std::array<float,2>{0.693411231f, 0.191019475f},
-std::array<float,2>{0.345694393f, 0.66561383f},
-std::array<float,2>{0.952932537f, 0.685536981f},
-std::array<float,2>{0.202844545f, 0.214848518f},
-std::array<float,2>{0.734266818f, 0.359768063f},
-std::array<float,2>{0.340492398f, 0.810927689f},
-std::array<float,2>{0.510187268f, 0.972965539f},
-std::array<float,2>{0.397076786f, 0.454099149f},
-std::array<float,2>{0.837034464f, 0.100354753f},
-std::array<float,2>{0.0252374187f, 0.569514394f},
-std::array<float,2>{0.647536099f, 0.501367152f},
-std::array<float,2>{0.291573942f, 0.0158663113f},
-std::array<float,2>{0.880524695f, 0.400859714f},
-std::array<float,2>{0.17244792f, 0.893780947f},
-std::array<float,2>{0.788188279f, 0.818954647f},
-std::array<float,2>{0.0698047876f, 0.304411769f},
-std::array<float,2>{0.608205318f, 0.182481453f},
-std::array<float,2>{0.44877857f, 0.733736277f},
-std::array<float,2>{0.849264503f, 0.607774198f},
-std::array<float,2>{0.0363382623f, 0.0734629482f},
-std::array<float,2>{0.555505037f, 0.488340139f},
-std::array<float,2>{0.415039182f, 0.94606477f},
-std::array<float,2>{0.7111727f, 0.767901838f},
-std::array<float,2>{0.361891598f, 0.333611727f},
-std::array<float,2>{0.993014932f, 0.245907411f},
-std::array<float,2>{0.245950088f, 0.628204107f},
-std::array<float,2>{0.593300402f, 0.712804735f},
-std::array<float,2>{0.490236521f, 0.142061502f},
-std::array<float,2>{0.774071634f, 0.268013209f},
-std::array<float,2>{0.0970544666f, 0.866068602f},
-std::array<float,2>{0.922541142f, 0.90916425f},
-std::array<float,2>{0.132478148f, 0.422763377f},
-std::array<float,2>{0.669135392f, 0.0619507357f},
-std::array<float,2>{0.258724034f, 0.545147657f},
-std::array<float,2>{0.998892188f, 0.519352853f},
-std::array<float,2>{0.248790666f, 0.00802102685f},
-std::array<float,2>{0.717077792f, 0.381025136f},
-std::array<float,2>{0.364824444f, 0.880291879f},
-std::array<float,2>{0.560943425f, 0.830350816f},
-std::array<float,2>{0.418924093f, 0.294879436f},
-std::array<float,2>{0.844776154f, 0.161957443f},
-std::array<float,2>{0.0341900326f, 0.746465445f},
-std::array<float,2>{0.666609526f, 0.663013518f},
-std::array<float,2>{0.264667749f, 0.197504401f},
-std::array<float,2>{0.926633418f, 0.344931811f},
-std::array<float,2>{0.127437189f, 0.79071492f},
-std::array<float,2>{0.780599713f, 0.989521384f},
-std::array<float,2>{0.0992822945f, 0.452728003f},
-std::array<float,2>{0.589033067f, 0.115125276f},
-std::array<float,2>{0.48616159f, 0.59104991f},
-std::array<float,2>{0.843503475f, 0.698804617f},
-std::array<float,2>{0.0275866371f, 0.137497723f},
-std::array<float,2>{0.512351871f, 0.251702994f},
-std::array<float,2>{0.391080052f, 0.846011877f},
-std::array<float,2>{0.727479637f, 0.923268437f},
-std::array<float,2>{0.338079393f, 0.420205086f},
-std::array<float,2>{0.946832478f, 0.0349547639f},
-std::array<float,2>{0.197126284f, 0.54822582f},
-std::array<float,2>{0.603265107f, 0.618436396f},
-std::array<float,2>{0.449393839f, 0.0856913626f},
-std::array<float,2>{0.78347528f, 0.471812993f},
-std::array<float,2>{0.0632458106f, 0.953637719f},
-std::array<float,2>{0.876102686f, 0.758708715f},
-std::array<float,2>{0.17823799f, 0.318685114f},
-std::array<float,2>{0.643845379f, 0.225386605f},
-std::array<float,2>{0.294900119f, 0.643291831f},
-std::array<float,2>{0.915712297f, 0.635705471f},
-std::array<float,2>{0.14628914f, 0.236694321f},
-std::array<float,2>{0.684474885f, 0.340803653f},
-std::array<float,2>{0.266272962f, 0.774341524f},
-std::array<float,2>{0.566430032f, 0.942797005f},
-std::array<float,2>{0.477436692f, 0.498590678f},
-std::array<float,2>{0.761288404f, 0.0645324588f},
-std::array<float,2>{0.123737812f, 0.600186825f},
-std::array<float,2>{0.688103378f, 0.539044619f},
-std::array<float,2>{0.348837018f, 0.0543686263f},
-std::array<float,2>{0.976709485f, 0.437368304f},
-std::array<float,2>{0.228786588f, 0.916912735f},
-std::array<float,2>{0.873260856f, 0.871748209f},
-std::array<float,2>{0.0539736599f, 0.274832755f},
-std::array<float,2>{0.538702548f, 0.153948039f},
-std::array<float,2>{0.430336684f, 0.703387976f},
-std::array<float,2>{0.797199368f, 0.572009087f},
-std::array<float,2>{0.0915818959f, 0.103170529f},
-std::array<float,2>{0.616613865f, 0.466903239f},
-std::array<float,2>{0.459995389f, 0.97974664f},
-std::array<float,2>{0.625916958f, 0.800105512f},
-std::array<float,2>{0.310515434f, 0.368671894f},
-std::array<float,2>{0.896728814f, 0.2054822f},
-std::array<float,2>{0.1622715f, 0.676580191f},
-std::array<float,2>{0.521183789f, 0.719737828f},
-std::array<float,2>{0.379569918f, 0.176007271f},
-std::array<float,2>{0.815290809f, 0.307225883f},
-std::array<float,2>{0.00233664573f, 0.827391446f},
-std::array<float,2>{0.967480063f, 0.904431105f},
-std::array<float,2>{0.204975143f, 0.396377861f},
-std::array<float,2>{0.736157119f, 0.0289322846f},
-std::array<float,2>{0.318027288f, 0.508018732f},
-std::array<float,2>{0.900359154f, 0.603289425f},
-std::array<float,2>{0.167451635f, 0.0767088383f},
-std::array<float,2>{0.634998739f, 0.487475246f},
-std::array<float,2>{0.301140249f, 0.952595413f},
-std::array<float,2>{0.618050635f, 0.771799862f},
-std::array<float,2>{0.467563599f, 0.328884006f},
-std::array<float,2>{0.806741953f, 0.24903141f},
-std::array<float,2>{0.0798595697f, 0.630029023f},
-std::array<float,2>{0.743661702f, 0.71767205f},
-std::array<float,2>{0.321033418f, 0.144678414f},
-std::array<float,2>{0.957219362f, 0.269761711f},
-std::array<float,2>{0.21719496f, 0.86089462f},
-std::array<float,2>{0.826155126f, 0.910270512f},
-std::array<float,2>{0.0133577306f, 0.426082969f},
-std::array<float,2>{0.52462405f, 0.05711025f},
-std::array<float,2>{0.38851741f, 0.54093188f},
-std::array<float,2>{0.754017889f, 0.682652473f},
-std::array<float,2>{0.112689935f, 0.212513164f},
-std::array<float,2>{0.572628856f, 0.364416271f},
-std::array<float,2>{0.474440515f, 0.8052333f},
-std::array<float,2>{0.679671645f, 0.969181478f},
-std::array<float,2>{0.273485214f, 0.460235506f},
-std::array<float,2>{0.909983814f, 0.0968863294f},
-std::array<float,2>{0.15177387f, 0.564608157f},
-std::array<float,2>{0.542621672f, 0.505791366f},
-std::array<float,2>{0.427007377f, 0.0233781449f},
-std::array<float,2>{0.865295649f, 0.40346691f},
-std::array<float,2>{0.0547728352f, 0.897644639f},
-std::array<float,2>{0.972843349f, 0.815983713f},
-std::array<float,2>{0.219572291f, 0.297329813f},
-std::array<float,2>{0.697384238f, 0.18494007f},
-std::array<float,2>{0.358886361f, 0.72943151f},
-std::array<float,2>{0.940567553f, 0.739837766f},
-std::array<float,2>{0.193790287f, 0.170708746f},
-std::array<float,2>{0.71935463f, 0.285185158f},
-std::array<float,2>{0.3283512f, 0.83852905f},
-std::array<float,2>{0.505363107f, 0.890195847f},
-std::array<float,2>{0.401238292f, 0.385571569f},
-std::array<float,2>{0.829086483f, 0.00746878376f},
-std::array<float,2>{0.016838409f, 0.5311324f},
-std::array<float,2>{0.655489922f, 0.580806792f},
-std::array<float,2>{0.283416063f, 0.121469997f},
-std::array<float,2>{0.883345783f, 0.441125184f},
-std::array<float,2>{0.181933358f, 0.995380282f},
-std::array<float,2>{0.79385376f, 0.78261131f},
-std::array<float,2>{0.0766455904f, 0.358279914f},
-std::array<float,2>{0.594661474f, 0.193559438f},
-std::array<float,2>{0.442667276f, 0.669086933f},
-std::array<float,2>{0.854570091f, 0.558674634f},
-std::array<float,2>{0.0413962118f, 0.0454464331f},
-std::array<float,2>{0.550676942f, 0.411377043f},
-std::array<float,2>{0.410368145f, 0.936710238f},
-std::array<float,2>{0.710095942f, 0.859297812f},
-std::array<float,2>{0.373862177f, 0.265163898f},
-std::array<float,2>{0.987938881f, 0.12653701f},
-std::array<float,2>{0.239321664f, 0.688374758f},
-std::array<float,2>{0.58304137f, 0.652852654f},
-std::array<float,2>{0.492958188f, 0.228017136f},
-std::array<float,2>{0.766723275f, 0.323700964f},
-std::array<float,2>{0.10689576f, 0.752176881f},
-std::array<float,2>{0.936090112f, 0.967979729f},
-std::array<float,2>{0.139428616f, 0.47811377f},
-std::array<float,2>{0.659385622f, 0.0919816643f},
-std::array<float,2>{0.256023854f, 0.610470831f},
-std::array<float,2>{0.956141233f, 0.589276731f},
-std::array<float,2>{0.213059738f, 0.111597866f},
-std::array<float,2>{0.746576071f, 0.449078232f},
-std::array<float,2>{0.324812174f, 0.986353695f},
-std::array<float,2>{0.527856886f, 0.795604348f},
-std::array<float,2>{0.386609674f, 0.350976795f},
-std::array<float,2>{0.824110687f, 0.202827305f},
-std::array<float,2>{0.00875301659f, 0.65799737f},
-std::array<float,2>{0.638649046f, 0.743995011f},
-std::array<float,2>{0.298740804f, 0.156567469f},
-std::array<float,2>{0.903649807f, 0.289153188f},
-std::array<float,2>{0.170010209f, 0.832475245f},
-std::array<float,2>{0.809188008f, 0.876400888f},
-std::array<float,2>{0.0834643841f, 0.375711054f},
-std::array<float,2>{0.624262214f, 0.0147171151f},
-std::array<float,2>{0.461085409f, 0.521608055f},
-std::array<float,2>{0.860672653f, 0.645361245f},
-std::array<float,2>{0.0588530786f, 0.222112924f},
-std::array<float,2>{0.546184063f, 0.313040733f},
-std::array<float,2>{0.424558103f, 0.762349725f},
-std::array<float,2>{0.702778697f, 0.958712101f},
-std::array<float,2>{0.353706747f, 0.474871248f},
-std::array<float,2>{0.972598255f, 0.0784651712f},
-std::array<float,2>{0.224001616f, 0.624144673f},
-std::array<float,2>{0.576268911f, 0.551317036f},
-std::array<float,2>{0.470485717f, 0.038885396f},
-std::array<float,2>{0.752440035f, 0.417207122f},
-std::array<float,2>{0.116647884f, 0.92774123f},
-std::array<float,2>{0.913196146f, 0.850198507f},
-std::array<float,2>{0.15398632f, 0.255363286f},
-std::array<float,2>{0.673073113f, 0.135984287f},
-std::array<float,2>{0.280430883f, 0.70202297f},
-std::array<float,2>{0.887008429f, 0.70800662f},
-std::array<float,2>{0.186568066f, 0.14883028f},
-std::array<float,2>{0.652043402f, 0.280733675f},
-std::array<float,2>{0.288110673f, 0.868243515f},
-std::array<float,2>{0.59894979f, 0.91831845f},
-std::array<float,2>{0.439260989f, 0.432245731f},
-std::array<float,2>{0.792680085f, 0.0506405123f},
-std::array<float,2>{0.070739314f, 0.53436923f},
-std::array<float,2>{0.725170135f, 0.597406685f},
-std::array<float,2>{0.335310012f, 0.0697407052f},
-std::array<float,2>{0.942017138f, 0.495246619f},
-std::array<float,2>{0.188059375f, 0.93952924f},
-std::array<float,2>{0.833940923f, 0.778197408f},
-std::array<float,2>{0.0224784091f, 0.338285863f},
-std::array<float,2>{0.503035069f, 0.240862384f},
-std::array<float,2>{0.402751178f, 0.637322485f},
-std::array<float,2>{0.771230757f, 0.514506817f},
-std::array<float,2>{0.104150444f, 0.0237974003f},
-std::array<float,2>{0.578853309f, 0.391997755f},
-std::array<float,2>{0.496940792f, 0.90003866f},
-std::array<float,2>{0.660250962f, 0.824112833f},
-std::array<float,2>{0.251543462f, 0.312280208f},
-std::array<float,2>{0.932623982f, 0.172420546f},
-std::array<float,2>{0.135109559f, 0.724045634f},
-std::array<float,2>{0.553872228f, 0.673920989f},
-std::array<float,2>{0.407460451f, 0.207195163f},
-std::array<float,2>{0.856637776f, 0.373037726f},
-std::array<float,2>{0.0442226529f, 0.804377496f},
-std::array<float,2>{0.991328537f, 0.98337388f},
-std::array<float,2>{0.236806661f, 0.464295089f},
-std::array<float,2>{0.70403868f, 0.105793141f},
-std::array<float,2>{0.369727194f, 0.577049315f},
-std::array<float,2>{0.924130976f, 0.546731412f},
-std::array<float,2>{0.130292132f, 0.0607200675f},
-std::array<float,2>{0.670181572f, 0.423802823f},
-std::array<float,2>{0.261000782f, 0.909198582f},
-std::array<float,2>{0.590067387f, 0.866777539f},
-std::array<float,2>{0.488842964f, 0.269375116f},
-std::array<float,2>{0.775515199f, 0.141080707f},
-std::array<float,2>{0.0941576213f, 0.711317658f},
-std::array<float,2>{0.713236451f, 0.627457559f},
-std::array<float,2>{0.360824853f, 0.244712472f},
-std::array<float,2>{0.994227886f, 0.332822412f},
-std::array<float,2>{0.243225068f, 0.769214511f},
-std::array<float,2>{0.850288689f, 0.946662009f},
-std::array<float,2>{0.0388290733f, 0.489873409f},
-std::array<float,2>{0.558153749f, 0.0724596977f},
-std::array<float,2>{0.416321605f, 0.608471572f},
-std::array<float,2>{0.785622954f, 0.733370304f},
-std::array<float,2>{0.0683389679f, 0.183353692f},
-std::array<float,2>{0.605819762f, 0.30356133f},
-std::array<float,2>{0.44680059f, 0.820069015f},
-std::array<float,2>{0.646337211f, 0.893371344f},
-std::array<float,2>{0.290369004f, 0.402224392f},
-std::array<float,2>{0.881071448f, 0.0175231211f},
-std::array<float,2>{0.174927771f, 0.500740409f},
-std::array<float,2>{0.50781697f, 0.569197178f},
-std::array<float,2>{0.395652056f, 0.101104595f},
-std::array<float,2>{0.838965416f, 0.454123169f},
-std::array<float,2>{0.0258564819f, 0.973978996f},
-std::array<float,2>{0.950395465f, 0.811819494f},
-std::array<float,2>{0.200831205f, 0.361298651f},
-std::array<float,2>{0.732338369f, 0.216693968f},
-std::array<float,2>{0.343299091f, 0.683755457f},
-std::array<float,2>{0.980723023f, 0.664783597f},
-std::array<float,2>{0.231067717f, 0.18986778f},
-std::array<float,2>{0.692129433f, 0.351991713f},
-std::array<float,2>{0.346284479f, 0.787610292f},
-std::array<float,2>{0.532624006f, 0.999836087f},
-std::array<float,2>{0.435270697f, 0.444216192f},
-std::array<float,2>{0.868063807f, 0.118087493f},
-std::array<float,2>{0.0479089208f, 0.583737731f},
-std::array<float,2>{0.683396816f, 0.524833918f},
-std::array<float,2>{0.270488113f, 0.00144324522f},
-std::array<float,2>{0.920865715f, 0.387467444f},
-std::array<float,2>{0.144349784f, 0.886253476f},
-std::array<float,2>{0.762613535f, 0.840962052f},
-std::array<float,2>{0.118835069f, 0.285066068f},
-std::array<float,2>{0.56607008f, 0.167127714f},
-std::array<float,2>{0.481369972f, 0.736397803f},
-std::array<float,2>{0.818410516f, 0.614998341f},
-std::array<float,2>{0.00667061284f, 0.0891592801f},
-std::array<float,2>{0.518485546f, 0.483720601f},
-std::array<float,2>{0.376413167f, 0.964407444f},
-std::array<float,2>{0.739036441f, 0.756144464f},
-std::array<float,2>{0.314634174f, 0.326407135f},
-std::array<float,2>{0.96289885f, 0.23305966f},
-std::array<float,2>{0.20826523f, 0.648748994f},
-std::array<float,2>{0.611987472f, 0.691475093f},
-std::array<float,2>{0.455971837f, 0.129746035f},
-std::array<float,2>{0.804622233f, 0.260099143f},
-std::array<float,2>{0.0860882849f, 0.855146885f},
-std::array<float,2>{0.893311441f, 0.933586657f},
-std::array<float,2>{0.160119846f, 0.407255054f},
-std::array<float,2>{0.632341743f, 0.0391918495f},
-std::array<float,2>{0.305849493f, 0.557060778f},
-std::array<float,2>{0.948126376f, 0.54981041f},
-std::array<float,2>{0.198775977f, 0.0322963111f},
-std::array<float,2>{0.729318321f, 0.418635398f},
-std::array<float,2>{0.33750543f, 0.924706995f},
-std::array<float,2>{0.513735592f, 0.844369829f},
-std::array<float,2>{0.394346952f, 0.253295153f},
-std::array<float,2>{0.841064572f, 0.139002636f},
-std::array<float,2>{0.0295257941f, 0.695926607f},
-std::array<float,2>{0.641227484f, 0.641317189f},
-std::array<float,2>{0.295949876f, 0.224430546f},
-std::array<float,2>{0.878307819f, 0.317602843f},
-std::array<float,2>{0.177097321f, 0.76145494f},
-std::array<float,2>{0.782255411f, 0.956988871f},
-std::array<float,2>{0.0655109286f, 0.470182925f},
-std::array<float,2>{0.60439229f, 0.0824729949f},
-std::array<float,2>{0.451675624f, 0.620510459f},
-std::array<float,2>{0.846720755f, 0.749533355f},
-std::array<float,2>{0.0323964879f, 0.16248396f},
-std::array<float,2>{0.560449123f, 0.296133101f},
-std::array<float,2>{0.42132771f, 0.829309165f},
-std::array<float,2>{0.715815008f, 0.880938411f},
-std::array<float,2>{0.367034376f, 0.378922582f},
-std::array<float,2>{0.997845232f, 0.0104760015f},
-std::array<float,2>{0.24802275f, 0.516128242f},
-std::array<float,2>{0.587185562f, 0.593249142f},
-std::array<float,2>{0.487996608f, 0.116265379f},
-std::array<float,2>{0.777997375f, 0.449928254f},
-std::array<float,2>{0.10150791f, 0.99191463f},
-std::array<float,2>{0.928052902f, 0.792036176f},
-std::array<float,2>{0.125213161f, 0.347031713f},
-std::array<float,2>{0.66494441f, 0.196020931f},
-std::array<float,2>{0.262652636f, 0.660299838f},
-std::array<float,2>{0.894884169f, 0.679458737f},
-std::array<float,2>{0.161354676f, 0.204543352f},
-std::array<float,2>{0.627256453f, 0.370406181f},
-std::array<float,2>{0.311751425f, 0.797609448f},
-std::array<float,2>{0.614412129f, 0.977704406f},
-std::array<float,2>{0.457070947f, 0.465453714f},
-std::array<float,2>{0.799422383f, 0.104124561f},
-std::array<float,2>{0.092264995f, 0.573840141f},
-std::array<float,2>{0.737314641f, 0.510234654f},
-std::array<float,2>{0.320197582f, 0.030491408f},
-std::array<float,2>{0.965592027f, 0.396644324f},
-std::array<float,2>{0.206035718f, 0.902501464f},
-std::array<float,2>{0.81349206f, 0.82575345f},
-std::array<float,2>{0.00156988332f, 0.304720998f},
-std::array<float,2>{0.521547019f, 0.178210676f},
-std::array<float,2>{0.382093281f, 0.721540332f},
-std::array<float,2>{0.757823467f, 0.598683417f},
-std::array<float,2>{0.121771932f, 0.0628347546f},
-std::array<float,2>{0.569072008f, 0.496680021f},
-std::array<float,2>{0.479220301f, 0.944612563f},
-std::array<float,2>{0.685805261f, 0.776587605f},
-std::array<float,2>{0.268982291f, 0.342128396f},
-std::array<float,2>{0.917827964f, 0.235229999f},
-std::array<float,2>{0.148066208f, 0.634410858f},
-std::array<float,2>{0.536393583f, 0.706474543f},
-std::array<float,2>{0.432152241f, 0.154449746f},
-std::array<float,2>{0.872312546f, 0.277249396f},
-std::array<float,2>{0.0511135384f, 0.874975801f},
-std::array<float,2>{0.978602409f, 0.915014267f},
-std::array<float,2>{0.227844805f, 0.43371743f},
-std::array<float,2>{0.690506697f, 0.0514213555f},
-std::array<float,2>{0.35044387f, 0.535684049f},
-std::array<float,2>{0.906773448f, 0.563597322f},
-std::array<float,2>{0.150244176f, 0.0945993364f},
-std::array<float,2>{0.676065505f, 0.458457023f},
-std::array<float,2>{0.276814371f, 0.972584128f},
-std::array<float,2>{0.57066077f, 0.808220267f},
-std::array<float,2>{0.474869877f, 0.365818501f},
-std::array<float,2>{0.7572577f, 0.213880375f},
-std::array<float,2>{0.110714003f, 0.680561304f},
-std::array<float,2>{0.696468294f, 0.728256762f},
-std::array<float,2>{0.356731117f, 0.18591556f},
-std::array<float,2>{0.975623369f, 0.300119847f},
-std::array<float,2>{0.221658513f, 0.813492239f},
-std::array<float,2>{0.864597142f, 0.896178424f},
-std::array<float,2>{0.0568170175f, 0.406110525f},
-std::array<float,2>{0.539664865f, 0.0209604744f},
-std::array<float,2>{0.428798705f, 0.506453335f},
-std::array<float,2>{0.805290461f, 0.631112933f},
-std::array<float,2>{0.0805883706f, 0.247852683f},
-std::array<float,2>{0.620858848f, 0.330209315f},
-std::array<float,2>{0.466498137f, 0.770845294f},
-std::array<float,2>{0.633173525f, 0.951111615f},
-std::array<float,2>{0.304186553f, 0.484602034f},
-std::array<float,2>{0.900529623f, 0.0760105774f},
-std::array<float,2>{0.164772511f, 0.604356229f},
-std::array<float,2>{0.526448131f, 0.542330444f},
-std::array<float,2>{0.389005989f, 0.0553471297f},
-std::array<float,2>{0.826185763f, 0.42956835f},
-std::array<float,2>{0.0145413009f, 0.912658989f},
-std::array<float,2>{0.960207403f, 0.861541808f},
-std::array<float,2>{0.215055168f, 0.272309601f},
-std::array<float,2>{0.744547069f, 0.147283256f},
-std::array<float,2>{0.323061436f, 0.716055989f},
-std::array<float,2>{0.984688282f, 0.691272497f},
-std::array<float,2>{0.241450116f, 0.127339333f},
-std::array<float,2>{0.708789647f, 0.26185295f},
-std::array<float,2>{0.371573061f, 0.856209278f},
-std::array<float,2>{0.547082067f, 0.935425758f},
-std::array<float,2>{0.413192034f, 0.413599283f},
-std::array<float,2>{0.853366017f, 0.0431948304f},
-std::array<float,2>{0.0409253165f, 0.562063098f},
-std::array<float,2>{0.656942487f, 0.613037527f},
-std::array<float,2>{0.254413337f, 0.0916629434f},
-std::array<float,2>{0.935118079f, 0.479479104f},
-std::array<float,2>{0.13861759f, 0.965873241f},
-std::array<float,2>{0.767987907f, 0.751551569f},
-std::array<float,2>{0.109209403f, 0.321018934f},
-std::array<float,2>{0.584546983f, 0.230315536f},
-std::array<float,2>{0.49573645f, 0.655040324f},
-std::array<float,2>{0.830079973f, 0.528534472f},
-std::array<float,2>{0.0189471338f, 0.00492053339f},
-std::array<float,2>{0.507027745f, 0.384608716f},
-std::array<float,2>{0.400363266f, 0.887207687f},
-std::array<float,2>{0.721016705f, 0.836001456f},
-std::array<float,2>{0.330222994f, 0.287348896f},
-std::array<float,2>{0.938317478f, 0.168592647f},
-std::array<float,2>{0.192580581f, 0.741884708f},
-std::array<float,2>{0.597033739f, 0.669952571f},
-std::array<float,2>{0.444299638f, 0.191806465f},
-std::array<float,2>{0.795229197f, 0.355994582f},
-std::array<float,2>{0.0748886541f, 0.784946263f},
-std::array<float,2>{0.886284292f, 0.994059026f},
-std::array<float,2>{0.179758996f, 0.438611746f},
-std::array<float,2>{0.653499246f, 0.12455532f},
-std::array<float,2>{0.283002526f, 0.579397738f},
-std::array<float,2>{0.970634282f, 0.622769892f},
-std::array<float,2>{0.224621966f, 0.0801377594f},
-std::array<float,2>{0.700294614f, 0.47458446f},
-std::array<float,2>{0.35322091f, 0.959023356f},
-std::array<float,2>{0.544187188f, 0.765402377f},
-std::array<float,2>{0.421880871f, 0.314927846f},
-std::array<float,2>{0.862932622f, 0.21970211f},
-std::array<float,2>{0.0621172674f, 0.648065507f},
-std::array<float,2>{0.675152421f, 0.699873686f},
-std::array<float,2>{0.277836412f, 0.134498522f},
-std::array<float,2>{0.911205113f, 0.256150097f},
-std::array<float,2>{0.154730618f, 0.848524332f},
-std::array<float,2>{0.75089848f, 0.926575363f},
-std::array<float,2>{0.11411906f, 0.414283633f},
-std::array<float,2>{0.574581027f, 0.0355922244f},
-std::array<float,2>{0.470884234f, 0.554329753f},
-std::array<float,2>{0.821496665f, 0.658886075f},
-std::array<float,2>{0.0101692909f, 0.201162785f},
-std::array<float,2>{0.531213045f, 0.349394739f},
-std::array<float,2>{0.383970618f, 0.793137193f},
-std::array<float,2>{0.749724269f, 0.986135304f},
-std::array<float,2>{0.327576905f, 0.446433425f},
-std::array<float,2>{0.954145193f, 0.109972604f},
-std::array<float,2>{0.2121301f, 0.586614311f},
-std::array<float,2>{0.622199297f, 0.519632936f},
-std::array<float,2>{0.464518487f, 0.0132074356f},
-std::array<float,2>{0.811257482f, 0.377111077f},
-std::array<float,2>{0.0850095972f, 0.878883243f},
-std::array<float,2>{0.906222761f, 0.835677087f},
-std::array<float,2>{0.16986531f, 0.292317957f},
-std::array<float,2>{0.639513314f, 0.159684151f},
-std::array<float,2>{0.300456911f, 0.745159507f},
-std::array<float,2>{0.930807352f, 0.724796414f},
-std::array<float,2>{0.133398786f, 0.174362436f},
-std::array<float,2>{0.663870096f, 0.309195548f},
-std::array<float,2>{0.253859758f, 0.822022617f},
-std::array<float,2>{0.581958473f, 0.902287066f},
-std::array<float,2>{0.49833709f, 0.393456787f},
-std::array<float,2>{0.772832274f, 0.0271969382f},
-std::array<float,2>{0.103404567f, 0.5119555f},
-std::array<float,2>{0.706696749f, 0.574805439f},
-std::array<float,2>{0.367979676f, 0.107584111f},
-std::array<float,2>{0.989704788f, 0.462497026f},
-std::array<float,2>{0.234783769f, 0.981474161f},
-std::array<float,2>{0.857962489f, 0.801353335f},
-std::array<float,2>{0.0454586148f, 0.373113215f},
-std::array<float,2>{0.552328467f, 0.209417984f},
-std::array<float,2>{0.408487409f, 0.673488259f},
-std::array<float,2>{0.790564537f, 0.533088624f},
-std::array<float,2>{0.0738028511f, 0.0484038964f},
-std::array<float,2>{0.600956202f, 0.430410177f},
-std::array<float,2>{0.439549863f, 0.92061007f},
-std::array<float,2>{0.65001446f, 0.870215237f},
-std::array<float,2>{0.286457241f, 0.27917257f},
-std::array<float,2>{0.889736176f, 0.151146948f},
-std::array<float,2>{0.184491068f, 0.710791349f},
-std::array<float,2>{0.501472354f, 0.640572846f},
-std::array<float,2>{0.405806273f, 0.239530817f},
-std::array<float,2>{0.835052967f, 0.336487651f},
-std::array<float,2>{0.0198588073f, 0.780790508f},
-std::array<float,2>{0.944862902f, 0.938016713f},
-std::array<float,2>{0.191358164f, 0.492901593f},
-std::array<float,2>{0.72389704f, 0.0669268817f},
-std::array<float,2>{0.333172947f, 0.594751596f},
-std::array<float,2>{0.879205465f, 0.503780186f},
-std::array<float,2>{0.17292285f, 0.0185983349f},
-std::array<float,2>{0.647110343f, 0.399677783f},
-std::array<float,2>{0.292878956f, 0.891844392f},
-std::array<float,2>{0.608850598f, 0.816457212f},
-std::array<float,2>{0.448078811f, 0.301351517f},
-std::array<float,2>{0.787330985f, 0.180131808f},
-std::array<float,2>{0.0686445385f, 0.731752038f},
-std::array<float,2>{0.732918262f, 0.687096536f},
-std::array<float,2>{0.341744602f, 0.217165858f},
-std::array<float,2>{0.951304257f, 0.362979949f},
-std::array<float,2>{0.201308295f, 0.810284436f},
-std::array<float,2>{0.836494684f, 0.975700617f},
-std::array<float,2>{0.0241674688f, 0.455263704f},
-std::array<float,2>{0.511250854f, 0.0986169353f},
-std::array<float,2>{0.398244619f, 0.567141414f},
-std::array<float,2>{0.775325954f, 0.714441061f},
-std::array<float,2>{0.0962021798f, 0.142835438f},
-std::array<float,2>{0.592558205f, 0.266132474f},
-std::array<float,2>{0.491783351f, 0.863596201f},
-std::array<float,2>{0.668020368f, 0.90698868f},
-std::array<float,2>{0.258862227f, 0.42558673f},
-std::array<float,2>{0.92316699f, 0.059346199f},
-std::array<float,2>{0.131188557f, 0.544035077f},
-std::array<float,2>{0.55624789f, 0.606667519f},
-std::array<float,2>{0.414785922f, 0.0717192963f},
-std::array<float,2>{0.848632514f, 0.490799159f},
-std::array<float,2>{0.0351832323f, 0.947352886f},
-std::array<float,2>{0.994034111f, 0.766917348f},
-std::array<float,2>{0.244397223f, 0.335349947f},
-std::array<float,2>{0.712169588f, 0.243423581f},
-std::array<float,2>{0.363237947f, 0.626517713f},
-std::array<float,2>{0.961068094f, 0.652212918f},
-std::array<float,2>{0.209640428f, 0.231838584f},
-std::array<float,2>{0.741239905f, 0.325804293f},
-std::array<float,2>{0.313362539f, 0.755308986f},
-std::array<float,2>{0.51619333f, 0.961743891f},
-std::array<float,2>{0.37865141f, 0.481290579f},
-std::array<float,2>{0.818151355f, 0.087355718f},
-std::array<float,2>{0.00411692029f, 0.615494907f},
-std::array<float,2>{0.63044709f, 0.555627465f},
-std::array<float,2>{0.307989568f, 0.0419012643f},
-std::array<float,2>{0.89180243f, 0.408540845f},
-std::array<float,2>{0.15724057f, 0.931390047f},
-std::array<float,2>{0.802106082f, 0.853237987f},
-std::array<float,2>{0.0895866752f, 0.25865081f},
-std::array<float,2>{0.609578013f, 0.131617188f},
-std::array<float,2>{0.4536044f, 0.695123374f},
-std::array<float,2>{0.870126247f, 0.584041476f},
-std::array<float,2>{0.0501840375f, 0.121024974f},
-std::array<float,2>{0.533804595f, 0.441825509f},
-std::array<float,2>{0.437055945f, 0.996405542f},
-std::array<float,2>{0.694515586f, 0.786878705f},
-std::array<float,2>{0.34434551f, 0.35409686f},
-std::array<float,2>{0.982588947f, 0.188751668f},
-std::array<float,2>{0.232754692f, 0.667107761f},
-std::array<float,2>{0.564029694f, 0.735383749f},
-std::array<float,2>{0.484205097f, 0.164818034f},
-std::array<float,2>{0.764651418f, 0.282887757f},
-std::array<float,2>{0.121020049f, 0.843063533f},
-std::array<float,2>{0.918009818f, 0.884280384f},
-std::array<float,2>{0.140764102f, 0.390444398f},
-std::array<float,2>{0.680820346f, 0.00278893928f},
-std::array<float,2>{0.273427308f, 0.525817156f},
-std::array<float,2>{0.994425058f, 0.543609202f},
-std::array<float,2>{0.243525878f, 0.0600599013f},
-std::array<float,2>{0.713080585f, 0.424081832f},
-std::array<float,2>{0.360569805f, 0.907237291f},
-std::array<float,2>{0.55842346f, 0.864436209f},
-std::array<float,2>{0.416035801f, 0.266690493f},
-std::array<float,2>{0.850382626f, 0.144243404f},
-std::array<float,2>{0.0386788212f, 0.713535368f},
-std::array<float,2>{0.670043826f, 0.625885248f},
-std::array<float,2>{0.260964364f, 0.242643714f},
-std::array<float,2>{0.923996449f, 0.334136218f},
-std::array<float,2>{0.130044118f, 0.766527891f},
-std::array<float,2>{0.775854111f, 0.94908452f},
-std::array<float,2>{0.0937759951f, 0.491353899f},
-std::array<float,2>{0.590157211f, 0.0712448955f},
-std::array<float,2>{0.489193588f, 0.606435955f},
-std::array<float,2>{0.839299321f, 0.730475724f},
-std::array<float,2>{0.0255755018f, 0.181529194f},
-std::array<float,2>{0.508073747f, 0.302123487f},
-std::array<float,2>{0.395963967f, 0.818249881f},
-std::array<float,2>{0.732068598f, 0.891431451f},
-std::array<float,2>{0.343675047f, 0.398596615f},
-std::array<float,2>{0.950513482f, 0.0176545605f},
-std::array<float,2>{0.201001167f, 0.502475083f},
-std::array<float,2>{0.605696857f, 0.567571998f},
-std::array<float,2>{0.447186172f, 0.099323608f},
-std::array<float,2>{0.785186529f, 0.456420034f},
-std::array<float,2>{0.0680929646f, 0.975250125f},
-std::array<float,2>{0.881184757f, 0.8086707f},
-std::array<float,2>{0.175100103f, 0.361588061f},
-std::array<float,2>{0.646119475f, 0.218244314f},
-std::array<float,2>{0.290230125f, 0.686195195f},
-std::array<float,2>{0.92053932f, 0.666025937f},
-std::array<float,2>{0.144178659f, 0.187858433f},
-std::array<float,2>{0.683133483f, 0.355432719f},
-std::array<float,2>{0.270083994f, 0.785785258f},
-std::array<float,2>{0.566317499f, 0.997119904f},
-std::array<float,2>{0.481071174f, 0.442795336f},
-std::array<float,2>{0.762377679f, 0.119275205f},
-std::array<float,2>{0.119014204f, 0.585730791f},
-std::array<float,2>{0.692178607f, 0.527260184f},
-std::array<float,2>{0.346658528f, 0.00296619022f},
-std::array<float,2>{0.980626464f, 0.389402807f},
-std::array<float,2>{0.231406316f, 0.882882476f},
-std::array<float,2>{0.867739856f, 0.8419438f},
-std::array<float,2>{0.0481298529f, 0.281930953f},
-std::array<float,2>{0.532433271f, 0.165047213f},
-std::array<float,2>{0.435479343f, 0.734708309f},
-std::array<float,2>{0.804298162f, 0.616851807f},
-std::array<float,2>{0.0862432197f, 0.0867587402f},
-std::array<float,2>{0.612236917f, 0.481658787f},
-std::array<float,2>{0.455657363f, 0.962503314f},
-std::array<float,2>{0.632774293f, 0.754424632f},
-std::array<float,2>{0.306081802f, 0.324717432f},
-std::array<float,2>{0.893190265f, 0.231407419f},
-std::array<float,2>{0.159859255f, 0.651086152f},
-std::array<float,2>{0.518085241f, 0.693939865f},
-std::array<float,2>{0.37619403f, 0.132525444f},
-std::array<float,2>{0.818728983f, 0.25902158f},
-std::array<float,2>{0.00658016419f, 0.852492332f},
-std::array<float,2>{0.963318169f, 0.929915249f},
-std::array<float,2>{0.208208814f, 0.410033911f},
-std::array<float,2>{0.738919437f, 0.0428273641f},
-std::array<float,2>{0.314825058f, 0.556181729f},
-std::array<float,2>{0.903494656f, 0.586916268f},
-std::array<float,2>{0.170212537f, 0.110664509f},
-std::array<float,2>{0.638262093f, 0.445331573f},
-std::array<float,2>{0.298489809f, 0.984925568f},
-std::array<float,2>{0.624341369f, 0.794214904f},
-std::array<float,2>{0.461312175f, 0.348324597f},
-std::array<float,2>{0.809358418f, 0.199428305f},
-std::array<float,2>{0.0830706283f, 0.660134912f},
-std::array<float,2>{0.746170402f, 0.744441569f},
-std::array<float,2>{0.325008065f, 0.158994734f},
-std::array<float,2>{0.956438184f, 0.29114604f},
-std::array<float,2>{0.213233724f, 0.834597349f},
-std::array<float,2>{0.823957801f, 0.877890289f},
-std::array<float,2>{0.00845351629f, 0.378454596f},
-std::array<float,2>{0.528162718f, 0.0122732092f},
-std::array<float,2>{0.386342496f, 0.520985365f},
-std::array<float,2>{0.752100408f, 0.647017658f},
-std::array<float,2>{0.116448589f, 0.220000178f},
-std::array<float,2>{0.576539159f, 0.316278368f},
-std::array<float,2>{0.470350802f, 0.764128208f},
-std::array<float,2>{0.673235297f, 0.960547984f},
-std::array<float,2>{0.280655444f, 0.473510414f},
-std::array<float,2>{0.913419247f, 0.0811548233f},
-std::array<float,2>{0.15412052f, 0.621861994f},
-std::array<float,2>{0.5461393f, 0.55332309f},
-std::array<float,2>{0.424724698f, 0.0369679146f},
-std::array<float,2>{0.860368252f, 0.415077507f},
-std::array<float,2>{0.058723934f, 0.927709401f},
-std::array<float,2>{0.972318172f, 0.848891199f},
-std::array<float,2>{0.223641083f, 0.257215708f},
-std::array<float,2>{0.70300138f, 0.132826224f},
-std::array<float,2>{0.353946179f, 0.700505972f},
-std::array<float,2>{0.942289829f, 0.709090054f},
-std::array<float,2>{0.188355774f, 0.151427239f},
-std::array<float,2>{0.72538048f, 0.277475983f},
-std::array<float,2>{0.335142016f, 0.870106936f},
-std::array<float,2>{0.503201544f, 0.921717942f},
-std::array<float,2>{0.402557254f, 0.430992305f},
-std::array<float,2>{0.833514035f, 0.047252886f},
-std::array<float,2>{0.0228581689f, 0.532075644f},
-std::array<float,2>{0.652332485f, 0.594101787f},
-std::array<float,2>{0.288479209f, 0.0682648793f},
-std::array<float,2>{0.886954069f, 0.493542075f},
-std::array<float,2>{0.187008381f, 0.938937247f},
-std::array<float,2>{0.79293859f, 0.780219734f},
-std::array<float,2>{0.0704410672f, 0.337257594f},
-std::array<float,2>{0.598669529f, 0.23905538f},
-std::array<float,2>{0.439107686f, 0.639392495f},
-std::array<float,2>{0.856713891f, 0.5130018f},
-std::array<float,2>{0.0439534001f, 0.0255410746f},
-std::array<float,2>{0.554012775f, 0.393907398f},
-std::array<float,2>{0.40761131f, 0.900791049f},
-std::array<float,2>{0.703735232f, 0.820465326f},
-std::array<float,2>{0.37003386f, 0.310247064f},
-std::array<float,2>{0.991651952f, 0.175137535f},
-std::array<float,2>{0.236518353f, 0.72565949f},
-std::array<float,2>{0.579075515f, 0.672005713f},
-std::array<float,2>{0.496599734f, 0.209999546f},
-std::array<float,2>{0.771335423f, 0.374203324f},
-std::array<float,2>{0.104310662f, 0.802186251f},
-std::array<float,2>{0.933005273f, 0.98106432f},
-std::array<float,2>{0.134972826f, 0.461482555f},
-std::array<float,2>{0.660409212f, 0.108951524f},
-std::array<float,2>{0.251806259f, 0.575936496f},
-std::array<float,2>{0.957472503f, 0.605423272f},
-std::array<float,2>{0.216837436f, 0.0750122964f},
-std::array<float,2>{0.743966937f, 0.486209899f},
-std::array<float,2>{0.321101755f, 0.949495912f},
-std::array<float,2>{0.524675071f, 0.770096421f},
-std::array<float,2>{0.38831535f, 0.331851929f},
-std::array<float,2>{0.825827599f, 0.24672778f},
-std::array<float,2>{0.0135403629f, 0.632718861f},
-std::array<float,2>{0.635108948f, 0.715590537f},
-std::array<float,2>{0.300921321f, 0.147470146f},
-std::array<float,2>{0.899909616f, 0.273048967f},
-std::array<float,2>{0.167047724f, 0.862540305f},
-std::array<float,2>{0.806961894f, 0.913832307f},
-std::array<float,2>{0.0796189085f, 0.427742153f},
-std::array<float,2>{0.617676735f, 0.0556723811f},
-std::array<float,2>{0.467480659f, 0.54131031f},
-std::array<float,2>{0.865579545f, 0.681295693f},
-std::array<float,2>{0.0550570413f, 0.213495791f},
-std::array<float,2>{0.542891204f, 0.36710906f},
-std::array<float,2>{0.426768064f, 0.807340741f},
-std::array<float,2>{0.697577477f, 0.971375465f},
-std::array<float,2>{0.358528614f, 0.457796186f},
-std::array<float,2>{0.973111749f, 0.0949492678f},
-std::array<float,2>{0.219303414f, 0.563079417f},
-std::array<float,2>{0.572411299f, 0.507195532f},
-std::array<float,2>{0.47420609f, 0.0198247358f},
-std::array<float,2>{0.754358411f, 0.40489611f},
-std::array<float,2>{0.11253769f, 0.895424247f},
-std::array<float,2>{0.909792423f, 0.812528133f},
-std::array<float,2>{0.151420802f, 0.299656421f},
-std::array<float,2>{0.679391801f, 0.187135801f},
-std::array<float,2>{0.273778588f, 0.727132022f},
-std::array<float,2>{0.88362515f, 0.740798891f},
-std::array<float,2>{0.181809396f, 0.16911903f},
-std::array<float,2>{0.655712008f, 0.288830131f},
-std::array<float,2>{0.283687502f, 0.83695966f},
-std::array<float,2>{0.594435275f, 0.887697816f},
-std::array<float,2>{0.442552507f, 0.382843256f},
-std::array<float,2>{0.793579876f, 0.00446052011f},
-std::array<float,2>{0.0762889087f, 0.527759492f},
-std::array<float,2>{0.7196365f, 0.579009056f},
-std::array<float,2>{0.328599483f, 0.123105012f},
-std::array<float,2>{0.940738976f, 0.438189089f},
-std::array<float,2>{0.193362236f, 0.992372155f},
-std::array<float,2>{0.828740418f, 0.783438027f},
-std::array<float,2>{0.0169978794f, 0.356848657f},
-std::array<float,2>{0.505083978f, 0.192813963f},
-std::array<float,2>{0.400917441f, 0.671788275f},
-std::array<float,2>{0.766955554f, 0.561368048f},
-std::array<float,2>{0.106540285f, 0.0442447923f},
-std::array<float,2>{0.583364487f, 0.41301012f},
-std::array<float,2>{0.492830694f, 0.934538186f},
-std::array<float,2>{0.659424722f, 0.857270837f},
-std::array<float,2>{0.256131381f, 0.262894452f},
-std::array<float,2>{0.936320782f, 0.128150567f},
-std::array<float,2>{0.139288709f, 0.690236807f},
-std::array<float,2>{0.550319374f, 0.655855775f},
-std::array<float,2>{0.410513669f, 0.229386121f},
-std::array<float,2>{0.854854941f, 0.32204023f},
-std::array<float,2>{0.04105803f, 0.750131845f},
-std::array<float,2>{0.988268793f, 0.965676367f},
-std::array<float,2>{0.239540622f, 0.479501724f},
-std::array<float,2>{0.710207701f, 0.0906408653f},
-std::array<float,2>{0.373739034f, 0.611853838f},
-std::array<float,2>{0.92637682f, 0.51751411f},
-std::array<float,2>{0.127178371f, 0.0115217483f},
-std::array<float,2>{0.666937172f, 0.380437315f},
-std::array<float,2>{0.265023082f, 0.882790565f},
-std::array<float,2>{0.589246273f, 0.828726053f},
-std::array<float,2>{0.485987544f, 0.294946313f},
-std::array<float,2>{0.780460596f, 0.163517937f},
-std::array<float,2>{0.0995913073f, 0.748393118f},
-std::array<float,2>{0.716916084f, 0.661329627f},
-std::array<float,2>{0.365157038f, 0.196378946f},
-std::array<float,2>{0.998744607f, 0.346197277f},
-std::array<float,2>{0.248653248f, 0.791163862f},
-std::array<float,2>{0.845187783f, 0.990330637f},
-std::array<float,2>{0.0344322883f, 0.450869203f},
-std::array<float,2>{0.560613811f, 0.115318432f},
-std::array<float,2>{0.418527722f, 0.592525065f},
-std::array<float,2>{0.783317566f, 0.696403861f},
-std::array<float,2>{0.0631905422f, 0.140038252f},
-std::array<float,2>{0.603483677f, 0.252761632f},
-std::array<float,2>{0.449475139f, 0.845244765f},
-std::array<float,2>{0.643638015f, 0.924950659f},
-std::array<float,2>{0.294449687f, 0.419436872f},
-std::array<float,2>{0.876451969f, 0.0314580612f},
-std::array<float,2>{0.178558186f, 0.548948526f},
-std::array<float,2>{0.512506723f, 0.619477868f},
-std::array<float,2>{0.390764207f, 0.0835096687f},
-std::array<float,2>{0.843587339f, 0.469306499f},
-std::array<float,2>{0.0278216358f, 0.955957353f},
-std::array<float,2>{0.94703126f, 0.760480523f},
-std::array<float,2>{0.196847215f, 0.316549212f},
-std::array<float,2>{0.727246523f, 0.222754791f},
-std::array<float,2>{0.338326186f, 0.642288566f},
-std::array<float,2>{0.976841092f, 0.633212805f},
-std::array<float,2>{0.228577122f, 0.235720724f},
-std::array<float,2>{0.688283265f, 0.343104869f},
-std::array<float,2>{0.349110365f, 0.776010752f},
-std::array<float,2>{0.539054155f, 0.943892479f},
-std::array<float,2>{0.430578798f, 0.497760206f},
-std::array<float,2>{0.873300314f, 0.0639859065f},
-std::array<float,2>{0.0537237339f, 0.597677946f},
-std::array<float,2>{0.684194028f, 0.536460578f},
-std::array<float,2>{0.266516209f, 0.0527176037f},
-std::array<float,2>{0.915928304f, 0.435438424f},
-std::array<float,2>{0.146204159f, 0.915115416f},
-std::array<float,2>{0.761514783f, 0.87373668f},
-std::array<float,2>{0.123877808f, 0.276059002f},
-std::array<float,2>{0.566876054f, 0.15552634f},
-std::array<float,2>{0.477242023f, 0.705173731f},
-std::array<float,2>{0.81513387f, 0.573159635f},
-std::array<float,2>{0.00204056385f, 0.104985133f},
-std::array<float,2>{0.521348476f, 0.466330588f},
-std::array<float,2>{0.379871607f, 0.977095664f},
-std::array<float,2>{0.735971451f, 0.798393726f},
-std::array<float,2>{0.318318725f, 0.37008822f},
-std::array<float,2>{0.967743337f, 0.204040974f},
-std::array<float,2>{0.204741538f, 0.678590357f},
-std::array<float,2>{0.616307616f, 0.72239387f},
-std::array<float,2>{0.460275799f, 0.179615587f},
-std::array<float,2>{0.797023118f, 0.306603193f},
-std::array<float,2>{0.0913764313f, 0.824819267f},
-std::array<float,2>{0.896626055f, 0.903355241f},
-std::array<float,2>{0.162366167f, 0.397972018f},
-std::array<float,2>{0.625534058f, 0.0302664675f},
-std::array<float,2>{0.310183495f, 0.511436701f},
-std::array<float,2>{0.951611876f, 0.501819134f},
-std::array<float,2>{0.201492518f, 0.016272692f},
-std::array<float,2>{0.733388603f, 0.40095228f},
-std::array<float,2>{0.341402978f, 0.894517303f},
-std::array<float,2>{0.511498809f, 0.818680525f},
-std::array<float,2>{0.398013562f, 0.304166585f},
-std::array<float,2>{0.836799026f, 0.181715757f},
-std::array<float,2>{0.0243204404f, 0.734257102f},
-std::array<float,2>{0.647440612f, 0.684835017f},
-std::array<float,2>{0.292670518f, 0.215566948f},
-std::array<float,2>{0.879107833f, 0.360336661f},
-std::array<float,2>{0.173320785f, 0.811256647f},
-std::array<float,2>{0.787422657f, 0.973489046f},
-std::array<float,2>{0.0685213432f, 0.453412026f},
-std::array<float,2>{0.608639598f, 0.0997380316f},
-std::array<float,2>{0.447806925f, 0.570213258f},
-std::array<float,2>{0.84837991f, 0.712261736f},
-std::array<float,2>{0.0354213491f, 0.142544881f},
-std::array<float,2>{0.55654186f, 0.268301129f},
-std::array<float,2>{0.414914191f, 0.865243435f},
-std::array<float,2>{0.712048948f, 0.908411443f},
-std::array<float,2>{0.362960488f, 0.422324508f},
-std::array<float,2>{0.99367106f, 0.0623427816f},
-std::array<float,2>{0.244237825f, 0.545493722f},
-std::array<float,2>{0.592423558f, 0.608090043f},
-std::array<float,2>{0.492138386f, 0.0741043612f},
-std::array<float,2>{0.775132954f, 0.489162385f},
-std::array<float,2>{0.0965016112f, 0.945685387f},
-std::array<float,2>{0.923027873f, 0.76820761f},
-std::array<float,2>{0.130865395f, 0.333491564f},
-std::array<float,2>{0.668221831f, 0.245297045f},
-std::array<float,2>{0.259154141f, 0.628668964f},
-std::array<float,2>{0.891904473f, 0.649650216f},
-std::array<float,2>{0.157705516f, 0.233888015f},
-std::array<float,2>{0.630740106f, 0.327416271f},
-std::array<float,2>{0.307801962f, 0.75747484f},
-std::array<float,2>{0.609743595f, 0.963548779f},
-std::array<float,2>{0.453169823f, 0.482438654f},
-std::array<float,2>{0.801882565f, 0.0886540189f},
-std::array<float,2>{0.0898001194f, 0.614009082f},
-std::array<float,2>{0.741536617f, 0.557622492f},
-std::array<float,2>{0.313090444f, 0.040316768f},
-std::array<float,2>{0.961293399f, 0.406591475f},
-std::array<float,2>{0.209752649f, 0.932378709f},
-std::array<float,2>{0.818059921f, 0.854017973f},
-std::array<float,2>{0.00433265511f, 0.260907143f},
-std::array<float,2>{0.516358376f, 0.129992276f},
-std::array<float,2>{0.378794432f, 0.693201184f},
-std::array<float,2>{0.765050054f, 0.582069695f},
-std::array<float,2>{0.120739073f, 0.118357532f},
-std::array<float,2>{0.564301372f, 0.444337249f},
-std::array<float,2>{0.484005451f, 0.998295069f},
-std::array<float,2>{0.680914462f, 0.788513303f},
-std::array<float,2>{0.273086548f, 0.353489488f},
-std::array<float,2>{0.918298721f, 0.190709636f},
-std::array<float,2>{0.14103809f, 0.665336847f},
-std::array<float,2>{0.534053862f, 0.738163769f},
-std::array<float,2>{0.437441707f, 0.166703239f},
-std::array<float,2>{0.870409846f, 0.28400287f},
-std::array<float,2>{0.0498395003f, 0.840542912f},
-std::array<float,2>{0.982899368f, 0.885247529f},
-std::array<float,2>{0.232451618f, 0.388192594f},
-std::array<float,2>{0.694648087f, 0.000915579265f},
-std::array<float,2>{0.344724447f, 0.523570418f},
-std::array<float,2>{0.911533058f, 0.623922586f},
-std::array<float,2>{0.154369965f, 0.080005601f},
-std::array<float,2>{0.674835384f, 0.475605994f},
-std::array<float,2>{0.278194338f, 0.957154214f},
-std::array<float,2>{0.574374616f, 0.762723446f},
-std::array<float,2>{0.471058846f, 0.313663423f},
-std::array<float,2>{0.750644743f, 0.221167982f},
-std::array<float,2>{0.113959f, 0.646117151f},
-std::array<float,2>{0.700570881f, 0.70247823f},
-std::array<float,2>{0.353445947f, 0.135582253f},
-std::array<float,2>{0.970304012f, 0.254129648f},
-std::array<float,2>{0.22504425f, 0.850855947f},
-std::array<float,2>{0.863102376f, 0.929644644f},
-std::array<float,2>{0.0624797828f, 0.416244268f},
-std::array<float,2>{0.544196486f, 0.0376450568f},
-std::array<float,2>{0.422119945f, 0.552007437f},
-std::array<float,2>{0.811453998f, 0.657108068f},
-std::array<float,2>{0.0852788016f, 0.201391444f},
-std::array<float,2>{0.622507334f, 0.350174338f},
-std::array<float,2>{0.464805961f, 0.796008945f},
-std::array<float,2>{0.639391005f, 0.987758279f},
-std::array<float,2>{0.300759763f, 0.448035479f},
-std::array<float,2>{0.905837536f, 0.112425514f},
-std::array<float,2>{0.169652238f, 0.588303804f},
-std::array<float,2>{0.530828953f, 0.522913337f},
-std::array<float,2>{0.384085149f, 0.0145586627f},
-std::array<float,2>{0.821611583f, 0.376704872f},
-std::array<float,2>{0.0098059522f, 0.875409901f},
-std::array<float,2>{0.954493821f, 0.833629251f},
-std::array<float,2>{0.21218878f, 0.290526539f},
-std::array<float,2>{0.749976814f, 0.157554895f},
-std::array<float,2>{0.327225208f, 0.742414713f},
-std::array<float,2>{0.98942697f, 0.723628342f},
-std::array<float,2>{0.234538764f, 0.173737586f},
-std::array<float,2>{0.706834495f, 0.31124267f},
-std::array<float,2>{0.367725909f, 0.822507262f},
-std::array<float,2>{0.552552462f, 0.89859134f},
-std::array<float,2>{0.408266932f, 0.39133215f},
-std::array<float,2>{0.85819608f, 0.0252362899f},
-std::array<float,2>{0.0457388312f, 0.514878035f},
-std::array<float,2>{0.663779855f, 0.577410936f},
-std::array<float,2>{0.253616661f, 0.106988519f},
-std::array<float,2>{0.931009352f, 0.463187307f},
-std::array<float,2>{0.133757263f, 0.983518839f},
-std::array<float,2>{0.772469163f, 0.803590298f},
-std::array<float,2>{0.103212044f, 0.371794909f},
-std::array<float,2>{0.581667364f, 0.208639234f},
-std::array<float,2>{0.498288244f, 0.675774395f},
-std::array<float,2>{0.835248351f, 0.534024417f},
-std::array<float,2>{0.0197660234f, 0.0490995757f},
-std::array<float,2>{0.501738667f, 0.432780296f},
-std::array<float,2>{0.406140625f, 0.919445276f},
-std::array<float,2>{0.723833561f, 0.868091643f},
-std::array<float,2>{0.333438575f, 0.279751062f},
-std::array<float,2>{0.945270598f, 0.149788693f},
-std::array<float,2>{0.191125587f, 0.708141983f},
-std::array<float,2>{0.600662768f, 0.638058424f},
-std::array<float,2>{0.439917028f, 0.241790891f},
-std::array<float,2>{0.79087764f, 0.339706331f},
-std::array<float,2>{0.0740254447f, 0.778403342f},
-std::array<float,2>{0.889991701f, 0.941292048f},
-std::array<float,2>{0.184251249f, 0.49459222f},
-std::array<float,2>{0.650286913f, 0.0692813843f},
-std::array<float,2>{0.286293536f, 0.59654206f},
-std::array<float,2>{0.975886524f, 0.566364765f},
-std::array<float,2>{0.221333981f, 0.0957262442f},
-std::array<float,2>{0.69667381f, 0.459279031f},
-std::array<float,2>{0.35657531f, 0.969754279f},
-std::array<float,2>{0.539953947f, 0.806143045f},
-std::array<float,2>{0.429067373f, 0.364145041f},
-std::array<float,2>{0.864491761f, 0.211084336f},
-std::array<float,2>{0.0570552796f, 0.682602644f},
-std::array<float,2>{0.675794601f, 0.730168641f},
-std::array<float,2>{0.276597202f, 0.18393819f},
-std::array<float,2>{0.907031238f, 0.29820922f},
-std::array<float,2>{0.150112301f, 0.814485967f},
-std::array<float,2>{0.756989896f, 0.896890759f},
-std::array<float,2>{0.110547423f, 0.402874947f},
-std::array<float,2>{0.570391655f, 0.0215303879f},
-std::array<float,2>{0.474716067f, 0.504363179f},
-std::array<float,2>{0.826516151f, 0.628945172f},
-std::array<float,2>{0.0143968426f, 0.248295128f},
-std::array<float,2>{0.526828766f, 0.329424083f},
-std::array<float,2>{0.388870448f, 0.773164093f},
-std::array<float,2>{0.744177103f, 0.951974869f},
-std::array<float,2>{0.322946221f, 0.486756057f},
-std::array<float,2>{0.960124314f, 0.0772934183f},
-std::array<float,2>{0.215201229f, 0.601565957f},
-std::array<float,2>{0.620825291f, 0.539917707f},
-std::array<float,2>{0.466580659f, 0.0582796969f},
-std::array<float,2>{0.80546391f, 0.427157998f},
-std::array<float,2>{0.0808409452f, 0.911373019f},
-std::array<float,2>{0.900807858f, 0.859420359f},
-std::array<float,2>{0.164991349f, 0.270762712f},
-std::array<float,2>{0.632891178f, 0.145887479f},
-std::array<float,2>{0.303853482f, 0.718566895f},
-std::array<float,2>{0.935343921f, 0.688710272f},
-std::array<float,2>{0.138298154f, 0.12580134f},
-std::array<float,2>{0.657194674f, 0.263989866f},
-std::array<float,2>{0.254772037f, 0.857456267f},
-std::array<float,2>{0.584831774f, 0.935776055f},
-std::array<float,2>{0.495884657f, 0.410740077f},
-std::array<float,2>{0.767754018f, 0.0466607958f},
-std::array<float,2>{0.108918354f, 0.56052798f},
-std::array<float,2>{0.708724737f, 0.609989643f},
-std::array<float,2>{0.371304452f, 0.0935074612f},
-std::array<float,2>{0.984608114f, 0.476716399f},
-std::array<float,2>{0.241532981f, 0.967688799f},
-std::array<float,2>{0.8531124f, 0.75303334f},
-std::array<float,2>{0.0406910032f, 0.322861552f},
-std::array<float,2>{0.547119975f, 0.227369726f},
-std::array<float,2>{0.413430482f, 0.653363168f},
-std::array<float,2>{0.79497385f, 0.529614508f},
-std::array<float,2>{0.0749546364f, 0.00632527983f},
-std::array<float,2>{0.596734107f, 0.385823816f},
-std::array<float,2>{0.443915576f, 0.888716638f},
-std::array<float,2>{0.653696001f, 0.839378774f},
-std::array<float,2>{0.282757193f, 0.286951303f},
-std::array<float,2>{0.886631966f, 0.17090185f},
-std::array<float,2>{0.180077195f, 0.738786161f},
-std::array<float,2>{0.507259667f, 0.668513179f},
-std::array<float,2>{0.400129706f, 0.194482476f},
-std::array<float,2>{0.83048439f, 0.358646125f},
-std::array<float,2>{0.0187976714f, 0.781313658f},
-std::array<float,2>{0.938059747f, 0.994409025f},
-std::array<float,2>{0.192843482f, 0.440426499f},
-std::array<float,2>{0.720741212f, 0.12214765f},
-std::array<float,2>{0.330343813f, 0.581506312f},
-std::array<float,2>{0.878120244f, 0.547128797f},
-std::array<float,2>{0.176930219f, 0.0335595496f},
-std::array<float,2>{0.641548157f, 0.421660393f},
-std::array<float,2>{0.296252489f, 0.922564566f},
-std::array<float,2>{0.604246438f, 0.847606599f},
-std::array<float,2>{0.452090174f, 0.250000507f},
-std::array<float,2>{0.782627463f, 0.138592035f},
-std::array<float,2>{0.0658133179f, 0.697798133f},
-std::array<float,2>{0.729100823f, 0.643769562f},
-std::array<float,2>{0.337723702f, 0.226192757f},
-std::array<float,2>{0.947962403f, 0.320063204f},
-std::array<float,2>{0.199086696f, 0.758975565f},
-std::array<float,2>{0.840922832f, 0.954523206f},
-std::array<float,2>{0.0295603611f, 0.470850348f},
-std::array<float,2>{0.513969302f, 0.0846972093f},
-std::array<float,2>{0.394240022f, 0.617629945f},
-std::array<float,2>{0.778194785f, 0.747625887f},
-std::array<float,2>{0.101230443f, 0.161060169f},
-std::array<float,2>{0.587157547f, 0.293549895f},
-std::array<float,2>{0.488248169f, 0.831698179f},
-std::array<float,2>{0.664753318f, 0.879833698f},
-std::array<float,2>{0.26229018f, 0.382258952f},
-std::array<float,2>{0.92785573f, 0.00966697372f},
-std::array<float,2>{0.12527445f, 0.518277645f},
-std::array<float,2>{0.56016314f, 0.5904603f},
-std::array<float,2>{0.420971781f, 0.113870248f},
-std::array<float,2>{0.847042322f, 0.451413155f},
-std::array<float,2>{0.032561712f, 0.988885641f},
-std::array<float,2>{0.997629464f, 0.789137065f},
-std::array<float,2>{0.247759685f, 0.344338417f},
-std::array<float,2>{0.715434134f, 0.199187383f},
-std::array<float,2>{0.3667292f, 0.663170934f},
-std::array<float,2>{0.965567708f, 0.677218497f},
-std::array<float,2>{0.205705658f, 0.206914648f},
-std::array<float,2>{0.737604678f, 0.367497593f},
-std::array<float,2>{0.319919646f, 0.799659193f},
-std::array<float,2>{0.521760702f, 0.978624761f},
-std::array<float,2>{0.381981522f, 0.468153536f},
-std::array<float,2>{0.813740849f, 0.1021052f},
-std::array<float,2>{0.00193542766f, 0.570900083f},
-std::array<float,2>{0.627044261f, 0.509652197f},
-std::array<float,2>{0.311946213f, 0.0276680868f},
-std::array<float,2>{0.894667268f, 0.395163178f},
-std::array<float,2>{0.161483049f, 0.905609906f},
-std::array<float,2>{0.799601793f, 0.826803982f},
-std::array<float,2>{0.0920291469f, 0.308324218f},
-std::array<float,2>{0.614554048f, 0.177241713f},
-std::array<float,2>{0.457422644f, 0.719025493f},
-std::array<float,2>{0.872521698f, 0.601467013f},
-std::array<float,2>{0.0509322695f, 0.0659169629f},
-std::array<float,2>{0.536198616f, 0.499083668f},
-std::array<float,2>{0.43247965f, 0.942234457f},
-std::array<float,2>{0.690840364f, 0.775021315f},
-std::array<float,2>{0.350210428f, 0.340899795f},
-std::array<float,2>{0.978990495f, 0.237636864f},
-std::array<float,2>{0.22761935f, 0.636263788f},
-std::array<float,2>{0.569143474f, 0.705007017f},
-std::array<float,2>{0.47940284f, 0.152873337f},
-std::array<float,2>{0.75812459f, 0.273684889f},
-std::array<float,2>{0.121995427f, 0.872081161f},
-std::array<float,2>{0.917516768f, 0.917488396f},
-std::array<float,2>{0.148422599f, 0.436312854f},
-std::array<float,2>{0.685774386f, 0.0534736365f},
-std::array<float,2>{0.268598318f, 0.537416279f},
-std::array<float,2>{0.982038438f, 0.525034845f},
-std::array<float,2>{0.232184991f, 0.00169529684f},
-std::array<float,2>{0.693140924f, 0.386777431f},
-std::array<float,2>{0.346895695f, 0.885855556f},
-std::array<float,2>{0.532186806f, 0.84165585f},
-std::array<float,2>{0.434449077f, 0.284361482f},
-std::array<float,2>{0.868930101f, 0.167822719f},
-std::array<float,2>{0.0475956202f, 0.737040997f},
-std::array<float,2>{0.68176055f, 0.664251924f},
-std::array<float,2>{0.270786166f, 0.190349564f},
-std::array<float,2>{0.921033919f, 0.352221549f},
-std::array<float,2>{0.143109098f, 0.78734839f},
-std::array<float,2>{0.763598204f, 0.999031782f},
-std::array<float,2>{0.117736861f, 0.443601698f},
-std::array<float,2>{0.565312028f, 0.11725688f},
-std::array<float,2>{0.482077986f, 0.583076537f},
-std::array<float,2>{0.819373131f, 0.691894889f},
-std::array<float,2>{0.00755112479f, 0.129184753f},
-std::array<float,2>{0.519180536f, 0.260490209f},
-std::array<float,2>{0.375578225f, 0.854613423f},
-std::array<float,2>{0.739996672f, 0.933059752f},
-std::array<float,2>{0.316331446f, 0.408190936f},
-std::array<float,2>{0.964549482f, 0.0395659357f},
-std::array<float,2>{0.207948357f, 0.557215929f},
-std::array<float,2>{0.612715065f, 0.614581645f},
-std::array<float,2>{0.456113368f, 0.0898080766f},
-std::array<float,2>{0.80284667f, 0.483984113f},
-std::array<float,2>{0.0869157761f, 0.964252472f},
-std::array<float,2>{0.894456148f, 0.756773233f},
-std::array<float,2>{0.158414617f, 0.327081949f},
-std::array<float,2>{0.631135166f, 0.232902914f},
-std::array<float,2>{0.304825783f, 0.648951888f},
-std::array<float,2>{0.925766408f, 0.627136648f},
-std::array<float,2>{0.128938511f, 0.244508237f},
-std::array<float,2>{0.670940578f, 0.332476348f},
-std::array<float,2>{0.260685802f, 0.768903017f},
-std::array<float,2>{0.590979457f, 0.946889877f},
-std::array<float,2>{0.489539653f, 0.489716619f},
-std::array<float,2>{0.777023137f, 0.0730401874f},
-std::array<float,2>{0.0952508003f, 0.609056234f},
-std::array<float,2>{0.714405537f, 0.546368957f},
-std::array<float,2>{0.360190541f, 0.0613990463f},
-std::array<float,2>{0.995850503f, 0.422998726f},
-std::array<float,2>{0.242911771f, 0.909732997f},
-std::array<float,2>{0.850696504f, 0.86645937f},
-std::array<float,2>{0.0374437161f, 0.268968374f},
-std::array<float,2>{0.557616353f, 0.141356647f},
-std::array<float,2>{0.417680025f, 0.711552382f},
-std::array<float,2>{0.786435485f, 0.568385005f},
-std::array<float,2>{0.0668703467f, 0.100780636f},
-std::array<float,2>{0.606705368f, 0.454932362f},
-std::array<float,2>{0.445314556f, 0.974592686f},
-std::array<float,2>{0.644968212f, 0.812494636f},
-std::array<float,2>{0.289067f, 0.360587269f},
-std::array<float,2>{0.882235289f, 0.216017202f},
-std::array<float,2>{0.173870325f, 0.684438288f},
-std::array<float,2>{0.509487748f, 0.732512772f},
-std::array<float,2>{0.394573599f, 0.182832256f},
-std::array<float,2>{0.83796972f, 0.303094149f},
-std::array<float,2>{0.0267049074f, 0.819503546f},
-std::array<float,2>{0.95009464f, 0.892773926f},
-std::array<float,2>{0.199307412f, 0.401367933f},
-std::array<float,2>{0.730649114f, 0.0169410147f},
-std::array<float,2>{0.342296541f, 0.500294328f},
-std::array<float,2>{0.887843966f, 0.596939087f},
-std::array<float,2>{0.185818911f, 0.0702264756f},
-std::array<float,2>{0.65040344f, 0.495834649f},
-std::array<float,2>{0.287629247f, 0.940312803f},
-std::array<float,2>{0.597818911f, 0.777630985f},
-std::array<float,2>{0.437848389f, 0.338516384f},
-std::array<float,2>{0.791895151f, 0.24032186f},
-std::array<float,2>{0.0721368715f, 0.636760294f},
-std::array<float,2>{0.726017952f, 0.707357943f},
-std::array<float,2>{0.334128201f, 0.14909251f},
-std::array<float,2>{0.942502797f, 0.28093636f},
-std::array<float,2>{0.188976601f, 0.869013727f},
-std::array<float,2>{0.83240056f, 0.918741465f},
-std::array<float,2>{0.022360485f, 0.432121217f},
-std::array<float,2>{0.502450407f, 0.0502306335f},
-std::array<float,2>{0.404003173f, 0.534882843f},
-std::array<float,2>{0.770258307f, 0.674742281f},
-std::array<float,2>{0.104914732f, 0.207635373f},
-std::array<float,2>{0.57991904f, 0.372445464f},
-std::array<float,2>{0.497429192f, 0.804149568f},
-std::array<float,2>{0.661860585f, 0.982441306f},
-std::array<float,2>{0.25085476f, 0.464796275f},
-std::array<float,2>{0.932566643f, 0.106128134f},
-std::array<float,2>{0.13587366f, 0.576459885f},
-std::array<float,2>{0.552971065f, 0.513724387f},
-std::array<float,2>{0.40669626f, 0.0243090764f},
-std::array<float,2>{0.856274903f, 0.392427683f},
-std::array<float,2>{0.0431003459f, 0.899419129f},
-std::array<float,2>{0.990784109f, 0.823397636f},
-std::array<float,2>{0.238106683f, 0.311932564f},
-std::array<float,2>{0.704655707f, 0.172205776f},
-std::array<float,2>{0.370329112f, 0.724434197f},
-std::array<float,2>{0.955096364f, 0.743399441f},
-std::array<float,2>{0.214678764f, 0.156777471f},
-std::array<float,2>{0.74787432f, 0.289775282f},
-std::array<float,2>{0.3260158f, 0.83295244f},
-std::array<float,2>{0.529183388f, 0.876776755f},
-std::array<float,2>{0.384846687f, 0.375482172f},
-std::array<float,2>{0.822822928f, 0.0151606118f},
-std::array<float,2>{0.00899405498f, 0.522152722f},
-std::array<float,2>{0.637673378f, 0.589468896f},
-std::array<float,2>{0.297287911f, 0.111871131f},
-std::array<float,2>{0.902602255f, 0.448510826f},
-std::array<float,2>{0.170900017f, 0.987106621f},
-std::array<float,2>{0.809694707f, 0.794983506f},
-std::array<float,2>{0.0822166502f, 0.351094872f},
-std::array<float,2>{0.6238904f, 0.202451035f},
-std::array<float,2>{0.462704182f, 0.657681108f},
-std::array<float,2>{0.859892905f, 0.551091969f},
-std::array<float,2>{0.0601477474f, 0.0384097286f},
-std::array<float,2>{0.544999421f, 0.417726189f},
-std::array<float,2>{0.425023645f, 0.928344667f},
-std::array<float,2>{0.70168972f, 0.849756181f},
-std::array<float,2>{0.354614705f, 0.255452991f},
-std::array<float,2>{0.971278369f, 0.136497259f},
-std::array<float,2>{0.22300224f, 0.701312125f},
-std::array<float,2>{0.577926397f, 0.644616008f},
-std::array<float,2>{0.468791425f, 0.222172901f},
-std::array<float,2>{0.753278673f, 0.312563479f},
-std::array<float,2>{0.116108857f, 0.761807859f},
-std::array<float,2>{0.912131071f, 0.958355963f},
-std::array<float,2>{0.152804747f, 0.47523424f},
-std::array<float,2>{0.67226392f, 0.0786566213f},
-std::array<float,2>{0.279297233f, 0.624755979f},
-std::array<float,2>{0.939925134f, 0.580269814f},
-std::array<float,2>{0.194710597f, 0.121634938f},
-std::array<float,2>{0.720546186f, 0.440539926f},
-std::array<float,2>{0.329664469f, 0.995855272f},
-std::array<float,2>{0.504451334f, 0.782898426f},
-std::array<float,2>{0.401837587f, 0.3576186f},
-std::array<float,2>{0.830020189f, 0.193858534f},
-std::array<float,2>{0.0163353998f, 0.66946435f},
-std::array<float,2>{0.654836535f, 0.739424288f},
-std::array<float,2>{0.285054952f, 0.170056805f},
-std::array<float,2>{0.883909404f, 0.285937458f},
-std::array<float,2>{0.18287386f, 0.838252842f},
-std::array<float,2>{0.794349372f, 0.889905334f},
-std::array<float,2>{0.0773090124f, 0.385184407f},
-std::array<float,2>{0.594937503f, 0.0069139353f},
-std::array<float,2>{0.441438437f, 0.530420184f},
-std::array<float,2>{0.853534758f, 0.652765214f},
-std::array<float,2>{0.0428013802f, 0.228089929f},
-std::array<float,2>{0.549258411f, 0.323762923f},
-std::array<float,2>{0.41210708f, 0.752767622f},
-std::array<float,2>{0.709226787f, 0.968749523f},
-std::array<float,2>{0.37438786f, 0.477963001f},
-std::array<float,2>{0.987082064f, 0.0923742279f},
-std::array<float,2>{0.238784656f, 0.611072659f},
-std::array<float,2>{0.582464695f, 0.559316278f},
-std::array<float,2>{0.493875295f, 0.045344159f},
-std::array<float,2>{0.766135097f, 0.411882967f},
-std::array<float,2>{0.105990879f, 0.937185764f},
-std::array<float,2>{0.937104106f, 0.858799696f},
-std::array<float,2>{0.139905185f, 0.264702499f},
-std::array<float,2>{0.658652246f, 0.12639147f},
-std::array<float,2>{0.257417023f, 0.687771797f},
-std::array<float,2>{0.898923695f, 0.716840565f},
-std::array<float,2>{0.166667297f, 0.145285696f},
-std::array<float,2>{0.636610448f, 0.270088613f},
-std::array<float,2>{0.302164137f, 0.860511124f},
-std::array<float,2>{0.618166804f, 0.911074698f},
-std::array<float,2>{0.468388408f, 0.426745385f},
-std::array<float,2>{0.807680011f, 0.0571497716f},
-std::array<float,2>{0.0786012411f, 0.540244043f},
-std::array<float,2>{0.742824972f, 0.602663815f},
-std::array<float,2>{0.321507603f, 0.0763623491f},
-std::array<float,2>{0.958189368f, 0.488044947f},
-std::array<float,2>{0.217883185f, 0.952867627f},
-std::array<float,2>{0.824679255f, 0.77230829f},
-std::array<float,2>{0.0121985059f, 0.328546733f},
-std::array<float,2>{0.524151683f, 0.249833256f},
-std::array<float,2>{0.387224019f, 0.630693495f},
-std::array<float,2>{0.754896462f, 0.505323708f},
-std::array<float,2>{0.111752212f, 0.0224722624f},
-std::array<float,2>{0.57340765f, 0.403875053f},
-std::array<float,2>{0.472776711f, 0.898398161f},
-std::array<float,2>{0.67807889f, 0.815527737f},
-std::array<float,2>{0.275043756f, 0.297371715f},
-std::array<float,2>{0.90898633f, 0.185313433f},
-std::array<float,2>{0.150914535f, 0.728746951f},
-std::array<float,2>{0.541338921f, 0.683311343f},
-std::array<float,2>{0.426542848f, 0.212239727f},
-std::array<float,2>{0.866579831f, 0.364899963f},
-std::array<float,2>{0.0559850074f, 0.804749012f},
-std::array<float,2>{0.973861217f, 0.96967715f},
-std::array<float,2>{0.219917625f, 0.460819036f},
-std::array<float,2>{0.698976636f, 0.0973344892f},
-std::array<float,2>{0.35803929f, 0.565319121f},
-std::array<float,2>{0.914434075f, 0.538336515f},
-std::array<float,2>{0.144890189f, 0.0538658351f},
-std::array<float,2>{0.684814453f, 0.43683067f},
-std::array<float,2>{0.267091691f, 0.916306853f},
-std::array<float,2>{0.567654848f, 0.871236026f},
-std::array<float,2>{0.477773666f, 0.275374025f},
-std::array<float,2>{0.760288954f, 0.153435588f},
-std::array<float,2>{0.12450619f, 0.703720748f},
-std::array<float,2>{0.689208269f, 0.634846032f},
-std::array<float,2>{0.347874314f, 0.237106144f},
-std::array<float,2>{0.977943242f, 0.340275854f},
-std::array<float,2>{0.230164319f, 0.773628235f},
-std::array<float,2>{0.87464273f, 0.943300068f},
-std::array<float,2>{0.0536402464f, 0.498067945f},
-std::array<float,2>{0.537926793f, 0.0650268793f},
-std::array<float,2>{0.431328475f, 0.599868774f},
-std::array<float,2>{0.798152745f, 0.720459282f},
-std::array<float,2>{0.0902880058f, 0.176607877f},
-std::array<float,2>{0.616080523f, 0.307081521f},
-std::array<float,2>{0.459766209f, 0.827686071f},
-std::array<float,2>{0.626552224f, 0.904999137f},
-std::array<float,2>{0.309396029f, 0.39555499f},
-std::array<float,2>{0.89812696f, 0.0284126662f},
-std::array<float,2>{0.163196474f, 0.508365512f},
-std::array<float,2>{0.519612551f, 0.571384192f},
-std::array<float,2>{0.380333662f, 0.102606483f},
-std::array<float,2>{0.816081762f, 0.467406869f},
-std::array<float,2>{0.00359712448f, 0.980201483f},
-std::array<float,2>{0.968566954f, 0.800475478f},
-std::array<float,2>{0.204029828f, 0.368490309f},
-std::array<float,2>{0.735066473f, 0.205821484f},
-std::array<float,2>{0.317034721f, 0.675822735f},
-std::array<float,2>{0.99932009f, 0.662233591f},
-std::array<float,2>{0.249806151f, 0.198144287f},
-std::array<float,2>{0.718419492f, 0.345543802f},
-std::array<float,2>{0.364241928f, 0.790089548f},
-std::array<float,2>{0.562073946f, 0.989858031f},
-std::array<float,2>{0.419204503f, 0.452329248f},
-std::array<float,2>{0.843937814f, 0.11456985f},
-std::array<float,2>{0.0338330232f, 0.591722429f},
-std::array<float,2>{0.667060673f, 0.518841922f},
-std::array<float,2>{0.263793856f, 0.0083179567f},
-std::array<float,2>{0.927156746f, 0.381787866f},
-std::array<float,2>{0.128303722f, 0.880672812f},
-std::array<float,2>{0.779531121f, 0.830992043f},
-std::array<float,2>{0.0977107882f, 0.294430375f},
-std::array<float,2>{0.588326335f, 0.161483392f},
-std::array<float,2>{0.484861165f, 0.74682647f},
-std::array<float,2>{0.842730999f, 0.619114995f},
-std::array<float,2>{0.0286852233f, 0.0852620229f},
-std::array<float,2>{0.512783587f, 0.472548246f},
-std::array<float,2>{0.391644984f, 0.953335583f},
-std::array<float,2>{0.728443503f, 0.758180201f},
-std::array<float,2>{0.339708328f, 0.318866014f},
-std::array<float,2>{0.945737541f, 0.224785045f},
-std::array<float,2>{0.196271971f, 0.642808914f},
-std::array<float,2>{0.602358341f, 0.698524177f},
-std::array<float,2>{0.450987577f, 0.136901155f},
-std::array<float,2>{0.784293056f, 0.25117901f},
-std::array<float,2>{0.0638970137f, 0.846649647f},
-std::array<float,2>{0.875189126f, 0.923458517f},
-std::array<float,2>{0.17906034f, 0.420482755f},
-std::array<float,2>{0.643393517f, 0.0344953761f},
-std::array<float,2>{0.293391347f, 0.548394859f},
-std::array<float,2>{0.962024927f, 0.554791808f},
-std::array<float,2>{0.210490227f, 0.0411708951f},
-std::array<float,2>{0.740430295f, 0.408908725f},
-std::array<float,2>{0.313510537f, 0.930777609f},
-std::array<float,2>{0.517268717f, 0.85266161f},
-std::array<float,2>{0.377035499f, 0.257986248f},
-std::array<float,2>{0.816931784f, 0.131066114f},
-std::array<float,2>{0.00559868244f, 0.694521666f},
-std::array<float,2>{0.629745901f, 0.65155673f},
-std::array<float,2>{0.306824178f, 0.232361242f},
-std::array<float,2>{0.891439438f, 0.325291276f},
-std::array<float,2>{0.157186002f, 0.755427301f},
-std::array<float,2>{0.800886452f, 0.961093962f},
-std::array<float,2>{0.0887323916f, 0.48069191f},
-std::array<float,2>{0.611074328f, 0.0876459703f},
-std::array<float,2>{0.454549104f, 0.61594075f},
-std::array<float,2>{0.869796515f, 0.736240864f},
-std::array<float,2>{0.0491956994f, 0.164229825f},
-std::array<float,2>{0.5349558f, 0.282462627f},
-std::array<float,2>{0.435878903f, 0.843352437f},
-std::array<float,2>{0.693716168f, 0.884031534f},
-std::array<float,2>{0.345335752f, 0.389815331f},
-std::array<float,2>{0.983691752f, 0.00222959835f},
-std::array<float,2>{0.234236449f, 0.526305437f},
-std::array<float,2>{0.562879801f, 0.584826171f},
-std::array<float,2>{0.482893586f, 0.120405264f},
-std::array<float,2>{0.764407337f, 0.442044795f},
-std::array<float,2>{0.119692713f, 0.996997237f},
-std::array<float,2>{0.9194718f, 0.786604345f},
-std::array<float,2>{0.142245427f, 0.353812665f},
-std::array<float,2>{0.680383146f, 0.189021409f},
-std::array<float,2>{0.271670848f, 0.667684376f},
-std::array<float,2>{0.880677164f, 0.686978161f},
-std::array<float,2>{0.172826871f, 0.217757046f},
-std::array<float,2>{0.647909403f, 0.362591177f},
-std::array<float,2>{0.291886866f, 0.809852421f},
-std::array<float,2>{0.608020306f, 0.976325512f},
-std::array<float,2>{0.449032545f, 0.455677569f},
-std::array<float,2>{0.788512886f, 0.0979511961f},
-std::array<float,2>{0.0694606528f, 0.566692173f},
-std::array<float,2>{0.734098196f, 0.502975404f},
-std::array<float,2>{0.340732366f, 0.0194942597f},
-std::array<float,2>{0.952760875f, 0.399946898f},
-std::array<float,2>{0.203070372f, 0.892539799f},
-std::array<float,2>{0.837175012f, 0.817317963f},
-std::array<float,2>{0.0251190644f, 0.301237941f},
-std::array<float,2>{0.509955645f, 0.180334494f},
-std::array<float,2>{0.397317737f, 0.732387841f},
-std::array<float,2>{0.774327517f, 0.607370079f},
-std::array<float,2>{0.0968824178f, 0.0718346164f},
-std::array<float,2>{0.593665659f, 0.490605414f},
-std::array<float,2>{0.490623981f, 0.94780308f},
-std::array<float,2>{0.669221461f, 0.767342031f},
-std::array<float,2>{0.25836271f, 0.33562997f},
-std::array<float,2>{0.922693372f, 0.243920952f},
-std::array<float,2>{0.132758349f, 0.626119137f},
-std::array<float,2>{0.555323005f, 0.714313507f},
-std::array<float,2>{0.415305912f, 0.143318176f},
-std::array<float,2>{0.849533737f, 0.265797198f},
-std::array<float,2>{0.0365094319f, 0.863802671f},
-std::array<float,2>{0.992918849f, 0.906332254f},
-std::array<float,2>{0.245820865f, 0.424986333f},
-std::array<float,2>{0.711256742f, 0.058842916f},
-std::array<float,2>{0.362298697f, 0.544892848f},
-std::array<float,2>{0.929985464f, 0.574584782f},
-std::array<float,2>{0.134543136f, 0.108237527f},
-std::array<float,2>{0.662855148f, 0.461998552f},
-std::array<float,2>{0.252275556f, 0.982181966f},
-std::array<float,2>{0.580358803f, 0.800895929f},
-std::array<float,2>{0.499472767f, 0.373704493f},
-std::array<float,2>{0.77225858f, 0.209597036f},
-std::array<float,2>{0.10226047f, 0.673022211f},
-std::array<float,2>{0.705858648f, 0.725316167f},
-std::array<float,2>{0.36901328f, 0.174250394f},
-std::array<float,2>{0.98870945f, 0.30862093f},
-std::array<float,2>{0.236145049f, 0.821513295f},
-std::array<float,2>{0.859318376f, 0.901427805f},
-std::array<float,2>{0.0466599539f, 0.392830193f},
-std::array<float,2>{0.551438451f, 0.0267881975f},
-std::array<float,2>{0.409284264f, 0.512465358f},
-std::array<float,2>{0.789139032f, 0.639652371f},
-std::array<float,2>{0.0723612532f, 0.239954248f},
-std::array<float,2>{0.600334644f, 0.336047292f},
-std::array<float,2>{0.440467685f, 0.780684173f},
-std::array<float,2>{0.649002254f, 0.937807262f},
-std::array<float,2>{0.285816312f, 0.492436856f},
-std::array<float,2>{0.889598489f, 0.0665537715f},
-std::array<float,2>{0.185371205f, 0.59566474f},
-std::array<float,2>{0.500073493f, 0.532632113f},
-std::array<float,2>{0.404448032f, 0.048083134f},
-std::array<float,2>{0.83418411f, 0.429780543f},
-std::array<float,2>{0.0207177065f, 0.920400679f},
-std::array<float,2>{0.943527639f, 0.870990753f},
-std::array<float,2>{0.189535484f, 0.278743297f},
-std::array<float,2>{0.722729445f, 0.150487736f},
-std::array<float,2>{0.332243592f, 0.710221529f},
-std::array<float,2>{0.969502151f, 0.699685693f},
-std::array<float,2>{0.226519987f, 0.133972928f},
-std::array<float,2>{0.699276507f, 0.256476879f},
-std::array<float,2>{0.352284014f, 0.847830415f},
-std::array<float,2>{0.543115497f, 0.92580688f},
-std::array<float,2>{0.423458874f, 0.41465497f},
-std::array<float,2>{0.861534774f, 0.0358181782f},
-std::array<float,2>{0.0610770881f, 0.553800941f},
-std::array<float,2>{0.674125075f, 0.622362852f},
-std::array<float,2>{0.278742105f, 0.0808155835f},
-std::array<float,2>{0.910734355f, 0.473783553f},
-std::array<float,2>{0.155497909f, 0.959575057f},
-std::array<float,2>{0.751308322f, 0.764929831f},
-std::array<float,2>{0.114941858f, 0.315035343f},
-std::array<float,2>{0.575227439f, 0.219161093f},
-std::array<float,2>{0.472184479f, 0.647670507f},
-std::array<float,2>{0.820864558f, 0.520297468f},
-std::array<float,2>{0.0114054941f, 0.0127233891f},
-std::array<float,2>{0.529318631f, 0.377622545f},
-std::array<float,2>{0.383439392f, 0.87804383f},
-std::array<float,2>{0.74841404f, 0.835069656f},
-std::array<float,2>{0.326751739f, 0.292939425f},
-std::array<float,2>{0.953962624f, 0.159355104f},
-std::array<float,2>{0.211823285f, 0.745675206f},
-std::array<float,2>{0.621725321f, 0.658355534f},
-std::array<float,2>{0.463752896f, 0.20045948f},
-std::array<float,2>{0.811737835f, 0.348957896f},
-std::array<float,2>{0.0849508122f, 0.793876588f},
-std::array<float,2>{0.904822826f, 0.985458493f},
-std::array<float,2>{0.168018296f, 0.446917981f},
-std::array<float,2>{0.64032197f, 0.109412298f},
-std::array<float,2>{0.299498439f, 0.586234987f},
-std::array<float,2>{0.985497713f, 0.612721682f},
-std::array<float,2>{0.240441844f, 0.0911677554f},
-std::array<float,2>{0.707328379f, 0.478939384f},
-std::array<float,2>{0.37287721f, 0.966389596f},
-std::array<float,2>{0.548174679f, 0.751148343f},
-std::array<float,2>{0.412648946f, 0.320390552f},
-std::array<float,2>{0.852169991f, 0.229502961f},
-std::array<float,2>{0.039928712f, 0.654686749f},
-std::array<float,2>{0.657890201f, 0.690852165f},
-std::array<float,2>{0.254901707f, 0.127445534f},
-std::array<float,2>{0.933725834f, 0.262605727f},
-std::array<float,2>{0.137491196f, 0.855648756f},
-std::array<float,2>{0.768897474f, 0.934860349f},
-std::array<float,2>{0.107470684f, 0.413442701f},
-std::array<float,2>{0.585414469f, 0.043754559f},
-std::array<float,2>{0.494837254f, 0.561528206f},
-std::array<float,2>{0.831062913f, 0.670670986f},
-std::array<float,2>{0.0176615547f, 0.192017928f},
-std::array<float,2>{0.506441176f, 0.355905116f},
-std::array<float,2>{0.398467511f, 0.784196734f},
-std::array<float,2>{0.722256482f, 0.993642926f},
-std::array<float,2>{0.331683338f, 0.439146847f},
-std::array<float,2>{0.938659608f, 0.124467753f},
-std::array<float,2>{0.192346618f, 0.579671741f},
-std::array<float,2>{0.595768571f, 0.528995991f},
-std::array<float,2>{0.444985718f, 0.00567010883f},
-std::array<float,2>{0.796054721f, 0.384237438f},
-std::array<float,2>{0.0757778063f, 0.886777103f},
-std::array<float,2>{0.885399044f, 0.836881161f},
-std::array<float,2>{0.18100135f, 0.287965178f},
-std::array<float,2>{0.653078914f, 0.167984307f},
-std::array<float,2>{0.281880945f, 0.741320968f},
-std::array<float,2>{0.90800488f, 0.727921665f},
-std::array<float,2>{0.149216831f, 0.18605417f},
-std::array<float,2>{0.677189291f, 0.300727695f},
-std::array<float,2>{0.276247203f, 0.814439833f},
-std::array<float,2>{0.571605384f, 0.895862758f},
-std::array<float,2>{0.475919813f, 0.405619591f},
-std::array<float,2>{0.755996525f, 0.0211446919f},
-std::array<float,2>{0.110166036f, 0.505949259f},
-std::array<float,2>{0.696061194f, 0.564100087f},
-std::array<float,2>{0.356379271f, 0.0938496068f},
-std::array<float,2>{0.975325048f, 0.458611935f},
-std::array<float,2>{0.222008765f, 0.9719069f},
-std::array<float,2>{0.863994837f, 0.807649493f},
-std::array<float,2>{0.0583914369f, 0.365373552f},
-std::array<float,2>{0.540183306f, 0.214498207f},
-std::array<float,2>{0.428270221f, 0.679784834f},
-std::array<float,2>{0.806072295f, 0.542629063f},
-std::array<float,2>{0.0810766444f, 0.0547033548f},
-std::array<float,2>{0.619714439f, 0.429150164f},
-std::array<float,2>{0.465334326f, 0.912347436f},
-std::array<float,2>{0.634124637f, 0.861826658f},
-std::array<float,2>{0.303265929f, 0.271537602f},
-std::array<float,2>{0.901679337f, 0.146875352f},
-std::array<float,2>{0.165493414f, 0.716526985f},
-std::array<float,2>{0.526299536f, 0.631835282f},
-std::array<float,2>{0.389656126f, 0.247195527f},
-std::array<float,2>{0.827184677f, 0.330936432f},
-std::array<float,2>{0.0155214611f, 0.771388113f},
-std::array<float,2>{0.959119499f, 0.950411737f},
-std::array<float,2>{0.216392279f, 0.484989762f},
-std::array<float,2>{0.745843828f, 0.0754122362f},
-std::array<float,2>{0.323316127f, 0.603861928f},
-std::array<float,2>{0.895554602f, 0.510692716f},
-std::array<float,2>{0.160270885f, 0.0311119687f},
-std::array<float,2>{0.628484309f, 0.397313714f},
-std::array<float,2>{0.311338454f, 0.903024018f},
-std::array<float,2>{0.613686025f, 0.825469792f},
-std::array<float,2>{0.458512992f, 0.305222481f},
-std::array<float,2>{0.800075829f, 0.178233266f},
-std::array<float,2>{0.0930694863f, 0.7208215f},
-std::array<float,2>{0.737106204f, 0.679032862f},
-std::array<float,2>{0.319155395f, 0.204691947f},
-std::array<float,2>{0.966719925f, 0.37076363f},
-std::array<float,2>{0.206854567f, 0.797156334f},
-std::array<float,2>{0.812937915f, 0.978418112f},
-std::array<float,2>{0.000673333358f, 0.46507445f},
-std::array<float,2>{0.523326159f, 0.103682198f},
-std::array<float,2>{0.381211072f, 0.573247492f},
-std::array<float,2>{0.7591061f, 0.706549764f},
-std::array<float,2>{0.1225648f, 0.154993698f},
-std::array<float,2>{0.569800258f, 0.276525408f},
-std::array<float,2>{0.480465204f, 0.874324918f},
-std::array<float,2>{0.686560929f, 0.914427638f},
-std::array<float,2>{0.268208504f, 0.434312254f},
-std::array<float,2>{0.916968167f, 0.0508399829f},
-std::array<float,2>{0.147024587f, 0.535204828f},
-std::array<float,2>{0.535645962f, 0.599444509f},
-std::array<float,2>{0.432619125f, 0.0632061884f},
-std::array<float,2>{0.871910691f, 0.496300042f},
-std::array<float,2>{0.0517915636f, 0.944967568f},
-std::array<float,2>{0.979965329f, 0.77688098f},
-std::array<float,2>{0.2268987f, 0.342714518f},
-std::array<float,2>{0.689603627f, 0.234619007f},
-std::array<float,2>{0.351161987f, 0.63399744f},
-std::array<float,2>{0.948659539f, 0.640661418f},
-std::array<float,2>{0.197651535f, 0.224037707f},
-std::array<float,2>{0.729628742f, 0.31835556f},
-std::array<float,2>{0.336792648f, 0.7607463f},
-std::array<float,2>{0.515213847f, 0.956143439f},
-std::array<float,2>{0.39347893f, 0.470574051f},
-std::array<float,2>{0.84039259f, 0.0827117413f},
-std::array<float,2>{0.0306128021f, 0.621004939f},
-std::array<float,2>{0.642233729f, 0.550377131f},
-std::array<float,2>{0.295036823f, 0.0331020132f},
-std::array<float,2>{0.877922475f, 0.418386608f},
-std::array<float,2>{0.176223725f, 0.92389816f},
-std::array<float,2>{0.781490326f, 0.844226778f},
-std::array<float,2>{0.0653605685f, 0.253729701f},
-std::array<float,2>{0.605129898f, 0.139301524f},
-std::array<float,2>{0.452180594f, 0.695707619f},
-std::array<float,2>{0.845871508f, 0.593674302f},
-std::array<float,2>{0.031982813f, 0.11673107f},
-std::array<float,2>{0.559536338f, 0.449456215f},
-std::array<float,2>{0.420451969f, 0.991262794f},
-std::array<float,2>{0.71609354f, 0.79269594f},
-std::array<float,2>{0.366084367f, 0.347649306f},
-std::array<float,2>{0.996219397f, 0.195459798f},
-std::array<float,2>{0.246746525f, 0.661036789f},
-std::array<float,2>{0.586388111f, 0.749291301f},
-std::array<float,2>{0.487173766f, 0.162889838f},
-std::array<float,2>{0.778959453f, 0.296666056f},
-std::array<float,2>{0.0996979475f, 0.829688251f},
-std::array<float,2>{0.929564357f, 0.881827176f},
-std::array<float,2>{0.126548901f, 0.379499763f},
-std::array<float,2>{0.665540338f, 0.010194025f},
-std::array<float,2>{0.262880802f, 0.515917242f},
-std::array<float,2>{0.971141994f, 0.554529846f},
-std::array<float,2>{0.223195657f, 0.0353572443f},
-std::array<float,2>{0.701299369f, 0.414464206f},
-std::array<float,2>{0.35514614f, 0.926329017f},
-std::array<float,2>{0.545672178f, 0.848294199f},
-std::array<float,2>{0.425648928f, 0.255874425f},
-std::array<float,2>{0.859562039f, 0.13462323f},
-std::array<float,2>{0.0599174276f, 0.700040877f},
-std::array<float,2>{0.672722161f, 0.648426712f},
-std::array<float,2>{0.280053884f, 0.219255969f},
-std::array<float,2>{0.912864029f, 0.314613134f},
-std::array<float,2>{0.153032675f, 0.765234411f},
-std::array<float,2>{0.753510773f, 0.959313333f},
-std::array<float,2>{0.115325503f, 0.474233538f},
-std::array<float,2>{0.577284694f, 0.0804761499f},
-std::array<float,2>{0.469389975f, 0.623029292f},
-std::array<float,2>{0.822744787f, 0.745512843f},
-std::array<float,2>{0.00940323249f, 0.160003826f},
-std::array<float,2>{0.528413832f, 0.292142898f},
-std::array<float,2>{0.385526985f, 0.835752368f},
-std::array<float,2>{0.747136235f, 0.878480613f},
-std::array<float,2>{0.32526511f, 0.377271771f},
-std::array<float,2>{0.955947816f, 0.0134413382f},
-std::array<float,2>{0.214085996f, 0.519797087f},
-std::array<float,2>{0.62326771f, 0.586770654f},
-std::array<float,2>{0.461969137f, 0.110239871f},
-std::array<float,2>{0.810369372f, 0.446760714f},
-std::array<float,2>{0.0829271823f, 0.986057878f},
-std::array<float,2>{0.902904093f, 0.793315887f},
-std::array<float,2>{0.171665192f, 0.349251211f},
-std::array<float,2>{0.636861026f, 0.200725466f},
-std::array<float,2>{0.297528625f, 0.659173906f},
-std::array<float,2>{0.931957722f, 0.673778594f},
-std::array<float,2>{0.136508852f, 0.209073603f},
-std::array<float,2>{0.661235511f, 0.373534232f},
-std::array<float,2>{0.250352502f, 0.801570296f},
-std::array<float,2>{0.579244852f, 0.981852531f},
-std::array<float,2>{0.497813463f, 0.462776124f},
-std::array<float,2>{0.769986689f, 0.107888609f},
-std::array<float,2>{0.105044417f, 0.575171113f},
-std::array<float,2>{0.704155207f, 0.512201905f},
-std::array<float,2>{0.371047348f, 0.0270851757f},
-std::array<float,2>{0.990597904f, 0.393148243f},
-std::array<float,2>{0.23735939f, 0.902043283f},
-std::array<float,2>{0.855809271f, 0.821853876f},
-std::array<float,2>{0.0436722524f, 0.309402525f},
-std::array<float,2>{0.553360641f, 0.174713984f},
-std::array<float,2>{0.406846434f, 0.724867702f},
-std::array<float,2>{0.791222334f, 0.595032513f},
-std::array<float,2>{0.0716122165f, 0.0671745986f},
-std::array<float,2>{0.598171413f, 0.493095756f},
-std::array<float,2>{0.438377261f, 0.938365519f},
-std::array<float,2>{0.651097357f, 0.781025648f},
-std::array<float,2>{0.287559241f, 0.33669731f},
-std::array<float,2>{0.888652563f, 0.239460006f},
-std::array<float,2>{0.186231717f, 0.640231907f},
-std::array<float,2>{0.502010643f, 0.710534394f},
-std::array<float,2>{0.403561801f, 0.151079118f},
-std::array<float,2>{0.832687736f, 0.279044271f},
-std::array<float,2>{0.0216310695f, 0.870444417f},
-std::array<float,2>{0.94317162f, 0.920776427f},
-std::array<float,2>{0.188630298f, 0.43056193f},
-std::array<float,2>{0.726376355f, 0.04867623f},
-std::array<float,2>{0.334523529f, 0.532844365f},
-std::array<float,2>{0.882529259f, 0.567020059f},
-std::array<float,2>{0.174749747f, 0.0983561948f},
-std::array<float,2>{0.645293593f, 0.455523342f},
-std::array<float,2>{0.289722323f, 0.976054072f},
-std::array<float,2>{0.607056141f, 0.810439289f},
-std::array<float,2>{0.445952207f, 0.363215894f},
-std::array<float,2>{0.786931515f, 0.216977462f},
-std::array<float,2>{0.0671188012f, 0.68733263f},
-std::array<float,2>{0.731196582f, 0.731512487f},
-std::array<float,2>{0.342210025f, 0.179825515f},
-std::array<float,2>{0.949461997f, 0.301732928f},
-std::array<float,2>{0.199980363f, 0.816755593f},
-std::array<float,2>{0.838799417f, 0.89199543f},
-std::array<float,2>{0.0271249041f, 0.399534285f},
-std::array<float,2>{0.508811116f, 0.01894507f},
-std::array<float,2>{0.395370066f, 0.503645658f},
-std::array<float,2>{0.77653873f, 0.626728594f},
-std::array<float,2>{0.095004864f, 0.243308783f},
-std::array<float,2>{0.591561079f, 0.335186988f},
-std::array<float,2>{0.489950866f, 0.766819179f},
-std::array<float,2>{0.671746492f, 0.947588623f},
-std::array<float,2>{0.260117859f, 0.491083086f},
-std::array<float,2>{0.924950957f, 0.0714150816f},
-std::array<float,2>{0.129677981f, 0.606860399f},
-std::array<float,2>{0.556685746f, 0.544201076f},
-std::array<float,2>{0.41731292f, 0.0591501221f},
-std::array<float,2>{0.851129472f, 0.425358057f},
-std::array<float,2>{0.0378384441f, 0.906962276f},
-std::array<float,2>{0.995450497f, 0.863422334f},
-std::array<float,2>{0.242236599f, 0.266423613f},
-std::array<float,2>{0.71409297f, 0.142581791f},
-std::array<float,2>{0.359679043f, 0.714613438f},
-std::array<float,2>{0.963891447f, 0.69483757f},
-std::array<float,2>{0.207107574f, 0.131434634f},
-std::array<float,2>{0.739536941f, 0.258334845f},
-std::array<float,2>{0.31544137f, 0.85339433f},
-std::array<float,2>{0.518569767f, 0.931623816f},
-std::array<float,2>{0.375215292f, 0.408413768f},
-std::array<float,2>{0.820011556f, 0.0415435508f},
-std::array<float,2>{0.00712675136f, 0.555199921f},
-std::array<float,2>{0.631738186f, 0.615441918f},
-std::array<float,2>{0.305342317f, 0.0869471803f},
-std::array<float,2>{0.893972814f, 0.480997413f},
-std::array<float,2>{0.159114376f, 0.961553276f},
-std::array<float,2>{0.803402185f, 0.755033255f},
-std::array<float,2>{0.087414071f, 0.32611379f},
-std::array<float,2>{0.612951934f, 0.231610715f},
-std::array<float,2>{0.456990808f, 0.651898921f},
-std::array<float,2>{0.868422627f, 0.52551055f},
-std::array<float,2>{0.0471751802f, 0.0024595377f},
-std::array<float,2>{0.531400442f, 0.390301734f},
-std::array<float,2>{0.433788598f, 0.884534836f},
-std::array<float,2>{0.692757428f, 0.842809677f},
-std::array<float,2>{0.347519398f, 0.28316018f},
-std::array<float,2>{0.981829941f, 0.164630204f},
-std::array<float,2>{0.231845528f, 0.735751212f},
-std::array<float,2>{0.564780295f, 0.667409539f},
-std::array<float,2>{0.481783867f, 0.188660294f},
-std::array<float,2>{0.762944996f, 0.354386479f},
-std::array<float,2>{0.117640123f, 0.786676347f},
-std::array<float,2>{0.9217363f, 0.996262074f},
-std::array<float,2>{0.142715007f, 0.4416067f},
-std::array<float,2>{0.682599902f, 0.120646469f},
-std::array<float,2>{0.271394283f, 0.584382772f},
-std::array<float,2>{0.945975959f, 0.620195568f},
-std::array<float,2>{0.195516393f, 0.0821903273f},
-std::array<float,2>{0.727955282f, 0.469768763f},
-std::array<float,2>{0.338970691f, 0.956721783f},
-std::array<float,2>{0.513463259f, 0.761715889f},
-std::array<float,2>{0.392482519f, 0.317654848f},
-std::array<float,2>{0.841930449f, 0.224339858f},
-std::array<float,2>{0.0291634407f, 0.641536236f},
-std::array<float,2>{0.642811596f, 0.696207285f},
-std::array<float,2>{0.293847382f, 0.138690948f},
-std::array<float,2>{0.875716388f, 0.252947718f},
-std::array<float,2>{0.179326639f, 0.844513357f},
-std::array<float,2>{0.785085618f, 0.924420059f},
-std::array<float,2>{0.0643529892f, 0.418941408f},
-std::array<float,2>{0.601969719f, 0.0326863229f},
-std::array<float,2>{0.450456083f, 0.550177872f},
-std::array<float,2>{0.844557881f, 0.660413563f},
-std::array<float,2>{0.033409398f, 0.196192265f},
-std::array<float,2>{0.56154424f, 0.346776396f},
-std::array<float,2>{0.419838697f, 0.792425811f},
-std::array<float,2>{0.717824042f, 0.992150903f},
-std::array<float,2>{0.363731623f, 0.449980915f},
-std::array<float,2>{0.999557734f, 0.116532125f},
-std::array<float,2>{0.249103412f, 0.59277761f},
-std::array<float,2>{0.58868295f, 0.5164904f},
-std::array<float,2>{0.484907478f, 0.0105655333f},
-std::array<float,2>{0.780083001f, 0.379168212f},
-std::array<float,2>{0.0984278619f, 0.88112694f},
-std::array<float,2>{0.927337468f, 0.829544187f},
-std::array<float,2>{0.128840044f, 0.296179712f},
-std::array<float,2>{0.667800784f, 0.16226837f},
-std::array<float,2>{0.264197677f, 0.749808013f},
-std::array<float,2>{0.897474587f, 0.721338987f},
-std::array<float,2>{0.164055094f, 0.177843586f},
-std::array<float,2>{0.626463056f, 0.304998994f},
-std::array<float,2>{0.308951437f, 0.825948179f},
-std::array<float,2>{0.615505815f, 0.902600229f},
-std::array<float,2>{0.459275872f, 0.396916002f},
-std::array<float,2>{0.798666775f, 0.0306707118f},
-std::array<float,2>{0.0906661674f, 0.509866893f},
-std::array<float,2>{0.734592915f, 0.574087918f},
-std::array<float,2>{0.316791505f, 0.104389168f},
-std::array<float,2>{0.968098521f, 0.465657055f},
-std::array<float,2>{0.203203157f, 0.977886021f},
-std::array<float,2>{0.815661252f, 0.797519326f},
-std::array<float,2>{0.00328409998f, 0.370159149f},
-std::array<float,2>{0.52018261f, 0.204250649f},
-std::array<float,2>{0.380720019f, 0.679264724f},
-std::array<float,2>{0.759883225f, 0.536049783f},
-std::array<float,2>{0.124514401f, 0.0517172739f},
-std::array<float,2>{0.567920089f, 0.433917731f},
-std::array<float,2>{0.4780671f, 0.914636493f},
-std::array<float,2>{0.685409606f, 0.874564528f},
-std::array<float,2>{0.267064393f, 0.277027398f},
-std::array<float,2>{0.914606273f, 0.154723063f},
-std::array<float,2>{0.145294264f, 0.706111968f},
-std::array<float,2>{0.537160754f, 0.634531081f},
-std::array<float,2>{0.430698186f, 0.234982163f},
-std::array<float,2>{0.87414521f, 0.341821253f},
-std::array<float,2>{0.0529713742f, 0.776798904f},
-std::array<float,2>{0.978449941f, 0.944488764f},
-std::array<float,2>{0.229806393f, 0.496924579f},
-std::array<float,2>{0.688591957f, 0.0625878721f},
-std::array<float,2>{0.348293066f, 0.59908092f},
-std::array<float,2>{0.908337772f, 0.506783783f},
-std::array<float,2>{0.150561899f, 0.0207066126f},
-std::array<float,2>{0.678583264f, 0.405793309f},
-std::array<float,2>{0.274855435f, 0.896360338f},
-std::array<float,2>{0.573829234f, 0.813813567f},
-std::array<float,2>{0.47351712f, 0.299973607f},
-std::array<float,2>{0.755411744f, 0.185616836f},
-std::array<float,2>{0.112249568f, 0.72848767f},
-std::array<float,2>{0.698302984f, 0.680412531f},
-std::array<float,2>{0.357866287f, 0.214226663f},
-std::array<float,2>{0.974525928f, 0.36614731f},
-std::array<float,2>{0.220458284f, 0.808359206f},
-std::array<float,2>{0.866764784f, 0.972184598f},
-std::array<float,2>{0.0563319698f, 0.458032042f},
-std::array<float,2>{0.541901708f, 0.094371736f},
-std::array<float,2>{0.425801665f, 0.563743532f},
-std::array<float,2>{0.808536589f, 0.716280043f},
-std::array<float,2>{0.0790053979f, 0.147124112f},
-std::array<float,2>{0.618899167f, 0.272179633f},
-std::array<float,2>{0.467779726f, 0.861664712f},
-std::array<float,2>{0.636011541f, 0.913003266f},
-std::array<float,2>{0.302646369f, 0.429359823f},
-std::array<float,2>{0.899106205f, 0.0554792248f},
-std::array<float,2>{0.166479602f, 0.54208523f},
-std::array<float,2>{0.523879349f, 0.604186356f},
-std::array<float,2>{0.387137145f, 0.0758040845f},
-std::array<float,2>{0.82471782f, 0.484733462f},
-std::array<float,2>{0.0123137664f, 0.950730085f},
-std::array<float,2>{0.958918571f, 0.770547509f},
-std::array<float,2>{0.218579486f, 0.330352157f},
-std::array<float,2>{0.742506862f, 0.247623324f},
-std::array<float,2>{0.322197974f, 0.631089687f},
-std::array<float,2>{0.986806929f, 0.655018628f},
-std::array<float,2>{0.238564923f, 0.230153918f},
-std::array<float,2>{0.709650278f, 0.321054041f},
-std::array<float,2>{0.374842077f, 0.751887858f},
-std::array<float,2>{0.549337566f, 0.966075659f},
-std::array<float,2>{0.411338955f, 0.479004294f},
-std::array<float,2>{0.854415536f, 0.0914220139f},
-std::array<float,2>{0.0424688421f, 0.612948716f},
-std::array<float,2>{0.65915972f, 0.562272966f},
-std::array<float,2>{0.256873667f, 0.0433863029f},
-std::array<float,2>{0.936794639f, 0.413935423f},
-std::array<float,2>{0.140355334f, 0.935276866f},
-std::array<float,2>{0.765738726f, 0.856012881f},
-std::array<float,2>{0.105876051f, 0.26220122f},
-std::array<float,2>{0.582787275f, 0.127092645f},
-std::array<float,2>{0.493612379f, 0.691115558f},
-std::array<float,2>{0.829256058f, 0.579327106f},
-std::array<float,2>{0.015930431f, 0.124928109f},
-std::array<float,2>{0.504103839f, 0.438735902f},
-std::array<float,2>{0.40193373f, 0.993886054f},
-std::array<float,2>{0.719973981f, 0.784901023f},
-std::array<float,2>{0.329505682f, 0.356241971f},
-std::array<float,2>{0.940082729f, 0.191461459f},
-std::array<float,2>{0.195292696f, 0.670392692f},
-std::array<float,2>{0.59539789f, 0.742097616f},
-std::array<float,2>{0.441972286f, 0.168709114f},
-std::array<float,2>{0.794642568f, 0.287356287f},
-std::array<float,2>{0.0776933059f, 0.836330056f},
-std::array<float,2>{0.884581923f, 0.887645781f},
-std::array<float,2>{0.183545232f, 0.384343207f},
-std::array<float,2>{0.654341578f, 0.00528634712f},
-std::array<float,2>{0.284270257f, 0.528734386f},
-std::array<float,2>{0.953329682f, 0.521743834f},
-std::array<float,2>{0.211106911f, 0.0149164386f},
-std::array<float,2>{0.748936236f, 0.375807643f},
-std::array<float,2>{0.32649225f, 0.876051784f},
-std::array<float,2>{0.530087829f, 0.832137287f},
-std::array<float,2>{0.383126348f, 0.289530545f},
-std::array<float,2>{0.820668876f, 0.156385243f},
-std::array<float,2>{0.0111035621f, 0.743743777f},
-std::array<float,2>{0.639859796f, 0.657848716f},
-std::array<float,2>{0.298887908f, 0.203085303f},
-std::array<float,2>{0.90447551f, 0.35059154f},
-std::array<float,2>{0.168754011f, 0.795856178f},
-std::array<float,2>{0.812115967f, 0.986703455f},
-std::array<float,2>{0.0842925757f, 0.44873932f},
-std::array<float,2>{0.621539533f, 0.111408062f},
-std::array<float,2>{0.463237435f, 0.589001715f},
-std::array<float,2>{0.861943662f, 0.701900244f},
-std::array<float,2>{0.0610128008f, 0.136102378f},
-std::array<float,2>{0.543539524f, 0.255041927f},
-std::array<float,2>{0.422893524f, 0.850378513f},
-std::array<float,2>{0.700134158f, 0.928198814f},
-std::array<float,2>{0.351861387f, 0.417408854f},
-std::array<float,2>{0.969047189f, 0.0387702957f},
-std::array<float,2>{0.225961834f, 0.551701605f},
-std::array<float,2>{0.575992346f, 0.624394834f},
-std::array<float,2>{0.471720189f, 0.0783559084f},
-std::array<float,2>{0.751815617f, 0.474627346f},
-std::array<float,2>{0.114524871f, 0.958889723f},
-std::array<float,2>{0.910450935f, 0.762695253f},
-std::array<float,2>{0.15580304f, 0.31334731f},
-std::array<float,2>{0.674510598f, 0.221820459f},
-std::array<float,2>{0.278809726f, 0.645202279f},
-std::array<float,2>{0.888704121f, 0.637543857f},
-std::array<float,2>{0.184605166f, 0.240977362f},
-std::array<float,2>{0.648862004f, 0.338054419f},
-std::array<float,2>{0.285438865f, 0.777922094f},
-std::array<float,2>{0.599961579f, 0.939846039f},
-std::array<float,2>{0.441043675f, 0.495375752f},
-std::array<float,2>{0.789959848f, 0.0694448724f},
-std::array<float,2>{0.0731544867f, 0.597600281f},
-std::array<float,2>{0.723458707f, 0.534598589f},
-std::array<float,2>{0.332597941f, 0.0503286794f},
-std::array<float,2>{0.944320381f, 0.432491124f},
-std::array<float,2>{0.190126583f, 0.918053567f},
-std::array<float,2>{0.834668577f, 0.868549347f},
-std::array<float,2>{0.0213490594f, 0.280415893f},
-std::array<float,2>{0.500549912f, 0.148677006f},
-std::array<float,2>{0.404912055f, 0.70752877f},
-std::array<float,2>{0.771923721f, 0.576749444f},
-std::array<float,2>{0.101613529f, 0.105499335f},
-std::array<float,2>{0.580840826f, 0.464049757f},
-std::array<float,2>{0.499679238f, 0.983093798f},
-std::array<float,2>{0.66249305f, 0.804617167f},
-std::array<float,2>{0.252872437f, 0.372677714f},
-std::array<float,2>{0.930449128f, 0.207465202f},
-std::array<float,2>{0.134152845f, 0.674202502f},
-std::array<float,2>{0.551088929f, 0.723726094f},
-std::array<float,2>{0.409743696f, 0.172831044f},
-std::array<float,2>{0.85885936f, 0.312111169f},
-std::array<float,2>{0.0461117178f, 0.823831797f},
-std::array<float,2>{0.988980174f, 0.900304854f},
-std::array<float,2>{0.235801712f, 0.391630828f},
-std::array<float,2>{0.705406129f, 0.0235156491f},
-std::array<float,2>{0.368615061f, 0.514208555f},
-std::array<float,2>{0.922207057f, 0.608806133f},
-std::array<float,2>{0.132209271f, 0.0725223273f},
-std::array<float,2>{0.669439852f, 0.489993632f},
-std::array<float,2>{0.257864356f, 0.946417153f},
-std::array<float,2>{0.593254149f, 0.769397736f},
-std::array<float,2>{0.490929008f, 0.332621455f},
-std::array<float,2>{0.773757815f, 0.244949624f},
-std::array<float,2>{0.0973295122f, 0.627712846f},
-std::array<float,2>{0.711632013f, 0.710995793f},
-std::array<float,2>{0.361650825f, 0.140817091f},
-std::array<float,2>{0.992666721f, 0.269179434f},
-std::array<float,2>{0.24544853f, 0.867162585f},
-std::array<float,2>{0.848710358f, 0.909536779f},
-std::array<float,2>{0.0369704664f, 0.423391312f},
-std::array<float,2>{0.554819584f, 0.0609028377f},
-std::array<float,2>{0.415978402f, 0.546403766f},
-std::array<float,2>{0.788948178f, 0.683995843f},
-std::array<float,2>{0.0702216551f, 0.21650061f},
-std::array<float,2>{0.60765928f, 0.360975862f},
-std::array<float,2>{0.448249638f, 0.811588585f},
-std::array<float,2>{0.648433864f, 0.973756552f},
-std::array<float,2>{0.291101158f, 0.454535007f},
-std::array<float,2>{0.879915297f, 0.101491757f},
-std::array<float,2>{0.172165796f, 0.568943024f},
-std::array<float,2>{0.510303676f, 0.500525057f},
-std::array<float,2>{0.396511763f, 0.0172598399f},
-std::array<float,2>{0.837886155f, 0.401968926f},
-std::array<float,2>{0.0246137623f, 0.893100142f},
-std::array<float,2>{0.95224303f, 0.819946527f},
-std::array<float,2>{0.202510923f, 0.303286582f},
-std::array<float,2>{0.733470976f, 0.183129251f},
-std::array<float,2>{0.340220571f, 0.732923388f},
-std::array<float,2>{0.984270692f, 0.736721694f},
-std::array<float,2>{0.233484492f, 0.167320818f},
-std::array<float,2>{0.694159031f, 0.284704566f},
-std::array<float,2>{0.345121503f, 0.841128588f},
-std::array<float,2>{0.53457737f, 0.886618376f},
-std::array<float,2>{0.436266005f, 0.387246132f},
-std::array<float,2>{0.869413674f, 0.00118571799f},
-std::array<float,2>{0.0496634245f, 0.524608314f},
-std::array<float,2>{0.679929554f, 0.583977461f},
-std::array<float,2>{0.272191793f, 0.117767192f},
-std::array<float,2>{0.919135809f, 0.443888932f},
-std::array<float,2>{0.141889393f, 0.999663413f},
-std::array<float,2>{0.763807058f, 0.787932575f},
-std::array<float,2>{0.11961066f, 0.351741254f},
-std::array<float,2>{0.563314438f, 0.189611822f},
-std::array<float,2>{0.483006537f, 0.665038705f},
-std::array<float,2>{0.816492438f, 0.556782246f},
-std::array<float,2>{0.00489503937f, 0.0394638851f},
-std::array<float,2>{0.51702261f, 0.407573462f},
-std::array<float,2>{0.37778759f, 0.933349133f},
-std::array<float,2>{0.741057813f, 0.855427861f},
-std::array<float,2>{0.314213037f, 0.259787738f},
-std::array<float,2>{0.962877631f, 0.129465312f},
-std::array<float,2>{0.21005553f, 0.691724241f},
-std::array<float,2>{0.61048311f, 0.648635447f},
-std::array<float,2>{0.454828948f, 0.233216837f},
-std::array<float,2>{0.801484704f, 0.326517612f},
-std::array<float,2>{0.0879070088f, 0.755860388f},
-std::array<float,2>{0.891089737f, 0.964675665f},
-std::array<float,2>{0.15633826f, 0.483420491f},
-std::array<float,2>{0.629111886f, 0.0890011489f},
-std::array<float,2>{0.307147086f, 0.614811301f},
-std::array<float,2>{0.996728837f, 0.591279149f},
-std::array<float,2>{0.246552527f, 0.114913166f},
-std::array<float,2>{0.716624022f, 0.453056216f},
-std::array<float,2>{0.365454972f, 0.989480615f},
-std::array<float,2>{0.558834851f, 0.790942132f},
-std::array<float,2>{0.420074195f, 0.345098257f},
-std::array<float,2>{0.846461356f, 0.197700277f},
-std::array<float,2>{0.0316717774f, 0.662654579f},
-std::array<float,2>{0.665254772f, 0.746165514f},
-std::array<float,2>{0.263389289f, 0.161735415f},
-std::array<float,2>{0.929103255f, 0.294480026f},
-std::array<float,2>{0.126334697f, 0.830081105f},
-std::array<float,2>{0.778348863f, 0.880093336f},
-std::array<float,2>{0.100287743f, 0.381208777f},
-std::array<float,2>{0.586813927f, 0.00811647717f},
-std::array<float,2>{0.486480623f, 0.519198537f},
-std::array<float,2>{0.840140939f, 0.643388093f},
-std::array<float,2>{0.0312363654f, 0.22525005f},
-std::array<float,2>{0.514800787f, 0.318500549f},
-std::array<float,2>{0.392838746f, 0.758499563f},
-std::array<float,2>{0.730360091f, 0.954092324f},
-std::array<float,2>{0.336322576f, 0.472018123f},
-std::array<float,2>{0.948889852f, 0.085776262f},
-std::array<float,2>{0.198172823f, 0.618278742f},
-std::array<float,2>{0.604764521f, 0.547999382f},
-std::array<float,2>{0.452785879f, 0.0348156318f},
-std::array<float,2>{0.78189373f, 0.42009744f},
-std::array<float,2>{0.0645459965f, 0.92304945f},
-std::array<float,2>{0.877040565f, 0.84591198f},
-std::array<float,2>{0.176276699f, 0.251870513f},
-std::array<float,2>{0.64190495f, 0.137249216f},
-std::array<float,2>{0.295598686f, 0.698998928f},
-std::array<float,2>{0.916107833f, 0.703189552f},
-std::array<float,2>{0.146794856f, 0.154273763f},
-std::array<float,2>{0.687359035f, 0.274579346f},
-std::array<float,2>{0.267855793f, 0.871875584f},
-std::array<float,2>{0.569866121f, 0.916522384f},
-std::array<float,2>{0.479620904f, 0.437083453f},
-std::array<float,2>{0.759634137f, 0.0545957088f},
-std::array<float,2>{0.122427993f, 0.538613021f},
-std::array<float,2>{0.689947605f, 0.600416839f},
-std::array<float,2>{0.350988686f, 0.0647994205f},
-std::array<float,2>{0.98027277f, 0.498791605f},
-std::array<float,2>{0.227509439f, 0.942420185f},
-std::array<float,2>{0.87122643f, 0.774163067f},
-std::array<float,2>{0.0527176298f, 0.340477884f},
-std::array<float,2>{0.535423338f, 0.236563265f},
-std::array<float,2>{0.433230162f, 0.635342836f},
-std::array<float,2>{0.80049026f, 0.508149147f},
-std::array<float,2>{0.09352988f, 0.0290914401f},
-std::array<float,2>{0.61383146f, 0.396121114f},
-std::array<float,2>{0.458258629f, 0.904681444f},
-std::array<float,2>{0.628237069f, 0.827496946f},
-std::array<float,2>{0.310549229f, 0.307615161f},
-std::array<float,2>{0.896116376f, 0.176259026f},
-std::array<float,2>{0.160777286f, 0.720197856f},
-std::array<float,2>{0.52285111f, 0.676405907f},
-std::array<float,2>{0.381740183f, 0.20517391f},
-std::array<float,2>{0.81317085f, 0.368995816f},
-std::array<float,2>{0.000342261483f, 0.799939871f},
-std::array<float,2>{0.965927422f, 0.979600787f},
-std::array<float,2>{0.206290856f, 0.467216194f},
-std::array<float,2>{0.7364676f, 0.103315599f},
-std::array<float,2>{0.318527162f, 0.572244525f},
-std::array<float,2>{0.902297437f, 0.540698707f},
-std::array<float,2>{0.165824041f, 0.0566555522f},
-std::array<float,2>{0.634453714f, 0.425903529f},
-std::array<float,2>{0.302810609f, 0.910545826f},
-std::array<float,2>{0.619388878f, 0.861209333f},
-std::array<float,2>{0.465042531f, 0.269920111f},
-std::array<float,2>{0.806513667f, 0.14499265f},
-std::array<float,2>{0.0819876269f, 0.717395008f},
-std::array<float,2>{0.745184064f, 0.630341709f},
-std::array<float,2>{0.323786318f, 0.249319851f},
-std::array<float,2>{0.959582984f, 0.328715265f},
-std::array<float,2>{0.216203466f, 0.771674275f},
-std::array<float,2>{0.827678144f, 0.952209115f},
-std::array<float,2>{0.0150615666f, 0.487779111f},
-std::array<float,2>{0.525633156f, 0.0771283656f},
-std::array<float,2>{0.390477449f, 0.603228629f},
-std::array<float,2>{0.756813228f, 0.729017675f},
-std::array<float,2>{0.109559759f, 0.184597582f},
-std::array<float,2>{0.572014332f, 0.297066927f},
-std::array<float,2>{0.476274073f, 0.816379845f},
-std::array<float,2>{0.677421033f, 0.897938073f},
-std::array<float,2>{0.275536418f, 0.40361619f},
-std::array<float,2>{0.907344043f, 0.0231190622f},
-std::array<float,2>{0.148717239f, 0.505587399f},
-std::array<float,2>{0.54093641f, 0.564750493f},
-std::array<float,2>{0.427948177f, 0.097114265f},
-std::array<float,2>{0.863721371f, 0.460134119f},
-std::array<float,2>{0.0579871535f, 0.968896866f},
-std::array<float,2>{0.974777281f, 0.805544198f},
-std::array<float,2>{0.222217903f, 0.36469081f},
-std::array<float,2>{0.695777893f, 0.212751895f},
-std::array<float,2>{0.355896056f, 0.682955921f},
-std::array<float,2>{0.939003885f, 0.669300139f},
-std::array<float,2>{0.191713512f, 0.193743944f},
-std::array<float,2>{0.721697211f, 0.358108521f},
-std::array<float,2>{0.331448376f, 0.782390714f},
-std::array<float,2>{0.506019115f, 0.995241702f},
-std::array<float,2>{0.399019897f, 0.441213667f},
-std::array<float,2>{0.831743181f, 0.12116868f},
-std::array<float,2>{0.0182858054f, 0.580945015f},
-std::array<float,2>{0.652467251f, 0.530764103f},
-std::array<float,2>{0.281292319f, 0.00769428955f},
-std::array<float,2>{0.884892762f, 0.385298908f},
-std::array<float,2>{0.18118912f, 0.890591264f},
-std::array<float,2>{0.796741664f, 0.838756919f},
-std::array<float,2>{0.0756576955f, 0.28540206f},
-std::array<float,2>{0.596556544f, 0.170415089f},
-std::array<float,2>{0.444359064f, 0.740218282f},
-std::array<float,2>{0.851617932f, 0.610814452f},
-std::array<float,2>{0.0393358879f, 0.0922464356f},
-std::array<float,2>{0.548419297f, 0.478515446f},
-std::array<float,2>{0.41221866f, 0.968055665f},
-std::array<float,2>{0.70759356f, 0.752361596f},
-std::array<float,2>{0.372272134f, 0.32343629f},
-std::array<float,2>{0.985973299f, 0.227753192f},
-std::array<float,2>{0.240788817f, 0.653293192f},
-std::array<float,2>{0.58580929f, 0.688186765f},
-std::array<float,2>{0.49415037f, 0.126920328f},
-std::array<float,2>{0.769201577f, 0.265451968f},
-std::array<float,2>{0.108076721f, 0.859080791f},
-std::array<float,2>{0.934506416f, 0.936977446f},
-std::array<float,2>{0.136834636f, 0.411289066f},
-std::array<float,2>{0.657559276f, 0.0458513685f},
-std::array<float,2>{0.255456239f, 0.558908224f},
-std::array<float,2>{0.991832495f, 0.515369236f},
-std::array<float,2>{0.237035334f, 0.0247311052f},
-std::array<float,2>{0.703397274f, 0.391073495f},
-std::array<float,2>{0.369437188f, 0.899233878f},
-std::array<float,2>{0.554309785f, 0.822874069f},
-std::array<float,2>{0.407918274f, 0.310946703f},
-std::array<float,2>{0.857105315f, 0.173015118f},
-std::array<float,2>{0.0445577055f, 0.722938836f},
-std::array<float,2>{0.660754263f, 0.674880326f},
-std::array<float,2>{0.251204759f, 0.20841293f},
-std::array<float,2>{0.933126271f, 0.371485233f},
-std::array<float,2>{0.13557969f, 0.803086519f},
-std::array<float,2>{0.770682693f, 0.98394686f},
-std::array<float,2>{0.103832409f, 0.463543922f},
-std::array<float,2>{0.578243375f, 0.106911726f},
-std::array<float,2>{0.496138453f, 0.577640653f},
-std::array<float,2>{0.833042324f, 0.708563924f},
-std::array<float,2>{0.023092892f, 0.150309488f},
-std::array<float,2>{0.503516614f, 0.280055523f},
-std::array<float,2>{0.402870864f, 0.867223442f},
-std::array<float,2>{0.724614382f, 0.919163346f},
-std::array<float,2>{0.335881054f, 0.433119982f},
-std::array<float,2>{0.941622674f, 0.0497194193f},
-std::array<float,2>{0.187535226f, 0.533493638f},
-std::array<float,2>{0.599401474f, 0.595715523f},
-std::array<float,2>{0.438829303f, 0.0687692836f},
-std::array<float,2>{0.792307913f, 0.494862348f},
-std::array<float,2>{0.0712374225f, 0.940430284f},
-std::array<float,2>{0.887313008f, 0.779266417f},
-std::array<float,2>{0.187452778f, 0.339028507f},
-std::array<float,2>{0.651518822f, 0.241555437f},
-std::array<float,2>{0.288974434f, 0.638378203f},
-std::array<float,2>{0.91360718f, 0.645829797f},
-std::array<float,2>{0.153455809f, 0.221401006f},
-std::array<float,2>{0.6737023f, 0.313992321f},
-std::array<float,2>{0.281190574f, 0.763330698f},
-std::array<float,2>{0.576693773f, 0.957836509f},
-std::array<float,2>{0.47010839f, 0.476108432f},
-std::array<float,2>{0.752862275f, 0.0794259757f},
-std::array<float,2>{0.117105089f, 0.623329282f},
-std::array<float,2>{0.702240467f, 0.552338302f},
-std::array<float,2>{0.354410499f, 0.0373403355f},
-std::array<float,2>{0.972087741f, 0.416933537f},
-std::array<float,2>{0.224441558f, 0.928907931f},
-std::array<float,2>{0.861066639f, 0.851420224f},
-std::array<float,2>{0.0593124554f, 0.254621834f},
-std::array<float,2>{0.546656787f, 0.135107204f},
-std::array<float,2>{0.424191147f, 0.702895582f},
-std::array<float,2>{0.809046924f, 0.588506997f},
-std::array<float,2>{0.0835137889f, 0.113127403f},
-std::array<float,2>{0.624597073f, 0.447448999f},
-std::array<float,2>{0.461514831f, 0.988015473f},
-std::array<float,2>{0.637754917f, 0.796841204f},
-std::array<float,2>{0.298080355f, 0.349902719f},
-std::array<float,2>{0.903950691f, 0.201830551f},
-std::array<float,2>{0.170848072f, 0.656497836f},
-std::array<float,2>{0.527391553f, 0.742706358f},
-std::array<float,2>{0.385986358f, 0.15816769f},
-std::array<float,2>{0.823268116f, 0.290942818f},
-std::array<float,2>{0.00805930886f, 0.833078325f},
-std::array<float,2>{0.956943691f, 0.875761151f},
-std::array<float,2>{0.213528112f, 0.376000434f},
-std::array<float,2>{0.746616423f, 0.0140460255f},
-std::array<float,2>{0.324219167f, 0.523044348f},
-std::array<float,2>{0.8926332f, 0.61361593f},
-std::array<float,2>{0.15954496f, 0.0880603343f},
-std::array<float,2>{0.632277012f, 0.483047992f},
-std::array<float,2>{0.306576282f, 0.962900639f},
-std::array<float,2>{0.611583769f, 0.757141173f},
-std::array<float,2>{0.455556542f, 0.327763587f},
-std::array<float,2>{0.803929031f, 0.233587906f},
-std::array<float,2>{0.0865162537f, 0.650347471f},
-std::array<float,2>{0.738339424f, 0.692614973f},
-std::array<float,2>{0.315369725f, 0.130482882f},
-std::array<float,2>{0.96365875f, 0.261236072f},
-std::array<float,2>{0.208979219f, 0.853836954f},
-std::array<float,2>{0.818890333f, 0.931925118f},
-std::array<float,2>{0.00599296251f, 0.40689975f},
-std::array<float,2>{0.517827928f, 0.0406662114f},
-std::array<float,2>{0.376636267f, 0.558149338f},
-std::array<float,2>{0.761957407f, 0.66582644f},
-std::array<float,2>{0.11856737f, 0.191173315f},
-std::array<float,2>{0.565600216f, 0.352611095f},
-std::array<float,2>{0.480608582f, 0.788653553f},
-std::array<float,2>{0.682845891f, 0.99858439f},
-std::array<float,2>{0.269875288f, 0.444877476f},
-std::array<float,2>{0.919936061f, 0.118730932f},
-std::array<float,2>{0.143817842f, 0.582694173f},
-std::array<float,2>{0.533006668f, 0.5241943f},
-std::array<float,2>{0.434671968f, 0.000239497633f},
-std::array<float,2>{0.867511153f, 0.387877792f},
-std::array<float,2>{0.0486476161f, 0.885270715f},
-std::array<float,2>{0.981266677f, 0.84013027f},
-std::array<float,2>{0.230662674f, 0.283627331f},
-std::array<float,2>{0.69142133f, 0.166242391f},
-std::array<float,2>{0.346078247f, 0.737580836f},
-std::array<float,2>{0.951037347f, 0.733550072f},
-std::array<float,2>{0.200582758f, 0.182213455f},
-std::array<float,2>{0.731864631f, 0.304624021f},
-std::array<float,2>{0.342904299f, 0.819312394f},
-std::array<float,2>{0.508760214f, 0.893841088f},
-std::array<float,2>{0.39637506f, 0.400583893f},
-std::array<float,2>{0.839548528f, 0.0160484426f},
-std::array<float,2>{0.0259021651f, 0.501086652f},
-std::array<float,2>{0.645948887f, 0.569657505f},
-std::array<float,2>{0.290581495f, 0.100128822f},
-std::array<float,2>{0.881664395f, 0.453636438f},
-std::array<float,2>{0.175616875f, 0.972779989f},
-std::array<float,2>{0.785719872f, 0.810607672f},
-std::array<float,2>{0.0677695796f, 0.359474957f},
-std::array<float,2>{0.606151462f, 0.215210423f},
-std::array<float,2>{0.446507663f, 0.685109019f},
-std::array<float,2>{0.849966705f, 0.545337915f},
-std::array<float,2>{0.0384623595f, 0.0616719387f},
-std::array<float,2>{0.55770278f, 0.422398061f},
-std::array<float,2>{0.416659683f, 0.908745587f},
-std::array<float,2>{0.713498354f, 0.865840852f},
-std::array<float,2>{0.360983431f, 0.267814726f},
-std::array<float,2>{0.994816363f, 0.141619399f},
-std::array<float,2>{0.243658751f, 0.712415934f},
-std::array<float,2>{0.590421796f, 0.628131092f},
-std::array<float,2>{0.488688618f, 0.245626837f},
-std::array<float,2>{0.776091337f, 0.333790749f},
-std::array<float,2>{0.0942431912f, 0.767732739f},
-std::array<float,2>{0.924357712f, 0.9459185f},
-std::array<float,2>{0.130734026f, 0.48859489f},
-std::array<float,2>{0.670779288f, 0.0736550614f},
-std::array<float,2>{0.261621952f, 0.607540369f},
-std::array<float,2>{0.967111766f, 0.570522845f},
-std::array<float,2>{0.204122588f, 0.101716347f},
-std::array<float,2>{0.735385716f, 0.468636602f},
-std::array<float,2>{0.317585289f, 0.979351878f},
-std::array<float,2>{0.520815969f, 0.798945904f},
-std::array<float,2>{0.379040658f, 0.368123531f},
-std::array<float,2>{0.814687133f, 0.206280306f},
-std::array<float,2>{0.0025488839f, 0.67747432f},
-std::array<float,2>{0.625474632f, 0.719605088f},
-std::array<float,2>{0.310025752f, 0.177570581f},
-std::array<float,2>{0.897134244f, 0.308001369f},
-std::array<float,2>{0.162839755f, 0.826303542f},
-std::array<float,2>{0.797401428f, 0.905959606f},
-std::array<float,2>{0.0912005678f, 0.394635618f},
-std::array<float,2>{0.616889894f, 0.0278387554f},
-std::array<float,2>{0.460718721f, 0.508851647f},
-std::array<float,2>{0.873728454f, 0.635925055f},
-std::array<float,2>{0.0545729697f, 0.237849876f},
-std::array<float,2>{0.538405061f, 0.341333836f},
-std::array<float,2>{0.42977342f, 0.774890959f},
-std::array<float,2>{0.68753916f, 0.941870511f},
-std::array<float,2>{0.349359632f, 0.499719769f},
-std::array<float,2>{0.977412343f, 0.0662713498f},
-std::array<float,2>{0.229364187f, 0.600630403f},
-std::array<float,2>{0.567232668f, 0.538054645f},
-std::array<float,2>{0.476950586f, 0.0530352741f},
-std::array<float,2>{0.761154711f, 0.435924858f},
-std::array<float,2>{0.123487748f, 0.917273939f},
-std::array<float,2>{0.915101409f, 0.872752845f},
-std::array<float,2>{0.145543277f, 0.274301797f},
-std::array<float,2>{0.683658302f, 0.152522415f},
-std::array<float,2>{0.266001731f, 0.704507709f},
-std::array<float,2>{0.876899779f, 0.697472572f},
-std::array<float,2>{0.177884132f, 0.137944728f},
-std::array<float,2>{0.644462049f, 0.250964552f},
-std::array<float,2>{0.293957084f, 0.846848965f},
-std::array<float,2>{0.603015125f, 0.921894968f},
-std::array<float,2>{0.450096697f, 0.421151936f},
-std::array<float,2>{0.783706427f, 0.0338779427f},
-std::array<float,2>{0.062784493f, 0.547488153f},
-std::array<float,2>{0.726945519f, 0.617877245f},
-std::array<float,2>{0.338743597f, 0.0841276348f},
-std::array<float,2>{0.946361065f, 0.471529961f},
-std::array<float,2>{0.196763322f, 0.954822659f},
-std::array<float,2>{0.843129575f, 0.759279609f},
-std::array<float,2>{0.028115591f, 0.319699317f},
-std::array<float,2>{0.511751294f, 0.225948468f},
-std::array<float,2>{0.391303003f, 0.644378841f},
-std::array<float,2>{0.780957401f, 0.51789701f},
-std::array<float,2>{0.099115476f, 0.0091455644f},
-std::array<float,2>{0.589731276f, 0.382427245f},
-std::array<float,2>{0.485716701f, 0.878934324f},
-std::array<float,2>{0.666054428f, 0.831483543f},
-std::array<float,2>{0.265285343f, 0.293340892f},
-std::array<float,2>{0.926092148f, 0.16018267f},
-std::array<float,2>{0.127876282f, 0.747074425f},
-std::array<float,2>{0.561084628f, 0.663731992f},
-std::array<float,2>{0.418273777f, 0.198469788f},
-std::array<float,2>{0.845652819f, 0.344224423f},
-std::array<float,2>{0.0347516164f, 0.790020704f},
-std::array<float,2>{0.998154044f, 0.98830235f},
-std::array<float,2>{0.248362646f, 0.451869488f},
-std::array<float,2>{0.71759361f, 0.113377534f},
-std::array<float,2>{0.364661217f, 0.590106666f},
-std::array<float,2>{0.93582207f, 0.560001373f},
-std::array<float,2>{0.139026165f, 0.0462309942f},
-std::array<float,2>{0.659852684f, 0.41028294f},
-std::array<float,2>{0.256770819f, 0.936514318f},
-std::array<float,2>{0.583754241f, 0.858284831f},
-std::array<float,2>{0.492242724f, 0.264198303f},
-std::array<float,2>{0.767277598f, 0.125202581f},
-std::array<float,2>{0.107101955f, 0.689382255f},
-std::array<float,2>{0.710576713f, 0.654046714f},
-std::array<float,2>{0.3733024f, 0.226915389f},
-std::array<float,2>{0.987709939f, 0.322360545f},
-std::array<float,2>{0.240232721f, 0.753643572f},
-std::array<float,2>{0.855255604f, 0.966935694f},
-std::array<float,2>{0.0418058336f, 0.47729069f},
-std::array<float,2>{0.549949527f, 0.0931403935f},
-std::array<float,2>{0.410953343f, 0.609624386f},
-std::array<float,2>{0.79325527f, 0.738294542f},
-std::array<float,2>{0.0768863261f, 0.171781301f},
-std::array<float,2>{0.593878746f, 0.286496848f},
-std::array<float,2>{0.443108082f, 0.839019477f},
-std::array<float,2>{0.655958533f, 0.889604807f},
-std::array<float,2>{0.283967078f, 0.386461109f},
-std::array<float,2>{0.883149147f, 0.00644620648f},
-std::array<float,2>{0.182236806f, 0.529817462f},
-std::array<float,2>{0.505447268f, 0.581640601f},
-std::array<float,2>{0.400645971f, 0.122677393f},
-std::array<float,2>{0.828391969f, 0.439531386f},
-std::array<float,2>{0.0174572878f, 0.995115459f},
-std::array<float,2>{0.941257894f, 0.781738698f},
-std::array<float,2>{0.194263175f, 0.359340012f},
-std::array<float,2>{0.719095826f, 0.195137605f},
-std::array<float,2>{0.329030484f, 0.668367088f},
-std::array<float,2>{0.973412454f, 0.68198961f},
-std::array<float,2>{0.218870223f, 0.211628258f},
-std::array<float,2>{0.697759509f, 0.363386393f},
-std::array<float,2>{0.359056205f, 0.8063097f},
-std::array<float,2>{0.542351723f, 0.970582128f},
-std::array<float,2>{0.427552521f, 0.45991084f},
-std::array<float,2>{0.865862072f, 0.0965722352f},
-std::array<float,2>{0.0555753484f, 0.565581918f},
-std::array<float,2>{0.678812623f, 0.504616559f},
-std::array<float,2>{0.274039f, 0.022266211f},
-std::array<float,2>{0.909204662f, 0.40247786f},
-std::array<float,2>{0.152031988f, 0.897312462f},
-std::array<float,2>{0.75461638f, 0.815010369f},
-std::array<float,2>{0.113083303f, 0.298716903f},
-std::array<float,2>{0.573048115f, 0.184365317f},
-std::array<float,2>{0.47404024f, 0.729594111f},
-std::array<float,2>{0.82547611f, 0.602466822f},
-std::array<float,2>{0.0131682055f, 0.0779888779f},
-std::array<float,2>{0.525001049f, 0.487256855f},
-std::array<float,2>{0.387896657f, 0.951221168f},
-std::array<float,2>{0.743523419f, 0.772810578f},
-std::array<float,2>{0.320690602f, 0.329826415f},
-std::array<float,2>{0.957860351f, 0.248631403f},
-std::array<float,2>{0.217355072f, 0.629859447f},
-std::array<float,2>{0.61759913f, 0.718153358f},
-std::array<float,2>{0.467113405f, 0.146478727f},
-std::array<float,2>{0.807213008f, 0.271281272f},
-std::array<float,2>{0.0793390423f, 0.860261381f},
-std::array<float,2>{0.899510026f, 0.911744416f},
-std::array<float,2>{0.167537257f, 0.427404642f},
-std::array<float,2>{0.635580301f, 0.0577525571f},
-std::array<float,2>{0.301367849f, 0.539534628f},
-std::array<float,2>{0.944802463f, 0.531503439f},
-std::array<float,2>{0.190599546f, 0.0476126112f},
-std::array<float,2>{0.724362314f, 0.431185126f},
-std::array<float,2>{0.333976448f, 0.92093724f},
-std::array<float,2>{0.501048207f, 0.869370759f},
-std::array<float,2>{0.4054389f, 0.277961999f},
-std::array<float,2>{0.835728705f, 0.151917979f},
-std::array<float,2>{0.0200785324f, 0.709577501f},
-std::array<float,2>{0.649651885f, 0.638938308f},
-std::array<float,2>{0.28682968f, 0.238665134f},
-std::array<float,2>{0.890470564f, 0.337552905f},
-std::array<float,2>{0.183612287f, 0.779519081f},
-std::array<float,2>{0.790461063f, 0.939119518f},
-std::array<float,2>{0.0733703375f, 0.493833601f},
-std::array<float,2>{0.601525426f, 0.0677461326f},
-std::array<float,2>{0.439972699f, 0.594347537f},
-std::array<float,2>{0.857557893f, 0.726400316f},
-std::array<float,2>{0.0451777093f, 0.175587282f},
-std::array<float,2>{0.551980376f, 0.309908181f},
-std::array<float,2>{0.408931583f, 0.820973992f},
-std::array<float,2>{0.706249595f, 0.900905013f},
-std::array<float,2>{0.36735332f, 0.394236356f},
-std::array<float,2>{0.989944518f, 0.0262985453f},
-std::array<float,2>{0.234951437f, 0.513580143f},
-std::array<float,2>{0.581106365f, 0.57533145f},
-std::array<float,2>{0.49861899f, 0.108746916f},
-std::array<float,2>{0.773357868f, 0.46109131f},
-std::array<float,2>{0.102641024f, 0.980900466f},
-std::array<float,2>{0.931214273f, 0.80242604f},
-std::array<float,2>{0.133094579f, 0.37458849f},
-std::array<float,2>{0.663349748f, 0.210785285f},
-std::array<float,2>{0.252988666f, 0.672477841f},
-std::array<float,2>{0.905328989f, 0.659437299f},
-std::array<float,2>{0.16938588f, 0.200135559f},
-std::array<float,2>{0.638789654f, 0.347664446f},
-std::array<float,2>{0.300241828f, 0.794857025f},
-std::array<float,2>{0.622684896f, 0.984765291f},
-std::array<float,2>{0.464101255f, 0.446033031f},
-std::array<float,2>{0.810766876f, 0.11101006f},
-std::array<float,2>{0.0854991153f, 0.58740437f},
-std::array<float,2>{0.749185145f, 0.521137536f},
-std::array<float,2>{0.328023106f, 0.01192699f},
-std::array<float,2>{0.955003023f, 0.377940685f},
-std::array<float,2>{0.212418824f, 0.876970887f},
-std::array<float,2>{0.822063029f, 0.834158659f},
-std::array<float,2>{0.0107080219f, 0.291620523f},
-std::array<float,2>{0.530619562f, 0.158643156f},
-std::array<float,2>{0.384592712f, 0.745102346f},
-std::array<float,2>{0.750257432f, 0.621302664f},
-std::array<float,2>{0.113444544f, 0.0819618702f},
-std::array<float,2>{0.575023532f, 0.472993016f},
-std::array<float,2>{0.471341521f, 0.96004349f},
-std::array<float,2>{0.675336659f, 0.76444906f},
-std::array<float,2>{0.277480841f, 0.315690249f},
-std::array<float,2>{0.911891043f, 0.220241234f},
-std::array<float,2>{0.154818729f, 0.646641493f},
-std::array<float,2>{0.544468939f, 0.700695455f},
-std::array<float,2>{0.422780126f, 0.133571178f},
-std::array<float,2>{0.862649739f, 0.257550687f},
-std::array<float,2>{0.0616982467f, 0.849143207f},
-std::array<float,2>{0.969881177f, 0.927028835f},
-std::array<float,2>{0.225152552f, 0.415935904f},
-std::array<float,2>{0.700897872f, 0.0361416824f},
-std::array<float,2>{0.352751553f, 0.552898228f},
-std::array<float,2>{0.918922007f, 0.585231185f},
-std::array<float,2>{0.141150713f, 0.120004505f},
-std::array<float,2>{0.681611717f, 0.443206728f},
-std::array<float,2>{0.272555053f, 0.998030663f},
-std::array<float,2>{0.563616753f, 0.785571575f},
-std::array<float,2>{0.483501136f, 0.354641199f},
-std::array<float,2>{0.765500367f, 0.188394114f},
-std::array<float,2>{0.12035276f, 0.666917264f},
-std::array<float,2>{0.695198834f, 0.735228598f},
-std::array<float,2>{0.344151229f, 0.165847033f},
-std::array<float,2>{0.983158052f, 0.281574756f},
-std::array<float,2>{0.233191714f, 0.842360139f},
-std::array<float,2>{0.871042013f, 0.883412063f},
-std::array<float,2>{0.0503135361f, 0.388873249f},
-std::array<float,2>{0.533292234f, 0.00381633686f},
-std::array<float,2>{0.436715275f, 0.52668345f},
-std::array<float,2>{0.802460551f, 0.650714934f},
-std::array<float,2>{0.0888846219f, 0.230719626f},
-std::array<float,2>{0.610031426f, 0.324295044f},
-std::array<float,2>{0.453989208f, 0.753919542f},
-std::array<float,2>{0.63002485f, 0.96225965f},
-std::array<float,2>{0.308215678f, 0.48210144f},
-std::array<float,2>{0.892401278f, 0.0860268995f},
-std::array<float,2>{0.157790169f, 0.616536736f},
-std::array<float,2>{0.515884936f, 0.556146502f},
-std::array<float,2>{0.378193438f, 0.0421667472f},
-std::array<float,2>{0.817522228f, 0.409648955f},
-std::array<float,2>{0.00443127751f, 0.930610061f},
-std::array<float,2>{0.961834729f, 0.851605415f},
-std::array<float,2>{0.209280729f, 0.259420246f},
-std::array<float,2>{0.741783857f, 0.131882593f},
-std::array<float,2>{0.312675118f, 0.693616211f},
-std::array<float,2>{0.993205011f, 0.713365078f},
-std::array<float,2>{0.24469094f, 0.143820882f},
-std::array<float,2>{0.712422669f, 0.267096549f},
-std::array<float,2>{0.362442017f, 0.864901841f},
-std::array<float,2>{0.55611223f, 0.907774806f},
-std::array<float,2>{0.414342463f, 0.424695909f},
-std::array<float,2>{0.84809202f, 0.0598850325f},
-std::array<float,2>{0.0359154008f, 0.543011904f},
-std::array<float,2>{0.668879271f, 0.605845392f},
-std::array<float,2>{0.259584576f, 0.0703976229f},
-std::array<float,2>{0.923633277f, 0.491978168f},
-std::array<float,2>{0.131525353f, 0.948332489f},
-std::array<float,2>{0.774454117f, 0.765743911f},
-std::array<float,2>{0.0961047634f, 0.334767461f},
-std::array<float,2>{0.591929734f, 0.24277091f},
-std::array<float,2>{0.491614044f, 0.625298858f},
-std::array<float,2>{0.835939169f, 0.50222981f},
-std::array<float,2>{0.0238329843f, 0.0185350887f},
-std::array<float,2>{0.510973811f, 0.399288952f},
-std::array<float,2>{0.397488475f, 0.890975058f},
-std::array<float,2>{0.732517421f, 0.817467213f},
-std::array<float,2>{0.341274738f, 0.302351534f},
-std::array<float,2>{0.951997817f, 0.180823907f},
-std::array<float,2>{0.202047408f, 0.730959058f},
-std::array<float,2>{0.609115481f, 0.685558617f},
-std::array<float,2>{0.447408319f, 0.218325496f},
-std::array<float,2>{0.788024068f, 0.362028658f},
-std::array<float,2>{0.0688797385f, 0.809087574f},
-std::array<float,2>{0.879530191f, 0.974623919f},
-std::array<float,2>{0.173532918f, 0.456730872f},
-std::array<float,2>{0.646837592f, 0.0987354666f},
-std::array<float,2>{0.292350292f, 0.56807369f},
-std::array<float,2>{0.979197919f, 0.598533154f},
-std::array<float,2>{0.228263065f, 0.0635919571f},
-std::array<float,2>{0.691150546f, 0.497085154f},
-std::array<float,2>{0.349905521f, 0.943825006f},
-std::array<float,2>{0.536848366f, 0.775870681f},
-std::array<float,2>{0.431786865f, 0.343328953f},
-std::array<float,2>{0.872587323f, 0.235861719f},
-std::array<float,2>{0.0513390526f, 0.633498251f},
-std::array<float,2>{0.686499894f, 0.705645263f},
-std::array<float,2>{0.269236416f, 0.15612787f},
-std::array<float,2>{0.917392015f, 0.275853336f},
-std::array<float,2>{0.147800714f, 0.873308063f},
-std::array<float,2>{0.758716166f, 0.915785909f},
-std::array<float,2>{0.121425658f, 0.434878826f},
-std::array<float,2>{0.568669915f, 0.0517782308f},
-std::array<float,2>{0.478760242f, 0.537008584f},
-std::array<float,2>{0.814199269f, 0.678091288f},
-std::array<float,2>{0.00131595519f, 0.203574151f},
-std::array<float,2>{0.5222947f, 0.369254053f},
-std::array<float,2>{0.382552087f, 0.798204839f},
-std::array<float,2>{0.737891436f, 0.976644278f},
-std::array<float,2>{0.319664299f, 0.465980679f},
-std::array<float,2>{0.965097249f, 0.104936615f},
-std::array<float,2>{0.205367625f, 0.572487772f},
-std::array<float,2>{0.61513114f, 0.510906518f},
-std::array<float,2>{0.457941622f, 0.0294914581f},
-std::array<float,2>{0.798910141f, 0.397732675f},
-std::array<float,2>{0.0925853252f, 0.904287457f},
-std::array<float,2>{0.895349979f, 0.824457467f},
-std::array<float,2>{0.162065566f, 0.305728197f},
-std::array<float,2>{0.627722025f, 0.179134876f},
-std::array<float,2>{0.312442541f, 0.721913218f},
-std::array<float,2>{0.928527057f, 0.748647869f},
-std::array<float,2>{0.125636995f, 0.163805515f},
-std::array<float,2>{0.664435804f, 0.295684278f},
-std::array<float,2>{0.26178056f, 0.828430533f},
-std::array<float,2>{0.587877691f, 0.881862581f},
-std::array<float,2>{0.487654507f, 0.380115718f},
-std::array<float,2>{0.777606666f, 0.0111979777f},
-std::array<float,2>{0.100994453f, 0.517001808f},
-std::array<float,2>{0.715299845f, 0.591851711f},
-std::array<float,2>{0.366492152f, 0.115738884f},
-std::array<float,2>{0.997265458f, 0.450380236f},
-std::array<float,2>{0.247311249f, 0.990942717f},
-std::array<float,2>{0.847573042f, 0.79197669f},
-std::array<float,2>{0.0331519656f, 0.345713526f},
-std::array<float,2>{0.559977114f, 0.1971623f},
-std::array<float,2>{0.421399593f, 0.662052214f},
-std::array<float,2>{0.782755733f, 0.549759686f},
-std::array<float,2>{0.0662605017f, 0.032224454f},
-std::array<float,2>{0.603870988f, 0.419244587f},
-std::array<float,2>{0.451542526f, 0.925468445f},
-std::array<float,2>{0.640712082f, 0.844777405f},
-std::array<float,2>{0.296450287f, 0.252248913f},
-std::array<float,2>{0.878422558f, 0.140390798f},
-std::array<float,2>{0.177692384f, 0.696943343f},
-std::array<float,2>{0.514441729f, 0.642070651f},
-std::array<float,2>{0.393653989f, 0.223446652f},
-std::array<float,2>{0.84142369f, 0.317198426f},
-std::array<float,2>{0.0302523673f, 0.759787023f},
-std::array<float,2>{0.94736737f, 0.95519346f},
-std::array<float,2>{0.198446795f, 0.469040692f},
-std::array<float,2>{0.72851944f, 0.083307229f},
-std::array<float,2>{0.337350518f, 0.620041311f},
-std::array<float,2>{0.886130929f, 0.528077304f},
-std::array<float,2>{0.18056874f, 0.00401518354f},
-std::array<float,2>{0.654010355f, 0.38343513f},
-std::array<float,2>{0.282659531f, 0.888388097f},
-std::array<float,2>{0.597573638f, 0.837434709f},
-std::array<float,2>{0.443518698f, 0.288571358f},
-std::array<float,2>{0.795582652f, 0.169889718f},
-std::array<float,2>{0.0745661184f, 0.740419328f},
-std::array<float,2>{0.721289873f, 0.671081603f},
-std::array<float,2>{0.330891013f, 0.193187803f},
-std::array<float,2>{0.937617242f, 0.357311517f},
-std::array<float,2>{0.192913249f, 0.783764422f},
-std::array<float,2>{0.831011832f, 0.992887795f},
-std::array<float,2>{0.0192751829f, 0.437952608f},
-std::array<float,2>{0.50763005f, 0.123886108f},
-std::array<float,2>{0.399784476f, 0.578398347f},
-std::array<float,2>{0.768232644f, 0.689872622f},
-std::array<float,2>{0.108782738f, 0.128496215f},
-std::array<float,2>{0.584294796f, 0.263417333f},
-std::array<float,2>{0.495221883f, 0.856485009f},
-std::array<float,2>{0.65655297f, 0.933948815f},
-std::array<float,2>{0.253984571f, 0.412440807f},
-std::array<float,2>{0.934593141f, 0.044757314f},
-std::array<float,2>{0.137903467f, 0.560738027f},
-std::array<float,2>{0.547425807f, 0.61147505f},
-std::array<float,2>{0.413704753f, 0.0900262892f},
-std::array<float,2>{0.852631211f, 0.48020345f},
-std::array<float,2>{0.0405173637f, 0.965170622f},
-std::array<float,2>{0.985340476f, 0.750593543f},
-std::array<float,2>{0.241836414f, 0.321463376f},
-std::array<float,2>{0.708222866f, 0.228659242f},
-std::array<float,2>{0.372021198f, 0.655553162f},
-std::array<float,2>{0.960751235f, 0.631963134f},
-std::array<float,2>{0.215670452f, 0.246314347f},
-std::array<float,2>{0.744652331f, 0.331457078f},
-std::array<float,2>{0.322594792f, 0.769857883f},
-std::array<float,2>{0.527110219f, 0.949783742f},
-std::array<float,2>{0.389274627f, 0.485770792f},
-std::array<float,2>{0.826679409f, 0.0745874569f},
-std::array<float,2>{0.0138955954f, 0.604615271f},
-std::array<float,2>{0.633671582f, 0.541715324f},
-std::array<float,2>{0.304462254f, 0.0561693422f},
-std::array<float,2>{0.901272058f, 0.428366512f},
-std::array<float,2>{0.164305121f, 0.913404882f},
-std::array<float,2>{0.804909229f, 0.862834811f},
-std::array<float,2>{0.0802764893f, 0.27268967f},
-std::array<float,2>{0.620248139f, 0.148012117f},
-std::array<float,2>{0.466211587f, 0.715073705f},
-std::array<float,2>{0.86500603f, 0.562718689f},
-std::array<float,2>{0.0572083741f, 0.0956241935f},
-std::array<float,2>{0.539139271f, 0.457395494f},
-std::array<float,2>{0.42943579f, 0.97084403f},
-std::array<float,2>{0.697078943f, 0.806812167f},
-std::array<float,2>{0.357196778f, 0.3663252f},
-std::array<float,2>{0.97618562f, 0.213067427f},
-std::array<float,2>{0.220881909f, 0.68067795f},
-std::array<float,2>{0.571130991f, 0.72698617f},
-std::array<float,2>{0.475506097f, 0.187008515f},
-std::array<float,2>{0.757733226f, 0.299022496f},
-std::array<float,2>{0.110933438f, 0.813253522f},
-std::array<float,2>{0.906635523f, 0.894945621f},
-std::array<float,2>{0.149781302f, 0.404425174f},
-std::array<float,2>{0.6766572f, 0.0204908606f},
-std::array<float,2>{0.277118772f, 0.507345557f}}
\ No newline at end of file
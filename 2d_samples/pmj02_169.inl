@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.165765464f, 0.0902834088f},
-std::array<float,2>{0.64957577f, 0.575331628f},
-std::array<float,2>{0.350871474f, 0.753846407f},
-std::array<float,2>{0.967655778f, 0.380095661f},
-std::array<float,2>{0.405623049f, 0.33931151f},
-std::array<float,2>{0.863390803f, 0.921676219f},
-std::array<float,2>{0.0601223968f, 0.628696859f},
-std::array<float,2>{0.503332376f, 0.21770753f},
-std::array<float,2>{0.268932581f, 0.143075436f},
-std::array<float,2>{0.906719565f, 0.694062829f},
-std::array<float,2>{0.190227255f, 0.974765003f},
-std::array<float,2>{0.716430008f, 0.252590269f},
-std::array<float,2>{0.101096481f, 0.481669575f},
-std::array<float,2>{0.572118402f, 0.82379365f},
-std::array<float,2>{0.468166202f, 0.544889808f},
-std::array<float,2>{0.767879128f, 0.0243332442f},
-std::array<float,2>{0.0156351645f, 0.247499883f},
-std::array<float,2>{0.53461951f, 0.658369899f},
-std::array<float,2>{0.428653806f, 0.898212433f},
-std::array<float,2>{0.841664374f, 0.358602494f},
-std::array<float,2>{0.332211047f, 0.418010294f},
-std::array<float,2>{0.997466087f, 0.784442365f},
-std::array<float,2>{0.149205133f, 0.618993044f},
-std::array<float,2>{0.665868878f, 0.110462531f},
-std::array<float,2>{0.474446625f, 0.0328193121f},
-std::array<float,2>{0.792575777f, 0.521592915f},
-std::array<float,2>{0.0828478932f, 0.863717914f},
-std::array<float,2>{0.602146983f, 0.464871645f},
-std::array<float,2>{0.227344155f, 0.302571595f},
-std::array<float,2>{0.727823555f, 0.950236142f},
-std::array<float,2>{0.309458733f, 0.719923735f},
-std::array<float,2>{0.892807305f, 0.164202526f},
-std::array<float,2>{0.0629805177f, 0.00998913124f},
-std::array<float,2>{0.620263219f, 0.554127336f},
-std::array<float,2>{0.493183672f, 0.831815183f},
-std::array<float,2>{0.797431707f, 0.489805341f},
-std::array<float,2>{0.285083324f, 0.270452291f},
-std::array<float,2>{0.882722497f, 0.995098591f},
-std::array<float,2>{0.241782263f, 0.707016468f},
-std::array<float,2>{0.743427277f, 0.134625971f},
-std::array<float,2>{0.419068992f, 0.196682364f},
-std::array<float,2>{0.815490842f, 0.646810353f},
-std::array<float,2>{0.0141282929f, 0.931054592f},
-std::array<float,2>{0.561944067f, 0.316303581f},
-std::array<float,2>{0.140476674f, 0.393293887f},
-std::array<float,2>{0.674767971f, 0.777887762f},
-std::array<float,2>{0.326062143f, 0.583563089f},
-std::array<float,2>{0.984012783f, 0.0714583695f},
-std::array<float,2>{0.215102687f, 0.174078405f},
-std::array<float,2>{0.701990366f, 0.74477917f},
-std::array<float,2>{0.25422895f, 0.966147363f},
-std::array<float,2>{0.924110651f, 0.288617611f},
-std::array<float,2>{0.445174605f, 0.440071493f},
-std::array<float,2>{0.750610054f, 0.846678972f},
-std::array<float,2>{0.110416405f, 0.515208125f},
-std::array<float,2>{0.583754718f, 0.0524891503f},
-std::array<float,2>{0.360884458f, 0.0966136456f},
-std::array<float,2>{0.948767662f, 0.59784025f},
-std::array<float,2>{0.181702018f, 0.798306584f},
-std::array<float,2>{0.632339358f, 0.436522841f},
-std::array<float,2>{0.0451362319f, 0.365309179f},
-std::array<float,2>{0.523763716f, 0.878855824f},
-std::array<float,2>{0.379994124f, 0.672751307f},
-std::array<float,2>{0.854061782f, 0.231522962f},
-std::array<float,2>{0.243641138f, 0.0613693334f},
-std::array<float,2>{0.738372564f, 0.505936503f},
-std::array<float,2>{0.291789204f, 0.854501963f},
-std::array<float,2>{0.884450614f, 0.449343532f},
-std::array<float,2>{0.487231284f, 0.296494901f},
-std::array<float,2>{0.809419572f, 0.956181586f},
-std::array<float,2>{0.0714293569f, 0.740785897f},
-std::array<float,2>{0.613953173f, 0.182687536f},
-std::array<float,2>{0.315582484f, 0.222391084f},
-std::array<float,2>{0.973607659f, 0.683995187f},
-std::array<float,2>{0.130733892f, 0.885222614f},
-std::array<float,2>{0.679839969f, 0.369053662f},
-std::array<float,2>{0.00357966078f, 0.423036456f},
-std::array<float,2>{0.551326096f, 0.810346246f},
-std::array<float,2>{0.411580443f, 0.601692498f},
-std::array<float,2>{0.8275823f, 0.109354794f},
-std::array<float,2>{0.117216937f, 0.125322327f},
-std::array<float,2>{0.591026068f, 0.717786789f},
-std::array<float,2>{0.445668131f, 0.987500072f},
-std::array<float,2>{0.761450946f, 0.276736259f},
-std::array<float,2>{0.262374669f, 0.494348556f},
-std::array<float,2>{0.93384254f, 0.836262643f},
-std::array<float,2>{0.209721223f, 0.557479084f},
-std::array<float,2>{0.691919804f, 0.00633525895f},
-std::array<float,2>{0.389385849f, 0.0684298575f},
-std::array<float,2>{0.844751954f, 0.587400615f},
-std::array<float,2>{0.0316128284f, 0.767680526f},
-std::array<float,2>{0.51692009f, 0.40164125f},
-std::array<float,2>{0.178368628f, 0.323433399f},
-std::array<float,2>{0.639841914f, 0.923978269f},
-std::array<float,2>{0.371730179f, 0.650000572f},
-std::array<float,2>{0.945097268f, 0.194228634f},
-std::array<float,2>{0.0543485023f, 0.122961432f},
-std::array<float,2>{0.512403071f, 0.61066401f},
-std::array<float,2>{0.396107078f, 0.792685866f},
-std::array<float,2>{0.86813575f, 0.41325435f},
-std::array<float,2>{0.353725135f, 0.347222835f},
-std::array<float,2>{0.957931519f, 0.902824938f},
-std::array<float,2>{0.158581227f, 0.6701352f},
-std::array<float,2>{0.64435178f, 0.239320636f},
-std::array<float,2>{0.45713377f, 0.156537816f},
-std::array<float,2>{0.778004706f, 0.729636252f},
-std::array<float,2>{0.101781309f, 0.938540637f},
-std::array<float,2>{0.567840934f, 0.307116389f},
-std::array<float,2>{0.200423867f, 0.454535812f},
-std::array<float,2>{0.710836172f, 0.870224416f},
-std::array<float,2>{0.279360473f, 0.530059218f},
-std::array<float,2>{0.921032548f, 0.0411073081f},
-std::array<float,2>{0.141782492f, 0.206315115f},
-std::array<float,2>{0.661372006f, 0.634349942f},
-std::array<float,2>{0.340634406f, 0.911904216f},
-std::array<float,2>{0.988500476f, 0.328570545f},
-std::array<float,2>{0.429864645f, 0.385496885f},
-std::array<float,2>{0.834113657f, 0.763808846f},
-std::array<float,2>{0.0258080065f, 0.567065001f},
-std::array<float,2>{0.546536803f, 0.0799209476f},
-std::array<float,2>{0.302533835f, 0.0162881482f},
-std::array<float,2>{0.901821256f, 0.535198987f},
-std::array<float,2>{0.221729994f, 0.81658709f},
-std::array<float,2>{0.720485985f, 0.469746411f},
-std::array<float,2>{0.0901260376f, 0.258952081f},
-std::array<float,2>{0.598609149f, 0.98162204f},
-std::array<float,2>{0.480058819f, 0.701108158f},
-std::array<float,2>{0.786323428f, 0.151146099f},
-std::array<float,2>{0.191905081f, 0.10344018f},
-std::array<float,2>{0.712721229f, 0.607509673f},
-std::array<float,2>{0.271272004f, 0.806709707f},
-std::array<float,2>{0.911419272f, 0.428661734f},
-std::array<float,2>{0.461440712f, 0.373311281f},
-std::array<float,2>{0.771968246f, 0.887585402f},
-std::array<float,2>{0.0949093178f, 0.682443023f},
-std::array<float,2>{0.575346708f, 0.223008379f},
-std::array<float,2>{0.346101791f, 0.186259314f},
-std::array<float,2>{0.964680493f, 0.735921741f},
-std::array<float,2>{0.170733109f, 0.960740805f},
-std::array<float,2>{0.653065801f, 0.291228205f},
-std::array<float,2>{0.0575586818f, 0.447570294f},
-std::array<float,2>{0.507459521f, 0.859242439f},
-std::array<float,2>{0.398787349f, 0.500234723f},
-std::array<float,2>{0.860847116f, 0.058552254f},
-std::array<float,2>{0.0796717554f, 0.188425422f},
-std::array<float,2>{0.608378649f, 0.654102147f},
-std::array<float,2>{0.472445935f, 0.928779662f},
-std::array<float,2>{0.796658456f, 0.327995062f},
-std::array<float,2>{0.306742311f, 0.403226644f},
-std::array<float,2>{0.896113157f, 0.773142517f},
-std::array<float,2>{0.23168087f, 0.590928376f},
-std::array<float,2>{0.733623147f, 0.0658178106f},
-std::array<float,2>{0.423434615f, 0.00349468458f},
-std::array<float,2>{0.839076519f, 0.560071588f},
-std::array<float,2>{0.019665027f, 0.842312932f},
-std::array<float,2>{0.537959397f, 0.496126413f},
-std::array<float,2>{0.154719114f, 0.278286189f},
-std::array<float,2>{0.669999361f, 0.98936832f},
-std::array<float,2>{0.329264015f, 0.714456975f},
-std::array<float,2>{0.996007562f, 0.132428184f},
-std::array<float,2>{0.00865208544f, 0.0457113311f},
-std::array<float,2>{0.555178881f, 0.525893927f},
-std::array<float,2>{0.416145831f, 0.873677135f},
-std::array<float,2>{0.819051564f, 0.458593786f},
-std::array<float,2>{0.323697656f, 0.31230551f},
-std::array<float,2>{0.979511082f, 0.944758832f},
-std::array<float,2>{0.13313067f, 0.731720507f},
-std::array<float,2>{0.678811669f, 0.163498059f},
-std::array<float,2>{0.49923262f, 0.237592116f},
-std::array<float,2>{0.804381549f, 0.667138934f},
-std::array<float,2>{0.0685300753f, 0.898530066f},
-std::array<float,2>{0.622283518f, 0.349346638f},
-std::array<float,2>{0.237709716f, 0.408088088f},
-std::array<float,2>{0.74754256f, 0.794169247f},
-std::array<float,2>{0.28539899f, 0.615074933f},
-std::array<float,2>{0.875043154f, 0.120719522f},
-std::array<float,2>{0.185558736f, 0.154331401f},
-std::array<float,2>{0.627015173f, 0.697701275f},
-std::array<float,2>{0.36476168f, 0.97818929f},
-std::array<float,2>{0.950793386f, 0.262047648f},
-std::array<float,2>{0.376114696f, 0.476273894f},
-std::array<float,2>{0.858390033f, 0.814132631f},
-std::array<float,2>{0.0391148478f, 0.531312168f},
-std::array<float,2>{0.528047621f, 0.0199560113f},
-std::array<float,2>{0.252371043f, 0.0842683166f},
-std::array<float,2>{0.92598927f, 0.566302776f},
-std::array<float,2>{0.212444007f, 0.758308947f},
-std::array<float,2>{0.697659492f, 0.389216512f},
-std::array<float,2>{0.11516989f, 0.332695335f},
-std::array<float,2>{0.579408526f, 0.906962276f},
-std::array<float,2>{0.43797335f, 0.639678895f},
-std::array<float,2>{0.757155776f, 0.208710313f},
-std::array<float,2>{0.127626494f, 0.0280654281f},
-std::array<float,2>{0.686012983f, 0.542370319f},
-std::array<float,2>{0.319125414f, 0.824560046f},
-std::array<float,2>{0.97126925f, 0.479596227f},
-std::array<float,2>{0.410093337f, 0.256113172f},
-std::array<float,2>{0.821783304f, 0.970685661f},
-std::array<float,2>{0.00502856914f, 0.690824091f},
-std::array<float,2>{0.548757911f, 0.146704197f},
-std::array<float,2>{0.293769389f, 0.213868096f},
-std::array<float,2>{0.886875033f, 0.629007816f},
-std::array<float,2>{0.247952566f, 0.915094852f},
-std::array<float,2>{0.735355794f, 0.340759546f},
-std::array<float,2>{0.0760775581f, 0.376749128f},
-std::array<float,2>{0.609603405f, 0.757736683f},
-std::array<float,2>{0.489839345f, 0.573999703f},
-std::array<float,2>{0.805742919f, 0.0875184163f},
-std::array<float,2>{0.0377631709f, 0.168727428f},
-std::array<float,2>{0.520037651f, 0.723896623f},
-std::array<float,2>{0.384787828f, 0.948073804f},
-std::array<float,2>{0.851497531f, 0.29972735f},
-std::array<float,2>{0.368038476f, 0.461949229f},
-std::array<float,2>{0.941372335f, 0.860010624f},
-std::array<float,2>{0.174011081f, 0.51736629f},
-std::array<float,2>{0.635694563f, 0.0379955694f},
-std::array<float,2>{0.451603204f, 0.1134817f},
-std::array<float,2>{0.764006138f, 0.623670459f},
-std::array<float,2>{0.122621968f, 0.787012935f},
-std::array<float,2>{0.589428365f, 0.414560378f},
-std::array<float,2>{0.203869894f, 0.351780057f},
-std::array<float,2>{0.690816641f, 0.89143604f},
-std::array<float,2>{0.260278344f, 0.660160363f},
-std::array<float,2>{0.932852924f, 0.243980423f},
-std::array<float,2>{0.107443362f, 0.0750282407f},
-std::array<float,2>{0.563681841f, 0.579040885f},
-std::array<float,2>{0.456738263f, 0.7750386f},
-std::array<float,2>{0.775535285f, 0.395650029f},
-std::array<float,2>{0.276463777f, 0.317019522f},
-std::array<float,2>{0.916722596f, 0.935489178f},
-std::array<float,2>{0.196755126f, 0.64092648f},
-std::array<float,2>{0.70445466f, 0.199466884f},
-std::array<float,2>{0.390750885f, 0.140087754f},
-std::array<float,2>{0.872862875f, 0.710244715f},
-std::array<float,2>{0.0501214787f, 0.998170912f},
-std::array<float,2>{0.510032833f, 0.267473578f},
-std::array<float,2>{0.160650566f, 0.484408259f},
-std::array<float,2>{0.644550502f, 0.834029138f},
-std::array<float,2>{0.357345611f, 0.547085285f},
-std::array<float,2>{0.954996943f, 0.0128421122f},
-std::array<float,2>{0.224027127f, 0.228862405f},
-std::array<float,2>{0.726316571f, 0.678660095f},
-std::array<float,2>{0.297329664f, 0.880634725f},
-std::array<float,2>{0.903741241f, 0.36075592f},
-std::array<float,2>{0.484367996f, 0.433332771f},
-std::array<float,2>{0.784347534f, 0.803951263f},
-std::array<float,2>{0.0877010524f, 0.595823526f},
-std::array<float,2>{0.595638335f, 0.0998373628f},
-std::array<float,2>{0.338322967f, 0.0505357273f},
-std::array<float,2>{0.986856878f, 0.508536458f},
-std::array<float,2>{0.148206577f, 0.849113226f},
-std::array<float,2>{0.65858072f, 0.443799496f},
-std::array<float,2>{0.0284980778f, 0.282630473f},
-std::array<float,2>{0.541553736f, 0.962477446f},
-std::array<float,2>{0.43729955f, 0.746189296f},
-std::array<float,2>{0.830261767f, 0.176228046f},
-std::array<float,2>{0.151757821f, 0.111905001f},
-std::array<float,2>{0.667924345f, 0.619246066f},
-std::array<float,2>{0.334264547f, 0.782301426f},
-std::array<float,2>{0.99998033f, 0.421432137f},
-std::array<float,2>{0.427563339f, 0.357145756f},
-std::array<float,2>{0.842520654f, 0.895661831f},
-std::array<float,2>{0.0178339127f, 0.65716517f},
-std::array<float,2>{0.532544255f, 0.248112991f},
-std::array<float,2>{0.312391728f, 0.166346312f},
-std::array<float,2>{0.892112076f, 0.721953034f},
-std::array<float,2>{0.229427874f, 0.952018082f},
-std::array<float,2>{0.728852093f, 0.302883327f},
-std::array<float,2>{0.0850868076f, 0.468334585f},
-std::array<float,2>{0.604138553f, 0.86648798f},
-std::array<float,2>{0.474747777f, 0.520322621f},
-std::array<float,2>{0.789865553f, 0.034072049f},
-std::array<float,2>{0.0619981252f, 0.21578145f},
-std::array<float,2>{0.50158906f, 0.625120103f},
-std::array<float,2>{0.404287666f, 0.918527007f},
-std::array<float,2>{0.865859032f, 0.336935937f},
-std::array<float,2>{0.347664982f, 0.381727725f},
-std::array<float,2>{0.964962363f, 0.751851261f},
-std::array<float,2>{0.16688776f, 0.576650977f},
-std::array<float,2>{0.650536418f, 0.0930031687f},
-std::array<float,2>{0.465131462f, 0.0256611016f},
-std::array<float,2>{0.76674217f, 0.54592514f},
-std::array<float,2>{0.0980550125f, 0.821856916f},
-std::array<float,2>{0.572492182f, 0.484114677f},
-std::array<float,2>{0.187663451f, 0.250721455f},
-std::array<float,2>{0.717824101f, 0.97318387f},
-std::array<float,2>{0.265721053f, 0.692135274f},
-std::array<float,2>{0.909470499f, 0.141287699f},
-std::array<float,2>{0.112681776f, 0.0530592725f},
-std::array<float,2>{0.585720539f, 0.513600707f},
-std::array<float,2>{0.442444474f, 0.844066799f},
-std::array<float,2>{0.75383234f, 0.438109279f},
-std::array<float,2>{0.257536501f, 0.286808193f},
-std::array<float,2>{0.922759652f, 0.968219519f},
-std::array<float,2>{0.217357337f, 0.743009388f},
-std::array<float,2>{0.701010585f, 0.173776984f},
-std::array<float,2>{0.380892366f, 0.233790129f},
-std::array<float,2>{0.853246868f, 0.674648106f},
-std::array<float,2>{0.0444963835f, 0.875211656f},
-std::array<float,2>{0.52671206f, 0.364895999f},
-std::array<float,2>{0.18126896f, 0.434373111f},
-std::array<float,2>{0.629375279f, 0.80004251f},
-std::array<float,2>{0.362050742f, 0.600519955f},
-std::array<float,2>{0.945767045f, 0.0950454026f},
-std::array<float,2>{0.239088327f, 0.136138111f},
-std::array<float,2>{0.744582236f, 0.704106629f},
-std::array<float,2>{0.283192009f, 0.993899345f},
-std::array<float,2>{0.87996912f, 0.272411168f},
-std::array<float,2>{0.49549824f, 0.490619421f},
-std::array<float,2>{0.79989481f, 0.829597533f},
-std::array<float,2>{0.0649947301f, 0.551959574f},
-std::array<float,2>{0.61867702f, 0.00801363122f},
-std::array<float,2>{0.328108668f, 0.0735500604f},
-std::array<float,2>{0.980537355f, 0.584094107f},
-std::array<float,2>{0.136747465f, 0.779498518f},
-std::array<float,2>{0.673088312f, 0.39242959f},
-std::array<float,2>{0.0120007433f, 0.313674659f},
-std::array<float,2>{0.559459627f, 0.933258235f},
-std::array<float,2>{0.420716733f, 0.645625412f},
-std::array<float,2>{0.813312352f, 0.19809638f},
-std::array<float,2>{0.208709359f, 0.00518662157f},
-std::array<float,2>{0.695198119f, 0.556447208f},
-std::array<float,2>{0.264539659f, 0.839775741f},
-std::array<float,2>{0.935809433f, 0.49264586f},
-std::array<float,2>{0.447917074f, 0.274926424f},
-std::array<float,2>{0.758990347f, 0.985184133f},
-std::array<float,2>{0.119646728f, 0.715894163f},
-std::array<float,2>{0.59215349f, 0.128484517f},
-std::array<float,2>{0.373997718f, 0.192011774f},
-std::array<float,2>{0.943243206f, 0.651624858f},
-std::array<float,2>{0.175927296f, 0.923506439f},
-std::array<float,2>{0.638529301f, 0.321319342f},
-std::array<float,2>{0.0348328687f, 0.398639828f},
-std::array<float,2>{0.519498467f, 0.766545177f},
-std::array<float,2>{0.387068242f, 0.589540899f},
-std::array<float,2>{0.846181333f, 0.0676954687f},
-std::array<float,2>{0.073770158f, 0.180668682f},
-std::array<float,2>{0.615253091f, 0.738529146f},
-std::array<float,2>{0.485064596f, 0.954051197f},
-std::array<float,2>{0.81134671f, 0.293852448f},
-std::array<float,2>{0.28994891f, 0.451770157f},
-std::array<float,2>{0.886004448f, 0.852663696f},
-std::array<float,2>{0.245693162f, 0.505060911f},
-std::array<float,2>{0.742180407f, 0.0605059564f},
-std::array<float,2>{0.412346572f, 0.107046977f},
-std::array<float,2>{0.826070964f, 0.605431974f},
-std::array<float,2>{0.00138389331f, 0.812045276f},
-std::array<float,2>{0.554647326f, 0.424207658f},
-std::array<float,2>{0.132372797f, 0.370716572f},
-std::array<float,2>{0.683386326f, 0.884743392f},
-std::array<float,2>{0.31387189f, 0.686557174f},
-std::array<float,2>{0.975803256f, 0.219614908f},
-std::array<float,2>{0.0238246061f, 0.0815847218f},
-std::array<float,2>{0.543337882f, 0.568989873f},
-std::array<float,2>{0.433059275f, 0.763344884f},
-std::array<float,2>{0.832821012f, 0.383945525f},
-std::array<float,2>{0.343692154f, 0.33115235f},
-std::array<float,2>{0.991943777f, 0.913763344f},
-std::array<float,2>{0.142612189f, 0.635380208f},
-std::array<float,2>{0.662758052f, 0.203958154f},
-std::array<float,2>{0.478083074f, 0.148603871f},
-std::array<float,2>{0.787434638f, 0.702341676f},
-std::array<float,2>{0.0925733671f, 0.983332872f},
-std::array<float,2>{0.601010442f, 0.260154992f},
-std::array<float,2>{0.220474362f, 0.471519649f},
-std::array<float,2>{0.72084403f, 0.819206238f},
-std::array<float,2>{0.303773046f, 0.538487732f},
-std::array<float,2>{0.899652481f, 0.0184980389f},
-std::array<float,2>{0.156951249f, 0.241311282f},
-std::array<float,2>{0.641992509f, 0.66844815f},
-std::array<float,2>{0.3535043f, 0.904608846f},
-std::array<float,2>{0.960035861f, 0.344976217f},
-std::array<float,2>{0.396492243f, 0.411138326f},
-std::array<float,2>{0.870312154f, 0.790469766f},
-std::array<float,2>{0.0513197109f, 0.612170458f},
-std::array<float,2>{0.514049232f, 0.123877965f},
-std::array<float,2>{0.278403163f, 0.0397364162f},
-std::array<float,2>{0.91881597f, 0.527922094f},
-std::array<float,2>{0.20151943f, 0.868917167f},
-std::array<float,2>{0.708534777f, 0.455630511f},
-std::array<float,2>{0.104450695f, 0.306116194f},
-std::array<float,2>{0.569345951f, 0.939706624f},
-std::array<float,2>{0.460616499f, 0.727876782f},
-std::array<float,2>{0.780396342f, 0.158881724f},
-std::array<float,2>{0.23427178f, 0.0625255108f},
-std::array<float,2>{0.730894268f, 0.59371978f},
-std::array<float,2>{0.306173891f, 0.770375848f},
-std::array<float,2>{0.897633791f, 0.405876964f},
-std::array<float,2>{0.469180554f, 0.325618595f},
-std::array<float,2>{0.794887125f, 0.926617324f},
-std::array<float,2>{0.0806973353f, 0.655622602f},
-std::array<float,2>{0.607173622f, 0.190180585f},
-std::array<float,2>{0.331587583f, 0.129251018f},
-std::array<float,2>{0.993708551f, 0.711490393f},
-std::array<float,2>{0.153389812f, 0.992182434f},
-std::array<float,2>{0.669366002f, 0.28036347f},
-std::array<float,2>{0.0220915098f, 0.498789907f},
-std::array<float,2>{0.536589384f, 0.841464341f},
-std::array<float,2>{0.425663739f, 0.56167388f},
-std::array<float,2>{0.836019516f, 0.00136897131f},
-std::array<float,2>{0.0961716995f, 0.22634989f},
-std::array<float,2>{0.576432645f, 0.680292249f},
-std::array<float,2>{0.464444458f, 0.890474141f},
-std::array<float,2>{0.771090686f, 0.372187018f},
-std::array<float,2>{0.272094458f, 0.425994515f},
-std::array<float,2>{0.912304103f, 0.804964244f},
-std::array<float,2>{0.194353282f, 0.607403755f},
-std::array<float,2>{0.714704275f, 0.10418614f},
-std::array<float,2>{0.402282387f, 0.055979155f},
-std::array<float,2>{0.86193949f, 0.502449393f},
-std::array<float,2>{0.0549963452f, 0.856424093f},
-std::array<float,2>{0.505451322f, 0.44567278f},
-std::array<float,2>{0.169259235f, 0.289109588f},
-std::array<float,2>{0.655628383f, 0.957611501f},
-std::array<float,2>{0.344500303f, 0.738125145f},
-std::array<float,2>{0.961827278f, 0.184628978f},
-std::array<float,2>{0.0418745093f, 0.0226090085f},
-std::array<float,2>{0.530886829f, 0.535076082f},
-std::array<float,2>{0.378151357f, 0.815639675f},
-std::array<float,2>{0.856538832f, 0.473185867f},
-std::array<float,2>{0.365494519f, 0.264559567f},
-std::array<float,2>{0.952559829f, 0.979709566f},
-std::array<float,2>{0.185493022f, 0.695585668f},
-std::array<float,2>{0.625284851f, 0.153970703f},
-std::array<float,2>{0.440559983f, 0.210120633f},
-std::array<float,2>{0.754901826f, 0.637897193f},
-std::array<float,2>{0.115263149f, 0.909032226f},
-std::array<float,2>{0.581954181f, 0.335525304f},
-std::array<float,2>{0.213912368f, 0.387118429f},
-std::array<float,2>{0.695878863f, 0.760036409f},
-std::array<float,2>{0.251740903f, 0.564282835f},
-std::array<float,2>{0.928557038f, 0.0821085274f},
-std::array<float,2>{0.134948358f, 0.160343289f},
-std::array<float,2>{0.677576065f, 0.73289305f},
-std::array<float,2>{0.320663512f, 0.941629052f},
-std::array<float,2>{0.977056444f, 0.310208708f},
-std::array<float,2>{0.415729612f, 0.458985269f},
-std::array<float,2>{0.817039192f, 0.872483909f},
-std::array<float,2>{0.0103627807f, 0.523491502f},
-std::array<float,2>{0.556843519f, 0.0434925631f},
-std::array<float,2>{0.288104564f, 0.117589206f},
-std::array<float,2>{0.877526224f, 0.616410196f},
-std::array<float,2>{0.234484017f, 0.796795428f},
-std::array<float,2>{0.749454379f, 0.409726858f},
-std::array<float,2>{0.0665184185f, 0.349823266f},
-std::array<float,2>{0.623092115f, 0.900576413f},
-std::array<float,2>{0.497214586f, 0.664386153f},
-std::array<float,2>{0.801959574f, 0.235389858f},
-std::array<float,2>{0.173727691f, 0.0364612974f},
-std::array<float,2>{0.634260833f, 0.519137025f},
-std::array<float,2>{0.369677097f, 0.861932695f},
-std::array<float,2>{0.938000917f, 0.46349591f},
-std::array<float,2>{0.384510875f, 0.297611266f},
-std::array<float,2>{0.848098278f, 0.947023571f},
-std::array<float,2>{0.0369754434f, 0.726360321f},
-std::array<float,2>{0.523142278f, 0.171758488f},
-std::array<float,2>{0.258363813f, 0.244958192f},
-std::array<float,2>{0.930060387f, 0.663877189f},
-std::array<float,2>{0.206936762f, 0.893624604f},
-std::array<float,2>{0.688430429f, 0.355121672f},
-std::array<float,2>{0.12460722f, 0.417804152f},
-std::array<float,2>{0.587192774f, 0.788633883f},
-std::array<float,2>{0.450903267f, 0.622345209f},
-std::array<float,2>{0.76366365f, 0.116533011f},
-std::array<float,2>{0.00752366008f, 0.14565286f},
-std::array<float,2>{0.549408495f, 0.689431131f},
-std::array<float,2>{0.407992244f, 0.971600652f},
-std::array<float,2>{0.822577059f, 0.255248845f},
-std::array<float,2>{0.317593664f, 0.478194743f},
-std::array<float,2>{0.969687939f, 0.827790082f},
-std::array<float,2>{0.126191333f, 0.539711714f},
-std::array<float,2>{0.685409725f, 0.030193314f},
-std::array<float,2>{0.49126339f, 0.0891629905f},
-std::array<float,2>{0.806998312f, 0.571807921f},
-std::array<float,2>{0.0780886412f, 0.755183935f},
-std::array<float,2>{0.611860096f, 0.378451705f},
-std::array<float,2>{0.24947089f, 0.34323734f},
-std::array<float,2>{0.737701237f, 0.917059064f},
-std::array<float,2>{0.2963579f, 0.632034838f},
-std::array<float,2>{0.889313221f, 0.211141333f},
-std::array<float,2>{0.0890136734f, 0.0992894322f},
-std::array<float,2>{0.596479177f, 0.594047189f},
-std::array<float,2>{0.481474221f, 0.801383376f},
-std::array<float,2>{0.781597614f, 0.429687798f},
-std::array<float,2>{0.30039981f, 0.362312168f},
-std::array<float,2>{0.905338705f, 0.881022274f},
-std::array<float,2>{0.226359516f, 0.677412331f},
-std::array<float,2>{0.723898351f, 0.227944806f},
-std::array<float,2>{0.435315371f, 0.178517953f},
-std::array<float,2>{0.829173267f, 0.749499738f},
-std::array<float,2>{0.0300211199f, 0.963943005f},
-std::array<float,2>{0.540974796f, 0.283310115f},
-std::array<float,2>{0.146128938f, 0.442459971f},
-std::array<float,2>{0.656492651f, 0.849942744f},
-std::array<float,2>{0.33681187f, 0.511558652f},
-std::array<float,2>{0.986083448f, 0.0472276881f},
-std::array<float,2>{0.198201507f, 0.201357141f},
-std::array<float,2>{0.705919921f, 0.643614411f},
-std::array<float,2>{0.274586856f, 0.937394261f},
-std::array<float,2>{0.915332496f, 0.319473892f},
-std::array<float,2>{0.454822063f, 0.397800714f},
-std::array<float,2>{0.774564743f, 0.775799513f},
-std::array<float,2>{0.107188962f, 0.580167055f},
-std::array<float,2>{0.566060007f, 0.0780227333f},
-std::array<float,2>{0.359203815f, 0.0152784986f},
-std::array<float,2>{0.955672979f, 0.549160659f},
-std::array<float,2>{0.163257733f, 0.833356321f},
-std::array<float,2>{0.64826721f, 0.487091243f},
-std::array<float,2>{0.047220204f, 0.268377453f},
-std::array<float,2>{0.508393288f, 0.99622339f},
-std::array<float,2>{0.393330246f, 0.708757699f},
-std::array<float,2>{0.873209894f, 0.136938676f},
-std::array<float,2>{0.182824016f, 0.0942318141f},
-std::array<float,2>{0.631502151f, 0.600998104f},
-std::array<float,2>{0.359783888f, 0.799772382f},
-std::array<float,2>{0.948241711f, 0.434878975f},
-std::array<float,2>{0.379469365f, 0.363965333f},
-std::array<float,2>{0.855200708f, 0.876356363f},
-std::array<float,2>{0.0461785644f, 0.675311446f},
-std::array<float,2>{0.525151372f, 0.233180836f},
-std::array<float,2>{0.255726844f, 0.172569633f},
-std::array<float,2>{0.925689518f, 0.743685067f},
-std::array<float,2>{0.216654986f, 0.966928422f},
-std::array<float,2>{0.703074813f, 0.285692543f},
-std::array<float,2>{0.110311508f, 0.439203531f},
-std::array<float,2>{0.582863927f, 0.845473647f},
-std::array<float,2>{0.44424659f, 0.512620151f},
-std::array<float,2>{0.751060963f, 0.0543590672f},
-std::array<float,2>{0.0150030982f, 0.19863835f},
-std::array<float,2>{0.561347663f, 0.644718051f},
-std::array<float,2>{0.418135732f, 0.931803524f},
-std::array<float,2>{0.814889252f, 0.312805772f},
-std::array<float,2>{0.32455501f, 0.3907426f},
-std::array<float,2>{0.982890129f, 0.780914366f},
-std::array<float,2>{0.139466301f, 0.585106194f},
-std::array<float,2>{0.675425351f, 0.0724623054f},
-std::array<float,2>{0.492545992f, 0.00963686593f},
-std::array<float,2>{0.798714459f, 0.551396489f},
-std::array<float,2>{0.0644348413f, 0.828356206f},
-std::array<float,2>{0.619948983f, 0.49210304f},
-std::array<float,2>{0.240803078f, 0.273045689f},
-std::array<float,2>{0.742979169f, 0.992600679f},
-std::array<float,2>{0.283676296f, 0.703970075f},
-std::array<float,2>{0.881667614f, 0.134849936f},
-std::array<float,2>{0.0839699581f, 0.0348200351f},
-std::array<float,2>{0.603253961f, 0.521017373f},
-std::array<float,2>{0.473566592f, 0.865779698f},
-std::array<float,2>{0.791348279f, 0.467751563f},
-std::array<float,2>{0.309752136f, 0.304327786f},
-std::array<float,2>{0.893607736f, 0.952169716f},
-std::array<float,2>{0.228477225f, 0.721460879f},
-std::array<float,2>{0.726965487f, 0.167570353f},
-std::array<float,2>{0.428937972f, 0.249126807f},
-std::array<float,2>{0.840689957f, 0.65786159f},
-std::array<float,2>{0.0172632933f, 0.895393729f},
-std::array<float,2>{0.533455551f, 0.355937451f},
-std::array<float,2>{0.149816439f, 0.420526803f},
-std::array<float,2>{0.664470971f, 0.781315267f},
-std::array<float,2>{0.333886027f, 0.620749652f},
-std::array<float,2>{0.996615052f, 0.112314947f},
-std::array<float,2>{0.190832287f, 0.141796172f},
-std::array<float,2>{0.715694427f, 0.692638457f},
-std::array<float,2>{0.26775533f, 0.974562645f},
-std::array<float,2>{0.908115566f, 0.251254767f},
-std::array<float,2>{0.466819763f, 0.483295411f},
-std::array<float,2>{0.768655002f, 0.820997715f},
-std::array<float,2>{0.100007512f, 0.545846403f},
-std::array<float,2>{0.571179748f, 0.0268750973f},
-std::array<float,2>{0.350130022f, 0.0919623598f},
-std::array<float,2>{0.968571305f, 0.577967942f},
-std::array<float,2>{0.164475858f, 0.750286758f},
-std::array<float,2>{0.648481786f, 0.38197884f},
-std::array<float,2>{0.0595650114f, 0.336456209f},
-std::array<float,2>{0.502132475f, 0.919237316f},
-std::array<float,2>{0.404486507f, 0.626311898f},
-std::array<float,2>{0.864649713f, 0.216149747f},
-std::array<float,2>{0.220959365f, 0.0193755012f},
-std::array<float,2>{0.719236851f, 0.537928045f},
-std::array<float,2>{0.301185697f, 0.819363892f},
-std::array<float,2>{0.900999844f, 0.472609669f},
-std::array<float,2>{0.478566706f, 0.261664778f},
-std::array<float,2>{0.785974801f, 0.983638704f},
-std::array<float,2>{0.0910084918f, 0.701680243f},
-std::array<float,2>{0.599336326f, 0.150243491f},
-std::array<float,2>{0.341165811f, 0.204287037f},
-std::array<float,2>{0.989629745f, 0.635887146f},
-std::array<float,2>{0.141512454f, 0.912930667f},
-std::array<float,2>{0.660432518f, 0.330971062f},
-std::array<float,2>{0.0273157246f, 0.383711994f},
-std::array<float,2>{0.545181692f, 0.762198985f},
-std::array<float,2>{0.431367904f, 0.569977522f},
-std::array<float,2>{0.83571279f, 0.0810303688f},
-std::array<float,2>{0.103046432f, 0.160024881f},
-std::array<float,2>{0.566814601f, 0.727105975f},
-std::array<float,2>{0.45869559f, 0.940900326f},
-std::array<float,2>{0.778995514f, 0.305532217f},
-std::array<float,2>{0.280424714f, 0.456603795f},
-std::array<float,2>{0.920373082f, 0.867666125f},
-std::array<float,2>{0.19999209f, 0.528846741f},
-std::array<float,2>{0.709009945f, 0.0409762263f},
-std::array<float,2>{0.395045638f, 0.124867573f},
-std::array<float,2>{0.868227065f, 0.613273442f},
-std::array<float,2>{0.0534301251f, 0.789408624f},
-std::array<float,2>{0.513651788f, 0.410637289f},
-std::array<float,2>{0.159808308f, 0.344260395f},
-std::array<float,2>{0.642701864f, 0.905530214f},
-std::array<float,2>{0.355060875f, 0.669332922f},
-std::array<float,2>{0.958888471f, 0.24095355f},
-std::array<float,2>{0.0331307389f, 0.0673696995f},
-std::array<float,2>{0.51628983f, 0.588518202f},
-std::array<float,2>{0.390077323f, 0.767287016f},
-std::array<float,2>{0.844448149f, 0.400066942f},
-std::array<float,2>{0.372945815f, 0.320431232f},
-std::array<float,2>{0.944279432f, 0.922753811f},
-std::array<float,2>{0.17935659f, 0.651280344f},
-std::array<float,2>{0.639434755f, 0.192708641f},
-std::array<float,2>{0.44718498f, 0.12741825f},
-std::array<float,2>{0.760530293f, 0.715319097f},
-std::array<float,2>{0.119134128f, 0.986133277f},
-std::array<float,2>{0.590065181f, 0.273830742f},
-std::array<float,2>{0.210144013f, 0.493896991f},
-std::array<float,2>{0.692475855f, 0.837990046f},
-std::array<float,2>{0.263252586f, 0.555534542f},
-std::array<float,2>{0.934789598f, 0.00444624806f},
-std::array<float,2>{0.129066214f, 0.22050494f},
-std::array<float,2>{0.681259692f, 0.685662329f},
-std::array<float,2>{0.315140188f, 0.883023083f},
-std::array<float,2>{0.974551797f, 0.369709611f},
-std::array<float,2>{0.411085963f, 0.425024807f},
-std::array<float,2>{0.82714045f, 0.81063062f},
-std::array<float,2>{0.00254122145f, 0.603539526f},
-std::array<float,2>{0.552317262f, 0.105576858f},
-std::array<float,2>{0.292367846f, 0.0595449954f},
-std::array<float,2>{0.883051753f, 0.504071534f},
-std::array<float,2>{0.243082076f, 0.851604402f},
-std::array<float,2>{0.739806294f, 0.452809989f},
-std::array<float,2>{0.0705566481f, 0.294225752f},
-std::array<float,2>{0.614404678f, 0.954734743f},
-std::array<float,2>{0.488180757f, 0.739919364f},
-std::array<float,2>{0.809690356f, 0.180247456f},
-std::array<float,2>{0.21155417f, 0.0837597847f},
-std::array<float,2>{0.69847858f, 0.563234806f},
-std::array<float,2>{0.253685057f, 0.760935545f},
-std::array<float,2>{0.927147925f, 0.387757719f},
-std::array<float,2>{0.439300209f, 0.334304571f},
-std::array<float,2>{0.756289899f, 0.910148084f},
-std::array<float,2>{0.114004031f, 0.63751471f},
-std::array<float,2>{0.578156769f, 0.209728807f},
-std::array<float,2>{0.363902599f, 0.15305002f},
-std::array<float,2>{0.949381471f, 0.696967304f},
-std::array<float,2>{0.18715179f, 0.979435802f},
-std::array<float,2>{0.628126979f, 0.265020609f},
-std::array<float,2>{0.0407255776f, 0.473947674f},
-std::array<float,2>{0.52880609f, 0.815178037f},
-std::array<float,2>{0.375080019f, 0.533460081f},
-std::array<float,2>{0.859142244f, 0.0217450578f},
-std::array<float,2>{0.0694160983f, 0.23462896f},
-std::array<float,2>{0.621470094f, 0.665234149f},
-std::array<float,2>{0.498852313f, 0.902209282f},
-std::array<float,2>{0.802958667f, 0.350667357f},
-std::array<float,2>{0.286268175f, 0.409155905f},
-std::array<float,2>{0.876446545f, 0.795829535f},
-std::array<float,2>{0.237294719f, 0.616122425f},
-std::array<float,2>{0.746491671f, 0.118692055f},
-std::array<float,2>{0.41786319f, 0.0445531309f},
-std::array<float,2>{0.819929659f, 0.524869144f},
-std::array<float,2>{0.00903001986f, 0.871459365f},
-std::array<float,2>{0.55610615f, 0.459981769f},
-std::array<float,2>{0.13451317f, 0.308597416f},
-std::array<float,2>{0.678066671f, 0.942454636f},
-std::array<float,2>{0.322768599f, 0.733702421f},
-std::array<float,2>{0.978877068f, 0.161327258f},
-std::array<float,2>{0.0213072691f, 0.000274428021f},
-std::array<float,2>{0.538692057f, 0.561355829f},
-std::array<float,2>{0.422050089f, 0.839885771f},
-std::array<float,2>{0.838348567f, 0.499985009f},
-std::array<float,2>{0.328796595f, 0.27979064f},
-std::array<float,2>{0.994682074f, 0.990811169f},
-std::array<float,2>{0.156213537f, 0.712102532f},
-std::array<float,2>{0.671064377f, 0.130633891f},
-std::array<float,2>{0.471607238f, 0.190672085f},
-std::array<float,2>{0.794950545f, 0.655087352f},
-std::array<float,2>{0.0790607259f, 0.927250862f},
-std::array<float,2>{0.609201193f, 0.324247241f},
-std::array<float,2>{0.230826527f, 0.405186892f},
-std::array<float,2>{0.732651234f, 0.771388471f},
-std::array<float,2>{0.308491915f, 0.592374802f},
-std::array<float,2>{0.895460606f, 0.0644273236f},
-std::array<float,2>{0.170994729f, 0.184421539f},
-std::array<float,2>{0.65367049f, 0.736371756f},
-std::array<float,2>{0.34731251f, 0.95845139f},
-std::array<float,2>{0.963070512f, 0.290848076f},
-std::array<float,2>{0.399511755f, 0.446799815f},
-std::array<float,2>{0.859726071f, 0.856592953f},
-std::array<float,2>{0.0581943654f, 0.503846645f},
-std::array<float,2>{0.506701946f, 0.0552029461f},
-std::array<float,2>{0.270415753f, 0.10492833f},
-std::array<float,2>{0.910752118f, 0.605933189f},
-std::array<float,2>{0.192412004f, 0.806627512f},
-std::array<float,2>{0.710959077f, 0.427096754f},
-std::array<float,2>{0.0942587182f, 0.371625543f},
-std::array<float,2>{0.574475646f, 0.889343441f},
-std::array<float,2>{0.46196273f, 0.680947781f},
-std::array<float,2>{0.77326113f, 0.225347146f},
-std::array<float,2>{0.14668043f, 0.0486290678f},
-std::array<float,2>{0.659224331f, 0.510585964f},
-std::array<float,2>{0.339372337f, 0.850764573f},
-std::array<float,2>{0.987442613f, 0.441940039f},
-std::array<float,2>{0.435967952f, 0.284220785f},
-std::array<float,2>{0.831317484f, 0.963352561f},
-std::array<float,2>{0.0276326519f, 0.74835676f},
-std::array<float,2>{0.542934299f, 0.178904548f},
-std::array<float,2>{0.298460633f, 0.227395058f},
-std::array<float,2>{0.902852774f, 0.676011086f},
-std::array<float,2>{0.222715884f, 0.882070899f},
-std::array<float,2>{0.725494981f, 0.361426413f},
-std::array<float,2>{0.086643219f, 0.431460172f},
-std::array<float,2>{0.594175518f, 0.802718818f},
-std::array<float,2>{0.483282179f, 0.595022023f},
-std::array<float,2>{0.783255935f, 0.0985235572f},
-std::array<float,2>{0.0493138693f, 0.137696683f},
-std::array<float,2>{0.511255503f, 0.707191408f},
-std::array<float,2>{0.392507076f, 0.99744004f},
-std::array<float,2>{0.871872246f, 0.269117743f},
-std::array<float,2>{0.356075406f, 0.488066345f},
-std::array<float,2>{0.953495026f, 0.832452118f},
-std::array<float,2>{0.161704361f, 0.550137758f},
-std::array<float,2>{0.645934045f, 0.0138050104f},
-std::array<float,2>{0.455738455f, 0.0767672434f},
-std::array<float,2>{0.777312577f, 0.581202984f},
-std::array<float,2>{0.108797297f, 0.777295887f},
-std::array<float,2>{0.563066542f, 0.397137851f},
-std::array<float,2>{0.196006984f, 0.319257528f},
-std::array<float,2>{0.703653753f, 0.936489344f},
-std::array<float,2>{0.275787443f, 0.643315911f},
-std::array<float,2>{0.917088151f, 0.202990308f},
-std::array<float,2>{0.121913657f, 0.115870491f},
-std::array<float,2>{0.588309526f, 0.621244967f},
-std::array<float,2>{0.452619374f, 0.787462115f},
-std::array<float,2>{0.765213907f, 0.416766286f},
-std::array<float,2>{0.261362821f, 0.354101092f},
-std::array<float,2>{0.932372034f, 0.893418908f},
-std::array<float,2>{0.204857558f, 0.662849128f},
-std::array<float,2>{0.690310717f, 0.245161116f},
-std::array<float,2>{0.385893971f, 0.170513183f},
-std::array<float,2>{0.850423753f, 0.72510612f},
-std::array<float,2>{0.0390484631f, 0.945729852f},
-std::array<float,2>{0.520510852f, 0.298238009f},
-std::array<float,2>{0.175475776f, 0.46470356f},
-std::array<float,2>{0.635812998f, 0.862710536f},
-std::array<float,2>{0.369002759f, 0.518484771f},
-std::array<float,2>{0.939735055f, 0.0356155895f},
-std::array<float,2>{0.246775091f, 0.212844118f},
-std::array<float,2>{0.735170841f, 0.631816089f},
-std::array<float,2>{0.294543982f, 0.916055322f},
-std::array<float,2>{0.887865603f, 0.342114329f},
-std::array<float,2>{0.488777339f, 0.377782345f},
-std::array<float,2>{0.804769039f, 0.754449904f},
-std::array<float,2>{0.0746325552f, 0.570934236f},
-std::array<float,2>{0.610760868f, 0.0883603394f},
-std::array<float,2>{0.320243418f, 0.0306752175f},
-std::array<float,2>{0.972623885f, 0.540365636f},
-std::array<float,2>{0.128571466f, 0.826987147f},
-std::array<float,2>{0.687339067f, 0.477371305f},
-std::array<float,2>{0.00437596068f, 0.254097998f},
-std::array<float,2>{0.547626019f, 0.97177577f},
-std::array<float,2>{0.408284068f, 0.687906682f},
-std::array<float,2>{0.820892096f, 0.144681141f},
-std::array<float,2>{0.138377607f, 0.0703134015f},
-std::array<float,2>{0.672767818f, 0.58209914f},
-std::array<float,2>{0.32676515f, 0.779263496f},
-std::array<float,2>{0.982130349f, 0.394399256f},
-std::array<float,2>{0.420935482f, 0.315280855f},
-std::array<float,2>{0.814257205f, 0.929971755f},
-std::array<float,2>{0.013659304f, 0.647853971f},
-std::array<float,2>{0.559623718f, 0.196024135f},
-std::array<float,2>{0.281443328f, 0.133550242f},
-std::array<float,2>{0.879724264f, 0.705664933f},
-std::array<float,2>{0.240066543f, 0.995703399f},
-std::array<float,2>{0.74512893f, 0.271177799f},
-std::array<float,2>{0.0655103028f, 0.489196092f},
-std::array<float,2>{0.617344081f, 0.830205083f},
-std::array<float,2>{0.494951636f, 0.553157628f},
-std::array<float,2>{0.79914844f, 0.01121464f},
-std::array<float,2>{0.0437944978f, 0.231362328f},
-std::array<float,2>{0.525817037f, 0.673273921f},
-std::array<float,2>{0.382496148f, 0.877827883f},
-std::array<float,2>{0.852172971f, 0.366759926f},
-std::array<float,2>{0.362998158f, 0.436611742f},
-std::array<float,2>{0.946953833f, 0.79769218f},
-std::array<float,2>{0.180430427f, 0.598748028f},
-std::array<float,2>{0.630065858f, 0.0971299782f},
-std::array<float,2>{0.442296207f, 0.0510804579f},
-std::array<float,2>{0.752780855f, 0.514290154f},
-std::array<float,2>{0.112161458f, 0.84765178f},
-std::array<float,2>{0.584240794f, 0.440622479f},
-std::array<float,2>{0.217795551f, 0.287424773f},
-std::array<float,2>{0.69938904f, 0.964976192f},
-std::array<float,2>{0.256109148f, 0.745625496f},
-std::array<float,2>{0.922953784f, 0.174895555f},
-std::array<float,2>{0.0991628468f, 0.0246358272f},
-std::array<float,2>{0.573578537f, 0.543252945f},
-std::array<float,2>{0.466263592f, 0.822997451f},
-std::array<float,2>{0.765745997f, 0.480696738f},
-std::array<float,2>{0.267301977f, 0.25377205f},
-std::array<float,2>{0.908533454f, 0.976107299f},
-std::array<float,2>{0.18927145f, 0.694714725f},
-std::array<float,2>{0.717196882f, 0.144025683f},
-std::array<float,2>{0.403277308f, 0.217835918f},
-std::array<float,2>{0.866261005f, 0.627037466f},
-std::array<float,2>{0.060839843f, 0.920571744f},
-std::array<float,2>{0.500248253f, 0.338476926f},
-std::array<float,2>{0.167758361f, 0.379131019f},
-std::array<float,2>{0.652274847f, 0.75203228f},
-std::array<float,2>{0.348951459f, 0.574876904f},
-std::array<float,2>{0.966273665f, 0.091219455f},
-std::array<float,2>{0.230144039f, 0.165435627f},
-std::array<float,2>{0.730384648f, 0.719511569f},
-std::array<float,2>{0.311041266f, 0.949723423f},
-std::array<float,2>{0.891189277f, 0.300820082f},
-std::array<float,2>{0.475746542f, 0.46672073f},
-std::array<float,2>{0.790798068f, 0.864702761f},
-std::array<float,2>{0.0848112479f, 0.522830069f},
-std::array<float,2>{0.605202615f, 0.0313543156f},
-std::array<float,2>{0.335041195f, 0.110064261f},
-std::array<float,2>{0.998240829f, 0.617505014f},
-std::array<float,2>{0.150573432f, 0.783928216f},
-std::array<float,2>{0.666442215f, 0.419825882f},
-std::array<float,2>{0.0193891525f, 0.358180135f},
-std::array<float,2>{0.531512856f, 0.896779656f},
-std::array<float,2>{0.425897688f, 0.660081744f},
-std::array<float,2>{0.84305799f, 0.246426553f},
-std::array<float,2>{0.202348337f, 0.042313002f},
-std::array<float,2>{0.707213461f, 0.530522525f},
-std::array<float,2>{0.278145641f, 0.869232953f},
-std::array<float,2>{0.919257104f, 0.45383963f},
-std::array<float,2>{0.459462434f, 0.308428615f},
-std::array<float,2>{0.779515862f, 0.938117623f},
-std::array<float,2>{0.104978882f, 0.728643596f},
-std::array<float,2>{0.568816423f, 0.158060715f},
-std::array<float,2>{0.351640224f, 0.238561362f},
-std::array<float,2>{0.959322274f, 0.671706438f},
-std::array<float,2>{0.157731578f, 0.903954804f},
-std::array<float,2>{0.640659451f, 0.346451074f},
-std::array<float,2>{0.052224718f, 0.412810266f},
-std::array<float,2>{0.515461683f, 0.791696191f},
-std::array<float,2>{0.397504687f, 0.609947503f},
-std::array<float,2>{0.870009899f, 0.121667236f},
-std::array<float,2>{0.0928174555f, 0.152185068f},
-std::array<float,2>{0.600051045f, 0.699690342f},
-std::array<float,2>{0.477187455f, 0.980742157f},
-std::array<float,2>{0.788734198f, 0.258292943f},
-std::array<float,2>{0.302900583f, 0.469224244f},
-std::array<float,2>{0.898560286f, 0.818325162f},
-std::array<float,2>{0.219375893f, 0.536197305f},
-std::array<float,2>{0.722165465f, 0.0173727572f},
-std::array<float,2>{0.432330638f, 0.0786076114f},
-std::array<float,2>{0.833757281f, 0.567826927f},
-std::array<float,2>{0.0248605106f, 0.764869809f},
-std::array<float,2>{0.544038415f, 0.386620253f},
-std::array<float,2>{0.144372612f, 0.329844803f},
-std::array<float,2>{0.663315535f, 0.910642445f},
-std::array<float,2>{0.342579037f, 0.632953823f},
-std::array<float,2>{0.990315139f, 0.205720931f},
-std::array<float,2>{0.00017005195f, 0.107527457f},
-std::array<float,2>{0.553321123f, 0.603434026f},
-std::array<float,2>{0.413462251f, 0.809083939f},
-std::array<float,2>{0.82507515f, 0.422269583f},
-std::array<float,2>{0.312907994f, 0.368072808f},
-std::array<float,2>{0.975243628f, 0.886703014f},
-std::array<float,2>{0.130898178f, 0.68523699f},
-std::array<float,2>{0.682557881f, 0.221144274f},
-std::array<float,2>{0.485603452f, 0.182229191f},
-std::array<float,2>{0.811620235f, 0.742072642f},
-std::array<float,2>{0.072529912f, 0.955418289f},
-std::array<float,2>{0.616397738f, 0.295626163f},
-std::array<float,2>{0.244918793f, 0.450740069f},
-std::array<float,2>{0.740779519f, 0.854385376f},
-std::array<float,2>{0.29068473f, 0.507756472f},
-std::array<float,2>{0.885611176f, 0.0618744567f},
-std::array<float,2>{0.177379265f, 0.195218727f},
-std::array<float,2>{0.637401521f, 0.649311841f},
-std::array<float,2>{0.374954224f, 0.925050795f},
-std::array<float,2>{0.942215562f, 0.322683901f},
-std::array<float,2>{0.388485521f, 0.400977165f},
-std::array<float,2>{0.846754849f, 0.769147873f},
-std::array<float,2>{0.0340937451f, 0.586145759f},
-std::array<float,2>{0.517605662f, 0.0701370537f},
-std::array<float,2>{0.265619248f, 0.00713025173f},
-std::array<float,2>{0.936908603f, 0.558512807f},
-std::array<float,2>{0.207386136f, 0.837296247f},
-std::array<float,2>{0.693535328f, 0.495906025f},
-std::array<float,2>{0.120431706f, 0.275470138f},
-std::array<float,2>{0.593325436f, 0.986539721f},
-std::array<float,2>{0.448576391f, 0.716944098f},
-std::array<float,2>{0.758598506f, 0.126888901f},
-std::array<float,2>{0.236126781f, 0.12004824f},
-std::array<float,2>{0.74894768f, 0.613632858f},
-std::array<float,2>{0.288005471f, 0.793345153f},
-std::array<float,2>{0.877959192f, 0.407020509f},
-std::array<float,2>{0.496999651f, 0.348472565f},
-std::array<float,2>{0.801050723f, 0.899836838f},
-std::array<float,2>{0.0679904968f, 0.666311979f},
-std::array<float,2>{0.624324441f, 0.237206772f},
-std::array<float,2>{0.32205835f, 0.162748188f},
-std::array<float,2>{0.977907658f, 0.731103718f},
-std::array<float,2>{0.136177644f, 0.943673968f},
-std::array<float,2>{0.676595569f, 0.311048329f},
-std::array<float,2>{0.0117080435f, 0.457952708f},
-std::array<float,2>{0.558532417f, 0.874293983f},
-std::array<float,2>{0.414843768f, 0.526902974f},
-std::array<float,2>{0.818010628f, 0.0466569513f},
-std::array<float,2>{0.116689481f, 0.207466483f},
-std::array<float,2>{0.581014335f, 0.639184237f},
-std::array<float,2>{0.440322727f, 0.907357574f},
-std::array<float,2>{0.754283428f, 0.333538383f},
-std::array<float,2>{0.250289738f, 0.390391439f},
-std::array<float,2>{0.929436505f, 0.759236455f},
-std::array<float,2>{0.213170305f, 0.564844072f},
-std::array<float,2>{0.696631372f, 0.0853840858f},
-std::array<float,2>{0.377094358f, 0.0213598125f},
-std::array<float,2>{0.85595268f, 0.532315314f},
-std::array<float,2>{0.0424613729f, 0.81270051f},
-std::array<float,2>{0.529399097f, 0.474819869f},
-std::array<float,2>{0.183948234f, 0.262978286f},
-std::array<float,2>{0.626363397f, 0.977205157f},
-std::array<float,2>{0.36677742f, 0.699151695f},
-std::array<float,2>{0.951415598f, 0.155467555f},
-std::array<float,2>{0.0557299107f, 0.0566497296f},
-std::array<float,2>{0.504539311f, 0.501019299f},
-std::array<float,2>{0.401264846f, 0.857570708f},
-std::array<float,2>{0.862434804f, 0.449071139f},
-std::array<float,2>{0.34555003f, 0.292194217f},
-std::array<float,2>{0.962253988f, 0.95924902f},
-std::array<float,2>{0.168350384f, 0.734794497f},
-std::array<float,2>{0.654654324f, 0.187140644f},
-std::array<float,2>{0.463333845f, 0.223907232f},
-std::array<float,2>{0.770373642f, 0.683572292f},
-std::array<float,2>{0.0966916606f, 0.887925744f},
-std::array<float,2>{0.577839315f, 0.374404192f},
-std::array<float,2>{0.193795994f, 0.429620981f},
-std::array<float,2>{0.713663042f, 0.808490992f},
-std::array<float,2>{0.272611976f, 0.608484626f},
-std::array<float,2>{0.913221657f, 0.10240525f},
-std::array<float,2>{0.152902395f, 0.131466225f},
-std::array<float,2>{0.668872833f, 0.713588238f},
-std::array<float,2>{0.330080628f, 0.988827944f},
-std::array<float,2>{0.992487609f, 0.278600127f},
-std::array<float,2>{0.423962146f, 0.497623205f},
-std::array<float,2>{0.837864578f, 0.843631685f},
-std::array<float,2>{0.0233493764f, 0.559393227f},
-std::array<float,2>{0.536120236f, 0.00258316332f},
-std::array<float,2>{0.305240184f, 0.0645759478f},
-std::array<float,2>{0.896497548f, 0.589872479f},
-std::array<float,2>{0.232771173f, 0.772384226f},
-std::array<float,2>{0.732268155f, 0.404068708f},
-std::array<float,2>{0.0812180042f, 0.326740891f},
-std::array<float,2>{0.606303155f, 0.928058147f},
-std::array<float,2>{0.470533818f, 0.652538598f},
-std::array<float,2>{0.79388845f, 0.188660696f},
-std::array<float,2>{0.162188888f, 0.0121791232f},
-std::array<float,2>{0.646583319f, 0.548637509f},
-std::array<float,2>{0.35797599f, 0.83527422f},
-std::array<float,2>{0.95697546f, 0.485453099f},
-std::array<float,2>{0.393572479f, 0.266149312f},
-std::array<float,2>{0.874847233f, 0.999641299f},
-std::array<float,2>{0.048589088f, 0.709016562f},
-std::array<float,2>{0.509720564f, 0.139362127f},
-std::array<float,2>{0.273814291f, 0.20043315f},
-std::array<float,2>{0.914469838f, 0.642061651f},
-std::array<float,2>{0.198376566f, 0.934065461f},
-std::array<float,2>{0.706310272f, 0.318100184f},
-std::array<float,2>{0.106317699f, 0.394565582f},
-std::array<float,2>{0.565089166f, 0.77425915f},
-std::array<float,2>{0.453897119f, 0.579569995f},
-std::array<float,2>{0.77350837f, 0.0758076906f},
-std::array<float,2>{0.0303159114f, 0.177041754f},
-std::array<float,2>{0.53908658f, 0.747518659f},
-std::array<float,2>{0.434527874f, 0.960958242f},
-std::array<float,2>{0.828795671f, 0.282084793f},
-std::array<float,2>{0.337542027f, 0.444972575f},
-std::array<float,2>{0.984765351f, 0.84795922f},
-std::array<float,2>{0.145186231f, 0.509243071f},
-std::array<float,2>{0.657927334f, 0.0496450625f},
-std::array<float,2>{0.480919152f, 0.101294138f},
-std::array<float,2>{0.782614172f, 0.597123742f},
-std::array<float,2>{0.0884177759f, 0.802917302f},
-std::array<float,2>{0.597613335f, 0.432476968f},
-std::array<float,2>{0.224658564f, 0.359800518f},
-std::array<float,2>{0.722863793f, 0.879188538f},
-std::array<float,2>{0.299697608f, 0.679011285f},
-std::array<float,2>{0.905235648f, 0.229654133f},
-std::array<float,2>{0.0769520253f, 0.0859493241f},
-std::array<float,2>{0.612617791f, 0.572495043f},
-std::array<float,2>{0.491158754f, 0.756355107f},
-std::array<float,2>{0.808433473f, 0.37530148f},
-std::array<float,2>{0.2955966f, 0.34119758f},
-std::array<float,2>{0.889962077f, 0.914658606f},
-std::array<float,2>{0.248434544f, 0.630143166f},
-std::array<float,2>{0.73712635f, 0.213393897f},
-std::array<float,2>{0.406701148f, 0.147957891f},
-std::array<float,2>{0.82352531f, 0.689948738f},
-std::array<float,2>{0.00603221124f, 0.969007432f},
-std::array<float,2>{0.550715029f, 0.257780224f},
-std::array<float,2>{0.125480592f, 0.478971153f},
-std::array<float,2>{0.684532404f, 0.825349629f},
-std::array<float,2>{0.316767573f, 0.541633427f},
-std::array<float,2>{0.970321536f, 0.0287793409f},
-std::array<float,2>{0.205208778f, 0.242348611f},
-std::array<float,2>{0.689392328f, 0.661582828f},
-std::array<float,2>{0.259362221f, 0.892261684f},
-std::array<float,2>{0.931413591f, 0.353057444f},
-std::array<float,2>{0.44995594f, 0.415354699f},
-std::array<float,2>{0.762412369f, 0.786073744f},
-std::array<float,2>{0.123987734f, 0.624347746f},
-std::array<float,2>{0.586776137f, 0.114446349f},
-std::array<float,2>{0.37034595f, 0.0384013467f},
-std::array<float,2>{0.939111054f, 0.515763283f},
-std::array<float,2>{0.172800675f, 0.860799134f},
-std::array<float,2>{0.63366574f, 0.460955679f},
-std::array<float,2>{0.0357391238f, 0.300386161f},
-std::array<float,2>{0.522195697f, 0.948910892f},
-std::array<float,2>{0.383429796f, 0.722690523f},
-std::array<float,2>{0.848762035f, 0.169705823f},
-std::array<float,2>{0.17908594f, 0.0695953295f},
-std::array<float,2>{0.639082015f, 0.586892426f},
-std::array<float,2>{0.372074157f, 0.768678069f},
-std::array<float,2>{0.943516314f, 0.400473654f},
-std::array<float,2>{0.390402585f, 0.323182046f},
-std::array<float,2>{0.843759358f, 0.925673068f},
-std::array<float,2>{0.0324305482f, 0.648779154f},
-std::array<float,2>{0.5161075f, 0.1948203f},
-std::array<float,2>{0.263055027f, 0.126034006f},
-std::array<float,2>{0.935203671f, 0.717316985f},
-std::array<float,2>{0.210627973f, 0.98723197f},
-std::array<float,2>{0.6932652f, 0.276232511f},
-std::array<float,2>{0.118456058f, 0.495183378f},
-std::array<float,2>{0.590786099f, 0.837570488f},
-std::array<float,2>{0.446499318f, 0.557848811f},
-std::array<float,2>{0.760114253f, 0.00775075937f},
-std::array<float,2>{0.00223027635f, 0.221268743f},
-std::array<float,2>{0.552085519f, 0.684817493f},
-std::array<float,2>{0.410207719f, 0.885770559f},
-std::array<float,2>{0.826659799f, 0.367586017f},
-std::array<float,2>{0.314565569f, 0.422623813f},
-std::array<float,2>{0.973929822f, 0.808726132f},
-std::array<float,2>{0.129626915f, 0.60269475f},
-std::array<float,2>{0.680980325f, 0.108163282f},
-std::array<float,2>{0.487776339f, 0.0624428876f},
-std::array<float,2>{0.810362339f, 0.507277191f},
-std::array<float,2>{0.0711963177f, 0.853555501f},
-std::array<float,2>{0.614955485f, 0.450571626f},
-std::array<float,2>{0.24220261f, 0.295249641f},
-std::array<float,2>{0.739611745f, 0.955569565f},
-std::array<float,2>{0.292600244f, 0.741512418f},
-std::array<float,2>{0.883528888f, 0.1817514f},
-std::array<float,2>{0.0916831493f, 0.0169206783f},
-std::array<float,2>{0.598887444f, 0.537096977f},
-std::array<float,2>{0.479051113f, 0.817828834f},
-std::array<float,2>{0.785423398f, 0.469573975f},
-std::array<float,2>{0.30170086f, 0.2585949f},
-std::array<float,2>{0.900429487f, 0.981030822f},
-std::array<float,2>{0.221372411f, 0.700181246f},
-std::array<float,2>{0.719254494f, 0.151695028f},
-std::array<float,2>{0.430829227f, 0.205117136f},
-std::array<float,2>{0.835169256f, 0.633765519f},
-std::array<float,2>{0.0267107338f, 0.910729706f},
-std::array<float,2>{0.545579731f, 0.32920745f},
-std::array<float,2>{0.140767753f, 0.386026055f},
-std::array<float,2>{0.660815895f, 0.765208244f},
-std::array<float,2>{0.341441423f, 0.568053126f},
-std::array<float,2>{0.989901423f, 0.0788139254f},
-std::array<float,2>{0.199460894f, 0.157546267f},
-std::array<float,2>{0.709505618f, 0.729106843f},
-std::array<float,2>{0.281016409f, 0.937880754f},
-std::array<float,2>{0.920590639f, 0.307747751f},
-std::array<float,2>{0.458364457f, 0.45343557f},
-std::array<float,2>{0.778381765f, 0.869837999f},
-std::array<float,2>{0.103018723f, 0.531212449f},
-std::array<float,2>{0.567018688f, 0.0425152369f},
-std::array<float,2>{0.354614437f, 0.121519946f},
-std::array<float,2>{0.958009899f, 0.609382987f},
-std::array<float,2>{0.159300208f, 0.791258812f},
-std::array<float,2>{0.643139958f, 0.412542284f},
-std::array<float,2>{0.0529432669f, 0.345929265f},
-std::array<float,2>{0.51293993f, 0.903619111f},
-std::array<float,2>{0.394944251f, 0.670972109f},
-std::array<float,2>{0.868657053f, 0.238922104f},
-std::array<float,2>{0.227745101f, 0.0322152711f},
-std::array<float,2>{0.727262259f, 0.523128569f},
-std::array<float,2>{0.310402274f, 0.865032852f},
-std::array<float,2>{0.89425832f, 0.46596396f},
-std::array<float,2>{0.472679913f, 0.301721692f},
-std::array<float,2>{0.79173857f, 0.949383676f},
-std::array<float,2>{0.0832846612f, 0.718940198f},
-std::array<float,2>{0.602584541f, 0.165762499f},
-std::array<float,2>{0.333182186f, 0.246972844f},
-std::array<float,2>{0.99612385f, 0.659339368f},
-std::array<float,2>{0.150258169f, 0.897396922f},
-std::array<float,2>{0.664826274f, 0.357467622f},
-std::array<float,2>{0.0170357227f, 0.419040859f},
-std::array<float,2>{0.533994913f, 0.783249438f},
-std::array<float,2>{0.429558814f, 0.617786527f},
-std::array<float,2>{0.839911103f, 0.109807767f},
-std::array<float,2>{0.100143127f, 0.144508511f},
-std::array<float,2>{0.570518732f, 0.695075572f},
-std::array<float,2>{0.467743933f, 0.975881994f},
-std::array<float,2>{0.769170403f, 0.253054202f},
-std::array<float,2>{0.268285334f, 0.481040835f},
-std::array<float,2>{0.907557368f, 0.822425902f},
-std::array<float,2>{0.191251457f, 0.543530464f},
-std::array<float,2>{0.715073228f, 0.0250011627f},
-std::array<float,2>{0.404960632f, 0.0915258229f},
-std::array<float,2>{0.864766657f, 0.574480295f},
-std::array<float,2>{0.0589642525f, 0.752653122f},
-std::array<float,2>{0.502672791f, 0.379408419f},
-std::array<float,2>{0.164610982f, 0.337971121f},
-std::array<float,2>{0.649214327f, 0.920370638f},
-std::array<float,2>{0.349655688f, 0.627595484f},
-std::array<float,2>{0.967914522f, 0.218534723f},
-std::array<float,2>{0.0468623824f, 0.0974352434f},
-std::array<float,2>{0.524819076f, 0.599431098f},
-std::array<float,2>{0.379123837f, 0.797063887f},
-std::array<float,2>{0.854930639f, 0.437011808f},
-std::array<float,2>{0.360025883f, 0.366425455f},
-std::array<float,2>{0.947666407f, 0.877425969f},
-std::array<float,2>{0.183323741f, 0.673374772f},
-std::array<float,2>{0.631077766f, 0.230600283f},
-std::array<float,2>{0.443613887f, 0.175371945f},
-std::array<float,2>{0.751937449f, 0.745376647f},
-std::array<float,2>{0.109698147f, 0.965512216f},
-std::array<float,2>{0.582464099f, 0.288048983f},
-std::array<float,2>{0.215884596f, 0.441069692f},
-std::array<float,2>{0.702436149f, 0.846969664f},
-std::array<float,2>{0.255016059f, 0.513799369f},
-std::array<float,2>{0.924878359f, 0.0512997694f},
-std::array<float,2>{0.139138997f, 0.195454299f},
-std::array<float,2>{0.675119579f, 0.648170888f},
-std::array<float,2>{0.325107247f, 0.930438101f},
-std::array<float,2>{0.983223557f, 0.314485431f},
-std::array<float,2>{0.418662369f, 0.393904179f},
-std::array<float,2>{0.81510365f, 0.7784096f},
-std::array<float,2>{0.0151660172f, 0.582547665f},
-std::array<float,2>{0.560732067f, 0.0710313097f},
-std::array<float,2>{0.28391692f, 0.0112563754f},
-std::array<float,2>{0.880894959f, 0.553435564f},
-std::array<float,2>{0.240594745f, 0.830876946f},
-std::array<float,2>{0.742561102f, 0.488297731f},
-std::array<float,2>{0.0638207495f, 0.270908833f},
-std::array<float,2>{0.619210064f, 0.99544549f},
-std::array<float,2>{0.49308905f, 0.705317259f},
-std::array<float,2>{0.798226714f, 0.133154288f},
-std::array<float,2>{0.204118088f, 0.114848375f},
-std::array<float,2>{0.689504623f, 0.624757469f},
-std::array<float,2>{0.260932118f, 0.785292566f},
-std::array<float,2>{0.931703627f, 0.415528595f},
-std::array<float,2>{0.453029245f, 0.352836341f},
-std::array<float,2>{0.76466769f, 0.892084539f},
-std::array<float,2>{0.121151038f, 0.661896706f},
-std::array<float,2>{0.588856101f, 0.243067011f},
-std::array<float,2>{0.368275583f, 0.169040605f},
-std::array<float,2>{0.939989209f, 0.723511577f},
-std::array<float,2>{0.175015852f, 0.948448837f},
-std::array<float,2>{0.636369526f, 0.300082237f},
-std::array<float,2>{0.0385472104f, 0.461649984f},
-std::array<float,2>{0.521238565f, 0.86108923f},
-std::array<float,2>{0.386387348f, 0.516176701f},
-std::array<float,2>{0.85003072f, 0.0388844721f},
-std::array<float,2>{0.0749316439f, 0.213025957f},
-std::array<float,2>{0.610982895f, 0.630620003f},
-std::array<float,2>{0.488604397f, 0.914102137f},
-std::array<float,2>{0.805590391f, 0.341575384f},
-std::array<float,2>{0.294380337f, 0.375507295f},
-std::array<float,2>{0.88838619f, 0.756325543f},
-std::array<float,2>{0.246525809f, 0.573021054f},
-std::array<float,2>{0.734802485f, 0.0865969807f},
-std::array<float,2>{0.409165204f, 0.0288635343f},
-std::array<float,2>{0.820623279f, 0.541463852f},
-std::array<float,2>{0.00473237503f, 0.826135576f},
-std::array<float,2>{0.547261f, 0.479142815f},
-std::array<float,2>{0.128362447f, 0.257001847f},
-std::array<float,2>{0.686629534f, 0.969525039f},
-std::array<float,2>{0.319815367f, 0.689682245f},
-std::array<float,2>{0.971956313f, 0.147823393f},
-std::array<float,2>{0.0279010404f, 0.0492288247f},
-std::array<float,2>{0.542465746f, 0.509393692f},
-std::array<float,2>{0.436445832f, 0.848378062f},
-std::array<float,2>{0.831759453f, 0.444775879f},
-std::array<float,2>{0.339266002f, 0.281344861f},
-std::array<float,2>{0.98788017f, 0.961529911f},
-std::array<float,2>{0.14736025f, 0.747758865f},
-std::array<float,2>{0.660071731f, 0.177322432f},
-std::array<float,2>{0.482533276f, 0.230069429f},
-std::array<float,2>{0.784011841f, 0.67957437f},
-std::array<float,2>{0.0860667527f, 0.879578054f},
-std::array<float,2>{0.594640017f, 0.360341698f},
-std::array<float,2>{0.223463774f, 0.431726068f},
-std::array<float,2>{0.724731743f, 0.803279042f},
-std::array<float,2>{0.297914237f, 0.597398996f},
-std::array<float,2>{0.902377665f, 0.10070885f},
-std::array<float,2>{0.161492631f, 0.139002904f},
-std::array<float,2>{0.646052003f, 0.709928453f},
-std::array<float,2>{0.355505824f, 0.999420464f},
-std::array<float,2>{0.953805566f, 0.266041279f},
-std::array<float,2>{0.3917059f, 0.486014694f},
-std::array<float,2>{0.871281147f, 0.835672975f},
-std::array<float,2>{0.0493615679f, 0.547961891f},
-std::array<float,2>{0.511022866f, 0.0124369897f},
-std::array<float,2>{0.276048571f, 0.0753815323f},
-std::array<float,2>{0.917746305f, 0.579654515f},
-std::array<float,2>{0.195390984f, 0.77375114f},
-std::array<float,2>{0.703510582f, 0.395287573f},
-std::array<float,2>{0.108904734f, 0.317658782f},
-std::array<float,2>{0.562941611f, 0.934180915f},
-std::array<float,2>{0.455270618f, 0.642340541f},
-std::array<float,2>{0.776624799f, 0.200969577f},
-std::array<float,2>{0.155734062f, 0.00239160936f},
-std::array<float,2>{0.671757579f, 0.558936834f},
-std::array<float,2>{0.32837528f, 0.843102157f},
-std::array<float,2>{0.994586825f, 0.497525901f},
-std::array<float,2>{0.422810942f, 0.279247642f},
-std::array<float,2>{0.838841796f, 0.988516688f},
-std::array<float,2>{0.0208182875f, 0.713226438f},
-std::array<float,2>{0.538128376f, 0.131074399f},
-std::array<float,2>{0.307941705f, 0.189174861f},
-std::array<float,2>{0.894754648f, 0.653252184f},
-std::array<float,2>{0.231228992f, 0.928561866f},
-std::array<float,2>{0.733247995f, 0.326333344f},
-std::array<float,2>{0.0783385187f, 0.403588861f},
-std::array<float,2>{0.60879463f, 0.77185905f},
-std::array<float,2>{0.470832676f, 0.590793192f},
-std::array<float,2>{0.795614302f, 0.0649425536f},
-std::array<float,2>{0.0580289736f, 0.186812222f},
-std::array<float,2>{0.506168067f, 0.735217392f},
-std::array<float,2>{0.40003565f, 0.95953095f},
-std::array<float,2>{0.860207319f, 0.292851746f},
-std::array<float,2>{0.347097129f, 0.448721588f},
-std::array<float,2>{0.963508487f, 0.858242095f},
-std::array<float,2>{0.171641067f, 0.501550019f},
-std::array<float,2>{0.653820693f, 0.0575005002f},
-std::array<float,2>{0.462654054f, 0.101799674f},
-std::array<float,2>{0.772506237f, 0.608905792f},
-std::array<float,2>{0.0940679833f, 0.807665527f},
-std::array<float,2>{0.575023115f, 0.428953737f},
-std::array<float,2>{0.193257287f, 0.374963999f},
-std::array<float,2>{0.71159637f, 0.888662338f},
-std::array<float,2>{0.269579649f, 0.682740808f},
-std::array<float,2>{0.910542607f, 0.224466339f},
-std::array<float,2>{0.113548636f, 0.0857622176f},
-std::array<float,2>{0.579080284f, 0.564958572f},
-std::array<float,2>{0.438924313f, 0.75941354f},
-std::array<float,2>{0.756687403f, 0.389958292f},
-std::array<float,2>{0.253322363f, 0.333384931f},
-std::array<float,2>{0.927637815f, 0.907878399f},
-std::array<float,2>{0.211115807f, 0.639003277f},
-std::array<float,2>{0.698821425f, 0.207564682f},
-std::array<float,2>{0.375689179f, 0.155871332f},
-std::array<float,2>{0.858803809f, 0.698571146f},
-std::array<float,2>{0.0401722975f, 0.976877332f},
-std::array<float,2>{0.529039919f, 0.263474464f},
-std::array<float,2>{0.186630026f, 0.475269318f},
-std::array<float,2>{0.628868699f, 0.813134253f},
-std::array<float,2>{0.363562137f, 0.533152819f},
-std::array<float,2>{0.950172424f, 0.0208008755f},
-std::array<float,2>{0.236675665f, 0.236524448f},
-std::array<float,2>{0.746605337f, 0.666562021f},
-std::array<float,2>{0.286727667f, 0.900293052f},
-std::array<float,2>{0.876560628f, 0.347953767f},
-std::array<float,2>{0.498135239f, 0.406597197f},
-std::array<float,2>{0.803389549f, 0.793682516f},
-std::array<float,2>{0.070094794f, 0.61404115f},
-std::array<float,2>{0.62177062f, 0.119554184f},
-std::array<float,2>{0.322470993f, 0.0463607609f},
-std::array<float,2>{0.979015946f, 0.526591182f},
-std::array<float,2>{0.134131238f, 0.874676645f},
-std::array<float,2>{0.678281307f, 0.457112312f},
-std::array<float,2>{0.00951525103f, 0.310860008f},
-std::array<float,2>{0.556548953f, 0.944154084f},
-std::array<float,2>{0.417277396f, 0.73064661f},
-std::array<float,2>{0.819613993f, 0.162478819f},
-std::array<float,2>{0.131735027f, 0.106329426f},
-std::array<float,2>{0.681857049f, 0.604186594f},
-std::array<float,2>{0.313219339f, 0.811289728f},
-std::array<float,2>{0.975076079f, 0.425365686f},
-std::array<float,2>{0.413803399f, 0.369173884f},
-std::array<float,2>{0.824487865f, 0.883605957f},
-std::array<float,2>{0.000897852471f, 0.686163008f},
-std::array<float,2>{0.552834749f, 0.219830409f},
-std::array<float,2>{0.290260017f, 0.180167779f},
-std::array<float,2>{0.884810805f, 0.739473283f},
-std::array<float,2>{0.244532257f, 0.954255283f},
-std::array<float,2>{0.740278363f, 0.294768751f},
-std::array<float,2>{0.0728123859f, 0.452274233f},
-std::array<float,2>{0.617059588f, 0.852484763f},
-std::array<float,2>{0.485857934f, 0.504748464f},
-std::array<float,2>{0.812292933f, 0.0586701967f},
-std::array<float,2>{0.0335979313f, 0.193305254f},
-std::array<float,2>{0.518134713f, 0.65084672f},
-std::array<float,2>{0.387968689f, 0.922024965f},
-std::array<float,2>{0.847279131f, 0.320916027f},
-std::array<float,2>{0.374104291f, 0.39947927f},
-std::array<float,2>{0.941472828f, 0.767012f},
-std::array<float,2>{0.176802427f, 0.588043928f},
-std::array<float,2>{0.636797071f, 0.0664918944f},
-std::array<float,2>{0.449160784f, 0.00426806323f},
-std::array<float,2>{0.758119702f, 0.554940283f},
-std::array<float,2>{0.120870113f, 0.838615656f},
-std::array<float,2>{0.59305805f, 0.49358505f},
-std::array<float,2>{0.20782876f, 0.27418679f},
-std::array<float,2>{0.694256544f, 0.985773921f},
-std::array<float,2>{0.264696687f, 0.715670884f},
-std::array<float,2>{0.937313199f, 0.127541795f},
-std::array<float,2>{0.105137877f, 0.0403017588f},
-std::array<float,2>{0.568976343f, 0.528350949f},
-std::array<float,2>{0.459912419f, 0.868139386f},
-std::array<float,2>{0.780046999f, 0.456123501f},
-std::array<float,2>{0.27765438f, 0.305018574f},
-std::array<float,2>{0.91989243f, 0.941381454f},
-std::array<float,2>{0.202901065f, 0.726805866f},
-std::array<float,2>{0.707608163f, 0.159204647f},
-std::array<float,2>{0.398258954f, 0.240349352f},
-std::array<float,2>{0.869190753f, 0.669799209f},
-std::array<float,2>{0.0526920334f, 0.905815125f},
-std::array<float,2>{0.51505059f, 0.343949169f},
-std::array<float,2>{0.157389015f, 0.410914391f},
-std::array<float,2>{0.641515195f, 0.789716542f},
-std::array<float,2>{0.352173358f, 0.612690508f},
-std::array<float,2>{0.959938765f, 0.124365047f},
-std::array<float,2>{0.218882844f, 0.149513125f},
-std::array<float,2>{0.722510397f, 0.701371551f},
-std::array<float,2>{0.303266317f, 0.98414731f},
-std::array<float,2>{0.899402499f, 0.26120466f},
-std::array<float,2>{0.476778507f, 0.471710235f},
-std::array<float,2>{0.788414061f, 0.820279002f},
-std::array<float,2>{0.093482323f, 0.537489295f},
-std::array<float,2>{0.600245476f, 0.018600516f},
-std::array<float,2>{0.341901988f, 0.0804105103f},
-std::array<float,2>{0.990931749f, 0.569713891f},
-std::array<float,2>{0.14397034f, 0.762216568f},
-std::array<float,2>{0.663693488f, 0.383084625f},
-std::array<float,2>{0.0250778459f, 0.3304497f},
-std::array<float,2>{0.544835269f, 0.912148237f},
-std::array<float,2>{0.431943536f, 0.636645138f},
-std::array<float,2>{0.833083034f, 0.205078125f},
-std::array<float,2>{0.188654393f, 0.0266901664f},
-std::array<float,2>{0.717517257f, 0.545351148f},
-std::array<float,2>{0.266896635f, 0.82040441f},
-std::array<float,2>{0.90910697f, 0.482823998f},
-std::array<float,2>{0.466536671f, 0.251716167f},
-std::array<float,2>{0.766536057f, 0.974115014f},
-std::array<float,2>{0.0987190455f, 0.693255186f},
-std::array<float,2>{0.573873878f, 0.142257318f},
-std::array<float,2>{0.34948054f, 0.216615111f},
-std::array<float,2>{0.966535091f, 0.626923501f},
-std::array<float,2>{0.167080089f, 0.919588089f},
-std::array<float,2>{0.65172416f, 0.335947841f},
-std::array<float,2>{0.061358843f, 0.38256532f},
-std::array<float,2>{0.50051719f, 0.750804842f},
-std::array<float,2>{0.402737617f, 0.577396214f},
-std::array<float,2>{0.867139637f, 0.0926295817f},
-std::array<float,2>{0.0841912329f, 0.167187452f},
-std::array<float,2>{0.604733169f, 0.72070843f},
-std::array<float,2>{0.476131797f, 0.952801526f},
-std::array<float,2>{0.790249288f, 0.303745896f},
-std::array<float,2>{0.310552478f, 0.467137039f},
-std::array<float,2>{0.890771627f, 0.865450859f},
-std::array<float,2>{0.229862705f, 0.520764589f},
-std::array<float,2>{0.729952097f, 0.0346231833f},
-std::array<float,2>{0.426756322f, 0.112820618f},
-std::array<float,2>{0.843517005f, 0.620451212f},
-std::array<float,2>{0.0187714677f, 0.782060385f},
-std::array<float,2>{0.532002687f, 0.420217276f},
-std::array<float,2>{0.150906503f, 0.356218696f},
-std::array<float,2>{0.666643977f, 0.89461416f},
-std::array<float,2>{0.335726202f, 0.657398522f},
-std::array<float,2>{0.998535395f, 0.249753624f},
-std::array<float,2>{0.0130803864f, 0.0729857534f},
-std::array<float,2>{0.560165226f, 0.585763514f},
-std::array<float,2>{0.42173472f, 0.780334353f},
-std::array<float,2>{0.813637018f, 0.391244471f},
-std::array<float,2>{0.326212198f, 0.31309247f},
-std::array<float,2>{0.981709957f, 0.932495296f},
-std::array<float,2>{0.138011798f, 0.645276546f},
-std::array<float,2>{0.672158539f, 0.199059412f},
-std::array<float,2>{0.494311512f, 0.135519147f},
-std::array<float,2>{0.799681365f, 0.703313291f},
-std::array<float,2>{0.0663341656f, 0.993018687f},
-std::array<float,2>{0.618047297f, 0.272519112f},
-std::array<float,2>{0.239289656f, 0.491339713f},
-std::array<float,2>{0.745872021f, 0.82880795f},
-std::array<float,2>{0.282169014f, 0.551264465f},
-std::array<float,2>{0.878934801f, 0.00921374466f},
-std::array<float,2>{0.179956958f, 0.232501984f},
-std::array<float,2>{0.63052541f, 0.675053239f},
-std::array<float,2>{0.362746865f, 0.876909196f},
-std::array<float,2>{0.946316779f, 0.363622159f},
-std::array<float,2>{0.381928444f, 0.435185403f},
-std::array<float,2>{0.851858735f, 0.799054146f},
-std::array<float,2>{0.0430565365f, 0.601208031f},
-std::array<float,2>{0.526341021f, 0.09468472f},
-std::array<float,2>{0.256532192f, 0.0541480035f},
-std::array<float,2>{0.923445046f, 0.511971593f},
-std::array<float,2>{0.218595982f, 0.844965518f},
-std::array<float,2>{0.699873686f, 0.438852906f},
-std::array<float,2>{0.111509874f, 0.285166532f},
-std::array<float,2>{0.584766448f, 0.967399061f},
-std::array<float,2>{0.441791773f, 0.743509769f},
-std::array<float,2>{0.752236128f, 0.172108069f},
-std::array<float,2>{0.24855122f, 0.0887762234f},
-std::array<float,2>{0.736635983f, 0.57035017f},
-std::array<float,2>{0.295330763f, 0.754086554f},
-std::array<float,2>{0.890155315f, 0.377268702f},
-std::array<float,2>{0.490471661f, 0.342761219f},
-std::array<float,2>{0.807734966f, 0.916748524f},
-std::array<float,2>{0.0764205605f, 0.631289363f},
-std::array<float,2>{0.612816334f, 0.212394938f},
-std::array<float,2>{0.317125738f, 0.145197764f},
-std::array<float,2>{0.970153213f, 0.688082635f},
-std::array<float,2>{0.125962257f, 0.972420871f},
-std::array<float,2>{0.683605671f, 0.254589587f},
-std::array<float,2>{0.00645347824f, 0.476823241f},
-std::array<float,2>{0.549812853f, 0.826293766f},
-std::array<float,2>{0.406992674f, 0.540747821f},
-std::array<float,2>{0.824028194f, 0.0309134722f},
-std::array<float,2>{0.123200417f, 0.245637119f},
-std::array<float,2>{0.586304128f, 0.662282884f},
-std::array<float,2>{0.449699163f, 0.893021226f},
-std::array<float,2>{0.761998415f, 0.353944272f},
-std::array<float,2>{0.258842498f, 0.416281402f},
-std::array<float,2>{0.93096143f, 0.788047135f},
-std::array<float,2>{0.205810636f, 0.621761382f},
-std::array<float,2>{0.688502789f, 0.115677625f},
-std::array<float,2>{0.383249074f, 0.0357798077f},
-std::array<float,2>{0.849513054f, 0.51775676f},
-std::array<float,2>{0.0354385264f, 0.862808466f},
-std::array<float,2>{0.521839619f, 0.463921905f},
-std::array<float,2>{0.172179386f, 0.298574299f},
-std::array<float,2>{0.632953882f, 0.946007788f},
-std::array<float,2>{0.370775789f, 0.724725306f},
-std::array<float,2>{0.938720882f, 0.170152932f},
-std::array<float,2>{0.0479779318f, 0.0142258508f},
-std::array<float,2>{0.508807838f, 0.550543249f},
-std::array<float,2>{0.394353688f, 0.832535028f},
-std::array<float,2>{0.874388576f, 0.487636536f},
-std::array<float,2>{0.357811689f, 0.269003481f},
-std::array<float,2>{0.95615828f, 0.998006761f},
-std::array<float,2>{0.162691489f, 0.708006144f},
-std::array<float,2>{0.647213101f, 0.138212472f},
-std::array<float,2>{0.453604966f, 0.20257014f},
-std::array<float,2>{0.774313509f, 0.643052816f},
-std::array<float,2>{0.105708823f, 0.935647726f},
-std::array<float,2>{0.56450057f, 0.318629295f},
-std::array<float,2>{0.199124083f, 0.396888018f},
-std::array<float,2>{0.706586242f, 0.776378453f},
-std::array<float,2>{0.274347246f, 0.581717014f},
-std::array<float,2>{0.914947689f, 0.0762691498f},
-std::array<float,2>{0.1447189f, 0.179507568f},
-std::array<float,2>{0.657402694f, 0.748568416f},
-std::array<float,2>{0.336916387f, 0.963389337f},
-std::array<float,2>{0.985259295f, 0.284768403f},
-std::array<float,2>{0.433691263f, 0.441459239f},
-std::array<float,2>{0.82818383f, 0.851264358f},
-std::array<float,2>{0.0311352704f, 0.509827316f},
-std::array<float,2>{0.53960079f, 0.048102878f},
-std::array<float,2>{0.298979908f, 0.0977584124f},
-std::array<float,2>{0.904667497f, 0.595644176f},
-std::array<float,2>{0.225291803f, 0.802200198f},
-std::array<float,2>{0.72334969f, 0.430698723f},
-std::array<float,2>{0.0880689323f, 0.361846656f},
-std::array<float,2>{0.596803427f, 0.882784545f},
-std::array<float,2>{0.481008977f, 0.676560998f},
-std::array<float,2>{0.783179998f, 0.226810575f},
-std::array<float,2>{0.168672338f, 0.0548446625f},
-std::array<float,2>{0.655126154f, 0.502943933f},
-std::array<float,2>{0.344903052f, 0.857401371f},
-std::array<float,2>{0.96287626f, 0.446422189f},
-std::array<float,2>{0.400771409f, 0.290311992f},
-std::array<float,2>{0.863136411f, 0.958530962f},
-std::array<float,2>{0.0563625917f, 0.736988544f},
-std::array<float,2>{0.504265428f, 0.183973223f},
-std::array<float,2>{0.273131341f, 0.224636897f},
-std::array<float,2>{0.913948119f, 0.681336343f},
-std::array<float,2>{0.193916455f, 0.889103234f},
-std::array<float,2>{0.713319302f, 0.371201068f},
-std::array<float,2>{0.0972560793f, 0.427544206f},
-std::array<float,2>{0.577438235f, 0.805722713f},
-std::array<float,2>{0.463441491f, 0.606326342f},
-std::array<float,2>{0.769609511f, 0.105202295f},
-std::array<float,2>{0.0226136688f, 0.130225211f},
-std::array<float,2>{0.53525424f, 0.712587118f},
-std::array<float,2>{0.424431264f, 0.990447402f},
-std::array<float,2>{0.83718878f, 0.279488742f},
-std::array<float,2>{0.330952138f, 0.499388516f},
-std::array<float,2>{0.993130326f, 0.840404212f},
-std::array<float,2>{0.152504817f, 0.560988605f},
-std::array<float,2>{0.668247044f, 0.000934866141f},
-std::array<float,2>{0.469753265f, 0.0634973422f},
-std::array<float,2>{0.793260694f, 0.592028558f},
-std::array<float,2>{0.0818009824f, 0.770653248f},
-std::array<float,2>{0.605905592f, 0.404361159f},
-std::array<float,2>{0.232915506f, 0.3249529f},
-std::array<float,2>{0.731634676f, 0.926793277f},
-std::array<float,2>{0.305140436f, 0.654441118f},
-std::array<float,2>{0.897175789f, 0.190933421f},
-std::array<float,2>{0.0675314665f, 0.118595652f},
-std::array<float,2>{0.624976695f, 0.615555882f},
-std::array<float,2>{0.496482432f, 0.794980645f},
-std::array<float,2>{0.801538646f, 0.408243716f},
-std::array<float,2>{0.28726849f, 0.351272464f},
-std::array<float,2>{0.878848076f, 0.901627481f},
-std::array<float,2>{0.2356769f, 0.665543199f},
-std::array<float,2>{0.748378456f, 0.235321909f},
-std::array<float,2>{0.414145857f, 0.16208978f},
-std::array<float,2>{0.817630351f, 0.734174907f},
-std::array<float,2>{0.0108446395f, 0.94326514f},
-std::array<float,2>{0.557819605f, 0.309314132f},
-std::array<float,2>{0.136676833f, 0.460509211f},
-std::array<float,2>{0.675821424f, 0.871656239f},
-std::array<float,2>{0.321716517f, 0.5252406f},
-std::array<float,2>{0.978166461f, 0.0443458036f},
-std::array<float,2>{0.213673696f, 0.209112078f},
-std::array<float,2>{0.697065532f, 0.636844277f},
-std::array<float,2>{0.25053972f, 0.90946579f},
-std::array<float,2>{0.928934395f, 0.334863156f},
-std::array<float,2>{0.43975091f, 0.388465315f},
-std::array<float,2>{0.754418969f, 0.761656642f},
-std::array<float,2>{0.117138475f, 0.562625408f},
-std::array<float,2>{0.580269277f, 0.0830911621f},
-std::array<float,2>{0.36665988f, 0.0222943965f},
-std::array<float,2>{0.952107489f, 0.533943355f},
-std::array<float,2>{0.184182346f, 0.814921319f},
-std::array<float,2>{0.62667942f, 0.474172324f},
-std::array<float,2>{0.0425211899f, 0.265333205f},
-std::array<float,2>{0.530117869f, 0.978597999f},
-std::array<float,2>{0.377673417f, 0.696704805f},
-std::array<float,2>{0.856416225f, 0.152530357f},
-std::array<float,2>{0.158839211f, 0.123483859f},
-std::array<float,2>{0.643812895f, 0.611711562f},
-std::array<float,2>{0.35444212f, 0.790956557f},
-std::array<float,2>{0.957294464f, 0.411654562f},
-std::array<float,2>{0.395557284f, 0.345250636f},
-std::array<float,2>{0.867260873f, 0.904923022f},
-std::array<float,2>{0.0540963188f, 0.668914497f},
-std::array<float,2>{0.511848152f, 0.241724283f},
-std::array<float,2>{0.280039787f, 0.158520773f},
-std::array<float,2>{0.921592116f, 0.728350222f},
-std::array<float,2>{0.200902f, 0.940085053f},
-std::array<float,2>{0.710041404f, 0.306385309f},
-std::array<float,2>{0.102466442f, 0.455199689f},
-std::array<float,2>{0.567921281f, 0.868392766f},
-std::array<float,2>{0.457917631f, 0.527772188f},
-std::array<float,2>{0.777476013f, 0.0390831865f},
-std::array<float,2>{0.0263372269f, 0.203463212f},
-std::array<float,2>{0.546347916f, 0.634844005f},
-std::array<float,2>{0.430505693f, 0.913358033f},
-std::array<float,2>{0.834685206f, 0.331931919f},
-std::array<float,2>{0.340163916f, 0.38447699f},
-std::array<float,2>{0.988931954f, 0.762962043f},
-std::array<float,2>{0.142211869f, 0.568652749f},
-std::array<float,2>{0.661915421f, 0.0811140314f},
-std::array<float,2>{0.479576826f, 0.0178598743f},
-std::array<float,2>{0.78707993f, 0.539057076f},
-std::array<float,2>{0.0905222818f, 0.818403184f},
-std::array<float,2>{0.597665668f, 0.470977217f},
-std::array<float,2>{0.222434908f, 0.26056239f},
-std::array<float,2>{0.719984889f, 0.982539892f},
-std::array<float,2>{0.302113056f, 0.703060389f},
-std::array<float,2>{0.901961386f, 0.149297982f},
-std::array<float,2>{0.0722044185f, 0.0597881041f},
-std::array<float,2>{0.613531888f, 0.505564094f},
-std::array<float,2>{0.486805588f, 0.853191435f},
-std::array<float,2>{0.808996856f, 0.451455742f},
-std::array<float,2>{0.291317284f, 0.293114245f},
-std::array<float,2>{0.884166837f, 0.953438818f},
-std::array<float,2>{0.243699953f, 0.739254355f},
-std::array<float,2>{0.738943279f, 0.181233138f},
-std::array<float,2>{0.41175127f, 0.219190881f},
-std::array<float,2>{0.82789427f, 0.68743068f},
-std::array<float,2>{0.00331469579f, 0.883880973f},
-std::array<float,2>{0.550977409f, 0.370465517f},
-std::array<float,2>{0.130086884f, 0.424780607f},
-std::array<float,2>{0.680586219f, 0.811973274f},
-std::array<float,2>{0.316321164f, 0.604871333f},
-std::array<float,2>{0.973081052f, 0.106521726f},
-std::array<float,2>{0.209062278f, 0.128317267f},
-std::array<float,2>{0.691484988f, 0.716340721f},
-std::array<float,2>{0.26172179f, 0.984680951f},
-std::array<float,2>{0.934520364f, 0.274825245f},
-std::array<float,2>{0.445883363f, 0.493154407f},
-std::array<float,2>{0.760898232f, 0.839215219f},
-std::array<float,2>{0.118140757f, 0.555697322f},
-std::array<float,2>{0.591421187f, 0.00575408153f},
-std::array<float,2>{0.371129453f, 0.0680538937f},
-std::array<float,2>{0.944765031f, 0.589059532f},
-std::array<float,2>{0.177745491f, 0.765836418f},
-std::array<float,2>{0.64045465f, 0.399306029f},
-std::array<float,2>{0.0320890173f, 0.321940809f},
-std::array<float,2>{0.517154992f, 0.922888517f},
-std::array<float,2>{0.389054567f, 0.652305007f},
-std::array<float,2>{0.845297635f, 0.191657588f},
-std::array<float,2>{0.241426006f, 0.00868987292f},
-std::array<float,2>{0.74400866f, 0.552703679f},
-std::array<float,2>{0.28444618f, 0.829585731f},
-std::array<float,2>{0.88193047f, 0.491120458f},
-std::array<float,2>{0.494053662f, 0.271916509f},
-std::array<float,2>{0.797269344f, 0.993484676f},
-std::array<float,2>{0.0634204f, 0.704636097f},
-std::array<float,2>{0.620732784f, 0.136388302f},
-std::array<float,2>{0.3252123f, 0.197474733f},
-std::array<float,2>{0.983543754f, 0.646001697f},
-std::array<float,2>{0.140058145f, 0.933075786f},
-std::array<float,2>{0.674076796f, 0.314048201f},
-std::array<float,2>{0.0143186459f, 0.392069072f},
-std::array<float,2>{0.562130511f, 0.779814184f},
-std::array<float,2>{0.419474304f, 0.584742546f},
-std::array<float,2>{0.816043735f, 0.0739607289f},
-std::array<float,2>{0.110935979f, 0.173319012f},
-std::array<float,2>{0.583026886f, 0.742421508f},
-std::array<float,2>{0.444383889f, 0.968656301f},
-std::array<float,2>{0.750231564f, 0.286420196f},
-std::array<float,2>{0.254673421f, 0.437812269f},
-std::array<float,2>{0.924674869f, 0.844457746f},
-std::array<float,2>{0.215699479f, 0.513065755f},
-std::array<float,2>{0.701541424f, 0.0534035414f},
-std::array<float,2>{0.380646676f, 0.0953426883f},
-std::array<float,2>{0.853624582f, 0.59963423f},
-std::array<float,2>{0.0457727201f, 0.800746202f},
-std::array<float,2>{0.524079263f, 0.433980525f},
-std::array<float,2>{0.182422265f, 0.364543736f},
-std::array<float,2>{0.631960392f, 0.875840962f},
-std::array<float,2>{0.36082387f, 0.673855364f},
-std::array<float,2>{0.948707759f, 0.234020188f},
-std::array<float,2>{0.0600044318f, 0.0937028453f},
-std::array<float,2>{0.503757477f, 0.576979518f},
-std::array<float,2>{0.405999333f, 0.751204252f},
-std::array<float,2>{0.863978624f, 0.381272405f},
-std::array<float,2>{0.351259351f, 0.33746168f},
-std::array<float,2>{0.967246294f, 0.918168485f},
-std::array<float,2>{0.165295571f, 0.625739276f},
-std::array<float,2>{0.650304735f, 0.215261698f},
-std::array<float,2>{0.46826759f, 0.1406423f},
-std::array<float,2>{0.768256545f, 0.691616356f},
-std::array<float,2>{0.100632004f, 0.972971678f},
-std::array<float,2>{0.571544647f, 0.250036865f},
-std::array<float,2>{0.189779356f, 0.483483344f},
-std::array<float,2>{0.715950429f, 0.821651161f},
-std::array<float,2>{0.26912272f, 0.546762407f},
-std::array<float,2>{0.90714401f, 0.0263402369f},
-std::array<float,2>{0.148474321f, 0.248707846f},
-std::array<float,2>{0.665252686f, 0.656365335f},
-std::array<float,2>{0.332559377f, 0.89615953f},
-std::array<float,2>{0.997824311f, 0.356652141f},
-std::array<float,2>{0.428079367f, 0.420941025f},
-std::array<float,2>{0.841132283f, 0.783056557f},
-std::array<float,2>{0.0165766589f, 0.619851291f},
-std::array<float,2>{0.534864664f, 0.111489698f},
-std::array<float,2>{0.308856964f, 0.0335925855f},
-std::array<float,2>{0.8934865f, 0.51969105f},
-std::array<float,2>{0.226898491f, 0.866752625f},
-std::array<float,2>{0.728043914f, 0.468009114f},
-std::array<float,2>{0.0824701414f, 0.303604722f},
-std::array<float,2>{0.601743579f, 0.951531768f},
-std::array<float,2>{0.473675847f, 0.72217381f},
-std::array<float,2>{0.792312324f, 0.166801468f},
-std::array<float,2>{0.196828038f, 0.0771569088f},
-std::array<float,2>{0.704665661f, 0.580983698f},
-std::array<float,2>{0.277258337f, 0.776148975f},
-std::array<float,2>{0.916136682f, 0.398129493f},
-std::array<float,2>{0.456288129f, 0.320171267f},
-std::array<float,2>{0.776362658f, 0.936691105f},
-std::array<float,2>{0.108178139f, 0.644066155f},
-std::array<float,2>{0.564426959f, 0.202100903f},
-std::array<float,2>{0.356642902f, 0.137506008f},
-std::array<float,2>{0.954159141f, 0.708030522f},
-std::array<float,2>{0.160312623f, 0.996870875f},
-std::array<float,2>{0.645160437f, 0.267785549f},
-std::array<float,2>{0.0504581369f, 0.486485094f},
-std::array<float,2>{0.510580301f, 0.833979905f},
-std::array<float,2>{0.391477734f, 0.549769759f},
-std::array<float,2>{0.872510135f, 0.014823827f},
-std::array<float,2>{0.0870676488f, 0.228135481f},
-std::array<float,2>{0.59514457f, 0.676807463f},
-std::array<float,2>{0.48372677f, 0.881429255f},
-std::array<float,2>{0.784751236f, 0.363038808f},
-std::array<float,2>{0.297771305f, 0.430360556f},
-std::array<float,2>{0.904101551f, 0.801024497f},
-std::array<float,2>{0.224230707f, 0.594563603f},
-std::array<float,2>{0.725622118f, 0.0989911929f},
-std::array<float,2>{0.436666161f, 0.0473762564f},
-std::array<float,2>{0.830652654f, 0.510966837f},
-std::array<float,2>{0.029292183f, 0.850480676f},
-std::array<float,2>{0.541370988f, 0.442951381f},
-std::array<float,2>{0.147582114f, 0.283823013f},
-std::array<float,2>{0.658771455f, 0.964734554f},
-std::array<float,2>{0.338686794f, 0.74977839f},
-std::array<float,2>{0.986651897f, 0.178042725f},
-std::array<float,2>{0.005446875f, 0.0297444258f},
-std::array<float,2>{0.548067749f, 0.539390564f},
-std::array<float,2>{0.409337342f, 0.827234328f},
-std::array<float,2>{0.821509182f, 0.477811337f},
-std::array<float,2>{0.318365395f, 0.255465209f},
-std::array<float,2>{0.970906436f, 0.970906734f},
-std::array<float,2>{0.127376586f, 0.688928962f},
-std::array<float,2>{0.686473489f, 0.146329537f},
-std::array<float,2>{0.489305466f, 0.211431593f},
-std::array<float,2>{0.806573808f, 0.632432461f},
-std::array<float,2>{0.0756541267f, 0.9177773f},
-std::array<float,2>{0.610092461f, 0.343512863f},
-std::array<float,2>{0.247089088f, 0.378289968f},
-std::array<float,2>{0.735918581f, 0.755705416f},
-std::array<float,2>{0.293348521f, 0.571588635f},
-std::array<float,2>{0.887580395f, 0.0894175544f},
-std::array<float,2>{0.174744889f, 0.170965955f},
-std::array<float,2>{0.634873807f, 0.726025283f},
-std::array<float,2>{0.367397845f, 0.946559548f},
-std::array<float,2>{0.94078964f, 0.29727149f},
-std::array<float,2>{0.385355532f, 0.463030308f},
-std::array<float,2>{0.85104239f, 0.861490428f},
-std::array<float,2>{0.0371318795f, 0.518660009f},
-std::array<float,2>{0.519657314f, 0.037027739f},
-std::array<float,2>{0.260179996f, 0.116970666f},
-std::array<float,2>{0.933156073f, 0.622663856f},
-std::array<float,2>{0.203322574f, 0.788218021f},
-std::array<float,2>{0.691366136f, 0.417378932f},
-std::array<float,2>{0.122206017f, 0.354805052f},
-std::array<float,2>{0.589339614f, 0.894230604f},
-std::array<float,2>{0.451790929f, 0.663214445f},
-std::array<float,2>{0.764405072f, 0.244459882f},
-std::array<float,2>{0.133591697f, 0.0430071764f},
-std::array<float,2>{0.679490685f, 0.524059772f},
-std::array<float,2>{0.323849678f, 0.872922778f},
-std::array<float,2>{0.980396926f, 0.459646225f},
-std::array<float,2>{0.416619629f, 0.309937f},
-std::array<float,2>{0.818380058f, 0.942131698f},
-std::array<float,2>{0.00816768408f, 0.733161449f},
-std::array<float,2>{0.555046499f, 0.161015198f},
-std::array<float,2>{0.285703689f, 0.236159816f},
-std::array<float,2>{0.8755849f, 0.66498214f},
-std::array<float,2>{0.23810102f, 0.901151896f},
-std::array<float,2>{0.747723818f, 0.350178212f},
-std::array<float,2>{0.0692283511f, 0.409244984f},
-std::array<float,2>{0.622940242f, 0.796295643f},
-std::array<float,2>{0.499726057f, 0.616743267f},
-std::array<float,2>{0.803717852f, 0.117716894f},
-std::array<float,2>{0.0396209285f, 0.153600737f},
-std::array<float,2>{0.527730465f, 0.695820034f},
-std::array<float,2>{0.376945704f, 0.980113447f},
-std::array<float,2>{0.857664227f, 0.264121681f},
-std::array<float,2>{0.364723474f, 0.47282064f},
-std::array<float,2>{0.95060271f, 0.816102743f},
-std::array<float,2>{0.186470747f, 0.534572303f},
-std::array<float,2>{0.6275599f, 0.0234041754f},
-std::array<float,2>{0.438049555f, 0.0827857926f},
-std::array<float,2>{0.757546008f, 0.563683689f},
-std::array<float,2>{0.114284992f, 0.760601163f},
-std::array<float,2>{0.579597533f, 0.387631297f},
-std::array<float,2>{0.21221073f, 0.335278034f},
-std::array<float,2>{0.698238015f, 0.908450782f},
-std::array<float,2>{0.252871752f, 0.638567746f},
-std::array<float,2>{0.926337063f, 0.210788593f},
-std::array<float,2>{0.095442377f, 0.103537053f},
-std::array<float,2>{0.575701356f, 0.606910646f},
-std::array<float,2>{0.461187094f, 0.805328429f},
-std::array<float,2>{0.772396684f, 0.426370949f},
-std::array<float,2>{0.27074194f, 0.372560501f},
-std::array<float,2>{0.912074983f, 0.890102267f},
-std::array<float,2>{0.191604361f, 0.679804623f},
-std::array<float,2>{0.712197781f, 0.226073086f},
-std::array<float,2>{0.399076581f, 0.18512769f},
-std::array<float,2>{0.860753894f, 0.73751694f},
-std::array<float,2>{0.0571249612f, 0.957477808f},
-std::array<float,2>{0.50705862f, 0.289673597f},
-std::array<float,2>{0.170104966f, 0.446258277f},
-std::array<float,2>{0.652557135f, 0.855896771f},
-std::array<float,2>{0.346634388f, 0.502264977f},
-std::array<float,2>{0.9640522f, 0.0564456396f},
-std::array<float,2>{0.232309714f, 0.189561486f},
-std::array<float,2>{0.73411876f, 0.655839145f},
-std::array<float,2>{0.307269245f, 0.925831318f},
-std::array<float,2>{0.895770192f, 0.32594198f},
-std::array<float,2>{0.471963853f, 0.405679524f},
-std::array<float,2>{0.796266735f, 0.769822419f},
-std::array<float,2>{0.0792563483f, 0.59279108f},
-std::array<float,2>{0.607686639f, 0.0633732453f},
-std::array<float,2>{0.329670519f, 0.00192690827f},
-std::array<float,2>{0.995605171f, 0.562274098f},
-std::array<float,2>{0.155143008f, 0.840821326f},
-std::array<float,2>{0.670643091f, 0.498517036f},
-std::array<float,2>{0.0203914475f, 0.280900627f},
-std::array<float,2>{0.537308455f, 0.991604269f},
-std::array<float,2>{0.423204899f, 0.711310983f},
-std::array<float,2>{0.839628935f, 0.129840031f},
-std::array<float,2>{0.143362552f, 0.0791886523f},
-std::array<float,2>{0.662184119f, 0.566538453f},
-std::array<float,2>{0.342962354f, 0.764636397f},
-std::array<float,2>{0.991426051f, 0.385084689f},
-std::array<float,2>{0.433187306f, 0.328953177f},
-std::array<float,2>{0.832357883f, 0.911616504f},
-std::array<float,2>{0.0242327079f, 0.634041607f},
-std::array<float,2>{0.543901563f, 0.20666489f},
-std::array<float,2>{0.304458559f, 0.15067403f},
-std::array<float,2>{0.900143623f, 0.700662255f},
-std::array<float,2>{0.219980627f, 0.982133925f},
-std::array<float,2>{0.721512437f, 0.259303749f},
-std::array<float,2>{0.0922376513f, 0.470631331f},
-std::array<float,2>{0.601497769f, 0.816916406f},
-std::array<float,2>{0.477697045f, 0.535848141f},
-std::array<float,2>{0.787598729f, 0.0159764718f},
-std::array<float,2>{0.0511468165f, 0.23999308f},
-std::array<float,2>{0.514351606f, 0.670446873f},
-std::array<float,2>{0.397194833f, 0.903316975f},
-std::array<float,2>{0.870958149f, 0.347003549f},
-std::array<float,2>{0.352946937f, 0.413715869f},
-std::array<float,2>{0.960845947f, 0.792114735f},
-std::array<float,2>{0.156513721f, 0.611233473f},
-std::array<float,2>{0.642094731f, 0.122218698f},
-std::array<float,2>{0.460059017f, 0.0416567251f},
-std::array<float,2>{0.780799806f, 0.529729843f},
-std::array<float,2>{0.103749305f, 0.870787859f},
-std::array<float,2>{0.570216775f, 0.454886228f},
-std::array<float,2>{0.201717615f, 0.307577968f},
-std::array<float,2>{0.708136082f, 0.939176857f},
-std::array<float,2>{0.278996378f, 0.730238974f},
-std::array<float,2>{0.918212235f, 0.156843573f},
-std::array<float,2>{0.119272545f, 0.00676099258f},
-std::array<float,2>{0.592636585f, 0.556897938f},
-std::array<float,2>{0.447452277f, 0.836594999f},
-std::array<float,2>{0.759289682f, 0.494928509f},
-std::array<float,2>{0.2637299f, 0.27701959f},
-std::array<float,2>{0.936424494f, 0.98808223f},
-std::array<float,2>{0.208445922f, 0.718673289f},
-std::array<float,2>{0.694431186f, 0.125886083f},
-std::array<float,2>{0.387412161f, 0.193651527f},
-std::array<float,2>{0.846309364f, 0.649654388f},
-std::array<float,2>{0.034567669f, 0.924440324f},
-std::array<float,2>{0.518660784f, 0.324121922f},
-std::array<float,2>{0.176504627f, 0.402315736f},
-std::array<float,2>{0.637766242f, 0.76835382f},
-std::array<float,2>{0.373307168f, 0.587507546f},
-std::array<float,2>{0.942737699f, 0.0692255348f},
-std::array<float,2>{0.245270699f, 0.183407143f},
-std::array<float,2>{0.741554379f, 0.740705669f},
-std::array<float,2>{0.289404899f, 0.956877351f},
-std::array<float,2>{0.886430025f, 0.296176314f},
-std::array<float,2>{0.484746695f, 0.450091094f},
-std::array<float,2>{0.810841799f, 0.855077267f},
-std::array<float,2>{0.0736868232f, 0.506575882f},
-std::array<float,2>{0.615797043f, 0.0605792813f},
-std::array<float,2>{0.314151317f, 0.108508252f},
-std::array<float,2>{0.976552784f, 0.602135956f},
-std::array<float,2>{0.13231343f, 0.809892356f},
-std::array<float,2>{0.682784617f, 0.423381358f},
-std::array<float,2>{0.00151910644f, 0.368546695f},
-std::array<float,2>{0.554019928f, 0.885685086f},
-std::array<float,2>{0.412929565f, 0.684257269f},
-std::array<float,2>{0.825660646f, 0.221679986f},
-std::array<float,2>{0.216905683f, 0.0518179536f},
-std::array<float,2>{0.7003057f, 0.514993489f},
-std::array<float,2>{0.257249713f, 0.846021354f},
-std::array<float,2>{0.922246456f, 0.439485282f},
-std::array<float,2>{0.443348497f, 0.28809464f},
-std::array<float,2>{0.753107846f, 0.966353059f},
-std::array<float,2>{0.113070786f, 0.744407296f},
-std::array<float,2>{0.585245013f, 0.174606934f},
-std::array<float,2>{0.361586422f, 0.231935978f},
-std::array<float,2>{0.946039677f, 0.672043383f},
-std::array<float,2>{0.180716857f, 0.878364086f},
-std::array<float,2>{0.629606426f, 0.366208941f},
-std::array<float,2>{0.0439753495f, 0.435603619f},
-std::array<float,2>{0.526906192f, 0.798778415f},
-std::array<float,2>{0.381394148f, 0.598555326f},
-std::array<float,2>{0.853006899f, 0.0958921909f},
-std::array<float,2>{0.0644556507f, 0.134024754f},
-std::array<float,2>{0.618285477f, 0.706262529f},
-std::array<float,2>{0.495713651f, 0.99434185f},
-std::array<float,2>{0.800459206f, 0.270013452f},
-std::array<float,2>{0.282340169f, 0.489425838f},
-std::array<float,2>{0.880595028f, 0.831246138f},
-std::array<float,2>{0.238510817f, 0.554424763f},
-std::array<float,2>{0.744870901f, 0.0105719408f},
-std::array<float,2>{0.420400679f, 0.0719754472f},
-std::array<float,2>{0.812681556f, 0.583238006f},
-std::array<float,2>{0.0122300368f, 0.777801931f},
-std::array<float,2>{0.558958113f, 0.392960876f},
-std::array<float,2>{0.137653515f, 0.315777719f},
-std::array<float,2>{0.673363745f, 0.931230187f},
-std::array<float,2>{0.327380568f, 0.647318065f},
-std::array<float,2>{0.981408417f, 0.197210222f},
-std::array<float,2>{0.01852943f, 0.110974714f},
-std::array<float,2>{0.53281486f, 0.618290782f},
-std::array<float,2>{0.427106321f, 0.785083592f},
-std::array<float,2>{0.842270136f, 0.418734223f},
-std::array<float,2>{0.334666163f, 0.359203577f},
-std::array<float,2>{0.999075651f, 0.897669733f},
-std::array<float,2>{0.151897654f, 0.659086764f},
-std::array<float,2>{0.667068601f, 0.247940704f},
-std::array<float,2>{0.475254834f, 0.165003538f},
-std::array<float,2>{0.789210498f, 0.720651627f},
-std::array<float,2>{0.0858883634f, 0.951161504f},
-std::array<float,2>{0.603668034f, 0.30220452f},
-std::array<float,2>{0.228867203f, 0.465687245f},
-std::array<float,2>{0.72933948f, 0.863952518f},
-std::array<float,2>{0.311570823f, 0.52232331f},
-std::array<float,2>{0.891786993f, 0.0325215124f},
-std::array<float,2>{0.166290671f, 0.216883823f},
-std::array<float,2>{0.651286006f, 0.628392339f},
-std::array<float,2>{0.348389834f, 0.920913339f},
-std::array<float,2>{0.965447843f, 0.339638054f},
-std::array<float,2>{0.403419793f, 0.380583793f},
-std::array<float,2>{0.865340889f, 0.752958834f},
-std::array<float,2>{0.0623113401f, 0.575985849f},
-std::array<float,2>{0.501134276f, 0.0908119455f},
-std::array<float,2>{0.266269416f, 0.0239242669f},
-std::array<float,2>{0.909898341f, 0.544087529f},
-std::array<float,2>{0.188154519f, 0.823621094f},
-std::array<float,2>{0.718736887f, 0.482035398f},
-std::array<float,2>{0.0983075947f, 0.252255023f},
-std::array<float,2>{0.573202074f, 0.975294769f},
-std::array<float,2>{0.465489089f, 0.693784237f},
-std::array<float,2>{0.767105341f, 0.143035606f},
-std::array<float,2>{0.225620016f, 0.100126371f},
-std::array<float,2>{0.724171877f, 0.596530914f},
-std::array<float,2>{0.299899757f, 0.80451268f},
-std::array<float,2>{0.906135261f, 0.432945937f},
-std::array<float,2>{0.4819583f, 0.360843688f},
-std::array<float,2>{0.782195926f, 0.880307078f},
-std::array<float,2>{0.0894228369f, 0.677877605f},
-std::array<float,2>{0.596138358f, 0.229057133f},
-std::array<float,2>{0.33603853f, 0.176464081f},
-std::array<float,2>{0.985704541f, 0.746652007f},
-std::array<float,2>{0.14578779f, 0.962301314f},
-std::array<float,2>{0.657113016f, 0.283199728f},
-std::array<float,2>{0.0297003873f, 0.444304943f},
-std::array<float,2>{0.540039599f, 0.849432349f},
-std::array<float,2>{0.434705406f, 0.508244693f},
-std::array<float,2>{0.829747438f, 0.0502331071f},
-std::array<float,2>{0.106785268f, 0.199920788f},
-std::array<float,2>{0.565660477f, 0.641467154f},
-std::array<float,2>{0.454381645f, 0.934989989f},
-std::array<float,2>{0.775350392f, 0.316754252f},
-std::array<float,2>{0.27520743f, 0.396475405f},
-std::array<float,2>{0.915813923f, 0.774781108f},
-std::array<float,2>{0.197361887f, 0.578500926f},
-std::array<float,2>{0.70531702f, 0.0743450299f},
-std::array<float,2>{0.393006921f, 0.013513945f},
-std::array<float,2>{0.873587847f, 0.547554493f},
-std::array<float,2>{0.0475895442f, 0.834561229f},
-std::array<float,2>{0.50817287f, 0.484972388f},
-std::array<float,2>{0.163754135f, 0.267029852f},
-std::array<float,2>{0.64788425f, 0.998604655f},
-std::array<float,2>{0.358842105f, 0.710690856f},
-std::array<float,2>{0.955248177f, 0.140507132f},
-std::array<float,2>{0.0365442522f, 0.0375776589f},
-std::array<float,2>{0.522946596f, 0.516758323f},
-std::array<float,2>{0.383978516f, 0.859496534f},
-std::array<float,2>{0.84863013f, 0.462518632f},
-std::array<float,2>{0.369603783f, 0.299158931f},
-std::array<float,2>{0.937923431f, 0.94728595f},
-std::array<float,2>{0.173330665f, 0.724504828f},
-std::array<float,2>{0.634530008f, 0.168119624f},
-std::array<float,2>{0.450591058f, 0.243229896f},
-std::array<float,2>{0.763048828f, 0.660988212f},
-std::array<float,2>{0.124075569f, 0.891008794f},
-std::array<float,2>{0.587842584f, 0.352490246f},
-std::array<float,2>{0.206106499f, 0.414484859f},
-std::array<float,2>{0.68795675f, 0.786369085f},
-std::array<float,2>{0.257973343f, 0.62317878f},
-std::array<float,2>{0.930344462f, 0.114089578f},
-std::array<float,2>{0.126554683f, 0.147381231f},
-std::array<float,2>{0.684669197f, 0.690920055f},
-std::array<float,2>{0.31803599f, 0.969919562f},
-std::array<float,2>{0.968996525f, 0.256453514f},
-std::array<float,2>{0.407508135f, 0.48015976f},
-std::array<float,2>{0.8229146f, 0.82483685f},
-std::array<float,2>{0.00712542702f, 0.542637587f},
-std::array<float,2>{0.549305737f, 0.0276725348f},
-std::array<float,2>{0.296866834f, 0.0871009231f},
-std::array<float,2>{0.888727963f, 0.573442221f},
-std::array<float,2>{0.249756888f, 0.756985188f},
-std::array<float,2>{0.737958729f, 0.376400203f},
-std::array<float,2>{0.0771646127f, 0.340109378f},
-std::array<float,2>{0.611671746f, 0.915952206f},
-std::array<float,2>{0.491954505f, 0.629538476f},
-std::array<float,2>{0.807517231f, 0.214654192f},
-std::array<float,2>{0.184714004f, 0.0204474106f},
-std::array<float,2>{0.625822484f, 0.531879306f},
-std::array<float,2>{0.365932047f, 0.813510478f},
-std::array<float,2>{0.953039646f, 0.475815982f},
-std::array<float,2>{0.378809005f, 0.262247086f},
-std::array<float,2>{0.857115149f, 0.977771699f},
-std::array<float,2>{0.0411909819f, 0.698133707f},
-std::array<float,2>{0.530530155f, 0.155087978f},
-std::array<float,2>{0.251072943f, 0.208470345f},
-std::array<float,2>{0.928098977f, 0.640164435f},
-std::array<float,2>{0.214522839f, 0.906354249f},
-std::array<float,2>{0.695610106f, 0.332076699f},
-std::array<float,2>{0.115968585f, 0.388830096f},
-std::array<float,2>{0.581097603f, 0.758023381f},
-std::array<float,2>{0.441371799f, 0.56551975f},
-std::array<float,2>{0.75577575f, 0.0849293396f},
-std::array<float,2>{0.0100674164f, 0.163928553f},
-std::array<float,2>{0.55734688f, 0.732368469f},
-std::array<float,2>{0.415143132f, 0.945084274f},
-std::array<float,2>{0.81647855f, 0.311659604f},
-std::array<float,2>{0.321018964f, 0.458094627f},
-std::array<float,2>{0.97670871f, 0.873461545f},
-std::array<float,2>{0.135584518f, 0.525610447f},
-std::array<float,2>{0.677063107f, 0.0451084711f},
-std::array<float,2>{0.497766376f, 0.120605439f},
-std::array<float,2>{0.802601099f, 0.614546716f},
-std::array<float,2>{0.0669363067f, 0.794647813f},
-std::array<float,2>{0.623579979f, 0.407230228f},
-std::array<float,2>{0.235297993f, 0.348939747f},
-std::array<float,2>{0.749531388f, 0.89928329f},
-std::array<float,2>{0.288801581f, 0.667489827f},
-std::array<float,2>{0.876959622f, 0.237911224f},
-std::array<float,2>{0.0802656412f, 0.0660262182f},
-std::array<float,2>{0.606920898f, 0.591573715f},
-std::array<float,2>{0.469688922f, 0.772473335f},
-std::array<float,2>{0.793950379f, 0.402739018f},
-std::array<float,2>{0.305838674f, 0.327517062f},
-std::array<float,2>{0.8983531f, 0.929217279f},
-std::array<float,2>{0.233826935f, 0.653456032f},
-std::array<float,2>{0.730987966f, 0.1878905f},
-std::array<float,2>{0.424863577f, 0.132050037f},
-std::array<float,2>{0.836634099f, 0.714254975f},
-std::array<float,2>{0.0215051975f, 0.990120173f},
-std::array<float,2>{0.537033141f, 0.27737534f},
-std::array<float,2>{0.153857827f, 0.496748239f},
-std::array<float,2>{0.669457078f, 0.842116237f},
-std::array<float,2>{0.331465632f, 0.559594333f},
-std::array<float,2>{0.993299842f, 0.00318278349f},
-std::array<float,2>{0.195085615f, 0.223160803f},
-std::array<float,2>{0.714157999f, 0.681905985f},
-std::array<float,2>{0.271893233f, 0.886863291f},
-std::array<float,2>{0.912772954f, 0.373784959f},
-std::array<float,2>{0.463956177f, 0.427858084f},
-std::array<float,2>{0.770937562f, 0.807391107f},
-std::array<float,2>{0.0964527354f, 0.608038485f},
-std::array<float,2>{0.57693541f, 0.102751628f},
-std::array<float,2>{0.344160706f, 0.0577692278f},
-std::array<float,2>{0.961350739f, 0.500734329f},
-std::array<float,2>{0.169620112f, 0.858506203f},
-std::array<float,2>{0.65591836f, 0.448209047f},
-std::array<float,2>{0.0556511581f, 0.291746557f},
-std::array<float,2>{0.505346656f, 0.960249782f},
-std::array<float,2>{0.40182206f, 0.735689044f},
-std::array<float,2>{0.861631155f, 0.18581827f},
-std::array<float,2>{0.160461932f, 0.0760661438f},
-std::array<float,2>{0.645391047f, 0.579201519f},
-std::array<float,2>{0.356726915f, 0.774048448f},
-std::array<float,2>{0.9545331f, 0.394977361f},
-std::array<float,2>{0.39121148f, 0.318322301f},
-std::array<float,2>{0.872087955f, 0.933707595f},
-std::array<float,2>{0.0506232791f, 0.64167577f},
-std::array<float,2>{0.510335445f, 0.200609118f},
-std::array<float,2>{0.277033985f, 0.139549971f},
-std::array<float,2>{0.9163872f, 0.709260702f},
-std::array<float,2>{0.19707115f, 0.999798417f},
-std::array<float,2>{0.704967618f, 0.266534179f},
-std::array<float,2>{0.108108737f, 0.485629648f},
-std::array<float,2>{0.563977301f, 0.83501035f},
-std::array<float,2>{0.4563829f, 0.548535943f},
-std::array<float,2>{0.776025712f, 0.0118316757f},
-std::array<float,2>{0.0289375335f, 0.229926571f},
-std::array<float,2>{0.541156888f, 0.678751647f},
-std::array<float,2>{0.436859757f, 0.879125535f},
-std::array<float,2>{0.830977499f, 0.359379649f},
-std::array<float,2>{0.338394433f, 0.432299167f},
-std::array<float,2>{0.986457825f, 0.802996337f},
-std::array<float,2>{0.147890598f, 0.596862078f},
-std::array<float,2>{0.659010708f, 0.101397887f},
-std::array<float,2>{0.4834252f, 0.0495008044f},
-std::array<float,2>{0.784956396f, 0.50882256f},
-std::array<float,2>{0.0872519016f, 0.847758055f},
-std::array<float,2>{0.594783783f, 0.445271492f},
-std::array<float,2>{0.224548653f, 0.281832755f},
-std::array<float,2>{0.726029873f, 0.961302221f},
-std::array<float,2>{0.29748255f, 0.747128308f},
-std::array<float,2>{0.904037118f, 0.176879495f},
-std::array<float,2>{0.0754163563f, 0.0284451004f},
-std::array<float,2>{0.610132098f, 0.541897178f},
-std::array<float,2>{0.489590943f, 0.825460792f},
-std::array<float,2>{0.806359172f, 0.478649408f},
-std::array<float,2>{0.29304564f, 0.257394522f},
-std::array<float,2>{0.887417316f, 0.96893245f},
-std::array<float,2>{0.247331649f, 0.690218687f},
-std::array<float,2>{0.736256778f, 0.148413166f},
-std::array<float,2>{0.409549505f, 0.213762268f},
-std::array<float,2>{0.821694136f, 0.629895627f},
-std::array<float,2>{0.00570512796f, 0.915002882f},
-std::array<float,2>{0.548214495f, 0.340875536f},
-std::array<float,2>{0.127092496f, 0.375123024f},
-std::array<float,2>{0.686212718f, 0.75667572f},
-std::array<float,2>{0.318646193f, 0.572603345f},
-std::array<float,2>{0.971074283f, 0.0864243954f},
-std::array<float,2>{0.203381643f, 0.169477612f},
-std::array<float,2>{0.690939009f, 0.723092139f},
-std::array<float,2>{0.259830534f, 0.949208319f},
-std::array<float,2>{0.933408022f, 0.300630182f},
-std::array<float,2>{0.451966494f, 0.461184591f},
-std::array<float,2>{0.764293909f, 0.860566199f},
-std::array<float,2>{0.122361243f, 0.515973866f},
-std::array<float,2>{0.589045584f, 0.0382187441f},
-std::array<float,2>{0.367613912f, 0.114507951f},
-std::array<float,2>{0.94046998f, 0.624053895f},
-std::array<float,2>{0.174353153f, 0.785679162f},
-std::array<float,2>{0.6351282f, 0.415152848f},
-std::array<float,2>{0.0375883467f, 0.353338629f},
-std::array<float,2>{0.519791186f, 0.892378211f},
-std::array<float,2>{0.385510921f, 0.661234379f},
-std::array<float,2>{0.850607753f, 0.242529258f},
-std::array<float,2>{0.23792693f, 0.0464237332f},
-std::array<float,2>{0.747827411f, 0.527313352f},
-std::array<float,2>{0.286045015f, 0.874155104f},
-std::array<float,2>{0.875860095f, 0.45767203f},
-std::array<float,2>{0.499843031f, 0.311474085f},
-std::array<float,2>{0.803981483f, 0.943396151f},
-std::array<float,2>{0.0689815804f, 0.731385589f},
-std::array<float,2>{0.622776389f, 0.162881598f},
-std::array<float,2>{0.324168473f, 0.236996368f},
-std::array<float,2>{0.980184615f, 0.666220129f},
-std::array<float,2>{0.133540943f, 0.899572432f},
-std::array<float,2>{0.679209113f, 0.348232001f},
-std::array<float,2>{0.0078416355f, 0.406964242f},
-std::array<float,2>{0.554835379f, 0.793148696f},
-std::array<float,2>{0.416890621f, 0.613284528f},
-std::array<float,2>{0.818661928f, 0.119786024f},
-std::array<float,2>{0.114721484f, 0.155622095f},
-std::array<float,2>{0.580044687f, 0.698740721f},
-std::array<float,2>{0.438233018f, 0.977477849f},
-std::array<float,2>{0.757693052f, 0.262867391f},
-std::array<float,2>{0.252512038f, 0.475001842f},
-std::array<float,2>{0.926653802f, 0.81284225f},
-std::array<float,2>{0.211944193f, 0.532656193f},
-std::array<float,2>{0.697855413f, 0.0211140476f},
-std::array<float,2>{0.376595497f, 0.0849784315f},
-std::array<float,2>{0.857843876f, 0.564685762f},
-std::array<float,2>{0.0400066227f, 0.759003699f},
-std::array<float,2>{0.52741462f, 0.390164226f},
-std::array<float,2>{0.186236516f, 0.333947569f},
-std::array<float,2>{0.627741456f, 0.907580912f},
-std::array<float,2>{0.364411384f, 0.639609814f},
-std::array<float,2>{0.95031625f, 0.207201317f},
-std::array<float,2>{0.0566717833f, 0.102264851f},
-std::array<float,2>{0.507140279f, 0.6086815f},
-std::array<float,2>{0.399294913f, 0.80818826f},
-std::array<float,2>{0.860418141f, 0.429359764f},
-std::array<float,2>{0.346419007f, 0.374109924f},
-std::array<float,2>{0.964215279f, 0.888027489f},
-std::array<float,2>{0.17037645f, 0.683212042f},
-std::array<float,2>{0.652706265f, 0.223819137f},
-std::array<float,2>{0.461074293f, 0.18746613f},
-std::array<float,2>{0.772006392f, 0.734572351f},
-std::array<float,2>{0.0955659449f, 0.959185183f},
-std::array<float,2>{0.576129496f, 0.292349875f},
-std::array<float,2>{0.191716567f, 0.448973417f},
-std::array<float,2>{0.712036014f, 0.857906997f},
-std::array<float,2>{0.270810068f, 0.501412034f},
-std::array<float,2>{0.911660433f, 0.0571055897f},
-std::array<float,2>{0.15489994f, 0.18892327f},
-std::array<float,2>{0.670798659f, 0.652595818f},
-std::array<float,2>{0.329895705f, 0.927857757f},
-std::array<float,2>{0.995140493f, 0.327135175f},
-std::array<float,2>{0.423061192f, 0.403855264f},
-std::array<float,2>{0.839596152f, 0.77209419f},
-std::array<float,2>{0.0202222038f, 0.590308666f},
-std::array<float,2>{0.537577212f, 0.064734593f},
-std::array<float,2>{0.307386726f, 0.00289725931f},
-std::array<float,2>{0.895541668f, 0.559128463f},
-std::array<float,2>{0.231978476f, 0.84337765f},
-std::array<float,2>{0.734208524f, 0.497962743f},
-std::array<float,2>{0.079507947f, 0.278343052f},
-std::array<float,2>{0.607561946f, 0.989056408f},
-std::array<float,2>{0.471861839f, 0.71372658f},
-std::array<float,2>{0.795993209f, 0.131633237f},
-std::array<float,2>{0.201109216f, 0.12206877f},
-std::array<float,2>{0.710355222f, 0.610107601f},
-std::array<float,2>{0.279978752f, 0.791801393f},
-std::array<float,2>{0.921664953f, 0.413041979f},
-std::array<float,2>{0.457526058f, 0.3463085f},
-std::array<float,2>{0.777610064f, 0.904247344f},
-std::array<float,2>{0.102120548f, 0.671447337f},
-std::array<float,2>{0.568336964f, 0.238463059f},
-std::array<float,2>{0.354188859f, 0.157734036f},
-std::array<float,2>{0.95704025f, 0.728827536f},
-std::array<float,2>{0.15916869f, 0.938361645f},
-std::array<float,2>{0.643755674f, 0.308156252f},
-std::array<float,2>{0.0538704619f, 0.453976393f},
-std::array<float,2>{0.512103975f, 0.869486988f},
-std::array<float,2>{0.395834714f, 0.530484796f},
-std::array<float,2>{0.8676036f, 0.0421286635f},
-std::array<float,2>{0.0908114091f, 0.206009135f},
-std::array<float,2>{0.598064303f, 0.633157372f},
-std::array<float,2>{0.479896218f, 0.910374939f},
-std::array<float,2>{0.786811948f, 0.32981053f},
-std::array<float,2>{0.301876724f, 0.386309177f},
-std::array<float,2>{0.902200341f, 0.764950216f},
-std::array<float,2>{0.222343251f, 0.567521095f},
-std::array<float,2>{0.719936609f, 0.0782545581f},
-std::array<float,2>{0.430205613f, 0.01729431f},
-std::array<float,2>{0.834944308f, 0.53651619f},
-std::array<float,2>{0.0259199403f, 0.817972422f},
-std::array<float,2>{0.546019673f, 0.468969613f},
-std::array<float,2>{0.142539531f, 0.258034021f},
-std::array<float,2>{0.661672592f, 0.980646133f},
-std::array<float,2>{0.340083987f, 0.699227154f},
-std::array<float,2>{0.989112675f, 0.152023226f},
-std::array<float,2>{0.00302385073f, 0.0616717301f},
-std::array<float,2>{0.551231503f, 0.507416904f},
-std::array<float,2>{0.411893308f, 0.854151726f},
-std::array<float,2>{0.827782273f, 0.450959593f},
-std::array<float,2>{0.316060185f, 0.295723557f},
-std::array<float,2>{0.972733796f, 0.955241561f},
-std::array<float,2>{0.130252749f, 0.741728961f},
-std::array<float,2>{0.680269241f, 0.182564527f},
-std::array<float,2>{0.486498326f, 0.220781446f},
-std::array<float,2>{0.808811486f, 0.685306251f},
-std::array<float,2>{0.0719264895f, 0.886339724f},
-std::array<float,2>{0.613437772f, 0.367915511f},
-std::array<float,2>{0.244067714f, 0.422101349f},
-std::array<float,2>{0.739141464f, 0.809555233f},
-std::array<float,2>{0.291030675f, 0.603061318f},
-std::array<float,2>{0.883948684f, 0.107772425f},
-std::array<float,2>{0.178167731f, 0.126675442f},
-std::array<float,2>{0.640189588f, 0.717065394f},
-std::array<float,2>{0.371572405f, 0.986670852f},
-std::array<float,2>{0.944391012f, 0.275869519f},
-std::array<float,2>{0.388890386f, 0.495771766f},
-std::array<float,2>{0.845460474f, 0.836978614f},
-std::array<float,2>{0.0318349637f, 0.558312178f},
-std::array<float,2>{0.517530501f, 0.00702349981f},
-std::array<float,2>{0.261974603f, 0.0699673668f},
-std::array<float,2>{0.934293687f, 0.586194456f},
-std::array<float,2>{0.209427997f, 0.769460559f},
-std::array<float,2>{0.691697598f, 0.401304126f},
-std::array<float,2>{0.117868744f, 0.322507113f},
-std::array<float,2>{0.591603696f, 0.924817264f},
-std::array<float,2>{0.446194261f, 0.649160922f},
-std::array<float,2>{0.761147738f, 0.19483389f},
-std::array<float,2>{0.139892086f, 0.0109751392f},
-std::array<float,2>{0.674045742f, 0.552844763f},
-std::array<float,2>{0.325576723f, 0.830423594f},
-std::array<float,2>{0.98384881f, 0.488966763f},
-std::array<float,2>{0.41987884f, 0.271408617f},
-std::array<float,2>{0.816281557f, 0.995971084f},
-std::array<float,2>{0.01445032f, 0.705981672f},
-std::array<float,2>{0.562388182f, 0.133307606f},
-std::array<float,2>{0.284264565f, 0.19617416f},
-std::array<float,2>{0.882154405f, 0.647618532f},
-std::array<float,2>{0.24159798f, 0.929724216f},
-std::array<float,2>{0.743731558f, 0.315048188f},
-std::array<float,2>{0.063032791f, 0.394093215f},
-std::array<float,2>{0.620928049f, 0.779022753f},
-std::array<float,2>{0.493674099f, 0.582402945f},
-std::array<float,2>{0.7969262f, 0.0706913397f},
-std::array<float,2>{0.0455057509f, 0.175242722f},
-std::array<float,2>{0.524394333f, 0.745974183f},
-std::array<float,2>{0.380455315f, 0.965213537f},
-std::array<float,2>{0.853913784f, 0.287220627f},
-std::array<float,2>{0.360521287f, 0.440810323f},
-std::array<float,2>{0.94840759f, 0.847310603f},
-std::array<float,2>{0.182296917f, 0.514466941f},
-std::array<float,2>{0.632220984f, 0.0508420765f},
-std::array<float,2>{0.444669902f, 0.0968163013f},
-std::array<float,2>{0.750300169f, 0.598950267f},
-std::array<float,2>{0.111304708f, 0.797556758f},
-std::array<float,2>{0.583458066f, 0.436920077f},
-std::array<float,2>{0.215501487f, 0.367132515f},
-std::array<float,2>{0.701241493f, 0.877520621f},
-std::array<float,2>{0.254592776f, 0.673060834f},
-std::array<float,2>{0.924503922f, 0.231048301f},
-std::array<float,2>{0.101052366f, 0.0910131037f},
-std::array<float,2>{0.571505964f, 0.575150549f},
-std::array<float,2>{0.468629777f, 0.752279282f},
-std::array<float,2>{0.768514931f, 0.379281402f},
-std::array<float,2>{0.269413054f, 0.338854134f},
-std::array<float,2>{0.906833231f, 0.920696139f},
-std::array<float,2>{0.18964833f, 0.627324224f},
-std::array<float,2>{0.716247261f, 0.218116924f},
-std::array<float,2>{0.40600875f, 0.143686801f},
-std::array<float,2>{0.864031672f, 0.694402158f},
-std::array<float,2>{0.0595926493f, 0.976436913f},
-std::array<float,2>{0.50363934f, 0.253646016f},
-std::array<float,2>{0.165048122f, 0.480908066f},
-std::array<float,2>{0.649945438f, 0.823120952f},
-std::array<float,2>{0.351497829f, 0.54300648f},
-std::array<float,2>{0.966931999f, 0.0247073211f},
-std::array<float,2>{0.226650447f, 0.24627468f},
-std::array<float,2>{0.728415489f, 0.659687936f},
-std::array<float,2>{0.308654755f, 0.89648509f},
-std::array<float,2>{0.893151581f, 0.358117819f},
-std::array<float,2>{0.473925054f, 0.419471949f},
-std::array<float,2>{0.792072713f, 0.784166813f},
-std::array<float,2>{0.0820973292f, 0.617191851f},
-std::array<float,2>{0.601967871f, 0.110117547f},
-std::array<float,2>{0.332800746f, 0.0315016396f},
-std::array<float,2>{0.997663438f, 0.522582531f},
-std::array<float,2>{0.148919791f, 0.86441654f},
-std::array<float,2>{0.665350914f, 0.466311634f},
-std::array<float,2>{0.0161763299f, 0.301236749f},
-std::array<float,2>{0.535082102f, 0.95017153f},
-std::array<float,2>{0.42775166f, 0.719449639f},
-std::array<float,2>{0.840833485f, 0.165055171f},
-std::array<float,2>{0.145742521f, 0.0983122364f},
-std::array<float,2>{0.656747282f, 0.594947219f},
-std::array<float,2>{0.336191505f, 0.802382052f},
-std::array<float,2>{0.985542834f, 0.431348085f},
-std::array<float,2>{0.434895813f, 0.361584395f},
-std::array<float,2>{0.829920232f, 0.882289827f},
-std::array<float,2>{0.029501792f, 0.676202059f},
-std::array<float,2>{0.540444732f, 0.227227136f},
-std::array<float,2>{0.300250411f, 0.178961366f},
-std::array<float,2>{0.905791342f, 0.748168826f},
-std::array<float,2>{0.225862741f, 0.962971628f},
-std::array<float,2>{0.724558175f, 0.284590811f},
-std::array<float,2>{0.0896866769f, 0.442322284f},
-std::array<float,2>{0.595762014f, 0.851038575f},
-std::array<float,2>{0.482240975f, 0.510438383f},
-std::array<float,2>{0.781915009f, 0.0485829748f},
-std::array<float,2>{0.0476433784f, 0.202837586f},
-std::array<float,2>{0.508018732f, 0.64318037f},
-std::array<float,2>{0.392786413f, 0.936090708f},
-std::array<float,2>{0.874021053f, 0.318944216f},
-std::array<float,2>{0.358468294f, 0.397434026f},
-std::array<float,2>{0.955503166f, 0.777052581f},
-std::array<float,2>{0.163981333f, 0.58145833f},
-std::array<float,2>{0.647582769f, 0.0771190301f},
-std::array<float,2>{0.454336137f, 0.0139226085f},
-std::array<float,2>{0.774958491f, 0.549909174f},
-std::array<float,2>{0.106559813f, 0.832174599f},
-std::array<float,2>{0.565778732f, 0.487806112f},
-std::array<float,2>{0.197536916f, 0.269349813f},
-std::array<float,2>{0.705366075f, 0.997126341f},
-std::array<float,2>{0.275124252f, 0.70737195f},
-std::array<float,2>{0.915671289f, 0.138092995f},
-std::array<float,2>{0.124283612f, 0.0352705047f},
-std::array<float,2>{0.58744204f, 0.518201113f},
-std::array<float,2>{0.450261205f, 0.8624897f},
-std::array<float,2>{0.762822807f, 0.464461595f},
-std::array<float,2>{0.258107513f, 0.297929734f},
-std::array<float,2>{0.930473685f, 0.94553262f},
-std::array<float,2>{0.206390679f, 0.725383759f},
-std::array<float,2>{0.687742651f, 0.170879856f},
-std::array<float,2>{0.384089291f, 0.245550767f},
-std::array<float,2>{0.848247588f, 0.662808001f},
-std::array<float,2>{0.0362988263f, 0.893277228f},
-std::array<float,2>{0.522462785f, 0.354291409f},
-std::array<float,2>{0.172949925f, 0.416604549f},
-std::array<float,2>{0.634338439f, 0.787171721f},
-std::array<float,2>{0.369360059f, 0.621439278f},
-std::array<float,2>{0.937663019f, 0.11612656f},
-std::array<float,2>{0.24972634f, 0.145017028f},
-std::array<float,2>{0.738200188f, 0.687639892f},
-std::array<float,2>{0.296573132f, 0.972151101f},
-std::array<float,2>{0.889136672f, 0.254379779f},
-std::array<float,2>{0.491725922f, 0.477211952f},
-std::array<float,2>{0.807209849f, 0.826856315f},
-std::array<float,2>{0.0775685981f, 0.540061772f},
-std::array<float,2>{0.61147964f, 0.0303621106f},
-std::array<float,2>{0.318285018f, 0.0880121812f},
-std::array<float,2>{0.968916416f, 0.571187615f},
-std::array<float,2>{0.126875281f, 0.75484705f},
-std::array<float,2>{0.684932411f, 0.377624035f},
-std::array<float,2>{0.00707126968f, 0.342017055f},
-std::array<float,2>{0.54896605f, 0.916454315f},
-std::array<float,2>{0.407257944f, 0.63156116f},
-std::array<float,2>{0.823099256f, 0.212491691f},
-std::array<float,2>{0.214736745f, 0.0217056815f},
-std::array<float,2>{0.695498109f, 0.533250749f},
-std::array<float,2>{0.251275539f, 0.8152349f},
-std::array<float,2>{0.927951992f, 0.473827243f},
-std::array<float,2>{0.441008687f, 0.264781147f},
-std::array<float,2>{0.755536139f, 0.979169071f},
-std::array<float,2>{0.115813732f, 0.697212756f},
-std::array<float,2>{0.581393301f, 0.153212368f},
-std::array<float,2>{0.366160572f, 0.209594518f},
-std::array<float,2>{0.952797353f, 0.637398601f},
-std::array<float,2>{0.184921697f, 0.909672022f},
-std::array<float,2>{0.625491798f, 0.33409822f},
-std::array<float,2>{0.0412842147f, 0.388145357f},
-std::array<float,2>{0.530464411f, 0.76105386f},
-std::array<float,2>{0.378594726f, 0.563108444f},
-std::array<float,2>{0.857225418f, 0.0836905241f},
-std::array<float,2>{0.0673649609f, 0.161401957f},
-std::array<float,2>{0.623893499f, 0.733564913f},
-std::array<float,2>{0.498029172f, 0.942727685f},
-std::array<float,2>{0.802283406f, 0.308946908f},
-std::array<float,2>{0.28905347f, 0.460211754f},
-std::array<float,2>{0.877409637f, 0.871154845f},
-std::array<float,2>{0.235084385f, 0.524498999f},
-std::array<float,2>{0.749986172f, 0.0448612347f},
-std::array<float,2>{0.415506124f, 0.119098783f},
-std::array<float,2>{0.816772521f, 0.615743339f},
-std::array<float,2>{0.00982109644f, 0.795582235f},
-std::array<float,2>{0.557378113f, 0.408744276f},
-std::array<float,2>{0.135468945f, 0.3508766f},
-std::array<float,2>{0.676823139f, 0.901968718f},
-std::array<float,2>{0.321240425f, 0.66538322f},
-std::array<float,2>{0.976914644f, 0.234395847f},
-std::array<float,2>{0.0217450149f, 0.0640399009f},
-std::array<float,2>{0.536672115f, 0.592607915f},
-std::array<float,2>{0.425287098f, 0.771126807f},
-std::array<float,2>{0.836696029f, 0.404988676f},
-std::array<float,2>{0.331246823f, 0.32453993f},
-std::array<float,2>{0.993534446f, 0.927664161f},
-std::array<float,2>{0.154230595f, 0.654883087f},
-std::array<float,2>{0.66988939f, 0.19090803f},
-std::array<float,2>{0.469458759f, 0.130407542f},
-std::array<float,2>{0.794202328f, 0.712367296f},
-std::array<float,2>{0.0803964436f, 0.991122663f},
-std::array<float,2>{0.606485426f, 0.280071557f},
-std::array<float,2>{0.233543456f, 0.499610811f},
-std::array<float,2>{0.73129636f, 0.840282202f},
-std::array<float,2>{0.30591473f, 0.561245799f},
-std::array<float,2>{0.898128688f, 0.000177787282f},
-std::array<float,2>{0.169785663f, 0.22530748f},
-std::array<float,2>{0.656206787f, 0.680838525f},
-std::array<float,2>{0.343861699f, 0.88943845f},
-std::array<float,2>{0.961076796f, 0.371877015f},
-std::array<float,2>{0.401392043f, 0.426983356f},
-std::array<float,2>{0.861440778f, 0.806371629f},
-std::array<float,2>{0.0553432517f, 0.605664432f},
-std::array<float,2>{0.504995465f, 0.104624808f},
-std::array<float,2>{0.271638304f, 0.0556334965f},
-std::array<float,2>{0.912842572f, 0.50356406f},
-std::array<float,2>{0.194979593f, 0.856925368f},
-std::array<float,2>{0.713889778f, 0.447156221f},
-std::array<float,2>{0.0962142721f, 0.290598124f},
-std::array<float,2>{0.576772749f, 0.958075166f},
-std::array<float,2>{0.464313477f, 0.736790776f},
-std::array<float,2>{0.770541489f, 0.18408528f},
-std::array<float,2>{0.219937414f, 0.0805749819f},
-std::array<float,2>{0.721410573f, 0.570290685f},
-std::array<float,2>{0.304351568f, 0.761958003f},
-std::array<float,2>{0.900271833f, 0.383438587f},
-std::array<float,2>{0.477863848f, 0.330649018f},
-std::array<float,2>{0.787971079f, 0.912778258f},
-std::array<float,2>{0.091929853f, 0.636057615f},
-std::array<float,2>{0.601075232f, 0.20442006f},
-std::array<float,2>{0.343152583f, 0.150022179f},
-std::array<float,2>{0.991513431f, 0.701911271f},
-std::array<float,2>{0.143253058f, 0.983804762f},
-std::array<float,2>{0.662401617f, 0.261312813f},
-std::array<float,2>{0.023960894f, 0.472407132f},
-std::array<float,2>{0.543516934f, 0.819630504f},
-std::array<float,2>{0.433441401f, 0.537662268f},
-std::array<float,2>{0.832148314f, 0.0191215742f},
-std::array<float,2>{0.10377641f, 0.241034985f},
-std::array<float,2>{0.569979191f, 0.66913861f},
-std::array<float,2>{0.46028614f, 0.905347705f},
-std::array<float,2>{0.781066597f, 0.344705433f},
-std::array<float,2>{0.279257983f, 0.410164684f},
-std::array<float,2>{0.918255091f, 0.789144397f},
-std::array<float,2>{0.202089474f, 0.612825811f},
-std::array<float,2>{0.708343446f, 0.124694571f},
-std::array<float,2>{0.397451311f, 0.0407506414f},
-std::array<float,2>{0.870792091f, 0.52917856f},
-std::array<float,2>{0.0510189906f, 0.86730516f},
-std::array<float,2>{0.514579892f, 0.456897646f},
-std::array<float,2>{0.156351373f, 0.305306584f},
-std::array<float,2>{0.642367184f, 0.940467834f},
-std::array<float,2>{0.352602124f, 0.727308393f},
-std::array<float,2>{0.960471153f, 0.159780651f},
-std::array<float,2>{0.0343484506f, 0.00479140133f},
-std::array<float,2>{0.518924177f, 0.555223465f},
-std::array<float,2>{0.387543768f, 0.838212013f},
-std::array<float,2>{0.846482992f, 0.493785053f},
-std::array<float,2>{0.373239607f, 0.273583412f},
-std::array<float,2>{0.942535877f, 0.985941827f},
-std::array<float,2>{0.176640913f, 0.714937925f},
-std::array<float,2>{0.638144493f, 0.127131283f},
-std::array<float,2>{0.447676957f, 0.192393288f},
-std::array<float,2>{0.75962466f, 0.650982082f},
-std::array<float,2>{0.119476408f, 0.92250073f},
-std::array<float,2>{0.592483819f, 0.320729762f},
-std::array<float,2>{0.208190456f, 0.400287062f},
-std::array<float,2>{0.694811583f, 0.767465889f},
-std::array<float,2>{0.264006317f, 0.588647902f},
-std::array<float,2>{0.936089635f, 0.0669715852f},
-std::array<float,2>{0.132056683f, 0.180611402f},
-std::array<float,2>{0.682933807f, 0.740005493f},
-std::array<float,2>{0.314356863f, 0.955022812f},
-std::array<float,2>{0.976113498f, 0.293956488f},
-std::array<float,2>{0.412839502f, 0.452920258f},
-std::array<float,2>{0.825233519f, 0.851922929f},
-std::array<float,2>{0.00173868996f, 0.504309773f},
-std::array<float,2>{0.553713918f, 0.059252914f},
-std::array<float,2>{0.289249778f, 0.105842203f},
-std::array<float,2>{0.88668108f, 0.603825927f},
-std::array<float,2>{0.245601028f, 0.810900927f},
-std::array<float,2>{0.741306007f, 0.425118536f},
-std::array<float,2>{0.0732890442f, 0.369873792f},
-std::array<float,2>{0.61619556f, 0.883206367f},
-std::array<float,2>{0.484515935f, 0.685877442f},
-std::array<float,2>{0.810727417f, 0.220282942f},
-std::array<float,2>{0.181010947f, 0.0546773486f},
-std::array<float,2>{0.629879236f, 0.512376904f},
-std::array<float,2>{0.361379534f, 0.845383584f},
-std::array<float,2>{0.94622606f, 0.439248025f},
-std::array<float,2>{0.381738275f, 0.285891086f},
-std::array<float,2>{0.85268259f, 0.967169285f},
-std::array<float,2>{0.0442570858f, 0.74408561f},
-std::array<float,2>{0.527218163f, 0.172624752f},
-std::array<float,2>{0.257069737f, 0.232911766f},
-std::array<float,2>{0.921999812f, 0.67569381f},
-std::array<float,2>{0.217066333f, 0.876139283f},
-std::array<float,2>{0.700632274f, 0.364171952f},
-std::array<float,2>{0.112812124f, 0.434580326f},
-std::array<float,2>{0.585121572f, 0.7994017f},
-std::array<float,2>{0.443029165f, 0.600676179f},
-std::array<float,2>{0.753201306f, 0.0938249677f},
-std::array<float,2>{0.0125628393f, 0.135222659f},
-std::array<float,2>{0.55863595f, 0.703794897f},
-std::array<float,2>{0.419950485f, 0.992291212f},
-std::array<float,2>{0.812829852f, 0.273197979f},
-std::array<float,2>{0.32760638f, 0.491779357f},
-std::array<float,2>{0.980961025f, 0.828572035f},
-std::array<float,2>{0.137319967f, 0.551742554f},
-std::array<float,2>{0.673657f, 0.00938871875f},
-std::array<float,2>{0.49585247f, 0.0727289915f},
-std::array<float,2>{0.800595701f, 0.585360467f},
-std::array<float,2>{0.0648159683f, 0.781042933f},
-std::array<float,2>{0.618609369f, 0.390973121f},
-std::array<float,2>{0.238603652f, 0.312698096f},
-std::array<float,2>{0.745097756f, 0.931996167f},
-std::array<float,2>{0.282504141f, 0.644974053f},
-std::array<float,2>{0.880749226f, 0.198452741f},
-std::array<float,2>{0.08554212f, 0.112658858f},
-std::array<float,2>{0.603852212f, 0.621045172f},
-std::array<float,2>{0.47538358f, 0.781623006f},
-std::array<float,2>{0.789411008f, 0.420862734f},
-std::array<float,2>{0.311780453f, 0.355603963f},
-std::array<float,2>{0.892066181f, 0.895070255f},
-std::array<float,2>{0.22873567f, 0.658135712f},
-std::array<float,2>{0.729093015f, 0.24948886f},
-std::array<float,2>{0.426997393f, 0.167924359f},
-std::array<float,2>{0.841962337f, 0.721399188f},
-std::array<float,2>{0.0182722714f, 0.952636063f},
-std::array<float,2>{0.53313905f, 0.304618627f},
-std::array<float,2>{0.152112514f, 0.46744588f},
-std::array<float,2>{0.667248487f, 0.866115093f},
-std::array<float,2>{0.334942967f, 0.521246791f},
-std::array<float,2>{0.999405682f, 0.0351176411f},
-std::array<float,2>{0.188340113f, 0.215860948f},
-std::array<float,2>{0.71849829f, 0.626138568f},
-std::array<float,2>{0.266584039f, 0.919043124f},
-std::array<float,2>{0.909954131f, 0.336793154f},
-std::array<float,2>{0.465773851f, 0.382195443f},
-std::array<float,2>{0.767404556f, 0.750008762f},
-std::array<float,2>{0.0986165926f, 0.577803433f},
-std::array<float,2>{0.572946012f, 0.0922754109f},
-std::array<float,2>{0.3482216f, 0.0271198805f},
-std::array<float,2>{0.965637624f, 0.545572877f},
-std::array<float,2>{0.166200191f, 0.821061909f},
-std::array<float,2>{0.650948822f, 0.483042926f},
-std::array<float,2>{0.0620355718f, 0.251053214f},
-std::array<float,2>{0.501379728f, 0.974272728f},
-std::array<float,2>{0.403724879f, 0.692396164f},
-std::array<float,2>{0.865565479f, 0.141899869f},
-std::array<float,2>{0.175207973f, 0.116357192f},
-std::array<float,2>{0.636674404f, 0.622313976f},
-std::array<float,2>{0.368528754f, 0.789004147f},
-std::array<float,2>{0.940274477f, 0.41765511f},
-std::array<float,2>{0.386680961f, 0.355360627f},
-std::array<float,2>{0.849757671f, 0.893947959f},
-std::array<float,2>{0.0382317677f, 0.663581014f},
-std::array<float,2>{0.521424055f, 0.244746238f},
-std::array<float,2>{0.261114508f, 0.171507791f},
-std::array<float,2>{0.931937337f, 0.726100326f},
-std::array<float,2>{0.20445928f, 0.946833074f},
-std::array<float,2>{0.689866424f, 0.297442496f},
-std::array<float,2>{0.121422626f, 0.463661462f},
-std::array<float,2>{0.588505208f, 0.862060785f},
-std::array<float,2>{0.452838957f, 0.51937598f},
-std::array<float,2>{0.764926851f, 0.0362511352f},
-std::array<float,2>{0.00443562027f, 0.211387321f},
-std::array<float,2>{0.547047496f, 0.632241845f},
-std::array<float,2>{0.40873763f, 0.917239904f},
-std::array<float,2>{0.820372999f, 0.342779905f},
-std::array<float,2>{0.319573551f, 0.378663361f},
-std::array<float,2>{0.971758544f, 0.755052507f},
-std::array<float,2>{0.12799114f, 0.572055876f},
-std::array<float,2>{0.68689549f, 0.0890501514f},
-std::array<float,2>{0.488319039f, 0.0299662258f},
-std::array<float,2>{0.805342913f, 0.540010095f},
-std::array<float,2>{0.0750503018f, 0.828025937f},
-std::array<float,2>{0.611297488f, 0.478328168f},
-std::array<float,2>{0.246127248f, 0.255023688f},
-std::array<float,2>{0.734412372f, 0.97124511f},
-std::array<float,2>{0.294014573f, 0.689058542f},
-std::array<float,2>{0.888463616f, 0.145930067f},
-std::array<float,2>{0.0863129944f, 0.0470162779f},
-std::array<float,2>{0.594284117f, 0.511422753f},
-std::array<float,2>{0.482676655f, 0.849835992f},
-std::array<float,2>{0.783909559f, 0.442787409f},
-std::array<float,2>{0.298097461f, 0.283653587f},
-std::array<float,2>{0.902733445f, 0.964205921f},
-std::array<float,2>{0.223179638f, 0.749252379f},
-std::array<float,2>{0.725081325f, 0.178386778f},
-std::array<float,2>{0.436128289f, 0.227660984f},
-std::array<float,2>{0.832013547f, 0.67762661f},
-std::array<float,2>{0.02831042f, 0.881259918f},
-std::array<float,2>{0.542099416f, 0.362550825f},
-std::array<float,2>{0.14703919f, 0.429974765f},
-std::array<float,2>{0.659877837f, 0.801682949f},
-std::array<float,2>{0.338995337f, 0.5939399f},
-std::array<float,2>{0.988065481f, 0.0994482264f},
-std::array<float,2>{0.195752531f, 0.137066409f},
-std::array<float,2>{0.703150392f, 0.70870924f},
-std::array<float,2>{0.276190341f, 0.996366382f},
-std::array<float,2>{0.917659998f, 0.268246263f},
-std::array<float,2>{0.455557644f, 0.486890107f},
-std::array<float,2>{0.776434243f, 0.833008587f},
-std::array<float,2>{0.109221838f, 0.549055636f},
-std::array<float,2>{0.562654972f, 0.0155667644f},
-std::array<float,2>{0.355827302f, 0.0777861103f},
-std::array<float,2>{0.953898728f, 0.580480218f},
-std::array<float,2>{0.161346421f, 0.77552861f},
-std::array<float,2>{0.646270692f, 0.397585988f},
-std::array<float,2>{0.0496673398f, 0.319687843f},
-std::array<float,2>{0.510769486f, 0.937047899f},
-std::array<float,2>{0.39202112f, 0.643960238f},
-std::array<float,2>{0.871498406f, 0.201477751f},
-std::array<float,2>{0.231193319f, 0.00106747414f},
-std::array<float,2>{0.732972503f, 0.561812997f},
-std::array<float,2>{0.307754189f, 0.841708601f},
-std::array<float,2>{0.894827068f, 0.498663783f},
-std::array<float,2>{0.471040666f, 0.280747712f},
-std::array<float,2>{0.795752466f, 0.991942406f},
-std::array<float,2>{0.0785193667f, 0.711719811f},
-std::array<float,2>{0.608486474f, 0.129053667f},
-std::array<float,2>{0.328239441f, 0.190327018f},
-std::array<float,2>{0.99430424f, 0.655319631f},
-std::array<float,2>{0.155513391f, 0.926401615f},
-std::array<float,2>{0.671433985f, 0.325246096f},
-std::array<float,2>{0.0205674116f, 0.406194091f},
-std::array<float,2>{0.53851378f, 0.770106018f},
-std::array<float,2>{0.422531039f, 0.593300164f},
-std::array<float,2>{0.838534951f, 0.0628896132f},
-std::array<float,2>{0.0938095003f, 0.184851184f},
-std::array<float,2>{0.574941695f, 0.737937331f},
-std::array<float,2>{0.462553382f, 0.957967281f},
-std::array<float,2>{0.772830427f, 0.289488614f},
-std::array<float,2>{0.269802064f, 0.445345461f},
-std::array<float,2>{0.910372019f, 0.856039345f},
-std::array<float,2>{0.193064153f, 0.502879918f},
-std::array<float,2>{0.711883664f, 0.0557105094f},
-std::array<float,2>{0.400319427f, 0.104318574f},
-std::array<float,2>{0.85992384f, 0.607064426f},
-std::array<float,2>{0.0577979386f, 0.804912508f},
-std::array<float,2>{0.505863786f, 0.426269352f},
-std::array<float,2>{0.171441212f, 0.372481346f},
-std::array<float,2>{0.654101133f, 0.890288651f},
-std::array<float,2>{0.346722007f, 0.680457711f},
-std::array<float,2>{0.963671029f, 0.226101771f},
-std::array<float,2>{0.0403900556f, 0.0823631957f},
-std::array<float,2>{0.529080689f, 0.564066052f},
-std::array<float,2>{0.375756711f, 0.759931087f},
-std::array<float,2>{0.858587563f, 0.386950523f},
-std::array<float,2>{0.363382608f, 0.335918158f},
-std::array<float,2>{0.949810684f, 0.908739567f},
-std::array<float,2>{0.186968833f, 0.63798219f},
-std::array<float,2>{0.628589511f, 0.210254803f},
-std::array<float,2>{0.43864128f, 0.154075786f},
-std::array<float,2>{0.756584227f, 0.695451736f},
-std::array<float,2>{0.113315895f, 0.979797959f},
-std::array<float,2>{0.578783929f, 0.26432389f},
-std::array<float,2>{0.211335704f, 0.473545581f},
-std::array<float,2>{0.698995769f, 0.815897703f},
-std::array<float,2>{0.253169984f, 0.534880757f},
-std::array<float,2>{0.92735821f, 0.0227578506f},
-std::array<float,2>{0.13398914f, 0.235723242f},
-std::array<float,2>{0.678557336f, 0.664143801f},
-std::array<float,2>{0.3225618f, 0.900735378f},
-std::array<float,2>{0.979388654f, 0.349891484f},
-std::array<float,2>{0.417119503f, 0.410152465f},
-std::array<float,2>{0.819565654f, 0.796466112f},
-std::array<float,2>{0.00966516975f, 0.616524696f},
-std::array<float,2>{0.556165874f, 0.117291391f},
-std::array<float,2>{0.287060291f, 0.0439199209f},
-std::array<float,2>{0.876906574f, 0.523897171f},
-std::array<float,2>{0.236420706f, 0.872160435f},
-std::array<float,2>{0.746973336f, 0.459302038f},
-std::array<float,2>{0.0698661879f, 0.31039837f},
-std::array<float,2>{0.621902525f, 0.941733062f},
-std::array<float,2>{0.498330474f, 0.732424438f},
-std::array<float,2>{0.803566277f, 0.160417587f},
-std::array<float,2>{0.21081695f, 0.0674099699f},
-std::array<float,2>{0.693113327f, 0.589812756f},
-std::array<float,2>{0.262798339f, 0.766222715f},
-std::array<float,2>{0.935354471f, 0.398906261f},
-std::array<float,2>{0.446608365f, 0.321754813f},
-std::array<float,2>{0.75996238f, 0.92365098f},
-std::array<float,2>{0.11827261f, 0.651540101f},
-std::array<float,2>{0.590461373f, 0.19215256f},
-std::array<float,2>{0.372417778f, 0.128752828f},
-std::array<float,2>{0.943843484f, 0.716244519f},
-std::array<float,2>{0.178924307f, 0.984905541f},
-std::array<float,2>{0.63867414f, 0.275231868f},
-std::array<float,2>{0.0326274373f, 0.492307216f},
-std::array<float,2>{0.51586324f, 0.839521646f},
-std::array<float,2>{0.390280992f, 0.55618751f},
-std::array<float,2>{0.844120681f, 0.00499187224f},
-std::array<float,2>{0.0709655434f, 0.219307065f},
-std::array<float,2>{0.615080535f, 0.686771452f},
-std::array<float,2>{0.487541765f, 0.884507f},
-std::array<float,2>{0.810060203f, 0.370894521f},
-std::array<float,2>{0.292894453f, 0.42407012f},
-std::array<float,2>{0.883691549f, 0.81246537f},
-std::array<float,2>{0.242660418f, 0.605104029f},
-std::array<float,2>{0.739279687f, 0.107382283f},
-std::array<float,2>{0.410532564f, 0.0601421036f},
-std::array<float,2>{0.826321781f, 0.505264401f},
-std::array<float,2>{0.00197820412f, 0.85283041f},
-std::array<float,2>{0.551892996f, 0.452130377f},
-std::array<float,2>{0.129804745f, 0.293575615f},
-std::array<float,2>{0.680811942f, 0.953777134f},
-std::array<float,2>{0.31487003f, 0.738381267f},
-std::array<float,2>{0.973663867f, 0.181015491f},
-std::array<float,2>{0.0265473723f, 0.0182655863f},
-std::array<float,2>{0.545774102f, 0.538202107f},
-std::array<float,2>{0.43098554f, 0.819086909f},
-std::array<float,2>{0.835276783f, 0.471364081f},
-std::array<float,2>{0.341643244f, 0.259813249f},
-std::array<float,2>{0.990203738f, 0.983005822f},
-std::array<float,2>{0.141028821f, 0.702510655f},
-std::array<float,2>{0.661120951f, 0.148695007f},
-std::array<float,2>{0.479259461f, 0.203811899f},
-std::array<float,2>{0.785380661f, 0.635502756f},
-std::array<float,2>{0.0914820507f, 0.914038658f},
-std::array<float,2>{0.598870158f, 0.331510663f},
-std::array<float,2>{0.221663639f, 0.384052455f},
-std::array<float,2>{0.719717205f, 0.7635203f},
-std::array<float,2>{0.301307976f, 0.569167972f},
-std::array<float,2>{0.900678873f, 0.0819676444f},
-std::array<float,2>{0.159474537f, 0.159067407f},
-std::array<float,2>{0.643311501f, 0.727729619f},
-std::array<float,2>{0.354965299f, 0.939638793f},
-std::array<float,2>{0.958465695f, 0.305708498f},
-std::array<float,2>{0.394590825f, 0.456044644f},
-std::array<float,2>{0.869006932f, 0.868654072f},
-std::array<float,2>{0.0530707724f, 0.528301418f},
-std::array<float,2>{0.512904406f, 0.0398972034f},
-std::array<float,2>{0.280941486f, 0.123723648f},
-std::array<float,2>{0.920769632f, 0.611998916f},
-std::array<float,2>{0.199467063f, 0.790130496f},
-std::array<float,2>{0.709744811f, 0.41151166f},
-std::array<float,2>{0.102551334f, 0.344730169f},
-std::array<float,2>{0.567328751f, 0.904406965f},
-std::array<float,2>{0.458068192f, 0.668140888f},
-std::array<float,2>{0.778639376f, 0.241576836f},
-std::array<float,2>{0.149972185f, 0.0339163058f},
-std::array<float,2>{0.664722145f, 0.520056009f},
-std::array<float,2>{0.333293706f, 0.866424203f},
-std::array<float,2>{0.996543348f, 0.468606502f},
-std::array<float,2>{0.429384142f, 0.303057522f},
-std::array<float,2>{0.840299428f, 0.951848626f},
-std::array<float,2>{0.0166358035f, 0.721888363f},
-std::array<float,2>{0.533790588f, 0.166231304f},
-std::array<float,2>{0.310192287f, 0.248389602f},
-std::array<float,2>{0.894446254f, 0.656758726f},
-std::array<float,2>{0.227787286f, 0.89584291f},
-std::array<float,2>{0.727464378f, 0.357210129f},
-std::array<float,2>{0.0830538124f, 0.42166692f},
-std::array<float,2>{0.603001177f, 0.782564223f},
-std::array<float,2>{0.472999394f, 0.619421363f},
-std::array<float,2>{0.791952312f, 0.11220406f},
-std::array<float,2>{0.0588177107f, 0.14159517f},
-std::array<float,2>{0.502724051f, 0.692149639f},
-std::array<float,2>{0.405227244f, 0.973547935f},
-std::array<float,2>{0.865013838f, 0.250776529f},
-std::array<float,2>{0.349911898f, 0.484354258f},
-std::array<float,2>{0.96821636f, 0.822060943f},
-std::array<float,2>{0.164864555f, 0.546327591f},
-std::array<float,2>{0.648955762f, 0.0255825352f},
-std::array<float,2>{0.4674007f, 0.0930948108f},
-std::array<float,2>{0.769393742f, 0.576378167f},
-std::array<float,2>{0.100389823f, 0.751616657f},
-std::array<float,2>{0.570647418f, 0.381472647f},
-std::array<float,2>{0.191108733f, 0.337351382f},
-std::array<float,2>{0.715117812f, 0.918719292f},
-std::array<float,2>{0.268391013f, 0.625428617f},
-std::array<float,2>{0.907235861f, 0.215511709f},
-std::array<float,2>{0.109566577f, 0.0948634669f},
-std::array<float,2>{0.582177103f, 0.600161493f},
-std::array<float,2>{0.443398714f, 0.80020833f},
-std::array<float,2>{0.751571596f, 0.434295893f},
-std::array<float,2>{0.255131215f, 0.3651205f},
-std::array<float,2>{0.925068736f, 0.875253975f},
-std::array<float,2>{0.216259107f, 0.674457431f},
-std::array<float,2>{0.702151954f, 0.233599007f},
-std::array<float,2>{0.379240036f, 0.173378512f},
-std::array<float,2>{0.854522824f, 0.742772281f},
-std::array<float,2>{0.046531219f, 0.967972934f},
-std::array<float,2>{0.52448529f, 0.286922038f},
-std::array<float,2>{0.183420405f, 0.43831414f},
-std::array<float,2>{0.631159067f, 0.843897462f},
-std::array<float,2>{0.360170066f, 0.513403237f},
-std::array<float,2>{0.947329879f, 0.052742444f},
-std::array<float,2>{0.240433797f, 0.197874948f},
-std::array<float,2>{0.74231261f, 0.645867288f},
-std::array<float,2>{0.284018636f, 0.933392465f},
-std::array<float,2>{0.881272137f, 0.313961893f},
-std::array<float,2>{0.492868334f, 0.392163008f},
-std::array<float,2>{0.797935128f, 0.7796489f},
-std::array<float,2>{0.0636732131f, 0.584334373f},
-std::array<float,2>{0.619621277f, 0.0733159706f},
-std::array<float,2>{0.324913442f, 0.00816706941f},
-std::array<float,2>{0.982941091f, 0.552196443f},
-std::array<float,2>{0.138806507f, 0.829964399f},
-std::array<float,2>{0.675023675f, 0.490281969f},
-std::array<float,2>{0.015395009f, 0.272132993f},
-std::array<float,2>{0.560832798f, 0.993823826f},
-std::array<float,2>{0.41891709f, 0.70434773f},
-std::array<float,2>{0.815342128f, 0.135923147f},
-std::array<float,2>{0.125549167f, 0.0878872126f},
-std::array<float,2>{0.683946669f, 0.573806167f},
-std::array<float,2>{0.317197889f, 0.757522643f},
-std::array<float,2>{0.969925284f, 0.376571149f},
-std::array<float,2>{0.406910241f, 0.340576112f},
-std::array<float,2>{0.82395786f, 0.91538769f},
-std::array<float,2>{0.00678252289f, 0.629313767f},
-std::array<float,2>{0.550245225f, 0.214182302f},
-std::array<float,2>{0.295138925f, 0.146817654f},
-std::array<float,2>{0.890548587f, 0.690434933f},
-std::array<float,2>{0.248782158f, 0.97043103f},
-std::array<float,2>{0.736550212f, 0.255895585f},
-std::array<float,2>{0.0762153417f, 0.479926854f},
-std::array<float,2>{0.613216102f, 0.82440871f},
-std::array<float,2>{0.490516722f, 0.542204142f},
-std::array<float,2>{0.807942212f, 0.0282104686f},
-std::array<float,2>{0.0353796147f, 0.243893445f},
-std::array<float,2>{0.521570146f, 0.660544634f},
-std::array<float,2>{0.382922441f, 0.891229451f},
-std::array<float,2>{0.849314749f, 0.351851374f},
-std::array<float,2>{0.370981842f, 0.41485709f},
-std::array<float,2>{0.938555241f, 0.786786914f},
-std::array<float,2>{0.172094405f, 0.623993158f},
-std::array<float,2>{0.63326478f, 0.113589622f},
-std::array<float,2>{0.449391186f, 0.0376606062f},
-std::array<float,2>{0.761883378f, 0.517300606f},
-std::array<float,2>{0.123530418f, 0.860111535f},
-std::array<float,2>{0.585996926f, 0.462191194f},
-std::array<float,2>{0.205695942f, 0.299399018f},
-std::array<float,2>{0.688822806f, 0.947874904f},
-std::array<float,2>{0.259123445f, 0.723764241f},
-std::array<float,2>{0.930752814f, 0.168658003f},
-std::array<float,2>{0.105815277f, 0.0129620209f},
-std::array<float,2>{0.564925253f, 0.54732579f},
-std::array<float,2>{0.453170925f, 0.834312201f},
-std::array<float,2>{0.77403307f, 0.4848575f},
-std::array<float,2>{0.273993164f, 0.267305642f},
-std::array<float,2>{0.914617121f, 0.998464167f},
-std::array<float,2>{0.198884949f, 0.710104644f},
-std::array<float,2>{0.706800818f, 0.139724344f},
-std::array<float,2>{0.394234121f, 0.199433312f},
-std::array<float,2>{0.874087095f, 0.640822768f},
-std::array<float,2>{0.0482873917f, 0.935168505f},
-std::array<float,2>{0.509112358f, 0.317286253f},
-std::array<float,2>{0.162988976f, 0.3958202f},
-std::array<float,2>{0.647280753f, 0.775238574f},
-std::array<float,2>{0.357509494f, 0.57870996f},
-std::array<float,2>{0.956378639f, 0.0748184547f},
-std::array<float,2>{0.225379214f, 0.175973892f},
-std::array<float,2>{0.723485947f, 0.74642247f},
-std::array<float,2>{0.299238384f, 0.962682545f},
-std::array<float,2>{0.90440321f, 0.282434672f},
-std::array<float,2>{0.481221795f, 0.443519801f},
-std::array<float,2>{0.782807648f, 0.8487674f},
-std::array<float,2>{0.0882405043f, 0.508581936f},
-std::array<float,2>{0.59699285f, 0.0507572666f},
-std::array<float,2>{0.337216645f, 0.100074239f},
-std::array<float,2>{0.985010803f, 0.596002936f},
-std::array<float,2>{0.144994482f, 0.804195821f},
-std::array<float,2>{0.657523394f, 0.433582485f},
-std::array<float,2>{0.0308548119f, 0.360498428f},
-std::array<float,2>{0.539865136f, 0.880612612f},
-std::array<float,2>{0.433914721f, 0.678326488f},
-std::array<float,2>{0.828441262f, 0.228561535f},
-std::array<float,2>{0.194248259f, 0.058303684f},
-std::array<float,2>{0.712949753f, 0.500255048f},
-std::array<float,2>{0.273218989f, 0.85888952f},
-std::array<float,2>{0.913760185f, 0.44738695f},
-std::array<float,2>{0.463807583f, 0.291354716f},
-std::array<float,2>{0.769883573f, 0.960487068f},
-std::array<float,2>{0.0974649861f, 0.736115098f},
-std::array<float,2>{0.577267408f, 0.186452389f},
-std::array<float,2>{0.345113337f, 0.222763181f},
-std::array<float,2>{0.962643802f, 0.682210863f},
-std::array<float,2>{0.168776885f, 0.8873384f},
-std::array<float,2>{0.65489608f, 0.37320587f},
-std::array<float,2>{0.0564171337f, 0.428226382f},
-std::array<float,2>{0.503955126f, 0.806919575f},
-std::array<float,2>{0.400444657f, 0.607716024f},
-std::array<float,2>{0.862831652f, 0.103124596f},
-std::array<float,2>{0.0816664323f, 0.132711634f},
-std::array<float,2>{0.605592906f, 0.714697063f},
-std::array<float,2>{0.470088989f, 0.989607751f},
-std::array<float,2>{0.79308337f, 0.278011024f},
-std::array<float,2>{0.304761559f, 0.496482074f},
-std::array<float,2>{0.897347093f, 0.842727602f},
-std::array<float,2>{0.233186349f, 0.56043309f},
-std::array<float,2>{0.731856585f, 0.00381486211f},
-std::array<float,2>{0.424709946f, 0.065671511f},
-std::array<float,2>{0.837148249f, 0.591136634f},
-std::array<float,2>{0.022885358f, 0.773249865f},
-std::array<float,2>{0.53549093f, 0.402952582f},
-std::array<float,2>{0.15265651f, 0.327726007f},
-std::array<float,2>{0.667979479f, 0.929193258f},
-std::array<float,2>{0.330781281f, 0.65398854f},
-std::array<float,2>{0.992878556f, 0.188065797f},
-std::array<float,2>{0.0110888481f, 0.120868005f},
-std::array<float,2>{0.55793494f, 0.614838421f},
-std::array<float,2>{0.414308935f, 0.794351399f},
-std::array<float,2>{0.817414522f, 0.407944947f},
-std::array<float,2>{0.321483821f, 0.349565715f},
-std::array<float,2>{0.978437841f, 0.898900092f},
-std::array<float,2>{0.136332288f, 0.667403996f},
-std::array<float,2>{0.676162779f, 0.237523913f},
-std::array<float,2>{0.496317238f, 0.163322404f},
-std::array<float,2>{0.801281214f, 0.73153764f},
-std::array<float,2>{0.0678499341f, 0.944530666f},
-std::array<float,2>{0.624571443f, 0.312250882f},
-std::array<float,2>{0.235541418f, 0.458843857f},
-std::array<float,2>{0.748189151f, 0.874012828f},
-std::array<float,2>{0.287388235f, 0.526257873f},
-std::array<float,2>{0.878573239f, 0.0454558022f},
-std::array<float,2>{0.18437472f, 0.208816931f},
-std::array<float,2>{0.626806676f, 0.640070379f},
-std::array<float,2>{0.366354406f, 0.907200038f},
-std::array<float,2>{0.951697946f, 0.332961112f},
-std::array<float,2>{0.377843112f, 0.389453977f},
-std::array<float,2>{0.856118381f, 0.758684278f},
-std::array<float,2>{0.0428236462f, 0.566004932f},
-std::array<float,2>{0.529916406f, 0.0840547234f},
-std::array<float,2>{0.250785679f, 0.019683497f},
-std::array<float,2>{0.92915225f, 0.531594694f},
-std::array<float,2>{0.213506341f, 0.81443578f},
-std::array<float,2>{0.696924388f, 0.476369739f},
-std::array<float,2>{0.116864569f, 0.261856437f},
-std::array<float,2>{0.580442488f, 0.978430808f},
-std::array<float,2>{0.439464033f, 0.697291672f},
-std::array<float,2>{0.754879475f, 0.154664487f},
-std::array<float,2>{0.244188979f, 0.108938828f},
-std::array<float,2>{0.740699828f, 0.601914346f},
-std::array<float,2>{0.290310055f, 0.810074925f},
-std::array<float,2>{0.885013819f, 0.423135519f},
-std::array<float,2>{0.486245215f, 0.368841469f},
-std::array<float,2>{0.812162757f, 0.884900331f},
-std::array<float,2>{0.0730237439f, 0.683800399f},
-std::array<float,2>{0.61685282f, 0.222638771f},
-std::array<float,2>{0.313274205f, 0.183040455f},
-std::array<float,2>{0.974728763f, 0.741183698f},
-std::array<float,2>{0.13155745f, 0.956472516f},
-std::array<float,2>{0.682048202f, 0.296724796f},
-std::array<float,2>{0.000687227177f, 0.449590862f},
-std::array<float,2>{0.553210795f, 0.854925275f},
-std::array<float,2>{0.413896143f, 0.50610441f},
-std::array<float,2>{0.824315071f, 0.0611724928f},
-std::array<float,2>{0.120842129f, 0.193946883f},
-std::array<float,2>{0.592796504f, 0.650216758f},
-std::array<float,2>{0.44896251f, 0.924280167f},
-std::array<float,2>{0.757888377f, 0.323617041f},
-std::array<float,2>{0.265023977f, 0.401610553f},
-std::array<float,2>{0.937066257f, 0.767919123f},
-std::array<float,2>{0.207728952f, 0.586947501f},
-std::array<float,2>{0.693942666f, 0.0686209723f},
-std::array<float,2>{0.387742788f, 0.00605686195f},
-std::array<float,2>{0.847648799f, 0.557310402f},
-std::array<float,2>{0.0334376618f, 0.836041689f},
-std::array<float,2>{0.518392324f, 0.494392931f},
-std::array<float,2>{0.17715086f, 0.276575297f},
-std::array<float,2>{0.636975646f, 0.987614393f},
-std::array<float,2>{0.374439299f, 0.718229294f},
-std::array<float,2>{0.941741824f, 0.125123367f},
-std::array<float,2>{0.0524339825f, 0.0413296036f},
-std::array<float,2>{0.514703393f, 0.52980417f},
-std::array<float,2>{0.397954673f, 0.870366871f},
-std::array<float,2>{0.869429767f, 0.454131365f},
-std::array<float,2>{0.352338254f, 0.306883931f},
-std::array<float,2>{0.959530473f, 0.938911498f},
-std::array<float,2>{0.15759179f, 0.72978282f},
-std::array<float,2>{0.641247392f, 0.156299129f},
-std::array<float,2>{0.459594786f, 0.239725485f},
-std::array<float,2>{0.779888093f, 0.670212686f},
-std::array<float,2>{0.105411142f, 0.902365804f},
-std::array<float,2>{0.569335699f, 0.347554743f},
-std::array<float,2>{0.202746317f, 0.413555712f},
-std::array<float,2>{0.707929552f, 0.792800605f},
-std::array<float,2>{0.277433306f, 0.610551953f},
-std::array<float,2>{0.919466555f, 0.122761123f},
-std::array<float,2>{0.143570974f, 0.151068851f},
-std::array<float,2>{0.663968503f, 0.700787008f},
-std::array<float,2>{0.342267722f, 0.981785476f},
-std::array<float,2>{0.991004586f, 0.259186417f},
-std::array<float,2>{0.431803614f, 0.469986409f},
-std::array<float,2>{0.833254218f, 0.816874325f},
-std::array<float,2>{0.0251534171f, 0.535483301f},
-std::array<float,2>{0.544536233f, 0.0165991616f},
-std::array<float,2>{0.303589076f, 0.0796072558f},
-std::array<float,2>{0.899148107f, 0.567160845f},
-std::array<float,2>{0.219143018f, 0.763926864f},
-std::array<float,2>{0.722292125f, 0.385522157f},
-std::array<float,2>{0.093593426f, 0.328265667f},
-std::array<float,2>{0.600410461f, 0.911852419f},
-std::array<float,2>{0.47690022f, 0.634557307f},
-std::array<float,2>{0.788126051f, 0.206297472f},
-std::array<float,2>{0.167429209f, 0.0239687432f},
-std::array<float,2>{0.651465058f, 0.54447782f},
-std::array<float,2>{0.349347591f, 0.824006617f},
-std::array<float,2>{0.966561794f, 0.481894284f},
-std::array<float,2>{0.402395934f, 0.252798796f},
-std::array<float,2>{0.866859078f, 0.974916041f},
-std::array<float,2>{0.0612296276f, 0.694313705f},
-std::array<float,2>{0.500837266f, 0.143364221f},
-std::array<float,2>{0.266791403f, 0.217336789f},
-std::array<float,2>{0.908862531f, 0.628624141f},
-std::array<float,2>{0.188895956f, 0.921579242f},
-std::array<float,2>{0.7176916f, 0.339065969f},
-std::array<float,2>{0.0989999101f, 0.380170375f},
-std::array<float,2>{0.574047565f, 0.753609478f},
-std::array<float,2>{0.46676746f, 0.5755108f},
-std::array<float,2>{0.766218483f, 0.0900519118f},
-std::array<float,2>{0.0190049037f, 0.164468899f},
-std::array<float,2>{0.53188026f, 0.720009863f},
-std::array<float,2>{0.426505327f, 0.9505319f},
-std::array<float,2>{0.843443394f, 0.302467644f},
-std::array<float,2>{0.335536122f, 0.46529603f},
-std::array<float,2>{0.998909414f, 0.863427281f},
-std::array<float,2>{0.151266143f, 0.521747947f},
-std::array<float,2>{0.666963577f, 0.0331046693f},
-std::array<float,2>{0.476421416f, 0.110688619f},
-std::array<float,2>{0.790425181f, 0.618707418f},
-std::array<float,2>{0.0842866525f, 0.784251869f},
-std::array<float,2>{0.604957998f, 0.418422908f},
-std::array<float,2>{0.229713678f, 0.35879156f},
-std::array<float,2>{0.729552746f, 0.898097813f},
-std::array<float,2>{0.310904115f, 0.658567905f},
-std::array<float,2>{0.891057491f, 0.247228876f},
-std::array<float,2>{0.0659976229f, 0.0715998411f},
-std::array<float,2>{0.617839456f, 0.583830535f},
-std::array<float,2>{0.494622529f, 0.778232396f},
-std::array<float,2>{0.799459875f, 0.393437505f},
-std::array<float,2>{0.281824201f, 0.31592235f},
-std::array<float,2>{0.879264414f, 0.930705249f},
-std::array<float,2>{0.239518628f, 0.646565557f},
-std::array<float,2>{0.745663524f, 0.196356639f},
-std::array<float,2>{0.421598315f, 0.134337634f},
-std::array<float,2>{0.813737214f, 0.706556261f},
-std::array<float,2>{0.0127606681f, 0.994657218f},
-std::array<float,2>{0.560430169f, 0.270056397f},
-std::array<float,2>{0.137845173f, 0.490062356f},
-std::array<float,2>{0.671938539f, 0.831701159f},
-std::array<float,2>{0.326528043f, 0.553874433f},
-std::array<float,2>{0.98153311f, 0.0101576075f},
-std::array<float,2>{0.2184297f, 0.231772825f},
-std::array<float,2>{0.699969411f, 0.672514498f},
-std::array<float,2>{0.256629169f, 0.878469586f},
-std::array<float,2>{0.923609853f, 0.365537971f},
-std::array<float,2>{0.44142741f, 0.436190635f},
-std::array<float,2>{0.751969397f, 0.798013687f},
-std::array<float,2>{0.111667767f, 0.598069072f},
-std::array<float,2>{0.584478438f, 0.0962002575f},
-std::array<float,2>{0.362542272f, 0.0526317358f},
-std::array<float,2>{0.946564436f, 0.515431404f},
-std::array<float,2>{0.179752707f, 0.846216083f},
-std::array<float,2>{0.630771935f, 0.44023484f},
-std::array<float,2>{0.0432514586f, 0.288889766f},
-std::array<float,2>{0.526100516f, 0.965856314f},
-std::array<float,2>{0.382115752f, 0.745006263f},
-std::array<float,2>{0.851788759f, 0.17382893f},
-std::array<float,2>{0.187297553f, 0.084565416f},
-std::array<float,2>{0.62837863f, 0.565713704f},
-std::array<float,2>{0.364082962f, 0.758190513f},
-std::array<float,2>{0.949632347f, 0.389108092f},
-std::array<float,2>{0.375297606f, 0.33246693f},
-std::array<float,2>{0.859034419f, 0.906569123f},
-std::array<float,2>{0.0408663414f, 0.640610039f},
-std::array<float,2>{0.528546035f, 0.20824267f},
-std::array<float,2>{0.253512353f, 0.154995084f},
-std::array<float,2>{0.926888764f, 0.697984874f},
-std::array<float,2>{0.211819828f, 0.977911592f},
-std::array<float,2>{0.69854784f, 0.262497008f},
-std::array<float,2>{0.11422956f, 0.47606954f},
-std::array<float,2>{0.578480959f, 0.813956738f},
-std::array<float,2>{0.439183444f, 0.532123685f},
-std::array<float,2>{0.755924642f, 0.0200776644f},
-std::array<float,2>{0.00919070654f, 0.238108635f},
-std::array<float,2>{0.555846512f, 0.667967975f},
-std::array<float,2>{0.417600125f, 0.89912498f},
-std::array<float,2>{0.820260644f, 0.348718107f},
-std::array<float,2>{0.323208123f, 0.407573879f},
-std::array<float,2>{0.9785586f, 0.794822812f},
-std::array<float,2>{0.134736136f, 0.614385247f},
-std::array<float,2>{0.677749991f, 0.120246567f},
-std::array<float,2>{0.498774171f, 0.0453821272f},
-std::array<float,2>{0.803017914f, 0.525837183f},
-std::array<float,2>{0.0697558597f, 0.873282433f},
-std::array<float,2>{0.621178865f, 0.458416551f},
-std::array<float,2>{0.23705475f, 0.311996669f},
-std::array<float,2>{0.74623239f, 0.945040882f},
-std::array<float,2>{0.286471397f, 0.731991351f},
-std::array<float,2>{0.876061618f, 0.163695589f},
-std::array<float,2>{0.0787328929f, 0.00294501078f},
-std::array<float,2>{0.6088925f, 0.559979081f},
-std::array<float,2>{0.471324891f, 0.841856241f},
-std::array<float,2>{0.795372546f, 0.497032166f},
-std::array<float,2>{0.308240473f, 0.27773717f},
-std::array<float,2>{0.895175636f, 0.989854395f},
-std::array<float,2>{0.230551988f, 0.713938296f},
-std::array<float,2>{0.732901752f, 0.132262245f},
-std::array<float,2>{0.422360539f, 0.187522471f},
-std::array<float,2>{0.838007987f, 0.65377748f},
-std::array<float,2>{0.0210056975f, 0.929549575f},
-std::array<float,2>{0.538895905f, 0.327302247f},
-std::array<float,2>{0.1558429f, 0.402392983f},
-std::array<float,2>{0.67123276f, 0.772837579f},
-std::array<float,2>{0.328891933f, 0.591369212f},
-std::array<float,2>{0.995068491f, 0.0662821233f},
-std::array<float,2>{0.192782745f, 0.185614228f},
-std::array<float,2>{0.71125263f, 0.735420704f},
-std::array<float,2>{0.270253628f, 0.960080743f},
-std::array<float,2>{0.911131322f, 0.291759759f},
-std::array<float,2>{0.462358922f, 0.447842181f},
-std::array<float,2>{0.773083746f, 0.858835161f},
-std::array<float,2>{0.0946806297f, 0.500571012f},
-std::array<float,2>{0.574281931f, 0.0579370819f},
-std::array<float,2>{0.347593546f, 0.102966085f},
-std::array<float,2>{0.963163972f, 0.608351231f},
-std::array<float,2>{0.171221152f, 0.807164848f},
-std::array<float,2>{0.653436542f, 0.428013235f},
-std::array<float,2>{0.0585742928f, 0.3736341f},
-std::array<float,2>{0.506456912f, 0.887192249f},
-std::array<float,2>{0.399893761f, 0.681729078f},
-std::array<float,2>{0.859542489f, 0.22345981f},
-std::array<float,2>{0.222979501f, 0.0499242917f},
-std::array<float,2>{0.725206017f, 0.507931888f},
-std::array<float,2>{0.298656851f, 0.849305272f},
-std::array<float,2>{0.903107941f, 0.443888515f},
-std::array<float,2>{0.483052433f, 0.282938302f},
-std::array<float,2>{0.783494055f, 0.962118804f},
-std::array<float,2>{0.0869134068f, 0.746882141f},
-std::array<float,2>{0.593840718f, 0.176658556f},
-std::array<float,2>{0.339810073f, 0.229404956f},
-std::array<float,2>{0.98772645f, 0.678123474f},
-std::array<float,2>{0.146786675f, 0.880123556f},
-std::array<float,2>{0.659431398f, 0.361243695f},
-std::array<float,2>{0.0274457112f, 0.432800472f},
-std::array<float,2>{0.54254353f, 0.804392278f},
-std::array<float,2>{0.435678899f, 0.596346915f},
-std::array<float,2>{0.831116796f, 0.100429133f},
-std::array<float,2>{0.108606167f, 0.140331954f},
-std::array<float,2>{0.563297987f, 0.710720062f},
-std::array<float,2>{0.45602119f, 0.998812616f},
-std::array<float,2>{0.777041554f, 0.266840309f},
-std::array<float,2>{0.275512457f, 0.485161573f},
-std::array<float,2>{0.917237997f, 0.834955335f},
-std::array<float,2>{0.196186826f, 0.547726512f},
-std::array<float,2>{0.704039276f, 0.0132630207f},
-std::array<float,2>{0.392172873f, 0.074586764f},
-std::array<float,2>{0.871730864f, 0.578175902f},
-std::array<float,2>{0.0489705652f, 0.774556458f},
-std::array<float,2>{0.511657476f, 0.396227688f},
-std::array<float,2>{0.161964491f, 0.316430658f},
-std::array<float,2>{0.645682335f, 0.934760213f},
-std::array<float,2>{0.356403857f, 0.641149461f},
-std::array<float,2>{0.953168333f, 0.200180545f},
-std::array<float,2>{0.0387789868f, 0.113814034f},
-std::array<float,2>{0.520846069f, 0.623375535f},
-std::array<float,2>{0.386123419f, 0.78656143f},
-std::array<float,2>{0.850267112f, 0.414251179f},
-std::array<float,2>{0.368844271f, 0.352093279f},
-std::array<float,2>{0.939574242f, 0.890744209f},
-std::array<float,2>{0.175630555f, 0.660880446f},
-std::array<float,2>{0.636144757f, 0.243512228f},
-std::array<float,2>{0.45233199f, 0.16831404f},
-std::array<float,2>{0.765573978f, 0.724280179f},
-std::array<float,2>{0.121665992f, 0.947655797f},
-std::array<float,2>{0.58807826f, 0.298937678f},
-std::array<float,2>{0.204804242f, 0.462730378f},
-std::array<float,2>{0.690113008f, 0.859844685f},
-std::array<float,2>{0.261516631f, 0.516902626f},
-std::array<float,2>{0.932428896f, 0.0371538252f},
-std::array<float,2>{0.128747389f, 0.214596674f},
-std::array<float,2>{0.687058687f, 0.629803479f},
-std::array<float,2>{0.319997221f, 0.915534019f},
-std::array<float,2>{0.972326398f, 0.339854449f},
-std::array<float,2>{0.408624262f, 0.376217574f},
-std::array<float,2>{0.821180999f, 0.757211089f},
-std::array<float,2>{0.00398179796f, 0.573652744f},
-std::array<float,2>{0.547418654f, 0.0873103961f},
-std::array<float,2>{0.294864923f, 0.0275877956f},
-std::array<float,2>{0.888146222f, 0.542947829f},
-std::array<float,2>{0.247064665f, 0.824994147f},
-std::array<float,2>{0.734917581f, 0.480318636f},
-std::array<float,2>{0.0743266493f, 0.256826073f},
-std::array<float,2>{0.610561609f, 0.970076323f},
-std::array<float,2>{0.48908636f, 0.691397846f},
-std::array<float,2>{0.805020869f, 0.147153527f},
-std::array<float,2>{0.216340587f, 0.0961554497f},
-std::array<float,2>{0.702672064f, 0.598193824f},
-std::array<float,2>{0.255494624f, 0.798389077f},
-std::array<float,2>{0.925332785f, 0.435795248f},
-std::array<float,2>{0.444006175f, 0.365888774f},
-std::array<float,2>{0.751423776f, 0.878050089f},
-std::array<float,2>{0.110102125f, 0.672326982f},
-std::array<float,2>{0.582654715f, 0.232199937f},
-std::array<float,2>{0.359401524f, 0.174397409f},
-std::array<float,2>{0.94786334f, 0.744180501f},
-std::array<float,2>{0.182883188f, 0.966629505f},
-std::array<float,2>{0.631755829f, 0.288431257f},
-std::array<float,2>{0.0460287556f, 0.439777166f},
-std::array<float,2>{0.524910808f, 0.845876336f},
-std::array<float,2>{0.379782647f, 0.514878511f},
-std::array<float,2>{0.855244756f, 0.0522402972f},
-std::array<float,2>{0.0640411004f, 0.196917042f},
-std::array<float,2>{0.619662285f, 0.647071481f},
-std::array<float,2>{0.492400467f, 0.931435823f},
-std::array<float,2>{0.798348725f, 0.315631032f},
-std::array<float,2>{0.283387899f, 0.392649263f},
-std::array<float,2>{0.881584287f, 0.777490437f},
-std::array<float,2>{0.241013572f, 0.583310962f},
-std::array<float,2>{0.74279505f, 0.0722351521f},
-std::array<float,2>{0.418453485f, 0.0104299271f},
-std::array<float,2>{0.814560711f, 0.554486096f},
-std::array<float,2>{0.0147970933f, 0.83142513f},
-std::array<float,2>{0.561125457f, 0.48969692f},
-std::array<float,2>{0.139372751f, 0.269760221f},
-std::array<float,2>{0.675594747f, 0.994426548f},
-std::array<float,2>{0.324416012f, 0.70641619f},
-std::array<float,2>{0.982459605f, 0.134248301f},
-std::array<float,2>{0.0175558422f, 0.0322873779f},
-std::array<float,2>{0.533376873f, 0.522096038f},
-std::array<float,2>{0.429189324f, 0.864131451f},
-std::array<float,2>{0.840560675f, 0.465486676f},
-std::array<float,2>{0.333718747f, 0.301943243f},
-std::array<float,2>{0.996935368f, 0.950781226f},
-std::array<float,2>{0.149428934f, 0.720335662f},
-std::array<float,2>{0.66417402f, 0.164664552f},
-std::array<float,2>{0.473267108f, 0.247789189f},
-std::array<float,2>{0.79103446f, 0.658847153f},
-std::array<float,2>{0.0836005509f, 0.897862673f},
-std::array<float,2>{0.60343051f, 0.358929217f},
-std::array<float,2>{0.228103012f, 0.418589652f},
-std::array<float,2>{0.726576388f, 0.78476119f},
-std::array<float,2>{0.309958488f, 0.618567944f},
-std::array<float,2>{0.893892705f, 0.111188486f},
-std::array<float,2>{0.164083451f, 0.142578751f},
-std::array<float,2>{0.648893535f, 0.693452656f},
-std::array<float,2>{0.350436807f, 0.975533247f},
-std::array<float,2>{0.968353927f, 0.251958311f},
-std::array<float,2>{0.404649138f, 0.482417732f},
-std::array<float,2>{0.864485502f, 0.823269188f},
-std::array<float,2>{0.0591246672f, 0.544295192f},
-std::array<float,2>{0.502438486f, 0.0235960856f},
-std::array<float,2>{0.267896146f, 0.0904433057f},
-std::array<float,2>{0.907853127f, 0.575771034f},
-std::array<float,2>{0.190583065f, 0.75324434f},
-std::array<float,2>{0.715333939f, 0.380828232f},
-std::array<float,2>{0.0996494144f, 0.339369684f},
-std::array<float,2>{0.570942402f, 0.921310902f},
-std::array<float,2>{0.467242897f, 0.627990603f},
-std::array<float,2>{0.769005537f, 0.217126861f},
-std::array<float,2>{0.14117001f, 0.015839858f},
-std::array<float,2>{0.660299718f, 0.53606832f},
-std::array<float,2>{0.340932697f, 0.817297518f},
-std::array<float,2>{0.989348471f, 0.470400393f},
-std::array<float,2>{0.43154496f, 0.259727329f},
-std::array<float,2>{0.835452855f, 0.982296765f},
-std::array<float,2>{0.0270700306f, 0.700349033f},
-std::array<float,2>{0.545110226f, 0.150601789f},
-std::array<float,2>{0.300904453f, 0.20683749f},
-std::array<float,2>{0.901266217f, 0.633850694f},
-std::array<float,2>{0.22076878f, 0.91134727f},
-std::array<float,2>{0.718824208f, 0.328739643f},
-std::array<float,2>{0.0911993533f, 0.384855896f},
-std::array<float,2>{0.59939754f, 0.764307857f},
-std::array<float,2>{0.478942275f, 0.566887319f},
-std::array<float,2>{0.785887659f, 0.0794337615f},
-std::array<float,2>{0.0536327325f, 0.157106012f},
-std::array<float,2>{0.513342321f, 0.729990959f},
-std::array<float,2>{0.39548862f, 0.939285696f},
-std::array<float,2>{0.868507326f, 0.307347089f},
-std::array<float,2>{0.355455667f, 0.454797119f},
-std::array<float,2>{0.958713353f, 0.871059656f},
-std::array<float,2>{0.160086542f, 0.529430509f},
-std::array<float,2>{0.642950535f, 0.0419116057f},
-std::array<float,2>{0.458926111f, 0.122501478f},
-std::array<float,2>{0.779192328f, 0.611080647f},
-std::array<float,2>{0.103415862f, 0.792387009f},
-std::array<float,2>{0.5664922f, 0.414030433f},
-std::array<float,2>{0.199788287f, 0.346879363f},
-std::array<float,2>{0.709267974f, 0.902923882f},
-std::array<float,2>{0.280751854f, 0.670683682f},
-std::array<float,2>{0.919943273f, 0.239810452f},
-std::array<float,2>{0.118843891f, 0.0690181479f},
-std::array<float,2>{0.590280652f, 0.587815762f},
-std::array<float,2>{0.446867883f, 0.768181622f},
-std::array<float,2>{0.760406852f, 0.401898742f},
-std::array<float,2>{0.263531476f, 0.32376349f},
-std::array<float,2>{0.934975863f, 0.924615443f},
-std::array<float,2>{0.210268587f, 0.649793804f},
-std::array<float,2>{0.692736566f, 0.193555221f},
-std::array<float,2>{0.389862567f, 0.125647575f},
-std::array<float,2>{0.844720006f, 0.71829313f},
-std::array<float,2>{0.0328500159f, 0.987905324f},
-std::array<float,2>{0.516363442f, 0.277163237f},
-std::array<float,2>{0.179670662f, 0.494673312f},
-std::array<float,2>{0.639364064f, 0.836748302f},
-std::array<float,2>{0.372726887f, 0.556819379f},
-std::array<float,2>{0.943880022f, 0.0065528173f},
-std::array<float,2>{0.24280335f, 0.221995488f},
-std::array<float,2>{0.740203381f, 0.684479535f},
-std::array<float,2>{0.292061746f, 0.885304093f},
-std::array<float,2>{0.883081973f, 0.368332744f},
-std::array<float,2>{0.487803072f, 0.423718482f},
-std::array<float,2>{0.809958994f, 0.809752107f},
-std::array<float,2>{0.0704655573f, 0.602455616f},
-std::array<float,2>{0.614718139f, 0.108766563f},
-std::array<float,2>{0.315415353f, 0.0609020703f},
-std::array<float,2>{0.974235296f, 0.506708086f},
-std::array<float,2>{0.129155338f, 0.855356336f},
-std::array<float,2>{0.681462109f, 0.44989419f},
-std::array<float,2>{0.00287640328f, 0.295928091f},
-std::array<float,2>{0.552495122f, 0.956596196f},
-std::array<float,2>{0.410873383f, 0.740350246f},
-std::array<float,2>{0.826810002f, 0.183140233f},
-std::array<float,2>{0.135834366f, 0.118054248f},
-std::array<float,2>{0.676276863f, 0.617182672f},
-std::array<float,2>{0.321810663f, 0.796006203f},
-std::array<float,2>{0.977604628f, 0.40945816f},
-std::array<float,2>{0.414756209f, 0.350347936f},
-std::array<float,2>{0.818284154f, 0.900948942f},
-std::array<float,2>{0.0114370622f, 0.664696872f},
-std::array<float,2>{0.558345556f, 0.23597613f},
-std::array<float,2>{0.287825763f, 0.160675749f},
-std::array<float,2>{0.878264606f, 0.733142197f},
-std::array<float,2>{0.235892266f, 0.942213118f},
-std::array<float,2>{0.748738348f, 0.309618682f},
-std::array<float,2>{0.0682481155f, 0.459737957f},
-std::array<float,2>{0.624174893f, 0.87258327f},
-std::array<float,2>{0.496695608f, 0.524330139f},
-std::array<float,2>{0.800856411f, 0.0433182791f},
-std::array<float,2>{0.0420765206f, 0.210561544f},
-std::array<float,2>{0.529549062f, 0.638340533f},
-std::array<float,2>{0.377253145f, 0.908319831f},
-std::array<float,2>{0.855543137f, 0.334983677f},
-std::array<float,2>{0.367059261f, 0.38733077f},
-std::array<float,2>{0.951529384f, 0.760479808f},
-std::array<float,2>{0.183732226f, 0.563859165f},
-std::array<float,2>{0.626179397f, 0.0826234221f},
-std::array<float,2>{0.440020233f, 0.0231433026f},
-std::array<float,2>{0.753920734f, 0.534189045f},
-std::array<float,2>{0.116298676f, 0.816222966f},
-std::array<float,2>{0.580763519f, 0.472989827f},
-std::array<float,2>{0.213029146f, 0.263863504f},
-std::array<float,2>{0.696502626f, 0.980427384f},
-std::array<float,2>{0.250182927f, 0.696246326f},
-std::array<float,2>{0.929620743f, 0.153483167f},
-std::array<float,2>{0.0969599634f, 0.0562672354f},
-std::array<float,2>{0.57810998f, 0.501977801f},
-std::array<float,2>{0.463087708f, 0.855648339f},
-std::array<float,2>{0.77016443f, 0.445942432f},
-std::array<float,2>{0.272851288f, 0.289993107f},
-std::array<float,2>{0.913524866f, 0.957155406f},
-std::array<float,2>{0.193458512f, 0.737661123f},
-std::array<float,2>{0.713402987f, 0.185408533f},
-std::array<float,2>{0.400980055f, 0.225787938f},
-std::array<float,2>{0.862711728f, 0.680171907f},
-std::array<float,2>{0.05597784f, 0.889735579f},
-std::array<float,2>{0.504755676f, 0.372846514f},
-std::array<float,2>{0.168029875f, 0.426558554f},
-std::array<float,2>{0.654531658f, 0.80547148f},
-std::array<float,2>{0.345319152f, 0.606515229f},
-std::array<float,2>{0.962103605f, 0.103899188f},
-std::array<float,2>{0.232592672f, 0.129604638f},
-std::array<float,2>{0.732005537f, 0.711053133f},
-std::array<float,2>{0.305574924f, 0.991391003f},
-std::array<float,2>{0.896825731f, 0.281129211f},
-std::array<float,2>{0.4703435f, 0.4982692f},
-std::array<float,2>{0.793464959f, 0.841290236f},
-std::array<float,2>{0.0815314054f, 0.562134266f},
-std::array<float,2>{0.606067896f, 0.00164838263f},
-std::array<float,2>{0.330330521f, 0.0629883632f},
-std::array<float,2>{0.992409468f, 0.593145669f},
-std::array<float,2>{0.153318465f, 0.769657731f},
-std::array<float,2>{0.668527305f, 0.405494303f},
-std::array<float,2>{0.0230972506f, 0.3257837f},
-std::array<float,2>{0.53577888f, 0.926028371f},
-std::array<float,2>{0.42424193f, 0.656022489f},
-std::array<float,2>{0.83753854f, 0.189776659f},
-std::array<float,2>{0.198654711f, 0.0149512142f},
-std::array<float,2>{0.706068814f, 0.54951638f},
-std::array<float,2>{0.273638159f, 0.833693802f},
-std::array<float,2>{0.914147377f, 0.486766845f},
-std::array<float,2>{0.453778118f, 0.267938375f},
-std::array<float,2>{0.773833394f, 0.996621013f},
-std::array<float,2>{0.106175147f, 0.708476365f},
-std::array<float,2>{0.565427303f, 0.137284994f},
-std::array<float,2>{0.358285904f, 0.201690778f},
-std::array<float,2>{0.956624031f, 0.644428551f},
-std::array<float,2>{0.162367433f, 0.936881781f},
-std::array<float,2>{0.646773815f, 0.319960922f},
-std::array<float,2>{0.0484098755f, 0.398217112f},
-std::array<float,2>{0.509424508f, 0.776039183f},
-std::array<float,2>{0.393940359f, 0.580578923f},
-std::array<float,2>{0.8746593f, 0.0775609836f},
-std::array<float,2>{0.0887070298f, 0.177833989f},
-std::array<float,2>{0.597184241f, 0.749656975f},
-std::array<float,2>{0.480682075f, 0.964381337f},
-std::array<float,2>{0.782421172f, 0.284162819f},
-std::array<float,2>{0.29943946f, 0.443177551f},
-std::array<float,2>{0.904922605f, 0.850136638f},
-std::array<float,2>{0.22489877f, 0.511112928f},
-std::array<float,2>{0.723002791f, 0.0477577411f},
-std::array<float,2>{0.434144735f, 0.098674655f},
-std::array<float,2>{0.828982949f, 0.594387174f},
-std::array<float,2>{0.0306949019f, 0.801201105f},
-std::array<float,2>{0.539455235f, 0.430443466f},
-std::array<float,2>{0.145315677f, 0.362801343f},
-std::array<float,2>{0.658198118f, 0.88180989f},
-std::array<float,2>{0.33769834f, 0.677088916f},
-std::array<float,2>{0.984609604f, 0.228420511f},
-std::array<float,2>{0.00629008515f, 0.0896097124f},
-std::array<float,2>{0.550383091f, 0.571329534f},
-std::array<float,2>{0.406397104f, 0.755388141f},
-std::array<float,2>{0.823409617f, 0.377965301f},
-std::array<float,2>{0.316525102f, 0.343426555f},
-std::array<float,2>{0.970579147f, 0.917681754f},
-std::array<float,2>{0.125103623f, 0.632666349f},
-std::array<float,2>{0.684125781f, 0.211760789f},
-std::array<float,2>{0.490795553f, 0.146041304f},
-std::array<float,2>{0.808152437f, 0.688577592f},
-std::array<float,2>{0.0767179504f, 0.97095561f},
-std::array<float,2>{0.612340391f, 0.255766541f},
-std::array<float,2>{0.248189524f, 0.477714688f},
-std::array<float,2>{0.737018526f, 0.827576995f},
-std::array<float,2>{0.295654535f, 0.539210737f},
-std::array<float,2>{0.889722347f, 0.0294044204f},
-std::array<float,2>{0.172438622f, 0.244283423f},
-std::array<float,2>{0.633340657f, 0.663487256f},
-std::array<float,2>{0.370601058f, 0.894305468f},
-std::array<float,2>{0.939263463f, 0.354614645f},
-std::array<float,2>{0.383741587f, 0.417032599f},
-std::array<float,2>{0.849036932f, 0.788535476f},
-std::array<float,2>{0.0360205323f, 0.622937739f},
-std::array<float,2>{0.522291541f, 0.11681924f},
-std::array<float,2>{0.259756386f, 0.036835663f},
-std::array<float,2>{0.931379795f, 0.519018352f},
-std::array<float,2>{0.205487087f, 0.861716151f},
-std::array<float,2>{0.689084053f, 0.463267714f},
-std::array<float,2>{0.123735182f, 0.297109932f},
-std::array<float,2>{0.586666346f, 0.946432114f},
-std::array<float,2>{0.449919671f, 0.725719929f},
-std::array<float,2>{0.762565672f, 0.171337381f},
-std::array<float,2>{0.239847571f, 0.0739994943f},
-std::array<float,2>{0.74536407f, 0.584635437f},
-std::array<float,2>{0.28150174f, 0.780142665f},
-std::array<float,2>{0.879495084f, 0.391612828f},
-std::array<float,2>{0.494820684f, 0.314231455f},
-std::array<float,2>{0.7988289f, 0.93270576f},
-std::array<float,2>{0.0658744797f, 0.646475375f},
-std::array<float,2>{0.617597461f, 0.197674975f},
-std::array<float,2>{0.326954246f, 0.136545181f},
-std::array<float,2>{0.982193649f, 0.704905033f},
-std::array<float,2>{0.13848199f, 0.993260026f},
-std::array<float,2>{0.672555268f, 0.271594167f},
-std::array<float,2>{0.0132322405f, 0.490853101f},
-std::array<float,2>{0.559950352f, 0.829122663f},
-std::array<float,2>{0.421206594f, 0.552348554f},
-std::array<float,2>{0.813983798f, 0.00852824282f},
-std::array<float,2>{0.111829139f, 0.234279186f},
-std::array<float,2>{0.584222674f, 0.674276531f},
-std::array<float,2>{0.44195801f, 0.875532806f},
-std::array<float,2>{0.752479374f, 0.364301115f},
-std::array<float,2>{0.255985975f, 0.433721364f},
-std::array<float,2>{0.923096597f, 0.800474107f},
-std::array<float,2>{0.218111634f, 0.599948704f},
-std::array<float,2>{0.699553788f, 0.0955943465f},
-std::array<float,2>{0.382644385f, 0.0536727197f},
-std::array<float,2>{0.852407038f, 0.512865603f},
-std::array<float,2>{0.0434779562f, 0.844516397f},
-std::array<float,2>{0.525399745f, 0.437728852f},
-std::array<float,2>{0.180313438f, 0.28623879f},
-std::array<float,2>{0.63024503f, 0.968322456f},
-std::array<float,2>{0.363135695f, 0.742435932f},
-std::array<float,2>{0.947049677f, 0.172974065f},
-std::array<float,2>{0.0606215559f, 0.0259207711f},
-std::array<float,2>{0.500114441f, 0.546553016f},
-std::array<float,2>{0.402929813f, 0.82151556f},
-std::array<float,2>{0.866469622f, 0.483715296f},
-std::array<float,2>{0.348868847f, 0.250341654f},
-std::array<float,2>{0.965922356f, 0.972743273f},
-std::array<float,2>{0.167579114f, 0.691876531f},
-std::array<float,2>{0.652098775f, 0.140931174f},
-std::array<float,2>{0.465925843f, 0.214979395f},
-std::array<float,2>{0.765883565f, 0.625494063f},
-std::array<float,2>{0.0995082334f, 0.918291688f},
-std::array<float,2>{0.573445797f, 0.337779641f},
-std::array<float,2>{0.188976511f, 0.381094694f},
-std::array<float,2>{0.716876447f, 0.75144738f},
-std::array<float,2>{0.267393321f, 0.576861143f},
-std::array<float,2>{0.908219039f, 0.0934410244f},
-std::array<float,2>{0.150676221f, 0.166515321f},
-std::array<float,2>{0.666171491f, 0.722456694f},
-std::array<float,2>{0.335213453f, 0.951406896f},
-std::array<float,2>{0.998339891f, 0.303384632f},
-std::array<float,2>{0.426054597f, 0.468117565f},
-std::array<float,2>{0.842927814f, 0.86704874f},
-std::array<float,2>{0.0192619171f, 0.519847631f},
-std::array<float,2>{0.531298161f, 0.0333593003f},
-std::array<float,2>{0.311420977f, 0.111667305f},
-std::array<float,2>{0.891370714f, 0.620091975f},
-std::array<float,2>{0.230439126f, 0.782739103f},
-std::array<float,2>{0.729987442f, 0.421196282f},
-std::array<float,2>{0.0846015438f, 0.356713474f},
-std::array<float,2>{0.605297625f, 0.896250367f},
-std::array<float,2>{0.476070195f, 0.656666398f},
-std::array<float,2>{0.790537536f, 0.248789981f},
-std::array<float,2>{0.1579642f, 0.0394982509f},
-std::array<float,2>{0.641078949f, 0.527454138f},
-std::array<float,2>{0.351918817f, 0.868416488f},
-std::array<float,2>{0.959010243f, 0.455464423f},
-std::array<float,2>{0.397732675f, 0.306399047f},
-std::array<float,2>{0.869850576f, 0.9401986f},
-std::array<float,2>{0.0517963395f, 0.728057921f},
-std::array<float,2>{0.515271544f, 0.158416405f},
-std::array<float,2>{0.277924478f, 0.242032722f},
-std::array<float,2>{0.91898191f, 0.668681085f},
-std::array<float,2>{0.202576339f, 0.905262411f},
-std::array<float,2>{0.707472503f, 0.345616013f},
-std::array<float,2>{0.104504615f, 0.412063688f},
-std::array<float,2>{0.568366647f, 0.790575802f},
-std::array<float,2>{0.45918861f, 0.611426175f},
-std::array<float,2>{0.779671729f, 0.123183846f},
-std::array<float,2>{0.0245617479f, 0.14910768f},
-std::array<float,2>{0.544217825f, 0.70268929f},
-std::array<float,2>{0.432514697f, 0.982701659f},
-std::array<float,2>{0.833666205f, 0.26047805f},
-std::array<float,2>{0.342299998f, 0.470862538f},
-std::array<float,2>{0.990549207f, 0.818738878f},
-std::array<float,2>{0.144260988f, 0.538619578f},
-std::array<float,2>{0.66336292f, 0.0176550802f},
-std::array<float,2>{0.477318674f, 0.0812994689f},
-std::array<float,2>{0.788986444f, 0.56840384f},
-std::array<float,2>{0.0931916684f, 0.762852967f},
-std::array<float,2>{0.5997715f, 0.384761035f},
-std::array<float,2>{0.219593719f, 0.331635714f},
-std::array<float,2>{0.721908987f, 0.913285553f},
-std::array<float,2>{0.303190351f, 0.635196567f},
-std::array<float,2>{0.898763776f, 0.203319013f},
-std::array<float,2>{0.0724159479f, 0.106925443f},
-std::array<float,2>{0.616567791f, 0.604721427f},
-std::array<float,2>{0.485555589f, 0.811739802f},
-std::array<float,2>{0.811977267f, 0.424324721f},
-std::array<float,2>{0.290847868f, 0.370309293f},
-std::array<float,2>{0.885416031f, 0.884102583f},
-std::array<float,2>{0.244820848f, 0.687164128f},
-std::array<float,2>{0.741088212f, 0.218972668f},
-std::array<float,2>{0.413104832f, 0.18161355f},
-std::array<float,2>{0.824713171f, 0.738924384f},
-std::array<float,2>{0.000268216652f, 0.953318834f},
-std::array<float,2>{0.553596437f, 0.293271482f},
-std::array<float,2>{0.131334737f, 0.451210052f},
-std::array<float,2>{0.682247281f, 0.853447139f},
-std::array<float,2>{0.312687159f, 0.505791843f},
-std::array<float,2>{0.975403786f, 0.0600007251f},
-std::array<float,2>{0.207154721f, 0.191527277f},
-std::array<float,2>{0.693758845f, 0.652037919f},
-std::array<float,2>{0.265296698f, 0.923121393f},
-std::array<float,2>{0.936689198f, 0.322151512f},
-std::array<float,2>{0.448304147f, 0.399070621f},
-std::array<float,2>{0.75851661f, 0.766111493f},
-std::array<float,2>{0.120212682f, 0.589271307f},
-std::array<float,2>{0.59357959f, 0.0683353394f},
-std::array<float,2>{0.374599576f, 0.00549516268f},
-std::array<float,2>{0.941918433f, 0.556094408f},
-std::array<float,2>{0.177707538f, 0.83901602f},
-std::array<float,2>{0.637645721f, 0.492875576f},
-std::array<float,2>{0.0337556712f, 0.274582684f},
-std::array<float,2>{0.517992079f, 0.984591484f},
-std::array<float,2>{0.388202935f, 0.716690421f},
-std::array<float,2>{0.847047567f, 0.128125191f},
-std::array<float,2>{0.170580462f, 0.105292238f},
-std::array<float,2>{0.653245568f, 0.606024265f},
-std::array<float,2>{0.345703334f, 0.806117356f},
-std::array<float,2>{0.964363813f, 0.427472979f},
-std::array<float,2>{0.398628891f, 0.371479601f},
-std::array<float,2>{0.861154377f, 0.888738215f},
-std::array<float,2>{0.0573541783f, 0.681503475f},
-std::array<float,2>{0.507680595f, 0.224994525f},
-std::array<float,2>{0.270999193f, 0.183648154f},
-std::array<float,2>{0.911218524f, 0.737076998f},
-std::array<float,2>{0.19214806f, 0.958904982f},
-std::array<float,2>{0.712502658f, 0.29023993f},
-std::array<float,2>{0.0950748399f, 0.446698159f},
-std::array<float,2>{0.575538516f, 0.857062817f},
-std::array<float,2>{0.461852372f, 0.503234029f},
-std::array<float,2>{0.771632254f, 0.055001732f},
-std::array<float,2>{0.0198218916f, 0.191198334f},
-std::array<float,2>{0.537771761f, 0.654597104f},
-std::array<float,2>{0.423663765f, 0.927185237f},
-std::array<float,2>{0.839342892f, 0.324868053f},
-std::array<float,2>{0.32940039f, 0.404778063f},
-std::array<float,2>{0.99584192f, 0.77097857f},
-std::array<float,2>{0.154379755f, 0.592238843f},
-std::array<float,2>{0.670230627f, 0.063911058f},
-std::array<float,2>{0.472324222f, 0.000602375017f},
-std::array<float,2>{0.796405733f, 0.560759008f},
-std::array<float,2>{0.0799024254f, 0.840662956f},
-std::array<float,2>{0.608017564f, 0.49903065f},
-std::array<float,2>{0.231793493f, 0.279722452f},
-std::array<float,2>{0.733873844f, 0.990661025f},
-std::array<float,2>{0.307070524f, 0.712833226f},
-std::array<float,2>{0.89640516f, 0.130094156f},
-std::array<float,2>{0.0686386526f, 0.0440207683f},
-std::array<float,2>{0.622506022f, 0.524993539f},
-std::array<float,2>{0.499361932f, 0.872059703f},
-std::array<float,2>{0.804638803f, 0.460860193f},
-std::array<float,2>{0.28564173f, 0.309562743f},
-std::array<float,2>{0.875282466f, 0.943084359f},
-std::array<float,2>{0.237377107f, 0.73410666f},
-std::array<float,2>{0.747222722f, 0.161630407f},
-std::array<float,2>{0.416384876f, 0.235081181f},
-std::array<float,2>{0.819170833f, 0.665946543f},
-std::array<float,2>{0.00852573011f, 0.901535511f},
-std::array<float,2>{0.5556373f, 0.351339966f},
-std::array<float,2>{0.132983536f, 0.408457637f},
-std::array<float,2>{0.679169536f, 0.795343816f},
-std::array<float,2>{0.323413402f, 0.615468681f},
-std::array<float,2>{0.979908586f, 0.118313909f},
-std::array<float,2>{0.212696373f, 0.152715012f},
-std::array<float,2>{0.697496712f, 0.696510673f},
-std::array<float,2>{0.252071142f, 0.97895205f},
-std::array<float,2>{0.926058114f, 0.265570402f},
-std::array<float,2>{0.437741846f, 0.474589974f},
-std::array<float,2>{0.757065833f, 0.814463675f},
-std::array<float,2>{0.114884257f, 0.53391391f},
-std::array<float,2>{0.579168975f, 0.0220401641f},
-std::array<float,2>{0.365202695f, 0.0832669511f},
-std::array<float,2>{0.951132774f, 0.56278652f},
-std::array<float,2>{0.186012253f, 0.761428773f},
-std::array<float,2>{0.62743187f, 0.38842687f},
-std::array<float,2>{0.0394616723f, 0.334593058f},
-std::array<float,2>{0.528077424f, 0.909327269f},
-std::array<float,2>{0.376241773f, 0.637006223f},
-std::array<float,2>{0.858024359f, 0.20929724f},
-std::array<float,2>{0.247785956f, 0.0310167652f},
-std::array<float,2>{0.735750675f, 0.540876567f},
-std::array<float,2>{0.293597549f, 0.82647115f},
-std::array<float,2>{0.887078822f, 0.476623267f},
-std::array<float,2>{0.490175188f, 0.254756451f},
-std::array<float,2>{0.805929661f, 0.972244918f},
-std::array<float,2>{0.0758876055f, 0.688328385f},
-std::array<float,2>{0.609797299f, 0.14526391f},
-std::array<float,2>{0.319040567f, 0.212078571f},
-std::array<float,2>{0.971497059f, 0.630869508f},
-std::array<float,2>{0.127804622f, 0.916665077f},
-std::array<float,2>{0.685774624f, 0.342438787f},
-std::array<float,2>{0.00536074676f, 0.377102673f},
-std::array<float,2>{0.548545301f, 0.75428009f},
-std::array<float,2>{0.409789115f, 0.570792913f},
-std::array<float,2>{0.822094738f, 0.0885901153f},
-std::array<float,2>{0.122917525f, 0.170238063f},
-std::array<float,2>{0.589738369f, 0.725013435f},
-std::array<float,2>{0.451372594f, 0.9461779f},
-std::array<float,2>{0.763819516f, 0.298622817f},
-std::array<float,2>{0.260556847f, 0.464257747f},
-std::array<float,2>{0.93305999f, 0.86324954f},
-std::array<float,2>{0.203772917f, 0.518016279f},
-std::array<float,2>{0.69049871f, 0.035951782f},
-std::array<float,2>{0.385239035f, 0.115464032f},
-std::array<float,2>{0.851189435f, 0.621992588f},
-std::array<float,2>{0.0379856862f, 0.787760496f},
-std::array<float,2>{0.520363748f, 0.416115284f},
-std::array<float,2>{0.174278736f, 0.353691936f},
-std::array<float,2>{0.63538444f, 0.892775059f},
-std::array<float,2>{0.367784917f, 0.66241622f},
-std::array<float,2>{0.941022396f, 0.245893955f},
-std::array<float,2>{0.0498490743f, 0.0764274001f},
-std::array<float,2>{0.509925246f, 0.581939518f},
-std::array<float,2>{0.391031563f, 0.776736677f},
-std::array<float,2>{0.87270695f, 0.3965258f},
-std::array<float,2>{0.35707441f, 0.318555146f},
-std::array<float,2>{0.954791486f, 0.935897231f},
-std::array<float,2>{0.160909414f, 0.642638683f},
-std::array<float,2>{0.644884109f, 0.202387705f},
-std::array<float,2>{0.456993014f, 0.138488039f},
-std::array<float,2>{0.775836647f, 0.707599163f},
-std::array<float,2>{0.107884213f, 0.997581661f},
-std::array<float,2>{0.563937843f, 0.268630773f},
-std::array<float,2>{0.196444362f, 0.487433136f},
-std::array<float,2>{0.704287827f, 0.83299458f},
-std::array<float,2>{0.276708543f, 0.550374746f},
-std::array<float,2>{0.916846454f, 0.0144356526f},
-std::array<float,2>{0.147992283f, 0.226771578f},
-std::array<float,2>{0.65840435f, 0.676472366f},
-std::array<float,2>{0.338081628f, 0.882430971f},
-std::array<float,2>{0.987113178f, 0.362093836f},
-std::array<float,2>{0.437155366f, 0.431031406f},
-std::array<float,2>{0.830327392f, 0.801761329f},
-std::array<float,2>{0.0286588632f, 0.595457137f},
-std::array<float,2>{0.541944623f, 0.0979335532f},
-std::array<float,2>{0.29690358f, 0.0479050204f},
-std::array<float,2>{0.903536141f, 0.51018703f},
-std::array<float,2>{0.223697141f, 0.851424456f},
-std::array<float,2>{0.726509571f, 0.441891134f},
-std::array<float,2>{0.0875195861f, 0.285023093f},
-std::array<float,2>{0.595229626f, 0.963663757f},
-std::array<float,2>{0.484075397f, 0.748792529f},
-std::array<float,2>{0.784634173f, 0.179268897f},
-std::array<float,2>{0.190069243f, 0.092492491f},
-std::array<float,2>{0.7166242f, 0.577206671f},
-std::array<float,2>{0.268614203f, 0.750553846f},
-std::array<float,2>{0.906486273f, 0.382629395f},
-std::array<float,2>{0.467954904f, 0.336318612f},
-std::array<float,2>{0.767739654f, 0.919717491f},
-std::array<float,2>{0.101560473f, 0.626523376f},
-std::array<float,2>{0.571924746f, 0.216348201f},
-std::array<float,2>{0.350734979f, 0.142486095f},
-std::array<float,2>{0.967397332f, 0.692881584f},
-std::array<float,2>{0.165891424f, 0.973725915f},
-std::array<float,2>{0.649806261f, 0.251570582f},
-std::array<float,2>{0.0604294017f, 0.482602447f},
-std::array<float,2>{0.50304234f, 0.82055831f},
-std::array<float,2>{0.405344129f, 0.544984639f},
-std::array<float,2>{0.863631487f, 0.0264092945f},
-std::array<float,2>{0.0826715976f, 0.249949574f},
-std::array<float,2>{0.602416575f, 0.657561898f},
-std::array<float,2>{0.474353701f, 0.894898117f},
-std::array<float,2>{0.792880833f, 0.355989873f},
-std::array<float,2>{0.309225768f, 0.420018971f},
-std::array<float,2>{0.892897904f, 0.781935394f},
-std::array<float,2>{0.227207229f, 0.620218217f},
-std::array<float,2>{0.727584481f, 0.113045916f},
-std::array<float,2>{0.428416222f, 0.0343906358f},
-std::array<float,2>{0.841497958f, 0.52061218f},
-std::array<float,2>{0.0161022563f, 0.865519106f},
-std::array<float,2>{0.534293592f, 0.466873765f},
-std::array<float,2>{0.148962721f, 0.304157466f},
-std::array<float,2>{0.665546596f, 0.953048944f},
-std::array<float,2>{0.332366228f, 0.721125662f},
-std::array<float,2>{0.997101068f, 0.167460471f},
-std::array<float,2>{0.0138482088f, 0.00902287103f},
-std::array<float,2>{0.561581731f, 0.55092901f},
-std::array<float,2>{0.419311553f, 0.828966737f},
-std::array<float,2>{0.815892577f, 0.491641849f},
-std::array<float,2>{0.325714588f, 0.27285406f},
-std::array<float,2>{0.984135807f, 0.992788255f},
-std::array<float,2>{0.140200168f, 0.703463972f},
-std::array<float,2>{0.674326301f, 0.135470822f},
-std::array<float,2>{0.493611068f, 0.198780939f},
-std::array<float,2>{0.797651887f, 0.645144403f},
-std::array<float,2>{0.0626454577f, 0.932173252f},
-std::array<float,2>{0.620567262f, 0.313440502f},
-std::array<float,2>{0.242146298f, 0.391448736f},
-std::array<float,2>{0.743280292f, 0.780720055f},
-std::array<float,2>{0.284899592f, 0.585649669f},
-std::array<float,2>{0.882470131f, 0.0730339885f},
-std::array<float,2>{0.181994215f, 0.172258973f},
-std::array<float,2>{0.632617772f, 0.74334079f},
-std::array<float,2>{0.361100435f, 0.967668295f},
-std::array<float,2>{0.949196756f, 0.285454482f},
-std::array<float,2>{0.380207181f, 0.438658386f},
-std::array<float,2>{0.854346275f, 0.845137477f},
-std::array<float,2>{0.0451672897f, 0.511861145f},
-std::array<float,2>{0.523592472f, 0.0537189431f},
-std::array<float,2>{0.253939629f, 0.0944491923f},
-std::array<float,2>{0.924036562f, 0.601321161f},
-std::array<float,2>{0.214871109f, 0.79919374f},
-std::array<float,2>{0.701792359f, 0.435343027f},
-std::array<float,2>{0.110676661f, 0.36341086f},
-std::array<float,2>{0.583665669f, 0.876466572f},
-std::array<float,2>{0.444850326f, 0.674898744f},
-std::array<float,2>{0.750894427f, 0.232800707f},
-std::array<float,2>{0.130539283f, 0.0589522682f},
-std::array<float,2>{0.6801579f, 0.504521012f},
-std::array<float,2>{0.31582734f, 0.852201521f},
-std::array<float,2>{0.9732427f, 0.452425897f},
-std::array<float,2>{0.411133736f, 0.294571429f},
-std::array<float,2>{0.827157259f, 0.954356313f},
-std::array<float,2>{0.00377914775f, 0.739568055f},
-std::array<float,2>{0.551523328f, 0.179834858f},
-std::array<float,2>{0.29162553f, 0.219986975f},
-std::array<float,2>{0.884632766f, 0.686329961f},
-std::array<float,2>{0.243204653f, 0.883411407f},
-std::array<float,2>{0.738580287f, 0.369554222f},
-std::array<float,2>{0.0717704371f, 0.425559103f},
-std::array<float,2>{0.61408627f, 0.811065674f},
-std::array<float,2>{0.48705852f, 0.604429305f},
-std::array<float,2>{0.809273422f, 0.106084704f},
-std::array<float,2>{0.031416703f, 0.127688915f},
-std::array<float,2>{0.516694129f, 0.715396523f},
-std::array<float,2>{0.389485389f, 0.985439599f},
-std::array<float,2>{0.84514153f, 0.273997813f},
-std::array<float,2>{0.372069865f, 0.493300438f},
-std::array<float,2>{0.94497925f, 0.83870703f},
-std::array<float,2>{0.178515822f, 0.554923654f},
-std::array<float,2>{0.639943838f, 0.00391730899f},
-std::array<float,2>{0.445516288f, 0.0667746291f},
-std::array<float,2>{0.76156193f, 0.588167846f},
-std::array<float,2>{0.117609739f, 0.766652405f},
-std::array<float,2>{0.591113389f, 0.399762332f},
-std::array<float,2>{0.209693328f, 0.321272999f},
-std::array<float,2>{0.692331135f, 0.922270179f},
-std::array<float,2>{0.262627721f, 0.650544345f},
-std::array<float,2>{0.933634162f, 0.193103597f},
-std::array<float,2>{0.102021739f, 0.124204576f},
-std::array<float,2>{0.567625701f, 0.612314284f},
-std::array<float,2>{0.457492292f, 0.789955795f},
-std::array<float,2>{0.778153777f, 0.41085723f},
-std::array<float,2>{0.279542446f, 0.344117314f},
-std::array<float,2>{0.921276391f, 0.906203389f},
-std::array<float,2>{0.20059441f, 0.669480622f},
-std::array<float,2>{0.710554004f, 0.240553766f},
-std::array<float,2>{0.396415442f, 0.159442723f},
-std::array<float,2>{0.867806375f, 0.727033198f},
-std::array<float,2>{0.0545192659f, 0.941137671f},
-std::array<float,2>{0.512621462f, 0.304905027f},
-std::array<float,2>{0.158327594f, 0.456514925f},
-std::array<float,2>{0.644134283f, 0.867811441f},
-std::array<float,2>{0.353853047f, 0.528805375f},
-std::array<float,2>{0.957620978f, 0.0402716659f},
-std::array<float,2>{0.222125784f, 0.204744652f},
-std::array<float,2>{0.720437288f, 0.636464536f},
-std::array<float,2>{0.302325547f, 0.912526429f},
-std::array<float,2>{0.901509821f, 0.33011654f},
-std::array<float,2>{0.480302215f, 0.382996202f},
-std::array<float,2>{0.786559582f, 0.762641013f},
-std::array<float,2>{0.0898442194f, 0.56940937f},
-std::array<float,2>{0.598224819f, 0.0800920576f},
-std::array<float,2>{0.340434253f, 0.0189152081f},
-std::array<float,2>{0.988694251f, 0.537214637f},
-std::array<float,2>{0.141948566f, 0.820005476f},
-std::array<float,2>{0.661542892f, 0.471988142f},
-std::array<float,2>{0.0255815461f, 0.260814935f},
-std::array<float,2>{0.546661854f, 0.984064102f},
-std::array<float,2>{0.430102408f, 0.701609313f},
-std::array<float,2>{0.834405363f, 0.149719015f},
-std::array<float,2>{0.153596044f, 0.0652749091f},
-std::array<float,2>{0.669168651f, 0.59049052f},
-std::array<float,2>{0.331890196f, 0.7714867f},
-std::array<float,2>{0.994092047f, 0.403431147f},
-std::array<float,2>{0.425503701f, 0.32662192f},
-std::array<float,2>{0.836391211f, 0.928400218f},
-std::array<float,2>{0.0222856961f, 0.653060198f},
-std::array<float,2>{0.536138654f, 0.189392537f},
-std::array<float,2>{0.306490153f, 0.131124049f},
-std::array<float,2>{0.897819281f, 0.712988615f},
-std::array<float,2>{0.23396872f, 0.988578498f},
-std::array<float,2>{0.730499148f, 0.278901011f},
-std::array<float,2>{0.0810064003f, 0.49730435f},
-std::array<float,2>{0.607391536f, 0.842810988f},
-std::array<float,2>{0.468951017f, 0.558793664f},
-std::array<float,2>{0.794517696f, 0.0019840186f},
-std::array<float,2>{0.054828316f, 0.224360004f},
-std::array<float,2>{0.505715966f, 0.682911038f},
-std::array<float,2>{0.402015358f, 0.88841778f},
-std::array<float,2>{0.862252891f, 0.374621391f},
-std::array<float,2>{0.344337165f, 0.429186791f},
-std::array<float,2>{0.961652219f, 0.808067501f},
-std::array<float,2>{0.169051677f, 0.609165192f},
-std::array<float,2>{0.655410886f, 0.101866186f},
-std::array<float,2>{0.464724302f, 0.0572077557f},
-std::array<float,2>{0.771392524f, 0.501737118f},
-std::array<float,2>{0.0957038775f, 0.857917666f},
-std::array<float,2>{0.576306045f, 0.448300391f},
-std::array<float,2>{0.194742247f, 0.292690337f},
-std::array<float,2>{0.714375377f, 0.95996058f},
-std::array<float,2>{0.272254527f, 0.734971702f},
-std::array<float,2>{0.912425816f, 0.186564654f},
-std::array<float,2>{0.115699701f, 0.0205966253f},
-std::array<float,2>{0.581550479f, 0.532795727f},
-std::array<float,2>{0.440757006f, 0.813399494f},
-std::array<float,2>{0.755192459f, 0.475507319f},
-std::array<float,2>{0.251506329f, 0.263287634f},
-std::array<float,2>{0.928330839f, 0.976734459f},
-std::array<float,2>{0.214339182f, 0.698280573f},
-std::array<float,2>{0.696207047f, 0.156185254f},
-std::array<float,2>{0.378183305f, 0.207792073f},
-std::array<float,2>{0.85683924f, 0.638822317f},
-std::array<float,2>{0.0416531786f, 0.908158064f},
-std::array<float,2>{0.531127989f, 0.333188683f},
-std::array<float,2>{0.185093924f, 0.389698178f},
-std::array<float,2>{0.625104547f, 0.759559751f},
-std::array<float,2>{0.365407944f, 0.565237045f},
-std::array<float,2>{0.952271938f, 0.0855956376f},
-std::array<float,2>{0.234702706f, 0.162310511f},
-std::array<float,2>{0.749141514f, 0.730950117f},
-std::array<float,2>{0.288361192f, 0.944040775f},
-std::array<float,2>{0.877725065f, 0.310761154f},
-std::array<float,2>{0.497514188f, 0.457372427f},
-std::array<float,2>{0.802066267f, 0.874855697f},
-std::array<float,2>{0.0668240413f, 0.52674216f},
-std::array<float,2>{0.623475611f, 0.046101585f},
-std::array<float,2>{0.320329547f, 0.119220071f},
-std::array<float,2>{0.97737515f, 0.613977313f},
-std::array<float,2>{0.135174215f, 0.793783844f},
-std::array<float,2>{0.67747587f, 0.406458169f},
-std::array<float,2>{0.0105052274f, 0.347839445f},
-std::array<float,2>{0.556999624f, 0.900111675f},
-std::array<float,2>{0.41600585f, 0.666829228f},
-std::array<float,2>{0.817365706f, 0.236749038f},
-std::array<float,2>{0.206575736f, 0.0386551768f},
-std::array<float,2>{0.688037336f, 0.516465604f},
-std::array<float,2>{0.25854513f, 0.8609519f},
-std::array<float,2>{0.929924309f, 0.461782664f},
-std::array<float,2>{0.451066375f, 0.29998669f},
-std::array<float,2>{0.763387263f, 0.948709011f},
-std::array<float,2>{0.124942422f, 0.723146081f},
-std::array<float,2>{0.586981833f, 0.169338167f},
-std::array<float,2>{0.370107681f, 0.242697686f},
-std::array<float,2>{0.938233137f, 0.661703467f},
-std::array<float,2>{0.173360601f, 0.891744316f},
-std::array<float,2>{0.633802652f, 0.352645367f},
-std::array<float,2>{0.0367825478f, 0.415952206f},
-std::array<float,2>{0.523430228f, 0.785554826f},
-std::array<float,2>{0.384721726f, 0.624678671f},
-std::array<float,2>{0.847725272f, 0.115156665f},
-std::array<float,2>{0.0776378512f, 0.147659823f},
-std::array<float,2>{0.612176657f, 0.689745605f},
-std::array<float,2>{0.491571069f, 0.969366133f},
-std::array<float,2>{0.806735694f, 0.257261127f},
-std::array<float,2>{0.29599607f, 0.47945416f},
-std::array<float,2>{0.889425159f, 0.825787663f},
-std::array<float,2>{0.249206036f, 0.541187048f},
-std::array<float,2>{0.737453103f, 0.0290557407f},
-std::array<float,2>{0.407880574f, 0.086886093f},
-std::array<float,2>{0.822461069f, 0.572850645f},
-std::array<float,2>{0.00776625052f, 0.755884767f},
-std::array<float,2>{0.549609244f, 0.375965655f},
-std::array<float,2>{0.12630567f, 0.341347218f},
-std::array<float,2>{0.685199559f, 0.914404154f},
-std::array<float,2>{0.317671478f, 0.630377829f},
-std::array<float,2>{0.969373345f, 0.213252813f},
-std::array<float,2>{0.0302435793f, 0.101009503f},
-std::array<float,2>{0.540753067f, 0.597442329f},
-std::array<float,2>{0.43523863f, 0.803708136f},
-std::array<float,2>{0.829529166f, 0.432014406f},
-std::array<float,2>{0.336477011f, 0.36002332f},
-std::array<float,2>{0.986238956f, 0.879732847f},
-std::array<float,2>{0.146479338f, 0.67942977f},
-std::array<float,2>{0.656503439f, 0.230458915f},
-std::array<float,2>{0.481774449f, 0.177596644f},
-std::array<float,2>{0.781439185f, 0.748042107f},
-std::array<float,2>{0.0892399848f, 0.961818695f},
-std::array<float,2>{0.59632659f, 0.281638652f},
-std::array<float,2>{0.226075605f, 0.444497079f},
-std::array<float,2>{0.723765075f, 0.848438203f},
-std::array<float,2>{0.300593734f, 0.509567857f},
-std::array<float,2>{0.905545831f, 0.0488340668f},
-std::array<float,2>{0.163431019f, 0.20078297f},
-std::array<float,2>{0.64817363f, 0.642189384f},
-std::array<float,2>{0.359082878f, 0.934396505f},
-std::array<float,2>{0.955909312f, 0.317554653f},
-std::array<float,2>{0.393240392f, 0.395192981f},
-std::array<float,2>{0.873350322f, 0.77363801f},
-std::array<float,2>{0.0469873473f, 0.57994318f},
-std::array<float,2>{0.508560658f, 0.075575985f},
-std::array<float,2>{0.274825275f, 0.0126326298f},
-std::array<float,2>{0.915231764f, 0.548273563f},
-std::array<float,2>{0.197952732f, 0.835907102f},
-std::array<float,2>{0.705666125f, 0.486206114f},
-std::array<float,2>{0.106941417f, 0.265816689f},
-std::array<float,2>{0.56616956f, 0.999131382f},
-std::array<float,2>{0.455040008f, 0.709484339f},
-std::array<float,2>{0.774786294f, 0.13877964f},
-std::array<float,2>{0.229187489f, 0.10949225f},
-std::array<float,2>{0.728522658f, 0.617973268f},
-std::array<float,2>{0.312153399f, 0.783452988f},
-std::array<float,2>{0.892361879f, 0.419222385f},
-std::array<float,2>{0.475077569f, 0.35773918f},
-std::array<float,2>{0.789739847f, 0.897111893f},
-std::array<float,2>{0.0852713361f, 0.659534931f},
-std::array<float,2>{0.604297996f, 0.246670902f},
-std::array<float,2>{0.334159881f, 0.165804431f},
-std::array<float,2>{0.999672651f, 0.719118893f},
-std::array<float,2>{0.151551396f, 0.949515939f},
-std::array<float,2>{0.667588592f, 0.301510066f},
-std::array<float,2>{0.0175825339f, 0.466169298f},
-std::array<float,2>{0.532342374f, 0.864853978f},
-std::array<float,2>{0.427417547f, 0.523375571f},
-std::array<float,2>{0.84275353f, 0.0318062976f},
-std::array<float,2>{0.0977839157f, 0.21836558f},
-std::array<float,2>{0.572587371f, 0.627754867f},
-std::array<float,2>{0.464856029f, 0.920113683f},
-std::array<float,2>{0.767037094f, 0.338297844f},
-std::array<float,2>{0.265922874f, 0.379846156f},
-std::array<float,2>{0.909199834f, 0.752862513f},
-std::array<float,2>{0.187931702f, 0.574245334f},
-std::array<float,2>{0.718179047f, 0.0915807337f},
-std::array<float,2>{0.404035538f, 0.0253035631f},
-std::array<float,2>{0.866080701f, 0.543763399f},
-std::array<float,2>{0.0616916828f, 0.822590232f},
-std::array<float,2>{0.501785994f, 0.481245548f},
-std::array<float,2>{0.166716009f, 0.25334686f},
-std::array<float,2>{0.650795758f, 0.975751519f},
-std::array<float,2>{0.348144501f, 0.694976747f},
-std::array<float,2>{0.965324521f, 0.144092351f},
-std::array<float,2>{0.0447977968f, 0.0517182201f},
-std::array<float,2>{0.526423395f, 0.514011621f},
-std::array<float,2>{0.381196737f, 0.846879065f},
-std::array<float,2>{0.85331136f, 0.441374958f},
-std::array<float,2>{0.362209558f, 0.287707746f},
-std::array<float,2>{0.945363939f, 0.965605259f},
-std::array<float,2>{0.181404054f, 0.745186269f},
-std::array<float,2>{0.628911138f, 0.175618276f},
-std::array<float,2>{0.442673951f, 0.230817527f},
-std::array<float,2>{0.753454745f, 0.673686326f},
-std::array<float,2>{0.112396151f, 0.877101958f},
-std::array<float,2>{0.585486889f, 0.366690725f},
-std::array<float,2>{0.217568055f, 0.43735221f},
-std::array<float,2>{0.700887203f, 0.797157288f},
-std::array<float,2>{0.257604539f, 0.599293232f},
-std::array<float,2>{0.922580361f, 0.0971690938f},
-std::array<float,2>{0.137024775f, 0.133014351f},
-std::array<float,2>{0.673335612f, 0.705339551f},
-std::array<float,2>{0.327654153f, 0.995349944f},
-std::array<float,2>{0.980811954f, 0.270627677f},
-std::array<float,2>{0.4204804f, 0.488545299f},
-std::array<float,2>{0.813137412f, 0.83071214f},
-std::array<float,2>{0.0119189881f, 0.553592205f},
-std::array<float,2>{0.559322f, 0.0115873693f},
-std::array<float,2>{0.282799691f, 0.0711269826f},
-std::array<float,2>{0.880132556f, 0.58295089f},
-std::array<float,2>{0.23898457f, 0.77869916f},
-std::array<float,2>{0.744173229f, 0.393682361f},
-std::array<float,2>{0.0652154982f, 0.31493485f},
-std::array<float,2>{0.61903435f, 0.930338681f},
-std::array<float,2>{0.495125502f, 0.648303568f},
-std::array<float,2>{0.800245583f, 0.195629343f},
-std::array<float,2>{0.176208004f, 0.00747600757f},
-std::array<float,2>{0.638355374f, 0.557937801f},
-std::array<float,2>{0.373617738f, 0.837878048f},
-std::array<float,2>{0.942943394f, 0.49557209f},
-std::array<float,2>{0.386852324f, 0.275920391f},
-std::array<float,2>{0.845923781f, 0.986898959f},
-std::array<float,2>{0.0349524431f, 0.71768564f},
-std::array<float,2>{0.519087493f, 0.126336351f},
-std::array<float,2>{0.264400125f, 0.194454089f},
-std::array<float,2>{0.935679793f, 0.648534656f},
-std::array<float,2>{0.208970696f, 0.925471604f},
-std::array<float,2>{0.694860041f, 0.322792798f},
-std::array<float,2>{0.120033324f, 0.400744945f},
-std::array<float,2>{0.591954947f, 0.768888295f},
-std::array<float,2>{0.44822818f, 0.586491644f},
-std::array<float,2>{0.759036839f, 0.0693581253f},
-std::array<float,2>{0.000998196309f, 0.181917801f},
-std::array<float,2>{0.554314792f, 0.741322577f},
-std::array<float,2>{0.412357211f, 0.955888033f},
-std::array<float,2>{0.82589829f, 0.294995725f},
-std::array<float,2>{0.313602865f, 0.450227261f},
-std::array<float,2>{0.975946784f, 0.853932142f},
-std::array<float,2>{0.13272433f, 0.507030129f},
-std::array<float,2>{0.683293819f, 0.0620425753f},
-std::array<float,2>{0.48526749f, 0.108078092f},
-std::array<float,2>{0.811251879f, 0.602829635f},
-std::array<float,2>{0.0739836246f, 0.809001207f},
-std::array<float,2>{0.615690827f, 0.422594935f},
-std::array<float,2>{0.245926812f, 0.367251635f},
-std::array<float,2>{0.741714358f, 0.886202097f},
-std::array<float,2>{0.289656639f, 0.684803486f},
-std::array<float,2>{0.885804594f, 0.221544936f},
-std::array<float,2>{0.0923838392f, 0.0789891779f},
-std::array<float,2>{0.600730598f, 0.568154097f},
-std::array<float,2>{0.478462994f, 0.765577853f},
-std::array<float,2>{0.787237465f, 0.38584125f},
-std::array<float,2>{0.304143101f, 0.329573393f},
-std::array<float,2>{0.89975512f, 0.911038697f},
-std::array<float,2>{0.220376059f, 0.633526206f},
-std::array<float,2>{0.721062243f, 0.205409229f},
-std::array<float,2>{0.432832837f, 0.151550606f},
-std::array<float,2>{0.832699776f, 0.699944198f},
-std::array<float,2>{0.0236624908f, 0.981293261f},
-std::array<float,2>{0.543167353f, 0.258327752f},
-std::array<float,2>{0.143063068f, 0.469429106f},
-std::array<float,2>{0.66298759f, 0.817510486f},
-std::array<float,2>{0.343485981f, 0.536629975f},
-std::array<float,2>{0.991901219f, 0.0166337434f},
-std::array<float,2>{0.201366544f, 0.239236414f},
-std::array<float,2>{0.70892036f, 0.671243906f},
-std::array<float,2>{0.27868399f, 0.903475404f},
-std::array<float,2>{0.918559968f, 0.346062034f},
-std::array<float,2>{0.460783184f, 0.412266761f},
-std::array<float,2>{0.780667186f, 0.791277945f},
-std::array<float,2>{0.104247086f, 0.609774888f},
-std::array<float,2>{0.569746912f, 0.12115375f},
-std::array<float,2>{0.353158146f, 0.042856317f},
-std::array<float,2>{0.960217953f, 0.530969203f},
-std::array<float,2>{0.157111317f, 0.870047271f},
-std::array<float,2>{0.641713858f, 0.453288138f},
-std::array<float,2>{0.0515652932f, 0.308050066f},
-std::array<float,2>{0.513894916f, 0.937723696f},
-std::array<float,2>{0.396906197f, 0.729477644f},
-std::array<float,2>{0.870518744f, 0.157428876f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.715969086f, 0.325559855f},
-std::array<float,2>{0.388741374f, 0.984754264f},
-std::array<float,2>{0.19657445f, 0.172244966f},
-std::array<float,2>{0.863041162f, 0.575946748f},
-std::array<float,2>{0.945842624f, 0.0686733052f},
-std::array<float,2>{0.0167341661f, 0.742938697f},
-std::array<float,2>{0.330601484f, 0.443030804f},
-std::array<float,2>{0.54236424f, 0.839153528f},
-std::array<float,2>{0.771125078f, 0.405918062f},
-std::array<float,2>{0.175704375f, 0.787904203f},
-std::array<float,2>{0.449225426f, 0.0010890736f},
-std::array<float,2>{0.67091018f, 0.669865429f},
-std::array<float,2>{0.60526222f, 0.22735101f},
-std::array<float,2>{0.258734792f, 0.519163013f},
-std::array<float,2>{0.0783254579f, 0.309140205f},
-std::array<float,2>{0.914268076f, 0.905065954f},
-std::array<float,2>{0.516731203f, 0.488502264f},
-std::array<float,2>{0.357793659f, 0.867870748f},
-std::array<float,2>{0.0409388654f, 0.0976065248f},
-std::array<float,2>{0.995142639f, 0.711337149f},
-std::array<float,2>{0.821236074f, 0.133641735f},
-std::array<float,2>{0.248269051f, 0.604608178f},
-std::array<float,2>{0.41454488f, 0.371599972f},
-std::array<float,2>{0.725244999f, 0.963884473f},
-std::array<float,2>{0.901041746f, 0.256357819f},
-std::array<float,2>{0.102294952f, 0.928151846f},
-std::array<float,2>{0.287323624f, 0.19975318f},
-std::array<float,2>{0.564734578f, 0.54218334f},
-std::array<float,2>{0.649994016f, 0.0575956181f},
-std::array<float,2>{0.492621273f, 0.644730091f},
-std::array<float,2>{0.15294084f, 0.407821417f},
-std::array<float,2>{0.786177993f, 0.751374722f},
-std::array<float,2>{0.586898744f, 0.283436954f},
-std::array<float,2>{0.308370024f, 0.882422686f},
-std::array<float,2>{0.115353726f, 0.239944652f},
-std::array<float,2>{0.885709524f, 0.5024575f},
-std::array<float,2>{0.811201096f, 0.0205180235f},
-std::array<float,2>{0.139078408f, 0.672563255f},
-std::array<float,2>{0.472089797f, 0.389202565f},
-std::array<float,2>{0.63622272f, 0.810146213f},
-std::array<float,2>{0.975368738f, 0.458348244f},
-std::array<float,2>{0.0539077073f, 0.815177917f},
-std::array<float,2>{0.359903604f, 0.0790778026f},
-std::array<float,2>{0.503402531f, 0.728211999f},
-std::array<float,2>{0.746225417f, 0.159328461f},
-std::array<float,2>{0.422035724f, 0.582371891f},
-std::array<float,2>{0.229586482f, 0.33431828f},
-std::array<float,2>{0.832529604f, 0.971482456f},
-std::array<float,2>{0.673108757f, 0.434050471f},
-std::array<float,2>{0.457079381f, 0.776989102f},
-std::array<float,2>{0.164883494f, 0.0468346253f},
-std::array<float,2>{0.753827393f, 0.626498163f},
-std::array<float,2>{0.928540111f, 0.205672935f},
-std::array<float,2>{0.0630184263f, 0.556418002f},
-std::array<float,2>{0.273182154f, 0.270031661f},
-std::array<float,2>{0.618747234f, 0.91199398f},
-std::array<float,2>{0.851002276f, 0.354914367f},
-std::array<float,2>{0.209521413f, 0.95016861f},
-std::array<float,2>{0.399715632f, 0.147646755f},
-std::array<float,2>{0.701271176f, 0.616328418f},
-std::array<float,2>{0.551762342f, 0.114611745f},
-std::array<float,2>{0.32545051f, 0.695242107f},
-std::array<float,2>{0.0141666392f, 0.477152884f},
-std::array<float,2>{0.966069221f, 0.85894841f},
-std::array<float,2>{0.625183523f, 0.279410779f},
-std::array<float,2>{0.479003012f, 0.914179623f},
-std::array<float,2>{0.132506132f, 0.214088425f},
-std::array<float,2>{0.80445534f, 0.548155069f},
-std::array<float,2>{0.875168562f, 0.0316865481f},
-std::array<float,2>{0.11808005f, 0.639852822f},
-std::array<float,2>{0.301477373f, 0.425900847f},
-std::array<float,2>{0.581219375f, 0.772521853f},
-std::array<float,2>{0.841882348f, 0.471174926f},
-std::array<float,2>{0.221482784f, 0.846984208f},
-std::array<float,2>{0.432139486f, 0.117332689f},
-std::array<float,2>{0.741584837f, 0.703089833f},
-std::array<float,2>{0.510199964f, 0.155199796f},
-std::array<float,2>{0.37409687f, 0.620282352f},
-std::array<float,2>{0.0603177473f, 0.347284108f},
-std::array<float,2>{0.980278254f, 0.945241749f},
-std::array<float,2>{0.612602055f, 0.381049156f},
-std::array<float,2>{0.274368584f, 0.800089061f},
-std::array<float,2>{0.0746349692f, 0.0291378479f},
-std::array<float,2>{0.932537854f, 0.68202436f},
-std::array<float,2>{0.759859145f, 0.247004867f},
-std::array<float,2>{0.162100464f, 0.513018131f},
-std::array<float,2>{0.465052754f, 0.291965365f},
-std::array<float,2>{0.686479032f, 0.885840833f},
-std::array<float,2>{0.958046436f, 0.342139214f},
-std::array<float,2>{0.00426903879f, 0.977866411f},
-std::array<float,2>{0.313162625f, 0.167003989f},
-std::array<float,2>{0.558410645f, 0.586524427f},
-std::array<float,2>{0.691360533f, 0.0891542584f},
-std::array<float,2>{0.396450251f, 0.726098478f},
-std::array<float,2>{0.210940197f, 0.463824034f},
-std::array<float,2>{0.855766475f, 0.820908844f},
-std::array<float,2>{0.531345963f, 0.366401017f},
-std::array<float,2>{0.338658482f, 0.953368425f},
-std::array<float,2>{0.0274387244f, 0.130447358f},
-std::array<float,2>{0.941635072f, 0.601446927f},
-std::array<float,2>{0.869010389f, 0.104794368f},
-std::array<float,2>{0.193590119f, 0.710315347f},
-std::array<float,2>{0.375762254f, 0.495431066f},
-std::array<float,2>{0.70854497f, 0.864601552f},
-std::array<float,2>{0.907079279f, 0.421566278f},
-std::array<float,2>{0.0877312124f, 0.76550293f},
-std::array<float,2>{0.257402658f, 0.0532085262f},
-std::array<float,2>{0.595170677f, 0.654679239f},
-std::array<float,2>{0.661638498f, 0.187836841f},
-std::array<float,2>{0.438451141f, 0.532582223f},
-std::array<float,2>{0.1835161f, 0.262049407f},
-std::array<float,2>{0.775797963f, 0.934767842f},
-std::array<float,2>{0.732804239f, 0.447419763f},
-std::array<float,2>{0.410804331f, 0.832115889f},
-std::array<float,2>{0.238051742f, 0.0745539889f},
-std::array<float,2>{0.817253888f, 0.739581466f},
-std::array<float,2>{0.990892529f, 0.186430097f},
-std::array<float,2>{0.0375618711f, 0.568110049f},
-std::array<float,2>{0.34499535f, 0.318056315f},
-std::array<float,2>{0.529629171f, 0.99639225f},
-std::array<float,2>{0.795434773f, 0.299775213f},
-std::array<float,2>{0.144450322f, 0.892927766f},
-std::array<float,2>{0.487834185f, 0.223039314f},
-std::array<float,2>{0.648162782f, 0.530117333f},
-std::array<float,2>{0.572204888f, 0.0154149542f},
-std::array<float,2>{0.295604736f, 0.657875419f},
-std::array<float,2>{0.0999807343f, 0.392510056f},
-std::array<float,2>{0.896436989f, 0.796398163f},
-std::array<float,2>{0.664129674f, 0.349895239f},
-std::array<float,2>{0.446567148f, 0.938677311f},
-std::array<float,2>{0.176093325f, 0.15020369f},
-std::array<float,2>{0.767947853f, 0.62262553f},
-std::array<float,2>{0.921093643f, 0.124810845f},
-std::array<float,2>{0.0844644308f, 0.69887954f},
-std::array<float,2>{0.262508631f, 0.475710869f},
-std::array<float,2>{0.608460009f, 0.847674131f},
-std::array<float,2>{0.865235507f, 0.425217986f},
-std::array<float,2>{0.200369328f, 0.768608212f},
-std::array<float,2>{0.38320744f, 0.0389255993f},
-std::array<float,2>{0.714622021f, 0.636150837f},
-std::array<float,2>{0.544262707f, 0.215738252f},
-std::array<float,2>{0.33493343f, 0.551623523f},
-std::array<float,2>{0.0202196762f, 0.275962561f},
-std::array<float,2>{0.949982047f, 0.92182821f},
-std::array<float,2>{0.566769779f, 0.468466341f},
-std::array<float,2>{0.281603664f, 0.826763988f},
-std::array<float,2>{0.106237464f, 0.0916062668f},
-std::array<float,2>{0.903828919f, 0.72171092f},
-std::array<float,2>{0.784132719f, 0.170630038f},
-std::array<float,2>{0.149609968f, 0.590689659f},
-std::array<float,2>{0.4998402f, 0.336549312f},
-std::array<float,2>{0.652612686f, 0.983973205f},
-std::array<float,2>{0.997116208f, 0.295944124f},
-std::array<float,2>{0.0457875729f, 0.888543844f},
-std::array<float,2>{0.352955192f, 0.244966909f},
-std::array<float,2>{0.52052927f, 0.511344969f},
-std::array<float,2>{0.722655296f, 0.0242450554f},
-std::array<float,2>{0.419637501f, 0.68576616f},
-std::array<float,2>{0.242785186f, 0.376295477f},
-std::array<float,2>{0.82617712f, 0.801508188f},
-std::array<float,2>{0.505023599f, 0.260821342f},
-std::array<float,2>{0.364441365f, 0.932858586f},
-std::array<float,2>{0.0502858534f, 0.194078103f},
-std::array<float,2>{0.970814884f, 0.538335979f},
-std::array<float,2>{0.830161572f, 0.0505795889f},
-std::array<float,2>{0.232922301f, 0.650137663f},
-std::array<float,2>{0.426983744f, 0.414623767f},
-std::array<float,2>{0.743837118f, 0.760461271f},
-std::array<float,2>{0.888614953f, 0.496786088f},
-std::array<float,2>{0.109733455f, 0.860004604f},
-std::array<float,2>{0.309599131f, 0.107261337f},
-std::array<float,2>{0.592398703f, 0.704333901f},
-std::array<float,2>{0.638512194f, 0.128152236f},
-std::array<float,2>{0.475021631f, 0.595502496f},
-std::array<float,2>{0.135012269f, 0.361535966f},
-std::array<float,2>{0.807837725f, 0.959949613f},
-std::array<float,2>{0.697896719f, 0.395973772f},
-std::array<float,2>{0.403086483f, 0.791979194f},
-std::array<float,2>{0.20366618f, 0.00896416791f},
-std::array<float,2>{0.845692396f, 0.660922468f},
-std::array<float,2>{0.961563349f, 0.22066474f},
-std::array<float,2>{0.0114412885f, 0.525610566f},
-std::array<float,2>{0.321314394f, 0.304365098f},
-std::array<float,2>{0.547798216f, 0.897724152f},
-std::array<float,2>{0.757265389f, 0.313192695f},
-std::array<float,2>{0.169280127f, 0.993573189f},
-std::array<float,2>{0.453483373f, 0.182050362f},
-std::array<float,2>{0.676377058f, 0.563900352f},
-std::array<float,2>{0.624689698f, 0.0735928938f},
-std::array<float,2>{0.267749071f, 0.735746503f},
-std::array<float,2>{0.0683196858f, 0.4512631f},
-std::array<float,2>{0.925580561f, 0.831523478f},
-std::array<float,2>{0.735762894f, 0.308510423f},
-std::array<float,2>{0.437352091f, 0.900305629f},
-std::array<float,2>{0.224623978f, 0.232070789f},
-std::array<float,2>{0.839021206f, 0.521384656f},
-std::array<float,2>{0.982894182f, 0.0077045178f},
-std::array<float,2>{0.0582597703f, 0.666489005f},
-std::array<float,2>{0.368410498f, 0.399473488f},
-std::array<float,2>{0.51527679f, 0.781959713f},
-std::array<float,2>{0.797556043f, 0.438064218f},
-std::array<float,2>{0.128433004f, 0.84218365f},
-std::array<float,2>{0.482448578f, 0.0645679086f},
-std::array<float,2>{0.63189292f, 0.746528089f},
-std::array<float,2>{0.58262527f, 0.177373186f},
-std::array<float,2>{0.299263805f, 0.571595728f},
-std::array<float,2>{0.121528514f, 0.322976708f},
-std::array<float,2>{0.879852235f, 0.99153024f},
-std::array<float,2>{0.561910391f, 0.413634866f},
-std::array<float,2>{0.318849355f, 0.755446196f},
-std::array<float,2>{0.0033497056f, 0.0587431937f},
-std::array<float,2>{0.953674793f, 0.643170118f},
-std::array<float,2>{0.853402555f, 0.197284713f},
-std::array<float,2>{0.217409253f, 0.543176115f},
-std::array<float,2>{0.393264472f, 0.250965685f},
-std::array<float,2>{0.691418231f, 0.92494446f},
-std::array<float,2>{0.935870767f, 0.36813724f},
-std::array<float,2>{0.0714420378f, 0.965163589f},
-std::array<float,2>{0.279899597f, 0.13768968f},
-std::array<float,2>{0.615609467f, 0.608175218f},
-std::array<float,2>{0.68219924f, 0.0999626592f},
-std::array<float,2>{0.462169111f, 0.718102992f},
-std::array<float,2>{0.158622548f, 0.488157481f},
-std::array<float,2>{0.764826119f, 0.873046577f},
-std::array<float,2>{0.599505067f, 0.328633934f},
-std::array<float,2>{0.252039075f, 0.975182235f},
-std::array<float,2>{0.0932190716f, 0.162492201f},
-std::array<float,2>{0.910807848f, 0.5802086f},
-std::array<float,2>{0.777870178f, 0.0846308768f},
-std::array<float,2>{0.185692891f, 0.730956256f},
-std::array<float,2>{0.443718821f, 0.456612319f},
-std::array<float,2>{0.656469762f, 0.81908685f},
-std::array<float,2>{0.940989375f, 0.383066207f},
-std::array<float,2>{0.0246207863f, 0.807283998f},
-std::array<float,2>{0.343150526f, 0.0169541929f},
-std::array<float,2>{0.537906349f, 0.678319693f},
-std::array<float,2>{0.703667164f, 0.23650226f},
-std::array<float,2>{0.381181508f, 0.504199088f},
-std::array<float,2>{0.189644963f, 0.285479039f},
-std::array<float,2>{0.871228039f, 0.877404809f},
-std::array<float,2>{0.641747713f, 0.483641118f},
-std::array<float,2>{0.489573032f, 0.854911089f},
-std::array<float,2>{0.147749409f, 0.111049205f},
-std::array<float,2>{0.790233791f, 0.691268981f},
-std::array<float,2>{0.894411206f, 0.144020393f},
-std::array<float,2>{0.0959308743f, 0.610155165f},
-std::array<float,2>{0.290251821f, 0.357917875f},
-std::array<float,2>{0.575626016f, 0.947368383f},
-std::array<float,2>{0.814349174f, 0.268935323f},
-std::array<float,2>{0.240911961f, 0.907462478f},
-std::array<float,2>{0.409689993f, 0.207103938f},
-std::array<float,2>{0.730335474f, 0.562110901f},
-std::array<float,2>{0.523679137f, 0.0392385907f},
-std::array<float,2>{0.350943446f, 0.63067627f},
-std::array<float,2>{0.0320366509f, 0.430245697f},
-std::array<float,2>{0.987299144f, 0.78064847f},
-std::array<float,2>{0.723035455f, 0.374639571f},
-std::array<float,2>{0.416273564f, 0.962349355f},
-std::array<float,2>{0.247977942f, 0.135524377f},
-std::array<float,2>{0.823022246f, 0.602633059f},
-std::array<float,2>{0.993424654f, 0.0938995555f},
-std::array<float,2>{0.041511111f, 0.714202106f},
-std::array<float,2>{0.355774611f, 0.491515487f},
-std::array<float,2>{0.518303156f, 0.870465696f},
-std::array<float,2>{0.788232267f, 0.408681214f},
-std::array<float,2>{0.154602885f, 0.752343416f},
-std::array<float,2>{0.495035887f, 0.0553583279f},
-std::array<float,2>{0.650971949f, 0.646761358f},
-std::array<float,2>{0.564229667f, 0.201552957f},
-std::array<float,2>{0.2855784f, 0.539973438f},
-std::array<float,2>{0.104808979f, 0.2558043f},
-std::array<float,2>{0.898677707f, 0.926185429f},
-std::array<float,2>{0.54013741f, 0.444934517f},
-std::array<float,2>{0.328322142f, 0.836198807f},
-std::array<float,2>{0.0188763142f, 0.0673972964f},
-std::array<float,2>{0.948587537f, 0.744470775f},
-std::array<float,2>{0.860927284f, 0.174372777f},
-std::array<float,2>{0.198965505f, 0.576571882f},
-std::array<float,2>{0.388451517f, 0.326291591f},
-std::array<float,2>{0.717036486f, 0.986800432f},
-std::array<float,2>{0.916570723f, 0.311022937f},
-std::array<float,2>{0.0808141828f, 0.903658569f},
-std::array<float,2>{0.261002123f, 0.228983402f},
-std::array<float,2>{0.602167249f, 0.515865564f},
-std::array<float,2>{0.668497443f, 0.00320297806f},
-std::array<float,2>{0.452897638f, 0.671395779f},
-std::array<float,2>{0.17257452f, 0.403441519f},
-std::array<float,2>{0.773146808f, 0.785955727f},
-std::array<float,2>{0.620403051f, 0.273400456f},
-std::array<float,2>{0.269727886f, 0.913524985f},
-std::array<float,2>{0.0661159307f, 0.20349814f},
-std::array<float,2>{0.927414358f, 0.556942046f},
-std::array<float,2>{0.751157284f, 0.0436365865f},
-std::array<float,2>{0.167548537f, 0.628504097f},
-std::array<float,2>{0.460448802f, 0.437013268f},
-std::array<float,2>{0.674817681f, 0.774110496f},
-std::array<float,2>{0.966960073f, 0.479085684f},
-std::array<float,2>{0.0118093733f, 0.856763422f},
-std::array<float,2>{0.326366067f, 0.115611263f},
-std::array<float,2>{0.553352416f, 0.691722691f},
-std::array<float,2>{0.699602127f, 0.144563481f},
-std::array<float,2>{0.40177846f, 0.613494396f},
-std::array<float,2>{0.208028048f, 0.35168317f},
-std::array<float,2>{0.849052846f, 0.952148318f},
-std::array<float,2>{0.633387029f, 0.387768f},
-std::array<float,2>{0.470052361f, 0.811054468f},
-std::array<float,2>{0.137079805f, 0.0223266482f},
-std::array<float,2>{0.810138464f, 0.675731122f},
-std::array<float,2>{0.8836146f, 0.241807193f},
-std::array<float,2>{0.114940681f, 0.500065446f},
-std::array<float,2>{0.30504784f, 0.282628268f},
-std::array<float,2>{0.588145435f, 0.880467951f},
-std::array<float,2>{0.834421217f, 0.332573265f},
-std::array<float,2>{0.22683984f, 0.969581723f},
-std::array<float,2>{0.42561236f, 0.156448334f},
-std::array<float,2>{0.74881953f, 0.585546732f},
-std::array<float,2>{0.500015438f, 0.0818648487f},
-std::array<float,2>{0.36237976f, 0.729085267f},
-std::array<float,2>{0.0525665618f, 0.460243613f},
-std::array<float,2>{0.973058283f, 0.813319445f},
-std::array<float,2>{0.684454143f, 0.290490568f},
-std::array<float,2>{0.467501044f, 0.88303417f},
-std::array<float,2>{0.163834468f, 0.249482244f},
-std::array<float,2>{0.757948995f, 0.514863133f},
-std::array<float,2>{0.929769874f, 0.0310857911f},
-std::array<float,2>{0.076645419f, 0.68049854f},
-std::array<float,2>{0.276777357f, 0.379413038f},
-std::array<float,2>{0.610333025f, 0.797031224f},
-std::array<float,2>{0.858338535f, 0.461109281f},
-std::array<float,2>{0.214459673f, 0.823657155f},
-std::array<float,2>{0.39728266f, 0.0868178681f},
-std::array<float,2>{0.687640309f, 0.724210501f},
-std::array<float,2>{0.556488454f, 0.164409041f},
-std::array<float,2>{0.315752029f, 0.58892566f},
-std::array<float,2>{0.00690528285f, 0.339957744f},
-std::array<float,2>{0.96051079f, 0.979945779f},
-std::array<float,2>{0.578169703f, 0.428004742f},
-std::array<float,2>{0.304388613f, 0.77091074f},
-std::array<float,2>{0.119264901f, 0.0339311659f},
-std::array<float,2>{0.878072143f, 0.637478054f},
-std::array<float,2>{0.802418113f, 0.211403772f},
-std::array<float,2>{0.129211426f, 0.54968679f},
-std::array<float,2>{0.476703465f, 0.277660072f},
-std::array<float,2>{0.627494395f, 0.916572571f},
-std::array<float,2>{0.978425622f, 0.344661653f},
-std::array<float,2>{0.0620955564f, 0.943221927f},
-std::array<float,2>{0.372908741f, 0.152604178f},
-std::array<float,2>{0.508359671f, 0.617979348f},
-std::array<float,2>{0.740200162f, 0.120035291f},
-std::array<float,2>{0.42981714f, 0.700788379f},
-std::array<float,2>{0.220157981f, 0.469355017f},
-std::array<float,2>{0.84067452f, 0.843755066f},
-std::array<float,2>{0.528052688f, 0.318778008f},
-std::array<float,2>{0.345956594f, 0.999575615f},
-std::array<float,2>{0.036323078f, 0.185177565f},
-std::array<float,2>{0.990115643f, 0.569607794f},
-std::array<float,2>{0.818414867f, 0.0770349875f},
-std::array<float,2>{0.235341609f, 0.740239084f},
-std::array<float,2>{0.413099974f, 0.446380764f},
-std::array<float,2>{0.731257319f, 0.834923565f},
-std::array<float,2>{0.896824896f, 0.394332826f},
-std::array<float,2>{0.0991783366f, 0.794649959f},
-std::array<float,2>{0.294639617f, 0.012930369f},
-std::array<float,2>{0.574123144f, 0.65939492f},
-std::array<float,2>{0.645478547f, 0.225808322f},
-std::array<float,2>{0.484784991f, 0.528333962f},
-std::array<float,2>{0.14101766f, 0.298380762f},
-std::array<float,2>{0.793531239f, 0.89249438f},
-std::array<float,2>{0.709769905f, 0.492453367f},
-std::array<float,2>{0.377709031f, 0.866804123f},
-std::array<float,2>{0.191481665f, 0.101947345f},
-std::array<float,2>{0.869927704f, 0.708659351f},
-std::array<float,2>{0.944463789f, 0.132582948f},
-std::array<float,2>{0.0306705739f, 0.598250091f},
-std::array<float,2>{0.336497456f, 0.364661813f},
-std::array<float,2>{0.53435874f, 0.955166042f},
-std::array<float,2>{0.773538172f, 0.265361696f},
-std::array<float,2>{0.181061938f, 0.93707794f},
-std::array<float,2>{0.439904451f, 0.189921662f},
-std::array<float,2>{0.662815452f, 0.533991694f},
-std::array<float,2>{0.596502542f, 0.0517645776f},
-std::array<float,2>{0.255345911f, 0.652415276f},
-std::array<float,2>{0.0892955884f, 0.418485254f},
-std::array<float,2>{0.909685075f, 0.762568474f},
-std::array<float,2>{0.654690802f, 0.338391066f},
-std::array<float,2>{0.497107297f, 0.980878711f},
-std::array<float,2>{0.151005119f, 0.169176236f},
-std::array<float,2>{0.782849014f, 0.592167854f},
-std::array<float,2>{0.904321849f, 0.0921963006f},
-std::array<float,2>{0.108425803f, 0.719052494f},
-std::array<float,2>{0.284310162f, 0.466273904f},
-std::array<float,2>{0.569069982f, 0.825686455f},
-std::array<float,2>{0.825927138f, 0.377373636f},
-std::array<float,2>{0.244566396f, 0.802798927f},
-std::array<float,2>{0.420987278f, 0.0254703742f},
-std::array<float,2>{0.720349848f, 0.684800565f},
-std::array<float,2>{0.522505939f, 0.243812323f},
-std::array<float,2>{0.355083913f, 0.5088467f},
-std::array<float,2>{0.0435657091f, 0.293524176f},
-std::array<float,2>{0.998286784f, 0.888767421f},
-std::array<float,2>{0.607075751f, 0.472819656f},
-std::array<float,2>{0.263891995f, 0.85133642f},
-std::array<float,2>{0.0832969174f, 0.122201718f},
-std::array<float,2>{0.918807447f, 0.697226226f},
-std::array<float,2>{0.766897023f, 0.15083237f},
-std::array<float,2>{0.179179579f, 0.624451995f},
-std::array<float,2>{0.447433352f, 0.348675787f},
-std::array<float,2>{0.666942835f, 0.93963939f},
-std::array<float,2>{0.953086376f, 0.274958342f},
-std::array<float,2>{0.0225060731f, 0.918153405f},
-std::array<float,2>{0.332768172f, 0.21805644f},
-std::array<float,2>{0.546111703f, 0.553038895f},
-std::array<float,2>{0.711286068f, 0.0364084691f},
-std::array<float,2>{0.386062175f, 0.63370645f},
-std::array<float,2>{0.202083737f, 0.422847658f},
-std::array<float,2>{0.863467813f, 0.76605171f},
-std::array<float,2>{0.550703049f, 0.300879866f},
-std::array<float,2>{0.32400015f, 0.895040751f},
-std::array<float,2>{0.00811592955f, 0.222343385f},
-std::array<float,2>{0.96330297f, 0.523779273f},
-std::array<float,2>{0.847127259f, 0.00988313649f},
-std::array<float,2>{0.205214605f, 0.663571f},
-std::array<float,2>{0.40532437f, 0.398178756f},
-std::array<float,2>{0.696868122f, 0.790527105f},
-std::array<float,2>{0.923571885f, 0.45092842f},
-std::array<float,2>{0.0693935603f, 0.829000175f},
-std::array<float,2>{0.266007483f, 0.0718543008f},
-std::array<float,2>{0.621967793f, 0.737049282f},
-std::array<float,2>{0.678077877f, 0.180770978f},
-std::array<float,2>{0.456954122f, 0.565906525f},
-std::array<float,2>{0.170940056f, 0.315751582f},
-std::array<float,2>{0.753998876f, 0.994362116f},
-std::array<float,2>{0.744170427f, 0.416402787f},
-std::array<float,2>{0.427811682f, 0.757855833f},
-std::array<float,2>{0.230728194f, 0.0486132987f},
-std::array<float,2>{0.82976824f, 0.650730014f},
-std::array<float,2>{0.970182717f, 0.192305833f},
-std::array<float,2>{0.0482542925f, 0.535340905f},
-std::array<float,2>{0.366060913f, 0.259595066f},
-std::array<float,2>{0.50649941f, 0.93116641f},
-std::array<float,2>{0.804824054f, 0.360437334f},
-std::array<float,2>{0.133592993f, 0.9587152f},
-std::array<float,2>{0.473802745f, 0.125744209f},
-std::array<float,2>{0.639503121f, 0.596094131f},
-std::array<float,2>{0.59168613f, 0.107702605f},
-std::array<float,2>{0.310744196f, 0.705956757f},
-std::array<float,2>{0.112352744f, 0.498905927f},
-std::array<float,2>{0.888813257f, 0.861869395f},
-std::array<float,2>{0.694856763f, 0.25299266f},
-std::array<float,2>{0.392329663f, 0.922975421f},
-std::array<float,2>{0.215763465f, 0.19562155f},
-std::array<float,2>{0.854615211f, 0.545435846f},
-std::array<float,2>{0.955561101f, 0.0611602031f},
-std::array<float,2>{0.00118807855f, 0.640786469f},
-std::array<float,2>{0.318014741f, 0.412007093f},
-std::array<float,2>{0.558916807f, 0.756762147f},
-std::array<float,2>{0.763595045f, 0.485708773f},
-std::array<float,2>{0.15727666f, 0.874345839f},
-std::array<float,2>{0.462969482f, 0.0990435109f},
-std::array<float,2>{0.681486785f, 0.716205418f},
-std::array<float,2>{0.614522576f, 0.139383703f},
-std::array<float,2>{0.278257936f, 0.606223643f},
-std::array<float,2>{0.0723940954f, 0.369640619f},
-std::array<float,2>{0.934187055f, 0.967191219f},
-std::array<float,2>{0.512839556f, 0.400832534f},
-std::array<float,2>{0.370895237f, 0.784732938f},
-std::array<float,2>{0.0561333671f, 0.00410613976f},
-std::array<float,2>{0.980846107f, 0.66595006f},
-std::array<float,2>{0.837618589f, 0.233625084f},
-std::array<float,2>{0.223387688f, 0.521954536f},
-std::array<float,2>{0.434162259f, 0.305952758f},
-std::array<float,2>{0.737291276f, 0.900712907f},
-std::array<float,2>{0.881599367f, 0.320317328f},
-std::array<float,2>{0.124596752f, 0.988384902f},
-std::array<float,2>{0.298265845f, 0.179245502f},
-std::array<float,2>{0.584047496f, 0.573421061f},
-std::array<float,2>{0.630783319f, 0.0641908497f},
-std::array<float,2>{0.480818957f, 0.748366594f},
-std::array<float,2>{0.125381812f, 0.439979732f},
-std::array<float,2>{0.799874663f, 0.840188146f},
-std::array<float,2>{0.577144623f, 0.356222123f},
-std::array<float,2>{0.291240036f, 0.945558965f},
-std::array<float,2>{0.0944487527f, 0.142031521f},
-std::array<float,2>{0.891718447f, 0.613141179f},
-std::array<float,2>{0.791266561f, 0.113186173f},
-std::array<float,2>{0.145157099f, 0.689216256f},
-std::array<float,2>{0.49136135f, 0.480550826f},
-std::array<float,2>{0.643027723f, 0.85208112f},
-std::array<float,2>{0.984734654f, 0.431753963f},
-std::array<float,2>{0.0336640514f, 0.778112531f},
-std::array<float,2>{0.348164707f, 0.0427518077f},
-std::array<float,2>{0.527214944f, 0.631643236f},
-std::array<float,2>{0.727787793f, 0.210826278f},
-std::array<float,2>{0.407379329f, 0.558726728f},
-std::array<float,2>{0.238317475f, 0.267043084f},
-std::array<float,2>{0.81450361f, 0.909548819f},
-std::array<float,2>{0.658562183f, 0.454457939f},
-std::array<float,2>{0.442975849f, 0.816537201f},
-std::array<float,2>{0.184371844f, 0.0836611986f},
-std::array<float,2>{0.780140281f, 0.733925998f},
-std::array<float,2>{0.913318634f, 0.161487728f},
-std::array<float,2>{0.0902195126f, 0.579262257f},
-std::array<float,2>{0.251407117f, 0.330929428f},
-std::array<float,2>{0.599696457f, 0.972701609f},
-std::array<float,2>{0.874509931f, 0.287623525f},
-std::array<float,2>{0.189248294f, 0.875521123f},
-std::array<float,2>{0.378906906f, 0.234552801f},
-std::array<float,2>{0.705079854f, 0.507493079f},
-std::array<float,2>{0.536881387f, 0.0185670927f},
-std::array<float,2>{0.341066927f, 0.675813437f},
-std::array<float,2>{0.0262749437f, 0.385663033f},
-std::array<float,2>{0.937643409f, 0.806631923f},
-std::array<float,2>{0.74998647f, 0.335076034f},
-std::array<float,2>{0.424709707f, 0.972166836f},
-std::array<float,2>{0.228173584f, 0.158549845f},
-std::array<float,2>{0.835225046f, 0.583880424f},
-std::array<float,2>{0.974115908f, 0.0793151334f},
-std::array<float,2>{0.051094044f, 0.727192581f},
-std::array<float,2>{0.362280518f, 0.457895488f},
-std::array<float,2>{0.501065135f, 0.815807402f},
-std::array<float,2>{0.808645666f, 0.38967526f},
-std::array<float,2>{0.138200417f, 0.809218585f},
-std::array<float,2>{0.468751848f, 0.0204930361f},
-std::array<float,2>{0.634135544f, 0.673367918f},
-std::array<float,2>{0.589189351f, 0.238830343f},
-std::array<float,2>{0.306330472f, 0.503765166f},
-std::array<float,2>{0.113357447f, 0.284476697f},
-std::array<float,2>{0.884415209f, 0.881496668f},
-std::array<float,2>{0.554063022f, 0.477750987f},
-std::array<float,2>{0.327262789f, 0.857654989f},
-std::array<float,2>{0.0132888537f, 0.11390923f},
-std::array<float,2>{0.96796757f, 0.694147646f},
-std::array<float,2>{0.847790241f, 0.146797046f},
-std::array<float,2>{0.207303703f, 0.615735531f},
-std::array<float,2>{0.400752723f, 0.354084164f},
-std::array<float,2>{0.700562716f, 0.950356126f},
-std::array<float,2>{0.925963998f, 0.271155804f},
-std::array<float,2>{0.0650256947f, 0.910561144f},
-std::array<float,2>{0.270984381f, 0.206899241f},
-std::array<float,2>{0.619530737f, 0.554890037f},
-std::array<float,2>{0.673932016f, 0.0452474207f},
-std::array<float,2>{0.459955573f, 0.625428498f},
-std::array<float,2>{0.166671336f, 0.434691399f},
-std::array<float,2>{0.750624061f, 0.776305318f},
-std::array<float,2>{0.602721989f, 0.310525656f},
-std::array<float,2>{0.260265261f, 0.905472219f},
-std::array<float,2>{0.0820114687f, 0.227780998f},
-std::array<float,2>{0.917297125f, 0.518170238f},
-std::array<float,2>{0.772033274f, 0.000534428633f},
-std::array<float,2>{0.173597947f, 0.668186247f},
-std::array<float,2>{0.451717257f, 0.404973865f},
-std::array<float,2>{0.66908139f, 0.788962007f},
-std::array<float,2>{0.948180616f, 0.441971838f},
-std::array<float,2>{0.0183495395f, 0.838244975f},
-std::array<float,2>{0.329130799f, 0.0702467784f},
-std::array<float,2>{0.539501965f, 0.743523955f},
-std::array<float,2>{0.717924774f, 0.173192501f},
-std::array<float,2>{0.386894077f, 0.57482481f},
-std::array<float,2>{0.197656661f, 0.324228644f},
-std::array<float,2>{0.86020571f, 0.986190319f},
-std::array<float,2>{0.65136981f, 0.406594217f},
-std::array<float,2>{0.495868474f, 0.750118017f},
-std::array<float,2>{0.156072214f, 0.0582247786f},
-std::array<float,2>{0.787465632f, 0.645897925f},
-std::array<float,2>{0.899685085f, 0.200252578f},
-std::array<float,2>{0.104209825f, 0.541562021f},
-std::array<float,2>{0.286702067f, 0.257241368f},
-std::array<float,2>{0.562538803f, 0.929128289f},
-std::array<float,2>{0.823724449f, 0.372790188f},
-std::array<float,2>{0.246501565f, 0.963176072f},
-std::array<float,2>{0.417400837f, 0.133816555f},
-std::array<float,2>{0.723963499f, 0.604342341f},
-std::array<float,2>{0.519129217f, 0.0958715677f},
-std::array<float,2>{0.35716337f, 0.712375522f},
-std::array<float,2>{0.0423803665f, 0.490166605f},
-std::array<float,2>{0.992589295f, 0.868795455f},
-std::array<float,2>{0.66377461f, 0.263371378f},
-std::array<float,2>{0.440765887f, 0.933857322f},
-std::array<float,2>{0.180098221f, 0.189363867f},
-std::array<float,2>{0.774596035f, 0.531904101f},
-std::array<float,2>{0.909032106f, 0.0541027971f},
-std::array<float,2>{0.0886957049f, 0.655528307f},
-std::array<float,2>{0.254580408f, 0.420459449f},
-std::array<float,2>{0.597078443f, 0.763920784f},
-std::array<float,2>{0.870783031f, 0.494817764f},
-std::array<float,2>{0.192794278f, 0.864183843f},
-std::array<float,2>{0.378860205f, 0.10426379f},
-std::array<float,2>{0.710484922f, 0.70922637f},
-std::array<float,2>{0.534124792f, 0.128960416f},
-std::array<float,2>{0.337252349f, 0.599716187f},
-std::array<float,2>{0.0293104369f, 0.365397811f},
-std::array<float,2>{0.943691313f, 0.954569876f},
-std::array<float,2>{0.572733164f, 0.390808553f},
-std::array<float,2>{0.293764561f, 0.795291483f},
-std::array<float,2>{0.0979700759f, 0.014414778f},
-std::array<float,2>{0.898015976f, 0.656330645f},
-std::array<float,2>{0.794062495f, 0.223644793f},
-std::array<float,2>{0.142208993f, 0.530500829f},
-std::array<float,2>{0.48591584f, 0.300234824f},
-std::array<float,2>{0.646314144f, 0.89362824f},
-std::array<float,2>{0.988697588f, 0.317067266f},
-std::array<float,2>{0.035475418f, 0.99790597f},
-std::array<float,2>{0.347340733f, 0.187233195f},
-std::array<float,2>{0.528705239f, 0.567326903f},
-std::array<float,2>{0.731675863f, 0.0757941529f},
-std::array<float,2>{0.413001448f, 0.738584757f},
-std::array<float,2>{0.236247674f, 0.448986918f},
-std::array<float,2>{0.820295751f, 0.833648562f},
-std::array<float,2>{0.509072721f, 0.345828354f},
-std::array<float,2>{0.371717095f, 0.943665028f},
-std::array<float,2>{0.0614943579f, 0.155728802f},
-std::array<float,2>{0.97751224f, 0.620051861f},
-std::array<float,2>{0.841689587f, 0.118261114f},
-std::array<float,2>{0.218817756f, 0.701907039f},
-std::array<float,2>{0.430990517f, 0.472543776f},
-std::array<float,2>{0.738468468f, 0.846050382f},
-std::array<float,2>{0.877266169f, 0.426809132f},
-std::array<float,2>{0.120851673f, 0.772119403f},
-std::array<float,2>{0.303408474f, 0.0326186121f},
-std::array<float,2>{0.579454601f, 0.639377952f},
-std::array<float,2>{0.628663599f, 0.213515669f},
-std::array<float,2>{0.477714092f, 0.547520638f},
-std::array<float,2>{0.130288929f, 0.280924082f},
-std::array<float,2>{0.801201761f, 0.915576994f},
-std::array<float,2>{0.689241052f, 0.464738846f},
-std::array<float,2>{0.397561401f, 0.821799397f},
-std::array<float,2>{0.21333839f, 0.0886576995f},
-std::array<float,2>{0.858659029f, 0.724846184f},
-std::array<float,2>{0.959810078f, 0.166749433f},
-std::array<float,2>{0.00681050727f, 0.587005496f},
-std::array<float,2>{0.314587831f, 0.343224943f},
-std::array<float,2>{0.555251896f, 0.977103829f},
-std::array<float,2>{0.759173095f, 0.292211473f},
-std::array<float,2>{0.162137777f, 0.884927928f},
-std::array<float,2>{0.46844551f, 0.247200936f},
-std::array<float,2>{0.685257614f, 0.512391865f},
-std::array<float,2>{0.611138403f, 0.0276757926f},
-std::array<float,2>{0.275926739f, 0.683220685f},
-std::array<float,2>{0.0774756446f, 0.3826271f},
-std::array<float,2>{0.931049585f, 0.799785793f},
-std::array<float,2>{0.639898717f, 0.3624143f},
-std::array<float,2>{0.473429203f, 0.960698426f},
-std::array<float,2>{0.13410905f, 0.127600208f},
-std::array<float,2>{0.806155622f, 0.594154119f},
-std::array<float,2>{0.890571594f, 0.106230818f},
-std::array<float,2>{0.112240486f, 0.70407027f},
-std::array<float,2>{0.312246233f, 0.497758538f},
-std::array<float,2>{0.5906232f, 0.860365093f},
-std::array<float,2>{0.828347325f, 0.415849626f},
-std::array<float,2>{0.232174844f, 0.760939837f},
-std::array<float,2>{0.429068178f, 0.0492572263f},
-std::array<float,2>{0.745681345f, 0.649054945f},
-std::array<float,2>{0.507326424f, 0.194959328f},
-std::array<float,2>{0.366761863f, 0.537412822f},
-std::array<float,2>{0.0476949662f, 0.260402411f},
-std::array<float,2>{0.969350219f, 0.932165682f},
-std::array<float,2>{0.622106671f, 0.452889264f},
-std::array<float,2>{0.267558306f, 0.830128133f},
-std::array<float,2>{0.0686365888f, 0.0727493986f},
-std::array<float,2>{0.922506869f, 0.735344052f},
-std::array<float,2>{0.75582099f, 0.182823792f},
-std::array<float,2>{0.170023188f, 0.562949419f},
-std::array<float,2>{0.455483675f, 0.314163655f},
-std::array<float,2>{0.679436207f, 0.992674232f},
-std::array<float,2>{0.964303911f, 0.302750111f},
-std::array<float,2>{0.00881268829f, 0.896743357f},
-std::array<float,2>{0.322497457f, 0.219509155f},
-std::array<float,2>{0.549659193f, 0.526891351f},
-std::array<float,2>{0.696197212f, 0.00821340084f},
-std::array<float,2>{0.405181676f, 0.66202718f},
-std::array<float,2>{0.206351906f, 0.395000994f},
-std::array<float,2>{0.846407115f, 0.792407513f},
-std::array<float,2>{0.545118034f, 0.276880324f},
-std::array<float,2>{0.333850086f, 0.920123398f},
-std::array<float,2>{0.0221786406f, 0.216572061f},
-std::array<float,2>{0.952088416f, 0.552622318f},
-std::array<float,2>{0.865202963f, 0.0378379822f},
-std::array<float,2>{0.203123435f, 0.635093868f},
-std::array<float,2>{0.385688812f, 0.424357384f},
-std::array<float,2>{0.712115169f, 0.768063307f},
-std::array<float,2>{0.919086337f, 0.475391358f},
-std::array<float,2>{0.0822702199f, 0.848693967f},
-std::array<float,2>{0.265191406f, 0.123936906f},
-std::array<float,2>{0.606024921f, 0.697572887f},
-std::array<float,2>{0.667018712f, 0.149154291f},
-std::array<float,2>{0.44846952f, 0.621794581f},
-std::array<float,2>{0.178301483f, 0.350636512f},
-std::array<float,2>{0.766020238f, 0.938159466f},
-std::array<float,2>{0.7194134f, 0.375526547f},
-std::array<float,2>{0.420497626f, 0.802673936f},
-std::array<float,2>{0.245426595f, 0.0251085684f},
-std::array<float,2>{0.825024903f, 0.686745524f},
-std::array<float,2>{0.999912918f, 0.245343745f},
-std::array<float,2>{0.0448524542f, 0.510592699f},
-std::array<float,2>{0.353610903f, 0.295797706f},
-std::array<float,2>{0.521892846f, 0.886870623f},
-std::array<float,2>{0.781636298f, 0.337001741f},
-std::array<float,2>{0.151696742f, 0.9829368f},
-std::array<float,2>{0.496666968f, 0.171144754f},
-std::array<float,2>{0.655408263f, 0.591343641f},
-std::array<float,2>{0.569367766f, 0.0900651515f},
-std::array<float,2>{0.283947796f, 0.720876276f},
-std::array<float,2>{0.107470572f, 0.466924846f},
-std::array<float,2>{0.905917466f, 0.827340603f},
-std::array<float,2>{0.706427097f, 0.28640148f},
-std::array<float,2>{0.380340815f, 0.878116846f},
-std::array<float,2>{0.188430458f, 0.23762399f},
-std::array<float,2>{0.873607516f, 0.505684197f},
-std::array<float,2>{0.939135313f, 0.0160793699f},
-std::array<float,2>{0.0271633733f, 0.679602742f},
-std::array<float,2>{0.339918554f, 0.383937776f},
-std::array<float,2>{0.535907865f, 0.808483064f},
-std::array<float,2>{0.780777752f, 0.455566943f},
-std::array<float,2>{0.184957579f, 0.819998801f},
-std::array<float,2>{0.441437781f, 0.0859279633f},
-std::array<float,2>{0.659897804f, 0.731598675f},
-std::array<float,2>{0.600715876f, 0.163446024f},
-std::array<float,2>{0.250809103f, 0.581558347f},
-std::array<float,2>{0.0911472216f, 0.329135329f},
-std::array<float,2>{0.912829876f, 0.975678205f},
-std::array<float,2>{0.525869012f, 0.431083083f},
-std::array<float,2>{0.349440753f, 0.779959202f},
-std::array<float,2>{0.0344169326f, 0.0402739495f},
-std::array<float,2>{0.985410094f, 0.628940105f},
-std::array<float,2>{0.816239595f, 0.208920375f},
-std::array<float,2>{0.240021527f, 0.560577929f},
-std::array<float,2>{0.407045424f, 0.268284619f},
-std::array<float,2>{0.727326751f, 0.906948209f},
-std::array<float,2>{0.891394734f, 0.358884573f},
-std::array<float,2>{0.0947572663f, 0.948781431f},
-std::array<float,2>{0.29245761f, 0.142964378f},
-std::array<float,2>{0.577815473f, 0.611315608f},
-std::array<float,2>{0.643966675f, 0.10969124f},
-std::array<float,2>{0.490679651f, 0.689536214f},
-std::array<float,2>{0.146224648f, 0.482521564f},
-std::array<float,2>{0.792531788f, 0.854467154f},
-std::array<float,2>{0.585261166f, 0.323957264f},
-std::array<float,2>{0.296934187f, 0.990779221f},
-std::array<float,2>{0.12361031f, 0.176485822f},
-std::array<float,2>{0.882246077f, 0.570619226f},
-std::array<float,2>{0.79918462f, 0.0663291886f},
-std::array<float,2>{0.126665786f, 0.747996509f},
-std::array<float,2>{0.481573164f, 0.438658357f},
-std::array<float,2>{0.629705608f, 0.843051195f},
-std::array<float,2>{0.982075036f, 0.39845714f},
-std::array<float,2>{0.0555026494f, 0.782832742f},
-std::array<float,2>{0.37009427f, 0.00642665941f},
-std::array<float,2>{0.512235403f, 0.667068183f},
-std::array<float,2>{0.737722516f, 0.230503008f},
-std::array<float,2>{0.434764385f, 0.520075679f},
-std::array<float,2>{0.223774329f, 0.307272404f},
-std::array<float,2>{0.83632654f, 0.899275422f},
-std::array<float,2>{0.680495799f, 0.486331552f},
-std::array<float,2>{0.464460939f, 0.871886611f},
-std::array<float,2>{0.156646237f, 0.101555139f},
-std::array<float,2>{0.762222409f, 0.717531443f},
-std::array<float,2>{0.934915185f, 0.137864947f},
-std::array<float,2>{0.0739022195f, 0.608434081f},
-std::array<float,2>{0.278415054f, 0.368175596f},
-std::array<float,2>{0.614170194f, 0.966395557f},
-std::array<float,2>{0.854485631f, 0.251734614f},
-std::array<float,2>{0.216497526f, 0.924620271f},
-std::array<float,2>{0.391383857f, 0.198810294f},
-std::array<float,2>{0.693845212f, 0.544578254f},
-std::array<float,2>{0.559772909f, 0.0601101816f},
-std::array<float,2>{0.316784203f, 0.644414127f},
-std::array<float,2>{6.17581609e-05f, 0.41300866f},
-std::array<float,2>{0.956305385f, 0.754573107f},
-std::array<float,2>{0.702217579f, 0.353093445f},
-std::array<float,2>{0.39888978f, 0.952339351f},
-std::array<float,2>{0.210807294f, 0.145602942f},
-std::array<float,2>{0.849917769f, 0.614425123f},
-std::array<float,2>{0.965797663f, 0.116392836f},
-std::array<float,2>{0.0152727673f, 0.692639291f},
-std::array<float,2>{0.324999481f, 0.480359852f},
-std::array<float,2>{0.551588774f, 0.85556531f},
-std::array<float,2>{0.752040625f, 0.435682178f},
-std::array<float,2>{0.165363938f, 0.775264025f},
-std::array<float,2>{0.458619773f, 0.0445481874f},
-std::array<float,2>{0.672245502f, 0.627891541f},
-std::array<float,2>{0.617439508f, 0.204798594f},
-std::array<float,2>{0.272327185f, 0.558037281f},
-std::array<float,2>{0.0643868819f, 0.272237629f},
-std::array<float,2>{0.928897798f, 0.912818253f},
-std::array<float,2>{0.502158225f, 0.459044695f},
-std::array<float,2>{0.361083955f, 0.813820183f},
-std::array<float,2>{0.0536863245f, 0.0810038298f},
-std::array<float,2>{0.975765407f, 0.729499876f},
-std::array<float,2>{0.833029747f, 0.158112571f},
-std::array<float,2>{0.228773355f, 0.584497392f},
-std::array<float,2>{0.423122555f, 0.333914161f},
-std::array<float,2>{0.7476632f, 0.969801784f},
-std::array<float,2>{0.88663429f, 0.281663239f},
-std::array<float,2>{0.116614744f, 0.879167557f},
-std::array<float,2>{0.307121068f, 0.241179749f},
-std::array<float,2>{0.587644875f, 0.501442492f},
-std::array<float,2>{0.635209084f, 0.0227499623f},
-std::array<float,2>{0.471668601f, 0.674450338f},
-std::array<float,2>{0.140448466f, 0.387171119f},
-std::array<float,2>{0.811928988f, 0.812206805f},
-std::array<float,2>{0.566156626f, 0.254211068f},
-std::array<float,2>{0.288205057f, 0.926967621f},
-std::array<float,2>{0.103505626f, 0.202932552f},
-std::array<float,2>{0.9022789f, 0.540721655f},
-std::array<float,2>{0.786035061f, 0.0561687276f},
-std::array<float,2>{0.153917879f, 0.647693455f},
-std::array<float,2>{0.493914992f, 0.409878075f},
-std::array<float,2>{0.648788273f, 0.75302434f},
-std::array<float,2>{0.995022655f, 0.491064429f},
-std::array<float,2>{0.0395429954f, 0.869872272f},
-std::array<float,2>{0.358840615f, 0.0948694646f},
-std::array<float,2>{0.515990734f, 0.713767827f},
-std::array<float,2>{0.726195037f, 0.136056289f},
-std::array<float,2>{0.416014552f, 0.601905823f},
-std::array<float,2>{0.249051064f, 0.373569071f},
-std::array<float,2>{0.822216511f, 0.961838365f},
-std::array<float,2>{0.67054528f, 0.403105676f},
-std::array<float,2>{0.450786233f, 0.78614825f},
-std::array<float,2>{0.174732283f, 0.00266208965f},
-std::array<float,2>{0.769890606f, 0.670198977f},
-std::array<float,2>{0.915269732f, 0.229735389f},
-std::array<float,2>{0.0797828212f, 0.517512858f},
-std::array<float,2>{0.259368837f, 0.311745733f},
-std::array<float,2>{0.604474723f, 0.903035283f},
-std::array<float,2>{0.862167597f, 0.327251881f},
-std::array<float,2>{0.196135238f, 0.98772639f},
-std::array<float,2>{0.389759094f, 0.175185457f},
-std::array<float,2>{0.714851797f, 0.578092813f},
-std::array<float,2>{0.5416224f, 0.0664974451f},
-std::array<float,2>{0.331230134f, 0.746031046f},
-std::array<float,2>{0.016313158f, 0.443633199f},
-std::array<float,2>{0.946710229f, 0.836986721f},
-std::array<float,2>{0.646856427f, 0.297842264f},
-std::array<float,2>{0.486518651f, 0.891426861f},
-std::array<float,2>{0.143517807f, 0.225559786f},
-std::array<float,2>{0.796376288f, 0.528151572f},
-std::array<float,2>{0.894824624f, 0.0120445956f},
-std::array<float,2>{0.101434156f, 0.658253193f},
-std::array<float,2>{0.296350598f, 0.393294722f},
-std::array<float,2>{0.570602834f, 0.793714166f},
-std::array<float,2>{0.818003953f, 0.445751816f},
-std::array<float,2>{0.236756548f, 0.835059345f},
-std::array<float,2>{0.411648422f, 0.0779964849f},
-std::array<float,2>{0.734374881f, 0.741999269f},
-std::array<float,2>{0.530596673f, 0.183742896f},
-std::array<float,2>{0.344571382f, 0.568753839f},
-std::array<float,2>{0.0382337756f, 0.320192903f},
-std::array<float,2>{0.991929352f, 0.99890995f},
-std::array<float,2>{0.594663322f, 0.419422299f},
-std::array<float,2>{0.255977362f, 0.763195634f},
-std::array<float,2>{0.0866221339f, 0.0510737114f},
-std::array<float,2>{0.907381833f, 0.653774381f},
-std::array<float,2>{0.777154684f, 0.191039443f},
-std::array<float,2>{0.182100505f, 0.534317851f},
-std::array<float,2>{0.438657463f, 0.264473647f},
-std::array<float,2>{0.660698533f, 0.935676396f},
-std::array<float,2>{0.94302994f, 0.363395661f},
-std::array<float,2>{0.0288975053f, 0.956556439f},
-std::array<float,2>{0.339481145f, 0.130959913f},
-std::array<float,2>{0.532529294f, 0.599071205f},
-std::array<float,2>{0.707273841f, 0.102776073f},
-std::array<float,2>{0.376733422f, 0.707729399f},
-std::array<float,2>{0.194713667f, 0.493331879f},
-std::array<float,2>{0.867399991f, 0.86588645f},
-std::array<float,2>{0.556835592f, 0.341789514f},
-std::array<float,2>{0.314053714f, 0.979106426f},
-std::array<float,2>{0.00495913066f, 0.165855169f},
-std::array<float,2>{0.9576177f, 0.587906063f},
-std::array<float,2>{0.857257128f, 0.0874793977f},
-std::array<float,2>{0.212262169f, 0.722750306f},
-std::array<float,2>{0.394868731f, 0.462391138f},
-std::array<float,2>{0.690392077f, 0.82259202f},
-std::array<float,2>{0.932786047f, 0.380305737f},
-std::array<float,2>{0.0758507028f, 0.798573673f},
-std::array<float,2>{0.274484724f, 0.0293182973f},
-std::array<float,2>{0.611349225f, 0.681344092f},
-std::array<float,2>{0.686539114f, 0.248667613f},
-std::array<float,2>{0.466691822f, 0.514324188f},
-std::array<float,2>{0.160688847f, 0.289989412f},
-std::array<float,2>{0.760977745f, 0.88450098f},
-std::array<float,2>{0.74085933f, 0.470277339f},
-std::array<float,2>{0.432722747f, 0.844781399f},
-std::array<float,2>{0.221873119f, 0.12073113f},
-std::array<float,2>{0.843230665f, 0.699377298f},
-std::array<float,2>{0.978528678f, 0.153352648f},
-std::array<float,2>{0.0593711548f, 0.618835688f},
-std::array<float,2>{0.373475969f, 0.345072389f},
-std::array<float,2>{0.510888577f, 0.941509545f},
-std::array<float,2>{0.802759528f, 0.27925694f},
-std::array<float,2>{0.131355062f, 0.917776585f},
-std::array<float,2>{0.479811192f, 0.212037519f},
-std::array<float,2>{0.62634325f, 0.550390065f},
-std::array<float,2>{0.580619276f, 0.0351473913f},
-std::array<float,2>{0.302680135f, 0.638644695f},
-std::array<float,2>{0.118483491f, 0.42911458f},
-std::array<float,2>{0.876479089f, 0.770074129f},
-std::array<float,2>{0.677111208f, 0.31487143f},
-std::array<float,2>{0.454235673f, 0.99580878f},
-std::array<float,2>{0.168938518f, 0.18009524f},
-std::array<float,2>{0.756556809f, 0.565025091f},
-std::array<float,2>{0.924501061f, 0.0708567351f},
-std::array<float,2>{0.0668929368f, 0.737909377f},
-std::array<float,2>{0.269057095f, 0.450178385f},
-std::array<float,2>{0.623178065f, 0.829908371f},
-std::array<float,2>{0.84409523f, 0.396578133f},
-std::array<float,2>{0.204573974f, 0.78944397f},
-std::array<float,2>{0.403583288f, 0.0111274906f},
-std::array<float,2>{0.699215829f, 0.662882149f},
-std::array<float,2>{0.548264384f, 0.221496552f},
-std::array<float,2>{0.320642024f, 0.524811089f},
-std::array<float,2>{0.0100422828f, 0.302623481f},
-std::array<float,2>{0.962723255f, 0.896119535f},
-std::array<float,2>{0.593062937f, 0.49931255f},
-std::array<float,2>{0.308670372f, 0.863144636f},
-std::array<float,2>{0.110891551f, 0.10906525f},
-std::array<float,2>{0.88673991f, 0.706766248f},
-std::array<float,2>{0.807315946f, 0.126383573f},
-std::array<float,2>{0.136014432f, 0.596841455f},
-std::array<float,2>{0.475649208f, 0.360020369f},
-std::array<float,2>{0.636853099f, 0.957429528f},
-std::array<float,2>{0.971791446f, 0.258718431f},
-std::array<float,2>{0.0497625992f, 0.929897249f},
-std::array<float,2>{0.364176214f, 0.193227693f},
-std::array<float,2>{0.50435102f, 0.536241531f},
-std::array<float,2>{0.742289305f, 0.0478398539f},
-std::array<float,2>{0.426515341f, 0.651900887f},
-std::array<float,2>{0.234062448f, 0.417566895f},
-std::array<float,2>{0.831417441f, 0.759112954f},
-std::array<float,2>{0.519928813f, 0.294387788f},
-std::array<float,2>{0.352271587f, 0.890242755f},
-std::array<float,2>{0.0461896472f, 0.243111253f},
-std::array<float,2>{0.996872425f, 0.508440137f},
-std::array<float,2>{0.827342093f, 0.0265118834f},
-std::array<float,2>{0.24332805f, 0.683673024f},
-std::array<float,2>{0.41807878f, 0.378871888f},
-std::array<float,2>{0.721195161f, 0.803946972f},
-std::array<float,2>{0.902965307f, 0.465388536f},
-std::array<float,2>{0.106581494f, 0.824726462f},
-std::array<float,2>{0.283127844f, 0.0935116634f},
-std::array<float,2>{0.567395151f, 0.720244467f},
-std::array<float,2>{0.653949976f, 0.168224692f},
-std::array<float,2>{0.498340905f, 0.593729973f},
-std::array<float,2>{0.148618653f, 0.339541078f},
-std::array<float,2>{0.78512007f, 0.981629014f},
-std::array<float,2>{0.713238716f, 0.423235834f},
-std::array<float,2>{0.384238541f, 0.76668483f},
-std::array<float,2>{0.199975878f, 0.0358628929f},
-std::array<float,2>{0.866789043f, 0.634601653f},
-std::array<float,2>{0.951093376f, 0.217103183f},
-std::array<float,2>{0.0209729131f, 0.55464071f},
-std::array<float,2>{0.335127443f, 0.273840457f},
-std::array<float,2>{0.542971611f, 0.919342279f},
-std::array<float,2>{0.768854439f, 0.348415673f},
-std::array<float,2>{0.177458987f, 0.941178858f},
-std::array<float,2>{0.446256608f, 0.151439145f},
-std::array<float,2>{0.665164292f, 0.623508275f},
-std::array<float,2>{0.608009577f, 0.121381082f},
-std::array<float,2>{0.26327315f, 0.69604671f},
-std::array<float,2>{0.0857626423f, 0.474471539f},
-std::array<float,2>{0.920431614f, 0.849989712f},
-std::array<float,2>{0.729305863f, 0.266582966f},
-std::array<float,2>{0.408277333f, 0.909011841f},
-std::array<float,2>{0.241700947f, 0.209061846f},
-std::array<float,2>{0.813380003f, 0.559993267f},
-std::array<float,2>{0.988108158f, 0.0412859097f},
-std::array<float,2>{0.0326456949f, 0.632783592f},
-std::array<float,2>{0.35010913f, 0.432890415f},
-std::array<float,2>{0.524771333f, 0.779233098f},
-std::array<float,2>{0.78934586f, 0.48210609f},
-std::array<float,2>{0.146730512f, 0.852838278f},
-std::array<float,2>{0.488468051f, 0.111820213f},
-std::array<float,2>{0.641136944f, 0.688438416f},
-std::array<float,2>{0.574946761f, 0.140867233f},
-std::array<float,2>{0.289960444f, 0.611982167f},
-std::array<float,2>{0.0970659778f, 0.357400835f},
-std::array<float,2>{0.893159926f, 0.946427047f},
-std::array<float,2>{0.538571239f, 0.386548132f},
-std::array<float,2>{0.341934621f, 0.805339396f},
-std::array<float,2>{0.0236901641f, 0.0185187086f},
-std::array<float,2>{0.939519405f, 0.677042484f},
-std::array<float,2>{0.872603595f, 0.235551253f},
-std::array<float,2>{0.191269755f, 0.506537855f},
-std::array<float,2>{0.382424206f, 0.288764238f},
-std::array<float,2>{0.704526186f, 0.876577377f},
-std::array<float,2>{0.911617339f, 0.331628919f},
-std::array<float,2>{0.0919105709f, 0.974474728f},
-std::array<float,2>{0.253400594f, 0.160417765f},
-std::array<float,2>{0.598280191f, 0.578461468f},
-std::array<float,2>{0.658137619f, 0.0823744386f},
-std::array<float,2>{0.444579273f, 0.732819796f},
-std::array<float,2>{0.186805367f, 0.453341663f},
-std::array<float,2>{0.77928555f, 0.817826509f},
-std::array<float,2>{0.616876304f, 0.370204479f},
-std::array<float,2>{0.280573338f, 0.968592763f},
-std::array<float,2>{0.071190916f, 0.139822319f},
-std::array<float,2>{0.937490582f, 0.606788456f},
-std::array<float,2>{0.764010608f, 0.0985691473f},
-std::array<float,2>{0.159698427f, 0.714878559f},
-std::array<float,2>{0.461799264f, 0.485344589f},
-std::array<float,2>{0.682991385f, 0.873978794f},
-std::array<float,2>{0.954697549f, 0.410631001f},
-std::array<float,2>{0.00219666236f, 0.756871223f},
-std::array<float,2>{0.319720417f, 0.062497016f},
-std::array<float,2>{0.561219215f, 0.642196476f},
-std::array<float,2>{0.69243592f, 0.196938962f},
-std::array<float,2>{0.393982112f, 0.546796978f},
-std::array<float,2>{0.218037918f, 0.25214687f},
-std::array<float,2>{0.852215528f, 0.92265749f},
-std::array<float,2>{0.631131709f, 0.440788925f},
-std::array<float,2>{0.483670056f, 0.841739595f},
-std::array<float,2>{0.127040684f, 0.062888369f},
-std::array<float,2>{0.798532605f, 0.749285698f},
-std::array<float,2>{0.880812049f, 0.177832156f},
-std::array<float,2>{0.122135676f, 0.57289362f},
-std::array<float,2>{0.300305665f, 0.32205385f},
-std::array<float,2>{0.583394051f, 0.989333093f},
-std::array<float,2>{0.838103414f, 0.305355757f},
-std::array<float,2>{0.225819275f, 0.901762486f},
-std::array<float,2>{0.435661018f, 0.233094066f},
-std::array<float,2>{0.734736502f, 0.52261579f},
-std::array<float,2>{0.514029741f, 0.00488555431f},
-std::array<float,2>{0.368002445f, 0.664127648f},
-std::array<float,2>{0.0572822802f, 0.402140886f},
-std::array<float,2>{0.9837749f, 0.784117043f},
-std::array<float,2>{0.689484835f, 0.343453377f},
-std::array<float,2>{0.395426095f, 0.976704895f},
-std::array<float,2>{0.212600723f, 0.166396275f},
-std::array<float,2>{0.856869578f, 0.587816119f},
-std::array<float,2>{0.957258463f, 0.088266775f},
-std::array<float,2>{0.0055535268f, 0.725175321f},
-std::array<float,2>{0.31375432f, 0.464140266f},
-std::array<float,2>{0.55720669f, 0.821495116f},
-std::array<float,2>{0.761624336f, 0.381989211f},
-std::array<float,2>{0.160157979f, 0.798860252f},
-std::array<float,2>{0.466172606f, 0.0282983184f},
-std::array<float,2>{0.687122166f, 0.682939053f},
-std::array<float,2>{0.612101674f, 0.247745976f},
-std::array<float,2>{0.275331587f, 0.511767149f},
-std::array<float,2>{0.0755797103f, 0.292541564f},
-std::array<float,2>{0.933262765f, 0.885635495f},
-std::array<float,2>{0.511690438f, 0.471935809f},
-std::array<float,2>{0.373758972f, 0.846389234f},
-std::array<float,2>{0.0590449311f, 0.118947901f},
-std::array<float,2>{0.97927624f, 0.701539516f},
-std::array<float,2>{0.843711555f, 0.155884191f},
-std::array<float,2>{0.222569361f, 0.619327009f},
-std::array<float,2>{0.433532149f, 0.346640646f},
-std::array<float,2>{0.740389884f, 0.944076598f},
-std::array<float,2>{0.876310706f, 0.280389488f},
-std::array<float,2>{0.119060606f, 0.915158391f},
-std::array<float,2>{0.302005887f, 0.21322684f},
-std::array<float,2>{0.580145895f, 0.547070801f},
-std::array<float,2>{0.626698196f, 0.0331838727f},
-std::array<float,2>{0.48016122f, 0.639139056f},
-std::array<float,2>{0.131065592f, 0.427354962f},
-std::array<float,2>{0.803429365f, 0.771489501f},
-std::array<float,2>{0.57104522f, 0.300615638f},
-std::array<float,2>{0.296620876f, 0.894244611f},
-std::array<float,2>{0.100886077f, 0.224583521f},
-std::array<float,2>{0.895451963f, 0.530829966f},
-std::array<float,2>{0.796489894f, 0.0140460031f},
-std::array<float,2>{0.14295496f, 0.656953812f},
-std::array<float,2>{0.486921579f, 0.391496211f},
-std::array<float,2>{0.647364855f, 0.795658231f},
-std::array<float,2>{0.991226017f, 0.448412478f},
-std::array<float,2>{0.039052438f, 0.833090007f},
-std::array<float,2>{0.344041646f, 0.0752467811f},
-std::array<float,2>{0.53079772f, 0.738921404f},
-std::array<float,2>{0.73359704f, 0.186665729f},
-std::array<float,2>{0.411603779f, 0.566758096f},
-std::array<float,2>{0.237030745f, 0.316725671f},
-std::array<float,2>{0.817613602f, 0.997512281f},
-std::array<float,2>{0.660403609f, 0.420390785f},
-std::array<float,2>{0.439434856f, 0.764258444f},
-std::array<float,2>{0.18257612f, 0.0545840487f},
-std::array<float,2>{0.776669145f, 0.655879915f},
-std::array<float,2>{0.907724977f, 0.188942045f},
-std::array<float,2>{0.086057052f, 0.531377792f},
-std::array<float,2>{0.256502807f, 0.262922734f},
-std::array<float,2>{0.59383899f, 0.934110463f},
-std::array<float,2>{0.868113697f, 0.365879744f},
-std::array<float,2>{0.195048094f, 0.954813957f},
-std::array<float,2>{0.376165211f, 0.129689023f},
-std::array<float,2>{0.707703054f, 0.600121796f},
-std::array<float,2>{0.533186376f, 0.103656381f},
-std::array<float,2>{0.339155316f, 0.709735453f},
-std::array<float,2>{0.028402511f, 0.49442482f},
-std::array<float,2>{0.942573071f, 0.86356163f},
-std::array<float,2>{0.64918673f, 0.257674783f},
-std::array<float,2>{0.493406415f, 0.929514647f},
-std::array<float,2>{0.153804541f, 0.200930908f},
-std::array<float,2>{0.785283267f, 0.541230023f},
-std::array<float,2>{0.901590288f, 0.0578215308f},
-std::array<float,2>{0.102595374f, 0.646480918f},
-std::array<float,2>{0.289052725f, 0.406964749f},
-std::array<float,2>{0.565753758f, 0.750916421f},
-std::array<float,2>{0.8215065f, 0.489604264f},
-std::array<float,2>{0.24986203f, 0.868574202f},
-std::array<float,2>{0.415519118f, 0.0964889526f},
-std::array<float,2>{0.726064324f, 0.712684929f},
-std::array<float,2>{0.516380966f, 0.134588525f},
-std::array<float,2>{0.35916391f, 0.603979826f},
-std::array<float,2>{0.0398112833f, 0.372187763f},
-std::array<float,2>{0.994395256f, 0.963521957f},
-std::array<float,2>{0.603542566f, 0.404343784f},
-std::array<float,2>{0.259044588f, 0.788567185f},
-std::array<float,2>{0.0793828741f, 0.000246014941f},
-std::array<float,2>{0.915731609f, 0.66877991f},
-std::array<float,2>{0.770433128f, 0.228101641f},
-std::array<float,2>{0.173957258f, 0.517736375f},
-std::array<float,2>{0.45049879f, 0.309986681f},
-std::array<float,2>{0.670040548f, 0.905875862f},
-std::array<float,2>{0.947256088f, 0.324847341f},
-std::array<float,2>{0.0156826079f, 0.98556906f},
-std::array<float,2>{0.331782967f, 0.173728794f},
-std::array<float,2>{0.541235685f, 0.574518919f},
-std::array<float,2>{0.715676546f, 0.0694814846f},
-std::array<float,2>{0.39033103f, 0.744126558f},
-std::array<float,2>{0.19568105f, 0.441755623f},
-std::array<float,2>{0.861489236f, 0.838711858f},
-std::array<float,2>{0.550954878f, 0.35389939f},
-std::array<float,2>{0.324308515f, 0.950945318f},
-std::array<float,2>{0.0148877893f, 0.147450477f},
-std::array<float,2>{0.964924693f, 0.615707934f},
-std::array<float,2>{0.850222528f, 0.113322034f},
-std::array<float,2>{0.210377514f, 0.693403423f},
-std::array<float,2>{0.399007827f, 0.478146046f},
-std::array<float,2>{0.70280093f, 0.858186662f},
-std::array<float,2>{0.929562867f, 0.435468167f},
-std::array<float,2>{0.0635685846f, 0.775788069f},
-std::array<float,2>{0.271709472f, 0.0455612764f},
-std::array<float,2>{0.61798203f, 0.62558049f},
-std::array<float,2>{0.672612309f, 0.206458747f},
-std::array<float,2>{0.458385199f, 0.555621445f},
-std::array<float,2>{0.166007653f, 0.27085939f},
-std::array<float,2>{0.75258106f, 0.9106583f},
-std::array<float,2>{0.74754566f, 0.457354605f},
-std::array<float,2>{0.423505187f, 0.816274107f},
-std::array<float,2>{0.229382962f, 0.0796379745f},
-std::array<float,2>{0.833981752f, 0.726797104f},
-std::array<float,2>{0.976524651f, 0.159034237f},
-std::array<float,2>{0.0528413542f, 0.583086729f},
-std::array<float,2>{0.360701412f, 0.335913658f},
-std::array<float,2>{0.502841473f, 0.972468734f},
-std::array<float,2>{0.81243664f, 0.284866095f},
-std::array<float,2>{0.139774203f, 0.881223977f},
-std::array<float,2>{0.470995784f, 0.238404915f},
-std::array<float,2>{0.635536194f, 0.503060818f},
-std::array<float,2>{0.587278128f, 0.019971665f},
-std::array<float,2>{0.307250828f, 0.673060477f},
-std::array<float,2>{0.116759829f, 0.390390575f},
-std::array<float,2>{0.885974884f, 0.808870256f},
-std::array<float,2>{0.683432877f, 0.368658036f},
-std::array<float,2>{0.460943997f, 0.966108382f},
-std::array<float,2>{0.159445435f, 0.138328925f},
-std::array<float,2>{0.764368057f, 0.608933806f},
-std::array<float,2>{0.936728001f, 0.100951649f},
-std::array<float,2>{0.070721291f, 0.717096686f},
-std::array<float,2>{0.280989558f, 0.487059385f},
-std::array<float,2>{0.616216242f, 0.871324122f},
-std::array<float,2>{0.851736128f, 0.412500441f},
-std::array<float,2>{0.218649462f, 0.753940582f},
-std::array<float,2>{0.394165158f, 0.0598180033f},
-std::array<float,2>{0.692921817f, 0.64401108f},
-std::array<float,2>{0.560948312f, 0.198391572f},
-std::array<float,2>{0.319912255f, 0.544208348f},
-std::array<float,2>{0.00249682833f, 0.251053244f},
-std::array<float,2>{0.954537213f, 0.923925698f},
-std::array<float,2>{0.583860636f, 0.439107865f},
-std::array<float,2>{0.300103098f, 0.843491852f},
-std::array<float,2>{0.12280295f, 0.0657158047f},
-std::array<float,2>{0.879956841f, 0.747340441f},
-std::array<float,2>{0.798220754f, 0.176176414f},
-std::array<float,2>{0.127845958f, 0.570855021f},
-std::array<float,2>{0.484128088f, 0.323625356f},
-std::array<float,2>{0.63163352f, 0.99031651f},
-std::array<float,2>{0.983941913f, 0.30686906f},
-std::array<float,2>{0.0567816086f, 0.898536801f},
-std::array<float,2>{0.36758399f, 0.231318653f},
-std::array<float,2>{0.514480948f, 0.519981325f},
-std::array<float,2>{0.734901607f, 0.00626470614f},
-std::array<float,2>{0.43619132f, 0.667758048f},
-std::array<float,2>{0.226520434f, 0.399195969f},
-std::array<float,2>{0.838414431f, 0.782511353f},
-std::array<float,2>{0.525002956f, 0.267941117f},
-std::array<float,2>{0.349683672f, 0.906719863f},
-std::array<float,2>{0.0327178426f, 0.208372921f},
-std::array<float,2>{0.987732112f, 0.561130583f},
-std::array<float,2>{0.812714159f, 0.0407384597f},
-std::array<float,2>{0.241416425f, 0.629504859f},
-std::array<float,2>{0.408804983f, 0.431507885f},
-std::array<float,2>{0.728869379f, 0.779568672f},
-std::array<float,2>{0.892578661f, 0.483111858f},
-std::array<float,2>{0.0971803293f, 0.85367167f},
-std::array<float,2>{0.289315224f, 0.110013343f},
-std::array<float,2>{0.574428976f, 0.689967275f},
-std::array<float,2>{0.640858471f, 0.143376455f},
-std::array<float,2>{0.488914579f, 0.610821307f},
-std::array<float,2>{0.147140518f, 0.359245896f},
-std::array<float,2>{0.789626181f, 0.948664486f},
-std::array<float,2>{0.704743743f, 0.384600043f},
-std::array<float,2>{0.381943852f, 0.808022022f},
-std::array<float,2>{0.190762669f, 0.0164924543f},
-std::array<float,2>{0.872540176f, 0.678719461f},
-std::array<float,2>{0.940294981f, 0.23787792f},
-std::array<float,2>{0.023962209f, 0.505311966f},
-std::array<float,2>{0.342684239f, 0.286964208f},
-std::array<float,2>{0.539055467f, 0.878841102f},
-std::array<float,2>{0.778783202f, 0.329724759f},
-std::array<float,2>{0.187270597f, 0.97624898f},
-std::array<float,2>{0.445116609f, 0.163949162f},
-std::array<float,2>{0.657527447f, 0.581376433f},
-std::array<float,2>{0.597725749f, 0.0853355303f},
-std::array<float,2>{0.253761888f, 0.732071459f},
-std::array<float,2>{0.0924487561f, 0.45542556f},
-std::array<float,2>{0.911677778f, 0.819808781f},
-std::array<float,2>{0.720956504f, 0.295215636f},
-std::array<float,2>{0.418814182f, 0.887361825f},
-std::array<float,2>{0.24410294f, 0.245713457f},
-std::array<float,2>{0.827732623f, 0.509799063f},
-std::array<float,2>{0.996446431f, 0.0248932317f},
-std::array<float,2>{0.0464579538f, 0.687181711f},
-std::array<float,2>{0.351753205f, 0.375180244f},
-std::array<float,2>{0.520449698f, 0.801869035f},
-std::array<float,2>{0.78427422f, 0.46734786f},
-std::array<float,2>{0.149195418f, 0.82773602f},
-std::array<float,2>{0.498643577f, 0.0904497728f},
-std::array<float,2>{0.653740525f, 0.721512377f},
-std::array<float,2>{0.567991078f, 0.171663105f},
-std::array<float,2>{0.282419771f, 0.591266215f},
-std::array<float,2>{0.106947631f, 0.337697208f},
-std::array<float,2>{0.902419567f, 0.982532203f},
-std::array<float,2>{0.543922961f, 0.423932493f},
-std::array<float,2>{0.335789979f, 0.768284976f},
-std::array<float,2>{0.0211161152f, 0.0372729897f},
-std::array<float,2>{0.950422823f, 0.635372818f},
-std::array<float,2>{0.866295218f, 0.216002718f},
-std::array<float,2>{0.199251741f, 0.552237034f},
-std::array<float,2>{0.384377658f, 0.276729524f},
-std::array<float,2>{0.713484287f, 0.920544803f},
-std::array<float,2>{0.920082569f, 0.35144949f},
-std::array<float,2>{0.0853320807f, 0.937866747f},
-std::array<float,2>{0.26307103f, 0.148868501f},
-std::array<float,2>{0.607859552f, 0.62111938f},
-std::array<float,2>{0.665642202f, 0.123076305f},
-std::array<float,2>{0.445634395f, 0.697827578f},
-std::array<float,2>{0.177108124f, 0.474633992f},
-std::array<float,2>{0.76949656f, 0.849165857f},
-std::array<float,2>{0.623852611f, 0.313631624f},
-std::array<float,2>{0.268970698f, 0.993126571f},
-std::array<float,2>{0.0670643523f, 0.183551252f},
-std::array<float,2>{0.924104512f, 0.563097239f},
-std::array<float,2>{0.756070554f, 0.0730817392f},
-std::array<float,2>{0.168251917f, 0.734615207f},
-std::array<float,2>{0.45465669f, 0.452314168f},
-std::array<float,2>{0.677406013f, 0.830949962f},
-std::array<float,2>{0.962044001f, 0.395127684f},
-std::array<float,2>{0.0105337063f, 0.792955995f},
-std::array<float,2>{0.320824116f, 0.00845983438f},
-std::array<float,2>{0.548762977f, 0.661553025f},
-std::array<float,2>{0.698348761f, 0.219234854f},
-std::array<float,2>{0.404207259f, 0.526633918f},
-std::array<float,2>{0.204840377f, 0.303654701f},
-std::array<float,2>{0.844682693f, 0.897313356f},
-std::array<float,2>{0.63767451f, 0.497277111f},
-std::array<float,2>{0.4762716f, 0.861100793f},
-std::array<float,2>{0.136438459f, 0.1056052f},
-std::array<float,2>{0.806688845f, 0.703178942f},
-std::array<float,2>{0.887477696f, 0.127214894f},
-std::array<float,2>{0.110397652f, 0.594277084f},
-std::array<float,2>{0.309235543f, 0.362866342f},
-std::array<float,2>{0.593688726f, 0.960241258f},
-std::array<float,2>{0.831684053f, 0.260159612f},
-std::array<float,2>{0.233428642f, 0.932037115f},
-std::array<float,2>{0.426068574f, 0.194426343f},
-std::array<float,2>{0.742742598f, 0.538032293f},
-std::array<float,2>{0.504558444f, 0.049466189f},
-std::array<float,2>{0.363440216f, 0.648577273f},
-std::array<float,2>{0.0489615314f, 0.415179789f},
-std::array<float,2>{0.972376406f, 0.761320651f},
-std::array<float,2>{0.73905623f, 0.345238686f},
-std::array<float,2>{0.431565046f, 0.941913068f},
-std::array<float,2>{0.219617292f, 0.154021129f},
-std::array<float,2>{0.84085536f, 0.618293226f},
-std::array<float,2>{0.976692975f, 0.120316446f},
-std::array<float,2>{0.0608338639f, 0.699843347f},
-std::array<float,2>{0.371451259f, 0.469774395f},
-std::array<float,2>{0.509517729f, 0.845614374f},
-std::array<float,2>{0.801461697f, 0.429460943f},
-std::array<float,2>{0.13077791f, 0.769935727f},
-std::array<float,2>{0.478302866f, 0.0342567712f},
-std::array<float,2>{0.628326416f, 0.637874126f},
-std::array<float,2>{0.579823554f, 0.212810174f},
-std::array<float,2>{0.302748799f, 0.550060809f},
-std::array<float,2>{0.120165758f, 0.278568715f},
-std::array<float,2>{0.877744615f, 0.917133629f},
-std::array<float,2>{0.554691732f, 0.462801963f},
-std::array<float,2>{0.315248489f, 0.823103487f},
-std::array<float,2>{0.00626939256f, 0.08736597f},
-std::array<float,2>{0.959379435f, 0.723369122f},
-std::array<float,2>{0.859218538f, 0.165061146f},
-std::array<float,2>{0.213577777f, 0.588591874f},
-std::array<float,2>{0.398313016f, 0.340929091f},
-std::array<float,2>{0.688761175f, 0.978595257f},
-std::array<float,2>{0.931174815f, 0.289276809f},
-std::array<float,2>{0.0781215131f, 0.884117723f},
-std::array<float,2>{0.275610417f, 0.248140246f},
-std::array<float,2>{0.610476255f, 0.513999224f},
-std::array<float,2>{0.684609592f, 0.0300412215f},
-std::array<float,2>{0.468072891f, 0.680851996f},
-std::array<float,2>{0.162880555f, 0.380787343f},
-std::array<float,2>{0.759576917f, 0.797935605f},
-std::array<float,2>{0.597635865f, 0.26412344f},
-std::array<float,2>{0.254196465f, 0.936068416f},
-std::array<float,2>{0.0880884677f, 0.190675125f},
-std::array<float,2>{0.908557951f, 0.535117924f},
-std::array<float,2>{0.775316715f, 0.051344689f},
-std::array<float,2>{0.180606395f, 0.654261529f},
-std::array<float,2>{0.441193163f, 0.419757336f},
-std::array<float,2>{0.663235247f, 0.762909055f},
-std::array<float,2>{0.944037557f, 0.493771046f},
-std::array<float,2>{0.0300223902f, 0.865484953f},
-std::array<float,2>{0.337792724f, 0.103310533f},
-std::array<float,2>{0.533445835f, 0.707134008f},
-std::array<float,2>{0.710360169f, 0.13155289f},
-std::array<float,2>{0.378029376f, 0.599477768f},
-std::array<float,2>{0.192940727f, 0.364188373f},
-std::array<float,2>{0.870321512f, 0.956089616f},
-std::array<float,2>{0.645630419f, 0.392673582f},
-std::array<float,2>{0.485503435f, 0.793423593f},
-std::array<float,2>{0.141944855f, 0.0124092139f},
-std::array<float,2>{0.794623077f, 0.659025371f},
-std::array<float,2>{0.897589087f, 0.224770412f},
-std::array<float,2>{0.0983207673f, 0.527796686f},
-std::array<float,2>{0.293454975f, 0.296902627f},
-std::array<float,2>{0.572938979f, 0.890693069f},
-std::array<float,2>{0.819649637f, 0.319815665f},
-std::array<float,2>{0.235536501f, 0.998047113f},
-std::array<float,2>{0.412123889f, 0.184564933f},
-std::array<float,2>{0.732196748f, 0.569287777f},
-std::array<float,2>{0.529050231f, 0.0774357989f},
-std::array<float,2>{0.346774012f, 0.741654158f},
-std::array<float,2>{0.0358373821f, 0.445850581f},
-std::array<float,2>{0.989073455f, 0.835479975f},
-std::array<float,2>{0.66949892f, 0.312460035f},
-std::array<float,2>{0.451247454f, 0.902659893f},
-std::array<float,2>{0.173072845f, 0.230382428f},
-std::array<float,2>{0.771510005f, 0.517037868f},
-std::array<float,2>{0.917807221f, 0.00200761319f},
-std::array<float,2>{0.0814457089f, 0.670715988f},
-std::array<float,2>{0.260153204f, 0.402503699f},
-std::array<float,2>{0.603266239f, 0.787105739f},
-std::array<float,2>{0.859588921f, 0.443974853f},
-std::array<float,2>{0.19800958f, 0.83753109f},
-std::array<float,2>{0.3873142f, 0.0673384219f},
-std::array<float,2>{0.718651414f, 0.745434582f},
-std::array<float,2>{0.53997165f, 0.175721452f},
-std::array<float,2>{0.329679757f, 0.577451229f},
-std::array<float,2>{0.0176046062f, 0.328043967f},
-std::array<float,2>{0.94759059f, 0.988090813f},
-std::array<float,2>{0.563057125f, 0.409392536f},
-std::array<float,2>{0.286598504f, 0.753738225f},
-std::array<float,2>{0.103946038f, 0.0556683913f},
-std::array<float,2>{0.900128424f, 0.648300052f},
-std::array<float,2>{0.787616968f, 0.202631876f},
-std::array<float,2>{0.155357003f, 0.540431976f},
-std::array<float,2>{0.495318741f, 0.254542768f},
-std::array<float,2>{0.652142107f, 0.927398324f},
-std::array<float,2>{0.992785871f, 0.373185217f},
-std::array<float,2>{0.0425582416f, 0.961301029f},
-std::array<float,2>{0.356706321f, 0.136526048f},
-std::array<float,2>{0.518664658f, 0.602289617f},
-std::array<float,2>{0.724174917f, 0.0952280015f},
-std::array<float,2>{0.417679012f, 0.713250399f},
-std::array<float,2>{0.246789351f, 0.490401208f},
-std::array<float,2>{0.824014246f, 0.869141042f},
-std::array<float,2>{0.501935303f, 0.333466619f},
-std::array<float,2>{0.361773849f, 0.970498443f},
-std::array<float,2>{0.0515480824f, 0.157629624f},
-std::array<float,2>{0.974194169f, 0.584185779f},
-std::array<float,2>{0.835637033f, 0.0805576295f},
-std::array<float,2>{0.227736756f, 0.730422556f},
-std::array<float,2>{0.423983514f, 0.459697515f},
-std::array<float,2>{0.749261737f, 0.814345419f},
-std::array<float,2>{0.884259284f, 0.38766405f},
-std::array<float,2>{0.114015572f, 0.81183362f},
-std::array<float,2>{0.305957526f, 0.0231041368f},
-std::array<float,2>{0.589544117f, 0.673995256f},
-std::array<float,2>{0.634654284f, 0.24068059f},
-std::array<float,2>{0.469406039f, 0.501938105f},
-std::array<float,2>{0.137894198f, 0.281789273f},
-std::array<float,2>{0.809530318f, 0.879607618f},
-std::array<float,2>{0.701127887f, 0.479828954f},
-std::array<float,2>{0.401207745f, 0.856014669f},
-std::array<float,2>{0.207565069f, 0.117112309f},
-std::array<float,2>{0.848467708f, 0.693190515f},
-std::array<float,2>{0.968477488f, 0.146462604f},
-std::array<float,2>{0.0129675735f, 0.615064681f},
-std::array<float,2>{0.327919453f, 0.35256502f},
-std::array<float,2>{0.55463624f, 0.952822924f},
-std::array<float,2>{0.750184894f, 0.271895885f},
-std::array<float,2>{0.166045025f, 0.912234962f},
-std::array<float,2>{0.45907715f, 0.20448938f},
-std::array<float,2>{0.674381435f, 0.558498681f},
-std::array<float,2>{0.620001435f, 0.0443745665f},
-std::array<float,2>{0.271351725f, 0.627338648f},
-std::array<float,2>{0.0647301078f, 0.436043978f},
-std::array<float,2>{0.926665306f, 0.774624348f},
-std::array<float,2>{0.629087448f, 0.321470439f},
-std::array<float,2>{0.482049257f, 0.990100801f},
-std::array<float,2>{0.12634328f, 0.178663641f},
-std::array<float,2>{0.799647331f, 0.572364986f},
-std::array<float,2>{0.882559836f, 0.0630608201f},
-std::array<float,2>{0.123506226f, 0.749599636f},
-std::array<float,2>{0.29779467f, 0.441147566f},
-std::array<float,2>{0.585671425f, 0.840938687f},
-std::array<float,2>{0.836673379f, 0.401698083f},
-std::array<float,2>{0.224259138f, 0.783503532f},
-std::array<float,2>{0.435164064f, 0.00539946184f},
-std::array<float,2>{0.738184214f, 0.66473335f},
-std::array<float,2>{0.511754811f, 0.232657865f},
-std::array<float,2>{0.369207054f, 0.52306962f},
-std::array<float,2>{0.0549898334f, 0.304853559f},
-std::array<float,2>{0.981828928f, 0.902056694f},
-std::array<float,2>{0.61336422f, 0.484768033f},
-std::array<float,2>{0.278998107f, 0.873450875f},
-std::array<float,2>{0.073660031f, 0.0981126055f},
-std::array<float,2>{0.935370266f, 0.715460062f},
-std::array<float,2>{0.762127101f, 0.140330419f},
-std::array<float,2>{0.157212719f, 0.6072945f},
-std::array<float,2>{0.46398887f, 0.370891929f},
-std::array<float,2>{0.680023313f, 0.968230784f},
-std::array<float,2>{0.956590235f, 0.252921343f},
-std::array<float,2>{0.000545752002f, 0.922250748f},
-std::array<float,2>{0.317197561f, 0.196562588f},
-std::array<float,2>{0.56010896f, 0.546374977f},
-std::array<float,2>{0.694032669f, 0.0615408085f},
-std::array<float,2>{0.390729636f, 0.641968369f},
-std::array<float,2>{0.216156542f, 0.411044329f},
-std::array<float,2>{0.853877008f, 0.757752717f},
-std::array<float,2>{0.535575032f, 0.288349599f},
-std::array<float,2>{0.340402573f, 0.876396418f},
-std::array<float,2>{0.0265033841f, 0.23599261f},
-std::array<float,2>{0.938560605f, 0.506140947f},
-std::array<float,2>{0.873431146f, 0.0176964328f},
-std::array<float,2>{0.187870666f, 0.677282751f},
-std::array<float,2>{0.380656332f, 0.385766894f},
-std::array<float,2>{0.70677644f, 0.804863691f},
-std::array<float,2>{0.912572265f, 0.453623354f},
-std::array<float,2>{0.0915756822f, 0.818059146f},
-std::array<float,2>{0.250293761f, 0.0826367363f},
-std::array<float,2>{0.601507187f, 0.73291111f},
-std::array<float,2>{0.659529865f, 0.160671383f},
-std::array<float,2>{0.442054808f, 0.57904923f},
-std::array<float,2>{0.185143664f, 0.331284374f},
-std::array<float,2>{0.780581534f, 0.973672986f},
-std::array<float,2>{0.726750016f, 0.433364421f},
-std::array<float,2>{0.4065727f, 0.778700888f},
-std::array<float,2>{0.239342675f, 0.0415319055f},
-std::array<float,2>{0.815588534f, 0.632192791f},
-std::array<float,2>{0.985863984f, 0.20993571f},
-std::array<float,2>{0.0348600708f, 0.560314536f},
-std::array<float,2>{0.349078298f, 0.2657713f},
-std::array<float,2>{0.525904417f, 0.908637285f},
-std::array<float,2>{0.792089164f, 0.35661751f},
-std::array<float,2>{0.145598203f, 0.947261512f},
-std::array<float,2>{0.490950942f, 0.141356528f},
-std::array<float,2>{0.644127011f, 0.611589193f},
-std::array<float,2>{0.577207923f, 0.111371867f},
-std::array<float,2>{0.292596519f, 0.68791014f},
-std::array<float,2>{0.0954980105f, 0.481518984f},
-std::array<float,2>{0.891035378f, 0.853463411f},
-std::array<float,2>{0.712524414f, 0.274269253f},
-std::array<float,2>{0.384986728f, 0.919761419f},
-std::array<float,2>{0.202268198f, 0.217423737f},
-std::array<float,2>{0.864302993f, 0.553896427f},
-std::array<float,2>{0.951636374f, 0.0353461765f},
-std::array<float,2>{0.0217204578f, 0.633964717f},
-std::array<float,2>{0.333044142f, 0.423571259f},
-std::array<float,2>{0.545691073f, 0.767540991f},
-std::array<float,2>{0.766347468f, 0.473656297f},
-std::array<float,2>{0.178143844f, 0.85024029f},
-std::array<float,2>{0.4490242f, 0.121975079f},
-std::array<float,2>{0.667782605f, 0.695757031f},
-std::array<float,2>{0.605617583f, 0.152248472f},
-std::array<float,2>{0.264745921f, 0.623963773f},
-std::array<float,2>{0.0828986168f, 0.347713292f},
-std::array<float,2>{0.919680655f, 0.940629303f},
-std::array<float,2>{0.522370934f, 0.378254205f},
-std::array<float,2>{0.354177266f, 0.804440558f},
-std::array<float,2>{0.0443074554f, 0.0273154378f},
-std::array<float,2>{0.999380827f, 0.684102714f},
-std::array<float,2>{0.824688673f, 0.242629692f},
-std::array<float,2>{0.246061474f, 0.508254886f},
-std::array<float,2>{0.420224279f, 0.294681072f},
-std::array<float,2>{0.718878925f, 0.889954329f},
-std::array<float,2>{0.90538466f, 0.339131832f},
-std::array<float,2>{0.10836643f, 0.982017875f},
-std::array<float,2>{0.283570707f, 0.168945283f},
-std::array<float,2>{0.569827974f, 0.593085885f},
-std::array<float,2>{0.656200051f, 0.0931789503f},
-std::array<float,2>{0.496471196f, 0.720106542f},
-std::array<float,2>{0.15218921f, 0.465078205f},
-std::array<float,2>{0.781924069f, 0.824368119f},
-std::array<float,2>{0.590190232f, 0.359776586f},
-std::array<float,2>{0.31169346f, 0.957603574f},
-std::array<float,2>{0.111791618f, 0.126923561f},
-std::array<float,2>{0.889926851f, 0.597348571f},
-std::array<float,2>{0.806054831f, 0.108551182f},
-std::array<float,2>{0.134342268f, 0.706247926f},
-std::array<float,2>{0.473111212f, 0.499589235f},
-std::array<float,2>{0.640248835f, 0.862353444f},
-std::array<float,2>{0.969150484f, 0.417123318f},
-std::array<float,2>{0.0471882857f, 0.759556651f},
-std::array<float,2>{0.36648795f, 0.0469511151f},
-std::array<float,2>{0.507033348f, 0.65155828f},
-std::array<float,2>{0.745573521f, 0.192422956f},
-std::array<float,2>{0.429276705f, 0.53664583f},
-std::array<float,2>{0.231713131f, 0.258097142f},
-std::array<float,2>{0.82900697f, 0.930539846f},
-std::array<float,2>{0.679127872f, 0.449642271f},
-std::array<float,2>{0.455843359f, 0.82956332f},
-std::array<float,2>{0.170829684f, 0.0706379041f},
-std::array<float,2>{0.754995704f, 0.737357676f},
-std::array<float,2>{0.921904027f, 0.18041639f},
-std::array<float,2>{0.0691392645f, 0.564939559f},
-std::array<float,2>{0.267074019f, 0.3152785f},
-std::array<float,2>{0.622621655f, 0.995420933f},
-std::array<float,2>{0.846158683f, 0.302093208f},
-std::array<float,2>{0.206938699f, 0.895623922f},
-std::array<float,2>{0.404695451f, 0.220761746f},
-std::array<float,2>{0.695689023f, 0.52535969f},
-std::array<float,2>{0.549286962f, 0.0112806708f},
-std::array<float,2>{0.323122144f, 0.662190914f},
-std::array<float,2>{0.00970339589f, 0.397046357f},
-std::array<float,2>{0.96437633f, 0.789918005f},
-std::array<float,2>{0.730776966f, 0.317474186f},
-std::array<float,2>{0.413805813f, 0.996800005f},
-std::array<float,2>{0.234691635f, 0.185564384f},
-std::array<float,2>{0.819282234f, 0.567609191f},
-std::array<float,2>{0.989427269f, 0.0751817524f},
-std::array<float,2>{0.0369950943f, 0.739757597f},
-std::array<float,2>{0.346425414f, 0.448115975f},
-std::array<float,2>{0.527506351f, 0.832838058f},
-std::array<float,2>{0.793227851f, 0.391783327f},
-std::array<float,2>{0.141368359f, 0.796029806f},
-std::array<float,2>{0.485267818f, 0.0149058076f},
-std::array<float,2>{0.645006239f, 0.657346427f},
-std::array<float,2>{0.573600829f, 0.223234698f},
-std::array<float,2>{0.294143915f, 0.529313684f},
-std::array<float,2>{0.0988920927f, 0.299062282f},
-std::array<float,2>{0.897212386f, 0.893409431f},
-std::array<float,2>{0.535114408f, 0.495629191f},
-std::array<float,2>{0.336329967f, 0.865207851f},
-std::array<float,2>{0.0311370324f, 0.105286725f},
-std::array<float,2>{0.944976628f, 0.710592866f},
-std::array<float,2>{0.869351506f, 0.129904091f},
-std::array<float,2>{0.191932648f, 0.60089463f},
-std::array<float,2>{0.377440751f, 0.366850019f},
-std::array<float,2>{0.709002078f, 0.953988791f},
-std::array<float,2>{0.909292698f, 0.262692302f},
-std::array<float,2>{0.0896752775f, 0.93548739f},
-std::array<float,2>{0.255847633f, 0.188092098f},
-std::array<float,2>{0.596019387f, 0.532861173f},
-std::array<float,2>{0.662197828f, 0.053308636f},
-std::array<float,2>{0.440308005f, 0.654899299f},
-std::array<float,2>{0.181617498f, 0.420982093f},
-std::array<float,2>{0.773974299f, 0.764897346f},
-std::array<float,2>{0.609467626f, 0.291446894f},
-std::array<float,2>{0.27690655f, 0.886666179f},
-std::array<float,2>{0.076772064f, 0.246524721f},
-std::array<float,2>{0.930242658f, 0.513629138f},
-std::array<float,2>{0.758390903f, 0.0284290127f},
-std::array<float,2>{0.163133189f, 0.682263196f},
-std::array<float,2>{0.46710217f, 0.3813577f},
-std::array<float,2>{0.683976412f, 0.800489843f},
-std::array<float,2>{0.960126758f, 0.463279784f},
-std::array<float,2>{0.00747244898f, 0.820730567f},
-std::array<float,2>{0.315980583f, 0.0895597264f},
-std::array<float,2>{0.555712819f, 0.725886881f},
-std::array<float,2>{0.688104212f, 0.167894423f},
-std::array<float,2>{0.39672491f, 0.586191356f},
-std::array<float,2>{0.214263529f, 0.342722595f},
-std::array<float,2>{0.857436001f, 0.97805351f},
-std::array<float,2>{0.627363086f, 0.426274568f},
-std::array<float,2>{0.477376819f, 0.77339232f},
-std::array<float,2>{0.129831836f, 0.0321556404f},
-std::array<float,2>{0.801857471f, 0.640530229f},
-std::array<float,2>{0.878815532f, 0.214407101f},
-std::array<float,2>{0.119879618f, 0.548761964f},
-std::array<float,2>{0.304084033f, 0.280163884f},
-std::array<float,2>{0.578924954f, 0.914956272f},
-std::array<float,2>{0.840249419f, 0.347002983f},
-std::array<float,2>{0.220613614f, 0.944406211f},
-std::array<float,2>{0.430421412f, 0.154303446f},
-std::array<float,2>{0.739460826f, 0.620967388f},
-std::array<float,2>{0.508273005f, 0.117756136f},
-std::array<float,2>{0.3723526f, 0.702497244f},
-std::array<float,2>{0.061763905f, 0.471469879f},
-std::array<float,2>{0.977714419f, 0.847557068f},
-std::array<float,2>{0.675315559f, 0.269828022f},
-std::array<float,2>{0.460523188f, 0.911539853f},
-std::array<float,2>{0.167331636f, 0.205207244f},
-std::array<float,2>{0.751617789f, 0.555708885f},
-std::array<float,2>{0.926906765f, 0.0459380448f},
-std::array<float,2>{0.0659008548f, 0.626280785f},
-std::array<float,2>{0.270161003f, 0.434290498f},
-std::array<float,2>{0.621067464f, 0.776762187f},
-std::array<float,2>{0.849427104f, 0.477013141f},
-std::array<float,2>{0.208764017f, 0.858837903f},
-std::array<float,2>{0.402153254f, 0.114771441f},
-std::array<float,2>{0.699923694f, 0.694587529f},
-std::array<float,2>{0.553024769f, 0.148261011f},
-std::array<float,2>{0.326819927f, 0.616739035f},
-std::array<float,2>{0.0122997658f, 0.355018139f},
-std::array<float,2>{0.96765697f, 0.949418306f},
-std::array<float,2>{0.588507771f, 0.388932377f},
-std::array<float,2>{0.305333555f, 0.809603751f},
-std::array<float,2>{0.114412166f, 0.0213321727f},
-std::array<float,2>{0.88320446f, 0.671974123f},
-std::array<float,2>{0.809953988f, 0.239666313f},
-std::array<float,2>{0.137397826f, 0.502168477f},
-std::array<float,2>{0.470444888f, 0.283719391f},
-std::array<float,2>{0.633140028f, 0.882152021f},
-std::array<float,2>{0.9732759f, 0.334493071f},
-std::array<float,2>{0.0520438217f, 0.971165121f},
-std::array<float,2>{0.363238633f, 0.160107151f},
-std::array<float,2>{0.500643194f, 0.582808375f},
-std::array<float,2>{0.748427272f, 0.0781541392f},
-std::array<float,2>{0.425038934f, 0.72792393f},
-std::array<float,2>{0.227383181f, 0.45890528f},
-std::array<float,2>{0.834592938f, 0.814687252f},
-std::array<float,2>{0.518061876f, 0.371124148f},
-std::array<float,2>{0.356323153f, 0.964450061f},
-std::array<float,2>{0.0412524864f, 0.133058891f},
-std::array<float,2>{0.993703246f, 0.605357468f},
-std::array<float,2>{0.822566748f, 0.0967603326f},
-std::array<float,2>{0.247324452f, 0.711704552f},
-std::array<float,2>{0.416774571f, 0.488804162f},
-std::array<float,2>{0.723343909f, 0.867301643f},
-std::array<float,2>{0.899006009f, 0.407703787f},
-std::array<float,2>{0.105239578f, 0.751493692f},
-std::array<float,2>{0.286061615f, 0.0569579415f},
-std::array<float,2>{0.563844502f, 0.645084321f},
-std::array<float,2>{0.650793016f, 0.1992625f},
-std::array<float,2>{0.494255215f, 0.542813838f},
-std::array<float,2>{0.155262902f, 0.256347269f},
-std::array<float,2>{0.788591743f, 0.928593099f},
-std::array<float,2>{0.717478037f, 0.44245854f},
-std::array<float,2>{0.388097763f, 0.839797258f},
-std::array<float,2>{0.198246121f, 0.0688633397f},
-std::array<float,2>{0.860598207f, 0.742389143f},
-std::array<float,2>{0.948862672f, 0.172450066f},
-std::array<float,2>{0.0193017777f, 0.575471997f},
-std::array<float,2>{0.328846246f, 0.325847358f},
-std::array<float,2>{0.540842295f, 0.984894633f},
-std::array<float,2>{0.772596061f, 0.308969229f},
-std::array<float,2>{0.172339931f, 0.904721558f},
-std::array<float,2>{0.452186197f, 0.226822242f},
-std::array<float,2>{0.668239236f, 0.51894021f},
-std::array<float,2>{0.601863861f, 0.00193025055f},
-std::array<float,2>{0.26167655f, 0.669044673f},
-std::array<float,2>{0.0802902952f, 0.405694127f},
-std::array<float,2>{0.916469753f, 0.787415326f},
-std::array<float,2>{0.643301725f, 0.357434243f},
-std::array<float,2>{0.491804272f, 0.948128104f},
-std::array<float,2>{0.144577056f, 0.144521669f},
-std::array<float,2>{0.791877508f, 0.609853566f},
-std::array<float,2>{0.892341971f, 0.11081019f},
-std::array<float,2>{0.0937550664f, 0.690535605f},
-std::array<float,2>{0.291614532f, 0.484352708f},
-std::array<float,2>{0.576439619f, 0.855401337f},
-std::array<float,2>{0.815048873f, 0.429765254f},
-std::array<float,2>{0.239257395f, 0.781073868f},
-std::array<float,2>{0.407839656f, 0.0395767689f},
-std::array<float,2>{0.72834909f, 0.630328476f},
-std::array<float,2>{0.526695013f, 0.207532048f},
-std::array<float,2>{0.347752571f, 0.561727583f},
-std::array<float,2>{0.0341455266f, 0.269159675f},
-std::array<float,2>{0.984928787f, 0.907986641f},
-std::array<float,2>{0.600279808f, 0.45628792f},
-std::array<float,2>{0.251710862f, 0.818810046f},
-std::array<float,2>{0.0905683935f, 0.0842448846f},
-std::array<float,2>{0.913918138f, 0.731023729f},
-std::array<float,2>{0.779473245f, 0.162735239f},
-std::array<float,2>{0.183919877f, 0.581013203f},
-std::array<float,2>{0.442414343f, 0.32852602f},
-std::array<float,2>{0.659129322f, 0.974628031f},
-std::array<float,2>{0.938348174f, 0.286031574f},
-std::array<float,2>{0.0254615806f, 0.87764895f},
-std::array<float,2>{0.341639966f, 0.236973226f},
-std::array<float,2>{0.536157548f, 0.504840255f},
-std::array<float,2>{0.705730081f, 0.0174747445f},
-std::array<float,2>{0.37968722f, 0.677953005f},
-std::array<float,2>{0.188812926f, 0.383320034f},
-std::array<float,2>{0.874637663f, 0.806723893f},
-std::array<float,2>{0.55917716f, 0.250396609f},
-std::array<float,2>{0.317640543f, 0.925477564f},
-std::array<float,2>{0.00169717567f, 0.198202506f},
-std::array<float,2>{0.955637336f, 0.543512464f},
-std::array<float,2>{0.855431259f, 0.0593600683f},
-std::array<float,2>{0.214844376f, 0.642729998f},
-std::array<float,2>{0.391848981f, 0.413573205f},
-std::array<float,2>{0.694720507f, 0.75498116f},
-std::array<float,2>{0.933718264f, 0.487771928f},
-std::array<float,2>{0.072933279f, 0.872376502f},
-std::array<float,2>{0.277438253f, 0.100367211f},
-std::array<float,2>{0.615118623f, 0.718265951f},
-std::array<float,2>{0.681082845f, 0.136923909f},
-std::array<float,2>{0.463542521f, 0.607519627f},
-std::array<float,2>{0.157895461f, 0.367556542f},
-std::array<float,2>{0.76269865f, 0.965561986f},
-std::array<float,2>{0.736757159f, 0.400076717f},
-std::array<float,2>{0.433787376f, 0.78161478f},
-std::array<float,2>{0.222728491f, 0.00692810817f},
-std::array<float,2>{0.837097943f, 0.666886628f},
-std::array<float,2>{0.981117904f, 0.231787801f},
-std::array<float,2>{0.0562010705f, 0.52066493f},
-std::array<float,2>{0.370565206f, 0.30793485f},
-std::array<float,2>{0.513569832f, 0.89983362f},
-std::array<float,2>{0.800528109f, 0.322687447f},
-std::array<float,2>{0.125660375f, 0.991803646f},
-std::array<float,2>{0.481358558f, 0.176788896f},
-std::array<float,2>{0.630082905f, 0.572007716f},
-std::array<float,2>{0.584572434f, 0.0649415478f},
-std::array<float,2>{0.298479676f, 0.746992052f},
-std::array<float,2>{0.124096692f, 0.437672943f},
-std::array<float,2>{0.88129586f, 0.842399418f},
-std::array<float,2>{0.696635365f, 0.303749174f},
-std::array<float,2>{0.40586713f, 0.898384631f},
-std::array<float,2>{0.205651075f, 0.219956279f},
-std::array<float,2>{0.847397625f, 0.526251197f},
-std::array<float,2>{0.963643968f, 0.00971263926f},
-std::array<float,2>{0.00831124466f, 0.660461903f},
-std::array<float,2>{0.323500156f, 0.396449417f},
-std::array<float,2>{0.549910188f, 0.791306913f},
-std::array<float,2>{0.754757583f, 0.451872617f},
-std::array<float,2>{0.17186968f, 0.831844032f},
-std::array<float,2>{0.456364036f, 0.0741509423f},
-std::array<float,2>{0.678496063f, 0.736083508f},
-std::array<float,2>{0.621526897f, 0.182196379f},
-std::array<float,2>{0.266391814f, 0.56432724f},
-std::array<float,2>{0.0702677667f, 0.312715143f},
-std::array<float,2>{0.923159063f, 0.993745863f},
-std::array<float,2>{0.506232738f, 0.414507002f},
-std::array<float,2>{0.365493327f, 0.760071039f},
-std::array<float,2>{0.0484628342f, 0.0498332381f},
-std::array<float,2>{0.970671773f, 0.649541199f},
-std::array<float,2>{0.82952553f, 0.193695486f},
-std::array<float,2>{0.231053948f, 0.538708389f},
-std::array<float,2>{0.428670347f, 0.261677355f},
-std::array<float,2>{0.744712532f, 0.933547497f},
-std::array<float,2>{0.889244795f, 0.362209588f},
-std::array<float,2>{0.113236018f, 0.959065437f},
-std::array<float,2>{0.311489195f, 0.128873274f},
-std::array<float,2>{0.591028512f, 0.595027506f},
-std::array<float,2>{0.639130533f, 0.106578223f},
-std::array<float,2>{0.474155366f, 0.704794347f},
-std::array<float,2>{0.133127064f, 0.496553361f},
-std::array<float,2>{0.805257797f, 0.859431684f},
-std::array<float,2>{0.568437576f, 0.336048007f},
-std::array<float,2>{0.284894437f, 0.983743608f},
-std::array<float,2>{0.10890495f, 0.170298934f},
-std::array<float,2>{0.904853284f, 0.589998722f},
-std::array<float,2>{0.782272041f, 0.0911134481f},
-std::array<float,2>{0.150759876f, 0.722537875f},
-std::array<float,2>{0.497680396f, 0.467837632f},
-std::array<float,2>{0.655084491f, 0.826525509f},
-std::array<float,2>{0.998983324f, 0.376642913f},
-std::array<float,2>{0.0432603918f, 0.801181495f},
-std::array<float,2>{0.354805321f, 0.0235451087f},
-std::array<float,2>{0.52308166f, 0.686282814f},
-std::array<float,2>{0.720090032f, 0.244394973f},
-std::array<float,2>{0.421531141f, 0.510827243f},
-std::array<float,2>{0.244913578f, 0.296866089f},
-std::array<float,2>{0.825308383f, 0.888033092f},
-std::array<float,2>{0.666286349f, 0.476226449f},
-std::array<float,2>{0.448073417f, 0.848159492f},
-std::array<float,2>{0.179258078f, 0.124048978f},
-std::array<float,2>{0.767354608f, 0.698498666f},
-std::array<float,2>{0.91817981f, 0.149454325f},
-std::array<float,2>{0.0835397616f, 0.622440517f},
-std::array<float,2>{0.264559507f, 0.350353956f},
-std::array<float,2>{0.606928706f, 0.938990593f},
-std::array<float,2>{0.864129305f, 0.275392145f},
-std::array<float,2>{0.201512977f, 0.921181917f},
-std::array<float,2>{0.386632979f, 0.215090483f},
-std::array<float,2>{0.711862445f, 0.550821364f},
-std::array<float,2>{0.546761215f, 0.038279552f},
-std::array<float,2>{0.332478493f, 0.636242807f},
-std::array<float,2>{0.0233397111f, 0.425486147f},
-std::array<float,2>{0.952343166f, 0.76939255f},
-std::array<float,2>{0.708465338f, 0.365007371f},
-std::array<float,2>{0.375269026f, 0.955706358f},
-std::array<float,2>{0.194240123f, 0.132101372f},
-std::array<float,2>{0.868538618f, 0.597691476f},
-std::array<float,2>{0.942360103f, 0.102349445f},
-std::array<float,2>{0.0280400235f, 0.708029032f},
-std::array<float,2>{0.338141143f, 0.492765993f},
-std::array<float,2>{0.531846046f, 0.866375566f},
-std::array<float,2>{0.776144445f, 0.41814962f},
-std::array<float,2>{0.182803079f, 0.762048841f},
-std::array<float,2>{0.437917918f, 0.0523999147f},
-std::array<float,2>{0.661504328f, 0.652913392f},
-std::array<float,2>{0.595528126f, 0.190170974f},
-std::array<float,2>{0.257040173f, 0.533314347f},
-std::array<float,2>{0.0870317444f, 0.264998555f},
-std::array<float,2>{0.906585932f, 0.936851323f},
-std::array<float,2>{0.529880643f, 0.446998954f},
-std::array<float,2>{0.345365554f, 0.834263861f},
-std::array<float,2>{0.0378386863f, 0.07634487f},
-std::array<float,2>{0.990293503f, 0.740956426f},
-std::array<float,2>{0.816870391f, 0.185017616f},
-std::array<float,2>{0.23760432f, 0.569859862f},
-std::array<float,2>{0.410242856f, 0.319156915f},
-std::array<float,2>{0.73303026f, 0.999307096f},
-std::array<float,2>{0.895786107f, 0.298143029f},
-std::array<float,2>{0.100570887f, 0.891694307f},
-std::array<float,2>{0.295351237f, 0.226452649f},
-std::array<float,2>{0.571451128f, 0.529048622f},
-std::array<float,2>{0.647655249f, 0.0133675048f},
-std::array<float,2>{0.487350404f, 0.65986371f},
-std::array<float,2>{0.143718138f, 0.393947452f},
-std::array<float,2>{0.794940174f, 0.794051349f},
-std::array<float,2>{0.581629336f, 0.277855277f},
-std::array<float,2>{0.300858527f, 0.916339338f},
-std::array<float,2>{0.117560327f, 0.211721897f},
-std::array<float,2>{0.875519812f, 0.548986197f},
-std::array<float,2>{0.803836823f, 0.0334237255f},
-std::array<float,2>{0.132204875f, 0.636963248f},
-std::array<float,2>{0.479193002f, 0.428563893f},
-std::array<float,2>{0.625928342f, 0.771442115f},
-std::array<float,2>{0.979668856f, 0.468949646f},
-std::array<float,2>{0.0598755442f, 0.8443259f},
-std::array<float,2>{0.374972135f, 0.119247459f},
-std::array<float,2>{0.510368168f, 0.700521529f},
-std::array<float,2>{0.741736412f, 0.153265789f},
-std::array<float,2>{0.431644797f, 0.61755842f},
-std::array<float,2>{0.220722437f, 0.344003052f},
-std::array<float,2>{0.842711031f, 0.942646682f},
-std::array<float,2>{0.685585022f, 0.379323453f},
-std::array<float,2>{0.465418965f, 0.797545254f},
-std::array<float,2>{0.161384806f, 0.0305543374f},
-std::array<float,2>{0.760280013f, 0.679922223f},
-std::array<float,2>{0.931901693f, 0.249914527f},
-std::array<float,2>{0.0751511455f, 0.515270829f},
-std::array<float,2>{0.273678869f, 0.290879786f},
-std::array<float,2>{0.612811267f, 0.883541346f},
-std::array<float,2>{0.856356442f, 0.340510815f},
-std::array<float,2>{0.211685106f, 0.980037034f},
-std::array<float,2>{0.395911127f, 0.16480203f},
-std::array<float,2>{0.690443456f, 0.589801013f},
-std::array<float,2>{0.558036327f, 0.0861092806f},
-std::array<float,2>{0.312769264f, 0.723703086f},
-std::array<float,2>{0.00450463919f, 0.461557895f},
-std::array<float,2>{0.958874881f, 0.82410121f},
-std::array<float,2>{0.63657999f, 0.282901078f},
-std::array<float,2>{0.472451121f, 0.880049229f},
-std::array<float,2>{0.139405653f, 0.241243556f},
-std::array<float,2>{0.810897529f, 0.500651062f},
-std::array<float,2>{0.884802103f, 0.021661533f},
-std::array<float,2>{0.116196856f, 0.675256133f},
-std::array<float,2>{0.307750314f, 0.38825044f},
-std::array<float,2>{0.586401343f, 0.810618162f},
-std::array<float,2>{0.832164347f, 0.460804433f},
-std::array<float,2>{0.230068818f, 0.812574804f},
-std::array<float,2>{0.422644049f, 0.0813988745f},
-std::array<float,2>{0.747062862f, 0.728754401f},
-std::array<float,2>{0.503793061f, 0.157116681f},
-std::array<float,2>{0.359785855f, 0.585121751f},
-std::array<float,2>{0.0545761287f, 0.332048416f},
-std::array<float,2>{0.974940538f, 0.969077349f},
-std::array<float,2>{0.618484259f, 0.436948419f},
-std::array<float,2>{0.272561401f, 0.773794472f},
-std::array<float,2>{0.0626943633f, 0.0433513075f},
-std::array<float,2>{0.928111672f, 0.628167987f},
-std::array<float,2>{0.752953649f, 0.203802794f},
-std::array<float,2>{0.164182231f, 0.557212293f},
-std::array<float,2>{0.457903117f, 0.272649735f},
-std::array<float,2>{0.673482597f, 0.913614333f},
-std::array<float,2>{0.96670711f, 0.352223396f},
-std::array<float,2>{0.0141591616f, 0.95132494f},
-std::array<float,2>{0.326162428f, 0.145271301f},
-std::array<float,2>{0.552456021f, 0.614221096f},
-std::array<float,2>{0.701866686f, 0.116130434f},
-std::array<float,2>{0.400049657f, 0.692161679f},
-std::array<float,2>{0.2091631f, 0.478708476f},
-std::array<float,2>{0.851213872f, 0.857394814f},
-std::array<float,2>{0.542704523f, 0.326884896f},
-std::array<float,2>{0.330366582f, 0.986895204f},
-std::array<float,2>{0.0175661203f, 0.173949659f},
-std::array<float,2>{0.945527017f, 0.576991379f},
-std::array<float,2>{0.862735927f, 0.0681565106f},
-std::array<float,2>{0.196820334f, 0.744652689f},
-std::array<float,2>{0.389411509f, 0.444372028f},
-std::array<float,2>{0.716639221f, 0.836743295f},
-std::array<float,2>{0.914963722f, 0.404132634f},
-std::array<float,2>{0.0790492967f, 0.785573661f},
-std::array<float,2>{0.258249015f, 0.00374465343f},
-std::array<float,2>{0.604954302f, 0.671236277f},
-std::array<float,2>{0.671836436f, 0.229429573f},
-std::array<float,2>{0.44984892f, 0.516157329f},
-std::array<float,2>{0.175277233f, 0.311280698f},
-std::array<float,2>{0.770515263f, 0.903931677f},
-std::array<float,2>{0.72486943f, 0.491942406f},
-std::array<float,2>{0.41487211f, 0.87082839f},
-std::array<float,2>{0.248973265f, 0.0945343971f},
-std::array<float,2>{0.820508778f, 0.714467883f},
-std::array<float,2>{0.995924413f, 0.13479951f},
-std::array<float,2>{0.040308293f, 0.603033006f},
-std::array<float,2>{0.35808292f, 0.374509037f},
-std::array<float,2>{0.517324805f, 0.962427258f},
-std::array<float,2>{0.787020504f, 0.255162835f},
-std::array<float,2>{0.152407885f, 0.926273942f},
-std::array<float,2>{0.493137836f, 0.201721549f},
-std::array<float,2>{0.649505675f, 0.539295495f},
-std::array<float,2>{0.565357864f, 0.0547073074f},
-std::array<float,2>{0.287836015f, 0.647112072f},
-std::array<float,2>{0.101584375f, 0.40897283f},
-std::array<float,2>{0.900587261f, 0.752696931f},
-std::array<float,2>{0.657218039f, 0.330348492f},
-std::array<float,2>{0.444075465f, 0.973359942f},
-std::array<float,2>{0.186097801f, 0.162094221f},
-std::array<float,2>{0.7777493f, 0.579676807f},
-std::array<float,2>{0.910572231f, 0.0831499845f},
-std::array<float,2>{0.0934072286f, 0.733561754f},
-std::array<float,2>{0.252804965f, 0.454679191f},
-std::array<float,2>{0.599044681f, 0.817275822f},
-std::array<float,2>{0.871762455f, 0.385107726f},
-std::array<float,2>{0.190230221f, 0.805669665f},
-std::array<float,2>{0.381515592f, 0.0191014539f},
-std::array<float,2>{0.703496099f, 0.676619351f},
-std::array<float,2>{0.537154317f, 0.235303015f},
-std::array<float,2>{0.343357593f, 0.506876171f},
-std::array<float,2>{0.0249157008f, 0.287196636f},
-std::array<float,2>{0.940716505f, 0.875056565f},
-std::array<float,2>{0.575726807f, 0.481357664f},
-std::array<float,2>{0.290680975f, 0.851564467f},
-std::array<float,2>{0.0965625048f, 0.112709068f},
-std::array<float,2>{0.893727481f, 0.68896389f},
-std::array<float,2>{0.790535629f, 0.142401412f},
-std::array<float,2>{0.147982612f, 0.612307549f},
-std::array<float,2>{0.490075439f, 0.355617821f},
-std::array<float,2>{0.642499864f, 0.945923388f},
-std::array<float,2>{0.986797869f, 0.267445773f},
-std::array<float,2>{0.0317311287f, 0.909808874f},
-std::array<float,2>{0.351187468f, 0.210210517f},
-std::array<float,2>{0.52415657f, 0.559294879f},
-std::array<float,2>{0.72959882f, 0.0420404971f},
-std::array<float,2>{0.409555972f, 0.631133795f},
-std::array<float,2>{0.24046278f, 0.43258068f},
-std::array<float,2>{0.813538194f, 0.777643621f},
-std::array<float,2>{0.515089154f, 0.306400478f},
-std::array<float,2>{0.368710339f, 0.900942028f},
-std::array<float,2>{0.0580965094f, 0.234100968f},
-std::array<float,2>{0.983238041f, 0.522363484f},
-std::array<float,2>{0.839828074f, 0.00447121495f},
-std::array<float,2>{0.225324482f, 0.665077448f},
-std::array<float,2>{0.436685264f, 0.401044667f},
-std::array<float,2>{0.735895693f, 0.784406662f},
-std::array<float,2>{0.879284441f, 0.439937443f},
-std::array<float,2>{0.121806301f, 0.840602934f},
-std::array<float,2>{0.299333513f, 0.0636060014f},
-std::array<float,2>{0.582174838f, 0.7486884f},
-std::array<float,2>{0.632475793f, 0.178788036f},
-std::array<float,2>{0.483274996f, 0.574208379f},
-std::array<float,2>{0.128076449f, 0.32087034f},
-std::array<float,2>{0.796885133f, 0.989024937f},
-std::array<float,2>{0.692334592f, 0.411222458f},
-std::array<float,2>{0.393065751f, 0.756087959f},
-std::array<float,2>{0.216864675f, 0.0605962314f},
-std::array<float,2>{0.852582216f, 0.64151293f},
-std::array<float,2>{0.953585446f, 0.195986837f},
-std::array<float,2>{0.00362217822f, 0.545140147f},
-std::array<float,2>{0.318365484f, 0.253644645f},
-std::array<float,2>{0.562410533f, 0.923673272f},
-std::array<float,2>{0.765294135f, 0.36920616f},
-std::array<float,2>{0.15871121f, 0.96743989f},
-std::array<float,2>{0.462729961f, 0.138925478f},
-std::array<float,2>{0.681660056f, 0.605582535f},
-std::array<float,2>{0.615847588f, 0.0993354023f},
-std::array<float,2>{0.27975148f, 0.716326177f},
-std::array<float,2>{0.0719870403f, 0.486215919f},
-std::array<float,2>{0.936461687f, 0.8747949f},
-std::array<float,2>{0.74326086f, 0.258930326f},
-std::array<float,2>{0.427333027f, 0.930993557f},
-std::array<float,2>{0.232501462f, 0.191769734f},
-std::array<float,2>{0.830629528f, 0.535952806f},
-std::array<float,2>{0.971602976f, 0.0482483767f},
-std::array<float,2>{0.0503807627f, 0.651218951f},
-std::array<float,2>{0.364975274f, 0.41653198f},
-std::array<float,2>{0.505784869f, 0.758642673f},
-std::array<float,2>{0.808356464f, 0.498198479f},
-std::array<float,2>{0.13564834f, 0.861568868f},
-std::array<float,2>{0.475289077f, 0.107990041f},
-std::array<float,2>{0.638041317f, 0.705411732f},
-std::array<float,2>{0.591914177f, 0.125328436f},
-std::array<float,2>{0.310478926f, 0.596622944f},
-std::array<float,2>{0.10996706f, 0.36092335f},
-std::array<float,2>{0.887812793f, 0.958494544f},
-std::array<float,2>{0.547273219f, 0.39782843f},
-std::array<float,2>{0.322186112f, 0.790711045f},
-std::array<float,2>{0.0110576218f, 0.0105293086f},
-std::array<float,2>{0.961343706f, 0.663711131f},
-std::array<float,2>{0.84474808f, 0.222160742f},
-std::array<float,2>{0.203390583f, 0.523986578f},
-std::array<float,2>{0.402532786f, 0.301306069f},
-std::array<float,2>{0.697750866f, 0.894787431f},
-std::array<float,2>{0.925056756f, 0.316258579f},
-std::array<float,2>{0.0678504631f, 0.994895995f},
-std::array<float,2>{0.268196136f, 0.181538954f},
-std::array<float,2>{0.624182403f, 0.565933108f},
-std::array<float,2>{0.676191866f, 0.0715356544f},
-std::array<float,2>{0.454036891f, 0.736355305f},
-std::array<float,2>{0.169879407f, 0.450559556f},
-std::array<float,2>{0.757633626f, 0.828547239f},
-std::array<float,2>{0.608940065f, 0.349562138f},
-std::array<float,2>{0.261773288f, 0.940339565f},
-std::array<float,2>{0.0846602544f, 0.150994763f},
-std::array<float,2>{0.921534657f, 0.624631703f},
-std::array<float,2>{0.768075109f, 0.122888297f},
-std::array<float,2>{0.176689237f, 0.696581244f},
-std::array<float,2>{0.447120368f, 0.473615408f},
-std::array<float,2>{0.664597213f, 0.850863934f},
-std::array<float,2>{0.949703991f, 0.421875119f},
-std::array<float,2>{0.0199370869f, 0.766452551f},
-std::array<float,2>{0.334005803f, 0.0370537788f},
-std::array<float,2>{0.544782162f, 0.63283056f},
-std::array<float,2>{0.714120448f, 0.218311474f},
-std::array<float,2>{0.383600742f, 0.553264141f},
-std::array<float,2>{0.200740755f, 0.274592727f},
-std::array<float,2>{0.865851581f, 0.918519974f},
-std::array<float,2>{0.653310955f, 0.466502339f},
-std::array<float,2>{0.499406457f, 0.825376868f},
-std::array<float,2>{0.149995491f, 0.0926479027f},
-std::array<float,2>{0.78359282f, 0.71935302f},
-std::array<float,2>{0.903441012f, 0.169685796f},
-std::array<float,2>{0.105469771f, 0.592474461f},
-std::array<float,2>{0.281865388f, 0.338270366f},
-std::array<float,2>{0.567063808f, 0.981043458f},
-std::array<float,2>{0.826884806f, 0.293453902f},
-std::array<float,2>{0.242268696f, 0.889390111f},
-std::array<float,2>{0.419095874f, 0.243276656f},
-std::array<float,2>{0.722143233f, 0.5096668f},
-std::array<float,2>{0.521331847f, 0.0260410309f},
-std::array<float,2>{0.353118002f, 0.685545921f},
-std::array<float,2>{0.0450563319f, 0.377714038f},
-std::array<float,2>{0.997882664f, 0.803466856f},
-std::array<float,2>{0.698745131f, 0.312756181f},
-std::array<float,2>{0.403414667f, 0.994133711f},
-std::array<float,2>{0.204109281f, 0.182545885f},
-std::array<float,2>{0.843798339f, 0.564010739f},
-std::array<float,2>{0.962623417f, 0.0739551857f},
-std::array<float,2>{0.00976951607f, 0.736193597f},
-std::array<float,2>{0.320519805f, 0.451980829f},
-std::array<float,2>{0.548002958f, 0.831597745f},
-std::array<float,2>{0.75681746f, 0.396145821f},
-std::array<float,2>{0.168571085f, 0.791055679f},
-std::array<float,2>{0.454547614f, 0.00940841157f},
-std::array<float,2>{0.676854253f, 0.660249472f},
-std::array<float,2>{0.623325944f, 0.220057786f},
-std::array<float,2>{0.269529641f, 0.525990903f},
-std::array<float,2>{0.0664590374f, 0.304053485f},
-std::array<float,2>{0.924785256f, 0.898060203f},
-std::array<float,2>{0.503996313f, 0.496098667f},
-std::array<float,2>{0.363995045f, 0.859654844f},
-std::array<float,2>{0.0493430048f, 0.106885388f},
-std::array<float,2>{0.972151399f, 0.704892159f},
-std::array<float,2>{0.831124008f, 0.128516123f},
-std::array<float,2>{0.2343411f, 0.594904721f},
-std::array<float,2>{0.426313668f, 0.361924052f},
-std::array<float,2>{0.742477834f, 0.959296346f},
-std::array<float,2>{0.887205422f, 0.261458993f},
-std::array<float,2>{0.111198977f, 0.933325708f},
-std::array<float,2>{0.309077322f, 0.193377972f},
-std::array<float,2>{0.592939138f, 0.538825333f},
-std::array<float,2>{0.637159944f, 0.0502520539f},
-std::array<float,2>{0.475855529f, 0.64985323f},
-std::array<float,2>{0.135915786f, 0.414210498f},
-std::array<float,2>{0.807516217f, 0.759838521f},
-std::array<float,2>{0.567715883f, 0.29646939f},
-std::array<float,2>{0.282841384f, 0.887854695f},
-std::array<float,2>{0.10670682f, 0.244263291f},
-std::array<float,2>{0.903218687f, 0.511106253f},
-std::array<float,2>{0.784892797f, 0.0238678828f},
-std::array<float,2>{0.148800924f, 0.686078548f},
-std::array<float,2>{0.498142183f, 0.376924127f},
-std::array<float,2>{0.654090762f, 0.800895572f},
-std::array<float,2>{0.996721685f, 0.468179166f},
-std::array<float,2>{0.046010118f, 0.826264918f},
-std::array<float,2>{0.352373719f, 0.0908236802f},
-std::array<float,2>{0.519560814f, 0.722367942f},
-std::array<float,2>{0.721675336f, 0.170038313f},
-std::array<float,2>{0.418285012f, 0.590119362f},
-std::array<float,2>{0.243545517f, 0.336246699f},
-std::array<float,2>{0.827623129f, 0.983609498f},
-std::array<float,2>{0.665431023f, 0.425656676f},
-std::array<float,2>{0.445954114f, 0.769253612f},
-std::array<float,2>{0.177523986f, 0.0384548865f},
-std::array<float,2>{0.768683136f, 0.636575222f},
-std::array<float,2>{0.920671105f, 0.215066388f},
-std::array<float,2>{0.0855598822f, 0.551051319f},
-std::array<float,2>{0.263524175f, 0.275653929f},
-std::array<float,2>{0.608354807f, 0.921010017f},
-std::array<float,2>{0.866951287f, 0.350125849f},
-std::array<float,2>{0.199887395f, 0.939261854f},
-std::array<float,2>{0.383879304f, 0.149701029f},
-std::array<float,2>{0.713078499f, 0.622201264f},
-std::array<float,2>{0.543384254f, 0.124385707f},
-std::array<float,2>{0.335226506f, 0.698380291f},
-std::array<float,2>{0.0206293613f, 0.476397574f},
-std::array<float,2>{0.950712502f, 0.848475337f},
-std::array<float,2>{0.641592801f, 0.269333512f},
-std::array<float,2>{0.488754332f, 0.907747149f},
-std::array<float,2>{0.146524236f, 0.20790799f},
-std::array<float,2>{0.789135814f, 0.561998308f},
-std::array<float,2>{0.893329918f, 0.0399209857f},
-std::array<float,2>{0.0968015492f, 0.629970431f},
-std::array<float,2>{0.289587617f, 0.430032402f},
-std::array<float,2>{0.574980259f, 0.780865371f},
-std::array<float,2>{0.813145041f, 0.483902872f},
-std::array<float,2>{0.242076203f, 0.855077982f},
-std::array<float,2>{0.408581018f, 0.110446826f},
-std::array<float,2>{0.72915864f, 0.690901756f},
-std::array<float,2>{0.524546504f, 0.144196063f},
-std::array<float,2>{0.350446135f, 0.60955435f},
-std::array<float,2>{0.0322322585f, 0.357670546f},
-std::array<float,2>{0.987974465f, 0.947830081f},
-std::array<float,2>{0.598552227f, 0.383601725f},
-std::array<float,2>{0.252938509f, 0.806941986f},
-std::array<float,2>{0.0922521278f, 0.0171386003f},
-std::array<float,2>{0.91126132f, 0.678170145f},
-std::array<float,2>{0.778883159f, 0.23710838f},
-std::array<float,2>{0.186655909f, 0.504541814f},
-std::array<float,2>{0.444663048f, 0.285880655f},
-std::array<float,2>{0.657873094f, 0.877748311f},
-std::array<float,2>{0.939736366f, 0.32824105f},
-std::array<float,2>{0.0234615449f, 0.974924088f},
-std::array<float,2>{0.342044443f, 0.162955031f},
-std::array<float,2>{0.538254917f, 0.580688059f},
-std::array<float,2>{0.704338253f, 0.0839855149f},
-std::array<float,2>{0.382642776f, 0.731202841f},
-std::array<float,2>{0.190959543f, 0.45639801f},
-std::array<float,2>{0.872910857f, 0.818505704f},
-std::array<float,2>{0.561508715f, 0.3672584f},
-std::array<float,2>{0.31956625f, 0.965624034f},
-std::array<float,2>{0.00228393031f, 0.137008876f},
-std::array<float,2>{0.955017745f, 0.60770756f},
-std::array<float,2>{0.852449477f, 0.100331575f},
-std::array<float,2>{0.21788083f, 0.718560934f},
-std::array<float,2>{0.393767715f, 0.487378091f},
-std::array<float,2>{0.692632794f, 0.872209489f},
-std::array<float,2>{0.93706876f, 0.413178533f},
-std::array<float,2>{0.0708582699f, 0.755272269f},
-std::array<float,2>{0.280475736f, 0.0591106005f},
-std::array<float,2>{0.617153347f, 0.643033326f},
-std::array<float,2>{0.682812631f, 0.19787766f},
-std::array<float,2>{0.461610019f, 0.543901086f},
-std::array<float,2>{0.159939945f, 0.250154346f},
-std::array<float,2>{0.763771057f, 0.925675809f},
-std::array<float,2>{0.734519482f, 0.437784463f},
-std::array<float,2>{0.436014265f, 0.842750907f},
-std::array<float,2>{0.226029426f, 0.0652482882f},
-std::array<float,2>{0.838187218f, 0.746702492f},
-std::array<float,2>{0.983519018f, 0.177162379f},
-std::array<float,2>{0.0575070679f, 0.572154284f},
-std::array<float,2>{0.367715389f, 0.32247439f},
-std::array<float,2>{0.513765633f, 0.992180228f},
-std::array<float,2>{0.798727632f, 0.307854205f},
-std::array<float,2>{0.127398029f, 0.899427831f},
-std::array<float,2>{0.483492881f, 0.231496096f},
-std::array<float,2>{0.630988836f, 0.52088815f},
-std::array<float,2>{0.583125055f, 0.00711274892f},
-std::array<float,2>{0.300591856f, 0.666589975f},
-std::array<float,2>{0.122410089f, 0.400281847f},
-std::array<float,2>{0.880448759f, 0.781430006f},
-std::array<float,2>{0.672107697f, 0.355344057f},
-std::array<float,2>{0.45881474f, 0.949484348f},
-std::array<float,2>{0.165053308f, 0.147967115f},
-std::array<float,2>{0.752360523f, 0.616998136f},
-std::array<float,2>{0.929143429f, 0.11520762f},
-std::array<float,2>{0.0640312955f, 0.694351256f},
-std::array<float,2>{0.272196531f, 0.476749003f},
-std::array<float,2>{0.617388606f, 0.858599246f},
-std::array<float,2>{0.84968251f, 0.434518814f},
-std::array<float,2>{0.210597441f, 0.776462853f},
-std::array<float,2>{0.398606718f, 0.0462320969f},
-std::array<float,2>{0.702421427f, 0.626085699f},
-std::array<float,2>{0.55147171f, 0.205408856f},
-std::array<float,2>{0.324805051f, 0.555980384f},
-std::array<float,2>{0.0155667299f, 0.269732147f},
-std::array<float,2>{0.965360165f, 0.91126591f},
-std::array<float,2>{0.587840736f, 0.45864287f},
-std::array<float,2>{0.306800008f, 0.814863026f},
-std::array<float,2>{0.116250195f, 0.0783702955f},
-std::array<float,2>{0.886372566f, 0.727645338f},
-std::array<float,2>{0.811554432f, 0.15980953f},
-std::array<float,2>{0.140155613f, 0.582612276f},
-std::array<float,2>{0.47134918f, 0.334821641f},
-std::array<float,2>{0.634956837f, 0.970736623f},
-std::array<float,2>{0.975835323f, 0.284062892f},
-std::array<float,2>{0.0532621183f, 0.882002354f},
-std::array<float,2>{0.361182094f, 0.239363328f},
-std::array<float,2>{0.502246261f, 0.502390862f},
-std::array<float,2>{0.748043418f, 0.0211594924f},
-std::array<float,2>{0.422928721f, 0.672208071f},
-std::array<float,2>{0.228603527f, 0.388822049f},
-std::array<float,2>{0.833361685f, 0.809948623f},
-std::array<float,2>{0.515694559f, 0.255913377f},
-std::array<float,2>{0.358468622f, 0.928328633f},
-std::array<float,2>{0.0390729047f, 0.199477732f},
-std::array<float,2>{0.994660258f, 0.542521656f},
-std::array<float,2>{0.822009265f, 0.0568416826f},
-std::array<float,2>{0.249357596f, 0.645507395f},
-std::array<float,2>{0.415565997f, 0.407304645f},
-std::array<float,2>{0.726528883f, 0.751922071f},
-std::array<float,2>{0.902070761f, 0.489197791f},
-std::array<float,2>{0.103147052f, 0.867544532f},
-std::array<float,2>{0.288374752f, 0.0970646143f},
-std::array<float,2>{0.566173434f, 0.711661398f},
-std::array<float,2>{0.648504555f, 0.132942513f},
-std::array<float,2>{0.49365887f, 0.605012f},
-std::array<float,2>{0.154056847f, 0.371399701f},
-std::array<float,2>{0.785803616f, 0.964762211f},
-std::array<float,2>{0.71527046f, 0.405290693f},
-std::array<float,2>{0.390052468f, 0.787192523f},
-std::array<float,2>{0.195887715f, 0.00150127651f},
-std::array<float,2>{0.862007797f, 0.66942203f},
-std::array<float,2>{0.946451306f, 0.226628751f},
-std::array<float,2>{0.0164409503f, 0.518665612f},
-std::array<float,2>{0.331457734f, 0.308660895f},
-std::array<float,2>{0.541976869f, 0.904356718f},
-std::array<float,2>{0.769574702f, 0.325964451f},
-std::array<float,2>{0.174428791f, 0.985155046f},
-std::array<float,2>{0.451120406f, 0.172822699f},
-std::array<float,2>{0.670724213f, 0.575247526f},
-std::array<float,2>{0.604050994f, 0.06920968f},
-std::array<float,2>{0.259649962f, 0.742514968f},
-std::array<float,2>{0.0798684806f, 0.442786396f},
-std::array<float,2>{0.915519238f, 0.839532614f},
-std::array<float,2>{0.733976781f, 0.29911679f},
-std::array<float,2>{0.412006527f, 0.893306434f},
-std::array<float,2>{0.236334026f, 0.223494872f},
-std::array<float,2>{0.818286121f, 0.529691815f},
-std::array<float,2>{0.992025077f, 0.0146924695f},
-std::array<float,2>{0.038430661f, 0.65756911f},
-std::array<float,2>{0.344463289f, 0.392056882f},
-std::array<float,2>{0.530367136f, 0.796343386f},
-std::array<float,2>{0.796140611f, 0.447926551f},
-std::array<float,2>{0.143272147f, 0.83262372f},
-std::array<float,2>{0.486809969f, 0.0747422874f},
-std::array<float,2>{0.646550536f, 0.740175903f},
-std::array<float,2>{0.570359409f, 0.185942709f},
-std::array<float,2>{0.296022028f, 0.567734957f},
-std::array<float,2>{0.101281628f, 0.31769529f},
-std::array<float,2>{0.894670546f, 0.996973991f},
-std::array<float,2>{0.532240152f, 0.421305537f},
-std::array<float,2>{0.339649528f, 0.764693439f},
-std::array<float,2>{0.0291252583f, 0.0535926037f},
-std::array<float,2>{0.943128467f, 0.655111432f},
-std::array<float,2>{0.867556393f, 0.188423961f},
-std::array<float,2>{0.194532707f, 0.53308326f},
-std::array<float,2>{0.376633286f, 0.262263685f},
-std::array<float,2>{0.707312942f, 0.935252607f},
-std::array<float,2>{0.907580078f, 0.367079645f},
-std::array<float,2>{0.0867433921f, 0.953707159f},
-std::array<float,2>{0.256207675f, 0.130297184f},
-std::array<float,2>{0.594258428f, 0.600800693f},
-std::array<float,2>{0.661117613f, 0.105000682f},
-std::array<float,2>{0.438922763f, 0.710921824f},
-std::array<float,2>{0.181738302f, 0.495886445f},
-std::array<float,2>{0.776899755f, 0.864765227f},
-std::array<float,2>{0.611709237f, 0.342420667f},
-std::array<float,2>{0.274781108f, 0.978354633f},
-std::array<float,2>{0.0760272294f, 0.1676943f},
-std::array<float,2>{0.932927787f, 0.586069942f},
-std::array<float,2>{0.761220098f, 0.0897120312f},
-std::array<float,2>{0.160929486f, 0.725789905f},
-std::array<float,2>{0.466412514f, 0.462953657f},
-std::array<float,2>{0.686772645f, 0.820334136f},
-std::array<float,2>{0.95782274f, 0.381687969f},
-std::array<float,2>{0.00529295439f, 0.800629079f},
-std::array<float,2>{0.314359933f, 0.02862137f},
-std::array<float,2>{0.557081819f, 0.682611525f},
-std::array<float,2>{0.690040767f, 0.246177182f},
-std::array<float,2>{0.394539237f, 0.513243973f},
-std::array<float,2>{0.211997479f, 0.291229934f},
-std::array<float,2>{0.857132971f, 0.886233747f},
-std::array<float,2>{0.626099825f, 0.47138238f},
-std::array<float,2>{0.479697853f, 0.847364306f},
-std::array<float,2>{0.131743565f, 0.118014976f},
-std::array<float,2>{0.803168654f, 0.702261865f},
-std::array<float,2>{0.876805305f, 0.154766977f},
-std::array<float,2>{0.118293099f, 0.620724082f},
-std::array<float,2>{0.302405447f, 0.34687075f},
-std::array<float,2>{0.580822945f, 0.944602549f},
-std::array<float,2>{0.842876434f, 0.279867202f},
-std::array<float,2>{0.22194913f, 0.914609611f},
-std::array<float,2>{0.432979703f, 0.214643463f},
-std::array<float,2>{0.741100073f, 0.548364758f},
-std::array<float,2>{0.511166275f, 0.0319267958f},
-std::array<float,2>{0.373234689f, 0.640331209f},
-std::array<float,2>{0.0592435151f, 0.426596314f},
-std::array<float,2>{0.978776991f, 0.773067653f},
-std::array<float,2>{0.746044636f, 0.361151367f},
-std::array<float,2>{0.428738177f, 0.958024561f},
-std::array<float,2>{0.232359409f, 0.125154555f},
-std::array<float,2>{0.828575134f, 0.596325099f},
-std::array<float,2>{0.969722748f, 0.108259954f},
-std::array<float,2>{0.0474061929f, 0.705145836f},
-std::array<float,2>{0.367028564f, 0.498399854f},
-std::array<float,2>{0.507682383f, 0.861733258f},
-std::array<float,2>{0.806423843f, 0.416759491f},
-std::array<float,2>{0.133901581f, 0.758393824f},
-std::array<float,2>{0.473282337f, 0.0479474887f},
-std::array<float,2>{0.639831662f, 0.65092665f},
-std::array<float,2>{0.590545833f, 0.191487163f},
-std::array<float,2>{0.312488317f, 0.535750151f},
-std::array<float,2>{0.112000741f, 0.259151667f},
-std::array<float,2>{0.890195906f, 0.930875063f},
-std::array<float,2>{0.549328566f, 0.450411171f},
-std::array<float,2>{0.322651595f, 0.828367054f},
-std::array<float,2>{0.0091999853f, 0.0714474618f},
-std::array<float,2>{0.964011312f, 0.736709833f},
-std::array<float,2>{0.846547902f, 0.181373969f},
-std::array<float,2>{0.206143662f, 0.566292822f},
-std::array<float,2>{0.404929519f, 0.316148609f},
-std::array<float,2>{0.695888877f, 0.994784117f},
-std::array<float,2>{0.92283535f, 0.301695257f},
-std::array<float,2>{0.0684955716f, 0.894687533f},
-std::array<float,2>{0.26712805f, 0.221711665f},
-std::array<float,2>{0.62242806f, 0.524218678f},
-std::array<float,2>{0.679505289f, 0.0102561293f},
-std::array<float,2>{0.45512566f, 0.663934231f},
-std::array<float,2>{0.170323059f, 0.39769274f},
-std::array<float,2>{0.755551755f, 0.791015148f},
-std::array<float,2>{0.606210291f, 0.274740338f},
-std::array<float,2>{0.265513957f, 0.918822885f},
-std::array<float,2>{0.0823186859f, 0.218681693f},
-std::array<float,2>{0.919412196f, 0.553561449f},
-std::array<float,2>{0.765781403f, 0.0368148945f},
-std::array<float,2>{0.178609729f, 0.633094907f},
-std::array<float,2>{0.448515147f, 0.422341049f},
-std::array<float,2>{0.667312741f, 0.766308486f},
-std::array<float,2>{0.951833189f, 0.473230928f},
-std::array<float,2>{0.022398809f, 0.850753546f},
-std::array<float,2>{0.333551049f, 0.122746654f},
-std::array<float,2>{0.545272887f, 0.696301579f},
-std::array<float,2>{0.712280929f, 0.151355296f},
-std::array<float,2>{0.385311842f, 0.624861062f},
-std::array<float,2>{0.202820584f, 0.349125326f},
-std::array<float,2>{0.864752352f, 0.94009608f},
-std::array<float,2>{0.6557073f, 0.377579987f},
-std::array<float,2>{0.497037649f, 0.803364456f},
-std::array<float,2>{0.151487842f, 0.0263040625f},
-std::array<float,2>{0.781375527f, 0.685068965f},
-std::array<float,2>{0.906084538f, 0.243487284f},
-std::array<float,2>{0.107846104f, 0.509447813f},
-std::array<float,2>{0.283764243f, 0.293033034f},
-std::array<float,2>{0.569679499f, 0.889639795f},
-std::array<float,2>{0.824844003f, 0.337963223f},
-std::array<float,2>{0.245328739f, 0.981242716f},
-std::array<float,2>{0.420771062f, 0.169540569f},
-std::array<float,2>{0.719557762f, 0.592665851f},
-std::array<float,2>{0.521588504f, 0.0923499539f},
-std::array<float,2>{0.353847295f, 0.719686031f},
-std::array<float,2>{0.0445995405f, 0.466785342f},
-std::array<float,2>{0.999685168f, 0.825563252f},
-std::array<float,2>{0.659973919f, 0.287385732f},
-std::array<float,2>{0.441659302f, 0.875435829f},
-std::array<float,2>{0.184597567f, 0.235051736f},
-std::array<float,2>{0.781220973f, 0.507321835f},
-std::array<float,2>{0.912877083f, 0.0192878637f},
-std::array<float,2>{0.0910612494f, 0.676367044f},
-std::array<float,2>{0.250692368f, 0.38495633f},
-std::array<float,2>{0.601056814f, 0.806042969f},
-std::array<float,2>{0.873894811f, 0.454859823f},
-std::array<float,2>{0.188067198f, 0.81698823f},
-std::array<float,2>{0.380036443f, 0.0832911506f},
-std::array<float,2>{0.706106544f, 0.733827174f},
-std::array<float,2>{0.535751104f, 0.161714092f},
-std::array<float,2>{0.340297431f, 0.580045223f},
-std::array<float,2>{0.0269649792f, 0.33016625f},
-std::array<float,2>{0.939429581f, 0.973582506f},
-std::array<float,2>{0.577905238f, 0.432190269f},
-std::array<float,2>{0.292074651f, 0.777468085f},
-std::array<float,2>{0.0952131376f, 0.0424750037f},
-std::array<float,2>{0.891270876f, 0.630899429f},
-std::array<float,2>{0.792822003f, 0.210024923f},
-std::array<float,2>{0.146449775f, 0.559429288f},
-std::array<float,2>{0.490402907f, 0.267317802f},
-std::array<float,2>{0.643643856f, 0.909970403f},
-std::array<float,2>{0.985628784f, 0.355738103f},
-std::array<float,2>{0.0344825983f, 0.94606483f},
-std::array<float,2>{0.349233121f, 0.142326206f},
-std::array<float,2>{0.525490582f, 0.612605333f},
-std::array<float,2>{0.727074921f, 0.112431534f},
-std::array<float,2>{0.406937748f, 0.68860358f},
-std::array<float,2>{0.239924058f, 0.481025815f},
-std::array<float,2>{0.815918267f, 0.851978004f},
-std::array<float,2>{0.512609839f, 0.321193635f},
-std::array<float,2>{0.369791746f, 0.988981605f},
-std::array<float,2>{0.0553559624f, 0.179198623f},
-std::array<float,2>{0.98239857f, 0.573809266f},
-std::array<float,2>{0.835942328f, 0.0637603253f},
-std::array<float,2>{0.223980725f, 0.748805821f},
-std::array<float,2>{0.434956104f, 0.439599872f},
-std::array<float,2>{0.737345815f, 0.840349734f},
-std::array<float,2>{0.882058024f, 0.401302069f},
-std::array<float,2>{0.123844795f, 0.784646809f},
-std::array<float,2>{0.297285169f, 0.00484264363f},
-std::array<float,2>{0.585073948f, 0.665397584f},
-std::array<float,2>{0.629488826f, 0.234194532f},
-std::array<float,2>{0.481838733f, 0.52216512f},
-std::array<float,2>{0.126833797f, 0.30632171f},
-std::array<float,2>{0.799058378f, 0.901353717f},
-std::array<float,2>{0.693452895f, 0.48591429f},
-std::array<float,2>{0.391333014f, 0.87454778f},
-std::array<float,2>{0.216606617f, 0.0995205119f},
-std::array<float,2>{0.854043484f, 0.716731608f},
-std::array<float,2>{0.956214786f, 0.138755292f},
-std::array<float,2>{0.000404873368f, 0.60581398f},
-std::array<float,2>{0.316584557f, 0.369399488f},
-std::array<float,2>{0.560049474f, 0.967549324f},
-std::array<float,2>{0.762484848f, 0.253747463f},
-std::array<float,2>{0.156333402f, 0.923487544f},
-std::array<float,2>{0.464763433f, 0.196254626f},
-std::array<float,2>{0.68040067f, 0.545289159f},
-std::array<float,2>{0.613826931f, 0.060858082f},
-std::array<float,2>{0.278790295f, 0.641131401f},
-std::array<float,2>{0.0741795674f, 0.411554396f},
-std::array<float,2>{0.934678674f, 0.756331444f},
-std::array<float,2>{0.63393116f, 0.332329839f},
-std::array<float,2>{0.468996048f, 0.968977392f},
-std::array<float,2>{0.138591155f, 0.156799883f},
-std::array<float,2>{0.809049904f, 0.585321009f},
-std::array<float,2>{0.88458693f, 0.0811232179f},
-std::array<float,2>{0.11355646f, 0.728810132f},
-std::array<float,2>{0.306553662f, 0.460528493f},
-std::array<float,2>{0.588987827f, 0.812892556f},
-std::array<float,2>{0.835079849f, 0.388428777f},
-std::array<float,2>{0.228502974f, 0.811011255f},
-std::array<float,2>{0.424538702f, 0.0217368565f},
-std::array<float,2>{0.749560177f, 0.674923182f},
-std::array<float,2>{0.501380742f, 0.241600618f},
-std::array<float,2>{0.36197269f, 0.500952303f},
-std::array<float,2>{0.0509954803f, 0.283029377f},
-std::array<float,2>{0.973653316f, 0.880250633f},
-std::array<float,2>{0.61918819f, 0.478767663f},
-std::array<float,2>{0.270620823f, 0.857018113f},
-std::array<float,2>{0.0653291196f, 0.115803599f},
-std::array<float,2>{0.926188886f, 0.692124009f},
-std::array<float,2>{0.750894547f, 0.145256206f},
-std::array<float,2>{0.166889578f, 0.613777339f},
-std::array<float,2>{0.459668458f, 0.352326035f},
-std::array<float,2>{0.67426753f, 0.951658428f},
-std::array<float,2>{0.968072534f, 0.272850394f},
-std::array<float,2>{0.0136712883f, 0.913989246f},
-std::array<float,2>{0.327493906f, 0.203906909f},
-std::array<float,2>{0.553733289f, 0.557587922f},
-std::array<float,2>{0.700367391f, 0.0430177934f},
-std::array<float,2>{0.400448501f, 0.628222466f},
-std::array<float,2>{0.20722121f, 0.436626852f},
-std::array<float,2>{0.848112702f, 0.773480177f},
-std::array<float,2>{0.539145291f, 0.311148793f},
-std::array<float,2>{0.329406977f, 0.904284716f},
-std::array<float,2>{0.0181740578f, 0.22924453f},
-std::array<float,2>{0.947899163f, 0.516443849f},
-std::array<float,2>{0.860105753f, 0.0035185921f},
-std::array<float,2>{0.197476745f, 0.670989692f},
-std::array<float,2>{0.387071788f, 0.403947026f},
-std::array<float,2>{0.718122721f, 0.785212278f},
-std::array<float,2>{0.917017639f, 0.444635302f},
-std::array<float,2>{0.0815848261f, 0.836595297f},
-std::array<float,2>{0.26060307f, 0.0680023283f},
-std::array<float,2>{0.602967441f, 0.745053887f},
-std::array<float,2>{0.669421732f, 0.174276248f},
-std::array<float,2>{0.452067256f, 0.576784074f},
-std::array<float,2>{0.173491657f, 0.327026129f},
-std::array<float,2>{0.772407115f, 0.987229347f},
-std::array<float,2>{0.723830104f, 0.408722162f},
-std::array<float,2>{0.41718635f, 0.752466738f},
-std::array<float,2>{0.246333525f, 0.0551374927f},
-std::array<float,2>{0.823263049f, 0.647293866f},
-std::array<float,2>{0.992256939f, 0.201908916f},
-std::array<float,2>{0.0422089398f, 0.539515793f},
-std::array<float,2>{0.357270688f, 0.254915267f},
-std::array<float,2>{0.519325435f, 0.926567137f},
-std::array<float,2>{0.787267923f, 0.374146283f},
-std::array<float,2>{0.155985013f, 0.962711871f},
-std::array<float,2>{0.495716065f, 0.135172471f},
-std::array<float,2>{0.651797295f, 0.603423297f},
-std::array<float,2>{0.562904656f, 0.0942482725f},
-std::array<float,2>{0.28694883f, 0.714767277f},
-std::array<float,2>{0.104326852f, 0.492129147f},
-std::array<float,2>{0.899548352f, 0.871067524f},
-std::array<float,2>{0.710885763f, 0.264791936f},
-std::array<float,2>{0.378660947f, 0.936748862f},
-std::array<float,2>{0.192618147f, 0.190273732f},
-std::array<float,2>{0.870953977f, 0.53355372f},
-std::array<float,2>{0.943448663f, 0.0526937768f},
-std::array<float,2>{0.0295810122f, 0.65322876f},
-std::array<float,2>{0.336944282f, 0.418408424f},
-std::array<float,2>{0.533698201f, 0.76175952f},
-std::array<float,2>{0.774660051f, 0.493147314f},
-std::array<float,2>{0.179907784f, 0.866462648f},
-std::array<float,2>{0.440658808f, 0.10217718f},
-std::array<float,2>{0.663968921f, 0.708383501f},
-std::array<float,2>{0.596775234f, 0.131868631f},
-std::array<float,2>{0.254786611f, 0.597906649f},
-std::array<float,2>{0.0885523558f, 0.36492303f},
-std::array<float,2>{0.908878922f, 0.955955863f},
-std::array<float,2>{0.528428137f, 0.393767446f},
-std::array<float,2>{0.347592413f, 0.794398606f},
-std::array<float,2>{0.0352631062f, 0.0135190757f},
-std::array<float,2>{0.988441944f, 0.660067022f},
-std::array<float,2>{0.819915712f, 0.226100862f},
-std::array<float,2>{0.236056536f, 0.529105246f},
-std::array<float,2>{0.412606716f, 0.29796055f},
-std::array<float,2>{0.731698871f, 0.892069519f},
-std::array<float,2>{0.898359239f, 0.318968803f},
-std::array<float,2>{0.0977582783f, 0.999247909f},
-std::array<float,2>{0.293579221f, 0.18458724f},
-std::array<float,2>{0.572454035f, 0.5701285f},
-std::array<float,2>{0.646078646f, 0.0765883774f},
-std::array<float,2>{0.486209929f, 0.741167724f},
-std::array<float,2>{0.142437115f, 0.447155416f},
-std::array<float,2>{0.794310868f, 0.834174037f},
-std::array<float,2>{0.579337299f, 0.343817204f},
-std::array<float,2>{0.303534329f, 0.94259119f},
-std::array<float,2>{0.120693691f, 0.152990595f},
-std::array<float,2>{0.877075076f, 0.617225111f},
-std::array<float,2>{0.800992727f, 0.119517729f},
-std::array<float,2>{0.130126074f, 0.70024699f},
-std::array<float,2>{0.477930516f, 0.469031632f},
-std::array<float,2>{0.628440559f, 0.844704628f},
-std::array<float,2>{0.977163076f, 0.428368688f},
-std::array<float,2>{0.0611108989f, 0.771053314f},
-std::array<float,2>{0.371880084f, 0.0335655697f},
-std::array<float,2>{0.50885129f, 0.636747003f},
-std::array<float,2>{0.738707721f, 0.211468637f},
-std::array<float,2>{0.430803299f, 0.549157262f},
-std::array<float,2>{0.219028726f, 0.278172582f},
-std::array<float,2>{0.841323733f, 0.916189373f},
-std::array<float,2>{0.68554163f, 0.46167028f},
-std::array<float,2>{0.468745261f, 0.823909461f},
-std::array<float,2>{0.162535697f, 0.0864089727f},
-std::array<float,2>{0.75884372f, 0.724103808f},
-std::array<float,2>{0.930679023f, 0.16473797f},
-std::array<float,2>{0.0772600919f, 0.589530706f},
-std::array<float,2>{0.276346475f, 0.340585172f},
-std::array<float,2>{0.611039937f, 0.98026371f},
-std::array<float,2>{0.85860759f, 0.290598631f},
-std::array<float,2>{0.212954447f, 0.883565009f},
-std::array<float,2>{0.397842199f, 0.249542296f},
-std::array<float,2>{0.68908602f, 0.515622914f},
-std::array<float,2>{0.555485606f, 0.0303832758f},
-std::array<float,2>{0.314811617f, 0.680131853f},
-std::array<float,2>{0.00655273721f, 0.37904191f},
-std::array<float,2>{0.959587514f, 0.797763765f},
-std::array<float,2>{0.720488191f, 0.337583631f},
-std::array<float,2>{0.42118609f, 0.982725561f},
-std::array<float,2>{0.244173944f, 0.171503142f},
-std::array<float,2>{0.82593286f, 0.591004252f},
-std::array<float,2>{0.998330593f, 0.0906656981f},
-std::array<float,2>{0.0438802093f, 0.721222281f},
-std::array<float,2>{0.355254799f, 0.467700928f},
-std::array<float,2>{0.522822499f, 0.827943027f},
-std::array<float,2>{0.783175349f, 0.375420749f},
-std::array<float,2>{0.151308596f, 0.802238345f},
-std::array<float,2>{0.49732244f, 0.0245097298f},
-std::array<float,2>{0.654342473f, 0.687327623f},
-std::array<float,2>{0.569199324f, 0.246039897f},
-std::array<float,2>{0.284498811f, 0.510121286f},
-std::array<float,2>{0.108702935f, 0.29507944f},
-std::array<float,2>{0.904580534f, 0.887607157f},
-std::array<float,2>{0.546265543f, 0.475010633f},
-std::array<float,2>{0.33261165f, 0.849591911f},
-std::array<float,2>{0.0227277391f, 0.123423524f},
-std::array<float,2>{0.952761412f, 0.698194683f},
-std::array<float,2>{0.863708496f, 0.14867869f},
-std::array<float,2>{0.201874509f, 0.621493816f},
-std::array<float,2>{0.385969251f, 0.351262927f},
-std::array<float,2>{0.711083293f, 0.937632501f},
-std::array<float,2>{0.918588102f, 0.27653861f},
-std::array<float,2>{0.0831705853f, 0.920763969f},
-std::array<float,2>{0.264122665f, 0.216274872f},
-std::array<float,2>{0.607259274f, 0.551990807f},
-std::array<float,2>{0.666559696f, 0.0375684723f},
-std::array<float,2>{0.447727382f, 0.635537028f},
-std::array<float,2>{0.178890899f, 0.424228191f},
-std::array<float,2>{0.766603291f, 0.768474698f},
-std::array<float,2>{0.621617317f, 0.303325206f},
-std::array<float,2>{0.265721589f, 0.897074401f},
-std::array<float,2>{0.0696301684f, 0.218772605f},
-std::array<float,2>{0.923585832f, 0.526454866f},
-std::array<float,2>{0.75431639f, 0.00873013027f},
-std::array<float,2>{0.171328977f, 0.661373436f},
-std::array<float,2>{0.456588358f, 0.395444781f},
-std::array<float,2>{0.67778635f, 0.792535543f},
-std::array<float,2>{0.963035643f, 0.452577412f},
-std::array<float,2>{0.00781511888f, 0.830761671f},
-std::array<float,2>{0.323888361f, 0.0727539435f},
-std::array<float,2>{0.550345898f, 0.73464632f},
-std::array<float,2>{0.697040915f, 0.183235332f},
-std::array<float,2>{0.40554446f, 0.563387752f},
-std::array<float,2>{0.205526367f, 0.313865036f},
-std::array<float,2>{0.846889973f, 0.992677152f},
-std::array<float,2>{0.639378071f, 0.415479332f},
-std::array<float,2>{0.473998696f, 0.761638641f},
-std::array<float,2>{0.133450985f, 0.0496065393f},
-std::array<float,2>{0.804945767f, 0.648875058f},
-std::array<float,2>{0.889012992f, 0.194767937f},
-std::array<float,2>{0.112685069f, 0.537642062f},
-std::array<float,2>{0.311024427f, 0.259808749f},
-std::array<float,2>{0.591436863f, 0.931717575f},
-std::array<float,2>{0.830061257f, 0.363048047f},
-std::array<float,2>{0.230706319f, 0.960073352f},
-std::array<float,2>{0.428159595f, 0.12703222f},
-std::array<float,2>{0.744416118f, 0.594700098f},
-std::array<float,2>{0.506646514f, 0.105939768f},
-std::array<float,2>{0.36587435f, 0.703414738f},
-std::array<float,2>{0.0478969105f, 0.497541785f},
-std::array<float,2>{0.969962656f, 0.861078143f},
-std::array<float,2>{0.681384802f, 0.251369864f},
-std::array<float,2>{0.46316573f, 0.924245179f},
-std::array<float,2>{0.157512337f, 0.198563665f},
-std::array<float,2>{0.763282418f, 0.543993652f},
-std::array<float,2>{0.934567511f, 0.0596165806f},
-std::array<float,2>{0.0726830214f, 0.643646002f},
-std::array<float,2>{0.278025657f, 0.41217944f},
-std::array<float,2>{0.614441752f, 0.754296064f},
-std::array<float,2>{0.854806781f, 0.487235397f},
-std::array<float,2>{0.215344802f, 0.871491909f},
-std::array<float,2>{0.39236033f, 0.100812405f},
-std::array<float,2>{0.695258379f, 0.717025399f},
-std::array<float,2>{0.558775604f, 0.13849774f},
-std::array<float,2>{0.318205267f, 0.609362066f},
-std::array<float,2>{0.00122557452f, 0.36905846f},
-std::array<float,2>{0.955121458f, 0.96588099f},
-std::array<float,2>{0.58446455f, 0.399078995f},
-std::array<float,2>{0.29798007f, 0.782440901f},
-std::array<float,2>{0.124973826f, 0.00585975265f},
-std::array<float,2>{0.881523013f, 0.667573571f},
-std::array<float,2>{0.800143421f, 0.231026441f},
-std::array<float,2>{0.125147611f, 0.51976645f},
-std::array<float,2>{0.480602413f, 0.307014734f},
-std::array<float,2>{0.630502403f, 0.898735166f},
-std::array<float,2>{0.980608821f, 0.323339164f},
-std::array<float,2>{0.0557373092f, 0.990571856f},
-std::array<float,2>{0.370672137f, 0.175873652f},
-std::array<float,2>{0.513124168f, 0.57107079f},
-std::array<float,2>{0.737031817f, 0.0655922368f},
-std::array<float,2>{0.434338003f, 0.74711293f},
-std::array<float,2>{0.223625407f, 0.439234108f},
-std::array<float,2>{0.837699771f, 0.843592525f},
-std::array<float,2>{0.527049065f, 0.358967066f},
-std::array<float,2>{0.348463863f, 0.948485613f},
-std::array<float,2>{0.0334168822f, 0.143292308f},
-std::array<float,2>{0.984494507f, 0.610401869f},
-std::array<float,2>{0.814771235f, 0.110246353f},
-std::array<float,2>{0.238634467f, 0.690329254f},
-std::array<float,2>{0.40771237f, 0.483167529f},
-std::array<float,2>{0.727782607f, 0.853763819f},
-std::array<float,2>{0.892059088f, 0.431237638f},
-std::array<float,2>{0.0944967121f, 0.779478967f},
-std::array<float,2>{0.291442454f, 0.0407830812f},
-std::array<float,2>{0.576790452f, 0.629881442f},
-std::array<float,2>{0.642685533f, 0.208248794f},
-std::array<float,2>{0.491582841f, 0.561362147f},
-std::array<float,2>{0.145502582f, 0.267816395f},
-std::array<float,2>{0.791227937f, 0.90633446f},
-std::array<float,2>{0.70542258f, 0.455163807f},
-std::array<float,2>{0.379334331f, 0.819434166f},
-std::array<float,2>{0.189052537f, 0.0851419047f},
-std::array<float,2>{0.874123812f, 0.732258201f},
-std::array<float,2>{0.937814713f, 0.16362597f},
-std::array<float,2>{0.0259864517f, 0.581104934f},
-std::array<float,2>{0.340964586f, 0.329929799f},
-std::array<float,2>{0.536822915f, 0.976391971f},
-std::array<float,2>{0.779821277f, 0.286704898f},
-std::array<float,2>{0.184132636f, 0.878623545f},
-std::array<float,2>{0.443270624f, 0.238125235f},
-std::array<float,2>{0.658362508f, 0.50501442f},
-std::array<float,2>{0.599947512f, 0.0162783097f},
-std::array<float,2>{0.251086891f, 0.679198802f},
-std::array<float,2>{0.0899556726f, 0.384443521f},
-std::array<float,2>{0.913452923f, 0.807637215f},
-std::array<float,2>{0.651323915f, 0.372461468f},
-std::array<float,2>{0.494799018f, 0.963799059f},
-std::array<float,2>{0.15434669f, 0.134373277f},
-std::array<float,2>{0.788450122f, 0.603754699f},
-std::array<float,2>{0.898715615f, 0.0962697342f},
-std::array<float,2>{0.104497053f, 0.712639511f},
-std::array<float,2>{0.285341322f, 0.489377618f},
-std::array<float,2>{0.564012825f, 0.868397117f},
-std::array<float,2>{0.822932661f, 0.407177418f},
-std::array<float,2>{0.247728959f, 0.75052762f},
-std::array<float,2>{0.416036576f, 0.0580747202f},
-std::array<float,2>{0.7226969f, 0.645996213f},
-std::array<float,2>{0.518498242f, 0.200791866f},
-std::array<float,2>{0.355494171f, 0.541452765f},
-std::array<float,2>{0.0418803133f, 0.257515192f},
-std::array<float,2>{0.993325651f, 0.929316401f},
-std::array<float,2>{0.602514982f, 0.441572994f},
-std::array<float,2>{0.260982156f, 0.838605642f},
-std::array<float,2>{0.0806168988f, 0.0696650222f},
-std::array<float,2>{0.916970372f, 0.743732512f},
-std::array<float,2>{0.773364007f, 0.173519388f},
-std::array<float,2>{0.172681481f, 0.574358881f},
-std::array<float,2>{0.452708155f, 0.325191677f},
-std::array<float,2>{0.668929636f, 0.985776663f},
-std::array<float,2>{0.948320091f, 0.309591651f},
-std::array<float,2>{0.018618945f, 0.906015694f},
-std::array<float,2>{0.328448236f, 0.228426471f},
-std::array<float,2>{0.540317297f, 0.517875075f},
-std::array<float,2>{0.717132986f, 0.000130984743f},
-std::array<float,2>{0.38839981f, 0.668660164f},
-std::array<float,2>{0.199044675f, 0.404567301f},
-std::array<float,2>{0.861290038f, 0.788325667f},
-std::array<float,2>{0.553669333f, 0.270662487f},
-std::array<float,2>{0.326540768f, 0.910948098f},
-std::array<float,2>{0.0122055858f, 0.206121832f},
-std::array<float,2>{0.967107892f, 0.555318594f},
-std::array<float,2>{0.848699689f, 0.0458553992f},
-std::array<float,2>{0.208406508f, 0.625917614f},
-std::array<float,2>{0.40158543f, 0.43525812f},
-std::array<float,2>{0.699233055f, 0.775403321f},
-std::array<float,2>{0.927608907f, 0.478447944f},
-std::array<float,2>{0.0663451254f, 0.858110368f},
-std::array<float,2>{0.26979515f, 0.113591366f},
-std::array<float,2>{0.620258689f, 0.693610847f},
-std::array<float,2>{0.675180674f, 0.14709112f},
-std::array<float,2>{0.459962368f, 0.615359068f},
-std::array<float,2>{0.1679499f, 0.353537828f},
-std::array<float,2>{0.751386404f, 0.950895667f},
-std::array<float,2>{0.74861896f, 0.390274793f},
-std::array<float,2>{0.425435692f, 0.808649957f},
-std::array<float,2>{0.226797432f, 0.0197041128f},
-std::array<float,2>{0.834070802f, 0.673306227f},
-std::array<float,2>{0.972739577f, 0.238745898f},
-std::array<float,2>{0.0523927808f, 0.503331304f},
-std::array<float,2>{0.362762511f, 0.284974426f},
-std::array<float,2>{0.500457466f, 0.880931973f},
-std::array<float,2>{0.810360312f, 0.335508525f},
-std::array<float,2>{0.13676627f, 0.972254038f},
-std::array<float,2>{0.469772667f, 0.158798024f},
-std::array<float,2>{0.633666039f, 0.583320916f},
-std::array<float,2>{0.587980986f, 0.0800396055f},
-std::array<float,2>{0.304850847f, 0.726975322f},
-std::array<float,2>{0.115055084f, 0.45706147f},
-std::array<float,2>{0.883481085f, 0.815942407f},
-std::array<float,2>{0.687940478f, 0.292860031f},
-std::array<float,2>{0.397047132f, 0.885356069f},
-std::array<float,2>{0.214693904f, 0.247969002f},
-std::array<float,2>{0.858047903f, 0.512170792f},
-std::array<float,2>{0.960701823f, 0.0278625991f},
-std::array<float,2>{0.00708817225f, 0.6826998f},
-std::array<float,2>{0.315634936f, 0.382151455f},
-std::array<float,2>{0.556230605f, 0.799103916f},
-std::array<float,2>{0.75827539f, 0.463940412f},
-std::array<float,2>{0.163780779f, 0.821566641f},
-std::array<float,2>{0.467769146f, 0.0881250873f},
-std::array<float,2>{0.684110999f, 0.725560069f},
-std::array<float,2>{0.610081553f, 0.166030988f},
-std::array<float,2>{0.276488543f, 0.587581575f},
-std::array<float,2>{0.0762837604f, 0.343571901f},
-std::array<float,2>{0.929981649f, 0.976877451f},
-std::array<float,2>{0.508757889f, 0.427502394f},
-std::array<float,2>{0.372783214f, 0.771861374f},
-std::array<float,2>{0.0623197444f, 0.0328276195f},
-std::array<float,2>{0.978218019f, 0.638698041f},
-std::array<float,2>{0.840339363f, 0.212954044f},
-std::array<float,2>{0.219841808f, 0.547142446f},
-std::array<float,2>{0.430053264f, 0.280745506f},
-std::array<float,2>{0.739820898f, 0.915311158f},
-std::array<float,2>{0.878221452f, 0.346322536f},
-std::array<float,2>{0.119602561f, 0.94419378f},
-std::array<float,2>{0.304485679f, 0.156011492f},
-std::array<float,2>{0.578585207f, 0.619412661f},
-std::array<float,2>{0.62771076f, 0.11876253f},
-std::array<float,2>{0.477004051f, 0.701297462f},
-std::array<float,2>{0.129073963f, 0.471914142f},
-std::array<float,2>{0.802597165f, 0.846443713f},
-std::array<float,2>{0.57374382f, 0.316498905f},
-std::array<float,2>{0.294864118f, 0.997277558f},
-std::array<float,2>{0.0994228944f, 0.186775818f},
-std::array<float,2>{0.896686375f, 0.566513002f},
-std::array<float,2>{0.793903768f, 0.0754971504f},
-std::array<float,2>{0.140769824f, 0.739102662f},
-std::array<float,2>{0.484494656f, 0.448557913f},
-std::array<float,2>{0.645068467f, 0.833460391f},
-std::array<float,2>{0.989893079f, 0.391186982f},
-std::array<float,2>{0.0365090072f, 0.795622885f},
-std::array<float,2>{0.345880002f, 0.0137279397f},
-std::array<float,2>{0.528101265f, 0.657072663f},
-std::array<float,2>{0.731176198f, 0.224351212f},
-std::array<float,2>{0.413565516f, 0.531174183f},
-std::array<float,2>{0.235058397f, 0.300459206f},
-std::array<float,2>{0.818701744f, 0.894472063f},
-std::array<float,2>{0.662860572f, 0.49435398f},
-std::array<float,2>{0.439510077f, 0.863383353f},
-std::array<float,2>{0.180853024f, 0.103817038f},
-std::array<float,2>{0.773731112f, 0.709706783f},
-std::array<float,2>{0.910042524f, 0.12950559f},
-std::array<float,2>{0.0890221521f, 0.600487709f},
-std::array<float,2>{0.254889548f, 0.366100848f},
-std::array<float,2>{0.596315742f, 0.954869628f},
-std::array<float,2>{0.869767249f, 0.262950718f},
-std::array<float,2>{0.191813156f, 0.934456885f},
-std::array<float,2>{0.377589166f, 0.188508585f},
-std::array<float,2>{0.709713876f, 0.53160125f},
-std::array<float,2>{0.534571052f, 0.0543729961f},
-std::array<float,2>{0.336842895f, 0.65608418f},
-std::array<float,2>{0.0303720161f, 0.42004177f},
-std::array<float,2>{0.944601893f, 0.764490724f},
-std::array<float,2>{0.714540422f, 0.347997934f},
-std::array<float,2>{0.38295579f, 0.940866172f},
-std::array<float,2>{0.200511187f, 0.152015731f},
-std::array<float,2>{0.865659058f, 0.623613f},
-std::array<float,2>{0.949863136f, 0.121756576f},
-std::array<float,2>{0.0204531737f, 0.695499182f},
-std::array<float,2>{0.334614247f, 0.473893493f},
-std::array<float,2>{0.544159472f, 0.850528896f},
-std::array<float,2>{0.767732739f, 0.423729926f},
-std::array<float,2>{0.176018402f, 0.767290831f},
-std::array<float,2>{0.446456105f, 0.0354911871f},
-std::array<float,2>{0.664414048f, 0.634114981f},
-std::array<float,2>{0.60885793f, 0.217742205f},
-std::array<float,2>{0.262215465f, 0.554082453f},
-std::array<float,2>{0.0840412006f, 0.274153978f},
-std::array<float,2>{0.92131424f, 0.919486463f},
-std::array<float,2>{0.520934284f, 0.465254933f},
-std::array<float,2>{0.352678239f, 0.824508309f},
-std::array<float,2>{0.0455749407f, 0.0928114355f},
-std::array<float,2>{0.997520089f, 0.719859302f},
-std::array<float,2>{0.826419294f, 0.168612942f},
-std::array<float,2>{0.242922723f, 0.592831552f},
-std::array<float,2>{0.419729888f, 0.338915825f},
-std::array<float,2>{0.722367883f, 0.982271552f},
-std::array<float,2>{0.904148519f, 0.294584632f},
-std::array<float,2>{0.106038965f, 0.889836609f},
-std::array<float,2>{0.281347245f, 0.242274746f},
-std::array<float,2>{0.566638827f, 0.50800997f},
-std::array<float,2>{0.652496219f, 0.026926592f},
-std::array<float,2>{0.49964413f, 0.684466481f},
-std::array<float,2>{0.149861857f, 0.377977252f},
-std::array<float,2>{0.783750653f, 0.804458797f},
-std::array<float,2>{0.592529535f, 0.257981777f},
-std::array<float,2>{0.310051024f, 0.93027097f},
-std::array<float,2>{0.109411031f, 0.192674667f},
-std::array<float,2>{0.888242066f, 0.537021935f},
-std::array<float,2>{0.807938755f, 0.0471303053f},
-std::array<float,2>{0.134827718f, 0.651660264f},
-std::array<float,2>{0.47481823f, 0.417251587f},
-std::array<float,2>{0.638327539f, 0.759332478f},
-std::array<float,2>{0.97095412f, 0.499809355f},
-std::array<float,2>{0.0499986634f, 0.86266005f},
-std::array<float,2>{0.364724129f, 0.10876096f},
-std::array<float,2>{0.505129337f, 0.706479549f},
-std::array<float,2>{0.743999064f, 0.12654376f},
-std::array<float,2>{0.427107871f, 0.597613215f},
-std::array<float,2>{0.23318924f, 0.359568357f},
-std::array<float,2>{0.830411971f, 0.957931459f},
-std::array<float,2>{0.676615715f, 0.397405237f},
-std::array<float,2>{0.453275859f, 0.789673209f},
-std::array<float,2>{0.169128433f, 0.0115342308f},
-std::array<float,2>{0.756908655f, 0.662403643f},
-std::array<float,2>{0.92545706f, 0.221165344f},
-std::array<float,2>{0.0679553077f, 0.524958909f},
-std::array<float,2>{0.268026084f, 0.301971078f},
-std::array<float,2>{0.624828398f, 0.895796478f},
-std::array<float,2>{0.845270216f, 0.315145373f},
-std::array<float,2>{0.203948855f, 0.995150983f},
-std::array<float,2>{0.402918279f, 0.180481106f},
-std::array<float,2>{0.698238075f, 0.564472198f},
-std::array<float,2>{0.547477067f, 0.0703221634f},
-std::array<float,2>{0.321560711f, 0.737715483f},
-std::array<float,2>{0.0115583176f, 0.44939211f},
-std::array<float,2>{0.961813331f, 0.829288602f},
-std::array<float,2>{0.632220268f, 0.305094779f},
-std::array<float,2>{0.482897311f, 0.902138233f},
-std::array<float,2>{0.128888547f, 0.232767224f},
-std::array<float,2>{0.797731161f, 0.523321033f},
-std::array<float,2>{0.879609048f, 0.00569331506f},
-std::array<float,2>{0.121144131f, 0.665024459f},
-std::array<float,2>{0.299054176f, 0.401371717f},
-std::array<float,2>{0.583001196f, 0.783282995f},
-std::array<float,2>{0.839255691f, 0.441274315f},
-std::array<float,2>{0.225041658f, 0.841271639f},
-std::array<float,2>{0.43710044f, 0.0633198619f},
-std::array<float,2>{0.735415459f, 0.749857724f},
-std::array<float,2>{0.515482962f, 0.178342283f},
-std::array<float,2>{0.368251115f, 0.572528541f},
-std::array<float,2>{0.0585144944f, 0.321766227f},
-std::array<float,2>{0.982478023f, 0.989960372f},
-std::array<float,2>{0.615390003f, 0.410704792f},
-std::array<float,2>{0.280052811f, 0.757336199f},
-std::array<float,2>{0.07166484f, 0.0618454218f},
-std::array<float,2>{0.935646236f, 0.641734004f},
-std::array<float,2>{0.764954448f, 0.196383342f},
-std::array<float,2>{0.158213109f, 0.545976341f},
-std::array<float,2>{0.462041885f, 0.25245598f},
-std::array<float,2>{0.682438791f, 0.921923518f},
-std::array<float,2>{0.954009116f, 0.370673239f},
-std::array<float,2>{0.00299874088f, 0.96800077f},
-std::array<float,2>{0.3191953f, 0.140414178f},
-std::array<float,2>{0.561608076f, 0.607045472f},
-std::array<float,2>{0.691884696f, 0.0978056118f},
-std::array<float,2>{0.393384904f, 0.715653062f},
-std::array<float,2>{0.217767343f, 0.484395087f},
-std::array<float,2>{0.853062868f, 0.873100102f},
-std::array<float,2>{0.537783682f, 0.331428587f},
-std::array<float,2>{0.342986852f, 0.974053323f},
-std::array<float,2>{0.0248538256f, 0.160898089f},
-std::array<float,2>{0.941381991f, 0.578702331f},
-std::array<float,2>{0.871579051f, 0.0830067694f},
-std::array<float,2>{0.189770088f, 0.733320773f},
-std::array<float,2>{0.380960971f, 0.454051971f},
-std::array<float,2>{0.704018176f, 0.818262339f},
-std::array<float,2>{0.910976827f, 0.386024296f},
-std::array<float,2>{0.092911832f, 0.804981887f},
-std::array<float,2>{0.252295941f, 0.0178371035f},
-std::array<float,2>{0.599262536f, 0.677723229f},
-std::array<float,2>{0.656645834f, 0.2362964f},
-std::array<float,2>{0.443476528f, 0.505933344f},
-std::array<float,2>{0.185855076f, 0.288271248f},
-std::array<float,2>{0.778082311f, 0.876137674f},
-std::array<float,2>{0.730049908f, 0.481922448f},
-std::array<float,2>{0.409974396f, 0.853175104f},
-std::array<float,2>{0.241140395f, 0.111736424f},
-std::array<float,2>{0.814084291f, 0.687658966f},
-std::array<float,2>{0.986995041f, 0.141594008f},
-std::array<float,2>{0.0319718495f, 0.61133188f},
-std::array<float,2>{0.35074836f, 0.356708318f},
-std::array<float,2>{0.523881674f, 0.946901619f},
-std::array<float,2>{0.790332496f, 0.266073406f},
-std::array<float,2>{0.147488594f, 0.908323348f},
-std::array<float,2>{0.489372641f, 0.209669247f},
-std::array<float,2>{0.641922355f, 0.560095906f},
-std::array<float,2>{0.575407863f, 0.0418707579f},
-std::array<float,2>{0.290375352f, 0.631880224f},
-std::array<float,2>{0.0961816385f, 0.433287859f},
-std::array<float,2>{0.89427799f, 0.778450131f},
-std::array<float,2>{0.671259224f, 0.327839762f},
-std::array<float,2>{0.449624985f, 0.987818062f},
-std::array<float,2>{0.175396711f, 0.175387815f},
-std::array<float,2>{0.771389544f, 0.577275038f},
-std::array<float,2>{0.914364398f, 0.066977717f},
-std::array<float,2>{0.0784859732f, 0.74533546f},
-std::array<float,2>{0.258356035f, 0.444188327f},
-std::array<float,2>{0.605112851f, 0.837729275f},
-std::array<float,2>{0.863010705f, 0.40277797f},
-std::array<float,2>{0.196328595f, 0.786654532f},
-std::array<float,2>{0.389112324f, 0.00223917607f},
-std::array<float,2>{0.716242969f, 0.670567691f},
-std::array<float,2>{0.542107761f, 0.230211824f},
-std::array<float,2>{0.331041127f, 0.516742826f},
-std::array<float,2>{0.0168890562f, 0.312015206f},
-std::array<float,2>{0.946200609f, 0.902584434f},
-std::array<float,2>{0.564676821f, 0.490625978f},
-std::array<float,2>{0.287559152f, 0.869601548f},
-std::array<float,2>{0.102285109f, 0.095524393f},
-std::array<float,2>{0.901130974f, 0.71302706f},
-std::array<float,2>{0.786525249f, 0.136320233f},
-std::array<float,2>{0.15316917f, 0.602363169f},
-std::array<float,2>{0.492328346f, 0.373371661f},
-std::array<float,2>{0.650235474f, 0.961071789f},
-std::array<float,2>{0.995586812f, 0.254793406f},
-std::array<float,2>{0.0407672822f, 0.927607358f},
-std::array<float,2>{0.357595891f, 0.202285543f},
-std::array<float,2>{0.51706481f, 0.540268421f},
-std::array<float,2>{0.7255615f, 0.0561287701f},
-std::array<float,2>{0.414173037f, 0.648182392f},
-std::array<float,2>{0.248443097f, 0.409554124f},
-std::array<float,2>{0.820955992f, 0.75352186f},
-std::array<float,2>{0.503044128f, 0.282199025f},
-std::array<float,2>{0.360329926f, 0.879792452f},
-std::array<float,2>{0.0541162081f, 0.240391329f},
-std::array<float,2>{0.975150824f, 0.501511514f},
-std::array<float,2>{0.832768857f, 0.0233840887f},
-std::array<float,2>{0.229792744f, 0.674205422f},
-std::array<float,2>{0.422215343f, 0.387384713f},
-std::array<float,2>{0.746402502f, 0.811634004f},
-std::array<float,2>{0.885433972f, 0.459886372f},
-std::array<float,2>{0.115600131f, 0.814123094f},
-std::array<float,2>{0.308347911f, 0.0801006705f},
-std::array<float,2>{0.586457431f, 0.729993403f},
-std::array<float,2>{0.635802567f, 0.157422259f},
-std::array<float,2>{0.471858859f, 0.584409714f},
-std::array<float,2>{0.138715953f, 0.333152592f},
-std::array<float,2>{0.81150502f, 0.970225573f},
-std::array<float,2>{0.701607704f, 0.436309159f},
-std::array<float,2>{0.399538368f, 0.774858773f},
-std::array<float,2>{0.209772781f, 0.0441533886f},
-std::array<float,2>{0.850633442f, 0.627128243f},
-std::array<float,2>{0.965884805f, 0.204181448f},
-std::array<float,2>{0.0144295339f, 0.558147252f},
-std::array<float,2>{0.325340897f, 0.271652013f},
-std::array<float,2>{0.552109599f, 0.912545979f},
-std::array<float,2>{0.753419638f, 0.352991074f},
-std::array<float,2>{0.164748847f, 0.952910364f},
-std::array<float,2>{0.457454413f, 0.146021023f},
-std::array<float,2>{0.673031211f, 0.614763439f},
-std::array<float,2>{0.618936598f, 0.116754338f},
-std::array<float,2>{0.273340076f, 0.693026006f},
-std::array<float,2>{0.0633346438f, 0.479662538f},
-std::array<float,2>{0.928461909f, 0.8563869f},
-std::array<float,2>{0.741451561f, 0.278387457f},
-std::array<float,2>{0.432485491f, 0.917442024f},
-std::array<float,2>{0.221371099f, 0.212412551f},
-std::array<float,2>{0.842244923f, 0.550001264f},
-std::array<float,2>{0.980017424f, 0.0345194228f},
-std::array<float,2>{0.060198158f, 0.63793999f},
-std::array<float,2>{0.374372721f, 0.429213375f},
-std::array<float,2>{0.510000527f, 0.769575834f},
-std::array<float,2>{0.80430311f, 0.470059693f},
-std::array<float,2>{0.132621273f, 0.845235646f},
-std::array<float,2>{0.47853899f, 0.120560236f},
-std::array<float,2>{0.625370383f, 0.700062871f},
-std::array<float,2>{0.581511021f, 0.15428938f},
-std::array<float,2>{0.301591039f, 0.618463159f},
-std::array<float,2>{0.117745936f, 0.345541239f},
-std::array<float,2>{0.875413656f, 0.942251623f},
-std::array<float,2>{0.558311284f, 0.38050279f},
-std::array<float,2>{0.313284874f, 0.7982409f},
-std::array<float,2>{0.00410933141f, 0.029808823f},
-std::array<float,2>{0.958389282f, 0.680962682f},
-std::array<float,2>{0.855517387f, 0.24843958f},
-std::array<float,2>{0.211202741f, 0.513766944f},
-std::array<float,2>{0.396057606f, 0.289488226f},
-std::array<float,2>{0.69114548f, 0.883997679f},
-std::array<float,2>{0.932184875f, 0.341245145f},
-std::array<float,2>{0.0743462294f, 0.978976786f},
-std::array<float,2>{0.273989469f, 0.165415481f},
-std::array<float,2>{0.612318695f, 0.588724315f},
-std::array<float,2>{0.686054051f, 0.0870837867f},
-std::array<float,2>{0.465162933f, 0.723400295f},
-std::array<float,2>{0.161704764f, 0.462565035f},
-std::array<float,2>{0.760152876f, 0.822983623f},
-std::array<float,2>{0.594920695f, 0.36396867f},
-std::array<float,2>{0.257605344f, 0.956391871f},
-std::array<float,2>{0.0874885246f, 0.131768554f},
-std::array<float,2>{0.90684706f, 0.599251747f},
-std::array<float,2>{0.775469422f, 0.103128165f},
-std::array<float,2>{0.183153167f, 0.707297146f},
-std::array<float,2>{0.438033253f, 0.49411273f},
-std::array<float,2>{0.661954641f, 0.865473568f},
-std::array<float,2>{0.941735983f, 0.419458091f},
-std::array<float,2>{0.0277189836f, 0.762992799f},
-std::array<float,2>{0.338415056f, 0.0515884422f},
-std::array<float,2>{0.531584442f, 0.653968155f},
-std::array<float,2>{0.70897007f, 0.190590978f},
-std::array<float,2>{0.375659496f, 0.534721434f},
-std::array<float,2>{0.193646446f, 0.263736159f},
-std::array<float,2>{0.868804991f, 0.936293602f},
-std::array<float,2>{0.648422599f, 0.446282804f},
-std::array<float,2>{0.488266826f, 0.835785151f},
-std::array<float,2>{0.144101024f, 0.0772933736f},
-std::array<float,2>{0.795754433f, 0.741273105f},
-std::array<float,2>{0.896226943f, 0.184107989f},
-std::array<float,2>{0.0996438339f, 0.568971097f},
-std::array<float,2>{0.29588452f, 0.319562405f},
-std::array<float,2>{0.571949542f, 0.998506844f},
-std::array<float,2>{0.817128897f, 0.297305316f},
-std::array<float,2>{0.237997368f, 0.890885234f},
-std::array<float,2>{0.411118239f, 0.224932402f},
-std::array<float,2>{0.732608914f, 0.527426064f},
-std::array<float,2>{0.529501975f, 0.0126138479f},
-std::array<float,2>{0.34477073f, 0.658887982f},
-std::array<float,2>{0.0372503214f, 0.392883182f},
-std::array<float,2>{0.991054595f, 0.792993307f},
-std::array<float,2>{0.703204513f, 0.329495281f},
-std::array<float,2>{0.381698191f, 0.975952685f},
-std::array<float,2>{0.190060243f, 0.16318734f},
-std::array<float,2>{0.871945381f, 0.581944883f},
-std::array<float,2>{0.940502644f, 0.0855687931f},
-std::array<float,2>{0.025359448f, 0.731725514f},
-std::array<float,2>{0.343512356f, 0.456052452f},
-std::array<float,2>{0.537455618f, 0.820268571f},
-std::array<float,2>{0.777517378f, 0.384145916f},
-std::array<float,2>{0.186349526f, 0.808223903f},
-std::array<float,2>{0.444212526f, 0.0157571808f},
-std::array<float,2>{0.656859636f, 0.679374695f},
-std::array<float,2>{0.598705471f, 0.237410218f},
-std::array<float,2>{0.252612323f, 0.505475104f},
-std::array<float,2>{0.0935407281f, 0.28622517f},
-std::array<float,2>{0.910381019f, 0.878206551f},
-std::array<float,2>{0.524390399f, 0.482756585f},
-std::array<float,2>{0.351439416f, 0.854053974f},
-std::array<float,2>{0.0312555134f, 0.109432332f},
-std::array<float,2>{0.986345351f, 0.689939439f},
-std::array<float,2>{0.813846529f, 0.142597973f},
-std::array<float,2>{0.240641147f, 0.61095655f},
-std::array<float,2>{0.409362048f, 0.358427554f},
-std::array<float,2>{0.729853868f, 0.949173689f},
-std::array<float,2>{0.89399457f, 0.268348515f},
-std::array<float,2>{0.0962032303f, 0.907086074f},
-std::array<float,2>{0.291011721f, 0.208718166f},
-std::array<float,2>{0.575978696f, 0.560920179f},
-std::array<float,2>{0.642240047f, 0.0403724276f},
-std::array<float,2>{0.489950806f, 0.629248679f},
-std::array<float,2>{0.148297399f, 0.430802166f},
-std::array<float,2>{0.790959418f, 0.780083895f},
-std::array<float,2>{0.582403183f, 0.307613254f},
-std::array<float,2>{0.299738675f, 0.89894855f},
-std::array<float,2>{0.121983834f, 0.230805576f},
-std::array<float,2>{0.879104435f, 0.520389915f},
-std::array<float,2>{0.797269881f, 0.00673874095f},
-std::array<float,2>{0.128269106f, 0.667241275f},
-std::array<float,2>{0.483024418f, 0.398820549f},
-std::array<float,2>{0.632570505f, 0.782963037f},
-std::array<float,2>{0.983048439f, 0.438928366f},
-std::array<float,2>{0.0576224774f, 0.84289372f},
-std::array<float,2>{0.369009495f, 0.066122815f},
-std::array<float,2>{0.514874041f, 0.747627079f},
-std::array<float,2>{0.73625505f, 0.17669268f},
-std::array<float,2>{0.436868072f, 0.570402205f},
-std::array<float,2>{0.225512967f, 0.324039638f},
-std::array<float,2>{0.839466929f, 0.990985811f},
-std::array<float,2>{0.682112575f, 0.412625521f},
-std::array<float,2>{0.462435097f, 0.754812241f},
-std::array<float,2>{0.158975497f, 0.0605396107f},
-std::array<float,2>{0.765522778f, 0.644265473f},
-std::array<float,2>{0.936154544f, 0.199170396f},
-std::array<float,2>{0.0721310824f, 0.544793367f},
-std::array<float,2>{0.279506505f, 0.251694381f},
-std::array<float,2>{0.616117775f, 0.924368978f},
-std::array<float,2>{0.852802932f, 0.368572742f},
-std::array<float,2>{0.217065841f, 0.966555536f},
-std::array<float,2>{0.392600805f, 0.138053998f},
-std::array<float,2>{0.691927731f, 0.608741999f},
-std::array<float,2>{0.562160194f, 0.101267345f},
-std::array<float,2>{0.318704307f, 0.717432439f},
-std::array<float,2>{0.00378441787f, 0.486797631f},
-std::array<float,2>{0.95319742f, 0.871657431f},
-std::array<float,2>{0.637857795f, 0.260694116f},
-std::array<float,2>{0.475540638f, 0.932585478f},
-std::array<float,2>{0.135448337f, 0.195234895f},
-std::array<float,2>{0.808106542f, 0.537291288f},
-std::array<float,2>{0.888015091f, 0.0489752926f},
-std::array<float,2>{0.110145748f, 0.649212599f},
-std::array<float,2>{0.310132891f, 0.415598154f},
-std::array<float,2>{0.59226054f, 0.761171877f},
-std::array<float,2>{0.830859661f, 0.497885257f},
-std::array<float,2>{0.232806906f, 0.860599101f},
-std::array<float,2>{0.427650094f, 0.105976135f},
-std::array<float,2>{0.743520558f, 0.703768671f},
-std::array<float,2>{0.505514085f, 0.127815217f},
-std::array<float,2>{0.36522761f, 0.593885303f},
-std::array<float,2>{0.0506730415f, 0.362641335f},
-std::array<float,2>{0.971209526f, 0.96051383f},
-std::array<float,2>{0.624422431f, 0.394747525f},
-std::array<float,2>{0.268487483f, 0.79207176f},
-std::array<float,2>{0.0674680769f, 0.00795623008f},
-std::array<float,2>{0.92487973f, 0.6618101f},
-std::array<float,2>{0.757467926f, 0.219289526f},
-std::array<float,2>{0.169655442f, 0.527222753f},
-std::array<float,2>{0.453754842f, 0.30301249f},
-std::array<float,2>{0.675863862f, 0.896619618f},
-std::array<float,2>{0.961138844f, 0.314294964f},
-std::array<float,2>{0.0108183986f, 0.992401659f},
-std::array<float,2>{0.321958303f, 0.182971552f},
-std::array<float,2>{0.546903968f, 0.562693357f},
-std::array<float,2>{0.697272241f, 0.0724388435f},
-std::array<float,2>{0.402813464f, 0.735006928f},
-std::array<float,2>{0.20315057f, 0.452795863f},
-std::array<float,2>{0.845006645f, 0.830376208f},
-std::array<float,2>{0.544511437f, 0.351020396f},
-std::array<float,2>{0.334364891f, 0.938288271f},
-std::array<float,2>{0.0195765141f, 0.149178952f},
-std::array<float,2>{0.949242175f, 0.622014701f},
-std::array<float,2>{0.8661201f, 0.123747759f},
-std::array<float,2>{0.201141328f, 0.697373688f},
-std::array<float,2>{0.383470774f, 0.475098848f},
-std::array<float,2>{0.713995099f, 0.8489995f},
-std::array<float,2>{0.921854854f, 0.424752921f},
-std::array<float,2>{0.0848095566f, 0.767662942f},
-std::array<float,2>{0.262125969f, 0.0378615633f},
-std::array<float,2>{0.609310508f, 0.634833217f},
-std::array<float,2>{0.664857626f, 0.216460973f},
-std::array<float,2>{0.446974635f, 0.55227679f},
-std::array<float,2>{0.176381975f, 0.277323604f},
-std::array<float,2>{0.768450856f, 0.920294285f},
-std::array<float,2>{0.721899927f, 0.46720475f},
-std::array<float,2>{0.419364244f, 0.827594101f},
-std::array<float,2>{0.242621958f, 0.0902915597f},
-std::array<float,2>{0.826944053f, 0.721120179f},
-std::array<float,2>{0.997616887f, 0.171087578f},
-std::array<float,2>{0.0452655293f, 0.591642857f},
-std::array<float,2>{0.353391111f, 0.337198734f},
-std::array<float,2>{0.521201968f, 0.98330164f},
-std::array<float,2>{0.783238113f, 0.295475155f},
-std::array<float,2>{0.150275245f, 0.887160182f},
-std::array<float,2>{0.499052197f, 0.245473862f},
-std::array<float,2>{0.652929902f, 0.510385275f},
-std::array<float,2>{0.567156374f, 0.0252002366f},
-std::array<float,2>{0.282117546f, 0.686907411f},
-std::array<float,2>{0.105808668f, 0.375846386f},
-std::array<float,2>{0.903583825f, 0.80233866f},
-std::array<float,2>{0.661308885f, 0.365601003f},
-std::array<float,2>{0.437715471f, 0.954249084f},
-std::array<float,2>{0.182960182f, 0.129162654f},
-std::array<float,2>{0.776016712f, 0.599980414f},
-std::array<float,2>{0.906438529f, 0.104095213f},
-std::array<float,2>{0.087215282f, 0.709469199f},
-std::array<float,2>{0.257206589f, 0.494922638f},
-std::array<float,2>{0.595217943f, 0.863942683f},
-std::array<float,2>{0.868202746f, 0.420766234f},
-std::array<float,2>{0.194041982f, 0.763764143f},
-std::array<float,2>{0.375225365f, 0.0537938811f},
-std::array<float,2>{0.708104968f, 0.655356526f},
-std::array<float,2>{0.532151461f, 0.189189553f},
-std::array<float,2>{0.338059336f, 0.532136977f},
-std::array<float,2>{0.0282812789f, 0.263496459f},
-std::array<float,2>{0.941909194f, 0.933775127f},
-std::array<float,2>{0.571754992f, 0.448938459f},
-std::array<float,2>{0.295068979f, 0.833942533f},
-std::array<float,2>{0.100319102f, 0.0760722011f},
-std::array<float,2>{0.895559609f, 0.738367558f},
-std::array<float,2>{0.795335472f, 0.187376857f},
-std::array<float,2>{0.143943667f, 0.566910505f},
-std::array<float,2>{0.487677842f, 0.317236394f},
-std::array<float,2>{0.647929847f, 0.997587681f},
-std::array<float,2>{0.990694284f, 0.299956143f},
-std::array<float,2>{0.0380529203f, 0.893853426f},
-std::array<float,2>{0.345559508f, 0.223938435f},
-std::array<float,2>{0.530106843f, 0.530562699f},
-std::array<float,2>{0.73334682f, 0.0143010253f},
-std::array<float,2>{0.410534143f, 0.656639695f},
-std::array<float,2>{0.237392753f, 0.391025245f},
-std::array<float,2>{0.816448569f, 0.794934869f},
-std::array<float,2>{0.510632455f, 0.281063348f},
-std::array<float,2>{0.374578118f, 0.915964067f},
-std::array<float,2>{0.059612114f, 0.213810116f},
-std::array<float,2>{0.979748607f, 0.547625422f},
-std::array<float,2>{0.842420042f, 0.032324858f},
-std::array<float,2>{0.22098428f, 0.639593363f},
-std::array<float,2>{0.431975186f, 0.427032053f},
-std::array<float,2>{0.742180467f, 0.772369087f},
-std::array<float,2>{0.8757779f, 0.472193003f},
-std::array<float,2>{0.117203653f, 0.845796287f},
-std::array<float,2>{0.301048905f, 0.118558683f},
-std::array<float,2>{0.581994712f, 0.701784432f},
-std::array<float,2>{0.625676215f, 0.155274272f},
-std::array<float,2>{0.479395926f, 0.619794071f},
-std::array<float,2>{0.13192147f, 0.346119583f},
-std::array<float,2>{0.804165542f, 0.943542361f},
-std::array<float,2>{0.690788627f, 0.382336497f},
-std::array<float,2>{0.395526856f, 0.799551249f},
-std::array<float,2>{0.211472049f, 0.0274521783f},
-std::array<float,2>{0.856006682f, 0.683452427f},
-std::array<float,2>{0.958587527f, 0.247517735f},
-std::array<float,2>{0.00479214452f, 0.512574911f},
-std::array<float,2>{0.312511802f, 0.292342246f},
-std::array<float,2>{0.557820261f, 0.885084927f},
-std::array<float,2>{0.760687768f, 0.342851669f},
-std::array<float,2>{0.161307961f, 0.97734803f},
-std::array<float,2>{0.465711087f, 0.166561857f},
-std::array<float,2>{0.685874045f, 0.587333322f},
-std::array<float,2>{0.613278091f, 0.088611953f},
-std::array<float,2>{0.273776799f, 0.725057304f},
-std::array<float,2>{0.0749493688f, 0.46436438f},
-std::array<float,2>{0.931834221f, 0.822079778f},
-std::array<float,2>{0.74666059f, 0.284327805f},
-std::array<float,2>{0.422506094f, 0.881683886f},
-std::array<float,2>{0.230273917f, 0.239172876f},
-std::array<float,2>{0.832474649f, 0.503577948f},
-std::array<float,2>{0.974680662f, 0.0202304907f},
-std::array<float,2>{0.0543284789f, 0.673631907f},
-std::array<float,2>{0.359444797f, 0.390082061f},
-std::array<float,2>{0.503458083f, 0.809430599f},
-std::array<float,2>{0.810735881f, 0.457604796f},
-std::array<float,2>{0.139194652f, 0.815433681f},
-std::array<float,2>{0.472171664f, 0.0793829933f},
-std::array<float,2>{0.636293292f, 0.727410197f},
-std::array<float,2>{0.586046815f, 0.158237278f},
-std::array<float,2>{0.308048636f, 0.583544254f},
-std::array<float,2>{0.1159648f, 0.335419625f},
-std::array<float,2>{0.885210395f, 0.971915066f},
-std::array<float,2>{0.552538991f, 0.434874415f},
-std::array<float,2>{0.325724363f, 0.77587992f},
-std::array<float,2>{0.013830401f, 0.0449752398f},
-std::array<float,2>{0.966415763f, 0.625117779f},
-std::array<float,2>{0.851511896f, 0.206690297f},
-std::array<float,2>{0.209375918f, 0.555032492f},
-std::array<float,2>{0.40031746f, 0.271471202f},
-std::array<float,2>{0.70209074f, 0.910315394f},
-std::array<float,2>{0.92783469f, 0.354253709f},
-std::array<float,2>{0.0627742484f, 0.950502753f},
-std::array<float,2>{0.272855371f, 0.14649941f},
-std::array<float,2>{0.6183936f, 0.616048872f},
-std::array<float,2>{0.673622727f, 0.114141695f},
-std::array<float,2>{0.457638592f, 0.693903267f},
-std::array<float,2>{0.164330721f, 0.477993101f},
-std::array<float,2>{0.753229141f, 0.857893944f},
-std::array<float,2>{0.60470736f, 0.324574411f},
-std::array<float,2>{0.258003831f, 0.985915601f},
-std::array<float,2>{0.0788217038f, 0.172976837f},
-std::array<float,2>{0.914739251f, 0.575021803f},
-std::array<float,2>{0.770910978f, 0.0700294673f},
-std::array<float,2>{0.174967572f, 0.743365347f},
-std::array<float,2>{0.450028956f, 0.44235763f},
-std::array<float,2>{0.671434045f, 0.837913454f},
-std::array<float,2>{0.945736945f, 0.4051494f},
-std::array<float,2>{0.0172653422f, 0.788805127f},
-std::array<float,2>{0.33016029f, 0.000975578325f},
-std::array<float,2>{0.542741895f, 0.668310225f},
-std::array<float,2>{0.716441095f, 0.227832064f},
-std::array<float,2>{0.389214754f, 0.518335283f},
-std::array<float,2>{0.197053894f, 0.310203969f},
-std::array<float,2>{0.862313688f, 0.905570209f},
-std::array<float,2>{0.649752319f, 0.489852309f},
-std::array<float,2>{0.492891043f, 0.869082093f},
-std::array<float,2>{0.152758032f, 0.0961620063f},
-std::array<float,2>{0.786776543f, 0.712028086f},
-std::array<float,2>{0.900839984f, 0.134058848f},
-std::array<float,2>{0.102001064f, 0.604220271f},
-std::array<float,2>{0.287974775f, 0.372916907f},
-std::array<float,2>{0.564997256f, 0.962987125f},
-std::array<float,2>{0.820687294f, 0.257033229f},
-std::array<float,2>{0.248612538f, 0.92882967f},
-std::array<float,2>{0.414758742f, 0.200598091f},
-std::array<float,2>{0.724612296f, 0.541933715f},
-std::array<float,2>{0.517402828f, 0.058505971f},
-std::array<float,2>{0.358258396f, 0.645646155f},
-std::array<float,2>{0.0402284227f, 0.406329364f},
-std::array<float,2>{0.995732188f, 0.750290751f},
-std::array<float,2>{0.72810936f, 0.357084543f},
-std::array<float,2>{0.408074588f, 0.946622252f},
-std::array<float,2>{0.238976374f, 0.140977696f},
-std::array<float,2>{0.815360248f, 0.612082899f},
-std::array<float,2>{0.985289872f, 0.112219058f},
-std::array<float,2>{0.0339343324f, 0.68811661f},
-std::array<float,2>{0.348014414f, 0.482178003f},
-std::array<float,2>{0.526478767f, 0.852630675f},
-std::array<float,2>{0.791724503f, 0.432716906f},
-std::array<float,2>{0.145003453f, 0.778845429f},
-std::array<float,2>{0.491958529f, 0.0412467755f},
-std::array<float,2>{0.643347085f, 0.632445097f},
-std::array<float,2>{0.576206267f, 0.209310442f},
-std::array<float,2>{0.291816801f, 0.559752107f},
-std::array<float,2>{0.0942197591f, 0.266158342f},
-std::array<float,2>{0.892168641f, 0.908754289f},
-std::array<float,2>{0.536517501f, 0.4535411f},
-std::array<float,2>{0.34138155f, 0.817438304f},
-std::array<float,2>{0.0257829577f, 0.0820901915f},
-std::array<float,2>{0.938052177f, 0.732455492f},
-std::array<float,2>{0.874950409f, 0.160258189f},
-std::array<float,2>{0.188666508f, 0.578363061f},
-std::array<float,2>{0.379601389f, 0.331805527f},
-std::array<float,2>{0.706035912f, 0.974327743f},
-std::array<float,2>{0.913691401f, 0.289022952f},
-std::array<float,2>{0.0907771289f, 0.876805365f},
-std::array<float,2>{0.251614422f, 0.235800356f},
-std::array<float,2>{0.600542963f, 0.506724536f},
-std::array<float,2>{0.658780813f, 0.0181657746f},
-std::array<float,2>{0.44278717f, 0.676792264f},
-std::array<float,2>{0.183780462f, 0.386454225f},
-std::array<float,2>{0.779709339f, 0.805612683f},
-std::array<float,2>{0.614980161f, 0.252372324f},
-std::array<float,2>{0.277646959f, 0.922474623f},
-std::array<float,2>{0.0732106119f, 0.197228238f},
-std::array<float,2>{0.934009433f, 0.546492875f},
-std::array<float,2>{0.763144076f, 0.0620884188f},
-std::array<float,2>{0.158027783f, 0.642570913f},
-std::array<float,2>{0.463649005f, 0.410168409f},
-std::array<float,2>{0.6807307f, 0.757268667f},
-std::array<float,2>{0.95591563f, 0.485094219f},
-std::array<float,2>{0.0019389228f, 0.873586059f},
-std::array<float,2>{0.317449272f, 0.0982917026f},
-std::array<float,2>{0.559388876f, 0.715198636f},
-std::array<float,2>{0.694436252f, 0.139920279f},
-std::array<float,2>{0.391750842f, 0.606462777f},
-std::array<float,2>{0.215157613f, 0.370605439f},
-std::array<float,2>{0.855093479f, 0.968356669f},
-std::array<float,2>{0.63015008f, 0.401993364f},
-std::array<float,2>{0.481043696f, 0.783783376f},
-std::array<float,2>{0.125885054f, 0.00519390916f},
-std::array<float,2>{0.800683081f, 0.66453594f},
-std::array<float,2>{0.880871892f, 0.233344704f},
-std::array<float,2>{0.124339111f, 0.522824585f},
-std::array<float,2>{0.298705399f, 0.30562526f},
-std::array<float,2>{0.584891915f, 0.901547253f},
-std::array<float,2>{0.837349772f, 0.321784139f},
-std::array<float,2>{0.222916141f, 0.989705145f},
-std::array<float,2>{0.433890969f, 0.178155228f},
-std::array<float,2>{0.736342609f, 0.573142171f},
-std::array<float,2>{0.51333487f, 0.0626420453f},
-std::array<float,2>{0.370169252f, 0.749233961f},
-std::array<float,2>{0.0564524606f, 0.440535516f},
-std::array<float,2>{0.981217325f, 0.841535866f},
-std::array<float,2>{0.678321123f, 0.302406847f},
-std::array<float,2>{0.456242502f, 0.896473348f},
-std::array<float,2>{0.171392441f, 0.221281439f},
-std::array<float,2>{0.75451237f, 0.524577558f},
-std::array<float,2>{0.92307049f, 0.0108635752f},
-std::array<float,2>{0.0698274076f, 0.66266197f},
-std::array<float,2>{0.266210675f, 0.39691025f},
-std::array<float,2>{0.62111789f, 0.789279997f},
-std::array<float,2>{0.847475231f, 0.449791968f},
-std::array<float,2>{0.206001714f, 0.829613149f},
-std::array<float,2>{0.406105816f, 0.0712563545f},
-std::array<float,2>{0.696325839f, 0.738110125f},
-std::array<float,2>{0.550281286f, 0.179695517f},
-std::array<float,2>{0.323243737f, 0.565269053f},
-std::array<float,2>{0.00863945391f, 0.31466049f},
-std::array<float,2>{0.96346426f, 0.996045709f},
-std::array<float,2>{0.591166019f, 0.417837799f},
-std::array<float,2>{0.311136693f, 0.758973539f},
-std::array<float,2>{0.11301183f, 0.0474541783f},
-std::array<float,2>{0.889431417f, 0.652276754f},
-std::array<float,2>{0.805616736f, 0.192907467f},
-std::array<float,2>{0.132990375f, 0.536525846f},
-std::array<float,2>{0.474466592f, 0.258499324f},
-std::array<float,2>{0.638891935f, 0.930109978f},
-std::array<float,2>{0.970347166f, 0.360223234f},
-std::array<float,2>{0.0486685f, 0.957068324f},
-std::array<float,2>{0.365363449f, 0.126186401f},
-std::array<float,2>{0.50608623f, 0.59707129f},
-std::array<float,2>{0.745094776f, 0.109321997f},
-std::array<float,2>{0.428269207f, 0.706907988f},
-std::array<float,2>{0.2313907f, 0.49915567f},
-std::array<float,2>{0.829113305f, 0.862893999f},
-std::array<float,2>{0.523274362f, 0.339835793f},
-std::array<float,2>{0.354512423f, 0.981848955f},
-std::array<float,2>{0.043076098f, 0.168026164f},
-std::array<float,2>{0.998773456f, 0.59335506f},
-std::array<float,2>{0.825478256f, 0.0932740346f},
-std::array<float,2>{0.24474895f, 0.720518053f},
-std::array<float,2>{0.42176199f, 0.465603709f},
-std::array<float,2>{0.719929039f, 0.825041354f},
-std::array<float,2>{0.905084372f, 0.378582835f},
-std::array<float,2>{0.10921254f, 0.80403322f},
-std::array<float,2>{0.285149246f, 0.0268170275f},
-std::array<float,2>{0.568683565f, 0.683876336f},
-std::array<float,2>{0.655008852f, 0.24276495f},
-std::array<float,2>{0.497836977f, 0.508620143f},
-std::array<float,2>{0.150485247f, 0.293995082f},
-std::array<float,2>{0.782523513f, 0.890475869f},
-std::array<float,2>{0.71148777f, 0.474192888f},
-std::array<float,2>{0.386426598f, 0.849617004f},
-std::array<float,2>{0.201181948f, 0.12124534f},
-std::array<float,2>{0.863771498f, 0.69595623f},
-std::array<float,2>{0.952631831f, 0.151772812f},
-std::array<float,2>{0.0230957344f, 0.623140335f},
-std::array<float,2>{0.332033426f, 0.348282069f},
-std::array<float,2>{0.546460688f, 0.941151261f},
-std::array<float,2>{0.767276108f, 0.273676425f},
-std::array<float,2>{0.179679677f, 0.919149578f},
-std::array<float,2>{0.447810531f, 0.216819763f},
-std::array<float,2>{0.666178465f, 0.554322481f},
-std::array<float,2>{0.606601775f, 0.0360846296f},
-std::array<float,2>{0.264393955f, 0.634283304f},
-std::array<float,2>{0.0838209167f, 0.422888249f},
-std::array<float,2>{0.918436825f, 0.76707375f},
-std::array<float,2>{0.644602478f, 0.32004565f},
-std::array<float,2>{0.484996796f, 0.99854821f},
-std::array<float,2>{0.141157106f, 0.184067518f},
-std::array<float,2>{0.793123245f, 0.568392992f},
-std::array<float,2>{0.897285938f, 0.0776628926f},
-std::array<float,2>{0.0988613963f, 0.741710424f},
-std::array<float,2>{0.294356138f, 0.445538312f},
-std::array<float,2>{0.573485613f, 0.835307062f},
-std::array<float,2>{0.818901777f, 0.393469274f},
-std::array<float,2>{0.23451224f, 0.793594778f},
-std::array<float,2>{0.413835943f, 0.0118076708f},
-std::array<float,2>{0.730527043f, 0.658589661f},
-std::array<float,2>{0.527668417f, 0.225130498f},
-std::array<float,2>{0.346491754f, 0.527887285f},
-std::array<float,2>{0.0366548151f, 0.297547102f},
-std::array<float,2>{0.989677489f, 0.891245306f},
-std::array<float,2>{0.595772684f, 0.493467689f},
-std::array<float,2>{0.255548477f, 0.866055191f},
-std::array<float,2>{0.0894912481f, 0.102897882f},
-std::array<float,2>{0.909492135f, 0.707907259f},
-std::array<float,2>{0.774306417f, 0.131287783f},
-std::array<float,2>{0.181241766f, 0.598696411f},
-std::array<float,2>{0.440117657f, 0.36366269f},
-std::array<float,2>{0.662373722f, 0.956875384f},
-std::array<float,2>{0.945239961f, 0.264165252f},
-std::array<float,2>{0.0307714641f, 0.935986221f},
-std::array<float,2>{0.336015612f, 0.191232964f},
-std::array<float,2>{0.534747124f, 0.534560382f},
-std::array<float,2>{0.709316015f, 0.051022362f},
-std::array<float,2>{0.377132237f, 0.653526485f},
-std::array<float,2>{0.192220107f, 0.418999553f},
-std::array<float,2>{0.869403899f, 0.763448477f},
-std::array<float,2>{0.555918455f, 0.289672703f},
-std::array<float,2>{0.316229016f, 0.884725392f},
-std::array<float,2>{0.00777445501f, 0.248857632f},
-std::array<float,2>{0.96042484f, 0.514478087f},
-std::array<float,2>{0.857674241f, 0.0295770876f},
-std::array<float,2>{0.213877618f, 0.681470573f},
-std::array<float,2>{0.396778286f, 0.380057424f},
-std::array<float,2>{0.68846333f, 0.798621774f},
-std::array<float,2>{0.930584669f, 0.46213454f},
-std::array<float,2>{0.0771445259f, 0.822397768f},
-std::array<float,2>{0.277194917f, 0.0877074897f},
-std::array<float,2>{0.60975492f, 0.722973824f},
-std::array<float,2>{0.68370837f, 0.16563943f},
-std::array<float,2>{0.46683526f, 0.588310838f},
-std::array<float,2>{0.163448825f, 0.341396868f},
-std::array<float,2>{0.758653283f, 0.979264319f},
-std::array<float,2>{0.739546061f, 0.428951114f},
-std::array<float,2>{0.430364519f, 0.770272195f},
-std::array<float,2>{0.220333681f, 0.0347029231f},
-std::array<float,2>{0.839930832f, 0.638224185f},
-std::array<float,2>{0.978008032f, 0.212168708f},
-std::array<float,2>{0.0617860779f, 0.550728917f},
-std::array<float,2>{0.372249693f, 0.278935313f},
-std::array<float,2>{0.507822812f, 0.917705834f},
-std::array<float,2>{0.80224216f, 0.344968289f},
-std::array<float,2>{0.129513443f, 0.941708207f},
-std::array<float,2>{0.47721377f, 0.15372102f},
-std::array<float,2>{0.627019048f, 0.619119465f},
-std::array<float,2>{0.578685701f, 0.121061258f},
-std::array<float,2>{0.303884208f, 0.699589729f},
-std::array<float,2>{0.119831242f, 0.47059536f},
-std::array<float,2>{0.878493428f, 0.845032632f},
-std::array<float,2>{0.699958444f, 0.272200793f},
-std::array<float,2>{0.40196985f, 0.912960768f},
-std::array<float,2>{0.208563611f, 0.204882056f},
-std::array<float,2>{0.849317551f, 0.557707667f},
-std::array<float,2>{0.967356205f, 0.0448693633f},
-std::array<float,2>{0.0125528667f, 0.627681136f},
-std::array<float,2>{0.327085197f, 0.436023146f},
-std::array<float,2>{0.552934647f, 0.775095761f},
-std::array<float,2>{0.75190711f, 0.480069369f},
-std::array<float,2>{0.167136014f, 0.855873764f},
-std::array<float,2>{0.460735917f, 0.116486154f},
-std::array<float,2>{0.675700247f, 0.692478657f},
-std::array<float,2>{0.620797575f, 0.145854607f},
-std::array<float,2>{0.270476222f, 0.614745975f},
-std::array<float,2>{0.0656250566f, 0.353492916f},
-std::array<float,2>{0.927167773f, 0.952483237f},
-std::array<float,2>{0.500807822f, 0.386860371f},
-std::array<float,2>{0.362965435f, 0.812434137f},
-std::array<float,2>{0.0519536324f, 0.0225006063f},
-std::array<float,2>{0.973606288f, 0.674694717f},
-std::array<float,2>{0.834928334f, 0.240863129f},
-std::array<float,2>{0.227216914f, 0.501100719f},
-std::array<float,2>{0.425248235f, 0.281321585f},
-std::array<float,2>{0.7481758f, 0.878971994f},
-std::array<float,2>{0.882926762f, 0.333706528f},
-std::array<float,2>{0.114610896f, 0.970199883f},
-std::array<float,2>{0.305482507f, 0.157940701f},
-std::array<float,2>{0.588813245f, 0.584938228f},
-std::array<float,2>{0.632951975f, 0.0807336569f},
-std::array<float,2>{0.470684022f, 0.729827166f},
-std::array<float,2>{0.137585476f, 0.459272772f},
-std::array<float,2>{0.809578538f, 0.813566327f},
-std::array<float,2>{0.56362164f, 0.373822033f},
-std::array<float,2>{0.285664529f, 0.961520493f},
-std::array<float,2>{0.1049821f, 0.135851994f},
-std::array<float,2>{0.899410665f, 0.601772666f},
-std::array<float,2>{0.78891784f, 0.0950722694f},
-std::array<float,2>{0.154930189f, 0.713574171f},
-std::array<float,2>{0.494488567f, 0.490868926f},
-std::array<float,2>{0.650442004f, 0.870025992f},
-std::array<float,2>{0.993931532f, 0.409968346f},
-std::array<float,2>{0.0413565226f, 0.753320277f},
-std::array<float,2>{0.356055081f, 0.0564820021f},
-std::array<float,2>{0.517616689f, 0.647731185f},
-std::array<float,2>{0.723536491f, 0.202876091f},
-std::array<float,2>{0.416591585f, 0.540899515f},
-std::array<float,2>{0.247085929f, 0.254105687f},
-std::array<float,2>{0.822343588f, 0.927092433f},
-std::array<float,2>{0.668199599f, 0.443582088f},
-std::array<float,2>{0.452568889f, 0.837223828f},
-std::array<float,2>{0.172074452f, 0.0667212829f},
-std::array<float,2>{0.772736847f, 0.745831549f},
-std::array<float,2>{0.916096747f, 0.174934492f},
-std::array<float,2>{0.08045692f, 0.577718139f},
-std::array<float,2>{0.261404157f, 0.327429026f},
-std::array<float,2>{0.601614058f, 0.987400591f},
-std::array<float,2>{0.860467196f, 0.311851561f},
-std::array<float,2>{0.198603466f, 0.903115451f},
-std::array<float,2>{0.387767464f, 0.22994633f},
-std::array<float,2>{0.717651248f, 0.517128706f},
-std::array<float,2>{0.540673077f, 0.00282565155f},
-std::array<float,2>{0.329068005f, 0.670157552f},
-std::array<float,2>{0.0191307981f, 0.402980328f},
-std::array<float,2>{0.949116111f, 0.786576807f},
-std::array<float,2>{0.738016427f, 0.323130578f},
-std::array<float,2>{0.435546488f, 0.991390526f},
-std::array<float,2>{0.22453998f, 0.177724898f},
-std::array<float,2>{0.83665514f, 0.571397543f},
-std::array<float,2>{0.981587768f, 0.064787738f},
-std::array<float,2>{0.0547530241f, 0.746210873f},
-std::array<float,2>{0.369541645f, 0.438272685f},
-std::array<float,2>{0.512014687f, 0.841987431f},
-std::array<float,2>{0.799498141f, 0.399838537f},
-std::array<float,2>{0.126207933f, 0.782016158f},
-std::array<float,2>{0.482221186f, 0.00745127909f},
-std::array<float,2>{0.629321933f, 0.666223407f},
-std::array<float,2>{0.585882664f, 0.232307225f},
-std::array<float,2>{0.297545671f, 0.521136582f},
-std::array<float,2>{0.12314973f, 0.308297068f},
-std::array<float,2>{0.882575095f, 0.900085032f},
-std::array<float,2>{0.5605129f, 0.487994879f},
-std::array<float,2>{0.316950321f, 0.872594297f},
-std::array<float,2>{0.000749895175f, 0.0996491015f},
-std::array<float,2>{0.956861019f, 0.717830539f},
-std::array<float,2>{0.85360378f, 0.137277558f},
-std::array<float,2>{0.216020063f, 0.608082592f},
-std::array<float,2>{0.391043156f, 0.367737174f},
-std::array<float,2>{0.694274127f, 0.96499455f},
-std::array<float,2>{0.935235381f, 0.250537813f},
-std::array<float,2>{0.0732515231f, 0.925203919f},
-std::array<float,2>{0.279089928f, 0.197597146f},
-std::array<float,2>{0.613681138f, 0.543340325f},
-std::array<float,2>{0.679694474f, 0.0588800199f},
-std::array<float,2>{0.464304864f, 0.643338621f},
-std::array<float,2>{0.156825885f, 0.414020419f},
-std::array<float,2>{0.761728823f, 0.755716383f},
-std::array<float,2>{0.601291299f, 0.285282731f},
-std::array<float,2>{0.250239015f, 0.877007127f},
-std::array<float,2>{0.0913098082f, 0.236594588f},
-std::array<float,2>{0.912126362f, 0.504145026f},
-std::array<float,2>{0.780411303f, 0.0168255344f},
-std::array<float,2>{0.185313419f, 0.678623796f},
-std::array<float,2>{0.442297697f, 0.382950336f},
-std::array<float,2>{0.659319341f, 0.807462275f},
-std::array<float,2>{0.938909888f, 0.456973344f},
-std::array<float,2>{0.0266377795f, 0.819167376f},
-std::array<float,2>{0.340752453f, 0.0847557485f},
-std::array<float,2>{0.535192192f, 0.730567873f},
-std::array<float,2>{0.706876338f, 0.162173584f},
-std::array<float,2>{0.380561262f, 0.580459297f},
-std::array<float,2>{0.187717855f, 0.328909367f},
-std::array<float,2>{0.873134673f, 0.975365937f},
-std::array<float,2>{0.644393206f, 0.430425107f},
-std::array<float,2>{0.49103719f, 0.780430198f},
-std::array<float,2>{0.145973027f, 0.0394381769f},
-std::array<float,2>{0.792397201f, 0.63043946f},
-std::array<float,2>{0.89065516f, 0.207494482f},
-std::array<float,2>{0.0952677354f, 0.562315762f},
-std::array<float,2>{0.292797863f, 0.268683106f},
-std::array<float,2>{0.577453613f, 0.907490194f},
-std::array<float,2>{0.815739274f, 0.358198345f},
-std::array<float,2>{0.239547506f, 0.947641015f},
-std::array<float,2>{0.406267226f, 0.143607557f},
-std::array<float,2>{0.726985216f, 0.609998405f},
-std::array<float,2>{0.526274145f, 0.111296542f},
-std::array<float,2>{0.348633558f, 0.691117227f},
-std::array<float,2>{0.0349404253f, 0.483724654f},
-std::array<float,2>{0.986241519f, 0.854604721f},
-std::array<float,2>{0.667654037f, 0.276290745f},
-std::array<float,2>{0.448891103f, 0.921408892f},
-std::array<float,2>{0.177956164f, 0.215560153f},
-std::array<float,2>{0.766507387f, 0.551271498f},
-std::array<float,2>{0.919462562f, 0.0387044214f},
-std::array<float,2>{0.0826254338f, 0.635771394f},
-std::array<float,2>{0.264944494f, 0.424925059f},
-std::array<float,2>{0.605796576f, 0.768878281f},
-std::array<float,2>{0.864553392f, 0.476072252f},
-std::array<float,2>{0.202606693f, 0.847925961f},
-std::array<float,2>{0.385085583f, 0.124559708f},
-std::array<float,2>{0.712657332f, 0.699102342f},
-std::array<float,2>{0.545524597f, 0.150065318f},
-std::array<float,2>{0.333334386f, 0.622948349f},
-std::array<float,2>{0.0217798855f, 0.349847168f},
-std::array<float,2>{0.951209486f, 0.938906193f},
-std::array<float,2>{0.570085585f, 0.376118928f},
-std::array<float,2>{0.283278972f, 0.801536918f},
-std::array<float,2>{0.10800308f, 0.0239499882f},
-std::array<float,2>{0.905731618f, 0.685792983f},
-std::array<float,2>{0.782077551f, 0.244654387f},
-std::array<float,2>{0.15209502f, 0.511495471f},
-std::array<float,2>{0.496146321f, 0.296366453f},
-std::array<float,2>{0.65596956f, 0.888202906f},
-std::array<float,2>{0.999110878f, 0.336682945f},
-std::array<float,2>{0.0441263132f, 0.984302998f},
-std::array<float,2>{0.354460895f, 0.170717239f},
-std::array<float,2>{0.521976948f, 0.590384722f},
-std::array<float,2>{0.71903187f, 0.0913278311f},
-std::array<float,2>{0.420032561f, 0.721972525f},
-std::array<float,2>{0.245638937f, 0.468733281f},
-std::array<float,2>{0.824368417f, 0.82709378f},
-std::array<float,2>{0.507306933f, 0.361658007f},
-std::array<float,2>{0.366342664f, 0.959483027f},
-std::array<float,2>{0.0468878783f, 0.128281757f},
-std::array<float,2>{0.968768895f, 0.595421493f},
-std::array<float,2>{0.82875818f, 0.106976151f},
-std::array<float,2>{0.231641129f, 0.704380453f},
-std::array<float,2>{0.429654181f, 0.497051895f},
-std::array<float,2>{0.745173573f, 0.86014533f},
-std::array<float,2>{0.889686167f, 0.415020645f},
-std::array<float,2>{0.111413591f, 0.760657787f},
-std::array<float,2>{0.311953664f, 0.05032821f},
-std::array<float,2>{0.590015531f, 0.650224686f},
-std::array<float,2>{0.640473247f, 0.194304988f},
-std::array<float,2>{0.472827882f, 0.538166761f},
-std::array<float,2>{0.134544417f, 0.261003971f},
-std::array<float,2>{0.805719912f, 0.932928026f},
-std::array<float,2>{0.695484936f, 0.451513886f},
-std::array<float,2>{0.404459983f, 0.831144571f},
-std::array<float,2>{0.20678547f, 0.0733716488f},
-std::array<float,2>{0.845885813f, 0.735408843f},
-std::array<float,2>{0.964611411f, 0.181677282f},
-std::array<float,2>{0.00934303273f, 0.563578665f},
-std::array<float,2>{0.322901368f, 0.313361138f},
-std::array<float,2>{0.548975468f, 0.993176997f},
-std::array<float,2>{0.755166113f, 0.304586411f},
-std::array<float,2>{0.170528293f, 0.897519827f},
-std::array<float,2>{0.455634743f, 0.220243558f},
-std::array<float,2>{0.678830743f, 0.52585727f},
-std::array<float,2>{0.622849882f, 0.00912438519f},
-std::array<float,2>{0.266796798f, 0.660672903f},
-std::array<float,2>{0.0688738897f, 0.395594984f},
-std::array<float,2>{0.922214091f, 0.79156667f},
-std::array<float,2>{0.628019571f, 0.347605318f},
-std::array<float,2>{0.478198826f, 0.944967389f},
-std::array<float,2>{0.13061218f, 0.154979825f},
-std::array<float,2>{0.801704884f, 0.620503068f},
-std::array<float,2>{0.877460837f, 0.117658056f},
-std::array<float,2>{0.120592795f, 0.702744305f},
-std::array<float,2>{0.303174794f, 0.470748305f},
-std::array<float,2>{0.57990402f, 0.84672761f},
-std::array<float,2>{0.84127754f, 0.426104516f},
-std::array<float,2>{0.219414026f, 0.772902966f},
-std::array<float,2>{0.431379944f, 0.0312964842f},
-std::array<float,2>{0.738918602f, 0.63996315f},
-std::array<float,2>{0.509641171f, 0.214257032f},
-std::array<float,2>{0.371154636f, 0.547916591f},
-std::array<float,2>{0.0606677569f, 0.279667348f},
-std::array<float,2>{0.976968229f, 0.914506674f},
-std::array<float,2>{0.610642552f, 0.463392645f},
-std::array<float,2>{0.275763303f, 0.821113527f},
-std::array<float,2>{0.0776703283f, 0.0888798386f},
-std::array<float,2>{0.931466699f, 0.726372361f},
-std::array<float,2>{0.759361982f, 0.167324185f},
-std::array<float,2>{0.162773609f, 0.586738169f},
-std::array<float,2>{0.46779868f, 0.341897488f},
-std::array<float,2>{0.684863031f, 0.977769911f},
-std::array<float,2>{0.959151089f, 0.291531622f},
-std::array<float,2>{0.00608905684f, 0.886096537f},
-std::array<float,2>{0.315140724f, 0.246737316f},
-std::array<float,2>{0.555175006f, 0.512722254f},
-std::array<float,2>{0.688695431f, 0.0288588386f},
-std::array<float,2>{0.397999436f, 0.681851208f},
-std::array<float,2>{0.21380806f, 0.381300479f},
-std::array<float,2>{0.858945489f, 0.799989045f},
-std::array<float,2>{0.533537865f, 0.261847496f},
-std::array<float,2>{0.337582558f, 0.93500632f},
-std::array<float,2>{0.0301492158f, 0.187722504f},
-std::array<float,2>{0.944254279f, 0.532464504f},
-std::array<float,2>{0.870496035f, 0.0528385527f},
-std::array<float,2>{0.19314532f, 0.654395282f},
-std::array<float,2>{0.378241986f, 0.421832144f},
-std::array<float,2>{0.710073471f, 0.76527065f},
-std::array<float,2>{0.908275008f, 0.495254219f},
-std::array<float,2>{0.0883601084f, 0.864447653f},
-std::array<float,2>{0.254112214f, 0.104502492f},
-std::array<float,2>{0.597352982f, 0.710101545f},
-std::array<float,2>{0.663356483f, 0.130834788f},
-std::array<float,2>{0.441029996f, 0.601186693f},
-std::array<float,2>{0.180187777f, 0.366462678f},
-std::array<float,2>{0.775048435f, 0.953558087f},
-std::array<float,2>{0.731981575f, 0.392138481f},
-std::array<float,2>{0.4125036f, 0.796858609f},
-std::array<float,2>{0.235635221f, 0.0153204845f},
-std::array<float,2>{0.819502711f, 0.657978773f},
-std::array<float,2>{0.988916159f, 0.222844377f},
-std::array<float,2>{0.0361309387f, 0.530028522f},
-std::array<float,2>{0.347082227f, 0.299406677f},
-std::array<float,2>{0.529107928f, 0.892641485f},
-std::array<float,2>{0.794737518f, 0.31819886f},
-std::array<float,2>{0.141745165f, 0.996240377f},
-std::array<float,2>{0.485601574f, 0.186208457f},
-std::array<float,2>{0.645782232f, 0.568161547f},
-std::array<float,2>{0.573181629f, 0.0744390115f},
-std::array<float,2>{0.293163657f, 0.739498496f},
-std::array<float,2>{0.0985243469f, 0.447654635f},
-std::array<float,2>{0.897889733f, 0.832290828f},
-std::array<float,2>{0.718428493f, 0.309350252f},
-std::array<float,2>{0.387482613f, 0.904907823f},
-std::array<float,2>{0.197848335f, 0.227147967f},
-std::array<float,2>{0.859859765f, 0.519514203f},
-std::array<float,2>{0.947448015f, 0.00122561899f},
-std::array<float,2>{0.0178824849f, 0.669492424f},
-std::array<float,2>{0.329959482f, 0.4061459f},
-std::array<float,2>{0.539729118f, 0.787747025f},
-std::array<float,2>{0.771747351f, 0.443261147f},
-std::array<float,2>{0.173149005f, 0.838896334f},
-std::array<float,2>{0.451452821f, 0.0685839653f},
-std::array<float,2>{0.669906497f, 0.742859304f},
-std::array<float,2>{0.603476703f, 0.172042727f},
-std::array<float,2>{0.259794354f, 0.575836182f},
-std::array<float,2>{0.0812278986f, 0.325335145f},
-std::array<float,2>{0.917704999f, 0.984561145f},
-std::array<float,2>{0.518934488f, 0.408026874f},
-std::array<float,2>{0.356579363f, 0.751154304f},
-std::array<float,2>{0.0427399278f, 0.0572910607f},
-std::array<float,2>{0.992931366f, 0.645017087f},
-std::array<float,2>{0.823950827f, 0.2001573f},
-std::array<float,2>{0.246888936f, 0.542239249f},
-std::array<float,2>{0.417848885f, 0.256615877f},
-std::array<float,2>{0.724492908f, 0.927914977f},
-std::array<float,2>{0.900361538f, 0.371915698f},
-std::array<float,2>{0.103635944f, 0.964183986f},
-std::array<float,2>{0.286305666f, 0.133392766f},
-std::array<float,2>{0.563311636f, 0.60477525f},
-std::array<float,2>{0.65206033f, 0.0973651484f},
-std::array<float,2>{0.495520353f, 0.711076498f},
-std::array<float,2>{0.155575216f, 0.48854503f},
-std::array<float,2>{0.787879944f, 0.868022263f},
-std::array<float,2>{0.589609265f, 0.334000081f},
-std::array<float,2>{0.305728674f, 0.971282065f},
-std::array<float,2>{0.113986731f, 0.159575596f},
-std::array<float,2>{0.884024203f, 0.582073092f},
-std::array<float,2>{0.80918777f, 0.0786425844f},
-std::array<float,2>{0.138037294f, 0.728286684f},
-std::array<float,2>{0.469623208f, 0.458084136f},
-std::array<float,2>{0.634347975f, 0.815266073f},
-std::array<float,2>{0.974385202f, 0.389453202f},
-std::array<float,2>{0.0514162481f, 0.810432494f},
-std::array<float,2>{0.361518532f, 0.020917654f},
-std::array<float,2>{0.501601934f, 0.672764063f},
-std::array<float,2>{0.749308169f, 0.240071282f},
-std::array<float,2>{0.424116492f, 0.502873421f},
-std::array<float,2>{0.227817982f, 0.283493757f},
-std::array<float,2>{0.835736096f, 0.882697463f},
-std::array<float,2>{0.674670637f, 0.477514744f},
-std::array<float,2>{0.459278405f, 0.85933733f},
-std::array<float,2>{0.166451767f, 0.114322878f},
-std::array<float,2>{0.75030762f, 0.694981873f},
-std::array<float,2>{0.926395059f, 0.147874817f},
-std::array<float,2>{0.0644551814f, 0.616657615f},
-std::array<float,2>{0.271066487f, 0.354569614f},
-std::array<float,2>{0.619634151f, 0.949923038f},
-std::array<float,2>{0.848193586f, 0.270485044f},
-std::array<float,2>{0.20787631f, 0.911714971f},
-std::array<float,2>{0.401073515f, 0.205821142f},
-std::array<float,2>{0.700851381f, 0.556325078f},
-std::array<float,2>{0.554388404f, 0.0465509705f},
-std::array<float,2>{0.327817112f, 0.626874983f},
-std::array<float,2>{0.0128000602f, 0.433705509f},
-std::array<float,2>{0.968734443f, 0.777170181f},
-std::array<float,2>{0.693201363f, 0.369890243f},
-std::array<float,2>{0.394389421f, 0.966943204f},
-std::array<float,2>{0.21840845f, 0.139613181f},
-std::array<float,2>{0.851861f, 0.60602212f},
-std::array<float,2>{0.954320788f, 0.0988594815f},
-std::array<float,2>{0.00275199022f, 0.715955019f},
-std::array<float,2>{0.320157439f, 0.485447496f},
-std::array<float,2>{0.560734987f, 0.874213099f},
-std::array<float,2>{0.764481366f, 0.411719233f},
-std::array<float,2>{0.159200862f, 0.756353259f},
-std::array<float,2>{0.461364359f, 0.0614616238f},
-std::array<float,2>{0.683336258f, 0.641000509f},
-std::array<float,2>{0.616498291f, 0.195515752f},
-std::array<float,2>{0.281033188f, 0.545832396f},
-std::array<float,2>{0.070361048f, 0.253223896f},
-std::array<float,2>{0.936853409f, 0.923149407f},
-std::array<float,2>{0.514395952f, 0.440425247f},
-std::array<float,2>{0.367352545f, 0.83998239f},
-std::array<float,2>{0.0571093f, 0.0643945262f},
-std::array<float,2>{0.984346807f, 0.748184144f},
-std::array<float,2>{0.83878231f, 0.179493785f},
-std::array<float,2>{0.226207897f, 0.573528588f},
-std::array<float,2>{0.436435103f, 0.320656836f},
-std::array<float,2>{0.735224903f, 0.988657832f},
-std::array<float,2>{0.880204201f, 0.305740684f},
-std::array<float,2>{0.122611992f, 0.900600135f},
-std::array<float,2>{0.30003199f, 0.233836666f},
-std::array<float,2>{0.583667934f, 0.52165854f},
-std::array<float,2>{0.631374359f, 0.00417747628f},
-std::array<float,2>{0.484363914f, 0.665639818f},
-std::array<float,2>{0.127634332f, 0.400477499f},
-std::array<float,2>{0.798000872f, 0.784977973f},
-std::array<float,2>{0.574677587f, 0.26677686f},
-std::array<float,2>{0.289293647f, 0.909380794f},
-std::array<float,2>{0.0975509062f, 0.210623503f},
-std::array<float,2>{0.892849684f, 0.55896157f},
-std::array<float,2>{0.789855778f, 0.0427222401f},
-std::array<float,2>{0.147299334f, 0.631400585f},
-std::array<float,2>{0.489016205f, 0.431904703f},
-std::array<float,2>{0.641069293f, 0.7780357f},
-std::array<float,2>{0.987531364f, 0.48080349f},
-std::array<float,2>{0.0331013873f, 0.852458835f},
-std::array<float,2>{0.349936843f, 0.11296311f},
-std::array<float,2>{0.52528131f, 0.689131975f},
-std::array<float,2>{0.728544414f, 0.141770706f},
-std::array<float,2>{0.409075677f, 0.612964571f},
-std::array<float,2>{0.241489097f, 0.356105417f},
-std::array<float,2>{0.812889278f, 0.945530415f},
-std::array<float,2>{0.657395542f, 0.385450989f},
-std::array<float,2>{0.444907099f, 0.8062644f},
-std::array<float,2>{0.187208578f, 0.0188955497f},
-std::array<float,2>{0.778527021f, 0.676146269f},
-std::array<float,2>{0.912023842f, 0.234630659f},
-std::array<float,2>{0.0925449282f, 0.50772959f},
-std::array<float,2>{0.253656417f, 0.287898123f},
-std::array<float,2>{0.597910523f, 0.875903904f},
-std::array<float,2>{0.872260094f, 0.330588996f},
-std::array<float,2>{0.190519378f, 0.973040223f},
-std::array<float,2>{0.382176876f, 0.161222681f},
-std::array<float,2>{0.704965234f, 0.579442024f},
-std::array<float,2>{0.538727999f, 0.0839203447f},
-std::array<float,2>{0.342528969f, 0.734338462f},
-std::array<float,2>{0.0244060438f, 0.454118997f},
-std::array<float,2>{0.940116644f, 0.816880107f},
-std::array<float,2>{0.653347254f, 0.293806732f},
-std::array<float,2>{0.498900026f, 0.888967574f},
-std::array<float,2>{0.148984298f, 0.243962169f},
-std::array<float,2>{0.784581423f, 0.509199858f},
-std::array<float,2>{0.902766585f, 0.0258515477f},
-std::array<float,2>{0.107232571f, 0.684827387f},
-std::array<float,2>{0.282503694f, 0.376997977f},
-std::array<float,2>{0.568268716f, 0.803166509f},
-std::array<float,2>{0.827895343f, 0.465855211f},
-std::array<float,2>{0.243867174f, 0.826116145f},
-std::array<float,2>{0.418664783f, 0.0920275077f},
-std::array<float,2>{0.720808446f, 0.718762398f},
-std::array<float,2>{0.52005887f, 0.169237003f},
-std::array<float,2>{0.351808399f, 0.591821551f},
-std::array<float,2>{0.04664867f, 0.338701934f},
-std::array<float,2>{0.996244252f, 0.980509818f},
-std::array<float,2>{0.60752672f, 0.42249462f},
-std::array<float,2>{0.262914598f, 0.765656471f},
-std::array<float,2>{0.08515881f, 0.0361924469f},
-std::array<float,2>{0.920214832f, 0.633448184f},
-std::array<float,2>{0.769200265f, 0.218005478f},
-std::array<float,2>{0.176788613f, 0.552799463f},
-std::array<float,2>{0.445474356f, 0.275157183f},
-std::array<float,2>{0.665803969f, 0.9184286f},
-std::array<float,2>{0.950486839f, 0.348982751f},
-std::array<float,2>{0.0212605223f, 0.939729989f},
-std::array<float,2>{0.33548817f, 0.150458381f},
-std::array<float,2>{0.543542445f, 0.624144316f},
-std::array<float,2>{0.713733494f, 0.122317091f},
-std::array<float,2>{0.38467899f, 0.696960986f},
-std::array<float,2>{0.199582726f, 0.473038942f},
-std::array<float,2>{0.866615534f, 0.851190209f},
-std::array<float,2>{0.548574567f, 0.315435797f},
-std::array<float,2>{0.321220398f, 0.994413555f},
-std::array<float,2>{0.0103170462f, 0.180948228f},
-std::array<float,2>{0.962296367f, 0.565524876f},
-std::array<float,2>{0.844406784f, 0.0720867068f},
-std::array<float,2>{0.204702646f, 0.737119257f},
-std::array<float,2>{0.404007107f, 0.450850338f},
-std::array<float,2>{0.698515594f, 0.828747392f},
-std::array<float,2>{0.923890233f, 0.398311645f},
-std::array<float,2>{0.067333363f, 0.790116966f},
-std::array<float,2>{0.268687695f, 0.0102332029f},
-std::array<float,2>{0.623747885f, 0.66315192f},
-std::array<float,2>{0.677719057f, 0.222642735f},
-std::array<float,2>{0.455033809f, 0.523618996f},
-std::array<float,2>{0.168167815f, 0.301083863f},
-std::array<float,2>{0.756345809f, 0.895479739f},
-std::array<float,2>{0.742942333f, 0.498722196f},
-std::array<float,2>{0.425911695f, 0.862303138f},
-std::array<float,2>{0.233716875f, 0.107463837f},
-std::array<float,2>{0.832000732f, 0.705701828f},
-std::array<float,2>{0.972570896f, 0.12561579f},
-std::array<float,2>{0.0491758175f, 0.595886886f},
-std::array<float,2>{0.363670051f, 0.360763907f},
-std::array<float,2>{0.504644513f, 0.95886606f},
-std::array<float,2>{0.807082593f, 0.259362012f},
-std::array<float,2>{0.136594281f, 0.931575656f},
-std::array<float,2>{0.47655952f, 0.192002848f},
-std::array<float,2>{0.637262523f, 0.535575747f},
-std::array<float,2>{0.59328419f, 0.0485576764f},
-std::array<float,2>{0.309406042f, 0.650455475f},
-std::array<float,2>{0.11079409f, 0.416025639f},
-std::array<float,2>{0.887276947f, 0.758238196f},
-std::array<float,2>{0.687358201f, 0.34015137f},
-std::array<float,2>{0.465949953f, 0.979516804f},
-std::array<float,2>{0.160609052f, 0.164282918f},
-std::array<float,2>{0.761434853f, 0.589166522f},
-std::array<float,2>{0.93359369f, 0.0866602808f},
-std::array<float,2>{0.0752193555f, 0.724580824f},
-std::array<float,2>{0.274948776f, 0.461220711f},
-std::array<float,2>{0.612013996f, 0.82334584f},
-std::array<float,2>{0.856507123f, 0.379712492f},
-std::array<float,2>{0.212733999f, 0.797152936f},
-std::array<float,2>{0.395234048f, 0.0309495442f},
-std::array<float,2>{0.689846873f, 0.680390418f},
-std::array<float,2>{0.557495415f, 0.249030143f},
-std::array<float,2>{0.313479424f, 0.515035987f},
-std::array<float,2>{0.0056940564f, 0.290040851f},
-std::array<float,2>{0.957406104f, 0.883065164f},
-std::array<float,2>{0.580504477f, 0.469650984f},
-std::array<float,2>{0.301946193f, 0.844019115f},
-std::array<float,2>{0.118723191f, 0.11964725f},
-std::array<float,2>{0.876067936f, 0.70110929f},
-std::array<float,2>{0.803538799f, 0.152511016f},
-std::array<float,2>{0.13112092f, 0.617695868f},
-std::array<float,2>{0.480398059f, 0.34443754f},
-std::array<float,2>{0.626936376f, 0.942876875f},
-std::array<float,2>{0.979172409f, 0.277359813f},
-std::array<float,2>{0.0587632433f, 0.916932523f},
-std::array<float,2>{0.373885423f, 0.211089641f},
-std::array<float,2>{0.511432528f, 0.549352229f},
-std::array<float,2>{0.740521073f, 0.0341265537f},
-std::array<float,2>{0.433284789f, 0.637411475f},
-std::array<float,2>{0.222366944f, 0.42790398f},
-std::array<float,2>{0.843492031f, 0.770608783f},
-std::array<float,2>{0.53101933f, 0.298627198f},
-std::array<float,2>{0.343867421f, 0.892106354f},
-std::array<float,2>{0.0386036299f, 0.225917161f},
-std::array<float,2>{0.991636038f, 0.5286479f},
-std::array<float,2>{0.817708611f, 0.0130504109f},
-std::array<float,2>{0.237142906f, 0.65958339f},
-std::array<float,2>{0.411326438f, 0.394122839f},
-std::array<float,2>{0.733691692f, 0.794748068f},
-std::array<float,2>{0.895115018f, 0.446544826f},
-std::array<float,2>{0.100659244f, 0.834538043f},
-std::array<float,2>{0.296779543f, 0.0767110214f},
-std::array<float,2>{0.570885837f, 0.740570307f},
-std::array<float,2>{0.647024572f, 0.185446337f},
-std::array<float,2>{0.487240642f, 0.569483578f},
-std::array<float,2>{0.142711863f, 0.318382323f},
-std::array<float,2>{0.796748042f, 0.999846578f},
-std::array<float,2>{0.70792383f, 0.418897182f},
-std::array<float,2>{0.37641716f, 0.762444198f},
-std::array<float,2>{0.195224538f, 0.0521079339f},
-std::array<float,2>{0.867859662f, 0.652669549f},
-std::array<float,2>{0.942841172f, 0.189688578f},
-std::array<float,2>{0.0286866408f, 0.533831656f},
-std::array<float,2>{0.339089334f, 0.265506059f},
-std::array<float,2>{0.532725275f, 0.937269092f},
-std::array<float,2>{0.776572704f, 0.364409178f},
-std::array<float,2>{0.182137966f, 0.955466509f},
-std::array<float,2>{0.439081699f, 0.132558674f},
-std::array<float,2>{0.660202861f, 0.598532617f},
-std::array<float,2>{0.593998432f, 0.101702459f},
-std::array<float,2>{0.256742477f, 0.708881617f},
-std::array<float,2>{0.0862640738f, 0.492258102f},
-std::array<float,2>{0.907964408f, 0.86695081f},
-std::array<float,2>{0.725826979f, 0.255495697f},
-std::array<float,2>{0.41518572f, 0.925805748f},
-std::array<float,2>{0.249750212f, 0.201196775f},
-std::array<float,2>{0.821533501f, 0.539649725f},
-std::array<float,2>{0.994213283f, 0.0555640422f},
-std::array<float,2>{0.0395938233f, 0.646497071f},
-std::array<float,2>{0.358947277f, 0.408293277f},
-std::array<float,2>{0.516126871f, 0.752118468f},
-std::array<float,2>{0.785435855f, 0.491368562f},
-std::array<float,2>{0.153468117f, 0.870319963f},
-std::array<float,2>{0.493471414f, 0.0941498876f},
-std::array<float,2>{0.649021327f, 0.713946462f},
-std::array<float,2>{0.565669596f, 0.135409787f},
-std::array<float,2>{0.288589239f, 0.60293752f},
-std::array<float,2>{0.102921627f, 0.374869525f},
-std::array<float,2>{0.901676595f, 0.962132454f},
-std::array<float,2>{0.54144448f, 0.403719097f},
-std::array<float,2>{0.331936985f, 0.785649955f},
-std::array<float,2>{0.0159153417f, 0.0030295793f},
-std::array<float,2>{0.946785152f, 0.671774983f},
-std::array<float,2>{0.861695707f, 0.228539199f},
-std::array<float,2>{0.195407718f, 0.516056895f},
-std::array<float,2>{0.39040634f, 0.310578644f},
-std::array<float,2>{0.715336502f, 0.903458655f},
-std::array<float,2>{0.915825665f, 0.326588571f},
-std::array<float,2>{0.0793351457f, 0.986413121f},
-std::array<float,2>{0.259005189f, 0.174781546f},
-std::array<float,2>{0.603877068f, 0.576345205f},
-std::array<float,2>{0.67019403f, 0.0676786304f},
-std::array<float,2>{0.45023641f, 0.744140744f},
-std::array<float,2>{0.174285695f, 0.445304036f},
-std::array<float,2>{0.770129204f, 0.835949898f},
-std::array<float,2>{0.617727697f, 0.351813346f},
-std::array<float,2>{0.271750063f, 0.951841712f},
-std::array<float,2>{0.0637686551f, 0.144856319f},
-std::array<float,2>{0.929314673f, 0.613621056f},
-std::array<float,2>{0.752803266f, 0.115287125f},
-std::array<float,2>{0.165603116f, 0.691574752f},
-std::array<float,2>{0.458141595f, 0.479351193f},
-std::array<float,2>{0.672591567f, 0.85661763f},
-std::array<float,2>{0.965140879f, 0.437447697f},
-std::array<float,2>{0.0148973642f, 0.774284303f},
-std::array<float,2>{0.324539185f, 0.0437818207f},
-std::array<float,2>{0.551165462f, 0.628905475f},
-std::array<float,2>{0.702977657f, 0.203206629f},
-std::array<float,2>{0.399309099f, 0.556698263f},
-std::array<float,2>{0.210123867f, 0.272982836f},
-std::array<float,2>{0.850578487f, 0.913294733f},
-std::array<float,2>{0.635384679f, 0.460073918f},
-std::array<float,2>{0.470738858f, 0.81309849f},
-std::array<float,2>{0.140092611f, 0.0816685632f},
-std::array<float,2>{0.812188983f, 0.729480028f},
-std::array<float,2>{0.886101365f, 0.156632334f},
-std::array<float,2>{0.117160924f, 0.585718691f},
-std::array<float,2>{0.307611823f, 0.332956791f},
-std::array<float,2>{0.5869717f, 0.969428658f},
-std::array<float,2>{0.833508849f, 0.282431155f},
-std::array<float,2>{0.229182005f, 0.880666792f},
-std::array<float,2>{0.423604369f, 0.242045015f},
-std::array<float,2>{0.747162879f, 0.500413358f},
-std::array<float,2>{0.502549171f, 0.0220150873f},
-std::array<float,2>{0.360375583f, 0.67552495f},
-std::array<float,2>{0.0529991873f, 0.387945622f},
-std::array<float,2>{0.976272285f, 0.811496615f}}
\ No newline at end of file
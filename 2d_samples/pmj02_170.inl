@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.101527616f, 0.0734474882f},
-std::array<float,2>{0.784687936f, 0.678914309f},
-std::array<float,2>{0.479457974f, 0.928837776f},
-std::array<float,2>{0.729532599f, 0.461255223f},
-std::array<float,2>{0.25163728f, 0.269236267f},
-std::array<float,2>{0.53937459f, 0.785691857f},
-std::array<float,2>{0.17409493f, 0.527215302f},
-std::array<float,2>{0.903740406f, 0.181331471f},
-std::array<float,2>{0.432465196f, 0.219979078f},
-std::array<float,2>{0.666024923f, 0.573085129f},
-std::array<float,2>{0.0221280456f, 0.862917066f},
-std::array<float,2>{0.817552209f, 0.344970226f},
-std::array<float,2>{0.196479842f, 0.401611179f},
-std::array<float,2>{0.988235235f, 0.988870919f},
-std::array<float,2>{0.346202314f, 0.707271278f},
-std::array<float,2>{0.567456484f, 0.0223285146f},
-std::array<float,2>{0.13628979f, 0.154174671f},
-std::array<float,2>{0.920045972f, 0.544079781f},
-std::array<float,2>{0.306918979f, 0.757312834f},
-std::array<float,2>{0.526243985f, 0.289463073f},
-std::array<float,2>{0.460817814f, 0.488832891f},
-std::array<float,2>{0.68752861f, 0.880264401f},
-std::array<float,2>{0.070800297f, 0.628046095f},
-std::array<float,2>{0.777575612f, 0.118625857f},
-std::array<float,2>{0.339964002f, 0.0445936844f},
-std::array<float,2>{0.613941252f, 0.728670478f},
-std::array<float,2>{0.240118891f, 0.95812881f},
-std::array<float,2>{0.938357115f, 0.410344094f},
-std::array<float,2>{0.0366891734f, 0.325489938f},
-std::array<float,2>{0.866753578f, 0.819378912f},
-std::array<float,2>{0.383539438f, 0.608913362f},
-std::array<float,2>{0.63538605f, 0.198596478f},
-std::array<float,2>{0.219472885f, 0.0104238614f},
-std::array<float,2>{0.965459645f, 0.701770842f},
-std::array<float,2>{0.312937319f, 0.978042901f},
-std::array<float,2>{0.603134036f, 0.389143676f},
-std::array<float,2>{0.40297839f, 0.37210536f},
-std::array<float,2>{0.643360257f, 0.85471648f},
-std::array<float,2>{0.0508578159f, 0.587506354f},
-std::array<float,2>{0.856035113f, 0.246454984f},
-std::array<float,2>{0.29222855f, 0.16148521f},
-std::array<float,2>{0.505975425f, 0.504120827f},
-std::array<float,2>{0.149791658f, 0.80958885f},
-std::array<float,2>{0.927782059f, 0.254165947f},
-std::array<float,2>{0.0837193355f, 0.453057081f},
-std::array<float,2>{0.751699984f, 0.918948889f},
-std::array<float,2>{0.443431824f, 0.665529788f},
-std::array<float,2>{0.708572209f, 0.0875168592f},
-std::array<float,2>{0.0131111629f, 0.215489358f},
-std::array<float,2>{0.841768086f, 0.612922668f},
-std::array<float,2>{0.41888684f, 0.839378595f},
-std::array<float,2>{0.680409789f, 0.338973403f},
-std::array<float,2>{0.373152554f, 0.428411037f},
-std::array<float,2>{0.585684061f, 0.948339343f},
-std::array<float,2>{0.208022863f, 0.739605606f},
-std::array<float,2>{0.976765275f, 0.0548933111f},
-std::array<float,2>{0.484458923f, 0.101552263f},
-std::array<float,2>{0.741279542f, 0.642404497f},
-std::array<float,2>{0.12463776f, 0.904834211f},
-std::array<float,2>{0.811774552f, 0.483345807f},
-std::array<float,2>{0.160649866f, 0.308561981f},
-std::array<float,2>{0.881285727f, 0.775925636f},
-std::array<float,2>{0.279956996f, 0.561407149f},
-std::array<float,2>{0.55572176f, 0.12824513f},
-std::array<float,2>{0.0569490083f, 0.0498421453f},
-std::array<float,2>{0.84766829f, 0.747786164f},
-std::array<float,2>{0.393845707f, 0.94149828f},
-std::array<float,2>{0.65240556f, 0.434842438f},
-std::array<float,2>{0.32518819f, 0.331458122f},
-std::array<float,2>{0.595652342f, 0.831479371f},
-std::array<float,2>{0.233895436f, 0.61928612f},
-std::array<float,2>{0.95508647f, 0.207811385f},
-std::array<float,2>{0.450967252f, 0.138981685f},
-std::array<float,2>{0.718279183f, 0.547542095f},
-std::array<float,2>{0.0860878304f, 0.769683838f},
-std::array<float,2>{0.765389979f, 0.297417551f},
-std::array<float,2>{0.143520251f, 0.469034791f},
-std::array<float,2>{0.931933045f, 0.891844332f},
-std::array<float,2>{0.284238189f, 0.655315876f},
-std::array<float,2>{0.513352215f, 0.103267454f},
-std::array<float,2>{0.214518189f, 0.238665149f},
-std::array<float,2>{0.975236773f, 0.57906419f},
-std::array<float,2>{0.362221003f, 0.847443044f},
-std::array<float,2>{0.587548375f, 0.365211278f},
-std::array<float,2>{0.407221437f, 0.377231896f},
-std::array<float,2>{0.677886069f, 0.970205426f},
-std::array<float,2>{0.00700475043f, 0.691835046f},
-std::array<float,2>{0.830479562f, 0.00666801073f},
-std::array<float,2>{0.269530565f, 0.0797846988f},
-std::array<float,2>{0.54940474f, 0.661157489f},
-std::array<float,2>{0.166453525f, 0.907648087f},
-std::array<float,2>{0.882940292f, 0.439623237f},
-std::array<float,2>{0.116799437f, 0.260985881f},
-std::array<float,2>{0.803966463f, 0.798868537f},
-std::array<float,2>{0.497383952f, 0.510023117f},
-std::array<float,2>{0.748102367f, 0.170782134f},
-std::array<float,2>{0.185883343f, 0.115521885f},
-std::array<float,2>{0.893015504f, 0.639012575f},
-std::array<float,2>{0.259536535f, 0.886332572f},
-std::array<float,2>{0.538552165f, 0.494834989f},
-std::array<float,2>{0.470761448f, 0.282074392f},
-std::array<float,2>{0.719445705f, 0.759506464f},
-std::array<float,2>{0.102978148f, 0.538727641f},
-std::array<float,2>{0.796782792f, 0.146004677f},
-std::array<float,2>{0.356663376f, 0.191385984f},
-std::array<float,2>{0.572226167f, 0.599497914f},
-std::array<float,2>{0.191402927f, 0.827052176f},
-std::array<float,2>{0.998128116f, 0.317810595f},
-std::array<float,2>{0.0267090295f, 0.420681506f},
-std::array<float,2>{0.825308979f, 0.963469863f},
-std::array<float,2>{0.425480425f, 0.721335351f},
-std::array<float,2>{0.656600893f, 0.0382632911f},
-std::array<float,2>{0.0630337149f, 0.173892081f},
-std::array<float,2>{0.770570517f, 0.517191947f},
-std::array<float,2>{0.46475172f, 0.790138543f},
-std::array<float,2>{0.702499628f, 0.274548978f},
-std::array<float,2>{0.303035796f, 0.453728646f},
-std::array<float,2>{0.516070664f, 0.931571126f},
-std::array<float,2>{0.12919043f, 0.683661163f},
-std::array<float,2>{0.910764635f, 0.0686197132f},
-std::array<float,2>{0.382675916f, 0.0283986367f},
-std::array<float,2>{0.632374942f, 0.713663757f},
-std::array<float,2>{0.0446092896f, 0.999117672f},
-std::array<float,2>{0.874479949f, 0.391954452f},
-std::array<float,2>{0.248999596f, 0.352876037f},
-std::array<float,2>{0.951170504f, 0.874951243f},
-std::array<float,2>{0.329677999f, 0.56759268f},
-std::array<float,2>{0.617789686f, 0.230231106f},
-std::array<float,2>{0.089862369f, 0.016008351f},
-std::array<float,2>{0.758342206f, 0.706672609f},
-std::array<float,2>{0.446490943f, 0.985005796f},
-std::array<float,2>{0.71118629f, 0.404997498f},
-std::array<float,2>{0.287164003f, 0.351536781f},
-std::array<float,2>{0.507950306f, 0.865431905f},
-std::array<float,2>{0.145322755f, 0.577536106f},
-std::array<float,2>{0.937330484f, 0.222785458f},
-std::array<float,2>{0.396301895f, 0.184460551f},
-std::array<float,2>{0.64934516f, 0.529074728f},
-std::array<float,2>{0.0602679402f, 0.781455815f},
-std::array<float,2>{0.847267687f, 0.271642387f},
-std::array<float,2>{0.229146495f, 0.468236387f},
-std::array<float,2>{0.958519757f, 0.922356009f},
-std::array<float,2>{0.323104233f, 0.672741354f},
-std::array<float,2>{0.600214541f, 0.0775835812f},
-std::array<float,2>{0.170855477f, 0.199667737f},
-std::array<float,2>{0.890250623f, 0.602933228f},
-std::array<float,2>{0.271679789f, 0.81360513f},
-std::array<float,2>{0.551096916f, 0.323781848f},
-std::array<float,2>{0.493829608f, 0.408494562f},
-std::array<float,2>{0.744116127f, 0.954733491f},
-std::array<float,2>{0.111974068f, 0.733518422f},
-std::array<float,2>{0.797186613f, 0.041211158f},
-std::array<float,2>{0.366087466f, 0.12304537f},
-std::array<float,2>{0.592537284f, 0.630214274f},
-std::array<float,2>{0.21599102f, 0.876812518f},
-std::array<float,2>{0.972106278f, 0.488049448f},
-std::array<float,2>{0.00323098456f, 0.295044631f},
-std::array<float,2>{0.834351182f, 0.750759482f},
-std::array<float,2>{0.410286605f, 0.541895688f},
-std::array<float,2>{0.675553977f, 0.149640411f},
-std::array<float,2>{0.194868788f, 0.0919699967f},
-std::array<float,2>{0.993463218f, 0.67160821f},
-std::array<float,2>{0.353353262f, 0.91723758f},
-std::array<float,2>{0.575269222f, 0.446176022f},
-std::array<float,2>{0.427063227f, 0.250748873f},
-std::array<float,2>{0.660256684f, 0.806628585f},
-std::array<float,2>{0.0299585592f, 0.503336728f},
-std::array<float,2>{0.823434472f, 0.158339068f},
-std::array<float,2>{0.264355361f, 0.2459061f},
-std::array<float,2>{0.531776309f, 0.592130601f},
-std::array<float,2>{0.180165097f, 0.858490407f},
-std::array<float,2>{0.896803141f, 0.37012127f},
-std::array<float,2>{0.10672041f, 0.383084297f},
-std::array<float,2>{0.790085912f, 0.980829298f},
-std::array<float,2>{0.475521237f, 0.695563436f},
-std::array<float,2>{0.72612983f, 0.0149345919f},
-std::array<float,2>{0.0406576172f, 0.131256193f},
-std::array<float,2>{0.870456994f, 0.556403816f},
-std::array<float,2>{0.376032174f, 0.778896987f},
-std::array<float,2>{0.626447022f, 0.30960837f},
-std::array<float,2>{0.332409859f, 0.479568511f},
-std::array<float,2>{0.622549653f, 0.899612486f},
-std::array<float,2>{0.242789969f, 0.647118509f},
-std::array<float,2>{0.947016716f, 0.0965200737f},
-std::array<float,2>{0.466580123f, 0.0608227476f},
-std::array<float,2>{0.698212445f, 0.7348122f},
-std::array<float,2>{0.0688770339f, 0.94985193f},
-std::array<float,2>{0.768485069f, 0.425036818f},
-std::array<float,2>{0.128805161f, 0.341997951f},
-std::array<float,2>{0.909088373f, 0.840456069f},
-std::array<float,2>{0.298276037f, 0.615481377f},
-std::array<float,2>{0.523053586f, 0.213639319f},
-std::array<float,2>{0.0156896655f, 0.108463183f},
-std::array<float,2>{0.81348902f, 0.650356174f},
-std::array<float,2>{0.436958402f, 0.897736311f},
-std::array<float,2>{0.671153903f, 0.47594434f},
-std::array<float,2>{0.349887252f, 0.301052511f},
-std::array<float,2>{0.566003323f, 0.768036425f},
-std::array<float,2>{0.202709466f, 0.554111838f},
-std::array<float,2>{0.991945207f, 0.134008721f},
-std::array<float,2>{0.480810285f, 0.206986174f},
-std::array<float,2>{0.732698441f, 0.624553859f},
-std::array<float,2>{0.0962469205f, 0.833718479f},
-std::array<float,2>{0.788242698f, 0.332195103f},
-std::array<float,2>{0.178568318f, 0.4334867f},
-std::array<float,2>{0.900655687f, 0.939106464f},
-std::array<float,2>{0.254357159f, 0.745278478f},
-std::array<float,2>{0.543041766f, 0.0508714132f},
-std::array<float,2>{0.236404791f, 0.167169765f},
-std::array<float,2>{0.94354707f, 0.513209462f},
-std::array<float,2>{0.337547481f, 0.802280843f},
-std::array<float,2>{0.61130476f, 0.26204288f},
-std::array<float,2>{0.390383095f, 0.444818258f},
-std::array<float,2>{0.639084816f, 0.913984776f},
-std::array<float,2>{0.0317769498f, 0.656603277f},
-std::array<float,2>{0.861683846f, 0.0840826556f},
-std::array<float,2>{0.311340213f, 0.000196163222f},
-std::array<float,2>{0.530545592f, 0.689629734f},
-std::array<float,2>{0.139231876f, 0.976215839f},
-std::array<float,2>{0.915812612f, 0.382078171f},
-std::array<float,2>{0.0778885707f, 0.36081472f},
-std::array<float,2>{0.773557067f, 0.848959744f},
-std::array<float,2>{0.453171104f, 0.583595037f},
-std::array<float,2>{0.692050934f, 0.235154167f},
-std::array<float,2>{0.155020148f, 0.0348332636f},
-std::array<float,2>{0.925203025f, 0.723765314f},
-std::array<float,2>{0.294353426f, 0.966637313f},
-std::array<float,2>{0.502361655f, 0.415753543f},
-std::array<float,2>{0.438785821f, 0.313893586f},
-std::array<float,2>{0.70392704f, 0.82250315f},
-std::array<float,2>{0.0812056139f, 0.595581472f},
-std::array<float,2>{0.757358015f, 0.195029706f},
-std::array<float,2>{0.319914669f, 0.141092792f},
-std::array<float,2>{0.609228015f, 0.535001159f},
-std::array<float,2>{0.226321876f, 0.764643788f},
-std::array<float,2>{0.962023437f, 0.286917597f},
-std::array<float,2>{0.04934185f, 0.496408045f},
-std::array<float,2>{0.851841033f, 0.88936311f},
-std::array<float,2>{0.398651183f, 0.634174287f},
-std::array<float,2>{0.645223498f, 0.11038547f},
-std::array<float,2>{0.118631445f, 0.233602539f},
-std::array<float,2>{0.805532277f, 0.564447641f},
-std::array<float,2>{0.489549428f, 0.870396614f},
-std::array<float,2>{0.735267043f, 0.357512593f},
-std::array<float,2>{0.273684204f, 0.39830783f},
-std::array<float,2>{0.55967468f, 0.994078219f},
-std::array<float,2>{0.157043651f, 0.718181074f},
-std::array<float,2>{0.876657009f, 0.0261384565f},
-std::array<float,2>{0.414981872f, 0.0653365925f},
-std::array<float,2>{0.687080443f, 0.683168471f},
-std::array<float,2>{0.00988976751f, 0.936608613f},
-std::array<float,2>{0.837574065f, 0.459712446f},
-std::array<float,2>{0.206785992f, 0.277590126f},
-std::array<float,2>{0.98269397f, 0.795218349f},
-std::array<float,2>{0.369551033f, 0.522906542f},
-std::array<float,2>{0.580174863f, 0.17679821f},
-std::array<float,2>{0.0728326589f, 0.119827345f},
-std::array<float,2>{0.779526234f, 0.625638962f},
-std::array<float,2>{0.457493693f, 0.882810891f},
-std::array<float,2>{0.690446317f, 0.490910172f},
-std::array<float,2>{0.306410164f, 0.29264459f},
-std::array<float,2>{0.524663985f, 0.755574346f},
-std::array<float,2>{0.134274349f, 0.545111358f},
-std::array<float,2>{0.919701815f, 0.154457331f},
-std::array<float,2>{0.385663688f, 0.197135478f},
-std::array<float,2>{0.634160578f, 0.60599345f},
-std::array<float,2>{0.0388226062f, 0.817217886f},
-std::array<float,2>{0.865061164f, 0.327986896f},
-std::array<float,2>{0.242068633f, 0.412228763f},
-std::array<float,2>{0.939789057f, 0.959410191f},
-std::array<float,2>{0.342152804f, 0.728342533f},
-std::array<float,2>{0.615383446f, 0.0458068699f},
-std::array<float,2>{0.173391134f, 0.182904184f},
-std::array<float,2>{0.904634655f, 0.524431705f},
-std::array<float,2>{0.251986623f, 0.788790226f},
-std::array<float,2>{0.542618692f, 0.266447514f},
-std::array<float,2>{0.476882279f, 0.463879853f},
-std::array<float,2>{0.72796905f, 0.92622745f},
-std::array<float,2>{0.0990133807f, 0.676670253f},
-std::array<float,2>{0.781494439f, 0.0718430355f},
-std::array<float,2>{0.343924254f, 0.0211015958f},
-std::array<float,2>{0.569237947f, 0.710184336f},
-std::array<float,2>{0.198716536f, 0.99158597f},
-std::array<float,2>{0.984835863f, 0.399755746f},
-std::array<float,2>{0.0198796652f, 0.347287357f},
-std::array<float,2>{0.819268823f, 0.859569132f},
-std::array<float,2>{0.43067047f, 0.57102865f},
-std::array<float,2>{0.665592134f, 0.220993087f},
-std::array<float,2>{0.208990902f, 0.0569315925f},
-std::array<float,2>{0.980188191f, 0.742000222f},
-std::array<float,2>{0.3720676f, 0.945834994f},
-std::array<float,2>{0.582796037f, 0.427147299f},
-std::array<float,2>{0.421685904f, 0.337328851f},
-std::array<float,2>{0.681829631f, 0.836416721f},
-std::array<float,2>{0.0146358302f, 0.610210955f},
-std::array<float,2>{0.84242171f, 0.217654839f},
-std::array<float,2>{0.277913243f, 0.126372874f},
-std::array<float,2>{0.558114588f, 0.559274495f},
-std::array<float,2>{0.163445532f, 0.775050521f},
-std::array<float,2>{0.879119098f, 0.30558604f},
-std::array<float,2>{0.122040942f, 0.481728584f},
-std::array<float,2>{0.809125185f, 0.903346896f},
-std::array<float,2>{0.486556083f, 0.643781662f},
-std::array<float,2>{0.739572287f, 0.0981651768f},
-std::array<float,2>{0.0543341078f, 0.248405918f},
-std::array<float,2>{0.858480871f, 0.58915019f},
-std::array<float,2>{0.405448377f, 0.853297055f},
-std::array<float,2>{0.640914738f, 0.373616189f},
-std::array<float,2>{0.316205382f, 0.387706667f},
-std::array<float,2>{0.603641391f, 0.979780734f},
-std::array<float,2>{0.222405329f, 0.701125741f},
-std::array<float,2>{0.966903031f, 0.00825565122f},
-std::array<float,2>{0.442490011f, 0.089333497f},
-std::array<float,2>{0.710483134f, 0.667747974f},
-std::array<float,2>{0.0858775377f, 0.921593189f},
-std::array<float,2>{0.751966178f, 0.44995749f},
-std::array<float,2>{0.151087925f, 0.256043643f},
-std::array<float,2>{0.926404417f, 0.812381446f},
-std::array<float,2>{0.28983891f, 0.50639832f},
-std::array<float,2>{0.505475521f, 0.162249163f},
-std::array<float,2>{0.00449205749f, 0.00574839208f},
-std::array<float,2>{0.82818085f, 0.694095016f},
-std::array<float,2>{0.409955472f, 0.972630858f},
-std::array<float,2>{0.676676333f, 0.376323342f},
-std::array<float,2>{0.359776378f, 0.3664684f},
-std::array<float,2>{0.589283109f, 0.845253527f},
-std::array<float,2>{0.211532533f, 0.581233442f},
-std::array<float,2>{0.974058986f, 0.24153468f},
-std::array<float,2>{0.498217523f, 0.169007733f},
-std::array<float,2>{0.74648279f, 0.509365857f},
-std::array<float,2>{0.113370627f, 0.798321128f},
-std::array<float,2>{0.80175364f, 0.259509474f},
-std::array<float,2>{0.165935606f, 0.438273251f},
-std::array<float,2>{0.885119021f, 0.908832312f},
-std::array<float,2>{0.26625666f, 0.664046943f},
-std::array<float,2>{0.547419608f, 0.0818726271f},
-std::array<float,2>{0.23117435f, 0.209445029f},
-std::array<float,2>{0.954175413f, 0.617670834f},
-std::array<float,2>{0.327521533f, 0.829242527f},
-std::array<float,2>{0.596938968f, 0.329814732f},
-std::array<float,2>{0.39200449f, 0.436892241f},
-std::array<float,2>{0.654719949f, 0.943858504f},
-std::array<float,2>{0.0549524389f, 0.749205649f},
-std::array<float,2>{0.850964963f, 0.0486839935f},
-std::array<float,2>{0.282632649f, 0.103644662f},
-std::array<float,2>{0.515171587f, 0.653753519f},
-std::array<float,2>{0.141847089f, 0.89411062f},
-std::array<float,2>{0.930136859f, 0.471899986f},
-std::array<float,2>{0.0894396678f, 0.298942596f},
-std::array<float,2>{0.7628057f, 0.772431076f},
-std::array<float,2>{0.452025115f, 0.55002141f},
-std::array<float,2>{0.716341078f, 0.137335107f},
-std::array<float,2>{0.131542087f, 0.0676034912f},
-std::array<float,2>{0.913477004f, 0.687318265f},
-std::array<float,2>{0.302234173f, 0.93204999f},
-std::array<float,2>{0.518468797f, 0.456119359f},
-std::array<float,2>{0.461252272f, 0.27679041f},
-std::array<float,2>{0.700877309f, 0.792342901f},
-std::array<float,2>{0.0659006312f, 0.519328713f},
-std::array<float,2>{0.771607578f, 0.172493666f},
-std::array<float,2>{0.331218362f, 0.228193045f},
-std::array<float,2>{0.619861245f, 0.570227802f},
-std::array<float,2>{0.247377366f, 0.871684134f},
-std::array<float,2>{0.952107489f, 0.354647875f},
-std::array<float,2>{0.0454361215f, 0.393216252f},
-std::array<float,2>{0.872107983f, 0.996463001f},
-std::array<float,2>{0.379475564f, 0.712180972f},
-std::array<float,2>{0.630449176f, 0.0295982901f},
-std::array<float,2>{0.103923708f, 0.147640288f},
-std::array<float,2>{0.793718219f, 0.536444604f},
-std::array<float,2>{0.469354033f, 0.760728002f},
-std::array<float,2>{0.720808446f, 0.284482002f},
-std::array<float,2>{0.261446118f, 0.493654639f},
-std::array<float,2>{0.536198616f, 0.883022964f},
-std::array<float,2>{0.185130194f, 0.638008416f},
-std::array<float,2>{0.892028451f, 0.113776892f},
-std::array<float,2>{0.423690856f, 0.0357103497f},
-std::array<float,2>{0.659938097f, 0.720397472f},
-std::array<float,2>{0.0243971143f, 0.960985661f},
-std::array<float,2>{0.828063488f, 0.418434173f},
-std::array<float,2>{0.188981846f, 0.320097148f},
-std::array<float,2>{0.996203721f, 0.825711071f},
-std::array<float,2>{0.358743906f, 0.600352168f},
-std::array<float,2>{0.574126661f, 0.189243376f},
-std::array<float,2>{0.110060573f, 0.0405611731f},
-std::array<float,2>{0.80052495f, 0.731210887f},
-std::array<float,2>{0.495650053f, 0.955290079f},
-std::array<float,2>{0.7456339f, 0.407434314f},
-std::array<float,2>{0.270582676f, 0.32144925f},
-std::array<float,2>{0.552909434f, 0.81631428f},
-std::array<float,2>{0.169069186f, 0.60447073f},
-std::array<float,2>{0.887928665f, 0.201796681f},
-std::array<float,2>{0.412162423f, 0.151007801f},
-std::array<float,2>{0.672923744f, 0.540616453f},
-std::array<float,2>{2.44625207e-05f, 0.752210259f},
-std::array<float,2>{0.832724094f, 0.29462111f},
-std::array<float,2>{0.217383742f, 0.484523207f},
-std::array<float,2>{0.9702788f, 0.877146125f},
-std::array<float,2>{0.364127308f, 0.631195426f},
-std::array<float,2>{0.590064049f, 0.124635078f},
-std::array<float,2>{0.146866605f, 0.226526603f},
-std::array<float,2>{0.933724821f, 0.575318336f},
-std::array<float,2>{0.286294848f, 0.863434792f},
-std::array<float,2>{0.511181176f, 0.348366857f},
-std::array<float,2>{0.44773519f, 0.402377874f},
-std::array<float,2>{0.71374613f, 0.98823595f},
-std::array<float,2>{0.0935522392f, 0.704387844f},
-std::array<float,2>{0.760244906f, 0.0184544232f},
-std::array<float,2>{0.320573032f, 0.07500007f},
-std::array<float,2>{0.597866535f, 0.674408853f},
-std::array<float,2>{0.227866158f, 0.924000025f},
-std::array<float,2>{0.959982097f, 0.465628803f},
-std::array<float,2>{0.060768012f, 0.270556331f},
-std::array<float,2>{0.84558332f, 0.784736216f},
-std::array<float,2>{0.397458494f, 0.531068087f},
-std::array<float,2>{0.651934624f, 0.186350688f},
-std::array<float,2>{0.245449841f, 0.094216153f},
-std::array<float,2>{0.948567986f, 0.644976556f},
-std::array<float,2>{0.335814446f, 0.900472283f},
-std::array<float,2>{0.623672307f, 0.477991492f},
-std::array<float,2>{0.378197253f, 0.310975075f},
-std::array<float,2>{0.628485203f, 0.77947253f},
-std::array<float,2>{0.0412718654f, 0.558072448f},
-std::array<float,2>{0.867954969f, 0.130184561f},
-std::array<float,2>{0.299321711f, 0.211727321f},
-std::array<float,2>{0.520606339f, 0.614657044f},
-std::array<float,2>{0.126257211f, 0.843297124f},
-std::array<float,2>{0.906931996f, 0.341682911f},
-std::array<float,2>{0.0674299374f, 0.423561454f},
-std::array<float,2>{0.766572058f, 0.952142894f},
-std::array<float,2>{0.466937393f, 0.737149537f},
-std::array<float,2>{0.696133792f, 0.0592219457f},
-std::array<float,2>{0.0276913904f, 0.156857818f},
-std::array<float,2>{0.821887016f, 0.501941323f},
-std::array<float,2>{0.428506553f, 0.807395697f},
-std::array<float,2>{0.663679361f, 0.252175063f},
-std::array<float,2>{0.354119837f, 0.448043227f},
-std::array<float,2>{0.578010321f, 0.915639937f},
-std::array<float,2>{0.192080647f, 0.66946137f},
-std::array<float,2>{0.994851232f, 0.0910191387f},
-std::array<float,2>{0.473145455f, 0.0131742246f},
-std::array<float,2>{0.723817468f, 0.697567642f},
-std::array<float,2>{0.109317809f, 0.983737051f},
-std::array<float,2>{0.792669415f, 0.386661261f},
-std::array<float,2>{0.181949675f, 0.367243618f},
-std::array<float,2>{0.895268321f, 0.856441855f},
-std::array<float,2>{0.263191074f, 0.589999676f},
-std::array<float,2>{0.533861339f, 0.243584231f},
-std::array<float,2>{0.0345797576f, 0.0826626718f},
-std::array<float,2>{0.860408068f, 0.658381701f},
-std::array<float,2>{0.387099892f, 0.912059128f},
-std::array<float,2>{0.637662768f, 0.441616744f},
-std::array<float,2>{0.339441448f, 0.264249206f},
-std::array<float,2>{0.611990035f, 0.803562224f},
-std::array<float,2>{0.235587761f, 0.515356302f},
-std::array<float,2>{0.942012548f, 0.164942861f},
-std::array<float,2>{0.456789792f, 0.237232894f},
-std::array<float,2>{0.694996774f, 0.584620178f},
-std::array<float,2>{0.0759217963f, 0.849692464f},
-std::array<float,2>{0.776685476f, 0.362977833f},
-std::array<float,2>{0.137573659f, 0.380441517f},
-std::array<float,2>{0.917645037f, 0.973048508f},
-std::array<float,2>{0.309567243f, 0.688040316f},
-std::array<float,2>{0.529247761f, 0.00208896189f},
-std::array<float,2>{0.199819461f, 0.134890482f},
-std::array<float,2>{0.988888323f, 0.551072657f},
-std::array<float,2>{0.348597467f, 0.765663326f},
-std::array<float,2>{0.563015521f, 0.303021222f},
-std::array<float,2>{0.434596539f, 0.474053353f},
-std::array<float,2>{0.669653594f, 0.894928515f},
-std::array<float,2>{0.019143872f, 0.652181685f},
-std::array<float,2>{0.816213608f, 0.106960513f},
-std::array<float,2>{0.256448478f, 0.0529065765f},
-std::array<float,2>{0.545277417f, 0.742887437f},
-std::array<float,2>{0.176082239f, 0.940303802f},
-std::array<float,2>{0.898579836f, 0.429836422f},
-std::array<float,2>{0.0939148366f, 0.335089117f},
-std::array<float,2>{0.786104023f, 0.835703552f},
-std::array<float,2>{0.483985573f, 0.621564448f},
-std::array<float,2>{0.732322931f, 0.204289079f},
-std::array<float,2>{0.159466535f, 0.0244197194f},
-std::array<float,2>{0.877944529f, 0.715281725f},
-std::array<float,2>{0.275559545f, 0.995993435f},
-std::array<float,2>{0.561712563f, 0.394886851f},
-std::array<float,2>{0.490467787f, 0.35624367f},
-std::array<float,2>{0.738249898f, 0.868227601f},
-std::array<float,2>{0.119572066f, 0.565563619f},
-std::array<float,2>{0.807421565f, 0.232218161f},
-std::array<float,2>{0.368098676f, 0.179364651f},
-std::array<float,2>{0.579527915f, 0.521159828f},
-std::array<float,2>{0.204438031f, 0.794136882f},
-std::array<float,2>{0.981464505f, 0.280905783f},
-std::array<float,2>{0.008283576f, 0.457138866f},
-std::array<float,2>{0.838252485f, 0.933850527f},
-std::array<float,2>{0.416947424f, 0.680423796f},
-std::array<float,2>{0.685075879f, 0.0627765134f},
-std::array<float,2>{0.0794278383f, 0.192464381f},
-std::array<float,2>{0.755150378f, 0.597202957f},
-std::array<float,2>{0.440860748f, 0.820526421f},
-std::array<float,2>{0.706768095f, 0.314519584f},
-std::array<float,2>{0.29619053f, 0.416153997f},
-std::array<float,2>{0.50101006f, 0.967031896f},
-std::array<float,2>{0.154156417f, 0.724721074f},
-std::array<float,2>{0.922936618f, 0.0317541137f},
-std::array<float,2>{0.401747823f, 0.111387692f},
-std::array<float,2>{0.648199618f, 0.635321677f},
-std::array<float,2>{0.0477426797f, 0.887131453f},
-std::array<float,2>{0.854729652f, 0.499607176f},
-std::array<float,2>{0.223966867f, 0.287607819f},
-std::array<float,2>{0.964090705f, 0.761898339f},
-std::array<float,2>{0.316473544f, 0.531989098f},
-std::array<float,2>{0.607113421f, 0.143586323f},
-std::array<float,2>{0.0846856833f, 0.0866003782f},
-std::array<float,2>{0.753764033f, 0.664661884f},
-std::array<float,2>{0.441652387f, 0.918710172f},
-std::array<float,2>{0.709135532f, 0.451582372f},
-std::array<float,2>{0.290561348f, 0.255147725f},
-std::array<float,2>{0.504689932f, 0.809224427f},
-std::array<float,2>{0.151975125f, 0.505742908f},
-std::array<float,2>{0.926832438f, 0.160704657f},
-std::array<float,2>{0.404491156f, 0.247258201f},
-std::array<float,2>{0.642547011f, 0.58616662f},
-std::array<float,2>{0.0528780669f, 0.854255795f},
-std::array<float,2>{0.857451797f, 0.371503502f},
-std::array<float,2>{0.221008033f, 0.390429527f},
-std::array<float,2>{0.967964947f, 0.976717472f},
-std::array<float,2>{0.314748526f, 0.702370822f},
-std::array<float,2>{0.605407774f, 0.0108365994f},
-std::array<float,2>{0.163034514f, 0.127546594f},
-std::array<float,2>{0.880389035f, 0.561628461f},
-std::array<float,2>{0.278338522f, 0.776578009f},
-std::array<float,2>{0.556884766f, 0.307225406f},
-std::array<float,2>{0.487423241f, 0.483904153f},
-std::array<float,2>{0.738558173f, 0.905563354f},
-std::array<float,2>{0.122616529f, 0.641040444f},
-std::array<float,2>{0.809871078f, 0.0996198356f},
-std::array<float,2>{0.372655362f, 0.0561084449f},
-std::array<float,2>{0.583775222f, 0.738579094f},
-std::array<float,2>{0.210873127f, 0.947530389f},
-std::array<float,2>{0.979263961f, 0.42891857f},
-std::array<float,2>{0.0148384348f, 0.338460416f},
-std::array<float,2>{0.84330225f, 0.837915599f},
-std::array<float,2>{0.420791954f, 0.61159569f},
-std::array<float,2>{0.683266759f, 0.216749147f},
-std::array<float,2>{0.198130846f, 0.0232212581f},
-std::array<float,2>{0.985779822f, 0.70878756f},
-std::array<float,2>{0.345362753f, 0.990115881f},
-std::array<float,2>{0.570233822f, 0.400713444f},
-std::array<float,2>{0.430547029f, 0.344001085f},
-std::array<float,2>{0.664476991f, 0.862262487f},
-std::array<float,2>{0.0214470569f, 0.573705792f},
-std::array<float,2>{0.820293486f, 0.219598368f},
-std::array<float,2>{0.253053486f, 0.179843679f},
-std::array<float,2>{0.541816771f, 0.525957048f},
-std::array<float,2>{0.172813505f, 0.786594927f},
-std::array<float,2>{0.906051755f, 0.268374056f},
-std::array<float,2>{0.0976746008f, 0.462662071f},
-std::array<float,2>{0.78277117f, 0.928109348f},
-std::array<float,2>{0.478481919f, 0.67833364f},
-std::array<float,2>{0.726895928f, 0.0725374594f},
-std::array<float,2>{0.0372269936f, 0.198176891f},
-std::array<float,2>{0.863751769f, 0.608033478f},
-std::array<float,2>{0.386593759f, 0.819192469f},
-std::array<float,2>{0.633381486f, 0.324437767f},
-std::array<float,2>{0.343562394f, 0.412000537f},
-std::array<float,2>{0.616741419f, 0.957916319f},
-std::array<float,2>{0.240886077f, 0.729628205f},
-std::array<float,2>{0.941244304f, 0.0436504185f},
-std::array<float,2>{0.458425611f, 0.118063085f},
-std::array<float,2>{0.689893007f, 0.627517402f},
-std::array<float,2>{0.0736591145f, 0.879758179f},
-std::array<float,2>{0.780616581f, 0.489544839f},
-std::array<float,2>{0.132874012f, 0.290422082f},
-std::array<float,2>{0.918858945f, 0.756510019f},
-std::array<float,2>{0.305435628f, 0.543571532f},
-std::array<float,2>{0.524404705f, 0.152980819f},
-std::array<float,2>{0.0247256197f, 0.0374739841f},
-std::array<float,2>{0.8268767f, 0.722650111f},
-std::array<float,2>{0.421895981f, 0.964630663f},
-std::array<float,2>{0.658567369f, 0.421404928f},
-std::array<float,2>{0.358360261f, 0.317064166f},
-std::array<float,2>{0.572897732f, 0.827918768f},
-std::array<float,2>{0.188246906f, 0.598289728f},
-std::array<float,2>{0.997859001f, 0.189892456f},
-std::array<float,2>{0.469747096f, 0.145426303f},
-std::array<float,2>{0.722560048f, 0.538009703f},
-std::array<float,2>{0.105264962f, 0.758331537f},
-std::array<float,2>{0.794200778f, 0.282806814f},
-std::array<float,2>{0.184140459f, 0.495290667f},
-std::array<float,2>{0.891422153f, 0.884795606f},
-std::array<float,2>{0.260554284f, 0.640061319f},
-std::array<float,2>{0.535824299f, 0.116917461f},
-std::array<float,2>{0.246630743f, 0.229186356f},
-std::array<float,2>{0.952961147f, 0.567191839f},
-std::array<float,2>{0.330356091f, 0.873848736f},
-std::array<float,2>{0.620607793f, 0.352117866f},
-std::array<float,2>{0.380582511f, 0.390776366f},
-std::array<float,2>{0.629248798f, 0.998180151f},
-std::array<float,2>{0.0468362421f, 0.714707792f},
-std::array<float,2>{0.871448576f, 0.0278062839f},
-std::array<float,2>{0.301338106f, 0.0700445697f},
-std::array<float,2>{0.519235909f, 0.68477124f},
-std::array<float,2>{0.132273659f, 0.930278838f},
-std::array<float,2>{0.912252605f, 0.454218626f},
-std::array<float,2>{0.0647475049f, 0.27435267f},
-std::array<float,2>{0.773038745f, 0.789546132f},
-std::array<float,2>{0.46243459f, 0.516049683f},
-std::array<float,2>{0.700097144f, 0.174965024f},
-std::array<float,2>{0.140726134f, 0.102009743f},
-std::array<float,2>{0.930955768f, 0.654317379f},
-std::array<float,2>{0.281291544f, 0.890777469f},
-std::array<float,2>{0.514118671f, 0.470582724f},
-std::array<float,2>{0.452858686f, 0.298318356f},
-std::array<float,2>{0.715772092f, 0.770685673f},
-std::array<float,2>{0.088128224f, 0.548578084f},
-std::array<float,2>{0.762243032f, 0.140054852f},
-std::array<float,2>{0.326254427f, 0.208800882f},
-std::array<float,2>{0.596614718f, 0.6206128f},
-std::array<float,2>{0.231959909f, 0.830836058f},
-std::array<float,2>{0.953594744f, 0.330652654f},
-std::array<float,2>{0.0558243357f, 0.434102625f},
-std::array<float,2>{0.849910915f, 0.942885876f},
-std::array<float,2>{0.390662313f, 0.746609807f},
-std::array<float,2>{0.655320525f, 0.0497443564f},
-std::array<float,2>{0.114915945f, 0.171215922f},
-std::array<float,2>{0.802427173f, 0.511043668f},
-std::array<float,2>{0.499355197f, 0.799858212f},
-std::array<float,2>{0.747907102f, 0.260653079f},
-std::array<float,2>{0.266671389f, 0.440741986f},
-std::array<float,2>{0.547888517f, 0.906906724f},
-std::array<float,2>{0.164382994f, 0.660718918f},
-std::array<float,2>{0.886229515f, 0.0784377754f},
-std::array<float,2>{0.408821821f, 0.00696811359f},
-std::array<float,2>{0.677215338f, 0.693334579f},
-std::array<float,2>{0.00558496173f, 0.969373643f},
-std::array<float,2>{0.829991162f, 0.378572941f},
-std::array<float,2>{0.212586641f, 0.363475621f},
-std::array<float,2>{0.973365307f, 0.845866084f},
-std::array<float,2>{0.360514075f, 0.579321027f},
-std::array<float,2>{0.587901115f, 0.240157485f},
-std::array<float,2>{0.107799836f, 0.0146090407f},
-std::array<float,2>{0.79128021f, 0.69688797f},
-std::array<float,2>{0.474447191f, 0.981928289f},
-std::array<float,2>{0.723307669f, 0.384192199f},
-std::array<float,2>{0.262292325f, 0.369514763f},
-std::array<float,2>{0.534881532f, 0.857623279f},
-std::array<float,2>{0.182751656f, 0.593710482f},
-std::array<float,2>{0.896170735f, 0.245114073f},
-std::array<float,2>{0.42922318f, 0.159409672f},
-std::array<float,2>{0.662572622f, 0.50238502f},
-std::array<float,2>{0.0285076033f, 0.805644333f},
-std::array<float,2>{0.821232319f, 0.251110584f},
-std::array<float,2>{0.192925289f, 0.447254956f},
-std::array<float,2>{0.995830595f, 0.91659838f},
-std::array<float,2>{0.354935884f, 0.669939101f},
-std::array<float,2>{0.577022076f, 0.0932350978f},
-std::array<float,2>{0.125459135f, 0.213917181f},
-std::array<float,2>{0.907647073f, 0.616749942f},
-std::array<float,2>{0.300053656f, 0.841246963f},
-std::array<float,2>{0.520441234f, 0.343631715f},
-std::array<float,2>{0.467799187f, 0.424290985f},
-std::array<float,2>{0.696682811f, 0.95061934f},
-std::array<float,2>{0.0668776929f, 0.735640824f},
-std::array<float,2>{0.766958714f, 0.0621301197f},
-std::array<float,2>{0.334186912f, 0.0972628072f},
-std::array<float,2>{0.624553144f, 0.648279667f},
-std::array<float,2>{0.244436979f, 0.899193048f},
-std::array<float,2>{0.948158026f, 0.478566766f},
-std::array<float,2>{0.0428046249f, 0.309412628f},
-std::array<float,2>{0.868568897f, 0.777901947f},
-std::array<float,2>{0.377763629f, 0.55552417f},
-std::array<float,2>{0.627026379f, 0.131867766f},
-std::array<float,2>{0.226881325f, 0.0766939968f},
-std::array<float,2>{0.959597349f, 0.673698246f},
-std::array<float,2>{0.321335971f, 0.922928452f},
-std::array<float,2>{0.598658919f, 0.46748665f},
-std::array<float,2>{0.398257136f, 0.272956401f},
-std::array<float,2>{0.650465608f, 0.782627821f},
-std::array<float,2>{0.0616072379f, 0.527737141f},
-std::array<float,2>{0.844214916f, 0.184607595f},
-std::array<float,2>{0.285671651f, 0.223782256f},
-std::array<float,2>{0.510061741f, 0.577147067f},
-std::array<float,2>{0.148387611f, 0.866783261f},
-std::array<float,2>{0.934712112f, 0.350439727f},
-std::array<float,2>{0.0918791592f, 0.405828655f},
-std::array<float,2>{0.761037171f, 0.985755026f},
-std::array<float,2>{0.44826448f, 0.705555379f},
-std::array<float,2>{0.714177072f, 0.0170124434f},
-std::array<float,2>{0.00193470623f, 0.148720741f},
-std::array<float,2>{0.833655775f, 0.542165101f},
-std::array<float,2>{0.413268745f, 0.751547217f},
-std::array<float,2>{0.672830284f, 0.296701342f},
-std::array<float,2>{0.364429176f, 0.487181872f},
-std::array<float,2>{0.590955973f, 0.875588834f},
-std::array<float,2>{0.217829004f, 0.629817963f},
-std::array<float,2>{0.96962738f, 0.121105075f},
-std::array<float,2>{0.49504301f, 0.0422684178f},
-std::array<float,2>{0.744886696f, 0.733291268f},
-std::array<float,2>{0.11048805f, 0.953496158f},
-std::array<float,2>{0.799230814f, 0.409401119f},
-std::array<float,2>{0.16839169f, 0.322910398f},
-std::array<float,2>{0.887102127f, 0.813091815f},
-std::array<float,2>{0.26954481f, 0.602175117f},
-std::array<float,2>{0.554382205f, 0.200915188f},
-std::array<float,2>{0.0484318174f, 0.109471053f},
-std::array<float,2>{0.854100108f, 0.633699894f},
-std::array<float,2>{0.401207745f, 0.88966012f},
-std::array<float,2>{0.646933138f, 0.497077346f},
-std::array<float,2>{0.317515016f, 0.285961837f},
-std::array<float,2>{0.605725229f, 0.765127063f},
-std::array<float,2>{0.223312199f, 0.533849299f},
-std::array<float,2>{0.963096678f, 0.142442495f},
-std::array<float,2>{0.440049678f, 0.19338873f},
-std::array<float,2>{0.705347657f, 0.594254434f},
-std::array<float,2>{0.0782114938f, 0.823711753f},
-std::array<float,2>{0.754807234f, 0.312606335f},
-std::array<float,2>{0.152902737f, 0.414320976f},
-std::array<float,2>{0.922707379f, 0.965385437f},
-std::array<float,2>{0.295035273f, 0.723467588f},
-std::array<float,2>{0.500929832f, 0.0334719755f},
-std::array<float,2>{0.203238785f, 0.175874993f},
-std::array<float,2>{0.980998397f, 0.521772027f},
-std::array<float,2>{0.368555933f, 0.79662925f},
-std::array<float,2>{0.578926802f, 0.279202044f},
-std::array<float,2>{0.417675346f, 0.460458636f},
-std::array<float,2>{0.684200108f, 0.93635726f},
-std::array<float,2>{0.00950788241f, 0.681966841f},
-std::array<float,2>{0.839748263f, 0.0660063922f},
-std::array<float,2>{0.276708543f, 0.0267427806f},
-std::array<float,2>{0.561128795f, 0.716909051f},
-std::array<float,2>{0.158893704f, 0.993142724f},
-std::array<float,2>{0.877410769f, 0.396534115f},
-std::array<float,2>{0.120981313f, 0.358977199f},
-std::array<float,2>{0.808014154f, 0.869925797f},
-std::array<float,2>{0.491965413f, 0.563089848f},
-std::array<float,2>{0.737137675f, 0.232907966f},
-std::array<float,2>{0.177176252f, 0.0523368679f},
-std::array<float,2>{0.90004003f, 0.745104969f},
-std::array<float,2>{0.2570467f, 0.938402891f},
-std::array<float,2>{0.546774924f, 0.4317711f},
-std::array<float,2>{0.482638657f, 0.333208263f},
-std::array<float,2>{0.731072783f, 0.832823277f},
-std::array<float,2>{0.0956071913f, 0.623404205f},
-std::array<float,2>{0.786446989f, 0.205576152f},
-std::array<float,2>{0.34896338f, 0.132994711f},
-std::array<float,2>{0.563724339f, 0.553025067f},
-std::array<float,2>{0.20108971f, 0.769349158f},
-std::array<float,2>{0.989316106f, 0.301980972f},
-std::array<float,2>{0.0176560078f, 0.475020528f},
-std::array<float,2>{0.815063f, 0.897284746f},
-std::array<float,2>{0.433599591f, 0.649332583f},
-std::array<float,2>{0.66824621f, 0.10819868f},
-std::array<float,2>{0.0746941641f, 0.235911757f},
-std::array<float,2>{0.775945544f, 0.58213073f},
-std::array<float,2>{0.455195904f, 0.847798526f},
-std::array<float,2>{0.693434775f, 0.359938323f},
-std::array<float,2>{0.309592217f, 0.381501943f},
-std::array<float,2>{0.527721226f, 0.974795997f},
-std::array<float,2>{0.137710065f, 0.691141725f},
-std::array<float,2>{0.916899741f, 0.00140300242f},
-std::array<float,2>{0.38786158f, 0.0856101215f},
-std::array<float,2>{0.638392866f, 0.658139229f},
-std::array<float,2>{0.0337153114f, 0.912353098f},
-std::array<float,2>{0.859891117f, 0.443778038f},
-std::array<float,2>{0.234808236f, 0.263234824f},
-std::array<float,2>{0.942404568f, 0.801600814f},
-std::array<float,2>{0.338637322f, 0.511915922f},
-std::array<float,2>{0.613223195f, 0.166097894f},
-std::array<float,2>{0.123264663f, 0.0991543233f},
-std::array<float,2>{0.81087476f, 0.643542051f},
-std::array<float,2>{0.486277223f, 0.902538121f},
-std::array<float,2>{0.740963697f, 0.481347561f},
-std::array<float,2>{0.280449897f, 0.305787444f},
-std::array<float,2>{0.555324018f, 0.77363348f},
-std::array<float,2>{0.161993369f, 0.559766054f},
-std::array<float,2>{0.881855607f, 0.125319704f},
-std::array<float,2>{0.419349462f, 0.218027756f},
-std::array<float,2>{0.681488693f, 0.610713184f},
-std::array<float,2>{0.0125646023f, 0.837464929f},
-std::array<float,2>{0.84020251f, 0.336435765f},
-std::array<float,2>{0.207042783f, 0.425836086f},
-std::array<float,2>{0.978509963f, 0.946394384f},
-std::array<float,2>{0.374736011f, 0.741042614f},
-std::array<float,2>{0.584099591f, 0.0577307232f},
-std::array<float,2>{0.14920865f, 0.163094804f},
-std::array<float,2>{0.929310143f, 0.50757587f},
-std::array<float,2>{0.29133907f, 0.810913563f},
-std::array<float,2>{0.506891012f, 0.257132888f},
-std::array<float,2>{0.444735169f, 0.450694472f},
-std::array<float,2>{0.707394004f, 0.920580685f},
-std::array<float,2>{0.082870163f, 0.666522384f},
-std::array<float,2>{0.750112236f, 0.088858135f},
-std::array<float,2>{0.31404388f, 0.00910231192f},
-std::array<float,2>{0.602226675f, 0.700139046f},
-std::array<float,2>{0.220018178f, 0.978643119f},
-std::array<float,2>{0.966537416f, 0.386888534f},
-std::array<float,2>{0.0520822108f, 0.374080807f},
-std::array<float,2>{0.856991947f, 0.852447331f},
-std::array<float,2>{0.403683692f, 0.588237584f},
-std::array<float,2>{0.643910348f, 0.249769211f},
-std::array<float,2>{0.238792226f, 0.0460379049f},
-std::array<float,2>{0.93882364f, 0.726794541f},
-std::array<float,2>{0.340885729f, 0.960413575f},
-std::array<float,2>{0.615048766f, 0.413437784f},
-std::array<float,2>{0.384362251f, 0.326661021f},
-std::array<float,2>{0.636337399f, 0.818119586f},
-std::array<float,2>{0.0354077108f, 0.606546164f},
-std::array<float,2>{0.865681171f, 0.195489213f},
-std::array<float,2>{0.308418691f, 0.155315757f},
-std::array<float,2>{0.527106285f, 0.546385765f},
-std::array<float,2>{0.134947628f, 0.754155159f},
-std::array<float,2>{0.921200693f, 0.291698426f},
-std::array<float,2>{0.0719964504f, 0.492067456f},
-std::array<float,2>{0.778763652f, 0.880987167f},
-std::array<float,2>{0.45915255f, 0.626053989f},
-std::array<float,2>{0.689059854f, 0.120433293f},
-std::array<float,2>{0.0230191443f, 0.22262764f},
-std::array<float,2>{0.816709757f, 0.57220608f},
-std::array<float,2>{0.432998747f, 0.860915661f},
-std::array<float,2>{0.66748029f, 0.345964938f},
-std::array<float,2>{0.347555727f, 0.398500532f},
-std::array<float,2>{0.566465437f, 0.990426719f},
-std::array<float,2>{0.19627361f, 0.709855974f},
-std::array<float,2>{0.986417055f, 0.0200469494f},
-std::array<float,2>{0.479886144f, 0.0705018118f},
-std::array<float,2>{0.729010522f, 0.677511215f},
-std::array<float,2>{0.0999384448f, 0.927350521f},
-std::array<float,2>{0.783349931f, 0.46351108f},
-std::array<float,2>{0.175404593f, 0.267061353f},
-std::array<float,2>{0.90236634f, 0.787998974f},
-std::array<float,2>{0.250735074f, 0.524165034f},
-std::array<float,2>{0.540502191f, 0.18182835f},
-std::array<float,2>{0.0438731685f, 0.0303481463f},
-std::array<float,2>{0.873113573f, 0.711625576f},
-std::array<float,2>{0.381691188f, 0.997613132f},
-std::array<float,2>{0.631049633f, 0.393824965f},
-std::array<float,2>{0.328974456f, 0.354443252f},
-std::array<float,2>{0.618843973f, 0.872434497f},
-std::array<float,2>{0.24977459f, 0.568778992f},
-std::array<float,2>{0.950163305f, 0.227009565f},
-std::array<float,2>{0.463564962f, 0.173633158f},
-std::array<float,2>{0.701253653f, 0.517720699f},
-std::array<float,2>{0.0642705858f, 0.791705012f},
-std::array<float,2>{0.769849539f, 0.276045442f},
-std::array<float,2>{0.130113438f, 0.455442816f},
-std::array<float,2>{0.911988258f, 0.933400035f},
-std::array<float,2>{0.303723544f, 0.6862607f},
-std::array<float,2>{0.516776323f, 0.0666261539f},
-std::array<float,2>{0.190121412f, 0.18783845f},
-std::array<float,2>{0.999340832f, 0.600799263f},
-std::array<float,2>{0.355561286f, 0.824656248f},
-std::array<float,2>{0.571122885f, 0.318701237f},
-std::array<float,2>{0.424659938f, 0.419242769f},
-std::array<float,2>{0.657767653f, 0.962660313f},
-std::array<float,2>{0.0255151764f, 0.719669998f},
-std::array<float,2>{0.824922979f, 0.0365009494f},
-std::array<float,2>{0.2578502f, 0.114320837f},
-std::array<float,2>{0.53726691f, 0.636990428f},
-std::array<float,2>{0.186534181f, 0.884452283f},
-std::array<float,2>{0.89415282f, 0.492347032f},
-std::array<float,2>{0.102450967f, 0.283801436f},
-std::array<float,2>{0.795404136f, 0.761220157f},
-std::array<float,2>{0.47206223f, 0.536005318f},
-std::array<float,2>{0.720475793f, 0.146564066f},
-std::array<float,2>{0.167904511f, 0.0808410421f},
-std::array<float,2>{0.884503961f, 0.662542403f},
-std::array<float,2>{0.268286586f, 0.909635246f},
-std::array<float,2>{0.550703406f, 0.438869238f},
-std::array<float,2>{0.497006029f, 0.258175224f},
-std::array<float,2>{0.749529123f, 0.797375262f},
-std::array<float,2>{0.115904212f, 0.507910371f},
-std::array<float,2>{0.803685069f, 0.168719128f},
-std::array<float,2>{0.362418264f, 0.240646243f},
-std::array<float,2>{0.586168706f, 0.580727994f},
-std::array<float,2>{0.213498697f, 0.844716251f},
-std::array<float,2>{0.975746691f, 0.365994394f},
-std::array<float,2>{0.0066586812f, 0.375182241f},
-std::array<float,2>{0.831498802f, 0.971148074f},
-std::array<float,2>{0.407902479f, 0.695045352f},
-std::array<float,2>{0.678731143f, 0.0041988194f},
-std::array<float,2>{0.0877256766f, 0.138071999f},
-std::array<float,2>{0.764260948f, 0.549207091f},
-std::array<float,2>{0.449487954f, 0.773150742f},
-std::array<float,2>{0.717073202f, 0.300457716f},
-std::array<float,2>{0.283968836f, 0.471030831f},
-std::array<float,2>{0.511891365f, 0.892776012f},
-std::array<float,2>{0.143698454f, 0.652914047f},
-std::array<float,2>{0.933577836f, 0.104599737f},
-std::array<float,2>{0.392786026f, 0.0476353988f},
-std::array<float,2>{0.653897107f, 0.748693466f},
-std::array<float,2>{0.0580171272f, 0.944425941f},
-std::array<float,2>{0.849379599f, 0.435825616f},
-std::array<float,2>{0.23268573f, 0.328756392f},
-std::array<float,2>{0.956387639f, 0.828471124f},
-std::array<float,2>{0.325722754f, 0.618330359f},
-std::array<float,2>{0.594276428f, 0.210566387f},
-std::array<float,2>{0.0698393285f, 0.0602639094f},
-std::array<float,2>{0.768796027f, 0.737958491f},
-std::array<float,2>{0.465328336f, 0.953015506f},
-std::array<float,2>{0.698844254f, 0.422613621f},
-std::array<float,2>{0.297699064f, 0.340692937f},
-std::array<float,2>{0.521689534f, 0.842231452f},
-std::array<float,2>{0.127721086f, 0.6139884f},
-std::array<float,2>{0.910119653f, 0.211963102f},
-std::array<float,2>{0.37528792f, 0.12934275f},
-std::array<float,2>{0.625283241f, 0.557589114f},
-std::array<float,2>{0.039878875f, 0.780904293f},
-std::array<float,2>{0.86949563f, 0.312051654f},
-std::array<float,2>{0.243631437f, 0.476849318f},
-std::array<float,2>{0.945671022f, 0.902323902f},
-std::array<float,2>{0.333231479f, 0.646333396f},
-std::array<float,2>{0.621863186f, 0.0950475261f},
-std::array<float,2>{0.181537673f, 0.242839456f},
-std::array<float,2>{0.897568107f, 0.591069221f},
-std::array<float,2>{0.265003949f, 0.856498778f},
-std::array<float,2>{0.53228122f, 0.368804991f},
-std::array<float,2>{0.476487994f, 0.384967923f},
-std::array<float,2>{0.725559056f, 0.983205497f},
-std::array<float,2>{0.106042877f, 0.698398471f},
-std::array<float,2>{0.789839625f, 0.0124690803f},
-std::array<float,2>{0.352383643f, 0.0906834379f},
-std::array<float,2>{0.574926257f, 0.668481886f},
-std::array<float,2>{0.194108367f, 0.914744377f},
-std::array<float,2>{0.992930353f, 0.449129075f},
-std::array<float,2>{0.03081505f, 0.25379771f},
-std::array<float,2>{0.823017657f, 0.808547556f},
-std::array<float,2>{0.426746458f, 0.50049144f},
-std::array<float,2>{0.661897361f, 0.157555982f},
-std::array<float,2>{0.215350464f, 0.123903163f},
-std::array<float,2>{0.971074939f, 0.631928146f},
-std::array<float,2>{0.366405874f, 0.878282905f},
-std::array<float,2>{0.593483567f, 0.485611975f},
-std::array<float,2>{0.411175221f, 0.293729782f},
-std::array<float,2>{0.674758077f, 0.753297448f},
-std::array<float,2>{0.00212189206f, 0.539889514f},
-std::array<float,2>{0.835604429f, 0.151864052f},
-std::array<float,2>{0.273251414f, 0.202497214f},
-std::array<float,2>{0.552146971f, 0.604634404f},
-std::array<float,2>{0.171244398f, 0.815192938f},
-std::array<float,2>{0.889297247f, 0.320660144f},
-std::array<float,2>{0.112375505f, 0.406471103f},
-std::array<float,2>{0.798254848f, 0.956655741f},
-std::array<float,2>{0.492268294f, 0.731941342f},
-std::array<float,2>{0.74266392f, 0.0399793312f},
-std::array<float,2>{0.0592166856f, 0.187351525f},
-std::array<float,2>{0.846663713f, 0.530007601f},
-std::array<float,2>{0.394940823f, 0.783218563f},
-std::array<float,2>{0.649531662f, 0.270169526f},
-std::array<float,2>{0.324206829f, 0.465899497f},
-std::array<float,2>{0.600847304f, 0.925526261f},
-std::array<float,2>{0.230271965f, 0.675018311f},
-std::array<float,2>{0.957580507f, 0.0754547417f},
-std::array<float,2>{0.446070641f, 0.0185822509f},
-std::array<float,2>{0.712379575f, 0.703301728f},
-std::array<float,2>{0.0910470486f, 0.986742318f},
-std::array<float,2>{0.759443223f, 0.404199064f},
-std::array<float,2>{0.145844221f, 0.349196136f},
-std::array<float,2>{0.936365247f, 0.865054071f},
-std::array<float,2>{0.288208932f, 0.574862242f},
-std::array<float,2>{0.509688675f, 0.225413203f},
-std::array<float,2>{0.0111338003f, 0.0635900646f},
-std::array<float,2>{0.836264133f, 0.681349993f},
-std::array<float,2>{0.41569519f, 0.934960783f},
-std::array<float,2>{0.685829878f, 0.458231091f},
-std::array<float,2>{0.370874763f, 0.280171573f},
-std::array<float,2>{0.581420481f, 0.793274283f},
-std::array<float,2>{0.205611616f, 0.519787967f},
-std::array<float,2>{0.983497381f, 0.178602666f},
-std::array<float,2>{0.488465101f, 0.23097381f},
-std::array<float,2>{0.736046612f, 0.564821243f},
-std::array<float,2>{0.118093833f, 0.867565751f},
-std::array<float,2>{0.805943072f, 0.356903076f},
-std::array<float,2>{0.158196613f, 0.395649463f},
-std::array<float,2>{0.875332594f, 0.994262755f},
-std::array<float,2>{0.274816632f, 0.716533422f},
-std::array<float,2>{0.558672547f, 0.0235280935f},
-std::array<float,2>{0.225504726f, 0.143417284f},
-std::array<float,2>{0.961878061f, 0.532495797f},
-std::array<float,2>{0.318653911f, 0.763465524f},
-std::array<float,2>{0.608002245f, 0.288688302f},
-std::array<float,2>{0.399760276f, 0.498489916f},
-std::array<float,2>{0.646232128f, 0.888089657f},
-std::array<float,2>{0.0499138758f, 0.63586098f},
-std::array<float,2>{0.853385627f, 0.113254078f},
-std::array<float,2>{0.293825418f, 0.0322583616f},
-std::array<float,2>{0.503229618f, 0.726136625f},
-std::array<float,2>{0.155285522f, 0.967891753f},
-std::array<float,2>{0.924614131f, 0.417184681f},
-std::array<float,2>{0.0802784935f, 0.315955609f},
-std::array<float,2>{0.756548882f, 0.821291924f},
-std::array<float,2>{0.438140392f, 0.596454024f},
-std::array<float,2>{0.704755247f, 0.192221075f},
-std::array<float,2>{0.140410483f, 0.00303873699f},
-std::array<float,2>{0.914910614f, 0.689325571f},
-std::array<float,2>{0.31238398f, 0.974519372f},
-std::array<float,2>{0.529977798f, 0.379744709f},
-std::array<float,2>{0.454735219f, 0.361893177f},
-std::array<float,2>{0.693031609f, 0.850827038f},
-std::array<float,2>{0.0761739537f, 0.585899711f},
-std::array<float,2>{0.775170267f, 0.237833425f},
-std::array<float,2>{0.336332381f, 0.165769577f},
-std::array<float,2>{0.609508336f, 0.514088273f},
-std::array<float,2>{0.23740153f, 0.804646313f},
-std::array<float,2>{0.945058167f, 0.265048832f},
-std::array<float,2>{0.0324513316f, 0.443044841f},
-std::array<float,2>{0.862996578f, 0.910769224f},
-std::array<float,2>{0.389395893f, 0.659300506f},
-std::array<float,2>{0.640431345f, 0.0835813582f},
-std::array<float,2>{0.0969474018f, 0.203996241f},
-std::array<float,2>{0.78771621f, 0.622490048f},
-std::array<float,2>{0.481993169f, 0.834430039f},
-std::array<float,2>{0.73360461f, 0.334483504f},
-std::array<float,2>{0.255562425f, 0.430781633f},
-std::array<float,2>{0.544864893f, 0.941313922f},
-std::array<float,2>{0.178761318f, 0.743495286f},
-std::array<float,2>{0.90160799f, 0.0539630577f},
-std::array<float,2>{0.43578133f, 0.105487332f},
-std::array<float,2>{0.670707047f, 0.650738001f},
-std::array<float,2>{0.0170673113f, 0.895905316f},
-std::array<float,2>{0.813008249f, 0.473072678f},
-std::array<float,2>{0.201571733f, 0.304231852f},
-std::array<float,2>{0.99098444f, 0.767432094f},
-std::array<float,2>{0.35103929f, 0.552409112f},
-std::array<float,2>{0.564492404f, 0.136138484f},
-std::array<float,2>{0.115679167f, 0.0787909999f},
-std::array<float,2>{0.80279392f, 0.660410285f},
-std::array<float,2>{0.496233761f, 0.906325698f},
-std::array<float,2>{0.749488711f, 0.440961123f},
-std::array<float,2>{0.267963111f, 0.259825617f},
-std::array<float,2>{0.549861491f, 0.800715327f},
-std::array<float,2>{0.167467371f, 0.511629164f},
-std::array<float,2>{0.883927107f, 0.171685591f},
-std::array<float,2>{0.40741694f, 0.239471406f},
-std::array<float,2>{0.679226935f, 0.579943895f},
-std::array<float,2>{0.00594213f, 0.846242607f},
-std::array<float,2>{0.832021177f, 0.363957137f},
-std::array<float,2>{0.213355705f, 0.378036946f},
-std::array<float,2>{0.976423621f, 0.968873799f},
-std::array<float,2>{0.363198251f, 0.692825317f},
-std::array<float,2>{0.586566091f, 0.00775883952f},
-std::array<float,2>{0.144386977f, 0.140226975f},
-std::array<float,2>{0.932722688f, 0.547888994f},
-std::array<float,2>{0.28349781f, 0.771034598f},
-std::array<float,2>{0.51239568f, 0.298492193f},
-std::array<float,2>{0.449920624f, 0.469862103f},
-std::array<float,2>{0.71757412f, 0.891397774f},
-std::array<float,2>{0.0870204568f, 0.655044615f},
-std::array<float,2>{0.763828874f, 0.102099426f},
-std::array<float,2>{0.32545352f, 0.0492602102f},
-std::array<float,2>{0.59394604f, 0.74655962f},
-std::array<float,2>{0.233089656f, 0.94266808f},
-std::array<float,2>{0.956955969f, 0.43364045f},
-std::array<float,2>{0.0581765883f, 0.330545276f},
-std::array<float,2>{0.848867178f, 0.830409706f},
-std::array<float,2>{0.393476546f, 0.620125413f},
-std::array<float,2>{0.653573871f, 0.208191946f},
-std::array<float,2>{0.249206737f, 0.0279647056f},
-std::array<float,2>{0.949418068f, 0.714220166f},
-std::array<float,2>{0.328200191f, 0.998825192f},
-std::array<float,2>{0.618206263f, 0.391149819f},
-std::array<float,2>{0.381178349f, 0.351909429f},
-std::array<float,2>{0.631545484f, 0.87332952f},
-std::array<float,2>{0.0433376133f, 0.566589236f},
-std::array<float,2>{0.873610497f, 0.228929192f},
-std::array<float,2>{0.304258496f, 0.175418898f},
-std::array<float,2>{0.517090917f, 0.516190946f},
-std::array<float,2>{0.130853832f, 0.78998661f},
-std::array<float,2>{0.911184669f, 0.273577511f},
-std::array<float,2>{0.0639067069f, 0.454926223f},
-std::array<float,2>{0.770071208f, 0.92980963f},
-std::array<float,2>{0.463042736f, 0.6852265f},
-std::array<float,2>{0.702085853f, 0.069479011f},
-std::array<float,2>{0.0263644587f, 0.190083414f},
-std::array<float,2>{0.824418724f, 0.597748578f},
-std::array<float,2>{0.42423588f, 0.827167153f},
-std::array<float,2>{0.65743041f, 0.316694796f},
-std::array<float,2>{0.356404841f, 0.421111405f},
-std::array<float,2>{0.570727587f, 0.963939786f},
-std::array<float,2>{0.1897223f, 0.721699536f},
-std::array<float,2>{0.999619365f, 0.0379960425f},
-std::array<float,2>{0.472585917f, 0.116662659f},
-std::array<float,2>{0.71981138f, 0.640187085f},
-std::array<float,2>{0.101694517f, 0.885624409f},
-std::array<float,2>{0.795797408f, 0.495825171f},
-std::array<float,2>{0.187041521f, 0.282241583f},
-std::array<float,2>{0.894032657f, 0.757823348f},
-std::array<float,2>{0.258647591f, 0.537476301f},
-std::array<float,2>{0.537928164f, 0.144780636f},
-std::array<float,2>{0.0357345454f, 0.0433535874f},
-std::array<float,2>{0.866058528f, 0.730376244f},
-std::array<float,2>{0.384181112f, 0.957060874f},
-std::array<float,2>{0.63604331f, 0.411443949f},
-std::array<float,2>{0.341553807f, 0.324788749f},
-std::array<float,2>{0.614475727f, 0.818756819f},
-std::array<float,2>{0.238727897f, 0.607760251f},
-std::array<float,2>{0.939261734f, 0.197553053f},
-std::array<float,2>{0.459725022f, 0.152827427f},
-std::array<float,2>{0.688960731f, 0.543280959f},
-std::array<float,2>{0.0715900138f, 0.756078005f},
-std::array<float,2>{0.779265821f, 0.290534437f},
-std::array<float,2>{0.135636479f, 0.489953369f},
-std::array<float,2>{0.921680331f, 0.879297435f},
-std::array<float,2>{0.30769825f, 0.627224326f},
-std::array<float,2>{0.526536703f, 0.117600203f},
-std::array<float,2>{0.195516735f, 0.219170406f},
-std::array<float,2>{0.987081409f, 0.573782682f},
-std::array<float,2>{0.347097665f, 0.861397922f},
-std::array<float,2>{0.567258894f, 0.344569683f},
-std::array<float,2>{0.433267266f, 0.401174396f},
-std::array<float,2>{0.667955339f, 0.989417732f},
-std::array<float,2>{0.0227150694f, 0.708196938f},
-std::array<float,2>{0.817076325f, 0.0226710271f},
-std::array<float,2>{0.25003913f, 0.0729175657f},
-std::array<float,2>{0.540899098f, 0.67818743f},
-std::array<float,2>{0.17523165f, 0.928266823f},
-std::array<float,2>{0.903160572f, 0.462325782f},
-std::array<float,2>{0.100552619f, 0.267948806f},
-std::array<float,2>{0.784001589f, 0.786678851f},
-std::array<float,2>{0.480413854f, 0.525747538f},
-std::array<float,2>{0.728772819f, 0.180548012f},
-std::array<float,2>{0.161360383f, 0.100291081f},
-std::array<float,2>{0.882692993f, 0.641353786f},
-std::array<float,2>{0.280882925f, 0.905989885f},
-std::array<float,2>{0.555171251f, 0.483545631f},
-std::array<float,2>{0.485667109f, 0.306885242f},
-std::array<float,2>{0.740336716f, 0.777205706f},
-std::array<float,2>{0.1235613f, 0.562090814f},
-std::array<float,2>{0.811404705f, 0.127292559f},
-std::array<float,2>{0.374452919f, 0.21596384f},
-std::array<float,2>{0.584533155f, 0.612242639f},
-std::array<float,2>{0.207558855f, 0.838669837f},
-std::array<float,2>{0.97781229f, 0.338290662f},
-std::array<float,2>{0.0117726354f, 0.429216474f},
-std::array<float,2>{0.840679944f, 0.947839797f},
-std::array<float,2>{0.419846475f, 0.739037633f},
-std::array<float,2>{0.68096894f, 0.0561932847f},
-std::array<float,2>{0.0822180882f, 0.160228148f},
-std::array<float,2>{0.750819683f, 0.505094528f},
-std::array<float,2>{0.444968522f, 0.80869472f},
-std::array<float,2>{0.707839191f, 0.255813032f},
-std::array<float,2>{0.291718632f, 0.451683223f},
-std::array<float,2>{0.507461011f, 0.918192863f},
-std::array<float,2>{0.14888677f, 0.664125562f},
-std::array<float,2>{0.92871511f, 0.0859687477f},
-std::array<float,2>{0.404161721f, 0.0112772528f},
-std::array<float,2>{0.644248426f, 0.702772141f},
-std::array<float,2>{0.052646663f, 0.977076292f},
-std::array<float,2>{0.856544435f, 0.389828295f},
-std::array<float,2>{0.220410645f, 0.371657342f},
-std::array<float,2>{0.966151953f, 0.853773594f},
-std::array<float,2>{0.313500196f, 0.586735249f},
-std::array<float,2>{0.601962268f, 0.248010263f},
-std::array<float,2>{0.076895088f, 0.00149857206f},
-std::array<float,2>{0.774546683f, 0.690619826f},
-std::array<float,2>{0.454281658f, 0.975201011f},
-std::array<float,2>{0.692641377f, 0.38118431f},
-std::array<float,2>{0.311674803f, 0.359616786f},
-std::array<float,2>{0.529729307f, 0.848481655f},
-std::array<float,2>{0.13994056f, 0.582964599f},
-std::array<float,2>{0.914398611f, 0.235718936f},
-std::array<float,2>{0.389082491f, 0.166684017f},
-std::array<float,2>{0.639769971f, 0.512543917f},
-std::array<float,2>{0.0328008682f, 0.801022947f},
-std::array<float,2>{0.862589359f, 0.263179451f},
-std::array<float,2>{0.237969726f, 0.444046766f},
-std::array<float,2>{0.944647491f, 0.912735283f},
-std::array<float,2>{0.336647302f, 0.65736866f},
-std::array<float,2>{0.610070527f, 0.0854147896f},
-std::array<float,2>{0.179575294f, 0.205195978f},
-std::array<float,2>{0.902208328f, 0.623912871f},
-std::array<float,2>{0.255117327f, 0.832420766f},
-std::array<float,2>{0.54436785f, 0.333911657f},
-std::array<float,2>{0.481781512f, 0.432571381f},
-std::array<float,2>{0.734177947f, 0.93788898f},
-std::array<float,2>{0.0976246893f, 0.744618237f},
-std::array<float,2>{0.787546635f, 0.052126158f},
-std::array<float,2>{0.351486683f, 0.107884459f},
-std::array<float,2>{0.565016747f, 0.64847666f},
-std::array<float,2>{0.201795638f, 0.896772861f},
-std::array<float,2>{0.99028635f, 0.475405604f},
-std::array<float,2>{0.0171411466f, 0.302395552f},
-std::array<float,2>{0.812516272f, 0.768881619f},
-std::array<float,2>{0.436193347f, 0.55355984f},
-std::array<float,2>{0.670291543f, 0.133763596f},
-std::array<float,2>{0.205474943f, 0.06546361f},
-std::array<float,2>{0.98395288f, 0.682151735f},
-std::array<float,2>{0.370522141f, 0.935802042f},
-std::array<float,2>{0.581838846f, 0.46018821f},
-std::array<float,2>{0.415376365f, 0.278591752f},
-std::array<float,2>{0.686374664f, 0.796318531f},
-std::array<float,2>{0.0114832576f, 0.522402465f},
-std::array<float,2>{0.836796522f, 0.176425621f},
-std::array<float,2>{0.27523154f, 0.233335987f},
-std::array<float,2>{0.55949074f, 0.56287092f},
-std::array<float,2>{0.157426238f, 0.86947161f},
-std::array<float,2>{0.875666559f, 0.358460933f},
-std::array<float,2>{0.117319576f, 0.39740774f},
-std::array<float,2>{0.806233883f, 0.992203891f},
-std::array<float,2>{0.488978624f, 0.717379212f},
-std::array<float,2>{0.735535085f, 0.0273322444f},
-std::array<float,2>{0.0504826903f, 0.14187555f},
-std::array<float,2>{0.852843583f, 0.533247769f},
-std::array<float,2>{0.400215834f, 0.765139163f},
-std::array<float,2>{0.645859361f, 0.285264701f},
-std::array<float,2>{0.31894359f, 0.497797728f},
-std::array<float,2>{0.607844532f, 0.890576184f},
-std::array<float,2>{0.224903047f, 0.633140028f},
-std::array<float,2>{0.961142421f, 0.110012963f},
-std::array<float,2>{0.437670857f, 0.0338039249f},
-std::array<float,2>{0.704219937f, 0.722719789f},
-std::array<float,2>{0.0808247998f, 0.964903772f},
-std::array<float,2>{0.756088734f, 0.414619476f},
-std::array<float,2>{0.156089261f, 0.313112229f},
-std::array<float,2>{0.924105883f, 0.823882103f},
-std::array<float,2>{0.293214262f, 0.594025254f},
-std::array<float,2>{0.503882706f, 0.194184452f},
-std::array<float,2>{0.0027890685f, 0.121775307f},
-std::array<float,2>{0.835442603f, 0.629229248f},
-std::array<float,2>{0.412040144f, 0.875024319f},
-std::array<float,2>{0.674177051f, 0.486735433f},
-std::array<float,2>{0.367031872f, 0.296094507f},
-std::array<float,2>{0.593070686f, 0.751057208f},
-std::array<float,2>{0.214961633f, 0.54261297f},
-std::array<float,2>{0.971619189f, 0.149025083f},
-std::array<float,2>{0.493121564f, 0.200568482f},
-std::array<float,2>{0.743112147f, 0.601902544f},
-std::array<float,2>{0.112851351f, 0.812796474f},
-std::array<float,2>{0.798518598f, 0.322632432f},
-std::array<float,2>{0.171584085f, 0.409821063f},
-std::array<float,2>{0.888760567f, 0.953732848f},
-std::array<float,2>{0.272566378f, 0.732467234f},
-std::array<float,2>{0.552273154f, 0.0427495725f},
-std::array<float,2>{0.229756832f, 0.185365528f},
-std::array<float,2>{0.957457244f, 0.528132915f},
-std::array<float,2>{0.323458105f, 0.782914042f},
-std::array<float,2>{0.60109669f, 0.272912145f},
-std::array<float,2>{0.395472169f, 0.467224985f},
-std::array<float,2>{0.650252998f, 0.923686147f},
-std::array<float,2>{0.0589508377f, 0.672911823f},
-std::array<float,2>{0.845852554f, 0.0763040036f},
-std::array<float,2>{0.288765252f, 0.0171331353f},
-std::array<float,2>{0.50883007f, 0.705944479f},
-std::array<float,2>{0.146356061f, 0.986118555f},
-std::array<float,2>{0.935960948f, 0.405723482f},
-std::array<float,2>{0.0916732773f, 0.350062609f},
-std::array<float,2>{0.759141207f, 0.866262794f},
-std::array<float,2>{0.445418179f, 0.576420069f},
-std::array<float,2>{0.712786078f, 0.22413215f},
-std::array<float,2>{0.127309039f, 0.0617403723f},
-std::array<float,2>{0.909197092f, 0.73628217f},
-std::array<float,2>{0.297044575f, 0.950750887f},
-std::array<float,2>{0.522052884f, 0.42438218f},
-std::array<float,2>{0.465595484f, 0.34307301f},
-std::array<float,2>{0.698490024f, 0.841688573f},
-std::array<float,2>{0.0697554052f, 0.616332412f},
-std::array<float,2>{0.76918602f, 0.214497969f},
-std::array<float,2>{0.333709598f, 0.132642359f},
-std::array<float,2>{0.621551812f, 0.55501771f},
-std::array<float,2>{0.243957713f, 0.777361512f},
-std::array<float,2>{0.945860147f, 0.308744133f},
-std::array<float,2>{0.0391911864f, 0.479386896f},
-std::array<float,2>{0.869836569f, 0.898706734f},
-std::array<float,2>{0.375739723f, 0.647632658f},
-std::array<float,2>{0.62558645f, 0.0967291445f},
-std::array<float,2>{0.105694309f, 0.244281694f},
-std::array<float,2>{0.789095819f, 0.592944086f},
-std::array<float,2>{0.475746721f, 0.858112693f},
-std::array<float,2>{0.724861562f, 0.369656175f},
-std::array<float,2>{0.265325308f, 0.384561926f},
-std::array<float,2>{0.533161998f, 0.982137382f},
-std::array<float,2>{0.180795535f, 0.696633697f},
-std::array<float,2>{0.898105562f, 0.0139336744f},
-std::array<float,2>{0.425981969f, 0.0933847427f},
-std::array<float,2>{0.661338866f, 0.670790434f},
-std::array<float,2>{0.0306663122f, 0.916231275f},
-std::array<float,2>{0.822295249f, 0.446307838f},
-std::array<float,2>{0.193467543f, 0.251516044f},
-std::array<float,2>{0.992535114f, 0.804969847f},
-std::array<float,2>{0.351611882f, 0.502560854f},
-std::array<float,2>{0.574597895f, 0.159766167f},
-std::array<float,2>{0.0886173248f, 0.105257928f},
-std::array<float,2>{0.762064815f, 0.652421236f},
-std::array<float,2>{0.452367932f, 0.893270791f},
-std::array<float,2>{0.715259314f, 0.471273333f},
-std::array<float,2>{0.281912059f, 0.299820125f},
-std::array<float,2>{0.514272988f, 0.772728741f},
-std::array<float,2>{0.141121879f, 0.549395561f},
-std::array<float,2>{0.931617618f, 0.138313159f},
-std::array<float,2>{0.39113313f, 0.210235715f},
-std::array<float,2>{0.656011045f, 0.619064808f},
-std::array<float,2>{0.0564807169f, 0.828910828f},
-std::array<float,2>{0.850185275f, 0.32826376f},
-std::array<float,2>{0.231607318f, 0.43629998f},
-std::array<float,2>{0.953926563f, 0.945032656f},
-std::array<float,2>{0.326973855f, 0.748288035f},
-std::array<float,2>{0.595710337f, 0.0470442995f},
-std::array<float,2>{0.164697528f, 0.168045506f},
-std::array<float,2>{0.886273801f, 0.508390665f},
-std::array<float,2>{0.26726523f, 0.797161877f},
-std::array<float,2>{0.548774302f, 0.258465648f},
-std::array<float,2>{0.499879241f, 0.439041615f},
-std::array<float,2>{0.747491181f, 0.909739673f},
-std::array<float,2>{0.114714369f, 0.662801683f},
-std::array<float,2>{0.801772177f, 0.0805545375f},
-std::array<float,2>{0.360990286f, 0.00466947025f},
-std::array<float,2>{0.588519216f, 0.694367766f},
-std::array<float,2>{0.212305054f, 0.971249759f},
-std::array<float,2>{0.972952008f, 0.375826567f},
-std::array<float,2>{0.00516083091f, 0.365429431f},
-std::array<float,2>{0.829564214f, 0.843761384f},
-std::array<float,2>{0.408474892f, 0.580142021f},
-std::array<float,2>{0.677570522f, 0.241142318f},
-std::array<float,2>{0.18752709f, 0.036687389f},
-std::array<float,2>{0.997359693f, 0.718789756f},
-std::array<float,2>{0.357560009f, 0.961946368f},
-std::array<float,2>{0.572492599f, 0.419778585f},
-std::array<float,2>{0.422440767f, 0.318993032f},
-std::array<float,2>{0.6587587f, 0.824908257f},
-std::array<float,2>{0.0252503902f, 0.601122856f},
-std::array<float,2>{0.826289117f, 0.188428074f},
-std::array<float,2>{0.260034442f, 0.147077903f},
-std::array<float,2>{0.535456359f, 0.535316825f},
-std::array<float,2>{0.183832467f, 0.761672199f},
-std::array<float,2>{0.891104162f, 0.283432603f},
-std::array<float,2>{0.104880206f, 0.49310419f},
-std::array<float,2>{0.794728875f, 0.884022951f},
-std::array<float,2>{0.470506042f, 0.63746345f},
-std::array<float,2>{0.722055018f, 0.114874132f},
-std::array<float,2>{0.0463364795f, 0.227400675f},
-std::array<float,2>{0.871864617f, 0.56927067f},
-std::array<float,2>{0.380081087f, 0.872657597f},
-std::array<float,2>{0.629598737f, 0.353862703f},
-std::array<float,2>{0.330922186f, 0.39429912f},
-std::array<float,2>{0.620227337f, 0.997081697f},
-std::array<float,2>{0.246111676f, 0.711124837f},
-std::array<float,2>{0.952163994f, 0.030984994f},
-std::array<float,2>{0.462210357f, 0.0670550764f},
-std::array<float,2>{0.699665606f, 0.686027706f},
-std::array<float,2>{0.0650025234f, 0.933083892f},
-std::array<float,2>{0.772785068f, 0.455913961f},
-std::array<float,2>{0.132562727f, 0.275728971f},
-std::array<float,2>{0.912715018f, 0.791275084f},
-std::array<float,2>{0.300824702f, 0.518288791f},
-std::array<float,2>{0.518927813f, 0.17308037f},
-std::array<float,2>{0.0207471699f, 0.0197522733f},
-std::array<float,2>{0.819772303f, 0.709025264f},
-std::array<float,2>{0.430124372f, 0.99102062f},
-std::array<float,2>{0.664986432f, 0.399271756f},
-std::array<float,2>{0.344824106f, 0.346449167f},
-std::array<float,2>{0.569526494f, 0.86048013f},
-std::array<float,2>{0.197509497f, 0.571619928f},
-std::array<float,2>{0.986110866f, 0.221884489f},
-std::array<float,2>{0.47760275f, 0.182192385f},
-std::array<float,2>{0.72722131f, 0.523723006f},
-std::array<float,2>{0.0984739363f, 0.787246287f},
-std::array<float,2>{0.782636523f, 0.26732105f},
-std::array<float,2>{0.172262222f, 0.46326226f},
-std::array<float,2>{0.905577183f, 0.926784694f},
-std::array<float,2>{0.253845692f, 0.676989973f},
-std::array<float,2>{0.541213751f, 0.0709578544f},
-std::array<float,2>{0.240577266f, 0.195947587f},
-std::array<float,2>{0.940838218f, 0.607126832f},
-std::array<float,2>{0.343039334f, 0.817510486f},
-std::array<float,2>{0.616449356f, 0.32659784f},
-std::array<float,2>{0.386196256f, 0.413641155f},
-std::array<float,2>{0.63326329f, 0.960833371f},
-std::array<float,2>{0.0376474373f, 0.727148294f},
-std::array<float,2>{0.864243388f, 0.0464229807f},
-std::array<float,2>{0.305146158f, 0.1207809f},
-std::array<float,2>{0.5236727f, 0.62660414f},
-std::array<float,2>{0.133336589f, 0.881396115f},
-std::array<float,2>{0.918179929f, 0.491547108f},
-std::array<float,2>{0.0739723966f, 0.291109502f},
-std::array<float,2>{0.781243026f, 0.75475502f},
-std::array<float,2>{0.458653241f, 0.546657085f},
-std::array<float,2>{0.690425694f, 0.156184435f},
-std::array<float,2>{0.151798263f, 0.0879755914f},
-std::array<float,2>{0.92763561f, 0.666365027f},
-std::array<float,2>{0.290267646f, 0.920024037f},
-std::array<float,2>{0.504086316f, 0.45056814f},
-std::array<float,2>{0.442021906f, 0.257784158f},
-std::array<float,2>{0.709662139f, 0.811089516f},
-std::array<float,2>{0.0843609273f, 0.507052064f},
-std::array<float,2>{0.753094852f, 0.163830742f},
-std::array<float,2>{0.315137923f, 0.249364093f},
-std::array<float,2>{0.604928076f, 0.588486195f},
-std::array<float,2>{0.221488222f, 0.851853728f},
-std::array<float,2>{0.968471408f, 0.374687284f},
-std::array<float,2>{0.0536927544f, 0.387520641f},
-std::array<float,2>{0.858103216f, 0.979393542f},
-std::array<float,2>{0.40494293f, 0.699391305f},
-std::array<float,2>{0.641702116f, 0.00930087082f},
-std::array<float,2>{0.122267723f, 0.125623062f},
-std::array<float,2>{0.810263097f, 0.560533345f},
-std::array<float,2>{0.488123924f, 0.774214447f},
-std::array<float,2>{0.739188135f, 0.306275189f},
-std::array<float,2>{0.279165745f, 0.480936795f},
-std::array<float,2>{0.557136059f, 0.903283834f},
-std::array<float,2>{0.162469983f, 0.642601907f},
-std::array<float,2>{0.880149662f, 0.0990937874f},
-std::array<float,2>{0.42034027f, 0.0583157614f},
-std::array<float,2>{0.682925522f, 0.740392447f},
-std::array<float,2>{0.015193264f, 0.947127461f},
-std::array<float,2>{0.843204021f, 0.42672497f},
-std::array<float,2>{0.210326105f, 0.33598119f},
-std::array<float,2>{0.978719652f, 0.837022841f},
-std::array<float,2>{0.372248083f, 0.611306965f},
-std::array<float,2>{0.583174586f, 0.218579501f},
-std::array<float,2>{0.0950188041f, 0.0543653667f},
-std::array<float,2>{0.786737561f, 0.744100153f},
-std::array<float,2>{0.483348608f, 0.940887451f},
-std::array<float,2>{0.730865061f, 0.431402534f},
-std::array<float,2>{0.257705569f, 0.334127456f},
-std::array<float,2>{0.546370447f, 0.834831178f},
-std::array<float,2>{0.177579552f, 0.622583866f},
-std::array<float,2>{0.899629951f, 0.203320831f},
-std::array<float,2>{0.434478372f, 0.136293635f},
-std::array<float,2>{0.668749809f, 0.55217129f},
-std::array<float,2>{0.0183488745f, 0.766872764f},
-std::array<float,2>{0.814708591f, 0.304148108f},
-std::array<float,2>{0.200651005f, 0.473459065f},
-std::array<float,2>{0.989810705f, 0.896084964f},
-std::array<float,2>{0.349353194f, 0.650967121f},
-std::array<float,2>{0.564201295f, 0.106037259f},
-std::array<float,2>{0.138407454f, 0.237545997f},
-std::array<float,2>{0.916429698f, 0.585175395f},
-std::array<float,2>{0.310193926f, 0.8513304f},
-std::array<float,2>{0.528243005f, 0.361537814f},
-std::array<float,2>{0.456015706f, 0.379097223f},
-std::array<float,2>{0.693919063f, 0.973918796f},
-std::array<float,2>{0.0748447552f, 0.688659608f},
-std::array<float,2>{0.775614321f, 0.00382693764f},
-std::array<float,2>{0.338275641f, 0.0834800154f},
-std::array<float,2>{0.612452507f, 0.659979701f},
-std::array<float,2>{0.235170364f, 0.910191894f},
-std::array<float,2>{0.943190634f, 0.442529827f},
-std::array<float,2>{0.0333472937f, 0.265317231f},
-std::array<float,2>{0.859478951f, 0.804035366f},
-std::array<float,2>{0.388489515f, 0.514396906f},
-std::array<float,2>{0.637837708f, 0.165371805f},
-std::array<float,2>{0.223111838f, 0.112756044f},
-std::array<float,2>{0.963424444f, 0.636676371f},
-std::array<float,2>{0.318280429f, 0.888229489f},
-std::array<float,2>{0.605973661f, 0.498998851f},
-std::array<float,2>{0.400730819f, 0.288495243f},
-std::array<float,2>{0.647384822f, 0.763065696f},
-std::array<float,2>{0.0482829139f, 0.532912612f},
-std::array<float,2>{0.853527486f, 0.142790169f},
-std::array<float,2>{0.295883119f, 0.191603333f},
-std::array<float,2>{0.500201285f, 0.596162736f},
-std::array<float,2>{0.152713999f, 0.822106898f},
-std::array<float,2>{0.921974182f, 0.31586948f},
-std::array<float,2>{0.0787034035f, 0.417938024f},
-std::array<float,2>{0.754189849f, 0.968294203f},
-std::array<float,2>{0.439699113f, 0.72592777f},
-std::array<float,2>{0.705828965f, 0.0328499265f},
-std::array<float,2>{0.00915825274f, 0.178149596f},
-std::array<float,2>{0.839165926f, 0.520376801f},
-std::array<float,2>{0.417445898f, 0.79349792f},
-std::array<float,2>{0.683994591f, 0.2793293f},
-std::array<float,2>{0.369075537f, 0.458719045f},
-std::array<float,2>{0.578415334f, 0.935297728f},
-std::array<float,2>{0.203915849f, 0.680835426f},
-std::array<float,2>{0.980865359f, 0.0640863478f},
-std::array<float,2>{0.491553217f, 0.0239663348f},
-std::array<float,2>{0.736696661f, 0.716104984f},
-std::array<float,2>{0.120168924f, 0.994957566f},
-std::array<float,2>{0.808216453f, 0.396323889f},
-std::array<float,2>{0.158250868f, 0.357050389f},
-std::array<float,2>{0.877584577f, 0.867758274f},
-std::array<float,2>{0.277238548f, 0.565288246f},
-std::array<float,2>{0.560816228f, 0.230686158f},
-std::array<float,2>{0.0624096207f, 0.0758572817f},
-std::array<float,2>{0.844559193f, 0.675599217f},
-std::array<float,2>{0.397556335f, 0.924929202f},
-std::array<float,2>{0.651281476f, 0.466785908f},
-std::array<float,2>{0.321936399f, 0.269644558f},
-std::array<float,2>{0.5991925f, 0.783882141f},
-std::array<float,2>{0.227134317f, 0.529661417f},
-std::array<float,2>{0.959333003f, 0.187003225f},
-std::array<float,2>{0.448878556f, 0.224909142f},
-std::array<float,2>{0.714841545f, 0.574519932f},
-std::array<float,2>{0.0926171318f, 0.864312291f},
-std::array<float,2>{0.761679113f, 0.348690867f},
-std::array<float,2>{0.147786945f, 0.403559059f},
-std::array<float,2>{0.935231149f, 0.986987889f},
-std::array<float,2>{0.285465628f, 0.703961611f},
-std::array<float,2>{0.510520101f, 0.0194977466f},
-std::array<float,2>{0.218512759f, 0.151686847f},
-std::array<float,2>{0.96921289f, 0.539114594f},
-std::array<float,2>{0.36505872f, 0.753898025f},
-std::array<float,2>{0.591519117f, 0.293191224f},
-std::array<float,2>{0.414015889f, 0.486088663f},
-std::array<float,2>{0.671972275f, 0.878538132f},
-std::array<float,2>{0.00105146447f, 0.632401705f},
-std::array<float,2>{0.833112061f, 0.123289332f},
-std::array<float,2>{0.270236522f, 0.0393578522f},
-std::array<float,2>{0.553913355f, 0.73180455f},
-std::array<float,2>{0.168585062f, 0.956335425f},
-std::array<float,2>{0.887274265f, 0.407120258f},
-std::array<float,2>{0.111280449f, 0.320857406f},
-std::array<float,2>{0.799779117f, 0.814591408f},
-std::array<float,2>{0.494627386f, 0.605002642f},
-std::array<float,2>{0.744288623f, 0.203016207f},
-std::array<float,2>{0.183515891f, 0.011925485f},
-std::array<float,2>{0.895914972f, 0.699009538f},
-std::array<float,2>{0.261895299f, 0.982614577f},
-std::array<float,2>{0.534643173f, 0.3857086f},
-std::array<float,2>{0.474050254f, 0.368568808f},
-std::array<float,2>{0.723054171f, 0.857221246f},
-std::array<float,2>{0.107984841f, 0.591624618f},
-std::array<float,2>{0.791770279f, 0.242194861f},
-std::array<float,2>{0.355169177f, 0.158191428f},
-std::array<float,2>{0.576201797f, 0.500056326f},
-std::array<float,2>{0.192458808f, 0.808061123f},
-std::array<float,2>{0.99548614f, 0.253122121f},
-std::array<float,2>{0.0292502064f, 0.448562115f},
-std::array<float,2>{0.82035166f, 0.914292157f},
-std::array<float,2>{0.428756475f, 0.66810286f},
-std::array<float,2>{0.662649214f, 0.0902325287f},
-std::array<float,2>{0.066902481f, 0.212569267f},
-std::array<float,2>{0.767230213f, 0.613669693f},
-std::array<float,2>{0.468466789f, 0.842592478f},
-std::array<float,2>{0.696949244f, 0.340099335f},
-std::array<float,2>{0.300704956f, 0.422098547f},
-std::array<float,2>{0.519827425f, 0.952316582f},
-std::array<float,2>{0.125966206f, 0.737738252f},
-std::array<float,2>{0.908041775f, 0.0595892295f},
-std::array<float,2>{0.377000362f, 0.0953406245f},
-std::array<float,2>{0.627708256f, 0.645974934f},
-std::array<float,2>{0.0420816205f, 0.901459634f},
-std::array<float,2>{0.868890464f, 0.477466434f},
-std::array<float,2>{0.244859621f, 0.311874956f},
-std::array<float,2>{0.947444916f, 0.780405879f},
-std::array<float,2>{0.334586918f, 0.557095468f},
-std::array<float,2>{0.624339163f, 0.12945883f},
-std::array<float,2>{0.0659628287f, 0.0690301135f},
-std::array<float,2>{0.772412658f, 0.684293985f},
-std::array<float,2>{0.461883783f, 0.93089509f},
-std::array<float,2>{0.700331628f, 0.453131318f},
-std::array<float,2>{0.302682221f, 0.274993569f},
-std::array<float,2>{0.517721891f, 0.790865481f},
-std::array<float,2>{0.131016672f, 0.516906083f},
-std::array<float,2>{0.913874984f, 0.174477845f},
-std::array<float,2>{0.379308522f, 0.229515538f},
-std::array<float,2>{0.63019526f, 0.568207085f},
-std::array<float,2>{0.0452638641f, 0.874336839f},
-std::array<float,2>{0.872718215f, 0.353298724f},
-std::array<float,2>{0.24785161f, 0.392401099f},
-std::array<float,2>{0.951301038f, 0.999592662f},
-std::array<float,2>{0.331609547f, 0.712902665f},
-std::array<float,2>{0.619291425f, 0.0292506181f},
-std::array<float,2>{0.184850037f, 0.145916894f},
-std::array<float,2>{0.892497063f, 0.53830415f},
-std::array<float,2>{0.26101017f, 0.758895874f},
-std::array<float,2>{0.53667295f, 0.281490594f},
-std::array<float,2>{0.469031662f, 0.494155705f},
-std::array<float,2>{0.721355557f, 0.885909557f},
-std::array<float,2>{0.104081616f, 0.639551759f},
-std::array<float,2>{0.793183267f, 0.115770973f},
-std::array<float,2>{0.35893169f, 0.0386802517f},
-std::array<float,2>{0.573667765f, 0.720816672f},
-std::array<float,2>{0.188488647f, 0.962951958f},
-std::array<float,2>{0.996827602f, 0.42024979f},
-std::array<float,2>{0.0234523118f, 0.31834051f},
-std::array<float,2>{0.827430427f, 0.826368511f},
-std::array<float,2>{0.423045188f, 0.598808587f},
-std::array<float,2>{0.659510374f, 0.190810353f},
-std::array<float,2>{0.21105665f, 0.00631715311f},
-std::array<float,2>{0.974594712f, 0.692082167f},
-std::array<float,2>{0.360029131f, 0.970329523f},
-std::array<float,2>{0.589730144f, 0.377925038f},
-std::array<float,2>{0.409332633f, 0.364368141f},
-std::array<float,2>{0.676164925f, 0.846862257f},
-std::array<float,2>{0.00430503301f, 0.578448594f},
-std::array<float,2>{0.829040945f, 0.238925457f},
-std::array<float,2>{0.265780449f, 0.170400083f},
-std::array<float,2>{0.547203004f, 0.510603607f},
-std::array<float,2>{0.165421754f, 0.799600959f},
-std::array<float,2>{0.885694265f, 0.261657894f},
-std::array<float,2>{0.113849446f, 0.440038949f},
-std::array<float,2>{0.800987363f, 0.90784955f},
-std::array<float,2>{0.498788446f, 0.662026167f},
-std::array<float,2>{0.747017741f, 0.0793909207f},
-std::array<float,2>{0.0556625985f, 0.207274944f},
-std::array<float,2>{0.851400554f, 0.619667888f},
-std::array<float,2>{0.39230302f, 0.831646621f},
-std::array<float,2>{0.654864967f, 0.332012236f},
-std::array<float,2>{0.327811629f, 0.43547222f},
-std::array<float,2>{0.597230971f, 0.942129374f},
-std::array<float,2>{0.230775088f, 0.747412801f},
-std::array<float,2>{0.95468539f, 0.0506272353f},
-std::array<float,2>{0.451185197f, 0.10290014f},
-std::array<float,2>{0.715897381f, 0.655993342f},
-std::array<float,2>{0.0891597271f, 0.892555714f},
-std::array<float,2>{0.763327181f, 0.46940887f},
-std::array<float,2>{0.142555133f, 0.297316492f},
-std::array<float,2>{0.930579364f, 0.770194173f},
-std::array<float,2>{0.282733828f, 0.547023892f},
-std::array<float,2>{0.514959097f, 0.139234647f},
-std::array<float,2>{0.0136948079f, 0.0553858727f},
-std::array<float,2>{0.842266858f, 0.74019593f},
-std::array<float,2>{0.42136234f, 0.949001968f},
-std::array<float,2>{0.682332456f, 0.427909136f},
-std::array<float,2>{0.371195704f, 0.33946681f},
-std::array<float,2>{0.582405567f, 0.83916527f},
-std::array<float,2>{0.20989424f, 0.612622976f},
-std::array<float,2>{0.97991246f, 0.215162396f},
-std::array<float,2>{0.487276882f, 0.128815562f},
-std::array<float,2>{0.739813685f, 0.560780227f},
-std::array<float,2>{0.121231541f, 0.775841355f},
-std::array<float,2>{0.808730423f, 0.307814419f},
-std::array<float,2>{0.163866028f, 0.48284927f},
-std::array<float,2>{0.879874051f, 0.904669881f},
-std::array<float,2>{0.277660638f, 0.641868055f},
-std::array<float,2>{0.557923615f, 0.10084521f},
-std::array<float,2>{0.222145066f, 0.24693346f},
-std::array<float,2>{0.967672944f, 0.587126195f},
-std::array<float,2>{0.315780222f, 0.85540396f},
-std::array<float,2>{0.604005873f, 0.372945189f},
-std::array<float,2>{0.406234622f, 0.38930577f},
-std::array<float,2>{0.641307116f, 0.977942765f},
-std::array<float,2>{0.0540141091f, 0.70150429f},
-std::array<float,2>{0.859132946f, 0.00984495319f},
-std::array<float,2>{0.289229482f, 0.0872996375f},
-std::array<float,2>{0.505132258f, 0.665261269f},
-std::array<float,2>{0.150436893f, 0.919743061f},
-std::array<float,2>{0.925942659f, 0.452623963f},
-std::array<float,2>{0.0850795954f, 0.254549921f},
-std::array<float,2>{0.752580106f, 0.810456932f},
-std::array<float,2>{0.443087965f, 0.504400551f},
-std::array<float,2>{0.710204482f, 0.161702693f},
-std::array<float,2>{0.134583667f, 0.118825227f},
-std::array<float,2>{0.919347703f, 0.628455937f},
-std::array<float,2>{0.306114346f, 0.880663395f},
-std::array<float,2>{0.525062621f, 0.488429129f},
-std::array<float,2>{0.457758754f, 0.290001631f},
-std::array<float,2>{0.69107151f, 0.757646382f},
-std::array<float,2>{0.0727057979f, 0.544874787f},
-std::array<float,2>{0.779786408f, 0.153634623f},
-std::array<float,2>{0.342736036f, 0.19873552f},
-std::array<float,2>{0.615980983f, 0.608567119f},
-std::array<float,2>{0.241379336f, 0.820052743f},
-std::array<float,2>{0.940424323f, 0.32594502f},
-std::array<float,2>{0.0383276157f, 0.411068797f},
-std::array<float,2>{0.86466682f, 0.958858609f},
-std::array<float,2>{0.385108322f, 0.729216874f},
-std::array<float,2>{0.6346668f, 0.0442691892f},
-std::array<float,2>{0.0994471237f, 0.181087852f},
-std::array<float,2>{0.781927049f, 0.526398778f},
-std::array<float,2>{0.477499545f, 0.785410464f},
-std::array<float,2>{0.728068113f, 0.268870592f},
-std::array<float,2>{0.252497524f, 0.461680174f},
-std::array<float,2>{0.542401671f, 0.929355025f},
-std::array<float,2>{0.17300643f, 0.679502904f},
-std::array<float,2>{0.905189216f, 0.073921755f},
-std::array<float,2>{0.431244791f, 0.0218760967f},
-std::array<float,2>{0.665157735f, 0.707995057f},
-std::array<float,2>{0.0201457571f, 0.988615155f},
-std::array<float,2>{0.818643749f, 0.401886046f},
-std::array<float,2>{0.198768288f, 0.345392734f},
-std::array<float,2>{0.984904528f, 0.862767637f},
-std::array<float,2>{0.34454006f, 0.572482646f},
-std::array<float,2>{0.568761468f, 0.220446572f},
-std::array<float,2>{0.119898789f, 0.0256565548f},
-std::array<float,2>{0.806724489f, 0.718358755f},
-std::array<float,2>{0.491146535f, 0.993629754f},
-std::array<float,2>{0.737762272f, 0.397550464f},
-std::array<float,2>{0.276317984f, 0.358372629f},
-std::array<float,2>{0.562131226f, 0.870873988f},
-std::array<float,2>{0.160026386f, 0.56363529f},
-std::array<float,2>{0.878667951f, 0.233966142f},
-std::array<float,2>{0.416277647f, 0.177343696f},
-std::array<float,2>{0.684969068f, 0.523271203f},
-std::array<float,2>{0.00831846613f, 0.795840561f},
-std::array<float,2>{0.838671684f, 0.277873904f},
-std::array<float,2>{0.204832345f, 0.459052145f},
-std::array<float,2>{0.981995106f, 0.937031507f},
-std::array<float,2>{0.367490977f, 0.682872593f},
-std::array<float,2>{0.579653919f, 0.0647466406f},
-std::array<float,2>{0.15363957f, 0.194464877f},
-std::array<float,2>{0.923341155f, 0.594844282f},
-std::array<float,2>{0.296630263f, 0.823085308f},
-std::array<float,2>{0.501660168f, 0.314118803f},
-std::array<float,2>{0.441206753f, 0.415348977f},
-std::array<float,2>{0.706080198f, 0.965971053f},
-std::array<float,2>{0.0796270818f, 0.72450459f},
-std::array<float,2>{0.755414128f, 0.034204904f},
-std::array<float,2>{0.317248106f, 0.11129576f},
-std::array<float,2>{0.606652379f, 0.634498358f},
-std::array<float,2>{0.224450052f, 0.888967276f},
-std::array<float,2>{0.964636505f, 0.497068405f},
-std::array<float,2>{0.0472489893f, 0.286145955f},
-std::array<float,2>{0.855394185f, 0.763842702f},
-std::array<float,2>{0.402190626f, 0.534356594f},
-std::array<float,2>{0.647567391f, 0.141210228f},
-std::array<float,2>{0.236255363f, 0.0849347934f},
-std::array<float,2>{0.941587448f, 0.657008111f},
-std::array<float,2>{0.338933229f, 0.913318932f},
-std::array<float,2>{0.611752272f, 0.44524616f},
-std::array<float,2>{0.387579739f, 0.262665212f},
-std::array<float,2>{0.637128055f, 0.802043259f},
-std::array<float,2>{0.0351361148f, 0.512986064f},
-std::array<float,2>{0.861254692f, 0.167794228f},
-std::array<float,2>{0.30906564f, 0.234531805f},
-std::array<float,2>{0.52874136f, 0.583177328f},
-std::array<float,2>{0.136937127f, 0.849241972f},
-std::array<float,2>{0.917139947f, 0.361242145f},
-std::array<float,2>{0.0752776191f, 0.382633686f},
-std::array<float,2>{0.777176201f, 0.975718975f},
-std::array<float,2>{0.456301242f, 0.689993501f},
-std::array<float,2>{0.694720507f, 0.000760294148f},
-std::array<float,2>{0.0186828449f, 0.134627104f},
-std::array<float,2>{0.815880775f, 0.55458951f},
-std::array<float,2>{0.435406029f, 0.76815927f},
-std::array<float,2>{0.669187844f, 0.301426291f},
-std::array<float,2>{0.348135322f, 0.476121396f},
-std::array<float,2>{0.562604725f, 0.898049474f},
-std::array<float,2>{0.199354962f, 0.649573684f},
-std::array<float,2>{0.988376796f, 0.108928293f},
-std::array<float,2>{0.483560383f, 0.0515355729f},
-std::array<float,2>{0.73184967f, 0.745791912f},
-std::array<float,2>{0.0946742147f, 0.938794136f},
-std::array<float,2>{0.785173655f, 0.432878673f},
-std::array<float,2>{0.17659159f, 0.332784832f},
-std::array<float,2>{0.899334073f, 0.833077371f},
-std::array<float,2>{0.256019682f, 0.624161363f},
-std::array<float,2>{0.545541108f, 0.206277624f},
-std::array<float,2>{0.0416113436f, 0.0957786068f},
-std::array<float,2>{0.867434859f, 0.646849096f},
-std::array<float,2>{0.378676713f, 0.90034157f},
-std::array<float,2>{0.627955914f, 0.480285913f},
-std::array<float,2>{0.335249931f, 0.310310155f},
-std::array<float,2>{0.623101473f, 0.778456032f},
-std::array<float,2>{0.245817572f, 0.555888832f},
-std::array<float,2>{0.948930144f, 0.131384134f},
-std::array<float,2>{0.467703193f, 0.213079467f},
-std::array<float,2>{0.695432305f, 0.616086364f},
-std::array<float,2>{0.0678822026f, 0.840299785f},
-std::array<float,2>{0.766030371f, 0.342617989f},
-std::array<float,2>{0.126661167f, 0.425733835f},
-std::array<float,2>{0.906332374f, 0.949581623f},
-std::array<float,2>{0.298893213f, 0.734891713f},
-std::array<float,2>{0.521355331f, 0.0611985661f},
-std::array<float,2>{0.191541106f, 0.158970207f},
-std::array<float,2>{0.994433522f, 0.503538311f},
-std::array<float,2>{0.353905827f, 0.805866182f},
-std::array<float,2>{0.577361941f, 0.25007686f},
-std::array<float,2>{0.427922338f, 0.44537282f},
-std::array<float,2>{0.663284719f, 0.91793257f},
-std::array<float,2>{0.0279091354f, 0.671199203f},
-std::array<float,2>{0.821732998f, 0.092542164f},
-std::array<float,2>{0.262984663f, 0.0152991749f},
-std::array<float,2>{0.533210993f, 0.696239531f},
-std::array<float,2>{0.182139724f, 0.981244206f},
-std::array<float,2>{0.894742191f, 0.38336274f},
-std::array<float,2>{0.108569548f, 0.371078044f},
-std::array<float,2>{0.792067409f, 0.859098077f},
-std::array<float,2>{0.473121047f, 0.592679143f},
-std::array<float,2>{0.724463165f, 0.245504484f},
-std::array<float,2>{0.169541672f, 0.0415659212f},
-std::array<float,2>{0.88863349f, 0.734221578f},
-std::array<float,2>{0.271293908f, 0.954261482f},
-std::array<float,2>{0.553606033f, 0.409039319f},
-std::array<float,2>{0.495581567f, 0.323473632f},
-std::array<float,2>{0.745357335f, 0.814137518f},
-std::array<float,2>{0.109408155f, 0.603444159f},
-std::array<float,2>{0.800273001f, 0.199840009f},
-std::array<float,2>{0.363355964f, 0.150265276f},
-std::array<float,2>{0.590628266f, 0.54136163f},
-std::array<float,2>{0.217027828f, 0.750486612f},
-std::array<float,2>{0.970129371f, 0.295567423f},
-std::array<float,2>{0.000742349715f, 0.487304717f},
-std::array<float,2>{0.83251214f, 0.876100183f},
-std::array<float,2>{0.412714958f, 0.630840659f},
-std::array<float,2>{0.673419714f, 0.122504994f},
-std::array<float,2>{0.0931513831f, 0.223202616f},
-std::array<float,2>{0.76056999f, 0.577719271f},
-std::array<float,2>{0.448006362f, 0.86591208f},
-std::array<float,2>{0.713212729f, 0.351056993f},
-std::array<float,2>{0.28662625f, 0.404504359f},
-std::array<float,2>{0.511320472f, 0.9848333f},
-std::array<float,2>{0.147252277f, 0.706267893f},
-std::array<float,2>{0.934262753f, 0.0161726642f},
-std::array<float,2>{0.396916777f, 0.0777717531f},
-std::array<float,2>{0.651574731f, 0.672176123f},
-std::array<float,2>{0.0613417849f, 0.922659218f},
-std::array<float,2>{0.845021248f, 0.468557477f},
-std::array<float,2>{0.228108332f, 0.27238065f},
-std::array<float,2>{0.960683525f, 0.781877279f},
-std::array<float,2>{0.32086435f, 0.52848655f},
-std::array<float,2>{0.598477721f, 0.183597296f},
-std::array<float,2>{0.103192329f, 0.113544703f},
-std::array<float,2>{0.795936048f, 0.638324559f},
-std::array<float,2>{0.471631259f, 0.883505404f},
-std::array<float,2>{0.71886462f, 0.493522078f},
-std::array<float,2>{0.258794397f, 0.284935057f},
-std::array<float,2>{0.538766026f, 0.760127604f},
-std::array<float,2>{0.186262354f, 0.537074327f},
-std::array<float,2>{0.893399417f, 0.148342967f},
-std::array<float,2>{0.425184131f, 0.188880786f},
-std::array<float,2>{0.656952441f, 0.599851191f},
-std::array<float,2>{0.0270918403f, 0.825263917f},
-std::array<float,2>{0.826113939f, 0.319562912f},
-std::array<float,2>{0.190912023f, 0.418623924f},
-std::array<float,2>{0.99899286f, 0.961643398f},
-std::array<float,2>{0.357412279f, 0.720207691f},
-std::array<float,2>{0.571663141f, 0.0355383158f},
-std::array<float,2>{0.129534632f, 0.172048822f},
-std::array<float,2>{0.910176814f, 0.519028544f},
-std::array<float,2>{0.303252697f, 0.792838216f},
-std::array<float,2>{0.516135454f, 0.277047127f},
-std::array<float,2>{0.464354247f, 0.456650436f},
-std::array<float,2>{0.702914119f, 0.932368398f},
-std::array<float,2>{0.0629762188f, 0.686702192f},
-std::array<float,2>{0.771439195f, 0.0680350363f},
-std::array<float,2>{0.329553604f, 0.0300020464f},
-std::array<float,2>{0.617374659f, 0.712425411f},
-std::array<float,2>{0.248154223f, 0.996803522f},
-std::array<float,2>{0.950681925f, 0.39297381f},
-std::array<float,2>{0.0441622064f, 0.35520041f},
-std::array<float,2>{0.874650538f, 0.871365309f},
-std::array<float,2>{0.382294327f, 0.569481432f},
-std::array<float,2>{0.632171392f, 0.227992624f},
-std::array<float,2>{0.233569011f, 0.0479874648f},
-std::array<float,2>{0.955997944f, 0.749564409f},
-std::array<float,2>{0.324274004f, 0.943747699f},
-std::array<float,2>{0.595018387f, 0.437489033f},
-std::array<float,2>{0.394102752f, 0.329271197f},
-std::array<float,2>{0.652937055f, 0.829818845f},
-std::array<float,2>{0.0571980849f, 0.617677808f},
-std::array<float,2>{0.848524451f, 0.209841773f},
-std::array<float,2>{0.284741551f, 0.136768311f},
-std::array<float,2>{0.512784719f, 0.550595701f},
-std::array<float,2>{0.142893776f, 0.771556199f},
-std::array<float,2>{0.932320952f, 0.299588084f},
-std::array<float,2>{0.0865987167f, 0.4724271f},
-std::array<float,2>{0.765127897f, 0.893660605f},
-std::array<float,2>{0.450606078f, 0.654058278f},
-std::array<float,2>{0.717898548f, 0.104023606f},
-std::array<float,2>{0.00762922177f, 0.242055923f},
-std::array<float,2>{0.830606699f, 0.582015812f},
-std::array<float,2>{0.406375974f, 0.84476918f},
-std::array<float,2>{0.678628147f, 0.366719961f},
-std::array<float,2>{0.361450553f, 0.376681507f},
-std::array<float,2>{0.587170839f, 0.972019136f},
-std::array<float,2>{0.214343116f, 0.693591237f},
-std::array<float,2>{0.974804282f, 0.00506935874f},
-std::array<float,2>{0.497990519f, 0.0814731121f},
-std::array<float,2>{0.748543203f, 0.663427234f},
-std::array<float,2>{0.116665348f, 0.908373296f},
-std::array<float,2>{0.804321527f, 0.437517822f},
-std::array<float,2>{0.166777089f, 0.259118646f},
-std::array<float,2>{0.883593738f, 0.798733056f},
-std::array<float,2>{0.268796951f, 0.509144366f},
-std::array<float,2>{0.548938811f, 0.169687316f},
-std::array<float,2>{0.0516542606f, 0.00851374678f},
-std::array<float,2>{0.855932951f, 0.700644553f},
-std::array<float,2>{0.402427703f, 0.980312169f},
-std::array<float,2>{0.642690957f, 0.388500065f},
-std::array<float,2>{0.313150465f, 0.373526514f},
-std::array<float,2>{0.602542162f, 0.852600634f},
-std::array<float,2>{0.218842998f, 0.589661181f},
-std::array<float,2>{0.964884043f, 0.248624027f},
-std::array<float,2>{0.444000036f, 0.162971169f},
-std::array<float,2>{0.708415747f, 0.50632751f},
-std::array<float,2>{0.0831796154f, 0.811963022f},
-std::array<float,2>{0.75115639f, 0.256370872f},
-std::array<float,2>{0.150078341f, 0.44937411f},
-std::array<float,2>{0.928384483f, 0.921384275f},
-std::array<float,2>{0.292678595f, 0.667048395f},
-std::array<float,2>{0.506671011f, 0.089689821f},
-std::array<float,2>{0.208826438f, 0.217082232f},
-std::array<float,2>{0.977527857f, 0.609670222f},
-std::array<float,2>{0.3737939f, 0.836815357f},
-std::array<float,2>{0.585065067f, 0.337412477f},
-std::array<float,2>{0.418102533f, 0.427634656f},
-std::array<float,2>{0.679704845f, 0.945512474f},
-std::array<float,2>{0.01347588f, 0.741406083f},
-std::array<float,2>{0.8410182f, 0.057154797f},
-std::array<float,2>{0.279569626f, 0.0977283642f},
-std::array<float,2>{0.556579769f, 0.644151509f},
-std::array<float,2>{0.1605068f, 0.904059112f},
-std::array<float,2>{0.881404638f, 0.482275993f},
-std::array<float,2>{0.12433549f, 0.305010855f},
-std::array<float,2>{0.812401652f, 0.774588346f},
-std::array<float,2>{0.484950483f, 0.558713615f},
-std::array<float,2>{0.741769075f, 0.126621768f},
-std::array<float,2>{0.174776152f, 0.0715870783f},
-std::array<float,2>{0.90408814f, 0.676029146f},
-std::array<float,2>{0.251096308f, 0.926575422f},
-std::array<float,2>{0.539934814f, 0.464577466f},
-std::array<float,2>{0.478857815f, 0.265931964f},
-std::array<float,2>{0.730034828f, 0.788367987f},
-std::array<float,2>{0.100654259f, 0.525201678f},
-std::array<float,2>{0.784276783f, 0.183186561f},
-std::array<float,2>{0.346177131f, 0.221533313f},
-std::array<float,2>{0.568154275f, 0.570475698f},
-std::array<float,2>{0.19716467f, 0.860155702f},
-std::array<float,2>{0.987434924f, 0.346845448f},
-std::array<float,2>{0.0219615381f, 0.400127143f},
-std::array<float,2>{0.818132639f, 0.991981566f},
-std::array<float,2>{0.432000488f, 0.710612595f},
-std::array<float,2>{0.666840315f, 0.0208783727f},
-std::array<float,2>{0.0711477548f, 0.154917404f},
-std::array<float,2>{0.778246224f, 0.545536697f},
-std::array<float,2>{0.460277885f, 0.755323946f},
-std::array<float,2>{0.68841964f, 0.292048573f},
-std::array<float,2>{0.30728963f, 0.490297496f},
-std::array<float,2>{0.525558591f, 0.882020593f},
-std::array<float,2>{0.13587372f, 0.625161707f},
-std::array<float,2>{0.92069608f, 0.119567104f},
-std::array<float,2>{0.383004099f, 0.0451724604f},
-std::array<float,2>{0.635068357f, 0.727918744f},
-std::array<float,2>{0.0362682603f, 0.95995146f},
-std::array<float,2>{0.866284966f, 0.412942618f},
-std::array<float,2>{0.239681348f, 0.327615291f},
-std::array<float,2>{0.937927544f, 0.816894293f},
-std::array<float,2>{0.340494126f, 0.60574311f},
-std::array<float,2>{0.613569438f, 0.196626961f},
-std::array<float,2>{0.0816433057f, 0.0315911844f},
-std::array<float,2>{0.757311046f, 0.725257576f},
-std::array<float,2>{0.439395875f, 0.967344701f},
-std::array<float,2>{0.70355624f, 0.416883975f},
-std::array<float,2>{0.294820726f, 0.315285146f},
-std::array<float,2>{0.502924681f, 0.820810616f},
-std::array<float,2>{0.154597431f, 0.596873999f},
-std::array<float,2>{0.925428212f, 0.193201035f},
-std::array<float,2>{0.399067551f, 0.144129202f},
-std::array<float,2>{0.644631922f, 0.531265736f},
-std::array<float,2>{0.0490610749f, 0.762270749f},
-std::array<float,2>{0.852118731f, 0.287447155f},
-std::array<float,2>{0.225725129f, 0.499269515f},
-std::array<float,2>{0.962782919f, 0.887357473f},
-std::array<float,2>{0.319697469f, 0.634956062f},
-std::array<float,2>{0.608597219f, 0.112142466f},
-std::array<float,2>{0.156540856f, 0.231621772f},
-std::array<float,2>{0.876043379f, 0.566058278f},
-std::array<float,2>{0.274112374f, 0.868833125f},
-std::array<float,2>{0.560490072f, 0.355686605f},
-std::array<float,2>{0.489835232f, 0.395427346f},
-std::array<float,2>{0.734620094f, 0.995199502f},
-std::array<float,2>{0.11870262f, 0.715386868f},
-std::array<float,2>{0.805019677f, 0.0252604131f},
-std::array<float,2>{0.36987716f, 0.0631328449f},
-std::array<float,2>{0.580974936f, 0.679791152f},
-std::array<float,2>{0.206163004f, 0.934216976f},
-std::array<float,2>{0.983013511f, 0.457881451f},
-std::array<float,2>{0.0103576751f, 0.280280918f},
-std::array<float,2>{0.837258041f, 0.79478997f},
-std::array<float,2>{0.414509863f, 0.520815611f},
-std::array<float,2>{0.686574042f, 0.178986698f},
-std::array<float,2>{0.202635556f, 0.106478564f},
-std::array<float,2>{0.991647482f, 0.651699424f},
-std::array<float,2>{0.350389659f, 0.895371079f},
-std::array<float,2>{0.565865278f, 0.474222064f},
-std::array<float,2>{0.43724519f, 0.30365932f},
-std::array<float,2>{0.671471f, 0.766593754f},
-std::array<float,2>{0.0165415108f, 0.551731467f},
-std::array<float,2>{0.814135432f, 0.135718778f},
-std::array<float,2>{0.254424274f, 0.204873502f},
-std::array<float,2>{0.543603122f, 0.621998608f},
-std::array<float,2>{0.177803725f, 0.835432172f},
-std::array<float,2>{0.90111202f, 0.335642666f},
-std::array<float,2>{0.0960377976f, 0.430309206f},
-std::array<float,2>{0.78863287f, 0.939564288f},
-std::array<float,2>{0.481111437f, 0.742329597f},
-std::array<float,2>{0.733174145f, 0.0532332547f},
-std::array<float,2>{0.0316848159f, 0.164384276f},
-std::array<float,2>{0.862242877f, 0.515054822f},
-std::array<float,2>{0.389907897f, 0.802772999f},
-std::array<float,2>{0.639273286f, 0.264142513f},
-std::array<float,2>{0.337066472f, 0.442276865f},
-std::array<float,2>{0.610507905f, 0.911200404f},
-std::array<float,2>{0.237299755f, 0.658904552f},
-std::array<float,2>{0.943958521f, 0.0823388621f},
-std::array<float,2>{0.45369333f, 0.00258816592f},
-std::array<float,2>{0.691745281f, 0.6875844f},
-std::array<float,2>{0.0773603693f, 0.973407507f},
-std::array<float,2>{0.774234533f, 0.380342662f},
-std::array<float,2>{0.138826251f, 0.362755835f},
-std::array<float,2>{0.915514708f, 0.850368202f},
-std::array<float,2>{0.310633749f, 0.583996832f},
-std::array<float,2>{0.530989349f, 0.236437097f},
-std::array<float,2>{0.0293334108f, 0.0915410742f},
-std::array<float,2>{0.824161053f, 0.669310153f},
-std::array<float,2>{0.427562624f, 0.91509217f},
-std::array<float,2>{0.660979986f, 0.447284132f},
-std::array<float,2>{0.35258916f, 0.252578348f},
-std::array<float,2>{0.575993359f, 0.806790709f},
-std::array<float,2>{0.194674015f, 0.501314759f},
-std::array<float,2>{0.993992746f, 0.156525791f},
-std::array<float,2>{0.47474432f, 0.243944794f},
-std::array<float,2>{0.726033092f, 0.590774655f},
-std::array<float,2>{0.107030086f, 0.855647683f},
-std::array<float,2>{0.790752709f, 0.367681473f},
-std::array<float,2>{0.180267259f, 0.385997117f},
-std::array<float,2>{0.897105753f, 0.984374344f},
-std::array<float,2>{0.26388222f, 0.697803259f},
-std::array<float,2>{0.531672895f, 0.013288781f},
-std::array<float,2>{0.242193624f, 0.130785882f},
-std::array<float,2>{0.946375072f, 0.558480382f},
-std::array<float,2>{0.332922429f, 0.779880524f},
-std::array<float,2>{0.622662485f, 0.31123209f},
-std::array<float,2>{0.376600474f, 0.478168815f},
-std::array<float,2>{0.626616776f, 0.901074886f},
-std::array<float,2>{0.0400888734f, 0.645451665f},
-std::array<float,2>{0.870969892f, 0.0946950763f},
-std::array<float,2>{0.298739135f, 0.0588310473f},
-std::array<float,2>{0.522558212f, 0.736594379f},
-std::array<float,2>{0.127975225f, 0.951550543f},
-std::array<float,2>{0.908503413f, 0.422997296f},
-std::array<float,2>{0.0685662627f, 0.34120971f},
-std::array<float,2>{0.767691433f, 0.843014777f},
-std::array<float,2>{0.466189265f, 0.61484009f},
-std::array<float,2>{0.697741091f, 0.211275652f},
-std::array<float,2>{0.144845396f, 0.0178999081f},
-std::array<float,2>{0.936624706f, 0.704756856f},
-std::array<float,2>{0.287939817f, 0.98777014f},
-std::array<float,2>{0.508388519f, 0.402894676f},
-std::array<float,2>{0.446925253f, 0.347697198f},
-std::array<float,2>{0.711744845f, 0.864125609f},
-std::array<float,2>{0.0906593129f, 0.576058924f},
-std::array<float,2>{0.758220732f, 0.225896433f},
-std::array<float,2>{0.322368681f, 0.185884506f},
-std::array<float,2>{0.599748552f, 0.530666351f},
-std::array<float,2>{0.22865662f, 0.78430748f},
-std::array<float,2>{0.958087325f, 0.271443188f},
-std::array<float,2>{0.0599564388f, 0.465157866f},
-std::array<float,2>{0.84687227f, 0.924619853f},
-std::array<float,2>{0.395816982f, 0.674068153f},
-std::array<float,2>{0.648807287f, 0.0744114295f},
-std::array<float,2>{0.111675225f, 0.201561958f},
-std::array<float,2>{0.79752636f, 0.603888094f},
-std::array<float,2>{0.493491471f, 0.815673888f},
-std::array<float,2>{0.74322778f, 0.322149515f},
-std::array<float,2>{0.272234261f, 0.408094794f},
-std::array<float,2>{0.551754177f, 0.955912769f},
-std::array<float,2>{0.169926211f, 0.730855107f},
-std::array<float,2>{0.890081644f, 0.0400566384f},
-std::array<float,2>{0.410678208f, 0.124063157f},
-std::array<float,2>{0.675249696f, 0.631523371f},
-std::array<float,2>{0.00351318414f, 0.877583921f},
-std::array<float,2>{0.834498584f, 0.485271305f},
-std::array<float,2>{0.216535985f, 0.294090092f},
-std::array<float,2>{0.972541809f, 0.75287354f},
-std::array<float,2>{0.365423203f, 0.540263474f},
-std::array<float,2>{0.59190619f, 0.150723562f},
-std::array<float,2>{0.117902994f, 0.0646829903f},
-std::array<float,2>{0.805713236f, 0.682780743f},
-std::array<float,2>{0.488668293f, 0.937401414f},
-std::array<float,2>{0.736132622f, 0.459355175f},
-std::array<float,2>{0.274648249f, 0.278229058f},
-std::array<float,2>{0.558972478f, 0.795528769f},
-std::array<float,2>{0.157862797f, 0.523083389f},
-std::array<float,2>{0.87507391f, 0.177624583f},
-std::array<float,2>{0.415926546f, 0.234325156f},
-std::array<float,2>{0.685584724f, 0.563921988f},
-std::array<float,2>{0.0107811838f, 0.87071085f},
-std::array<float,2>{0.835956812f, 0.357917875f},
-std::array<float,2>{0.205838725f, 0.397817135f},
-std::array<float,2>{0.983795762f, 0.99322021f},
-std::array<float,2>{0.370711535f, 0.718671501f},
-std::array<float,2>{0.581262112f, 0.0255145971f},
-std::array<float,2>{0.155712336f, 0.141439945f},
-std::array<float,2>{0.924409866f, 0.534535289f},
-std::array<float,2>{0.293691754f, 0.764142156f},
-std::array<float,2>{0.502942443f, 0.28644523f},
-std::array<float,2>{0.4384363f, 0.496599019f},
-std::array<float,2>{0.704909205f, 0.88886112f},
-std::array<float,2>{0.0803655088f, 0.634711623f},
-std::array<float,2>{0.756810844f, 0.111080199f},
-std::array<float,2>{0.318482697f, 0.0345183015f},
-std::array<float,2>{0.608329713f, 0.724263132f},
-std::array<float,2>{0.225172073f, 0.966183245f},
-std::array<float,2>{0.961667538f, 0.415157288f},
-std::array<float,2>{0.0501978807f, 0.314361244f},
-std::array<float,2>{0.853075087f, 0.822938919f},
-std::array<float,2>{0.399475664f, 0.595115066f},
-std::array<float,2>{0.646367788f, 0.194604754f},
-std::array<float,2>{0.237665355f, 0.000490973936f},
-std::array<float,2>{0.945097387f, 0.69028002f},
-std::array<float,2>{0.336039037f, 0.975933313f},
-std::array<float,2>{0.609752059f, 0.382422328f},
-std::array<float,2>{0.389484942f, 0.360993594f},
-std::array<float,2>{0.64034462f, 0.84951365f},
-std::array<float,2>{0.0325080082f, 0.583432078f},
-std::array<float,2>{0.863242209f, 0.23482497f},
-std::array<float,2>{0.312214196f, 0.167581931f},
-std::array<float,2>{0.530091524f, 0.512833059f},
-std::array<float,2>{0.140378222f, 0.80175972f},
-std::array<float,2>{0.914665222f, 0.262424856f},
-std::array<float,2>{0.0765427053f, 0.445034504f},
-std::array<float,2>{0.774903297f, 0.913391769f},
-std::array<float,2>{0.454996228f, 0.656839967f},
-std::array<float,2>{0.693145931f, 0.0846889839f},
-std::array<float,2>{0.016698895f, 0.20630458f},
-std::array<float,2>{0.813474834f, 0.624377549f},
-std::array<float,2>{0.43601194f, 0.833392918f},
-std::array<float,2>{0.670646369f, 0.332571507f},
-std::array<float,2>{0.350781143f, 0.432702601f},
-std::array<float,2>{0.564815402f, 0.938544989f},
-std::array<float,2>{0.201222479f, 0.745908201f},
-std::array<float,2>{0.990876615f, 0.0513983853f},
-std::array<float,2>{0.482386976f, 0.109151088f},
-std::array<float,2>{0.733663082f, 0.649733305f},
-std::array<float,2>{0.0968435705f, 0.898350418f},
-std::array<float,2>{0.787952185f, 0.476484358f},
-std::array<float,2>{0.179099932f, 0.301657557f},
-std::array<float,2>{0.901789188f, 0.768502116f},
-std::array<float,2>{0.255848736f, 0.554401577f},
-std::array<float,2>{0.544531584f, 0.13430275f},
-std::array<float,2>{0.039726153f, 0.0614735968f},
-std::array<float,2>{0.869144261f, 0.735283077f},
-std::array<float,2>{0.375204057f, 0.949411869f},
-std::array<float,2>{0.625197232f, 0.425334811f},
-std::array<float,2>{0.333416432f, 0.342484683f},
-std::array<float,2>{0.621640861f, 0.83990413f},
-std::array<float,2>{0.243390635f, 0.615752697f},
-std::array<float,2>{0.945411682f, 0.213145688f},
-std::array<float,2>{0.465047061f, 0.131833434f},
-std::array<float,2>{0.699162304f, 0.556078672f},
-std::array<float,2>{0.0701453835f, 0.778588355f},
-std::array<float,2>{0.768968165f, 0.310140729f},
-std::array<float,2>{0.127667412f, 0.480178833f},
-std::array<float,2>{0.90969348f, 0.89999789f},
-std::array<float,2>{0.297441095f, 0.646664381f},
-std::array<float,2>{0.521745384f, 0.096100606f},
-std::array<float,2>{0.194036022f, 0.245153412f},
-std::array<float,2>{0.992712796f, 0.592525661f},
-std::array<float,2>{0.352082998f, 0.859303951f},
-std::array<float,2>{0.575179875f, 0.37067014f},
-std::array<float,2>{0.426439822f, 0.383627504f},
-std::array<float,2>{0.661759317f, 0.981073558f},
-std::array<float,2>{0.0311244279f, 0.695829093f},
-std::array<float,2>{0.822953761f, 0.0154301617f},
-std::array<float,2>{0.264845073f, 0.0923912227f},
-std::array<float,2>{0.532633126f, 0.670973837f},
-std::array<float,2>{0.181300998f, 0.917621434f},
-std::array<float,2>{0.897713542f, 0.445674866f},
-std::array<float,2>{0.106369786f, 0.250312686f},
-std::array<float,2>{0.789633989f, 0.806079924f},
-std::array<float,2>{0.476176471f, 0.503756404f},
-std::array<float,2>{0.725308597f, 0.158890978f},
-std::array<float,2>{0.170946941f, 0.122211725f},
-std::array<float,2>{0.889642477f, 0.630437791f},
-std::array<float,2>{0.273148984f, 0.876247108f},
-std::array<float,2>{0.551848352f, 0.487616181f},
-std::array<float,2>{0.492456228f, 0.295710772f},
-std::array<float,2>{0.742386281f, 0.750151455f},
-std::array<float,2>{0.112767719f, 0.541095853f},
-std::array<float,2>{0.798080742f, 0.150137633f},
-std::array<float,2>{0.366470903f, 0.200160474f},
-std::array<float,2>{0.593718469f, 0.603030443f},
-std::array<float,2>{0.215614825f, 0.814397573f},
-std::array<float,2>{0.970913291f, 0.323701769f},
-std::array<float,2>{0.00237914245f, 0.408750445f},
-std::array<float,2>{0.835829318f, 0.954479456f},
-std::array<float,2>{0.411436975f, 0.733973801f},
-std::array<float,2>{0.674355507f, 0.0417823195f},
-std::array<float,2>{0.09125714f, 0.183910787f},
-std::array<float,2>{0.759593368f, 0.528680205f},
-std::array<float,2>{0.445946068f, 0.781989515f},
-std::array<float,2>{0.712011814f, 0.272075325f},
-std::array<float,2>{0.288456827f, 0.468488842f},
-std::array<float,2>{0.509329379f, 0.922460914f},
-std::array<float,2>{0.145688251f, 0.672028899f},
-std::array<float,2>{0.936203301f, 0.0779579133f},
-std::array<float,2>{0.394681841f, 0.0165737439f},
-std::array<float,2>{0.649784148f, 0.706362128f},
-std::array<float,2>{0.0595638081f, 0.98457408f},
-std::array<float,2>{0.846351743f, 0.404734343f},
-std::array<float,2>{0.230061397f, 0.350748837f},
-std::array<float,2>{0.95780462f, 0.866067648f},
-std::array<float,2>{0.323913604f, 0.578002036f},
-std::array<float,2>{0.600683987f, 0.22340335f},
-std::array<float,2>{0.0640659779f, 0.029033171f},
-std::array<float,2>{0.769681513f, 0.71313715f},
-std::array<float,2>{0.463784188f, 0.999928296f},
-std::array<float,2>{0.701637506f, 0.392322809f},
-std::array<float,2>{0.304001421f, 0.353214204f},
-std::array<float,2>{0.516871929f, 0.874101877f},
-std::array<float,2>{0.130279988f, 0.568006992f},
-std::array<float,2>{0.911749303f, 0.229748249f},
-std::array<float,2>{0.381378055f, 0.174607694f},
-std::array<float,2>{0.631320238f, 0.516752362f},
-std::array<float,2>{0.0436462015f, 0.790702283f},
-std::array<float,2>{0.873329699f, 0.275344014f},
-std::array<float,2>{0.249658555f, 0.453409255f},
-std::array<float,2>{0.949936867f, 0.93106401f},
-std::array<float,2>{0.328841776f, 0.68442899f},
-std::array<float,2>{0.618991852f, 0.0692897141f},
-std::array<float,2>{0.186840564f, 0.190491483f},
-std::array<float,2>{0.894292593f, 0.598931253f},
-std::array<float,2>{0.258298486f, 0.826618433f},
-std::array<float,2>{0.537525237f, 0.318076521f},
-std::array<float,2>{0.471906424f, 0.420149416f},
-std::array<float,2>{0.7202214f, 0.963229537f},
-std::array<float,2>{0.102190211f, 0.721168518f},
-std::array<float,2>{0.795105398f, 0.039014589f},
-std::array<float,2>{0.355720192f, 0.116140544f},
-std::array<float,2>{0.570882201f, 0.639342546f},
-std::array<float,2>{0.190414965f, 0.886079788f},
-std::array<float,2>{0.999264777f, 0.494423002f},
-std::array<float,2>{0.0258032214f, 0.281571984f},
-std::array<float,2>{0.825067639f, 0.759050429f},
-std::array<float,2>{0.424441904f, 0.538497627f},
-std::array<float,2>{0.657959342f, 0.145695478f},
-std::array<float,2>{0.213857099f, 0.0791204274f},
-std::array<float,2>{0.975847602f, 0.661821663f},
-std::array<float,2>{0.362593561f, 0.90820235f},
-std::array<float,2>{0.586296678f, 0.440367132f},
-std::array<float,2>{0.408168197f, 0.261282027f},
-std::array<float,2>{0.679167151f, 0.799541295f},
-std::array<float,2>{0.00649030693f, 0.510365427f},
-std::array<float,2>{0.831173658f, 0.169968262f},
-std::array<float,2>{0.268348187f, 0.239234731f},
-std::array<float,2>{0.550323188f, 0.57822299f},
-std::array<float,2>{0.16755195f, 0.847129166f},
-std::array<float,2>{0.884552419f, 0.364541322f},
-std::array<float,2>{0.116082251f, 0.377477735f},
-std::array<float,2>{0.803289711f, 0.97062248f},
-std::array<float,2>{0.496817201f, 0.692352891f},
-std::array<float,2>{0.749916971f, 0.00595287187f},
-std::array<float,2>{0.0577844456f, 0.139637873f},
-std::array<float,2>{0.849259675f, 0.547360778f},
-std::array<float,2>{0.392858326f, 0.770367324f},
-std::array<float,2>{0.654216528f, 0.296886474f},
-std::array<float,2>{0.326062173f, 0.46971941f},
-std::array<float,2>{0.594536364f, 0.892257094f},
-std::array<float,2>{0.23245196f, 0.656133235f},
-std::array<float,2>{0.956204176f, 0.102590434f},
-std::array<float,2>{0.449240506f, 0.0505140238f},
-std::array<float,2>{0.71683538f, 0.747151732f},
-std::array<float,2>{0.0874063149f, 0.942350209f},
-std::array<float,2>{0.764518082f, 0.435244441f},
-std::array<float,2>{0.143996388f, 0.331785351f},
-std::array<float,2>{0.933269203f, 0.831906021f},
-std::array<float,2>{0.283872575f, 0.619947374f},
-std::array<float,2>{0.51204592f, 0.207290173f},
-std::array<float,2>{0.0124045322f, 0.100659117f},
-std::array<float,2>{0.839853108f, 0.64177537f},
-std::array<float,2>{0.419059664f, 0.90447855f},
-std::array<float,2>{0.681299806f, 0.482495338f},
-std::array<float,2>{0.374991059f, 0.307911038f},
-std::array<float,2>{0.584297001f, 0.775539398f},
-std::array<float,2>{0.20730862f, 0.560821831f},
-std::array<float,2>{0.978194833f, 0.128452003f},
-std::array<float,2>{0.485944659f, 0.214858711f},
-std::array<float,2>{0.741184294f, 0.612513304f},
-std::array<float,2>{0.123391837f, 0.839019477f},
-std::array<float,2>{0.810687959f, 0.339676768f},
-std::array<float,2>{0.161862969f, 0.428158581f},
-std::array<float,2>{0.882082939f, 0.948789656f},
-std::array<float,2>{0.280528754f, 0.739971042f},
-std::array<float,2>{0.555556357f, 0.0554785468f},
-std::array<float,2>{0.2199471f, 0.161992684f},
-std::array<float,2>{0.966630876f, 0.50478965f},
-std::array<float,2>{0.314233482f, 0.810157597f},
-std::array<float,2>{0.602324367f, 0.254750252f},
-std::array<float,2>{0.403398752f, 0.452348381f},
-std::array<float,2>{0.643596232f, 0.919547975f},
-std::array<float,2>{0.0518660918f, 0.665509999f},
-std::array<float,2>{0.857313335f, 0.0871029198f},
-std::array<float,2>{0.291043878f, 0.0102360779f},
-std::array<float,2>{0.507086337f, 0.701203346f},
-std::array<float,2>{0.148949564f, 0.977580786f},
-std::array<float,2>{0.929634929f, 0.38958931f},
-std::array<float,2>{0.0827454403f, 0.37267223f},
-std::array<float,2>{0.750398219f, 0.855065525f},
-std::array<float,2>{0.444437206f, 0.587364376f},
-std::array<float,2>{0.707197428f, 0.246677488f},
-std::array<float,2>{0.135127172f, 0.0441074185f},
-std::array<float,2>{0.920971215f, 0.729337931f},
-std::array<float,2>{0.308222353f, 0.958661377f},
-std::array<float,2>{0.52686584f, 0.410711557f},
-std::array<float,2>{0.459420383f, 0.325876504f},
-std::array<float,2>{0.68944782f, 0.820151687f},
-std::array<float,2>{0.0720887631f, 0.608811796f},
-std::array<float,2>{0.778558016f, 0.199148804f},
-std::array<float,2>{0.341169208f, 0.153380573f},
-std::array<float,2>{0.61475116f, 0.544537961f},
-std::array<float,2>{0.239052176f, 0.757327974f},
-std::array<float,2>{0.938619792f, 0.289731443f},
-std::array<float,2>{0.0353559144f, 0.488609135f},
-std::array<float,2>{0.865452349f, 0.880612254f},
-std::array<float,2>{0.384712696f, 0.628775239f},
-std::array<float,2>{0.636524856f, 0.118899338f},
-std::array<float,2>{0.0996337235f, 0.220665246f},
-std::array<float,2>{0.783457518f, 0.572636366f},
-std::array<float,2>{0.479617417f, 0.862337351f},
-std::array<float,2>{0.729468107f, 0.345640153f},
-std::array<float,2>{0.250541925f, 0.402188808f},
-std::array<float,2>{0.540253699f, 0.988488674f},
-std::array<float,2>{0.175715193f, 0.70770663f},
-std::array<float,2>{0.90272826f, 0.0216655936f},
-std::array<float,2>{0.432773888f, 0.074099198f},
-std::array<float,2>{0.667043567f, 0.67925328f},
-std::array<float,2>{0.0233727153f, 0.929503024f},
-std::array<float,2>{0.816498995f, 0.46147117f},
-std::array<float,2>{0.196036249f, 0.268601328f},
-std::array<float,2>{0.9866274f, 0.785353601f},
-std::array<float,2>{0.347350776f, 0.526691139f},
-std::array<float,2>{0.566845655f, 0.180728003f},
-std::array<float,2>{0.0785675719f, 0.111823559f},
-std::array<float,2>{0.754448473f, 0.635016263f},
-std::array<float,2>{0.440234393f, 0.887690008f},
-std::array<float,2>{0.70511049f, 0.499027699f},
-std::array<float,2>{0.295190543f, 0.287284553f},
-std::array<float,2>{0.500694752f, 0.762594759f},
-std::array<float,2>{0.153294712f, 0.531674087f},
-std::array<float,2>{0.922492027f, 0.144490331f},
-std::array<float,2>{0.400941998f, 0.193048239f},
-std::array<float,2>{0.646554351f, 0.596961021f},
-std::array<float,2>{0.0486352853f, 0.82118094f},
-std::array<float,2>{0.854386806f, 0.315071583f},
-std::array<float,2>{0.223514125f, 0.416683257f},
-std::array<float,2>{0.96322751f, 0.967586219f},
-std::array<float,2>{0.317795485f, 0.725362957f},
-std::array<float,2>{0.605625927f, 0.0314016789f},
-std::array<float,2>{0.158973277f, 0.178726628f},
-std::array<float,2>{0.876984894f, 0.520681739f},
-std::array<float,2>{0.27645123f, 0.794537425f},
-std::array<float,2>{0.561305225f, 0.280728668f},
-std::array<float,2>{0.491853356f, 0.457708925f},
-std::array<float,2>{0.736970007f, 0.934380531f},
-std::array<float,2>{0.120647825f, 0.680030704f},
-std::array<float,2>{0.807743192f, 0.0632950366f},
-std::array<float,2>{0.368346393f, 0.0249742921f},
-std::array<float,2>{0.578656435f, 0.71581161f},
-std::array<float,2>{0.203555346f, 0.995490551f},
-std::array<float,2>{0.981222153f, 0.395102173f},
-std::array<float,2>{0.00972638186f, 0.355726928f},
-std::array<float,2>{0.839454651f, 0.86910367f},
-std::array<float,2>{0.41794464f, 0.566353858f},
-std::array<float,2>{0.684412241f, 0.231798634f},
-std::array<float,2>{0.200704187f, 0.053597074f},
-std::array<float,2>{0.989575982f, 0.74244678f},
-std::array<float,2>{0.348850012f, 0.939806104f},
-std::array<float,2>{0.563524604f, 0.430442631f},
-std::array<float,2>{0.434043467f, 0.335874379f},
-std::array<float,2>{0.668100595f, 0.834999204f},
-std::array<float,2>{0.0178997535f, 0.621707082f},
-std::array<float,2>{0.815331638f, 0.204590231f},
-std::array<float,2>{0.25728786f, 0.135367736f},
-std::array<float,2>{0.546539485f, 0.551364839f},
-std::array<float,2>{0.176788196f, 0.766272366f},
-std::array<float,2>{0.900235832f, 0.303324521f},
-std::array<float,2>{0.0954230577f, 0.474435002f},
-std::array<float,2>{0.786289036f, 0.895244241f},
-std::array<float,2>{0.482678175f, 0.651392043f},
-std::array<float,2>{0.731305301f, 0.106918886f},
-std::array<float,2>{0.0340589099f, 0.236739799f},
-std::array<float,2>{0.86020273f, 0.584308326f},
-std::array<float,2>{0.388130754f, 0.850114286f},
-std::array<float,2>{0.638576984f, 0.362483144f},
-std::array<float,2>{0.338575214f, 0.380098999f},
-std::array<float,2>{0.612864733f, 0.973164618f},
-std::array<float,2>{0.234609574f, 0.687907636f},
-std::array<float,2>{0.942672372f, 0.00271425745f},
-std::array<float,2>{0.455486178f, 0.082132563f},
-std::array<float,2>{0.693607867f, 0.658978105f},
-std::array<float,2>{0.0743472129f, 0.911507308f},
-std::array<float,2>{0.776146472f, 0.442118824f},
-std::array<float,2>{0.138055339f, 0.263825834f},
-std::array<float,2>{0.916645646f, 0.803001583f},
-std::array<float,2>{0.309972376f, 0.514863372f},
-std::array<float,2>{0.527392745f, 0.164193332f},
-std::array<float,2>{0.0287261754f, 0.0134996818f},
-std::array<float,2>{0.820949554f, 0.698089659f},
-std::array<float,2>{0.42946893f, 0.983993113f},
-std::array<float,2>{0.662209153f, 0.385744661f},
-std::array<float,2>{0.35460031f, 0.367943585f},
-std::array<float,2>{0.576824129f, 0.855732977f},
-std::array<float,2>{0.193220958f, 0.590435803f},
-std::array<float,2>{0.996014476f, 0.243748829f},
-std::array<float,2>{0.4743146f, 0.156279206f},
-std::array<float,2>{0.723543644f, 0.501179397f},
-std::array<float,2>{0.107432447f, 0.80698812f},
-std::array<float,2>{0.791103125f, 0.25279507f},
-std::array<float,2>{0.183015794f, 0.447518289f},
-std::array<float,2>{0.896438479f, 0.91532743f},
-std::array<float,2>{0.262627304f, 0.669088244f},
-std::array<float,2>{0.535023272f, 0.0917491019f},
-std::array<float,2>{0.244263142f, 0.211045295f},
-std::array<float,2>{0.947798371f, 0.615187943f},
-std::array<float,2>{0.334231228f, 0.843139708f},
-std::array<float,2>{0.624958634f, 0.340843558f},
-std::array<float,2>{0.377561599f, 0.423338354f},
-std::array<float,2>{0.627294421f, 0.951390088f},
-std::array<float,2>{0.0425617434f, 0.736382008f},
-std::array<float,2>{0.868172884f, 0.0589017272f},
-std::array<float,2>{0.299945265f, 0.094336316f},
-std::array<float,2>{0.520163536f, 0.64510715f},
-std::array<float,2>{0.125046819f, 0.901342928f},
-std::array<float,2>{0.907257497f, 0.478452981f},
-std::array<float,2>{0.0664163828f, 0.311341524f},
-std::array<float,2>{0.766814053f, 0.78007555f},
-std::array<float,2>{0.46821323f, 0.558348715f},
-std::array<float,2>{0.696290731f, 0.130410865f},
-std::array<float,2>{0.1481563f, 0.0745999888f},
-std::array<float,2>{0.934980333f, 0.674113572f},
-std::array<float,2>{0.285935849f, 0.924317896f},
-std::array<float,2>{0.509790301f, 0.46500209f},
-std::array<float,2>{0.448496997f, 0.271055222f},
-std::array<float,2>{0.713964701f, 0.784549117f},
-std::array<float,2>{0.0921599567f, 0.530434728f},
-std::array<float,2>{0.760798693f, 0.18577899f},
-std::array<float,2>{0.321563959f, 0.225738704f},
-std::array<float,2>{0.598995924f, 0.57573086f},
-std::array<float,2>{0.226597548f, 0.863986731f},
-std::array<float,2>{0.959868193f, 0.34811157f},
-std::array<float,2>{0.0617809445f, 0.403173089f},
-std::array<float,2>{0.843844891f, 0.987430573f},
-std::array<float,2>{0.398093462f, 0.704886794f},
-std::array<float,2>{0.65074718f, 0.0176082216f},
-std::array<float,2>{0.110667087f, 0.150425673f},
-std::array<float,2>{0.798830748f, 0.540453076f},
-std::array<float,2>{0.494702756f, 0.752629995f},
-std::array<float,2>{0.744679153f, 0.294318676f},
-std::array<float,2>{0.269794881f, 0.48510617f},
-std::array<float,2>{0.554601967f, 0.877708256f},
-std::array<float,2>{0.168204442f, 0.631659865f},
-std::array<float,2>{0.886897504f, 0.124336138f},
-std::array<float,2>{0.413498819f, 0.0403472818f},
-std::array<float,2>{0.6724177f, 0.730682015f},
-std::array<float,2>{0.00157148798f, 0.955592155f},
-std::array<float,2>{0.833915114f, 0.407933682f},
-std::array<float,2>{0.218037829f, 0.321934789f},
-std::array<float,2>{0.969271064f, 0.815596163f},
-std::array<float,2>{0.364562571f, 0.603573859f},
-std::array<float,2>{0.591157138f, 0.201322004f},
-std::array<float,2>{0.10518875f, 0.0352504104f},
-std::array<float,2>{0.794054866f, 0.719842553f},
-std::array<float,2>{0.47020635f, 0.961863279f},
-std::array<float,2>{0.722380698f, 0.418824881f},
-std::array<float,2>{0.260432094f, 0.319737166f},
-std::array<float,2>{0.536106467f, 0.825490415f},
-std::array<float,2>{0.184385136f, 0.599871278f},
-std::array<float,2>{0.891272604f, 0.188670143f},
-std::array<float,2>{0.422155857f, 0.148022875f},
-std::array<float,2>{0.65828532f, 0.536757529f},
-std::array<float,2>{0.0244549848f, 0.759869993f},
-std::array<float,2>{0.826907039f, 0.284730434f},
-std::array<float,2>{0.188084349f, 0.493383616f},
-std::array<float,2>{0.997648954f, 0.883727014f},
-std::array<float,2>{0.358044684f, 0.638588011f},
-std::array<float,2>{0.573220193f, 0.113396101f},
-std::array<float,2>{0.132067934f, 0.227635607f},
-std::array<float,2>{0.912377417f, 0.569627285f},
-std::array<float,2>{0.301648229f, 0.871145725f},
-std::array<float,2>{0.519480109f, 0.355251104f},
-std::array<float,2>{0.462829441f, 0.392601639f},
-std::array<float,2>{0.699871361f, 0.996984839f},
-std::array<float,2>{0.0646152347f, 0.712788939f},
-std::array<float,2>{0.77333945f, 0.0302314609f},
-std::array<float,2>{0.3301346f, 0.0682770386f},
-std::array<float,2>{0.621032417f, 0.68690449f},
-std::array<float,2>{0.246826336f, 0.932527661f},
-std::array<float,2>{0.952764571f, 0.456949621f},
-std::array<float,2>{0.0464901365f, 0.277258426f},
-std::array<float,2>{0.871145725f, 0.792521656f},
-std::array<float,2>{0.380729765f, 0.518649399f},
-std::array<float,2>{0.629124343f, 0.172298148f},
-std::array<float,2>{0.232377782f, 0.104347929f},
-std::array<float,2>{0.953168511f, 0.654037058f},
-std::array<float,2>{0.326476395f, 0.894021392f},
-std::array<float,2>{0.596422315f, 0.472283095f},
-std::array<float,2>{0.391060978f, 0.299537063f},
-std::array<float,2>{0.655713141f, 0.771833718f},
-std::array<float,2>{0.0560351498f, 0.55034703f},
-std::array<float,2>{0.849777043f, 0.13705714f},
-std::array<float,2>{0.281581879f, 0.209564775f},
-std::array<float,2>{0.513889551f, 0.617944658f},
-std::array<float,2>{0.140990436f, 0.829886675f},
-std::array<float,2>{0.930861294f, 0.329584152f},
-std::array<float,2>{0.0882313699f, 0.437244445f},
-std::array<float,2>{0.762579322f, 0.943437457f},
-std::array<float,2>{0.452976346f, 0.749979556f},
-std::array<float,2>{0.715385377f, 0.0481176414f},
-std::array<float,2>{0.00568344863f, 0.169586435f},
-std::array<float,2>{0.829635024f, 0.508882821f},
-std::array<float,2>{0.409166604f, 0.798558593f},
-std::array<float,2>{0.676908135f, 0.258973628f},
-std::array<float,2>{0.360628039f, 0.437832087f},
-std::array<float,2>{0.588362098f, 0.908546686f},
-std::array<float,2>{0.212668836f, 0.663138807f},
-std::array<float,2>{0.973413885f, 0.0811480135f},
-std::array<float,2>{0.499139786f, 0.00523806177f},
-std::array<float,2>{0.747749865f, 0.693766117f},
-std::array<float,2>{0.115192764f, 0.97168529f},
-std::array<float,2>{0.802547514f, 0.37672472f},
-std::array<float,2>{0.16421631f, 0.367135912f},
-std::array<float,2>{0.885971487f, 0.845171213f},
-std::array<float,2>{0.26695171f, 0.581745625f},
-std::array<float,2>{0.548167467f, 0.241820589f},
-std::array<float,2>{0.0530200824f, 0.0895161405f},
-std::array<float,2>{0.857728422f, 0.667401731f},
-std::array<float,2>{0.40460515f, 0.921008468f},
-std::array<float,2>{0.642101705f, 0.449530184f},
-std::array<float,2>{0.314509928f, 0.256779671f},
-std::array<float,2>{0.605186284f, 0.811584294f},
-std::array<float,2>{0.220834151f, 0.505882144f},
-std::array<float,2>{0.968190491f, 0.162722245f},
-std::array<float,2>{0.441557705f, 0.248984575f},
-std::array<float,2>{0.70935607f, 0.589496315f},
-std::array<float,2>{0.0848058686f, 0.852898896f},
-std::array<float,2>{0.753545225f, 0.373060912f},
-std::array<float,2>{0.152260363f, 0.388308406f},
-std::array<float,2>{0.927199721f, 0.98020041f},
-std::array<float,2>{0.29092586f, 0.70029968f},
-std::array<float,2>{0.504455686f, 0.00878541637f},
-std::array<float,2>{0.210564956f, 0.126869738f},
-std::array<float,2>{0.979051292f, 0.558947086f},
-std::array<float,2>{0.37294808f, 0.774690628f},
-std::array<float,2>{0.583692014f, 0.304880083f},
-std::array<float,2>{0.420568198f, 0.48211652f},
-std::array<float,2>{0.683469117f, 0.903908372f},
-std::array<float,2>{0.0151316514f, 0.644368768f},
-std::array<float,2>{0.843546629f, 0.0979030207f},
-std::array<float,2>{0.278644562f, 0.0574239492f},
-std::array<float,2>{0.556685328f, 0.741505444f},
-std::array<float,2>{0.162812233f, 0.945583642f},
-std::array<float,2>{0.88064909f, 0.427281767f},
-std::array<float,2>{0.122945167f, 0.337752819f},
-std::array<float,2>{0.809806585f, 0.836436808f},
-std::array<float,2>{0.487743407f, 0.609551489f},
-std::array<float,2>{0.738453388f, 0.216808543f},
-std::array<float,2>{0.172511414f, 0.0207445472f},
-std::array<float,2>{0.905912757f, 0.710722625f},
-std::array<float,2>{0.253187507f, 0.991870701f},
-std::array<float,2>{0.541622579f, 0.400361747f},
-std::array<float,2>{0.478126705f, 0.346976042f},
-std::array<float,2>{0.726707995f, 0.860046685f},
-std::array<float,2>{0.0979289562f, 0.570694208f},
-std::array<float,2>{0.783196092f, 0.221362263f},
-std::array<float,2>{0.345515877f, 0.183590844f},
-std::array<float,2>{0.569944203f, 0.524957716f},
-std::array<float,2>{0.197901547f, 0.788192868f},
-std::array<float,2>{0.985412478f, 0.265781462f},
-std::array<float,2>{0.0212028027f, 0.46483627f},
-std::array<float,2>{0.819858313f, 0.926484764f},
-std::array<float,2>{0.430369705f, 0.675823569f},
-std::array<float,2>{0.664161325f, 0.0714480057f},
-std::array<float,2>{0.0733811855f, 0.196472794f},
-std::array<float,2>{0.780373812f, 0.605613768f},
-std::array<float,2>{0.458054334f, 0.816594064f},
-std::array<float,2>{0.689626694f, 0.327363282f},
-std::array<float,2>{0.305283666f, 0.412665278f},
-std::array<float,2>{0.524093151f, 0.959713519f},
-std::array<float,2>{0.133130938f, 0.727555871f},
-std::array<float,2>{0.918556631f, 0.0449814312f},
-std::array<float,2>{0.386372238f, 0.119377233f},
-std::array<float,2>{0.633592486f, 0.625469863f},
-std::array<float,2>{0.0374894291f, 0.882243335f},
-std::array<float,2>{0.863467991f, 0.49071154f},
-std::array<float,2>{0.240994528f, 0.292237312f},
-std::array<float,2>{0.941130221f, 0.75503993f},
-std::array<float,2>{0.343276978f, 0.545760334f},
-std::array<float,2>{0.617025793f, 0.155244693f},
-std::array<float,2>{0.0760007277f, 0.0851191729f},
-std::array<float,2>{0.77651161f, 0.657571197f},
-std::array<float,2>{0.456570059f, 0.912976742f},
-std::array<float,2>{0.695304334f, 0.444206536f},
-std::array<float,2>{0.309228748f, 0.262803108f},
-std::array<float,2>{0.528863609f, 0.801125348f},
-std::array<float,2>{0.137362927f, 0.51225394f},
-std::array<float,2>{0.917812228f, 0.166882008f},
-std::array<float,2>{0.386768609f, 0.235399351f},
-std::array<float,2>{0.637332022f, 0.582744479f},
-std::array<float,2>{0.0343796797f, 0.848291457f},
-std::array<float,2>{0.860829234f, 0.359833509f},
-std::array<float,2>{0.235659391f, 0.38094312f},
-std::array<float,2>{0.94227767f, 0.975580096f},
-std::array<float,2>{0.339636475f, 0.690867364f},
-std::array<float,2>{0.61227107f, 0.00194382702f},
-std::array<float,2>{0.175943613f, 0.133360237f},
-std::array<float,2>{0.898745418f, 0.553223014f},
-std::array<float,2>{0.256784409f, 0.768721402f},
-std::array<float,2>{0.545063913f, 0.302706599f},
-std::array<float,2>{0.484263361f, 0.475204021f},
-std::array<float,2>{0.732164383f, 0.896703839f},
-std::array<float,2>{0.0940033644f, 0.648811817f},
-std::array<float,2>{0.785733283f, 0.107601486f},
-std::array<float,2>{0.348271191f, 0.0519722179f},
-std::array<float,2>{0.563275039f, 0.744358718f},
-std::array<float,2>{0.199989006f, 0.937708557f},
-std::array<float,2>{0.989128888f, 0.432140827f},
-std::array<float,2>{0.0192938652f, 0.33370015f},
-std::array<float,2>{0.816103935f, 0.832257569f},
-std::array<float,2>{0.43498072f, 0.623574913f},
-std::array<float,2>{0.669767737f, 0.205395207f},
-std::array<float,2>{0.20411396f, 0.0269806217f},
-std::array<float,2>{0.981759548f, 0.717664123f},
-std::array<float,2>{0.367721975f, 0.992503047f},
-std::array<float,2>{0.579300523f, 0.396972954f},
-std::array<float,2>{0.416719854f, 0.358647048f},
-std::array<float,2>{0.685364366f, 0.869259953f},
-std::array<float,2>{0.00794125721f, 0.562616527f},
-std::array<float,2>{0.837891817f, 0.232965767f},
-std::array<float,2>{0.27585873f, 0.176581681f},
-std::array<float,2>{0.561917186f, 0.522077858f},
-std::array<float,2>{0.159417242f, 0.796088099f},
-std::array<float,2>{0.87836045f, 0.278499573f},
-std::array<float,2>{0.119282834f, 0.460388452f},
-std::array<float,2>{0.807321668f, 0.935720861f},
-std::array<float,2>{0.490710109f, 0.682540536f},
-std::array<float,2>{0.737925529f, 0.0658593699f},
-std::array<float,2>{0.0475249216f, 0.193966895f},
-std::array<float,2>{0.854920328f, 0.593926966f},
-std::array<float,2>{0.401405752f, 0.82400018f},
-std::array<float,2>{0.647956848f, 0.313274235f},
-std::array<float,2>{0.316885024f, 0.414869845f},
-std::array<float,2>{0.607207358f, 0.965276539f},
-std::array<float,2>{0.223870873f, 0.723083436f},
-std::array<float,2>{0.964163184f, 0.0340422839f},
-std::array<float,2>{0.440446258f, 0.110193633f},
-std::array<float,2>{0.706882954f, 0.632910371f},
-std::array<float,2>{0.0791051909f, 0.890180111f},
-std::array<float,2>{0.755105853f, 0.498006135f},
-std::array<float,2>{0.154032901f, 0.285638511f},
-std::array<float,2>{0.923327804f, 0.765429795f},
-std::array<float,2>{0.296108544f, 0.533644855f},
-std::array<float,2>{0.501274288f, 0.141722977f},
-std::array<float,2>{0.00043686587f, 0.0425236188f},
-std::array<float,2>{0.832993627f, 0.732756078f},
-std::array<float,2>{0.412521631f, 0.954001009f},
-std::array<float,2>{0.673234344f, 0.409988582f},
-std::array<float,2>{0.364000857f, 0.322360486f},
-std::array<float,2>{0.590197146f, 0.812530458f},
-std::array<float,2>{0.217667669f, 0.601721346f},
-std::array<float,2>{0.970578492f, 0.200422361f},
-std::array<float,2>{0.495870262f, 0.149246171f},
-std::array<float,2>{0.745942593f, 0.542800426f},
-std::array<float,2>{0.110252649f, 0.751230896f},
-std::array<float,2>{0.80068326f, 0.296357512f},
-std::array<float,2>{0.169193015f, 0.486411899f},
-std::array<float,2>{0.888183117f, 0.875301361f},
-std::array<float,2>{0.270898879f, 0.62911576f},
-std::array<float,2>{0.553083181f, 0.121874206f},
-std::array<float,2>{0.227549061f, 0.224485144f},
-std::array<float,2>{0.960355937f, 0.576372445f},
-std::array<float,2>{0.320509493f, 0.866655231f},
-std::array<float,2>{0.598052442f, 0.349635512f},
-std::array<float,2>{0.397105843f, 0.40538919f},
-std::array<float,2>{0.652128041f, 0.986018002f},
-std::array<float,2>{0.0608530417f, 0.705695689f},
-std::array<float,2>{0.845229149f, 0.0174282361f},
-std::array<float,2>{0.286404461f, 0.0765160024f},
-std::array<float,2>{0.510833383f, 0.673338175f},
-std::array<float,2>{0.146680802f, 0.923559129f},
-std::array<float,2>{0.933908939f, 0.46701628f},
-std::array<float,2>{0.0933040157f, 0.272583067f},
-std::array<float,2>{0.759869516f, 0.782966673f},
-std::array<float,2>{0.447390735f, 0.527925253f},
-std::array<float,2>{0.713496447f, 0.185134888f},
-std::array<float,2>{0.126067922f, 0.0970282108f},
-std::array<float,2>{0.907115519f, 0.647856236f},
-std::array<float,2>{0.299784422f, 0.898666143f},
-std::array<float,2>{0.520762086f, 0.479062468f},
-std::array<float,2>{0.467185289f, 0.308872133f},
-std::array<float,2>{0.695912659f, 0.777690113f},
-std::array<float,2>{0.0676860139f, 0.55490154f},
-std::array<float,2>{0.766125143f, 0.132352471f},
-std::array<float,2>{0.33547014f, 0.214669168f},
-std::array<float,2>{0.623797059f, 0.616533995f},
-std::array<float,2>{0.245221302f, 0.841315329f},
-std::array<float,2>{0.948476791f, 0.3429735f},
-std::array<float,2>{0.0410252512f, 0.424688131f},
-std::array<float,2>{0.867823839f, 0.951063454f},
-std::array<float,2>{0.378044724f, 0.736035645f},
-std::array<float,2>{0.62887311f, 0.0619764179f},
-std::array<float,2>{0.109130315f, 0.16005221f},
-std::array<float,2>{0.792964935f, 0.502848029f},
-std::array<float,2>{0.473411649f, 0.804775178f},
-std::array<float,2>{0.723878443f, 0.251801968f},
-std::array<float,2>{0.263597786f, 0.446668386f},
-std::array<float,2>{0.534036219f, 0.916353226f},
-std::array<float,2>{0.181692243f, 0.670603871f},
-std::array<float,2>{0.895235419f, 0.0935478732f},
-std::array<float,2>{0.428377092f, 0.0137330387f},
-std::array<float,2>{0.663921416f, 0.696346641f},
-std::array<float,2>{0.0273449682f, 0.982316136f},
-std::array<float,2>{0.822077692f, 0.384476006f},
-std::array<float,2>{0.192316413f, 0.370063245f},
-std::array<float,2>{0.995094478f, 0.858304918f},
-std::array<float,2>{0.354438663f, 0.593229353f},
-std::array<float,2>{0.577814281f, 0.244616956f},
-std::array<float,2>{0.113529496f, 0.00744553655f},
-std::array<float,2>{0.801337421f, 0.692446172f},
-std::array<float,2>{0.498391926f, 0.969088674f},
-std::array<float,2>{0.746229589f, 0.378312528f},
-std::array<float,2>{0.266430438f, 0.364031523f},
-std::array<float,2>{0.547844529f, 0.846629918f},
-std::array<float,2>{0.165722743f, 0.579758406f},
-std::array<float,2>{0.884922147f, 0.239518479f},
-std::array<float,2>{0.409882247f, 0.171571597f},
-std::array<float,2>{0.676427126f, 0.511383414f},
-std::array<float,2>{0.00484404108f, 0.800519109f},
-std::array<float,2>{0.828563392f, 0.260191023f},
-std::array<float,2>{0.211846843f, 0.441190034f},
-std::array<float,2>{0.973710656f, 0.906588852f},
-std::array<float,2>{0.35949564f, 0.660220444f},
-std::array<float,2>{0.589090586f, 0.078958042f},
-std::array<float,2>{0.141626105f, 0.208348945f},
-std::array<float,2>{0.929728508f, 0.620488822f},
-std::array<float,2>{0.282256007f, 0.83011353f},
-std::array<float,2>{0.515586734f, 0.330119491f},
-std::array<float,2>{0.451741695f, 0.43405804f},
-std::array<float,2>{0.716789484f, 0.942546248f},
-std::array<float,2>{0.0896695182f, 0.746322155f},
-std::array<float,2>{0.76309526f, 0.0489981398f},
-std::array<float,2>{0.327385485f, 0.10250479f},
-std::array<float,2>{0.596780896f, 0.65497911f},
-std::array<float,2>{0.231378794f, 0.891162932f},
-std::array<float,2>{0.954393685f, 0.470189601f},
-std::array<float,2>{0.0548817441f, 0.298632354f},
-std::array<float,2>{0.850709319f, 0.771349967f},
-std::array<float,2>{0.391661346f, 0.548098028f},
-std::array<float,2>{0.654341578f, 0.140413284f},
-std::array<float,2>{0.247249231f, 0.0697659925f},
-std::array<float,2>{0.9518103f, 0.685338974f},
-std::array<float,2>{0.331477761f, 0.9299348f},
-std::array<float,2>{0.619903266f, 0.454716414f},
-std::array<float,2>{0.379725516f, 0.273712367f},
-std::array<float,2>{0.630629122f, 0.789635837f},
-std::array<float,2>{0.0457923599f, 0.516388357f},
-std::array<float,2>{0.872483313f, 0.175712392f},
-std::array<float,2>{0.301833063f, 0.22871846f},
-std::array<float,2>{0.518119574f, 0.56672734f},
-std::array<float,2>{0.131729797f, 0.873130441f},
-std::array<float,2>{0.913141251f, 0.351590246f},
-std::array<float,2>{0.065554142f, 0.391592711f},
-std::array<float,2>{0.771834791f, 0.998703063f},
-std::array<float,2>{0.461110532f, 0.713970304f},
-std::array<float,2>{0.70101434f, 0.028283231f},
-std::array<float,2>{0.0240092203f, 0.144555539f},
-std::array<float,2>{0.82773459f, 0.537254035f},
-std::array<float,2>{0.423551112f, 0.758221388f},
-std::array<float,2>{0.659747779f, 0.282554448f},
-std::array<float,2>{0.358614773f, 0.495972693f},
-std::array<float,2>{0.573910415f, 0.885284245f},
-std::array<float,2>{0.18921411f, 0.640410602f},
-std::array<float,2>{0.996381462f, 0.116263881f},
-std::array<float,2>{0.469654143f, 0.0376270227f},
-std::array<float,2>{0.72097069f, 0.722134829f},
-std::array<float,2>{0.103621699f, 0.964308798f},
-std::array<float,2>{0.793548882f, 0.421364605f},
-std::array<float,2>{0.185304135f, 0.316428542f},
-std::array<float,2>{0.891654432f, 0.82750994f},
-std::array<float,2>{0.261579931f, 0.597976387f},
-std::array<float,2>{0.536477685f, 0.190331444f},
-std::array<float,2>{0.0387684777f, 0.11719083f},
-std::array<float,2>{0.864762545f, 0.627018571f},
-std::array<float,2>{0.385282785f, 0.879110336f},
-std::array<float,2>{0.633809626f, 0.490015626f},
-std::array<float,2>{0.341939837f, 0.291002631f},
-std::array<float,2>{0.615575492f, 0.756257832f},
-std::array<float,2>{0.241821796f, 0.543085754f},
-std::array<float,2>{0.939587295f, 0.152510583f},
-std::array<float,2>{0.457190543f, 0.19745943f},
-std::array<float,2>{0.690826833f, 0.607562363f},
-std::array<float,2>{0.0731488392f, 0.818544686f},
-std::array<float,2>{0.779655695f, 0.32513696f},
-std::array<float,2>{0.133990809f, 0.411145538f},
-std::array<float,2>{0.919466197f, 0.957399487f},
-std::array<float,2>{0.306336701f, 0.73002708f},
-std::array<float,2>{0.524436116f, 0.0431264378f},
-std::array<float,2>{0.198302031f, 0.180406734f},
-std::array<float,2>{0.984400988f, 0.52549547f},
-std::array<float,2>{0.344133645f, 0.786927998f},
-std::array<float,2>{0.569044173f, 0.26778394f},
-std::array<float,2>{0.430950314f, 0.462033302f},
-std::array<float,2>{0.665840566f, 0.928522229f},
-std::array<float,2>{0.019713087f, 0.677962422f},
-std::array<float,2>{0.818897724f, 0.073084712f},
-std::array<float,2>{0.252352118f, 0.0227609128f},
-std::array<float,2>{0.542863488f, 0.708455265f},
-std::array<float,2>{0.173723012f, 0.989614725f},
-std::array<float,2>{0.904488802f, 0.401029825f},
-std::array<float,2>{0.0986423492f, 0.344363391f},
-std::array<float,2>{0.781261563f, 0.86173749f},
-std::array<float,2>{0.476583332f, 0.574084461f},
-std::array<float,2>{0.727732241f, 0.218792602f},
-std::array<float,2>{0.163159549f, 0.0564597026f},
-std::array<float,2>{0.879389644f, 0.738800764f},
-std::array<float,2>{0.278313071f, 0.948009431f},
-std::array<float,2>{0.558487892f, 0.429523915f},
-std::array<float,2>{0.486658335f, 0.337945044f},
-std::array<float,2>{0.739331186f, 0.838395596f},
-std::array<float,2>{0.12168251f, 0.612019479f},
-std::array<float,2>{0.809418321f, 0.216105223f},
-std::array<float,2>{0.3717902f, 0.127017424f},
-std::array<float,2>{0.582568467f, 0.562281847f},
-std::array<float,2>{0.20943433f, 0.77700907f},
-std::array<float,2>{0.980227411f, 0.306853741f},
-std::array<float,2>{0.0141883492f, 0.483741164f},
-std::array<float,2>{0.842703879f, 0.906213284f},
-std::array<float,2>{0.421474367f, 0.641362727f},
-std::array<float,2>{0.681943417f, 0.100565985f},
-std::array<float,2>{0.0855792686f, 0.247614801f},
-std::array<float,2>{0.75242877f, 0.586627185f},
-std::array<float,2>{0.442702264f, 0.853606462f},
-std::array<float,2>{0.710852444f, 0.372024179f},
-std::array<float,2>{0.289750367f, 0.390089482f},
-std::array<float,2>{0.505723894f, 0.977407634f},
-std::array<float,2>{0.151132494f, 0.703074098f},
-std::array<float,2>{0.926536918f, 0.0115996161f},
-std::array<float,2>{0.405752242f, 0.0862044916f},
-std::array<float,2>{0.640697479f, 0.664530158f},
-std::array<float,2>{0.0546813309f, 0.918251872f},
-std::array<float,2>{0.858704567f, 0.452121228f},
-std::array<float,2>{0.222502917f, 0.255377471f},
-std::array<float,2>{0.967095077f, 0.808990419f},
-std::array<float,2>{0.315924793f, 0.50521785f},
-std::array<float,2>{0.603882968f, 0.160634577f},
-std::array<float,2>{0.0965079889f, 0.106334157f},
-std::array<float,2>{0.788422585f, 0.651157677f},
-std::array<float,2>{0.48066783f, 0.89626956f},
-std::array<float,2>{0.732581735f, 0.473367214f},
-std::array<float,2>{0.254096687f, 0.303949952f},
-std::array<float,2>{0.543309748f, 0.766749918f},
-std::array<float,2>{0.178376153f, 0.551834702f},
-std::array<float,2>{0.900439382f, 0.136514291f},
-std::array<float,2>{0.436607659f, 0.203395441f},
-std::array<float,2>{0.671063066f, 0.622902572f},
-std::array<float,2>{0.0160000082f, 0.834559083f},
-std::array<float,2>{0.813861072f, 0.334260494f},
-std::array<float,2>{0.203035474f, 0.431236774f},
-std::array<float,2>{0.991830349f, 0.94051981f},
-std::array<float,2>{0.349662691f, 0.743764102f},
-std::array<float,2>{0.566225648f, 0.0545716807f},
-std::array<float,2>{0.139421582f, 0.165188923f},
-std::array<float,2>{0.915617406f, 0.514502168f},
-std::array<float,2>{0.311109811f, 0.803851962f},
-std::array<float,2>{0.53033191f, 0.265465111f},
-std::array<float,2>{0.453370273f, 0.442806453f},
-std::array<float,2>{0.692324579f, 0.910514772f},
-std::array<float,2>{0.0777278617f, 0.659769118f},
-std::array<float,2>{0.773818314f, 0.0830334872f},
-std::array<float,2>{0.33773613f, 0.00355810486f},
-std::array<float,2>{0.611020625f, 0.68887049f},
-std::array<float,2>{0.236573651f, 0.973788083f},
-std::array<float,2>{0.943756282f, 0.379213333f},
-std::array<float,2>{0.0321075171f, 0.361799568f},
-std::array<float,2>{0.861537695f, 0.851234198f},
-std::array<float,2>{0.390211165f, 0.585245311f},
-std::array<float,2>{0.638807118f, 0.237722799f},
-std::array<float,2>{0.226253182f, 0.0331338979f},
-std::array<float,2>{0.962347746f, 0.725586057f},
-std::array<float,2>{0.32024014f, 0.968574226f},
-std::array<float,2>{0.609089136f, 0.41764161f},
-std::array<float,2>{0.398915172f, 0.315622151f},
-std::array<float,2>{0.645330906f, 0.821947217f},
-std::array<float,2>{0.0496103168f, 0.595722139f},
-std::array<float,2>{0.851725519f, 0.191859081f},
-std::array<float,2>{0.293959886f, 0.142959684f},
-std::array<float,2>{0.501986742f, 0.533042789f},
-std::array<float,2>{0.155254558f, 0.762702107f},
-std::array<float,2>{0.925035536f, 0.288248956f},
-std::array<float,2>{0.0814758241f, 0.498694539f},
-std::array<float,2>{0.757804334f, 0.888630092f},
-std::array<float,2>{0.438533068f, 0.636413455f},
-std::array<float,2>{0.703802943f, 0.112385415f},
-std::array<float,2>{0.0100575276f, 0.230725378f},
-std::array<float,2>{0.837725699f, 0.565113902f},
-std::array<float,2>{0.414631218f, 0.86796242f},
-std::array<float,2>{0.68739742f, 0.357264102f},
-std::array<float,2>{0.369302243f, 0.396140099f},
-std::array<float,2>{0.58046937f, 0.99482137f},
-std::array<float,2>{0.206879839f, 0.715945303f},
-std::array<float,2>{0.982562423f, 0.0242504347f},
-std::array<float,2>{0.489295512f, 0.0643498078f},
-std::array<float,2>{0.734943986f, 0.681133509f},
-std::array<float,2>{0.118227296f, 0.935503781f},
-std::array<float,2>{0.805303216f, 0.458903581f},
-std::array<float,2>{0.156766132f, 0.279579341f},
-std::array<float,2>{0.876855075f, 0.793786824f},
-std::array<float,2>{0.273670733f, 0.520208359f},
-std::array<float,2>{0.559937418f, 0.177751496f},
-std::array<float,2>{0.0603554845f, 0.0192342196f},
-std::array<float,2>{0.847549319f, 0.703721106f},
-std::array<float,2>{0.39606607f, 0.987184823f},
-std::array<float,2>{0.649010301f, 0.403645039f},
-std::array<float,2>{0.322985649f, 0.349119365f},
-std::array<float,2>{0.600508749f, 0.864618838f},
-std::array<float,2>{0.229380712f, 0.574458778f},
-std::array<float,2>{0.95885241f, 0.22483933f},
-std::array<float,2>{0.446740597f, 0.186545596f},
-std::array<float,2>{0.710967898f, 0.529368281f},
-std::array<float,2>{0.090295352f, 0.784107685f},
-std::array<float,2>{0.758787751f, 0.269817114f},
-std::array<float,2>{0.145048827f, 0.466402233f},
-std::array<float,2>{0.937115431f, 0.92505461f},
-std::array<float,2>{0.287538111f, 0.675409019f},
-std::array<float,2>{0.508158803f, 0.0760042593f},
-std::array<float,2>{0.216209546f, 0.202821389f},
-std::array<float,2>{0.971923292f, 0.605443597f},
-std::array<float,2>{0.365924627f, 0.814769506f},
-std::array<float,2>{0.592513204f, 0.321103185f},
-std::array<float,2>{0.410458028f, 0.406833768f},
-std::array<float,2>{0.675513148f, 0.956109822f},
-std::array<float,2>{0.00301141455f, 0.731611013f},
-std::array<float,2>{0.833988428f, 0.0392185673f},
-std::array<float,2>{0.271966696f, 0.123444661f},
-std::array<float,2>{0.551009893f, 0.632684886f},
-std::array<float,2>{0.170433f, 0.878676891f},
-std::array<float,2>{0.890558064f, 0.48587957f},
-std::array<float,2>{0.112278886f, 0.293438137f},
-std::array<float,2>{0.797118962f, 0.753486097f},
-std::array<float,2>{0.494123042f, 0.539549649f},
-std::array<float,2>{0.743754625f, 0.151420042f},
-std::array<float,2>{0.179785654f, 0.0900543928f},
-std::array<float,2>{0.896584034f, 0.668456793f},
-std::array<float,2>{0.264583379f, 0.914533198f},
-std::array<float,2>{0.532124817f, 0.448366791f},
-std::array<float,2>{0.475334197f, 0.253210306f},
-std::array<float,2>{0.726486981f, 0.807801127f},
-std::array<float,2>{0.106524199f, 0.500254631f},
-std::array<float,2>{0.790340781f, 0.157905072f},
-std::array<float,2>{0.353069991f, 0.242649615f},
-std::array<float,2>{0.575519204f, 0.591480732f},
-std::array<float,2>{0.19521217f, 0.856940567f},
-std::array<float,2>{0.993182957f, 0.368403822f},
-std::array<float,2>{0.0300541613f, 0.385453165f},
-std::array<float,2>{0.823502421f, 0.982872188f},
-std::array<float,2>{0.426775157f, 0.698767602f},
-std::array<float,2>{0.660501122f, 0.0119658755f},
-std::array<float,2>{0.0691715106f, 0.1297362f},
-std::array<float,2>{0.768074155f, 0.556732893f},
-std::array<float,2>{0.466393113f, 0.780760884f},
-std::array<float,2>{0.69776839f, 0.311744839f},
-std::array<float,2>{0.297977179f, 0.477192163f},
-std::array<float,2>{0.52343744f, 0.901775062f},
-std::array<float,2>{0.128536835f, 0.645677686f},
-std::array<float,2>{0.908826053f, 0.0956227556f},
-std::array<float,2>{0.376389712f, 0.0599954575f},
-std::array<float,2>{0.626103699f, 0.737540901f},
-std::array<float,2>{0.0408569165f, 0.952624977f},
-std::array<float,2>{0.870175362f, 0.422284126f},
-std::array<float,2>{0.24296388f, 0.339954525f},
-std::array<float,2>{0.947084546f, 0.842448115f},
-std::array<float,2>{0.332212299f, 0.613307416f},
-std::array<float,2>{0.62210834f, 0.212713227f},
-std::array<float,2>{0.08634267f, 0.0472388864f},
-std::array<float,2>{0.765214264f, 0.748417616f},
-std::array<float,2>{0.450855613f, 0.945196748f},
-std::array<float,2>{0.718574047f, 0.436244786f},
-std::array<float,2>{0.284647852f, 0.328382462f},
-std::array<float,2>{0.513571024f, 0.828846812f},
-std::array<float,2>{0.143242329f, 0.618820548f},
-std::array<float,2>{0.931862116f, 0.210110426f},
-std::array<float,2>{0.393568277f, 0.138447791f},
-std::array<float,2>{0.652740419f, 0.549760282f},
-std::array<float,2>{0.0567204244f, 0.772607207f},
-std::array<float,2>{0.848074973f, 0.300090998f},
-std::array<float,2>{0.234141454f, 0.471621364f},
-std::array<float,2>{0.955494523f, 0.893426836f},
-std::array<float,2>{0.324815303f, 0.652667105f},
-std::array<float,2>{0.595315218f, 0.105010837f},
-std::array<float,2>{0.166140124f, 0.240871459f},
-std::array<float,2>{0.883167922f, 0.580362141f},
-std::array<float,2>{0.269105852f, 0.84423244f},
-std::array<float,2>{0.549736857f, 0.365525514f},
-std::array<float,2>{0.497118652f, 0.375689656f},
-std::array<float,2>{0.748311043f, 0.97163403f},
-std::array<float,2>{0.117015056f, 0.694705665f},
-std::array<float,2>{0.803921044f, 0.00442496175f},
-std::array<float,2>{0.362007707f, 0.0801221952f},
-std::array<float,2>{0.587741375f, 0.663067579f},
-std::array<float,2>{0.214650899f, 0.910073876f},
-std::array<float,2>{0.975434721f, 0.439349532f},
-std::array<float,2>{0.0073002209f, 0.258747339f},
-std::array<float,2>{0.830130219f, 0.797073603f},
-std::array<float,2>{0.406886786f, 0.50859791f},
-std::array<float,2>{0.677990437f, 0.16831404f},
-std::array<float,2>{0.191084519f, 0.115087748f},
-std::array<float,2>{0.998518348f, 0.637337267f},
-std::array<float,2>{0.356741667f, 0.884110391f},
-std::array<float,2>{0.572008967f, 0.492678672f},
-std::array<float,2>{0.425602794f, 0.28354013f},
-std::array<float,2>{0.656488597f, 0.761261344f},
-std::array<float,2>{0.0265226513f, 0.535471261f},
-std::array<float,2>{0.825619757f, 0.147240579f},
-std::array<float,2>{0.25949043f, 0.188120142f},
-std::array<float,2>{0.53825593f, 0.601391792f},
-std::array<float,2>{0.185721919f, 0.825167656f},
-std::array<float,2>{0.892604649f, 0.319246441f},
-std::array<float,2>{0.102721304f, 0.419541836f},
-std::array<float,2>{0.796408772f, 0.962363064f},
-std::array<float,2>{0.471011221f, 0.719216526f},
-std::array<float,2>{0.719715297f, 0.0369932987f},
-std::array<float,2>{0.0448266789f, 0.17323631f},
-std::array<float,2>{0.874110878f, 0.518428028f},
-std::array<float,2>{0.382392943f, 0.791025162f},
-std::array<float,2>{0.6326859f, 0.275579959f},
-std::array<float,2>{0.329892486f, 0.45577839f},
-std::array<float,2>{0.617981672f, 0.932687223f},
-std::array<float,2>{0.24870576f, 0.685778916f},
-std::array<float,2>{0.95077318f, 0.0671797991f},
-std::array<float,2>{0.464499563f, 0.0311063528f},
-std::array<float,2>{0.702243567f, 0.711191773f},
-std::array<float,2>{0.0632349774f, 0.997434258f},
-std::array<float,2>{0.770845115f, 0.394056171f},
-std::array<float,2>{0.1291226f, 0.353546679f},
-std::array<float,2>{0.911109388f, 0.872854352f},
-std::array<float,2>{0.302837312f, 0.568894804f},
-std::array<float,2>{0.515785038f, 0.227189347f},
-std::array<float,2>{0.0224218182f, 0.0711688921f},
-std::array<float,2>{0.817698777f, 0.677111387f},
-std::array<float,2>{0.432199538f, 0.927008986f},
-std::array<float,2>{0.66631341f, 0.463043988f},
-std::array<float,2>{0.346594632f, 0.267464846f},
-std::array<float,2>{0.567857385f, 0.787491918f},
-std::array<float,2>{0.196590275f, 0.523572326f},
-std::array<float,2>{0.987833917f, 0.18251811f},
-std::array<float,2>{0.479192197f, 0.22196269f},
-std::array<float,2>{0.729821324f, 0.571313858f},
-std::array<float,2>{0.101207398f, 0.860653281f},
-std::array<float,2>{0.785052061f, 0.346410722f},
-std::array<float,2>{0.173898503f, 0.399016887f},
-std::array<float,2>{0.903345168f, 0.990747392f},
-std::array<float,2>{0.251807898f, 0.709441423f},
-std::array<float,2>{0.539176404f, 0.0198761355f},
-std::array<float,2>{0.239875615f, 0.155947879f},
-std::array<float,2>{0.93806237f, 0.546429217f},
-std::array<float,2>{0.340248674f, 0.754473507f},
-std::array<float,2>{0.614127696f, 0.29140529f},
-std::array<float,2>{0.383769631f, 0.491449267f},
-std::array<float,2>{0.635551691f, 0.881822109f},
-std::array<float,2>{0.0369114168f, 0.626823902f},
-std::array<float,2>{0.867013693f, 0.121066593f},
-std::array<float,2>{0.306695491f, 0.046654243f},
-std::array<float,2>{0.526034653f, 0.727434874f},
-std::array<float,2>{0.13661018f, 0.960553348f},
-std::array<float,2>{0.920300305f, 0.413928241f},
-std::array<float,2>{0.0705566257f, 0.326275796f},
-std::array<float,2>{0.777752638f, 0.817809582f},
-std::array<float,2>{0.460642666f, 0.607283711f},
-std::array<float,2>{0.687771976f, 0.196267068f},
-std::array<float,2>{0.149610966f, 0.00960339792f},
-std::array<float,2>{0.928220809f, 0.699605227f},
-std::array<float,2>{0.292362332f, 0.979132473f},
-std::array<float,2>{0.506125152f, 0.387414008f},
-std::array<float,2>{0.443803579f, 0.374798805f},
-std::array<float,2>{0.708742321f, 0.851754308f},
-std::array<float,2>{0.0837814435f, 0.588670671f},
-std::array<float,2>{0.751845419f, 0.249233186f},
-std::array<float,2>{0.312587291f, 0.163779587f},
-std::array<float,2>{0.603453219f, 0.507128239f},
-std::array<float,2>{0.219703659f, 0.811299682f},
-std::array<float,2>{0.965761006f, 0.257457823f},
-std::array<float,2>{0.0511914715f, 0.450432718f},
-std::array<float,2>{0.856399953f, 0.920338213f},
-std::array<float,2>{0.403106838f, 0.666245461f},
-std::array<float,2>{0.643092752f, 0.0882157907f},
-std::array<float,2>{0.124833688f, 0.218312323f},
-std::array<float,2>{0.811681867f, 0.610842109f},
-std::array<float,2>{0.484694302f, 0.837232351f},
-std::array<float,2>{0.741594076f, 0.336221367f},
-std::array<float,2>{0.280091703f, 0.426294744f},
-std::array<float,2>{0.555957496f, 0.946832716f},
-std::array<float,2>{0.160889864f, 0.740515053f},
-std::array<float,2>{0.880916715f, 0.0585028529f},
-std::array<float,2>{0.418548614f, 0.0988349393f},
-std::array<float,2>{0.680541813f, 0.642851651f},
-std::array<float,2>{0.0127490079f, 0.903016448f},
-std::array<float,2>{0.841422617f, 0.480635852f},
-std::array<float,2>{0.208370894f, 0.306544125f},
-std::array<float,2>{0.976984441f, 0.774124742f},
-std::array<float,2>{0.373384535f, 0.560278118f},
-std::array<float,2>{0.585760415f, 0.125805885f},
-std::array<float,2>{0.107407711f, 0.0929088518f},
-std::array<float,2>{0.790847898f, 0.670384645f},
-std::array<float,2>{0.474896163f, 0.916878462f},
-std::array<float,2>{0.725647271f, 0.446854532f},
-std::array<float,2>{0.264142454f, 0.251306176f},
-std::array<float,2>{0.531325698f, 0.805205643f},
-std::array<float,2>{0.180426911f, 0.502148926f},
-std::array<float,2>{0.897400558f, 0.159616187f},
-std::array<float,2>{0.427294165f, 0.244733632f},
-std::array<float,2>{0.660801232f, 0.593406796f},
-std::array<float,2>{0.0297610592f, 0.857841432f},
-std::array<float,2>{0.823856235f, 0.369338065f},
-std::array<float,2>{0.194346905f, 0.383975685f},
-std::array<float,2>{0.993736804f, 0.981644034f},
-std::array<float,2>{0.352942467f, 0.697238684f},
-std::array<float,2>{0.575707316f, 0.0142507283f},
-std::array<float,2>{0.128239378f, 0.132152319f},
-std::array<float,2>{0.908244669f, 0.555330396f},
-std::array<float,2>{0.298378438f, 0.778095484f},
-std::array<float,2>{0.522812545f, 0.309237868f},
-std::array<float,2>{0.465850741f, 0.47882548f},
-std::array<float,2>{0.697303355f, 0.898983419f},
-std::array<float,2>{0.0687701553f, 0.64806807f},
-std::array<float,2>{0.767888904f, 0.0976525545f},
-std::array<float,2>{0.332598776f, 0.0623160005f},
-std::array<float,2>{0.622979045f, 0.735474527f},
-std::array<float,2>{0.242540479f, 0.950417638f},
-std::array<float,2>{0.946774483f, 0.423926711f},
-std::array<float,2>{0.0404835865f, 0.343322724f},
-std::array<float,2>{0.870678484f, 0.840923488f},
-std::array<float,2>{0.376811326f, 0.617070258f},
-std::array<float,2>{0.626800835f, 0.214233965f},
-std::array<float,2>{0.228982523f, 0.0167064406f},
-std::array<float,2>{0.958388925f, 0.705294669f},
-std::array<float,2>{0.322692543f, 0.985456765f},
-std::array<float,2>{0.599969208f, 0.40605545f},
-std::array<float,2>{0.39571631f, 0.350203931f},
-std::array<float,2>{0.648648918f, 0.867174685f},
-std::array<float,2>{0.0597817115f, 0.576805651f},
-std::array<float,2>{0.847016871f, 0.223990202f},
-std::array<float,2>{0.287678838f, 0.184830442f},
-std::array<float,2>{0.508697987f, 0.527464211f},
-std::array<float,2>{0.144577414f, 0.782419384f},
-std::array<float,2>{0.936810613f, 0.273374617f},
-std::array<float,2>{0.0905096903f, 0.467681974f},
-std::array<float,2>{0.758020401f, 0.923112273f},
-std::array<float,2>{0.447040498f, 0.673574686f},
-std::array<float,2>{0.711452663f, 0.0769179016f},
-std::array<float,2>{0.00382556068f, 0.201105669f},
-std::array<float,2>{0.834737003f, 0.60242939f},
-std::array<float,2>{0.411100358f, 0.813389838f},
-std::array<float,2>{0.674889863f, 0.323070526f},
-std::array<float,2>{0.365698457f, 0.409462661f},
-std::array<float,2>{0.592132866f, 0.953250647f},
-std::array<float,2>{0.216791719f, 0.733099461f},
-std::array<float,2>{0.972265244f, 0.0422074795f},
-std::array<float,2>{0.493216634f, 0.121527843f},
-std::array<float,2>{0.743577361f, 0.629456639f},
-std::array<float,2>{0.111364938f, 0.8757599f},
-std::array<float,2>{0.797840178f, 0.487026185f},
-std::array<float,2>{0.170277342f, 0.296434522f},
-std::array<float,2>{0.88979888f, 0.751947045f},
-std::array<float,2>{0.272060364f, 0.542247951f},
-std::array<float,2>{0.551288784f, 0.148609415f},
-std::array<float,2>{0.0491927266f, 0.0333853327f},
-std::array<float,2>{0.852374554f, 0.723330259f},
-std::array<float,2>{0.399342746f, 0.965648532f},
-std::array<float,2>{0.644824147f, 0.414267987f},
-std::array<float,2>{0.319414735f, 0.312959552f},
-std::array<float,2>{0.60871017f, 0.823250711f},
-std::array<float,2>{0.226041988f, 0.594688654f},
-std::array<float,2>{0.962519288f, 0.193771318f},
-std::array<float,2>{0.438969672f, 0.142201617f},
-std::array<float,2>{0.703262925f, 0.534178734f},
-std::array<float,2>{0.0818507597f, 0.764793456f},
-std::array<float,2>{0.75707531f, 0.285807639f},
-std::array<float,2>{0.154513791f, 0.497430295f},
-std::array<float,2>{0.925706744f, 0.889904797f},
-std::array<float,2>{0.29449442f, 0.633443177f},
-std::array<float,2>{0.502649546f, 0.109646961f},
-std::array<float,2>{0.206426576f, 0.232665196f},
-std::array<float,2>{0.983384013f, 0.563350737f},
-std::array<float,2>{0.369731992f, 0.869866669f},
-std::array<float,2>{0.580713689f, 0.359351307f},
-std::array<float,2>{0.414111495f, 0.396767139f},
-std::array<float,2>{0.686783791f, 0.992899954f},
-std::array<float,2>{0.0107406322f, 0.717238843f},
-std::array<float,2>{0.837008953f, 0.0264570899f},
-std::array<float,2>{0.274259001f, 0.0661908388f},
-std::array<float,2>{0.560164571f, 0.68165338f},
-std::array<float,2>{0.15633209f, 0.936049879f},
-std::array<float,2>{0.876333117f, 0.46069634f},
-std::array<float,2>{0.118953466f, 0.278830498f},
-std::array<float,2>{0.804804206f, 0.796768248f},
-std::array<float,2>{0.490088612f, 0.521587968f},
-std::array<float,2>{0.73441565f, 0.176066652f},
-std::array<float,2>{0.178043351f, 0.108099759f},
-std::array<float,2>{0.901192248f, 0.649017453f},
-std::array<float,2>{0.254812777f, 0.897186875f},
-std::array<float,2>{0.543810904f, 0.474687517f},
-std::array<float,2>{0.481405437f, 0.302046776f},
-std::array<float,2>{0.733101189f, 0.769277573f},
-std::array<float,2>{0.095717594f, 0.55274868f},
-std::array<float,2>{0.788900971f, 0.13329196f},
-std::array<float,2>{0.350248039f, 0.205899447f},
-std::array<float,2>{0.565628171f, 0.623164594f},
-std::array<float,2>{0.202265739f, 0.832573414f},
-std::array<float,2>{0.991325319f, 0.33328265f},
-std::array<float,2>{0.0162639469f, 0.431897849f},
-std::array<float,2>{0.81445092f, 0.938107252f},
-std::array<float,2>{0.437378973f, 0.744716406f},
-std::array<float,2>{0.671697497f, 0.0525166504f},
-std::array<float,2>{0.0774496943f, 0.16641663f},
-std::array<float,2>{0.773940861f, 0.512097299f},
-std::array<float,2>{0.454086959f, 0.801488519f},
-std::array<float,2>{0.691553116f, 0.263542444f},
-std::array<float,2>{0.31087178f, 0.443435103f},
-std::array<float,2>{0.531193912f, 0.912520528f},
-std::array<float,2>{0.139056996f, 0.657775879f},
-std::array<float,2>{0.91510874f, 0.0857105926f},
-std::array<float,2>{0.389858872f, 0.0010931266f},
-std::array<float,2>{0.639635384f, 0.69119364f},
-std::array<float,2>{0.0314621106f, 0.974859357f},
-std::array<float,2>{0.861864507f, 0.381741434f},
-std::array<float,2>{0.236900374f, 0.360338509f},
-std::array<float,2>{0.944326222f, 0.848082483f},
-std::array<float,2>{0.337393105f, 0.582474828f},
-std::array<float,2>{0.61059922f, 0.236244857f},
-std::array<float,2>{0.0833944678f, 0.0110266833f},
-std::array<float,2>{0.751371503f, 0.702407658f},
-std::array<float,2>{0.444265634f, 0.976880074f},
-std::array<float,2>{0.708182335f, 0.390180707f},
-std::array<float,2>{0.292735189f, 0.371116132f},
-std::array<float,2>{0.506450534f, 0.854198217f},
-std::array<float,2>{0.150321886f, 0.58632791f},
-std::array<float,2>{0.928500056f, 0.247359201f},
-std::array<float,2>{0.402626902f, 0.160957843f},
-std::array<float,2>{0.642899215f, 0.50557071f},
-std::array<float,2>{0.0514405183f, 0.809468806f},
-std::array<float,2>{0.855488837f, 0.254974395f},
-std::array<float,2>{0.219113111f, 0.45132345f},
-std::array<float,2>{0.965101957f, 0.918548644f},
-std::array<float,2>{0.313405722f, 0.664827943f},
-std::array<float,2>{0.602945328f, 0.0866842121f},
-std::array<float,2>{0.160202757f, 0.216535032f},
-std::array<float,2>{0.881721377f, 0.611337125f},
-std::array<float,2>{0.279431581f, 0.83821702f},
-std::array<float,2>{0.556332171f, 0.338650525f},
-std::array<float,2>{0.485169232f, 0.42897889f},
-std::array<float,2>{0.742067695f, 0.947323024f},
-std::array<float,2>{0.124238864f, 0.738387585f},
-std::array<float,2>{0.81213969f, 0.0558434762f},
-std::array<float,2>{0.373646885f, 0.0998856202f},
-std::array<float,2>{0.585418284f, 0.640649319f},
-std::array<float,2>{0.208553717f, 0.905359447f},
-std::array<float,2>{0.977233946f, 0.484287351f},
-std::array<float,2>{0.0132471556f, 0.307444721f},
-std::array<float,2>{0.841067493f, 0.776838541f},
-std::array<float,2>{0.418380946f, 0.561983168f},
-std::array<float,2>{0.680069864f, 0.127741054f},
-std::array<float,2>{0.196792275f, 0.0723719969f},
-std::array<float,2>{0.987762928f, 0.678560674f},
-std::array<float,2>{0.345829695f, 0.927841187f},
-std::array<float,2>{0.568019152f, 0.462467015f},
-std::array<float,2>{0.431793392f, 0.268123984f},
-std::array<float,2>{0.666747749f, 0.786154091f},
-std::array<float,2>{0.0215302445f, 0.52613467f},
-std::array<float,2>{0.817968845f, 0.180108622f},
-std::array<float,2>{0.251354069f, 0.219247729f},
-std::array<float,2>{0.53973788f, 0.573292434f},
-std::array<float,2>{0.174413353f, 0.861916721f},
-std::array<float,2>{0.903911233f, 0.343765944f},
-std::array<float,2>{0.100950532f, 0.400593489f},
-std::array<float,2>{0.784474373f, 0.989836454f},
-std::array<float,2>{0.478636593f, 0.708521008f},
-std::array<float,2>{0.730468631f, 0.0230341312f},
-std::array<float,2>{0.0363845751f, 0.153077558f},
-std::array<float,2>{0.866627038f, 0.543777287f},
-std::array<float,2>{0.383153319f, 0.756655335f},
-std::array<float,2>{0.634922624f, 0.290281028f},
-std::array<float,2>{0.340578049f, 0.489343613f},
-std::array<float,2>{0.613441646f, 0.879522264f},
-std::array<float,2>{0.23939234f, 0.627690494f},
-std::array<float,2>{0.937525332f, 0.117850251f},
-std::array<float,2>{0.460001022f, 0.0438016504f},
-std::array<float,2>{0.688188374f, 0.729903221f},
-std::array<float,2>{0.0708544329f, 0.957564116f},
-std::array<float,2>{0.778031528f, 0.411626071f},
-std::array<float,2>{0.136083141f, 0.324662507f},
-std::array<float,2>{0.920544863f, 0.819065511f},
-std::array<float,2>{0.307464272f, 0.608216643f},
-std::array<float,2>{0.525840223f, 0.197910428f},
-std::array<float,2>{0.0271315854f, 0.117093824f},
-std::array<float,2>{0.825792015f, 0.63987726f},
-std::array<float,2>{0.42493996f, 0.885143161f},
-std::array<float,2>{0.657170713f, 0.495451659f},
-std::array<float,2>{0.357102185f, 0.283108354f},
-std::array<float,2>{0.571467519f, 0.758763671f},
-std::array<float,2>{0.190514445f, 0.537662864f},
-std::array<float,2>{0.998588502f, 0.145045504f},
-std::array<float,2>{0.471246421f, 0.189684331f},
-std::array<float,2>{0.719118476f, 0.598502576f},
-std::array<float,2>{0.103372112f, 0.827658892f},
-std::array<float,2>{0.79622519f, 0.317346156f},
-std::array<float,2>{0.186314717f, 0.421695352f},
-std::array<float,2>{0.893182933f, 0.964528918f},
-std::array<float,2>{0.259070188f, 0.722270727f},
-std::array<float,2>{0.538965404f, 0.0373433977f},
-std::array<float,2>{0.248521432f, 0.175262243f},
-std::array<float,2>{0.950367093f, 0.515670121f},
-std::array<float,2>{0.329158008f, 0.7891379f},
-std::array<float,2>{0.617644072f, 0.274117798f},
-std::array<float,2>{0.382032961f, 0.454411924f},
-std::array<float,2>{0.632063925f, 0.930530906f},
-std::array<float,2>{0.044248648f, 0.684957981f},
-std::array<float,2>{0.874757648f, 0.0700842589f},
-std::array<float,2>{0.303543925f, 0.0273739137f},
-std::array<float,2>{0.516506851f, 0.714452267f},
-std::array<float,2>{0.129666433f, 0.998311639f},
-std::array<float,2>{0.910409749f, 0.390931726f},
-std::array<float,2>{0.0625635535f, 0.352508456f},
-std::array<float,2>{0.771238804f, 0.873537779f},
-std::array<float,2>{0.463883966f, 0.566937685f},
-std::array<float,2>{0.702767372f, 0.229416072f},
-std::array<float,2>{0.142614812f, 0.0494611673f},
-std::array<float,2>{0.932439089f, 0.747000873f},
-std::array<float,2>{0.285008878f, 0.943170369f},
-std::array<float,2>{0.513033509f, 0.434563041f},
-std::array<float,2>{0.450385958f, 0.330914497f},
-std::array<float,2>{0.718127549f, 0.830604494f},
-std::array<float,2>{0.0868725106f, 0.621020257f},
-std::array<float,2>{0.76475054f, 0.208582416f},
-std::array<float,2>{0.324530035f, 0.139703706f},
-std::array<float,2>{0.594768167f, 0.548650205f},
-std::array<float,2>{0.233746082f, 0.770798564f},
-std::array<float,2>{0.955737114f, 0.297960699f},
-std::array<float,2>{0.057560645f, 0.470344752f},
-std::array<float,2>{0.848287582f, 0.891026378f},
-std::array<float,2>{0.394527495f, 0.654767334f},
-std::array<float,2>{0.653085411f, 0.101572074f},
-std::array<float,2>{0.116236798f, 0.239886418f},
-std::array<float,2>{0.804654539f, 0.579477847f},
-std::array<float,2>{0.497650027f, 0.845994234f},
-std::array<float,2>{0.748829901f, 0.363721639f},
-std::array<float,2>{0.269028157f, 0.37885797f},
-std::array<float,2>{0.549180329f, 0.969701827f},
-std::array<float,2>{0.16666694f, 0.692990899f},
-std::array<float,2>{0.883544445f, 0.00716476981f},
-std::array<float,2>{0.406673968f, 0.0781947449f},
-std::array<float,2>{0.678346455f, 0.660974383f},
-std::array<float,2>{0.00746539282f, 0.907083392f},
-std::array<float,2>{0.83094418f, 0.440616727f},
-std::array<float,2>{0.213895768f, 0.260334134f},
-std::array<float,2>{0.974963009f, 0.800101697f},
-std::array<float,2>{0.36161229f, 0.510895729f},
-std::array<float,2>{0.587053716f, 0.171030432f},
-std::array<float,2>{0.068320401f, 0.0947801173f},
-std::array<float,2>{0.765818059f, 0.646156192f},
-std::array<float,2>{0.467450321f, 0.901876211f},
-std::array<float,2>{0.695753872f, 0.476685584f},
-std::array<float,2>{0.299275398f, 0.312452018f},
-std::array<float,2>{0.521190047f, 0.781212032f},
-std::array<float,2>{0.126844227f, 0.557143629f},
-std::array<float,2>{0.906708956f, 0.129144341f},
-std::array<float,2>{0.378479958f, 0.212233648f},
-std::array<float,2>{0.628400624f, 0.614210129f},
-std::array<float,2>{0.041785866f, 0.841988444f},
-std::array<float,2>{0.867297828f, 0.340405047f},
-std::array<float,2>{0.24597083f, 0.422531843f},
-std::array<float,2>{0.949036479f, 0.952755749f},
-std::array<float,2>{0.335200906f, 0.738152862f},
-std::array<float,2>{0.623522222f, 0.0604168698f},
-std::array<float,2>{0.18252936f, 0.157345086f},
-std::array<float,2>{0.894984901f, 0.500839949f},
-std::array<float,2>{0.262813181f, 0.808267891f},
-std::array<float,2>{0.533560097f, 0.253565162f},
-std::array<float,2>{0.472811639f, 0.448958278f},
-std::array<float,2>{0.724270105f, 0.915014088f},
-std::array<float,2>{0.108814143f, 0.668873191f},
-std::array<float,2>{0.792414665f, 0.0903807282f},
-std::array<float,2>{0.353547484f, 0.012449855f},
-std::array<float,2>{0.577604413f, 0.698655128f},
-std::array<float,2>{0.191812992f, 0.982911289f},
-std::array<float,2>{0.994362593f, 0.385252982f},
-std::array<float,2>{0.0282795597f, 0.369119287f},
-std::array<float,2>{0.821533144f, 0.856891811f},
-std::array<float,2>{0.428041548f, 0.591022491f},
-std::array<float,2>{0.663458943f, 0.2430107f},
-std::array<float,2>{0.217218488f, 0.0397041366f},
-std::array<float,2>{0.969821572f, 0.732201755f},
-std::array<float,2>{0.363545418f, 0.956868708f},
-std::array<float,2>{0.590460718f, 0.40668726f},
-std::array<float,2>{0.412948012f, 0.320444137f},
-std::array<float,2>{0.673735857f, 0.814985871f},
-std::array<float,2>{0.000592456141f, 0.604909658f},
-std::array<float,2>{0.832053661f, 0.202357441f},
-std::array<float,2>{0.271006972f, 0.152335882f},
-std::array<float,2>{0.553355932f, 0.539576709f},
-std::array<float,2>{0.169775501f, 0.753111303f},
-std::array<float,2>{0.888238668f, 0.293653101f},
-std::array<float,2>{0.109811641f, 0.48546803f},
-std::array<float,2>{0.800031483f, 0.877974153f},
-std::array<float,2>{0.495340288f, 0.632243037f},
-std::array<float,2>{0.745504797f, 0.123557776f},
-std::array<float,2>{0.0611645617f, 0.225333646f},
-std::array<float,2>{0.844848394f, 0.575124204f},
-std::array<float,2>{0.396604806f, 0.864955246f},
-std::array<float,2>{0.651644886f, 0.349537194f},
-std::array<float,2>{0.321260899f, 0.403897643f},
-std::array<float,2>{0.598180592f, 0.986528754f},
-std::array<float,2>{0.22835733f, 0.703471184f},
-std::array<float,2>{0.960823357f, 0.018814873f},
-std::array<float,2>{0.447805524f, 0.0753205642f},
-std::array<float,2>{0.713098705f, 0.6751737f},
-std::array<float,2>{0.0929295793f, 0.925618291f},
-std::array<float,2>{0.760265887f, 0.46617648f},
-std::array<float,2>{0.147061229f, 0.270402908f},
-std::array<float,2>{0.934506953f, 0.783565879f},
-std::array<float,2>{0.286908507f, 0.53017205f},
-std::array<float,2>{0.511538804f, 0.187137619f},
-std::array<float,2>{0.00872440357f, 0.0238758866f},
-std::array<float,2>{0.838574052f, 0.716603875f},
-std::array<float,2>{0.416160464f, 0.994534314f},
-std::array<float,2>{0.684682369f, 0.395836622f},
-std::array<float,2>{0.367217034f, 0.356613845f},
-std::array<float,2>{0.579896986f, 0.867234051f},
-std::array<float,2>{0.20487757f, 0.564487815f},
-std::array<float,2>{0.982295394f, 0.231270313f},
-std::array<float,2>{0.490898371f, 0.178444475f},
-std::array<float,2>{0.737356007f, 0.519643426f},
-std::array<float,2>{0.119732164f, 0.793005288f},
-std::array<float,2>{0.807066917f, 0.279887408f},
-std::array<float,2>{0.159904808f, 0.45829913f},
-std::array<float,2>{0.878460586f, 0.93457979f},
-std::array<float,2>{0.276065171f, 0.681575716f},
-std::array<float,2>{0.562283218f, 0.063830778f},
-std::array<float,2>{0.224126741f, 0.192121178f},
-std::array<float,2>{0.964440167f, 0.596203148f},
-std::array<float,2>{0.316999137f, 0.821543217f},
-std::array<float,2>{0.606758714f, 0.316337854f},
-std::array<float,2>{0.402062893f, 0.4173944f},
-std::array<float,2>{0.647934377f, 0.968105316f},
-std::array<float,2>{0.0468967631f, 0.726552367f},
-std::array<float,2>{0.8551144f, 0.0326036401f},
-std::array<float,2>{0.296868294f, 0.112932585f},
-std::array<float,2>{0.501744926f, 0.636190951f},
-std::array<float,2>{0.153386161f, 0.887776673f},
-std::array<float,2>{0.92371136f, 0.498176634f},
-std::array<float,2>{0.079982385f, 0.288822085f},
-std::array<float,2>{0.755618036f, 0.763316214f},
-std::array<float,2>{0.440934956f, 0.532310188f},
-std::array<float,2>{0.706530333f, 0.143133253f},
-std::array<float,2>{0.137027517f, 0.0839600414f},
-std::array<float,2>{0.917360306f, 0.659663677f},
-std::array<float,2>{0.308732331f, 0.911092699f},
-std::array<float,2>{0.528516233f, 0.443327695f},
-std::array<float,2>{0.456283033f, 0.264746636f},
-std::array<float,2>{0.694408238f, 0.804363251f},
-std::array<float,2>{0.0755584463f, 0.51376164f},
-std::array<float,2>{0.777041852f, 0.165905908f},
-std::array<float,2>{0.339289248f, 0.238105744f},
-std::array<float,2>{0.611503541f, 0.585542977f},
-std::array<float,2>{0.235872716f, 0.850935221f},
-std::array<float,2>{0.9418872f, 0.362172961f},
-std::array<float,2>{0.0347041525f, 0.379627734f},
-std::array<float,2>{0.860984027f, 0.974306285f},
-std::array<float,2>{0.387438148f, 0.689014196f},
-std::array<float,2>{0.636938572f, 0.00339837209f},
-std::array<float,2>{0.09443257f, 0.135795414f},
-std::array<float,2>{0.785551071f, 0.552509367f},
-std::array<float,2>{0.483779222f, 0.767097056f},
-std::array<float,2>{0.731689215f, 0.304514408f},
-std::array<float,2>{0.256206185f, 0.472709566f},
-std::array<float,2>{0.545864403f, 0.895676136f},
-std::array<float,2>{0.176338449f, 0.650494277f},
-std::array<float,2>{0.898977757f, 0.105851665f},
-std::array<float,2>{0.435173035f, 0.0538921095f},
-std::array<float,2>{0.669418514f, 0.743394375f},
-std::array<float,2>{0.0188322589f, 0.940976441f},
-std::array<float,2>{0.815568268f, 0.430914789f},
-std::array<float,2>{0.1996755f, 0.334720969f},
-std::array<float,2>{0.988689601f, 0.834214091f},
-std::array<float,2>{0.347769737f, 0.622306824f},
-std::array<float,2>{0.562765896f, 0.203617662f},
-std::array<float,2>{0.121458784f, 0.0580926463f},
-std::array<float,2>{0.808874667f, 0.740931928f},
-std::array<float,2>{0.486964047f, 0.946580529f},
-std::array<float,2>{0.740205705f, 0.426172614f},
-std::array<float,2>{0.277580082f, 0.336816192f},
-std::array<float,2>{0.557760775f, 0.837729752f},
-std::array<float,2>{0.163626477f, 0.610442698f},
-std::array<float,2>{0.879506171f, 0.217862114f},
-std::array<float,2>{0.420975089f, 0.125061169f},
-std::array<float,2>{0.682502985f, 0.560033381f},
-std::array<float,2>{0.0141321961f, 0.773744941f},
-std::array<float,2>{0.841895401f, 0.306098461f},
-std::array<float,2>{0.209714323f, 0.480978668f},
-std::array<float,2>{0.979502022f, 0.902784526f},
-std::array<float,2>{0.371449471f, 0.643144727f},
-std::array<float,2>{0.582256138f, 0.0995358974f},
-std::array<float,2>{0.150728866f, 0.249688879f},
-std::array<float,2>{0.926263094f, 0.588122666f},
-std::array<float,2>{0.28932336f, 0.852151573f},
-std::array<float,2>{0.505075693f, 0.37429902f},
-std::array<float,2>{0.443131566f, 0.387168199f},
-std::array<float,2>{0.710363269f, 0.978941858f},
-std::array<float,2>{0.0853426084f, 0.699932456f},
-std::array<float,2>{0.752849281f, 0.00895140693f},
-std::array<float,2>{0.315547854f, 0.0885827914f},
-std::array<float,2>{0.604489625f, 0.666866541f},
-std::array<float,2>{0.221699446f, 0.920806885f},
-std::array<float,2>{0.967346549f, 0.451137722f},
-std::array<float,2>{0.0538974851f, 0.25700438f},
-std::array<float,2>{0.85901767f, 0.810763597f},
-std::array<float,2>{0.405860364f, 0.507493973f},
-std::array<float,2>{0.641373634f, 0.163500667f},
-std::array<float,2>{0.241670609f, 0.120181099f},
-std::array<float,2>{0.940114081f, 0.62625289f},
-std::array<float,2>{0.342298925f, 0.881225526f},
-std::array<float,2>{0.615887284f, 0.491737902f},
-std::array<float,2>{0.384831578f, 0.291892916f},
-std::array<float,2>{0.634391963f, 0.753933609f},
-std::array<float,2>{0.0384251624f, 0.546128869f},
-std::array<float,2>{0.864281714f, 0.155733809f},
-std::array<float,2>{0.305831075f, 0.195747331f},
-std::array<float,2>{0.525347948f, 0.606773794f},
-std::array<float,2>{0.134436578f, 0.817893326f},
-std::array<float,2>{0.919068098f, 0.326905996f},
-std::array<float,2>{0.0724681318f, 0.413103312f},
-std::array<float,2>{0.780032635f, 0.960037768f},
-std::array<float,2>{0.457956612f, 0.726816535f},
-std::array<float,2>{0.691269457f, 0.0461493582f},
-std::array<float,2>{0.020290859f, 0.181997329f},
-std::array<float,2>{0.818572938f, 0.524413884f},
-std::array<float,2>{0.431504905f, 0.787775636f},
-std::array<float,2>{0.66548264f, 0.2666457f},
-std::array<float,2>{0.344463527f, 0.463814378f},
-std::array<float,2>{0.56845969f, 0.9276492f},
-std::array<float,2>{0.199206382f, 0.677382886f},
-std::array<float,2>{0.985243917f, 0.070756413f},
-std::array<float,2>{0.477071881f, 0.0203861278f},
-std::array<float,2>{0.728417397f, 0.709672034f},
-std::array<float,2>{0.0993579775f, 0.990608633f},
-std::array<float,2>{0.782186508f, 0.398794651f},
-std::array<float,2>{0.1733284f, 0.345876098f},
-std::array<float,2>{0.904971659f, 0.861275017f},
-std::array<float,2>{0.252902746f, 0.571847141f},
-std::array<float,2>{0.542209744f, 0.222343072f},
-std::array<float,2>{0.0450920761f, 0.066771023f},
-std::array<float,2>{0.872829735f, 0.686321974f},
-std::array<float,2>{0.37910825f, 0.933214962f},
-std::array<float,2>{0.629955232f, 0.455230653f},
-std::array<float,2>{0.332015216f, 0.276355445f},
-std::array<float,2>{0.619404554f, 0.791853249f},
-std::array<float,2>{0.247666284f, 0.518055081f},
-std::array<float,2>{0.951463163f, 0.173507959f},
-std::array<float,2>{0.461497337f, 0.226746947f},
-std::array<float,2>{0.700627446f, 0.568399429f},
-std::array<float,2>{0.0661859661f, 0.872120738f},
-std::array<float,2>{0.772079289f, 0.354120493f},
-std::array<float,2>{0.131157279f, 0.393630117f},
-std::array<float,2>{0.913615704f, 0.997976601f},
-std::array<float,2>{0.302400678f, 0.711889744f},
-std::array<float,2>{0.517825902f, 0.03052257f},
-std::array<float,2>{0.188787863f, 0.146836892f},
-std::array<float,2>{0.996635377f, 0.535743594f},
-std::array<float,2>{0.35920468f, 0.760757983f},
-std::array<float,2>{0.573266745f, 0.2841115f},
-std::array<float,2>{0.423153281f, 0.492519081f},
-std::array<float,2>{0.6593799f, 0.884629667f},
-std::array<float,2>{0.0237347782f, 0.636912882f},
-std::array<float,2>{0.827203691f, 0.114659026f},
-std::array<float,2>{0.260821849f, 0.0363166854f},
-std::array<float,2>{0.536909759f, 0.719450116f},
-std::array<float,2>{0.184624329f, 0.962490022f},
-std::array<float,2>{0.89220643f, 0.418960303f},
-std::array<float,2>{0.104301207f, 0.318454981f},
-std::array<float,2>{0.793219209f, 0.824442565f},
-std::array<float,2>{0.468969703f, 0.601051152f},
-std::array<float,2>{0.721491516f, 0.18751581f},
-std::array<float,2>{0.165132776f, 0.00403414899f},
-std::array<float,2>{0.885477483f, 0.695149541f},
-std::array<float,2>{0.265912235f, 0.970903933f},
-std::array<float,2>{0.547107935f, 0.375364572f},
-std::array<float,2>{0.498650759f, 0.365889102f},
-std::array<float,2>{0.746764421f, 0.84446156f},
-std::array<float,2>{0.114228278f, 0.580906689f},
-std::array<float,2>{0.801157951f, 0.24027659f},
-std::array<float,2>{0.360313296f, 0.168550938f},
-std::array<float,2>{0.589474201f, 0.508294046f},
-std::array<float,2>{0.211260647f, 0.797653675f},
-std::array<float,2>{0.974259794f, 0.257829964f},
-std::array<float,2>{0.00412923051f, 0.438485533f},
-std::array<float,2>{0.828686416f, 0.909223139f},
-std::array<float,2>{0.409637898f, 0.662343383f},
-std::array<float,2>{0.675989091f, 0.0806305408f},
-std::array<float,2>{0.0888732299f, 0.210804448f},
-std::array<float,2>{0.763602555f, 0.618644714f},
-std::array<float,2>{0.4516038f, 0.828273833f},
-std::array<float,2>{0.716241062f, 0.32894966f},
-std::array<float,2>{0.282961309f, 0.435602784f},
-std::array<float,2>{0.514708638f, 0.944720745f},
-std::array<float,2>{0.142147928f, 0.748785257f},
-std::array<float,2>{0.930196464f, 0.0475281104f},
-std::array<float,2>{0.392556995f, 0.10489291f},
-std::array<float,2>{0.655248523f, 0.653103054f},
-std::array<float,2>{0.0552787445f, 0.892912805f},
-std::array<float,2>{0.851294875f, 0.470736176f},
-std::array<float,2>{0.230472133f, 0.300593287f},
-std::array<float,2>{0.95502913f, 0.773331225f},
-std::array<float,2>{0.327981144f, 0.548891544f},
-std::array<float,2>{0.597414196f, 0.137763143f},
-std::array<float,2>{0.0924082324f, 0.0772462934f},
-std::array<float,2>{0.761392713f, 0.672363877f},
-std::array<float,2>{0.449048072f, 0.922027111f},
-std::array<float,2>{0.714399815f, 0.467997313f},
-std::array<float,2>{0.285384119f, 0.271779746f},
-std::array<float,2>{0.510441542f, 0.781685591f},
-std::array<float,2>{0.14763698f, 0.529019237f},
-std::array<float,2>{0.935333848f, 0.184152171f},
-std::array<float,2>{0.397847623f, 0.223110363f},
-std::array<float,2>{0.651028335f, 0.577239275f},
-std::array<float,2>{0.0622083135f, 0.865683854f},
-std::array<float,2>{0.844300687f, 0.351298779f},
-std::array<float,2>{0.22736007f, 0.405045837f},
-std::array<float,2>{0.959085524f, 0.985254467f},
-std::array<float,2>{0.322196126f, 0.706953764f},
-std::array<float,2>{0.599429846f, 0.0158247035f},
-std::array<float,2>{0.168840647f, 0.14977096f},
-std::array<float,2>{0.887558103f, 0.541685283f},
-std::array<float,2>{0.270297438f, 0.750669181f},
-std::array<float,2>{0.554077029f, 0.295327693f},
-std::array<float,2>{0.494175553f, 0.487911254f},
-std::array<float,2>{0.744566143f, 0.876466632f},
-std::array<float,2>{0.111020088f, 0.630008876f},
-std::array<float,2>{0.799479961f, 0.122791901f},
-std::array<float,2>{0.36485523f, 0.0414929613f},
-std::array<float,2>{0.59170258f, 0.73383224f},
-std::array<float,2>{0.218294472f, 0.955035031f},
-std::array<float,2>{0.968821764f, 0.408394217f},
-std::array<float,2>{0.00134626834f, 0.324013263f},
-std::array<float,2>{0.833258808f, 0.813826144f},
-std::array<float,2>{0.413798511f, 0.602651954f},
-std::array<float,2>{0.672213972f, 0.199260175f},
-std::array<float,2>{0.192770973f, 0.0147957802f},
-std::array<float,2>{0.99513644f, 0.695471227f},
-std::array<float,2>{0.355404288f, 0.980527937f},
-std::array<float,2>{0.576571524f, 0.382996678f},
-std::array<float,2>{0.429141581f, 0.370584816f},
-std::array<float,2>{0.663038433f, 0.858844936f},
-std::array<float,2>{0.0289076474f, 0.591910005f},
-std::array<float,2>{0.820594013f, 0.245658547f},
-std::array<float,2>{0.261983305f, 0.158596605f},
-std::array<float,2>{0.534404874f, 0.503009796f},
-std::array<float,2>{0.18316564f, 0.806199014f},
-std::array<float,2>{0.895587802f, 0.250664443f},
-std::array<float,2>{0.108320922f, 0.445980966f},
-std::array<float,2>{0.791738749f, 0.917119682f},
-std::array<float,2>{0.473681748f, 0.671780527f},
-std::array<float,2>{0.722830415f, 0.0922213718f},
-std::array<float,2>{0.0422990285f, 0.21342127f},
-std::array<float,2>{0.86893636f, 0.615281343f},
-std::array<float,2>{0.377322525f, 0.840752482f},
-std::array<float,2>{0.627647638f, 0.342072725f},
-std::array<float,2>{0.334926635f, 0.425185889f},
-std::array<float,2>{0.624177575f, 0.950006306f},
-std::array<float,2>{0.245103344f, 0.734545708f},
-std::array<float,2>{0.947550178f, 0.0605779141f},
-std::array<float,2>{0.468700379f, 0.0963505954f},
-std::array<float,2>{0.697241187f, 0.647415817f},
-std::array<float,2>{0.0672011599f, 0.899806082f},
-std::array<float,2>{0.767425358f, 0.479774684f},
-std::array<float,2>{0.125643268f, 0.309894979f},
-std::array<float,2>{0.90781498f, 0.77911073f},
-std::array<float,2>{0.300472528f, 0.556344151f},
-std::array<float,2>{0.519559205f, 0.13097173f},
-std::array<float,2>{0.0181428436f, 0.0511384979f},
-std::array<float,2>{0.814485848f, 0.745540738f},
-std::array<float,2>{0.434254199f, 0.939214051f},
-std::array<float,2>{0.668675721f, 0.433292925f},
-std::array<float,2>{0.349500775f, 0.332408607f},
-std::array<float,2>{0.56425041f, 0.833983779f},
-std::array<float,2>{0.200415522f, 0.624936879f},
-std::array<float,2>{0.990162432f, 0.206769094f},
-std::array<float,2>{0.483001381f, 0.134233072f},
-std::array<float,2>{0.730584919f, 0.553721249f},
-std::array<float,2>{0.0947419479f, 0.767779768f},
-std::array<float,2>{0.786962569f, 0.300998598f},
-std::array<float,2>{0.177369162f, 0.475721717f},
-std::array<float,2>{0.899751186f, 0.897567511f},
-std::array<float,2>{0.257434875f, 0.650146246f},
-std::array<float,2>{0.546136081f, 0.108675174f},
-std::array<float,2>{0.234907955f, 0.235099524f},
-std::array<float,2>{0.942931354f, 0.583936274f},
-std::array<float,2>{0.337919116f, 0.848851621f},
-std::array<float,2>{0.612743735f, 0.360428512f},
-std::array<float,2>{0.388348699f, 0.382219404f},
-std::array<float,2>{0.638105512f, 0.976522863f},
-std::array<float,2>{0.0335768647f, 0.689756036f},
-std::array<float,2>{0.85968256f, 0.00028827053f},
-std::array<float,2>{0.310381055f, 0.0842385367f},
-std::array<float,2>{0.528063238f, 0.656306624f},
-std::array<float,2>{0.138472438f, 0.913749039f},
-std::array<float,2>{0.916044176f, 0.444566071f},
-std::array<float,2>{0.0749619678f, 0.261741519f},
-std::array<float,2>{0.775648117f, 0.802588642f},
-std::array<float,2>{0.455642968f, 0.513487279f},
-std::array<float,2>{0.694127858f, 0.16739291f},
-std::array<float,2>{0.152496532f, 0.110624656f},
-std::array<float,2>{0.922287345f, 0.633867383f},
-std::array<float,2>{0.295537084f, 0.889528632f},
-std::array<float,2>{0.500347733f, 0.496250659f},
-std::array<float,2>{0.43959561f, 0.286628842f},
-std::array<float,2>{0.705607414f, 0.764185607f},
-std::array<float,2>{0.07905256f, 0.534696639f},
-std::array<float,2>{0.754072309f, 0.140784115f},
-std::array<float,2>{0.317987114f, 0.195238709f},
-std::array<float,2>{0.606440067f, 0.595440567f},
-std::array<float,2>{0.222851887f, 0.822751522f},
-std::array<float,2>{0.963803232f, 0.313480973f},
-std::array<float,2>{0.047996439f, 0.415772468f},
-std::array<float,2>{0.853841364f, 0.966539025f},
-std::array<float,2>{0.400466174f, 0.724053621f},
-std::array<float,2>{0.647197902f, 0.0349741466f},
-std::array<float,2>{0.120604351f, 0.177125201f},
-std::array<float,2>{0.808560193f, 0.522512019f},
-std::array<float,2>{0.491336673f, 0.794984639f},
-std::array<float,2>{0.736468017f, 0.277347445f},
-std::array<float,2>{0.277000308f, 0.459879607f},
-std::array<float,2>{0.560642779f, 0.936803222f},
-std::array<float,2>{0.158653036f, 0.683518827f},
-std::array<float,2>{0.8777017f, 0.06501472f},
-std::array<float,2>{0.417089522f, 0.0261171069f},
-std::array<float,2>{0.683785677f, 0.717936039f},
-std::array<float,2>{0.00880387705f, 0.993812799f},
-std::array<float,2>{0.838931084f, 0.398156583f},
-std::array<float,2>{0.203660831f, 0.357701927f},
-std::array<float,2>{0.980574191f, 0.870360374f},
-std::array<float,2>{0.368672609f, 0.564022422f},
-std::array<float,2>{0.578134656f, 0.233779877f},
-std::array<float,2>{0.0981943533f, 0.0221733749f},
-std::array<float,2>{0.782424927f, 0.707319558f},
-std::array<float,2>{0.477886528f, 0.98905021f},
-std::array<float,2>{0.727534235f, 0.401819974f},
-std::array<float,2>{0.253447294f, 0.345074862f},
-std::array<float,2>{0.541336775f, 0.863095522f},
-std::array<float,2>{0.171965048f, 0.572928607f},
-std::array<float,2>{0.905299604f, 0.219921216f},
-std::array<float,2>{0.429888308f, 0.181508094f},
-std::array<float,2>{0.664570212f, 0.5270046f},
-std::array<float,2>{0.0208186824f, 0.785931706f},
-std::array<float,2>{0.819458008f, 0.269360751f},
-std::array<float,2>{0.197664887f, 0.461007804f},
-std::array<float,2>{0.986013591f, 0.929085553f},
-std::array<float,2>{0.345003575f, 0.679108143f},
-std::array<float,2>{0.569618344f, 0.0735992417f},
-std::array<float,2>{0.133651838f, 0.198445171f},
-std::array<float,2>{0.918387115f, 0.609298348f},
-std::array<float,2>{0.304722607f, 0.81977731f},
-std::array<float,2>{0.523765981f, 0.325237274f},
-std::array<float,2>{0.45898211f, 0.410593808f},
-std::array<float,2>{0.690090597f, 0.958425939f},
-std::array<float,2>{0.0741191432f, 0.728806853f},
-std::array<float,2>{0.780938387f, 0.0448421761f},
-std::array<float,2>{0.342885405f, 0.118243545f},
-std::array<float,2>{0.616568804f, 0.628317297f},
-std::array<float,2>{0.240352586f, 0.880080462f},
-std::array<float,2>{0.940666854f, 0.48908782f},
-std::array<float,2>{0.0379037857f, 0.28930226f},
-std::array<float,2>{0.863853335f, 0.757034719f},
-std::array<float,2>{0.385821432f, 0.544239819f},
-std::array<float,2>{0.633008599f, 0.154020607f},
-std::array<float,2>{0.221355304f, 0.0877586082f},
-std::array<float,2>{0.968631983f, 0.66593343f},
-std::array<float,2>{0.315373778f, 0.919300675f},
-std::array<float,2>{0.604655504f, 0.452849329f},
-std::array<float,2>{0.405259371f, 0.254066259f},
-std::array<float,2>{0.641973555f, 0.810018659f},
-std::array<float,2>{0.0533875786f, 0.504322052f},
-std::array<float,2>{0.858390689f, 0.161346391f},
-std::array<float,2>{0.290392011f, 0.246227711f},
-std::array<float,2>{0.504226208f, 0.587883472f},
-std::array<float,2>{0.151527286f, 0.854889631f},
-std::array<float,2>{0.927417815f, 0.372445315f},
-std::array<float,2>{0.0840848386f, 0.388878673f},
-std::array<float,2>{0.753302038f, 0.978289485f},
-std::array<float,2>{0.442157328f, 0.702135265f},
-std::array<float,2>{0.709942162f, 0.0105533898f},
-std::array<float,2>{0.0154106347f, 0.128103226f},
-std::array<float,2>{0.842879415f, 0.561266422f},
-std::array<float,2>{0.41999492f, 0.776286542f},
-std::array<float,2>{0.682725787f, 0.308126301f},
-std::array<float,2>{0.372508675f, 0.483120739f},
-std::array<float,2>{0.583441615f, 0.905157745f},
-std::array<float,2>{0.210086331f, 0.642200351f},
-std::array<float,2>{0.978957176f, 0.101276353f},
-std::array<float,2>{0.487961501f, 0.0550906658f},
-std::array<float,2>{0.738919377f, 0.739455342f},
-std::array<float,2>{0.122473344f, 0.948688447f},
-std::array<float,2>{0.810452223f, 0.428685427f},
-std::array<float,2>{0.162219346f, 0.339186132f},
-std::array<float,2>{0.879980803f, 0.839694023f},
-std::array<float,2>{0.279051423f, 0.613171935f},
-std::array<float,2>{0.557464719f, 0.215583712f},
-std::array<float,2>{0.0562759936f, 0.103327237f},
-std::array<float,2>{0.850485563f, 0.655692101f},
-std::array<float,2>{0.391484052f, 0.891964376f},
-std::array<float,2>{0.655845463f, 0.468929291f},
-std::array<float,2>{0.326761752f, 0.297790408f},
-std::array<float,2>{0.596081316f, 0.769924462f},
-std::array<float,2>{0.2318625f, 0.547754586f},
-std::array<float,2>{0.953783572f, 0.138900563f},
-std::array<float,2>{0.452549905f, 0.207560539f},
-std::array<float,2>{0.715061724f, 0.619558632f},
-std::array<float,2>{0.0887803733f, 0.831165135f},
-std::array<float,2>{0.761939824f, 0.331057727f},
-std::array<float,2>{0.141488388f, 0.434590578f},
-std::array<float,2>{0.931227565f, 0.94174999f},
-std::array<float,2>{0.282056272f, 0.748016f},
-std::array<float,2>{0.514412224f, 0.0501610339f},
-std::array<float,2>{0.211960852f, 0.170625731f},
-std::array<float,2>{0.972879708f, 0.5099594f},
-std::array<float,2>{0.361180753f, 0.799193382f},
-std::array<float,2>{0.588665128f, 0.261099041f},
-std::array<float,2>{0.408389986f, 0.439936787f},
-std::array<float,2>{0.67735523f, 0.907319725f},
-std::array<float,2>{0.00510833738f, 0.661517441f},
-std::array<float,2>{0.829168797f, 0.0800396651f},
-std::array<float,2>{0.267405599f, 0.00649164431f},
-std::array<float,2>{0.548500717f, 0.691409707f},
-std::array<float,2>{0.164833859f, 0.969945729f},
-std::array<float,2>{0.886641026f, 0.377131611f},
-std::array<float,2>{0.11445754f, 0.364897102f},
-std::array<float,2>{0.802056015f, 0.847202003f},
-std::array<float,2>{0.499646455f, 0.578657448f},
-std::array<float,2>{0.747223556f, 0.238373995f},
-std::array<float,2>{0.183847114f, 0.0384872854f},
-std::array<float,2>{0.890864611f, 0.721577287f},
-std::array<float,2>{0.259805083f, 0.963747919f},
-std::array<float,2>{0.535170376f, 0.420634061f},
-std::array<float,2>{0.470425308f, 0.317577988f},
-std::array<float,2>{0.721741021f, 0.826817393f},
-std::array<float,2>{0.104570344f, 0.599145412f},
-std::array<float,2>{0.794638216f, 0.191125914f},
-std::array<float,2>{0.357703269f, 0.146300003f},
-std::array<float,2>{0.572548747f, 0.538962901f},
-std::array<float,2>{0.187843531f, 0.759625614f},
-std::array<float,2>{0.997085869f, 0.281808794f},
-std::array<float,2>{0.0250488166f, 0.494950444f},
-std::array<float,2>{0.826530099f, 0.886510193f},
-std::array<float,2>{0.422753483f, 0.638688743f},
-std::array<float,2>{0.659127235f, 0.115237162f},
-std::array<float,2>{0.0652255937f, 0.230093658f},
-std::array<float,2>{0.772620738f, 0.567711592f},
-std::array<float,2>{0.462077081f, 0.87473923f},
-std::array<float,2>{0.699375093f, 0.352742821f},
-std::array<float,2>{0.301147401f, 0.391637802f},
-std::array<float,2>{0.518624425f, 0.999505877f},
-std::array<float,2>{0.132583618f, 0.713517785f},
-std::array<float,2>{0.912944853f, 0.028565539f},
-std::array<float,2>{0.380338728f, 0.0684454888f},
-std::array<float,2>{0.629699111f, 0.683884263f},
-std::array<float,2>{0.0459562168f, 0.931180596f},
-std::array<float,2>{0.871794522f, 0.453859627f},
-std::array<float,2>{0.246558517f, 0.274899572f},
-std::array<float,2>{0.95259136f, 0.790491164f},
-std::array<float,2>{0.330704778f, 0.517442107f},
-std::array<float,2>{0.620363295f, 0.174132764f},
-std::array<float,2>{0.113233075f, 0.124857135f},
-std::array<float,2>{0.798646688f, 0.630947351f},
-std::array<float,2>{0.492773592f, 0.877292156f},
-std::array<float,2>{0.742894828f, 0.484749049f},
-std::array<float,2>{0.272712559f, 0.294877529f},
-std::array<float,2>{0.552499533f, 0.751969337f},
-std::array<float,2>{0.171634853f, 0.540772676f},
-std::array<float,2>{0.889140427f, 0.151180357f},
-std::array<float,2>{0.411781251f, 0.201918289f},
-std::array<float,2>{0.674027801f, 0.604176641f},
-std::array<float,2>{0.00265640416f, 0.815932453f},
-std::array<float,2>{0.835062027f, 0.321642876f},
-std::array<float,2>{0.215184584f, 0.407705784f},
-std::array<float,2>{0.971345127f, 0.95533663f},
-std::array<float,2>{0.366847187f, 0.731100321f},
-std::array<float,2>{0.592839003f, 0.0409899689f},
-std::array<float,2>{0.146221384f, 0.186083302f},
-std::array<float,2>{0.935600221f, 0.530830503f},
-std::array<float,2>{0.28903687f, 0.784941077f},
-std::array<float,2>{0.509180129f, 0.270884067f},
-std::array<float,2>{0.445727646f, 0.465466172f},
-std::array<float,2>{0.712532461f, 0.924241126f},
-std::array<float,2>{0.0913447365f, 0.674747467f},
-std::array<float,2>{0.758892f, 0.0748686567f},
-std::array<float,2>{0.323549926f, 0.018117955f},
-std::array<float,2>{0.601509094f, 0.704294324f},
-std::array<float,2>{0.229585171f, 0.987828016f},
-std::array<float,2>{0.957096279f, 0.402686089f},
-std::array<float,2>{0.0587841198f, 0.348435193f},
-std::array<float,2>{0.846137464f, 0.863685369f},
-std::array<float,2>{0.395161688f, 0.575480759f},
-std::array<float,2>{0.650097072f, 0.226269946f},
-std::array<float,2>{0.243681863f, 0.0594095439f},
-std::array<float,2>{0.946101904f, 0.736847937f},
-std::array<float,2>{0.333756447f, 0.951841116f},
-std::array<float,2>{0.621147931f, 0.423682123f},
-std::array<float,2>{0.375534385f, 0.341530651f},
-std::array<float,2>{0.625836372f, 0.843745649f},
-std::array<float,2>{0.039528396f, 0.614494383f},
-std::array<float,2>{0.870108664f, 0.211483076f},
-std::array<float,2>{0.297327578f, 0.129979551f},
-std::array<float,2>{0.522266269f, 0.557853401f},
-std::array<float,2>{0.127001107f, 0.779627979f},
-std::array<float,2>{0.909507155f, 0.310560375f},
-std::array<float,2>{0.0695784241f, 0.477726072f},
-std::array<float,2>{0.769373953f, 0.900741279f},
-std::array<float,2>{0.46539557f, 0.644600034f},
-std::array<float,2>{0.698378563f, 0.0939004645f},
-std::array<float,2>{0.0303702336f, 0.2433815f},
-std::array<float,2>{0.82261759f, 0.590252042f},
-std::array<float,2>{0.426181018f, 0.85607934f},
-std::array<float,2>{0.661443412f, 0.367530644f},
-std::array<float,2>{0.351954788f, 0.386257142f},
-std::array<float,2>{0.574248314f, 0.983451784f},
-std::array<float,2>{0.193650663f, 0.697354019f},
-std::array<float,2>{0.992430151f, 0.0129214795f},
-std::array<float,2>{0.475882232f, 0.0911974087f},
-std::array<float,2>{0.724759817f, 0.66972214f},
-std::array<float,2>{0.105737202f, 0.915903866f},
-std::array<float,2>{0.789361f, 0.447973162f},
-std::array<float,2>{0.180948034f, 0.252384573f},
-std::array<float,2>{0.898241937f, 0.807134569f},
-std::array<float,2>{0.265386134f, 0.501556754f},
-std::array<float,2>{0.532944858f, 0.15707989f},
-std::array<float,2>{0.0331627056f, 0.00237816363f},
-std::array<float,2>{0.86253202f, 0.688274384f},
-std::array<float,2>{0.388689041f, 0.972728908f},
-std::array<float,2>{0.639936984f, 0.380817145f},
-std::array<float,2>{0.336731434f, 0.363110095f},
-std::array<float,2>{0.610245287f, 0.849953771f},
-std::array<float,2>{0.238069743f, 0.584925175f},
-std::array<float,2>{0.944548249f, 0.236976653f},
-std::array<float,2>{0.454404354f, 0.16461803f},
-std::array<float,2>{0.692391276f, 0.515515924f},
-std::array<float,2>{0.0769377276f, 0.80345118f},
-std::array<float,2>{0.774887085f, 0.264600575f},
-std::array<float,2>{0.139664203f, 0.441825926f},
-std::array<float,2>{0.914068639f, 0.91167289f},
-std::array<float,2>{0.311959684f, 0.658484697f},
-std::array<float,2>{0.529358745f, 0.0828967839f},
-std::array<float,2>{0.201967329f, 0.204378128f},
-std::array<float,2>{0.990665793f, 0.621277869f},
-std::array<float,2>{0.351283848f, 0.835613132f},
-std::array<float,2>{0.565230727f, 0.335435271f},
-std::array<float,2>{0.436469764f, 0.430133015f},
-std::array<float,2>{0.670141995f, 0.940065145f},
-std::array<float,2>{0.0173622351f, 0.74294436f},
-std::array<float,2>{0.81283164f, 0.0531945899f},
-std::array<float,2>{0.255128711f, 0.107416563f},
-std::array<float,2>{0.54406178f, 0.652031898f},
-std::array<float,2>{0.17932108f, 0.894670367f},
-std::array<float,2>{0.902012587f, 0.473719537f},
-std::array<float,2>{0.0973572731f, 0.302909791f},
-std::array<float,2>{0.787174523f, 0.765884101f},
-std::array<float,2>{0.481655061f, 0.550853491f},
-std::array<float,2>{0.733932257f, 0.135050341f},
-std::array<float,2>{0.15765436f, 0.0625455827f},
-std::array<float,2>{0.875781119f, 0.68039149f},
-std::array<float,2>{0.275029421f, 0.933821976f},
-std::array<float,2>{0.559298038f, 0.457502484f},
-std::array<float,2>{0.48904267f, 0.281161785f},
-std::array<float,2>{0.735709548f, 0.794407964f},
-std::array<float,2>{0.117451899f, 0.521365345f},
-std::array<float,2>{0.806587517f, 0.179506853f},
-std::array<float,2>{0.370227695f, 0.231951341f},
-std::array<float,2>{0.581783652f, 0.565868437f},
-std::array<float,2>{0.205276906f, 0.868607521f},
-std::array<float,2>{0.984374821f, 0.356071711f},
-std::array<float,2>{0.0113079567f, 0.394690871f},
-std::array<float,2>{0.836513162f, 0.995664477f},
-std::array<float,2>{0.415269405f, 0.714999318f},
-std::array<float,2>{0.686077595f, 0.0249022152f},
-std::array<float,2>{0.0805688351f, 0.143922463f},
-std::array<float,2>{0.756347597f, 0.531980097f},
-std::array<float,2>{0.437897265f, 0.76205796f},
-std::array<float,2>{0.704556286f, 0.287868381f},
-std::array<float,2>{0.293113172f, 0.499816686f},
-std::array<float,2>{0.503596842f, 0.886946321f},
-std::array<float,2>{0.155901194f, 0.635695577f},
-std::array<float,2>{0.924053669f, 0.1118031f},
-std::array<float,2>{0.400131017f, 0.032150466f},
-std::array<float,2>{0.645597219f, 0.724891543f},
-std::array<float,2>{0.0506819002f, 0.967186272f},
-std::array<float,2>{0.852582335f, 0.416311234f},
-std::array<float,2>{0.224797577f, 0.314838052f},
-std::array<float,2>{0.961313665f, 0.820577919f},
-std::array<float,2>{0.319195002f, 0.597653568f},
-std::array<float,2>{0.607435524f, 0.192704514f},
-std::array<float,2>{0.07152652f, 0.0455304123f},
-std::array<float,2>{0.778860688f, 0.72809124f},
-std::array<float,2>{0.459565133f, 0.959072888f},
-std::array<float,2>{0.688562036f, 0.412399501f},
-std::array<float,2>{0.307869077f, 0.327672392f},
-std::array<float,2>{0.526767612f, 0.816905797f},
-std::array<float,2>{0.135305762f, 0.606395364f},
-std::array<float,2>{0.921621799f, 0.196952552f},
-std::array<float,2>{0.38392815f, 0.154599413f},
-std::array<float,2>{0.635787129f, 0.545328021f},
-std::array<float,2>{0.036006365f, 0.755718291f},
-std::array<float,2>{0.865903795f, 0.292725593f},
-std::array<float,2>{0.238431275f, 0.490985125f},
-std::array<float,2>{0.939183235f, 0.882376909f},
-std::array<float,2>{0.341322958f, 0.625817537f},
-std::array<float,2>{0.614537895f, 0.120105147f},
-std::array<float,2>{0.174994886f, 0.220863104f},
-std::array<float,2>{0.902833283f, 0.571066499f},
-std::array<float,2>{0.250326246f, 0.859756589f},
-std::array<float,2>{0.540607512f, 0.347462386f},
-std::array<float,2>{0.480151772f, 0.399595976f},
-std::array<float,2>{0.728700519f, 0.991270542f},
-std::array<float,2>{0.100150935f, 0.710354984f},
-std::array<float,2>{0.783837438f, 0.0212873779f},
-std::array<float,2>{0.3468256f, 0.0721020401f},
-std::array<float,2>{0.567083836f, 0.6763466f},
-std::array<float,2>{0.195652455f, 0.925824225f},
-std::array<float,2>{0.986875713f, 0.464114964f},
-std::array<float,2>{0.0226280354f, 0.266130567f},
-std::array<float,2>{0.817222953f, 0.789058685f},
-std::array<float,2>{0.433560193f, 0.524861753f},
-std::array<float,2>{0.667687953f, 0.182654262f},
-std::array<float,2>{0.207920164f, 0.098612763f},
-std::array<float,2>{0.977720261f, 0.643988669f},
-std::array<float,2>{0.374052852f, 0.903798103f},
-std::array<float,2>{0.584837615f, 0.481568903f},
-std::array<float,2>{0.4195683f, 0.305393845f},
-std::array<float,2>{0.680697381f, 0.77532202f},
-std::array<float,2>{0.0121723386f, 0.559393883f},
-std::array<float,2>{0.840411186f, 0.125984982f},
-std::array<float,2>{0.281158268f, 0.21733816f},
-std::array<float,2>{0.554873347f, 0.609906018f},
-std::array<float,2>{0.161611676f, 0.836086929f},
-std::array<float,2>{0.882447958f, 0.337095588f},
-std::array<float,2>{0.123979218f, 0.426915586f},
-std::array<float,2>{0.811130106f, 0.946267128f},
-std::array<float,2>{0.485413253f, 0.741883218f},
-std::array<float,2>{0.740687788f, 0.0566889271f},
-std::array<float,2>{0.0523871332f, 0.162422866f},
-std::array<float,2>{0.856699705f, 0.506734312f},
-std::array<float,2>{0.404019594f, 0.812146842f},
-std::array<float,2>{0.644508243f, 0.256182551f},
-std::array<float,2>{0.31391567f, 0.449891984f},
-std::array<float,2>{0.601702988f, 0.921721339f},
-std::array<float,2>{0.220612377f, 0.667505562f},
-std::array<float,2>{0.965950549f, 0.0889013112f},
-std::array<float,2>{0.44526276f, 0.00802844483f},
-std::array<float,2>{0.70766288f, 0.700785935f},
-std::array<float,2>{0.0824776441f, 0.979498088f},
-std::array<float,2>{0.750651598f, 0.387988567f},
-std::array<float,2>{0.148546562f, 0.373922497f},
-std::array<float,2>{0.929178059f, 0.853256166f},
-std::array<float,2>{0.291876704f, 0.588951528f},
-std::array<float,2>{0.507673919f, 0.248085693f},
-std::array<float,2>{0.00622179406f, 0.0817009509f},
-std::array<float,2>{0.831695497f, 0.663801968f},
-std::array<float,2>{0.407703221f, 0.909110904f},
-std::array<float,2>{0.679493546f, 0.437990278f},
-std::array<float,2>{0.362914443f, 0.259716988f},
-std::array<float,2>{0.586801469f, 0.797991991f},
-std::array<float,2>{0.213057801f, 0.509547651f},
-std::array<float,2>{0.976310313f, 0.169209823f},
-std::array<float,2>{0.496504396f, 0.241453469f},
-std::array<float,2>{0.749247372f, 0.581320584f},
-std::array<float,2>{0.115444943f, 0.845586956f},
-std::array<float,2>{0.803069711f, 0.366382629f},
-std::array<float,2>{0.167021111f, 0.376177609f},
-std::array<float,2>{0.884266794f, 0.972335935f},
-std::array<float,2>{0.267584682f, 0.693963647f},
-std::array<float,2>{0.55009073f, 0.00540572172f},
-std::array<float,2>{0.233218446f, 0.137586206f},
-std::array<float,2>{0.956695616f, 0.550194204f},
-std::array<float,2>{0.325271428f, 0.772143245f},
-std::array<float,2>{0.594198048f, 0.299264044f},
-std::array<float,2>{0.3931472f, 0.472027659f},
-std::array<float,2>{0.653410494f, 0.894509733f},
-std::array<float,2>{0.0583604164f, 0.653380275f},
-std::array<float,2>{0.848877549f, 0.103840046f},
-std::array<float,2>{0.283295214f, 0.0485183448f},
-std::array<float,2>{0.5125947f, 0.749334037f},
-std::array<float,2>{0.144194722f, 0.944332719f},
-std::array<float,2>{0.932954192f, 0.436766535f},
-std::array<float,2>{0.0873602331f, 0.329897016f},
-std::array<float,2>{0.764108479f, 0.82953012f},
-std::array<float,2>{0.449989527f, 0.617239535f},
-std::array<float,2>{0.71740824f, 0.208994642f},
-std::array<float,2>{0.130584791f, 0.0295208991f},
-std::array<float,2>{0.91154331f, 0.711991429f},
-std::array<float,2>{0.304453403f, 0.996214449f},
-std::array<float,2>{0.517442524f, 0.393390626f},
-std::array<float,2>{0.463194489f, 0.354866207f},
-std::array<float,2>{0.701853335f, 0.871858656f},
-std::array<float,2>{0.0635944232f, 0.569992125f},
-std::array<float,2>{0.770376205f, 0.228287414f},
-std::array<float,2>{0.328414321f, 0.172727555f},
-std::array<float,2>{0.618542314f, 0.519191563f},
-std::array<float,2>{0.249429643f, 0.792171717f},
-std::array<float,2>{0.949541152f, 0.276528984f},
-std::array<float,2>{0.0431499407f, 0.456461847f},
-std::array<float,2>{0.873969853f, 0.931867421f},
-std::array<float,2>{0.380988479f, 0.687031448f},
-std::array<float,2>{0.63161701f, 0.0677094236f},
-std::array<float,2>{0.101996869f, 0.189089134f},
-std::array<float,2>{0.795638263f, 0.600281239f},
-std::array<float,2>{0.472263068f, 0.825977921f},
-std::array<float,2>{0.720044315f, 0.320063144f},
-std::array<float,2>{0.258496732f, 0.418092698f},
-std::array<float,2>{0.537813365f, 0.961423039f},
-std::array<float,2>{0.187470883f, 0.72050488f},
-std::array<float,2>{0.893722773f, 0.0359331146f},
-std::array<float,2>{0.423834413f, 0.114184201f},
-std::array<float,2>{0.657705426f, 0.637885749f},
-std::array<float,2>{0.0259668604f, 0.883195102f},
-std::array<float,2>{0.824644864f, 0.494130492f},
-std::array<float,2>{0.189503595f, 0.284379423f},
-std::array<float,2>{0.999840021f, 0.760464907f},
-std::array<float,2>{0.356066436f, 0.5363006f},
-std::array<float,2>{0.570347726f, 0.147885561f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.998842776f, 0.471182644f},
-std::array<float,2>{0.460609585f, 0.656140268f},
-std::array<float,2>{0.00395158678f, 0.243858129f},
-std::array<float,2>{0.70322603f, 0.933389783f},
-std::array<float,2>{0.545949399f, 0.0411357656f},
-std::array<float,2>{0.156885192f, 0.802670717f},
-std::array<float,2>{0.276450783f, 0.313303769f},
-std::array<float,2>{0.810827792f, 0.557491541f},
-std::array<float,2>{0.654437721f, 0.277568728f},
-std::array<float,2>{0.11165645f, 0.586231411f},
-std::array<float,2>{0.395573258f, 0.0849615484f},
-std::array<float,2>{0.891530514f, 0.874276102f},
-std::array<float,2>{0.816549063f, 0.164851502f},
-std::array<float,2>{0.366295785f, 0.952679813f},
-std::array<float,2>{0.199739143f, 0.381095111f},
-std::array<float,2>{0.582440734f, 0.711746752f},
-std::array<float,2>{0.775778711f, 0.367122531f},
-std::array<float,2>{0.291621417f, 0.511348248f},
-std::array<float,2>{0.13355352f, 0.00237421365f},
-std::array<float,2>{0.529207289f, 0.759339631f},
-std::array<float,2>{0.745432138f, 0.209666565f},
-std::array<float,2>{0.0521294996f, 0.887512207f},
-std::array<float,2>{0.475477248f, 0.466069579f},
-std::array<float,2>{0.965272546f, 0.678151965f},
-std::array<float,2>{0.604655623f, 0.425068676f},
-std::array<float,2>{0.243647948f, 0.745877624f},
-std::array<float,2>{0.335470915f, 0.127353415f},
-std::array<float,2>{0.856218159f, 0.968936682f},
-std::array<float,2>{0.915422916f, 0.118183956f},
-std::array<float,2>{0.423375577f, 0.835529864f},
-std::array<float,2>{0.0802824944f, 0.307262212f},
-std::array<float,2>{0.674880624f, 0.601218402f},
-std::array<float,2>{0.883149445f, 0.293983728f},
-std::array<float,2>{0.389708012f, 0.624529421f},
-std::array<float,2>{0.107390068f, 0.0949033573f},
-std::array<float,2>{0.629763126f, 0.816352129f},
-std::array<float,2>{0.577726305f, 0.144548565f},
-std::array<float,2>{0.21225059f, 0.992571056f},
-std::array<float,2>{0.345793158f, 0.418997705f},
-std::array<float,2>{0.836014569f, 0.729668081f},
-std::array<float,2>{0.687945545f, 0.443230659f},
-std::array<float,2>{0.0242290385f, 0.660429657f},
-std::array<float,2>{0.442878932f, 0.197286487f},
-std::array<float,2>{0.977097571f, 0.900974691f},
-std::array<float,2>{0.793184698f, 0.0241725836f},
-std::array<float,2>{0.257435113f, 0.766253173f},
-std::array<float,2>{0.178828403f, 0.35323903f},
-std::array<float,2>{0.547071099f, 0.519084096f},
-std::array<float,2>{0.867865026f, 0.399458736f},
-std::array<float,2>{0.318992913f, 0.701154828f},
-std::array<float,2>{0.220803723f, 0.174912557f},
-std::array<float,2>{0.611883759f, 0.962313473f},
-std::array<float,2>{0.661014259f, 0.070811525f},
-std::array<float,2>{0.0689935163f, 0.854474127f},
-std::array<float,2>{0.411199719f, 0.250937223f},
-std::array<float,2>{0.923176587f, 0.577391982f},
-std::array<float,2>{0.512286067f, 0.339675874f},
-std::array<float,2>{0.153148592f, 0.541151702f},
-std::array<float,2>{0.307391375f, 0.0496044718f},
-std::array<float,2>{0.763166904f, 0.789829791f},
-std::array<float,2>{0.952930808f, 0.221740186f},
-std::array<float,2>{0.492967188f, 0.916035116f},
-std::array<float,2>{0.0413633585f, 0.490738332f},
-std::array<float,2>{0.730221391f, 0.630459785f},
-std::array<float,2>{0.932451427f, 0.406855404f},
-std::array<float,2>{0.420253694f, 0.721278131f},
-std::array<float,2>{0.0748798102f, 0.15355733f},
-std::array<float,2>{0.668177903f, 0.990095735f},
-std::array<float,2>{0.622448325f, 0.107402489f},
-std::array<float,2>{0.231346041f, 0.821619511f},
-std::array<float,2>{0.32688874f, 0.283921719f},
-std::array<float,2>{0.863797545f, 0.615466237f},
-std::array<float,2>{0.719852328f, 0.348447174f},
-std::array<float,2>{0.0314847976f, 0.528332829f},
-std::array<float,2>{0.485328615f, 0.020945508f},
-std::array<float,2>{0.939036667f, 0.774244666f},
-std::array<float,2>{0.755776882f, 0.192582279f},
-std::array<float,2>{0.297592759f, 0.895365179f},
-std::array<float,2>{0.140969172f, 0.451840937f},
-std::array<float,2>{0.505947232f, 0.670026243f},
-std::array<float,2>{0.831164241f, 0.264649421f},
-std::array<float,2>{0.352341592f, 0.564382732f},
-std::array<float,2>{0.209385797f, 0.067792967f},
-std::array<float,2>{0.569312274f, 0.849102676f},
-std::array<float,2>{0.639369845f, 0.181773901f},
-std::array<float,2>{0.0947076678f, 0.957334459f},
-std::array<float,2>{0.375222504f, 0.395901471f},
-std::array<float,2>{0.876855195f, 0.691436887f},
-std::array<float,2>{0.559336782f, 0.497330546f},
-std::array<float,2>{0.18632181f, 0.637372911f},
-std::array<float,2>{0.26137206f, 0.232347056f},
-std::array<float,2>{0.781579494f, 0.91037029f},
-std::array<float,2>{0.972498655f, 0.059600953f},
-std::array<float,2>{0.445323467f, 0.783678293f},
-std::array<float,2>{0.0204793625f, 0.331871241f},
-std::array<float,2>{0.696672559f, 0.531806529f},
-std::array<float,2>{0.957471251f, 0.327550828f},
-std::array<float,2>{0.480381161f, 0.547328353f},
-std::array<float,2>{0.0572338253f, 0.0334462188f},
-std::array<float,2>{0.739102542f, 0.811501741f},
-std::array<float,2>{0.516055286f, 0.235637888f},
-std::array<float,2>{0.130044639f, 0.924436033f},
-std::array<float,2>{0.285163522f, 0.479760319f},
-std::array<float,2>{0.770771682f, 0.646575332f},
-std::array<float,2>{0.680320323f, 0.384082139f},
-std::array<float,2>{0.0904391408f, 0.70638603f},
-std::array<float,2>{0.435598671f, 0.158804432f},
-std::array<float,2>{0.907447696f, 0.941007674f},
-std::array<float,2>{0.845206738f, 0.0907690227f},
-std::array<float,2>{0.341763884f, 0.865922511f},
-std::array<float,2>{0.242126927f, 0.271986067f},
-std::array<float,2>{0.599880755f, 0.57899797f},
-std::array<float,2>{0.803157687f, 0.454997152f},
-std::array<float,2>{0.272068143f, 0.685237885f},
-std::array<float,2>{0.164098591f, 0.211370483f},
-std::array<float,2>{0.537983656f, 0.878543079f},
-std::array<float,2>{0.716301143f, 0.0138098691f},
-std::array<float,2>{0.0113387555f, 0.754942417f},
-std::array<float,2>{0.466873348f, 0.367295176f},
-std::array<float,2>{0.990220249f, 0.50468111f},
-std::array<float,2>{0.59316957f, 0.300543576f},
-std::array<float,2>{0.195041955f, 0.604516685f},
-std::array<float,2>{0.368962973f, 0.110577248f},
-std::array<float,2>{0.825708807f, 0.839379549f},
-std::array<float,2>{0.903867006f, 0.140542969f},
-std::array<float,2>{0.401488155f, 0.976999402f},
-std::array<float,2>{0.121670566f, 0.435046315f},
-std::array<float,2>{0.644919097f, 0.741340637f},
-std::array<float,2>{0.943257689f, 0.376945257f},
-std::array<float,2>{0.49131912f, 0.716648102f},
-std::array<float,2>{0.0362662263f, 0.169035554f},
-std::array<float,2>{0.723694861f, 0.94731915f},
-std::array<float,2>{0.503168702f, 0.0808438361f},
-std::array<float,2>{0.145345479f, 0.870148301f},
-std::array<float,2>{0.304502487f, 0.27653721f},
-std::array<float,2>{0.75069201f, 0.59087199f},
-std::array<float,2>{0.665243387f, 0.317479163f},
-std::array<float,2>{0.0711466596f, 0.560307503f},
-std::array<float,2>{0.417492807f, 0.0436308533f},
-std::array<float,2>{0.934278786f, 0.799151897f},
-std::array<float,2>{0.86280632f, 0.248791873f},
-std::array<float,2>{0.323684484f, 0.93370384f},
-std::array<float,2>{0.226896048f, 0.47368598f},
-std::array<float,2>{0.618940353f, 0.650720239f},
-std::array<float,2>{0.785364151f, 0.312422842f},
-std::array<float,2>{0.261833042f, 0.593842983f},
-std::array<float,2>{0.181611627f, 0.121819377f},
-std::array<float,2>{0.55687499f, 0.831989884f},
-std::array<float,2>{0.70118618f, 0.130259752f},
-std::array<float,2>{0.0178562179f, 0.975215375f},
-std::array<float,2>{0.449704945f, 0.426204354f},
-std::array<float,2>{0.973679423f, 0.749799669f},
-std::array<float,2>{0.564956725f, 0.464647859f},
-std::array<float,2>{0.205899537f, 0.674599349f},
-std::array<float,2>{0.358579278f, 0.203941032f},
-std::array<float,2>{0.835831821f, 0.885303855f},
-std::array<float,2>{0.880602062f, 0.0046922313f},
-std::array<float,2>{0.379008293f, 0.762672484f},
-std::array<float,2>{0.0992646739f, 0.362311482f},
-std::array<float,2>{0.63394171f, 0.513950825f},
-std::array<float,2>{0.913309693f, 0.356362611f},
-std::array<float,2>{0.433217019f, 0.521576285f},
-std::array<float,2>{0.0871079117f, 0.0305802599f},
-std::array<float,2>{0.683876097f, 0.772549093f},
-std::array<float,2>{0.59761703f, 0.200001761f},
-std::array<float,2>{0.237620801f, 0.906090558f},
-std::array<float,2>{0.33830291f, 0.440455019f},
-std::array<float,2>{0.850540876f, 0.657901108f},
-std::array<float,2>{0.737984002f, 0.415630907f},
-std::array<float,2>{0.0611909479f, 0.731520832f},
-std::array<float,2>{0.483230174f, 0.142870024f},
-std::array<float,2>{0.955201805f, 0.99836266f},
-std::array<float,2>{0.76654619f, 0.097882621f},
-std::array<float,2>{0.284426957f, 0.818962991f},
-std::array<float,2>{0.125389233f, 0.290271342f},
-std::array<float,2>{0.522975802f, 0.620245397f},
-std::array<float,2>{0.822893441f, 0.484900117f},
-std::array<float,2>{0.371196121f, 0.62856245f},
-std::array<float,2>{0.187632665f, 0.225686699f},
-std::array<float,2>{0.586633503f, 0.920700014f},
-std::array<float,2>{0.64210701f, 0.0529445559f},
-std::array<float,2>{0.120274447f, 0.793583989f},
-std::array<float,2>{0.405477315f, 0.341538697f},
-std::array<float,2>{0.898664415f, 0.54400605f},
-std::array<float,2>{0.534628928f, 0.256301403f},
-std::array<float,2>{0.17166622f, 0.572615325f},
-std::array<float,2>{0.267831922f, 0.0748850256f},
-std::array<float,2>{0.798388004f, 0.85605222f},
-std::array<float,2>{0.987678409f, 0.179562852f},
-std::array<float,2>{0.462209761f, 0.965709269f},
-std::array<float,2>{0.0127067585f, 0.403167784f},
-std::array<float,2>{0.711215377f, 0.695860744f},
-std::array<float,2>{0.897349656f, 0.44650045f},
-std::array<float,2>{0.393825084f, 0.665846944f},
-std::array<float,2>{0.115470335f, 0.188563228f},
-std::array<float,2>{0.649215519f, 0.891321659f},
-std::array<float,2>{0.580905378f, 0.0193265043f},
-std::array<float,2>{0.197392106f, 0.778955162f},
-std::array<float,2>{0.361769497f, 0.347088933f},
-std::array<float,2>{0.815389037f, 0.52450192f},
-std::array<float,2>{0.709673762f, 0.286261737f},
-std::array<float,2>{0.00146314432f, 0.611672103f},
-std::array<float,2>{0.454560488f, 0.104486391f},
-std::array<float,2>{0.995027721f, 0.826546252f},
-std::array<float,2>{0.805894256f, 0.151681453f},
-std::array<float,2>{0.278423965f, 0.985263646f},
-std::array<float,2>{0.160426304f, 0.412915081f},
-std::array<float,2>{0.539184213f, 0.726094127f},
-std::array<float,2>{0.854885995f, 0.335261315f},
-std::array<float,2>{0.329681098f, 0.537112772f},
-std::array<float,2>{0.246144548f, 0.0571402982f},
-std::array<float,2>{0.605944812f, 0.788680315f},
-std::array<float,2>{0.679189086f, 0.228020772f},
-std::array<float,2>{0.0831896588f, 0.908997715f},
-std::array<float,2>{0.428931952f, 0.494980454f},
-std::array<float,2>{0.91924125f, 0.63388747f},
-std::array<float,2>{0.523631811f, 0.392724842f},
-std::array<float,2>{0.136971891f, 0.688156664f},
-std::array<float,2>{0.294567823f, 0.183663428f},
-std::array<float,2>{0.778328538f, 0.955637932f},
-std::array<float,2>{0.960989773f, 0.0638577193f},
-std::array<float,2>{0.469638139f, 0.846203029f},
-std::array<float,2>{0.0498533174f, 0.26160565f},
-std::array<float,2>{0.746218204f, 0.568939686f},
-std::array<float,2>{0.982848883f, 0.269157648f},
-std::array<float,2>{0.437862724f, 0.582327843f},
-std::array<float,2>{0.0284098126f, 0.0866003036f},
-std::array<float,2>{0.691426694f, 0.860077798f},
-std::array<float,2>{0.551306605f, 0.160878047f},
-std::array<float,2>{0.174585536f, 0.942964196f},
-std::array<float,2>{0.250010222f, 0.388955593f},
-std::array<float,2>{0.789800823f, 0.710351527f},
-std::array<float,2>{0.627252281f, 0.482030988f},
-std::array<float,2>{0.103060901f, 0.64268887f},
-std::array<float,2>{0.383078665f, 0.240828529f},
-std::array<float,2>{0.890480399f, 0.928219318f},
-std::array<float,2>{0.843162954f, 0.0372966379f},
-std::array<float,2>{0.351421505f, 0.806017339f},
-std::array<float,2>{0.217142299f, 0.321573019f},
-std::array<float,2>{0.572579861f, 0.552416563f},
-std::array<float,2>{0.759486139f, 0.431187034f},
-std::array<float,2>{0.310142279f, 0.738220096f},
-std::array<float,2>{0.151116386f, 0.135955215f},
-std::array<float,2>{0.507969677f, 0.983580589f},
-std::array<float,2>{0.73415637f, 0.113706291f},
-std::array<float,2>{0.0459381938f, 0.840723395f},
-std::array<float,2>{0.497916669f, 0.302807122f},
-std::array<float,2>{0.948547184f, 0.606676221f},
-std::array<float,2>{0.614307702f, 0.372200787f},
-std::array<float,2>{0.225744218f, 0.503213227f},
-std::array<float,2>{0.312964261f, 0.00951018929f},
-std::array<float,2>{0.873541534f, 0.753659546f},
-std::array<float,2>{0.929065228f, 0.21549207f},
-std::array<float,2>{0.409259498f, 0.881399512f},
-std::array<float,2>{0.0630275831f, 0.458653718f},
-std::array<float,2>{0.657452345f, 0.680024087f},
-std::array<float,2>{0.96866703f, 0.468290091f},
-std::array<float,2>{0.474394917f, 0.676241577f},
-std::array<float,2>{0.0532786623f, 0.207063377f},
-std::array<float,2>{0.743177295f, 0.889881611f},
-std::array<float,2>{0.529893756f, 0.00110019092f},
-std::array<float,2>{0.134962484f, 0.760960877f},
-std::array<float,2>{0.289352477f, 0.365064412f},
-std::array<float,2>{0.774584115f, 0.508937418f},
-std::array<float,2>{0.672381043f, 0.306384683f},
-std::array<float,2>{0.0785987303f, 0.598393261f},
-std::array<float,2>{0.425178707f, 0.119733222f},
-std::array<float,2>{0.916768849f, 0.833768785f},
-std::array<float,2>{0.8576473f, 0.126519024f},
-std::array<float,2>{0.3328228f, 0.971405804f},
-std::array<float,2>{0.245047703f, 0.423162401f},
-std::array<float,2>{0.60199219f, 0.742884099f},
-std::array<float,2>{0.810067773f, 0.314911932f},
-std::array<float,2>{0.274689913f, 0.554694057f},
-std::array<float,2>{0.158949509f, 0.0390757769f},
-std::array<float,2>{0.543292522f, 0.803942084f},
-std::array<float,2>{0.705112875f, 0.244986132f},
-std::array<float,2>{0.00691841682f, 0.929771543f},
-std::array<float,2>{0.457706928f, 0.470264524f},
-std::array<float,2>{0.996961057f, 0.653948188f},
-std::array<float,2>{0.585908771f, 0.380740941f},
-std::array<float,2>{0.202694893f, 0.713003993f},
-std::array<float,2>{0.364150256f, 0.167539239f},
-std::array<float,2>{0.818775058f, 0.949398458f},
-std::array<float,2>{0.893376172f, 0.0836480632f},
-std::array<float,2>{0.396995902f, 0.871204495f},
-std::array<float,2>{0.110352188f, 0.280117124f},
-std::array<float,2>{0.653074801f, 0.58976686f},
-std::array<float,2>{0.925013363f, 0.252157569f},
-std::array<float,2>{0.412477553f, 0.575675845f},
-std::array<float,2>{0.0667887703f, 0.0730895773f},
-std::array<float,2>{0.66296941f, 0.852692187f},
-std::array<float,2>{0.609895825f, 0.172822103f},
-std::array<float,2>{0.220314309f, 0.963785112f},
-std::array<float,2>{0.317408353f, 0.402339756f},
-std::array<float,2>{0.869805396f, 0.702126622f},
-std::array<float,2>{0.726833284f, 0.489988834f},
-std::array<float,2>{0.0398070142f, 0.632361531f},
-std::array<float,2>{0.4958691f, 0.219225928f},
-std::array<float,2>{0.951135337f, 0.915986836f},
-std::array<float,2>{0.765026152f, 0.0477303453f},
-std::array<float,2>{0.305399716f, 0.792750895f},
-std::array<float,2>{0.154431164f, 0.33636412f},
-std::array<float,2>{0.514965713f, 0.54020071f},
-std::array<float,2>{0.838896155f, 0.421114475f},
-std::array<float,2>{0.344191402f, 0.728149295f},
-std::array<float,2>{0.213946968f, 0.147428066f},
-std::array<float,2>{0.574824512f, 0.995012939f},
-std::array<float,2>{0.632374525f, 0.0976243019f},
-std::array<float,2>{0.108364344f, 0.812863111f},
-std::array<float,2>{0.388161629f, 0.295988113f},
-std::array<float,2>{0.885300994f, 0.621385217f},
-std::array<float,2>{0.550122678f, 0.353964239f},
-std::array<float,2>{0.177104622f, 0.517415524f},
-std::array<float,2>{0.25502634f, 0.0271454416f},
-std::array<float,2>{0.796545029f, 0.767836392f},
-std::array<float,2>{0.978705525f, 0.195878014f},
-std::array<float,2>{0.444758147f, 0.899638355f},
-std::array<float,2>{0.0257806927f, 0.445176095f},
-std::array<float,2>{0.690940976f, 0.662300408f},
-std::array<float,2>{0.877183557f, 0.398154706f},
-std::array<float,2>{0.378425896f, 0.694828808f},
-std::array<float,2>{0.0969214141f, 0.180351183f},
-std::array<float,2>{0.638024628f, 0.959318221f},
-std::array<float,2>{0.566984892f, 0.0699580684f},
-std::array<float,2>{0.207822189f, 0.849943936f},
-std::array<float,2>{0.354308575f, 0.261999667f},
-std::array<float,2>{0.828591168f, 0.565431476f},
-std::array<float,2>{0.697302222f, 0.329529911f},
-std::array<float,2>{0.0228426233f, 0.534630418f},
-std::array<float,2>{0.447817922f, 0.0624968857f},
-std::array<float,2>{0.970499098f, 0.781410992f},
-std::array<float,2>{0.784785271f, 0.232739195f},
-std::array<float,2>{0.259762734f, 0.912384748f},
-std::array<float,2>{0.183976233f, 0.499759316f},
-std::array<float,2>{0.561691284f, 0.640357316f},
-std::array<float,2>{0.866882443f, 0.282268614f},
-std::array<float,2>{0.325399578f, 0.61412257f},
-std::array<float,2>{0.234360889f, 0.109037124f},
-std::array<float,2>{0.624445319f, 0.822962999f},
-std::array<float,2>{0.670814216f, 0.155513138f},
-std::array<float,2>{0.0762564614f, 0.991291881f},
-std::array<float,2>{0.419111818f, 0.40984413f},
-std::array<float,2>{0.930155814f, 0.720091462f},
-std::array<float,2>{0.505012035f, 0.451079667f},
-std::array<float,2>{0.144390434f, 0.669219553f},
-std::array<float,2>{0.300544798f, 0.194392249f},
-std::array<float,2>{0.756440341f, 0.897564769f},
-std::array<float,2>{0.941249549f, 0.0230236836f},
-std::array<float,2>{0.48783797f, 0.776734352f},
-std::array<float,2>{0.0339196771f, 0.350567162f},
-std::array<float,2>{0.721418321f, 0.53099674f},
-std::array<float,2>{0.991236329f, 0.369603902f},
-std::array<float,2>{0.46655333f, 0.507486343f},
-std::array<float,2>{0.00925571844f, 0.0134099321f},
-std::array<float,2>{0.717081726f, 0.756025553f},
-std::array<float,2>{0.535855234f, 0.213640541f},
-std::array<float,2>{0.167879984f, 0.876623392f},
-std::array<float,2>{0.270275205f, 0.455108017f},
-std::array<float,2>{0.80269444f, 0.686486304f},
-std::array<float,2>{0.648035288f, 0.437350452f},
-std::array<float,2>{0.123524852f, 0.740232408f},
-std::array<float,2>{0.399983823f, 0.137451202f},
-std::array<float,2>{0.904320776f, 0.979580998f},
-std::array<float,2>{0.827846587f, 0.113219991f},
-std::array<float,2>{0.370503724f, 0.83785671f},
-std::array<float,2>{0.192190021f, 0.298043549f},
-std::array<float,2>{0.591681778f, 0.603026032f},
-std::array<float,2>{0.772479296f, 0.478403211f},
-std::array<float,2>{0.288848311f, 0.645413578f},
-std::array<float,2>{0.131203488f, 0.236336038f},
-std::array<float,2>{0.518458664f, 0.923216343f},
-std::array<float,2>{0.741749704f, 0.0317840539f},
-std::array<float,2>{0.0554222725f, 0.810444832f},
-std::array<float,2>{0.478452474f, 0.325320035f},
-std::array<float,2>{0.959539175f, 0.550047994f},
-std::array<float,2>{0.598243833f, 0.269711524f},
-std::array<float,2>{0.239009023f, 0.581725299f},
-std::array<float,2>{0.342119426f, 0.0919295102f},
-std::array<float,2>{0.847500324f, 0.864299595f},
-std::array<float,2>{0.908733785f, 0.156922296f},
-std::array<float,2>{0.435214192f, 0.938084841f},
-std::array<float,2>{0.0934051126f, 0.385715425f},
-std::array<float,2>{0.682908475f, 0.704346299f},
-std::array<float,2>{0.976155162f, 0.42932409f},
-std::array<float,2>{0.452230603f, 0.746249974f},
-std::array<float,2>{0.01635243f, 0.131509781f},
-std::array<float,2>{0.699650526f, 0.972877264f},
-std::array<float,2>{0.555209875f, 0.124162018f},
-std::array<float,2>{0.182874769f, 0.829016805f},
-std::array<float,2>{0.264931977f, 0.308771729f},
-std::array<float,2>{0.788652658f, 0.596260667f},
-std::array<float,2>{0.636324286f, 0.360504717f},
-std::array<float,2>{0.100829221f, 0.513020515f},
-std::array<float,2>{0.381316304f, 0.00697479071f},
-std::array<float,2>{0.882401764f, 0.763929605f},
-std::array<float,2>{0.833653867f, 0.206511796f},
-std::array<float,2>{0.356623739f, 0.884233177f},
-std::array<float,2>{0.204915747f, 0.461360276f},
-std::array<float,2>{0.563408375f, 0.673044086f},
-std::array<float,2>{0.752910793f, 0.275194585f},
-std::array<float,2>{0.301217288f, 0.591891825f},
-std::array<float,2>{0.147983596f, 0.0788312778f},
-std::array<float,2>{0.501853943f, 0.868768454f},
-std::array<float,2>{0.725495458f, 0.171510503f},
-std::array<float,2>{0.0372689664f, 0.946730018f},
-std::array<float,2>{0.488359749f, 0.378229201f},
-std::array<float,2>{0.943579853f, 0.717235386f},
-std::array<float,2>{0.620262027f, 0.476322025f},
-std::array<float,2>{0.228545383f, 0.650352478f},
-std::array<float,2>{0.321741194f, 0.2470209f},
-std::array<float,2>{0.859835565f, 0.936491549f},
-std::array<float,2>{0.93662107f, 0.0453991443f},
-std::array<float,2>{0.416015267f, 0.797553062f},
-std::array<float,2>{0.0728178322f, 0.318614632f},
-std::array<float,2>{0.666110992f, 0.560639501f},
-std::array<float,2>{0.900393605f, 0.342452854f},
-std::array<float,2>{0.403369695f, 0.545104563f},
-std::array<float,2>{0.118690342f, 0.0515331849f},
-std::array<float,2>{0.642873585f, 0.795564711f},
-std::array<float,2>{0.588797867f, 0.223925173f},
-std::array<float,2>{0.190102056f, 0.918735683f},
-std::array<float,2>{0.374915719f, 0.487836421f},
-std::array<float,2>{0.82224834f, 0.625395119f},
-std::array<float,2>{0.71473676f, 0.405241549f},
-std::array<float,2>{0.0138445273f, 0.69919163f},
-std::array<float,2>{0.464402407f, 0.176143631f},
-std::array<float,2>{0.985432565f, 0.967142224f},
-std::array<float,2>{0.799389124f, 0.0766934752f},
-std::array<float,2>{0.266339362f, 0.858182788f},
-std::array<float,2>{0.168879837f, 0.25476408f},
-std::array<float,2>{0.532297671f, 0.571510017f},
-std::array<float,2>{0.847668648f, 0.439202964f},
-std::array<float,2>{0.337704003f, 0.658990443f},
-std::array<float,2>{0.235886142f, 0.202010006f},
-std::array<float,2>{0.59432584f, 0.903148115f},
-std::array<float,2>{0.686003268f, 0.0283355378f},
-std::array<float,2>{0.0879824907f, 0.771178246f},
-std::array<float,2>{0.431035578f, 0.35824272f},
-std::array<float,2>{0.911009192f, 0.521039605f},
-std::array<float,2>{0.520241559f, 0.291372567f},
-std::array<float,2>{0.127689838f, 0.61894381f},
-std::array<float,2>{0.281982988f, 0.100634262f},
-std::array<float,2>{0.769508541f, 0.818069577f},
-std::array<float,2>{0.953471005f, 0.142227918f},
-std::array<float,2>{0.481755942f, 0.996457994f},
-std::array<float,2>{0.0591670834f, 0.416679114f},
-std::array<float,2>{0.735850155f, 0.734296262f},
-std::array<float,2>{0.920123756f, 0.493651569f},
-std::array<float,2>{0.426614195f, 0.634803295f},
-std::array<float,2>{0.0854105055f, 0.228592798f},
-std::array<float,2>{0.677149355f, 0.906569839f},
-std::array<float,2>{0.607657433f, 0.054901801f},
-std::array<float,2>{0.248310134f, 0.786820054f},
-std::array<float,2>{0.331435382f, 0.332178175f},
-std::array<float,2>{0.851973414f, 0.535984159f},
-std::array<float,2>{0.748848557f, 0.258054763f},
-std::array<float,2>{0.0476696156f, 0.567470133f},
-std::array<float,2>{0.470778763f, 0.0658162907f},
-std::array<float,2>{0.964122653f, 0.84501344f},
-std::array<float,2>{0.779445291f, 0.187251836f},
-std::array<float,2>{0.29495886f, 0.954801142f},
-std::array<float,2>{0.139643133f, 0.39080739f},
-std::array<float,2>{0.525790155f, 0.690798819f},
-std::array<float,2>{0.813986421f, 0.345301479f},
-std::array<float,2>{0.360935062f, 0.525667906f},
-std::array<float,2>{0.196234405f, 0.0175760929f},
-std::array<float,2>{0.5797351f, 0.779704332f},
-std::array<float,2>{0.65170753f, 0.18963176f},
-std::array<float,2>{0.113455169f, 0.893629611f},
-std::array<float,2>{0.392054856f, 0.447676599f},
-std::array<float,2>{0.895023763f, 0.666925013f},
-std::array<float,2>{0.541744828f, 0.410594523f},
-std::array<float,2>{0.163896844f, 0.723589897f},
-std::array<float,2>{0.279932022f, 0.14850153f},
-std::array<float,2>{0.806881487f, 0.98782438f},
-std::array<float,2>{0.993085444f, 0.102109112f},
-std::array<float,2>{0.455394983f, 0.825775027f},
-std::array<float,2>{0.00287002116f, 0.288147539f},
-std::array<float,2>{0.708920836f, 0.609873712f},
-std::array<float,2>{0.947235227f, 0.301422596f},
-std::array<float,2>{0.49813053f, 0.608555973f},
-std::array<float,2>{0.0449052341f, 0.116115697f},
-std::array<float,2>{0.732033193f, 0.842910588f},
-std::array<float,2>{0.511590004f, 0.134237662f},
-std::array<float,2>{0.149337471f, 0.980499327f},
-std::array<float,2>{0.311138749f, 0.432097405f},
-std::array<float,2>{0.761513472f, 0.736027241f},
-std::array<float,2>{0.660126209f, 0.460072219f},
-std::array<float,2>{0.0659204945f, 0.681812346f},
-std::array<float,2>{0.407105714f, 0.217599928f},
-std::array<float,2>{0.926020026f, 0.880050063f},
-std::array<float,2>{0.872547865f, 0.0109325573f},
-std::array<float,2>{0.315312266f, 0.75166446f},
-std::array<float,2>{0.223047465f, 0.373426765f},
-std::array<float,2>{0.616360247f, 0.501187086f},
-std::array<float,2>{0.792575538f, 0.388190508f},
-std::array<float,2>{0.252142578f, 0.70710659f},
-std::array<float,2>{0.173441261f, 0.163757414f},
-std::array<float,2>{0.552740157f, 0.944663405f},
-std::array<float,2>{0.695121229f, 0.0890011638f},
-std::array<float,2>{0.0307478979f, 0.861982524f},
-std::array<float,2>{0.440267861f, 0.266738117f},
-std::array<float,2>{0.980938077f, 0.584096849f},
-std::array<float,2>{0.570699513f, 0.323896855f},
-std::array<float,2>{0.216025949f, 0.554127455f},
-std::array<float,2>{0.347917438f, 0.036378026f},
-std::array<float,2>{0.841132879f, 0.807559252f},
-std::array<float,2>{0.887381375f, 0.239404678f},
-std::array<float,2>{0.385317326f, 0.927060723f},
-std::array<float,2>{0.10461241f, 0.483312845f},
-std::array<float,2>{0.626705289f, 0.641341805f},
-std::array<float,2>{0.977622926f, 0.444282621f},
-std::array<float,2>{0.442295164f, 0.663328767f},
-std::array<float,2>{0.0246519372f, 0.197060615f},
-std::array<float,2>{0.689064324f, 0.8987149f},
-std::array<float,2>{0.548129857f, 0.0261140112f},
-std::array<float,2>{0.178422511f, 0.769426167f},
-std::array<float,2>{0.256697744f, 0.354883134f},
-std::array<float,2>{0.794608712f, 0.515901446f},
-std::array<float,2>{0.630332768f, 0.295066714f},
-std::array<float,2>{0.106439568f, 0.622516632f},
-std::array<float,2>{0.388909429f, 0.095934391f},
-std::array<float,2>{0.884336114f, 0.813781559f},
-std::array<float,2>{0.837712944f, 0.148248538f},
-std::array<float,2>{0.347438067f, 0.995818496f},
-std::array<float,2>{0.21175997f, 0.420771122f},
-std::array<float,2>{0.576949716f, 0.727036715f},
-std::array<float,2>{0.762001097f, 0.337473303f},
-std::array<float,2>{0.307993531f, 0.539951324f},
-std::array<float,2>{0.153829843f, 0.0488266349f},
-std::array<float,2>{0.513121486f, 0.791551769f},
-std::array<float,2>{0.728702962f, 0.220541701f},
-std::array<float,2>{0.0428478681f, 0.914190173f},
-std::array<float,2>{0.493376404f, 0.488976389f},
-std::array<float,2>{0.951935589f, 0.631444752f},
-std::array<float,2>{0.613107264f, 0.400452048f},
-std::array<float,2>{0.222340658f, 0.702846408f},
-std::array<float,2>{0.319832623f, 0.173346892f},
-std::array<float,2>{0.868727088f, 0.964376926f},
-std::array<float,2>{0.922176898f, 0.0742040277f},
-std::array<float,2>{0.411117196f, 0.852039039f},
-std::array<float,2>{0.0701698288f, 0.25314641f},
-std::array<float,2>{0.661400795f, 0.575067461f},
-std::array<float,2>{0.892515302f, 0.280320883f},
-std::array<float,2>{0.395284474f, 0.588059902f},
-std::array<float,2>{0.113184087f, 0.0826817602f},
-std::array<float,2>{0.65568167f, 0.872478783f},
-std::array<float,2>{0.583416462f, 0.166114703f},
-std::array<float,2>{0.200242504f, 0.950643837f},
-std::array<float,2>{0.365819544f, 0.379066557f},
-std::array<float,2>{0.817488074f, 0.714679539f},
-std::array<float,2>{0.70436728f, 0.468907833f},
-std::array<float,2>{0.00541807292f, 0.652840734f},
-std::array<float,2>{0.459369779f, 0.245839462f},
-std::array<float,2>{0.99955833f, 0.931363463f},
-std::array<float,2>{0.812265933f, 0.0403430685f},
-std::array<float,2>{0.276196063f, 0.802764177f},
-std::array<float,2>{0.157729402f, 0.315457225f},
-std::array<float,2>{0.545344532f, 0.556041718f},
-std::array<float,2>{0.857205987f, 0.42246893f},
-std::array<float,2>{0.334562123f, 0.743515372f},
-std::array<float,2>{0.242697731f, 0.125474051f},
-std::array<float,2>{0.604065418f, 0.971687913f},
-std::array<float,2>{0.674215734f, 0.120199442f},
-std::array<float,2>{0.0819212273f, 0.832701266f},
-std::array<float,2>{0.422344029f, 0.304728091f},
-std::array<float,2>{0.914891303f, 0.59940666f},
-std::array<float,2>{0.527669013f, 0.363805115f},
-std::array<float,2>{0.134457409f, 0.508599222f},
-std::array<float,2>{0.29207629f, 0.000327970076f},
-std::array<float,2>{0.777039051f, 0.759956837f},
-std::array<float,2>{0.965828478f, 0.208857104f},
-std::array<float,2>{0.476455063f, 0.888949633f},
-std::array<float,2>{0.0511262454f, 0.467412174f},
-std::array<float,2>{0.744892597f, 0.676921368f},
-std::array<float,2>{0.906489789f, 0.385822266f},
-std::array<float,2>{0.436823964f, 0.703381419f},
-std::array<float,2>{0.0911147222f, 0.157989353f},
-std::array<float,2>{0.680834353f, 0.938905597f},
-std::array<float,2>{0.601046979f, 0.0927991495f},
-std::array<float,2>{0.240431041f, 0.864226043f},
-std::array<float,2>{0.340093166f, 0.27148214f},
-std::array<float,2>{0.844332099f, 0.580287457f},
-std::array<float,2>{0.739679575f, 0.324874848f},
-std::array<float,2>{0.058079049f, 0.54937017f},
-std::array<float,2>{0.479003459f, 0.0328286812f},
-std::array<float,2>{0.958502471f, 0.809355378f},
-std::array<float,2>{0.770356119f, 0.237754628f},
-std::array<float,2>{0.286368072f, 0.922414064f},
-std::array<float,2>{0.129619896f, 0.477313638f},
-std::array<float,2>{0.516626179f, 0.645587623f},
-std::array<float,2>{0.824365735f, 0.297627896f},
-std::array<float,2>{0.367673367f, 0.602434516f},
-std::array<float,2>{0.193735778f, 0.111405246f},
-std::array<float,2>{0.592202663f, 0.836176991f},
-std::array<float,2>{0.646312714f, 0.137811303f},
-std::array<float,2>{0.12216562f, 0.979160547f},
-std::array<float,2>{0.400971234f, 0.435637683f},
-std::array<float,2>{0.903243661f, 0.738565147f},
-std::array<float,2>{0.538706958f, 0.456690848f},
-std::array<float,2>{0.165279016f, 0.686894417f},
-std::array<float,2>{0.273192704f, 0.214328453f},
-std::array<float,2>{0.804015636f, 0.875843704f},
-std::array<float,2>{0.988840461f, 0.0125397881f},
-std::array<float,2>{0.468468845f, 0.757749915f},
-std::array<float,2>{0.00994673558f, 0.370123684f},
-std::array<float,2>{0.715329051f, 0.505964816f},
-std::array<float,2>{0.938195407f, 0.350629181f},
-std::array<float,2>{0.486130118f, 0.530196488f},
-std::array<float,2>{0.0325918309f, 0.0218993519f},
-std::array<float,2>{0.718918681f, 0.775637805f},
-std::array<float,2>{0.507470787f, 0.194243714f},
-std::array<float,2>{0.142476633f, 0.896572053f},
-std::array<float,2>{0.298541546f, 0.449873477f},
-std::array<float,2>{0.75398916f, 0.668674588f},
-std::array<float,2>{0.669420004f, 0.408207119f},
-std::array<float,2>{0.0752065852f, 0.718905091f},
-std::array<float,2>{0.421201646f, 0.154395163f},
-std::array<float,2>{0.933237493f, 0.990902007f},
-std::array<float,2>{0.864484668f, 0.108076945f},
-std::array<float,2>{0.327792913f, 0.823744833f},
-std::array<float,2>{0.232109055f, 0.281419188f},
-std::array<float,2>{0.621242821f, 0.614507318f},
-std::array<float,2>{0.783022642f, 0.498527467f},
-std::array<float,2>{0.260349989f, 0.638690472f},
-std::array<float,2>{0.186958194f, 0.234149635f},
-std::array<float,2>{0.560136735f, 0.913319707f},
-std::array<float,2>{0.695783317f, 0.0608348362f},
-std::array<float,2>{0.0206517167f, 0.78257823f},
-std::array<float,2>{0.447207242f, 0.328212142f},
-std::array<float,2>{0.971224785f, 0.533791065f},
-std::array<float,2>{0.570047498f, 0.263375312f},
-std::array<float,2>{0.210647285f, 0.564588547f},
-std::array<float,2>{0.353401661f, 0.0684518814f},
-std::array<float,2>{0.830754697f, 0.850783408f},
-std::array<float,2>{0.875600398f, 0.18144466f},
-std::array<float,2>{0.376108706f, 0.960547149f},
-std::array<float,2>{0.0947288349f, 0.397190094f},
-std::array<float,2>{0.639685035f, 0.694095731f},
-std::array<float,2>{0.956711829f, 0.417548865f},
-std::array<float,2>{0.483959675f, 0.732633114f},
-std::array<float,2>{0.0616858602f, 0.141275883f},
-std::array<float,2>{0.736725152f, 0.997836769f},
-std::array<float,2>{0.522113562f, 0.0996655896f},
-std::array<float,2>{0.126666337f, 0.816506386f},
-std::array<float,2>{0.283863276f, 0.292826623f},
-std::array<float,2>{0.76683414f, 0.617296934f},
-std::array<float,2>{0.685115874f, 0.358521968f},
-std::array<float,2>{0.0863040686f, 0.519582868f},
-std::array<float,2>{0.431888163f, 0.0280631334f},
-std::array<float,2>{0.912131667f, 0.769950092f},
-std::array<float,2>{0.850621104f, 0.202960581f},
-std::array<float,2>{0.339253396f, 0.903991342f},
-std::array<float,2>{0.236350134f, 0.437672168f},
-std::array<float,2>{0.595708847f, 0.659297943f},
-std::array<float,2>{0.797288716f, 0.25559786f},
-std::array<float,2>{0.269509077f, 0.570433438f},
-std::array<float,2>{0.169939533f, 0.0774691626f},
-std::array<float,2>{0.533620417f, 0.859158814f},
-std::array<float,2>{0.712019563f, 0.177669078f},
-std::array<float,2>{0.0117644407f, 0.967991769f},
-std::array<float,2>{0.461687297f, 0.405525297f},
-std::array<float,2>{0.986497939f, 0.697464585f},
-std::array<float,2>{0.586914241f, 0.487092227f},
-std::array<float,2>{0.188873202f, 0.626009881f},
-std::array<float,2>{0.372806728f, 0.222934231f},
-std::array<float,2>{0.823579609f, 0.919219613f},
-std::array<float,2>{0.899865687f, 0.0518607982f},
-std::array<float,2>{0.404750764f, 0.796334803f},
-std::array<float,2>{0.11967025f, 0.343696743f},
-std::array<float,2>{0.641306818f, 0.545980811f},
-std::array<float,2>{0.935159802f, 0.319386691f},
-std::array<float,2>{0.41609028f, 0.562259078f},
-std::array<float,2>{0.0713226125f, 0.0464182161f},
-std::array<float,2>{0.664232314f, 0.798098922f},
-std::array<float,2>{0.617425084f, 0.247185543f},
-std::array<float,2>{0.228018999f, 0.937455475f},
-std::array<float,2>{0.322611243f, 0.475478023f},
-std::array<float,2>{0.862110853f, 0.649310648f},
-std::array<float,2>{0.723119795f, 0.37697655f},
-std::array<float,2>{0.0352968797f, 0.717979252f},
-std::array<float,2>{0.490462244f, 0.170775592f},
-std::array<float,2>{0.941973865f, 0.945623338f},
-std::array<float,2>{0.751351476f, 0.0791081935f},
-std::array<float,2>{0.303222984f, 0.867260814f},
-std::array<float,2>{0.146166354f, 0.274370551f},
-std::array<float,2>{0.502042711f, 0.593309283f},
-std::array<float,2>{0.83411926f, 0.462610543f},
-std::array<float,2>{0.357691467f, 0.672189415f},
-std::array<float,2>{0.206601143f, 0.205474511f},
-std::array<float,2>{0.565446138f, 0.883775711f},
-std::array<float,2>{0.633220673f, 0.00616048416f},
-std::array<float,2>{0.0980857983f, 0.764684081f},
-std::array<float,2>{0.380084425f, 0.359623879f},
-std::array<float,2>{0.879233837f, 0.512385488f},
-std::array<float,2>{0.558025062f, 0.309581667f},
-std::array<float,2>{0.180404678f, 0.597181022f},
-std::array<float,2>{0.263179183f, 0.12393041f},
-std::array<float,2>{0.786258996f, 0.82936579f},
-std::array<float,2>{0.972909272f, 0.132017255f},
-std::array<float,2>{0.450859278f, 0.973874986f},
-std::array<float,2>{0.0193165913f, 0.427965432f},
-std::array<float,2>{0.702822506f, 0.747311831f},
-std::array<float,2>{0.889212191f, 0.484066218f},
-std::array<float,2>{0.384031087f, 0.642151296f},
-std::array<float,2>{0.10172791f, 0.23881723f},
-std::array<float,2>{0.628409505f, 0.925824881f},
-std::array<float,2>{0.573453724f, 0.0357385911f},
-std::array<float,2>{0.218629539f, 0.807846546f},
-std::array<float,2>{0.349793375f, 0.322951287f},
-std::array<float,2>{0.842253566f, 0.553681135f},
-std::array<float,2>{0.692795396f, 0.26652053f},
-std::array<float,2>{0.0274328906f, 0.585540593f},
-std::array<float,2>{0.438564777f, 0.0884484053f},
-std::array<float,2>{0.98369658f, 0.863083839f},
-std::array<float,2>{0.790651739f, 0.163026392f},
-std::array<float,2>{0.251929849f, 0.943410516f},
-std::array<float,2>{0.175758496f, 0.386972427f},
-std::array<float,2>{0.552657843f, 0.708340824f},
-std::array<float,2>{0.874146938f, 0.374230057f},
-std::array<float,2>{0.314447045f, 0.500294209f},
-std::array<float,2>{0.224645168f, 0.0105446391f},
-std::array<float,2>{0.614255786f, 0.750928283f},
-std::array<float,2>{0.656704783f, 0.21848774f},
-std::array<float,2>{0.06401667f, 0.879829228f},
-std::array<float,2>{0.408793628f, 0.459168583f},
-std::array<float,2>{0.928312838f, 0.682655752f},
-std::array<float,2>{0.50885427f, 0.433296323f},
-std::array<float,2>{0.151410162f, 0.734956503f},
-std::array<float,2>{0.30896005f, 0.133169085f},
-std::array<float,2>{0.758212268f, 0.981657624f},
-std::array<float,2>{0.947829843f, 0.116522186f},
-std::array<float,2>{0.496430665f, 0.842452466f},
-std::array<float,2>{0.0450772382f, 0.301876158f},
-std::array<float,2>{0.73332268f, 0.607988298f},
-std::array<float,2>{0.995588541f, 0.287181854f},
-std::array<float,2>{0.453986853f, 0.611041665f},
-std::array<float,2>{0.000253040256f, 0.102860935f},
-std::array<float,2>{0.710047305f, 0.824287593f},
-std::array<float,2>{0.540682912f, 0.149814442f},
-std::array<float,2>{0.161596f, 0.987197042f},
-std::array<float,2>{0.277427018f, 0.411196977f},
-std::array<float,2>{0.805208623f, 0.724090695f},
-std::array<float,2>{0.650072813f, 0.44921428f},
-std::array<float,2>{0.11710804f, 0.667724431f},
-std::array<float,2>{0.393350542f, 0.190775782f},
-std::array<float,2>{0.898157656f, 0.893434286f},
-std::array<float,2>{0.816316247f, 0.0159773733f},
-std::array<float,2>{0.362977892f, 0.780858874f},
-std::array<float,2>{0.198948711f, 0.343937367f},
-std::array<float,2>{0.581801116f, 0.526788414f},
-std::array<float,2>{0.777529657f, 0.392250985f},
-std::array<float,2>{0.293089569f, 0.689467371f},
-std::array<float,2>{0.13813667f, 0.185668066f},
-std::array<float,2>{0.524680257f, 0.95345974f},
-std::array<float,2>{0.74726212f, 0.0652540922f},
-std::array<float,2>{0.0495206937f, 0.844367743f},
-std::array<float,2>{0.470257699f, 0.259762317f},
-std::array<float,2>{0.96235615f, 0.567271888f},
-std::array<float,2>{0.60726732f, 0.333656132f},
-std::array<float,2>{0.247236416f, 0.536650538f},
-std::array<float,2>{0.329019099f, 0.0558894202f},
-std::array<float,2>{0.853813469f, 0.785990179f},
-std::array<float,2>{0.918198943f, 0.229922131f},
-std::array<float,2>{0.427853227f, 0.90797919f},
-std::array<float,2>{0.082256034f, 0.493056178f},
-std::array<float,2>{0.678266823f, 0.63656646f},
-std::array<float,2>{0.949538469f, 0.491344035f},
-std::array<float,2>{0.494283736f, 0.629669011f},
-std::array<float,2>{0.0409960635f, 0.220759228f},
-std::array<float,2>{0.728397727f, 0.917378724f},
-std::array<float,2>{0.51451838f, 0.0504462905f},
-std::array<float,2>{0.156000882f, 0.790498555f},
-std::array<float,2>{0.305737734f, 0.338783741f},
-std::array<float,2>{0.763890684f, 0.542576313f},
-std::array<float,2>{0.663694024f, 0.251513124f},
-std::array<float,2>{0.0677690729f, 0.576638699f},
-std::array<float,2>{0.413617849f, 0.0717859492f},
-std::array<float,2>{0.92452383f, 0.855365932f},
-std::array<float,2>{0.87104845f, 0.174306348f},
-std::array<float,2>{0.317045629f, 0.961668491f},
-std::array<float,2>{0.219257742f, 0.399244517f},
-std::array<float,2>{0.611244977f, 0.699229002f},
-std::array<float,2>{0.795100391f, 0.352360755f},
-std::array<float,2>{0.253932685f, 0.518517911f},
-std::array<float,2>{0.176445842f, 0.024453653f},
-std::array<float,2>{0.549435675f, 0.766945422f},
-std::array<float,2>{0.68975383f, 0.198964953f},
-std::array<float,2>{0.0270139091f, 0.901774585f},
-std::array<float,2>{0.44338274f, 0.441581607f},
-std::array<float,2>{0.979834676f, 0.66119796f},
-std::array<float,2>{0.575261772f, 0.418480545f},
-std::array<float,2>{0.213378593f, 0.728886247f},
-std::array<float,2>{0.345087707f, 0.146296144f},
-std::array<float,2>{0.838712335f, 0.993434131f},
-std::array<float,2>{0.885834813f, 0.0942578912f},
-std::array<float,2>{0.387382627f, 0.815031767f},
-std::array<float,2>{0.108737886f, 0.293316573f},
-std::array<float,2>{0.631016433f, 0.623299122f},
-std::array<float,2>{0.917731941f, 0.308529735f},
-std::array<float,2>{0.424768239f, 0.600374877f},
-std::array<float,2>{0.0793471038f, 0.117272675f},
-std::array<float,2>{0.673518062f, 0.834220588f},
-std::array<float,2>{0.603306949f, 0.128061935f},
-std::array<float,2>{0.245557293f, 0.970631003f},
-std::array<float,2>{0.333780169f, 0.42457366f},
-std::array<float,2>{0.858864844f, 0.744528294f},
-std::array<float,2>{0.7424106f, 0.465712607f},
-std::array<float,2>{0.0540501028f, 0.678713262f},
-std::array<float,2>{0.472819656f, 0.209963351f},
-std::array<float,2>{0.966970086f, 0.888381481f},
-std::array<float,2>{0.773507357f, 0.00351882586f},
-std::array<float,2>{0.290965676f, 0.758392274f},
-std::array<float,2>{0.136078551f, 0.365633935f},
-std::array<float,2>{0.531045794f, 0.509772897f},
-std::array<float,2>{0.82028538f, 0.382663995f},
-std::array<float,2>{0.365014225f, 0.712217927f},
-std::array<float,2>{0.201373786f, 0.165101543f},
-std::array<float,2>{0.584560096f, 0.951720834f},
-std::array<float,2>{0.653509021f, 0.0847033635f},
-std::array<float,2>{0.109639168f, 0.873637795f},
-std::array<float,2>{0.397756606f, 0.279122829f},
-std::array<float,2>{0.894458115f, 0.587216377f},
-std::array<float,2>{0.544605255f, 0.313482463f},
-std::array<float,2>{0.159897894f, 0.558341086f},
-std::array<float,2>{0.27364251f, 0.0426882431f},
-std::array<float,2>{0.80885011f, 0.801567912f},
-std::array<float,2>{0.9971627f, 0.242299438f},
-std::array<float,2>{0.45817247f, 0.931946456f},
-std::array<float,2>{0.00615289947f, 0.472269535f},
-std::array<float,2>{0.706665039f, 0.654360056f},
-std::array<float,2>{0.905996323f, 0.433612287f},
-std::array<float,2>{0.398713201f, 0.740814328f},
-std::array<float,2>{0.124833465f, 0.139368236f},
-std::array<float,2>{0.647112727f, 0.977809429f},
-std::array<float,2>{0.590321541f, 0.109607592f},
-std::array<float,2>{0.192688063f, 0.838665307f},
-std::array<float,2>{0.369448721f, 0.299564421f},
-std::array<float,2>{0.827039659f, 0.604291677f},
-std::array<float,2>{0.718533397f, 0.368529439f},
-std::array<float,2>{0.00862252899f, 0.505772769f},
-std::array<float,2>{0.464847058f, 0.0150829684f},
-std::array<float,2>{0.990738809f, 0.754397631f},
-std::array<float,2>{0.801669598f, 0.212294266f},
-std::array<float,2>{0.270749599f, 0.877201021f},
-std::array<float,2>{0.166206345f, 0.453495532f},
-std::array<float,2>{0.536699176f, 0.684498847f},
-std::array<float,2>{0.845904648f, 0.273412287f},
-std::array<float,2>{0.342905879f, 0.579143763f},
-std::array<float,2>{0.239773095f, 0.0911828578f},
-std::array<float,2>{0.599126518f, 0.866471112f},
-std::array<float,2>{0.681922317f, 0.159628987f},
-std::array<float,2>{0.092195034f, 0.940152764f},
-std::array<float,2>{0.434314758f, 0.383764595f},
-std::array<float,2>{0.909595966f, 0.705664515f},
-std::array<float,2>{0.519202411f, 0.47871995f},
-std::array<float,2>{0.132084012f, 0.64749527f},
-std::array<float,2>{0.287899822f, 0.235042959f},
-std::array<float,2>{0.771838725f, 0.925547123f},
-std::array<float,2>{0.960001647f, 0.0347482227f},
-std::array<float,2>{0.47677201f, 0.811579108f},
-std::array<float,2>{0.0566057488f, 0.326934159f},
-std::array<float,2>{0.740795374f, 0.548240125f},
-std::array<float,2>{0.969014943f, 0.330375582f},
-std::array<float,2>{0.44879961f, 0.533153117f},
-std::array<float,2>{0.0218177848f, 0.0588565692f},
-std::array<float,2>{0.698249876f, 0.784786224f},
-std::array<float,2>{0.560601771f, 0.230792254f},
-std::array<float,2>{0.185173437f, 0.911528707f},
-std::array<float,2>{0.258166313f, 0.49687013f},
-std::array<float,2>{0.78344363f, 0.63777101f},
-std::array<float,2>{0.63717705f, 0.3951689f},
-std::array<float,2>{0.0965745375f, 0.693328917f},
-std::array<float,2>{0.377905518f, 0.183119491f},
-std::array<float,2>{0.878056288f, 0.95855689f},
-std::array<float,2>{0.829816401f, 0.0666578934f},
-std::array<float,2>{0.354634136f, 0.848099828f},
-std::array<float,2>{0.208979547f, 0.264351606f},
-std::array<float,2>{0.568274021f, 0.562537074f},
-std::array<float,2>{0.75726527f, 0.452714831f},
-std::array<float,2>{0.299032182f, 0.671067595f},
-std::array<float,2>{0.143021375f, 0.191728666f},
-std::array<float,2>{0.503957629f, 0.896305084f},
-std::array<float,2>{0.722252965f, 0.0198279042f},
-std::array<float,2>{0.0349148437f, 0.77489686f},
-std::array<float,2>{0.486777008f, 0.349148631f},
-std::array<float,2>{0.940140367f, 0.527652383f},
-std::array<float,2>{0.623736382f, 0.284862757f},
-std::array<float,2>{0.232829735f, 0.617174804f},
-std::array<float,2>{0.324896932f, 0.105495535f},
-std::array<float,2>{0.865555406f, 0.82114464f},
-std::array<float,2>{0.931404412f, 0.152399302f},
-std::array<float,2>{0.418050647f, 0.988891661f},
-std::array<float,2>{0.0775385126f, 0.407482624f},
-std::array<float,2>{0.671385229f, 0.721681774f},
-std::array<float,2>{0.984706402f, 0.404264331f},
-std::array<float,2>{0.463121891f, 0.697026014f},
-std::array<float,2>{0.0152253928f, 0.177850112f},
-std::array<float,2>{0.713442862f, 0.965883732f},
-std::array<float,2>{0.531270504f, 0.0761321262f},
-std::array<float,2>{0.16987747f, 0.857185543f},
-std::array<float,2>{0.266826868f, 0.25775075f},
-std::array<float,2>{0.799808383f, 0.573866546f},
-std::array<float,2>{0.643759131f, 0.340679526f},
-std::array<float,2>{0.117892586f, 0.543815911f},
-std::array<float,2>{0.402585477f, 0.0544080175f},
-std::array<float,2>{0.901729345f, 0.794852316f},
-std::array<float,2>{0.820650756f, 0.224874049f},
-std::array<float,2>{0.373437554f, 0.921278656f},
-std::array<float,2>{0.190827519f, 0.485587716f},
-std::array<float,2>{0.588949382f, 0.62695837f},
-std::array<float,2>{0.768122792f, 0.289204568f},
-std::array<float,2>{0.2830562f, 0.619449735f},
-std::array<float,2>{0.127987877f, 0.0994048193f},
-std::array<float,2>{0.520868301f, 0.820122302f},
-std::array<float,2>{0.735060394f, 0.144199908f},
-std::array<float,2>{0.0599966869f, 0.999076903f},
-std::array<float,2>{0.48062411f, 0.414083809f},
-std::array<float,2>{0.954931796f, 0.731080174f},
-std::array<float,2>{0.594747782f, 0.440095097f},
-std::array<float,2>{0.234978408f, 0.656694412f},
-std::array<float,2>{0.336692989f, 0.201167107f},
-std::array<float,2>{0.849533081f, 0.905062199f},
-std::array<float,2>{0.911317289f, 0.029663302f},
-std::array<float,2>{0.430364966f, 0.771856666f},
-std::array<float,2>{0.0897430256f, 0.357299149f},
-std::array<float,2>{0.687148333f, 0.522603869f},
-std::array<float,2>{0.881038427f, 0.361383379f},
-std::array<float,2>{0.382373244f, 0.514680028f},
-std::array<float,2>{0.0996872336f, 0.00492313644f},
-std::array<float,2>{0.634933829f, 0.76275295f},
-std::array<float,2>{0.563869238f, 0.20469287f},
-std::array<float,2>{0.203840241f, 0.886613011f},
-std::array<float,2>{0.355657309f, 0.463410735f},
-std::array<float,2>{0.832167745f, 0.675626934f},
-std::array<float,2>{0.700370908f, 0.426886678f},
-std::array<float,2>{0.0166247729f, 0.748350263f},
-std::array<float,2>{0.451693118f, 0.129794165f},
-std::array<float,2>{0.975400329f, 0.97630012f},
-std::array<float,2>{0.787786782f, 0.1222094f},
-std::array<float,2>{0.263922065f, 0.830322742f},
-std::array<float,2>{0.182111442f, 0.311154753f},
-std::array<float,2>{0.556044817f, 0.595387995f},
-std::array<float,2>{0.8613258f, 0.472836941f},
-std::array<float,2>{0.321100831f, 0.651776195f},
-std::array<float,2>{0.230225414f, 0.2493525f},
-std::array<float,2>{0.619529068f, 0.934771538f},
-std::array<float,2>{0.667276084f, 0.0440725908f},
-std::array<float,2>{0.0739062503f, 0.800021827f},
-std::array<float,2>{0.414337546f, 0.316429198f},
-std::array<float,2>{0.936199963f, 0.558675051f},
-std::array<float,2>{0.500864148f, 0.276348114f},
-std::array<float,2>{0.146911502f, 0.590322793f},
-std::array<float,2>{0.302602857f, 0.0812989622f},
-std::array<float,2>{0.753691792f, 0.869846463f},
-std::array<float,2>{0.944555342f, 0.168255955f},
-std::array<float,2>{0.489268631f, 0.948899269f},
-std::array<float,2>{0.038929265f, 0.375852317f},
-std::array<float,2>{0.725736201f, 0.715427279f},
-std::array<float,2>{0.927395105f, 0.457279474f},
-std::array<float,2>{0.408122629f, 0.681005359f},
-std::array<float,2>{0.0651324466f, 0.216428593f},
-std::array<float,2>{0.658953846f, 0.882580042f},
-std::array<float,2>{0.616116941f, 0.00800437573f},
-std::array<float,2>{0.224072218f, 0.75263238f},
-std::array<float,2>{0.316182941f, 0.371892393f},
-std::array<float,2>{0.871793985f, 0.502411187f},
-std::array<float,2>{0.730527937f, 0.304527372f},
-std::array<float,2>{0.0435316339f, 0.606155455f},
-std::array<float,2>{0.499406338f, 0.114735954f},
-std::array<float,2>{0.945349872f, 0.840950191f},
-std::array<float,2>{0.760031223f, 0.135718569f},
-std::array<float,2>{0.312318057f, 0.982749045f},
-std::array<float,2>{0.149947956f, 0.430230558f},
-std::array<float,2>{0.510684609f, 0.736437082f},
-std::array<float,2>{0.840447724f, 0.320909113f},
-std::array<float,2>{0.349345416f, 0.550887704f},
-std::array<float,2>{0.215808347f, 0.038099438f},
-std::array<float,2>{0.571472466f, 0.805027664f},
-std::array<float,2>{0.625462174f, 0.24213101f},
-std::array<float,2>{0.103960671f, 0.929256082f},
-std::array<float,2>{0.386398524f, 0.480584055f},
-std::array<float,2>{0.887916565f, 0.643921018f},
-std::array<float,2>{0.554308593f, 0.390170753f},
-std::array<float,2>{0.172763586f, 0.709182739f},
-std::array<float,2>{0.253121555f, 0.16145134f},
-std::array<float,2>{0.79107368f, 0.941435993f},
-std::array<float,2>{0.981502593f, 0.0870785788f},
-std::array<float,2>{0.44087562f, 0.861050904f},
-std::array<float,2>{0.0296156909f, 0.26817441f},
-std::array<float,2>{0.693944573f, 0.583099246f},
-std::array<float,2>{0.96327275f, 0.259839326f},
-std::array<float,2>{0.472634405f, 0.570206225f},
-std::array<float,2>{0.0479801744f, 0.0628729016f},
-std::array<float,2>{0.749567688f, 0.846976757f},
-std::array<float,2>{0.527033269f, 0.184937984f},
-std::array<float,2>{0.140614226f, 0.956596255f},
-std::array<float,2>{0.296584666f, 0.394339651f},
-std::array<float,2>{0.780756116f, 0.689287186f},
-std::array<float,2>{0.676509738f, 0.495563f},
-std::array<float,2>{0.0849238411f, 0.633203804f},
-std::array<float,2>{0.426781446f, 0.227346554f},
-std::array<float,2>{0.921718419f, 0.909466922f},
-std::array<float,2>{0.852820754f, 0.0583936423f},
-std::array<float,2>{0.330486029f, 0.787569642f},
-std::array<float,2>{0.24915503f, 0.334385544f},
-std::array<float,2>{0.609267235f, 0.538165331f},
-std::array<float,2>{0.808522701f, 0.413410574f},
-std::array<float,2>{0.280580401f, 0.724892974f},
-std::array<float,2>{0.162813187f, 0.150450066f},
-std::array<float,2>{0.542639136f, 0.985470355f},
-std::array<float,2>{0.707056224f, 0.104890674f},
-std::array<float,2>{0.00293487846f, 0.827571511f},
-std::array<float,2>{0.456150919f, 0.285445035f},
-std::array<float,2>{0.993793488f, 0.612723708f},
-std::array<float,2>{0.578420818f, 0.346546263f},
-std::array<float,2>{0.196327522f, 0.523703814f},
-std::array<float,2>{0.360116601f, 0.0184007175f},
-std::array<float,2>{0.813168228f, 0.777623892f},
-std::array<float,2>{0.896126866f, 0.188126534f},
-std::array<float,2>{0.390870541f, 0.891860545f},
-std::array<float,2>{0.115222678f, 0.445347935f},
-std::array<float,2>{0.651291847f, 0.664603531f},
-std::array<float,2>{0.970822573f, 0.496185631f},
-std::array<float,2>{0.446305931f, 0.638484359f},
-std::array<float,2>{0.0212249551f, 0.231253967f},
-std::array<float,2>{0.695899427f, 0.912023664f},
-std::array<float,2>{0.560034275f, 0.0591295771f},
-std::array<float,2>{0.187190354f, 0.784224927f},
-std::array<float,2>{0.260163426f, 0.330726266f},
-std::array<float,2>{0.782466233f, 0.532546937f},
-std::array<float,2>{0.640303969f, 0.263811678f},
-std::array<float,2>{0.0956283957f, 0.56305331f},
-std::array<float,2>{0.376574278f, 0.0671300068f},
-std::array<float,2>{0.875082314f, 0.848351538f},
-std::array<float,2>{0.830464184f, 0.182634741f},
-std::array<float,2>{0.352832168f, 0.958323598f},
-std::array<float,2>{0.21011506f, 0.394786f},
-std::array<float,2>{0.56940794f, 0.692763388f},
-std::array<float,2>{0.754658401f, 0.348907471f},
-std::array<float,2>{0.298336059f, 0.527851939f},
-std::array<float,2>{0.14164573f, 0.0203282591f},
-std::array<float,2>{0.50708425f, 0.775139034f},
-std::array<float,2>{0.719496667f, 0.191967413f},
-std::array<float,2>{0.0331707634f, 0.895509601f},
-std::array<float,2>{0.485725015f, 0.452583164f},
-std::array<float,2>{0.937515497f, 0.671846807f},
-std::array<float,2>{0.621893346f, 0.407998919f},
-std::array<float,2>{0.231665134f, 0.722275615f},
-std::array<float,2>{0.327457786f, 0.153265178f},
-std::array<float,2>{0.864770591f, 0.98840493f},
-std::array<float,2>{0.932619452f, 0.106257103f},
-std::array<float,2>{0.421762913f, 0.820388377f},
-std::array<float,2>{0.0758599862f, 0.284327984f},
-std::array<float,2>{0.669789076f, 0.616387606f},
-std::array<float,2>{0.902582645f, 0.299022257f},
-std::array<float,2>{0.400675088f, 0.603622258f},
-std::array<float,2>{0.122742251f, 0.10997925f},
-std::array<float,2>{0.645883024f, 0.837949276f},
-std::array<float,2>{0.592287421f, 0.139016226f},
-std::array<float,2>{0.194213137f, 0.978069842f},
-std::array<float,2>{0.368040979f, 0.43416217f},
-std::array<float,2>{0.824974239f, 0.740539908f},
-std::array<float,2>{0.715634048f, 0.453663081f},
-std::array<float,2>{0.0105134463f, 0.683991432f},
-std::array<float,2>{0.468188584f, 0.212529629f},
-std::array<float,2>{0.98854512f, 0.877759337f},
-std::array<float,2>{0.804674387f, 0.0152558275f},
-std::array<float,2>{0.272724867f, 0.754157186f},
-std::array<float,2>{0.165614024f, 0.369062543f},
-std::array<float,2>{0.538498998f, 0.505183995f},
-std::array<float,2>{0.843973875f, 0.383116096f},
-std::array<float,2>{0.340619385f, 0.705461919f},
-std::array<float,2>{0.241196379f, 0.159814626f},
-std::array<float,2>{0.601229906f, 0.939464927f},
-std::array<float,2>{0.681619346f, 0.0916026086f},
-std::array<float,2>{0.0913100913f, 0.866827965f},
-std::array<float,2>{0.437108874f, 0.272791475f},
-std::array<float,2>{0.906744182f, 0.579808295f},
-std::array<float,2>{0.517297208f, 0.326490283f},
-std::array<float,2>{0.129037887f, 0.548623502f},
-std::array<float,2>{0.286765754f, 0.0345984921f},
-std::array<float,2>{0.769714892f, 0.812355101f},
-std::array<float,2>{0.958268642f, 0.234478325f},
-std::array<float,2>{0.479453415f, 0.924881279f},
-std::array<float,2>{0.0585566983f, 0.479420155f},
-std::array<float,2>{0.740160048f, 0.648118436f},
-std::array<float,2>{0.914308906f, 0.42385301f},
-std::array<float,2>{0.422643811f, 0.744837165f},
-std::array<float,2>{0.081324324f, 0.128773868f},
-std::array<float,2>{0.674486578f, 0.969878018f},
-std::array<float,2>{0.603953242f, 0.117873214f},
-std::array<float,2>{0.242360324f, 0.834772527f},
-std::array<float,2>{0.334198445f, 0.307822675f},
-std::array<float,2>{0.856562495f, 0.599734366f},
-std::array<float,2>{0.744257987f, 0.36594221f},
-std::array<float,2>{0.0515120178f, 0.510355771f},
-std::array<float,2>{0.47586146f, 0.00297573535f},
-std::array<float,2>{0.966575205f, 0.758067489f},
-std::array<float,2>{0.776781619f, 0.21074824f},
-std::array<float,2>{0.2926566f, 0.887994587f},
-std::array<float,2>{0.133952573f, 0.464988172f},
-std::array<float,2>{0.527857065f, 0.679295182f},
-std::array<float,2>{0.818172812f, 0.27857998f},
-std::array<float,2>{0.365551144f, 0.587416887f},
-std::array<float,2>{0.200795859f, 0.0843013376f},
-std::array<float,2>{0.583812237f, 0.873071551f},
-std::array<float,2>{0.656129301f, 0.165831968f},
-std::array<float,2>{0.112592295f, 0.951249421f},
-std::array<float,2>{0.394761503f, 0.382079154f},
-std::array<float,2>{0.891731143f, 0.712414324f},
-std::array<float,2>{0.545436263f, 0.471721917f},
-std::array<float,2>{0.157390714f, 0.655106485f},
-std::array<float,2>{0.2758663f, 0.243015647f},
-std::array<float,2>{0.811634958f, 0.932149529f},
-std::array<float,2>{0.99950093f, 0.0421192758f},
-std::array<float,2>{0.459857494f, 0.801163793f},
-std::array<float,2>{0.00523183448f, 0.314381689f},
-std::array<float,2>{0.704981327f, 0.557800233f},
-std::array<float,2>{0.951426148f, 0.338347763f},
-std::array<float,2>{0.494037896f, 0.542171478f},
-std::array<float,2>{0.0423349105f, 0.0499124639f},
-std::array<float,2>{0.72902447f, 0.790844262f},
-std::array<float,2>{0.513325393f, 0.221555904f},
-std::array<float,2>{0.153466329f, 0.917817593f},
-std::array<float,2>{0.308433086f, 0.491767079f},
-std::array<float,2>{0.762487233f, 0.629295886f},
-std::array<float,2>{0.66183883f, 0.398582309f},
-std::array<float,2>{0.0696135834f, 0.700178087f},
-std::array<float,2>{0.410513192f, 0.174748972f},
-std::array<float,2>{0.922793746f, 0.961171508f},
-std::array<float,2>{0.868180752f, 0.0716577694f},
-std::array<float,2>{0.319813758f, 0.854684651f},
-std::array<float,2>{0.222097874f, 0.250998378f},
-std::array<float,2>{0.612499177f, 0.576727211f},
-std::array<float,2>{0.794418395f, 0.442348719f},
-std::array<float,2>{0.256194055f, 0.661843836f},
-std::array<float,2>{0.178094566f, 0.198662907f},
-std::array<float,2>{0.548453271f, 0.902122021f},
-std::array<float,2>{0.688778102f, 0.0251553673f},
-std::array<float,2>{0.0253085345f, 0.76728946f},
-std::array<float,2>{0.441763639f, 0.35183084f},
-std::array<float,2>{0.978120089f, 0.517685771f},
-std::array<float,2>{0.576362312f, 0.293509126f},
-std::array<float,2>{0.21112977f, 0.623557389f},
-std::array<float,2>{0.346764296f, 0.0937970281f},
-std::array<float,2>{0.837045193f, 0.81487155f},
-std::array<float,2>{0.884200454f, 0.145702809f},
-std::array<float,2>{0.389163077f, 0.993890405f},
-std::array<float,2>{0.105592892f, 0.41814971f},
-std::array<float,2>{0.630674839f, 0.729302227f},
-std::array<float,2>{0.962779999f, 0.394002467f},
-std::array<float,2>{0.470071316f, 0.688701868f},
-std::array<float,2>{0.0490615256f, 0.185539559f},
-std::array<float,2>{0.747776031f, 0.956316411f},
-std::array<float,2>{0.525117993f, 0.063209489f},
-std::array<float,2>{0.138576224f, 0.847613275f},
-std::array<float,2>{0.293474495f, 0.260639846f},
-std::array<float,2>{0.777926326f, 0.569819808f},
-std::array<float,2>{0.678128779f, 0.334910363f},
-std::array<float,2>{0.0825356543f, 0.538748085f},
-std::array<float,2>{0.428271443f, 0.0578031577f},
-std::array<float,2>{0.918655157f, 0.787687361f},
-std::array<float,2>{0.854173005f, 0.226864994f},
-std::array<float,2>{0.328213811f, 0.910009146f},
-std::array<float,2>{0.247672707f, 0.49567154f},
-std::array<float,2>{0.606540442f, 0.633509457f},
-std::array<float,2>{0.804795742f, 0.286030471f},
-std::array<float,2>{0.278068155f, 0.613139689f},
-std::array<float,2>{0.161878675f, 0.105238058f},
-std::array<float,2>{0.540410101f, 0.828035176f},
-std::array<float,2>{0.710854173f, 0.151191384f},
-std::array<float,2>{0.00087321928f, 0.986183822f},
-std::array<float,2>{0.453312814f, 0.413626254f},
-std::array<float,2>{0.995911837f, 0.725131392f},
-std::array<float,2>{0.581259251f, 0.44603458f},
-std::array<float,2>{0.198714346f, 0.664497316f},
-std::array<float,2>{0.362397194f, 0.187729284f},
-std::array<float,2>{0.81555301f, 0.892561793f},
-std::array<float,2>{0.897754908f, 0.0179732163f},
-std::array<float,2>{0.392974764f, 0.778122783f},
-std::array<float,2>{0.116293393f, 0.346133679f},
-std::array<float,2>{0.649851143f, 0.524343312f},
-std::array<float,2>{0.927943349f, 0.371266663f},
-std::array<float,2>{0.408493072f, 0.502604425f},
-std::array<float,2>{0.063899301f, 0.008563268f},
-std::array<float,2>{0.656791627f, 0.752339602f},
-std::array<float,2>{0.613300502f, 0.216295302f},
-std::array<float,2>{0.225263059f, 0.882000268f},
-std::array<float,2>{0.313894838f, 0.457703859f},
-std::array<float,2>{0.874684751f, 0.681554139f},
-std::array<float,2>{0.732499778f, 0.430055887f},
-std::array<float,2>{0.0458857417f, 0.737075388f},
-std::array<float,2>{0.496995896f, 0.134998828f},
-std::array<float,2>{0.947433472f, 0.983143091f},
-std::array<float,2>{0.758602738f, 0.114990957f},
-std::array<float,2>{0.309358567f, 0.841436386f},
-std::array<float,2>{0.152220547f, 0.304027438f},
-std::array<float,2>{0.509700954f, 0.605551362f},
-std::array<float,2>{0.842637956f, 0.481398523f},
-std::array<float,2>{0.350389212f, 0.644146323f},
-std::array<float,2>{0.218171731f, 0.241222873f},
-std::array<float,2>{0.573887408f, 0.929012358f},
-std::array<float,2>{0.628573716f, 0.0390108787f},
-std::array<float,2>{0.102314763f, 0.805571318f},
-std::array<float,2>{0.38474673f, 0.320372432f},
-std::array<float,2>{0.888902605f, 0.551731408f},
-std::array<float,2>{0.552191556f, 0.267603576f},
-std::array<float,2>{0.174826071f, 0.583792984f},
-std::array<float,2>{0.251181126f, 0.0877262652f},
-std::array<float,2>{0.790518582f, 0.860426188f},
-std::array<float,2>{0.984266341f, 0.162051782f},
-std::array<float,2>{0.439035177f, 0.941958427f},
-std::array<float,2>{0.0279693026f, 0.389652312f},
-std::array<float,2>{0.693036616f, 0.709770024f},
-std::array<float,2>{0.879591525f, 0.462990016f},
-std::array<float,2>{0.380400419f, 0.67500329f},
-std::array<float,2>{0.0986128822f, 0.204266742f},
-std::array<float,2>{0.633377492f, 0.886113346f},
-std::array<float,2>{0.566106617f, 0.00584177487f},
-std::array<float,2>{0.206514657f, 0.763246953f},
-std::array<float,2>{0.357929379f, 0.362132818f},
-std::array<float,2>{0.834606647f, 0.51538831f},
-std::array<float,2>{0.702219546f, 0.310913324f},
-std::array<float,2>{0.0188642107f, 0.595168352f},
-std::array<float,2>{0.450263083f, 0.122700527f},
-std::array<float,2>{0.973545313f, 0.830709457f},
-std::array<float,2>{0.786827624f, 0.129053876f},
-std::array<float,2>{0.263571918f, 0.976009011f},
-std::array<float,2>{0.18001835f, 0.427681506f},
-std::array<float,2>{0.558195949f, 0.748734951f},
-std::array<float,2>{0.86146611f, 0.317146987f},
-std::array<float,2>{0.322886735f, 0.55919534f},
-std::array<float,2>{0.228257477f, 0.0445219651f},
-std::array<float,2>{0.617772102f, 0.800629973f},
-std::array<float,2>{0.664697111f, 0.2499993f},
-std::array<float,2>{0.0719826892f, 0.935066938f},
-std::array<float,2>{0.416885018f, 0.473162949f},
-std::array<float,2>{0.934716642f, 0.65216285f},
-std::array<float,2>{0.502578259f, 0.375305623f},
-std::array<float,2>{0.145685181f, 0.714965999f},
-std::array<float,2>{0.302838773f, 0.168761551f},
-std::array<float,2>{0.751591802f, 0.948610008f},
-std::array<float,2>{0.941873968f, 0.0819207281f},
-std::array<float,2>{0.491092175f, 0.869549692f},
-std::array<float,2>{0.0358169526f, 0.275433213f},
-std::array<float,2>{0.723342717f, 0.590457857f},
-std::array<float,2>{0.987080753f, 0.257195473f},
-std::array<float,2>{0.461310655f, 0.573586524f},
-std::array<float,2>{0.0126487287f, 0.0753970593f},
-std::array<float,2>{0.712794602f, 0.856624246f},
-std::array<float,2>{0.53401345f, 0.178623259f},
-std::array<float,2>{0.170540243f, 0.966623425f},
-std::array<float,2>{0.268804312f, 0.403476834f},
-std::array<float,2>{0.797400892f, 0.696706176f},
-std::array<float,2>{0.640970945f, 0.486251861f},
-std::array<float,2>{0.119207129f, 0.627889633f},
-std::array<float,2>{0.405263603f, 0.225164801f},
-std::array<float,2>{0.900381505f, 0.92178154f},
-std::array<float,2>{0.824163318f, 0.0541681759f},
-std::array<float,2>{0.372222811f, 0.794068575f},
-std::array<float,2>{0.18902342f, 0.34003666f},
-std::array<float,2>{0.587781668f, 0.543423057f},
-std::array<float,2>{0.767436862f, 0.414644986f},
-std::array<float,2>{0.283548892f, 0.73070389f},
-std::array<float,2>{0.126324967f, 0.14376235f},
-std::array<float,2>{0.521707296f, 0.999782443f},
-std::array<float,2>{0.737176418f, 0.0987873822f},
-std::array<float,2>{0.0623936653f, 0.81954664f},
-std::array<float,2>{0.483847916f, 0.289599776f},
-std::array<float,2>{0.956206083f, 0.619681239f},
-std::array<float,2>{0.596649766f, 0.356449008f},
-std::array<float,2>{0.236906633f, 0.523371637f},
-std::array<float,2>{0.339368552f, 0.0298348144f},
-std::array<float,2>{0.851203978f, 0.772209764f},
-std::array<float,2>{0.912772775f, 0.200400814f},
-std::array<float,2>{0.432282001f, 0.904500365f},
-std::array<float,2>{0.0865957215f, 0.439703137f},
-std::array<float,2>{0.684810102f, 0.656924307f},
-std::array<float,2>{0.939714491f, 0.449464619f},
-std::array<float,2>{0.487250388f, 0.66832757f},
-std::array<float,2>{0.0344912745f, 0.193366826f},
-std::array<float,2>{0.72211206f, 0.897267818f},
-std::array<float,2>{0.504853964f, 0.0220527351f},
-std::array<float,2>{0.143397629f, 0.776112974f},
-std::array<float,2>{0.299334556f, 0.351209491f},
-std::array<float,2>{0.757790804f, 0.529513359f},
-std::array<float,2>{0.671864271f, 0.282103866f},
-std::array<float,2>{0.0779498965f, 0.615143299f},
-std::array<float,2>{0.418572098f, 0.107889555f},
-std::array<float,2>{0.931027591f, 0.823577642f},
-std::array<float,2>{0.86580354f, 0.154827446f},
-std::array<float,2>{0.324485928f, 0.990507901f},
-std::array<float,2>{0.232993081f, 0.409125954f},
-std::array<float,2>{0.62321049f, 0.719660759f},
-std::array<float,2>{0.783903718f, 0.328991234f},
-std::array<float,2>{0.258788675f, 0.533603549f},
-std::array<float,2>{0.184916362f, 0.0614578314f},
-std::array<float,2>{0.561247408f, 0.782973647f},
-std::array<float,2>{0.698733628f, 0.233784676f},
-std::array<float,2>{0.0222372711f, 0.913981616f},
-std::array<float,2>{0.448637813f, 0.499007434f},
-std::array<float,2>{0.969254553f, 0.639334977f},
-std::array<float,2>{0.56749934f, 0.396594375f},
-std::array<float,2>{0.208338559f, 0.693614304f},
-std::array<float,2>{0.355146021f, 0.181101218f},
-std::array<float,2>{0.82915926f, 0.960315585f},
-std::array<float,2>{0.878426552f, 0.0689970702f},
-std::array<float,2>{0.377252162f, 0.851220131f},
-std::array<float,2>{0.095756568f, 0.263150007f},
-std::array<float,2>{0.637652457f, 0.56505692f},
-std::array<float,2>{0.909877479f, 0.270778656f},
-std::array<float,2>{0.433994889f, 0.580762863f},
-std::array<float,2>{0.0927099586f, 0.0933922231f},
-std::array<float,2>{0.682323575f, 0.863288462f},
-std::array<float,2>{0.599095166f, 0.157447606f},
-std::array<float,2>{0.239728555f, 0.939150333f},
-std::array<float,2>{0.343524545f, 0.386457175f},
-std::array<float,2>{0.84644711f, 0.703914762f},
-std::array<float,2>{0.740544677f, 0.476659358f},
-std::array<float,2>{0.0557732806f, 0.646279097f},
-std::array<float,2>{0.477390826f, 0.237927318f},
-std::array<float,2>{0.960534334f, 0.922059774f},
-std::array<float,2>{0.772170663f, 0.0326926f},
-std::array<float,2>{0.287498087f, 0.808665037f},
-std::array<float,2>{0.132753015f, 0.324450046f},
-std::array<float,2>{0.518892407f, 0.548861027f},
-std::array<float,2>{0.826280892f, 0.436410576f},
-std::array<float,2>{0.369635612f, 0.738966584f},
-std::array<float,2>{0.193030357f, 0.138262987f},
-std::array<float,2>{0.590712667f, 0.978589892f},
-std::array<float,2>{0.646762669f, 0.112214625f},
-std::array<float,2>{0.124064386f, 0.836723864f},
-std::array<float,2>{0.399307102f, 0.297006339f},
-std::array<float,2>{0.905680895f, 0.601946175f},
-std::array<float,2>{0.536588371f, 0.370952994f},
-std::array<float,2>{0.166656658f, 0.506505311f},
-std::array<float,2>{0.271024376f, 0.0119832009f},
-std::array<float,2>{0.801090598f, 0.756990433f},
-std::array<float,2>{0.990490913f, 0.214656472f},
-std::array<float,2>{0.465435207f, 0.875449657f},
-std::array<float,2>{0.0079667205f, 0.456205964f},
-std::array<float,2>{0.718157649f, 0.687015533f},
-std::array<float,2>{0.893781781f, 0.379707456f},
-std::array<float,2>{0.398014307f, 0.714302003f},
-std::array<float,2>{0.10994786f, 0.166644379f},
-std::array<float,2>{0.654183984f, 0.950744629f},
-std::array<float,2>{0.584447026f, 0.0820492357f},
-std::array<float,2>{0.201979816f, 0.872829676f},
-std::array<float,2>{0.364436537f, 0.28093785f},
-std::array<float,2>{0.819764555f, 0.588605046f},
-std::array<float,2>{0.706201077f, 0.316124916f},
-std::array<float,2>{0.00674287649f, 0.556391239f},
-std::array<float,2>{0.45898059f, 0.0408087894f},
-std::array<float,2>{0.99780792f, 0.803604007f},
-std::array<float,2>{0.809267282f, 0.245125428f},
-std::array<float,2>{0.274069458f, 0.930974185f},
-std::array<float,2>{0.159368053f, 0.469668239f},
-std::array<float,2>{0.54426527f, 0.652444065f},
-std::array<float,2>{0.859142125f, 0.305250049f},
-std::array<float,2>{0.333281279f, 0.599113166f},
-std::array<float,2>{0.245905384f, 0.120883204f},
-std::array<float,2>{0.602587223f, 0.832516491f},
-std::array<float,2>{0.673099995f, 0.125864014f},
-std::array<float,2>{0.079652749f, 0.972414017f},
-std::array<float,2>{0.424073577f, 0.422039807f},
-std::array<float,2>{0.917363584f, 0.743956268f},
-std::array<float,2>{0.530728817f, 0.467062205f},
-std::array<float,2>{0.136650085f, 0.67749685f},
-std::array<float,2>{0.290123761f, 0.208176121f},
-std::array<float,2>{0.774031341f, 0.889414191f},
-std::array<float,2>{0.967567444f, 0.000667404442f},
-std::array<float,2>{0.473235786f, 0.760515034f},
-std::array<float,2>{0.0545965396f, 0.363331825f},
-std::array<float,2>{0.742791772f, 0.508066118f},
-std::array<float,2>{0.980128229f, 0.355461448f},
-std::array<float,2>{0.444238901f, 0.516347587f},
-std::array<float,2>{0.026479613f, 0.0257810969f},
-std::array<float,2>{0.690162897f, 0.768583834f},
-std::array<float,2>{0.548912406f, 0.196347356f},
-std::array<float,2>{0.175827295f, 0.899321854f},
-std::array<float,2>{0.254489303f, 0.443744123f},
-std::array<float,2>{0.795460463f, 0.663627923f},
-std::array<float,2>{0.631608129f, 0.42014572f},
-std::array<float,2>{0.109274589f, 0.727415621f},
-std::array<float,2>{0.386767417f, 0.147619635f},
-std::array<float,2>{0.886623561f, 0.995228171f},
-std::array<float,2>{0.838354468f, 0.096214965f},
-std::array<float,2>{0.34541443f, 0.813980877f},
-std::array<float,2>{0.213530302f, 0.295557857f},
-std::array<float,2>{0.576071382f, 0.622954011f},
-std::array<float,2>{0.764450192f, 0.48858282f},
-std::array<float,2>{0.306589991f, 0.631061018f},
-std::array<float,2>{0.155707553f, 0.220208958f},
-std::array<float,2>{0.513755262f, 0.914985716f},
-std::array<float,2>{0.727618039f, 0.0481442362f},
-std::array<float,2>{0.0400514491f, 0.791177452f},
-std::array<float,2>{0.495019227f, 0.337360084f},
-std::array<float,2>{0.949889421f, 0.539296508f},
-std::array<float,2>{0.610357821f, 0.253454626f},
-std::array<float,2>{0.21898298f, 0.574630916f},
-std::array<float,2>{0.316706032f, 0.0734491944f},
-std::array<float,2>{0.870167375f, 0.85217756f},
-std::array<float,2>{0.92418015f, 0.1730012f},
-std::array<float,2>{0.413189262f, 0.964138687f},
-std::array<float,2>{0.0683263317f, 0.401358277f},
-std::array<float,2>{0.663099349f, 0.702259541f},
-std::array<float,2>{0.993326426f, 0.412061334f},
-std::array<float,2>{0.456550121f, 0.724418044f},
-std::array<float,2>{0.00384447956f, 0.150286317f},
-std::array<float,2>{0.707784235f, 0.986697257f},
-std::array<float,2>{0.542385995f, 0.103489906f},
-std::array<float,2>{0.162286356f, 0.825040221f},
-std::array<float,2>{0.281177729f, 0.287657589f},
-std::array<float,2>{0.807649255f, 0.610365987f},
-std::array<float,2>{0.650746644f, 0.344256878f},
-std::array<float,2>{0.11453139f, 0.527164936f},
-std::array<float,2>{0.391263455f, 0.0161639247f},
-std::array<float,2>{0.895813525f, 0.780739725f},
-std::array<float,2>{0.812763572f, 0.191311583f},
-std::array<float,2>{0.359700084f, 0.892578959f},
-std::array<float,2>{0.197172672f, 0.448299348f},
-std::array<float,2>{0.578922927f, 0.666996658f},
-std::array<float,2>{0.780864596f, 0.259236872f},
-std::array<float,2>{0.296121597f, 0.566802144f},
-std::array<float,2>{0.139809683f, 0.0645744726f},
-std::array<float,2>{0.526832521f, 0.843900681f},
-std::array<float,2>{0.749047935f, 0.186448589f},
-std::array<float,2>{0.0484343804f, 0.953801215f},
-std::array<float,2>{0.472137094f, 0.391931981f},
-std::array<float,2>{0.963433325f, 0.69003129f},
-std::array<float,2>{0.608690739f, 0.492509067f},
-std::array<float,2>{0.249601498f, 0.635824442f},
-std::array<float,2>{0.330856025f, 0.230006948f},
-std::array<float,2>{0.853270411f, 0.907647729f},
-std::array<float,2>{0.921093404f, 0.0563839972f},
-std::array<float,2>{0.427493632f, 0.78559494f},
-std::array<float,2>{0.0843812525f, 0.333041131f},
-std::array<float,2>{0.67599982f, 0.536320627f},
-std::array<float,2>{0.888507426f, 0.322338194f},
-std::array<float,2>{0.385952204f, 0.553083658f},
-std::array<float,2>{0.104340732f, 0.0353368707f},
-std::array<float,2>{0.625554085f, 0.808445096f},
-std::array<float,2>{0.57177943f, 0.238666624f},
-std::array<float,2>{0.214920178f, 0.926385701f},
-std::array<float,2>{0.348902225f, 0.483433962f},
-std::array<float,2>{0.840230107f, 0.641658843f},
-std::array<float,2>{0.693619609f, 0.387448549f},
-std::array<float,2>{0.0302325953f, 0.708850205f},
-std::array<float,2>{0.441174448f, 0.162412569f},
-std::array<float,2>{0.981958747f, 0.943883538f},
-std::array<float,2>{0.791747153f, 0.0880743042f},
-std::array<float,2>{0.253438532f, 0.862559855f},
-std::array<float,2>{0.172329083f, 0.265873998f},
-std::array<float,2>{0.553863883f, 0.585185945f},
-std::array<float,2>{0.871448934f, 0.459495604f},
-std::array<float,2>{0.315904498f, 0.683564067f},
-std::array<float,2>{0.224252269f, 0.217883244f},
-std::array<float,2>{0.615660191f, 0.879008472f},
-std::array<float,2>{0.658553958f, 0.00983390305f},
-std::array<float,2>{0.0649203658f, 0.750371993f},
-std::array<float,2>{0.407311112f, 0.374844551f},
-std::array<float,2>{0.927210569f, 0.50084281f},
-std::array<float,2>{0.510084689f, 0.302707225f},
-std::array<float,2>{0.149596065f, 0.607561409f},
-std::array<float,2>{0.311866611f, 0.117141023f},
-std::array<float,2>{0.760617256f, 0.842072904f},
-std::array<float,2>{0.945844591f, 0.133383527f},
-std::array<float,2>{0.499853045f, 0.982233167f},
-std::array<float,2>{0.0433125049f, 0.4330993f},
-std::array<float,2>{0.731273651f, 0.734469175f},
-std::array<float,2>{0.935654283f, 0.47486797f},
-std::array<float,2>{0.414649308f, 0.648724139f},
-std::array<float,2>{0.0733614117f, 0.247859895f},
-std::array<float,2>{0.667535126f, 0.936666965f},
-std::array<float,2>{0.619668186f, 0.0462903343f},
-std::array<float,2>{0.229728997f, 0.798805416f},
-std::array<float,2>{0.320744157f, 0.320301175f},
-std::array<float,2>{0.860829532f, 0.561944902f},
-std::array<float,2>{0.726407468f, 0.273531556f},
-std::array<float,2>{0.038187854f, 0.593003452f},
-std::array<float,2>{0.489838749f, 0.0797239095f},
-std::array<float,2>{0.945091665f, 0.867911279f},
-std::array<float,2>{0.753103912f, 0.170289919f},
-std::array<float,2>{0.301786005f, 0.946073174f},
-std::array<float,2>{0.147319824f, 0.37787798f},
-std::array<float,2>{0.500134647f, 0.718520761f},
-std::array<float,2>{0.832741737f, 0.360172987f},
-std::array<float,2>{0.35633719f, 0.51192224f},
-std::array<float,2>{0.203268126f, 0.0065950104f},
-std::array<float,2>{0.564007342f, 0.765408754f},
-std::array<float,2>{0.635736108f, 0.2056427f},
-std::array<float,2>{0.100521512f, 0.882840455f},
-std::array<float,2>{0.381964594f, 0.46191746f},
-std::array<float,2>{0.88147074f, 0.672780335f},
-std::array<float,2>{0.556493938f, 0.428356647f},
-std::array<float,2>{0.182183042f, 0.747763932f},
-std::array<float,2>{0.264509887f, 0.132602543f},
-std::array<float,2>{0.78732872f, 0.974358857f},
-std::array<float,2>{0.974805772f, 0.123208582f},
-std::array<float,2>{0.451232165f, 0.829852283f},
-std::array<float,2>{0.0172742233f, 0.31037575f},
-std::array<float,2>{0.701023936f, 0.596953809f},
-std::array<float,2>{0.954338372f, 0.292082876f},
-std::array<float,2>{0.481118411f, 0.617857277f},
-std::array<float,2>{0.0600775182f, 0.10011144f},
-std::array<float,2>{0.734806716f, 0.817073762f},
-std::array<float,2>{0.521130919f, 0.141005233f},
-std::array<float,2>{0.12854144f, 0.99743706f},
-std::array<float,2>{0.282586277f, 0.417389721f},
-std::array<float,2>{0.768011272f, 0.733190954f},
-std::array<float,2>{0.686544061f, 0.438221663f},
-std::array<float,2>{0.0892410055f, 0.659838676f},
-std::array<float,2>{0.42980665f, 0.202280492f},
-std::array<float,2>{0.91201067f, 0.903696835f},
-std::array<float,2>{0.848715603f, 0.0278048906f},
-std::array<float,2>{0.336173862f, 0.770457149f},
-std::array<float,2>{0.234765917f, 0.359243691f},
-std::array<float,2>{0.595288754f, 0.520187497f},
-std::array<float,2>{0.800299287f, 0.40592882f},
-std::array<float,2>{0.267570585f, 0.697908998f},
-std::array<float,2>{0.169242218f, 0.176903874f},
-std::array<float,2>{0.53221482f, 0.968675435f},
-std::array<float,2>{0.713032007f, 0.0776813328f},
-std::array<float,2>{0.0146770887f, 0.858451545f},
-std::array<float,2>{0.463782877f, 0.255361855f},
-std::array<float,2>{0.985151827f, 0.570816159f},
-std::array<float,2>{0.589377105f, 0.342879772f},
-std::array<float,2>{0.190939426f, 0.546827316f},
-std::array<float,2>{0.373852968f, 0.0523222461f},
-std::array<float,2>{0.820807576f, 0.796800256f},
-std::array<float,2>{0.902249813f, 0.223326832f},
-std::array<float,2>{0.403221637f, 0.919792891f},
-std::array<float,2>{0.117404059f, 0.486367315f},
-std::array<float,2>{0.644247472f, 0.626943886f},
-std::array<float,2>{0.989275634f, 0.455879718f},
-std::array<float,2>{0.467331797f, 0.685667932f},
-std::array<float,2>{0.0107739754f, 0.213327378f},
-std::array<float,2>{0.716355801f, 0.876366496f},
-std::array<float,2>{0.537561595f, 0.0127850026f},
-std::array<float,2>{0.164813638f, 0.756676853f},
-std::array<float,2>{0.271788865f, 0.369826168f},
-std::array<float,2>{0.803709388f, 0.507240415f},
-std::array<float,2>{0.645299017f, 0.29842183f},
-std::array<float,2>{0.121404618f, 0.603438556f},
-std::array<float,2>{0.402282774f, 0.112669177f},
-std::array<float,2>{0.903351188f, 0.837318718f},
-std::array<float,2>{0.825578392f, 0.136754662f},
-std::array<float,2>{0.368527919f, 0.980386734f},
-std::array<float,2>{0.194725126f, 0.436906964f},
-std::array<float,2>{0.593671262f, 0.739330471f},
-std::array<float,2>{0.771465003f, 0.325713515f},
-std::array<float,2>{0.286084592f, 0.550429881f},
-std::array<float,2>{0.130718812f, 0.0316763073f},
-std::array<float,2>{0.516263306f, 0.809927642f},
-std::array<float,2>{0.738514781f, 0.236874431f},
-std::array<float,2>{0.0566627309f, 0.923791766f},
-std::array<float,2>{0.479895055f, 0.477670819f},
-std::array<float,2>{0.957856297f, 0.644563735f},
-std::array<float,2>{0.600580454f, 0.384935409f},
-std::array<float,2>{0.241284683f, 0.704976857f},
-std::array<float,2>{0.341181219f, 0.156330094f},
-std::array<float,2>{0.845284581f, 0.937548637f},
-std::array<float,2>{0.908179462f, 0.0926626027f},
-std::array<float,2>{0.43623358f, 0.865175366f},
-std::array<float,2>{0.0899872929f, 0.270224512f},
-std::array<float,2>{0.679908812f, 0.581375539f},
-std::array<float,2>{0.876020789f, 0.26247412f},
-std::array<float,2>{0.375773102f, 0.566270947f},
-std::array<float,2>{0.0941544548f, 0.0694542751f},
-std::array<float,2>{0.638824105f, 0.850554049f},
-std::array<float,2>{0.568726122f, 0.179839149f},
-std::array<float,2>{0.209662199f, 0.959722519f},
-std::array<float,2>{0.351967365f, 0.397779405f},
-std::array<float,2>{0.832013667f, 0.694406807f},
-std::array<float,2>{0.696814835f, 0.499480963f},
-std::array<float,2>{0.0199556407f, 0.640038311f},
-std::array<float,2>{0.446161509f, 0.233057961f},
-std::array<float,2>{0.971806765f, 0.912884355f},
-std::array<float,2>{0.782003343f, 0.0619705431f},
-std::array<float,2>{0.260799974f, 0.781973243f},
-std::array<float,2>{0.185754776f, 0.329634279f},
-std::array<float,2>{0.558757722f, 0.535149872f},
-std::array<float,2>{0.863348365f, 0.409401327f},
-std::array<float,2>{0.326426774f, 0.720485747f},
-std::array<float,2>{0.230847359f, 0.155803353f},
-std::array<float,2>{0.62259537f, 0.991961777f},
-std::array<float,2>{0.668912292f, 0.108782738f},
-std::array<float,2>{0.0746772289f, 0.822567582f},
-std::array<float,2>{0.420601368f, 0.283022016f},
-std::array<float,2>{0.93167603f, 0.613457084f},
-std::array<float,2>{0.506400943f, 0.349691689f},
-std::array<float,2>{0.141132772f, 0.530751407f},
-std::array<float,2>{0.296944231f, 0.0229121745f},
-std::array<float,2>{0.755357027f, 0.777270138f},
-std::array<float,2>{0.938477635f, 0.195084035f},
-std::array<float,2>{0.484626621f, 0.89803791f},
-std::array<float,2>{0.0318496674f, 0.450450599f},
-std::array<float,2>{0.720440984f, 0.669912636f},
-std::array<float,2>{0.923495471f, 0.401659846f},
-std::array<float,2>{0.411915779f, 0.701643646f},
-std::array<float,2>{0.0686371326f, 0.172144696f},
-std::array<float,2>{0.660547793f, 0.963295639f},
-std::array<float,2>{0.611795425f, 0.0723340288f},
-std::array<float,2>{0.221461996f, 0.85336113f},
-std::array<float,2>{0.318423271f, 0.252892166f},
-std::array<float,2>{0.867463648f, 0.575960159f},
-std::array<float,2>{0.729607403f, 0.336766869f},
-std::array<float,2>{0.0417069532f, 0.540602267f},
-std::array<float,2>{0.492226481f, 0.0473184846f},
-std::array<float,2>{0.952342451f, 0.7924124f},
-std::array<float,2>{0.763591826f, 0.219283223f},
-std::array<float,2>{0.306929171f, 0.915156662f},
-std::array<float,2>{0.152725786f, 0.489347607f},
-std::array<float,2>{0.51174283f, 0.63218987f},
-std::array<float,2>{0.836560011f, 0.296729296f},
-std::array<float,2>{0.346378624f, 0.622002363f},
-std::array<float,2>{0.212486744f, 0.0968043655f},
-std::array<float,2>{0.577301145f, 0.813137293f},
-std::array<float,2>{0.629227102f, 0.146649003f},
-std::array<float,2>{0.106549472f, 0.994581401f},
-std::array<float,2>{0.390250236f, 0.421840638f},
-std::array<float,2>{0.883667827f, 0.727816701f},
-std::array<float,2>{0.547707438f, 0.444795907f},
-std::array<float,2>{0.179659948f, 0.66295433f},
-std::array<float,2>{0.256876588f, 0.195774212f},
-std::array<float,2>{0.793459654f, 0.900138855f},
-std::array<float,2>{0.976800859f, 0.0263910014f},
-std::array<float,2>{0.442486376f, 0.768218696f},
-std::array<float,2>{0.0234861802f, 0.354192734f},
-std::array<float,2>{0.687992454f, 0.516978323f},
-std::array<float,2>{0.965372801f, 0.364670336f},
-std::array<float,2>{0.475051939f, 0.509742618f},
-std::array<float,2>{0.0522469543f, 0.00151194981f},
-std::array<float,2>{0.746022522f, 0.761240244f},
-std::array<float,2>{0.528499007f, 0.207552806f},
-std::array<float,2>{0.132846832f, 0.890250623f},
-std::array<float,2>{0.291449457f, 0.467957556f},
-std::array<float,2>{0.775944829f, 0.676300526f},
-std::array<float,2>{0.675331295f, 0.423720777f},
-std::array<float,2>{0.0806854591f, 0.742416322f},
-std::array<float,2>{0.42324242f, 0.126321077f},
-std::array<float,2>{0.915783525f, 0.97110945f},
-std::array<float,2>{0.855776727f, 0.119171612f},
-std::array<float,2>{0.335324377f, 0.833225548f},
-std::array<float,2>{0.243737817f, 0.305720627f},
-std::array<float,2>{0.60543257f, 0.597943127f},
-std::array<float,2>{0.81141305f, 0.469953954f},
-std::array<float,2>{0.277070791f, 0.65378511f},
-std::array<float,2>{0.156365111f, 0.244453222f},
-std::array<float,2>{0.546822608f, 0.930363476f},
-std::array<float,2>{0.704054534f, 0.0398227461f},
-std::array<float,2>{0.00450559752f, 0.804349065f},
-std::array<float,2>{0.460204303f, 0.315314949f},
-std::array<float,2>{0.998405814f, 0.555612266f},
-std::array<float,2>{0.582675874f, 0.279409528f},
-std::array<float,2>{0.199556261f, 0.589346051f},
-std::array<float,2>{0.36712113f, 0.0833145157f},
-std::array<float,2>{0.817240536f, 0.872056186f},
-std::array<float,2>{0.890667975f, 0.167380705f},
-std::array<float,2>{0.396155447f, 0.94995147f},
-std::array<float,2>{0.112203173f, 0.380298406f},
-std::array<float,2>{0.654885292f, 0.713561356f},
-std::array<float,2>{0.9487499f, 0.432557285f},
-std::array<float,2>{0.497512013f, 0.735479951f},
-std::array<float,2>{0.0467170998f, 0.134634465f},
-std::array<float,2>{0.733755708f, 0.98139745f},
-std::array<float,2>{0.508619368f, 0.115313664f},
-std::array<float,2>{0.150588676f, 0.843277276f},
-std::array<float,2>{0.309752077f, 0.301173091f},
-std::array<float,2>{0.758835375f, 0.609068155f},
-std::array<float,2>{0.657742441f, 0.373888135f},
-std::array<float,2>{0.0629301667f, 0.501813471f},
-std::array<float,2>{0.410122216f, 0.011462789f},
-std::array<float,2>{0.929381311f, 0.751447856f},
-std::array<float,2>{0.873132348f, 0.216998935f},
-std::array<float,2>{0.313090116f, 0.880381107f},
-std::array<float,2>{0.226424083f, 0.460529178f},
-std::array<float,2>{0.614871025f, 0.682514489f},
-std::array<float,2>{0.789527655f, 0.267493069f},
-std::array<float,2>{0.250721753f, 0.584545851f},
-std::array<float,2>{0.173966557f, 0.0895360634f},
-std::array<float,2>{0.551045775f, 0.861584544f},
-std::array<float,2>{0.692083359f, 0.163149431f},
-std::array<float,2>{0.0289687775f, 0.944849968f},
-std::array<float,2>{0.438351452f, 0.388177961f},
-std::array<float,2>{0.983030498f, 0.707864285f},
-std::array<float,2>{0.572967589f, 0.482818842f},
-std::array<float,2>{0.217331991f, 0.64098382f},
-std::array<float,2>{0.35096094f, 0.240069926f},
-std::array<float,2>{0.843445539f, 0.927324116f},
-std::array<float,2>{0.889746964f, 0.0369041413f},
-std::array<float,2>{0.383677632f, 0.806975365f},
-std::array<float,2>{0.102853529f, 0.323566377f},
-std::array<float,2>{0.627826989f, 0.554434597f},
-std::array<float,2>{0.919858098f, 0.332679361f},
-std::array<float,2>{0.429268181f, 0.535422802f},
-std::array<float,2>{0.0837536827f, 0.0552900396f},
-std::array<float,2>{0.679347754f, 0.786427855f},
-std::array<float,2>{0.606341898f, 0.229407638f},
-std::array<float,2>{0.246690452f, 0.907143593f},
-std::array<float,2>{0.329302788f, 0.49387762f},
-std::array<float,2>{0.855120063f, 0.63567245f},
-std::array<float,2>{0.746822238f, 0.391498566f},
-std::array<float,2>{0.0505754538f, 0.69125843f},
-std::array<float,2>{0.469070911f, 0.186538026f},
-std::array<float,2>{0.961636126f, 0.954207778f},
-std::array<float,2>{0.779234171f, 0.0661212206f},
-std::array<float,2>{0.294310838f, 0.845582962f},
-std::array<float,2>{0.137421846f, 0.258609116f},
-std::array<float,2>{0.524031401f, 0.568095028f},
-std::array<float,2>{0.814651191f, 0.447844893f},
-std::array<float,2>{0.362038016f, 0.666050673f},
-std::array<float,2>{0.198042735f, 0.190051883f},
-std::array<float,2>{0.58018899f, 0.894379735f},
-std::array<float,2>{0.648717284f, 0.0167493783f},
-std::array<float,2>{0.11618527f, 0.780188978f},
-std::array<float,2>{0.394229919f, 0.344756007f},
-std::array<float,2>{0.896804512f, 0.525959313f},
-std::array<float,2>{0.540009379f, 0.288945198f},
-std::array<float,2>{0.160701156f, 0.609767675f},
-std::array<float,2>{0.279186487f, 0.101968117f},
-std::array<float,2>{0.806333661f, 0.825570583f},
-std::array<float,2>{0.994356692f, 0.149146736f},
-std::array<float,2>{0.454624206f, 0.987554431f},
-std::array<float,2>{0.00167693628f, 0.411114037f},
-std::array<float,2>{0.709404945f, 0.722757638f},
-std::array<float,2>{0.899185956f, 0.487662315f},
-std::array<float,2>{0.405977249f, 0.625618637f},
-std::array<float,2>{0.120673701f, 0.224140033f},
-std::array<float,2>{0.641698956f, 0.918407381f},
-std::array<float,2>{0.586104274f, 0.050837107f},
-std::array<float,2>{0.188283712f, 0.795401752f},
-std::array<float,2>{0.371643782f, 0.341994077f},
-std::array<float,2>{0.822526515f, 0.545894742f},
-std::array<float,2>{0.711720228f, 0.254244477f},
-std::array<float,2>{0.0135422526f, 0.572234333f},
-std::array<float,2>{0.462501884f, 0.076451838f},
-std::array<float,2>{0.988243163f, 0.857854843f},
-std::array<float,2>{0.798055828f, 0.176412225f},
-std::array<float,2>{0.268333912f, 0.967765689f},
-std::array<float,2>{0.171278924f, 0.404370993f},
-std::array<float,2>{0.535132945f, 0.69838047f},
-std::array<float,2>{0.849951029f, 0.357732981f},
-std::array<float,2>{0.338465065f, 0.520770013f},
-std::array<float,2>{0.2381832f, 0.0289854314f},
-std::array<float,2>{0.597061932f, 0.770761192f},
-std::array<float,2>{0.684287906f, 0.201276571f},
-std::array<float,2>{0.087491259f, 0.902580857f},
-std::array<float,2>{0.432890356f, 0.438823462f},
-std::array<float,2>{0.913899064f, 0.658432961f},
-std::array<float,2>{0.522516668f, 0.416439384f},
-std::array<float,2>{0.125572503f, 0.733665347f},
-std::array<float,2>{0.285093546f, 0.14193435f},
-std::array<float,2>{0.76600945f, 0.996908903f},
-std::array<float,2>{0.955630898f, 0.101242356f},
-std::array<float,2>{0.482642382f, 0.81757158f},
-std::array<float,2>{0.0609534159f, 0.2919285f},
-std::array<float,2>{0.737372637f, 0.618320227f},
-std::array<float,2>{0.974592805f, 0.309438974f},
-std::array<float,2>{0.449864507f, 0.596185684f},
-std::array<float,2>{0.0184755493f, 0.124920905f},
-std::array<float,2>{0.701955438f, 0.828255415f},
-std::array<float,2>{0.557603002f, 0.13126938f},
-std::array<float,2>{0.181072295f, 0.9735533f},
-std::array<float,2>{0.262639612f, 0.429184884f},
-std::array<float,2>{0.785720289f, 0.747034788f},
-std::array<float,2>{0.634286523f, 0.461515456f},
-std::array<float,2>{0.0991113931f, 0.673376918f},
-std::array<float,2>{0.37965855f, 0.206912234f},
-std::array<float,2>{0.879995525f, 0.884400964f},
-std::array<float,2>{0.835318267f, 0.00753381336f},
-std::array<float,2>{0.359123766f, 0.764193773f},
-std::array<float,2>{0.205396429f, 0.361306101f},
-std::array<float,2>{0.564809203f, 0.51352936f},
-std::array<float,2>{0.750382483f, 0.37852329f},
-std::array<float,2>{0.304125935f, 0.717712522f},
-std::array<float,2>{0.144735411f, 0.170934737f},
-std::array<float,2>{0.503902614f, 0.946811259f},
-std::array<float,2>{0.724341393f, 0.0782864764f},
-std::array<float,2>{0.0368718468f, 0.868458033f},
-std::array<float,2>{0.492011517f, 0.27451843f},
-std::array<float,2>{0.942784131f, 0.592387676f},
-std::array<float,2>{0.618419886f, 0.319009721f},
-std::array<float,2>{0.227268606f, 0.561399221f},
-std::array<float,2>{0.323763281f, 0.0455889888f},
-std::array<float,2>{0.862739027f, 0.79696399f},
-std::array<float,2>{0.933925152f, 0.24638854f},
-std::array<float,2>{0.417160243f, 0.935708046f},
-std::array<float,2>{0.0705218688f, 0.475646973f},
-std::array<float,2>{0.665532649f, 0.649453878f},
-std::array<float,2>{0.95940882f, 0.480232507f},
-std::array<float,2>{0.477608323f, 0.647422075f},
-std::array<float,2>{0.0548787042f, 0.236256227f},
-std::array<float,2>{0.741583765f, 0.924144626f},
-std::array<float,2>{0.518043995f, 0.0341498032f},
-std::array<float,2>{0.131696135f, 0.810769439f},
-std::array<float,2>{0.288134813f, 0.327831894f},
-std::array<float,2>{0.772962809f, 0.547715604f},
-std::array<float,2>{0.683303654f, 0.271579266f},
-std::array<float,2>{0.0929809809f, 0.578283489f},
-std::array<float,2>{0.434865773f, 0.0899003744f},
-std::array<float,2>{0.908245504f, 0.865296721f},
-std::array<float,2>{0.846886575f, 0.158357859f},
-std::array<float,2>{0.342580587f, 0.940750718f},
-std::array<float,2>{0.238715813f, 0.384285659f},
-std::array<float,2>{0.597774684f, 0.706646919f},
-std::array<float,2>{0.802125275f, 0.368013084f},
-std::array<float,2>{0.269807905f, 0.504031301f},
-std::array<float,2>{0.167366296f, 0.0143732354f},
-std::array<float,2>{0.535289705f, 0.755711734f},
-std::array<float,2>{0.717320621f, 0.211611122f},
-std::array<float,2>{0.00964968279f, 0.878382564f},
-std::array<float,2>{0.466177613f, 0.454332829f},
-std::array<float,2>{0.99179709f, 0.684844434f},
-std::array<float,2>{0.591273069f, 0.435526222f},
-std::array<float,2>{0.191491246f, 0.741879582f},
-std::array<float,2>{0.371043116f, 0.139934599f},
-std::array<float,2>{0.827340722f, 0.977271676f},
-std::array<float,2>{0.904994905f, 0.110968895f},
-std::array<float,2>{0.399630964f, 0.839198947f},
-std::array<float,2>{0.123946682f, 0.300043225f},
-std::array<float,2>{0.647532463f, 0.605083346f},
-std::array<float,2>{0.930516303f, 0.283343226f},
-std::array<float,2>{0.419764876f, 0.615794003f},
-std::array<float,2>{0.0768053681f, 0.106749624f},
-std::array<float,2>{0.670047283f, 0.821863949f},
-std::array<float,2>{0.624651015f, 0.153839007f},
-std::array<float,2>{0.233424693f, 0.989614666f},
-std::array<float,2>{0.325904697f, 0.406478554f},
-std::array<float,2>{0.86637038f, 0.721091151f},
-std::array<float,2>{0.72097075f, 0.451624691f},
-std::array<float,2>{0.0332948342f, 0.670631886f},
-std::array<float,2>{0.48745504f, 0.192872956f},
-std::array<float,2>{0.940745533f, 0.894646049f},
-std::array<float,2>{0.755883157f, 0.0213885307f},
-std::array<float,2>{0.300140321f, 0.773881555f},
-std::array<float,2>{0.14378117f, 0.347906381f},
-std::array<float,2>{0.505619287f, 0.529149055f},
-std::array<float,2>{0.828727424f, 0.396091223f},
-std::array<float,2>{0.353974015f, 0.692209005f},
-std::array<float,2>{0.207199082f, 0.182245791f},
-std::array<float,2>{0.566572189f, 0.957790792f},
-std::array<float,2>{0.638670087f, 0.0679353699f},
-std::array<float,2>{0.0972749069f, 0.849257946f},
-std::array<float,2>{0.378315091f, 0.265155494f},
-std::array<float,2>{0.877800524f, 0.563660562f},
-std::array<float,2>{0.562294662f, 0.331481844f},
-std::array<float,2>{0.184230432f, 0.531346142f},
-std::array<float,2>{0.258962274f, 0.0603478178f},
-std::array<float,2>{0.784485877f, 0.784123182f},
-std::array<float,2>{0.969736099f, 0.231615469f},
-std::array<float,2>{0.447635859f, 0.910942852f},
-std::array<float,2>{0.0230987668f, 0.497792333f},
-std::array<float,2>{0.698038459f, 0.637022972f},
-std::array<float,2>{0.885041475f, 0.419687003f},
-std::array<float,2>{0.3885566f, 0.73002249f},
-std::array<float,2>{0.107695118f, 0.145111829f},
-std::array<float,2>{0.63195008f, 0.992980003f},
-std::array<float,2>{0.574525714f, 0.0954709128f},
-std::array<float,2>{0.214712292f, 0.815589428f},
-std::array<float,2>{0.344310969f, 0.294524729f},
-std::array<float,2>{0.839696705f, 0.624097645f},
-std::array<float,2>{0.690577149f, 0.352903485f},
-std::array<float,2>{0.025963081f, 0.518618286f},
-std::array<float,2>{0.444957793f, 0.0235676896f},
-std::array<float,2>{0.979430974f, 0.765766382f},
-std::array<float,2>{0.796386123f, 0.19802098f},
-std::array<float,2>{0.255725056f, 0.900664091f},
-std::array<float,2>{0.177388161f, 0.442524493f},
-std::array<float,2>{0.550744414f, 0.660902262f},
-std::array<float,2>{0.869485021f, 0.250387758f},
-std::array<float,2>{0.318036854f, 0.578086972f},
-std::array<float,2>{0.219899654f, 0.0703950077f},
-std::array<float,2>{0.609429598f, 0.853738666f},
-std::array<float,2>{0.662367642f, 0.175576746f},
-std::array<float,2>{0.0669549629f, 0.96264267f},
-std::array<float,2>{0.413015842f, 0.399985164f},
-std::array<float,2>{0.925346851f, 0.700456321f},
-std::array<float,2>{0.515182137f, 0.490628511f},
-std::array<float,2>{0.154881299f, 0.629946709f},
-std::array<float,2>{0.30487147f, 0.222513676f},
-std::array<float,2>{0.765324712f, 0.916557193f},
-std::array<float,2>{0.950539589f, 0.0492259823f},
-std::array<float,2>{0.495365202f, 0.789484024f},
-std::array<float,2>{0.0392953753f, 0.339035422f},
-std::array<float,2>{0.727162242f, 0.54171598f},
-std::array<float,2>{0.996426344f, 0.31255886f},
-std::array<float,2>{0.457112432f, 0.55701834f},
-std::array<float,2>{0.00735629164f, 0.0415642299f},
-std::array<float,2>{0.705809593f, 0.802000523f},
-std::array<float,2>{0.543866694f, 0.24363552f},
-std::array<float,2>{0.158213645f, 0.932645679f},
-std::array<float,2>{0.275171906f, 0.471656621f},
-std::array<float,2>{0.809923053f, 0.655727744f},
-std::array<float,2>{0.652489543f, 0.381576389f},
-std::array<float,2>{0.110900939f, 0.711235881f},
-std::array<float,2>{0.39654842f, 0.16445297f},
-std::array<float,2>{0.892664552f, 0.952537f},
-std::array<float,2>{0.819229364f, 0.0856059864f},
-std::array<float,2>{0.363746792f, 0.874732494f},
-std::array<float,2>{0.20236209f, 0.277982056f},
-std::array<float,2>{0.585131526f, 0.586507022f},
-std::array<float,2>{0.775375903f, 0.466384947f},
-std::array<float,2>{0.289766788f, 0.678328037f},
-std::array<float,2>{0.135483682f, 0.208996817f},
-std::array<float,2>{0.529395223f, 0.887142479f},
-std::array<float,2>{0.74376756f, 0.00277521415f},
-std::array<float,2>{0.0529364534f, 0.758820176f},
-std::array<float,2>{0.473721504f, 0.366675735f},
-std::array<float,2>{0.96803087f, 0.510778368f},
-std::array<float,2>{0.602286398f, 0.306747079f},
-std::array<float,2>{0.24458158f, 0.60098511f},
-std::array<float,2>{0.332401752f, 0.11907015f},
-std::array<float,2>{0.858110666f, 0.835394919f},
-std::array<float,2>{0.916163325f, 0.127633646f},
-std::array<float,2>{0.425695598f, 0.969565392f},
-std::array<float,2>{0.078927964f, 0.425396144f},
-std::array<float,2>{0.671971381f, 0.745362401f},
-std::array<float,2>{0.981053948f, 0.389503241f},
-std::array<float,2>{0.43948698f, 0.710655868f},
-std::array<float,2>{0.0308079422f, 0.160566002f},
-std::array<float,2>{0.694432437f, 0.942520022f},
-std::array<float,2>{0.55366081f, 0.0860972479f},
-std::array<float,2>{0.173299521f, 0.859752357f},
-std::array<float,2>{0.252720296f, 0.268728614f},
-std::array<float,2>{0.792140484f, 0.582792878f},
-std::array<float,2>{0.626430988f, 0.321995527f},
-std::array<float,2>{0.105090387f, 0.551924109f},
-std::array<float,2>{0.385056973f, 0.0376650542f},
-std::array<float,2>{0.88695699f, 0.806637526f},
-std::array<float,2>{0.841422379f, 0.240521863f},
-std::array<float,2>{0.348182589f, 0.928298593f},
-std::array<float,2>{0.216723695f, 0.481837958f},
-std::array<float,2>{0.571287572f, 0.643482625f},
-std::array<float,2>{0.760757208f, 0.303704202f},
-std::array<float,2>{0.310868323f, 0.607043862f},
-std::array<float,2>{0.148525119f, 0.113872468f},
-std::array<float,2>{0.510802925f, 0.839959562f},
-std::array<float,2>{0.731788754f, 0.13666451f},
-std::array<float,2>{0.0443208478f, 0.984023869f},
-std::array<float,2>{0.498715758f, 0.43095395f},
-std::array<float,2>{0.946559608f, 0.737761021f},
-std::array<float,2>{0.616858542f, 0.458250701f},
-std::array<float,2>{0.223616198f, 0.680288315f},
-std::array<float,2>{0.314678013f, 0.215197727f},
-std::array<float,2>{0.872624695f, 0.88110292f},
-std::array<float,2>{0.926634729f, 0.00898469426f},
-std::array<float,2>{0.406254858f, 0.753228009f},
-std::array<float,2>{0.0657527521f, 0.372921616f},
-std::array<float,2>{0.659332275f, 0.503546774f},
-std::array<float,2>{0.894680142f, 0.347214133f},
-std::array<float,2>{0.392197758f, 0.524928093f},
-std::array<float,2>{0.11409802f, 0.0186455064f},
-std::array<float,2>{0.652257681f, 0.778518081f},
-std::array<float,2>{0.579245925f, 0.189104915f},
-std::array<float,2>{0.195370376f, 0.89070642f},
-std::array<float,2>{0.360486805f, 0.447075814f},
-std::array<float,2>{0.813621223f, 0.665508926f},
-std::array<float,2>{0.708209217f, 0.412280589f},
-std::array<float,2>{0.00225815759f, 0.725824475f},
-std::array<float,2>{0.455837041f, 0.152230412f},
-std::array<float,2>{0.992647111f, 0.984557807f},
-std::array<float,2>{0.807182491f, 0.103756942f},
-std::array<float,2>{0.279658467f, 0.826908112f},
-std::array<float,2>{0.163223431f, 0.286780566f},
-std::array<float,2>{0.541195869f, 0.612112761f},
-std::array<float,2>{0.852393985f, 0.494418919f},
-std::array<float,2>{0.331953228f, 0.634739935f},
-std::array<float,2>{0.248770773f, 0.228443488f},
-std::array<float,2>{0.60830301f, 0.908283532f},
-std::array<float,2>{0.677452743f, 0.0569993295f},
-std::array<float,2>{0.0858579725f, 0.788243711f},
-std::array<float,2>{0.425929397f, 0.335633665f},
-std::array<float,2>{0.920414627f, 0.538053632f},
-std::array<float,2>{0.526064038f, 0.26081413f},
-std::array<float,2>{0.138751879f, 0.568692267f},
-std::array<float,2>{0.295852125f, 0.0642769486f},
-std::array<float,2>{0.77985388f, 0.845783591f},
-std::array<float,2>{0.964804292f, 0.184540942f},
-std::array<float,2>{0.471305788f, 0.955299079f},
-std::array<float,2>{0.0472554192f, 0.393443465f},
-std::array<float,2>{0.748396337f, 0.687812686f},
-std::array<float,2>{0.910367668f, 0.441085786f},
-std::array<float,2>{0.43126598f, 0.657565892f},
-std::array<float,2>{0.0885596201f, 0.199372783f},
-std::array<float,2>{0.686170697f, 0.905702651f},
-std::array<float,2>{0.594044209f, 0.0311348159f},
-std::array<float,2>{0.235674798f, 0.77303046f},
-std::array<float,2>{0.337025732f, 0.355701625f},
-std::array<float,2>{0.848254025f, 0.522023559f},
-std::array<float,2>{0.735734284f, 0.290809691f},
-std::array<float,2>{0.0589982457f, 0.620634019f},
-std::array<float,2>{0.482039988f, 0.098157756f},
-std::array<float,2>{0.953883886f, 0.818777144f},
-std::array<float,2>{0.768559217f, 0.143399268f},
-std::array<float,2>{0.281285465f, 0.998586953f},
-std::array<float,2>{0.127131552f, 0.41543892f},
-std::array<float,2>{0.519547462f, 0.732104897f},
-std::array<float,2>{0.821372807f, 0.341145635f},
-std::array<float,2>{0.374180615f, 0.544709265f},
-std::array<float,2>{0.189575657f, 0.0535133295f},
-std::array<float,2>{0.588276744f, 0.793179452f},
-std::array<float,2>{0.643188059f, 0.226114139f},
-std::array<float,2>{0.118262552f, 0.920177817f},
-std::array<float,2>{0.403926909f, 0.484696567f},
-std::array<float,2>{0.901307464f, 0.627977252f},
-std::array<float,2>{0.533124924f, 0.402738243f},
-std::array<float,2>{0.168139473f, 0.695384383f},
-std::array<float,2>{0.265739322f, 0.179168344f},
-std::array<float,2>{0.79924047f, 0.965026975f},
-std::array<float,2>{0.985926867f, 0.0744158253f},
-std::array<float,2>{0.463938922f, 0.855637908f},
-std::array<float,2>{0.014304121f, 0.256489575f},
-std::array<float,2>{0.714205027f, 0.57275641f},
-std::array<float,2>{0.944139183f, 0.277018428f},
-std::array<float,2>{0.48916164f, 0.591466248f},
-std::array<float,2>{0.03776614f, 0.0801058933f},
-std::array<float,2>{0.724851906f, 0.871059597f},
-std::array<float,2>{0.501243591f, 0.169779599f},
-std::array<float,2>{0.147908136f, 0.948081851f},
-std::array<float,2>{0.301577419f, 0.376263589f},
-std::array<float,2>{0.752300262f, 0.715887487f},
-std::array<float,2>{0.666985273f, 0.474239171f},
-std::array<float,2>{0.0723176599f, 0.651116729f},
-std::array<float,2>{0.415383726f, 0.248325825f},
-std::array<float,2>{0.937341988f, 0.934520066f},
-std::array<float,2>{0.859900534f, 0.0432626456f},
-std::array<float,2>{0.3218005f, 0.799629509f},
-std::array<float,2>{0.229022294f, 0.318032801f},
-std::array<float,2>{0.620898247f, 0.559630334f},
-std::array<float,2>{0.78826201f, 0.426306576f},
-std::array<float,2>{0.265173972f, 0.749105036f},
-std::array<float,2>{0.18352063f, 0.130660817f},
-std::array<float,2>{0.55496192f, 0.974620283f},
-std::array<float,2>{0.699721813f, 0.121314578f},
-std::array<float,2>{0.0159111712f, 0.83106631f},
-std::array<float,2>{0.453011334f, 0.311663568f},
-std::array<float,2>{0.975764394f, 0.594354391f},
-std::array<float,2>{0.562776744f, 0.363041848f},
-std::array<float,2>{0.204172283f, 0.514163852f},
-std::array<float,2>{0.357352823f, 0.00429755775f},
-std::array<float,2>{0.83306253f, 0.761838198f},
-std::array<float,2>{0.882189214f, 0.203494594f},
-std::array<float,2>{0.381542861f, 0.884907424f},
-std::array<float,2>{0.101323739f, 0.464207649f},
-std::array<float,2>{0.63621223f, 0.674082696f},
-std::array<float,2>{0.988031089f, 0.485811591f},
-std::array<float,2>{0.462756723f, 0.627345383f},
-std::array<float,2>{0.0132451905f, 0.22475554f},
-std::array<float,2>{0.711644948f, 0.920922279f},
-std::array<float,2>{0.534908414f, 0.0546532981f},
-std::array<float,2>{0.170926064f, 0.794575632f},
-std::array<float,2>{0.2680884f, 0.34055239f},
-std::array<float,2>{0.798308492f, 0.543554664f},
-std::array<float,2>{0.642064214f, 0.25750801f},
-std::array<float,2>{0.121076815f, 0.574077785f},
-std::array<float,2>{0.40601778f, 0.0757072791f},
-std::array<float,2>{0.898966134f, 0.857002676f},
-std::array<float,2>{0.822284341f, 0.178056985f},
-std::array<float,2>{0.371845126f, 0.966237307f},
-std::array<float,2>{0.188194752f, 0.403828204f},
-std::array<float,2>{0.586371422f, 0.696882665f},
-std::array<float,2>{0.76564467f, 0.356935531f},
-std::array<float,2>{0.284728259f, 0.522923648f},
-std::array<float,2>{0.125765547f, 0.0295395702f},
-std::array<float,2>{0.522844613f, 0.771504641f},
-std::array<float,2>{0.737643421f, 0.200773552f},
-std::array<float,2>{0.0605761483f, 0.905007005f},
-std::array<float,2>{0.482719809f, 0.440368712f},
-std::array<float,2>{0.955845416f, 0.656417251f},
-std::array<float,2>{0.596878231f, 0.414480984f},
-std::array<float,2>{0.238028988f, 0.731280267f},
-std::array<float,2>{0.338751465f, 0.144378826f},
-std::array<float,2>{0.849811196f, 0.999318421f},
-std::array<float,2>{0.913788438f, 0.0991991758f},
-std::array<float,2>{0.432807863f, 0.819996715f},
-std::array<float,2>{0.0877020359f, 0.289520562f},
-std::array<float,2>{0.684370399f, 0.619281769f},
-std::array<float,2>{0.880234241f, 0.311459005f},
-std::array<float,2>{0.379397929f, 0.595472455f},
-std::array<float,2>{0.0986818671f, 0.122393191f},
-std::array<float,2>{0.634753048f, 0.830124438f},
-std::array<float,2>{0.564585805f, 0.129592523f},
-std::array<float,2>{0.205252275f, 0.976370037f},
-std::array<float,2>{0.359168768f, 0.427126348f},
-std::array<float,2>{0.83503449f, 0.748287499f},
-std::array<float,2>{0.701790452f, 0.463677555f},
-std::array<float,2>{0.0182499401f, 0.675399899f},
-std::array<float,2>{0.450193673f, 0.205053881f},
-std::array<float,2>{0.974146843f, 0.886286557f},
-std::array<float,2>{0.786048114f, 0.00518920319f},
-std::array<float,2>{0.262346476f, 0.76311481f},
-std::array<float,2>{0.180873379f, 0.36167568f},
-std::array<float,2>{0.557174563f, 0.515087366f},
-std::array<float,2>{0.862544715f, 0.375660092f},
-std::array<float,2>{0.32413587f, 0.715650558f},
-std::array<float,2>{0.22746478f, 0.168097034f},
-std::array<float,2>{0.618226945f, 0.949142039f},
-std::array<float,2>{0.665908158f, 0.0812538415f},
-std::array<float,2>{0.070586279f, 0.87010175f},
-std::array<float,2>{0.417458415f, 0.27606827f},
-std::array<float,2>{0.933678627f, 0.590000153f},
-std::array<float,2>{0.503452837f, 0.31667009f},
-std::array<float,2>{0.14500545f, 0.558909893f},
-std::array<float,2>{0.303797364f, 0.044380866f},
-std::array<float,2>{0.750028551f, 0.80011344f},
-std::array<float,2>{0.942566931f, 0.249262884f},
-std::array<float,2>{0.491850197f, 0.934851348f},
-std::array<float,2>{0.0366595238f, 0.473023295f},
-std::array<float,2>{0.724424958f, 0.651433349f},
-std::array<float,2>{0.929638624f, 0.430461764f},
-std::array<float,2>{0.409710556f, 0.736763895f},
-std::array<float,2>{0.0625196025f, 0.135364935f},
-std::array<float,2>{0.658160806f, 0.98249501f},
-std::array<float,2>{0.61518842f, 0.11445643f},
-std::array<float,2>{0.226249501f, 0.841220319f},
-std::array<float,2>{0.313306808f, 0.304324895f},
-std::array<float,2>{0.87348932f, 0.606238544f},
-std::array<float,2>{0.733416021f, 0.371678799f},
-std::array<float,2>{0.0465647578f, 0.502130091f},
-std::array<float,2>{0.497091353f, 0.0082726134f},
-std::array<float,2>{0.949011981f, 0.752751827f},
-std::array<float,2>{0.759050369f, 0.216565073f},
-std::array<float,2>{0.310039788f, 0.882470012f},
-std::array<float,2>{0.150651634f, 0.457234472f},
-std::array<float,2>{0.508322179f, 0.680763781f},
-std::array<float,2>{0.843539178f, 0.268312722f},
-std::array<float,2>{0.350627393f, 0.583335698f},
-std::array<float,2>{0.217760369f, 0.0873794779f},
-std::array<float,2>{0.573203981f, 0.861148536f},
-std::array<float,2>{0.627541006f, 0.161303163f},
-std::array<float,2>{0.102677472f, 0.941836476f},
-std::array<float,2>{0.383359492f, 0.390479416f},
-std::array<float,2>{0.89006269f, 0.709262788f},
-std::array<float,2>{0.551004469f, 0.480891764f},
-std::array<float,2>{0.174118906f, 0.643647552f},
-std::array<float,2>{0.25092873f, 0.241927207f},
-std::array<float,2>{0.78918153f, 0.929636836f},
-std::array<float,2>{0.983338833f, 0.0385729782f},
-std::array<float,2>{0.438092142f, 0.804906845f},
-std::array<float,2>{0.0291648451f, 0.321155399f},
-std::array<float,2>{0.692159116f, 0.551037788f},
-std::array<float,2>{0.96186763f, 0.334224164f},
-std::array<float,2>{0.468780994f, 0.538573265f},
-std::array<float,2>{0.0504309684f, 0.0583321229f},
-std::array<float,2>{0.746903718f, 0.787316144f},
-std::array<float,2>{0.524319649f, 0.227113634f},
-std::array<float,2>{0.137472183f, 0.909392834f},
-std::array<float,2>{0.294031113f, 0.495315254f},
-std::array<float,2>{0.778962016f, 0.632832468f},
-std::array<float,2>{0.679659307f, 0.394083738f},
-std::array<float,2>{0.0836131349f, 0.68901068f},
-std::array<float,2>{0.429616839f, 0.184761822f},
-std::array<float,2>{0.9195081f, 0.957005858f},
-std::array<float,2>{0.855238199f, 0.0626563355f},
-std::array<float,2>{0.329408973f, 0.846813202f},
-std::array<float,2>{0.246846572f, 0.260182589f},
-std::array<float,2>{0.605963647f, 0.569929481f},
-std::array<float,2>{0.806474924f, 0.445718527f},
-std::array<float,2>{0.278835267f, 0.665008485f},
-std::array<float,2>{0.16105181f, 0.188420564f},
-std::array<float,2>{0.539741158f, 0.891775072f},
-std::array<float,2>{0.70915401f, 0.0182005093f},
-std::array<float,2>{0.0017701583f, 0.777515829f},
-std::array<float,2>{0.454993546f, 0.346285641f},
-std::array<float,2>{0.994405806f, 0.523609102f},
-std::array<float,2>{0.58034569f, 0.285344809f},
-std::array<float,2>{0.197838426f, 0.612349093f},
-std::array<float,2>{0.362299293f, 0.104730792f},
-std::array<float,2>{0.814713717f, 0.827358484f},
-std::array<float,2>{0.896581769f, 0.150714248f},
-std::array<float,2>{0.394508958f, 0.985659838f},
-std::array<float,2>{0.115793407f, 0.413104355f},
-std::array<float,2>{0.648477077f, 0.724717081f},
-std::array<float,2>{0.952454805f, 0.399162769f},
-std::array<float,2>{0.492482811f, 0.699545741f},
-std::array<float,2>{0.0419596955f, 0.174044773f},
-std::array<float,2>{0.729908586f, 0.961827755f},
-std::array<float,2>{0.511987388f, 0.0722392872f},
-std::array<float,2>{0.152355254f, 0.855204225f},
-std::array<float,2>{0.306677014f, 0.251909673f},
-std::array<float,2>{0.763246536f, 0.576310754f},
-std::array<float,2>{0.660185218f, 0.338572413f},
-std::array<float,2>{0.0683660284f, 0.542863011f},
-std::array<float,2>{0.411659092f, 0.0505797863f},
-std::array<float,2>{0.9237414f, 0.790190578f},
-std::array<float,2>{0.867199898f, 0.221041098f},
-std::array<float,2>{0.318669111f, 0.917087018f},
-std::array<float,2>{0.221391469f, 0.491530567f},
-std::array<float,2>{0.611548603f, 0.629623592f},
-std::array<float,2>{0.793822825f, 0.292986333f},
-std::array<float,2>{0.257211864f, 0.623227775f},
-std::array<float,2>{0.179260895f, 0.0946631283f},
-std::array<float,2>{0.547533512f, 0.815412998f},
-std::array<float,2>{0.688419998f, 0.146039814f},
-std::array<float,2>{0.0239094049f, 0.993363857f},
-std::array<float,2>{0.442767441f, 0.418855876f},
-std::array<float,2>{0.976903439f, 0.728530228f},
-std::array<float,2>{0.577464819f, 0.441673934f},
-std::array<float,2>{0.212822467f, 0.661388993f},
-std::array<float,2>{0.346541554f, 0.199193954f},
-std::array<float,2>{0.836739838f, 0.901586354f},
-std::array<float,2>{0.883371413f, 0.0246926211f},
-std::array<float,2>{0.390415639f, 0.766792417f},
-std::array<float,2>{0.106726408f, 0.352161378f},
-std::array<float,2>{0.628990054f, 0.518170238f},
-std::array<float,2>{0.915575325f, 0.365418881f},
-std::array<float,2>{0.423090786f, 0.510090828f},
-std::array<float,2>{0.0809588134f, 0.00386194419f},
-std::array<float,2>{0.675720811f, 0.758750021f},
-std::array<float,2>{0.605166793f, 0.210286722f},
-std::array<float,2>{0.244012192f, 0.888442338f},
-std::array<float,2>{0.334985912f, 0.46556136f},
-std::array<float,2>{0.855520964f, 0.679026306f},
-std::array<float,2>{0.745777845f, 0.424399316f},
-std::array<float,2>{0.052501481f, 0.744260609f},
-std::array<float,2>{0.474610567f, 0.128272116f},
-std::array<float,2>{0.965653658f, 0.97023046f},
-std::array<float,2>{0.776238024f, 0.117555737f},
-std::array<float,2>{0.291154981f, 0.834320903f},
-std::array<float,2>{0.13307859f, 0.308316022f},
-std::array<float,2>{0.528615117f, 0.600269794f},
-std::array<float,2>{0.817080617f, 0.472495168f},
-std::array<float,2>{0.366897136f, 0.654559731f},
-std::array<float,2>{0.199439064f, 0.242546558f},
-std::array<float,2>{0.583006382f, 0.931642532f},
-std::array<float,2>{0.655182123f, 0.0428839363f},
-std::array<float,2>{0.111822449f, 0.801459849f},
-std::array<float,2>{0.396413445f, 0.313902855f},
-std::array<float,2>{0.891001821f, 0.558421731f},
-std::array<float,2>{0.546602666f, 0.279040933f},
-std::array<float,2>{0.156593502f, 0.587009609f},
-std::array<float,2>{0.277242184f, 0.0847217664f},
-std::array<float,2>{0.811176538f, 0.87394762f},
-std::array<float,2>{0.998125613f, 0.165408492f},
-std::array<float,2>{0.46028018f, 0.952045977f},
-std::array<float,2>{0.00473953504f, 0.382445455f},
-std::array<float,2>{0.703724325f, 0.71203649f},
-std::array<float,2>{0.903730929f, 0.453353345f},
-std::array<float,2>{0.401889414f, 0.684174716f},
-std::array<float,2>{0.12110468f, 0.211946741f},
-std::array<float,2>{0.645227551f, 0.877137423f},
-std::array<float,2>{0.593475938f, 0.0147286328f},
-std::array<float,2>{0.194492653f, 0.754654408f},
-std::array<float,2>{0.368295491f, 0.368243724f},
-std::array<float,2>{0.82519871f, 0.505532324f},
-std::array<float,2>{0.716736138f, 0.299337745f},
-std::array<float,2>{0.0111307967f, 0.604206443f},
-std::array<float,2>{0.467558563f, 0.109720029f},
-std::array<float,2>{0.989630222f, 0.838440537f},
-std::array<float,2>{0.803422689f, 0.139430076f},
-std::array<float,2>{0.271531016f, 0.977628112f},
-std::array<float,2>{0.164663598f, 0.433911055f},
-std::array<float,2>{0.537136674f, 0.74120152f},
-std::array<float,2>{0.845678687f, 0.326819986f},
-std::array<float,2>{0.3409082f, 0.547939539f},
-std::array<float,2>{0.241517365f, 0.0351326577f},
-std::array<float,2>{0.600309074f, 0.811936617f},
-std::array<float,2>{0.680118263f, 0.23518014f},
-std::array<float,2>{0.0901461691f, 0.925362766f},
-std::array<float,2>{0.43648234f, 0.478867501f},
-std::array<float,2>{0.907759368f, 0.647728741f},
-std::array<float,2>{0.516419768f, 0.38350153f},
-std::array<float,2>{0.130381122f, 0.705938518f},
-std::array<float,2>{0.285821795f, 0.159293711f},
-std::array<float,2>{0.771114707f, 0.9402017f},
-std::array<float,2>{0.957623601f, 0.090870522f},
-std::array<float,2>{0.479647458f, 0.866212785f},
-std::array<float,2>{0.0570660606f, 0.273040235f},
-std::array<float,2>{0.738605797f, 0.579468548f},
-std::array<float,2>{0.972134411f, 0.26442036f},
-std::array<float,2>{0.445976347f, 0.562857866f},
-std::array<float,2>{0.0195897277f, 0.0666123629f},
-std::array<float,2>{0.697058439f, 0.847855568f},
-std::array<float,2>{0.558998048f, 0.183564574f},
-std::array<float,2>{0.185851797f, 0.958858788f},
-std::array<float,2>{0.261166245f, 0.395370364f},
-std::array<float,2>{0.781756878f, 0.693072259f},
-std::array<float,2>{0.638919532f, 0.496715158f},
-std::array<float,2>{0.0938099995f, 0.638143718f},
-std::array<float,2>{0.375493109f, 0.23068808f},
-std::array<float,2>{0.876341105f, 0.911359966f},
-std::array<float,2>{0.831746638f, 0.0586530939f},
-std::array<float,2>{0.35176912f, 0.785098016f},
-std::array<float,2>{0.209729895f, 0.330224246f},
-std::array<float,2>{0.568459272f, 0.53283298f},
-std::array<float,2>{0.755049527f, 0.40735358f},
-std::array<float,2>{0.297133863f, 0.721924901f},
-std::array<float,2>{0.141478419f, 0.152604908f},
-std::array<float,2>{0.506693542f, 0.989202201f},
-std::array<float,2>{0.720496356f, 0.105821602f},
-std::array<float,2>{0.0321648531f, 0.820820451f},
-std::array<float,2>{0.484561116f, 0.28494221f},
-std::array<float,2>{0.938838243f, 0.616942465f},
-std::array<float,2>{0.62281549f, 0.349556059f},
-std::array<float,2>{0.230656236f, 0.527393937f},
-std::array<float,2>{0.326347113f, 0.0195714589f},
-std::array<float,2>{0.863625348f, 0.77448231f},
-std::array<float,2>{0.932008862f, 0.191525951f},
-std::array<float,2>{0.420829445f, 0.896063685f},
-std::array<float,2>{0.0742275864f, 0.452918798f},
-std::array<float,2>{0.668640196f, 0.671281815f},
-std::array<float,2>{0.953781545f, 0.437865436f},
-std::array<float,2>{0.48237586f, 0.659619153f},
-std::array<float,2>{0.0587364808f, 0.202666223f},
-std::array<float,2>{0.735534847f, 0.90425688f},
-std::array<float,2>{0.520014763f, 0.028109841f},
-std::array<float,2>{0.127198473f, 0.769649625f},
-std::array<float,2>{0.281682044f, 0.358815759f},
-std::array<float,2>{0.7689569f, 0.519848585f},
-std::array<float,2>{0.686280429f, 0.292688638f},
-std::array<float,2>{0.0886856839f, 0.617617249f},
-std::array<float,2>{0.431485474f, 0.100039989f},
-std::array<float,2>{0.910497129f, 0.816772759f},
-std::array<float,2>{0.848406851f, 0.141433939f},
-std::array<float,2>{0.337228328f, 0.997616589f},
-std::array<float,2>{0.235480756f, 0.417798609f},
-std::array<float,2>{0.593963325f, 0.732711256f},
-std::array<float,2>{0.798922837f, 0.343472302f},
-std::array<float,2>{0.265889555f, 0.546196461f},
-std::array<float,2>{0.168233126f, 0.0521405376f},
-std::array<float,2>{0.532918811f, 0.796138883f},
-std::array<float,2>{0.713983536f, 0.222891092f},
-std::array<float,2>{0.0146263754f, 0.919057369f},
-std::array<float,2>{0.464267999f, 0.486819446f},
-std::array<float,2>{0.986190975f, 0.626431584f},
-std::array<float,2>{0.58789438f, 0.40535742f},
-std::array<float,2>{0.189822167f, 0.697517097f},
-std::array<float,2>{0.374316812f, 0.177381143f},
-std::array<float,2>{0.821547985f, 0.968128741f},
-std::array<float,2>{0.900907993f, 0.0772980228f},
-std::array<float,2>{0.404096544f, 0.858910739f},
-std::array<float,2>{0.11850787f, 0.255859226f},
-std::array<float,2>{0.643484294f, 0.570715845f},
-std::array<float,2>{0.937183857f, 0.274066836f},
-std::array<float,2>{0.41509521f, 0.59366709f},
-std::array<float,2>{0.0727128759f, 0.0795567036f},
-std::array<float,2>{0.666626871f, 0.867598295f},
-std::array<float,2>{0.620675564f, 0.170533314f},
-std::array<float,2>{0.229444966f, 0.945329666f},
-std::array<float,2>{0.322062969f, 0.377361089f},
-std::array<float,2>{0.860316038f, 0.718236029f},
-std::array<float,2>{0.725030601f, 0.475251168f},
-std::array<float,2>{0.0378510132f, 0.649130404f},
-std::array<float,2>{0.488995165f, 0.247405455f},
-std::array<float,2>{0.944037318f, 0.937025785f},
-std::array<float,2>{0.751989067f, 0.0468338802f},
-std::array<float,2>{0.301440686f, 0.797902763f},
-std::array<float,2>{0.147465497f, 0.319768131f},
-std::array<float,2>{0.501177907f, 0.562056899f},
-std::array<float,2>{0.833285749f, 0.428048104f},
-std::array<float,2>{0.357065022f, 0.747388363f},
-std::array<float,2>{0.204524487f, 0.132085636f},
-std::array<float,2>{0.562611222f, 0.974063337f},
-std::array<float,2>{0.635843635f, 0.12371622f},
-std::array<float,2>{0.101236671f, 0.829144716f},
-std::array<float,2>{0.381755769f, 0.309964806f},
-std::array<float,2>{0.882049263f, 0.597507834f},
-std::array<float,2>{0.554696262f, 0.35938409f},
-std::array<float,2>{0.183206141f, 0.512583196f},
-std::array<float,2>{0.265491784f, 0.00604378479f},
-std::array<float,2>{0.788385272f, 0.764906406f},
-std::array<float,2>{0.975867927f, 0.205294997f},
-std::array<float,2>{0.452788025f, 0.883357346f},
-std::array<float,2>{0.0157409031f, 0.462713897f},
-std::array<float,2>{0.700046182f, 0.671947241f},
-std::array<float,2>{0.887113571f, 0.386766821f},
-std::array<float,2>{0.384870678f, 0.708207071f},
-std::array<float,2>{0.10535942f, 0.162665799f},
-std::array<float,2>{0.626170039f, 0.94380486f},
-std::array<float,2>{0.570933461f, 0.0888245478f},
-std::array<float,2>{0.21648635f, 0.862884641f},
-std::array<float,2>{0.348413736f, 0.266128153f},
-std::array<float,2>{0.841708422f, 0.585779965f},
-std::array<float,2>{0.694751978f, 0.323062122f},
-std::array<float,2>{0.0311098304f, 0.553288341f},
-std::array<float,2>{0.439906597f, 0.0360802822f},
-std::array<float,2>{0.981275499f, 0.808094144f},
-std::array<float,2>{0.792282224f, 0.23914206f},
-std::array<float,2>{0.25260359f, 0.926094532f},
-std::array<float,2>{0.173014477f, 0.484273463f},
-std::array<float,2>{0.553439617f, 0.64235574f},
-std::array<float,2>{0.872857869f, 0.302242279f},
-std::array<float,2>{0.314745724f, 0.608306408f},
-std::array<float,2>{0.223301128f, 0.116454564f},
-std::array<float,2>{0.616951942f, 0.842554331f},
-std::array<float,2>{0.659666836f, 0.132832468f},
-std::array<float,2>{0.0655393302f, 0.981735706f},
-std::array<float,2>{0.406582445f, 0.433536261f},
-std::array<float,2>{0.926458359f, 0.735176563f},
-std::array<float,2>{0.511095643f, 0.459380776f},
-std::array<float,2>{0.148697868f, 0.682953775f},
-std::array<float,2>{0.310637832f, 0.218576416f},
-std::array<float,2>{0.761019647f, 0.87944299f},
-std::array<float,2>{0.946524441f, 0.010414877f},
-std::array<float,2>{0.498909682f, 0.750593603f},
-std::array<float,2>{0.0440691933f, 0.374297291f},
-std::array<float,2>{0.731605172f, 0.500171542f},
-std::array<float,2>{0.992411673f, 0.344074517f},
-std::array<float,2>{0.455609351f, 0.526508212f},
-std::array<float,2>{0.00205834815f, 0.0158431139f},
-std::array<float,2>{0.708414853f, 0.78124845f},
-std::array<float,2>{0.541263223f, 0.190562546f},
-std::array<float,2>{0.16338113f, 0.89312923f},
-std::array<float,2>{0.279374301f, 0.448833287f},
-std::array<float,2>{0.807586789f, 0.667727172f},
-std::array<float,2>{0.651881337f, 0.411534369f},
-std::array<float,2>{0.1138082f, 0.723760009f},
-std::array<float,2>{0.392553359f, 0.149442166f},
-std::array<float,2>{0.894989312f, 0.986840248f},
-std::array<float,2>{0.813819587f, 0.10265094f},
-std::array<float,2>{0.360758662f, 0.824493825f},
-std::array<float,2>{0.195601091f, 0.287586719f},
-std::array<float,2>{0.579588175f, 0.611178935f},
-std::array<float,2>{0.780073881f, 0.492879927f},
-std::array<float,2>{0.295511454f, 0.636246204f},
-std::array<float,2>{0.13906008f, 0.229585454f},
-std::array<float,2>{0.526299894f, 0.907904685f},
-std::array<float,2>{0.748064816f, 0.056088727f},
-std::array<float,2>{0.0470114984f, 0.785832763f},
-std::array<float,2>{0.471539676f, 0.333783507f},
-std::array<float,2>{0.964535952f, 0.536975384f},
-std::array<float,2>{0.608053148f, 0.259491801f},
-std::array<float,2>{0.248966366f, 0.566942036f},
-std::array<float,2>{0.331666797f, 0.064994514f},
-std::array<float,2>{0.852257609f, 0.844641864f},
-std::array<float,2>{0.920759499f, 0.185835272f},
-std::array<float,2>{0.426200569f, 0.953198969f},
-std::array<float,2>{0.0855800435f, 0.392577469f},
-std::array<float,2>{0.677585423f, 0.689806581f},
-std::array<float,2>{0.979107857f, 0.420523375f},
-std::array<float,2>{0.445089549f, 0.726742804f},
-std::array<float,2>{0.0261703506f, 0.148061231f},
-std::array<float,2>{0.690782368f, 0.996056199f},
-std::array<float,2>{0.550534964f, 0.0961887985f},
-std::array<float,2>{0.177532703f, 0.813506782f},
-std::array<float,2>{0.255517215f, 0.295226663f},
-std::array<float,2>{0.795988798f, 0.62210381f},
-std::array<float,2>{0.63215059f, 0.354703814f},
-std::array<float,2>{0.107474469f, 0.51586622f},
-std::array<float,2>{0.388307273f, 0.0263029467f},
-std::array<float,2>{0.884880364f, 0.76913327f},
-std::array<float,2>{0.839520276f, 0.196779877f},
-std::array<float,2>{0.344680607f, 0.898591399f},
-std::array<float,2>{0.214484319f, 0.443979204f},
-std::array<float,2>{0.574236453f, 0.663556755f},
-std::array<float,2>{0.765610635f, 0.253372431f},
-std::array<float,2>{0.304945856f, 0.574760377f},
-std::array<float,2>{0.155112848f, 0.0739232525f},
-std::array<float,2>{0.515448749f, 0.851727664f},
-std::array<float,2>{0.727300942f, 0.173728243f},
-std::array<float,2>{0.0395463407f, 0.96477437f},
-std::array<float,2>{0.495356202f, 0.400730133f},
-std::array<float,2>{0.950273871f, 0.702908874f},
-std::array<float,2>{0.609674752f, 0.489232272f},
-std::array<float,2>{0.220023885f, 0.631732464f},
-std::array<float,2>{0.318147898f, 0.220308736f},
-std::array<float,2>{0.869383812f, 0.914368927f},
-std::array<float,2>{0.925703824f, 0.0485131368f},
-std::array<float,2>{0.412677169f, 0.791812599f},
-std::array<float,2>{0.0673230886f, 0.337820977f},
-std::array<float,2>{0.662183702f, 0.539729774f},
-std::array<float,2>{0.89305383f, 0.315909147f},
-std::array<float,2>{0.396767229f, 0.555849493f},
-std::array<float,2>{0.111256532f, 0.0402491242f},
-std::array<float,2>{0.652758598f, 0.803163469f},
-std::array<float,2>{0.585330606f, 0.245932311f},
-std::array<float,2>{0.202607736f, 0.931459606f},
-std::array<float,2>{0.363461077f, 0.469041735f},
-std::array<float,2>{0.818877876f, 0.653087616f},
-std::array<float,2>{0.705829859f, 0.379365385f},
-std::array<float,2>{0.00769665185f, 0.714473069f},
-std::array<float,2>{0.457446188f, 0.166331246f},
-std::array<float,2>{0.99622196f, 0.950296342f},
-std::array<float,2>{0.809728861f, 0.0829471126f},
-std::array<float,2>{0.274972856f, 0.872239709f},
-std::array<float,2>{0.158565879f, 0.280560434f},
-std::array<float,2>{0.543608427f, 0.588264406f},
-std::array<float,2>{0.858296692f, 0.467686355f},
-std::array<float,2>{0.33204937f, 0.677233219f},
-std::array<float,2>{0.244379982f, 0.208533779f},
-std::array<float,2>{0.602386177f, 0.888848901f},
-std::array<float,2>{0.672273576f, 0.000135060749f},
-std::array<float,2>{0.078691572f, 0.760097444f},
-std::array<float,2>{0.425340682f, 0.364151001f},
-std::array<float,2>{0.916494191f, 0.508341551f},
-std::array<float,2>{0.529762447f, 0.304999709f},
-std::array<float,2>{0.13570939f, 0.599362552f},
-std::array<float,2>{0.289976954f, 0.120419316f},
-std::array<float,2>{0.775054038f, 0.832764447f},
-std::array<float,2>{0.967987418f, 0.125186324f},
-std::array<float,2>{0.474039227f, 0.971945703f},
-std::array<float,2>{0.0531018749f, 0.422775388f},
-std::array<float,2>{0.743996382f, 0.743244946f},
-std::array<float,2>{0.908593357f, 0.477289915f},
-std::array<float,2>{0.434692472f, 0.645783305f},
-std::array<float,2>{0.0931336135f, 0.237307489f},
-std::array<float,2>{0.683480799f, 0.922710061f},
-std::array<float,2>{0.598037124f, 0.0329765566f},
-std::array<float,2>{0.238375917f, 0.809109628f},
-std::array<float,2>{0.342313319f, 0.325084358f},
-std::array<float,2>{0.846933126f, 0.549646795f},
-std::array<float,2>{0.741440058f, 0.271041602f},
-std::array<float,2>{0.0550073273f, 0.580435574f},
-std::array<float,2>{0.477892786f, 0.0932102799f},
-std::array<float,2>{0.959052086f, 0.863931596f},
-std::array<float,2>{0.773223639f, 0.15791592f},
-std::array<float,2>{0.288338959f, 0.938623726f},
-std::array<float,2>{0.131536096f, 0.386219472f},
-std::array<float,2>{0.517734826f, 0.703355253f},
-std::array<float,2>{0.827515244f, 0.370599359f},
-std::array<float,2>{0.370701998f, 0.506197453f},
-std::array<float,2>{0.191853836f, 0.0122396993f},
-std::array<float,2>{0.590973616f, 0.757530689f},
-std::array<float,2>{0.647721767f, 0.214025691f},
-std::array<float,2>{0.123719357f, 0.875619113f},
-std::array<float,2>{0.399777681f, 0.457000136f},
-std::array<float,2>{0.905191422f, 0.686692894f},
-std::array<float,2>{0.535514414f, 0.436006814f},
-std::array<float,2>{0.167007759f, 0.738401115f},
-std::array<float,2>{0.269592196f, 0.138020962f},
-std::array<float,2>{0.801985443f, 0.979282618f},
-std::array<float,2>{0.992104292f, 0.111687794f},
-std::array<float,2>{0.466003209f, 0.836228669f},
-std::array<float,2>{0.00942849647f, 0.29760161f},
-std::array<float,2>{0.717693031f, 0.602214515f},
-std::array<float,2>{0.940624177f, 0.281596124f},
-std::array<float,2>{0.487718284f, 0.614494979f},
-std::array<float,2>{0.0334883034f, 0.108270422f},
-std::array<float,2>{0.720857739f, 0.824041069f},
-std::array<float,2>{0.505434334f, 0.154545933f},
-std::array<float,2>{0.143882647f, 0.991205692f},
-std::array<float,2>{0.300006747f, 0.408683658f},
-std::array<float,2>{0.756299436f, 0.719130695f},
-std::array<float,2>{0.67036289f, 0.450045109f},
-std::array<float,2>{0.0770165995f, 0.668794155f},
-std::array<float,2>{0.419564396f, 0.193900302f},
-std::array<float,2>{0.930182815f, 0.896838844f},
-std::array<float,2>{0.866523027f, 0.0215683561f},
-std::array<float,2>{0.326129735f, 0.775553644f},
-std::array<float,2>{0.233842075f, 0.350869387f},
-std::array<float,2>{0.624969065f, 0.529972732f},
-std::array<float,2>{0.784323812f, 0.397305161f},
-std::array<float,2>{0.259264737f, 0.693880558f},
-std::array<float,2>{0.184329644f, 0.18130894f},
-std::array<float,2>{0.562055349f, 0.960749865f},
-std::array<float,2>{0.697935939f, 0.0687998459f},
-std::array<float,2>{0.0233606081f, 0.851066589f},
-std::array<float,2>{0.447406352f, 0.263482213f},
-std::array<float,2>{0.970051169f, 0.564858317f},
-std::array<float,2>{0.566793144f, 0.328515947f},
-std::array<float,2>{0.207487017f, 0.533947527f},
-std::array<float,2>{0.353671312f, 0.0606898591f},
-std::array<float,2>{0.828913271f, 0.782363176f},
-std::array<float,2>{0.877482831f, 0.2340886f},
-std::array<float,2>{0.378110975f, 0.913332224f},
-std::array<float,2>{0.0975988656f, 0.498069793f},
-std::array<float,2>{0.638353407f, 0.639035881f},
-std::array<float,2>{0.973276436f, 0.461180508f},
-std::array<float,2>{0.450649917f, 0.673281491f},
-std::array<float,2>{0.0187758263f, 0.206072986f},
-std::array<float,2>{0.702397108f, 0.883841693f},
-std::array<float,2>{0.558472931f, 0.00721171079f},
-std::array<float,2>{0.179873794f, 0.763807833f},
-std::array<float,2>{0.263338685f, 0.360764474f},
-std::array<float,2>{0.786978185f, 0.512840211f},
-std::array<float,2>{0.6337322f, 0.308908015f},
-std::array<float,2>{0.0982971936f, 0.596594393f},
-std::array<float,2>{0.380758166f, 0.124277905f},
-std::array<float,2>{0.879647195f, 0.828775227f},
-std::array<float,2>{0.834747314f, 0.131613463f},
-std::array<float,2>{0.358227909f, 0.973000348f},
-std::array<float,2>{0.206265822f, 0.429627478f},
-std::array<float,2>{0.566293359f, 0.746364176f},
-std::array<float,2>{0.751912951f, 0.318596005f},
-std::array<float,2>{0.30304575f, 0.560955107f},
-std::array<float,2>{0.145869672f, 0.0451319218f},
-std::array<float,2>{0.502710044f, 0.797789156f},
-std::array<float,2>{0.723617017f, 0.246683091f},
-std::array<float,2>{0.0360878408f, 0.936171234f},
-std::array<float,2>{0.490805417f, 0.476271391f},
-std::array<float,2>{0.941628158f, 0.649948418f},
-std::array<float,2>{0.618020713f, 0.378026843f},
-std::array<float,2>{0.228371352f, 0.716862261f},
-std::array<float,2>{0.323001623f, 0.171745017f},
-std::array<float,2>{0.861676693f, 0.946337759f},
-std::array<float,2>{0.935035169f, 0.0790087953f},
-std::array<float,2>{0.416627735f, 0.868923485f},
-std::array<float,2>{0.0722340941f, 0.275060147f},
-std::array<float,2>{0.664827764f, 0.592049718f},
-std::array<float,2>{0.900068939f, 0.254628927f},
-std::array<float,2>{0.405010939f, 0.571703315f},
-std::array<float,2>{0.119618282f, 0.0769713372f},
-std::array<float,2>{0.640722513f, 0.858122349f},
-std::array<float,2>{0.587575853f, 0.175884649f},
-std::array<float,2>{0.189408809f, 0.966846704f},
-std::array<float,2>{0.372440398f, 0.405022711f},
-std::array<float,2>{0.823942006f, 0.69893837f},
-std::array<float,2>{0.712614238f, 0.488135099f},
-std::array<float,2>{0.0123247625f, 0.625057995f},
-std::array<float,2>{0.461095631f, 0.22369118f},
-std::array<float,2>{0.986861765f, 0.918465257f},
-std::array<float,2>{0.797845602f, 0.0513713397f},
-std::array<float,2>{0.268652022f, 0.795810282f},
-std::array<float,2>{0.170800522f, 0.342533082f},
-std::array<float,2>{0.533807278f, 0.545407414f},
-std::array<float,2>{0.851462364f, 0.416761428f},
-std::array<float,2>{0.339725852f, 0.734014928f},
-std::array<float,2>{0.237159923f, 0.142417952f},
-std::array<float,2>{0.596331f, 0.99632895f},
-std::array<float,2>{0.685031056f, 0.101054154f},
-std::array<float,2>{0.0868529379f, 0.818205535f},
-std::array<float,2>{0.432492524f, 0.291219264f},
-std::array<float,2>{0.912876606f, 0.618820131f},
-std::array<float,2>{0.521817505f, 0.358054221f},
-std::array<float,2>{0.126075849f, 0.521342397f},
-std::array<float,2>{0.283432066f, 0.0288057979f},
-std::array<float,2>{0.767326772f, 0.771456599f},
-std::array<float,2>{0.95648396f, 0.201852828f},
-std::array<float,2>{0.483618945f, 0.903060436f},
-std::array<float,2>{0.0622147992f, 0.439446121f},
-std::array<float,2>{0.73700887f, 0.658722401f},
-std::array<float,2>{0.918880761f, 0.391001344f},
-std::array<float,2>{0.428649426f, 0.690504909f},
-std::array<float,2>{0.0827948526f, 0.187294066f},
-std::array<float,2>{0.677941084f, 0.955039442f},
-std::array<float,2>{0.606910527f, 0.0655693114f},
-std::array<float,2>{0.247955531f, 0.844896257f},
-std::array<float,2>{0.32840842f, 0.258263588f},
-std::array<float,2>{0.854355872f, 0.567779303f},
-std::array<float,2>{0.747814298f, 0.332426757f},
-std::array<float,2>{0.0491195954f, 0.535826504f},
-std::array<float,2>{0.469833285f, 0.0549839325f},
-std::array<float,2>{0.962423563f, 0.787005246f},
-std::array<float,2>{0.778316915f, 0.228816241f},
-std::array<float,2>{0.293891072f, 0.906333625f},
-std::array<float,2>{0.138300687f, 0.493185043f},
-std::array<float,2>{0.525325656f, 0.635119677f},
-std::array<float,2>{0.81571877f, 0.288537949f},
-std::array<float,2>{0.362710685f, 0.610349655f},
-std::array<float,2>{0.198320389f, 0.102381311f},
-std::array<float,2>{0.581507802f, 0.825977266f},
-std::array<float,2>{0.64954561f, 0.148871437f},
-std::array<float,2>{0.116654947f, 0.988281071f},
-std::array<float,2>{0.392672122f, 0.410249233f},
-std::array<float,2>{0.897698522f, 0.723157346f},
-std::array<float,2>{0.540075779f, 0.447293073f},
-std::array<float,2>{0.161697671f, 0.666544199f},
-std::array<float,2>{0.278198302f, 0.189752519f},
-std::array<float,2>{0.804933786f, 0.893824875f},
-std::array<float,2>{0.9957726f, 0.0171834715f},
-std::array<float,2>{0.453474551f, 0.77952534f},
-std::array<float,2>{0.000681723759f, 0.345595479f},
-std::array<float,2>{0.71067667f, 0.525526941f},
-std::array<float,2>{0.947516263f, 0.373112231f},
-std::array<float,2>{0.496779531f, 0.501377523f},
-std::array<float,2>{0.0454975143f, 0.0112041254f},
-std::array<float,2>{0.732864439f, 0.751850903f},
-std::array<float,2>{0.509287298f, 0.217503309f},
-std::array<float,2>{0.152011991f, 0.880279422f},
-std::array<float,2>{0.309224159f, 0.460438877f},
-std::array<float,2>{0.758457959f, 0.68210876f},
-std::array<float,2>{0.657004952f, 0.431792676f},
-std::array<float,2>{0.0637172908f, 0.736195207f},
-std::array<float,2>{0.408226341f, 0.133906066f},
-std::array<float,2>{0.928184688f, 0.980738163f},
-std::array<float,2>{0.874760866f, 0.1159468f},
-std::array<float,2>{0.313583732f, 0.843047678f},
-std::array<float,2>{0.225347951f, 0.301707685f},
-std::array<float,2>{0.613735974f, 0.608652234f},
-std::array<float,2>{0.790112019f, 0.482913196f},
-std::array<float,2>{0.251253337f, 0.641518354f},
-std::array<float,2>{0.175221324f, 0.23953402f},
-std::array<float,2>{0.551792562f, 0.92695415f},
-std::array<float,2>{0.693198025f, 0.0362022705f},
-std::array<float,2>{0.0283139534f, 0.807269394f},
-std::array<float,2>{0.439322799f, 0.324164629f},
-std::array<float,2>{0.984029293f, 0.553796053f},
-std::array<float,2>{0.574114025f, 0.267005175f},
-std::array<float,2>{0.217876479f, 0.584228575f},
-std::array<float,2>{0.350220501f, 0.0892618448f},
-std::array<float,2>{0.842313051f, 0.862240553f},
-std::array<float,2>{0.889097512f, 0.164054126f},
-std::array<float,2>{0.38435474f, 0.944524646f},
-std::array<float,2>{0.102176286f, 0.388529897f},
-std::array<float,2>{0.628755867f, 0.707386971f},
-std::array<float,2>{0.966353714f, 0.423026562f},
-std::array<float,2>{0.475737214f, 0.74297744f},
-std::array<float,2>{0.051716201f, 0.126934707f},
-std::array<float,2>{0.744384766f, 0.971520364f},
-std::array<float,2>{0.528216362f, 0.12006668f},
-std::array<float,2>{0.134072587f, 0.833734632f},
-std::array<float,2>{0.292829812f, 0.30656293f},
-std::array<float,2>{0.776428998f, 0.598314583f},
-std::array<float,2>{0.674796581f, 0.36481759f},
-std::array<float,2>{0.0810721964f, 0.50925976f},
-std::array<float,2>{0.422382683f, 0.00143355946f},
-std::array<float,2>{0.91413784f, 0.761119902f},
-std::array<float,2>{0.856883883f, 0.207435548f},
-std::array<float,2>{0.334236801f, 0.890098929f},
-std::array<float,2>{0.242600366f, 0.468669146f},
-std::array<float,2>{0.603628159f, 0.675964773f},
-std::array<float,2>{0.811831355f, 0.27983138f},
-std::array<float,2>{0.275612235f, 0.589483738f},
-std::array<float,2>{0.157558426f, 0.0838790983f},
-std::array<float,2>{0.545711279f, 0.871454597f},
-std::array<float,2>{0.704645336f, 0.167854473f},
-std::array<float,2>{0.0049163159f, 0.949494183f},
-std::array<float,2>{0.459659427f, 0.38051042f},
-std::array<float,2>{0.999037981f, 0.713162482f},
-std::array<float,2>{0.583719909f, 0.470685929f},
-std::array<float,2>{0.201091468f, 0.65425539f},
-std::array<float,2>{0.365421653f, 0.244805068f},
-std::array<float,2>{0.818051338f, 0.930136144f},
-std::array<float,2>{0.89188236f, 0.0393469483f},
-std::array<float,2>{0.394964397f, 0.804148197f},
-std::array<float,2>{0.112493873f, 0.314492077f},
-std::array<float,2>{0.655805945f, 0.554996192f},
-std::array<float,2>{0.922437429f, 0.335976422f},
-std::array<float,2>{0.410350025f, 0.540462554f},
-std::array<float,2>{0.069521144f, 0.0473857261f},
-std::array<float,2>{0.662083685f, 0.792545021f},
-std::array<float,2>{0.612678349f, 0.218970746f},
-std::array<float,2>{0.221699342f, 0.915761888f},
-std::array<float,2>{0.31937921f, 0.4901326f},
-std::array<float,2>{0.868413031f, 0.63258028f},
-std::array<float,2>{0.72948873f, 0.401883662f},
-std::array<float,2>{0.0421313569f, 0.70185858f},
-std::array<float,2>{0.493876725f, 0.172590733f},
-std::array<float,2>{0.951271713f, 0.963389933f},
-std::array<float,2>{0.762341917f, 0.0727748871f},
-std::array<float,2>{0.308211088f, 0.852835655f},
-std::array<float,2>{0.153658405f, 0.252374232f},
-std::array<float,2>{0.513436913f, 0.575224936f},
-std::array<float,2>{0.837310374f, 0.444829077f},
-std::array<float,2>{0.34697625f, 0.662513018f},
-std::array<float,2>{0.211255193f, 0.196155921f},
-std::array<float,2>{0.576433897f, 0.899702489f},
-std::array<float,2>{0.630572915f, 0.0269374549f},
-std::array<float,2>{0.10579174f, 0.767617285f},
-std::array<float,2>{0.389551491f, 0.353704125f},
-std::array<float,2>{0.883985639f, 0.517120957f},
-std::array<float,2>{0.548728347f, 0.296370327f},
-std::array<float,2>{0.177898899f, 0.621254206f},
-std::array<float,2>{0.256073773f, 0.0973254368f},
-std::array<float,2>{0.794145644f, 0.812543809f},
-std::array<float,2>{0.97843951f, 0.147196621f},
-std::array<float,2>{0.441460103f, 0.994703293f},
-std::array<float,2>{0.0249669403f, 0.421328098f},
-std::array<float,2>{0.688544393f, 0.728396833f},
-std::array<float,2>{0.875309229f, 0.499686897f},
-std::array<float,2>{0.376736075f, 0.640404105f},
-std::array<float,2>{0.0952901095f, 0.232509926f},
-std::array<float,2>{0.640503347f, 0.912159383f},
-std::array<float,2>{0.569635212f, 0.0622220971f},
-std::array<float,2>{0.21032533f, 0.781532288f},
-std::array<float,2>{0.352608144f, 0.329208285f},
-std::array<float,2>{0.830309093f, 0.534238935f},
-std::array<float,2>{0.696096301f, 0.261766672f},
-std::array<float,2>{0.0213754028f, 0.565809727f},
-std::array<float,2>{0.44654122f, 0.0701451078f},
-std::array<float,2>{0.971127629f, 0.849837959f},
-std::array<float,2>{0.782613397f, 0.180663139f},
-std::array<float,2>{0.259891152f, 0.959221065f},
-std::array<float,2>{0.187307656f, 0.398391396f},
-std::array<float,2>{0.559812367f, 0.695197165f},
-std::array<float,2>{0.865054071f, 0.350132972f},
-std::array<float,2>{0.327296734f, 0.531133175f},
-std::array<float,2>{0.231733441f, 0.0232218467f},
-std::array<float,2>{0.621643424f, 0.776384234f},
-std::array<float,2>{0.669458449f, 0.194764659f},
-std::array<float,2>{0.0761246011f, 0.897834837f},
-std::array<float,2>{0.4214755f, 0.450801194f},
-std::array<float,2>{0.932986021f, 0.669067502f},
-std::array<float,2>{0.506836891f, 0.410113633f},
-std::array<float,2>{0.141918108f, 0.719884813f},
-std::array<float,2>{0.297875226f, 0.15564476f},
-std::array<float,2>{0.754469335f, 0.991566122f},
-std::array<float,2>{0.937754333f, 0.109242752f},
-std::array<float,2>{0.485582024f, 0.823175311f},
-std::array<float,2>{0.0329496749f, 0.28271234f},
-std::array<float,2>{0.719389498f, 0.613773525f},
-std::array<float,2>{0.988493204f, 0.298104674f},
-std::array<float,2>{0.467871755f, 0.602689862f},
-std::array<float,2>{0.0103975907f, 0.112916619f},
-std::array<float,2>{0.715387046f, 0.837535203f},
-std::array<float,2>{0.538214087f, 0.137381569f},
-std::array<float,2>{0.165906906f, 0.979943156f},
-std::array<float,2>{0.272591084f, 0.437030613f},
-std::array<float,2>{0.804217756f, 0.739889324f},
-std::array<float,2>{0.645700276f, 0.455373704f},
-std::array<float,2>{0.122923076f, 0.686156154f},
-std::array<float,2>{0.400581449f, 0.213472515f},
-std::array<float,2>{0.902606905f, 0.87682265f},
-std::array<float,2>{0.824772656f, 0.0136713386f},
-std::array<float,2>{0.367699087f, 0.756292343f},
-std::array<float,2>{0.194043845f, 0.369202107f},
-std::array<float,2>{0.592713058f, 0.507787645f},
-std::array<float,2>{0.769915164f, 0.385353416f},
-std::array<float,2>{0.287034214f, 0.704292893f},
-std::array<float,2>{0.129369959f, 0.15720956f},
-std::array<float,2>{0.517367184f, 0.938415766f},
-std::array<float,2>{0.739831865f, 0.0921608731f},
-std::array<float,2>{0.0582159869f, 0.864608884f},
-std::array<float,2>{0.479123354f, 0.270011008f},
-std::array<float,2>{0.958015203f, 0.581792891f},
-std::array<float,2>{0.601375818f, 0.325460762f},
-std::array<float,2>{0.240893811f, 0.550253391f},
-std::array<float,2>{0.340380341f, 0.0321229175f},
-std::array<float,2>{0.84423548f, 0.810174644f},
-std::array<float,2>{0.906982601f, 0.236629471f},
-std::array<float,2>{0.437325895f, 0.923040807f},
-std::array<float,2>{0.0916491747f, 0.47804603f},
-std::array<float,2>{0.68117398f, 0.645204246f},
-std::array<float,2>{0.944887638f, 0.474017739f},
-std::array<float,2>{0.490106642f, 0.65045321f},
-std::array<float,2>{0.0383991301f, 0.248579532f},
-std::array<float,2>{0.726151228f, 0.933838546f},
-std::array<float,2>{0.500255585f, 0.0437194295f},
-std::array<float,2>{0.146975681f, 0.798922956f},
-std::array<float,2>{0.302088886f, 0.317646503f},
-std::array<float,2>{0.753219604f, 0.560269833f},
-std::array<float,2>{0.667870402f, 0.276742488f},
-std::array<float,2>{0.0736927316f, 0.591185451f},
-std::array<float,2>{0.414820552f, 0.080741398f},
-std::array<float,2>{0.935994625f, 0.870542169f},
-std::array<float,2>{0.860567808f, 0.169243038f},
-std::array<float,2>{0.32038793f, 0.947654366f},
-std::array<float,2>{0.229762629f, 0.376535803f},
-std::array<float,2>{0.619997203f, 0.716541111f},
-std::array<float,2>{0.787418306f, 0.362602681f},
-std::array<float,2>{0.264289796f, 0.513673782f},
-std::array<float,2>{0.18257162f, 0.00459331693f},
-std::array<float,2>{0.556328714f, 0.76229322f},
-std::array<float,2>{0.700798213f, 0.203793034f},
-std::array<float,2>{0.0175763592f, 0.885643601f},
-std::array<float,2>{0.45160687f, 0.464373112f},
-std::array<float,2>{0.974964678f, 0.674434841f},
-std::array<float,2>{0.564442754f, 0.425782323f},
-std::array<float,2>{0.2034612f, 0.749612451f},
-std::array<float,2>{0.356195629f, 0.129940331f},
-std::array<float,2>{0.832957864f, 0.97550416f},
-std::array<float,2>{0.881738663f, 0.122062832f},
-std::array<float,2>{0.382239938f, 0.831654787f},
-std::array<float,2>{0.100118183f, 0.312065333f},
-std::array<float,2>{0.635460258f, 0.594078362f},
-std::array<float,2>{0.911828578f, 0.290509164f},
-std::array<float,2>{0.430008173f, 0.620390952f},
-std::array<float,2>{0.0889061838f, 0.0980468467f},
-std::array<float,2>{0.686932921f, 0.819098949f},
-std::array<float,2>{0.595631599f, 0.142741412f},
-std::array<float,2>{0.234577492f, 0.9980703f},
-std::array<float,2>{0.336387306f, 0.415837318f},
-std::array<float,2>{0.848951101f, 0.731812894f},
-std::array<float,2>{0.734491467f, 0.440867573f},
-std::array<float,2>{0.0603037924f, 0.658153176f},
-std::array<float,2>{0.481270641f, 0.199716344f},
-std::array<float,2>{0.954555213f, 0.905858815f},
-std::array<float,2>{0.767778814f, 0.0303394273f},
-std::array<float,2>{0.282435119f, 0.772873223f},
-std::array<float,2>{0.128684163f, 0.356044233f},
-std::array<float,2>{0.521369278f, 0.521782815f},
-std::array<float,2>{0.821248889f, 0.402846128f},
-std::array<float,2>{0.373591244f, 0.696075857f},
-std::array<float,2>{0.191327393f, 0.179276317f},
-std::array<float,2>{0.589719772f, 0.965417385f},
-std::array<float,2>{0.6442945f, 0.0751643106f},
-std::array<float,2>{0.117624737f, 0.856427491f},
-std::array<float,2>{0.402856141f, 0.25601244f},
-std::array<float,2>{0.90188998f, 0.572422981f},
-std::array<float,2>{0.531912565f, 0.341778904f},
-std::array<float,2>{0.169000641f, 0.544248283f},
-std::array<float,2>{0.267224103f, 0.0530839451f},
-std::array<float,2>{0.800572455f, 0.793720901f},
-std::array<float,2>{0.984883726f, 0.225989535f},
-std::array<float,2>{0.463495284f, 0.920622885f},
-std::array<float,2>{0.015039471f, 0.485306114f},
-std::array<float,2>{0.713189602f, 0.628742158f},
-std::array<float,2>{0.895745575f, 0.412650406f},
-std::array<float,2>{0.3915236f, 0.726456404f},
-std::array<float,2>{0.114302903f, 0.151440442f},
-std::array<float,2>{0.650543153f, 0.985084713f},
-std::array<float,2>{0.578786254f, 0.10414055f},
-std::array<float,2>{0.196809664f, 0.826371968f},
-std::array<float,2>{0.359598845f, 0.286583126f},
-std::array<float,2>{0.812707782f, 0.611406147f},
-std::array<float,2>{0.707559109f, 0.346892059f},
-std::array<float,2>{0.00352078793f, 0.524695635f},
-std::array<float,2>{0.45686987f, 0.0190684963f},
-std::array<float,2>{0.993579566f, 0.779182315f},
-std::array<float,2>{0.807885826f, 0.188879654f},
-std::array<float,2>{0.280920744f, 0.891497374f},
-std::array<float,2>{0.162454903f, 0.446576416f},
-std::array<float,2>{0.54215318f, 0.665557623f},
-std::array<float,2>{0.853500068f, 0.261364222f},
-std::array<float,2>{0.330774844f, 0.56914705f},
-std::array<float,2>{0.24975796f, 0.0636925325f},
-std::array<float,2>{0.608478725f, 0.846678793f},
-std::array<float,2>{0.676137149f, 0.183998063f},
-std::array<float,2>{0.0840776861f, 0.95597285f},
-std::array<float,2>{0.427331269f, 0.392969489f},
-std::array<float,2>{0.921381295f, 0.688387632f},
-std::array<float,2>{0.526402533f, 0.494766951f},
-std::array<float,2>{0.140088245f, 0.63427639f},
-std::array<float,2>{0.296260357f, 0.227715299f},
-std::array<float,2>{0.781168342f, 0.908835173f},
-std::array<float,2>{0.963843107f, 0.0575110279f},
-std::array<float,2>{0.471728832f, 0.788934469f},
-std::array<float,2>{0.0488138795f, 0.334970623f},
-std::array<float,2>{0.749489009f, 0.537482023f},
-std::array<float,2>{0.982300639f, 0.321460009f},
-std::array<float,2>{0.44092223f, 0.552621245f},
-std::array<float,2>{0.0299228355f, 0.0374132022f},
-std::array<float,2>{0.693565369f, 0.80568701f},
-std::array<float,2>{0.554135501f, 0.241203606f},
-std::array<float,2>{0.171883926f, 0.927957892f},
-std::array<float,2>{0.25369212f, 0.482405901f},
-std::array<float,2>{0.791927636f, 0.64284879f},
-std::array<float,2>{0.625847816f, 0.388752371f},
-std::array<float,2>{0.104127608f, 0.710199654f},
-std::array<float,2>{0.386198699f, 0.16099675f},
-std::array<float,2>{0.88839376f, 0.943237126f},
-std::array<float,2>{0.839879036f, 0.0868457481f},
-std::array<float,2>{0.348727733f, 0.860202193f},
-std::array<float,2>{0.215173081f, 0.2693685f},
-std::array<float,2>{0.572041333f, 0.582036376f},
-std::array<float,2>{0.760460019f, 0.458910525f},
-std::array<float,2>{0.311598152f, 0.679860711f},
-std::array<float,2>{0.149758473f, 0.215792254f},
-std::array<float,2>{0.509786129f, 0.881707668f},
-std::array<float,2>{0.730961144f, 0.00975186937f},
-std::array<float,2>{0.0429697074f, 0.75375855f},
-std::array<float,2>{0.499650776f, 0.372430086f},
-std::array<float,2>{0.946177661f, 0.503120899f},
-std::array<float,2>{0.615429521f, 0.303214371f},
-std::array<float,2>{0.224561468f, 0.606814682f},
-std::array<float,2>{0.315496445f, 0.113476969f},
-std::array<float,2>{0.871313989f, 0.84039402f},
-std::array<float,2>{0.926785409f, 0.136215329f},
-std::array<float,2>{0.4075903f, 0.983877063f},
-std::array<float,2>{0.0645730346f, 0.431555063f},
-std::array<float,2>{0.658239543f, 0.737995327f},
-std::array<float,2>{0.997591734f, 0.381323576f},
-std::array<float,2>{0.458535254f, 0.711565495f},
-std::array<float,2>{0.00640736381f, 0.164694011f},
-std::array<float,2>{0.706527472f, 0.952959061f},
-std::array<float,2>{0.543967247f, 0.0854161084f},
-std::array<float,2>{0.159458712f, 0.87416786f},
-std::array<float,2>{0.274314225f, 0.277762502f},
-std::array<float,2>{0.80949074f, 0.586071134f},
-std::array<float,2>{0.653841138f, 0.313020051f},
-std::array<float,2>{0.110213742f, 0.557164311f},
-std::array<float,2>{0.398266912f, 0.0415012017f},
-std::array<float,2>{0.893885672f, 0.802274048f},
-std::array<float,2>{0.819346726f, 0.243955791f},
-std::array<float,2>{0.364541888f, 0.933260262f},
-std::array<float,2>{0.201802596f, 0.470822096f},
-std::array<float,2>{0.584037304f, 0.655837715f},
-std::array<float,2>{0.774328113f, 0.307607263f},
-std::array<float,2>{0.290460795f, 0.601432502f},
-std::array<float,2>{0.136454329f, 0.11854095f},
-std::array<float,2>{0.530490279f, 0.835929871f},
-std::array<float,2>{0.743040502f, 0.127029493f},
-std::array<float,2>{0.0543990657f, 0.969218254f},
-std::array<float,2>{0.473430574f, 0.424954921f},
-std::array<float,2>{0.96749568f, 0.745730221f},
-std::array<float,2>{0.602947176f, 0.465923131f},
-std::array<float,2>{0.245663762f, 0.677778363f},
-std::array<float,2>{0.333091021f, 0.209911153f},
-std::array<float,2>{0.859054923f, 0.887341917f},
-std::array<float,2>{0.917006493f, 0.00204263837f},
-std::array<float,2>{0.423844606f, 0.75954473f},
-std::array<float,2>{0.0799666569f, 0.366716474f},
-std::array<float,2>{0.673050284f, 0.511581838f},
-std::array<float,2>{0.886364222f, 0.35330534f},
-std::array<float,2>{0.387119293f, 0.519455135f},
-std::array<float,2>{0.109122679f, 0.023977749f},
-std::array<float,2>{0.631412089f, 0.766418397f},
-std::array<float,2>{0.575816512f, 0.197552606f},
-std::array<float,2>{0.21365054f, 0.901321769f},
-std::array<float,2>{0.345658422f, 0.442951471f},
-std::array<float,2>{0.838073373f, 0.66036123f},
-std::array<float,2>{0.690413475f, 0.419221073f},
-std::array<float,2>{0.0268020499f, 0.729944587f},
-std::array<float,2>{0.443869114f, 0.144886047f},
-std::array<float,2>{0.980434835f, 0.992303491f},
-std::array<float,2>{0.795815647f, 0.0951685831f},
-std::array<float,2>{0.254685491f, 0.816105664f},
-std::array<float,2>{0.176161975f, 0.294204384f},
-std::array<float,2>{0.549106538f, 0.624916434f},
-std::array<float,2>{0.870461106f, 0.491034865f},
-std::array<float,2>{0.316601902f, 0.630760789f},
-std::array<float,2>{0.219136626f, 0.221959591f},
-std::array<float,2>{0.610678613f, 0.916489363f},
-std::array<float,2>{0.663415611f, 0.0495259278f},
-std::array<float,2>{0.0680301338f, 0.789742231f},
-std::array<float,2>{0.41336894f, 0.339408249f},
-std::array<float,2>{0.923876643f, 0.54142493f},
-std::array<float,2>{0.514024138f, 0.2507177f},
-std::array<float,2>{0.155315906f, 0.577401757f},
-std::array<float,2>{0.3063187f, 0.0710664093f},
-std::array<float,2>{0.764243484f, 0.854084909f},
-std::array<float,2>{0.950096488f, 0.175077945f},
-std::array<float,2>{0.494789004f, 0.962024927f},
-std::array<float,2>{0.0403122529f, 0.399859786f},
-std::array<float,2>{0.727877676f, 0.700731158f},
-std::array<float,2>{0.930764377f, 0.452085733f},
-std::array<float,2>{0.41884616f, 0.670352399f},
-std::array<float,2>{0.0778630376f, 0.192671776f},
-std::array<float,2>{0.671534777f, 0.8951841f},
-std::array<float,2>{0.623449624f, 0.0205490869f},
-std::array<float,2>{0.233236805f, 0.77396208f},
-std::array<float,2>{0.324398398f, 0.348170459f},
-std::array<float,2>{0.865993798f, 0.528765321f},
-std::array<float,2>{0.721715987f, 0.284051448f},
-std::array<float,2>{0.0343722999f, 0.615513027f},
-std::array<float,2>{0.486904293f, 0.107130647f},
-std::array<float,2>{0.939608693f, 0.821440995f},
-std::array<float,2>{0.757403433f, 0.153722242f},
-std::array<float,2>{0.299700141f, 0.989815176f},
-std::array<float,2>{0.143127888f, 0.407000393f},
-std::array<float,2>{0.50463748f, 0.721576393f},
-std::array<float,2>{0.829523683f, 0.331626236f},
-std::array<float,2>{0.355311841f, 0.532032907f},
-std::array<float,2>{0.208103642f, 0.0599147528f},
-std::array<float,2>{0.567641914f, 0.783420444f},
-std::array<float,2>{0.637284636f, 0.231983274f},
-std::array<float,2>{0.0960518122f, 0.91056186f},
-std::array<float,2>{0.37696135f, 0.497133732f},
-std::array<float,2>{0.878810704f, 0.637477815f},
-std::array<float,2>{0.561456203f, 0.395585567f},
-std::array<float,2>{0.184609115f, 0.691707015f},
-std::array<float,2>{0.258405685f, 0.182049021f},
-std::array<float,2>{0.783982158f, 0.957197607f},
-std::array<float,2>{0.96953094f, 0.0674818978f},
-std::array<float,2>{0.44837001f, 0.848742306f},
-std::array<float,2>{0.0221773162f, 0.264892787f},
-std::array<float,2>{0.698999703f, 0.564142466f},
-std::array<float,2>{0.960894287f, 0.272443295f},
-std::array<float,2>{0.477201372f, 0.578664899f},
-std::array<float,2>{0.0560155548f, 0.0904768929f},
-std::array<float,2>{0.740470648f, 0.866161168f},
-std::array<float,2>{0.518701851f, 0.15908359f},
-std::array<float,2>{0.132493481f, 0.941212475f},
-std::array<float,2>{0.287174404f, 0.383910388f},
-std::array<float,2>{0.772312164f, 0.70620507f},
-std::array<float,2>{0.682596385f, 0.479553729f},
-std::array<float,2>{0.0924113914f, 0.64677155f},
-std::array<float,2>{0.433809757f, 0.235495642f},
-std::array<float,2>{0.910042048f, 0.924564481f},
-std::array<float,2>{0.846222281f, 0.0334918983f},
-std::array<float,2>{0.343371183f, 0.811242402f},
-std::array<float,2>{0.239280999f, 0.327391714f},
-std::array<float,2>{0.598768294f, 0.547086716f},
-std::array<float,2>{0.800877452f, 0.434691221f},
-std::array<float,2>{0.271289289f, 0.741555512f},
-std::array<float,2>{0.166988939f, 0.14028798f},
-std::array<float,2>{0.536366224f, 0.97665745f},
-std::array<float,2>{0.717937231f, 0.110769622f},
-std::array<float,2>{0.0082017025f, 0.83974576f},
-std::array<float,2>{0.465583086f, 0.300333291f},
-std::array<float,2>{0.99035114f, 0.604782462f},
-std::array<float,2>{0.590471745f, 0.367542833f},
-std::array<float,2>{0.193311989f, 0.504483044f},
-std::array<float,2>{0.369930506f, 0.0141389975f},
-std::array<float,2>{0.826484263f, 0.755281687f},
-std::array<float,2>{0.905442715f, 0.210974559f},
-std::array<float,2>{0.398972631f, 0.878748357f},
-std::array<float,2>{0.124443397f, 0.454682738f},
-std::array<float,2>{0.646677792f, 0.685319841f},
-std::array<float,2>{0.983577728f, 0.48150745f},
-std::array<float,2>{0.43886134f, 0.643175006f},
-std::array<float,2>{0.027623605f, 0.240266472f},
-std::array<float,2>{0.692461431f, 0.928582311f},
-std::array<float,2>{0.552352548f, 0.0378902256f},
-std::array<float,2>{0.175387084f, 0.806219935f},
-std::array<float,2>{0.25157994f, 0.322193682f},
-std::array<float,2>{0.790808439f, 0.552084029f},
-std::array<float,2>{0.628057301f, 0.268800467f},
-std::array<float,2>{0.102016285f, 0.582522631f},
-std::array<float,2>{0.384221792f, 0.0862221569f},
-std::array<float,2>{0.889471889f, 0.859563768f},
-std::array<float,2>{0.842011809f, 0.160340667f},
-std::array<float,2>{0.349948943f, 0.942637205f},
-std::array<float,2>{0.218465149f, 0.389288008f},
-std::array<float,2>{0.573725998f, 0.710753083f},
-std::array<float,2>{0.757977605f, 0.372620672f},
-std::array<float,2>{0.308780998f, 0.503761768f},
-std::array<float,2>{0.151763856f, 0.00910156593f},
-std::array<float,2>{0.509212196f, 0.753033936f},
-std::array<float,2>{0.733123779f, 0.215006232f},
-std::array<float,2>{0.0452304669f, 0.881259263f},
-std::array<float,2>{0.496243894f, 0.458384275f},
-std::array<float,2>{0.948179066f, 0.680436432f},
-std::array<float,2>{0.613782287f, 0.430873007f},
-std::array<float,2>{0.224972382f, 0.737518966f},
-std::array<float,2>{0.314157575f, 0.136250064f},
-std::array<float,2>{0.874412656f, 0.984256268f},
-std::array<float,2>{0.928546906f, 0.114162281f},
-std::array<float,2>{0.409091085f, 0.840258956f},
-std::array<float,2>{0.0642321259f, 0.303223133f},
-std::array<float,2>{0.656367004f, 0.607385814f},
-std::array<float,2>{0.898199618f, 0.286931276f},
-std::array<float,2>{0.393203646f, 0.612009406f},
-std::array<float,2>{0.116869897f, 0.103828639f},
-std::array<float,2>{0.650350988f, 0.826752543f},
-std::array<float,2>{0.581706762f, 0.152025938f},
-std::array<float,2>{0.198999926f, 0.984833002f},
-std::array<float,2>{0.363101453f, 0.412496656f},
-std::array<float,2>{0.816142559f, 0.725933492f},
-std::array<float,2>{0.71030122f, 0.447008491f},
-std::array<float,2>{7.10990571e-05f, 0.665073335f},
-std::array<float,2>{0.453737289f, 0.189390838f},
-std::array<float,2>{0.995355606f, 0.89104563f},
-std::array<float,2>{0.805573285f, 0.0188000202f},
-std::array<float,2>{0.27777496f, 0.778685153f},
-std::array<float,2>{0.161179766f, 0.347595572f},
-std::array<float,2>{0.540976286f, 0.52514708f},
-std::array<float,2>{0.853661776f, 0.393297881f},
-std::array<float,2>{0.328743935f, 0.687513888f},
-std::array<float,2>{0.247441366f, 0.184313312f},
-std::array<float,2>{0.607046068f, 0.955381513f},
-std::array<float,2>{0.67848748f, 0.0640065372f},
-std::array<float,2>{0.0824336857f, 0.846119344f},
-std::array<float,2>{0.428088605f, 0.261074364f},
-std::array<float,2>{0.918357432f, 0.568522692f},
-std::array<float,2>{0.52444613f, 0.335900396f},
-std::array<float,2>{0.13783972f, 0.537628114f},
-std::array<float,2>{0.293396592f, 0.056795612f},
-std::array<float,2>{0.777603269f, 0.788387358f},
-std::array<float,2>{0.961994648f, 0.228185117f},
-std::array<float,2>{0.470653474f, 0.908485711f},
-std::array<float,2>{0.049582649f, 0.494309872f},
-std::array<float,2>{0.747504294f, 0.634458721f},
-std::array<float,2>{0.912595391f, 0.415236086f},
-std::array<float,2>{0.431863338f, 0.732186973f},
-std::array<float,2>{0.0861360729f, 0.143238053f},
-std::array<float,2>{0.685358286f, 0.99888885f},
-std::array<float,2>{0.595975816f, 0.0985499397f},
-std::array<float,2>{0.236786887f, 0.818562567f},
-std::array<float,2>{0.339002341f, 0.290714681f},
-std::array<float,2>{0.850833535f, 0.621032059f},
-std::array<float,2>{0.736448586f, 0.35582003f},
-std::array<float,2>{0.0618744642f, 0.522445977f},
-std::array<float,2>{0.484267026f, 0.0309239049f},
-std::array<float,2>{0.956940293f, 0.773436248f},
-std::array<float,2>{0.766863883f, 0.199634105f},
-std::array<float,2>{0.28400889f, 0.905365586f},
-std::array<float,2>{0.126756757f, 0.441372216f},
-std::array<float,2>{0.522417068f, 0.657364845f},
-std::array<float,2>{0.823243201f, 0.256659955f},
-std::array<float,2>{0.37273857f, 0.573146939f},
-std::array<float,2>{0.188665763f, 0.0745015666f},
-std::array<float,2>{0.58720547f, 0.855830312f},
-std::array<float,2>{0.641386986f, 0.178751975f},
-std::array<float,2>{0.120048873f, 0.965172946f},
-std::array<float,2>{0.404460937f, 0.402366638f},
-std::array<float,2>{0.899641395f, 0.695572019f},
-std::array<float,2>{0.533230066f, 0.484467715f},
-std::array<float,2>{0.170391366f, 0.628405154f},
-std::array<float,2>{0.269125313f, 0.2263785f},
-std::array<float,2>{0.79703176f, 0.92005688f},
-std::array<float,2>{0.986789465f, 0.0534507856f},
-std::array<float,2>{0.461463749f, 0.793304265f},
-std::array<float,2>{0.0120749157f, 0.341040194f},
-std::array<float,2>{0.712350488f, 0.544641912f},
-std::array<float,2>{0.942178905f, 0.31815958f},
-std::array<float,2>{0.490704924f, 0.559903562f},
-std::array<float,2>{0.0355109274f, 0.0431046188f},
-std::array<float,2>{0.722869933f, 0.799558342f},
-std::array<float,2>{0.502426088f, 0.248204768f},
-std::array<float,2>{0.146267802f, 0.934177518f},
-std::array<float,2>{0.303548366f, 0.474555701f},
-std::array<float,2>{0.751213372f, 0.651167631f},
-std::array<float,2>{0.664528012f, 0.37621206f},
-std::array<float,2>{0.0715961605f, 0.716241539f},
-std::array<float,2>{0.416486412f, 0.169469506f},
-std::array<float,2>{0.935339689f, 0.94776684f},
-std::array<float,2>{0.861960411f, 0.0805198848f},
-std::array<float,2>{0.322501034f, 0.870665789f},
-std::array<float,2>{0.227720127f, 0.277341276f},
-std::array<float,2>{0.617451012f, 0.591594577f},
-std::array<float,2>{0.78656131f, 0.463881463f},
-std::array<float,2>{0.262928277f, 0.673911572f},
-std::array<float,2>{0.180611968f, 0.203319773f},
-std::array<float,2>{0.557695448f, 0.885174155f},
-std::array<float,2>{0.702977836f, 0.00407278445f},
-std::array<float,2>{0.0191109423f, 0.762074649f},
-std::array<float,2>{0.451085538f, 0.363016039f},
-std::array<float,2>{0.97273016f, 0.514626205f},
-std::array<float,2>{0.56570226f, 0.311875761f},
-std::array<float,2>{0.206939071f, 0.594540775f},
-std::array<float,2>{0.357518047f, 0.121572144f},
-std::array<float,2>{0.834282517f, 0.831476688f},
-std::array<float,2>{0.878925979f, 0.130599961f},
-std::array<float,2>{0.38022539f, 0.975002825f},
-std::array<float,2>{0.0978679284f, 0.42669335f},
-std::array<float,2>{0.63283962f, 0.749287724f},
-std::array<float,2>{0.958859563f, 0.384649605f},
-std::array<float,2>{0.478726447f, 0.706796467f},
-std::array<float,2>{0.0577066466f, 0.158519924f},
-std::array<float,2>{0.739427805f, 0.94049108f},
-std::array<float,2>{0.517081916f, 0.0902134106f},
-std::array<float,2>{0.129760414f, 0.865580022f},
-std::array<float,2>{0.286599934f, 0.271740049f},
-std::array<float,2>{0.770196736f, 0.578404129f},
-std::array<float,2>{0.681092918f, 0.327951282f},
-std::array<float,2>{0.0909068212f, 0.54748112f},
-std::array<float,2>{0.436679453f, 0.0338630863f},
-std::array<float,2>{0.906541467f, 0.810855925f},
-std::array<float,2>{0.844539583f, 0.236058861f},
-std::array<float,2>{0.340067565f, 0.923924685f},
-std::array<float,2>{0.24067539f, 0.480029523f},
-std::array<float,2>{0.600816131f, 0.647135854f},
-std::array<float,2>{0.803737044f, 0.300277293f},
-std::array<float,2>{0.273236901f, 0.605251431f},
-std::array<float,2>{0.165349841f, 0.111286789f},
-std::array<float,2>{0.539028406f, 0.839019477f},
-std::array<float,2>{0.715067446f, 0.139784887f},
-std::array<float,2>{0.010160109f, 0.977301896f},
-std::array<float,2>{0.468640387f, 0.435275257f},
-std::array<float,2>{0.989081085f, 0.74215734f},
-std::array<float,2>{0.591874838f, 0.45449999f},
-std::array<float,2>{0.193521425f, 0.684692681f},
-std::array<float,2>{0.367253244f, 0.211909309f},
-std::array<float,2>{0.824603736f, 0.877933383f},
-std::array<float,2>{0.90298456f, 0.0144811906f},
-std::array<float,2>{0.401175946f, 0.755502701f},
-std::array<float,2>{0.122474253f, 0.367693692f},
-std::array<float,2>{0.64621067f, 0.504215837f},
-std::array<float,2>{0.933545828f, 0.3477256f},
-std::array<float,2>{0.421029985f, 0.528913975f},
-std::array<float,2>{0.0756575614f, 0.0212234538f},
-std::array<float,2>{0.669135392f, 0.773637652f},
-std::array<float,2>{0.621396065f, 0.193221569f},
-std::array<float,2>{0.232333988f, 0.894965708f},
-std::array<float,2>{0.32789284f, 0.45131734f},
-std::array<float,2>{0.864721358f, 0.670791328f},
-std::array<float,2>{0.719095826f, 0.406701744f},
-std::array<float,2>{0.0322280824f, 0.720739067f},
-std::array<float,2>{0.485901862f, 0.154067189f},
-std::array<float,2>{0.938240707f, 0.989490271f},
-std::array<float,2>{0.754376888f, 0.106683128f},
-std::array<float,2>{0.298698545f, 0.822142005f},
-std::array<float,2>{0.142199799f, 0.283651203f},
-std::array<float,2>{0.507706463f, 0.616080225f},
-std::array<float,2>{0.830971658f, 0.497832477f},
-std::array<float,2>{0.35309127f, 0.636932135f},
-std::array<float,2>{0.21091105f, 0.231930673f},
-std::array<float,2>{0.570138514f, 0.910655081f},
-std::array<float,2>{0.640088499f, 0.0601842031f},
-std::array<float,2>{0.0950412378f, 0.78386724f},
-std::array<float,2>{0.376262337f, 0.331215113f},
-std::array<float,2>{0.875949681f, 0.531532228f},
-std::array<float,2>{0.560526431f, 0.265448391f},
-std::array<float,2>{0.1866f, 0.563785791f},
-std::array<float,2>{0.260708064f, 0.068310447f},
-std::array<float,2>{0.782747149f, 0.849439681f},
-std::array<float,2>{0.971435726f, 0.182518214f},
-std::array<float,2>{0.446996242f, 0.957619071f},
-std::array<float,2>{0.0208069123f, 0.396313816f},
-std::array<float,2>{0.695373774f, 0.692068279f},
-std::array<float,2>{0.884754539f, 0.442754745f},
-std::array<float,2>{0.389003873f, 0.660719573f},
-std::array<float,2>{0.106148638f, 0.197828129f},
-std::array<float,2>{0.629974604f, 0.900462508f},
-std::array<float,2>{0.576853395f, 0.0239108969f},
-std::array<float,2>{0.211429849f, 0.765889525f},
-std::array<float,2>{0.347236603f, 0.352602482f},
-std::array<float,2>{0.837496519f, 0.518856764f},
-std::array<float,2>{0.689253688f, 0.29480806f},
-std::array<float,2>{0.0246684533f, 0.624277174f},
-std::array<float,2>{0.442056179f, 0.0953490138f},
-std::array<float,2>{0.977921069f, 0.815910757f},
-std::array<float,2>{0.794733465f, 0.145464823f},
-std::array<float,2>{0.256541193f, 0.992835283f},
-std::array<float,2>{0.178511128f, 0.41966179f},
-std::array<float,2>{0.54789871f, 0.730269551f},
-std::array<float,2>{0.869030058f, 0.339331478f},
-std::array<float,2>{0.320174664f, 0.541950643f},
-std::array<float,2>{0.222471625f, 0.0488769859f},
-std::array<float,2>{0.612918139f, 0.789123595f},
-std::array<float,2>{0.661266923f, 0.222341135f},
-std::array<float,2>{0.0698934346f, 0.916965961f},
-std::array<float,2>{0.41081363f, 0.490303814f},
-std::array<float,2>{0.921907246f, 0.630186677f},
-std::array<float,2>{0.512813747f, 0.400320411f},
-std::array<float,2>{0.154279575f, 0.700435817f},
-std::array<float,2>{0.307837725f, 0.175325081f},
-std::array<float,2>{0.761855543f, 0.962671757f},
-std::array<float,2>{0.951771259f, 0.0706733465f},
-std::array<float,2>{0.493432969f, 0.85399121f},
-std::array<float,2>{0.0425326079f, 0.250138044f},
-std::array<float,2>{0.728881598f, 0.577808797f},
-std::array<float,2>{0.999969006f, 0.27817595f},
-std::array<float,2>{0.459222645f, 0.586690903f},
-std::array<float,2>{0.00574012008f, 0.0858216435f},
-std::array<float,2>{0.704133272f, 0.874930501f},
-std::array<float,2>{0.544957876f, 0.164096922f},
-std::array<float,2>{0.158045441f, 0.952360213f},
-std::array<float,2>{0.276056796f, 0.381689847f},
-std::array<float,2>{0.81212461f, 0.711018026f},
-std::array<float,2>{0.655448198f, 0.471222311f},
-std::array<float,2>{0.112952702f, 0.655383766f},
-std::array<float,2>{0.395190388f, 0.243364662f},
-std::array<float,2>{0.8922894f, 0.933054328f},
-std::array<float,2>{0.81779182f, 0.0418544151f},
-std::array<float,2>{0.366149187f, 0.802174151f},
-std::array<float,2>{0.200559974f, 0.312755406f},
-std::array<float,2>{0.583023608f, 0.556840897f},
-std::array<float,2>{0.777263582f, 0.42577523f},
-std::array<float,2>{0.292393982f, 0.745309472f},
-std::array<float,2>{0.134633988f, 0.127890855f},
-std::array<float,2>{0.527365267f, 0.969259799f},
-std::array<float,2>{0.744791687f, 0.118778333f},
-std::array<float,2>{0.0510213152f, 0.835112751f},
-std::array<float,2>{0.476169407f, 0.306968004f},
-std::array<float,2>{0.966084898f, 0.600772619f},
-std::array<float,2>{0.60430032f, 0.366339803f},
-std::array<float,2>{0.242978454f, 0.511083245f},
-std::array<float,2>{0.334835827f, 0.00257599098f},
-std::array<float,2>{0.856950462f, 0.759246826f},
-std::array<float,2>{0.9146173f, 0.209323019f},
-std::array<float,2>{0.422044754f, 0.886794269f},
-std::array<float,2>{0.0817758888f, 0.466688037f},
-std::array<float,2>{0.673856616f, 0.678698421f},
-std::array<float,2>{0.94578135f, 0.460915804f},
-std::array<float,2>{0.499215037f, 0.682227969f},
-std::array<float,2>{0.0437496863f, 0.217127129f},
-std::array<float,2>{0.730879724f, 0.880754352f},
-std::array<float,2>{0.510275424f, 0.0115009751f},
-std::array<float,2>{0.150375247f, 0.750985324f},
-std::array<float,2>{0.312175959f, 0.373770237f},
-std::array<float,2>{0.759893835f, 0.501566291f},
-std::array<float,2>{0.658816874f, 0.300926328f},
-std::array<float,2>{0.0652297065f, 0.609162033f},
-std::array<float,2>{0.407907695f, 0.115552232f},
-std::array<float,2>{0.927545846f, 0.84372288f},
-std::array<float,2>{0.871877134f, 0.13451831f},
-std::array<float,2>{0.31608054f, 0.981145859f},
-std::array<float,2>{0.223633021f, 0.432303905f},
-std::array<float,2>{0.615762174f, 0.73573029f},
-std::array<float,2>{0.791354239f, 0.323346138f},
-std::array<float,2>{0.253317267f, 0.554661691f},
-std::array<float,2>{0.172409102f, 0.0367053412f},
-std::array<float,2>{0.554662645f, 0.806770623f},
-std::array<float,2>{0.694311738f, 0.239771619f},
-std::array<float,2>{0.0293909162f, 0.927609622f},
-std::array<float,2>{0.440501571f, 0.482440472f},
-std::array<float,2>{0.981763065f, 0.640778005f},
-std::array<float,2>{0.571746349f, 0.38777414f},
-std::array<float,2>{0.215377524f, 0.707595289f},
-std::array<float,2>{0.349533409f, 0.163401842f},
-std::array<float,2>{0.840581059f, 0.945266128f},
-std::array<float,2>{0.888074398f, 0.0896432847f},
-std::array<float,2>{0.386549562f, 0.86135155f},
-std::array<float,2>{0.103757128f, 0.26709047f},
-std::array<float,2>{0.625058711f, 0.584758461f},
-std::array<float,2>{0.921563804f, 0.258437812f},
-std::array<float,2>{0.427184254f, 0.568345964f},
-std::array<float,2>{0.0845720544f, 0.0664028004f},
-std::array<float,2>{0.676528454f, 0.845356703f},
-std::array<float,2>{0.609042406f, 0.186983153f},
-std::array<float,2>{0.249342799f, 0.954361081f},
-std::array<float,2>{0.330110103f, 0.391122758f},
-std::array<float,2>{0.852576196f, 0.691093743f},
-std::array<float,2>{0.749915421f, 0.493920684f},
-std::array<float,2>{0.0482583791f, 0.635456324f},
-std::array<float,2>{0.472357899f, 0.229247257f},
-std::array<float,2>{0.96290344f, 0.906883836f},
-std::array<float,2>{0.780456126f, 0.0555417836f},
-std::array<float,2>{0.296683162f, 0.786312401f},
-std::array<float,2>{0.140308484f, 0.33289367f},
-std::array<float,2>{0.527183354f, 0.535244167f},
-std::array<float,2>{0.813278377f, 0.410884082f},
-std::array<float,2>{0.359933287f, 0.723084867f},
-std::array<float,2>{0.196699262f, 0.149258181f},
-std::array<float,2>{0.578364849f, 0.987480879f},
-std::array<float,2>{0.650922418f, 0.101598844f},
-std::array<float,2>{0.114921831f, 0.82542032f},
-std::array<float,2>{0.390821725f, 0.288749725f},
-std::array<float,2>{0.896440446f, 0.609524131f},
-std::array<float,2>{0.542853832f, 0.345124781f},
-std::array<float,2>{0.162974611f, 0.526341379f},
-std::array<float,2>{0.280361593f, 0.0168977771f},
-std::array<float,2>{0.808130443f, 0.779824972f},
-std::array<float,2>{0.994125068f, 0.190415904f},
-std::array<float,2>{0.456531167f, 0.894151211f},
-std::array<float,2>{0.00341681205f, 0.448000729f},
-std::array<float,2>{0.707432687f, 0.666465461f},
-std::array<float,2>{0.901539087f, 0.404654324f},
-std::array<float,2>{0.402781457f, 0.698722661f},
-std::array<float,2>{0.118117005f, 0.176660717f},
-std::array<float,2>{0.643961966f, 0.967516959f},
-std::array<float,2>{0.589248538f, 0.0763341486f},
-std::array<float,2>{0.190626338f, 0.85747838f},
-std::array<float,2>{0.373195916f, 0.254137635f},
-std::array<float,2>{0.820432842f, 0.571871579f},
-std::array<float,2>{0.713743925f, 0.34222126f},
-std::array<float,2>{0.0154578937f, 0.545643568f},
-std::array<float,2>{0.463290781f, 0.051169496f},
-std::array<float,2>{0.984609902f, 0.795149326f},
-std::array<float,2>{0.800209224f, 0.224472359f},
-std::array<float,2>{0.267042726f, 0.917975128f},
-std::array<float,2>{0.169632003f, 0.487377375f},
-std::array<float,2>{0.531724751f, 0.625813663f},
-std::array<float,2>{0.849363983f, 0.291514635f},
-std::array<float,2>{0.336595148f, 0.618555725f},
-std::array<float,2>{0.23519066f, 0.101519436f},
-std::array<float,2>{0.595096529f, 0.817865968f},
-std::array<float,2>{0.687361717f, 0.141713977f},
-std::array<float,2>{0.0893699229f, 0.996676207f},
-std::array<float,2>{0.430647731f, 0.416053832f},
-std::array<float,2>{0.911444187f, 0.733466804f},
-std::array<float,2>{0.520687103f, 0.438676536f},
-std::array<float,2>{0.12825866f, 0.658490181f},
-std::array<float,2>{0.282724202f, 0.201636374f},
-std::array<float,2>{0.768539369f, 0.90278101f},
-std::array<float,2>{0.954608619f, 0.0290572438f},
-std::array<float,2>{0.480907321f, 0.770571232f},
-std::array<float,2>{0.0597674884f, 0.357537061f},
-std::array<float,2>{0.735134721f, 0.52071321f},
-std::array<float,2>{0.975105822f, 0.36102742f},
-std::array<float,2>{0.452023536f, 0.513209701f},
-std::array<float,2>{0.0170413107f, 0.00772756897f},
-std::array<float,2>{0.70064342f, 0.764449596f},
-std::array<float,2>{0.555712759f, 0.206642672f},
-std::array<float,2>{0.181807011f, 0.884607911f},
-std::array<float,2>{0.263878852f, 0.46171993f},
-std::array<float,2>{0.787947357f, 0.673769116f},
-std::array<float,2>{0.635054827f, 0.428822488f},
-std::array<float,2>{0.0998779088f, 0.746809721f},
-std::array<float,2>{0.382728726f, 0.130936146f},
-std::array<float,2>{0.88132894f, 0.973334491f},
-std::array<float,2>{0.832414865f, 0.12461938f},
-std::array<float,2>{0.35580647f, 0.828494072f},
-std::array<float,2>{0.203861266f, 0.309157312f},
-std::array<float,2>{0.563514709f, 0.595790863f},
-std::array<float,2>{0.753552496f, 0.475994557f},
-std::array<float,2>{0.30236268f, 0.649664283f},
-std::array<float,2>{0.146642864f, 0.246293485f},
-std::array<float,2>{0.500531852f, 0.935812116f},
-std::array<float,2>{0.725857139f, 0.0456902757f},
-std::array<float,2>{0.0386543162f, 0.797281086f},
-std::array<float,2>{0.489643484f, 0.319263101f},
-std::array<float,2>{0.944737732f, 0.561118722f},
-std::array<float,2>{0.619277298f, 0.274870187f},
-std::array<float,2>{0.230050698f, 0.592731416f},
-std::array<float,2>{0.320971608f, 0.0783998445f},
-std::array<float,2>{0.860876024f, 0.868347049f},
-std::array<float,2>{0.936449468f, 0.17131415f},
-std::array<float,2>{0.41407156f, 0.947208703f},
-std::array<float,2>{0.0742162392f, 0.378714025f},
-std::array<float,2>{0.667101324f, 0.717496514f},
-std::array<float,2>{0.991030931f, 0.4366301f},
-std::array<float,2>{0.465134859f, 0.739712f},
-std::array<float,2>{0.00851850677f, 0.136993602f},
-std::array<float,2>{0.718351007f, 0.98016721f},
-std::array<float,2>{0.536868215f, 0.112448782f},
-std::array<float,2>{0.166431874f, 0.836998761f},
-std::array<float,2>{0.270756274f, 0.298713475f},
-std::array<float,2>{0.80143857f, 0.603037536f},
-std::array<float,2>{0.647280037f, 0.37011686f},
-std::array<float,2>{0.124719732f, 0.506873488f},
-std::array<float,2>{0.398671985f, 0.0131696984f},
-std::array<float,2>{0.906113565f, 0.756402493f},
-std::array<float,2>{0.826743543f, 0.212918639f},
-std::array<float,2>{0.369370162f, 0.875989914f},
-std::array<float,2>{0.192438275f, 0.455758065f},
-std::array<float,2>{0.59008342f, 0.685860574f},
-std::array<float,2>{0.771716833f, 0.270321608f},
-std::array<float,2>{0.287724704f, 0.581097007f},
-std::array<float,2>{0.131904989f, 0.0924809501f},
-std::array<float,2>{0.519528985f, 0.864906013f},
-std::array<float,2>{0.740993798f, 0.156693101f},
-std::array<float,2>{0.0563399829f, 0.937745512f},
-std::array<float,2>{0.477027416f, 0.385204762f},
-std::array<float,2>{0.960407078f, 0.704675555f},
-std::array<float,2>{0.599511743f, 0.477788895f},
-std::array<float,2>{0.240055457f, 0.64496094f},
-std::array<float,2>{0.343235344f, 0.237148046f},
-std::array<float,2>{0.846151054f, 0.923383534f},
-std::array<float,2>{0.90939343f, 0.0313324481f},
-std::array<float,2>{0.434435964f, 0.809723258f},
-std::array<float,2>{0.091950193f, 0.325986773f},
-std::array<float,2>{0.681689978f, 0.550708652f},
-std::array<float,2>{0.878300488f, 0.329953492f},
-std::array<float,2>{0.377592444f, 0.534673512f},
-std::array<float,2>{0.096424453f, 0.0616664439f},
-std::array<float,2>{0.636947811f, 0.782129824f},
-std::array<float,2>{0.568006694f, 0.233176127f},
-std::array<float,2>{0.208643764f, 0.912795067f},
-std::array<float,2>{0.354925454f, 0.499173522f},
-std::array<float,2>{0.829918981f, 0.639842927f},
-std::array<float,2>{0.698558927f, 0.397619992f},
-std::array<float,2>{0.0216338933f, 0.69470644f},
-std::array<float,2>{0.449028313f, 0.180083573f},
-std::array<float,2>{0.968838334f, 0.95968914f},
-std::array<float,2>{0.783495486f, 0.0696298257f},
-std::array<float,2>{0.257977962f, 0.850130081f},
-std::array<float,2>{0.185543537f, 0.262237579f},
-std::array<float,2>{0.560822427f, 0.566121757f},
-std::array<float,2>{0.865252256f, 0.450365543f},
-std::array<float,2>{0.325181127f, 0.669618487f},
-std::array<float,2>{0.232506156f, 0.194882184f},
-std::array<float,2>{0.623898268f, 0.898228347f},
-std::array<float,2>{0.670958936f, 0.0226945933f},
-std::array<float,2>{0.0773338974f, 0.77692163f},
-std::array<float,2>{0.418350786f, 0.349865973f},
-std::array<float,2>{0.931253552f, 0.530297279f},
-std::array<float,2>{0.504326999f, 0.282743841f},
-std::array<float,2>{0.142719463f, 0.61358875f},
-std::array<float,2>{0.299160659f, 0.108556129f},
-std::array<float,2>{0.75696516f, 0.822328925f},
-std::array<float,2>{0.940324545f, 0.156109273f},
-std::array<float,2>{0.486400247f, 0.991721034f},
-std::array<float,2>{0.034825135f, 0.409543127f},
-std::array<float,2>{0.722510159f, 0.720458806f},
-std::array<float,2>{0.924725056f, 0.489677221f},
-std::array<float,2>{0.413935989f, 0.631892562f},
-std::array<float,2>{0.0674945787f, 0.219621226f},
-std::array<float,2>{0.663894057f, 0.915436506f},
-std::array<float,2>{0.611067891f, 0.046910964f},
-std::array<float,2>{0.219633505f, 0.792158067f},
-std::array<float,2>{0.317313075f, 0.336654425f},
-std::array<float,2>{0.870824218f, 0.540984511f},
-std::array<float,2>{0.728239834f, 0.252639145f},
-std::array<float,2>{0.040718995f, 0.575704694f},
-std::array<float,2>{0.494439095f, 0.0727037191f},
-std::array<float,2>{0.949343383f, 0.853045344f},
-std::array<float,2>{0.764056265f, 0.171892732f},
-std::array<float,2>{0.306003839f, 0.962955475f},
-std::array<float,2>{0.156068832f, 0.401485115f},
-std::array<float,2>{0.514325559f, 0.701183736f},
-std::array<float,2>{0.838390589f, 0.354339629f},
-std::array<float,2>{0.34478122f, 0.51679492f},
-std::array<float,2>{0.213133961f, 0.0267870091f},
-std::array<float,2>{0.575550199f, 0.768426061f},
-std::array<float,2>{0.631179154f, 0.195453569f},
-std::array<float,2>{0.108490497f, 0.900178254f},
-std::array<float,2>{0.387602001f, 0.444396257f},
-std::array<float,2>{0.886021018f, 0.66281265f},
-std::array<float,2>{0.549601853f, 0.42144838f},
-std::array<float,2>{0.1765659f, 0.727734149f},
-std::array<float,2>{0.254178375f, 0.146866366f},
-std::array<float,2>{0.795332074f, 0.99428606f},
-std::array<float,2>{0.979648829f, 0.0971588567f},
-std::array<float,2>{0.443728536f, 0.813308179f},
-std::array<float,2>{0.0272655096f, 0.296402901f},
-std::array<float,2>{0.689587474f, 0.621644914f},
-std::array<float,2>{0.967097282f, 0.306075543f},
-std::array<float,2>{0.473020107f, 0.597815931f},
-std::array<float,2>{0.0538186654f, 0.119588792f},
-std::array<float,2>{0.7426247f, 0.833433867f},
-std::array<float,2>{0.530902922f, 0.126161382f},
-std::array<float,2>{0.13597551f, 0.970771432f},
-std::array<float,2>{0.29071033f, 0.423546314f},
-std::array<float,2>{0.773743451f, 0.742581427f},
-std::array<float,2>{0.673664391f, 0.468054295f},
-std::array<float,2>{0.0791097283f, 0.676709592f},
-std::array<float,2>{0.424440682f, 0.207949832f},
-std::array<float,2>{0.917547405f, 0.89040643f},
-std::array<float,2>{0.858500719f, 0.00187522464f},
-std::array<float,2>{0.333514243f, 0.761482894f},
-std::array<float,2>{0.245203197f, 0.364341021f},
-std::array<float,2>{0.603092432f, 0.509344578f},
-std::array<float,2>{0.808743477f, 0.380084008f},
-std::array<float,2>{0.273855895f, 0.713864267f},
-std::array<float,2>{0.159968659f, 0.1670724f},
-std::array<float,2>{0.544697106f, 0.949764669f},
-std::array<float,2>{0.706976414f, 0.0830409452f},
-std::array<float,2>{0.00593506685f, 0.871676266f},
-std::array<float,2>{0.458411187f, 0.279673457f},
-std::array<float,2>{0.997399032f, 0.588929296f},
-std::array<float,2>{0.584866464f, 0.315147758f},
-std::array<float,2>{0.201452896f, 0.55530858f},
-std::array<float,2>{0.364795357f, 0.0396421477f},
-std::array<float,2>{0.819911659f, 0.804632723f},
-std::array<float,2>{0.894100487f, 0.244308189f},
-std::array<float,2>{0.39755252f, 0.930611551f},
-std::array<float,2>{0.10940209f, 0.470022589f},
-std::array<float,2>{0.653730452f, 0.653556824f},
-std::array<float,2>{0.994696677f, 0.448570997f},
-std::array<float,2>{0.454220861f, 0.66732955f},
-std::array<float,2>{0.000985530321f, 0.191098809f},
-std::array<float,2>{0.709927797f, 0.892914891f},
-std::array<float,2>{0.53943336f, 0.0164373126f},
-std::array<float,2>{0.160266921f, 0.780382752f},
-std::array<float,2>{0.278692454f, 0.344552994f},
-std::array<float,2>{0.806134522f, 0.526969373f},
-std::array<float,2>{0.649119675f, 0.288039982f},
-std::array<float,2>{0.115523897f, 0.610833347f},
-std::array<float,2>{0.393730611f, 0.103202909f},
-std::array<float,2>{0.897176921f, 0.824920893f},
-std::array<float,2>{0.815111101f, 0.150096714f},
-std::array<float,2>{0.361477435f, 0.986418605f},
-std::array<float,2>{0.197664857f, 0.411768675f},
-std::array<float,2>{0.580596149f, 0.724309266f},
-std::array<float,2>{0.778631568f, 0.333269149f},
-std::array<float,2>{0.294902354f, 0.536480129f},
-std::array<float,2>{0.136932001f, 0.0564887188f},
-std::array<float,2>{0.523761928f, 0.785260081f},
-std::array<float,2>{0.746563435f, 0.230424136f},
-std::array<float,2>{0.0502343513f, 0.907381237f},
-std::array<float,2>{0.469390094f, 0.492395312f},
-std::array<float,2>{0.961269975f, 0.636136651f},
-std::array<float,2>{0.605480611f, 0.391819298f},
-std::array<float,2>{0.246420234f, 0.69037354f},
-std::array<float,2>{0.329898715f, 0.186244294f},
-std::array<float,2>{0.854605496f, 0.953956366f},
-std::array<float,2>{0.919160247f, 0.0648736209f},
-std::array<float,2>{0.429145634f, 0.844015837f},
-std::array<float,2>{0.0832718685f, 0.258990169f},
-std::array<float,2>{0.678876758f, 0.566650331f},
-std::array<float,2>{0.890223622f, 0.265684277f},
-std::array<float,2>{0.382995784f, 0.585235655f},
-std::array<float,2>{0.103423454f, 0.0883656517f},
-std::array<float,2>{0.626982212f, 0.862465322f},
-std::array<float,2>{0.572353005f, 0.162309349f},
-std::array<float,2>{0.21688886f, 0.94411242f},
-std::array<float,2>{0.351249039f, 0.387632549f},
-std::array<float,2>{0.842942715f, 0.708683372f},
-std::array<float,2>{0.691712797f, 0.483653575f},
-std::array<float,2>{0.0288056228f, 0.642008543f},
-std::array<float,2>{0.437589735f, 0.238480672f},
-std::array<float,2>{0.982543766f, 0.926578045f},
-std::array<float,2>{0.78978163f, 0.0354951955f},
-std::array<float,2>{0.250380188f, 0.808344126f},
-std::array<float,2>{0.17447114f, 0.322694898f},
-std::array<float,2>{0.551665604f, 0.552766144f},
-std::array<float,2>{0.873984039f, 0.432746202f},
-std::array<float,2>{0.312593162f, 0.734730959f},
-std::array<float,2>{0.225855619f, 0.133607894f},
-std::array<float,2>{0.614743233f, 0.982112825f},
-std::array<float,2>{0.657695293f, 0.116896592f},
-std::array<float,2>{0.0633731708f, 0.842004597f},
-std::array<float,2>{0.409440428f, 0.302280694f},
-std::array<float,2>{0.928845704f, 0.607777119f},
-std::array<float,2>{0.508295119f, 0.374590158f},
-std::array<float,2>{0.151326805f, 0.500731051f},
-std::array<float,2>{0.310433149f, 0.0100599267f},
-std::array<float,2>{0.759665549f, 0.750041604f},
-std::array<float,2>{0.948379278f, 0.218186349f},
-std::array<float,2>{0.497611284f, 0.879317224f},
-std::array<float,2>{0.0461521558f, 0.459763467f},
-std::array<float,2>{0.733987629f, 0.683152199f},
-std::array<float,2>{0.934455276f, 0.377490312f},
-std::array<float,2>{0.417800069f, 0.718302727f},
-std::array<float,2>{0.0710379854f, 0.170019835f},
-std::array<float,2>{0.665290475f, 0.946038067f},
-std::array<float,2>{0.618785262f, 0.080004476f},
-std::array<float,2>{0.226759121f, 0.868056834f},
-std::array<float,2>{0.32328397f, 0.273804963f},
-std::array<float,2>{0.863205194f, 0.593248785f},
-std::array<float,2>{0.723948002f, 0.320053995f},
-std::array<float,2>{0.036453601f, 0.56156826f},
-std::array<float,2>{0.491529047f, 0.046097897f},
-std::array<float,2>{0.94287467f, 0.798583746f},
-std::array<float,2>{0.750793457f, 0.247573718f},
-std::array<float,2>{0.304244369f, 0.93689692f},
-std::array<float,2>{0.145239815f, 0.474827528f},
-std::array<float,2>{0.503404379f, 0.648597896f},
-std::array<float,2>{0.835526824f, 0.310217083f},
-std::array<float,2>{0.358839124f, 0.596691966f},
-std::array<float,2>{0.205782041f, 0.123323686f},
-std::array<float,2>{0.56526798f, 0.829800844f},
-std::array<float,2>{0.63414824f, 0.132525265f},
-std::array<float,2>{0.0995220244f, 0.974577665f},
-std::array<float,2>{0.379296988f, 0.42847538f},
-std::array<float,2>{0.88067311f, 0.747823477f},
-std::array<float,2>{0.557110369f, 0.46218577f},
-std::array<float,2>{0.181394741f, 0.672540665f},
-std::array<float,2>{0.262160778f, 0.206001341f},
-std::array<float,2>{0.785580099f, 0.88322556f},
-std::array<float,2>{0.973947823f, 0.00639035646f},
-std::array<float,2>{0.449237496f, 0.765204012f},
-std::array<float,2>{0.0177557897f, 0.359910458f},
-std::array<float,2>{0.70158273f, 0.51219964f},
-std::array<float,2>{0.955364048f, 0.359021395f},
-std::array<float,2>{0.483033806f, 0.520338118f},
-std::array<float,2>{0.061350625f, 0.0273538455f},
-std::array<float,2>{0.738153756f, 0.770211279f},
-std::array<float,2>{0.523245037f, 0.202464521f},
-std::array<float,2>{0.12505655f, 0.903549671f},
-std::array<float,2>{0.284401029f, 0.438380003f},
-std::array<float,2>{0.766254187f, 0.659917176f},
-std::array<float,2>{0.683764637f, 0.417115182f},
-std::array<float,2>{0.0873305127f, 0.732928455f},
-std::array<float,2>{0.43344599f, 0.14071618f},
-std::array<float,2>{0.913461268f, 0.997264743f},
-std::array<float,2>{0.850233376f, 0.100496545f},
-std::array<float,2>{0.337957829f, 0.817305684f},
-std::array<float,2>{0.23740615f, 0.292342484f},
-std::array<float,2>{0.597216785f, 0.61795193f},
-std::array<float,2>{0.798655212f, 0.486653179f},
-std::array<float,2>{0.267590135f, 0.626557231f},
-std::array<float,2>{0.171425626f, 0.223543867f},
-std::array<float,2>{0.534198403f, 0.919676542f},
-std::array<float,2>{0.710947037f, 0.0525056832f},
-std::array<float,2>{0.0131090311f, 0.796416163f},
-std::array<float,2>{0.462088346f, 0.34310478f},
-std::array<float,2>{0.987444043f, 0.546401918f},
-std::array<float,2>{0.586863756f, 0.254902184f},
-std::array<float,2>{0.187986419f, 0.571204662f},
-std::array<float,2>{0.371478587f, 0.0780446827f},
-std::array<float,2>{0.823149323f, 0.858831406f},
-std::array<float,2>{0.898850501f, 0.17721051f},
-std::array<float,2>{0.405628949f, 0.968295515f},
-std::array<float,2>{0.120599575f, 0.406130284f},
-std::array<float,2>{0.642494202f, 0.698183477f},
-std::array<float,2>{0.939259231f, 0.408800483f},
-std::array<float,2>{0.485009998f, 0.719384968f},
-std::array<float,2>{0.0315473452f, 0.155242935f},
-std::array<float,2>{0.720032752f, 0.990247667f},
-std::array<float,2>{0.506187439f, 0.107513309f},
-std::array<float,2>{0.140865356f, 0.823475361f},
-std::array<float,2>{0.297735572f, 0.281893581f},
-std::array<float,2>{0.755485058f, 0.614982009f},
-std::array<float,2>{0.66844511f, 0.35137099f},
-std::array<float,2>{0.0751609504f, 0.529770792f},
-std::array<float,2>{0.419934601f, 0.0223966967f},
-std::array<float,2>{0.932239592f, 0.776272714f},
-std::array<float,2>{0.864057064f, 0.193686694f},
-std::array<float,2>{0.327057809f, 0.897064805f},
-std::array<float,2>{0.231035262f, 0.449299812f},
-std::array<float,2>{0.622172236f, 0.667973161f},
-std::array<float,2>{0.781481981f, 0.262699783f},
-std::array<float,2>{0.261589736f, 0.565233409f},
-std::array<float,2>{0.186147466f, 0.0693272203f},
-std::array<float,2>{0.559229255f, 0.851468384f},
-std::array<float,2>{0.696462095f, 0.180848196f},
-std::array<float,2>{0.0202542674f, 0.960181057f},
-std::array<float,2>{0.445686609f, 0.396886677f},
-std::array<float,2>{0.972208798f, 0.693495929f},
-std::array<float,2>{0.568955302f, 0.498669803f},
-std::array<float,2>{0.209084839f, 0.639643729f},
-std::array<float,2>{0.352227449f, 0.233626589f},
-std::array<float,2>{0.831324756f, 0.913786769f},
-std::array<float,2>{0.87648344f, 0.0611226149f},
-std::array<float,2>{0.375411361f, 0.782761276f},
-std::array<float,2>{0.094444029f, 0.328708768f},
-std::array<float,2>{0.639482975f, 0.533250988f},
-std::array<float,2>{0.907559276f, 0.324473619f},
-std::array<float,2>{0.435835332f, 0.549207151f},
-std::array<float,2>{0.0907834321f, 0.0322482809f},
-std::array<float,2>{0.680632472f, 0.80885762f},
-std::array<float,2>{0.599731028f, 0.238142923f},
-std::array<float,2>{0.241805807f, 0.92218703f},
-std::array<float,2>{0.341377378f, 0.476946712f},
-std::array<float,2>{0.844929457f, 0.646217942f},
-std::array<float,2>{0.738924623f, 0.386703193f},
-std::array<float,2>{0.0574176237f, 0.703639448f},
-std::array<float,2>{0.480079234f, 0.157644957f},
-std::array<float,2>{0.957072556f, 0.939281344f},
-std::array<float,2>{0.770653903f, 0.0937096924f},
-std::array<float,2>{0.285506457f, 0.863548279f},
-std::array<float,2>{0.130291924f, 0.270570576f},
-std::array<float,2>{0.515836179f, 0.580992281f},
-std::array<float,2>{0.825940073f, 0.456525743f},
-std::array<float,2>{0.368766159f, 0.687438726f},
-std::array<float,2>{0.195203543f, 0.214423314f},
-std::array<float,2>{0.592956841f, 0.875219882f},
-std::array<float,2>{0.64476192f, 0.0118763978f},
-std::array<float,2>{0.1219429f, 0.7570858f},
-std::array<float,2>{0.401645184f, 0.370666742f},
-std::array<float,2>{0.904270768f, 0.50666827f},
-std::array<float,2>{0.537610173f, 0.297143489f},
-std::array<float,2>{0.164451003f, 0.601608455f},
-std::array<float,2>{0.272336334f, 0.111947477f},
-std::array<float,2>{0.802898347f, 0.836551249f},
-std::array<float,2>{0.989980102f, 0.138431147f},
-std::array<float,2>{0.467121392f, 0.978889823f},
-std::array<float,2>{0.0114850132f, 0.4362019f},
-std::array<float,2>{0.71589756f, 0.739206195f},
-std::array<float,2>{0.891187429f, 0.469281614f},
-std::array<float,2>{0.395942569f, 0.652642012f},
-std::array<float,2>{0.111442693f, 0.245381311f},
-std::array<float,2>{0.654602647f, 0.930906475f},
-std::array<float,2>{0.582168877f, 0.0406163447f},
-std::array<float,2>{0.200154707f, 0.803412676f},
-std::array<float,2>{0.366487473f, 0.316251785f},
-std::array<float,2>{0.816845715f, 0.556492984f},
-std::array<float,2>{0.703500032f, 0.281065702f},
-std::array<float,2>{0.00429400662f, 0.588736475f},
-std::array<float,2>{0.460722476f, 0.0822851658f},
-std::array<float,2>{0.998619437f, 0.872696817f},
-std::array<float,2>{0.810564995f, 0.166892514f},
-std::array<float,2>{0.276725262f, 0.951015115f},
-std::array<float,2>{0.157053873f, 0.379456878f},
-std::array<float,2>{0.546357751f, 0.713897407f},
-std::array<float,2>{0.856122673f, 0.36376074f},
-std::array<float,2>{0.335834682f, 0.507856965f},
-std::array<float,2>{0.243203223f, 0.00094822055f},
-std::array<float,2>{0.604911566f, 0.76044035f},
-std::array<float,2>{0.675145447f, 0.208347991f},
-std::array<float,2>{0.080328472f, 0.889370739f},
-std::array<float,2>{0.423595965f, 0.466872603f},
-std::array<float,2>{0.915121675f, 0.67726016f},
-std::array<float,2>{0.52895838f, 0.422122777f},
-std::array<float,2>{0.133417517f, 0.743756473f},
-std::array<float,2>{0.291813701f, 0.125688389f},
-std::array<float,2>{0.775409162f, 0.972237051f},
-std::array<float,2>{0.965016901f, 0.120655678f},
-std::array<float,2>{0.475240737f, 0.832049191f},
-std::array<float,2>{0.0519807786f, 0.305587769f},
-std::array<float,2>{0.745236933f, 0.598724842f},
-std::array<float,2>{0.977507353f, 0.295895696f},
-std::array<float,2>{0.443276197f, 0.622674406f},
-std::array<float,2>{0.0240368526f, 0.0965056047f},
-std::array<float,2>{0.687720895f, 0.814331651f},
-std::array<float,2>{0.547147334f, 0.147927746f},
-std::array<float,2>{0.17914021f, 0.9954198f},
-std::array<float,2>{0.257726729f, 0.420324117f},
-std::array<float,2>{0.793334544f, 0.727228522f},
-std::array<float,2>{0.62946409f, 0.443517029f},
-std::array<float,2>{0.107084453f, 0.663830757f},
-std::array<float,2>{0.390057027f, 0.196579531f},
-std::array<float,2>{0.883052409f, 0.899148226f},
-std::array<float,2>{0.836294472f, 0.0255681146f},
-std::array<float,2>{0.346140712f, 0.768989861f},
-std::array<float,2>{0.211969301f, 0.355180323f},
-std::array<float,2>{0.577967882f, 0.516385853f},
-std::array<float,2>{0.762698352f, 0.400887758f},
-std::array<float,2>{0.307169467f, 0.702538252f},
-std::array<float,2>{0.153022036f, 0.173239872f},
-std::array<float,2>{0.512512505f, 0.963950157f},
-std::array<float,2>{0.730256379f, 0.0736047179f},
-std::array<float,2>{0.0412023775f, 0.852494419f},
-std::array<float,2>{0.492719024f, 0.253724515f},
-std::array<float,2>{0.952691972f, 0.574344158f},
-std::array<float,2>{0.61206764f, 0.33694914f},
-std::array<float,2>{0.221073642f, 0.539541781f},
-std::array<float,2>{0.319288611f, 0.0479892939f},
-std::array<float,2>{0.867987514f, 0.791385233f},
-std::array<float,2>{0.922935605f, 0.219857097f},
-std::array<float,2>{0.411477119f, 0.91456455f},
-std::array<float,2>{0.0692919642f, 0.488372564f},
-std::array<float,2>{0.660708964f, 0.631219208f},
-std::array<float,2>{0.963986039f, 0.495979458f},
-std::array<float,2>{0.471039802f, 0.63363415f},
-std::array<float,2>{0.0475215502f, 0.226690516f},
-std::array<float,2>{0.748739004f, 0.909678221f},
-std::array<float,2>{0.525462985f, 0.058062274f},
-std::array<float,2>{0.139277071f, 0.788055182f},
-std::array<float,2>{0.295177013f, 0.334565431f},
-std::array<float,2>{0.779631495f, 0.538957179f},
-std::array<float,2>{0.676833212f, 0.260307252f},
-std::array<float,2>{0.0850080028f, 0.569441497f},
-std::array<float,2>{0.426458836f, 0.063350223f},
-std::array<float,2>{0.920332372f, 0.847201049f},
-std::array<float,2>{0.851690829f, 0.185082287f},
-std::array<float,2>{0.331209987f, 0.956166267f},
-std::array<float,2>{0.248246729f, 0.393728644f},
-std::array<float,2>{0.607710183f, 0.688873172f},
-std::array<float,2>{0.807127059f, 0.345775038f},
-std::array<float,2>{0.280142725f, 0.524069428f},
-std::array<float,2>{0.163805798f, 0.0177444443f},
-std::array<float,2>{0.541887283f, 0.778008223f},
-std::array<float,2>{0.708602369f, 0.187958285f},
-std::array<float,2>{0.00260066753f, 0.892194271f},
-std::array<float,2>{0.455197304f, 0.446132034f},
-std::array<float,2>{0.992688596f, 0.664298534f},
-std::array<float,2>{0.579918981f, 0.4138785f},
-std::array<float,2>{0.195826292f, 0.725426733f},
-std::array<float,2>{0.361121774f, 0.150950104f},
-std::array<float,2>{0.814322114f, 0.985988855f},
-std::array<float,2>{0.895488799f, 0.105178215f},
-std::array<float,2>{0.39163965f, 0.827714205f},
-std::array<float,2>{0.113585681f, 0.285790622f},
-std::array<float,2>{0.651461661f, 0.613024235f},
-std::array<float,2>{0.926163435f, 0.303795129f},
-std::array<float,2>{0.406842589f, 0.605873346f},
-std::array<float,2>{0.066191636f, 0.114866242f},
-std::array<float,2>{0.659730196f, 0.841643155f},
-std::array<float,2>{0.616486847f, 0.135056376f},
-std::array<float,2>{0.222673625f, 0.983268678f},
-std::array<float,2>{0.315184414f, 0.429893196f},
-std::array<float,2>{0.872194588f, 0.736931801f},
-std::array<float,2>{0.732336164f, 0.457788169f},
-std::array<float,2>{0.0446303748f, 0.681383491f},
-std::array<float,2>{0.498458683f, 0.215857401f},
-std::array<float,2>{0.946806312f, 0.88215965f},
-std::array<float,2>{0.761387825f, 0.00851005223f},
-std::array<float,2>{0.31128183f, 0.752023995f},
-std::array<float,2>{0.149133965f, 0.371447563f},
-std::array<float,2>{0.51137042f, 0.502763033f},
-std::array<float,2>{0.840958714f, 0.39003703f},
-std::array<float,2>{0.347762078f, 0.709571183f},
-std::array<float,2>{0.216208532f, 0.161795527f},
-std::array<float,2>{0.570416093f, 0.942356944f},
-std::array<float,2>{0.626709998f, 0.0876004472f},
-std::array<float,2>{0.104840785f, 0.86064142f},
-std::array<float,2>{0.385539144f, 0.268007666f},
-std::array<float,2>{0.887472332f, 0.583512366f},
-std::array<float,2>{0.553119481f, 0.320795387f},
-std::array<float,2>{0.173750535f, 0.551455319f},
-std::array<float,2>{0.252226293f, 0.0387810431f},
-std::array<float,2>{0.792886257f, 0.805179715f},
-std::array<float,2>{0.980529249f, 0.241622865f},
-std::array<float,2>{0.439961761f, 0.928805947f},
-std::array<float,2>{0.0304557141f, 0.480983406f},
-std::array<float,2>{0.694952488f, 0.644327402f},
-std::array<float,2>{0.88280654f, 0.427302808f},
-std::array<float,2>{0.3810305f, 0.748790205f},
-std::array<float,2>{0.100940816f, 0.12922585f},
-std::array<float,2>{0.636593223f, 0.975660205f},
-std::array<float,2>{0.563031316f, 0.123035356f},
-std::array<float,2>{0.204616666f, 0.8310166f},
-std::array<float,2>{0.356698006f, 0.310745358f},
-std::array<float,2>{0.833950102f, 0.594802499f},
-std::array<float,2>{0.699428618f, 0.361893028f},
-std::array<float,2>{0.0163590461f, 0.515245616f},
-std::array<float,2>{0.452625126f, 0.00551301613f},
-std::array<float,2>{0.976374447f, 0.763534486f},
-std::array<float,2>{0.788952649f, 0.204504341f},
-std::array<float,2>{0.264834344f, 0.885974526f},
-std::array<float,2>{0.182818875f, 0.463138282f},
-std::array<float,2>{0.555648983f, 0.675132573f},
-std::array<float,2>{0.859487951f, 0.275747925f},
-std::array<float,2>{0.321504951f, 0.590644717f},
-std::array<float,2>{0.228848487f, 0.0815999806f},
-std::array<float,2>{0.62045151f, 0.869348824f},
-std::array<float,2>{0.666269839f, 0.16854471f},
-std::array<float,2>{0.0731901452f, 0.948485613f},
-std::array<float,2>{0.415633559f, 0.37520659f},
-std::array<float,2>{0.936898649f, 0.71530652f},
-std::array<float,2>{0.501611412f, 0.473433077f},
-std::array<float,2>{0.148291275f, 0.651973724f},
-std::array<float,2>{0.300930411f, 0.249754354f},
-std::array<float,2>{0.752471209f, 0.935401201f},
-std::array<float,2>{0.943817377f, 0.0448545553f},
-std::array<float,2>{0.488738447f, 0.800518811f},
-std::array<float,2>{0.0375444107f, 0.316960424f},
-std::array<float,2>{0.725227892f, 0.559352279f},
-std::array<float,2>{0.985804677f, 0.340141088f},
-std::array<float,2>{0.464796185f, 0.54318732f},
-std::array<float,2>{0.0141310478f, 0.0538075157f},
-std::array<float,2>{0.714390457f, 0.794217706f},
-std::array<float,2>{0.532483518f, 0.225383237f},
-std::array<float,2>{0.168654352f, 0.921625972f},
-std::array<float,2>{0.266438663f, 0.485891551f},
-std::array<float,2>{0.799779594f, 0.627455592f},
-std::array<float,2>{0.64260906f, 0.403629571f},
-std::array<float,2>{0.119042553f, 0.696320772f},
-std::array<float,2>{0.403723925f, 0.178375602f},
-std::array<float,2>{0.900870383f, 0.96638006f},
-std::array<float,2>{0.821817517f, 0.0754408017f},
-std::array<float,2>{0.374537796f, 0.856693804f},
-std::array<float,2>{0.190421045f, 0.256884366f},
-std::array<float,2>{0.588606417f, 0.573312998f},
-std::array<float,2>{0.769207358f, 0.43948406f},
-std::array<float,2>{0.281974435f, 0.657015502f},
-std::array<float,2>{0.127503321f, 0.200509176f},
-std::array<float,2>{0.520332336f, 0.904684782f},
-std::array<float,2>{0.736227989f, 0.0301104411f},
-std::array<float,2>{0.0593488589f, 0.772422969f},
-std::array<float,2>{0.48166883f, 0.356715888f},
-std::array<float,2>{0.953181982f, 0.523118794f},
-std::array<float,2>{0.594555914f, 0.289993793f},
-std::array<float,2>{0.23611182f, 0.619919896f},
-std::array<float,2>{0.337426603f, 0.0988793075f},
-std::array<float,2>{0.84793973f, 0.819646001f},
-std::array<float,2>{0.910674632f, 0.143931672f},
-std::array<float,2>{0.430806845f, 0.999709427f},
-std::array<float,2>{0.0881532803f, 0.414819747f},
-std::array<float,2>{0.68556726f, 0.730942845f},
-std::array<float,2>{0.970345795f, 0.394589841f},
-std::array<float,2>{0.448043019f, 0.692429423f},
-std::array<float,2>{0.0225141738f, 0.182957396f},
-std::array<float,2>{0.697516561f, 0.958043456f},
-std::array<float,2>{0.561932385f, 0.0673474297f},
-std::array<float,2>{0.183750376f, 0.848611653f},
-std::array<float,2>{0.259383887f, 0.263932586f},
-std::array<float,2>{0.785106897f, 0.563428938f},
-std::array<float,2>{0.637827694f, 0.330926597f},
-std::array<float,2>{0.0970602632f, 0.532267809f},
-std::array<float,2>{0.378669977f, 0.0595084615f},
-std::array<float,2>{0.877409935f, 0.784493208f},
-std::array<float,2>{0.828261435f, 0.230966419f},
-std::array<float,2>{0.354081094f, 0.911643088f},
-std::array<float,2>{0.207736269f, 0.496551722f},
-std::array<float,2>{0.567170501f, 0.638197124f},
-std::array<float,2>{0.756694973f, 0.284513682f},
-std::array<float,2>{0.300409287f, 0.616692245f},
-std::array<float,2>{0.144104227f, 0.106157273f},
-std::array<float,2>{0.505294263f, 0.820680261f},
-std::array<float,2>{0.72151053f, 0.153057724f},
-std::array<float,2>{0.0341359861f, 0.988548875f},
-std::array<float,2>{0.488264769f, 0.40783152f},
-std::array<float,2>{0.941039741f, 0.722413599f},
-std::array<float,2>{0.62418133f, 0.452236801f},
-std::array<float,2>{0.233911321f, 0.671526968f},
-std::array<float,2>{0.325453967f, 0.192326784f},
-std::array<float,2>{0.867133141f, 0.895759463f},
-std::array<float,2>{0.929903805f, 0.0200642645f},
-std::array<float,2>{0.419219881f, 0.775362968f},
-std::array<float,2>{0.0766311213f, 0.348712772f},
-std::array<float,2>{0.670583785f, 0.528081238f},
-std::array<float,2>{0.904627681f, 0.368887663f},
-std::array<float,2>{0.40020439f, 0.504995644f},
-std::array<float,2>{0.123134084f, 0.0153836897f},
-std::array<float,2>{0.648327649f, 0.754038095f},
-std::array<float,2>{0.591536403f, 0.212724343f},
-std::array<float,2>{0.192005619f, 0.877549708f},
-std::array<float,2>{0.370245457f, 0.453976482f},
-std::array<float,2>{0.827919304f, 0.683790684f},
-std::array<float,2>{0.717007279f, 0.434463561f},
-std::array<float,2>{0.00886844937f, 0.740304708f},
-std::array<float,2>{0.466507703f, 0.138906777f},
-std::array<float,2>{0.991464317f, 0.97850132f},
-std::array<float,2>{0.802423418f, 0.110291854f},
-std::array<float,2>{0.270250797f, 0.838376939f},
-std::array<float,2>{0.16768162f, 0.299304724f},
-std::array<float,2>{0.535909653f, 0.603948891f},
-std::array<float,2>{0.847183466f, 0.479142725f},
-std::array<float,2>{0.341943502f, 0.648378074f},
-std::array<float,2>{0.239215836f, 0.234654248f},
-std::array<float,2>{0.5984267f, 0.925252616f},
-std::array<float,2>{0.682822943f, 0.0343946144f},
-std::array<float,2>{0.0935971141f, 0.812171519f},
-std::array<float,2>{0.435309142f, 0.326333821f},
-std::array<float,2>{0.909000814f, 0.548352301f},
-std::array<float,2>{0.518086433f, 0.272488415f},
-std::array<float,2>{0.131050974f, 0.57988447f},
-std::array<float,2>{0.288670212f, 0.0914035365f},
-std::array<float,2>{0.772725165f, 0.867034853f},
-std::array<float,2>{0.959765732f, 0.160052165f},
-std::array<float,2>{0.478049397f, 0.939783394f},
-std::array<float,2>{0.0552437827f, 0.382832497f},
-std::array<float,2>{0.742039919f, 0.705178559f},
-std::array<float,2>{0.916692793f, 0.465160877f},
-std::array<float,2>{0.424918085f, 0.679482281f},
-std::array<float,2>{0.0782610476f, 0.210520819f},
-std::array<float,2>{0.672749341f, 0.887826681f},
-std::array<float,2>{0.601673782f, 0.00332479621f},
-std::array<float,2>{0.244768217f, 0.757898867f},
-std::array<float,2>{0.332642347f, 0.366183579f},
-std::array<float,2>{0.857810855f, 0.510649443f},
-std::array<float,2>{0.743492663f, 0.308041692f},
-std::array<float,2>{0.0535213538f, 0.599949658f},
-std::array<float,2>{0.474191368f, 0.117940776f},
-std::array<float,2>{0.968482614f, 0.834515393f},
-std::array<float,2>{0.774831533f, 0.128439575f},
-std::array<float,2>{0.289106667f, 0.970194101f},
-std::array<float,2>{0.135023981f, 0.424224138f},
-std::array<float,2>{0.530096233f, 0.745058298f},
-std::array<float,2>{0.818381011f, 0.314023525f},
-std::array<float,2>{0.363856345f, 0.558056772f},
-std::array<float,2>{0.202982113f, 0.042408023f},
-std::array<float,2>{0.585563481f, 0.80093044f},
-std::array<float,2>{0.653167546f, 0.242687523f},
-std::array<float,2>{0.110613152f, 0.932487369f},
-std::array<float,2>{0.397248089f, 0.472108513f},
-std::array<float,2>{0.893070042f, 0.654905915f},
-std::array<float,2>{0.543022215f, 0.382217109f},
-std::array<float,2>{0.158908203f, 0.712649763f},
-std::array<float,2>{0.274466127f, 0.165623099f},
-std::array<float,2>{0.810492575f, 0.951501727f},
-std::array<float,2>{0.996799469f, 0.084201768f},
-std::array<float,2>{0.457899779f, 0.873449564f},
-std::array<float,2>{0.00714556267f, 0.278484255f},
-std::array<float,2>{0.705445349f, 0.587736249f},
-std::array<float,2>{0.950922847f, 0.251260251f},
-std::array<float,2>{0.495813906f, 0.576953471f},
-std::array<float,2>{0.0397582054f, 0.0713696852f},
-std::array<float,2>{0.726584911f, 0.854893446f},
-std::array<float,2>{0.51477319f, 0.174526125f},
-std::array<float,2>{0.154663861f, 0.961402595f},
-std::array<float,2>{0.305635601f, 0.398734152f},
-std::array<float,2>{0.764794886f, 0.699838877f},
-std::array<float,2>{0.662697554f, 0.492135584f},
-std::array<float,2>{0.0665041953f, 0.629015625f},
-std::array<float,2>{0.412240326f, 0.221257076f},
-std::array<float,2>{0.92515707f, 0.91756326f},
-std::array<float,2>{0.869901776f, 0.0502495803f},
-std::array<float,2>{0.317832947f, 0.790720761f},
-std::array<float,2>{0.220498621f, 0.338124722f},
-std::array<float,2>{0.610157311f, 0.542393208f},
-std::array<float,2>{0.796657681f, 0.418370038f},
-std::array<float,2>{0.255202144f, 0.729159415f},
-std::array<float,2>{0.176913038f, 0.145891652f},
-std::array<float,2>{0.550029099f, 0.994012773f},
-std::array<float,2>{0.691243589f, 0.0942253247f},
-std::array<float,2>{0.0255567338f, 0.81455183f},
-std::array<float,2>{0.444494188f, 0.293851912f},
-std::array<float,2>{0.978912294f, 0.623787582f},
-std::array<float,2>{0.575080097f, 0.351669312f},
-std::array<float,2>{0.214142501f, 0.51799351f},
-std::array<float,2>{0.343785554f, 0.0250860024f},
-std::array<float,2>{0.839293301f, 0.767389894f},
-std::array<float,2>{0.885685682f, 0.19826068f},
-std::array<float,2>{0.387697279f, 0.901983321f},
-std::array<float,2>{0.108050846f, 0.442045659f},
-std::array<float,2>{0.632732928f, 0.661952674f}}
\ No newline at end of file
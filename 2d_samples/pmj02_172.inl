@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.411142886f, 0.745578468f},
-std::array<float,2>{0.736279845f, 0.0833026543f},
-std::array<float,2>{0.878035843f, 0.866098642f},
-std::array<float,2>{0.153875485f, 0.379640579f},
-std::array<float,2>{0.090187408f, 0.923249125f},
-std::array<float,2>{0.818536878f, 0.289831817f},
-std::array<float,2>{0.532104671f, 0.504403114f},
-std::array<float,2>{0.340459704f, 0.191998884f},
-std::array<float,2>{0.243910879f, 0.593351364f},
-std::array<float,2>{0.944258034f, 0.168432146f},
-std::array<float,2>{0.655389547f, 0.983203173f},
-std::array<float,2>{0.441817433f, 0.31726709f},
-std::array<float,2>{0.279761821f, 0.795155704f},
-std::array<float,2>{0.618331969f, 0.456986517f},
-std::array<float,2>{0.778775513f, 0.648292005f},
-std::array<float,2>{0.0240893662f, 0.0372195095f},
-std::array<float,2>{0.362823218f, 0.559764385f},
-std::array<float,2>{0.51913166f, 0.233578458f},
-std::array<float,2>{0.869180322f, 0.883814037f},
-std::array<float,2>{0.115696028f, 0.279623717f},
-std::array<float,2>{0.17934297f, 0.824213624f},
-std::array<float,2>{0.928704798f, 0.414820611f},
-std::array<float,2>{0.715642512f, 0.704361558f},
-std::array<float,2>{0.399784327f, 0.0985509083f},
-std::array<float,2>{0.0396477133f, 0.669745088f},
-std::array<float,2>{0.788019359f, 0.0130959749f},
-std::array<float,2>{0.571003735f, 0.751945198f},
-std::array<float,2>{0.311265379f, 0.478624254f},
-std::array<float,2>{0.486878246f, 0.958990991f},
-std::array<float,2>{0.680543602f, 0.367718399f},
-std::array<float,2>{0.978892982f, 0.59907043f},
-std::array<float,2>{0.197871253f, 0.127727211f},
-std::array<float,2>{0.468696743f, 0.623463213f},
-std::array<float,2>{0.640619576f, 0.145628303f},
-std::array<float,2>{0.958813727f, 0.941275477f},
-std::array<float,2>{0.220165521f, 0.354159921f},
-std::array<float,2>{0.00393178873f, 0.768449664f},
-std::array<float,2>{0.75870496f, 0.49969551f},
-std::array<float,2>{0.603476048f, 0.687491834f},
-std::array<float,2>{0.253022701f, 0.0303764101f},
-std::array<float,2>{0.137446299f, 0.694815814f},
-std::array<float,2>{0.905615985f, 0.114027612f},
-std::array<float,2>{0.728049099f, 0.835956454f},
-std::array<float,2>{0.422691584f, 0.426615089f},
-std::array<float,2>{0.318449408f, 0.903896809f},
-std::array<float,2>{0.548038542f, 0.257427692f},
-std::array<float,2>{0.843396962f, 0.53386873f},
-std::array<float,2>{0.0671383068f, 0.236141071f},
-std::array<float,2>{0.291426212f, 0.62894547f},
-std::array<float,2>{0.590604901f, 0.0501537621f},
-std::array<float,2>{0.797929823f, 0.804467559f},
-std::array<float,2>{0.0583586916f, 0.448540688f},
-std::array<float,2>{0.216042876f, 0.991644979f},
-std::array<float,2>{0.985111058f, 0.334663898f},
-std::array<float,2>{0.660285652f, 0.566901028f},
-std::array<float,2>{0.471277684f, 0.178625286f},
-std::array<float,2>{0.108419992f, 0.526575804f},
-std::array<float,2>{0.849081218f, 0.204393461f},
-std::array<float,2>{0.507548571f, 0.916163921f},
-std::array<float,2>{0.35593468f, 0.310142785f},
-std::array<float,2>{0.37806648f, 0.844491959f},
-std::array<float,2>{0.691106975f, 0.392627478f},
-std::array<float,2>{0.919018149f, 0.731965005f},
-std::array<float,2>{0.161017969f, 0.0680562109f},
-std::array<float,2>{0.480774015f, 0.677889764f},
-std::array<float,2>{0.671453357f, 0.0171566494f},
-std::array<float,2>{0.997213781f, 0.773821473f},
-std::array<float,2>{0.208922699f, 0.489463866f},
-std::array<float,2>{0.050675936f, 0.948921263f},
-std::array<float,2>{0.80511415f, 0.343921393f},
-std::array<float,2>{0.583778679f, 0.611468017f},
-std::array<float,2>{0.288207591f, 0.153947979f},
-std::array<float,2>{0.165231362f, 0.540646136f},
-std::array<float,2>{0.913466692f, 0.243109643f},
-std::array<float,2>{0.700098515f, 0.891546309f},
-std::array<float,2>{0.383194774f, 0.261294454f},
-std::array<float,2>{0.348916173f, 0.829483747f},
-std::array<float,2>{0.51214093f, 0.436764836f},
-std::array<float,2>{0.85800916f, 0.697970867f},
-std::array<float,2>{0.099263981f, 0.124563813f},
-std::array<float,2>{0.26015389f, 0.572152913f},
-std::array<float,2>{0.597384572f, 0.184028029f},
-std::array<float,2>{0.755172372f, 0.995403469f},
-std::array<float,2>{0.0110277198f, 0.339653492f},
-std::array<float,2>{0.231482401f, 0.81221211f},
-std::array<float,2>{0.961587012f, 0.437792122f},
-std::array<float,2>{0.62525171f, 0.63402617f},
-std::array<float,2>{0.456811965f, 0.058130566f},
-std::array<float,2>{0.0713097453f, 0.724627733f},
-std::array<float,2>{0.829035342f, 0.0727780536f},
-std::array<float,2>{0.556454599f, 0.853081644f},
-std::array<float,2>{0.321031958f, 0.401404023f},
-std::array<float,2>{0.431155622f, 0.906337917f},
-std::array<float,2>{0.721189976f, 0.298303813f},
-std::array<float,2>{0.897603393f, 0.52132535f},
-std::array<float,2>{0.130761921f, 0.211757749f},
-std::array<float,2>{0.397398114f, 0.51248616f},
-std::array<float,2>{0.704586565f, 0.199393764f},
-std::array<float,2>{0.931263089f, 0.936925769f},
-std::array<float,2>{0.179941565f, 0.286584049f},
-std::array<float,2>{0.121741235f, 0.868691087f},
-std::array<float,2>{0.8633762f, 0.385626823f},
-std::array<float,2>{0.528377473f, 0.737252295f},
-std::array<float,2>{0.368292868f, 0.0934498608f},
-std::array<float,2>{0.191164926f, 0.650062859f},
-std::array<float,2>{0.974086463f, 0.0432049967f},
-std::array<float,2>{0.676259398f, 0.78816849f},
-std::array<float,2>{0.496346742f, 0.465612471f},
-std::array<float,2>{0.302134514f, 0.968850076f},
-std::array<float,2>{0.563796461f, 0.323719889f},
-std::array<float,2>{0.790579379f, 0.583018541f},
-std::array<float,2>{0.0315866359f, 0.162171021f},
-std::array<float,2>{0.333887994f, 0.716717124f},
-std::array<float,2>{0.54190588f, 0.104031131f},
-std::array<float,2>{0.825501263f, 0.815458417f},
-std::array<float,2>{0.0799188241f, 0.413722008f},
-std::array<float,2>{0.143980145f, 0.881640792f},
-std::array<float,2>{0.88609755f, 0.266201138f},
-std::array<float,2>{0.744751155f, 0.549422204f},
-std::array<float,2>{0.421530247f, 0.222323745f},
-std::array<float,2>{0.018086303f, 0.602197945f},
-std::array<float,2>{0.772421896f, 0.133139119f},
-std::array<float,2>{0.615133226f, 0.966771901f},
-std::array<float,2>{0.268909782f, 0.360390842f},
-std::array<float,2>{0.448573798f, 0.763629436f},
-std::array<float,2>{0.648352444f, 0.474690109f},
-std::array<float,2>{0.949942946f, 0.656373918f},
-std::array<float,2>{0.239415258f, 0.00378840906f},
-std::array<float,2>{0.438148528f, 0.701568961f},
-std::array<float,2>{0.650389254f, 0.119265638f},
-std::array<float,2>{0.9398247f, 0.834736645f},
-std::array<float,2>{0.247460544f, 0.431191623f},
-std::array<float,2>{0.0290220417f, 0.897072732f},
-std::array<float,2>{0.773913264f, 0.261846393f},
-std::array<float,2>{0.624785364f, 0.544890761f},
-std::array<float,2>{0.27564618f, 0.247507229f},
-std::array<float,2>{0.149052352f, 0.61653161f},
-std::array<float,2>{0.881431758f, 0.14874965f},
-std::array<float,2>{0.739799917f, 0.9524405f},
-std::array<float,2>{0.406683594f, 0.348057419f},
-std::array<float,2>{0.337627649f, 0.77791512f},
-std::array<float,2>{0.538358331f, 0.487728804f},
-std::array<float,2>{0.814853668f, 0.673074841f},
-std::array<float,2>{0.0896177143f, 0.0198150109f},
-std::array<float,2>{0.30567807f, 0.516495585f},
-std::array<float,2>{0.576085389f, 0.215184703f},
-std::array<float,2>{0.784999251f, 0.910657287f},
-std::array<float,2>{0.0457795672f, 0.303574741f},
-std::array<float,2>{0.20017764f, 0.856886744f},
-std::array<float,2>{0.982296109f, 0.403100461f},
-std::array<float,2>{0.684350491f, 0.720065236f},
-std::array<float,2>{0.489825726f, 0.0769767761f},
-std::array<float,2>{0.112733878f, 0.640414357f},
-std::array<float,2>{0.873864532f, 0.0611331761f},
-std::array<float,2>{0.519572973f, 0.80770427f},
-std::array<float,2>{0.364971548f, 0.44432652f},
-std::array<float,2>{0.402951479f, 0.997787893f},
-std::array<float,2>{0.714414299f, 0.340096146f},
-std::array<float,2>{0.924266279f, 0.576185822f},
-std::array<float,2>{0.172330886f, 0.182967782f},
-std::array<float,2>{0.428085953f, 0.581360221f},
-std::array<float,2>{0.732706249f, 0.160030216f},
-std::array<float,2>{0.901667595f, 0.973905683f},
-std::array<float,2>{0.133015275f, 0.326556355f},
-std::array<float,2>{0.0649422929f, 0.782653451f},
-std::array<float,2>{0.836845756f, 0.464102358f},
-std::array<float,2>{0.550883472f, 0.655797303f},
-std::array<float,2>{0.312553138f, 0.0410450622f},
-std::array<float,2>{0.224000737f, 0.740313828f},
-std::array<float,2>{0.95515126f, 0.0886346772f},
-std::array<float,2>{0.634354234f, 0.874869049f},
-std::array<float,2>{0.461862981f, 0.388020515f},
-std::array<float,2>{0.256636083f, 0.930845499f},
-std::array<float,2>{0.609347165f, 0.281253576f},
-std::array<float,2>{0.765130818f, 0.509448111f},
-std::array<float,2>{0.00191688829f, 0.197929397f},
-std::array<float,2>{0.352405697f, 0.661572397f},
-std::array<float,2>{0.503597021f, 0.00703947153f},
-std::array<float,2>{0.845477045f, 0.758448958f},
-std::array<float,2>{0.10192313f, 0.472110331f},
-std::array<float,2>{0.159503564f, 0.962032676f},
-std::array<float,2>{0.915224552f, 0.365275651f},
-std::array<float,2>{0.694895744f, 0.608205736f},
-std::array<float,2>{0.381206602f, 0.139488026f},
-std::array<float,2>{0.0621170029f, 0.551544726f},
-std::array<float,2>{0.804446757f, 0.223440021f},
-std::array<float,2>{0.586550772f, 0.877535164f},
-std::array<float,2>{0.294919044f, 0.271946609f},
-std::array<float,2>{0.475618303f, 0.818605244f},
-std::array<float,2>{0.659100235f, 0.407870591f},
-std::array<float,2>{0.990151167f, 0.711748421f},
-std::array<float,2>{0.213539109f, 0.108682744f},
-std::array<float,2>{0.387620509f, 0.641097546f},
-std::array<float,2>{0.699086487f, 0.0323836766f},
-std::array<float,2>{0.910078764f, 0.790934741f},
-std::array<float,2>{0.169230327f, 0.457730353f},
-std::array<float,2>{0.0947807729f, 0.977526844f},
-std::array<float,2>{0.853421271f, 0.315078676f},
-std::array<float,2>{0.50903964f, 0.586890996f},
-std::array<float,2>{0.344934881f, 0.165860355f},
-std::array<float,2>{0.205579743f, 0.50307256f},
-std::array<float,2>{0.992445827f, 0.189586878f},
-std::array<float,2>{0.667677283f, 0.927074611f},
-std::array<float,2>{0.476857066f, 0.294072241f},
-std::array<float,2>{0.281930685f, 0.859452009f},
-std::array<float,2>{0.581254721f, 0.376989305f},
-std::array<float,2>{0.811744332f, 0.748388529f},
-std::array<float,2>{0.052087117f, 0.0809277222f},
-std::array<float,2>{0.324871153f, 0.595964074f},
-std::array<float,2>{0.562383235f, 0.132124886f},
-std::array<float,2>{0.832611561f, 0.954076052f},
-std::array<float,2>{0.0743708313f, 0.374035269f},
-std::array<float,2>{0.125247627f, 0.756902993f},
-std::array<float,2>{0.891967297f, 0.480998009f},
-std::array<float,2>{0.724204063f, 0.664395571f},
-std::array<float,2>{0.4373146f, 0.009042372f},
-std::array<float,2>{0.0133737801f, 0.708872139f},
-std::array<float,2>{0.750616431f, 0.0971506312f},
-std::array<float,2>{0.597885668f, 0.828092635f},
-std::array<float,2>{0.264205784f, 0.419074953f},
-std::array<float,2>{0.460910708f, 0.889816999f},
-std::array<float,2>{0.631421149f, 0.276245892f},
-std::array<float,2>{0.967910588f, 0.555056691f},
-std::array<float,2>{0.227490127f, 0.228346586f},
-std::array<float,2>{0.494188935f, 0.536776662f},
-std::array<float,2>{0.673641682f, 0.24006708f},
-std::array<float,2>{0.972123027f, 0.899303198f},
-std::array<float,2>{0.193375617f, 0.252512038f},
-std::array<float,2>{0.036496181f, 0.842325091f},
-std::array<float,2>{0.793314159f, 0.425662041f},
-std::array<float,2>{0.569348454f, 0.687856674f},
-std::array<float,2>{0.300111145f, 0.110582724f},
-std::array<float,2>{0.185656413f, 0.68001163f},
-std::array<float,2>{0.934925973f, 0.0249592178f},
-std::array<float,2>{0.709121406f, 0.77217859f},
-std::array<float,2>{0.39419353f, 0.495634884f},
-std::array<float,2>{0.37174204f, 0.941563964f},
-std::array<float,2>{0.525343776f, 0.359236926f},
-std::array<float,2>{0.8601349f, 0.617418587f},
-std::array<float,2>{0.118570894f, 0.143418834f},
-std::array<float,2>{0.273064345f, 0.727185488f},
-std::array<float,2>{0.611774504f, 0.0626955777f},
-std::array<float,2>{0.768942952f, 0.849107504f},
-std::array<float,2>{0.0227410328f, 0.397416711f},
-std::array<float,2>{0.238179162f, 0.921204209f},
-std::array<float,2>{0.947110355f, 0.307125568f},
-std::array<float,2>{0.641862214f, 0.531246364f},
-std::array<float,2>{0.449525535f, 0.209855497f},
-std::array<float,2>{0.0839403868f, 0.564536929f},
-std::array<float,2>{0.823090315f, 0.174014255f},
-std::array<float,2>{0.544336855f, 0.986739039f},
-std::array<float,2>{0.330534726f, 0.330027074f},
-std::array<float,2>{0.416029632f, 0.800121427f},
-std::array<float,2>{0.74952805f, 0.449258894f},
-std::array<float,2>{0.890127599f, 0.626480281f},
-std::array<float,2>{0.14501965f, 0.0523859262f},
-std::array<float,2>{0.401480526f, 0.70683533f},
-std::array<float,2>{0.717153609f, 0.100529224f},
-std::array<float,2>{0.926098585f, 0.82052213f},
-std::array<float,2>{0.176881954f, 0.416738033f},
-std::array<float,2>{0.1134881f, 0.886541843f},
-std::array<float,2>{0.868973374f, 0.277575791f},
-std::array<float,2>{0.515772223f, 0.561815321f},
-std::array<float,2>{0.36018455f, 0.231674746f},
-std::array<float,2>{0.195785314f, 0.599802911f},
-std::array<float,2>{0.976638198f, 0.126582876f},
-std::array<float,2>{0.68258512f, 0.958007395f},
-std::array<float,2>{0.485476702f, 0.370114416f},
-std::array<float,2>{0.309889138f, 0.753883779f},
-std::array<float,2>{0.573283017f, 0.477558881f},
-std::array<float,2>{0.78677398f, 0.670815647f},
-std::array<float,2>{0.0422569141f, 0.0152887441f},
-std::array<float,2>{0.343282729f, 0.506510198f},
-std::array<float,2>{0.535148263f, 0.193584338f},
-std::array<float,2>{0.8175143f, 0.925183535f},
-std::array<float,2>{0.0936516225f, 0.292068183f},
-std::array<float,2>{0.155549377f, 0.863731623f},
-std::array<float,2>{0.876800478f, 0.382685065f},
-std::array<float,2>{0.737419128f, 0.743397892f},
-std::array<float,2>{0.412380993f, 0.0847527683f},
-std::array<float,2>{0.0257814601f, 0.646064043f},
-std::array<float,2>{0.780304849f, 0.037016727f},
-std::array<float,2>{0.621071398f, 0.79453373f},
-std::array<float,2>{0.278264284f, 0.45318082f},
-std::array<float,2>{0.443881094f, 0.981076121f},
-std::array<float,2>{0.65363735f, 0.3195315f},
-std::array<float,2>{0.943330765f, 0.590292931f},
-std::array<float,2>{0.246024802f, 0.170808479f},
-std::array<float,2>{0.469384402f, 0.568848848f},
-std::array<float,2>{0.663922429f, 0.176239252f},
-std::array<float,2>{0.988081217f, 0.988487363f},
-std::array<float,2>{0.217629731f, 0.332588047f},
-std::array<float,2>{0.0554927066f, 0.801688552f},
-std::array<float,2>{0.800088704f, 0.445603997f},
-std::array<float,2>{0.593182802f, 0.631298959f},
-std::array<float,2>{0.289565414f, 0.0473920032f},
-std::array<float,2>{0.163524717f, 0.733075261f},
-std::array<float,2>{0.921519518f, 0.0693468601f},
-std::array<float,2>{0.689036667f, 0.847134769f},
-std::array<float,2>{0.37544021f, 0.39223212f},
-std::array<float,2>{0.35869661f, 0.915728033f},
-std::array<float,2>{0.504139423f, 0.311960548f},
-std::array<float,2>{0.850230992f, 0.524270535f},
-std::array<float,2>{0.105797313f, 0.206813082f},
-std::array<float,2>{0.250326216f, 0.685409188f},
-std::array<float,2>{0.604075432f, 0.0276392549f},
-std::array<float,2>{0.760588169f, 0.766075611f},
-std::array<float,2>{0.00779314945f, 0.497137338f},
-std::array<float,2>{0.221303552f, 0.937917471f},
-std::array<float,2>{0.960465968f, 0.352140397f},
-std::array<float,2>{0.637912333f, 0.621922851f},
-std::array<float,2>{0.465333194f, 0.146692947f},
-std::array<float,2>{0.0698882639f, 0.531941712f},
-std::array<float,2>{0.840063095f, 0.237181082f},
-std::array<float,2>{0.549628615f, 0.904869974f},
-std::array<float,2>{0.317877263f, 0.254665732f},
-std::array<float,2>{0.425438166f, 0.839247763f},
-std::array<float,2>{0.729498804f, 0.429216146f},
-std::array<float,2>{0.903759241f, 0.691745996f},
-std::array<float,2>{0.14059253f, 0.115656823f},
-std::array<float,2>{0.453285575f, 0.634803534f},
-std::array<float,2>{0.627889633f, 0.0565932654f},
-std::array<float,2>{0.964468241f, 0.808866024f},
-std::array<float,2>{0.234233901f, 0.441112638f},
-std::array<float,2>{0.00810475368f, 0.992958724f},
-std::array<float,2>{0.75661999f, 0.336007655f},
-std::array<float,2>{0.595293462f, 0.572710633f},
-std::array<float,2>{0.258773625f, 0.186409548f},
-std::array<float,2>{0.131049439f, 0.521698713f},
-std::array<float,2>{0.894539356f, 0.214824229f},
-std::array<float,2>{0.719847977f, 0.908235192f},
-std::array<float,2>{0.433361202f, 0.299339145f},
-std::array<float,2>{0.322450727f, 0.855136275f},
-std::array<float,2>{0.557151496f, 0.399008662f},
-std::array<float,2>{0.83196491f, 0.723643959f},
-std::array<float,2>{0.072756052f, 0.0717433169f},
-std::array<float,2>{0.285261422f, 0.611202061f},
-std::array<float,2>{0.58565861f, 0.154919282f},
-std::array<float,2>{0.80795747f, 0.94696945f},
-std::array<float,2>{0.0471682064f, 0.347167134f},
-std::array<float,2>{0.208986059f, 0.776721597f},
-std::array<float,2>{0.999973416f, 0.490272254f},
-std::array<float,2>{0.668999612f, 0.676412225f},
-std::array<float,2>{0.483083487f, 0.017949855f},
-std::array<float,2>{0.100472718f, 0.696532369f},
-std::array<float,2>{0.856854677f, 0.12174461f},
-std::array<float,2>{0.515532911f, 0.830658436f},
-std::array<float,2>{0.350757301f, 0.433960408f},
-std::array<float,2>{0.385360301f, 0.893830597f},
-std::array<float,2>{0.70132798f, 0.258171856f},
-std::array<float,2>{0.91122967f, 0.542360902f},
-std::array<float,2>{0.166231424f, 0.244797081f},
-std::array<float,2>{0.418798625f, 0.54726851f},
-std::array<float,2>{0.742221594f, 0.220653325f},
-std::array<float,2>{0.884518445f, 0.879330277f},
-std::array<float,2>{0.14083232f, 0.268406808f},
-std::array<float,2>{0.0817184448f, 0.813391328f},
-std::array<float,2>{0.827250242f, 0.412035823f},
-std::array<float,2>{0.540796995f, 0.718241453f},
-std::array<float,2>{0.334442616f, 0.102765486f},
-std::array<float,2>{0.242058665f, 0.65929538f},
-std::array<float,2>{0.952724516f, 0.000480258459f},
-std::array<float,2>{0.646168053f, 0.763875186f},
-std::array<float,2>{0.44723323f, 0.474076271f},
-std::array<float,2>{0.265899986f, 0.967631698f},
-std::array<float,2>{0.615346014f, 0.361950964f},
-std::array<float,2>{0.769579828f, 0.604136467f},
-std::array<float,2>{0.0163215473f, 0.135353848f},
-std::array<float,2>{0.370287925f, 0.735778511f},
-std::array<float,2>{0.530239344f, 0.090278849f},
-std::array<float,2>{0.866643548f, 0.870496094f},
-std::array<float,2>{0.123169743f, 0.384745032f},
-std::array<float,2>{0.183451086f, 0.93538022f},
-std::array<float,2>{0.933415294f, 0.287839025f},
-std::array<float,2>{0.705439687f, 0.515390456f},
-std::array<float,2>{0.395019203f, 0.202530906f},
-std::array<float,2>{0.0332674049f, 0.584949136f},
-std::array<float,2>{0.791724384f, 0.16182901f},
-std::array<float,2>{0.565531731f, 0.972545922f},
-std::array<float,2>{0.302919775f, 0.320830166f},
-std::array<float,2>{0.49846223f, 0.786331832f},
-std::array<float,2>{0.678962946f, 0.467018008f},
-std::array<float,2>{0.976056993f, 0.652177989f},
-std::array<float,2>{0.18938823f, 0.0459834486f},
-std::array<float,2>{0.491289586f, 0.722411871f},
-std::array<float,2>{0.686017692f, 0.0756389871f},
-std::array<float,2>{0.982721925f, 0.858319104f},
-std::array<float,2>{0.2019137f, 0.405869395f},
-std::array<float,2>{0.0440536179f, 0.912353933f},
-std::array<float,2>{0.781536222f, 0.302297145f},
-std::array<float,2>{0.576435506f, 0.518422484f},
-std::array<float,2>{0.30726555f, 0.218429238f},
-std::array<float,2>{0.17397128f, 0.575939417f},
-std::array<float,2>{0.92366606f, 0.180629268f},
-std::array<float,2>{0.71126014f, 0.998937368f},
-std::array<float,2>{0.405380428f, 0.341869771f},
-std::array<float,2>{0.365392715f, 0.805967391f},
-std::array<float,2>{0.523146212f, 0.442207426f},
-std::array<float,2>{0.871822536f, 0.637851477f},
-std::array<float,2>{0.111089796f, 0.0587040894f},
-std::array<float,2>{0.274427503f, 0.546145618f},
-std::array<float,2>{0.621279776f, 0.248364791f},
-std::array<float,2>{0.775412738f, 0.896382987f},
-std::array<float,2>{0.0299643856f, 0.265065253f},
-std::array<float,2>{0.248961404f, 0.832615077f},
-std::array<float,2>{0.937737226f, 0.432875574f},
-std::array<float,2>{0.651477218f, 0.7007761f},
-std::array<float,2>{0.440473974f, 0.118732542f},
-std::array<float,2>{0.0865426734f, 0.675613403f},
-std::array<float,2>{0.814264417f, 0.0228996556f},
-std::array<float,2>{0.536180973f, 0.780379415f},
-std::array<float,2>{0.338779777f, 0.485632956f},
-std::array<float,2>{0.410100073f, 0.950899184f},
-std::array<float,2>{0.740581512f, 0.349890321f},
-std::array<float,2>{0.879760146f, 0.615044773f},
-std::array<float,2>{0.151667356f, 0.152269825f},
-std::array<float,2>{0.380383611f, 0.607088566f},
-std::array<float,2>{0.692168295f, 0.137291521f},
-std::array<float,2>{0.916594267f, 0.962999284f},
-std::array<float,2>{0.156542927f, 0.364430726f},
-std::array<float,2>{0.104045145f, 0.761524081f},
-std::array<float,2>{0.84658736f, 0.470138848f},
-std::array<float,2>{0.500551999f, 0.662586629f},
-std::array<float,2>{0.353539616f, 0.00484673632f},
-std::array<float,2>{0.211317107f, 0.713079512f},
-std::array<float,2>{0.991314113f, 0.107106276f},
-std::array<float,2>{0.656762183f, 0.817585409f},
-std::array<float,2>{0.472707897f, 0.409698099f},
-std::array<float,2>{0.29657945f, 0.876926005f},
-std::array<float,2>{0.588488996f, 0.271385193f},
-std::array<float,2>{0.802295387f, 0.552803934f},
-std::array<float,2>{0.0598571338f, 0.225931272f},
-std::array<float,2>{0.315476269f, 0.652452528f},
-std::array<float,2>{0.553669155f, 0.0404291786f},
-std::array<float,2>{0.838263452f, 0.783756614f},
-std::array<float,2>{0.0627186671f, 0.462732792f},
-std::array<float,2>{0.135750428f, 0.974669814f},
-std::array<float,2>{0.900080025f, 0.325265825f},
-std::array<float,2>{0.731252551f, 0.579866827f},
-std::array<float,2>{0.426160336f, 0.157763317f},
-std::array<float,2>{0.00291882083f, 0.511561036f},
-std::array<float,2>{0.763389289f, 0.196905896f},
-std::array<float,2>{0.60547775f, 0.933561504f},
-std::array<float,2>{0.255478859f, 0.283779919f},
-std::array<float,2>{0.464223742f, 0.871164024f},
-std::array<float,2>{0.635760009f, 0.390592068f},
-std::array<float,2>{0.953724384f, 0.739748061f},
-std::array<float,2>{0.225422964f, 0.0869623199f},
-std::array<float,2>{0.434959799f, 0.667192101f},
-std::array<float,2>{0.726013303f, 0.0105507215f},
-std::array<float,2>{0.894313097f, 0.754401505f},
-std::array<float,2>{0.128744423f, 0.483093858f},
-std::array<float,2>{0.0779165849f, 0.956598341f},
-std::array<float,2>{0.835115731f, 0.372929752f},
-std::array<float,2>{0.558711052f, 0.59395206f},
-std::array<float,2>{0.327692062f, 0.130435601f},
-std::array<float,2>{0.228798121f, 0.557909191f},
-std::array<float,2>{0.965280056f, 0.230175436f},
-std::array<float,2>{0.630769193f, 0.888552547f},
-std::array<float,2>{0.457898974f, 0.275247544f},
-std::array<float,2>{0.261909366f, 0.826150179f},
-std::array<float,2>{0.601323009f, 0.421549588f},
-std::array<float,2>{0.752812922f, 0.710242212f},
-std::array<float,2>{0.015618992f, 0.094503805f},
-std::array<float,2>{0.347449839f, 0.589594305f},
-std::array<float,2>{0.510854423f, 0.167244524f},
-std::array<float,2>{0.853528619f, 0.979485095f},
-std::array<float,2>{0.0965077654f, 0.314018905f},
-std::array<float,2>{0.171049178f, 0.79106462f},
-std::array<float,2>{0.907347441f, 0.460805535f},
-std::array<float,2>{0.696809173f, 0.642722547f},
-std::array<float,2>{0.389431626f, 0.0339397751f},
-std::array<float,2>{0.0544160791f, 0.747177005f},
-std::array<float,2>{0.809678316f, 0.0792274177f},
-std::array<float,2>{0.579645038f, 0.86273092f},
-std::array<float,2>{0.285131335f, 0.375139654f},
-std::array<float,2>{0.479839593f, 0.928424299f},
-std::array<float,2>{0.66453886f, 0.295155168f},
-std::array<float,2>{0.995613217f, 0.500997603f},
-std::array<float,2>{0.20371598f, 0.18928194f},
-std::array<float,2>{0.451351196f, 0.528758883f},
-std::array<float,2>{0.643459201f, 0.207801476f},
-std::array<float,2>{0.948478997f, 0.919275761f},
-std::array<float,2>{0.234768614f, 0.304788649f},
-std::array<float,2>{0.0213034954f, 0.850698948f},
-std::array<float,2>{0.767120063f, 0.396134645f},
-std::array<float,2>{0.610580444f, 0.729619026f},
-std::array<float,2>{0.270695746f, 0.0651474223f},
-std::array<float,2>{0.146616906f, 0.62745434f},
-std::array<float,2>{0.888303518f, 0.0546791665f},
-std::array<float,2>{0.746479928f, 0.796930432f},
-std::array<float,2>{0.414269358f, 0.452475786f},
-std::array<float,2>{0.32859537f, 0.986247241f},
-std::array<float,2>{0.546220541f, 0.331634134f},
-std::array<float,2>{0.821056843f, 0.563875735f},
-std::array<float,2>{0.0853710398f, 0.172107548f},
-std::array<float,2>{0.296893567f, 0.690234303f},
-std::array<float,2>{0.568317711f, 0.112841032f},
-std::array<float,2>{0.79588753f, 0.840210974f},
-std::array<float,2>{0.0381976627f, 0.423526913f},
-std::array<float,2>{0.193205506f, 0.900618076f},
-std::array<float,2>{0.969975531f, 0.250767827f},
-std::array<float,2>{0.673953652f, 0.537603378f},
-std::array<float,2>{0.492889822f, 0.240261123f},
-std::array<float,2>{0.120891675f, 0.619530499f},
-std::array<float,2>{0.862461746f, 0.141124249f},
-std::array<float,2>{0.525815189f, 0.945310652f},
-std::array<float,2>{0.374947339f, 0.356241912f},
-std::array<float,2>{0.39074266f, 0.769848228f},
-std::array<float,2>{0.708265841f, 0.492204636f},
-std::array<float,2>{0.936086237f, 0.682567656f},
-std::array<float,2>{0.185239375f, 0.0261788871f},
-std::array<float,2>{0.376811206f, 0.730495453f},
-std::array<float,2>{0.687726319f, 0.0665020198f},
-std::array<float,2>{0.920360804f, 0.845258832f},
-std::array<float,2>{0.162272766f, 0.393661261f},
-std::array<float,2>{0.107090026f, 0.917720973f},
-std::array<float,2>{0.851457596f, 0.308639109f},
-std::array<float,2>{0.505095065f, 0.52610141f},
-std::array<float,2>{0.358265609f, 0.203898787f},
-std::array<float,2>{0.21847418f, 0.568246424f},
-std::array<float,2>{0.987225354f, 0.179414645f},
-std::array<float,2>{0.662530005f, 0.990791082f},
-std::array<float,2>{0.470569581f, 0.335254043f},
-std::array<float,2>{0.290805995f, 0.803342283f},
-std::array<float,2>{0.592244923f, 0.448176056f},
-std::array<float,2>{0.799189329f, 0.63044095f},
-std::array<float,2>{0.0564562604f, 0.0489801653f},
-std::array<float,2>{0.316742569f, 0.534792244f},
-std::array<float,2>{0.549983263f, 0.234892681f},
-std::array<float,2>{0.840905249f, 0.902711809f},
-std::array<float,2>{0.0689763874f, 0.255992383f},
-std::array<float,2>{0.138949588f, 0.837702572f},
-std::array<float,2>{0.903090775f, 0.427085966f},
-std::array<float,2>{0.729250491f, 0.694089651f},
-std::array<float,2>{0.424008816f, 0.114832178f},
-std::array<float,2>{0.00621003192f, 0.685747623f},
-std::array<float,2>{0.761589229f, 0.0297825076f},
-std::array<float,2>{0.604690254f, 0.769016147f},
-std::array<float,2>{0.251075894f, 0.498871148f},
-std::array<float,2>{0.466773182f, 0.93980521f},
-std::array<float,2>{0.637666583f, 0.354789943f},
-std::array<float,2>{0.95967412f, 0.624561548f},
-std::array<float,2>{0.221952587f, 0.14527747f},
-std::array<float,2>{0.484929234f, 0.59845084f},
-std::array<float,2>{0.683453619f, 0.127948612f},
-std::array<float,2>{0.977738082f, 0.960578442f},
-std::array<float,2>{0.196921498f, 0.368958712f},
-std::array<float,2>{0.041200269f, 0.750002563f},
-std::array<float,2>{0.785737455f, 0.479853064f},
-std::array<float,2>{0.572640538f, 0.668903053f},
-std::array<float,2>{0.308659613f, 0.0123313507f},
-std::array<float,2>{0.176349685f, 0.703900337f},
-std::array<float,2>{0.927106559f, 0.0986486748f},
-std::array<float,2>{0.718120158f, 0.822851002f},
-std::array<float,2>{0.400647372f, 0.415242016f},
-std::array<float,2>{0.361035794f, 0.883076787f},
-std::array<float,2>{0.517217219f, 0.281042695f},
-std::array<float,2>{0.868070662f, 0.559360147f},
-std::array<float,2>{0.114750691f, 0.233014703f},
-std::array<float,2>{0.279035389f, 0.646647274f},
-std::array<float,2>{0.619691849f, 0.0385397859f},
-std::array<float,2>{0.779568672f, 0.796189129f},
-std::array<float,2>{0.0269059725f, 0.455256999f},
-std::array<float,2>{0.24425593f, 0.983579636f},
-std::array<float,2>{0.94214505f, 0.317638308f},
-std::array<float,2>{0.652963042f, 0.591846168f},
-std::array<float,2>{0.444614232f, 0.169252381f},
-std::array<float,2>{0.0921007171f, 0.505835891f},
-std::array<float,2>{0.817120314f, 0.193208128f},
-std::array<float,2>{0.533841908f, 0.922411203f},
-std::array<float,2>{0.342652053f, 0.290845543f},
-std::array<float,2>{0.413145185f, 0.86698252f},
-std::array<float,2>{0.736871481f, 0.38076365f},
-std::array<float,2>{0.875253677f, 0.74433881f},
-std::array<float,2>{0.15437229f, 0.0826533958f},
-std::array<float,2>{0.446194649f, 0.657565475f},
-std::array<float,2>{0.644762576f, 0.00255389954f},
-std::array<float,2>{0.952140331f, 0.762666583f},
-std::array<float,2>{0.240391999f, 0.476257592f},
-std::array<float,2>{0.0170710348f, 0.965269864f},
-std::array<float,2>{0.77147162f, 0.359992236f},
-std::array<float,2>{0.616672158f, 0.602820575f},
-std::array<float,2>{0.267573893f, 0.13472496f},
-std::array<float,2>{0.142392203f, 0.550007701f},
-std::array<float,2>{0.883513391f, 0.220890626f},
-std::array<float,2>{0.743841231f, 0.882649064f},
-std::array<float,2>{0.419512749f, 0.267050087f},
-std::array<float,2>{0.335607529f, 0.814914227f},
-std::array<float,2>{0.539524674f, 0.412182599f},
-std::array<float,2>{0.826814473f, 0.715127885f},
-std::array<float,2>{0.0809786022f, 0.104785308f},
-std::array<float,2>{0.304271162f, 0.582210004f},
-std::array<float,2>{0.56538105f, 0.163530633f},
-std::array<float,2>{0.792452931f, 0.96982646f},
-std::array<float,2>{0.035109181f, 0.322939157f},
-std::array<float,2>{0.188212529f, 0.78802973f},
-std::array<float,2>{0.975012422f, 0.466552913f},
-std::array<float,2>{0.678577125f, 0.649310172f},
-std::array<float,2>{0.499896973f, 0.0440612249f},
-std::array<float,2>{0.124411926f, 0.737985969f},
-std::array<float,2>{0.865785539f, 0.0923072621f},
-std::array<float,2>{0.530409813f, 0.867421031f},
-std::array<float,2>{0.369787216f, 0.385787189f},
-std::array<float,2>{0.395899862f, 0.935950458f},
-std::array<float,2>{0.706696451f, 0.286007851f},
-std::array<float,2>{0.931712568f, 0.513339639f},
-std::array<float,2>{0.182457522f, 0.200903669f},
-std::array<float,2>{0.431825191f, 0.520306647f},
-std::array<float,2>{0.719630361f, 0.212457001f},
-std::array<float,2>{0.895792723f, 0.907456577f},
-std::array<float,2>{0.132095292f, 0.297504336f},
-std::array<float,2>{0.0737478584f, 0.851793408f},
-std::array<float,2>{0.830281138f, 0.40067184f},
-std::array<float,2>{0.557735026f, 0.726117373f},
-std::array<float,2>{0.323604822f, 0.073947601f},
-std::array<float,2>{0.232885763f, 0.633208394f},
-std::array<float,2>{0.963401854f, 0.057058014f},
-std::array<float,2>{0.628148139f, 0.810888469f},
-std::array<float,2>{0.454347521f, 0.438555896f},
-std::array<float,2>{0.25920704f, 0.994810283f},
-std::array<float,2>{0.59462142f, 0.338818163f},
-std::array<float,2>{0.757718921f, 0.57050246f},
-std::array<float,2>{0.00973581243f, 0.18541345f},
-std::array<float,2>{0.349871278f, 0.698891222f},
-std::array<float,2>{0.514516354f, 0.123242587f},
-std::array<float,2>{0.855996251f, 0.828573704f},
-std::array<float,2>{0.101085417f, 0.435573369f},
-std::array<float,2>{0.167337224f, 0.89235425f},
-std::array<float,2>{0.910883367f, 0.260557085f},
-std::array<float,2>{0.702355087f, 0.539158046f},
-std::array<float,2>{0.386116624f, 0.244136453f},
-std::array<float,2>{0.0480903313f, 0.612601042f},
-std::array<float,2>{0.807452977f, 0.152748823f},
-std::array<float,2>{0.584810972f, 0.947785795f},
-std::array<float,2>{0.286642671f, 0.345019996f},
-std::array<float,2>{0.483545005f, 0.774473548f},
-std::array<float,2>{0.668177605f, 0.488828003f},
-std::array<float,2>{0.998763204f, 0.679195702f},
-std::array<float,2>{0.210262999f, 0.015642751f},
-std::array<float,2>{0.4738262f, 0.712178111f},
-std::array<float,2>{0.657541215f, 0.107995026f},
-std::array<float,2>{0.990865946f, 0.820312202f},
-std::array<float,2>{0.211923182f, 0.406691879f},
-std::array<float,2>{0.0592249744f, 0.878126919f},
-std::array<float,2>{0.801728964f, 0.273305506f},
-std::array<float,2>{0.589188397f, 0.55254513f},
-std::array<float,2>{0.295062274f, 0.224134773f},
-std::array<float,2>{0.157966003f, 0.608471155f},
-std::array<float,2>{0.917876005f, 0.14007251f},
-std::array<float,2>{0.692576766f, 0.960992277f},
-std::array<float,2>{0.379311085f, 0.366863966f},
-std::array<float,2>{0.355061948f, 0.759597182f},
-std::array<float,2>{0.501438379f, 0.471029699f},
-std::array<float,2>{0.846937656f, 0.660921872f},
-std::array<float,2>{0.104934387f, 0.00595686352f},
-std::array<float,2>{0.254510045f, 0.508185625f},
-std::array<float,2>{0.607158482f, 0.199047923f},
-std::array<float,2>{0.76183778f, 0.929870784f},
-std::array<float,2>{0.00361437839f, 0.282846212f},
-std::array<float,2>{0.226284608f, 0.873850286f},
-std::array<float,2>{0.955036104f, 0.386746973f},
-std::array<float,2>{0.635464251f, 0.741565049f},
-std::array<float,2>{0.462969363f, 0.0895655453f},
-std::array<float,2>{0.0637422949f, 0.654855788f},
-std::array<float,2>{0.839375615f, 0.0422738865f},
-std::array<float,2>{0.55400914f, 0.782065094f},
-std::array<float,2>{0.315126479f, 0.463355005f},
-std::array<float,2>{0.427049786f, 0.973227561f},
-std::array<float,2>{0.731965303f, 0.32736969f},
-std::array<float,2>{0.899330318f, 0.580722511f},
-std::array<float,2>{0.135192797f, 0.158525318f},
-std::array<float,2>{0.40463227f, 0.57716167f},
-std::array<float,2>{0.712278545f, 0.182429641f},
-std::array<float,2>{0.922249138f, 0.996713221f},
-std::array<float,2>{0.175754175f, 0.340918303f},
-std::array<float,2>{0.109385774f, 0.80669111f},
-std::array<float,2>{0.873040497f, 0.444956511f},
-std::array<float,2>{0.52217406f, 0.638791442f},
-std::array<float,2>{0.366429031f, 0.061960984f},
-std::array<float,2>{0.202811748f, 0.718760848f},
-std::array<float,2>{0.983715296f, 0.0772002786f},
-std::array<float,2>{0.686983526f, 0.855569303f},
-std::array<float,2>{0.49067238f, 0.403888911f},
-std::array<float,2>{0.308407128f, 0.911996663f},
-std::array<float,2>{0.577794552f, 0.304326475f},
-std::array<float,2>{0.782417059f, 0.517114639f},
-std::array<float,2>{0.0433800034f, 0.216252536f},
-std::array<float,2>{0.339012176f, 0.671880305f},
-std::array<float,2>{0.535175622f, 0.0208619162f},
-std::array<float,2>{0.812773705f, 0.778889954f},
-std::array<float,2>{0.0870750472f, 0.48677206f},
-std::array<float,2>{0.151055381f, 0.951248467f},
-std::array<float,2>{0.880083144f, 0.348968059f},
-std::array<float,2>{0.741490662f, 0.615284503f},
-std::array<float,2>{0.408267707f, 0.1503506f},
-std::array<float,2>{0.0302870069f, 0.543885708f},
-std::array<float,2>{0.776704788f, 0.246634647f},
-std::array<float,2>{0.622737527f, 0.898358405f},
-std::array<float,2>{0.273565024f, 0.263255209f},
-std::array<float,2>{0.440143645f, 0.835070133f},
-std::array<float,2>{0.650856972f, 0.430328846f},
-std::array<float,2>{0.938612759f, 0.702990592f},
-std::array<float,2>{0.249965608f, 0.121070959f},
-std::array<float,2>{0.415929705f, 0.625728726f},
-std::array<float,2>{0.747252524f, 0.0511280634f},
-std::array<float,2>{0.88723892f, 0.799637139f},
-std::array<float,2>{0.148028433f, 0.450759202f},
-std::array<float,2>{0.0843492746f, 0.987914741f},
-std::array<float,2>{0.821998775f, 0.328214735f},
-std::array<float,2>{0.545807242f, 0.565785944f},
-std::array<float,2>{0.329275697f, 0.175340384f},
-std::array<float,2>{0.236006916f, 0.529542089f},
-std::array<float,2>{0.947966099f, 0.210517704f},
-std::array<float,2>{0.643673301f, 0.920119226f},
-std::array<float,2>{0.452967048f, 0.308422595f},
-std::array<float,2>{0.270310998f, 0.848038018f},
-std::array<float,2>{0.609448433f, 0.397784799f},
-std::array<float,2>{0.766315639f, 0.728030384f},
-std::array<float,2>{0.0202024858f, 0.06404531f},
-std::array<float,2>{0.373538703f, 0.618776441f},
-std::array<float,2>{0.52663368f, 0.144254401f},
-std::array<float,2>{0.861712694f, 0.942518413f},
-std::array<float,2>{0.119849421f, 0.358100086f},
-std::array<float,2>{0.183872119f, 0.772969961f},
-std::array<float,2>{0.936664462f, 0.494800925f},
-std::array<float,2>{0.707405448f, 0.681617498f},
-std::array<float,2>{0.392466962f, 0.0234869458f},
-std::array<float,2>{0.0371202976f, 0.689091802f},
-std::array<float,2>{0.796569705f, 0.10960824f},
-std::array<float,2>{0.566594005f, 0.842820644f},
-std::array<float,2>{0.298438221f, 0.424785763f},
-std::array<float,2>{0.494028777f, 0.900261343f},
-std::array<float,2>{0.675294936f, 0.253241807f},
-std::array<float,2>{0.968983769f, 0.535832465f},
-std::array<float,2>{0.191760018f, 0.23890543f},
-std::array<float,2>{0.458202124f, 0.555957973f},
-std::array<float,2>{0.629558861f, 0.227284729f},
-std::array<float,2>{0.966198504f, 0.888774216f},
-std::array<float,2>{0.229546294f, 0.277164578f},
-std::array<float,2>{0.0146175278f, 0.826533318f},
-std::array<float,2>{0.753174424f, 0.418860286f},
-std::array<float,2>{0.600464225f, 0.707531869f},
-std::array<float,2>{0.263262868f, 0.0963420272f},
-std::array<float,2>{0.127802879f, 0.665073693f},
-std::array<float,2>{0.892751634f, 0.00850690156f},
-std::array<float,2>{0.725038767f, 0.756611109f},
-std::array<float,2>{0.433760613f, 0.48190257f},
-std::array<float,2>{0.327088416f, 0.954665542f},
-std::array<float,2>{0.560129166f, 0.373187244f},
-std::array<float,2>{0.834373534f, 0.597418666f},
-std::array<float,2>{0.0764999017f, 0.131140381f},
-std::array<float,2>{0.28355965f, 0.749725163f},
-std::array<float,2>{0.578171432f, 0.0816555768f},
-std::array<float,2>{0.809111476f, 0.861246228f},
-std::array<float,2>{0.0534659252f, 0.378536493f},
-std::array<float,2>{0.204511508f, 0.92623651f},
-std::array<float,2>{0.994359493f, 0.293330818f},
-std::array<float,2>{0.665735364f, 0.502287209f},
-std::array<float,2>{0.479241014f, 0.191388205f},
-std::array<float,2>{0.0969046578f, 0.587124527f},
-std::array<float,2>{0.85461545f, 0.16444388f},
-std::array<float,2>{0.510002136f, 0.978220761f},
-std::array<float,2>{0.346661091f, 0.316044122f},
-std::array<float,2>{0.389960259f, 0.789411247f},
-std::array<float,2>{0.695911825f, 0.458923757f},
-std::array<float,2>{0.906800628f, 0.642185152f},
-std::array<float,2>{0.170036986f, 0.0316504538f},
-std::array<float,2>{0.423435211f, 0.693314075f},
-std::array<float,2>{0.727039516f, 0.1171652f},
-std::array<float,2>{0.90438062f, 0.83861202f},
-std::array<float,2>{0.138454407f, 0.428151548f},
-std::array<float,2>{0.0679445043f, 0.905313909f},
-std::array<float,2>{0.842257857f, 0.255025893f},
-std::array<float,2>{0.546937406f, 0.532347977f},
-std::array<float,2>{0.319995046f, 0.237702459f},
-std::array<float,2>{0.219058439f, 0.622871637f},
-std::array<float,2>{0.957796574f, 0.148021445f},
-std::array<float,2>{0.639584899f, 0.938847959f},
-std::array<float,2>{0.466858983f, 0.353155345f},
-std::array<float,2>{0.251973152f, 0.766759455f},
-std::array<float,2>{0.60178113f, 0.496687412f},
-std::array<float,2>{0.758852959f, 0.684016049f},
-std::array<float,2>{0.00496409833f, 0.0284993462f},
-std::array<float,2>{0.357406586f, 0.5247159f},
-std::array<float,2>{0.505900204f, 0.205626458f},
-std::array<float,2>{0.848479509f, 0.914105177f},
-std::array<float,2>{0.107512079f, 0.311235607f},
-std::array<float,2>{0.161711529f, 0.845959604f},
-std::array<float,2>{0.918158591f, 0.391355753f},
-std::array<float,2>{0.690296352f, 0.734227479f},
-std::array<float,2>{0.37719813f, 0.0689296946f},
-std::array<float,2>{0.056849651f, 0.632008433f},
-std::array<float,2>{0.797526181f, 0.0483709015f},
-std::array<float,2>{0.59112078f, 0.802450478f},
-std::array<float,2>{0.292323858f, 0.446370602f},
-std::array<float,2>{0.472592533f, 0.989512742f},
-std::array<float,2>{0.661230206f, 0.333770871f},
-std::array<float,2>{0.986061752f, 0.569970667f},
-std::array<float,2>{0.21557571f, 0.177297115f},
-std::array<float,2>{0.442594081f, 0.591397822f},
-std::array<float,2>{0.654662788f, 0.171147212f},
-std::array<float,2>{0.945254326f, 0.981589317f},
-std::array<float,2>{0.242505759f, 0.318484992f},
-std::array<float,2>{0.0249224845f, 0.793292344f},
-std::array<float,2>{0.777827203f, 0.454380602f},
-std::array<float,2>{0.617798209f, 0.644794524f},
-std::array<float,2>{0.280880332f, 0.0352123268f},
-std::array<float,2>{0.152407959f, 0.742566705f},
-std::array<float,2>{0.877657712f, 0.0851513445f},
-std::array<float,2>{0.735282481f, 0.865077734f},
-std::array<float,2>{0.410462201f, 0.381527394f},
-std::array<float,2>{0.340858996f, 0.924661875f},
-std::array<float,2>{0.532938004f, 0.291871816f},
-std::array<float,2>{0.819801688f, 0.5072878f},
-std::array<float,2>{0.0916605219f, 0.194529787f},
-std::array<float,2>{0.311914653f, 0.671333075f},
-std::array<float,2>{0.571409345f, 0.0142242881f},
-std::array<float,2>{0.788633168f, 0.752451122f},
-std::array<float,2>{0.0409141965f, 0.476980776f},
-std::array<float,2>{0.198901579f, 0.958917618f},
-std::array<float,2>{0.979756176f, 0.370461226f},
-std::array<float,2>{0.681347668f, 0.601216376f},
-std::array<float,2>{0.4879269f, 0.125022769f},
-std::array<float,2>{0.117027506f, 0.560654819f},
-std::array<float,2>{0.870776594f, 0.230976984f},
-std::array<float,2>{0.518247187f, 0.885294259f},
-std::array<float,2>{0.361566126f, 0.278855473f},
-std::array<float,2>{0.398587018f, 0.821749926f},
-std::array<float,2>{0.71631074f, 0.417695612f},
-std::array<float,2>{0.928980052f, 0.70568943f},
-std::array<float,2>{0.177841634f, 0.100904696f},
-std::array<float,2>{0.497201502f, 0.650440812f},
-std::array<float,2>{0.677525401f, 0.0453409217f},
-std::array<float,2>{0.973338604f, 0.78559643f},
-std::array<float,2>{0.190368533f, 0.468524814f},
-std::array<float,2>{0.0324027091f, 0.971504986f},
-std::array<float,2>{0.789860189f, 0.321837902f},
-std::array<float,2>{0.562737823f, 0.585074663f},
-std::array<float,2>{0.301131636f, 0.160390437f},
-std::array<float,2>{0.18119058f, 0.51390177f},
-std::array<float,2>{0.929823458f, 0.201974511f},
-std::array<float,2>{0.703362465f, 0.933759212f},
-std::array<float,2>{0.397581428f, 0.288646281f},
-std::array<float,2>{0.367689401f, 0.869351745f},
-std::array<float,2>{0.527815878f, 0.383036405f},
-std::array<float,2>{0.864775538f, 0.734888375f},
-std::array<float,2>{0.122989327f, 0.0909003615f},
-std::array<float,2>{0.268204182f, 0.604667962f},
-std::array<float,2>{0.613465428f, 0.13635017f},
-std::array<float,2>{0.772973478f, 0.967959881f},
-std::array<float,2>{0.0192407668f, 0.362899184f},
-std::array<float,2>{0.238913342f, 0.764984488f},
-std::array<float,2>{0.950656652f, 0.473611325f},
-std::array<float,2>{0.646582901f, 0.658543289f},
-std::array<float,2>{0.447912097f, 0.00163402606f},
-std::array<float,2>{0.0783036947f, 0.717345357f},
-std::array<float,2>{0.824890018f, 0.102077544f},
-std::array<float,2>{0.542380512f, 0.813732862f},
-std::array<float,2>{0.332978725f, 0.410704225f},
-std::array<float,2>{0.420366794f, 0.880806029f},
-std::array<float,2>{0.745467246f, 0.26918453f},
-std::array<float,2>{0.885445595f, 0.548084974f},
-std::array<float,2>{0.143143967f, 0.219642222f},
-std::array<float,2>{0.384311199f, 0.541293383f},
-std::array<float,2>{0.700458825f, 0.245709345f},
-std::array<float,2>{0.912752867f, 0.892800033f},
-std::array<float,2>{0.164343432f, 0.2593804f},
-std::array<float,2>{0.0978030264f, 0.831818938f},
-std::array<float,2>{0.858797371f, 0.435008019f},
-std::array<float,2>{0.513361216f, 0.69617492f},
-std::array<float,2>{0.347879857f, 0.122126624f},
-std::array<float,2>{0.207533941f, 0.67728126f},
-std::array<float,2>{0.996553838f, 0.0188515708f},
-std::array<float,2>{0.670597255f, 0.77611357f},
-std::array<float,2>{0.481749415f, 0.492097974f},
-std::array<float,2>{0.287999779f, 0.946075737f},
-std::array<float,2>{0.582521856f, 0.346040815f},
-std::array<float,2>{0.806295872f, 0.60947293f},
-std::array<float,2>{0.0496878624f, 0.155963197f},
-std::array<float,2>{0.322169185f, 0.722736537f},
-std::array<float,2>{0.554923892f, 0.0711313486f},
-std::array<float,2>{0.829139352f, 0.854008079f},
-std::array<float,2>{0.0708769858f, 0.400239944f},
-std::array<float,2>{0.129346818f, 0.91010797f},
-std::array<float,2>{0.896647036f, 0.300034553f},
-std::array<float,2>{0.722558498f, 0.522823691f},
-std::array<float,2>{0.429721683f, 0.213595733f},
-std::array<float,2>{0.0102824839f, 0.573873699f},
-std::array<float,2>{0.75453043f, 0.186569348f},
-std::array<float,2>{0.596678972f, 0.993841112f},
-std::array<float,2>{0.260815293f, 0.337303698f},
-std::array<float,2>{0.455523342f, 0.810080886f},
-std::array<float,2>{0.626857698f, 0.440277815f},
-std::array<float,2>{0.962083101f, 0.635750413f},
-std::array<float,2>{0.231279135f, 0.0551746339f},
-std::array<float,2>{0.462141663f, 0.738442659f},
-std::array<float,2>{0.633457065f, 0.086473465f},
-std::array<float,2>{0.956067383f, 0.872931123f},
-std::array<float,2>{0.223557577f, 0.389166832f},
-std::array<float,2>{0.000295960112f, 0.931811392f},
-std::array<float,2>{0.763944685f, 0.28494671f},
-std::array<float,2>{0.607866287f, 0.510555744f},
-std::array<float,2>{0.256842852f, 0.195683226f},
-std::array<float,2>{0.134272948f, 0.578204453f},
-std::array<float,2>{0.90074116f, 0.156925067f},
-std::array<float,2>{0.734228611f, 0.976155281f},
-std::array<float,2>{0.429527462f, 0.325132549f},
-std::array<float,2>{0.313607424f, 0.784672737f},
-std::array<float,2>{0.551938772f, 0.461101353f},
-std::array<float,2>{0.836979866f, 0.653541565f},
-std::array<float,2>{0.0659028143f, 0.0399455838f},
-std::array<float,2>{0.293159246f, 0.554481268f},
-std::array<float,2>{0.587301612f, 0.224666506f},
-std::array<float,2>{0.803070486f, 0.875285208f},
-std::array<float,2>{0.0606289543f, 0.269823283f},
-std::array<float,2>{0.214486599f, 0.81723392f},
-std::array<float,2>{0.988613605f, 0.409003735f},
-std::array<float,2>{0.65960592f, 0.714596748f},
-std::array<float,2>{0.475092322f, 0.106226757f},
-std::array<float,2>{0.103458039f, 0.663768947f},
-std::array<float,2>{0.844263613f, 0.00504144281f},
-std::array<float,2>{0.50253123f, 0.760232151f},
-std::array<float,2>{0.353443623f, 0.468834162f},
-std::array<float,2>{0.382185161f, 0.964060009f},
-std::array<float,2>{0.693362594f, 0.364170641f},
-std::array<float,2>{0.91462642f, 0.605567157f},
-std::array<float,2>{0.158883572f, 0.138233453f},
-std::array<float,2>{0.407541811f, 0.61363554f},
-std::array<float,2>{0.739180982f, 0.150799006f},
-std::array<float,2>{0.881992102f, 0.949325204f},
-std::array<float,2>{0.149624035f, 0.350596547f},
-std::array<float,2>{0.0879790187f, 0.779990733f},
-std::array<float,2>{0.816330492f, 0.48474431f},
-std::array<float,2>{0.537256777f, 0.674285531f},
-std::array<float,2>{0.336704344f, 0.0215494689f},
-std::array<float,2>{0.246977344f, 0.699239731f},
-std::array<float,2>{0.940502167f, 0.117676467f},
-std::array<float,2>{0.649366438f, 0.833060503f},
-std::array<float,2>{0.438908577f, 0.431875974f},
-std::array<float,2>{0.27663815f, 0.895219207f},
-std::array<float,2>{0.623863816f, 0.264062971f},
-std::array<float,2>{0.77493602f, 0.545859933f},
-std::array<float,2>{0.0277813338f, 0.249520361f},
-std::array<float,2>{0.364035279f, 0.637334466f},
-std::array<float,2>{0.521477044f, 0.0600273162f},
-std::array<float,2>{0.874140143f, 0.805161178f},
-std::array<float,2>{0.111990243f, 0.443055093f},
-std::array<float,2>{0.173538804f, 0.999441326f},
-std::array<float,2>{0.925427318f, 0.342966467f},
-std::array<float,2>{0.713393211f, 0.574858606f},
-std::array<float,2>{0.40412724f, 0.181468159f},
-std::array<float,2>{0.0463180579f, 0.519156456f},
-std::array<float,2>{0.783646226f, 0.216931909f},
-std::array<float,2>{0.5749681f, 0.913987279f},
-std::array<float,2>{0.305560619f, 0.300814509f},
-std::array<float,2>{0.489167929f, 0.859250247f},
-std::array<float,2>{0.68508631f, 0.40431416f},
-std::array<float,2>{0.981195092f, 0.720956922f},
-std::array<float,2>{0.200370595f, 0.0750701502f},
-std::array<float,2>{0.393534511f, 0.683282137f},
-std::array<float,2>{0.710434735f, 0.0266240425f},
-std::array<float,2>{0.934268534f, 0.771396995f},
-std::array<float,2>{0.187420204f, 0.494051278f},
-std::array<float,2>{0.117813587f, 0.94429785f},
-std::array<float,2>{0.860419035f, 0.357157677f},
-std::array<float,2>{0.523677886f, 0.620315671f},
-std::array<float,2>{0.372716486f, 0.141653657f},
-std::array<float,2>{0.195067734f, 0.538954794f},
-std::array<float,2>{0.971213818f, 0.241374671f},
-std::array<float,2>{0.672131479f, 0.902157784f},
-std::array<float,2>{0.495827883f, 0.251459092f},
-std::array<float,2>{0.299424767f, 0.84093076f},
-std::array<float,2>{0.569023669f, 0.422846407f},
-std::array<float,2>{0.794300258f, 0.690917909f},
-std::array<float,2>{0.0360159427f, 0.111633524f},
-std::array<float,2>{0.331603706f, 0.562918246f},
-std::array<float,2>{0.543544948f, 0.173450783f},
-std::array<float,2>{0.824217141f, 0.985079169f},
-std::array<float,2>{0.0828704983f, 0.330750465f},
-std::array<float,2>{0.145865947f, 0.798060834f},
-std::array<float,2>{0.889224648f, 0.452067971f},
-std::array<float,2>{0.748867571f, 0.6287238f},
-std::array<float,2>{0.417665511f, 0.0531176813f},
-std::array<float,2>{0.021824915f, 0.72889632f},
-std::array<float,2>{0.76777029f, 0.0657249391f},
-std::array<float,2>{0.612733781f, 0.849963963f},
-std::array<float,2>{0.272067279f, 0.395260364f},
-std::array<float,2>{0.450807542f, 0.918931067f},
-std::array<float,2>{0.641020834f, 0.306569546f},
-std::array<float,2>{0.945519447f, 0.527915716f},
-std::array<float,2>{0.236421451f, 0.208812341f},
-std::array<float,2>{0.478110462f, 0.500574827f},
-std::array<float,2>{0.666914046f, 0.188169748f},
-std::array<float,2>{0.993188679f, 0.929132223f},
-std::array<float,2>{0.206372529f, 0.296017498f},
-std::array<float,2>{0.0510860384f, 0.861829877f},
-std::array<float,2>{0.81058234f, 0.376518607f},
-std::array<float,2>{0.580307484f, 0.746651471f},
-std::array<float,2>{0.282298714f, 0.0782571882f},
-std::array<float,2>{0.168835387f, 0.644121349f},
-std::array<float,2>{0.908988774f, 0.0349186808f},
-std::array<float,2>{0.697974145f, 0.792480826f},
-std::array<float,2>{0.388222456f, 0.45938915f},
-std::array<float,2>{0.344479144f, 0.98046416f},
-std::array<float,2>{0.508430541f, 0.313117385f},
-std::array<float,2>{0.852491558f, 0.588866234f},
-std::array<float,2>{0.0945046619f, 0.166613951f},
-std::array<float,2>{0.265124708f, 0.709526598f},
-std::array<float,2>{0.599000394f, 0.0949904695f},
-std::array<float,2>{0.751109838f, 0.82442075f},
-std::array<float,2>{0.0118788611f, 0.420860648f},
-std::array<float,2>{0.227701008f, 0.887226582f},
-std::array<float,2>{0.967755556f, 0.273606151f},
-std::array<float,2>{0.63192445f, 0.556679547f},
-std::array<float,2>{0.459409297f, 0.229293495f},
-std::array<float,2>{0.0760802478f, 0.595443428f},
-std::array<float,2>{0.833817363f, 0.129568174f},
-std::array<float,2>{0.561136127f, 0.955764413f},
-std::array<float,2>{0.32524091f, 0.371419579f},
-std::array<float,2>{0.436378896f, 0.755443513f},
-std::array<float,2>{0.722765326f, 0.483850896f},
-std::array<float,2>{0.891180456f, 0.666648865f},
-std::array<float,2>{0.126268461f, 0.0111070005f},
-std::array<float,2>{0.430597246f, 0.725636363f},
-std::array<float,2>{0.721939385f, 0.073391661f},
-std::array<float,2>{0.8973068f, 0.852518857f},
-std::array<float,2>{0.129600495f, 0.401340336f},
-std::array<float,2>{0.0706393942f, 0.908131421f},
-std::array<float,2>{0.8296808f, 0.297190428f},
-std::array<float,2>{0.555614054f, 0.519708514f},
-std::array<float,2>{0.321412295f, 0.212316707f},
-std::array<float,2>{0.230675489f, 0.571041822f},
-std::array<float,2>{0.9628613f, 0.18478696f},
-std::array<float,2>{0.626408041f, 0.99433887f},
-std::array<float,2>{0.455781072f, 0.338202f},
-std::array<float,2>{0.261488467f, 0.811097205f},
-std::array<float,2>{0.596169651f, 0.439029187f},
-std::array<float,2>{0.754176259f, 0.63359195f},
-std::array<float,2>{0.00991979428f, 0.0571773276f},
-std::array<float,2>{0.348298997f, 0.539647758f},
-std::array<float,2>{0.513143897f, 0.243586898f},
-std::array<float,2>{0.859271228f, 0.891774058f},
-std::array<float,2>{0.0984475091f, 0.259982228f},
-std::array<float,2>{0.164989859f, 0.828768671f},
-std::array<float,2>{0.91212827f, 0.436102897f},
-std::array<float,2>{0.700724244f, 0.698253095f},
-std::array<float,2>{0.384195387f, 0.1237766f},
-std::array<float,2>{0.049151767f, 0.67947042f},
-std::array<float,2>{0.805983603f, 0.0164785329f},
-std::array<float,2>{0.582069516f, 0.775259614f},
-std::array<float,2>{0.287271291f, 0.488499582f},
-std::array<float,2>{0.482374221f, 0.947678447f},
-std::array<float,2>{0.670368254f, 0.345310539f},
-std::array<float,2>{0.997054696f, 0.612891793f},
-std::array<float,2>{0.207366839f, 0.15287818f},
-std::array<float,2>{0.447744846f, 0.603486121f},
-std::array<float,2>{0.647168338f, 0.133862197f},
-std::array<float,2>{0.950763881f, 0.965563536f},
-std::array<float,2>{0.238648042f, 0.359611392f},
-std::array<float,2>{0.0186574608f, 0.761963606f},
-std::array<float,2>{0.772833169f, 0.475741327f},
-std::array<float,2>{0.614105999f, 0.658043861f},
-std::array<float,2>{0.26760903f, 0.00212609977f},
-std::array<float,2>{0.142717585f, 0.715350151f},
-std::array<float,2>{0.884856403f, 0.105459742f},
-std::array<float,2>{0.745652616f, 0.815165401f},
-std::array<float,2>{0.420541614f, 0.412780643f},
-std::array<float,2>{0.332272202f, 0.882132411f},
-std::array<float,2>{0.542954028f, 0.267268032f},
-std::array<float,2>{0.82450664f, 0.550501287f},
-std::array<float,2>{0.079008095f, 0.221571296f},
-std::array<float,2>{0.301378012f, 0.648491383f},
-std::array<float,2>{0.563314915f, 0.0446631722f},
-std::array<float,2>{0.789505184f, 0.787406027f},
-std::array<float,2>{0.0329440124f, 0.465924174f},
-std::array<float,2>{0.189455166f, 0.97050786f},
-std::array<float,2>{0.972964466f, 0.322527617f},
-std::array<float,2>{0.677154183f, 0.582723618f},
-std::array<float,2>{0.497700065f, 0.163975537f},
-std::array<float,2>{0.122360535f, 0.51293993f},
-std::array<float,2>{0.864544749f, 0.200329825f},
-std::array<float,2>{0.528241932f, 0.936114728f},
-std::array<float,2>{0.367315918f, 0.285191476f},
-std::array<float,2>{0.398273408f, 0.867899597f},
-std::array<float,2>{0.703970671f, 0.386361927f},
-std::array<float,2>{0.930265903f, 0.737455249f},
-std::array<float,2>{0.180982545f, 0.0920971185f},
-std::array<float,2>{0.487450182f, 0.66797787f},
-std::array<float,2>{0.681031644f, 0.0117715215f},
-std::array<float,2>{0.980140865f, 0.750868022f},
-std::array<float,2>{0.198415831f, 0.480117768f},
-std::array<float,2>{0.0400723964f, 0.960101843f},
-std::array<float,2>{0.78837353f, 0.368267983f},
-std::array<float,2>{0.571964264f, 0.59779197f},
-std::array<float,2>{0.312101573f, 0.128635243f},
-std::array<float,2>{0.178378239f, 0.558638215f},
-std::array<float,2>{0.929205775f, 0.232464746f},
-std::array<float,2>{0.716226399f, 0.883737504f},
-std::array<float,2>{0.399169236f, 0.280581951f},
-std::array<float,2>{0.362203538f, 0.822559774f},
-std::array<float,2>{0.517846823f, 0.415555865f},
-std::array<float,2>{0.870584965f, 0.703372657f},
-std::array<float,2>{0.116537698f, 0.0992103294f},
-std::array<float,2>{0.2803047f, 0.592696726f},
-std::array<float,2>{0.61722368f, 0.169508308f},
-std::array<float,2>{0.777942836f, 0.984291315f},
-std::array<float,2>{0.0248097274f, 0.318178803f},
-std::array<float,2>{0.243161887f, 0.796580434f},
-std::array<float,2>{0.944432795f, 0.455830365f},
-std::array<float,2>{0.654810786f, 0.647332728f},
-std::array<float,2>{0.443047851f, 0.0390244797f},
-std::array<float,2>{0.0912993923f, 0.744716942f},
-std::array<float,2>{0.820018888f, 0.0824257433f},
-std::array<float,2>{0.532374561f, 0.866214514f},
-std::array<float,2>{0.341351241f, 0.380324006f},
-std::array<float,2>{0.411084443f, 0.922325015f},
-std::array<float,2>{0.734771371f, 0.290112436f},
-std::array<float,2>{0.876982391f, 0.505046964f},
-std::array<float,2>{0.15307945f, 0.192736447f},
-std::array<float,2>{0.377604127f, 0.52581352f},
-std::array<float,2>{0.689743221f, 0.203192234f},
-std::array<float,2>{0.91848135f, 0.917278528f},
-std::array<float,2>{0.161360383f, 0.309344411f},
-std::array<float,2>{0.108221471f, 0.845055223f},
-std::array<float,2>{0.847964406f, 0.394138485f},
-std::array<float,2>{0.506498158f, 0.73104012f},
-std::array<float,2>{0.356450558f, 0.0673809424f},
-std::array<float,2>{0.214932382f, 0.629955113f},
-std::array<float,2>{0.985672057f, 0.0497869886f},
-std::array<float,2>{0.661677957f, 0.802897632f},
-std::array<float,2>{0.471910775f, 0.447730452f},
-std::array<float,2>{0.292506456f, 0.990472972f},
-std::array<float,2>{0.591785073f, 0.335627139f},
-std::array<float,2>{0.797126651f, 0.567428708f},
-std::array<float,2>{0.0575125292f, 0.178867668f},
-std::array<float,2>{0.31938234f, 0.693831384f},
-std::array<float,2>{0.547608733f, 0.114581533f},
-std::array<float,2>{0.842511773f, 0.837023318f},
-std::array<float,2>{0.0675998777f, 0.427538663f},
-std::array<float,2>{0.137792647f, 0.903307557f},
-std::array<float,2>{0.904888272f, 0.256803453f},
-std::array<float,2>{0.727349102f, 0.534523785f},
-std::array<float,2>{0.422969997f, 0.234473512f},
-std::array<float,2>{0.00563783385f, 0.624316931f},
-std::array<float,2>{0.759735107f, 0.144660503f},
-std::array<float,2>{0.602211535f, 0.940235257f},
-std::array<float,2>{0.252480239f, 0.355095804f},
-std::array<float,2>{0.467455447f, 0.769225001f},
-std::array<float,2>{0.638678074f, 0.49845922f},
-std::array<float,2>{0.957507133f, 0.686367393f},
-std::array<float,2>{0.219716877f, 0.0299731828f},
-std::array<float,2>{0.459715217f, 0.707272112f},
-std::array<float,2>{0.632335305f, 0.095809944f},
-std::array<float,2>{0.967027962f, 0.826933622f},
-std::array<float,2>{0.228157207f, 0.418273807f},
-std::array<float,2>{0.0126555134f, 0.889538348f},
-std::array<float,2>{0.751891911f, 0.276489168f},
-std::array<float,2>{0.599545121f, 0.55633831f},
-std::array<float,2>{0.265281737f, 0.226816967f},
-std::array<float,2>{0.126701981f, 0.596729398f},
-std::array<float,2>{0.890914321f, 0.131595328f},
-std::array<float,2>{0.723244429f, 0.954245925f},
-std::array<float,2>{0.436032712f, 0.373775303f},
-std::array<float,2>{0.325759828f, 0.756011724f},
-std::array<float,2>{0.560786188f, 0.482278466f},
-std::array<float,2>{0.833475947f, 0.665933013f},
-std::array<float,2>{0.0755839944f, 0.00819738582f},
-std::array<float,2>{0.282958567f, 0.502485991f},
-std::array<float,2>{0.580953777f, 0.190680638f},
-std::array<float,2>{0.811212838f, 0.926560938f},
-std::array<float,2>{0.0513084382f, 0.293523401f},
-std::array<float,2>{0.206766009f, 0.860651612f},
-std::array<float,2>{0.993782341f, 0.378007144f},
-std::array<float,2>{0.666255951f, 0.749273777f},
-std::array<float,2>{0.478014112f, 0.0812989771f},
-std::array<float,2>{0.0940421894f, 0.641714633f},
-std::array<float,2>{0.85161227f, 0.0320682898f},
-std::array<float,2>{0.507883251f, 0.789836168f},
-std::array<float,2>{0.3439008f, 0.458033323f},
-std::array<float,2>{0.387771279f, 0.9777475f},
-std::array<float,2>{0.697562277f, 0.315549463f},
-std::array<float,2>{0.908276975f, 0.587458432f},
-std::array<float,2>{0.168437883f, 0.164768964f},
-std::array<float,2>{0.417139411f, 0.566260993f},
-std::array<float,2>{0.748452604f, 0.1751623f},
-std::array<float,2>{0.888943017f, 0.987334967f},
-std::array<float,2>{0.146176293f, 0.328749985f},
-std::array<float,2>{0.082439065f, 0.79883039f},
-std::array<float,2>{0.823447108f, 0.450605631f},
-std::array<float,2>{0.543428123f, 0.625307381f},
-std::array<float,2>{0.331090689f, 0.051467672f},
-std::array<float,2>{0.237304643f, 0.727622092f},
-std::array<float,2>{0.946129918f, 0.0635882095f},
-std::array<float,2>{0.641293406f, 0.848543704f},
-std::array<float,2>{0.450380772f, 0.398148954f},
-std::array<float,2>{0.271582723f, 0.920575619f},
-std::array<float,2>{0.613232374f, 0.308055401f},
-std::array<float,2>{0.768261552f, 0.530238211f},
-std::array<float,2>{0.0223170351f, 0.210446179f},
-std::array<float,2>{0.372509003f, 0.680791914f},
-std::array<float,2>{0.524145305f, 0.0242183097f},
-std::array<float,2>{0.861160278f, 0.772878706f},
-std::array<float,2>{0.117545642f, 0.494369626f},
-std::array<float,2>{0.186628088f, 0.943278372f},
-std::array<float,2>{0.933694839f, 0.357857823f},
-std::array<float,2>{0.710794985f, 0.618507326f},
-std::array<float,2>{0.392994434f, 0.143586904f},
-std::array<float,2>{0.0353882089f, 0.535206676f},
-std::array<float,2>{0.794663727f, 0.238713726f},
-std::array<float,2>{0.56837672f, 0.899671197f},
-std::array<float,2>{0.299189925f, 0.253453583f},
-std::array<float,2>{0.495541781f, 0.843717039f},
-std::array<float,2>{0.672823668f, 0.424027056f},
-std::array<float,2>{0.970729351f, 0.688541234f},
-std::array<float,2>{0.194708124f, 0.110157892f},
-std::array<float,2>{0.403615981f, 0.639542103f},
-std::array<float,2>{0.713339925f, 0.0624285154f},
-std::array<float,2>{0.924900353f, 0.807579577f},
-std::array<float,2>{0.173190773f, 0.444404423f},
-std::array<float,2>{0.111343965f, 0.99653399f},
-std::array<float,2>{0.874704003f, 0.341680795f},
-std::array<float,2>{0.520969391f, 0.577828586f},
-std::array<float,2>{0.363526821f, 0.18182686f},
-std::array<float,2>{0.20112893f, 0.517031133f},
-std::array<float,2>{0.980557799f, 0.216323018f},
-std::array<float,2>{0.684817493f, 0.911580443f},
-std::array<float,2>{0.4883461f, 0.303807944f},
-std::array<float,2>{0.305074483f, 0.856171012f},
-std::array<float,2>{0.57429117f, 0.403775662f},
-std::array<float,2>{0.784135401f, 0.719709039f},
-std::array<float,2>{0.0467972122f, 0.0778072625f},
-std::array<float,2>{0.336359382f, 0.616058886f},
-std::array<float,2>{0.537646592f, 0.149552748f},
-std::array<float,2>{0.815501332f, 0.952122808f},
-std::array<float,2>{0.0887746289f, 0.349192977f},
-std::array<float,2>{0.150165543f, 0.778785586f},
-std::array<float,2>{0.88235414f, 0.487071484f},
-std::array<float,2>{0.738518953f, 0.672778487f},
-std::array<float,2>{0.407871068f, 0.0209968798f},
-std::array<float,2>{0.027928805f, 0.702506721f},
-std::array<float,2>{0.774669349f, 0.120165773f},
-std::array<float,2>{0.623269141f, 0.835472941f},
-std::array<float,2>{0.276971996f, 0.430058002f},
-std::array<float,2>{0.439121425f, 0.897790611f},
-std::array<float,2>{0.648806512f, 0.262877762f},
-std::array<float,2>{0.94108361f, 0.5432899f},
-std::array<float,2>{0.246572822f, 0.246531382f},
-std::array<float,2>{0.475479752f, 0.552019298f},
-std::array<float,2>{0.660120249f, 0.223778382f},
-std::array<float,2>{0.98884517f, 0.878706634f},
-std::array<float,2>{0.21400629f, 0.272901356f},
-std::array<float,2>{0.0611223169f, 0.819805503f},
-std::array<float,2>{0.803400338f, 0.407003254f},
-std::array<float,2>{0.587424219f, 0.712730706f},
-std::array<float,2>{0.293614596f, 0.107903622f},
-std::array<float,2>{0.158411786f, 0.660292089f},
-std::array<float,2>{0.914380729f, 0.00680082431f},
-std::array<float,2>{0.693920851f, 0.759091973f},
-std::array<float,2>{0.382508665f, 0.471220464f},
-std::array<float,2>{0.3526766f, 0.961746931f},
-std::array<float,2>{0.502186418f, 0.366264939f},
-std::array<float,2>{0.844108582f, 0.609367967f},
-std::array<float,2>{0.102815218f, 0.140181452f},
-std::array<float,2>{0.257511824f, 0.741720498f},
-std::array<float,2>{0.608071089f, 0.0892739296f},
-std::array<float,2>{0.764612794f, 0.873264253f},
-std::array<float,2>{0.00063419115f, 0.387332737f},
-std::array<float,2>{0.223079443f, 0.930226743f},
-std::array<float,2>{0.956848085f, 0.282587528f},
-std::array<float,2>{0.633150816f, 0.508301377f},
-std::array<float,2>{0.462437719f, 0.198440298f},
-std::array<float,2>{0.0660691783f, 0.580089211f},
-std::array<float,2>{0.83746016f, 0.158976004f},
-std::array<float,2>{0.552453637f, 0.972887039f},
-std::array<float,2>{0.314317226f, 0.327681243f},
-std::array<float,2>{0.429100096f, 0.781682611f},
-std::array<float,2>{0.733828545f, 0.463544607f},
-std::array<float,2>{0.900965631f, 0.654482782f},
-std::array<float,2>{0.134391919f, 0.0425167121f},
-std::array<float,2>{0.386281371f, 0.695762336f},
-std::array<float,2>{0.702988684f, 0.123009622f},
-std::array<float,2>{0.910358071f, 0.831211209f},
-std::array<float,2>{0.167522013f, 0.435292751f},
-std::array<float,2>{0.100618884f, 0.893532813f},
-std::array<float,2>{0.85569948f, 0.258904189f},
-std::array<float,2>{0.514068663f, 0.541646481f},
-std::array<float,2>{0.350576133f, 0.2455547f},
-std::array<float,2>{0.210664198f, 0.610123992f},
-std::array<float,2>{0.998301089f, 0.155580357f},
-std::array<float,2>{0.668518126f, 0.945371807f},
-std::array<float,2>{0.484273821f, 0.346334964f},
-std::array<float,2>{0.286399543f, 0.775465846f},
-std::array<float,2>{0.584113538f, 0.491586477f},
-std::array<float,2>{0.806861162f, 0.677139401f},
-std::array<float,2>{0.0483919345f, 0.0193128586f},
-std::array<float,2>{0.323920041f, 0.523111999f},
-std::array<float,2>{0.558266401f, 0.212898508f},
-std::array<float,2>{0.830746353f, 0.90949291f},
-std::array<float,2>{0.0734442919f, 0.300342947f},
-std::array<float,2>{0.132626742f, 0.853926182f},
-std::array<float,2>{0.896310449f, 0.399820209f},
-std::array<float,2>{0.718805611f, 0.723322153f},
-std::array<float,2>{0.432507187f, 0.0706524104f},
-std::array<float,2>{0.00923760422f, 0.636674762f},
-std::array<float,2>{0.757025123f, 0.0554232597f},
-std::array<float,2>{0.593885541f, 0.810053825f},
-std::array<float,2>{0.259522796f, 0.439473212f},
-std::array<float,2>{0.454651713f, 0.99361068f},
-std::array<float,2>{0.628684103f, 0.337530017f},
-std::array<float,2>{0.963252187f, 0.573603749f},
-std::array<float,2>{0.233007565f, 0.187266931f},
-std::array<float,2>{0.499185979f, 0.585682869f},
-std::array<float,2>{0.67806071f, 0.161043316f},
-std::array<float,2>{0.975273311f, 0.971158147f},
-std::array<float,2>{0.187771246f, 0.321313232f},
-std::array<float,2>{0.0343083106f, 0.785712838f},
-std::array<float,2>{0.792556047f, 0.46800074f},
-std::array<float,2>{0.564908803f, 0.651288629f},
-std::array<float,2>{0.303984463f, 0.0456994325f},
-std::array<float,2>{0.182113722f, 0.734706163f},
-std::array<float,2>{0.932425797f, 0.0914794281f},
-std::array<float,2>{0.706177115f, 0.86975652f},
-std::array<float,2>{0.39611277f, 0.383553684f},
-std::array<float,2>{0.369147509f, 0.934420824f},
-std::array<float,2>{0.53113848f, 0.28851831f},
-std::array<float,2>{0.865641057f, 0.514499962f},
-std::array<float,2>{0.12459147f, 0.201630816f},
-std::array<float,2>{0.266844153f, 0.659040332f},
-std::array<float,2>{0.616963089f, 0.00121261226f},
-std::array<float,2>{0.770678163f, 0.765310109f},
-std::array<float,2>{0.0175417066f, 0.472882926f},
-std::array<float,2>{0.240839034f, 0.968355775f},
-std::array<float,2>{0.951230347f, 0.362392843f},
-std::array<float,2>{0.645217061f, 0.605461121f},
-std::array<float,2>{0.445364296f, 0.13590543f},
-std::array<float,2>{0.0802540183f, 0.548808753f},
-std::array<float,2>{0.826180577f, 0.218895555f},
-std::array<float,2>{0.53973335f, 0.88034457f},
-std::array<float,2>{0.335234284f, 0.269017696f},
-std::array<float,2>{0.419053823f, 0.814036965f},
-std::array<float,2>{0.743415833f, 0.410520673f},
-std::array<float,2>{0.882873058f, 0.717143059f},
-std::array<float,2>{0.142068982f, 0.101604797f},
-std::array<float,2>{0.444841653f, 0.645062506f},
-std::array<float,2>{0.652816772f, 0.0359588712f},
-std::array<float,2>{0.941553056f, 0.793772995f},
-std::array<float,2>{0.245024696f, 0.454973787f},
-std::array<float,2>{0.0264766365f, 0.982406855f},
-std::array<float,2>{0.780210257f, 0.319053322f},
-std::array<float,2>{0.61947459f, 0.590952218f},
-std::array<float,2>{0.278490156f, 0.171751842f},
-std::array<float,2>{0.155267522f, 0.507729769f},
-std::array<float,2>{0.875885069f, 0.195121616f},
-std::array<float,2>{0.736626565f, 0.924125135f},
-std::array<float,2>{0.414056599f, 0.291285276f},
-std::array<float,2>{0.342135787f, 0.864530742f},
-std::array<float,2>{0.533480883f, 0.380924195f},
-std::array<float,2>{0.816767156f, 0.74304539f},
-std::array<float,2>{0.0924922377f, 0.0856115445f},
-std::array<float,2>{0.309424341f, 0.600869954f},
-std::array<float,2>{0.573200583f, 0.12579298f},
-std::array<float,2>{0.785519063f, 0.958370924f},
-std::array<float,2>{0.041910883f, 0.371080369f},
-std::array<float,2>{0.196715102f, 0.751995802f},
-std::array<float,2>{0.978352547f, 0.477071136f},
-std::array<float,2>{0.682988346f, 0.671387613f},
-std::array<float,2>{0.484620333f, 0.0140907075f},
-std::array<float,2>{0.114366136f, 0.705247939f},
-std::array<float,2>{0.867660403f, 0.101523779f},
-std::array<float,2>{0.517074347f, 0.822042584f},
-std::array<float,2>{0.360453576f, 0.417370439f},
-std::array<float,2>{0.401064426f, 0.885213614f},
-std::array<float,2>{0.718301952f, 0.278805643f},
-std::array<float,2>{0.927273571f, 0.561241031f},
-std::array<float,2>{0.176205218f, 0.230871052f},
-std::array<float,2>{0.424715281f, 0.533097208f},
-std::array<float,2>{0.728721619f, 0.238076076f},
-std::array<float,2>{0.902676642f, 0.906157196f},
-std::array<float,2>{0.139168456f, 0.255438149f},
-std::array<float,2>{0.0685699284f, 0.837934852f},
-std::array<float,2>{0.841601372f, 0.42861253f},
-std::array<float,2>{0.550579727f, 0.692398131f},
-std::array<float,2>{0.31727758f, 0.116409339f},
-std::array<float,2>{0.222312108f, 0.684264481f},
-std::array<float,2>{0.959222972f, 0.0292041879f},
-std::array<float,2>{0.636912405f, 0.767533004f},
-std::array<float,2>{0.465928137f, 0.496407866f},
-std::array<float,2>{0.251798391f, 0.939245403f},
-std::array<float,2>{0.605444491f, 0.352731436f},
-std::array<float,2>{0.760854185f, 0.622373581f},
-std::array<float,2>{0.00644876063f, 0.147917643f},
-std::array<float,2>{0.357789189f, 0.733563006f},
-std::array<float,2>{0.505597174f, 0.0684246868f},
-std::array<float,2>{0.851047277f, 0.846309602f},
-std::array<float,2>{0.106483936f, 0.39103511f},
-std::array<float,2>{0.162650436f, 0.91475141f},
-std::array<float,2>{0.920445621f, 0.310861856f},
-std::array<float,2>{0.688353717f, 0.525001585f},
-std::array<float,2>{0.376047403f, 0.205527514f},
-std::array<float,2>{0.0558698103f, 0.569803655f},
-std::array<float,2>{0.799714029f, 0.177142307f},
-std::array<float,2>{0.592631698f, 0.990102172f},
-std::array<float,2>{0.290236294f, 0.333016843f},
-std::array<float,2>{0.470114589f, 0.802171648f},
-std::array<float,2>{0.662761867f, 0.446909845f},
-std::array<float,2>{0.986638725f, 0.63240844f},
-std::array<float,2>{0.217841953f, 0.0482133292f},
-std::array<float,2>{0.478742421f, 0.746447921f},
-std::array<float,2>{0.665152848f, 0.0788942873f},
-std::array<float,2>{0.994806349f, 0.861732304f},
-std::array<float,2>{0.204776719f, 0.375997514f},
-std::array<float,2>{0.0530460328f, 0.929226935f},
-std::array<float,2>{0.808961451f, 0.29642877f},
-std::array<float,2>{0.578753352f, 0.500316918f},
-std::array<float,2>{0.284054607f, 0.187949538f},
-std::array<float,2>{0.170857131f, 0.588011324f},
-std::array<float,2>{0.906587362f, 0.16638428f},
-std::array<float,2>{0.695718527f, 0.979643226f},
-std::array<float,2>{0.390398264f, 0.312512845f},
-std::array<float,2>{0.346103638f, 0.792252302f},
-std::array<float,2>{0.510394335f, 0.459634662f},
-std::array<float,2>{0.855451405f, 0.643654704f},
-std::array<float,2>{0.0973454416f, 0.0346253775f},
-std::array<float,2>{0.263177067f, 0.557341695f},
-std::array<float,2>{0.600051761f, 0.228950605f},
-std::array<float,2>{0.753643692f, 0.887064874f},
-std::array<float,2>{0.0137857618f, 0.274275035f},
-std::array<float,2>{0.230416402f, 0.824980855f},
-std::array<float,2>{0.966537297f, 0.420015723f},
-std::array<float,2>{0.629241884f, 0.709228039f},
-std::array<float,2>{0.458770514f, 0.0955939963f},
-std::array<float,2>{0.0769210979f, 0.666280985f},
-std::array<float,2>{0.834790707f, 0.011611186f},
-std::array<float,2>{0.559581757f, 0.755210817f},
-std::array<float,2>{0.326392531f, 0.484295219f},
-std::array<float,2>{0.434093714f, 0.95529002f},
-std::array<float,2>{0.725245237f, 0.372051239f},
-std::array<float,2>{0.893164635f, 0.594992995f},
-std::array<float,2>{0.127379656f, 0.128933772f},
-std::array<float,2>{0.391751349f, 0.62071687f},
-std::array<float,2>{0.708001852f, 0.142539158f},
-std::array<float,2>{0.937410057f, 0.943751454f},
-std::array<float,2>{0.184278831f, 0.356735975f},
-std::array<float,2>{0.119373083f, 0.770670891f},
-std::array<float,2>{0.862146854f, 0.493282467f},
-std::array<float,2>{0.527252257f, 0.682777882f},
-std::array<float,2>{0.373063177f, 0.0268984027f},
-std::array<float,2>{0.191975504f, 0.691071987f},
-std::array<float,2>{0.969406247f, 0.112137593f},
-std::array<float,2>{0.675282955f, 0.841738164f},
-std::array<float,2>{0.493271679f, 0.421908587f},
-std::array<float,2>{0.297875255f, 0.90147841f},
-std::array<float,2>{0.567143917f, 0.251829118f},
-std::array<float,2>{0.796213448f, 0.53842473f},
-std::array<float,2>{0.0377563648f, 0.241714939f},
-std::array<float,2>{0.329664707f, 0.628174305f},
-std::array<float,2>{0.545040011f, 0.0536621548f},
-std::array<float,2>{0.821469486f, 0.798621058f},
-std::array<float,2>{0.0848075077f, 0.451479495f},
-std::array<float,2>{0.147945613f, 0.98473829f},
-std::array<float,2>{0.887167811f, 0.330291867f},
-std::array<float,2>{0.747729778f, 0.563043177f},
-std::array<float,2>{0.415473402f, 0.17327559f},
-std::array<float,2>{0.019544825f, 0.527672708f},
-std::array<float,2>{0.765851438f, 0.208221674f},
-std::array<float,2>{0.610226929f, 0.918380976f},
-std::array<float,2>{0.2699157f, 0.306006223f},
-std::array<float,2>{0.452249855f, 0.850179732f},
-std::array<float,2>{0.644209743f, 0.394764036f},
-std::array<float,2>{0.947498202f, 0.729185462f},
-std::array<float,2>{0.235379457f, 0.0659411177f},
-std::array<float,2>{0.409050286f, 0.674709022f},
-std::array<float,2>{0.742107391f, 0.0220310092f},
-std::array<float,2>{0.880376816f, 0.77949661f},
-std::array<float,2>{0.150562391f, 0.485127747f},
-std::array<float,2>{0.087682806f, 0.949876726f},
-std::array<float,2>{0.813279152f, 0.351125389f},
-std::array<float,2>{0.535738707f, 0.613906145f},
-std::array<float,2>{0.339578897f, 0.151014343f},
-std::array<float,2>{0.249198169f, 0.544996679f},
-std::array<float,2>{0.939400613f, 0.249088526f},
-std::array<float,2>{0.65122658f, 0.894934773f},
-std::array<float,2>{0.439739138f, 0.264366716f},
-std::array<float,2>{0.274289042f, 0.833855569f},
-std::array<float,2>{0.622516513f, 0.432520479f},
-std::array<float,2>{0.776893198f, 0.699993849f},
-std::array<float,2>{0.0308646541f, 0.117355347f},
-std::array<float,2>{0.36687386f, 0.574466527f},
-std::array<float,2>{0.521927357f, 0.18103081f},
-std::array<float,2>{0.872077942f, 0.999731481f},
-std::array<float,2>{0.109974556f, 0.343635947f},
-std::array<float,2>{0.174925596f, 0.805458903f},
-std::array<float,2>{0.922688365f, 0.44246763f},
-std::array<float,2>{0.712675869f, 0.636944592f},
-std::array<float,2>{0.405016452f, 0.0603016391f},
-std::array<float,2>{0.0434728153f, 0.721443594f},
-std::array<float,2>{0.782828391f, 0.0743400976f},
-std::array<float,2>{0.577321053f, 0.858525753f},
-std::array<float,2>{0.308073193f, 0.405035526f},
-std::array<float,2>{0.49120605f, 0.913486004f},
-std::array<float,2>{0.687069237f, 0.301359981f},
-std::array<float,2>{0.984290123f, 0.518885016f},
-std::array<float,2>{0.202613562f, 0.21742107f},
-std::array<float,2>{0.463757873f, 0.509958506f},
-std::array<float,2>{0.634994984f, 0.196001723f},
-std::array<float,2>{0.954219759f, 0.932421505f},
-std::array<float,2>{0.225954428f, 0.284360856f},
-std::array<float,2>{0.00301142549f, 0.872094333f},
-std::array<float,2>{0.762355506f, 0.388859361f},
-std::array<float,2>{0.606893659f, 0.739091039f},
-std::array<float,2>{0.254044414f, 0.0862977579f},
-std::array<float,2>{0.135439709f, 0.654015124f},
-std::array<float,2>{0.898556709f, 0.039519947f},
-std::array<float,2>{0.731759727f, 0.78444469f},
-std::array<float,2>{0.427504629f, 0.461752117f},
-std::array<float,2>{0.314607561f, 0.975724101f},
-std::array<float,2>{0.554630399f, 0.324508339f},
-std::array<float,2>{0.839141071f, 0.57895267f},
-std::array<float,2>{0.0641826913f, 0.156678036f},
-std::array<float,2>{0.295433611f, 0.714310646f},
-std::array<float,2>{0.589486539f, 0.10576988f},
-std::array<float,2>{0.801042616f, 0.816652238f},
-std::array<float,2>{0.0590171032f, 0.408427149f},
-std::array<float,2>{0.212773398f, 0.875528634f},
-std::array<float,2>{0.99030596f, 0.270075947f},
-std::array<float,2>{0.657754958f, 0.553845167f},
-std::array<float,2>{0.474540502f, 0.225155815f},
-std::array<float,2>{0.105023608f, 0.605958164f},
-std::array<float,2>{0.847454786f, 0.137998492f},
-std::array<float,2>{0.501865864f, 0.964704335f},
-std::array<float,2>{0.354934961f, 0.363613099f},
-std::array<float,2>{0.37982589f, 0.760549128f},
-std::array<float,2>{0.69320333f, 0.469584495f},
-std::array<float,2>{0.91700387f, 0.663386166f},
-std::array<float,2>{0.157350138f, 0.0055985162f},
-std::array<float,2>{0.395461082f, 0.736674428f},
-std::array<float,2>{0.705912828f, 0.0931032673f},
-std::array<float,2>{0.932823122f, 0.868245363f},
-std::array<float,2>{0.182850465f, 0.384769887f},
-std::array<float,2>{0.123919874f, 0.937130749f},
-std::array<float,2>{0.866923034f, 0.286744893f},
-std::array<float,2>{0.529657722f, 0.511788607f},
-std::array<float,2>{0.370854795f, 0.20014745f},
-std::array<float,2>{0.188805848f, 0.58351469f},
-std::array<float,2>{0.976077378f, 0.162985042f},
-std::array<float,2>{0.679389417f, 0.969664872f},
-std::array<float,2>{0.498633415f, 0.324200273f},
-std::array<float,2>{0.303289384f, 0.788699567f},
-std::array<float,2>{0.566089094f, 0.465240896f},
-std::array<float,2>{0.791119993f, 0.649606347f},
-std::array<float,2>{0.0337387696f, 0.0435782708f},
-std::array<float,2>{0.334525645f, 0.549094796f},
-std::array<float,2>{0.540465057f, 0.222157091f},
-std::array<float,2>{0.827923f, 0.881011844f},
-std::array<float,2>{0.0813017786f, 0.265709192f},
-std::array<float,2>{0.141214877f, 0.816213667f},
-std::array<float,2>{0.88423413f, 0.413465053f},
-std::array<float,2>{0.743121147f, 0.716198862f},
-std::array<float,2>{0.417986304f, 0.103767395f},
-std::array<float,2>{0.0157102067f, 0.657069027f},
-std::array<float,2>{0.770115256f, 0.00337433093f},
-std::array<float,2>{0.615778029f, 0.762910783f},
-std::array<float,2>{0.26637432f, 0.475261301f},
-std::array<float,2>{0.446623743f, 0.965998471f},
-std::array<float,2>{0.645779669f, 0.361272663f},
-std::array<float,2>{0.952420712f, 0.601690829f},
-std::array<float,2>{0.241531745f, 0.13367933f},
-std::array<float,2>{0.482741684f, 0.612243772f},
-std::array<float,2>{0.669846714f, 0.153682232f},
-std::array<float,2>{0.99923569f, 0.948334813f},
-std::array<float,2>{0.209787503f, 0.344490498f},
-std::array<float,2>{0.0477684438f, 0.77439189f},
-std::array<float,2>{0.808486342f, 0.490210116f},
-std::array<float,2>{0.585024118f, 0.678222895f},
-std::array<float,2>{0.286047488f, 0.0166984815f},
-std::array<float,2>{0.166951001f, 0.697376013f},
-std::array<float,2>{0.911865234f, 0.124411426f},
-std::array<float,2>{0.702102482f, 0.829859078f},
-std::array<float,2>{0.385193408f, 0.437472492f},
-std::array<float,2>{0.351135314f, 0.890912831f},
-std::array<float,2>{0.515038252f, 0.261165023f},
-std::array<float,2>{0.857267857f, 0.540083945f},
-std::array<float,2>{0.099970445f, 0.242628157f},
-std::array<float,2>{0.257925302f, 0.634548306f},
-std::array<float,2>{0.595038474f, 0.0576365553f},
-std::array<float,2>{0.755879581f, 0.811635375f},
-std::array<float,2>{0.0085810842f, 0.438123524f},
-std::array<float,2>{0.233468175f, 0.995900869f},
-std::array<float,2>{0.964197099f, 0.339024574f},
-std::array<float,2>{0.627149045f, 0.57168144f},
-std::array<float,2>{0.453947753f, 0.184208304f},
-std::array<float,2>{0.0725788772f, 0.520902097f},
-std::array<float,2>{0.831159234f, 0.211025506f},
-std::array<float,2>{0.557090163f, 0.907003999f},
-std::array<float,2>{0.323226482f, 0.298639178f},
-std::array<float,2>{0.433100462f, 0.852825999f},
-std::array<float,2>{0.720665276f, 0.402274728f},
-std::array<float,2>{0.895111144f, 0.725240707f},
-std::array<float,2>{0.131791279f, 0.0726669952f},
-std::array<float,2>{0.465252399f, 0.686921f},
-std::array<float,2>{0.638531566f, 0.0311309732f},
-std::array<float,2>{0.960130334f, 0.767883778f},
-std::array<float,2>{0.220835835f, 0.499186307f},
-std::array<float,2>{0.00698998151f, 0.940737069f},
-std::array<float,2>{0.759899378f, 0.35360834f},
-std::array<float,2>{0.603928745f, 0.623957336f},
-std::array<float,2>{0.250563741f, 0.146157727f},
-std::array<float,2>{0.139750659f, 0.533646762f},
-std::array<float,2>{0.904164732f, 0.235831007f},
-std::array<float,2>{0.730453908f, 0.903651953f},
-std::array<float,2>{0.425091922f, 0.257067472f},
-std::array<float,2>{0.31756708f, 0.836508334f},
-std::array<float,2>{0.548875093f, 0.426068127f},
-std::array<float,2>{0.840420604f, 0.695006371f},
-std::array<float,2>{0.0696350038f, 0.113766961f},
-std::array<float,2>{0.289350122f, 0.566756487f},
-std::array<float,2>{0.593318045f, 0.177887976f},
-std::array<float,2>{0.800558746f, 0.991960108f},
-std::array<float,2>{0.0551279038f, 0.334423214f},
-std::array<float,2>{0.217009932f, 0.80402112f},
-std::array<float,2>{0.987738669f, 0.44885847f},
-std::array<float,2>{0.663292229f, 0.629400074f},
-std::array<float,2>{0.468898952f, 0.0503443331f},
-std::array<float,2>{0.105965659f, 0.731534719f},
-std::array<float,2>{0.849856317f, 0.0674192384f},
-std::array<float,2>{0.504777253f, 0.844045579f},
-std::array<float,2>{0.359188914f, 0.393383175f},
-std::array<float,2>{0.37588644f, 0.916647255f},
-std::array<float,2>{0.688834071f, 0.309981555f},
-std::array<float,2>{0.921071708f, 0.527189374f},
-std::array<float,2>{0.163805455f, 0.204848975f},
-std::array<float,2>{0.412850857f, 0.504345775f},
-std::array<float,2>{0.737829804f, 0.191737115f},
-std::array<float,2>{0.876376152f, 0.923819482f},
-std::array<float,2>{0.155913204f, 0.289071262f},
-std::array<float,2>{0.092950739f, 0.86533463f},
-std::array<float,2>{0.818021774f, 0.378971249f},
-std::array<float,2>{0.534318507f, 0.745823085f},
-std::array<float,2>{0.342829227f, 0.083758451f},
-std::array<float,2>{0.245378926f, 0.647761524f},
-std::array<float,2>{0.942446589f, 0.0376461409f},
-std::array<float,2>{0.653981328f, 0.795845926f},
-std::array<float,2>{0.443478376f, 0.456314713f},
-std::array<float,2>{0.277486175f, 0.98284632f},
-std::array<float,2>{0.620273769f, 0.316606522f},
-std::array<float,2>{0.780849576f, 0.593233883f},
-std::array<float,2>{0.026081698f, 0.16864121f},
-std::array<float,2>{0.359619677f, 0.704971492f},
-std::array<float,2>{0.516380191f, 0.0977326781f},
-std::array<float,2>{0.868210614f, 0.82325846f},
-std::array<float,2>{0.114161603f, 0.414460361f},
-std::array<float,2>{0.177604124f, 0.884718001f},
-std::array<float,2>{0.926699877f, 0.279950917f},
-std::array<float,2>{0.717531562f, 0.560069382f},
-std::array<float,2>{0.402291477f, 0.234006301f},
-std::array<float,2>{0.0428746827f, 0.599415183f},
-std::array<float,2>{0.786420584f, 0.127171323f},
-std::array<float,2>{0.574082673f, 0.95949012f},
-std::array<float,2>{0.310438424f, 0.367479086f},
-std::array<float,2>{0.486147255f, 0.751189947f},
-std::array<float,2>{0.681870759f, 0.479230613f},
-std::array<float,2>{0.977258384f, 0.669137478f},
-std::array<float,2>{0.195832655f, 0.0134150963f},
-std::array<float,2>{0.492358893f, 0.688250303f},
-std::array<float,2>{0.67461139f, 0.111081943f},
-std::array<float,2>{0.970238149f, 0.841837585f},
-std::array<float,2>{0.19275853f, 0.424823314f},
-std::array<float,2>{0.0387422293f, 0.898793459f},
-std::array<float,2>{0.795298576f, 0.252027601f},
-std::array<float,2>{0.567787409f, 0.536510825f},
-std::array<float,2>{0.297637939f, 0.239726737f},
-std::array<float,2>{0.184733585f, 0.617969811f},
-std::array<float,2>{0.93557471f, 0.142927349f},
-std::array<float,2>{0.708640099f, 0.941943645f},
-std::array<float,2>{0.391564488f, 0.358681709f},
-std::array<float,2>{0.374039531f, 0.771801114f},
-std::array<float,2>{0.526306748f, 0.495237738f},
-std::array<float,2>{0.86299634f, 0.680613756f},
-std::array<float,2>{0.120481089f, 0.0244153216f},
-std::array<float,2>{0.271198511f, 0.530532479f},
-std::array<float,2>{0.610922992f, 0.209433466f},
-std::array<float,2>{0.767019331f, 0.921846211f},
-std::array<float,2>{0.0208323412f, 0.307379067f},
-std::array<float,2>{0.234881431f, 0.849137306f},
-std::array<float,2>{0.949076056f, 0.39671579f},
-std::array<float,2>{0.642660916f, 0.726893783f},
-std::array<float,2>{0.451985002f, 0.0634063557f},
-std::array<float,2>{0.0856246054f, 0.626150787f},
-std::array<float,2>{0.820792019f, 0.0521491282f},
-std::array<float,2>{0.546389878f, 0.800510645f},
-std::array<float,2>{0.328639299f, 0.449882835f},
-std::array<float,2>{0.415013939f, 0.987304091f},
-std::array<float,2>{0.746736646f, 0.329479039f},
-std::array<float,2>{0.887988865f, 0.565113068f},
-std::array<float,2>{0.14729844f, 0.174461171f},
-std::array<float,2>{0.389139086f, 0.586407483f},
-std::array<float,2>{0.69632864f, 0.165413946f},
-std::array<float,2>{0.907875538f, 0.976742446f},
-std::array<float,2>{0.171609387f, 0.314845294f},
-std::array<float,2>{0.0958647728f, 0.790313244f},
-std::array<float,2>{0.854073644f, 0.457189947f},
-std::array<float,2>{0.511424363f, 0.64113158f},
-std::array<float,2>{0.347120285f, 0.032773789f},
-std::array<float,2>{0.203597978f, 0.748704076f},
-std::array<float,2>{0.995291591f, 0.0800856948f},
-std::array<float,2>{0.664756179f, 0.860016227f},
-std::array<float,2>{0.480268955f, 0.377475113f},
-std::array<float,2>{0.284268349f, 0.927434027f},
-std::array<float,2>{0.579583585f, 0.294827342f},
-std::array<float,2>{0.810078263f, 0.503457427f},
-std::array<float,2>{0.0538145751f, 0.190056294f},
-std::array<float,2>{0.32763043f, 0.665018678f},
-std::array<float,2>{0.5593189f, 0.00974409841f},
-std::array<float,2>{0.835584998f, 0.757626414f},
-std::array<float,2>{0.0772089437f, 0.480872422f},
-std::array<float,2>{0.128206521f, 0.953531086f},
-std::array<float,2>{0.894019485f, 0.37491706f},
-std::array<float,2>{0.72626102f, 0.596352875f},
-std::array<float,2>{0.435181826f, 0.132631689f},
-std::array<float,2>{0.0150204338f, 0.555436075f},
-std::array<float,2>{0.75243634f, 0.227918088f},
-std::array<float,2>{0.601017118f, 0.890462637f},
-std::array<float,2>{0.262608498f, 0.275508076f},
-std::array<float,2>{0.457431644f, 0.827596188f},
-std::array<float,2>{0.630019546f, 0.419549733f},
-std::array<float,2>{0.965351999f, 0.708447933f},
-std::array<float,2>{0.229008108f, 0.0971913189f},
-std::array<float,2>{0.426698774f, 0.655362487f},
-std::array<float,2>{0.730680525f, 0.0417331904f},
-std::array<float,2>{0.899506509f, 0.782834232f},
-std::array<float,2>{0.136613727f, 0.464619249f},
-std::array<float,2>{0.0632492825f, 0.974400163f},
-std::array<float,2>{0.83844465f, 0.32692036f},
-std::array<float,2>{0.553039849f, 0.581681132f},
-std::array<float,2>{0.315951139f, 0.15943037f},
-std::array<float,2>{0.224907488f, 0.509242833f},
-std::array<float,2>{0.953477442f, 0.197287545f},
-std::array<float,2>{0.6365152f, 0.931271076f},
-std::array<float,2>{0.464496881f, 0.282210767f},
-std::array<float,2>{0.255052537f, 0.874175787f},
-std::array<float,2>{0.606377006f, 0.388349742f},
-std::array<float,2>{0.762902141f, 0.741182446f},
-std::array<float,2>{0.00243795407f, 0.0879147947f},
-std::array<float,2>{0.354232609f, 0.607798934f},
-std::array<float,2>{0.500461996f, 0.139074177f},
-std::array<float,2>{0.846154153f, 0.962655663f},
-std::array<float,2>{0.103670925f, 0.365999222f},
-std::array<float,2>{0.156923607f, 0.757901311f},
-std::array<float,2>{0.916222394f, 0.472287923f},
-std::array<float,2>{0.691848159f, 0.662020922f},
-std::array<float,2>{0.380079776f, 0.00738374889f},
-std::array<float,2>{0.0604310557f, 0.711262703f},
-std::array<float,2>{0.802065611f, 0.109215841f},
-std::array<float,2>{0.587945521f, 0.818932235f},
-std::array<float,2>{0.296370864f, 0.407396913f},
-std::array<float,2>{0.473159462f, 0.877387464f},
-std::array<float,2>{0.656511068f, 0.272435248f},
-std::array<float,2>{0.991728604f, 0.551238656f},
-std::array<float,2>{0.211557463f, 0.223132998f},
-std::array<float,2>{0.440953553f, 0.544289947f},
-std::array<float,2>{0.652309418f, 0.247928128f},
-std::array<float,2>{0.938445747f, 0.896783054f},
-std::array<float,2>{0.248095632f, 0.262427449f},
-std::array<float,2>{0.029707104f, 0.834162831f},
-std::array<float,2>{0.775903642f, 0.430840462f},
-std::array<float,2>{0.621926427f, 0.701676548f},
-std::array<float,2>{0.274983108f, 0.119649895f},
-std::array<float,2>{0.152038082f, 0.673352897f},
-std::array<float,2>{0.878926694f, 0.0202496182f},
-std::array<float,2>{0.741186142f, 0.777818918f},
-std::array<float,2>{0.40948081f, 0.487808079f},
-std::array<float,2>{0.338185251f, 0.952901244f},
-std::array<float,2>{0.53671366f, 0.34815684f},
-std::array<float,2>{0.813644588f, 0.616835058f},
-std::array<float,2>{0.0863392279f, 0.149175346f},
-std::array<float,2>{0.306728989f, 0.720474243f},
-std::array<float,2>{0.576982617f, 0.0763256997f},
-std::array<float,2>{0.782042861f, 0.857379198f},
-std::array<float,2>{0.0446859337f, 0.402542025f},
-std::array<float,2>{0.20131731f, 0.910417259f},
-std::array<float,2>{0.983000338f, 0.302886546f},
-std::array<float,2>{0.686084032f, 0.515867829f},
-std::array<float,2>{0.492128223f, 0.215568706f},
-std::array<float,2>{0.110837802f, 0.577081859f},
-std::array<float,2>{0.871191025f, 0.183431804f},
-std::array<float,2>{0.522595346f, 0.997391939f},
-std::array<float,2>{0.365733713f, 0.340562969f},
-std::array<float,2>{0.405895799f, 0.808116257f},
-std::array<float,2>{0.711879075f, 0.443365574f},
-std::array<float,2>{0.923067093f, 0.640051425f},
-std::array<float,2>{0.174524754f, 0.0607945882f},
-std::array<float,2>{0.42114237f, 0.718307734f},
-std::array<float,2>{0.744142354f, 0.103098266f},
-std::array<float,2>{0.886473358f, 0.812756956f},
-std::array<float,2>{0.144255742f, 0.411314547f},
-std::array<float,2>{0.0794436336f, 0.879618227f},
-std::array<float,2>{0.825924516f, 0.268040419f},
-std::array<float,2>{0.541071832f, 0.54774344f},
-std::array<float,2>{0.333027124f, 0.220038503f},
-std::array<float,2>{0.239954472f, 0.603572786f},
-std::array<float,2>{0.94950062f, 0.135233864f},
-std::array<float,2>{0.647720575f, 0.966822624f},
-std::array<float,2>{0.448937833f, 0.361550719f},
-std::array<float,2>{0.269485712f, 0.764229119f},
-std::array<float,2>{0.614358187f, 0.474400133f},
-std::array<float,2>{0.771938026f, 0.659675658f},
-std::array<float,2>{0.0177805647f, 0.000951450318f},
-std::array<float,2>{0.36867094f, 0.514917016f},
-std::array<float,2>{0.529185951f, 0.202845395f},
-std::array<float,2>{0.863918245f, 0.934793293f},
-std::array<float,2>{0.121415824f, 0.287377477f},
-std::array<float,2>{0.180590421f, 0.870900273f},
-std::array<float,2>{0.930672109f, 0.383862883f},
-std::array<float,2>{0.704813242f, 0.73616761f},
-std::array<float,2>{0.396736473f, 0.0907003582f},
-std::array<float,2>{0.0320304297f, 0.651387095f},
-std::array<float,2>{0.79024905f, 0.0466586947f},
-std::array<float,2>{0.564415336f, 0.787093282f},
-std::array<float,2>{0.302544117f, 0.467694521f},
-std::array<float,2>{0.496925652f, 0.971947074f},
-std::array<float,2>{0.67674166f, 0.320659935f},
-std::array<float,2>{0.974571586f, 0.584352911f},
-std::array<float,2>{0.190671623f, 0.16158171f},
-std::array<float,2>{0.456419796f, 0.572882712f},
-std::array<float,2>{0.625939012f, 0.185743183f},
-std::array<float,2>{0.96097964f, 0.992433071f},
-std::array<float,2>{0.232277423f, 0.336752117f},
-std::array<float,2>{0.0113393934f, 0.809484482f},
-std::array<float,2>{0.755607963f, 0.440640807f},
-std::array<float,2>{0.597042739f, 0.635696173f},
-std::array<float,2>{0.260699511f, 0.0558524914f},
-std::array<float,2>{0.130081162f, 0.724449039f},
-std::array<float,2>{0.898160875f, 0.0718886107f},
-std::array<float,2>{0.721494615f, 0.854711831f},
-std::array<float,2>{0.431043506f, 0.398769081f},
-std::array<float,2>{0.320577145f, 0.908884585f},
-std::array<float,2>{0.555676043f, 0.29918009f},
-std::array<float,2>{0.828364313f, 0.522376835f},
-std::array<float,2>{0.0721854195f, 0.21406512f},
-std::array<float,2>{0.288743496f, 0.676112771f},
-std::array<float,2>{0.583414912f, 0.0183013994f},
-std::array<float,2>{0.805290103f, 0.777233422f},
-std::array<float,2>{0.0498129018f, 0.490765154f},
-std::array<float,2>{0.2084907f, 0.946560144f},
-std::array<float,2>{0.998039544f, 0.347283125f},
-std::array<float,2>{0.671052814f, 0.610813022f},
-std::array<float,2>{0.481044441f, 0.154403001f},
-std::array<float,2>{0.0990093872f, 0.542525291f},
-std::array<float,2>{0.857744396f, 0.244214877f},
-std::array<float,2>{0.512232304f, 0.89426291f},
-std::array<float,2>{0.349444598f, 0.258623034f},
-std::array<float,2>{0.383667827f, 0.830305576f},
-std::array<float,2>{0.699653327f, 0.434319019f},
-std::array<float,2>{0.913927794f, 0.696875572f},
-std::array<float,2>{0.165986314f, 0.121212117f},
-std::array<float,2>{0.471095473f, 0.631715894f},
-std::array<float,2>{0.660867691f, 0.0472864322f},
-std::array<float,2>{0.984665871f, 0.800871372f},
-std::array<float,2>{0.216723591f, 0.446113288f},
-std::array<float,2>{0.0580218025f, 0.988904595f},
-std::array<float,2>{0.798554063f, 0.332330555f},
-std::array<float,2>{0.590188742f, 0.568820953f},
-std::array<float,2>{0.29189679f, 0.176604792f},
-std::array<float,2>{0.160384685f, 0.523681402f},
-std::array<float,2>{0.919707775f, 0.206412405f},
-std::array<float,2>{0.690601289f, 0.915056944f},
-std::array<float,2>{0.378568232f, 0.312449425f},
-std::array<float,2>{0.3563658f, 0.847450376f},
-std::array<float,2>{0.506851017f, 0.391927272f},
-std::array<float,2>{0.84933579f, 0.732799292f},
-std::array<float,2>{0.109351963f, 0.0702117682f},
-std::array<float,2>{0.253418714f, 0.621441066f},
-std::array<float,2>{0.602634132f, 0.14742586f},
-std::array<float,2>{0.757887423f, 0.938147485f},
-std::array<float,2>{0.00475408183f, 0.351984113f},
-std::array<float,2>{0.220417723f, 0.766329706f},
-std::array<float,2>{0.958390176f, 0.497872919f},
-std::array<float,2>{0.639875233f, 0.684617519f},
-std::array<float,2>{0.468126565f, 0.0279851463f},
-std::array<float,2>{0.0665254816f, 0.691925704f},
-std::array<float,2>{0.842808127f, 0.115768395f},
-std::array<float,2>{0.548339903f, 0.839841485f},
-std::array<float,2>{0.318889141f, 0.428747177f},
-std::array<float,2>{0.422084451f, 0.904369414f},
-std::array<float,2>{0.727759421f, 0.254148394f},
-std::array<float,2>{0.905875444f, 0.531359792f},
-std::array<float,2>{0.137158826f, 0.236607507f},
-std::array<float,2>{0.400082588f, 0.562408805f},
-std::array<float,2>{0.714851558f, 0.23220633f},
-std::array<float,2>{0.928106189f, 0.886205971f},
-std::array<float,2>{0.179038376f, 0.278024852f},
-std::array<float,2>{0.116028748f, 0.820821762f},
-std::array<float,2>{0.870113909f, 0.416327477f},
-std::array<float,2>{0.518715501f, 0.706382394f},
-std::array<float,2>{0.36241129f, 0.0997055769f},
-std::array<float,2>{0.197616369f, 0.670035064f},
-std::array<float,2>{0.979275584f, 0.0150871426f},
-std::array<float,2>{0.679918468f, 0.753127396f},
-std::array<float,2>{0.486639261f, 0.478032023f},
-std::array<float,2>{0.31090951f, 0.957178414f},
-std::array<float,2>{0.570370555f, 0.369593024f},
-std::array<float,2>{0.787529767f, 0.600344956f},
-std::array<float,2>{0.0395487808f, 0.126055405f},
-std::array<float,2>{0.340042531f, 0.743812501f},
-std::array<float,2>{0.531654835f, 0.0842635334f},
-std::array<float,2>{0.819113314f, 0.86392647f},
-std::array<float,2>{0.0906686187f, 0.381983221f},
-std::array<float,2>{0.153610855f, 0.925742447f},
-std::array<float,2>{0.878781497f, 0.292583376f},
-std::array<float,2>{0.735820591f, 0.505907416f},
-std::array<float,2>{0.41185084f, 0.194139197f},
-std::array<float,2>{0.0236741118f, 0.590504408f},
-std::array<float,2>{0.779248238f, 0.169973657f},
-std::array<float,2>{0.618683338f, 0.980485797f},
-std::array<float,2>{0.280017942f, 0.320103467f},
-std::array<float,2>{0.442000479f, 0.794015765f},
-std::array<float,2>{0.655846953f, 0.453733355f},
-std::array<float,2>{0.943607509f, 0.645850241f},
-std::array<float,2>{0.243473053f, 0.0362004302f},
-std::array<float,2>{0.449819893f, 0.730083227f},
-std::array<float,2>{0.642374337f, 0.0646629184f},
-std::array<float,2>{0.946519732f, 0.851078808f},
-std::array<float,2>{0.237373695f, 0.395546347f},
-std::array<float,2>{0.0232907366f, 0.919719696f},
-std::array<float,2>{0.769441903f, 0.305359453f},
-std::array<float,2>{0.611936271f, 0.529143512f},
-std::array<float,2>{0.272819072f, 0.207394212f},
-std::array<float,2>{0.144810721f, 0.564442098f},
-std::array<float,2>{0.890543401f, 0.172646865f},
-std::array<float,2>{0.74928391f, 0.985465884f},
-std::array<float,2>{0.416661501f, 0.331273854f},
-std::array<float,2>{0.330962896f, 0.797768533f},
-std::array<float,2>{0.544889271f, 0.452875167f},
-std::array<float,2>{0.82257396f, 0.626957119f},
-std::array<float,2>{0.0832170323f, 0.0538261458f},
-std::array<float,2>{0.300664246f, 0.537129223f},
-std::array<float,2>{0.569907188f, 0.240999669f},
-std::array<float,2>{0.79362458f, 0.901089609f},
-std::array<float,2>{0.036983598f, 0.250475764f},
-std::array<float,2>{0.194329262f, 0.840550482f},
-std::array<float,2>{0.97245276f, 0.42328909f},
-std::array<float,2>{0.672999024f, 0.689620614f},
-std::array<float,2>{0.494711876f, 0.112780608f},
-std::array<float,2>{0.119022518f, 0.681810498f},
-std::array<float,2>{0.859631121f, 0.0257346034f},
-std::array<float,2>{0.524827182f, 0.770225346f},
-std::array<float,2>{0.371274292f, 0.492751598f},
-std::array<float,2>{0.393757731f, 0.944788575f},
-std::array<float,2>{0.709710896f, 0.355509579f},
-std::array<float,2>{0.935376406f, 0.619747579f},
-std::array<float,2>{0.186281472f, 0.1407305f},
-std::array<float,2>{0.436561227f, 0.594316483f},
-std::array<float,2>{0.723676801f, 0.130343094f},
-std::array<float,2>{0.892460823f, 0.956326663f},
-std::array<float,2>{0.125958204f, 0.372526437f},
-std::array<float,2>{0.0748978779f, 0.754281223f},
-std::array<float,2>{0.832127929f, 0.482557714f},
-std::array<float,2>{0.561593175f, 0.667735219f},
-std::array<float,2>{0.324461073f, 0.00985949952f},
-std::array<float,2>{0.226930723f, 0.710750401f},
-std::array<float,2>{0.968423605f, 0.0940924883f},
-std::array<float,2>{0.631071866f, 0.825463891f},
-std::array<float,2>{0.460430026f, 0.421044976f},
-std::array<float,2>{0.264095992f, 0.888017535f},
-std::array<float,2>{0.598552167f, 0.27466023f},
-std::array<float,2>{0.750263512f, 0.5581761f},
-std::array<float,2>{0.0127532622f, 0.229559615f},
-std::array<float,2>{0.345677793f, 0.64308989f},
-std::array<float,2>{0.50931555f, 0.0333523452f},
-std::array<float,2>{0.852590561f, 0.791808486f},
-std::array<float,2>{0.095692791f, 0.460424364f},
-std::array<float,2>{0.169668287f, 0.978654563f},
-std::array<float,2>{0.909261286f, 0.313953459f},
-std::array<float,2>{0.69839257f, 0.589081407f},
-std::array<float,2>{0.386915833f, 0.167879447f},
-std::array<float,2>{0.0525192395f, 0.501593053f},
-std::array<float,2>{0.812033415f, 0.188902259f},
-std::array<float,2>{0.581831157f, 0.928058565f},
-std::array<float,2>{0.281450152f, 0.295790315f},
-std::array<float,2>{0.477425158f, 0.863271952f},
-std::array<float,2>{0.667298079f, 0.375930309f},
-std::array<float,2>{0.992808104f, 0.747799516f},
-std::array<float,2>{0.20542568f, 0.0799717382f},
-std::array<float,2>{0.381572574f, 0.662625492f},
-std::array<float,2>{0.694588721f, 0.00395017164f},
-std::array<float,2>{0.91552937f, 0.760830164f},
-std::array<float,2>{0.159880862f, 0.47049728f},
-std::array<float,2>{0.102165207f, 0.963410854f},
-std::array<float,2>{0.84501487f, 0.365203977f},
-std::array<float,2>{0.503014326f, 0.606602967f},
-std::array<float,2>{0.35203439f, 0.137118474f},
-std::array<float,2>{0.21307531f, 0.553288877f},
-std::array<float,2>{0.989700437f, 0.226267368f},
-std::array<float,2>{0.658569813f, 0.876133621f},
-std::array<float,2>{0.476349294f, 0.270623893f},
-std::array<float,2>{0.293973505f, 0.81802243f},
-std::array<float,2>{0.585998833f, 0.409637243f},
-std::array<float,2>{0.803998768f, 0.713590801f},
-std::array<float,2>{0.0616518036f, 0.106580682f},
-std::array<float,2>{0.313266814f, 0.579388738f},
-std::array<float,2>{0.551606834f, 0.157372758f},
-std::array<float,2>{0.836211741f, 0.975389659f},
-std::array<float,2>{0.0648525208f, 0.325748265f},
-std::array<float,2>{0.133612692f, 0.783236265f},
-std::array<float,2>{0.902324498f, 0.462320834f},
-std::array<float,2>{0.733396411f, 0.65323776f},
-std::array<float,2>{0.428697705f, 0.0408679619f},
-std::array<float,2>{0.0011967757f, 0.739629984f},
-std::array<float,2>{0.765355408f, 0.0876011327f},
-std::array<float,2>{0.608478785f, 0.871974707f},
-std::array<float,2>{0.256222993f, 0.390034884f},
-std::array<float,2>{0.461128861f, 0.933044255f},
-std::array<float,2>{0.633840919f, 0.283474326f},
-std::array<float,2>{0.955889761f, 0.51079458f},
-std::array<float,2>{0.224392772f, 0.196325958f},
-std::array<float,2>{0.489465564f, 0.517931402f},
-std::array<float,2>{0.683601081f, 0.217955053f},
-std::array<float,2>{0.98171103f, 0.912821412f},
-std::array<float,2>{0.199672863f, 0.302141786f},
-std::array<float,2>{0.0451170914f, 0.857702672f},
-std::array<float,2>{0.784508765f, 0.405483335f},
-std::array<float,2>{0.575354218f, 0.722063303f},
-std::array<float,2>{0.306224048f, 0.0761702806f},
-std::array<float,2>{0.172636896f, 0.6383816f},
-std::array<float,2>{0.924727619f, 0.0591964088f},
-std::array<float,2>{0.713944554f, 0.80642873f},
-std::array<float,2>{0.402652264f, 0.441844463f},
-std::array<float,2>{0.364503354f, 0.998456597f},
-std::array<float,2>{0.520341158f, 0.342568129f},
-std::array<float,2>{0.873361588f, 0.575339973f},
-std::array<float,2>{0.112827115f, 0.180006146f},
-std::array<float,2>{0.27591902f, 0.700595975f},
-std::array<float,2>{0.624219179f, 0.118476175f},
-std::array<float,2>{0.774143338f, 0.832399011f},
-std::array<float,2>{0.0285251401f, 0.433315188f},
-std::array<float,2>{0.247772947f, 0.895951152f},
-std::array<float,2>{0.940010667f, 0.265316069f},
-std::array<float,2>{0.649813354f, 0.546809971f},
-std::array<float,2>{0.437941134f, 0.248592407f},
-std::array<float,2>{0.0888884887f, 0.614510715f},
-std::array<float,2>{0.81500411f, 0.151629135f},
-std::array<float,2>{0.538832903f, 0.950234354f},
-std::array<float,2>{0.337204099f, 0.350292742f},
-std::array<float,2>{0.406793088f, 0.780981004f},
-std::array<float,2>{0.739718199f, 0.486312419f},
-std::array<float,2>{0.880916774f, 0.675095975f},
-std::array<float,2>{0.148689702f, 0.0233657621f},
-std::array<float,2>{0.429288954f, 0.740942538f},
-std::array<float,2>{0.734053612f, 0.0883462578f},
-std::array<float,2>{0.900627375f, 0.874284387f},
-std::array<float,2>{0.133898661f, 0.388622075f},
-std::array<float,2>{0.0654792637f, 0.931429446f},
-std::array<float,2>{0.837306142f, 0.281957686f},
-std::array<float,2>{0.552003384f, 0.508841395f},
-std::array<float,2>{0.313928843f, 0.197667673f},
-std::array<float,2>{0.223334536f, 0.581928909f},
-std::array<float,2>{0.95648104f, 0.159357741f},
-std::array<float,2>{0.633701503f, 0.974148512f},
-std::array<float,2>{0.462347269f, 0.326887608f},
-std::array<float,2>{0.257198602f, 0.783120155f},
-std::array<float,2>{0.607587039f, 0.464576095f},
-std::array<float,2>{0.763856232f, 0.65566206f},
-std::array<float,2>{0.000193280866f, 0.0418371446f},
-std::array<float,2>{0.353057563f, 0.550985932f},
-std::array<float,2>{0.502718389f, 0.222865269f},
-std::array<float,2>{0.844541907f, 0.877091169f},
-std::array<float,2>{0.103095755f, 0.272109509f},
-std::array<float,2>{0.158993229f, 0.819163322f},
-std::array<float,2>{0.914830029f, 0.40766865f},
-std::array<float,2>{0.693608701f, 0.711025476f},
-std::array<float,2>{0.381900519f, 0.109083831f},
-std::array<float,2>{0.0609532595f, 0.661734641f},
-std::array<float,2>{0.802823186f, 0.00778606068f},
-std::array<float,2>{0.587127745f, 0.758267522f},
-std::array<float,2>{0.293338448f, 0.472613603f},
-std::array<float,2>{0.474632412f, 0.962624013f},
-std::array<float,2>{0.659252822f, 0.36587745f},
-std::array<float,2>{0.988306344f, 0.607478499f},
-std::array<float,2>{0.214628741f, 0.138727516f},
-std::array<float,2>{0.438589901f, 0.617015243f},
-std::array<float,2>{0.649058819f, 0.149008244f},
-std::array<float,2>{0.940776706f, 0.952648401f},
-std::array<float,2>{0.246668786f, 0.348447144f},
-std::array<float,2>{0.0275045f, 0.777571678f},
-std::array<float,2>{0.775376201f, 0.488184303f},
-std::array<float,2>{0.623601198f, 0.673765004f},
-std::array<float,2>{0.276453435f, 0.020339014f},
-std::array<float,2>{0.149665415f, 0.702065289f},
-std::array<float,2>{0.882130444f, 0.120031759f},
-std::array<float,2>{0.739011884f, 0.834369302f},
-std::array<float,2>{0.407277256f, 0.431079507f},
-std::array<float,2>{0.336498439f, 0.89665103f},
-std::array<float,2>{0.537400007f, 0.262609601f},
-std::array<float,2>{0.815962553f, 0.543985903f},
-std::array<float,2>{0.0882579759f, 0.247689262f},
-std::array<float,2>{0.305260062f, 0.639748335f},
-std::array<float,2>{0.574911356f, 0.0607533157f},
-std::array<float,2>{0.783307374f, 0.80850023f},
-std::array<float,2>{0.0459259599f, 0.443724364f},
-std::array<float,2>{0.20061788f, 0.997256339f},
-std::array<float,2>{0.981339455f, 0.340812355f},
-std::array<float,2>{0.68546313f, 0.576754332f},
-std::array<float,2>{0.488886088f, 0.183293745f},
-std::array<float,2>{0.112126701f, 0.515901506f},
-std::array<float,2>{0.874337494f, 0.215587452f},
-std::array<float,2>{0.521077991f, 0.910383224f},
-std::array<float,2>{0.363805592f, 0.303023726f},
-std::array<float,2>{0.403952479f, 0.856958032f},
-std::array<float,2>{0.713670969f, 0.402590424f},
-std::array<float,2>{0.925701916f, 0.720368326f},
-std::array<float,2>{0.173588619f, 0.0765650943f},
-std::array<float,2>{0.496089518f, 0.680219769f},
-std::array<float,2>{0.671986103f, 0.0247884896f},
-std::array<float,2>{0.971466839f, 0.771675169f},
-std::array<float,2>{0.195120603f, 0.495511413f},
-std::array<float,2>{0.035811916f, 0.942281544f},
-std::array<float,2>{0.794038713f, 0.358583897f},
-std::array<float,2>{0.569290817f, 0.617880881f},
-std::array<float,2>{0.299659789f, 0.142631739f},
-std::array<float,2>{0.187083736f, 0.536255538f},
-std::array<float,2>{0.934430599f, 0.23936592f},
-std::array<float,2>{0.710074246f, 0.898629129f},
-std::array<float,2>{0.393159509f, 0.252293289f},
-std::array<float,2>{0.372854292f, 0.842241764f},
-std::array<float,2>{0.523904681f, 0.425198734f},
-std::array<float,2>{0.860799313f, 0.688059032f},
-std::array<float,2>{0.118122876f, 0.111163773f},
-std::array<float,2>{0.272354811f, 0.56525737f},
-std::array<float,2>{0.612524629f, 0.17462419f},
-std::array<float,2>{0.767967582f, 0.986997902f},
-std::array<float,2>{0.0215219483f, 0.329282492f},
-std::array<float,2>{0.236669958f, 0.800542176f},
-std::array<float,2>{0.94558537f, 0.44999063f},
-std::array<float,2>{0.640654624f, 0.626277864f},
-std::array<float,2>{0.451031476f, 0.0517894849f},
-std::array<float,2>{0.0825509056f, 0.726756632f},
-std::array<float,2>{0.823917568f, 0.0630390048f},
-std::array<float,2>{0.54370594f, 0.849425018f},
-std::array<float,2>{0.332019478f, 0.396885127f},
-std::array<float,2>{0.417835027f, 0.921414614f},
-std::array<float,2>{0.748689413f, 0.307345867f},
-std::array<float,2>{0.889550269f, 0.530318856f},
-std::array<float,2>{0.145670503f, 0.2091344f},
-std::array<float,2>{0.388557076f, 0.503813505f},
-std::array<float,2>{0.698085129f, 0.190187588f},
-std::array<float,2>{0.908749521f, 0.927612603f},
-std::array<float,2>{0.168569908f, 0.294461608f},
-std::array<float,2>{0.0943027809f, 0.860307693f},
-std::array<float,2>{0.852289379f, 0.377777874f},
-std::array<float,2>{0.508736372f, 0.748949528f},
-std::array<float,2>{0.344540358f, 0.0805637538f},
-std::array<float,2>{0.206206381f, 0.641429722f},
-std::array<float,2>{0.993466556f, 0.0331816487f},
-std::array<float,2>{0.666739702f, 0.790131629f},
-std::array<float,2>{0.478508115f, 0.457302958f},
-std::array<float,2>{0.282523304f, 0.976872861f},
-std::array<float,2>{0.580487609f, 0.314505279f},
-std::array<float,2>{0.810857713f, 0.585973918f},
-std::array<float,2>{0.0508586057f, 0.165132925f},
-std::array<float,2>{0.325564742f, 0.708121777f},
-std::array<float,2>{0.561297238f, 0.0975173786f},
-std::array<float,2>{0.83360368f, 0.827214539f},
-std::array<float,2>{0.0756933019f, 0.41983223f},
-std::array<float,2>{0.126094878f, 0.89031446f},
-std::array<float,2>{0.891427577f, 0.275758922f},
-std::array<float,2>{0.723053098f, 0.555386007f},
-std::array<float,2>{0.436188668f, 0.227623388f},
-std::array<float,2>{0.0120504759f, 0.596495807f},
-std::array<float,2>{0.751462162f, 0.132360294f},
-std::array<float,2>{0.598829031f, 0.953337252f},
-std::array<float,2>{0.264890343f, 0.374605685f},
-std::array<float,2>{0.459032238f, 0.757518589f},
-std::array<float,2>{0.632277787f, 0.480581701f},
-std::array<float,2>{0.967496097f, 0.664721549f},
-std::array<float,2>{0.227947295f, 0.00929353666f},
-std::array<float,2>{0.467126936f, 0.695069253f},
-std::array<float,2>{0.639200747f, 0.113452338f},
-std::array<float,2>{0.957538784f, 0.8367697f},
-std::array<float,2>{0.218816891f, 0.425896108f},
-std::array<float,2>{0.00515425531f, 0.90333873f},
-std::array<float,2>{0.759180725f, 0.25718236f},
-std::array<float,2>{0.601918757f, 0.533261359f},
-std::array<float,2>{0.252245307f, 0.235500172f},
-std::array<float,2>{0.138373226f, 0.623568952f},
-std::array<float,2>{0.90455991f, 0.146336302f},
-std::array<float,2>{0.726709843f, 0.940554023f},
-std::array<float,2>{0.423714906f, 0.353858829f},
-std::array<float,2>{0.320197582f, 0.767767727f},
-std::array<float,2>{0.547193944f, 0.499496043f},
-std::array<float,2>{0.842022479f, 0.686546087f},
-std::array<float,2>{0.0682819709f, 0.0308903288f},
-std::array<float,2>{0.29213497f, 0.52705878f},
-std::array<float,2>{0.590897739f, 0.204667002f},
-std::array<float,2>{0.797831476f, 0.916750073f},
-std::array<float,2>{0.0570372157f, 0.309670508f},
-std::array<float,2>{0.215579152f, 0.843890548f},
-std::array<float,2>{0.986318052f, 0.393296033f},
-std::array<float,2>{0.661544502f, 0.731753647f},
-std::array<float,2>{0.472406745f, 0.0676918551f},
-std::array<float,2>{0.107786387f, 0.629835784f},
-std::array<float,2>{0.848205745f, 0.0507399999f},
-std::array<float,2>{0.506124258f, 0.803880572f},
-std::array<float,2>{0.357048422f, 0.449060321f},
-std::array<float,2>{0.377031922f, 0.991915822f},
-std::array<float,2>{0.690050781f, 0.334113717f},
-std::array<float,2>{0.918383539f, 0.566515744f},
-std::array<float,2>{0.16197449f, 0.17818591f},
-std::array<float,2>{0.410194069f, 0.592838585f},
-std::array<float,2>{0.734967768f, 0.168881744f},
-std::array<float,2>{0.877905428f, 0.982584178f},
-std::array<float,2>{0.152779073f, 0.316747099f},
-std::array<float,2>{0.0914382488f, 0.795652747f},
-std::array<float,2>{0.819552481f, 0.456113487f},
-std::array<float,2>{0.532992661f, 0.647664011f},
-std::array<float,2>{0.341234595f, 0.0379773453f},
-std::array<float,2>{0.242340237f, 0.745884538f},
-std::array<float,2>{0.944980502f, 0.0835767984f},
-std::array<float,2>{0.654450774f, 0.865592897f},
-std::array<float,2>{0.442863137f, 0.379155457f},
-std::array<float,2>{0.281048566f, 0.923499763f},
-std::array<float,2>{0.617978096f, 0.289498419f},
-std::array<float,2>{0.777387917f, 0.504072368f},
-std::array<float,2>{0.0253104493f, 0.191618159f},
-std::array<float,2>{0.361574292f, 0.669366419f},
-std::array<float,2>{0.518429041f, 0.0135092707f},
-std::array<float,2>{0.871019125f, 0.751395047f},
-std::array<float,2>{0.116743162f, 0.479297191f},
-std::array<float,2>{0.178097844f, 0.959751308f},
-std::array<float,2>{0.928753674f, 0.367385715f},
-std::array<float,2>{0.716681778f, 0.599162936f},
-std::array<float,2>{0.398803532f, 0.127365142f},
-std::array<float,2>{0.0407387614f, 0.560341775f},
-std::array<float,2>{0.788988948f, 0.234360412f},
-std::array<float,2>{0.571715534f, 0.884330809f},
-std::array<float,2>{0.311641425f, 0.280171603f},
-std::array<float,2>{0.488173246f, 0.823539436f},
-std::array<float,2>{0.681468248f, 0.414135903f},
-std::array<float,2>{0.979675233f, 0.704615712f},
-std::array<float,2>{0.19909893f, 0.0980545431f},
-std::array<float,2>{0.397769302f, 0.649895132f},
-std::array<float,2>{0.703375518f, 0.0437108949f},
-std::array<float,2>{0.930046439f, 0.788912594f},
-std::array<float,2>{0.18156971f, 0.465075701f},
-std::array<float,2>{0.122793116f, 0.969291985f},
-std::array<float,2>{0.865058959f, 0.323877037f},
-std::array<float,2>{0.52745986f, 0.583934605f},
-std::array<float,2>{0.367972165f, 0.162698478f},
-std::array<float,2>{0.190000921f, 0.511990428f},
-std::array<float,2>{0.973399401f, 0.199745387f},
-std::array<float,2>{0.677284598f, 0.937464595f},
-std::array<float,2>{0.497492731f, 0.286907881f},
-std::array<float,2>{0.300838619f, 0.868578315f},
-std::array<float,2>{0.56284374f, 0.38516888f},
-std::array<float,2>{0.789570212f, 0.736538291f},
-std::array<float,2>{0.0325182416f, 0.0929631963f},
-std::array<float,2>{0.332759351f, 0.601938069f},
-std::array<float,2>{0.542210758f, 0.133506775f},
-std::array<float,2>{0.825190306f, 0.966161609f},
-std::array<float,2>{0.0784600154f, 0.361059248f},
-std::array<float,2>{0.143443272f, 0.76315701f},
-std::array<float,2>{0.885700464f, 0.475421697f},
-std::array<float,2>{0.745322883f, 0.656762064f},
-std::array<float,2>{0.420020342f, 0.0030795061f},
-std::array<float,2>{0.019497076f, 0.715999722f},
-std::array<float,2>{0.773338854f, 0.103568673f},
-std::array<float,2>{0.613746285f, 0.816110432f},
-std::array<float,2>{0.268554002f, 0.413249612f},
-std::array<float,2>{0.448165923f, 0.881155074f},
-std::array<float,2>{0.646814823f, 0.265981883f},
-std::array<float,2>{0.950276196f, 0.549031377f},
-std::array<float,2>{0.239115044f, 0.221757933f},
-std::array<float,2>{0.481677979f, 0.540431559f},
-std::array<float,2>{0.670702457f, 0.242252216f},
-std::array<float,2>{0.99628824f, 0.890852153f},
-std::array<float,2>{0.207889542f, 0.260906279f},
-std::array<float,2>{0.0494463816f, 0.82972759f},
-std::array<float,2>{0.806606412f, 0.437050492f},
-std::array<float,2>{0.582982063f, 0.697687328f},
-std::array<float,2>{0.287648976f, 0.124251403f},
-std::array<float,2>{0.16425091f, 0.678650856f},
-std::array<float,2>{0.913045526f, 0.0170009024f},
-std::array<float,2>{0.700395405f, 0.774143994f},
-std::array<float,2>{0.384609193f, 0.489904612f},
-std::array<float,2>{0.348074853f, 0.94854933f},
-std::array<float,2>{0.513434827f, 0.344411016f},
-std::array<float,2>{0.858504415f, 0.612010837f},
-std::array<float,2>{0.0980371609f, 0.153537318f},
-std::array<float,2>{0.261148572f, 0.725397468f},
-std::array<float,2>{0.596216679f, 0.0723231062f},
-std::array<float,2>{0.754798949f, 0.852654338f},
-std::array<float,2>{0.0106920172f, 0.402079463f},
-std::array<float,2>{0.231171921f, 0.906879008f},
-std::array<float,2>{0.96231848f, 0.298395246f},
-std::array<float,2>{0.62650454f, 0.520541191f},
-std::array<float,2>{0.455169439f, 0.211326525f},
-std::array<float,2>{0.0710782707f, 0.571484506f},
-std::array<float,2>{0.829357803f, 0.184513345f},
-std::array<float,2>{0.555067599f, 0.995762587f},
-std::array<float,2>{0.321866214f, 0.339213729f},
-std::array<float,2>{0.430170268f, 0.811833739f},
-std::array<float,2>{0.72224158f, 0.438398927f},
-std::array<float,2>{0.896942794f, 0.634283006f},
-std::array<float,2>{0.128924996f, 0.0580665655f},
-std::array<float,2>{0.379051864f, 0.713797987f},
-std::array<float,2>{0.692814231f, 0.106715903f},
-std::array<float,2>{0.91763252f, 0.818350554f},
-std::array<float,2>{0.157957107f, 0.409285903f},
-std::array<float,2>{0.104508966f, 0.876236856f},
-std::array<float,2>{0.846914411f, 0.270785749f},
-std::array<float,2>{0.501022696f, 0.553582668f},
-std::array<float,2>{0.355388016f, 0.226388142f},
-std::array<float,2>{0.212180391f, 0.606829464f},
-std::array<float,2>{0.991179705f, 0.136943281f},
-std::array<float,2>{0.6573506f, 0.963768482f},
-std::array<float,2>{0.474115878f, 0.36477083f},
-std::array<float,2>{0.295294106f, 0.761077583f},
-std::array<float,2>{0.589063585f, 0.470243633f},
-std::array<float,2>{0.801395595f, 0.663061619f},
-std::array<float,2>{0.0595165119f, 0.00418198947f},
-std::array<float,2>{0.315261573f, 0.511215925f},
-std::array<float,2>{0.553837061f, 0.196659893f},
-std::array<float,2>{0.839832008f, 0.932837427f},
-std::array<float,2>{0.0636247694f, 0.283317298f},
-std::array<float,2>{0.134803072f, 0.871602476f},
-std::array<float,2>{0.899062455f, 0.389807761f},
-std::array<float,2>{0.732179523f, 0.739376724f},
-std::array<float,2>{0.426866829f, 0.0878828689f},
-std::array<float,2>{0.00366662466f, 0.65286231f},
-std::array<float,2>{0.762127995f, 0.0406346023f},
-std::array<float,2>{0.607346237f, 0.783470154f},
-std::array<float,2>{0.254717499f, 0.462028474f},
-std::array<float,2>{0.463166624f, 0.97518903f},
-std::array<float,2>{0.635682642f, 0.325973719f},
-std::array<float,2>{0.954780936f, 0.579180121f},
-std::array<float,2>{0.226547614f, 0.157705843f},
-std::array<float,2>{0.490257829f, 0.575500369f},
-std::array<float,2>{0.686702371f, 0.179888532f},
-std::array<float,2>{0.983436942f, 0.998167455f},
-std::array<float,2>{0.202983171f, 0.34229362f},
-std::array<float,2>{0.0431648009f, 0.806244135f},
-std::array<float,2>{0.782489061f, 0.441423118f},
-std::array<float,2>{0.57788223f, 0.638637781f},
-std::array<float,2>{0.308205485f, 0.0595027246f},
-std::array<float,2>{0.175391644f, 0.721719086f},
-std::array<float,2>{0.92196542f, 0.0759116486f},
-std::array<float,2>{0.712072492f, 0.857664645f},
-std::array<float,2>{0.404344648f, 0.405602396f},
-std::array<float,2>{0.366560042f, 0.912901342f},
-std::array<float,2>{0.522236943f, 0.301913977f},
-std::array<float,2>{0.872604132f, 0.517792404f},
-std::array<float,2>{0.109854773f, 0.21808511f},
-std::array<float,2>{0.273736179f, 0.674843013f},
-std::array<float,2>{0.622841716f, 0.0230539627f},
-std::array<float,2>{0.776376247f, 0.78107053f},
-std::array<float,2>{0.0306572858f, 0.485916853f},
-std::array<float,2>{0.249607205f, 0.950466573f},
-std::array<float,2>{0.938851595f, 0.35049656f},
-std::array<float,2>{0.650520444f, 0.614297152f},
-std::array<float,2>{0.440186977f, 0.151585057f},
-std::array<float,2>{0.0871769115f, 0.546432614f},
-std::array<float,2>{0.81265986f, 0.248873293f},
-std::array<float,2>{0.535615563f, 0.895602286f},
-std::array<float,2>{0.339180678f, 0.265454233f},
-std::array<float,2>{0.408572942f, 0.832268953f},
-std::array<float,2>{0.741218626f, 0.43346864f},
-std::array<float,2>{0.880162001f, 0.700260162f},
-std::array<float,2>{0.151130334f, 0.118199237f},
-std::array<float,2>{0.452795863f, 0.627292931f},
-std::array<float,2>{0.643951118f, 0.0540437251f},
-std::array<float,2>{0.948041797f, 0.797579587f},
-std::array<float,2>{0.236247957f, 0.453080714f},
-std::array<float,2>{0.0204881765f, 0.985730231f},
-std::array<float,2>{0.766436219f, 0.331516385f},
-std::array<float,2>{0.60978508f, 0.564057708f},
-std::array<float,2>{0.270211846f, 0.172450244f},
-std::array<float,2>{0.148216471f, 0.528861642f},
-std::array<float,2>{0.887574077f, 0.207183614f},
-std::array<float,2>{0.747319102f, 0.919598579f},
-std::array<float,2>{0.415593773f, 0.305604964f},
-std::array<float,2>{0.329431564f, 0.851443291f},
-std::array<float,2>{0.545512736f, 0.395931602f},
-std::array<float,2>{0.822101712f, 0.730360925f},
-std::array<float,2>{0.0841312706f, 0.0647169575f},
-std::array<float,2>{0.298673272f, 0.619962394f},
-std::array<float,2>{0.566764355f, 0.140961036f},
-std::array<float,2>{0.796833754f, 0.944535613f},
-std::array<float,2>{0.0375300758f, 0.355853498f},
-std::array<float,2>{0.191493064f, 0.770433187f},
-std::array<float,2>{0.969142199f, 0.493050009f},
-std::array<float,2>{0.675610423f, 0.682073772f},
-std::array<float,2>{0.493831784f, 0.0254257638f},
-std::array<float,2>{0.120099805f, 0.689887464f},
-std::array<float,2>{0.861542046f, 0.112406909f},
-std::array<float,2>{0.526420772f, 0.840819478f},
-std::array<float,2>{0.373820871f, 0.423020959f},
-std::array<float,2>{0.392330706f, 0.901126504f},
-std::array<float,2>{0.707203388f, 0.250209898f},
-std::array<float,2>{0.93685323f, 0.537506461f},
-std::array<float,2>{0.183752805f, 0.240963116f},
-std::array<float,2>{0.433965087f, 0.558492482f},
-std::array<float,2>{0.724741101f, 0.229837388f},
-std::array<float,2>{0.893000066f, 0.88786757f},
-std::array<float,2>{0.127510145f, 0.274632245f},
-std::array<float,2>{0.0762066469f, 0.82532692f},
-std::array<float,2>{0.834206223f, 0.421341181f},
-std::array<float,2>{0.560337842f, 0.710555434f},
-std::array<float,2>{0.326733112f, 0.0937569663f},
-std::array<float,2>{0.229826644f, 0.667483807f},
-std::array<float,2>{0.965948462f, 0.0101148151f},
-std::array<float,2>{0.629875362f, 0.753926039f},
-std::array<float,2>{0.458331287f, 0.482694209f},
-std::array<float,2>{0.263642281f, 0.956139684f},
-std::array<float,2>{0.600329578f, 0.372312486f},
-std::array<float,2>{0.752988279f, 0.594537616f},
-std::array<float,2>{0.0143415127f, 0.12995781f},
-std::array<float,2>{0.346246302f, 0.747947633f},
-std::array<float,2>{0.510023773f, 0.0796661451f},
-std::array<float,2>{0.854918838f, 0.863002181f},
-std::array<float,2>{0.0971596912f, 0.375602931f},
-std::array<float,2>{0.170223102f, 0.927791595f},
-std::array<float,2>{0.907064855f, 0.295548737f},
-std::array<float,2>{0.696139574f, 0.501846194f},
-std::array<float,2>{0.389835805f, 0.188558877f},
-std::array<float,2>{0.0536457077f, 0.589111328f},
-std::array<float,2>{0.809519708f, 0.167550594f},
-std::array<float,2>{0.578399062f, 0.978785276f},
-std::array<float,2>{0.283242643f, 0.313497126f},
-std::array<float,2>{0.479423165f, 0.791667223f},
-std::array<float,2>{0.665887475f, 0.460202038f},
-std::array<float,2>{0.994620204f, 0.643339932f},
-std::array<float,2>{0.204138666f, 0.0336470753f},
-std::array<float,2>{0.470405787f, 0.732587695f},
-std::array<float,2>{0.662337124f, 0.0699965879f},
-std::array<float,2>{0.987057388f, 0.847365439f},
-std::array<float,2>{0.218523532f, 0.391814977f},
-std::array<float,2>{0.0562841445f, 0.915506423f},
-std::array<float,2>{0.79893136f, 0.31222555f},
-std::array<float,2>{0.591987431f, 0.523821771f},
-std::array<float,2>{0.290626824f, 0.206196979f},
-std::array<float,2>{0.162374392f, 0.568590224f},
-std::array<float,2>{0.920108438f, 0.176395878f},
-std::array<float,2>{0.687930465f, 0.989141405f},
-std::array<float,2>{0.376650661f, 0.332183659f},
-std::array<float,2>{0.35808149f, 0.801268101f},
-std::array<float,2>{0.505264759f, 0.445903391f},
-std::array<float,2>{0.851132095f, 0.631575942f},
-std::array<float,2>{0.107178882f, 0.0469083637f},
-std::array<float,2>{0.251342326f, 0.531527877f},
-std::array<float,2>{0.604818404f, 0.236345351f},
-std::array<float,2>{0.761264026f, 0.904586971f},
-std::array<float,2>{0.00593331689f, 0.254300475f},
-std::array<float,2>{0.221825838f, 0.839485407f},
-std::array<float,2>{0.959775805f, 0.429012656f},
-std::array<float,2>{0.63720721f, 0.692304313f},
-std::array<float,2>{0.466495007f, 0.116050392f},
-std::array<float,2>{0.0692887232f, 0.684881806f},
-std::array<float,2>{0.841123044f, 0.0280884169f},
-std::array<float,2>{0.55011189f, 0.766553581f},
-std::array<float,2>{0.316460937f, 0.49774012f},
-std::array<float,2>{0.424094111f, 0.938281f},
-std::array<float,2>{0.729100108f, 0.351705074f},
-std::array<float,2>{0.903066814f, 0.621308982f},
-std::array<float,2>{0.13890487f, 0.147113353f},
-std::array<float,2>{0.400395244f, 0.600192904f},
-std::array<float,2>{0.717935443f, 0.126276776f},
-std::array<float,2>{0.9268592f, 0.957352877f},
-std::array<float,2>{0.176727533f, 0.369330078f},
-std::array<float,2>{0.115054451f, 0.753276646f},
-std::array<float,2>{0.867742836f, 0.478467405f},
-std::array<float,2>{0.517366827f, 0.670226157f},
-std::array<float,2>{0.361208349f, 0.0147049399f},
-std::array<float,2>{0.197206244f, 0.706230938f},
-std::array<float,2>{0.977838099f, 0.100084446f},
-std::array<float,2>{0.683198094f, 0.821239173f},
-std::array<float,2>{0.485231429f, 0.416165262f},
-std::array<float,2>{0.309056193f, 0.885937929f},
-std::array<float,2>{0.57235682f, 0.278264821f},
-std::array<float,2>{0.786083698f, 0.562228084f},
-std::array<float,2>{0.0413188562f, 0.232066572f},
-std::array<float,2>{0.342307001f, 0.645588279f},
-std::array<float,2>{0.533950567f, 0.0364575461f},
-std::array<float,2>{0.817167521f, 0.794401228f},
-std::array<float,2>{0.091821909f, 0.454021692f},
-std::array<float,2>{0.154553577f, 0.980923712f},
-std::array<float,2>{0.875006914f, 0.319899946f},
-std::array<float,2>{0.737163305f, 0.590673208f},
-std::array<float,2>{0.41342485f, 0.170309767f},
-std::array<float,2>{0.0272081736f, 0.506135583f},
-std::array<float,2>{0.779415309f, 0.193863377f},
-std::array<float,2>{0.619918287f, 0.92551887f},
-std::array<float,2>{0.279190809f, 0.292948544f},
-std::array<float,2>{0.444382638f, 0.864021301f},
-std::array<float,2>{0.653127789f, 0.382085443f},
-std::array<float,2>{0.94194454f, 0.744132698f},
-std::array<float,2>{0.244555607f, 0.0841218531f},
-std::array<float,2>{0.419746459f, 0.660016418f},
-std::array<float,2>{0.744122684f, 0.000497209316f},
-std::array<float,2>{0.883611739f, 0.764532328f},
-std::array<float,2>{0.142255694f, 0.474228203f},
-std::array<float,2>{0.0807678103f, 0.967213631f},
-std::array<float,2>{0.827037215f, 0.361575454f},
-std::array<float,2>{0.539156973f, 0.603987575f},
-std::array<float,2>{0.335928947f, 0.134950101f},
-std::array<float,2>{0.240581378f, 0.547391593f},
-std::array<float,2>{0.951723516f, 0.219738722f},
-std::array<float,2>{0.644876599f, 0.879733026f},
-std::array<float,2>{0.445865124f, 0.267704844f},
-std::array<float,2>{0.267176718f, 0.812538505f},
-std::array<float,2>{0.61623919f, 0.411466956f},
-std::array<float,2>{0.771229088f, 0.718695819f},
-std::array<float,2>{0.0166344047f, 0.103513807f},
-std::array<float,2>{0.370051384f, 0.584176898f},
-std::array<float,2>{0.530736744f, 0.161356539f},
-std::array<float,2>{0.86602658f, 0.971679747f},
-std::array<float,2>{0.124113828f, 0.320542485f},
-std::array<float,2>{0.182207942f, 0.786641598f},
-std::array<float,2>{0.931947827f, 0.467367321f},
-std::array<float,2>{0.706933141f, 0.651708007f},
-std::array<float,2>{0.395743459f, 0.0465682968f},
-std::array<float,2>{0.0347140208f, 0.735914528f},
-std::array<float,2>{0.792196393f, 0.0903587341f},
-std::array<float,2>{0.56504494f, 0.870722771f},
-std::array<float,2>{0.304620415f, 0.384091079f},
-std::array<float,2>{0.499709487f, 0.93493861f},
-std::array<float,2>{0.678442895f, 0.287337154f},
-std::array<float,2>{0.974834979f, 0.51477176f},
-std::array<float,2>{0.188374475f, 0.203122795f},
-std::array<float,2>{0.45422253f, 0.522208333f},
-std::array<float,2>{0.628185987f, 0.214267507f},
-std::array<float,2>{0.963780701f, 0.908988595f},
-std::array<float,2>{0.232651457f, 0.299021244f},
-std::array<float,2>{0.00951623637f, 0.854937673f},
-std::array<float,2>{0.757442951f, 0.39850691f},
-std::array<float,2>{0.594480276f, 0.724143982f},
-std::array<float,2>{0.258832902f, 0.0720930621f},
-std::array<float,2>{0.132075652f, 0.635316193f},
-std::array<float,2>{0.895750046f, 0.0559943952f},
-std::array<float,2>{0.719337285f, 0.809271395f},
-std::array<float,2>{0.43208611f, 0.440874726f},
-std::array<float,2>{0.323409557f, 0.992236316f},
-std::array<float,2>{0.557861567f, 0.336551011f},
-std::array<float,2>{0.830503166f, 0.573189199f},
-std::array<float,2>{0.0740310922f, 0.186034366f},
-std::array<float,2>{0.286877155f, 0.697141588f},
-std::array<float,2>{0.584633648f, 0.121508561f},
-std::array<float,2>{0.807326198f, 0.830385745f},
-std::array<float,2>{0.0481072478f, 0.434410959f},
-std::array<float,2>{0.210013613f, 0.894454062f},
-std::array<float,2>{0.998793244f, 0.258446068f},
-std::array<float,2>{0.668230295f, 0.542936146f},
-std::array<float,2>{0.483660549f, 0.244387925f},
-std::array<float,2>{0.101414204f, 0.610501945f},
-std::array<float,2>{0.856356919f, 0.154615805f},
-std::array<float,2>{0.514220297f, 0.946389079f},
-std::array<float,2>{0.349648505f, 0.347550631f},
-std::array<float,2>{0.385984838f, 0.77702719f},
-std::array<float,2>{0.702532113f, 0.490972698f},
-std::array<float,2>{0.911091208f, 0.675883889f},
-std::array<float,2>{0.167052284f, 0.0185352843f},
-std::array<float,2>{0.405524611f, 0.71944207f},
-std::array<float,2>{0.710962653f, 0.0779609308f},
-std::array<float,2>{0.923566878f, 0.856346726f},
-std::array<float,2>{0.174085543f, 0.403365105f},
-std::array<float,2>{0.111073025f, 0.911240876f},
-std::array<float,2>{0.871909678f, 0.304181308f},
-std::array<float,2>{0.523414552f, 0.516626358f},
-std::array<float,2>{0.365679264f, 0.216739684f},
-std::array<float,2>{0.201866463f, 0.577994168f},
-std::array<float,2>{0.982585847f, 0.182073623f},
-std::array<float,2>{0.685688078f, 0.99614501f},
-std::array<float,2>{0.491583854f, 0.341465056f},
-std::array<float,2>{0.30752489f, 0.807306707f},
-std::array<float,2>{0.576264203f, 0.444626331f},
-std::array<float,2>{0.781309843f, 0.639333427f},
-std::array<float,2>{0.0442757681f, 0.0621119887f},
-std::array<float,2>{0.338387251f, 0.543066204f},
-std::array<float,2>{0.53653872f, 0.246169806f},
-std::array<float,2>{0.814075828f, 0.897684932f},
-std::array<float,2>{0.086843282f, 0.263173044f},
-std::array<float,2>{0.151393488f, 0.835713267f},
-std::array<float,2>{0.879474044f, 0.429880589f},
-std::array<float,2>{0.740440249f, 0.702320397f},
-std::array<float,2>{0.409902483f, 0.120387889f},
-std::array<float,2>{0.0300578531f, 0.672435343f},
-std::array<float,2>{0.775841534f, 0.0213886853f},
-std::array<float,2>{0.621340215f, 0.778486371f},
-std::array<float,2>{0.27465865f, 0.486873358f},
-std::array<float,2>{0.440834582f, 0.951847792f},
-std::array<float,2>{0.651771903f, 0.349540174f},
-std::array<float,2>{0.937871516f, 0.615817666f},
-std::array<float,2>{0.248604506f, 0.149845824f},
-std::array<float,2>{0.47302413f, 0.609064579f},
-std::array<float,2>{0.657030165f, 0.140424922f},
-std::array<float,2>{0.991540015f, 0.961474657f},
-std::array<float,2>{0.211012706f, 0.366513073f},
-std::array<float,2>{0.059709549f, 0.758946955f},
-std::array<float,2>{0.802567005f, 0.471635461f},
-std::array<float,2>{0.588865995f, 0.660408616f},
-std::array<float,2>{0.29663831f, 0.00637960294f},
-std::array<float,2>{0.156479254f, 0.712550521f},
-std::array<float,2>{0.916975021f, 0.107630819f},
-std::array<float,2>{0.692108572f, 0.819501936f},
-std::array<float,2>{0.380741298f, 0.406817228f},
-std::array<float,2>{0.353822917f, 0.878621757f},
-std::array<float,2>{0.500813305f, 0.272660345f},
-std::array<float,2>{0.846209288f, 0.551925361f},
-std::array<float,2>{0.104388952f, 0.224066496f},
-std::array<float,2>{0.255698562f, 0.654766798f},
-std::array<float,2>{0.605891347f, 0.0428204201f},
-std::array<float,2>{0.76350379f, 0.781280041f},
-std::array<float,2>{0.00251824129f, 0.463673264f},
-std::array<float,2>{0.225296453f, 0.973016202f},
-std::array<float,2>{0.953858972f, 0.327884972f},
-std::array<float,2>{0.636102676f, 0.580431283f},
-std::array<float,2>{0.464022547f, 0.15869236f},
-std::array<float,2>{0.0628604889f, 0.508593857f},
-std::array<float,2>{0.838079751f, 0.198619425f},
-std::array<float,2>{0.553401828f, 0.930494428f},
-std::array<float,2>{0.315813482f, 0.28228569f},
-std::array<float,2>{0.425920606f, 0.873473167f},
-std::array<float,2>{0.731101274f, 0.387601614f},
-std::array<float,2>{0.900291085f, 0.742059886f},
-std::array<float,2>{0.136154428f, 0.0890710577f},
-std::array<float,2>{0.457741797f, 0.665688694f},
-std::array<float,2>{0.630399525f, 0.00790805742f},
-std::array<float,2>{0.965075791f, 0.756116688f},
-std::array<float,2>{0.228516683f, 0.482168376f},
-std::array<float,2>{0.0153787555f, 0.954454184f},
-std::array<float,2>{0.752515197f, 0.373961776f},
-std::array<float,2>{0.601182282f, 0.596987247f},
-std::array<float,2>{0.26206857f, 0.131570712f},
-std::array<float,2>{0.128508121f, 0.556582689f},
-std::array<float,2>{0.894177794f, 0.226751804f},
-std::array<float,2>{0.725764215f, 0.889387667f},
-std::array<float,2>{0.43466419f, 0.276733011f},
-std::array<float,2>{0.327890545f, 0.826697409f},
-std::array<float,2>{0.558930159f, 0.418115884f},
-std::array<float,2>{0.835242271f, 0.707388163f},
-std::array<float,2>{0.0778657943f, 0.0960303098f},
-std::array<float,2>{0.284680456f, 0.587720454f},
-std::array<float,2>{0.58002305f, 0.164967179f},
-std::array<float,2>{0.809862792f, 0.977888048f},
-std::array<float,2>{0.0545223169f, 0.315770805f},
-std::array<float,2>{0.204067305f, 0.789700449f},
-std::array<float,2>{0.996027052f, 0.458304644f},
-std::array<float,2>{0.664200366f, 0.641973078f},
-std::array<float,2>{0.479703814f, 0.0319636688f},
-std::array<float,2>{0.0963925719f, 0.749221027f},
-std::array<float,2>{0.853815615f, 0.0812707245f},
-std::array<float,2>{0.511119962f, 0.860459924f},
-std::array<float,2>{0.347333014f, 0.378194451f},
-std::array<float,2>{0.389207512f, 0.92646867f},
-std::array<float,2>{0.69707191f, 0.293850183f},
-std::array<float,2>{0.907631874f, 0.502712429f},
-std::array<float,2>{0.171244338f, 0.190646961f},
-std::array<float,2>{0.41434446f, 0.529939294f},
-std::array<float,2>{0.746214569f, 0.210037574f},
-std::array<float,2>{0.888518631f, 0.920722485f},
-std::array<float,2>{0.146728754f, 0.307856858f},
-std::array<float,2>{0.0849711597f, 0.848319948f},
-std::array<float,2>{0.820916176f, 0.398249745f},
-std::array<float,2>{0.546133697f, 0.728012085f},
-std::array<float,2>{0.328361481f, 0.0638408586f},
-std::array<float,2>{0.234597802f, 0.625027537f},
-std::array<float,2>{0.948489726f, 0.0515223518f},
-std::array<float,2>{0.643093765f, 0.799218416f},
-std::array<float,2>{0.451447845f, 0.450394481f},
-std::array<float,2>{0.270882517f, 0.987647772f},
-std::array<float,2>{0.610680938f, 0.328981906f},
-std::array<float,2>{0.767342269f, 0.566007793f},
-std::array<float,2>{0.0211629719f, 0.174935788f},
-std::array<float,2>{0.374714732f, 0.688853741f},
-std::array<float,2>{0.525414765f, 0.110091016f},
-std::array<float,2>{0.86263442f, 0.843298137f},
-std::array<float,2>{0.120677523f, 0.4243007f},
-std::array<float,2>{0.185389459f, 0.899481237f},
-std::array<float,2>{0.936507642f, 0.25390318f},
-std::array<float,2>{0.708116233f, 0.535624266f},
-std::array<float,2>{0.390891105f, 0.238326415f},
-std::array<float,2>{0.0384821109f, 0.618394434f},
-std::array<float,2>{0.795577765f, 0.144034341f},
-std::array<float,2>{0.567943096f, 0.943105757f},
-std::array<float,2>{0.297186673f, 0.357521355f},
-std::array<float,2>{0.49304086f, 0.77268374f},
-std::array<float,2>{0.674150348f, 0.49450314f},
-std::array<float,2>{0.969816566f, 0.681121409f},
-std::array<float,2>{0.193021908f, 0.0241077095f},
-std::array<float,2>{0.485691845f, 0.703246713f},
-std::array<float,2>{0.682298899f, 0.0994987711f},
-std::array<float,2>{0.976883352f, 0.822343111f},
-std::array<float,2>{0.195480287f, 0.41579318f},
-std::array<float,2>{0.0420070589f, 0.883495629f},
-std::array<float,2>{0.78699404f, 0.280311227f},
-std::array<float,2>{0.573553026f, 0.55886054f},
-std::array<float,2>{0.309799075f, 0.232684329f},
-std::array<float,2>{0.177186042f, 0.597988605f},
-std::array<float,2>{0.925999641f, 0.128770918f},
-std::array<float,2>{0.716918647f, 0.960431457f},
-std::array<float,2>{0.401794016f, 0.368587881f},
-std::array<float,2>{0.359935075f, 0.750577986f},
-std::array<float,2>{0.515975952f, 0.480245084f},
-std::array<float,2>{0.868765771f, 0.668431163f},
-std::array<float,2>{0.113744535f, 0.0121795442f},
-std::array<float,2>{0.277939379f, 0.505159914f},
-std::array<float,2>{0.620705545f, 0.192531288f},
-std::array<float,2>{0.780759454f, 0.921959162f},
-std::array<float,2>{0.0256152842f, 0.290481687f},
-std::array<float,2>{0.245619252f, 0.866625369f},
-std::array<float,2>{0.9429214f, 0.379926145f},
-std::array<float,2>{0.653421521f, 0.74507767f},
-std::array<float,2>{0.444120228f, 0.0822398216f},
-std::array<float,2>{0.0934232473f, 0.647053957f},
-std::array<float,2>{0.817819655f, 0.0386113152f},
-std::array<float,2>{0.534713924f, 0.796676517f},
-std::array<float,2>{0.343643546f, 0.455788076f},
-std::array<float,2>{0.412310541f, 0.98401773f},
-std::array<float,2>{0.737635911f, 0.318105549f},
-std::array<float,2>{0.876698375f, 0.592515528f},
-std::array<float,2>{0.155329451f, 0.169777676f},
-std::array<float,2>{0.375064641f, 0.567741156f},
-std::array<float,2>{0.689226151f, 0.179020837f},
-std::array<float,2>{0.921829402f, 0.990614116f},
-std::array<float,2>{0.163094804f, 0.335829496f},
-std::array<float,2>{0.105529748f, 0.803150296f},
-std::array<float,2>{0.850504994f, 0.447458297f},
-std::array<float,2>{0.504292607f, 0.630200565f},
-std::array<float,2>{0.358569473f, 0.0494241975f},
-std::array<float,2>{0.21748437f, 0.731294751f},
-std::array<float,2>{0.98789227f, 0.0671337396f},
-std::array<float,2>{0.663622081f, 0.844735682f},
-std::array<float,2>{0.469508946f, 0.394499749f},
-std::array<float,2>{0.289950579f, 0.917129755f},
-std::array<float,2>{0.59301126f, 0.309176117f},
-std::array<float,2>{0.799949408f, 0.52541554f},
-std::array<float,2>{0.0554013252f, 0.203517675f},
-std::array<float,2>{0.318198085f, 0.686082184f},
-std::array<float,2>{0.549387455f, 0.0301076956f},
-std::array<float,2>{0.840131938f, 0.769413769f},
-std::array<float,2>{0.0702754483f, 0.498080611f},
-std::array<float,2>{0.140146822f, 0.940143943f},
-std::array<float,2>{0.903533638f, 0.355263293f},
-std::array<float,2>{0.729839087f, 0.624255061f},
-std::array<float,2>{0.425779283f, 0.144892722f},
-std::array<float,2>{0.00740155438f, 0.534222007f},
-std::array<float,2>{0.760446012f, 0.234856993f},
-std::array<float,2>{0.604482532f, 0.903068244f},
-std::array<float,2>{0.250229269f, 0.256524146f},
-std::array<float,2>{0.465795785f, 0.837184131f},
-std::array<float,2>{0.638068438f, 0.427446425f},
-std::array<float,2>{0.960749626f, 0.693488896f},
-std::array<float,2>{0.221529856f, 0.11434707f},
-std::array<float,2>{0.43313998f, 0.633398116f},
-std::array<float,2>{0.719989538f, 0.0575373843f},
-std::array<float,2>{0.894859254f, 0.811465919f},
-std::array<float,2>{0.131223559f, 0.439390689f},
-std::array<float,2>{0.0731613263f, 0.994529188f},
-std::array<float,2>{0.83167392f, 0.338089585f},
-std::array<float,2>{0.557516813f, 0.571213067f},
-std::array<float,2>{0.322556496f, 0.184872612f},
-std::array<float,2>{0.234068736f, 0.519894183f},
-std::array<float,2>{0.964729905f, 0.212047115f},
-std::array<float,2>{0.627514184f, 0.90773344f},
-std::array<float,2>{0.453396469f, 0.297063082f},
-std::array<float,2>{0.258502901f, 0.852212906f},
-std::array<float,2>{0.595669866f, 0.400889009f},
-std::array<float,2>{0.756498098f, 0.725978732f},
-std::array<float,2>{0.00790186878f, 0.073678866f},
-std::array<float,2>{0.350978374f, 0.613049805f},
-std::array<float,2>{0.51530385f, 0.153221786f},
-std::array<float,2>{0.856598198f, 0.947290182f},
-std::array<float,2>{0.100223169f, 0.345488667f},
-std::array<float,2>{0.166456833f, 0.774931252f},
-std::array<float,2>{0.911505878f, 0.488658398f},
-std::array<float,2>{0.701476872f, 0.679355264f},
-std::array<float,2>{0.385516167f, 0.0162501708f},
-std::array<float,2>{0.0469651408f, 0.69854933f},
-std::array<float,2>{0.807745218f, 0.1238361f},
-std::array<float,2>{0.585815132f, 0.828889787f},
-std::array<float,2>{0.285620511f, 0.436364084f},
-std::array<float,2>{0.483396143f, 0.892028511f},
-std::array<float,2>{0.669359922f, 0.260126442f},
-std::array<float,2>{0.999554694f, 0.539885283f},
-std::array<float,2>{0.209348604f, 0.243184716f},
-std::array<float,2>{0.446945161f, 0.550591052f},
-std::array<float,2>{0.646469057f, 0.2213597f},
-std::array<float,2>{0.953117073f, 0.88202405f},
-std::array<float,2>{0.241740555f, 0.267381132f},
-std::array<float,2>{0.0165637154f, 0.81527406f},
-std::array<float,2>{0.769797623f, 0.412983805f},
-std::array<float,2>{0.615546703f, 0.715581834f},
-std::array<float,2>{0.265708297f, 0.105085f},
-std::array<float,2>{0.140881941f, 0.657948017f},
-std::array<float,2>{0.884659231f, 0.00227846648f},
-std::array<float,2>{0.742453337f, 0.761833012f},
-std::array<float,2>{0.418486625f, 0.476002276f},
-std::array<float,2>{0.333997458f, 0.965637267f},
-std::array<float,2>{0.54059124f, 0.3597368f},
-std::array<float,2>{0.827461064f, 0.603164494f},
-std::array<float,2>{0.0817946568f, 0.13424401f},
-std::array<float,2>{0.303097099f, 0.737653911f},
-std::array<float,2>{0.565745652f, 0.0919036493f},
-std::array<float,2>{0.791945815f, 0.868058205f},
-std::array<float,2>{0.0336497352f, 0.386583418f},
-std::array<float,2>{0.189109892f, 0.936478436f},
-std::array<float,2>{0.975802302f, 0.285474062f},
-std::array<float,2>{0.678871214f, 0.512880325f},
-std::array<float,2>{0.498187244f, 0.200477064f},
-std::array<float,2>{0.123331442f, 0.582845926f},
-std::array<float,2>{0.866403997f, 0.16364786f},
-std::array<float,2>{0.529900372f, 0.970294595f},
-std::array<float,2>{0.37037006f, 0.322305202f},
-std::array<float,2>{0.394612104f, 0.787317812f},
-std::array<float,2>{0.705099285f, 0.466140747f},
-std::array<float,2>{0.93312335f, 0.648898125f},
-std::array<float,2>{0.183256075f, 0.0446789637f},
-std::array<float,2>{0.406460583f, 0.699819922f},
-std::array<float,2>{0.740130782f, 0.117533505f},
-std::array<float,2>{0.881784797f, 0.833682358f},
-std::array<float,2>{0.149395972f, 0.43223533f},
-std::array<float,2>{0.0894540921f, 0.894620061f},
-std::array<float,2>{0.814639628f, 0.264490575f},
-std::array<float,2>{0.538181722f, 0.545351803f},
-std::array<float,2>{0.337674052f, 0.249368846f},
-std::array<float,2>{0.247106627f, 0.614063323f},
-std::array<float,2>{0.939464211f, 0.151179284f},
-std::array<float,2>{0.650047243f, 0.95009625f},
-std::array<float,2>{0.438438118f, 0.351331323f},
-std::array<float,2>{0.275592029f, 0.779720724f},
-std::array<float,2>{0.624531507f, 0.484892786f},
-std::array<float,2>{0.773616016f, 0.674556494f},
-std::array<float,2>{0.0292176567f, 0.022436887f},
-std::array<float,2>{0.36507687f, 0.518747926f},
-std::array<float,2>{0.519953191f, 0.217587888f},
-std::array<float,2>{0.873580337f, 0.913163364f},
-std::array<float,2>{0.112502337f, 0.301546931f},
-std::array<float,2>{0.172011673f, 0.85873276f},
-std::array<float,2>{0.923895776f, 0.404901385f},
-std::array<float,2>{0.714748085f, 0.721200943f},
-std::array<float,2>{0.403219968f, 0.0745747611f},
-std::array<float,2>{0.045562245f, 0.637085795f},
-std::array<float,2>{0.784802735f, 0.060302794f},
-std::array<float,2>{0.575904906f, 0.805345654f},
-std::array<float,2>{0.305991083f, 0.442823797f},
-std::array<float,2>{0.490060538f, 0.999968112f},
-std::array<float,2>{0.684129179f, 0.343407869f},
-std::array<float,2>{0.982124567f, 0.574437439f},
-std::array<float,2>{0.199910954f, 0.180704638f},
-std::array<float,2>{0.461501032f, 0.578703582f},
-std::array<float,2>{0.634541273f, 0.156456411f},
-std::array<float,2>{0.955365777f, 0.97592026f},
-std::array<float,2>{0.223870218f, 0.324320078f},
-std::array<float,2>{0.00160949957f, 0.784283221f},
-std::array<float,2>{0.764840662f, 0.461642087f},
-std::array<float,2>{0.608993948f, 0.654123843f},
-std::array<float,2>{0.256394476f, 0.0391984247f},
-std::array<float,2>{0.133247003f, 0.738821805f},
-std::array<float,2>{0.901436806f, 0.0861218646f},
-std::array<float,2>{0.73262018f, 0.872378349f},
-std::array<float,2>{0.427811056f, 0.389133066f},
-std::array<float,2>{0.312885314f, 0.932161331f},
-std::array<float,2>{0.551243603f, 0.284601897f},
-std::array<float,2>{0.836665332f, 0.510170162f},
-std::array<float,2>{0.0651857406f, 0.196218207f},
-std::array<float,2>{0.294577211f, 0.66331917f},
-std::array<float,2>{0.586793661f, 0.00565694552f},
-std::array<float,2>{0.804264188f, 0.760449946f},
-std::array<float,2>{0.0624882318f, 0.469474554f},
-std::array<float,2>{0.213778466f, 0.96450299f},
-std::array<float,2>{0.989885211f, 0.363293916f},
-std::array<float,2>{0.658749521f, 0.606267691f},
-std::array<float,2>{0.476069003f, 0.13792859f},
-std::array<float,2>{0.101671204f, 0.554124236f},
-std::array<float,2>{0.845278382f, 0.225344107f},
-std::array<float,2>{0.503846943f, 0.875912011f},
-std::array<float,2>{0.352232039f, 0.270344585f},
-std::array<float,2>{0.380994678f, 0.816489637f},
-std::array<float,2>{0.695149362f, 0.40855822f},
-std::array<float,2>{0.915515602f, 0.714076638f},
-std::array<float,2>{0.159385592f, 0.10548456f},
-std::array<float,2>{0.476575017f, 0.643959582f},
-std::array<float,2>{0.667928398f, 0.0342052616f},
-std::array<float,2>{0.992195606f, 0.792204022f},
-std::array<float,2>{0.206019491f, 0.459855229f},
-std::array<float,2>{0.0517903641f, 0.979926527f},
-std::array<float,2>{0.812011659f, 0.312934697f},
-std::array<float,2>{0.581374824f, 0.588281035f},
-std::array<float,2>{0.28209731f, 0.166112736f},
-std::array<float,2>{0.169035867f, 0.500232339f},
-std::array<float,2>{0.90970391f, 0.187504783f},
-std::array<float,2>{0.698796272f, 0.929591238f},
-std::array<float,2>{0.387276202f, 0.2968027f},
-std::array<float,2>{0.345035195f, 0.861447692f},
-std::array<float,2>{0.50900656f, 0.376438886f},
-std::array<float,2>{0.853163123f, 0.746304691f},
-std::array<float,2>{0.0949841291f, 0.0788452104f},
-std::array<float,2>{0.264468402f, 0.594850719f},
-std::array<float,2>{0.59793967f, 0.129254907f},
-std::array<float,2>{0.750862479f, 0.955524325f},
-std::array<float,2>{0.0136093339f, 0.371637285f},
-std::array<float,2>{0.227212369f, 0.75494802f},
-std::array<float,2>{0.968140662f, 0.483967751f},
-std::array<float,2>{0.631641805f, 0.666145027f},
-std::array<float,2>{0.460627437f, 0.0112982318f},
-std::array<float,2>{0.0745276287f, 0.709322631f},
-std::array<float,2>{0.832829893f, 0.0952478498f},
-std::array<float,2>{0.562150061f, 0.824945867f},
-std::array<float,2>{0.325068504f, 0.420202762f},
-std::array<float,2>{0.437074959f, 0.886755288f},
-std::array<float,2>{0.724553764f, 0.274104118f},
-std::array<float,2>{0.891750932f, 0.557560503f},
-std::array<float,2>{0.12506339f, 0.228642672f},
-std::array<float,2>{0.394416004f, 0.538158298f},
-std::array<float,2>{0.709351778f, 0.241955072f},
-std::array<float,2>{0.93459183f, 0.90173167f},
-std::array<float,2>{0.185804129f, 0.251554847f},
-std::array<float,2>{0.118381292f, 0.841434717f},
-std::array<float,2>{0.859997094f, 0.422129542f},
-std::array<float,2>{0.524964273f, 0.691164672f},
-std::array<float,2>{0.371899813f, 0.11186821f},
-std::array<float,2>{0.193747401f, 0.682935655f},
-std::array<float,2>{0.97183913f, 0.0272497796f},
-std::array<float,2>{0.673488319f, 0.77096802f},
-std::array<float,2>{0.494475424f, 0.4934856f},
-std::array<float,2>{0.299940169f, 0.943581522f},
-std::array<float,2>{0.569727898f, 0.356499612f},
-std::array<float,2>{0.792972445f, 0.620883286f},
-std::array<float,2>{0.0361445695f, 0.142231658f},
-std::array<float,2>{0.330163091f, 0.729355454f},
-std::array<float,2>{0.544017971f, 0.0663105026f},
-std::array<float,2>{0.82276243f, 0.850435317f},
-std::array<float,2>{0.0835855007f, 0.394936055f},
-std::array<float,2>{0.145337284f, 0.918034375f},
-std::array<float,2>{0.889807701f, 0.305867106f},
-std::array<float,2>{0.749917686f, 0.527362823f},
-std::array<float,2>{0.416296065f, 0.208261251f},
-std::array<float,2>{0.0226631779f, 0.56345582f},
-std::array<float,2>{0.768653393f, 0.173019871f},
-std::array<float,2>{0.611522079f, 0.984520495f},
-std::array<float,2>{0.273330718f, 0.330563337f},
-std::array<float,2>{0.449256837f, 0.798475623f},
-std::array<float,2>{0.641614974f, 0.451248854f},
-std::array<float,2>{0.946960032f, 0.627961457f},
-std::array<float,2>{0.238025084f, 0.0533561148f},
-std::array<float,2>{0.441592783f, 0.742822587f},
-std::array<float,2>{0.655748904f, 0.0857240632f},
-std::array<float,2>{0.944039404f, 0.864332199f},
-std::array<float,2>{0.243797243f, 0.38130191f},
-std::array<float,2>{0.0242025703f, 0.924022734f},
-std::array<float,2>{0.778374255f, 0.291187406f},
-std::array<float,2>{0.618450165f, 0.507525027f},
-std::array<float,2>{0.279533505f, 0.194904029f},
-std::array<float,2>{0.154055148f, 0.591160476f},
-std::array<float,2>{0.878392458f, 0.171431541f},
-std::array<float,2>{0.735845804f, 0.982157886f},
-std::array<float,2>{0.411571413f, 0.319241434f},
-std::array<float,2>{0.340737134f, 0.79364121f},
-std::array<float,2>{0.531768858f, 0.454620898f},
-std::array<float,2>{0.818735778f, 0.645413339f},
-std::array<float,2>{0.0900302008f, 0.0358023383f},
-std::array<float,2>{0.311481863f, 0.561446071f},
-std::array<float,2>{0.571240962f, 0.230588213f},
-std::array<float,2>{0.787818909f, 0.884916425f},
-std::array<float,2>{0.0398324952f, 0.278338939f},
-std::array<float,2>{0.198142335f, 0.821944773f},
-std::array<float,2>{0.978684604f, 0.417114556f},
-std::array<float,2>{0.680284917f, 0.705502033f},
-std::array<float,2>{0.487298429f, 0.101081416f},
-std::array<float,2>{0.115321442f, 0.671702504f},
-std::array<float,2>{0.869567692f, 0.0137297641f},
-std::array<float,2>{0.519337595f, 0.752427101f},
-std::array<float,2>{0.363274395f, 0.477462322f},
-std::array<float,2>{0.399462342f, 0.958058f},
-std::array<float,2>{0.715514064f, 0.370833367f},
-std::array<float,2>{0.928301096f, 0.600713432f},
-std::array<float,2>{0.179580584f, 0.12567535f},
-std::array<float,2>{0.422457546f, 0.622173667f},
-std::array<float,2>{0.728493571f, 0.147493795f},
-std::array<float,2>{0.905439258f, 0.939111054f},
-std::array<float,2>{0.137466922f, 0.352908075f},
-std::array<float,2>{0.0671703294f, 0.767288268f},
-std::array<float,2>{0.843700051f, 0.496296912f},
-std::array<float,2>{0.548143208f, 0.68448168f},
-std::array<float,2>{0.318759173f, 0.0289520808f},
-std::array<float,2>{0.219777286f, 0.692835867f},
-std::array<float,2>{0.958737016f, 0.116614595f},
-std::array<float,2>{0.640289009f, 0.838238776f},
-std::array<float,2>{0.46841234f, 0.428392351f},
-std::array<float,2>{0.253350943f, 0.905995548f},
-std::array<float,2>{0.603118718f, 0.255849987f},
-std::array<float,2>{0.758458674f, 0.532871604f},
-std::array<float,2>{0.0043839165f, 0.238022462f},
-std::array<float,2>{0.355473578f, 0.632737339f},
-std::array<float,2>{0.507638216f, 0.0478708297f},
-std::array<float,2>{0.848804235f, 0.801845551f},
-std::array<float,2>{0.108698033f, 0.447082728f},
-std::array<float,2>{0.160696924f, 0.989890337f},
-std::array<float,2>{0.91921097f, 0.33348763f},
-std::array<float,2>{0.691207409f, 0.569432974f},
-std::array<float,2>{0.378235489f, 0.176975906f},
-std::array<float,2>{0.0583265014f, 0.525177717f},
-std::array<float,2>{0.79811579f, 0.205269828f},
-std::array<float,2>{0.590528071f, 0.914812982f},
-std::array<float,2>{0.291196555f, 0.310779482f},
-std::array<float,2>{0.471491039f, 0.846559703f},
-std::array<float,2>{0.660401821f, 0.390850306f},
-std::array<float,2>{0.985092759f, 0.733857512f},
-std::array<float,2>{0.216243774f, 0.0687625706f},
-std::array<float,2>{0.383019358f, 0.676966906f},
-std::array<float,2>{0.699788094f, 0.0190731902f},
-std::array<float,2>{0.913289964f, 0.775797546f},
-std::array<float,2>{0.165355116f, 0.491232514f},
-std::array<float,2>{0.0994593799f, 0.94568336f},
-std::array<float,2>{0.858187675f, 0.346534818f},
-std::array<float,2>{0.511879385f, 0.60998565f},
-std::array<float,2>{0.34865424f, 0.155427158f},
-std::array<float,2>{0.2085042f, 0.541939318f},
-std::array<float,2>{0.997459948f, 0.245226562f},
-std::array<float,2>{0.671825051f, 0.893228412f},
-std::array<float,2>{0.480471313f, 0.259120286f},
-std::array<float,2>{0.288514555f, 0.83149451f},
-std::array<float,2>{0.58372575f, 0.43553409f},
-std::array<float,2>{0.804688752f, 0.695545435f},
-std::array<float,2>{0.0502996929f, 0.122797482f},
-std::array<float,2>{0.321246475f, 0.573421001f},
-std::array<float,2>{0.556324542f, 0.187247992f},
-std::array<float,2>{0.828766823f, 0.993194878f},
-std::array<float,2>{0.0716571733f, 0.337673634f},
-std::array<float,2>{0.13045077f, 0.809678674f},
-std::array<float,2>{0.897799134f, 0.439918786f},
-std::array<float,2>{0.72082454f, 0.636420488f},
-std::array<float,2>{0.431474477f, 0.055296436f},
-std::array<float,2>{0.010976648f, 0.723525345f},
-std::array<float,2>{0.754921317f, 0.0704030171f},
-std::array<float,2>{0.597562551f, 0.853677034f},
-std::array<float,2>{0.259996533f, 0.399538875f},
-std::array<float,2>{0.456643999f, 0.909365773f},
-std::array<float,2>{0.625038147f, 0.300541043f},
-std::array<float,2>{0.961871624f, 0.523257673f},
-std::array<float,2>{0.23188208f, 0.213361502f},
-std::array<float,2>{0.496208459f, 0.514217794f},
-std::array<float,2>{0.67585665f, 0.201213598f},
-std::array<float,2>{0.973848879f, 0.934322119f},
-std::array<float,2>{0.191044673f, 0.28831476f},
-std::array<float,2>{0.0314806513f, 0.869873345f},
-std::array<float,2>{0.790844858f, 0.383335739f},
-std::array<float,2>{0.563492477f, 0.734539986f},
-std::array<float,2>{0.301956683f, 0.091622293f},
-std::array<float,2>{0.179887891f, 0.650886476f},
-std::array<float,2>{0.931504905f, 0.0455462597f},
-std::array<float,2>{0.704175889f, 0.786126018f},
-std::array<float,2>{0.397027224f, 0.468236119f},
-std::array<float,2>{0.368588924f, 0.970756471f},
-std::array<float,2>{0.528706431f, 0.32166031f},
-std::array<float,2>{0.863746524f, 0.585842431f},
-std::array<float,2>{0.121898904f, 0.160649374f},
-std::array<float,2>{0.268659055f, 0.717001617f},
-std::array<float,2>{0.614798248f, 0.102043524f},
-std::array<float,2>{0.772100806f, 0.814326167f},
-std::array<float,2>{0.0183956828f, 0.410191894f},
-std::array<float,2>{0.239554048f, 0.879970968f},
-std::array<float,2>{0.950145245f, 0.268733591f},
-std::array<float,2>{0.648073494f, 0.548519909f},
-std::array<float,2>{0.448358446f, 0.219147384f},
-std::array<float,2>{0.0797394738f, 0.605099082f},
-std::array<float,2>{0.825207114f, 0.136148289f},
-std::array<float,2>{0.541591763f, 0.968657136f},
-std::array<float,2>{0.333620429f, 0.362682968f},
-std::array<float,2>{0.421693474f, 0.765417278f},
-std::array<float,2>{0.745089054f, 0.473060399f},
-std::array<float,2>{0.885754645f, 0.65882051f},
-std::array<float,2>{0.143636376f, 0.00132405176f},
-std::array<float,2>{0.416899174f, 0.728286982f},
-std::array<float,2>{0.749163926f, 0.0643589497f},
-std::array<float,2>{0.890138686f, 0.847708642f},
-std::array<float,2>{0.144643888f, 0.397486597f},
-std::array<float,2>{0.0834507719f, 0.920167923f},
-std::array<float,2>{0.822505951f, 0.308199316f},
-std::array<float,2>{0.544619679f, 0.529472589f},
-std::array<float,2>{0.330753118f, 0.2107566f},
-std::array<float,2>{0.237765044f, 0.565471649f},
-std::array<float,2>{0.946723878f, 0.17563729f},
-std::array<float,2>{0.642179906f, 0.988237381f},
-std::array<float,2>{0.449991673f, 0.328482389f},
-std::array<float,2>{0.272635847f, 0.799393654f},
-std::array<float,2>{0.612123132f, 0.451007545f},
-std::array<float,2>{0.769246459f, 0.625757337f},
-std::array<float,2>{0.0230001509f, 0.050935965f},
-std::array<float,2>{0.371567875f, 0.536109328f},
-std::array<float,2>{0.524573982f, 0.239131406f},
-std::array<float,2>{0.859609663f, 0.899957895f},
-std::array<float,2>{0.118885167f, 0.253087401f},
-std::array<float,2>{0.18618834f, 0.843166292f},
-std::array<float,2>{0.935098648f, 0.42444852f},
-std::array<float,2>{0.709879518f, 0.689417422f},
-std::array<float,2>{0.393970728f, 0.109807752f},
-std::array<float,2>{0.0366746411f, 0.681373537f},
-std::array<float,2>{0.793785691f, 0.0236909539f},
-std::array<float,2>{0.570270836f, 0.77333194f},
-std::array<float,2>{0.300343484f, 0.494926631f},
-std::array<float,2>{0.494996279f, 0.942709684f},
-std::array<float,2>{0.673252702f, 0.358195364f},
-std::array<float,2>{0.972215176f, 0.618978083f},
-std::array<float,2>{0.194042549f, 0.144529268f},
-std::array<float,2>{0.460196614f, 0.597188175f},
-std::array<float,2>{0.631337762f, 0.131067708f},
-std::array<float,2>{0.968589544f, 0.954930723f},
-std::array<float,2>{0.226702899f, 0.373504132f},
-std::array<float,2>{0.0130785182f, 0.756483197f},
-std::array<float,2>{0.750019252f, 0.481641471f},
-std::array<float,2>{0.598153532f, 0.66544044f},
-std::array<float,2>{0.263784021f, 0.00861761998f},
-std::array<float,2>{0.125536188f, 0.707922697f},
-std::array<float,2>{0.892146885f, 0.0966039449f},
-std::array<float,2>{0.724011064f, 0.82624042f},
-std::array<float,2>{0.436952204f, 0.418611467f},
-std::array<float,2>{0.324495167f, 0.88900435f},
-std::array<float,2>{0.561859488f, 0.276898116f},
-std::array<float,2>{0.832325161f, 0.555827498f},
-std::array<float,2>{0.0751147419f, 0.227451622f},
-std::array<float,2>{0.281619668f, 0.642443955f},
-std::array<float,2>{0.581577897f, 0.0313369296f},
-std::array<float,2>{0.812391877f, 0.789245784f},
-std::array<float,2>{0.0522863343f, 0.458709508f},
-std::array<float,2>{0.205118701f, 0.978288591f},
-std::array<float,2>{0.992987454f, 0.316384822f},
-std::array<float,2>{0.667076886f, 0.587162554f},
-std::array<float,2>{0.477233976f, 0.164275914f},
-std::array<float,2>{0.0953435898f, 0.502017677f},
-std::array<float,2>{0.852964938f, 0.191038027f},
-std::array<float,2>{0.509676754f, 0.925846815f},
-std::array<float,2>{0.345389754f, 0.293161064f},
-std::array<float,2>{0.387014478f, 0.86091733f},
-std::array<float,2>{0.698544502f, 0.378865331f},
-std::array<float,2>{0.909642994f, 0.749847174f},
-std::array<float,2>{0.169741362f, 0.0818709135f},
-std::array<float,2>{0.476108789f, 0.660780311f},
-std::array<float,2>{0.658392012f, 0.00611828873f},
-std::array<float,2>{0.989353657f, 0.759315789f},
-std::array<float,2>{0.213368386f, 0.470781356f},
-std::array<float,2>{0.061794959f, 0.961182654f},
-std::array<float,2>{0.803729832f, 0.367174268f},
-std::array<float,2>{0.586279631f, 0.608667016f},
-std::array<float,2>{0.294213653f, 0.139677554f},
-std::array<float,2>{0.159970701f, 0.552301705f},
-std::array<float,2>{0.91601342f, 0.22442542f},
-std::array<float,2>{0.694421649f, 0.878361166f},
-std::array<float,2>{0.381793201f, 0.273186147f},
-std::array<float,2>{0.351754069f, 0.819984615f},
-std::array<float,2>{0.503356099f, 0.406411082f},
-std::array<float,2>{0.844950497f, 0.712070405f},
-std::array<float,2>{0.102417246f, 0.108306475f},
-std::array<float,2>{0.255958229f, 0.581020296f},
-std::array<float,2>{0.60868305f, 0.158392012f},
-std::array<float,2>{0.765456855f, 0.973620057f},
-std::array<float,2>{0.00125875371f, 0.327553183f},
-std::array<float,2>{0.224348217f, 0.781769395f},
-std::array<float,2>{0.955621481f, 0.463125825f},
-std::array<float,2>{0.634221852f, 0.65514046f},
-std::array<float,2>{0.46122539f, 0.0422069207f},
-std::array<float,2>{0.0646256357f, 0.741338968f},
-std::array<float,2>{0.835969985f, 0.0897106454f},
-std::array<float,2>{0.551418304f, 0.873766303f},
-std::array<float,2>{0.313125044f, 0.387088597f},
-std::array<float,2>{0.42825079f, 0.92994684f},
-std::array<float,2>{0.733141243f, 0.283161759f},
-std::array<float,2>{0.902097404f, 0.507838428f},
-std::array<float,2>{0.133333743f, 0.198730722f},
-std::array<float,2>{0.40239051f, 0.517373204f},
-std::array<float,2>{0.714264631f, 0.215998113f},
-std::array<float,2>{0.924414396f, 0.911779583f},
-std::array<float,2>{0.17246443f, 0.304594785f},
-std::array<float,2>{0.113052487f, 0.855801165f},
-std::array<float,2>{0.873220921f, 0.404272944f},
-std::array<float,2>{0.520162523f, 0.719230831f},
-std::array<float,2>{0.364398718f, 0.0776099563f},
-std::array<float,2>{0.199443847f, 0.638917327f},
-std::array<float,2>{0.981595397f, 0.0615388565f},
-std::array<float,2>{0.68400377f, 0.807117283f},
-std::array<float,2>{0.489517123f, 0.445189655f},
-std::array<float,2>{0.306436002f, 0.997043073f},
-std::array<float,2>{0.575542152f, 0.341225028f},
-std::array<float,2>{0.784222603f, 0.577572048f},
-std::array<float,2>{0.0451851673f, 0.182247236f},
-std::array<float,2>{0.336961985f, 0.70285666f},
-std::array<float,2>{0.538802505f, 0.120748609f},
-std::array<float,2>{0.815188169f, 0.835222125f},
-std::array<float,2>{0.0891440213f, 0.430545151f},
-std::array<float,2>{0.148670182f, 0.898062229f},
-std::array<float,2>{0.881259322f, 0.263465077f},
-std::array<float,2>{0.739310265f, 0.543588161f},
-std::array<float,2>{0.407065541f, 0.246932328f},
-std::array<float,2>{0.0287382696f, 0.61568737f},
-std::array<float,2>{0.774196506f, 0.150076568f},
-std::array<float,2>{0.624295413f, 0.951548219f},
-std::array<float,2>{0.276209414f, 0.34881568f},
-std::array<float,2>{0.437624425f, 0.77919513f},
-std::array<float,2>{0.649430156f, 0.486401856f},
-std::array<float,2>{0.940226018f, 0.672362745f},
-std::array<float,2>{0.247808784f, 0.0205700975f},
-std::array<float,2>{0.449170947f, 0.714846313f},
-std::array<float,2>{0.647496879f, 0.104665428f},
-std::array<float,2>{0.949396193f, 0.81465888f},
-std::array<float,2>{0.240057617f, 0.412478536f},
-std::array<float,2>{0.017981844f, 0.882495344f},
-std::array<float,2>{0.771692574f, 0.266776145f},
-std::array<float,2>{0.614628851f, 0.55023694f},
-std::array<float,2>{0.269207925f, 0.220951438f},
-std::array<float,2>{0.14450942f, 0.602653146f},
-std::array<float,2>{0.886581659f, 0.134367794f},
-std::array<float,2>{0.744488299f, 0.964989603f},
-std::array<float,2>{0.421290845f, 0.360256761f},
-std::array<float,2>{0.333389252f, 0.762400389f},
-std::array<float,2>{0.541292071f, 0.476535529f},
-std::array<float,2>{0.825941265f, 0.657416224f},
-std::array<float,2>{0.0792868808f, 0.00285677775f},
-std::array<float,2>{0.302485824f, 0.513487577f},
-std::array<float,2>{0.563975215f, 0.201096162f},
-std::array<float,2>{0.790348709f, 0.935576856f},
-std::array<float,2>{0.031823162f, 0.285794735f},
-std::array<float,2>{0.190860212f, 0.867660165f},
-std::array<float,2>{0.974363089f, 0.38609153f},
-std::array<float,2>{0.676333249f, 0.738199234f},
-std::array<float,2>{0.496584564f, 0.0926248431f},
-std::array<float,2>{0.121248826f, 0.648946345f},
-std::array<float,2>{0.864014566f, 0.0443580411f},
-std::array<float,2>{0.528942943f, 0.787768185f},
-std::array<float,2>{0.369009495f, 0.466388673f},
-std::array<float,2>{0.396670908f, 0.970056295f},
-std::array<float,2>{0.704950929f, 0.323041707f},
-std::array<float,2>{0.931060493f, 0.582385123f},
-std::array<float,2>{0.180358499f, 0.163305745f},
-std::array<float,2>{0.430798411f, 0.570714831f},
-std::array<float,2>{0.721362114f, 0.185161993f},
-std::array<float,2>{0.898368239f, 0.995047629f},
-std::array<float,2>{0.130199f, 0.33853671f},
-std::array<float,2>{0.0720095336f, 0.810729206f},
-std::array<float,2>{0.828547299f, 0.438922882f},
-std::array<float,2>{0.556022108f, 0.632813811f},
-std::array<float,2>{0.32052359f, 0.0567956902f},
-std::array<float,2>{0.232014567f, 0.726379156f},
-std::array<float,2>{0.961225927f, 0.0741210878f},
-std::array<float,2>{0.625599623f, 0.851995468f},
-std::array<float,2>{0.456164628f, 0.400434554f},
-std::array<float,2>{0.26046598f, 0.907606483f},
-std::array<float,2>{0.596915662f, 0.29777658f},
-std::array<float,2>{0.755756319f, 0.520062625f},
-std::array<float,2>{0.0116896583f, 0.21288228f},
-std::array<float,2>{0.349218607f, 0.678744495f},
-std::array<float,2>{0.512694836f, 0.0161116254f},
-std::array<float,2>{0.857446373f, 0.774722517f},
-std::array<float,2>{0.0987790748f, 0.489134878f},
-std::array<float,2>{0.165560931f, 0.948159635f},
-std::array<float,2>{0.913631141f, 0.344740629f},
-std::array<float,2>{0.69923389f, 0.612380087f},
-std::array<float,2>{0.383384258f, 0.152440369f},
-std::array<float,2>{0.0501154847f, 0.539420307f},
-std::array<float,2>{0.805628657f, 0.243660599f},
-std::array<float,2>{0.583086133f, 0.892324567f},
-std::array<float,2>{0.288853675f, 0.260476619f},
-std::array<float,2>{0.481376529f, 0.828265846f},
-std::array<float,2>{0.671319187f, 0.435819834f},
-std::array<float,2>{0.997609437f, 0.699032485f},
-std::array<float,2>{0.208051056f, 0.123413309f},
-std::array<float,2>{0.378792048f, 0.630690992f},
-std::array<float,2>{0.690907419f, 0.0491080359f},
-std::array<float,2>{0.919464529f, 0.803625703f},
-std::array<float,2>{0.160496235f, 0.447867364f},
-std::array<float,2>{0.109086618f, 0.991062999f},
-std::array<float,2>{0.849366963f, 0.335012197f},
-std::array<float,2>{0.507170975f, 0.567881405f},
-std::array<float,2>{0.356061488f, 0.179509923f},
-std::array<float,2>{0.216436937f, 0.526251972f},
-std::array<float,2>{0.984582126f, 0.203646451f},
-std::array<float,2>{0.661118984f, 0.917838156f},
-std::array<float,2>{0.470943928f, 0.308845669f},
-std::array<float,2>{0.291739315f, 0.845690489f},
-std::array<float,2>{0.589950264f, 0.393964946f},
-std::array<float,2>{0.79860884f, 0.730787218f},
-std::array<float,2>{0.0578263924f, 0.0666862503f},
-std::array<float,2>{0.319284886f, 0.624899626f},
-std::array<float,2>{0.548780382f, 0.145077869f},
-std::array<float,2>{0.843166292f, 0.939604759f},
-std::array<float,2>{0.0666818768f, 0.354617894f},
-std::array<float,2>{0.136957496f, 0.768571913f},
-std::array<float,2>{0.906176507f, 0.49876982f},
-std::array<float,2>{0.727845669f, 0.685942054f},
-std::array<float,2>{0.422177315f, 0.0293393545f},
-std::array<float,2>{0.00455271034f, 0.694110096f},
-std::array<float,2>{0.75825578f, 0.115000755f},
-std::array<float,2>{0.602957487f, 0.837484002f},
-std::array<float,2>{0.253753364f, 0.426792741f},
-std::array<float,2>{0.467929989f, 0.902472675f},
-std::array<float,2>{0.639938056f, 0.256122559f},
-std::array<float,2>{0.95804441f, 0.535053492f},
-std::array<float,2>{0.220494404f, 0.235295683f},
-std::array<float,2>{0.486341029f, 0.559123814f},
-std::array<float,2>{0.680116594f, 0.233300239f},
-std::array<float,2>{0.979074895f, 0.882903397f},
-std::array<float,2>{0.197270274f, 0.280774862f},
-std::array<float,2>{0.0391885862f, 0.823033452f},
-std::array<float,2>{0.78712374f, 0.415361345f},
-std::array<float,2>{0.570740283f, 0.703840435f},
-std::array<float,2>{0.310622096f, 0.0989959985f},
-std::array<float,2>{0.178811803f, 0.66861105f},
-std::array<float,2>{0.927892923f, 0.0125708496f},
-std::array<float,2>{0.715207875f, 0.750391185f},
-std::array<float,2>{0.400170416f, 0.479696006f},
-std::array<float,2>{0.36275208f, 0.960735321f},
-std::array<float,2>{0.518825114f, 0.368833899f},
-std::array<float,2>{0.869669974f, 0.598148942f},
-std::array<float,2>{0.115919828f, 0.128190845f},
-std::array<float,2>{0.280262709f, 0.744415164f},
-std::array<float,2>{0.619080067f, 0.0829121917f},
-std::array<float,2>{0.7790277f, 0.866903245f},
-std::array<float,2>{0.0237237699f, 0.380477697f},
-std::array<float,2>{0.243271336f, 0.922661006f},
-std::array<float,2>{0.943530142f, 0.290633231f},
-std::array<float,2>{0.656164408f, 0.505518377f},
-std::array<float,2>{0.442234576f, 0.192953452f},
-std::array<float,2>{0.0905642956f, 0.592140079f},
-std::array<float,2>{0.818855762f, 0.169069856f},
-std::array<float,2>{0.531278133f, 0.98369664f},
-std::array<float,2>{0.340114951f, 0.317383915f},
-std::array<float,2>{0.412098557f, 0.796028972f},
-std::array<float,2>{0.735524893f, 0.45555222f},
-std::array<float,2>{0.87847054f, 0.646965921f},
-std::array<float,2>{0.153558478f, 0.0382650271f},
-std::array<float,2>{0.391116232f, 0.690660954f},
-std::array<float,2>{0.708859503f, 0.111415684f},
-std::array<float,2>{0.935816228f, 0.841090441f},
-std::array<float,2>{0.185046434f, 0.4225142f},
-std::array<float,2>{0.120311789f, 0.901875734f},
-std::array<float,2>{0.863053799f, 0.250997186f},
-std::array<float,2>{0.525974691f, 0.53879559f},
-std::array<float,2>{0.374307066f, 0.241605908f},
-std::array<float,2>{0.192623436f, 0.620371521f},
-std::array<float,2>{0.97065264f, 0.142089829f},
-std::array<float,2>{0.674494684f, 0.944037855f},
-std::array<float,2>{0.492662877f, 0.357260525f},
-std::array<float,2>{0.297595888f, 0.771193087f},
-std::array<float,2>{0.567603827f, 0.493752003f},
-std::array<float,2>{0.79510349f, 0.683418155f},
-std::array<float,2>{0.0390241295f, 0.0264729653f},
-std::array<float,2>{0.329017818f, 0.528259158f},
-std::array<float,2>{0.546670079f, 0.208591685f},
-std::array<float,2>{0.820380032f, 0.91855979f},
-std::array<float,2>{0.0858155638f, 0.306184441f},
-std::array<float,2>{0.14709793f, 0.849621296f},
-std::array<float,2>{0.887848794f, 0.395439476f},
-std::array<float,2>{0.746841371f, 0.728648841f},
-std::array<float,2>{0.414699048f, 0.0655646846f},
-std::array<float,2>{0.0205884576f, 0.628620088f},
-std::array<float,2>{0.766805887f, 0.0529496036f},
-std::array<float,2>{0.61127317f, 0.798242211f},
-std::array<float,2>{0.271300286f, 0.451858848f},
-std::array<float,2>{0.451751381f, 0.985155582f},
-std::array<float,2>{0.642880797f, 0.330872834f},
-std::array<float,2>{0.948927581f, 0.562670827f},
-std::array<float,2>{0.235232085f, 0.173680767f},
-std::array<float,2>{0.479984432f, 0.588393569f},
-std::array<float,2>{0.664934397f, 0.166825309f},
-std::array<float,2>{0.995366096f, 0.980009258f},
-std::array<float,2>{0.203191727f, 0.313475072f},
-std::array<float,2>{0.0539791808f, 0.792853653f},
-std::array<float,2>{0.810542405f, 0.459155411f},
-std::array<float,2>{0.579112947f, 0.64446187f},
-std::array<float,2>{0.284604996f, 0.0347622782f},
-std::array<float,2>{0.171838105f, 0.746872425f},
-std::array<float,2>{0.907964587f, 0.07840278f},
-std::array<float,2>{0.696766794f, 0.862235188f},
-std::array<float,2>{0.388689727f, 0.376891822f},
-std::array<float,2>{0.346761703f, 0.92873466f},
-std::array<float,2>{0.511620224f, 0.296276957f},
-std::array<float,2>{0.854384363f, 0.500800848f},
-std::array<float,2>{0.0961424038f, 0.188287109f},
-std::array<float,2>{0.26224035f, 0.666979194f},
-std::array<float,2>{0.600595951f, 0.0109166643f},
-std::array<float,2>{0.752189875f, 0.755690515f},
-std::array<float,2>{0.0146726584f, 0.483487546f},
-std::array<float,2>{0.229276106f, 0.95596838f},
-std::array<float,2>{0.965692401f, 0.371289164f},
-std::array<float,2>{0.630196393f, 0.595532298f},
-std::array<float,2>{0.457174242f, 0.129649878f},
-std::array<float,2>{0.0774975196f, 0.557105958f},
-std::array<float,2>{0.835797548f, 0.229074344f},
-std::array<float,2>{0.559455633f, 0.887605786f},
-std::array<float,2>{0.327196211f, 0.273874819f},
-std::array<float,2>{0.435377806f, 0.824608624f},
-std::array<float,2>{0.726543665f, 0.420429975f},
-std::array<float,2>{0.893619716f, 0.709857941f},
-std::array<float,2>{0.128093138f, 0.0947428793f},
-std::array<float,2>{0.464817464f, 0.653607845f},
-std::array<float,2>{0.63641423f, 0.0396247916f},
-std::array<float,2>{0.953232288f, 0.785011232f},
-std::array<float,2>{0.224633738f, 0.4612149f},
-std::array<float,2>{0.00208825944f, 0.97647506f},
-std::array<float,2>{0.763158262f, 0.324764252f},
-std::array<float,2>{0.606038034f, 0.578427613f},
-std::array<float,2>{0.255351454f, 0.157135546f},
-std::array<float,2>{0.136461481f, 0.510491192f},
-std::array<float,2>{0.899871349f, 0.195410386f},
-std::array<float,2>{0.730914176f, 0.932047367f},
-std::array<float,2>{0.426329345f, 0.28476119f},
-std::array<float,2>{0.316213816f, 0.872771502f},
-std::array<float,2>{0.552904189f, 0.389615446f},
-std::array<float,2>{0.838661134f, 0.73867631f},
-std::array<float,2>{0.0630546883f, 0.0868351385f},
-std::array<float,2>{0.296107471f, 0.605754733f},
-std::array<float,2>{0.588310301f, 0.138590202f},
-std::array<float,2>{0.801991463f, 0.964129627f},
-std::array<float,2>{0.0602102391f, 0.363908201f},
-std::array<float,2>{0.21179682f, 0.759813368f},
-std::array<float,2>{0.991991222f, 0.469176292f},
-std::array<float,2>{0.656383932f, 0.664022803f},
-std::array<float,2>{0.47349301f, 0.00513685076f},
-std::array<float,2>{0.103824064f, 0.714599967f},
-std::array<float,2>{0.845710933f, 0.106101394f},
-std::array<float,2>{0.500197768f, 0.817056179f},
-std::array<float,2>{0.354326665f, 0.408789814f},
-std::array<float,2>{0.380326301f, 0.875085115f},
-std::array<float,2>{0.691550255f, 0.269607037f},
-std::array<float,2>{0.91641295f, 0.554205358f},
-std::array<float,2>{0.157074824f, 0.225063354f},
-std::array<float,2>{0.409263909f, 0.545530736f},
-std::array<float,2>{0.740813911f, 0.249765217f},
-std::array<float,2>{0.879276514f, 0.895334482f},
-std::array<float,2>{0.152278498f, 0.263860136f},
-std::array<float,2>{0.0861699358f, 0.83344239f},
-std::array<float,2>{0.813799977f, 0.432046682f},
-std::array<float,2>{0.536928356f, 0.699690938f},
-std::array<float,2>{0.338008434f, 0.117986664f},
-std::array<float,2>{0.248382539f, 0.67400682f},
-std::array<float,2>{0.938200533f, 0.0218902193f},
-std::array<float,2>{0.652052701f, 0.78021729f},
-std::array<float,2>{0.441386551f, 0.484521717f},
-std::array<float,2>{0.275354445f, 0.949585557f},
-std::array<float,2>{0.621666372f, 0.350877941f},
-std::array<float,2>{0.776194036f, 0.613456905f},
-std::array<float,2>{0.0293598734f, 0.15057984f},
-std::array<float,2>{0.366107672f, 0.720884025f},
-std::array<float,2>{0.52271539f, 0.0748801976f},
-std::array<float,2>{0.871498168f, 0.858906806f},
-std::array<float,2>{0.110470951f, 0.404673576f},
-std::array<float,2>{0.17465964f, 0.913654864f},
-std::array<float,2>{0.923256874f, 0.301170349f},
-std::array<float,2>{0.711452067f, 0.519440174f},
-std::array<float,2>{0.406170368f, 0.217155606f},
-std::array<float,2>{0.0446146093f, 0.575041533f},
-std::array<float,2>{0.781963766f, 0.181236491f},
-std::array<float,2>{0.576838076f, 0.999117076f},
-std::array<float,2>{0.307123542f, 0.34302634f},
-std::array<float,2>{0.49188745f, 0.804847121f},
-std::array<float,2>{0.68629384f, 0.443241477f},
-std::array<float,2>{0.983319581f, 0.637497663f},
-std::array<float,2>{0.201448277f, 0.0597724058f},
-std::array<float,2>{0.498903334f, 0.73530668f},
-std::array<float,2>{0.679669797f, 0.0912530273f},
-std::array<float,2>{0.976392686f, 0.869407952f},
-std::array<float,2>{0.188687384f, 0.38324967f},
-std::array<float,2>{0.0340671428f, 0.933918834f},
-std::array<float,2>{0.791418314f, 0.288890988f},
-std::array<float,2>{0.566267133f, 0.513992667f},
-std::array<float,2>{0.303493083f, 0.201842695f},
-std::array<float,2>{0.183053687f, 0.585346758f},
-std::array<float,2>{0.932928622f, 0.160552904f},
-std::array<float,2>{0.705582321f, 0.971268654f},
-std::array<float,2>{0.395261049f, 0.322110295f},
-std::array<float,2>{0.370708942f, 0.785375357f},
-std::array<float,2>{0.529416502f, 0.468464583f},
-std::array<float,2>{0.86713171f, 0.650636435f},
-std::array<float,2>{0.123691186f, 0.0449772179f},
-std::array<float,2>{0.266303033f, 0.548312843f},
-std::array<float,2>{0.616033256f, 0.21942389f},
-std::array<float,2>{0.770350993f, 0.880479038f},
-std::array<float,2>{0.0159145221f, 0.269299805f},
-std::array<float,2>{0.241394341f, 0.813567698f},
-std::array<float,2>{0.952259779f, 0.410898805f},
-std::array<float,2>{0.645659924f, 0.717601657f},
-std::array<float,2>{0.446344137f, 0.102349326f},
-std::array<float,2>{0.0811700448f, 0.658429086f},
-std::array<float,2>{0.827784359f, 0.00189050951f},
-std::array<float,2>{0.54024452f, 0.764770269f},
-std::array<float,2>{0.334896773f, 0.47316134f},
-std::array<float,2>{0.418439418f, 0.968220532f},
-std::array<float,2>{0.742901623f, 0.363197386f},
-std::array<float,2>{0.883845627f, 0.604860723f},
-std::array<float,2>{0.141490594f, 0.136713833f},
-std::array<float,2>{0.384968728f, 0.609847248f},
-std::array<float,2>{0.701819241f, 0.156177446f},
-std::array<float,2>{0.911796212f, 0.945870936f},
-std::array<float,2>{0.166543648f, 0.345947117f},
-std::array<float,2>{0.0997591764f, 0.776192069f},
-std::array<float,2>{0.857005477f, 0.491718948f},
-std::array<float,2>{0.514731526f, 0.677547872f},
-std::array<float,2>{0.351479381f, 0.0186478794f},
-std::array<float,2>{0.209548026f, 0.695969284f},
-std::array<float,2>{0.999418736f, 0.122369155f},
-std::array<float,2>{0.669454157f, 0.83176744f},
-std::array<float,2>{0.482454628f, 0.434801787f},
-std::array<float,2>{0.285716861f, 0.89287436f},
-std::array<float,2>{0.585237443f, 0.259582937f},
-std::array<float,2>{0.80832541f, 0.541061699f},
-std::array<float,2>{0.0475637391f, 0.24586077f},
-std::array<float,2>{0.322859704f, 0.636133194f},
-std::array<float,2>{0.556790769f, 0.0548854247f},
-std::array<float,2>{0.83138454f, 0.810492635f},
-std::array<float,2>{0.0723031685f, 0.43996948f},
-std::array<float,2>{0.131350324f, 0.993931234f},
-std::array<float,2>{0.895431876f, 0.33694008f},
-std::array<float,2>{0.720412493f, 0.574069977f},
-std::array<float,2>{0.432833374f, 0.186834082f},
-std::array<float,2>{0.00833062548f, 0.522665143f},
-std::array<float,2>{0.756325483f, 0.213792413f},
-std::array<float,2>{0.594759047f, 0.90972811f},
-std::array<float,2>{0.258157581f, 0.300250411f},
-std::array<float,2>{0.453709841f, 0.854331076f},
-std::array<float,2>{0.627396047f, 0.400130153f},
-std::array<float,2>{0.964026511f, 0.723094523f},
-std::array<float,2>{0.233752817f, 0.0709810108f},
-std::array<float,2>{0.425042361f, 0.683736622f},
-std::array<float,2>{0.730100036f, 0.0287074819f},
-std::array<float,2>{0.903928638f, 0.766863525f},
-std::array<float,2>{0.139959306f, 0.496969402f},
-std::array<float,2>{0.0693802461f, 0.938550889f},
-std::array<float,2>{0.840607166f, 0.353397667f},
-std::array<float,2>{0.549240232f, 0.622703969f},
-std::array<float,2>{0.317804188f, 0.148351833f},
-std::array<float,2>{0.221031442f, 0.532706499f},
-std::array<float,2>{0.960394979f, 0.23746784f},
-std::array<float,2>{0.638245583f, 0.905696034f},
-std::array<float,2>{0.464888334f, 0.255236149f},
-std::array<float,2>{0.250752807f, 0.838783205f},
-std::array<float,2>{0.60359472f, 0.427949786f},
-std::array<float,2>{0.760139406f, 0.692952037f},
-std::array<float,2>{0.00722753862f, 0.116833001f},
-std::array<float,2>{0.358937681f, 0.570218801f},
-std::array<float,2>{0.504513979f, 0.177693143f},
-std::array<float,2>{0.849693f, 0.989484727f},
-std::array<float,2>{0.106245615f, 0.333570331f},
-std::array<float,2>{0.1639442f, 0.802525043f},
-std::array<float,2>{0.921196818f, 0.446724474f},
-std::array<float,2>{0.688519478f, 0.632275224f},
-std::array<float,2>{0.375705868f, 0.0488044582f},
-std::array<float,2>{0.0547165126f, 0.734036922f},
-std::array<float,2>{0.800454378f, 0.0692283958f},
-std::array<float,2>{0.593635201f, 0.845914543f},
-std::array<float,2>{0.289216846f, 0.391402423f},
-std::array<float,2>{0.469162673f, 0.914506912f},
-std::array<float,2>{0.663476527f, 0.311371028f},
-std::array<float,2>{0.987513125f, 0.524480283f},
-std::array<float,2>{0.217240304f, 0.205945909f},
-std::array<float,2>{0.443762422f, 0.506948054f},
-std::array<float,2>{0.654233575f, 0.194609195f},
-std::array<float,2>{0.942842007f, 0.924411416f},
-std::array<float,2>{0.245233878f, 0.291734099f},
-std::array<float,2>{0.0261920001f, 0.864914775f},
-std::array<float,2>{0.781248212f, 0.381755769f},
-std::array<float,2>{0.620434344f, 0.742226183f},
-std::array<float,2>{0.277741164f, 0.0854005292f},
-std::array<float,2>{0.156222001f, 0.644607782f},
-std::array<float,2>{0.876132965f, 0.0355330482f},
-std::array<float,2>{0.738155961f, 0.793088198f},
-std::array<float,2>{0.412650466f, 0.454235554f},
-std::array<float,2>{0.343178928f, 0.981743157f},
-std::array<float,2>{0.534436941f, 0.318839639f},
-std::array<float,2>{0.818302095f, 0.59155786f},
-std::array<float,2>{0.0932370424f, 0.171094373f},
-std::array<float,2>{0.310175329f, 0.705993831f},
-std::array<float,2>{0.573793352f, 0.100616336f},
-std::array<float,2>{0.786248326f, 0.821405053f},
-std::array<float,2>{0.0425615422f, 0.41785115f},
-std::array<float,2>{0.196196392f, 0.885526478f},
-std::array<float,2>{0.977421939f, 0.27911213f},
-std::array<float,2>{0.682059705f, 0.560849726f},
-std::array<float,2>{0.486027837f, 0.231383547f},
-std::array<float,2>{0.113972127f, 0.601448655f},
-std::array<float,2>{0.868412137f, 0.125341475f},
-std::array<float,2>{0.516224623f, 0.958636224f},
-std::array<float,2>{0.359503359f, 0.370153219f},
-std::array<float,2>{0.401903659f, 0.752700448f},
-std::array<float,2>{0.717408061f, 0.476702929f},
-std::array<float,2>{0.926276207f, 0.670970261f},
-std::array<float,2>{0.17731972f, 0.014570957f},
-std::array<float,2>{0.390179098f, 0.748113394f},
-std::array<float,2>{0.695525646f, 0.0806153715f},
-std::array<float,2>{0.906323254f, 0.859784245f},
-std::array<float,2>{0.170429051f, 0.377314299f},
-std::array<float,2>{0.097625196f, 0.92689085f},
-std::array<float,2>{0.855021179f, 0.294197142f},
-std::array<float,2>{0.510710716f, 0.503184617f},
-std::array<float,2>{0.345876664f, 0.189888716f},
-std::array<float,2>{0.204879552f, 0.586599946f},
-std::array<float,2>{0.995038748f, 0.16562593f},
-std::array<float,2>{0.665514588f, 0.977199912f},
-std::array<float,2>{0.478798926f, 0.315395504f},
-std::array<float,2>{0.283818305f, 0.790586948f},
-std::array<float,2>{0.578878403f, 0.457911581f},
-std::array<float,2>{0.808807373f, 0.640796244f},
-std::array<float,2>{0.0527428947f, 0.0326026119f},
-std::array<float,2>{0.326486021f, 0.554839373f},
-std::array<float,2>{0.559958935f, 0.228117019f},
-std::array<float,2>{0.834519982f, 0.890078008f},
-std::array<float,2>{0.0767403245f, 0.276048422f},
-std::array<float,2>{0.127153039f, 0.827860713f},
-std::array<float,2>{0.893493354f, 0.41936636f},
-std::array<float,2>{0.725533485f, 0.708551466f},
-std::array<float,2>{0.434372097f, 0.0967371687f},
-std::array<float,2>{0.0140741309f, 0.664246082f},
-std::array<float,2>{0.753754318f, 0.00900865905f},
-std::array<float,2>{0.599680901f, 0.757095754f},
-std::array<float,2>{0.262715399f, 0.481324673f},
-std::array<float,2>{0.458726436f, 0.953817427f},
-std::array<float,2>{0.629043102f, 0.374456435f},
-std::array<float,2>{0.966680706f, 0.595894516f},
-std::array<float,2>{0.230081618f, 0.131910533f},
-std::array<float,2>{0.493575335f, 0.617446542f},
-std::array<float,2>{0.674967945f, 0.143200979f},
-std::array<float,2>{0.969657719f, 0.941884398f},
-std::array<float,2>{0.192268893f, 0.359081686f},
-std::array<float,2>{0.0379605368f, 0.772368431f},
-std::array<float,2>{0.79602915f, 0.49587214f},
-std::array<float,2>{0.567076266f, 0.679754734f},
-std::array<float,2>{0.298300773f, 0.0253494047f},
-std::array<float,2>{0.18454048f, 0.687599778f},
-std::array<float,2>{0.937020421f, 0.110601924f},
-std::array<float,2>{0.707608342f, 0.842675507f},
-std::array<float,2>{0.391912818f, 0.425399274f},
-std::array<float,2>{0.373365313f, 0.899053276f},
-std::array<float,2>{0.526860237f, 0.252755135f},
-std::array<float,2>{0.862057984f, 0.53697741f},
-std::array<float,2>{0.11953216f, 0.23994194f},
-std::array<float,2>{0.269632548f, 0.626846969f},
-std::array<float,2>{0.610002577f, 0.0526924022f},
-std::array<float,2>{0.766065419f, 0.799890935f},
-std::array<float,2>{0.0198344011f, 0.449595153f},
-std::array<float,2>{0.23570393f, 0.986535072f},
-std::array<float,2>{0.94753623f, 0.329701662f},
-std::array<float,2>{0.644420922f, 0.564749897f},
-std::array<float,2>{0.452556163f, 0.174288213f},
-std::array<float,2>{0.0845208243f, 0.530897439f},
-std::array<float,2>{0.821608305f, 0.209520563f},
-std::array<float,2>{0.545328915f, 0.920943916f},
-std::array<float,2>{0.32993722f, 0.306663275f},
-std::array<float,2>{0.41519922f, 0.848695576f},
-std::array<float,2>{0.747805595f, 0.397031367f},
-std::array<float,2>{0.8867414f, 0.727414072f},
-std::array<float,2>{0.147535071f, 0.0629336834f},
-std::array<float,2>{0.439461738f, 0.673146367f},
-std::array<float,2>{0.651100874f, 0.019695919f},
-std::array<float,2>{0.939194918f, 0.778313518f},
-std::array<float,2>{0.24938716f, 0.487491041f},
-std::array<float,2>{0.0310283452f, 0.952274442f},
-std::array<float,2>{0.77711165f, 0.347687721f},
-std::array<float,2>{0.62215209f, 0.616440713f},
-std::array<float,2>{0.27394852f, 0.148452699f},
-std::array<float,2>{0.150720641f, 0.544666648f},
-std::array<float,2>{0.880735159f, 0.247122973f},
-std::array<float,2>{0.741739333f, 0.897439539f},
-std::array<float,2>{0.408806235f, 0.262064487f},
-std::array<float,2>{0.339665264f, 0.834700763f},
-std::array<float,2>{0.535971701f, 0.431503654f},
-std::array<float,2>{0.813006639f, 0.701372087f},
-std::array<float,2>{0.0876112133f, 0.119394332f},
-std::array<float,2>{0.307636559f, 0.576512814f},
-std::array<float,2>{0.577477038f, 0.182686195f},
-std::array<float,2>{0.783091784f, 0.997979283f},
-std::array<float,2>{0.0438901298f, 0.339865446f},
-std::array<float,2>{0.202208579f, 0.807879865f},
-std::array<float,2>{0.984011769f, 0.443967372f},
-std::array<float,2>{0.687301099f, 0.640298128f},
-std::array<float,2>{0.490813732f, 0.061414741f},
-std::array<float,2>{0.110117182f, 0.7197299f},
-std::array<float,2>{0.87242949f, 0.07684578f},
-std::array<float,2>{0.521611631f, 0.856651187f},
-std::array<float,2>{0.36701563f, 0.402963519f},
-std::array<float,2>{0.405132085f, 0.911012411f},
-std::array<float,2>{0.712423086f, 0.303248882f},
-std::array<float,2>{0.922401845f, 0.516182721f},
-std::array<float,2>{0.175190419f, 0.214949325f},
-std::array<float,2>{0.427452862f, 0.509620547f},
-std::array<float,2>{0.731480598f, 0.198103368f},
-std::array<float,2>{0.898899615f, 0.930977345f},
-std::array<float,2>{0.135559946f, 0.281726122f},
-std::array<float,2>{0.0643578693f, 0.874729574f},
-std::array<float,2>{0.839067638f, 0.387810469f},
-std::array<float,2>{0.554200947f, 0.740645766f},
-std::array<float,2>{0.314940214f, 0.0885302126f},
-std::array<float,2>{0.225692004f, 0.656229734f},
-std::array<float,2>{0.954428732f, 0.041430518f},
-std::array<float,2>{0.635128081f, 0.782282293f},
-std::array<float,2>{0.463458359f, 0.464162499f},
-std::array<float,2>{0.254181921f, 0.973781765f},
-std::array<float,2>{0.606642962f, 0.326409161f},
-std::array<float,2>{0.7625103f, 0.581087112f},
-std::array<float,2>{0.00332055963f, 0.159813523f},
-std::array<float,2>{0.354573637f, 0.711530089f},
-std::array<float,2>{0.501560152f, 0.108513929f},
-std::array<float,2>{0.847364843f, 0.818424225f},
-std::array<float,2>{0.105253391f, 0.40815258f},
-std::array<float,2>{0.157489911f, 0.877812743f},
-std::array<float,2>{0.917454362f, 0.271673173f},
-std::array<float,2>{0.692906082f, 0.551399231f},
-std::array<float,2>{0.379485309f, 0.223387763f},
-std::array<float,2>{0.0587542914f, 0.607916296f},
-std::array<float,2>{0.800904095f, 0.139220223f},
-std::array<float,2>{0.589773655f, 0.962267339f},
-std::array<float,2>{0.295765936f, 0.365562975f},
-std::array<float,2>{0.474300027f, 0.758759499f},
-std::array<float,2>{0.658168733f, 0.471735626f},
-std::array<float,2>{0.99060899f, 0.661173701f},
-std::array<float,2>{0.212486029f, 0.00712038577f},
-std::array<float,2>{0.484091431f, 0.698071718f},
-std::array<float,2>{0.668761551f, 0.124941409f},
-std::array<float,2>{0.998060524f, 0.829227388f},
-std::array<float,2>{0.210842237f, 0.436953813f},
-std::array<float,2>{0.0486947633f, 0.891250372f},
-std::array<float,2>{0.80696547f, 0.261594087f},
-std::array<float,2>{0.58442992f, 0.540795088f},
-std::array<float,2>{0.286204726f, 0.242818043f},
-std::array<float,2>{0.167792484f, 0.611785471f},
-std::array<float,2>{0.910622001f, 0.154233932f},
-std::array<float,2>{0.702832818f, 0.949006557f},
-std::array<float,2>{0.386589348f, 0.344003171f},
-std::array<float,2>{0.350281894f, 0.773511648f},
-std::array<float,2>{0.513712645f, 0.489513427f},
-std::array<float,2>{0.85583806f, 0.67817378f},
-std::array<float,2>{0.100855269f, 0.0173908267f},
-std::array<float,2>{0.259506881f, 0.521164477f},
-std::array<float,2>{0.594196677f, 0.21160987f},
-std::array<float,2>{0.757215559f, 0.906542063f},
-std::array<float,2>{0.00885861181f, 0.298010707f},
-std::array<float,2>{0.233183593f, 0.853481412f},
-std::array<float,2>{0.963059545f, 0.401819736f},
-std::array<float,2>{0.628647566f, 0.724863768f},
-std::array<float,2>{0.454929322f, 0.0730684176f},
-std::array<float,2>{0.0736353844f, 0.634055912f},
-std::array<float,2>{0.830896437f, 0.0584660172f},
-std::array<float,2>{0.558428943f, 0.812337756f},
-std::array<float,2>{0.324201286f, 0.437694818f},
-std::array<float,2>{0.43223843f, 0.995184243f},
-std::array<float,2>{0.719010234f, 0.339360833f},
-std::array<float,2>{0.896143854f, 0.57181108f},
-std::array<float,2>{0.132552654f, 0.183604375f},
-std::array<float,2>{0.396287799f, 0.583326578f},
-std::array<float,2>{0.706532478f, 0.162448704f},
-std::array<float,2>{0.932189167f, 0.969051659f},
-std::array<float,2>{0.181883559f, 0.323476791f},
-std::array<float,2>{0.124807358f, 0.788454354f},
-std::array<float,2>{0.865458667f, 0.465390414f},
-std::array<float,2>{0.530955613f, 0.650338888f},
-std::array<float,2>{0.369444221f, 0.0432464071f},
-std::array<float,2>{0.187738657f, 0.736967862f},
-std::array<float,2>{0.975547373f, 0.0936829746f},
-std::array<float,2>{0.67779994f, 0.869069576f},
-std::array<float,2>{0.499425411f, 0.385262638f},
-std::array<float,2>{0.303896904f, 0.936532438f},
-std::array<float,2>{0.564576507f, 0.286148995f},
-std::array<float,2>{0.792794883f, 0.51221329f},
-std::array<float,2>{0.0346019082f, 0.19963938f},
-std::array<float,2>{0.335183948f, 0.656641662f},
-std::array<float,2>{0.539821506f, 0.00364900124f},
-std::array<float,2>{0.826626003f, 0.763190746f},
-std::array<float,2>{0.0805587396f, 0.474866778f},
-std::array<float,2>{0.141817659f, 0.966483176f},
-std::array<float,2>{0.883140087f, 0.360652834f},
-std::array<float,2>{0.743384778f, 0.602515757f},
-std::array<float,2>{0.4193165f, 0.132884949f},
-std::array<float,2>{0.0172012057f, 0.549643695f},
-std::array<float,2>{0.770947576f, 0.222431257f},
-std::array<float,2>{0.616755128f, 0.881372571f},
-std::array<float,2>{0.266925484f, 0.266592681f},
-std::array<float,2>{0.445729166f, 0.815695286f},
-std::array<float,2>{0.645369351f, 0.413947076f},
-std::array<float,2>{0.951505363f, 0.716412425f},
-std::array<float,2>{0.241179571f, 0.104441345f},
-std::array<float,2>{0.413671941f, 0.647959471f},
-std::array<float,2>{0.736425221f, 0.0374716446f},
-std::array<float,2>{0.875682771f, 0.795202434f},
-std::array<float,2>{0.15482831f, 0.456712753f},
-std::array<float,2>{0.0925752297f, 0.982916713f},
-std::array<float,2>{0.816441298f, 0.316941708f},
-std::array<float,2>{0.533217967f, 0.59370929f},
-std::array<float,2>{0.341817826f, 0.167978555f},
-std::array<float,2>{0.244736716f, 0.504708409f},
-std::array<float,2>{0.941856802f, 0.192308217f},
-std::array<float,2>{0.652403593f, 0.922853827f},
-std::array<float,2>{0.445217401f, 0.289713651f},
-std::array<float,2>{0.278666198f, 0.86582768f},
-std::array<float,2>{0.619340956f, 0.379469067f},
-std::array<float,2>{0.779946387f, 0.74526f},
-std::array<float,2>{0.0267566461f, 0.0830811933f},
-std::array<float,2>{0.360646039f, 0.598647237f},
-std::array<float,2>{0.516622722f, 0.127639294f},
-std::array<float,2>{0.867323875f, 0.959241807f},
-std::array<float,2>{0.114648603f, 0.368034512f},
-std::array<float,2>{0.175986245f, 0.75159514f},
-std::array<float,2>{0.927727938f, 0.4788993f},
-std::array<float,2>{0.718625188f, 0.669457197f},
-std::array<float,2>{0.401306242f, 0.0127814617f},
-std::array<float,2>{0.0416863821f, 0.704195559f},
-std::array<float,2>{0.785257757f, 0.0981710404f},
-std::array<float,2>{0.57275784f, 0.823859036f},
-std::array<float,2>{0.309093505f, 0.414607346f},
-std::array<float,2>{0.48453933f, 0.884262562f},
-std::array<float,2>{0.682770431f, 0.279454559f},
-std::array<float,2>{0.978232145f, 0.559848011f},
-std::array<float,2>{0.196532354f, 0.233854041f},
-std::array<float,2>{0.466144055f, 0.533986866f},
-std::array<float,2>{0.637178779f, 0.235969007f},
-std::array<float,2>{0.959247291f, 0.904165268f},
-std::array<float,2>{0.222645283f, 0.257711649f},
-std::array<float,2>{0.00661163358f, 0.836231887f},
-std::array<float,2>{0.761167109f, 0.426452339f},
-std::array<float,2>{0.604994059f, 0.694435596f},
-std::array<float,2>{0.251529962f, 0.113875687f},
-std::array<float,2>{0.139639363f, 0.687167406f},
-std::array<float,2>{0.902419031f, 0.0305575822f},
-std::array<float,2>{0.728858173f, 0.768294871f},
-std::array<float,2>{0.424332827f, 0.499860615f},
-std::array<float,2>{0.316990644f, 0.941027403f},
-std::array<float,2>{0.550533593f, 0.354310036f},
-std::array<float,2>{0.841329038f, 0.623161852f},
-std::array<float,2>{0.0687973201f, 0.14585188f},
-std::array<float,2>{0.29029566f, 0.732363582f},
-std::array<float,2>{0.592512429f, 0.0682042688f},
-std::array<float,2>{0.799427807f, 0.844433308f},
-std::array<float,2>{0.0559970662f, 0.393009603f},
-std::array<float,2>{0.218183488f, 0.916341424f},
-std::array<float,2>{0.986416519f, 0.310375154f},
-std::array<float,2>{0.662880063f, 0.526658833f},
-std::array<float,2>{0.46974501f, 0.204213902f},
-std::array<float,2>{0.106831402f, 0.567227602f},
-std::array<float,2>{0.850596488f, 0.178373128f},
-std::array<float,2>{0.505833745f, 0.991276264f},
-std::array<float,2>{0.35766086f, 0.334880948f},
-std::array<float,2>{0.376307249f, 0.804318905f},
-std::array<float,2>{0.688155353f, 0.448482931f},
-std::array<float,2>{0.92081815f, 0.62922138f},
-std::array<float,2>{0.162984163f, 0.0499775745f},
-std::array<float,2>{0.435640991f, 0.7101565f},
-std::array<float,2>{0.723573089f, 0.0942541212f},
-std::array<float,2>{0.890723825f, 0.825724661f},
-std::array<float,2>{0.126856938f, 0.421725094f},
-std::array<float,2>{0.0752090216f, 0.888236046f},
-std::array<float,2>{0.833038926f, 0.275010645f},
-std::array<float,2>{0.561030269f, 0.557745516f},
-std::array<float,2>{0.326046914f, 0.230447128f},
-std::array<float,2>{0.228278428f, 0.594042063f},
-std::array<float,2>{0.967047274f, 0.130820855f},
-std::array<float,2>{0.632770419f, 0.956965148f},
-std::array<float,2>{0.459945619f, 0.372708946f},
-std::array<float,2>{0.265498668f, 0.754762113f},
-std::array<float,2>{0.599313021f, 0.483162522f},
-std::array<float,2>{0.751483619f, 0.667394996f},
-std::array<float,2>{0.0124511346f, 0.0103165926f},
-std::array<float,2>{0.344147176f, 0.501303613f},
-std::array<float,2>{0.5081743f, 0.189059287f},
-std::array<float,2>{0.851958811f, 0.92866528f},
-std::array<float,2>{0.0937559903f, 0.295313776f},
-std::array<float,2>{0.168132409f, 0.862307072f},
-std::array<float,2>{0.908607125f, 0.375463456f},
-std::array<float,2>{0.697383642f, 0.747338355f},
-std::array<float,2>{0.387961656f, 0.0793735161f},
-std::array<float,2>{0.0517429709f, 0.642852128f},
-std::array<float,2>{0.811285973f, 0.0338767134f},
-std::array<float,2>{0.580794454f, 0.79129529f},
-std::array<float,2>{0.28298825f, 0.460578442f},
-std::array<float,2>{0.477636307f, 0.979142487f},
-std::array<float,2>{0.666384518f, 0.314322531f},
-std::array<float,2>{0.994045079f, 0.589708567f},
-std::array<float,2>{0.206945375f, 0.16715917f},
-std::array<float,2>{0.450562984f, 0.563503444f},
-std::array<float,2>{0.641361654f, 0.172152176f},
-std::array<float,2>{0.946002722f, 0.985980213f},
-std::array<float,2>{0.237031475f, 0.33189401f},
-std::array<float,2>{0.0220120251f, 0.797335625f},
-std::array<float,2>{0.768335164f, 0.452362001f},
-std::array<float,2>{0.61285758f, 0.627689481f},
-std::array<float,2>{0.271850467f, 0.0543234386f},
-std::array<float,2>{0.146264076f, 0.729958236f},
-std::array<float,2>{0.888734281f, 0.0653238297f},
-std::array<float,2>{0.748271883f, 0.851030827f},
-std::array<float,2>{0.417462319f, 0.39639014f},
-std::array<float,2>{0.331406295f, 0.919098914f},
-std::array<float,2>{0.543187976f, 0.305019826f},
-std::array<float,2>{0.82349509f, 0.528353214f},
-std::array<float,2>{0.0821266845f, 0.20769456f},
-std::array<float,2>{0.299001873f, 0.682245076f},
-std::array<float,2>{0.568678796f, 0.0261038542f},
-std::array<float,2>{0.794840574f, 0.769577801f},
-std::array<float,2>{0.0355527513f, 0.492510438f},
-std::array<float,2>{0.194401681f, 0.9449417f},
-std::array<float,2>{0.970993042f, 0.356001407f},
-std::array<float,2>{0.672471762f, 0.619237185f},
-std::array<float,2>{0.495164007f, 0.141359523f},
-std::array<float,2>{0.117336527f, 0.537936389f},
-std::array<float,2>{0.860844553f, 0.240706608f},
-std::array<float,2>{0.524287879f, 0.900856614f},
-std::array<float,2>{0.372292161f, 0.250502348f},
-std::array<float,2>{0.392702788f, 0.839959204f},
-std::array<float,2>{0.710492551f, 0.423681349f},
-std::array<float,2>{0.934062898f, 0.690076768f},
-std::array<float,2>{0.186793268f, 0.113093339f},
-std::array<float,2>{0.488749236f, 0.638029516f},
-std::array<float,2>{0.684711993f, 0.0589886382f},
-std::array<float,2>{0.980897844f, 0.805675209f},
-std::array<float,2>{0.200745851f, 0.442017108f},
-std::array<float,2>{0.0465204008f, 0.998614907f},
-std::array<float,2>{0.783738971f, 0.342162013f},
-std::array<float,2>{0.574675381f, 0.575872719f},
-std::array<float,2>{0.304908365f, 0.180190563f},
-std::array<float,2>{0.172908813f, 0.518164456f},
-std::array<float,2>{0.925088227f, 0.218679965f},
-std::array<float,2>{0.713001728f, 0.912160277f},
-std::array<float,2>{0.403521925f, 0.302691281f},
-std::array<float,2>{0.363369763f, 0.858004808f},
-std::array<float,2>{0.520706594f, 0.406127989f},
-std::array<float,2>{0.874988854f, 0.722631276f},
-std::array<float,2>{0.111643523f, 0.0753901899f},
-std::array<float,2>{0.277292341f, 0.614824653f},
-std::array<float,2>{0.623529494f, 0.152074531f},
-std::array<float,2>{0.774492025f, 0.95107305f},
-std::array<float,2>{0.0281994641f, 0.349832833f},
-std::array<float,2>{0.246259645f, 0.780695856f},
-std::array<float,2>{0.941403508f, 0.48549071f},
-std::array<float,2>{0.648552537f, 0.675342023f},
-std::array<float,2>{0.439249873f, 0.0225104764f},
-std::array<float,2>{0.0884471089f, 0.701088607f},
-std::array<float,2>{0.81576997f, 0.119093768f},
-std::array<float,2>{0.537925899f, 0.832935512f},
-std::array<float,2>{0.335982829f, 0.432855934f},
-std::array<float,2>{0.407974243f, 0.896067739f},
-std::array<float,2>{0.738622606f, 0.264729619f},
-std::array<float,2>{0.882613659f, 0.546096146f},
-std::array<float,2>{0.150030643f, 0.248136312f},
-std::array<float,2>{0.382697225f, 0.553124845f},
-std::array<float,2>{0.694272995f, 0.225607112f},
-std::array<float,2>{0.914096177f, 0.876623571f},
-std::array<float,2>{0.15861845f, 0.270999044f},
-std::array<float,2>{0.102616206f, 0.817825794f},
-std::array<float,2>{0.843925297f, 0.410034478f},
-std::array<float,2>{0.50230217f, 0.713311195f},
-std::array<float,2>{0.352925718f, 0.107315294f},
-std::array<float,2>{0.214126334f, 0.662328184f},
-std::array<float,2>{0.989187062f, 0.00440231757f},
-std::array<float,2>{0.659887314f, 0.761334538f},
-std::array<float,2>{0.475330234f, 0.469814718f},
-std::array<float,2>{0.29386124f, 0.963268161f},
-std::array<float,2>{0.587858558f, 0.364598274f},
-std::array<float,2>{0.803505301f, 0.607312441f},
-std::array<float,2>{0.0615165606f, 0.13761057f},
-std::array<float,2>{0.313981444f, 0.740059555f},
-std::array<float,2>{0.552536249f, 0.0873424187f},
-std::array<float,2>{0.837836623f, 0.871566057f},
-std::array<float,2>{0.0663117543f, 0.390220612f},
-std::array<float,2>{0.134751126f, 0.933207989f},
-std::array<float,2>{0.901339293f, 0.284151882f},
-std::array<float,2>{0.733522296f, 0.511254072f},
-std::array<float,2>{0.428784519f, 0.197124243f},
-std::array<float,2>{0.000861570705f, 0.579791963f},
-std::array<float,2>{0.76418364f, 0.158095822f},
-std::array<float,2>{0.608341157f, 0.975018859f},
-std::array<float,2>{0.257670939f, 0.325471371f},
-std::array<float,2>{0.462793529f, 0.78402245f},
-std::array<float,2>{0.632850945f, 0.462409854f},
-std::array<float,2>{0.956656575f, 0.652588785f},
-std::array<float,2>{0.222835034f, 0.0402046666f},
-std::array<float,2>{0.455988586f, 0.724088669f},
-std::array<float,2>{0.626190662f, 0.071373485f},
-std::array<float,2>{0.962616682f, 0.855313063f},
-std::array<float,2>{0.230818793f, 0.399333715f},
-std::array<float,2>{0.0101057356f, 0.908588827f},
-std::array<float,2>{0.754146218f, 0.299693048f},
-std::array<float,2>{0.595713079f, 0.521823704f},
-std::array<float,2>{0.261328936f, 0.214399323f},
-std::array<float,2>{0.129715711f, 0.572335005f},
-std::array<float,2>{0.897191226f, 0.186177254f},
-std::array<float,2>{0.721734762f, 0.992885411f},
-std::array<float,2>{0.430356652f, 0.336284935f},
-std::array<float,2>{0.321590304f, 0.808718264f},
-std::array<float,2>{0.555193126f, 0.441212416f},
-std::array<float,2>{0.829974473f, 0.635226727f},
-std::array<float,2>{0.0703437775f, 0.0561715104f},
-std::array<float,2>{0.287397087f, 0.542182446f},
-std::array<float,2>{0.582282364f, 0.244956255f},
-std::array<float,2>{0.805896163f, 0.893684685f},
-std::array<float,2>{0.048993852f, 0.257873774f},
-std::array<float,2>{0.207103312f, 0.830864131f},
-std::array<float,2>{0.996686876f, 0.433730483f},
-std::array<float,2>{0.670093596f, 0.696688294f},
-std::array<float,2>{0.482078493f, 0.122016996f},
-std::array<float,2>{0.098274909f, 0.676608801f},
-std::array<float,2>{0.858979523f, 0.0176335983f},
-std::array<float,2>{0.512766123f, 0.776534438f},
-std::array<float,2>{0.348623723f, 0.4905352f},
-std::array<float,2>{0.383796722f, 0.947099686f},
-std::array<float,2>{0.701051295f, 0.346781492f},
-std::array<float,2>{0.912517667f, 0.610946238f},
-std::array<float,2>{0.164790556f, 0.155154824f},
-std::array<float,2>{0.420727581f, 0.604348242f},
-std::array<float,2>{0.745962203f, 0.135650769f},
-std::array<float,2>{0.885128796f, 0.967286885f},
-std::array<float,2>{0.142968461f, 0.362304479f},
-std::array<float,2>{0.0786154419f, 0.764114618f},
-std::array<float,2>{0.824405968f, 0.473737776f},
-std::array<float,2>{0.542614102f, 0.659506917f},
-std::array<float,2>{0.332342476f, 0.000119024451f},
-std::array<float,2>{0.238391683f, 0.717803597f},
-std::array<float,2>{0.951039612f, 0.103002094f},
-std::array<float,2>{0.647456348f, 0.813014746f},
-std::array<float,2>{0.447337329f, 0.411773711f},
-std::array<float,2>{0.267862707f, 0.879130125f},
-std::array<float,2>{0.613801003f, 0.268070042f},
-std::array<float,2>{0.772550702f, 0.547060847f},
-std::array<float,2>{0.0188259427f, 0.220328838f},
-std::array<float,2>{0.367632061f, 0.651884258f},
-std::array<float,2>{0.52787739f, 0.0461482555f},
-std::array<float,2>{0.864369452f, 0.786381245f},
-std::array<float,2>{0.122167297f, 0.467162788f},
-std::array<float,2>{0.180679113f, 0.972316802f},
-std::array<float,2>{0.930458724f, 0.321264952f},
-std::array<float,2>{0.703650951f, 0.58467263f},
-std::array<float,2>{0.398164272f, 0.161927924f},
-std::array<float,2>{0.0331263952f, 0.515150189f},
-std::array<float,2>{0.789189935f, 0.202313244f},
-std::array<float,2>{0.563082635f, 0.935094118f},
-std::array<float,2>{0.301663071f, 0.288009971f},
-std::array<float,2>{0.497990876f, 0.870360434f},
-std::array<float,2>{0.67682755f, 0.384425282f},
-std::array<float,2>{0.972856343f, 0.735358119f},
-std::array<float,2>{0.189878523f, 0.0899151191f},
-std::array<float,2>{0.399204731f, 0.67049408f},
-std::array<float,2>{0.715878546f, 0.0155119002f},
-std::array<float,2>{0.929457486f, 0.753538489f},
-std::array<float,2>{0.178537562f, 0.477790803f},
-std::array<float,2>{0.116330899f, 0.957579076f},
-std::array<float,2>{0.870278597f, 0.369746774f},
-std::array<float,2>{0.517589509f, 0.599919975f},
-std::array<float,2>{0.361854374f, 0.126906738f},
-std::array<float,2>{0.198590785f, 0.561673343f},
-std::array<float,2>{0.980251133f, 0.231722638f},
-std::array<float,2>{0.680712879f, 0.886273623f},
-std::array<float,2>{0.487774372f, 0.277690649f},
-std::array<float,2>{0.31245169f, 0.820560992f},
-std::array<float,2>{0.572182298f, 0.416823119f},
-std::array<float,2>{0.788221836f, 0.706598043f},
-std::array<float,2>{0.0404493175f, 0.100258142f},
-std::array<float,2>{0.341626853f, 0.589942634f},
-std::array<float,2>{0.532648921f, 0.1704368f},
-std::array<float,2>{0.820229053f, 0.981246591f},
-std::array<float,2>{0.0910280049f, 0.319723606f},
-std::array<float,2>{0.152854532f, 0.794727981f},
-std::array<float,2>{0.877204776f, 0.453573078f},
-std::array<float,2>{0.734612226f, 0.646288872f},
-std::array<float,2>{0.410884947f, 0.0367568359f},
-std::array<float,2>{0.02445863f, 0.743528903f},
-std::array<float,2>{0.778159738f, 0.0845549926f},
-std::array<float,2>{0.617559075f, 0.863383532f},
-std::array<float,2>{0.280626774f, 0.38247329f},
-std::array<float,2>{0.44313097f, 0.924826562f},
-std::array<float,2>{0.655220449f, 0.292471856f},
-std::array<float,2>{0.944667578f, 0.506597519f},
-std::array<float,2>{0.242861331f, 0.193743438f},
-std::array<float,2>{0.472006917f, 0.524024606f},
-std::array<float,2>{0.661998153f, 0.206647098f},
-std::array<float,2>{0.985563397f, 0.915996671f},
-std::array<float,2>{0.215149507f, 0.311558455f},
-std::array<float,2>{0.0573146492f, 0.846718192f},
-std::array<float,2>{0.796876192f, 0.392474234f},
-std::array<float,2>{0.591318786f, 0.733287752f},
-std::array<float,2>{0.292907357f, 0.0697348937f},
-std::array<float,2>{0.161469534f, 0.631072998f},
-std::array<float,2>{0.918804765f, 0.0477643758f},
-std::array<float,2>{0.689540744f, 0.801436424f},
-std::array<float,2>{0.377817452f, 0.4453789f},
-std::array<float,2>{0.356737047f, 0.988640368f},
-std::array<float,2>{0.506810725f, 0.332945704f},
-std::array<float,2>{0.847898185f, 0.569218516f},
-std::array<float,2>{0.107946396f, 0.176005498f},
-std::array<float,2>{0.252692163f, 0.691573679f},
-std::array<float,2>{0.602523863f, 0.115318067f},
-std::array<float,2>{0.759368539f, 0.838891983f},
-std::array<float,2>{0.00540398667f, 0.429473579f},
-std::array<float,2>{0.219304502f, 0.905212522f},
-std::array<float,2>{0.957032442f, 0.254532337f},
-std::array<float,2>{0.638953447f, 0.532187343f},
-std::array<float,2>{0.467535555f, 0.236943752f},
-std::array<float,2>{0.0678527802f, 0.62169379f},
-std::array<float,2>{0.842603326f, 0.146876246f},
-std::array<float,2>{0.547522962f, 0.937555492f},
-std::array<float,2>{0.319622725f, 0.352329195f},
-std::array<float,2>{0.423175275f, 0.765717626f},
-std::array<float,2>{0.727291286f, 0.497448474f},
-std::array<float,2>{0.905079246f, 0.685131133f},
-std::array<float,2>{0.138119236f, 0.0274747945f}}
\ No newline at end of file
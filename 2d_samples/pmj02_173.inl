@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.493426502f, 0.2479081f},
-std::array<float,2>{0.768359959f, 0.94244802f},
-std::array<float,2>{0.196113259f, 0.613983512f},
-std::array<float,2>{0.630162001f, 0.290644169f},
-std::array<float,2>{0.0184675548f, 0.455218583f},
-std::array<float,2>{0.623960137f, 0.708564222f},
-std::array<float,2>{0.312107682f, 0.871504068f},
-std::array<float,2>{0.997346461f, 0.02462654f},
-std::array<float,2>{0.362527847f, 0.340712726f},
-std::array<float,2>{0.911377609f, 0.508743286f},
-std::array<float,2>{0.0829105154f, 0.898715675f},
-std::array<float,2>{0.540180624f, 0.167211309f},
-std::array<float,2>{0.142490894f, 0.0886797085f},
-std::array<float,2>{0.725791633f, 0.806031108f},
-std::array<float,2>{0.385077089f, 0.681354403f},
-std::array<float,2>{0.845353961f, 0.430232167f},
-std::array<float,2>{0.271922886f, 0.0541755557f},
-std::array<float,2>{0.955531299f, 0.817493379f},
-std::array<float,2>{0.059977483f, 0.731217206f},
-std::array<float,2>{0.582323194f, 0.484141409f},
-std::array<float,2>{0.248171017f, 0.261324912f},
-std::array<float,2>{0.686676085f, 0.585422099f},
-std::array<float,2>{0.455769867f, 0.977656722f},
-std::array<float,2>{0.79136622f, 0.215587452f},
-std::array<float,2>{0.437235892f, 0.37875551f},
-std::array<float,2>{0.840479076f, 0.629330873f},
-std::array<float,2>{0.176628783f, 0.75668031f},
-std::array<float,2>{0.706273913f, 0.0946599543f},
-std::array<float,2>{0.103939965f, 0.12685962f},
-std::array<float,2>{0.501084745f, 0.937378645f},
-std::array<float,2>{0.323817164f, 0.549298644f},
-std::array<float,2>{0.896743357f, 0.363605917f},
-std::array<float,2>{0.333211988f, 0.186344966f},
-std::array<float,2>{0.883575559f, 0.877719998f},
-std::array<float,2>{0.112661175f, 0.517030239f},
-std::array<float,2>{0.517555118f, 0.314442694f},
-std::array<float,2>{0.156703576f, 0.416565597f},
-std::array<float,2>{0.699387074f, 0.666484654f},
-std::array<float,2>{0.417619616f, 0.785604715f},
-std::array<float,2>{0.81264472f, 0.0683549568f},
-std::array<float,2>{0.445818931f, 0.301363021f},
-std::array<float,2>{0.806201339f, 0.605460048f},
-std::array<float,2>{0.233051211f, 0.958561122f},
-std::array<float,2>{0.67176491f, 0.224351853f},
-std::array<float,2>{0.0323052406f, 0.00252188696f},
-std::array<float,2>{0.574360073f, 0.851184368f},
-std::array<float,2>{0.257479876f, 0.701065898f},
-std::array<float,2>{0.951417685f, 0.448257893f},
-std::array<float,2>{0.391263098f, 0.115684696f},
-std::array<float,2>{0.867828071f, 0.77006191f},
-std::array<float,2>{0.133646309f, 0.646768093f},
-std::array<float,2>{0.734398901f, 0.393920928f},
-std::array<float,2>{0.0761726126f, 0.352158576f},
-std::array<float,2>{0.558641613f, 0.532995105f},
-std::array<float,2>{0.358228326f, 0.907693148f},
-std::array<float,2>{0.928234458f, 0.146575153f},
-std::array<float,2>{0.283785641f, 0.494847953f},
-std::array<float,2>{0.981946051f, 0.738544941f},
-std::array<float,2>{0.0127769951f, 0.837276757f},
-std::array<float,2>{0.596136332f, 0.0357520953f},
-std::array<float,2>{0.214308411f, 0.19498007f},
-std::array<float,2>{0.653815806f, 0.998990297f},
-std::array<float,2>{0.470453173f, 0.564005077f},
-std::array<float,2>{0.75255245f, 0.281059116f},
-std::array<float,2>{0.409302324f, 0.151924342f},
-std::array<float,2>{0.820993602f, 0.918788671f},
-std::array<float,2>{0.165237993f, 0.543212831f},
-std::array<float,2>{0.69315654f, 0.347860396f},
-std::array<float,2>{0.124620229f, 0.401748449f},
-std::array<float,2>{0.52527988f, 0.649336457f},
-std::array<float,2>{0.337212145f, 0.775227249f},
-std::array<float,2>{0.875598609f, 0.123397171f},
-std::array<float,2>{0.264480829f, 0.273353428f},
-std::array<float,2>{0.94051826f, 0.573277473f},
-std::array<float,2>{0.0413478278f, 0.986875951f},
-std::array<float,2>{0.564759731f, 0.195522621f},
-std::array<float,2>{0.224377066f, 0.0436887816f},
-std::array<float,2>{0.661268294f, 0.828934669f},
-std::array<float,2>{0.43980211f, 0.746187389f},
-std::array<float,2>{0.798371494f, 0.490917504f},
-std::array<float,2>{0.346509904f, 0.0779423639f},
-std::array<float,2>{0.931200683f, 0.794304669f},
-std::array<float,2>{0.0680026859f, 0.662806094f},
-std::array<float,2>{0.549591243f, 0.40898034f},
-std::array<float,2>{0.127080634f, 0.321489811f},
-std::array<float,2>{0.747469604f, 0.524945617f},
-std::array<float,2>{0.400536239f, 0.884492874f},
-std::array<float,2>{0.866029739f, 0.174685314f},
-std::array<float,2>{0.483407378f, 0.438533336f},
-std::array<float,2>{0.761411428f, 0.688895345f},
-std::array<float,2>{0.207275912f, 0.853746474f},
-std::array<float,2>{0.641025245f, 0.011403488f},
-std::array<float,2>{0.00274167955f, 0.229653418f},
-std::array<float,2>{0.605927765f, 0.967258036f},
-std::array<float,2>{0.290194631f, 0.594736695f},
-std::array<float,2>{0.969800591f, 0.312193245f},
-std::array<float,2>{0.302950919f, 0.210197255f},
-std::array<float,2>{0.986703873f, 0.971747994f},
-std::array<float,2>{0.0263347756f, 0.591856897f},
-std::array<float,2>{0.616650283f, 0.256678134f},
-std::array<float,2>{0.194476277f, 0.475533783f},
-std::array<float,2>{0.637291849f, 0.725809395f},
-std::array<float,2>{0.488760591f, 0.822466612f},
-std::array<float,2>{0.775547624f, 0.0623417571f},
-std::array<float,2>{0.376628548f, 0.370478779f},
-std::array<float,2>{0.858641982f, 0.558496237f},
-std::array<float,2>{0.152653292f, 0.928338766f},
-std::array<float,2>{0.733945787f, 0.137128502f},
-std::array<float,2>{0.0867057219f, 0.10863281f},
-std::array<float,2>{0.537951529f, 0.759999633f},
-std::array<float,2>{0.372727692f, 0.636298656f},
-std::array<float,2>{0.917803347f, 0.385672033f},
-std::array<float,2>{0.466010302f, 0.0174144879f},
-std::array<float,2>{0.78738898f, 0.859838068f},
-std::array<float,2>{0.235457838f, 0.712820351f},
-std::array<float,2>{0.678242922f, 0.463680953f},
-std::array<float,2>{0.0511956029f, 0.283845723f},
-std::array<float,2>{0.590174854f, 0.623532593f},
-std::array<float,2>{0.280820549f, 0.946577907f},
-std::array<float,2>{0.968091846f, 0.23805514f},
-std::array<float,2>{0.317765087f, 0.426494569f},
-std::array<float,2>{0.902206421f, 0.67244333f},
-std::array<float,2>{0.100803904f, 0.800753891f},
-std::array<float,2>{0.510056317f, 0.0856440067f},
-std::array<float,2>{0.181399941f, 0.158805192f},
-std::array<float,2>{0.712107182f, 0.892733037f},
-std::array<float,2>{0.422178566f, 0.504701734f},
-std::array<float,2>{0.834299266f, 0.332593352f},
-std::array<float,2>{0.444691032f, 0.171416596f},
-std::array<float,2>{0.803332329f, 0.905027747f},
-std::array<float,2>{0.21993722f, 0.515491426f},
-std::array<float,2>{0.659939289f, 0.339418501f},
-std::array<float,2>{0.0452208668f, 0.434112579f},
-std::array<float,2>{0.567076981f, 0.685338557f},
-std::array<float,2>{0.260306597f, 0.810744107f},
-std::array<float,2>{0.942396283f, 0.0899509415f},
-std::array<float,2>{0.342530727f, 0.296760142f},
-std::array<float,2>{0.880535185f, 0.612342775f},
-std::array<float,2>{0.119558722f, 0.94077915f},
-std::array<float,2>{0.52774173f, 0.244888902f},
-std::array<float,2>{0.168217123f, 0.0289597809f},
-std::array<float,2>{0.689268768f, 0.867416739f},
-std::array<float,2>{0.412265271f, 0.704122245f},
-std::array<float,2>{0.825875819f, 0.460219055f},
-std::array<float,2>{0.296823353f, 0.101351641f},
-std::array<float,2>{0.973910928f, 0.753083587f},
-std::array<float,2>{0.00698065246f, 0.628044248f},
-std::array<float,2>{0.601940334f, 0.381665677f},
-std::array<float,2>{0.205569908f, 0.360479146f},
-std::array<float,2>{0.646725297f, 0.552752852f},
-std::array<float,2>{0.478700966f, 0.930113077f},
-std::array<float,2>{0.762548923f, 0.13254793f},
-std::array<float,2>{0.404498607f, 0.477923274f},
-std::array<float,2>{0.861423135f, 0.729960501f},
-std::array<float,2>{0.129013583f, 0.815460026f},
-std::array<float,2>{0.742238283f, 0.0500745103f},
-std::array<float,2>{0.0632435083f, 0.211128816f},
-std::array<float,2>{0.553163469f, 0.98403132f},
-std::array<float,2>{0.349473894f, 0.578126013f},
-std::array<float,2>{0.935189128f, 0.263145477f},
-std::array<float,2>{0.367411822f, 0.221375182f},
-std::array<float,2>{0.919811189f, 0.953568578f},
-std::array<float,2>{0.0935582295f, 0.60928899f},
-std::array<float,2>{0.531864524f, 0.297617793f},
-std::array<float,2>{0.149414852f, 0.452273339f},
-std::array<float,2>{0.728332996f, 0.698177278f},
-std::array<float,2>{0.382229477f, 0.844698191f},
-std::array<float,2>{0.852629483f, 0.00442262972f},
-std::array<float,2>{0.486115277f, 0.320231855f},
-std::array<float,2>{0.778694689f, 0.521808505f},
-std::array<float,2>{0.188910708f, 0.879910171f},
-std::array<float,2>{0.633268595f, 0.183279559f},
-std::array<float,2>{0.0312350485f, 0.0663182214f},
-std::array<float,2>{0.612321079f, 0.78426522f},
-std::array<float,2>{0.298008919f, 0.668086648f},
-std::array<float,2>{0.99078685f, 0.421277732f},
-std::array<float,2>{0.427193552f, 0.0312781893f},
-std::array<float,2>{0.828443527f, 0.842220068f},
-std::array<float,2>{0.18560122f, 0.738272786f},
-std::array<float,2>{0.717660666f, 0.49820897f},
-std::array<float,2>{0.0955555215f, 0.275148898f},
-std::array<float,2>{0.514166951f, 0.567487121f},
-std::array<float,2>{0.315838009f, 0.993448675f},
-std::array<float,2>{0.905446053f, 0.187574163f},
-std::array<float,2>{0.277247041f, 0.39545247f},
-std::array<float,2>{0.964542091f, 0.644225419f},
-std::array<float,2>{0.0481509604f, 0.768563271f},
-std::array<float,2>{0.587236404f, 0.111214042f},
-std::array<float,2>{0.241881818f, 0.144076556f},
-std::array<float,2>{0.673876345f, 0.911708653f},
-std::array<float,2>{0.463187903f, 0.537419915f},
-std::array<float,2>{0.782496572f, 0.358765811f},
-std::array<float,2>{0.387709051f, 0.20002988f},
-std::array<float,2>{0.850218952f, 0.988924444f},
-std::array<float,2>{0.145759955f, 0.575881898f},
-std::array<float,2>{0.722295761f, 0.266928643f},
-std::array<float,2>{0.0800515935f, 0.487308204f},
-std::array<float,2>{0.544219971f, 0.742927074f},
-std::array<float,2>{0.363748759f, 0.835065067f},
-std::array<float,2>{0.909281015f, 0.0428912155f},
-std::array<float,2>{0.304963797f, 0.344406992f},
-std::array<float,2>{0.993739009f, 0.540564001f},
-std::array<float,2>{0.0217527412f, 0.91553241f},
-std::array<float,2>{0.619973421f, 0.1547288f},
-std::array<float,2>{0.201352715f, 0.119381577f},
-std::array<float,2>{0.625986278f, 0.777488053f},
-std::array<float,2>{0.49704361f, 0.655884922f},
-std::array<float,2>{0.769627929f, 0.402411669f},
-std::array<float,2>{0.32432732f, 0.0131721077f},
-std::array<float,2>{0.893162847f, 0.855598211f},
-std::array<float,2>{0.108191967f, 0.693832517f},
-std::array<float,2>{0.505576015f, 0.444762737f},
-std::array<float,2>{0.172096834f, 0.307863712f},
-std::array<float,2>{0.710008264f, 0.600542486f},
-std::array<float,2>{0.432883799f, 0.961063504f},
-std::array<float,2>{0.838357568f, 0.233523905f},
-std::array<float,2>{0.457968354f, 0.410779417f},
-std::array<float,2>{0.794802964f, 0.659334719f},
-std::array<float,2>{0.245719731f, 0.790642321f},
-std::array<float,2>{0.680319726f, 0.0741009116f},
-std::array<float,2>{0.0564239286f, 0.176438898f},
-std::array<float,2>{0.580123842f, 0.889148176f},
-std::array<float,2>{0.269384533f, 0.528191626f},
-std::array<float,2>{0.960342407f, 0.326362669f},
-std::array<float,2>{0.250169277f, 0.134491831f},
-std::array<float,2>{0.946920872f, 0.92317605f},
-std::array<float,2>{0.038211301f, 0.559222996f},
-std::array<float,2>{0.570661068f, 0.372319221f},
-std::array<float,2>{0.22907865f, 0.386863053f},
-std::array<float,2>{0.666641355f, 0.637451947f},
-std::array<float,2>{0.451910943f, 0.764436603f},
-std::array<float,2>{0.812122107f, 0.101828597f},
-std::array<float,2>{0.418858528f, 0.252689004f},
-std::array<float,2>{0.81744343f, 0.589092374f},
-std::array<float,2>{0.1617641f, 0.976380289f},
-std::array<float,2>{0.696049154f, 0.203790307f},
-std::array<float,2>{0.116576642f, 0.0574474372f},
-std::array<float,2>{0.521538854f, 0.825833857f},
-std::array<float,2>{0.328216106f, 0.721512377f},
-std::array<float,2>{0.888979018f, 0.470539719f},
-std::array<float,2>{0.47287634f, 0.0785720497f},
-std::array<float,2>{0.754964173f, 0.803821802f},
-std::array<float,2>{0.215179145f, 0.675848663f},
-std::array<float,2>{0.648497224f, 0.42356053f},
-std::array<float,2>{0.00930095185f, 0.331564635f},
-std::array<float,2>{0.599845052f, 0.500674427f},
-std::array<float,2>{0.288352728f, 0.898051381f},
-std::array<float,2>{0.978146076f, 0.162405491f},
-std::array<float,2>{0.351943433f, 0.467260361f},
-std::array<float,2>{0.921875536f, 0.718687832f},
-std::array<float,2>{0.0716280416f, 0.867175102f},
-std::array<float,2>{0.555433393f, 0.0199060962f},
-std::array<float,2>{0.137622535f, 0.239115298f},
-std::array<float,2>{0.74166888f, 0.952923656f},
-std::array<float,2>{0.395708352f, 0.619767189f},
-std::array<float,2>{0.873151779f, 0.287722856f},
-std::array<float,2>{0.45403266f, 0.218719751f},
-std::array<float,2>{0.789619923f, 0.980091274f},
-std::array<float,2>{0.246257976f, 0.583154857f},
-std::array<float,2>{0.684433341f, 0.258174032f},
-std::array<float,2>{0.0622415319f, 0.481125981f},
-std::array<float,2>{0.58520329f, 0.734170079f},
-std::array<float,2>{0.270362049f, 0.818938255f},
-std::array<float,2>{0.95333904f, 0.0511773825f},
-std::array<float,2>{0.321465224f, 0.36613676f},
-std::array<float,2>{0.895174086f, 0.54762435f},
-std::array<float,2>{0.103240475f, 0.934640706f},
-std::array<float,2>{0.50369072f, 0.127630055f},
-std::array<float,2>{0.178674489f, 0.0966543406f},
-std::array<float,2>{0.703828156f, 0.755153f},
-std::array<float,2>{0.434495598f, 0.632200241f},
-std::array<float,2>{0.841874361f, 0.376194179f},
-std::array<float,2>{0.308666199f, 0.0260011051f},
-std::array<float,2>{0.998844624f, 0.874872744f},
-std::array<float,2>{0.0161759667f, 0.70990783f},
-std::array<float,2>{0.622626901f, 0.453158349f},
-std::array<float,2>{0.198100716f, 0.291504174f},
-std::array<float,2>{0.632497966f, 0.615912199f},
-std::array<float,2>{0.494552016f, 0.943845093f},
-std::array<float,2>{0.766368389f, 0.249309421f},
-std::array<float,2>{0.38334024f, 0.432499051f},
-std::array<float,2>{0.846402109f, 0.681851149f},
-std::array<float,2>{0.142794237f, 0.807556629f},
-std::array<float,2>{0.724062741f, 0.0862105712f},
-std::array<float,2>{0.085499458f, 0.164245799f},
-std::array<float,2>{0.542544603f, 0.901378155f},
-std::array<float,2>{0.36075598f, 0.511497378f},
-std::array<float,2>{0.913505256f, 0.343211561f},
-std::array<float,2>{0.355860978f, 0.14631778f},
-std::array<float,2>{0.92653811f, 0.909317553f},
-std::array<float,2>{0.0756691545f, 0.533771634f},
-std::array<float,2>{0.561986029f, 0.354016483f},
-std::array<float,2>{0.13605985f, 0.391975552f},
-std::array<float,2>{0.737841666f, 0.645577252f},
-std::array<float,2>{0.392958075f, 0.772212565f},
-std::array<float,2>{0.870346487f, 0.114881329f},
-std::array<float,2>{0.470896006f, 0.278257221f},
-std::array<float,2>{0.750196159f, 0.564754188f},
-std::array<float,2>{0.212821484f, 0.997471511f},
-std::array<float,2>{0.654737115f, 0.191750243f},
-std::array<float,2>{0.0150180748f, 0.0386229567f},
-std::array<float,2>{0.595239639f, 0.839369535f},
-std::array<float,2>{0.282076716f, 0.742065549f},
-std::array<float,2>{0.983218074f, 0.49376744f},
-std::array<float,2>{0.41497308f, 0.0688822046f},
-std::array<float,2>{0.815075457f, 0.787157953f},
-std::array<float,2>{0.159150615f, 0.665292859f},
-std::array<float,2>{0.702870011f, 0.415364176f},
-std::array<float,2>{0.109866023f, 0.316200525f},
-std::array<float,2>{0.518723607f, 0.519035101f},
-std::array<float,2>{0.335228086f, 0.876824737f},
-std::array<float,2>{0.886055589f, 0.184168428f},
-std::array<float,2>{0.254647672f, 0.446145773f},
-std::array<float,2>{0.95042783f, 0.70179379f},
-std::array<float,2>{0.0339059308f, 0.848189056f},
-std::array<float,2>{0.576502323f, 0.000319747429f},
-std::array<float,2>{0.231999218f, 0.226422131f},
-std::array<float,2>{0.669669211f, 0.959952056f},
-std::array<float,2>{0.448293895f, 0.602784932f},
-std::array<float,2>{0.807880878f, 0.304434985f},
-std::array<float,2>{0.399895668f, 0.173712492f},
-std::array<float,2>{0.864835382f, 0.886489153f},
-std::array<float,2>{0.125969514f, 0.526784658f},
-std::array<float,2>{0.74999404f, 0.324182093f},
-std::array<float,2>{0.0691961274f, 0.407259732f},
-std::array<float,2>{0.548457563f, 0.660362065f},
-std::array<float,2>{0.345353514f, 0.795235157f},
-std::array<float,2>{0.932150602f, 0.0742599517f},
-std::array<float,2>{0.29192993f, 0.309412122f},
-std::array<float,2>{0.97098124f, 0.597031832f},
-std::array<float,2>{0.000684666273f, 0.965875506f},
-std::array<float,2>{0.608518958f, 0.227174699f},
-std::array<float,2>{0.20977366f, 0.00818146858f},
-std::array<float,2>{0.642746806f, 0.852751017f},
-std::array<float,2>{0.480643392f, 0.689574599f},
-std::array<float,2>{0.759024084f, 0.440065533f},
-std::array<float,2>{0.338626981f, 0.122076906f},
-std::array<float,2>{0.877957821f, 0.776983678f},
-std::array<float,2>{0.122116834f, 0.651585758f},
-std::array<float,2>{0.527235329f, 0.400151402f},
-std::array<float,2>{0.166709542f, 0.351388007f},
-std::array<float,2>{0.695210755f, 0.546487391f},
-std::array<float,2>{0.407239228f, 0.921864688f},
-std::array<float,2>{0.822585285f, 0.150158748f},
-std::array<float,2>{0.439206004f, 0.488439322f},
-std::array<float,2>{0.800391078f, 0.748264372f},
-std::array<float,2>{0.225391448f, 0.830086291f},
-std::array<float,2>{0.662901998f, 0.0454616956f},
-std::array<float,2>{0.040912021f, 0.198017463f},
-std::array<float,2>{0.562695444f, 0.984639406f},
-std::array<float,2>{0.261741698f, 0.571645558f},
-std::array<float,2>{0.938962698f, 0.270801306f},
-std::array<float,2>{0.277876735f, 0.235293746f},
-std::array<float,2>{0.966063738f, 0.94921869f},
-std::array<float,2>{0.0542932041f, 0.622408092f},
-std::array<float,2>{0.592540383f, 0.281350464f},
-std::array<float,2>{0.237233281f, 0.461538732f},
-std::array<float,2>{0.675853848f, 0.713874936f},
-std::array<float,2>{0.46863246f, 0.862434745f},
-std::array<float,2>{0.786694705f, 0.0184450988f},
-std::array<float,2>{0.425213009f, 0.334233105f},
-std::array<float,2>{0.832461774f, 0.506259084f},
-std::array<float,2>{0.182470575f, 0.892045259f},
-std::array<float,2>{0.714170277f, 0.157330245f},
-std::array<float,2>{0.0992395282f, 0.0835064873f},
-std::array<float,2>{0.509738147f, 0.7979002f},
-std::array<float,2>{0.3186602f, 0.674152136f},
-std::array<float,2>{0.900364876f, 0.428137958f},
-std::array<float,2>{0.490251064f, 0.0586773604f},
-std::array<float,2>{0.774209321f, 0.821552038f},
-std::array<float,2>{0.192002475f, 0.722787321f},
-std::array<float,2>{0.639289916f, 0.474404156f},
-std::array<float,2>{0.0250851251f, 0.255059242f},
-std::array<float,2>{0.613930643f, 0.591357291f},
-std::array<float,2>{0.301731139f, 0.969517112f},
-std::array<float,2>{0.986309946f, 0.208660886f},
-std::array<float,2>{0.374497712f, 0.383191347f},
-std::array<float,2>{0.915313184f, 0.63406378f},
-std::array<float,2>{0.0897527337f, 0.758563161f},
-std::array<float,2>{0.535518587f, 0.106154419f},
-std::array<float,2>{0.155162901f, 0.140111908f},
-std::array<float,2>{0.731900692f, 0.92649442f},
-std::array<float,2>{0.377326041f, 0.554862618f},
-std::array<float,2>{0.857296884f, 0.367812753f},
-std::array<float,2>{0.477260083f, 0.130790383f},
-std::array<float,2>{0.7649979f, 0.932978213f},
-std::array<float,2>{0.203947961f, 0.551496446f},
-std::array<float,2>{0.645969987f, 0.361994922f},
-std::array<float,2>{0.00424461951f, 0.380845785f},
-std::array<float,2>{0.605158329f, 0.625720441f},
-std::array<float,2>{0.293119907f, 0.751694262f},
-std::array<float,2>{0.975625992f, 0.099594444f},
-std::array<float,2>{0.350111604f, 0.264695138f},
-std::array<float,2>{0.937302709f, 0.581457853f},
-std::array<float,2>{0.0663692877f, 0.980871975f},
-std::array<float,2>{0.551467776f, 0.213205725f},
-std::array<float,2>{0.131827191f, 0.0485403202f},
-std::array<float,2>{0.745661438f, 0.813442945f},
-std::array<float,2>{0.40383634f, 0.728003561f},
-std::array<float,2>{0.859544516f, 0.478688926f},
-std::array<float,2>{0.259660393f, 0.0932577252f},
-std::array<float,2>{0.945219219f, 0.809164464f},
-std::array<float,2>{0.0448726416f, 0.686659575f},
-std::array<float,2>{0.569196641f, 0.437494308f},
-std::array<float,2>{0.220912173f, 0.336662412f},
-std::array<float,2>{0.657079101f, 0.51352644f},
-std::array<float,2>{0.442982644f, 0.902633369f},
-std::array<float,2>{0.801269352f, 0.168261081f},
-std::array<float,2>{0.411045849f, 0.457076699f},
-std::array<float,2>{0.827971518f, 0.705745518f},
-std::array<float,2>{0.170254886f, 0.870074987f},
-std::array<float,2>{0.689870596f, 0.0299591385f},
-std::array<float,2>{0.118349135f, 0.243580207f},
-std::array<float,2>{0.530317426f, 0.937608838f},
-std::array<float,2>{0.339851648f, 0.61068362f},
-std::array<float,2>{0.882758737f, 0.294248551f},
-std::array<float,2>{0.314015716f, 0.19069542f},
-std::array<float,2>{0.903731942f, 0.99552232f},
-std::array<float,2>{0.0964058489f, 0.569733083f},
-std::array<float,2>{0.51270318f, 0.277142942f},
-std::array<float,2>{0.184580892f, 0.496434838f},
-std::array<float,2>{0.715198696f, 0.735380828f},
-std::array<float,2>{0.428118587f, 0.840954185f},
-std::array<float,2>{0.830599785f, 0.0343850516f},
-std::array<float,2>{0.462631494f, 0.356364012f},
-std::array<float,2>{0.783337235f, 0.536004603f},
-std::array<float,2>{0.239167079f, 0.913178921f},
-std::array<float,2>{0.673781931f, 0.141593441f},
-std::array<float,2>{0.0505143031f, 0.112974823f},
-std::array<float,2>{0.587992966f, 0.766791582f},
-std::array<float,2>{0.273833364f, 0.641595364f},
-std::array<float,2>{0.962142408f, 0.396490723f},
-std::array<float,2>{0.379426956f, 0.00659591751f},
-std::array<float,2>{0.854100645f, 0.846225023f},
-std::array<float,2>{0.150603414f, 0.695761442f},
-std::array<float,2>{0.729927421f, 0.451027036f},
-std::array<float,2>{0.0915066227f, 0.299860299f},
-std::array<float,2>{0.533517182f, 0.605787098f},
-std::array<float,2>{0.370312572f, 0.95517379f},
-std::array<float,2>{0.92156446f, 0.219984561f},
-std::array<float,2>{0.30077228f, 0.418693364f},
-std::array<float,2>{0.988399327f, 0.67093575f},
-std::array<float,2>{0.0288449842f, 0.782553613f},
-std::array<float,2>{0.610059023f, 0.0644488558f},
-std::array<float,2>{0.189993486f, 0.181240439f},
-std::array<float,2>{0.635010183f, 0.882726669f},
-std::array<float,2>{0.487797171f, 0.520121515f},
-std::array<float,2>{0.780959904f, 0.317818135f},
-std::array<float,2>{0.431258738f, 0.231874079f},
-std::array<float,2>{0.83768028f, 0.962971389f},
-std::array<float,2>{0.174407542f, 0.598746121f},
-std::array<float,2>{0.708065093f, 0.305312961f},
-std::array<float,2>{0.105668969f, 0.443015903f},
-std::array<float,2>{0.506303728f, 0.691647768f},
-std::array<float,2>{0.326653212f, 0.859030545f},
-std::array<float,2>{0.891396999f, 0.0150467884f},
-std::array<float,2>{0.265941441f, 0.325103939f},
-std::array<float,2>{0.957218409f, 0.529736817f},
-std::array<float,2>{0.0576060303f, 0.888383269f},
-std::array<float,2>{0.579931974f, 0.179632246f},
-std::array<float,2>{0.243079811f, 0.0708535761f},
-std::array<float,2>{0.682198048f, 0.792122066f},
-std::array<float,2>{0.45934099f, 0.658082128f},
-std::array<float,2>{0.795110524f, 0.413852274f},
-std::array<float,2>{0.366875023f, 0.0404621288f},
-std::array<float,2>{0.906674743f, 0.832192063f},
-std::array<float,2>{0.0808324292f, 0.7442891f},
-std::array<float,2>{0.545242429f, 0.485388577f},
-std::array<float,2>{0.148168519f, 0.267810404f},
-std::array<float,2>{0.719350934f, 0.576879323f},
-std::array<float,2>{0.38947925f, 0.991044939f},
-std::array<float,2>{0.847991288f, 0.202077776f},
-std::array<float,2>{0.498087168f, 0.405428648f},
-std::array<float,2>{0.772713125f, 0.653591812f},
-std::array<float,2>{0.200991675f, 0.780370891f},
-std::array<float,2>{0.627406001f, 0.119065776f},
-std::array<float,2>{0.0199148245f, 0.154046699f},
-std::array<float,2>{0.617200434f, 0.917818606f},
-std::array<float,2>{0.307672411f, 0.542171836f},
-std::array<float,2>{0.9951002f, 0.346768141f},
-std::array<float,2>{0.285610169f, 0.160421044f},
-std::array<float,2>{0.980095088f, 0.89646095f},
-std::array<float,2>{0.0104809003f, 0.502328515f},
-std::array<float,2>{0.599046409f, 0.329326361f},
-std::array<float,2>{0.217846438f, 0.425371081f},
-std::array<float,2>{0.651975036f, 0.677876353f},
-std::array<float,2>{0.476506382f, 0.801782966f},
-std::array<float,2>{0.756461918f, 0.0817277431f},
-std::array<float,2>{0.397274822f, 0.285577565f},
-std::array<float,2>{0.871724904f, 0.619017482f},
-std::array<float,2>{0.140384614f, 0.949758828f},
-std::array<float,2>{0.739845455f, 0.240709737f},
-std::array<float,2>{0.0726014152f, 0.0222961269f},
-std::array<float,2>{0.55690676f, 0.865163684f},
-std::array<float,2>{0.353644878f, 0.715616584f},
-std::array<float,2>{0.924544156f, 0.466027886f},
-std::array<float,2>{0.449477822f, 0.103833638f},
-std::array<float,2>{0.810003877f, 0.76252836f},
-std::array<float,2>{0.227461085f, 0.63913095f},
-std::array<float,2>{0.664377451f, 0.388727486f},
-std::array<float,2>{0.0363544375f, 0.37428382f},
-std::array<float,2>{0.57347548f, 0.562178969f},
-std::array<float,2>{0.2522735f, 0.923854411f},
-std::array<float,2>{0.948119938f, 0.136338189f},
-std::array<float,2>{0.331320167f, 0.472639978f},
-std::array<float,2>{0.88800019f, 0.719852924f},
-std::array<float,2>{0.113844261f, 0.827684402f},
-std::array<float,2>{0.520747066f, 0.0561863706f},
-std::array<float,2>{0.162768766f, 0.205951542f},
-std::array<float,2>{0.697602093f, 0.974192798f},
-std::array<float,2>{0.4215253f, 0.586831391f},
-std::array<float,2>{0.81945467f, 0.250502974f},
-std::array<float,2>{0.447808534f, 0.223516881f},
-std::array<float,2>{0.807368875f, 0.957326412f},
-std::array<float,2>{0.230941117f, 0.603588998f},
-std::array<float,2>{0.668506682f, 0.302294642f},
-std::array<float,2>{0.034643542f, 0.447818041f},
-std::array<float,2>{0.577704489f, 0.699460566f},
-std::array<float,2>{0.255450845f, 0.850244999f},
-std::array<float,2>{0.949542403f, 0.00329703372f},
-std::array<float,2>{0.334526598f, 0.313110679f},
-std::array<float,2>{0.885697782f, 0.516377747f},
-std::array<float,2>{0.111270018f, 0.878703117f},
-std::array<float,2>{0.517670035f, 0.187409073f},
-std::array<float,2>{0.15920873f, 0.0667874143f},
-std::array<float,2>{0.70179373f, 0.786765933f},
-std::array<float,2>{0.415906966f, 0.667385042f},
-std::array<float,2>{0.816104889f, 0.417399764f},
-std::array<float,2>{0.282438695f, 0.0363097787f},
-std::array<float,2>{0.983582854f, 0.836565971f},
-std::array<float,2>{0.0140535031f, 0.740174413f},
-std::array<float,2>{0.594176233f, 0.495618761f},
-std::array<float,2>{0.211839765f, 0.280256778f},
-std::array<float,2>{0.655470788f, 0.562650621f},
-std::array<float,2>{0.472334355f, 0.999193907f},
-std::array<float,2>{0.751517892f, 0.194031551f},
-std::array<float,2>{0.394529343f, 0.393271565f},
-std::array<float,2>{0.869820774f, 0.647580504f},
-std::array<float,2>{0.134797379f, 0.771104395f},
-std::array<float,2>{0.737190485f, 0.116584182f},
-std::array<float,2>{0.0746944174f, 0.148381144f},
-std::array<float,2>{0.561402857f, 0.90673852f},
-std::array<float,2>{0.357320666f, 0.531379521f},
-std::array<float,2>{0.927483201f, 0.353253275f},
-std::array<float,2>{0.359848261f, 0.166178107f},
-std::array<float,2>{0.912843287f, 0.899902582f},
-std::array<float,2>{0.0840257257f, 0.509038091f},
-std::array<float,2>{0.541850507f, 0.340890288f},
-std::array<float,2>{0.144376531f, 0.430883914f},
-std::array<float,2>{0.722970843f, 0.680230677f},
-std::array<float,2>{0.384346992f, 0.804719985f},
-std::array<float,2>{0.847022593f, 0.0897936299f},
-std::array<float,2>{0.495647252f, 0.28971523f},
-std::array<float,2>{0.76753521f, 0.614551425f},
-std::array<float,2>{0.198740095f, 0.941740334f},
-std::array<float,2>{0.631729662f, 0.246546f},
-std::array<float,2>{0.016895527f, 0.0238326695f},
-std::array<float,2>{0.62164104f, 0.872518957f},
-std::array<float,2>{0.310065597f, 0.70743978f},
-std::array<float,2>{0.999055326f, 0.456737012f},
-std::array<float,2>{0.434841454f, 0.0951612815f},
-std::array<float,2>{0.843178689f, 0.757481813f},
-std::array<float,2>{0.179629326f, 0.63070792f},
-std::array<float,2>{0.704820275f, 0.377274156f},
-std::array<float,2>{0.101733997f, 0.364541739f},
-std::array<float,2>{0.502866566f, 0.550268292f},
-std::array<float,2>{0.320872813f, 0.935845733f},
-std::array<float,2>{0.89638561f, 0.125658393f},
-std::array<float,2>{0.270621091f, 0.482588321f},
-std::array<float,2>{0.954287052f, 0.731453896f},
-std::array<float,2>{0.0609193444f, 0.816583991f},
-std::array<float,2>{0.584432364f, 0.0531902649f},
-std::array<float,2>{0.247303218f, 0.216589376f},
-std::array<float,2>{0.684881985f, 0.97718662f},
-std::array<float,2>{0.454345673f, 0.58412385f},
-std::array<float,2>{0.790758789f, 0.260110676f},
-std::array<float,2>{0.378555596f, 0.137705386f},
-std::array<float,2>{0.856250525f, 0.92936492f},
-std::array<float,2>{0.155992702f, 0.556903183f},
-std::array<float,2>{0.730689406f, 0.370076358f},
-std::array<float,2>{0.0880402848f, 0.386669755f},
-std::array<float,2>{0.536752045f, 0.635037959f},
-std::array<float,2>{0.373091251f, 0.761416018f},
-std::array<float,2>{0.91469723f, 0.107495151f},
-std::array<float,2>{0.302283943f, 0.256930918f},
-std::array<float,2>{0.984807789f, 0.593328059f},
-std::array<float,2>{0.0240714215f, 0.970820665f},
-std::array<float,2>{0.614358246f, 0.209194496f},
-std::array<float,2>{0.192999452f, 0.0614446588f},
-std::array<float,2>{0.640167117f, 0.823389292f},
-std::array<float,2>{0.491500258f, 0.725288272f},
-std::array<float,2>{0.77492851f, 0.475721568f},
-std::array<float,2>{0.319791734f, 0.0844048485f},
-std::array<float,2>{0.898456812f, 0.799372375f},
-std::array<float,2>{0.0977409557f, 0.673454821f},
-std::array<float,2>{0.50831598f, 0.426951617f},
-std::array<float,2>{0.183329985f, 0.333529621f},
-std::array<float,2>{0.712952971f, 0.505306005f},
-std::array<float,2>{0.423927873f, 0.893640816f},
-std::array<float,2>{0.833769321f, 0.160064712f},
-std::array<float,2>{0.467528045f, 0.464656562f},
-std::array<float,2>{0.7854141f, 0.711376786f},
-std::array<float,2>{0.23768577f, 0.860900819f},
-std::array<float,2>{0.67692858f, 0.0158851668f},
-std::array<float,2>{0.0535083935f, 0.237091184f},
-std::array<float,2>{0.592989862f, 0.945678115f},
-std::array<float,2>{0.278750986f, 0.62412107f},
-std::array<float,2>{0.965037167f, 0.284622818f},
-std::array<float,2>{0.263359576f, 0.196938753f},
-std::array<float,2>{0.938257635f, 0.987605751f},
-std::array<float,2>{0.0397816114f, 0.572521448f},
-std::array<float,2>{0.563696325f, 0.272292793f},
-std::array<float,2>{0.22616142f, 0.491236567f},
-std::array<float,2>{0.663190544f, 0.747100174f},
-std::array<float,2>{0.438361317f, 0.829825044f},
-std::array<float,2>{0.799723625f, 0.0443015508f},
-std::array<float,2>{0.406598926f, 0.34874168f},
-std::array<float,2>{0.823502064f, 0.544813633f},
-std::array<float,2>{0.167324379f, 0.919015527f},
-std::array<float,2>{0.69368881f, 0.150908172f},
-std::array<float,2>{0.121569619f, 0.124905288f},
-std::array<float,2>{0.525728762f, 0.773749828f},
-std::array<float,2>{0.339283526f, 0.650369465f},
-std::array<float,2>{0.877477705f, 0.400811642f},
-std::array<float,2>{0.481453061f, 0.0100438762f},
-std::array<float,2>{0.758480728f, 0.855369627f},
-std::array<float,2>{0.210579529f, 0.688062251f},
-std::array<float,2>{0.64417398f, 0.437795728f},
-std::array<float,2>{0.00147261354f, 0.310779095f},
-std::array<float,2>{0.607542574f, 0.59404552f},
-std::array<float,2>{0.292555928f, 0.967975259f},
-std::array<float,2>{0.971858442f, 0.229083046f},
-std::array<float,2>{0.344405055f, 0.41015622f},
-std::array<float,2>{0.932734251f, 0.663653553f},
-std::array<float,2>{0.0699942037f, 0.793537319f},
-std::array<float,2>{0.547477663f, 0.0762967989f},
-std::array<float,2>{0.126863599f, 0.175406501f},
-std::array<float,2>{0.748222828f, 0.883072734f},
-std::array<float,2>{0.398755074f, 0.523640394f},
-std::array<float,2>{0.863788247f, 0.321115226f},
-std::array<float,2>{0.487173676f, 0.182142064f},
-std::array<float,2>{0.779322147f, 0.87964201f},
-std::array<float,2>{0.19054313f, 0.522514701f},
-std::array<float,2>{0.636220396f, 0.318500906f},
-std::array<float,2>{0.0282850657f, 0.419959545f},
-std::array<float,2>{0.610776484f, 0.669059098f},
-std::array<float,2>{0.299785286f, 0.784150898f},
-std::array<float,2>{0.990123987f, 0.0650437996f},
-std::array<float,2>{0.369353205f, 0.298320323f},
-std::array<float,2>{0.920134366f, 0.6081689f},
-std::array<float,2>{0.0901465341f, 0.954405427f},
-std::array<float,2>{0.535124838f, 0.221895024f},
-std::array<float,2>{0.151564702f, 0.00572894979f},
-std::array<float,2>{0.729134202f, 0.845393002f},
-std::array<float,2>{0.379889518f, 0.698710978f},
-std::array<float,2>{0.854577899f, 0.451873481f},
-std::array<float,2>{0.274500996f, 0.110116899f},
-std::array<float,2>{0.961362123f, 0.767690182f},
-std::array<float,2>{0.0495681763f, 0.642586172f},
-std::array<float,2>{0.589481771f, 0.396220982f},
-std::array<float,2>{0.239452332f, 0.357692689f},
-std::array<float,2>{0.672696352f, 0.538350344f},
-std::array<float,2>{0.46164456f, 0.911073565f},
-std::array<float,2>{0.784791231f, 0.142854527f},
-std::array<float,2>{0.429144263f, 0.499087065f},
-std::array<float,2>{0.831148028f, 0.736838162f},
-std::array<float,2>{0.184282392f, 0.84337157f},
-std::array<float,2>{0.716125607f, 0.0322413892f},
-std::array<float,2>{0.0973089337f, 0.188971564f},
-std::array<float,2>{0.512611508f, 0.992758572f},
-std::array<float,2>{0.313131899f, 0.567256749f},
-std::array<float,2>{0.902744055f, 0.273932517f},
-std::array<float,2>{0.34162578f, 0.245715976f},
-std::array<float,2>{0.881109059f, 0.940136552f},
-std::array<float,2>{0.117782503f, 0.611385763f},
-std::array<float,2>{0.530026436f, 0.295713723f},
-std::array<float,2>{0.170982093f, 0.459331721f},
-std::array<float,2>{0.691376984f, 0.704091609f},
-std::array<float,2>{0.41201067f, 0.868361056f},
-std::array<float,2>{0.826405883f, 0.028288953f},
-std::array<float,2>{0.44156456f, 0.338607937f},
-std::array<float,2>{0.802382588f, 0.513807297f},
-std::array<float,2>{0.221986338f, 0.905479789f},
-std::array<float,2>{0.658079982f, 0.170329556f},
-std::array<float,2>{0.0430221595f, 0.0917874128f},
-std::array<float,2>{0.569947243f, 0.811826825f},
-std::array<float,2>{0.258682251f, 0.683687747f},
-std::array<float,2>{0.943580925f, 0.43480739f},
-std::array<float,2>{0.402581453f, 0.0491580926f},
-std::array<float,2>{0.860424399f, 0.814526916f},
-std::array<float,2>{0.132154092f, 0.72945255f},
-std::array<float,2>{0.744533002f, 0.477421045f},
-std::array<float,2>{0.0646950528f, 0.262009114f},
-std::array<float,2>{0.552319586f, 0.579910636f},
-std::array<float,2>{0.350796998f, 0.982446909f},
-std::array<float,2>{0.936452806f, 0.211935207f},
-std::array<float,2>{0.294703722f, 0.38189134f},
-std::array<float,2>{0.974622548f, 0.627262831f},
-std::array<float,2>{0.00492005982f, 0.752882242f},
-std::array<float,2>{0.603617549f, 0.100316823f},
-std::array<float,2>{0.204253018f, 0.131289393f},
-std::array<float,2>{0.644565105f, 0.93126142f},
-std::array<float,2>{0.478024095f, 0.55401665f},
-std::array<float,2>{0.764550984f, 0.360217839f},
-std::array<float,2>{0.420559525f, 0.204508379f},
-std::array<float,2>{0.818730593f, 0.975448608f},
-std::array<float,2>{0.163538575f, 0.58881551f},
-std::array<float,2>{0.699218571f, 0.25339821f},
-std::array<float,2>{0.114447311f, 0.468834698f},
-std::array<float,2>{0.520390272f, 0.722034454f},
-std::array<float,2>{0.330257028f, 0.824653625f},
-std::array<float,2>{0.887613416f, 0.0583616905f},
-std::array<float,2>{0.25372231f, 0.371671319f},
-std::array<float,2>{0.9490695f, 0.560447097f},
-std::array<float,2>{0.0358108319f, 0.922522902f},
-std::array<float,2>{0.572422385f, 0.133016035f},
-std::array<float,2>{0.227851242f, 0.103501722f},
-std::array<float,2>{0.665070176f, 0.765284657f},
-std::array<float,2>{0.450443923f, 0.63829565f},
-std::array<float,2>{0.809237659f, 0.388497055f},
-std::array<float,2>{0.354799777f, 0.0210222956f},
-std::array<float,2>{0.92566067f, 0.865493834f},
-std::array<float,2>{0.0738607273f, 0.716857612f},
-std::array<float,2>{0.558293402f, 0.468657106f},
-std::array<float,2>{0.139116287f, 0.288218647f},
-std::array<float,2>{0.738528788f, 0.620672762f},
-std::array<float,2>{0.39821595f, 0.95159632f},
-std::array<float,2>{0.872877061f, 0.239437863f},
-std::array<float,2>{0.475241721f, 0.422524303f},
-std::array<float,2>{0.757504106f, 0.677205384f},
-std::array<float,2>{0.217064172f, 0.80310303f},
-std::array<float,2>{0.651293695f, 0.0792396441f},
-std::array<float,2>{0.0114281503f, 0.163420379f},
-std::array<float,2>{0.598000109f, 0.896486282f},
-std::array<float,2>{0.286414653f, 0.501881361f},
-std::array<float,2>{0.979400039f, 0.330853015f},
-std::array<float,2>{0.307581425f, 0.156047538f},
-std::array<float,2>{0.995882511f, 0.914442241f},
-std::array<float,2>{0.0205495991f, 0.539119601f},
-std::array<float,2>{0.618912101f, 0.345484495f},
-std::array<float,2>{0.200096354f, 0.403571308f},
-std::array<float,2>{0.627952874f, 0.654345155f},
-std::array<float,2>{0.499879718f, 0.778590322f},
-std::array<float,2>{0.772145748f, 0.120663844f},
-std::array<float,2>{0.390582442f, 0.265828371f},
-std::array<float,2>{0.849182189f, 0.57430464f},
-std::array<float,2>{0.147366211f, 0.989492893f},
-std::array<float,2>{0.720118225f, 0.201098323f},
-std::array<float,2>{0.0812326148f, 0.0415823571f},
-std::array<float,2>{0.546598315f, 0.834705591f},
-std::array<float,2>{0.365776509f, 0.743199408f},
-std::array<float,2>{0.908037126f, 0.486929089f},
-std::array<float,2>{0.460830986f, 0.0723690614f},
-std::array<float,2>{0.796815872f, 0.789590359f},
-std::array<float,2>{0.243776277f, 0.658708513f},
-std::array<float,2>{0.683524072f, 0.411534607f},
-std::array<float,2>{0.0580092929f, 0.327663839f},
-std::array<float,2>{0.578512609f, 0.528893471f},
-std::array<float,2>{0.266852707f, 0.889943063f},
-std::array<float,2>{0.958328009f, 0.176842958f},
-std::array<float,2>{0.327503026f, 0.444309086f},
-std::array<float,2>{0.892185032f, 0.695168674f},
-std::array<float,2>{0.107254602f, 0.856693566f},
-std::array<float,2>{0.5073089f, 0.012154175f},
-std::array<float,2>{0.175624445f, 0.233302101f},
-std::array<float,2>{0.707175493f, 0.962470353f},
-std::array<float,2>{0.430574596f, 0.601329803f},
-std::array<float,2>{0.836169541f, 0.307435662f},
-std::array<float,2>{0.469491482f, 0.193161458f},
-std::array<float,2>{0.753905594f, 0.996610522f},
-std::array<float,2>{0.213028073f, 0.56568259f},
-std::array<float,2>{0.65235734f, 0.278694332f},
-std::array<float,2>{0.0118079539f, 0.492933959f},
-std::array<float,2>{0.59707427f, 0.740689039f},
-std::array<float,2>{0.284344137f, 0.837995708f},
-std::array<float,2>{0.981338561f, 0.0376345217f},
-std::array<float,2>{0.359350771f, 0.355339289f},
-std::array<float,2>{0.929488122f, 0.534491539f},
-std::array<float,2>{0.0775606856f, 0.90891844f},
-std::array<float,2>{0.560345054f, 0.145493224f},
-std::array<float,2>{0.134302303f, 0.113772459f},
-std::array<float,2>{0.736321092f, 0.772994578f},
-std::array<float,2>{0.392071635f, 0.645029366f},
-std::array<float,2>{0.868562162f, 0.391473055f},
-std::array<float,2>{0.255926698f, 0.00122475263f},
-std::array<float,2>{0.952928662f, 0.848806441f},
-std::array<float,2>{0.0319949351f, 0.702886343f},
-std::array<float,2>{0.576167047f, 0.447100669f},
-std::array<float,2>{0.233426213f, 0.303106695f},
-std::array<float,2>{0.670547187f, 0.601762235f},
-std::array<float,2>{0.446953475f, 0.960901141f},
-std::array<float,2>{0.804847956f, 0.224629775f},
-std::array<float,2>{0.416246504f, 0.414543301f},
-std::array<float,2>{0.813543677f, 0.664774239f},
-std::array<float,2>{0.157603383f, 0.788983285f},
-std::array<float,2>{0.701163888f, 0.0698950887f},
-std::array<float,2>{0.112300463f, 0.185252383f},
-std::array<float,2>{0.51623112f, 0.875380874f},
-std::array<float,2>{0.332970709f, 0.518098533f},
-std::array<float,2>{0.884560406f, 0.315372944f},
-std::array<float,2>{0.32260254f, 0.128792703f},
-std::array<float,2>{0.898063838f, 0.934151351f},
-std::array<float,2>{0.105354548f, 0.548762321f},
-std::array<float,2>{0.500431836f, 0.367154658f},
-std::array<float,2>{0.177173257f, 0.375695735f},
-std::array<float,2>{0.705119193f, 0.631783724f},
-std::array<float,2>{0.43620944f, 0.754466116f},
-std::array<float,2>{0.840923607f, 0.097516939f},
-std::array<float,2>{0.456299454f, 0.25917241f},
-std::array<float,2>{0.792568147f, 0.582362592f},
-std::array<float,2>{0.249661103f, 0.979124427f},
-std::array<float,2>{0.686348915f, 0.216912493f},
-std::array<float,2>{0.0588711612f, 0.0523311831f},
-std::array<float,2>{0.5830428f, 0.81983608f},
-std::array<float,2>{0.273204923f, 0.733289182f},
-std::array<float,2>{0.956511676f, 0.482052833f},
-std::array<float,2>{0.386601448f, 0.0872787386f},
-std::array<float,2>{0.843773186f, 0.80763042f},
-std::array<float,2>{0.140819192f, 0.683183193f},
-std::array<float,2>{0.725111008f, 0.433024406f},
-std::array<float,2>{0.0836605802f, 0.342176974f},
-std::array<float,2>{0.539730072f, 0.510474682f},
-std::array<float,2>{0.361693829f, 0.901164949f},
-std::array<float,2>{0.910415113f, 0.165699556f},
-std::array<float,2>{0.311383694f, 0.454383314f},
-std::array<float,2>{0.996497691f, 0.710169852f},
-std::array<float,2>{0.0189457815f, 0.873067439f},
-std::array<float,2>{0.624586761f, 0.0271511916f},
-std::array<float,2>{0.196416736f, 0.24891232f},
-std::array<float,2>{0.62959981f, 0.945259333f},
-std::array<float,2>{0.492598981f, 0.617037117f},
-std::array<float,2>{0.768745661f, 0.292326152f},
-std::array<float,2>{0.423740357f, 0.157089651f},
-std::array<float,2>{0.835133255f, 0.891025245f},
-std::array<float,2>{0.180175602f, 0.507054985f},
-std::array<float,2>{0.711894274f, 0.335198313f},
-std::array<float,2>{0.100547709f, 0.429632962f},
-std::array<float,2>{0.511209071f, 0.67547822f},
-std::array<float,2>{0.317126483f, 0.797515035f},
-std::array<float,2>{0.90119344f, 0.0826389566f},
-std::array<float,2>{0.280015618f, 0.282943964f},
-std::array<float,2>{0.967136085f, 0.621816814f},
-std::array<float,2>{0.0527033322f, 0.947778046f},
-std::array<float,2>{0.591019571f, 0.23621428f},
-std::array<float,2>{0.234386027f, 0.0188013129f},
-std::array<float,2>{0.678886473f, 0.861770153f},
-std::array<float,2>{0.465761274f, 0.71339196f},
-std::array<float,2>{0.78852421f, 0.462013006f},
-std::array<float,2>{0.371723652f, 0.106993295f},
-std::array<float,2>{0.916040719f, 0.759144962f},
-std::array<float,2>{0.0878350288f, 0.633337736f},
-std::array<float,2>{0.538670301f, 0.384732932f},
-std::array<float,2>{0.153408021f, 0.368661016f},
-std::array<float,2>{0.733113348f, 0.555954874f},
-std::array<float,2>{0.375342518f, 0.927611709f},
-std::array<float,2>{0.858349919f, 0.139406383f},
-std::array<float,2>{0.489718705f, 0.472896308f},
-std::array<float,2>{0.777188122f, 0.724303067f},
-std::array<float,2>{0.193917394f, 0.820361912f},
-std::array<float,2>{0.638102412f, 0.0596496239f},
-std::array<float,2>{0.0272093527f, 0.20771569f},
-std::array<float,2>{0.616016984f, 0.970405281f},
-std::array<float,2>{0.304316789f, 0.58999002f},
-std::array<float,2>{0.988004148f, 0.254485756f},
-std::array<float,2>{0.289126337f, 0.227981716f},
-std::array<float,2>{0.969603002f, 0.965221047f},
-std::array<float,2>{0.00385051896f, 0.59599787f},
-std::array<float,2>{0.606930614f, 0.310464919f},
-std::array<float,2>{0.208700493f, 0.441026717f},
-std::array<float,2>{0.641980231f, 0.690667689f},
-std::array<float,2>{0.48309198f, 0.85179919f},
-std::array<float,2>{0.760671616f, 0.00939605292f},
-std::array<float,2>{0.401420176f, 0.323051512f},
-std::array<float,2>{0.866388381f, 0.525529325f},
-std::array<float,2>{0.128003225f, 0.885402322f},
-std::array<float,2>{0.746345282f, 0.17191565f},
-std::array<float,2>{0.0668825805f, 0.0753776506f},
-std::array<float,2>{0.549945176f, 0.796305299f},
-std::array<float,2>{0.346812487f, 0.661261678f},
-std::array<float,2>{0.929999888f, 0.406338871f},
-std::array<float,2>{0.440983415f, 0.0465041213f},
-std::array<float,2>{0.79774493f, 0.831202507f},
-std::array<float,2>{0.223498151f, 0.749559879f},
-std::array<float,2>{0.660710216f, 0.489684284f},
-std::array<float,2>{0.0420441143f, 0.270325154f},
-std::array<float,2>{0.566333175f, 0.571139276f},
-std::array<float,2>{0.265242308f, 0.985610127f},
-std::array<float,2>{0.940102339f, 0.198535904f},
-std::array<float,2>{0.336026162f, 0.399253994f},
-std::array<float,2>{0.876536906f, 0.650939882f},
-std::array<float,2>{0.123814158f, 0.775835037f},
-std::array<float,2>{0.523513734f, 0.121647507f},
-std::array<float,2>{0.164479569f, 0.148590103f},
-std::array<float,2>{0.691942632f, 0.920178056f},
-std::array<float,2>{0.408248514f, 0.545163572f},
-std::array<float,2>{0.821908891f, 0.35000661f},
-std::array<float,2>{0.464231789f, 0.142555505f},
-std::array<float,2>{0.78194654f, 0.912712395f},
-std::array<float,2>{0.241086945f, 0.536793172f},
-std::array<float,2>{0.67519027f, 0.357363939f},
-std::array<float,2>{0.0475401618f, 0.39833352f},
-std::array<float,2>{0.586635649f, 0.642027378f},
-std::array<float,2>{0.275425643f, 0.765773535f},
-std::array<float,2>{0.963809431f, 0.112035863f},
-std::array<float,2>{0.315414459f, 0.2761814f},
-std::array<float,2>{0.904671788f, 0.569307268f},
-std::array<float,2>{0.0937956348f, 0.994961441f},
-std::array<float,2>{0.515083194f, 0.190020993f},
-std::array<float,2>{0.186664075f, 0.0339149758f},
-std::array<float,2>{0.71802932f, 0.8407287f},
-std::array<float,2>{0.426322401f, 0.735193133f},
-std::array<float,2>{0.829484999f, 0.497421443f},
-std::array<float,2>{0.297182769f, 0.0631590188f},
-std::array<float,2>{0.991664708f, 0.781318843f},
-std::array<float,2>{0.0299892817f, 0.669925869f},
-std::array<float,2>{0.611950517f, 0.419607788f},
-std::array<float,2>{0.187848508f, 0.31711325f},
-std::array<float,2>{0.634117007f, 0.521438479f},
-std::array<float,2>{0.48486799f, 0.881357491f},
-std::array<float,2>{0.777762294f, 0.180419505f},
-std::array<float,2>{0.3814978f, 0.449623019f},
-std::array<float,2>{0.851649761f, 0.696592152f},
-std::array<float,2>{0.148629963f, 0.847584009f},
-std::array<float,2>{0.727017701f, 0.00766479271f},
-std::array<float,2>{0.0927482396f, 0.218979582f},
-std::array<float,2>{0.532806396f, 0.956914067f},
-std::array<float,2>{0.368811965f, 0.607169092f},
-std::array<float,2>{0.918001175f, 0.299053907f},
-std::array<float,2>{0.347682863f, 0.214640662f},
-std::array<float,2>{0.934124947f, 0.981653035f},
-std::array<float,2>{0.0636506751f, 0.580240011f},
-std::array<float,2>{0.554137528f, 0.263833106f},
-std::array<float,2>{0.129932061f, 0.479614526f},
-std::array<float,2>{0.744089246f, 0.727064431f},
-std::array<float,2>{0.406044453f, 0.813685834f},
-std::array<float,2>{0.863251448f, 0.0474172495f},
-std::array<float,2>{0.479574144f, 0.362883955f},
-std::array<float,2>{0.763592064f, 0.551961362f},
-std::array<float,2>{0.206312865f, 0.932278395f},
-std::array<float,2>{0.648391545f, 0.129370227f},
-std::array<float,2>{0.00598342437f, 0.0981759652f},
-std::array<float,2>{0.603415787f, 0.750224352f},
-std::array<float,2>{0.295654863f, 0.626952112f},
-std::array<float,2>{0.973260224f, 0.37907356f},
-std::array<float,2>{0.413495094f, 0.0309360791f},
-std::array<float,2>{0.824547708f, 0.87095809f},
-std::array<float,2>{0.16914314f, 0.706355751f},
-std::array<float,2>{0.687955439f, 0.458060384f},
-std::array<float,2>{0.120276943f, 0.293663174f},
-std::array<float,2>{0.528837264f, 0.609927595f},
-std::array<float,2>{0.343224257f, 0.938591719f},
-std::array<float,2>{0.879556417f, 0.243143499f},
-std::array<float,2>{0.261142462f, 0.43555823f},
-std::array<float,2>{0.941821337f, 0.686153829f},
-std::array<float,2>{0.0466829203f, 0.810381413f},
-std::array<float,2>{0.56824857f, 0.0918488875f},
-std::array<float,2>{0.219598234f, 0.169573069f},
-std::array<float,2>{0.658490121f, 0.904002309f},
-std::array<float,2>{0.443453193f, 0.51186353f},
-std::array<float,2>{0.804019034f, 0.337885886f},
-std::array<float,2>{0.395127177f, 0.241330236f},
-std::array<float,2>{0.874111652f, 0.951171279f},
-std::array<float,2>{0.138026342f, 0.617280066f},
-std::array<float,2>{0.740930021f, 0.286288291f},
-std::array<float,2>{0.071254991f, 0.465735912f},
-std::array<float,2>{0.555826664f, 0.716196537f},
-std::array<float,2>{0.353197157f, 0.863660216f},
-std::array<float,2>{0.923277259f, 0.0226275157f},
-std::array<float,2>{0.287784129f, 0.329094499f},
-std::array<float,2>{0.976773262f, 0.503424346f},
-std::array<float,2>{0.0080094412f, 0.89473784f},
-std::array<float,2>{0.601224422f, 0.161411256f},
-std::array<float,2>{0.21637553f, 0.0810368657f},
-std::array<float,2>{0.649924755f, 0.801662683f},
-std::array<float,2>{0.474135637f, 0.679365933f},
-std::array<float,2>{0.754350424f, 0.424460411f},
-std::array<float,2>{0.329629928f, 0.0555502437f},
-std::array<float,2>{0.889844477f, 0.826721847f},
-std::array<float,2>{0.115427591f, 0.719672441f},
-std::array<float,2>{0.523012877f, 0.471291751f},
-std::array<float,2>{0.161065444f, 0.251003802f},
-std::array<float,2>{0.697119951f, 0.587738574f},
-std::array<float,2>{0.419320941f, 0.972895503f},
-std::array<float,2>{0.817186117f, 0.206999987f},
-std::array<float,2>{0.452808172f, 0.389662772f},
-std::array<float,2>{0.810763121f, 0.639959931f},
-std::array<float,2>{0.229904592f, 0.763375819f},
-std::array<float,2>{0.667617202f, 0.105092704f},
-std::array<float,2>{0.037341699f, 0.135152638f},
-std::array<float,2>{0.572018564f, 0.925760567f},
-std::array<float,2>{0.251342803f, 0.560576141f},
-std::array<float,2>{0.946011901f, 0.3732858f},
-std::array<float,2>{0.268487036f, 0.178247526f},
-std::array<float,2>{0.959492385f, 0.886741161f},
-std::array<float,2>{0.0550585985f, 0.530999482f},
-std::array<float,2>{0.581351638f, 0.32562694f},
-std::array<float,2>{0.244700015f, 0.412777573f},
-std::array<float,2>{0.681528509f, 0.657149076f},
-std::array<float,2>{0.458328545f, 0.791499376f},
-std::array<float,2>{0.793283105f, 0.0715594739f},
-std::array<float,2>{0.432610691f, 0.306137204f},
-std::array<float,2>{0.83893317f, 0.59788543f},
-std::array<float,2>{0.173309341f, 0.963953674f},
-std::array<float,2>{0.709462523f, 0.23130849f},
-std::array<float,2>{0.108655468f, 0.0137185631f},
-std::array<float,2>{0.50480026f, 0.858041823f},
-std::array<float,2>{0.325857133f, 0.692525685f},
-std::array<float,2>{0.893791854f, 0.441836387f},
-std::array<float,2>{0.497270495f, 0.11782933f},
-std::array<float,2>{0.770717561f, 0.780215681f},
-std::array<float,2>{0.202530771f, 0.65280509f},
-std::array<float,2>{0.625578761f, 0.404999316f},
-std::array<float,2>{0.0224759765f, 0.346197784f},
-std::array<float,2>{0.620362163f, 0.54172653f},
-std::array<float,2>{0.305691242f, 0.916378617f},
-std::array<float,2>{0.992830455f, 0.152712658f},
-std::array<float,2>{0.364545286f, 0.484738588f},
-std::array<float,2>{0.90835923f, 0.745895326f},
-std::array<float,2>{0.078315407f, 0.833372712f},
-std::array<float,2>{0.543599129f, 0.0391429961f},
-std::array<float,2>{0.145181298f, 0.202803537f},
-std::array<float,2>{0.721396327f, 0.992007256f},
-std::array<float,2>{0.387140304f, 0.578057647f},
-std::array<float,2>{0.851325989f, 0.269217908f},
-std::array<float,2>{0.482713431f, 0.228683323f},
-std::array<float,2>{0.760077357f, 0.968521833f},
-std::array<float,2>{0.208280012f, 0.594393015f},
-std::array<float,2>{0.64228338f, 0.311448663f},
-std::array<float,2>{0.00303936005f, 0.438344479f},
-std::array<float,2>{0.607188106f, 0.687807977f},
-std::array<float,2>{0.289974809f, 0.854768932f},
-std::array<float,2>{0.968831837f, 0.0104611022f},
-std::array<float,2>{0.347234756f, 0.320610613f},
-std::array<float,2>{0.930427492f, 0.524361193f},
-std::array<float,2>{0.0671140403f, 0.883363426f},
-std::array<float,2>{0.550446272f, 0.175242424f},
-std::array<float,2>{0.128844783f, 0.0770220011f},
-std::array<float,2>{0.747005641f, 0.793401301f},
-std::array<float,2>{0.402189374f, 0.663364232f},
-std::array<float,2>{0.86714524f, 0.409339607f},
-std::array<float,2>{0.264753878f, 0.0448322073f},
-std::array<float,2>{0.939521849f, 0.829172432f},
-std::array<float,2>{0.0429416262f, 0.747955024f},
-std::array<float,2>{0.565483034f, 0.492131293f},
-std::array<float,2>{0.223050594f, 0.271820635f},
-std::array<float,2>{0.660494328f, 0.572762907f},
-std::array<float,2>{0.440803945f, 0.98814255f},
-std::array<float,2>{0.797166109f, 0.196438462f},
-std::array<float,2>{0.409040362f, 0.400905579f},
-std::array<float,2>{0.821525812f, 0.649469197f},
-std::array<float,2>{0.164694741f, 0.774290264f},
-std::array<float,2>{0.69188863f, 0.124306276f},
-std::array<float,2>{0.123474978f, 0.150678888f},
-std::array<float,2>{0.52441299f, 0.91986835f},
-std::array<float,2>{0.336481065f, 0.544049203f},
-std::array<float,2>{0.87614131f, 0.349285871f},
-std::array<float,2>{0.316474795f, 0.159275487f},
-std::array<float,2>{0.900394082f, 0.894493937f},
-std::array<float,2>{0.0996184498f, 0.50566262f},
-std::array<float,2>{0.511670589f, 0.333267063f},
-std::array<float,2>{0.180563018f, 0.427731484f},
-std::array<float,2>{0.711319625f, 0.672853112f},
-std::array<float,2>{0.422912836f, 0.799245298f},
-std::array<float,2>{0.835703313f, 0.0844862014f},
-std::array<float,2>{0.464887083f, 0.284980148f},
-std::array<float,2>{0.788603604f, 0.624842167f},
-std::array<float,2>{0.234887719f, 0.946133018f},
-std::array<float,2>{0.679497063f, 0.236707345f},
-std::array<float,2>{0.0517650023f, 0.0163431596f},
-std::array<float,2>{0.591699362f, 0.860558093f},
-std::array<float,2>{0.279493451f, 0.711541712f},
-std::array<float,2>{0.967379332f, 0.463979214f},
-std::array<float,2>{0.375809968f, 0.10804671f},
-std::array<float,2>{0.857645333f, 0.760908425f},
-std::array<float,2>{0.154149905f, 0.635699749f},
-std::array<float,2>{0.732753575f, 0.38601312f},
-std::array<float,2>{0.0869795606f, 0.369511038f},
-std::array<float,2>{0.538451612f, 0.5573138f},
-std::array<float,2>{0.371231765f, 0.928748965f},
-std::array<float,2>{0.916562676f, 0.138396338f},
-std::array<float,2>{0.303769618f, 0.476562202f},
-std::array<float,2>{0.987468481f, 0.724698484f},
-std::array<float,2>{0.026718447f, 0.824217618f},
-std::array<float,2>{0.615467191f, 0.0605726056f},
-std::array<float,2>{0.193730637f, 0.209894165f},
-std::array<float,2>{0.638210058f, 0.9716236f},
-std::array<float,2>{0.489850402f, 0.592897534f},
-std::array<float,2>{0.776407838f, 0.257636726f},
-std::array<float,2>{0.435580969f, 0.125046581f},
-std::array<float,2>{0.841598213f, 0.936465085f},
-std::array<float,2>{0.177494213f, 0.550673664f},
-std::array<float,2>{0.705694556f, 0.364819139f},
-std::array<float,2>{0.104585029f, 0.377708644f},
-std::array<float,2>{0.500508785f, 0.630153477f},
-std::array<float,2>{0.322986841f, 0.756901801f},
-std::array<float,2>{0.897513211f, 0.095340535f},
-std::array<float,2>{0.272526771f, 0.260557383f},
-std::array<float,2>{0.956710219f, 0.584640503f},
-std::array<float,2>{0.059105143f, 0.97657162f},
-std::array<float,2>{0.583816111f, 0.216300711f},
-std::array<float,2>{0.24906908f, 0.0535256118f},
-std::array<float,2>{0.685945094f, 0.817203224f},
-std::array<float,2>{0.457020879f, 0.732396841f},
-std::array<float,2>{0.79232347f, 0.483397573f},
-std::array<float,2>{0.362229645f, 0.0890230685f},
-std::array<float,2>{0.91082567f, 0.805511594f},
-std::array<float,2>{0.0830980241f, 0.679865003f},
-std::array<float,2>{0.539461076f, 0.431629717f},
-std::array<float,2>{0.141576976f, 0.341795653f},
-std::array<float,2>{0.724857271f, 0.509639621f},
-std::array<float,2>{0.385927379f, 0.899487972f},
-std::array<float,2>{0.844483376f, 0.166774973f},
-std::array<float,2>{0.492908359f, 0.456410646f},
-std::array<float,2>{0.769346118f, 0.707623065f},
-std::array<float,2>{0.196792692f, 0.872811913f},
-std::array<float,2>{0.629273355f, 0.0244088117f},
-std::array<float,2>{0.0190460738f, 0.247018799f},
-std::array<float,2>{0.624288082f, 0.942279339f},
-std::array<float,2>{0.310982168f, 0.615151584f},
-std::array<float,2>{0.996734977f, 0.289402544f},
-std::array<float,2>{0.28481847f, 0.19360356f},
-std::array<float,2>{0.980922341f, 0.999826431f},
-std::array<float,2>{0.0123441946f, 0.563316762f},
-std::array<float,2>{0.597384214f, 0.279572368f},
-std::array<float,2>{0.213382259f, 0.495366484f},
-std::array<float,2>{0.653012633f, 0.739551067f},
-std::array<float,2>{0.468874693f, 0.836398244f},
-std::array<float,2>{0.753356397f, 0.0370134898f},
-std::array<float,2>{0.392380446f, 0.352950573f},
-std::array<float,2>{0.86891526f, 0.53215915f},
-std::array<float,2>{0.134016231f, 0.906334341f},
-std::array<float,2>{0.735362589f, 0.147926301f},
-std::array<float,2>{0.0779454485f, 0.116874136f},
-std::array<float,2>{0.559693873f, 0.770632088f},
-std::array<float,2>{0.358762801f, 0.647995889f},
-std::array<float,2>{0.928822696f, 0.392633289f},
-std::array<float,2>{0.446503967f, 0.00383191812f},
-std::array<float,2>{0.805579901f, 0.849678755f},
-std::array<float,2>{0.234036908f, 0.700137317f},
-std::array<float,2>{0.670066893f, 0.447433949f},
-std::array<float,2>{0.0313879363f, 0.301967621f},
-std::array<float,2>{0.575320721f, 0.60426569f},
-std::array<float,2>{0.256506652f, 0.957694352f},
-std::array<float,2>{0.952569783f, 0.222769529f},
-std::array<float,2>{0.332134157f, 0.417793006f},
-std::array<float,2>{0.883808553f, 0.667597592f},
-std::array<float,2>{0.111537248f, 0.786324143f},
-std::array<float,2>{0.515698552f, 0.0671202317f},
-std::array<float,2>{0.157852694f, 0.186760768f},
-std::array<float,2>{0.700439453f, 0.878042281f},
-std::array<float,2>{0.416791141f, 0.515661597f},
-std::array<float,2>{0.814190269f, 0.312885851f},
-std::array<float,2>{0.458627433f, 0.177490264f},
-std::array<float,2>{0.79366684f, 0.890350759f},
-std::array<float,2>{0.244417429f, 0.528580844f},
-std::array<float,2>{0.681014359f, 0.327354401f},
-std::array<float,2>{0.0554557927f, 0.412105203f},
-std::array<float,2>{0.58176446f, 0.658218324f},
-std::array<float,2>{0.267639339f, 0.789182186f},
-std::array<float,2>{0.95936197f, 0.0730565116f},
-std::array<float,2>{0.325447291f, 0.306741059f},
-std::array<float,2>{0.894327223f, 0.600950718f},
-std::array<float,2>{0.109115586f, 0.962158263f},
-std::array<float,2>{0.503960133f, 0.232725322f},
-std::array<float,2>{0.173732311f, 0.0126509639f},
-std::array<float,2>{0.709936142f, 0.857345104f},
-std::array<float,2>{0.431774944f, 0.694467247f},
-std::array<float,2>{0.839367807f, 0.443621129f},
-std::array<float,2>{0.306617409f, 0.120443054f},
-std::array<float,2>{0.992596805f, 0.778942525f},
-std::array<float,2>{0.023307234f, 0.655029476f},
-std::array<float,2>{0.620744646f, 0.403885216f},
-std::array<float,2>{0.202762917f, 0.344732493f},
-std::array<float,2>{0.62504375f, 0.539680302f},
-std::array<float,2>{0.497817665f, 0.914788306f},
-std::array<float,2>{0.771379769f, 0.155606374f},
-std::array<float,2>{0.387338638f, 0.486568213f},
-std::array<float,2>{0.850799918f, 0.743942916f},
-std::array<float,2>{0.144636959f, 0.834169447f},
-std::array<float,2>{0.721013069f, 0.0410722643f},
-std::array<float,2>{0.0786537454f, 0.200356275f},
-std::array<float,2>{0.543328822f, 0.989790916f},
-std::array<float,2>{0.365162462f, 0.574779868f},
-std::array<float,2>{0.909034789f, 0.266183466f},
-std::array<float,2>{0.353000611f, 0.239987686f},
-std::array<float,2>{0.923666596f, 0.952133954f},
-std::array<float,2>{0.0707071945f, 0.620400071f},
-std::array<float,2>{0.556235194f, 0.288885117f},
-std::array<float,2>{0.13860777f, 0.46799159f},
-std::array<float,2>{0.740435302f, 0.717426836f},
-std::array<float,2>{0.394628823f, 0.865909696f},
-std::array<float,2>{0.874818683f, 0.0209789909f},
-std::array<float,2>{0.474053502f, 0.330296844f},
-std::array<float,2>{0.754774749f, 0.501304626f},
-std::array<float,2>{0.21590133f, 0.897341549f},
-std::array<float,2>{0.649712503f, 0.163836032f},
-std::array<float,2>{0.00872750953f, 0.079671599f},
-std::array<float,2>{0.600941241f, 0.803286612f},
-std::array<float,2>{0.28727439f, 0.677411079f},
-std::array<float,2>{0.97713089f, 0.422301054f},
-std::array<float,2>{0.419868261f, 0.0579572842f},
-std::array<float,2>{0.816578984f, 0.825021684f},
-std::array<float,2>{0.160540059f, 0.722650647f},
-std::array<float,2>{0.696422279f, 0.469640583f},
-std::array<float,2>{0.115935765f, 0.253698289f},
-std::array<float,2>{0.522858262f, 0.588317394f},
-std::array<float,2>{0.329531938f, 0.975056589f},
-std::array<float,2>{0.890585661f, 0.20474723f},
-std::array<float,2>{0.251880914f, 0.388019234f},
-std::array<float,2>{0.945381641f, 0.637907326f},
-std::array<float,2>{0.0376354456f, 0.764911532f},
-std::array<float,2>{0.57167393f, 0.102824315f},
-std::array<float,2>{0.23044166f, 0.133780807f},
-std::array<float,2>{0.667018175f, 0.922049463f},
-std::array<float,2>{0.452462196f, 0.559614062f},
-std::array<float,2>{0.811182976f, 0.37121731f},
-std::array<float,2>{0.405635118f, 0.21285741f},
-std::array<float,2>{0.8627069f, 0.98308593f},
-std::array<float,2>{0.130540401f, 0.57929045f},
-std::array<float,2>{0.743239582f, 0.262406081f},
-std::array<float,2>{0.0641676113f, 0.476771623f},
-std::array<float,2>{0.554421127f, 0.728905439f},
-std::array<float,2>{0.348438144f, 0.814957619f},
-std::array<float,2>{0.933795929f, 0.0495573319f},
-std::array<float,2>{0.295313865f, 0.359383732f},
-std::array<float,2>{0.973023832f, 0.554282367f},
-std::array<float,2>{0.00641831942f, 0.930836618f},
-std::array<float,2>{0.60255605f, 0.131386876f},
-std::array<float,2>{0.206986398f, 0.0996097103f},
-std::array<float,2>{0.647498012f, 0.752013326f},
-std::array<float,2>{0.480046242f, 0.627532542f},
-std::array<float,2>{0.762759686f, 0.382557988f},
-std::array<float,2>{0.343553424f, 0.0275707282f},
-std::array<float,2>{0.879304409f, 0.868708193f},
-std::array<float,2>{0.12100479f, 0.703558862f},
-std::array<float,2>{0.528756261f, 0.459726661f},
-std::array<float,2>{0.169693112f, 0.294996589f},
-std::array<float,2>{0.688112736f, 0.61199826f},
-std::array<float,2>{0.413840592f, 0.939562201f},
-std::array<float,2>{0.824902892f, 0.245264262f},
-std::array<float,2>{0.444020897f, 0.435216308f},
-std::array<float,2>{0.804360449f, 0.684262455f},
-std::array<float,2>{0.21923025f, 0.812159061f},
-std::array<float,2>{0.658983648f, 0.0910961926f},
-std::array<float,2>{0.0460494272f, 0.170620009f},
-std::array<float,2>{0.567752421f, 0.905854583f},
-std::array<float,2>{0.261599153f, 0.514572561f},
-std::array<float,2>{0.942086697f, 0.338266432f},
-std::array<float,2>{0.275891185f, 0.14355354f},
-std::array<float,2>{0.96310842f, 0.910379291f},
-std::array<float,2>{0.0472376421f, 0.538615108f},
-std::array<float,2>{0.586157084f, 0.358057469f},
-std::array<float,2>{0.240494639f, 0.39596805f},
-std::array<float,2>{0.67567575f, 0.643459737f},
-std::array<float,2>{0.46473965f, 0.768152416f},
-std::array<float,2>{0.781590521f, 0.109836854f},
-std::array<float,2>{0.425853878f, 0.273454815f},
-std::array<float,2>{0.829812706f, 0.566618562f},
-std::array<float,2>{0.187417403f, 0.992539942f},
-std::array<float,2>{0.718707502f, 0.18852213f},
-std::array<float,2>{0.0944622904f, 0.0331390761f},
-std::array<float,2>{0.515361428f, 0.842810333f},
-std::array<float,2>{0.314531356f, 0.736448526f},
-std::array<float,2>{0.905206084f, 0.499754429f},
-std::array<float,2>{0.484680682f, 0.0648197979f},
-std::array<float,2>{0.777891934f, 0.78363353f},
-std::array<float,2>{0.18811956f, 0.669605911f},
-std::array<float,2>{0.634639204f, 0.42075792f},
-std::array<float,2>{0.0292988699f, 0.319148719f},
-std::array<float,2>{0.611594737f, 0.52319032f},
-std::array<float,2>{0.297722459f, 0.87898773f},
-std::array<float,2>{0.991933584f, 0.182116196f},
-std::array<float,2>{0.368474543f, 0.451479733f},
-std::array<float,2>{0.918588877f, 0.699048579f},
-std::array<float,2>{0.0920251533f, 0.845052958f},
-std::array<float,2>{0.532713056f, 0.00497828331f},
-std::array<float,2>{0.149395287f, 0.222431958f},
-std::array<float,2>{0.727279484f, 0.955017149f},
-std::array<float,2>{0.380940527f, 0.607740819f},
-std::array<float,2>{0.852175593f, 0.29869175f},
-std::array<float,2>{0.43782419f, 0.198872134f},
-std::array<float,2>{0.799252748f, 0.985958755f},
-std::array<float,2>{0.225795388f, 0.570634067f},
-std::array<float,2>{0.663848639f, 0.269922167f},
-std::array<float,2>{0.0391427167f, 0.489836067f},
-std::array<float,2>{0.564125359f, 0.7493487f},
-std::array<float,2>{0.263014495f, 0.831837714f},
-std::array<float,2>{0.937976539f, 0.0463605747f},
-std::array<float,2>{0.339648306f, 0.350256234f},
-std::array<float,2>{0.877162278f, 0.54567349f},
-std::array<float,2>{0.121925257f, 0.920620441f},
-std::array<float,2>{0.526162326f, 0.149219096f},
-std::array<float,2>{0.167788655f, 0.121435605f},
-std::array<float,2>{0.694065452f, 0.77616179f},
-std::array<float,2>{0.406974375f, 0.65076071f},
-std::array<float,2>{0.824202836f, 0.398914218f},
-std::array<float,2>{0.292171627f, 0.00920053571f},
-std::array<float,2>{0.972240269f, 0.852494597f},
-std::array<float,2>{0.00119029125f, 0.691008806f},
-std::array<float,2>{0.607947528f, 0.440579593f},
-std::array<float,2>{0.210365772f, 0.310055733f},
-std::array<float,2>{0.643770278f, 0.596366763f},
-std::array<float,2>{0.482208997f, 0.965580642f},
-std::array<float,2>{0.757853985f, 0.228192672f},
-std::array<float,2>{0.399050504f, 0.40719375f},
-std::array<float,2>{0.863443911f, 0.661809146f},
-std::array<float,2>{0.126362488f, 0.79644537f},
-std::array<float,2>{0.748758852f, 0.0758550093f},
-std::array<float,2>{0.0696321353f, 0.172695994f},
-std::array<float,2>{0.546943426f, 0.885025859f},
-std::array<float,2>{0.344201833f, 0.526333392f},
-std::array<float,2>{0.933249712f, 0.322713941f},
-std::array<float,2>{0.373870432f, 0.13871327f},
-std::array<float,2>{0.914201975f, 0.926961422f},
-std::array<float,2>{0.0884067044f, 0.556607366f},
-std::array<float,2>{0.536517143f, 0.368499666f},
-std::array<float,2>{0.155417085f, 0.38403213f},
-std::array<float,2>{0.731238604f, 0.633134544f},
-std::array<float,2>{0.378411353f, 0.759308338f},
-std::array<float,2>{0.855729222f, 0.106804177f},
-std::array<float,2>{0.492090583f, 0.254137218f},
-std::array<float,2>{0.774664164f, 0.590339601f},
-std::array<float,2>{0.192805871f, 0.970113218f},
-std::array<float,2>{0.639680982f, 0.207499072f},
-std::array<float,2>{0.0236316826f, 0.0601036139f},
-std::array<float,2>{0.614991665f, 0.820921957f},
-std::array<float,2>{0.302048236f, 0.724027395f},
-std::array<float,2>{0.985016644f, 0.473335594f},
-std::array<float,2>{0.424471587f, 0.0821145102f},
-std::array<float,2>{0.83338362f, 0.797208846f},
-std::array<float,2>{0.182689711f, 0.674902856f},
-std::array<float,2>{0.713520467f, 0.429016173f},
-std::array<float,2>{0.0983028188f, 0.335649133f},
-std::array<float,2>{0.508190155f, 0.507490277f},
-std::array<float,2>{0.320026696f, 0.891595423f},
-std::array<float,2>{0.899171174f, 0.156341583f},
-std::array<float,2>{0.278879195f, 0.462700814f},
-std::array<float,2>{0.965436101f, 0.713062823f},
-std::array<float,2>{0.0531020239f, 0.862029374f},
-std::array<float,2>{0.593534529f, 0.0194856748f},
-std::array<float,2>{0.237820849f, 0.235764414f},
-std::array<float,2>{0.677313864f, 0.947348714f},
-std::array<float,2>{0.467077523f, 0.621113062f},
-std::array<float,2>{0.7860201f, 0.282301128f},
-std::array<float,2>{0.384087831f, 0.165394843f},
-std::array<float,2>{0.847605646f, 0.900657892f},
-std::array<float,2>{0.143832177f, 0.510125756f},
-std::array<float,2>{0.723450601f, 0.342735738f},
-std::array<float,2>{0.0847729743f, 0.433279783f},
-std::array<float,2>{0.54143697f, 0.682892084f},
-std::array<float,2>{0.360219151f, 0.808225453f},
-std::array<float,2>{0.912419736f, 0.0874862969f},
-std::array<float,2>{0.30961448f, 0.292578936f},
-std::array<float,2>{0.999521196f, 0.616498888f},
-std::array<float,2>{0.0175217818f, 0.9445436f},
-std::array<float,2>{0.621112049f, 0.248395011f},
-std::array<float,2>{0.198257282f, 0.0264548771f},
-std::array<float,2>{0.631241024f, 0.873639405f},
-std::array<float,2>{0.495365858f, 0.710687518f},
-std::array<float,2>{0.767087877f, 0.454704851f},
-std::array<float,2>{0.320322514f, 0.0970453471f},
-std::array<float,2>{0.895900786f, 0.75411725f},
-std::array<float,2>{0.102257937f, 0.630942941f},
-std::array<float,2>{0.502102852f, 0.375439823f},
-std::array<float,2>{0.179171547f, 0.366295934f},
-std::array<float,2>{0.704428375f, 0.548162162f},
-std::array<float,2>{0.435416549f, 0.934080184f},
-std::array<float,2>{0.84332937f, 0.128126547f},
-std::array<float,2>{0.454681873f, 0.481689036f},
-std::array<float,2>{0.790318012f, 0.732665777f},
-std::array<float,2>{0.247891247f, 0.819358826f},
-std::array<float,2>{0.685483813f, 0.0521307625f},
-std::array<float,2>{0.0612586401f, 0.217587456f},
-std::array<float,2>{0.584631145f, 0.978878617f},
-std::array<float,2>{0.271079779f, 0.582996964f},
-std::array<float,2>{0.954795063f, 0.25974679f},
-std::array<float,2>{0.255181462f, 0.225196511f},
-std::array<float,2>{0.949839354f, 0.960037589f},
-std::array<float,2>{0.0351499133f, 0.602407634f},
-std::array<float,2>{0.577612042f, 0.303592473f},
-std::array<float,2>{0.231121704f, 0.446514338f},
-std::array<float,2>{0.668328524f, 0.702398062f},
-std::array<float,2>{0.447552681f, 0.849460185f},
-std::array<float,2>{0.80707258f, 0.00181503664f},
-std::array<float,2>{0.41544494f, 0.314584106f},
-std::array<float,2>{0.815545022f, 0.517771065f},
-std::array<float,2>{0.159983009f, 0.875718594f},
-std::array<float,2>{0.701180816f, 0.184785664f},
-std::array<float,2>{0.110693f, 0.0696811676f},
-std::array<float,2>{0.518250048f, 0.78834945f},
-std::array<float,2>{0.334193558f, 0.664170265f},
-std::array<float,2>{0.884942114f, 0.414568961f},
-std::array<float,2>{0.471710622f, 0.037415076f},
-std::array<float,2>{0.75133729f, 0.838825464f},
-std::array<float,2>{0.211161286f, 0.741200268f},
-std::array<float,2>{0.656020403f, 0.492649287f},
-std::array<float,2>{0.0144069465f, 0.279076129f},
-std::array<float,2>{0.594283164f, 0.566357732f},
-std::array<float,2>{0.282984793f, 0.996359706f},
-std::array<float,2>{0.984039545f, 0.192592263f},
-std::array<float,2>{0.356694251f, 0.390746981f},
-std::array<float,2>{0.927009583f, 0.644972205f},
-std::array<float,2>{0.0748253614f, 0.772649705f},
-std::array<float,2>{0.560999393f, 0.113538869f},
-std::array<float,2>{0.135566473f, 0.144660622f},
-std::array<float,2>{0.736531019f, 0.908596933f},
-std::array<float,2>{0.39366582f, 0.534785926f},
-std::array<float,2>{0.869451344f, 0.354844481f},
-std::array<float,2>{0.499278456f, 0.153117463f},
-std::array<float,2>{0.771598518f, 0.916715562f},
-std::array<float,2>{0.199464917f, 0.541312933f},
-std::array<float,2>{0.62862277f, 0.346149772f},
-std::array<float,2>{0.0212772302f, 0.4044424f},
-std::array<float,2>{0.618391693f, 0.653184354f},
-std::array<float,2>{0.307077676f, 0.779702187f},
-std::array<float,2>{0.995250523f, 0.117445879f},
-std::array<float,2>{0.365629286f, 0.268957555f},
-std::array<float,2>{0.907545567f, 0.577336669f},
-std::array<float,2>{0.0819868371f, 0.991521716f},
-std::array<float,2>{0.546228886f, 0.202465311f},
-std::array<float,2>{0.146950185f, 0.0396279953f},
-std::array<float,2>{0.72050333f, 0.833717883f},
-std::array<float,2>{0.389807045f, 0.745344877f},
-std::array<float,2>{0.848857164f, 0.485247284f},
-std::array<float,2>{0.267256081f, 0.07200104f},
-std::array<float,2>{0.958580911f, 0.791826189f},
-std::array<float,2>{0.0584265292f, 0.656392217f},
-std::array<float,2>{0.578783453f, 0.412126303f},
-std::array<float,2>{0.243363991f, 0.325804412f},
-std::array<float,2>{0.6830585f, 0.530585289f},
-std::array<float,2>{0.460430205f, 0.887589753f},
-std::array<float,2>{0.796064496f, 0.17794697f},
-std::array<float,2>{0.429813385f, 0.442160189f},
-std::array<float,2>{0.836771607f, 0.692940235f},
-std::array<float,2>{0.175247699f, 0.85788846f},
-std::array<float,2>{0.707679451f, 0.0146390954f},
-std::array<float,2>{0.106816709f, 0.23093082f},
-std::array<float,2>{0.507593453f, 0.964633226f},
-std::array<float,2>{0.328123391f, 0.59824729f},
-std::array<float,2>{0.891896129f, 0.306310803f},
-std::array<float,2>{0.330723763f, 0.206445739f},
-std::array<float,2>{0.887033105f, 0.973294973f},
-std::array<float,2>{0.11488463f, 0.587040424f},
-std::array<float,2>{0.520018995f, 0.251700073f},
-std::array<float,2>{0.163864389f, 0.471073747f},
-std::array<float,2>{0.698467851f, 0.719090343f},
-std::array<float,2>{0.420027256f, 0.826238871f},
-std::array<float,2>{0.818903208f, 0.0549680069f},
-std::array<float,2>{0.451084942f, 0.373877108f},
-std::array<float,2>{0.808707535f, 0.561455131f},
-std::array<float,2>{0.228155196f, 0.925064564f},
-std::array<float,2>{0.6658113f, 0.135677323f},
-std::array<float,2>{0.0351580791f, 0.104555644f},
-std::array<float,2>{0.572840989f, 0.763084412f},
-std::array<float,2>{0.253201365f, 0.640227973f},
-std::array<float,2>{0.948560476f, 0.39056173f},
-std::array<float,2>{0.397827864f, 0.0230292212f},
-std::array<float,2>{0.872087657f, 0.864076674f},
-std::array<float,2>{0.13952814f, 0.716427445f},
-std::array<float,2>{0.739144623f, 0.465236545f},
-std::array<float,2>{0.0733150169f, 0.286796689f},
-std::array<float,2>{0.557635069f, 0.617875516f},
-std::array<float,2>{0.355005026f, 0.950451434f},
-std::array<float,2>{0.924866736f, 0.24171643f},
-std::array<float,2>{0.286663771f, 0.424159318f},
-std::array<float,2>{0.978684187f, 0.679096997f},
-std::array<float,2>{0.0107786246f, 0.801243305f},
-std::array<float,2>{0.598184645f, 0.0804359987f},
-std::array<float,2>{0.217744529f, 0.162056029f},
-std::array<float,2>{0.650708616f, 0.895336986f},
-std::array<float,2>{0.474901646f, 0.503246725f},
-std::array<float,2>{0.75689435f, 0.328555167f},
-std::array<float,2>{0.411279798f, 0.242245138f},
-std::array<float,2>{0.826786935f, 0.939284146f},
-std::array<float,2>{0.171513334f, 0.609835327f},
-std::array<float,2>{0.690583229f, 0.293308765f},
-std::array<float,2>{0.117554516f, 0.458577156f},
-std::array<float,2>{0.529661536f, 0.707001448f},
-std::array<float,2>{0.340986997f, 0.87056303f},
-std::array<float,2>{0.881618738f, 0.0307242889f},
-std::array<float,2>{0.257889569f, 0.337312192f},
-std::array<float,2>{0.944018126f, 0.512596488f},
-std::array<float,2>{0.0437585004f, 0.903546274f},
-std::array<float,2>{0.569816947f, 0.16929391f},
-std::array<float,2>{0.2224233f, 0.0924203619f},
-std::array<float,2>{0.657391429f, 0.809602737f},
-std::array<float,2>{0.442189842f, 0.685952067f},
-std::array<float,2>{0.801937044f, 0.436085969f},
-std::array<float,2>{0.351380706f, 0.0470931455f},
-std::array<float,2>{0.935883582f, 0.814334512f},
-std::array<float,2>{0.065282017f, 0.726825595f},
-std::array<float,2>{0.551884055f, 0.480198115f},
-std::array<float,2>{0.132592916f, 0.264521837f},
-std::array<float,2>{0.744635403f, 0.581054211f},
-std::array<float,2>{0.403271019f, 0.982283115f},
-std::array<float,2>{0.860928714f, 0.21392037f},
-std::array<float,2>{0.47809574f, 0.379631966f},
-std::array<float,2>{0.763825238f, 0.6262151f},
-std::array<float,2>{0.204981595f, 0.750731468f},
-std::array<float,2>{0.645438612f, 0.0979679003f},
-std::array<float,2>{0.00546867074f, 0.129496887f},
-std::array<float,2>{0.604457974f, 0.931962311f},
-std::array<float,2>{0.294015586f, 0.55272913f},
-std::array<float,2>{0.975403965f, 0.362314045f},
-std::array<float,2>{0.298995405f, 0.179928347f},
-std::array<float,2>{0.989336133f, 0.881337464f},
-std::array<float,2>{0.0275279358f, 0.520542502f},
-std::array<float,2>{0.611277699f, 0.316862971f},
-std::array<float,2>{0.191170171f, 0.418983251f},
-std::array<float,2>{0.63628912f, 0.670488119f},
-std::array<float,2>{0.486361653f, 0.782202125f},
-std::array<float,2>{0.78016597f, 0.0627441034f},
-std::array<float,2>{0.380689442f, 0.299394667f},
-std::array<float,2>{0.855020225f, 0.606768548f},
-std::array<float,2>{0.152235031f, 0.956373572f},
-std::array<float,2>{0.728633642f, 0.219620109f},
-std::array<float,2>{0.09051539f, 0.00730609661f},
-std::array<float,2>{0.534252346f, 0.84668988f},
-std::array<float,2>{0.369915545f, 0.696889937f},
-std::array<float,2>{0.920887291f, 0.449858576f},
-std::array<float,2>{0.461371601f, 0.111371577f},
-std::array<float,2>{0.784331203f, 0.766539931f},
-std::array<float,2>{0.240024939f, 0.642229676f},
-std::array<float,2>{0.671970367f, 0.397568196f},
-std::array<float,2>{0.0488459915f, 0.356577903f},
-std::array<float,2>{0.588941753f, 0.536481023f},
-std::array<float,2>{0.274948835f, 0.912530899f},
-std::array<float,2>{0.961686373f, 0.141637206f},
-std::array<float,2>{0.312882513f, 0.497897476f},
-std::array<float,2>{0.903046966f, 0.734523237f},
-std::array<float,2>{0.0970756412f, 0.840167701f},
-std::array<float,2>{0.511860251f, 0.033368662f},
-std::array<float,2>{0.183880508f, 0.189807102f},
-std::array<float,2>{0.716427982f, 0.994357824f},
-std::array<float,2>{0.429569542f, 0.568794191f},
-std::array<float,2>{0.831987679f, 0.275769562f},
-std::array<float,2>{0.467832834f, 0.237677351f},
-std::array<float,2>{0.786580205f, 0.947191894f},
-std::array<float,2>{0.236548856f, 0.623796582f},
-std::array<float,2>{0.676443338f, 0.283560514f},
-std::array<float,2>{0.0538444221f, 0.463148236f},
-std::array<float,2>{0.592264712f, 0.712248623f},
-std::array<float,2>{0.277553082f, 0.859990299f},
-std::array<float,2>{0.966376841f, 0.0167755466f},
-std::array<float,2>{0.31901902f, 0.332188547f},
-std::array<float,2>{0.899716735f, 0.504033864f},
-std::array<float,2>{0.0990344509f, 0.893492222f},
-std::array<float,2>{0.509220421f, 0.158369616f},
-std::array<float,2>{0.181902975f, 0.0849609599f},
-std::array<float,2>{0.714660406f, 0.800131559f},
-std::array<float,2>{0.425584555f, 0.672220111f},
-std::array<float,2>{0.83289355f, 0.425951332f},
-std::array<float,2>{0.301259726f, 0.0616694801f},
-std::array<float,2>{0.985623538f, 0.822893262f},
-std::array<float,2>{0.0247701388f, 0.726246893f},
-std::array<float,2>{0.61353147f, 0.474623382f},
-std::array<float,2>{0.191546053f, 0.256103128f},
-std::array<float,2>{0.638845801f, 0.59232074f},
-std::array<float,2>{0.490781635f, 0.972261667f},
-std::array<float,2>{0.773894072f, 0.210763305f},
-std::array<float,2>{0.377451867f, 0.385177255f},
-std::array<float,2>{0.856717885f, 0.636119723f},
-std::array<float,2>{0.154659748f, 0.760611176f},
-std::array<float,2>{0.732097626f, 0.109008186f},
-std::array<float,2>{0.0891564488f, 0.137521237f},
-std::array<float,2>{0.535900176f, 0.927998006f},
-std::array<float,2>{0.374861032f, 0.557678401f},
-std::array<float,2>{0.915678263f, 0.37087369f},
-std::array<float,2>{0.344800651f, 0.174018338f},
-std::array<float,2>{0.93165499f, 0.88394928f},
-std::array<float,2>{0.0687596425f, 0.524561107f},
-std::array<float,2>{0.548253417f, 0.322009832f},
-std::array<float,2>{0.125157952f, 0.408403516f},
-std::array<float,2>{0.74910599f, 0.662386835f},
-std::array<float,2>{0.399942249f, 0.794582307f},
-std::array<float,2>{0.864609778f, 0.0772934183f},
-std::array<float,2>{0.481375188f, 0.311763614f},
-std::array<float,2>{0.759385288f, 0.595302403f},
-std::array<float,2>{0.209288999f, 0.967441678f},
-std::array<float,2>{0.643186092f, 0.230038241f},
-std::array<float,2>{0.000147674116f, 0.0110904593f},
-std::array<float,2>{0.60925436f, 0.854047537f},
-std::array<float,2>{0.291199684f, 0.689166069f},
-std::array<float,2>{0.97165966f, 0.43942669f},
-std::array<float,2>{0.407931626f, 0.123987496f},
-std::array<float,2>{0.823140979f, 0.774662733f},
-std::array<float,2>{0.166401669f, 0.648759186f},
-std::array<float,2>{0.69469732f, 0.401903987f},
-std::array<float,2>{0.122933477f, 0.348194897f},
-std::array<float,2>{0.526407897f, 0.543814719f},
-std::array<float,2>{0.33821997f, 0.918256998f},
-std::array<float,2>{0.878888309f, 0.151445806f},
-std::array<float,2>{0.262216955f, 0.490708947f},
-std::array<float,2>{0.93920666f, 0.747059166f},
-std::array<float,2>{0.0402071476f, 0.828267336f},
-std::array<float,2>{0.56307435f, 0.0433405787f},
-std::array<float,2>{0.224715561f, 0.195866689f},
-std::array<float,2>{0.662157476f, 0.986662269f},
-std::array<float,2>{0.438483864f, 0.574108541f},
-std::array<float,2>{0.799892604f, 0.272617608f},
-std::array<float,2>{0.393414289f, 0.147169918f},
-std::array<float,2>{0.870843232f, 0.908132911f},
-std::array<float,2>{0.136666477f, 0.532657683f},
-std::array<float,2>{0.737604856f, 0.351960927f},
-std::array<float,2>{0.0760566369f, 0.394166678f},
-std::array<float,2>{0.562443316f, 0.647021055f},
-std::array<float,2>{0.356250286f, 0.769760251f},
-std::array<float,2>{0.925844729f, 0.115999624f},
-std::array<float,2>{0.281478375f, 0.280658126f},
-std::array<float,2>{0.982836962f, 0.563563883f},
-std::array<float,2>{0.0151433507f, 0.998090744f},
-std::array<float,2>{0.595038891f, 0.194459796f},
-std::array<float,2>{0.212086573f, 0.0351656005f},
-std::array<float,2>{0.655084133f, 0.837499797f},
-std::array<float,2>{0.471542925f, 0.738920629f},
-std::array<float,2>{0.750492513f, 0.494196087f},
-std::array<float,2>{0.335577071f, 0.0677847788f},
-std::array<float,2>{0.886264861f, 0.786118746f},
-std::array<float,2>{0.109660059f, 0.666820347f},
-std::array<float,2>{0.519075096f, 0.416107982f},
-std::array<float,2>{0.158551455f, 0.313498467f},
-std::array<float,2>{0.702281296f, 0.517484546f},
-std::array<float,2>{0.414464951f, 0.877265334f},
-std::array<float,2>{0.814476907f, 0.18579343f},
-std::array<float,2>{0.448899955f, 0.448922127f},
-std::array<float,2>{0.80826515f, 0.700454831f},
-std::array<float,2>{0.231867507f, 0.850949883f},
-std::array<float,2>{0.669185162f, 0.00206259056f},
-std::array<float,2>{0.0333014019f, 0.223978579f},
-std::array<float,2>{0.576944351f, 0.958142698f},
-std::array<float,2>{0.254114151f, 0.604871392f},
-std::array<float,2>{0.950963914f, 0.300999731f},
-std::array<float,2>{0.269575536f, 0.21530737f},
-std::array<float,2>{0.953970134f, 0.978506267f},
-std::array<float,2>{0.06162389f, 0.585798144f},
-std::array<float,2>{0.585661352f, 0.261189401f},
-std::array<float,2>{0.246592879f, 0.483553112f},
-std::array<float,2>{0.683876216f, 0.730639398f},
-std::array<float,2>{0.45329234f, 0.818257987f},
-std::array<float,2>{0.789090037f, 0.0542903394f},
-std::array<float,2>{0.43397972f, 0.363975346f},
-std::array<float,2>{0.842704117f, 0.549404919f},
-std::array<float,2>{0.178082451f, 0.936960161f},
-std::array<float,2>{0.703137159f, 0.126195118f},
-std::array<float,2>{0.102903463f, 0.0938625112f},
-std::array<float,2>{0.50296247f, 0.756101966f},
-std::array<float,2>{0.321872979f, 0.629810035f},
-std::array<float,2>{0.894728661f, 0.378140628f},
-std::array<float,2>{0.494908065f, 0.0249023885f},
-std::array<float,2>{0.765905678f, 0.871855378f},
-std::array<float,2>{0.197591439f, 0.708252013f},
-std::array<float,2>{0.632252872f, 0.455652177f},
-std::array<float,2>{0.0159899127f, 0.290179551f},
-std::array<float,2>{0.622242987f, 0.613678992f},
-std::array<float,2>{0.309459388f, 0.94300288f},
-std::array<float,2>{0.998505473f, 0.247285217f},
-std::array<float,2>{0.36119172f, 0.429770738f},
-std::array<float,2>{0.913975239f, 0.680836797f},
-std::array<float,2>{0.0850197002f, 0.806575358f},
-std::array<float,2>{0.542151988f, 0.0880467892f},
-std::array<float,2>{0.143256769f, 0.16766496f},
-std::array<float,2>{0.724473953f, 0.899168074f},
-std::array<float,2>{0.382961452f, 0.507927597f},
-std::array<float,2>{0.845861375f, 0.340259701f},
-std::array<float,2>{0.475698888f, 0.163038522f},
-std::array<float,2>{0.755864918f, 0.897595406f},
-std::array<float,2>{0.218635201f, 0.50004077f},
-std::array<float,2>{0.651597559f, 0.331402391f},
-std::array<float,2>{0.0101156197f, 0.423096508f},
-std::array<float,2>{0.599590003f, 0.676294506f},
-std::array<float,2>{0.28585726f, 0.804439723f},
-std::array<float,2>{0.979749918f, 0.0788680762f},
-std::array<float,2>{0.354033411f, 0.287196755f},
-std::array<float,2>{0.924231112f, 0.619480968f},
-std::array<float,2>{0.0727692544f, 0.95262301f},
-std::array<float,2>{0.55735141f, 0.238452226f},
-std::array<float,2>{0.139760748f, 0.0201457795f},
-std::array<float,2>{0.739379466f, 0.866454542f},
-std::array<float,2>{0.396597534f, 0.718221486f},
-std::array<float,2>{0.871462107f, 0.467638522f},
-std::array<float,2>{0.252456516f, 0.10236048f},
-std::array<float,2>{0.947744131f, 0.763739169f},
-std::array<float,2>{0.0367993973f, 0.637104928f},
-std::array<float,2>{0.574127913f, 0.387568325f},
-std::array<float,2>{0.22658205f, 0.372769266f},
-std::array<float,2>{0.664711952f, 0.558685839f},
-std::array<float,2>{0.450004607f, 0.923824191f},
-std::array<float,2>{0.810382545f, 0.13407059f},
-std::array<float,2>{0.420899302f, 0.469872445f},
-std::array<float,2>{0.820016205f, 0.720842123f},
-std::array<float,2>{0.162547112f, 0.825213909f},
-std::array<float,2>{0.698029399f, 0.0567934364f},
-std::array<float,2>{0.113481335f, 0.203482375f},
-std::array<float,2>{0.521269858f, 0.976030886f},
-std::array<float,2>{0.331662983f, 0.589432478f},
-std::array<float,2>{0.888498664f, 0.251986086f},
-std::array<float,2>{0.327106535f, 0.234329224f},
-std::array<float,2>{0.890775442f, 0.961909473f},
-std::array<float,2>{0.106403857f, 0.599729717f},
-std::array<float,2>{0.506761849f, 0.308113873f},
-std::array<float,2>{0.174115211f, 0.445272088f},
-std::array<float,2>{0.708880246f, 0.694179118f},
-std::array<float,2>{0.430711895f, 0.855976343f},
-std::array<float,2>{0.837257624f, 0.0133550558f},
-std::array<float,2>{0.459952265f, 0.326665103f},
-std::array<float,2>{0.795896351f, 0.527661741f},
-std::array<float,2>{0.242534116f, 0.889577508f},
-std::array<float,2>{0.682086945f, 0.176256105f},
-std::array<float,2>{0.057025224f, 0.0735049397f},
-std::array<float,2>{0.579126239f, 0.790064454f},
-std::array<float,2>{0.266511351f, 0.660091698f},
-std::array<float,2>{0.957975209f, 0.41041252f},
-std::array<float,2>{0.388991028f, 0.0424702056f},
-std::array<float,2>{0.848399282f, 0.835496783f},
-std::array<float,2>{0.147836059f, 0.742216051f},
-std::array<float,2>{0.718964696f, 0.487889558f},
-std::array<float,2>{0.0803177506f, 0.267123699f},
-std::array<float,2>{0.545442224f, 0.575278401f},
-std::array<float,2>{0.366302907f, 0.988497078f},
-std::array<float,2>{0.906822622f, 0.199225873f},
-std::array<float,2>{0.308533967f, 0.40290001f},
-std::array<float,2>{0.994442821f, 0.655600965f},
-std::array<float,2>{0.0204448402f, 0.777893126f},
-std::array<float,2>{0.617681384f, 0.119878508f},
-std::array<float,2>{0.20021598f, 0.15506427f},
-std::array<float,2>{0.62776041f, 0.915048659f},
-std::array<float,2>{0.498711497f, 0.540193319f},
-std::array<float,2>{0.773216426f, 0.343916208f},
-std::array<float,2>{0.428660035f, 0.188465729f},
-std::array<float,2>{0.830518484f, 0.994049728f},
-std::array<float,2>{0.185189813f, 0.568349004f},
-std::array<float,2>{0.715397477f, 0.274626076f},
-std::array<float,2>{0.0957965478f, 0.498755813f},
-std::array<float,2>{0.513343751f, 0.737468183f},
-std::array<float,2>{0.313561171f, 0.842420697f},
-std::array<float,2>{0.904253662f, 0.0321199335f},
-std::array<float,2>{0.274231046f, 0.359012663f},
-std::array<float,2>{0.962634683f, 0.537685871f},
-std::array<float,2>{0.0502568409f, 0.911273122f},
-std::array<float,2>{0.588624597f, 0.143815786f},
-std::array<float,2>{0.23869741f, 0.110395424f},
-std::array<float,2>{0.672981977f, 0.769276798f},
-std::array<float,2>{0.462051779f, 0.643981338f},
-std::array<float,2>{0.783913672f, 0.394713074f},
-std::array<float,2>{0.371047705f, 0.004301243f},
-std::array<float,2>{0.921187282f, 0.844106913f},
-std::array<float,2>{0.090918839f, 0.697555006f},
-std::array<float,2>{0.533948123f, 0.453044862f},
-std::array<float,2>{0.151081994f, 0.297093004f},
-std::array<float,2>{0.730416059f, 0.60869658f},
-std::array<float,2>{0.378996938f, 0.953809142f},
-std::array<float,2>{0.853539407f, 0.221083522f},
-std::array<float,2>{0.487728357f, 0.421463072f},
-std::array<float,2>{0.780654073f, 0.668644845f},
-std::array<float,2>{0.189816073f, 0.785077035f},
-std::array<float,2>{0.635440707f, 0.0657150596f},
-std::array<float,2>{0.0284970999f, 0.182889476f},
-std::array<float,2>{0.609393537f, 0.880512536f},
-std::array<float,2>{0.299874365f, 0.522168219f},
-std::array<float,2>{0.989091277f, 0.319481313f},
-std::array<float,2>{0.293818235f, 0.131998926f},
-std::array<float,2>{0.976211369f, 0.930475116f},
-std::array<float,2>{0.00485194102f, 0.553528845f},
-std::array<float,2>{0.604879618f, 0.36087659f},
-std::array<float,2>{0.203185871f, 0.381324798f},
-std::array<float,2>{0.646138012f, 0.628698349f},
-std::array<float,2>{0.476970226f, 0.753679156f},
-std::array<float,2>{0.765413463f, 0.100628138f},
-std::array<float,2>{0.403634459f, 0.263321817f},
-std::array<float,2>{0.859880626f, 0.578780532f},
-std::array<float,2>{0.130865395f, 0.983873129f},
-std::array<float,2>{0.745388389f, 0.21165964f},
-std::array<float,2>{0.0655364543f, 0.0506098233f},
-std::array<float,2>{0.551202416f, 0.816030025f},
-std::array<float,2>{0.350085288f, 0.729982078f},
-std::array<float,2>{0.936804771f, 0.478288114f},
-std::array<float,2>{0.442675322f, 0.0903425515f},
-std::array<float,2>{0.801449895f, 0.811096072f},
-std::array<float,2>{0.221256271f, 0.684703827f},
-std::array<float,2>{0.656706572f, 0.433971018f},
-std::array<float,2>{0.0442791656f, 0.338993758f},
-std::array<float,2>{0.568411052f, 0.514980018f},
-std::array<float,2>{0.259186029f, 0.904588997f},
-std::array<float,2>{0.944385767f, 0.17111294f},
-std::array<float,2>{0.340467274f, 0.460559905f},
-std::array<float,2>{0.881910801f, 0.704950273f},
-std::array<float,2>{0.118736297f, 0.868143082f},
-std::array<float,2>{0.531183898f, 0.0283593461f},
-std::array<float,2>{0.170652509f, 0.244387969f},
-std::array<float,2>{0.690049171f, 0.941235483f},
-std::array<float,2>{0.410403877f, 0.613035023f},
-std::array<float,2>{0.827307999f, 0.29627955f},
-std::array<float,2>{0.489211023f, 0.208405465f},
-std::array<float,2>{0.776311994f, 0.96900624f},
-std::array<float,2>{0.195162326f, 0.590948403f},
-std::array<float,2>{0.637190402f, 0.255693734f},
-std::array<float,2>{0.0255230293f, 0.473641306f},
-std::array<float,2>{0.617028594f, 0.723521829f},
-std::array<float,2>{0.303359807f, 0.82217592f},
-std::array<float,2>{0.987152457f, 0.0590932928f},
-std::array<float,2>{0.372135878f, 0.367611796f},
-std::array<float,2>{0.917136967f, 0.555207849f},
-std::array<float,2>{0.0862704739f, 0.926188171f},
-std::array<float,2>{0.537455261f, 0.140509084f},
-std::array<float,2>{0.153312758f, 0.105954282f},
-std::array<float,2>{0.733875275f, 0.757909954f},
-std::array<float,2>{0.376362026f, 0.634548485f},
-std::array<float,2>{0.859078705f, 0.383559048f},
-std::array<float,2>{0.280339658f, 0.0179018471f},
-std::array<float,2>{0.968640327f, 0.863101542f},
-std::array<float,2>{0.0515886173f, 0.714722455f},
-std::array<float,2>{0.590478003f, 0.461402178f},
-std::array<float,2>{0.235900789f, 0.282079935f},
-std::array<float,2>{0.678201675f, 0.622592628f},
-std::array<float,2>{0.466463774f, 0.948277831f},
-std::array<float,2>{0.787762463f, 0.234428883f},
-std::array<float,2>{0.422678351f, 0.428441972f},
-std::array<float,2>{0.834955573f, 0.674560905f},
-std::array<float,2>{0.180880561f, 0.79876852f},
-std::array<float,2>{0.712610185f, 0.0832194462f},
-std::array<float,2>{0.101350978f, 0.157996491f},
-std::array<float,2>{0.510311902f, 0.892217398f},
-std::array<float,2>{0.318063736f, 0.506816089f},
-std::array<float,2>{0.901684523f, 0.334921896f},
-std::array<float,2>{0.337814689f, 0.149803028f},
-std::array<float,2>{0.875195742f, 0.921245515f},
-std::array<float,2>{0.124090053f, 0.546074927f},
-std::array<float,2>{0.524714649f, 0.350834936f},
-std::array<float,2>{0.165977716f, 0.399838775f},
-std::array<float,2>{0.692551374f, 0.652086079f},
-std::array<float,2>{0.410015106f, 0.776558101f},
-std::array<float,2>{0.820797682f, 0.12293078f},
-std::array<float,2>{0.439963579f, 0.271469116f},
-std::array<float,2>{0.797863364f, 0.572172165f},
-std::array<float,2>{0.223704994f, 0.984991014f},
-std::array<float,2>{0.662035048f, 0.197448179f},
-std::array<float,2>{0.0417512991f, 0.0449362919f},
-std::array<float,2>{0.564969361f, 0.830989659f},
-std::array<float,2>{0.263966769f, 0.748599708f},
-std::array<float,2>{0.941347659f, 0.489112288f},
-std::array<float,2>{0.400936276f, 0.07489492f},
-std::array<float,2>{0.865544736f, 0.79557687f},
-std::array<float,2>{0.127707049f, 0.66105473f},
-std::array<float,2>{0.747887731f, 0.408152223f},
-std::array<float,2>{0.0674405247f, 0.323491901f},
-std::array<float,2>{0.548833668f, 0.52731359f},
-std::array<float,2>{0.345838517f, 0.886019826f},
-std::array<float,2>{0.931125164f, 0.173230648f},
-std::array<float,2>{0.290694922f, 0.439675272f},
-std::array<float,2>{0.970465243f, 0.689991355f},
-std::array<float,2>{0.00213885307f, 0.85350585f},
-std::array<float,2>{0.606439352f, 0.00875562988f},
-std::array<float,2>{0.207756355f, 0.226746932f},
-std::array<float,2>{0.641504049f, 0.966317892f},
-std::array<float,2>{0.484213084f, 0.597647488f},
-std::array<float,2>{0.760772228f, 0.308597714f},
-std::array<float,2>{0.417183071f, 0.183749586f},
-std::array<float,2>{0.813381791f, 0.87641573f},
-std::array<float,2>{0.156966254f, 0.519241989f},
-std::array<float,2>{0.699966848f, 0.315794528f},
-std::array<float,2>{0.112894513f, 0.41565609f},
-std::array<float,2>{0.516996145f, 0.665806293f},
-std::array<float,2>{0.333562821f, 0.78786236f},
-std::array<float,2>{0.883177459f, 0.0688248873f},
-std::array<float,2>{0.256965309f, 0.303913236f},
-std::array<float,2>{0.952034891f, 0.60341382f},
-std::array<float,2>{0.0331973992f, 0.959127784f},
-std::array<float,2>{0.574892223f, 0.225927711f},
-std::array<float,2>{0.232758343f, 0.000871904602f},
-std::array<float,2>{0.671093762f, 0.847766101f},
-std::array<float,2>{0.445554197f, 0.701356351f},
-std::array<float,2>{0.805918157f, 0.445702165f},
-std::array<float,2>{0.357659042f, 0.11452847f},
-std::array<float,2>{0.928192973f, 0.771808028f},
-std::array<float,2>{0.0767663792f, 0.646367013f},
-std::array<float,2>{0.559558392f, 0.392310768f},
-std::array<float,2>{0.133000523f, 0.353907138f},
-std::array<float,2>{0.735046923f, 0.533460379f},
-std::array<float,2>{0.390816808f, 0.909854174f},
-std::array<float,2>{0.867525697f, 0.145893306f},
-std::array<float,2>{0.469888657f, 0.49333635f},
-std::array<float,2>{0.752098322f, 0.741535246f},
-std::array<float,2>{0.214620113f, 0.838974595f},
-std::array<float,2>{0.65336889f, 0.0384528302f},
-std::array<float,2>{0.0134396339f, 0.191956967f},
-std::array<float,2>{0.596511543f, 0.997843564f},
-std::array<float,2>{0.283371568f, 0.565188289f},
-std::array<float,2>{0.981651247f, 0.277389854f},
-std::array<float,2>{0.311524779f, 0.249778584f},
-std::array<float,2>{0.997749269f, 0.944169044f},
-std::array<float,2>{0.0177279916f, 0.615250051f},
-std::array<float,2>{0.623182297f, 0.291123182f},
-std::array<float,2>{0.195443615f, 0.453908235f},
-std::array<float,2>{0.630520582f, 0.709316492f},
-std::array<float,2>{0.494126499f, 0.874371231f},
-std::array<float,2>{0.767919779f, 0.025490975f},
-std::array<float,2>{0.385548234f, 0.343712628f},
-std::array<float,2>{0.844732344f, 0.511164904f},
-std::array<float,2>{0.141853824f, 0.902205288f},
-std::array<float,2>{0.726396322f, 0.164726034f},
-std::array<float,2>{0.0823010281f, 0.0864856169f},
-std::array<float,2>{0.540588081f, 0.806926847f},
-std::array<float,2>{0.363161325f, 0.682470143f},
-std::array<float,2>{0.911687672f, 0.431693345f},
-std::array<float,2>{0.455520988f, 0.0513794459f},
-std::array<float,2>{0.791653633f, 0.818819344f},
-std::array<float,2>{0.248857737f, 0.733507574f},
-std::array<float,2>{0.687277615f, 0.480706811f},
-std::array<float,2>{0.0605213046f, 0.258697003f},
-std::array<float,2>{0.582828104f, 0.583598554f},
-std::array<float,2>{0.272172213f, 0.979922116f},
-std::array<float,2>{0.955766857f, 0.217969388f},
-std::array<float,2>{0.323664099f, 0.376797557f},
-std::array<float,2>{0.897055745f, 0.632434487f},
-std::array<float,2>{0.104482897f, 0.755587041f},
-std::array<float,2>{0.501741588f, 0.0961532667f},
-std::array<float,2>{0.176208958f, 0.127193853f},
-std::array<float,2>{0.706968844f, 0.935161948f},
-std::array<float,2>{0.437006325f, 0.546923041f},
-std::array<float,2>{0.840276599f, 0.365487367f},
-std::array<float,2>{0.451408178f, 0.135959342f},
-std::array<float,2>{0.811771154f, 0.924770534f},
-std::array<float,2>{0.228945628f, 0.561679184f},
-std::array<float,2>{0.666077614f, 0.374927104f},
-std::array<float,2>{0.038624309f, 0.38916415f},
-std::array<float,2>{0.571177304f, 0.639445722f},
-std::array<float,2>{0.250942677f, 0.761977375f},
-std::array<float,2>{0.946544409f, 0.104392603f},
-std::array<float,2>{0.328803211f, 0.250476062f},
-std::array<float,2>{0.889459312f, 0.586190462f},
-std::array<float,2>{0.116923332f, 0.973891914f},
-std::array<float,2>{0.522406697f, 0.205377817f},
-std::array<float,2>{0.161560804f, 0.0559889786f},
-std::array<float,2>{0.695628166f, 0.827262461f},
-std::array<float,2>{0.418316245f, 0.720390558f},
-std::array<float,2>{0.817892194f, 0.471760273f},
-std::array<float,2>{0.288644582f, 0.0812206939f},
-std::array<float,2>{0.977544129f, 0.802623093f},
-std::array<float,2>{0.0090407338f, 0.678268552f},
-std::array<float,2>{0.600466311f, 0.425216287f},
-std::array<float,2>{0.215521395f, 0.329929978f},
-std::array<float,2>{0.64916569f, 0.502572119f},
-std::array<float,2>{0.473419726f, 0.895805955f},
-std::array<float,2>{0.755757809f, 0.160784334f},
-std::array<float,2>{0.396065563f, 0.466787219f},
-std::array<float,2>{0.873552322f, 0.714929879f},
-std::array<float,2>{0.13713868f, 0.864550412f},
-std::array<float,2>{0.741849482f, 0.0216349345f},
-std::array<float,2>{0.0718375891f, 0.24072811f},
-std::array<float,2>{0.554880738f, 0.949607968f},
-std::array<float,2>{0.352456093f, 0.618312776f},
-std::array<float,2>{0.922795594f, 0.286077321f},
-std::array<float,2>{0.364074975f, 0.201364025f},
-std::array<float,2>{0.910148919f, 0.990524411f},
-std::array<float,2>{0.0793830231f, 0.576228738f},
-std::array<float,2>{0.54455018f, 0.268094301f},
-std::array<float,2>{0.146286711f, 0.486156881f},
-std::array<float,2>{0.722067535f, 0.744816422f},
-std::array<float,2>{0.388518482f, 0.832619786f},
-std::array<float,2>{0.849775612f, 0.040953394f},
-std::array<float,2>{0.496172965f, 0.34725219f},
-std::array<float,2>{0.770175636f, 0.542615414f},
-std::array<float,2>{0.201918691f, 0.917041063f},
-std::array<float,2>{0.626675725f, 0.153751984f},
-std::array<float,2>{0.0221089907f, 0.118237697f},
-std::array<float,2>{0.619438529f, 0.781223357f},
-std::array<float,2>{0.30536136f, 0.654075742f},
-std::array<float,2>{0.99343437f, 0.405847818f},
-std::array<float,2>{0.433494151f, 0.0155342538f},
-std::array<float,2>{0.838496268f, 0.858426034f},
-std::array<float,2>{0.172412381f, 0.691985071f},
-std::array<float,2>{0.710537851f, 0.442753613f},
-std::array<float,2>{0.10779155f, 0.304962099f},
-std::array<float,2>{0.505327821f, 0.599607885f},
-std::array<float,2>{0.324718684f, 0.963830233f},
-std::array<float,2>{0.893005013f, 0.232416168f},
-std::array<float,2>{0.268958598f, 0.413515657f},
-std::array<float,2>{0.960714638f, 0.65746218f},
-std::array<float,2>{0.0560335405f, 0.792647004f},
-std::array<float,2>{0.581009865f, 0.0704100952f},
-std::array<float,2>{0.245173424f, 0.179022074f},
-std::array<float,2>{0.679781437f, 0.887964606f},
-std::array<float,2>{0.457468927f, 0.530061603f},
-std::array<float,2>{0.79407686f, 0.32459864f},
-std::array<float,2>{0.382581592f, 0.220276639f},
-std::array<float,2>{0.853459895f, 0.955867827f},
-std::array<float,2>{0.150007427f, 0.605983555f},
-std::array<float,2>{0.727852702f, 0.300716728f},
-std::array<float,2>{0.0932165682f, 0.450216383f},
-std::array<float,2>{0.531475663f, 0.696108818f},
-std::array<float,2>{0.368002862f, 0.845767975f},
-std::array<float,2>{0.919299483f, 0.00598528562f},
-std::array<float,2>{0.298618168f, 0.317929327f},
-std::array<float,2>{0.990647793f, 0.519882381f},
-std::array<float,2>{0.0305819064f, 0.881890655f},
-std::array<float,2>{0.612953246f, 0.180808946f},
-std::array<float,2>{0.189363241f, 0.0636748001f},
-std::array<float,2>{0.633763313f, 0.782924652f},
-std::array<float,2>{0.485524237f, 0.671707809f},
-std::array<float,2>{0.779214144f, 0.417983323f},
-std::array<float,2>{0.316294223f, 0.0348677523f},
-std::array<float,2>{0.905976713f, 0.841676593f},
-std::array<float,2>{0.0948715508f, 0.736254036f},
-std::array<float,2>{0.513979912f, 0.496888012f},
-std::array<float,2>{0.186258763f, 0.276482195f},
-std::array<float,2>{0.717109919f, 0.569832981f},
-std::array<float,2>{0.427330166f, 0.996007085f},
-std::array<float,2>{0.828850329f, 0.191082701f},
-std::array<float,2>{0.463745147f, 0.397048533f},
-std::array<float,2>{0.783168554f, 0.64071101f},
-std::array<float,2>{0.241472557f, 0.767298698f},
-std::array<float,2>{0.674549818f, 0.112646319f},
-std::array<float,2>{0.0485399701f, 0.140800327f},
-std::array<float,2>{0.587653577f, 0.913893402f},
-std::array<float,2>{0.276522577f, 0.535372436f},
-std::array<float,2>{0.964269161f, 0.355679989f},
-std::array<float,2>{0.259800851f, 0.168528244f},
-std::array<float,2>{0.943157673f, 0.903148293f},
-std::array<float,2>{0.0455060191f, 0.512730956f},
-std::array<float,2>{0.566642106f, 0.336301506f},
-std::array<float,2>{0.220602646f, 0.436875999f},
-std::array<float,2>{0.659352601f, 0.687305689f},
-std::array<float,2>{0.445109546f, 0.808708429f},
-std::array<float,2>{0.803063631f, 0.0935360491f},
-std::array<float,2>{0.412683368f, 0.294831038f},
-std::array<float,2>{0.825207353f, 0.610961676f},
-std::array<float,2>{0.168673426f, 0.938185155f},
-std::array<float,2>{0.688627481f, 0.244074538f},
-std::array<float,2>{0.119933277f, 0.0296645071f},
-std::array<float,2>{0.528229356f, 0.869239509f},
-std::array<float,2>{0.342182457f, 0.705450058f},
-std::array<float,2>{0.879898906f, 0.457652897f},
-std::array<float,2>{0.479014605f, 0.0990100577f},
-std::array<float,2>{0.761915326f, 0.751078248f},
-std::array<float,2>{0.205353349f, 0.625391483f},
-std::array<float,2>{0.647216499f, 0.38005653f},
-std::array<float,2>{0.00754335802f, 0.361504585f},
-std::array<float,2>{0.602189124f, 0.550804079f},
-std::array<float,2>{0.296179324f, 0.933208525f},
-std::array<float,2>{0.974282861f, 0.129903913f},
-std::array<float,2>{0.348888814f, 0.479085207f},
-std::array<float,2>{0.934753537f, 0.728106201f},
-std::array<float,2>{0.0626750216f, 0.812855661f},
-std::array<float,2>{0.553555727f, 0.0480394587f},
-std::array<float,2>{0.129882514f, 0.213672683f},
-std::array<float,2>{0.74294883f, 0.981073081f},
-std::array<float,2>{0.404967695f, 0.581993222f},
-std::array<float,2>{0.86218667f, 0.26535964f},
-std::array<float,2>{0.474433959f, 0.23870419f},
-std::array<float,2>{0.754069388f, 0.952291012f},
-std::array<float,2>{0.21672605f, 0.619288981f},
-std::array<float,2>{0.650272071f, 0.287450731f},
-std::array<float,2>{0.00821687654f, 0.467489988f},
-std::array<float,2>{0.6013816f, 0.718012094f},
-std::array<float,2>{0.287904173f, 0.866683364f},
-std::array<float,2>{0.97686255f, 0.0203733072f},
-std::array<float,2>{0.353348345f, 0.33117038f},
-std::array<float,2>{0.922992587f, 0.500363469f},
-std::array<float,2>{0.0709958151f, 0.897745848f},
-std::array<float,2>{0.555919349f, 0.162600994f},
-std::array<float,2>{0.137865245f, 0.0787682831f},
-std::array<float,2>{0.741054714f, 0.80455637f},
-std::array<float,2>{0.395282894f, 0.676685691f},
-std::array<float,2>{0.874434292f, 0.423089057f},
-std::array<float,2>{0.251132816f, 0.0571139157f},
-std::array<float,2>{0.946186185f, 0.825580239f},
-std::array<float,2>{0.0375356749f, 0.721189201f},
-std::array<float,2>{0.572179198f, 0.470181346f},
-std::array<float,2>{0.229637563f, 0.25234428f},
-std::array<float,2>{0.667825401f, 0.589792669f},
-std::array<float,2>{0.453041762f, 0.975729585f},
-std::array<float,2>{0.810883462f, 0.203128085f},
-std::array<float,2>{0.418969691f, 0.387250602f},
-std::array<float,2>{0.816927493f, 0.636883914f},
-std::array<float,2>{0.160749942f, 0.764143884f},
-std::array<float,2>{0.696853101f, 0.102102622f},
-std::array<float,2>{0.115507059f, 0.13394247f},
-std::array<float,2>{0.523398936f, 0.923361301f},
-std::array<float,2>{0.329844505f, 0.558849752f},
-std::array<float,2>{0.889968336f, 0.373037517f},
-std::array<float,2>{0.326154768f, 0.175871655f},
-std::array<float,2>{0.893939793f, 0.889330506f},
-std::array<float,2>{0.108600311f, 0.527412355f},
-std::array<float,2>{0.504602492f, 0.327145755f},
-std::array<float,2>{0.172953457f, 0.410306484f},
-std::array<float,2>{0.709036171f, 0.659878552f},
-std::array<float,2>{0.43228969f, 0.790341854f},
-std::array<float,2>{0.839178264f, 0.0734005794f},
-std::array<float,2>{0.458080828f, 0.308482528f},
-std::array<float,2>{0.793114185f, 0.599899292f},
-std::array<float,2>{0.244990647f, 0.961555958f},
-std::array<float,2>{0.681255102f, 0.234076366f},
-std::array<float,2>{0.0547388159f, 0.0136160497f},
-std::array<float,2>{0.581073403f, 0.856286943f},
-std::array<float,2>{0.268234819f, 0.693928719f},
-std::array<float,2>{0.959839821f, 0.444962263f},
-std::array<float,2>{0.386861712f, 0.119673513f},
-std::array<float,2>{0.851074338f, 0.778101623f},
-std::array<float,2>{0.145327628f, 0.655460715f},
-std::array<float,2>{0.721461117f, 0.403133869f},
-std::array<float,2>{0.0785561651f, 0.344129026f},
-std::array<float,2>{0.543789506f, 0.540315092f},
-std::array<float,2>{0.364282578f, 0.915467978f},
-std::array<float,2>{0.908639669f, 0.154802412f},
-std::array<float,2>{0.306099266f, 0.488245189f},
-std::array<float,2>{0.993046343f, 0.742512286f},
-std::array<float,2>{0.0227456894f, 0.835693777f},
-std::array<float,2>{0.620159805f, 0.0421217829f},
-std::array<float,2>{0.202314466f, 0.199618131f},
-std::array<float,2>{0.625933766f, 0.988706112f},
-std::array<float,2>{0.497499317f, 0.575473189f},
-std::array<float,2>{0.770941257f, 0.26736027f},
-std::array<float,2>{0.426646769f, 0.143785134f},
-std::array<float,2>{0.829138935f, 0.911490738f},
-std::array<float,2>{0.186792374f, 0.537947536f},
-std::array<float,2>{0.717993498f, 0.359173208f},
-std::array<float,2>{0.0941705629f, 0.395003676f},
-std::array<float,2>{0.514826596f, 0.643653512f},
-std::array<float,2>{0.31504795f, 0.769341946f},
-std::array<float,2>{0.904471099f, 0.110668041f},
-std::array<float,2>{0.275745988f, 0.274677753f},
-std::array<float,2>{0.963516116f, 0.56807512f},
-std::array<float,2>{0.0476891883f, 0.993711829f},
-std::array<float,2>{0.586867869f, 0.188055456f},
-std::array<float,2>{0.240811571f, 0.0317496136f},
-std::array<float,2>{0.674892247f, 0.84266299f},
-std::array<float,2>{0.463881314f, 0.737704039f},
-std::array<float,2>{0.782046199f, 0.498912394f},
-std::array<float,2>{0.368936092f, 0.0655888915f},
-std::array<float,2>{0.918297529f, 0.784705997f},
-std::array<float,2>{0.0925045684f, 0.668913126f},
-std::array<float,2>{0.533029139f, 0.42166853f},
-std::array<float,2>{0.148728445f, 0.319621027f},
-std::array<float,2>{0.726695597f, 0.522397637f},
-std::array<float,2>{0.381830901f, 0.880624175f},
-std::array<float,2>{0.852030158f, 0.182847068f},
-std::array<float,2>{0.485299349f, 0.452842772f},
-std::array<float,2>{0.777500927f, 0.697365999f},
-std::array<float,2>{0.18770583f, 0.84396714f},
-std::array<float,2>{0.634004772f, 0.00412809476f},
-std::array<float,2>{0.0300590303f, 0.220805734f},
-std::array<float,2>{0.6122998f, 0.954079092f},
-std::array<float,2>{0.296901882f, 0.608606398f},
-std::array<float,2>{0.991416752f, 0.297290564f},
-std::array<float,2>{0.29543981f, 0.211764082f},
-std::array<float,2>{0.973599076f, 0.983538628f},
-std::array<float,2>{0.00628709514f, 0.579093814f},
-std::array<float,2>{0.603066146f, 0.263541222f},
-std::array<float,2>{0.206206292f, 0.478051513f},
-std::array<float,2>{0.64798528f, 0.730305314f},
-std::array<float,2>{0.479815602f, 0.816285908f},
-std::array<float,2>{0.763381481f, 0.0503906719f},
-std::array<float,2>{0.405936122f, 0.361229181f},
-std::array<float,2>{0.862955391f, 0.553256869f},
-std::array<float,2>{0.130156428f, 0.930319548f},
-std::array<float,2>{0.743762851f, 0.13223891f},
-std::array<float,2>{0.0637821257f, 0.100860119f},
-std::array<float,2>{0.553879678f, 0.753521442f},
-std::array<float,2>{0.347989947f, 0.628473938f},
-std::array<float,2>{0.934548795f, 0.380962849f},
-std::array<float,2>{0.443710089f, 0.028784642f},
-std::array<float,2>{0.80389148f, 0.867775679f},
-std::array<float,2>{0.21928452f, 0.704679966f},
-std::array<float,2>{0.658338368f, 0.460768223f},
-std::array<float,2>{0.0464817807f, 0.296034813f},
-std::array<float,2>{0.567967474f, 0.613130927f},
-std::array<float,2>{0.260860205f, 0.941061437f},
-std::array<float,2>{0.941521764f, 0.244147718f},
-std::array<float,2>{0.342909724f, 0.433646381f},
-std::array<float,2>{0.879776001f, 0.684877336f},
-std::array<float,2>{0.120375223f, 0.81146431f},
-std::array<float,2>{0.529062331f, 0.0907259211f},
-std::array<float,2>{0.169315919f, 0.171150029f},
-std::array<float,2>{0.6876477f, 0.904333889f},
-std::array<float,2>{0.413183212f, 0.514743388f},
-std::array<float,2>{0.824239731f, 0.339293182f},
-std::array<float,2>{0.465373576f, 0.158481762f},
-std::array<float,2>{0.788266301f, 0.893278778f},
-std::array<float,2>{0.234779045f, 0.504368961f},
-std::array<float,2>{0.679172695f, 0.332498282f},
-std::array<float,2>{0.0523673072f, 0.42619592f},
-std::array<float,2>{0.591107309f, 0.672105551f},
-std::array<float,2>{0.280145615f, 0.800019026f},
-std::array<float,2>{0.96686095f, 0.0852957517f},
-std::array<float,2>{0.317346036f, 0.283422738f},
-std::array<float,2>{0.901072085f, 0.623591781f},
-std::array<float,2>{0.100159943f, 0.94693917f},
-std::array<float,2>{0.510906637f, 0.237372652f},
-std::array<float,2>{0.179690391f, 0.0168796144f},
-std::array<float,2>{0.711436927f, 0.860343635f},
-std::array<float,2>{0.42345646f, 0.712006092f},
-std::array<float,2>{0.835357308f, 0.462935477f},
-std::array<float,2>{0.304504514f, 0.109214731f},
-std::array<float,2>{0.988244355f, 0.760322988f},
-std::array<float,2>{0.0268991198f, 0.635908127f},
-std::array<float,2>{0.615965962f, 0.385005146f},
-std::array<float,2>{0.194135934f, 0.370669931f},
-std::array<float,2>{0.637862802f, 0.558014452f},
-std::array<float,2>{0.489357799f, 0.927920222f},
-std::array<float,2>{0.776893079f, 0.137294903f},
-std::array<float,2>{0.375209808f, 0.475058764f},
-std::array<float,2>{0.85800302f, 0.726492047f},
-std::array<float,2>{0.153610677f, 0.823206127f},
-std::array<float,2>{0.733227909f, 0.061896272f},
-std::array<float,2>{0.0876332074f, 0.210557356f},
-std::array<float,2>{0.538849056f, 0.972648859f},
-std::array<float,2>{0.371941596f, 0.592714787f},
-std::array<float,2>{0.916449189f, 0.256144613f},
-std::array<float,2>{0.347044319f, 0.230400115f},
-std::array<float,2>{0.929901063f, 0.967557251f},
-std::array<float,2>{0.066511564f, 0.595622182f},
-std::array<float,2>{0.550210714f, 0.311968714f},
-std::array<float,2>{0.128198594f, 0.439176261f},
-std::array<float,2>{0.74629271f, 0.689282954f},
-std::array<float,2>{0.401739776f, 0.854450464f},
-std::array<float,2>{0.866518021f, 0.010762265f},
-std::array<float,2>{0.483162433f, 0.322157294f},
-std::array<float,2>{0.760286033f, 0.524701893f},
-std::array<float,2>{0.208858535f, 0.884157896f},
-std::array<float,2>{0.641710579f, 0.174080297f},
-std::array<float,2>{0.00346202007f, 0.0774700269f},
-std::array<float,2>{0.606534898f, 0.794883609f},
-std::array<float,2>{0.289403915f, 0.662159622f},
-std::array<float,2>{0.969353676f, 0.408652455f},
-std::array<float,2>{0.408619642f, 0.0431470387f},
-std::array<float,2>{0.822118163f, 0.828373671f},
-std::array<float,2>{0.1641583f, 0.746765137f},
-std::array<float,2>{0.692171812f, 0.490297824f},
-std::array<float,2>{0.123738058f, 0.27282092f},
-std::array<float,2>{0.523800552f, 0.573890686f},
-std::array<float,2>{0.336368531f, 0.986525118f},
-std::array<float,2>{0.876869023f, 0.196264237f},
-std::array<float,2>{0.265419751f, 0.402259916f},
-std::array<float,2>{0.940255284f, 0.648532152f},
-std::array<float,2>{0.0422569215f, 0.774651706f},
-std::array<float,2>{0.56607008f, 0.123704717f},
-std::array<float,2>{0.223234758f, 0.151839882f},
-std::array<float,2>{0.660999596f, 0.917978346f},
-std::array<float,2>{0.441379577f, 0.543543398f},
-std::array<float,2>{0.797525704f, 0.348622143f},
-std::array<float,2>{0.391740322f, 0.194771275f},
-std::array<float,2>{0.868205845f, 0.998338223f},
-std::array<float,2>{0.134617075f, 0.563743532f},
-std::array<float,2>{0.735919476f, 0.280356824f},
-std::array<float,2>{0.0773844048f, 0.494529516f},
-std::array<float,2>{0.560082972f, 0.739039779f},
-std::array<float,2>{0.358980089f, 0.837701797f},
-std::array<float,2>{0.929230452f, 0.0354612321f},
-std::array<float,2>{0.284555674f, 0.351760894f},
-std::array<float,2>{0.981038094f, 0.532457471f},
-std::array<float,2>{0.0121987723f, 0.907891333f},
-std::array<float,2>{0.596918344f, 0.147366315f},
-std::array<float,2>{0.213331491f, 0.115886934f},
-std::array<float,2>{0.652607858f, 0.769897163f},
-std::array<float,2>{0.469309986f, 0.647414446f},
-std::array<float,2>{0.753469706f, 0.39441967f},
-std::array<float,2>{0.332548201f, 0.00238306238f},
-std::array<float,2>{0.884407818f, 0.85082233f},
-std::array<float,2>{0.111931473f, 0.700349152f},
-std::array<float,2>{0.516522884f, 0.449135572f},
-std::array<float,2>{0.157309219f, 0.30106023f},
-std::array<float,2>{0.700915217f, 0.604650915f},
-std::array<float,2>{0.416291505f, 0.958490431f},
-std::array<float,2>{0.813807547f, 0.223840103f},
-std::array<float,2>{0.447172344f, 0.416382164f},
-std::array<float,2>{0.805123389f, 0.66658628f},
-std::array<float,2>{0.233679265f, 0.785737932f},
-std::array<float,2>{0.670820713f, 0.0675246641f},
-std::array<float,2>{0.0319103561f, 0.185742348f},
-std::array<float,2>{0.57574904f, 0.877066851f},
-std::array<float,2>{0.256154418f, 0.517308891f},
-std::array<float,2>{0.952642381f, 0.313908935f},
-std::array<float,2>{0.273180336f, 0.126421869f},
-std::array<float,2>{0.956135333f, 0.936657369f},
-std::array<float,2>{0.0587183386f, 0.549665391f},
-std::array<float,2>{0.583343327f, 0.364049017f},
-std::array<float,2>{0.249768913f, 0.378327847f},
-std::array<float,2>{0.686257899f, 0.629558325f},
-std::array<float,2>{0.456061304f, 0.756198287f},
-std::array<float,2>{0.792901814f, 0.0942269713f},
-std::array<float,2>{0.436369061f, 0.260826349f},
-std::array<float,2>{0.841279089f, 0.585603118f},
-std::array<float,2>{0.176801205f, 0.978238881f},
-std::array<float,2>{0.705379725f, 0.214988351f},
-std::array<float,2>{0.105189733f, 0.0545743927f},
-std::array<float,2>{0.500005364f, 0.817889631f},
-std::array<float,2>{0.32240805f, 0.730899274f},
-std::array<float,2>{0.898334026f, 0.48386535f},
-std::array<float,2>{0.492349207f, 0.0882494897f},
-std::array<float,2>{0.76890552f, 0.806287169f},
-std::array<float,2>{0.196747676f, 0.681095719f},
-std::array<float,2>{0.629822314f, 0.430111676f},
-std::array<float,2>{0.0187010523f, 0.340078205f},
-std::array<float,2>{0.624931157f, 0.508160949f},
-std::array<float,2>{0.311161369f, 0.899186075f},
-std::array<float,2>{0.996163309f, 0.167761013f},
-std::array<float,2>{0.361461818f, 0.455824703f},
-std::array<float,2>{0.910348654f, 0.708245039f},
-std::array<float,2>{0.0839416087f, 0.871667862f},
-std::array<float,2>{0.540034652f, 0.025221251f},
-std::array<float,2>{0.140986085f, 0.247324497f},
-std::array<float,2>{0.725569665f, 0.943222523f},
-std::array<float,2>{0.386454582f, 0.613396466f},
-std::array<float,2>{0.844139695f, 0.290489614f},
-std::array<float,2>{0.450376213f, 0.205309674f},
-std::array<float,2>{0.809533596f, 0.973865986f},
-std::array<float,2>{0.227758378f, 0.585992515f},
-std::array<float,2>{0.665326178f, 0.250129819f},
-std::array<float,2>{0.0360546857f, 0.472103387f},
-std::array<float,2>{0.572715819f, 0.720472276f},
-std::array<float,2>{0.253647327f, 0.82746315f},
-std::array<float,2>{0.948736727f, 0.0558661073f},
-std::array<float,2>{0.330442101f, 0.374615461f},
-std::array<float,2>{0.887248576f, 0.561978638f},
-std::array<float,2>{0.114674084f, 0.924412966f},
-std::array<float,2>{0.520260572f, 0.136176392f},
-std::array<float,2>{0.163220912f, 0.104149945f},
-std::array<float,2>{0.698769093f, 0.761909246f},
-std::array<float,2>{0.420809805f, 0.639315546f},
-std::array<float,2>{0.818413019f, 0.389613271f},
-std::array<float,2>{0.286317289f, 0.0218434501f},
-std::array<float,2>{0.979186714f, 0.864309549f},
-std::array<float,2>{0.0116408886f, 0.715103924f},
-std::array<float,2>{0.597788155f, 0.466444045f},
-std::array<float,2>{0.216861367f, 0.285748482f},
-std::array<float,2>{0.650892556f, 0.618484735f},
-std::array<float,2>{0.475356936f, 0.949256241f},
-std::array<float,2>{0.757647932f, 0.241171971f},
-std::array<float,2>{0.3979747f, 0.424919963f},
-std::array<float,2>{0.872599006f, 0.678511083f},
-std::array<float,2>{0.138912499f, 0.80234164f},
-std::array<float,2>{0.738345563f, 0.0815080628f},
-std::array<float,2>{0.0740761459f, 0.160915524f},
-std::array<float,2>{0.558471084f, 0.895546556f},
-std::array<float,2>{0.354589432f, 0.502927005f},
-std::array<float,2>{0.92548275f, 0.329634219f},
-std::array<float,2>{0.366109967f, 0.153543159f},
-std::array<float,2>{0.907955825f, 0.917443812f},
-std::array<float,2>{0.0813861117f, 0.542948365f},
-std::array<float,2>{0.546717286f, 0.347559422f},
-std::array<float,2>{0.147190794f, 0.406072468f},
-std::array<float,2>{0.71996665f, 0.653976917f},
-std::array<float,2>{0.390240699f, 0.780833423f},
-std::array<float,2>{0.849599421f, 0.118435696f},
-std::array<float,2>{0.499653071f, 0.268459469f},
-std::array<float,2>{0.772423327f, 0.576459348f},
-std::array<float,2>{0.199809864f, 0.990337253f},
-std::array<float,2>{0.628401041f, 0.201516286f},
-std::array<float,2>{0.0207875017f, 0.0405553915f},
-std::array<float,2>{0.618671715f, 0.832788825f},
-std::array<float,2>{0.307243019f, 0.744910061f},
-std::array<float,2>{0.995840847f, 0.485876173f},
-std::array<float,2>{0.430175841f, 0.0706421062f},
-std::array<float,2>{0.836378336f, 0.79292351f},
-std::array<float,2>{0.175410092f, 0.657660067f},
-std::array<float,2>{0.707339346f, 0.413271368f},
-std::array<float,2>{0.107074022f, 0.324237823f},
-std::array<float,2>{0.506917894f, 0.52984035f},
-std::array<float,2>{0.32733947f, 0.887857556f},
-std::array<float,2>{0.892422736f, 0.178835183f},
-std::array<float,2>{0.266807407f, 0.442401946f},
-std::array<float,2>{0.958059132f, 0.692176044f},
-std::array<float,2>{0.0576800592f, 0.858662784f},
-std::array<float,2>{0.578275025f, 0.0152192712f},
-std::array<float,2>{0.244038925f, 0.232125103f},
-std::array<float,2>{0.683175623f, 0.963528514f},
-std::array<float,2>{0.460639715f, 0.599324644f},
-std::array<float,2>{0.796597779f, 0.304754019f},
-std::array<float,2>{0.380313426f, 0.181109607f},
-std::array<float,2>{0.854742646f, 0.882166564f},
-std::array<float,2>{0.151763484f, 0.519676566f},
-std::array<float,2>{0.729297161f, 0.318315119f},
-std::array<float,2>{0.0899462253f, 0.418449312f},
-std::array<float,2>{0.53487736f, 0.67145294f},
-std::array<float,2>{0.369579941f, 0.783002377f},
-std::array<float,2>{0.920249343f, 0.0638412237f},
-std::array<float,2>{0.299447328f, 0.300356537f},
-std::array<float,2>{0.989895761f, 0.606313288f},
-std::array<float,2>{0.0279575139f, 0.955723226f},
-std::array<float,2>{0.610356987f, 0.220484719f},
-std::array<float,2>{0.190857217f, 0.00615742244f},
-std::array<float,2>{0.635810316f, 0.845991433f},
-std::array<float,2>{0.486876965f, 0.695934236f},
-std::array<float,2>{0.779762447f, 0.450520366f},
-std::array<float,2>{0.313259512f, 0.112398192f},
-std::array<float,2>{0.90243566f, 0.767386854f},
-std::array<float,2>{0.0975219086f, 0.641051412f},
-std::array<float,2>{0.512307525f, 0.397435546f},
-std::array<float,2>{0.184516862f, 0.355830908f},
-std::array<float,2>{0.715871811f, 0.535513043f},
-std::array<float,2>{0.428952515f, 0.913675308f},
-std::array<float,2>{0.831395268f, 0.140988588f},
-std::array<float,2>{0.461775482f, 0.496648788f},
-std::array<float,2>{0.785112083f, 0.736081421f},
-std::array<float,2>{0.239671856f, 0.841528833f},
-std::array<float,2>{0.672422171f, 0.0349266268f},
-std::array<float,2>{0.0493387133f, 0.191370919f},
-std::array<float,2>{0.589653134f, 0.995822966f},
-std::array<float,2>{0.274666786f, 0.570248842f},
-std::array<float,2>{0.961033285f, 0.276756078f},
-std::array<float,2>{0.25852114f, 0.243711725f},
-std::array<float,2>{0.943662941f, 0.938373387f},
-std::array<float,2>{0.043222975f, 0.611216068f},
-std::array<float,2>{0.570140064f, 0.294445753f},
-std::array<float,2>{0.221837491f, 0.457999468f},
-std::array<float,2>{0.657771111f, 0.705267966f},
-std::array<float,2>{0.441668123f, 0.869416416f},
-std::array<float,2>{0.802492201f, 0.0294271987f},
-std::array<float,2>{0.411806583f, 0.336140662f},
-std::array<float,2>{0.826481521f, 0.51298362f},
-std::array<float,2>{0.171304435f, 0.903037012f},
-std::array<float,2>{0.691116452f, 0.168919384f},
-std::array<float,2>{0.118104823f, 0.0933998525f},
-std::array<float,2>{0.530105233f, 0.809046566f},
-std::array<float,2>{0.341423601f, 0.687019408f},
-std::array<float,2>{0.880884051f, 0.43664667f},
-std::array<float,2>{0.477689803f, 0.0483088531f},
-std::array<float,2>{0.764183104f, 0.812561333f},
-std::array<float,2>{0.204516187f, 0.728314042f},
-std::array<float,2>{0.644902229f, 0.479317456f},
-std::array<float,2>{0.00515713077f, 0.265484303f},
-std::array<float,2>{0.603766263f, 0.581638038f},
-std::array<float,2>{0.294633299f, 0.981254101f},
-std::array<float,2>{0.974916935f, 0.213443413f},
-std::array<float,2>{0.351008177f, 0.380152851f},
-std::array<float,2>{0.936256289f, 0.625166357f},
-std::array<float,2>{0.064798601f, 0.751350999f},
-std::array<float,2>{0.552658498f, 0.0988462642f},
-std::array<float,2>{0.132039681f, 0.130328462f},
-std::array<float,2>{0.744187236f, 0.933420658f},
-std::array<float,2>{0.402687579f, 0.551126242f},
-std::array<float,2>{0.860637486f, 0.361633539f},
-std::array<float,2>{0.49140811f, 0.140160292f},
-std::array<float,2>{0.775169551f, 0.925991416f},
-std::array<float,2>{0.193237156f, 0.555627704f},
-std::array<float,2>{0.640622377f, 0.36735779f},
-std::array<float,2>{0.0243369564f, 0.38333708f},
-std::array<float,2>{0.614651501f, 0.634347916f},
-std::array<float,2>{0.302678764f, 0.758129776f},
-std::array<float,2>{0.984453261f, 0.105611913f},
-std::array<float,2>{0.373362839f, 0.255405009f},
-std::array<float,2>{0.914964557f, 0.59112668f},
-std::array<float,2>{0.0882695243f, 0.968965709f},
-std::array<float,2>{0.536888361f, 0.208124787f},
-std::array<float,2>{0.156208649f, 0.0594239831f},
-std::array<float,2>{0.730799079f, 0.821926177f},
-std::array<float,2>{0.378882885f, 0.723212183f},
-std::array<float,2>{0.856138527f, 0.474063367f},
-std::array<float,2>{0.278459758f, 0.0833966061f},
-std::array<float,2>{0.965203941f, 0.79852742f},
-std::array<float,2>{0.0533580743f, 0.674370646f},
-std::array<float,2>{0.593222797f, 0.428489149f},
-std::array<float,2>{0.237330064f, 0.33464849f},
-std::array<float,2>{0.677160382f, 0.506519139f},
-std::array<float,2>{0.467742473f, 0.892513692f},
-std::array<float,2>{0.785375178f, 0.157751083f},
-std::array<float,2>{0.424180299f, 0.461055905f},
-std::array<float,2>{0.833551288f, 0.714462519f},
-std::array<float,2>{0.183428183f, 0.863016784f},
-std::array<float,2>{0.713348806f, 0.0178049952f},
-std::array<float,2>{0.0979051664f, 0.23477754f},
-std::array<float,2>{0.508742452f, 0.948655963f},
-std::array<float,2>{0.319361776f, 0.622919738f},
-std::array<float,2>{0.898732781f, 0.281757236f},
-std::array<float,2>{0.339021534f, 0.197614908f},
-std::array<float,2>{0.877731085f, 0.985250592f},
-std::array<float,2>{0.121280871f, 0.57182771f},
-std::array<float,2>{0.525424182f, 0.271204919f},
-std::array<float,2>{0.167146832f, 0.488798589f},
-std::array<float,2>{0.693394423f, 0.748814404f},
-std::array<float,2>{0.406456113f, 0.830626547f},
-std::array<float,2>{0.823304653f, 0.0452993438f},
-std::array<float,2>{0.438017339f, 0.35069114f},
-std::array<float,2>{0.799465597f, 0.546164453f},
-std::array<float,2>{0.226509407f, 0.920981288f},
-std::array<float,2>{0.663573027f, 0.149653226f},
-std::array<float,2>{0.0399003662f, 0.122657157f},
-std::array<float,2>{0.563798308f, 0.776851892f},
-std::array<float,2>{0.263566613f, 0.652109027f},
-std::array<float,2>{0.937989652f, 0.399509549f},
-std::array<float,2>{0.398681134f, 0.00834427122f},
-std::array<float,2>{0.864256978f, 0.853104174f},
-std::array<float,2>{0.126549959f, 0.690233231f},
-std::array<float,2>{0.748533607f, 0.439748913f},
-std::array<float,2>{0.0700957105f, 0.308891773f},
-std::array<float,2>{0.547693729f, 0.597297132f},
-std::array<float,2>{0.344663352f, 0.966781437f},
-std::array<float,2>{0.9330495f, 0.226909444f},
-std::array<float,2>{0.292896688f, 0.407885462f},
-std::array<float,2>{0.972047567f, 0.660705388f},
-std::array<float,2>{0.00181265548f, 0.795866787f},
-std::array<float,2>{0.607724309f, 0.0749961957f},
-std::array<float,2>{0.210906342f, 0.17300424f},
-std::array<float,2>{0.644293427f, 0.885904253f},
-std::array<float,2>{0.48172453f, 0.52693826f},
-std::array<float,2>{0.758643806f, 0.323346704f},
-std::array<float,2>{0.415646285f, 0.225745142f},
-std::array<float,2>{0.816248298f, 0.959239781f},
-std::array<float,2>{0.159518763f, 0.603048563f},
-std::array<float,2>{0.702062964f, 0.304020375f},
-std::array<float,2>{0.110999011f, 0.445374519f},
-std::array<float,2>{0.517901778f, 0.70160991f},
-std::array<float,2>{0.334760785f, 0.848132014f},
-std::array<float,2>{0.885476887f, 0.00060674845f},
-std::array<float,2>{0.255744368f, 0.31544894f},
-std::array<float,2>{0.949339449f, 0.519365489f},
-std::array<float,2>{0.034233883f, 0.876019955f},
-std::array<float,2>{0.577940941f, 0.184000835f},
-std::array<float,2>{0.230582491f, 0.0684489757f},
-std::array<float,2>{0.668899655f, 0.787628531f},
-std::array<float,2>{0.448022008f, 0.665693641f},
-std::array<float,2>{0.80757165f, 0.415890515f},
-std::array<float,2>{0.357090801f, 0.0381207578f},
-std::array<float,2>{0.92751193f, 0.839137018f},
-std::array<float,2>{0.0743118599f, 0.74135083f},
-std::array<float,2>{0.561169207f, 0.493515223f},
-std::array<float,2>{0.135214642f, 0.277633965f},
-std::array<float,2>{0.737008691f, 0.564977586f},
-std::array<float,2>{0.394103378f, 0.997799098f},
-std::array<float,2>{0.869974017f, 0.19215706f},
-std::array<float,2>{0.472518563f, 0.392343253f},
-std::array<float,2>{0.751911223f, 0.6462273f},
-std::array<float,2>{0.211477488f, 0.771634042f},
-std::array<float,2>{0.655590892f, 0.114499182f},
-std::array<float,2>{0.0137021514f, 0.145719036f},
-std::array<float,2>{0.593889892f, 0.910058439f},
-std::array<float,2>{0.282641798f, 0.533322513f},
-std::array<float,2>{0.983772933f, 0.353687912f},
-std::array<float,2>{0.31045267f, 0.164836049f},
-std::array<float,2>{0.999364614f, 0.901887715f},
-std::array<float,2>{0.016811993f, 0.510855317f},
-std::array<float,2>{0.621982634f, 0.343272954f},
-std::array<float,2>{0.199153811f, 0.431931794f},
-std::array<float,2>{0.631405056f, 0.682254434f},
-std::array<float,2>{0.495881259f, 0.806840599f},
-std::array<float,2>{0.767264664f, 0.0868727863f},
-std::array<float,2>{0.384594589f, 0.291313052f},
-std::array<float,2>{0.846696496f, 0.615707517f},
-std::array<float,2>{0.14426893f, 0.943952203f},
-std::array<float,2>{0.722752213f, 0.249610022f},
-std::array<float,2>{0.0844122395f, 0.0257272683f},
-std::array<float,2>{0.541632056f, 0.874107122f},
-std::array<float,2>{0.359483153f, 0.709198177f},
-std::array<float,2>{0.912665427f, 0.453735679f},
-std::array<float,2>{0.454534382f, 0.0959075764f},
-std::array<float,2>{0.79091543f, 0.755720615f},
-std::array<float,2>{0.247469708f, 0.632777452f},
-std::array<float,2>{0.684657037f, 0.376606852f},
-std::array<float,2>{0.0606586039f, 0.365332603f},
-std::array<float,2>{0.584119737f, 0.547195196f},
-std::array<float,2>{0.270913839f, 0.935394347f},
-std::array<float,2>{0.954520941f, 0.127393425f},
-std::array<float,2>{0.321111977f, 0.480825901f},
-std::array<float,2>{0.89613533f, 0.733799577f},
-std::array<float,2>{0.102044143f, 0.81838423f},
-std::array<float,2>{0.502603829f, 0.0515535809f},
-std::array<float,2>{0.179218814f, 0.218038574f},
-std::array<float,2>{0.705060661f, 0.979681313f},
-std::array<float,2>{0.434811234f, 0.583854973f},
-std::array<float,2>{0.84289974f, 0.258409262f},
-std::array<float,2>{0.459074885f, 0.23257935f},
-std::array<float,2>{0.795380831f, 0.96204716f},
-std::array<float,2>{0.242871255f, 0.600647032f},
-std::array<float,2>{0.682388186f, 0.307106465f},
-std::array<float,2>{0.0571465865f, 0.443554163f},
-std::array<float,2>{0.57977587f, 0.69474411f},
-std::array<float,2>{0.265699923f, 0.857025862f},
-std::array<float,2>{0.957314074f, 0.0124494834f},
-std::array<float,2>{0.326219082f, 0.327551275f},
-std::array<float,2>{0.891298592f, 0.528491974f},
-std::array<float,2>{0.105732374f, 0.890564501f},
-std::array<float,2>{0.506029785f, 0.177302256f},
-std::array<float,2>{0.174605697f, 0.0727917105f},
-std::array<float,2>{0.708496034f, 0.789368153f},
-std::array<float,2>{0.431403458f, 0.658495128f},
-std::array<float,2>{0.837563515f, 0.411664546f},
-std::array<float,2>{0.308035403f, 0.0412942842f},
-std::array<float,2>{0.994810164f, 0.834369004f},
-std::array<float,2>{0.0195345674f, 0.743823051f},
-std::array<float,2>{0.61743784f, 0.486742824f},
-std::array<float,2>{0.200879335f, 0.266413987f},
-std::array<float,2>{0.627174258f, 0.574964702f},
-std::array<float,2>{0.498445809f, 0.990014672f},
-std::array<float,2>{0.772490799f, 0.200535074f},
-std::array<float,2>{0.38930437f, 0.404091835f},
-std::array<float,2>{0.84786725f, 0.65497607f},
-std::array<float,2>{0.148203433f, 0.779169858f},
-std::array<float,2>{0.71954f, 0.120195933f},
-std::array<float,2>{0.0807710588f, 0.155492082f},
-std::array<float,2>{0.545064867f, 0.914841592f},
-std::array<float,2>{0.367018163f, 0.539927542f},
-std::array<float,2>{0.906416714f, 0.345208585f},
-std::array<float,2>{0.353795916f, 0.163652152f},
-std::array<float,2>{0.924605787f, 0.897158206f},
-std::array<float,2>{0.0722968057f, 0.50121665f},
-std::array<float,2>{0.556842387f, 0.330355972f},
-std::array<float,2>{0.140208304f, 0.422012538f},
-std::array<float,2>{0.740194738f, 0.677714229f},
-std::array<float,2>{0.39706865f, 0.803682625f},
-std::array<float,2>{0.872013748f, 0.0799976736f},
-std::array<float,2>{0.476243883f, 0.288773298f},
-std::array<float,2>{0.756699264f, 0.620311439f},
-std::array<float,2>{0.218198597f, 0.951753497f},
-std::array<float,2>{0.652338028f, 0.24020344f},
-std::array<float,2>{0.0106425844f, 0.0205404498f},
-std::array<float,2>{0.598675311f, 0.866011798f},
-std::array<float,2>{0.285275578f, 0.717535436f},
-std::array<float,2>{0.980405927f, 0.46825254f},
-std::array<float,2>{0.421826661f, 0.10270068f},
-std::array<float,2>{0.819651842f, 0.764725208f},
-std::array<float,2>{0.162921846f, 0.638104498f},
-std::array<float,2>{0.697439432f, 0.387839437f},
-std::array<float,2>{0.11415562f, 0.371412992f},
-std::array<float,2>{0.520830989f, 0.559965789f},
-std::array<float,2>{0.331271976f, 0.922332406f},
-std::array<float,2>{0.887781799f, 0.133325651f},
-std::array<float,2>{0.252100587f, 0.469396025f},
-std::array<float,2>{0.947955668f, 0.722307742f},
-std::array<float,2>{0.0365105942f, 0.824946404f},
-std::array<float,2>{0.573497057f, 0.0576993152f},
-std::array<float,2>{0.227224395f, 0.205012545f},
-std::array<float,2>{0.664248347f, 0.974653482f},
-std::array<float,2>{0.449281365f, 0.588048816f},
-std::array<float,2>{0.809762001f, 0.25345239f},
-std::array<float,2>{0.404272765f, 0.131751239f},
-std::array<float,2>{0.859763384f, 0.930917382f},
-std::array<float,2>{0.131355226f, 0.554635704f},
-std::array<float,2>{0.746022582f, 0.359846473f},
-std::array<float,2>{0.0659431368f, 0.382712215f},
-std::array<float,2>{0.551755905f, 0.627832413f},
-std::array<float,2>{0.350414902f, 0.752204001f},
-std::array<float,2>{0.937230229f, 0.0999505073f},
-std::array<float,2>{0.293291956f, 0.262553871f},
-std::array<float,2>{0.975942254f, 0.579514146f},
-std::array<float,2>{0.0041141659f, 0.983245313f},
-std::array<float,2>{0.605266511f, 0.212496221f},
-std::array<float,2>{0.203649446f, 0.0497946627f},
-std::array<float,2>{0.645545065f, 0.815236449f},
-std::array<float,2>{0.477480233f, 0.72875911f},
-std::array<float,2>{0.764759958f, 0.476884454f},
-std::array<float,2>{0.34011972f, 0.0908204615f},
-std::array<float,2>{0.882388592f, 0.812344611f},
-std::array<float,2>{0.118626714f, 0.684460402f},
-std::array<float,2>{0.530590415f, 0.43532595f},
-std::array<float,2>{0.17011188f, 0.338037938f},
-std::array<float,2>{0.689592004f, 0.514344215f},
-std::array<float,2>{0.410739511f, 0.906069636f},
-std::array<float,2>{0.827731729f, 0.170869768f},
-std::array<float,2>{0.443243206f, 0.459480882f},
-std::array<float,2>{0.800983667f, 0.70312798f},
-std::array<float,2>{0.221047491f, 0.868997574f},
-std::array<float,2>{0.65677613f, 0.0276725776f},
-std::array<float,2>{0.0444760546f, 0.245501935f},
-std::array<float,2>{0.568927765f, 0.939882159f},
-std::array<float,2>{0.259446323f, 0.612229347f},
-std::array<float,2>{0.945051014f, 0.295347393f},
-std::array<float,2>{0.273483813f, 0.188819721f},
-std::array<float,2>{0.962382913f, 0.992329001f},
-std::array<float,2>{0.0507504568f, 0.566800773f},
-std::array<float,2>{0.588341415f, 0.273749918f},
-std::array<float,2>{0.238774642f, 0.499920517f},
-std::array<float,2>{0.673576057f, 0.736685336f},
-std::array<float,2>{0.462809801f, 0.843037724f},
-std::array<float,2>{0.783465385f, 0.0328071155f},
-std::array<float,2>{0.427973837f, 0.358290792f},
-std::array<float,2>{0.831035137f, 0.53887701f},
-std::array<float,2>{0.184887782f, 0.910619259f},
-std::array<float,2>{0.714923322f, 0.143132746f},
-std::array<float,2>{0.0965988934f, 0.109590724f},
-std::array<float,2>{0.512969673f, 0.768393576f},
-std::array<float,2>{0.314448088f, 0.643136621f},
-std::array<float,2>{0.90356046f, 0.395749152f},
-std::array<float,2>{0.488088936f, 0.00525402371f},
-std::array<float,2>{0.781207144f, 0.844864249f},
-std::array<float,2>{0.190307915f, 0.69893223f},
-std::array<float,2>{0.634804904f, 0.451384366f},
-std::array<float,2>{0.0292118546f, 0.298455745f},
-std::array<float,2>{0.610224903f, 0.607508004f},
-std::array<float,2>{0.300294578f, 0.95480293f},
-std::array<float,2>{0.988668025f, 0.222322911f},
-std::array<float,2>{0.370482773f, 0.420554817f},
-std::array<float,2>{0.921808183f, 0.669812143f},
-std::array<float,2>{0.0917368531f, 0.783367276f},
-std::array<float,2>{0.533234775f, 0.0645717531f},
-std::array<float,2>{0.150834352f, 0.181738362f},
-std::array<float,2>{0.729622245f, 0.879288912f},
-std::array<float,2>{0.379832208f, 0.523361325f},
-std::array<float,2>{0.854447007f, 0.31899941f},
-std::array<float,2>{0.480764538f, 0.174960732f},
-std::array<float,2>{0.759148657f, 0.883591115f},
-std::array<float,2>{0.20949842f, 0.524065435f},
-std::array<float,2>{0.642970324f, 0.320528626f},
-std::array<float,2>{0.000758673297f, 0.409644544f},
-std::array<float,2>{0.608846426f, 0.663166106f},
-std::array<float,2>{0.29165411f, 0.792983651f},
-std::array<float,2>{0.970909715f, 0.0767826438f},
-std::array<float,2>{0.345466822f, 0.311248481f},
-std::array<float,2>{0.932582319f, 0.594600439f},
-std::array<float,2>{0.0689382777f, 0.968372107f},
-std::array<float,2>{0.548732519f, 0.22888808f},
-std::array<float,2>{0.125489503f, 0.0105419243f},
-std::array<float,2>{0.749740124f, 0.854697824f},
-std::array<float,2>{0.399510831f, 0.687583685f},
-std::array<float,2>{0.865202963f, 0.438002914f},
-std::array<float,2>{0.262193143f, 0.124130294f},
-std::array<float,2>{0.938480139f, 0.774083436f},
-std::array<float,2>{0.0406483039f, 0.649832666f},
-std::array<float,2>{0.562776327f, 0.401129127f},
-std::array<float,2>{0.225266159f, 0.349407852f},
-std::array<float,2>{0.662746727f, 0.544253945f},
-std::array<float,2>{0.439381182f, 0.919446111f},
-std::array<float,2>{0.800713956f, 0.150452331f},
-std::array<float,2>{0.407586843f, 0.491869688f},
-std::array<float,2>{0.822360814f, 0.747662783f},
-std::array<float,2>{0.166838542f, 0.829430401f},
-std::array<float,2>{0.69489038f, 0.044492729f},
-std::array<float,2>{0.122457623f, 0.19665736f},
-std::array<float,2>{0.526873052f, 0.987959981f},
-std::array<float,2>{0.338390678f, 0.573191285f},
-std::array<float,2>{0.878228486f, 0.271636128f},
-std::array<float,2>{0.318592846f, 0.236341625f},
-std::array<float,2>{0.900044739f, 0.946030498f},
-std::array<float,2>{0.0994158089f, 0.624715269f},
-std::array<float,2>{0.509312868f, 0.284736902f},
-std::array<float,2>{0.182275832f, 0.464253962f},
-std::array<float,2>{0.71404916f, 0.711896122f},
-std::array<float,2>{0.424821407f, 0.86069566f},
-std::array<float,2>{0.832134247f, 0.0164845064f},
-std::array<float,2>{0.468435913f, 0.333039761f},
-std::array<float,2>{0.787099719f, 0.505595565f},
-std::array<float,2>{0.236873716f, 0.89410305f},
-std::array<float,2>{0.676056623f, 0.159579948f},
-std::array<float,2>{0.0545218661f, 0.0848641172f},
-std::array<float,2>{0.592494011f, 0.79902488f},
-std::array<float,2>{0.278253019f, 0.673271716f},
-std::array<float,2>{0.966294944f, 0.427430451f},
-std::array<float,2>{0.377025485f, 0.0609855987f},
-std::array<float,2>{0.85708034f, 0.823802173f},
-std::array<float,2>{0.154844075f, 0.724931598f},
-std::array<float,2>{0.731682837f, 0.476313174f},
-std::array<float,2>{0.0895380154f, 0.257399499f},
-std::array<float,2>{0.535360515f, 0.593103409f},
-std::array<float,2>{0.374259233f, 0.971313059f},
-std::array<float,2>{0.915042996f, 0.209520206f},
-std::array<float,2>{0.301465183f, 0.385804594f},
-std::array<float,2>{0.986062825f, 0.635387838f},
-std::array<float,2>{0.0253373943f, 0.761012137f},
-std::array<float,2>{0.614050269f, 0.108227305f},
-std::array<float,2>{0.192290068f, 0.138645142f},
-std::array<float,2>{0.639528692f, 0.929004014f},
-std::array<float,2>{0.490581512f, 0.557428777f},
-std::array<float,2>{0.773984671f, 0.369378179f},
-std::array<float,2>{0.434240699f, 0.215882316f},
-std::array<float,2>{0.842042923f, 0.976834178f},
-std::array<float,2>{0.178360164f, 0.584811509f},
-std::array<float,2>{0.704062641f, 0.26038295f},
-std::array<float,2>{0.103358276f, 0.483086705f},
-std::array<float,2>{0.50342375f, 0.732101202f},
-std::array<float,2>{0.321748376f, 0.817007005f},
-std::array<float,2>{0.895411611f, 0.0532370545f},
-std::array<float,2>{0.270111799f, 0.36521104f},
-std::array<float,2>{0.95348686f, 0.550535023f},
-std::array<float,2>{0.0622638837f, 0.936099052f},
-std::array<float,2>{0.585249245f, 0.125363678f},
-std::array<float,2>{0.246498108f, 0.0955123007f},
-std::array<float,2>{0.684272826f, 0.757089555f},
-std::array<float,2>{0.453825921f, 0.630014062f},
-std::array<float,2>{0.789925754f, 0.377461135f},
-std::array<float,2>{0.360485286f, 0.0239994451f},
-std::array<float,2>{0.913133442f, 0.872733891f},
-std::array<float,2>{0.0858645663f, 0.707960606f},
-std::array<float,2>{0.542856753f, 0.456256628f},
-std::array<float,2>{0.143036753f, 0.289151877f},
-std::array<float,2>{0.723655879f, 0.614892304f},
-std::array<float,2>{0.383774132f, 0.941994667f},
-std::array<float,2>{0.846653283f, 0.246742472f},
-std::array<float,2>{0.494247884f, 0.431329101f},
-std::array<float,2>{0.766156316f, 0.680116832f},
-std::array<float,2>{0.197993547f, 0.805304348f},
-std::array<float,2>{0.632591903f, 0.0892225653f},
-std::array<float,2>{0.0165795181f, 0.166524097f},
-std::array<float,2>{0.622870088f, 0.899699986f},
-std::array<float,2>{0.30890891f, 0.509472072f},
-std::array<float,2>{0.998662651f, 0.341338366f},
-std::array<float,2>{0.281841159f, 0.147580549f},
-std::array<float,2>{0.982985079f, 0.906687915f},
-std::array<float,2>{0.014695337f, 0.531836212f},
-std::array<float,2>{0.595628381f, 0.352633387f},
-std::array<float,2>{0.212540582f, 0.393053591f},
-std::array<float,2>{0.654319227f, 0.648281217f},
-std::array<float,2>{0.471171111f, 0.770927727f},
-std::array<float,2>{0.750301838f, 0.117117845f},
-std::array<float,2>{0.392634302f, 0.279384851f},
-std::array<float,2>{0.87054348f, 0.563128173f},
-std::array<float,2>{0.13587524f, 0.999650419f},
-std::array<float,2>{0.738260448f, 0.1933617f},
-std::array<float,2>{0.0752343982f, 0.0368508026f},
-std::array<float,2>{0.561765611f, 0.836131275f},
-std::array<float,2>{0.355614603f, 0.739493847f},
-std::array<float,2>{0.926312387f, 0.495308787f},
-std::array<float,2>{0.448708832f, 0.0673698038f},
-std::array<float,2>{0.807697892f, 0.786420345f},
-std::array<float,2>{0.232194826f, 0.667780936f},
-std::array<float,2>{0.669906855f, 0.417491317f},
-std::array<float,2>{0.0341097526f, 0.312678277f},
-std::array<float,2>{0.576385856f, 0.516075969f},
-std::array<float,2>{0.254406005f, 0.878238142f},
-std::array<float,2>{0.95054698f, 0.186840177f},
-std::array<float,2>{0.335181653f, 0.4475995f},
-std::array<float,2>{0.885950327f, 0.699723184f},
-std::array<float,2>{0.110276058f, 0.849907458f},
-std::array<float,2>{0.518996239f, 0.00363851199f},
-std::array<float,2>{0.158848509f, 0.223044008f},
-std::array<float,2>{0.703028738f, 0.957780123f},
-std::array<float,2>{0.414744318f, 0.604138851f},
-std::array<float,2>{0.815201342f, 0.302238971f},
-std::array<float,2>{0.496725351f, 0.202167854f},
-std::array<float,2>{0.770000041f, 0.991239905f},
-std::array<float,2>{0.201596946f, 0.57760632f},
-std::array<float,2>{0.626443207f, 0.268591464f},
-std::array<float,2>{0.0216066986f, 0.485014886f},
-std::array<float,2>{0.619806945f, 0.745490253f},
-std::array<float,2>{0.30471772f, 0.833824456f},
-std::array<float,2>{0.994091272f, 0.0398349948f},
-std::array<float,2>{0.363351494f, 0.345732987f},
-std::array<float,2>{0.909601688f, 0.54114902f},
-std::array<float,2>{0.0796949938f, 0.916880846f},
-std::array<float,2>{0.544155717f, 0.152840912f},
-std::array<float,2>{0.145694867f, 0.11727415f},
-std::array<float,2>{0.72253108f, 0.779410779f},
-std::array<float,2>{0.388097048f, 0.652955711f},
-std::array<float,2>{0.850461304f, 0.404637009f},
-std::array<float,2>{0.269185662f, 0.0141749261f},
-std::array<float,2>{0.960086048f, 0.857644856f},
-std::array<float,2>{0.0562641397f, 0.693197429f},
-std::array<float,2>{0.58046335f, 0.442093432f},
-std::array<float,2>{0.245977834f, 0.306560844f},
-std::array<float,2>{0.680433095f, 0.598563313f},
-std::array<float,2>{0.457725376f, 0.964562476f},
-std::array<float,2>{0.794609666f, 0.230665684f},
-std::array<float,2>{0.432763189f, 0.412423998f},
-std::array<float,2>{0.837958753f, 0.656682312f},
-std::array<float,2>{0.17221345f, 0.791595876f},
-std::array<float,2>{0.710244775f, 0.0722286925f},
-std::array<float,2>{0.107928798f, 0.178202376f},
-std::array<float,2>{0.505660117f, 0.887434721f},
-std::array<float,2>{0.324638993f, 0.530474722f},
-std::array<float,2>{0.893340349f, 0.325998783f},
-std::array<float,2>{0.328423232f, 0.13533403f},
-std::array<float,2>{0.888913274f, 0.924875915f},
-std::array<float,2>{0.1162121f, 0.561036348f},
-std::array<float,2>{0.521966577f, 0.37371853f},
-std::array<float,2>{0.16189371f, 0.390378028f},
-std::array<float,2>{0.69603461f, 0.640593708f},
-std::array<float,2>{0.41862902f, 0.762819231f},
-std::array<float,2>{0.817734778f, 0.104751088f},
-std::array<float,2>{0.451843888f, 0.251720816f},
-std::array<float,2>{0.812323272f, 0.587216258f},
-std::array<float,2>{0.229342803f, 0.973602831f},
-std::array<float,2>{0.666758239f, 0.206274629f},
-std::array<float,2>{0.0385724679f, 0.05470521f},
-std::array<float,2>{0.570480347f, 0.82661742f},
-std::array<float,2>{0.250295162f, 0.718968332f},
-std::array<float,2>{0.94702363f, 0.47083807f},
-std::array<float,2>{0.395875663f, 0.0802516639f},
-std::array<float,2>{0.873443186f, 0.800818741f},
-std::array<float,2>{0.137273416f, 0.678780198f},
-std::array<float,2>{0.741379261f, 0.42384842f},
-std::array<float,2>{0.0714472011f, 0.328269809f},
-std::array<float,2>{0.555187166f, 0.503021419f},
-std::array<float,2>{0.35157463f, 0.895172536f},
-std::array<float,2>{0.922294855f, 0.161708668f},
-std::array<float,2>{0.288286f, 0.464951724f},
-std::array<float,2>{0.978341341f, 0.716694653f},
-std::array<float,2>{0.0097476542f, 0.863808095f},
-std::array<float,2>{0.600036442f, 0.023332553f},
-std::array<float,2>{0.215057671f, 0.242050111f},
-std::array<float,2>{0.648785889f, 0.950213373f},
-std::array<float,2>{0.473045707f, 0.617967546f},
-std::array<float,2>{0.755246699f, 0.286881298f},
-std::array<float,2>{0.412589312f, 0.1690512f},
-std::array<float,2>{0.826112688f, 0.903796971f},
-std::array<float,2>{0.168174714f, 0.512239754f},
-std::array<float,2>{0.689007044f, 0.33714807f},
-std::array<float,2>{0.119255707f, 0.436508447f},
-std::array<float,2>{0.527547896f, 0.68572396f},
-std::array<float,2>{0.34251827f, 0.809901893f},
-std::array<float,2>{0.880798697f, 0.0926080495f},
-std::array<float,2>{0.260534912f, 0.292977333f},
-std::array<float,2>{0.942788005f, 0.609536886f},
-std::array<float,2>{0.0450495034f, 0.939182103f},
-std::array<float,2>{0.56723839f, 0.242616981f},
-std::array<float,2>{0.220065385f, 0.0305130295f},
-std::array<float,2>{0.659796476f, 0.870260537f},
-std::array<float,2>{0.444399148f, 0.706744075f},
-std::array<float,2>{0.803646922f, 0.45893234f},
-std::array<float,2>{0.349231273f, 0.0976988897f},
-std::array<float,2>{0.9353531f, 0.750833154f},
-std::array<float,2>{0.0631884634f, 0.62640816f},
-std::array<float,2>{0.552838564f, 0.379807174f},
-std::array<float,2>{0.129232854f, 0.362633497f},
-std::array<float,2>{0.742454946f, 0.552340984f},
-std::array<float,2>{0.404649526f, 0.931646526f},
-std::array<float,2>{0.861689866f, 0.129742041f},
-std::array<float,2>{0.478989363f, 0.48029539f},
-std::array<float,2>{0.76244849f, 0.726605654f},
-std::array<float,2>{0.205951631f, 0.814055443f},
-std::array<float,2>{0.646862924f, 0.0472131856f},
-std::array<float,2>{0.00714198779f, 0.214231595f},
-std::array<float,2>{0.601676464f, 0.981938958f},
-std::array<float,2>{0.296405137f, 0.580778778f},
-std::array<float,2>{0.973758101f, 0.264364004f},
-std::array<float,2>{0.298290849f, 0.219333589f},
-std::array<float,2>{0.991133988f, 0.956167459f},
-std::array<float,2>{0.0307886917f, 0.606626749f},
-std::array<float,2>{0.612615108f, 0.299653739f},
-std::array<float,2>{0.188704938f, 0.45000416f},
-std::array<float,2>{0.63297677f, 0.697263956f},
-std::array<float,2>{0.485961676f, 0.847133815f},
-std::array<float,2>{0.778449237f, 0.00705241272f},
-std::array<float,2>{0.382010192f, 0.316631287f},
-std::array<float,2>{0.852851689f, 0.520984232f},
-std::array<float,2>{0.149799407f, 0.880919635f},
-std::array<float,2>{0.728105605f, 0.180062041f},
-std::array<float,2>{0.0934168696f, 0.0629671961f},
-std::array<float,2>{0.531994045f, 0.781961799f},
-std::array<float,2>{0.367444515f, 0.670856833f},
-std::array<float,2>{0.919656754f, 0.419386119f},
-std::array<float,2>{0.46302101f, 0.0336112827f},
-std::array<float,2>{0.782378018f, 0.839879692f},
-std::array<float,2>{0.242156535f, 0.734660447f},
-std::array<float,2>{0.674272358f, 0.497647882f},
-std::array<float,2>{0.0480391532f, 0.275581092f},
-std::array<float,2>{0.586984992f, 0.568522871f},
-std::array<float,2>{0.277036428f, 0.994463801f},
-std::array<float,2>{0.964796305f, 0.189692289f},
-std::array<float,2>{0.315434039f, 0.397852153f},
-std::array<float,2>{0.905676842f, 0.64237076f},
-std::array<float,2>{0.0954580158f, 0.766116381f},
-std::array<float,2>{0.514590323f, 0.111651614f},
-std::array<float,2>{0.185852647f, 0.141945943f},
-std::array<float,2>{0.717293561f, 0.912129164f},
-std::array<float,2>{0.426890224f, 0.536201119f},
-std::array<float,2>{0.828134358f, 0.356831342f},
-std::array<float,2>{0.439573228f, 0.149118394f},
-std::array<float,2>{0.798805892f, 0.920726717f},
-std::array<float,2>{0.224214077f, 0.545634151f},
-std::array<float,2>{0.661459982f, 0.350402534f},
-std::array<float,2>{0.0412250049f, 0.398642957f},
-std::array<float,2>{0.564649463f, 0.650415778f},
-std::array<float,2>{0.264258742f, 0.775893211f},
-std::array<float,2>{0.940905035f, 0.121129654f},
-std::array<float,2>{0.337127507f, 0.269733697f},
-std::array<float,2>{0.875908315f, 0.570512354f},
-std::array<float,2>{0.124813139f, 0.986282706f},
-std::array<float,2>{0.525081635f, 0.199021772f},
-std::array<float,2>{0.165475383f, 0.0459865369f},
-std::array<float,2>{0.693029165f, 0.831642687f},
-std::array<float,2>{0.409561425f, 0.749054551f},
-std::array<float,2>{0.821253657f, 0.490188241f},
-std::array<float,2>{0.29048115f, 0.0760353878f},
-std::array<float,2>{0.970143855f, 0.796785176f},
-std::array<float,2>{0.00255053258f, 0.661887169f},
-std::array<float,2>{0.605701685f, 0.406880468f},
-std::array<float,2>{0.207096979f, 0.322318584f},
-std::array<float,2>{0.640650809f, 0.526018441f},
-std::array<float,2>{0.48369813f, 0.884864271f},
-std::array<float,2>{0.761479139f, 0.172380731f},
-std::array<float,2>{0.400725007f, 0.440695643f},
-std::array<float,2>{0.865880132f, 0.691302359f},
-std::array<float,2>{0.127312437f, 0.852278948f},
-std::array<float,2>{0.747264326f, 0.0087927971f},
-std::array<float,2>{0.0681969449f, 0.228312731f},
-std::array<float,2>{0.549551547f, 0.965469062f},
-std::array<float,2>{0.346193045f, 0.596524954f},
-std::array<float,2>{0.931591213f, 0.309699386f},
-std::array<float,2>{0.373030066f, 0.207248956f},
-std::array<float,2>{0.917716861f, 0.969808638f},
-std::array<float,2>{0.0864690319f, 0.590726972f},
-std::array<float,2>{0.537627876f, 0.254344225f},
-std::array<float,2>{0.152583793f, 0.473541796f},
-std::array<float,2>{0.734242022f, 0.723768651f},
-std::array<float,2>{0.376796216f, 0.821249008f},
-std::array<float,2>{0.858680189f, 0.0604557581f},
-std::array<float,2>{0.488353312f, 0.368285865f},
-std::array<float,2>{0.775647283f, 0.556278884f},
-std::array<float,2>{0.194818139f, 0.927197456f},
-std::array<float,2>{0.637618542f, 0.138991237f},
-std::array<float,2>{0.0260306355f, 0.106633827f},
-std::array<float,2>{0.616263509f, 0.759729266f},
-std::array<float,2>{0.303082138f, 0.632847428f},
-std::array<float,2>{0.986337841f, 0.384042174f},
-std::array<float,2>{0.421890855f, 0.0192156862f},
-std::array<float,2>{0.834030569f, 0.862137675f},
-std::array<float,2>{0.181292087f, 0.713183045f},
-std::array<float,2>{0.712401748f, 0.462492585f},
-std::array<float,2>{0.100988865f, 0.282708228f},
-std::array<float,2>{0.510007322f, 0.621382654f},
-std::array<float,2>{0.31755355f, 0.947572112f},
-std::array<float,2>{0.902032793f, 0.235419065f},
-std::array<float,2>{0.281218767f, 0.428941727f},
-std::array<float,2>{0.967908442f, 0.675149322f},
-std::array<float,2>{0.0509653799f, 0.796932161f},
-std::array<float,2>{0.590081573f, 0.0824749842f},
-std::array<float,2>{0.2356558f, 0.156728819f},
-std::array<float,2>{0.678583264f, 0.89120692f},
-std::array<float,2>{0.466171205f, 0.507628381f},
-std::array<float,2>{0.787284672f, 0.335742682f},
-std::array<float,2>{0.384877712f, 0.248200104f},
-std::array<float,2>{0.845574975f, 0.944700062f},
-std::array<float,2>{0.142107099f, 0.616286218f},
-std::array<float,2>{0.726072371f, 0.29288581f},
-std::array<float,2>{0.0827032626f, 0.454955071f},
-std::array<float,2>{0.540297687f, 0.710804999f},
-std::array<float,2>{0.362729162f, 0.873839438f},
-std::array<float,2>{0.911342263f, 0.0266675279f},
-std::array<float,2>{0.312382549f, 0.342468381f},
-std::array<float,2>{0.997234464f, 0.509939432f},
-std::array<float,2>{0.0180820078f, 0.900428653f},
-std::array<float,2>{0.623747468f, 0.165112197f},
-std::array<float,2>{0.195868164f, 0.0876979306f},
-std::array<float,2>{0.629883528f, 0.808510661f},
-std::array<float,2>{0.493299991f, 0.682692111f},
-std::array<float,2>{0.768070698f, 0.433375597f},
-std::array<float,2>{0.324128449f, 0.0517954417f},
-std::array<float,2>{0.896675408f, 0.819745183f},
-std::array<float,2>{0.103734456f, 0.732745588f},
-std::array<float,2>{0.501458943f, 0.48186028f},
-std::array<float,2>{0.176357999f, 0.259360999f},
-std::array<float,2>{0.706460476f, 0.582648456f},
-std::array<float,2>{0.437314689f, 0.978573918f},
-std::array<float,2>{0.840714097f, 0.217396855f},
-std::array<float,2>{0.45581615f, 0.375034422f},
-std::array<float,2>{0.791137934f, 0.631289363f},
-std::array<float,2>{0.248346522f, 0.754362524f},
-std::array<float,2>{0.686852396f, 0.0968465507f},
-std::array<float,2>{0.05977723f, 0.12838991f},
-std::array<float,2>{0.582162738f, 0.93375504f},
-std::array<float,2>{0.271708518f, 0.547926426f},
-std::array<float,2>{0.955278277f, 0.36667034f},
-std::array<float,2>{0.257619649f, 0.185048148f},
-std::array<float,2>{0.951239705f, 0.875940859f},
-std::array<float,2>{0.0324864872f, 0.518000066f},
-std::array<float,2>{0.574544966f, 0.314936787f},
-std::array<float,2>{0.23335366f, 0.414902538f},
-std::array<float,2>{0.671478271f, 0.664516151f},
-std::array<float,2>{0.446275353f, 0.788238049f},
-std::array<float,2>{0.80644846f, 0.069361411f},
-std::array<float,2>{0.417958915f, 0.303450823f},
-std::array<float,2>{0.812926233f, 0.602152467f},
-std::array<float,2>{0.156362623f, 0.960222065f},
-std::array<float,2>{0.699619889f, 0.225391924f},
-std::array<float,2>{0.11244563f, 0.00149549218f},
-std::array<float,2>{0.517150283f, 0.849282444f},
-std::array<float,2>{0.333422333f, 0.702183366f},
-std::array<float,2>{0.883496106f, 0.446542233f},
-std::array<float,2>{0.470660657f, 0.113408267f},
-std::array<float,2>{0.75269562f, 0.772796333f},
-std::array<float,2>{0.214000627f, 0.644585073f},
-std::array<float,2>{0.654233575f, 0.3909567f},
-std::array<float,2>{0.0130668404f, 0.354704678f},
-std::array<float,2>{0.5959149f, 0.534925103f},
-std::array<float,2>{0.284085929f, 0.908212602f},
-std::array<float,2>{0.982287347f, 0.144941971f},
-std::array<float,2>{0.358037412f, 0.492282718f},
-std::array<float,2>{0.928542495f, 0.74086988f},
-std::array<float,2>{0.0765642673f, 0.838528812f},
-std::array<float,2>{0.558956265f, 0.0372569636f},
-std::array<float,2>{0.133523419f, 0.192790404f},
-std::array<float,2>{0.734729528f, 0.996256053f},
-std::array<float,2>{0.391399652f, 0.565965712f},
-std::array<float,2>{0.868026614f, 0.279046476f},
-std::array<float,2>{0.485809833f, 0.222038642f},
-std::array<float,2>{0.77881813f, 0.954240739f},
-std::array<float,2>{0.188994139f, 0.607946575f},
-std::array<float,2>{0.633508086f, 0.298071414f},
-std::array<float,2>{0.0303731244f, 0.45211184f},
-std::array<float,2>{0.613155365f, 0.698265553f},
-std::array<float,2>{0.298410654f, 0.845626056f},
-std::array<float,2>{0.990329444f, 0.00537682045f},
-std::array<float,2>{0.367868692f, 0.318686306f},
-std::array<float,2>{0.919166863f, 0.522938907f},
-std::array<float,2>{0.0929969847f, 0.879514873f},
-std::array<float,2>{0.531695843f, 0.182488322f},
-std::array<float,2>{0.150153503f, 0.0652976781f},
-std::array<float,2>{0.727691114f, 0.783901989f},
-std::array<float,2>{0.382477492f, 0.669249654f},
-std::array<float,2>{0.853222668f, 0.42040053f},
-std::array<float,2>{0.27676931f, 0.0326256864f},
-std::array<float,2>{0.963931799f, 0.843517363f},
-std::array<float,2>{0.0486953333f, 0.737125039f},
-std::array<float,2>{0.587626338f, 0.499438256f},
-std::array<float,2>{0.241289958f, 0.274288416f},
-std::array<float,2>{0.674593747f, 0.566980124f},
-std::array<float,2>{0.463503271f, 0.992989421f},
-std::array<float,2>{0.782924175f, 0.189428523f},
-std::array<float,2>{0.427657932f, 0.39634642f},
-std::array<float,2>{0.82902813f, 0.643015265f},
-std::array<float,2>{0.18645148f, 0.767875075f},
-std::array<float,2>{0.717005134f, 0.110101946f},
-std::array<float,2>{0.095044367f, 0.142718032f},
-std::array<float,2>{0.51388526f, 0.910814404f},
-std::array<float,2>{0.316120535f, 0.538210392f},
-std::array<float,2>{0.906167865f, 0.357597023f},
-std::array<float,2>{0.341851473f, 0.16999732f},
-std::array<float,2>{0.880319893f, 0.90569222f},
-std::array<float,2>{0.119658098f, 0.514043748f},
-std::array<float,2>{0.528035581f, 0.338658512f},
-std::array<float,2>{0.16894491f, 0.434831679f},
-std::array<float,2>{0.688924789f, 0.683980107f},
-std::array<float,2>{0.412982672f, 0.811729193f},
-std::array<float,2>{0.825524867f, 0.0914376155f},
-std::array<float,2>{0.444871694f, 0.29542917f},
-std::array<float,2>{0.802747726f, 0.611784637f},
-std::array<float,2>{0.220242053f, 0.940258741f},
-std::array<float,2>{0.659575462f, 0.246011451f},
-std::array<float,2>{0.0457571037f, 0.0279569551f},
-std::array<float,2>{0.566664457f, 0.868443727f},
-std::array<float,2>{0.260103673f, 0.703831911f},
-std::array<float,2>{0.94303745f, 0.459162444f},
-std::array<float,2>{0.40515545f, 0.100379311f},
-std::array<float,2>{0.861846507f, 0.752596617f},
-std::array<float,2>{0.129518002f, 0.627037048f},
-std::array<float,2>{0.742741764f, 0.382171601f},
-std::array<float,2>{0.0628491491f, 0.359948814f},
-std::array<float,2>{0.553361773f, 0.553783774f},
-std::array<float,2>{0.348670125f, 0.931452215f},
-std::array<float,2>{0.934871078f, 0.131031081f},
-std::array<float,2>{0.29594785f, 0.477171928f},
-std::array<float,2>{0.974576831f, 0.729146779f},
-std::array<float,2>{0.00777293183f, 0.814906955f},
-std::array<float,2>{0.602502167f, 0.0490119606f},
-std::array<float,2>{0.205290213f, 0.212384596f},
-std::array<float,2>{0.647405803f, 0.982690156f},
-std::array<float,2>{0.479468137f, 0.579618812f},
-std::array<float,2>{0.762078047f, 0.261839956f},
-std::array<float,2>{0.417975277f, 0.133098856f},
-std::array<float,2>{0.818224967f, 0.922684014f},
-std::array<float,2>{0.161158442f, 0.560193837f},
-std::array<float,2>{0.69549793f, 0.372063249f},
-std::array<float,2>{0.117177427f, 0.388188422f},
-std::array<float,2>{0.522037029f, 0.638519824f},
-std::array<float,2>{0.328999817f, 0.765621662f},
-std::array<float,2>{0.889341354f, 0.10303136f},
-std::array<float,2>{0.250585884f, 0.253080487f},
-std::array<float,2>{0.946418107f, 0.588576436f},
-std::array<float,2>{0.0388575718f, 0.975146115f},
-std::array<float,2>{0.570806146f, 0.204144686f},
-std::array<float,2>{0.228697404f, 0.0581109859f},
-std::array<float,2>{0.666470587f, 0.824348629f},
-std::array<float,2>{0.45155549f, 0.721886516f},
-std::array<float,2>{0.811653554f, 0.469189346f},
-std::array<float,2>{0.352167249f, 0.0794341564f},
-std::array<float,2>{0.922554553f, 0.802929759f},
-std::array<float,2>{0.0720273778f, 0.676760674f},
-std::array<float,2>{0.554942429f, 0.422786027f},
-std::array<float,2>{0.136862531f, 0.330625981f},
-std::array<float,2>{0.742120862f, 0.501674652f},
-std::array<float,2>{0.396408647f, 0.89692843f},
-std::array<float,2>{0.87392205f, 0.163131505f},
-std::array<float,2>{0.473226547f, 0.468423635f},
-std::array<float,2>{0.755535483f, 0.717157185f},
-std::array<float,2>{0.215576351f, 0.865331769f},
-std::array<float,2>{0.649217427f, 0.0212460961f},
-std::array<float,2>{0.00898768008f, 0.239593878f},
-std::array<float,2>{0.600137293f, 0.951185405f},
-std::array<float,2>{0.288991868f, 0.620916605f},
-std::array<float,2>{0.977914631f, 0.288332015f},
-std::array<float,2>{0.305620641f, 0.200882152f},
-std::array<float,2>{0.993166924f, 0.989668667f},
-std::array<float,2>{0.0222866833f, 0.574468434f},
-std::array<float,2>{0.619320452f, 0.26602158f},
-std::array<float,2>{0.201760113f, 0.487098455f},
-std::array<float,2>{0.626833677f, 0.743538082f},
-std::array<float,2>{0.496454149f, 0.83488214f},
-std::array<float,2>{0.770434976f, 0.0419091098f},
-std::array<float,2>{0.388235062f, 0.345240772f},
-std::array<float,2>{0.849944949f, 0.539539397f},
-std::array<float,2>{0.146216214f, 0.914158821f},
-std::array<float,2>{0.721838534f, 0.155779585f},
-std::array<float,2>{0.0792374089f, 0.121055476f},
-std::array<float,2>{0.544814646f, 0.778326333f},
-std::array<float,2>{0.363906682f, 0.654627204f},
-std::array<float,2>{0.909700513f, 0.40349412f},
-std::array<float,2>{0.457239717f, 0.0119186379f},
-std::array<float,2>{0.794293523f, 0.856658936f},
-std::array<float,2>{0.245445058f, 0.694972515f},
-std::array<float,2>{0.67993319f, 0.444057465f},
-std::array<float,2>{0.0558621734f, 0.307204276f},
-std::array<float,2>{0.580732644f, 0.601076126f},
-std::array<float,2>{0.268689185f, 0.962723255f},
-std::array<float,2>{0.960642815f, 0.233019561f},
-std::array<float,2>{0.325000137f, 0.411356777f},
-std::array<float,2>{0.892709672f, 0.659041107f},
-std::array<float,2>{0.107456163f, 0.789860845f},
-std::array<float,2>{0.505065441f, 0.0726946965f},
-std::array<float,2>{0.172768995f, 0.177126125f},
-std::array<float,2>{0.710715175f, 0.889868557f},
-std::array<float,2>{0.43316707f, 0.529138863f},
-std::array<float,2>{0.838671684f, 0.327881485f},
-std::array<float,2>{0.445799321f, 0.187202051f},
-std::array<float,2>{0.805851579f, 0.87852937f},
-std::array<float,2>{0.232429788f, 0.516317308f},
-std::array<float,2>{0.671225905f, 0.313408405f},
-std::array<float,2>{0.032722719f, 0.417182326f},
-std::array<float,2>{0.574955523f, 0.666994393f},
-std::array<float,2>{0.257230759f, 0.787025452f},
-std::array<float,2>{0.951674581f, 0.0666272938f},
-std::array<float,2>{0.333821476f, 0.302506924f},
-std::array<float,2>{0.882974863f, 0.603889346f},
-std::array<float,2>{0.113105543f, 0.957053125f},
-std::array<float,2>{0.516767204f, 0.223197311f},
-std::array<float,2>{0.157213688f, 0.00294561684f},
-std::array<float,2>{0.699723303f, 0.850427389f},
-std::array<float,2>{0.417450339f, 0.699582577f},
-std::array<float,2>{0.813219368f, 0.448112667f},
-std::array<float,2>{0.283595085f, 0.116230138f},
-std::array<float,2>{0.981691301f, 0.771474302f},
-std::array<float,2>{0.013386094f, 0.647762716f},
-std::array<float,2>{0.596199334f, 0.393352777f},
-std::array<float,2>{0.214447036f, 0.353504092f},
-std::array<float,2>{0.653715968f, 0.531645417f},
-std::array<float,2>{0.470192492f, 0.907018721f},
-std::array<float,2>{0.752420783f, 0.147955254f},
-std::array<float,2>{0.39089191f, 0.495944142f},
-std::array<float,2>{0.867421448f, 0.739904583f},
-std::array<float,2>{0.133179784f, 0.836906135f},
-std::array<float,2>{0.735334873f, 0.0366029777f},
-std::array<float,2>{0.0770125985f, 0.194103077f},
-std::array<float,2>{0.559320271f, 0.999338865f},
-std::array<float,2>{0.357841372f, 0.562864065f},
-std::array<float,2>{0.927873194f, 0.279915899f},
-std::array<float,2>{0.362915695f, 0.246094778f},
-std::array<float,2>{0.911965966f, 0.941534221f},
-std::array<float,2>{0.0821221024f, 0.614429951f},
-std::array<float,2>{0.540795565f, 0.289953321f},
-std::array<float,2>{0.141692609f, 0.45701018f},
-std::array<float,2>{0.726268113f, 0.707032561f},
-std::array<float,2>{0.385312051f, 0.872287333f},
-std::array<float,2>{0.845129907f, 0.0235786159f},
-std::array<float,2>{0.493756086f, 0.341272295f},
-std::array<float,2>{0.767703116f, 0.508829772f},
-std::array<float,2>{0.195581898f, 0.900176346f},
-std::array<float,2>{0.630616665f, 0.16649127f},
-std::array<float,2>{0.0178542119f, 0.0894877315f},
-std::array<float,2>{0.623363554f, 0.805172741f},
-std::array<float,2>{0.311980814f, 0.680496216f},
-std::array<float,2>{0.997943461f, 0.430996686f},
-std::array<float,2>{0.436586648f, 0.052833721f},
-std::array<float,2>{0.840017736f, 0.816861808f},
-std::array<float,2>{0.175858453f, 0.731836736f},
-std::array<float,2>{0.706687331f, 0.482699454f},
-std::array<float,2>{0.104014345f, 0.259901643f},
-std::array<float,2>{0.501499414f, 0.584456742f},
-std::array<float,2>{0.323455304f, 0.977379203f},
-std::array<float,2>{0.897274852f, 0.216409266f},
-std::array<float,2>{0.272342831f, 0.376982182f},
-std::array<float,2>{0.956048191f, 0.630383968f},
-std::array<float,2>{0.0600717142f, 0.757583797f},
-std::array<float,2>{0.582530916f, 0.0948358104f},
-std::array<float,2>{0.248649389f, 0.125915051f},
-std::array<float,2>{0.687218726f, 0.935622931f},
-std::array<float,2>{0.455309182f, 0.549845159f},
-std::array<float,2>{0.791847229f, 0.364314854f},
-std::array<float,2>{0.37613374f, 0.209255233f},
-std::array<float,2>{0.85934025f, 0.971108913f},
-std::array<float,2>{0.152876005f, 0.593550503f},
-std::array<float,2>{0.733504891f, 0.257107228f},
-std::array<float,2>{0.0860268921f, 0.476037979f},
-std::array<float,2>{0.5373227f, 0.725351214f},
-std::array<float,2>{0.372334659f, 0.823543191f},
-std::array<float,2>{0.917420685f, 0.061045792f},
-std::array<float,2>{0.303558379f, 0.369670689f},
-std::array<float,2>{0.986920655f, 0.556787789f},
-std::array<float,2>{0.0257953871f, 0.929626763f},
-std::array<float,2>{0.61682421f, 0.138042986f},
-std::array<float,2>{0.194892943f, 0.107797198f},
-std::array<float,2>{0.636869848f, 0.761669278f},
-std::array<float,2>{0.488787472f, 0.634852648f},
-std::array<float,2>{0.775956035f, 0.386348397f},
-std::array<float,2>{0.318342447f, 0.0157214031f},
-std::array<float,2>{0.901438653f, 0.861293197f},
-std::array<float,2>{0.101195097f, 0.711070359f},
-std::array<float,2>{0.510523438f, 0.464454681f},
-std::array<float,2>{0.181007758f, 0.284365267f},
-std::array<float,2>{0.712707639f, 0.624371052f},
-std::array<float,2>{0.422464281f, 0.945356607f},
-std::array<float,2>{0.834708631f, 0.236911982f},
-std::array<float,2>{0.466630697f, 0.42714268f},
-std::array<float,2>{0.787943423f, 0.673595905f},
-std::array<float,2>{0.236106709f, 0.79979068f},
-std::array<float,2>{0.677861392f, 0.0840168595f},
-std::array<float,2>{0.0512721278f, 0.159829721f},
-std::array<float,2>{0.590819359f, 0.893962443f},
-std::array<float,2>{0.280742824f, 0.504953742f},
-std::array<float,2>{0.968361616f, 0.333747804f},
-std::array<float,2>{0.263694823f, 0.15124473f},
-std::array<float,2>{0.941029072f, 0.919212997f},
-std::array<float,2>{0.0416576788f, 0.544506133f},
-std::array<float,2>{0.565210342f, 0.3489452f},
-std::array<float,2>{0.224070832f, 0.400575191f},
-std::array<float,2>{0.661652207f, 0.650119722f},
-std::array<float,2>{0.440338463f, 0.773504078f},
-std::array<float,2>{0.798122644f, 0.124586292f},
-std::array<float,2>{0.409844726f, 0.272004306f},
-std::array<float,2>{0.820499122f, 0.572478771f},
-std::array<float,2>{0.165761977f, 0.987380087f},
-std::array<float,2>{0.692744017f, 0.197162718f},
-std::array<float,2>{0.124351226f, 0.0441616513f},
-std::array<float,2>{0.524483144f, 0.830022514f},
-std::array<float,2>{0.337589592f, 0.747467875f},
-std::array<float,2>{0.875372291f, 0.491465032f},
-std::array<float,2>{0.484054267f, 0.0765932351f},
-std::array<float,2>{0.761145949f, 0.79381144f},
-std::array<float,2>{0.207867578f, 0.664018571f},
-std::array<float,2>{0.641220212f, 0.409884274f},
-std::array<float,2>{0.00243814592f, 0.320870668f},
-std::array<float,2>{0.606059194f, 0.523690343f},
-std::array<float,2>{0.290853322f, 0.882866025f},
-std::array<float,2>{0.970273137f, 0.175726339f},
-std::array<float,2>{0.346143603f, 0.437596917f},
-std::array<float,2>{0.930665314f, 0.68825376f},
-std::array<float,2>{0.0677035302f, 0.855148077f},
-std::array<float,2>{0.549143851f, 0.00977469422f},
-std::array<float,2>{0.1275924f, 0.22941193f},
-std::array<float,2>{0.74763453f, 0.968182802f},
-std::array<float,2>{0.401323646f, 0.593950331f},
-std::array<float,2>{0.865299463f, 0.311023861f},
-std::array<float,2>{0.462315381f, 0.190278575f},
-std::array<float,2>{0.784024179f, 0.994700551f},
-std::array<float,2>{0.238290519f, 0.568940938f},
-std::array<float,2>{0.67324698f, 0.275996685f},
-std::array<float,2>{0.0498929657f, 0.497198999f},
-std::array<float,2>{0.588609397f, 0.734864533f},
-std::array<float,2>{0.274089783f, 0.840498328f},
-std::array<float,2>{0.962651968f, 0.0340882353f},
-std::array<float,2>{0.313960969f, 0.357124686f},
-std::array<float,2>{0.903903782f, 0.53696841f},
-std::array<float,2>{0.0959488451f, 0.912990928f},
-std::array<float,2>{0.513461411f, 0.142282635f},
-std::array<float,2>{0.185325459f, 0.112148084f},
-std::array<float,2>{0.715702772f, 0.765978515f},
-std::array<float,2>{0.42838347f, 0.641655624f},
-std::array<float,2>{0.8302719f, 0.398004621f},
-std::array<float,2>{0.300189078f, 0.00740459561f},
-std::array<float,2>{0.988817155f, 0.847394705f},
-std::array<float,2>{0.0286215916f, 0.696372867f},
-std::array<float,2>{0.609836102f, 0.449284494f},
-std::array<float,2>{0.189642414f, 0.299313664f},
-std::array<float,2>{0.635500312f, 0.607268453f},
-std::array<float,2>{0.487419158f, 0.956609547f},
-std::array<float,2>{0.780428946f, 0.219030887f},
-std::array<float,2>{0.379312485f, 0.419779986f},
-std::array<float,2>{0.853787363f, 0.670315623f},
-std::array<float,2>{0.151283741f, 0.781508923f},
-std::array<float,2>{0.730131447f, 0.0633493811f},
-std::array<float,2>{0.0911224037f, 0.180468768f},
-std::array<float,2>{0.533807456f, 0.88164103f},
-std::array<float,2>{0.370610207f, 0.521100342f},
-std::array<float,2>{0.921087742f, 0.317248046f},
-std::array<float,2>{0.349841654f, 0.129003733f},
-std::array<float,2>{0.936582029f, 0.93259871f},
-std::array<float,2>{0.0658393279f, 0.552170753f},
-std::array<float,2>{0.551022351f, 0.363079876f},
-std::array<float,2>{0.131123021f, 0.379326582f},
-std::array<float,2>{0.745208025f, 0.626693964f},
-std::array<float,2>{0.403327733f, 0.750370979f},
-std::array<float,2>{0.860239923f, 0.0985391736f},
-std::array<float,2>{0.476701707f, 0.264018476f},
-std::array<float,2>{0.765176356f, 0.580497265f},
-std::array<float,2>{0.203439578f, 0.981839895f},
-std::array<float,2>{0.646266401f, 0.214440182f},
-std::array<float,2>{0.00448959786f, 0.0478301086f},
-std::array<float,2>{0.604496419f, 0.813864589f},
-std::array<float,2>{0.293558836f, 0.727343082f},
-std::array<float,2>{0.976475358f, 0.479878426f},
-std::array<float,2>{0.410246879f, 0.0921006426f},
-std::array<float,2>{0.827393532f, 0.81006968f},
-std::array<float,2>{0.170703351f, 0.686313093f},
-std::array<float,2>{0.690308094f, 0.435953051f},
-std::array<float,2>{0.119096577f, 0.337618679f},
-std::array<float,2>{0.53097707f, 0.512022734f},
-std::array<float,2>{0.340788513f, 0.904085517f},
-std::array<float,2>{0.882128954f, 0.169708431f},
-std::array<float,2>{0.258900285f, 0.458264381f},
-std::array<float,2>{0.944601357f, 0.706193745f},
-std::array<float,2>{0.0439692885f, 0.870800078f},
-std::array<float,2>{0.568697989f, 0.031144347f},
-std::array<float,2>{0.221438542f, 0.242907286f},
-std::array<float,2>{0.656463087f, 0.938769102f},
-std::array<float,2>{0.442446917f, 0.610228598f},
-std::array<float,2>{0.801566899f, 0.293888181f},
-std::array<float,2>{0.396950871f, 0.161142573f},
-std::array<float,2>{0.871301472f, 0.894959748f},
-std::array<float,2>{0.140040547f, 0.503752649f},
-std::array<float,2>{0.739544153f, 0.328695357f},
-std::array<float,2>{0.0730146021f, 0.424609601f},
-std::array<float,2>{0.557408512f, 0.679529727f},
-std::array<float,2>{0.354476303f, 0.801287353f},
-std::array<float,2>{0.923968673f, 0.0807046518f},
-std::array<float,2>{0.286093116f, 0.286448956f},
-std::array<float,2>{0.979701221f, 0.617551088f},
-std::array<float,2>{0.00992336404f, 0.950836658f},
-std::array<float,2>{0.599194527f, 0.241565734f},
-std::array<float,2>{0.218383387f, 0.022816889f},
-std::array<float,2>{0.651678205f, 0.863422275f},
-std::array<float,2>{0.475925863f, 0.716013193f},
-std::array<float,2>{0.756250203f, 0.46548149f},
-std::array<float,2>{0.3319498f, 0.105427526f},
-std::array<float,2>{0.888299763f, 0.763547242f},
-std::array<float,2>{0.113687977f, 0.639653563f},
-std::array<float,2>{0.521060705f, 0.389994919f},
-std::array<float,2>{0.162285581f, 0.373415917f},
-std::array<float,2>{0.697852135f, 0.56095928f},
-std::array<float,2>{0.421373963f, 0.925502479f},
-std::array<float,2>{0.820219219f, 0.13489908f},
-std::array<float,2>{0.449781954f, 0.471607208f},
-std::array<float,2>{0.810163617f, 0.719353795f},
-std::array<float,2>{0.226889074f, 0.827052474f},
-std::array<float,2>{0.664946079f, 0.0552716516f},
-std::array<float,2>{0.0370135754f, 0.206543237f},
-std::array<float,2>{0.573869348f, 0.973134577f},
-std::array<float,2>{0.25286743f, 0.587416708f},
-std::array<float,2>{0.947300315f, 0.251245171f},
-std::array<float,2>{0.266207546f, 0.231186047f},
-std::array<float,2>{0.957686663f, 0.964148939f},
-std::array<float,2>{0.0568828098f, 0.597952783f},
-std::array<float,2>{0.579448998f, 0.305751979f},
-std::array<float,2>{0.242421076f, 0.44160521f},
-std::array<float,2>{0.681762159f, 0.692733288f},
-std::array<float,2>{0.459626585f, 0.858379006f},
-std::array<float,2>{0.795422196f, 0.0139870383f},
-std::array<float,2>{0.43110162f, 0.325217962f},
-std::array<float,2>{0.837107122f, 0.531208336f},
-std::array<float,2>{0.174018681f, 0.887149334f},
-std::array<float,2>{0.708651841f, 0.178621918f},
-std::array<float,2>{0.10600245f, 0.0714054406f},
-std::array<float,2>{0.506568849f, 0.791122615f},
-std::array<float,2>{0.32689923f, 0.656939447f},
-std::array<float,2>{0.890970945f, 0.413067877f},
-std::array<float,2>{0.498924792f, 0.0395069085f},
-std::array<float,2>{0.772982478f, 0.833146989f},
-std::array<float,2>{0.200580418f, 0.745653152f},
-std::array<float,2>{0.627670228f, 0.484573066f},
-std::array<float,2>{0.0201429166f, 0.26938501f},
-std::array<float,2>{0.618017375f, 0.577745378f},
-std::array<float,2>{0.308236837f, 0.99189055f},
-std::array<float,2>{0.994240105f, 0.203089803f},
-std::array<float,2>{0.36669755f, 0.405229658f},
-std::array<float,2>{0.907089651f, 0.652534604f},
-std::array<float,2>{0.080507718f, 0.779993832f},
-std::array<float,2>{0.545887172f, 0.118091956f},
-std::array<float,2>{0.14751488f, 0.152474687f},
-std::array<float,2>{0.719136596f, 0.916203618f},
-std::array<float,2>{0.388704032f, 0.541773558f},
-std::array<float,2>{0.848360479f, 0.346447706f},
-std::array<float,2>{0.471243501f, 0.145222411f},
-std::array<float,2>{0.750739932f, 0.909105837f},
-std::array<float,2>{0.212243006f, 0.534365356f},
-std::array<float,2>{0.6549595f, 0.355120897f},
-std::array<float,2>{0.0154417381f, 0.391302466f},
-std::array<float,2>{0.594883859f, 0.64527452f},
-std::array<float,2>{0.281675011f, 0.773331046f},
-std::array<float,2>{0.982426524f, 0.114232935f},
-std::array<float,2>{0.356020987f, 0.278458714f},
-std::array<float,2>{0.926039159f, 0.565591574f},
-std::array<float,2>{0.0758416951f, 0.996890545f},
-std::array<float,2>{0.562203348f, 0.192912146f},
-std::array<float,2>{0.136348665f, 0.0379775763f},
-std::array<float,2>{0.737376392f, 0.838256121f},
-std::array<float,2>{0.393150747f, 0.74031353f},
-std::array<float,2>{0.871013224f, 0.492910296f},
-std::array<float,2>{0.254164726f, 0.0702919886f},
-std::array<float,2>{0.95078361f, 0.788630486f},
-std::array<float,2>{0.0335241593f, 0.664964378f},
-std::array<float,2>{0.576678991f, 0.414182663f},
-std::array<float,2>{0.231636912f, 0.315112501f},
-std::array<float,2>{0.669340849f, 0.518328071f},
-std::array<float,2>{0.448981643f, 0.875107825f},
-std::array<float,2>{0.808591068f, 0.18551746f},
-std::array<float,2>{0.414096057f, 0.446970254f},
-std::array<float,2>{0.814735949f, 0.702640533f},
-std::array<float,2>{0.158428594f, 0.848963618f},
-std::array<float,2>{0.702561438f, 0.00121537969f},
-std::array<float,2>{0.109471783f, 0.225065917f},
-std::array<float,2>{0.519349277f, 0.96055001f},
-std::array<float,2>{0.335864782f, 0.601833403f},
-std::array<float,2>{0.886626661f, 0.302805007f},
-std::array<float,2>{0.322195649f, 0.217183322f},
-std::array<float,2>{0.89477706f, 0.979299486f},
-std::array<float,2>{0.102613814f, 0.582139313f},
-std::array<float,2>{0.503273129f, 0.258874029f},
-std::array<float,2>{0.177924991f, 0.482364833f},
-std::array<float,2>{0.703542709f, 0.733097136f},
-std::array<float,2>{0.43362543f, 0.820301235f},
-std::array<float,2>{0.84238714f, 0.0526366457f},
-std::array<float,2>{0.453505546f, 0.36690253f},
-std::array<float,2>{0.789322555f, 0.548535347f},
-std::array<float,2>{0.246900871f, 0.934341669f},
-std::array<float,2>{0.683781564f, 0.128642425f},
-std::array<float,2>{0.0617884286f, 0.0972242653f},
-std::array<float,2>{0.585898161f, 0.754764915f},
-std::array<float,2>{0.27001828f, 0.63143158f},
-std::array<float,2>{0.953855157f, 0.375836521f},
-std::array<float,2>{0.383289307f, 0.026983792f},
-std::array<float,2>{0.846001327f, 0.873516023f},
-std::array<float,2>{0.14339903f, 0.710404336f},
-std::array<float,2>{0.724147379f, 0.454152852f},
-std::array<float,2>{0.0852192119f, 0.292151004f},
-std::array<float,2>{0.542278051f, 0.616776168f},
-std::array<float,2>{0.360899776f, 0.945003569f},
-std::array<float,2>{0.913798511f, 0.2485618f},
-std::array<float,2>{0.309270054f, 0.432751834f},
-std::array<float,2>{0.998129845f, 0.683453143f},
-std::array<float,2>{0.0156696793f, 0.808034956f},
-std::array<float,2>{0.622437835f, 0.0871537626f},
-std::array<float,2>{0.197326243f, 0.165927634f},
-std::array<float,2>{0.632049263f, 0.901008904f},
-std::array<float,2>{0.494758368f, 0.510628521f},
-std::array<float,2>{0.765839159f, 0.341821045f},
-std::array<float,2>{0.425301254f, 0.235956699f},
-std::array<float,2>{0.832660854f, 0.948081434f},
-std::array<float,2>{0.181865036f, 0.622021377f},
-std::array<float,2>{0.714569569f, 0.283070326f},
-std::array<float,2>{0.0987558439f, 0.462320864f},
-std::array<float,2>{0.509028435f, 0.713865161f},
-std::array<float,2>{0.319273591f, 0.861546338f},
-std::array<float,2>{0.899425685f, 0.0187248923f},
-std::array<float,2>{0.277594239f, 0.335232824f},
-std::array<float,2>{0.96671927f, 0.507147968f},
-std::array<float,2>{0.054036025f, 0.890849173f},
-std::array<float,2>{0.59182328f, 0.156749725f},
-std::array<float,2>{0.236696482f, 0.0827933401f},
-std::array<float,2>{0.676580727f, 0.797776401f},
-std::array<float,2>{0.468073815f, 0.675560832f},
-std::array<float,2>{0.786334097f, 0.429254323f},
-std::array<float,2>{0.37457186f, 0.0598781817f},
-std::array<float,2>{0.915999353f, 0.820768654f},
-std::array<float,2>{0.0890651122f, 0.724461913f},
-std::array<float,2>{0.535710752f, 0.472987264f},
-std::array<float,2>{0.154465705f, 0.254652977f},
-std::array<float,2>{0.732324183f, 0.590284348f},
-std::array<float,2>{0.37790975f, 0.970679641f},
-std::array<float,2>{0.856650472f, 0.207917735f},
-std::array<float,2>{0.491013497f, 0.384444445f},
-std::array<float,2>{0.77361685f, 0.633550107f},
-std::array<float,2>{0.191707879f, 0.758876443f},
-std::array<float,2>{0.638941765f, 0.107415974f},
-std::array<float,2>{0.0246272553f, 0.139170066f},
-std::array<float,2>{0.613360703f, 0.927437901f},
-std::array<float,2>{0.300866574f, 0.555708766f},
-std::array<float,2>{0.985502064f, 0.368955523f},
-std::array<float,2>{0.291368037f, 0.172300905f},
-std::array<float,2>{0.971265256f, 0.885554612f},
-std::array<float,2>{0.000395270035f, 0.525757015f},
-std::array<float,2>{0.609014452f, 0.322941005f},
-std::array<float,2>{0.209207594f, 0.406674176f},
-std::array<float,2>{0.64351505f, 0.661510944f},
-std::array<float,2>{0.481142372f, 0.796020865f},
-std::array<float,2>{0.759622574f, 0.0756111816f},
-std::array<float,2>{0.400175393f, 0.31028375f},
-std::array<float,2>{0.864368021f, 0.595902801f},
-std::array<float,2>{0.125268891f, 0.964844584f},
-std::array<float,2>{0.749472558f, 0.227695718f},
-std::array<float,2>{0.0684893131f, 0.00976290647f},
-std::array<float,2>{0.548060417f, 0.851943612f},
-std::array<float,2>{0.34513098f, 0.690688789f},
-std::array<float,2>{0.931923032f, 0.441248149f},
-std::array<float,2>{0.438925385f, 0.1218936f},
-std::array<float,2>{0.800151885f, 0.775583804f},
-std::array<float,2>{0.224870488f, 0.651182652f},
-std::array<float,2>{0.662476182f, 0.398932099f},
-std::array<float,2>{0.0404188f, 0.349686831f},
-std::array<float,2>{0.56332916f, 0.545334637f},
-std::array<float,2>{0.262520045f, 0.920034468f},
-std::array<float,2>{0.939426541f, 0.148711592f},
-std::array<float,2>{0.338101596f, 0.489372849f},
-std::array<float,2>{0.878605068f, 0.749934316f},
-std::array<float,2>{0.122783065f, 0.83148551f},
-std::array<float,2>{0.526622534f, 0.0466513149f},
-std::array<float,2>{0.166080996f, 0.198326588f},
-std::array<float,2>{0.694510639f, 0.985384285f},
-std::array<float,2>{0.408000588f, 0.570994377f},
-std::array<float,2>{0.822791934f, 0.270240009f},
-std::array<float,2>{0.441925347f, 0.244642988f},
-std::array<float,2>{0.802224636f, 0.940430582f},
-std::array<float,2>{0.222187132f, 0.612662554f},
-std::array<float,2>{0.657495975f, 0.296461195f},
-std::array<float,2>{0.0436759368f, 0.460194051f},
-std::array<float,2>{0.569533229f, 0.704586864f},
-std::array<float,2>{0.25829944f, 0.867521942f},
-std::array<float,2>{0.944257498f, 0.0292641483f},
-std::array<float,2>{0.341134816f, 0.339811385f},
-std::array<float,2>{0.881533325f, 0.515357733f},
-std::array<float,2>{0.117363125f, 0.905038536f},
-std::array<float,2>{0.529476345f, 0.171750307f},
-std::array<float,2>{0.171652228f, 0.090219669f},
-std::array<float,2>{0.690846562f, 0.810928524f},
-std::array<float,2>{0.411448032f, 0.685106874f},
-std::array<float,2>{0.827051342f, 0.434446603f},
-std::array<float,2>{0.294340521f, 0.0498305149f},
-std::array<float,2>{0.975337923f, 0.815715194f},
-std::array<float,2>{0.00581247872f, 0.729545951f},
-std::array<float,2>{0.604082465f, 0.477702141f},
-std::array<float,2>{0.204640359f, 0.262757301f},
-std::array<float,2>{0.645066023f, 0.578559518f},
-std::array<float,2>{0.478331774f, 0.984332502f},
-std::array<float,2>{0.764128327f, 0.211305171f},
-std::array<float,2>{0.402887613f, 0.381405324f},
-std::array<float,2>{0.861279309f, 0.628281474f},
-std::array<float,2>{0.132460982f, 0.753363192f},
-std::array<float,2>{0.744915187f, 0.101219483f},
-std::array<float,2>{0.0651402473f, 0.132612556f},
-std::array<float,2>{0.552097797f, 0.929882705f},
-std::array<float,2>{0.351258278f, 0.553070247f},
-std::array<float,2>{0.935550511f, 0.360805869f},
-std::array<float,2>{0.369761288f, 0.183479935f},
-std::array<float,2>{0.920505345f, 0.88024652f},
-std::array<float,2>{0.0907390639f, 0.521710396f},
-std::array<float,2>{0.534590602f, 0.319845051f},
-std::array<float,2>{0.151968375f, 0.420947075f},
-std::array<float,2>{0.72877264f, 0.668455958f},
-std::array<float,2>{0.380528092f, 0.784515023f},
-std::array<float,2>{0.855358839f, 0.0659222752f},
-std::array<float,2>{0.4866319f, 0.297429949f},
-std::array<float,2>{0.779807448f, 0.609041631f},
-std::array<float,2>{0.191063404f, 0.953209639f},
-std::array<float,2>{0.636621594f, 0.22153613f},
-std::array<float,2>{0.0277597848f, 0.00480717141f},
-std::array<float,2>{0.610962689f, 0.84426713f},
-std::array<float,2>{0.299242884f, 0.697966337f},
-std::array<float,2>{0.989690244f, 0.452586114f},
-std::array<float,2>{0.429222465f, 0.110944755f},
-std::array<float,2>{0.831556499f, 0.768811285f},
-std::array<float,2>{0.183807239f, 0.644309759f},
-std::array<float,2>{0.716631353f, 0.395123452f},
-std::array<float,2>{0.0968550965f, 0.358584404f},
-std::array<float,2>{0.51217562f, 0.537146449f},
-std::array<float,2>{0.312630385f, 0.911928236f},
-std::array<float,2>{0.903119802f, 0.144310296f},
-std::array<float,2>{0.275194556f, 0.498471469f},
-std::array<float,2>{0.961660147f, 0.737795234f},
-std::array<float,2>{0.049140837f, 0.841815889f},
-std::array<float,2>{0.589238644f, 0.0317262895f},
-std::array<float,2>{0.239819258f, 0.187753141f},
-std::array<float,2>{0.672338367f, 0.993341923f},
-std::array<float,2>{0.460986704f, 0.567826331f},
-std::array<float,2>{0.784588575f, 0.274928719f},
-std::array<float,2>{0.3899391f, 0.154462457f},
-std::array<float,2>{0.848891377f, 0.916006088f},
-std::array<float,2>{0.146507591f, 0.540984809f},
-std::array<float,2>{0.720337272f, 0.344516635f},
-std::array<float,2>{0.0816842765f, 0.402593225f},
-std::array<float,2>{0.546011269f, 0.656084955f},
-std::array<float,2>{0.365433723f, 0.777679563f},
-std::array<float,2>{0.907462418f, 0.119464383f},
-std::array<float,2>{0.306709856f, 0.266670316f},
-std::array<float,2>{0.995381176f, 0.576152146f},
-std::array<float,2>{0.021084141f, 0.989121258f},
-std::array<float,2>{0.618644297f, 0.199781179f},
-std::array<float,2>{0.199345902f, 0.0426753089f},
-std::array<float,2>{0.628773391f, 0.835412025f},
-std::array<float,2>{0.499174476f, 0.74280268f},
-std::array<float,2>{0.771907747f, 0.487709761f},
-std::array<float,2>{0.327792078f, 0.0738627538f},
-std::array<float,2>{0.89162302f, 0.790995896f},
-std::array<float,2>{0.106455356f, 0.65945828f},
-std::array<float,2>{0.5074507f, 0.410955131f},
-std::array<float,2>{0.175010383f, 0.326528579f},
-std::array<float,2>{0.70800519f, 0.527905047f},
-std::array<float,2>{0.430152684f, 0.888731003f},
-std::array<float,2>{0.83655113f, 0.176556841f},
-std::array<float,2>{0.459995359f, 0.444521666f},
-std::array<float,2>{0.796157777f, 0.693547904f},
-std::array<float,2>{0.243475094f, 0.855749726f},
-std::array<float,2>{0.682730854f, 0.0127516361f},
-std::array<float,2>{0.0582182482f, 0.233824924f},
-std::array<float,2>{0.579001606f, 0.96132493f},
-std::array<float,2>{0.267543226f, 0.600320458f},
-std::array<float,2>{0.958920896f, 0.307810664f},
-std::array<float,2>{0.253010899f, 0.20401606f},
-std::array<float,2>{0.948417366f, 0.976234019f},
-std::array<float,2>{0.035546232f, 0.589190543f},
-std::array<float,2>{0.573048532f, 0.252446592f},
-std::array<float,2>{0.228432536f, 0.470342755f},
-std::array<float,2>{0.665594757f, 0.721307337f},
-std::array<float,2>{0.450888187f, 0.826120198f},
-std::array<float,2>{0.808846653f, 0.0573601909f},
-std::array<float,2>{0.420241028f, 0.372299612f},
-std::array<float,2>{0.81917119f, 0.559446692f},
-std::array<float,2>{0.163794756f, 0.923068345f},
-std::array<float,2>{0.698698223f, 0.134750709f},
-std::array<float,2>{0.115046352f, 0.101736806f},
-std::array<float,2>{0.51957494f, 0.764315784f},
-std::array<float,2>{0.33081305f, 0.637319207f},
-std::array<float,2>{0.886773944f, 0.387196302f},
-std::array<float,2>{0.4747971f, 0.0195998959f},
-std::array<float,2>{0.757252097f, 0.866889596f},
-std::array<float,2>{0.217519894f, 0.71832329f},
-std::array<float,2>{0.650515079f, 0.466831654f},
-std::array<float,2>{0.011116799f, 0.2879453f},
-std::array<float,2>{0.598527551f, 0.620055497f},
-std::array<float,2>{0.286951482f, 0.952862203f},
-std::array<float,2>{0.978922367f, 0.238975838f},
-std::array<float,2>{0.355286062f, 0.423765898f},
-std::array<float,2>{0.925069869f, 0.676231742f},
-std::array<float,2>{0.0737114549f, 0.804034829f},
-std::array<float,2>{0.558086753f, 0.0782348961f},
-std::array<float,2>{0.139245853f, 0.162179083f},
-std::array<float,2>{0.738988638f, 0.898293912f},
-std::array<float,2>{0.397643f, 0.500885725f},
-std::array<float,2>{0.872503221f, 0.332021266f},
-std::array<float,2>{0.495203406f, 0.167280704f},
-std::array<float,2>{0.766816378f, 0.89845407f},
-std::array<float,2>{0.19853045f, 0.508531332f},
-std::array<float,2>{0.630888343f, 0.34040162f},
-std::array<float,2>{0.0171162039f, 0.430595219f},
-std::array<float,2>{0.621414363f, 0.681480169f},
-std::array<float,2>{0.309936643f, 0.805824041f},
-std::array<float,2>{0.999845028f, 0.0884490311f},
-std::array<float,2>{0.359988868f, 0.29088217f},
-std::array<float,2>{0.912271917f, 0.614051342f},
-std::array<float,2>{0.0845446289f, 0.942728341f},
-std::array<float,2>{0.541055024f, 0.247717351f},
-std::array<float,2>{0.143661007f, 0.0248299167f},
-std::array<float,2>{0.723184884f, 0.871225178f},
-std::array<float,2>{0.383817673f, 0.708874285f},
-std::array<float,2>{0.847289741f, 0.455422223f},
-std::array<float,2>{0.271383733f, 0.0943753719f},
-std::array<float,2>{0.954883277f, 0.756580293f},
-std::array<float,2>{0.0613737367f, 0.629044175f},
-std::array<float,2>{0.584748268f, 0.378645003f},
-std::array<float,2>{0.247787103f, 0.363516212f},
-std::array<float,2>{0.685274839f, 0.5488922f},
-std::array<float,2>{0.455069751f, 0.937074602f},
-std::array<float,2>{0.790103436f, 0.126552954f},
-std::array<float,2>{0.435136855f, 0.484102339f},
-std::array<float,2>{0.843669057f, 0.73102814f},
-std::array<float,2>{0.178783074f, 0.817771137f},
-std::array<float,2>{0.704179943f, 0.0539476685f},
-std::array<float,2>{0.102467299f, 0.215375304f},
-std::array<float,2>{0.502313018f, 0.977999687f},
-std::array<float,2>{0.320649981f, 0.585020244f},
-std::array<float,2>{0.895583808f, 0.261709958f},
-std::array<float,2>{0.334248006f, 0.22457163f},
-std::array<float,2>{0.885045052f, 0.958908975f},
-std::array<float,2>{0.110452183f, 0.605151474f},
-std::array<float,2>{0.51848948f, 0.301634938f},
-std::array<float,2>{0.159771129f, 0.44868511f},
-std::array<float,2>{0.701426566f, 0.700798988f},
-std::array<float,2>{0.415065289f, 0.851546764f},
-std::array<float,2>{0.815807939f, 0.00273172767f},
-std::array<float,2>{0.447358638f, 0.314191878f},
-std::array<float,2>{0.806715131f, 0.516828597f},
-std::array<float,2>{0.231270239f, 0.877493083f},
-std::array<float,2>{0.668027401f, 0.186201036f},
-std::array<float,2>{0.0346685946f, 0.0679586455f},
-std::array<float,2>{0.577325404f, 0.78523612f},
-std::array<float,2>{0.25490284f, 0.666093111f},
-std::array<float,2>{0.950083375f, 0.416940928f},
-std::array<float,2>{0.393939108f, 0.0360959359f},
-std::array<float,2>{0.869353652f, 0.837081492f},
-std::array<float,2>{0.135439917f, 0.738349378f},
-std::array<float,2>{0.736717165f, 0.495040715f},
-std::array<float,2>{0.0750324801f, 0.280994147f},
-std::array<float,2>{0.560669422f, 0.564260304f},
-std::array<float,2>{0.356581092f, 0.998777092f},
-std::array<float,2>{0.926909983f, 0.19524686f},
-std::array<float,2>{0.282806367f, 0.393586844f},
-std::array<float,2>{0.984254897f, 0.646713674f},
-std::array<float,2>{0.0142631503f, 0.77046448f},
-std::array<float,2>{0.59455961f, 0.115235552f},
-std::array<float,2>{0.211268246f, 0.146864057f},
-std::array<float,2>{0.655825436f, 0.907382727f},
-std::array<float,2>{0.472167134f, 0.53290242f},
-std::array<float,2>{0.750983953f, 0.352391213f},
-std::array<float,2>{0.407140076f, 0.195698142f},
-std::array<float,2>{0.823929727f, 0.987254679f},
-std::array<float,2>{0.167493761f, 0.57357806f},
-std::array<float,2>{0.694259107f, 0.27304408f},
-std::array<float,2>{0.121748939f, 0.491083145f},
-std::array<float,2>{0.525936842f, 0.746349037f},
-std::array<float,2>{0.339595705f, 0.828843951f},
-std::array<float,2>{0.877261996f, 0.0439434648f},
-std::array<float,2>{0.262793958f, 0.347941458f},
-std::array<float,2>{0.937624931f, 0.543340623f},
-std::array<float,2>{0.0394209027f, 0.91847831f},
-std::array<float,2>{0.564397752f, 0.152104631f},
-std::array<float,2>{0.22592172f, 0.123273946f},
-std::array<float,2>{0.663608968f, 0.775121391f},
-std::array<float,2>{0.437634766f, 0.648973525f},
-std::array<float,2>{0.79900986f, 0.401599437f},
-std::array<float,2>{0.343828708f, 0.0115893846f},
-std::array<float,2>{0.933386862f, 0.85384202f},
-std::array<float,2>{0.0694913194f, 0.68867588f},
-std::array<float,2>{0.547333479f, 0.438737661f},
-std::array<float,2>{0.126154259f, 0.312497884f},
-std::array<float,2>{0.748800576f, 0.595024765f},
-std::array<float,2>{0.399317205f, 0.966927528f},
-std::array<float,2>{0.863654315f, 0.229906291f},
-std::array<float,2>{0.482014865f, 0.408832908f},
-std::array<float,2>{0.758173168f, 0.662890732f},
-std::array<float,2>{0.209972009f, 0.794123888f},
-std::array<float,2>{0.643998086f, 0.0778580308f},
-std::array<float,2>{0.00134632213f, 0.174334154f},
-std::array<float,2>{0.608368754f, 0.884607017f},
-std::array<float,2>{0.292248964f, 0.52519536f},
-std::array<float,2>{0.972628415f, 0.321565628f},
-std::array<float,2>{0.301921338f, 0.136793315f},
-std::array<float,2>{0.985273123f, 0.928624749f},
-std::array<float,2>{0.0238519385f, 0.558112919f},
-std::array<float,2>{0.614943743f, 0.370311916f},
-std::array<float,2>{0.192493871f, 0.385346413f},
-std::array<float,2>{0.639963031f, 0.636601865f},
-std::array<float,2>{0.491718262f, 0.760160565f},
-std::array<float,2>{0.774624109f, 0.108755231f},
-std::array<float,2>{0.378142893f, 0.25635016f},
-std::array<float,2>{0.85554719f, 0.592223823f},
-std::array<float,2>{0.155596033f, 0.972090781f},
-std::array<float,2>{0.731039107f, 0.210375965f},
-std::array<float,2>{0.0888264254f, 0.0622151047f},
-std::array<float,2>{0.53637135f, 0.822699249f},
-std::array<float,2>{0.373611063f, 0.726016581f},
-std::array<float,2>{0.914435625f, 0.475144804f},
-std::array<float,2>{0.466935277f, 0.0858939812f},
-std::array<float,2>{0.785841763f, 0.800365448f},
-std::array<float,2>{0.238116384f, 0.672635674f},
-std::array<float,2>{0.677534759f, 0.426555306f},
-std::array<float,2>{0.0529679731f, 0.333001971f},
-std::array<float,2>{0.593297839f, 0.50459677f},
-std::array<float,2>{0.279206574f, 0.892953157f},
-std::array<float,2>{0.965576887f, 0.158956975f},
-std::array<float,2>{0.320155561f, 0.463608295f},
-std::array<float,2>{0.899008572f, 0.712456107f},
-std::array<float,2>{0.098390229f, 0.859401822f},
-std::array<float,2>{0.508038998f, 0.0172175262f},
-std::array<float,2>{0.182863489f, 0.237904489f},
-std::array<float,2>{0.71367377f, 0.946469188f},
-std::array<float,2>{0.42471388f, 0.623076022f},
-std::array<float,2>{0.83322686f, 0.284150153f},
-std::array<float,2>{0.48042497f, 0.213075563f},
-std::array<float,2>{0.763183177f, 0.980600238f},
-std::array<float,2>{0.206733197f, 0.581158936f},
-std::array<float,2>{0.647928298f, 0.264920264f},
-std::array<float,2>{0.00665866351f, 0.478900492f},
-std::array<float,2>{0.602932513f, 0.727764308f},
-std::array<float,2>{0.295148075f, 0.813061774f},
-std::array<float,2>{0.972882926f, 0.0487305634f},
-std::array<float,2>{0.348196328f, 0.362246513f},
-std::array<float,2>{0.934031367f, 0.551632643f},
-std::array<float,2>{0.0644183978f, 0.93279767f},
-std::array<float,2>{0.55451411f, 0.130495802f},
-std::array<float,2>{0.130645961f, 0.0993155316f},
-std::array<float,2>{0.743531644f, 0.751878917f},
-std::array<float,2>{0.405381382f, 0.625836432f},
-std::array<float,2>{0.862480402f, 0.380486518f},
-std::array<float,2>{0.261388421f, 0.0300303716f},
-std::array<float,2>{0.942360282f, 0.869776189f},
-std::array<float,2>{0.046185974f, 0.705832899f},
-std::array<float,2>{0.567393184f, 0.457475573f},
-std::array<float,2>{0.218866527f, 0.294189274f},
-std::array<float,2>{0.658906579f, 0.6103701f},
-std::array<float,2>{0.444129497f, 0.937869072f},
-std::array<float,2>{0.804514647f, 0.243299767f},
-std::array<float,2>{0.413708955f, 0.437021643f},
-std::array<float,2>{0.825158119f, 0.686880946f},
-std::array<float,2>{0.169488281f, 0.809515774f},
-std::array<float,2>{0.688241839f, 0.0927899554f},
-std::array<float,2>{0.120606706f, 0.168077514f},
-std::array<float,2>{0.528364658f, 0.902445436f},
-std::array<float,2>{0.343389094f, 0.513277769f},
-std::array<float,2>{0.878966391f, 0.336855352f},
-std::array<float,2>{0.314911395f, 0.141334459f},
-std::array<float,2>{0.90488708f, 0.913424194f},
-std::array<float,2>{0.0944837406f, 0.535875976f},
-std::array<float,2>{0.51558131f, 0.356094062f},
-std::array<float,2>{0.187102482f, 0.396934122f},
-std::array<float,2>{0.718484163f, 0.641315401f},
-std::array<float,2>{0.426051557f, 0.767034292f},
-std::array<float,2>{0.830075622f, 0.113225751f},
-std::array<float,2>{0.464383394f, 0.27692914f},
-std::array<float,2>{0.781372488f, 0.569522798f},
-std::array<float,2>{0.240460977f, 0.9952057f},
-std::array<float,2>{0.67532289f, 0.190474838f},
-std::array<float,2>{0.0469493046f, 0.0346554071f},
-std::array<float,2>{0.586342692f, 0.841231167f},
-std::array<float,2>{0.276331633f, 0.73568505f},
-std::array<float,2>{0.963259816f, 0.496250123f},
-std::array<float,2>{0.381236762f, 0.0641714633f},
-std::array<float,2>{0.852479875f, 0.782383561f},
-std::array<float,2>{0.149055347f, 0.671154559f},
-std::array<float,2>{0.727393091f, 0.418866962f},
-std::array<float,2>{0.0921737179f, 0.31738925f},
-std::array<float,2>{0.532433569f, 0.520443261f},
-std::array<float,2>{0.368184298f, 0.882553875f},
-std::array<float,2>{0.918842316f, 0.18146424f},
-std::array<float,2>{0.297516823f, 0.450751752f},
-std::array<float,2>{0.99203217f, 0.695424855f},
-std::array<float,2>{0.0296630785f, 0.846608222f},
-std::array<float,2>{0.611408949f, 0.0064260941f},
-std::array<float,2>{0.188402161f, 0.219963551f},
-std::array<float,2>{0.634278059f, 0.955527246f},
-std::array<float,2>{0.484462291f, 0.605568349f},
-std::array<float,2>{0.77824986f, 0.300076544f},
-std::array<float,2>{0.431967556f, 0.179400846f},
-std::array<float,2>{0.839694738f, 0.88858372f},
-std::array<float,2>{0.173486069f, 0.529318929f},
-std::array<float,2>{0.709602952f, 0.324757159f},
-std::array<float,2>{0.109164871f, 0.4137806f},
-std::array<float,2>{0.504318297f, 0.657791317f},
-std::array<float,2>{0.325424552f, 0.792267144f},
-std::array<float,2>{0.894044816f, 0.0711701587f},
-std::array<float,2>{0.267856389f, 0.305613875f},
-std::array<float,2>{0.959200561f, 0.598999083f},
-std::array<float,2>{0.0553568453f, 0.963137269f},
-std::array<float,2>{0.581803679f, 0.231683061f},
-std::array<float,2>{0.244161636f, 0.0147600919f},
-std::array<float,2>{0.68084389f, 0.859275579f},
-std::array<float,2>{0.458792627f, 0.691714585f},
-std::array<float,2>{0.79383558f, 0.443149865f},
-std::array<float,2>{0.364808828f, 0.118796751f},
-std::array<float,2>{0.908710897f, 0.780696571f},
-std::array<float,2>{0.0789201558f, 0.653474331f},
-std::array<float,2>{0.543155491f, 0.405752152f},
-std::array<float,2>{0.144859135f, 0.34700346f},
-std::array<float,2>{0.720903218f, 0.542280197f},
-std::array<float,2>{0.387613267f, 0.917560279f},
-std::array<float,2>{0.850874662f, 0.154294685f},
-std::array<float,2>{0.497788429f, 0.485689998f},
-std::array<float,2>{0.771175623f, 0.744510949f},
-std::array<float,2>{0.202973977f, 0.832291603f},
-std::array<float,2>{0.625487268f, 0.0402824022f},
-std::array<float,2>{0.0229581036f, 0.201805249f},
-std::array<float,2>{0.621006429f, 0.990927577f},
-std::array<float,2>{0.306326896f, 0.576955378f},
-std::array<float,2>{0.992199063f, 0.267895371f},
-std::array<float,2>{0.287519336f, 0.240279704f},
-std::array<float,2>{0.977339506f, 0.950158894f},
-std::array<float,2>{0.0084766401f, 0.618681431f},
-std::array<float,2>{0.600650251f, 0.285335958f},
-std::array<float,2>{0.21629943f, 0.466112733f},
-std::array<float,2>{0.649514318f, 0.715497851f},
-std::array<float,2>{0.473651171f, 0.864765584f},
-std::array<float,2>{0.754513919f, 0.0219854228f},
-std::array<float,2>{0.394836903f, 0.329528689f},
-std::array<float,2>{0.874559522f, 0.502081752f},
-std::array<float,2>{0.138209701f, 0.896192372f},
-std::array<float,2>{0.740558863f, 0.160364524f},
-std::array<float,2>{0.0705033317f, 0.0819592029f},
-std::array<float,2>{0.556519866f, 0.802226782f},
-std::array<float,2>{0.352541655f, 0.678132534f},
-std::array<float,2>{0.923463404f, 0.425603479f},
-std::array<float,2>{0.4521707f, 0.0564429536f},
-std::array<float,2>{0.811350226f, 0.828027785f},
-std::array<float,2>{0.230187014f, 0.720145345f},
-std::array<float,2>{0.667450786f, 0.472378969f},
-std::array<float,2>{0.0380780213f, 0.250877112f},
-std::array<float,2>{0.571437657f, 0.586537659f},
-std::array<float,2>{0.251481146f, 0.974586189f},
-std::array<float,2>{0.94578743f, 0.205792293f},
-std::array<float,2>{0.329133838f, 0.388916671f},
-std::array<float,2>{0.890354216f, 0.638901532f},
-std::array<float,2>{0.115979657f, 0.762408376f},
-std::array<float,2>{0.522500396f, 0.103637762f},
-std::array<float,2>{0.160349041f, 0.136715218f},
-std::array<float,2>{0.69656378f, 0.924122155f},
-std::array<float,2>{0.41956234f, 0.562346578f},
-std::array<float,2>{0.816783369f, 0.374038249f},
-std::array<float,2>{0.456575066f, 0.127686575f},
-std::array<float,2>{0.792096555f, 0.934904933f},
-std::array<float,2>{0.249487296f, 0.547597826f},
-std::array<float,2>{0.685604095f, 0.365881532f},
-std::array<float,2>{0.0595623925f, 0.376249462f},
-std::array<float,2>{0.583517432f, 0.631934226f},
-std::array<float,2>{0.272877008f, 0.754998088f},
-std::array<float,2>{0.956958473f, 0.0963118672f},
-std::array<float,2>{0.323002875f, 0.258013874f},
-std::array<float,2>{0.897943676f, 0.583325684f},
-std::array<float,2>{0.104748666f, 0.980407774f},
-std::array<float,2>{0.500928402f, 0.218263209f},
-std::array<float,2>{0.177314788f, 0.0508567654f},
-std::array<float,2>{0.705914676f, 0.819158256f},
-std::array<float,2>{0.436012089f, 0.734053075f},
-std::array<float,2>{0.841382921f, 0.481391966f},
-std::array<float,2>{0.310731113f, 0.0861446038f},
-std::array<float,2>{0.996891439f, 0.807251155f},
-std::array<float,2>{0.0194698013f, 0.681998193f},
-std::array<float,2>{0.624115884f, 0.432311565f},
-std::array<float,2>{0.197100133f, 0.342847824f},
-std::array<float,2>{0.6289258f, 0.511281669f},
-std::array<float,2>{0.492957652f, 0.901837051f},
-std::array<float,2>{0.769192994f, 0.164473221f},
-std::array<float,2>{0.386212438f, 0.453511804f},
-std::array<float,2>{0.844382763f, 0.709538221f},
-std::array<float,2>{0.141138703f, 0.87454015f},
-std::array<float,2>{0.724773645f, 0.0263122972f},
-std::array<float,2>{0.0832737982f, 0.249216482f},
-std::array<float,2>{0.539303482f, 0.943425059f},
-std::array<float,2>{0.362024337f, 0.616028547f},
-std::array<float,2>{0.910894275f, 0.291973501f},
-std::array<float,2>{0.358566016f, 0.191449419f},
-std::array<float,2>{0.929151773f, 0.997110605f},
-std::array<float,2>{0.0778375864f, 0.564688146f},
-std::array<float,2>{0.559864581f, 0.278000265f},
-std::array<float,2>{0.134185046f, 0.494138867f},
-std::array<float,2>{0.735747933f, 0.741739094f},
-std::array<float,2>{0.392141998f, 0.839725673f},
-std::array<float,2>{0.868746161f, 0.0389466174f},
-std::array<float,2>{0.469087005f, 0.3542943f},
-std::array<float,2>{0.753048837f, 0.534086466f},
-std::array<float,2>{0.21376507f, 0.909469366f},
-std::array<float,2>{0.653274775f, 0.146085605f},
-std::array<float,2>{0.0125815086f, 0.115176052f},
-std::array<float,2>{0.597413719f, 0.772386372f},
-std::array<float,2>{0.285149932f, 0.645812094f},
-std::array<float,2>{0.980704904f, 0.391616911f},
-std::array<float,2>{0.416625082f, 9.55387077e-05f},
-std::array<float,2>{0.814224124f, 0.848605573f},
-std::array<float,2>{0.157960266f, 0.70198977f},
-std::array<float,2>{0.700640142f, 0.445857078f},
-std::array<float,2>{0.111581326f, 0.304555953f},
-std::array<float,2>{0.516028583f, 0.60258311f},
-std::array<float,2>{0.332493067f, 0.95968473f},
-std::array<float,2>{0.884055197f, 0.226203427f},
-std::array<float,2>{0.256773859f, 0.415257901f},
-std::array<float,2>{0.952197731f, 0.665224373f},
-std::array<float,2>{0.0315617211f, 0.787484705f},
-std::array<float,2>{0.575571716f, 0.0691677704f},
-std::array<float,2>{0.234324947f, 0.184373572f},
-std::array<float,2>{0.670206547f, 0.876689196f},
-std::array<float,2>{0.446678191f, 0.518732727f},
-std::array<float,2>{0.805398166f, 0.315952927f},
-std::array<float,2>{0.401923537f, 0.227326378f},
-std::array<float,2>{0.866714954f, 0.966300309f},
-std::array<float,2>{0.128643185f, 0.596796632f},
-std::array<float,2>{0.746788442f, 0.309179395f},
-std::array<float,2>{0.0672719479f, 0.44030112f},
-std::array<float,2>{0.550680757f, 0.689840734f},
-std::array<float,2>{0.347431868f, 0.852829635f},
-std::array<float,2>{0.930241764f, 0.0080116624f},
-std::array<float,2>{0.289628655f, 0.3238433f},
-std::array<float,2>{0.969198942f, 0.526593268f},
-std::array<float,2>{0.00324090477f, 0.886471868f},
-std::array<float,2>{0.607021093f, 0.173499465f},
-std::array<float,2>{0.208100766f, 0.0745296851f},
-std::array<float,2>{0.642430663f, 0.795139194f},
-std::array<float,2>{0.482612133f, 0.660634518f},
-std::array<float,2>{0.759980083f, 0.407702416f},
-std::array<float,2>{0.336699635f, 0.045759771f},
-std::array<float,2>{0.876315713f, 0.830332398f},
-std::array<float,2>{0.123053528f, 0.748355925f},
-std::array<float,2>{0.524028659f, 0.488529235f},
-std::array<float,2>{0.164883524f, 0.270672917f},
-std::array<float,2>{0.691533864f, 0.571482778f},
-std::array<float,2>{0.408882558f, 0.984389365f},
-std::array<float,2>{0.821750283f, 0.197831333f},
-std::array<float,2>{0.44053632f, 0.400104403f},
-std::array<float,2>{0.796918809f, 0.651736796f},
-std::array<float,2>{0.222701594f, 0.777304292f},
-std::array<float,2>{0.660388708f, 0.122469723f},
-std::array<float,2>{0.0425030552f, 0.149942413f},
-std::array<float,2>{0.565887094f, 0.92144388f},
-std::array<float,2>{0.264962524f, 0.546640217f},
-std::array<float,2>{0.939830542f, 0.351161778f},
-std::array<float,2>{0.279711604f, 0.157550365f},
-std::array<float,2>{0.967558622f, 0.891840398f},
-std::array<float,2>{0.0520488396f, 0.505975425f},
-std::array<float,2>{0.591440558f, 0.334099472f},
-std::array<float,2>{0.235181972f, 0.427957594f},
-std::array<float,2>{0.679341912f, 0.673856258f},
-std::array<float,2>{0.465229183f, 0.798241675f},
-std::array<float,2>{0.788873136f, 0.0839561448f},
-std::array<float,2>{0.423152417f, 0.281666636f},
-std::array<float,2>{0.83568126f, 0.622164488f},
-std::array<float,2>{0.180214137f, 0.948909223f},
-std::array<float,2>{0.710996807f, 0.235082477f},
-std::array<float,2>{0.099996537f, 0.0182634443f},
-std::array<float,2>{0.511442661f, 0.862684608f},
-std::array<float,2>{0.316771567f, 0.714238405f},
-std::array<float,2>{0.900706172f, 0.461714685f},
-std::array<float,2>{0.490035474f, 0.106239535f},
-std::array<float,2>{0.776711881f, 0.758380473f},
-std::array<float,2>{0.19343096f, 0.633865178f},
-std::array<float,2>{0.638626337f, 0.382887781f},
-std::array<float,2>{0.0264689382f, 0.367953151f},
-std::array<float,2>{0.615558922f, 0.554966509f},
-std::array<float,2>{0.304085672f, 0.926515639f},
-std::array<float,2>{0.987665832f, 0.139836356f},
-std::array<float,2>{0.371574759f, 0.47428745f},
-std::array<float,2>{0.9168365f, 0.722997427f},
-std::array<float,2>{0.0872703791f, 0.82142812f},
-std::array<float,2>{0.538256407f, 0.0589451306f},
-std::array<float,2>{0.153889865f, 0.208766773f},
-std::array<float,2>{0.732486069f, 0.969398022f},
-std::array<float,2>{0.375696659f, 0.591566086f},
-std::array<float,2>{0.857855797f, 0.255243957f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.985594153f, 0.787742138f},
-std::array<float,2>{0.180958331f, 0.40863803f},
-std::array<float,2>{0.471558392f, 0.742081463f},
-std::array<float,2>{0.655284762f, 0.178036854f},
-std::array<float,2>{0.538977325f, 0.514308989f},
-std::array<float,2>{0.288659304f, 0.0824393556f},
-std::array<float,2>{0.0995352566f, 0.876438498f},
-std::array<float,2>{0.798612297f, 0.358088404f},
-std::array<float,2>{0.859609306f, 0.629133463f},
-std::array<float,2>{0.038600821f, 0.244676128f},
-std::array<float,2>{0.366274476f, 0.816769838f},
-std::array<float,2>{0.602000296f, 0.439652592f},
-std::array<float,2>{0.722153485f, 0.997176945f},
-std::array<float,2>{0.398848206f, 0.290165544f},
-std::array<float,2>{0.202706531f, 0.575242996f},
-std::array<float,2>{0.92449224f, 0.022120554f},
-std::array<float,2>{0.762030125f, 0.932772577f},
-std::array<float,2>{0.0755885094f, 0.318891406f},
-std::array<float,2>{0.267507225f, 0.5573982f},
-std::array<float,2>{0.523026943f, 0.104978263f},
-std::array<float,2>{0.66084826f, 0.704651833f},
-std::array<float,2>{0.445961058f, 0.130544186f},
-std::array<float,2>{0.138393775f, 0.751399398f},
-std::array<float,2>{0.96353513f, 0.37887764f},
-std::array<float,2>{0.877321124f, 0.603896976f},
-std::array<float,2>{0.242278054f, 0.0579499863f},
-std::array<float,2>{0.421365559f, 0.961362481f},
-std::array<float,2>{0.716773391f, 0.250880629f},
-std::array<float,2>{0.564606845f, 0.851874173f},
-std::array<float,2>{0.322481304f, 0.474281371f},
-std::array<float,2>{0.00352986902f, 0.682624817f},
-std::array<float,2>{0.830615878f, 0.195979342f},
-std::array<float,2>{0.812839568f, 0.84188056f},
-std::array<float,2>{0.0180382989f, 0.464441061f},
-std::array<float,2>{0.335377514f, 0.651585758f},
-std::array<float,2>{0.585475326f, 0.219073489f},
-std::array<float,2>{0.690312088f, 0.592488885f},
-std::array<float,2>{0.424725264f, 0.0101573355f},
-std::array<float,2>{0.219253421f, 0.982502043f},
-std::array<float,2>{0.900792718f, 0.311797619f},
-std::array<float,2>{0.945342183f, 0.71946305f},
-std::array<float,2>{0.156185448f, 0.156286269f},
-std::array<float,2>{0.463459522f, 0.80224824f},
-std::array<float,2>{0.686735034f, 0.422824472f},
-std::array<float,2>{0.506913722f, 0.899998248f},
-std::array<float,2>{0.257106811f, 0.367203951f},
-std::array<float,2>{0.0911790878f, 0.521153867f},
-std::array<float,2>{0.767761588f, 0.0657386258f},
-std::array<float,2>{0.919152677f, 0.949825466f},
-std::array<float,2>{0.206742257f, 0.265755981f},
-std::array<float,2>{0.388566226f, 0.617168605f},
-std::array<float,2>{0.742617965f, 0.0430692658f},
-std::array<float,2>{0.622678339f, 0.664595246f},
-std::array<float,2>{0.356514633f, 0.207443178f},
-std::array<float,2>{0.0517068021f, 0.868812382f},
-std::array<float,2>{0.856936514f, 0.485396773f},
-std::array<float,2>{0.782561064f, 0.539639294f},
-std::array<float,2>{0.117920756f, 0.112737939f},
-std::array<float,2>{0.306889802f, 0.919086158f},
-std::array<float,2>{0.559098542f, 0.339820266f},
-std::array<float,2>{0.631972373f, 0.77439636f},
-std::array<float,2>{0.496278256f, 0.391723663f},
-std::array<float,2>{0.168864504f, 0.696146548f},
-std::array<float,2>{0.975405216f, 0.146205038f},
-std::array<float,2>{0.893764019f, 0.86245513f},
-std::array<float,2>{0.226639062f, 0.494084924f},
-std::array<float,2>{0.436240196f, 0.662884533f},
-std::array<float,2>{0.696157753f, 0.213215798f},
-std::array<float,2>{0.593263566f, 0.623895347f},
-std::array<float,2>{0.339787304f, 0.0332219973f},
-std::array<float,2>{0.0281946957f, 0.93784821f},
-std::array<float,2>{0.827264547f, 0.279426873f},
-std::array<float,2>{0.774424911f, 0.695301592f},
-std::array<float,2>{0.0814426467f, 0.150327429f},
-std::array<float,2>{0.264919639f, 0.772130847f},
-std::array<float,2>{0.515087366f, 0.404415429f},
-std::array<float,2>{0.676379621f, 0.911999404f},
-std::array<float,2>{0.459303319f, 0.328549683f},
-std::array<float,2>{0.147693664f, 0.536399961f},
-std::array<float,2>{0.942974567f, 0.123469658f},
-std::array<float,2>{0.851155758f, 0.976224244f},
-std::array<float,2>{0.0604895577f, 0.299085885f},
-std::array<float,2>{0.350115657f, 0.584372878f},
-std::array<float,2>{0.610696375f, 0.00224695425f},
-std::array<float,2>{0.737964451f, 0.645559669f},
-std::array<float,2>{0.382698923f, 0.234052971f},
-std::array<float,2>{0.216282502f, 0.828343093f},
-std::array<float,2>{0.908800423f, 0.456796765f},
-std::array<float,2>{0.98350817f, 0.527177572f},
-std::array<float,2>{0.160852939f, 0.0742156059f},
-std::array<float,2>{0.490547776f, 0.891455054f},
-std::array<float,2>{0.639956057f, 0.360177308f},
-std::array<float,2>{0.553670466f, 0.810725987f},
-std::array<float,2>{0.299244404f, 0.434286147f},
-std::array<float,2>{0.112706751f, 0.728260577f},
-std::array<float,2>{0.796511352f, 0.168692216f},
-std::array<float,2>{0.806494534f, 0.758125067f},
-std::array<float,2>{0.102636136f, 0.384988457f},
-std::array<float,2>{0.290493459f, 0.717720091f},
-std::array<float,2>{0.539843917f, 0.140325204f},
-std::array<float,2>{0.648127079f, 0.552795887f},
-std::array<float,2>{0.480502278f, 0.0993885025f},
-std::array<float,2>{0.17710337f, 0.927197754f},
-std::array<float,2>{0.99431473f, 0.32741043f},
-std::array<float,2>{0.936287224f, 0.676424623f},
-std::array<float,2>{0.194135264f, 0.190382943f},
-std::array<float,2>{0.395824105f, 0.846687973f},
-std::array<float,2>{0.732324064f, 0.483424902f},
-std::array<float,2>{0.595208704f, 0.954555988f},
-std::array<float,2>{0.36779356f, 0.264646888f},
-std::array<float,2>{0.0414532535f, 0.600487411f},
-std::array<float,2>{0.872778833f, 0.0470015071f},
-std::array<float,2>{0.955922723f, 0.889545023f},
-std::array<float,2>{0.126433238f, 0.346287131f},
-std::array<float,2>{0.438367307f, 0.506722391f},
-std::array<float,2>{0.670438409f, 0.0887134299f},
-std::array<float,2>{0.524531245f, 0.74309212f},
-std::array<float,2>{0.275919735f, 0.184146687f},
-std::array<float,2>{0.0674113408f, 0.793365419f},
-std::array<float,2>{0.753725111f, 0.420038134f},
-std::array<float,2>{0.842446089f, 0.56524837f},
-std::array<float,2>{0.00823995098f, 0.0279361028f},
-std::array<float,2>{0.315174848f, 0.986657083f},
-std::array<float,2>{0.573103964f, 0.284384072f},
-std::array<float,2>{0.704267979f, 0.826826632f},
-std::array<float,2>{0.410896927f, 0.451913714f},
-std::array<float,2>{0.234973744f, 0.639113188f},
-std::array<float,2>{0.887688756f, 0.235045031f},
-std::array<float,2>{0.925838172f, 0.766233921f},
-std::array<float,2>{0.19807671f, 0.400550842f},
-std::array<float,2>{0.405105948f, 0.68826437f},
-std::array<float,2>{0.725345075f, 0.152374968f},
-std::array<float,2>{0.607105076f, 0.535035372f},
-std::array<float,2>{0.359897375f, 0.119317502f},
-std::array<float,2>{0.0339961648f, 0.906763613f},
-std::array<float,2>{0.866093636f, 0.333485126f},
-std::array<float,2>{0.803764462f, 0.658557117f},
-std::array<float,2>{0.0967122093f, 0.217455104f},
-std::array<float,2>{0.28292048f, 0.866646469f},
-std::array<float,2>{0.531927228f, 0.498030126f},
-std::array<float,2>{0.650243223f, 0.941723228f},
-std::array<float,2>{0.475812227f, 0.274108112f},
-std::array<float,2>{0.18717359f, 0.619411349f},
-std::array<float,2>{0.990338683f, 0.0381046161f},
-std::array<float,2>{0.832333028f, 0.8968063f},
-std::array<float,2>{0.00497395871f, 0.364839017f},
-std::array<float,2>{0.328059971f, 0.527631104f},
-std::array<float,2>{0.569591463f, 0.074772954f},
-std::array<float,2>{0.713693798f, 0.731527925f},
-std::array<float,2>{0.416727871f, 0.164664775f},
-std::array<float,2>{0.248226658f, 0.805602014f},
-std::array<float,2>{0.880646348f, 0.432361573f},
-std::array<float,2>{0.966062844f, 0.580819845f},
-std::array<float,2>{0.135553584f, 0.00769126043f},
-std::array<float,2>{0.450834781f, 0.970018506f},
-std::array<float,2>{0.659781516f, 0.30183658f},
-std::array<float,2>{0.517681181f, 0.834491014f},
-std::array<float,2>{0.273346692f, 0.459327221f},
-std::array<float,2>{0.0706112012f, 0.643792808f},
-std::array<float,2>{0.760726333f, 0.230184749f},
-std::array<float,2>{0.771511078f, 0.849789381f},
-std::array<float,2>{0.0896082893f, 0.477996349f},
-std::array<float,2>{0.253077418f, 0.674814999f},
-std::array<float,2>{0.503733695f, 0.194467694f},
-std::array<float,2>{0.680467546f, 0.595508456f},
-std::array<float,2>{0.467936188f, 0.0530767962f},
-std::array<float,2>{0.150310412f, 0.957801759f},
-std::array<float,2>{0.951746583f, 0.260385841f},
-std::array<float,2>{0.905976117f, 0.713988602f},
-std::array<float,2>{0.226507515f, 0.134093761f},
-std::array<float,2>{0.427957714f, 0.762963951f},
-std::array<float,2>{0.692217469f, 0.387359947f},
-std::array<float,2>{0.57869029f, 0.925131381f},
-std::array<float,2>{0.330260992f, 0.322570682f},
-std::array<float,2>{0.0201387815f, 0.549687326f},
-std::array<float,2>{0.820179045f, 0.0963463932f},
-std::array<float,2>{0.968752027f, 0.990470409f},
-std::array<float,2>{0.166759938f, 0.286041915f},
-std::array<float,2>{0.493863165f, 0.566553831f},
-std::array<float,2>{0.628151953f, 0.0269622412f},
-std::array<float,2>{0.555995822f, 0.633458555f},
-std::array<float,2>{0.311487406f, 0.241399571f},
-std::array<float,2>{0.122813858f, 0.823670506f},
-std::array<float,2>{0.78783983f, 0.448104322f},
-std::array<float,2>{0.853145123f, 0.502381623f},
-std::array<float,2>{0.0503441244f, 0.0920617729f},
-std::array<float,2>{0.35458985f, 0.882996619f},
-std::array<float,2>{0.619194031f, 0.351315916f},
-std::array<float,2>{0.746635914f, 0.790409565f},
-std::array<float,2>{0.382851541f, 0.417648703f},
-std::array<float,2>{0.208905369f, 0.747686028f},
-std::array<float,2>{0.914919019f, 0.179758087f},
-std::array<float,2>{0.939772308f, 0.813454926f},
-std::array<float,2>{0.143072084f, 0.442513764f},
-std::array<float,2>{0.455120206f, 0.626036108f},
-std::array<float,2>{0.67294389f, 0.248762444f},
-std::array<float,2>{0.510915339f, 0.574059188f},
-std::array<float,2>{0.257960141f, 0.0158719718f},
-std::array<float,2>{0.0821681693f, 0.993949771f},
-std::array<float,2>{0.780724645f, 0.296802789f},
-std::array<float,2>{0.822806358f, 0.734815478f},
-std::array<float,2>{0.0235798433f, 0.173338503f},
-std::array<float,2>{0.340783417f, 0.783258557f},
-std::array<float,2>{0.588337362f, 0.410572648f},
-std::array<float,2>{0.70145911f, 0.882747054f},
-std::array<float,2>{0.433484674f, 0.351719379f},
-std::array<float,2>{0.232799828f, 0.51051271f},
-std::array<float,2>{0.89714855f, 0.0797817707f},
-std::array<float,2>{0.792793334f, 0.967547238f},
-std::array<float,2>{0.11350175f, 0.256854057f},
-std::array<float,2>{0.303313702f, 0.605749428f},
-std::array<float,2>{0.547681868f, 0.0593646951f},
-std::array<float,2>{0.634322047f, 0.687085629f},
-std::array<float,2>{0.487770796f, 0.202221125f},
-std::array<float,2>{0.15894933f, 0.858256698f},
-std::array<float,2>{0.978420854f, 0.469621181f},
-std::array<float,2>{0.913221419f, 0.560140431f},
-std::array<float,2>{0.214024872f, 0.108560286f},
-std::array<float,2>{0.376802653f, 0.937167227f},
-std::array<float,2>{0.73878932f, 0.315236777f},
-std::array<float,2>{0.614868283f, 0.754826605f},
-std::array<float,2>{0.347113967f, 0.381135792f},
-std::array<float,2>{0.0557681061f, 0.709241092f},
-std::array<float,2>{0.847407699f, 0.126740724f},
-std::array<float,2>{0.869424224f, 0.79804033f},
-std::array<float,2>{0.0448985621f, 0.428628445f},
-std::array<float,2>{0.373047292f, 0.72441709f},
-std::array<float,2>{0.597930491f, 0.162232876f},
-std::array<float,2>{0.726645708f, 0.516543627f},
-std::array<float,2>{0.393900931f, 0.069196552f},
-std::array<float,2>{0.189775661f, 0.906095922f},
-std::array<float,2>{0.931560218f, 0.373649061f},
-std::array<float,2>{0.999298871f, 0.652928829f},
-std::array<float,2>{0.172464401f, 0.222916052f},
-std::array<float,2>{0.480277836f, 0.838299334f},
-std::array<float,2>{0.643554211f, 0.468741447f},
-std::array<float,2>{0.545546949f, 0.977824569f},
-std::array<float,2>{0.293634713f, 0.307434678f},
-std::array<float,2>{0.106322497f, 0.587032974f},
-std::array<float,2>{0.812086165f, 0.0137431519f},
-std::array<float,2>{0.884550273f, 0.91525352f},
-std::array<float,2>{0.239672884f, 0.343611389f},
-std::array<float,2>{0.409942746f, 0.543022215f},
-std::array<float,2>{0.70926106f, 0.114579849f},
-std::array<float,2>{0.574370384f, 0.701943159f},
-std::array<float,2>{0.319041818f, 0.140955865f},
-std::array<float,2>{0.0137723591f, 0.780474842f},
-std::array<float,2>{0.838909745f, 0.396419942f},
-std::array<float,2>{0.75779438f, 0.610245883f},
-std::array<float,2>{0.0645351708f, 0.0415027998f},
-std::array<float,2>{0.279374033f, 0.945890009f},
-std::array<float,2>{0.530021667f, 0.269964486f},
-std::array<float,2>{0.664984047f, 0.872874677f},
-std::array<float,2>{0.441756129f, 0.489828378f},
-std::array<float,2>{0.132399291f, 0.669460237f},
-std::array<float,2>{0.958882213f, 0.20393163f},
-std::array<float,2>{0.9624722f, 0.752553105f},
-std::array<float,2>{0.140051574f, 0.37627241f},
-std::array<float,2>{0.447412491f, 0.705779314f},
-std::array<float,2>{0.663555443f, 0.132510558f},
-std::array<float,2>{0.520645618f, 0.555383384f},
-std::array<float,2>{0.269200832f, 0.101705201f},
-std::array<float,2>{0.0771199837f, 0.929829538f},
-std::array<float,2>{0.765518248f, 0.317670465f},
-std::array<float,2>{0.829932868f, 0.680116177f},
-std::array<float,2>{0.00140103197f, 0.197307453f},
-std::array<float,2>{0.321835786f, 0.855097532f},
-std::array<float,2>{0.564437091f, 0.476271987f},
-std::array<float,2>{0.71745944f, 0.964753926f},
-std::array<float,2>{0.418989271f, 0.252508283f},
-std::array<float,2>{0.244834304f, 0.603405476f},
-std::array<float,2>{0.876458824f, 0.0551522113f},
-std::array<float,2>{0.800091445f, 0.877387881f},
-std::array<float,2>{0.100650042f, 0.357012063f},
-std::array<float,2>{0.285265505f, 0.513138533f},
-std::array<float,2>{0.536157131f, 0.0850595459f},
-std::array<float,2>{0.653514624f, 0.73832351f},
-std::array<float,2>{0.470110267f, 0.17727758f},
-std::array<float,2>{0.183185771f, 0.786023617f},
-std::array<float,2>{0.987574399f, 0.407136202f},
-std::array<float,2>{0.922953606f, 0.577700019f},
-std::array<float,2>{0.200027168f, 0.0203013178f},
-std::array<float,2>{0.401378453f, 0.99944514f},
-std::array<float,2>{0.720047116f, 0.292814642f},
-std::array<float,2>{0.604054213f, 0.819248438f},
-std::array<float,2>{0.364777029f, 0.439140081f},
-std::array<float,2>{0.0356587619f, 0.631904483f},
-std::array<float,2>{0.862842441f, 0.24234876f},
-std::array<float,2>{0.858554363f, 0.869870722f},
-std::array<float,2>{0.053014297f, 0.487523705f},
-std::array<float,2>{0.358366817f, 0.666484177f},
-std::array<float,2>{0.6232903f, 0.20967871f},
-std::array<float,2>{0.744943678f, 0.613667548f},
-std::array<float,2>{0.389187247f, 0.0459324569f},
-std::array<float,2>{0.203414604f, 0.952480316f},
-std::array<float,2>{0.921703398f, 0.269393623f},
-std::array<float,2>{0.974606454f, 0.698664963f},
-std::array<float,2>{0.17109555f, 0.146937326f},
-std::array<float,2>{0.499591887f, 0.775964916f},
-std::array<float,2>{0.629104614f, 0.39420101f},
-std::array<float,2>{0.561263144f, 0.920476675f},
-std::array<float,2>{0.305857658f, 0.337106973f},
-std::array<float,2>{0.120415054f, 0.541288793f},
-std::array<float,2>{0.783602238f, 0.110123478f},
-std::array<float,2>{0.899936318f, 0.981264174f},
-std::array<float,2>{0.22178632f, 0.308887362f},
-std::array<float,2>{0.423733056f, 0.589895427f},
-std::array<float,2>{0.688093066f, 0.00907697622f},
-std::array<float,2>{0.582613826f, 0.650147378f},
-std::array<float,2>{0.332430661f, 0.221816301f},
-std::array<float,2>{0.0158580113f, 0.840009987f},
-std::array<float,2>{0.815088332f, 0.462558687f},
-std::array<float,2>{0.766481519f, 0.522821128f},
-std::array<float,2>{0.0929760933f, 0.0636398047f},
-std::array<float,2>{0.255499154f, 0.901139855f},
-std::array<float,2>{0.503950536f, 0.37103352f},
-std::array<float,2>{0.685170233f, 0.804212332f},
-std::array<float,2>{0.462220728f, 0.423853964f},
-std::array<float,2>{0.15341875f, 0.721839905f},
-std::array<float,2>{0.948073566f, 0.159604877f},
-std::array<float,2>{0.906327784f, 0.832020879f},
-std::array<float,2>{0.217181921f, 0.453844637f},
-std::array<float,2>{0.380100876f, 0.646961927f},
-std::array<float,2>{0.736263335f, 0.232007384f},
-std::array<float,2>{0.61174947f, 0.582492292f},
-std::array<float,2>{0.349541336f, 0.000102276383f},
-std::array<float,2>{0.0622566976f, 0.973715484f},
-std::array<float,2>{0.847826958f, 0.297151059f},
-std::array<float,2>{0.794412374f, 0.729300499f},
-std::array<float,2>{0.110189393f, 0.170762539f},
-std::array<float,2>{0.297610074f, 0.81053865f},
-std::array<float,2>{0.552611053f, 0.437411249f},
-std::array<float,2>{0.638501644f, 0.893739522f},
-std::array<float,2>{0.489570051f, 0.363095999f},
-std::array<float,2>{0.16260545f, 0.523755074f},
-std::array<float,2>{0.981395781f, 0.0710386634f},
-std::array<float,2>{0.826120853f, 0.9407956f},
-std::array<float,2>{0.0311745442f, 0.278398722f},
-std::array<float,2>{0.336265713f, 0.621114552f},
-std::array<float,2>{0.590282619f, 0.0320037566f},
-std::array<float,2>{0.698347092f, 0.66107142f},
-std::array<float,2>{0.435340196f, 0.212818861f},
-std::array<float,2>{0.230154529f, 0.860123277f},
-std::array<float,2>{0.891406715f, 0.494806379f},
-std::array<float,2>{0.943631113f, 0.538367033f},
-std::array<float,2>{0.145690963f, 0.12296588f},
-std::array<float,2>{0.457595497f, 0.9121539f},
-std::array<float,2>{0.678789496f, 0.331492484f},
-std::array<float,2>{0.513188541f, 0.770061731f},
-std::array<float,2>{0.263417602f, 0.403776407f},
-std::array<float,2>{0.0782053694f, 0.691953182f},
-std::array<float,2>{0.777107537f, 0.150944069f},
-std::array<float,2>{0.750207245f, 0.795387089f},
-std::array<float,2>{0.0690986589f, 0.419248372f},
-std::array<float,2>{0.274346381f, 0.746035099f},
-std::array<float,2>{0.527152181f, 0.185587436f},
-std::array<float,2>{0.669837236f, 0.505311131f},
-std::array<float,2>{0.440805316f, 0.0867685005f},
-std::array<float,2>{0.127169356f, 0.887868345f},
-std::array<float,2>{0.95398742f, 0.343935281f},
-std::array<float,2>{0.8887012f, 0.638055682f},
-std::array<float,2>{0.237593845f, 0.236466289f},
-std::array<float,2>{0.413267136f, 0.825267792f},
-std::array<float,2>{0.705512643f, 0.449566483f},
-std::array<float,2>{0.571208835f, 0.985767424f},
-std::array<float,2>{0.313341707f, 0.282678366f},
-std::array<float,2>{0.0107007045f, 0.563448071f},
-std::array<float,2>{0.841066003f, 0.029539967f},
-std::array<float,2>{0.993489742f, 0.929079831f},
-std::array<float,2>{0.178428739f, 0.324610531f},
-std::array<float,2>{0.483601838f, 0.551112533f},
-std::array<float,2>{0.645546854f, 0.0997313485f},
-std::array<float,2>{0.542630315f, 0.716418028f},
-std::array<float,2>{0.292554885f, 0.136836022f},
-std::array<float,2>{0.104985617f, 0.759878099f},
-std::array<float,2>{0.808440447f, 0.383467644f},
-std::array<float,2>{0.874206126f, 0.599406362f},
-std::array<float,2>{0.0406382233f, 0.0505666658f},
-std::array<float,2>{0.369811296f, 0.956236064f},
-std::array<float,2>{0.596273422f, 0.262867928f},
-std::array<float,2>{0.732943535f, 0.844730079f},
-std::array<float,2>{0.397988588f, 0.481581241f},
-std::array<float,2>{0.191459432f, 0.679277241f},
-std::array<float,2>{0.935307086f, 0.187663287f},
-std::array<float,2>{0.882744789f, 0.80678618f},
-std::array<float,2>{0.246476352f, 0.430249482f},
-std::array<float,2>{0.414499998f, 0.73303467f},
-std::array<float,2>{0.712068081f, 0.167744651f},
-std::array<float,2>{0.566607416f, 0.530300379f},
-std::array<float,2>{0.325911254f, 0.0763100386f},
-std::array<float,2>{0.00637744553f, 0.894804239f},
-std::array<float,2>{0.835740447f, 0.367011756f},
-std::array<float,2>{0.759467602f, 0.642463863f},
-std::array<float,2>{0.0728721395f, 0.227365613f},
-std::array<float,2>{0.27052474f, 0.833795667f},
-std::array<float,2>{0.516005814f, 0.457688272f},
-std::array<float,2>{0.657655776f, 0.971296072f},
-std::array<float,2>{0.452358514f, 0.30457145f},
-std::array<float,2>{0.133191943f, 0.578724861f},
-std::array<float,2>{0.967615724f, 0.00572725339f},
-std::array<float,2>{0.864059865f, 0.909472942f},
-std::array<float,2>{0.0313251726f, 0.335487336f},
-std::array<float,2>{0.363022f, 0.53141886f},
-std::array<float,2>{0.608671129f, 0.118740164f},
-std::array<float,2>{0.724131644f, 0.689971447f},
-std::array<float,2>{0.403849185f, 0.154817998f},
-std::array<float,2>{0.196091652f, 0.769467294f},
-std::array<float,2>{0.927882493f, 0.399659872f},
-std::array<float,2>{0.990066171f, 0.618953705f},
-std::array<float,2>{0.184655935f, 0.0352359191f},
-std::array<float,2>{0.4727512f, 0.943965912f},
-std::array<float,2>{0.650482118f, 0.276106864f},
-std::array<float,2>{0.533280134f, 0.864468753f},
-std::array<float,2>{0.283837467f, 0.498832136f},
-std::array<float,2>{0.0950465947f, 0.656306446f},
-std::array<float,2>{0.801075876f, 0.216345713f},
-std::array<float,2>{0.785524487f, 0.822037637f},
-std::array<float,2>{0.124097601f, 0.446149379f},
-std::array<float,2>{0.310330212f, 0.63563323f},
-std::array<float,2>{0.558138251f, 0.239147559f},
-std::array<float,2>{0.626347005f, 0.568476081f},
-std::array<float,2>{0.495425612f, 0.0244214106f},
-std::array<float,2>{0.165149808f, 0.988369167f},
-std::array<float,2>{0.971810579f, 0.288148433f},
-std::array<float,2>{0.917527139f, 0.748195946f},
-std::array<float,2>{0.21062623f, 0.183454558f},
-std::array<float,2>{0.385003984f, 0.791543603f},
-std::array<float,2>{0.74909544f, 0.414797813f},
-std::array<float,2>{0.617433965f, 0.885457516f},
-std::array<float,2>{0.35323143f, 0.34772411f},
-std::array<float,2>{0.047483474f, 0.501372576f},
-std::array<float,2>{0.854282439f, 0.0910553634f},
-std::array<float,2>{0.951167881f, 0.959595859f},
-std::array<float,2>{0.152202234f, 0.257848501f},
-std::array<float,2>{0.4666394f, 0.595844328f},
-std::array<float,2>{0.683336914f, 0.0514350794f},
-std::array<float,2>{0.501676321f, 0.672910571f},
-std::array<float,2>{0.250520766f, 0.193159595f},
-std::array<float,2>{0.0862464532f, 0.849202991f},
-std::array<float,2>{0.769622147f, 0.479796022f},
-std::array<float,2>{0.818027556f, 0.54752624f},
-std::array<float,2>{0.0226524714f, 0.0945933759f},
-std::array<float,2>{0.329630703f, 0.923542321f},
-std::array<float,2>{0.58011651f, 0.321288854f},
-std::array<float,2>{0.694203913f, 0.764549494f},
-std::array<float,2>{0.42606464f, 0.389847666f},
-std::array<float,2>{0.223285347f, 0.7117787f},
-std::array<float,2>{0.904081464f, 0.135267034f},
-std::array<float,2>{0.979887664f, 0.856944203f},
-std::array<float,2>{0.157231659f, 0.471523851f},
-std::array<float,2>{0.484988034f, 0.685359418f},
-std::array<float,2>{0.634882629f, 0.200161606f},
-std::array<float,2>{0.549999833f, 0.607577801f},
-std::array<float,2>{0.30094406f, 0.0621208102f},
-std::array<float,2>{0.115554683f, 0.96576196f},
-std::array<float,2>{0.79002291f, 0.25435102f},
-std::array<float,2>{0.845286489f, 0.708939612f},
-std::array<float,2>{0.0567300469f, 0.127456918f},
-std::array<float,2>{0.345267951f, 0.756356239f},
-std::array<float,2>{0.616972268f, 0.3799299f},
-std::array<float,2>{0.740756154f, 0.934483588f},
-std::array<float,2>{0.377849996f, 0.314436942f},
-std::array<float,2>{0.211866572f, 0.561791182f},
-std::array<float,2>{0.911622524f, 0.107205577f},
-std::array<float,2>{0.778611779f, 0.994519711f},
-std::array<float,2>{0.0841785073f, 0.294678032f},
-std::array<float,2>{0.260956198f, 0.572135508f},
-std::array<float,2>{0.508466482f, 0.0186783411f},
-std::array<float,2>{0.674686491f, 0.628072739f},
-std::array<float,2>{0.45328179f, 0.247323766f},
-std::array<float,2>{0.141059488f, 0.815147221f},
-std::array<float,2>{0.937925279f, 0.443451494f},
-std::array<float,2>{0.895667195f, 0.508974493f},
-std::array<float,2>{0.232327014f, 0.0801529661f},
-std::array<float,2>{0.430340976f, 0.878989458f},
-std::array<float,2>{0.699319422f, 0.353723884f},
-std::array<float,2>{0.586174846f, 0.781759024f},
-std::array<float,2>{0.341943026f, 0.412898213f},
-std::array<float,2>{0.0258575659f, 0.736926138f},
-std::array<float,2>{0.821003735f, 0.175392255f},
-std::array<float,2>{0.837265134f, 0.778020501f},
-std::array<float,2>{0.0118674394f, 0.39826113f},
-std::array<float,2>{0.31671977f, 0.700748265f},
-std::array<float,2>{0.576863408f, 0.143200055f},
-std::array<float,2>{0.707132816f, 0.546753168f},
-std::array<float,2>{0.407256216f, 0.117139034f},
-std::array<float,2>{0.241814479f, 0.916791379f},
-std::array<float,2>{0.886235476f, 0.341523349f},
-std::array<float,2>{0.960081697f, 0.669970095f},
-std::array<float,2>{0.130464852f, 0.205502793f},
-std::array<float,2>{0.444823712f, 0.87356019f},
-std::array<float,2>{0.666630566f, 0.490735143f},
-std::array<float,2>{0.529170096f, 0.948462188f},
-std::array<float,2>{0.278762072f, 0.271541834f},
-std::array<float,2>{0.0627165884f, 0.61212492f},
-std::array<float,2>{0.754487276f, 0.0400224105f},
-std::array<float,2>{0.933160305f, 0.902511001f},
-std::array<float,2>{0.18895942f, 0.372060716f},
-std::array<float,2>{0.390929878f, 0.517594397f},
-std::array<float,2>{0.729015768f, 0.0676832721f},
-std::array<float,2>{0.600460649f, 0.726304114f},
-std::array<float,2>{0.371247202f, 0.160495579f},
-std::array<float,2>{0.0450537913f, 0.800553739f},
-std::array<float,2>{0.867380679f, 0.426358253f},
-std::array<float,2>{0.808709502f, 0.589683056f},
-std::array<float,2>{0.108201422f, 0.012527572f},
-std::array<float,2>{0.295903206f, 0.979542434f},
-std::array<float,2>{0.544427752f, 0.305540621f},
-std::array<float,2>{0.642377615f, 0.836459756f},
-std::array<float,2>{0.47703898f, 0.466293991f},
-std::array<float,2>{0.174129143f, 0.654808819f},
-std::array<float,2>{0.997005224f, 0.224785015f},
-std::array<float,2>{0.949199975f, 0.801386237f},
-std::array<float,2>{0.152403027f, 0.423185855f},
-std::array<float,2>{0.461102873f, 0.720559716f},
-std::array<float,2>{0.683781862f, 0.157391474f},
-std::array<float,2>{0.505069733f, 0.519943357f},
-std::array<float,2>{0.25451532f, 0.0647232309f},
-std::array<float,2>{0.0921810344f, 0.899396837f},
-std::array<float,2>{0.766669035f, 0.368988782f},
-std::array<float,2>{0.815433443f, 0.650705218f},
-std::array<float,2>{0.0170929693f, 0.220088184f},
-std::array<float,2>{0.333775014f, 0.842836142f},
-std::array<float,2>{0.583770037f, 0.463666111f},
-std::array<float,2>{0.689086854f, 0.983409584f},
-std::array<float,2>{0.422344923f, 0.311475158f},
-std::array<float,2>{0.221138239f, 0.593538642f},
-std::array<float,2>{0.898623466f, 0.0115254875f},
-std::array<float,2>{0.784866869f, 0.918262422f},
-std::array<float,2>{0.119931035f, 0.337894142f},
-std::array<float,2>{0.305062175f, 0.540526807f},
-std::array<float,2>{0.562098801f, 0.111969441f},
-std::array<float,2>{0.630150676f, 0.6966151f},
-std::array<float,2>{0.498722464f, 0.144721627f},
-std::array<float,2>{0.170833156f, 0.775036752f},
-std::array<float,2>{0.973632395f, 0.391512811f},
-std::array<float,2>{0.920695245f, 0.61558795f},
-std::array<float,2>{0.204995379f, 0.0446777642f},
-std::array<float,2>{0.390404522f, 0.950371802f},
-std::array<float,2>{0.746038795f, 0.26749894f},
-std::array<float,2>{0.624178588f, 0.867306411f},
-std::array<float,2>{0.359101206f, 0.484731793f},
-std::array<float,2>{0.0546532758f, 0.665782034f},
-std::array<float,2>{0.857966065f, 0.208513379f},
-std::array<float,2>{0.861560524f, 0.817847729f},
-std::array<float,2>{0.03649747f, 0.4412705f},
-std::array<float,2>{0.363319218f, 0.630624115f},
-std::array<float,2>{0.605259478f, 0.2454191f},
-std::array<float,2>{0.719574511f, 0.574926138f},
-std::array<float,2>{0.401328385f, 0.0230178852f},
-std::array<float,2>{0.200395495f, 0.996900678f},
-std::array<float,2>{0.922798395f, 0.289727926f},
-std::array<float,2>{0.986581445f, 0.741028786f},
-std::array<float,2>{0.181817323f, 0.179039329f},
-std::array<float,2>{0.469269395f, 0.78822279f},
-std::array<float,2>{0.652786553f, 0.410125881f},
-std::array<float,2>{0.535182357f, 0.875204086f},
-std::array<float,2>{0.286924422f, 0.358621508f},
-std::array<float,2>{0.10011638f, 0.514701247f},
-std::array<float,2>{0.799227476f, 0.0839430168f},
-std::array<float,2>{0.875344455f, 0.962535262f},
-std::array<float,2>{0.245459229f, 0.251667738f},
-std::array<float,2>{0.41866982f, 0.604734123f},
-std::array<float,2>{0.718520701f, 0.0573564023f},
-std::array<float,2>{0.563134372f, 0.681787729f},
-std::array<float,2>{0.320955962f, 0.196524903f},
-std::array<float,2>{0.000923379732f, 0.852950573f},
-std::array<float,2>{0.828240991f, 0.472676009f},
-std::array<float,2>{0.764217496f, 0.557652295f},
-std::array<float,2>{0.0777778849f, 0.103992671f},
-std::array<float,2>{0.267868906f, 0.93192476f},
-std::array<float,2>{0.519874156f, 0.320231199f},
-std::array<float,2>{0.662337005f, 0.750426948f},
-std::array<float,2>{0.448610932f, 0.377396792f},
-std::array<float,2>{0.139110684f, 0.703435659f},
-std::array<float,2>{0.961176157f, 0.129826203f},
-std::array<float,2>{0.933852494f, 0.846280575f},
-std::array<float,2>{0.193210676f, 0.482932657f},
-std::array<float,2>{0.396517158f, 0.677448452f},
-std::array<float,2>{0.733875632f, 0.19079864f},
-std::array<float,2>{0.597013831f, 0.600981593f},
-std::array<float,2>{0.37012434f, 0.0478900485f},
-std::array<float,2>{0.0391764306f, 0.953267634f},
-std::array<float,2>{0.873939276f, 0.265416294f},
-std::array<float,2>{0.806717873f, 0.718134463f},
-std::array<float,2>{0.104035974f, 0.139301643f},
-std::array<float,2>{0.291681319f, 0.75917691f},
-std::array<float,2>{0.541336894f, 0.386053026f},
-std::array<float,2>{0.645000815f, 0.926251948f},
-std::array<float,2>{0.483336538f, 0.326440603f},
-std::array<float,2>{0.179063633f, 0.554391861f},
-std::array<float,2>{0.992833495f, 0.0983959809f},
-std::array<float,2>{0.840171456f, 0.988170326f},
-std::array<float,2>{0.0108947763f, 0.283528924f},
-std::array<float,2>{0.313501894f, 0.566125035f},
-std::array<float,2>{0.571485102f, 0.0287446342f},
-std::array<float,2>{0.70674181f, 0.640004456f},
-std::array<float,2>{0.412252218f, 0.235357061f},
-std::array<float,2>{0.236579135f, 0.827734411f},
-std::array<float,2>{0.890188694f, 0.45240736f},
-std::array<float,2>{0.954962552f, 0.507321358f},
-std::array<float,2>{0.128320113f, 0.0897132084f},
-std::array<float,2>{0.439986706f, 0.890264094f},
-std::array<float,2>{0.668105125f, 0.346722364f},
-std::array<float,2>{0.525876939f, 0.794844329f},
-std::array<float,2>{0.274557412f, 0.421587706f},
-std::array<float,2>{0.0699388906f, 0.743182182f},
-std::array<float,2>{0.75129199f, 0.185177028f},
-std::array<float,2>{0.77616024f, 0.772721291f},
-std::array<float,2>{0.0794195533f, 0.405721784f},
-std::array<float,2>{0.262560099f, 0.694209516f},
-std::array<float,2>{0.51237458f, 0.148529723f},
-std::array<float,2>{0.678608716f, 0.535210729f},
-std::array<float,2>{0.458108366f, 0.124669619f},
-std::array<float,2>{0.145435035f, 0.911067963f},
-std::array<float,2>{0.944648147f, 0.329236597f},
-std::array<float,2>{0.892386377f, 0.663222253f},
-std::array<float,2>{0.229020685f, 0.214542881f},
-std::array<float,2>{0.434350908f, 0.862003744f},
-std::array<float,2>{0.69764483f, 0.49290809f},
-std::array<float,2>{0.590947688f, 0.939048767f},
-std::array<float,2>{0.337875634f, 0.281211048f},
-std::array<float,2>{0.0297919475f, 0.624767601f},
-std::array<float,2>{0.824429572f, 0.0351353921f},
-std::array<float,2>{0.982020557f, 0.891666353f},
-std::array<float,2>{0.163429171f, 0.361097872f},
-std::array<float,2>{0.488810182f, 0.525497019f},
-std::array<float,2>{0.6367535f, 0.072457619f},
-std::array<float,2>{0.550930798f, 0.726585925f},
-std::array<float,2>{0.298333794f, 0.169233829f},
-std::array<float,2>{0.110415615f, 0.812341988f},
-std::array<float,2>{0.793114662f, 0.43494308f},
-std::array<float,2>{0.849532425f, 0.585257709f},
-std::array<float,2>{0.0609055236f, 0.00366632454f},
-std::array<float,2>{0.348391384f, 0.974709809f},
-std::array<float,2>{0.6128757f, 0.300602585f},
-std::array<float,2>{0.734578609f, 0.82943958f},
-std::array<float,2>{0.379204452f, 0.45535484f},
-std::array<float,2>{0.218145832f, 0.645483971f},
-std::array<float,2>{0.908194661f, 0.232731029f},
-std::array<float,2>{0.902728975f, 0.762019157f},
-std::array<float,2>{0.224165991f, 0.388501227f},
-std::array<float,2>{0.427113295f, 0.71337539f},
-std::array<float,2>{0.694871843f, 0.133256719f},
-std::array<float,2>{0.581192553f, 0.549888849f},
-std::array<float,2>{0.328812838f, 0.0970873088f},
-std::array<float,2>{0.0218471419f, 0.924478948f},
-std::array<float,2>{0.81717062f, 0.324121654f},
-std::array<float,2>{0.771190107f, 0.673934937f},
-std::array<float,2>{0.0875784531f, 0.193501681f},
-std::array<float,2>{0.251374364f, 0.851328373f},
-std::array<float,2>{0.50072974f, 0.476899207f},
-std::array<float,2>{0.682572722f, 0.958593786f},
-std::array<float,2>{0.465761244f, 0.261670232f},
-std::array<float,2>{0.150906682f, 0.594136655f},
-std::array<float,2>{0.949873805f, 0.0546669215f},
-std::array<float,2>{0.854925692f, 0.884740353f},
-std::array<float,2>{0.0482506603f, 0.349995881f},
-std::array<float,2>{0.35175702f, 0.503022909f},
-std::array<float,2>{0.618537962f, 0.0928988233f},
-std::array<float,2>{0.748378456f, 0.746330082f},
-std::array<float,2>{0.385949939f, 0.180944994f},
-std::array<float,2>{0.209797427f, 0.789420128f},
-std::array<float,2>{0.916538358f, 0.416305453f},
-std::array<float,2>{0.971123099f, 0.568290234f},
-std::array<float,2>{0.16444464f, 0.0256704111f},
-std::array<float,2>{0.494965553f, 0.991922081f},
-std::array<float,2>{0.625188649f, 0.286209106f},
-std::array<float,2>{0.557005405f, 0.823168457f},
-std::array<float,2>{0.308969587f, 0.449210435f},
-std::array<float,2>{0.123974249f, 0.634008229f},
-std::array<float,2>{0.7869187f, 0.241130665f},
-std::array<float,2>{0.802232802f, 0.865864575f},
-std::array<float,2>{0.0942128599f, 0.496148795f},
-std::array<float,2>{0.284440666f, 0.659293652f},
-std::array<float,2>{0.534805119f, 0.21807164f},
-std::array<float,2>{0.651884019f, 0.620170712f},
-std::array<float,2>{0.474460602f, 0.0379932709f},
-std::array<float,2>{0.184086889f, 0.942704737f},
-std::array<float,2>{0.988417149f, 0.274596214f},
-std::array<float,2>{0.929026425f, 0.689135909f},
-std::array<float,2>{0.197144419f, 0.153681546f},
-std::array<float,2>{0.403064936f, 0.766946375f},
-std::array<float,2>{0.72335428f, 0.401643217f},
-std::array<float,2>{0.607472479f, 0.907746673f},
-std::array<float,2>{0.362175763f, 0.332835853f},
-std::array<float,2>{0.0324126743f, 0.534088016f},
-std::array<float,2>{0.864687979f, 0.120952375f},
-std::array<float,2>{0.968110323f, 0.968886971f},
-std::array<float,2>{0.134612799f, 0.300930828f},
-std::array<float,2>{0.451560348f, 0.581595957f},
-std::array<float,2>{0.657090783f, 0.0059095514f},
-std::array<float,2>{0.517208099f, 0.643498123f},
-std::array<float,2>{0.270037621f, 0.228543848f},
-std::array<float,2>{0.0733855814f, 0.835291505f},
-std::array<float,2>{0.758494735f, 0.460759878f},
-std::array<float,2>{0.834742963f, 0.528888106f},
-std::array<float,2>{0.00702401856f, 0.0753599256f},
-std::array<float,2>{0.324336588f, 0.897830307f},
-std::array<float,2>{0.568053663f, 0.363608748f},
-std::array<float,2>{0.711752057f, 0.806287169f},
-std::array<float,2>{0.415474385f, 0.43314752f},
-std::array<float,2>{0.247253805f, 0.730985165f},
-std::array<float,2>{0.881269276f, 0.165879071f},
-std::array<float,2>{0.997534215f, 0.839152038f},
-std::array<float,2>{0.175033018f, 0.466917396f},
-std::array<float,2>{0.478280395f, 0.65385282f},
-std::array<float,2>{0.640673161f, 0.224560723f},
-std::array<float,2>{0.543581963f, 0.586568654f},
-std::array<float,2>{0.294984758f, 0.0148716317f},
-std::array<float,2>{0.108934835f, 0.976902723f},
-std::array<float,2>{0.810287595f, 0.308079094f},
-std::array<float,2>{0.868507683f, 0.723583817f},
-std::array<float,2>{0.0460825413f, 0.163538978f},
-std::array<float,2>{0.372956157f, 0.797340989f},
-std::array<float,2>{0.601292729f, 0.429429084f},
-std::array<float,2>{0.729876518f, 0.904406607f},
-std::array<float,2>{0.392562002f, 0.374121577f},
-std::array<float,2>{0.187851086f, 0.516734779f},
-std::array<float,2>{0.931893229f, 0.0695799664f},
-std::array<float,2>{0.755118132f, 0.946956992f},
-std::array<float,2>{0.0636000633f, 0.271121889f},
-std::array<float,2>{0.277608007f, 0.610523641f},
-std::array<float,2>{0.527623475f, 0.0422012471f},
-std::array<float,2>{0.667025924f, 0.668546677f},
-std::array<float,2>{0.443507373f, 0.204121098f},
-std::array<float,2>{0.12970902f, 0.871813297f},
-std::array<float,2>{0.959203541f, 0.488625795f},
-std::array<float,2>{0.885398328f, 0.544066072f},
-std::array<float,2>{0.240798846f, 0.11375948f},
-std::array<float,2>{0.406614244f, 0.914206386f},
-std::array<float,2>{0.708665371f, 0.341915935f},
-std::array<float,2>{0.577951789f, 0.779676795f},
-std::array<float,2>{0.318044782f, 0.394636869f},
-std::array<float,2>{0.0132714091f, 0.702321231f},
-std::array<float,2>{0.836597979f, 0.142120883f},
-std::array<float,2>{0.822050452f, 0.784521103f},
-std::array<float,2>{0.0266986284f, 0.411244184f},
-std::array<float,2>{0.34290728f, 0.736200213f},
-std::array<float,2>{0.586951971f, 0.172079444f},
-std::array<float,2>{0.700791657f, 0.511142194f},
-std::array<float,2>{0.430707753f, 0.078294456f},
-std::array<float,2>{0.231199756f, 0.881221712f},
-std::array<float,2>{0.895360172f, 0.352731973f},
-std::array<float,2>{0.939033628f, 0.625683546f},
-std::array<float,2>{0.14164567f, 0.24972342f},
-std::array<float,2>{0.454294264f, 0.813503444f},
-std::array<float,2>{0.674958229f, 0.442180485f},
-std::array<float,2>{0.508992136f, 0.992624879f},
-std::array<float,2>{0.260104656f, 0.295329332f},
-std::array<float,2>{0.0856206566f, 0.572598398f},
-std::array<float,2>{0.77820009f, 0.0173368603f},
-std::array<float,2>{0.910188019f, 0.936504066f},
-std::array<float,2>{0.212406129f, 0.316215724f},
-std::array<float,2>{0.378026128f, 0.558838725f},
-std::array<float,2>{0.741916537f, 0.107581422f},
-std::array<float,2>{0.615515292f, 0.71054107f},
-std::array<float,2>{0.344452113f, 0.125475958f},
-std::array<float,2>{0.0585155487f, 0.754920065f},
-std::array<float,2>{0.843848169f, 0.382258922f},
-std::array<float,2>{0.790379107f, 0.606959701f},
-std::array<float,2>{0.116559349f, 0.0602944307f},
-std::array<float,2>{0.30237332f, 0.967904925f},
-std::array<float,2>{0.549260318f, 0.256583571f},
-std::array<float,2>{0.636609852f, 0.859137595f},
-std::array<float,2>{0.485692859f, 0.470258385f},
-std::array<float,2>{0.157005548f, 0.685622573f},
-std::array<float,2>{0.978695869f, 0.201342046f},
-std::array<float,2>{0.976162314f, 0.776867092f},
-std::array<float,2>{0.169465676f, 0.393453658f},
-std::array<float,2>{0.497695267f, 0.697690487f},
-std::array<float,2>{0.631587625f, 0.148065045f},
-std::array<float,2>{0.560447872f, 0.542897046f},
-std::array<float,2>{0.308433861f, 0.11123094f},
-std::array<float,2>{0.118394986f, 0.921697497f},
-std::array<float,2>{0.781703472f, 0.336669803f},
-std::array<float,2>{0.856423259f, 0.66764611f},
-std::array<float,2>{0.0527008437f, 0.210065261f},
-std::array<float,2>{0.356045157f, 0.870376647f},
-std::array<float,2>{0.621490955f, 0.486728251f},
-std::array<float,2>{0.743880212f, 0.951269329f},
-std::array<float,2>{0.387358308f, 0.267936945f},
-std::array<float,2>{0.205087751f, 0.614379346f},
-std::array<float,2>{0.918832958f, 0.0457327552f},
-std::array<float,2>{0.768810809f, 0.902178526f},
-std::array<float,2>{0.0906288996f, 0.370090693f},
-std::array<float,2>{0.256006062f, 0.521485567f},
-std::array<float,2>{0.505897045f, 0.0626052395f},
-std::array<float,2>{0.686462045f, 0.720714927f},
-std::array<float,2>{0.464098871f, 0.15825142f},
-std::array<float,2>{0.155273378f, 0.803396106f},
-std::array<float,2>{0.946305335f, 0.425666451f},
-std::array<float,2>{0.901800156f, 0.5912835f},
-std::array<float,2>{0.220698789f, 0.00867782999f},
-std::array<float,2>{0.424937189f, 0.981839001f},
-std::array<float,2>{0.69045198f, 0.310107887f},
-std::array<float,2>{0.584385455f, 0.840916574f},
-std::array<float,2>{0.334837377f, 0.461058736f},
-std::array<float,2>{0.0193926468f, 0.64884764f},
-std::array<float,2>{0.813688338f, 0.221585155f},
-std::array<float,2>{0.831724882f, 0.85408473f},
-std::array<float,2>{0.0028900886f, 0.474787533f},
-std::array<float,2>{0.32396099f, 0.681504428f},
-std::array<float,2>{0.565983176f, 0.198999122f},
-std::array<float,2>{0.715599418f, 0.602476001f},
-std::array<float,2>{0.420208037f, 0.0565765277f},
-std::array<float,2>{0.243307218f, 0.963730097f},
-std::array<float,2>{0.878323078f, 0.253078908f},
-std::array<float,2>{0.964189589f, 0.706105947f},
-std::array<float,2>{0.137686327f, 0.131470993f},
-std::array<float,2>{0.44719398f, 0.753247678f},
-std::array<float,2>{0.662061572f, 0.375415504f},
-std::array<float,2>{0.522115231f, 0.931434751f},
-std::array<float,2>{0.266037941f, 0.316898972f},
-std::array<float,2>{0.0748375952f, 0.556022108f},
-std::array<float,2>{0.763214111f, 0.102944925f},
-std::array<float,2>{0.92511034f, 0.998513043f},
-std::array<float,2>{0.20127818f, 0.291340649f},
-std::array<float,2>{0.399827182f, 0.577051699f},
-std::array<float,2>{0.721371472f, 0.0206914004f},
-std::array<float,2>{0.602541804f, 0.631734908f},
-std::array<float,2>{0.365898848f, 0.243504077f},
-std::array<float,2>{0.0378317907f, 0.81944257f},
-std::array<float,2>{0.861103117f, 0.438119799f},
-std::array<float,2>{0.796985209f, 0.512230814f},
-std::array<float,2>{0.0982792005f, 0.0840183422f},
-std::array<float,2>{0.287953079f, 0.878492296f},
-std::array<float,2>{0.537914634f, 0.355968684f},
-std::array<float,2>{0.654413998f, 0.786680222f},
-std::array<float,2>{0.472615927f, 0.407375425f},
-std::array<float,2>{0.179733634f, 0.740156472f},
-std::array<float,2>{0.985104144f, 0.176026344f},
-std::array<float,2>{0.888296902f, 0.824809551f},
-std::array<float,2>{0.236277908f, 0.45070982f},
-std::array<float,2>{0.411623299f, 0.636982143f},
-std::array<float,2>{0.704016507f, 0.237565815f},
-std::array<float,2>{0.573977053f, 0.564120889f},
-std::array<float,2>{0.315719992f, 0.0307109039f},
-std::array<float,2>{0.0094228955f, 0.98520261f},
-std::array<float,2>{0.84306711f, 0.28182748f},
-std::array<float,2>{0.752004206f, 0.744834244f},
-std::array<float,2>{0.0672262087f, 0.186722323f},
-std::array<float,2>{0.276666313f, 0.796029389f},
-std::array<float,2>{0.524002969f, 0.418717861f},
-std::array<float,2>{0.671466231f, 0.887208819f},
-std::array<float,2>{0.438556254f, 0.34548068f},
-std::array<float,2>{0.125854909f, 0.504562736f},
-std::array<float,2>{0.956881881f, 0.0872558132f},
-std::array<float,2>{0.871561348f, 0.955737472f},
-std::array<float,2>{0.0423079319f, 0.262100995f},
-std::array<float,2>{0.369128346f, 0.598140836f},
-std::array<float,2>{0.594713926f, 0.0493942611f},
-std::array<float,2>{0.731142521f, 0.678104818f},
-std::array<float,2>{0.394661248f, 0.188878596f},
-std::array<float,2>{0.195055291f, 0.84402138f},
-std::array<float,2>{0.936888397f, 0.480823696f},
-std::array<float,2>{0.995538354f, 0.552170157f},
-std::array<float,2>{0.176658303f, 0.100990579f},
-std::array<float,2>{0.48205635f, 0.928406537f},
-std::array<float,2>{0.647113919f, 0.325662345f},
-std::array<float,2>{0.540550768f, 0.760806143f},
-std::array<float,2>{0.289076835f, 0.384447336f},
-std::array<float,2>{0.101640776f, 0.715810061f},
-std::array<float,2>{0.805056572f, 0.138522968f},
-std::array<float,2>{0.795778275f, 0.809170723f},
-std::array<float,2>{0.112032175f, 0.436205089f},
-std::array<float,2>{0.300384134f, 0.729727864f},
-std::array<float,2>{0.553951859f, 0.171341836f},
-std::array<float,2>{0.639041305f, 0.524549842f},
-std::array<float,2>{0.491922349f, 0.0715691447f},
-std::array<float,2>{0.161175326f, 0.892701745f},
-std::array<float,2>{0.983138263f, 0.362276495f},
-std::array<float,2>{0.909702718f, 0.64801532f},
-std::array<float,2>{0.215516999f, 0.231438756f},
-std::array<float,2>{0.381510019f, 0.830737531f},
-std::array<float,2>{0.736458004f, 0.454415232f},
-std::array<float,2>{0.609668434f, 0.972982407f},
-std::array<float,2>{0.351167887f, 0.298402667f},
-std::array<float,2>{0.0589796007f, 0.583599746f},
-std::array<float,2>{0.850528121f, 0.00148923718f},
-std::array<float,2>{0.94194603f, 0.914059937f},
-std::array<float,2>{0.146741211f, 0.330593973f},
-std::array<float,2>{0.46049425f, 0.537417293f},
-std::array<float,2>{0.677052736f, 0.121193431f},
-std::array<float,2>{0.514105678f, 0.693279088f},
-std::array<float,2>{0.264642566f, 0.15222542f},
-std::array<float,2>{0.0803523809f, 0.771363199f},
-std::array<float,2>{0.773885012f, 0.402443945f},
-std::array<float,2>{0.826970994f, 0.622735023f},
-std::array<float,2>{0.02848229f, 0.032240022f},
-std::array<float,2>{0.338468552f, 0.939545631f},
-std::array<float,2>{0.591835499f, 0.277598023f},
-std::array<float,2>{0.696432948f, 0.861001253f},
-std::array<float,2>{0.436991423f, 0.495556891f},
-std::array<float,2>{0.228431761f, 0.661961854f},
-std::array<float,2>{0.893517911f, 0.211079597f},
-std::array<float,2>{0.915419996f, 0.792582929f},
-std::array<float,2>{0.207627639f, 0.41548425f},
-std::array<float,2>{0.384317487f, 0.749293745f},
-std::array<float,2>{0.747679055f, 0.18196772f},
-std::array<float,2>{0.620933414f, 0.500689209f},
-std::array<float,2>{0.354132146f, 0.0901492685f},
-std::array<float,2>{0.0489159934f, 0.886378646f},
-std::array<float,2>{0.852282643f, 0.34939608f},
-std::array<float,2>{0.788973808f, 0.636356235f},
-std::array<float,2>{0.121805504f, 0.239440203f},
-std::array<float,2>{0.311650664f, 0.821267426f},
-std::array<float,2>{0.555470824f, 0.446695566f},
-std::array<float,2>{0.62751776f, 0.989803195f},
-std::array<float,2>{0.492777348f, 0.287666619f},
-std::array<float,2>{0.167603627f, 0.56959796f},
-std::array<float,2>{0.969848096f, 0.0237377752f},
-std::array<float,2>{0.819096386f, 0.922714651f},
-std::array<float,2>{0.0214184579f, 0.321627051f},
-std::array<float,2>{0.331732064f, 0.547894955f},
-std::array<float,2>{0.579918861f, 0.0954601094f},
-std::array<float,2>{0.692410231f, 0.712368786f},
-std::array<float,2>{0.42925337f, 0.135874569f},
-std::array<float,2>{0.225521326f, 0.765448034f},
-std::array<float,2>{0.904732108f, 0.389570177f},
-std::array<float,2>{0.952874541f, 0.597150624f},
-std::array<float,2>{0.148998156f, 0.0519215092f},
-std::array<float,2>{0.466897547f, 0.960391939f},
-std::array<float,2>{0.681299925f, 0.25894931f},
-std::array<float,2>{0.502592564f, 0.848144948f},
-std::array<float,2>{0.252048314f, 0.478882402f},
-std::array<float,2>{0.0886215642f, 0.672014236f},
-std::array<float,2>{0.772761881f, 0.192059666f},
-std::array<float,2>{0.760762513f, 0.832482815f},
-std::array<float,2>{0.0718551576f, 0.458175153f},
-std::array<float,2>{0.27241379f, 0.641218424f},
-std::array<float,2>{0.518954992f, 0.2277174f},
-std::array<float,2>{0.658477247f, 0.579593301f},
-std::array<float,2>{0.449487597f, 0.00410311064f},
-std::array<float,2>{0.136653125f, 0.971777141f},
-std::array<float,2>{0.964882374f, 0.303000897f},
-std::array<float,2>{0.879872084f, 0.734045863f},
-std::array<float,2>{0.249696314f, 0.16661416f},
-std::array<float,2>{0.417750508f, 0.808153808f},
-std::array<float,2>{0.714255691f, 0.43094787f},
-std::array<float,2>{0.568557203f, 0.895608783f},
-std::array<float,2>{0.327019602f, 0.365587473f},
-std::array<float,2>{0.00425481144f, 0.529855788f},
-std::array<float,2>{0.833064795f, 0.0773153976f},
-std::array<float,2>{0.991838574f, 0.945102811f},
-std::array<float,2>{0.186409667f, 0.27705428f},
-std::array<float,2>{0.474957108f, 0.617807567f},
-std::array<float,2>{0.649384499f, 0.0362405926f},
-std::array<float,2>{0.532272875f, 0.657846034f},
-std::array<float,2>{0.281484157f, 0.215110213f},
-std::array<float,2>{0.0964698195f, 0.863378108f},
-std::array<float,2>{0.803416967f, 0.499985665f},
-std::array<float,2>{0.867028832f, 0.532455921f},
-std::array<float,2>{0.0349434726f, 0.11787264f},
-std::array<float,2>{0.360607326f, 0.908952832f},
-std::array<float,2>{0.60572207f, 0.334233671f},
-std::array<float,2>{0.726484895f, 0.768180013f},
-std::array<float,2>{0.405749053f, 0.398799241f},
-std::array<float,2>{0.198309213f, 0.691101789f},
-std::array<float,2>{0.927105546f, 0.155931756f},
-std::array<float,2>{0.95708102f, 0.874520242f},
-std::array<float,2>{0.13126646f, 0.491860002f},
-std::array<float,2>{0.442602307f, 0.671490192f},
-std::array<float,2>{0.665383279f, 0.206745535f},
-std::array<float,2>{0.530471921f, 0.612354338f},
-std::array<float,2>{0.280319661f, 0.0404587947f},
-std::array<float,2>{0.0654667988f, 0.947859883f},
-std::array<float,2>{0.756341398f, 0.273322016f},
-std::array<float,2>{0.838572562f, 0.699876368f},
-std::array<float,2>{0.0148130925f, 0.144212097f},
-std::array<float,2>{0.319424689f, 0.778602898f},
-std::array<float,2>{0.575587213f, 0.397077084f},
-std::array<float,2>{0.710180521f, 0.917018056f},
-std::array<float,2>{0.408553571f, 0.339993894f},
-std::array<float,2>{0.239189997f, 0.545310855f},
-std::array<float,2>{0.883746088f, 0.116182849f},
-std::array<float,2>{0.811249673f, 0.9794572f},
-std::array<float,2>{0.107120164f, 0.306226641f},
-std::array<float,2>{0.294299334f, 0.588177621f},
-std::array<float,2>{0.546304286f, 0.0128967967f},
-std::array<float,2>{0.644168675f, 0.655395031f},
-std::array<float,2>{0.478549778f, 0.226390436f},
-std::array<float,2>{0.17341049f, 0.837341607f},
-std::array<float,2>{0.998059869f, 0.465432316f},
-std::array<float,2>{0.930348516f, 0.518625021f},
-std::array<float,2>{0.190483168f, 0.066528596f},
-std::array<float,2>{0.393014371f, 0.903464735f},
-std::array<float,2>{0.727754056f, 0.372080833f},
-std::array<float,2>{0.599412799f, 0.799500823f},
-std::array<float,2>{0.374343395f, 0.426926047f},
-std::array<float,2>{0.0435896814f, 0.725580633f},
-std::array<float,2>{0.870854378f, 0.161789387f},
-std::array<float,2>{0.845801413f, 0.757373869f},
-std::array<float,2>{0.0555502139f, 0.379281491f},
-std::array<float,2>{0.346267104f, 0.707775414f},
-std::array<float,2>{0.613295615f, 0.12839818f},
-std::array<float,2>{0.740110159f, 0.560712218f},
-std::array<float,2>{0.375584573f, 0.106309861f},
-std::array<float,2>{0.213768899f, 0.935281396f},
-std::array<float,2>{0.912262022f, 0.312520117f},
-std::array<float,2>{0.977398336f, 0.684248984f},
-std::array<float,2>{0.159908712f, 0.200830013f},
-std::array<float,2>{0.486640453f, 0.856161952f},
-std::array<float,2>{0.633005202f, 0.472047895f},
-std::array<float,2>{0.547964931f, 0.965957344f},
-std::array<float,2>{0.304679722f, 0.255847275f},
-std::array<float,2>{0.114380956f, 0.608578324f},
-std::array<float,2>{0.791845322f, 0.0608603768f},
-std::array<float,2>{0.897974253f, 0.88079524f},
-std::array<float,2>{0.234218344f, 0.355012357f},
-std::array<float,2>{0.431669801f, 0.5080055f},
-std::array<float,2>{0.70243597f, 0.0815983415f},
-std::array<float,2>{0.589545727f, 0.738196671f},
-std::array<float,2>{0.341095597f, 0.174148947f},
-std::array<float,2>{0.0244539194f, 0.782457948f},
-std::array<float,2>{0.823978961f, 0.413703173f},
-std::array<float,2>{0.779632211f, 0.571059227f},
-std::array<float,2>{0.0835439339f, 0.0185262654f},
-std::array<float,2>{0.259405524f, 0.995398343f},
-std::array<float,2>{0.510571301f, 0.293906599f},
-std::array<float,2>{0.672569513f, 0.815732658f},
-std::array<float,2>{0.456439137f, 0.445116878f},
-std::array<float,2>{0.144400924f, 0.627496719f},
-std::array<float,2>{0.940835714f, 0.246293277f},
-std::array<float,2>{0.982631564f, 0.811570108f},
-std::array<float,2>{0.161980197f, 0.43509391f},
-std::array<float,2>{0.491252393f, 0.727376163f},
-std::array<float,2>{0.639568985f, 0.169458672f},
-std::array<float,2>{0.554659784f, 0.5262236f},
-std::array<float,2>{0.299924344f, 0.0731808767f},
-std::array<float,2>{0.111576259f, 0.892158687f},
-std::array<float,2>{0.795014799f, 0.360376209f},
-std::array<float,2>{0.849911988f, 0.644880116f},
-std::array<float,2>{0.0593023226f, 0.233190432f},
-std::array<float,2>{0.350598186f, 0.83000803f},
-std::array<float,2>{0.610198677f, 0.455602586f},
-std::array<float,2>{0.737247109f, 0.97534138f},
-std::array<float,2>{0.381075144f, 0.300127655f},
-std::array<float,2>{0.215112835f, 0.585571826f},
-std::array<float,2>{0.909228444f, 0.00334045943f},
-std::array<float,2>{0.774059296f, 0.910230935f},
-std::array<float,2>{0.0806603581f, 0.329911441f},
-std::array<float,2>{0.263676524f, 0.535736203f},
-std::array<float,2>{0.514190555f, 0.124175988f},
-std::array<float,2>{0.677315712f, 0.693797231f},
-std::array<float,2>{0.460146785f, 0.149121806f},
-std::array<float,2>{0.147241354f, 0.77340126f},
-std::array<float,2>{0.941758037f, 0.406094372f},
-std::array<float,2>{0.89285481f, 0.624425411f},
-std::array<float,2>{0.227884427f, 0.034349218f},
-std::array<float,2>{0.437195331f, 0.938800514f},
-std::array<float,2>{0.696890593f, 0.280438095f},
-std::array<float,2>{0.592355311f, 0.861597538f},
-std::array<float,2>{0.338148862f, 0.492455602f},
-std::array<float,2>{0.0289414953f, 0.663707733f},
-std::array<float,2>{0.826498628f, 0.213995084f},
-std::array<float,2>{0.843392015f, 0.827179074f},
-std::array<float,2>{0.00892299321f, 0.452866733f},
-std::array<float,2>{0.316057056f, 0.640338123f},
-std::array<float,2>{0.573521256f, 0.236180902f},
-std::array<float,2>{0.70318222f, 0.565731049f},
-std::array<float,2>{0.411574811f, 0.0290660206f},
-std::array<float,2>{0.235554904f, 0.987533271f},
-std::array<float,2>{0.887706816f, 0.283698857f},
-std::array<float,2>{0.956397414f, 0.743876636f},
-std::array<float,2>{0.125137508f, 0.184877798f},
-std::array<float,2>{0.439349502f, 0.794160962f},
-std::array<float,2>{0.671203136f, 0.421237439f},
-std::array<float,2>{0.523737371f, 0.889775157f},
-std::array<float,2>{0.277331412f, 0.347303659f},
-std::array<float,2>{0.0668066218f, 0.507364035f},
-std::array<float,2>{0.752701044f, 0.0893081874f},
-std::array<float,2>{0.937088549f, 0.95377624f},
-std::array<float,2>{0.194463968f, 0.26492995f},
-std::array<float,2>{0.395418555f, 0.601555407f},
-std::array<float,2>{0.730549097f, 0.0487315506f},
-std::array<float,2>{0.594069898f, 0.677120686f},
-std::array<float,2>{0.368476689f, 0.190928787f},
-std::array<float,2>{0.0428016745f, 0.84610045f},
-std::array<float,2>{0.87176156f, 0.482753813f},
-std::array<float,2>{0.805418432f, 0.55417192f},
-std::array<float,2>{0.102413438f, 0.0980522633f},
-std::array<float,2>{0.289796263f, 0.926564395f},
-std::array<float,2>{0.54030931f, 0.326980978f},
-std::array<float,2>{0.646505773f, 0.759346306f},
-std::array<float,2>{0.481716573f, 0.386680722f},
-std::array<float,2>{0.176094919f, 0.718626618f},
-std::array<float,2>{0.995715439f, 0.138697952f},
-std::array<float,2>{0.878562272f, 0.853259325f},
-std::array<float,2>{0.243656412f, 0.473599494f},
-std::array<float,2>{0.420886099f, 0.682430506f},
-std::array<float,2>{0.71516037f, 0.19712548f},
-std::array<float,2>{0.565543056f, 0.605211318f},
-std::array<float,2>{0.323309094f, 0.0570509471f},
-std::array<float,2>{0.00201778323f, 0.962245882f},
-std::array<float,2>{0.831170917f, 0.251196623f},
-std::array<float,2>{0.763027906f, 0.703937292f},
-std::array<float,2>{0.0746046007f, 0.128953278f},
-std::array<float,2>{0.266498297f, 0.750489175f},
-std::array<float,2>{0.521939218f, 0.377788186f},
-std::array<float,2>{0.661378026f, 0.932432055f},
-std::array<float,2>{0.446573228f, 0.319480509f},
-std::array<float,2>{0.136965826f, 0.558181584f},
-std::array<float,2>{0.964743674f, 0.104038179f},
-std::array<float,2>{0.860530794f, 0.996297657f},
-std::array<float,2>{0.0375765786f, 0.289122075f},
-std::array<float,2>{0.365450978f, 0.574469149f},
-std::array<float,2>{0.603127301f, 0.0228153672f},
-std::array<float,2>{0.721012712f, 0.630352437f},
-std::array<float,2>{0.399921685f, 0.245646089f},
-std::array<float,2>{0.202000543f, 0.818190575f},
-std::array<float,2>{0.925377965f, 0.440694124f},
-std::array<float,2>{0.984673679f, 0.515546083f},
-std::array<float,2>{0.180361763f, 0.0833806545f},
-std::array<float,2>{0.471797615f, 0.875574231f},
-std::array<float,2>{0.655204952f, 0.359154344f},
-std::array<float,2>{0.537320793f, 0.789017856f},
-std::array<float,2>{0.287214905f, 0.409521461f},
-std::array<float,2>{0.0980667323f, 0.740392566f},
-std::array<float,2>{0.797378182f, 0.179326639f},
-std::array<float,2>{0.781840742f, 0.774572849f},
-std::array<float,2>{0.118931122f, 0.391074389f},
-std::array<float,2>{0.307887942f, 0.697116017f},
-std::array<float,2>{0.559765041f, 0.145032093f},
-std::array<float,2>{0.631119251f, 0.540552795f},
-std::array<float,2>{0.497140467f, 0.111660659f},
-std::array<float,2>{0.169025719f, 0.918562829f},
-std::array<float,2>{0.975861609f, 0.338746548f},
-std::array<float,2>{0.918194234f, 0.665223777f},
-std::array<float,2>{0.205962509f, 0.20812732f},
-std::array<float,2>{0.386918515f, 0.868069172f},
-std::array<float,2>{0.743579388f, 0.48512423f},
-std::array<float,2>{0.621739209f, 0.95099014f},
-std::array<float,2>{0.355611563f, 0.266715735f},
-std::array<float,2>{0.0520318151f, 0.615837753f},
-std::array<float,2>{0.855846465f, 0.0441298671f},
-std::array<float,2>{0.946913719f, 0.898763478f},
-std::array<float,2>{0.154481426f, 0.36863476f},
-std::array<float,2>{0.464442104f, 0.520164907f},
-std::array<float,2>{0.685707092f, 0.0650822669f},
-std::array<float,2>{0.506717145f, 0.71994555f},
-std::array<float,2>{0.256476551f, 0.157994926f},
-std::array<float,2>{0.0899383873f, 0.801112771f},
-std::array<float,2>{0.769510329f, 0.423721164f},
-std::array<float,2>{0.814090908f, 0.593117356f},
-std::array<float,2>{0.0189233553f, 0.0111002345f},
-std::array<float,2>{0.334302664f, 0.984074056f},
-std::array<float,2>{0.584929287f, 0.310825527f},
-std::array<float,2>{0.691137254f, 0.843549013f},
-std::array<float,2>{0.425766051f, 0.463291109f},
-std::array<float,2>{0.220095262f, 0.651081979f},
-std::array<float,2>{0.901869774f, 0.220222667f},
-std::array<float,2>{0.913078487f, 0.755519331f},
-std::array<float,2>{0.212894469f, 0.38261503f},
-std::array<float,2>{0.375323862f, 0.710141361f},
-std::array<float,2>{0.739595771f, 0.125633046f},
-std::array<float,2>{0.614257216f, 0.559314549f},
-std::array<float,2>{0.346014887f, 0.108166188f},
-std::array<float,2>{0.0550471619f, 0.935803056f},
-std::array<float,2>{0.846345246f, 0.315462887f},
-std::array<float,2>{0.791474462f, 0.686326325f},
-std::array<float,2>{0.115201399f, 0.202132761f},
-std::array<float,2>{0.303932548f, 0.858531594f},
-std::array<float,2>{0.548474133f, 0.470141649f},
-std::array<float,2>{0.633639812f, 0.968536854f},
-std::array<float,2>{0.486833662f, 0.255938619f},
-std::array<float,2>{0.159620568f, 0.606712818f},
-std::array<float,2>{0.976570427f, 0.0598226674f},
-std::array<float,2>{0.823407948f, 0.881559968f},
-std::array<float,2>{0.02496491f, 0.353384137f},
-std::array<float,2>{0.341326118f, 0.511352539f},
-std::array<float,2>{0.588868737f, 0.0790410861f},
-std::array<float,2>{0.702861071f, 0.735670328f},
-std::array<float,2>{0.432144463f, 0.172720209f},
-std::array<float,2>{0.233839229f, 0.785045385f},
-std::array<float,2>{0.897559285f, 0.411856771f},
-std::array<float,2>{0.940978229f, 0.572793126f},
-std::array<float,2>{0.143871486f, 0.0167742986f},
-std::array<float,2>{0.456978917f, 0.99314934f},
-std::array<float,2>{0.67210269f, 0.295538336f},
-std::array<float,2>{0.50999254f, 0.814061403f},
-std::array<float,2>{0.258836299f, 0.441763848f},
-std::array<float,2>{0.0834001228f, 0.625480533f},
-std::array<float,2>{0.77997154f, 0.249112472f},
-std::array<float,2>{0.756759346f, 0.871257246f},
-std::array<float,2>{0.0663375258f, 0.489089131f},
-std::array<float,2>{0.280913532f, 0.668196082f},
-std::array<float,2>{0.530879259f, 0.204730272f},
-std::array<float,2>{0.665648103f, 0.611147463f},
-std::array<float,2>{0.443093121f, 0.0425771102f},
-std::array<float,2>{0.131467208f, 0.946684957f},
-std::array<float,2>{0.957942724f, 0.270760149f},
-std::array<float,2>{0.883038104f, 0.702813327f},
-std::array<float,2>{0.23852329f, 0.141860425f},
-std::array<float,2>{0.408944458f, 0.779927492f},
-std::array<float,2>{0.710671842f, 0.395339012f},
-std::array<float,2>{0.575904131f, 0.914610684f},
-std::array<float,2>{0.320027411f, 0.342739493f},
-std::array<float,2>{0.0155013269f, 0.54472506f},
-std::array<float,2>{0.837963641f, 0.113826938f},
-std::array<float,2>{0.998738706f, 0.977373123f},
-std::array<float,2>{0.173000574f, 0.308137178f},
-std::array<float,2>{0.479314566f, 0.586400747f},
-std::array<float,2>{0.643875182f, 0.0152608491f},
-std::array<float,2>{0.54678756f, 0.653661489f},
-std::array<float,2>{0.29451111f, 0.224072933f},
-std::array<float,2>{0.10644947f, 0.839830935f},
-std::array<float,2>{0.810592711f, 0.467311174f},
-std::array<float,2>{0.870170414f, 0.517110825f},
-std::array<float,2>{0.0433199853f, 0.0699607804f},
-std::array<float,2>{0.374962866f, 0.905218959f},
-std::array<float,2>{0.599048615f, 0.374525189f},
-std::array<float,2>{0.728147745f, 0.797448218f},
-std::array<float,2>{0.393444091f, 0.42919156f},
-std::array<float,2>{0.191385657f, 0.722929776f},
-std::array<float,2>{0.929761827f, 0.163978413f},
-std::array<float,2>{0.965401351f, 0.835624278f},
-std::array<float,2>{0.136127666f, 0.460163951f},
-std::array<float,2>{0.449896932f, 0.642582238f},
-std::array<float,2>{0.658993721f, 0.22930336f},
-std::array<float,2>{0.519058883f, 0.581097901f},
-std::array<float,2>{0.271678567f, 0.00649129367f},
-std::array<float,2>{0.0715654641f, 0.969285369f},
-std::array<float,2>{0.761267662f, 0.301349729f},
-std::array<float,2>{0.833518624f, 0.730520546f},
-std::array<float,2>{0.00484742597f, 0.165474832f},
-std::array<float,2>{0.326369554f, 0.805923581f},
-std::array<float,2>{0.568941295f, 0.432721674f},
-std::array<float,2>{0.714780152f, 0.898015559f},
-std::array<float,2>{0.417238832f, 0.363981605f},
-std::array<float,2>{0.249176055f, 0.528483748f},
-std::array<float,2>{0.879200876f, 0.0758810118f},
-std::array<float,2>{0.802907169f, 0.942898214f},
-std::array<float,2>{0.0959082022f, 0.275248945f},
-std::array<float,2>{0.282009691f, 0.620773315f},
-std::array<float,2>{0.532812834f, 0.0371152833f},
-std::array<float,2>{0.648441792f, 0.659918487f},
-std::array<float,2>{0.475257695f, 0.218571454f},
-std::array<float,2>{0.185726792f, 0.865572393f},
-std::array<float,2>{0.991301954f, 0.496683985f},
-std::array<float,2>{0.927488387f, 0.53360045f},
-std::array<float,2>{0.198779389f, 0.120249279f},
-std::array<float,2>{0.406166196f, 0.907612443f},
-std::array<float,2>{0.725891829f, 0.332383275f},
-std::array<float,2>{0.606011033f, 0.767222404f},
-std::array<float,2>{0.360854536f, 0.401967645f},
-std::array<float,2>{0.0343049467f, 0.688734233f},
-std::array<float,2>{0.866609693f, 0.154222205f},
-std::array<float,2>{0.851900637f, 0.789611757f},
-std::array<float,2>{0.0494639575f, 0.416698933f},
-std::array<float,2>{0.353855461f, 0.746589482f},
-std::array<float,2>{0.620604277f, 0.18150413f},
-std::array<float,2>{0.74733609f, 0.503588736f},
-std::array<float,2>{0.383970261f, 0.0935115516f},
-std::array<float,2>{0.207422569f, 0.884045064f},
-std::array<float,2>{0.915638506f, 0.350465178f},
-std::array<float,2>{0.970220923f, 0.634597063f},
-std::array<float,2>{0.167370319f, 0.240341887f},
-std::array<float,2>{0.492623806f, 0.822295189f},
-std::array<float,2>{0.627003014f, 0.448398679f},
-std::array<float,2>{0.555139959f, 0.991298735f},
-std::array<float,2>{0.312398553f, 0.286794931f},
-std::array<float,2>{0.121371046f, 0.567865372f},
-std::array<float,2>{0.788267553f, 0.0259071402f},
-std::array<float,2>{0.905192852f, 0.924173176f},
-std::array<float,2>{0.224645883f, 0.323574156f},
-std::array<float,2>{0.428807229f, 0.550422013f},
-std::array<float,2>{0.693216741f, 0.0974036381f},
-std::array<float,2>{0.57955116f, 0.713406146f},
-std::array<float,2>{0.331263781f, 0.133499652f},
-std::array<float,2>{0.0205824822f, 0.762406945f},
-std::array<float,2>{0.81856066f, 0.387709349f},
-std::array<float,2>{0.773393631f, 0.594719648f},
-std::array<float,2>{0.0883033723f, 0.0537657999f},
-std::array<float,2>{0.252489895f, 0.958409429f},
-std::array<float,2>{0.502223372f, 0.261185855f},
-std::array<float,2>{0.681047857f, 0.850671709f},
-std::array<float,2>{0.467745036f, 0.477119774f},
-std::array<float,2>{0.14852941f, 0.674552143f},
-std::array<float,2>{0.952382624f, 0.194010317f},
-std::array<float,2>{0.945102513f, 0.770879328f},
-std::array<float,2>{0.144935757f, 0.403103888f},
-std::array<float,2>{0.458951473f, 0.692446172f},
-std::array<float,2>{0.678149104f, 0.151651561f},
-std::array<float,2>{0.512141049f, 0.537604213f},
-std::array<float,2>{0.262127101f, 0.122038372f},
-std::array<float,2>{0.0798830539f, 0.913088143f},
-std::array<float,2>{0.775850534f, 0.330210596f},
-std::array<float,2>{0.824939787f, 0.661497831f},
-std::array<float,2>{0.0295640435f, 0.211663261f},
-std::array<float,2>{0.337037444f, 0.86065352f},
-std::array<float,2>{0.591743588f, 0.495870918f},
-std::array<float,2>{0.698204458f, 0.940255523f},
-std::array<float,2>{0.43389526f, 0.278224647f},
-std::array<float,2>{0.228932872f, 0.622320116f},
-std::array<float,2>{0.891899347f, 0.0330829583f},
-std::array<float,2>{0.793559253f, 0.89311868f},
-std::array<float,2>{0.111223429f, 0.361474276f},
-std::array<float,2>{0.298597872f, 0.52513814f},
-std::array<float,2>{0.551539779f, 0.0721626878f},
-std::array<float,2>{0.637473226f, 0.730103612f},
-std::array<float,2>{0.488719195f, 0.171421751f},
-std::array<float,2>{0.16361481f, 0.808874488f},
-std::array<float,2>{0.981916428f, 0.435679436f},
-std::array<float,2>{0.907535672f, 0.583294213f},
-std::array<float,2>{0.218529582f, 0.00138886855f},
-std::array<float,2>{0.379556298f, 0.973259687f},
-std::array<float,2>{0.735286653f, 0.297921807f},
-std::array<float,2>{0.612432837f, 0.830426693f},
-std::array<float,2>{0.347671896f, 0.454816759f},
-std::array<float,2>{0.0613472201f, 0.647793114f},
-std::array<float,2>{0.848687232f, 0.230873182f},
-std::array<float,2>{0.87327522f, 0.844343543f},
-std::array<float,2>{0.0397519097f, 0.481342196f},
-std::array<float,2>{0.370850295f, 0.678486407f},
-std::array<float,2>{0.597461343f, 0.189157754f},
-std::array<float,2>{0.734038234f, 0.598201394f},
-std::array<float,2>{0.397303283f, 0.0489798933f},
-std::array<float,2>{0.192821518f, 0.955479085f},
-std::array<float,2>{0.934254885f, 0.26248613f},
-std::array<float,2>{0.992616653f, 0.715111196f},
-std::array<float,2>{0.179334f, 0.137965411f},
-std::array<float,2>{0.482551247f, 0.761529922f},
-std::array<float,2>{0.645477831f, 0.384007752f},
-std::array<float,2>{0.541584671f, 0.928004682f},
-std::array<float,2>{0.291106343f, 0.326149076f},
-std::array<float,2>{0.103946202f, 0.552472234f},
-std::array<float,2>{0.80726707f, 0.101097301f},
-std::array<float,2>{0.889892519f, 0.984630704f},
-std::array<float,2>{0.23720105f, 0.281600326f},
-std::array<float,2>{0.41271624f, 0.563892126f},
-std::array<float,2>{0.706257522f, 0.0311114732f},
-std::array<float,2>{0.571794033f, 0.637231231f},
-std::array<float,2>{0.314035267f, 0.238002822f},
-std::array<float,2>{0.0115406783f, 0.824329972f},
-std::array<float,2>{0.840402067f, 0.450633854f},
-std::array<float,2>{0.751748919f, 0.503907084f},
-std::array<float,2>{0.0693771988f, 0.0876017734f},
-std::array<float,2>{0.275384754f, 0.887070894f},
-std::array<float,2>{0.526241302f, 0.345198929f},
-std::array<float,2>{0.668886423f, 0.796474576f},
-std::array<float,2>{0.43956545f, 0.418385655f},
-std::array<float,2>{0.128518596f, 0.744171262f},
-std::array<float,2>{0.954112887f, 0.187087417f},
-std::array<float,2>{0.922253966f, 0.819947362f},
-std::array<float,2>{0.200853646f, 0.437741041f},
-std::array<float,2>{0.400664985f, 0.630876243f},
-std::array<float,2>{0.719209909f, 0.244018868f},
-std::array<float,2>{0.604886532f, 0.576405168f},
-std::array<float,2>{0.363957405f, 0.021345485f},
-std::array<float,2>{0.0369824879f, 0.998618007f},
-std::array<float,2>{0.862093627f, 0.291981161f},
-std::array<float,2>{0.799494028f, 0.739521086f},
-std::array<float,2>{0.0996663794f, 0.176584095f},
-std::array<float,2>{0.286250442f, 0.786163568f},
-std::array<float,2>{0.535980582f, 0.407965183f},
-std::array<float,2>{0.652925134f, 0.878320277f},
-std::array<float,2>{0.468914568f, 0.355555981f},
-std::array<float,2>{0.182278395f, 0.512008429f},
-std::array<float,2>{0.98696512f, 0.084914811f},
-std::array<float,2>{0.828920364f, 0.962894857f},
-std::array<float,2>{0.000481683353f, 0.253885061f},
-std::array<float,2>{0.320690006f, 0.60191983f},
-std::array<float,2>{0.562761486f, 0.0558635481f},
-std::array<float,2>{0.717943788f, 0.680850446f},
-std::array<float,2>{0.418408513f, 0.198650792f},
-std::array<float,2>{0.245719731f, 0.853818476f},
-std::array<float,2>{0.875661254f, 0.475519955f},
-std::array<float,2>{0.961821675f, 0.556252062f},
-std::array<float,2>{0.13956441f, 0.103250571f},
-std::array<float,2>{0.448885322f, 0.930923402f},
-std::array<float,2>{0.66293931f, 0.316852421f},
-std::array<float,2>{0.52003181f, 0.753599465f},
-std::array<float,2>{0.268475115f, 0.375845373f},
-std::array<float,2>{0.0774047747f, 0.706624627f},
-std::array<float,2>{0.764060497f, 0.131226331f},
-std::array<float,2>{0.767309606f, 0.80297178f},
-std::array<float,2>{0.0926521346f, 0.42488414f},
-std::array<float,2>{0.254304081f, 0.721279979f},
-std::array<float,2>{0.505765438f, 0.158762544f},
-std::array<float,2>{0.684122026f, 0.522223055f},
-std::array<float,2>{0.461434543f, 0.0630285814f},
-std::array<float,2>{0.153043628f, 0.901509643f},
-std::array<float,2>{0.948512018f, 0.369179308f},
-std::array<float,2>{0.899188519f, 0.648978055f},
-std::array<float,2>{0.221339539f, 0.22118333f},
-std::array<float,2>{0.422531068f, 0.841578424f},
-std::array<float,2>{0.688585758f, 0.461568564f},
-std::array<float,2>{0.58320725f, 0.982199073f},
-std::array<float,2>{0.333484203f, 0.30981341f},
-std::array<float,2>{0.0166766811f, 0.591569662f},
-std::array<float,2>{0.815960467f, 0.00782813877f},
-std::array<float,2>{0.972752094f, 0.920976102f},
-std::array<float,2>{0.170377538f, 0.336275131f},
-std::array<float,2>{0.498341173f, 0.542114973f},
-std::array<float,2>{0.630643785f, 0.110786669f},
-std::array<float,2>{0.561657369f, 0.698173702f},
-std::array<float,2>{0.305226922f, 0.147668689f},
-std::array<float,2>{0.119259104f, 0.776534915f},
-std::array<float,2>{0.784313977f, 0.392755389f},
-std::array<float,2>{0.85757941f, 0.614826918f},
-std::array<float,2>{0.0541336536f, 0.0453200862f},
-std::array<float,2>{0.358429939f, 0.951893568f},
-std::array<float,2>{0.62467283f, 0.268375635f},
-std::array<float,2>{0.745473623f, 0.871071458f},
-std::array<float,2>{0.389658809f, 0.486871064f},
-std::array<float,2>{0.204477981f, 0.667200685f},
-std::array<float,2>{0.920345783f, 0.210738465f},
-std::array<float,2>{0.894856334f, 0.783081889f},
-std::array<float,2>{0.230695784f, 0.413433164f},
-std::array<float,2>{0.431601465f, 0.737767398f},
-std::array<float,2>{0.70042938f, 0.174731195f},
-std::array<float,2>{0.587861538f, 0.508779347f},
-std::array<float,2>{0.343615264f, 0.0811811537f},
-std::array<float,2>{0.0272015687f, 0.880304754f},
-std::array<float,2>{0.821337402f, 0.35485515f},
-std::array<float,2>{0.777559698f, 0.627068937f},
-std::array<float,2>{0.0849679112f, 0.246877134f},
-std::array<float,2>{0.260573298f, 0.815964699f},
-std::array<float,2>{0.509447217f, 0.444776684f},
-std::array<float,2>{0.675604463f, 0.996013701f},
-std::array<float,2>{0.454674512f, 0.293433219f},
-std::array<float,2>{0.142500907f, 0.570689976f},
-std::array<float,2>{0.938512504f, 0.0180490799f},
-std::array<float,2>{0.844305158f, 0.934601486f},
-std::array<float,2>{0.0579761602f, 0.313172519f},
-std::array<float,2>{0.344101608f, 0.561128378f},
-std::array<float,2>{0.616108835f, 0.105933778f},
-std::array<float,2>{0.741672516f, 0.707512677f},
-std::array<float,2>{0.378570616f, 0.128801122f},
-std::array<float,2>{0.212058663f, 0.757082462f},
-std::array<float,2>{0.910743713f, 0.379405916f},
-std::array<float,2>{0.979309618f, 0.609070182f},
-std::array<float,2>{0.156628594f, 0.0611266233f},
-std::array<float,2>{0.486183852f, 0.966607273f},
-std::array<float,2>{0.636033595f, 0.255331546f},
-std::array<float,2>{0.549649239f, 0.855487823f},
-std::array<float,2>{0.302219301f, 0.472394228f},
-std::array<float,2>{0.116799563f, 0.683806121f},
-std::array<float,2>{0.790790498f, 0.200606376f},
-std::array<float,2>{0.809601605f, 0.837553859f},
-std::array<float,2>{0.10842862f, 0.46500048f},
-std::array<float,2>{0.295755446f, 0.655806363f},
-std::array<float,2>{0.543330252f, 0.226050258f},
-std::array<float,2>{0.641450882f, 0.588731468f},
-std::array<float,2>{0.477570385f, 0.0132433763f},
-std::array<float,2>{0.175531805f, 0.978611112f},
-std::array<float,2>{0.998042285f, 0.305817366f},
-std::array<float,2>{0.93240571f, 0.724610031f},
-std::array<float,2>{0.188115284f, 0.161381274f},
-std::array<float,2>{0.392062277f, 0.799070716f},
-std::array<float,2>{0.730065107f, 0.427417487f},
-std::array<float,2>{0.600934446f, 0.904157341f},
-std::array<float,2>{0.372290552f, 0.372618854f},
-std::array<float,2>{0.0464583039f, 0.51922518f},
-std::array<float,2>{0.868790388f, 0.0672406852f},
-std::array<float,2>{0.959607065f, 0.947534502f},
-std::array<float,2>{0.129186571f, 0.272911131f},
-std::array<float,2>{0.443920493f, 0.613046944f},
-std::array<float,2>{0.667639315f, 0.0410065129f},
-std::array<float,2>{0.528170884f, 0.671061039f},
-std::array<float,2>{0.278005809f, 0.206440166f},
-std::array<float,2>{0.064004682f, 0.87449801f},
-std::array<float,2>{0.755643547f, 0.491550565f},
-std::array<float,2>{0.83601445f, 0.545892298f},
-std::array<float,2>{0.0129867997f, 0.115698144f},
-std::array<float,2>{0.317720234f, 0.917692482f},
-std::array<float,2>{0.577169716f, 0.340585768f},
-std::array<float,2>{0.708148479f, 0.779240906f},
-std::array<float,2>{0.406881362f, 0.39659369f},
-std::array<float,2>{0.240623817f, 0.699643254f},
-std::array<float,2>{0.884934545f, 0.143878594f},
-std::array<float,2>{0.988862693f, 0.863803029f},
-std::array<float,2>{0.183965757f, 0.499089301f},
-std::array<float,2>{0.473862857f, 0.657308817f},
-std::array<float,2>{0.651609421f, 0.215405852f},
-std::array<float,2>{0.53434813f, 0.617189944f},
-std::array<float,2>{0.284965128f, 0.0369831175f},
-std::array<float,2>{0.0943002403f, 0.944643378f},
-std::array<float,2>{0.802643597f, 0.27669844f},
-std::array<float,2>{0.864847124f, 0.690455198f},
-std::array<float,2>{0.0327879339f, 0.155737624f},
-std::array<float,2>{0.361605912f, 0.767603636f},
-std::array<float,2>{0.608242512f, 0.399363399f},
-std::array<float,2>{0.722734809f, 0.908651412f},
-std::array<float,2>{0.402642369f, 0.334852397f},
-std::array<float,2>{0.196576029f, 0.533164918f},
-std::array<float,2>{0.929604053f, 0.117251948f},
-std::array<float,2>{0.758126557f, 0.972597003f},
-std::array<float,2>{0.0738750473f, 0.303578496f},
-std::array<float,2>{0.269927084f, 0.579196095f},
-std::array<float,2>{0.516838491f, 0.00469225738f},
-std::array<float,2>{0.656456709f, 0.640985012f},
-std::array<float,2>{0.451768816f, 0.228330389f},
-std::array<float,2>{0.134204715f, 0.83280772f},
-std::array<float,2>{0.968340456f, 0.458806276f},
-std::array<float,2>{0.881828189f, 0.529758692f},
-std::array<float,2>{0.247789681f, 0.0778292865f},
-std::array<float,2>{0.415899605f, 0.896068394f},
-std::array<float,2>{0.711159945f, 0.366167456f},
-std::array<float,2>{0.567704737f, 0.807806075f},
-std::array<float,2>{0.324764669f, 0.431316584f},
-std::array<float,2>{0.00763312122f, 0.733663619f},
-std::array<float,2>{0.834279358f, 0.166191503f},
-std::array<float,2>{0.816807389f, 0.764656365f},
-std::array<float,2>{0.022019431f, 0.389094114f},
-std::array<float,2>{0.328139424f, 0.712545753f},
-std::array<float,2>{0.581784904f, 0.136632457f},
-std::array<float,2>{0.694503486f, 0.548359096f},
-std::array<float,2>{0.427652329f, 0.0948792249f},
-std::array<float,2>{0.22383146f, 0.922223449f},
-std::array<float,2>{0.903141022f, 0.322179407f},
-std::array<float,2>{0.949219823f, 0.67265588f},
-std::array<float,2>{0.150431618f, 0.191436857f},
-std::array<float,2>{0.465161949f, 0.847660244f},
-std::array<float,2>{0.682030439f, 0.479314446f},
-std::array<float,2>{0.500074029f, 0.960599422f},
-std::array<float,2>{0.251772583f, 0.259365171f},
-std::array<float,2>{0.0869891047f, 0.597344756f},
-std::array<float,2>{0.770968556f, 0.052491352f},
-std::array<float,2>{0.916308701f, 0.886000752f},
-std::array<float,2>{0.209038794f, 0.348636061f},
-std::array<float,2>{0.386511445f, 0.50014466f},
-std::array<float,2>{0.748959601f, 0.0907543153f},
-std::array<float,2>{0.618765771f, 0.749781787f},
-std::array<float,2>{0.352081716f, 0.182471275f},
-std::array<float,2>{0.0483615585f, 0.792291284f},
-std::array<float,2>{0.855344474f, 0.415585905f},
-std::array<float,2>{0.786417961f, 0.570233464f},
-std::array<float,2>{0.123331606f, 0.0240668897f},
-std::array<float,2>{0.309463441f, 0.989549994f},
-std::array<float,2>{0.557541668f, 0.287491351f},
-std::array<float,2>{0.625639081f, 0.820599258f},
-std::array<float,2>{0.494199961f, 0.446989864f},
-std::array<float,2>{0.164700896f, 0.635789156f},
-std::array<float,2>{0.971627653f, 0.240099996f},
-std::array<float,2>{0.953300774f, 0.793740213f},
-std::array<float,2>{0.127549335f, 0.420594692f},
-std::array<float,2>{0.440989792f, 0.74260366f},
-std::array<float,2>{0.668957114f, 0.183690578f},
-std::array<float,2>{0.526736856f, 0.506097078f},
-std::array<float,2>{0.27382347f, 0.0879303142f},
-std::array<float,2>{0.0684252456f, 0.889132679f},
-std::array<float,2>{0.750916302f, 0.346090615f},
-std::array<float,2>{0.84170413f, 0.639334381f},
-std::array<float,2>{0.00985114649f, 0.234610915f},
-std::array<float,2>{0.312630832f, 0.826461375f},
-std::array<float,2>{0.570582092f, 0.451333195f},
-std::array<float,2>{0.705814421f, 0.987090766f},
-std::array<float,2>{0.413910866f, 0.28500405f},
-std::array<float,2>{0.238005787f, 0.56476438f},
-std::array<float,2>{0.889452398f, 0.0273580234f},
-std::array<float,2>{0.80773294f, 0.927454591f},
-std::array<float,2>{0.104509756f, 0.327946424f},
-std::array<float,2>{0.29243356f, 0.553336859f},
-std::array<float,2>{0.542044699f, 0.0989270583f},
-std::array<float,2>{0.646438897f, 0.716956913f},
-std::array<float,2>{0.484313637f, 0.139663801f},
-std::array<float,2>{0.177953675f, 0.758465827f},
-std::array<float,2>{0.993916214f, 0.385468245f},
-std::array<float,2>{0.934972227f, 0.599722505f},
-std::array<float,2>{0.192251951f, 0.0473890603f},
-std::array<float,2>{0.397521585f, 0.955001354f},
-std::array<float,2>{0.732739151f, 0.264060557f},
-std::array<float,2>{0.595817447f, 0.847548127f},
-std::array<float,2>{0.369215101f, 0.484195054f},
-std::array<float,2>{0.0403983034f, 0.675974131f},
-std::array<float,2>{0.874708891f, 0.189815208f},
-std::array<float,2>{0.848236263f, 0.828623891f},
-std::array<float,2>{0.0618452765f, 0.456425667f},
-std::array<float,2>{0.348749548f, 0.646175385f},
-std::array<float,2>{0.612279713f, 0.233419508f},
-std::array<float,2>{0.735702991f, 0.584953308f},
-std::array<float,2>{0.380842626f, 0.00277475687f},
-std::array<float,2>{0.217644393f, 0.975617826f},
-std::array<float,2>{0.907141089f, 0.299753219f},
-std::array<float,2>{0.980781853f, 0.727891684f},
-std::array<float,2>{0.162135899f, 0.168016031f},
-std::array<float,2>{0.489929944f, 0.811201394f},
-std::array<float,2>{0.638154805f, 0.433933705f},
-std::array<float,2>{0.552045763f, 0.890954733f},
-std::array<float,2>{0.297171026f, 0.359798074f},
-std::array<float,2>{0.10972596f, 0.526382148f},
-std::array<float,2>{0.794696748f, 0.0736620948f},
-std::array<float,2>{0.891105831f, 0.938154578f},
-std::array<float,2>{0.229745835f, 0.280175745f},
-std::array<float,2>{0.434951156f, 0.623090625f},
-std::array<float,2>{0.699088156f, 0.0341200717f},
-std::array<float,2>{0.590664685f, 0.662314177f},
-std::array<float,2>{0.336518586f, 0.21357134f},
-std::array<float,2>{0.0303449202f, 0.863049388f},
-std::array<float,2>{0.825569928f, 0.493292987f},
-std::array<float,2>{0.776795566f, 0.536885679f},
-std::array<float,2>{0.0790989995f, 0.123580121f},
-std::array<float,2>{0.262779921f, 0.911490679f},
-std::array<float,2>{0.512932003f, 0.328836858f},
-std::array<float,2>{0.679256856f, 0.771752715f},
-std::array<float,2>{0.457043588f, 0.404921412f},
-std::array<float,2>{0.146111742f, 0.694751799f},
-std::array<float,2>{0.943994224f, 0.149801791f},
-std::array<float,2>{0.921036065f, 0.868579984f},
-std::array<float,2>{0.203943655f, 0.486139923f},
-std::array<float,2>{0.388856441f, 0.66440326f},
-std::array<float,2>{0.744401753f, 0.207859084f},
-std::array<float,2>{0.623870969f, 0.616369247f},
-std::array<float,2>{0.357866973f, 0.0437822156f},
-std::array<float,2>{0.0533105321f, 0.949382067f},
-std::array<float,2>{0.859228551f, 0.266150445f},
-std::array<float,2>{0.783815444f, 0.695474327f},
-std::array<float,2>{0.120677821f, 0.145940289f},
-std::array<float,2>{0.306581676f, 0.773599625f},
-std::array<float,2>{0.56067431f, 0.392095566f},
-std::array<float,2>{0.62966913f, 0.91944468f},
-std::array<float,2>{0.499133319f, 0.338899136f},
-std::array<float,2>{0.171597466f, 0.539177656f},
-std::array<float,2>{0.97371304f, 0.112868443f},
-std::array<float,2>{0.814908504f, 0.982932329f},
-std::array<float,2>{0.0161259379f, 0.312109262f},
-std::array<float,2>{0.332538962f, 0.592238367f},
-std::array<float,2>{0.582189977f, 0.0105341319f},
-std::array<float,2>{0.687506914f, 0.652100921f},
-std::array<float,2>{0.423201442f, 0.219509706f},
-std::array<float,2>{0.222202003f, 0.842481494f},
-std::array<float,2>{0.899543583f, 0.464278251f},
-std::array<float,2>{0.947459042f, 0.520871162f},
-std::array<float,2>{0.154014841f, 0.0660734624f},
-std::array<float,2>{0.462836653f, 0.899521172f},
-std::array<float,2>{0.684798658f, 0.368050545f},
-std::array<float,2>{0.504836798f, 0.802085698f},
-std::array<float,2>{0.255060583f, 0.421975583f},
-std::array<float,2>{0.0933298394f, 0.719041348f},
-std::array<float,2>{0.765784621f, 0.157151788f},
-std::array<float,2>{0.764965117f, 0.751599491f},
-std::array<float,2>{0.0766013861f, 0.378336847f},
-std::array<float,2>{0.268950969f, 0.704447508f},
-std::array<float,2>{0.521395326f, 0.130304113f},
-std::array<float,2>{0.663957834f, 0.557117581f},
-std::array<float,2>{0.448220164f, 0.105152883f},
-std::array<float,2>{0.140260965f, 0.933517277f},
-std::array<float,2>{0.962276161f, 0.318579733f},
-std::array<float,2>{0.876845837f, 0.68347764f},
-std::array<float,2>{0.244560987f, 0.195611089f},
-std::array<float,2>{0.419565588f, 0.852512598f},
-std::array<float,2>{0.717108428f, 0.473732919f},
-std::array<float,2>{0.563776255f, 0.961596429f},
-std::array<float,2>{0.321762145f, 0.250117898f},
-std::array<float,2>{0.0016217127f, 0.604127824f},
-std::array<float,2>{0.829113007f, 0.0581542403f},
-std::array<float,2>{0.987900972f, 0.876516342f},
-std::array<float,2>{0.183078617f, 0.357526481f},
-std::array<float,2>{0.470411628f, 0.514098585f},
-std::array<float,2>{0.654133439f, 0.0827284753f},
-std::array<float,2>{0.53694135f, 0.741532862f},
-std::array<float,2>{0.285947591f, 0.178451523f},
-std::array<float,2>{0.101526737f, 0.78741008f},
-std::array<float,2>{0.800707817f, 0.409013599f},
-std::array<float,2>{0.862427711f, 0.57583046f},
-std::array<float,2>{0.0356304012f, 0.0216021091f},
-std::array<float,2>{0.364567727f, 0.997728825f},
-std::array<float,2>{0.603982687f, 0.290639907f},
-std::array<float,2>{0.72022444f, 0.817113459f},
-std::array<float,2>{0.402117223f, 0.440332949f},
-std::array<float,2>{0.199619681f, 0.629802406f},
-std::array<float,2>{0.923707008f, 0.244212553f},
-std::array<float,2>{0.885795116f, 0.781011641f},
-std::array<float,2>{0.241667688f, 0.395722687f},
-std::array<float,2>{0.407763362f, 0.701365173f},
-std::array<float,2>{0.7079826f, 0.14140816f},
-std::array<float,2>{0.57654959f, 0.543675125f},
-std::array<float,2>{0.316915452f, 0.115229838f},
-std::array<float,2>{0.0124107925f, 0.915903628f},
-std::array<float,2>{0.837756753f, 0.34282729f},
-std::array<float,2>{0.754274726f, 0.669326186f},
-std::array<float,2>{0.0632150993f, 0.20329836f},
-std::array<float,2>{0.279006094f, 0.872381151f},
-std::array<float,2>{0.528362632f, 0.48955217f},
-std::array<float,2>{0.66643405f, 0.945624769f},
-std::array<float,2>{0.4452326f, 0.270335376f},
-std::array<float,2>{0.129936323f, 0.609486997f},
-std::array<float,2>{0.960671544f, 0.0419766344f},
-std::array<float,2>{0.86771661f, 0.905687928f},
-std::array<float,2>{0.0457961299f, 0.373312145f},
-std::array<float,2>{0.371891499f, 0.515669644f},
-std::array<float,2>{0.600025058f, 0.0684375763f},
-std::array<float,2>{0.72867626f, 0.723665416f},
-std::array<float,2>{0.391389996f, 0.162958652f},
-std::array<float,2>{0.189063177f, 0.798579037f},
-std::array<float,2>{0.932727277f, 0.428147823f},
-std::array<float,2>{0.996173561f, 0.587609947f},
-std::array<float,2>{0.174671143f, 0.0143116014f},
-std::array<float,2>{0.477232903f, 0.978405774f},
-std::array<float,2>{0.642084241f, 0.307030797f},
-std::array<float,2>{0.544705927f, 0.838582993f},
-std::array<float,2>{0.296541244f, 0.468197495f},
-std::array<float,2>{0.107684582f, 0.652645707f},
-std::array<float,2>{0.809381425f, 0.223369032f},
-std::array<float,2>{0.78922987f, 0.857752502f},
-std::array<float,2>{0.116014861f, 0.468842328f},
-std::array<float,2>{0.301740915f, 0.686875939f},
-std::array<float,2>{0.550644279f, 0.202950612f},
-std::array<float,2>{0.635518014f, 0.605996192f},
-std::array<float,2>{0.484407067f, 0.0587314889f},
-std::array<float,2>{0.158154115f, 0.966898143f},
-std::array<float,2>{0.980364919f, 0.257694244f},
-std::array<float,2>{0.911329687f, 0.709756374f},
-std::array<float,2>{0.211130753f, 0.126213223f},
-std::array<float,2>{0.37737447f, 0.754056215f},
-std::array<float,2>{0.740585506f, 0.381603718f},
-std::array<float,2>{0.616398036f, 0.936629772f},
-std::array<float,2>{0.344767451f, 0.314841062f},
-std::array<float,2>{0.0573107824f, 0.559994638f},
-std::array<float,2>{0.845194697f, 0.109271057f},
-std::array<float,2>{0.938385129f, 0.993357182f},
-std::array<float,2>{0.141523272f, 0.296089381f},
-std::array<float,2>{0.453743309f, 0.573353589f},
-std::array<float,2>{0.674194336f, 0.0163779203f},
-std::array<float,2>{0.508014023f, 0.626786768f},
-std::array<float,2>{0.261580855f, 0.248471186f},
-std::array<float,2>{0.0846211463f, 0.812792659f},
-std::array<float,2>{0.779290497f, 0.443169534f},
-std::array<float,2>{0.820630312f, 0.510117948f},
-std::array<float,2>{0.0261897352f, 0.0794101506f},
-std::array<float,2>{0.34232375f, 0.882231712f},
-std::array<float,2>{0.58650893f, 0.352373064f},
-std::array<float,2>{0.699740112f, 0.784065545f},
-std::array<float,2>{0.429965496f, 0.410977513f},
-std::array<float,2>{0.231739312f, 0.735116184f},
-std::array<float,2>{0.896035671f, 0.173645109f},
-std::array<float,2>{0.972654462f, 0.82417959f},
-std::array<float,2>{0.165587142f, 0.447583497f},
-std::array<float,2>{0.495695621f, 0.633053362f},
-std::array<float,2>{0.626709282f, 0.241956681f},
-std::array<float,2>{0.557913721f, 0.567100704f},
-std::array<float,2>{0.309988558f, 0.0263994765f},
-std::array<float,2>{0.124954902f, 0.990915239f},
-std::array<float,2>{0.786111176f, 0.285208791f},
-std::array<float,2>{0.853669763f, 0.747208178f},
-std::array<float,2>{0.0469546318f, 0.180550516f},
-std::array<float,2>{0.352610439f, 0.790714562f},
-std::array<float,2>{0.618038535f, 0.417045981f},
-std::array<float,2>{0.749964714f, 0.883724391f},
-std::array<float,2>{0.385397762f, 0.351019263f},
-std::array<float,2>{0.210342526f, 0.502579927f},
-std::array<float,2>{0.917091489f, 0.0923951641f},
-std::array<float,2>{0.770257413f, 0.957482219f},
-std::array<float,2>{0.0868622139f, 0.260141969f},
-std::array<float,2>{0.250048429f, 0.594953001f},
-std::array<float,2>{0.501388192f, 0.0533820465f},
-std::array<float,2>{0.682620764f, 0.675536394f},
-std::array<float,2>{0.466225117f, 0.19499661f},
-std::array<float,2>{0.151699394f, 0.850152194f},
-std::array<float,2>{0.950672567f, 0.478028685f},
-std::array<float,2>{0.903666973f, 0.549011648f},
-std::array<float,2>{0.222868219f, 0.0959174857f},
-std::array<float,2>{0.426317185f, 0.92548275f},
-std::array<float,2>{0.693740427f, 0.322821409f},
-std::array<float,2>{0.580672979f, 0.763250232f},
-std::array<float,2>{0.329239279f, 0.38707909f},
-std::array<float,2>{0.0230092499f, 0.714437604f},
-std::array<float,2>{0.817598999f, 0.134529725f},
-std::array<float,2>{0.835306644f, 0.804816186f},
-std::array<float,2>{0.0063195955f, 0.431832463f},
-std::array<float,2>{0.32558167f, 0.732283056f},
-std::array<float,2>{0.567231715f, 0.164342642f},
-std::array<float,2>{0.712821066f, 0.527838826f},
-std::array<float,2>{0.41486463f, 0.0742935613f},
-std::array<float,2>{0.247027904f, 0.897223413f},
-std::array<float,2>{0.881869435f, 0.364398062f},
-std::array<float,2>{0.967125177f, 0.644287944f},
-std::array<float,2>{0.133593053f, 0.229836449f},
-std::array<float,2>{0.452828944f, 0.83402431f},
-std::array<float,2>{0.658072472f, 0.459756911f},
-std::array<float,2>{0.516403198f, 0.970354557f},
-std::array<float,2>{0.271042526f, 0.302540869f},
-std::array<float,2>{0.0723069981f, 0.580475509f},
-std::array<float,2>{0.759056389f, 0.00684821419f},
-std::array<float,2>{0.928673208f, 0.906288266f},
-std::array<float,2>{0.195523188f, 0.333795279f},
-std::array<float,2>{0.403480351f, 0.534505308f},
-std::array<float,2>{0.723757625f, 0.12004967f},
-std::array<float,2>{0.609110296f, 0.687929809f},
-std::array<float,2>{0.362738997f, 0.153292f},
-std::array<float,2>{0.0318273343f, 0.765790582f},
-std::array<float,2>{0.863341451f, 0.401225507f},
-std::array<float,2>{0.801564336f, 0.619885564f},
-std::array<float,2>{0.095650591f, 0.038867332f},
-std::array<float,2>{0.283595949f, 0.942139924f},
-std::array<float,2>{0.533807099f, 0.273481965f},
-std::array<float,2>{0.65096426f, 0.867102206f},
-std::array<float,2>{0.473207086f, 0.497134715f},
-std::array<float,2>{0.185491666f, 0.658943117f},
-std::array<float,2>{0.989579737f, 0.216962233f},
-std::array<float,2>{0.994665265f, 0.760282338f},
-std::array<float,2>{0.177396685f, 0.383228272f},
-std::array<float,2>{0.481062353f, 0.715920627f},
-std::array<float,2>{0.647665322f, 0.137276426f},
-std::array<float,2>{0.539328694f, 0.551717997f},
-std::array<float,2>{0.290898532f, 0.100343868f},
-std::array<float,2>{0.103113316f, 0.929357469f},
-std::array<float,2>{0.805926681f, 0.325124323f},
-std::array<float,2>{0.872126341f, 0.678897381f},
-std::array<float,2>{0.0419907682f, 0.188123241f},
-std::array<float,2>{0.367606997f, 0.845372915f},
-std::array<float,2>{0.595545948f, 0.482118309f},
-std::array<float,2>{0.731571496f, 0.956780136f},
-std::array<float,2>{0.396134704f, 0.263598889f},
-std::array<float,2>{0.193586245f, 0.598945081f},
-std::array<float,2>{0.935795963f, 0.0498742945f},
-std::array<float,2>{0.75316745f, 0.888266981f},
-std::array<float,2>{0.0682724416f, 0.344489992f},
-std::array<float,2>{0.275813043f, 0.505849242f},
-std::array<float,2>{0.524974048f, 0.0862548277f},
-std::array<float,2>{0.670037985f, 0.745393753f},
-std::array<float,2>{0.437888473f, 0.186084971f},
-std::array<float,2>{0.126537666f, 0.795532167f},
-std::array<float,2>{0.955218375f, 0.41956982f},
-std::array<float,2>{0.886972606f, 0.562784493f},
-std::array<float,2>{0.234737277f, 0.0301827416f},
-std::array<float,2>{0.410528868f, 0.98609972f},
-std::array<float,2>{0.704758048f, 0.283200413f},
-std::array<float,2>{0.572317481f, 0.825852394f},
-std::array<float,2>{0.314833254f, 0.449865282f},
-std::array<float,2>{0.00841088686f, 0.638440788f},
-std::array<float,2>{0.842260122f, 0.237228632f},
-std::array<float,2>{0.827988327f, 0.859448493f},
-std::array<float,2>{0.0275606476f, 0.494592488f},
-std::array<float,2>{0.338991731f, 0.660292745f},
-std::array<float,2>{0.592819929f, 0.212362543f},
-std::array<float,2>{0.695515275f, 0.622058272f},
-std::array<float,2>{0.435620934f, 0.0312893577f},
-std::array<float,2>{0.227069378f, 0.941161036f},
-std::array<float,2>{0.894128621f, 0.278885782f},
-std::array<float,2>{0.94241792f, 0.69172734f},
-std::array<float,2>{0.148038641f, 0.15053001f},
-std::array<float,2>{0.459701836f, 0.769607604f},
-std::array<float,2>{0.675793469f, 0.403832048f},
-std::array<float,2>{0.515546501f, 0.912693441f},
-std::array<float,2>{0.265545517f, 0.331621319f},
-std::array<float,2>{0.0816291943f, 0.538991153f},
-std::array<float,2>{0.775144935f, 0.122329801f},
-std::array<float,2>{0.908488035f, 0.974144638f},
-std::array<float,2>{0.216738388f, 0.297790647f},
-std::array<float,2>{0.382161558f, 0.582534313f},
-std::array<float,2>{0.737436116f, 0.000631596078f},
-std::array<float,2>{0.611021757f, 0.647051573f},
-std::array<float,2>{0.349938363f, 0.231785685f},
-std::array<float,2>{0.0597700924f, 0.831332266f},
-std::array<float,2>{0.850691259f, 0.453605294f},
-std::array<float,2>{0.796239257f, 0.524332941f},
-std::array<float,2>{0.112979233f, 0.070654653f},
-std::array<float,2>{0.299784809f, 0.894133687f},
-std::array<float,2>{0.553129196f, 0.362342238f},
-std::array<float,2>{0.640310407f, 0.809917748f},
-std::array<float,2>{0.490867943f, 0.436899811f},
-std::array<float,2>{0.160261139f, 0.728712976f},
-std::array<float,2>{0.984076679f, 0.170367658f},
-std::array<float,2>{0.901197076f, 0.840756059f},
-std::array<float,2>{0.218935236f, 0.462233961f},
-std::array<float,2>{0.423828334f, 0.649504066f},
-std::array<float,2>{0.689525485f, 0.222198278f},
-std::array<float,2>{0.585345387f, 0.590575218f},
-std::array<float,2>{0.335803479f, 0.00941051822f},
-std::array<float,2>{0.0183309205f, 0.980769873f},
-std::array<float,2>{0.813345194f, 0.309310973f},
-std::array<float,2>{0.768434763f, 0.72224158f},
-std::array<float,2>{0.091582939f, 0.160111755f},
-std::array<float,2>{0.257582456f, 0.804068148f},
-std::array<float,2>{0.507702529f, 0.424593896f},
-std::array<float,2>{0.687483847f, 0.900420249f},
-std::array<float,2>{0.463135958f, 0.370420337f},
-std::array<float,2>{0.15536654f, 0.52325505f},
-std::array<float,2>{0.945830643f, 0.0643514097f},
-std::array<float,2>{0.856507361f, 0.953074157f},
-std::array<float,2>{0.0509573109f, 0.268611938f},
-std::array<float,2>{0.357067257f, 0.613946438f},
-std::array<float,2>{0.622180939f, 0.0468273349f},
-std::array<float,2>{0.742808938f, 0.666917622f},
-std::array<float,2>{0.387750953f, 0.209226787f},
-std::array<float,2>{0.206396237f, 0.869369805f},
-std::array<float,2>{0.91978693f, 0.488022804f},
-std::array<float,2>{0.975019395f, 0.541901886f},
-std::array<float,2>{0.168051541f, 0.109540507f},
-std::array<float,2>{0.496659458f, 0.920156002f},
-std::array<float,2>{0.632707536f, 0.337853283f},
-std::array<float,2>{0.55868125f, 0.775580287f},
-std::array<float,2>{0.307609469f, 0.393656015f},
-std::array<float,2>{0.117580406f, 0.699170113f},
-std::array<float,2>{0.782982647f, 0.147424713f},
-std::array<float,2>{0.798252881f, 0.785192907f},
-std::array<float,2>{0.098989144f, 0.406368822f},
-std::array<float,2>{0.288267523f, 0.738895178f},
-std::array<float,2>{0.538463175f, 0.177085117f},
-std::array<float,2>{0.655774891f, 0.51335758f},
-std::array<float,2>{0.471028835f, 0.0859049633f},
-std::array<float,2>{0.181630358f, 0.87778002f},
-std::array<float,2>{0.986052811f, 0.356619f},
-std::array<float,2>{0.924197018f, 0.632767856f},
-std::array<float,2>{0.202419758f, 0.243159771f},
-std::array<float,2>{0.399012417f, 0.818788409f},
-std::array<float,2>{0.722596765f, 0.438597381f},
-std::array<float,2>{0.602426469f, 0.999825895f},
-std::array<float,2>{0.36706695f, 0.292120963f},
-std::array<float,2>{0.0384633765f, 0.57739079f},
-std::array<float,2>{0.860266864f, 0.0198518783f},
-std::array<float,2>{0.962906063f, 0.930450082f},
-std::array<float,2>{0.137849838f, 0.317978829f},
-std::array<float,2>{0.445332378f, 0.554762959f},
-std::array<float,2>{0.660312414f, 0.102311142f},
-std::array<float,2>{0.522750497f, 0.705108285f},
-std::array<float,2>{0.266660124f, 0.13200222f},
-std::array<float,2>{0.0759983212f, 0.7522825f},
-std::array<float,2>{0.762394786f, 0.376561344f},
-std::array<float,2>{0.830094099f, 0.602786481f},
-std::array<float,2>{0.00294338074f, 0.0554349236f},
-std::array<float,2>{0.322884679f, 0.964176059f},
-std::array<float,2>{0.56512171f, 0.252225608f},
-std::array<float,2>{0.716281831f, 0.854852796f},
-std::array<float,2>{0.421546072f, 0.475606382f},
-std::array<float,2>{0.242764235f, 0.680256844f},
-std::array<float,2>{0.877481699f, 0.197880641f},
-std::array<float,2>{0.931011796f, 0.800285041f},
-std::array<float,2>{0.190064102f, 0.425999343f},
-std::array<float,2>{0.394234687f, 0.725974441f},
-std::array<float,2>{0.727101326f, 0.160808295f},
-std::array<float,2>{0.598554432f, 0.518083811f},
-std::array<float,2>{0.37374109f, 0.0683333352f},
-std::array<float,2>{0.0440683514f, 0.902891219f},
-std::array<float,2>{0.869867325f, 0.371362865f},
-std::array<float,2>{0.811674118f, 0.654637396f},
-std::array<float,2>{0.105934732f, 0.225417405f},
-std::array<float,2>{0.293145657f, 0.835984945f},
-std::array<float,2>{0.545205295f, 0.466403306f},
-std::array<float,2>{0.642699003f, 0.979982853f},
-std::array<float,2>{0.479636818f, 0.305063069f},
-std::array<float,2>{0.172089532f, 0.589255512f},
-std::array<float,2>{0.999885559f, 0.0121312849f},
-std::array<float,2>{0.83961606f, 0.916208804f},
-std::array<float,2>{0.0141645633f, 0.341151327f},
-std::array<float,2>{0.318647087f, 0.546031773f},
-std::array<float,2>{0.575049102f, 0.116498619f},
-std::array<float,2>{0.709590077f, 0.700653672f},
-std::array<float,2>{0.409197927f, 0.142599225f},
-std::array<float,2>{0.239755586f, 0.777825177f},
-std::array<float,2>{0.8838498f, 0.397761583f},
-std::array<float,2>{0.958296359f, 0.611711562f},
-std::array<float,2>{0.132191911f, 0.0392391831f},
-std::array<float,2>{0.441921592f, 0.949206889f},
-std::array<float,2>{0.664174497f, 0.272262365f},
-std::array<float,2>{0.529532313f, 0.873075664f},
-std::array<float,2>{0.280020863f, 0.490689337f},
-std::array<float,2>{0.0653153881f, 0.67053777f},
-std::array<float,2>{0.757302761f, 0.205692679f},
-std::array<float,2>{0.781159163f, 0.814800441f},
-std::array<float,2>{0.0828430131f, 0.444315374f},
-std::array<float,2>{0.258440137f, 0.628471494f},
-std::array<float,2>{0.511241317f, 0.247743398f},
-std::array<float,2>{0.673416317f, 0.571673989f},
-std::array<float,2>{0.455996782f, 0.019527033f},
-std::array<float,2>{0.142942041f, 0.994986296f},
-std::array<float,2>{0.940366149f, 0.294401288f},
-std::array<float,2>{0.896601439f, 0.73646754f},
-std::array<float,2>{0.233138815f, 0.174905166f},
-std::array<float,2>{0.432877988f, 0.781653643f},
-std::array<float,2>{0.701846004f, 0.412118733f},
-std::array<float,2>{0.588610947f, 0.879625976f},
-std::array<float,2>{0.340016305f, 0.354105234f},
-std::array<float,2>{0.0241777487f, 0.509603262f},
-std::array<float,2>{0.822307229f, 0.0808711872f},
-std::array<float,2>{0.977976322f, 0.965190709f},
-std::array<float,2>{0.158380553f, 0.254871339f},
-std::array<float,2>{0.488219798f, 0.608286142f},
-std::array<float,2>{0.634270251f, 0.0619159527f},
-std::array<float,2>{0.547334731f, 0.684913397f},
-std::array<float,2>{0.302807957f, 0.199342787f},
-std::array<float,2>{0.113945372f, 0.856680036f},
-std::array<float,2>{0.792002678f, 0.471140981f},
-std::array<float,2>{0.847027302f, 0.562230349f},
-std::array<float,2>{0.0565018244f, 0.106481068f},
-std::array<float,2>{0.347270638f, 0.933956981f},
-std::array<float,2>{0.614371598f, 0.313605368f},
-std::array<float,2>{0.738565385f, 0.755963445f},
-std::array<float,2>{0.376353234f, 0.38040936f},
-std::array<float,2>{0.214744419f, 0.708087683f},
-std::array<float,2>{0.913818419f, 0.127042234f},
-std::array<float,2>{0.951650858f, 0.848893106f},
-std::array<float,2>{0.149731591f, 0.48003161f},
-std::array<float,2>{0.468436807f, 0.67353934f},
-std::array<float,2>{0.680173934f, 0.192802772f},
-std::array<float,2>{0.503086329f, 0.596348643f},
-std::array<float,2>{0.253616601f, 0.0509201512f},
-std::array<float,2>{0.0889119953f, 0.959418476f},
-std::array<float,2>{0.772087753f, 0.258713514f},
-std::array<float,2>{0.819588661f, 0.711340487f},
-std::array<float,2>{0.0200027619f, 0.1348252f},
-std::array<float,2>{0.331042826f, 0.763892531f},
-std::array<float,2>{0.578388214f, 0.390188515f},
-std::array<float,2>{0.691439033f, 0.923055649f},
-std::array<float,2>{0.428436458f, 0.320646346f},
-std::array<float,2>{0.226002306f, 0.547067463f},
-std::array<float,2>{0.905273557f, 0.0941105038f},
-std::array<float,2>{0.787130833f, 0.988847673f},
-std::array<float,2>{0.122073099f, 0.288941264f},
-std::array<float,2>{0.310719222f, 0.569216788f},
-std::array<float,2>{0.556581259f, 0.0251778606f},
-std::array<float,2>{0.628624678f, 0.634962499f},
-std::array<float,2>{0.493440241f, 0.238448024f},
-std::array<float,2>{0.166119888f, 0.821391881f},
-std::array<float,2>{0.969575346f, 0.445439219f},
-std::array<float,2>{0.914137065f, 0.501862884f},
-std::array<float,2>{0.208430275f, 0.0914461166f},
-std::array<float,2>{0.383372366f, 0.884979248f},
-std::array<float,2>{0.746504128f, 0.348235816f},
-std::array<float,2>{0.619900465f, 0.791126013f},
-std::array<float,2>{0.355443537f, 0.414307028f},
-std::array<float,2>{0.0501780994f, 0.748607576f},
-std::array<float,2>{0.852716982f, 0.182800904f},
-std::array<float,2>{0.865432143f, 0.768796265f},
-std::array<float,2>{0.0334560759f, 0.400036573f},
-std::array<float,2>{0.359677553f, 0.689606428f},
-std::array<float,2>{0.606775045f, 0.154755414f},
-std::array<float,2>{0.72509253f, 0.532112002f},
-std::array<float,2>{0.404739052f, 0.11847014f},
-std::array<float,2>{0.197661728f, 0.909886837f},
-std::array<float,2>{0.92675662f, 0.335300505f},
-std::array<float,2>{0.991050541f, 0.656786859f},
-std::array<float,2>{0.186609492f, 0.216079831f},
-std::array<float,2>{0.476309538f, 0.864826322f},
-std::array<float,2>{0.64986968f, 0.498108119f},
-std::array<float,2>{0.531414211f, 0.943394125f},
-std::array<float,2>{0.282392979f, 0.275448114f},
-std::array<float,2>{0.0973066986f, 0.618213296f},
-std::array<float,2>{0.804201186f, 0.0359661318f},
-std::array<float,2>{0.879916966f, 0.895222783f},
-std::array<float,2>{0.248835608f, 0.366262674f},
-std::array<float,2>{0.416457862f, 0.53083688f},
-std::array<float,2>{0.713344932f, 0.07698185f},
-std::array<float,2>{0.569963872f, 0.732905746f},
-std::array<float,2>{0.327468544f, 0.167208135f},
-std::array<float,2>{0.00559039321f, 0.807376921f},
-std::array<float,2>{0.832551122f, 0.429746628f},
-std::array<float,2>{0.759968042f, 0.578358889f},
-std::array<float,2>{0.0710570738f, 0.00511874445f},
-std::array<float,2>{0.272813141f, 0.970883548f},
-std::array<float,2>{0.51841408f, 0.304188669f},
-std::array<float,2>{0.659414291f, 0.833423674f},
-std::array<float,2>{0.450340331f, 0.457212329f},
-std::array<float,2>{0.135155931f, 0.642056882f},
-std::array<float,2>{0.966615975f, 0.226776749f},
-std::array<float,2>{0.999639034f, 0.797032356f},
-std::array<float,2>{0.172144428f, 0.429563433f},
-std::array<float,2>{0.479750723f, 0.723236799f},
-std::array<float,2>{0.643018425f, 0.163089022f},
-std::array<float,2>{0.545138419f, 0.516862512f},
-std::array<float,2>{0.293348461f, 0.0696936026f},
-std::array<float,2>{0.105652906f, 0.904733658f},
-std::array<float,2>{0.81192863f, 0.374270856f},
-std::array<float,2>{0.869977891f, 0.654135942f},
-std::array<float,2>{0.0443942472f, 0.224287748f},
-std::array<float,2>{0.374012798f, 0.839070559f},
-std::array<float,2>{0.598350823f, 0.467096835f},
-std::array<float,2>{0.727389038f, 0.976792216f},
-std::array<float,2>{0.394482374f, 0.307654113f},
-std::array<float,2>{0.190222353f, 0.586887002f},
-std::array<float,2>{0.93088299f, 0.015107058f},
-std::array<float,2>{0.756844401f, 0.914394677f},
-std::array<float,2>{0.0649472028f, 0.342231274f},
-std::array<float,2>{0.280042708f, 0.544330478f},
-std::array<float,2>{0.529671311f, 0.113498673f},
-std::array<float,2>{0.664358974f, 0.702622592f},
-std::array<float,2>{0.442355812f, 0.14257662f},
-std::array<float,2>{0.131906807f, 0.779388368f},
-std::array<float,2>{0.958088994f, 0.394934148f},
-std::array<float,2>{0.884044826f, 0.610650778f},
-std::array<float,2>{0.240200073f, 0.0424157418f},
-std::array<float,2>{0.409519523f, 0.947112739f},
-std::array<float,2>{0.709904492f, 0.271426141f},
-std::array<float,2>{0.574854434f, 0.871879339f},
-std::array<float,2>{0.318408638f, 0.488401324f},
-std::array<float,2>{0.0144857112f, 0.668753207f},
-std::array<float,2>{0.83953315f, 0.204466164f},
-std::array<float,2>{0.822682559f, 0.813767254f},
-std::array<float,2>{0.024025565f, 0.441940784f},
-std::array<float,2>{0.340117127f, 0.625892818f},
-std::array<float,2>{0.58884722f, 0.24982807f},
-std::array<float,2>{0.701911211f, 0.572327197f},
-std::array<float,2>{0.432669848f, 0.0170994755f},
-std::array<float,2>{0.233295873f, 0.992332399f},
-std::array<float,2>{0.896968126f, 0.295086354f},
-std::array<float,2>{0.939965189f, 0.735924959f},
-std::array<float,2>{0.142596826f, 0.17229858f},
-std::array<float,2>{0.455587804f, 0.784335732f},
-std::array<float,2>{0.673621655f, 0.411477447f},
-std::array<float,2>{0.511512995f, 0.880863547f},
-std::array<float,2>{0.258559138f, 0.352873594f},
-std::array<float,2>{0.0826396421f, 0.510780931f},
-std::array<float,2>{0.780877113f, 0.0784546062f},
-std::array<float,2>{0.913638175f, 0.96804589f},
-std::array<float,2>{0.21446228f, 0.256771296f},
-std::array<float,2>{0.375983953f, 0.607384026f},
-std::array<float,2>{0.738410115f, 0.0605240799f},
-std::array<float,2>{0.614740968f, 0.686020672f},
-std::array<float,2>{0.347444177f, 0.201494589f},
-std::array<float,2>{0.0562625118f, 0.858979821f},
-std::array<float,2>{0.84680438f, 0.470472783f},
-std::array<float,2>{0.792271495f, 0.558598399f},
-std::array<float,2>{0.114229143f, 0.107738115f},
-std::array<float,2>{0.30298385f, 0.9361974f},
-std::array<float,2>{0.547065914f, 0.316149682f},
-std::array<float,2>{0.633810878f, 0.755306065f},
-std::array<float,2>{0.487867773f, 0.381887048f},
-std::array<float,2>{0.158559024f, 0.710892677f},
-std::array<float,2>{0.977753401f, 0.125009373f},
-std::array<float,2>{0.905564964f, 0.851112068f},
-std::array<float,2>{0.225782752f, 0.476609558f},
-std::array<float,2>{0.428648084f, 0.674189627f},
-std::array<float,2>{0.691841304f, 0.193794832f},
-std::array<float,2>{0.578232408f, 0.593850493f},
-std::array<float,2>{0.330580175f, 0.0542339683f},
-std::array<float,2>{0.0196937788f, 0.95897001f},
-std::array<float,2>{0.819415271f, 0.261376619f},
-std::array<float,2>{0.772233188f, 0.713115275f},
-std::array<float,2>{0.0891514495f, 0.133005351f},
-std::array<float,2>{0.253771365f, 0.761759579f},
-std::array<float,2>{0.503213167f, 0.38836208f},
-std::array<float,2>{0.679837048f, 0.924742877f},
-std::array<float,2>{0.468702525f, 0.323776633f},
-std::array<float,2>{0.149540558f, 0.5501194f},
-std::array<float,2>{0.951354742f, 0.0969139263f},
-std::array<float,2>{0.852785408f, 0.992031336f},
-std::array<float,2>{0.0499578416f, 0.286402375f},
-std::array<float,2>{0.355028659f, 0.567894816f},
-std::array<float,2>{0.619779706f, 0.0253926646f},
-std::array<float,2>{0.74626559f, 0.634141386f},
-std::array<float,2>{0.383561432f, 0.240860566f},
-std::array<float,2>{0.208013132f, 0.82298094f},
-std::array<float,2>{0.914479017f, 0.448823988f},
-std::array<float,2>{0.969334662f, 0.503314614f},
-std::array<float,2>{0.166318476f, 0.0930585563f},
-std::array<float,2>{0.493350416f, 0.884294093f},
-std::array<float,2>{0.628767312f, 0.349745482f},
-std::array<float,2>{0.556329727f, 0.78925693f},
-std::array<float,2>{0.310962975f, 0.416198671f},
-std::array<float,2>{0.12248458f, 0.746554792f},
-std::array<float,2>{0.787428737f, 0.180803254f},
-std::array<float,2>{0.80453521f, 0.766821325f},
-std::array<float,2>{0.0974205136f, 0.401369512f},
-std::array<float,2>{0.282576382f, 0.689326584f},
-std::array<float,2>{0.531678617f, 0.153462738f},
-std::array<float,2>{0.649544775f, 0.533839822f},
-std::array<float,2>{0.476542026f, 0.120649487f},
-std::array<float,2>{0.186987221f, 0.908192039f},
-std::array<float,2>{0.990782917f, 0.332595021f},
-std::array<float,2>{0.926493227f, 0.65965867f},
-std::array<float,2>{0.197291762f, 0.217938125f},
-std::array<float,2>{0.404337138f, 0.865970433f},
-std::array<float,2>{0.724818051f, 0.496437728f},
-std::array<float,2>{0.606494308f, 0.942518413f},
-std::array<float,2>{0.359569222f, 0.274734795f},
-std::array<float,2>{0.0332297385f, 0.62042582f},
-std::array<float,2>{0.865575075f, 0.0377039574f},
-std::array<float,2>{0.966351151f, 0.89746213f},
-std::array<float,2>{0.13496834f, 0.363472492f},
-std::array<float,2>{0.450514853f, 0.529288232f},
-std::array<float,2>{0.65960443f, 0.0756771564f},
-std::array<float,2>{0.518187165f, 0.731361628f},
-std::array<float,2>{0.272610456f, 0.16575405f},
-std::array<float,2>{0.0708113015f, 0.80657053f},
-std::array<float,2>{0.760187209f, 0.433593243f},
-std::array<float,2>{0.832835078f, 0.582019806f},
-std::array<float,2>{0.00574111938f, 0.00628852053f},
-std::array<float,2>{0.327345282f, 0.969046652f},
-std::array<float,2>{0.57022351f, 0.30119428f},
-std::array<float,2>{0.712947905f, 0.835031092f},
-std::array<float,2>{0.416033715f, 0.460629404f},
-std::array<float,2>{0.248734102f, 0.643226027f},
-std::array<float,2>{0.880294085f, 0.228816897f},
-std::array<float,2>{0.935742915f, 0.758996725f},
-std::array<float,2>{0.193609282f, 0.385930985f},
-std::array<float,2>{0.396327823f, 0.717992783f},
-std::array<float,2>{0.73183471f, 0.139566511f},
-std::array<float,2>{0.595376849f, 0.554580033f},
-std::array<float,2>{0.367206544f, 0.0981786028f},
-std::array<float,2>{0.0416602641f, 0.925829649f},
-std::array<float,2>{0.872420371f, 0.326411068f},
-std::array<float,2>{0.805781484f, 0.67760241f},
-std::array<float,2>{0.103489801f, 0.190528169f},
-std::array<float,2>{0.290728599f, 0.846603215f},
-std::array<float,2>{0.539234519f, 0.483178675f},
-std::array<float,2>{0.647889018f, 0.9535923f},
-std::array<float,2>{0.481439829f, 0.265268743f},
-std::array<float,2>{0.17755267f, 0.600685835f},
-std::array<float,2>{0.995076716f, 0.0482546128f},
-std::array<float,2>{0.841827333f, 0.890605509f},
-std::array<float,2>{0.00868433621f, 0.347052306f},
-std::array<float,2>{0.314508945f, 0.507079959f},
-std::array<float,2>{0.572629213f, 0.0894676149f},
-std::array<float,2>{0.704888284f, 0.743530035f},
-std::array<float,2>{0.410161763f, 0.185312554f},
-std::array<float,2>{0.234556675f, 0.794458807f},
-std::array<float,2>{0.886881292f, 0.421824962f},
-std::array<float,2>{0.955349863f, 0.566169918f},
-std::array<float,2>{0.126825839f, 0.0283854306f},
-std::array<float,2>{0.437636465f, 0.987998724f},
-std::array<float,2>{0.670216143f, 0.283322811f},
-std::array<float,2>{0.525294244f, 0.828002453f},
-std::array<float,2>{0.275480717f, 0.452241451f},
-std::array<float,2>{0.0681133419f, 0.639778852f},
-std::array<float,2>{0.753236115f, 0.235746086f},
-std::array<float,2>{0.775174677f, 0.862148821f},
-std::array<float,2>{0.0819069445f, 0.492931753f},
-std::array<float,2>{0.265257746f, 0.663501024f},
-std::array<float,2>{0.515310585f, 0.214690998f},
-std::array<float,2>{0.676104426f, 0.624515176f},
-std::array<float,2>{0.459798664f, 0.0347953737f},
-std::array<float,2>{0.148200005f, 0.939216733f},
-std::array<float,2>{0.942810893f, 0.280866712f},
-std::array<float,2>{0.89439255f, 0.6940341f},
-std::array<float,2>{0.227497712f, 0.148855254f},
-std::array<float,2>{0.436010808f, 0.772695184f},
-std::array<float,2>{0.695701957f, 0.405492932f},
-std::array<float,2>{0.593170941f, 0.910685122f},
-std::array<float,2>{0.339158148f, 0.32947734f},
-std::array<float,2>{0.0277256556f, 0.535530984f},
-std::array<float,2>{0.827682614f, 0.124793112f},
-std::array<float,2>{0.984223664f, 0.975070536f},
-std::array<float,2>{0.160546705f, 0.300358683f},
-std::array<float,2>{0.491190314f, 0.585031152f},
-std::array<float,2>{0.640619218f, 0.00361959613f},
-std::array<float,2>{0.552760601f, 0.645135641f},
-std::array<float,2>{0.299494684f, 0.232446775f},
-std::array<float,2>{0.113256864f, 0.829305649f},
-std::array<float,2>{0.795906723f, 0.455236524f},
-std::array<float,2>{0.850937068f, 0.525658071f},
-std::array<float,2>{0.0599637181f, 0.07261426f},
-std::array<float,2>{0.349637985f, 0.891889393f},
-std::array<float,2>{0.611193895f, 0.361019909f},
-std::array<float,2>{0.737751126f, 0.812112212f},
-std::array<float,2>{0.381853014f, 0.434617996f},
-std::array<float,2>{0.216372281f, 0.726856649f},
-std::array<float,2>{0.908393979f, 0.168987751f},
-std::array<float,2>{0.946076274f, 0.843260944f},
-std::array<float,2>{0.155535057f, 0.463394761f},
-std::array<float,2>{0.463101f, 0.650502563f},
-std::array<float,2>{0.687018752f, 0.219775259f},
-std::array<float,2>{0.507384002f, 0.593426645f},
-std::array<float,2>{0.257517129f, 0.0114736576f},
-std::array<float,2>{0.0914467201f, 0.98382771f},
-std::array<float,2>{0.768253922f, 0.311053067f},
-std::array<float,2>{0.813194931f, 0.72040391f},
-std::array<float,2>{0.018263679f, 0.15762566f},
-std::array<float,2>{0.335662693f, 0.801594198f},
-std::array<float,2>{0.584972978f, 0.422923893f},
-std::array<float,2>{0.689735711f, 0.899030626f},
-std::array<float,2>{0.424091965f, 0.368778825f},
-std::array<float,2>{0.219145015f, 0.519652963f},
-std::array<float,2>{0.901069105f, 0.06458731f},
-std::array<float,2>{0.782752156f, 0.950556636f},
-std::array<float,2>{0.117363028f, 0.267284513f},
-std::array<float,2>{0.307360113f, 0.615399539f},
-std::array<float,2>{0.558852732f, 0.0446597487f},
-std::array<float,2>{0.632370353f, 0.665764272f},
-std::array<float,2>{0.496988326f, 0.208926335f},
-std::array<float,2>{0.168374658f, 0.867518723f},
-std::array<float,2>{0.974837005f, 0.484588295f},
-std::array<float,2>{0.919434011f, 0.540184498f},
-std::array<float,2>{0.206236765f, 0.112099841f},
-std::array<float,2>{0.388090581f, 0.918076456f},
-std::array<float,2>{0.743065f, 0.338356942f},
-std::array<float,2>{0.62235409f, 0.775278509f},
-std::array<float,2>{0.357271701f, 0.391122311f},
-std::array<float,2>{0.0511050411f, 0.696415067f},
-std::array<float,2>{0.856856525f, 0.145002887f},
-std::array<float,2>{0.859886169f, 0.788562953f},
-std::array<float,2>{0.0381217934f, 0.409901261f},
-std::array<float,2>{0.3668212f, 0.74092418f},
-std::array<float,2>{0.602285743f, 0.178787589f},
-std::array<float,2>{0.722174823f, 0.514933646f},
-std::array<float,2>{0.399275362f, 0.0835783258f},
-std::array<float,2>{0.202219486f, 0.875266552f},
-std::array<float,2>{0.924012244f, 0.358792603f},
-std::array<float,2>{0.98619467f, 0.630416036f},
-std::array<float,2>{0.181234628f, 0.245186746f},
-std::array<float,2>{0.470909655f, 0.817384303f},
-std::array<float,2>{0.656214893f, 0.441029966f},
-std::array<float,2>{0.538243651f, 0.996660054f},
-std::array<float,2>{0.288506985f, 0.28998974f},
-std::array<float,2>{0.0988653004f, 0.575088203f},
-std::array<float,2>{0.797935128f, 0.0232594945f},
-std::array<float,2>{0.877726972f, 0.931737959f},
-std::array<float,2>{0.242989749f, 0.320017755f},
-std::array<float,2>{0.42166537f, 0.557888806f},
-std::array<float,2>{0.715942144f, 0.103702508f},
-std::array<float,2>{0.565401018f, 0.703186989f},
-std::array<float,2>{0.323100299f, 0.129446059f},
-std::array<float,2>{0.00332033937f, 0.750220716f},
-std::array<float,2>{0.830544949f, 0.377011865f},
-std::array<float,2>{0.762488723f, 0.604854107f},
-std::array<float,2>{0.0758526102f, 0.057604745f},
-std::array<float,2>{0.266850561f, 0.962694407f},
-std::array<float,2>{0.522475123f, 0.251938015f},
-std::array<float,2>{0.660489976f, 0.852653742f},
-std::array<float,2>{0.445691943f, 0.472995907f},
-std::array<float,2>{0.138104543f, 0.681960881f},
-std::array<float,2>{0.963301063f, 0.196774766f},
-std::array<float,2>{0.960696757f, 0.77842021f},
-std::array<float,2>{0.130134538f, 0.397262305f},
-std::array<float,2>{0.444901228f, 0.699982762f},
-std::array<float,2>{0.666223884f, 0.144320175f},
-std::array<float,2>{0.528572619f, 0.544928074f},
-std::array<float,2>{0.279129446f, 0.115915321f},
-std::array<float,2>{0.0633741617f, 0.917259514f},
-std::array<float,2>{0.754050255f, 0.340212703f},
-std::array<float,2>{0.837517083f, 0.67173481f},
-std::array<float,2>{0.0126742786f, 0.206815913f},
-std::array<float,2>{0.317234069f, 0.874979734f},
-std::array<float,2>{0.576379955f, 0.492061317f},
-std::array<float,2>{0.707653403f, 0.948003054f},
-std::array<float,2>{0.408026934f, 0.27303192f},
-std::array<float,2>{0.241441116f, 0.612637401f},
-std::array<float,2>{0.88616246f, 0.0402815714f},
-std::array<float,2>{0.809276342f, 0.903733075f},
-std::array<float,2>{0.107622132f, 0.372323364f},
-std::array<float,2>{0.296765745f, 0.518899143f},
-std::array<float,2>{0.544477463f, 0.0667402446f},
-std::array<float,2>{0.641761005f, 0.725255311f},
-std::array<float,2>{0.477503806f, 0.162001878f},
-std::array<float,2>{0.174408808f, 0.79965502f},
-std::array<float,2>{0.996398509f, 0.427138269f},
-std::array<float,2>{0.93307215f, 0.588095486f},
-std::array<float,2>{0.189250186f, 0.0131573761f},
-std::array<float,2>{0.391177714f, 0.979141951f},
-std::array<float,2>{0.728975534f, 0.306521147f},
-std::array<float,2>{0.599629939f, 0.837092221f},
-std::array<float,2>{0.371699423f, 0.465814531f},
-std::array<float,2>{0.0455705784f, 0.655742466f},
-std::array<float,2>{0.868111134f, 0.226188138f},
-std::array<float,2>{0.844779491f, 0.856267571f},
-std::array<float,2>{0.057488814f, 0.471738577f},
-std::array<float,2>{0.345103294f, 0.684463739f},
-std::array<float,2>{0.616609812f, 0.201019883f},
-std::array<float,2>{0.740439117f, 0.608684063f},
-std::array<float,2>{0.377039641f, 0.0605697446f},
-std::array<float,2>{0.211322382f, 0.966293514f},
-std::array<float,2>{0.911434829f, 0.25539878f},
-std::array<float,2>{0.980206788f, 0.707688451f},
-std::array<float,2>{0.157869235f, 0.12802811f},
-std::array<float,2>{0.484669566f, 0.757756293f},
-std::array<float,2>{0.635462701f, 0.379092276f},
-std::array<float,2>{0.550314605f, 0.935446382f},
-std::array<float,2>{0.301450521f, 0.312980354f},
-std::array<float,2>{0.115825005f, 0.560971379f},
-std::array<float,2>{0.789397597f, 0.106102921f},
-std::array<float,2>{0.896403551f, 0.995183945f},
-std::array<float,2>{0.231516629f, 0.293509245f},
-std::array<float,2>{0.429751933f, 0.570820689f},
-std::array<float,2>{0.699984252f, 0.0181999616f},
-std::array<float,2>{0.586817145f, 0.62773329f},
-std::array<float,2>{0.342760146f, 0.246527016f},
-std::array<float,2>{0.0261190049f, 0.815486848f},
-std::array<float,2>{0.820520759f, 0.444947064f},
-std::array<float,2>{0.778847575f, 0.508272588f},
-std::array<float,2>{0.0847884715f, 0.0818259269f},
-std::array<float,2>{0.261307538f, 0.880606532f},
-std::array<float,2>{0.508130372f, 0.355316699f},
-std::array<float,2>{0.673916519f, 0.78258121f},
-std::array<float,2>{0.454073906f, 0.413892388f},
-std::array<float,2>{0.141219214f, 0.737955928f},
-std::array<float,2>{0.938033164f, 0.174010843f},
-std::array<float,2>{0.917406619f, 0.820853889f},
-std::array<float,2>{0.210189655f, 0.446320146f},
-std::array<float,2>{0.385643989f, 0.636529863f},
-std::array<float,2>{0.749553561f, 0.239631966f},
-std::array<float,2>{0.617820978f, 0.569494069f},
-std::array<float,2>{0.353001297f, 0.023630565f},
-std::array<float,2>{0.0473294295f, 0.990088761f},
-std::array<float,2>{0.853817105f, 0.287870139f},
-std::array<float,2>{0.78585279f, 0.749070287f},
-std::array<float,2>{0.124567449f, 0.181810319f},
-std::array<float,2>{0.309678555f, 0.792760551f},
-std::array<float,2>{0.557657003f, 0.415140122f},
-std::array<float,2>{0.626603425f, 0.886590242f},
-std::array<float,2>{0.495969415f, 0.349124879f},
-std::array<float,2>{0.16578117f, 0.50095427f},
-std::array<float,2>{0.972383618f, 0.0898808092f},
-std::array<float,2>{0.817775011f, 0.959970772f},
-std::array<float,2>{0.0232126117f, 0.259101212f},
-std::array<float,2>{0.329499274f, 0.596861184f},
-std::array<float,2>{0.580995739f, 0.052166f},
-std::array<float,2>{0.693603337f, 0.672223508f},
-std::array<float,2>{0.426750362f, 0.192179948f},
-std::array<float,2>{0.222968519f, 0.848562658f},
-std::array<float,2>{0.903525829f, 0.478568673f},
-std::array<float,2>{0.950390995f, 0.548249125f},
-std::array<float,2>{0.151472539f, 0.0953421891f},
-std::array<float,2>{0.466007859f, 0.922379792f},
-std::array<float,2>{0.683037996f, 0.321370214f},
-std::array<float,2>{0.501116216f, 0.765348375f},
-std::array<float,2>{0.250401855f, 0.389181018f},
-std::array<float,2>{0.0866386071f, 0.712053895f},
-std::array<float,2>{0.770359218f, 0.136206299f},
-std::array<float,2>{0.758802176f, 0.808477104f},
-std::array<float,2>{0.0725885704f, 0.430888236f},
-std::array<float,2>{0.271416366f, 0.73414731f},
-std::array<float,2>{0.516178727f, 0.16696319f},
-std::array<float,2>{0.657752514f, 0.530175984f},
-std::array<float,2>{0.453089386f, 0.0775246248f},
-std::array<float,2>{0.133411571f, 0.895880818f},
-std::array<float,2>{0.966874838f, 0.365459353f},
-std::array<float,2>{0.882293522f, 0.641368449f},
-std::array<float,2>{0.24664247f, 0.22793971f},
-std::array<float,2>{0.414605826f, 0.832110047f},
-std::array<float,2>{0.712584853f, 0.458477318f},
-std::array<float,2>{0.566980839f, 0.972066164f},
-std::array<float,2>{0.325255781f, 0.302790463f},
-std::array<float,2>{0.00592536852f, 0.579890728f},
-std::array<float,2>{0.834968626f, 0.00423104502f},
-std::array<float,2>{0.989422977f, 0.908861995f},
-std::array<float,2>{0.185299158f, 0.33400318f},
-std::array<float,2>{0.473469079f, 0.532647312f},
-std::array<float,2>{0.651202857f, 0.118158169f},
-std::array<float,2>{0.534143686f, 0.691362858f},
-std::array<float,2>{0.283399522f, 0.156058252f},
-std::array<float,2>{0.0952451825f, 0.768323779f},
-std::array<float,2>{0.801477551f, 0.398609608f},
-std::array<float,2>{0.863622129f, 0.618128896f},
-std::array<float,2>{0.0320840217f, 0.0365098156f},
-std::array<float,2>{0.362496942f, 0.944959641f},
-std::array<float,2>{0.609167576f, 0.277258039f},
-std::array<float,2>{0.723967016f, 0.863614321f},
-std::array<float,2>{0.403740257f, 0.499595553f},
-std::array<float,2>{0.195717588f, 0.658078551f},
-std::array<float,2>{0.928338587f, 0.215034351f},
-std::array<float,2>{0.88927269f, 0.796175241f},
-std::array<float,2>{0.238166586f, 0.418581843f},
-std::array<float,2>{0.413621902f, 0.745010138f},
-std::array<float,2>{0.705567122f, 0.187005848f},
-std::array<float,2>{0.570492744f, 0.504759312f},
-std::array<float,2>{0.312875837f, 0.0869997069f},
-std::array<float,2>{0.0101999315f, 0.88757354f},
-std::array<float,2>{0.841463089f, 0.345434517f},
-std::array<float,2>{0.750647545f, 0.636823356f},
-std::array<float,2>{0.0687335357f, 0.237429067f},
-std::array<float,2>{0.273673296f, 0.824967802f},
-std::array<float,2>{0.526408792f, 0.451125264f},
-std::array<float,2>{0.66928947f, 0.985059619f},
-std::array<float,2>{0.441252649f, 0.282091141f},
-std::array<float,2>{0.127867147f, 0.564239383f},
-std::array<float,2>{0.953428745f, 0.0304153766f},
-std::array<float,2>{0.874932826f, 0.928558052f},
-std::array<float,2>{0.0401211008f, 0.325323731f},
-std::array<float,2>{0.369473249f, 0.551961184f},
-std::array<float,2>{0.596179783f, 0.100797512f},
-std::array<float,2>{0.732658684f, 0.715358436f},
-std::array<float,2>{0.397852987f, 0.138364032f},
-std::array<float,2>{0.191979438f, 0.761005223f},
-std::array<float,2>{0.934671044f, 0.384647429f},
-std::array<float,2>{0.993758917f, 0.597761512f},
-std::array<float,2>{0.178132549f, 0.0495605655f},
-std::array<float,2>{0.484078795f, 0.956008554f},
-std::array<float,2>{0.646016598f, 0.261941284f},
-std::array<float,2>{0.542405128f, 0.843961358f},
-std::array<float,2>{0.292216152f, 0.480502963f},
-std::array<float,2>{0.104928009f, 0.677749693f},
-std::array<float,2>{0.808037341f, 0.188552186f},
-std::array<float,2>{0.794537544f, 0.831027448f},
-std::array<float,2>{0.109388731f, 0.454169393f},
-std::array<float,2>{0.296971142f, 0.648298383f},
-std::array<float,2>{0.55185008f, 0.230996624f},
-std::array<float,2>{0.637845933f, 0.583948791f},
-std::array<float,2>{0.490207374f, 0.00176901021f},
-std::array<float,2>{0.162511125f, 0.972735941f},
-std::array<float,2>{0.980702519f, 0.29881236f},
-std::array<float,2>{0.906787038f, 0.729834139f},
-std::array<float,2>{0.217453569f, 0.171016201f},
-std::array<float,2>{0.380379856f, 0.809466064f},
-std::array<float,2>{0.735504329f, 0.436468184f},
-std::array<float,2>{0.612015903f, 0.892970562f},
-std::array<float,2>{0.349037051f, 0.361910939f},
-std::array<float,2>{0.0617148578f, 0.524779022f},
-std::array<float,2>{0.848491251f, 0.0715037137f},
-std::array<float,2>{0.944324374f, 0.939853847f},
-std::array<float,2>{0.14638336f, 0.27751106f},
-std::array<float,2>{0.457328528f, 0.62282747f},
-std::array<float,2>{0.679677725f, 0.0326145478f},
-std::array<float,2>{0.512961447f, 0.661800563f},
-std::array<float,2>{0.262961239f, 0.211305097f},
-std::array<float,2>{0.0787594318f, 0.861192703f},
-std::array<float,2>{0.776595771f, 0.495240837f},
-std::array<float,2>{0.825283408f, 0.53726542f},
-std::array<float,2>{0.0305341408f, 0.121533699f},
-std::array<float,2>{0.336780876f, 0.913618207f},
-std::array<float,2>{0.590568125f, 0.330909252f},
-std::array<float,2>{0.69896692f, 0.771056414f},
-std::array<float,2>{0.434687227f, 0.402808428f},
-std::array<float,2>{0.229594409f, 0.693110704f},
-std::array<float,2>{0.890672624f, 0.151950717f},
-std::array<float,2>{0.974048316f, 0.870155156f},
-std::array<float,2>{0.171856552f, 0.486518413f},
-std::array<float,2>{0.499448895f, 0.667806327f},
-std::array<float,2>{0.629540265f, 0.21041292f},
-std::array<float,2>{0.56098628f, 0.614562452f},
-std::array<float,2>{0.306394607f, 0.0455549061f},
-std::array<float,2>{0.120953582f, 0.951568365f},
-std::array<float,2>{0.784178853f, 0.267780602f},
-std::array<float,2>{0.859069467f, 0.697371721f},
-std::array<float,2>{0.0535175391f, 0.148281574f},
-std::array<float,2>{0.35742563f, 0.777294099f},
-std::array<float,2>{0.623538136f, 0.393179089f},
-std::array<float,2>{0.744249046f, 0.921491981f},
-std::array<float,2>{0.389004469f, 0.336679608f},
-std::array<float,2>{0.203767344f, 0.542607248f},
-std::array<float,2>{0.921144009f, 0.111010328f},
-std::array<float,2>{0.766110539f, 0.981523931f},
-std::array<float,2>{0.0936618671f, 0.31048885f},
-std::array<float,2>{0.255308449f, 0.59100467f},
-std::array<float,2>{0.504444301f, 0.0083489893f},
-std::array<float,2>{0.684970677f, 0.648442566f},
-std::array<float,2>{0.462521642f, 0.221276522f},
-std::array<float,2>{0.154204234f, 0.841225028f},
-std::array<float,2>{0.947517812f, 0.461240649f},
-std::array<float,2>{0.899855852f, 0.521809995f},
-std::array<float,2>{0.222416043f, 0.062922217f},
-std::array<float,2>{0.422934502f, 0.902068436f},
-std::array<float,2>{0.687914491f, 0.369664222f},
-std::array<float,2>{0.58246541f, 0.803610802f},
-std::array<float,2>{0.332938969f, 0.42546311f},
-std::array<float,2>{0.0163863376f, 0.720989943f},
-std::array<float,2>{0.814627528f, 0.158522218f},
-std::array<float,2>{0.829380691f, 0.752929986f},
-std::array<float,2>{0.00176602253f, 0.375232458f},
-std::array<float,2>{0.321480483f, 0.70647198f},
-std::array<float,2>{0.563675225f, 0.131644443f},
-std::array<float,2>{0.716978073f, 0.555754125f},
-std::array<float,2>{0.419777602f, 0.10255082f},
-std::array<float,2>{0.244382694f, 0.931339443f},
-std::array<float,2>{0.876509845f, 0.317222446f},
-std::array<float,2>{0.962000847f, 0.681292534f},
-std::array<float,2>{0.140592441f, 0.198800787f},
-std::array<float,2>{0.447927177f, 0.854356647f},
-std::array<float,2>{0.66358906f, 0.474882513f},
-std::array<float,2>{0.521039784f, 0.963459313f},
-std::array<float,2>{0.268560648f, 0.25338006f},
-std::array<float,2>{0.0763876736f, 0.602284312f},
-std::array<float,2>{0.764736414f, 0.0562353581f},
-std::array<float,2>{0.923489094f, 0.878732622f},
-std::array<float,2>{0.199370012f, 0.356336147f},
-std::array<float,2>{0.402023941f, 0.512590766f},
-std::array<float,2>{0.720668733f, 0.0843818858f},
-std::array<float,2>{0.603668511f, 0.7399863f},
-std::array<float,2>{0.36449486f, 0.175943017f},
-std::array<float,2>{0.0353794545f, 0.787108541f},
-std::array<float,2>{0.862601399f, 0.407685161f},
-std::array<float,2>{0.800382078f, 0.576700568f},
-std::array<float,2>{0.101100616f, 0.0209806841f},
-std::array<float,2>{0.285667449f, 0.998125076f},
-std::array<float,2>{0.536845684f, 0.291133195f},
-std::array<float,2>{0.653927863f, 0.819714963f},
-std::array<float,2>{0.470499277f, 0.438259214f},
-std::array<float,2>{0.182715833f, 0.631562054f},
-std::array<float,2>{0.988262177f, 0.243313506f},
-std::array<float,2>{0.938893437f, 0.783576727f},
-std::array<float,2>{0.142186314f, 0.410357982f},
-std::array<float,2>{0.454956472f, 0.734493256f},
-std::array<float,2>{0.675525665f, 0.172868952f},
-std::array<float,2>{0.509731531f, 0.510345936f},
-std::array<float,2>{0.260419875f, 0.079919003f},
-std::array<float,2>{0.0852627456f, 0.882359445f},
-std::array<float,2>{0.777738571f, 0.352048457f},
-std::array<float,2>{0.821733832f, 0.626327097f},
-std::array<float,2>{0.0268716756f, 0.248902127f},
-std::array<float,2>{0.343369335f, 0.81305933f},
-std::array<float,2>{0.587479115f, 0.442807496f},
-std::array<float,2>{0.700648904f, 0.993774235f},
-std::array<float,2>{0.431322455f, 0.29643479f},
-std::array<float,2>{0.230868667f, 0.573842466f},
-std::array<float,2>{0.8946895f, 0.0157759897f},
-std::array<float,2>{0.7905671f, 0.937292337f},
-std::array<float,2>{0.117167197f, 0.315000325f},
-std::array<float,2>{0.301932752f, 0.560418189f},
-std::array<float,2>{0.549448788f, 0.108673356f},
-std::array<float,2>{0.635856509f, 0.709150136f},
-std::array<float,2>{0.485871285f, 0.126540989f},
-std::array<float,2>{0.156262219f, 0.754480243f},
-std::array<float,2>{0.979214847f, 0.381028801f},
-std::array<float,2>{0.911009789f, 0.60549283f},
-std::array<float,2>{0.21219334f, 0.0593033023f},
-std::array<float,2>{0.378823102f, 0.967352867f},
-std::array<float,2>{0.741352677f, 0.25719735f},
-std::array<float,2>{0.615888834f, 0.858114898f},
-std::array<float,2>{0.343837112f, 0.469287902f},
-std::array<float,2>{0.0577303879f, 0.68740505f},
-std::array<float,2>{0.844627202f, 0.202597529f},
-std::array<float,2>{0.868908882f, 0.837925553f},
-std::array<float,2>{0.0467299595f, 0.468464553f},
-std::array<float,2>{0.372525781f, 0.653170884f},
-std::array<float,2>{0.600784898f, 0.222664788f},
-std::array<float,2>{0.730333567f, 0.587382436f},
-std::array<float,2>{0.39170146f, 0.0140021564f},
-std::array<float,2>{0.188254327f, 0.9777354f},
-std::array<float,2>{0.932218611f, 0.307166457f},
-std::array<float,2>{0.997762859f, 0.724205613f},
-std::array<float,2>{0.175537661f, 0.162522078f},
-std::array<float,2>{0.477802694f, 0.798192918f},
-std::array<float,2>{0.641283274f, 0.428355396f},
-std::array<float,2>{0.543008387f, 0.905935645f},
-std::array<float,2>{0.295499116f, 0.373891592f},
-std::array<float,2>{0.108702511f, 0.516279519f},
-std::array<float,2>{0.810020566f, 0.069048591f},
-std::array<float,2>{0.885090709f, 0.946265221f},
-std::array<float,2>{0.240419269f, 0.269582689f},
-std::array<float,2>{0.4070566f, 0.610095859f},
-std::array<float,2>{0.708287656f, 0.041124396f},
-std::array<float,2>{0.577422619f, 0.669881642f},
-std::array<float,2>{0.317575008f, 0.203790054f},
-std::array<float,2>{0.0129200285f, 0.872603416f},
-std::array<float,2>{0.836201131f, 0.49005115f},
-std::array<float,2>{0.755451202f, 0.543362916f},
-std::array<float,2>{0.0642913431f, 0.114284478f},
-std::array<float,2>{0.278194696f, 0.915300727f},
-std::array<float,2>{0.528018594f, 0.343476474f},
-std::array<float,2>{0.667850554f, 0.780695677f},
-std::array<float,2>{0.444168687f, 0.396003753f},
-std::array<float,2>{0.129050538f, 0.701872528f},
-std::array<float,2>{0.959930241f, 0.140868947f},
-std::array<float,2>{0.929200888f, 0.866264939f},
-std::array<float,2>{0.196513042f, 0.497570217f},
-std::array<float,2>{0.402567476f, 0.658307016f},
-std::array<float,2>{0.723115325f, 0.217688665f},
-std::array<float,2>{0.607980788f, 0.619237125f},
-std::array<float,2>{0.361542553f, 0.038466379f},
-std::array<float,2>{0.0331902727f, 0.94151783f},
-std::array<float,2>{0.865016937f, 0.274179786f},
-std::array<float,2>{0.802311718f, 0.688032806f},
-std::array<float,2>{0.0945319831f, 0.15267469f},
-std::array<float,2>{0.284718394f, 0.766488791f},
-std::array<float,2>{0.534653902f, 0.400853455f},
-std::array<float,2>{0.65179044f, 0.907176971f},
-std::array<float,2>{0.47408551f, 0.333239913f},
-std::array<float,2>{0.183634326f, 0.534677029f},
-std::array<float,2>{0.989252806f, 0.119603917f},
-std::array<float,2>{0.834127426f, 0.969770491f},
-std::array<float,2>{0.00747468928f, 0.302115232f},
-std::array<float,2>{0.325145006f, 0.58074832f},
-std::array<float,2>{0.567564666f, 0.00744071417f},
-std::array<float,2>{0.711304426f, 0.64399606f},
-std::array<float,2>{0.415548176f, 0.230240077f},
-std::array<float,2>{0.248004705f, 0.834877849f},
-std::array<float,2>{0.881573558f, 0.459056795f},
-std::array<float,2>{0.968602002f, 0.527483165f},
-std::array<float,2>{0.133794501f, 0.0750014186f},
-std::array<float,2>{0.452114075f, 0.896724284f},
-std::array<float,2>{0.65650779f, 0.36522162f},
-std::array<float,2>{0.516992807f, 0.805279136f},
-std::array<float,2>{0.269667864f, 0.432510197f},
-std::array<float,2>{0.0741235837f, 0.731806636f},
-std::array<float,2>{0.757880807f, 0.164825901f},
-std::array<float,2>{0.770620584f, 0.762937844f},
-std::array<float,2>{0.0873967335f, 0.387542099f},
-std::array<float,2>{0.251580954f, 0.714317381f},
-std::array<float,2>{0.500484526f, 0.133873746f},
-std::array<float,2>{0.681706131f, 0.54933852f},
-std::array<float,2>{0.464974582f, 0.0964611173f},
-std::array<float,2>{0.150774866f, 0.924832284f},
-std::array<float,2>{0.949500859f, 0.322494984f},
-std::array<float,2>{0.902895927f, 0.675257027f},
-std::array<float,2>{0.223953098f, 0.194712996f},
-std::array<float,2>{0.427391499f, 0.849978268f},
-std::array<float,2>{0.694617391f, 0.477615446f},
-std::array<float,2>{0.581822217f, 0.957684636f},
-std::array<float,2>{0.328464448f, 0.260653168f},
-std::array<float,2>{0.0224467795f, 0.595247567f},
-std::array<float,2>{0.816461802f, 0.0529654659f},
-std::array<float,2>{0.971339524f, 0.883192837f},
-std::array<float,2>{0.164871782f, 0.351352632f},
-std::array<float,2>{0.494449437f, 0.502071202f},
-std::array<float,2>{0.625754595f, 0.0919204578f},
-std::array<float,2>{0.557200789f, 0.748006999f},
-std::array<float,2>{0.309144378f, 0.180120334f},
-std::array<float,2>{0.123137452f, 0.790170908f},
-std::array<float,2>{0.78629154f, 0.417954504f},
-std::array<float,2>{0.855211079f, 0.56688273f},
-std::array<float,2>{0.0487849824f, 0.0271903891f},
-std::array<float,2>{0.352497548f, 0.99060595f},
-std::array<float,2>{0.618914545f, 0.285761625f},
-std::array<float,2>{0.748720467f, 0.823348701f},
-std::array<float,2>{0.386337101f, 0.447825313f},
-std::array<float,2>{0.209430113f, 0.633710802f},
-std::array<float,2>{0.91621083f, 0.241553605f},
-std::array<float,2>{0.891604543f, 0.772424161f},
-std::array<float,2>{0.228658453f, 0.404781252f},
-std::array<float,2>{0.433763713f, 0.694982469f},
-std::array<float,2>{0.697970092f, 0.150005251f},
-std::array<float,2>{0.591421902f, 0.536346316f},
-std::array<float,2>{0.337331742f, 0.12315847f},
-std::array<float,2>{0.0293639489f, 0.911829293f},
-std::array<float,2>{0.825091958f, 0.328315884f},
-std::array<float,2>{0.775420904f, 0.662791491f},
-std::array<float,2>{0.0795966387f, 0.213087916f},
-std::array<float,2>{0.261921436f, 0.86258173f},
-std::array<float,2>{0.511939287f, 0.493671268f},
-std::array<float,2>{0.677816451f, 0.937566161f},
-std::array<float,2>{0.458554476f, 0.279604197f},
-std::array<float,2>{0.144758761f, 0.623719752f},
-std::array<float,2>{0.945002496f, 0.0336901657f},
-std::array<float,2>{0.848950803f, 0.891223967f},
-std::array<float,2>{0.0611803383f, 0.360046268f},
-std::array<float,2>{0.347980589f, 0.526861072f},
-std::array<float,2>{0.61256516f, 0.073840417f},
-std::array<float,2>{0.734889746f, 0.728506804f},
-std::array<float,2>{0.379736453f, 0.168926015f},
-std::array<float,2>{0.218324587f, 0.81091553f},
-std::array<float,2>{0.907397509f, 0.434455991f},
-std::array<float,2>{0.981450677f, 0.58413595f},
-std::array<float,2>{0.163937137f, 0.00204818929f},
-std::array<float,2>{0.488482833f, 0.976391137f},
-std::array<float,2>{0.637240946f, 0.298921794f},
-std::array<float,2>{0.551469326f, 0.828606486f},
-std::array<float,2>{0.298474014f, 0.456719697f},
-std::array<float,2>{0.110914961f, 0.64578712f},
-std::array<float,2>{0.793740809f, 0.234188676f},
-std::array<float,2>{0.807374299f, 0.846964717f},
-std::array<float,2>{0.103632286f, 0.483844429f},
-std::array<float,2>{0.291287601f, 0.676753879f},
-std::array<float,2>{0.541927934f, 0.190072879f},
-std::array<float,2>{0.645194769f, 0.600118697f},
-std::array<float,2>{0.482674509f, 0.0471700914f},
-std::array<float,2>{0.179489955f, 0.954148531f},
-std::array<float,2>{0.992336333f, 0.264293611f},
-std::array<float,2>{0.934554398f, 0.717333496f},
-std::array<float,2>{0.192442298f, 0.140544012f},
-std::array<float,2>{0.397041023f, 0.757972896f},
-std::array<float,2>{0.734151781f, 0.385148883f},
-std::array<float,2>{0.597383678f, 0.92680186f},
-std::array<float,2>{0.370651215f, 0.327263594f},
-std::array<float,2>{0.0399331823f, 0.553056836f},
-std::array<float,2>{0.873375356f, 0.0991606712f},
-std::array<float,2>{0.954582751f, 0.986530364f},
-std::array<float,2>{0.128774896f, 0.284611464f},
-std::array<float,2>{0.439785123f, 0.56500417f},
-std::array<float,2>{0.668667614f, 0.0282282047f},
-std::array<float,2>{0.525942445f, 0.638738871f},
-std::array<float,2>{0.274908304f, 0.235313222f},
-std::array<float,2>{0.0697804913f, 0.827064693f},
-std::array<float,2>{0.751675785f, 0.451883256f},
-std::array<float,2>{0.840683639f, 0.506420255f},
-std::array<float,2>{0.0113639319f, 0.088411577f},
-std::array<float,2>{0.314253002f, 0.889328301f},
-std::array<float,2>{0.572080135f, 0.346628934f},
-std::array<float,2>{0.70649904f, 0.792997658f},
-std::array<float,2>{0.412929803f, 0.42035532f},
-std::array<float,2>{0.236991391f, 0.742861331f},
-std::array<float,2>{0.889942706f, 0.184481889f},
-std::array<float,2>{0.987247348f, 0.816412449f},
-std::array<float,2>{0.182577074f, 0.439698339f},
-std::array<float,2>{0.469220549f, 0.629280925f},
-std::array<float,2>{0.653209329f, 0.244901747f},
-std::array<float,2>{0.535668731f, 0.575473487f},
-std::array<float,2>{0.286438048f, 0.0222916063f},
-std::array<float,2>{0.0999023691f, 0.997455537f},
-std::array<float,2>{0.799773514f, 0.290407032f},
-std::array<float,2>{0.861843705f, 0.741778553f},
-std::array<float,2>{0.0368247032f, 0.177853018f},
-std::array<float,2>{0.364149213f, 0.78804785f},
-std::array<float,2>{0.604513407f, 0.40838328f},
-std::array<float,2>{0.718815506f, 0.876068056f},
-std::array<float,2>{0.400537461f, 0.358165264f},
-std::array<float,2>{0.201109529f, 0.514406741f},
-std::array<float,2>{0.922014773f, 0.0822427869f},
-std::array<float,2>{0.763810456f, 0.961058795f},
-std::array<float,2>{0.0771938041f, 0.250606567f},
-std::array<float,2>{0.268152267f, 0.603660345f},
-std::array<float,2>{0.520441949f, 0.0577515885f},
-std::array<float,2>{0.662770152f, 0.683060944f},
-std::array<float,2>{0.449002147f, 0.196106002f},
-std::array<float,2>{0.139307022f, 0.851598203f},
-std::array<float,2>{0.961514771f, 0.474371195f},
-std::array<float,2>{0.875775456f, 0.557147086f},
-std::array<float,2>{0.245971113f, 0.104502559f},
-std::array<float,2>{0.418162584f, 0.93296665f},
-std::array<float,2>{0.718188941f, 0.319117695f},
-std::array<float,2>{0.562693119f, 0.751080215f},
-std::array<float,2>{0.320362628f, 0.378494471f},
-std::array<float,2>{8.81586129e-06f, 0.704901397f},
-std::array<float,2>{0.828668296f, 0.130800426f},
-std::array<float,2>{0.81632185f, 0.802712142f},
-std::array<float,2>{0.0170589853f, 0.42241171f},
-std::array<float,2>{0.333186448f, 0.719516456f},
-std::array<float,2>{0.583472788f, 0.156581968f},
-std::array<float,2>{0.688896596f, 0.521419823f},
-std::array<float,2>{0.422759682f, 0.0655322671f},
-std::array<float,2>{0.221667826f, 0.900267065f},
-std::array<float,2>{0.899046361f, 0.367432058f},
-std::array<float,2>{0.948445976f, 0.65184921f},
-std::array<float,2>{0.153255835f, 0.218847886f},
-std::array<float,2>{0.461904109f, 0.842059612f},
-std::array<float,2>{0.684369683f, 0.464603335f},
-std::array<float,2>{0.505589724f, 0.982683063f},
-std::array<float,2>{0.25402537f, 0.311555952f},
-std::array<float,2>{0.0924302489f, 0.592640936f},
-std::array<float,2>{0.767473936f, 0.00989232305f},
-std::array<float,2>{0.920112193f, 0.919220984f},
-std::array<float,2>{0.204213992f, 0.339537024f},
-std::array<float,2>{0.389982641f, 0.539902151f},
-std::array<float,2>{0.745296597f, 0.112369306f},
-std::array<float,2>{0.624884546f, 0.695987582f},
-std::array<float,2>{0.358731329f, 0.146478191f},
-std::array<float,2>{0.0538552925f, 0.774077952f},
-std::array<float,2>{0.857836902f, 0.391971707f},
-std::array<float,2>{0.784528434f, 0.616700292f},
-std::array<float,2>{0.119515225f, 0.0432705171f},
-std::array<float,2>{0.305621147f, 0.950174212f},
-std::array<float,2>{0.561837792f, 0.266010702f},
-std::array<float,2>{0.630591452f, 0.86908704f},
-std::array<float,2>{0.498187691f, 0.485712707f},
-std::array<float,2>{0.170075938f, 0.665021777f},
-std::array<float,2>{0.973057389f, 0.207165182f},
-std::array<float,2>{0.976945043f, 0.756701529f},
-std::array<float,2>{0.159373343f, 0.380190551f},
-std::array<float,2>{0.487067729f, 0.708574414f},
-std::array<float,2>{0.633343697f, 0.127819106f},
-std::array<float,2>{0.548754752f, 0.561607301f},
-std::array<float,2>{0.304127663f, 0.107085511f},
-std::array<float,2>{0.114768162f, 0.934140801f},
-std::array<float,2>{0.791182101f, 0.314159751f},
-std::array<float,2>{0.846476436f, 0.685189962f},
-std::array<float,2>{0.0548215881f, 0.199908853f},
-std::array<float,2>{0.345900625f, 0.857367337f},
-std::array<float,2>{0.613939881f, 0.471396565f},
-std::array<float,2>{0.739432633f, 0.965426862f},
-std::array<float,2>{0.375076234f, 0.254080474f},
-std::array<float,2>{0.213244826f, 0.607838511f},
-std::array<float,2>{0.912749708f, 0.0624971464f},
-std::array<float,2>{0.780232847f, 0.879263699f},
-std::array<float,2>{0.0831619352f, 0.353790641f},
-std::array<float,2>{0.259146839f, 0.509152055f},
-std::array<float,2>{0.51022923f, 0.080560118f},
-std::array<float,2>{0.672135115f, 0.737239361f},
-std::array<float,2>{0.456627309f, 0.175731957f},
-std::array<float,2>{0.143661454f, 0.782201469f},
-std::array<float,2>{0.941162646f, 0.412710935f},
-std::array<float,2>{0.897752047f, 0.57182169f},
-std::array<float,2>{0.233492538f, 0.0188360531f},
-std::array<float,2>{0.432535917f, 0.994347095f},
-std::array<float,2>{0.70298928f, 0.294475526f},
-std::array<float,2>{0.589173079f, 0.81529969f},
-std::array<float,2>{0.341709256f, 0.44363746f},
-std::array<float,2>{0.025374556f, 0.628188014f},
-std::array<float,2>{0.823588312f, 0.247258767f},
-std::array<float,2>{0.838194191f, 0.873927474f},
-std::array<float,2>{0.0152209289f, 0.491172314f},
-std::array<float,2>{0.320094377f, 0.670307577f},
-std::array<float,2>{0.575997114f, 0.205120832f},
-std::array<float,2>{0.710699022f, 0.611898899f},
-std::array<float,2>{0.408899277f, 0.0395538844f},
-std::array<float,2>{0.238760293f, 0.948638618f},
-std::array<float,2>{0.883201122f, 0.27183491f},
-std::array<float,2>{0.957746744f, 0.701009333f},
-std::array<float,2>{0.131619245f, 0.143328816f},
-std::array<float,2>{0.443137169f, 0.778315365f},
-std::array<float,2>{0.6660043f, 0.397999913f},
-std::array<float,2>{0.531236112f, 0.916719913f},
-std::array<float,2>{0.281070501f, 0.341606945f},
-std::array<float,2>{0.0661216602f, 0.546575546f},
-std::array<float,2>{0.756566703f, 0.116905272f},
-std::array<float,2>{0.929976225f, 0.97988236f},
-std::array<float,2>{0.191065103f, 0.305319756f},
-std::array<float,2>{0.393143326f, 0.589569867f},
-std::array<float,2>{0.728486598f, 0.0122685554f},
-std::array<float,2>{0.59867698f, 0.655030012f},
-std::array<float,2>{0.374731869f, 0.224967539f},
-std::array<float,2>{0.043042656f, 0.836816847f},
-std::array<float,2>{0.870452404f, 0.465955138f},
-std::array<float,2>{0.810816526f, 0.517888129f},
-std::array<float,2>{0.106789693f, 0.0675778612f},
-std::array<float,2>{0.294706523f, 0.902686477f},
-std::array<float,2>{0.546426177f, 0.371756762f},
-std::array<float,2>{0.643562019f, 0.800478697f},
-std::array<float,2>{0.479040235f, 0.426682323f},
-std::array<float,2>{0.173122391f, 0.726330101f},
-std::array<float,2>{0.998984993f, 0.160311475f},
-std::array<float,2>{0.87898314f, 0.833544135f},
-std::array<float,2>{0.249284178f, 0.457909673f},
-std::array<float,2>{0.417012185f, 0.642196417f},
-std::array<float,2>{0.714586198f, 0.22713235f},
-std::array<float,2>{0.569200695f, 0.578877866f},
-std::array<float,2>{0.326423585f, 0.00540890917f},
-std::array<float,2>{0.00456491206f, 0.971513212f},
-std::array<float,2>{0.833826721f, 0.304439455f},
-std::array<float,2>{0.761622727f, 0.733172655f},
-std::array<float,2>{0.0713437945f, 0.167540655f},
-std::array<float,2>{0.27195698f, 0.806913257f},
-std::array<float,2>{0.519527316f, 0.430494845f},
-std::array<float,2>{0.658813953f, 0.89454931f},
-std::array<float,2>{0.450173557f, 0.366913259f},
-std::array<float,2>{0.135896295f, 0.530530751f},
-std::array<float,2>{0.965587616f, 0.076540105f},
-std::array<float,2>{0.866342545f, 0.944198012f},
-std::array<float,2>{0.0345211253f, 0.276132882f},
-std::array<float,2>{0.361162543f, 0.618892133f},
-std::array<float,2>{0.606389165f, 0.0354825594f},
-std::array<float,2>{0.725740433f, 0.656565368f},
-std::array<float,2>{0.405803472f, 0.216683298f},
-std::array<float,2>{0.199212387f, 0.864701033f},
-std::array<float,2>{0.927730501f, 0.49861303f},
-std::array<float,2>{0.991621852f, 0.531714201f},
-std::array<float,2>{0.185823962f, 0.119077511f},
-std::array<float,2>{0.47543925f, 0.909270167f},
-std::array<float,2>{0.648776233f, 0.335935175f},
-std::array<float,2>{0.533195317f, 0.769248426f},
-std::array<float,2>{0.28181842f, 0.399613172f},
-std::array<float,2>{0.0959739462f, 0.690264523f},
-std::array<float,2>{0.803055644f, 0.155267462f},
-std::array<float,2>{0.788523138f, 0.791974425f},
-std::array<float,2>{0.121160805f, 0.414559633f},
-std::array<float,2>{0.31212908f, 0.748431981f},
-std::array<float,2>{0.554764152f, 0.183107361f},
-std::array<float,2>{0.627263665f, 0.501150012f},
-std::array<float,2>{0.49225089f, 0.091108501f},
-std::array<float,2>{0.167114511f, 0.88554889f},
-std::array<float,2>{0.970507801f, 0.348019004f},
-std::array<float,2>{0.915830374f, 0.63528347f},
-std::array<float,2>{0.207206577f, 0.238819465f},
-std::array<float,2>{0.384175926f, 0.821902394f},
-std::array<float,2>{0.747071326f, 0.445842594f},
-std::array<float,2>{0.620198429f, 0.988611877f},
-std::array<float,2>{0.353596449f, 0.288371921f},
-std::array<float,2>{0.0497735627f, 0.568614185f},
-std::array<float,2>{0.851751804f, 0.0248947255f},
-std::array<float,2>{0.952616096f, 0.923626781f},
-std::array<float,2>{0.148748443f, 0.320899695f},
-std::array<float,2>{0.467307121f, 0.547725499f},
-std::array<float,2>{0.680892766f, 0.0943842158f},
-std::array<float,2>{0.502016962f, 0.711568058f},
-std::array<float,2>{0.252911478f, 0.135695904f},
-std::array<float,2>{0.0880317912f, 0.764336169f},
-std::array<float,2>{0.773037314f, 0.390091568f},
-std::array<float,2>{0.818818033f, 0.595990121f},
-std::array<float,2>{0.0209294558f, 0.0515317023f},
-std::array<float,2>{0.33132568f, 0.959937513f},
-std::array<float,2>{0.579255223f, 0.258139789f},
-std::array<float,2>{0.692977548f, 0.849554718f},
-std::array<float,2>{0.429118395f, 0.479528666f},
-std::array<float,2>{0.225042656f, 0.673193693f},
-std::array<float,2>{0.904913068f, 0.193100467f},
-std::array<float,2>{0.909496367f, 0.810073555f},
-std::array<float,2>{0.215003401f, 0.43724829f},
-std::array<float,2>{0.381231457f, 0.729076028f},
-std::array<float,2>{0.736862957f, 0.170437127f},
-std::array<float,2>{0.60991466f, 0.523534775f},
-std::array<float,2>{0.350895703f, 0.0711081252f},
-std::array<float,2>{0.0594151132f, 0.893968344f},
-std::array<float,2>{0.849745333f, 0.362982422f},
-std::array<float,2>{0.79517287f, 0.646486402f},
-std::array<float,2>{0.111420229f, 0.232219726f},
-std::array<float,2>{0.300130814f, 0.831552625f},
-std::array<float,2>{0.554429233f, 0.453950673f},
-std::array<float,2>{0.639206052f, 0.974043906f},
-std::array<float,2>{0.491550654f, 0.296904385f},
-std::array<float,2>{0.161856011f, 0.582219303f},
-std::array<float,2>{0.982822597f, 0.000337371748f},
-std::array<float,2>{0.826340973f, 0.912554264f},
-std::array<float,2>{0.0292149317f, 0.331167132f},
-std::array<float,2>{0.33811298f, 0.538251817f},
-std::array<float,2>{0.592696726f, 0.122636169f},
-std::array<float,2>{0.697068572f, 0.692343652f},
-std::array<float,2>{0.43748951f, 0.151302397f},
-std::array<float,2>{0.227709949f, 0.770449042f},
-std::array<float,2>{0.892766714f, 0.403360754f},
-std::array<float,2>{0.941498518f, 0.621444702f},
-std::array<float,2>{0.147044107f, 0.0318311341f},
-std::array<float,2>{0.460307986f, 0.940628111f},
-std::array<float,2>{0.67760098f, 0.278631538f},
-std::array<float,2>{0.514526486f, 0.86004442f},
-std::array<float,2>{0.264051735f, 0.495038509f},
-std::array<float,2>{0.0809414014f, 0.660653412f},
-std::array<float,2>{0.77429688f, 0.212587014f},
-std::array<float,2>{0.752593219f, 0.825663209f},
-std::array<float,2>{0.0664921924f, 0.449452668f},
-std::array<float,2>{0.277007371f, 0.637772441f},
-std::array<float,2>{0.523680568f, 0.236751899f},
-std::array<float,2>{0.670916736f, 0.563071132f},
-std::array<float,2>{0.439124674f, 0.0295604356f},
-std::array<float,2>{0.125443786f, 0.98552227f},
-std::array<float,2>{0.956061602f, 0.282230854f},
-std::array<float,2>{0.887997746f, 0.745672166f},
-std::array<float,2>{0.235735282f, 0.185825095f},
-std::array<float,2>{0.411274195f, 0.794941485f},
-std::array<float,2>{0.703413963f, 0.419079542f},
-std::array<float,2>{0.573387861f, 0.888115048f},
-std::array<float,2>{0.316162884f, 0.344176054f},
-std::array<float,2>{0.00905432459f, 0.505046308f},
-std::array<float,2>{0.843706429f, 0.0866223946f},
-std::array<float,2>{0.996057153f, 0.956397414f},
-std::array<float,2>{0.175808325f, 0.263025165f},
-std::array<float,2>{0.481629372f, 0.599348783f},
-std::array<float,2>{0.646868646f, 0.0503177531f},
-std::array<float,2>{0.540148079f, 0.67961055f},
-std::array<float,2>{0.28963089f, 0.187944695f},
-std::array<float,2>{0.102254815f, 0.84511596f},
-std::array<float,2>{0.805485487f, 0.481789112f},
-std::array<float,2>{0.871847868f, 0.550795257f},
-std::array<float,2>{0.0425307341f, 0.0998907164f},
-std::array<float,2>{0.368189812f, 0.928918839f},
-std::array<float,2>{0.593849778f, 0.324430674f},
-std::array<float,2>{0.730923831f, 0.760231853f},
-std::array<float,2>{0.39514783f, 0.383600801f},
-std::array<float,2>{0.194630712f, 0.716764808f},
-std::array<float,2>{0.937297761f, 0.137000367f},
-std::array<float,2>{0.964447439f, 0.855268657f},
-std::array<float,2>{0.136882603f, 0.476391464f},
-std::array<float,2>{0.446530908f, 0.679850817f},
-std::array<float,2>{0.661242783f, 0.197563425f},
-std::array<float,2>{0.521574557f, 0.603244007f},
-std::array<float,2>{0.266198188f, 0.0547584072f},
-std::array<float,2>{0.0744239166f, 0.96443969f},
-std::array<float,2>{0.76292038f, 0.252709985f},
-std::array<float,2>{0.831327915f, 0.705924273f},
-std::array<float,2>{0.00227850117f, 0.13265796f},
-std::array<float,2>{0.323526382f, 0.752886832f},
-std::array<float,2>{0.565792263f, 0.376087695f},
-std::array<float,2>{0.715064764f, 0.930110276f},
-std::array<float,2>{0.420462161f, 0.317568332f},
-std::array<float,2>{0.243945971f, 0.555556655f},
-std::array<float,2>{0.87878418f, 0.101989917f},
-std::array<float,2>{0.797769129f, 0.999233365f},
-std::array<float,2>{0.0977794454f, 0.292638481f},
-std::array<float,2>{0.287461936f, 0.577880979f},
-std::array<float,2>{0.537387073f, 0.0200616717f},
-std::array<float,2>{0.654821873f, 0.632137537f},
-std::array<float,2>{0.472167462f, 0.242518514f},
-std::array<float,2>{0.180659324f, 0.819056273f},
-std::array<float,2>{0.984462619f, 0.439325601f},
-std::array<float,2>{0.925686181f, 0.512788057f},
-std::array<float,2>{0.201784134f, 0.0852559581f},
-std::array<float,2>{0.400188565f, 0.877132475f},
-std::array<float,2>{0.720849156f, 0.35719797f},
-std::array<float,2>{0.603450537f, 0.785854697f},
-std::array<float,2>{0.365631491f, 0.406962305f},
-std::array<float,2>{0.0371498838f, 0.738529444f},
-std::array<float,2>{0.860813856f, 0.17755723f},
-std::array<float,2>{0.855615616f, 0.77635169f},
-std::array<float,2>{0.0518246181f, 0.394394487f},
-std::array<float,2>{0.355870068f, 0.698433101f},
-std::array<float,2>{0.621929049f, 0.146572381f},
-std::array<float,2>{0.743382692f, 0.541159272f},
-std::array<float,2>{0.38716653f, 0.110031858f},
-std::array<float,2>{0.2056254f, 0.920720041f},
-std::array<float,2>{0.918218911f, 0.337236404f},
-std::array<float,2>{0.975772321f, 0.666257083f},
-std::array<float,2>{0.169267625f, 0.209912121f},
-std::array<float,2>{0.497341216f, 0.870059967f},
-std::array<float,2>{0.63095814f, 0.487556249f},
-std::array<float,2>{0.559939981f, 0.952355266f},
-std::array<float,2>{0.307830065f, 0.269261301f},
-std::array<float,2>{0.11875996f, 0.613432169f},
-std::array<float,2>{0.782136619f, 0.0463800207f},
-std::array<float,2>{0.902117252f, 0.901072681f},
-std::array<float,2>{0.219903126f, 0.370613813f},
-std::array<float,2>{0.425307333f, 0.522666514f},
-std::array<float,2>{0.691238284f, 0.063948825f},
-std::array<float,2>{0.584566951f, 0.722053766f},
-std::array<float,2>{0.334220409f, 0.159420773f},
-std::array<float,2>{0.0187740047f, 0.80450666f},
-std::array<float,2>{0.814276278f, 0.424240679f},
-std::array<float,2>{0.76928556f, 0.590287328f},
-std::array<float,2>{0.0901990086f, 0.00883401372f},
-std::array<float,2>{0.256785959f, 0.981060863f},
-std::array<float,2>{0.506522954f, 0.308773458f},
-std::array<float,2>{0.686030149f, 0.84029305f},
-std::array<float,2>{0.464746416f, 0.462747127f},
-std::array<float,2>{0.15466851f, 0.650141597f},
-std::array<float,2>{0.947137952f, 0.22207281f},
-std::array<float,2>{0.970113397f, 0.790985167f},
-std::array<float,2>{0.167736247f, 0.417267054f},
-std::array<float,2>{0.493126035f, 0.74735111f},
-std::array<float,2>{0.627847075f, 0.180192128f},
-std::array<float,2>{0.555237472f, 0.502853155f},
-std::array<float,2>{0.311849833f, 0.0926126689f},
-std::array<float,2>{0.121896394f, 0.883339226f},
-std::array<float,2>{0.788750768f, 0.350626945f},
-std::array<float,2>{0.852322221f, 0.633238018f},
-std::array<float,2>{0.0491328612f, 0.241874769f},
-std::array<float,2>{0.35430333f, 0.823803425f},
-std::array<float,2>{0.620729446f, 0.447368801f},
-std::array<float,2>{0.747930229f, 0.991128266f},
-std::array<float,2>{0.384618998f, 0.285488069f},
-std::array<float,2>{0.207895055f, 0.567206323f},
-std::array<float,2>{0.915229321f, 0.0267678238f},
-std::array<float,2>{0.772656679f, 0.925644815f},
-std::array<float,2>{0.0886231288f, 0.323116153f},
-std::array<float,2>{0.252423108f, 0.549114406f},
-std::array<float,2>{0.502848864f, 0.0959646702f},
-std::array<float,2>{0.681491077f, 0.714662254f},
-std::array<float,2>{0.467079401f, 0.134288728f},
-std::array<float,2>{0.149346396f, 0.763610423f},
-std::array<float,2>{0.953060448f, 0.38692537f},
-std::array<float,2>{0.904304504f, 0.595211327f},
-std::array<float,2>{0.225327373f, 0.0536412746f},
-std::array<float,2>{0.429669052f, 0.957099617f},
-std::array<float,2>{0.692628264f, 0.259852409f},
-std::array<float,2>{0.579654932f, 0.850575149f},
-std::array<float,2>{0.331997335f, 0.47847715f},
-std::array<float,2>{0.021187067f, 0.67558527f},
-std::array<float,2>{0.81904155f, 0.19522582f},
-std::array<float,2>{0.833436608f, 0.834391952f},
-std::array<float,2>{0.00402574614f, 0.459571362f},
-std::array<float,2>{0.326799423f, 0.644144893f},
-std::array<float,2>{0.568764448f, 0.229731381f},
-std::array<float,2>{0.7139377f, 0.580277562f},
-std::array<float,2>{0.417589754f, 0.00715962099f},
-std::array<float,2>{0.249889016f, 0.97064954f},
-std::array<float,2>{0.879596651f, 0.302371532f},
-std::array<float,2>{0.965196908f, 0.732059419f},
-std::array<float,2>{0.136465445f, 0.164279237f},
-std::array<float,2>{0.449426442f, 0.804993927f},
-std::array<float,2>{0.658284903f, 0.432095408f},
-std::array<float,2>{0.518588305f, 0.896988988f},
-std::array<float,2>{0.272171468f, 0.364657611f},
-std::array<float,2>{0.0720509589f, 0.528162181f},
-std::array<float,2>{0.761140883f, 0.0745404065f},
-std::array<float,2>{0.926813841f, 0.941935539f},
-std::array<float,2>{0.198663041f, 0.273728788f},
-std::array<float,2>{0.405445397f, 0.619863629f},
-std::array<float,2>{0.726227045f, 0.0386778675f},
-std::array<float,2>{0.605641901f, 0.658802867f},
-std::array<float,2>{0.360356271f, 0.217267379f},
-std::array<float,2>{0.0347222462f, 0.866788447f},
-std::array<float,2>{0.866778791f, 0.497461289f},
-std::array<float,2>{0.803489685f, 0.534318566f},
-std::array<float,2>{0.0963739604f, 0.119668521f},
-std::array<float,2>{0.281738073f, 0.90666002f},
-std::array<float,2>{0.532661736f, 0.333556473f},
-std::array<float,2>{0.649072766f, 0.766082287f},
-std::array<float,2>{0.474840581f, 0.400951415f},
-std::array<float,2>{0.186201006f, 0.687551141f},
-std::array<float,2>{0.992070794f, 0.152978688f},
-std::array<float,2>{0.883464813f, 0.872119844f},
-std::array<float,2>{0.239011765f, 0.489408463f},
-std::array<float,2>{0.408281177f, 0.669044673f},
-std::array<float,2>{0.710240364f, 0.203391656f},
-std::array<float,2>{0.575196028f, 0.60978204f},
-std::array<float,2>{0.319745362f, 0.0415925682f},
-std::array<float,2>{0.0151082631f, 0.945536196f},
-std::array<float,2>{0.838689625f, 0.270252556f},
-std::array<float,2>{0.755994439f, 0.701657236f},
-std::array<float,2>{0.0658603758f, 0.141124859f},
-std::array<float,2>{0.280643135f, 0.780914783f},
-std::array<float,2>{0.530674279f, 0.395854503f},
-std::array<float,2>{0.665150702f, 0.915648282f},
-std::array<float,2>{0.442677587f, 0.343213528f},
-std::array<float,2>{0.131031528f, 0.543832362f},
-std::array<float,2>{0.957402885f, 0.114881881f},
-std::array<float,2>{0.870779037f, 0.978027403f},
-std::array<float,2>{0.0437904671f, 0.306735843f},
-std::array<float,2>{0.374150306f, 0.587875068f},
-std::array<float,2>{0.599132538f, 0.0145179732f},
-std::array<float,2>{0.727920115f, 0.652434647f},
-std::array<float,2>{0.392663062f, 0.223491222f},
-std::array<float,2>{0.190886989f, 0.838849187f},
-std::array<float,2>{0.930523098f, 0.467911243f},
-std::array<float,2>{0.99844873f, 0.515945435f},
-std::array<float,2>{0.173781171f, 0.0687673911f},
-std::array<float,2>{0.478776246f, 0.905331373f},
-std::array<float,2>{0.644312739f, 0.373192608f},
-std::array<float,2>{0.54595387f, 0.798649251f},
-std::array<float,2>{0.293953329f, 0.427856117f},
-std::array<float,2>{0.10735961f, 0.724120259f},
-std::array<float,2>{0.811363161f, 0.162615031f},
-std::array<float,2>{0.791536391f, 0.754205942f},
-std::array<float,2>{0.114709362f, 0.381417483f},
-std::array<float,2>{0.30436644f, 0.709616363f},
-std::array<float,2>{0.548190415f, 0.126403213f},
-std::array<float,2>{0.633292139f, 0.559604168f},
-std::array<float,2>{0.486356735f, 0.108893946f},
-std::array<float,2>{0.160062149f, 0.936947405f},
-std::array<float,2>{0.977185488f, 0.314684033f},
-std::array<float,2>{0.912392974f, 0.686616242f},
-std::array<float,2>{0.213380411f, 0.202717602f},
-std::array<float,2>{0.375865817f, 0.857525349f},
-std::array<float,2>{0.739950001f, 0.469091713f},
-std::array<float,2>{0.613567829f, 0.967204452f},
-std::array<float,2>{0.346604258f, 0.257348806f},
-std::array<float,2>{0.0554036498f, 0.606372237f},
-std::array<float,2>{0.846102595f, 0.0588527359f},
-std::array<float,2>{0.940464675f, 0.881971955f},
-std::array<float,2>{0.144165292f, 0.352215111f},
-std::array<float,2>{0.45613873f, 0.509849608f},
-std::array<float,2>{0.672798514f, 0.0791583881f},
-std::array<float,2>{0.510322034f, 0.734929621f},
-std::array<float,2>{0.259728372f, 0.173548386f},
-std::array<float,2>{0.0838468149f, 0.783922255f},
-std::array<float,2>{0.779298007f, 0.410736471f},
-std::array<float,2>{0.823837638f, 0.5736323f},
-std::array<float,2>{0.0248959921f, 0.0162071735f},
-std::array<float,2>{0.341042221f, 0.993442655f},
-std::array<float,2>{0.589782238f, 0.296289325f},
-std::array<float,2>{0.702190876f, 0.812599838f},
-std::array<float,2>{0.431907147f, 0.44300586f},
-std::array<float,2>{0.234129623f, 0.626663029f},
-std::array<float,2>{0.898371041f, 0.24810566f},
-std::array<float,2>{0.918573081f, 0.77372551f},
-std::array<float,2>{0.205340326f, 0.392446727f},
-std::array<float,2>{0.387631178f, 0.69573772f},
-std::array<float,2>{0.744034886f, 0.145553872f},
-std::array<float,2>{0.62127012f, 0.539528906f},
-std::array<float,2>{0.356246859f, 0.113214225f},
-std::array<float,2>{0.0523690581f, 0.919837594f},
-std::array<float,2>{0.856098473f, 0.33918187f},
-std::array<float,2>{0.781315923f, 0.664231002f},
-std::array<float,2>{0.118460357f, 0.20776245f},
-std::array<float,2>{0.30817017f, 0.868370295f},
-std::array<float,2>{0.560180426f, 0.485981762f},
-std::array<float,2>{0.631759465f, 0.94969207f},
-std::array<float,2>{0.498018682f, 0.266474903f},
-std::array<float,2>{0.169772074f, 0.616622806f},
-std::array<float,2>{0.976526141f, 0.0435617045f},
-std::array<float,2>{0.813820601f, 0.899862051f},
-std::array<float,2>{0.0192009695f, 0.367689222f},
-std::array<float,2>{0.334639907f, 0.520559192f},
-std::array<float,2>{0.584202409f, 0.066170752f},
-std::array<float,2>{0.690859616f, 0.718798518f},
-std::array<float,2>{0.425154239f, 0.156917229f},
-std::array<float,2>{0.220261499f, 0.801903129f},
-std::array<float,2>{0.901382267f, 0.422216386f},
-std::array<float,2>{0.94670552f, 0.59198761f},
-std::array<float,2>{0.154981062f, 0.0103873592f},
-std::array<float,2>{0.464355379f, 0.983299434f},
-std::array<float,2>{0.686135113f, 0.312336981f},
-std::array<float,2>{0.506205797f, 0.842664897f},
-std::array<float,2>{0.256145626f, 0.463995248f},
-std::array<float,2>{0.0903860256f, 0.651909828f},
-std::array<float,2>{0.768706143f, 0.219402611f},
-std::array<float,2>{0.763585746f, 0.852167249f},
-std::array<float,2>{0.0750879049f, 0.473932892f},
-std::array<float,2>{0.265860468f, 0.683266759f},
-std::array<float,2>{0.522389591f, 0.195437387f},
-std::array<float,2>{0.661718726f, 0.604260564f},
-std::array<float,2>{0.446805865f, 0.058519911f},
-std::array<float,2>{0.137282923f, 0.961856067f},
-std::array<float,2>{0.96397537f, 0.250422746f},
-std::array<float,2>{0.878051519f, 0.704199076f},
-std::array<float,2>{0.243562937f, 0.129924059f},
-std::array<float,2>{0.420071393f, 0.751820385f},
-std::array<float,2>{0.715374887f, 0.378103584f},
-std::array<float,2>{0.566291034f, 0.93312043f},
-std::array<float,2>{0.324175596f, 0.318802774f},
-std::array<float,2>{0.00254214369f, 0.556695879f},
-std::array<float,2>{0.831854224f, 0.105419323f},
-std::array<float,2>{0.985224485f, 0.997988701f},
-std::array<float,2>{0.180033818f, 0.290866643f},
-std::array<float,2>{0.472368658f, 0.57606256f},
-std::array<float,2>{0.654687762f, 0.0218861979f},
-std::array<float,2>{0.537645996f, 0.629428446f},
-std::array<float,2>{0.287748694f, 0.244420663f},
-std::array<float,2>{0.0985060856f, 0.81728518f},
-std::array<float,2>{0.797242999f, 0.439961731f},
-std::array<float,2>{0.861002505f, 0.513789475f},
-std::array<float,2>{0.0379872024f, 0.0829489902f},
-std::array<float,2>{0.365973949f, 0.876720369f},
-std::array<float,2>{0.602844059f, 0.357822061f},
-std::array<float,2>{0.721618176f, 0.787278056f},
-std::array<float,2>{0.399437875f, 0.408743769f},
-std::array<float,2>{0.20150134f, 0.741417587f},
-std::array<float,2>{0.924851418f, 0.178542912f},
-std::array<float,2>{0.956774652f, 0.826187074f},
-std::array<float,2>{0.125493139f, 0.451474398f},
-std::array<float,2>{0.438827455f, 0.639561534f},
-std::array<float,2>{0.671649933f, 0.234843448f},
-std::array<float,2>{0.524285018f, 0.564653933f},
-std::array<float,2>{0.276521742f, 0.0277858246f},
-std::array<float,2>{0.0670262799f, 0.986843586f},
-std::array<float,2>{0.752300918f, 0.284719199f},
-std::array<float,2>{0.843012393f, 0.742242575f},
-std::array<float,2>{0.00957272761f, 0.183878198f},
-std::array<float,2>{0.315537453f, 0.79369688f},
-std::array<float,2>{0.573781848f, 0.42086333f},
-std::array<float,2>{0.703684926f, 0.888868153f},
-std::array<float,2>{0.412100762f, 0.345860809f},
-std::array<float,2>{0.235908031f, 0.506264389f},
-std::array<float,2>{0.888477623f, 0.0882698298f},
-std::array<float,2>{0.804826438f, 0.954601824f},
-std::array<float,2>{0.101950929f, 0.263676494f},
-std::array<float,2>{0.289462656f, 0.600087047f},
-std::array<float,2>{0.540856183f, 0.0477895252f},
-std::array<float,2>{0.647281885f, 0.67615205f},
-std::array<float,2>{0.482311457f, 0.189696699f},
-std::array<float,2>{0.176342711f, 0.847316802f},
-std::array<float,2>{0.995239079f, 0.484004468f},
-std::array<float,2>{0.936637044f, 0.553511083f},
-std::array<float,2>{0.195207819f, 0.0986679867f},
-std::array<float,2>{0.394858152f, 0.927508056f},
-std::array<float,2>{0.73130995f, 0.327831239f},
-std::array<float,2>{0.594246149f, 0.758705378f},
-std::array<float,2>{0.368687809f, 0.385510176f},
-std::array<float,2>{0.0420439132f, 0.717205286f},
-std::array<float,2>{0.87127018f, 0.14008984f},
-std::array<float,2>{0.850183427f, 0.811465859f},
-std::array<float,2>{0.0587872416f, 0.433671832f},
-std::array<float,2>{0.351373345f, 0.727634668f},
-std::array<float,2>{0.609563172f, 0.168401703f},
-std::array<float,2>{0.736747622f, 0.526821017f},
-std::array<float,2>{0.381694794f, 0.0732545033f},
-std::array<float,2>{0.215620711f, 0.890786171f},
-std::array<float,2>{0.909973383f, 0.359420538f},
-std::array<float,2>{0.983178079f, 0.646473408f},
-std::array<float,2>{0.161588207f, 0.233763218f},
-std::array<float,2>{0.491968513f, 0.828971088f},
-std::array<float,2>{0.638774872f, 0.456091166f},
-std::array<float,2>{0.554023564f, 0.975981295f},
-std::array<float,2>{0.300547391f, 0.299409121f},
-std::array<float,2>{0.112264425f, 0.584555805f},
-std::array<float,2>{0.795627058f, 0.00252011977f},
-std::array<float,2>{0.893113256f, 0.911175966f},
-std::array<float,2>{0.228231028f, 0.328949273f},
-std::array<float,2>{0.436742932f, 0.53681767f},
-std::array<float,2>{0.696718276f, 0.123973846f},
-std::array<float,2>{0.592214227f, 0.694404721f},
-std::array<float,2>{0.338701278f, 0.14960742f},
-std::array<float,2>{0.0287437532f, 0.771679103f},
-std::array<float,2>{0.826747656f, 0.40519011f},
-std::array<float,2>{0.773497045f, 0.62337184f},
-std::array<float,2>{0.0800964087f, 0.0338384807f},
-std::array<float,2>{0.264365643f, 0.938287675f},
-std::array<float,2>{0.513834715f, 0.279925108f},
-std::array<float,2>{0.676861823f, 0.862891078f},
-std::array<float,2>{0.460907042f, 0.493594646f},
-std::array<float,2>{0.14663519f, 0.662463784f},
-std::array<float,2>{0.942188144f, 0.213699907f},
-std::array<float,2>{0.950151145f, 0.763958454f},
-std::array<float,2>{0.151278362f, 0.390476376f},
-std::array<float,2>{0.465439558f, 0.711105168f},
-std::array<float,2>{0.68229723f, 0.135017186f},
-std::array<float,2>{0.500877976f, 0.547163963f},
-std::array<float,2>{0.251133561f, 0.0939685777f},
-std::array<float,2>{0.0877808183f, 0.923214674f},
-std::array<float,2>{0.771310329f, 0.320353419f},
-std::array<float,2>{0.817103803f, 0.673754752f},
-std::array<float,2>{0.0216046441f, 0.192386776f},
-std::array<float,2>{0.329051197f, 0.848705649f},
-std::array<float,2>{0.581433475f, 0.480283588f},
-std::array<float,2>{0.695174098f, 0.959077537f},
-std::array<float,2>{0.426841944f, 0.258482009f},
-std::array<float,2>{0.224530399f, 0.596559227f},
-std::array<float,2>{0.902455509f, 0.0511028692f},
-std::array<float,2>{0.786631823f, 0.885012209f},
-std::array<float,2>{0.123680882f, 0.348520964f},
-std::array<float,2>{0.308797598f, 0.501540244f},
-std::array<float,2>{0.556731343f, 0.0916234627f},
-std::array<float,2>{0.625344753f, 0.748922527f},
-std::array<float,2>{0.494671434f, 0.182995483f},
-std::array<float,2>{0.164220899f, 0.791421473f},
-std::array<float,2>{0.97093606f, 0.414087117f},
-std::array<float,2>{0.916777909f, 0.569017828f},
-std::array<float,2>{0.209709689f, 0.0250840876f},
-std::array<float,2>{0.386029363f, 0.989170909f},
-std::array<float,2>{0.748215735f, 0.288663387f},
-std::array<float,2>{0.618261755f, 0.821548998f},
-std::array<float,2>{0.35184741f, 0.445796609f},
-std::array<float,2>{0.0479912646f, 0.635246158f},
-std::array<float,2>{0.854617476f, 0.238639474f},
-std::array<float,2>{0.864479125f, 0.865037978f},
-std::array<float,2>{0.0325851664f, 0.498339444f},
-std::array<float,2>{0.362057656f, 0.65717262f},
-std::array<float,2>{0.607813478f, 0.216014311f},
-std::array<float,2>{0.723555446f, 0.618434191f},
-std::array<float,2>{0.403265983f, 0.0358224995f},
-std::array<float,2>{0.196993977f, 0.943609476f},
-std::array<float,2>{0.92874521f, 0.275873899f},
-std::array<float,2>{0.988571465f, 0.689811289f},
-std::array<float,2>{0.184418157f, 0.154452071f},
-std::array<float,2>{0.474165678f, 0.768831491f},
-std::array<float,2>{0.652191341f, 0.400233597f},
-std::array<float,2>{0.535086155f, 0.910127044f},
-std::array<float,2>{0.284203738f, 0.335174352f},
-std::array<float,2>{0.0937895253f, 0.531911373f},
-std::array<float,2>{0.801829755f, 0.118241146f},
-std::array<float,2>{0.881061673f, 0.971044362f},
-std::array<float,2>{0.247378558f, 0.30387947f},
-std::array<float,2>{0.415221363f, 0.578609288f},
-std::array<float,2>{0.711568534f, 0.00526761403f},
-std::array<float,2>{0.568228781f, 0.64178288f},
-std::array<float,2>{0.324490964f, 0.226983786f},
-std::array<float,2>{0.0071125133f, 0.833081841f},
-std::array<float,2>{0.83457607f, 0.457449496f},
-std::array<float,2>{0.758575797f, 0.53113693f},
-std::array<float,2>{0.0735694245f, 0.0767955408f},
-std::array<float,2>{0.270402759f, 0.895395458f},
-std::array<float,2>{0.517370939f, 0.366608769f},
-std::array<float,2>{0.656810462f, 0.807345331f},
-std::array<float,2>{0.45125553f, 0.430061489f},
-std::array<float,2>{0.134336263f, 0.732548892f},
-std::array<float,2>{0.967899144f, 0.167362064f},
-std::array<float,2>{0.931724012f, 0.836254776f},
-std::array<float,2>{0.187544033f, 0.466680288f},
-std::array<float,2>{0.392254561f, 0.654447317f},
-std::array<float,2>{0.729496479f, 0.225113437f},
-std::array<float,2>{0.601396024f, 0.588990629f},
-std::array<float,2>{0.372676075f, 0.0119566899f},
-std::array<float,2>{0.0462911129f, 0.980275869f},
-std::array<float,2>{0.868322194f, 0.304788142f},
-std::array<float,2>{0.810508907f, 0.725774944f},
-std::array<float,2>{0.109244056f, 0.160938606f},
-std::array<float,2>{0.295166552f, 0.799888372f},
-std::array<float,2>{0.543871939f, 0.426169276f},
-std::array<float,2>{0.641055226f, 0.903092086f},
-std::array<float,2>{0.478042036f, 0.371248722f},
-std::array<float,2>{0.175100923f, 0.518482745f},
-std::array<float,2>{0.997175992f, 0.0678805783f},
-std::array<float,2>{0.836837053f, 0.948755741f},
-std::array<float,2>{0.0135985445f, 0.272034645f},
-std::array<float,2>{0.318126827f, 0.611534357f},
-std::array<float,2>{0.577880025f, 0.0394009016f},
-std::array<float,2>{0.708831429f, 0.670714498f},
-std::array<float,2>{0.406414062f, 0.206044868f},
-std::array<float,2>{0.241204768f, 0.873342633f},
-std::array<float,2>{0.885605752f, 0.490310729f},
-std::array<float,2>{0.959256589f, 0.546303451f},
-std::array<float,2>{0.129628181f, 0.116358995f},
-std::array<float,2>{0.44378823f, 0.916349828f},
-std::array<float,2>{0.667429566f, 0.341056496f},
-std::array<float,2>{0.52752918f, 0.777432561f},
-std::array<float,2>{0.277394712f, 0.397543997f},
-std::array<float,2>{0.0638739318f, 0.700420499f},
-std::array<float,2>{0.7551893f, 0.143057913f},
-std::array<float,2>{0.778069675f, 0.781267822f},
-std::array<float,2>{0.0857725218f, 0.412461013f},
-std::array<float,2>{0.260001928f, 0.736663818f},
-std::array<float,2>{0.509068131f, 0.175242007f},
-std::array<float,2>{0.675093174f, 0.509351671f},
-std::array<float,2>{0.454556346f, 0.0806578323f},
-std::array<float,2>{0.141898736f, 0.879692137f},
-std::array<float,2>{0.93923384f, 0.354333103f},
-std::array<float,2>{0.895117104f, 0.62868011f},
-std::array<float,2>{0.231319696f, 0.247909963f},
-std::array<float,2>{0.43093735f, 0.814652443f},
-std::array<float,2>{0.701068103f, 0.444036961f},
-std::array<float,2>{0.587253034f, 0.994675934f},
-std::array<float,2>{0.343204409f, 0.294005543f},
-std::array<float,2>{0.0264534745f, 0.571354747f},
-std::array<float,2>{0.821973383f, 0.0191234574f},
-std::array<float,2>{0.978809774f, 0.9338274f},
-std::array<float,2>{0.156840548f, 0.31385681f},
-std::array<float,2>{0.4854725f, 0.562313735f},
-std::array<float,2>{0.636410236f, 0.106733739f},
-std::array<float,2>{0.548994482f, 0.708330154f},
-std::array<float,2>{0.302731037f, 0.127242059f},
-std::array<float,2>{0.116274245f, 0.756171107f},
-std::array<float,2>{0.790215969f, 0.380735815f},
-std::array<float,2>{0.844153225f, 0.607957602f},
-std::array<float,2>{0.0581871346f, 0.0615748018f},
-std::array<float,2>{0.344635516f, 0.964864492f},
-std::array<float,2>{0.615456522f, 0.254611343f},
-std::array<float,2>{0.742122531f, 0.856729686f},
-std::array<float,2>{0.37819925f, 0.470823646f},
-std::array<float,2>{0.212734655f, 0.684720278f},
-std::array<float,2>{0.910470784f, 0.199619889f},
-std::array<float,2>{0.898794234f, 0.803759992f},
-std::array<float,2>{0.220818833f, 0.424358517f},
-std::array<float,2>{0.422050118f, 0.722537279f},
-std::array<float,2>{0.68940264f, 0.159888566f},
-std::array<float,2>{0.583676636f, 0.523015618f},
-std::array<float,2>{0.333634198f, 0.0641292632f},
-std::array<float,2>{0.0173848346f, 0.900873005f},
-std::array<float,2>{0.815737367f, 0.37022832f},
-std::array<float,2>{0.766938686f, 0.649806142f},
-std::array<float,2>{0.0918773487f, 0.222548008f},
-std::array<float,2>{0.254679352f, 0.840381086f},
-std::array<float,2>{0.505279303f, 0.462138236f},
-std::array<float,2>{0.684006035f, 0.980626047f},
-std::array<float,2>{0.461194813f, 0.309518576f},
-std::array<float,2>{0.15282163f, 0.590598166f},
-std::array<float,2>{0.94895494f, 0.00972193386f},
-std::array<float,2>{0.858244359f, 0.920178831f},
-std::array<float,2>{0.0543842092f, 0.337602168f},
-std::array<float,2>{0.359343261f, 0.54165566f},
-std::array<float,2>{0.62445575f, 0.109830625f},
-std::array<float,2>{0.745830715f, 0.698841214f},
-std::array<float,2>{0.390150547f, 0.147009805f},
-std::array<float,2>{0.20459725f, 0.775657475f},
-std::array<float,2>{0.920546532f, 0.393994629f},
-std::array<float,2>{0.973146319f, 0.614106655f},
-std::array<float,2>{0.170428231f, 0.0465450212f},
-std::array<float,2>{0.498942971f, 0.952692807f},
-std::array<float,2>{0.629944086f, 0.269030988f},
-std::array<float,2>{0.562435627f, 0.86947f},
-std::array<float,2>{0.30485788f, 0.488195866f},
-std::array<float,2>{0.119734585f, 0.666680753f},
-std::array<float,2>{0.78500843f, 0.209324583f},
-std::array<float,2>{0.798832595f, 0.818587184f},
-std::array<float,2>{0.100523449f, 0.438726038f},
-std::array<float,2>{0.28680566f, 0.632539153f},
-std::array<float,2>{0.535515249f, 0.24290809f},
-std::array<float,2>{0.652498007f, 0.577601671f},
-std::array<float,2>{0.469543099f, 0.0195983108f},
-std::array<float,2>{0.182019472f, 0.999550939f},
-std::array<float,2>{0.986373365f, 0.292308211f},
-std::array<float,2>{0.922550678f, 0.739050329f},
-std::array<float,2>{0.200614318f, 0.176860958f},
-std::array<float,2>{0.40102154f, 0.785514116f},
-std::array<float,2>{0.719435215f, 0.406596124f},
-std::array<float,2>{0.605001926f, 0.8776564f},
-std::array<float,2>{0.363699645f, 0.356690496f},
-std::array<float,2>{0.0362148546f, 0.513559699f},
-std::array<float,2>{0.861762285f, 0.0856054425f},
-std::array<float,2>{0.961318433f, 0.963927388f},
-std::array<float,2>{0.138861105f, 0.252161324f},
-std::array<float,2>{0.448336363f, 0.602662385f},
-std::array<float,2>{0.662571669f, 0.0551882423f},
-std::array<float,2>{0.519610345f, 0.680502236f},
-std::array<float,2>{0.267743349f, 0.198148489f},
-std::array<float,2>{0.077925086f, 0.854634881f},
-std::array<float,2>{0.764407337f, 0.475973874f},
-std::array<float,2>{0.828605652f, 0.555092812f},
-std::array<float,2>{0.000663607614f, 0.102245525f},
-std::array<float,2>{0.321167052f, 0.930188596f},
-std::array<float,2>{0.563275754f, 0.318338633f},
-std::array<float,2>{0.718486905f, 0.75204587f},
-std::array<float,2>{0.418807179f, 0.376831293f},
-std::array<float,2>{0.24530372f, 0.705424309f},
-std::array<float,2>{0.875166535f, 0.132169738f},
-std::array<float,2>{0.993034959f, 0.845671356f},
-std::array<float,2>{0.178751156f, 0.48238191f},
-std::array<float,2>{0.482919246f, 0.679043412f},
-std::array<float,2>{0.644589186f, 0.188402295f},
-std::array<float,2>{0.541119635f, 0.598726332f},
-std::array<float,2>{0.291970134f, 0.0502185225f},
-std::array<float,2>{0.104383193f, 0.956984341f},
-std::array<float,2>{0.806895375f, 0.263209552f},
-std::array<float,2>{0.873716056f, 0.716171682f},
-std::array<float,2>{0.0394903794f, 0.137530506f},
-std::array<float,2>{0.370403588f, 0.76052177f},
-std::array<float,2>{0.596816242f, 0.38296029f},
-std::array<float,2>{0.733593762f, 0.929635823f},
-std::array<float,2>{0.396837771f, 0.32483089f},
-std::array<float,2>{0.192950338f, 0.551375568f},
-std::array<float,2>{0.93369478f, 0.100267962f},
-std::array<float,2>{0.751033366f, 0.986081123f},
-std::array<float,2>{0.0702483803f, 0.282943577f},
-std::array<float,2>{0.274891555f, 0.562661648f},
-std::array<float,2>{0.525538266f, 0.0298950952f},
-std::array<float,2>{0.668415844f, 0.638238668f},
-std::array<float,2>{0.440194786f, 0.236962751f},
-std::array<float,2>{0.127957046f, 0.826153934f},
-std::array<float,2>{0.954825103f, 0.449958771f},
-std::array<float,2>{0.890387654f, 0.505611479f},
-std::array<float,2>{0.236495465f, 0.0860988796f},
-std::array<float,2>{0.412375301f, 0.888445437f},
-std::array<float,2>{0.706860662f, 0.344319701f},
-std::array<float,2>{0.571583271f, 0.795851767f},
-std::array<float,2>{0.313746363f, 0.419868797f},
-std::array<float,2>{0.0110499989f, 0.745282412f},
-std::array<float,2>{0.83989352f, 0.186336935f},
-std::array<float,2>{0.824703455f, 0.769919395f},
-std::array<float,2>{0.0302222278f, 0.404109508f},
-std::array<float,2>{0.337635159f, 0.691643119f},
-std::array<float,2>{0.591167569f, 0.15086177f},
-std::array<float,2>{0.697347164f, 0.538631439f},
-std::array<float,2>{0.434316546f, 0.122207642f},
-std::array<float,2>{0.229403362f, 0.913055122f},
-std::array<float,2>{0.892253995f, 0.331985086f},
-std::array<float,2>{0.944497108f, 0.660569668f},
-std::array<float,2>{0.145088241f, 0.211939111f},
-std::array<float,2>{0.458442062f, 0.859642923f},
-std::array<float,2>{0.678363502f, 0.49422881f},
-std::array<float,2>{0.512678981f, 0.941307068f},
-std::array<float,2>{0.262295872f, 0.279242337f},
-std::array<float,2>{0.0792453811f, 0.621722281f},
-std::array<float,2>{0.775888205f, 0.0316630602f},
-std::array<float,2>{0.90784806f, 0.894405425f},
-std::array<float,2>{0.217864081f, 0.362761825f},
-std::array<float,2>{0.379022986f, 0.524012923f},
-std::array<float,2>{0.734676719f, 0.0703463107f},
-std::array<float,2>{0.613101542f, 0.728993237f},
-std::array<float,2>{0.348191977f, 0.169974357f},
-std::array<float,2>{0.0605877228f, 0.809583962f},
-std::array<float,2>{0.849256694f, 0.436728388f},
-std::array<float,2>{0.793451786f, 0.582937896f},
-std::array<float,2>{0.110635601f, 0.0007539129f},
-std::array<float,2>{0.298092753f, 0.974507868f},
-std::array<float,2>{0.551185489f, 0.297520578f},
-std::array<float,2>{0.637206376f, 0.831055403f},
-std::array<float,2>{0.489229918f, 0.453346133f},
-std::array<float,2>{0.163306847f, 0.647251844f},
-std::array<float,2>{0.982413352f, 0.231628373f},
-std::array<float,2>{0.96745801f, 0.805853486f},
-std::array<float,2>{0.132955998f, 0.433056265f},
-std::array<float,2>{0.452422589f, 0.730910122f},
-std::array<float,2>{0.657239497f, 0.165217668f},
-std::array<float,2>{0.51578784f, 0.528784215f},
-std::array<float,2>{0.270781815f, 0.0759630501f},
-std::array<float,2>{0.073154293f, 0.898283184f},
-std::array<float,2>{0.759724975f, 0.364064187f},
-std::array<float,2>{0.835564077f, 0.642913163f},
-std::array<float,2>{0.00673470041f, 0.229165763f},
-std::array<float,2>{0.326097906f, 0.835780263f},
-std::array<float,2>{0.566759288f, 0.460246652f},
-std::array<float,2>{0.712238073f, 0.969676912f},
-std::array<float,2>{0.41426158f, 0.301747143f},
-std::array<float,2>{0.246219128f, 0.581535816f},
-std::array<float,2>{0.882357538f, 0.00661510648f},
-std::array<float,2>{0.801022053f, 0.907403529f},
-std::array<float,2>{0.0947891101f, 0.332067996f},
-std::array<float,2>{0.284123689f, 0.533420086f},
-std::array<float,2>{0.533478498f, 0.120564379f},
-std::array<float,2>{0.650662482f, 0.688572049f},
-std::array<float,2>{0.472974777f, 0.154042825f},
-std::array<float,2>{0.184898093f, 0.767359197f},
-std::array<float,2>{0.98991394f, 0.402224511f},
-std::array<float,2>{0.928149223f, 0.620890141f},
-std::array<float,2>{0.195876151f, 0.0374706164f},
-std::array<float,2>{0.404218107f, 0.943230271f},
-std::array<float,2>{0.724576592f, 0.274908304f},
-std::array<float,2>{0.608536243f, 0.865309358f},
-std::array<float,2>{0.363084704f, 0.497035086f},
-std::array<float,2>{0.0315436833f, 0.659749329f},
-std::array<float,2>{0.864009559f, 0.218439355f},
-std::array<float,2>{0.854190946f, 0.822632968f},
-std::array<float,2>{0.0476539209f, 0.448593587f},
-std::array<float,2>{0.353298277f, 0.634280741f},
-std::array<float,2>{0.617209911f, 0.240574956f},
-std::array<float,2>{0.749398828f, 0.567436159f},
-std::array<float,2>{0.38522923f, 0.0262788814f},
-std::array<float,2>{0.210926116f, 0.991629064f},
-std::array<float,2>{0.917817354f, 0.286987573f},
-std::array<float,2>{0.972070098f, 0.746840954f},
-std::array<float,2>{0.16541262f, 0.181374878f},
-std::array<float,2>{0.495126039f, 0.790038109f},
-std::array<float,2>{0.62602824f, 0.416842669f},
-std::array<float,2>{0.558352709f, 0.883967161f},
-std::array<float,2>{0.310134143f, 0.350312859f},
-std::array<float,2>{0.124500401f, 0.503892064f},
-std::array<float,2>{0.785341501f, 0.093298845f},
-std::array<float,2>{0.903868914f, 0.958198965f},
-std::array<float,2>{0.223570853f, 0.260867149f},
-std::array<float,2>{0.425914258f, 0.594470978f},
-std::array<float,2>{0.694033802f, 0.0541257448f},
-std::array<float,2>{0.580338836f, 0.674596488f},
-std::array<float,2>{0.329865366f, 0.19413574f},
-std::array<float,2>{0.0227422062f, 0.85087496f},
-std::array<float,2>{0.81824851f, 0.477330536f},
-std::array<float,2>{0.769985616f, 0.550661445f},
-std::array<float,2>{0.0860295817f, 0.097590223f},
-std::array<float,2>{0.250855237f, 0.923998177f},
-std::array<float,2>{0.501769304f, 0.32339552f},
-std::array<float,2>{0.683464408f, 0.762576938f},
-std::array<float,2>{0.466527313f, 0.388171375f},
-std::array<float,2>{0.151967555f, 0.713748097f},
-std::array<float,2>{0.950827479f, 0.133569866f},
-std::array<float,2>{0.91194582f, 0.858729005f},
-std::array<float,2>{0.211452201f, 0.469969749f},
-std::array<float,2>{0.377624363f, 0.686266243f},
-std::array<float,2>{0.741132557f, 0.201880023f},
-std::array<float,2>{0.616889834f, 0.606496572f},
-std::array<float,2>{0.345661759f, 0.0596015193f},
-std::array<float,2>{0.0569654964f, 0.968323469f},
-std::array<float,2>{0.84566474f, 0.256138444f},
-std::array<float,2>{0.789659619f, 0.710317969f},
-std::array<float,2>{0.115297161f, 0.12575224f},
-std::array<float,2>{0.301226556f, 0.755736589f},
-std::array<float,2>{0.550218105f, 0.382326335f},
-std::array<float,2>{0.635192573f, 0.935591042f},
-std::array<float,2>{0.485330462f, 0.315839708f},
-std::array<float,2>{0.157666653f, 0.559413075f},
-std::array<float,2>{0.979620755f, 0.108109944f},
-std::array<float,2>{0.821163237f, 0.992863953f},
-std::array<float,2>{0.0255985595f, 0.295862854f},
-std::array<float,2>{0.34227699f, 0.573012114f},
-std::array<float,2>{0.58621645f, 0.0169538818f},
-std::array<float,2>{0.699531198f, 0.625030994f},
-std::array<float,2>{0.430448771f, 0.249408394f},
-std::array<float,2>{0.232001722f, 0.814267576f},
-std::array<float,2>{0.895824194f, 0.441556156f},
-std::array<float,2>{0.937621474f, 0.511533618f},
-std::array<float,2>{0.140771255f, 0.0787376612f},
-std::array<float,2>{0.453517944f, 0.881649792f},
-std::array<float,2>{0.674417675f, 0.353103399f},
-std::array<float,2>{0.508611202f, 0.784825504f},
-std::array<float,2>{0.261170089f, 0.412095189f},
-std::array<float,2>{0.0843491033f, 0.73558557f},
-std::array<float,2>{0.778379858f, 0.172578186f},
-std::array<float,2>{0.754672766f, 0.780219257f},
-std::array<float,2>{0.0627852306f, 0.395075291f},
-std::array<float,2>{0.278328985f, 0.702911794f},
-std::array<float,2>{0.528861463f, 0.141697288f},
-std::array<float,2>{0.666979671f, 0.544601142f},
-std::array<float,2>{0.444478303f, 0.114093199f},
-std::array<float,2>{0.130832911f, 0.914833844f},
-std::array<float,2>{0.96027869f, 0.342449635f},
-std::array<float,2>{0.886689663f, 0.668406546f},
-std::array<float,2>{0.241990849f, 0.204993099f},
-std::array<float,2>{0.407711804f, 0.871538937f},
-std::array<float,2>{0.707337856f, 0.488961965f},
-std::array<float,2>{0.577092469f, 0.946365952f},
-std::array<float,2>{0.316441238f, 0.270510226f},
-std::array<float,2>{0.0119816745f, 0.611026287f},
-std::array<float,2>{0.83707732f, 0.0427418128f},
-std::array<float,2>{0.996738732f, 0.904895961f},
-std::array<float,2>{0.174041465f, 0.374862224f},
-std::array<float,2>{0.476628512f, 0.517462552f},
-std::array<float,2>{0.642322958f, 0.0701903403f},
-std::array<float,2>{0.544156015f, 0.722763181f},
-std::array<float,2>{0.296348929f, 0.163580582f},
-std::array<float,2>{0.1081191f, 0.797800839f},
-std::array<float,2>{0.808899701f, 0.428725421f},
-std::array<float,2>{0.867655575f, 0.585947752f},
-std::array<float,2>{0.0451842956f, 0.015572927f},
-std::array<float,2>{0.371544898f, 0.977120757f},
-std::array<float,2>{0.600201666f, 0.30850786f},
-std::array<float,2>{0.729259074f, 0.83951658f},
-std::array<float,2>{0.39075014f, 0.467587501f},
-std::array<float,2>{0.188552573f, 0.653445482f},
-std::array<float,2>{0.933429897f, 0.223856866f},
-std::array<float,2>{0.876019537f, 0.750925541f},
-std::array<float,2>{0.245012969f, 0.377515644f},
-std::array<float,2>{0.419385612f, 0.703699589f},
-std::array<float,2>{0.717563272f, 0.129204124f},
-std::array<float,2>{0.564197063f, 0.558357477f},
-std::array<float,2>{0.322091222f, 0.104429923f},
-std::array<float,2>{0.00111960026f, 0.932229161f},
-std::array<float,2>{0.829618752f, 0.319761217f},
-std::array<float,2>{0.76531601f, 0.6823048f},
-std::array<float,2>{0.0766813457f, 0.196922854f},
-std::array<float,2>{0.269389778f, 0.853404343f},
-std::array<float,2>{0.520787597f, 0.473350614f},
-std::array<float,2>{0.663240373f, 0.961966038f},
-std::array<float,2>{0.447725505f, 0.251324624f},
-std::array<float,2>{0.139746398f, 0.605428278f},
-std::array<float,2>{0.962737381f, 0.0567659475f},
-std::array<float,2>{0.863261759f, 0.875894547f},
-std::array<float,2>{0.0360976048f, 0.359103918f},
-std::array<float,2>{0.365001529f, 0.515310109f},
-std::array<float,2>{0.604455888f, 0.0832400844f},
-std::array<float,2>{0.719798923f, 0.740560949f},
-std::array<float,2>{0.401761532f, 0.179652497f},
-std::array<float,2>{0.199824691f, 0.788627148f},
-std::array<float,2>{0.923318803f, 0.409299612f},
-std::array<float,2>{0.987500727f, 0.574367762f},
-std::array<float,2>{0.183418214f, 0.0226838253f},
-std::array<float,2>{0.469749361f, 0.996579707f},
-std::array<float,2>{0.65360117f, 0.289455116f},
-std::array<float,2>{0.53656739f, 0.817986131f},
-std::array<float,2>{0.285507202f, 0.440476805f},
-std::array<float,2>{0.100965992f, 0.630080998f},
-std::array<float,2>{0.799928606f, 0.245910227f},
-std::array<float,2>{0.783431768f, 0.867754459f},
-std::array<float,2>{0.12030191f, 0.485105813f},
-std::array<float,2>{0.305995077f, 0.665449917f},
-std::array<float,2>{0.56148243f, 0.208396628f},
-std::array<float,2>{0.62927258f, 0.616054416f},
-std::array<float,2>{0.499878377f, 0.0443747081f},
-std::array<float,2>{0.171172366f, 0.950890005f},
-std::array<float,2>{0.974219799f, 0.266961277f},
-std::array<float,2>{0.921429276f, 0.696915984f},
-std::array<float,2>{0.203140482f, 0.145395845f},
-std::array<float,2>{0.389546037f, 0.774742603f},
-std::array<float,2>{0.744684041f, 0.390759587f},
-std::array<float,2>{0.623494923f, 0.91893065f},
-std::array<float,2>{0.357995778f, 0.338587105f},
-std::array<float,2>{0.0529195033f, 0.540811241f},
-std::array<float,2>{0.858869135f, 0.111517206f},
-std::array<float,2>{0.947781444f, 0.984213889f},
-std::array<float,2>{0.153664917f, 0.310605854f},
-std::array<float,2>{0.462066054f, 0.592914104f},
-std::array<float,2>{0.685449123f, 0.0109618446f},
-std::array<float,2>{0.504189074f, 0.651156127f},
-std::array<float,2>{0.255752295f, 0.220505878f},
-std::array<float,2>{0.0932482928f, 0.843269706f},
-std::array<float,2>{0.766170859f, 0.463014692f},
-std::array<float,2>{0.815356433f, 0.520409346f},
-std::array<float,2>{0.0159687027f, 0.0652740002f},
-std::array<float,2>{0.33226487f, 0.898442745f},
-std::array<float,2>{0.582980037f, 0.368184358f},
-std::array<float,2>{0.688387156f, 0.800969601f},
-std::array<float,2>{0.423533916f, 0.423454672f},
-std::array<float,2>{0.222094059f, 0.720026493f},
-std::array<float,2>{0.900380194f, 0.157911614f},
-std::array<float,2>{0.98100841f, 0.829673588f},
-std::array<float,2>{0.162959933f, 0.45590964f},
-std::array<float,2>{0.489322037f, 0.644537449f},
-std::array<float,2>{0.638425589f, 0.232924804f},
-std::array<float,2>{0.552447379f, 0.585768759f},
-std::array<float,2>{0.297444671f, 0.00294709112f},
-std::array<float,2>{0.110050149f, 0.975386083f},
-std::array<float,2>{0.794156671f, 0.299834013f},
-std::array<float,2>{0.848143399f, 0.727154016f},
-std::array<float,2>{0.0620873012f, 0.169869393f},
-std::array<float,2>{0.349272341f, 0.811988294f},
-std::array<float,2>{0.611419082f, 0.435404688f},
-std::array<float,2>{0.735983133f, 0.892424107f},
-std::array<float,2>{0.380223304f, 0.360792249f},
-std::array<float,2>{0.216843277f, 0.526101708f},
-std::array<float,2>{0.906539083f, 0.0729392543f},
-std::array<float,2>{0.776994407f, 0.938506126f},
-std::array<float,2>{0.0784078464f, 0.280713141f},
-std::array<float,2>{0.263635576f, 0.624124944f},
-std::array<float,2>{0.513622284f, 0.0346192643f},
-std::array<float,2>{0.679006398f, 0.663972676f},
-std::array<float,2>{0.457867473f, 0.214221001f},
-std::array<float,2>{0.145922929f, 0.861511827f},
-std::array<float,2>{0.943411469f, 0.492226154f},
-std::array<float,2>{0.89132297f, 0.536024034f},
-std::array<float,2>{0.230412602f, 0.124458671f},
-std::array<float,2>{0.435119122f, 0.910600007f},
-std::array<float,2>{0.698525608f, 0.329592019f},
-std::array<float,2>{0.590052247f, 0.773129225f},
-std::array<float,2>{0.335971266f, 0.405815959f},
-std::array<float,2>{0.0308926888f, 0.693443418f},
-std::array<float,2>{0.825805187f, 0.149371639f},
-std::array<float,2>{0.840872824f, 0.794377148f},
-std::array<float,2>{0.0103223352f, 0.421126783f},
-std::array<float,2>{0.312992066f, 0.743929863f},
-std::array<float,2>{0.570931971f, 0.184601575f},
-std::array<float,2>{0.705168307f, 0.507715583f},
-std::array<float,2>{0.413567871f, 0.0890900046f},
-std::array<float,2>{0.23743102f, 0.890028536f},
-std::array<float,2>{0.889062166f, 0.347480029f},
-std::array<float,2>{0.953727186f, 0.640536308f},
-std::array<float,2>{0.127417043f, 0.235999346f},
-std::array<float,2>{0.440491647f, 0.82748884f},
-std::array<float,2>{0.669603407f, 0.453045785f},
-std::array<float,2>{0.52697289f, 0.987639189f},
-std::array<float,2>{0.274110019f, 0.284045845f},
-std::array<float,2>{0.069035098f, 0.565648794f},
-std::array<float,2>{0.750287116f, 0.0290184468f},
-std::array<float,2>{0.935251594f, 0.926491737f},
-std::array<float,2>{0.191841304f, 0.326722443f},
-std::array<float,2>{0.398234993f, 0.553940356f},
-std::array<float,2>{0.733282924f, 0.0976816267f},
-std::array<float,2>{0.596439064f, 0.718428254f},
-std::array<float,2>{0.370029479f, 0.139033958f},
-std::array<float,2>{0.040953923f, 0.759528875f},
-std::array<float,2>{0.874269485f, 0.386333197f},
-std::array<float,2>{0.808169663f, 0.601244748f},
-std::array<float,2>{0.105258971f, 0.0483778156f},
-std::array<float,2>{0.292758048f, 0.953912854f},
-std::array<float,2>{0.542854607f, 0.264659405f},
-std::array<float,2>{0.645857871f, 0.845789969f},
-std::array<float,2>{0.483760118f, 0.482577264f},
-std::array<float,2>{0.178693116f, 0.676973104f},
-std::array<float,2>{0.993194044f, 0.191374168f},
-std::array<float,2>{0.990558028f, 0.768025756f},
-std::array<float,2>{0.187472478f, 0.399008363f},
-std::array<float,2>{0.475969493f, 0.690716922f},
-std::array<float,2>{0.650045574f, 0.155379415f},
-std::array<float,2>{0.532093406f, 0.532852113f},
-std::array<float,2>{0.282979012f, 0.117569454f},
-std::array<float,2>{0.0970052406f, 0.908399761f},
-std::array<float,2>{0.804086268f, 0.334482253f},
-std::array<float,2>{0.865932643f, 0.657526731f},
-std::array<float,2>{0.0339085273f, 0.215628549f},
-std::array<float,2>{0.360189497f, 0.864246249f},
-std::array<float,2>{0.607326925f, 0.499432474f},
-std::array<float,2>{0.725263536f, 0.944420278f},
-std::array<float,2>{0.405016243f, 0.276397616f},
-std::array<float,2>{0.197985753f, 0.617521644f},
-std::array<float,2>{0.926067829f, 0.0368451327f},
-std::array<float,2>{0.760268807f, 0.896434903f},
-std::array<float,2>{0.0704380572f, 0.365812004f},
-std::array<float,2>{0.273134917f, 0.529376209f},
-std::array<float,2>{0.517917573f, 0.0780163333f},
-std::array<float,2>{0.659943819f, 0.73361063f},
-std::array<float,2>{0.45092985f, 0.166459948f},
-std::array<float,2>{0.13528724f, 0.807912767f},
-std::array<float,2>{0.966248274f, 0.431407601f},
-std::array<float,2>{0.880597353f, 0.57954222f},
-std::array<float,2>{0.248310387f, 0.00463118544f},
-std::array<float,2>{0.416852385f, 0.972212434f},
-std::array<float,2>{0.713454366f, 0.303355843f},
-std::array<float,2>{0.569376588f, 0.832552433f},
-std::array<float,2>{0.327877223f, 0.458668977f},
-std::array<float,2>{0.0053202929f, 0.640720308f},
-std::array<float,2>{0.832089782f, 0.228204682f},
-std::array<float,2>{0.819899499f, 0.847999811f},
-std::array<float,2>{0.0205020569f, 0.479011714f},
-std::array<float,2>{0.330376565f, 0.672581315f},
-std::array<float,2>{0.579038203f, 0.191693246f},
-std::array<float,2>{0.692012966f, 0.597451389f},
-std::array<float,2>{0.428020388f, 0.0524456315f},
-std::array<float,2>{0.22626996f, 0.960858285f},
-std::array<float,2>{0.906234741f, 0.259660631f},
-std::array<float,2>{0.952001214f, 0.712651134f},
-std::array<float,2>{0.150094569f, 0.136319101f},
-std::array<float,2>{0.468105167f, 0.765067995f},
-std::array<float,2>{0.680212736f, 0.388866484f},
-std::array<float,2>{0.503574729f, 0.922102034f},
-std::array<float,2>{0.253373891f, 0.321996272f},
-std::array<float,2>{0.0893607736f, 0.548588991f},
-std::array<float,2>{0.771731973f, 0.0949775949f},
-std::array<float,2>{0.914749026f, 0.989321589f},
-std::array<float,2>{0.208668157f, 0.287308484f},
-std::array<float,2>{0.383080572f, 0.570031047f},
-std::array<float,2>{0.747011185f, 0.0242401045f},
-std::array<float,2>{0.619458854f, 0.636094391f},
-std::array<float,2>{0.354750127f, 0.239903659f},
-std::array<float,2>{0.0507039689f, 0.820478857f},
-std::array<float,2>{0.85341084f, 0.44722271f},
-std::array<float,2>{0.788069665f, 0.500385761f},
-std::array<float,2>{0.122701153f, 0.0905253142f},
-std::array<float,2>{0.311210155f, 0.88596344f},
-std::array<float,2>{0.555821896f, 0.348910958f},
-std::array<float,2>{0.628336251f, 0.792222023f},
-std::array<float,2>{0.493974507f, 0.415823221f},
-std::array<float,2>{0.166634604f, 0.749727964f},
-std::array<float,2>{0.969149947f, 0.182178348f},
-std::array<float,2>{0.897320986f, 0.816286325f},
-std::array<float,2>{0.232428029f, 0.444341183f},
-std::array<float,2>{0.43311435f, 0.62729919f},
-std::array<float,2>{0.701387644f, 0.246670529f},
-std::array<float,2>{0.588084996f, 0.570540071f},
-std::array<float,2>{0.340360075f, 0.0177527629f},
-std::array<float,2>{0.0238950178f, 0.995710671f},
-std::array<float,2>{0.823180556f, 0.292979002f},
-std::array<float,2>{0.780325949f, 0.737338722f},
-std::array<float,2>{0.0823999792f, 0.174414814f},
-std::array<float,2>{0.258214325f, 0.782776773f},
-std::array<float,2>{0.51118052f, 0.4132213f},
-std::array<float,2>{0.673232734f, 0.879905045f},
-std::array<float,2>{0.455362946f, 0.354523182f},
-std::array<float,2>{0.1433734f, 0.508539736f},
-std::array<float,2>{0.939563155f, 0.0813317895f},
-std::array<float,2>{0.847426057f, 0.966319025f},
-std::array<float,2>{0.0561244786f, 0.254992574f},
-std::array<float,2>{0.346881032f, 0.609305561f},
-std::array<float,2>{0.61510843f, 0.0615205094f},
-std::array<float,2>{0.739220023f, 0.684069514f},
-std::array<float,2>{0.376601875f, 0.200396657f},
-std::array<float,2>{0.214339182f, 0.855865896f},
-std::array<float,2>{0.913374364f, 0.472541749f},
-std::array<float,2>{0.978159726f, 0.561283708f},
-std::array<float,2>{0.158920944f, 0.105649307f},
-std::array<float,2>{0.487419277f, 0.934843123f},
-std::array<float,2>{0.634559393f, 0.31324169f},
-std::array<float,2>{0.547449946f, 0.756918848f},
-std::array<float,2>{0.303644031f, 0.379698247f},
-std::array<float,2>{0.113719493f, 0.707186341f},
-std::array<float,2>{0.792678952f, 0.128423303f},
-std::array<float,2>{0.812378466f, 0.799194157f},
-std::array<float,2>{0.106124952f, 0.427505046f},
-std::array<float,2>{0.293755472f, 0.724912107f},
-std::array<float,2>{0.545830011f, 0.161250934f},
-std::array<float,2>{0.643195093f, 0.519341886f},
-std::array<float,2>{0.48004517f, 0.0670290142f},
-std::array<float,2>{0.17271477f, 0.903940439f},
-std::array<float,2>{0.999250233f, 0.372915179f},
-std::array<float,2>{0.931213021f, 0.656181931f},
-std::array<float,2>{0.189614341f, 0.225744471f},
-std::array<float,2>{0.393713564f, 0.837761462f},
-std::array<float,2>{0.72690779f, 0.465156436f},
-std::array<float,2>{0.597891092f, 0.978819072f},
-std::array<float,2>{0.373521626f, 0.305958182f},
-std::array<float,2>{0.0444945209f, 0.588433743f},
-std::array<float,2>{0.869292855f, 0.0135094672f},
-std::array<float,2>{0.958575547f, 0.917960823f},
-std::array<float,2>{0.132596746f, 0.340490401f},
-std::array<float,2>{0.441612929f, 0.545628428f},
-std::array<float,2>{0.664557397f, 0.115303263f},
-std::array<float,2>{0.53003931f, 0.699332714f},
-std::array<float,2>{0.279642463f, 0.143729284f},
-std::array<float,2>{0.0648958459f, 0.778955579f},
-std::array<float,2>{0.757372618f, 0.396809578f},
-std::array<float,2>{0.839343011f, 0.613021493f},
-std::array<float,2>{0.0139189977f, 0.0406789705f},
-std::array<float,2>{0.319330662f, 0.947481513f},
-std::array<float,2>{0.57460618f, 0.272696078f},
-std::array<float,2>{0.709081769f, 0.874217033f},
-std::array<float,2>{0.409901887f, 0.491277486f},
-std::array<float,2>{0.239472121f, 0.671372533f},
-std::array<float,2>{0.88436991f, 0.206103504f},
-std::array<float,2>{0.924690485f, 0.786590219f},
-std::array<float,2>{0.20289503f, 0.4079009f},
-std::array<float,2>{0.398505569f, 0.739291191f},
-std::array<float,2>{0.721883953f, 0.176483497f},
-std::array<float,2>{0.601718426f, 0.511795104f},
-std::array<float,2>{0.366595238f, 0.084551774f},
-std::array<float,2>{0.0388551466f, 0.877948046f},
-std::array<float,2>{0.859786093f, 0.355874956f},
-std::array<float,2>{0.79851073f, 0.631184876f},
-std::array<float,2>{0.0993459225f, 0.24371016f},
-std::array<float,2>{0.289028198f, 0.820298731f},
-std::array<float,2>{0.538586497f, 0.437767118f},
-std::array<float,2>{0.655519605f, 0.998853803f},
-std::array<float,2>{0.471288115f, 0.291629136f},
-std::array<float,2>{0.180885285f, 0.576533258f},
-std::array<float,2>{0.985607803f, 0.0210813452f},
-std::array<float,2>{0.830823004f, 0.930867612f},
-std::array<float,2>{0.0038581097f, 0.316587061f},
-std::array<float,2>{0.322524965f, 0.556486607f},
-std::array<float,2>{0.564758241f, 0.103447072f},
-std::array<float,2>{0.716326118f, 0.706879735f},
-std::array<float,2>{0.420989454f, 0.13102366f},
-std::array<float,2>{0.242573038f, 0.753801823f},
-std::array<float,2>{0.87711972f, 0.375524312f},
-std::array<float,2>{0.963846684f, 0.60160023f},
-std::array<float,2>{0.138556644f, 0.0560017377f},
-std::array<float,2>{0.446168512f, 0.963151693f},
-std::array<float,2>{0.660895467f, 0.253536284f},
-std::array<float,2>{0.523334324f, 0.853676558f},
-std::array<float,2>{0.267229974f, 0.475105435f},
-std::array<float,2>{0.075284481f, 0.681147218f},
-std::array<float,2>{0.76181215f, 0.198275387f},
-std::array<float,2>{0.767896652f, 0.841397703f},
-std::array<float,2>{0.0910081565f, 0.461790323f},
-std::array<float,2>{0.256924301f, 0.649316549f},
-std::array<float,2>{0.507246375f, 0.220736802f},
-std::array<float,2>{0.686846793f, 0.591363788f},
-std::array<float,2>{0.463671923f, 0.00806391519f},
-std::array<float,2>{0.155918375f, 0.9821105f},
-std::array<float,2>{0.945662022f, 0.310049772f},
-std::array<float,2>{0.900508285f, 0.721519113f},
-std::array<float,2>{0.219567567f, 0.159127504f},
-std::array<float,2>{0.42449075f, 0.803088963f},
-std::array<float,2>{0.690048277f, 0.425062686f},
-std::array<float,2>{0.585739732f, 0.901715934f},
-std::array<float,2>{0.335045666f, 0.369462758f},
-std::array<float,2>{0.0175858121f, 0.522093117f},
-std::array<float,2>{0.812694132f, 0.0634188876f},
-std::array<float,2>{0.975242615f, 0.952097595f},
-std::array<float,2>{0.168617338f, 0.268196404f},
-std::array<float,2>{0.496399641f, 0.615130126f},
-std::array<float,2>{0.632296145f, 0.044995781f},
-std::array<float,2>{0.559494555f, 0.667297661f},
-std::array<float,2>{0.306819141f, 0.210479274f},
-std::array<float,2>{0.117839642f, 0.870624363f},
-std::array<float,2>{0.782293499f, 0.487082541f},
-std::array<float,2>{0.857358098f, 0.542442858f},
-std::array<float,2>{0.0513434075f, 0.110403784f},
-std::array<float,2>{0.356850356f, 0.921300769f},
-std::array<float,2>{0.622988522f, 0.336002499f},
-std::array<float,2>{0.742211342f, 0.77671051f},
-std::array<float,2>{0.388380527f, 0.39293167f},
-std::array<float,2>{0.206844077f, 0.697789967f},
-std::array<float,2>{0.919283092f, 0.147900268f},
-std::array<float,2>{0.943162799f, 0.860547423f},
-std::array<float,2>{0.147883773f, 0.495847374f},
-std::array<float,2>{0.459123015f, 0.661298811f},
-std::array<float,2>{0.67675519f, 0.211799204f},
-std::array<float,2>{0.514717817f, 0.622246623f},
-std::array<float,2>{0.264875948f, 0.0327168666f},
-std::array<float,2>{0.0810970142f, 0.940100372f},
-std::array<float,2>{0.774803996f, 0.27800414f},
-std::array<float,2>{0.827404022f, 0.6927405f},
-std::array<float,2>{0.027876338f, 0.151368454f},
-std::array<float,2>{0.339493573f, 0.770635724f},
-std::array<float,2>{0.593540907f, 0.402841747f},
-std::array<float,2>{0.695964813f, 0.913507521f},
-std::array<float,2>{0.436424285f, 0.330451727f},
-std::array<float,2>{0.226979777f, 0.537843943f},
-std::array<float,2>{0.89389509f, 0.121728234f},
-std::array<float,2>{0.79669106f, 0.973466218f},
-std::array<float,2>{0.11250715f, 0.298141688f},
-std::array<float,2>{0.298903823f, 0.583072186f},
-std::array<float,2>{0.553340793f, 0.00105807837f},
-std::array<float,2>{0.639683843f, 0.647683382f},
-std::array<float,2>{0.490374237f, 0.230661169f},
-std::array<float,2>{0.161098495f, 0.830290258f},
-std::array<float,2>{0.98366195f, 0.454976141f},
-std::array<float,2>{0.908966959f, 0.525263965f},
-std::array<float,2>{0.215948582f, 0.0718421713f},
-std::array<float,2>{0.382421106f, 0.893538237f},
-std::array<float,2>{0.738151491f, 0.361736774f},
-std::array<float,2>{0.610589921f, 0.808598816f},
-std::array<float,2>{0.350518823f, 0.435797513f},
-std::array<float,2>{0.0602276027f, 0.730302215f},
-std::array<float,2>{0.85153383f, 0.171784163f},
-std::array<float,2>{0.872810125f, 0.76125592f},
-std::array<float,2>{0.0411518887f, 0.384271502f},
-std::array<float,2>{0.367951244f, 0.715012729f},
-std::array<float,2>{0.594769418f, 0.137775302f},
-std::array<float,2>{0.731943667f, 0.552592933f},
-std::array<float,2>{0.39572382f, 0.101389192f},
-std::array<float,2>{0.193963066f, 0.927877843f},
-std::array<float,2>{0.936213315f, 0.325788826f},
-std::array<float,2>{0.994406581f, 0.678334177f},
-std::array<float,2>{0.176974997f, 0.189336956f},
-std::array<float,2>{0.480773717f, 0.844488084f},
-std::array<float,2>{0.648276269f, 0.481161982f},
-std::array<float,2>{0.539601266f, 0.955113709f},
-std::array<float,2>{0.290231973f, 0.262268931f},
-std::array<float,2>{0.102845475f, 0.598555386f},
-std::array<float,2>{0.806221366f, 0.0492465198f},
-std::array<float,2>{0.887343943f, 0.886875391f},
-std::array<float,2>{0.235131428f, 0.344807625f},
-std::array<float,2>{0.41068235f, 0.504151464f},
-std::array<float,2>{0.704541326f, 0.0878589228f},
-std::array<float,2>{0.572756767f, 0.744528949f},
-std::array<float,2>{0.315424085f, 0.18748039f},
-std::array<float,2>{0.00803975109f, 0.796659529f},
-std::array<float,2>{0.842544138f, 0.418201655f},
-std::array<float,2>{0.7535851f, 0.563699245f},
-std::array<float,2>{0.067778863f, 0.0309826788f},
-std::array<float,2>{0.276240498f, 0.984611452f},
-std::array<float,2>{0.524793744f, 0.281294674f},
-std::array<float,2>{0.670832515f, 0.824675858f},
-std::array<float,2>{0.438014448f, 0.450344324f},
-std::array<float,2>{0.126085088f, 0.637674928f},
-std::array<float,2>{0.955748796f, 0.238175869f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.929466844f, 0.574518383f},
-std::array<float,2>{0.479066133f, 0.436022788f},
-std::array<float,2>{0.140452042f, 0.855014622f},
-std::array<float,2>{0.690937757f, 0.108673006f},
-std::array<float,2>{0.548150361f, 0.988475919f},
-std::array<float,2>{0.00603156351f, 0.245992929f},
-std::array<float,2>{0.34466508f, 0.736628652f},
-std::array<float,2>{0.751968563f, 0.364232242f},
-std::array<float,2>{0.869360149f, 0.750667632f},
-std::array<float,2>{0.282423884f, 0.00839261897f},
-std::array<float,2>{0.0814579129f, 0.542701423f},
-std::array<float,2>{0.592356265f, 0.444277197f},
-std::array<float,2>{0.628381968f, 0.627461731f},
-std::array<float,2>{0.211145774f, 0.297217488f},
-std::array<float,2>{0.4295398f, 0.935462236f},
-std::array<float,2>{0.937627256f, 0.146352753f},
-std::array<float,2>{0.810775995f, 0.705770314f},
-std::array<float,2>{0.332807124f, 0.31615001f},
-std::array<float,2>{0.0417302772f, 0.953335166f},
-std::array<float,2>{0.512212932f, 0.207331061f},
-std::array<float,2>{0.732230246f, 0.829333305f},
-std::array<float,2>{0.171270981f, 0.0842502117f},
-std::array<float,2>{0.463222146f, 0.61973244f},
-std::array<float,2>{0.896907389f, 0.389922351f},
-std::array<float,2>{0.98271656f, 0.897273958f},
-std::array<float,2>{0.39114666f, 0.186071575f},
-std::array<float,2>{0.22687532f, 0.673737645f},
-std::array<float,2>{0.66403091f, 0.262155294f},
-std::array<float,2>{0.619683444f, 0.501490116f},
-std::array<float,2>{0.115017541f, 0.490452021f},
-std::array<float,2>{0.25924167f, 0.801279783f},
-std::array<float,2>{0.813785851f, 0.0422002785f},
-std::array<float,2>{0.959760904f, 0.658106506f},
-std::array<float,2>{0.408123314f, 0.271730244f},
-std::array<float,2>{0.193046033f, 0.876278937f},
-std::array<float,2>{0.655027628f, 0.171570182f},
-std::array<float,2>{0.572845638f, 0.789667964f},
-std::array<float,2>{0.066521503f, 0.0502549447f},
-std::array<float,2>{0.29979676f, 0.518868983f},
-std::array<float,2>{0.848829448f, 0.46949932f},
-std::array<float,2>{0.771367908f, 0.948783755f},
-std::array<float,2>{0.374224514f, 0.198126897f},
-std::array<float,2>{0.0299607553f, 0.693675101f},
-std::array<float,2>{0.545457423f, 0.334505677f},
-std::array<float,2>{0.705129147f, 0.602302611f},
-std::array<float,2>{0.143651068f, 0.395256072f},
-std::array<float,2>{0.498765558f, 0.816657245f},
-std::array<float,2>{0.914097011f, 0.0654440448f},
-std::array<float,2>{0.831001401f, 0.55098325f},
-std::array<float,2>{0.270122737f, 0.460673481f},
-std::array<float,2>{0.0986383334f, 0.76654762f},
-std::array<float,2>{0.60349822f, 0.0164989065f},
-std::array<float,2>{0.684608996f, 0.914136291f},
-std::array<float,2>{0.245375127f, 0.127485737f},
-std::array<float,2>{0.376963496f, 0.645442247f},
-std::array<float,2>{0.985414743f, 0.285010368f},
-std::array<float,2>{0.888480425f, 0.864561558f},
-std::array<float,2>{0.441440076f, 0.11074359f},
-std::array<float,2>{0.17706345f, 0.592335165f},
-std::array<float,2>{0.749337018f, 0.415147007f},
-std::array<float,2>{0.52904135f, 0.734309196f},
-std::array<float,2>{0.0479453467f, 0.357092083f},
-std::array<float,2>{0.317393243f, 0.977313399f},
-std::array<float,2>{0.793122232f, 0.225057766f},
-std::array<float,2>{0.998836517f, 0.52958858f},
-std::array<float,2>{0.385498494f, 0.483433366f},
-std::array<float,2>{0.237190261f, 0.785164475f},
-std::array<float,2>{0.672953784f, 0.0624843277f},
-std::array<float,2>{0.596904218f, 0.890322983f},
-std::array<float,2>{0.102108084f, 0.160099253f},
-std::array<float,2>{0.275475502f, 0.666562855f},
-std::array<float,2>{0.837570786f, 0.278854191f},
-std::array<float,2>{0.783174634f, 0.823642552f},
-std::array<float,2>{0.321864665f, 0.0719391555f},
-std::array<float,2>{0.0557281338f, 0.598903298f},
-std::array<float,2>{0.518246353f, 0.398844868f},
-std::array<float,2>{0.73464334f, 0.700819433f},
-std::array<float,2>{0.186672509f, 0.343578905f},
-std::array<float,2>{0.450057566f, 0.944709599f},
-std::array<float,2>{0.881575882f, 0.188494951f},
-std::array<float,2>{0.852597177f, 0.655292988f},
-std::array<float,2>{0.305640906f, 0.290644228f},
-std::array<float,2>{0.0754636228f, 0.908709466f},
-std::array<float,2>{0.567386031f, 0.13537173f},
-std::array<float,2>{0.646945536f, 0.780225217f},
-std::array<float,2>{0.198811203f, 0.0257415101f},
-std::array<float,2>{0.415467858f, 0.561006725f},
-std::array<float,2>{0.962009251f, 0.46305263f},
-std::array<float,2>{0.911762178f, 0.973268092f},
-std::array<float,2>{0.488764465f, 0.23261261f},
-std::array<float,2>{0.155212805f, 0.722879887f},
-std::array<float,2>{0.71675849f, 0.348632514f},
-std::array<float,2>{0.535300791f, 0.579272807f},
-std::array<float,2>{0.0222256109f, 0.41151467f},
-std::array<float,2>{0.367013991f, 0.871798098f},
-std::array<float,2>{0.779333591f, 0.120753661f},
-std::array<float,2>{0.905841112f, 0.747946203f},
-std::array<float,2>{0.457847029f, 0.368862778f},
-std::array<float,2>{0.160090238f, 0.992265522f},
-std::array<float,2>{0.719182253f, 0.239255354f},
-std::array<float,2>{0.507162631f, 0.84395957f},
-std::array<float,2>{0.0313621871f, 0.10010238f},
-std::array<float,2>{0.343025863f, 0.565964818f},
-std::array<float,2>{0.8005867f, 0.42792058f},
-std::array<float,2>{0.822090507f, 0.922738969f},
-std::array<float,2>{0.25460574f, 0.15318954f},
-std::array<float,2>{0.121747024f, 0.638301015f},
-std::array<float,2>{0.61215663f, 0.308206022f},
-std::array<float,2>{0.669694543f, 0.53357774f},
-std::array<float,2>{0.218771115f, 0.445718884f},
-std::array<float,2>{0.402121782f, 0.762152374f},
-std::array<float,2>{0.970943332f, 0.00211181818f},
-std::array<float,2>{0.764490843f, 0.615941703f},
-std::array<float,2>{0.356754601f, 0.376470715f},
-std::array<float,2>{0.00808554981f, 0.843055844f},
-std::array<float,2>{0.557314098f, 0.0862264484f},
-std::array<float,2>{0.697469056f, 0.962242365f},
-std::array<float,2>{0.126013488f, 0.211979046f},
-std::array<float,2>{0.469832003f, 0.715384066f},
-std::array<float,2>{0.935886443f, 0.32420069f},
-std::array<float,2>{0.950611532f, 0.809175372f},
-std::array<float,2>{0.433338702f, 0.0363239273f},
-std::array<float,2>{0.204258487f, 0.513459682f},
-std::array<float,2>{0.637426019f, 0.497681797f},
-std::array<float,2>{0.580833435f, 0.687412024f},
-std::array<float,2>{0.0892892182f, 0.257799506f},
-std::array<float,2>{0.295521855f, 0.899753392f},
-std::array<float,2>{0.862325907f, 0.177813128f},
-std::array<float,2>{0.942328095f, 0.597524464f},
-std::array<float,2>{0.421884865f, 0.406199366f},
-std::array<float,2>{0.215415627f, 0.828119814f},
-std::array<float,2>{0.632180572f, 0.0744195357f},
-std::array<float,2>{0.587067008f, 0.93965286f},
-std::array<float,2>{0.0836306959f, 0.192673206f},
-std::array<float,2>{0.285188109f, 0.697688639f},
-std::array<float,2>{0.873361766f, 0.339499444f},
-std::array<float,2>{0.756551683f, 0.782699943f},
-std::array<float,2>{0.350323141f, 0.0564880632f},
-std::array<float,2>{0.00366148097f, 0.524523556f},
-std::array<float,2>{0.553996623f, 0.477777094f},
-std::array<float,2>{0.692856312f, 0.668003857f},
-std::array<float,2>{0.136082947f, 0.274089783f},
-std::array<float,2>{0.481194437f, 0.884543538f},
-std::array<float,2>{0.925643504f, 0.160713643f},
-std::array<float,2>{0.818667293f, 0.721041322f},
-std::array<float,2>{0.263286233f, 0.343881845f},
-std::array<float,2>{0.11174047f, 0.972144127f},
-std::array<float,2>{0.622800589f, 0.227007553f},
-std::array<float,2>{0.658161163f, 0.869334698f},
-std::array<float,2>{0.233297169f, 0.121595755f},
-std::array<float,2>{0.397136182f, 0.582903862f},
-std::array<float,2>{0.978661299f, 0.407636821f},
-std::array<float,2>{0.891026497f, 0.912169099f},
-std::array<float,2>{0.46716404f, 0.138331175f},
-std::array<float,2>{0.167842239f, 0.648911476f},
-std::array<float,2>{0.727963865f, 0.296725363f},
-std::array<float,2>{0.510900974f, 0.556502342f},
-std::array<float,2>{0.0443623178f, 0.468130708f},
-std::array<float,2>{0.328857332f, 0.776198924f},
-std::array<float,2>{0.807740986f, 0.0277723819f},
-std::array<float,2>{0.918701172f, 0.633904696f},
-std::array<float,2>{0.495266825f, 0.309515357f},
-std::array<float,2>{0.146733567f, 0.927019179f},
-std::array<float,2>{0.710497499f, 0.149580091f},
-std::array<float,2>{0.539064169f, 0.757981062f},
-std::array<float,2>{0.0244071838f, 0.00521459989f},
-std::array<float,2>{0.371008724f, 0.537816107f},
-std::array<float,2>{0.767200112f, 0.451406926f},
-std::array<float,2>{0.847645581f, 0.999363542f},
-std::array<float,2>{0.30094704f, 0.23727347f},
-std::array<float,2>{0.0632653832f, 0.746060669f},
-std::array<float,2>{0.575406075f, 0.372272611f},
-std::array<float,2>{0.649019837f, 0.567308009f},
-std::array<float,2>{0.18889451f, 0.423061073f},
-std::array<float,2>{0.411359936f, 0.848110795f},
-std::array<float,2>{0.955439866f, 0.0948966071f},
-std::array<float,2>{0.789238274f, 0.50924468f},
-std::array<float,2>{0.315992028f, 0.494220287f},
-std::array<float,2>{0.0537115f, 0.806526899f},
-std::array<float,2>{0.525175929f, 0.0345104225f},
-std::array<float,2>{0.742193997f, 0.905535638f},
-std::array<float,2>{0.174726874f, 0.174821272f},
-std::array<float,2>{0.437584043f, 0.681441545f},
-std::array<float,2>{0.884684324f, 0.252189755f},
-std::array<float,2>{0.990512967f, 0.837955475f},
-std::array<float,2>{0.382459164f, 0.0929687321f},
-std::array<float,2>{0.246160582f, 0.61313051f},
-std::array<float,2>{0.681080043f, 0.381151199f},
-std::array<float,2>{0.608814001f, 0.713001728f},
-std::array<float,2>{0.0969542488f, 0.325120836f},
-std::array<float,2>{0.266322285f, 0.966487467f},
-std::array<float,2>{0.832209527f, 0.215905055f},
-std::array<float,2>{0.875406325f, 0.545811772f},
-std::array<float,2>{0.44613108f, 0.438376546f},
-std::array<float,2>{0.182437584f, 0.755452991f},
-std::array<float,2>{0.741217256f, 0.0142855439f},
-std::array<float,2>{0.52289629f, 0.932410657f},
-std::array<float,2>{0.0605518818f, 0.144370049f},
-std::array<float,2>{0.327391714f, 0.630521655f},
-std::array<float,2>{0.786968291f, 0.301788896f},
-std::array<float,2>{0.842862964f, 0.858619094f},
-std::array<float,2>{0.277855903f, 0.102556266f},
-std::array<float,2>{0.107175313f, 0.572954118f},
-std::array<float,2>{0.597859442f, 0.430328161f},
-std::array<float,2>{0.678884029f, 0.741199672f},
-std::array<float,2>{0.239289448f, 0.360219091f},
-std::array<float,2>{0.387420863f, 0.986517906f},
-std::array<float,2>{0.993239224f, 0.249861136f},
-std::array<float,2>{0.774028242f, 0.67736578f},
-std::array<float,2>{0.359496236f, 0.259223133f},
-std::array<float,2>{0.0187300202f, 0.891809404f},
-std::array<float,2>{0.532207668f, 0.183223769f},
-std::array<float,2>{0.714542508f, 0.800424874f},
-std::array<float,2>{0.15000464f, 0.046012789f},
-std::array<float,2>{0.487910002f, 0.504631162f},
-std::array<float,2>{0.908177555f, 0.485497892f},
-std::array<float,2>{0.96770674f, 0.959461927f},
-std::array<float,2>{0.418014348f, 0.20418328f},
-std::array<float,2>{0.202643856f, 0.710125148f},
-std::array<float,2>{0.643942833f, 0.31777516f},
-std::array<float,2>{0.56527096f, 0.62263757f},
-std::array<float,2>{0.0710764378f, 0.385295719f},
-std::array<float,2>{0.31079784f, 0.834095418f},
-std::array<float,2>{0.858679414f, 0.0789663866f},
-std::array<float,2>{0.976301789f, 0.691264987f},
-std::array<float,2>{0.40397501f, 0.331833214f},
-std::array<float,2>{0.223385751f, 0.951934397f},
-std::array<float,2>{0.665750861f, 0.20073992f},
-std::array<float,2>{0.616842508f, 0.813092947f},
-std::array<float,2>{0.117877416f, 0.0668869466f},
-std::array<float,2>{0.250003576f, 0.608779967f},
-std::array<float,2>{0.827425718f, 0.393900692f},
-std::array<float,2>{0.803279221f, 0.881734431f},
-std::array<float,2>{0.336982071f, 0.166799858f},
-std::array<float,2>{0.0385261215f, 0.66253531f},
-std::array<float,2>{0.500222504f, 0.267517626f},
-std::array<float,2>{0.726250648f, 0.520898521f},
-std::array<float,2>{0.163897336f, 0.47497052f},
-std::array<float,2>{0.455995262f, 0.794544339f},
-std::array<float,2>{0.898515642f, 0.0543704256f},
-std::array<float,2>{0.866197526f, 0.5884642f},
-std::array<float,2>{0.289150506f, 0.418536663f},
-std::array<float,2>{0.0928933844f, 0.861750782f},
-std::array<float,2>{0.585890651f, 0.115852699f},
-std::array<float,2>{0.633932769f, 0.982858062f},
-std::array<float,2>{0.208591208f, 0.222469047f},
-std::array<float,2>{0.436604142f, 0.728904188f},
-std::array<float,2>{0.948055148f, 0.351669371f},
-std::array<float,2>{0.929803848f, 0.770700574f},
-std::array<float,2>{0.474954724f, 0.0217137747f},
-std::array<float,2>{0.129916281f, 0.549469292f},
-std::array<float,2>{0.701472759f, 0.454908729f},
-std::array<float,2>{0.559551716f, 0.642682016f},
-std::array<float,2>{0.0121155046f, 0.286989629f},
-std::array<float,2>{0.354274392f, 0.918786287f},
-std::array<float,2>{0.75978297f, 0.130992174f},
-std::array<float,2>{0.89620924f, 0.61750406f},
-std::array<float,2>{0.461602122f, 0.387072086f},
-std::array<float,2>{0.168602243f, 0.83023864f},
-std::array<float,2>{0.733778596f, 0.0825630352f},
-std::array<float,2>{0.515238762f, 0.956582248f},
-std::array<float,2>{0.0397481956f, 0.209366545f},
-std::array<float,2>{0.334000885f, 0.704714656f},
-std::array<float,2>{0.809857607f, 0.313373744f},
-std::array<float,2>{0.815082788f, 0.803710103f},
-std::array<float,2>{0.261154979f, 0.040191371f},
-std::array<float,2>{0.1154119f, 0.502705991f},
-std::array<float,2>{0.61888212f, 0.489595801f},
-std::array<float,2>{0.66098386f, 0.675233603f},
-std::array<float,2>{0.229150787f, 0.264416009f},
-std::array<float,2>{0.393717736f, 0.896134198f},
-std::array<float,2>{0.980780602f, 0.183666095f},
-std::array<float,2>{0.750187635f, 0.734619439f},
-std::array<float,2>{0.346260726f, 0.365843087f},
-std::array<float,2>{0.00474468898f, 0.991490781f},
-std::array<float,2>{0.549484074f, 0.242728323f},
-std::array<float,2>{0.689049244f, 0.853391111f},
-std::array<float,2>{0.138363793f, 0.106560647f},
-std::array<float,2>{0.476903141f, 0.576879978f},
-std::array<float,2>{0.926190197f, 0.433917284f},
-std::array<float,2>{0.939857721f, 0.936558902f},
-std::array<float,2>{0.42695123f, 0.146768987f},
-std::array<float,2>{0.213727936f, 0.6268062f},
-std::array<float,2>{0.625941098f, 0.299759299f},
-std::array<float,2>{0.590930462f, 0.54044199f},
-std::array<float,2>{0.0796966106f, 0.441993713f},
-std::array<float,2>{0.28399092f, 0.752076924f},
-std::array<float,2>{0.868551075f, 0.011318625f},
-std::array<float,2>{0.987380385f, 0.647119105f},
-std::array<float,2>{0.375827372f, 0.282849669f},
-std::array<float,2>{0.242653549f, 0.917105615f},
-std::array<float,2>{0.687453985f, 0.126665488f},
-std::array<float,2>{0.60515821f, 0.768994093f},
-std::array<float,2>{0.0997236148f, 0.0190149285f},
-std::array<float,2>{0.271588862f, 0.553368568f},
-std::array<float,2>{0.828199148f, 0.457774699f},
-std::array<float,2>{0.795536458f, 0.978855073f},
-std::array<float,2>{0.319344878f, 0.223131344f},
-std::array<float,2>{0.0496637411f, 0.730801582f},
-std::array<float,2>{0.530109406f, 0.35824737f},
-std::array<float,2>{0.74802649f, 0.590786755f},
-std::array<float,2>{0.178594723f, 0.41677168f},
-std::array<float,2>{0.443480372f, 0.866423428f},
-std::array<float,2>{0.889180303f, 0.112488329f},
-std::array<float,2>{0.849664152f, 0.517424405f},
-std::array<float,2>{0.298115999f, 0.472082466f},
-std::array<float,2>{0.0687168539f, 0.792957485f},
-std::array<float,2>{0.571813345f, 0.0483952649f},
-std::array<float,2>{0.654036045f, 0.877524614f},
-std::array<float,2>{0.194949061f, 0.169413745f},
-std::array<float,2>{0.409597278f, 0.65929991f},
-std::array<float,2>{0.957145274f, 0.269814432f},
-std::array<float,2>{0.916864157f, 0.819542587f},
-std::array<float,2>{0.496789426f, 0.0639763251f},
-std::array<float,2>{0.14072077f, 0.603542626f},
-std::array<float,2>{0.703950167f, 0.397998005f},
-std::array<float,2>{0.544210196f, 0.691805303f},
-std::array<float,2>{0.0282545481f, 0.333713889f},
-std::array<float,2>{0.371854067f, 0.946230292f},
-std::array<float,2>{0.772473097f, 0.196291059f},
-std::array<float,2>{0.964547396f, 0.559725821f},
-std::array<float,2>{0.416215599f, 0.461927623f},
-std::array<float,2>{0.196725667f, 0.77917707f},
-std::array<float,2>{0.645845652f, 0.0249865018f},
-std::array<float,2>{0.568878055f, 0.907513857f},
-std::array<float,2>{0.0776945278f, 0.134473324f},
-std::array<float,2>{0.307695717f, 0.652916014f},
-std::array<float,2>{0.854880929f, 0.291737735f},
-std::array<float,2>{0.778931916f, 0.873761415f},
-std::array<float,2>{0.364880681f, 0.118039854f},
-std::array<float,2>{0.020371655f, 0.580769062f},
-std::array<float,2>{0.538150609f, 0.412929475f},
-std::array<float,2>{0.716966867f, 0.725252509f},
-std::array<float,2>{0.154258996f, 0.349915087f},
-std::array<float,2>{0.490279913f, 0.97498703f},
-std::array<float,2>{0.912329376f, 0.231678203f},
-std::array<float,2>{0.839493811f, 0.664140582f},
-std::array<float,2>{0.274653405f, 0.280157775f},
-std::array<float,2>{0.104081482f, 0.888114691f},
-std::array<float,2>{0.594724417f, 0.157081783f},
-std::array<float,2>{0.674259722f, 0.788730025f},
-std::array<float,2>{0.234821647f, 0.0590560772f},
-std::array<float,2>{0.384664387f, 0.528461814f},
-std::array<float,2>{0.996182442f, 0.48219344f},
-std::array<float,2>{0.880096734f, 0.942994654f},
-std::array<float,2>{0.451999187f, 0.190421939f},
-std::array<float,2>{0.183971047f, 0.702619791f},
-std::array<float,2>{0.736484885f, 0.340111345f},
-std::array<float,2>{0.515643775f, 0.600008547f},
-std::array<float,2>{0.0580254048f, 0.401167691f},
-std::array<float,2>{0.322546452f, 0.821143329f},
-std::array<float,2>{0.783618331f, 0.0734525248f},
-std::array<float,2>{0.935484171f, 0.717888057f},
-std::array<float,2>{0.470718145f, 0.321804702f},
-std::array<float,2>{0.12708424f, 0.963861227f},
-std::array<float,2>{0.696021914f, 0.214734495f},
-std::array<float,2>{0.555874884f, 0.840021253f},
-std::array<float,2>{0.0100848898f, 0.0894972757f},
-std::array<float,2>{0.358123034f, 0.614563465f},
-std::array<float,2>{0.762151122f, 0.377951682f},
-std::array<float,2>{0.861255646f, 0.901148379f},
-std::array<float,2>{0.293371916f, 0.176777169f},
-std::array<float,2>{0.0878408775f, 0.684339106f},
-std::array<float,2>{0.579072595f, 0.255509287f},
-std::array<float,2>{0.640124917f, 0.515569568f},
-std::array<float,2>{0.20611304f, 0.498727083f},
-std::array<float,2>{0.431418538f, 0.811465085f},
-std::array<float,2>{0.95162636f, 0.0380455554f},
-std::array<float,2>{0.797438085f, 0.563342333f},
-std::array<float,2>{0.341071576f, 0.42717573f},
-std::array<float,2>{0.0338670276f, 0.845710456f},
-std::array<float,2>{0.504114449f, 0.099539198f},
-std::array<float,2>{0.722199798f, 0.994810402f},
-std::array<float,2>{0.157391563f, 0.240957245f},
-std::array<float,2>{0.459478587f, 0.748808801f},
-std::array<float,2>{0.90262568f, 0.370841652f},
-std::array<float,2>{0.969241142f, 0.76533705f},
-std::array<float,2>{0.399110556f, 0.000777708425f},
-std::array<float,2>{0.221381292f, 0.532273233f},
-std::array<float,2>{0.670171261f, 0.449035913f},
-std::array<float,2>{0.611309946f, 0.640480518f},
-std::array<float,2>{0.123612508f, 0.306092024f},
-std::array<float,2>{0.256099492f, 0.924951136f},
-std::array<float,2>{0.822993815f, 0.155888617f},
-std::array<float,2>{0.977757752f, 0.584067166f},
-std::array<float,2>{0.396030903f, 0.408390492f},
-std::array<float,2>{0.231688425f, 0.868394732f},
-std::array<float,2>{0.658556521f, 0.123447575f},
-std::array<float,2>{0.624889016f, 0.968826711f},
-std::array<float,2>{0.111144267f, 0.228565559f},
-std::array<float,2>{0.264386892f, 0.72026974f},
-std::array<float,2>{0.818076968f, 0.345903307f},
-std::array<float,2>{0.805129766f, 0.773996711f},
-std::array<float,2>{0.330492795f, 0.02957418f},
-std::array<float,2>{0.0456507541f, 0.557429671f},
-std::array<float,2>{0.507918298f, 0.466311514f},
-std::array<float,2>{0.730377674f, 0.651467979f},
-std::array<float,2>{0.165909693f, 0.293187022f},
-std::array<float,2>{0.466074049f, 0.911183417f},
-std::array<float,2>{0.893454134f, 0.140280709f},
-std::array<float,2>{0.87132144f, 0.696279049f},
-std::array<float,2>{0.287625313f, 0.337562144f},
-std::array<float,2>{0.085487403f, 0.938966274f},
-std::array<float,2>{0.589265049f, 0.193876684f},
-std::array<float,2>{0.630350053f, 0.825909376f},
-std::array<float,2>{0.217556015f, 0.0778623298f},
-std::array<float,2>{0.424033433f, 0.594469786f},
-std::array<float,2>{0.944975972f, 0.404236674f},
-std::array<float,2>{0.922118962f, 0.885853827f},
-std::array<float,2>{0.4840976f, 0.162443325f},
-std::array<float,2>{0.133673698f, 0.670099199f},
-std::array<float,2>{0.693491936f, 0.276552916f},
-std::array<float,2>{0.552399218f, 0.525940537f},
-std::array<float,2>{0.00100903516f, 0.478548259f},
-std::array<float,2>{0.348312616f, 0.784273863f},
-std::array<float,2>{0.755755603f, 0.0580482483f},
-std::array<float,2>{0.885858834f, 0.682452083f},
-std::array<float,2>{0.440300494f, 0.251742691f},
-std::array<float,2>{0.172337949f, 0.903739095f},
-std::array<float,2>{0.744395196f, 0.172619998f},
-std::array<float,2>{0.527100325f, 0.807843089f},
-std::array<float,2>{0.0508406721f, 0.0320671797f},
-std::array<float,2>{0.313502848f, 0.510742009f},
-std::array<float,2>{0.791801095f, 0.493545413f},
-std::array<float,2>{0.834561646f, 0.967784464f},
-std::array<float,2>{0.268971324f, 0.218228653f},
-std::array<float,2>{0.0950775295f, 0.712036788f},
-std::array<float,2>{0.60604471f, 0.326691955f},
-std::array<float,2>{0.682690859f, 0.611178279f},
-std::array<float,2>{0.249486566f, 0.379833549f},
-std::array<float,2>{0.379677147f, 0.837474585f},
-std::array<float,2>{0.989900351f, 0.090657264f},
-std::array<float,2>{0.76906538f, 0.535996675f},
-std::array<float,2>{0.3677423f, 0.45002836f},
-std::array<float,2>{0.0264028087f, 0.761667132f},
-std::array<float,2>{0.541902244f, 0.00765534444f},
-std::array<float,2>{0.708435535f, 0.929608285f},
-std::array<float,2>{0.14501068f, 0.150490507f},
-std::array<float,2>{0.493535995f, 0.635368228f},
-std::array<float,2>{0.919989109f, 0.310968757f},
-std::array<float,2>{0.953687191f, 0.850503922f},
-std::array<float,2>{0.412667453f, 0.0969670936f},
-std::array<float,2>{0.190442026f, 0.569527924f},
-std::array<float,2>{0.652168691f, 0.425534487f},
-std::array<float,2>{0.576847136f, 0.743679106f},
-std::array<float,2>{0.0660770312f, 0.374473214f},
-std::array<float,2>{0.303955883f, 0.997191608f},
-std::array<float,2>{0.843890667f, 0.236209542f},
-std::array<float,2>{0.909176111f, 0.506096423f},
-std::array<float,2>{0.484784007f, 0.487967461f},
-std::array<float,2>{0.15163134f, 0.797269642f},
-std::array<float,2>{0.712841392f, 0.0437473468f},
-std::array<float,2>{0.534356773f, 0.893870473f},
-std::array<float,2>{0.0157447252f, 0.179861039f},
-std::array<float,2>{0.362076223f, 0.67914623f},
-std::array<float,2>{0.776984572f, 0.261333376f},
-std::array<float,2>{0.855998695f, 0.832970977f},
-std::array<float,2>{0.310191691f, 0.0818673596f},
-std::array<float,2>{0.0729660988f, 0.624521852f},
-std::array<float,2>{0.562829971f, 0.383110732f},
-std::array<float,2>{0.641777277f, 0.708757937f},
-std::array<float,2>{0.200838283f, 0.319574147f},
-std::array<float,2>{0.421547025f, 0.958389103f},
-std::array<float,2>{0.965588272f, 0.20583345f},
-std::array<float,2>{0.787658274f, 0.632296264f},
-std::array<float,2>{0.324777901f, 0.303968012f},
-std::array<float,2>{0.0602859035f, 0.930440962f},
-std::array<float,2>{0.520099938f, 0.141951263f},
-std::array<float,2>{0.739547372f, 0.756596148f},
-std::array<float,2>{0.181255475f, 0.013252019f},
-std::array<float,2>{0.448689193f, 0.544603884f},
-std::array<float,2>{0.877718091f, 0.440162599f},
-std::array<float,2>{0.995118141f, 0.985940516f},
-std::array<float,2>{0.389463663f, 0.246378168f},
-std::array<float,2>{0.241706997f, 0.739337027f},
-std::array<float,2>{0.677111506f, 0.363254696f},
-std::array<float,2>{0.600182295f, 0.570390046f},
-std::array<float,2>{0.108168967f, 0.432798356f},
-std::array<float,2>{0.280695111f, 0.855733454f},
-std::array<float,2>{0.841599822f, 0.105063096f},
-std::array<float,2>{0.947144687f, 0.726709366f},
-std::array<float,2>{0.434331834f, 0.353616595f},
-std::array<float,2>{0.209369272f, 0.98160243f},
-std::array<float,2>{0.635073483f, 0.219807789f},
-std::array<float,2>{0.582744956f, 0.860391557f},
-std::array<float,2>{0.0916704088f, 0.114648722f},
-std::array<float,2>{0.29224053f, 0.586190224f},
-std::array<float,2>{0.864381671f, 0.420751065f},
-std::array<float,2>{0.758973956f, 0.921147466f},
-std::array<float,2>{0.352590114f, 0.129617855f},
-std::array<float,2>{0.0149866696f, 0.642106175f},
-std::array<float,2>{0.561576486f, 0.288270742f},
-std::array<float,2>{0.699918747f, 0.547663271f},
-std::array<float,2>{0.131979704f, 0.455602348f},
-std::array<float,2>{0.473841518f, 0.7723822f},
-std::array<float,2>{0.932727933f, 0.0209481046f},
-std::array<float,2>{0.826077044f, 0.605791688f},
-std::array<float,2>{0.252614915f, 0.391942084f},
-std::array<float,2>{0.121061504f, 0.815766394f},
-std::array<float,2>{0.614614725f, 0.0687253773f},
-std::array<float,2>{0.666313708f, 0.949889541f},
-std::array<float,2>{0.225465789f, 0.202351987f},
-std::array<float,2>{0.404579014f, 0.689330339f},
-std::array<float,2>{0.972897768f, 0.329544812f},
-std::array<float,2>{0.900399983f, 0.796403229f},
-std::array<float,2>{0.45463714f, 0.0517404415f},
-std::array<float,2>{0.161760345f, 0.523179829f},
-std::array<float,2>{0.72377646f, 0.473889083f},
-std::array<float,2>{0.502956212f, 0.661717296f},
-std::array<float,2>{0.0362727009f, 0.267837465f},
-std::array<float,2>{0.339261264f, 0.880143702f},
-std::array<float,2>{0.80241257f, 0.165690616f},
-std::array<float,2>{0.915377676f, 0.604643524f},
-std::array<float,2>{0.499952048f, 0.397231251f},
-std::array<float,2>{0.143204167f, 0.819111943f},
-std::array<float,2>{0.706447244f, 0.0625812188f},
-std::array<float,2>{0.54628998f, 0.946366847f},
-std::array<float,2>{0.0307631847f, 0.195410863f},
-std::array<float,2>{0.373691916f, 0.692509472f},
-std::array<float,2>{0.770129502f, 0.332541287f},
-std::array<float,2>{0.847801745f, 0.791260779f},
-std::array<float,2>{0.300391138f, 0.0469203852f},
-std::array<float,2>{0.0676570535f, 0.516166151f},
-std::array<float,2>{0.573951662f, 0.471620202f},
-std::array<float,2>{0.655641019f, 0.659179628f},
-std::array<float,2>{0.191975668f, 0.270767063f},
-std::array<float,2>{0.406871289f, 0.878492057f},
-std::array<float,2>{0.960005999f, 0.168796107f},
-std::array<float,2>{0.794641614f, 0.732350051f},
-std::array<float,2>{0.316944093f, 0.359064728f},
-std::array<float,2>{0.0472218618f, 0.979646444f},
-std::array<float,2>{0.528320014f, 0.223857284f},
-std::array<float,2>{0.748523355f, 0.865935206f},
-std::array<float,2>{0.175821453f, 0.111406863f},
-std::array<float,2>{0.442643762f, 0.591117024f},
-std::array<float,2>{0.887433887f, 0.417521417f},
-std::array<float,2>{0.985175431f, 0.91672343f},
-std::array<float,2>{0.378633767f, 0.125223294f},
-std::array<float,2>{0.244786844f, 0.648233056f},
-std::array<float,2>{0.684315503f, 0.282152086f},
-std::array<float,2>{0.60195291f, 0.554056168f},
-std::array<float,2>{0.0986259505f, 0.4587906f},
-std::array<float,2>{0.271189451f, 0.767749548f},
-std::array<float,2>{0.831669748f, 0.0185349528f},
-std::array<float,2>{0.938608468f, 0.625483751f},
-std::array<float,2>{0.427876741f, 0.300152928f},
-std::array<float,2>{0.212408751f, 0.936198711f},
-std::array<float,2>{0.627767026f, 0.14816089f},
-std::array<float,2>{0.593142688f, 0.753520548f},
-std::array<float,2>{0.080827333f, 0.0104713216f},
-std::array<float,2>{0.281503052f, 0.539347887f},
-std::array<float,2>{0.870904088f, 0.44330439f},
-std::array<float,2>{0.753537416f, 0.990591824f},
-std::array<float,2>{0.34548077f, 0.243750051f},
-std::array<float,2>{0.00768070621f, 0.735969961f},
-std::array<float,2>{0.547430813f, 0.367033273f},
-std::array<float,2>{0.689539135f, 0.57804507f},
-std::array<float,2>{0.139365882f, 0.435266316f},
-std::array<float,2>{0.479515791f, 0.851831615f},
-std::array<float,2>{0.927848816f, 0.105605327f},
-std::array<float,2>{0.813453794f, 0.50380671f},
-std::array<float,2>{0.258425593f, 0.489150584f},
-std::array<float,2>{0.114149347f, 0.804094791f},
-std::array<float,2>{0.620240033f, 0.0396424085f},
-std::array<float,2>{0.662342846f, 0.895428121f},
-std::array<float,2>{0.228495672f, 0.185140207f},
-std::array<float,2>{0.39217028f, 0.674444854f},
-std::array<float,2>{0.983602464f, 0.264748126f},
-std::array<float,2>{0.898103237f, 0.831375003f},
-std::array<float,2>{0.46483627f, 0.0832687318f},
-std::array<float,2>{0.170252815f, 0.619068503f},
-std::array<float,2>{0.730713248f, 0.387728095f},
-std::array<float,2>{0.513618112f, 0.703557253f},
-std::array<float,2>{0.0427154638f, 0.313799143f},
-std::array<float,2>{0.333462387f, 0.955825925f},
-std::array<float,2>{0.811773419f, 0.210006818f},
-std::array<float,2>{0.972599208f, 0.532101154f},
-std::array<float,2>{0.400399655f, 0.447663695f},
-std::array<float,2>{0.220601052f, 0.76452446f},
-std::array<float,2>{0.668864846f, 0.00101042876f},
-std::array<float,2>{0.612373412f, 0.924649417f},
-std::array<float,2>{0.123033904f, 0.154355437f},
-std::array<float,2>{0.255032003f, 0.63875097f},
-std::array<float,2>{0.821152806f, 0.305317491f},
-std::array<float,2>{0.798908412f, 0.84695828f},
-std::array<float,2>{0.342380762f, 0.0977901444f},
-std::array<float,2>{0.0324859172f, 0.563604534f},
-std::array<float,2>{0.506830871f, 0.425808847f},
-std::array<float,2>{0.719962537f, 0.749124527f},
-std::array<float,2>{0.158909947f, 0.369169801f},
-std::array<float,2>{0.458356053f, 0.996056259f},
-std::array<float,2>{0.904986501f, 0.241647765f},
-std::array<float,2>{0.861819625f, 0.684948206f},
-std::array<float,2>{0.296608835f, 0.254546613f},
-std::array<float,2>{0.0885281935f, 0.901399255f},
-std::array<float,2>{0.581402838f, 0.176329225f},
-std::array<float,2>{0.638208032f, 0.811952949f},
-std::array<float,2>{0.203471959f, 0.0386946313f},
-std::array<float,2>{0.432366639f, 0.513855398f},
-std::array<float,2>{0.949505687f, 0.499658614f},
-std::array<float,2>{0.937439203f, 0.964246511f},
-std::array<float,2>{0.469340622f, 0.213314116f},
-std::array<float,2>{0.125898942f, 0.717771351f},
-std::array<float,2>{0.698794961f, 0.320990503f},
-std::array<float,2>{0.558257759f, 0.613690853f},
-std::array<float,2>{0.00937580224f, 0.377447426f},
-std::array<float,2>{0.355906546f, 0.841477513f},
-std::array<float,2>{0.76469779f, 0.0879616886f},
-std::array<float,2>{0.882642269f, 0.701956749f},
-std::array<float,2>{0.450560838f, 0.341252565f},
-std::array<float,2>{0.18624498f, 0.942077875f},
-std::array<float,2>{0.73604697f, 0.191030577f},
-std::array<float,2>{0.519304097f, 0.821773767f},
-std::array<float,2>{0.0551848002f, 0.0727170259f},
-std::array<float,2>{0.320681542f, 0.600652575f},
-std::array<float,2>{0.781480014f, 0.401583284f},
-std::array<float,2>{0.836227417f, 0.887205005f},
-std::array<float,2>{0.276493549f, 0.15776214f},
-std::array<float,2>{0.102675691f, 0.666000664f},
-std::array<float,2>{0.595971763f, 0.280456036f},
-std::array<float,2>{0.67201364f, 0.52784431f},
-std::array<float,2>{0.237630159f, 0.480885595f},
-std::array<float,2>{0.386453748f, 0.787739813f},
-std::array<float,2>{0.999746919f, 0.0603294261f},
-std::array<float,2>{0.780499399f, 0.581510663f},
-std::array<float,2>{0.365861088f, 0.413871616f},
-std::array<float,2>{0.0229265001f, 0.874058306f},
-std::array<float,2>{0.536359787f, 0.11912977f},
-std::array<float,2>{0.715714395f, 0.975654423f},
-std::array<float,2>{0.155680701f, 0.231115744f},
-std::array<float,2>{0.489712834f, 0.725627661f},
-std::array<float,2>{0.910173714f, 0.351372957f},
-std::array<float,2>{0.961843789f, 0.778308332f},
-std::array<float,2>{0.414569765f, 0.0241981689f},
-std::array<float,2>{0.197960734f, 0.558634102f},
-std::array<float,2>{0.648081839f, 0.461133122f},
-std::array<float,2>{0.566471994f, 0.654216647f},
-std::array<float,2>{0.0743133947f, 0.292874426f},
-std::array<float,2>{0.305925161f, 0.906553447f},
-std::array<float,2>{0.852261364f, 0.132935241f},
-std::array<float,2>{0.956989586f, 0.56890589f},
-std::array<float,2>{0.410393685f, 0.424446315f},
-std::array<float,2>{0.188130125f, 0.851030648f},
-std::array<float,2>{0.650151908f, 0.0960330963f},
-std::array<float,2>{0.574829698f, 0.99705255f},
-std::array<float,2>{0.0637419745f, 0.234875515f},
-std::array<float,2>{0.301973522f, 0.74255985f},
-std::array<float,2>{0.846588731f, 0.373062491f},
-std::array<float,2>{0.7661286f, 0.760093808f},
-std::array<float,2>{0.369508296f, 0.00599102164f},
-std::array<float,2>{0.0252989177f, 0.536533475f},
-std::array<float,2>{0.540076494f, 0.451117247f},
-std::array<float,2>{0.709098697f, 0.63617146f},
-std::array<float,2>{0.147487223f, 0.311756641f},
-std::array<float,2>{0.494631112f, 0.927969694f},
-std::array<float,2>{0.919640064f, 0.151593283f},
-std::array<float,2>{0.833504677f, 0.711905122f},
-std::array<float,2>{0.266634911f, 0.327729076f},
-std::array<float,2>{0.0957661495f, 0.967496574f},
-std::array<float,2>{0.608025253f, 0.217420563f},
-std::array<float,2>{0.680039823f, 0.835945666f},
-std::array<float,2>{0.247424245f, 0.0911668241f},
-std::array<float,2>{0.381635249f, 0.609809756f},
-std::array<float,2>{0.991834164f, 0.38054812f},
-std::array<float,2>{0.88286382f, 0.90321064f},
-std::array<float,2>{0.438967049f, 0.173217162f},
-std::array<float,2>{0.175667256f, 0.682952762f},
-std::array<float,2>{0.743440747f, 0.250477701f},
-std::array<float,2>{0.524326086f, 0.511695266f},
-std::array<float,2>{0.0531307012f, 0.492370397f},
-std::array<float,2>{0.314918905f, 0.807455063f},
-std::array<float,2>{0.79035145f, 0.0326743573f},
-std::array<float,2>{0.924388885f, 0.671299815f},
-std::array<float,2>{0.48222661f, 0.275606662f},
-std::array<float,2>{0.1347868f, 0.885581553f},
-std::array<float,2>{0.691968262f, 0.163187087f},
-std::array<float,2>{0.55347681f, 0.783630371f},
-std::array<float,2>{0.00273610675f, 0.0568071678f},
-std::array<float,2>{0.350846231f, 0.526872873f},
-std::array<float,2>{0.757727206f, 0.480417073f},
-std::array<float,2>{0.874951959f, 0.937524021f},
-std::array<float,2>{0.286732316f, 0.194907293f},
-std::array<float,2>{0.0821555033f, 0.6969347f},
-std::array<float,2>{0.586359859f, 0.336192667f},
-std::array<float,2>{0.630949497f, 0.5950495f},
-std::array<float,2>{0.215922236f, 0.402534813f},
-std::array<float,2>{0.423066467f, 0.824509025f},
-std::array<float,2>{0.943047702f, 0.0764693692f},
-std::array<float,2>{0.807117999f, 0.558330476f},
-std::array<float,2>{0.329961717f, 0.465603113f},
-std::array<float,2>{0.0434487462f, 0.775332153f},
-std::array<float,2>{0.509942114f, 0.0310884751f},
-std::array<float,2>{0.727030694f, 0.910177171f},
-std::array<float,2>{0.166815206f, 0.139393166f},
-std::array<float,2>{0.467999101f, 0.651170731f},
-std::array<float,2>{0.892420173f, 0.294906735f},
-std::array<float,2>{0.980191767f, 0.868106127f},
-std::array<float,2>{0.397982359f, 0.124995239f},
-std::array<float,2>{0.234315276f, 0.58526206f},
-std::array<float,2>{0.656317413f, 0.409764618f},
-std::array<float,2>{0.621628523f, 0.718841136f},
-std::array<float,2>{0.112406932f, 0.347396344f},
-std::array<float,2>{0.26203686f, 0.970459461f},
-std::array<float,2>{0.820126235f, 0.230205119f},
-std::array<float,2>{0.899968565f, 0.521680772f},
-std::array<float,2>{0.45683983f, 0.473258197f},
-std::array<float,2>{0.162863404f, 0.795136034f},
-std::array<float,2>{0.72489953f, 0.0525298305f},
-std::array<float,2>{0.501388609f, 0.879321218f},
-std::array<float,2>{0.037979424f, 0.164511651f},
-std::array<float,2>{0.336628675f, 0.660705626f},
-std::array<float,2>{0.804576278f, 0.269388199f},
-std::array<float,2>{0.827100992f, 0.814744115f},
-std::array<float,2>{0.251113296f, 0.0700819939f},
-std::array<float,2>{0.118723705f, 0.606470466f},
-std::array<float,2>{0.615782559f, 0.391230255f},
-std::array<float,2>{0.664923251f, 0.68802458f},
-std::array<float,2>{0.223758593f, 0.328477472f},
-std::array<float,2>{0.403176159f, 0.950550258f},
-std::array<float,2>{0.9753443f, 0.201345608f},
-std::array<float,2>{0.761077702f, 0.640650928f},
-std::array<float,2>{0.354539245f, 0.287554383f},
-std::array<float,2>{0.0130022466f, 0.920691431f},
-std::array<float,2>{0.559616268f, 0.130463392f},
-std::array<float,2>{0.702486813f, 0.773061275f},
-std::array<float,2>{0.129764885f, 0.0204559695f},
-std::array<float,2>{0.476539582f, 0.548535228f},
-std::array<float,2>{0.931101859f, 0.456783772f},
-std::array<float,2>{0.948580384f, 0.981414378f},
-std::array<float,2>{0.435670882f, 0.219112933f},
-std::array<float,2>{0.207823992f, 0.728363097f},
-std::array<float,2>{0.632971764f, 0.354518324f},
-std::array<float,2>{0.584952176f, 0.587819695f},
-std::array<float,2>{0.0923524424f, 0.42094785f},
-std::array<float,2>{0.290147722f, 0.859921455f},
-std::array<float,2>{0.866347551f, 0.113471068f},
-std::array<float,2>{0.992389798f, 0.739252746f},
-std::array<float,2>{0.388287425f, 0.361738443f},
-std::array<float,2>{0.239088133f, 0.984907448f},
-std::array<float,2>{0.677836001f, 0.24781698f},
-std::array<float,2>{0.598837793f, 0.857342899f},
-std::array<float,2>{0.106366284f, 0.103832915f},
-std::array<float,2>{0.278340399f, 0.571470678f},
-std::array<float,2>{0.84206295f, 0.432068825f},
-std::array<float,2>{0.785966277f, 0.930894792f},
-std::array<float,2>{0.326354235f, 0.140951753f},
-std::array<float,2>{0.0618142597f, 0.631279469f},
-std::array<float,2>{0.521685243f, 0.303604335f},
-std::array<float,2>{0.741183698f, 0.543864012f},
-std::array<float,2>{0.183138251f, 0.440448403f},
-std::array<float,2>{0.446387529f, 0.757776678f},
-std::array<float,2>{0.876112938f, 0.0117989471f},
-std::array<float,2>{0.857578397f, 0.623312354f},
-std::array<float,2>{0.311716557f, 0.384015918f},
-std::array<float,2>{0.071864292f, 0.833167493f},
-std::array<float,2>{0.565622509f, 0.0801316574f},
-std::array<float,2>{0.643314898f, 0.957309127f},
-std::array<float,2>{0.201437026f, 0.206327274f},
-std::array<float,2>{0.419394821f, 0.707468152f},
-std::array<float,2>{0.968456447f, 0.319094151f},
-std::array<float,2>{0.907032609f, 0.798575997f},
-std::array<float,2>{0.486459643f, 0.0445869565f},
-std::array<float,2>{0.148680717f, 0.507062912f},
-std::array<float,2>{0.713473916f, 0.487084061f},
-std::array<float,2>{0.532243967f, 0.678171039f},
-std::array<float,2>{0.0182168558f, 0.259904176f},
-std::array<float,2>{0.36059919f, 0.892683506f},
-std::array<float,2>{0.774489343f, 0.180973008f},
-std::array<float,2>{0.889743388f, 0.592895567f},
-std::array<float,2>{0.445185274f, 0.414377064f},
-std::array<float,2>{0.178902f, 0.863447666f},
-std::array<float,2>{0.746787906f, 0.10995084f},
-std::array<float,2>{0.530730546f, 0.977913678f},
-std::array<float,2>{0.0507789627f, 0.22619766f},
-std::array<float,2>{0.318553329f, 0.733101189f},
-std::array<float,2>{0.796215177f, 0.35547331f},
-std::array<float,2>{0.829647362f, 0.766681194f},
-std::array<float,2>{0.272998482f, 0.0173068009f},
-std::array<float,2>{0.100779735f, 0.552000463f},
-std::array<float,2>{0.604491115f, 0.459735632f},
-std::array<float,2>{0.685681641f, 0.645677686f},
-std::array<float,2>{0.243386269f, 0.28346321f},
-std::array<float,2>{0.376585305f, 0.915593386f},
-std::array<float,2>{0.986728847f, 0.128292054f},
-std::array<float,2>{0.77206099f, 0.694448769f},
-std::array<float,2>{0.372206628f, 0.335269451f},
-std::array<float,2>{0.0288577378f, 0.947277606f},
-std::array<float,2>{0.543936074f, 0.198691502f},
-std::array<float,2>{0.70422101f, 0.817479253f},
-std::array<float,2>{0.14243488f, 0.0646788031f},
-std::array<float,2>{0.497524112f, 0.602564991f},
-std::array<float,2>{0.917111397f, 0.396271437f},
-std::array<float,2>{0.95826292f, 0.875305772f},
-std::array<float,2>{0.408945292f, 0.170461342f},
-std::array<float,2>{0.194305047f, 0.656743824f},
-std::array<float,2>{0.653299928f, 0.272741854f},
-std::array<float,2>{0.570919633f, 0.51771456f},
-std::array<float,2>{0.0697215199f, 0.469956934f},
-std::array<float,2>{0.297242045f, 0.790861964f},
-std::array<float,2>{0.850638092f, 0.048911538f},
-std::array<float,2>{0.981540382f, 0.6726349f},
-std::array<float,2>{0.393465519f, 0.263130993f},
-std::array<float,2>{0.229759023f, 0.897714138f},
-std::array<float,2>{0.661998153f, 0.186862752f},
-std::array<float,2>{0.617959678f, 0.801909089f},
-std::array<float,2>{0.116601996f, 0.0412568524f},
-std::array<float,2>{0.259925663f, 0.500151277f},
-std::array<float,2>{0.815918148f, 0.491220862f},
-std::array<float,2>{0.809085429f, 0.954648733f},
-std::array<float,2>{0.335519463f, 0.208796173f},
-std::array<float,2>{0.0401929058f, 0.706733346f},
-std::array<float,2>{0.513754487f, 0.31467396f},
-std::array<float,2>{0.732569218f, 0.620212376f},
-std::array<float,2>{0.169207796f, 0.389098972f},
-std::array<float,2>{0.461914539f, 0.829048336f},
-std::array<float,2>{0.895164847f, 0.0856137276f},
-std::array<float,2>{0.867452443f, 0.541279495f},
-std::array<float,2>{0.28467828f, 0.444934815f},
-std::array<float,2>{0.0784494877f, 0.751180589f},
-std::array<float,2>{0.58998096f, 0.00959385931f},
-std::array<float,2>{0.626210093f, 0.933953702f},
-std::array<float,2>{0.214317441f, 0.144680887f},
-std::array<float,2>{0.42654115f, 0.627941251f},
-std::array<float,2>{0.9405092f, 0.298164248f},
-std::array<float,2>{0.927338779f, 0.854438722f},
-std::array<float,2>{0.47814998f, 0.108320177f},
-std::array<float,2>{0.136776686f, 0.575943589f},
-std::array<float,2>{0.687752247f, 0.436764777f},
-std::array<float,2>{0.549938262f, 0.737489939f},
-std::array<float,2>{0.00564671587f, 0.365056723f},
-std::array<float,2>{0.347151786f, 0.990207016f},
-std::array<float,2>{0.751001835f, 0.244375825f},
-std::array<float,2>{0.952203453f, 0.511903465f},
-std::array<float,2>{0.43019864f, 0.497050017f},
-std::array<float,2>{0.205920383f, 0.809869587f},
-std::array<float,2>{0.6391747f, 0.0359604731f},
-std::array<float,2>{0.579116523f, 0.899028003f},
-std::array<float,2>{0.0860842019f, 0.179075316f},
-std::array<float,2>{0.294905245f, 0.686509907f},
-std::array<float,2>{0.860340714f, 0.256766975f},
-std::array<float,2>{0.763621628f, 0.842750132f},
-std::array<float,2>{0.358803302f, 0.0872656554f},
-std::array<float,2>{0.0110541815f, 0.616709232f},
-std::array<float,2>{0.555430353f, 0.375062197f},
-std::array<float,2>{0.696442008f, 0.716530323f},
-std::array<float,2>{0.128153488f, 0.322775781f},
-std::array<float,2>{0.472405165f, 0.961325824f},
-std::array<float,2>{0.93426919f, 0.21095252f},
-std::array<float,2>{0.823771834f, 0.637091517f},
-std::array<float,2>{0.257612467f, 0.306707203f},
-std::array<float,2>{0.124828026f, 0.923800886f},
-std::array<float,2>{0.610311866f, 0.15355289f},
-std::array<float,2>{0.671656549f, 0.763194621f},
-std::array<float,2>{0.22220847f, 0.00299739372f},
-std::array<float,2>{0.399639755f, 0.534193993f},
-std::array<float,2>{0.970022976f, 0.447231621f},
-std::array<float,2>{0.903905749f, 0.993990004f},
-std::array<float,2>{0.460215092f, 0.239538163f},
-std::array<float,2>{0.157152086f, 0.747024417f},
-std::array<float,2>{0.721373498f, 0.367753297f},
-std::array<float,2>{0.505155385f, 0.564850748f},
-std::array<float,2>{0.0349399894f, 0.429116398f},
-std::array<float,2>{0.340077192f, 0.845125854f},
-std::array<float,2>{0.798261404f, 0.101043426f},
-std::array<float,2>{0.913172781f, 0.723702073f},
-std::array<float,2>{0.492028236f, 0.348986596f},
-std::array<float,2>{0.152916878f, 0.973707676f},
-std::array<float,2>{0.718497574f, 0.234118029f},
-std::array<float,2>{0.537794352f, 0.872405529f},
-std::array<float,2>{0.020600358f, 0.119731002f},
-std::array<float,2>{0.363983363f, 0.578215718f},
-std::array<float,2>{0.777841628f, 0.410627991f},
-std::array<float,2>{0.853789032f, 0.909844398f},
-std::array<float,2>{0.306844205f, 0.136162654f},
-std::array<float,2>{0.0762804896f, 0.654413462f},
-std::array<float,2>{0.570097804f, 0.290035278f},
-std::array<float,2>{0.645017326f, 0.562337279f},
-std::array<float,2>{0.196094513f, 0.464379758f},
-std::array<float,2>{0.417045653f, 0.780512333f},
-std::array<float,2>{0.963686883f, 0.0268402714f},
-std::array<float,2>{0.785090327f, 0.597784698f},
-std::array<float,2>{0.323448896f, 0.399528921f},
-std::array<float,2>{0.0573089495f, 0.823235929f},
-std::array<float,2>{0.517227709f, 0.0712057799f},
-std::array<float,2>{0.73826015f, 0.944223106f},
-std::array<float,2>{0.184743226f, 0.188452512f},
-std::array<float,2>{0.452286452f, 0.699426889f},
-std::array<float,2>{0.879645824f, 0.34273392f},
-std::array<float,2>{0.997197449f, 0.786772013f},
-std::array<float,2>{0.383422047f, 0.0612440668f},
-std::array<float,2>{0.235974148f, 0.530564249f},
-std::array<float,2>{0.675709486f, 0.48268342f},
-std::array<float,2>{0.594796598f, 0.667042613f},
-std::array<float,2>{0.10489849f, 0.278099656f},
-std::array<float,2>{0.27428773f, 0.889438987f},
-std::array<float,2>{0.838645041f, 0.158320785f},
-std::array<float,2>{0.988962471f, 0.611616254f},
-std::array<float,2>{0.380805433f, 0.382719785f},
-std::array<float,2>{0.248224735f, 0.839084923f},
-std::array<float,2>{0.68165648f, 0.0927332193f},
-std::array<float,2>{0.607189655f, 0.965754688f},
-std::array<float,2>{0.0940760896f, 0.215154663f},
-std::array<float,2>{0.267590374f, 0.714000881f},
-std::array<float,2>{0.835788667f, 0.325777113f},
-std::array<float,2>{0.792244077f, 0.805484235f},
-std::array<float,2>{0.313406378f, 0.0335494876f},
-std::array<float,2>{0.052164305f, 0.508638561f},
-std::array<float,2>{0.525535166f, 0.495666325f},
-std::array<float,2>{0.74604708f, 0.680508435f},
-std::array<float,2>{0.173349574f, 0.253853679f},
-std::array<float,2>{0.440920234f, 0.904755175f},
-std::array<float,2>{0.885639787f, 0.174230501f},
-std::array<float,2>{0.844804227f, 0.74503386f},
-std::array<float,2>{0.303040236f, 0.371443927f},
-std::array<float,2>{0.0645530969f, 0.998732924f},
-std::array<float,2>{0.577890515f, 0.237940535f},
-std::array<float,2>{0.65064472f, 0.849071622f},
-std::array<float,2>{0.190427184f, 0.0947066918f},
-std::array<float,2>{0.413758129f, 0.567509055f},
-std::array<float,2>{0.954609573f, 0.421880811f},
-std::array<float,2>{0.921502709f, 0.925981283f},
-std::array<float,2>{0.492556572f, 0.148945928f},
-std::array<float,2>{0.145667493f, 0.632995248f},
-std::array<float,2>{0.707249224f, 0.309613764f},
-std::array<float,2>{0.542613983f, 0.538368881f},
-std::array<float,2>{0.0259565245f, 0.452600807f},
-std::array<float,2>{0.36872372f, 0.759344637f},
-std::array<float,2>{0.768137634f, 0.00465670787f},
-std::array<float,2>{0.893838227f, 0.65038991f},
-std::array<float,2>{0.465586066f, 0.295654982f},
-std::array<float,2>{0.164671734f, 0.913150072f},
-std::array<float,2>{0.729073107f, 0.137037322f},
-std::array<float,2>{0.509162545f, 0.77707684f},
-std::array<float,2>{0.0466149785f, 0.0292415526f},
-std::array<float,2>{0.332014352f, 0.555077672f},
-std::array<float,2>{0.806414902f, 0.466947436f},
-std::array<float,2>{0.816952229f, 0.97159946f},
-std::array<float,2>{0.265027165f, 0.227920264f},
-std::array<float,2>{0.109736376f, 0.722163975f},
-std::array<float,2>{0.62315774f, 0.344770402f},
-std::array<float,2>{0.659850955f, 0.583468318f},
-std::array<float,2>{0.231109977f, 0.407077372f},
-std::array<float,2>{0.394842446f, 0.870918751f},
-std::array<float,2>{0.977179706f, 0.122904986f},
-std::array<float,2>{0.754543841f, 0.523510873f},
-std::array<float,2>{0.349578917f, 0.476634771f},
-std::array<float,2>{0.000749754254f, 0.781649232f},
-std::array<float,2>{0.551118255f, 0.0556556545f},
-std::array<float,2>{0.695157528f, 0.883595884f},
-std::array<float,2>{0.134611577f, 0.161210328f},
-std::array<float,2>{0.482582957f, 0.66897434f},
-std::array<float,2>{0.923111737f, 0.274889082f},
-std::array<float,2>{0.943707466f, 0.826261461f},
-std::array<float,2>{0.425650835f, 0.0755989477f},
-std::array<float,2>{0.217978612f, 0.596118629f},
-std::array<float,2>{0.62972486f, 0.404633582f},
-std::array<float,2>{0.587981224f, 0.69912976f},
-std::array<float,2>{0.0845708996f, 0.338001609f},
-std::array<float,2>{0.288562924f, 0.94077903f},
-std::array<float,2>{0.872772634f, 0.191666871f},
-std::array<float,2>{0.932413042f, 0.550027668f},
-std::array<float,2>{0.473173141f, 0.454038322f},
-std::array<float,2>{0.131791726f, 0.769655824f},
-std::array<float,2>{0.700791001f, 0.0226916894f},
-std::array<float,2>{0.561472714f, 0.919095516f},
-std::array<float,2>{0.0146233831f, 0.132151678f},
-std::array<float,2>{0.352256924f, 0.644375801f},
-std::array<float,2>{0.75818187f, 0.285571516f},
-std::array<float,2>{0.864006281f, 0.862348676f},
-std::array<float,2>{0.291332185f, 0.1167771f},
-std::array<float,2>{0.0898638517f, 0.589765787f},
-std::array<float,2>{0.583782196f, 0.419140369f},
-std::array<float,2>{0.636660874f, 0.729577243f},
-std::array<float,2>{0.210155323f, 0.353251487f},
-std::array<float,2>{0.434882045f, 0.984065533f},
-std::array<float,2>{0.945471823f, 0.220932499f},
-std::array<float,2>{0.801156998f, 0.66383034f},
-std::array<float,2>{0.338293791f, 0.266179711f},
-std::array<float,2>{0.0356203988f, 0.882751644f},
-std::array<float,2>{0.502163053f, 0.16775018f},
-std::array<float,2>{0.722659767f, 0.793044686f},
-std::array<float,2>{0.160813481f, 0.0536735579f},
-std::array<float,2>{0.453560054f, 0.519724607f},
-std::array<float,2>{0.90157187f, 0.476359963f},
-std::array<float,2>{0.973704219f, 0.952691257f},
-std::array<float,2>{0.405275196f, 0.199672207f},
-std::array<float,2>{0.225885317f, 0.690184772f},
-std::array<float,2>{0.66759485f, 0.330548495f},
-std::array<float,2>{0.614238679f, 0.607899427f},
-std::array<float,2>{0.120027132f, 0.392640322f},
-std::array<float,2>{0.25388661f, 0.813843071f},
-std::array<float,2>{0.824240327f, 0.0678467378f},
-std::array<float,2>{0.966355383f, 0.709035993f},
-std::array<float,2>{0.420146555f, 0.316818595f},
-std::array<float,2>{0.199896708f, 0.960245252f},
-std::array<float,2>{0.640960574f, 0.203381136f},
-std::array<float,2>{0.564254642f, 0.835827768f},
-std::array<float,2>{0.0734061152f, 0.0793121383f},
-std::array<float,2>{0.309487402f, 0.621594012f},
-std::array<float,2>{0.85691607f, 0.386150002f},
-std::array<float,2>{0.775780678f, 0.891156197f},
-std::array<float,2>{0.362655818f, 0.182182699f},
-std::array<float,2>{0.0167384949f, 0.676322997f},
-std::array<float,2>{0.533558786f, 0.25781399f},
-std::array<float,2>{0.711501122f, 0.505606174f},
-std::array<float,2>{0.150681421f, 0.484897822f},
-std::array<float,2>{0.486319661f, 0.799008548f},
-std::array<float,2>{0.909281969f, 0.0454930998f},
-std::array<float,2>{0.839931428f, 0.574071765f},
-std::array<float,2>{0.280075222f, 0.43074739f},
-std::array<float,2>{0.10937012f, 0.858033717f},
-std::array<float,2>{0.601195395f, 0.102080725f},
-std::array<float,2>{0.676066995f, 0.98745203f},
-std::array<float,2>{0.240310892f, 0.248184144f},
-std::array<float,2>{0.389991462f, 0.741985798f},
-std::array<float,2>{0.994685531f, 0.360817164f},
-std::array<float,2>{0.878113151f, 0.754532039f},
-std::array<float,2>{0.447359145f, 0.0151682291f},
-std::array<float,2>{0.179919064f, 0.546735764f},
-std::array<float,2>{0.739013612f, 0.439333469f},
-std::array<float,2>{0.520679832f, 0.629677892f},
-std::array<float,2>{0.0591875911f, 0.301308572f},
-std::array<float,2>{0.325609565f, 0.933539689f},
-std::array<float,2>{0.788680434f, 0.143495217f},
-std::array<float,2>{0.910843551f, 0.578827024f},
-std::array<float,2>{0.490121514f, 0.411000073f},
-std::array<float,2>{0.155877113f, 0.872580647f},
-std::array<float,2>{0.714940071f, 0.119519718f},
-std::array<float,2>{0.537062585f, 0.97417295f},
-std::array<float,2>{0.0230233315f, 0.23341009f},
-std::array<float,2>{0.365512639f, 0.724413037f},
-std::array<float,2>{0.780787706f, 0.349132091f},
-std::array<float,2>{0.851723075f, 0.780998051f},
-std::array<float,2>{0.306366175f, 0.0270292815f},
-std::array<float,2>{0.0750221908f, 0.561606526f},
-std::array<float,2>{0.567282915f, 0.464267552f},
-std::array<float,2>{0.64784205f, 0.654800296f},
-std::array<float,2>{0.197433308f, 0.289394557f},
-std::array<float,2>{0.414106965f, 0.909316778f},
-std::array<float,2>{0.961124182f, 0.136349395f},
-std::array<float,2>{0.781851888f, 0.699862599f},
-std::array<float,2>{0.321030706f, 0.342188895f},
-std::array<float,2>{0.055008322f, 0.943371892f},
-std::array<float,2>{0.518718183f, 0.187672406f},
-std::array<float,2>{0.735674322f, 0.822355449f},
-std::array<float,2>{0.185846463f, 0.0705809444f},
-std::array<float,2>{0.45093286f, 0.598580062f},
-std::array<float,2>{0.881944239f, 0.399990976f},
-std::array<float,2>{0.999073803f, 0.888976336f},
-std::array<float,2>{0.385815114f, 0.159117281f},
-std::array<float,2>{0.237924233f, 0.667904735f},
-std::array<float,2>{0.672392011f, 0.277499974f},
-std::array<float,2>{0.596231699f, 0.531020403f},
-std::array<float,2>{0.103042878f, 0.483093321f},
-std::array<float,2>{0.277012855f, 0.786456168f},
-std::array<float,2>{0.836736143f, 0.0609939173f},
-std::array<float,2>{0.949974179f, 0.686011493f},
-std::array<float,2>{0.431670874f, 0.255987257f},
-std::array<float,2>{0.203888312f, 0.898857653f},
-std::array<float,2>{0.637976706f, 0.179388002f},
-std::array<float,2>{0.58175528f, 0.810432017f},
-std::array<float,2>{0.0881107077f, 0.0354772694f},
-std::array<float,2>{0.296124786f, 0.512513697f},
-std::array<float,2>{0.861799896f, 0.496419162f},
-std::array<float,2>{0.765428424f, 0.96162951f},
-std::array<float,2>{0.356129557f, 0.211671755f},
-std::array<float,2>{0.00910092238f, 0.716243029f},
-std::array<float,2>{0.557896078f, 0.322321713f},
-std::array<float,2>{0.698360741f, 0.616421402f},
-std::array<float,2>{0.125032172f, 0.375779569f},
-std::array<float,2>{0.469010741f, 0.841904104f},
-std::array<float,2>{0.936943293f, 0.0875363648f},
-std::array<float,2>{0.820386052f, 0.534805477f},
-std::array<float,2>{0.255812556f, 0.446507275f},
-std::array<float,2>{0.122125499f, 0.762889802f},
-std::array<float,2>{0.613059878f, 0.00356389279f},
-std::array<float,2>{0.668173432f, 0.922988355f},
-std::array<float,2>{0.219876722f, 0.154115915f},
-std::array<float,2>{0.40117541f, 0.637238443f},
-std::array<float,2>{0.971914887f, 0.307330668f},
-std::array<float,2>{0.904522121f, 0.845549226f},
-std::array<float,2>{0.458901584f, 0.101357721f},
-std::array<float,2>{0.158232644f, 0.56524384f},
-std::array<float,2>{0.720408499f, 0.429337651f},
-std::array<float,2>{0.506165087f, 0.746243715f},
-std::array<float,2>{0.0327807553f, 0.367510766f},
-std::array<float,2>{0.341888368f, 0.993627369f},
-std::array<float,2>{0.799491286f, 0.239909634f},
-std::array<float,2>{0.984198093f, 0.500659823f},
-std::array<float,2>{0.391858041f, 0.491710603f},
-std::array<float,2>{0.227614462f, 0.802319527f},
-std::array<float,2>{0.662842155f, 0.0416357405f},
-std::array<float,2>{0.620907605f, 0.89807725f},
-std::array<float,2>{0.113290414f, 0.18743743f},
-std::array<float,2>{0.258085787f, 0.672138035f},
-std::array<float,2>{0.812675953f, 0.263647139f},
-std::array<float,2>{0.812162936f, 0.828509033f},
-std::array<float,2>{0.33367455f, 0.0852363929f},
-std::array<float,2>{0.0424256809f, 0.620905697f},
-std::array<float,2>{0.512978196f, 0.389433414f},
-std::array<float,2>{0.730995655f, 0.706208527f},
-std::array<float,2>{0.170560583f, 0.314975172f},
-std::array<float,2>{0.464131117f, 0.954359412f},
-std::array<float,2>{0.897634447f, 0.208256915f},
-std::array<float,2>{0.870270133f, 0.628611743f},
-std::array<float,2>{0.281793267f, 0.298437357f},
-std::array<float,2>{0.0805472657f, 0.934157133f},
-std::array<float,2>{0.593332887f, 0.145248741f},
-std::array<float,2>{0.626971662f, 0.751524925f},
-std::array<float,2>{0.2121225f, 0.00917599536f},
-std::array<float,2>{0.428410977f, 0.541801989f},
-std::array<float,2>{0.939378142f, 0.444549799f},
-std::array<float,2>{0.928545117f, 0.989582181f},
-std::array<float,2>{0.480383128f, 0.24476026f},
-std::array<float,2>{0.138994902f, 0.738185227f},
-std::array<float,2>{0.6901474f, 0.364328414f},
-std::array<float,2>{0.547139466f, 0.575259447f},
-std::array<float,2>{0.00696878182f, 0.437469929f},
-std::array<float,2>{0.345024645f, 0.853806973f},
-std::array<float,2>{0.752951026f, 0.107521735f},
-std::array<float,2>{0.886977851f, 0.732472479f},
-std::array<float,2>{0.442949116f, 0.35597679f},
-std::array<float,2>{0.176496357f, 0.978329659f},
-std::array<float,2>{0.74869734f, 0.225627556f},
-std::array<float,2>{0.527529657f, 0.863826692f},
-std::array<float,2>{0.0475805886f, 0.109524176f},
-std::array<float,2>{0.316412866f, 0.593348086f},
-std::array<float,2>{0.794368029f, 0.414841145f},
-std::array<float,2>{0.831278861f, 0.915217757f},
-std::array<float,2>{0.2705158f, 0.12864168f},
-std::array<float,2>{0.0978078544f, 0.646261215f},
-std::array<float,2>{0.602335095f, 0.28399539f},
-std::array<float,2>{0.68389684f, 0.552358925f},
-std::array<float,2>{0.244343162f, 0.458987087f},
-std::array<float,2>{0.378181666f, 0.767296553f},
-std::array<float,2>{0.984428942f, 0.0166149642f},
-std::array<float,2>{0.769945383f, 0.603433371f},
-std::array<float,2>{0.37305069f, 0.395949721f},
-std::array<float,2>{0.0306941159f, 0.818346083f},
-std::array<float,2>{0.546424031f, 0.0652861446f},
-std::array<float,2>{0.706848323f, 0.94795841f},
-std::array<float,2>{0.142824844f, 0.19877103f},
-std::array<float,2>{0.499255925f, 0.694928229f},
-std::array<float,2>{0.915842831f, 0.335570991f},
-std::array<float,2>{0.960578322f, 0.790337324f},
-std::array<float,2>{0.406698138f, 0.0493374281f},
-std::array<float,2>{0.191575021f, 0.518458009f},
-std::array<float,2>{0.65610373f, 0.470701784f},
-std::array<float,2>{0.57333231f, 0.65662533f},
-std::array<float,2>{0.0680562034f, 0.273066193f},
-std::array<float,2>{0.299900174f, 0.875891268f},
-std::array<float,2>{0.84827435f, 0.170178145f},
-std::array<float,2>{0.968063772f, 0.621516883f},
-std::array<float,2>{0.419579566f, 0.386712909f},
-std::array<float,2>{0.201749101f, 0.835333824f},
-std::array<float,2>{0.643018901f, 0.0796428919f},
-std::array<float,2>{0.566081703f, 0.960829377f},
-std::array<float,2>{0.0717613026f, 0.203764588f},
-std::array<float,2>{0.312122047f, 0.709804296f},
-std::array<float,2>{0.858019352f, 0.317095429f},
-std::array<float,2>{0.775118113f, 0.799711108f},
-std::array<float,2>{0.361126602f, 0.0450378135f},
-std::array<float,2>{0.0176363867f, 0.505210459f},
-std::array<float,2>{0.532761097f, 0.48452571f},
-std::array<float,2>{0.713093638f, 0.676192284f},
-std::array<float,2>{0.148963705f, 0.258630365f},
-std::array<float,2>{0.487114429f, 0.891068161f},
-std::array<float,2>{0.906310618f, 0.181736976f},
-std::array<float,2>{0.84239912f, 0.741228402f},
-std::array<float,2>{0.278855056f, 0.361305356f},
-std::array<float,2>{0.10552679f, 0.988193512f},
-std::array<float,2>{0.599323094f, 0.248737022f},
-std::array<float,2>{0.678349197f, 0.857657254f},
-std::array<float,2>{0.238617346f, 0.101977706f},
-std::array<float,2>{0.387975067f, 0.573691845f},
-std::array<float,2>{0.99267596f, 0.431467563f},
-std::array<float,2>{0.87691164f, 0.932726622f},
-std::array<float,2>{0.446998507f, 0.142821565f},
-std::array<float,2>{0.182647765f, 0.629374921f},
-std::array<float,2>{0.740553498f, 0.300881892f},
-std::array<float,2>{0.522026241f, 0.545922875f},
-std::array<float,2>{0.0621555485f, 0.438680977f},
-std::array<float,2>{0.326941997f, 0.754100323f},
-std::array<float,2>{0.785268068f, 0.0149944779f},
-std::array<float,2>{0.931447685f, 0.64402163f},
-std::array<float,2>{0.475950003f, 0.286021948f},
-std::array<float,2>{0.129264161f, 0.91983819f},
-std::array<float,2>{0.703077137f, 0.132490411f},
-std::array<float,2>{0.560185313f, 0.770035744f},
-std::array<float,2>{0.0135888532f, 0.0229632221f},
-std::array<float,2>{0.355011463f, 0.550614059f},
-std::array<float,2>{0.761266947f, 0.45314303f},
-std::array<float,2>{0.866728604f, 0.983722866f},
-std::array<float,2>{0.290687263f, 0.221558198f},
-std::array<float,2>{0.0920265391f, 0.730426788f},
-std::array<float,2>{0.584339738f, 0.352711767f},
-std::array<float,2>{0.633334279f, 0.589100122f},
-std::array<float,2>{0.207409725f, 0.419502527f},
-std::array<float,2>{0.436050624f, 0.86288327f},
-std::array<float,2>{0.948841691f, 0.116446055f},
-std::array<float,2>{0.803762913f, 0.520079732f},
-std::array<float,2>{0.336025983f, 0.47599709f},
-std::array<float,2>{0.037131615f, 0.793911159f},
-std::array<float,2>{0.501553476f, 0.0529457517f},
-std::array<float,2>{0.725396574f, 0.882272899f},
-std::array<float,2>{0.16224502f, 0.167409673f},
-std::array<float,2>{0.456116915f, 0.663169265f},
-std::array<float,2>{0.899707377f, 0.266025871f},
-std::array<float,2>{0.974827945f, 0.814191222f},
-std::array<float,2>{0.402609557f, 0.0679266229f},
-std::array<float,2>{0.224367112f, 0.608348131f},
-std::array<float,2>{0.664341271f, 0.393486381f},
-std::array<float,2>{0.615257919f, 0.689892113f},
-std::array<float,2>{0.118629739f, 0.330568403f},
-std::array<float,2>{0.251829535f, 0.952361345f},
-std::array<float,2>{0.826306283f, 0.199779421f},
-std::array<float,2>{0.891687512f, 0.555341303f},
-std::array<float,2>{0.468396187f, 0.467732549f},
-std::array<float,2>{0.16643019f, 0.776805758f},
-std::array<float,2>{0.727528811f, 0.0283763334f},
-std::array<float,2>{0.510491669f, 0.914040327f},
-std::array<float,2>{0.0436504073f, 0.137381569f},
-std::array<float,2>{0.329241455f, 0.649460673f},
-std::array<float,2>{0.807209134f, 0.295259148f},
-std::array<float,2>{0.819478333f, 0.870163798f},
-std::array<float,2>{0.262555718f, 0.122450195f},
-std::array<float,2>{0.112950273f, 0.583773553f},
-std::array<float,2>{0.621523321f, 0.406439424f},
-std::array<float,2>{0.657006502f, 0.722559154f},
-std::array<float,2>{0.233571574f, 0.345634103f},
-std::array<float,2>{0.397635639f, 0.970796525f},
-std::array<float,2>{0.97965318f, 0.22816363f},
-std::array<float,2>{0.757277131f, 0.669889748f},
-std::array<float,2>{0.351275861f, 0.275367469f},
-std::array<float,2>{0.0024079124f, 0.882861435f},
-std::array<float,2>{0.55295223f, 0.161636785f},
-std::array<float,2>{0.691861391f, 0.781895101f},
-std::array<float,2>{0.135409027f, 0.0550366789f},
-std::array<float,2>{0.4815346f, 0.524018705f},
-std::array<float,2>{0.924160838f, 0.477375269f},
-std::array<float,2>{0.94261229f, 0.941078067f},
-std::array<float,2>{0.423589945f, 0.191975221f},
-std::array<float,2>{0.216485798f, 0.698656678f},
-std::array<float,2>{0.631358683f, 0.338762373f},
-std::array<float,2>{0.586750269f, 0.596649766f},
-std::array<float,2>{0.0828287601f, 0.404851526f},
-std::array<float,2>{0.286567986f, 0.827082753f},
-std::array<float,2>{0.874412179f, 0.0761341453f},
-std::array<float,2>{0.99140358f, 0.714767754f},
-std::array<float,2>{0.380996019f, 0.325501561f},
-std::array<float,2>{0.247895092f, 0.964874744f},
-std::array<float,2>{0.680450439f, 0.215680167f},
-std::array<float,2>{0.607903838f, 0.839737296f},
-std::array<float,2>{0.0964409709f, 0.0919036642f},
-std::array<float,2>{0.267213792f, 0.612260938f},
-std::array<float,2>{0.833068132f, 0.381909013f},
-std::array<float,2>{0.790918291f, 0.90490526f},
-std::array<float,2>{0.315206736f, 0.174321398f},
-std::array<float,2>{0.0532307327f, 0.680111229f},
-std::array<float,2>{0.523771286f, 0.253052175f},
-std::array<float,2>{0.74398917f, 0.50799495f},
-std::array<float,2>{0.174878299f, 0.49532637f},
-std::array<float,2>{0.438845575f, 0.80501914f},
-std::array<float,2>{0.883396387f, 0.0339570269f},
-std::array<float,2>{0.84572047f, 0.568083823f},
-std::array<float,2>{0.302470148f, 0.422574848f},
-std::array<float,2>{0.0643470064f, 0.849133074f},
-std::array<float,2>{0.574683428f, 0.094186388f},
-std::array<float,2>{0.649539292f, 0.998460829f},
-std::array<float,2>{0.187674597f, 0.237450123f},
-std::array<float,2>{0.411118448f, 0.744300842f},
-std::array<float,2>{0.956252933f, 0.371892184f},
-std::array<float,2>{0.919305027f, 0.758962691f},
-std::array<float,2>{0.494342208f, 0.0041527953f},
-std::array<float,2>{0.148152426f, 0.538941681f},
-std::array<float,2>{0.709481597f, 0.453068018f},
-std::array<float,2>{0.540758967f, 0.633758664f},
-std::array<float,2>{0.0246169381f, 0.310319215f},
-std::array<float,2>{0.369918615f, 0.926560819f},
-std::array<float,2>{0.76609093f, 0.148552135f},
-std::array<float,2>{0.879241467f, 0.60112673f},
-std::array<float,2>{0.45303154f, 0.402011842f},
-std::array<float,2>{0.185443461f, 0.822003603f},
-std::array<float,2>{0.737550855f, 0.0727550089f},
-std::array<float,2>{0.516722322f, 0.941435099f},
-std::array<float,2>{0.0567998774f, 0.190786958f},
-std::array<float,2>{0.324089319f, 0.70139271f},
-std::array<float,2>{0.784346819f, 0.34169209f},
-std::array<float,2>{0.837956071f, 0.787438095f},
-std::array<float,2>{0.273620069f, 0.0596012324f},
-std::array<float,2>{0.105026677f, 0.52779299f},
-std::array<float,2>{0.595580935f, 0.481008172f},
-std::array<float,2>{0.675115228f, 0.665255845f},
-std::array<float,2>{0.235729307f, 0.281145215f},
-std::array<float,2>{0.383295774f, 0.887683511f},
-std::array<float,2>{0.997912347f, 0.157454893f},
-std::array<float,2>{0.77744174f, 0.726202548f},
-std::array<float,2>{0.363535881f, 0.350954741f},
-std::array<float,2>{0.0210794993f, 0.976076484f},
-std::array<float,2>{0.53735137f, 0.230565712f},
-std::array<float,2>{0.717857122f, 0.874829531f},
-std::array<float,2>{0.15248242f, 0.118475854f},
-std::array<float,2>{0.491491795f, 0.58193928f},
-std::array<float,2>{0.913626432f, 0.413252443f},
-std::array<float,2>{0.963306487f, 0.90679884f},
-std::array<float,2>{0.41770184f, 0.133635014f},
-std::array<float,2>{0.195403069f, 0.653677285f},
-std::array<float,2>{0.645299971f, 0.292041272f},
-std::array<float,2>{0.569551945f, 0.559143662f},
-std::array<float,2>{0.0767118633f, 0.461849838f},
-std::array<float,2>{0.307268262f, 0.777665913f},
-std::array<float,2>{0.854278922f, 0.0238417853f},
-std::array<float,2>{0.970587909f, 0.639643788f},
-std::array<float,2>{0.400171876f, 0.305116415f},
-std::array<float,2>{0.221851081f, 0.924081266f},
-std::array<float,2>{0.671232164f, 0.155012473f},
-std::array<float,2>{0.609663129f, 0.763967037f},
-std::array<float,2>{0.124363616f, 0.00148433167f},
-std::array<float,2>{0.257007778f, 0.531641662f},
-std::array<float,2>{0.823623836f, 0.447976142f},
-std::array<float,2>{0.798682988f, 0.99536252f},
-std::array<float,2>{0.340774059f, 0.242007166f},
-std::array<float,2>{0.034452036f, 0.749830127f},
-std::array<float,2>{0.505735636f, 0.369714171f},
-std::array<float,2>{0.72097671f, 0.564217448f},
-std::array<float,2>{0.156589016f, 0.426437527f},
-std::array<float,2>{0.460801482f, 0.847432494f},
-std::array<float,2>{0.903550804f, 0.0983455032f},
-std::array<float,2>{0.859786272f, 0.514522076f},
-std::array<float,2>{0.294265151f, 0.49927932f},
-std::array<float,2>{0.0866197124f, 0.812229216f},
-std::array<float,2>{0.579669774f, 0.0383880027f},
-std::array<float,2>{0.639039576f, 0.901976824f},
-std::array<float,2>{0.205290943f, 0.175944671f},
-std::array<float,2>{0.430091649f, 0.6852144f},
-std::array<float,2>{0.952985346f, 0.254141927f},
-std::array<float,2>{0.933893502f, 0.841211855f},
-std::array<float,2>{0.471956491f, 0.0886199772f},
-std::array<float,2>{0.12852402f, 0.614246249f},
-std::array<float,2>{0.697209775f, 0.377176464f},
-std::array<float,2>{0.554909825f, 0.717045844f},
-std::array<float,2>{0.0116528487f, 0.320538163f},
-std::array<float,2>{0.359243721f, 0.964602888f},
-std::array<float,2>{0.762715995f, 0.213689372f},
-std::array<float,2>{0.941244721f, 0.539799809f},
-std::array<float,2>{0.425797462f, 0.44283691f},
-std::array<float,2>{0.21442315f, 0.753159821f},
-std::array<float,2>{0.626630545f, 0.0101517905f},
-std::array<float,2>{0.590363801f, 0.935695171f},
-std::array<float,2>{0.0790465623f, 0.147493839f},
-std::array<float,2>{0.284424812f, 0.625556052f},
-std::array<float,2>{0.867906988f, 0.300696909f},
-std::array<float,2>{0.751606047f, 0.852159679f},
-std::array<float,2>{0.347636491f, 0.106127076f},
-std::array<float,2>{0.00513550499f, 0.577237546f},
-std::array<float,2>{0.550374985f, 0.434728295f},
-std::array<float,2>{0.688060522f, 0.73581326f},
-std::array<float,2>{0.137338996f, 0.366651326f},
-std::array<float,2>{0.477731735f, 0.990973473f},
-std::array<float,2>{0.926876128f, 0.243189961f},
-std::array<float,2>{0.815570176f, 0.674146712f},
-std::array<float,2>{0.260576397f, 0.265410364f},
-std::array<float,2>{0.116938166f, 0.894650102f},
-std::array<float,2>{0.617421687f, 0.184843183f},
-std::array<float,2>{0.661471963f, 0.804450095f},
-std::array<float,2>{0.230040535f, 0.0392147563f},
-std::array<float,2>{0.392692655f, 0.503212154f},
-std::array<float,2>{0.982221484f, 0.488569647f},
-std::array<float,2>{0.894848704f, 0.955370247f},
-std::array<float,2>{0.462816983f, 0.210633039f},
-std::array<float,2>{0.169522271f, 0.703963399f},
-std::array<float,2>{0.73300463f, 0.314433515f},
-std::array<float,2>{0.514402092f, 0.618383944f},
-std::array<float,2>{0.0406807885f, 0.38839978f},
-std::array<float,2>{0.335272163f, 0.831847131f},
-std::array<float,2>{0.808752716f, 0.0836304575f},
-std::array<float,2>{0.917573333f, 0.693357587f},
-std::array<float,2>{0.497714818f, 0.332195878f},
-std::array<float,2>{0.141826078f, 0.94699353f},
-std::array<float,2>{0.704606473f, 0.19598648f},
-std::array<float,2>{0.543134868f, 0.818796396f},
-std::array<float,2>{0.0285211895f, 0.063457042f},
-std::array<float,2>{0.372736692f, 0.605452597f},
-std::array<float,2>{0.771885693f, 0.396930248f},
-std::array<float,2>{0.851482868f, 0.877991676f},
-std::array<float,2>{0.297630847f, 0.168267161f},
-std::array<float,2>{0.0700165108f, 0.658248484f},
-std::array<float,2>{0.570542991f, 0.271163702f},
-std::array<float,2>{0.652683616f, 0.51565659f},
-std::array<float,2>{0.193509072f, 0.471009403f},
-std::array<float,2>{0.408295542f, 0.791854262f},
-std::array<float,2>{0.958980441f, 0.0474606976f},
-std::array<float,2>{0.796639562f, 0.591464698f},
-std::array<float,2>{0.319006592f, 0.417273551f},
-std::array<float,2>{0.0501269773f, 0.865296543f},
-std::array<float,2>{0.530975521f, 0.112227336f},
-std::array<float,2>{0.746142447f, 0.980022192f},
-std::array<float,2>{0.179586977f, 0.224348992f},
-std::array<float,2>{0.444482684f, 0.731661558f},
-std::array<float,2>{0.890567482f, 0.358570367f},
-std::array<float,2>{0.987268388f, 0.768324852f},
-std::array<float,2>{0.375991493f, 0.018048726f},
-std::array<float,2>{0.244034395f, 0.55452913f},
-std::array<float,2>{0.686259627f, 0.458365351f},
-std::array<float,2>{0.603628457f, 0.64751327f},
-std::array<float,2>{0.101242281f, 0.281401694f},
-std::array<float,2>{0.272846311f, 0.916049302f},
-std::array<float,2>{0.829583287f, 0.125925362f},
-std::array<float,2>{0.994309187f, 0.572131395f},
-std::array<float,2>{0.390365005f, 0.432540596f},
-std::array<float,2>{0.240972161f, 0.856671154f},
-std::array<float,2>{0.676370144f, 0.104242161f},
-std::array<float,2>{0.600765347f, 0.984592915f},
-std::array<float,2>{0.108697817f, 0.247173995f},
-std::array<float,2>{0.279303253f, 0.738478303f},
-std::array<float,2>{0.840565801f, 0.362197906f},
-std::array<float,2>{0.788539588f, 0.757019341f},
-std::array<float,2>{0.325731903f, 0.0124496631f},
-std::array<float,2>{0.0586060137f, 0.543444157f},
-std::array<float,2>{0.521332264f, 0.441114694f},
-std::array<float,2>{0.738475502f, 0.631419003f},
-std::array<float,2>{0.180425629f, 0.303148836f},
-std::array<float,2>{0.447835445f, 0.931188047f},
-std::array<float,2>{0.878486216f, 0.141195819f},
-std::array<float,2>{0.857283771f, 0.707567334f},
-std::array<float,2>{0.308945596f, 0.318618238f},
-std::array<float,2>{0.0738116726f, 0.957568705f},
-std::array<float,2>{0.563747406f, 0.206574664f},
-std::array<float,2>{0.641143262f, 0.833670795f},
-std::array<float,2>{0.199441075f, 0.0810146183f},
-std::array<float,2>{0.420745075f, 0.623776495f},
-std::array<float,2>{0.966089189f, 0.384550393f},
-std::array<float,2>{0.910111725f, 0.893186867f},
-std::array<float,2>{0.485560596f, 0.181452826f},
-std::array<float,2>{0.151244566f, 0.678488672f},
-std::array<float,2>{0.711239815f, 0.260409653f},
-std::array<float,2>{0.533989966f, 0.507434964f},
-std::array<float,2>{0.017228473f, 0.486332357f},
-std::array<float,2>{0.362893194f, 0.797994971f},
-std::array<float,2>{0.776259482f, 0.0442253202f},
-std::array<float,2>{0.902104616f, 0.660479605f},
-std::array<float,2>{0.453998983f, 0.26857096f},
-std::array<float,2>{0.160617501f, 0.879418314f},
-std::array<float,2>{0.723329425f, 0.164927483f},
-std::array<float,2>{0.50259614f, 0.795847118f},
-std::array<float,2>{0.0358439982f, 0.0520074293f},
-std::array<float,2>{0.338818073f, 0.522441089f},
-std::array<float,2>{0.801660359f, 0.47278899f},
-std::array<float,2>{0.824884355f, 0.950972795f},
-std::array<float,2>{0.253159732f, 0.201711282f},
-std::array<float,2>{0.1192699f, 0.687695503f},
-std::array<float,2>{0.613558352f, 0.329081833f},
-std::array<float,2>{0.667455792f, 0.607186317f},
-std::array<float,2>{0.22642684f, 0.391106278f},
-std::array<float,2>{0.406092495f, 0.815028012f},
-std::array<float,2>{0.974476278f, 0.0695705712f},
-std::array<float,2>{0.758772492f, 0.547949374f},
-std::array<float,2>{0.351821899f, 0.456279933f},
-std::array<float,2>{0.0139140273f, 0.772844136f},
-std::array<float,2>{0.56091851f, 0.0199453775f},
-std::array<float,2>{0.70053786f, 0.920217574f},
-std::array<float,2>{0.130983844f, 0.129953802f},
-std::array<float,2>{0.472695857f, 0.64157927f},
-std::array<float,2>{0.931684732f, 0.287670135f},
-std::array<float,2>{0.946187019f, 0.859862924f},
-std::array<float,2>{0.435427278f, 0.114201702f},
-std::array<float,2>{0.210649356f, 0.587010384f},
-std::array<float,2>{0.636226416f, 0.421785444f},
-std::array<float,2>{0.58337611f, 0.727681518f},
-std::array<float,2>{0.0906432942f, 0.35507223f},
-std::array<float,2>{0.291721493f, 0.98090589f},
-std::array<float,2>{0.863358021f, 0.219430432f},
-std::array<float,2>{0.923658788f, 0.526438653f},
-std::array<float,2>{0.483374417f, 0.479730159f},
-std::array<float,2>{0.134201422f, 0.78409791f},
-std::array<float,2>{0.694686472f, 0.0572901741f},
-std::array<float,2>{0.551693916f, 0.884934902f},
-std::array<float,2>{0.000479954411f, 0.164014876f},
-std::array<float,2>{0.34907946f, 0.671481073f},
-std::array<float,2>{0.753987074f, 0.27600494f},
-std::array<float,2>{0.872473598f, 0.824813783f},
-std::array<float,2>{0.288775504f, 0.0769573078f},
-std::array<float,2>{0.0840472877f, 0.595578611f},
-std::array<float,2>{0.588856161f, 0.402921647f},
-std::array<float,2>{0.629069865f, 0.696726799f},
-std::array<float,2>{0.218534559f, 0.336729735f},
-std::array<float,2>{0.424815714f, 0.93811965f},
-std::array<float,2>{0.944027662f, 0.194632336f},
-std::array<float,2>{0.80587554f, 0.650466383f},
-std::array<float,2>{0.3311252f, 0.29417628f},
-std::array<float,2>{0.0459317006f, 0.910799146f},
-std::array<float,2>{0.509305835f, 0.138800353f},
-std::array<float,2>{0.728670657f, 0.774697721f},
-std::array<float,2>{0.164192051f, 0.0304079466f},
-std::array<float,2>{0.465148181f, 0.557888329f},
-std::array<float,2>{0.89411217f, 0.465197623f},
-std::array<float,2>{0.976752937f, 0.969896376f},
-std::array<float,2>{0.395183384f, 0.229543909f},
-std::array<float,2>{0.230941325f, 0.719553947f},
-std::array<float,2>{0.659367323f, 0.34687236f},
-std::array<float,2>{0.623962641f, 0.585480392f},
-std::array<float,2>{0.109940581f, 0.409569055f},
-std::array<float,2>{0.265374511f, 0.867505491f},
-std::array<float,2>{0.816504955f, 0.12444862f},
-std::array<float,2>{0.954586446f, 0.743068099f},
-std::array<float,2>{0.413571656f, 0.373547494f},
-std::array<float,2>{0.189737737f, 0.996374965f},
-std::array<float,2>{0.650968254f, 0.234394506f},
-std::array<float,2>{0.577169836f, 0.851272285f},
-std::array<float,2>{0.0651043579f, 0.0965242609f},
-std::array<float,2>{0.303413451f, 0.568494976f},
-std::array<float,2>{0.845589101f, 0.424174577f},
-std::array<float,2>{0.767955065f, 0.928396702f},
-std::array<float,2>{0.368592143f, 0.15194869f},
-std::array<float,2>{0.0254326705f, 0.636348128f},
-std::array<float,2>{0.542352498f, 0.31248495f},
-std::array<float,2>{0.707675755f, 0.536644459f},
-std::array<float,2>{0.146373808f, 0.450361192f},
-std::array<float,2>{0.492792159f, 0.760591984f},
-std::array<float,2>{0.921127856f, 0.00644100271f},
-std::array<float,2>{0.835097849f, 0.610294163f},
-std::array<float,2>{0.268255442f, 0.38014257f},
-std::array<float,2>{0.0944168195f, 0.836656511f},
-std::array<float,2>{0.606612027f, 0.091784887f},
-std::array<float,2>{0.682514727f, 0.967133224f},
-std::array<float,2>{0.248986185f, 0.217056587f},
-std::array<float,2>{0.380206168f, 0.711293519f},
-std::array<float,2>{0.988717675f, 0.327336222f},
-std::array<float,2>{0.884924293f, 0.806670487f},
-std::array<float,2>{0.440661073f, 0.033010412f},
-std::array<float,2>{0.173123002f, 0.511166513f},
-std::array<float,2>{0.745218813f, 0.49268198f},
-std::array<float,2>{0.526354551f, 0.683574259f},
-std::array<float,2>{0.0526662581f, 0.250536621f},
-std::array<float,2>{0.312845409f, 0.902344167f},
-std::array<float,2>{0.7925843f, 0.173563778f},
-std::array<float,2>{0.936272025f, 0.614832103f},
-std::array<float,2>{0.470340699f, 0.378792971f},
-std::array<float,2>{0.126763165f, 0.840731442f},
-std::array<float,2>{0.698065221f, 0.0893064588f},
-std::array<float,2>{0.557067871f, 0.963317573f},
-std::array<float,2>{0.00874258857f, 0.214263469f},
-std::array<float,2>{0.357142746f, 0.718748569f},
-std::array<float,2>{0.763930202f, 0.321542412f},
-std::array<float,2>{0.863074481f, 0.810820222f},
-std::array<float,2>{0.295159429f, 0.0374598689f},
-std::array<float,2>{0.0894320533f, 0.514679253f},
-std::array<float,2>{0.580464423f, 0.498093635f},
-std::array<float,2>{0.636814237f, 0.684055507f},
-std::array<float,2>{0.204725862f, 0.254938453f},
-std::array<float,2>{0.432853937f, 0.900834858f},
-std::array<float,2>{0.951108217f, 0.177353665f},
-std::array<float,2>{0.800253332f, 0.748451769f},
-std::array<float,2>{0.343691409f, 0.370539129f},
-std::array<float,2>{0.0321844257f, 0.994361281f},
-std::array<float,2>{0.507418215f, 0.24036622f},
-std::array<float,2>{0.719673038f, 0.846650004f},
-std::array<float,2>{0.159212917f, 0.0986882523f},
-std::array<float,2>{0.457202673f, 0.562579215f},
-std::array<float,2>{0.905594826f, 0.427393645f},
-std::array<float,2>{0.97137481f, 0.925662637f},
-std::array<float,2>{0.401676655f, 0.15556109f},
-std::array<float,2>{0.219499305f, 0.639668822f},
-std::array<float,2>{0.66942966f, 0.306578934f},
-std::array<float,2>{0.61162442f, 0.532743931f},
-std::array<float,2>{0.121279471f, 0.448335201f},
-std::array<float,2>{0.253994375f, 0.765085638f},
-std::array<float,2>{0.82172513f, 0.000228410747f},
-std::array<float,2>{0.962884486f, 0.652543604f},
-std::array<float,2>{0.416012824f, 0.29145655f},
-std::array<float,2>{0.198411852f, 0.907782614f},
-std::array<float,2>{0.647139549f, 0.133817703f},
-std::array<float,2>{0.567964196f, 0.778478146f},
-std::array<float,2>{0.0758983716f, 0.0247903615f},
-std::array<float,2>{0.304760665f, 0.560515285f},
-std::array<float,2>{0.853508472f, 0.462546289f},
-std::array<float,2>{0.780096412f, 0.975229979f},
-std::array<float,2>{0.366320282f, 0.232120216f},
-std::array<float,2>{0.021554647f, 0.724976361f},
-std::array<float,2>{0.535907269f, 0.350257844f},
-std::array<float,2>{0.716087759f, 0.580086946f},
-std::array<float,2>{0.154407412f, 0.412387788f},
-std::array<float,2>{0.489122331f, 0.873182356f},
-std::array<float,2>{0.911601961f, 0.117673129f},
-std::array<float,2>{0.83711803f, 0.528824151f},
-std::array<float,2>{0.276165128f, 0.481787503f},
-std::array<float,2>{0.101723656f, 0.788532615f},
-std::array<float,2>{0.597329676f, 0.0591281243f},
-std::array<float,2>{0.673732162f, 0.888265312f},
-std::array<float,2>{0.236332163f, 0.156258911f},
-std::array<float,2>{0.3850528f, 0.665003538f},
-std::array<float,2>{0.998148739f, 0.279324859f},
-std::array<float,2>{0.881002963f, 0.820771158f},
-std::array<float,2>{0.44967398f, 0.0741979256f},
-std::array<float,2>{0.187018618f, 0.600337029f},
-std::array<float,2>{0.735068858f, 0.400525004f},
-std::array<float,2>{0.518027723f, 0.70270735f},
-std::array<float,2>{0.0566015281f, 0.340446413f},
-std::array<float,2>{0.321685225f, 0.942391992f},
-std::array<float,2>{0.782514036f, 0.189838484f},
-std::array<float,2>{0.986190319f, 0.55288285f},
-std::array<float,2>{0.37788862f, 0.457083762f},
-std::array<float,2>{0.245652974f, 0.769528151f},
-std::array<float,2>{0.685527027f, 0.0195149053f},
-std::array<float,2>{0.602793813f, 0.917524755f},
-std::array<float,2>{0.0995475203f, 0.126008347f},
-std::array<float,2>{0.269855946f, 0.646676242f},
-std::array<float,2>{0.83033824f, 0.28264311f},
-std::array<float,2>{0.793889403f, 0.866743863f},
-std::array<float,2>{0.318215042f, 0.112850256f},
-std::array<float,2>{0.0488213226f, 0.589967668f},
-std::array<float,2>{0.528714597f, 0.416097969f},
-std::array<float,2>{0.74972105f, 0.731434822f},
-std::array<float,2>{0.177709132f, 0.357521504f},
-std::array<float,2>{0.442298055f, 0.979417264f},
-std::array<float,2>{0.887980163f, 0.223624647f},
-std::array<float,2>{0.84953618f, 0.660070598f},
-std::array<float,2>{0.298874766f, 0.270274103f},
-std::array<float,2>{0.0671889782f, 0.877122819f},
-std::array<float,2>{0.572628736f, 0.1695088f},
-std::array<float,2>{0.654428482f, 0.792066038f},
-std::array<float,2>{0.192727625f, 0.0479274951f},
-std::array<float,2>{0.407495677f, 0.517060876f},
-std::array<float,2>{0.959056377f, 0.472226024f},
-std::array<float,2>{0.914780259f, 0.94573164f},
-std::array<float,2>{0.498098135f, 0.196892291f},
-std::array<float,2>{0.144092128f, 0.692338705f},
-std::array<float,2>{0.706054211f, 0.333173335f},
-std::array<float,2>{0.545150697f, 0.604058444f},
-std::array<float,2>{0.0294580534f, 0.397601813f},
-std::array<float,2>{0.374838352f, 0.820249915f},
-std::array<float,2>{0.770544529f, 0.0636710897f},
-std::array<float,2>{0.897363245f, 0.704574108f},
-std::array<float,2>{0.463409066f, 0.31272167f},
-std::array<float,2>{0.17142424f, 0.956502557f},
-std::array<float,2>{0.731540084f, 0.209859297f},
-std::array<float,2>{0.512026489f, 0.830738485f},
-std::array<float,2>{0.0411067382f, 0.0820994377f},
-std::array<float,2>{0.33232671f, 0.617727518f},
-std::array<float,2>{0.811452568f, 0.38764149f},
-std::array<float,2>{0.814304769f, 0.895573974f},
-std::array<float,2>{0.259392112f, 0.184403136f},
-std::array<float,2>{0.114288211f, 0.675402939f},
-std::array<float,2>{0.619407296f, 0.26386258f},
-std::array<float,2>{0.663242936f, 0.502195299f},
-std::array<float,2>{0.227387294f, 0.490081519f},
-std::array<float,2>{0.390830547f, 0.802897513f},
-std::array<float,2>{0.983288109f, 0.0407639779f},
-std::array<float,2>{0.752616286f, 0.57665813f},
-std::array<float,2>{0.343831301f, 0.434533745f},
-std::array<float,2>{0.00636494579f, 0.852711797f},
-std::array<float,2>{0.548779964f, 0.10712596f},
-std::array<float,2>{0.690791965f, 0.992072344f},
-std::array<float,2>{0.140016139f, 0.242189273f},
-std::array<float,2>{0.478901744f, 0.735153377f},
-std::array<float,2>{0.928993642f, 0.36556524f},
-std::array<float,2>{0.9382146f, 0.75284487f},
-std::array<float,2>{0.429151982f, 0.0111891739f},
-std::array<float,2>{0.211467788f, 0.540977001f},
-std::array<float,2>{0.628780782f, 0.441521198f},
-std::array<float,2>{0.591847003f, 0.626342654f},
-std::array<float,2>{0.0816342384f, 0.298924237f},
-std::array<float,2>{0.282738447f, 0.937388539f},
-std::array<float,2>{0.869645238f, 0.147156224f},
-std::array<float,2>{0.947506905f, 0.586655259f},
-std::array<float,2>{0.437013656f, 0.420310467f},
-std::array<float,2>{0.208163664f, 0.86094594f},
-std::array<float,2>{0.634548724f, 0.114762925f},
-std::array<float,2>{0.585372806f, 0.982242107f},
-std::array<float,2>{0.093533434f, 0.220565796f},
-std::array<float,2>{0.28960833f, 0.727113307f},
-std::array<float,2>{0.865712166f, 0.35420391f},
-std::array<float,2>{0.76027745f, 0.771604836f},
-std::array<float,2>{0.353663802f, 0.0211596172f},
-std::array<float,2>{0.0126825087f, 0.547189653f},
-std::array<float,2>{0.558772445f, 0.455483764f},
-std::array<float,2>{0.701868415f, 0.641836226f},
-std::array<float,2>{0.130583763f, 0.288694113f},
-std::array<float,2>{0.475562334f, 0.921691477f},
-std::array<float,2>{0.930388093f, 0.12890932f},
-std::array<float,2>{0.827854335f, 0.688581526f},
-std::array<float,2>{0.250863582f, 0.329604864f},
-std::array<float,2>{0.117498197f, 0.949562728f},
-std::array<float,2>{0.616246998f, 0.202684864f},
-std::array<float,2>{0.665334523f, 0.816069722f},
-std::array<float,2>{0.223144159f, 0.0689937025f},
-std::array<float,2>{0.403595507f, 0.60604465f},
-std::array<float,2>{0.975694895f, 0.392160863f},
-std::array<float,2>{0.899283171f, 0.880848408f},
-std::array<float,2>{0.45522815f, 0.165349215f},
-std::array<float,2>{0.163311034f, 0.661554277f},
-std::array<float,2>{0.725785375f, 0.268473446f},
-std::array<float,2>{0.500880539f, 0.522797108f},
-std::array<float,2>{0.0389760882f, 0.474172413f},
-std::array<float,2>{0.337439448f, 0.796105623f},
-std::array<float,2>{0.803014636f, 0.051191207f},
-std::array<float,2>{0.907491505f, 0.679547429f},
-std::array<float,2>{0.487415016f, 0.261089981f},
-std::array<float,2>{0.149743676f, 0.894329906f},
-std::array<float,2>{0.713928521f, 0.180236101f},
-std::array<float,2>{0.531399667f, 0.797811866f},
-std::array<float,2>{0.0194904152f, 0.0434367135f},
-std::array<float,2>{0.360211164f, 0.506502748f},
-std::array<float,2>{0.773709118f, 0.487733722f},
-std::array<float,2>{0.859321296f, 0.958902538f},
-std::array<float,2>{0.3113527f, 0.205502763f},
-std::array<float,2>{0.0706558451f, 0.708027184f},
-std::array<float,2>{0.564884126f, 0.320291072f},
-std::array<float,2>{0.644314051f, 0.624440253f},
-std::array<float,2>{0.202362061f, 0.383392036f},
-std::array<float,2>{0.418864429f, 0.832162976f},
-std::array<float,2>{0.966800272f, 0.0813766792f},
-std::array<float,2>{0.786314726f, 0.544354141f},
-std::array<float,2>{0.327882916f, 0.439688474f},
-std::array<float,2>{0.0614423491f, 0.756090164f},
-std::array<float,2>{0.523305893f, 0.0130125359f},
-std::array<float,2>{0.741883874f, 0.929694414f},
-std::array<float,2>{0.181936845f, 0.142530203f},
-std::array<float,2>{0.445635617f, 0.63265121f},
-std::array<float,2>{0.875498652f, 0.304679394f},
-std::array<float,2>{0.993725061f, 0.856168926f},
-std::array<float,2>{0.387100458f, 0.104953147f},
-std::array<float,2>{0.240080044f, 0.571192801f},
-std::array<float,2>{0.679358065f, 0.433287263f},
-std::array<float,2>{0.598314643f, 0.739967704f},
-std::array<float,2>{0.106512181f, 0.362425804f},
-std::array<float,2>{0.277507871f, 0.985383391f},
-std::array<float,2>{0.843440771f, 0.246871755f},
-std::array<float,2>{0.883890212f, 0.50985837f},
-std::array<float,2>{0.438132048f, 0.493715465f},
-std::array<float,2>{0.173843637f, 0.808417439f},
-std::array<float,2>{0.742862225f, 0.0313736834f},
-std::array<float,2>{0.524438024f, 0.903967142f},
-std::array<float,2>{0.05428572f, 0.172257632f},
-std::array<float,2>{0.315800726f, 0.681716919f},
-std::array<float,2>{0.789790392f, 0.250993997f},
-std::array<float,2>{0.832771957f, 0.837012529f},
-std::array<float,2>{0.265777647f, 0.0902145579f},
-std::array<float,2>{0.097469233f, 0.610468209f},
-std::array<float,2>{0.609001696f, 0.379170865f},
-std::array<float,2>{0.681462646f, 0.712705016f},
-std::array<float,2>{0.246866748f, 0.32641688f},
-std::array<float,2>{0.381925017f, 0.96859324f},
-std::array<float,2>{0.990759432f, 0.218273893f},
-std::array<float,2>{0.766855359f, 0.634913445f},
-std::array<float,2>{0.370334834f, 0.311515063f},
-std::array<float,2>{0.0238466393f, 0.929082334f},
-std::array<float,2>{0.539855123f, 0.150995091f},
-std::array<float,2>{0.710274339f, 0.760873616f},
-std::array<float,2>{0.147103786f, 0.00691457791f},
-std::array<float,2>{0.496064484f, 0.535495162f},
-std::array<float,2>{0.918097794f, 0.44953531f},
-std::array<float,2>{0.956021249f, 0.997815728f},
-std::array<float,2>{0.411656946f, 0.235595033f},
-std::array<float,2>{0.189216852f, 0.743186653f},
-std::array<float,2>{0.648544788f, 0.374512732f},
-std::array<float,2>{0.575973213f, 0.569893956f},
-std::array<float,2>{0.062955223f, 0.425030679f},
-std::array<float,2>{0.301315993f, 0.84979856f},
-std::array<float,2>{0.846872449f, 0.0974186584f},
-std::array<float,2>{0.979247153f, 0.720100045f},
-std::array<float,2>{0.396638662f, 0.346591026f},
-std::array<float,2>{0.23268564f, 0.969360232f},
-std::array<float,2>{0.657692313f, 0.229059502f},
-std::array<float,2>{0.6222139f, 0.868782043f},
-std::array<float,2>{0.112032637f, 0.123690128f},
-std::array<float,2>{0.262804657f, 0.584813058f},
-std::array<float,2>{0.818962991f, 0.409056544f},
-std::array<float,2>{0.808369279f, 0.911770642f},
-std::array<float,2>{0.328509837f, 0.139937505f},
-std::array<float,2>{0.0447684117f, 0.652114034f},
-std::array<float,2>{0.511410534f, 0.293875694f},
-std::array<float,2>{0.728074074f, 0.557115316f},
-std::array<float,2>{0.167102754f, 0.466255158f},
-std::array<float,2>{0.467532307f, 0.773671985f},
-std::array<float,2>{0.891369462f, 0.0301295165f},
-std::array<float,2>{0.873862624f, 0.594104946f},
-std::array<float,2>{0.285885692f, 0.403513253f},
-std::array<float,2>{0.083445251f, 0.825577736f},
-std::array<float,2>{0.587524295f, 0.0776079148f},
-std::array<float,2>{0.632734776f, 0.938824415f},
-std::array<float,2>{0.21517089f, 0.193481162f},
-std::array<float,2>{0.422556758f, 0.695375919f},
-std::array<float,2>{0.941469908f, 0.337056816f},
-std::array<float,2>{0.925032794f, 0.785110593f},
-std::array<float,2>{0.480643541f, 0.0582740419f},
-std::array<float,2>{0.136407599f, 0.525716007f},
-std::array<float,2>{0.692888141f, 0.479415864f},
-std::array<float,2>{0.554212451f, 0.670757592f},
-std::array<float,2>{0.00324188871f, 0.277162075f},
-std::array<float,2>{0.349679917f, 0.886311233f},
-std::array<float,2>{0.75618577f, 0.163078532f},
-std::array<float,2>{0.90283519f, 0.565839767f},
-std::array<float,2>{0.459459901f, 0.428555459f},
-std::array<float,2>{0.158078954f, 0.84467411f},
-std::array<float,2>{0.721886575f, 0.0997586176f},
-std::array<float,2>{0.504606426f, 0.992998481f},
-std::array<float,2>{0.0332584605f, 0.238380417f},
-std::array<float,2>{0.341706634f, 0.747102559f},
-std::array<float,2>{0.797323585f, 0.368553936f},
-std::array<float,2>{0.822400272f, 0.762617946f},
-std::array<float,2>{0.256800622f, 0.00247471617f},
-std::array<float,2>{0.12319953f, 0.534101605f},
-std::array<float,2>{0.610558867f, 0.446234703f},
-std::array<float,2>{0.670561075f, 0.638066947f},
-std::array<float,2>{0.220755607f, 0.307946473f},
-std::array<float,2>{0.398772269f, 0.922187805f},
-std::array<float,2>{0.969111383f, 0.152381986f},
-std::array<float,2>{0.762320578f, 0.715254188f},
-std::array<float,2>{0.357796103f, 0.323622376f},
-std::array<float,2>{0.0105327526f, 0.962710023f},
-std::array<float,2>{0.556152463f, 0.212774128f},
-std::array<float,2>{0.695402384f, 0.843608379f},
-std::array<float,2>{0.127650321f, 0.0865200609f},
-std::array<float,2>{0.471391857f, 0.615310311f},
-std::array<float,2>{0.934612393f, 0.376073211f},
-std::array<float,2>{0.951975226f, 0.900123596f},
-std::array<float,2>{0.430832148f, 0.178239703f},
-std::array<float,2>{0.206907988f, 0.687008321f},
-std::array<float,2>{0.640452445f, 0.257166535f},
-std::array<float,2>{0.578163266f, 0.512738764f},
-std::array<float,2>{0.0872437283f, 0.497499466f},
-std::array<float,2>{0.293806851f, 0.808903873f},
-std::array<float,2>{0.860460877f, 0.0369685516f},
-std::array<float,2>{0.996893823f, 0.666375756f},
-std::array<float,2>{0.38387394f, 0.278535873f},
-std::array<float,2>{0.235020801f, 0.889715731f},
-std::array<float,2>{0.674787343f, 0.159480333f},
-std::array<float,2>{0.593896866f, 0.785937071f},
-std::array<float,2>{0.103537522f, 0.0616959892f},
-std::array<float,2>{0.27492097f, 0.530255079f},
-std::array<float,2>{0.839180171f, 0.484088629f},
-std::array<float,2>{0.783939421f, 0.944980085f},
-std::array<float,2>{0.322939843f, 0.189198002f},
-std::array<float,2>{0.0584357977f, 0.700292826f},
-std::array<float,2>{0.51644522f, 0.342880338f},
-std::array<float,2>{0.736995459f, 0.599573612f},
-std::array<float,2>{0.18450585f, 0.399092287f},
-std::array<float,2>{0.451246262f, 0.824104667f},
-std::array<float,2>{0.880711377f, 0.0716264471f},
-std::array<float,2>{0.855463147f, 0.561438084f},
-std::array<float,2>{0.308501065f, 0.463814795f},
-std::array<float,2>{0.0774049163f, 0.779458582f},
-std::array<float,2>{0.568421423f, 0.026285952f},
-std::array<float,2>{0.646270514f, 0.90824616f},
-std::array<float,2>{0.196787491f, 0.135083959f},
-std::array<float,2>{0.416695029f, 0.655778408f},
-std::array<float,2>{0.96433866f, 0.290147156f},
-std::array<float,2>{0.912636042f, 0.871525347f},
-std::array<float,2>{0.491068006f, 0.120504402f},
-std::array<float,2>{0.153487861f, 0.579621434f},
-std::array<float,2>{0.717687428f, 0.411929369f},
-std::array<float,2>{0.538902283f, 0.723629773f},
-std::array<float,2>{0.0197889879f, 0.348030627f},
-std::array<float,2>{0.364258111f, 0.972864032f},
-std::array<float,2>{0.778781772f, 0.232933849f},
-std::array<float,2>{0.957608163f, 0.519517481f},
-std::array<float,2>{0.410054952f, 0.468795389f},
-std::array<float,2>{0.194498748f, 0.789349794f},
-std::array<float,2>{0.65369916f, 0.0507577956f},
-std::array<float,2>{0.571752429f, 0.876649439f},
-std::array<float,2>{0.0692964867f, 0.171383888f},
-std::array<float,2>{0.298406899f, 0.657604218f},
-std::array<float,2>{0.850485265f, 0.272219211f},
-std::array<float,2>{0.773199499f, 0.817067802f},
-std::array<float,2>{0.371461272f, 0.0661933869f},
-std::array<float,2>{0.0277756136f, 0.601935923f},
-std::array<float,2>{0.544752896f, 0.394565642f},
-std::array<float,2>{0.703199685f, 0.694097638f},
-std::array<float,2>{0.141417667f, 0.33430472f},
-std::array<float,2>{0.496295422f, 0.948657334f},
-std::array<float,2>{0.91646421f, 0.197719619f},
-std::array<float,2>{0.828880668f, 0.644609451f},
-std::array<float,2>{0.272327065f, 0.284359843f},
-std::array<float,2>{0.100261107f, 0.914764881f},
-std::array<float,2>{0.60492909f, 0.127084538f},
-std::array<float,2>{0.68660146f, 0.765825987f},
-std::array<float,2>{0.242823571f, 0.0158706903f},
-std::array<float,2>{0.375177205f, 0.551414788f},
-std::array<float,2>{0.988272965f, 0.459981889f},
-std::array<float,2>{0.889146924f, 0.97702831f},
-std::array<float,2>{0.443905056f, 0.225493267f},
-std::array<float,2>{0.178187236f, 0.733827472f},
-std::array<float,2>{0.747458756f, 0.356737107f},
-std::array<float,2>{0.529584229f, 0.59224683f},
-std::array<float,2>{0.0489628166f, 0.415896446f},
-std::array<float,2>{0.320081294f, 0.865180671f},
-std::array<float,2>{0.795196593f, 0.110995777f},
-std::array<float,2>{0.92628938f, 0.737038553f},
-std::array<float,2>{0.477238178f, 0.363549054f},
-std::array<float,2>{0.138024196f, 0.988888562f},
-std::array<float,2>{0.688844323f, 0.245286375f},
-std::array<float,2>{0.549039185f, 0.854938924f},
-std::array<float,2>{0.00426907837f, 0.109235682f},
-std::array<float,2>{0.345869631f, 0.574785173f},
-std::array<float,2>{0.750590622f, 0.436304808f},
-std::array<float,2>{0.868768334f, 0.934809506f},
-std::array<float,2>{0.283314556f, 0.145810112f},
-std::array<float,2>{0.0792480111f, 0.627056777f},
-std::array<float,2>{0.591538489f, 0.297778845f},
-std::array<float,2>{0.625013113f, 0.542077005f},
-std::array<float,2>{0.213345066f, 0.443402529f},
-std::array<float,2>{0.427355707f, 0.750353932f},
-std::array<float,2>{0.940099478f, 0.00793190766f},
-std::array<float,2>{0.810065389f, 0.619200766f},
-std::array<float,2>{0.3346982f, 0.390371442f},
-std::array<float,2>{0.0393962301f, 0.830056846f},
-std::array<float,2>{0.514674127f, 0.0847209468f},
-std::array<float,2>{0.733889878f, 0.953643441f},
-std::array<float,2>{0.168224096f, 0.207601279f},
-std::array<float,2>{0.461061388f, 0.705374777f},
-std::array<float,2>{0.895946622f, 0.31550613f},
-std::array<float,2>{0.981122315f, 0.80088222f},
-std::array<float,2>{0.394354731f, 0.0426126681f},
-std::array<float,2>{0.228774548f, 0.50124383f},
-std::array<float,2>{0.660533249f, 0.491012633f},
-std::array<float,2>{0.61853236f, 0.673092663f},
-std::array<float,2>{0.116208859f, 0.262471855f},
-std::array<float,2>{0.261620194f, 0.896953881f},
-std::array<float,2>{0.814838231f, 0.185767487f},
-std::array<float,2>{0.973578691f, 0.609240532f},
-std::array<float,2>{0.404887021f, 0.394087911f},
-std::array<float,2>{0.225068524f, 0.812772274f},
-std::array<float,2>{0.666617095f, 0.0671844855f},
-std::array<float,2>{0.615208268f, 0.951332569f},
-std::array<float,2>{0.120513521f, 0.200364217f},
-std::array<float,2>{0.252060294f, 0.690843046f},
-std::array<float,2>{0.825496137f, 0.331310719f},
-std::array<float,2>{0.801940799f, 0.794153869f},
-std::array<float,2>{0.339787781f, 0.0538185239f},
-std::array<float,2>{0.0367762223f, 0.521369994f},
-std::array<float,2>{0.50365001f, 0.475171387f},
-std::array<float,2>{0.724148929f, 0.662685513f},
-std::array<float,2>{0.161342859f, 0.266971052f},
-std::array<float,2>{0.454412252f, 0.881032348f},
-std::array<float,2>{0.901035845f, 0.166410863f},
-std::array<float,2>{0.864793599f, 0.729426205f},
-std::array<float,2>{0.292488128f, 0.352401733f},
-std::array<float,2>{0.0909711272f, 0.983059645f},
-std::array<float,2>{0.582380176f, 0.221690729f},
-std::array<float,2>{0.635584712f, 0.861908853f},
-std::array<float,2>{0.209857926f, 0.115407102f},
-std::array<float,2>{0.433802009f, 0.588233173f},
-std::array<float,2>{0.946513534f, 0.418235958f},
-std::array<float,2>{0.933277309f, 0.918318689f},
-std::array<float,2>{0.474281043f, 0.131658733f},
-std::array<float,2>{0.132653326f, 0.643415868f},
-std::array<float,2>{0.699466288f, 0.286457658f},
-std::array<float,2>{0.562056959f, 0.549114227f},
-std::array<float,2>{0.0152163114f, 0.454519421f},
-std::array<float,2>{0.35339886f, 0.771069765f},
-std::array<float,2>{0.759615123f, 0.0221079662f},
-std::array<float,2>{0.877379775f, 0.630316257f},
-std::array<float,2>{0.449014246f, 0.302659154f},
-std::array<float,2>{0.180756941f, 0.931707203f},
-std::array<float,2>{0.739760697f, 0.143600926f},
-std::array<float,2>{0.519545972f, 0.755093873f},
-std::array<float,2>{0.0599030443f, 0.0137678254f},
-std::array<float,2>{0.324538052f, 0.54492712f},
-std::array<float,2>{0.787182212f, 0.437930822f},
-std::array<float,2>{0.841055989f, 0.987145722f},
-std::array<float,2>{0.281087339f, 0.249193892f},
-std::array<float,2>{0.107511565f, 0.740253091f},
-std::array<float,2>{0.600048304f, 0.35963434f},
-std::array<float,2>{0.677551031f, 0.572740853f},
-std::array<float,2>{0.241332948f, 0.430150867f},
-std::array<float,2>{0.388855278f, 0.858998477f},
-std::array<float,2>{0.995688796f, 0.103092268f},
-std::array<float,2>{0.776747048f, 0.504152656f},
-std::array<float,2>{0.361333877f, 0.485845089f},
-std::array<float,2>{0.0165137611f, 0.79980582f},
-std::array<float,2>{0.535110533f, 0.0467040427f},
-std::array<float,2>{0.71196872f, 0.892245054f},
-std::array<float,2>{0.151982844f, 0.18299593f},
-std::array<float,2>{0.485043168f, 0.677076399f},
-std::array<float,2>{0.908217549f, 0.259420931f},
-std::array<float,2>{0.965240777f, 0.834642828f},
-std::array<float,2>{0.42090705f, 0.0782870874f},
-std::array<float,2>{0.200329408f, 0.622442007f},
-std::array<float,2>{0.642371058f, 0.385241091f},
-std::array<float,2>{0.563331127f, 0.710822642f},
-std::array<float,2>{0.0723269209f, 0.31810075f},
-std::array<float,2>{0.309694588f, 0.959894121f},
-std::array<float,2>{0.855741084f, 0.20492585f},
-std::array<float,2>{0.920669198f, 0.537113547f},
-std::array<float,2>{0.493902892f, 0.452040434f},
-std::array<float,2>{0.145288676f, 0.758396029f},
-std::array<float,2>{0.708781064f, 0.00574908033f},
-std::array<float,2>{0.541137457f, 0.927365661f},
-std::array<float,2>{0.0273306444f, 0.150007144f},
-std::array<float,2>{0.367230177f, 0.634533226f},
-std::array<float,2>{0.768954635f, 0.308753043f},
-std::array<float,2>{0.844316959f, 0.848338783f},
-std::array<float,2>{0.304670572f, 0.095416382f},
-std::array<float,2>{0.0658798367f, 0.566795349f},
-std::array<float,2>{0.576232255f, 0.423552662f},
-std::array<float,2>{0.651681423f, 0.745150149f},
-std::array<float,2>{0.191338688f, 0.372570425f},
-std::array<float,2>{0.412227392f, 0.999998391f},
-std::array<float,2>{0.953251243f, 0.236588299f},
-std::array<float,2>{0.79148525f, 0.680960536f},
-std::array<float,2>{0.314180881f, 0.252518058f},
-std::array<float,2>{0.0513494499f, 0.905902445f},
-std::array<float,2>{0.526619792f, 0.175329536f},
-std::array<float,2>{0.744952142f, 0.805916786f},
-std::array<float,2>{0.172655553f, 0.0347998366f},
-std::array<float,2>{0.439772725f, 0.509299994f},
-std::array<float,2>{0.88654685f, 0.49473238f},
-std::array<float,2>{0.98937571f, 0.96590215f},
-std::array<float,2>{0.378978819f, 0.216668248f},
-std::array<float,2>{0.24995102f, 0.713392913f},
-std::array<float,2>{0.683579206f, 0.324509978f},
-std::array<float,2>{0.605533838f, 0.612687945f},
-std::array<float,2>{0.0953565687f, 0.381446004f},
-std::array<float,2>{0.26925987f, 0.838422477f},
-std::array<float,2>{0.834255278f, 0.0933164507f},
-std::array<float,2>{0.94439131f, 0.697814107f},
-std::array<float,2>{0.424387217f, 0.339245319f},
-std::array<float,2>{0.216927066f, 0.940243065f},
-std::array<float,2>{0.630463004f, 0.193276554f},
-std::array<float,2>{0.589547396f, 0.827601373f},
-std::array<float,2>{0.0850996003f, 0.0751772895f},
-std::array<float,2>{0.287324727f, 0.596765637f},
-std::array<float,2>{0.871686399f, 0.405749798f},
-std::array<float,2>{0.755227029f, 0.883875489f},
-std::array<float,2>{0.347660542f, 0.160198838f},
-std::array<float,2>{0.00168672169f, 0.66866672f},
-std::array<float,2>{0.552232325f, 0.273567319f},
-std::array<float,2>{0.693947792f, 0.525114119f},
-std::array<float,2>{0.132922083f, 0.478231043f},
-std::array<float,2>{0.483507484f, 0.782787263f},
-std::array<float,2>{0.922502518f, 0.0557880104f},
-std::array<float,2>{0.817750037f, 0.582309544f},
-std::array<float,2>{0.263900787f, 0.407731682f},
-std::array<float,2>{0.110633932f, 0.869668007f},
-std::array<float,2>{0.624191701f, 0.121400081f},
-std::array<float,2>{0.65900892f, 0.972475708f},
-std::array<float,2>{0.231933802f, 0.22740069f},
-std::array<float,2>{0.395695955f, 0.721309662f},
-std::array<float,2>{0.978483796f, 0.344271302f},
-std::array<float,2>{0.89277333f, 0.775682926f},
-std::array<float,2>{0.466615885f, 0.0279284567f},
-std::array<float,2>{0.165209666f, 0.555696189f},
-std::array<float,2>{0.729564428f, 0.468602836f},
-std::array<float,2>{0.50864625f, 0.649326861f},
-std::array<float,2>{0.0452848077f, 0.29618448f},
-std::array<float,2>{0.330631524f, 0.912973583f},
-std::array<float,2>{0.805432677f, 0.137886301f},
-std::array<float,2>{0.919713557f, 0.566412508f},
-std::array<float,2>{0.495000869f, 0.423651397f},
-std::array<float,2>{0.147823229f, 0.848590314f},
-std::array<float,2>{0.70936197f, 0.0955991f},
-std::array<float,2>{0.540510654f, 0.999619722f},
-std::array<float,2>{0.0249237865f, 0.236421183f},
-std::array<float,2>{0.369276762f, 0.745565295f},
-std::array<float,2>{0.766581833f, 0.372980356f},
-std::array<float,2>{0.846280813f, 0.758548558f},
-std::array<float,2>{0.302138865f, 0.0055760988f},
-std::array<float,2>{0.0636121407f, 0.537459791f},
-std::array<float,2>{0.574985981f, 0.451672524f},
-std::array<float,2>{0.650071979f, 0.634421885f},
-std::array<float,2>{0.188448563f, 0.308895737f},
-std::array<float,2>{0.410571188f, 0.927719116f},
-std::array<float,2>{0.956694126f, 0.150189504f},
-std::array<float,2>{0.790218949f, 0.713816047f},
-std::array<float,2>{0.314536482f, 0.324412882f},
-std::array<float,2>{0.052801732f, 0.966254294f},
-std::array<float,2>{0.524161458f, 0.216543153f},
-std::array<float,2>{0.743370235f, 0.838657677f},
-std::array<float,2>{0.175452083f, 0.0937269405f},
-std::array<float,2>{0.439230829f, 0.612381876f},
-std::array<float,2>{0.883232772f, 0.381810755f},
-std::array<float,2>{0.991957009f, 0.906130075f},
-std::array<float,2>{0.381575942f, 0.175659761f},
-std::array<float,2>{0.247109741f, 0.680830479f},
-std::array<float,2>{0.679926455f, 0.252838671f},
-std::array<float,2>{0.608390808f, 0.509757876f},
-std::array<float,2>{0.0960728452f, 0.494911462f},
-std::array<float,2>{0.266862124f, 0.805761039f},
-std::array<float,2>{0.833982289f, 0.0351311602f},
-std::array<float,2>{0.943259776f, 0.668831468f},
-std::array<float,2>{0.423272699f, 0.273831487f},
-std::array<float,2>{0.216226786f, 0.884203494f},
-std::array<float,2>{0.631196201f, 0.160594314f},
-std::array<float,2>{0.585982859f, 0.783116102f},
-std::array<float,2>{0.0823496506f, 0.0560284778f},
-std::array<float,2>{0.286893666f, 0.525327504f},
-std::array<float,2>{0.874546826f, 0.47844106f},
-std::array<float,2>{0.757365763f, 0.940019786f},
-std::array<float,2>{0.350696087f, 0.192963973f},
-std::array<float,2>{0.00268208212f, 0.698211074f},
-std::array<float,2>{0.553231537f, 0.338964015f},
-std::array<float,2>{0.692211986f, 0.596942186f},
-std::array<float,2>{0.135094166f, 0.405424654f},
-std::array<float,2>{0.482176572f, 0.827274442f},
-std::array<float,2>{0.924763322f, 0.0747396797f},
-std::array<float,2>{0.819956601f, 0.555949986f},
-std::array<float,2>{0.261751711f, 0.468262762f},
-std::array<float,2>{0.112671472f, 0.775523007f},
-std::array<float,2>{0.621830761f, 0.0282573123f},
-std::array<float,2>{0.656689465f, 0.912678242f},
-std::array<float,2>{0.234038249f, 0.138104498f},
-std::array<float,2>{0.398291856f, 0.649127305f},
-std::array<float,2>{0.980408788f, 0.295913994f},
-std::array<float,2>{0.892294347f, 0.870114684f},
-std::array<float,2>{0.468213469f, 0.121282935f},
-std::array<float,2>{0.166651815f, 0.582228661f},
-std::array<float,2>{0.726764023f, 0.40819186f},
-std::array<float,2>{0.510166347f, 0.721566498f},
-std::array<float,2>{0.0431879573f, 0.344671696f},
-std::array<float,2>{0.329681754f, 0.972295582f},
-std::array<float,2>{0.806800544f, 0.227178231f},
-std::array<float,2>{0.975229681f, 0.521011114f},
-std::array<float,2>{0.402874887f, 0.475554794f},
-std::array<float,2>{0.224100932f, 0.794290066f},
-std::array<float,2>{0.66459614f, 0.0540005043f},
-std::array<float,2>{0.616066396f, 0.881128848f},
-std::array<float,2>{0.118923016f, 0.166135535f},
-std::array<float,2>{0.25135088f, 0.663073421f},
-std::array<float,2>{0.826787174f, 0.266613901f},
-std::array<float,2>{0.804432392f, 0.812517941f},
-std::array<float,2>{0.336864293f, 0.0669622049f},
-std::array<float,2>{0.0377643928f, 0.609027863f},
-std::array<float,2>{0.501042426f, 0.394309551f},
-std::array<float,2>{0.724793911f, 0.690651596f},
-std::array<float,2>{0.162747607f, 0.331268311f},
-std::array<float,2>{0.456596643f, 0.951602936f},
-std::array<float,2>{0.900380611f, 0.20052129f},
-std::array<float,2>{0.86651206f, 0.64314419f},
-std::array<float,2>{0.290524483f, 0.2862477f},
-std::array<float,2>{0.0926457793f, 0.918207586f},
-std::array<float,2>{0.584511876f, 0.13141796f},
-std::array<float,2>{0.633182168f, 0.771422565f},
-std::array<float,2>{0.207599625f, 0.0222856086f},
-std::array<float,2>{0.435997128f, 0.549049914f},
-std::array<float,2>{0.948257565f, 0.454267561f},
-std::array<float,2>{0.930720448f, 0.983305395f},
-std::array<float,2>{0.476219952f, 0.222025812f},
-std::array<float,2>{0.129408598f, 0.729024291f},
-std::array<float,2>{0.702298045f, 0.352200955f},
-std::array<float,2>{0.559981346f, 0.587999344f},
-std::array<float,2>{0.0129294321f, 0.417977452f},
-std::array<float,2>{0.354745567f, 0.862065017f},
-std::array<float,2>{0.760747135f, 0.115717746f},
-std::array<float,2>{0.876304209f, 0.740667701f},
-std::array<float,2>{0.446717709f, 0.359581739f},
-std::array<float,2>{0.183577701f, 0.98682338f},
-std::array<float,2>{0.74080658f, 0.249338791f},
-std::array<float,2>{0.521834791f, 0.859229207f},
-std::array<float,2>{0.0617308542f, 0.103403464f},
-std::array<float,2>{0.32652843f, 0.572276652f},
-std::array<float,2>{0.785820305f, 0.429775178f},
-std::array<float,2>{0.841800392f, 0.931898296f},
-std::array<float,2>{0.27859661f, 0.143992513f},
-std::array<float,2>{0.106035993f, 0.629889011f},
-std::array<float,2>{0.598954201f, 0.302338332f},
-std::array<float,2>{0.678060412f, 0.54519707f},
-std::array<float,2>{0.23884815f, 0.437736958f},
-std::array<float,2>{0.388442785f, 0.755363166f},
-std::array<float,2>{0.992527485f, 0.0139950952f},
-std::array<float,2>{0.774892271f, 0.622127116f},
-std::array<float,2>{0.36045593f, 0.384781241f},
-std::array<float,2>{0.0184565075f, 0.834784865f},
-std::array<float,2>{0.532618701f, 0.0784134045f},
-std::array<float,2>{0.713623166f, 0.95954144f},
-std::array<float,2>{0.148758858f, 0.20471023f},
-std::array<float,2>{0.486772448f, 0.710662484f},
-std::array<float,2>{0.90683651f, 0.318138748f},
-std::array<float,2>{0.968622386f, 0.800111413f},
-std::array<float,2>{0.419137299f, 0.0464225076f},
-std::array<float,2>{0.201286092f, 0.504064143f},
-std::array<float,2>{0.643148959f, 0.48612386f},
-std::array<float,2>{0.565816402f, 0.676982462f},
-std::array<float,2>{0.0722117275f, 0.259610653f},
-std::array<float,2>{0.311937928f, 0.892489672f},
-std::array<float,2>{0.857875824f, 0.182763293f},
-std::array<float,2>{0.960231304f, 0.601672649f},
-std::array<float,2>{0.407107979f, 0.394818932f},
-std::array<float,2>{0.192366317f, 0.817229807f},
-std::array<float,2>{0.655356169f, 0.0660827756f},
-std::array<float,2>{0.574057758f, 0.948456466f},
-std::array<float,2>{0.0676009357f, 0.197286978f},
-std::array<float,2>{0.300751746f, 0.693870485f},
-std::array<float,2>{0.84803462f, 0.334033549f},
-std::array<float,2>{0.770434439f, 0.789097607f},
-std::array<float,2>{0.373879969f, 0.0503688045f},
-std::array<float,2>{0.0310447421f, 0.519104123f},
-std::array<float,2>{0.545904696f, 0.469079047f},
-std::array<float,2>{0.706222773f, 0.657444715f},
-std::array<float,2>{0.143415198f, 0.272199452f},
-std::array<float,2>{0.499622524f, 0.876897395f},
-std::array<float,2>{0.915248573f, 0.171061456f},
-std::array<float,2>{0.831812024f, 0.733638108f},
-std::array<float,2>{0.271335214f, 0.356517762f},
-std::array<float,2>{0.0981565863f, 0.976605356f},
-std::array<float,2>{0.601569772f, 0.225220054f},
-std::array<float,2>{0.684465885f, 0.864750624f},
-std::array<float,2>{0.244923323f, 0.111164056f},
-std::array<float,2>{0.378666341f, 0.592014074f},
-std::array<float,2>{0.98488611f, 0.415621698f},
-std::array<float,2>{0.887460351f, 0.91483891f},
-std::array<float,2>{0.442579746f, 0.127215222f},
-std::array<float,2>{0.176192209f, 0.644833684f},
-std::array<float,2>{0.748120487f, 0.284605652f},
-std::array<float,2>{0.528009117f, 0.551713884f},
-std::array<float,2>{0.0469697863f, 0.460341722f},
-std::array<float,2>{0.317200154f, 0.765976608f},
-std::array<float,2>{0.794882476f, 0.0156607945f},
-std::array<float,2>{0.928138316f, 0.62719959f},
-std::array<float,2>{0.479765415f, 0.29744795f},
-std::array<float,2>{0.139499947f, 0.93491751f},
-std::array<float,2>{0.689786971f, 0.14574188f},
-std::array<float,2>{0.547807097f, 0.750037134f},
-std::array<float,2>{0.00741693377f, 0.00821428467f},
-std::array<float,2>{0.345368385f, 0.542292655f},
-std::array<float,2>{0.753684223f, 0.44369176f},
-std::array<float,2>{0.870647192f, 0.989181995f},
-std::array<float,2>{0.281445324f, 0.245424479f},
-std::array<float,2>{0.0806020275f, 0.737077951f},
-std::array<float,2>{0.592831492f, 0.363482982f},
-std::array<float,2>{0.627476335f, 0.575149179f},
-std::array<float,2>{0.212714732f, 0.436091363f},
-std::array<float,2>{0.42810303f, 0.854513168f},
-std::array<float,2>{0.938842356f, 0.109016344f},
-std::array<float,2>{0.811647356f, 0.501165569f},
-std::array<float,2>{0.333094269f, 0.490763694f},
-std::array<float,2>{0.0427762195f, 0.801173508f},
-std::array<float,2>{0.513337255f, 0.0428294092f},
-std::array<float,2>{0.730669498f, 0.896570265f},
-std::array<float,2>{0.169978365f, 0.185962796f},
-std::array<float,2>{0.464513272f, 0.673285484f},
-std::array<float,2>{0.898224771f, 0.262387335f},
-std::array<float,2>{0.983837008f, 0.829806149f},
-std::array<float,2>{0.392460495f, 0.0846482068f},
-std::array<float,2>{0.228265032f, 0.619621336f},
-std::array<float,2>{0.662416518f, 0.390395015f},
-std::array<float,2>{0.620384574f, 0.705194771f},
-std::array<float,2>{0.113843285f, 0.315771759f},
-std::array<float,2>{0.258776397f, 0.954024434f},
-std::array<float,2>{0.813128889f, 0.207943872f},
-std::array<float,2>{0.905040562f, 0.533850789f},
-std::array<float,2>{0.458029032f, 0.446024537f},
-std::array<float,2>{0.159102723f, 0.76239711f},
-std::array<float,2>{0.720191479f, 0.00270408043f},
-std::array<float,2>{0.506505311f, 0.922012985f},
-std::array<float,2>{0.032266207f, 0.152760908f},
-std::array<float,2>{0.342660636f, 0.637935042f},
-std::array<float,2>{0.79913801f, 0.307726026f},
-std::array<float,2>{0.820898354f, 0.844354451f},
-std::array<float,2>{0.255193204f, 0.100067534f},
-std::array<float,2>{0.122592971f, 0.565547168f},
-std::array<float,2>{0.612786412f, 0.42839697f},
-std::array<float,2>{0.668478727f, 0.747472107f},
-std::array<float,2>{0.22036621f, 0.368310124f},
-std::array<float,2>{0.400811553f, 0.992701232f},
-std::array<float,2>{0.972197413f, 0.238696396f},
-std::array<float,2>{0.765099108f, 0.68652463f},
-std::array<float,2>{0.355590433f, 0.256960511f},
-std::array<float,2>{0.00964605529f, 0.900334358f},
-std::array<float,2>{0.558396995f, 0.178572178f},
-std::array<float,2>{0.699012876f, 0.808703423f},
-std::array<float,2>{0.125527263f, 0.0366796926f},
-std::array<float,2>{0.469667733f, 0.513166666f},
-std::array<float,2>{0.937075973f, 0.49708873f},
-std::array<float,2>{0.94922775f, 0.962540925f},
-std::array<float,2>{0.432598621f, 0.21263431f},
-std::array<float,2>{0.203157753f, 0.714861929f},
-std::array<float,2>{0.638481677f, 0.323388517f},
-std::array<float,2>{0.581127644f, 0.615610003f},
-std::array<float,2>{0.0887769684f, 0.376431882f},
-std::array<float,2>{0.296687931f, 0.843496025f},
-std::array<float,2>{0.862300694f, 0.0867074579f},
-std::array<float,2>{0.999808073f, 0.70061475f},
-std::array<float,2>{0.386639744f, 0.343127728f},
-std::array<float,2>{0.237534523f, 0.94512254f},
-std::array<float,2>{0.672255516f, 0.189361513f},
-std::array<float,2>{0.595862746f, 0.82383281f},
-std::array<float,2>{0.102791943f, 0.0714007169f},
-std::array<float,2>{0.27670908f, 0.599291325f},
-std::array<float,2>{0.836140215f, 0.399258852f},
-std::array<float,2>{0.781573713f, 0.889926255f},
-std::array<float,2>{0.320549905f, 0.159288272f},
-std::array<float,2>{0.0555354692f, 0.66621232f},
-std::array<float,2>{0.519057989f, 0.278724343f},
-std::array<float,2>{0.736296296f, 0.529940426f},
-std::array<float,2>{0.186405301f, 0.484253198f},
-std::array<float,2>{0.450407118f, 0.785789609f},
-std::array<float,2>{0.882383525f, 0.0619221553f},
-std::array<float,2>{0.852352321f, 0.579976022f},
-std::array<float,2>{0.30586049f, 0.411790639f},
-std::array<float,2>{0.0745021254f, 0.871098936f},
-std::array<float,2>{0.566831946f, 0.120330557f},
-std::array<float,2>{0.648385823f, 0.973066449f},
-std::array<float,2>{0.198034912f, 0.233309641f},
-std::array<float,2>{0.414851934f, 0.723270953f},
-std::array<float,2>{0.961601317f, 0.347817659f},
-std::array<float,2>{0.910568714f, 0.779635787f},
-std::array<float,2>{0.48944211f, 0.0260822717f},
-std::array<float,2>{0.155287817f, 0.561163008f},
-std::array<float,2>{0.71552819f, 0.463453412f},
-std::array<float,2>{0.536596f, 0.656124294f},
-std::array<float,2>{0.0224665012f, 0.29036817f},
-std::array<float,2>{0.365974128f, 0.908624291f},
-std::array<float,2>{0.780692816f, 0.134881705f},
-std::array<float,2>{0.88542074f, 0.610658348f},
-std::array<float,2>{0.44126904f, 0.379131138f},
-std::array<float,2>{0.17382364f, 0.837351978f},
-std::array<float,2>{0.745799065f, 0.0899165794f},
-std::array<float,2>{0.525875449f, 0.968395829f},
-std::array<float,2>{0.0518749245f, 0.218523011f},
-std::array<float,2>{0.313110948f, 0.712541103f},
-std::array<float,2>{0.792173505f, 0.32618317f},
-std::array<float,2>{0.835540593f, 0.808343828f},
-std::array<float,2>{0.267992556f, 0.0316509306f},
-std::array<float,2>{0.0939163715f, 0.51008755f},
-std::array<float,2>{0.606975138f, 0.493985653f},
-std::array<float,2>{0.682007015f, 0.681934059f},
-std::array<float,2>{0.248397648f, 0.251368821f},
-std::array<float,2>{0.380401492f, 0.904231966f},
-std::array<float,2>{0.989032745f, 0.17199111f},
-std::array<float,2>{0.768322289f, 0.743557096f},
-std::array<float,2>{0.369131774f, 0.374768168f},
-std::array<float,2>{0.0262409151f, 0.997628629f},
-std::array<float,2>{0.542913318f, 0.235635594f},
-std::array<float,2>{0.707343936f, 0.850059688f},
-std::array<float,2>{0.145945296f, 0.0972609371f},
-std::array<float,2>{0.492307782f, 0.570094466f},
-std::array<float,2>{0.921742916f, 0.425092071f},
-std::array<float,2>{0.954990447f, 0.928784966f},
-std::array<float,2>{0.413903326f, 0.15123491f},
-std::array<float,2>{0.19010441f, 0.63508445f},
-std::array<float,2>{0.650460541f, 0.311047256f},
-std::array<float,2>{0.577862203f, 0.535222411f},
-std::array<float,2>{0.0649373904f, 0.449419022f},
-std::array<float,2>{0.302949935f, 0.761054814f},
-std::array<float,2>{0.845177948f, 0.00723584741f},
-std::array<float,2>{0.977519929f, 0.651990592f},
-std::array<float,2>{0.394569665f, 0.293488026f},
-std::array<float,2>{0.231267214f, 0.912105799f},
-std::array<float,2>{0.660105109f, 0.13977854f},
-std::array<float,2>{0.623440742f, 0.773775518f},
-std::array<float,2>{0.109564736f, 0.029923398f},
-std::array<float,2>{0.264719874f, 0.556766272f},
-std::array<float,2>{0.817143857f, 0.465862751f},
-std::array<float,2>{0.806244016f, 0.969632447f},
-std::array<float,2>{0.331704617f, 0.229301199f},
-std::array<float,2>{0.0467851274f, 0.719738066f},
-std::array<float,2>{0.508976102f, 0.346248031f},
-std::array<float,2>{0.729455888f, 0.58454597f},
-std::array<float,2>{0.164867863f, 0.408749312f},
-std::array<float,2>{0.465370059f, 0.868960321f},
-std::array<float,2>{0.893735051f, 0.124014094f},
-std::array<float,2>{0.87299937f, 0.525451601f},
-std::array<float,2>{0.288108081f, 0.479128957f},
-std::array<float,2>{0.0849574506f, 0.784671605f},
-std::array<float,2>{0.58822155f, 0.05835649f},
-std::array<float,2>{0.629555583f, 0.886714458f},
-std::array<float,2>{0.218071654f, 0.162716985f},
-std::array<float,2>{0.425326198f, 0.67056489f},
-std::array<float,2>{0.943361044f, 0.276981741f},
-std::array<float,2>{0.92300427f, 0.82538712f},
-std::array<float,2>{0.482853442f, 0.077354148f},
-std::array<float,2>{0.134396598f, 0.593945026f},
-std::array<float,2>{0.695039392f, 0.403713077f},
-std::array<float,2>{0.550794184f, 0.695711315f},
-std::array<float,2>{0.000686494983f, 0.337292552f},
-std::array<float,2>{0.349328279f, 0.938487589f},
-std::array<float,2>{0.754783094f, 0.193703711f},
-std::array<float,2>{0.9456985f, 0.547093749f},
-std::array<float,2>{0.434687972f, 0.455164522f},
-std::array<float,2>{0.210322365f, 0.771962941f},
-std::array<float,2>{0.636275947f, 0.0213000346f},
-std::array<float,2>{0.583525717f, 0.921599329f},
-std::array<float,2>{0.090328373f, 0.129186317f},
-std::array<float,2>{0.29104051f, 0.641864657f},
-std::array<float,2>{0.864249408f, 0.288874328f},
-std::array<float,2>{0.757932007f, 0.861286879f},
-std::array<float,2>{0.352367967f, 0.115089282f},
-std::array<float,2>{0.0143767344f, 0.586893559f},
-std::array<float,2>{0.561221063f, 0.420127809f},
-std::array<float,2>{0.701020956f, 0.72734201f},
-std::array<float,2>{0.131412297f, 0.354415268f},
-std::array<float,2>{0.47353363f, 0.981952429f},
-std::array<float,2>{0.932328045f, 0.220310807f},
-std::array<float,2>{0.82455945f, 0.661274374f},
-std::array<float,2>{0.253648609f, 0.268224567f},
-std::array<float,2>{0.11964488f, 0.880557656f},
-std::array<float,2>{0.613969147f, 0.165197715f},
-std::array<float,2>{0.667930245f, 0.796364427f},
-std::array<float,2>{0.22561428f, 0.0507932603f},
-std::array<float,2>{0.405581176f, 0.522626996f},
-std::array<float,2>{0.973936856f, 0.474386901f},
-std::array<float,2>{0.901702583f, 0.949265778f},
-std::array<float,2>{0.453134418f, 0.202887014f},
-std::array<float,2>{0.160936102f, 0.688836873f},
-std::array<float,2>{0.722982109f, 0.329945117f},
-std::array<float,2>{0.502359569f, 0.606238365f},
-std::array<float,2>{0.0353230461f, 0.392354548f},
-std::array<float,2>{0.337999105f, 0.816391051f},
-std::array<float,2>{0.800821066f, 0.0692710429f},
-std::array<float,2>{0.909560084f, 0.708396494f},
-std::array<float,2>{0.485977232f, 0.319923401f},
-std::array<float,2>{0.150543988f, 0.958681405f},
-std::array<float,2>{0.711819768f, 0.205106556f},
-std::array<float,2>{0.53326714f, 0.832416058f},
-std::array<float,2>{0.0168483648f, 0.0812914371f},
-std::array<float,2>{0.362400323f, 0.62409693f},
-std::array<float,2>{0.775630832f, 0.38362968f},
-std::array<float,2>{0.85662663f, 0.894278288f},
-std::array<float,2>{0.309280246f, 0.18053332f},
-std::array<float,2>{0.0735546127f, 0.67941606f},
-std::array<float,2>{0.564195454f, 0.260783046f},
-std::array<float,2>{0.640708387f, 0.50683409f},
-std::array<float,2>{0.200193316f, 0.487473935f},
-std::array<float,2>{0.420364916f, 0.79743731f},
-std::array<float,2>{0.966621995f, 0.043196898f},
-std::array<float,2>{0.788868129f, 0.57084012f},
-std::array<float,2>{0.325298876f, 0.433365643f},
-std::array<float,2>{0.0593672357f, 0.856442451f},
-std::array<float,2>{0.520821214f, 0.104500964f},
-std::array<float,2>{0.739175022f, 0.985759139f},
-std::array<float,2>{0.180055648f, 0.246593043f},
-std::array<float,2>{0.447700381f, 0.740069628f},
-std::array<float,2>{0.878342271f, 0.362708569f},
-std::array<float,2>{0.994997442f, 0.756309748f},
-std::array<float,2>{0.389822692f, 0.012867298f},
-std::array<float,2>{0.240480438f, 0.544031918f},
-std::array<float,2>{0.67596817f, 0.439844787f},
-std::array<float,2>{0.601459742f, 0.632387996f},
-std::array<float,2>{0.108927056f, 0.304329276f},
-std::array<float,2>{0.279786885f, 0.929968953f},
-std::array<float,2>{0.840295553f, 0.142275274f},
-std::array<float,2>{0.98635304f, 0.590141892f},
-std::array<float,2>{0.376944333f, 0.416310221f},
-std::array<float,2>{0.243622854f, 0.867147982f},
-std::array<float,2>{0.685874581f, 0.113224208f},
-std::array<float,2>{0.604191363f, 0.979210734f},
-std::array<float,2>{0.100913711f, 0.223304302f},
-std::array<float,2>{0.273371875f, 0.731197119f},
-std::array<float,2>{0.83003974f, 0.357908815f},
-std::array<float,2>{0.796034813f, 0.769152939f},
-std::array<float,2>{0.318681628f, 0.0190582238f},
-std::array<float,2>{0.0505295955f, 0.553079545f},
-std::array<float,2>{0.530362248f, 0.457311392f},
-std::array<float,2>{0.746989429f, 0.646870553f},
-std::array<float,2>{0.179134831f, 0.282397032f},
-std::array<float,2>{0.444880158f, 0.917872608f},
-std::array<float,2>{0.88996613f, 0.126222923f},
-std::array<float,2>{0.850934505f, 0.691903055f},
-std::array<float,2>{0.296963215f, 0.333295405f},
-std::array<float,2>{0.0695731416f, 0.945510745f},
-std::array<float,2>{0.57115525f, 0.197123855f},
-std::array<float,2>{0.652892828f, 0.82006371f},
-std::array<float,2>{0.193953082f, 0.063948907f},
-std::array<float,2>{0.408788979f, 0.604346514f},
-std::array<float,2>{0.958163261f, 0.39792347f},
-std::array<float,2>{0.917419553f, 0.877407491f},
-std::array<float,2>{0.49717629f, 0.169754073f},
-std::array<float,2>{0.142192349f, 0.659786165f},
-std::array<float,2>{0.704431593f, 0.270068973f},
-std::array<float,2>{0.543547869f, 0.516739428f},
-std::array<float,2>{0.0291540772f, 0.472603172f},
-std::array<float,2>{0.372516125f, 0.792422891f},
-std::array<float,2>{0.772432566f, 0.0483326688f},
-std::array<float,2>{0.895322919f, 0.675688028f},
-std::array<float,2>{0.46228376f, 0.263988107f},
-std::array<float,2>{0.168972179f, 0.895786107f},
-std::array<float,2>{0.732826054f, 0.184260741f},
-std::array<float,2>{0.514095366f, 0.803179979f},
-std::array<float,2>{0.040388599f, 0.0409098491f},
-std::array<float,2>{0.335780412f, 0.502386749f},
-std::array<float,2>{0.809558094f, 0.489989609f},
-std::array<float,2>{0.816351831f, 0.956120849f},
-std::array<float,2>{0.260102987f, 0.209609896f},
-std::array<float,2>{0.116370186f, 0.704209805f},
-std::array<float,2>{0.617783725f, 0.312812358f},
-std::array<float,2>{0.661633074f, 0.617956698f},
-std::array<float,2>{0.229673386f, 0.387393177f},
-std::array<float,2>{0.393135041f, 0.830929637f},
-std::array<float,2>{0.981792808f, 0.0824499577f},
-std::array<float,2>{0.751400173f, 0.540690422f},
-std::array<float,2>{0.346729547f, 0.441851169f},
-std::array<float,2>{0.0056137396f, 0.752679884f},
-std::array<float,2>{0.550120711f, 0.0107707437f},
-std::array<float,2>{0.687526047f, 0.937139511f},
-std::array<float,2>{0.137008309f, 0.147352159f},
-std::array<float,2>{0.478310764f, 0.626146793f},
-std::array<float,2>{0.927563787f, 0.299114227f},
-std::array<float,2>{0.940709293f, 0.852894664f},
-std::array<float,2>{0.42634505f, 0.107193366f},
-std::array<float,2>{0.214069918f, 0.576231837f},
-std::array<float,2>{0.626408279f, 0.434152752f},
-std::array<float,2>{0.590187967f, 0.734941125f},
-std::array<float,2>{0.0781908557f, 0.365242749f},
-std::array<float,2>{0.285147786f, 0.991701961f},
-std::array<float,2>{0.867295086f, 0.242664397f},
-std::array<float,2>{0.934447169f, 0.51510793f},
-std::array<float,2>{0.472578526f, 0.498297423f},
-std::array<float,2>{0.128322721f, 0.810669601f},
-std::array<float,2>{0.696660221f, 0.0372484811f},
-std::array<float,2>{0.555397928f, 0.900618315f},
-std::array<float,2>{0.0108733177f, 0.177550733f},
-std::array<float,2>{0.358579695f, 0.683722258f},
-std::array<float,2>{0.763273954f, 0.255240142f},
-std::array<float,2>{0.85991323f, 0.840478361f},
-std::array<float,2>{0.294564843f, 0.0890789926f},
-std::array<float,2>{0.0863096863f, 0.615046382f},
-std::array<float,2>{0.579437912f, 0.378628671f},
-std::array<float,2>{0.639530718f, 0.718402088f},
-std::array<float,2>{0.205743834f, 0.32153213f},
-std::array<float,2>{0.430619836f, 0.963115871f},
-std::array<float,2>{0.952596843f, 0.213892028f},
-std::array<float,2>{0.798005402f, 0.639964402f},
-std::array<float,2>{0.340119839f, 0.306267262f},
-std::array<float,2>{0.0347515829f, 0.925316036f},
-std::array<float,2>{0.504989862f, 0.155381322f},
-std::array<float,2>{0.721437752f, 0.764665186f},
-std::array<float,2>{0.156741709f, 0.000384125975f},
-std::array<float,2>{0.460077345f, 0.533135176f},
-std::array<float,2>{0.904138744f, 0.448516607f},
-std::array<float,2>{0.969897389f, 0.994608283f},
-std::array<float,2>{0.399866819f, 0.240508124f},
-std::array<float,2>{0.222626135f, 0.748288035f},
-std::array<float,2>{0.671586752f, 0.370265096f},
-std::array<float,2>{0.609873891f, 0.562876105f},
-std::array<float,2>{0.124668553f, 0.427548289f},
-std::array<float,2>{0.257429689f, 0.846258283f},
-std::array<float,2>{0.823984027f, 0.0990742669f},
-std::array<float,2>{0.963384688f, 0.724679291f},
-std::array<float,2>{0.417446107f, 0.350363135f},
-std::array<float,2>{0.195985779f, 0.975406826f},
-std::array<float,2>{0.644657552f, 0.232414305f},
-std::array<float,2>{0.569958448f, 0.873412192f},
-std::array<float,2>{0.0766509995f, 0.117424771f},
-std::array<float,2>{0.306978315f, 0.580532491f},
-std::array<float,2>{0.853696525f, 0.412135214f},
-std::array<float,2>{0.778194249f, 0.908137023f},
-std::array<float,2>{0.364124328f, 0.134249926f},
-std::array<float,2>{0.0209536999f, 0.652679443f},
-std::array<float,2>{0.538081169f, 0.291227579f},
-std::array<float,2>{0.718517363f, 0.560281754f},
-std::array<float,2>{0.153089494f, 0.462720037f},
-std::array<float,2>{0.491730779f, 0.778618813f},
-std::array<float,2>{0.913362265f, 0.0246068407f},
-std::array<float,2>{0.838469148f, 0.600346684f},
-std::array<float,2>{0.274015129f, 0.400672615f},
-std::array<float,2>{0.104698971f, 0.820533812f},
-std::array<float,2>{0.595019639f, 0.0738614276f},
-std::array<float,2>{0.675306261f, 0.942799687f},
-std::array<float,2>{0.236323044f, 0.18954815f},
-std::array<float,2>{0.383685738f, 0.702936053f},
-std::array<float,2>{0.997338653f, 0.340777606f},
-std::array<float,2>{0.879578471f, 0.788252115f},
-std::array<float,2>{0.452395171f, 0.05946704f},
-std::array<float,2>{0.184871435f, 0.529181838f},
-std::array<float,2>{0.73780477f, 0.481579304f},
-std::array<float,2>{0.517539263f, 0.664678574f},
-std::array<float,2>{0.0574955009f, 0.279759765f},
-std::array<float,2>{0.323641419f, 0.888620317f},
-std::array<float,2>{0.784867048f, 0.15668419f},
-std::array<float,2>{0.925472736f, 0.595299482f},
-std::array<float,2>{0.481356114f, 0.403196603f},
-std::array<float,2>{0.135914236f, 0.825124919f},
-std::array<float,2>{0.692549646f, 0.0767659098f},
-std::array<float,2>{0.55372113f, 0.938318014f},
-std::array<float,2>{0.00373156741f, 0.194465324f},
-std::array<float,2>{0.350555748f, 0.696524382f},
-std::array<float,2>{0.756822944f, 0.336470872f},
-std::array<float,2>{0.873197973f, 0.783854842f},
-std::array<float,2>{0.285434335f, 0.0574140437f},
-std::array<float,2>{0.0837802514f, 0.52676326f},
-std::array<float,2>{0.587300897f, 0.47979185f},
-std::array<float,2>{0.631897151f, 0.671762824f},
-std::array<float,2>{0.215706646f, 0.276271075f},
-std::array<float,2>{0.422122627f, 0.885208905f},
-std::array<float,2>{0.942062616f, 0.163580522f},
-std::array<float,2>{0.808010995f, 0.719301224f},
-std::array<float,2>{0.328868628f, 0.346991897f},
-std::array<float,2>{0.0441065319f, 0.970132589f},
-std::array<float,2>{0.511073411f, 0.229847208f},
-std::array<float,2>{0.727608562f, 0.867258489f},
-std::array<float,2>{0.167624071f, 0.124048144f},
-std::array<float,2>{0.466817409f, 0.585826218f},
-std::array<float,2>{0.890805125f, 0.409291476f},
-std::array<float,2>{0.978811502f, 0.911129475f},
-std::array<float,2>{0.397325218f, 0.139141694f},
-std::array<float,2>{0.233138874f, 0.650637448f},
-std::array<float,2>{0.657835901f, 0.294427782f},
-std::array<float,2>{0.622843862f, 0.557839513f},
-std::array<float,2>{0.111400969f, 0.464918405f},
-std::array<float,2>{0.263511062f, 0.774592876f},
-std::array<float,2>{0.818586469f, 0.0306158867f},
-std::array<float,2>{0.955086231f, 0.636628866f},
-std::array<float,2>{0.411480486f, 0.312235653f},
-std::array<float,2>{0.188483685f, 0.928709447f},
-std::array<float,2>{0.649357975f, 0.152269334f},
-std::array<float,2>{0.575600743f, 0.760386169f},
-std::array<float,2>{0.0630840883f, 0.00681593036f},
-std::array<float,2>{0.301266909f, 0.536885619f},
-std::array<float,2>{0.847352922f, 0.450631529f},
-std::array<float,2>{0.767408431f, 0.996231496f},
-std::array<float,2>{0.3708148f, 0.23484312f},
-std::array<float,2>{0.0239859428f, 0.742770433f},
-std::array<float,2>{0.539483845f, 0.373806596f},
-std::array<float,2>{0.710902691f, 0.568795919f},
-std::array<float,2>{0.146718413f, 0.424039572f},
-std::array<float,2>{0.495503753f, 0.851466894f},
-std::array<float,2>{0.918940127f, 0.0963248983f},
-std::array<float,2>{0.832417071f, 0.51083833f},
-std::array<float,2>{0.266411304f, 0.493144304f},
-std::array<float,2>{0.0967608988f, 0.806935906f},
-std::array<float,2>{0.608510494f, 0.0327443555f},
-std::array<float,2>{0.680737317f, 0.902780294f},
-std::array<float,2>{0.246443301f, 0.173802912f},
-std::array<float,2>{0.382692486f, 0.683343351f},
-std::array<float,2>{0.990357935f, 0.250901341f},
-std::array<float,2>{0.884384871f, 0.836773515f},
-std::array<float,2>{0.437767923f, 0.0913985297f},
-std::array<float,2>{0.174527913f, 0.60991776f},
-std::array<float,2>{0.742573857f, 0.379994929f},
-std::array<float,2>{0.525031567f, 0.711139858f},
-std::array<float,2>{0.0540079176f, 0.327455521f},
-std::array<float,2>{0.316272944f, 0.966965497f},
-std::array<float,2>{0.789322197f, 0.217035577f},
-std::array<float,2>{0.993596375f, 0.543071508f},
-std::array<float,2>{0.387609273f, 0.441277415f},
-std::array<float,2>{0.239634871f, 0.757215083f},
-std::array<float,2>{0.678988278f, 0.0126281409f},
-std::array<float,2>{0.597928822f, 0.931533873f},
-std::array<float,2>{0.107341334f, 0.141373023f},
-std::array<float,2>{0.278297096f, 0.631736755f},
-std::array<float,2>{0.843081415f, 0.302900344f},
-std::array<float,2>{0.786687911f, 0.856789231f},
-std::array<float,2>{0.32760343f, 0.104333535f},
-std::array<float,2>{0.0608144253f, 0.571788073f},
-std::array<float,2>{0.522562385f, 0.432147712f},
-std::array<float,2>{0.741533935f, 0.738566995f},
-std::array<float,2>{0.182317615f, 0.361857474f},
-std::array<float,2>{0.445904523f, 0.984791338f},
-std::array<float,2>{0.875164628f, 0.247435242f},
-std::array<float,2>{0.858623028f, 0.678435385f},
-std::array<float,2>{0.310691386f, 0.260650992f},
-std::array<float,2>{0.0708682686f, 0.893452883f},
-std::array<float,2>{0.564956784f, 0.181310669f},
-std::array<float,2>{0.643704414f, 0.798292816f},
-std::array<float,2>{0.20290482f, 0.0440103188f},
-std::array<float,2>{0.418366939f, 0.507600963f},
-std::array<float,2>{0.96741277f, 0.486589968f},
-std::array<float,2>{0.907724321f, 0.957877696f},
-std::array<float,2>{0.488123298f, 0.206990063f},
-std::array<float,2>{0.150163546f, 0.707926393f},
-std::array<float,2>{0.714603841f, 0.318539679f},
-std::array<float,2>{0.531880498f, 0.62400192f},
-std::array<float,2>{0.0190308653f, 0.384490192f},
-std::array<float,2>{0.359844923f, 0.833848476f},
-std::array<float,2>{0.77428323f, 0.0808088928f},
-std::array<float,2>{0.898880422f, 0.687749624f},
-std::array<float,2>{0.455785662f, 0.32882905f},
-std::array<float,2>{0.163646802f, 0.950841367f},
-std::array<float,2>{0.726335645f, 0.202113628f},
-std::array<float,2>{0.500350535f, 0.815297842f},
-std::array<float,2>{0.0383145213f, 0.0697617829f},
-std::array<float,2>{0.337244451f, 0.607002199f},
-std::array<float,2>{0.803612232f, 0.390761614f},
-std::array<float,2>{0.827235341f, 0.879665792f},
-std::array<float,2>{0.250356674f, 0.164649099f},
-std::array<float,2>{0.11796052f, 0.660393059f},
-std::array<float,2>{0.617078185f, 0.268859088f},
-std::array<float,2>{0.665967822f, 0.522214532f},
-std::array<float,2>{0.223598555f, 0.473029524f},
-std::array<float,2>{0.404127032f, 0.795526445f},
-std::array<float,2>{0.976416051f, 0.0518167019f},
-std::array<float,2>{0.760210991f, 0.587387204f},
-std::array<float,2>{0.354210705f, 0.421395093f},
-std::array<float,2>{0.0119323833f, 0.859451175f},
-std::array<float,2>{0.559127867f, 0.113778226f},
-std::array<float,2>{0.70127815f, 0.980688691f},
-std::array<float,2>{0.130213052f, 0.219544679f},
-std::array<float,2>{0.474821895f, 0.727929235f},
-std::array<float,2>{0.930103004f, 0.355291545f},
-std::array<float,2>{0.947898448f, 0.772581577f},
-std::array<float,2>{0.436900973f, 0.0196345225f},
-std::array<float,2>{0.208765507f, 0.548168898f},
-std::array<float,2>{0.634169459f, 0.456388384f},
-std::array<float,2>{0.585638046f, 0.641290367f},
-std::array<float,2>{0.0931235999f, 0.287935853f},
-std::array<float,2>{0.289492011f, 0.9201563f},
-std::array<float,2>{0.865935326f, 0.130154461f},
-std::array<float,2>{0.937746942f, 0.57754451f},
-std::array<float,2>{0.429310977f, 0.434835851f},
-std::array<float,2>{0.211296782f, 0.85239327f},
-std::array<float,2>{0.627974391f, 0.106396005f},
-std::array<float,2>{0.592532694f, 0.990913868f},
-std::array<float,2>{0.0812103674f, 0.243549481f},
-std::array<float,2>{0.282576889f, 0.735407889f},
-std::array<float,2>{0.869581819f, 0.36636889f},
-std::array<float,2>{0.752396286f, 0.753311336f},
-std::array<float,2>{0.344288319f, 0.00995272025f},
-std::array<float,2>{0.00628179312f, 0.539712787f},
-std::array<float,2>{0.547908545f, 0.442543477f},
-std::array<float,2>{0.691299081f, 0.625834584f},
-std::array<float,2>{0.140285864f, 0.300502688f},
-std::array<float,2>{0.479488403f, 0.935982406f},
-std::array<float,2>{0.929393768f, 0.147745892f},
-std::array<float,2>{0.81363827f, 0.703771114f},
-std::array<float,2>{0.258841008f, 0.314133316f},
-std::array<float,2>{0.114875555f, 0.955095351f},
-std::array<float,2>{0.619976938f, 0.21081984f},
-std::array<float,2>{0.663770497f, 0.831701219f},
-std::array<float,2>{0.226609349f, 0.083817631f},
-std::array<float,2>{0.391385943f, 0.618554533f},
-std::array<float,2>{0.982613683f, 0.38845849f},
-std::array<float,2>{0.896533132f, 0.894886732f},
-std::array<float,2>{0.46291399f, 0.184771895f},
-std::array<float,2>{0.171041697f, 0.674055696f},
-std::array<float,2>{0.731934071f, 0.265276343f},
-std::array<float,2>{0.512493551f, 0.503084123f},
-std::array<float,2>{0.041893892f, 0.48835808f},
-std::array<float,2>{0.332645684f, 0.80438745f},
-std::array<float,2>{0.8109231f, 0.0394052379f},
-std::array<float,2>{0.914474845f, 0.658672571f},
-std::array<float,2>{0.498823792f, 0.27143839f},
-std::array<float,2>{0.143851399f, 0.878181159f},
-std::array<float,2>{0.705558777f, 0.168168351f},
-std::array<float,2>{0.545713365f, 0.791676104f},
-std::array<float,2>{0.030228015f, 0.0477911085f},
-std::array<float,2>{0.374395698f, 0.515888989f},
-std::array<float,2>{0.771133065f, 0.470712274f},
-std::array<float,2>{0.848946631f, 0.947243929f},
-std::array<float,2>{0.299533993f, 0.196115196f},
-std::array<float,2>{0.0667013973f, 0.692919791f},
-std::array<float,2>{0.573150098f, 0.332443118f},
-std::array<float,2>{0.655096531f, 0.605161846f},
-std::array<float,2>{0.193151936f, 0.396628916f},
-std::array<float,2>{0.407778651f, 0.818519533f},
-std::array<float,2>{0.959554553f, 0.0630619749f},
-std::array<float,2>{0.793352723f, 0.554222465f},
-std::array<float,2>{0.31783095f, 0.458139271f},
-std::array<float,2>{0.048258692f, 0.768211544f},
-std::array<float,2>{0.529165208f, 0.0177978165f},
-std::array<float,2>{0.749241352f, 0.916386187f},
-std::array<float,2>{0.176825747f, 0.125697106f},
-std::array<float,2>{0.441664606f, 0.64786166f},
-std::array<float,2>{0.888421774f, 0.281654447f},
-std::array<float,2>{0.985649526f, 0.865485966f},
-std::array<float,2>{0.377237886f, 0.111823589f},
-std::array<float,2>{0.245280907f, 0.591640174f},
-std::array<float,2>{0.684895337f, 0.417197794f},
-std::array<float,2>{0.603248835f, 0.731933534f},
-std::array<float,2>{0.0989162102f, 0.358837605f},
-std::array<float,2>{0.270307899f, 0.980370939f},
-std::array<float,2>{0.830753803f, 0.22441341f},
-std::array<float,2>{0.881623387f, 0.52740854f},
-std::array<float,2>{0.44987911f, 0.481318325f},
-std::array<float,2>{0.186842769f, 0.787345648f},
-std::array<float,2>{0.734524429f, 0.0598609f},
-std::array<float,2>{0.518531799f, 0.887291789f},
-std::array<float,2>{0.0559601896f, 0.157546148f},
-std::array<float,2>{0.322113544f, 0.665458143f},
-std::array<float,2>{0.782806277f, 0.280920833f},
-std::array<float,2>{0.837663591f, 0.822129667f},
-std::array<float,2>{0.27567789f, 0.0731839165f},
-std::array<float,2>{0.102341741f, 0.601356924f},
-std::array<float,2>{0.596979916f, 0.402193606f},
-std::array<float,2>{0.673160613f, 0.701493859f},
-std::array<float,2>{0.23694326f, 0.34131223f},
-std::array<float,2>{0.385380387f, 0.941793382f},
-std::array<float,2>{0.998570561f, 0.190524355f},
-std::array<float,2>{0.779660165f, 0.653473735f},
-std::array<float,2>{0.36673224f, 0.292402118f},
-std::array<float,2>{0.0221355986f, 0.907149494f},
-std::array<float,2>{0.53542012f, 0.133509427f},
-std::array<float,2>{0.716475129f, 0.777429461f},
-std::array<float,2>{0.154990911f, 0.0234556198f},
-std::array<float,2>{0.488406956f, 0.559337437f},
-std::array<float,2>{0.911868691f, 0.461576074f},
-std::array<float,2>{0.962325156f, 0.976528823f},
-std::array<float,2>{0.415156931f, 0.230815545f},
-std::array<float,2>{0.199093461f, 0.726382613f},
-std::array<float,2>{0.6466465f, 0.350684613f},
-std::array<float,2>{0.567736983f, 0.581594229f},
-std::array<float,2>{0.0751967728f, 0.413425952f},
-std::array<float,2>{0.305223167f, 0.874579489f},
-std::array<float,2>{0.852952242f, 0.118365876f},
-std::array<float,2>{0.971033692f, 0.749583781f},
-std::array<float,2>{0.402082294f, 0.369884908f},
-std::array<float,2>{0.219195798f, 0.995253682f},
-std::array<float,2>{0.669553757f, 0.241746604f},
-std::array<float,2>{0.612046897f, 0.84720695f},
-std::array<float,2>{0.121918641f, 0.0984022841f},
-std::array<float,2>{0.254666507f, 0.563983798f},
-std::array<float,2>{0.822012544f, 0.426543981f},
-std::array<float,2>{0.800462425f, 0.923899651f},
-std::array<float,2>{0.342944771f, 0.155045912f},
-std::array<float,2>{0.0315342546f, 0.639165998f},
-std::array<float,2>{0.506894171f, 0.304821938f},
-std::array<float,2>{0.718899965f, 0.531442285f},
-std::array<float,2>{0.159817964f, 0.448012084f},
-std::array<float,2>{0.457536817f, 0.763694406f},
-std::array<float,2>{0.906030238f, 0.00175136828f},
-std::array<float,2>{0.86270678f, 0.613867044f},
-std::array<float,2>{0.295862138f, 0.377364993f},
-std::array<float,2>{0.0890388712f, 0.84087348f},
-std::array<float,2>{0.580687702f, 0.0886410698f},
-std::array<float,2>{0.637582302f, 0.964410901f},
-std::array<float,2>{0.204443753f, 0.213620886f},
-std::array<float,2>{0.433399767f, 0.716957629f},
-std::array<float,2>{0.950252473f, 0.320766449f},
-std::array<float,2>{0.93563503f, 0.812481523f},
-std::array<float,2>{0.470085382f, 0.0381940864f},
-std::array<float,2>{0.126304761f, 0.514202058f},
-std::array<float,2>{0.697729468f, 0.4992401f},
-std::array<float,2>{0.557394624f, 0.685376406f},
-std::array<float,2>{0.0079208333f, 0.254179686f},
-std::array<float,2>{0.356503129f, 0.902338922f},
-std::array<float,2>{0.764370203f, 0.176256195f},
-std::array<float,2>{0.893130004f, 0.583714962f},
-std::array<float,2>{0.465911031f, 0.406524777f},
-std::array<float,2>{0.165755853f, 0.870473444f},
-std::array<float,2>{0.730010569f, 0.122155353f},
-std::array<float,2>{0.508070052f, 0.970980108f},
-std::array<float,2>{0.0456575267f, 0.228452861f},
-std::array<float,2>{0.330220908f, 0.72226578f},
-std::array<float,2>{0.804818392f, 0.345225513f},
-std::array<float,2>{0.818285465f, 0.776411593f},
-std::array<float,2>{0.264457673f, 0.0287686381f},
-std::array<float,2>{0.11102128f, 0.555648267f},
-std::array<float,2>{0.624661028f, 0.467306107f},
-std::array<float,2>{0.658231378f, 0.64975822f},
-std::array<float,2>{0.231805056f, 0.29498446f},
-std::array<float,2>{0.396264344f, 0.913797617f},
-std::array<float,2>{0.97786665f, 0.137545407f},
-std::array<float,2>{0.75554353f, 0.698245406f},
-std::array<float,2>{0.348451763f, 0.338392973f},
-std::array<float,2>{0.00123129936f, 0.941317856f},
-std::array<float,2>{0.552702963f, 0.19231914f},
-std::array<float,2>{0.693648875f, 0.826690912f},
-std::array<float,2>{0.133416563f, 0.0758727714f},
-std::array<float,2>{0.484370023f, 0.596386909f},
-std::array<float,2>{0.922251523f, 0.405072182f},
-std::array<float,2>{0.945245206f, 0.883287549f},
-std::array<float,2>{0.424193114f, 0.161966205f},
-std::array<float,2>{0.217445433f, 0.669557452f},
-std::array<float,2>{0.629892707f, 0.275057554f},
-std::array<float,2>{0.588975668f, 0.524178207f},
-std::array<float,2>{0.0859190747f, 0.477125585f},
-std::array<float,2>{0.28799516f, 0.78222543f},
-std::array<float,2>{0.871442556f, 0.0549260229f},
-std::array<float,2>{0.990211725f, 0.679696739f},
-std::array<float,2>{0.379501969f, 0.253403127f},
-std::array<float,2>{0.249192193f, 0.905139029f},
-std::array<float,2>{0.682993054f, 0.174672395f},
-std::array<float,2>{0.606287837f, 0.804835856f},
-std::array<float,2>{0.094773896f, 0.0339029618f},
-std::array<float,2>{0.26856035f, 0.508059561f},
-std::array<float,2>{0.834770083f, 0.4955073f},
-std::array<float,2>{0.791541815f, 0.965313196f},
-std::array<float,2>{0.313786894f, 0.215417698f},
-std::array<float,2>{0.0511749983f, 0.714571118f},
-std::array<float,2>{0.526997983f, 0.325213552f},
-std::array<float,2>{0.744201183f, 0.611956716f},
-std::array<float,2>{0.171920702f, 0.382083148f},
-std::array<float,2>{0.440176666f, 0.839378536f},
-std::array<float,2>{0.886017323f, 0.0922206119f},
-std::array<float,2>{0.84402138f, 0.538629174f},
-std::array<float,2>{0.303751528f, 0.452676147f},
-std::array<float,2>{0.0662308559f, 0.759142995f},
-std::array<float,2>{0.576958179f, 0.00412372127f},
-std::array<float,2>{0.651949942f, 0.926478744f},
-std::array<float,2>{0.190864712f, 0.148715988f},
-std::array<float,2>{0.412888885f, 0.63353157f},
-std::array<float,2>{0.953963578f, 0.310168058f},
-std::array<float,2>{0.920388699f, 0.849395096f},
-std::array<float,2>{0.493399084f, 0.0937670544f},
-std::array<float,2>{0.144685298f, 0.568246603f},
-std::array<float,2>{0.708139479f, 0.422792971f},
-std::array<float,2>{0.54174614f, 0.744580925f},
-std::array<float,2>{0.0266245175f, 0.371716946f},
-std::array<float,2>{0.368049532f, 0.998241842f},
-std::array<float,2>{0.769503355f, 0.237693653f},
-std::array<float,2>{0.965561986f, 0.505096614f},
-std::array<float,2>{0.421692044f, 0.484675705f},
-std::array<float,2>{0.200976491f, 0.799376249f},
-std::array<float,2>{0.641934872f, 0.0453133918f},
-std::array<float,2>{0.562505305f, 0.890777528f},
-std::array<float,2>{0.0731850713f, 0.181977272f},
-std::array<float,2>{0.31038928f, 0.675903559f},
-std::array<float,2>{0.8563326f, 0.258384556f},
-std::array<float,2>{0.777213514f, 0.835174739f},
-std::array<float,2>{0.362019509f, 0.0798471272f},
-std::array<float,2>{0.0160719771f, 0.62128526f},
-std::array<float,2>{0.534583628f, 0.386414349f},
-std::array<float,2>{0.712641835f, 0.709587216f},
-std::array<float,2>{0.151500672f, 0.31732592f},
-std::array<float,2>{0.484435707f, 0.960550368f},
-std::array<float,2>{0.908848822f, 0.203895807f},
-std::array<float,2>{0.841493666f, 0.629013062f},
-std::array<float,2>{0.280356109f, 0.301154613f},
-std::array<float,2>{0.108045876f, 0.933060825f},
-std::array<float,2>{0.600470483f, 0.142974988f},
-std::array<float,2>{0.676942229f, 0.754302919f},
-std::array<float,2>{0.242030814f, 0.0148702404f},
-std::array<float,2>{0.38937676f, 0.546163797f},
-std::array<float,2>{0.99546361f, 0.438758403f},
-std::array<float,2>{0.877671599f, 0.987948f},
-std::array<float,2>{0.448415011f, 0.24890472f},
-std::array<float,2>{0.18141602f, 0.741698563f},
-std::array<float,2>{0.73933208f, 0.360848069f},
-std::array<float,2>{0.52046448f, 0.573446929f},
-std::array<float,2>{0.060490869f, 0.431206793f},
-std::array<float,2>{0.325068653f, 0.857729495f},
-std::array<float,2>{0.787910819f, 0.101638079f},
-std::array<float,2>{0.932896435f, 0.729993641f},
-std::array<float,2>{0.47397697f, 0.35298264f},
-std::array<float,2>{0.132272854f, 0.983526349f},
-std::array<float,2>{0.7000525f, 0.221319795f},
-std::array<float,2>{0.561987102f, 0.863139033f},
-std::array<float,2>{0.0148174427f, 0.116675511f},
-std::array<float,2>{0.352894902f, 0.589238703f},
-std::array<float,2>{0.759185433f, 0.419806331f},
-std::array<float,2>{0.864589572f, 0.919648111f},
-std::array<float,2>{0.29204905f, 0.132713929f},
-std::array<float,2>{0.0914418325f, 0.643669903f},
-std::array<float,2>{0.582805812f, 0.285773158f},
-std::array<float,2>{0.634836316f, 0.550507963f},
-std::array<float,2>{0.209030032f, 0.453529418f},
-std::array<float,2>{0.434233546f, 0.770355821f},
-std::array<float,2>{0.946966946f, 0.0232223347f},
-std::array<float,2>{0.802705586f, 0.608068109f},
-std::array<float,2>{0.338941097f, 0.393299103f},
-std::array<float,2>{0.0365465395f, 0.814287305f},
-std::array<float,2>{0.503271818f, 0.0683235079f},
-std::array<float,2>{0.723940074f, 0.952439845f},
-std::array<float,2>{0.16197522f, 0.20010139f},
-std::array<float,2>{0.455010533f, 0.689652443f},
-std::array<float,2>{0.900723338f, 0.330952823f},
-std::array<float,2>{0.972909093f, 0.793672025f},
-std::array<float,2>{0.4044514f, 0.0531686097f},
-std::array<float,2>{0.225181699f, 0.520379841f},
-std::array<float,2>{0.666147292f, 0.475627393f},
-std::array<float,2>{0.614491045f, 0.66345793f},
-std::array<float,2>{0.120826155f, 0.265801698f},
-std::array<float,2>{0.252895534f, 0.882002652f},
-std::array<float,2>{0.825800538f, 0.167231336f},
-std::array<float,2>{0.980680346f, 0.620730042f},
-std::array<float,2>{0.393867403f, 0.389175802f},
-std::array<float,2>{0.229413778f, 0.828211129f},
-std::array<float,2>{0.66087234f, 0.0851167068f},
-std::array<float,2>{0.619065225f, 0.954209745f},
-std::array<float,2>{0.115522042f, 0.208250374f},
-std::array<float,2>{0.260811806f, 0.706341922f},
-std::array<float,2>{0.815319955f, 0.315382808f},
-std::array<float,2>{0.809730768f, 0.802621841f},
-std::array<float,2>{0.33432731f, 0.0417602062f},
-std::array<float,2>{0.0398131423f, 0.500830233f},
-std::array<float,2>{0.515394449f, 0.492053658f},
-std::array<float,2>{0.73362726f, 0.672064185f},
-std::array<float,2>{0.168780491f, 0.263315231f},
-std::array<float,2>{0.461897254f, 0.898257375f},
-std::array<float,2>{0.896291733f, 0.187219173f},
-std::array<float,2>{0.868260562f, 0.738001108f},
-std::array<float,2>{0.283721834f, 0.364532262f},
-std::array<float,2>{0.079862088f, 0.989280403f},
-std::array<float,2>{0.591285765f, 0.245012775f},
-std::array<float,2>{0.625570714f, 0.853537679f},
-std::array<float,2>{0.213411435f, 0.107897654f},
-std::array<float,2>{0.427099705f, 0.575629652f},
-std::array<float,2>{0.939620912f, 0.437167764f},
-std::array<float,2>{0.925949693f, 0.93455869f},
-std::array<float,2>{0.476758987f, 0.145342618f},
-std::array<float,2>{0.138487294f, 0.628789127f},
-std::array<float,2>{0.689347029f, 0.298607498f},
-std::array<float,2>{0.549663663f, 0.541691244f},
-std::array<float,2>{0.00449777022f, 0.444782287f},
-std::array<float,2>{0.346627295f, 0.751752377f},
-std::array<float,2>{0.750353634f, 0.00899324566f},
-std::array<float,2>{0.889466166f, 0.646239936f},
-std::array<float,2>{0.443687767f, 0.283863395f},
-std::array<float,2>{0.17835243f, 0.915477216f},
-std::array<float,2>{0.747745454f, 0.128727123f},
-std::array<float,2>{0.529827714f, 0.767363548f},
-std::array<float,2>{0.0494869761f, 0.0169637036f},
-std::array<float,2>{0.319788843f, 0.55259198f},
-std::array<float,2>{0.795693159f, 0.459414721f},
-std::array<float,2>{0.828423202f, 0.978048205f},
-std::array<float,2>{0.271783739f, 0.226024941f},
-std::array<float,2>{0.0999282822f, 0.732781291f},
-std::array<float,2>{0.605364621f, 0.356209427f},
-std::array<float,2>{0.687035441f, 0.593727469f},
-std::array<float,2>{0.242375165f, 0.414684504f},
-std::array<float,2>{0.375497699f, 0.864021122f},
-std::array<float,2>{0.987620831f, 0.109810628f},
-std::array<float,2>{0.772817612f, 0.518238306f},
-std::array<float,2>{0.371731937f, 0.470444113f},
-std::array<float,2>{0.0278561004f, 0.79022342f},
-std::array<float,2>{0.544053018f, 0.0496818982f},
-std::array<float,2>{0.703852654f, 0.875579834f},
-std::array<float,2>{0.141056538f, 0.170031443f},
-std::array<float,2>{0.496841073f, 0.656385422f},
-std::array<float,2>{0.916715443f, 0.273279756f},
-std::array<float,2>{0.957384884f, 0.818032742f},
-std::array<float,2>{0.409250468f, 0.0651384518f},
-std::array<float,2>{0.195124939f, 0.603080928f},
-std::array<float,2>{0.654285133f, 0.395562768f},
-std::array<float,2>{0.572097838f, 0.695214212f},
-std::array<float,2>{0.0685555637f, 0.335818082f},
-std::array<float,2>{0.298082411f, 0.948141634f},
-std::array<float,2>{0.849987388f, 0.199053764f},
-std::array<float,2>{0.912546337f, 0.56185323f},
-std::array<float,2>{0.490700841f, 0.464098424f},
-std::array<float,2>{0.153890088f, 0.781032085f},
-std::array<float,2>{0.717205524f, 0.0272144321f},
-std::array<float,2>{0.538432777f, 0.909598589f},
-std::array<float,2>{0.0202524625f, 0.136583149f},
-std::array<float,2>{0.365209013f, 0.65524286f},
-std::array<float,2>{0.779228032f, 0.289269835f},
-std::array<float,2>{0.854535162f, 0.872822583f},
-std::array<float,2>{0.307940871f, 0.119309843f},
-std::array<float,2>{0.078032814f, 0.57901901f},
-std::array<float,2>{0.569118857f, 0.410875082f},
-std::array<float,2>{0.64554435f, 0.724272132f},
-std::array<float,2>{0.196349695f, 0.349439174f},
-std::array<float,2>{0.416389734f, 0.974541128f},
-std::array<float,2>{0.964604914f, 0.233737439f},
-std::array<float,2>{0.78335458f, 0.667488575f},
-std::array<float,2>{0.322337031f, 0.277609527f},
-std::array<float,2>{0.0578456894f, 0.888841569f},
-std::array<float,2>{0.515966892f, 0.158923507f},
-std::array<float,2>{0.736704826f, 0.7862252f},
-std::array<float,2>{0.183689833f, 0.0607689582f},
-std::array<float,2>{0.451755673f, 0.53084439f},
-std::array<float,2>{0.880204737f, 0.483230919f},
-std::array<float,2>{0.99638921f, 0.943767071f},
-std::array<float,2>{0.384344786f, 0.18782036f},
-std::array<float,2>{0.234521851f, 0.700020492f},
-std::array<float,2>{0.674066305f, 0.341954589f},
-std::array<float,2>{0.594353676f, 0.598342419f},
-std::array<float,2>{0.104287162f, 0.400283962f},
-std::array<float,2>{0.274900079f, 0.822520614f},
-std::array<float,2>{0.839811862f, 0.0704905242f},
-std::array<float,2>{0.951234639f, 0.715990424f},
-std::array<float,2>{0.431293786f, 0.322686255f},
-std::array<float,2>{0.206383646f, 0.961896122f},
-std::array<float,2>{0.639817834f, 0.211512208f},
-std::array<float,2>{0.578724325f, 0.842118084f},
-std::array<float,2>{0.0876185596f, 0.0878710002f},
-std::array<float,2>{0.293013513f, 0.616599739f},
-std::array<float,2>{0.860876739f, 0.375510573f},
-std::array<float,2>{0.761750162f, 0.898553967f},
-std::array<float,2>{0.358349532f, 0.179581597f},
-std::array<float,2>{0.00979968812f, 0.685610116f},
-std::array<float,2>{0.556101263f, 0.256213367f},
-std::array<float,2>{0.696229458f, 0.512303412f},
-std::array<float,2>{0.127429128f, 0.496235162f},
-std::array<float,2>{0.47104007f, 0.810229182f},
-std::array<float,2>{0.935166836f, 0.0351885706f},
-std::array<float,2>{0.823235333f, 0.56517458f},
-std::array<float,2>{0.256246954f, 0.42966938f},
-std::array<float,2>{0.123850085f, 0.845438838f},
-std::array<float,2>{0.610850394f, 0.10108614f},
-std::array<float,2>{0.670122504f, 0.993251204f},
-std::array<float,2>{0.221563697f, 0.240045175f},
-std::array<float,2>{0.399319589f, 0.746435046f},
-std::array<float,2>{0.969696999f, 0.367391169f},
-std::array<float,2>{0.902527571f, 0.763133883f},
-std::array<float,2>{0.459793389f, 0.00378388586f},
-std::array<float,2>{0.15771018f, 0.534963429f},
-std::array<float,2>{0.722561955f, 0.44665283f},
-std::array<float,2>{0.504221559f, 0.637458563f},
-std::array<float,2>{0.0340422951f, 0.307433069f},
-std::array<float,2>{0.340823501f, 0.923268616f},
-std::array<float,2>{0.797688067f, 0.153891042f},
-std::array<float,2>{0.930511415f, 0.589559317f},
-std::array<float,2>{0.475267798f, 0.419229656f},
-std::array<float,2>{0.130765378f, 0.862650692f},
-std::array<float,2>{0.702100873f, 0.116994165f},
-std::array<float,2>{0.559080482f, 0.984182119f},
-std::array<float,2>{0.0123620797f, 0.220997036f},
-std::array<float,2>{0.353795767f, 0.729902089f},
-std::array<float,2>{0.760653079f, 0.353512436f},
-std::array<float,2>{0.865300655f, 0.769802272f},
-std::array<float,2>{0.289877295f, 0.0227699559f},
-std::array<float,2>{0.0932617411f, 0.550273478f},
-std::array<float,2>{0.58496511f, 0.45377335f},
-std::array<float,2>{0.634289682f, 0.644047976f},
-std::array<float,2>{0.208253935f, 0.285351932f},
-std::array<float,2>{0.437416822f, 0.91936487f},
-std::array<float,2>{0.947664142f, 0.131853029f},
-std::array<float,2>{0.802736402f, 0.690238714f},
-std::array<float,2>{0.337664127f, 0.330198675f},
-std::array<float,2>{0.0387975983f, 0.953052342f},
-std::array<float,2>{0.500621319f, 0.199303895f},
-std::array<float,2>{0.726033866f, 0.813705802f},
-std::array<float,2>{0.163375467f, 0.0676207244f},
-std::array<float,2>{0.45549193f, 0.60756129f},
-std::array<float,2>{0.899105966f, 0.392989725f},
-std::array<float,2>{0.976016104f, 0.882478237f},
-std::array<float,2>{0.403558969f, 0.167490274f},
-std::array<float,2>{0.222818047f, 0.663766861f},
-std::array<float,2>{0.665146649f, 0.266518325f},
-std::array<float,2>{0.616492808f, 0.519847333f},
-std::array<float,2>{0.117381617f, 0.476195455f},
-std::array<float,2>{0.250684738f, 0.793366492f},
-std::array<float,2>{0.82806778f, 0.0532695763f},
-std::array<float,2>{0.96722436f, 0.67671895f},
-std::array<float,2>{0.418503761f, 0.258139968f},
-std::array<float,2>{0.202596128f, 0.891399741f},
-std::array<float,2>{0.644225121f, 0.182581007f},
-std::array<float,2>{0.56460011f, 0.799226999f},
-std::array<float,2>{0.0703323334f, 0.0457684882f},
-std::array<float,2>{0.311196804f, 0.505680442f},
-std::array<float,2>{0.859029293f, 0.48525539f},
-std::array<float,2>{0.773543f, 0.960030735f},
-std::array<float,2>{0.359933019f, 0.2031755f},
-std::array<float,2>{0.0192400627f, 0.709374666f},
-std::array<float,2>{0.531652391f, 0.316525191f},
-std::array<float,2>{0.714198887f, 0.622053444f},
-std::array<float,2>{0.149421901f, 0.385810643f},
-std::array<float,2>{0.487658203f, 0.835688531f},
-std::array<float,2>{0.907402933f, 0.0793471187f},
-std::array<float,2>{0.843567431f, 0.546457767f},
-std::array<float,2>{0.277785718f, 0.439192563f},
-std::array<float,2>{0.106820598f, 0.754680634f},
-std::array<float,2>{0.598488748f, 0.0154351564f},
-std::array<float,2>{0.679588854f, 0.933180988f},
-std::array<float,2>{0.239827439f, 0.143307641f},
-std::array<float,2>{0.386800438f, 0.629627585f},
-std::array<float,2>{0.993978441f, 0.301678389f},
-std::array<float,2>{0.87591809f, 0.858268738f},
-std::array<float,2>{0.445336461f, 0.102444574f},
-std::array<float,2>{0.181721732f, 0.573876083f},
-std::array<float,2>{0.742047489f, 0.431018293f},
-std::array<float,2>{0.523186862f, 0.741712332f},
-std::array<float,2>{0.0612217151f, 0.360540211f},
-std::array<float,2>{0.327753335f, 0.987763941f},
-std::array<float,2>{0.786599278f, 0.248359859f},
-std::array<float,2>{0.991032422f, 0.508322537f},
-std::array<float,2>{0.382246464f, 0.495879173f},
-std::array<float,2>{0.24672623f, 0.805226386f},
-std::array<float,2>{0.68137598f, 0.0333646685f},
-std::array<float,2>{0.609140038f, 0.904363453f},
-std::array<float,2>{0.097302869f, 0.174023107f},
-std::array<float,2>{0.266038865f, 0.680374861f},
-std::array<float,2>{0.832615316f, 0.253578335f},
-std::array<float,2>{0.789868474f, 0.839132607f},
-std::array<float,2>{0.315484464f, 0.0923539102f},
-std::array<float,2>{0.054514695f, 0.611471534f},
-std::array<float,2>{0.524776042f, 0.382517219f},
-std::array<float,2>{0.743002236f, 0.714228034f},
-std::array<float,2>{0.174272224f, 0.326064825f},
-std::array<float,2>{0.438407063f, 0.965357006f},
-std::array<float,2>{0.884195983f, 0.21501264f},
-std::array<float,2>{0.847084224f, 0.63317734f},
-std::array<float,2>{0.301629096f, 0.310005456f},
-std::array<float,2>{0.062593326f, 0.926071644f},
-std::array<float,2>{0.575735033f, 0.149361968f},
-std::array<float,2>{0.64883244f, 0.759608507f},
-std::array<float,2>{0.189166203f, 0.00456456607f},
-std::array<float,2>{0.411917686f, 0.53810966f},
-std::array<float,2>{0.955755353f, 0.452226758f},
-std::array<float,2>{0.91833359f, 0.998782694f},
-std::array<float,2>{0.495841771f, 0.238198966f},
-std::array<float,2>{0.14734368f, 0.744865835f},
-std::array<float,2>{0.710198998f, 0.371289372f},
-std::array<float,2>{0.539604187f, 0.567859173f},
-std::array<float,2>{0.0235920697f, 0.422139227f},
-std::array<float,2>{0.370426238f, 0.848721027f},
-std::array<float,2>{0.76671344f, 0.0943353623f},
-std::array<float,2>{0.891121209f, 0.721825719f},
-std::array<float,2>{0.467360824f, 0.345005393f},
-std::array<float,2>{0.167454392f, 0.971206903f},
-std::array<float,2>{0.728426874f, 0.227635011f},
-std::array<float,2>{0.511685848f, 0.870809436f},
-std::array<float,2>{0.0444343649f, 0.122739553f},
-std::array<float,2>{0.32817772f, 0.583226681f},
-std::array<float,2>{0.808145463f, 0.406751752f},
-std::array<float,2>{0.819121957f, 0.913442969f},
-std::array<float,2>{0.263097912f, 0.136726648f},
-std::array<float,2>{0.112273254f, 0.650063097f},
-std::array<float,2>{0.622368991f, 0.295514882f},
-std::array<float,2>{0.657418132f, 0.554691076f},
-std::array<float,2>{0.232582644f, 0.467243105f},
-std::array<float,2>{0.396873891f, 0.777323604f},
-std::array<float,2>{0.979460657f, 0.0288908482f},
-std::array<float,2>{0.755973935f, 0.595756292f},
-std::array<float,2>{0.34987253f, 0.404363871f},
-std::array<float,2>{0.00312712975f, 0.826488197f},
-std::array<float,2>{0.554497063f, 0.0753923282f},
-std::array<float,2>{0.693286836f, 0.940462232f},
-std::array<float,2>{0.13656345f, 0.191551849f},
-std::array<float,2>{0.480830103f, 0.698739231f},
-std::array<float,2>{0.925095737f, 0.338328451f},
-std::array<float,2>{0.941877604f, 0.781474113f},
-std::array<float,2>{0.422709346f, 0.0553527512f},
-std::array<float,2>{0.214896739f, 0.523881495f},
-std::array<float,2>{0.63245213f, 0.47687611f},
-std::array<float,2>{0.587713599f, 0.669412017f},
-std::array<float,2>{0.0830828249f, 0.274465263f},
-std::array<float,2>{0.286067694f, 0.883416831f},
-std::array<float,2>{0.87361753f, 0.161409542f},
-std::array<float,2>{0.950848341f, 0.61700362f},
-std::array<float,2>{0.432977706f, 0.375467807f},
-std::array<float,2>{0.205061972f, 0.842517853f},
-std::array<float,2>{0.637009501f, 0.0869728327f},
-std::array<float,2>{0.580263495f, 0.961172342f},
-std::array<float,2>{0.0896114185f, 0.211183652f},
-std::array<float,2>{0.2952151f, 0.71676147f},
-std::array<float,2>{0.86295563f, 0.323096067f},
-std::array<float,2>{0.763888001f, 0.809790432f},
-std::array<float,2>{0.357213795f, 0.0356920995f},
-std::array<float,2>{0.00845064037f, 0.512128651f},
-std::array<float,2>{0.556760371f, 0.496792436f},
-std::array<float,2>{0.69797498f, 0.686244369f},
-std::array<float,2>{0.126547754f, 0.256498367f},
-std::array<float,2>{0.470693737f, 0.899294615f},
-std::array<float,2>{0.936462522f, 0.178955004f},
-std::array<float,2>{0.821389675f, 0.746609628f},
-std::array<float,2>{0.2541852f, 0.368062705f},
-std::array<float,2>{0.121470079f, 0.993817031f},
-std::array<float,2>{0.611397266f, 0.239306971f},
-std::array<float,2>{0.669024944f, 0.844969571f},
-std::array<float,2>{0.219338611f, 0.100817099f},
-std::array<float,2>{0.401494503f, 0.564564109f},
-std::array<float,2>{0.97150892f, 0.428948641f},
-std::array<float,2>{0.905430257f, 0.923465669f},
-std::array<float,2>{0.457487077f, 0.15362522f},
-std::array<float,2>{0.159569979f, 0.636801779f},
-std::array<float,2>{0.719328821f, 0.307115585f},
-std::array<float,2>{0.507741868f, 0.534642577f},
-std::array<float,2>{0.0317670256f, 0.446856886f},
-std::array<float,2>{0.343281835f, 0.763429821f},
-std::array<float,2>{0.800003767f, 0.00335921533f},
-std::array<float,2>{0.911250174f, 0.654607654f},
-std::array<float,2>{0.48890081f, 0.289577723f},
-std::array<float,2>{0.154762805f, 0.909936488f},
-std::array<float,2>{0.715873778f, 0.135778651f},
-std::array<float,2>{0.535887182f, 0.780522943f},
-std::array<float,2>{0.0218944754f, 0.0265511051f},
-std::array<float,2>{0.366597503f, 0.562082171f},
-std::array<float,2>{0.779913545f, 0.464795083f},
-std::array<float,2>{0.85326463f, 0.973915279f},
-std::array<float,2>{0.305033445f, 0.234185562f},
-std::array<float,2>{0.0760045424f, 0.723902285f},
-std::array<float,2>{0.568334579f, 0.348684251f},
-std::array<float,2>{0.647364855f, 0.578478694f},
-std::array<float,2>{0.198692083f, 0.410386086f},
-std::array<float,2>{0.415702581f, 0.872237802f},
-std::array<float,2>{0.962616324f, 0.119898953f},
-std::array<float,2>{0.782358229f, 0.530291677f},
-std::array<float,2>{0.321394712f, 0.482624859f},
-std::array<float,2>{0.0563719161f, 0.78700453f},
-std::array<float,2>{0.517809927f, 0.0614978261f},
-std::array<float,2>{0.73517859f, 0.889310002f},
-std::array<float,2>{0.187265113f, 0.158524439f},
-std::array<float,2>{0.449259341f, 0.667431116f},
-std::array<float,2>{0.881295919f, 0.277852595f},
-std::array<float,2>{0.998532772f, 0.82281673f},
-std::array<float,2>{0.384952992f, 0.0709791631f},
-std::array<float,2>{0.236579031f, 0.597988009f},
-std::array<float,2>{0.673526168f, 0.399901658f},
-std::array<float,2>{0.597627163f, 0.699534595f},
-std::array<float,2>{0.101923563f, 0.34251672f},
-std::array<float,2>{0.276009619f, 0.944057703f},
-std::array<float,2>{0.837171853f, 0.18820107f},
-std::array<float,2>{0.887797713f, 0.552199364f},
-std::array<float,2>{0.441975355f, 0.459568173f},
-std::array<float,2>{0.177437887f, 0.767060161f},
-std::array<float,2>{0.7499457f, 0.017544603f},
-std::array<float,2>{0.528359652f, 0.915904343f},
-std::array<float,2>{0.0484014153f, 0.128113434f},
-std::array<float,2>{0.318090618f, 0.645809412f},
-std::array<float,2>{0.793462515f, 0.283294022f},
-std::array<float,2>{0.830123961f, 0.863684237f},
-std::array<float,2>{0.269613355f, 0.110135436f},
-std::array<float,2>{0.0992582813f, 0.593210459f},
-std::array<float,2>{0.602747142f, 0.41426146f},
-std::array<float,2>{0.685093284f, 0.733189106f},
-std::array<float,2>{0.24589549f, 0.355885208f},
-std::array<float,2>{0.377612919f, 0.977729023f},
-std::array<float,2>{0.98598063f, 0.226450562f},
-std::array<float,2>{0.770982563f, 0.657058477f},
-std::array<float,2>{0.374647558f, 0.272663713f},
-std::array<float,2>{0.0296981819f, 0.875089824f},
-std::array<float,2>{0.545231938f, 0.170737728f},
-std::array<float,2>{0.705740571f, 0.790618777f},
-std::array<float,2>{0.144369051f, 0.0491739027f},
-std::array<float,2>{0.498295248f, 0.517896473f},
-std::array<float,2>{0.914831042f, 0.470085502f},
-std::array<float,2>{0.959291816f, 0.947659373f},
-std::array<float,2>{0.407228649f, 0.198296398f},
-std::array<float,2>{0.192618683f, 0.694594145f},
-std::array<float,2>{0.654727221f, 0.335000455f},
-std::array<float,2>{0.57234931f, 0.602951646f},
-std::array<float,2>{0.0669923574f, 0.396084994f},
-std::array<float,2>{0.299284846f, 0.817837715f},
-std::array<float,2>{0.849325716f, 0.0646998435f},
-std::array<float,2>{0.983139098f, 0.706799746f},
-std::array<float,2>{0.390952706f, 0.314727575f},
-std::array<float,2>{0.227112427f, 0.954951406f},
-std::array<float,2>{0.663412333f, 0.208560303f},
-std::array<float,2>{0.619359255f, 0.828745127f},
-std::array<float,2>{0.114741109f, 0.0858841315f},
-std::array<float,2>{0.259765446f, 0.620402575f},
-std::array<float,2>{0.814200938f, 0.388788342f},
-std::array<float,2>{0.811035991f, 0.897485554f},
-std::array<float,2>{0.332066178f, 0.186578423f},
-std::array<float,2>{0.0414790139f, 0.672476411f},
-std::array<float,2>{0.511941493f, 0.26283592f},
-std::array<float,2>{0.731808186f, 0.500308514f},
-std::array<float,2>{0.17177777f, 0.491613328f},
-std::array<float,2>{0.463668972f, 0.802017987f},
-std::array<float,2>{0.897151172f, 0.0414132401f},
-std::array<float,2>{0.870106161f, 0.575722873f},
-std::array<float,2>{0.283033222f, 0.436807752f},
-std::array<float,2>{0.0820111036f, 0.854242265f},
-std::array<float,2>{0.592246771f, 0.108023398f},
-std::array<float,2>{0.628509521f, 0.989863813f},
-std::array<float,2>{0.211705685f, 0.244511262f},
-std::array<float,2>{0.428937912f, 0.737677157f},
-std::array<float,2>{0.938360989f, 0.364968389f},
-std::array<float,2>{0.928722978f, 0.75139159f},
-std::array<float,2>{0.478757888f, 0.0093905339f},
-std::array<float,2>{0.13987571f, 0.541089058f},
-std::array<float,2>{0.690589011f, 0.445210546f},
-std::array<float,2>{0.548405886f, 0.628269196f},
-std::array<float,2>{0.006646981f, 0.297916889f},
-std::array<float,2>{0.344210178f, 0.933648586f},
-std::array<float,2>{0.752805531f, 0.144891515f},
-std::array<float,2>{0.901232064f, 0.606890023f},
-std::array<float,2>{0.45420596f, 0.391375989f},
-std::array<float,2>{0.161620796f, 0.814685881f},
-std::array<float,2>{0.724516451f, 0.070045799f},
-std::array<float,2>{0.50368911f, 0.950269818f},
-std::array<float,2>{0.0369141027f, 0.201556236f},
-std::array<float,2>{0.339422643f, 0.688467801f},
-std::array<float,2>{0.802111089f, 0.328211039f},
-std::array<float,2>{0.825260758f, 0.795263469f},
-std::array<float,2>{0.252407432f, 0.0523662865f},
-std::array<float,2>{0.120118961f, 0.521938622f},
-std::array<float,2>{0.614751399f, 0.473422706f},
-std::array<float,2>{0.666871488f, 0.660963178f},
-std::array<float,2>{0.224808291f, 0.269272327f},
-std::array<float,2>{0.40524593f, 0.879029274f},
-std::array<float,2>{0.973372519f, 0.1641379f},
-std::array<float,2>{0.75930208f, 0.728043258f},
-std::array<float,2>{0.353114128f, 0.354822487f},
-std::array<float,2>{0.0154467598f, 0.981084168f},
-std::array<float,2>{0.562498391f, 0.218755111f},
-std::array<float,2>{0.699310005f, 0.860264838f},
-std::array<float,2>{0.132538632f, 0.113623202f},
-std::array<float,2>{0.474550188f, 0.587644637f},
-std::array<float,2>{0.933417499f, 0.421144605f},
-std::array<float,2>{0.946606696f, 0.920421124f},
-std::array<float,2>{0.433947444f, 0.130707204f},
-std::array<float,2>{0.209676802f, 0.640948772f},
-std::array<float,2>{0.63547641f, 0.287247628f},
-std::array<float,2>{0.582093954f, 0.548628867f},
-std::array<float,2>{0.0910867825f, 0.456928581f},
-std::array<float,2>{0.292913139f, 0.773301363f},
-std::array<float,2>{0.865132511f, 0.0202267449f},
-std::array<float,2>{0.996074915f, 0.631087959f},
-std::array<float,2>{0.389116675f, 0.303453982f},
-std::array<float,2>{0.241570875f, 0.931040823f},
-std::array<float,2>{0.677250624f, 0.140847191f},
-std::array<float,2>{0.599622488f, 0.757330418f},
-std::array<float,2>{0.107866466f, 0.0121313361f},
-std::array<float,2>{0.280801177f, 0.543655753f},
-std::array<float,2>{0.841282845f, 0.440722287f},
-std::array<float,2>{0.787584186f, 0.985154152f},
-std::array<float,2>{0.324388236f, 0.247695163f},
-std::array<float,2>{0.0597943142f, 0.738774836f},
-std::array<float,2>{0.519974172f, 0.361421645f},
-std::array<float,2>{0.740024924f, 0.571734309f},
-std::array<float,2>{0.18104279f, 0.43183744f},
-std::array<float,2>{0.44880721f, 0.856956363f},
-std::array<float,2>{0.877144694f, 0.103616312f},
-std::array<float,2>{0.855549455f, 0.507288575f},
-std::array<float,2>{0.310053736f, 0.486880213f},
-std::array<float,2>{0.072541289f, 0.798639476f},
-std::array<float,2>{0.563002944f, 0.0448356569f},
-std::array<float,2>{0.642143965f, 0.8928352f},
-std::array<float,2>{0.200664371f, 0.180715442f},
-std::array<float,2>{0.421224266f, 0.677736878f},
-std::array<float,2>{0.964901149f, 0.260249257f},
-std::array<float,2>{0.908639312f, 0.833381414f},
-std::array<float,2>{0.485166252f, 0.0804735944f},
-std::array<float,2>{0.152290091f, 0.623178482f},
-std::array<float,2>{0.712371826f, 0.384197891f},
-std::array<float,2>{0.534859836f, 0.707043946f},
-std::array<float,2>{0.0162609518f, 0.318933934f},
-std::array<float,2>{0.361799985f, 0.957075417f},
-std::array<float,2>{0.77642566f, 0.206108689f},
-std::array<float,2>{0.953399837f, 0.536367118f},
-std::array<float,2>{0.412572533f, 0.450709313f},
-std::array<float,2>{0.191003487f, 0.759974301f},
-std::array<float,2>{0.651597559f, 0.00622288696f},
-std::array<float,2>{0.576552689f, 0.928031623f},
-std::array<float,2>{0.0654457137f, 0.151676089f},
-std::array<float,2>{0.304273874f, 0.635928154f},
-std::array<float,2>{0.844498277f, 0.311888486f},
-std::array<float,2>{0.768697679f, 0.85080725f},
-std::array<float,2>{0.367558122f, 0.0958753005f},
-std::array<float,2>{0.0270325504f, 0.569119275f},
-std::array<float,2>{0.541280687f, 0.424785912f},
-std::array<float,2>{0.708599091f, 0.742315531f},
-std::array<float,2>{0.145070806f, 0.373509586f},
-std::array<float,2>{0.493873626f, 0.996662736f},
-std::array<float,2>{0.920418501f, 0.235158548f},
-std::array<float,2>{0.834224284f, 0.68276149f},
-std::array<float,2>{0.269423842f, 0.250048548f},
-std::array<float,2>{0.0954793394f, 0.902934968f},
-std::array<float,2>{0.605762184f, 0.172889724f},
-std::array<float,2>{0.683210254f, 0.807309031f},
-std::array<float,2>{0.249728739f, 0.0323705636f},
-std::array<float,2>{0.379217088f, 0.511419237f},
-std::array<float,2>{0.98955673f, 0.492620438f},
-std::array<float,2>{0.886318028f, 0.967572808f},
-std::array<float,2>{0.439633995f, 0.217544839f},
-std::array<float,2>{0.1723921f, 0.711596131f},
-std::array<float,2>{0.744860411f, 0.327946782f},
-std::array<float,2>{0.526542962f, 0.60940218f},
-std::array<float,2>{0.0516182743f, 0.38066712f},
-std::array<float,2>{0.314392596f, 0.836336255f},
-std::array<float,2>{0.791227341f, 0.090825431f},
-std::array<float,2>{0.922687411f, 0.697069824f},
-std::array<float,2>{0.483656108f, 0.336109608f},
-std::array<float,2>{0.133285075f, 0.937794805f},
-std::array<float,2>{0.694272816f, 0.195219681f},
-std::array<float,2>{0.551931858f, 0.824449658f},
-std::array<float,2>{0.00191892521f, 0.0762058124f},
-std::array<float,2>{0.348060489f, 0.594838083f},
-std::array<float,2>{0.755032837f, 0.402829498f},
-std::array<float,2>{0.871869147f, 0.885344148f},
-std::array<float,2>{0.287564993f, 0.163359791f},
-std::array<float,2>{0.0854152367f, 0.670907497f},
-std::array<float,2>{0.589743257f, 0.275719225f},
-std::array<float,2>{0.630725503f, 0.527179003f},
-std::array<float,2>{0.217173189f, 0.480097145f},
-std::array<float,2>{0.424699128f, 0.783238053f},
-std::array<float,2>{0.944753051f, 0.0569431372f},
-std::array<float,2>{0.805300713f, 0.584990978f},
-std::array<float,2>{0.331023663f, 0.410000592f},
-std::array<float,2>{0.045145385f, 0.867879212f},
-std::array<float,2>{0.508412182f, 0.124634802f},
-std::array<float,2>{0.729823411f, 0.970366895f},
-std::array<float,2>{0.165350437f, 0.230340004f},
-std::array<float,2>{0.466537178f, 0.719104528f},
-std::array<float,2>{0.892892122f, 0.347533137f},
-std::array<float,2>{0.97812438f, 0.775040686f},
-std::array<float,2>{0.395832956f, 0.0310054291f},
-std::array<float,2>{0.232222766f, 0.558467448f},
-std::array<float,2>{0.658852518f, 0.465356857f},
-std::array<float,2>{0.624290228f, 0.650883436f},
-std::array<float,2>{0.110501572f, 0.294499964f},
-std::array<float,2>{0.26396066f, 0.910580933f},
-std::array<float,2>{0.817625105f, 0.139510766f},
-std::array<float,2>{0.968955278f, 0.563871503f},
-std::array<float,2>{0.3985596f, 0.426068276f},
-std::array<float,2>{0.221171543f, 0.846788704f},
-std::array<float,2>{0.670818329f, 0.0980568752f},
-std::array<float,2>{0.610793173f, 0.99569577f},
-std::array<float,2>{0.123298757f, 0.241378084f},
-std::array<float,2>{0.256416678f, 0.749508321f},
-std::array<float,2>{0.822536886f, 0.369460791f},
-std::array<float,2>{0.797012389f, 0.764330149f},
-std::array<float,2>{0.341412306f, 0.00136374659f},
-std::array<float,2>{0.0336627215f, 0.531824529f},
-std::array<float,2>{0.504876912f, 0.447491676f},
-std::array<float,2>{0.722096562f, 0.639083445f},
-std::array<float,2>{0.157878652f, 0.305613905f},
-std::array<float,2>{0.459152609f, 0.924318969f},
-std::array<float,2>{0.903206229f, 0.154682487f},
-std::array<float,2>{0.860708416f, 0.717342317f},
-std::array<float,2>{0.293640286f, 0.321183652f},
-std::array<float,2>{0.087080054f, 0.964015722f},
-std::array<float,2>{0.578608513f, 0.213077903f},
-std::array<float,2>{0.640370131f, 0.841786087f},
-std::array<float,2>{0.206733108f, 0.0883723497f},
-std::array<float,2>{0.431146383f, 0.613421261f},
-std::array<float,2>{0.951898217f, 0.377765894f},
-std::array<float,2>{0.935048699f, 0.901707768f},
-std::array<float,2>{0.471507847f, 0.176688939f},
-std::array<float,2>{0.127896652f, 0.684668601f},
-std::array<float,2>{0.695695341f, 0.254691035f},
-std::array<float,2>{0.556430757f, 0.513966262f},
-std::array<float,2>{0.0102723837f, 0.499950647f},
-std::array<float,2>{0.357664645f, 0.811758637f},
-std::array<float,2>{0.762552202f, 0.0389046259f},
-std::array<float,2>{0.880496919f, 0.665599048f},
-std::array<float,2>{0.451422811f, 0.280732065f},
-std::array<float,2>{0.184189633f, 0.886902869f},
-std::array<float,2>{0.737160325f, 0.158014968f},
-std::array<float,2>{0.516158164f, 0.787931144f},
-std::array<float,2>{0.0581282191f, 0.0602596961f},
-std::array<float,2>{0.323131949f, 0.528249562f},
-std::array<float,2>{0.783815145f, 0.480597317f},
-std::array<float,2>{0.838944674f, 0.942375958f},
-std::array<float,2>{0.27526769f, 0.191306502f},
-std::array<float,2>{0.103801899f, 0.70170635f},
-std::array<float,2>{0.594219923f, 0.340895027f},
-std::array<float,2>{0.674548328f, 0.600898027f},
-std::array<float,2>{0.235111475f, 0.401755482f},
-std::array<float,2>{0.384230494f, 0.821486831f},
-std::array<float,2>{0.996622324f, 0.0725077763f},
-std::array<float,2>{0.778464675f, 0.558852792f},
-std::array<float,2>{0.364564508f, 0.461418509f},
-std::array<float,2>{0.0196358245f, 0.777999461f},
-std::array<float,2>{0.538700819f, 0.0241276212f},
-std::array<float,2>{0.717501342f, 0.906474411f},
-std::array<float,2>{0.153639227f, 0.133186758f},
-std::array<float,2>{0.490830481f, 0.653966963f},
-std::array<float,2>{0.913061082f, 0.292660356f},
-std::array<float,2>{0.963935256f, 0.874318004f},
-std::array<float,2>{0.416864663f, 0.118680768f},
-std::array<float,2>{0.197172672f, 0.581090868f},
-std::array<float,2>{0.646214068f, 0.413780659f},
-std::array<float,2>{0.568603933f, 0.725852013f},
-std::array<float,2>{0.0771492496f, 0.351152807f},
-std::array<float,2>{0.308172047f, 0.976020038f},
-std::array<float,2>{0.85507673f, 0.231350377f},
-std::array<float,2>{0.916042447f, 0.516501784f},
-std::array<float,2>{0.496561855f, 0.471260607f},
-std::array<float,2>{0.141335785f, 0.791126251f},
-std::array<float,2>{0.70355916f, 0.0472090207f},
-std::array<float,2>{0.544623256f, 0.878850102f},
-std::array<float,2>{0.0275339428f, 0.168693498f},
-std::array<float,2>{0.37110433f, 0.658932328f},
-std::array<float,2>{0.773113072f, 0.27061829f},
-std::array<float,2>{0.850261271f, 0.819017231f},
-std::array<float,2>{0.298615664f, 0.0627464503f},
-std::array<float,2>{0.0690251663f, 0.604954541f},
-std::array<float,2>{0.571494758f, 0.397088468f},
-std::array<float,2>{0.653420091f, 0.692656398f},
-std::array<float,2>{0.194702536f, 0.332835317f},
-std::array<float,2>{0.409905434f, 0.946686804f},
-std::array<float,2>{0.957957149f, 0.195753083f},
-std::array<float,2>{0.795119882f, 0.64809376f},
-std::array<float,2>{0.319984645f, 0.281916231f},
-std::array<float,2>{0.0492529944f, 0.916862309f},
-std::array<float,2>{0.529437959f, 0.125469565f},
-std::array<float,2>{0.747128546f, 0.767849028f},
-std::array<float,2>{0.177874804f, 0.0181258805f},
-std::array<float,2>{0.444305301f, 0.553905308f},
-std::array<float,2>{0.888695776f, 0.458668351f},
-std::array<float,2>{0.987936676f, 0.979750931f},
-std::array<float,2>{0.375476897f, 0.224045843f},
-std::array<float,2>{0.242995039f, 0.732110202f},
-std::array<float,2>{0.686779857f, 0.359262496f},
-std::array<float,2>{0.604536593f, 0.591007054f},
-std::array<float,2>{0.100406326f, 0.417944521f},
-std::array<float,2>{0.272028744f, 0.865993381f},
-std::array<float,2>{0.828849614f, 0.111736774f},
-std::array<float,2>{0.940410078f, 0.736094832f},
-std::array<float,2>{0.427693218f, 0.366770357f},
-std::array<float,2>{0.213131011f, 0.990329504f},
-std::array<float,2>{0.625470996f, 0.244014993f},
-std::array<float,2>{0.591587842f, 0.85156709f},
-std::array<float,2>{0.0793749988f, 0.105881125f},
-std::array<float,2>{0.283505201f, 0.577786803f},
-std::array<float,2>{0.868927956f, 0.435424745f},
-std::array<float,2>{0.750930846f, 0.936429977f},
-std::array<float,2>{0.345959246f, 0.148239687f},
-std::array<float,2>{0.00403523911f, 0.62515986f},
-std::array<float,2>{0.549262524f, 0.300001949f},
-std::array<float,2>{0.688600779f, 0.539234519f},
-std::array<float,2>{0.137860432f, 0.442973584f},
-std::array<float,2>{0.477315903f, 0.753694057f},
-std::array<float,2>{0.926550567f, 0.0106102489f},
-std::array<float,2>{0.814603567f, 0.618718505f},
-std::array<float,2>{0.261338323f, 0.388105482f},
-std::array<float,2>{0.115804516f, 0.831182539f},
-std::array<float,2>{0.618235588f, 0.0831342191f},
-std::array<float,2>{0.660230935f, 0.955735505f},
-std::array<float,2>{0.228565529f, 0.210269883f},
-std::array<float,2>{0.394054592f, 0.703319311f},
-std::array<float,2>{0.981298149f, 0.313585371f},
-std::array<float,2>{0.895565033f, 0.803872645f},
-std::array<float,2>{0.461350054f, 0.0398412384f},
-std::array<float,2>{0.168211699f, 0.503583729f},
-std::array<float,2>{0.734240949f, 0.488921046f},
-std::array<float,2>{0.51502198f, 0.67462796f},
-std::array<float,2>{0.0392327681f, 0.264968753f},
-std::array<float,2>{0.334931016f, 0.89508456f},
-std::array<float,2>{0.810489237f, 0.185460702f},
-std::array<float,2>{0.906677604f, 0.624981344f},
-std::array<float,2>{0.48703301f, 0.382937074f},
-std::array<float,2>{0.149336576f, 0.832665861f},
-std::array<float,2>{0.713344038f, 0.0815625563f},
-std::array<float,2>{0.533007026f, 0.9581514f},
-std::array<float,2>{0.0180039238f, 0.20557633f},
-std::array<float,2>{0.360855699f, 0.708613217f},
-std::array<float,2>{0.775278151f, 0.319742233f},
-std::array<float,2>{0.858326793f, 0.797033072f},
-std::array<float,2>{0.312263936f, 0.043643374f},
-std::array<float,2>{0.0713932961f, 0.506248176f},
-std::array<float,2>{0.56628859f, 0.488268405f},
-std::array<float,2>{0.642799318f, 0.678723872f},
-std::array<float,2>{0.20213519f, 0.261651188f},
-std::array<float,2>{0.419798046f, 0.893760979f},
-std::array<float,2>{0.967855155f, 0.18004702f},
-std::array<float,2>{0.7854141f, 0.739567637f},
-std::array<float,2>{0.326802045f, 0.362816602f},
-std::array<float,2>{0.0623048507f, 0.98610127f},
-std::array<float,2>{0.522412181f, 0.246096507f},
-std::array<float,2>{0.740395069f, 0.855662167f},
-std::array<float,2>{0.182967961f, 0.105263837f},
-std::array<float,2>{0.447034031f, 0.570604444f},
-std::array<float,2>{0.876635015f, 0.432876676f},
-std::array<float,2>{0.993152082f, 0.930208981f},
-std::array<float,2>{0.387934923f, 0.141836479f},
-std::array<float,2>{0.238404632f, 0.632018805f},
-std::array<float,2>{0.678589404f, 0.303747982f},
-std::array<float,2>{0.599428475f, 0.544733226f},
-std::array<float,2>{0.105750687f, 0.440283865f},
-std::array<float,2>{0.27919957f, 0.756388426f},
-std::array<float,2>{0.842601478f, 0.0135673648f},
-std::array<float,2>{0.948994935f, 0.642407179f},
-std::array<float,2>{0.436344534f, 0.288444668f},
-std::array<float,2>{0.207085639f, 0.920919716f},
-std::array<float,2>{0.633545339f, 0.129738048f},
-std::array<float,2>{0.584211349f, 0.772104561f},
-std::array<float,2>{0.0922098607f, 0.0206314735f},
-std::array<float,2>{0.290885597f, 0.547579348f},
-std::array<float,2>{0.866987288f, 0.455922574f},
-std::array<float,2>{0.761593342f, 0.981812358f},
-std::array<float,2>{0.355430126f, 0.220054612f},
-std::array<float,2>{0.0132199731f, 0.727034569f},
-std::array<float,2>{0.560335994f, 0.353898883f},
-std::array<float,2>{0.702808857f, 0.586086035f},
-std::array<float,2>{0.129053861f, 0.42062071f},
-std::array<float,2>{0.475784481f, 0.86082077f},
-std::array<float,2>{0.931211174f, 0.114307798f},
-std::array<float,2>{0.826564074f, 0.523322642f},
-std::array<float,2>{0.251550555f, 0.473719627f},
-std::array<float,2>{0.118278384f, 0.79671663f},
-std::array<float,2>{0.615652978f, 0.0513115562f},
-std::array<float,2>{0.664144754f, 0.880066574f},
-std::array<float,2>{0.224185795f, 0.165871486f},
-std::array<float,2>{0.402346402f, 0.662050009f},
-std::array<float,2>{0.975046873f, 0.267764539f},
-std::array<float,2>{0.89945066f, 0.815457046f},
-std::array<float,2>{0.456461072f, 0.0684529468f},
-std::array<float,2>{0.162358969f, 0.605677664f},
-std::array<float,2>{0.725308836f, 0.391768694f},
-std::array<float,2>{0.501754761f, 0.68912214f},
-std::array<float,2>{0.0374203734f, 0.329345703f},
-std::array<float,2>{0.336211413f, 0.950158477f},
-std::array<float,2>{0.804096341f, 0.20241636f},
-std::array<float,2>{0.979809701f, 0.557319164f},
-std::array<float,2>{0.397808105f, 0.466739178f},
-std::array<float,2>{0.233839542f, 0.77418977f},
-std::array<float,2>{0.656888306f, 0.0295229387f},
-std::array<float,2>{0.621114671f, 0.911612153f},
-std::array<float,2>{0.113046184f, 0.140456274f},
-std::array<float,2>{0.262333035f, 0.651827514f},
-std::array<float,2>{0.81976223f, 0.293405801f},
-std::array<float,2>{0.80745101f, 0.868551493f},
-std::array<float,2>{0.32937181f, 0.123057187f},
-std::array<float,2>{0.0437345803f, 0.584402502f},
-std::array<float,2>{0.510720551f, 0.408520818f},
-std::array<float,2>{0.727136374f, 0.720496535f},
-std::array<float,2>{0.166124001f, 0.346047729f},
-std::array<float,2>{0.468599379f, 0.96906656f},
-std::array<float,2>{0.891933799f, 0.228770614f},
-std::array<float,2>{0.874032319f, 0.670244694f},
-std::array<float,2>{0.286256373f, 0.276793003f},
-std::array<float,2>{0.0825664029f, 0.886195123f},
-std::array<float,2>{0.586487472f, 0.162266836f},
-std::array<float,2>{0.631818354f, 0.784608901f},
-std::array<float,2>{0.216559112f, 0.05778189f},
-std::array<float,2>{0.423373729f, 0.526349187f},
-std::array<float,2>{0.942832589f, 0.478835225f},
-std::array<float,2>{0.923904896f, 0.939384162f},
-std::array<float,2>{0.481723994f, 0.194206297f},
-std::array<float,2>{0.135734886f, 0.695984602f},
-std::array<float,2>{0.691438496f, 0.337770611f},
-std::array<float,2>{0.553099692f, 0.59455049f},
-std::array<float,2>{0.00200417917f, 0.403817236f},
-std::array<float,2>{0.351444602f, 0.826104581f},
-std::array<float,2>{0.75687933f, 0.077905342f},
-std::array<float,2>{0.8835482f, 0.712169051f},
-std::array<float,2>{0.438483715f, 0.32700485f},
-std::array<float,2>{0.175053f, 0.968221486f},
-std::array<float,2>{0.743683636f, 0.21785596f},
-std::array<float,2>{0.523491621f, 0.837836981f},
-std::array<float,2>{0.0535788275f, 0.0903988481f},
-std::array<float,2>{0.314941764f, 0.610861778f},
-std::array<float,2>{0.790768921f, 0.379545659f},
-std::array<float,2>{0.833399713f, 0.903434992f},
-std::array<float,2>{0.267543852f, 0.172550023f},
-std::array<float,2>{0.0963935852f, 0.682265699f},
-std::array<float,2>{0.607574701f, 0.251669079f},
-std::array<float,2>{0.680197239f, 0.510304928f},
-std::array<float,2>{0.247607231f, 0.493391365f},
-std::array<float,2>{0.381325901f, 0.808039606f},
-std::array<float,2>{0.991635919f, 0.0319542661f},
-std::array<float,2>{0.765711188f, 0.569678903f},
-std::array<float,2>{0.369768173f, 0.425686747f},
-std::array<float,2>{0.0246827882f, 0.850113451f},
-std::array<float,2>{0.541012764f, 0.0967152864f},
-std::array<float,2>{0.709810078f, 0.997480214f},
-std::array<float,2>{0.148374602f, 0.235935271f},
-std::array<float,2>{0.494575769f, 0.744002283f},
-std::array<float,2>{0.919044614f, 0.374073476f},
-std::array<float,2>{0.956308186f, 0.761317909f},
-std::array<float,2>{0.41078645f, 0.00744898384f},
-std::array<float,2>{0.18786779f, 0.535705864f},
-std::array<float,2>{0.649879158f, 0.449878544f},
-std::array<float,2>{0.574399829f, 0.63558048f},
-std::array<float,2>{0.0641417727f, 0.310765147f},
-std::array<float,2>{0.30262363f, 0.929209054f},
-std::array<float,2>{0.845998168f, 0.150638476f},
-std::array<float,2>{0.961290002f, 0.580846429f},
-std::array<float,2>{0.414497286f, 0.412835598f},
-std::array<float,2>{0.197610691f, 0.8740049f},
-std::array<float,2>{0.647660911f, 0.117779836f},
-std::array<float,2>{0.567126989f, 0.974736333f},
-std::array<float,2>{0.0748928562f, 0.231921583f},
-std::array<float,2>{0.306420326f, 0.725554824f},
-std::array<float,2>{0.851901293f, 0.349794269f},
-std::array<float,2>{0.781189203f, 0.778915584f},
-std::array<float,2>{0.365357131f, 0.0253582299f},
-std::array<float,2>{0.0232505053f, 0.560001671f},
-std::array<float,2>{0.536711037f, 0.462333441f},
-std::array<float,2>{0.715263724f, 0.653201938f},
-std::array<float,2>{0.15609625f, 0.291785955f},
-std::array<float,2>{0.489936084f, 0.907388091f},
-std::array<float,2>{0.911132514f, 0.13462688f},
-std::array<float,2>{0.836514533f, 0.702297807f},
-std::array<float,2>{0.277278513f, 0.339919001f},
-std::array<float,2>{0.103471309f, 0.943229377f},
-std::array<float,2>{0.596605062f, 0.190130666f},
-std::array<float,2>{0.67263633f, 0.821038663f},
-std::array<float,2>{0.238167316f, 0.0736933872f},
-std::array<float,2>{0.386225671f, 0.599650264f},
-std::array<float,2>{0.999465466f, 0.4009296f},
-std::array<float,2>{0.88231492f, 0.887849033f},
-std::array<float,2>{0.450810671f, 0.156740174f},
-std::array<float,2>{0.185607016f, 0.664438367f},
-std::array<float,2>{0.735534191f, 0.279801697f},
-std::array<float,2>{0.518892705f, 0.528664649f},
-std::array<float,2>{0.0549042933f, 0.482146025f},
-std::array<float,2>{0.321093053f, 0.789030313f},
-std::array<float,2>{0.782217205f, 0.058656048f},
-std::array<float,2>{0.936729193f, 0.684249461f},
-std::array<float,2>{0.468871295f, 0.255721122f},
-std::array<float,2>{0.125481099f, 0.901016712f},
-std::array<float,2>{0.698534906f, 0.177055582f},
-std::array<float,2>{0.557740152f, 0.811251104f},
-std::array<float,2>{0.00881420355f, 0.0378382578f},
-std::array<float,2>{0.356410384f, 0.51513958f},
-std::array<float,2>{0.765320897f, 0.49893409f},
-std::array<float,2>{0.861361802f, 0.963453829f},
-std::array<float,2>{0.296247423f, 0.21438314f},
-std::array<float,2>{0.0881787315f, 0.718185127f},
-std::array<float,2>{0.58190757f, 0.322151244f},
-std::array<float,2>{0.637731493f, 0.614425004f},
-std::array<float,2>{0.203619093f, 0.378417969f},
-std::array<float,2>{0.431993306f, 0.840227485f},
-std::array<float,2>{0.949831545f, 0.0896113515f},
-std::array<float,2>{0.799566865f, 0.53254199f},
-std::array<float,2>{0.342154205f, 0.448849797f},
-std::array<float,2>{0.033085268f, 0.76561296f},
-std::array<float,2>{0.5060215f, 0.000652751944f},
-std::array<float,2>{0.720621109f, 0.925197005f},
-std::array<float,2>{0.158460945f, 0.156226382f},
-std::array<float,2>{0.458576173f, 0.640233576f},
-std::array<float,2>{0.904601812f, 0.3057639f},
-std::array<float,2>{0.972016037f, 0.846075952f},
-std::array<float,2>{0.401077867f, 0.0992814898f},
-std::array<float,2>{0.220050201f, 0.563040793f},
-std::array<float,2>{0.668436885f, 0.426941365f},
-std::array<float,2>{0.612873912f, 0.74865365f},
-std::array<float,2>{0.122449026f, 0.370942265f},
-std::array<float,2>{0.255612999f, 0.994989634f},
-std::array<float,2>{0.820719957f, 0.241003066f},
-std::array<float,2>{0.89771986f, 0.502648473f},
-std::array<float,2>{0.463948786f, 0.489434987f},
-std::array<float,2>{0.170748085f, 0.803351939f},
-std::array<float,2>{0.73128289f, 0.0405121818f},
-std::array<float,2>{0.512784064f, 0.896360099f},
-std::array<float,2>{0.0422056131f, 0.183843613f},
-std::array<float,2>{0.333891392f, 0.674881697f},
-std::array<float,2>{0.812296987f, 0.264366537f},
-std::array<float,2>{0.812876403f, 0.830447614f},
-std::array<float,2>{0.257867277f, 0.0828803927f},
-std::array<float,2>{0.113561682f, 0.617429197f},
-std::array<float,2>{0.62061739f, 0.386909008f},
-std::array<float,2>{0.662732124f, 0.704925358f},
-std::array<float,2>{0.227790549f, 0.31316945f},
-std::array<float,2>{0.391627133f, 0.956788421f},
-std::array<float,2>{0.984105885f, 0.209189191f},
-std::array<float,2>{0.753398478f, 0.626572371f},
-std::array<float,2>{0.344735473f, 0.299390316f},
-std::array<float,2>{0.00728525408f, 0.936969042f},
-std::array<float,2>{0.547022879f, 0.146559104f},
-std::array<float,2>{0.690360248f, 0.752380669f},
-std::array<float,2>{0.138870254f, 0.0114803277f},
-std::array<float,2>{0.480047226f, 0.540100336f},
-std::array<float,2>{0.928315043f, 0.442259192f},
-std::array<float,2>{0.93913579f, 0.991269112f},
-std::array<float,2>{0.428536117f, 0.243151531f},
-std::array<float,2>{0.212197706f, 0.734615266f},
-std::array<float,2>{0.62722224f, 0.366207093f},
-std::array<float,2>{0.593623102f, 0.577114165f},
-std::array<float,2>{0.0801056176f, 0.433790237f},
-std::array<float,2>{0.28218025f, 0.853065014f},
-std::array<float,2>{0.870388687f, 0.106851369f},
-std::array<float,2>{0.984679699f, 0.730643034f},
-std::array<float,2>{0.378062516f, 0.35798198f},
-std::array<float,2>{0.244574025f, 0.97852242f},
-std::array<float,2>{0.683784664f, 0.222765312f},
-std::array<float,2>{0.602293193f, 0.866540074f},
-std::array<float,2>{0.0980106816f, 0.112778626f},
-std::array<float,2>{0.270777345f, 0.590451896f},
-std::array<float,2>{0.831391871f, 0.4166722f},
-std::array<float,2>{0.794153571f, 0.917261541f},
-std::array<float,2>{0.316775322f, 0.126835942f},
-std::array<float,2>{0.0476458073f, 0.647389054f},
-std::array<float,2>{0.527681231f, 0.282960653f},
-std::array<float,2>{0.749017715f, 0.553527653f},
-std::array<float,2>{0.176742151f, 0.457724988f},
-std::array<float,2>{0.443166882f, 0.768733323f},
-std::array<float,2>{0.886890352f, 0.0187474545f},
-std::array<float,2>{0.848405898f, 0.603869617f},
-std::array<float,2>{0.300275266f, 0.398303777f},
-std::array<float,2>{0.0683478117f, 0.819583356f},
-std::array<float,2>{0.573649228f, 0.0642526373f},
-std::array<float,2>{0.655948699f, 0.945900202f},
-std::array<float,2>{0.191711798f, 0.196763456f},
-std::array<float,2>{0.406344861f, 0.691626191f},
-std::array<float,2>{0.960765064f, 0.333943337f},
-std::array<float,2>{0.915763617f, 0.792542338f},
-std::array<float,2>{0.499360442f, 0.0487823635f},
-std::array<float,2>{0.14265728f, 0.517143607f},
-std::array<float,2>{0.706681013f, 0.471754581f},
-std::array<float,2>{0.546659529f, 0.659433246f},
-std::array<float,2>{0.0304940436f, 0.269622087f},
-std::array<float,2>{0.373406142f, 0.87785995f},
-std::array<float,2>{0.769532204f, 0.169002756f},
-std::array<float,2>{0.878889084f, 0.573185802f},
-std::array<float,2>{0.448052526f, 0.430616349f},
-std::array<float,2>{0.180353165f, 0.85871774f},
-std::array<float,2>{0.73868382f, 0.102885574f},
-std::array<float,2>{0.521194577f, 0.986575067f},
-std::array<float,2>{0.0588447638f, 0.249608204f},
-std::array<float,2>{0.326017529f, 0.740828931f},
-std::array<float,2>{0.788322091f, 0.359967828f},
-std::array<float,2>{0.840772867f, 0.755783498f},
-std::array<float,2>{0.279628336f, 0.0145344948f},
-std::array<float,2>{0.10855674f, 0.545585036f},
-std::array<float,2>{0.600908875f, 0.438017964f},
-std::array<float,2>{0.676524758f, 0.63084203f},
-std::array<float,2>{0.240948498f, 0.302003503f},
-std::array<float,2>{0.390410244f, 0.932264686f},
-std::array<float,2>{0.994462371f, 0.144098684f},
-std::array<float,2>{0.776087821f, 0.710442722f},
-std::array<float,2>{0.363253564f, 0.317601651f},
-std::array<float,2>{0.0173773561f, 0.959106326f},
-std::array<float,2>{0.533693433f, 0.204571769f},
-std::array<float,2>{0.711107731f, 0.834259808f},
-std::array<float,2>{0.151073322f, 0.0787119791f},
-std::array<float,2>{0.485633463f, 0.622878373f},
-std::array<float,2>{0.909696043f, 0.385741562f},
-std::array<float,2>{0.965837538f, 0.892075598f},
-std::array<float,2>{0.420493752f, 0.183367863f},
-std::array<float,2>{0.199476078f, 0.677569866f},
-std::array<float,2>{0.641510308f, 0.259013951f},
-std::array<float,2>{0.563682079f, 0.504681826f},
-std::array<float,2>{0.0741469413f, 0.485794038f},
-std::array<float,2>{0.308821052f, 0.800539613f},
-std::array<float,2>{0.856974721f, 0.0463747308f},
-std::array<float,2>{0.974137545f, 0.662198782f},
-std::array<float,2>{0.405975789f, 0.267123163f},
-std::array<float,2>{0.226096421f, 0.881466269f},
-std::array<float,2>{0.667139053f, 0.166607931f},
-std::array<float,2>{0.613400578f, 0.794713795f},
-std::array<float,2>{0.11956846f, 0.0545117073f},
-std::array<float,2>{0.25332737f, 0.520674825f},
-std::array<float,2>{0.824954748f, 0.474720508f},
-std::array<float,2>{0.801483691f, 0.951899052f},
-std::array<float,2>{0.338406563f, 0.20100674f},
-std::array<float,2>{0.0360864885f, 0.690944433f},
-std::array<float,2>{0.502779007f, 0.331726789f},
-std::array<float,2>{0.723594129f, 0.608454585f},
-std::array<float,2>{0.160274506f, 0.393762022f},
-std::array<float,2>{0.453753263f, 0.813305497f},
-std::array<float,2>{0.901867032f, 0.0664561912f},
-std::array<float,2>{0.86368072f, 0.549744487f},
-std::array<float,2>{0.29198873f, 0.454612225f},
-std::array<float,2>{0.0903421864f, 0.77092135f},
-std::array<float,2>{0.583224058f, 0.0217911471f},
-std::array<float,2>{0.635827482f, 0.918665171f},
-std::array<float,2>{0.2108282f, 0.131320968f},
-std::array<float,2>{0.435138017f, 0.642927289f},
-std::array<float,2>{0.945898294f, 0.286779851f},
-std::array<float,2>{0.931890249f, 0.861515105f},
-std::array<float,2>{0.472952694f, 0.116028264f},
-std::array<float,2>{0.131272197f, 0.588755071f},
-std::array<float,2>{0.700365722f, 0.418795377f},
-std::array<float,2>{0.560733616f, 0.728718579f},
-std::array<float,2>{0.0141326701f, 0.352008194f},
-std::array<float,2>{0.351752967f, 0.98265475f},
-std::array<float,2>{0.758527756f, 0.222318277f},
-std::array<float,2>{0.944150269f, 0.524675488f},
-std::array<float,2>{0.425133526f, 0.477898091f},
-std::array<float,2>{0.218290806f, 0.782266378f},
-std::array<float,2>{0.629309177f, 0.0562127195f},
-std::array<float,2>{0.58837992f, 0.88449955f},
-std::array<float,2>{0.0843816325f, 0.161086664f},
-std::array<float,2>{0.288909078f, 0.668353915f},
-std::array<float,2>{0.872279048f, 0.274224371f},
-std::array<float,2>{0.754204273f, 0.827772796f},
-std::array<float,2>{0.348703563f, 0.0746995807f},
-std::array<float,2>{0.000100352729f, 0.597289443f},
-std::array<float,2>{0.551281691f, 0.405964375f},
-std::array<float,2>{0.694545627f, 0.697407424f},
-std::array<float,2>{0.133995712f, 0.339799732f},
-std::array<float,2>{0.483070254f, 0.939909756f},
-std::array<float,2>{0.923443854f, 0.192496091f},
-std::array<float,2>{0.816865325f, 0.648610473f},
-std::array<float,2>{0.265473366f, 0.296592325f},
-std::array<float,2>{0.110198505f, 0.912436128f},
-std::array<float,2>{0.62376684f, 0.138444871f},
-std::array<float,2>{0.659609735f, 0.776042819f},
-std::array<float,2>{0.230577663f, 0.0273944754f},
-std::array<float,2>{0.395457834f, 0.556261897f},
-std::array<float,2>{0.976849556f, 0.467971504f},
-std::array<float,2>{0.894305706f, 0.971819878f},
-std::array<float,2>{0.464868546f, 0.226626083f},
-std::array<float,2>{0.16452615f, 0.72091645f},
-std::array<float,2>{0.728947341f, 0.344140977f},
-std::array<float,2>{0.509640276f, 0.582626879f},
-std::array<float,2>{0.0463262163f, 0.407399625f},
-std::array<float,2>{0.331471354f, 0.869445264f},
-std::array<float,2>{0.805986226f, 0.122000307f},
-std::array<float,2>{0.921246111f, 0.745789826f},
-std::array<float,2>{0.493122011f, 0.372449785f},
-std::array<float,2>{0.146020725f, 0.999046445f},
-std::array<float,2>{0.707790911f, 0.236919463f},
-std::array<float,2>{0.542165577f, 0.847746313f},
-std::array<float,2>{0.025825683f, 0.0950258896f},
-std::array<float,2>{0.368181199f, 0.567033291f},
-std::array<float,2>{0.767747879f, 0.423110336f},
-std::array<float,2>{0.845405757f, 0.926904202f},
-std::array<float,2>{0.303631961f, 0.149683401f},
-std::array<float,2>{0.0653279126f, 0.634173512f},
-std::array<float,2>{0.577440441f, 0.309116781f},
-std::array<float,2>{0.651258469f, 0.537958443f},
-std::array<float,2>{0.189581096f, 0.451646239f},
-std::array<float,2>{0.41310662f, 0.758210599f},
-std::array<float,2>{0.954218864f, 0.00505943783f},
-std::array<float,2>{0.792776525f, 0.612948239f},
-std::array<float,2>{0.312712371f, 0.380981833f},
-std::array<float,2>{0.0524161421f, 0.838206232f},
-std::array<float,2>{0.525917113f, 0.0931135491f},
-std::array<float,2>{0.745541811f, 0.966662765f},
-std::array<float,2>{0.173001856f, 0.21621421f},
-std::array<float,2>{0.4408077f, 0.713333666f},
-std::array<float,2>{0.885184228f, 0.324950337f},
-std::array<float,2>{0.988296747f, 0.806335807f},
-std::array<float,2>{0.379994154f, 0.0343432575f},
-std::array<float,2>{0.248694524f, 0.508889735f},
-std::array<float,2>{0.68233484f, 0.494513959f},
-std::array<float,2>{0.606759787f, 0.681363463f},
-std::array<float,2>{0.0946417302f, 0.252335757f},
-std::array<float,2>{0.268461049f, 0.905382514f},
-std::array<float,2>{0.835321724f, 0.175118983f},
-std::array<float,2>{0.997785389f, 0.598709285f},
-std::array<float,2>{0.382886738f, 0.398513556f},
-std::array<float,2>{0.235481173f, 0.823252797f},
-std::array<float,2>{0.674883664f, 0.0721514374f},
-std::array<float,2>{0.595456302f, 0.944524765f},
-std::array<float,2>{0.105444737f, 0.188741535f},
-std::array<float,2>{0.273756564f, 0.701052308f},
-std::array<float,2>{0.838153899f, 0.343333423f},
-std::array<float,2>{0.784575522f, 0.785575449f},
-std::array<float,2>{0.323894769f, 0.0621948466f},
-std::array<float,2>{0.057033401f, 0.529536545f},
-std::array<float,2>{0.516997933f, 0.483833015f},
-std::array<float,2>{0.737482488f, 0.666836441f},
-std::array<float,2>{0.185130849f, 0.27912575f},
-std::array<float,2>{0.45264861f, 0.890572071f},
-std::array<float,2>{0.878982246f, 0.159736574f},
-std::array<float,2>{0.854112983f, 0.723029673f},
-std::array<float,2>{0.307502031f, 0.348210335f},
-std::array<float,2>{0.0770745873f, 0.973555326f},
-std::array<float,2>{0.569690168f, 0.232730657f},
-std::array<float,2>{0.645116925f, 0.872029543f},
-std::array<float,2>{0.195782587f, 0.121077254f},
-std::array<float,2>{0.417916447f, 0.579529345f},
-std::array<float,2>{0.963102281f, 0.411176682f},
-std::array<float,2>{0.913980067f, 0.909073591f},
-std::array<float,2>{0.491224945f, 0.135723308f},
-std::array<float,2>{0.152775466f, 0.655603588f},
-std::array<float,2>{0.718203962f, 0.290836692f},
-std::array<float,2>{0.537454247f, 0.560787916f},
-std::array<float,2>{0.0213842671f, 0.463349253f},
-std::array<float,2>{0.363437533f, 0.779961646f},
-std::array<float,2>{0.777671635f, 0.0254923012f},
-std::array<float,2>{0.903776288f, 0.638528287f},
-std::array<float,2>{0.460464448f, 0.308466464f},
-std::array<float,2>{0.156434819f, 0.92260325f},
-std::array<float,2>{0.720705509f, 0.15304625f},
-std::array<float,2>{0.50558418f, 0.761738777f},
-std::array<float,2>{0.0343791768f, 0.00237194728f},
-std::array<float,2>{0.340383381f, 0.533221483f},
-std::array<float,2>{0.798510432f, 0.445340663f},
-std::array<float,2>{0.823386788f, 0.992661774f},
-std::array<float,2>{0.257246882f, 0.238770515f},
-std::array<float,2>{0.124244638f, 0.747751176f},
-std::array<float,2>{0.609528899f, 0.369006008f},
-std::array<float,2>{0.671023607f, 0.5663445f},
-std::array<float,2>{0.222057834f, 0.428132296f},
-std::array<float,2>{0.400090516f, 0.84416312f},
-std::array<float,2>{0.970353305f, 0.10054221f},
-std::array<float,2>{0.762966752f, 0.513226569f},
-std::array<float,2>{0.358948886f, 0.497815967f},
-std::array<float,2>{0.0113618914f, 0.809358001f},
-std::array<float,2>{0.555077672f, 0.0365187451f},
-std::array<float,2>{0.696870565f, 0.899544656f},
-std::array<float,2>{0.128693938f, 0.178127587f},
-std::array<float,2>{0.471792102f, 0.687084138f},
-std::array<float,2>{0.933714211f, 0.257509112f},
-std::array<float,2>{0.952832282f, 0.842921913f},
-std::array<float,2>{0.429920167f, 0.086077027f},
-std::array<float,2>{0.205385476f, 0.6160326f},
-std::array<float,2>{0.638896704f, 0.376755744f},
-std::array<float,2>{0.579851925f, 0.715710402f},
-std::array<float,2>{0.0868180022f, 0.323868096f},
-std::array<float,2>{0.294058621f, 0.961994886f},
-std::array<float,2>{0.859559596f, 0.212323651f},
-std::array<float,2>{0.927147567f, 0.542846859f},
-std::array<float,2>{0.477952629f, 0.443986535f},
-std::array<float,2>{0.137590602f, 0.750866711f},
-std::array<float,2>{0.688345194f, 0.00869440474f},
-std::array<float,2>{0.550696194f, 0.935162187f},
-std::array<float,2>{0.00497616315f, 0.146081045f},
-std::array<float,2>{0.347264796f, 0.627778113f},
-std::array<float,2>{0.751764834f, 0.296906978f},
-std::array<float,2>{0.868066072f, 0.855263054f},
-std::array<float,2>{0.284227043f, 0.10855338f},
-std::array<float,2>{0.078855291f, 0.574237645f},
-std::array<float,2>{0.590769827f, 0.435670525f},
-std::array<float,2>{0.626878083f, 0.736406922f},
-std::array<float,2>{0.21467635f, 0.363879383f},
-std::array<float,2>{0.426033914f, 0.988716125f},
-std::array<float,2>{0.941016734f, 0.245634794f},
-std::array<float,2>{0.808883667f, 0.673419833f},
-std::array<float,2>{0.335115582f, 0.261732727f},
-std::array<float,2>{0.040840771f, 0.89697659f},
-std::array<float,2>{0.514504075f, 0.186421394f},
-std::array<float,2>{0.733383298f, 0.801722705f},
-std::array<float,2>{0.169901013f, 0.0424175039f},
-std::array<float,2>{0.462456167f, 0.501821399f},
-std::array<float,2>{0.894760013f, 0.490663111f},
-std::array<float,2>{0.982172906f, 0.953603745f},
-std::array<float,2>{0.392899513f, 0.207106635f},
-std::array<float,2>{0.230435178f, 0.705987155f},
-std::array<float,2>{0.661247551f, 0.316270441f},
-std::array<float,2>{0.617465496f, 0.620089054f},
-std::array<float,2>{0.116945811f, 0.389873207f},
-std::array<float,2>{0.260454357f, 0.829445779f},
-std::array<float,2>{0.815694749f, 0.0841590613f},
-std::array<float,2>{0.958606362f, 0.693445265f},
-std::array<float,2>{0.408649832f, 0.334909439f},
-std::array<float,2>{0.193738759f, 0.949080348f},
-std::array<float,2>{0.65237093f, 0.197939023f},
-std::array<float,2>{0.570679843f, 0.816610098f},
-std::array<float,2>{0.0702176541f, 0.065857783f},
-std::array<float,2>{0.29754436f, 0.602118552f},
-std::array<float,2>{0.851103842f, 0.395303816f},
-std::array<float,2>{0.771518826f, 0.876034558f},
-std::array<float,2>{0.372833669f, 0.171697602f},
-std::array<float,2>{0.0287192483f, 0.657828987f},
-std::array<float,2>{0.543304801f, 0.27164647f},
-std::array<float,2>{0.70489198f, 0.518696606f},
-std::array<float,2>{0.142067209f, 0.469280392f},
-std::array<float,2>{0.49794805f, 0.789820611f},
-std::array<float,2>{0.917772532f, 0.0498279221f},
-std::array<float,2>{0.8292858f, 0.592671037f},
-std::array<float,2>{0.272486329f, 0.415398479f},
-std::array<float,2>{0.101541415f, 0.86430639f},
-std::array<float,2>{0.603859723f, 0.11036849f},
-std::array<float,2>{0.686308026f, 0.977249205f},
-std::array<float,2>{0.243806183f, 0.224815458f},
-std::array<float,2>{0.37641263f, 0.734012723f},
-std::array<float,2>{0.986973464f, 0.357202828f},
-std::array<float,2>{0.890172422f, 0.766272247f},
-std::array<float,2>{0.444813341f, 0.0163415521f},
-std::array<float,2>{0.179268166f, 0.551176548f},
-std::array<float,2>{0.746535242f, 0.460717857f},
-std::array<float,2>{0.531159043f, 0.645111263f},
-std::array<float,2>{0.0498968847f, 0.284821808f},
-std::array<float,2>{0.319235951f, 0.914377689f},
-std::array<float,2>{0.796445489f, 0.127862081f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0424647704f, 0.723004639f},
-std::array<float,2>{0.961132467f, 0.242703602f},
-std::array<float,2>{0.691659153f, 0.860099435f},
-std::array<float,2>{0.281882465f, 0.39535901f},
-std::array<float,2>{0.423009723f, 0.903932631f},
-std::array<float,2>{0.534551382f, 0.370912313f},
-std::array<float,2>{0.794435859f, 0.570202291f},
-std::array<float,2>{0.17494294f, 0.0231116395f},
-std::array<float,2>{0.355296552f, 0.551161945f},
-std::array<float,2>{0.62772131f, 0.0902509466f},
-std::array<float,2>{0.93141669f, 0.996350586f},
-std::array<float,2>{0.0775092691f, 0.300212115f},
-std::array<float,2>{0.244482517f, 0.795401335f},
-std::array<float,2>{0.850199223f, 0.493554056f},
-std::array<float,2>{0.615780175f, 0.664060593f},
-std::array<float,2>{0.454850852f, 0.1667604f},
-std::array<float,2>{0.136149749f, 0.603221059f},
-std::array<float,2>{0.773230314f, 0.0382452756f},
-std::array<float,2>{0.515223682f, 0.924572229f},
-std::array<float,2>{0.389216512f, 0.317695498f},
-std::array<float,2>{0.26245293f, 0.842196763f},
-std::array<float,2>{0.742178023f, 0.411446929f},
-std::array<float,2>{0.981900454f, 0.712454259f},
-std::array<float,2>{0.0256416351f, 0.208268359f},
-std::array<float,2>{0.469191343f, 0.646140814f},
-std::array<float,2>{0.582088709f, 0.13282226f},
-std::array<float,2>{0.833518028f, 0.751080036f},
-std::array<float,2>{0.196573809f, 0.465974718f},
-std::array<float,2>{0.106417015f, 0.949879766f},
-std::array<float,2>{0.896677732f, 0.263480186f},
-std::array<float,2>{0.672335863f, 0.530055761f},
-std::array<float,2>{0.323816419f, 0.0954839364f},
-std::array<float,2>{0.0821167901f, 0.512593091f},
-std::array<float,2>{0.914489627f, 0.112659261f},
-std::array<float,2>{0.647854209f, 0.961668551f},
-std::array<float,2>{0.371313989f, 0.270148396f},
-std::array<float,2>{0.453033507f, 0.778170347f},
-std::array<float,2>{0.606642246f, 0.449594647f},
-std::array<float,2>{0.861904621f, 0.637569129f},
-std::array<float,2>{0.228705943f, 0.153763771f},
-std::array<float,2>{0.305942625f, 0.69214195f},
-std::array<float,2>{0.704924047f, 0.188640341f},
-std::array<float,2>{0.942701221f, 0.813867211f},
-std::array<float,2>{0.0605169721f, 0.427365214f},
-std::array<float,2>{0.166097358f, 0.910011947f},
-std::array<float,2>{0.812289476f, 0.34193629f},
-std::array<float,2>{0.560815692f, 0.611779809f},
-std::array<float,2>{0.407823712f, 0.0546959005f},
-std::array<float,2>{0.206103936f, 0.680055678f},
-std::array<float,2>{0.819790184f, 0.172935635f},
-std::array<float,2>{0.568595111f, 0.801430285f},
-std::array<float,2>{0.497241259f, 0.480753452f},
-std::array<float,2>{0.334311992f, 0.977849662f},
-std::array<float,2>{0.670298934f, 0.290557206f},
-std::array<float,2>{0.884878278f, 0.531324327f},
-std::array<float,2>{0.109655447f, 0.0761786625f},
-std::array<float,2>{0.39841634f, 0.579213738f},
-std::array<float,2>{0.51963532f, 0.0115113789f},
-std::array<float,2>{0.761489987f, 0.888532341f},
-std::array<float,2>{0.150688425f, 0.347886026f},
-std::array<float,2>{0.00388220302f, 0.859338701f},
-std::array<float,2>{0.991363645f, 0.385035962f},
-std::array<float,2>{0.727825463f, 0.738070369f},
-std::array<float,2>{0.279213548f, 0.226424798f},
-std::array<float,2>{0.123082168f, 0.626583338f},
-std::array<float,2>{0.876794577f, 0.143473104f},
-std::array<float,2>{0.659894109f, 0.772543728f},
-std::array<float,2>{0.338050812f, 0.439120382f},
-std::array<float,2>{0.484894902f, 0.958171964f},
-std::array<float,2>{0.573125243f, 0.280534118f},
-std::array<float,2>{0.825247049f, 0.504151285f},
-std::array<float,2>{0.213541031f, 0.119193994f},
-std::array<float,2>{0.271039844f, 0.620732665f},
-std::array<float,2>{0.720685124f, 0.0526468828f},
-std::array<float,2>{0.997398138f, 0.921749592f},
-std::array<float,2>{0.0138529129f, 0.328718394f},
-std::array<float,2>{0.142117471f, 0.822352827f},
-std::array<float,2>{0.757427871f, 0.436221331f},
-std::array<float,2>{0.52444452f, 0.697709858f},
-std::array<float,2>{0.405066997f, 0.197373316f},
-std::array<float,2>{0.218898013f, 0.545966208f},
-std::array<float,2>{0.873282373f, 0.0639746711f},
-std::array<float,2>{0.600694001f, 0.97527647f},
-std::array<float,2>{0.443917751f, 0.284656852f},
-std::array<float,2>{0.365191787f, 0.806406438f},
-std::array<float,2>{0.655100286f, 0.474043548f},
-std::array<float,2>{0.909481347f, 0.679430425f},
-std::array<float,2>{0.0869755894f, 0.183177024f},
-std::array<float,2>{0.420286685f, 0.746758461f},
-std::array<float,2>{0.554073036f, 0.233957127f},
-std::array<float,2>{0.801365137f, 0.847972691f},
-std::array<float,2>{0.162798271f, 0.376478046f},
-std::array<float,2>{0.047299955f, 0.877611756f},
-std::array<float,2>{0.950223565f, 0.355763823f},
-std::array<float,2>{0.712936103f, 0.589063227f},
-std::array<float,2>{0.303445995f, 0.00228914642f},
-std::array<float,2>{0.0192406494f, 0.578037262f},
-std::array<float,2>{0.969970047f, 0.0258544497f},
-std::array<float,2>{0.746036708f, 0.891566217f},
-std::array<float,2>{0.256174773f, 0.36145097f},
-std::array<float,2>{0.375826567f, 0.874304056f},
-std::array<float,2>{0.506117582f, 0.403836459f},
-std::array<float,2>{0.776714683f, 0.733805597f},
-std::array<float,2>{0.128536269f, 0.237413466f},
-std::array<float,2>{0.316628486f, 0.664544344f},
-std::array<float,2>{0.685680151f, 0.157956064f},
-std::array<float,2>{0.898972571f, 0.783150554f},
-std::array<float,2>{0.094174318f, 0.491529137f},
-std::array<float,2>{0.193921641f, 0.984423041f},
-std::array<float,2>{0.840010464f, 0.311465561f},
-std::array<float,2>{0.591280341f, 0.556019068f},
-std::array<float,2>{0.482326299f, 0.0823101699f},
-std::array<float,2>{0.18257843f, 0.70465821f},
-std::array<float,2>{0.785149813f, 0.215271533f},
-std::array<float,2>{0.544004261f, 0.828620672f},
-std::array<float,2>{0.430064082f, 0.417379797f},
-std::array<float,2>{0.290034235f, 0.932565033f},
-std::array<float,2>{0.698936999f, 0.325765878f},
-std::array<float,2>{0.958325088f, 0.599924564f},
-std::array<float,2>{0.0360969417f, 0.0401529707f},
-std::array<float,2>{0.466819674f, 0.51650846f},
-std::array<float,2>{0.624638379f, 0.105903938f},
-std::array<float,2>{0.852545321f, 0.945154428f},
-std::array<float,2>{0.238435194f, 0.252796322f},
-std::array<float,2>{0.0693232939f, 0.762517154f},
-std::array<float,2>{0.923960924f, 0.45353359f},
-std::array<float,2>{0.638580918f, 0.65253967f},
-std::array<float,2>{0.350446284f, 0.126433879f},
-std::array<float,2>{0.0720658824f, 0.700826287f},
-std::array<float,2>{0.934551179f, 0.201370165f},
-std::array<float,2>{0.632794678f, 0.825205207f},
-std::array<float,2>{0.358758777f, 0.431531787f},
-std::array<float,2>{0.45999527f, 0.917057335f},
-std::array<float,2>{0.610657394f, 0.332671344f},
-std::array<float,2>{0.844564021f, 0.62226826f},
-std::array<float,2>{0.248378441f, 0.0491215512f},
-std::array<float,2>{0.288296491f, 0.503239036f},
-std::array<float,2>{0.688297331f, 0.12413241f},
-std::array<float,2>{0.965759039f, 0.954309583f},
-std::array<float,2>{0.0454857163f, 0.275529802f},
-std::array<float,2>{0.176233098f, 0.7680493f},
-std::array<float,2>{0.792542219f, 0.443515033f},
-std::array<float,2>{0.537785351f, 0.630313694f},
-std::array<float,2>{0.427380115f, 0.147438213f},
-std::array<float,2>{0.202884883f, 0.592392743f},
-std::array<float,2>{0.829300165f, 0.00687864982f},
-std::array<float,2>{0.579001069f, 0.881483138f},
-std::array<float,2>{0.4749901f, 0.351736665f},
-std::array<float,2>{0.327777088f, 0.844045222f},
-std::array<float,2>{0.677452266f, 0.382092983f},
-std::array<float,2>{0.893823922f, 0.743616223f},
-std::array<float,2>{0.10216517f, 0.226809219f},
-std::array<float,2>{0.383607477f, 0.675779045f},
-std::array<float,2>{0.511261225f, 0.187150612f},
-std::array<float,2>{0.768716395f, 0.811021924f},
-std::array<float,2>{0.138926387f, 0.471298933f},
-std::array<float,2>{0.0284888949f, 0.97043699f},
-std::array<float,2>{0.976587355f, 0.285408586f},
-std::array<float,2>{0.736562371f, 0.540754795f},
-std::array<float,2>{0.261556f, 0.0694542974f},
-std::array<float,2>{0.0580969118f, 0.559904158f},
-std::array<float,2>{0.941393971f, 0.0818130448f},
-std::array<float,2>{0.708977044f, 0.988761544f},
-std::array<float,2>{0.310964525f, 0.30651477f},
-std::array<float,2>{0.41135639f, 0.786561072f},
-std::array<float,2>{0.55777061f, 0.484634906f},
-std::array<float,2>{0.80597049f, 0.668401062f},
-std::array<float,2>{0.170818537f, 0.161660522f},
-std::array<float,2>{0.370933443f, 0.730091155f},
-std::array<float,2>{0.643838882f, 0.239107475f},
-std::array<float,2>{0.92078495f, 0.867979646f},
-std::array<float,2>{0.080188863f, 0.39993903f},
-std::array<float,2>{0.232814521f, 0.89750427f},
-std::array<float,2>{0.864789784f, 0.366100311f},
-std::array<float,2>{0.604483962f, 0.571766734f},
-std::array<float,2>{0.446113229f, 0.0296992529f},
-std::array<float,2>{0.155988485f, 0.652327716f},
-std::array<float,2>{0.763748765f, 0.130833313f},
-std::array<float,2>{0.519025147f, 0.76068145f},
-std::array<float,2>{0.393082827f, 0.460793644f},
-std::array<float,2>{0.274118632f, 0.940234423f},
-std::array<float,2>{0.733466148f, 0.257182032f},
-std::array<float,2>{0.988195717f, 0.520826459f},
-std::array<float,2>{0.00495277159f, 0.105036087f},
-std::array<float,2>{0.494995862f, 0.596968055f},
-std::array<float,2>{0.56513828f, 0.0451855212f},
-std::array<float,2>{0.813745439f, 0.933604598f},
-std::array<float,2>{0.209140763f, 0.322463125f},
-std::array<float,2>{0.115330413f, 0.83212316f},
-std::array<float,2>{0.887230396f, 0.419263452f},
-std::array<float,2>{0.667380393f, 0.707357049f},
-std::array<float,2>{0.331342578f, 0.211654022f},
-std::array<float,2>{0.00795939844f, 0.658506811f},
-std::array<float,2>{0.99230361f, 0.169210508f},
-std::array<float,2>{0.726435065f, 0.790854454f},
-std::array<float,2>{0.266949683f, 0.49870348f},
-std::array<float,2>{0.400027096f, 0.995999157f},
-std::array<float,2>{0.531129122f, 0.303913891f},
-std::array<float,2>{0.750645578f, 0.550276101f},
-std::array<float,2>{0.148392826f, 0.0878441855f},
-std::array<float,2>{0.340176344f, 0.566343963f},
-std::array<float,2>{0.663212478f, 0.0173641685f},
-std::array<float,2>{0.880494595f, 0.899360657f},
-std::array<float,2>{0.118715361f, 0.372092962f},
-std::array<float,2>{0.21571435f, 0.86390239f},
-std::array<float,2>{0.823362768f, 0.392991006f},
-std::array<float,2>{0.576128066f, 0.721291602f},
-std::array<float,2>{0.491168141f, 0.248657897f},
-std::array<float,2>{0.158101797f, 0.525687277f},
-std::array<float,2>{0.799240172f, 0.0979393795f},
-std::array<float,2>{0.54927963f, 0.945374906f},
-std::array<float,2>{0.414267272f, 0.259901613f},
-std::array<float,2>{0.298349887f, 0.756715417f},
-std::array<float,2>{0.715268433f, 0.464322656f},
-std::array<float,2>{0.945915163f, 0.643588781f},
-std::array<float,2>{0.0537920929f, 0.13919054f},
-std::array<float,2>{0.439546734f, 0.716283798f},
-std::array<float,2>{0.596354246f, 0.203801364f},
-std::array<float,2>{0.870174527f, 0.836797595f},
-std::array<float,2>{0.225642785f, 0.40650475f},
-std::array<float,2>{0.0914598107f, 0.926934779f},
-std::array<float,2>{0.911625326f, 0.314480543f},
-std::array<float,2>{0.651481152f, 0.60676074f},
-std::array<float,2>{0.363275468f, 0.0327323079f},
-std::array<float,2>{0.0987542942f, 0.615999281f},
-std::array<float,2>{0.90297097f, 0.0589089096f},
-std::array<float,2>{0.681967556f, 0.911149085f},
-std::array<float,2>{0.314390838f, 0.338996768f},
-std::array<float,2>{0.479592264f, 0.817627132f},
-std::array<float,2>{0.586259842f, 0.424085349f},
-std::array<float,2>{0.836869657f, 0.688000619f},
-std::array<float,2>{0.190678775f, 0.19408159f},
-std::array<float,2>{0.252734065f, 0.635277331f},
-std::array<float,2>{0.749521077f, 0.151561961f},
-std::array<float,2>{0.974728227f, 0.775773644f},
-std::array<float,2>{0.0222277716f, 0.447444201f},
-std::array<float,2>{0.130538985f, 0.967461407f},
-std::array<float,2>{0.777456164f, 0.269505501f},
-std::array<float,2>{0.501231074f, 0.510872662f},
-std::array<float,2>{0.37930873f, 0.116146997f},
-std::array<float,2>{0.237661704f, 0.741200387f},
-std::array<float,2>{0.856934607f, 0.221239686f},
-std::array<float,2>{0.618872643f, 0.854362428f},
-std::array<float,2>{0.46252957f, 0.390103281f},
-std::array<float,2>{0.344150454f, 0.882827163f},
-std::array<float,2>{0.635037303f, 0.345582545f},
-std::array<float,2>{0.92821908f, 0.582977593f},
-std::array<float,2>{0.062824443f, 0.0125286877f},
-std::array<float,2>{0.434597194f, 0.537953973f},
-std::array<float,2>{0.539246023f, 0.0705884248f},
-std::array<float,2>{0.785245121f, 0.982604563f},
-std::array<float,2>{0.186047122f, 0.293086022f},
-std::array<float,2>{0.0347086899f, 0.798205018f},
-std::array<float,2>{0.954810798f, 0.476638138f},
-std::array<float,2>{0.70225662f, 0.686793625f},
-std::array<float,2>{0.295540512f, 0.176495746f},
-std::array<float,2>{0.0249748547f, 0.714010596f},
-std::array<float,2>{0.982680202f, 0.210169643f},
-std::array<float,2>{0.739803791f, 0.84161377f},
-std::array<float,2>{0.263851017f, 0.412994832f},
-std::array<float,2>{0.387842536f, 0.922764003f},
-std::array<float,2>{0.511800766f, 0.319331259f},
-std::array<float,2>{0.769728303f, 0.604822516f},
-std::array<float,2>{0.133020699f, 0.0369768329f},
-std::array<float,2>{0.321144372f, 0.528581381f},
-std::array<float,2>{0.674411774f, 0.0961985141f},
-std::array<float,2>{0.894885004f, 0.953068078f},
-std::array<float,2>{0.108588018f, 0.265110791f},
-std::array<float,2>{0.198364928f, 0.753371835f},
-std::array<float,2>{0.835107028f, 0.4677113f},
-std::array<float,2>{0.585346937f, 0.646593332f},
-std::array<float,2>{0.472329438f, 0.135703191f},
-std::array<float,2>{0.172110289f, 0.56834501f},
-std::array<float,2>{0.795818388f, 0.0205219835f},
-std::array<float,2>{0.532729447f, 0.905094624f},
-std::array<float,2>{0.423928916f, 0.369092226f},
-std::array<float,2>{0.283830613f, 0.86283493f},
-std::array<float,2>{0.694613397f, 0.39704442f},
-std::array<float,2>{0.964266896f, 0.725505233f},
-std::array<float,2>{0.039478194f, 0.244697675f},
-std::array<float,2>{0.456184864f, 0.660200953f},
-std::array<float,2>{0.614747941f, 0.164937317f},
-std::array<float,2>{0.847885728f, 0.793864429f},
-std::array<float,2>{0.242716298f, 0.494215548f},
-std::array<float,2>{0.0749960616f, 0.999283254f},
-std::array<float,2>{0.932213247f, 0.297332972f},
-std::array<float,2>{0.626160622f, 0.554687023f},
-std::array<float,2>{0.351912081f, 0.0928748995f},
-std::array<float,2>{0.111622915f, 0.533728063f},
-std::array<float,2>{0.882978618f, 0.0751888901f},
-std::array<float,2>{0.668296874f, 0.9790923f},
-std::array<float,2>{0.333889216f, 0.291762084f},
-std::array<float,2>{0.498835087f, 0.804153621f},
-std::array<float,2>{0.567714334f, 0.484221637f},
-std::array<float,2>{0.816446781f, 0.68172133f},
-std::array<float,2>{0.203779683f, 0.174976856f},
-std::array<float,2>{0.279460847f, 0.735664248f},
-std::array<float,2>{0.729199708f, 0.223582834f},
-std::array<float,2>{0.98865521f, 0.856933057f},
-std::array<float,2>{0.00138236478f, 0.384185046f},
-std::array<float,2>{0.148586124f, 0.89015007f},
-std::array<float,2>{0.757857203f, 0.351064593f},
-std::array<float,2>{0.522038162f, 0.581230521f},
-std::array<float,2>{0.395463258f, 0.00855279807f},
-std::array<float,2>{0.226938084f, 0.63985616f},
-std::array<float,2>{0.859602749f, 0.155325457f},
-std::array<float,2>{0.607939899f, 0.780741692f},
-std::array<float,2>{0.45020026f, 0.452426136f},
-std::array<float,2>{0.37420702f, 0.964348733f},
-std::array<float,2>{0.645036519f, 0.273145467f},
-std::array<float,2>{0.916383862f, 0.515019596f},
-std::array<float,2>{0.0855522752f, 0.109673031f},
-std::array<float,2>{0.410036474f, 0.610965371f},
-std::array<float,2>{0.559291184f, 0.057166703f},
-std::array<float,2>{0.809104264f, 0.907417953f},
-std::array<float,2>{0.165151834f, 0.340777725f},
-std::array<float,2>{0.0614223741f, 0.815954089f},
-std::array<float,2>{0.944488287f, 0.428198427f},
-std::array<float,2>{0.70548296f, 0.694239438f},
-std::array<float,2>{0.308248758f, 0.190413341f},
-std::array<float,2>{0.0884086117f, 0.67611903f},
-std::array<float,2>{0.906779528f, 0.18105039f},
-std::array<float,2>{0.654291272f, 0.807742715f},
-std::array<float,2>{0.366675943f, 0.476192564f},
-std::array<float,2>{0.44246909f, 0.973298371f},
-std::array<float,2>{0.597877681f, 0.281657279f},
-std::array<float,2>{0.872909009f, 0.543343306f},
-std::array<float,2>{0.220740259f, 0.0650237501f},
-std::array<float,2>{0.301749468f, 0.587552726f},
-std::array<float,2>{0.712586343f, 0.0008185599f},
-std::array<float,2>{0.952974856f, 0.876232684f},
-std::array<float,2>{0.0492273122f, 0.359315574f},
-std::array<float,2>{0.162005782f, 0.851037085f},
-std::array<float,2>{0.8027758f, 0.377878815f},
-std::array<float,2>{0.551105797f, 0.748827457f},
-std::array<float,2>{0.419432878f, 0.231683955f},
-std::array<float,2>{0.211141542f, 0.506247342f},
-std::array<float,2>{0.827707708f, 0.11817386f},
-std::array<float,2>{0.571106732f, 0.959806204f},
-std::array<float,2>{0.487311065f, 0.278228849f},
-std::array<float,2>{0.33744362f, 0.770219922f},
-std::array<float,2>{0.65814209f, 0.4412027f},
-std::array<float,2>{0.877166808f, 0.628898263f},
-std::array<float,2>{0.122425042f, 0.140825912f},
-std::array<float,2>{0.4035061f, 0.696101308f},
-std::array<float,2>{0.525526524f, 0.196089327f},
-std::array<float,2>{0.755217612f, 0.820869267f},
-std::array<float,2>{0.143082455f, 0.435479671f},
-std::array<float,2>{0.0132548753f, 0.918477714f},
-std::array<float,2>{0.998417377f, 0.331948668f},
-std::array<float,2>{0.722389817f, 0.617441773f},
-std::array<float,2>{0.272520334f, 0.0536510237f},
-std::array<float,2>{0.0388082415f, 0.597843349f},
-std::array<float,2>{0.960405052f, 0.0410729349f},
-std::array<float,2>{0.695663631f, 0.930037856f},
-std::array<float,2>{0.292402774f, 0.326920986f},
-std::array<float,2>{0.432904869f, 0.831446826f},
-std::array<float,2>{0.545843482f, 0.414327949f},
-std::array<float,2>{0.783174217f, 0.705896974f},
-std::array<float,2>{0.180179179f, 0.218730554f},
-std::array<float,2>{0.348560125f, 0.655914485f},
-std::array<float,2>{0.639755547f, 0.128289819f},
-std::array<float,2>{0.922952294f, 0.764674306f},
-std::array<float,2>{0.067689836f, 0.455711246f},
-std::array<float,2>{0.240831017f, 0.942336738f},
-std::array<float,2>{0.85396719f, 0.251431882f},
-std::array<float,2>{0.621734858f, 0.519172549f},
-std::array<float,2>{0.465049624f, 0.10830348f},
-std::array<float,2>{0.125186861f, 0.731871188f},
-std::array<float,2>{0.774602711f, 0.234865293f},
-std::array<float,2>{0.50488168f, 0.872255862f},
-std::array<float,2>{0.377592951f, 0.404535294f},
-std::array<float,2>{0.255042195f, 0.892911673f},
-std::array<float,2>{0.743202686f, 0.360853702f},
-std::array<float,2>{0.97127229f, 0.57478261f},
-std::array<float,2>{0.0159508828f, 0.0245965999f},
-std::array<float,2>{0.484353662f, 0.557824194f},
-std::array<float,2>{0.5920555f, 0.084223859f},
-std::array<float,2>{0.842365921f, 0.98707813f},
-std::array<float,2>{0.191583246f, 0.310407937f},
-std::array<float,2>{0.0969805568f, 0.784351408f},
-std::array<float,2>{0.901390016f, 0.488839597f},
-std::array<float,2>{0.683765948f, 0.66694659f},
-std::array<float,2>{0.319904029f, 0.1587217f},
-std::array<float,2>{0.105109543f, 0.745686412f},
-std::array<float,2>{0.891491652f, 0.228545651f},
-std::array<float,2>{0.677824497f, 0.846037209f},
-std::array<float,2>{0.325873166f, 0.379279226f},
-std::array<float,2>{0.47273767f, 0.878934205f},
-std::array<float,2>{0.580645978f, 0.355147272f},
-std::array<float,2>{0.830187559f, 0.590462923f},
-std::array<float,2>{0.200937256f, 0.00452218158f},
-std::array<float,2>{0.258137792f, 0.542580962f},
-std::array<float,2>{0.735430539f, 0.0675009638f},
-std::array<float,2>{0.98039937f, 0.972332716f},
-std::array<float,2>{0.0301691052f, 0.287858307f},
-std::array<float,2>{0.13739644f, 0.808947146f},
-std::array<float,2>{0.767219007f, 0.469334543f},
-std::array<float,2>{0.509486377f, 0.673267484f},
-std::array<float,2>{0.384877533f, 0.185095981f},
-std::array<float,2>{0.246136963f, 0.623070896f},
-std::array<float,2>{0.846873641f, 0.0476172194f},
-std::array<float,2>{0.61177665f, 0.91461283f},
-std::array<float,2>{0.457325369f, 0.335933268f},
-std::array<float,2>{0.356169224f, 0.826598108f},
-std::array<float,2>{0.630220532f, 0.43287167f},
-std::array<float,2>{0.935885847f, 0.701817811f},
-std::array<float,2>{0.0730985031f, 0.200316206f},
-std::array<float,2>{0.428691715f, 0.631316721f},
-std::array<float,2>{0.537099004f, 0.146056548f},
-std::array<float,2>{0.789707601f, 0.765886545f},
-std::array<float,2>{0.179682657f, 0.442335993f},
-std::array<float,2>{0.0440029502f, 0.95544368f},
-std::array<float,2>{0.966981053f, 0.275315285f},
-std::array<float,2>{0.691206992f, 0.500984013f},
-std::array<float,2>{0.286117673f, 0.121615596f},
-std::array<float,2>{0.00769528421f, 0.521633685f},
-std::array<float,2>{0.985218406f, 0.102382742f},
-std::array<float,2>{0.730690539f, 0.939207137f},
-std::array<float,2>{0.276215613f, 0.254858494f},
-std::array<float,2>{0.391836464f, 0.759687185f},
-std::array<float,2>{0.516280472f, 0.457243413f},
-std::array<float,2>{0.76268369f, 0.649001002f},
-std::array<float,2>{0.154063493f, 0.132499248f},
-std::array<float,2>{0.328793138f, 0.710620284f},
-std::array<float,2>{0.664698839f, 0.214226827f},
-std::array<float,2>{0.89023602f, 0.834231198f},
-std::array<float,2>{0.113485217f, 0.420928925f},
-std::array<float,2>{0.207149833f, 0.937244892f},
-std::array<float,2>{0.816358209f, 0.320557237f},
-std::array<float,2>{0.563457727f, 0.594926059f},
-std::array<float,2>{0.492201418f, 0.0447852574f},
-std::array<float,2>{0.168573871f, 0.671408057f},
-std::array<float,2>{0.808514476f, 0.163419694f},
-std::array<float,2>{0.556018233f, 0.78774333f},
-std::array<float,2>{0.412518173f, 0.487674713f},
-std::array<float,2>{0.310059994f, 0.991080642f},
-std::array<float,2>{0.710233152f, 0.308445513f},
-std::array<float,2>{0.939183414f, 0.562482595f},
-std::array<float,2>{0.0547695644f, 0.0796932876f},
-std::array<float,2>{0.447560787f, 0.573319852f},
-std::array<float,2>{0.602320671f, 0.0292387903f},
-std::array<float,2>{0.866076469f, 0.894795775f},
-std::array<float,2>{0.230971783f, 0.365081608f},
-std::array<float,2>{0.0783826485f, 0.870945752f},
-std::array<float,2>{0.918907702f, 0.402130604f},
-std::array<float,2>{0.640995204f, 0.727120757f},
-std::array<float,2>{0.368711203f, 0.241083801f},
-std::array<float,2>{0.0518513694f, 0.640835583f},
-std::array<float,2>{0.948257685f, 0.137685791f},
-std::array<float,2>{0.717472374f, 0.753931105f},
-std::array<float,2>{0.300530821f, 0.462052315f},
-std::array<float,2>{0.416812003f, 0.949198723f},
-std::array<float,2>{0.547053218f, 0.259352267f},
-std::array<float,2>{0.797740817f, 0.52384454f},
-std::array<float,2>{0.159004107f, 0.100606173f},
-std::array<float,2>{0.360268921f, 0.607686043f},
-std::array<float,2>{0.649348199f, 0.0349870548f},
-std::array<float,2>{0.9129861f, 0.928673863f},
-std::array<float,2>{0.0929334983f, 0.312661469f},
-std::array<float,2>{0.22319521f, 0.837969661f},
-std::array<float,2>{0.869119227f, 0.409656048f},
-std::array<float,2>{0.595589578f, 0.717189431f},
-std::array<float,2>{0.437875062f, 0.205297634f},
-std::array<float,2>{0.145742834f, 0.547489703f},
-std::array<float,2>{0.752570629f, 0.0884024501f},
-std::array<float,2>{0.52844435f, 0.993062794f},
-std::array<float,2>{0.401525736f, 0.302263439f},
-std::array<float,2>{0.269434839f, 0.792926013f},
-std::array<float,2>{0.724511206f, 0.497076094f},
-std::array<float,2>{0.99483484f, 0.658154011f},
-std::array<float,2>{0.0109173749f, 0.170474902f},
-std::array<float,2>{0.489192635f, 0.719277084f},
-std::array<float,2>{0.577788651f, 0.24616088f},
-std::array<float,2>{0.821699142f, 0.866263509f},
-std::array<float,2>{0.217420265f, 0.392426789f},
-std::array<float,2>{0.120891772f, 0.90046078f},
-std::array<float,2>{0.882010341f, 0.374504536f},
-std::array<float,2>{0.660243452f, 0.563963354f},
-std::array<float,2>{0.342604518f, 0.017849721f},
-std::array<float,2>{0.064594917f, 0.584299326f},
-std::array<float,2>{0.927183986f, 0.0149708167f},
-std::array<float,2>{0.632956266f, 0.886440277f},
-std::array<float,2>{0.347642869f, 0.347586095f},
-std::array<float,2>{0.46334967f, 0.852681339f},
-std::array<float,2>{0.619322538f, 0.386768699f},
-std::array<float,2>{0.85819447f, 0.739365339f},
-std::array<float,2>{0.236245349f, 0.220315844f},
-std::array<float,2>{0.293315232f, 0.685503185f},
-std::array<float,2>{0.700119019f, 0.179624557f},
-std::array<float,2>{0.955482364f, 0.799221873f},
-std::array<float,2>{0.0331742279f, 0.480374366f},
-std::array<float,2>{0.185245663f, 0.981480598f},
-std::array<float,2>{0.788260102f, 0.296311617f},
-std::array<float,2>{0.541827202f, 0.536702633f},
-std::array<float,2>{0.437201083f, 0.0732964575f},
-std::array<float,2>{0.189220682f, 0.690466523f},
-std::array<float,2>{0.839310169f, 0.192436829f},
-std::array<float,2>{0.589479983f, 0.818821192f},
-std::array<float,2>{0.477327317f, 0.422319263f},
-std::array<float,2>{0.315271884f, 0.913688123f},
-std::array<float,2>{0.679945588f, 0.33603251f},
-std::array<float,2>{0.905250072f, 0.614887834f},
-std::array<float,2>{0.100871846f, 0.0612305328f},
-std::array<float,2>{0.382646799f, 0.508069932f},
-std::array<float,2>{0.503301203f, 0.115231149f},
-std::array<float,2>{0.779318511f, 0.96566689f},
-std::array<float,2>{0.131027639f, 0.267080307f},
-std::array<float,2>{0.0213185195f, 0.773829997f},
-std::array<float,2>{0.972845972f, 0.446935445f},
-std::array<float,2>{0.746686101f, 0.633790553f},
-std::array<float,2>{0.251929939f, 0.149892479f},
-std::array<float,2>{0.0590059198f, 0.694908679f},
-std::array<float,2>{0.942137361f, 0.190929204f},
-std::array<float,2>{0.703262389f, 0.814949632f},
-std::array<float,2>{0.305643737f, 0.429122955f},
-std::array<float,2>{0.406272888f, 0.907158017f},
-std::array<float,2>{0.561919808f, 0.341451764f},
-std::array<float,2>{0.811459303f, 0.609473348f},
-std::array<float,2>{0.167426482f, 0.0583448038f},
-std::array<float,2>{0.37218827f, 0.514306247f},
-std::array<float,2>{0.646556497f, 0.111117326f},
-std::array<float,2>{0.915346622f, 0.963477433f},
-std::array<float,2>{0.0833182931f, 0.272439718f},
-std::array<float,2>{0.229746237f, 0.779644907f},
-std::array<float,2>{0.863264322f, 0.451796532f},
-std::array<float,2>{0.606278121f, 0.639338374f},
-std::array<float,2>{0.451432705f, 0.154816285f},
-std::array<float,2>{0.152084723f, 0.580982864f},
-std::array<float,2>{0.760272563f, 0.00945449248f},
-std::array<float,2>{0.521360993f, 0.888988197f},
-std::array<float,2>{0.397103101f, 0.350243062f},
-std::array<float,2>{0.277378589f, 0.855935514f},
-std::array<float,2>{0.726920605f, 0.38314262f},
-std::array<float,2>{0.990810394f, 0.735124052f},
-std::array<float,2>{0.00205579284f, 0.223879606f},
-std::array<float,2>{0.49683708f, 0.68327111f},
-std::array<float,2>{0.569537282f, 0.174510673f},
-std::array<float,2>{0.818468153f, 0.80320853f},
-std::array<float,2>{0.205226958f, 0.483168691f},
-std::array<float,2>{0.110858947f, 0.980268955f},
-std::array<float,2>{0.886522412f, 0.292570859f},
-std::array<float,2>{0.671486139f, 0.534745097f},
-std::array<float,2>{0.335069865f, 0.0760081857f},
-std::array<float,2>{0.0763306841f, 0.553160965f},
-std::array<float,2>{0.930626988f, 0.0919847339f},
-std::array<float,2>{0.62809366f, 0.998407006f},
-std::array<float,2>{0.35441491f, 0.298249841f},
-std::array<float,2>{0.453547984f, 0.794190407f},
-std::array<float,2>{0.617121279f, 0.496031731f},
-std::array<float,2>{0.85074383f, 0.661679327f},
-std::array<float,2>{0.245763049f, 0.165639922f},
-std::array<float,2>{0.283119857f, 0.726274073f},
-std::array<float,2>{0.693058074f, 0.245837793f},
-std::array<float,2>{0.962749541f, 0.861742556f},
-std::array<float,2>{0.0416591205f, 0.397670209f},
-std::array<float,2>{0.174151465f, 0.905535936f},
-std::array<float,2>{0.793283403f, 0.367347419f},
-std::array<float,2>{0.53389138f, 0.567196667f},
-std::array<float,2>{0.422091186f, 0.0196714606f},
-std::array<float,2>{0.195639014f, 0.647676885f},
-std::array<float,2>{0.83218199f, 0.136412486f},
-std::array<float,2>{0.583730817f, 0.752310336f},
-std::array<float,2>{0.470257282f, 0.468239129f},
-std::array<float,2>{0.322716415f, 0.951469839f},
-std::array<float,2>{0.673466742f, 0.264455527f},
-std::array<float,2>{0.897493005f, 0.527959347f},
-std::array<float,2>{0.107412577f, 0.0970938504f},
-std::array<float,2>{0.389763772f, 0.604035139f},
-std::array<float,2>{0.514080167f, 0.035199862f},
-std::array<float,2>{0.771485984f, 0.923653662f},
-std::array<float,2>{0.135679528f, 0.319921255f},
-std::array<float,2>{0.0271288883f, 0.840410471f},
-std::array<float,2>{0.981106639f, 0.413861662f},
-std::array<float,2>{0.740607619f, 0.713261724f},
-std::array<float,2>{0.263259917f, 0.209288687f},
-std::array<float,2>{0.0951626226f, 0.66783458f},
-std::array<float,2>{0.899499238f, 0.159192473f},
-std::array<float,2>{0.686736465f, 0.783246934f},
-std::array<float,2>{0.317657501f, 0.490165919f},
-std::array<float,2>{0.481153518f, 0.987440467f},
-std::array<float,2>{0.590371549f, 0.30876866f},
-std::array<float,2>{0.840949535f, 0.55760932f},
-std::array<float,2>{0.194918916f, 0.0849643648f},
-std::array<float,2>{0.257798433f, 0.575637937f},
-std::array<float,2>{0.745082617f, 0.0235290509f},
-std::array<float,2>{0.969215631f, 0.893996954f},
-std::array<float,2>{0.0180627052f, 0.36028555f},
-std::array<float,2>{0.127793267f, 0.871391714f},
-std::array<float,2>{0.775827229f, 0.406008154f},
-std::array<float,2>{0.507257104f, 0.730471373f},
-std::array<float,2>{0.37631914f, 0.23591885f},
-std::array<float,2>{0.239693731f, 0.518081725f},
-std::array<float,2>{0.851852775f, 0.108470611f},
-std::array<float,2>{0.623298943f, 0.942942262f},
-std::array<float,2>{0.468279749f, 0.250495911f},
-std::array<float,2>{0.351275593f, 0.763926148f},
-std::array<float,2>{0.637619734f, 0.456699193f},
-std::array<float,2>{0.925135434f, 0.655055642f},
-std::array<float,2>{0.0698741376f, 0.12769714f},
-std::array<float,2>{0.43112424f, 0.706349611f},
-std::array<float,2>{0.543113708f, 0.217084795f},
-std::array<float,2>{0.783509731f, 0.830102026f},
-std::array<float,2>{0.182855964f, 0.415800869f},
-std::array<float,2>{0.0369522981f, 0.931337178f},
-std::array<float,2>{0.957269549f, 0.327297986f},
-std::array<float,2>{0.69740653f, 0.599207282f},
-std::array<float,2>{0.290823847f, 0.0422594734f},
-std::array<float,2>{0.0149690295f, 0.61873436f},
-std::array<float,2>{0.996436298f, 0.0543153659f},
-std::array<float,2>{0.719612896f, 0.919591308f},
-std::array<float,2>{0.270008534f, 0.330255568f},
-std::array<float,2>{0.405356765f, 0.821389139f},
-std::array<float,2>{0.524126887f, 0.434445113f},
-std::array<float,2>{0.75609237f, 0.696768165f},
-std::array<float,2>{0.141384274f, 0.196673557f},
-std::array<float,2>{0.339302301f, 0.627098024f},
-std::array<float,2>{0.658570588f, 0.142035946f},
-std::array<float,2>{0.87523973f, 0.770718217f},
-std::array<float,2>{0.124612123f, 0.439621627f},
-std::array<float,2>{0.214451388f, 0.960374296f},
-std::array<float,2>{0.824570119f, 0.278368324f},
-std::array<float,2>{0.573433578f, 0.507129729f},
-std::array<float,2>{0.485691756f, 0.117802009f},
-std::array<float,2>{0.163382724f, 0.749244571f},
-std::array<float,2>{0.802404761f, 0.231076747f},
-std::array<float,2>{0.553605378f, 0.849861562f},
-std::array<float,2>{0.421280921f, 0.378127545f},
-std::array<float,2>{0.303935081f, 0.875757694f},
-std::array<float,2>{0.71405071f, 0.357837766f},
-std::array<float,2>{0.949736297f, 0.586552978f},
-std::array<float,2>{0.04869809f, 0.00193089852f},
-std::array<float,2>{0.445114344f, 0.544366121f},
-std::array<float,2>{0.599858582f, 0.0663174093f},
-std::array<float,2>{0.874120474f, 0.97449851f},
-std::array<float,2>{0.220639557f, 0.282315999f},
-std::array<float,2>{0.085970901f, 0.807475269f},
-std::array<float,2>{0.908644497f, 0.475577354f},
-std::array<float,2>{0.656228304f, 0.677041233f},
-std::array<float,2>{0.363409609f, 0.180433929f},
-std::array<float,2>{0.0811170191f, 0.72850728f},
-std::array<float,2>{0.921605051f, 0.242075682f},
-std::array<float,2>{0.64282763f, 0.869954646f},
-std::array<float,2>{0.369193465f, 0.400894016f},
-std::array<float,2>{0.447091073f, 0.895530462f},
-std::array<float,2>{0.60533011f, 0.364203274f},
-std::array<float,2>{0.863572478f, 0.572340369f},
-std::array<float,2>{0.23426123f, 0.0279087853f},
-std::array<float,2>{0.311954528f, 0.560597122f},
-std::array<float,2>{0.707802117f, 0.0785127953f},
-std::array<float,2>{0.940365851f, 0.991649806f},
-std::array<float,2>{0.0570865013f, 0.307383567f},
-std::array<float,2>{0.171528459f, 0.788996696f},
-std::array<float,2>{0.805264831f, 0.487071753f},
-std::array<float,2>{0.557525337f, 0.670529723f},
-std::array<float,2>{0.410980642f, 0.162748113f},
-std::array<float,2>{0.210482776f, 0.594438374f},
-std::array<float,2>{0.813121498f, 0.0433189385f},
-std::array<float,2>{0.565850139f, 0.936137974f},
-std::array<float,2>{0.495692253f, 0.321561068f},
-std::array<float,2>{0.330231756f, 0.835424066f},
-std::array<float,2>{0.666952074f, 0.420287371f},
-std::array<float,2>{0.888325274f, 0.709293365f},
-std::array<float,2>{0.116290435f, 0.21326986f},
-std::array<float,2>{0.393917263f, 0.649748504f},
-std::array<float,2>{0.518275499f, 0.131173402f},
-std::array<float,2>{0.764720857f, 0.757970095f},
-std::array<float,2>{0.15478687f, 0.458890438f},
-std::array<float,2>{0.00471755629f, 0.937992156f},
-std::array<float,2>{0.987073541f, 0.255309522f},
-std::array<float,2>{0.733336389f, 0.52322638f},
-std::array<float,2>{0.27489078f, 0.102599926f},
-std::array<float,2>{0.0460634306f, 0.500494063f},
-std::array<float,2>{0.965976119f, 0.122648321f},
-std::array<float,2>{0.688723028f, 0.956424952f},
-std::array<float,2>{0.287546486f, 0.274167746f},
-std::array<float,2>{0.426514477f, 0.766990662f},
-std::array<float,2>{0.538694382f, 0.442408592f},
-std::array<float,2>{0.791311026f, 0.63267529f},
-std::array<float,2>{0.177652925f, 0.145147786f},
-std::array<float,2>{0.358234465f, 0.70283854f},
-std::array<float,2>{0.631394625f, 0.199857265f},
-std::array<float,2>{0.935161829f, 0.827837646f},
-std::array<float,2>{0.0712690353f, 0.431770861f},
-std::array<float,2>{0.249044389f, 0.91569674f},
-std::array<float,2>{0.845194519f, 0.334013075f},
-std::array<float,2>{0.609857023f, 0.624832094f},
-std::array<float,2>{0.459271103f, 0.0486210212f},
-std::array<float,2>{0.139654636f, 0.672008395f},
-std::array<float,2>{0.768163145f, 0.183637515f},
-std::array<float,2>{0.510289133f, 0.809983671f},
-std::array<float,2>{0.384580314f, 0.469864339f},
-std::array<float,2>{0.260029107f, 0.97160393f},
-std::array<float,2>{0.737415254f, 0.288966149f},
-std::array<float,2>{0.978396058f, 0.541970253f},
-std::array<float,2>{0.0279839244f, 0.0667655915f},
-std::array<float,2>{0.475920081f, 0.590941548f},
-std::array<float,2>{0.579700708f, 0.00542794121f},
-std::array<float,2>{0.828874707f, 0.880293489f},
-std::array<float,2>{0.201968819f, 0.354459584f},
-std::array<float,2>{0.103384919f, 0.847480357f},
-std::array<float,2>{0.893269062f, 0.38069424f},
-std::array<float,2>{0.67674607f, 0.74501735f},
-std::array<float,2>{0.32706064f, 0.230025649f},
-std::array<float,2>{0.0228150915f, 0.633763313f},
-std::array<float,2>{0.975683033f, 0.148538664f},
-std::array<float,2>{0.749002278f, 0.775150001f},
-std::array<float,2>{0.253452659f, 0.44554171f},
-std::array<float,2>{0.380190462f, 0.965823889f},
-std::array<float,2>{0.500080347f, 0.266598642f},
-std::array<float,2>{0.778940558f, 0.50944829f},
-std::array<float,2>{0.129083797f, 0.113337815f},
-std::array<float,2>{0.313060462f, 0.613681436f},
-std::array<float,2>{0.682863474f, 0.0616525337f},
-std::array<float,2>{0.903727949f, 0.912663221f},
-std::array<float,2>{0.0978379846f, 0.337041885f},
-std::array<float,2>{0.190195858f, 0.81995827f},
-std::array<float,2>{0.837783635f, 0.423181564f},
-std::array<float,2>{0.58698833f, 0.69038564f},
-std::array<float,2>{0.479259282f, 0.191930845f},
-std::array<float,2>{0.186687484f, 0.535255194f},
-std::array<float,2>{0.787109077f, 0.0725053325f},
-std::array<float,2>{0.540225506f, 0.98088789f},
-std::array<float,2>{0.434421837f, 0.294989705f},
-std::array<float,2>{0.295941055f, 0.79987359f},
-std::array<float,2>{0.701840222f, 0.478631228f},
-std::array<float,2>{0.953839719f, 0.684507728f},
-std::array<float,2>{0.0341402777f, 0.17774196f},
-std::array<float,2>{0.461537063f, 0.739180148f},
-std::array<float,2>{0.618014574f, 0.219123527f},
-std::array<float,2>{0.855795681f, 0.852032065f},
-std::array<float,2>{0.236517936f, 0.388407499f},
-std::array<float,2>{0.0635792613f, 0.885333836f},
-std::array<float,2>{0.929089963f, 0.346370995f},
-std::array<float,2>{0.636381447f, 0.585713804f},
-std::array<float,2>{0.344914407f, 0.0140808681f},
-std::array<float,2>{0.117374822f, 0.563013434f},
-std::array<float,2>{0.879830778f, 0.018693639f},
-std::array<float,2>{0.662774265f, 0.901535571f},
-std::array<float,2>{0.341130763f, 0.373260558f},
-std::array<float,2>{0.491467863f, 0.865737736f},
-std::array<float,2>{0.575156212f, 0.390765339f},
-std::array<float,2>{0.822682738f, 0.719767451f},
-std::array<float,2>{0.216013223f, 0.247323424f},
-std::array<float,2>{0.26586175f, 0.656497061f},
-std::array<float,2>{0.725200355f, 0.171747118f},
-std::array<float,2>{0.993250132f, 0.791207552f},
-std::array<float,2>{0.00971950032f, 0.496529758f},
-std::array<float,2>{0.146759793f, 0.994100094f},
-std::array<float,2>{0.751894176f, 0.301573306f},
-std::array<float,2>{0.52969712f, 0.548124552f},
-std::array<float,2>{0.398887843f, 0.0889872015f},
-std::array<float,2>{0.225257605f, 0.717879415f},
-std::array<float,2>{0.869933665f, 0.206893176f},
-std::array<float,2>{0.596691012f, 0.839576483f},
-std::array<float,2>{0.440774471f, 0.408723921f},
-std::array<float,2>{0.361701101f, 0.929551661f},
-std::array<float,2>{0.651330352f, 0.313835889f},
-std::array<float,2>{0.910707951f, 0.608450711f},
-std::array<float,2>{0.0907668993f, 0.0335496217f},
-std::array<float,2>{0.415395468f, 0.52487421f},
-std::array<float,2>{0.549847364f, 0.0999276191f},
-std::array<float,2>{0.800770462f, 0.947742701f},
-std::array<float,2>{0.156859159f, 0.257825881f},
-std::array<float,2>{0.0530526042f, 0.755653977f},
-std::array<float,2>{0.947249472f, 0.461263657f},
-std::array<float,2>{0.716255367f, 0.64176625f},
-std::array<float,2>{0.297218025f, 0.138115346f},
-std::array<float,2>{0.000588106515f, 0.736688912f},
-std::array<float,2>{0.989369512f, 0.224828914f},
-std::array<float,2>{0.730004966f, 0.857625723f},
-std::array<float,2>{0.281226665f, 0.386021376f},
-std::array<float,2>{0.395599008f, 0.887470782f},
-std::array<float,2>{0.523165464f, 0.349405587f},
-std::array<float,2>{0.759276509f, 0.578410447f},
-std::array<float,2>{0.150275558f, 0.0102640232f},
-std::array<float,2>{0.332952857f, 0.532366276f},
-std::array<float,2>{0.669672549f, 0.0771640837f},
-std::array<float,2>{0.884473145f, 0.977213621f},
-std::array<float,2>{0.113158137f, 0.289865106f},
-std::array<float,2>{0.204313025f, 0.802380323f},
-std::array<float,2>{0.818040013f, 0.482213795f},
-std::array<float,2>{0.567289352f, 0.680842221f},
-std::array<float,2>{0.49971661f, 0.172284231f},
-std::array<float,2>{0.164938256f, 0.612533629f},
-std::array<float,2>{0.809895694f, 0.0565397628f},
-std::array<float,2>{0.560546279f, 0.909001648f},
-std::array<float,2>{0.408924162f, 0.343666196f},
-std::array<float,2>{0.306850374f, 0.812943995f},
-std::array<float,2>{0.706892073f, 0.426085293f},
-std::array<float,2>{0.94416815f, 0.693157971f},
-std::array<float,2>{0.062171571f, 0.188324347f},
-std::array<float,2>{0.449264616f, 0.637725115f},
-std::array<float,2>{0.608929932f, 0.152712241f},
-std::array<float,2>{0.861150801f, 0.778738797f},
-std::array<float,2>{0.228150427f, 0.450496346f},
-std::array<float,2>{0.084013626f, 0.962036669f},
-std::array<float,2>{0.917534113f, 0.270572692f},
-std::array<float,2>{0.645638168f, 0.513562322f},
-std::array<float,2>{0.373283416f, 0.111483283f},
-std::array<float,2>{0.108255319f, 0.530342698f},
-std::array<float,2>{0.896037459f, 0.0946191102f},
-std::array<float,2>{0.675761282f, 0.950867474f},
-std::array<float,2>{0.32202673f, 0.262591839f},
-std::array<float,2>{0.471480399f, 0.750749767f},
-std::array<float,2>{0.584835649f, 0.465201408f},
-std::array<float,2>{0.834856689f, 0.644797564f},
-std::array<float,2>{0.197756171f, 0.134543151f},
-std::array<float,2>{0.265174031f, 0.711629987f},
-std::array<float,2>{0.739194393f, 0.207820147f},
-std::array<float,2>{0.983815789f, 0.843427718f},
-std::array<float,2>{0.0240208991f, 0.410823256f},
-std::array<float,2>{0.134357303f, 0.925323784f},
-std::array<float,2>{0.770837665f, 0.317206919f},
-std::array<float,2>{0.513614595f, 0.602510333f},
-std::array<float,2>{0.387692243f, 0.0377097689f},
-std::array<float,2>{0.243898541f, 0.662148714f},
-std::array<float,2>{0.848719001f, 0.167085677f},
-std::array<float,2>{0.613916755f, 0.796721637f},
-std::array<float,2>{0.455123127f, 0.492291451f},
-std::array<float,2>{0.353238523f, 0.99742341f},
-std::array<float,2>{0.625733793f, 0.29975f},
-std::array<float,2>{0.933455169f, 0.55250603f},
-std::array<float,2>{0.0757689625f, 0.0917085409f},
-std::array<float,2>{0.425424367f, 0.568835378f},
-std::array<float,2>{0.531684458f, 0.0222353041f},
-std::array<float,2>{0.796149909f, 0.902551949f},
-std::array<float,2>{0.173797965f, 0.369171441f},
-std::array<float,2>{0.0404711589f, 0.861300349f},
-std::array<float,2>{0.963409305f, 0.396017522f},
-std::array<float,2>{0.693365872f, 0.723795116f},
-std::array<float,2>{0.285048872f, 0.243456975f},
-std::array<float,2>{0.067149587f, 0.65413624f},
-std::array<float,2>{0.922564089f, 0.12543577f},
-std::array<float,2>{0.638791382f, 0.763188779f},
-std::array<float,2>{0.349251568f, 0.455061227f},
-std::array<float,2>{0.466397643f, 0.943589091f},
-std::array<float,2>{0.622422278f, 0.253424168f},
-std::array<float,2>{0.854970872f, 0.51699537f},
-std::array<float,2>{0.241614014f, 0.106903076f},
-std::array<float,2>{0.29189527f, 0.601246297f},
-std::array<float,2>{0.696954489f, 0.0399469435f},
-std::array<float,2>{0.959218562f, 0.933281183f},
-std::array<float,2>{0.0380447321f, 0.324364543f},
-std::array<float,2>{0.181531876f, 0.829366744f},
-std::array<float,2>{0.78204298f, 0.416403502f},
-std::array<float,2>{0.546369374f, 0.704060555f},
-std::array<float,2>{0.432522297f, 0.216291964f},
-std::array<float,2>{0.192765385f, 0.555394948f},
-std::array<float,2>{0.843333781f, 0.0836543664f},
-std::array<float,2>{0.593680382f, 0.98579371f},
-std::array<float,2>{0.482886493f, 0.312426865f},
-std::array<float,2>{0.318604499f, 0.781984448f},
-std::array<float,2>{0.685213029f, 0.491111606f},
-std::array<float,2>{0.900418937f, 0.66535902f},
-std::array<float,2>{0.0958873257f, 0.157179356f},
-std::array<float,2>{0.378383309f, 0.732673705f},
-std::array<float,2>{0.505320668f, 0.236796439f},
-std::array<float,2>{0.774055243f, 0.873500764f},
-std::array<float,2>{0.126287088f, 0.403203011f},
-std::array<float,2>{0.0174483955f, 0.892332315f},
-std::array<float,2>{0.972218871f, 0.362619817f},
-std::array<float,2>{0.742901862f, 0.577072442f},
-std::array<float,2>{0.254415452f, 0.0263776146f},
-std::array<float,2>{0.0507550053f, 0.58795619f},
-std::array<float,2>{0.951479375f, 0.00373312854f},
-std::array<float,2>{0.710975111f, 0.878209591f},
-std::array<float,2>{0.302171707f, 0.357005984f},
-std::array<float,2>{0.418733925f, 0.849568486f},
-std::array<float,2>{0.551949501f, 0.375907898f},
-std::array<float,2>{0.804149687f, 0.747729421f},
-std::array<float,2>{0.160695314f, 0.232946754f},
-std::array<float,2>{0.365528733f, 0.678275049f},
-std::array<float,2>{0.652679384f, 0.182358101f},
-std::array<float,2>{0.907871187f, 0.804842532f},
-std::array<float,2>{0.0897604302f, 0.472957522f},
-std::array<float,2>{0.222314566f, 0.97559011f},
-std::array<float,2>{0.87197876f, 0.283539534f},
-std::array<float,2>{0.59944135f, 0.545798063f},
-std::array<float,2>{0.441916585f, 0.0630543604f},
-std::array<float,2>{0.144029722f, 0.698825836f},
-std::array<float,2>{0.754146099f, 0.199214712f},
-std::array<float,2>{0.526899278f, 0.823499858f},
-std::array<float,2>{0.402534723f, 0.436965793f},
-std::array<float,2>{0.271548569f, 0.920862257f},
-std::array<float,2>{0.721656382f, 0.329355985f},
-std::array<float,2>{0.99944514f, 0.619190156f},
-std::array<float,2>{0.0118945446f, 0.0511705205f},
-std::array<float,2>{0.4868294f, 0.505254149f},
-std::array<float,2>{0.572138548f, 0.120223947f},
-std::array<float,2>{0.82630682f, 0.95752573f},
-std::array<float,2>{0.212088659f, 0.27976504f},
-std::array<float,2>{0.121520445f, 0.772361577f},
-std::array<float,2>{0.878086567f, 0.437679708f},
-std::array<float,2>{0.656579494f, 0.625597835f},
-std::array<float,2>{0.336446136f, 0.143904984f},
-std::array<float,2>{0.114683732f, 0.708197236f},
-std::array<float,2>{0.889049709f, 0.212141812f},
-std::array<float,2>{0.665932059f, 0.833317995f},
-std::array<float,2>{0.329664886f, 0.418852717f},
-std::array<float,2>{0.49347198f, 0.935317278f},
-std::array<float,2>{0.564411879f, 0.323616862f},
-std::array<float,2>{0.814665616f, 0.59659493f},
-std::array<float,2>{0.208420023f, 0.04655388f},
-std::array<float,2>{0.276887506f, 0.519601047f},
-std::array<float,2>{0.732091069f, 0.104098059f},
-std::array<float,2>{0.986080706f, 0.940868914f},
-std::array<float,2>{0.00641702535f, 0.256111234f},
-std::array<float,2>{0.152436778f, 0.761431277f},
-std::array<float,2>{0.763121903f, 0.459779233f},
-std::array<float,2>{0.517051101f, 0.650975823f},
-std::array<float,2>{0.390658736f, 0.129537895f},
-std::array<float,2>{0.231757149f, 0.570533633f},
-std::array<float,2>{0.866437912f, 0.0307577364f},
-std::array<float,2>{0.602978051f, 0.89744556f},
-std::array<float,2>{0.448825032f, 0.366944045f},
-std::array<float,2>{0.367333531f, 0.868762434f},
-std::array<float,2>{0.642493367f, 0.399122179f},
-std::array<float,2>{0.918969214f, 0.729152203f},
-std::array<float,2>{0.0794837698f, 0.239680409f},
-std::array<float,2>{0.413765311f, 0.669157684f},
-std::array<float,2>{0.555030167f, 0.160716757f},
-std::array<float,2>{0.806697488f, 0.785590947f},
-std::array<float,2>{0.169668376f, 0.485966802f},
-std::array<float,2>{0.056442719f, 0.99003458f},
-std::array<float,2>{0.937526703f, 0.30553019f},
-std::array<float,2>{0.709368169f, 0.559428394f},
-std::array<float,2>{0.309098899f, 0.0810362399f},
-std::array<float,2>{0.0309564471f, 0.539135098f},
-std::array<float,2>{0.978606164f, 0.0687886477f},
-std::array<float,2>{0.734972358f, 0.96922636f},
-std::array<float,2>{0.259394139f, 0.286398858f},
-std::array<float,2>{0.386625767f, 0.811906755f},
-std::array<float,2>{0.508402169f, 0.47173968f},
-std::array<float,2>{0.765758336f, 0.674132109f},
-std::array<float,2>{0.138549283f, 0.186156839f},
-std::array<float,2>{0.324880809f, 0.742985189f},
-std::array<float,2>{0.679398835f, 0.227582976f},
-std::array<float,2>{0.892169058f, 0.844816685f},
-std::array<float,2>{0.103927627f, 0.381713271f},
-std::array<float,2>{0.199250415f, 0.882309735f},
-std::array<float,2>{0.83147049f, 0.352605462f},
-std::array<float,2>{0.581809402f, 0.593279183f},
-std::array<float,2>{0.473805279f, 0.00610472774f},
-std::array<float,2>{0.177985415f, 0.629190266f},
-std::array<float,2>{0.790136158f, 0.148277f},
-std::array<float,2>{0.535314858f, 0.769516706f},
-std::array<float,2>{0.428864717f, 0.445197046f},
-std::array<float,2>{0.287105083f, 0.953664482f},
-std::array<float,2>{0.689710259f, 0.277210653f},
-std::array<float,2>{0.968046606f, 0.502675354f},
-std::array<float,2>{0.0438201874f, 0.123662084f},
-std::array<float,2>{0.458086848f, 0.621252537f},
-std::array<float,2>{0.612574756f, 0.0500938557f},
-std::array<float,2>{0.846425951f, 0.916708589f},
-std::array<float,2>{0.247319847f, 0.333801776f},
-std::array<float,2>{0.0733406991f, 0.825006068f},
-std::array<float,2>{0.936858118f, 0.430470467f},
-std::array<float,2>{0.628989697f, 0.699590623f},
-std::array<float,2>{0.356669962f, 0.20232448f},
-std::array<float,2>{0.0313345827f, 0.686232567f},
-std::array<float,2>{0.956536055f, 0.177594751f},
-std::array<float,2>{0.700961351f, 0.796931207f},
-std::array<float,2>{0.294820458f, 0.477946997f},
-std::array<float,2>{0.436495602f, 0.983405113f},
-std::array<float,2>{0.542915583f, 0.294336915f},
-std::array<float,2>{0.787404537f, 0.538990259f},
-std::array<float,2>{0.18415688f, 0.0714876056f},
-std::array<float,2>{0.346144795f, 0.58335197f},
-std::array<float,2>{0.633899748f, 0.0135530224f},
-std::array<float,2>{0.926226377f, 0.884510458f},
-std::array<float,2>{0.0657582805f, 0.344200581f},
-std::array<float,2>{0.235015318f, 0.855058491f},
-std::array<float,2>{0.858672559f, 0.389402419f},
-std::array<float,2>{0.62064147f, 0.7420367f},
-std::array<float,2>{0.464792252f, 0.221680924f},
-std::array<float,2>{0.13264291f, 0.510154009f},
-std::array<float,2>{0.780537248f, 0.116315603f},
-std::array<float,2>{0.501967669f, 0.96810478f},
-std::array<float,2>{0.381014615f, 0.268272191f},
-std::array<float,2>{0.250036925f, 0.776860476f},
-std::array<float,2>{0.747306347f, 0.449165612f},
-std::array<float,2>{0.973672688f, 0.636218786f},
-std::array<float,2>{0.0202569775f, 0.150674403f},
-std::array<float,2>{0.477769107f, 0.689207733f},
-std::array<float,2>{0.588318467f, 0.195158184f},
-std::array<float,2>{0.838406086f, 0.816760659f},
-std::array<float,2>{0.187893644f, 0.425571471f},
-std::array<float,2>{0.0999123752f, 0.910367191f},
-std::array<float,2>{0.905755758f, 0.338318944f},
-std::array<float,2>{0.680687964f, 0.616343319f},
-std::array<float,2>{0.315432519f, 0.0603332445f},
-std::array<float,2>{0.0924614444f, 0.605823278f},
-std::array<float,2>{0.913384557f, 0.0315901823f},
-std::array<float,2>{0.650242329f, 0.92641443f},
-std::array<float,2>{0.361102432f, 0.31630379f},
-std::array<float,2>{0.439260393f, 0.837855697f},
-std::array<float,2>{0.594653189f, 0.407695204f},
-std::array<float,2>{0.867920458f, 0.715812564f},
-std::array<float,2>{0.223702654f, 0.204417884f},
-std::array<float,2>{0.299603671f, 0.64340806f},
-std::array<float,2>{0.718059361f, 0.140156195f},
-std::array<float,2>{0.947449565f, 0.757753372f},
-std::array<float,2>{0.0515181459f, 0.46325618f},
-std::array<float,2>{0.160055161f, 0.947006643f},
-std::array<float,2>{0.797937751f, 0.260987878f},
-std::array<float,2>{0.548365414f, 0.527257085f},
-std::array<float,2>{0.417478621f, 0.0990758315f},
-std::array<float,2>{0.218390033f, 0.721787572f},
-std::array<float,2>{0.82073009f, 0.249598846f},
-std::array<float,2>{0.57684052f, 0.864909887f},
-std::array<float,2>{0.489360958f, 0.39386785f},
-std::array<float,2>{0.343579054f, 0.8994416f},
-std::array<float,2>{0.661539853f, 0.371741861f},
-std::array<float,2>{0.881392062f, 0.56470716f},
-std::array<float,2>{0.119455174f, 0.0162182841f},
-std::array<float,2>{0.400425643f, 0.54937458f},
-std::array<float,2>{0.527644038f, 0.086539574f},
-std::array<float,2>{0.753547907f, 0.994317412f},
-std::array<float,2>{0.144753277f, 0.303423494f},
-std::array<float,2>{0.0105007794f, 0.789259911f},
-std::array<float,2>{0.995302677f, 0.499566972f},
-std::array<float,2>{0.723095f, 0.659655035f},
-std::array<float,2>{0.267656744f, 0.168043405f},
-std::array<float,2>{0.0483383909f, 0.747266173f},
-std::array<float,2>{0.9493168f, 0.2326933f},
-std::array<float,2>{0.714770079f, 0.848972976f},
-std::array<float,2>{0.304351956f, 0.375087947f},
-std::array<float,2>{0.421491206f, 0.87870276f},
-std::array<float,2>{0.552928925f, 0.356627464f},
-std::array<float,2>{0.802054405f, 0.588620901f},
-std::array<float,2>{0.163719609f, 0.00337955635f},
-std::array<float,2>{0.363917291f, 0.544971824f},
-std::array<float,2>{0.655618072f, 0.062926583f},
-std::array<float,2>{0.909075141f, 0.976399183f},
-std::array<float,2>{0.0865365937f, 0.283750683f},
-std::array<float,2>{0.220140129f, 0.805563927f},
-std::array<float,2>{0.874862492f, 0.473489255f},
-std::array<float,2>{0.600464523f, 0.67784512f},
-std::array<float,2>{0.444498092f, 0.181742132f},
-std::array<float,2>{0.140705913f, 0.619671106f},
-std::array<float,2>{0.75666225f, 0.0515112989f},
-std::array<float,2>{0.523501039f, 0.920249522f},
-std::array<float,2>{0.406070054f, 0.330073714f},
-std::array<float,2>{0.270203263f, 0.824179947f},
-std::array<float,2>{0.718952656f, 0.437135309f},
-std::array<float,2>{0.996872663f, 0.698423743f},
-std::array<float,2>{0.0154950088f, 0.198390454f},
-std::array<float,2>{0.486099124f, 0.625037074f},
-std::array<float,2>{0.573820531f, 0.144452572f},
-std::array<float,2>{0.825048149f, 0.771524549f},
-std::array<float,2>{0.214004681f, 0.438042402f},
-std::array<float,2>{0.12448632f, 0.957481205f},
-std::array<float,2>{0.875733078f, 0.279872954f},
-std::array<float,2>{0.658884704f, 0.505492866f},
-std::array<float,2>{0.339794576f, 0.120849892f},
-std::array<float,2>{0.0695573166f, 0.517445803f},
-std::array<float,2>{0.925640285f, 0.107350878f},
-std::array<float,2>{0.637093604f, 0.944097638f},
-std::array<float,2>{0.350857675f, 0.253162146f},
-std::array<float,2>{0.468054652f, 0.762818813f},
-std::array<float,2>{0.62375772f, 0.454524189f},
-std::array<float,2>{0.852303147f, 0.653579533f},
-std::array<float,2>{0.23993583f, 0.125759616f},
-std::array<float,2>{0.290120125f, 0.703337371f},
-std::array<float,2>{0.698016107f, 0.216524601f},
-std::array<float,2>{0.957804799f, 0.829909205f},
-std::array<float,2>{0.0364127345f, 0.416691869f},
-std::array<float,2>{0.18323411f, 0.932980001f},
-std::array<float,2>{0.784060657f, 0.324964166f},
-std::array<float,2>{0.543834567f, 0.601005375f},
-std::array<float,2>{0.431153655f, 0.0393189639f},
-std::array<float,2>{0.194359869f, 0.665712833f},
-std::array<float,2>{0.84141463f, 0.156531751f},
-std::array<float,2>{0.590089262f, 0.781671941f},
-std::array<float,2>{0.480667949f, 0.490305752f},
-std::array<float,2>{0.318175733f, 0.98587352f},
-std::array<float,2>{0.687409997f, 0.311590135f},
-std::array<float,2>{0.900006652f, 0.554830492f},
-std::array<float,2>{0.0952692628f, 0.0832720697f},
-std::array<float,2>{0.376918316f, 0.57630527f},
-std::array<float,2>{0.507335722f, 0.0272037033f},
-std::array<float,2>{0.776187599f, 0.891782701f},
-std::array<float,2>{0.127278939f, 0.363143474f},
-std::array<float,2>{0.0181992725f, 0.873823047f},
-std::array<float,2>{0.969670713f, 0.402664334f},
-std::array<float,2>{0.744603574f, 0.733115733f},
-std::array<float,2>{0.256918252f, 0.237235546f},
-std::array<float,2>{0.106794186f, 0.645436347f},
-std::array<float,2>{0.89798975f, 0.133876011f},
-std::array<float,2>{0.673205256f, 0.750164986f},
-std::array<float,2>{0.322829336f, 0.465754092f},
-std::array<float,2>{0.469749182f, 0.950217724f},
-std::array<float,2>{0.583190084f, 0.262187004f},
-std::array<float,2>{0.832773209f, 0.530866444f},
-std::array<float,2>{0.196120217f, 0.0937530175f},
-std::array<float,2>{0.26303786f, 0.601590157f},
-std::array<float,2>{0.741125524f, 0.0371888727f},
-std::array<float,2>{0.980894387f, 0.925269008f},
-std::array<float,2>{0.0263999216f, 0.316661805f},
-std::array<float,2>{0.134978056f, 0.842952132f},
-std::array<float,2>{0.772397757f, 0.410271555f},
-std::array<float,2>{0.514370263f, 0.711418569f},
-std::array<float,2>{0.39058888f, 0.207359239f},
-std::array<float,2>{0.245449916f, 0.552173793f},
-std::array<float,2>{0.851535797f, 0.0911430269f},
-std::array<float,2>{0.616228878f, 0.997839451f},
-std::array<float,2>{0.453955024f, 0.299171895f},
-std::array<float,2>{0.353812933f, 0.796234667f},
-std::array<float,2>{0.62862283f, 0.4929308f},
-std::array<float,2>{0.930078983f, 0.66279f},
-std::array<float,2>{0.0767340437f, 0.167866349f},
-std::array<float,2>{0.422844172f, 0.724226594f},
-std::array<float,2>{0.533668697f, 0.243703842f},
-std::array<float,2>{0.793786407f, 0.860352755f},
-std::array<float,2>{0.174481377f, 0.395597756f},
-std::array<float,2>{0.041380994f, 0.902896464f},
-std::array<float,2>{0.962133646f, 0.369969189f},
-std::array<float,2>{0.692421913f, 0.569321334f},
-std::array<float,2>{0.282389045f, 0.0217447095f},
-std::array<float,2>{0.00246433099f, 0.578939617f},
-std::array<float,2>{0.99059093f, 0.00987059157f},
-std::array<float,2>{0.727465928f, 0.886953771f},
-std::array<float,2>{0.278180689f, 0.348946273f},
-std::array<float,2>{0.396933198f, 0.858066559f},
-std::array<float,2>{0.520742238f, 0.386305988f},
-std::array<float,2>{0.75981766f, 0.737299562f},
-std::array<float,2>{0.151597649f, 0.225272208f},
-std::array<float,2>{0.335843444f, 0.681288004f},
-std::array<float,2>{0.671152771f, 0.172800899f},
-std::array<float,2>{0.886014819f, 0.802033663f},
-std::array<float,2>{0.110509396f, 0.481461912f},
-std::array<float,2>{0.206020549f, 0.976742446f},
-std::array<float,2>{0.818952739f, 0.289141893f},
-std::array<float,2>{0.569827795f, 0.532861769f},
-std::array<float,2>{0.496116668f, 0.0776410475f},
-std::array<float,2>{0.167499736f, 0.692741871f},
-std::array<float,2>{0.811023891f, 0.187577352f},
-std::array<float,2>{0.56249702f, 0.813366532f},
-std::array<float,2>{0.406769484f, 0.426355273f},
-std::array<float,2>{0.304893315f, 0.908451319f},
-std::array<float,2>{0.704034328f, 0.342781782f},
-std::array<float,2>{0.941780686f, 0.613222003f},
-std::array<float,2>{0.0591366775f, 0.0558169f},
-std::array<float,2>{0.45214504f, 0.512808263f},
-std::array<float,2>{0.605600774f, 0.111978084f},
-std::array<float,2>{0.862318635f, 0.962721527f},
-std::array<float,2>{0.230232909f, 0.271359473f},
-std::array<float,2>{0.083699435f, 0.778989553f},
-std::array<float,2>{0.915824771f, 0.451166242f},
-std::array<float,2>{0.647277772f, 0.638572335f},
-std::array<float,2>{0.373039782f, 0.15300253f},
-std::array<float,2>{0.0898862183f, 0.714938819f},
-std::array<float,2>{0.910641015f, 0.204630673f},
-std::array<float,2>{0.650743127f, 0.837014854f},
-std::array<float,2>{0.362055242f, 0.40787077f},
-std::array<float,2>{0.441335917f, 0.925914228f},
-std::array<float,2>{0.597391069f, 0.31548807f},
-std::array<float,2>{0.869146705f, 0.606381714f},
-std::array<float,2>{0.22463797f, 0.0319498293f},
-std::array<float,2>{0.297542453f, 0.526599407f},
-std::array<float,2>{0.716516614f, 0.0994249955f},
-std::array<float,2>{0.946641862f, 0.946720958f},
-std::array<float,2>{0.0533652678f, 0.26146701f},
-std::array<float,2>{0.156722188f, 0.757113934f},
-std::array<float,2>{0.80001992f, 0.463624299f},
-std::array<float,2>{0.550444067f, 0.642991662f},
-std::array<float,2>{0.415927023f, 0.140055239f},
-std::array<float,2>{0.216484815f, 0.565091193f},
-std::array<float,2>{0.822796047f, 0.0161116496f},
-std::array<float,2>{0.574524879f, 0.900216341f},
-std::array<float,2>{0.491928458f, 0.371505618f},
-std::array<float,2>{0.341358274f, 0.864496291f},
-std::array<float,2>{0.662169278f, 0.394415438f},
-std::array<float,2>{0.879070699f, 0.722465873f},
-std::array<float,2>{0.118053421f, 0.249113277f},
-std::array<float,2>{0.399223298f, 0.659775317f},
-std::array<float,2>{0.529815555f, 0.16852133f},
-std::array<float,2>{0.751457334f, 0.789839089f},
-std::array<float,2>{0.147205129f, 0.499264747f},
-std::array<float,2>{0.00884511601f, 0.994874895f},
-std::array<float,2>{0.993653357f, 0.302793652f},
-std::array<float,2>{0.724760234f, 0.549244165f},
-std::array<float,2>{0.266533554f, 0.0860634223f},
-std::array<float,2>{0.03342022f, 0.538412511f},
-std::array<float,2>{0.953591287f, 0.072116971f},
-std::array<float,2>{0.701454282f, 0.98419863f},
-std::array<float,2>{0.29649955f, 0.294529229f},
-std::array<float,2>{0.433698744f, 0.797679365f},
-std::array<float,2>{0.541014671f, 0.478509843f},
-std::array<float,2>{0.786304891f, 0.685826838f},
-std::array<float,2>{0.1875f, 0.177108198f},
-std::array<float,2>{0.345527589f, 0.74121654f},
-std::array<float,2>{0.635911465f, 0.22227332f},
-std::array<float,2>{0.92947638f, 0.85463047f},
-std::array<float,2>{0.0642378926f, 0.38883841f},
-std::array<float,2>{0.236831307f, 0.883957565f},
-std::array<float,2>{0.856364667f, 0.344360799f},
-std::array<float,2>{0.617574096f, 0.583514214f},
-std::array<float,2>{0.461034447f, 0.0127876103f},
-std::array<float,2>{0.129648343f, 0.636458218f},
-std::array<float,2>{0.778746665f, 0.150990456f},
-std::array<float,2>{0.500743926f, 0.776375294f},
-std::array<float,2>{0.380693793f, 0.44851464f},
-std::array<float,2>{0.253222078f, 0.968538105f},
-std::array<float,2>{0.748284698f, 0.26769504f},
-std::array<float,2>{0.976123691f, 0.510724306f},
-std::array<float,2>{0.0234137625f, 0.116935782f},
-std::array<float,2>{0.478742659f, 0.617093503f},
-std::array<float,2>{0.587595284f, 0.0596756451f},
-std::array<float,2>{0.837161779f, 0.911074281f},
-std::array<float,2>{0.189540625f, 0.338434368f},
-std::array<float,2>{0.0983489975f, 0.817092478f},
-std::array<float,2>{0.904172659f, 0.425235569f},
-std::array<float,2>{0.683390439f, 0.688780844f},
-std::array<float,2>{0.312912405f, 0.194778919f},
-std::array<float,2>{0.0276734959f, 0.674328625f},
-std::array<float,2>{0.977917254f, 0.185998946f},
-std::array<float,2>{0.738077641f, 0.812476099f},
-std::array<float,2>{0.260704517f, 0.472197741f},
-std::array<float,2>{0.383853942f, 0.969580889f},
-std::array<float,2>{0.510223627f, 0.286909938f},
-std::array<float,2>{0.767608166f, 0.539653003f},
-std::array<float,2>{0.140177444f, 0.0689184517f},
-std::array<float,2>{0.326221794f, 0.592827499f},
-std::array<float,2>{0.675879717f, 0.00643237913f},
-std::array<float,2>{0.892836571f, 0.882417977f},
-std::array<float,2>{0.102868386f, 0.353355825f},
-std::array<float,2>{0.201464891f, 0.845488489f},
-std::array<float,2>{0.828190207f, 0.381077886f},
-std::array<float,2>{0.579229295f, 0.742417157f},
-std::array<float,2>{0.47641331f, 0.228134423f},
-std::array<float,2>{0.177210093f, 0.50239867f},
-std::array<float,2>{0.791530848f, 0.12307708f},
-std::array<float,2>{0.538363814f, 0.953509331f},
-std::array<float,2>{0.425955206f, 0.276641726f},
-std::array<float,2>{0.287656188f, 0.768992305f},
-std::array<float,2>{0.688971281f, 0.444365203f},
-std::array<float,2>{0.966482878f, 0.62961787f},
-std::array<float,2>{0.0464024097f, 0.147604778f},
-std::array<float,2>{0.459563106f, 0.699797153f},
-std::array<float,2>{0.609973073f, 0.203093678f},
-std::array<float,2>{0.845553696f, 0.82429719f},
-std::array<float,2>{0.249772742f, 0.429882884f},
-std::array<float,2>{0.0704615563f, 0.916280329f},
-std::array<float,2>{0.934656799f, 0.333374947f},
-std::array<float,2>{0.631229877f, 0.621703267f},
-std::array<float,2>{0.357791841f, 0.050363414f},
-std::array<float,2>{0.117005192f, 0.596054673f},
-std::array<float,2>{0.888082623f, 0.0462766252f},
-std::array<float,2>{0.666414618f, 0.93477267f},
-std::array<float,2>{0.330828995f, 0.324100524f},
-std::array<float,2>{0.495373309f, 0.833874404f},
-std::array<float,2>{0.566089332f, 0.418354303f},
-std::array<float,2>{0.812880397f, 0.708619118f},
-std::array<float,2>{0.210428938f, 0.212713629f},
-std::array<float,2>{0.274970412f, 0.650453746f},
-std::array<float,2>{0.7327618f, 0.128919333f},
-std::array<float,2>{0.986400008f, 0.76090169f},
-std::array<float,2>{0.00397265097f, 0.459128201f},
-std::array<float,2>{0.154454842f, 0.941316903f},
-std::array<float,2>{0.765408754f, 0.25677672f},
-std::array<float,2>{0.517762125f, 0.52003032f},
-std::array<float,2>{0.394415617f, 0.103785224f},
-std::array<float,2>{0.233651191f, 0.728798449f},
-std::array<float,2>{0.864177465f, 0.24018836f},
-std::array<float,2>{0.604793489f, 0.868297279f},
-std::array<float,2>{0.44663775f, 0.39853996f},
-std::array<float,2>{0.369872838f, 0.896489799f},
-std::array<float,2>{0.643253744f, 0.366479188f},
-std::array<float,2>{0.92133075f, 0.571039796f},
-std::array<float,2>{0.0819678307f, 0.0308138058f},
-std::array<float,2>{0.4105694f, 0.558740318f},
-std::array<float,2>{0.557047129f, 0.0802088827f},
-std::array<float,2>{0.8047418f, 0.98941642f},
-std::array<float,2>{0.171190903f, 0.304823577f},
-std::array<float,2>{0.057137996f, 0.785880625f},
-std::array<float,2>{0.939657211f, 0.485470057f},
-std::array<float,2>{0.707080722f, 0.669770896f},
-std::array<float,2>{0.312134355f, 0.160287216f},
-std::array<float,2>{0.0123159634f, 0.697203696f},
-std::array<float,2>{0.999774635f, 0.197097495f},
-std::array<float,2>{0.721104383f, 0.82206291f},
-std::array<float,2>{0.272157043f, 0.433624566f},
-std::array<float,2>{0.403093278f, 0.919328272f},
-std::array<float,2>{0.526584327f, 0.331030667f},
-std::array<float,2>{0.754453361f, 0.618575394f},
-std::array<float,2>{0.144420281f, 0.0538759641f},
-std::array<float,2>{0.336325437f, 0.507490218f},
-std::array<float,2>{0.657055616f, 0.117285691f},
-std::array<float,2>{0.878839731f, 0.960636377f},
-std::array<float,2>{0.121750347f, 0.278825104f},
-std::array<float,2>{0.212423325f, 0.771267533f},
-std::array<float,2>{0.826875389f, 0.44010812f},
-std::array<float,2>{0.571497023f, 0.627827108f},
-std::array<float,2>{0.486355186f, 0.14214398f},
-std::array<float,2>{0.160544276f, 0.586232603f},
-std::array<float,2>{0.804432034f, 0.0014018605f},
-std::array<float,2>{0.552460372f, 0.875164032f},
-std::array<float,2>{0.418049902f, 0.358191639f},
-std::array<float,2>{0.302431881f, 0.850432634f},
-std::array<float,2>{0.711599529f, 0.378625333f},
-std::array<float,2>{0.951860845f, 0.749789178f},
-std::array<float,2>{0.0499852933f, 0.230671808f},
-std::array<float,2>{0.441830993f, 0.677498102f},
-std::array<float,2>{0.598795235f, 0.180094019f},
-std::array<float,2>{0.871214211f, 0.806981504f},
-std::array<float,2>{0.22175312f, 0.474877685f},
-std::array<float,2>{0.0892185196f, 0.973793745f},
-std::array<float,2>{0.907616079f, 0.283050656f},
-std::array<float,2>{0.653126001f, 0.544483721f},
-std::array<float,2>{0.365946025f, 0.0654600412f},
-std::array<float,2>{0.09667252f, 0.556811392f},
-std::array<float,2>{0.900906324f, 0.0857853293f},
-std::array<float,2>{0.684972644f, 0.987957239f},
-std::array<float,2>{0.319329351f, 0.309146672f},
-std::array<float,2>{0.483257622f, 0.783944547f},
-std::array<float,2>{0.593005657f, 0.489430338f},
-std::array<float,2>{0.843163908f, 0.667188644f},
-std::array<float,2>{0.193068102f, 0.160004884f},
-std::array<float,2>{0.254032999f, 0.731073737f},
-std::array<float,2>{0.742455125f, 0.235611573f},
-std::array<float,2>{0.972102284f, 0.871946394f},
-std::array<float,2>{0.0170533862f, 0.405581743f},
-std::array<float,2>{0.126595289f, 0.894390047f},
-std::array<float,2>{0.773887813f, 0.359498501f},
-std::array<float,2>{0.50573355f, 0.575701296f},
-std::array<float,2>{0.378630966f, 0.0242125951f},
-std::array<float,2>{0.242070898f, 0.65477556f},
-std::array<float,2>{0.855185032f, 0.127304673f},
-std::array<float,2>{0.622864664f, 0.764343798f},
-std::array<float,2>{0.466012627f, 0.456294507f},
-std::array<float,2>{0.348864883f, 0.942730486f},
-std::array<float,2>{0.639516294f, 0.250461876f},
-std::array<float,2>{0.922010779f, 0.51765877f},
-std::array<float,2>{0.0666261911f, 0.108928956f},
-std::array<float,2>{0.432040423f, 0.598706663f},
-std::array<float,2>{0.54673636f, 0.042746976f},
-std::array<float,2>{0.781269133f, 0.931002617f},
-std::array<float,2>{0.180915028f, 0.327786267f},
-std::array<float,2>{0.0375172533f, 0.830718875f},
-std::array<float,2>{0.959666491f, 0.415106773f},
-std::array<float,2>{0.696361005f, 0.706716299f},
-std::array<float,2>{0.29124701f, 0.217328161f},
-std::array<float,2>{0.075601548f, 0.661273599f},
-std::array<float,2>{0.933037341f, 0.16513215f},
-std::array<float,2>{0.625459671f, 0.794664681f},
-std::array<float,2>{0.352733314f, 0.495407313f},
-std::array<float,2>{0.455566496f, 0.998739958f},
-std::array<float,2>{0.613709986f, 0.298495382f},
-std::array<float,2>{0.849412262f, 0.553282976f},
-std::array<float,2>{0.243418276f, 0.0923256874f},
-std::array<float,2>{0.284195572f, 0.566537678f},
-std::array<float,2>{0.693959713f, 0.0203762501f},
-std::array<float,2>{0.962987721f, 0.906230509f},
-std::array<float,2>{0.0406917222f, 0.367773443f},
-std::array<float,2>{0.173074841f, 0.862229168f},
-std::array<float,2>{0.796500206f, 0.398231804f},
-std::array<float,2>{0.531875372f, 0.725640178f},
-std::array<float,2>{0.425225735f, 0.245300248f},
-std::array<float,2>{0.197289497f, 0.527502954f},
-std::array<float,2>{0.834008753f, 0.0972096324f},
-std::array<float,2>{0.584255815f, 0.951795757f},
-std::array<float,2>{0.470831543f, 0.26389268f},
-std::array<float,2>{0.321524471f, 0.752816796f},
-std::array<float,2>{0.674874902f, 0.468374789f},
-std::array<float,2>{0.895603061f, 0.648388565f},
-std::array<float,2>{0.107517347f, 0.136139512f},
-std::array<float,2>{0.386799276f, 0.713783681f},
-std::array<float,2>{0.513100445f, 0.209640652f},
-std::array<float,2>{0.771302104f, 0.840121746f},
-std::array<float,2>{0.133929431f, 0.413407266f},
-std::array<float,2>{0.0238283072f, 0.923175454f},
-std::array<float,2>{0.984110534f, 0.31935367f},
-std::array<float,2>{0.738500416f, 0.604003727f},
-std::array<float,2>{0.264781058f, 0.0357278809f},
-std::array<float,2>{0.0619765297f, 0.610313118f},
-std::array<float,2>{0.943533361f, 0.0576796271f},
-std::array<float,2>{0.706363499f, 0.906647861f},
-std::array<float,2>{0.307150096f, 0.341081381f},
-std::array<float,2>{0.408411294f, 0.814797103f},
-std::array<float,2>{0.560055852f, 0.429446012f},
-std::array<float,2>{0.810539067f, 0.694548726f},
-std::array<float,2>{0.164454386f, 0.190756693f},
-std::array<float,2>{0.373585284f, 0.639147997f},
-std::array<float,2>{0.646472812f, 0.154725507f},
-std::array<float,2>{0.917110443f, 0.779856265f},
-std::array<float,2>{0.0849062204f, 0.451431751f},
-std::array<float,2>{0.227971345f, 0.963346481f},
-std::array<float,2>{0.860353231f, 0.271554261f},
-std::array<float,2>{0.608521998f, 0.513882101f},
-std::array<float,2>{0.44974032f, 0.110829435f},
-std::array<float,2>{0.149610862f, 0.734764516f},
-std::array<float,2>{0.759450436f, 0.224316388f},
-std::array<float,2>{0.522831976f, 0.856170654f},
-std::array<float,2>{0.396234483f, 0.38346988f},
-std::array<float,2>{0.280557871f, 0.889449239f},
-std::array<float,2>{0.729726672f, 0.349836349f},
-std::array<float,2>{0.990031004f, 0.580166638f},
-std::array<float,2>{0.000448995299f, 0.00883873459f},
-std::array<float,2>{0.499217242f, 0.534659982f},
-std::array<float,2>{0.566552103f, 0.0756311864f},
-std::array<float,2>{0.817631304f, 0.979860067f},
-std::array<float,2>{0.204948321f, 0.292118311f},
-std::array<float,2>{0.112455837f, 0.803572893f},
-std::array<float,2>{0.884088993f, 0.482631505f},
-std::array<float,2>{0.669045091f, 0.682783067f},
-std::array<float,2>{0.332145303f, 0.17416127f},
-std::array<float,2>{0.119965337f, 0.720526159f},
-std::array<float,2>{0.881303191f, 0.247732058f},
-std::array<float,2>{0.661806464f, 0.865340352f},
-std::array<float,2>{0.343199193f, 0.391186655f},
-std::array<float,2>{0.490002662f, 0.901910543f},
-std::array<float,2>{0.576305032f, 0.373882681f},
-std::array<float,2>{0.820982575f, 0.562592924f},
-std::array<float,2>{0.21810168f, 0.0193656851f},
-std::array<float,2>{0.26850751f, 0.54850471f},
-std::array<float,2>{0.723444104f, 0.0896871611f},
-std::array<float,2>{0.99578017f, 0.993626893f},
-std::array<float,2>{0.00996068399f, 0.301188946f},
-std::array<float,2>{0.145395279f, 0.791580319f},
-std::array<float,2>{0.753359139f, 0.496798813f},
-std::array<float,2>{0.527941406f, 0.657109082f},
-std::array<float,2>{0.401246637f, 0.170941398f},
-std::array<float,2>{0.224558756f, 0.609156013f},
-std::array<float,2>{0.86767298f, 0.033845488f},
-std::array<float,2>{0.59417367f, 0.929188967f},
-std::array<float,2>{0.438669533f, 0.314426214f},
-std::array<float,2>{0.360838801f, 0.839051068f},
-std::array<float,2>{0.649463475f, 0.408523828f},
-std::array<float,2>{0.913594246f, 0.71843648f},
-std::array<float,2>{0.0922729373f, 0.206428573f},
-std::array<float,2>{0.417656332f, 0.642188191f},
-std::array<float,2>{0.548107088f, 0.138487369f},
-std::array<float,2>{0.79865998f, 0.755121946f},
-std::array<float,2>{0.159276068f, 0.461632133f},
-std::array<float,2>{0.0509208851f, 0.948006034f},
-std::array<float,2>{0.947931349f, 0.25845778f},
-std::array<float,2>{0.718456089f, 0.525067151f},
-std::array<float,2>{0.299169749f, 0.100561425f},
-std::array<float,2>{0.0198573843f, 0.509265304f},
-std::array<float,2>{0.974193394f, 0.11410971f},
-std::array<float,2>{0.747950852f, 0.966454327f},
-std::array<float,2>{0.250642061f, 0.265890807f},
-std::array<float,2>{0.381614f, 0.774581015f},
-std::array<float,2>{0.502918124f, 0.446140677f},
-std::array<float,2>{0.780929446f, 0.633074999f},
-std::array<float,2>{0.132098898f, 0.149406672f},
-std::array<float,2>{0.316044748f, 0.68956542f},
-std::array<float,2>{0.681515694f, 0.191671744f},
-std::array<float,2>{0.905901015f, 0.819534242f},
-std::array<float,2>{0.10050837f, 0.423694342f},
-std::array<float,2>{0.188073292f, 0.912508667f},
-std::array<float,2>{0.838182032f, 0.337612659f},
-std::array<float,2>{0.588712633f, 0.614226162f},
-std::array<float,2>{0.478038967f, 0.0621498488f},
-std::array<float,2>{0.183698326f, 0.683791697f},
-std::array<float,2>{0.787916422f, 0.178710252f},
-std::array<float,2>{0.542089462f, 0.800434828f},
-std::array<float,2>{0.435818166f, 0.479296148f},
-std::array<float,2>{0.294038802f, 0.981299162f},
-std::array<float,2>{0.700676203f, 0.295448631f},
-std::array<float,2>{0.956895232f, 0.536115885f},
-std::array<float,2>{0.0319663361f, 0.0728022903f},
-std::array<float,2>{0.463935941f, 0.585401714f},
-std::array<float,2>{0.620371878f, 0.0141627155f},
-std::array<float,2>{0.859207392f, 0.885078549f},
-std::array<float,2>{0.234790862f, 0.345974743f},
-std::array<float,2>{0.0661529526f, 0.852264762f},
-std::array<float,2>{0.926339746f, 0.388139039f},
-std::array<float,2>{0.634698987f, 0.738661528f},
-std::array<float,2>{0.346316993f, 0.219592527f},
-std::array<float,2>{0.0433136746f, 0.632261336f},
-std::array<float,2>{0.968699098f, 0.14495796f},
-std::array<float,2>{0.690394342f, 0.767512441f},
-std::array<float,2>{0.286385626f, 0.443306595f},
-std::array<float,2>{0.429359049f, 0.956655204f},
-std::array<float,2>{0.535966456f, 0.273765057f},
-std::array<float,2>{0.791014969f, 0.500311017f},
-std::array<float,2>{0.17830734f, 0.122408375f},
-std::array<float,2>{0.357140958f, 0.624326587f},
-std::array<float,2>{0.629474223f, 0.0479878299f},
-std::array<float,2>{0.937353075f, 0.915281951f},
-std::array<float,2>{0.0740825385f, 0.334866047f},
-std::array<float,2>{0.247908041f, 0.827573717f},
-std::array<float,2>{0.845946848f, 0.432505369f},
-std::array<float,2>{0.612965643f, 0.702503741f},
-std::array<float,2>{0.458739281f, 0.199227765f},
-std::array<float,2>{0.137698501f, 0.541343212f},
-std::array<float,2>{0.766131043f, 0.0669069067f},
-std::array<float,2>{0.507992983f, 0.971128583f},
-std::array<float,2>{0.385986328f, 0.28834635f},
-std::array<float,2>{0.258835286f, 0.810428202f},
-std::array<float,2>{0.734775722f, 0.4703587f},
-std::array<float,2>{0.979395926f, 0.672550857f},
-std::array<float,2>{0.0302934814f, 0.184538722f},
-std::array<float,2>{0.474359035f, 0.744490087f},
-std::array<float,2>{0.581417561f, 0.2297723f},
-std::array<float,2>{0.83165735f, 0.846932232f},
-std::array<float,2>{0.200142726f, 0.379909664f},
-std::array<float,2>{0.104286976f, 0.880674779f},
-std::array<float,2>{0.892021894f, 0.353793472f},
-std::array<float,2>{0.678965509f, 0.591707945f},
-std::array<float,2>{0.324657649f, 0.00529652881f},
-std::array<float,2>{0.0796111375f, 0.573024452f},
-std::array<float,2>{0.919915676f, 0.0274138637f},
-std::array<float,2>{0.642026961f, 0.896057844f},
-std::array<float,2>{0.36803925f, 0.363398373f},
-std::array<float,2>{0.448377222f, 0.869427502f},
-std::array<float,2>{0.603339434f, 0.400712252f},
-std::array<float,2>{0.866857946f, 0.727781892f},
-std::array<float,2>{0.232289687f, 0.241445437f},
-std::array<float,2>{0.308667421f, 0.669975817f},
-std::array<float,2>{0.709673047f, 0.16231139f},
-std::array<float,2>{0.938212156f, 0.788238227f},
-std::array<float,2>{0.0561274588f, 0.486803561f},
-std::array<float,2>{0.169285148f, 0.991890132f},
-std::array<float,2>{0.807458937f, 0.307010263f},
-std::array<float,2>{0.555545568f, 0.561341941f},
-std::array<float,2>{0.413197577f, 0.0790782869f},
-std::array<float,2>{0.208883882f, 0.709493101f},
-std::array<float,2>{0.815191269f, 0.213845864f},
-std::array<float,2>{0.563783348f, 0.835790098f},
-std::array<float,2>{0.493805856f, 0.420540035f},
-std::array<float,2>{0.329485744f, 0.935894489f},
-std::array<float,2>{0.66517818f, 0.321868956f},
-std::array<float,2>{0.889269173f, 0.593860507f},
-std::array<float,2>{0.11514321f, 0.0438198783f},
-std::array<float,2>{0.391146034f, 0.522800505f},
-std::array<float,2>{0.517264426f, 0.10323225f},
-std::array<float,2>{0.763212442f, 0.937642038f},
-std::array<float,2>{0.153243065f, 0.255712748f},
-std::array<float,2>{0.00632085977f, 0.758379877f},
-std::array<float,2>{0.985370815f, 0.458083332f},
-std::array<float,2>{0.731879592f, 0.650292337f},
-std::array<float,2>{0.276394606f, 0.131810859f},
-std::array<float,2>{0.0351885147f, 0.705396235f},
-std::array<float,2>{0.958619535f, 0.218087912f},
-std::array<float,2>{0.698325038f, 0.831987083f},
-std::array<float,2>{0.289138198f, 0.415012598f},
-std::array<float,2>{0.430636615f, 0.930566728f},
-std::array<float,2>{0.54449296f, 0.326652855f},
-std::array<float,2>{0.784613192f, 0.598324358f},
-std::array<float,2>{0.182033882f, 0.0419668853f},
-std::array<float,2>{0.349987477f, 0.518945217f},
-std::array<float,2>{0.638117909f, 0.107586987f},
-std::array<float,2>{0.924558878f, 0.941425979f},
-std::array<float,2>{0.0684956089f, 0.25153783f},
-std::array<float,2>{0.238892481f, 0.765191019f},
-std::array<float,2>{0.853296399f, 0.455534011f},
-std::array<float,2>{0.624394f, 0.655352831f},
-std::array<float,2>{0.467392504f, 0.128589362f},
-std::array<float,2>{0.128115326f, 0.574614465f},
-std::array<float,2>{0.777260244f, 0.0253484044f},
-std::array<float,2>{0.50635165f, 0.89341706f},
-std::array<float,2>{0.375098795f, 0.360658646f},
-std::array<float,2>{0.256611407f, 0.872686446f},
-std::array<float,2>{0.745488286f, 0.404863745f},
-std::array<float,2>{0.970419765f, 0.732258022f},
-std::array<float,2>{0.0189236067f, 0.23455146f},
-std::array<float,2>{0.48163867f, 0.66606921f},
-std::array<float,2>{0.591633677f, 0.158225179f},
-std::array<float,2>{0.840637445f, 0.784871459f},
-std::array<float,2>{0.193403259f, 0.488305986f},
-std::array<float,2>{0.0943096206f, 0.986513853f},
-std::array<float,2>{0.898577511f, 0.309945762f},
-std::array<float,2>{0.686251521f, 0.558454037f},
-std::array<float,2>{0.317179292f, 0.0848836601f},
-std::array<float,2>{0.0876724571f, 0.543546736f},
-std::array<float,2>{0.909706056f, 0.0648043826f},
-std::array<float,2>{0.654563665f, 0.97309792f},
-std::array<float,2>{0.364388913f, 0.281861424f},
-std::array<float,2>{0.443756044f, 0.808274448f},
-std::array<float,2>{0.601119816f, 0.476062715f},
-std::array<float,2>{0.873887599f, 0.676624596f},
-std::array<float,2>{0.219298363f, 0.181394517f},
-std::array<float,2>{0.302815348f, 0.748469591f},
-std::array<float,2>{0.713847578f, 0.232363537f},
-std::array<float,2>{0.951160014f, 0.851497531f},
-std::array<float,2>{0.0474533364f, 0.377414614f},
-std::array<float,2>{0.162576362f, 0.876914322f},
-std::array<float,2>{0.800899982f, 0.358464509f},
-std::array<float,2>{0.554234385f, 0.587128997f},
-std::array<float,2>{0.420573145f, 0.000240968729f},
-std::array<float,2>{0.213324472f, 0.628095031f},
-std::array<float,2>{0.826052129f, 0.141253412f},
-std::array<float,2>{0.572567225f, 0.769913256f},
-std::array<float,2>{0.484455645f, 0.440486193f},
-std::array<float,2>{0.338784993f, 0.959374905f},
-std::array<float,2>{0.659299195f, 0.277614474f},
-std::array<float,2>{0.876287103f, 0.506503642f},
-std::array<float,2>{0.123926751f, 0.119058922f},
-std::array<float,2>{0.40433532f, 0.617750287f},
-std::array<float,2>{0.525323808f, 0.0527861007f},
-std::array<float,2>{0.756933093f, 0.918111622f},
-std::array<float,2>{0.141664565f, 0.331365377f},
-std::array<float,2>{0.0142592089f, 0.820698798f},
-std::array<float,2>{0.99775362f, 0.434974641f},
-std::array<float,2>{0.719972968f, 0.695743978f},
-std::array<float,2>{0.270920396f, 0.195382774f},
-std::array<float,2>{0.109898895f, 0.682231605f},
-std::array<float,2>{0.885568619f, 0.175413474f},
-std::array<float,2>{0.670835435f, 0.804498196f},
-std::array<float,2>{0.334803879f, 0.483601183f},
-std::array<float,2>{0.497599185f, 0.97882247f},
-std::array<float,2>{0.569038689f, 0.291227043f},
-std::array<float,2>{0.820153058f, 0.533230305f},
-std::array<float,2>{0.206923515f, 0.0745009258f},
-std::array<float,2>{0.278347284f, 0.581693709f},
-std::array<float,2>{0.728076696f, 0.00800273661f},
-std::array<float,2>{0.991845846f, 0.889755845f},
-std::array<float,2>{0.0030358613f, 0.351457119f},
-std::array<float,2>{0.15130581f, 0.85727942f},
-std::array<float,2>{0.7611866f, 0.384549975f},
-std::array<float,2>{0.520101964f, 0.735849977f},
-std::array<float,2>{0.397570789f, 0.222901583f},
-std::array<float,2>{0.229146004f, 0.515526175f},
-std::array<float,2>{0.861673653f, 0.11017938f},
-std::array<float,2>{0.607297182f, 0.964502454f},
-std::array<float,2>{0.452230215f, 0.272513419f},
-std::array<float,2>{0.372039497f, 0.780826986f},
-std::array<float,2>{0.648262799f, 0.453080416f},
-std::array<float,2>{0.914790928f, 0.640293598f},
-std::array<float,2>{0.0828122795f, 0.156188428f},
-std::array<float,2>{0.407604605f, 0.693612456f},
-std::array<float,2>{0.561149001f, 0.189860523f},
-std::array<float,2>{0.811676681f, 0.815747738f},
-std::array<float,2>{0.166878015f, 0.428474396f},
-std::array<float,2>{0.0599856898f, 0.908111334f},
-std::array<float,2>{0.943202138f, 0.339892626f},
-std::array<float,2>{0.704107285f, 0.61041832f},
-std::array<float,2>{0.306582391f, 0.0567677096f},
-std::array<float,2>{0.0261933524f, 0.60531044f},
-std::array<float,2>{0.982235134f, 0.0365259759f},
-std::array<float,2>{0.74163723f, 0.922196627f},
-std::array<float,2>{0.261812925f, 0.31839785f},
-std::array<float,2>{0.388944507f, 0.841081917f},
-std::array<float,2>{0.514918566f, 0.412237257f},
-std::array<float,2>{0.772862434f, 0.714459062f},
-std::array<float,2>{0.136665955f, 0.210503519f},
-std::array<float,2>{0.323256463f, 0.647141814f},
-std::array<float,2>{0.672821522f, 0.135206312f},
-std::array<float,2>{0.897066176f, 0.753849626f},
-std::array<float,2>{0.105956733f, 0.467102736f},
-std::array<float,2>{0.197190389f, 0.952248573f},
-std::array<float,2>{0.833143711f, 0.265295893f},
-std::array<float,2>{0.58252579f, 0.529186785f},
-std::array<float,2>{0.46931091f, 0.0960941166f},
-std::array<float,2>{0.175473407f, 0.725000978f},
-std::array<float,2>{0.794229209f, 0.244289741f},
-std::array<float,2>{0.534769297f, 0.862706542f},
-std::array<float,2>{0.423771054f, 0.396774799f},
-std::array<float,2>{0.281556904f, 0.90459466f},
-std::array<float,2>{0.691937387f, 0.368266702f},
-std::array<float,2>{0.961531937f, 0.567476749f},
-std::array<float,2>{0.0428714529f, 0.0214802735f},
-std::array<float,2>{0.454504699f, 0.55403614f},
-std::array<float,2>{0.615400434f, 0.0932696164f},
-std::array<float,2>{0.849700451f, 0.999573708f},
-std::array<float,2>{0.244911164f, 0.297647834f},
-std::array<float,2>{0.0777938664f, 0.793416083f},
-std::array<float,2>{0.931139231f, 0.494688064f},
-std::array<float,2>{0.626979828f, 0.661025405f},
-std::array<float,2>{0.354639381f, 0.164162293f},
-std::array<float,2>{0.0631655753f, 0.739800394f},
-std::array<float,2>{0.928709865f, 0.220061749f},
-std::array<float,2>{0.635447621f, 0.853053033f},
-std::array<float,2>{0.344539702f, 0.387272894f},
-std::array<float,2>{0.462127984f, 0.886134207f},
-std::array<float,2>{0.618199229f, 0.346713871f},
-std::array<float,2>{0.856752217f, 0.584644735f},
-std::array<float,2>{0.23785843f, 0.0152625088f},
-std::array<float,2>{0.29518494f, 0.53618753f},
-std::array<float,2>{0.702733576f, 0.0738165006f},
-std::array<float,2>{0.954496861f, 0.982287824f},
-std::array<float,2>{0.0342234075f, 0.296824902f},
-std::array<float,2>{0.185761303f, 0.799723923f},
-std::array<float,2>{0.786116004f, 0.479700148f},
-std::array<float,2>{0.539687514f, 0.684893787f},
-std::array<float,2>{0.435207754f, 0.179173291f},
-std::array<float,2>{0.190956935f, 0.614613891f},
-std::array<float,2>{0.836285233f, 0.0609579012f},
-std::array<float,2>{0.586760521f, 0.913179159f},
-std::array<float,2>{0.480237991f, 0.336486101f},
-std::array<float,2>{0.313908428f, 0.819009006f},
-std::array<float,2>{0.682156444f, 0.422423124f},
-std::array<float,2>{0.902803659f, 0.69092977f},
-std::array<float,2>{0.0993113816f, 0.192981467f},
-std::array<float,2>{0.379742801f, 0.634563446f},
-std::array<float,2>{0.50164336f, 0.150259405f},
-std::array<float,2>{0.777899027f, 0.774292827f},
-std::array<float,2>{0.130155057f, 0.446592063f},
-std::array<float,2>{0.0216244962f, 0.965023696f},
-std::array<float,2>{0.97546041f, 0.267394394f},
-std::array<float,2>{0.749181092f, 0.508624375f},
-std::array<float,2>{0.252242833f, 0.114267908f},
-std::array<float,2>{0.0546242632f, 0.524061024f},
-std::array<float,2>{0.945496142f, 0.101184756f},
-std::array<float,2>{0.715423644f, 0.948308527f},
-std::array<float,2>{0.29832539f, 0.258941114f},
-std::array<float,2>{0.414609522f, 0.75470072f},
-std::array<float,2>{0.549397707f, 0.462883025f},
-std::array<float,2>{0.799561262f, 0.641467392f},
-std::array<float,2>{0.157658771f, 0.136795938f},
-std::array<float,2>{0.362519205f, 0.717510998f},
-std::array<float,2>{0.652341306f, 0.205900714f},
-std::array<float,2>{0.911458135f, 0.838565648f},
-std::array<float,2>{0.0911040008f, 0.410115987f},
-std::array<float,2>{0.226183638f, 0.927924633f},
-std::array<float,2>{0.870867789f, 0.313076407f},
-std::array<float,2>{0.59578383f, 0.60807085f},
-std::array<float,2>{0.4403373f, 0.034523543f},
-std::array<float,2>{0.147881389f, 0.657561362f},
-std::array<float,2>{0.750216603f, 0.170305952f},
-std::array<float,2>{0.530440569f, 0.792128384f},
-std::array<float,2>{0.399680495f, 0.497626156f},
-std::array<float,2>{0.267440736f, 0.992329776f},
-std::array<float,2>{0.726044774f, 0.302208751f},
-std::array<float,2>{0.993094444f, 0.547246039f},
-std::array<float,2>{0.00870939065f, 0.0879277289f},
-std::array<float,2>{0.490285873f, 0.564071417f},
-std::array<float,2>{0.575462639f, 0.0185273122f},
-std::array<float,2>{0.824053168f, 0.901019692f},
-std::array<float,2>{0.214935049f, 0.374859512f},
-std::array<float,2>{0.118570723f, 0.867058814f},
-std::array<float,2>{0.879931748f, 0.392079622f},
-std::array<float,2>{0.664027989f, 0.719160736f},
-std::array<float,2>{0.340603977f, 0.246599898f},
-std::array<float,2>{0.00560652418f, 0.648729205f},
-std::array<float,2>{0.987413049f, 0.132285625f},
-std::array<float,2>{0.734341621f, 0.7590307f},
-std::array<float,2>{0.273724675f, 0.457868874f},
-std::array<float,2>{0.392983407f, 0.938893199f},
-std::array<float,2>{0.519091368f, 0.254328847f},
-std::array<float,2>{0.76455301f, 0.522126853f},
-std::array<float,2>{0.155340016f, 0.101811469f},
-std::array<float,2>{0.331683159f, 0.595412195f},
-std::array<float,2>{0.667735577f, 0.044370506f},
-std::array<float,2>{0.887007833f, 0.936764598f},
-std::array<float,2>{0.115808591f, 0.320926726f},
-std::array<float,2>{0.209546044f, 0.834834576f},
-std::array<float,2>{0.814014137f, 0.421575457f},
-std::array<float,2>{0.564484537f, 0.710259557f},
-std::array<float,2>{0.494245738f, 0.214626729f},
-std::array<float,2>{0.170297369f, 0.561531603f},
-std::array<float,2>{0.806155205f, 0.0793011114f},
-std::array<float,2>{0.558470309f, 0.990436614f},
-std::array<float,2>{0.411748141f, 0.30799228f},
-std::array<float,2>{0.311435312f, 0.787306964f},
-std::array<float,2>{0.708203018f, 0.488098145f},
-std::array<float,2>{0.940514028f, 0.671117604f},
-std::array<float,2>{0.0585827269f, 0.163766935f},
-std::array<float,2>{0.445753157f, 0.726861417f},
-std::array<float,2>{0.603810489f, 0.240576863f},
-std::array<float,2>{0.864717305f, 0.870240927f},
-std::array<float,2>{0.233391494f, 0.40156728f},
-std::array<float,2>{0.0810501501f, 0.895404637f},
-std::array<float,2>{0.920087695f, 0.364332825f},
-std::array<float,2>{0.644289851f, 0.57382828f},
-std::array<float,2>{0.370150745f, 0.0284792539f},
-std::array<float,2>{0.101704545f, 0.590060294f},
-std::array<float,2>{0.894365907f, 0.00428714184f},
-std::array<float,2>{0.676927388f, 0.879531324f},
-std::array<float,2>{0.327629834f, 0.354528278f},
-std::array<float,2>{0.47557202f, 0.84666723f},
-std::array<float,2>{0.578555882f, 0.37978217f},
-std::array<float,2>{0.82970202f, 0.745529532f},
-std::array<float,2>{0.202568069f, 0.229157686f},
-std::array<float,2>{0.260960758f, 0.673645794f},
-std::array<float,2>{0.737002432f, 0.184865236f},
-std::array<float,2>{0.97730571f, 0.809122562f},
-std::array<float,2>{0.0288111567f, 0.469178259f},
-std::array<float,2>{0.139193639f, 0.972152591f},
-std::array<float,2>{0.769189298f, 0.287472874f},
-std::array<float,2>{0.511074722f, 0.542185962f},
-std::array<float,2>{0.382922769f, 0.0679948777f},
-std::array<float,2>{0.24856624f, 0.701180041f},
-std::array<float,2>{0.843901277f, 0.201145455f},
-std::array<float,2>{0.611188889f, 0.826844573f},
-std::array<float,2>{0.460684776f, 0.433491588f},
-std::array<float,2>{0.359253347f, 0.91414398f},
-std::array<float,2>{0.63186872f, 0.335209072f},
-std::array<float,2>{0.93404609f, 0.62372154f},
-std::array<float,2>{0.0713945329f, 0.0470683351f},
-std::array<float,2>{0.427142024f, 0.501679003f},
-std::array<float,2>{0.537480712f, 0.121363133f},
-std::array<float,2>{0.792261064f, 0.955622911f},
-std::array<float,2>{0.176631123f, 0.274889857f},
-std::array<float,2>{0.0451173857f, 0.766549766f},
-std::array<float,2>{0.964865088f, 0.441462338f},
-std::array<float,2>{0.68792522f, 0.631562769f},
-std::array<float,2>{0.288756162f, 0.145567551f},
-std::array<float,2>{0.0165489092f, 0.734091818f},
-std::array<float,2>{0.970730543f, 0.237868965f},
-std::array<float,2>{0.743715107f, 0.874651611f},
-std::array<float,2>{0.255476654f, 0.40333876f},
-std::array<float,2>{0.377089977f, 0.890952885f},
-std::array<float,2>{0.504226685f, 0.362023532f},
-std::array<float,2>{0.774954736f, 0.577197969f},
-std::array<float,2>{0.125899196f, 0.0259448197f},
-std::array<float,2>{0.319428951f, 0.556253016f},
-std::array<float,2>{0.684173346f, 0.0826881006f},
-std::array<float,2>{0.902222157f, 0.984877825f},
-std::array<float,2>{0.0971845835f, 0.310893834f},
-std::array<float,2>{0.191902533f, 0.782487512f},
-std::array<float,2>{0.841870189f, 0.492005408f},
-std::array<float,2>{0.592678726f, 0.664904416f},
-std::array<float,2>{0.483657002f, 0.157348573f},
-std::array<float,2>{0.179790244f, 0.600349545f},
-std::array<float,2>{0.782629609f, 0.0407747515f},
-std::array<float,2>{0.545297861f, 0.931925774f},
-std::array<float,2>{0.433308661f, 0.325665325f},
-std::array<float,2>{0.292742431f, 0.828600526f},
-std::array<float,2>{0.695912659f, 0.417686313f},
-std::array<float,2>{0.960924566f, 0.704440415f},
-std::array<float,2>{0.0383507386f, 0.215734169f},
-std::array<float,2>{0.46560815f, 0.653235495f},
-std::array<float,2>{0.621331215f, 0.126695544f},
-std::array<float,2>{0.854290009f, 0.761891007f},
-std::array<float,2>{0.240237385f, 0.453901142f},
-std::array<float,2>{0.0680832118f, 0.944659412f},
-std::array<float,2>{0.923430622f, 0.252255321f},
-std::array<float,2>{0.640280962f, 0.5158059f},
-std::array<float,2>{0.347827286f, 0.105968028f},
-std::array<float,2>{0.122582048f, 0.504650176f},
-std::array<float,2>{0.877771497f, 0.119982868f},
-std::array<float,2>{0.65747118f, 0.958946586f},
-std::array<float,2>{0.337217897f, 0.280974418f},
-std::array<float,2>{0.48779887f, 0.773045361f},
-std::array<float,2>{0.57040298f, 0.43878907f},
-std::array<float,2>{0.827353299f, 0.626459062f},
-std::array<float,2>{0.211586744f, 0.142678693f},
-std::array<float,2>{0.273026645f, 0.697865367f},
-std::array<float,2>{0.721948028f, 0.198136464f},
-std::array<float,2>{0.998803377f, 0.822779834f},
-std::array<float,2>{0.0127986809f, 0.435660213f},
-std::array<float,2>{0.142755046f, 0.92132163f},
-std::array<float,2>{0.755721152f, 0.328590274f},
-std::array<float,2>{0.525968194f, 0.620511889f},
-std::array<float,2>{0.404184371f, 0.0520392582f},
-std::array<float,2>{0.221608669f, 0.679037631f},
-std::array<float,2>{0.872226119f, 0.182708487f},
-std::array<float,2>{0.59855777f, 0.805965781f},
-std::array<float,2>{0.443356127f, 0.47450164f},
-std::array<float,2>{0.367144406f, 0.975035608f},
-std::array<float,2>{0.653492689f, 0.285020351f},
-std::array<float,2>{0.906542003f, 0.546628833f},
-std::array<float,2>{0.0883455798f, 0.0636806637f},
-std::array<float,2>{0.419478565f, 0.589448452f},
-std::array<float,2>{0.551304877f, 0.00258674985f},
-std::array<float,2>{0.803627908f, 0.877005816f},
-std::array<float,2>{0.161422148f, 0.356321931f},
-std::array<float,2>{0.0495832786f, 0.8483392f},
-std::array<float,2>{0.952291608f, 0.376286387f},
-std::array<float,2>{0.71210742f, 0.746406317f},
-std::array<float,2>{0.301047266f, 0.233603254f},
-std::array<float,2>{0.0851588994f, 0.637133837f},
-std::array<float,2>{0.916842461f, 0.153828859f},
-std::array<float,2>{0.644792318f, 0.777678609f},
-std::array<float,2>{0.374889135f, 0.4500615f},
-std::array<float,2>{0.450764239f, 0.961285889f},
-std::array<float,2>{0.607904613f, 0.26959753f},
-std::array<float,2>{0.859990597f, 0.511813104f},
-std::array<float,2>{0.227514327f, 0.112907946f},
-std::array<float,2>{0.308095455f, 0.612186551f},
-std::array<float,2>{0.705577016f, 0.0552927367f},
-std::array<float,2>{0.945005596f, 0.909277737f},
-std::array<float,2>{0.0610348172f, 0.342413336f},
-std::array<float,2>{0.165701434f, 0.814242661f},
-std::array<float,2>{0.808837831f, 0.427019715f},
-std::array<float,2>{0.558656037f, 0.69154948f},
-std::array<float,2>{0.40921551f, 0.189269274f},
-std::array<float,2>{0.203145862f, 0.532186508f},
-std::array<float,2>{0.816904604f, 0.0766933635f},
-std::array<float,2>{0.567990243f, 0.978273332f},
-std::array<float,2>{0.498450488f, 0.290320694f},
-std::array<float,2>{0.333154112f, 0.800990403f},
-std::array<float,2>{0.668728828f, 0.481170058f},
-std::array<float,2>{0.883626103f, 0.680520236f},
-std::array<float,2>{0.111915804f, 0.173737839f},
-std::array<float,2>{0.394815236f, 0.737472713f},
-std::array<float,2>{0.521563113f, 0.225994438f},
-std::array<float,2>{0.75832355f, 0.858423352f},
-std::array<float,2>{0.14894022f, 0.38530311f},
-std::array<float,2>{0.00180187752f, 0.887815773f},
-std::array<float,2>{0.988955617f, 0.348202229f},
-std::array<float,2>{0.728841364f, 0.579790235f},
-std::array<float,2>{0.279804379f, 0.0109692784f},
-std::array<float,2>{0.0397188216f, 0.569740534f},
-std::array<float,2>{0.96481061f, 0.0228011813f},
-std::array<float,2>{0.695142865f, 0.903428197f},
-std::array<float,2>{0.283394158f, 0.370312542f},
-std::array<float,2>{0.424620688f, 0.859630227f},
-std::array<float,2>{0.532595754f, 0.394575894f},
-std::array<float,2>{0.795314729f, 0.723145962f},
-std::array<float,2>{0.172809303f, 0.24259229f},
-std::array<float,2>{0.352321357f, 0.663258553f},
-std::array<float,2>{0.626525521f, 0.166349828f},
-std::array<float,2>{0.931690991f, 0.795415938f},
-std::array<float,2>{0.0746510923f, 0.494096637f},
-std::array<float,2>{0.242540121f, 0.996773124f},
-std::array<float,2>{0.848462284f, 0.300376087f},
-std::array<float,2>{0.614333987f, 0.551532269f},
-std::array<float,2>{0.456898987f, 0.0907775611f},
-std::array<float,2>{0.133387864f, 0.712391853f},
-std::array<float,2>{0.770349264f, 0.208753839f},
-std::array<float,2>{0.512443185f, 0.842452526f},
-std::array<float,2>{0.388663709f, 0.411729336f},
-std::array<float,2>{0.264462322f, 0.923915327f},
-std::array<float,2>{0.739465415f, 0.317952752f},
-std::array<float,2>{0.983384371f, 0.602706015f},
-std::array<float,2>{0.0246737599f, 0.0388014019f},
-std::array<float,2>{0.472057343f, 0.529528141f},
-std::array<float,2>{0.585597873f, 0.0949828103f},
-std::array<float,2>{0.835784614f, 0.949295521f},
-std::array<float,2>{0.198792681f, 0.262793243f},
-std::array<float,2>{0.109203517f, 0.751609266f},
-std::array<float,2>{0.895471454f, 0.466743797f},
-std::array<float,2>{0.67410481f, 0.645644963f},
-std::array<float,2>{0.320611537f, 0.133758813f},
-std::array<float,2>{0.101178169f, 0.687622786f},
-std::array<float,2>{0.904353023f, 0.193842441f},
-std::array<float,2>{0.680583715f, 0.818137884f},
-std::array<float,2>{0.314872175f, 0.424711257f},
-std::array<float,2>{0.476840883f, 0.911907971f},
-std::array<float,2>{0.589272678f, 0.3393628f},
-std::array<float,2>{0.83979094f, 0.615291655f},
-std::array<float,2>{0.188507944f, 0.0595415719f},
-std::array<float,2>{0.251336187f, 0.511372149f},
-std::array<float,2>{0.746415973f, 0.115506038f},
-std::array<float,2>{0.973172843f, 0.966932952f},
-std::array<float,2>{0.0208529811f, 0.268783301f},
-std::array<float,2>{0.131537184f, 0.77604419f},
-std::array<float,2>{0.780257523f, 0.448163956f},
-std::array<float,2>{0.503772676f, 0.634989202f},
-std::array<float,2>{0.382132769f, 0.151892364f},
-std::array<float,2>{0.235763639f, 0.582132578f},
-std::array<float,2>{0.857805848f, 0.0119178137f},
-std::array<float,2>{0.620072603f, 0.883435607f},
-std::array<float,2>{0.4635939f, 0.344850481f},
-std::array<float,2>{0.346899003f, 0.853586495f},
-std::array<float,2>{0.633704901f, 0.390225679f},
-std::array<float,2>{0.927576184f, 0.740324318f},
-std::array<float,2>{0.065363951f, 0.221183464f},
-std::array<float,2>{0.436640054f, 0.687394977f},
-std::array<float,2>{0.541502118f, 0.176247492f},
-std::array<float,2>{0.788670123f, 0.798662663f},
-std::array<float,2>{0.184765533f, 0.477238655f},
-std::array<float,2>{0.0323138498f, 0.983150303f},
-std::array<float,2>{0.955971241f, 0.293568432f},
-std::array<float,2>{0.699500263f, 0.537187099f},
-std::array<float,2>{0.293806225f, 0.0711416379f},
-std::array<float,2>{0.0113605978f, 0.550722361f},
-std::array<float,2>{0.994144499f, 0.0873735547f},
-std::array<float,2>{0.723918021f, 0.995532513f},
-std::array<float,2>{0.268854856f, 0.304407865f},
-std::array<float,2>{0.402079821f, 0.79027313f},
-std::array<float,2>{0.529085219f, 0.498090416f},
-std::array<float,2>{0.752416253f, 0.658896804f},
-std::array<float,2>{0.146319717f, 0.169792712f},
-std::array<float,2>{0.341965199f, 0.720750391f},
-std::array<float,2>{0.661053538f, 0.248394981f},
-std::array<float,2>{0.882555425f, 0.863669097f},
-std::array<float,2>{0.120149843f, 0.393545777f},
-std::array<float,2>{0.217083618f, 0.898581862f},
-std::array<float,2>{0.822107852f, 0.372930557f},
-std::array<float,2>{0.577508152f, 0.565776527f},
-std::array<float,2>{0.488314033f, 0.0169865526f},
-std::array<float,2>{0.158307582f, 0.644467056f},
-std::array<float,2>{0.797140598f, 0.138875201f},
-std::array<float,2>{0.547742009f, 0.755985141f},
-std::array<float,2>{0.416057944f, 0.46438849f},
-std::array<float,2>{0.299891204f, 0.946257472f},
-std::array<float,2>{0.716884077f, 0.260336161f},
-std::array<float,2>{0.949216127f, 0.525906563f},
-std::array<float,2>{0.0525588505f, 0.0986168832f},
-std::array<float,2>{0.438453823f, 0.607411087f},
-std::array<float,2>{0.594931006f, 0.0324299857f},
-std::array<float,2>{0.86830622f, 0.927623808f},
-std::array<float,2>{0.223029986f, 0.315351337f},
-std::array<float,2>{0.0934878811f, 0.8362692f},
-std::array<float,2>{0.91254735f, 0.407048672f},
-std::array<float,2>{0.648626566f, 0.716422975f},
-std::array<float,2>{0.359572768f, 0.203212902f},
-std::array<float,2>{0.055282522f, 0.668690026f},
-std::array<float,2>{0.938679695f, 0.161421955f},
-std::array<float,2>{0.710857093f, 0.786895692f},
-std::array<float,2>{0.310022771f, 0.484953314f},
-std::array<float,2>{0.412837684f, 0.988849699f},
-std::array<float,2>{0.556543827f, 0.30606547f},
-std::array<float,2>{0.807769895f, 0.560302854f},
-std::array<float,2>{0.168328792f, 0.0812926888f},
-std::array<float,2>{0.368286252f, 0.572015405f},
-std::array<float,2>{0.641458154f, 0.030218523f},
-std::array<float,2>{0.918046176f, 0.898426294f},
-std::array<float,2>{0.0786139369f, 0.365522802f},
-std::array<float,2>{0.230772465f, 0.867636263f},
-std::array<float,2>{0.865495503f, 0.399447918f},
-std::array<float,2>{0.601618111f, 0.729830146f},
-std::array<float,2>{0.448020667f, 0.238733858f},
-std::array<float,2>{0.153581873f, 0.521226585f},
-std::array<float,2>{0.762195766f, 0.104584366f},
-std::array<float,2>{0.515944719f, 0.939590216f},
-std::array<float,2>{0.392132521f, 0.257620037f},
-std::array<float,2>{0.275774419f, 0.759993911f},
-std::array<float,2>{0.73133117f, 0.460046172f},
-std::array<float,2>{0.984424174f, 0.651840031f},
-std::array<float,2>{0.00700909644f, 0.130364552f},
-std::array<float,2>{0.493154079f, 0.707679212f},
-std::array<float,2>{0.562590003f, 0.21110405f},
-std::array<float,2>{0.815598249f, 0.83296597f},
-std::array<float,2>{0.207836434f, 0.419496059f},
-std::array<float,2>{0.114039563f, 0.934562981f},
-std::array<float,2>{0.889906168f, 0.323024064f},
-std::array<float,2>{0.664462328f, 0.597331464f},
-std::array<float,2>{0.328258067f, 0.0454497226f},
-std::array<float,2>{0.072642833f, 0.623044133f},
-std::array<float,2>{0.936087966f, 0.0497954004f},
-std::array<float,2>{0.630800426f, 0.917968392f},
-std::array<float,2>{0.355908275f, 0.332441032f},
-std::array<float,2>{0.457984656f, 0.825971365f},
-std::array<float,2>{0.612303615f, 0.430965871f},
-std::array<float,2>{0.847565472f, 0.700507641f},
-std::array<float,2>{0.246951133f, 0.20177339f},
-std::array<float,2>{0.285523504f, 0.630376756f},
-std::array<float,2>{0.690884233f, 0.14665775f},
-std::array<float,2>{0.96732837f, 0.768402815f},
-std::array<float,2>{0.0444653407f, 0.444261283f},
-std::array<float,2>{0.17897138f, 0.954845488f},
-std::array<float,2>{0.789225996f, 0.27614063f},
-std::array<float,2>{0.53622365f, 0.503661156f},
-std::array<float,2>{0.428083301f, 0.124966256f},
-std::array<float,2>{0.200336501f, 0.743923485f},
-std::array<float,2>{0.830899f, 0.227412462f},
-std::array<float,2>{0.580237448f, 0.844329655f},
-std::array<float,2>{0.473523259f, 0.382435858f},
-std::array<float,2>{0.325560778f, 0.881062865f},
-std::array<float,2>{0.678436041f, 0.352479279f},
-std::array<float,2>{0.890788674f, 0.59223038f},
-std::array<float,2>{0.104749195f, 0.0075400318f},
-std::array<float,2>{0.385281295f, 0.540193498f},
-std::array<float,2>{0.508891582f, 0.0698522031f},
-std::array<float,2>{0.76692307f, 0.96977669f},
-std::array<float,2>{0.137162849f, 0.285948724f},
-std::array<float,2>{0.0293198172f, 0.811082184f},
-std::array<float,2>{0.979761899f, 0.470763505f},
-std::array<float,2>{0.735864282f, 0.675062358f},
-std::array<float,2>{0.258705676f, 0.186565697f},
-std::array<float,2>{0.0566543266f, 0.729607821f},
-std::array<float,2>{0.940099061f, 0.238344803f},
-std::array<float,2>{0.707593381f, 0.867391586f},
-std::array<float,2>{0.311756998f, 0.399718881f},
-std::array<float,2>{0.410806358f, 0.898075938f},
-std::array<float,2>{0.557262897f, 0.365395367f},
-std::array<float,2>{0.805663824f, 0.572103024f},
-std::array<float,2>{0.171703592f, 0.0299078207f},
-std::array<float,2>{0.369431734f, 0.560241282f},
-std::array<float,2>{0.642813563f, 0.0813859999f},
-std::array<float,2>{0.921806812f, 0.989243329f},
-std::array<float,2>{0.0814488679f, 0.305771321f},
-std::array<float,2>{0.233955756f, 0.78666687f},
-std::array<float,2>{0.863385022f, 0.485232711f},
-std::array<float,2>{0.604980946f, 0.668862581f},
-std::array<float,2>{0.446834505f, 0.161152691f},
-std::array<float,2>{0.15522784f, 0.5975281f},
-std::array<float,2>{0.76489687f, 0.0457463115f},
-std::array<float,2>{0.51843822f, 0.934300959f},
-std::array<float,2>{0.39376536f, 0.322823912f},
-std::array<float,2>{0.274462312f, 0.832748115f},
-std::array<float,2>{0.732976615f, 0.41970098f},
-std::array<float,2>{0.987009525f, 0.707764149f},
-std::array<float,2>{0.00459332112f, 0.211257979f},
-std::array<float,2>{0.496017098f, 0.651456535f},
-std::array<float,2>{0.565666199f, 0.129915014f},
-std::array<float,2>{0.813245118f, 0.760075569f},
-std::array<float,2>{0.210936069f, 0.460355371f},
-std::array<float,2>{0.116536163f, 0.939915597f},
-std::array<float,2>{0.888479292f, 0.257398874f},
-std::array<float,2>{0.666576028f, 0.521274865f},
-std::array<float,2>{0.330521017f, 0.104763001f},
-std::array<float,2>{0.0709579214f, 0.503709316f},
-std::array<float,2>{0.935353696f, 0.124626949f},
-std::array<float,2>{0.631766319f, 0.954701841f},
-std::array<float,2>{0.358070165f, 0.275904477f},
-std::array<float,2>{0.459213644f, 0.768304169f},
-std::array<float,2>{0.609554172f, 0.44399488f},
-std::array<float,2>{0.844848096f, 0.630695105f},
-std::array<float,2>{0.249398068f, 0.146760389f},
-std::array<float,2>{0.2871629f, 0.700359523f},
-std::array<float,2>{0.688501298f, 0.201960221f},
-std::array<float,2>{0.96622771f, 0.825684249f},
-std::array<float,2>{0.0462066345f, 0.430900961f},
-std::array<float,2>{0.1774887f, 0.917485058f},
-std::array<float,2>{0.791257322f, 0.332241684f},
-std::array<float,2>{0.53897512f, 0.622794211f},
-std::array<float,2>{0.426498443f, 0.0493657142f},
-std::array<float,2>{0.201884374f, 0.674908936f},
-std::array<float,2>{0.828851163f, 0.186910838f},
-std::array<float,2>{0.579940319f, 0.811367214f},
-std::array<float,2>{0.475754648f, 0.471057922f},
-std::array<float,2>{0.326885998f, 0.970113456f},
-std::array<float,2>{0.676433861f, 0.285871446f},
-std::array<float,2>{0.893350124f, 0.540492654f},
-std::array<float,2>{0.103187174f, 0.0702602863f},
-std::array<float,2>{0.38446039f, 0.591873348f},
-std::array<float,2>{0.510662377f, 0.00776081672f},
-std::array<float,2>{0.768523037f, 0.881244004f},
-std::array<float,2>{0.140065297f, 0.352182955f},
-std::array<float,2>{0.0281971209f, 0.84467262f},
-std::array<float,2>{0.978110731f, 0.382655531f},
-std::array<float,2>{0.737749338f, 0.743865669f},
-std::array<float,2>{0.25978291f, 0.227287054f},
-std::array<float,2>{0.09793818f, 0.635246456f},
-std::array<float,2>{0.903562307f, 0.152100205f},
-std::array<float,2>{0.682682395f, 0.776141465f},
-std::array<float,2>{0.313457787f, 0.447816402f},
-std::array<float,2>{0.479163587f, 0.967090666f},
-std::array<float,2>{0.587312758f, 0.268820792f},
-std::array<float,2>{0.837405205f, 0.511602283f},
-std::array<float,2>{0.190165758f, 0.115430944f},
-std::array<float,2>{0.253780246f, 0.615667343f},
-std::array<float,2>{0.748704374f, 0.0592615753f},
-std::array<float,2>{0.975937307f, 0.911838651f},
-std::array<float,2>{0.0225076918f, 0.339711785f},
-std::array<float,2>{0.129348069f, 0.81795752f},
-std::array<float,2>{0.77909261f, 0.424391776f},
-std::array<float,2>{0.500424504f, 0.687904298f},
-std::array<float,2>{0.37989822f, 0.193593591f},
-std::array<float,2>{0.236750364f, 0.537543774f},
-std::array<float,2>{0.855553389f, 0.0709080249f},
-std::array<float,2>{0.617880881f, 0.983247459f},
-std::array<float,2>{0.461747468f, 0.293748498f},
-std::array<float,2>{0.345027089f, 0.798486948f},
-std::array<float,2>{0.636475563f, 0.477469534f},
-std::array<float,2>{0.928774476f, 0.687126696f},
-std::array<float,2>{0.0638670027f, 0.175917149f},
-std::array<float,2>{0.434201658f, 0.740522563f},
-std::array<float,2>{0.540392756f, 0.220865548f},
-std::array<float,2>{0.786749601f, 0.853833318f},
-std::array<float,2>{0.186993942f, 0.390505791f},
-std::array<float,2>{0.0337698199f, 0.883682609f},
-std::array<float,2>{0.954100966f, 0.344994694f},
-std::array<float,2>{0.702124715f, 0.582356572f},
-std::array<float,2>{0.296330899f, 0.0119937481f},
-std::array<float,2>{0.00931898411f, 0.565439701f},
-std::array<float,2>{0.993542016f, 0.0167875085f},
-std::array<float,2>{0.725409806f, 0.898857176f},
-std::array<float,2>{0.265878737f, 0.372657269f},
-std::array<float,2>{0.398673058f, 0.86345315f},
-std::array<float,2>{0.529352903f, 0.393085092f},
-std::array<float,2>{0.751555443f, 0.721071661f},
-std::array<float,2>{0.146650568f, 0.248074278f},
-std::array<float,2>{0.34083876f, 0.659073889f},
-std::array<float,2>{0.66291225f, 0.169646069f},
-std::array<float,2>{0.879589558f, 0.790485442f},
-std::array<float,2>{0.117554657f, 0.498388946f},
-std::array<float,2>{0.216186836f, 0.995266199f},
-std::array<float,2>{0.822287023f, 0.304524124f},
-std::array<float,2>{0.574853539f, 0.55030781f},
-std::array<float,2>{0.491443098f, 0.0870434418f},
-std::array<float,2>{0.157126307f, 0.71660912f},
-std::array<float,2>{0.80029422f, 0.203575239f},
-std::array<float,2>{0.550220966f, 0.836058855f},
-std::array<float,2>{0.41510883f, 0.406834871f},
-std::array<float,2>{0.296938926f, 0.927308679f},
-std::array<float,2>{0.715930521f, 0.314990431f},
-std::array<float,2>{0.946850777f, 0.607148886f},
-std::array<float,2>{0.0528191775f, 0.0327081531f},
-std::array<float,2>{0.440664232f, 0.526278496f},
-std::array<float,2>{0.597003102f, 0.0983773544f},
-std::array<float,2>{0.869807124f, 0.945927739f},
-std::array<float,2>{0.225365683f, 0.260541975f},
-std::array<float,2>{0.0905716568f, 0.756337702f},
-std::array<float,2>{0.91106528f, 0.464703053f},
-std::array<float,2>{0.650986135f, 0.644047379f},
-std::array<float,2>{0.361483544f, 0.139024109f},
-std::array<float,2>{0.08310543f, 0.691853821f},
-std::array<float,2>{0.915088117f, 0.189109191f},
-std::array<float,2>{0.646788359f, 0.814171672f},
-std::array<float,2>{0.37239933f, 0.426824063f},
-std::array<float,2>{0.451253176f, 0.90949434f},
-std::array<float,2>{0.606017768f, 0.342625737f},
-std::array<float,2>{0.862836242f, 0.612013996f},
-std::array<float,2>{0.229512393f, 0.0556194782f},
-std::array<float,2>{0.305274546f, 0.512171209f},
-std::array<float,2>{0.703399718f, 0.113230549f},
-std::array<float,2>{0.942378223f, 0.961065888f},
-std::array<float,2>{0.0586331002f, 0.269872576f},
-std::array<float,2>{0.167199969f, 0.777543187f},
-std::array<float,2>{0.811091006f, 0.449948877f},
-std::array<float,2>{0.561544538f, 0.636746526f},
-std::array<float,2>{0.40656805f, 0.15429388f},
-std::array<float,2>{0.205421612f, 0.579958558f},
-std::array<float,2>{0.818667114f, 0.0112151112f},
-std::array<float,2>{0.569631815f, 0.887967587f},
-std::array<float,2>{0.496606827f, 0.348600596f},
-std::array<float,2>{0.335231304f, 0.858745933f},
-std::array<float,2>{0.671637535f, 0.385639995f},
-std::array<float,2>{0.886370003f, 0.737788498f},
-std::array<float,2>{0.11114566f, 0.225586101f},
-std::array<float,2>{0.397425771f, 0.680207253f},
-std::array<float,2>{0.521007955f, 0.173377559f},
-std::array<float,2>{0.760587215f, 0.801094413f},
-std::array<float,2>{0.15229848f, 0.481386602f},
-std::array<float,2>{0.00237756548f, 0.978090107f},
-std::array<float,2>{0.990988791f, 0.290118515f},
-std::array<float,2>{0.726679265f, 0.531864822f},
-std::array<float,2>{0.277730078f, 0.0770704299f},
-std::array<float,2>{0.0419421829f, 0.551296651f},
-std::array<float,2>{0.962528288f, 0.0905104503f},
-std::array<float,2>{0.693351507f, 0.996944785f},
-std::array<float,2>{0.282860816f, 0.300568849f},
-std::array<float,2>{0.422193468f, 0.795827389f},
-std::array<float,2>{0.534040213f, 0.493698597f},
-std::array<float,2>{0.79314512f, 0.663534045f},
-std::array<float,2>{0.173920795f, 0.166163474f},
-std::array<float,2>{0.354208291f, 0.723418653f},
-std::array<float,2>{0.628244698f, 0.242406666f},
-std::array<float,2>{0.930357218f, 0.859575808f},
-std::array<float,2>{0.0766141936f, 0.394988447f},
-std::array<float,2>{0.246070921f, 0.903576732f},
-std::array<float,2>{0.851036072f, 0.370521873f},
-std::array<float,2>{0.616849363f, 0.569421828f},
-std::array<float,2>{0.453336865f, 0.0225843769f},
-std::array<float,2>{0.135424495f, 0.645764649f},
-std::array<float,2>{0.77197051f, 0.13348873f},
-std::array<float,2>{0.513886154f, 0.751721144f},
-std::array<float,2>{0.390037566f, 0.466357619f},
-std::array<float,2>{0.263476789f, 0.949513078f},
-std::array<float,2>{0.740425885f, 0.262998164f},
-std::array<float,2>{0.981250226f, 0.529784918f},
-std::array<float,2>{0.026999535f, 0.0948395878f},
-std::array<float,2>{0.470487833f, 0.602956593f},
-std::array<float,2>{0.583847046f, 0.0389489569f},
-std::array<float,2>{0.832298815f, 0.924284041f},
-std::array<float,2>{0.195337549f, 0.318218797f},
-std::array<float,2>{0.107040823f, 0.84260267f},
-std::array<float,2>{0.897913814f, 0.411914319f},
-std::array<float,2>{0.673684418f, 0.711992562f},
-std::array<float,2>{0.322279006f, 0.208639711f},
-std::array<float,2>{0.0176618323f, 0.664567053f},
-std::array<float,2>{0.968905032f, 0.157702297f},
-std::array<float,2>{0.744773448f, 0.782250464f},
-std::array<float,2>{0.257459313f, 0.491873533f},
-std::array<float,2>{0.376046807f, 0.985248744f},
-std::array<float,2>{0.507017434f, 0.310617387f},
-std::array<float,2>{0.775401652f, 0.556621492f},
-std::array<float,2>{0.127677634f, 0.0828681737f},
-std::array<float,2>{0.317459196f, 0.577514112f},
-std::array<float,2>{0.686833203f, 0.0263568889f},
-std::array<float,2>{0.89975822f, 0.89082092f},
-std::array<float,2>{0.0949200392f, 0.362281889f},
-std::array<float,2>{0.195286587f, 0.874771297f},
-std::array<float,2>{0.841202974f, 0.403782278f},
-std::array<float,2>{0.590747476f, 0.734167039f},
-std::array<float,2>{0.481323242f, 0.238278016f},
-std::array<float,2>{0.183035895f, 0.515869141f},
-std::array<float,2>{0.783217371f, 0.106231064f},
-std::array<float,2>{0.543331087f, 0.944377005f},
-std::array<float,2>{0.430893809f, 0.252088815f},
-std::array<float,2>{0.290558189f, 0.762095213f},
-std::array<float,2>{0.697642028f, 0.453769982f},
-std::array<float,2>{0.957376599f, 0.652917504f},
-std::array<float,2>{0.0368328542f, 0.126840696f},
-std::array<float,2>{0.468640298f, 0.704335272f},
-std::array<float,2>{0.623090923f, 0.215423107f},
-std::array<float,2>{0.851581395f, 0.828315556f},
-std::array<float,2>{0.239341483f, 0.417889655f},
-std::array<float,2>{0.0701378733f, 0.931771457f},
-std::array<float,2>{0.9249295f, 0.32536304f},
-std::array<float,2>{0.637322009f, 0.600310206f},
-std::array<float,2>{0.351354241f, 0.0405911319f},
-std::array<float,2>{0.124792337f, 0.620311499f},
-std::array<float,2>{0.875368297f, 0.0518001057f},
-std::array<float,2>{0.658293188f, 0.921120763f},
-std::array<float,2>{0.338980794f, 0.328318566f},
-std::array<float,2>{0.485595137f, 0.82317549f},
-std::array<float,2>{0.573660254f, 0.435965747f},
-std::array<float,2>{0.824440181f, 0.698122025f},
-std::array<float,2>{0.214692384f, 0.197906822f},
-std::array<float,2>{0.26959762f, 0.626131654f},
-std::array<float,2>{0.719323695f, 0.143009573f},
-std::array<float,2>{0.996290028f, 0.773275852f},
-std::array<float,2>{0.0148466937f, 0.438491285f},
-std::array<float,2>{0.141266957f, 0.958651423f},
-std::array<float,2>{0.756223738f, 0.281139135f},
-std::array<float,2>{0.524258614f, 0.50454253f},
-std::array<float,2>{0.40565452f, 0.119646028f},
-std::array<float,2>{0.220230073f, 0.746146023f},
-std::array<float,2>{0.874492586f, 0.233885944f},
-std::array<float,2>{0.599682391f, 0.848547518f},
-std::array<float,2>{0.444834709f, 0.376045018f},
-std::array<float,2>{0.363578737f, 0.877249181f},
-std::array<float,2>{0.655795813f, 0.356019169f},
-std::array<float,2>{0.90831697f, 0.589702666f},
-std::array<float,2>{0.0863331184f, 0.00269214925f},
-std::array<float,2>{0.421011776f, 0.546730876f},
-std::array<float,2>{0.55338037f, 0.0639617741f},
-std::array<float,2>{0.802555501f, 0.974715233f},
-std::array<float,2>{0.16316098f, 0.284911275f},
-std::array<float,2>{0.0484918617f, 0.805740714f},
-std::array<float,2>{0.950023174f, 0.474162757f},
-std::array<float,2>{0.714133143f, 0.678774714f},
-std::array<float,2>{0.304003f, 0.182972848f},
-std::array<float,2>{0.00682940893f, 0.710051835f},
-std::array<float,2>{0.986147344f, 0.214463398f},
-std::array<float,2>{0.732232451f, 0.83453846f},
-std::array<float,2>{0.277129918f, 0.42179963f},
-std::array<float,2>{0.391000897f, 0.936793745f},
-std::array<float,2>{0.51674211f, 0.321218908f},
-std::array<float,2>{0.76274395f, 0.595558584f},
-std::array<float,2>{0.152642161f, 0.0441193245f},
-std::array<float,2>{0.330038667f, 0.522351742f},
-std::array<float,2>{0.665563285f, 0.101792581f},
-std::array<float,2>{0.888889611f, 0.938575685f},
-std::array<float,2>{0.114421584f, 0.254101157f},
-std::array<float,2>{0.208194926f, 0.75920397f},
-std::array<float,2>{0.814867795f, 0.457521886f},
-std::array<float,2>{0.564092755f, 0.648518264f},
-std::array<float,2>{0.493172705f, 0.131874338f},
-std::array<float,2>{0.169837087f, 0.574108899f},
-std::array<float,2>{0.806968868f, 0.028633846f},
-std::array<float,2>{0.554771304f, 0.895175397f},
-std::array<float,2>{0.41382131f, 0.364602268f},
-std::array<float,2>{0.309363097f, 0.870504081f},
-std::array<float,2>{0.70905602f, 0.401723832f},
-std::array<float,2>{0.937843442f, 0.726670682f},
-std::array<float,2>{0.0561770573f, 0.240272969f},
-std::array<float,2>{0.449060708f, 0.671178281f},
-std::array<float,2>{0.602710724f, 0.164032906f},
-std::array<float,2>{0.866514087f, 0.787512481f},
-std::array<float,2>{0.231464311f, 0.487948895f},
-std::array<float,2>{0.0791065618f, 0.990708947f},
-std::array<float,2>{0.919211864f, 0.307738811f},
-std::array<float,2>{0.642326474f, 0.561874032f},
-std::array<float,2>{0.367459953f, 0.0793491229f},
-std::array<float,2>{0.10355787f, 0.542444527f},
-std::array<float,2>{0.892347634f, 0.0683477446f},
-std::array<float,2>{0.679547131f, 0.97168684f},
-std::array<float,2>{0.325028211f, 0.287241071f},
-std::array<float,2>{0.474087059f, 0.809363008f},
-std::array<float,2>{0.581680834f, 0.468923688f},
-std::array<float,2>{0.831280649f, 0.67340517f},
-std::array<float,2>{0.199603409f, 0.184759334f},
-std::array<float,2>{0.25971213f, 0.745285749f},
-std::array<float,2>{0.73523432f, 0.229417026f},
-std::array<float,2>{0.979003251f, 0.846214771f},
-std::array<float,2>{0.0310363397f, 0.379567415f},
-std::array<float,2>{0.138354212f, 0.87972641f},
-std::array<float,2>{0.766005456f, 0.354790777f},
-std::array<float,2>{0.508690119f, 0.590236604f},
-std::array<float,2>{0.386292279f, 0.00405305903f},
-std::array<float,2>{0.247163549f, 0.631804943f},
-std::array<float,2>{0.846500516f, 0.145778194f},
-std::array<float,2>{0.612455547f, 0.766357124f},
-std::array<float,2>{0.458437234f, 0.441712052f},
-std::array<float,2>{0.356764495f, 0.955909669f},
-std::array<float,2>{0.629170656f, 0.27465418f},
-std::array<float,2>{0.936559319f, 0.501767159f},
-std::array<float,2>{0.073514469f, 0.121187262f},
-std::array<float,2>{0.42916888f, 0.623986959f},
-std::array<float,2>{0.535615325f, 0.0472517423f},
-std::array<float,2>{0.790341973f, 0.914313853f},
-std::array<float,2>{0.177740425f, 0.334976196f},
-std::array<float,2>{0.0436837003f, 0.826964736f},
-std::array<float,2>{0.96789062f, 0.433211297f},
-std::array<float,2>{0.689585626f, 0.701553941f},
-std::array<float,2>{0.286667198f, 0.200714231f},
-std::array<float,2>{0.0655514672f, 0.684697688f},
-std::array<float,2>{0.926015615f, 0.178804412f},
-std::array<float,2>{0.634154141f, 0.799330413f},
-std::array<float,2>{0.345769286f, 0.479745626f},
-std::array<float,2>{0.464546293f, 0.982118607f},
-std::array<float,2>{0.621091008f, 0.296496987f},
-std::array<float,2>{0.858589292f, 0.536428213f},
-std::array<float,2>{0.235225961f, 0.0740190595f},
-std::array<float,2>{0.294441849f, 0.584892929f},
-std::array<float,2>{0.700873256f, 0.0155761875f},
-std::array<float,2>{0.956236362f, 0.885793746f},
-std::array<float,2>{0.0315499268f, 0.347153783f},
-std::array<float,2>{0.184553608f, 0.853354573f},
-std::array<float,2>{0.787138402f, 0.387602597f},
-std::array<float,2>{0.542638481f, 0.740091503f},
-std::array<float,2>{0.436213583f, 0.219902828f},
-std::array<float,2>{0.187501043f, 0.50846684f},
-std::array<float,2>{0.838833332f, 0.114562526f},
-std::array<float,2>{0.587937534f, 0.965286136f},
-std::array<float,2>{0.477887928f, 0.267278343f},
-std::array<float,2>{0.315737665f, 0.773948312f},
-std::array<float,2>{0.681124628f, 0.446427912f},
-std::array<float,2>{0.905452192f, 0.634304225f},
-std::array<float,2>{0.0996585339f, 0.150129497f},
-std::array<float,2>{0.381239951f, 0.69119966f},
-std::array<float,2>{0.50240463f, 0.19329752f},
-std::array<float,2>{0.78046751f, 0.81919533f},
-std::array<float,2>{0.132525951f, 0.422663718f},
-std::array<float,2>{0.0204290245f, 0.913437366f},
-std::array<float,2>{0.973884821f, 0.336721092f},
-std::array<float,2>{0.747323096f, 0.614276052f},
-std::array<float,2>{0.250462979f, 0.0605948716f},
-std::array<float,2>{0.0513837151f, 0.608262956f},
-std::array<float,2>{0.947689772f, 0.0344029032f},
-std::array<float,2>{0.71781677f, 0.928206265f},
-std::array<float,2>{0.299447894f, 0.31343174f},
-std::array<float,2>{0.41711387f, 0.83883512f},
-std::array<float,2>{0.548681855f, 0.409794658f},
-std::array<float,2>{0.798150837f, 0.71761781f},
-std::array<float,2>{0.159747988f, 0.205723315f},
-std::array<float,2>{0.360905468f, 0.641326427f},
-std::array<float,2>{0.650098085f, 0.137128934f},
-std::array<float,2>{0.9131037f, 0.754450381f},
-std::array<float,2>{0.0926392898f, 0.462596536f},
-std::array<float,2>{0.224106982f, 0.94854033f},
-std::array<float,2>{0.867785633f, 0.259141564f},
-std::array<float,2>{0.594471157f, 0.524200261f},
-std::array<float,2>{0.439025581f, 0.101416335f},
-std::array<float,2>{0.1450091f, 0.718863249f},
-std::array<float,2>{0.753720522f, 0.246866718f},
-std::array<float,2>{0.527471006f, 0.866731226f},
-std::array<float,2>{0.400703251f, 0.391669095f},
-std::array<float,2>{0.267915785f, 0.901248157f},
-std::array<float,2>{0.722716033f, 0.374564171f},
-std::array<float,2>{0.995362818f, 0.56424433f},
-std::array<float,2>{0.0104261925f, 0.0181287751f},
-std::array<float,2>{0.489737868f, 0.546999812f},
-std::array<float,2>{0.577016175f, 0.0881503746f},
-std::array<float,2>{0.820474207f, 0.992521107f},
-std::array<float,2>{0.218661979f, 0.301949412f},
-std::array<float,2>{0.119348988f, 0.792417288f},
-std::array<float,2>{0.881609738f, 0.498024762f},
-std::array<float,2>{0.661297381f, 0.657312334f},
-std::array<float,2>{0.343372464f, 0.170143604f},
-std::array<float,2>{0.112938337f, 0.736136734f},
-std::array<float,2>{0.884574175f, 0.222770765f},
-std::array<float,2>{0.669861138f, 0.856959462f},
-std::array<float,2>{0.332695276f, 0.384404004f},
-std::array<float,2>{0.499758482f, 0.889946818f},
-std::array<float,2>{0.567074656f, 0.351079643f},
-std::array<float,2>{0.818193018f, 0.581986725f},
-std::array<float,2>{0.204565033f, 0.0081918668f},
-std::array<float,2>{0.280938327f, 0.53352052f},
-std::array<float,2>{0.730313122f, 0.0743478313f},
-std::array<float,2>{0.989524722f, 0.978695571f},
-std::array<float,2>{0.000809021352f, 0.291265756f},
-std::array<float,2>{0.150098547f, 0.804303825f},
-std::array<float,2>{0.75883323f, 0.483831972f},
-std::array<float,2>{0.523380816f, 0.682567716f},
-std::array<float,2>{0.395926654f, 0.175619289f},
-std::array<float,2>{0.228446901f, 0.610659122f},
-std::array<float,2>{0.860965669f, 0.056936197f},
-std::array<float,2>{0.609348774f, 0.907725513f},
-std::array<float,2>{0.449578881f, 0.340108007f},
-std::array<float,2>{0.373373359f, 0.815494657f},
-std::array<float,2>{0.645844519f, 0.428320676f},
-std::array<float,2>{0.917750478f, 0.693478584f},
-std::array<float,2>{0.0843544975f, 0.189516529f},
-std::array<float,2>{0.409174353f, 0.640451133f},
-std::array<float,2>{0.560066819f, 0.155831441f},
-std::array<float,2>{0.809782684f, 0.781232536f},
-std::array<float,2>{0.164680362f, 0.452766687f},
-std::array<float,2>{0.0623731352f, 0.964693487f},
-std::array<float,2>{0.943973839f, 0.272915453f},
-std::array<float,2>{0.70672667f, 0.5153808f},
-std::array<float,2>{0.307089627f, 0.110080458f},
-std::array<float,2>{0.0243198518f, 0.529048145f},
-std::array<float,2>{0.983493447f, 0.0957063884f},
-std::array<float,2>{0.738905609f, 0.952473104f},
-std::array<float,2>{0.265574574f, 0.265539408f},
-std::array<float,2>{0.387211323f, 0.753466368f},
-std::array<float,2>{0.513290346f, 0.467035621f},
-std::array<float,2>{0.77074635f, 0.647267282f},
-std::array<float,2>{0.134636179f, 0.134780213f},
-std::array<float,2>{0.321886986f, 0.714606822f},
-std::array<float,2>{0.675428212f, 0.210713193f},
-std::array<float,2>{0.896375954f, 0.84096247f},
-std::array<float,2>{0.108036935f, 0.412474483f},
-std::array<float,2>{0.198082715f, 0.922079384f},
-std::array<float,2>{0.834638774f, 0.318670034f},
-std::array<float,2>{0.584544063f, 0.605059445f},
-std::array<float,2>{0.47134009f, 0.0362818688f},
-std::array<float,2>{0.173569366f, 0.660874844f},
-std::array<float,2>{0.79597497f, 0.164475292f},
-std::array<float,2>{0.531382501f, 0.793039978f},
-std::array<float,2>{0.425626248f, 0.494935066f},
-std::array<float,2>{0.284790754f, 0.999965131f},
-std::array<float,2>{0.693665445f, 0.297516018f},
-std::array<float,2>{0.963750958f, 0.55390501f},
-std::array<float,2>{0.0400956348f, 0.0937285423f},
-std::array<float,2>{0.455455959f, 0.567694843f},
-std::array<float,2>{0.614041924f, 0.0210612286f},
-std::array<float,2>{0.848989666f, 0.904374778f},
-std::array<float,2>{0.243888319f, 0.368469089f},
-std::array<float,2>{0.0760664493f, 0.86249882f},
-std::array<float,2>{0.93316108f, 0.396622479f},
-std::array<float,2>{0.62549156f, 0.724761665f},
-std::array<float,2>{0.353513747f, 0.244503781f},
-std::array<float,2>{0.0377398804f, 0.655570686f},
-std::array<float,2>{0.959279299f, 0.128760085f},
-std::array<float,2>{0.697177649f, 0.765578985f},
-std::array<float,2>{0.29165256f, 0.455143183f},
-std::array<float,2>{0.432197303f, 0.9417665f},
-std::array<float,2>{0.54603672f, 0.251789272f},
-std::array<float,2>{0.781815529f, 0.51868391f},
-std::array<float,2>{0.181223422f, 0.107825831f},
-std::array<float,2>{0.349379331f, 0.598525167f},
-std::array<float,2>{0.639020979f, 0.0417284928f},
-std::array<float,2>{0.922813118f, 0.930233896f},
-std::array<float,2>{0.0671157911f, 0.326276153f},
-std::array<float,2>{0.241323411f, 0.83168143f},
-std::array<float,2>{0.85453707f, 0.414599478f},
-std::array<float,2>{0.622196913f, 0.705186963f},
-std::array<float,2>{0.466776609f, 0.217851326f},
-std::array<float,2>{0.126023427f, 0.558191061f},
-std::array<float,2>{0.774179697f, 0.0845855847f},
-std::array<float,2>{0.504899025f, 0.986623824f},
-std::array<float,2>{0.378160834f, 0.309779555f},
-std::array<float,2>{0.254669309f, 0.78494662f},
-std::array<float,2>{0.743137658f, 0.48873952f},
-std::array<float,2>{0.972478867f, 0.666273475f},
-std::array<float,2>{0.0171723012f, 0.158452988f},
-std::array<float,2>{0.482470542f, 0.731997311f},
-std::array<float,2>{0.593284667f, 0.234690517f},
-std::array<float,2>{0.84367609f, 0.873025596f},
-std::array<float,2>{0.192454025f, 0.405176014f},
-std::array<float,2>{0.0961833671f, 0.893160045f},
-std::array<float,2>{0.900792241f, 0.360442519f},
-std::array<float,2>{0.685314238f, 0.57424885f},
-std::array<float,2>{0.318405509f, 0.0250092745f},
-std::array<float,2>{0.0894575417f, 0.587251008f},
-std::array<float,2>{0.908126473f, 0.000353888638f},
-std::array<float,2>{0.652584374f, 0.876621425f},
-std::array<float,2>{0.365447372f, 0.358713657f},
-std::array<float,2>{0.442210466f, 0.851223528f},
-std::array<float,2>{0.599149704f, 0.376995713f},
-std::array<float,2>{0.871738434f, 0.748062253f},
-std::array<float,2>{0.222498432f, 0.232083842f},
-std::array<float,2>{0.301959515f, 0.676288068f},
-std::array<float,2>{0.711351693f, 0.181628168f},
-std::array<float,2>{0.951233983f, 0.808573306f},
-std::array<float,2>{0.0504471213f, 0.475642383f},
-std::array<float,2>{0.160899431f, 0.972658157f},
-std::array<float,2>{0.803782105f, 0.282074213f},
-std::array<float,2>{0.552184105f, 0.543808281f},
-std::array<float,2>{0.418533981f, 0.06457185f},
-std::array<float,2>{0.212219924f, 0.695352793f},
-std::array<float,2>{0.826462805f, 0.195751444f},
-std::array<float,2>{0.571983457f, 0.820358038f},
-std::array<float,2>{0.487282366f, 0.434664488f},
-std::array<float,2>{0.336907625f, 0.918305755f},
-std::array<float,2>{0.656481743f, 0.331056148f},
-std::array<float,2>{0.878257036f, 0.618089378f},
-std::array<float,2>{0.121180423f, 0.0532188974f},
-std::array<float,2>{0.402652681f, 0.506822467f},
-std::array<float,2>{0.527154386f, 0.118656754f},
-std::array<float,2>{0.754300833f, 0.959007025f},
-std::array<float,2>{0.143628746f, 0.277373374f},
-std::array<float,2>{0.0120045608f, 0.769574583f},
-std::array<float,2>{0.999157846f, 0.440700591f},
-std::array<float,2>{0.721421599f, 0.628362656f},
-std::array<float,2>{0.271928161f, 0.141468868f},
-std::array<float,2>{0.0458794422f, 0.702390909f},
-std::array<float,2>{0.965462804f, 0.199626878f},
-std::array<float,2>{0.688050389f, 0.827353418f},
-std::array<float,2>{0.288538307f, 0.432188898f},
-std::array<float,2>{0.42749095f, 0.915493131f},
-std::array<float,2>{0.538053095f, 0.334516317f},
-std::array<float,2>{0.792931616f, 0.624265432f},
-std::array<float,2>{0.175869435f, 0.0481981598f},
-std::array<float,2>{0.358507484f, 0.500125825f},
-std::array<float,2>{0.632387221f, 0.122138582f},
-std::array<float,2>{0.934183419f, 0.956794143f},
-std::array<float,2>{0.0718990788f, 0.273645937f},
-std::array<float,2>{0.248179823f, 0.767156899f},
-std::array<float,2>{0.844266236f, 0.443019956f},
-std::array<float,2>{0.610359967f, 0.632047951f},
-std::array<float,2>{0.460380316f, 0.144627526f},
-std::array<float,2>{0.138812602f, 0.591434062f},
-std::array<float,2>{0.768996477f, 0.00501993392f},
-std::array<float,2>{0.511556625f, 0.880561948f},
-std::array<float,2>{0.383418411f, 0.353646249f},
-std::array<float,2>{0.261414289f, 0.846855402f},
-std::array<float,2>{0.73657614f, 0.380259991f},
-std::array<float,2>{0.976839423f, 0.74428308f},
-std::array<float,2>{0.0287958607f, 0.229724169f},
-std::array<float,2>{0.474795938f, 0.672649384f},
-std::array<float,2>{0.578626513f, 0.184193984f},
-std::array<float,2>{0.829390943f, 0.81009388f},
-std::array<float,2>{0.20284152f, 0.470480055f},
-std::array<float,2>{0.102465652f, 0.970808804f},
-std::array<float,2>{0.893694699f, 0.288135052f},
-std::array<float,2>{0.67758441f, 0.541220427f},
-std::array<float,2>{0.328024834f, 0.067175962f},
-std::array<float,2>{0.0803872645f, 0.561215341f},
-std::array<float,2>{0.920627773f, 0.0786925629f},
-std::array<float,2>{0.643567204f, 0.99216038f},
-std::array<float,2>{0.370643646f, 0.306728065f},
-std::array<float,2>{0.445920199f, 0.788330793f},
-std::array<float,2>{0.604150236f, 0.48640427f},
-std::array<float,2>{0.86512357f, 0.67018801f},
-std::array<float,2>{0.232561111f, 0.162483752f},
-std::array<float,2>{0.310768098f, 0.727857351f},
-std::array<float,2>{0.708665073f, 0.241580918f},
-std::array<float,2>{0.941111445f, 0.869234681f},
-std::array<float,2>{0.0576998815f, 0.400520474f},
-std::array<float,2>{0.170621693f, 0.896323562f},
-std::array<float,2>{0.805831611f, 0.363538295f},
-std::array<float,2>{0.558011234f, 0.572836161f},
-std::array<float,2>{0.411538333f, 0.0277834143f},
-std::array<float,2>{0.209296361f, 0.650132298f},
-std::array<float,2>{0.813525319f, 0.131405219f},
-std::array<float,2>{0.565302014f, 0.758728981f},
-std::array<float,2>{0.494758457f, 0.458276004f},
-std::array<float,2>{0.331262678f, 0.937971294f},
-std::array<float,2>{0.667025626f, 0.255524099f},
-std::array<float,2>{0.887642384f, 0.522581995f},
-std::array<float,2>{0.115566842f, 0.103472747f},
-std::array<float,2>{0.393476695f, 0.594204962f},
-std::array<float,2>{0.518633187f, 0.0436737314f},
-std::array<float,2>{0.764106512f, 0.935644925f},
-std::array<float,2>{0.156236991f, 0.322115511f},
-std::array<float,2>{0.00513837161f, 0.835598111f},
-std::array<float,2>{0.987802684f, 0.420740455f},
-std::array<float,2>{0.733757436f, 0.709831834f},
-std::array<float,2>{0.27440244f, 0.213443756f},
-std::array<float,2>{0.119091161f, 0.65695715f},
-std::array<float,2>{0.880632341f, 0.171337068f},
-std::array<float,2>{0.663460791f, 0.791949213f},
-std::array<float,2>{0.34000361f, 0.496921659f},
-std::array<float,2>{0.49091205f, 0.993319631f},
-std::array<float,2>{0.575716257f, 0.300892502f},
-std::array<float,2>{0.823649585f, 0.548724055f},
-std::array<float,2>{0.215460852f, 0.0893680751f},
-std::array<float,2>{0.266601592f, 0.56293118f},
-std::array<float,2>{0.726097345f, 0.019047996f},
-std::array<float,2>{0.992640018f, 0.902133107f},
-std::array<float,2>{0.00829126686f, 0.373624772f},
-std::array<float,2>{0.148045391f, 0.865482688f},
-std::array<float,2>{0.750967681f, 0.391504288f},
-std::array<float,2>{0.530791223f, 0.720336974f},
-std::array<float,2>{0.400173604f, 0.247865185f},
-std::array<float,2>{0.22584568f, 0.525182426f},
-std::array<float,2>{0.870450616f, 0.100168325f},
-std::array<float,2>{0.596666038f, 0.947772086f},
-std::array<float,2>{0.439784318f, 0.258632541f},
-std::array<float,2>{0.362903535f, 0.755222082f},
-std::array<float,2>{0.651622295f, 0.461896867f},
-std::array<float,2>{0.912045658f, 0.642472386f},
-std::array<float,2>{0.0917095542f, 0.138233528f},
-std::array<float,2>{0.414421231f, 0.718649447f},
-std::array<float,2>{0.548938811f, 0.206226036f},
-std::array<float,2>{0.798958182f, 0.839246273f},
-std::array<float,2>{0.157907903f, 0.408349156f},
-std::array<float,2>{0.0541788712f, 0.92887336f},
-std::array<float,2>{0.946128309f, 0.314172983f},
-std::array<float,2>{0.714872897f, 0.608963668f},
-std::array<float,2>{0.298685968f, 0.0339718238f},
-std::array<float,2>{0.0221149679f, 0.613905549f},
-std::array<float,2>{0.974967957f, 0.0622724742f},
-std::array<float,2>{0.749966443f, 0.912114382f},
-std::array<float,2>{0.252455175f, 0.337858886f},
-std::array<float,2>{0.378983855f, 0.819691837f},
-std::array<float,2>{0.501200378f, 0.423357099f},
-std::array<float,2>{0.777685225f, 0.689904511f},
-std::array<float,2>{0.130670711f, 0.191643685f},
-std::array<float,2>{0.314079762f, 0.632918715f},
-std::array<float,2>{0.681750715f, 0.149143606f},
-std::array<float,2>{0.903107464f, 0.774713695f},
-std::array<float,2>{0.0989673436f, 0.445894808f},
-std::array<float,2>{0.190517426f, 0.966667652f},
-std::array<float,2>{0.83648473f, 0.265750259f},
-std::array<float,2>{0.58604908f, 0.508799732f},
-std::array<float,2>{0.479860455f, 0.11395099f},
-std::array<float,2>{0.186432794f, 0.738470793f},
-std::array<float,2>{0.785441816f, 0.219335109f},
-std::array<float,2>{0.53949219f, 0.852296889f},
-std::array<float,2>{0.435028523f, 0.387757272f},
-std::array<float,2>{0.2957941f, 0.88500011f},
-std::array<float,2>{0.702543616f, 0.345832676f},
-std::array<float,2>{0.954847336f, 0.585045159f},
-std::array<float,2>{0.0351461545f, 0.0144871837f},
-std::array<float,2>{0.462783694f, 0.535663068f},
-std::array<float,2>{0.619037032f, 0.0731645972f},
-std::array<float,2>{0.857347846f, 0.981150627f},
-std::array<float,2>{0.237444699f, 0.295801729f},
-std::array<float,2>{0.0626936406f, 0.800661564f},
-std::array<float,2>{0.927975059f, 0.479042411f},
-std::array<float,2>{0.634833753f, 0.683929443f},
-std::array<float,2>{0.343854696f, 0.17837359f},
-std::array<float,2>{0.0772536844f, 0.726047695f},
-std::array<float,2>{0.93135041f, 0.245482296f},
-std::array<float,2>{0.627617002f, 0.862026751f},
-std::array<float,2>{0.355136096f, 0.397965908f},
-std::array<float,2>{0.454796821f, 0.905914009f},
-std::array<float,2>{0.615999341f, 0.367922425f},
-std::array<float,2>{0.850430071f, 0.566761971f},
-std::array<float,2>{0.244196355f, 0.0202616826f},
-std::array<float,2>{0.282056212f, 0.553481579f},
-std::array<float,2>{0.691506386f, 0.0925572664f},
-std::array<float,2>{0.961384535f, 0.998989761f},
-std::array<float,2>{0.0420292243f, 0.298805416f},
-std::array<float,2>{0.175135985f, 0.794857979f},
-std::array<float,2>{0.794893563f, 0.495309621f},
-std::array<float,2>{0.534405589f, 0.661584139f},
-std::array<float,2>{0.423227459f, 0.16535832f},
-std::array<float,2>{0.196468502f, 0.603734255f},
-std::array<float,2>{0.833858371f, 0.0359641351f},
-std::array<float,2>{0.582496703f, 0.923087955f},
-std::array<float,2>{0.468945771f, 0.319761485f},
-std::array<float,2>{0.324126244f, 0.840036631f},
-std::array<float,2>{0.671982169f, 0.413320452f},
-std::array<float,2>{0.896963835f, 0.713612378f},
-std::array<float,2>{0.106009901f, 0.209721968f},
-std::array<float,2>{0.389467835f, 0.648034394f},
-std::array<float,2>{0.515461385f, 0.135909081f},
-std::array<float,2>{0.77316314f, 0.752493203f},
-std::array<float,2>{0.135834485f, 0.468710303f},
-std::array<float,2>{0.0255406145f, 0.95211792f},
-std::array<float,2>{0.981515169f, 0.263970345f},
-std::array<float,2>{0.741750956f, 0.52779448f},
-std::array<float,2>{0.262333602f, 0.0974241123f},
-std::array<float,2>{0.06006575f, 0.513916969f},
-std::array<float,2>{0.942441523f, 0.110375561f},
-std::array<float,2>{0.704831541f, 0.963086069f},
-std::array<float,2>{0.30581969f, 0.271914899f},
-std::array<float,2>{0.40798378f, 0.78014195f},
-std::array<float,2>{0.560681641f, 0.451176673f},
-std::array<float,2>{0.812140763f, 0.638721943f},
-std::array<float,2>{0.166488647f, 0.154517576f},
-std::array<float,2>{0.371534944f, 0.694779456f},
-std::array<float,2>{0.647628784f, 0.190525249f},
-std::array<float,2>{0.914293528f, 0.814694822f},
-std::array<float,2>{0.0823821053f, 0.42943579f},
-std::array<float,2>{0.229003072f, 0.906468391f},
-std::array<float,2>{0.862157106f, 0.340880424f},
-std::array<float,2>{0.606879115f, 0.610038221f},
-std::array<float,2>{0.452821732f, 0.0579051897f},
-std::array<float,2>{0.150418758f, 0.68290776f},
-std::array<float,2>{0.761387467f, 0.174008682f},
-std::array<float,2>{0.519832611f, 0.803455353f},
-std::array<float,2>{0.39816168f, 0.482902944f},
-std::array<float,2>{0.278986752f, 0.979551315f},
-std::array<float,2>{0.72758013f, 0.292351216f},
-std::array<float,2>{0.991591692f, 0.534325659f},
-std::array<float,2>{0.00343784876f, 0.0752590522f},
-std::array<float,2>{0.497542769f, 0.580466211f},
-std::array<float,2>{0.568704724f, 0.00919360202f},
-std::array<float,2>{0.819343984f, 0.889273405f},
-std::array<float,2>{0.206521988f, 0.350005955f},
-std::array<float,2>{0.109401189f, 0.856384456f},
-std::array<float,2>{0.88522172f, 0.383635223f},
-std::array<float,2>{0.669989049f, 0.73442024f},
-std::array<float,2>{0.33417803f, 0.224559203f},
-std::array<float,2>{0.014035169f, 0.627610266f},
-std::array<float,2>{0.997117758f, 0.14254497f},
-std::array<float,2>{0.720425785f, 0.771136999f},
-std::array<float,2>{0.271389127f, 0.440428406f},
-std::array<float,2>{0.405014545f, 0.960883558f},
-std::array<float,2>{0.524827898f, 0.27921769f},
-std::array<float,2>{0.757756412f, 0.507715821f},
-std::array<float,2>{0.142431796f, 0.117447257f},
-std::array<float,2>{0.338348895f, 0.618165553f},
-std::array<float,2>{0.659912407f, 0.0541275106f},
-std::array<float,2>{0.876611292f, 0.91912657f},
-std::array<float,2>{0.123388f, 0.330770046f},
-std::array<float,2>{0.21363093f, 0.821909666f},
-std::array<float,2>{0.825500727f, 0.433914989f},
-std::array<float,2>{0.572967231f, 0.697013438f},
-std::array<float,2>{0.48513335f, 0.19682771f},
-std::array<float,2>{0.162893087f, 0.544837415f},
-std::array<float,2>{0.801642716f, 0.065776296f},
-std::array<float,2>{0.553813457f, 0.974051893f},
-std::array<float,2>{0.420081288f, 0.282870531f},
-std::array<float,2>{0.303549409f, 0.80678463f},
-std::array<float,2>{0.713209033f, 0.474753946f},
-std::array<float,2>{0.950652242f, 0.677252829f},
-std::array<float,2>{0.0469145514f, 0.179786444f},
-std::array<float,2>{0.444221765f, 0.749534369f},
-std::array<float,2>{0.600993931f, 0.230863824f},
-std::array<float,2>{0.873299003f, 0.850299537f},
-std::array<float,2>{0.219151452f, 0.378818482f},
-std::array<float,2>{0.0873115137f, 0.875411212f},
-std::array<float,2>{0.909187138f, 0.358015269f},
-std::array<float,2>{0.654801905f, 0.586019576f},
-std::array<float,2>{0.364828616f, 0.00119604648f},
-std::array<float,2>{0.0939918831f, 0.576123118f},
-std::array<float,2>{0.899331272f, 0.0240679644f},
-std::array<float,2>{0.685974836f, 0.894201159f},
-std::array<float,2>{0.316735119f, 0.359643161f},
-std::array<float,2>{0.482058018f, 0.871703923f},
-std::array<float,2>{0.590934455f, 0.405303925f},
-std::array<float,2>{0.840136766f, 0.731276155f},
-std::array<float,2>{0.194252446f, 0.235476032f},
-std::array<float,2>{0.2560803f, 0.667377472f},
-std::array<float,2>{0.745692372f, 0.159858868f},
-std::array<float,2>{0.970070958f, 0.783833861f},
-std::array<float,2>{0.0194057506f, 0.489519805f},
-std::array<float,2>{0.12890619f, 0.988232851f},
-std::array<float,2>{0.776493192f, 0.309390277f},
-std::array<float,2>{0.505874991f, 0.556998074f},
-std::array<float,2>{0.375626266f, 0.0856642053f},
-std::array<float,2>{0.238555685f, 0.70702976f},
-std::array<float,2>{0.852795422f, 0.217655897f},
-std::array<float,2>{0.624850273f, 0.830825388f},
-std::array<float,2>{0.467155069f, 0.415511996f},
-std::array<float,2>{0.350222737f, 0.930862904f},
-std::array<float,2>{0.638393939f, 0.328075945f},
-std::array<float,2>{0.924112797f, 0.598879755f},
-std::array<float,2>{0.0688531548f, 0.0426724665f},
-std::array<float,2>{0.429804713f, 0.517825603f},
-std::array<float,2>{0.544303417f, 0.109267838f},
-std::array<float,2>{0.784759462f, 0.942416131f},
-std::array<float,2>{0.182284936f, 0.250212014f},
-std::array<float,2>{0.0356502384f, 0.764588654f},
-std::array<float,2>{0.958187699f, 0.456352055f},
-std::array<float,2>{0.699161887f, 0.65446192f},
-std::array<float,2>{0.289785296f, 0.127173513f},
-std::array<float,2>{0.0299341269f, 0.742510319f},
-std::array<float,2>{0.980150938f, 0.228297576f},
-std::array<float,2>{0.735715985f, 0.84534514f},
-std::array<float,2>{0.257831335f, 0.381204396f},
-std::array<float,2>{0.385237873f, 0.882620513f},
-std::array<float,2>{0.509583414f, 0.353066444f},
-std::array<float,2>{0.767372847f, 0.593102217f},
-std::array<float,2>{0.137689501f, 0.00666238507f},
-std::array<float,2>{0.326132923f, 0.540011764f},
-std::array<float,2>{0.678131163f, 0.0692898333f},
-std::array<float,2>{0.891205072f, 0.969247162f},
-std::array<float,2>{0.105238736f, 0.286831528f},
-std::array<float,2>{0.20082733f, 0.812095165f},
-std::array<float,2>{0.830504119f, 0.472614706f},
-std::array<float,2>{0.581003487f, 0.674580932f},
-std::array<float,2>{0.473067999f, 0.185719118f},
-std::array<float,2>{0.179201588f, 0.622058451f},
-std::array<float,2>{0.789913535f, 0.050687775f},
-std::array<float,2>{0.536645412f, 0.916140735f},
-std::array<float,2>{0.428424418f, 0.333075553f},
-std::array<float,2>{0.285775244f, 0.824551582f},
-std::array<float,2>{0.690982163f, 0.430171132f},
-std::array<float,2>{0.967223406f, 0.700103879f},
-std::array<float,2>{0.0443183519f, 0.202725247f},
-std::array<float,2>{0.457238317f, 0.629850149f},
-std::array<float,2>{0.611430764f, 0.147942707f},
-std::array<float,2>{0.847095788f, 0.768661976f},
-std::array<float,2>{0.246370107f, 0.444822252f},
-std::array<float,2>{0.0728005096f, 0.953334808f},
-std::array<float,2>{0.935665667f, 0.276526779f},
-std::array<float,2>{0.629939914f, 0.502143145f},
-std::array<float,2>{0.356354356f, 0.123393305f},
-std::array<float,2>{0.113566048f, 0.520335793f},
-std::array<float,2>{0.890404701f, 0.103721373f},
-std::array<float,2>{0.664949894f, 0.941110551f},
-std::array<float,2>{0.328892678f, 0.256523579f},
-std::array<float,2>{0.492524445f, 0.760996997f},
-std::array<float,2>{0.563171804f, 0.459370643f},
-std::array<float,2>{0.816003144f, 0.65065515f},
-std::array<float,2>{0.207447752f, 0.129183814f},
-std::array<float,2>{0.275982112f, 0.708829522f},
-std::array<float,2>{0.730850399f, 0.21246253f},
-std::array<float,2>{0.985105872f, 0.833603799f},
-std::array<float,2>{0.00752566755f, 0.418010771f},
-std::array<float,2>{0.15398331f, 0.934937835f},
-std::array<float,2>{0.762421072f, 0.323860973f},
-std::array<float,2>{0.516373813f, 0.595756948f},
-std::array<float,2>{0.392013282f, 0.0460980386f},
-std::array<float,2>{0.231425554f, 0.669503868f},
-std::array<float,2>{0.865725398f, 0.160471007f},
-std::array<float,2>{0.602106512f, 0.785930634f},
-std::array<float,2>{0.447335958f, 0.485791296f},
-std::array<float,2>{0.369075686f, 0.989714205f},
-std::array<float,2>{0.640658319f, 0.304980487f},
-std::array<float,2>{0.918633521f, 0.558899164f},
-std::array<float,2>{0.0782056302f, 0.0805200189f},
-std::array<float,2>{0.412233055f, 0.571255744f},
-std::array<float,2>{0.555678606f, 0.0311380401f},
-std::array<float,2>{0.808342874f, 0.896851182f},
-std::array<float,2>{0.16885592f, 0.366450876f},
-std::array<float,2>{0.0550524853f, 0.868425727f},
-std::array<float,2>{0.93940109f, 0.398889691f},
-std::array<float,2>{0.710137129f, 0.728655398f},
-std::array<float,2>{0.310310662f, 0.239752129f},
-std::array<float,2>{0.0932227001f, 0.642742574f},
-std::array<float,2>{0.912723839f, 0.139650255f},
-std::array<float,2>{0.648984849f, 0.75697124f},
-std::array<float,2>{0.35994485f, 0.463535517f},
-std::array<float,2>{0.437704623f, 0.94631505f},
-std::array<float,2>{0.595447898f, 0.261584461f},
-std::array<float,2>{0.868834794f, 0.526765049f},
-std::array<float,2>{0.223567903f, 0.0991439149f},
-std::array<float,2>{0.300610304f, 0.605971932f},
-std::array<float,2>{0.717738867f, 0.0321910456f},
-std::array<float,2>{0.948558569f, 0.926185071f},
-std::array<float,2>{0.0521187112f, 0.315849274f},
-std::array<float,2>{0.158808917f, 0.837296069f},
-std::array<float,2>{0.797453105f, 0.408060551f},
-std::array<float,2>{0.547130406f, 0.715254724f},
-std::array<float,2>{0.416719824f, 0.204843178f},
-std::array<float,2>{0.217579275f, 0.548974037f},
-std::array<float,2>{0.821496367f, 0.0862945318f},
-std::array<float,2>{0.577986658f, 0.994679272f},
-std::array<float,2>{0.488866657f, 0.303099811f},
-std::array<float,2>{0.342488408f, 0.789764225f},
-std::array<float,2>{0.660531938f, 0.499269187f},
-std::array<float,2>{0.882124901f, 0.660143435f},
-std::array<float,2>{0.120694712f, 0.1688952f},
-std::array<float,2>{0.401771188f, 0.722364902f},
-std::array<float,2>{0.528656542f, 0.249276966f},
-std::array<float,2>{0.752825499f, 0.864509165f},
-std::array<float,2>{0.145930678f, 0.394140631f},
-std::array<float,2>{0.011047096f, 0.900138736f},
-std::array<float,2>{0.994877219f, 0.371236742f},
-std::array<float,2>{0.724165142f, 0.565392017f},
-std::array<float,2>{0.269217759f, 0.0157967508f},
-std::array<float,2>{0.0328275971f, 0.583968878f},
-std::array<float,2>{0.955179572f, 0.0130325146f},
-std::array<float,2>{0.699744105f, 0.884205997f},
-std::array<float,2>{0.293070138f, 0.344493449f},
-std::array<float,2>{0.437373012f, 0.854801714f},
-std::array<float,2>{0.541680038f, 0.38904652f},
-std::array<float,2>{0.788474083f, 0.741575241f},
-std::array<float,2>{0.185331255f, 0.222541839f},
-std::array<float,2>{0.347207874f, 0.685764253f},
-std::array<float,2>{0.633064926f, 0.176887661f},
-std::array<float,2>{0.926920414f, 0.797534585f},
-std::array<float,2>{0.064796634f, 0.478037983f},
-std::array<float,2>{0.236065924f, 0.983948231f},
-std::array<float,2>{0.857958972f, 0.294821709f},
-std::array<float,2>{0.619464278f, 0.538314402f},
-std::array<float,2>{0.463064045f, 0.0718393251f},
-std::array<float,2>{0.131273046f, 0.688572645f},
-std::array<float,2>{0.779589415f, 0.194440275f},
-std::array<float,2>{0.502933085f, 0.817261159f},
-std::array<float,2>{0.382402092f, 0.425024182f},
-std::array<float,2>{0.251693398f, 0.910831869f},
-std::array<float,2>{0.747003615f, 0.338743955f},
-std::array<float,2>{0.973091125f, 0.616725445f},
-std::array<float,2>{0.0210025162f, 0.0599160306f},
-std::array<float,2>{0.477224946f, 0.510330856f},
-std::array<float,2>{0.589606464f, 0.117171869f},
-std::array<float,2>{0.838966846f, 0.968471944f},
-std::array<float,2>{0.189152777f, 0.267990261f},
-std::array<float,2>{0.100771472f, 0.776685655f},
-std::array<float,2>{0.904993653f, 0.44836241f},
-std::array<float,2>{0.679923058f, 0.636550605f},
-std::array<float,2>{0.315100878f, 0.151339412f},
-std::array<float,2>{0.1088221f, 0.711162329f},
-std::array<float,2>{0.89473474f, 0.20721367f},
-std::array<float,2>{0.674691677f, 0.843185842f},
-std::array<float,2>{0.320901215f, 0.410586596f},
-std::array<float,2>{0.47250697f, 0.924988449f},
-std::array<float,2>{0.585024536f, 0.316644162f},
-std::array<float,2>{0.835264564f, 0.60181427f},
-std::array<float,2>{0.198717996f, 0.0375285558f},
-std::array<float,2>{0.263962865f, 0.531241119f},
-std::array<float,2>{0.739995837f, 0.0941041484f},
-std::array<float,2>{0.982465744f, 0.950536191f},
-std::array<float,2>{0.0253432784f, 0.261913985f},
-std::array<float,2>{0.133235857f, 0.750313342f},
-std::array<float,2>{0.769796193f, 0.465339988f},
-std::array<float,2>{0.512170136f, 0.645172954f},
-std::array<float,2>{0.387994975f, 0.134173319f},
-std::array<float,2>{0.243063167f, 0.568887472f},
-std::array<float,2>{0.848132133f, 0.0216767956f},
-std::array<float,2>{0.615101576f, 0.903308511f},
-std::array<float,2>{0.456467271f, 0.369727314f},
-std::array<float,2>{0.351671249f, 0.860724449f},
-std::array<float,2>{0.626401246f, 0.395964801f},
-std::array<float,2>{0.932510078f, 0.724571943f},
-std::array<float,2>{0.0748989955f, 0.243962869f},
-std::array<float,2>{0.424171031f, 0.662930608f},
-std::array<float,2>{0.533112407f, 0.167577043f},
-std::array<float,2>{0.795648396f, 0.796035826f},
-std::array<float,2>{0.172198415f, 0.492902815f},
-std::array<float,2>{0.0392106585f, 0.997747421f},
-std::array<float,2>{0.963910341f, 0.298871428f},
-std::array<float,2>{0.694366395f, 0.551950037f},
-std::array<float,2>{0.283938318f, 0.0909569934f},
-std::array<float,2>{0.00105138368f, 0.533066452f},
-std::array<float,2>{0.98845011f, 0.0779352114f},
-std::array<float,2>{0.729466736f, 0.977000356f},
-std::array<float,2>{0.279584408f, 0.289386749f},
-std::array<float,2>{0.395043939f, 0.801863432f},
-std::array<float,2>{0.522316396f, 0.481925845f},
-std::array<float,2>{0.758168817f, 0.681519747f},
-std::array<float,2>{0.148759991f, 0.172366723f},
-std::array<float,2>{0.333739787f, 0.736999691f},
-std::array<float,2>{0.668020248f, 0.225373089f},
-std::array<float,2>{0.883207917f, 0.858164012f},
-std::array<float,2>{0.111561567f, 0.386649996f},
-std::array<float,2>{0.204085141f, 0.887187481f},
-std::array<float,2>{0.816689372f, 0.348796219f},
-std::array<float,2>{0.567493737f, 0.578619838f},
-std::array<float,2>{0.498767674f, 0.0100846579f},
-std::array<float,2>{0.165329218f, 0.63820219f},
-std::array<float,2>{0.809490621f, 0.153223738f},
-std::array<float,2>{0.559466481f, 0.779114485f},
-std::array<float,2>{0.409873247f, 0.450775653f},
-std::array<float,2>{0.308360159f, 0.962581456f},
-std::array<float,2>{0.705078661f, 0.271203041f},
-std::array<float,2>{0.944724262f, 0.513030887f},
-std::array<float,2>{0.0612131543f, 0.112075731f},
-std::array<float,2>{0.450562239f, 0.612872899f},
-std::array<float,2>{0.6082232f, 0.0561008006f},
-std::array<float,2>{0.85965836f, 0.908221245f},
-std::array<float,2>{0.226774916f, 0.343031436f},
-std::array<float,2>{0.0858351067f, 0.81321913f},
-std::array<float,2>{0.916246057f, 0.426700473f},
-std::array<float,2>{0.645500064f, 0.692532957f},
-std::array<float,2>{0.374414086f, 0.187808007f},
-std::array<float,2>{0.0489647426f, 0.678071439f},
-std::array<float,2>{0.952799797f, 0.181962818f},
-std::array<float,2>{0.712688982f, 0.805350184f},
-std::array<float,2>{0.301357031f, 0.473220646f},
-std::array<float,2>{0.418945372f, 0.976317048f},
-std::array<float,2>{0.550993383f, 0.283959746f},
-std::array<float,2>{0.803188503f, 0.545298994f},
-std::array<float,2>{0.161695138f, 0.0626136512f},
-std::array<float,2>{0.366324395f, 0.588639438f},
-std::array<float,2>{0.653815508f, 0.00301345158f},
-std::array<float,2>{0.907223284f, 0.878459334f},
-std::array<float,2>{0.0888098404f, 0.356862873f},
-std::array<float,2>{0.220996365f, 0.848665714f},
-std::array<float,2>{0.872710705f, 0.375349492f},
-std::array<float,2>{0.597963333f, 0.747423887f},
-std::array<float,2>{0.44279471f, 0.232425243f},
-std::array<float,2>{0.143322825f, 0.505763233f},
-std::array<float,2>{0.754910052f, 0.120782025f},
-std::array<float,2>{0.525663733f, 0.95716399f},
-std::array<float,2>{0.403682977f, 0.280075759f},
-std::array<float,2>{0.272872865f, 0.771831155f},
-std::array<float,2>{0.722571909f, 0.438457072f},
-std::array<float,2>{0.998153627f, 0.625371516f},
-std::array<float,2>{0.013435808f, 0.144167006f},
-std::array<float,2>{0.487742186f, 0.698638499f},
-std::array<float,2>{0.57102114f, 0.198726103f},
-std::array<float,2>{0.828034818f, 0.823789001f},
-std::array<float,2>{0.21132572f, 0.437471747f},
-std::array<float,2>{0.12227504f, 0.920095146f},
-std::array<float,2>{0.877283812f, 0.329613358f},
-std::array<float,2>{0.657938898f, 0.620102644f},
-std::array<float,2>{0.337671727f, 0.0517116413f},
-std::array<float,2>{0.0675774142f, 0.600781083f},
-std::array<float,2>{0.92329973f, 0.0392843261f},
-std::array<float,2>{0.639953554f, 0.932846069f},
-std::array<float,2>{0.348313719f, 0.324911386f},
-std::array<float,2>{0.465282977f, 0.829703212f},
-std::array<float,2>{0.621903062f, 0.416908652f},
-std::array<float,2>{0.853546381f, 0.703507125f},
-std::array<float,2>{0.241120175f, 0.216743276f},
-std::array<float,2>{0.29203406f, 0.653417528f},
-std::array<float,2>{0.695405841f, 0.125515759f},
-std::array<float,2>{0.960121453f, 0.762947977f},
-std::array<float,2>{0.0390374959f, 0.454127043f},
-std::array<float,2>{0.180485114f, 0.944041371f},
-std::array<float,2>{0.782929838f, 0.253395259f},
-std::array<float,2>{0.545649886f, 0.517248094f},
-std::array<float,2>{0.432709813f, 0.106976137f},
-std::array<float,2>{0.191884592f, 0.733343005f},
-std::array<float,2>{0.842612565f, 0.237030402f},
-std::array<float,2>{0.591938734f, 0.873557508f},
-std::array<float,2>{0.484009951f, 0.402404577f},
-std::array<float,2>{0.320091158f, 0.891936421f},
-std::array<float,2>{0.683995962f, 0.362885416f},
-std::array<float,2>{0.901740491f, 0.576530755f},
-std::array<float,2>{0.096765466f, 0.0270088445f},
-std::array<float,2>{0.377700001f, 0.555047035f},
-std::array<float,2>{0.504419386f, 0.0830739513f},
-std::array<float,2>{0.774760425f, 0.986311138f},
-std::array<float,2>{0.12545158f, 0.311995178f},
-std::array<float,2>{0.0158241894f, 0.781442344f},
-std::array<float,2>{0.971535563f, 0.490686059f},
-std::array<float,2>{0.74345094f, 0.665802956f},
-std::array<float,2>{0.25525853f, 0.156346068f},
-std::array<float,2>{0.0345696732f, 0.741703033f},
-std::array<float,2>{0.954157472f, 0.221925825f},
-std::array<float,2>{0.703122497f, 0.855377376f},
-std::array<float,2>{0.295116127f, 0.389613032f},
-std::array<float,2>{0.435351282f, 0.884605289f},
-std::array<float,2>{0.540026784f, 0.343937337f},
-std::array<float,2>{0.785696566f, 0.583037794f},
-std::array<float,2>{0.186003909f, 0.0133071141f},
-std::array<float,2>{0.344311416f, 0.538624942f},
-std::array<float,2>{0.635514081f, 0.0717230514f},
-std::array<float,2>{0.928290427f, 0.983867884f},
-std::array<float,2>{0.0633206666f, 0.294114858f},
-std::array<float,2>{0.238131598f, 0.797143042f},
-std::array<float,2>{0.85654676f, 0.477725476f},
-std::array<float,2>{0.618612111f, 0.686426818f},
-std::array<float,2>{0.4623155f, 0.177268356f},
-std::array<float,2>{0.130028933f, 0.616602004f},
-std::array<float,2>{0.778212011f, 0.0602065362f},
-std::array<float,2>{0.501882255f, 0.910515249f},
-std::array<float,2>{0.379616052f, 0.338007271f},
-std::array<float,2>{0.252038658f, 0.816520929f},
-std::array<float,2>{0.749415696f, 0.425396293f},
-std::array<float,2>{0.975307703f, 0.689389348f},
-std::array<float,2>{0.0218350999f, 0.194893554f},
-std::array<float,2>{0.480039537f, 0.635838687f},
-std::array<float,2>{0.586484492f, 0.150515467f},
-std::array<float,2>{0.836135328f, 0.777250826f},
-std::array<float,2>{0.191391364f, 0.448938817f},
-std::array<float,2>{0.0994498804f, 0.967802584f},
-std::array<float,2>{0.902393162f, 0.268525749f},
-std::array<float,2>{0.682561636f, 0.509832263f},
-std::array<float,2>{0.313499719f, 0.116672032f},
-std::array<float,2>{0.0910161659f, 0.52699703f},
-std::array<float,2>{0.911158919f, 0.0987472013f},
-std::array<float,2>{0.652026832f, 0.947131753f},
-std::array<float,2>{0.362718344f, 0.260829866f},
-std::array<float,2>{0.44011271f, 0.757411003f},
-std::array<float,2>{0.596067369f, 0.46299693f},
-std::array<float,2>{0.870843112f, 0.643075883f},
-std::array<float,2>{0.226354927f, 0.140505105f},
-std::array<float,2>{0.297916412f, 0.715456188f},
-std::array<float,2>{0.715634406f, 0.204265654f},
-std::array<float,2>{0.945562422f, 0.8374663f},
-std::array<float,2>{0.0542606376f, 0.407375097f},
-std::array<float,2>{0.157385722f, 0.926605523f},
-std::array<float,2>{0.799533725f, 0.315960318f},
-std::array<float,2>{0.54972291f, 0.605621815f},
-std::array<float,2>{0.415010691f, 0.0314102881f},
-std::array<float,2>{0.215104252f, 0.659267962f},
-std::array<float,2>{0.823915482f, 0.168302536f},
-std::array<float,2>{0.575289011f, 0.789454997f},
-std::array<float,2>{0.490639508f, 0.499870449f},
-std::array<float,2>{0.340389609f, 0.994544208f},
-std::array<float,2>{0.663728893f, 0.30361411f},
-std::array<float,2>{0.880223274f, 0.549599171f},
-std::array<float,2>{0.118242987f, 0.0868857503f},
-std::array<float,2>{0.39943707f, 0.564577699f},
-std::array<float,2>{0.530690074f, 0.0163843669f},
-std::array<float,2>{0.750380576f, 0.899784386f},
-std::array<float,2>{0.147677913f, 0.372063428f},
-std::array<float,2>{0.00850935094f, 0.865082085f},
-std::array<float,2>{0.992779016f, 0.393672138f},
-std::array<float,2>{0.725678384f, 0.722040474f},
-std::array<float,2>{0.267209679f, 0.249882326f},
-std::array<float,2>{0.116067894f, 0.651157081f},
-std::array<float,2>{0.886932611f, 0.129664242f},
-std::array<float,2>{0.667509496f, 0.761599839f},
-std::array<float,2>{0.33198306f, 0.459607124f},
-std::array<float,2>{0.494519979f, 0.940544784f},
-std::array<float,2>{0.564699948f, 0.25598222f},
-std::array<float,2>{0.814397216f, 0.519851506f},
-std::array<float,2>{0.209943846f, 0.104357675f},
-std::array<float,2>{0.27352041f, 0.596336544f},
-std::array<float,2>{0.734089434f, 0.046670597f},
-std::array<float,2>{0.987587273f, 0.935277283f},
-std::array<float,2>{0.00576829026f, 0.323393494f},
-std::array<float,2>{0.155755997f, 0.833172619f},
-std::array<float,2>{0.764197409f, 0.418597937f},
-std::array<float,2>{0.519436717f, 0.708307326f},
-std::array<float,2>{0.392724603f, 0.21219416f},
-std::array<float,2>{0.232922122f, 0.559228659f},
-std::array<float,2>{0.864452124f, 0.0807959884f},
-std::array<float,2>{0.603652656f, 0.989895761f},
-std::array<float,2>{0.445446819f, 0.305372924f},
-std::array<float,2>{0.370566696f, 0.78529048f},
-std::array<float,2>{0.644144595f, 0.486104488f},
-std::array<float,2>{0.920313239f, 0.669385612f},
-std::array<float,2>{0.0807019025f, 0.161124796f},
-std::array<float,2>{0.412085652f, 0.729258478f},
-std::array<float,2>{0.55820471f, 0.239360526f},
-std::array<float,2>{0.806462288f, 0.869116962f},
-std::array<float,2>{0.169998631f, 0.399214536f},
-std::array<float,2>{0.0581279248f, 0.897056341f},
-std::array<float,2>{0.940743208f, 0.366788536f},
-std::array<float,2>{0.708340883f, 0.570793808f},
-std::array<float,2>{0.311195493f, 0.0304392204f},
-std::array<float,2>{0.0291717276f, 0.593544662f},
-std::array<float,2>{0.977118433f, 0.00599084981f},
-std::array<float,2>{0.73726517f, 0.881910026f},
-std::array<float,2>{0.261112362f, 0.352833003f},
-std::array<float,2>{0.383221149f, 0.845091522f},
-std::array<float,2>{0.510885835f, 0.381497771f},
-std::array<float,2>{0.769479573f, 0.742809653f},
-std::array<float,2>{0.139544711f, 0.227932006f},
-std::array<float,2>{0.327327907f, 0.673869491f},
-std::array<float,2>{0.677130103f, 0.186477765f},
-std::array<float,2>{0.894177556f, 0.811627805f},
-std::array<float,2>{0.101916119f, 0.472039312f},
-std::array<float,2>{0.202320024f, 0.968814433f},
-std::array<float,2>{0.829927742f, 0.286367446f},
-std::array<float,2>{0.578164935f, 0.539426684f},
-std::array<float,2>{0.475291163f, 0.0683657676f},
-std::array<float,2>{0.176389679f, 0.699272573f},
-std::array<float,2>{0.792061627f, 0.202475324f},
-std::array<float,2>{0.537172198f, 0.824825406f},
-std::array<float,2>{0.426758587f, 0.430379272f},
-std::array<float,2>{0.289046615f, 0.916989088f},
-std::array<float,2>{0.687555432f, 0.333530784f},
-std::array<float,2>{0.965252161f, 0.621576369f},
-std::array<float,2>{0.0452203862f, 0.0500341058f},
-std::array<float,2>{0.460810572f, 0.502909303f},
-std::array<float,2>{0.610922575f, 0.123949163f},
-std::array<float,2>{0.844133735f, 0.953962922f},
-std::array<float,2>{0.248903856f, 0.277098089f},
-std::array<float,2>{0.0717310905f, 0.769239247f},
-std::array<float,2>{0.933799982f, 0.444829285f},
-std::array<float,2>{0.632099628f, 0.629076242f},
-std::array<float,2>{0.358964562f, 0.148111254f},
-std::array<float,2>{0.068689175f, 0.703783929f},
-std::array<float,2>{0.924713135f, 0.216035798f},
-std::array<float,2>{0.637883484f, 0.829191148f},
-std::array<float,2>{0.349852592f, 0.416041315f},
-std::array<float,2>{0.467686653f, 0.933511972f},
-std::array<float,2>{0.624209166f, 0.324554682f},
-std::array<float,2>{0.853199601f, 0.601420999f},
-std::array<float,2>{0.239014179f, 0.0395582095f},
-std::array<float,2>{0.289496094f, 0.51660192f},
-std::array<float,2>{0.698628962f, 0.106483102f},
-std::array<float,2>{0.958944321f, 0.943702579f},
-std::array<float,2>{0.0356282182f, 0.253869027f},
-std::array<float,2>{0.181840181f, 0.763457298f},
-std::array<float,2>{0.784317195f, 0.454702973f},
-std::array<float,2>{0.544768333f, 0.653941929f},
-std::array<float,2>{0.430373251f, 0.125053719f},
-std::array<float,2>{0.193837419f, 0.576793671f},
-std::array<float,2>{0.84054333f, 0.0268359669f},
-std::array<float,2>{0.59132123f, 0.892414391f},
-std::array<float,2>{0.481909305f, 0.36240831f},
-std::array<float,2>{0.317094564f, 0.873054504f},
-std::array<float,2>{0.686376154f, 0.402840257f},
-std::array<float,2>{0.898756921f, 0.732552648f},
-std::array<float,2>{0.0945725664f, 0.236350149f},
-std::array<float,2>{0.375487626f, 0.665107131f},
-std::array<float,2>{0.506797791f, 0.156949192f},
-std::array<float,2>{0.77691865f, 0.781939805f},
-std::array<float,2>{0.128224134f, 0.490834743f},
-std::array<float,2>{0.0185693335f, 0.98541832f},
-std::array<float,2>{0.970600605f, 0.312115401f},
-std::array<float,2>{0.745161414f, 0.555546403f},
-std::array<float,2>{0.256570071f, 0.0839306191f},
-std::array<float,2>{0.0478508808f, 0.545419276f},
-std::array<float,2>{0.950784326f, 0.0633715764f},
-std::array<float,2>{0.713486552f, 0.975931764f},
-std::array<float,2>{0.302992642f, 0.283290476f},
-std::array<float,2>{0.420804262f, 0.805003941f},
-std::array<float,2>{0.554449201f, 0.47287181f},
-std::array<float,2>{0.801235795f, 0.678572476f},
-std::array<float,2>{0.162129119f, 0.182450831f},
-std::array<float,2>{0.364606798f, 0.74788183f},
-std::array<float,2>{0.654452443f, 0.233319849f},
-std::array<float,2>{0.909928083f, 0.849136114f},
-std::array<float,2>{0.0874568671f, 0.375493973f},
-std::array<float,2>{0.219500825f, 0.877969801f},
-std::array<float,2>{0.873706222f, 0.357213527f},
-std::array<float,2>{0.60142982f, 0.588258326f},
-std::array<float,2>{0.443400621f, 0.00359170232f},
-std::array<float,2>{0.141987815f, 0.625904262f},
-std::array<float,2>{0.757199705f, 0.143724173f},
-std::array<float,2>{0.524935186f, 0.772058427f},
-std::array<float,2>{0.404675514f, 0.437802047f},
-std::array<float,2>{0.270731837f, 0.957899392f},
-std::array<float,2>{0.719887912f, 0.279410541f},
-std::array<float,2>{0.99793458f, 0.505075276f},
-std::array<float,2>{0.014447703f, 0.120572276f},
-std::array<float,2>{0.484645069f, 0.619595706f},
-std::array<float,2>{0.572404623f, 0.0507999435f},
-std::array<float,2>{0.825754344f, 0.920418084f},
-std::array<float,2>{0.212975234f, 0.329345465f},
-std::array<float,2>{0.123542696f, 0.823368073f},
-std::array<float,2>{0.876175344f, 0.436729729f},
-std::array<float,2>{0.659653485f, 0.698997259f},
-std::array<float,2>{0.338511348f, 0.198923379f},
-std::array<float,2>{0.00335228979f, 0.681015432f},
-std::array<float,2>{0.992007256f, 0.171992391f},
-std::array<float,2>{0.728434384f, 0.802682459f},
-std::array<float,2>{0.278701216f, 0.481985122f},
-std::array<float,2>{0.397787929f, 0.977300346f},
-std::array<float,2>{0.520462573f, 0.289747596f},
-std::array<float,2>{0.760861993f, 0.532481432f},
-std::array<float,2>{0.151008666f, 0.0776313841f},
-std::array<float,2>{0.33462429f, 0.57813406f},
-std::array<float,2>{0.670466483f, 0.0107363332f},
-std::array<float,2>{0.885480106f, 0.887242794f},
-std::array<float,2>{0.110157251f, 0.349258989f},
-std::array<float,2>{0.206637621f, 0.857735455f},
-std::array<float,2>{0.819841921f, 0.38597396f},
-std::array<float,2>{0.569129407f, 0.73655653f},
-std::array<float,2>{0.497938335f, 0.225090951f},
-std::array<float,2>{0.166505083f, 0.51318568f},
-std::array<float,2>{0.811917126f, 0.111782245f},
-std::array<float,2>{0.561281979f, 0.96231252f},
-std::array<float,2>{0.407244056f, 0.270973504f},
-std::array<float,2>{0.306182057f, 0.778453946f},
-std::array<float,2>{0.704512835f, 0.450297475f},
-std::array<float,2>{0.942877352f, 0.638134778f},
-std::array<float,2>{0.0596939437f, 0.152586162f},
-std::array<float,2>{0.452420324f, 0.692996323f},
-std::array<float,2>{0.607094288f, 0.188192397f},
-std::array<float,2>{0.861483335f, 0.812663853f},
-std::array<float,2>{0.229259789f, 0.42600435f},
-std::array<float,2>{0.0827226713f, 0.908791542f},
-std::array<float,2>{0.914899766f, 0.343306899f},
-std::array<float,2>{0.648088813f, 0.612563193f},
-std::array<float,2>{0.371671468f, 0.0561665036f},
-std::array<float,2>{0.105712332f, 0.602211416f},
-std::array<float,2>{0.897441924f, 0.0379990265f},
-std::array<float,2>{0.67251277f, 0.925604224f},
-std::array<float,2>{0.32362169f, 0.316910058f},
-std::array<float,2>{0.469634682f, 0.84353888f},
-std::array<float,2>{0.582786202f, 0.411038101f},
-std::array<float,2>{0.833398342f, 0.71171844f},
-std::array<float,2>{0.196829349f, 0.207576677f},
-std::array<float,2>{0.262048185f, 0.644742131f},
-std::array<float,2>{0.741266012f, 0.134324908f},
-std::array<float,2>{0.981976211f, 0.750658631f},
-std::array<float,2>{0.0259584431f, 0.465074062f},
-std::array<float,2>{0.136251494f, 0.950960994f},
-std::array<float,2>{0.772679508f, 0.262281746f},
-std::array<float,2>{0.514759898f, 0.530583441f},
-std::array<float,2>{0.388786316f, 0.0943195075f},
-std::array<float,2>{0.244707882f, 0.723904312f},
-std::array<float,2>{0.849941909f, 0.243333578f},
-std::array<float,2>{0.615712047f, 0.860994637f},
-std::array<float,2>{0.454132736f, 0.396449029f},
-std::array<float,2>{0.354772329f, 0.902777255f},
-std::array<float,2>{0.627313495f, 0.369581282f},
-std::array<float,2>{0.930690289f, 0.568552732f},
-std::array<float,2>{0.0778894052f, 0.0219939016f},
-std::array<float,2>{0.423570395f, 0.55230087f},
-std::array<float,2>{0.535032332f, 0.0913633555f},
-std::array<float,2>{0.794109225f, 0.997100294f},
-std::array<float,2>{0.175697088f, 0.299559802f},
-std::array<float,2>{0.0426668599f, 0.796574056f},
-std::array<float,2>{0.961891651f, 0.492630631f},
-std::array<float,2>{0.692331851f, 0.662476301f},
-std::array<float,2>{0.281438947f, 0.167298377f},
-std::array<float,2>{0.0205746889f, 0.689974666f},
-std::array<float,2>{0.973614752f, 0.192319378f},
-std::array<float,2>{0.746249676f, 0.820107281f},
-std::array<float,2>{0.25102827f, 0.423087478f},
-std::array<float,2>{0.382059067f, 0.913083911f},
-std::array<float,2>{0.503473818f, 0.337191731f},
-std::array<float,2>{0.779900074f, 0.613341331f},
-std::array<float,2>{0.131707042f, 0.0619613379f},
-std::array<float,2>{0.314487845f, 0.509653568f},
-std::array<float,2>{0.680334449f, 0.113728054f},
-std::array<float,2>{0.904553771f, 0.966124952f},
-std::array<float,2>{0.101457328f, 0.26617378f},
-std::array<float,2>{0.188895971f, 0.774995148f},
-std::array<float,2>{0.839388311f, 0.445727885f},
-std::array<float,2>{0.589079976f, 0.633399725f},
-std::array<float,2>{0.476576567f, 0.148902133f},
-std::array<float,2>{0.184854597f, 0.585516393f},
-std::array<float,2>{0.788887918f, 0.0137503957f},
-std::array<float,2>{0.541055202f, 0.885627806f},
-std::array<float,2>{0.436781287f, 0.346611679f},
-std::array<float,2>{0.293669492f, 0.851596653f},
-std::array<float,2>{0.699354947f, 0.388616949f},
-std::array<float,2>{0.955622137f, 0.738813281f},
-std::array<float,2>{0.0327110291f, 0.218825504f},
-std::array<float,2>{0.4637312f, 0.68413198f},
-std::array<float,2>{0.619751811f, 0.178191513f},
-std::array<float,2>{0.857558787f, 0.800068557f},
-std::array<float,2>{0.235400885f, 0.479001313f},
-std::array<float,2>{0.0649574995f, 0.980686247f},
-std::array<float,2>{0.927468479f, 0.295357943f},
-std::array<float,2>{0.633372128f, 0.535411358f},
-std::array<float,2>{0.346979827f, 0.0726294592f},
-std::array<float,2>{0.120556459f, 0.548033357f},
-std::array<float,2>{0.882661819f, 0.0891839489f},
-std::array<float,2>{0.660806835f, 0.993829131f},
-std::array<float,2>{0.34210813f, 0.301487476f},
-std::array<float,2>{0.488758326f, 0.791336715f},
-std::array<float,2>{0.577388406f, 0.496154219f},
-std::array<float,2>{0.822016716f, 0.656432688f},
-std::array<float,2>{0.216916159f, 0.171500325f},
-std::array<float,2>{0.268636525f, 0.720200002f},
-std::array<float,2>{0.723774791f, 0.247281805f},
-std::array<float,2>{0.99449414f, 0.866080999f},
-std::array<float,2>{0.011563329f, 0.391089946f},
-std::array<float,2>{0.146231145f, 0.901750863f},
-std::array<float,2>{0.751971483f, 0.373342812f},
-std::array<float,2>{0.528884768f, 0.563334465f},
-std::array<float,2>{0.402275324f, 0.0188074671f},
-std::array<float,2>{0.222854838f, 0.641955137f},
-std::array<float,2>{0.868577719f, 0.137911811f},
-std::array<float,2>{0.595175505f, 0.755607903f},
-std::array<float,2>{0.438095331f, 0.461036623f},
-std::array<float,2>{0.359741807f, 0.94731307f},
-std::array<float,2>{0.648805201f, 0.258284479f},
-std::array<float,2>{0.912235022f, 0.524504483f},
-std::array<float,2>{0.0937344879f, 0.0997225344f},
-std::array<float,2>{0.416461945f, 0.608775198f},
-std::array<float,2>{0.547563612f, 0.033203762f},
-std::array<float,2>{0.796992242f, 0.929387867f},
-std::array<float,2>{0.158571258f, 0.313681602f},
-std::array<float,2>{0.0524529591f, 0.839736581f},
-std::array<float,2>{0.948921561f, 0.408968329f},
-std::array<float,2>{0.717185318f, 0.718056023f},
-std::array<float,2>{0.300182074f, 0.206744924f},
-std::array<float,2>{0.0789647698f, 0.670859814f},
-std::array<float,2>{0.918367386f, 0.163085699f},
-std::array<float,2>{0.641126692f, 0.788813889f},
-std::array<float,2>{0.368583292f, 0.487015069f},
-std::array<float,2>{0.447788f, 0.991296589f},
-std::array<float,2>{0.601963341f, 0.307267815f},
-std::array<float,2>{0.865388632f, 0.560898483f},
-std::array<float,2>{0.230665341f, 0.0783464685f},
-std::array<float,2>{0.309632599f, 0.572588265f},
-std::array<float,2>{0.710669219f, 0.0281776525f},
-std::array<float,2>{0.93893683f, 0.895860136f},
-std::array<float,2>{0.0555347539f, 0.363782376f},
-std::array<float,2>{0.168026924f, 0.869642079f},
-std::array<float,2>{0.808075666f, 0.401181132f},
-std::array<float,2>{0.556203902f, 0.728151202f},
-std::array<float,2>{0.412913173f, 0.241836309f},
-std::array<float,2>{0.207642585f, 0.5230546f},
-std::array<float,2>{0.815872669f, 0.102992281f},
-std::array<float,2>{0.562903941f, 0.938439548f},
-std::array<float,2>{0.492752582f, 0.255076259f},
-std::array<float,2>{0.328483731f, 0.758136928f},
-std::array<float,2>{0.664264798f, 0.458713561f},
-std::array<float,2>{0.889694631f, 0.649545193f},
-std::array<float,2>{0.113821603f, 0.130922928f},
-std::array<float,2>{0.392430514f, 0.709059715f},
-std::array<float,2>{0.515776277f, 0.212900609f},
-std::array<float,2>{0.761887789f, 0.835059822f},
-std::array<float,2>{0.153377041f, 0.420081198f},
-std::array<float,2>{0.00716595072f, 0.936440051f},
-std::array<float,2>{0.984749973f, 0.321316034f},
-std::array<float,2>{0.731172383f, 0.594502091f},
-std::array<float,2>{0.275565118f, 0.0430952683f},
-std::array<float,2>{0.0447633304f, 0.624612093f},
-std::array<float,2>{0.967586517f, 0.0483399704f},
-std::array<float,2>{0.690505326f, 0.915908635f},
-std::array<float,2>{0.285182029f, 0.334395111f},
-std::array<float,2>{0.427965552f, 0.828069031f},
-std::array<float,2>{0.536451519f, 0.432108402f},
-std::array<float,2>{0.789507687f, 0.703088999f},
-std::array<float,2>{0.178924814f, 0.200057194f},
-std::array<float,2>{0.355644435f, 0.632479489f},
-std::array<float,2>{0.630426645f, 0.145454794f},
-std::array<float,2>{0.936498463f, 0.766753733f},
-std::array<float,2>{0.0724444091f, 0.442729294f},
-std::array<float,2>{0.246728107f, 0.956059337f},
-std::array<float,2>{0.847170115f, 0.274177939f},
-std::array<float,2>{0.611832798f, 0.500789344f},
-std::array<float,2>{0.457520515f, 0.122859284f},
-std::array<float,2>{0.136762217f, 0.744644582f},
-std::array<float,2>{0.766756713f, 0.23031117f},
-std::array<float,2>{0.509173691f, 0.84739989f},
-std::array<float,2>{0.385715544f, 0.380444258f},
-std::array<float,2>{0.258328944f, 0.879916906f},
-std::array<float,2>{0.736272931f, 0.354146451f},
-std::array<float,2>{0.979514301f, 0.591128588f},
-std::array<float,2>{0.029634146f, 0.00562827475f},
-std::array<float,2>{0.473353118f, 0.541508853f},
-std::array<float,2>{0.580463469f, 0.0664618909f},
-std::array<float,2>{0.830649912f, 0.971321821f},
-std::array<float,2>{0.200510323f, 0.288595825f},
-std::array<float,2>{0.104707554f, 0.80960834f},
-std::array<float,2>{0.890931189f, 0.470157802f},
-std::array<float,2>{0.678489864f, 0.67229557f},
-std::array<float,2>{0.325235665f, 0.183946759f},
-std::array<float,2>{0.0974640623f, 0.7309407f},
-std::array<float,2>{0.901882887f, 0.236208841f},
-std::array<float,2>{0.684369564f, 0.871272802f},
-std::array<float,2>{0.319795758f, 0.405838162f},
-std::array<float,2>{0.483601004f, 0.893746197f},
-std::array<float,2>{0.592306614f, 0.359933913f},
-std::array<float,2>{0.842197478f, 0.575202823f},
-std::array<float,2>{0.192181796f, 0.0237544272f},
-std::array<float,2>{0.255799234f, 0.557190299f},
-std::array<float,2>{0.743946791f, 0.0852992982f},
-std::array<float,2>{0.971115589f, 0.98766166f},
-std::array<float,2>{0.0161430445f, 0.308998555f},
-std::array<float,2>{0.125730038f, 0.783470809f},
-std::array<float,2>{0.77516216f, 0.489916533f},
-std::array<float,2>{0.504089177f, 0.667596877f},
-std::array<float,2>{0.377391428f, 0.15958707f},
-std::array<float,2>{0.240667969f, 0.599510074f},
-std::array<float,2>{0.854194582f, 0.0421555825f},
-std::array<float,2>{0.621445954f, 0.931504369f},
-std::array<float,2>{0.465349495f, 0.327412218f},
-std::array<float,2>{0.347958595f, 0.830395579f},
-std::array<float,2>{0.640518546f, 0.41556266f},
-std::array<float,2>{0.923790574f, 0.706068397f},
-std::array<float,2>{0.0682214275f, 0.216980442f},
-std::array<float,2>{0.433477849f, 0.654952288f},
-std::array<float,2>{0.544930637f, 0.127525091f},
-std::array<float,2>{0.782357872f, 0.763689041f},
-std::array<float,2>{0.180131331f, 0.45694387f},
-std::array<float,2>{0.0382785425f, 0.943162918f},
-std::array<float,2>{0.960497141f, 0.250931084f},
-std::array<float,2>{0.696085691f, 0.51837343f},
-std::array<float,2>{0.292552769f, 0.108804099f},
-std::array<float,2>{0.0131706316f, 0.507032812f},
-std::array<float,2>{0.998581648f, 0.118021071f},
-std::array<float,2>{0.721725702f, 0.960141361f},
-std::array<float,2>{0.273379773f, 0.278578132f},
-std::array<float,2>{0.403857917f, 0.77090323f},
-std::array<float,2>{0.526250958f, 0.439724952f},
-std::array<float,2>{0.755592823f, 0.627324224f},
-std::array<float,2>{0.143050209f, 0.141613156f},
-std::array<float,2>{0.33713755f, 0.696380913f},
-std::array<float,2>{0.657445073f, 0.196362659f},
-std::array<float,2>{0.877626061f, 0.821701705f},
-std::array<float,2>{0.123009846f, 0.434172839f},
-std::array<float,2>{0.211878583f, 0.919769228f},
-std::array<float,2>{0.827611923f, 0.330373794f},
-std::array<float,2>{0.570660591f, 0.618993163f},
-std::array<float,2>{0.488255978f, 0.0545957163f},
-std::array<float,2>{0.161229387f, 0.676912427f},
-std::array<float,2>{0.803343415f, 0.180296138f},
-std::array<float,2>{0.551592112f, 0.807236493f},
-std::array<float,2>{0.419829637f, 0.475160956f},
-std::array<float,2>{0.300959349f, 0.974154413f},
-std::array<float,2>{0.712235272f, 0.282709122f},
-std::array<float,2>{0.952453315f, 0.544133008f},
-std::array<float,2>{0.0494228601f, 0.06593851f},
-std::array<float,2>{0.442996562f, 0.586772323f},
-std::array<float,2>{0.598185658f, 0.00150594558f},
-std::array<float,2>{0.872465312f, 0.875685632f},
-std::array<float,2>{0.221393511f, 0.357535124f},
-std::array<float,2>{0.088132672f, 0.849830508f},
-std::array<float,2>{0.906322956f, 0.378352076f},
-std::array<float,2>{0.65359205f, 0.749410748f},
-std::array<float,2>{0.366922021f, 0.231325343f},
-std::array<float,2>{0.0607000887f, 0.639496446f},
-std::array<float,2>{0.945103884f, 0.155132726f},
-std::array<float,2>{0.705863178f, 0.779298663f},
-std::array<float,2>{0.307742238f, 0.451994926f},
-std::array<float,2>{0.409610271f, 0.963790238f},
-std::array<float,2>{0.558931112f, 0.272013634f},
-std::array<float,2>{0.808987439f, 0.514417291f},
-std::array<float,2>{0.165911794f, 0.11086072f},
-std::array<float,2>{0.374601156f, 0.609627604f},
-std::array<float,2>{0.644581437f, 0.0584116317f},
-std::array<float,2>{0.916662574f, 0.906781912f},
-std::array<float,2>{0.0853195339f, 0.341735929f},
-std::array<float,2>{0.227175951f, 0.8152197f},
-std::array<float,2>{0.86014986f, 0.428889304f},
-std::array<float,2>{0.607478797f, 0.695240021f},
-std::array<float,2>{0.45109728f, 0.191179812f},
-std::array<float,2>{0.149294779f, 0.5349859f},
-std::array<float,2>{0.758588552f, 0.0759242773f},
-std::array<float,2>{0.521929264f, 0.980068624f},
-std::array<float,2>{0.394547462f, 0.292738318f},
-std::array<float,2>{0.280182362f, 0.802844465f},
-std::array<float,2>{0.728634894f, 0.483077794f},
-std::array<float,2>{0.989152968f, 0.683531106f},
-std::array<float,2>{0.00150726771f, 0.17457743f},
-std::array<float,2>{0.498278946f, 0.735075116f},
-std::array<float,2>{0.56835866f, 0.223741084f},
-std::array<float,2>{0.817344666f, 0.855602264f},
-std::array<float,2>{0.203564227f, 0.383040935f},
-std::array<float,2>{0.112137221f, 0.888902187f},
-std::array<float,2>{0.883352637f, 0.350539714f},
-std::array<float,2>{0.668603361f, 0.58059442f},
-std::array<float,2>{0.333469659f, 0.00955337565f},
-std::array<float,2>{0.0742518008f, 0.567073047f},
-std::array<float,2>{0.932004273f, 0.0198490415f},
-std::array<float,2>{0.626938701f, 0.90539211f},
-std::array<float,2>{0.352237016f, 0.367495477f},
-std::array<float,2>{0.456544459f, 0.861432552f},
-std::array<float,2>{0.614743769f, 0.397785187f},
-std::array<float,2>{0.848257482f, 0.726341963f},
-std::array<float,2>{0.242221013f, 0.246035203f},
-std::array<float,2>{0.283619314f, 0.661934257f},
-std::array<float,2>{0.694980443f, 0.16581814f},
-std::array<float,2>{0.964405f, 0.793980241f},
-std::array<float,2>{0.039848391f, 0.495641202f},
-std::array<float,2>{0.172597811f, 0.998193324f},
-std::array<float,2>{0.795101047f, 0.297939688f},
-std::array<float,2>{0.532245934f, 0.552760601f},
-std::array<float,2>{0.424503326f, 0.0921183303f},
-std::array<float,2>{0.199105844f, 0.712928176f},
-std::array<float,2>{0.835564554f, 0.20908618f},
-std::array<float,2>{0.58571744f, 0.840788245f},
-std::array<float,2>{0.471871018f, 0.413681865f},
-std::array<float,2>{0.320489198f, 0.923448622f},
-std::array<float,2>{0.674068511f, 0.320095569f},
-std::array<float,2>{0.895117402f, 0.604357302f},
-std::array<float,2>{0.109092742f, 0.0356356017f},
-std::array<float,2>{0.388347268f, 0.528217971f},
-std::array<float,2>{0.512504816f, 0.0967043266f},
-std::array<float,2>{0.770143151f, 0.951284826f},
-std::array<float,2>{0.13356775f, 0.264381975f},
-std::array<float,2>{0.024471784f, 0.751979172f},
-std::array<float,2>{0.983020902f, 0.468007922f},
-std::array<float,2>{0.739579201f, 0.647746325f},
-std::array<float,2>{0.264322221f, 0.136590704f},
-std::array<float,2>{0.0536624491f, 0.716856778f},
-std::array<float,2>{0.946353197f, 0.20535183f},
-std::array<float,2>{0.716789007f, 0.838136435f},
-std::array<float,2>{0.297682285f, 0.409199178f},
-std::array<float,2>{0.415528089f, 0.928243995f},
-std::array<float,2>{0.550592065f, 0.312973559f},
-std::array<float,2>{0.800289989f, 0.607602239f},
-std::array<float,2>{0.156353578f, 0.0349060111f},
-std::array<float,2>{0.362183422f, 0.523680508f},
-std::array<float,2>{0.650607347f, 0.100839309f},
-std::array<float,2>{0.910158694f, 0.94878912f},
-std::array<float,2>{0.0903235897f, 0.259724796f},
-std::array<float,2>{0.225060686f, 0.754393876f},
-std::array<float,2>{0.869405568f, 0.462281406f},
-std::array<float,2>{0.597588003f, 0.64095664f},
-std::array<float,2>{0.441132367f, 0.137293562f},
-std::array<float,2>{0.147409678f, 0.563707352f},
-std::array<float,2>{0.751155078f, 0.0178037938f},
-std::array<float,2>{0.530051351f, 0.900740564f},
-std::array<float,2>{0.399130672f, 0.374084532f},
-std::array<float,2>{0.266291827f, 0.866523325f},
-std::array<float,2>{0.724941969f, 0.39215067f},
-std::array<float,2>{0.99390167f, 0.719565332f},
-std::array<float,2>{0.00924351998f, 0.246470854f},
-std::array<float,2>{0.492113978f, 0.657957196f},
-std::array<float,2>{0.574424446f, 0.170670494f},
-std::array<float,2>{0.823080182f, 0.792722642f},
-std::array<float,2>{0.21674782f, 0.497554272f},
-std::array<float,2>{0.117730618f, 0.992827475f},
-std::array<float,2>{0.879157364f, 0.302681804f},
-std::array<float,2>{0.662368536f, 0.547741652f},
-std::array<float,2>{0.341621697f, 0.0888180956f},
-std::array<float,2>{0.0642059892f, 0.537066698f},
-std::array<float,2>{0.92924279f, 0.0736399218f},
-std::array<float,2>{0.635989249f, 0.981829166f},
-std::array<float,2>{0.345279306f, 0.296039224f},
-std::array<float,2>{0.461271465f, 0.798936903f},
-std::array<float,2>{0.617395401f, 0.480079561f},
-std::array<float,2>{0.855975747f, 0.685292482f},
-std::array<float,2>{0.237079516f, 0.179273799f},
-std::array<float,2>{0.296653003f, 0.739538431f},
-std::array<float,2>{0.701397657f, 0.220584407f},
-std::array<float,2>{0.953227043f, 0.852818191f},
-std::array<float,2>{0.0335264094f, 0.387022227f},
-std::array<float,2>{0.187173188f, 0.8866117f},
-std::array<float,2>{0.786586463f, 0.347403586f},
-std::array<float,2>{0.540693164f, 0.584027708f},
-std::array<float,2>{0.433905691f, 0.0146618579f},
-std::array<float,2>{0.189931586f, 0.634213984f},
-std::array<float,2>{0.837082207f, 0.149421051f},
-std::array<float,2>{0.587683797f, 0.773612499f},
-std::array<float,2>{0.478885829f, 0.447257996f},
-std::array<float,2>{0.312597066f, 0.965487182f},
-std::array<float,2>{0.683111668f, 0.266606629f},
-std::array<float,2>{0.90386039f, 0.508056104f},
-std::array<float,2>{0.0984992608f, 0.114791542f},
-std::array<float,2>{0.380512714f, 0.615166843f},
-std::array<float,2>{0.500520945f, 0.0613303594f},
-std::array<float,2>{0.778408647f, 0.913861513f},
-std::array<float,2>{0.129502699f, 0.336380035f},
-std::array<float,2>{0.0229606815f, 0.818479896f},
-std::array<float,2>{0.976543069f, 0.421982884f},
-std::array<float,2>{0.748470366f, 0.690874994f},
-std::array<float,2>{0.253153175f, 0.1928045f},
-std::array<float,2>{0.102745622f, 0.673072457f},
-std::array<float,2>{0.892602563f, 0.185477257f},
-std::array<float,2>{0.676083744f, 0.808785677f},
-std::array<float,2>{0.326532781f, 0.469597816f},
-std::array<float,2>{0.476133049f, 0.972529769f},
-std::array<float,2>{0.579533219f, 0.287664652f},
-std::array<float,2>{0.828593254f, 0.542751431f},
-std::array<float,2>{0.20133175f, 0.0676649809f},
-std::array<float,2>{0.260448873f, 0.59057945f},
-std::array<float,2>{0.738011181f, 0.00474007195f},
-std::array<float,2>{0.977716386f, 0.879153252f},
-std::array<float,2>{0.0275171977f, 0.355246395f},
-std::array<float,2>{0.140520141f, 0.845737636f},
-std::array<float,2>{0.768005192f, 0.378917545f},
-std::array<float,2>{0.509782314f, 0.74597019f},
-std::array<float,2>{0.384087592f, 0.228968665f},
-std::array<float,2>{0.249578565f, 0.501264811f},
-std::array<float,2>{0.845264792f, 0.121947363f},
-std::array<float,2>{0.610205352f, 0.955116212f},
-std::array<float,2>{0.459760398f, 0.27504012f},
-std::array<float,2>{0.357435942f, 0.765641153f},
-std::array<float,2>{0.630973637f, 0.442133754f},
-std::array<float,2>{0.934942245f, 0.631050766f},
-std::array<float,2>{0.0705776289f, 0.146241933f},
-std::array<float,2>{0.426256448f, 0.702075183f},
-std::array<float,2>{0.538128257f, 0.200665966f},
-std::array<float,2>{0.791872025f, 0.826265037f},
-std::array<float,2>{0.176804796f, 0.432724118f},
-std::array<float,2>{0.0466822349f, 0.914817274f},
-std::array<float,2>{0.96668005f, 0.335605115f},
-std::array<float,2>{0.689305246f, 0.623506188f},
-std::array<float,2>{0.288046718f, 0.0476001836f},
-std::array<float,2>{0.00421045627f, 0.594989955f},
-std::array<float,2>{0.98665899f, 0.0446499251f},
-std::array<float,2>{0.732658565f, 0.937322199f},
-std::array<float,2>{0.275330603f, 0.320430249f},
-std::array<float,2>{0.394242018f, 0.834096193f},
-std::array<float,2>{0.517944157f, 0.421324849f},
-std::array<float,2>{0.765338123f, 0.710876763f},
-std::array<float,2>{0.154597878f, 0.214052007f},
-std::array<float,2>{0.330665767f, 0.649294376f},
-std::array<float,2>{0.66604799f, 0.132731125f},
-std::array<float,2>{0.887771606f, 0.75939399f},
-std::array<float,2>{0.116761141f, 0.457367778f},
-std::array<float,2>{0.210049301f, 0.939331114f},
-std::array<float,2>{0.812502205f, 0.254449874f},
-std::array<float,2>{0.566251755f, 0.521826565f},
-std::array<float,2>{0.49513182f, 0.102189645f},
-std::array<float,2>{0.170941845f, 0.727402091f},
-std::array<float,2>{0.805068195f, 0.240816996f},
-std::array<float,2>{0.55680567f, 0.870673835f},
-std::array<float,2>{0.410162002f, 0.402004957f},
-std::array<float,2>{0.312325567f, 0.89467442f},
-std::array<float,2>{0.707289219f, 0.364816219f},
-std::array<float,2>{0.939819992f, 0.573705673f},
-std::array<float,2>{0.0573840067f, 0.0289738309f},
-std::array<float,2>{0.446386993f, 0.562086046f},
-std::array<float,2>{0.604543865f, 0.0799369439f},
-std::array<float,2>{0.863960445f, 0.990793049f},
-std::array<float,2>{0.233618021f, 0.308123887f},
-std::array<float,2>{0.0817030296f, 0.787851691f},
-std::array<float,2>{0.92105186f, 0.48751539f},
-std::array<float,2>{0.643526375f, 0.671714425f},
-std::array<float,2>{0.369939208f, 0.163208067f},
-std::array<float,2>{0.0867298022f, 0.748733521f},
-std::array<float,2>{0.908718526f, 0.2318459f},
-std::array<float,2>{0.655344486f, 0.850642622f},
-std::array<float,2>{0.364139944f, 0.377653629f},
-std::array<float,2>{0.444710493f, 0.87598294f},
-std::array<float,2>{0.600229263f, 0.359033585f},
-std::array<float,2>{0.874658942f, 0.587680399f},
-std::array<float,2>{0.219895855f, 0.000702698308f},
-std::array<float,2>{0.304661065f, 0.543012619f},
-std::array<float,2>{0.714595199f, 0.0651949868f},
-std::array<float,2>{0.949477494f, 0.973462045f},
-std::array<float,2>{0.0478687845f, 0.281251937f},
-std::array<float,2>{0.163835153f, 0.80788666f},
-std::array<float,2>{0.801984191f, 0.476436287f},
-std::array<float,2>{0.553094864f, 0.675995111f},
-std::array<float,2>{0.421809763f, 0.180845484f},
-std::array<float,2>{0.21431303f, 0.617251098f},
-std::array<float,2>{0.824803412f, 0.0533274375f},
-std::array<float,2>{0.573997319f, 0.918868721f},
-std::array<float,2>{0.486055732f, 0.331680447f},
-std::array<float,2>{0.339413643f, 0.821157455f},
-std::array<float,2>{0.659027457f, 0.435125023f},
-std::array<float,2>{0.875727355f, 0.695989668f},
-std::array<float,2>{0.124066859f, 0.195913717f},
-std::array<float,2>{0.405940145f, 0.628456414f},
-std::array<float,2>{0.523859978f, 0.141025752f},
-std::array<float,2>{0.756566584f, 0.770269334f},
-std::array<float,2>{0.140888184f, 0.441002905f},
-std::array<float,2>{0.01527307f, 0.959588408f},
-std::array<float,2>{0.996694386f, 0.277946711f},
-std::array<float,2>{0.719146252f, 0.50596714f},
-std::array<float,2>{0.270498365f, 0.11853411f},
-std::array<float,2>{0.0363232791f, 0.519379556f},
-std::array<float,2>{0.957741201f, 0.107997335f},
-std::array<float,2>{0.697819471f, 0.941987216f},
-std::array<float,2>{0.290418178f, 0.25114572f},
-std::array<float,2>{0.431588501f, 0.76507622f},
-std::array<float,2>{0.543505609f, 0.455889136f},
-std::array<float,2>{0.783730268f, 0.656178474f},
-std::array<float,2>{0.183355153f, 0.128062427f},
-std::array<float,2>{0.350800008f, 0.705610991f},
-std::array<float,2>{0.636848032f, 0.218378127f},
-std::array<float,2>{0.9254933f, 0.831208527f},
-std::array<float,2>{0.0698054656f, 0.414273173f},
-std::array<float,2>{0.240212515f, 0.92991209f},
-std::array<float,2>{0.852244556f, 0.326865792f},
-std::array<float,2>{0.623919129f, 0.597982287f},
-std::array<float,2>{0.467918992f, 0.0414626859f},
-std::array<float,2>{0.126965925f, 0.666663706f},
-std::array<float,2>{0.775921345f, 0.159044787f},
-std::array<float,2>{0.507748246f, 0.784483016f},
-std::array<float,2>{0.376541257f, 0.489090115f},
-std::array<float,2>{0.257314116f, 0.986862659f},
-std::array<float,2>{0.744372666f, 0.310224593f},
-std::array<float,2>{0.969238639f, 0.557958663f},
-std::array<float,2>{0.0184542313f, 0.0842304975f},
-std::array<float,2>{0.480814964f, 0.574980855f},
-std::array<float,2>{0.589944959f, 0.0246861018f},
-std::array<float,2>{0.841650605f, 0.89274472f},
-std::array<float,2>{0.194650218f, 0.36109823f},
-std::array<float,2>{0.0955091417f, 0.872374833f},
-std::array<float,2>{0.900353372f, 0.404664367f},
-std::array<float,2>{0.687135994f, 0.731645286f},
-std::array<float,2>{0.318079323f, 0.235292181f},
-std::array<float,2>{0.0267274585f, 0.646934211f},
-std::array<float,2>{0.980562627f, 0.135383815f},
-std::array<float,2>{0.740854561f, 0.752953291f},
-std::array<float,2>{0.262724638f, 0.467511356f},
-std::array<float,2>{0.390305668f, 0.952880502f},
-std::array<float,2>{0.514526367f, 0.264658153f},
-std::array<float,2>{0.772135139f, 0.528502226f},
-std::array<float,2>{0.135021895f, 0.0966742709f},
-std::array<float,2>{0.323230714f, 0.604623258f},
-std::array<float,2>{0.673035502f, 0.0368641764f},
-std::array<float,2>{0.898332477f, 0.922555566f},
-std::array<float,2>{0.106556557f, 0.319038898f},
-std::array<float,2>{0.195990801f, 0.841450512f},
-std::array<float,2>{0.832561016f, 0.412693262f},
-std::array<float,2>{0.583277583f, 0.71423912f},
-std::array<float,2>{0.4701626f, 0.210305706f},
-std::array<float,2>{0.174716264f, 0.554392278f},
-std::array<float,2>{0.79369992f, 0.0930738822f},
-std::array<float,2>{0.533416331f, 0.999191403f},
-std::array<float,2>{0.422380179f, 0.297088295f},
-std::array<float,2>{0.282507032f, 0.793670535f},
-std::array<float,2>{0.692800164f, 0.494627148f},
-std::array<float,2>{0.962295949f, 0.660495222f},
-std::array<float,2>{0.041241955f, 0.164750531f},
-std::array<float,2>{0.453792244f, 0.725153029f},
-std::array<float,2>{0.616497457f, 0.244986996f},
-std::array<float,2>{0.851296127f, 0.863085508f},
-std::array<float,2>{0.245220661f, 0.397255808f},
-std::array<float,2>{0.0770823061f, 0.90499866f},
-std::array<float,2>{0.929925382f, 0.368773699f},
-std::array<float,2>{0.628722489f, 0.567999601f},
-std::array<float,2>{0.353581339f, 0.0209274273f},
-std::array<float,2>{0.110800877f, 0.581332147f},
-std::array<float,2>{0.885919511f, 0.00851187203f},
-std::array<float,2>{0.671056569f, 0.890467346f},
-std::array<float,2>{0.33552143f, 0.350802094f},
-std::array<float,2>{0.496496737f, 0.856479585f},
-std::array<float,2>{0.57022053f, 0.383862883f},
-std::array<float,2>{0.819239497f, 0.735380828f},
-std::array<float,2>{0.20572798f, 0.223268807f},
-std::array<float,2>{0.277958244f, 0.68195641f},
-std::array<float,2>{0.727091789f, 0.175197229f},
-std::array<float,2>{0.990465105f, 0.80374223f},
-std::array<float,2>{0.00288698706f, 0.484012425f},
-std::array<float,2>{0.151657552f, 0.979454935f},
-std::array<float,2>{0.760044873f, 0.291711241f},
-std::array<float,2>{0.520773649f, 0.53395611f},
-std::array<float,2>{0.396588832f, 0.0747086033f},
-std::array<float,2>{0.230185255f, 0.694001615f},
-std::array<float,2>{0.862677336f, 0.190101728f},
-std::array<float,2>{0.605912089f, 0.816183686f},
-std::array<float,2>{0.451782405f, 0.427856386f},
-std::array<float,2>{0.372608453f, 0.907666147f},
-std::array<float,2>{0.647146821f, 0.34052664f},
-std::array<float,2>{0.915621936f, 0.611234307f},
-std::array<float,2>{0.08393915f, 0.0576144941f},
-std::array<float,2>{0.407036841f, 0.514687359f},
-std::array<float,2>{0.562215328f, 0.109400116f},
-std::array<float,2>{0.810790837f, 0.963990033f},
-std::array<float,2>{0.167796269f, 0.273231626f},
-std::array<float,2>{0.0595501624f, 0.780418158f},
-std::array<float,2>{0.941578329f, 0.452287525f},
-std::array<float,2>{0.703794777f, 0.639933765f},
-std::array<float,2>{0.305045098f, 0.155600473f},
-std::array<float,2>{0.0100435168f, 0.721569121f},
-std::array<float,2>{0.995968282f, 0.24894622f},
-std::array<float,2>{0.723345399f, 0.864156127f},
-std::array<float,2>{0.268221259f, 0.392753273f},
-std::array<float,2>{0.400922745f, 0.899162114f},
-std::array<float,2>{0.528085053f, 0.372471929f},
-std::array<float,2>{0.752958894f, 0.566025317f},
-std::array<float,2>{0.145195439f, 0.0172051154f},
-std::array<float,2>{0.342920959f, 0.549901068f},
-std::array<float,2>{0.662052631f, 0.0875868797f},
-std::array<float,2>{0.880959868f, 0.995634437f},
-std::array<float,2>{0.119838789f, 0.304142714f},
-std::array<float,2>{0.218010694f, 0.79069972f},
-std::array<float,2>{0.821055889f, 0.498969167f},
-std::array<float,2>{0.576522231f, 0.658211946f},
-std::array<float,2>{0.489874244f, 0.168958366f},
-std::array<float,2>{0.159581795f, 0.60663867f},
-std::array<float,2>{0.798567891f, 0.0331822149f},
-std::array<float,2>{0.548062384f, 0.927027345f},
-std::array<float,2>{0.417865515f, 0.314753473f},
-std::array<float,2>{0.299068391f, 0.836471438f},
-std::array<float,2>{0.718694329f, 0.40644598f},
-std::array<float,2>{0.948128879f, 0.715823233f},
-std::array<float,2>{0.0512103476f, 0.203913569f},
-std::array<float,2>{0.438940436f, 0.643917263f},
-std::array<float,2>{0.593963802f, 0.139463872f},
-std::array<float,2>{0.867405593f, 0.756427526f},
-std::array<float,2>{0.224272728f, 0.463918686f},
-std::array<float,2>{0.0920141786f, 0.945668817f},
-std::array<float,2>{0.913901329f, 0.26015234f},
-std::array<float,2>{0.649807572f, 0.525606632f},
-std::array<float,2>{0.360393643f, 0.097747311f},
-std::array<float,2>{0.100338735f, 0.511193812f},
-std::array<float,2>{0.906188071f, 0.115820259f},
-std::array<float,2>{0.681181669f, 0.967621505f},
-std::array<float,2>{0.316377789f, 0.269138634f},
-std::array<float,2>{0.478377283f, 0.775583506f},
-std::array<float,2>{0.588553905f, 0.44771722f},
-std::array<float,2>{0.838043749f, 0.635503292f},
-std::array<float,2>{0.188389584f, 0.151838332f},
-std::array<float,2>{0.250927031f, 0.688233733f},
-std::array<float,2>{0.747729361f, 0.19414781f},
-std::array<float,2>{0.974457324f, 0.817566514f},
-std::array<float,2>{0.0196280107f, 0.424014896f},
-std::array<float,2>{0.132063344f, 0.91155231f},
-std::array<float,2>{0.781163216f, 0.339309186f},
-std::array<float,2>{0.502577603f, 0.615875244f},
-std::array<float,2>{0.381452054f, 0.0586948022f},
-std::array<float,2>{0.234455124f, 0.686629534f},
-std::array<float,2>{0.858887672f, 0.176540121f},
-std::array<float,2>{0.620289326f, 0.797950327f},
-std::array<float,2>{0.464308769f, 0.476883262f},
-std::array<float,2>{0.346572071f, 0.982672572f},
-std::array<float,2>{0.634337664f, 0.293342173f},
-std::array<float,2>{0.926735818f, 0.537796378f},
-std::array<float,2>{0.0662259907f, 0.0705503449f},
-std::array<float,2>{0.435734898f, 0.582746387f},
-std::array<float,2>{0.542250872f, 0.0123252543f},
-std::array<float,2>{0.787601113f, 0.883174658f},
-std::array<float,2>{0.184031978f, 0.345440716f},
-std::array<float,2>{0.0320935622f, 0.854171634f},
-std::array<float,2>{0.956750035f, 0.389711618f},
-std::array<float,2>{0.700394571f, 0.740756631f},
-std::array<float,2>{0.294398278f, 0.221481442f},
-std::array<float,2>{0.0738234371f, 0.63012284f},
-std::array<float,2>{0.937066555f, 0.147048682f},
-std::array<float,2>{0.629851997f, 0.767757177f},
-std::array<float,2>{0.357283622f, 0.443604857f},
-std::array<float,2>{0.458772898f, 0.954549372f},
-std::array<float,2>{0.613241792f, 0.275645733f},
-std::array<float,2>{0.84596628f, 0.503091156f},
-std::array<float,2>{0.247699857f, 0.124497145f},
-std::array<float,2>{0.286297739f, 0.622364998f},
-std::array<float,2>{0.690111339f, 0.0489352718f},
-std::array<float,2>{0.968366444f, 0.917271554f},
-std::array<float,2>{0.0430555791f, 0.332889944f},
-std::array<float,2>{0.178641528f, 0.825453162f},
-std::array<float,2>{0.790534735f, 0.431156129f},
-std::array<float,2>{0.535698295f, 0.701031506f},
-std::array<float,2>{0.429614097f, 0.201537266f},
-std::array<float,2>{0.199785173f, 0.540818095f},
-std::array<float,2>{0.831913292f, 0.0697068721f},
-std::array<float,2>{0.581238925f, 0.970477104f},
-std::array<float,2>{0.474516898f, 0.285202295f},
-std::array<float,2>{0.324305266f, 0.810664594f},
-std::array<float,2>{0.678847492f, 0.471547216f},
-std::array<float,2>{0.891706049f, 0.67553395f},
-std::array<float,2>{0.104102127f, 0.187413707f},
-std::array<float,2>{0.386047781f, 0.743254423f},
-std::array<float,2>{0.508095026f, 0.226673603f},
-std::array<float,2>{0.766540825f, 0.843857288f},
-std::array<float,2>{0.138180763f, 0.381891787f},
-std::array<float,2>{0.0305266809f, 0.881681621f},
-std::array<float,2>{0.979054451f, 0.351954371f},
-std::array<float,2>{0.734462321f, 0.592623711f},
-std::array<float,2>{0.259184837f, 0.00730759325f},
-std::array<float,2>{0.0556963757f, 0.571442723f},
-std::array<float,2>{0.938353658f, 0.0294628013f},
-std::array<float,2>{0.709898293f, 0.897838652f},
-std::array<float,2>{0.309054047f, 0.365727901f},
-std::array<float,2>{0.413544446f, 0.867761672f},
-std::array<float,2>{0.555342317f, 0.400294721f},
-std::array<float,2>{0.807282269f, 0.73030597f},
-std::array<float,2>{0.169148669f, 0.238826036f},
-std::array<float,2>{0.367841929f, 0.667974532f},
-std::array<float,2>{0.641681612f, 0.161872014f},
-std::array<float,2>{0.919580579f, 0.786155999f},
-std::array<float,2>{0.0800152421f, 0.484467417f},
-std::array<float,2>{0.231990173f, 0.988333106f},
-std::array<float,2>{0.867093801f, 0.306374162f},
-std::array<float,2>{0.603110671f, 0.559657276f},
-std::array<float,2>{0.448509067f, 0.0816937536f},
-std::array<float,2>{0.152884185f, 0.707140028f},
-std::array<float,2>{0.763600409f, 0.211814359f},
-std::array<float,2>{0.517429292f, 0.832504928f},
-std::array<float,2>{0.391556501f, 0.419146478f},
-std::array<float,2>{0.27680251f, 0.934063673f},
-std::array<float,2>{0.731563389f, 0.322676599f},
-std::array<float,2>{0.985758543f, 0.596835077f},
-std::array<float,2>{0.00589617295f, 0.0449849144f},
-std::array<float,2>{0.494115293f, 0.520733714f},
-std::array<float,2>{0.563599527f, 0.105448112f},
-std::array<float,2>{0.815135539f, 0.940115452f},
-std::array<float,2>{0.208621264f, 0.256924301f},
-std::array<float,2>{0.114974238f, 0.760401547f},
-std::array<float,2>{0.889557242f, 0.46059376f},
-std::array<float,2>{0.665293753f, 0.651938498f},
-std::array<float,2>{0.329248488f, 0.130429119f},
-std::array<float,2>{0.121954143f, 0.697414398f},
-std::array<float,2>{0.87858057f, 0.197629035f},
-std::array<float,2>{0.656978309f, 0.822740197f},
-std::array<float,2>{0.336155474f, 0.436383545f},
-std::array<float,2>{0.486681134f, 0.921574533f},
-std::array<float,2>{0.571645141f, 0.329097778f},
-std::array<float,2>{0.82708329f, 0.620948493f},
-std::array<float,2>{0.212864697f, 0.0524222218f},
-std::array<float,2>{0.272382826f, 0.504074812f},
-std::array<float,2>{0.720936716f, 0.11962796f},
-std::array<float,2>{0.999532044f, 0.958284557f},
-std::array<float,2>{0.0125612058f, 0.280293584f},
-std::array<float,2>{0.14409928f, 0.77290976f},
-std::array<float,2>{0.754722118f, 0.439303696f},
-std::array<float,2>{0.526726007f, 0.626755774f},
-std::array<float,2>{0.403012305f, 0.143277943f},
-std::array<float,2>{0.222001165f, 0.589353859f},
-std::array<float,2>{0.87154752f, 0.0020375906f},
-std::array<float,2>{0.598948359f, 0.877923012f},
-std::array<float,2>{0.441451728f, 0.355512112f},
-std::array<float,2>{0.366023213f, 0.84783572f},
-std::array<float,2>{0.652938247f, 0.376837283f},
-std::array<float,2>{0.907370627f, 0.746906519f},
-std::array<float,2>{0.0889367312f, 0.234291077f},
-std::array<float,2>{0.41828382f, 0.679592729f},
-std::array<float,2>{0.552636206f, 0.183546752f},
-std::array<float,2>{0.804468989f, 0.806295931f},
-std::array<float,2>{0.160361692f, 0.473775059f},
-std::array<float,2>{0.0502553917f, 0.975344837f},
-std::array<float,2>{0.952116728f, 0.284341574f},
-std::array<float,2>{0.711733222f, 0.546347201f},
-std::array<float,2>{0.302665561f, 0.0643625259f},
-std::array<float,2>{0.0168292783f, 0.555828989f},
-std::array<float,2>{0.971694708f, 0.0821261927f},
-std::array<float,2>{0.74223429f, 0.984848738f},
-std::array<float,2>{0.254156053f, 0.311122894f},
-std::array<float,2>{0.378665209f, 0.782745123f},
-std::array<float,2>{0.50556618f, 0.491412342f},
-std::array<float,2>{0.773512721f, 0.664156914f},
-std::array<float,2>{0.126755401f, 0.158088401f},
-std::array<float,2>{0.318909734f, 0.733463645f},
-std::array<float,2>{0.684642494f, 0.237741038f},
-std::array<float,2>{0.901225686f, 0.874025881f},
-std::array<float,2>{0.0962527245f, 0.404232651f},
-std::array<float,2>{0.193139941f, 0.891330421f},
-std::array<float,2>{0.842832267f, 0.361603677f},
-std::array<float,2>{0.593146741f, 0.57767725f},
-std::array<float,2>{0.482963502f, 0.0254492778f},
-std::array<float,2>{0.180895627f, 0.652620733f},
-std::array<float,2>{0.781595469f, 0.126080856f},
-std::array<float,2>{0.546535015f, 0.762322724f},
-std::array<float,2>{0.431805164f, 0.453176498f},
-std::array<float,2>{0.291355193f, 0.944954157f},
-std::array<float,2>{0.696654797f, 0.252626121f},
-std::array<float,2>{0.959745109f, 0.516239345f},
-std::array<float,2>{0.0373311676f, 0.105508074f},
-std::array<float,2>{0.466181546f, 0.599624753f},
-std::array<float,2>{0.622768104f, 0.0405098796f},
-std::array<float,2>{0.85545069f, 0.93233645f},
-std::array<float,2>{0.241819739f, 0.326059759f},
-std::array<float,2>{0.0668550357f, 0.829092622f},
-std::array<float,2>{0.922266603f, 0.41713801f},
-std::array<float,2>{0.639344633f, 0.705029905f},
-std::array<float,2>{0.348887414f, 0.214895666f},
-std::array<float,2>{0.0409116782f, 0.663773239f},
-std::array<float,2>{0.963232994f, 0.16658549f},
-std::array<float,2>{0.694099963f, 0.794961333f},
-std::array<float,2>{0.28461948f, 0.493383318f},
-std::array<float,2>{0.425022274f, 0.996219277f},
-std::array<float,2>{0.532193005f, 0.300016105f},
-std::array<float,2>{0.796747327f, 0.551003039f},
-std::array<float,2>{0.173313931f, 0.0898576006f},
-std::array<float,2>{0.352843136f, 0.569885314f},
-std::array<float,2>{0.625228643f, 0.0233735759f},
-std::array<float,2>{0.932763755f, 0.904116452f},
-std::array<float,2>{0.0752899945f, 0.370776534f},
-std::array<float,2>{0.243354633f, 0.860163748f},
-std::array<float,2>{0.849196315f, 0.395087421f},
-std::array<float,2>{0.613523424f, 0.722765386f},
-std::array<float,2>{0.4559066f, 0.242995679f},
-std::array<float,2>{0.134156734f, 0.530002236f},
-std::array<float,2>{0.771048188f, 0.0953531563f},
-std::array<float,2>{0.51291728f, 0.950050592f},
-std::array<float,2>{0.387107998f, 0.263222963f},
-std::array<float,2>{0.264955312f, 0.751302838f},
-std::array<float,2>{0.738541543f, 0.466098547f},
-std::array<float,2>{0.984322309f, 0.646342576f},
-std::array<float,2>{0.0235752109f, 0.13327083f},
-std::array<float,2>{0.471172094f, 0.712686598f},
-std::array<float,2>{0.584165215f, 0.208028883f},
-std::array<float,2>{0.834401071f, 0.841838956f},
-std::array<float,2>{0.197568163f, 0.411193609f},
-std::array<float,2>{0.107777834f, 0.924440742f},
-std::array<float,2>{0.895908654f, 0.317616224f},
-std::array<float,2>{0.675192177f, 0.603420496f},
-std::array<float,2>{0.321675807f, 0.0383589678f},
-std::array<float,2>{0.0844992474f, 0.611557901f},
-std::array<float,2>{0.917409956f, 0.0551015735f},
-std::array<float,2>{0.646169186f, 0.909777045f},
-std::array<float,2>{0.374003798f, 0.34220928f},
-std::array<float,2>{0.450157702f, 0.813638985f},
-std::array<float,2>{0.608773947f, 0.427670002f},
-std::array<float,2>{0.860764205f, 0.691968977f},
-std::array<float,2>{0.227581143f, 0.188906014f},
-std::array<float,2>{0.307559997f, 0.637446761f},
-std::array<float,2>{0.706193268f, 0.15355584f},
-std::array<float,2>{0.943678141f, 0.777991295f},
-std::array<float,2>{0.0615681559f, 0.449301004f},
-std::array<float,2>{0.164121702f, 0.961671412f},
-std::array<float,2>{0.810260415f, 0.270427436f},
-std::array<float,2>{0.559594631f, 0.512268305f},
-std::array<float,2>{0.408504844f, 0.112329505f},
-std::array<float,2>{0.204749942f, 0.737964571f},
-std::array<float,2>{0.81758076f, 0.226263955f},
-std::array<float,2>{0.566673458f, 0.859129965f},
-std::array<float,2>{0.499441445f, 0.384790272f},
-std::array<float,2>{0.332443535f, 0.88833642f},
-std::array<float,2>{0.669367194f, 0.347994447f},
-std::array<float,2>{0.883883655f, 0.579574823f},
-std::array<float,2>{0.112706073f, 0.0114263333f},
-std::array<float,2>{0.396261871f, 0.531687975f},
-std::array<float,2>{0.522654653f, 0.0766392499f},
-std::array<float,2>{0.759693265f, 0.97766f},
-std::array<float,2>{0.149805263f, 0.290825397f},
-std::array<float,2>{0.000185566474f, 0.801757455f},
-std::array<float,2>{0.989835858f, 0.48069185f},
-std::array<float,2>{0.729890585f, 0.679869175f},
-std::array<float,2>{0.28049165f, 0.173339829f}}
\ No newline at end of file
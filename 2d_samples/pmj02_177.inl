@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.643938899f, 0.220319614f},
-std::array<float,2>{0.211479217f, 0.87645328f},
-std::array<float,2>{0.403360516f, 0.449724317f},
-std::array<float,2>{0.812684f, 0.681354821f},
-std::array<float,2>{0.911808312f, 0.366034389f},
-std::array<float,2>{0.370077431f, 0.523641765f},
-std::array<float,2>{0.0285371616f, 0.0994696617f},
-std::array<float,2>{0.54860431f, 0.786064923f},
-std::array<float,2>{0.563488722f, 0.40929395f},
-std::array<float,2>{0.111818843f, 0.702444077f},
-std::array<float,2>{0.266777098f, 0.167665675f},
-std::array<float,2>{0.992675364f, 0.940713763f},
-std::array<float,2>{0.790706992f, 0.0489357859f},
-std::array<float,2>{0.446545452f, 0.862407148f},
-std::array<float,2>{0.129224047f, 0.262215078f},
-std::array<float,2>{0.739247322f, 0.572247386f},
-std::array<float,2>{0.502658844f, 0.0837378055f},
-std::array<float,2>{0.0465770438f, 0.763220131f},
-std::array<float,2>{0.343629539f, 0.341469377f},
-std::array<float,2>{0.89315325f, 0.558739722f},
-std::array<float,2>{0.874528706f, 0.494215965f},
-std::array<float,2>{0.414271981f, 0.625049651f},
-std::array<float,2>{0.248162448f, 0.188041955f},
-std::array<float,2>{0.665877223f, 0.907814085f},
-std::array<float,2>{0.704231977f, 0.305609047f},
-std::array<float,2>{0.179839045f, 0.601838231f},
-std::array<float,2>{0.495951146f, 0.0277123265f},
-std::array<float,2>{0.752886593f, 0.81649965f},
-std::array<float,2>{0.955985069f, 0.150694042f},
-std::array<float,2>{0.30353272f, 0.973974168f},
-std::array<float,2>{0.0913777426f, 0.375201344f},
-std::array<float,2>{0.60267657f, 0.725644588f},
-std::array<float,2>{0.618273437f, 0.183765814f},
-std::array<float,2>{0.0712282881f, 0.955343723f},
-std::array<float,2>{0.284950107f, 0.432116866f},
-std::array<float,2>{0.944296598f, 0.703855813f},
-std::array<float,2>{0.767477393f, 0.267372549f},
-std::array<float,2>{0.480164468f, 0.590325475f},
-std::array<float,2>{0.156698272f, 0.0462009609f},
-std::array<float,2>{0.691592813f, 0.850763619f},
-std::array<float,2>{0.681394458f, 0.461539537f},
-std::array<float,2>{0.227469489f, 0.66698128f},
-std::array<float,2>{0.428506464f, 0.235038966f},
-std::array<float,2>{0.858650088f, 0.899233758f},
-std::array<float,2>{0.87759614f, 0.12301591f},
-std::array<float,2>{0.321466774f, 0.811375737f},
-std::array<float,2>{0.0590405539f, 0.357134193f},
-std::array<float,2>{0.520588815f, 0.509889543f},
-std::array<float,2>{0.729621172f, 0.00527202291f},
-std::array<float,2>{0.146026075f, 0.839985609f},
-std::array<float,2>{0.457664281f, 0.293957382f},
-std::array<float,2>{0.808847666f, 0.610150754f},
-std::array<float,2>{0.975789249f, 0.397078782f},
-std::array<float,2>{0.255284965f, 0.745520413f},
-std::array<float,2>{0.105545066f, 0.126410052f},
-std::array<float,2>{0.580106854f, 0.985503316f},
-std::array<float,2>{0.533988714f, 0.315498233f},
-std::array<float,2>{0.00838640705f, 0.540977776f},
-std::array<float,2>{0.349681288f, 0.0682558417f},
-std::array<float,2>{0.933363616f, 0.771214783f},
-std::array<float,2>{0.8350963f, 0.216053978f},
-std::array<float,2>{0.380355f, 0.934857368f},
-std::array<float,2>{0.192813247f, 0.483029485f},
-std::array<float,2>{0.640379786f, 0.651589155f},
-std::array<float,2>{0.702376783f, 0.133249566f},
-std::array<float,2>{0.168131426f, 0.992226481f},
-std::array<float,2>{0.473176956f, 0.402402043f},
-std::array<float,2>{0.779027462f, 0.73650223f},
-std::array<float,2>{0.952039242f, 0.28640908f},
-std::array<float,2>{0.290765971f, 0.624358177f},
-std::array<float,2>{0.0673473105f, 0.0142882764f},
-std::array<float,2>{0.615421116f, 0.833141446f},
-std::array<float,2>{0.530430079f, 0.475273013f},
-std::array<float,2>{0.052821409f, 0.646924615f},
-std::array<float,2>{0.315540612f, 0.203682497f},
-std::array<float,2>{0.884846807f, 0.924844921f},
-std::array<float,2>{0.84788394f, 0.0718046054f},
-std::array<float,2>{0.4373568f, 0.777420223f},
-std::array<float,2>{0.223401755f, 0.321996957f},
-std::array<float,2>{0.677309036f, 0.537167668f},
-std::array<float,2>{0.586098135f, 0.0388845168f},
-std::array<float,2>{0.0990297124f, 0.855936885f},
-std::array<float,2>{0.263262272f, 0.27575174f},
-std::array<float,2>{0.981885254f, 0.581854999f},
-std::array<float,2>{0.798242331f, 0.422025263f},
-std::array<float,2>{0.464627206f, 0.715589941f},
-std::array<float,2>{0.153314605f, 0.174747333f},
-std::array<float,2>{0.726102769f, 0.963338435f},
-std::array<float,2>{0.628123403f, 0.346742213f},
-std::array<float,2>{0.200588003f, 0.50567472f},
-std::array<float,2>{0.385686904f, 0.116811931f},
-std::array<float,2>{0.83744663f, 0.800462782f},
-std::array<float,2>{0.929641604f, 0.24514544f},
-std::array<float,2>{0.354291052f, 0.892168999f},
-std::array<float,2>{0.0034159671f, 0.457308978f},
-std::array<float,2>{0.542737782f, 0.661981642f},
-std::array<float,2>{0.555048823f, 0.198042855f},
-std::array<float,2>{0.0227071308f, 0.9159922f},
-std::array<float,2>{0.362231284f, 0.490090102f},
-std::array<float,2>{0.9141047f, 0.63757205f},
-std::array<float,2>{0.823735297f, 0.333792746f},
-std::array<float,2>{0.392538607f, 0.548457325f},
-std::array<float,2>{0.204860345f, 0.0879644677f},
-std::array<float,2>{0.649622202f, 0.756661594f},
-std::array<float,2>{0.747316778f, 0.387527853f},
-std::array<float,2>{0.14004308f, 0.733528614f},
-std::array<float,2>{0.443202049f, 0.145660415f},
-std::array<float,2>{0.784094989f, 0.982445657f},
-std::array<float,2>{0.98492533f, 0.0189761277f},
-std::array<float,2>{0.27515915f, 0.824073195f},
-std::array<float,2>{0.119427547f, 0.300729245f},
-std::array<float,2>{0.577921748f, 0.594559729f},
-std::array<float,2>{0.660619974f, 0.109023966f},
-std::array<float,2>{0.235005379f, 0.792114258f},
-std::array<float,2>{0.409046918f, 0.368619651f},
-std::array<float,2>{0.861565411f, 0.517930329f},
-std::array<float,2>{0.901842296f, 0.441739231f},
-std::array<float,2>{0.328544199f, 0.673243582f},
-std::array<float,2>{0.0364138409f, 0.228732571f},
-std::array<float,2>{0.508767188f, 0.888360381f},
-std::array<float,2>{0.594353139f, 0.254902989f},
-std::array<float,2>{0.084232986f, 0.569007993f},
-std::array<float,2>{0.312361598f, 0.0623645633f},
-std::array<float,2>{0.964569092f, 0.872004032f},
-std::array<float,2>{0.764838159f, 0.160426244f},
-std::array<float,2>{0.485046566f, 0.950568795f},
-std::array<float,2>{0.178162515f, 0.419217497f},
-std::array<float,2>{0.717885494f, 0.688931644f},
-std::array<float,2>{0.737122834f, 0.207905024f},
-std::array<float,2>{0.125445262f, 0.926758885f},
-std::array<float,2>{0.451700032f, 0.471970141f},
-std::array<float,2>{0.796581388f, 0.64351207f},
-std::array<float,2>{0.996233702f, 0.324226081f},
-std::array<float,2>{0.272899956f, 0.531696439f},
-std::array<float,2>{0.114023536f, 0.0751958042f},
-std::array<float,2>{0.569477141f, 0.776278675f},
-std::array<float,2>{0.550865352f, 0.400193185f},
-std::array<float,2>{0.0238650814f, 0.738822639f},
-std::array<float,2>{0.373215616f, 0.139093116f},
-std::array<float,2>{0.907252312f, 0.997796655f},
-std::array<float,2>{0.820282578f, 0.00922812894f},
-std::array<float,2>{0.401425511f, 0.830348313f},
-std::array<float,2>{0.218703017f, 0.283082724f},
-std::array<float,2>{0.647747159f, 0.620125532f},
-std::array<float,2>{0.608465374f, 0.112894259f},
-std::array<float,2>{0.0881093517f, 0.803679824f},
-std::array<float,2>{0.298223108f, 0.350043505f},
-std::array<float,2>{0.959702611f, 0.502696931f},
-std::array<float,2>{0.757335067f, 0.456609339f},
-std::array<float,2>{0.499893546f, 0.658206165f},
-std::array<float,2>{0.18630974f, 0.246633843f},
-std::array<float,2>{0.709377706f, 0.898358703f},
-std::array<float,2>{0.670771062f, 0.277466476f},
-std::array<float,2>{0.243645579f, 0.582073867f},
-std::array<float,2>{0.421263844f, 0.0322410874f},
-std::array<float,2>{0.87067914f, 0.85167104f},
-std::array<float,2>{0.894599259f, 0.177600414f},
-std::array<float,2>{0.337646157f, 0.967355371f},
-std::array<float,2>{0.0392966568f, 0.428349316f},
-std::array<float,2>{0.506178141f, 0.71312958f},
-std::array<float,2>{0.51776576f, 0.140739799f},
-std::array<float,2>{0.0568459556f, 0.978515148f},
-std::array<float,2>{0.327376813f, 0.385530442f},
-std::array<float,2>{0.880864561f, 0.729325891f},
-std::array<float,2>{0.854986072f, 0.30232349f},
-std::array<float,2>{0.425196975f, 0.599765897f},
-std::array<float,2>{0.233977318f, 0.0213556122f},
-std::array<float,2>{0.686618626f, 0.824347317f},
-std::array<float,2>{0.687532842f, 0.487264395f},
-std::array<float,2>{0.161405832f, 0.634104133f},
-std::array<float,2>{0.481987536f, 0.199264303f},
-std::array<float,2>{0.771321714f, 0.918614745f},
-std::array<float,2>{0.937726676f, 0.0934322551f},
-std::array<float,2>{0.28636232f, 0.750875115f},
-std::array<float,2>{0.075950183f, 0.329247802f},
-std::array<float,2>{0.62374568f, 0.551958859f},
-std::array<float,2>{0.633662283f, 0.0582063496f},
-std::array<float,2>{0.189629793f, 0.869454145f},
-std::array<float,2>{0.376837879f, 0.252857178f},
-std::array<float,2>{0.83120811f, 0.563313067f},
-std::array<float,2>{0.937309384f, 0.416936159f},
-std::array<float,2>{0.345021456f, 0.692059517f},
-std::array<float,2>{0.0153382123f, 0.156582221f},
-std::array<float,2>{0.538377047f, 0.94758904f},
-std::array<float,2>{0.583801627f, 0.371397525f},
-std::array<float,2>{0.10254208f, 0.520582974f},
-std::array<float,2>{0.252109617f, 0.103454642f},
-std::array<float,2>{0.968976796f, 0.794560492f},
-std::array<float,2>{0.805767477f, 0.233231395f},
-std::array<float,2>{0.456597894f, 0.885875821f},
-std::array<float,2>{0.141402036f, 0.441032946f},
-std::array<float,2>{0.730885983f, 0.676931202f},
-std::array<float,2>{0.674638093f, 0.171469361f},
-std::array<float,2>{0.21945484f, 0.943517983f},
-std::array<float,2>{0.432994574f, 0.413059026f},
-std::array<float,2>{0.845149398f, 0.698445737f},
-std::array<float,2>{0.887783468f, 0.261331022f},
-std::array<float,2>{0.318275571f, 0.577406883f},
-std::array<float,2>{0.0493446589f, 0.0520891473f},
-std::array<float,2>{0.526045382f, 0.866274297f},
-std::array<float,2>{0.613211393f, 0.446525216f},
-std::array<float,2>{0.0641436502f, 0.686499596f},
-std::array<float,2>{0.293832988f, 0.22341539f},
-std::array<float,2>{0.947140038f, 0.880488157f},
-std::array<float,2>{0.775241971f, 0.0969409496f},
-std::array<float,2>{0.469208121f, 0.782152534f},
-std::array<float,2>{0.164627045f, 0.363054097f},
-std::array<float,2>{0.695396483f, 0.53121829f},
-std::array<float,2>{0.546261251f, 0.0257212482f},
-std::array<float,2>{0.00618029898f, 0.815620184f},
-std::array<float,2>{0.356207103f, 0.311366975f},
-std::array<float,2>{0.924349129f, 0.609289408f},
-std::array<float,2>{0.840038359f, 0.380595624f},
-std::array<float,2>{0.389874935f, 0.722384334f},
-std::array<float,2>{0.197674319f, 0.153240532f},
-std::array<float,2>{0.630750835f, 0.971521258f},
-std::array<float,2>{0.721752286f, 0.338718712f},
-std::array<float,2>{0.149656132f, 0.558483899f},
-std::array<float,2>{0.465975374f, 0.0787078291f},
-std::array<float,2>{0.802552402f, 0.760631442f},
-std::array<float,2>{0.978167593f, 0.193872184f},
-std::array<float,2>{0.260346919f, 0.911906779f},
-std::array<float,2>{0.0970926359f, 0.497150451f},
-std::array<float,2>{0.590640306f, 0.631559908f},
-std::array<float,2>{0.570498586f, 0.241113707f},
-std::array<float,2>{0.121205792f, 0.905606627f},
-std::array<float,2>{0.277694792f, 0.46628201f},
-std::array<float,2>{0.989013433f, 0.671631932f},
-std::array<float,2>{0.786421239f, 0.355286777f},
-std::array<float,2>{0.438896596f, 0.515336335f},
-std::array<float,2>{0.135461643f, 0.118374057f},
-std::array<float,2>{0.742985487f, 0.807584643f},
-std::array<float,2>{0.652779162f, 0.435756952f},
-std::array<float,2>{0.210281834f, 0.707471371f},
-std::array<float,2>{0.39586398f, 0.181560546f},
-std::array<float,2>{0.827271104f, 0.95902127f},
-std::array<float,2>{0.920642138f, 0.0407828428f},
-std::array<float,2>{0.363544345f, 0.847378254f},
-std::array<float,2>{0.016086692f, 0.270912081f},
-std::array<float,2>{0.559634924f, 0.588103592f},
-std::array<float,2>{0.713109672f, 0.0636479482f},
-std::array<float,2>{0.172605306f, 0.768124223f},
-std::array<float,2>{0.491001606f, 0.317705065f},
-std::array<float,2>{0.759103358f, 0.546752572f},
-std::array<float,2>{0.965450644f, 0.480238587f},
-std::array<float,2>{0.306402087f, 0.655267179f},
-std::array<float,2>{0.0800837353f, 0.213972822f},
-std::array<float,2>{0.60079658f, 0.932909012f},
-std::array<float,2>{0.51393187f, 0.292232841f},
-std::array<float,2>{0.0316726305f, 0.613567114f},
-std::array<float,2>{0.335900068f, 0.00207473128f},
-std::array<float,2>{0.905448675f, 0.837567568f},
-std::array<float,2>{0.866008103f, 0.131144196f},
-std::array<float,2>{0.410699755f, 0.990344763f},
-std::array<float,2>{0.240083247f, 0.390967816f},
-std::array<float,2>{0.659415841f, 0.748894691f},
-std::array<float,2>{0.667524695f, 0.191319674f},
-std::array<float,2>{0.246491492f, 0.909694195f},
-std::array<float,2>{0.416476309f, 0.492243797f},
-std::array<float,2>{0.871178389f, 0.628676653f},
-std::array<float,2>{0.892562032f, 0.342095643f},
-std::array<float,2>{0.340934545f, 0.56197542f},
-std::array<float,2>{0.0443018675f, 0.0843357593f},
-std::array<float,2>{0.501792371f, 0.765245378f},
-std::array<float,2>{0.603878975f, 0.378758609f},
-std::array<float,2>{0.0921887457f, 0.722982764f},
-std::array<float,2>{0.301233232f, 0.150359809f},
-std::array<float,2>{0.95313406f, 0.975210726f},
-std::array<float,2>{0.750768542f, 0.0306643825f},
-std::array<float,2>{0.492860258f, 0.818455517f},
-std::array<float,2>{0.182553992f, 0.307688385f},
-std::array<float,2>{0.705890775f, 0.604652166f},
-std::array<float,2>{0.550350487f, 0.101097956f},
-std::array<float,2>{0.0292969085f, 0.787916064f},
-std::array<float,2>{0.368057877f, 0.365086645f},
-std::array<float,2>{0.913860261f, 0.526733518f},
-std::array<float,2>{0.814558268f, 0.451235831f},
-std::array<float,2>{0.404810011f, 0.681920886f},
-std::array<float,2>{0.214691773f, 0.221042916f},
-std::array<float,2>{0.640964448f, 0.877194941f},
-std::array<float,2>{0.741523325f, 0.264071167f},
-std::array<float,2>{0.132391572f, 0.573588848f},
-std::array<float,2>{0.447874457f, 0.0481588207f},
-std::array<float,2>{0.791047633f, 0.859793663f},
-std::array<float,2>{0.995726109f, 0.164770573f},
-std::array<float,2>{0.268719077f, 0.938197792f},
-std::array<float,2>{0.109427892f, 0.407274187f},
-std::array<float,2>{0.56506598f, 0.700861871f},
-std::array<float,2>{0.578901052f, 0.127589002f},
-std::array<float,2>{0.109215587f, 0.986539662f},
-std::array<float,2>{0.255907148f, 0.39599365f},
-std::array<float,2>{0.972766638f, 0.743775547f},
-std::array<float,2>{0.81197381f, 0.295877665f},
-std::array<float,2>{0.4603993f, 0.612568617f},
-std::array<float,2>{0.146640748f, 0.00603901595f},
-std::array<float,2>{0.728082418f, 0.843445182f},
-std::array<float,2>{0.637620509f, 0.480559736f},
-std::array<float,2>{0.19360368f, 0.650005639f},
-std::array<float,2>{0.382196426f, 0.217900127f},
-std::array<float,2>{0.833579361f, 0.936105132f},
-std::array<float,2>{0.931611001f, 0.0700957254f},
-std::array<float,2>{0.348649591f, 0.772381485f},
-std::array<float,2>{0.011313959f, 0.313782573f},
-std::array<float,2>{0.531256974f, 0.542628706f},
-std::array<float,2>{0.694307685f, 0.0449003018f},
-std::array<float,2>{0.159604117f, 0.848896801f},
-std::array<float,2>{0.478346139f, 0.267749131f},
-std::array<float,2>{0.769155502f, 0.592297614f},
-std::array<float,2>{0.942557812f, 0.430647224f},
-std::array<float,2>{0.282069355f, 0.706549287f},
-std::array<float,2>{0.072292082f, 0.186793581f},
-std::array<float,2>{0.620307982f, 0.954197824f},
-std::array<float,2>{0.523370266f, 0.357915282f},
-std::array<float,2>{0.0617341176f, 0.508017361f},
-std::array<float,2>{0.323912263f, 0.124833062f},
-std::array<float,2>{0.875401735f, 0.81020838f},
-std::array<float,2>{0.855684638f, 0.237476513f},
-std::array<float,2>{0.42731303f, 0.902114272f},
-std::array<float,2>{0.228700414f, 0.463092804f},
-std::array<float,2>{0.683124423f, 0.664135098f},
-std::array<float,2>{0.72385788f, 0.173391402f},
-std::array<float,2>{0.155442744f, 0.962343395f},
-std::array<float,2>{0.461723417f, 0.425570101f},
-std::array<float,2>{0.799943686f, 0.71871835f},
-std::array<float,2>{0.982537746f, 0.274810076f},
-std::array<float,2>{0.264903784f, 0.578761339f},
-std::array<float,2>{0.0997577533f, 0.0367368385f},
-std::array<float,2>{0.588267326f, 0.858359337f},
-std::array<float,2>{0.540687978f, 0.460391641f},
-std::array<float,2>{0.0014609819f, 0.663057983f},
-std::array<float,2>{0.35282141f, 0.243128583f},
-std::array<float,2>{0.927024543f, 0.894233704f},
-std::array<float,2>{0.837955296f, 0.113831468f},
-std::array<float,2>{0.383109003f, 0.798386514f},
-std::array<float,2>{0.201215968f, 0.343761057f},
-std::array<float,2>{0.625552297f, 0.50610292f},
-std::array<float,2>{0.615226865f, 0.0134884715f},
-std::array<float,2>{0.0698772743f, 0.83566308f},
-std::array<float,2>{0.291117311f, 0.288236856f},
-std::array<float,2>{0.950255692f, 0.621969104f},
-std::array<float,2>{0.780417502f, 0.405800492f},
-std::array<float,2>{0.475388676f, 0.734921336f},
-std::array<float,2>{0.17085813f, 0.135467991f},
-std::array<float,2>{0.700377107f, 0.994672596f},
-std::array<float,2>{0.678250551f, 0.322811991f},
-std::array<float,2>{0.226404667f, 0.535948873f},
-std::array<float,2>{0.434678555f, 0.072946772f},
-std::array<float,2>{0.850152612f, 0.780332148f},
-std::array<float,2>{0.884658039f, 0.20518066f},
-std::array<float,2>{0.312902272f, 0.921916008f},
-std::array<float,2>{0.052108869f, 0.47315824f},
-std::array<float,2>{0.528088093f, 0.644830704f},
-std::array<float,2>{0.510782897f, 0.227905408f},
-std::array<float,2>{0.0386174135f, 0.889514744f},
-std::array<float,2>{0.330890894f, 0.444216818f},
-std::array<float,2>{0.900058508f, 0.674907267f},
-std::array<float,2>{0.860681355f, 0.369950265f},
-std::array<float,2>{0.406685174f, 0.516443372f},
-std::array<float,2>{0.237852067f, 0.105798304f},
-std::array<float,2>{0.663025916f, 0.790341556f},
-std::array<float,2>{0.71493721f, 0.421070874f},
-std::array<float,2>{0.176340967f, 0.691043735f},
-std::array<float,2>{0.487498134f, 0.162865311f},
-std::array<float,2>{0.762279272f, 0.952865779f},
-std::array<float,2>{0.961504817f, 0.0595522374f},
-std::array<float,2>{0.309855878f, 0.873666108f},
-std::array<float,2>{0.0828073621f, 0.256833225f},
-std::array<float,2>{0.597174764f, 0.56674248f},
-std::array<float,2>{0.650403976f, 0.0859565958f},
-std::array<float,2>{0.205562711f, 0.755711615f},
-std::array<float,2>{0.393621296f, 0.334124625f},
-std::array<float,2>{0.820560813f, 0.549377978f},
-std::array<float,2>{0.91673398f, 0.490872502f},
-std::array<float,2>{0.359715998f, 0.639850497f},
-std::array<float,2>{0.0209971238f, 0.196227759f},
-std::array<float,2>{0.556708217f, 0.916607738f},
-std::array<float,2>{0.57521528f, 0.298740864f},
-std::array<float,2>{0.118423671f, 0.596120477f},
-std::array<float,2>{0.276250482f, 0.0173032247f},
-std::array<float,2>{0.987505376f, 0.82198f},
-std::array<float,2>{0.782215118f, 0.147311687f},
-std::array<float,2>{0.443472981f, 0.980517089f},
-std::array<float,2>{0.137989268f, 0.388800442f},
-std::array<float,2>{0.748211086f, 0.73224932f},
-std::array<float,2>{0.707212567f, 0.248817548f},
-std::array<float,2>{0.184123084f, 0.894594491f},
-std::array<float,2>{0.497104764f, 0.45329234f},
-std::array<float,2>{0.754123211f, 0.657007456f},
-std::array<float,2>{0.95893544f, 0.348136634f},
-std::array<float,2>{0.300712287f, 0.500037074f},
-std::array<float,2>{0.0870814472f, 0.109795243f},
-std::array<float,2>{0.607116759f, 0.802469313f},
-std::array<float,2>{0.504971266f, 0.427708983f},
-std::array<float,2>{0.0419530459f, 0.711753786f},
-std::array<float,2>{0.338334411f, 0.179061219f},
-std::array<float,2>{0.896617472f, 0.966251016f},
-std::array<float,2>{0.868984818f, 0.0350226574f},
-std::array<float,2>{0.418195814f, 0.85518235f},
-std::array<float,2>{0.245783404f, 0.280775249f},
-std::array<float,2>{0.668197751f, 0.585460842f},
-std::array<float,2>{0.567270041f, 0.0780781135f},
-std::array<float,2>{0.116173767f, 0.774717212f},
-std::array<float,2>{0.270970523f, 0.326428741f},
-std::array<float,2>{0.998406887f, 0.534852266f},
-std::array<float,2>{0.793178737f, 0.470368028f},
-std::array<float,2>{0.450312078f, 0.641115427f},
-std::array<float,2>{0.128522485f, 0.210162029f},
-std::array<float,2>{0.734889507f, 0.927804291f},
-std::array<float,2>{0.646389306f, 0.28434056f},
-std::array<float,2>{0.216544405f, 0.618143857f},
-std::array<float,2>{0.400146276f, 0.0100150034f},
-std::array<float,2>{0.816545069f, 0.82856065f},
-std::array<float,2>{0.909652054f, 0.138281271f},
-std::array<float,2>{0.371419191f, 0.999360204f},
-std::array<float,2>{0.0269344188f, 0.400970668f},
-std::array<float,2>{0.554646194f, 0.74130553f},
-std::array<float,2>{0.536360919f, 0.160048723f},
-std::array<float,2>{0.0126207601f, 0.947107673f},
-std::array<float,2>{0.3461456f, 0.41494292f},
-std::array<float,2>{0.934199452f, 0.694397271f},
-std::array<float,2>{0.828633249f, 0.250824898f},
-std::array<float,2>{0.378880292f, 0.56573534f},
-std::array<float,2>{0.188688293f, 0.0565191172f},
-std::array<float,2>{0.636203349f, 0.868486524f},
-std::array<float,2>{0.734275639f, 0.43799299f},
-std::array<float,2>{0.14311181f, 0.678118408f},
-std::array<float,2>{0.453192234f, 0.232072577f},
-std::array<float,2>{0.806693852f, 0.883968711f},
-std::array<float,2>{0.970724344f, 0.105231345f},
-std::array<float,2>{0.250807464f, 0.795921922f},
-std::array<float,2>{0.104229517f, 0.374805361f},
-std::array<float,2>{0.584733188f, 0.522912621f},
-std::array<float,2>{0.685115337f, 0.0226497035f},
-std::array<float,2>{0.23121278f, 0.827506185f},
-std::array<float,2>{0.422284365f, 0.302859157f},
-std::array<float,2>{0.853226125f, 0.598750114f},
-std::array<float,2>{0.880118787f, 0.384481996f},
-std::array<float,2>{0.324435025f, 0.72657454f},
-std::array<float,2>{0.0556179956f, 0.144454822f},
-std::array<float,2>{0.517390847f, 0.978990912f},
-std::array<float,2>{0.62175703f, 0.331775099f},
-std::array<float,2>{0.0763591453f, 0.554660678f},
-std::array<float,2>{0.289000541f, 0.0912305266f},
-std::array<float,2>{0.939753711f, 0.75257355f},
-std::array<float,2>{0.773368478f, 0.202865914f},
-std::array<float,2>{0.484090358f, 0.920215189f},
-std::array<float,2>{0.162192345f, 0.484462202f},
-std::array<float,2>{0.690463543f, 0.634831786f},
-std::array<float,2>{0.630923927f, 0.154411376f},
-std::array<float,2>{0.195481271f, 0.969626129f},
-std::array<float,2>{0.386726826f, 0.381678432f},
-std::array<float,2>{0.843667746f, 0.720685959f},
-std::array<float,2>{0.922956347f, 0.310303926f},
-std::array<float,2>{0.35810256f, 0.606840551f},
-std::array<float,2>{0.00571421999f, 0.0237002037f},
-std::array<float,2>{0.542975962f, 0.813765287f},
-std::array<float,2>{0.593680263f, 0.49819693f},
-std::array<float,2>{0.0942257494f, 0.629294753f},
-std::array<float,2>{0.258811325f, 0.192898318f},
-std::array<float,2>{0.979881406f, 0.912909269f},
-std::array<float,2>{0.804053307f, 0.0813674927f},
-std::array<float,2>{0.467430145f, 0.758310676f},
-std::array<float,2>{0.152104095f, 0.337102145f},
-std::array<float,2>{0.719221175f, 0.556530952f},
-std::array<float,2>{0.523813725f, 0.0537784919f},
-std::array<float,2>{0.047260534f, 0.864755809f},
-std::array<float,2>{0.318641186f, 0.258835644f},
-std::array<float,2>{0.889977872f, 0.575614929f},
-std::array<float,2>{0.846847713f, 0.411464542f},
-std::array<float,2>{0.430046678f, 0.697079301f},
-std::array<float,2>{0.222141027f, 0.169237062f},
-std::array<float,2>{0.672149539f, 0.941971838f},
-std::array<float,2>{0.697989225f, 0.359673142f},
-std::array<float,2>{0.167877197f, 0.528652012f},
-std::array<float,2>{0.472407341f, 0.0947193429f},
-std::array<float,2>{0.776420474f, 0.784173727f},
-std::array<float,2>{0.947345674f, 0.225218385f},
-std::array<float,2>{0.295814186f, 0.881614029f},
-std::array<float,2>{0.0656390041f, 0.447861075f},
-std::array<float,2>{0.610932291f, 0.684814453f},
-std::array<float,2>{0.599093795f, 0.212866545f},
-std::array<float,2>{0.0787757337f, 0.92993623f},
-std::array<float,2>{0.308197349f, 0.477514654f},
-std::array<float,2>{0.967272103f, 0.65363884f},
-std::array<float,2>{0.761172652f, 0.319461763f},
-std::array<float,2>{0.488636583f, 0.543467462f},
-std::array<float,2>{0.17419742f, 0.0655207783f},
-std::array<float,2>{0.711684883f, 0.767408669f},
-std::array<float,2>{0.656426132f, 0.393039793f},
-std::array<float,2>{0.241989404f, 0.748020709f},
-std::array<float,2>{0.412605971f, 0.129110619f},
-std::array<float,2>{0.863903522f, 0.989863098f},
-std::array<float,2>{0.903682828f, 0.000347384455f},
-std::array<float,2>{0.33211413f, 0.839094579f},
-std::array<float,2>{0.0340269879f, 0.290810823f},
-std::array<float,2>{0.513359964f, 0.615692854f},
-std::array<float,2>{0.745723903f, 0.119432546f},
-std::array<float,2>{0.133267105f, 0.806086659f},
-std::array<float,2>{0.439888358f, 0.351764411f},
-std::array<float,2>{0.78763473f, 0.511963606f},
-std::array<float,2>{0.990524769f, 0.467134446f},
-std::array<float,2>{0.280847728f, 0.669582427f},
-std::array<float,2>{0.12330921f, 0.239609972f},
-std::array<float,2>{0.57307601f, 0.903827071f},
-std::array<float,2>{0.562281489f, 0.272489697f},
-std::array<float,2>{0.0191886202f, 0.586527348f},
-std::array<float,2>{0.366254568f, 0.0411748216f},
-std::array<float,2>{0.919277251f, 0.845656574f},
-std::array<float,2>{0.82460475f, 0.182574496f},
-std::array<float,2>{0.396554947f, 0.957347512f},
-std::array<float,2>{0.207627803f, 0.435305774f},
-std::array<float,2>{0.654722631f, 0.709010184f},
-std::array<float,2>{0.639093161f, 0.21697104f},
-std::array<float,2>{0.192088902f, 0.936870396f},
-std::array<float,2>{0.379535198f, 0.481484741f},
-std::array<float,2>{0.834910929f, 0.64883548f},
-std::array<float,2>{0.932137251f, 0.313196689f},
-std::array<float,2>{0.350877911f, 0.541613877f},
-std::array<float,2>{0.00956526678f, 0.0688513368f},
-std::array<float,2>{0.534286022f, 0.773140848f},
-std::array<float,2>{0.581682801f, 0.394566745f},
-std::array<float,2>{0.107345499f, 0.742230475f},
-std::array<float,2>{0.25435707f, 0.128094077f},
-std::array<float,2>{0.975260913f, 0.987463772f},
-std::array<float,2>{0.809928f, 0.0074811792f},
-std::array<float,2>{0.458222538f, 0.842140615f},
-std::array<float,2>{0.145488322f, 0.296648264f},
-std::array<float,2>{0.728833377f, 0.611641645f},
-std::array<float,2>{0.520394444f, 0.123952724f},
-std::array<float,2>{0.0597466975f, 0.809160352f},
-std::array<float,2>{0.320552588f, 0.358937979f},
-std::array<float,2>{0.87802285f, 0.508973002f},
-std::array<float,2>{0.858363509f, 0.464189321f},
-std::array<float,2>{0.429683268f, 0.66507405f},
-std::array<float,2>{0.22840187f, 0.236871913f},
-std::array<float,2>{0.680529058f, 0.901011944f},
-std::array<float,2>{0.692928851f, 0.268888623f},
-std::array<float,2>{0.157235384f, 0.593678176f},
-std::array<float,2>{0.478699625f, 0.0438522846f},
-std::array<float,2>{0.766204f, 0.848161101f},
-std::array<float,2>{0.944573581f, 0.185999304f},
-std::array<float,2>{0.283838063f, 0.953823328f},
-std::array<float,2>{0.0714699477f, 0.430697262f},
-std::array<float,2>{0.618040144f, 0.705171227f},
-std::array<float,2>{0.602447927f, 0.149241731f},
-std::array<float,2>{0.0906017572f, 0.975881159f},
-std::array<float,2>{0.304211527f, 0.377132684f},
-std::array<float,2>{0.95609206f, 0.724523723f},
-std::array<float,2>{0.752982616f, 0.307314306f},
-std::array<float,2>{0.494322449f, 0.604241848f},
-std::array<float,2>{0.180981562f, 0.0296106581f},
-std::array<float,2>{0.703721046f, 0.819989383f},
-std::array<float,2>{0.664771616f, 0.493481964f},
-std::array<float,2>{0.249376252f, 0.6269719f},
-std::array<float,2>{0.415479392f, 0.189485714f},
-std::array<float,2>{0.873470008f, 0.908522487f},
-std::array<float,2>{0.893839598f, 0.0858152509f},
-std::array<float,2>{0.342660517f, 0.763870835f},
-std::array<float,2>{0.0449942425f, 0.343383044f},
-std::array<float,2>{0.50304687f, 0.561501265f},
-std::array<float,2>{0.739362836f, 0.0476142205f},
-std::array<float,2>{0.130271256f, 0.861034214f},
-std::array<float,2>{0.446225911f, 0.2650415f},
-std::array<float,2>{0.789605856f, 0.573213339f},
-std::array<float,2>{0.993358731f, 0.407191217f},
-std::array<float,2>{0.266521007f, 0.7000525f},
-std::array<float,2>{0.113062218f, 0.165937185f},
-std::array<float,2>{0.563071966f, 0.939222574f},
-std::array<float,2>{0.547008753f, 0.363507628f},
-std::array<float,2>{0.0275959689f, 0.525978208f},
-std::array<float,2>{0.371018529f, 0.100210652f},
-std::array<float,2>{0.910839319f, 0.788895607f},
-std::array<float,2>{0.813526452f, 0.222335055f},
-std::array<float,2>{0.403171778f, 0.878832996f},
-std::array<float,2>{0.212791815f, 0.452668995f},
-std::array<float,2>{0.642621219f, 0.683335006f},
-std::array<float,2>{0.716827989f, 0.163696751f},
-std::array<float,2>{0.179169118f, 0.951517999f},
-std::array<float,2>{0.486006528f, 0.420541555f},
-std::array<float,2>{0.76388222f, 0.690205216f},
-std::array<float,2>{0.96366936f, 0.257369399f},
-std::array<float,2>{0.311437994f, 0.567514539f},
-std::array<float,2>{0.0858547166f, 0.0602592602f},
-std::array<float,2>{0.595184207f, 0.874795079f},
-std::array<float,2>{0.509016335f, 0.444758236f},
-std::array<float,2>{0.035791833f, 0.673951328f},
-std::array<float,2>{0.329661757f, 0.227471769f},
-std::array<float,2>{0.900877237f, 0.890092313f},
-std::array<float,2>{0.862870753f, 0.106542505f},
-std::array<float,2>{0.409928948f, 0.789098084f},
-std::array<float,2>{0.236072719f, 0.370507538f},
-std::array<float,2>{0.661162674f, 0.516926825f},
-std::array<float,2>{0.577129304f, 0.0157999899f},
-std::array<float,2>{0.120637454f, 0.820585489f},
-std::array<float,2>{0.274286747f, 0.297759652f},
-std::array<float,2>{0.985612631f, 0.596832156f},
-std::array<float,2>{0.784252405f, 0.38996309f},
-std::array<float,2>{0.441821873f, 0.731010735f},
-std::array<float,2>{0.138950124f, 0.147826701f},
-std::array<float,2>{0.746681035f, 0.982194424f},
-std::array<float,2>{0.648579955f, 0.335728109f},
-std::array<float,2>{0.203679219f, 0.550250113f},
-std::array<float,2>{0.39072147f, 0.086926803f},
-std::array<float,2>{0.82270354f, 0.754719317f},
-std::array<float,2>{0.915881693f, 0.196651638f},
-std::array<float,2>{0.362488776f, 0.917394578f},
-std::array<float,2>{0.0217783786f, 0.492054015f},
-std::array<float,2>{0.556537032f, 0.638852656f},
-std::array<float,2>{0.541196048f, 0.24405387f},
-std::array<float,2>{0.00240768353f, 0.892668605f},
-std::array<float,2>{0.354965538f, 0.459657907f},
-std::array<float,2>{0.928508759f, 0.663218915f},
-std::array<float,2>{0.836398005f, 0.344782054f},
-std::array<float,2>{0.386243105f, 0.507490635f},
-std::array<float,2>{0.199266702f, 0.114512891f},
-std::array<float,2>{0.627201617f, 0.797222793f},
-std::array<float,2>{0.725417852f, 0.423892349f},
-std::array<float,2>{0.153322026f, 0.717142761f},
-std::array<float,2>{0.463124603f, 0.171966612f},
-std::array<float,2>{0.79727757f, 0.961178958f},
-std::array<float,2>{0.980617762f, 0.0359565094f},
-std::array<float,2>{0.262123436f, 0.859040558f},
-std::array<float,2>{0.0985446423f, 0.27406019f},
-std::array<float,2>{0.587822616f, 0.579104781f},
-std::array<float,2>{0.675853193f, 0.074065879f},
-std::array<float,2>{0.22422719f, 0.779666305f},
-std::array<float,2>{0.435800314f, 0.323352277f},
-std::array<float,2>{0.848733962f, 0.536418319f},
-std::array<float,2>{0.88593787f, 0.474528164f},
-std::array<float,2>{0.315128863f, 0.646450281f},
-std::array<float,2>{0.054145325f, 0.206088111f},
-std::array<float,2>{0.529555798f, 0.923598588f},
-std::array<float,2>{0.616465509f, 0.287510574f},
-std::array<float,2>{0.0677757412f, 0.622907102f},
-std::array<float,2>{0.289332956f, 0.0119539211f},
-std::array<float,2>{0.952501655f, 0.834849894f},
-std::array<float,2>{0.777682126f, 0.135749146f},
-std::array<float,2>{0.474150479f, 0.995169044f},
-std::array<float,2>{0.16969642f, 0.404772997f},
-std::array<float,2>{0.701219559f, 0.735480666f},
-std::array<float,2>{0.731722057f, 0.231043234f},
-std::array<float,2>{0.142552018f, 0.883523285f},
-std::array<float,2>{0.45511502f, 0.438736916f},
-std::array<float,2>{0.805145681f, 0.678885996f},
-std::array<float,2>{0.970472276f, 0.373114318f},
-std::array<float,2>{0.253816068f, 0.522212207f},
-std::array<float,2>{0.101720937f, 0.104040138f},
-std::array<float,2>{0.583002269f, 0.795321763f},
-std::array<float,2>{0.537275016f, 0.415257514f},
-std::array<float,2>{0.0141150104f, 0.693359792f},
-std::array<float,2>{0.34396711f, 0.159055397f},
-std::array<float,2>{0.935700536f, 0.94604063f},
-std::array<float,2>{0.830338299f, 0.0551119298f},
-std::array<float,2>{0.375578105f, 0.867760539f},
-std::array<float,2>{0.1910761f, 0.251505584f},
-std::array<float,2>{0.634455085f, 0.564754009f},
-std::array<float,2>{0.624587655f, 0.0907853097f},
-std::array<float,2>{0.0747041032f, 0.753323734f},
-std::array<float,2>{0.285287261f, 0.330572724f},
-std::array<float,2>{0.938542843f, 0.553166926f},
-std::array<float,2>{0.769608438f, 0.486145139f},
-std::array<float,2>{0.480524719f, 0.636251926f},
-std::array<float,2>{0.160901561f, 0.201936036f},
-std::array<float,2>{0.688883245f, 0.921790481f},
-std::array<float,2>{0.68628186f, 0.303984016f},
-std::array<float,2>{0.232571617f, 0.597805977f},
-std::array<float,2>{0.424471527f, 0.0223681554f},
-std::array<float,2>{0.853885949f, 0.826426923f},
-std::array<float,2>{0.882795274f, 0.142619103f},
-std::array<float,2>{0.326853096f, 0.979808211f},
-std::array<float,2>{0.0577340797f, 0.383000314f},
-std::array<float,2>{0.518721282f, 0.727993846f},
-std::array<float,2>{0.506838024f, 0.177794948f},
-std::array<float,2>{0.0401611738f, 0.964897752f},
-std::array<float,2>{0.336393625f, 0.425803155f},
-std::array<float,2>{0.896133006f, 0.712658644f},
-std::array<float,2>{0.869744778f, 0.279826403f},
-std::array<float,2>{0.420302153f, 0.584561348f},
-std::array<float,2>{0.242363602f, 0.0332342945f},
-std::array<float,2>{0.671006739f, 0.853562176f},
-std::array<float,2>{0.710249603f, 0.454509616f},
-std::array<float,2>{0.186637267f, 0.657587469f},
-std::array<float,2>{0.498426616f, 0.249092758f},
-std::array<float,2>{0.756732106f, 0.895565212f},
-std::array<float,2>{0.96028775f, 0.110754587f},
-std::array<float,2>{0.297846407f, 0.801296055f},
-std::array<float,2>{0.0896334723f, 0.348979831f},
-std::array<float,2>{0.608302534f, 0.50173521f},
-std::array<float,2>{0.646642983f, 0.010885803f},
-std::array<float,2>{0.21692358f, 0.829479098f},
-std::array<float,2>{0.400735825f, 0.284073263f},
-std::array<float,2>{0.819271207f, 0.61887008f},
-std::array<float,2>{0.906832159f, 0.401967376f},
-std::array<float,2>{0.374552995f, 0.740855038f},
-std::array<float,2>{0.0250822213f, 0.13708742f},
-std::array<float,2>{0.552660406f, 0.998769641f},
-std::array<float,2>{0.568595946f, 0.327989131f},
-std::array<float,2>{0.114694849f, 0.534023523f},
-std::array<float,2>{0.271560192f, 0.0762187913f},
-std::array<float,2>{0.997905254f, 0.774044991f},
-std::array<float,2>{0.795562387f, 0.20986788f},
-std::array<float,2>{0.453049392f, 0.929234207f},
-std::array<float,2>{0.12636967f, 0.469506681f},
-std::array<float,2>{0.738012075f, 0.642287493f},
-std::array<float,2>{0.658358932f, 0.130465642f},
-std::array<float,2>{0.238681749f, 0.988336921f},
-std::array<float,2>{0.411430061f, 0.393658787f},
-std::array<float,2>{0.866649151f, 0.746447086f},
-std::array<float,2>{0.90454793f, 0.289214432f},
-std::array<float,2>{0.334523231f, 0.616573393f},
-std::array<float,2>{0.0328067616f, 0.00123218563f},
-std::array<float,2>{0.514849782f, 0.838204563f},
-std::array<float,2>{0.600366473f, 0.478048652f},
-std::array<float,2>{0.0815970674f, 0.653059006f},
-std::array<float,2>{0.305364758f, 0.21131219f},
-std::array<float,2>{0.965841353f, 0.931628346f},
-std::array<float,2>{0.758576632f, 0.0651359111f},
-std::array<float,2>{0.492106825f, 0.76641351f},
-std::array<float,2>{0.173171535f, 0.319180667f},
-std::array<float,2>{0.714691818f, 0.544100404f},
-std::array<float,2>{0.558755994f, 0.04293238f},
-std::array<float,2>{0.0168729033f, 0.844615638f},
-std::array<float,2>{0.364499301f, 0.271767259f},
-std::array<float,2>{0.921066523f, 0.587330222f},
-std::array<float,2>{0.826536477f, 0.434140593f},
-std::array<float,2>{0.395375073f, 0.710092068f},
-std::array<float,2>{0.209510684f, 0.183119938f},
-std::array<float,2>{0.653421819f, 0.958422959f},
-std::array<float,2>{0.74397105f, 0.352871329f},
-std::array<float,2>{0.13658905f, 0.512729883f},
-std::array<float,2>{0.438015074f, 0.120118581f},
-std::array<float,2>{0.785774112f, 0.804691315f},
-std::array<float,2>{0.990106225f, 0.238518625f},
-std::array<float,2>{0.279175788f, 0.902383029f},
-std::array<float,2>{0.122712612f, 0.467855722f},
-std::array<float,2>{0.572059333f, 0.668547809f},
-std::array<float,2>{0.591027319f, 0.191768467f},
-std::array<float,2>{0.0962464362f, 0.913740635f},
-std::array<float,2>{0.261201262f, 0.499154955f},
-std::array<float,2>{0.976801217f, 0.630849123f},
-std::array<float,2>{0.801099539f, 0.336483121f},
-std::array<float,2>{0.465201586f, 0.555387735f},
-std::array<float,2>{0.149303451f, 0.0807979554f},
-std::array<float,2>{0.720867097f, 0.759153306f},
-std::array<float,2>{0.629550397f, 0.381873608f},
-std::array<float,2>{0.1991909f, 0.718853474f},
-std::array<float,2>{0.38927415f, 0.155968517f},
-std::array<float,2>{0.840920627f, 0.970228672f},
-std::array<float,2>{0.925168753f, 0.0244916026f},
-std::array<float,2>{0.356765956f, 0.813437641f},
-std::array<float,2>{0.00723477872f, 0.308615834f},
-std::array<float,2>{0.545780122f, 0.606285453f},
-std::array<float,2>{0.696363091f, 0.0952235609f},
-std::array<float,2>{0.165848419f, 0.784626603f},
-std::array<float,2>{0.46976763f, 0.361189097f},
-std::array<float,2>{0.774368167f, 0.527535439f},
-std::array<float,2>{0.946279943f, 0.448318422f},
-std::array<float,2>{0.294138044f, 0.683671057f},
-std::array<float,2>{0.0634345338f, 0.22596778f},
-std::array<float,2>{0.611586869f, 0.882321179f},
-std::array<float,2>{0.527231336f, 0.25802967f},
-std::array<float,2>{0.0500936657f, 0.574502349f},
-std::array<float,2>{0.317290753f, 0.0535649098f},
-std::array<float,2>{0.887119412f, 0.863576412f},
-std::array<float,2>{0.84445405f, 0.16860874f},
-std::array<float,2>{0.43194434f, 0.942764223f},
-std::array<float,2>{0.220149517f, 0.410320044f},
-std::array<float,2>{0.675371885f, 0.695408344f},
-std::array<float,2>{0.681802273f, 0.236139357f},
-std::array<float,2>{0.230193406f, 0.900335014f},
-std::array<float,2>{0.426235139f, 0.462299347f},
-std::array<float,2>{0.856546283f, 0.667546153f},
-std::array<float,2>{0.87679714f, 0.356061041f},
-std::array<float,2>{0.322701603f, 0.511430264f},
-std::array<float,2>{0.0609756596f, 0.121756561f},
-std::array<float,2>{0.522230387f, 0.811999738f},
-std::array<float,2>{0.619683862f, 0.432882398f},
-std::array<float,2>{0.0734524503f, 0.704894364f},
-std::array<float,2>{0.282320619f, 0.184827462f},
-std::array<float,2>{0.942317188f, 0.956694603f},
-std::array<float,2>{0.767770052f, 0.0451855808f},
-std::array<float,2>{0.476636887f, 0.850340784f},
-std::array<float,2>{0.158998713f, 0.266586155f},
-std::array<float,2>{0.695066273f, 0.591614842f},
-std::array<float,2>{0.53274858f, 0.0664433241f},
-std::array<float,2>{0.0101550771f, 0.769589782f},
-std::array<float,2>{0.348040998f, 0.315362185f},
-std::array<float,2>{0.930223227f, 0.53979373f},
-std::array<float,2>{0.832192242f, 0.483543396f},
-std::array<float,2>{0.381754309f, 0.651029825f},
-std::array<float,2>{0.195052668f, 0.214932948f},
-std::array<float,2>{0.638054967f, 0.933611333f},
-std::array<float,2>{0.727332294f, 0.293222487f},
-std::array<float,2>{0.14834246f, 0.61052835f},
-std::array<float,2>{0.459126472f, 0.00421160692f},
-std::array<float,2>{0.811001182f, 0.8410905f},
-std::array<float,2>{0.974438369f, 0.125188559f},
-std::array<float,2>{0.256869465f, 0.985233307f},
-std::array<float,2>{0.107880719f, 0.397796631f},
-std::array<float,2>{0.579135358f, 0.744945288f},
-std::array<float,2>{0.56564796f, 0.166523799f},
-std::array<float,2>{0.110817172f, 0.93994087f},
-std::array<float,2>{0.267807454f, 0.409083992f},
-std::array<float,2>{0.994460464f, 0.701868117f},
-std::array<float,2>{0.792303979f, 0.262766004f},
-std::array<float,2>{0.44880712f, 0.570916414f},
-std::array<float,2>{0.131707549f, 0.0501802601f},
-std::array<float,2>{0.74040246f, 0.862216353f},
-std::array<float,2>{0.641883492f, 0.450936735f},
-std::array<float,2>{0.213200495f, 0.68041116f},
-std::array<float,2>{0.405396312f, 0.219306886f},
-std::array<float,2>{0.816072464f, 0.875044227f},
-std::array<float,2>{0.912461698f, 0.0983455479f},
-std::array<float,2>{0.368918449f, 0.786674738f},
-std::array<float,2>{0.0307123773f, 0.366605997f},
-std::array<float,2>{0.548904777f, 0.525263965f},
-std::array<float,2>{0.706055582f, 0.0292227883f},
-std::array<float,2>{0.183378607f, 0.818350732f},
-std::array<float,2>{0.494075716f, 0.305786848f},
-std::array<float,2>{0.751710713f, 0.60283494f},
-std::array<float,2>{0.954455197f, 0.37628746f},
-std::array<float,2>{0.302296191f, 0.725556731f},
-std::array<float,2>{0.0934334621f, 0.152116969f},
-std::array<float,2>{0.60538131f, 0.972871959f},
-std::array<float,2>{0.50033915f, 0.33993277f},
-std::array<float,2>{0.0436295569f, 0.559937537f},
-std::array<float,2>{0.340099633f, 0.0824226141f},
-std::array<float,2>{0.890871942f, 0.761921465f},
-std::array<float,2>{0.872984767f, 0.188668355f},
-std::array<float,2>{0.417120695f, 0.906934023f},
-std::array<float,2>{0.24779743f, 0.495640665f},
-std::array<float,2>{0.666285574f, 0.626829743f},
-std::array<float,2>{0.749312758f, 0.144598663f},
-std::array<float,2>{0.13733077f, 0.984020293f},
-std::array<float,2>{0.445146322f, 0.388328016f},
-std::array<float,2>{0.782422304f, 0.732723415f},
-std::array<float,2>{0.98638314f, 0.299716562f},
-std::array<float,2>{0.277308106f, 0.595569134f},
-std::array<float,2>{0.117869526f, 0.018305378f},
-std::array<float,2>{0.574911833f, 0.822983384f},
-std::array<float,2>{0.558114707f, 0.48906213f},
-std::array<float,2>{0.0198220108f, 0.638271511f},
-std::array<float,2>{0.361156166f, 0.198554009f},
-std::array<float,2>{0.917396903f, 0.915002763f},
-std::array<float,2>{0.822136164f, 0.0890512019f},
-std::array<float,2>{0.392965764f, 0.756999671f},
-std::array<float,2>{0.206817016f, 0.332531273f},
-std::array<float,2>{0.651450455f, 0.547710776f},
-std::array<float,2>{0.59626466f, 0.0614379309f},
-std::array<float,2>{0.0839403644f, 0.872716367f},
-std::array<float,2>{0.308738679f, 0.254766881f},
-std::array<float,2>{0.962103367f, 0.569557488f},
-std::array<float,2>{0.763373733f, 0.41844368f},
-std::array<float,2>{0.486480683f, 0.687916517f},
-std::array<float,2>{0.177348018f, 0.161441103f},
-std::array<float,2>{0.716354907f, 0.950073361f},
-std::array<float,2>{0.663553357f, 0.367944717f},
-std::array<float,2>{0.236387655f, 0.519519687f},
-std::array<float,2>{0.408018768f, 0.108109958f},
-std::array<float,2>{0.860238671f, 0.79148078f},
-std::array<float,2>{0.899056137f, 0.22997658f},
-std::array<float,2>{0.33145839f, 0.887381792f},
-std::array<float,2>{0.0377439409f, 0.442621768f},
-std::array<float,2>{0.510274172f, 0.672759831f},
-std::array<float,2>{0.529035628f, 0.204775825f},
-std::array<float,2>{0.0511670224f, 0.924272954f},
-std::array<float,2>{0.314206451f, 0.476148009f},
-std::array<float,2>{0.882949293f, 0.64841944f},
-std::array<float,2>{0.851390541f, 0.320650965f},
-std::array<float,2>{0.434078038f, 0.538407981f},
-std::array<float,2>{0.225472763f, 0.0706260949f},
-std::array<float,2>{0.679433942f, 0.779153109f},
-std::array<float,2>{0.699290633f, 0.404068232f},
-std::array<float,2>{0.170904204f, 0.738255024f},
-std::array<float,2>{0.476355046f, 0.134559125f},
-std::array<float,2>{0.779747546f, 0.99402988f},
-std::array<float,2>{0.949532211f, 0.0155891171f},
-std::array<float,2>{0.292212605f, 0.832660377f},
-std::array<float,2>{0.0686857253f, 0.285307884f},
-std::array<float,2>{0.613440812f, 0.623633742f},
-std::array<float,2>{0.626212597f, 0.115519404f},
-std::array<float,2>{0.202227578f, 0.799702168f},
-std::array<float,2>{0.384734154f, 0.346003681f},
-std::array<float,2>{0.839659989f, 0.504203141f},
-std::array<float,2>{0.926731884f, 0.458759069f},
-std::array<float,2>{0.352416575f, 0.66042012f},
-std::array<float,2>{0.00010532033f, 0.244525626f},
-std::array<float,2>{0.539861023f, 0.890737355f},
-std::array<float,2>{0.589731812f, 0.276467085f},
-std::array<float,2>{0.100825317f, 0.580601454f},
-std::array<float,2>{0.264444172f, 0.0380629711f},
-std::array<float,2>{0.984265506f, 0.857108891f},
-std::array<float,2>{0.799108744f, 0.175263524f},
-std::array<float,2>{0.462725312f, 0.964476705f},
-std::array<float,2>{0.1548177f, 0.423119158f},
-std::array<float,2>{0.723184586f, 0.716132462f},
-std::array<float,2>{0.690341473f, 0.201011047f},
-std::array<float,2>{0.163123697f, 0.919157624f},
-std::array<float,2>{0.483384967f, 0.487562001f},
-std::array<float,2>{0.772250116f, 0.633406997f},
-std::array<float,2>{0.940705955f, 0.328647077f},
-std::array<float,2>{0.287525892f, 0.551602244f},
-std::array<float,2>{0.0779757872f, 0.0920965895f},
-std::array<float,2>{0.622920692f, 0.751875043f},
-std::array<float,2>{0.516595781f, 0.386468202f},
-std::array<float,2>{0.0561090894f, 0.7299335f},
-std::array<float,2>{0.32562989f, 0.142341703f},
-std::array<float,2>{0.879855692f, 0.977168679f},
-std::array<float,2>{0.852050066f, 0.0199329257f},
-std::array<float,2>{0.423806518f, 0.825686097f},
-std::array<float,2>{0.231793389f, 0.301318198f},
-std::array<float,2>{0.683848679f, 0.600818098f},
-std::array<float,2>{0.585029662f, 0.102414176f},
-std::array<float,2>{0.105228305f, 0.793516099f},
-std::array<float,2>{0.251169205f, 0.372281462f},
-std::array<float,2>{0.972005785f, 0.52012217f},
-std::array<float,2>{0.808469653f, 0.439918607f},
-std::array<float,2>{0.454229057f, 0.675997376f},
-std::array<float,2>{0.144300729f, 0.233505815f},
-std::array<float,2>{0.733208954f, 0.885481775f},
-std::array<float,2>{0.635426641f, 0.253681064f},
-std::array<float,2>{0.188276529f, 0.564379632f},
-std::array<float,2>{0.377759159f, 0.0576120466f},
-std::array<float,2>{0.829657853f, 0.870342791f},
-std::array<float,2>{0.935286283f, 0.157373667f},
-std::array<float,2>{0.347324878f, 0.948377132f},
-std::array<float,2>{0.0133300768f, 0.417191148f},
-std::array<float,2>{0.53608793f, 0.692553341f},
-std::array<float,2>{0.552755237f, 0.14017202f},
-std::array<float,2>{0.025679186f, 0.99698621f},
-std::array<float,2>{0.372480005f, 0.398714423f},
-std::array<float,2>{0.908313215f, 0.739985824f},
-std::array<float,2>{0.818222702f, 0.282136291f},
-std::array<float,2>{0.398608595f, 0.619724274f},
-std::array<float,2>{0.215156689f, 0.0081645688f},
-std::array<float,2>{0.644563496f, 0.831807613f},
-std::array<float,2>{0.736234069f, 0.470811546f},
-std::array<float,2>{0.127607122f, 0.643562138f},
-std::array<float,2>{0.449678659f, 0.208971977f},
-std::array<float,2>{0.794085681f, 0.925895989f},
-std::array<float,2>{0.999304891f, 0.0751456544f},
-std::array<float,2>{0.26957041f, 0.776464224f},
-std::array<float,2>{0.116818272f, 0.32579428f},
-std::array<float,2>{0.568139553f, 0.532453418f},
-std::array<float,2>{0.669264078f, 0.0320999213f},
-std::array<float,2>{0.245021865f, 0.853034556f},
-std::array<float,2>{0.4197658f, 0.278848559f},
-std::array<float,2>{0.868084371f, 0.583109438f},
-std::array<float,2>{0.898152947f, 0.428747237f},
-std::array<float,2>{0.338922679f, 0.714569628f},
-std::array<float,2>{0.0422397293f, 0.176346213f},
-std::array<float,2>{0.504151881f, 0.968063116f},
-std::array<float,2>{0.605526924f, 0.350713521f},
-std::array<float,2>{0.0862898529f, 0.503711283f},
-std::array<float,2>{0.298978597f, 0.111372426f},
-std::array<float,2>{0.957298636f, 0.804432452f},
-std::array<float,2>{0.75501436f, 0.247672826f},
-std::array<float,2>{0.496799052f, 0.896521807f},
-std::array<float,2>{0.185209155f, 0.455872834f},
-std::array<float,2>{0.708732665f, 0.659351349f},
-std::array<float,2>{0.655441403f, 0.18002969f},
-std::array<float,2>{0.208654046f, 0.960689723f},
-std::array<float,2>{0.397987783f, 0.437177896f},
-std::array<float,2>{0.825662196f, 0.708970368f},
-std::array<float,2>{0.918021321f, 0.270349562f},
-std::array<float,2>{0.365757078f, 0.589464545f},
-std::array<float,2>{0.0179806612f, 0.0391201265f},
-std::array<float,2>{0.560695529f, 0.845998287f},
-std::array<float,2>{0.574005961f, 0.465454221f},
-std::array<float,2>{0.124990687f, 0.670471072f},
-std::array<float,2>{0.279949129f, 0.241264462f},
-std::array<float,2>{0.991730273f, 0.90510428f},
-std::array<float,2>{0.788263202f, 0.11769557f},
-std::array<float,2>{0.440659404f, 0.807763278f},
-std::array<float,2>{0.134367302f, 0.353698015f},
-std::array<float,2>{0.744400203f, 0.513827801f},
-std::array<float,2>{0.51183778f, 0.00310219941f},
-std::array<float,2>{0.0349511392f, 0.83598721f},
-std::array<float,2>{0.33394286f, 0.291544348f},
-std::array<float,2>{0.902753472f, 0.614782989f},
-std::array<float,2>{0.864402175f, 0.392341405f},
-std::array<float,2>{0.414042205f, 0.749477923f},
-std::array<float,2>{0.240795776f, 0.132032588f},
-std::array<float,2>{0.657907963f, 0.99145323f},
-std::array<float,2>{0.712872565f, 0.317007571f},
-std::array<float,2>{0.175340548f, 0.545371056f},
-std::array<float,2>{0.489515275f, 0.0631551147f},
-std::array<float,2>{0.760457635f, 0.769139409f},
-std::array<float,2>{0.96783185f, 0.213810593f},
-std::array<float,2>{0.306696117f, 0.93209058f},
-std::array<float,2>{0.0796044171f, 0.478543848f},
-std::array<float,2>{0.598092318f, 0.655333221f},
-std::array<float,2>{0.61033684f, 0.224061921f},
-std::array<float,2>{0.0648460314f, 0.879421175f},
-std::array<float,2>{0.296803892f, 0.445633501f},
-std::array<float,2>{0.948365688f, 0.687352836f},
-std::array<float,2>{0.775996327f, 0.361918628f},
-std::array<float,2>{0.470735699f, 0.529980898f},
-std::array<float,2>{0.166306809f, 0.0966724381f},
-std::array<float,2>{0.698245108f, 0.783033848f},
-std::array<float,2>{0.673716426f, 0.413898677f},
-std::array<float,2>{0.221220344f, 0.698105216f},
-std::array<float,2>{0.430790722f, 0.170399845f},
-std::array<float,2>{0.846659005f, 0.944426596f},
-std::array<float,2>{0.889041007f, 0.0513646938f},
-std::array<float,2>{0.319477201f, 0.86558485f},
-std::array<float,2>{0.0481645688f, 0.25979358f},
-std::array<float,2>{0.525062621f, 0.577145576f},
-std::array<float,2>{0.720333815f, 0.0796644166f},
-std::array<float,2>{0.150892824f, 0.76097548f},
-std::array<float,2>{0.46816346f, 0.339204341f},
-std::array<float,2>{0.803202569f, 0.55730021f},
-std::array<float,2>{0.978888929f, 0.496250987f},
-std::array<float,2>{0.258518636f, 0.632272065f},
-std::array<float,2>{0.0950505957f, 0.194643497f},
-std::array<float,2>{0.592709482f, 0.910552621f},
-std::array<float,2>{0.543990195f, 0.312337577f},
-std::array<float,2>{0.00420094142f, 0.607972383f},
-std::array<float,2>{0.359236777f, 0.0266784579f},
-std::array<float,2>{0.922230899f, 0.815425575f},
-std::array<float,2>{0.842486084f, 0.153706402f},
-std::array<float,2>{0.388617873f, 0.971705317f},
-std::array<float,2>{0.196918458f, 0.379235595f},
-std::array<float,2>{0.632746279f, 0.721460879f},
-std::array<float,2>{0.627616107f, 0.244994327f},
-std::array<float,2>{0.200031266f, 0.891197145f},
-std::array<float,2>{0.385830194f, 0.458131254f},
-std::array<float,2>{0.836790562f, 0.660955906f},
-std::array<float,2>{0.92788893f, 0.346612841f},
-std::array<float,2>{0.355247766f, 0.5044806f},
-std::array<float,2>{0.00279703084f, 0.115807347f},
-std::array<float,2>{0.541843951f, 0.799105287f},
-std::array<float,2>{0.587326705f, 0.423824787f},
-std::array<float,2>{0.0978127122f, 0.71660763f},
-std::array<float,2>{0.262641668f, 0.175363511f},
-std::array<float,2>{0.98140049f, 0.964251161f},
-std::array<float,2>{0.797391057f, 0.037442103f},
-std::array<float,2>{0.463745266f, 0.856865942f},
-std::array<float,2>{0.154052883f, 0.277217418f},
-std::array<float,2>{0.724712551f, 0.580331087f},
-std::array<float,2>{0.530230939f, 0.0709249079f},
-std::array<float,2>{0.0544609725f, 0.778764725f},
-std::array<float,2>{0.314673096f, 0.320945561f},
-std::array<float,2>{0.88625747f, 0.538844228f},
-std::array<float,2>{0.849401355f, 0.475861579f},
-std::array<float,2>{0.43650791f, 0.647807062f},
-std::array<float,2>{0.223797813f, 0.204275802f},
-std::array<float,2>{0.676483274f, 0.9245013f},
-std::array<float,2>{0.701712191f, 0.285757661f},
-std::array<float,2>{0.169149861f, 0.623412013f},
-std::array<float,2>{0.47373575f, 0.0150918225f},
-std::array<float,2>{0.778181136f, 0.83235538f},
-std::array<float,2>{0.95305562f, 0.134039134f},
-std::array<float,2>{0.289626777f, 0.993574739f},
-std::array<float,2>{0.0681341514f, 0.403579652f},
-std::array<float,2>{0.617114723f, 0.73750174f},
-std::array<float,2>{0.595631421f, 0.161800236f},
-std::array<float,2>{0.0850594342f, 0.949569106f},
-std::array<float,2>{0.310548872f, 0.418790549f},
-std::array<float,2>{0.962931335f, 0.688063264f},
-std::array<float,2>{0.76441741f, 0.254263848f},
-std::array<float,2>{0.485839665f, 0.570125699f},
-std::array<float,2>{0.179630846f, 0.0606498756f},
-std::array<float,2>{0.717293322f, 0.872425854f},
-std::array<float,2>{0.662047565f, 0.443164229f},
-std::array<float,2>{0.235397384f, 0.67230773f},
-std::array<float,2>{0.409180075f, 0.230047032f},
-std::array<float,2>{0.862491667f, 0.886970162f},
-std::array<float,2>{0.901022732f, 0.107692748f},
-std::array<float,2>{0.329472631f, 0.791949451f},
-std::array<float,2>{0.0352276787f, 0.367195785f},
-std::array<float,2>{0.509492934f, 0.518756688f},
-std::array<float,2>{0.746242225f, 0.0177362822f},
-std::array<float,2>{0.139443189f, 0.822677135f},
-std::array<float,2>{0.442253321f, 0.299042255f},
-std::array<float,2>{0.784888148f, 0.594861746f},
-std::array<float,2>{0.986299157f, 0.388111323f},
-std::array<float,2>{0.273870647f, 0.733345389f},
-std::array<float,2>{0.120219886f, 0.145433575f},
-std::array<float,2>{0.57632488f, 0.983568907f},
-std::array<float,2>{0.555723667f, 0.332235694f},
-std::array<float,2>{0.0220444705f, 0.547028661f},
-std::array<float,2>{0.362945229f, 0.0897534564f},
-std::array<float,2>{0.915077388f, 0.757454038f},
-std::array<float,2>{0.823230267f, 0.198898137f},
-std::array<float,2>{0.391232491f, 0.914537907f},
-std::array<float,2>{0.203583673f, 0.488644332f},
-std::array<float,2>{0.649226427f, 0.637845397f},
-std::array<float,2>{0.70336175f, 0.15144302f},
-std::array<float,2>{0.181601658f, 0.973237693f},
-std::array<float,2>{0.494878739f, 0.376821101f},
-std::array<float,2>{0.753844321f, 0.724858284f},
-std::array<float,2>{0.956941485f, 0.306559235f},
-std::array<float,2>{0.304002762f, 0.603348851f},
-std::array<float,2>{0.0901689455f, 0.0286205895f},
-std::array<float,2>{0.601601422f, 0.817401409f},
-std::array<float,2>{0.503617167f, 0.49525401f},
-std::array<float,2>{0.0457838699f, 0.626250207f},
-std::array<float,2>{0.341852933f, 0.189429298f},
-std::array<float,2>{0.894344747f, 0.906370938f},
-std::array<float,2>{0.87375772f, 0.0827941f},
-std::array<float,2>{0.415568858f, 0.762580395f},
-std::array<float,2>{0.24960278f, 0.340454102f},
-std::array<float,2>{0.664250731f, 0.560337603f},
-std::array<float,2>{0.56265837f, 0.0506289713f},
-std::array<float,2>{0.112613671f, 0.861679912f},
-std::array<float,2>{0.265802443f, 0.263466895f},
-std::array<float,2>{0.993977249f, 0.570773125f},
-std::array<float,2>{0.789469004f, 0.408234924f},
-std::array<float,2>{0.44556585f, 0.701446772f},
-std::array<float,2>{0.130643532f, 0.166238353f},
-std::array<float,2>{0.740219831f, 0.94038254f},
-std::array<float,2>{0.643287718f, 0.367124468f},
-std::array<float,2>{0.212195486f, 0.524582922f},
-std::array<float,2>{0.402810574f, 0.0980165973f},
-std::array<float,2>{0.814164698f, 0.786362112f},
-std::array<float,2>{0.910480499f, 0.219056174f},
-std::array<float,2>{0.370439947f, 0.875785768f},
-std::array<float,2>{0.0280394778f, 0.450222403f},
-std::array<float,2>{0.547640443f, 0.679750204f},
-std::array<float,2>{0.534851611f, 0.21560058f},
-std::array<float,2>{0.0092235757f, 0.934218347f},
-std::array<float,2>{0.351119965f, 0.484152645f},
-std::array<float,2>{0.93192184f, 0.650651276f},
-std::array<float,2>{0.834332466f, 0.314810395f},
-std::array<float,2>{0.379086554f, 0.53948611f},
-std::array<float,2>{0.191848651f, 0.0673574805f},
-std::array<float,2>{0.639401972f, 0.770264268f},
-std::array<float,2>{0.729228914f, 0.398221701f},
-std::array<float,2>{0.144641608f, 0.744597077f},
-std::array<float,2>{0.458842307f, 0.125826061f},
-std::array<float,2>{0.810308456f, 0.984760702f},
-std::array<float,2>{0.975007772f, 0.00441440614f},
-std::array<float,2>{0.254772574f, 0.841729045f},
-std::array<float,2>{0.106865771f, 0.293622017f},
-std::array<float,2>{0.581300616f, 0.611056447f},
-std::array<float,2>{0.679869652f, 0.121411391f},
-std::array<float,2>{0.227859288f, 0.812387168f},
-std::array<float,2>{0.428816319f, 0.355682224f},
-std::array<float,2>{0.857682824f, 0.510781407f},
-std::array<float,2>{0.878735185f, 0.462700039f},
-std::array<float,2>{0.321051061f, 0.667323589f},
-std::array<float,2>{0.0602313392f, 0.235372543f},
-std::array<float,2>{0.519822061f, 0.899596214f},
-std::array<float,2>{0.617226064f, 0.265725762f},
-std::array<float,2>{0.0718159601f, 0.591068387f},
-std::array<float,2>{0.283677995f, 0.0455572642f},
-std::array<float,2>{0.945094824f, 0.849715233f},
-std::array<float,2>{0.765725434f, 0.185224667f},
-std::array<float,2>{0.479061604f, 0.956326723f},
-std::array<float,2>{0.157908633f, 0.43331638f},
-std::array<float,2>{0.69286412f, 0.704550862f},
-std::array<float,2>{0.721593857f, 0.195308253f},
-std::array<float,2>{0.148465738f, 0.910682678f},
-std::array<float,2>{0.465614408f, 0.496954799f},
-std::array<float,2>{0.801665306f, 0.632669687f},
-std::array<float,2>{0.977194667f, 0.339833707f},
-std::array<float,2>{0.26155442f, 0.557070613f},
-std::array<float,2>{0.0960872099f, 0.0793656334f},
-std::array<float,2>{0.591481447f, 0.761546195f},
-std::array<float,2>{0.545248687f, 0.379397839f},
-std::array<float,2>{0.00742652593f, 0.720732331f},
-std::array<float,2>{0.357330769f, 0.154203132f},
-std::array<float,2>{0.925325215f, 0.97235465f},
-std::array<float,2>{0.841566622f, 0.0271459483f},
-std::array<float,2>{0.388891488f, 0.814547956f},
-std::array<float,2>{0.198627755f, 0.311886191f},
-std::array<float,2>{0.628915608f, 0.607509732f},
-std::array<float,2>{0.612218857f, 0.0960791335f},
-std::array<float,2>{0.0626110286f, 0.782598019f},
-std::array<float,2>{0.294631451f, 0.361410916f},
-std::array<float,2>{0.945432961f, 0.52962923f},
-std::array<float,2>{0.773519874f, 0.446006119f},
-std::array<float,2>{0.470253527f, 0.686961353f},
-std::array<float,2>{0.165157348f, 0.224544808f},
-std::array<float,2>{0.697125196f, 0.878961325f},
-std::array<float,2>{0.674859464f, 0.260423869f},
-std::array<float,2>{0.220217809f, 0.576255441f},
-std::array<float,2>{0.43250218f, 0.0511454493f},
-std::array<float,2>{0.84421283f, 0.865954638f},
-std::array<float,2>{0.887557864f, 0.17073983f},
-std::array<float,2>{0.316654772f, 0.944850147f},
-std::array<float,2>{0.0503727943f, 0.413139045f},
-std::array<float,2>{0.526725769f, 0.697450161f},
-std::array<float,2>{0.515442491f, 0.132414803f},
-std::array<float,2>{0.0324387178f, 0.991899848f},
-std::array<float,2>{0.334048331f, 0.391861171f},
-std::array<float,2>{0.905083835f, 0.749683857f},
-std::array<float,2>{0.867138684f, 0.291064292f},
-std::array<float,2>{0.412103266f, 0.614308059f},
-std::array<float,2>{0.238800079f, 0.0036064873f},
-std::array<float,2>{0.659019828f, 0.836537123f},
-std::array<float,2>{0.714273393f, 0.479102939f},
-std::array<float,2>{0.173402607f, 0.656019211f},
-std::array<float,2>{0.491589129f, 0.2128914f},
-std::array<float,2>{0.758222997f, 0.932364166f},
-std::array<float,2>{0.966459095f, 0.0627100766f},
-std::array<float,2>{0.305034608f, 0.768712699f},
-std::array<float,2>{0.0814642906f, 0.316698462f},
-std::array<float,2>{0.599771202f, 0.545853078f},
-std::array<float,2>{0.654113293f, 0.0396054089f},
-std::array<float,2>{0.209346414f, 0.846408844f},
-std::array<float,2>{0.394862711f, 0.269878179f},
-std::array<float,2>{0.827055573f, 0.589215219f},
-std::array<float,2>{0.921639085f, 0.436788559f},
-std::array<float,2>{0.36500904f, 0.70801723f},
-std::array<float,2>{0.017572999f, 0.180647537f},
-std::array<float,2>{0.559096456f, 0.960310757f},
-std::array<float,2>{0.571407974f, 0.354087859f},
-std::array<float,2>{0.122398525f, 0.514288723f},
-std::array<float,2>{0.278454602f, 0.117539428f},
-std::array<float,2>{0.98936379f, 0.80848968f},
-std::array<float,2>{0.785213649f, 0.241701171f},
-std::array<float,2>{0.437709779f, 0.904466629f},
-std::array<float,2>{0.135846838f, 0.465189219f},
-std::array<float,2>{0.743615985f, 0.66999948f},
-std::array<float,2>{0.671661675f, 0.175831169f},
-std::array<float,2>{0.243133143f, 0.968558788f},
-std::array<float,2>{0.420827448f, 0.429568022f},
-std::array<float,2>{0.869294763f, 0.714226425f},
-std::array<float,2>{0.895707488f, 0.278376937f},
-std::array<float,2>{0.336903661f, 0.583890975f},
-std::array<float,2>{0.0406410992f, 0.0313812643f},
-std::array<float,2>{0.507539034f, 0.85291487f},
-std::array<float,2>{0.607720613f, 0.4554784f},
-std::array<float,2>{0.0891585499f, 0.659907699f},
-std::array<float,2>{0.296898723f, 0.2473142f},
-std::array<float,2>{0.960853159f, 0.896976769f},
-std::array<float,2>{0.756064951f, 0.111963749f},
-std::array<float,2>{0.49862206f, 0.80375582f},
-std::array<float,2>{0.187258676f, 0.351167291f},
-std::array<float,2>{0.710907578f, 0.503171504f},
-std::array<float,2>{0.552197576f, 0.00856293458f},
-std::array<float,2>{0.0244756266f, 0.831136286f},
-std::array<float,2>{0.374425769f, 0.281618297f},
-std::array<float,2>{0.906462669f, 0.619420409f},
-std::array<float,2>{0.818624079f, 0.398968399f},
-std::array<float,2>{0.401192486f, 0.739296019f},
-std::array<float,2>{0.217594102f, 0.140091255f},
-std::array<float,2>{0.647439897f, 0.996279895f},
-std::array<float,2>{0.737355173f, 0.325398982f},
-std::array<float,2>{0.126660526f, 0.533163428f},
-std::array<float,2>{0.452256441f, 0.0747008547f},
-std::array<float,2>{0.795371473f, 0.77685982f},
-std::array<float,2>{0.997486413f, 0.208036229f},
-std::array<float,2>{0.272222847f, 0.926350892f},
-std::array<float,2>{0.115035877f, 0.471323252f},
-std::array<float,2>{0.5689376f, 0.644212663f},
-std::array<float,2>{0.58210516f, 0.234097421f},
-std::array<float,2>{0.102230199f, 0.885175526f},
-std::array<float,2>{0.253263175f, 0.440119922f},
-std::array<float,2>{0.96978718f, 0.676608801f},
-std::array<float,2>{0.805221021f, 0.372731954f},
-std::array<float,2>{0.455839366f, 0.519614398f},
-std::array<float,2>{0.141837433f, 0.102002278f},
-std::array<float,2>{0.732185066f, 0.793345392f},
-std::array<float,2>{0.634107292f, 0.417912811f},
-std::array<float,2>{0.190612465f, 0.693234324f},
-std::array<float,2>{0.375187129f, 0.157849386f},
-std::array<float,2>{0.83077848f, 0.948785245f},
-std::array<float,2>{0.936169207f, 0.0566427074f},
-std::array<float,2>{0.344597012f, 0.870903194f},
-std::array<float,2>{0.0142688379f, 0.253005505f},
-std::array<float,2>{0.537955761f, 0.563780904f},
-std::array<float,2>{0.68927902f, 0.0924626589f},
-std::array<float,2>{0.160234541f, 0.751298904f},
-std::array<float,2>{0.481215119f, 0.328563213f},
-std::array<float,2>{0.770473599f, 0.550787747f},
-std::array<float,2>{0.939251304f, 0.488224864f},
-std::array<float,2>{0.285908103f, 0.633281887f},
-std::array<float,2>{0.075192593f, 0.200493053f},
-std::array<float,2>{0.624158084f, 0.919877589f},
-std::array<float,2>{0.51915431f, 0.300805211f},
-std::array<float,2>{0.0582773685f, 0.601380825f},
-std::array<float,2>{0.326502651f, 0.0204682741f},
-std::array<float,2>{0.882148862f, 0.82557857f},
-std::array<float,2>{0.85400933f, 0.142084315f},
-std::array<float,2>{0.424093068f, 0.976999462f},
-std::array<float,2>{0.233091518f, 0.38613376f},
-std::array<float,2>{0.685918987f, 0.730217874f},
-std::array<float,2>{0.679020822f, 0.206997827f},
-std::array<float,2>{0.224663839f, 0.923084378f},
-std::array<float,2>{0.434149206f, 0.473696679f},
-std::array<float,2>{0.851064086f, 0.645962596f},
-std::array<float,2>{0.883615792f, 0.324163437f},
-std::array<float,2>{0.31348002f, 0.537017047f},
-std::array<float,2>{0.05155918f, 0.0733781457f},
-std::array<float,2>{0.528367758f, 0.780065417f},
-std::array<float,2>{0.613942564f, 0.404795259f},
-std::array<float,2>{0.0691828877f, 0.735917151f},
-std::array<float,2>{0.292955667f, 0.136654243f},
-std::array<float,2>{0.949949384f, 0.996058345f},
-std::array<float,2>{0.779861569f, 0.0126514658f},
-std::array<float,2>{0.475844473f, 0.834222853f},
-std::array<float,2>{0.171492308f, 0.288059801f},
-std::array<float,2>{0.700129926f, 0.622085929f},
-std::array<float,2>{0.539169073f, 0.114763081f},
-std::array<float,2>{0.000749056868f, 0.797584474f},
-std::array<float,2>{0.351865232f, 0.345372349f},
-std::array<float,2>{0.926105857f, 0.507071137f},
-std::array<float,2>{0.83904022f, 0.45917657f},
-std::array<float,2>{0.384069443f, 0.663830459f},
-std::array<float,2>{0.202893585f, 0.243291765f},
-std::array<float,2>{0.626952708f, 0.893381894f},
-std::array<float,2>{0.722781301f, 0.273582935f},
-std::array<float,2>{0.154555485f, 0.579967141f},
-std::array<float,2>{0.462370276f, 0.0354621336f},
-std::array<float,2>{0.799599707f, 0.858406305f},
-std::array<float,2>{0.983879566f, 0.172721744f},
-std::array<float,2>{0.263893813f, 0.961786389f},
-std::array<float,2>{0.10126926f, 0.42472288f},
-std::array<float,2>{0.589044154f, 0.717569768f},
-std::array<float,2>{0.574440181f, 0.148095205f},
-std::array<float,2>{0.117350094f, 0.981723189f},
-std::array<float,2>{0.27650851f, 0.390332192f},
-std::array<float,2>{0.987191141f, 0.73070246f},
-std::array<float,2>{0.782806754f, 0.297134757f},
-std::array<float,2>{0.444426209f, 0.597368419f},
-std::array<float,2>{0.136962101f, 0.0163397174f},
-std::array<float,2>{0.74969703f, 0.820976019f},
-std::array<float,2>{0.652292669f, 0.491471022f},
-std::array<float,2>{0.206097901f, 0.639482498f},
-std::array<float,2>{0.393283606f, 0.197080806f},
-std::array<float,2>{0.821388185f, 0.917938054f},
-std::array<float,2>{0.917772651f, 0.0876285434f},
-std::array<float,2>{0.360748142f, 0.754079938f},
-std::array<float,2>{0.0202361755f, 0.33522442f},
-std::array<float,2>{0.557907462f, 0.550565779f},
-std::array<float,2>{0.715949416f, 0.0597964041f},
-std::array<float,2>{0.176764235f, 0.874190331f},
-std::array<float,2>{0.486920834f, 0.256973118f},
-std::array<float,2>{0.762881398f, 0.567890048f},
-std::array<float,2>{0.96268481f, 0.420305848f},
-std::array<float,2>{0.309341997f, 0.689918637f},
-std::array<float,2>{0.0831657425f, 0.163362741f},
-std::array<float,2>{0.595952988f, 0.952005982f},
-std::array<float,2>{0.510246873f, 0.370856643f},
-std::array<float,2>{0.0374343544f, 0.517320871f},
-std::array<float,2>{0.331692368f, 0.107035868f},
-std::array<float,2>{0.898903668f, 0.789910853f},
-std::array<float,2>{0.859579444f, 0.226786003f},
-std::array<float,2>{0.407308072f, 0.890485346f},
-std::array<float,2>{0.236823857f, 0.444830209f},
-std::array<float,2>{0.66406101f, 0.674516976f},
-std::array<float,2>{0.740787446f, 0.165437043f},
-std::array<float,2>{0.131019756f, 0.938805819f},
-std::array<float,2>{0.448361784f, 0.406530887f},
-std::array<float,2>{0.792506158f, 0.699413717f},
-std::array<float,2>{0.994991183f, 0.265405267f},
-std::array<float,2>{0.268491536f, 0.572351933f},
-std::array<float,2>{0.111280717f, 0.0471961536f},
-std::array<float,2>{0.56617564f, 0.860530972f},
-std::array<float,2>{0.549785733f, 0.452325732f},
-std::array<float,2>{0.0312023405f, 0.682985187f},
-std::array<float,2>{0.3685821f, 0.22175844f},
-std::array<float,2>{0.912882686f, 0.878162563f},
-std::array<float,2>{0.81567204f, 0.0999078602f},
-std::array<float,2>{0.40590018f, 0.788108587f},
-std::array<float,2>{0.213795379f, 0.363866657f},
-std::array<float,2>{0.642205894f, 0.525459826f},
-std::array<float,2>{0.604562044f, 0.0299535133f},
-std::array<float,2>{0.0931144878f, 0.819785714f},
-std::array<float,2>{0.302242339f, 0.307029039f},
-std::array<float,2>{0.954774976f, 0.603741765f},
-std::array<float,2>{0.751205266f, 0.377836645f},
-std::array<float,2>{0.493514448f, 0.723848224f},
-std::array<float,2>{0.182646051f, 0.148814261f},
-std::array<float,2>{0.706664324f, 0.976466596f},
-std::array<float,2>{0.666664243f, 0.342974842f},
-std::array<float,2>{0.24715063f, 0.560683727f},
-std::array<float,2>{0.417703211f, 0.0853596926f},
-std::array<float,2>{0.872555256f, 0.764226198f},
-std::array<float,2>{0.891125381f, 0.190372854f},
-std::array<float,2>{0.340334654f, 0.909154832f},
-std::array<float,2>{0.0431742333f, 0.493905544f},
-std::array<float,2>{0.500912189f, 0.627563298f},
-std::array<float,2>{0.521868587f, 0.236346304f},
-std::array<float,2>{0.061076913f, 0.900744081f},
-std::array<float,2>{0.323093504f, 0.464386374f},
-std::array<float,2>{0.876196146f, 0.665688097f},
-std::array<float,2>{0.856956184f, 0.358608723f},
-std::array<float,2>{0.426351696f, 0.509295464f},
-std::array<float,2>{0.229790106f, 0.123355463f},
-std::array<float,2>{0.682373226f, 0.808857262f},
-std::array<float,2>{0.694625735f, 0.431449264f},
-std::array<float,2>{0.158580825f, 0.705684423f},
-std::array<float,2>{0.477321595f, 0.186115667f},
-std::array<float,2>{0.768482327f, 0.953415215f},
-std::array<float,2>{0.941678643f, 0.0431603789f},
-std::array<float,2>{0.283006668f, 0.848106682f},
-std::array<float,2>{0.0737471282f, 0.269301474f},
-std::array<float,2>{0.619305968f, 0.592969835f},
-std::array<float,2>{0.638285279f, 0.0686789751f},
-std::array<float,2>{0.194624335f, 0.772944808f},
-std::array<float,2>{0.380995363f, 0.312556326f},
-std::array<float,2>{0.832799673f, 0.541120589f},
-std::array<float,2>{0.930027425f, 0.482140094f},
-std::array<float,2>{0.348419487f, 0.649392009f},
-std::array<float,2>{0.0104933642f, 0.21766451f},
-std::array<float,2>{0.532395363f, 0.93738246f},
-std::array<float,2>{0.579957724f, 0.296044052f},
-std::array<float,2>{0.108171105f, 0.612051785f},
-std::array<float,2>{0.257424742f, 0.00694652088f},
-std::array<float,2>{0.973891258f, 0.842293739f},
-std::array<float,2>{0.811332643f, 0.128453866f},
-std::array<float,2>{0.459545642f, 0.988183916f},
-std::array<float,2>{0.147812113f, 0.395259231f},
-std::array<float,2>{0.726808846f, 0.742937326f},
-std::array<float,2>{0.698817194f, 0.226214767f},
-std::array<float,2>{0.166587681f, 0.882670701f},
-std::array<float,2>{0.471245706f, 0.448786974f},
-std::array<float,2>{0.775611043f, 0.684184849f},
-std::array<float,2>{0.948949635f, 0.360422164f},
-std::array<float,2>{0.296316981f, 0.52784735f},
-std::array<float,2>{0.0653148666f, 0.0950883254f},
-std::array<float,2>{0.609769821f, 0.784724295f},
-std::array<float,2>{0.524743438f, 0.410904348f},
-std::array<float,2>{0.0485077612f, 0.695912302f},
-std::array<float,2>{0.319956362f, 0.1684407f},
-std::array<float,2>{0.889432073f, 0.943160415f},
-std::array<float,2>{0.846008956f, 0.0529885031f},
-std::array<float,2>{0.431279242f, 0.863970637f},
-std::array<float,2>{0.220991582f, 0.258439213f},
-std::array<float,2>{0.673214138f, 0.575104713f},
-std::array<float,2>{0.59227562f, 0.0801723152f},
-std::array<float,2>{0.0954369009f, 0.759407282f},
-std::array<float,2>{0.258188605f, 0.336424381f},
-std::array<float,2>{0.979377687f, 0.555040717f},
-std::array<float,2>{0.803642213f, 0.499515325f},
-std::array<float,2>{0.468512982f, 0.630187273f},
-std::array<float,2>{0.150808558f, 0.192086667f},
-std::array<float,2>{0.719923794f, 0.913571715f},
-std::array<float,2>{0.632116616f, 0.309107333f},
-std::array<float,2>{0.196361512f, 0.605737925f},
-std::array<float,2>{0.388059944f, 0.0251574125f},
-std::array<float,2>{0.841927469f, 0.812539935f},
-std::array<float,2>{0.922653019f, 0.155727342f},
-std::array<float,2>{0.358526647f, 0.970045507f},
-std::array<float,2>{0.00474162214f, 0.382489353f},
-std::array<float,2>{0.544572949f, 0.71966964f},
-std::array<float,2>{0.561350822f, 0.182889298f},
-std::array<float,2>{0.0182815064f, 0.958619058f},
-std::array<float,2>{0.365440339f, 0.43399632f},
-std::array<float,2>{0.918885291f, 0.71093601f},
-std::array<float,2>{0.826063693f, 0.272230357f},
-std::array<float,2>{0.397916496f, 0.587639153f},
-std::array<float,2>{0.208417863f, 0.042338524f},
-std::array<float,2>{0.655834913f, 0.844061315f},
-std::array<float,2>{0.744793653f, 0.4682886f},
-std::array<float,2>{0.134185553f, 0.668247819f},
-std::array<float,2>{0.441286266f, 0.239000455f},
-std::array<float,2>{0.788994968f, 0.903282642f},
-std::array<float,2>{0.991280079f, 0.121013865f},
-std::array<float,2>{0.279371947f, 0.805599213f},
-std::array<float,2>{0.12428496f, 0.353052616f},
-std::array<float,2>{0.573361278f, 0.513658464f},
-std::array<float,2>{0.657675982f, 0.00181189051f},
-std::array<float,2>{0.240400076f, 0.83882761f},
-std::array<float,2>{0.413511604f, 0.289589405f},
-std::array<float,2>{0.864927709f, 0.617127419f},
-std::array<float,2>{0.903095841f, 0.394426405f},
-std::array<float,2>{0.3333368f, 0.746769428f},
-std::array<float,2>{0.0342682712f, 0.130085483f},
-std::array<float,2>{0.512258649f, 0.988983989f},
-std::array<float,2>{0.598516405f, 0.318547964f},
-std::array<float,2>{0.0793602169f, 0.544482052f},
-std::array<float,2>{0.307587117f, 0.0649167225f},
-std::array<float,2>{0.968391299f, 0.766076863f},
-std::array<float,2>{0.760042608f, 0.211628616f},
-std::array<float,2>{0.489826947f, 0.931063235f},
-std::array<float,2>{0.175182894f, 0.477776557f},
-std::array<float,2>{0.712068558f, 0.652742088f},
-std::array<float,2>{0.645485103f, 0.137413681f},
-std::array<float,2>{0.215541869f, 0.998171747f},
-std::array<float,2>{0.399088264f, 0.401853621f},
-std::array<float,2>{0.817400217f, 0.740677178f},
-std::array<float,2>{0.909160256f, 0.283216089f},
-std::array<float,2>{0.373018444f, 0.618517399f},
-std::array<float,2>{0.0260849148f, 0.0114132408f},
-std::array<float,2>{0.553323448f, 0.829618216f},
-std::array<float,2>{0.567627311f, 0.469021529f},
-std::array<float,2>{0.116567291f, 0.642068088f},
-std::array<float,2>{0.27014631f, 0.209036216f},
-std::array<float,2>{0.999581635f, 0.929010451f},
-std::array<float,2>{0.794706643f, 0.0770155713f},
-std::array<float,2>{0.450184047f, 0.773590446f},
-std::array<float,2>{0.127336323f, 0.327209264f},
-std::array<float,2>{0.735533774f, 0.533569515f},
-std::array<float,2>{0.50486654f, 0.0340553932f},
-std::array<float,2>{0.0427297466f, 0.85425663f},
-std::array<float,2>{0.339460045f, 0.279368222f},
-std::array<float,2>{0.89761883f, 0.584323049f},
-std::array<float,2>{0.867542386f, 0.4267506f},
-std::array<float,2>{0.4193739f, 0.712209046f},
-std::array<float,2>{0.24428536f, 0.178320438f},
-std::array<float,2>{0.669865966f, 0.965343773f},
-std::array<float,2>{0.708177269f, 0.349495709f},
-std::array<float,2>{0.184675753f, 0.50115037f},
-std::array<float,2>{0.496487349f, 0.111309372f},
-std::array<float,2>{0.755799949f, 0.801023722f},
-std::array<float,2>{0.957906306f, 0.249969378f},
-std::array<float,2>{0.299369752f, 0.896290362f},
-std::array<float,2>{0.0868102685f, 0.454834729f},
-std::array<float,2>{0.606245935f, 0.657939017f},
-std::array<float,2>{0.622322142f, 0.201629221f},
-std::array<float,2>{0.0772379115f, 0.921287298f},
-std::array<float,2>{0.287907183f, 0.485694051f},
-std::array<float,2>{0.941109359f, 0.635991096f},
-std::array<float,2>{0.77178967f, 0.330276668f},
-std::array<float,2>{0.482543617f, 0.553458214f},
-std::array<float,2>{0.163995788f, 0.0901187286f},
-std::array<float,2>{0.689738631f, 0.753878593f},
-std::array<float,2>{0.684385657f, 0.383409441f},
-std::array<float,2>{0.232211858f, 0.7284078f},
-std::array<float,2>{0.423017204f, 0.143359005f},
-std::array<float,2>{0.852115512f, 0.979994535f},
-std::array<float,2>{0.879258454f, 0.0216150247f},
-std::array<float,2>{0.325737029f, 0.826979041f},
-std::array<float,2>{0.056187138f, 0.304270476f},
-std::array<float,2>{0.516031086f, 0.598486543f},
-std::array<float,2>{0.732650161f, 0.103567712f},
-std::array<float,2>{0.143577263f, 0.795709252f},
-std::array<float,2>{0.454803199f, 0.373986602f},
-std::array<float,2>{0.807724297f, 0.521813691f},
-std::array<float,2>{0.972323775f, 0.439246148f},
-std::array<float,2>{0.251846224f, 0.679672837f},
-std::array<float,2>{0.104630202f, 0.230898708f},
-std::array<float,2>{0.585893989f, 0.883084536f},
-std::array<float,2>{0.535544634f, 0.251442581f},
-std::array<float,2>{0.0127585074f, 0.565029919f},
-std::array<float,2>{0.346716672f, 0.0555784293f},
-std::array<float,2>{0.934880435f, 0.867191017f},
-std::array<float,2>{0.829215705f, 0.158227399f},
-std::array<float,2>{0.37700507f, 0.945459902f},
-std::array<float,2>{0.187875539f, 0.415560782f},
-std::array<float,2>{0.634767592f, 0.694074094f},
-std::array<float,2>{0.650101781f, 0.195535019f},
-std::array<float,2>{0.204426289f, 0.916229725f},
-std::array<float,2>{0.392043531f, 0.49043718f},
-std::array<float,2>{0.823395014f, 0.640264511f},
-std::array<float,2>{0.91483283f, 0.334853947f},
-std::array<float,2>{0.36180672f, 0.549095869f},
-std::array<float,2>{0.023406757f, 0.0868227705f},
-std::array<float,2>{0.555545688f, 0.754916906f},
-std::array<float,2>{0.577625632f, 0.389386117f},
-std::array<float,2>{0.119648382f, 0.731487691f},
-std::array<float,2>{0.274474263f, 0.146611661f},
-std::array<float,2>{0.984802961f, 0.980993629f},
-std::array<float,2>{0.78325963f, 0.0166528169f},
-std::array<float,2>{0.44257465f, 0.821662605f},
-std::array<float,2>{0.140303567f, 0.297945887f},
-std::array<float,2>{0.747981131f, 0.596414864f},
-std::array<float,2>{0.508179009f, 0.106394224f},
-std::array<float,2>{0.0369164459f, 0.790722847f},
-std::array<float,2>{0.328790784f, 0.369419128f},
-std::array<float,2>{0.902239442f, 0.515783191f},
-std::array<float,2>{0.86212492f, 0.44353205f},
-std::array<float,2>{0.408496648f, 0.675634563f},
-std::array<float,2>{0.23450157f, 0.22826834f},
-std::array<float,2>{0.661023557f, 0.888972044f},
-std::array<float,2>{0.718289495f, 0.255987346f},
-std::array<float,2>{0.178547814f, 0.56714499f},
-std::array<float,2>{0.484418511f, 0.0585942902f},
-std::array<float,2>{0.765439093f, 0.873499572f},
-std::array<float,2>{0.964276433f, 0.162141547f},
-std::array<float,2>{0.311960042f, 0.952503502f},
-std::array<float,2>{0.084521085f, 0.421531171f},
-std::array<float,2>{0.593820274f, 0.690754116f},
-std::array<float,2>{0.615724325f, 0.13508971f},
-std::array<float,2>{0.0666974634f, 0.994490325f},
-std::array<float,2>{0.290357471f, 0.405649096f},
-std::array<float,2>{0.95117414f, 0.734622896f},
-std::array<float,2>{0.778394043f, 0.28881678f},
-std::array<float,2>{0.472677618f, 0.621324122f},
-std::array<float,2>{0.168886364f, 0.0130861355f},
-std::array<float,2>{0.70267868f, 0.835220098f},
-std::array<float,2>{0.677126169f, 0.472970277f},
-std::array<float,2>{0.222840682f, 0.645090878f},
-std::array<float,2>{0.436928302f, 0.205759794f},
-std::array<float,2>{0.848378062f, 0.922366917f},
-std::array<float,2>{0.885632396f, 0.072445862f},
-std::array<float,2>{0.315967023f, 0.780774653f},
-std::array<float,2>{0.053310696f, 0.322729081f},
-std::array<float,2>{0.531027436f, 0.535619617f},
-std::array<float,2>{0.725680709f, 0.0362468772f},
-std::array<float,2>{0.152395219f, 0.857717037f},
-std::array<float,2>{0.464344651f, 0.275356442f},
-std::array<float,2>{0.798502028f, 0.5785532f},
-std::array<float,2>{0.982157469f, 0.424859226f},
-std::array<float,2>{0.263167232f, 0.71824789f},
-std::array<float,2>{0.0991880894f, 0.173119977f},
-std::array<float,2>{0.586484313f, 0.962830901f},
-std::array<float,2>{0.542187691f, 0.344536066f},
-std::array<float,2>{0.00381820439f, 0.506486118f},
-std::array<float,2>{0.353674531f, 0.113389872f},
-std::array<float,2>{0.929021597f, 0.797987878f},
-std::array<float,2>{0.83732605f, 0.242384374f},
-std::array<float,2>{0.384990841f, 0.893631339f},
-std::array<float,2>{0.200865075f, 0.460796535f},
-std::array<float,2>{0.62890017f, 0.662359595f},
-std::array<float,2>{0.692231774f, 0.187028512f},
-std::array<float,2>{0.15694423f, 0.954598665f},
-std::array<float,2>{0.479840666f, 0.430075496f},
-std::array<float,2>{0.766783595f, 0.706234872f},
-std::array<float,2>{0.943805397f, 0.268261075f},
-std::array<float,2>{0.284566343f, 0.591838658f},
-std::array<float,2>{0.0706633702f, 0.044320967f},
-std::array<float,2>{0.618938684f, 0.849528968f},
-std::array<float,2>{0.521136522f, 0.463571995f},
-std::array<float,2>{0.0593840927f, 0.664977908f},
-std::array<float,2>{0.322109133f, 0.238144264f},
-std::array<float,2>{0.877369761f, 0.90162307f},
-std::array<float,2>{0.859266996f, 0.124097049f},
-std::array<float,2>{0.427875876f, 0.809918284f},
-std::array<float,2>{0.226908669f, 0.357665479f},
-std::array<float,2>{0.680901289f, 0.508591175f},
-std::array<float,2>{0.58089751f, 0.00641157432f},
-std::array<float,2>{0.106317945f, 0.843240798f},
-std::array<float,2>{0.255561024f, 0.295306563f},
-std::array<float,2>{0.976481259f, 0.612956166f},
-std::array<float,2>{0.809309542f, 0.396318108f},
-std::array<float,2>{0.45748049f, 0.743397236f},
-std::array<float,2>{0.145764604f, 0.127121702f},
-std::array<float,2>{0.73016876f, 0.987084627f},
-std::array<float,2>{0.639962494f, 0.314331591f},
-std::array<float,2>{0.193241507f, 0.542213857f},
-std::array<float,2>{0.380794495f, 0.0694910884f},
-std::array<float,2>{0.83587569f, 0.771568716f},
-std::array<float,2>{0.932769418f, 0.218527004f},
-std::array<float,2>{0.350112557f, 0.93591851f},
-std::array<float,2>{0.00821076147f, 0.480966449f},
-std::array<float,2>{0.533209741f, 0.64966172f},
-std::array<float,2>{0.548335671f, 0.221631765f},
-std::array<float,2>{0.0292928591f, 0.877549112f},
-std::array<float,2>{0.369600803f, 0.452065498f},
-std::array<float,2>{0.91147846f, 0.682375014f},
-std::array<float,2>{0.813084185f, 0.364630312f},
-std::array<float,2>{0.40427649f, 0.527058005f},
-std::array<float,2>{0.211380109f, 0.100919209f},
-std::array<float,2>{0.644049048f, 0.787258089f},
-std::array<float,2>{0.738528669f, 0.408052742f},
-std::array<float,2>{0.129410267f, 0.70067358f},
-std::array<float,2>{0.447076619f, 0.164083257f},
-std::array<float,2>{0.790391445f, 0.937744141f},
-std::array<float,2>{0.99314326f, 0.0486214943f},
-std::array<float,2>{0.267326593f, 0.859962523f},
-std::array<float,2>{0.11170204f, 0.264598578f},
-std::array<float,2>{0.564416468f, 0.573970854f},
-std::array<float,2>{0.66536063f, 0.0846908018f},
-std::array<float,2>{0.248796061f, 0.765135527f},
-std::array<float,2>{0.415010542f, 0.342422277f},
-std::array<float,2>{0.874399066f, 0.562108576f},
-std::array<float,2>{0.89295125f, 0.492948264f},
-std::array<float,2>{0.343184263f, 0.628316641f},
-std::array<float,2>{0.0463063642f, 0.19045262f},
-std::array<float,2>{0.502098083f, 0.909310102f},
-std::array<float,2>{0.603047252f, 0.308155239f},
-std::array<float,2>{0.0909256563f, 0.605160892f},
-std::array<float,2>{0.303029329f, 0.0309466943f},
-std::array<float,2>{0.955502987f, 0.81900239f},
-std::array<float,2>{0.752174139f, 0.149893165f},
-std::array<float,2>{0.49558118f, 0.974991024f},
-std::array<float,2>{0.180289671f, 0.378258437f},
-std::array<float,2>{0.704761386f, 0.723189294f},
-std::array<float,2>{0.742266774f, 0.239826381f},
-std::array<float,2>{0.134891033f, 0.903552353f},
-std::array<float,2>{0.43900758f, 0.467511564f},
-std::array<float,2>{0.787012637f, 0.669388592f},
-std::array<float,2>{0.988529086f, 0.352367431f},
-std::array<float,2>{0.278160363f, 0.512398183f},
-std::array<float,2>{0.121856794f, 0.11983078f},
-std::array<float,2>{0.571088552f, 0.806240737f},
-std::array<float,2>{0.560146511f, 0.435036749f},
-std::array<float,2>{0.0164948218f, 0.709884882f},
-std::array<float,2>{0.363942921f, 0.181833014f},
-std::array<float,2>{0.920366764f, 0.957587719f},
-std::array<float,2>{0.827831984f, 0.0419417769f},
-std::array<float,2>{0.396241575f, 0.844984591f},
-std::array<float,2>{0.210804492f, 0.273070067f},
-std::array<float,2>{0.652844787f, 0.58636266f},
-std::array<float,2>{0.601297557f, 0.0659525692f},
-std::array<float,2>{0.0806891993f, 0.766640782f},
-std::array<float,2>{0.30589813f, 0.320220202f},
-std::array<float,2>{0.965263367f, 0.543183148f},
-std::array<float,2>{0.759563684f, 0.47696048f},
-std::array<float,2>{0.49036324f, 0.654052615f},
-std::array<float,2>{0.172087446f, 0.212059826f},
-std::array<float,2>{0.713812351f, 0.930556953f},
-std::array<float,2>{0.659699857f, 0.290278196f},
-std::array<float,2>{0.239314362f, 0.615766585f},
-std::array<float,2>{0.41040951f, 0.000531406433f},
-std::array<float,2>{0.865288556f, 0.839496136f},
-std::array<float,2>{0.905909717f, 0.129488319f},
-std::array<float,2>{0.335077673f, 0.989639163f},
-std::array<float,2>{0.0322194435f, 0.393419385f},
-std::array<float,2>{0.514298618f, 0.74743259f},
-std::array<float,2>{0.525694728f, 0.169442654f},
-std::array<float,2>{0.0492846705f, 0.941619158f},
-std::array<float,2>{0.317685366f, 0.411819637f},
-std::array<float,2>{0.888204157f, 0.696364462f},
-std::array<float,2>{0.845435023f, 0.25929305f},
-std::array<float,2>{0.433499426f, 0.575986862f},
-std::array<float,2>{0.219013691f, 0.0542192683f},
-std::array<float,2>{0.674185216f, 0.864377022f},
-std::array<float,2>{0.69622761f, 0.447590083f},
-std::array<float,2>{0.16448468f, 0.685272515f},
-std::array<float,2>{0.469584107f, 0.224928334f},
-std::array<float,2>{0.774485826f, 0.88092345f},
-std::array<float,2>{0.946442842f, 0.0941474959f},
-std::array<float,2>{0.293154389f, 0.783259213f},
-std::array<float,2>{0.0635591745f, 0.360332191f},
-std::array<float,2>{0.612574279f, 0.528997183f},
-std::array<float,2>{0.62989682f, 0.0240449999f},
-std::array<float,2>{0.198173136f, 0.814210773f},
-std::array<float,2>{0.390455723f, 0.309752941f},
-std::array<float,2>{0.840810537f, 0.607250392f},
-std::array<float,2>{0.923955441f, 0.381197572f},
-std::array<float,2>{0.355894387f, 0.720143735f},
-std::array<float,2>{0.00680649374f, 0.154981062f},
-std::array<float,2>{0.546658754f, 0.968902111f},
-std::array<float,2>{0.590110242f, 0.337879747f},
-std::array<float,2>{0.0976082236f, 0.555931985f},
-std::array<float,2>{0.260088563f, 0.0816887841f},
-std::array<float,2>{0.977595866f, 0.75818193f},
-std::array<float,2>{0.801841736f, 0.192698792f},
-std::array<float,2>{0.466616392f, 0.912422001f},
-std::array<float,2>{0.150065675f, 0.498666853f},
-std::array<float,2>{0.722549021f, 0.629591644f},
-std::array<float,2>{0.687302887f, 0.143971384f},
-std::array<float,2>{0.233655661f, 0.979333937f},
-std::array<float,2>{0.4255566f, 0.383805573f},
-std::array<float,2>{0.85493046f, 0.727221429f},
-std::array<float,2>{0.881485403f, 0.303619832f},
-std::array<float,2>{0.327826798f, 0.599142373f},
-std::array<float,2>{0.0573366433f, 0.0232604071f},
-std::array<float,2>{0.518075407f, 0.828038692f},
-std::array<float,2>{0.623526156f, 0.485332191f},
-std::array<float,2>{0.0756565556f, 0.635623574f},
-std::array<float,2>{0.286659479f, 0.202235937f},
-std::array<float,2>{0.93827492f, 0.9205966f},
-std::array<float,2>{0.770659983f, 0.0915340185f},
-std::array<float,2>{0.481680602f, 0.752404153f},
-std::array<float,2>{0.161915958f, 0.331101775f},
-std::array<float,2>{0.688030958f, 0.553966522f},
-std::array<float,2>{0.538851261f, 0.0558457896f},
-std::array<float,2>{0.0146710854f, 0.868922293f},
-std::array<float,2>{0.345480293f, 0.250023037f},
-std::array<float,2>{0.936529875f, 0.566268981f},
-std::array<float,2>{0.831611335f, 0.414257556f},
-std::array<float,2>{0.37621516f, 0.695266068f},
-std::array<float,2>{0.190265417f, 0.159627125f},
-std::array<float,2>{0.633134127f, 0.946341693f},
-std::array<float,2>{0.731170952f, 0.374195158f},
-std::array<float,2>{0.140893668f, 0.522986889f},
-std::array<float,2>{0.456529021f, 0.10484115f},
-std::array<float,2>{0.806237102f, 0.796446204f},
-std::array<float,2>{0.969714403f, 0.23175928f},
-std::array<float,2>{0.252662092f, 0.884489298f},
-std::array<float,2>{0.103418916f, 0.437640935f},
-std::array<float,2>{0.58311981f, 0.678597212f},
-std::array<float,2>{0.56984818f, 0.210557908f},
-std::array<float,2>{0.113320775f, 0.928464532f},
-std::array<float,2>{0.273376584f, 0.47009182f},
-std::array<float,2>{0.996708274f, 0.640701473f},
-std::array<float,2>{0.795944154f, 0.326883972f},
-std::array<float,2>{0.451280475f, 0.534490764f},
-std::array<float,2>{0.125571936f, 0.077597633f},
-std::array<float,2>{0.736424565f, 0.77493006f},
-std::array<float,2>{0.648133337f, 0.400448442f},
-std::array<float,2>{0.218165517f, 0.742116868f},
-std::array<float,2>{0.402060151f, 0.138052106f},
-std::array<float,2>{0.819396555f, 0.999644041f},
-std::array<float,2>{0.908156097f, 0.0106571466f},
-std::array<float,2>{0.37392658f, 0.829064369f},
-std::array<float,2>{0.0242908094f, 0.285081446f},
-std::array<float,2>{0.551391363f, 0.617417395f},
-std::array<float,2>{0.709892511f, 0.110199243f},
-std::array<float,2>{0.185777977f, 0.801887393f},
-std::array<float,2>{0.499272525f, 0.348426223f},
-std::array<float,2>{0.757029951f, 0.500571966f},
-std::array<float,2>{0.959145665f, 0.454004884f},
-std::array<float,2>{0.298341423f, 0.656541288f},
-std::array<float,2>{0.0886976495f, 0.248073712f},
-std::array<float,2>{0.608950257f, 0.895418942f},
-std::array<float,2>{0.506452262f, 0.280556679f},
-std::array<float,2>{0.0396239385f, 0.585312009f},
-std::array<float,2>{0.336922616f, 0.0342525095f},
-std::array<float,2>{0.895239234f, 0.854651272f},
-std::array<float,2>{0.870341003f, 0.17967543f},
-std::array<float,2>{0.421399295f, 0.966535926f},
-std::array<float,2>{0.243935868f, 0.426806152f},
-std::array<float,2>{0.67022866f, 0.711066067f},
-std::array<float,2>{0.662121415f, 0.229442537f},
-std::array<float,2>{0.237546951f, 0.887953758f},
-std::array<float,2>{0.40694207f, 0.442228377f},
-std::array<float,2>{0.861311853f, 0.673820138f},
-std::array<float,2>{0.899838328f, 0.368998706f},
-std::array<float,2>{0.330346674f, 0.518337369f},
-std::array<float,2>{0.0384197831f, 0.108550787f},
-std::array<float,2>{0.511460066f, 0.792549491f},
-std::array<float,2>{0.596930623f, 0.419862002f},
-std::array<float,2>{0.0822782367f, 0.689338923f},
-std::array<float,2>{0.310310423f, 0.160917282f},
-std::array<float,2>{0.961159527f, 0.950944424f},
-std::array<float,2>{0.762194216f, 0.0618122928f},
-std::array<float,2>{0.488198131f, 0.871416092f},
-std::array<float,2>{0.175965115f, 0.255681276f},
-std::array<float,2>{0.71554774f, 0.568751812f},
-std::array<float,2>{0.557358027f, 0.0884959027f},
-std::array<float,2>{0.0208978485f, 0.756308496f},
-std::array<float,2>{0.360195637f, 0.333323658f},
-std::array<float,2>{0.91636914f, 0.547875822f},
-std::array<float,2>{0.820954144f, 0.489467144f},
-std::array<float,2>{0.394090921f, 0.637202024f},
-std::array<float,2>{0.205924794f, 0.197399437f},
-std::array<float,2>{0.651050508f, 0.915207267f},
-std::array<float,2>{0.748672128f, 0.30008772f},
-std::array<float,2>{0.138622269f, 0.593943596f},
-std::array<float,2>{0.444059014f, 0.0190707091f},
-std::array<float,2>{0.781646669f, 0.823698819f},
-std::array<float,2>{0.987968147f, 0.146228686f},
-std::array<float,2>{0.275742114f, 0.983225524f},
-std::array<float,2>{0.118941501f, 0.387175143f},
-std::array<float,2>{0.575747669f, 0.734290361f},
-std::array<float,2>{0.588707209f, 0.1742578f},
-std::array<float,2>{0.100345701f, 0.963807344f},
-std::array<float,2>{0.265249908f, 0.422409862f},
-std::array<float,2>{0.982986808f, 0.715065002f},
-std::array<float,2>{0.800355315f, 0.276286125f},
-std::array<float,2>{0.460971862f, 0.581311285f},
-std::array<float,2>{0.156030431f, 0.0384715945f},
-std::array<float,2>{0.724228978f, 0.856144547f},
-std::array<float,2>{0.625439525f, 0.457945496f},
-std::array<float,2>{0.201773494f, 0.661160767f},
-std::array<float,2>{0.383463174f, 0.2457847f},
-std::array<float,2>{0.838839531f, 0.891702116f},
-std::array<float,2>{0.927397132f, 0.116438821f},
-std::array<float,2>{0.35304454f, 0.800161183f},
-std::array<float,2>{0.00151772879f, 0.347391784f},
-std::array<float,2>{0.540440083f, 0.505100369f},
-std::array<float,2>{0.701007307f, 0.0139951389f},
-std::array<float,2>{0.170096636f, 0.833696425f},
-std::array<float,2>{0.474646062f, 0.286700875f},
-std::array<float,2>{0.780991375f, 0.624796331f},
-std::array<float,2>{0.950940728f, 0.403090894f},
-std::array<float,2>{0.291612387f, 0.736907959f},
-std::array<float,2>{0.0697028786f, 0.133380726f},
-std::array<float,2>{0.614574194f, 0.993067861f},
-std::array<float,2>{0.527376711f, 0.321611106f},
-std::array<float,2>{0.0525245778f, 0.537904203f},
-std::array<float,2>{0.313008249f, 0.0714417323f},
-std::array<float,2>{0.88416934f, 0.778075457f},
-std::array<float,2>{0.850080729f, 0.203138441f},
-std::array<float,2>{0.435309708f, 0.925628603f},
-std::array<float,2>{0.225823969f, 0.474617124f},
-std::array<float,2>{0.677956641f, 0.647334933f},
-std::array<float,2>{0.727624238f, 0.1266388f},
-std::array<float,2>{0.147266254f, 0.985947013f},
-std::array<float,2>{0.460644364f, 0.396843553f},
-std::array<float,2>{0.812047005f, 0.746085346f},
-std::array<float,2>{0.973397017f, 0.294674337f},
-std::array<float,2>{0.256550133f, 0.609756172f},
-std::array<float,2>{0.108611308f, 0.00577297155f},
-std::array<float,2>{0.578481078f, 0.840514481f},
-std::array<float,2>{0.531918168f, 0.482883573f},
-std::array<float,2>{0.0110219046f, 0.652027905f},
-std::array<float,2>{0.349263787f, 0.216573104f},
-std::array<float,2>{0.930831969f, 0.935438573f},
-std::array<float,2>{0.833186686f, 0.0676160678f},
-std::array<float,2>{0.382725835f, 0.770727992f},
-std::array<float,2>{0.194114476f, 0.3161318f},
-std::array<float,2>{0.637136042f, 0.540126324f},
-std::array<float,2>{0.620735645f, 0.0464492403f},
-std::array<float,2>{0.0727665424f, 0.851446509f},
-std::array<float,2>{0.281524986f, 0.266941339f},
-std::array<float,2>{0.94291544f, 0.590415657f},
-std::array<float,2>{0.768975437f, 0.4322083f},
-std::array<float,2>{0.477695465f, 0.703406155f},
-std::array<float,2>{0.160009876f, 0.18417719f},
-std::array<float,2>{0.693807602f, 0.95566529f},
-std::array<float,2>{0.682711542f, 0.356539875f},
-std::array<float,2>{0.229451045f, 0.51063627f},
-std::array<float,2>{0.426816851f, 0.122498609f},
-std::array<float,2>{0.856405318f, 0.810696244f},
-std::array<float,2>{0.875537753f, 0.2347233f},
-std::array<float,2>{0.323669553f, 0.898845732f},
-std::array<float,2>{0.0621907115f, 0.460952014f},
-std::array<float,2>{0.522600651f, 0.666377664f},
-std::array<float,2>{0.501169503f, 0.187938094f},
-std::array<float,2>{0.0447489582f, 0.907535374f},
-std::array<float,2>{0.341388315f, 0.494920224f},
-std::array<float,2>{0.89161253f, 0.625795722f},
-std::array<float,2>{0.871752083f, 0.341073662f},
-std::array<float,2>{0.416759312f, 0.559509397f},
-std::array<float,2>{0.246826068f, 0.0833792612f},
-std::array<float,2>{0.667329669f, 0.762707889f},
-std::array<float,2>{0.705313802f, 0.375941813f},
-std::array<float,2>{0.182103872f, 0.72648567f},
-std::array<float,2>{0.492207289f, 0.151341498f},
-std::array<float,2>{0.750088871f, 0.974237859f},
-std::array<float,2>{0.953880668f, 0.0282321796f},
-std::array<float,2>{0.301490158f, 0.817354381f},
-std::array<float,2>{0.0923147127f, 0.305145919f},
-std::array<float,2>{0.604308844f, 0.602453232f},
-std::array<float,2>{0.641296387f, 0.0986940116f},
-std::array<float,2>{0.21425502f, 0.785518408f},
-std::array<float,2>{0.404550016f, 0.365715265f},
-std::array<float,2>{0.815178037f, 0.52414912f},
-std::array<float,2>{0.913203359f, 0.449513793f},
-std::array<float,2>{0.367491394f, 0.681041539f},
-std::array<float,2>{0.0301476512f, 0.219953075f},
-std::array<float,2>{0.550292253f, 0.876505435f},
-std::array<float,2>{0.564913273f, 0.26196003f},
-std::array<float,2>{0.110177793f, 0.571537495f},
-std::array<float,2>{0.269220889f, 0.0497190617f},
-std::array<float,2>{0.995183706f, 0.863192141f},
-std::array<float,2>{0.791755319f, 0.167005733f},
-std::array<float,2>{0.447375655f, 0.941273391f},
-std::array<float,2>{0.132004723f, 0.409803808f},
-std::array<float,2>{0.741919935f, 0.702923954f},
-std::array<float,2>{0.71094501f, 0.21469745f},
-std::array<float,2>{0.174729243f, 0.933357775f},
-std::array<float,2>{0.488897234f, 0.479665726f},
-std::array<float,2>{0.761373878f, 0.654515803f},
-std::array<float,2>{0.96731627f, 0.318315059f},
-std::array<float,2>{0.307717472f, 0.546225011f},
-std::array<float,2>{0.0783785284f, 0.0642551184f},
-std::array<float,2>{0.599413693f, 0.768046021f},
-std::array<float,2>{0.512887836f, 0.391573817f},
-std::array<float,2>{0.0335036218f, 0.74852556f},
-std::array<float,2>{0.332859218f, 0.131448686f},
-std::array<float,2>{0.904124558f, 0.991039634f},
-std::array<float,2>{0.863639414f, 0.00268251728f},
-std::array<float,2>{0.412276685f, 0.837358594f},
-std::array<float,2>{0.241570726f, 0.29295674f},
-std::array<float,2>{0.657052457f, 0.613820732f},
-std::array<float,2>{0.572671473f, 0.118756115f},
-std::array<float,2>{0.123675779f, 0.806727767f},
-std::array<float,2>{0.280660242f, 0.354974478f},
-std::array<float,2>{0.991013288f, 0.514915824f},
-std::array<float,2>{0.787299931f, 0.466560334f},
-std::array<float,2>{0.440371513f, 0.671138704f},
-std::array<float,2>{0.133663192f, 0.240267262f},
-std::array<float,2>{0.74526161f, 0.905960798f},
-std::array<float,2>{0.655088246f, 0.271479189f},
-std::array<float,2>{0.207124338f, 0.588629484f},
-std::array<float,2>{0.397411883f, 0.0404092409f},
-std::array<float,2>{0.824981332f, 0.847035646f},
-std::array<float,2>{0.919436514f, 0.180896431f},
-std::array<float,2>{0.366806239f, 0.95959276f},
-std::array<float,2>{0.0187581982f, 0.43629685f},
-std::array<float,2>{0.561583102f, 0.707803369f},
-std::array<float,2>{0.543492079f, 0.152606428f},
-std::array<float,2>{0.00510804541f, 0.970920265f},
-std::array<float,2>{0.357683957f, 0.380128056f},
-std::array<float,2>{0.923777223f, 0.722087622f},
-std::array<float,2>{0.842857838f, 0.310641825f},
-std::array<float,2>{0.38752529f, 0.608638465f},
-std::array<float,2>{0.195828825f, 0.0260018222f},
-std::array<float,2>{0.631495476f, 0.815940797f},
-std::array<float,2>{0.719432116f, 0.497785807f},
-std::array<float,2>{0.15146251f, 0.630902052f},
-std::array<float,2>{0.466868788f, 0.193578586f},
-std::array<float,2>{0.8044101f, 0.911580205f},
-std::array<float,2>{0.980074525f, 0.0782282501f},
-std::array<float,2>{0.259719312f, 0.759988666f},
-std::array<float,2>{0.0944875032f, 0.338113725f},
-std::array<float,2>{0.593239188f, 0.557661116f},
-std::array<float,2>{0.672700584f, 0.0524283983f},
-std::array<float,2>{0.222178102f, 0.867117763f},
-std::array<float,2>{0.43060106f, 0.260993838f},
-std::array<float,2>{0.847623944f, 0.577952385f},
-std::array<float,2>{0.890387774f, 0.412433654f},
-std::array<float,2>{0.319202155f, 0.698774397f},
-std::array<float,2>{0.0477979369f, 0.171165451f},
-std::array<float,2>{0.523946404f, 0.943958521f},
-std::array<float,2>{0.610576153f, 0.362748474f},
-std::array<float,2>{0.0662121177f, 0.530587792f},
-std::array<float,2>{0.29505381f, 0.0972009823f},
-std::array<float,2>{0.948138654f, 0.781310499f},
-std::array<float,2>{0.777082026f, 0.22312215f},
-std::array<float,2>{0.47177738f, 0.880292237f},
-std::array<float,2>{0.167357817f, 0.446840703f},
-std::array<float,2>{0.697657168f, 0.685923636f},
-std::array<float,2>{0.63641268f, 0.156815484f},
-std::array<float,2>{0.18939878f, 0.947969735f},
-std::array<float,2>{0.378292143f, 0.416110873f},
-std::array<float,2>{0.8281793f, 0.691663921f},
-std::array<float,2>{0.933936775f, 0.252221733f},
-std::array<float,2>{0.346660793f, 0.562547445f},
-std::array<float,2>{0.011834925f, 0.0580445528f},
-std::array<float,2>{0.536785901f, 0.86975807f},
-std::array<float,2>{0.584472418f, 0.440529972f},
-std::array<float,2>{0.103785917f, 0.67748189f},
-std::array<float,2>{0.250473797f, 0.232462466f},
-std::array<float,2>{0.971289515f, 0.886462271f},
-std::array<float,2>{0.807499826f, 0.102783471f},
-std::array<float,2>{0.453667253f, 0.794389367f},
-std::array<float,2>{0.142857909f, 0.371784806f},
-std::array<float,2>{0.733528912f, 0.521432757f},
-std::array<float,2>{0.516646028f, 0.0209776238f},
-std::array<float,2>{0.0550729819f, 0.825074911f},
-std::array<float,2>{0.325113565f, 0.301799536f},
-std::array<float,2>{0.880711377f, 0.600400567f},
-std::array<float,2>{0.852863371f, 0.385014594f},
-std::array<float,2>{0.422532767f, 0.728570998f},
-std::array<float,2>{0.230617628f, 0.141442031f},
-std::array<float,2>{0.684988976f, 0.977734923f},
-std::array<float,2>{0.691276729f, 0.330048054f},
-std::array<float,2>{0.162689731f, 0.552301526f},
-std::array<float,2>{0.483643889f, 0.0929365084f},
-std::array<float,2>{0.772639632f, 0.7501297f},
-std::array<float,2>{0.940099597f, 0.199905798f},
-std::array<float,2>{0.28852284f, 0.918426275f},
-std::array<float,2>{0.0769644454f, 0.486649841f},
-std::array<float,2>{0.621154189f, 0.634397566f},
-std::array<float,2>{0.606617033f, 0.246122479f},
-std::array<float,2>{0.0875715911f, 0.897926211f},
-std::array<float,2>{0.299842209f, 0.456194162f},
-std::array<float,2>{0.95812577f, 0.658694208f},
-std::array<float,2>{0.754394889f, 0.350429595f},
-std::array<float,2>{0.497770578f, 0.502120852f},
-std::array<float,2>{0.183710828f, 0.112609625f},
-std::array<float,2>{0.707849145f, 0.803029239f},
-std::array<float,2>{0.668876946f, 0.427761853f},
-std::array<float,2>{0.245481253f, 0.713782907f},
-std::array<float,2>{0.418705225f, 0.177117467f},
-std::array<float,2>{0.868285716f, 0.966807604f},
-std::array<float,2>{0.897338152f, 0.0328255631f},
-std::array<float,2>{0.33852914f, 0.852289736f},
-std::array<float,2>{0.0413314514f, 0.278311342f},
-std::array<float,2>{0.50557369f, 0.582662165f},
-std::array<float,2>{0.734599829f, 0.0760579556f},
-std::array<float,2>{0.127965197f, 0.775514066f},
-std::array<float,2>{0.450998068f, 0.325048774f},
-std::array<float,2>{0.793509126f, 0.531787872f},
-std::array<float,2>{0.998829126f, 0.472320586f},
-std::array<float,2>{0.271244437f, 0.643036306f},
-std::array<float,2>{0.115488239f, 0.20730342f},
-std::array<float,2>{0.566467106f, 0.92743659f},
-std::array<float,2>{0.554151952f, 0.282546133f},
-std::array<float,2>{0.0266800094f, 0.620935738f},
-std::array<float,2>{0.371823996f, 0.00939337816f},
-std::array<float,2>{0.909784734f, 0.830679715f},
-std::array<float,2>{0.817226171f, 0.139367163f},
-std::array<float,2>{0.399555445f, 0.997532189f},
-std::array<float,2>{0.215904877f, 0.39954561f},
-std::array<float,2>{0.645870209f, 0.738748848f},
-std::array<float,2>{0.634628713f, 0.232900724f},
-std::array<float,2>{0.191290259f, 0.886475861f},
-std::array<float,2>{0.37586996f, 0.440905273f},
-std::array<float,2>{0.830170929f, 0.677624881f},
-std::array<float,2>{0.936017394f, 0.371826231f},
-std::array<float,2>{0.34410435f, 0.521159112f},
-std::array<float,2>{0.0137378257f, 0.102724664f},
-std::array<float,2>{0.537469804f, 0.794066608f},
-std::array<float,2>{0.582539499f, 0.41638118f},
-std::array<float,2>{0.101844855f, 0.691523433f},
-std::array<float,2>{0.253479451f, 0.157222062f},
-std::array<float,2>{0.970326424f, 0.948094785f},
-std::array<float,2>{0.804893434f, 0.0576557405f},
-std::array<float,2>{0.45548588f, 0.870047271f},
-std::array<float,2>{0.142115295f, 0.252021492f},
-std::array<float,2>{0.731596768f, 0.562957764f},
-std::array<float,2>{0.518865705f, 0.0931614041f},
-std::array<float,2>{0.057990361f, 0.750385523f},
-std::array<float,2>{0.326957583f, 0.329666048f},
-std::array<float,2>{0.882409215f, 0.552719176f},
-std::array<float,2>{0.853693962f, 0.486368209f},
-std::array<float,2>{0.424609721f, 0.63453573f},
-std::array<float,2>{0.23267892f, 0.200165138f},
-std::array<float,2>{0.686044097f, 0.918153644f},
-std::array<float,2>{0.688703299f, 0.302217573f},
-std::array<float,2>{0.160698339f, 0.60025543f},
-std::array<float,2>{0.480769157f, 0.0206490457f},
-std::array<float,2>{0.769816935f, 0.824763417f},
-std::array<float,2>{0.93882978f, 0.141249433f},
-std::array<float,2>{0.285540938f, 0.977825224f},
-std::array<float,2>{0.0743359476f, 0.384851366f},
-std::array<float,2>{0.624964118f, 0.728888154f},
-std::array<float,2>{0.608104706f, 0.176851496f},
-std::array<float,2>{0.0895307735f, 0.967162311f},
-std::array<float,2>{0.297380358f, 0.428125381f},
-std::array<float,2>{0.960106432f, 0.713383377f},
-std::array<float,2>{0.756485939f, 0.277841508f},
-std::array<float,2>{0.498197347f, 0.582947195f},
-std::array<float,2>{0.186838239f, 0.0329920389f},
-std::array<float,2>{0.710052907f, 0.852462828f},
-std::array<float,2>{0.67136091f, 0.45654273f},
-std::array<float,2>{0.242505223f, 0.659170508f},
-std::array<float,2>{0.419977218f, 0.246451661f},
-std::array<float,2>{0.87007302f, 0.897558928f},
-std::array<float,2>{0.89638871f, 0.112384297f},
-std::array<float,2>{0.336155802f, 0.802942038f},
-std::array<float,2>{0.0404185876f, 0.350197524f},
-std::array<float,2>{0.507212996f, 0.502347767f},
-std::array<float,2>{0.738040745f, 0.0097028492f},
-std::array<float,2>{0.12599127f, 0.83085984f},
-std::array<float,2>{0.45267114f, 0.282421589f},
-std::array<float,2>{0.795791328f, 0.620790958f},
-std::array<float,2>{0.997698545f, 0.399868727f},
-std::array<float,2>{0.271870017f, 0.738329649f},
-std::array<float,2>{0.114314206f, 0.139572352f},
-std::array<float,2>{0.568629324f, 0.997230947f},
-std::array<float,2>{0.552413821f, 0.324813873f},
-std::array<float,2>{0.0252317935f, 0.531982899f},
-std::array<float,2>{0.374782801f, 0.0759111717f},
-std::array<float,2>{0.907020807f, 0.775701821f},
-std::array<float,2>{0.818948507f, 0.207267076f},
-std::array<float,2>{0.400593489f, 0.927506745f},
-std::array<float,2>{0.217173725f, 0.472544163f},
-std::array<float,2>{0.646945119f, 0.642769337f},
-std::array<float,2>{0.714492083f, 0.131835073f},
-std::array<float,2>{0.173052981f, 0.990740836f},
-std::array<float,2>{0.491743594f, 0.391241342f},
-std::array<float,2>{0.758309603f, 0.748170853f},
-std::array<float,2>{0.966291845f, 0.292653561f},
-std::array<float,2>{0.30554229f, 0.614018619f},
-std::array<float,2>{0.0818909034f, 0.00270015933f},
-std::array<float,2>{0.600137174f, 0.837053478f},
-std::array<float,2>{0.514943182f, 0.479832053f},
-std::array<float,2>{0.0331518129f, 0.654781342f},
-std::array<float,2>{0.334856957f, 0.214393914f},
-std::array<float,2>{0.904506266f, 0.933199763f},
-std::array<float,2>{0.86644268f, 0.0641449764f},
-std::array<float,2>{0.41113627f, 0.767651796f},
-std::array<float,2>{0.2384689f, 0.31809178f},
-std::array<float,2>{0.658554316f, 0.545920014f},
-std::array<float,2>{0.572000623f, 0.0400473885f},
-std::array<float,2>{0.122977279f, 0.846870124f},
-std::array<float,2>{0.279008567f, 0.271098077f},
-std::array<float,2>{0.989797413f, 0.588435173f},
-std::array<float,2>{0.786015749f, 0.436230659f},
-std::array<float,2>{0.438437611f, 0.707610786f},
-std::array<float,2>{0.136420861f, 0.181055948f},
-std::array<float,2>{0.743739784f, 0.959732831f},
-std::array<float,2>{0.653730512f, 0.354647905f},
-std::array<float,2>{0.209727034f, 0.514697671f},
-std::array<float,2>{0.395062566f, 0.118906736f},
-std::array<float,2>{0.826301634f, 0.806975186f},
-std::array<float,2>{0.921308994f, 0.240510494f},
-std::array<float,2>{0.364570558f, 0.906089664f},
-std::array<float,2>{0.0167792849f, 0.466514945f},
-std::array<float,2>{0.559054852f, 0.671257854f},
-std::array<float,2>{0.545651615f, 0.193634421f},
-std::array<float,2>{0.00688312529f, 0.911364198f},
-std::array<float,2>{0.356589794f, 0.497944951f},
-std::array<float,2>{0.924935341f, 0.631152153f},
-std::array<float,2>{0.841251016f, 0.338331491f},
-std::array<float,2>{0.389509618f, 0.557950377f},
-std::array<float,2>{0.198893324f, 0.0783815533f},
-std::array<float,2>{0.629757643f, 0.760233521f},
-std::array<float,2>{0.721120179f, 0.380099237f},
-std::array<float,2>{0.149071917f, 0.721888661f},
-std::array<float,2>{0.465083897f, 0.152358204f},
-std::array<float,2>{0.800942421f, 0.971074045f},
-std::array<float,2>{0.976929486f, 0.0262574926f},
-std::array<float,2>{0.260814279f, 0.816250026f},
-std::array<float,2>{0.096580483f, 0.310902804f},
-std::array<float,2>{0.591172993f, 0.608717322f},
-std::array<float,2>{0.675601542f, 0.0975277573f},
-std::array<float,2>{0.219946444f, 0.781554937f},
-std::array<float,2>{0.431662291f, 0.362497389f},
-std::array<float,2>{0.844624817f, 0.530391216f},
-std::array<float,2>{0.886782527f, 0.447249502f},
-std::array<float,2>{0.316932142f, 0.685638011f},
-std::array<float,2>{0.0498942472f, 0.222745851f},
-std::array<float,2>{0.527013302f, 0.880060792f},
-std::array<float,2>{0.611559689f, 0.260948539f},
-std::array<float,2>{0.0632264763f, 0.577833414f},
-std::array<float,2>{0.294323593f, 0.0525236949f},
-std::array<float,2>{0.945968509f, 0.866848469f},
-std::array<float,2>{0.774122477f, 0.170999348f},
-std::array<float,2>{0.47015968f, 0.944206476f},
-std::array<float,2>{0.165698141f, 0.412216038f},
-std::array<float,2>{0.696599841f, 0.698983788f},
-std::array<float,2>{0.728535414f, 0.216345161f},
-std::array<float,2>{0.145081654f, 0.93512547f},
-std::array<float,2>{0.458263099f, 0.48259443f},
-std::array<float,2>{0.809764385f, 0.652279913f},
-std::array<float,2>{0.975381017f, 0.316219687f},
-std::array<float,2>{0.253916025f, 0.540350437f},
-std::array<float,2>{0.107084386f, 0.0677799359f},
-std::array<float,2>{0.581952512f, 0.770965159f},
-std::array<float,2>{0.534439862f, 0.396493256f},
-std::array<float,2>{0.00940610841f, 0.745845258f},
-std::array<float,2>{0.350602567f, 0.126885042f},
-std::array<float,2>{0.932429969f, 0.986289501f},
-std::array<float,2>{0.834630251f, 0.00542931771f},
-std::array<float,2>{0.37970838f, 0.840799093f},
-std::array<float,2>{0.192340568f, 0.294692427f},
-std::array<float,2>{0.638850391f, 0.609530747f},
-std::array<float,2>{0.617858887f, 0.122266874f},
-std::array<float,2>{0.0716032609f, 0.810974956f},
-std::array<float,2>{0.284001291f, 0.356920004f},
-std::array<float,2>{0.944774806f, 0.510448337f},
-std::array<float,2>{0.766556919f, 0.461416215f},
-std::array<float,2>{0.478847146f, 0.666254997f},
-std::array<float,2>{0.15753217f, 0.23456955f},
-std::array<float,2>{0.693330526f, 0.898611784f},
-std::array<float,2>{0.680304468f, 0.266731411f},
-std::array<float,2>{0.228204817f, 0.590725124f},
-std::array<float,2>{0.429270655f, 0.0467847884f},
-std::array<float,2>{0.858111203f, 0.851182938f},
-std::array<float,2>{0.878205657f, 0.184334174f},
-std::array<float,2>{0.320683718f, 0.956043661f},
-std::array<float,2>{0.0598619916f, 0.432404786f},
-std::array<float,2>{0.520103633f, 0.703268409f},
-std::array<float,2>{0.503389955f, 0.150945053f},
-std::array<float,2>{0.045277182f, 0.974531054f},
-std::array<float,2>{0.342342466f, 0.375518888f},
-std::array<float,2>{0.893595755f, 0.726242721f},
-std::array<float,2>{0.873220205f, 0.304889232f},
-std::array<float,2>{0.415112078f, 0.602076471f},
-std::array<float,2>{0.249152243f, 0.0279562864f},
-std::array<float,2>{0.664823353f, 0.817111313f},
-std::array<float,2>{0.704000235f, 0.494676769f},
-std::array<float,2>{0.180681214f, 0.625546157f},
-std::array<float,2>{0.494613051f, 0.187643558f},
-std::array<float,2>{0.753318787f, 0.90728116f},
-std::array<float,2>{0.956330359f, 0.0831253752f},
-std::array<float,2>{0.304596692f, 0.763047993f},
-std::array<float,2>{0.0903615057f, 0.340901971f},
-std::array<float,2>{0.602253795f, 0.559168875f},
-std::array<float,2>{0.643027842f, 0.0495578572f},
-std::array<float,2>{0.212457657f, 0.862982988f},
-std::array<float,2>{0.402933568f, 0.262019932f},
-std::array<float,2>{0.813921154f, 0.571320653f},
-std::array<float,2>{0.911054552f, 0.409923345f},
-std::array<float,2>{0.370787799f, 0.702659905f},
-std::array<float,2>{0.0274730232f, 0.167244658f},
-std::array<float,2>{0.547193527f, 0.940934896f},
-std::array<float,2>{0.563471019f, 0.365417868f},
-std::array<float,2>{0.112995952f, 0.524312437f},
-std::array<float,2>{0.266304463f, 0.0989788696f},
-std::array<float,2>{0.993533075f, 0.785203755f},
-std::array<float,2>{0.789928198f, 0.220102131f},
-std::array<float,2>{0.446042985f, 0.876894891f},
-std::array<float,2>{0.130046606f, 0.449456692f},
-std::array<float,2>{0.739648342f, 0.680686533f},
-std::array<float,2>{0.661566019f, 0.160763085f},
-std::array<float,2>{0.2361352f, 0.950911999f},
-std::array<float,2>{0.409726351f, 0.419593424f},
-std::array<float,2>{0.863050938f, 0.68911314f},
-std::array<float,2>{0.900553048f, 0.255520284f},
-std::array<float,2>{0.329872847f, 0.568529606f},
-std::array<float,2>{0.0360946096f, 0.0617473833f},
-std::array<float,2>{0.509269178f, 0.87128669f},
-std::array<float,2>{0.594836473f, 0.441975057f},
-std::array<float,2>{0.0856092945f, 0.673462927f},
-std::array<float,2>{0.311193496f, 0.229082718f},
-std::array<float,2>{0.963561118f, 0.887713373f},
-std::array<float,2>{0.763959467f, 0.108826652f},
-std::array<float,2>{0.486215293f, 0.79288882f},
-std::array<float,2>{0.178876549f, 0.368778199f},
-std::array<float,2>{0.717160821f, 0.518191278f},
-std::array<float,2>{0.556197405f, 0.0194866601f},
-std::array<float,2>{0.0217103809f, 0.823381007f},
-std::array<float,2>{0.36267516f, 0.299956173f},
-std::array<float,2>{0.915761113f, 0.594102025f},
-std::array<float,2>{0.822488129f, 0.386897773f},
-std::array<float,2>{0.391080886f, 0.733983934f},
-std::array<float,2>{0.203979611f, 0.146435052f},
-std::array<float,2>{0.648901522f, 0.983135343f},
-std::array<float,2>{0.747046888f, 0.333115667f},
-std::array<float,2>{0.138772801f, 0.548274636f},
-std::array<float,2>{0.441426039f, 0.0888375863f},
-std::array<float,2>{0.784652889f, 0.756071508f},
-std::array<float,2>{0.98547399f, 0.197677046f},
-std::array<float,2>{0.274043441f, 0.915441334f},
-std::array<float,2>{0.121023357f, 0.489675194f},
-std::array<float,2>{0.576731682f, 0.636789382f},
-std::array<float,2>{0.587487161f, 0.246031716f},
-std::array<float,2>{0.0983776078f, 0.891903698f},
-std::array<float,2>{0.261874259f, 0.457599103f},
-std::array<float,2>{0.980938315f, 0.661552012f},
-std::array<float,2>{0.796937108f, 0.347422838f},
-std::array<float,2>{0.463252366f, 0.505263329f},
-std::array<float,2>{0.153634042f, 0.116621681f},
-std::array<float,2>{0.725294888f, 0.799804747f},
-std::array<float,2>{0.62711519f, 0.422796279f},
-std::array<float,2>{0.199669495f, 0.715185285f},
-std::array<float,2>{0.386547029f, 0.174024776f},
-std::array<float,2>{0.835979402f, 0.963536739f},
-std::array<float,2>{0.928349495f, 0.0380934291f},
-std::array<float,2>{0.354533255f, 0.856361687f},
-std::array<float,2>{0.00211747736f, 0.275905877f},
-std::array<float,2>{0.541320801f, 0.581265509f},
-std::array<float,2>{0.701549709f, 0.0716313571f},
-std::array<float,2>{0.169538587f, 0.7780779f},
-std::array<float,2>{0.474475682f, 0.321426123f},
-std::array<float,2>{0.777573168f, 0.537738621f},
-std::array<float,2>{0.952293098f, 0.474854678f},
-std::array<float,2>{0.289302856f, 0.647027969f},
-std::array<float,2>{0.0676086172f, 0.203373119f},
-std::array<float,2>{0.616266787f, 0.92531997f},
-std::array<float,2>{0.529499471f, 0.286914587f},
-std::array<float,2>{0.0538701303f, 0.624535441f},
-std::array<float,2>{0.315320104f, 0.0138020227f},
-std::array<float,2>{0.886208117f, 0.833896518f},
-std::array<float,2>{0.848996282f, 0.13367635f},
-std::array<float,2>{0.435685903f, 0.992680967f},
-std::array<float,2>{0.224422991f, 0.402907163f},
-std::array<float,2>{0.676104188f, 0.737087369f},
-std::array<float,2>{0.683619857f, 0.202601001f},
-std::array<float,2>{0.23168622f, 0.920812726f},
-std::array<float,2>{0.423462301f, 0.48503387f},
-std::array<float,2>{0.851768672f, 0.635278344f},
-std::array<float,2>{0.879535437f, 0.331457734f},
-std::array<float,2>{0.325196177f, 0.553848803f},
-std::array<float,2>{0.0558545664f, 0.0916336775f},
-std::array<float,2>{0.516223431f, 0.751978695f},
-std::array<float,2>{0.622597635f, 0.384256393f},
-std::array<float,2>{0.0776449144f, 0.727342784f},
-std::array<float,2>{0.287265956f, 0.143676922f},
-std::array<float,2>{0.940531731f, 0.979162455f},
-std::array<float,2>{0.772002876f, 0.0230246037f},
-std::array<float,2>{0.483146995f, 0.827861547f},
-std::array<float,2>{0.163414702f, 0.303322613f},
-std::array<float,2>{0.690149844f, 0.599548042f},
-std::array<float,2>{0.535875857f, 0.104582489f},
-std::array<float,2>{0.0135487374f, 0.796844125f},
-std::array<float,2>{0.347528517f, 0.374329031f},
-std::array<float,2>{0.935449481f, 0.523418069f},
-std::array<float,2>{0.829957962f, 0.437807024f},
-std::array<float,2>{0.377468497f, 0.678338945f},
-std::array<float,2>{0.188059062f, 0.231663123f},
-std::array<float,2>{0.635717094f, 0.884660304f},
-std::array<float,2>{0.73306495f, 0.25039047f},
-std::array<float,2>{0.144053906f, 0.565920532f},
-std::array<float,2>{0.454480201f, 0.0561043359f},
-std::array<float,2>{0.808203042f, 0.868860841f},
-std::array<float,2>{0.971732318f, 0.159242317f},
-std::array<float,2>{0.251254439f, 0.946681857f},
-std::array<float,2>{0.105015412f, 0.414459288f},
-std::array<float,2>{0.585254431f, 0.694924653f},
-std::array<float,2>{0.567956746f, 0.13791433f},
-std::array<float,2>{0.117001943f, 0.999997854f},
-std::array<float,2>{0.269882768f, 0.400798589f},
-std::array<float,2>{0.999254167f, 0.741722584f},
-std::array<float,2>{0.794306636f, 0.284749269f},
-std::array<float,2>{0.449347317f, 0.617489576f},
-std::array<float,2>{0.127815798f, 0.0102951154f},
-std::array<float,2>{0.735883474f, 0.828816056f},
-std::array<float,2>{0.644777596f, 0.469968736f},
-std::array<float,2>{0.21507664f, 0.641088605f},
-std::array<float,2>{0.398813188f, 0.210719898f},
-std::array<float,2>{0.817943692f, 0.92865777f},
-std::array<float,2>{0.90861237f, 0.0772196427f},
-std::array<float,2>{0.372287989f, 0.775275767f},
-std::array<float,2>{0.0256299749f, 0.32692045f},
-std::array<float,2>{0.55307132f, 0.534289062f},
-std::array<float,2>{0.708772779f, 0.034442503f},
-std::array<float,2>{0.18534793f, 0.854839146f},
-std::array<float,2>{0.496841252f, 0.280500442f},
-std::array<float,2>{0.755236566f, 0.584995389f},
-std::array<float,2>{0.957090497f, 0.427203953f},
-std::array<float,2>{0.299161881f, 0.711363077f},
-std::array<float,2>{0.0860600397f, 0.179402381f},
-std::array<float,2>{0.60585469f, 0.966613114f},
-std::array<float,2>{0.503961265f, 0.348210454f},
-std::array<float,2>{0.0422190763f, 0.500775814f},
-std::array<float,2>{0.339285523f, 0.109914318f},
-std::array<float,2>{0.898281455f, 0.80224508f},
-std::array<float,2>{0.867891192f, 0.248369202f},
-std::array<float,2>{0.419606656f, 0.895142496f},
-std::array<float,2>{0.244863376f, 0.453626633f},
-std::array<float,2>{0.669014692f, 0.656282306f},
-std::array<float,2>{0.744159102f, 0.182068601f},
-std::array<float,2>{0.134645492f, 0.957925439f},
-std::array<float,2>{0.440801948f, 0.434805453f},
-std::array<float,2>{0.788365483f, 0.709540248f},
-std::array<float,2>{0.992088974f, 0.273356378f},
-std::array<float,2>{0.280226141f, 0.585987508f},
-std::array<float,2>{0.124599494f, 0.0415426418f},
-std::array<float,2>{0.573931992f, 0.844870865f},
-std::array<float,2>{0.560894012f, 0.467564493f},
-std::array<float,2>{0.0177210756f, 0.669084251f},
-std::array<float,2>{0.366143018f, 0.24020192f},
-std::array<float,2>{0.9182989f, 0.903618634f},
-std::array<float,2>{0.825327575f, 0.119954608f},
-std::array<float,2>{0.398400187f, 0.806406081f},
-std::array<float,2>{0.208964482f, 0.352146953f},
-std::array<float,2>{0.655603349f, 0.512594759f},
-std::array<float,2>{0.597679675f, 0.000864790461f},
-std::array<float,2>{0.0799916759f, 0.839673936f},
-std::array<float,2>{0.307047129f, 0.290428668f},
-std::array<float,2>{0.968114853f, 0.616173089f},
-std::array<float,2>{0.760722518f, 0.393235207f},
-std::array<float,2>{0.489480823f, 0.747205019f},
-std::array<float,2>{0.175712451f, 0.129783392f},
-std::array<float,2>{0.712435484f, 0.989480078f},
-std::array<float,2>{0.658161044f, 0.320055187f},
-std::array<float,2>{0.24104692f, 0.543344259f},
-std::array<float,2>{0.413681746f, 0.0663570464f},
-std::array<float,2>{0.864574969f, 0.76691258f},
-std::array<float,2>{0.902482092f, 0.21233286f},
-std::array<float,2>{0.333642095f, 0.930321693f},
-std::array<float,2>{0.0348640904f, 0.476656884f},
-std::array<float,2>{0.512160778f, 0.65411216f},
-std::array<float,2>{0.525250018f, 0.224660352f},
-std::array<float,2>{0.0479362532f, 0.881135941f},
-std::array<float,2>{0.319806248f, 0.447338134f},
-std::array<float,2>{0.888857961f, 0.685409009f},
-std::array<float,2>{0.846433103f, 0.359921426f},
-std::array<float,2>{0.431128502f, 0.529188275f},
-std::array<float,2>{0.221677035f, 0.0938020051f},
-std::array<float,2>{0.673365891f, 0.783511817f},
-std::array<float,2>{0.698696733f, 0.41201362f},
-std::array<float,2>{0.166200876f, 0.696764946f},
-std::array<float,2>{0.471051186f, 0.16969879f},
-std::array<float,2>{0.776219189f, 0.94175458f},
-std::array<float,2>{0.948637187f, 0.0544708818f},
-std::array<float,2>{0.296492189f, 0.864661396f},
-std::array<float,2>{0.0644546002f, 0.259753525f},
-std::array<float,2>{0.610046208f, 0.575841367f},
-std::array<float,2>{0.632416129f, 0.0819628984f},
-std::array<float,2>{0.19704546f, 0.7580446f},
-std::array<float,2>{0.388262302f, 0.337469816f},
-std::array<float,2>{0.842592359f, 0.555768251f},
-std::array<float,2>{0.921969295f, 0.498831868f},
-std::array<float,2>{0.35897091f, 0.629727244f},
-std::array<float,2>{0.00411937665f, 0.192539588f},
-std::array<float,2>{0.544345379f, 0.912185848f},
-std::array<float,2>{0.592375994f, 0.310029507f},
-std::array<float,2>{0.0947313383f, 0.607150614f},
-std::array<float,2>{0.258761406f, 0.0243578516f},
-std::array<float,2>{0.978574216f, 0.814009309f},
-std::array<float,2>{0.802871346f, 0.155141011f},
-std::array<float,2>{0.468008101f, 0.969214022f},
-std::array<float,2>{0.151284933f, 0.380898803f},
-std::array<float,2>{0.720622122f, 0.719907463f},
-std::array<float,2>{0.695169628f, 0.237903789f},
-std::array<float,2>{0.158805534f, 0.901484132f},
-std::array<float,2>{0.476950645f, 0.463795215f},
-std::array<float,2>{0.767836928f, 0.66469717f},
-std::array<float,2>{0.941895068f, 0.357713461f},
-std::array<float,2>{0.282477498f, 0.508470476f},
-std::array<float,2>{0.0735259205f, 0.124283269f},
-std::array<float,2>{0.62007165f, 0.80971998f},
-std::array<float,2>{0.522155344f, 0.429892182f},
-std::array<float,2>{0.0606142767f, 0.706313431f},
-std::array<float,2>{0.322419196f, 0.187423259f},
-std::array<float,2>{0.876625836f, 0.954944074f},
-std::array<float,2>{0.856928706f, 0.0440798067f},
-std::array<float,2>{0.425799608f, 0.84930259f},
-std::array<float,2>{0.230438083f, 0.268522322f},
-std::array<float,2>{0.682124496f, 0.592141688f},
-std::array<float,2>{0.579423487f, 0.0697205365f},
-std::array<float,2>{0.10754434f, 0.771877468f},
-std::array<float,2>{0.25728339f, 0.314067096f},
-std::array<float,2>{0.974223614f, 0.54235816f},
-std::array<float,2>{0.810625792f, 0.481399953f},
-std::array<float,2>{0.459365994f, 0.649475336f},
-std::array<float,2>{0.14801605f, 0.218304157f},
-std::array<float,2>{0.727118909f, 0.935552955f},
-std::array<float,2>{0.637919724f, 0.294941664f},
-std::array<float,2>{0.195119411f, 0.613269746f},
-std::array<float,2>{0.381586164f, 0.0066831978f},
-std::array<float,2>{0.832356334f, 0.842857003f},
-std::array<float,2>{0.930488169f, 0.127204463f},
-std::array<float,2>{0.34786132f, 0.986884594f},
-std::array<float,2>{0.00976691302f, 0.396216333f},
-std::array<float,2>{0.533036113f, 0.74343586f},
-std::array<float,2>{0.549291909f, 0.16433765f},
-std::array<float,2>{0.0303202495f, 0.937837422f},
-std::array<float,2>{0.368874073f, 0.407861114f},
-std::array<float,2>{0.912124395f, 0.700315952f},
-std::array<float,2>{0.816339552f, 0.264382124f},
-std::array<float,2>{0.40567857f, 0.574193358f},
-std::array<float,2>{0.212943226f, 0.0485479198f},
-std::array<float,2>{0.641614079f, 0.860286832f},
-std::array<float,2>{0.74059689f, 0.451888204f},
-std::array<float,2>{0.131465316f, 0.682205677f},
-std::array<float,2>{0.449016094f, 0.221344456f},
-std::array<float,2>{0.792115569f, 0.877918005f},
-std::array<float,2>{0.994203568f, 0.100653626f},
-std::array<float,2>{0.267834902f, 0.787564635f},
-std::array<float,2>{0.110366404f, 0.364296913f},
-std::array<float,2>{0.565837801f, 0.52710712f},
-std::array<float,2>{0.666082025f, 0.031216763f},
-std::array<float,2>{0.247923374f, 0.819122314f},
-std::array<float,2>{0.417253494f, 0.30840835f},
-std::array<float,2>{0.872643411f, 0.605344594f},
-std::array<float,2>{0.890778482f, 0.378039211f},
-std::array<float,2>{0.3398678f, 0.723608851f},
-std::array<float,2>{0.0437886491f, 0.149515361f},
-std::array<float,2>{0.500226974f, 0.97483021f},
-std::array<float,2>{0.604983747f, 0.342534453f},
-std::array<float,2>{0.0936475992f, 0.562387347f},
-std::array<float,2>{0.302673221f, 0.0848239511f},
-std::array<float,2>{0.954321384f, 0.764745176f},
-std::array<float,2>{0.751681328f, 0.19082284f},
-std::array<float,2>{0.493652523f, 0.909481168f},
-std::array<float,2>{0.183156177f, 0.492735386f},
-std::array<float,2>{0.706321478f, 0.628166616f},
-std::array<float,2>{0.651693642f, 0.146836802f},
-std::array<float,2>{0.206641078f, 0.98141557f},
-std::array<float,2>{0.392755687f, 0.389582127f},
-std::array<float,2>{0.821926951f, 0.73171711f},
-std::array<float,2>{0.917146504f, 0.298119634f},
-std::array<float,2>{0.361013412f, 0.596663177f},
-std::array<float,2>{0.0197193027f, 0.0170661621f},
-std::array<float,2>{0.558498323f, 0.821396112f},
-std::array<float,2>{0.575169563f, 0.490500927f},
-std::array<float,2>{0.118067086f, 0.640501022f},
-std::array<float,2>{0.277056068f, 0.195641801f},
-std::array<float,2>{0.986807466f, 0.916494131f},
-std::array<float,2>{0.782679975f, 0.0864472762f},
-std::array<float,2>{0.444877923f, 0.755300105f},
-std::array<float,2>{0.13760981f, 0.334489614f},
-std::array<float,2>{0.749123812f, 0.548865795f},
-std::array<float,2>{0.51058805f, 0.0590403676f},
-std::array<float,2>{0.0378804952f, 0.873275399f},
-std::array<float,2>{0.331221968f, 0.256148547f},
-std::array<float,2>{0.899269342f, 0.5671134f},
-std::array<float,2>{0.860055864f, 0.42178458f},
-std::array<float,2>{0.407770991f, 0.690579176f},
-std::array<float,2>{0.236620516f, 0.162521496f},
-std::array<float,2>{0.663267553f, 0.952272296f},
-std::array<float,2>{0.716756701f, 0.36914438f},
-std::array<float,2>{0.177580729f, 0.515901446f},
-std::array<float,2>{0.486742318f, 0.106200092f},
-std::array<float,2>{0.763578832f, 0.790985644f},
-std::array<float,2>{0.962252617f, 0.228344738f},
-std::array<float,2>{0.309079349f, 0.888757288f},
-std::array<float,2>{0.0836991444f, 0.443755984f},
-std::array<float,2>{0.596586823f, 0.675430596f},
-std::array<float,2>{0.613749623f, 0.206011534f},
-std::array<float,2>{0.0683739632f, 0.922757745f},
-std::array<float,2>{0.292252481f, 0.472889394f},
-std::array<float,2>{0.949415028f, 0.645352602f},
-std::array<float,2>{0.779329896f, 0.322406918f},
-std::array<float,2>{0.476263434f, 0.535166085f},
-std::array<float,2>{0.17129904f, 0.0725354701f},
-std::array<float,2>{0.699691296f, 0.781136692f},
-std::array<float,2>{0.67945677f, 0.40547809f},
-std::array<float,2>{0.225326881f, 0.734513998f},
-std::array<float,2>{0.433650464f, 0.134831235f},
-std::array<float,2>{0.851124227f, 0.994277954f},
-std::array<float,2>{0.883074999f, 0.0128074642f},
-std::array<float,2>{0.314435512f, 0.835204005f},
-std::array<float,2>{0.0509964675f, 0.289017498f},
-std::array<float,2>{0.529169142f, 0.621394455f},
-std::array<float,2>{0.723608255f, 0.113565691f},
-std::array<float,2>{0.155064434f, 0.798310816f},
-std::array<float,2>{0.462587893f, 0.34430626f},
-std::array<float,2>{0.798860013f, 0.506609857f},
-std::array<float,2>{0.983907223f, 0.460627049f},
-std::array<float,2>{0.264365345f, 0.662247896f},
-std::array<float,2>{0.100888148f, 0.242621809f},
-std::array<float,2>{0.589378774f, 0.893960118f},
-std::array<float,2>{0.539730251f, 0.274970978f},
-std::array<float,2>{0.000470583909f, 0.578187227f},
-std::array<float,2>{0.352128983f, 0.0364295989f},
-std::array<float,2>{0.926465809f, 0.857512832f},
-std::array<float,2>{0.839441478f, 0.172983795f},
-std::array<float,2>{0.384311467f, 0.962439954f},
-std::array<float,2>{0.202601552f, 0.425134927f},
-std::array<float,2>{0.626408875f, 0.717970312f},
-std::array<float,2>{0.647610009f, 0.209322885f},
-std::array<float,2>{0.218448192f, 0.928779066f},
-std::array<float,2>{0.401703596f, 0.468920171f},
-std::array<float,2>{0.819940627f, 0.641778708f},
-std::array<float,2>{0.907666028f, 0.327631354f},
-std::array<float,2>{0.3734909f, 0.533423901f},
-std::array<float,2>{0.0235287119f, 0.0767085329f},
-std::array<float,2>{0.551237881f, 0.773850203f},
-std::array<float,2>{0.56958282f, 0.401459277f},
-std::array<float,2>{0.113866642f, 0.740234673f},
-std::array<float,2>{0.272679448f, 0.137603596f},
-std::array<float,2>{0.996564806f, 0.998515606f},
-std::array<float,2>{0.796731412f, 0.0115085114f},
-std::array<float,2>{0.452146947f, 0.82993561f},
-std::array<float,2>{0.125021935f, 0.283522576f},
-std::array<float,2>{0.736914992f, 0.618174076f},
-std::array<float,2>{0.506021857f, 0.111058794f},
-std::array<float,2>{0.0393597372f, 0.801215589f},
-std::array<float,2>{0.337711722f, 0.349209607f},
-std::array<float,2>{0.89483875f, 0.501223624f},
-std::array<float,2>{0.871090353f, 0.454697937f},
-std::array<float,2>{0.421118438f, 0.658141792f},
-std::array<float,2>{0.24335964f, 0.249642223f},
-std::array<float,2>{0.670646966f, 0.896174014f},
-std::array<float,2>{0.709046662f, 0.279663175f},
-std::array<float,2>{0.186129853f, 0.584223092f},
-std::array<float,2>{0.49961707f, 0.0337772742f},
-std::array<float,2>{0.75773114f, 0.854078293f},
-std::array<float,2>{0.95988059f, 0.178673416f},
-std::array<float,2>{0.298092425f, 0.965649664f},
-std::array<float,2>{0.0882609934f, 0.426312208f},
-std::array<float,2>{0.608764768f, 0.712132096f},
-std::array<float,2>{0.623813808f, 0.143076137f},
-std::array<float,2>{0.075761348f, 0.980240822f},
-std::array<float,2>{0.286482215f, 0.383722782f},
-std::array<float,2>{0.937832713f, 0.728202343f},
-std::array<float,2>{0.771015763f, 0.304522187f},
-std::array<float,2>{0.482340097f, 0.598358274f},
-std::array<float,2>{0.161307678f, 0.021961052f},
-std::array<float,2>{0.68792063f, 0.826756775f},
-std::array<float,2>{0.686858773f, 0.485546231f},
-std::array<float,2>{0.234140933f, 0.635878503f},
-std::array<float,2>{0.424918205f, 0.201277733f},
-std::array<float,2>{0.855239749f, 0.920911491f},
-std::array<float,2>{0.881196499f, 0.0899795964f},
-std::array<float,2>{0.327486753f, 0.753529429f},
-std::array<float,2>{0.0569835268f, 0.330525994f},
-std::array<float,2>{0.5179829f, 0.553540528f},
-std::array<float,2>{0.730599999f, 0.0552958772f},
-std::array<float,2>{0.141300574f, 0.867600262f},
-std::array<float,2>{0.456866205f, 0.251209855f},
-std::array<float,2>{0.806062639f, 0.565307558f},
-std::array<float,2>{0.969177961f, 0.416007638f},
-std::array<float,2>{0.252322555f, 0.694286466f},
-std::array<float,2>{0.102820024f, 0.158621505f},
-std::array<float,2>{0.583701134f, 0.945743799f},
-std::array<float,2>{0.5383178f, 0.373722076f},
-std::array<float,2>{0.0155765684f, 0.521677613f},
-std::array<float,2>{0.34485656f, 0.103769526f},
-std::array<float,2>{0.93724376f, 0.795579493f},
-std::array<float,2>{0.831310093f, 0.230541393f},
-std::array<float,2>{0.376542509f, 0.882856369f},
-std::array<float,2>{0.189932123f, 0.439030737f},
-std::array<float,2>{0.633496404f, 0.679260731f},
-std::array<float,2>{0.695581079f, 0.167969257f},
-std::array<float,2>{0.164816082f, 0.94288379f},
-std::array<float,2>{0.468923837f, 0.410767376f},
-std::array<float,2>{0.774970829f, 0.696092129f},
-std::array<float,2>{0.946979761f, 0.258664042f},
-std::array<float,2>{0.29350403f, 0.574859798f},
-std::array<float,2>{0.0643216372f, 0.0529693104f},
-std::array<float,2>{0.612820208f, 0.864081919f},
-std::array<float,2>{0.526218534f, 0.449154586f},
-std::array<float,2>{0.0496637449f, 0.684404016f},
-std::array<float,2>{0.317918539f, 0.226488993f},
-std::array<float,2>{0.888074815f, 0.882554233f},
-std::array<float,2>{0.844874501f, 0.0947793424f},
-std::array<float,2>{0.432762027f, 0.785031438f},
-std::array<float,2>{0.219714478f, 0.360775501f},
-std::array<float,2>{0.674367607f, 0.528292418f},
-std::array<float,2>{0.590500951f, 0.025051523f},
-std::array<float,2>{0.0967459157f, 0.812900305f},
-std::array<float,2>{0.2607162f, 0.309510857f},
-std::array<float,2>{0.978280067f, 0.605591714f},
-std::array<float,2>{0.802337825f, 0.382638961f},
-std::array<float,2>{0.466095299f, 0.719383597f},
-std::array<float,2>{0.149662346f, 0.155447692f},
-std::array<float,2>{0.721992612f, 0.969785511f},
-std::array<float,2>{0.630463481f, 0.335976452f},
-std::array<float,2>{0.19729875f, 0.554755628f},
-std::array<float,2>{0.390005171f, 0.080430381f},
-std::array<float,2>{0.840329349f, 0.759629309f},
-std::array<float,2>{0.924744368f, 0.192149475f},
-std::array<float,2>{0.35608092f, 0.913305759f},
-std::array<float,2>{0.00598855829f, 0.499970496f},
-std::array<float,2>{0.546111822f, 0.629889011f},
-std::array<float,2>{0.559988379f, 0.239064306f},
-std::array<float,2>{0.015790727f, 0.902948797f},
-std::array<float,2>{0.363393635f, 0.46856761f},
-std::array<float,2>{0.920756161f, 0.668007553f},
-std::array<float,2>{0.827547193f, 0.353508443f},
-std::array<float,2>{0.395718664f, 0.51338011f},
-std::array<float,2>{0.210054278f, 0.120769747f},
-std::array<float,2>{0.652573526f, 0.805260301f},
-std::array<float,2>{0.742783427f, 0.433646381f},
-std::array<float,2>{0.135697067f, 0.71047008f},
-std::array<float,2>{0.438673109f, 0.182699218f},
-std::array<float,2>{0.786142051f, 0.9588328f},
-std::array<float,2>{0.989095449f, 0.0422274433f},
-std::array<float,2>{0.277473807f, 0.843963861f},
-std::array<float,2>{0.121474259f, 0.272076905f},
-std::array<float,2>{0.570777953f, 0.587715447f},
-std::array<float,2>{0.659559131f, 0.0645007044f},
-std::array<float,2>{0.239781633f, 0.765843093f},
-std::array<float,2>{0.411057979f, 0.318842977f},
-std::array<float,2>{0.865896285f, 0.544739187f},
-std::array<float,2>{0.905602217f, 0.477899253f},
-std::array<float,2>{0.335498333f, 0.65241611f},
-std::array<float,2>{0.0314286537f, 0.211839363f},
-std::array<float,2>{0.513886809f, 0.930807948f},
-std::array<float,2>{0.600927234f, 0.289875895f},
-std::array<float,2>{0.0804069489f, 0.616894901f},
-std::array<float,2>{0.306331515f, 0.00166457263f},
-std::array<float,2>{0.965701401f, 0.838597894f},
-std::array<float,2>{0.758959651f, 0.130175352f},
-std::array<float,2>{0.490882993f, 0.989192784f},
-std::array<float,2>{0.172781289f, 0.394222319f},
-std::array<float,2>{0.713236809f, 0.746925712f},
-std::array<float,2>{0.738967717f, 0.221951097f},
-std::array<float,2>{0.129073203f, 0.8782444f},
-std::array<float,2>{0.446410626f, 0.452531815f},
-std::array<float,2>{0.791012883f, 0.682655871f},
-std::array<float,2>{0.992261708f, 0.364217907f},
-std::array<float,2>{0.26705879f, 0.525725782f},
-std::array<float,2>{0.112173952f, 0.0997828618f},
-std::array<float,2>{0.563760996f, 0.788553357f},
-std::array<float,2>{0.548560917f, 0.406353474f},
-std::array<float,2>{0.0286844764f, 0.69950521f},
-std::array<float,2>{0.369634867f, 0.165039197f},
-std::array<float,2>{0.912104368f, 0.938661575f},
-std::array<float,2>{0.812816143f, 0.0470244698f},
-std::array<float,2>{0.403596848f, 0.860691369f},
-std::array<float,2>{0.211821243f, 0.265172929f},
-std::array<float,2>{0.64360851f, 0.572600782f},
-std::array<float,2>{0.602869451f, 0.0850400552f},
-std::array<float,2>{0.0917896554f, 0.764563084f},
-std::array<float,2>{0.303447723f, 0.343176901f},
-std::array<float,2>{0.955659151f, 0.560923219f},
-std::array<float,2>{0.752603471f, 0.493777573f},
-std::array<float,2>{0.495759308f, 0.627707362f},
-std::array<float,2>{0.180019692f, 0.189958543f},
-std::array<float,2>{0.704391301f, 0.908786476f},
-std::array<float,2>{0.665619552f, 0.306868166f},
-std::array<float,2>{0.248522058f, 0.603926659f},
-std::array<float,2>{0.414525658f, 0.030031126f},
-std::array<float,2>{0.874868095f, 0.819436371f},
-std::array<float,2>{0.893510163f, 0.148489267f},
-std::array<float,2>{0.343384236f, 0.976213932f},
-std::array<float,2>{0.0467415154f, 0.377535492f},
-std::array<float,2>{0.502901435f, 0.723913848f},
-std::array<float,2>{0.520763814f, 0.186298221f},
-std::array<float,2>{0.0586617254f, 0.953334868f},
-std::array<float,2>{0.321684897f, 0.431328177f},
-std::array<float,2>{0.877784729f, 0.705850899f},
-std::array<float,2>{0.858604729f, 0.269212186f},
-std::array<float,2>{0.428458422f, 0.5931831f},
-std::array<float,2>{0.227202684f, 0.0433795415f},
-std::array<float,2>{0.681555092f, 0.847668648f},
-std::array<float,2>{0.691705406f, 0.464685768f},
-std::array<float,2>{0.156450674f, 0.665835142f},
-std::array<float,2>{0.480320662f, 0.236663431f},
-std::array<float,2>{0.767158926f, 0.900512576f},
-std::array<float,2>{0.944047868f, 0.123274103f},
-std::array<float,2>{0.284801126f, 0.808778107f},
-std::array<float,2>{0.071031794f, 0.358657598f},
-std::array<float,2>{0.618511379f, 0.509569764f},
-std::array<float,2>{0.640471339f, 0.00723181898f},
-std::array<float,2>{0.192508385f, 0.842750013f},
-std::array<float,2>{0.380084395f, 0.296222329f},
-std::array<float,2>{0.835350573f, 0.612120509f},
-std::array<float,2>{0.933202386f, 0.395445168f},
-std::array<float,2>{0.349958092f, 0.742826939f},
-std::array<float,2>{0.00868557859f, 0.128856033f},
-std::array<float,2>{0.533931136f, 0.987959266f},
-std::array<float,2>{0.58046484f, 0.312956274f},
-std::array<float,2>{0.10593392f, 0.541439652f},
-std::array<float,2>{0.254926026f, 0.0684700683f},
-std::array<float,2>{0.97603327f, 0.772563517f},
-std::array<float,2>{0.808805883f, 0.217312038f},
-std::array<float,2>{0.457811028f, 0.937023282f},
-std::array<float,2>{0.146386683f, 0.482301772f},
-std::array<float,2>{0.729787469f, 0.649028957f},
-std::array<float,2>{0.677505851f, 0.136368185f},
-std::array<float,2>{0.2233347f, 0.995830595f},
-std::array<float,2>{0.437123686f, 0.405100882f},
-std::array<float,2>{0.848006189f, 0.736195982f},
-std::array<float,2>{0.885038793f, 0.28784138f},
-std::array<float,2>{0.315738678f, 0.622512341f},
-std::array<float,2>{0.0530150868f, 0.0124192769f},
-std::array<float,2>{0.530581892f, 0.834436655f},
-std::array<float,2>{0.61558789f, 0.474009842f},
-std::array<float,2>{0.0670527071f, 0.645517826f},
-std::array<float,2>{0.290975392f, 0.20677571f},
-std::array<float,2>{0.951775014f, 0.923230708f},
-std::array<float,2>{0.779135287f, 0.0736320093f},
-std::array<float,2>{0.47350809f, 0.779929399f},
-std::array<float,2>{0.168378621f, 0.323870033f},
-std::array<float,2>{0.702577472f, 0.536627173f},
-std::array<float,2>{0.542504549f, 0.0353322253f},
-std::array<float,2>{0.0030076988f, 0.858692765f},
-std::array<float,2>{0.354139864f, 0.273870736f},
-std::array<float,2>{0.929413438f, 0.579800129f},
-std::array<float,2>{0.837754607f, 0.424405694f},
-std::array<float,2>{0.385352701f, 0.717401385f},
-std::array<float,2>{0.200378463f, 0.172580987f},
-std::array<float,2>{0.628362596f, 0.961556554f},
-std::array<float,2>{0.726527214f, 0.345532447f},
-std::array<float,2>{0.153031141f, 0.507175148f},
-std::array<float,2>{0.464489996f, 0.115153685f},
-std::array<float,2>{0.798058808f, 0.79767102f},
-std::array<float,2>{0.981531262f, 0.243634179f},
-std::array<float,2>{0.263622284f, 0.893307686f},
-std::array<float,2>{0.0988358706f, 0.459391594f},
-std::array<float,2>{0.586418092f, 0.663732648f},
-std::array<float,2>{0.577674329f, 0.196921021f},
-std::array<float,2>{0.119264074f, 0.917631924f},
-std::array<float,2>{0.274908721f, 0.491211921f},
-std::array<float,2>{0.985341728f, 0.63935113f},
-std::array<float,2>{0.783874452f, 0.335074753f},
-std::array<float,2>{0.442935616f, 0.550347567f},
-std::array<float,2>{0.13969405f, 0.087728329f},
-std::array<float,2>{0.747192681f, 0.754238188f},
-std::array<float,2>{0.64970386f, 0.390472889f},
-std::array<float,2>{0.204682022f, 0.730723441f},
-std::array<float,2>{0.392178178f, 0.148242071f},
-std::array<float,2>{0.824149311f, 0.98154074f},
-std::array<float,2>{0.914375424f, 0.0165755898f},
-std::array<float,2>{0.361885756f, 0.821204782f},
-std::array<float,2>{0.0225204322f, 0.29691726f},
-std::array<float,2>{0.554928303f, 0.59760797f},
-std::array<float,2>{0.718120754f, 0.107377745f},
-std::array<float,2>{0.177912518f, 0.789601207f},
-std::array<float,2>{0.485178739f, 0.370647997f},
-std::array<float,2>{0.7648983f, 0.517345965f},
-std::array<float,2>{0.964713454f, 0.445201576f},
-std::array<float,2>{0.312132448f, 0.674641132f},
-std::array<float,2>{0.0842166692f, 0.226874754f},
-std::array<float,2>{0.59451437f, 0.890206516f},
-std::array<float,2>{0.508427918f, 0.257307261f},
-std::array<float,2>{0.03622666f, 0.568228662f},
-std::array<float,2>{0.328169525f, 0.0600246117f},
-std::array<float,2>{0.901527524f, 0.874503195f},
-std::array<float,2>{0.861676395f, 0.163121074f},
-std::array<float,2>{0.408732623f, 0.951710582f},
-std::array<float,2>{0.235310465f, 0.419986159f},
-std::array<float,2>{0.660271347f, 0.689680159f},
-std::array<float,2>{0.66821444f, 0.247492939f},
-std::array<float,2>{0.245860487f, 0.897275805f},
-std::array<float,2>{0.418260276f, 0.455147237f},
-std::array<float,2>{0.868779421f, 0.66007036f},
-std::array<float,2>{0.896829128f, 0.351420015f},
-std::array<float,2>{0.33801806f, 0.503319561f},
-std::array<float,2>{0.0415425003f, 0.112250373f},
-std::array<float,2>{0.505203485f, 0.803999186f},
-std::array<float,2>{0.607368052f, 0.429259568f},
-std::array<float,2>{0.0873755887f, 0.713917792f},
-std::array<float,2>{0.300470084f, 0.176267311f},
-std::array<float,2>{0.95858264f, 0.968309045f},
-std::array<float,2>{0.754311144f, 0.0316985287f},
-std::array<float,2>{0.497424811f, 0.852665424f},
-std::array<float,2>{0.184391662f, 0.278678209f},
-std::array<float,2>{0.707481384f, 0.583734453f},
-std::array<float,2>{0.554402769f, 0.0744221509f},
-std::array<float,2>{0.0272353236f, 0.777197242f},
-std::array<float,2>{0.371226937f, 0.325502127f},
-std::array<float,2>{0.909271717f, 0.532939076f},
-std::array<float,2>{0.816704392f, 0.471584648f},
-std::array<float,2>{0.400348514f, 0.644446909f},
-std::array<float,2>{0.216741353f, 0.208281159f},
-std::array<float,2>{0.646087825f, 0.926558316f},
-std::array<float,2>{0.735250652f, 0.281294525f},
-std::array<float,2>{0.128775686f, 0.619179845f},
-std::array<float,2>{0.450504094f, 0.00852797553f},
-std::array<float,2>{0.793369174f, 0.831376493f},
-std::array<float,2>{0.998280406f, 0.139758199f},
-std::array<float,2>{0.270667613f, 0.99647963f},
-std::array<float,2>{0.115763754f, 0.399273574f},
-std::array<float,2>{0.566984296f, 0.73952353f},
-std::array<float,2>{0.584619164f, 0.158058658f},
-std::array<float,2>{0.104341857f, 0.949213505f},
-std::array<float,2>{0.250684142f, 0.417718649f},
-std::array<float,2>{0.970976949f, 0.692981839f},
-std::array<float,2>{0.806981385f, 0.253199518f},
-std::array<float,2>{0.453429699f, 0.563702643f},
-std::array<float,2>{0.143380985f, 0.0568965264f},
-std::array<float,2>{0.734076679f, 0.870789289f},
-std::array<float,2>{0.635832191f, 0.440375f},
-std::array<float,2>{0.188750029f, 0.676388264f},
-std::array<float,2>{0.37842384f, 0.234219387f},
-std::array<float,2>{0.829013288f, 0.885006607f},
-std::array<float,2>{0.934558988f, 0.101795651f},
-std::array<float,2>{0.345930517f, 0.793088913f},
-std::array<float,2>{0.0122328391f, 0.372920632f},
-std::array<float,2>{0.536455572f, 0.519985318f},
-std::array<float,2>{0.690832675f, 0.0200288873f},
-std::array<float,2>{0.162416518f, 0.825285852f},
-std::array<float,2>{0.484231234f, 0.301114351f},
-std::array<float,2>{0.773081899f, 0.601169229f},
-std::array<float,2>{0.939674973f, 0.385827899f},
-std::array<float,2>{0.288654119f, 0.730410635f},
-std::array<float,2>{0.0765746161f, 0.141691759f},
-std::array<float,2>{0.62192589f, 0.976771295f},
-std::array<float,2>{0.517325282f, 0.32834813f},
-std::array<float,2>{0.0554117598f, 0.551084697f},
-std::array<float,2>{0.324591875f, 0.0927070156f},
-std::array<float,2>{0.880139828f, 0.751143634f},
-std::array<float,2>{0.853273153f, 0.200363815f},
-std::array<float,2>{0.422014326f, 0.919608355f},
-std::array<float,2>{0.231199041f, 0.487809122f},
-std::array<float,2>{0.685542762f, 0.632955849f},
-std::array<float,2>{0.718834698f, 0.15397127f},
-std::array<float,2>{0.152052626f, 0.972590268f},
-std::array<float,2>{0.467550695f, 0.37986508f},
-std::array<float,2>{0.803911626f, 0.721036971f},
-std::array<float,2>{0.979582489f, 0.311616212f},
-std::array<float,2>{0.259174675f, 0.607823551f},
-std::array<float,2>{0.0939587951f, 0.0269222613f},
-std::array<float,2>{0.593299925f, 0.814710915f},
-std::array<float,2>{0.543305576f, 0.496639282f},
-std::array<float,2>{0.00548068481f, 0.632517695f},
-std::array<float,2>{0.358336598f, 0.195052847f},
-std::array<float,2>{0.923312902f, 0.910927415f},
-std::array<float,2>{0.843445897f, 0.0791503638f},
-std::array<float,2>{0.387138844f, 0.761324108f},
-std::array<float,2>{0.195728302f, 0.339469194f},
-std::array<float,2>{0.631236494f, 0.556794465f},
-std::array<float,2>{0.611156821f, 0.0509503372f},
-std::array<float,2>{0.0656945929f, 0.866092324f},
-std::array<float,2>{0.295611322f, 0.260605484f},
-std::array<float,2>{0.947512984f, 0.576619804f},
-std::array<float,2>{0.77662307f, 0.41352734f},
-std::array<float,2>{0.472420096f, 0.69761765f},
-std::array<float,2>{0.167502657f, 0.170577541f},
-std::array<float,2>{0.698048055f, 0.945083261f},
-std::array<float,2>{0.67193979f, 0.361594915f},
-std::array<float,2>{0.221821025f, 0.529363453f},
-std::array<float,2>{0.429744899f, 0.0959142447f},
-std::array<float,2>{0.847014546f, 0.782310009f},
-std::array<float,2>{0.889708817f, 0.224154189f},
-std::array<float,2>{0.318436414f, 0.879238844f},
-std::array<float,2>{0.0470547378f, 0.446075201f},
-std::array<float,2>{0.523642063f, 0.68671459f},
-std::array<float,2>{0.51355809f, 0.213377833f},
-std::array<float,2>{0.0338185579f, 0.932583451f},
-std::array<float,2>{0.332496941f, 0.47932896f},
-std::array<float,2>{0.90353477f, 0.655881405f},
-std::array<float,2>{0.864257693f, 0.316464156f},
-std::array<float,2>{0.412930936f, 0.545443356f},
-std::array<float,2>{0.241925806f, 0.0628221855f},
-std::array<float,2>{0.656615376f, 0.769042373f},
-std::array<float,2>{0.711634636f, 0.391637772f},
-std::array<float,2>{0.174037889f, 0.749791801f},
-std::array<float,2>{0.48836714f, 0.132790118f},
-std::array<float,2>{0.760839939f, 0.992033839f},
-std::array<float,2>{0.966820121f, 0.00382923335f},
-std::array<float,2>{0.308581531f, 0.836810529f},
-std::array<float,2>{0.078925021f, 0.291260809f},
-std::array<float,2>{0.598864079f, 0.614727974f},
-std::array<float,2>{0.654403508f, 0.117364369f},
-std::array<float,2>{0.207950518f, 0.808311224f},
-std::array<float,2>{0.396824926f, 0.354382634f},
-std::array<float,2>{0.824398756f, 0.514487207f},
-std::array<float,2>{0.919090986f, 0.465087235f},
-std::array<float,2>{0.36664167f, 0.670303106f},
-std::array<float,2>{0.0193985999f, 0.242130861f},
-std::array<float,2>{0.562163055f, 0.904582977f},
-std::array<float,2>{0.572786033f, 0.269737571f},
-std::array<float,2>{0.123216733f, 0.588889003f},
-std::array<float,2>{0.281174183f, 0.0399800353f},
-std::array<float,2>{0.990397334f, 0.846624851f},
-std::array<float,2>{0.787845433f, 0.180260837f},
-std::array<float,2>{0.439604253f, 0.960030019f},
-std::array<float,2>{0.133037105f, 0.436697453f},
-std::array<float,2>{0.745885253f, 0.708403587f},
-std::array<float,2>{0.705724299f, 0.189032197f},
-std::array<float,2>{0.18222639f, 0.90662396f},
-std::array<float,2>{0.493009776f, 0.495601207f},
-std::array<float,2>{0.750657082f, 0.626060724f},
-std::array<float,2>{0.953415751f, 0.34073332f},
-std::array<float,2>{0.300942451f, 0.560204029f},
-std::array<float,2>{0.0920214504f, 0.0826942474f},
-std::array<float,2>{0.603754997f, 0.762378037f},
-std::array<float,2>{0.501536906f, 0.376614332f},
-std::array<float,2>{0.0441337973f, 0.72465831f},
-std::array<float,2>{0.341279835f, 0.15162456f},
-std::array<float,2>{0.89222753f, 0.97353363f},
-std::array<float,2>{0.87139827f, 0.0284757894f},
-std::array<float,2>{0.416245103f, 0.817676663f},
-std::array<float,2>{0.246279761f, 0.306161106f},
-std::array<float,2>{0.667876959f, 0.603129864f},
-std::array<float,2>{0.565403938f, 0.0976936147f},
-std::array<float,2>{0.109674007f, 0.786467016f},
-std::array<float,2>{0.268996596f, 0.366815537f},
-std::array<float,2>{0.995945871f, 0.524690092f},
-std::array<float,2>{0.791365862f, 0.450617641f},
-std::array<float,2>{0.44822222f, 0.680114567f},
-std::array<float,2>{0.132608384f, 0.218929291f},
-std::array<float,2>{0.741407931f, 0.875610948f},
-std::array<float,2>{0.640812218f, 0.263201922f},
-std::array<float,2>{0.214558512f, 0.570337057f},
-std::array<float,2>{0.405044585f, 0.0504959375f},
-std::array<float,2>{0.814917922f, 0.861523449f},
-std::array<float,2>{0.913661122f, 0.166345343f},
-std::array<float,2>{0.367676973f, 0.94017309f},
-std::array<float,2>{0.0296864286f, 0.408520281f},
-std::array<float,2>{0.550680995f, 0.701286435f},
-std::array<float,2>{0.531571984f, 0.125697017f},
-std::array<float,2>{0.0116372332f, 0.98445493f},
-std::array<float,2>{0.348901391f, 0.398137838f},
-std::array<float,2>{0.931353271f, 0.744328201f},
-std::array<float,2>{0.833775342f, 0.293875545f},
-std::array<float,2>{0.381989658f, 0.611135244f},
-std::array<float,2>{0.19341372f, 0.00471509062f},
-std::array<float,2>{0.6373173f, 0.841371655f},
-std::array<float,2>{0.728298187f, 0.483938485f},
-std::array<float,2>{0.146884888f, 0.650402009f},
-std::array<float,2>{0.460193753f, 0.215334833f},
-std::array<float,2>{0.811660826f, 0.934545517f},
-std::array<float,2>{0.97308296f, 0.0671013445f},
-std::array<float,2>{0.256196916f, 0.770078659f},
-std::array<float,2>{0.109032631f, 0.314525515f},
-std::array<float,2>{0.578755736f, 0.539232194f},
-std::array<float,2>{0.683470607f, 0.0458513424f},
-std::array<float,2>{0.228973046f, 0.849858522f},
-std::array<float,2>{0.427551299f, 0.266090661f},
-std::array<float,2>{0.855948985f, 0.590949953f},
-std::array<float,2>{0.875147104f, 0.433523834f},
-std::array<float,2>{0.324086308f, 0.704323828f},
-std::array<float,2>{0.0618952252f, 0.185529321f},
-std::array<float,2>{0.523086905f, 0.956107438f},
-std::array<float,2>{0.620527923f, 0.35586524f},
-std::array<float,2>{0.072686702f, 0.511223674f},
-std::array<float,2>{0.281816721f, 0.121096469f},
-std::array<float,2>{0.94269073f, 0.812131822f},
-std::array<float,2>{0.769339859f, 0.235751078f},
-std::array<float,2>{0.478224456f, 0.899693429f},
-std::array<float,2>{0.159219742f, 0.4624376f},
-std::array<float,2>{0.693885207f, 0.667070091f},
-std::array<float,2>{0.625940144f, 0.175777882f},
-std::array<float,2>{0.201568514f, 0.963993311f},
-std::array<float,2>{0.382833362f, 0.423500985f},
-std::array<float,2>{0.838374913f, 0.716377199f},
-std::array<float,2>{0.926874459f, 0.277041674f},
-std::array<float,2>{0.352692127f, 0.580212295f},
-std::array<float,2>{0.00107241643f, 0.0373057425f},
-std::array<float,2>{0.540991843f, 0.856653214f},
-std::array<float,2>{0.587900996f, 0.458467305f},
-std::array<float,2>{0.100089759f, 0.660788774f},
-std::array<float,2>{0.264888197f, 0.244847402f},
-std::array<float,2>{0.982686341f, 0.891475856f},
-std::array<float,2>{0.800110459f, 0.11621017f},
-std::array<float,2>{0.461432785f, 0.799042821f},
-std::array<float,2>{0.155685008f, 0.346384853f},
-std::array<float,2>{0.723972797f, 0.504795074f},
-std::array<float,2>{0.527879179f, 0.0146560725f},
-std::array<float,2>{0.0519450083f, 0.832055032f},
-std::array<float,2>{0.31250906f, 0.286005557f},
-std::array<float,2>{0.88430649f, 0.623064041f},
-std::array<float,2>{0.850385308f, 0.403483003f},
-std::array<float,2>{0.434848607f, 0.737707913f},
-std::array<float,2>{0.226241469f, 0.133808509f},
-std::array<float,2>{0.678520679f, 0.99336344f},
-std::array<float,2>{0.700495005f, 0.321220487f},
-std::array<float,2>{0.170592114f, 0.538665831f},
-std::array<float,2>{0.475291878f, 0.0710455775f},
-std::array<float,2>{0.780753613f, 0.778425157f},
-std::array<float,2>{0.950582266f, 0.204565346f},
-std::array<float,2>{0.291492224f, 0.924720228f},
-std::array<float,2>{0.0702134818f, 0.47558707f},
-std::array<float,2>{0.614805818f, 0.647655189f},
-std::array<float,2>{0.597628415f, 0.230424151f},
-std::array<float,2>{0.0827023238f, 0.886785746f},
-std::array<float,2>{0.30959487f, 0.443013936f},
-std::array<float,2>{0.961729228f, 0.672108233f},
-std::array<float,2>{0.762673318f, 0.367523462f},
-std::array<float,2>{0.487674773f, 0.518863559f},
-std::array<float,2>{0.176756576f, 0.10756664f},
-std::array<float,2>{0.715205193f, 0.791732073f},
-std::array<float,2>{0.662726879f, 0.418491393f},
-std::array<float,2>{0.238214165f, 0.688326538f},
-std::array<float,2>{0.406493515f, 0.16199404f},
-std::array<float,2>{0.860485613f, 0.949373186f},
-std::array<float,2>{0.900376081f, 0.0610038936f},
-std::array<float,2>{0.330756307f, 0.872074127f},
-std::array<float,2>{0.0389785282f, 0.254105419f},
-std::array<float,2>{0.511229217f, 0.570033729f},
-std::array<float,2>{0.748516738f, 0.089409858f},
-std::array<float,2>{0.137776792f, 0.757696807f},
-std::array<float,2>{0.443643361f, 0.33235693f},
-std::array<float,2>{0.781912267f, 0.547251523f},
-std::array<float,2>{0.98759979f, 0.488302559f},
-std::array<float,2>{0.27596575f, 0.637995899f},
-std::array<float,2>{0.118257917f, 0.199128404f},
-std::array<float,2>{0.575514376f, 0.914271533f},
-std::array<float,2>{0.556892276f, 0.299315453f},
-std::array<float,2>{0.0212832931f, 0.59515816f},
-std::array<float,2>{0.359606743f, 0.0180089604f},
-std::array<float,2>{0.91677773f, 0.822430253f},
-std::array<float,2>{0.820340693f, 0.14521803f},
-std::array<float,2>{0.393861055f, 0.983864129f},
-std::array<float,2>{0.205260053f, 0.387886167f},
-std::array<float,2>{0.650770962f, 0.732988775f},
-std::array<float,2>{0.653313875f, 0.241573721f},
-std::array<float,2>{0.210584626f, 0.904817581f},
-std::array<float,2>{0.396049917f, 0.465602636f},
-std::array<float,2>{0.828089118f, 0.670754313f},
-std::array<float,2>{0.920009851f, 0.353956252f},
-std::array<float,2>{0.364145368f, 0.513951063f},
-std::array<float,2>{0.0161451101f, 0.118062325f},
-std::array<float,2>{0.560395241f, 0.808088303f},
-std::array<float,2>{0.57091713f, 0.437408358f},
-std::array<float,2>{0.121693768f, 0.708721459f},
-std::array<float,2>{0.277993172f, 0.179765046f},
-std::array<float,2>{0.988363862f, 0.960730493f},
-std::array<float,2>{0.786794066f, 0.0393836498f},
-std::array<float,2>{0.439347416f, 0.845782459f},
-std::array<float,2>{0.135115713f, 0.270137131f},
-std::array<float,2>{0.7425372f, 0.58982265f},
-std::array<float,2>{0.514432788f, 0.0632345527f},
-std::array<float,2>{0.0318821631f, 0.769366741f},
-std::array<float,2>{0.335218906f, 0.317283362f},
-std::array<float,2>{0.906015038f, 0.545051277f},
-std::array<float,2>{0.86571604f, 0.478779256f},
-std::array<float,2>{0.410376132f, 0.655544102f},
-std::array<float,2>{0.239555687f, 0.213448063f},
-std::array<float,2>{0.660011351f, 0.931783497f},
-std::array<float,2>{0.713563085f, 0.29180488f},
-std::array<float,2>{0.172166571f, 0.615166366f},
-std::array<float,2>{0.490712494f, 0.00336353574f},
-std::array<float,2>{0.759342492f, 0.836290956f},
-std::array<float,2>{0.96502316f, 0.132133886f},
-std::array<float,2>{0.30595699f, 0.991479158f},
-std::array<float,2>{0.0809995979f, 0.392225504f},
-std::array<float,2>{0.601402402f, 0.749057293f},
-std::array<float,2>{0.612474442f, 0.169968918f},
-std::array<float,2>{0.0637554452f, 0.944662511f},
-std::array<float,2>{0.293361306f, 0.413706809f},
-std::array<float,2>{0.946773767f, 0.697912931f},
-std::array<float,2>{0.77477932f, 0.260030359f},
-std::array<float,2>{0.469277292f, 0.576713979f},
-std::array<float,2>{0.164164841f, 0.0517568476f},
-std::array<float,2>{0.695863128f, 0.865357995f},
-std::array<float,2>{0.67392838f, 0.445413202f},
-std::array<float,2>{0.218831837f, 0.687178969f},
-std::array<float,2>{0.433265775f, 0.223808751f},
-std::array<float,2>{0.845598161f, 0.879851699f},
-std::array<float,2>{0.888492882f, 0.096430108f},
-std::array<float,2>{0.317443252f, 0.782753646f},
-std::array<float,2>{0.0489449538f, 0.362260044f},
-std::array<float,2>{0.525550544f, 0.530080914f},
-std::array<float,2>{0.722339511f, 0.0265954584f},
-std::array<float,2>{0.150162429f, 0.815035224f},
-std::array<float,2>{0.466520339f, 0.312087685f},
-std::array<float,2>{0.802152812f, 0.608395457f},
-std::array<float,2>{0.977978408f, 0.379063547f},
-std::array<float,2>{0.259867162f, 0.721378386f},
-std::array<float,2>{0.0972972289f, 0.153382152f},
-std::array<float,2>{0.589965582f, 0.972103417f},
-std::array<float,2>{0.546544135f, 0.338995188f},
-std::array<float,2>{0.00638811616f, 0.557404399f},
-std::array<float,2>{0.355708778f, 0.0800239146f},
-std::array<float,2>{0.92416501f, 0.761196911f},
-std::array<float,2>{0.840444505f, 0.19445911f},
-std::array<float,2>{0.390309244f, 0.910294831f},
-std::array<float,2>{0.197793052f, 0.496407568f},
-std::array<float,2>{0.630302429f, 0.631976485f},
-std::array<float,2>{0.688434899f, 0.142193854f},
-std::array<float,2>{0.161676571f, 0.977355123f},
-std::array<float,2>{0.481916457f, 0.386533916f},
-std::array<float,2>{0.770871341f, 0.729542255f},
-std::array<float,2>{0.938228488f, 0.301642865f},
-std::array<float,2>{0.286977708f, 0.600956798f},
-std::array<float,2>{0.0752478167f, 0.0197007991f},
-std::array<float,2>{0.623189211f, 0.826059401f},
-std::array<float,2>{0.518511236f, 0.487342179f},
-std::array<float,2>{0.0573953167f, 0.633638322f},
-std::array<float,2>{0.327980518f, 0.200774848f},
-std::array<float,2>{0.881805122f, 0.919396758f},
-std::array<float,2>{0.854591727f, 0.0920373872f},
-std::array<float,2>{0.425350964f, 0.751664698f},
-std::array<float,2>{0.233468428f, 0.329076469f},
-std::array<float,2>{0.687227607f, 0.551464081f},
-std::array<float,2>{0.583371997f, 0.0572720617f},
-std::array<float,2>{0.103191569f, 0.870388508f},
-std::array<float,2>{0.252913147f, 0.253486723f},
-std::array<float,2>{0.969470203f, 0.564002752f},
-std::array<float,2>{0.806528211f, 0.417285442f},
-std::array<float,2>{0.456183881f, 0.692852914f},
-std::array<float,2>{0.140726194f, 0.157574162f},
-std::array<float,2>{0.731266797f, 0.948653877f},
-std::array<float,2>{0.633043945f, 0.372456163f},
-std::array<float,2>{0.190166712f, 0.520302415f},
-std::array<float,2>{0.376398504f, 0.102206707f},
-std::array<float,2>{0.831834257f, 0.793739855f},
-std::array<float,2>{0.936821282f, 0.233767375f},
-std::array<float,2>{0.345231831f, 0.885539174f},
-std::array<float,2>{0.0151126254f, 0.439688563f},
-std::array<float,2>{0.538614571f, 0.676240027f},
-std::array<float,2>{0.551733971f, 0.208614737f},
-std::array<float,2>{0.0240905061f, 0.926196337f},
-std::array<float,2>{0.373688847f, 0.47096166f},
-std::array<float,2>{0.907777846f, 0.643906534f},
-std::array<float,2>{0.819609046f, 0.326152027f},
-std::array<float,2>{0.402101755f, 0.532549322f},
-std::array<float,2>{0.217786267f, 0.0748466328f},
-std::array<float,2>{0.648223341f, 0.776726902f},
-std::array<float,2>{0.736738801f, 0.398622215f},
-std::array<float,2>{0.125749886f, 0.740208268f},
-std::array<float,2>{0.451483995f, 0.140431181f},
-std::array<float,2>{0.796238542f, 0.996672273f},
-std::array<float,2>{0.996829808f, 0.00803187396f},
-std::array<float,2>{0.273144275f, 0.831702888f},
-std::array<float,2>{0.113548972f, 0.281923175f},
-std::array<float,2>{0.570287108f, 0.619892955f},
-std::array<float,2>{0.670011163f, 0.111578122f},
-std::array<float,2>{0.243775561f, 0.804541349f},
-std::array<float,2>{0.42180109f, 0.351045132f},
-std::array<float,2>{0.870364547f, 0.503597021f},
-std::array<float,2>{0.895456314f, 0.455778986f},
-std::array<float,2>{0.337368131f, 0.659519374f},
-std::array<float,2>{0.0398147963f, 0.247941047f},
-std::array<float,2>{0.506709754f, 0.896765769f},
-std::array<float,2>{0.60928309f, 0.279111683f},
-std::array<float,2>{0.0885105431f, 0.583451986f},
-std::array<float,2>{0.298740983f, 0.0319371447f},
-std::array<float,2>{0.959391534f, 0.85328716f},
-std::array<float,2>{0.757281423f, 0.176553547f},
-std::array<float,2>{0.499045849f, 0.967933476f},
-std::array<float,2>{0.185812488f, 0.429192185f},
-std::array<float,2>{0.709550083f, 0.714609683f},
-std::array<float,2>{0.747636139f, 0.198485985f},
-std::array<float,2>{0.140480027f, 0.91461879f},
-std::array<float,2>{0.442700624f, 0.488826364f},
-std::array<float,2>{0.783545434f, 0.638563216f},
-std::array<float,2>{0.984588981f, 0.332926631f},
-std::array<float,2>{0.274738878f, 0.547369003f},
-std::array<float,2>{0.120033592f, 0.0892276168f},
-std::array<float,2>{0.577154517f, 0.757138371f},
-std::array<float,2>{0.555266082f, 0.388448417f},
-std::array<float,2>{0.0230512079f, 0.732539475f},
-std::array<float,2>{0.361400515f, 0.144860342f},
-std::array<float,2>{0.914698601f, 0.984367967f},
-std::array<float,2>{0.82361865f, 0.0184580591f},
-std::array<float,2>{0.391651094f, 0.823070168f},
-std::array<float,2>{0.204157382f, 0.299539536f},
-std::array<float,2>{0.650178671f, 0.595383465f},
-std::array<float,2>{0.594106615f, 0.108259238f},
-std::array<float,2>{0.0848771259f, 0.791150689f},
-std::array<float,2>{0.311630845f, 0.367879003f},
-std::array<float,2>{0.964067459f, 0.519212425f},
-std::array<float,2>{0.76521951f, 0.442716718f},
-std::array<float,2>{0.484771609f, 0.67252183f},
-std::array<float,2>{0.178414419f, 0.229512975f},
-std::array<float,2>{0.718545198f, 0.887453437f},
-std::array<float,2>{0.660724103f, 0.254498124f},
-std::array<float,2>{0.234798715f, 0.569822311f},
-std::array<float,2>{0.408340871f, 0.0610507466f},
-std::array<float,2>{0.861994863f, 0.873011351f},
-std::array<float,2>{0.902075827f, 0.161304861f},
-std::array<float,2>{0.328957796f, 0.949800432f},
-std::array<float,2>{0.0367107764f, 0.418059111f},
-std::array<float,2>{0.507836759f, 0.687527418f},
-std::array<float,2>{0.530851483f, 0.134346202f},
-std::array<float,2>{0.0535842143f, 0.993774712f},
-std::array<float,2>{0.31632328f, 0.403890342f},
-std::array<float,2>{0.885269701f, 0.737910986f},
-std::array<float,2>{0.848504722f, 0.285430402f},
-std::array<float,2>{0.436579764f, 0.623970151f},
-std::array<float,2>{0.223026529f, 0.0151709234f},
-std::array<float,2>{0.676847816f, 0.83294487f},
-std::array<float,2>{0.70307833f, 0.476540864f},
-std::array<float,2>{0.168545842f, 0.648103058f},
-std::array<float,2>{0.473005265f, 0.205019996f},
-std::array<float,2>{0.778572977f, 0.923887014f},
-std::array<float,2>{0.951584637f, 0.0704154447f},
-std::array<float,2>{0.290255934f, 0.778978944f},
-std::array<float,2>{0.0665025041f, 0.320507079f},
-std::array<float,2>{0.61621052f, 0.538095951f},
-std::array<float,2>{0.628660798f, 0.0378127396f},
-std::array<float,2>{0.20113261f, 0.857344151f},
-std::array<float,2>{0.385059357f, 0.276729822f},
-std::array<float,2>{0.837112367f, 0.580925465f},
-std::array<float,2>{0.928821445f, 0.42303592f},
-std::array<float,2>{0.353837639f, 0.715853095f},
-std::array<float,2>{0.00346246734f, 0.174813077f},
-std::array<float,2>{0.542303681f, 0.96481514f},
-std::array<float,2>{0.586818874f, 0.345925331f},
-std::array<float,2>{0.0993722156f, 0.504047275f},
-std::array<float,2>{0.262913436f, 0.115396373f},
-std::array<float,2>{0.982232213f, 0.799401879f},
-std::array<float,2>{0.798723698f, 0.244306326f},
-std::array<float,2>{0.463983059f, 0.891023338f},
-std::array<float,2>{0.152655527f, 0.45852077f},
-std::array<float,2>{0.725930214f, 0.660157621f},
-std::array<float,2>{0.680934787f, 0.184624895f},
-std::array<float,2>{0.226758197f, 0.956797183f},
-std::array<float,2>{0.427991509f, 0.432832927f},
-std::array<float,2>{0.859000385f, 0.704630196f},
-std::array<float,2>{0.876977921f, 0.266143858f},
-std::array<float,2>{0.321962178f, 0.591471612f},
-std::array<float,2>{0.0590834208f, 0.0450718254f},
-std::array<float,2>{0.521240711f, 0.85047543f},
-std::array<float,2>{0.618798971f, 0.462002188f},
-std::array<float,2>{0.0704713762f, 0.667856038f},
-std::array<float,2>{0.284334749f, 0.235843703f},
-std::array<float,2>{0.943416893f, 0.900085986f},
-std::array<float,2>{0.766934991f, 0.12206652f},
-std::array<float,2>{0.479715914f, 0.811577857f},
-std::array<float,2>{0.157196835f, 0.356421679f},
-std::array<float,2>{0.692136407f, 0.511717021f},
-std::array<float,2>{0.533600867f, 0.00406865776f},
-std::array<float,2>{0.0078698853f, 0.8410151f},
-std::array<float,2>{0.350544304f, 0.293019861f},
-std::array<float,2>{0.93288058f, 0.610614359f},
-std::array<float,2>{0.835512102f, 0.397572666f},
-std::array<float,2>{0.380401641f, 0.744732499f},
-std::array<float,2>{0.192959219f, 0.125443816f},
-std::array<float,2>{0.639651597f, 0.984927297f},
-std::array<float,2>{0.730245411f, 0.314963669f},
-std::array<float,2>{0.145665184f, 0.540003896f},
-std::array<float,2>{0.457033664f, 0.0667909309f},
-std::array<float,2>{0.809421182f, 0.769842923f},
-std::array<float,2>{0.97619462f, 0.215180635f},
-std::array<float,2>{0.255800694f, 0.933902562f},
-std::array<float,2>{0.106087372f, 0.483687907f},
-std::array<float,2>{0.580583096f, 0.65125829f},
-std::array<float,2>{0.564206362f, 0.219504759f},
-std::array<float,2>{0.11137674f, 0.875295877f},
-std::array<float,2>{0.267481446f, 0.4507927f},
-std::array<float,2>{0.992776573f, 0.680459976f},
-std::array<float,2>{0.790059686f, 0.366262943f},
-std::array<float,2>{0.446798921f, 0.525054634f},
-std::array<float,2>{0.129797727f, 0.0985595435f},
-std::array<float,2>{0.738458931f, 0.78693229f},
-std::array<float,2>{0.644337177f, 0.408705682f},
-std::array<float,2>{0.210968658f, 0.701916039f},
-std::array<float,2>{0.403846532f, 0.16687955f},
-std::array<float,2>{0.813353121f, 0.939590454f},
-std::array<float,2>{0.911346078f, 0.0498546213f},
-std::array<float,2>{0.36927405f, 0.861816704f},
-std::array<float,2>{0.0288623571f, 0.263140231f},
-std::array<float,2>{0.547993839f, 0.571058095f},
-std::array<float,2>{0.704921424f, 0.082061097f},
-std::array<float,2>{0.180446446f, 0.762172282f},
-std::array<float,2>{0.495270461f, 0.340265989f},
-std::array<float,2>{0.752352417f, 0.559793472f},
-std::array<float,2>{0.955159783f, 0.49608466f},
-std::array<float,2>{0.302739233f, 0.626672804f},
-std::array<float,2>{0.091148749f, 0.188930392f},
-std::array<float,2>{0.603467464f, 0.907060266f},
-std::array<float,2>{0.502206385f, 0.306097627f},
-std::array<float,2>{0.0461277887f, 0.602550507f},
-std::array<float,2>{0.342972219f, 0.0289084949f},
-std::array<float,2>{0.892803609f, 0.817957699f},
-std::array<float,2>{0.874044895f, 0.151891798f},
-std::array<float,2>{0.41471675f, 0.972950459f},
-std::array<float,2>{0.248580277f, 0.376105279f},
-std::array<float,2>{0.665270686f, 0.725272775f},
-std::array<float,2>{0.656924844f, 0.21107018f},
-std::array<float,2>{0.241368592f, 0.93132776f},
-std::array<float,2>{0.412526876f, 0.478415966f},
-std::array<float,2>{0.863305151f, 0.653290153f},
-std::array<float,2>{0.903951406f, 0.318917513f},
-std::array<float,2>{0.332610786f, 0.544261575f},
-std::array<float,2>{0.0333663188f, 0.065391168f},
-std::array<float,2>{0.513130784f, 0.766176164f},
-std::array<float,2>{0.599336326f, 0.393918931f},
-std::array<float,2>{0.0783452988f, 0.746216178f},
-std::array<float,2>{0.30796963f, 0.130855247f},
-std::array<float,2>{0.967772484f, 0.988646328f},
-std::array<float,2>{0.76148814f, 0.001047572f},
-std::array<float,2>{0.489094496f, 0.838055968f},
-std::array<float,2>{0.174318045f, 0.289413631f},
-std::array<float,2>{0.71124506f, 0.616225481f},
-std::array<float,2>{0.561779201f, 0.120433576f},
-std::array<float,2>{0.0188264363f, 0.80493319f},
-std::array<float,2>{0.367167532f, 0.35259077f},
-std::array<float,2>{0.919782639f, 0.512957811f},
-std::array<float,2>{0.824768066f, 0.468102753f},
-std::array<float,2>{0.397024691f, 0.668908238f},
-std::array<float,2>{0.207295462f, 0.238584325f},
-std::array<float,2>{0.6548599f, 0.902690709f},
-std::array<float,2>{0.745547056f, 0.271600544f},
-std::array<float,2>{0.133373424f, 0.586962938f},
-std::array<float,2>{0.440063566f, 0.0426055938f},
-std::array<float,2>{0.787553847f, 0.844376087f},
-std::array<float,2>{0.990869701f, 0.183365211f},
-std::array<float,2>{0.28036657f, 0.958013177f},
-std::array<float,2>{0.123946831f, 0.434540212f},
-std::array<float,2>{0.57247889f, 0.710269511f},
-std::array<float,2>{0.59287113f, 0.156054363f},
-std::array<float,2>{0.0944556147f, 0.970500588f},
-std::array<float,2>{0.25939402f, 0.382306874f},
-std::array<float,2>{0.980397582f, 0.719201684f},
-std::array<float,2>{0.804502428f, 0.308973759f},
-std::array<float,2>{0.467215508f, 0.606070876f},
-std::array<float,2>{0.151613519f, 0.0248596761f},
-std::array<float,2>{0.719621181f, 0.8132056f},
-std::array<float,2>{0.631833315f, 0.499343008f},
-std::array<float,2>{0.19612141f, 0.630595148f},
-std::array<float,2>{0.387217283f, 0.191593796f},
-std::array<float,2>{0.843221486f, 0.913945496f},
-std::array<float,2>{0.923538148f, 0.080864571f},
-std::array<float,2>{0.357521474f, 0.758869112f},
-std::array<float,2>{0.00533518661f, 0.336737424f},
-std::array<float,2>{0.543918133f, 0.555559456f},
-std::array<float,2>{0.697448373f, 0.05322944f},
-std::array<float,2>{0.1670793f, 0.863419414f},
-std::array<float,2>{0.472156286f, 0.258214533f},
-std::array<float,2>{0.777152002f, 0.574314654f},
-std::array<float,2>{0.947898388f, 0.410410017f},
-std::array<float,2>{0.295384169f, 0.695637226f},
-std::array<float,2>{0.0660681576f, 0.168905944f},
-std::array<float,2>{0.610838175f, 0.942457974f},
-std::array<float,2>{0.524371088f, 0.360866964f},
-std::array<float,2>{0.0474146008f, 0.527681351f},
-std::array<float,2>{0.319042653f, 0.0955385491f},
-std::array<float,2>{0.890289962f, 0.784362435f},
-std::array<float,2>{0.8471995f, 0.225651205f},
-std::array<float,2>{0.430258811f, 0.881923676f},
-std::array<float,2>{0.222516388f, 0.448647946f},
-std::array<float,2>{0.672439814f, 0.683930039f},
-std::array<float,2>{0.733708739f, 0.158897236f},
-std::array<float,2>{0.142718166f, 0.946092427f},
-std::array<float,2>{0.453926861f, 0.415482312f},
-std::array<float,2>{0.807128966f, 0.693782032f},
-std::array<float,2>{0.971493363f, 0.251712382f},
-std::array<float,2>{0.250163317f, 0.564532936f},
-std::array<float,2>{0.103553437f, 0.0547147691f},
-std::array<float,2>{0.584183931f, 0.86805588f},
-std::array<float,2>{0.537071407f, 0.438560486f},
-std::array<float,2>{0.0120351966f, 0.679092824f},
-std::array<float,2>{0.346309602f, 0.231385514f},
-std::array<float,2>{0.933833003f, 0.883640707f},
-std::array<float,2>{0.828583062f, 0.104301594f},
-std::array<float,2>{0.378169507f, 0.795144379f},
-std::array<float,2>{0.189014077f, 0.373388678f},
-std::array<float,2>{0.636625707f, 0.522389948f},
-std::array<float,2>{0.621422946f, 0.0221769307f},
-std::array<float,2>{0.0767657608f, 0.826242685f},
-std::array<float,2>{0.288187832f, 0.303723186f},
-std::array<float,2>{0.940323174f, 0.597917974f},
-std::array<float,2>{0.772718966f, 0.383063138f},
-std::array<float,2>{0.483503073f, 0.727683246f},
-std::array<float,2>{0.162875295f, 0.1429113f},
-std::array<float,2>{0.691045582f, 0.979507327f},
-std::array<float,2>{0.684808135f, 0.330924064f},
-std::array<float,2>{0.230858743f, 0.552910745f},
-std::array<float,2>{0.422790885f, 0.0904590636f},
-std::array<float,2>{0.852556169f, 0.753144562f},
-std::array<float,2>{0.880490839f, 0.201780215f},
-std::array<float,2>{0.324796766f, 0.921584249f},
-std::array<float,2>{0.0548800901f, 0.485887498f},
-std::array<float,2>{0.516928017f, 0.636513233f},
-std::array<float,2>{0.505643427f, 0.249387264f},
-std::array<float,2>{0.0411646925f, 0.895931125f},
-std::array<float,2>{0.338747412f, 0.454320014f},
-std::array<float,2>{0.897020221f, 0.657269716f},
-std::array<float,2>{0.868465245f, 0.348846436f},
-std::array<float,2>{0.418583125f, 0.501556635f},
-std::array<float,2>{0.245225221f, 0.110418126f},
-std::array<float,2>{0.668590724f, 0.801576078f},
-std::array<float,2>{0.707734048f, 0.426181465f},
-std::array<float,2>{0.183913857f, 0.712569058f},
-std::array<float,2>{0.497839987f, 0.178147659f},
-std::array<float,2>{0.75471741f, 0.965131462f},
-std::array<float,2>{0.958383739f, 0.0336161591f},
-std::array<float,2>{0.300197542f, 0.853882968f},
-std::array<float,2>{0.0878605321f, 0.280232579f},
-std::array<float,2>{0.606812537f, 0.584915757f},
-std::array<float,2>{0.645642519f, 0.0766584724f},
-std::array<float,2>{0.216142356f, 0.774266779f},
-std::array<float,2>{0.399851531f, 0.327696025f},
-std::array<float,2>{0.816999972f, 0.533918917f},
-std::array<float,2>{0.910076976f, 0.469284713f},
-std::array<float,2>{0.3718822f, 0.642461061f},
-std::array<float,2>{0.0265333783f, 0.209684938f},
-std::array<float,2>{0.553852975f, 0.92961818f},
-std::array<float,2>{0.566869974f, 0.283858657f},
-std::array<float,2>{0.115303583f, 0.618982315f},
-std::array<float,2>{0.27115953f, 0.0111131612f},
-std::array<float,2>{0.998550415f, 0.829104006f},
-std::array<float,2>{0.793767452f, 0.136790425f},
-std::array<float,2>{0.450886726f, 0.999013484f},
-std::array<float,2>{0.128326595f, 0.402250379f},
-std::array<float,2>{0.734698355f, 0.741184652f},
-std::array<float,2>{0.715701401f, 0.227082536f},
-std::array<float,2>{0.176154405f, 0.889809906f},
-std::array<float,2>{0.487912416f, 0.444375396f},
-std::array<float,2>{0.761878312f, 0.674258292f},
-std::array<float,2>{0.961190879f, 0.370353937f},
-std::array<float,2>{0.310132325f, 0.516803801f},
-std::array<float,2>{0.0821202099f, 0.106805921f},
-std::array<float,2>{0.596859932f, 0.789419472f},
-std::array<float,2>{0.511512339f, 0.420766741f},
-std::array<float,2>{0.0381148607f, 0.690138221f},
-std::array<float,2>{0.330081731f, 0.163876712f},
-std::array<float,2>{0.899639368f, 0.951330602f},
-std::array<float,2>{0.861059606f, 0.0604549311f},
-std::array<float,2>{0.407059431f, 0.874731541f},
-std::array<float,2>{0.237735778f, 0.257604212f},
-std::array<float,2>{0.662475049f, 0.567683756f},
-std::array<float,2>{0.57605648f, 0.0872887298f},
-std::array<float,2>{0.118847668f, 0.754575372f},
-std::array<float,2>{0.275448322f, 0.335475504f},
-std::array<float,2>{0.988118947f, 0.549952865f},
-std::array<float,2>{0.781423271f, 0.491709381f},
-std::array<float,2>{0.444132924f, 0.639118552f},
-std::array<float,2>{0.138404474f, 0.196380183f},
-std::array<float,2>{0.749017894f, 0.917220891f},
-std::array<float,2>{0.65121907f, 0.297438055f},
-std::array<float,2>{0.205653578f, 0.597017825f},
-std::array<float,2>{0.394463927f, 0.0158857647f},
-std::array<float,2>{0.821230412f, 0.820476413f},
-std::array<float,2>{0.916046143f, 0.147599652f},
-std::array<float,2>{0.359890878f, 0.981975377f},
-std::array<float,2>{0.0207267664f, 0.389771581f},
-std::array<float,2>{0.557564735f, 0.73127836f},
-std::array<float,2>{0.540254712f, 0.172361284f},
-std::array<float,2>{0.00177912926f, 0.961388528f},
-std::array<float,2>{0.35350579f, 0.424264252f},
-std::array<float,2>{0.92771703f, 0.716934264f},
-std::array<float,2>{0.838566303f, 0.274396628f},
-std::array<float,2>{0.383565336f, 0.579545617f},
-std::array<float,2>{0.201926336f, 0.0356969051f},
-std::array<float,2>{0.625074685f, 0.859287083f},
-std::array<float,2>{0.724546671f, 0.459928721f},
-std::array<float,2>{0.155856058f, 0.663509667f},
-std::array<float,2>{0.461351782f, 0.24389483f},
-std::array<float,2>{0.800550342f, 0.892867208f},
-std::array<float,2>{0.983391762f, 0.114492379f},
-std::array<float,2>{0.265455753f, 0.797006428f},
-std::array<float,2>{0.100143254f, 0.345035821f},
-std::array<float,2>{0.588409483f, 0.507778883f},
-std::array<float,2>{0.678182065f, 0.0120005151f},
-std::array<float,2>{0.225836694f, 0.834572136f},
-std::array<float,2>{0.435069263f, 0.287293702f},
-std::array<float,2>{0.849674225f, 0.622654974f},
-std::array<float,2>{0.883844316f, 0.404376864f},
-std::array<float,2>{0.313233435f, 0.735614955f},
-std::array<float,2>{0.0524765104f, 0.136224851f},
-std::array<float,2>{0.527660668f, 0.995583117f},
-std::array<float,2>{0.614494205f, 0.323709249f},
-std::array<float,2>{0.0694353357f, 0.536165893f},
-std::array<float,2>{0.291915238f, 0.0737429634f},
-std::array<float,2>{0.950747371f, 0.779482782f},
-std::array<float,2>{0.78122139f, 0.206403941f},
-std::array<float,2>{0.474878728f, 0.923507333f},
-std::array<float,2>{0.170292199f, 0.474248827f},
-std::array<float,2>{0.700702906f, 0.646027923f},
-std::array<float,2>{0.636771977f, 0.128182024f},
-std::array<float,2>{0.193985298f, 0.987629533f},
-std::array<float,2>{0.382365823f, 0.394862413f},
-std::array<float,2>{0.833333015f, 0.742502928f},
-std::array<float,2>{0.931071043f, 0.296466947f},
-std::array<float,2>{0.349523842f, 0.61142689f},
-std::array<float,2>{0.0107911117f, 0.00763931451f},
-std::array<float,2>{0.532126307f, 0.841864407f},
-std::array<float,2>{0.578308523f, 0.481790841f},
-std::array<float,2>{0.108848751f, 0.64843899f},
-std::array<float,2>{0.256612837f, 0.217050076f},
-std::array<float,2>{0.973355234f, 0.936747551f},
-std::array<float,2>{0.812310815f, 0.0692197159f},
-std::array<float,2>{0.460876971f, 0.773200691f},
-std::array<float,2>{0.147109583f, 0.313346207f},
-std::array<float,2>{0.727870762f, 0.541964829f},
-std::array<float,2>{0.522830188f, 0.043485269f},
-std::array<float,2>{0.0623734668f, 0.848477125f},
-std::array<float,2>{0.323426455f, 0.268591225f},
-std::array<float,2>{0.87585777f, 0.593275189f},
-std::array<float,2>{0.856109679f, 0.430972576f},
-std::array<float,2>{0.427232057f, 0.705331802f},
-std::array<float,2>{0.229213864f, 0.185592636f},
-std::array<float,2>{0.683083832f, 0.953859627f},
-std::array<float,2>{0.693485677f, 0.359355122f},
-std::array<float,2>{0.159839436f, 0.50917685f},
-std::array<float,2>{0.477840692f, 0.123715021f},
-std::array<float,2>{0.768776715f, 0.80951035f},
-std::array<float,2>{0.943322062f, 0.237203464f},
-std::array<float,2>{0.281490505f, 0.901181817f},
-std::array<float,2>{0.0731407329f, 0.46395877f},
-std::array<float,2>{0.621086478f, 0.665430188f},
-std::array<float,2>{0.604012728f, 0.189789981f},
-std::array<float,2>{0.0927092656f, 0.908229411f},
-std::array<float,2>{0.301594377f, 0.493317127f},
-std::array<float,2>{0.953659415f, 0.627255082f},
-std::array<float,2>{0.750452459f, 0.343742043f},
-std::array<float,2>{0.492445618f, 0.561105847f},
-std::array<float,2>{0.18177703f, 0.0855460316f},
-std::array<float,2>{0.705497384f, 0.764063954f},
-std::array<float,2>{0.667210937f, 0.37742877f},
-std::array<float,2>{0.246891782f, 0.724288344f},
-std::array<float,2>{0.416532934f, 0.149093792f},
-std::array<float,2>{0.871854246f, 0.975705266f},
-std::array<float,2>{0.892083466f, 0.0293380786f},
-std::array<float,2>{0.34175998f, 0.820198476f},
-std::array<float,2>{0.0446722247f, 0.30746305f},
-std::array<float,2>{0.50137943f, 0.604281604f},
-std::array<float,2>{0.7420398f, 0.100400083f},
-std::array<float,2>{0.132165983f, 0.788583517f},
-std::array<float,2>{0.447518766f, 0.363716185f},
-std::array<float,2>{0.79158026f, 0.526321769f},
-std::array<float,2>{0.995494783f, 0.45295617f},
-std::array<float,2>{0.269410491f, 0.683520734f},
-std::array<float,2>{0.110036522f, 0.222432733f},
-std::array<float,2>{0.564483523f, 0.878596365f},
-std::array<float,2>{0.549898386f, 0.264891952f},
-std::array<float,2>{0.0298884381f, 0.57296294f},
-std::array<float,2>{0.367212236f, 0.0475678481f},
-std::array<float,2>{0.913536847f, 0.861276567f},
-std::array<float,2>{0.815253317f, 0.165735587f},
-std::array<float,2>{0.404332876f, 0.938989997f},
-std::array<float,2>{0.213964105f, 0.406950057f},
-std::array<float,2>{0.64136678f, 0.699890494f},
-std::array<float,2>{0.629182398f, 0.193313017f},
-std::array<float,2>{0.19827114f, 0.912597716f},
-std::array<float,2>{0.388919711f, 0.498360872f},
-std::array<float,2>{0.841543496f, 0.628996551f},
-std::array<float,2>{0.925537586f, 0.337246567f},
-std::array<float,2>{0.356971085f, 0.556181669f},
-std::array<float,2>{0.00768147083f, 0.0811622664f},
-std::array<float,2>{0.545098543f, 0.75857228f},
-std::array<float,2>{0.591587603f, 0.381359875f},
-std::array<float,2>{0.0957922488f, 0.720436215f},
-std::array<float,2>{0.261307716f, 0.154758319f},
-std::array<float,2>{0.977484941f, 0.969295025f},
-std::array<float,2>{0.80134052f, 0.0235082787f},
-std::array<float,2>{0.465353191f, 0.813540697f},
-std::array<float,2>{0.148886412f, 0.310277283f},
-std::array<float,2>{0.721222878f, 0.606649399f},
-std::array<float,2>{0.526610136f, 0.0944324061f},
-std::array<float,2>{0.0506000891f, 0.783780396f},
-std::array<float,2>{0.316567808f, 0.359420896f},
-std::array<float,2>{0.887229979f, 0.52839613f},
-std::array<float,2>{0.843946099f, 0.448112398f},
-std::array<float,2>{0.432146609f, 0.68503195f},
-std::array<float,2>{0.220678806f, 0.225511625f},
-std::array<float,2>{0.67514205f, 0.881355464f},
-std::array<float,2>{0.697017908f, 0.259116948f},
-std::array<float,2>{0.165341944f, 0.575215697f},
-std::array<float,2>{0.47060138f, 0.0540097356f},
-std::array<float,2>{0.773759782f, 0.865038574f},
-std::array<float,2>{0.945628166f, 0.169018954f},
-std::array<float,2>{0.294846416f, 0.942179084f},
-std::array<float,2>{0.0628769174f, 0.411325753f},
-std::array<float,2>{0.611995697f, 0.696905553f},
-std::array<float,2>{0.600050807f, 0.129391819f},
-std::array<float,2>{0.0812449679f, 0.990226328f},
-std::array<float,2>{0.304884046f, 0.392583251f},
-std::array<float,2>{0.966738403f, 0.74774003f},
-std::array<float,2>{0.757984102f, 0.290585399f},
-std::array<float,2>{0.491380781f, 0.615389585f},
-std::array<float,2>{0.173616961f, 2.10971393e-05f},
-std::array<float,2>{0.714108765f, 0.839207828f},
-std::array<float,2>{0.658777952f, 0.477208853f},
-std::array<float,2>{0.239252806f, 0.653526545f},
-std::array<float,2>{0.41171059f, 0.212595612f},
-std::array<float,2>{0.866776288f, 0.929751337f},
-std::array<float,2>{0.904892266f, 0.0657069534f},
-std::array<float,2>{0.334410965f, 0.767294466f},
-std::array<float,2>{0.0325460918f, 0.31978482f},
-std::array<float,2>{0.515215278f, 0.543818891f},
-std::array<float,2>{0.743184805f, 0.0413217805f},
-std::array<float,2>{0.13614656f, 0.845217884f},
-std::array<float,2>{0.437852174f, 0.272715986f},
-std::array<float,2>{0.785551608f, 0.586855114f},
-std::array<float,2>{0.989715517f, 0.435157269f},
-std::array<float,2>{0.278610319f, 0.70945549f},
-std::array<float,2>{0.122241773f, 0.182223991f},
-std::array<float,2>{0.571598411f, 0.957096338f},
-std::array<float,2>{0.559518695f, 0.351887375f},
-std::array<float,2>{0.0172465872f, 0.511924386f},
-std::array<float,2>{0.364974737f, 0.119196542f},
-std::array<float,2>{0.921554863f, 0.805702209f},
-std::array<float,2>{0.82690084f, 0.239351451f},
-std::array<float,2>{0.39453721f, 0.904203653f},
-std::array<float,2>{0.209026605f, 0.466812372f},
-std::array<float,2>{0.653941333f, 0.66978085f},
-std::array<float,2>{0.710621178f, 0.178913459f},
-std::array<float,2>{0.187109917f, 0.96588701f},
-std::array<float,2>{0.498977721f, 0.427472711f},
-std::array<float,2>{0.756219089f, 0.711572051f},
-std::array<float,2>{0.960676014f, 0.281181425f},
-std::array<float,2>{0.297337532f, 0.585925519f},
-std::array<float,2>{0.0890259668f, 0.0346706472f},
-std::array<float,2>{0.607526124f, 0.855304956f},
-std::array<float,2>{0.507785857f, 0.453457803f},
-std::array<float,2>{0.0409066007f, 0.656935096f},
-std::array<float,2>{0.336440325f, 0.248610675f},
-std::array<float,2>{0.895772815f, 0.894932091f},
-std::array<float,2>{0.869533479f, 0.109611273f},
-std::array<float,2>{0.420429945f, 0.802536368f},
-std::array<float,2>{0.242693201f, 0.347813517f},
-std::array<float,2>{0.671448052f, 0.500316679f},
-std::array<float,2>{0.569309473f, 0.00979576726f},
-std::array<float,2>{0.114746653f, 0.828271687f},
-std::array<float,2>{0.272112876f, 0.284642756f},
-std::array<float,2>{0.997273445f, 0.617700934f},
-std::array<float,2>{0.794964612f, 0.401314586f},
-std::array<float,2>{0.452429682f, 0.741527915f},
-std::array<float,2>{0.126858264f, 0.138633996f},
-std::array<float,2>{0.737700939f, 0.999055505f},
-std::array<float,2>{0.647162974f, 0.326374531f},
-std::array<float,2>{0.217334911f, 0.534996212f},
-std::array<float,2>{0.400932163f, 0.077879563f},
-std::array<float,2>{0.818387926f, 0.774472594f},
-std::array<float,2>{0.906549037f, 0.21026887f},
-std::array<float,2>{0.374127984f, 0.928037107f},
-std::array<float,2>{0.0248422138f, 0.470636249f},
-std::array<float,2>{0.551918149f, 0.641454518f},
-std::array<float,2>{0.537625849f, 0.23241058f},
-std::array<float,2>{0.0146011291f, 0.884215236f},
-std::array<float,2>{0.344355315f, 0.438469917f},
-std::array<float,2>{0.936318874f, 0.677866995f},
-std::array<float,2>{0.830973625f, 0.374521762f},
-std::array<float,2>{0.375450075f, 0.522556186f},
-std::array<float,2>{0.190853894f, 0.105126686f},
-std::array<float,2>{0.633938909f, 0.796175599f},
-std::array<float,2>{0.732088029f, 0.414582938f},
-std::array<float,2>{0.141966358f, 0.694634378f},
-std::array<float,2>{0.455685854f, 0.15988344f},
-std::array<float,2>{0.80555898f, 0.946792483f},
-std::array<float,2>{0.970196009f, 0.0561576411f},
-std::array<float,2>{0.252992868f, 0.868189633f},
-std::array<float,2>{0.10248293f, 0.250562727f},
-std::array<float,2>{0.582440436f, 0.565595448f},
-std::array<float,2>{0.685576022f, 0.0908589661f},
-std::array<float,2>{0.233243585f, 0.752912104f},
-std::array<float,2>{0.424039662f, 0.331940204f},
-std::array<float,2>{0.854284525f, 0.554350972f},
-std::array<float,2>{0.881947458f, 0.484714657f},
-std::array<float,2>{0.32638979f, 0.635106385f},
-std::array<float,2>{0.0584281161f, 0.202889413f},
-std::array<float,2>{0.519468188f, 0.920037091f},
-std::array<float,2>{0.624465108f, 0.302982479f},
-std::array<float,2>{0.0747350454f, 0.599058807f},
-std::array<float,2>{0.285855591f, 0.0228987634f},
-std::array<float,2>{0.939103901f, 0.827321768f},
-std::array<float,2>{0.770186722f, 0.144168377f},
-std::array<float,2>{0.481131852f, 0.978630662f},
-std::array<float,2>{0.16049999f, 0.384733528f},
-std::array<float,2>{0.689179718f, 0.726994812f},
-std::array<float,2>{0.724953711f, 0.242834449f},
-std::array<float,2>{0.153978556f, 0.894309461f},
-std::array<float,2>{0.463411301f, 0.460008889f},
-std::array<float,2>{0.797688603f, 0.662652552f},
-std::array<float,2>{0.981065333f, 0.344121426f},
-std::array<float,2>{0.262207985f, 0.506162643f},
-std::array<float,2>{0.098104775f, 0.114210971f},
-std::array<float,2>{0.587056994f, 0.798761547f},
-std::array<float,2>{0.541608214f, 0.425397485f},
-std::array<float,2>{0.0026291816f, 0.718377769f},
-std::array<float,2>{0.355116069f, 0.173617631f},
-std::array<float,2>{0.928089678f, 0.962155342f},
-std::array<float,2>{0.836563706f, 0.0370779261f},
-std::array<float,2>{0.38615036f, 0.858153045f},
-std::array<float,2>{0.199799463f, 0.274642348f},
-std::array<float,2>{0.627853215f, 0.578864276f},
-std::array<float,2>{0.616806269f, 0.0729998425f},
-std::array<float,2>{0.0679649264f, 0.78063637f},
-std::array<float,2>{0.290003538f, 0.323143512f},
-std::array<float,2>{0.952808082f, 0.535862803f},
-std::array<float,2>{0.777990818f, 0.473510772f},
-std::array<float,2>{0.474101335f, 0.64459306f},
-std::array<float,2>{0.169316217f, 0.205525517f},
-std::array<float,2>{0.702112198f, 0.9221223f},
-std::array<float,2>{0.676743388f, 0.28838706f},
-std::array<float,2>{0.223976299f, 0.621720374f},
-std::array<float,2>{0.436146438f, 0.0133038657f},
-std::array<float,2>{0.849129498f, 0.83582443f},
-std::array<float,2>{0.886706114f, 0.135701805f},
-std::array<float,2>{0.314908653f, 0.995052934f},
-std::array<float,2>{0.0543763898f, 0.406100154f},
-std::array<float,2>{0.529921472f, 0.735248148f},
-std::array<float,2>{0.509740174f, 0.162734225f},
-std::array<float,2>{0.0354151428f, 0.952899098f},
-std::array<float,2>{0.329193145f, 0.42122373f},
-std::array<float,2>{0.901179492f, 0.69122833f},
-std::array<float,2>{0.862765372f, 0.256538332f},
-std::array<float,2>{0.409615815f, 0.566612482f},
-std::array<float,2>{0.235627323f, 0.0592775792f},
-std::array<float,2>{0.661647439f, 0.87401557f},
-std::array<float,2>{0.717638135f, 0.443963557f},
-std::array<float,2>{0.179354563f, 0.675165951f},
-std::array<float,2>{0.48558566f, 0.227610067f},
-std::array<float,2>{0.764175892f, 0.889292777f},
-std::array<float,2>{0.963323712f, 0.105559774f},
-std::array<float,2>{0.310925156f, 0.790139139f},
-std::array<float,2>{0.0854244083f, 0.36971125f},
-std::array<float,2>{0.595446587f, 0.516147137f},
-std::array<float,2>{0.64902401f, 0.0173540916f},
-std::array<float,2>{0.203285292f, 0.822249532f},
-std::array<float,2>{0.391430169f, 0.298505932f},
-std::array<float,2>{0.822753966f, 0.595910728f},
-std::array<float,2>{0.915325582f, 0.388972014f},
-std::array<float,2>{0.363040447f, 0.732018769f},
-std::array<float,2>{0.0222382676f, 0.147160575f},
-std::array<float,2>{0.556070328f, 0.980722189f},
-std::array<float,2>{0.576495528f, 0.334425926f},
-std::array<float,2>{0.120462678f, 0.549766958f},
-std::array<float,2>{0.273521304f, 0.0864164084f},
-std::array<float,2>{0.985955f, 0.755566955f},
-std::array<float,2>{0.785153508f, 0.195876583f},
-std::array<float,2>{0.44204098f, 0.916969776f},
-std::array<float,2>{0.139181212f, 0.491170973f},
-std::array<float,2>{0.746537745f, 0.639945447f},
-std::array<float,2>{0.664386451f, 0.150022626f},
-std::array<float,2>{0.249845967f, 0.975523472f},
-std::array<float,2>{0.41594699f, 0.378590494f},
-std::array<float,2>{0.873783529f, 0.722844124f},
-std::array<float,2>{0.894240141f, 0.30796501f},
-std::array<float,2>{0.34213528f, 0.604967237f},
-std::array<float,2>{0.045560386f, 0.0305067133f},
-std::array<float,2>{0.503682315f, 0.818693757f},
-std::array<float,2>{0.601921618f, 0.492480874f},
-std::array<float,2>{0.0899179652f, 0.62861073f},
-std::array<float,2>{0.303787678f, 0.191057235f},
-std::array<float,2>{0.956604064f, 0.910048008f},
-std::array<float,2>{0.75350368f, 0.0842284262f},
-std::array<float,2>{0.494716644f, 0.765397966f},
-std::array<float,2>{0.181277886f, 0.341989398f},
-std::array<float,2>{0.703429759f, 0.56161499f},
-std::array<float,2>{0.547365069f, 0.0478961393f},
-std::array<float,2>{0.0281784609f, 0.859612823f},
-std::array<float,2>{0.370305657f, 0.263734043f},
-std::array<float,2>{0.910340369f, 0.573244989f},
-std::array<float,2>{0.814252436f, 0.407713115f},
-std::array<float,2>{0.402531415f, 0.701003075f},
-std::array<float,2>{0.212055296f, 0.164907113f},
-std::array<float,2>{0.643330932f, 0.938373506f},
-std::array<float,2>{0.739987671f, 0.364838213f},
-std::array<float,2>{0.130479321f, 0.526539266f},
-std::array<float,2>{0.445323259f, 0.10150557f},
-std::array<float,2>{0.789265215f, 0.787682414f},
-std::array<float,2>{0.993687987f, 0.220803127f},
-std::array<float,2>{0.266103446f, 0.877345204f},
-std::array<float,2>{0.112448901f, 0.451437801f},
-std::array<float,2>{0.562893093f, 0.681827962f},
-std::array<float,2>{0.581198692f, 0.218259707f},
-std::array<float,2>{0.106633462f, 0.936375201f},
-std::array<float,2>{0.254518509f, 0.480773866f},
-std::array<float,2>{0.974840581f, 0.650149047f},
-std::array<float,2>{0.810164988f, 0.313630551f},
-std::array<float,2>{0.458553851f, 0.542925179f},
-std::array<float,2>{0.144834518f, 0.0699086636f},
-std::array<float,2>{0.729391694f, 0.772206903f},
-std::array<float,2>{0.639612794f, 0.395567924f},
-std::array<float,2>{0.191568956f, 0.743952751f},
-std::array<float,2>{0.37932235f, 0.127910465f},
-std::array<float,2>{0.834177375f, 0.986793756f},
-std::array<float,2>{0.931865394f, 0.00623564888f},
-std::array<float,2>{0.351458371f, 0.843533576f},
-std::array<float,2>{0.00893870275f, 0.295419365f},
-std::array<float,2>{0.535033703f, 0.612365961f},
-std::array<float,2>{0.692514896f, 0.124699824f},
-std::array<float,2>{0.158145994f, 0.81034106f},
-std::array<float,2>{0.479460776f, 0.358297497f},
-std::array<float,2>{0.766013205f, 0.508075118f},
-std::array<float,2>{0.944827318f, 0.463161081f},
-std::array<float,2>{0.283248961f, 0.664475143f},
-std::array<float,2>{0.0721170157f, 0.237700656f},
-std::array<float,2>{0.61765331f, 0.902094841f},
-std::array<float,2>{0.519555688f, 0.267911732f},
-std::array<float,2>{0.0603982806f, 0.59275043f},
-std::array<float,2>{0.320823312f, 0.0444657281f},
-std::array<float,2>{0.878444672f, 0.84887135f},
-std::array<float,2>{0.857627869f, 0.186632648f},
-std::array<float,2>{0.429003507f, 0.954543769f},
-std::array<float,2>{0.227592409f, 0.430349171f},
-std::array<float,2>{0.680037916f, 0.706862807f},
-std::array<float,2>{0.672959745f, 0.223302037f},
-std::array<float,2>{0.220816106f, 0.880656898f},
-std::array<float,2>{0.431527078f, 0.446548671f},
-std::array<float,2>{0.845786929f, 0.686065793f},
-std::array<float,2>{0.889382839f, 0.363032043f},
-std::array<float,2>{0.320301622f, 0.530944288f},
-std::array<float,2>{0.0487412214f, 0.0968700424f},
-std::array<float,2>{0.524600506f, 0.781850994f},
-std::array<float,2>{0.609612584f, 0.412673771f},
-std::array<float,2>{0.0650853366f, 0.698583543f},
-std::array<float,2>{0.295979977f, 0.171721056f},
-std::array<float,2>{0.949027658f, 0.94366461f},
-std::array<float,2>{0.775826454f, 0.0519362763f},
-std::array<float,2>{0.471547425f, 0.866619349f},
-std::array<float,2>{0.166975856f, 0.261589915f},
-std::array<float,2>{0.699089289f, 0.577280581f},
-std::array<float,2>{0.5447523f, 0.0790182054f},
-std::array<float,2>{0.00462957844f, 0.760279655f},
-std::array<float,2>{0.358814865f, 0.338450015f},
-std::array<float,2>{0.922529161f, 0.558179021f},
-std::array<float,2>{0.842156827f, 0.497408241f},
-std::array<float,2>{0.387929708f, 0.631805003f},
-std::array<float,2>{0.196747631f, 0.194266528f},
-std::array<float,2>{0.632034898f, 0.911811769f},
-std::array<float,2>{0.720000207f, 0.311248213f},
-std::array<float,2>{0.150584921f, 0.609027982f},
-std::array<float,2>{0.468341976f, 0.0254195072f},
-std::array<float,2>{0.803400159f, 0.815802991f},
-std::array<float,2>{0.979247093f, 0.152986556f},
-std::array<float,2>{0.25791496f, 0.971296608f},
-std::array<float,2>{0.095676221f, 0.380630374f},
-std::array<float,2>{0.591988742f, 0.722620726f},
-std::array<float,2>{0.573708653f, 0.181326628f},
-std::array<float,2>{0.124258213f, 0.959416747f},
-std::array<float,2>{0.279672652f, 0.43601504f},
-std::array<float,2>{0.991560638f, 0.707176089f},
-std::array<float,2>{0.78866744f, 0.270682693f},
-std::array<float,2>{0.441126049f, 0.588144004f},
-std::array<float,2>{0.133809537f, 0.0407187901f},
-std::array<float,2>{0.745114982f, 0.847432792f},
-std::array<float,2>{0.656116664f, 0.465829015f},
-std::array<float,2>{0.208216757f, 0.671488523f},
-std::array<float,2>{0.397560477f, 0.240914822f},
-std::array<float,2>{0.825862348f, 0.905442119f},
-std::array<float,2>{0.918497503f, 0.118528381f},
-std::array<float,2>{0.365716428f, 0.807332993f},
-std::array<float,2>{0.0184417963f, 0.35499081f},
-std::array<float,2>{0.561177015f, 0.515499175f},
-std::array<float,2>{0.712214649f, 0.00241007446f},
-std::array<float,2>{0.174853444f, 0.837791502f},
-std::array<float,2>{0.490074605f, 0.292326629f},
-std::array<float,2>{0.759876072f, 0.613405883f},
-std::array<float,2>{0.968687475f, 0.390787601f},
-std::array<float,2>{0.307247013f, 0.748585701f},
-std::array<float,2>{0.0791153982f, 0.130926713f},
-std::array<float,2>{0.598379314f, 0.990630507f},
-std::array<float,2>{0.512453198f, 0.317472607f},
-std::array<float,2>{0.0346144326f, 0.546588063f},
-std::array<float,2>{0.333117545f, 0.0639079362f},
-std::array<float,2>{0.903063893f, 0.768373847f},
-std::array<float,2>{0.865217686f, 0.214249924f},
-std::array<float,2>{0.41332528f, 0.932813227f},
-std::array<float,2>{0.240519166f, 0.480115354f},
-std::array<float,2>{0.657233596f, 0.654974639f},
-std::array<float,2>{0.735720217f, 0.138741851f},
-std::array<float,2>{0.12700285f, 0.997907937f},
-std::array<float,2>{0.449915349f, 0.400044024f},
-std::array<float,2>{0.794569194f, 0.739139795f},
-std::array<float,2>{0.999762118f, 0.282767743f},
-std::array<float,2>{0.270283759f, 0.62042141f},
-std::array<float,2>{0.116321981f, 0.00900804251f},
-std::array<float,2>{0.567575276f, 0.83019948f},
-std::array<float,2>{0.553643286f, 0.471742481f},
-std::array<float,2>{0.0261456687f, 0.64329046f},
-std::array<float,2>{0.37261638f, 0.207549706f},
-std::array<float,2>{0.908733308f, 0.927240074f},
-std::array<float,2>{0.817858279f, 0.0756109282f},
-std::array<float,2>{0.399247825f, 0.776043296f},
-std::array<float,2>{0.215728253f, 0.324592561f},
-std::array<float,2>{0.645030141f, 0.531301856f},
-std::array<float,2>{0.606057763f, 0.0327135324f},
-std::array<float,2>{0.0865292475f, 0.851995409f},
-std::array<float,2>{0.299617231f, 0.277728051f},
-std::array<float,2>{0.957719326f, 0.582473397f},
-std::array<float,2>{0.75540787f, 0.428571254f},
-std::array<float,2>{0.496140361f, 0.713326871f},
-std::array<float,2>{0.184836507f, 0.177450389f},
-std::array<float,2>{0.708360732f, 0.967586756f},
-std::array<float,2>{0.669668794f, 0.349820107f},
-std::array<float,2>{0.244575739f, 0.50261718f},
-std::array<float,2>{0.419171751f, 0.113246478f},
-std::array<float,2>{0.867205918f, 0.80339241f},
-std::array<float,2>{0.897861719f, 0.246879905f},
-std::array<float,2>{0.339740217f, 0.897980809f},
-std::array<float,2>{0.0426267944f, 0.456813753f},
-std::array<float,2>{0.504505813f, 0.658630431f},
-std::array<float,2>{0.515846848f, 0.199487567f},
-std::array<float,2>{0.0564191304f, 0.918755472f},
-std::array<float,2>{0.325970829f, 0.486882418f},
-std::array<float,2>{0.879145563f, 0.63390255f},
-std::array<float,2>{0.852321684f, 0.329482019f},
-std::array<float,2>{0.4232696f, 0.552173615f},
-std::array<float,2>{0.232000023f, 0.0936098024f},
-std::array<float,2>{0.684247673f, 0.750523388f},
-std::array<float,2>{0.689634979f, 0.385275871f},
-std::array<float,2>{0.16375418f, 0.729221821f},
-std::array<float,2>{0.482685924f, 0.140992939f},
-std::array<float,2>{0.771623075f, 0.978271246f},
-std::array<float,2>{0.941293716f, 0.0210823473f},
-std::array<float,2>{0.28774929f, 0.824500442f},
-std::array<float,2>{0.077512674f, 0.302700281f},
-std::array<float,2>{0.622126281f, 0.600034118f},
-std::array<float,2>{0.635162055f, 0.103134558f},
-std::array<float,2>{0.187589437f, 0.794733942f},
-std::array<float,2>{0.377283216f, 0.371297091f},
-std::array<float,2>{0.829462469f, 0.520946681f},
-std::array<float,2>{0.934693277f, 0.441347659f},
-std::array<float,2>{0.346944213f, 0.677220166f},
-std::array<float,2>{0.0130629167f, 0.233128235f},
-std::array<float,2>{0.535190642f, 0.886152506f},
-std::array<float,2>{0.585653365f, 0.252634317f},
-std::array<float,2>{0.104820684f, 0.563134909f},
-std::array<float,2>{0.251479596f, 0.0585755631f},
-std::array<float,2>{0.972527742f, 0.869326174f},
-std::array<float,2>{0.807957709f, 0.15633738f},
-std::array<float,2>{0.455067754f, 0.947481155f},
-std::array<float,2>{0.143865079f, 0.416696519f},
-std::array<float,2>{0.732863426f, 0.692174315f},
-std::array<float,2>{0.699913621f, 0.204019055f},
-std::array<float,2>{0.171771422f, 0.925143182f},
-std::array<float,2>{0.475620747f, 0.475422591f},
-std::array<float,2>{0.780261636f, 0.646631062f},
-std::array<float,2>{0.950074732f, 0.322262526f},
-std::array<float,2>{0.292645752f, 0.537441671f},
-std::array<float,2>{0.0688585863f, 0.0720407814f},
-std::array<float,2>{0.614187181f, 0.777660429f},
-std::array<float,2>{0.528740823f, 0.402830958f},
-std::array<float,2>{0.0514389798f, 0.736617029f},
-std::array<float,2>{0.31391874f, 0.132985294f},
-std::array<float,2>{0.883543015f, 0.992623508f},
-std::array<float,2>{0.850653052f, 0.0145532107f},
-std::array<float,2>{0.434557319f, 0.833301306f},
-std::array<float,2>{0.225080922f, 0.286202013f},
-std::array<float,2>{0.67875886f, 0.624158144f},
-std::array<float,2>{0.589329243f, 0.116972886f},
-std::array<float,2>{0.101377144f, 0.80077976f},
-std::array<float,2>{0.263996363f, 0.347123772f},
-std::array<float,2>{0.983481109f, 0.505374968f},
-std::array<float,2>{0.799362123f, 0.457219362f},
-std::array<float,2>{0.462032169f, 0.661845326f},
-std::array<float,2>{0.154527277f, 0.24545449f},
-std::array<float,2>{0.722999811f, 0.892557561f},
-std::array<float,2>{0.626644671f, 0.275420696f},
-std::array<float,2>{0.202735931f, 0.581711471f},
-std::array<float,2>{0.383942336f, 0.0386655182f},
-std::array<float,2>{0.839298069f, 0.855656683f},
-std::array<float,2>{0.925848305f, 0.174360186f},
-std::array<float,2>{0.351582587f, 0.963047087f},
-std::array<float,2>{0.000609177107f, 0.422126472f},
-std::array<float,2>{0.53944844f, 0.715415239f},
-std::array<float,2>{0.557668388f, 0.145993501f},
-std::array<float,2>{0.0203401968f, 0.982895732f},
-std::array<float,2>{0.3604725f, 0.387269676f},
-std::array<float,2>{0.917541027f, 0.733843863f},
-std::array<float,2>{0.821542561f, 0.300404191f},
-std::array<float,2>{0.393359989f, 0.594349027f},
-std::array<float,2>{0.206321195f, 0.018699836f},
-std::array<float,2>{0.65198648f, 0.823764265f},
-std::array<float,2>{0.749820709f, 0.489954799f},
-std::array<float,2>{0.137071788f, 0.637249053f},
-std::array<float,2>{0.444690436f, 0.197982922f},
-std::array<float,2>{0.783061385f, 0.915768147f},
-std::array<float,2>{0.987053573f, 0.0882324576f},
-std::array<float,2>{0.276804447f, 0.756370127f},
-std::array<float,2>{0.117548548f, 0.333605558f},
-std::array<float,2>{0.574670494f, 0.548773885f},
-std::array<float,2>{0.66359359f, 0.0621563122f},
-std::array<float,2>{0.237229213f, 0.871659756f},
-std::array<float,2>{0.407709122f, 0.255208582f},
-std::array<float,2>{0.859784186f, 0.569327056f},
-std::array<float,2>{0.898506463f, 0.41916284f},
-std::array<float,2>{0.33196497f, 0.688523471f},
-std::array<float,2>{0.0371386819f, 0.16031459f},
-std::array<float,2>{0.509838939f, 0.95033586f},
-std::array<float,2>{0.595873177f, 0.368255168f},
-std::array<float,2>{0.0834463313f, 0.517593741f},
-std::array<float,2>{0.309305608f, 0.1093622f},
-std::array<float,2>{0.962458909f, 0.792284667f},
-std::array<float,2>{0.762960494f, 0.228883222f},
-std::array<float,2>{0.487070411f, 0.88846916f},
-std::array<float,2>{0.177063197f, 0.441540718f},
-std::array<float,2>{0.716087162f, 0.672998011f},
-std::array<float,2>{0.64250654f, 0.167750031f},
-std::array<float,2>{0.213500395f, 0.940444171f},
-std::array<float,2>{0.406134933f, 0.40947789f},
-std::array<float,2>{0.815764785f, 0.702295184f},
-std::array<float,2>{0.912823021f, 0.262493044f},
-std::array<float,2>{0.368321687f, 0.57182157f},
-std::array<float,2>{0.0308052059f, 0.0491291806f},
-std::array<float,2>{0.549537063f, 0.862669885f},
-std::array<float,2>{0.566007912f, 0.450176299f},
-std::array<float,2>{0.111081019f, 0.681579769f},
-std::array<float,2>{0.268120468f, 0.220659211f},
-std::array<float,2>{0.994824171f, 0.875990391f},
-std::array<float,2>{0.792951167f, 0.099163942f},
-std::array<float,2>{0.448520601f, 0.785871327f},
-std::array<float,2>{0.131240696f, 0.365766019f},
-std::array<float,2>{0.74116832f, 0.523776591f},
-std::array<float,2>{0.500629663f, 0.027350761f},
-std::array<float,2>{0.0433561057f, 0.816684067f},
-std::array<float,2>{0.340721667f, 0.305299401f},
-std::array<float,2>{0.891373694f, 0.601672411f},
-std::array<float,2>{0.872219324f, 0.375338346f},
-std::array<float,2>{0.417915016f, 0.725906014f},
-std::array<float,2>{0.247434705f, 0.150392786f},
-std::array<float,2>{0.666784525f, 0.973793566f},
-std::array<float,2>{0.70696646f, 0.341563821f},
-std::array<float,2>{0.182996243f, 0.559068859f},
-std::array<float,2>{0.493282557f, 0.0837557316f},
-std::array<float,2>{0.751366973f, 0.763619423f},
-std::array<float,2>{0.954844594f, 0.18841666f},
-std::array<float,2>{0.301900923f, 0.907964051f},
-std::array<float,2>{0.0929527208f, 0.49456802f},
-std::array<float,2>{0.604763865f, 0.625466049f},
-std::array<float,2>{0.619464576f, 0.235345677f},
-std::array<float,2>{0.0740149617f, 0.899139404f},
-std::array<float,2>{0.282739699f, 0.4616732f},
-std::array<float,2>{0.941413224f, 0.666562855f},
-std::array<float,2>{0.7682271f, 0.357384235f},
-std::array<float,2>{0.47723034f, 0.510231733f},
-std::array<float,2>{0.158306748f, 0.122708447f},
-std::array<float,2>{0.694487274f, 0.81110239f},
-std::array<float,2>{0.682332277f, 0.431750268f},
-std::array<float,2>{0.229528099f, 0.703970253f},
-std::array<float,2>{0.426660061f, 0.184022322f},
-std::array<float,2>{0.85722965f, 0.955307782f},
-std::array<float,2>{0.876274109f, 0.046109546f},
-std::array<float,2>{0.322845757f, 0.850887418f},
-std::array<float,2>{0.0615213066f, 0.267155081f},
-std::array<float,2>{0.521562219f, 0.589859664f},
-std::array<float,2>{0.726724684f, 0.0680087432f},
-std::array<float,2>{0.147547841f, 0.771414578f},
-std::array<float,2>{0.459930927f, 0.315902919f},
-std::array<float,2>{0.81120193f, 0.540571034f},
-std::array<float,2>{0.973665535f, 0.483365685f},
-std::array<float,2>{0.257602423f, 0.651845694f},
-std::array<float,2>{0.108037226f, 0.21612151f},
-std::array<float,2>{0.579743862f, 0.93474251f},
-std::array<float,2>{0.532485664f, 0.294276237f},
-std::array<float,2>{0.0106388181f, 0.609988987f},
-std::array<float,2>{0.348362893f, 0.00492327288f},
-std::array<float,2>{0.929729462f, 0.84023875f},
-std::array<float,2>{0.832547843f, 0.126146063f},
-std::array<float,2>{0.381240606f, 0.985648334f},
-std::array<float,2>{0.1943537f, 0.397313029f},
-std::array<float,2>{0.638501465f, 0.74521929f}}
\ No newline at end of file
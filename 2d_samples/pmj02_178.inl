@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.334254622f, 0.462581664f},
-std::array<float,2>{0.559088647f, 0.940083385f},
-std::array<float,2>{0.858735383f, 0.210626796f},
-std::array<float,2>{0.118047304f, 0.563078701f},
-std::array<float,2>{0.1277702f, 0.108701192f},
-std::array<float,2>{0.885197878f, 0.661444187f},
-std::array<float,2>{0.658263147f, 0.297759384f},
-std::array<float,2>{0.425956815f, 0.782902241f},
-std::array<float,2>{0.439958513f, 0.147082016f},
-std::array<float,2>{0.731733501f, 0.552285969f},
-std::array<float,2>{0.981645286f, 0.421167642f},
-std::array<float,2>{0.213771164f, 0.923028469f},
-std::array<float,2>{0.0572794788f, 0.343269348f},
-std::array<float,2>{0.784381926f, 0.824889481f},
-std::array<float,2>{0.570324481f, 0.0316025093f},
-std::array<float,2>{0.265255988f, 0.74899745f},
-std::array<float,2>{0.387513399f, 0.278635323f},
-std::array<float,2>{0.645460844f, 0.773476422f},
-std::array<float,2>{0.92916888f, 0.0754884407f},
-std::array<float,2>{0.159804165f, 0.645522237f},
-std::array<float,2>{0.0857811794f, 0.231369764f},
-std::array<float,2>{0.824637413f, 0.615882218f},
-std::array<float,2>{0.520478785f, 0.483206689f},
-std::array<float,2>{0.359880298f, 0.997729182f},
-std::array<float,2>{0.29822275f, 0.00266741519f},
-std::array<float,2>{0.623761356f, 0.709907174f},
-std::array<float,2>{0.754789054f, 0.347124279f},
-std::array<float,2>{0.00922776759f, 0.86077106f},
-std::array<float,2>{0.243146062f, 0.388391435f},
-std::array<float,2>{0.949423552f, 0.883897364f},
-std::array<float,2>{0.710787654f, 0.17978406f},
-std::array<float,2>{0.494480491f, 0.515639544f},
-std::array<float,2>{0.470207155f, 0.426405996f},
-std::array<float,2>{0.699028552f, 0.913499832f},
-std::array<float,2>{0.96697402f, 0.131085157f},
-std::array<float,2>{0.226634055f, 0.534655869f},
-std::array<float,2>{0.0273233f, 0.0610072091f},
-std::array<float,2>{0.772630453f, 0.73345679f},
-std::array<float,2>{0.609358311f, 0.323857039f},
-std::array<float,2>{0.285128772f, 0.839086831f},
-std::array<float,2>{0.352185518f, 0.198062956f},
-std::array<float,2>{0.511542976f, 0.589061856f},
-std::array<float,2>{0.841659904f, 0.440389842f},
-std::array<float,2>{0.0646256655f, 0.956651032f},
-std::array<float,2>{0.184616312f, 0.286248833f},
-std::array<float,2>{0.919574201f, 0.799601138f},
-std::array<float,2>{0.631940365f, 0.113304593f},
-std::array<float,2>{0.390947729f, 0.68093574f},
-std::array<float,2>{0.280416906f, 0.361942112f},
-std::array<float,2>{0.587221742f, 0.856911957f},
-std::array<float,2>{0.807414591f, 0.0220355038f},
-std::array<float,2>{0.0369607918f, 0.689563513f},
-std::array<float,2>{0.188687518f, 0.16975823f},
-std::array<float,2>{0.994556427f, 0.507236421f},
-std::array<float,2>{0.744716465f, 0.396028459f},
-std::array<float,2>{0.455289572f, 0.903367639f},
-std::array<float,2>{0.414701641f, 0.0837582946f},
-std::array<float,2>{0.683246076f, 0.635366261f},
-std::array<float,2>{0.900511742f, 0.259848356f},
-std::array<float,2>{0.155739427f, 0.753156364f},
-std::array<float,2>{0.0955801234f, 0.497114569f},
-std::array<float,2>{0.864752948f, 0.971843958f},
-std::array<float,2>{0.535694242f, 0.240031183f},
-std::array<float,2>{0.322630465f, 0.597589195f},
-std::array<float,2>{0.293866843f, 0.402108938f},
-std::array<float,2>{0.598515332f, 0.891689122f},
-std::array<float,2>{0.778589129f, 0.158899292f},
-std::array<float,2>{0.0175871719f, 0.509679496f},
-std::array<float,2>{0.219018772f, 0.0305577368f},
-std::array<float,2>{0.95581156f, 0.699857473f},
-std::array<float,2>{0.687696695f, 0.369640946f},
-std::array<float,2>{0.481328726f, 0.844510078f},
-std::array<float,2>{0.404987752f, 0.244057849f},
-std::array<float,2>{0.637450814f, 0.607850194f},
-std::array<float,2>{0.907839298f, 0.491261542f},
-std::array<float,2>{0.178307608f, 0.981344104f},
-std::array<float,2>{0.0733438581f, 0.254910022f},
-std::array<float,2>{0.831270337f, 0.763308823f},
-std::array<float,2>{0.506803989f, 0.0896376446f},
-std::array<float,2>{0.344818711f, 0.627744257f},
-std::array<float,2>{0.467760116f, 0.31667161f},
-std::array<float,2>{0.739685595f, 0.828314126f},
-std::array<float,2>{0.990091562f, 0.052459158f},
-std::array<float,2>{0.196663782f, 0.719530046f},
-std::array<float,2>{0.042414438f, 0.138890967f},
-std::array<float,2>{0.799227357f, 0.541423976f},
-std::array<float,2>{0.584608138f, 0.436434865f},
-std::array<float,2>{0.267177433f, 0.914649248f},
-std::array<float,2>{0.318119884f, 0.12139529f},
-std::array<float,2>{0.540627539f, 0.677314579f},
-std::array<float,2>{0.873542786f, 0.292815834f},
-std::array<float,2>{0.10445302f, 0.809905529f},
-std::array<float,2>{0.142383903f, 0.448966712f},
-std::array<float,2>{0.898108065f, 0.9618572f},
-std::array<float,2>{0.674990594f, 0.194321617f},
-std::array<float,2>{0.4139117f, 0.580444932f},
-std::array<float,2>{0.432527393f, 0.472881913f},
-std::array<float,2>{0.669178426f, 0.989843667f},
-std::array<float,2>{0.88136965f, 0.222594738f},
-std::array<float,2>{0.139933839f, 0.624668002f},
-std::array<float,2>{0.112780489f, 0.0674335808f},
-std::array<float,2>{0.849597096f, 0.649017036f},
-std::array<float,2>{0.547413051f, 0.27177307f},
-std::array<float,2>{0.337219328f, 0.770533442f},
-std::array<float,2>{0.256324291f, 0.179396585f},
-std::array<float,2>{0.566541135f, 0.528489888f},
-std::array<float,2>{0.795793772f, 0.381914258f},
-std::array<float,2>{0.0490390174f, 0.876220644f},
-std::array<float,2>{0.205299705f, 0.352271527f},
-std::array<float,2>{0.972677767f, 0.870041132f},
-std::array<float,2>{0.71975714f, 0.00809919834f},
-std::array<float,2>{0.452473015f, 0.716394126f},
-std::array<float,2>{0.372140974f, 0.306655973f},
-std::array<float,2>{0.529180229f, 0.790981054f},
-std::array<float,2>{0.816824853f, 0.0958294198f},
-std::array<float,2>{0.0926319361f, 0.665003479f},
-std::array<float,2>{0.169437081f, 0.217213258f},
-std::array<float,2>{0.930792212f, 0.576250315f},
-std::array<float,2>{0.648960233f, 0.456373483f},
-std::array<float,2>{0.381881237f, 0.949494898f},
-std::array<float,2>{0.485841334f, 0.0406400226f},
-std::array<float,2>{0.717174888f, 0.74133265f},
-std::array<float,2>{0.938273251f, 0.33181566f},
-std::array<float,2>{0.236807972f, 0.815293491f},
-std::array<float,2>{0.00619836664f, 0.409327149f},
-std::array<float,2>{0.759388804f, 0.932176411f},
-std::array<float,2>{0.614404023f, 0.149288401f},
-std::array<float,2>{0.31124413f, 0.557595968f},
-std::array<float,2>{0.349391818f, 0.414785951f},
-std::array<float,2>{0.502543628f, 0.929292381f},
-std::array<float,2>{0.832235992f, 0.141879752f},
-std::array<float,2>{0.0778059289f, 0.54948777f},
-std::array<float,2>{0.175746992f, 0.0362413228f},
-std::array<float,2>{0.913478673f, 0.743287802f},
-std::array<float,2>{0.635313153f, 0.339644343f},
-std::array<float,2>{0.399077356f, 0.821557164f},
-std::array<float,2>{0.47927314f, 0.205881864f},
-std::array<float,2>{0.694267154f, 0.568931222f},
-std::array<float,2>{0.959893644f, 0.467087388f},
-std::array<float,2>{0.223786265f, 0.942819118f},
-std::array<float,2>{0.0233817678f, 0.301457822f},
-std::array<float,2>{0.774897277f, 0.787663817f},
-std::array<float,2>{0.595209956f, 0.101698048f},
-std::array<float,2>{0.289607465f, 0.658124506f},
-std::array<float,2>{0.40839994f, 0.350482523f},
-std::array<float,2>{0.679657161f, 0.86346668f},
-std::array<float,2>{0.894352615f, 0.00492916629f},
-std::array<float,2>{0.147979364f, 0.706859767f},
-std::array<float,2>{0.106296003f, 0.184854746f},
-std::array<float,2>{0.868878365f, 0.519992352f},
-std::array<float,2>{0.546557009f, 0.385496557f},
-std::array<float,2>{0.313673049f, 0.890255809f},
-std::array<float,2>{0.271019191f, 0.0721539482f},
-std::array<float,2>{0.57983923f, 0.64226073f},
-std::array<float,2>{0.804005742f, 0.277324349f},
-std::array<float,2>{0.0441287979f, 0.780250132f},
-std::array<float,2>{0.201817542f, 0.476652324f},
-std::array<float,2>{0.985563159f, 0.995702624f},
-std::array<float,2>{0.736588717f, 0.229496971f},
-std::array<float,2>{0.463977814f, 0.61172682f},
-std::array<float,2>{0.445466846f, 0.445246249f},
-std::array<float,2>{0.724990666f, 0.957846463f},
-std::array<float,2>{0.970831037f, 0.199408695f},
-std::array<float,2>{0.208069012f, 0.590704679f},
-std::array<float,2>{0.0546465777f, 0.112913869f},
-std::array<float,2>{0.792569399f, 0.686782956f},
-std::array<float,2>{0.563295007f, 0.283409178f},
-std::array<float,2>{0.250304878f, 0.801845551f},
-std::array<float,2>{0.342946976f, 0.128540233f},
-std::array<float,2>{0.552930772f, 0.538293064f},
-std::array<float,2>{0.846921444f, 0.42198506f},
-std::array<float,2>{0.113875046f, 0.907915056f},
-std::array<float,2>{0.132879183f, 0.328035623f},
-std::array<float,2>{0.876746535f, 0.840282202f},
-std::array<float,2>{0.665427089f, 0.0550823733f},
-std::array<float,2>{0.436697483f, 0.727243602f},
-std::array<float,2>{0.305620432f, 0.261891365f},
-std::array<float,2>{0.61021781f, 0.755443037f},
-std::array<float,2>{0.763389111f, 0.0781404525f},
-std::array<float,2>{0.00302599138f, 0.63946104f},
-std::array<float,2>{0.239889711f, 0.236394823f},
-std::array<float,2>{0.943658888f, 0.600910842f},
-std::array<float,2>{0.714699388f, 0.493026763f},
-std::array<float,2>{0.489802122f, 0.97608763f},
-std::array<float,2>{0.375436336f, 0.0166906584f},
-std::array<float,2>{0.654540658f, 0.692190707f},
-std::array<float,2>{0.937113225f, 0.363378555f},
-std::array<float,2>{0.166099027f, 0.852394938f},
-std::array<float,2>{0.0875594765f, 0.392174929f},
-std::array<float,2>{0.815957725f, 0.8984828f},
-std::array<float,2>{0.524359286f, 0.165002063f},
-std::array<float,2>{0.367201686f, 0.503056467f},
-std::array<float,2>{0.260911286f, 0.485831648f},
-std::array<float,2>{0.57608217f, 0.979691744f},
-std::array<float,2>{0.787310779f, 0.248047546f},
-std::array<float,2>{0.0591449067f, 0.603332996f},
-std::array<float,2>{0.21657145f, 0.0926076993f},
-std::array<float,2>{0.979452014f, 0.632041454f},
-std::array<float,2>{0.728577435f, 0.253817499f},
-std::array<float,2>{0.443821341f, 0.759428561f},
-std::array<float,2>{0.424559146f, 0.161866471f},
-std::array<float,2>{0.660833478f, 0.513922453f},
-std::array<float,2>{0.887927234f, 0.404383391f},
-std::array<float,2>{0.132161111f, 0.896541417f},
-std::array<float,2>{0.123010069f, 0.372299612f},
-std::array<float,2>{0.853099525f, 0.850441098f},
-std::array<float,2>{0.556981206f, 0.0261330083f},
-std::array<float,2>{0.329444855f, 0.697374165f},
-std::array<float,2>{0.499011487f, 0.295538694f},
-std::array<float,2>{0.706345379f, 0.807164252f},
-std::array<float,2>{0.947984517f, 0.117398441f},
-std::array<float,2>{0.249024972f, 0.674871922f},
-std::array<float,2>{0.0146622714f, 0.189234659f},
-std::array<float,2>{0.751969397f, 0.582743645f},
-std::array<float,2>{0.617976546f, 0.450921744f},
-std::array<float,2>{0.301755548f, 0.96544081f},
-std::array<float,2>{0.366269469f, 0.0497956946f},
-std::array<float,2>{0.516532898f, 0.723300338f},
-std::array<float,2>{0.823348165f, 0.313347369f},
-std::array<float,2>{0.0784309059f, 0.833363831f},
-std::array<float,2>{0.163680673f, 0.431764454f},
-std::array<float,2>{0.925706446f, 0.921115577f},
-std::array<float,2>{0.643765926f, 0.135617912f},
-std::array<float,2>{0.386118382f, 0.544430435f},
-std::array<float,2>{0.394811511f, 0.377655536f},
-std::array<float,2>{0.626464903f, 0.882212341f},
-std::array<float,2>{0.9162184f, 0.172463238f},
-std::array<float,2>{0.179799974f, 0.526232719f},
-std::array<float,2>{0.0668830127f, 0.0149117233f},
-std::array<float,2>{0.839467645f, 0.711169422f},
-std::array<float,2>{0.514997184f, 0.359107047f},
-std::array<float,2>{0.35822919f, 0.873703837f},
-std::array<float,2>{0.287478894f, 0.226238728f},
-std::array<float,2>{0.604559958f, 0.618696809f},
-std::array<float,2>{0.767026186f, 0.471441448f},
-std::array<float,2>{0.0280744396f, 0.985537589f},
-std::array<float,2>{0.231960356f, 0.268065691f},
-std::array<float,2>{0.96235615f, 0.768066943f},
-std::array<float,2>{0.70022285f, 0.0648815483f},
-std::array<float,2>{0.473141044f, 0.65408963f},
-std::array<float,2>{0.327851981f, 0.333270013f},
-std::array<float,2>{0.532856822f, 0.819667876f},
-std::array<float,2>{0.861321747f, 0.044562716f},
-std::array<float,2>{0.10068392f, 0.736557305f},
-std::array<float,2>{0.151329353f, 0.153051063f},
-std::array<float,2>{0.90564543f, 0.562487066f},
-std::array<float,2>{0.686027229f, 0.412247032f},
-std::array<float,2>{0.419441581f, 0.9354316f},
-std::array<float,2>{0.460307091f, 0.0983480737f},
-std::array<float,2>{0.749631584f, 0.670030892f},
-std::array<float,2>{0.99955076f, 0.309363604f},
-std::array<float,2>{0.19357574f, 0.793235838f},
-std::array<float,2>{0.0332953222f, 0.460269034f},
-std::array<float,2>{0.810143828f, 0.948264837f},
-std::array<float,2>{0.592686236f, 0.213842049f},
-std::array<float,2>{0.275327295f, 0.573563039f},
-std::array<float,2>{0.362885445f, 0.48102802f},
-std::array<float,2>{0.521615267f, 0.999702692f},
-std::array<float,2>{0.826492548f, 0.232646927f},
-std::array<float,2>{0.0829704851f, 0.614222646f},
-std::array<float,2>{0.157623649f, 0.0773649439f},
-std::array<float,2>{0.926948726f, 0.64763844f},
-std::array<float,2>{0.646579623f, 0.280960858f},
-std::array<float,2>{0.389240146f, 0.776577353f},
-std::array<float,2>{0.493196249f, 0.182455927f},
-std::array<float,2>{0.708883941f, 0.519123316f},
-std::array<float,2>{0.95267427f, 0.389686853f},
-std::array<float,2>{0.2456242f, 0.88477844f},
-std::array<float,2>{0.0107855629f, 0.344264388f},
-std::array<float,2>{0.756840348f, 0.861576796f},
-std::array<float,2>{0.621667981f, 0.00100482628f},
-std::array<float,2>{0.299564004f, 0.707295179f},
-std::array<float,2>{0.42875728f, 0.300669104f},
-std::array<float,2>{0.657075167f, 0.784995019f},
-std::array<float,2>{0.884221792f, 0.105803914f},
-std::array<float,2>{0.125121504f, 0.663403153f},
-std::array<float,2>{0.120414697f, 0.207878515f},
-std::array<float,2>{0.856645703f, 0.56511718f},
-std::array<float,2>{0.561298072f, 0.462982118f},
-std::array<float,2>{0.332242757f, 0.937891603f},
-std::array<float,2>{0.263524652f, 0.0348871127f},
-std::array<float,2>{0.573662341f, 0.747444749f},
-std::array<float,2>{0.782234609f, 0.341350794f},
-std::array<float,2>{0.0552299917f, 0.827502012f},
-std::array<float,2>{0.211859792f, 0.418782413f},
-std::array<float,2>{0.983670771f, 0.924272418f},
-std::array<float,2>{0.733933985f, 0.146071866f},
-std::array<float,2>{0.438356459f, 0.553964376f},
-std::array<float,2>{0.454476058f, 0.39660275f},
-std::array<float,2>{0.74408567f, 0.904908776f},
-std::array<float,2>{0.994049609f, 0.170602307f},
-std::array<float,2>{0.190323666f, 0.505492926f},
-std::array<float,2>{0.0374454968f, 0.0214664489f},
-std::array<float,2>{0.804996669f, 0.687711239f},
-std::array<float,2>{0.589317203f, 0.359668553f},
-std::array<float,2>{0.278173298f, 0.857483387f},
-std::array<float,2>{0.320792794f, 0.2420412f},
-std::array<float,2>{0.538771391f, 0.59483403f},
-std::array<float,2>{0.865558326f, 0.498519748f},
-std::array<float,2>{0.0974928737f, 0.969960451f},
-std::array<float,2>{0.153435081f, 0.25862655f},
-std::array<float,2>{0.899884522f, 0.750979662f},
-std::array<float,2>{0.679842889f, 0.0850088447f},
-std::array<float,2>{0.41613394f, 0.634031177f},
-std::array<float,2>{0.283021122f, 0.32172361f},
-std::array<float,2>{0.606988311f, 0.83701086f},
-std::array<float,2>{0.770986497f, 0.0601426437f},
-std::array<float,2>{0.0243102014f, 0.731921494f},
-std::array<float,2>{0.228828415f, 0.130412459f},
-std::array<float,2>{0.965017617f, 0.532202065f},
-std::array<float,2>{0.695603013f, 0.428658336f},
-std::array<float,2>{0.47159642f, 0.91032052f},
-std::array<float,2>{0.393061876f, 0.115423992f},
-std::array<float,2>{0.63055402f, 0.681713641f},
-std::array<float,2>{0.921576202f, 0.287850529f},
-std::array<float,2>{0.187478855f, 0.798616588f},
-std::array<float,2>{0.0637583584f, 0.438675106f},
-std::array<float,2>{0.843673587f, 0.95480597f},
-std::array<float,2>{0.508989155f, 0.196113959f},
-std::array<float,2>{0.354606956f, 0.587753654f},
-std::array<float,2>{0.267774642f, 0.434269816f},
-std::array<float,2>{0.582605541f, 0.917761683f},
-std::array<float,2>{0.798046649f, 0.138595328f},
-std::array<float,2>{0.0406565405f, 0.54099828f},
-std::array<float,2>{0.197452381f, 0.0538294502f},
-std::array<float,2>{0.991502881f, 0.721754789f},
-std::array<float,2>{0.742097259f, 0.318496794f},
-std::array<float,2>{0.465837777f, 0.830945253f},
-std::array<float,2>{0.411512285f, 0.192472667f},
-std::array<float,2>{0.672460914f, 0.57935369f},
-std::array<float,2>{0.895130813f, 0.446099311f},
-std::array<float,2>{0.142734393f, 0.963190854f},
-std::array<float,2>{0.101982452f, 0.289165139f},
-std::array<float,2>{0.871794343f, 0.812401474f},
-std::array<float,2>{0.541475475f, 0.124274254f},
-std::array<float,2>{0.319181383f, 0.678979874f},
-std::array<float,2>{0.483383417f, 0.367992789f},
-std::array<float,2>{0.691082358f, 0.846211731f},
-std::array<float,2>{0.953348041f, 0.0277237035f},
-std::array<float,2>{0.222140908f, 0.701960564f},
-std::array<float,2>{0.0167809911f, 0.157697171f},
-std::array<float,2>{0.779603541f, 0.511020422f},
-std::array<float,2>{0.599990189f, 0.399458885f},
-std::array<float,2>{0.295740634f, 0.893050075f},
-std::array<float,2>{0.34733358f, 0.0869785398f},
-std::array<float,2>{0.504553616f, 0.625376523f},
-std::array<float,2>{0.828329623f, 0.256303012f},
-std::array<float,2>{0.0703328699f, 0.764821112f},
-std::array<float,2>{0.177568749f, 0.488572806f},
-std::array<float,2>{0.908268392f, 0.982598424f},
-std::array<float,2>{0.640186727f, 0.244287625f},
-std::array<float,2>{0.403957576f, 0.606716871f},
-std::array<float,2>{0.379827857f, 0.45425871f},
-std::array<float,2>{0.652008176f, 0.951996386f},
-std::array<float,2>{0.931962073f, 0.216609493f},
-std::array<float,2>{0.170580342f, 0.575111151f},
-std::array<float,2>{0.0909833685f, 0.0945707858f},
-std::array<float,2>{0.819169641f, 0.667511523f},
-std::array<float,2>{0.530197203f, 0.305405527f},
-std::array<float,2>{0.374569476f, 0.792787313f},
-std::array<float,2>{0.308670998f, 0.151477829f},
-std::array<float,2>{0.615667403f, 0.556325912f},
-std::array<float,2>{0.76139003f, 0.407387018f},
-std::array<float,2>{0.00438523851f, 0.930332541f},
-std::array<float,2>{0.235516429f, 0.329820305f},
-std::array<float,2>{0.940782905f, 0.813370228f},
-std::array<float,2>{0.715766311f, 0.0421394184f},
-std::array<float,2>{0.487648159f, 0.738537014f},
-std::array<float,2>{0.339530557f, 0.270663291f},
-std::array<float,2>{0.549151301f, 0.771642447f},
-std::array<float,2>{0.851504028f, 0.0702136979f},
-std::array<float,2>{0.109963551f, 0.652273118f},
-std::array<float,2>{0.13742134f, 0.218879595f},
-std::array<float,2>{0.879545391f, 0.621326029f},
-std::array<float,2>{0.670965612f, 0.474698722f},
-std::array<float,2>{0.43145752f, 0.990344405f},
-std::array<float,2>{0.449712515f, 0.0102756964f},
-std::array<float,2>{0.720947146f, 0.716949999f},
-std::array<float,2>{0.975123763f, 0.353820026f},
-std::array<float,2>{0.203836754f, 0.867327154f},
-std::array<float,2>{0.0478444695f, 0.380296379f},
-std::array<float,2>{0.793183565f, 0.877186f},
-std::array<float,2>{0.569791019f, 0.176759288f},
-std::array<float,2>{0.255787522f, 0.531003594f},
-std::array<float,2>{0.315762728f, 0.383591145f},
-std::array<float,2>{0.543337584f, 0.887681544f},
-std::array<float,2>{0.870714188f, 0.18639414f},
-std::array<float,2>{0.109151721f, 0.521621287f},
-std::array<float,2>{0.145610988f, 0.00777261937f},
-std::array<float,2>{0.891337514f, 0.704135001f},
-std::array<float,2>{0.677522898f, 0.348474234f},
-std::array<float,2>{0.407758445f, 0.865642488f},
-std::array<float,2>{0.462880731f, 0.227333248f},
-std::array<float,2>{0.735255718f, 0.61008954f},
-std::array<float,2>{0.986768842f, 0.480006397f},
-std::array<float,2>{0.199291617f, 0.993790269f},
-std::array<float,2>{0.0450221896f, 0.274322361f},
-std::array<float,2>{0.80136323f, 0.778118968f},
-std::array<float,2>{0.580278575f, 0.073723264f},
-std::array<float,2>{0.27174142f, 0.643830657f},
-std::array<float,2>{0.402328879f, 0.337618142f},
-std::array<float,2>{0.633301616f, 0.823705077f},
-std::array<float,2>{0.912054181f, 0.0389325842f},
-std::array<float,2>{0.173438191f, 0.745748818f},
-std::array<float,2>{0.0745409876f, 0.142685905f},
-std::array<float,2>{0.834480762f, 0.54702276f},
-std::array<float,2>{0.500331163f, 0.417047083f},
-std::array<float,2>{0.349662721f, 0.927171052f},
-std::array<float,2>{0.292050183f, 0.104779705f},
-std::array<float,2>{0.596868217f, 0.658723474f},
-std::array<float,2>{0.776619911f, 0.3046f},
-std::array<float,2>{0.0197754055f, 0.786554694f},
-std::array<float,2>{0.225194603f, 0.465716839f},
-std::array<float,2>{0.958239794f, 0.944441676f},
-std::array<float,2>{0.693354428f, 0.203255475f},
-std::array<float,2>{0.477333874f, 0.567386389f},
-std::array<float,2>{0.491836935f, 0.495847523f},
-std::array<float,2>{0.712466717f, 0.972891927f},
-std::array<float,2>{0.942069292f, 0.235044748f},
-std::array<float,2>{0.24083592f, 0.599561512f},
-std::array<float,2>{0.00109439588f, 0.0811292455f},
-std::array<float,2>{0.764498353f, 0.637872994f},
-std::array<float,2>{0.611846864f, 0.265613973f},
-std::array<float,2>{0.308406889f, 0.757764995f},
-std::array<float,2>{0.370913357f, 0.166177019f},
-std::array<float,2>{0.526650965f, 0.500853181f},
-std::array<float,2>{0.813235462f, 0.393433362f},
-std::array<float,2>{0.0889551416f, 0.902300537f},
-std::array<float,2>{0.164925516f, 0.367174566f},
-std::array<float,2>{0.93456465f, 0.853722453f},
-std::array<float,2>{0.653990507f, 0.0187786333f},
-std::array<float,2>{0.377385497f, 0.693471134f},
-std::array<float,2>{0.253507406f, 0.282587409f},
-std::array<float,2>{0.566372693f, 0.802982628f},
-std::array<float,2>{0.790960908f, 0.111110613f},
-std::array<float,2>{0.0508795045f, 0.684113204f},
-std::array<float,2>{0.20995836f, 0.201859459f},
-std::array<float,2>{0.969772756f, 0.592588603f},
-std::array<float,2>{0.723776758f, 0.44292292f},
-std::array<float,2>{0.448785514f, 0.959274113f},
-std::array<float,2>{0.433998376f, 0.0575507432f},
-std::array<float,2>{0.667541862f, 0.728796005f},
-std::array<float,2>{0.87834698f, 0.32461068f},
-std::array<float,2>{0.135545373f, 0.843474627f},
-std::array<float,2>{0.116899438f, 0.424431145f},
-std::array<float,2>{0.843963861f, 0.908785522f},
-std::array<float,2>{0.552361488f, 0.125592887f},
-std::array<float,2>{0.34153372f, 0.53530395f},
-std::array<float,2>{0.303003848f, 0.451255381f},
-std::array<float,2>{0.619751275f, 0.967374206f},
-std::array<float,2>{0.751570582f, 0.190587208f},
-std::array<float,2>{0.0128411427f, 0.585066378f},
-std::array<float,2>{0.246734336f, 0.11947047f},
-std::array<float,2>{0.947058797f, 0.67238915f},
-std::array<float,2>{0.703872979f, 0.294310242f},
-std::array<float,2>{0.497558773f, 0.805457234f},
-std::array<float,2>{0.384234995f, 0.134162173f},
-std::array<float,2>{0.640758395f, 0.545454979f},
-std::array<float,2>{0.923028946f, 0.431631118f},
-std::array<float,2>{0.161532998f, 0.919099867f},
-std::array<float,2>{0.081070289f, 0.315106928f},
-std::array<float,2>{0.821758628f, 0.835270107f},
-std::array<float,2>{0.518513024f, 0.0471088253f},
-std::array<float,2>{0.364336729f, 0.725396693f},
-std::array<float,2>{0.44260183f, 0.251463264f},
-std::array<float,2>{0.728102684f, 0.760129392f},
-std::array<float,2>{0.977198601f, 0.0907857046f},
-std::array<float,2>{0.218048081f, 0.629576325f},
-std::array<float,2>{0.0618414655f, 0.246832535f},
-std::array<float,2>{0.785219312f, 0.603571951f},
-std::array<float,2>{0.57700038f, 0.486829817f},
-std::array<float,2>{0.258670449f, 0.977190375f},
-std::array<float,2>{0.330229253f, 0.0242401082f},
-std::array<float,2>{0.555529177f, 0.696243346f},
-std::array<float,2>{0.854011476f, 0.373752087f},
-std::array<float,2>{0.124022827f, 0.848291814f},
-std::array<float,2>{0.129164562f, 0.40265134f},
-std::array<float,2>{0.8899436f, 0.896118104f},
-std::array<float,2>{0.663388014f, 0.16236195f},
-std::array<float,2>{0.423232913f, 0.512387037f},
-std::array<float,2>{0.420971394f, 0.411861181f},
-std::array<float,2>{0.685390413f, 0.935857415f},
-std::array<float,2>{0.903675139f, 0.155778199f},
-std::array<float,2>{0.148637906f, 0.558706105f},
-std::array<float,2>{0.0995853469f, 0.0452573448f},
-std::array<float,2>{0.862813711f, 0.734421372f},
-std::array<float,2>{0.534854531f, 0.335255295f},
-std::array<float,2>{0.325436026f, 0.817538559f},
-std::array<float,2>{0.27553755f, 0.21130459f},
-std::array<float,2>{0.589988828f, 0.570738792f},
-std::array<float,2>{0.812253475f, 0.458281577f},
-std::array<float,2>{0.0319907553f, 0.947237134f},
-std::array<float,2>{0.192847744f, 0.312069833f},
-std::array<float,2>{0.996682405f, 0.795447826f},
-std::array<float,2>{0.746585011f, 0.0996990129f},
-std::array<float,2>{0.457488507f, 0.669601023f},
-std::array<float,2>{0.355899096f, 0.356701761f},
-std::array<float,2>{0.511958003f, 0.871780694f},
-std::array<float,2>{0.836880147f, 0.0120231882f},
-std::array<float,2>{0.0683747903f, 0.71433419f},
-std::array<float,2>{0.182107285f, 0.17466338f},
-std::array<float,2>{0.915123403f, 0.524496853f},
-std::array<float,2>{0.628583074f, 0.376899332f},
-std::array<float,2>{0.396584183f, 0.880545914f},
-std::array<float,2>{0.475833476f, 0.0641264841f},
-std::array<float,2>{0.702477336f, 0.655559719f},
-std::array<float,2>{0.96310252f, 0.266840756f},
-std::array<float,2>{0.233838275f, 0.767565012f},
-std::array<float,2>{0.0294747539f, 0.469912708f},
-std::array<float,2>{0.768401384f, 0.987778544f},
-std::array<float,2>{0.602977037f, 0.223524213f},
-std::array<float,2>{0.285462528f, 0.62085247f},
-std::array<float,2>{0.354460955f, 0.440544009f},
-std::array<float,2>{0.508238137f, 0.955530047f},
-std::array<float,2>{0.841805637f, 0.199208036f},
-std::array<float,2>{0.0630896017f, 0.588569045f},
-std::array<float,2>{0.186370552f, 0.1143298f},
-std::array<float,2>{0.920073092f, 0.680438101f},
-std::array<float,2>{0.629327476f, 0.285217017f},
-std::array<float,2>{0.393569618f, 0.800204277f},
-std::array<float,2>{0.471713305f, 0.132101834f},
-std::array<float,2>{0.69713062f, 0.533825696f},
-std::array<float,2>{0.96676302f, 0.427065432f},
-std::array<float,2>{0.229763925f, 0.912925005f},
-std::array<float,2>{0.0251320936f, 0.32276386f},
-std::array<float,2>{0.769989133f, 0.838404775f},
-std::array<float,2>{0.6062451f, 0.061624106f},
-std::array<float,2>{0.281321794f, 0.732943535f},
-std::array<float,2>{0.41726777f, 0.261207134f},
-std::array<float,2>{0.68116647f, 0.752527773f},
-std::array<float,2>{0.899321377f, 0.0822082758f},
-std::array<float,2>{0.153038055f, 0.635983646f},
-std::array<float,2>{0.0959046781f, 0.238589615f},
-std::array<float,2>{0.866512835f, 0.596239269f},
-std::array<float,2>{0.537416697f, 0.496968597f},
-std::array<float,2>{0.321825504f, 0.971246839f},
-std::array<float,2>{0.278454304f, 0.0229588579f},
-std::array<float,2>{0.587914884f, 0.691215634f},
-std::array<float,2>{0.806469679f, 0.36303553f},
-std::array<float,2>{0.0381093472f, 0.856233358f},
-std::array<float,2>{0.190774739f, 0.395284086f},
-std::array<float,2>{0.992742717f, 0.902707756f},
-std::array<float,2>{0.74258852f, 0.168640435f},
-std::array<float,2>{0.453182966f, 0.506089509f},
-std::array<float,2>{0.438791096f, 0.420552939f},
-std::array<float,2>{0.732806981f, 0.921933651f},
-std::array<float,2>{0.98329109f, 0.148126736f},
-std::array<float,2>{0.212863967f, 0.550825179f},
-std::array<float,2>{0.0559935942f, 0.0329319686f},
-std::array<float,2>{0.781458259f, 0.749140203f},
-std::array<float,2>{0.572495937f, 0.341822147f},
-std::array<float,2>{0.261741728f, 0.825466275f},
-std::array<float,2>{0.333027422f, 0.208989725f},
-std::array<float,2>{0.561841011f, 0.564207971f},
-std::array<float,2>{0.855882406f, 0.461304486f},
-std::array<float,2>{0.119235292f, 0.940463245f},
-std::array<float,2>{0.126175791f, 0.298396021f},
-std::array<float,2>{0.883215904f, 0.781294167f},
-std::array<float,2>{0.657746077f, 0.10826724f},
-std::array<float,2>{0.428090185f, 0.660614073f},
-std::array<float,2>{0.300498188f, 0.34655112f},
-std::array<float,2>{0.622921646f, 0.860291064f},
-std::array<float,2>{0.756087959f, 0.00377959199f},
-std::array<float,2>{0.0105688358f, 0.710893035f},
-std::array<float,2>{0.244863778f, 0.181126207f},
-std::array<float,2>{0.951301754f, 0.516992807f},
-std::array<float,2>{0.708004832f, 0.387223423f},
-std::array<float,2>{0.492452592f, 0.883383632f},
-std::array<float,2>{0.389863074f, 0.0746081248f},
-std::array<float,2>{0.648235857f, 0.645029962f},
-std::array<float,2>{0.925958335f, 0.277845651f},
-std::array<float,2>{0.156298399f, 0.774645448f},
-std::array<float,2>{0.0836230144f, 0.483498037f},
-std::array<float,2>{0.827814817f, 0.996302485f},
-std::array<float,2>{0.523337722f, 0.231454745f},
-std::array<float,2>{0.362046987f, 0.616838217f},
-std::array<float,2>{0.254855722f, 0.380923957f},
-std::array<float,2>{0.56894809f, 0.875556886f},
-std::array<float,2>{0.794760168f, 0.178319395f},
-std::array<float,2>{0.0487547554f, 0.527783573f},
-std::array<float,2>{0.204336107f, 0.00954642426f},
-std::array<float,2>{0.976318896f, 0.714954793f},
-std::array<float,2>{0.722481191f, 0.353013098f},
-std::array<float,2>{0.450856775f, 0.870790362f},
-std::array<float,2>{0.42999953f, 0.221082911f},
-std::array<float,2>{0.670690536f, 0.623476446f},
-std::array<float,2>{0.880213916f, 0.473748773f},
-std::array<float,2>{0.138537228f, 0.988920152f},
-std::array<float,2>{0.110489585f, 0.27279526f},
-std::array<float,2>{0.849902928f, 0.769831359f},
-std::array<float,2>{0.550398052f, 0.0666604713f},
-std::array<float,2>{0.338006318f, 0.650387764f},
-std::array<float,2>{0.487011492f, 0.330360621f},
-std::array<float,2>{0.716236353f, 0.81586796f},
-std::array<float,2>{0.940044105f, 0.0394420214f},
-std::array<float,2>{0.234851316f, 0.740340173f},
-std::array<float,2>{0.00521717221f, 0.150094986f},
-std::array<float,2>{0.760574222f, 0.557840824f},
-std::array<float,2>{0.616475105f, 0.40903452f},
-std::array<float,2>{0.309881598f, 0.933048964f},
-std::array<float,2>{0.37362349f, 0.0973460823f},
-std::array<float,2>{0.530726075f, 0.665605605f},
-std::array<float,2>{0.820275545f, 0.307683885f},
-std::array<float,2>{0.0906341523f, 0.789387882f},
-std::array<float,2>{0.171141341f, 0.455713481f},
-std::array<float,2>{0.932791054f, 0.950516403f},
-std::array<float,2>{0.650885046f, 0.218197212f},
-std::array<float,2>{0.380018353f, 0.577494264f},
-std::array<float,2>{0.403057009f, 0.491004854f},
-std::array<float,2>{0.638744056f, 0.981651783f},
-std::array<float,2>{0.909450829f, 0.243160769f},
-std::array<float,2>{0.176010162f, 0.609053612f},
-std::array<float,2>{0.0714352429f, 0.088774018f},
-std::array<float,2>{0.829732001f, 0.628222942f},
-std::array<float,2>{0.505679011f, 0.254225791f},
-std::array<float,2>{0.345929861f, 0.762598097f},
-std::array<float,2>{0.296292752f, 0.160101771f},
-std::array<float,2>{0.601317465f, 0.508222461f},
-std::array<float,2>{0.780566037f, 0.400633454f},
-std::array<float,2>{0.0156367347f, 0.891508341f},
-std::array<float,2>{0.220930159f, 0.370557189f},
-std::array<float,2>{0.954994559f, 0.845509171f},
-std::array<float,2>{0.689787745f, 0.029702479f},
-std::array<float,2>{0.483616084f, 0.7005741f},
-std::array<float,2>{0.319822103f, 0.291434765f},
-std::array<float,2>{0.542061687f, 0.8094576f},
-std::array<float,2>{0.872137368f, 0.122979179f},
-std::array<float,2>{0.103071928f, 0.676578581f},
-std::array<float,2>{0.144277453f, 0.194967195f},
-std::array<float,2>{0.896250069f, 0.581925333f},
-std::array<float,2>{0.673233688f, 0.448151559f},
-std::array<float,2>{0.410483867f, 0.962498486f},
-std::array<float,2>{0.465682209f, 0.0514229126f},
-std::array<float,2>{0.740305901f, 0.720550895f},
-std::array<float,2>{0.991086423f, 0.317863554f},
-std::array<float,2>{0.198504537f, 0.829113305f},
-std::array<float,2>{0.0390661955f, 0.437416404f},
-std::array<float,2>{0.797137141f, 0.91564548f},
-std::array<float,2>{0.583258271f, 0.140222594f},
-std::array<float,2>{0.269510835f, 0.542212009f},
-std::array<float,2>{0.340273082f, 0.422865301f},
-std::array<float,2>{0.55166769f, 0.907017112f},
-std::array<float,2>{0.844801843f, 0.127385616f},
-std::array<float,2>{0.11554385f, 0.537126124f},
-std::array<float,2>{0.136628002f, 0.0559757464f},
-std::array<float,2>{0.877758503f, 0.727724671f},
-std::array<float,2>{0.666747749f, 0.326523572f},
-std::array<float,2>{0.435196221f, 0.841496885f},
-std::array<float,2>{0.447899491f, 0.200435385f},
-std::array<float,2>{0.723103702f, 0.590939283f},
-std::array<float,2>{0.968758225f, 0.443426698f},
-std::array<float,2>{0.210347906f, 0.95802021f},
-std::array<float,2>{0.0523741432f, 0.284444511f},
-std::array<float,2>{0.789085925f, 0.80147779f},
-std::array<float,2>{0.565221965f, 0.111625105f},
-std::array<float,2>{0.252906799f, 0.685861647f},
-std::array<float,2>{0.378305942f, 0.364409745f},
-std::array<float,2>{0.652842283f, 0.852663219f},
-std::array<float,2>{0.935470164f, 0.016450895f},
-std::array<float,2>{0.165916234f, 0.692424238f},
-std::array<float,2>{0.0880830809f, 0.165951803f},
-std::array<float,2>{0.814101338f, 0.502206564f},
-std::array<float,2>{0.525959432f, 0.391097575f},
-std::array<float,2>{0.369463772f, 0.899560034f},
-std::array<float,2>{0.307403535f, 0.0793293193f},
-std::array<float,2>{0.613232613f, 0.639705956f},
-std::array<float,2>{0.765580535f, 0.263625324f},
-std::array<float,2>{0.000931051211f, 0.754878879f},
-std::array<float,2>{0.241344452f, 0.493418545f},
-std::array<float,2>{0.943059206f, 0.975015759f},
-std::array<float,2>{0.711168826f, 0.237624511f},
-std::array<float,2>{0.490538329f, 0.600527942f},
-std::array<float,2>{0.478417575f, 0.468486041f},
-std::array<float,2>{0.691887558f, 0.941971362f},
-std::array<float,2>{0.957819045f, 0.206398308f},
-std::array<float,2>{0.226369366f, 0.569506586f},
-std::array<float,2>{0.0205441546f, 0.102816254f},
-std::array<float,2>{0.775623143f, 0.656506598f},
-std::array<float,2>{0.596131682f, 0.301892042f},
-std::array<float,2>{0.29179424f, 0.788287461f},
-std::array<float,2>{0.351097822f, 0.140706524f},
-std::array<float,2>{0.501451492f, 0.550705373f},
-std::array<float,2>{0.835387886f, 0.415375382f},
-std::array<float,2>{0.0754199773f, 0.928592384f},
-std::array<float,2>{0.172812358f, 0.338129491f},
-std::array<float,2>{0.910300612f, 0.82112807f},
-std::array<float,2>{0.634297013f, 0.0351842642f},
-std::array<float,2>{0.401307702f, 0.743087769f},
-std::array<float,2>{0.272512704f, 0.275601447f},
-std::array<float,2>{0.581327438f, 0.781242013f},
-std::array<float,2>{0.801789224f, 0.0712305158f},
-std::array<float,2>{0.0462881438f, 0.641365767f},
-std::array<float,2>{0.200495809f, 0.229418755f},
-std::array<float,2>{0.987428069f, 0.612755418f},
-std::array<float,2>{0.736047387f, 0.478238344f},
-std::array<float,2>{0.461389452f, 0.994334221f},
-std::array<float,2>{0.406891078f, 0.00487891957f},
-std::array<float,2>{0.676356852f, 0.705985606f},
-std::array<float,2>{0.892386198f, 0.351184934f},
-std::array<float,2>{0.145479769f, 0.864931703f},
-std::array<float,2>{0.108132839f, 0.386110872f},
-std::array<float,2>{0.869143248f, 0.889506161f},
-std::array<float,2>{0.544545114f, 0.184133142f},
-std::array<float,2>{0.314997911f, 0.520552099f},
-std::array<float,2>{0.286422759f, 0.472030729f},
-std::array<float,2>{0.602407932f, 0.984696984f},
-std::array<float,2>{0.768621385f, 0.22517097f},
-std::array<float,2>{0.0309789069f, 0.618091047f},
-std::array<float,2>{0.232838869f, 0.0655221716f},
-std::array<float,2>{0.964170456f, 0.652953923f},
-std::array<float,2>{0.701230884f, 0.268821776f},
-std::array<float,2>{0.474733829f, 0.769334972f},
-std::array<float,2>{0.397775143f, 0.173451006f},
-std::array<float,2>{0.627168238f, 0.527163088f},
-std::array<float,2>{0.914247811f, 0.378428489f},
-std::array<float,2>{0.183031574f, 0.881039679f},
-std::array<float,2>{0.0694429651f, 0.35822162f},
-std::array<float,2>{0.837669671f, 0.874966085f},
-std::array<float,2>{0.513273537f, 0.0142773464f},
-std::array<float,2>{0.357240349f, 0.712385118f},
-std::array<float,2>{0.458049357f, 0.309638083f},
-std::array<float,2>{0.747718036f, 0.794586778f},
-std::array<float,2>{0.998036206f, 0.0988573506f},
-std::array<float,2>{0.191432074f, 0.67157644f},
-std::array<float,2>{0.0323853865f, 0.214697659f},
-std::array<float,2>{0.811022818f, 0.572619617f},
-std::array<float,2>{0.591630995f, 0.459311604f},
-std::array<float,2>{0.277154744f, 0.947940588f},
-std::array<float,2>{0.324571282f, 0.0433787629f},
-std::array<float,2>{0.533694804f, 0.738140941f},
-std::array<float,2>{0.86184299f, 0.33292231f},
-std::array<float,2>{0.0980857462f, 0.818873823f},
-std::array<float,2>{0.15023458f, 0.413207084f},
-std::array<float,2>{0.902411342f, 0.934200048f},
-std::array<float,2>{0.683959484f, 0.154175565f},
-std::array<float,2>{0.420669824f, 0.560745895f},
-std::array<float,2>{0.422264367f, 0.405298084f},
-std::array<float,2>{0.662503719f, 0.898335934f},
-std::array<float,2>{0.889210105f, 0.161113232f},
-std::array<float,2>{0.129934251f, 0.514726102f},
-std::array<float,2>{0.124060988f, 0.0268346388f},
-std::array<float,2>{0.855240166f, 0.699031651f},
-std::array<float,2>{0.556392252f, 0.371934265f},
-std::array<float,2>{0.331118912f, 0.850634575f},
-std::array<float,2>{0.259494245f, 0.249468505f},
-std::array<float,2>{0.5771842f, 0.602480471f},
-std::array<float,2>{0.786218703f, 0.485007137f},
-std::array<float,2>{0.0610483624f, 0.978882968f},
-std::array<float,2>{0.217334256f, 0.252494186f},
-std::array<float,2>{0.977909982f, 0.758429945f},
-std::array<float,2>{0.72678864f, 0.0933310091f},
-std::array<float,2>{0.441470534f, 0.631158531f},
-std::array<float,2>{0.363979429f, 0.313841432f},
-std::array<float,2>{0.519324124f, 0.832475841f},
-std::array<float,2>{0.821185589f, 0.0506121144f},
-std::array<float,2>{0.0807271823f, 0.723952115f},
-std::array<float,2>{0.160534158f, 0.136445567f},
-std::array<float,2>{0.922627747f, 0.543434143f},
-std::array<float,2>{0.641985178f, 0.433219612f},
-std::array<float,2>{0.383445263f, 0.920055807f},
-std::array<float,2>{0.496771216f, 0.118613869f},
-std::array<float,2>{0.704590619f, 0.674548149f},
-std::array<float,2>{0.945801258f, 0.296184689f},
-std::array<float,2>{0.24776344f, 0.807632804f},
-std::array<float,2>{0.0126180397f, 0.45002678f},
-std::array<float,2>{0.750071228f, 0.966215074f},
-std::array<float,2>{0.621021986f, 0.188459814f},
-std::array<float,2>{0.304499328f, 0.583786309f},
-std::array<float,2>{0.323641896f, 0.499314934f},
-std::array<float,2>{0.536177993f, 0.968773961f},
-std::array<float,2>{0.863376677f, 0.240480363f},
-std::array<float,2>{0.0947163105f, 0.593952119f},
-std::array<float,2>{0.155176416f, 0.0847002119f},
-std::array<float,2>{0.901466131f, 0.633575082f},
-std::array<float,2>{0.681863785f, 0.259235024f},
-std::array<float,2>{0.415707737f, 0.750081837f},
-std::array<float,2>{0.456595153f, 0.171194732f},
-std::array<float,2>{0.745377779f, 0.504662633f},
-std::array<float,2>{0.995799959f, 0.398276359f},
-std::array<float,2>{0.188366443f, 0.906175017f},
-std::array<float,2>{0.0354965776f, 0.36060223f},
-std::array<float,2>{0.807847679f, 0.85907501f},
-std::array<float,2>{0.58677417f, 0.0204834733f},
-std::array<float,2>{0.279619992f, 0.688607812f},
-std::array<float,2>{0.392276257f, 0.288626045f},
-std::array<float,2>{0.631532252f, 0.79694593f},
-std::array<float,2>{0.91847688f, 0.117165685f},
-std::array<float,2>{0.184371725f, 0.683140635f},
-std::array<float,2>{0.0663245916f, 0.197019383f},
-std::array<float,2>{0.84045887f, 0.586152613f},
-std::array<float,2>{0.510145843f, 0.438233495f},
-std::array<float,2>{0.352544934f, 0.953241408f},
-std::array<float,2>{0.284166485f, 0.0590075627f},
-std::array<float,2>{0.608172894f, 0.730818987f},
-std::array<float,2>{0.772382557f, 0.320663065f},
-std::array<float,2>{0.0261204299f, 0.836906791f},
-std::array<float,2>{0.228470743f, 0.429073751f},
-std::array<float,2>{0.968071759f, 0.911455631f},
-std::array<float,2>{0.698024631f, 0.129060119f},
-std::array<float,2>{0.469120115f, 0.532524824f},
-std::array<float,2>{0.495268553f, 0.389317572f},
-std::array<float,2>{0.70963937f, 0.885939121f},
-std::array<float,2>{0.95070076f, 0.183357731f},
-std::array<float,2>{0.243487373f, 0.518232167f},
-std::array<float,2>{0.00878165662f, 0.000506884535f},
-std::array<float,2>{0.755061448f, 0.708367348f},
-std::array<float,2>{0.624974549f, 0.345241755f},
-std::array<float,2>{0.297192872f, 0.862856507f},
-std::array<float,2>{0.360644013f, 0.234253764f},
-std::array<float,2>{0.521373093f, 0.614621878f},
-std::array<float,2>{0.825271189f, 0.482402056f},
-std::array<float,2>{0.0845084861f, 0.998278558f},
-std::array<float,2>{0.159139127f, 0.279728234f},
-std::array<float,2>{0.927856207f, 0.776067257f},
-std::array<float,2>{0.646471858f, 0.0764678791f},
-std::array<float,2>{0.387846053f, 0.646956146f},
-std::array<float,2>{0.263755858f, 0.340727329f},
-std::array<float,2>{0.571448147f, 0.826625347f},
-std::array<float,2>{0.783775628f, 0.0335140713f},
-std::array<float,2>{0.0577930324f, 0.746767342f},
-std::array<float,2>{0.214428991f, 0.145347297f},
-std::array<float,2>{0.980917275f, 0.55275619f},
-std::array<float,2>{0.730550826f, 0.419325322f},
-std::array<float,2>{0.440614045f, 0.924918771f},
-std::array<float,2>{0.427014977f, 0.106708132f},
-std::array<float,2>{0.659417987f, 0.662627339f},
-std::array<float,2>{0.886202633f, 0.299169898f},
-std::array<float,2>{0.1284879f, 0.784148932f},
-std::array<float,2>{0.119025283f, 0.463954508f},
-std::array<float,2>{0.857506275f, 0.938964903f},
-std::array<float,2>{0.560419738f, 0.208582789f},
-std::array<float,2>{0.335522115f, 0.565906048f},
-std::array<float,2>{0.31163317f, 0.406995863f},
-std::array<float,2>{0.613505125f, 0.93147862f},
-std::array<float,2>{0.75785172f, 0.150524452f},
-std::array<float,2>{0.00717759412f, 0.555350065f},
-std::array<float,2>{0.237454921f, 0.0416210294f},
-std::array<float,2>{0.939237237f, 0.739384353f},
-std::array<float,2>{0.717903972f, 0.329062164f},
-std::array<float,2>{0.485295355f, 0.814311385f},
-std::array<float,2>{0.381417781f, 0.215383142f},
-std::array<float,2>{0.64996314f, 0.575591326f},
-std::array<float,2>{0.929692686f, 0.453973114f},
-std::array<float,2>{0.168124348f, 0.952720582f},
-std::array<float,2>{0.0936088264f, 0.306577712f},
-std::array<float,2>{0.818195343f, 0.791089416f},
-std::array<float,2>{0.528157949f, 0.0947310999f},
-std::array<float,2>{0.371207684f, 0.666633904f},
-std::array<float,2>{0.451541066f, 0.354984432f},
-std::array<float,2>{0.718812168f, 0.868740439f},
-std::array<float,2>{0.974286556f, 0.0112772956f},
-std::array<float,2>{0.206884682f, 0.718233645f},
-std::array<float,2>{0.0503650717f, 0.17671138f},
-std::array<float,2>{0.796503961f, 0.530161798f},
-std::array<float,2>{0.568242431f, 0.37958315f},
-std::array<float,2>{0.257030994f, 0.878599524f},
-std::array<float,2>{0.3359918f, 0.0686119124f},
-std::array<float,2>{0.548522115f, 0.650644422f},
-std::array<float,2>{0.847676635f, 0.269798994f},
-std::array<float,2>{0.111343443f, 0.772842288f},
-std::array<float,2>{0.139484733f, 0.476153731f},
-std::array<float,2>{0.882781982f, 0.991377532f},
-std::array<float,2>{0.668933213f, 0.220557451f},
-std::array<float,2>{0.432654381f, 0.622968316f},
-std::array<float,2>{0.412562847f, 0.447161973f},
-std::array<float,2>{0.6746611f, 0.964557111f},
-std::array<float,2>{0.896547794f, 0.19194968f},
-std::array<float,2>{0.141468555f, 0.578483045f},
-std::array<float,2>{0.105281778f, 0.123731002f},
-std::array<float,2>{0.874976873f, 0.67778635f},
-std::array<float,2>{0.539234281f, 0.290488034f},
-std::array<float,2>{0.316846609f, 0.811507106f},
-std::array<float,2>{0.266404063f, 0.137395471f},
-std::array<float,2>{0.58510083f, 0.539918959f},
-std::array<float,2>{0.800340235f, 0.43472749f},
-std::array<float,2>{0.0411590897f, 0.916840553f},
-std::array<float,2>{0.195429325f, 0.319589674f},
-std::array<float,2>{0.988504231f, 0.831732869f},
-std::array<float,2>{0.739019334f, 0.0530688912f},
-std::array<float,2>{0.467996806f, 0.721314847f},
-std::array<float,2>{0.344660133f, 0.257511884f},
-std::array<float,2>{0.50722003f, 0.764641523f},
-std::array<float,2>{0.830497086f, 0.0862820223f},
-std::array<float,2>{0.0728814676f, 0.626114309f},
-std::array<float,2>{0.179415196f, 0.245956868f},
-std::array<float,2>{0.906600475f, 0.606229484f},
-std::array<float,2>{0.638178885f, 0.490206212f},
-std::array<float,2>{0.405527771f, 0.984166384f},
-std::array<float,2>{0.481983811f, 0.0292495508f},
-std::array<float,2>{0.688934386f, 0.702710927f},
-std::array<float,2>{0.956229389f, 0.36892882f},
-std::array<float,2>{0.219831303f, 0.847350597f},
-std::array<float,2>{0.0187465623f, 0.398587197f},
-std::array<float,2>{0.777864218f, 0.89383781f},
-std::array<float,2>{0.599532962f, 0.157092154f},
-std::array<float,2>{0.294370353f, 0.509909332f},
-std::array<float,2>{0.36879912f, 0.394105822f},
-std::array<float,2>{0.524836659f, 0.9008165f},
-std::array<float,2>{0.814568937f, 0.16796191f},
-std::array<float,2>{0.0868592262f, 0.50195086f},
-std::array<float,2>{0.167143285f, 0.0181333292f},
-std::array<float,2>{0.93572247f, 0.694743097f},
-std::array<float,2>{0.655417323f, 0.365449816f},
-std::array<float,2>{0.376554728f, 0.854640782f},
-std::array<float,2>{0.488593549f, 0.235761702f},
-std::array<float,2>{0.713677645f, 0.598557413f},
-std::array<float,2>{0.94527328f, 0.494703174f},
-std::array<float,2>{0.238751143f, 0.974275887f},
-std::array<float,2>{0.00265407283f, 0.264452696f},
-std::array<float,2>{0.762250841f, 0.755892634f},
-std::array<float,2>{0.611192465f, 0.0802006871f},
-std::array<float,2>{0.306211621f, 0.636946082f},
-std::array<float,2>{0.436294883f, 0.326106399f},
-std::array<float,2>{0.664259791f, 0.842357814f},
-std::array<float,2>{0.875608563f, 0.0578495972f},
-std::array<float,2>{0.133865044f, 0.729609191f},
-std::array<float,2>{0.114343911f, 0.126077831f},
-std::array<float,2>{0.845853627f, 0.53624016f},
-std::array<float,2>{0.554153264f, 0.425383687f},
-std::array<float,2>{0.342342228f, 0.909224689f},
-std::array<float,2>{0.251143664f, 0.109713621f},
-std::array<float,2>{0.563675046f, 0.684686422f},
-std::array<float,2>{0.791363955f, 0.281848282f},
-std::array<float,2>{0.0536195524f, 0.804427743f},
-std::array<float,2>{0.207049742f, 0.442205489f},
-std::array<float,2>{0.971749902f, 0.96037221f},
-std::array<float,2>{0.726470172f, 0.203066394f},
-std::array<float,2>{0.446343899f, 0.593029797f},
-std::array<float,2>{0.46371147f, 0.478774488f},
-std::array<float,2>{0.737645209f, 0.992913544f},
-std::array<float,2>{0.984792292f, 0.227603719f},
-std::array<float,2>{0.202677414f, 0.610821903f},
-std::array<float,2>{0.0435262658f, 0.0730765313f},
-std::array<float,2>{0.803586185f, 0.642589092f},
-std::array<float,2>{0.578914464f, 0.27492696f},
-std::array<float,2>{0.26993826f, 0.779050708f},
-std::array<float,2>{0.312817156f, 0.186862901f},
-std::array<float,2>{0.545376658f, 0.52265799f},
-std::array<float,2>{0.867446303f, 0.38410759f},
-std::array<float,2>{0.106925912f, 0.888501287f},
-std::array<float,2>{0.1470626f, 0.348976344f},
-std::array<float,2>{0.893178463f, 0.866813838f},
-std::array<float,2>{0.678154647f, 0.0068129357f},
-std::array<float,2>{0.410039186f, 0.703783214f},
-std::array<float,2>{0.290762335f, 0.303373396f},
-std::array<float,2>{0.594253898f, 0.78604728f},
-std::array<float,2>{0.774180651f, 0.104338624f},
-std::array<float,2>{0.0223157611f, 0.659787238f},
-std::array<float,2>{0.223266855f, 0.20412904f},
-std::array<float,2>{0.960434854f, 0.566669583f},
-std::array<float,2>{0.694452047f, 0.466493666f},
-std::array<float,2>{0.479953974f, 0.943786323f},
-std::array<float,2>{0.399521172f, 0.0378112532f},
-std::array<float,2>{0.636112809f, 0.74501884f},
-std::array<float,2>{0.912864208f, 0.336406738f},
-std::array<float,2>{0.174641177f, 0.822430074f},
-std::array<float,2>{0.0769585818f, 0.416705728f},
-std::array<float,2>{0.833373666f, 0.926518977f},
-std::array<float,2>{0.503067613f, 0.143873423f},
-std::array<float,2>{0.348523319f, 0.548466146f},
-std::array<float,2>{0.273725539f, 0.45750767f},
-std::array<float,2>{0.593460262f, 0.945617735f},
-std::array<float,2>{0.808604419f, 0.212353349f},
-std::array<float,2>{0.034576185f, 0.571392894f},
-std::array<float,2>{0.194632813f, 0.101093814f},
-std::array<float,2>{0.998175442f, 0.66860503f},
-std::array<float,2>{0.748933017f, 0.310855657f},
-std::array<float,2>{0.459207624f, 0.796167731f},
-std::array<float,2>{0.418655485f, 0.154395431f},
-std::array<float,2>{0.68666321f, 0.560419559f},
-std::array<float,2>{0.904706538f, 0.410898596f},
-std::array<float,2>{0.152034864f, 0.93680042f},
-std::array<float,2>{0.100336626f, 0.334494025f},
-std::array<float,2>{0.859686852f, 0.817209184f},
-std::array<float,2>{0.53125453f, 0.0461694449f},
-std::array<float,2>{0.326994926f, 0.735410631f},
-std::array<float,2>{0.474181831f, 0.266192883f},
-std::array<float,2>{0.699615479f, 0.765873313f},
-std::array<float,2>{0.961107612f, 0.0633784533f},
-std::array<float,2>{0.231247529f, 0.654416144f},
-std::array<float,2>{0.0290481206f, 0.224493921f},
-std::array<float,2>{0.765660167f, 0.619522989f},
-std::array<float,2>{0.603976667f, 0.468969941f},
-std::array<float,2>{0.288892597f, 0.986348689f},
-std::array<float,2>{0.359060943f, 0.0129775563f},
-std::array<float,2>{0.514278769f, 0.713600993f},
-std::array<float,2>{0.838860571f, 0.356033564f},
-std::array<float,2>{0.0680657998f, 0.872258723f},
-std::array<float,2>{0.181208685f, 0.37594533f},
-std::array<float,2>{0.91734302f, 0.879628718f},
-std::array<float,2>{0.62551254f, 0.175010473f},
-std::array<float,2>{0.396014482f, 0.524263322f},
-std::array<float,2>{0.38515386f, 0.430264086f},
-std::array<float,2>{0.642699838f, 0.918110669f},
-std::array<float,2>{0.924200952f, 0.133396089f},
-std::array<float,2>{0.162702635f, 0.546135128f},
-std::array<float,2>{0.0799011365f, 0.0482979752f},
-std::array<float,2>{0.822941124f, 0.726074755f},
-std::array<float,2>{0.516761541f, 0.315949917f},
-std::array<float,2>{0.365982264f, 0.834753394f},
-std::array<float,2>{0.302144051f, 0.189685285f},
-std::array<float,2>{0.618533969f, 0.584808111f},
-std::array<float,2>{0.753139853f, 0.452306658f},
-std::array<float,2>{0.0137087898f, 0.968673408f},
-std::array<float,2>{0.248557046f, 0.293645114f},
-std::array<float,2>{0.948741019f, 0.805822134f},
-std::array<float,2>{0.706029177f, 0.120711058f},
-std::array<float,2>{0.499703795f, 0.673318863f},
-std::array<float,2>{0.328965008f, 0.374110281f},
-std::array<float,2>{0.558476508f, 0.848988354f},
-std::array<float,2>{0.851768434f, 0.0252175648f},
-std::array<float,2>{0.121864967f, 0.6971699f},
-std::array<float,2>{0.131012738f, 0.163676992f},
-std::array<float,2>{0.887239873f, 0.51344943f},
-std::array<float,2>{0.661645532f, 0.40424937f},
-std::array<float,2>{0.425007224f, 0.895481408f},
-std::array<float,2>{0.444379598f, 0.0912473723f},
-std::array<float,2>{0.730190992f, 0.630510032f},
-std::array<float,2>{0.97992897f, 0.250715792f},
-std::array<float,2>{0.215724885f, 0.761424661f},
-std::array<float,2>{0.0598252043f, 0.487715304f},
-std::array<float,2>{0.788563907f, 0.977587104f},
-std::array<float,2>{0.574282825f, 0.247873947f},
-std::array<float,2>{0.260163128f, 0.605319798f},
-std::array<float,2>{0.317290008f, 0.447409093f},
-std::array<float,2>{0.539964378f, 0.962233782f},
-std::array<float,2>{0.874395549f, 0.194508165f},
-std::array<float,2>{0.104558863f, 0.581518352f},
-std::array<float,2>{0.140656888f, 0.12252675f},
-std::array<float,2>{0.897015035f, 0.675958633f},
-std::array<float,2>{0.673989594f, 0.291816354f},
-std::array<float,2>{0.413004547f, 0.808792174f},
-std::array<float,2>{0.468299448f, 0.140063956f},
-std::array<float,2>{0.738340139f, 0.542670131f},
-std::array<float,2>{0.989254713f, 0.436692595f},
-std::array<float,2>{0.196264833f, 0.915334225f},
-std::array<float,2>{0.0415572412f, 0.31813097f},
-std::array<float,2>{0.799959838f, 0.82970053f},
-std::array<float,2>{0.585466266f, 0.0510449074f},
-std::array<float,2>{0.266104847f, 0.720172822f},
-std::array<float,2>{0.406197101f, 0.254550636f},
-std::array<float,2>{0.638194203f, 0.761967659f},
-std::array<float,2>{0.907060742f, 0.087946333f},
-std::array<float,2>{0.178888246f, 0.628519475f},
-std::array<float,2>{0.0725527555f, 0.242330849f},
-std::array<float,2>{0.830587387f, 0.60866183f},
-std::array<float,2>{0.50766474f, 0.490335315f},
-std::array<float,2>{0.343827039f, 0.982199013f},
-std::array<float,2>{0.294526875f, 0.0299933478f},
-std::array<float,2>{0.598738372f, 0.700769603f},
-std::array<float,2>{0.777564168f, 0.370884001f},
-std::array<float,2>{0.0194887314f, 0.845195353f},
-std::array<float,2>{0.220391497f, 0.40113768f},
-std::array<float,2>{0.956579328f, 0.890801907f},
-std::array<float,2>{0.689247012f, 0.159596935f},
-std::array<float,2>{0.481847107f, 0.508756042f},
-std::array<float,2>{0.484709829f, 0.408404857f},
-std::array<float,2>{0.718379021f, 0.933524787f},
-std::array<float,2>{0.93888551f, 0.14986521f},
-std::array<float,2>{0.238111779f, 0.558495343f},
-std::array<float,2>{0.00768187828f, 0.0397525877f},
-std::array<float,2>{0.758322179f, 0.74094522f},
-std::array<float,2>{0.613967359f, 0.330647618f},
-std::array<float,2>{0.312186927f, 0.816024482f},
-std::array<float,2>{0.371736526f, 0.218343794f},
-std::array<float,2>{0.527777314f, 0.577675998f},
-std::array<float,2>{0.81762892f, 0.455287069f},
-std::array<float,2>{0.0928041935f, 0.950757623f},
-std::array<float,2>{0.168489754f, 0.308299959f},
-std::array<float,2>{0.930255592f, 0.789762914f},
-std::array<float,2>{0.649761379f, 0.0967818201f},
-std::array<float,2>{0.380923361f, 0.665048242f},
-std::array<float,2>{0.25778079f, 0.353381753f},
-std::array<float,2>{0.567839921f, 0.870159984f},
-std::array<float,2>{0.796293795f, 0.00924496632f},
-std::array<float,2>{0.0501310043f, 0.715513647f},
-std::array<float,2>{0.2065005f, 0.177783027f},
-std::array<float,2>{0.974084973f, 0.528061748f},
-std::array<float,2>{0.719394207f, 0.38165307f},
-std::array<float,2>{0.45184207f, 0.875164628f},
-std::array<float,2>{0.433208555f, 0.0673049688f},
-std::array<float,2>{0.668305039f, 0.649748325f},
-std::array<float,2>{0.881932616f, 0.273256212f},
-std::array<float,2>{0.138960645f, 0.770488381f},
-std::array<float,2>{0.112077899f, 0.47420752f},
-std::array<float,2>{0.848196149f, 0.988728642f},
-std::array<float,2>{0.54825294f, 0.22126849f},
-std::array<float,2>{0.336639553f, 0.623814583f},
-std::array<float,2>{0.297419488f, 0.387078941f},
-std::array<float,2>{0.624200344f, 0.882888317f},
-std::array<float,2>{0.755752504f, 0.18160975f},
-std::array<float,2>{0.00825715158f, 0.517135143f},
-std::array<float,2>{0.244024023f, 0.00338593521f},
-std::array<float,2>{0.950374901f, 0.71023196f},
-std::array<float,2>{0.709030211f, 0.346072197f},
-std::array<float,2>{0.495682299f, 0.859840095f},
-std::array<float,2>{0.388391346f, 0.231991678f},
-std::array<float,2>{0.645909369f, 0.616551816f},
-std::array<float,2>{0.928615689f, 0.484268546f},
-std::array<float,2>{0.158371165f, 0.996866107f},
-std::array<float,2>{0.0842185393f, 0.277579457f},
-std::array<float,2>{0.825802028f, 0.775027156f},
-std::array<float,2>{0.520793617f, 0.0750947148f},
-std::array<float,2>{0.361095488f, 0.644890785f},
-std::array<float,2>{0.441358507f, 0.342347354f},
-std::array<float,2>{0.731249392f, 0.825891376f},
-std::array<float,2>{0.981091142f, 0.032381326f},
-std::array<float,2>{0.213977814f, 0.749967694f},
-std::array<float,2>{0.0582347549f, 0.147731096f},
-std::array<float,2>{0.783211887f, 0.551294148f},
-std::array<float,2>{0.571932316f, 0.41994372f},
-std::array<float,2>{0.264258474f, 0.922720492f},
-std::array<float,2>{0.335354716f, 0.107757375f},
-std::array<float,2>{0.559940875f, 0.660841882f},
-std::array<float,2>{0.858135581f, 0.298042029f},
-std::array<float,2>{0.1183706f, 0.782013893f},
-std::array<float,2>{0.128116429f, 0.46145308f},
-std::array<float,2>{0.88624531f, 0.941092908f},
-std::array<float,2>{0.660013378f, 0.209757835f},
-std::array<float,2>{0.427705377f, 0.56350404f},
-std::array<float,2>{0.415338099f, 0.496217549f},
-std::array<float,2>{0.682499707f, 0.970892608f},
-std::array<float,2>{0.901996076f, 0.239086315f},
-std::array<float,2>{0.154345155f, 0.596189559f},
-std::array<float,2>{0.0939308256f, 0.0827694014f},
-std::array<float,2>{0.863861024f, 0.636624634f},
-std::array<float,2>{0.536689758f, 0.261270761f},
-std::array<float,2>{0.323805749f, 0.752071142f},
-std::array<float,2>{0.280156374f, 0.168389723f},
-std::array<float,2>{0.586152792f, 0.506401658f},
-std::array<float,2>{0.808468223f, 0.394825071f},
-std::array<float,2>{0.036102023f, 0.90294522f},
-std::array<float,2>{0.187788248f, 0.362531364f},
-std::array<float,2>{0.995250881f, 0.85564357f},
-std::array<float,2>{0.745708168f, 0.0226133391f},
-std::array<float,2>{0.45619601f, 0.690610826f},
-std::array<float,2>{0.353288382f, 0.285752743f},
-std::array<float,2>{0.510406315f, 0.800753474f},
-std::array<float,2>{0.839895606f, 0.115012534f},
-std::array<float,2>{0.0655904338f, 0.679787576f},
-std::array<float,2>{0.183797181f, 0.198373631f},
-std::array<float,2>{0.917980909f, 0.588355899f},
-std::array<float,2>{0.631136239f, 0.441322774f},
-std::array<float,2>{0.391762227f, 0.955634177f},
-std::array<float,2>{0.469540685f, 0.0620937906f},
-std::array<float,2>{0.697633505f, 0.732606292f},
-std::array<float,2>{0.968473375f, 0.322681218f},
-std::array<float,2>{0.227996856f, 0.837931275f},
-std::array<float,2>{0.0258570593f, 0.427402556f},
-std::array<float,2>{0.771780312f, 0.912463367f},
-std::array<float,2>{0.607795537f, 0.132773712f},
-std::array<float,2>{0.283459991f, 0.533265054f},
-std::array<float,2>{0.365646452f, 0.432851642f},
-std::array<float,2>{0.517456532f, 0.920728505f},
-std::array<float,2>{0.822419167f, 0.136059731f},
-std::array<float,2>{0.0791919976f, 0.543829143f},
-std::array<float,2>{0.162529498f, 0.0501385331f},
-std::array<float,2>{0.924608946f, 0.724451602f},
-std::array<float,2>{0.643337488f, 0.314220548f},
-std::array<float,2>{0.385705322f, 0.83296442f},
-std::array<float,2>{0.499437213f, 0.187703952f},
-std::array<float,2>{0.705284715f, 0.583046675f},
-std::array<float,2>{0.948618352f, 0.449703425f},
-std::array<float,2>{0.24833104f, 0.966328144f},
-std::array<float,2>{0.0144884428f, 0.296812594f},
-std::array<float,2>{0.753585696f, 0.808362365f},
-std::array<float,2>{0.618986487f, 0.119028553f},
-std::array<float,2>{0.302359551f, 0.673856735f},
-std::array<float,2>{0.425759405f, 0.371205717f},
-std::array<float,2>{0.66159004f, 0.851200819f},
-std::array<float,2>{0.887203217f, 0.0270647984f},
-std::array<float,2>{0.131512225f, 0.698455334f},
-std::array<float,2>{0.121551976f, 0.160228774f},
-std::array<float,2>{0.852093995f, 0.515349567f},
-std::array<float,2>{0.557907522f, 0.406103104f},
-std::array<float,2>{0.328153402f, 0.897556543f},
-std::array<float,2>{0.260645151f, 0.0929950923f},
-std::array<float,2>{0.574915648f, 0.631832421f},
-std::array<float,2>{0.788593113f, 0.252336234f},
-std::array<float,2>{0.0600918755f, 0.75806582f},
-std::array<float,2>{0.21525161f, 0.484769166f},
-std::array<float,2>{0.980349958f, 0.979279578f},
-std::array<float,2>{0.729672909f, 0.249781817f},
-std::array<float,2>{0.445140988f, 0.601633251f},
-std::array<float,2>{0.459954888f, 0.459847659f},
-std::array<float,2>{0.748285592f, 0.947445095f},
-std::array<float,2>{0.998920441f, 0.214256987f},
-std::array<float,2>{0.195237607f, 0.573137343f},
-std::array<float,2>{0.0350751244f, 0.0994628742f},
-std::array<float,2>{0.80909121f, 0.67113328f},
-std::array<float,2>{0.593207061f, 0.310428202f},
-std::array<float,2>{0.27433905f, 0.794172645f},
-std::array<float,2>{0.326325417f, 0.153562918f},
-std::array<float,2>{0.531815171f, 0.561393142f},
-std::array<float,2>{0.860253572f, 0.413736075f},
-std::array<float,2>{0.0999938101f, 0.933997393f},
-std::array<float,2>{0.151850954f, 0.332259029f},
-std::array<float,2>{0.905094802f, 0.818789721f},
-std::array<float,2>{0.687054276f, 0.0436325818f},
-std::array<float,2>{0.418077677f, 0.737479806f},
-std::array<float,2>{0.288405001f, 0.269418776f},
-std::array<float,2>{0.604134679f, 0.768557906f},
-std::array<float,2>{0.766462862f, 0.0661803782f},
-std::array<float,2>{0.0283427555f, 0.652493715f},
-std::array<float,2>{0.230659381f, 0.225047678f},
-std::array<float,2>{0.961765885f, 0.617390931f},
-std::array<float,2>{0.700089812f, 0.472203106f},
-std::array<float,2>{0.473984629f, 0.985134363f},
-std::array<float,2>{0.395877481f, 0.0140509233f},
-std::array<float,2>{0.625077844f, 0.712654471f},
-std::array<float,2>{0.917718709f, 0.357873827f},
-std::array<float,2>{0.181076318f, 0.874032021f},
-std::array<float,2>{0.0677126572f, 0.378094554f},
-std::array<float,2>{0.837906778f, 0.881633639f},
-std::array<float,2>{0.514092684f, 0.172970071f},
-std::array<float,2>{0.358688802f, 0.526651621f},
-std::array<float,2>{0.270391673f, 0.477589846f},
-std::array<float,2>{0.578290701f, 0.994993567f},
-std::array<float,2>{0.802862287f, 0.228553742f},
-std::array<float,2>{0.0432035141f, 0.613096178f},
-std::array<float,2>{0.202164635f, 0.0704385564f},
-std::array<float,2>{0.985088289f, 0.640641809f},
-std::array<float,2>{0.737872362f, 0.275959671f},
-std::array<float,2>{0.462973565f, 0.780454576f},
-std::array<float,2>{0.409460276f, 0.183951885f},
-std::array<float,2>{0.678635776f, 0.52146095f},
-std::array<float,2>{0.89261359f, 0.386275321f},
-std::array<float,2>{0.146677166f, 0.889135897f},
-std::array<float,2>{0.107308291f, 0.350739449f},
-std::array<float,2>{0.867732882f, 0.864692926f},
-std::array<float,2>{0.545680225f, 0.00430585723f},
-std::array<float,2>{0.313399941f, 0.705228984f},
-std::array<float,2>{0.480442435f, 0.302725166f},
-std::array<float,2>{0.695143938f, 0.788685501f},
-std::array<float,2>{0.96085602f, 0.103032187f},
-std::array<float,2>{0.222815558f, 0.656812012f},
-std::array<float,2>{0.0218093079f, 0.206799239f},
-std::array<float,2>{0.773693383f, 0.569878757f},
-std::array<float,2>{0.593947768f, 0.468086123f},
-std::array<float,2>{0.290119976f, 0.941813886f},
-std::array<float,2>{0.348044962f, 0.0358025879f},
-std::array<float,2>{0.503884077f, 0.742350221f},
-std::array<float,2>{0.8337484f, 0.338488042f},
-std::array<float,2>{0.076239571f, 0.820688665f},
-std::array<float,2>{0.174263477f, 0.415811419f},
-std::array<float,2>{0.912490427f, 0.927989125f},
-std::array<float,2>{0.636557043f, 0.141153961f},
-std::array<float,2>{0.40000543f, 0.550219893f},
-std::array<float,2>{0.376322776f, 0.391374111f},
-std::array<float,2>{0.655781448f, 0.900213063f},
-std::array<float,2>{0.936077952f, 0.165304422f},
-std::array<float,2>{0.167567089f, 0.502724171f},
-std::array<float,2>{0.0864168927f, 0.0157141536f},
-std::array<float,2>{0.815002143f, 0.693216085f},
-std::array<float,2>{0.525025249f, 0.364770025f},
-std::array<float,2>{0.368492693f, 0.853279352f},
-std::array<float,2>{0.306138664f, 0.238163933f},
-std::array<float,2>{0.610397041f, 0.599707484f},
-std::array<float,2>{0.761870921f, 0.493809819f},
-std::array<float,2>{0.0019991952f, 0.975177765f},
-std::array<float,2>{0.238811061f, 0.26313141f},
-std::array<float,2>{0.944541454f, 0.754109919f},
-std::array<float,2>{0.7132743f, 0.0799003467f},
-std::array<float,2>{0.48882243f, 0.640361488f},
-std::array<float,2>{0.342121154f, 0.326666176f},
-std::array<float,2>{0.554529727f, 0.840900064f},
-std::array<float,2>{0.846642077f, 0.0561756678f},
-std::array<float,2>{0.115148418f, 0.728336036f},
-std::array<float,2>{0.134412259f, 0.127717942f},
-std::array<float,2>{0.875082791f, 0.537637472f},
-std::array<float,2>{0.664977789f, 0.42379275f},
-std::array<float,2>{0.435733795f, 0.906716645f},
-std::array<float,2>{0.447103351f, 0.112080954f},
-std::array<float,2>{0.726065516f, 0.68644613f},
-std::array<float,2>{0.972411394f, 0.284879118f},
-std::array<float,2>{0.207928315f, 0.800882041f},
-std::array<float,2>{0.0529680699f, 0.443959862f},
-std::array<float,2>{0.791611016f, 0.958665431f},
-std::array<float,2>{0.564178526f, 0.200847775f},
-std::array<float,2>{0.251540303f, 0.591324091f},
-std::array<float,2>{0.346645594f, 0.489497215f},
-std::array<float,2>{0.505261362f, 0.983864725f},
-std::array<float,2>{0.829496384f, 0.245385259f},
-std::array<float,2>{0.0721401498f, 0.605745316f},
-std::array<float,2>{0.176755488f, 0.0865478143f},
-std::array<float,2>{0.9097597f, 0.626724303f},
-std::array<float,2>{0.639600456f, 0.256936997f},
-std::array<float,2>{0.402485281f, 0.763780117f},
-std::array<float,2>{0.484090984f, 0.156398013f},
-std::array<float,2>{0.690197766f, 0.510321796f},
-std::array<float,2>{0.954148889f, 0.399355769f},
-std::array<float,2>{0.221440777f, 0.894461572f},
-std::array<float,2>{0.0163709167f, 0.368371248f},
-std::array<float,2>{0.780939221f, 0.847017407f},
-std::array<float,2>{0.600812912f, 0.0285359696f},
-std::array<float,2>{0.296669096f, 0.702271461f},
-std::array<float,2>{0.410678029f, 0.290636837f},
-std::array<float,2>{0.673454404f, 0.810885012f},
-std::array<float,2>{0.895773828f, 0.12332318f},
-std::array<float,2>{0.144013226f, 0.678550482f},
-std::array<float,2>{0.102738477f, 0.191812113f},
-std::array<float,2>{0.872713268f, 0.578968048f},
-std::array<float,2>{0.542901874f, 0.446419805f},
-std::array<float,2>{0.320260376f, 0.964332104f},
-std::array<float,2>{0.268724948f, 0.0533642471f},
-std::array<float,2>{0.58384496f, 0.720948875f},
-std::array<float,2>{0.797602057f, 0.320205092f},
-std::array<float,2>{0.0398395211f, 0.831158817f},
-std::array<float,2>{0.198969841f, 0.435156345f},
-std::array<float,2>{0.990495145f, 0.916281939f},
-std::array<float,2>{0.741008699f, 0.137155682f},
-std::array<float,2>{0.465071172f, 0.539511621f},
-std::array<float,2>{0.450579643f, 0.3789123f},
-std::array<float,2>{0.722018361f, 0.878120542f},
-std::array<float,2>{0.97577554f, 0.176107287f},
-std::array<float,2>{0.204665214f, 0.529430687f},
-std::array<float,2>{0.0482926033f, 0.0111051844f},
-std::array<float,2>{0.794306934f, 0.718724608f},
-std::array<float,2>{0.568367124f, 0.354696959f},
-std::array<float,2>{0.254142433f, 0.868247449f},
-std::array<float,2>{0.33872056f, 0.219770789f},
-std::array<float,2>{0.550292671f, 0.622542143f},
-std::array<float,2>{0.850143075f, 0.475598752f},
-std::array<float,2>{0.110871822f, 0.992096245f},
-std::array<float,2>{0.137922719f, 0.27026394f},
-std::array<float,2>{0.880765796f, 0.773396075f},
-std::array<float,2>{0.670106649f, 0.0691923127f},
-std::array<float,2>{0.430225164f, 0.651104212f},
-std::array<float,2>{0.31019637f, 0.328420371f},
-std::array<float,2>{0.617105782f, 0.813833416f},
-std::array<float,2>{0.760021031f, 0.0411955006f},
-std::array<float,2>{0.00540080993f, 0.74019289f},
-std::array<float,2>{0.235147268f, 0.150994956f},
-std::array<float,2>{0.939636052f, 0.555147588f},
-std::array<float,2>{0.716678321f, 0.406321585f},
-std::array<float,2>{0.486391187f, 0.930998802f},
-std::array<float,2>{0.380569488f, 0.0954329073f},
-std::array<float,2>{0.650853753f, 0.666084349f},
-std::array<float,2>{0.933506131f, 0.305755377f},
-std::array<float,2>{0.171561852f, 0.791709006f},
-std::array<float,2>{0.0901364312f, 0.453546643f},
-std::array<float,2>{0.819413304f, 0.952294052f},
-std::array<float,2>{0.531044006f, 0.215258524f},
-std::array<float,2>{0.373152435f, 0.575914323f},
-std::array<float,2>{0.262562692f, 0.419887841f},
-std::array<float,2>{0.572910964f, 0.925746202f},
-std::array<float,2>{0.781881928f, 0.144785911f},
-std::array<float,2>{0.0565628f, 0.553589106f},
-std::array<float,2>{0.212331966f, 0.0338371843f},
-std::array<float,2>{0.982766032f, 0.746571839f},
-std::array<float,2>{0.73294729f, 0.340051323f},
-std::array<float,2>{0.43928197f, 0.826833963f},
-std::array<float,2>{0.428640813f, 0.208080083f},
-std::array<float,2>{0.657384574f, 0.56607312f},
-std::array<float,2>{0.883623719f, 0.464359552f},
-std::array<float,2>{0.126792878f, 0.938869715f},
-std::array<float,2>{0.11987552f, 0.29942888f},
-std::array<float,2>{0.856232941f, 0.783599019f},
-std::array<float,2>{0.562247455f, 0.107357487f},
-std::array<float,2>{0.333679765f, 0.662411869f},
-std::array<float,2>{0.493068308f, 0.345162064f},
-std::array<float,2>{0.707439244f, 0.862583637f},
-std::array<float,2>{0.951911747f, 0.000459553237f},
-std::array<float,2>{0.244349509f, 0.708764672f},
-std::array<float,2>{0.010030305f, 0.182770163f},
-std::array<float,2>{0.756504774f, 0.517944455f},
-std::array<float,2>{0.622469306f, 0.389113605f},
-std::array<float,2>{0.299828321f, 0.886635303f},
-std::array<float,2>{0.361687541f, 0.0769379884f},
-std::array<float,2>{0.522948325f, 0.647180319f},
-std::array<float,2>{0.827357411f, 0.279852808f},
-std::array<float,2>{0.0832879841f, 0.775532961f},
-std::array<float,2>{0.156896755f, 0.481921971f},
-std::array<float,2>{0.926334739f, 0.998764217f},
-std::array<float,2>{0.647492945f, 0.233568311f},
-std::array<float,2>{0.390556186f, 0.614767253f},
-std::array<float,2>{0.394136786f, 0.437712222f},
-std::array<float,2>{0.629553795f, 0.95384413f},
-std::array<float,2>{0.920619071f, 0.196370319f},
-std::array<float,2>{0.185875565f, 0.586456299f},
-std::array<float,2>{0.0629879162f, 0.116593719f},
-std::array<float,2>{0.842295825f, 0.683089256f},
-std::array<float,2>{0.50851661f, 0.288110197f},
-std::array<float,2>{0.353733391f, 0.797395349f},
-std::array<float,2>{0.282041609f, 0.129759997f},
-std::array<float,2>{0.605687797f, 0.532991648f},
-std::array<float,2>{0.770404816f, 0.429390073f},
-std::array<float,2>{0.0244655497f, 0.912108839f},
-std::array<float,2>{0.230361357f, 0.321253031f},
-std::array<float,2>{0.966300845f, 0.835996389f},
-std::array<float,2>{0.69667691f, 0.059412621f},
-std::array<float,2>{0.472548693f, 0.731248319f},
-std::array<float,2>{0.321301609f, 0.259706169f},
-std::array<float,2>{0.537599504f, 0.750490308f},
-std::array<float,2>{0.867051482f, 0.0841642693f},
-std::array<float,2>{0.0964528546f, 0.633215785f},
-std::array<float,2>{0.152449206f, 0.240853965f},
-std::array<float,2>{0.898873389f, 0.59456706f},
-std::array<float,2>{0.680698156f, 0.499974817f},
-std::array<float,2>{0.417623281f, 0.969661176f},
-std::array<float,2>{0.453771859f, 0.0197802577f},
-std::array<float,2>{0.742945731f, 0.688987136f},
-std::array<float,2>{0.992305219f, 0.360898882f},
-std::array<float,2>{0.190919876f, 0.8587026f},
-std::array<float,2>{0.0390300192f, 0.397861928f},
-std::array<float,2>{0.805843413f, 0.905742645f},
-std::array<float,2>{0.588445604f, 0.171452761f},
-std::array<float,2>{0.27902481f, 0.504277706f},
-std::array<float,2>{0.332009673f, 0.403434098f},
-std::array<float,2>{0.55603075f, 0.89475739f},
-std::array<float,2>{0.854866862f, 0.163414538f},
-std::array<float,2>{0.12478859f, 0.512780607f},
-std::array<float,2>{0.130673781f, 0.0248532239f},
-std::array<float,2>{0.889063418f, 0.696676731f},
-std::array<float,2>{0.662796438f, 0.374860168f},
-std::array<float,2>{0.422504812f, 0.849208176f},
-std::array<float,2>{0.442231864f, 0.247360274f},
-std::array<float,2>{0.727261841f, 0.604554474f},
-std::array<float,2>{0.978381693f, 0.488088608f},
-std::array<float,2>{0.217033342f, 0.978264272f},
-std::array<float,2>{0.061009407f, 0.250023603f},
-std::array<float,2>{0.786998272f, 0.760754943f},
-std::array<float,2>{0.577720046f, 0.0917211846f},
-std::array<float,2>{0.258802116f, 0.630093157f},
-std::array<float,2>{0.383209586f, 0.315484107f},
-std::array<float,2>{0.642223179f, 0.834375203f},
-std::array<float,2>{0.921925187f, 0.0483731702f},
-std::array<float,2>{0.160950154f, 0.725786626f},
-std::array<float,2>{0.0801850185f, 0.133101091f},
-std::array<float,2>{0.820549965f, 0.546843112f},
-std::array<float,2>{0.518654287f, 0.429965258f},
-std::array<float,2>{0.363306224f, 0.918582082f},
-std::array<float,2>{0.303969145f, 0.120583884f},
-std::array<float,2>{0.620254517f, 0.673376024f},
-std::array<float,2>{0.750690341f, 0.293295711f},
-std::array<float,2>{0.0117772445f, 0.806347728f},
-std::array<float,2>{0.247113481f, 0.453068465f},
-std::array<float,2>{0.945701599f, 0.96824497f},
-std::array<float,2>{0.704456568f, 0.189974934f},
-std::array<float,2>{0.496401668f, 0.584458649f},
-std::array<float,2>{0.475413203f, 0.469651103f},
-std::array<float,2>{0.701934218f, 0.987167597f},
-std::array<float,2>{0.964446783f, 0.223708674f},
-std::array<float,2>{0.233082607f, 0.620060623f},
-std::array<float,2>{0.0306297708f, 0.0627541915f},
-std::array<float,2>{0.769181013f, 0.655171514f},
-std::array<float,2>{0.601635695f, 0.265737087f},
-std::array<float,2>{0.286912113f, 0.766314149f},
-std::array<float,2>{0.356702358f, 0.175396189f},
-std::array<float,2>{0.512782931f, 0.523507774f},
-std::array<float,2>{0.837336063f, 0.375331789f},
-std::array<float,2>{0.0698853657f, 0.879081309f},
-std::array<float,2>{0.183400467f, 0.355550885f},
-std::array<float,2>{0.914875209f, 0.872764468f},
-std::array<float,2>{0.627814233f, 0.0135301528f},
-std::array<float,2>{0.398318648f, 0.713300765f},
-std::array<float,2>{0.276458412f, 0.311242014f},
-std::array<float,2>{0.590883434f, 0.796847761f},
-std::array<float,2>{0.81108892f, 0.100971073f},
-std::array<float,2>{0.0330050252f, 0.668096781f},
-std::array<float,2>{0.191967577f, 0.212811485f},
-std::array<float,2>{0.997430623f, 0.572009444f},
-std::array<float,2>{0.747104883f, 0.457618743f},
-std::array<float,2>{0.458620846f, 0.945935905f},
-std::array<float,2>{0.420139998f, 0.0465088375f},
-std::array<float,2>{0.684464514f, 0.736090541f},
-std::array<float,2>{0.903273165f, 0.334166646f},
-std::array<float,2>{0.149438113f, 0.816655219f},
-std::array<float,2>{0.0985981077f, 0.410472035f},
-std::array<float,2>{0.861719847f, 0.937422931f},
-std::array<float,2>{0.533477604f, 0.155036867f},
-std::array<float,2>{0.325163662f, 0.559581578f},
-std::array<float,2>{0.2911008f, 0.465999991f},
-std::array<float,2>{0.596601069f, 0.944106638f},
-std::array<float,2>{0.776201725f, 0.204905704f},
-std::array<float,2>{0.0211546477f, 0.567299247f},
-std::array<float,2>{0.225730225f, 0.103555769f},
-std::array<float,2>{0.957235634f, 0.659631014f},
-std::array<float,2>{0.69207263f, 0.303117186f},
-std::array<float,2>{0.477798134f, 0.785229087f},
-std::array<float,2>{0.400484651f, 0.144490078f},
-std::array<float,2>{0.63410455f, 0.54809612f},
-std::array<float,2>{0.911015511f, 0.416095614f},
-std::array<float,2>{0.172151551f, 0.926226079f},
-std::array<float,2>{0.0756875575f, 0.336637259f},
-std::array<float,2>{0.835648954f, 0.822909296f},
-std::array<float,2>{0.501565218f, 0.0375519544f},
-std::array<float,2>{0.350663751f, 0.744386494f},
-std::array<float,2>{0.461569071f, 0.27456516f},
-std::array<float,2>{0.735404074f, 0.778508306f},
-std::array<float,2>{0.98796916f, 0.0725101456f},
-std::array<float,2>{0.200717092f, 0.643364966f},
-std::array<float,2>{0.0466537364f, 0.228130192f},
-std::array<float,2>{0.802393854f, 0.61088419f},
-std::array<float,2>{0.582021177f, 0.479039222f},
-std::array<float,2>{0.273157239f, 0.992453814f},
-std::array<float,2>{0.314817369f, 0.00601951825f},
-std::array<float,2>{0.544111311f, 0.70332402f},
-std::array<float,2>{0.870086849f, 0.349196553f},
-std::array<float,2>{0.107840739f, 0.866379559f},
-std::array<float,2>{0.144603923f, 0.384500146f},
-std::array<float,2>{0.892014802f, 0.888172686f},
-std::array<float,2>{0.676168144f, 0.187406898f},
-std::array<float,2>{0.406389296f, 0.52303046f},
-std::array<float,2>{0.434848607f, 0.425130248f},
-std::array<float,2>{0.666412473f, 0.909968853f},
-std::array<float,2>{0.877400517f, 0.126683012f},
-std::array<float,2>{0.135865271f, 0.536876678f},
-std::array<float,2>{0.115914606f, 0.0581332929f},
-std::array<float,2>{0.845410287f, 0.730303824f},
-std::array<float,2>{0.551234305f, 0.32528159f},
-std::array<float,2>{0.340706259f, 0.842162728f},
-std::array<float,2>{0.252255976f, 0.202611238f},
-std::array<float,2>{0.564801991f, 0.593604088f},
-std::array<float,2>{0.790038288f, 0.441717386f},
-std::array<float,2>{0.0518380515f, 0.960674822f},
-std::array<float,2>{0.210514739f, 0.281643629f},
-std::array<float,2>{0.969319761f, 0.80404985f},
-std::array<float,2>{0.723525524f, 0.110149264f},
-std::array<float,2>{0.447343767f, 0.685179174f},
-std::array<float,2>{0.369632453f, 0.365931839f},
-std::array<float,2>{0.525516689f, 0.855182469f},
-std::array<float,2>{0.813823879f, 0.0178552698f},
-std::array<float,2>{0.0885809213f, 0.694926381f},
-std::array<float,2>{0.165428787f, 0.167064443f},
-std::array<float,2>{0.93471837f, 0.501342893f},
-std::array<float,2>{0.652581275f, 0.393832743f},
-std::array<float,2>{0.378783822f, 0.901030898f},
-std::array<float,2>{0.491045743f, 0.0807965025f},
-std::array<float,2>{0.711705506f, 0.637316823f},
-std::array<float,2>{0.942753196f, 0.263739765f},
-std::array<float,2>{0.242002204f, 0.756425679f},
-std::array<float,2>{0.000463157514f, 0.494490743f},
-std::array<float,2>{0.764885843f, 0.973973691f},
-std::array<float,2>{0.612552524f, 0.235856265f},
-std::array<float,2>{0.3069098f, 0.597873449f},
-std::array<float,2>{0.374448746f, 0.457008541f},
-std::array<float,2>{0.529297531f, 0.950004935f},
-std::array<float,2>{0.818562448f, 0.217351943f},
-std::array<float,2>{0.0915438607f, 0.577018142f},
-std::array<float,2>{0.170030743f, 0.0965597108f},
-std::array<float,2>{0.932267725f, 0.664439619f},
-std::array<float,2>{0.651383996f, 0.307547241f},
-std::array<float,2>{0.379170895f, 0.790490806f},
-std::array<float,2>{0.48799938f, 0.148538202f},
-std::array<float,2>{0.715255797f, 0.556715608f},
-std::array<float,2>{0.940985858f, 0.410044014f},
-std::array<float,2>{0.236064777f, 0.931753993f},
-std::array<float,2>{0.00478481175f, 0.331323236f},
-std::array<float,2>{0.761092305f, 0.814749718f},
-std::array<float,2>{0.615850806f, 0.0401430279f},
-std::array<float,2>{0.309345812f, 0.74194783f},
-std::array<float,2>{0.430985332f, 0.272125691f},
-std::array<float,2>{0.671470523f, 0.771471381f},
-std::array<float,2>{0.879058599f, 0.0683286339f},
-std::array<float,2>{0.136966154f, 0.648884654f},
-std::array<float,2>{0.109696008f, 0.222019732f},
-std::array<float,2>{0.851024508f, 0.624201715f},
-std::array<float,2>{0.549499214f, 0.473580986f},
-std::array<float,2>{0.339187205f, 0.989682734f},
-std::array<float,2>{0.255105406f, 0.00838404335f},
-std::array<float,2>{0.569922447f, 0.716236115f},
-std::array<float,2>{0.793878019f, 0.352022737f},
-std::array<float,2>{0.0472228341f, 0.869262218f},
-std::array<float,2>{0.203245237f, 0.382789433f},
-std::array<float,2>{0.974656522f, 0.876492739f},
-std::array<float,2>{0.721348047f, 0.178865626f},
-std::array<float,2>{0.44953388f, 0.529188097f},
-std::array<float,2>{0.466561705f, 0.435969323f},
-std::array<float,2>{0.741439462f, 0.914548934f},
-std::array<float,2>{0.991762698f, 0.139308378f},
-std::array<float,2>{0.198172659f, 0.541926026f},
-std::array<float,2>{0.0401516035f, 0.0522251539f},
-std::array<float,2>{0.798763752f, 0.719175994f},
-std::array<float,2>{0.582339644f, 0.317374885f},
-std::array<float,2>{0.268391848f, 0.828903913f},
-std::array<float,2>{0.318716705f, 0.193687931f},
-std::array<float,2>{0.541971505f, 0.580810845f},
-std::array<float,2>{0.871286511f, 0.448629856f},
-std::array<float,2>{0.102073044f, 0.961261988f},
-std::array<float,2>{0.143389955f, 0.292173594f},
-std::array<float,2>{0.894735813f, 0.810412288f},
-std::array<float,2>{0.67214179f, 0.122029848f},
-std::array<float,2>{0.411674887f, 0.676879823f},
-std::array<float,2>{0.294932693f, 0.369388998f},
-std::array<float,2>{0.600564361f, 0.844080567f},
-std::array<float,2>{0.779861987f, 0.0311876424f},
-std::array<float,2>{0.0175466333f, 0.699704349f},
-std::array<float,2>{0.222374618f, 0.158579767f},
-std::array<float,2>{0.953992009f, 0.508875012f},
-std::array<float,2>{0.690630257f, 0.401710451f},
-std::array<float,2>{0.482905895f, 0.892101943f},
-std::array<float,2>{0.403422147f, 0.0890191421f},
-std::array<float,2>{0.639897108f, 0.627011001f},
-std::array<float,2>{0.908840001f, 0.255746573f},
-std::array<float,2>{0.176988304f, 0.762939036f},
-std::array<float,2>{0.07099583f, 0.491906613f},
-std::array<float,2>{0.828813314f, 0.980668128f},
-std::array<float,2>{0.504157484f, 0.243335649f},
-std::array<float,2>{0.346886963f, 0.608296931f},
-std::array<float,2>{0.277348518f, 0.395962268f},
-std::array<float,2>{0.589785397f, 0.903834879f},
-std::array<float,2>{0.805552185f, 0.169075787f},
-std::array<float,2>{0.038070228f, 0.50761193f},
-std::array<float,2>{0.189762339f, 0.0215707608f},
-std::array<float,2>{0.993280351f, 0.690307498f},
-std::array<float,2>{0.743514717f, 0.361433357f},
-std::array<float,2>{0.454664022f, 0.857265294f},
-std::array<float,2>{0.416535288f, 0.239414141f},
-std::array<float,2>{0.680512905f, 0.596980095f},
-std::array<float,2>{0.900103211f, 0.49788636f},
-std::array<float,2>{0.153957352f, 0.972515881f},
-std::array<float,2>{0.0969463661f, 0.260484636f},
-std::array<float,2>{0.866005599f, 0.753620088f},
-std::array<float,2>{0.538434327f, 0.083168909f},
-std::array<float,2>{0.321153253f, 0.6350528f},
-std::array<float,2>{0.470778435f, 0.323694348f},
-std::array<float,2>{0.696159005f, 0.839638531f},
-std::array<float,2>{0.965706408f, 0.0615202785f},
-std::array<float,2>{0.229484081f, 0.733956039f},
-std::array<float,2>{0.0238449425f, 0.131489813f},
-std::array<float,2>{0.771035135f, 0.534756005f},
-std::array<float,2>{0.606858611f, 0.425785452f},
-std::array<float,2>{0.282547086f, 0.913693786f},
-std::array<float,2>{0.355122089f, 0.113809921f},
-std::array<float,2>{0.509443283f, 0.681519747f},
-std::array<float,2>{0.843039453f, 0.287086993f},
-std::array<float,2>{0.0643870607f, 0.799298823f},
-std::array<float,2>{0.186834455f, 0.439457268f},
-std::array<float,2>{0.921144247f, 0.956316233f},
-std::array<float,2>{0.630058646f, 0.197564989f},
-std::array<float,2>{0.393379778f, 0.589392602f},
-std::array<float,2>{0.388732195f, 0.482860059f},
-std::array<float,2>{0.647330105f, 0.997306764f},
-std::array<float,2>{0.927565277f, 0.230547383f},
-std::array<float,2>{0.158083782f, 0.615613997f},
-std::array<float,2>{0.0821378678f, 0.0761655346f},
-std::array<float,2>{0.826910555f, 0.646090806f},
-std::array<float,2>{0.522021055f, 0.278912783f},
-std::array<float,2>{0.362704784f, 0.774136722f},
-std::array<float,2>{0.299069494f, 0.180626646f},
-std::array<float,2>{0.621323466f, 0.51648581f},
-std::array<float,2>{0.757484078f, 0.388003498f},
-std::array<float,2>{0.0116777448f, 0.884372413f},
-std::array<float,2>{0.245342016f, 0.347575933f},
-std::array<float,2>{0.952272952f, 0.861213684f},
-std::array<float,2>{0.708383799f, 0.00216016895f},
-std::array<float,2>{0.493714958f, 0.709049523f},
-std::array<float,2>{0.332918853f, 0.297273099f},
-std::array<float,2>{0.56093967f, 0.782365024f},
-std::array<float,2>{0.857257545f, 0.1093335f},
-std::array<float,2>{0.121072739f, 0.661983788f},
-std::array<float,2>{0.125783399f, 0.21028778f},
-std::array<float,2>{0.884687364f, 0.562734783f},
-std::array<float,2>{0.656586289f, 0.462157011f},
-std::array<float,2>{0.429356337f, 0.939702094f},
-std::array<float,2>{0.437811613f, 0.0318886153f},
-std::array<float,2>{0.733530343f, 0.748493671f},
-std::array<float,2>{0.984283984f, 0.342992932f},
-std::array<float,2>{0.21100843f, 0.824238658f},
-std::array<float,2>{0.0549232401f, 0.421610028f},
-std::array<float,2>{0.782974303f, 0.923463404f},
-std::array<float,2>{0.574004233f, 0.146898463f},
-std::array<float,2>{0.262696117f, 0.551920354f},
-std::array<float,2>{0.326083332f, 0.412806183f},
-std::array<float,2>{0.534564674f, 0.934619009f},
-std::array<float,2>{0.862346888f, 0.152432352f},
-std::array<float,2>{0.0990196541f, 0.561688304f},
-std::array<float,2>{0.149183705f, 0.0443796925f},
-std::array<float,2>{0.90422076f, 0.736952603f},
-std::array<float,2>{0.684661448f, 0.333557129f},
-std::array<float,2>{0.421571672f, 0.820094645f},
-std::array<float,2>{0.457530409f, 0.212971002f},
-std::array<float,2>{0.746330917f, 0.573901236f},
-std::array<float,2>{0.996522784f, 0.460560918f},
-std::array<float,2>{0.19314833f, 0.949139774f},
-std::array<float,2>{0.0315202177f, 0.309013814f},
-std::array<float,2>{0.811552346f, 0.79378885f},
-std::array<float,2>{0.590511203f, 0.0977012962f},
-std::array<float,2>{0.276092917f, 0.670488536f},
-std::array<float,2>{0.397246897f, 0.358498305f},
-std::array<float,2>{0.628154933f, 0.873501897f},
-std::array<float,2>{0.915801048f, 0.0155049907f},
-std::array<float,2>{0.182575896f, 0.711526334f},
-std::array<float,2>{0.0688951463f, 0.172065035f},
-std::array<float,2>{0.836021423f, 0.52571547f},
-std::array<float,2>{0.512643933f, 0.376995593f},
-std::array<float,2>{0.356196344f, 0.882754385f},
-std::array<float,2>{0.285660625f, 0.0652499944f},
-std::array<float,2>{0.603064299f, 0.653752685f},
-std::array<float,2>{0.767668903f, 0.268532366f},
-std::array<float,2>{0.0300743226f, 0.767662406f},
-std::array<float,2>{0.234235302f, 0.470937878f},
-std::array<float,2>{0.963839173f, 0.985867977f},
-std::array<float,2>{0.702738643f, 0.225827709f},
-std::array<float,2>{0.476551771f, 0.61855787f},
-std::array<float,2>{0.49736318f, 0.450532228f},
-std::array<float,2>{0.703274548f, 0.965137601f},
-std::array<float,2>{0.946447432f, 0.188496277f},
-std::array<float,2>{0.24609752f, 0.582443118f},
-std::array<float,2>{0.013380154f, 0.11796993f},
-std::array<float,2>{0.751273394f, 0.675687015f},
-std::array<float,2>{0.619390666f, 0.295145005f},
-std::array<float,2>{0.303285956f, 0.807016492f},
-std::array<float,2>{0.364882499f, 0.13501519f},
-std::array<float,2>{0.518060029f, 0.544823885f},
-std::array<float,2>{0.82184571f, 0.432484955f},
-std::array<float,2>{0.081722267f, 0.921813071f},
-std::array<float,2>{0.161731809f, 0.312906891f},
-std::array<float,2>{0.923418581f, 0.833694637f},
-std::array<float,2>{0.64130187f, 0.0489212535f},
-std::array<float,2>{0.384746641f, 0.722881079f},
-std::array<float,2>{0.257816523f, 0.253152907f},
-std::array<float,2>{0.576214731f, 0.759213626f},
-std::array<float,2>{0.785991073f, 0.0919019133f},
-std::array<float,2>{0.0620458052f, 0.632481456f},
-std::array<float,2>{0.218593061f, 0.248861387f},
-std::array<float,2>{0.976918936f, 0.602587819f},
-std::array<float,2>{0.727715194f, 0.485954225f},
-std::array<float,2>{0.443259358f, 0.980246723f},
-std::array<float,2>{0.423457623f, 0.0254353974f},
-std::array<float,2>{0.663987458f, 0.697766066f},
-std::array<float,2>{0.890204847f, 0.372598112f},
-std::array<float,2>{0.129807696f, 0.849967241f},
-std::array<float,2>{0.123071395f, 0.404850483f},
-std::array<float,2>{0.853552938f, 0.897335827f},
-std::array<float,2>{0.554698706f, 0.161564767f},
-std::array<float,2>{0.330644816f, 0.514444947f},
-std::array<float,2>{0.307626694f, 0.492402852f},
-std::array<float,2>{0.611763358f, 0.975720882f},
-std::array<float,2>{0.763823748f, 0.237097487f},
-std::array<float,2>{0.00176138023f, 0.601105571f},
-std::array<float,2>{0.240463182f, 0.0788485259f},
-std::array<float,2>{0.941494286f, 0.638917685f},
-std::array<float,2>{0.712316334f, 0.262221307f},
-std::array<float,2>{0.491376907f, 0.755024791f},
-std::array<float,2>{0.377666295f, 0.164192751f},
-std::array<float,2>{0.653576493f, 0.503745615f},
-std::array<float,2>{0.934012294f, 0.392027766f},
-std::array<float,2>{0.164171115f, 0.899260819f},
-std::array<float,2>{0.0898007154f, 0.363813728f},
-std::array<float,2>{0.812977731f, 0.852020025f},
-std::array<float,2>{0.527313292f, 0.0173868574f},
-std::array<float,2>{0.37017855f, 0.691810191f},
-std::array<float,2>{0.448286802f, 0.283886999f},
-std::array<float,2>{0.72442162f, 0.80253607f},
-std::array<float,2>{0.970247507f, 0.112677753f},
-std::array<float,2>{0.209165841f, 0.687044919f},
-std::array<float,2>{0.0515599698f, 0.199818939f},
-std::array<float,2>{0.790402174f, 0.590143621f},
-std::array<float,2>{0.565827906f, 0.444758624f},
-std::array<float,2>{0.253137589f, 0.957059741f},
-std::array<float,2>{0.340918899f, 0.0553398728f},
-std::array<float,2>{0.551820397f, 0.726773024f},
-std::array<float,2>{0.844358146f, 0.327305764f},
-std::array<float,2>{0.116282932f, 0.840360343f},
-std::array<float,2>{0.135022953f, 0.422592849f},
-std::array<float,2>{0.878864825f, 0.90752995f},
-std::array<float,2>{0.667137265f, 0.128057405f},
-std::array<float,2>{0.434207886f, 0.538743675f},
-std::array<float,2>{0.407336742f, 0.385200351f},
-std::array<float,2>{0.677158833f, 0.889999747f},
-std::array<float,2>{0.890869558f, 0.185104415f},
-std::array<float,2>{0.146119669f, 0.520492911f},
-std::array<float,2>{0.108816586f, 0.00573029229f},
-std::array<float,2>{0.870423496f, 0.706074178f},
-std::array<float,2>{0.543851078f, 0.349957079f},
-std::array<float,2>{0.316181898f, 0.864253819f},
-std::array<float,2>{0.272422552f, 0.230315894f},
-std::array<float,2>{0.580681801f, 0.611832798f},
-std::array<float,2>{0.801043332f, 0.477317542f},
-std::array<float,2>{0.0454609618f, 0.995328903f},
-std::array<float,2>{0.200044841f, 0.276520222f},
-std::array<float,2>{0.986974239f, 0.779488683f},
-std::array<float,2>{0.734549999f, 0.071472697f},
-std::array<float,2>{0.462111205f, 0.641753435f},
-std::array<float,2>{0.35020858f, 0.339012235f},
-std::array<float,2>{0.500805259f, 0.822193444f},
-std::array<float,2>{0.834401965f, 0.0367800407f},
-std::array<float,2>{0.07513953f, 0.74388063f},
-std::array<float,2>{0.173208877f, 0.142543316f},
-std::array<float,2>{0.911605179f, 0.548936546f},
-std::array<float,2>{0.633128524f, 0.414427757f},
-std::array<float,2>{0.401392728f, 0.928745985f},
-std::array<float,2>{0.476713628f, 0.102095775f},
-std::array<float,2>{0.692551136f, 0.657403588f},
-std::array<float,2>{0.958872616f, 0.30089581f},
-std::array<float,2>{0.224756539f, 0.78712815f},
-std::array<float,2>{0.02028195f, 0.467526346f},
-std::array<float,2>{0.777204633f, 0.943175316f},
-std::array<float,2>{0.59752959f, 0.205297098f},
-std::array<float,2>{0.292596877f, 0.568786323f},
-std::array<float,2>{0.337853462f, 0.47539261f},
-std::array<float,2>{0.54697901f, 0.991082013f},
-std::array<float,2>{0.848665237f, 0.219669074f},
-std::array<float,2>{0.112938486f, 0.621858776f},
-std::array<float,2>{0.140526801f, 0.0694027022f},
-std::array<float,2>{0.880894542f, 0.651589274f},
-std::array<float,2>{0.669616759f, 0.271194279f},
-std::array<float,2>{0.43168515f, 0.772127092f},
-std::array<float,2>{0.452816725f, 0.177444503f},
-std::array<float,2>{0.720219672f, 0.530678749f},
-std::array<float,2>{0.973334491f, 0.380466521f},
-std::array<float,2>{0.205937386f, 0.877812624f},
-std::array<float,2>{0.0493895151f, 0.354092181f},
-std::array<float,2>{0.79519105f, 0.867922008f},
-std::array<float,2>{0.56717962f, 0.0101593677f},
-std::array<float,2>{0.256700605f, 0.717639446f},
-std::array<float,2>{0.382810831f, 0.305146247f},
-std::array<float,2>{0.648569107f, 0.79217428f},
-std::array<float,2>{0.931324184f, 0.0940872058f},
-std::array<float,2>{0.169104531f, 0.667174459f},
-std::array<float,2>{0.092116639f, 0.216039091f},
-std::array<float,2>{0.817155957f, 0.574316144f},
-std::array<float,2>{0.528500199f, 0.454844177f},
-std::array<float,2>{0.372969359f, 0.951217413f},
-std::array<float,2>{0.310547292f, 0.0427656546f},
-std::array<float,2>{0.614756525f, 0.739091992f},
-std::array<float,2>{0.75890857f, 0.329515338f},
-std::array<float,2>{0.0066051269f, 0.812756062f},
-std::array<float,2>{0.237026885f, 0.407715857f},
-std::array<float,2>{0.937655747f, 0.929918945f},
-std::array<float,2>{0.717344165f, 0.15211536f},
-std::array<float,2>{0.485457838f, 0.555866718f},
-std::array<float,2>{0.480904698f, 0.39994818f},
-std::array<float,2>{0.688262105f, 0.893142462f},
-std::array<float,2>{0.955403388f, 0.15799734f},
-std::array<float,2>{0.219593614f, 0.511403203f},
-std::array<float,2>{0.0182052162f, 0.0281224158f},
-std::array<float,2>{0.77886343f, 0.701249421f},
-std::array<float,2>{0.597968578f, 0.367307901f},
-std::array<float,2>{0.293013901f, 0.845935464f},
-std::array<float,2>{0.345229328f, 0.244991899f},
-std::array<float,2>{0.506007314f, 0.607131541f},
-std::array<float,2>{0.831825614f, 0.489197791f},
-std::array<float,2>{0.0738961846f, 0.983373106f},
-std::array<float,2>{0.178099483f, 0.256830156f},
-std::array<float,2>{0.907357931f, 0.765210986f},
-std::array<float,2>{0.636929929f, 0.0878265128f},
-std::array<float,2>{0.404606998f, 0.625590265f},
-std::array<float,2>{0.266864717f, 0.319290489f},
-std::array<float,2>{0.584447503f, 0.830329895f},
-std::array<float,2>{0.799729586f, 0.0545050912f},
-std::array<float,2>{0.0428694189f, 0.722180188f},
-std::array<float,2>{0.197054103f, 0.137970284f},
-std::array<float,2>{0.989566922f, 0.540044427f},
-std::array<float,2>{0.739749432f, 0.434020609f},
-std::array<float,2>{0.467104346f, 0.91719532f},
-std::array<float,2>{0.413100123f, 0.12471056f},
-std::array<float,2>{0.675594032f, 0.679383278f},
-std::array<float,2>{0.89771688f, 0.29003644f},
-std::array<float,2>{0.1419193f, 0.811854899f},
-std::array<float,2>{0.103555098f, 0.445606738f},
-std::array<float,2>{0.873473465f, 0.96381253f},
-std::array<float,2>{0.540363789f, 0.193272069f},
-std::array<float,2>{0.317582011f, 0.579716265f},
-std::array<float,2>{0.284470588f, 0.428217947f},
-std::array<float,2>{0.608581066f, 0.91067493f},
-std::array<float,2>{0.773160815f, 0.129886031f},
-std::array<float,2>{0.0267767813f, 0.531326711f},
-std::array<float,2>{0.227410883f, 0.0597871318f},
-std::array<float,2>{0.967770696f, 0.732230425f},
-std::array<float,2>{0.698720217f, 0.321806431f},
-std::array<float,2>{0.470349103f, 0.837623477f},
-std::array<float,2>{0.391261786f, 0.195353225f},
-std::array<float,2>{0.632704735f, 0.587338865f},
-std::array<float,2>{0.919342637f, 0.439341187f},
-std::array<float,2>{0.185280219f, 0.954310417f},
-std::array<float,2>{0.0650167614f, 0.287495345f},
-std::array<float,2>{0.840999305f, 0.797933638f},
-std::array<float,2>{0.510812759f, 0.116009541f},
-std::array<float,2>{0.351735532f, 0.682438612f},
-std::array<float,2>{0.456052691f, 0.360289872f},
-std::array<float,2>{0.744428694f, 0.858243644f},
-std::array<float,2>{0.994663477f, 0.0206176285f},
-std::array<float,2>{0.189441383f, 0.688006103f},
-std::array<float,2>{0.0364381634f, 0.170184493f},
-std::array<float,2>{0.806652069f, 0.50493592f},
-std::array<float,2>{0.587760806f, 0.397127718f},
-std::array<float,2>{0.280813426f, 0.904632866f},
-std::array<float,2>{0.322911024f, 0.0854887292f},
-std::array<float,2>{0.535552204f, 0.634311199f},
-std::array<float,2>{0.864483178f, 0.258197576f},
-std::array<float,2>{0.0950293466f, 0.751843214f},
-std::array<float,2>{0.156188861f, 0.498546004f},
-std::array<float,2>{0.901304126f, 0.970443785f},
-std::array<float,2>{0.683093011f, 0.241239369f},
-std::array<float,2>{0.414487928f, 0.595345616f},
-std::array<float,2>{0.426749825f, 0.463754058f},
-std::array<float,2>{0.659003079f, 0.938295722f},
-std::array<float,2>{0.885323822f, 0.20718205f},
-std::array<float,2>{0.127391264f, 0.564661324f},
-std::array<float,2>{0.117337175f, 0.106205486f},
-std::array<float,2>{0.859268308f, 0.663777173f},
-std::array<float,2>{0.55869478f, 0.300119042f},
-std::array<float,2>{0.334912658f, 0.784436941f},
-std::array<float,2>{0.265055507f, 0.145871446f},
-std::array<float,2>{0.570834279f, 0.554277182f},
-std::array<float,2>{0.78494668f, 0.418006599f},
-std::array<float,2>{0.056872379f, 0.924693286f},
-std::array<float,2>{0.213376909f, 0.340849906f},
-std::array<float,2>{0.982328892f, 0.827799141f},
-std::array<float,2>{0.731947601f, 0.0346416384f},
-std::array<float,2>{0.439529836f, 0.74798876f},
-std::array<float,2>{0.359679729f, 0.280643791f},
-std::array<float,2>{0.51986903f, 0.777144372f},
-std::array<float,2>{0.825075448f, 0.0778787583f},
-std::array<float,2>{0.0853018314f, 0.648266792f},
-std::array<float,2>{0.159451604f, 0.233053565f},
-std::array<float,2>{0.929347336f, 0.613605678f},
-std::array<float,2>{0.644949257f, 0.480691582f},
-std::array<float,2>{0.387054622f, 0.999281287f},
-std::array<float,2>{0.494823843f, 0.00184426014f},
-std::array<float,2>{0.710098565f, 0.707684577f},
-std::array<float,2>{0.95009166f, 0.344168186f},
-std::array<float,2>{0.242482349f, 0.862237334f},
-std::array<float,2>{0.00960888807f, 0.390377641f},
-std::array<float,2>{0.754112959f, 0.885452032f},
-std::array<float,2>{0.623390734f, 0.18171756f},
-std::array<float,2>{0.298351407f, 0.518589735f},
-std::array<float,2>{0.357890159f, 0.376394838f},
-std::array<float,2>{0.515240192f, 0.880202591f},
-std::array<float,2>{0.839316964f, 0.174241289f},
-std::array<float,2>{0.0673652291f, 0.525188148f},
-std::array<float,2>{0.180319965f, 0.0126489382f},
-std::array<float,2>{0.916961372f, 0.714679599f},
-std::array<float,2>{0.626448154f, 0.357167095f},
-std::array<float,2>{0.395355791f, 0.871312678f},
-std::array<float,2>{0.473217517f, 0.222762764f},
-std::array<float,2>{0.700922668f, 0.620277762f},
-std::array<float,2>{0.96251446f, 0.470534414f},
-std::array<float,2>{0.231924325f, 0.987860203f},
-std::array<float,2>{0.0278071202f, 0.267536879f},
-std::array<float,2>{0.767522991f, 0.766700923f},
-std::array<float,2>{0.60505414f, 0.0635238066f},
-std::array<float,2>{0.28770718f, 0.655900776f},
-std::array<float,2>{0.4189879f, 0.335861415f},
-std::array<float,2>{0.686438799f, 0.817922711f},
-std::array<float,2>{0.90623343f, 0.045807533f},
-std::array<float,2>{0.150534451f, 0.735087693f},
-std::array<float,2>{0.101099536f, 0.155612707f},
-std::array<float,2>{0.860751212f, 0.55910778f},
-std::array<float,2>{0.532553852f, 0.411285222f},
-std::array<float,2>{0.327330053f, 0.936145306f},
-std::array<float,2>{0.274805963f, 0.100159258f},
-std::array<float,2>{0.592135966f, 0.669335186f},
-std::array<float,2>{0.809595823f, 0.311764836f},
-std::array<float,2>{0.0337600671f, 0.795250416f},
-std::array<float,2>{0.194319561f, 0.458524972f},
-std::array<float,2>{0.999499977f, 0.946739316f},
-std::array<float,2>{0.749400079f, 0.211536661f},
-std::array<float,2>{0.460520864f, 0.571123302f},
-std::array<float,2>{0.44394803f, 0.486637473f},
-std::array<float,2>{0.729292452f, 0.976772368f},
-std::array<float,2>{0.978599131f, 0.2462257f},
-std::array<float,2>{0.215963289f, 0.604487777f},
-std::array<float,2>{0.0586895049f, 0.0901219398f},
-std::array<float,2>{0.787811637f, 0.629087389f},
-std::array<float,2>{0.575488269f, 0.251468122f},
-std::array<float,2>{0.261692703f, 0.760519803f},
-std::array<float,2>{0.329669178f, 0.163024098f},
-std::array<float,2>{0.557215631f, 0.511893988f},
-std::array<float,2>{0.852912664f, 0.403088599f},
-std::array<float,2>{0.122126602f, 0.895912409f},
-std::array<float,2>{0.132372215f, 0.373084873f},
-std::array<float,2>{0.8885777f, 0.848115087f},
-std::array<float,2>{0.660344064f, 0.0236882791f},
-std::array<float,2>{0.424173653f, 0.695702851f},
-std::array<float,2>{0.30116877f, 0.294868767f},
-std::array<float,2>{0.617501557f, 0.804794729f},
-std::array<float,2>{0.752640367f, 0.119890332f},
-std::array<float,2>{0.0152628049f, 0.672132909f},
-std::array<float,2>{0.24985452f, 0.191158891f},
-std::array<float,2>{0.947649837f, 0.585471809f},
-std::array<float,2>{0.706985891f, 0.451786727f},
-std::array<float,2>{0.498389572f, 0.967037141f},
-std::array<float,2>{0.386493504f, 0.0474016182f},
-std::array<float,2>{0.644198835f, 0.724906385f},
-std::array<float,2>{0.924907327f, 0.314528972f},
-std::array<float,2>{0.16339092f, 0.835493386f},
-std::array<float,2>{0.0790092647f, 0.431060523f},
-std::array<float,2>{0.824182928f, 0.91944617f},
-std::array<float,2>{0.515638769f, 0.134576201f},
-std::array<float,2>{0.367063344f, 0.545129955f},
-std::array<float,2>{0.250802845f, 0.442646295f},
-std::array<float,2>{0.562652349f, 0.959657252f},
-std::array<float,2>{0.792054176f, 0.20130375f},
-std::array<float,2>{0.0538626015f, 0.591816545f},
-std::array<float,2>{0.20869036f, 0.110611513f},
-std::array<float,2>{0.971238434f, 0.684080303f},
-std::array<float,2>{0.725469232f, 0.282782882f},
-std::array<float,2>{0.446287334f, 0.803632617f},
-std::array<float,2>{0.437458247f, 0.125049427f},
-std::array<float,2>{0.665710807f, 0.535691023f},
-std::array<float,2>{0.876154482f, 0.424176484f},
-std::array<float,2>{0.133583769f, 0.908237875f},
-std::array<float,2>{0.113308012f, 0.324877113f},
-std::array<float,2>{0.847570717f, 0.843030214f},
-std::array<float,2>{0.55348438f, 0.0568339117f},
-std::array<float,2>{0.343275398f, 0.729008615f},
-std::array<float,2>{0.489539206f, 0.264816225f},
-std::array<float,2>{0.71406424f, 0.756935954f},
-std::array<float,2>{0.944281995f, 0.0816331506f},
-std::array<float,2>{0.239482582f, 0.638218641f},
-std::array<float,2>{0.00350360456f, 0.234803453f},
-std::array<float,2>{0.762944877f, 0.599092126f},
-std::array<float,2>{0.609795988f, 0.495355219f},
-std::array<float,2>{0.304843724f, 0.973380327f},
-std::array<float,2>{0.368130565f, 0.019318793f},
-std::array<float,2>{0.523637474f, 0.694326162f},
-std::array<float,2>{0.815573931f, 0.366469264f},
-std::array<float,2>{0.0869220123f, 0.854375422f},
-std::array<float,2>{0.166582167f, 0.392947137f},
-std::array<float,2>{0.936985314f, 0.901462793f},
-std::array<float,2>{0.654819489f, 0.166844606f},
-std::array<float,2>{0.375846058f, 0.500125229f},
-std::array<float,2>{0.398646533f, 0.417954803f},
-std::array<float,2>{0.634864032f, 0.927364528f},
-std::array<float,2>{0.913826883f, 0.143474072f},
-std::array<float,2>{0.175234362f, 0.547770798f},
-std::array<float,2>{0.0771625042f, 0.038252376f},
-std::array<float,2>{0.832747281f, 0.745438159f},
-std::array<float,2>{0.502307475f, 0.337377697f},
-std::array<float,2>{0.348664522f, 0.82400614f},
-std::array<float,2>{0.289140821f, 0.203963801f},
-std::array<float,2>{0.595560193f, 0.568118572f},
-std::array<float,2>{0.775138199f, 0.465128124f},
-std::array<float,2>{0.0228382181f, 0.945113361f},
-std::array<float,2>{0.224465817f, 0.304037333f},
-std::array<float,2>{0.959254682f, 0.786890388f},
-std::array<float,2>{0.693696141f, 0.105034709f},
-std::array<float,2>{0.478788495f, 0.658577323f},
-std::array<float,2>{0.31397751f, 0.348007321f},
-std::array<float,2>{0.545964539f, 0.865775347f},
-std::array<float,2>{0.868171155f, 0.00721538626f},
-std::array<float,2>{0.105658293f, 0.704845428f},
-std::array<float,2>{0.147646248f, 0.185554624f},
-std::array<float,2>{0.893810034f, 0.522390246f},
-std::array<float,2>{0.678825021f, 0.383286327f},
-std::array<float,2>{0.408912957f, 0.886976779f},
-std::array<float,2>{0.464395404f, 0.0739743337f},
-std::array<float,2>{0.736912787f, 0.644344628f},
-std::array<float,2>{0.985926151f, 0.273638546f},
-std::array<float,2>{0.201477081f, 0.777466536f},
-std::array<float,2>{0.0445689186f, 0.479656488f},
-std::array<float,2>{0.804532647f, 0.993174374f},
-std::array<float,2>{0.579547465f, 0.226580769f},
-std::array<float,2>{0.270951033f, 0.609665155f},
-std::array<float,2>{0.343518943f, 0.443671465f},
-std::array<float,2>{0.553408742f, 0.958470702f},
-std::array<float,2>{0.847318292f, 0.200487882f},
-std::array<float,2>{0.113620043f, 0.59124428f},
-std::array<float,2>{0.133415923f, 0.111537844f},
-std::array<float,2>{0.876404464f, 0.68569392f},
-std::array<float,2>{0.665841401f, 0.284379244f},
-std::array<float,2>{0.437254131f, 0.801513851f},
-std::array<float,2>{0.44603774f, 0.127039492f},
-std::array<float,2>{0.725207746f, 0.537463605f},
-std::array<float,2>{0.971560597f, 0.423214912f},
-std::array<float,2>{0.208950758f, 0.906969845f},
-std::array<float,2>{0.0541645437f, 0.32631737f},
-std::array<float,2>{0.792475283f, 0.841642201f},
-std::array<float,2>{0.562776387f, 0.0556772463f},
-std::array<float,2>{0.25068897f, 0.727977395f},
-std::array<float,2>{0.375619113f, 0.263355762f},
-std::array<float,2>{0.655145824f, 0.754595697f},
-std::array<float,2>{0.936560094f, 0.0795772001f},
-std::array<float,2>{0.166906178f, 0.640111506f},
-std::array<float,2>{0.0873976871f, 0.237379581f},
-std::array<float,2>{0.815809608f, 0.600335062f},
-std::array<float,2>{0.523813367f, 0.493246406f},
-std::array<float,2>{0.367716193f, 0.974813938f},
-std::array<float,2>{0.305072665f, 0.0162996631f},
-std::array<float,2>{0.609454155f, 0.69272548f},
-std::array<float,2>{0.762908936f, 0.364589959f},
-std::array<float,2>{0.0036897033f, 0.853024542f},
-std::array<float,2>{0.239651963f, 0.390855074f},
-std::array<float,2>{0.944084406f, 0.899766266f},
-std::array<float,2>{0.714173257f, 0.165719673f},
-std::array<float,2>{0.489427477f, 0.502109945f},
-std::array<float,2>{0.478732198f, 0.415113926f},
-std::array<float,2>{0.693444669f, 0.928381324f},
-std::array<float,2>{0.959149897f, 0.141004428f},
-std::array<float,2>{0.224290565f, 0.550312221f},
-std::array<float,2>{0.022572739f, 0.0354682952f},
-std::array<float,2>{0.775183618f, 0.742887318f},
-std::array<float,2>{0.595215499f, 0.338175416f},
-std::array<float,2>{0.28941521f, 0.821029007f},
-std::array<float,2>{0.348932534f, 0.206059217f},
-std::array<float,2>{0.502187252f, 0.569606423f},
-std::array<float,2>{0.832979321f, 0.468663484f},
-std::array<float,2>{0.0774830803f, 0.942168951f},
-std::array<float,2>{0.175036758f, 0.302240372f},
-std::array<float,2>{0.913800359f, 0.788545728f},
-std::array<float,2>{0.635106266f, 0.102577202f},
-std::array<float,2>{0.398853123f, 0.65639478f},
-std::array<float,2>{0.270589828f, 0.351364255f},
-std::array<float,2>{0.579297781f, 0.86509198f},
-std::array<float,2>{0.804261863f, 0.00449299812f},
-std::array<float,2>{0.0447990708f, 0.705749094f},
-std::array<float,2>{0.201326042f, 0.18440561f},
-std::array<float,2>{0.986212611f, 0.52079165f},
-std::array<float,2>{0.737189472f, 0.385824025f},
-std::array<float,2>{0.46480298f, 0.889393628f},
-std::array<float,2>{0.409095883f, 0.0708866343f},
-std::array<float,2>{0.679112792f, 0.641231656f},
-std::array<float,2>{0.893769503f, 0.275701046f},
-std::array<float,2>{0.147713274f, 0.780972242f},
-std::array<float,2>{0.105738156f, 0.478342295f},
-std::array<float,2>{0.868615866f, 0.994523883f},
-std::array<float,2>{0.546198308f, 0.22913f},
-std::array<float,2>{0.31441465f, 0.612546206f},
-std::array<float,2>{0.288067281f, 0.378832757f},
-std::array<float,2>{0.605306208f, 0.881323099f},
-std::array<float,2>{0.767264962f, 0.173618957f},
-std::array<float,2>{0.0274600331f, 0.526936412f},
-std::array<float,2>{0.231590882f, 0.0145079559f},
-std::array<float,2>{0.962732315f, 0.711985171f},
-std::array<float,2>{0.701069653f, 0.358137488f},
-std::array<float,2>{0.473581553f, 0.874706984f},
-std::array<float,2>{0.395225972f, 0.225362539f},
-std::array<float,2>{0.625977814f, 0.617775857f},
-std::array<float,2>{0.91673559f, 0.471840352f},
-std::array<float,2>{0.180590838f, 0.98451823f},
-std::array<float,2>{0.0670676008f, 0.268776864f},
-std::array<float,2>{0.838869452f, 0.769180655f},
-std::array<float,2>{0.515387356f, 0.0658263639f},
-std::array<float,2>{0.357650459f, 0.653093457f},
-std::array<float,2>{0.46072787f, 0.332666159f},
-std::array<float,2>{0.749084592f, 0.819186509f},
-std::array<float,2>{0.999039531f, 0.0429890566f},
-std::array<float,2>{0.193976253f, 0.737826228f},
-std::array<float,2>{0.03416517f, 0.154001117f},
-std::array<float,2>{0.809942245f, 0.560818434f},
-std::array<float,2>{0.591948271f, 0.413536131f},
-std::array<float,2>{0.274499029f, 0.934402287f},
-std::array<float,2>{0.327494144f, 0.0988913998f},
-std::array<float,2>{0.532266021f, 0.671823382f},
-std::array<float,2>{0.860359967f, 0.309819907f},
-std::array<float,2>{0.101513468f, 0.794874549f},
-std::array<float,2>{0.150840148f, 0.459175318f},
-std::array<float,2>{0.905869126f, 0.94813472f},
-std::array<float,2>{0.686065495f, 0.214406043f},
-std::array<float,2>{0.419323534f, 0.572333276f},
-std::array<float,2>{0.423950672f, 0.485286742f},
-std::array<float,2>{0.660590529f, 0.978611946f},
-std::array<float,2>{0.888296485f, 0.24902907f},
-std::array<float,2>{0.132674649f, 0.602226734f},
-std::array<float,2>{0.122535259f, 0.0937292874f},
-std::array<float,2>{0.852654219f, 0.630975246f},
-std::array<float,2>{0.557594061f, 0.25287357f},
-std::array<float,2>{0.329982996f, 0.758593082f},
-std::array<float,2>{0.261327267f, 0.160786897f},
-std::array<float,2>{0.575273275f, 0.514965832f},
-std::array<float,2>{0.787849247f, 0.405688256f},
-std::array<float,2>{0.0590389185f, 0.897950649f},
-std::array<float,2>{0.216194674f, 0.371654809f},
-std::array<float,2>{0.978961766f, 0.850934982f},
-std::array<float,2>{0.729146063f, 0.026526574f},
-std::array<float,2>{0.444275647f, 0.698868811f},
-std::array<float,2>{0.366895437f, 0.296049654f},
-std::array<float,2>{0.515959024f, 0.807893932f},
-std::array<float,2>{0.823814332f, 0.118176214f},
-std::array<float,2>{0.0788378343f, 0.674621105f},
-std::array<float,2>{0.163115367f, 0.188219145f},
-std::array<float,2>{0.925166547f, 0.583593965f},
-std::array<float,2>{0.644323707f, 0.449804813f},
-std::array<float,2>{0.386237383f, 0.965939581f},
-std::array<float,2>{0.498234004f, 0.0504779406f},
-std::array<float,2>{0.706727087f, 0.723798454f},
-std::array<float,2>{0.947457612f, 0.313560158f},
-std::array<float,2>{0.249622002f, 0.83217901f},
-std::array<float,2>{0.0154638346f, 0.43350023f},
-std::array<float,2>{0.752823591f, 0.920255959f},
-std::array<float,2>{0.617414236f, 0.13650924f},
-std::array<float,2>{0.300831497f, 0.543134153f},
-std::array<float,2>{0.351995409f, 0.426798135f},
-std::array<float,2>{0.511017621f, 0.912604094f},
-std::array<float,2>{0.841296673f, 0.132028669f},
-std::array<float,2>{0.0651992038f, 0.533944547f},
-std::array<float,2>{0.185465634f, 0.0619144961f},
-std::array<float,2>{0.919000804f, 0.73329252f},
-std::array<float,2>{0.63253057f, 0.323176473f},
-std::array<float,2>{0.391587019f, 0.838677883f},
-std::array<float,2>{0.470639348f, 0.198833376f},
-std::array<float,2>{0.698482811f, 0.588724196f},
-std::array<float,2>{0.967285752f, 0.440860301f},
-std::array<float,2>{0.227094144f, 0.955254555f},
-std::array<float,2>{0.0263883621f, 0.285445005f},
-std::array<float,2>{0.773436666f, 0.800023437f},
-std::array<float,2>{0.608673811f, 0.114523709f},
-std::array<float,2>{0.284257263f, 0.680339098f},
-std::array<float,2>{0.414179623f, 0.363078922f},
-std::array<float,2>{0.682690084f, 0.855962038f},
-std::array<float,2>{0.900914907f, 0.0233555418f},
-std::array<float,2>{0.155915141f, 0.690986812f},
-std::array<float,2>{0.0947822332f, 0.168761328f},
-std::array<float,2>{0.864616454f, 0.506149113f},
-std::array<float,2>{0.535201967f, 0.395041555f},
-std::array<float,2>{0.323132008f, 0.902576387f},
-std::array<float,2>{0.28104803f, 0.0825124681f},
-std::array<float,2>{0.587585211f, 0.636178434f},
-std::array<float,2>{0.807096124f, 0.260944963f},
-std::array<float,2>{0.0361404493f, 0.752801418f},
-std::array<float,2>{0.18905656f, 0.496682674f},
-std::array<float,2>{0.995017171f, 0.971448541f},
-std::array<float,2>{0.744144261f, 0.23838304f},
-std::array<float,2>{0.455572665f, 0.596498609f},
-std::array<float,2>{0.439936638f, 0.460987717f},
-std::array<float,2>{0.732301772f, 0.940833032f},
-std::array<float,2>{0.982144833f, 0.20930995f},
-std::array<float,2>{0.213013113f, 0.564414203f},
-std::array<float,2>{0.0570021197f, 0.108042523f},
-std::array<float,2>{0.78470397f, 0.660321772f},
-std::array<float,2>{0.57110399f, 0.298814774f},
-std::array<float,2>{0.264717579f, 0.781587601f},
-std::array<float,2>{0.334667265f, 0.148245037f},
-std::array<float,2>{0.559044123f, 0.551083803f},
-std::array<float,2>{0.858984768f, 0.420662254f},
-std::array<float,2>{0.117609531f, 0.922323644f},
-std::array<float,2>{0.126999244f, 0.342077285f},
-std::array<float,2>{0.885737956f, 0.825314462f},
-std::array<float,2>{0.658710957f, 0.0331925377f},
-std::array<float,2>{0.426448435f, 0.749435306f},
-std::array<float,2>{0.29881984f, 0.278265834f},
-std::array<float,2>{0.623211145f, 0.774753153f},
-std::array<float,2>{0.754319787f, 0.0742217228f},
-std::array<float,2>{0.00939329807f, 0.645457566f},
-std::array<float,2>{0.242267027f, 0.231907666f},
-std::array<float,2>{0.949821413f, 0.617164552f},
-std::array<float,2>{0.710303903f, 0.483882636f},
-std::array<float,2>{0.495035529f, 0.996347547f},
-std::array<float,2>{0.386871368f, 0.00341824559f},
-std::array<float,2>{0.644772828f, 0.710522413f},
-std::array<float,2>{0.929614067f, 0.346208394f},
-std::array<float,2>{0.159406841f, 0.859899044f},
-std::array<float,2>{0.0851097852f, 0.387505293f},
-std::array<float,2>{0.824932516f, 0.883548975f},
-std::array<float,2>{0.519729316f, 0.180739105f},
-std::array<float,2>{0.359515131f, 0.516667604f},
-std::array<float,2>{0.256495297f, 0.474111229f},
-std::array<float,2>{0.567109346f, 0.989216566f},
-std::array<float,2>{0.795075595f, 0.220793173f},
-std::array<float,2>{0.0497345105f, 0.623196721f},
-std::array<float,2>{0.205752656f, 0.0664259121f},
-std::array<float,2>{0.973402143f, 0.650127649f},
-std::array<float,2>{0.720529199f, 0.272501081f},
-std::array<float,2>{0.453033835f, 0.769647837f},
-std::array<float,2>{0.431890219f, 0.178667456f},
-std::array<float,2>{0.669730127f, 0.527391136f},
-std::array<float,2>{0.881266594f, 0.381286711f},
-std::array<float,2>{0.140172705f, 0.875850797f},
-std::array<float,2>{0.113270521f, 0.352621377f},
-std::array<float,2>{0.848907888f, 0.871079147f},
-std::array<float,2>{0.547332048f, 0.00943653751f},
-std::array<float,2>{0.337428302f, 0.715186f},
-std::array<float,2>{0.485728025f, 0.30804649f},
-std::array<float,2>{0.717695415f, 0.789269924f},
-std::array<float,2>{0.93782115f, 0.0974218845f},
-std::array<float,2>{0.237296999f, 0.665801823f},
-std::array<float,2>{0.00649866275f, 0.217840537f},
-std::array<float,2>{0.759066761f, 0.57737875f},
-std::array<float,2>{0.61511749f, 0.455873817f},
-std::array<float,2>{0.310999393f, 0.95031786f},
-std::array<float,2>{0.372658908f, 0.0390996523f},
-std::array<float,2>{0.528663635f, 0.740553796f},
-std::array<float,2>{0.816987574f, 0.33009553f},
-std::array<float,2>{0.0918653682f, 0.815506876f},
-std::array<float,2>{0.169231951f, 0.408905596f},
-std::array<float,2>{0.93142581f, 0.932624221f},
-std::array<float,2>{0.648835421f, 0.150243074f},
-std::array<float,2>{0.382326633f, 0.557892263f},
-std::array<float,2>{0.404438049f, 0.400807619f},
-std::array<float,2>{0.637141228f, 0.891198337f},
-std::array<float,2>{0.907549381f, 0.159814551f},
-std::array<float,2>{0.177782789f, 0.50801301f},
-std::array<float,2>{0.0742082f, 0.0295373779f},
-std::array<float,2>{0.831710815f, 0.700387955f},
-std::array<float,2>{0.506114841f, 0.370223701f},
-std::array<float,2>{0.345507562f, 0.845225811f},
-std::array<float,2>{0.293389767f, 0.242819682f},
-std::array<float,2>{0.597825825f, 0.609276891f},
-std::array<float,2>{0.779069722f, 0.490842849f},
-std::array<float,2>{0.0184525996f, 0.981892467f},
-std::array<float,2>{0.219338477f, 0.253950149f},
-std::array<float,2>{0.955229282f, 0.762427688f},
-std::array<float,2>{0.688076735f, 0.0885152221f},
-std::array<float,2>{0.480634272f, 0.628135026f},
-std::array<float,2>{0.317707568f, 0.317616284f},
-std::array<float,2>{0.540235937f, 0.829378605f},
-std::array<float,2>{0.87312448f, 0.051553037f},
-std::array<float,2>{0.103974052f, 0.7204566f},
-std::array<float,2>{0.141820967f, 0.140599251f},
-std::array<float,2>{0.897682071f, 0.542280018f},
-std::array<float,2>{0.675343871f, 0.437080473f},
-std::array<float,2>{0.413474917f, 0.915928662f},
-std::array<float,2>{0.466840267f, 0.122759454f},
-std::array<float,2>{0.739998043f, 0.676383436f},
-std::array<float,2>{0.989432454f, 0.291238129f},
-std::array<float,2>{0.19699432f, 0.809188485f},
-std::array<float,2>{0.0426380411f, 0.447939098f},
-std::array<float,2>{0.799366534f, 0.962777436f},
-std::array<float,2>{0.584215641f, 0.195175722f},
-std::array<float,2>{0.266679943f, 0.581754744f},
-std::array<float,2>{0.37045756f, 0.495061338f},
-std::array<float,2>{0.5269171f, 0.974477708f},
-std::array<float,2>{0.812632382f, 0.235425338f},
-std::array<float,2>{0.0893611833f, 0.598199785f},
-std::array<float,2>{0.164322838f, 0.0803474188f},
-std::array<float,2>{0.933734655f, 0.637160361f},
-std::array<float,2>{0.653525591f, 0.264225662f},
-std::array<float,2>{0.377762824f, 0.756220698f},
-std::array<float,2>{0.491578817f, 0.167498678f},
-std::array<float,2>{0.711984515f, 0.501520336f},
-std::array<float,2>{0.941858232f, 0.394405127f},
-std::array<float,2>{0.24069792f, 0.90046984f},
-std::array<float,2>{0.00162243994f, 0.365582913f},
-std::array<float,2>{0.764113963f, 0.854886293f},
-std::array<float,2>{0.611466527f, 0.0184851177f},
-std::array<float,2>{0.307918131f, 0.694563806f},
-std::array<float,2>{0.434494317f, 0.282177448f},
-std::array<float,2>{0.667386651f, 0.80449295f},
-std::array<float,2>{0.878651142f, 0.109473206f},
-std::array<float,2>{0.134908706f, 0.685009181f},
-std::array<float,2>{0.116614096f, 0.202851236f},
-std::array<float,2>{0.8446455f, 0.592830539f},
-std::array<float,2>{0.552245378f, 0.442138314f},
-std::array<float,2>{0.341196984f, 0.960097611f},
-std::array<float,2>{0.253407389f, 0.0579980835f},
-std::array<float,2>{0.565660775f, 0.729844093f},
-std::array<float,2>{0.790095866f, 0.325702548f},
-std::array<float,2>{0.0513525195f, 0.842620432f},
-std::array<float,2>{0.209419072f, 0.425752908f},
-std::array<float,2>{0.970675886f, 0.909546852f},
-std::array<float,2>{0.724361598f, 0.126350984f},
-std::array<float,2>{0.448507756f, 0.536588967f},
-std::array<float,2>{0.462211907f, 0.383819401f},
-std::array<float,2>{0.734818041f, 0.888397694f},
-std::array<float,2>{0.987086415f, 0.186556578f},
-std::array<float,2>{0.199808046f, 0.522857308f},
-std::array<float,2>{0.0456559807f, 0.00644368725f},
-std::array<float,2>{0.800890565f, 0.704018593f},
-std::array<float,2>{0.580877304f, 0.348874301f},
-std::array<float,2>{0.271996021f, 0.867162645f},
-std::array<float,2>{0.316098839f, 0.227998719f},
-std::array<float,2>{0.543505371f, 0.610515416f},
-std::array<float,2>{0.870349705f, 0.478607535f},
-std::array<float,2>{0.108617023f, 0.993136585f},
-std::array<float,2>{0.146292478f, 0.275363147f},
-std::array<float,2>{0.890848279f, 0.779262125f},
-std::array<float,2>{0.676990271f, 0.0728939921f},
-std::array<float,2>{0.407580137f, 0.642894685f},
-std::array<float,2>{0.292857289f, 0.335937828f},
-std::array<float,2>{0.597176909f, 0.822617531f},
-std::array<float,2>{0.776929319f, 0.0379640609f},
-std::array<float,2>{0.0200882684f, 0.74480176f},
-std::array<float,2>{0.224886551f, 0.143769071f},
-std::array<float,2>{0.958738506f, 0.548706651f},
-std::array<float,2>{0.692671061f, 0.416892588f},
-std::array<float,2>{0.476824641f, 0.926483333f},
-std::array<float,2>{0.401635528f, 0.104130797f},
-std::array<float,2>{0.632816374f, 0.660122752f},
-std::array<float,2>{0.91113925f, 0.30354923f},
-std::array<float,2>{0.172883913f, 0.785696864f},
-std::array<float,2>{0.0749257356f, 0.46655798f},
-std::array<float,2>{0.834040284f, 0.943511486f},
-std::array<float,2>{0.500641167f, 0.204543814f},
-std::array<float,2>{0.350547105f, 0.566638172f},
-std::array<float,2>{0.276194453f, 0.41079393f},
-std::array<float,2>{0.590738356f, 0.936619222f},
-std::array<float,2>{0.81197238f, 0.154758364f},
-std::array<float,2>{0.0312579796f, 0.560093403f},
-std::array<float,2>{0.192874596f, 0.0460091904f},
-std::array<float,2>{0.996168673f, 0.735808194f},
-std::array<float,2>{0.746510208f, 0.334832251f},
-std::array<float,2>{0.45797798f, 0.816902041f},
-std::array<float,2>{0.421835959f, 0.212048069f},
-std::array<float,2>{0.68493247f, 0.571585178f},
-std::array<float,2>{0.903863072f, 0.457062334f},
-std::array<float,2>{0.148971155f, 0.945518017f},
-std::array<float,2>{0.0986950099f, 0.31068328f},
-std::array<float,2>{0.86269027f, 0.796018124f},
-std::array<float,2>{0.534375966f, 0.10147094f},
-std::array<float,2>{0.325716645f, 0.668917239f},
-std::array<float,2>{0.476240367f, 0.356370658f},
-std::array<float,2>{0.703064919f, 0.872473955f},
-std::array<float,2>{0.963484466f, 0.0127658965f},
-std::array<float,2>{0.234051734f, 0.713861525f},
-std::array<float,2>{0.0299639087f, 0.175123259f},
-std::array<float,2>{0.767904937f, 0.524035633f},
-std::array<float,2>{0.603351176f, 0.375695467f},
-std::array<float,2>{0.285906196f, 0.879853845f},
-std::array<float,2>{0.356303781f, 0.063059248f},
-std::array<float,2>{0.512298644f, 0.654744089f},
-std::array<float,2>{0.836234331f, 0.266508251f},
-std::array<float,2>{0.0692500696f, 0.765647292f},
-std::array<float,2>{0.182341963f, 0.468994617f},
-std::array<float,2>{0.915689945f, 0.986695945f},
-std::array<float,2>{0.628337562f, 0.224196747f},
-std::array<float,2>{0.397115976f, 0.61933583f},
-std::array<float,2>{0.384498537f, 0.452603012f},
-std::array<float,2>{0.641456544f, 0.968416154f},
-std::array<float,2>{0.92360431f, 0.189742744f},
-std::array<float,2>{0.162095293f, 0.584490299f},
-std::array<float,2>{0.0820082426f, 0.120875314f},
-std::array<float,2>{0.822214246f, 0.67299515f},
-std::array<float,2>{0.517766058f, 0.293928683f},
-std::array<float,2>{0.365095347f, 0.80595535f},
-std::array<float,2>{0.303515911f, 0.133624002f},
-std::array<float,2>{0.619176865f, 0.546175003f},
-std::array<float,2>{0.751220167f, 0.430445105f},
-std::array<float,2>{0.013473805f, 0.91828835f},
-std::array<float,2>{0.246579319f, 0.316308588f},
-std::array<float,2>{0.94664073f, 0.834514856f},
-std::array<float,2>{0.703565598f, 0.047851976f},
-std::array<float,2>{0.497137189f, 0.726365149f},
-std::array<float,2>{0.330937862f, 0.250815034f},
-std::array<float,2>{0.555167139f, 0.761516929f},
-std::array<float,2>{0.85380435f, 0.090996936f},
-std::array<float,2>{0.123460457f, 0.630701661f},
-std::array<float,2>{0.129448593f, 0.247717634f},
-std::array<float,2>{0.890410662f, 0.605179012f},
-std::array<float,2>{0.663713515f, 0.487472385f},
-std::array<float,2>{0.423610032f, 0.977981567f},
-std::array<float,2>{0.442990422f, 0.0250392854f},
-std::array<float,2>{0.727959573f, 0.696934879f},
-std::array<float,2>{0.976735353f, 0.374351591f},
-std::array<float,2>{0.218468428f, 0.848655283f},
-std::array<float,2>{0.0622880422f, 0.403967917f},
-std::array<float,2>{0.785692155f, 0.895045519f},
-std::array<float,2>{0.57644552f, 0.164049804f},
-std::array<float,2>{0.258285791f, 0.513371706f},
-std::array<float,2>{0.320824206f, 0.397956878f},
-std::array<float,2>{0.538199127f, 0.905813694f},
-std::array<float,2>{0.865935504f, 0.170909509f},
-std::array<float,2>{0.0968279988f, 0.504587531f},
-std::array<float,2>{0.154132664f, 0.0200402811f},
-std::array<float,2>{0.900270998f, 0.688854158f},
-std::array<float,2>{0.680340469f, 0.360552579f},
-std::array<float,2>{0.416796654f, 0.859318376f},
-std::array<float,2>{0.454919904f, 0.240283057f},
-std::array<float,2>{0.743204892f, 0.594072282f},
-std::array<float,2>{0.993606806f, 0.4992401f},
-std::array<float,2>{0.189696342f, 0.969022274f},
-std::array<float,2>{0.0377589539f, 0.258980781f},
-std::array<float,2>{0.805212677f, 0.750375926f},
-std::array<float,2>{0.589469612f, 0.0848043635f},
-std::array<float,2>{0.277823508f, 0.633502901f},
-std::array<float,2>{0.393200487f, 0.32036221f},
-std::array<float,2>{0.630345106f, 0.836617708f},
-std::array<float,2>{0.920942366f, 0.0586005263f},
-std::array<float,2>{0.186552837f, 0.730574846f},
-std::array<float,2>{0.0640090406f, 0.129209161f},
-std::array<float,2>{0.842843354f, 0.532360852f},
-std::array<float,2>{0.509683132f, 0.42891863f},
-std::array<float,2>{0.355339527f, 0.911365271f},
-std::array<float,2>{0.282267064f, 0.116765372f},
-std::array<float,2>{0.606603205f, 0.683523417f},
-std::array<float,2>{0.771272063f, 0.289054126f},
-std::array<float,2>{0.0236280132f, 0.797180533f},
-std::array<float,2>{0.229032099f, 0.438022941f},
-std::array<float,2>{0.965498865f, 0.953482628f},
-std::array<float,2>{0.695944667f, 0.19723177f},
-std::array<float,2>{0.471135646f, 0.586276889f},
-std::array<float,2>{0.494030207f, 0.481978983f},
-std::array<float,2>{0.708031595f, 0.998520613f},
-std::array<float,2>{0.952410936f, 0.23405233f},
-std::array<float,2>{0.245552585f, 0.614440024f},
-std::array<float,2>{0.0113988109f, 0.0762760937f},
-std::array<float,2>{0.757786512f, 0.646603107f},
-std::array<float,2>{0.62154597f, 0.279474497f},
-std::array<float,2>{0.299267828f, 0.776235938f},
-std::array<float,2>{0.362417907f, 0.183325857f},
-std::array<float,2>{0.522328436f, 0.518452406f},
-std::array<float,2>{0.82689476f, 0.389578521f},
-std::array<float,2>{0.082345888f, 0.886099756f},
-std::array<float,2>{0.157737896f, 0.345575869f},
-std::array<float,2>{0.927339971f, 0.863205791f},
-std::array<float,2>{0.647125125f, 0.000766358571f},
-std::array<float,2>{0.389068782f, 0.708010912f},
-std::array<float,2>{0.262981236f, 0.298838198f},
-std::array<float,2>{0.573749542f, 0.783807397f},
-std::array<float,2>{0.782882392f, 0.106638052f},
-std::array<float,2>{0.0550800115f, 0.662901103f},
-std::array<float,2>{0.211366713f, 0.208799854f},
-std::array<float,2>{0.983936131f, 0.565578699f},
-std::array<float,2>{0.733873308f, 0.464198828f},
-std::array<float,2>{0.437658459f, 0.939227521f},
-std::array<float,2>{0.429618597f, 0.0333096161f},
-std::array<float,2>{0.656344354f, 0.747006953f},
-std::array<float,2>{0.884455919f, 0.340545207f},
-std::array<float,2>{0.125583187f, 0.826269269f},
-std::array<float,2>{0.120693564f, 0.419115156f},
-std::array<float,2>{0.85706991f, 0.925259709f},
-std::array<float,2>{0.560583055f, 0.145095676f},
-std::array<float,2>{0.332693666f, 0.553152919f},
-std::array<float,2>{0.309168249f, 0.453715056f},
-std::array<float,2>{0.616162062f, 0.952994406f},
-std::array<float,2>{0.760854065f, 0.215646565f},
-std::array<float,2>{0.00458314177f, 0.575366616f},
-std::array<float,2>{0.236280024f, 0.0949850529f},
-std::array<float,2>{0.941294074f, 0.666847169f},
-std::array<float,2>{0.715020716f, 0.306288987f},
-std::array<float,2>{0.488102674f, 0.791325927f},
-std::array<float,2>{0.378935874f, 0.15086557f},
-std::array<float,2>{0.651650965f, 0.555588126f},
-std::array<float,2>{0.932567537f, 0.406864822f},
-std::array<float,2>{0.170387611f, 0.931392729f},
-std::array<float,2>{0.0915627554f, 0.328685999f},
-std::array<float,2>{0.818674922f, 0.81409508f},
-std::array<float,2>{0.529568851f, 0.0419359691f},
-std::array<float,2>{0.374124497f, 0.739561975f},
-std::array<float,2>{0.449429899f, 0.269604415f},
-std::array<float,2>{0.721623838f, 0.77250737f},
-std::array<float,2>{0.97486335f, 0.0685617179f},
-std::array<float,2>{0.20341827f, 0.650533676f},
-std::array<float,2>{0.0470588766f, 0.220426977f},
-std::array<float,2>{0.793646693f, 0.622719347f},
-std::array<float,2>{0.570243061f, 0.476398408f},
-std::array<float,2>{0.255328834f, 0.991558492f},
-std::array<float,2>{0.338988602f, 0.0115943644f},
-std::array<float,2>{0.549572349f, 0.717911661f},
-std::array<float,2>{0.850650132f, 0.355253428f},
-std::array<float,2>{0.10940107f, 0.868940115f},
-std::array<float,2>{0.136817127f, 0.379716098f},
-std::array<float,2>{0.879236579f, 0.878825366f},
-std::array<float,2>{0.671750247f, 0.176479399f},
-std::array<float,2>{0.430802166f, 0.529844046f},
-std::array<float,2>{0.411939442f, 0.435035527f},
-std::array<float,2>{0.672001362f, 0.916622341f},
-std::array<float,2>{0.894937813f, 0.137647361f},
-std::array<float,2>{0.143231928f, 0.539578199f},
-std::array<float,2>{0.102424726f, 0.0529491492f},
-std::array<float,2>{0.871573269f, 0.721505523f},
-std::array<float,2>{0.541584373f, 0.31940493f},
-std::array<float,2>{0.318409473f, 0.831807971f},
-std::array<float,2>{0.268191725f, 0.192175686f},
-std::array<float,2>{0.58211273f, 0.578172863f},
-std::array<float,2>{0.798519015f, 0.446820349f},
-std::array<float,2>{0.0404569097f, 0.964654922f},
-std::array<float,2>{0.197912768f, 0.290145099f},
-std::array<float,2>{0.991990685f, 0.811243474f},
-std::array<float,2>{0.74151963f, 0.123874292f},
-std::array<float,2>{0.466325551f, 0.678057075f},
-std::array<float,2>{0.347049445f, 0.368782461f},
-std::array<float,2>{0.504050732f, 0.847450614f},
-std::array<float,2>{0.829095483f, 0.0289946012f},
-std::array<float,2>{0.0710763037f, 0.702966511f},
-std::array<float,2>{0.177108079f, 0.156912714f},
-std::array<float,2>{0.908937633f, 0.510039508f},
-std::array<float,2>{0.639855683f, 0.398697615f},
-std::array<float,2>{0.403734148f, 0.893696368f},
-std::array<float,2>{0.482664049f, 0.0859932154f},
-std::array<float,2>{0.690876305f, 0.626274884f},
-std::array<float,2>{0.953811169f, 0.257619053f},
-std::array<float,2>{0.222467348f, 0.764320731f},
-std::array<float,2>{0.0172569454f, 0.489855409f},
-std::array<float,2>{0.780062139f, 0.984005809f},
-std::array<float,2>{0.600213289f, 0.24568139f},
-std::array<float,2>{0.295252591f, 0.606165648f},
-std::array<float,2>{0.351045787f, 0.466940582f},
-std::array<float,2>{0.501942217f, 0.942593753f},
-std::array<float,2>{0.835719526f, 0.205592573f},
-std::array<float,2>{0.0759759769f, 0.569150686f},
-std::array<float,2>{0.171921372f, 0.101826228f},
-std::array<float,2>{0.910651386f, 0.657835722f},
-std::array<float,2>{0.634026706f, 0.30152154f},
-std::array<float,2>{0.400742143f, 0.787879705f},
-std::array<float,2>{0.477568567f, 0.141711697f},
-std::array<float,2>{0.692352772f, 0.549590409f},
-std::array<float,2>{0.957472563f, 0.414932758f},
-std::array<float,2>{0.225839421f, 0.929587603f},
-std::array<float,2>{0.0213696044f, 0.339400679f},
-std::array<float,2>{0.775922239f, 0.821384966f},
-std::array<float,2>{0.596406698f, 0.0364610627f},
-std::array<float,2>{0.291299284f, 0.743636549f},
-std::array<float,2>{0.406604052f, 0.276954114f},
-std::array<float,2>{0.675796449f, 0.779787421f},
-std::array<float,2>{0.891629875f, 0.0719001666f},
-std::array<float,2>{0.14484641f, 0.64252156f},
-std::array<float,2>{0.107659288f, 0.229756534f},
-std::array<float,2>{0.869823217f, 0.611391246f},
-std::array<float,2>{0.544333458f, 0.476830184f},
-std::array<float,2>{0.314584464f, 0.995946527f},
-std::array<float,2>{0.273263931f, 0.00517075462f},
-std::array<float,2>{0.581712484f, 0.706635952f},
-std::array<float,2>{0.802555621f, 0.350330442f},
-std::array<float,2>{0.0465693101f, 0.863585353f},
-std::array<float,2>{0.201081157f, 0.385586679f},
-std::array<float,2>{0.988260925f, 0.89054811f},
-std::array<float,2>{0.735767603f, 0.184739321f},
-std::array<float,2>{0.461822212f, 0.519660711f},
-std::array<float,2>{0.447717547f, 0.422132879f},
-std::array<float,2>{0.723265409f, 0.90809989f},
-std::array<float,2>{0.969499707f, 0.128862679f},
-std::array<float,2>{0.210802019f, 0.538503528f},
-std::array<float,2>{0.0521179922f, 0.0548834726f},
-std::array<float,2>{0.789590061f, 0.727361977f},
-std::array<float,2>{0.56467545f, 0.327650607f},
-std::array<float,2>{0.252072364f, 0.839992702f},
-std::array<float,2>{0.340409338f, 0.199483588f},
-std::array<float,2>{0.550783336f, 0.590565801f},
-std::array<float,2>{0.845597327f, 0.445049345f},
-std::array<float,2>{0.116179541f, 0.95773387f},
-std::array<float,2>{0.136163786f, 0.283521563f},
-std::array<float,2>{0.877195001f, 0.802198708f},
-std::array<float,2>{0.666119874f, 0.113174371f},
-std::array<float,2>{0.434742033f, 0.68656379f},
-std::array<float,2>{0.306800067f, 0.363576353f},
-std::array<float,2>{0.612368226f, 0.852085054f},
-std::array<float,2>{0.764967263f, 0.016911786f},
-std::array<float,2>{1.47546834e-05f, 0.692041874f},
-std::array<float,2>{0.241862059f, 0.164751798f},
-std::array<float,2>{0.942520499f, 0.503391623f},
-std::array<float,2>{0.71144563f, 0.392369419f},
-std::array<float,2>{0.490725994f, 0.898770511f},
-std::array<float,2>{0.378636777f, 0.0785828084f},
-std::array<float,2>{0.652669728f, 0.639281213f},
-std::array<float,2>{0.935026109f, 0.262204885f},
-std::array<float,2>{0.165201724f, 0.755805075f},
-std::array<float,2>{0.0888371766f, 0.492855012f},
-std::array<float,2>{0.813618958f, 0.976543486f},
-std::array<float,2>{0.525678694f, 0.236797661f},
-std::array<float,2>{0.37011075f, 0.600594461f},
-std::array<float,2>{0.25907129f, 0.404769987f},
-std::array<float,2>{0.577901781f, 0.896878541f},
-std::array<float,2>{0.786670446f, 0.161743745f},
-std::array<float,2>{0.0605906434f, 0.513705969f},
-std::array<float,2>{0.217060775f, 0.0260907728f},
-std::array<float,2>{0.97807914f, 0.697735608f},
-std::array<float,2>{0.727386117f, 0.372351438f},
-std::array<float,2>{0.442026615f, 0.850298584f},
-std::array<float,2>{0.422633857f, 0.248409614f},
-std::array<float,2>{0.662954688f, 0.603111982f},
-std::array<float,2>{0.888846397f, 0.485582203f},
-std::array<float,2>{0.130490497f, 0.979830861f},
-std::array<float,2>{0.1246875f, 0.253544152f},
-std::array<float,2>{0.854732275f, 0.759741545f},
-std::array<float,2>{0.555856287f, 0.0924894735f},
-std::array<float,2>{0.331645787f, 0.632119417f},
-std::array<float,2>{0.496329576f, 0.313001752f},
-std::array<float,2>{0.704180717f, 0.833062649f},
-std::array<float,2>{0.945438504f, 0.049368035f},
-std::array<float,2>{0.247371629f, 0.72342068f},
-std::array<float,2>{0.0121401232f, 0.135305494f},
-std::array<float,2>{0.750824988f, 0.544045329f},
-std::array<float,2>{0.620413423f, 0.431999624f},
-std::array<float,2>{0.303792179f, 0.92125845f},
-std::array<float,2>{0.363563031f, 0.117555097f},
-std::array<float,2>{0.519039929f, 0.675154328f},
-std::array<float,2>{0.820740044f, 0.295713425f},
-std::array<float,2>{0.0803781152f, 0.807593703f},
-std::array<float,2>{0.160693288f, 0.451067895f},
-std::array<float,2>{0.922302127f, 0.96578759f},
-std::array<float,2>{0.642379045f, 0.189011052f},
-std::array<float,2>{0.38298285f, 0.582971931f},
-std::array<float,2>{0.398077875f, 0.471413106f},
-std::array<float,2>{0.627640367f, 0.985743701f},
-std::array<float,2>{0.914624453f, 0.22632125f},
-std::array<float,2>{0.183144003f, 0.619023502f},
-std::array<float,2>{0.0703109428f, 0.0646117777f},
-std::array<float,2>{0.837117076f, 0.653818011f},
-std::array<float,2>{0.512965143f, 0.267584324f},
-std::array<float,2>{0.356587619f, 0.768482625f},
-std::array<float,2>{0.286849976f, 0.172831699f},
-std::array<float,2>{0.601849318f, 0.526025116f},
-std::array<float,2>{0.769326568f, 0.377786309f},
-std::array<float,2>{0.0304529462f, 0.881956875f},
-std::array<float,2>{0.233187631f, 0.359335303f},
-std::array<float,2>{0.964641869f, 0.873842597f},
-std::array<float,2>{0.70173198f, 0.0148233324f},
-std::array<float,2>{0.47532779f, 0.711224794f},
-std::array<float,2>{0.324895263f, 0.30928126f},
-std::array<float,2>{0.533427119f, 0.79307276f},
-std::array<float,2>{0.861411512f, 0.0985651165f},
-std::array<float,2>{0.0983313844f, 0.670255125f},
-std::array<float,2>{0.149776295f, 0.213528156f},
-std::array<float,2>{0.902867019f, 0.57330662f},
-std::array<float,2>{0.684308231f, 0.460022032f},
-std::array<float,2>{0.420279413f, 0.948685825f},
-std::array<float,2>{0.458784401f, 0.0448593199f},
-std::array<float,2>{0.747438073f, 0.736716509f},
-std::array<float,2>{0.997136354f, 0.333215088f},
-std::array<float,2>{0.19230327f, 0.819451869f},
-std::array<float,2>{0.0329465345f, 0.412496865f},
-std::array<float,2>{0.811334372f, 0.935263455f},
-std::array<float,2>{0.591253698f, 0.153197557f},
-std::array<float,2>{0.276840299f, 0.562080026f},
-std::array<float,2>{0.333831072f, 0.420905471f},
-std::array<float,2>{0.562400818f, 0.923337579f},
-std::array<float,2>{0.856028974f, 0.147315264f},
-std::array<float,2>{0.119787656f, 0.552516937f},
-std::array<float,2>{0.12650907f, 0.0312535502f},
-std::array<float,2>{0.883484423f, 0.74873966f},
-std::array<float,2>{0.657610178f, 0.343748271f},
-std::array<float,2>{0.428391546f, 0.825163305f},
-std::array<float,2>{0.439100385f, 0.210733205f},
-std::array<float,2>{0.733357966f, 0.563292742f},
-std::array<float,2>{0.982622743f, 0.462810487f},
-std::array<float,2>{0.212036297f, 0.94029963f},
-std::array<float,2>{0.0563243888f, 0.297474891f},
-std::array<float,2>{0.782013714f, 0.783132195f},
-std::array<float,2>{0.573044956f, 0.108560562f},
-std::array<float,2>{0.26241231f, 0.661368966f},
-std::array<float,2>{0.390182078f, 0.346716404f},
-std::array<float,2>{0.647934973f, 0.860545695f},
-std::array<float,2>{0.926716387f, 0.00281302445f},
-std::array<float,2>{0.157011479f, 0.709606051f},
-std::array<float,2>{0.0832097456f, 0.179950759f},
-std::array<float,2>{0.827452838f, 0.515913427f},
-std::array<float,2>{0.522653461f, 0.388592511f},
-std::array<float,2>{0.361430943f, 0.88412565f},
-std::array<float,2>{0.300232887f, 0.0754128546f},
-std::array<float,2>{0.622190118f, 0.64587456f},
-std::array<float,2>{0.756778181f, 0.278364748f},
-std::array<float,2>{0.00992546789f, 0.773759425f},
-std::array<float,2>{0.24440743f, 0.483064085f},
-std::array<float,2>{0.951809049f, 0.997919083f},
-std::array<float,2>{0.707058966f, 0.231184915f},
-std::array<float,2>{0.492865801f, 0.61620909f},
-std::array<float,2>{0.472256571f, 0.440127313f},
-std::array<float,2>{0.69646728f, 0.956818819f},
-std::array<float,2>{0.965838373f, 0.197874621f},
-std::array<float,2>{0.230079129f, 0.58915484f},
-std::array<float,2>{0.0247451346f, 0.113753691f},
-std::array<float,2>{0.770143926f, 0.680831194f},
-std::array<float,2>{0.60594368f, 0.286582947f},
-std::array<float,2>{0.281761438f, 0.799481153f},
-std::array<float,2>{0.353901565f, 0.131301016f},
-std::array<float,2>{0.508764148f, 0.53439784f},
-std::array<float,2>{0.842531502f, 0.426555783f},
-std::array<float,2>{0.0625165328f, 0.913308144f},
-std::array<float,2>{0.185732871f, 0.324096918f},
-std::array<float,2>{0.920764327f, 0.83926028f},
-std::array<float,2>{0.629881144f, 0.0606832393f},
-std::array<float,2>{0.394502699f, 0.73387599f},
-std::array<float,2>{0.279249847f, 0.260185957f},
-std::array<float,2>{0.588795662f, 0.753313601f},
-std::array<float,2>{0.805967748f, 0.0837308243f},
-std::array<float,2>{0.0387141816f, 0.635565579f},
-std::array<float,2>{0.191348091f, 0.239915773f},
-std::array<float,2>{0.992461026f, 0.59720999f},
-std::array<float,2>{0.742826104f, 0.497394353f},
-std::array<float,2>{0.454055637f, 0.971927762f},
-std::array<float,2>{0.417939186f, 0.0222570244f},
-std::array<float,2>{0.681072116f, 0.689770997f},
-std::array<float,2>{0.898594975f, 0.362209409f},
-std::array<float,2>{0.152662948f, 0.85663563f},
-std::array<float,2>{0.0962909609f, 0.396442741f},
-std::array<float,2>{0.866732895f, 0.903634787f},
-std::array<float,2>{0.538061619f, 0.169624299f},
-std::array<float,2>{0.321686715f, 0.506847799f},
-std::array<float,2>{0.296585083f, 0.491549373f},
-std::array<float,2>{0.600839674f, 0.981017113f},
-std::array<float,2>{0.781114459f, 0.243815541f},
-std::array<float,2>{0.0161464717f, 0.607576728f},
-std::array<float,2>{0.221244603f, 0.0893602744f},
-std::array<float,2>{0.954545259f, 0.627660155f},
-std::array<float,2>{0.690033555f, 0.255276293f},
-std::array<float,2>{0.484349072f, 0.763632178f},
-std::array<float,2>{0.402593762f, 0.159167364f},
-std::array<float,2>{0.639238417f, 0.509393454f},
-std::array<float,2>{0.910089016f, 0.401933253f},
-std::array<float,2>{0.176314816f, 0.892085075f},
-std::array<float,2>{0.0719445646f, 0.369897217f},
-std::array<float,2>{0.829215884f, 0.844343662f},
-std::array<float,2>{0.504985452f, 0.0303745922f},
-std::array<float,2>{0.346209288f, 0.700121343f},
-std::array<float,2>{0.46530816f, 0.292499304f},
-std::array<float,2>{0.740920126f, 0.809724092f},
-std::array<float,2>{0.990284026f, 0.121299237f},
-std::array<float,2>{0.19904919f, 0.677641571f},
-std::array<float,2>{0.0396176539f, 0.193849057f},
-std::array<float,2>{0.797704935f, 0.580160737f},
-std::array<float,2>{0.583601236f, 0.449073762f},
-std::array<float,2>{0.268891156f, 0.961655796f},
-std::array<float,2>{0.31993261f, 0.0526383445f},
-std::array<float,2>{0.542692482f, 0.719438314f},
-std::array<float,2>{0.872927248f, 0.316479951f},
-std::array<float,2>{0.102957219f, 0.828442574f},
-std::array<float,2>{0.143603787f, 0.436153322f},
-std::array<float,2>{0.895620823f, 0.914968431f},
-std::array<float,2>{0.673821211f, 0.139083982f},
-std::array<float,2>{0.41110611f, 0.541063845f},
-std::array<float,2>{0.430547029f, 0.382174671f},
-std::array<float,2>{0.670306504f, 0.87634331f},
-std::array<float,2>{0.88057363f, 0.179500729f},
-std::array<float,2>{0.138092443f, 0.528585374f},
-std::array<float,2>{0.111279085f, 0.00783873908f},
-std::array<float,2>{0.85042423f, 0.716714263f},
-std::array<float,2>{0.550003171f, 0.352414638f},
-std::array<float,2>{0.338389039f, 0.869775414f},
-std::array<float,2>{0.254280031f, 0.222258806f},
-std::array<float,2>{0.568606436f, 0.624885499f},
-std::array<float,2>{0.794021845f, 0.473111063f},
-std::array<float,2>{0.0480296239f, 0.990109324f},
-std::array<float,2>{0.204839915f, 0.271651655f},
-std::array<float,2>{0.975961566f, 0.77096498f},
-std::array<float,2>{0.721732855f, 0.0676288903f},
-std::array<float,2>{0.450237811f, 0.649249673f},
-std::array<float,2>{0.373366773f, 0.331778407f},
-std::array<float,2>{0.530804336f, 0.815020323f},
-std::array<float,2>{0.819623232f, 0.0409369282f},
-std::array<float,2>{0.0900059789f, 0.741677284f},
-std::array<float,2>{0.171849191f, 0.149096489f},
-std::array<float,2>{0.933281839f, 0.557266951f},
-std::array<float,2>{0.650396585f, 0.409481287f},
-std::array<float,2>{0.380669028f, 0.932535768f},
-std::array<float,2>{0.486761153f, 0.0960553288f},
-std::array<float,2>{0.716347456f, 0.664620638f},
-std::array<float,2>{0.939814091f, 0.307089657f},
-std::array<float,2>{0.235105619f, 0.790678144f},
-std::array<float,2>{0.00575493462f, 0.456087053f},
-std::array<float,2>{0.759923279f, 0.949234426f},
-std::array<float,2>{0.616931796f, 0.216876894f},
-std::array<float,2>{0.310338616f, 0.576451063f},
-std::array<float,2>{0.313042581f, 0.480318129f},
-std::array<float,2>{0.545446694f, 0.99407351f},
-std::array<float,2>{0.867932737f, 0.227232397f},
-std::array<float,2>{0.106994145f, 0.610281646f},
-std::array<float,2>{0.146954805f, 0.0734003112f},
-std::array<float,2>{0.892842829f, 0.643583477f},
-std::array<float,2>{0.678330481f, 0.274014205f},
-std::array<float,2>{0.409359902f, 0.777899384f},
-std::array<float,2>{0.46337387f, 0.186270401f},
-std::array<float,2>{0.73805517f, 0.521773994f},
-std::array<float,2>{0.98526752f, 0.383534491f},
-std::array<float,2>{0.202448547f, 0.887423277f},
-std::array<float,2>{0.0433221981f, 0.348216325f},
-std::array<float,2>{0.803119004f, 0.865292072f},
-std::array<float,2>{0.578490138f, 0.00755759003f},
-std::array<float,2>{0.270222574f, 0.704364359f},
-std::array<float,2>{0.400176793f, 0.304410934f},
-std::array<float,2>{0.636323512f, 0.78636688f},
-std::array<float,2>{0.912244976f, 0.104706131f},
-std::array<float,2>{0.173914418f, 0.659009516f},
-std::array<float,2>{0.0766073316f, 0.203471541f},
-std::array<float,2>{0.833605528f, 0.567807257f},
-std::array<float,2>{0.503528953f, 0.465357393f},
-std::array<float,2>{0.347814322f, 0.944622636f},
-std::array<float,2>{0.290342689f, 0.0387421139f},
-std::array<float,2>{0.594012201f, 0.746063113f},
-std::array<float,2>{0.773445487f, 0.337703556f},
-std::array<float,2>{0.0217267219f, 0.823301435f},
-std::array<float,2>{0.223126292f, 0.417313755f},
-std::array<float,2>{0.960465074f, 0.92693007f},
-std::array<float,2>{0.695046544f, 0.143041641f},
-std::array<float,2>{0.480160862f, 0.5473032f},
-std::array<float,2>{0.489067018f, 0.393143624f},
-std::array<float,2>{0.713064671f, 0.901992083f},
-std::array<float,2>{0.944716036f, 0.166425854f},
-std::array<float,2>{0.239247739f, 0.500697255f},
-std::array<float,2>{0.00229169917f, 0.0189120602f},
-std::array<float,2>{0.761988223f, 0.693736017f},
-std::array<float,2>{0.610649407f, 0.366719186f},
-std::array<float,2>{0.305847883f, 0.853929758f},
-std::array<float,2>{0.36818099f, 0.235346496f},
-std::array<float,2>{0.525375783f, 0.599277556f},
-std::array<float,2>{0.815239072f, 0.495887369f},
-std::array<float,2>{0.0860983208f, 0.973017573f},
-std::array<float,2>{0.167965382f, 0.265151232f},
-std::array<float,2>{0.936357081f, 0.757485211f},
-std::array<float,2>{0.656189561f, 0.0814275146f},
-std::array<float,2>{0.376060009f, 0.637987494f},
-std::array<float,2>{0.251742363f, 0.324222833f},
-std::array<float,2>{0.564413309f, 0.843722582f},
-std::array<float,2>{0.791811466f, 0.0573116317f},
-std::array<float,2>{0.0531082079f, 0.728626132f},
-std::array<float,2>{0.207663774f, 0.125764549f},
-std::array<float,2>{0.972599804f, 0.535615981f},
-std::array<float,2>{0.725729167f, 0.424787432f},
-std::array<float,2>{0.446909577f, 0.909057915f},
-std::array<float,2>{0.435848862f, 0.110994875f},
-std::array<float,2>{0.664587855f, 0.684478521f},
-std::array<float,2>{0.875392973f, 0.282242775f},
-std::array<float,2>{0.134597838f, 0.802937925f},
-std::array<float,2>{0.114930436f, 0.443356067f},
-std::array<float,2>{0.846212685f, 0.959091425f},
-std::array<float,2>{0.554335415f, 0.202080324f},
-std::array<float,2>{0.342034429f, 0.592525065f},
-std::array<float,2>{0.302580029f, 0.431337029f},
-std::array<float,2>{0.618896008f, 0.919426262f},
-std::array<float,2>{0.753744841f, 0.133871466f},
-std::array<float,2>{0.0141684758f, 0.545727909f},
-std::array<float,2>{0.248048201f, 0.0472491831f},
-std::array<float,2>{0.948264599f, 0.725279987f},
-std::array<float,2>{0.705386877f, 0.315238535f},
-std::array<float,2>{0.499155253f, 0.835078239f},
-std::array<float,2>{0.385386705f, 0.190697372f},
-std::array<float,2>{0.643287182f, 0.585255682f},
-std::array<float,2>{0.924337149f, 0.451654524f},
-std::array<float,2>{0.162149474f, 0.967692435f},
-std::array<float,2>{0.0793827549f, 0.29404366f},
-std::array<float,2>{0.822637618f, 0.805401087f},
-std::array<float,2>{0.517286301f, 0.119174182f},
-std::array<float,2>{0.365374863f, 0.672831476f},
-std::array<float,2>{0.4448919f, 0.373867273f},
-std::array<float,2>{0.729940593f, 0.848448634f},
-std::array<float,2>{0.980112672f, 0.0240014773f},
-std::array<float,2>{0.215033188f, 0.69584018f},
-std::array<float,2>{0.0605199449f, 0.162238896f},
-std::array<float,2>{0.789057791f, 0.512610614f},
-std::array<float,2>{0.575039685f, 0.402546257f},
-std::array<float,2>{0.260328948f, 0.896285295f},
-std::array<float,2>{0.32858032f, 0.0905371532f},
-std::array<float,2>{0.557687461f, 0.629653454f},
-std::array<float,2>{0.852381229f, 0.251020372f},
-std::array<float,2>{0.121250354f, 0.759825349f},
-std::array<float,2>{0.131601125f, 0.487218946f},
-std::array<float,2>{0.88686806f, 0.97750479f},
-std::array<float,2>{0.661320865f, 0.246626183f},
-std::array<float,2>{0.425481319f, 0.603985906f},
-std::array<float,2>{0.418307245f, 0.458128899f},
-std::array<float,2>{0.687400758f, 0.947000206f},
-std::array<float,2>{0.904929161f, 0.211109579f},
-std::array<float,2>{0.151403248f, 0.570421576f},
-std::array<float,2>{0.0997168571f, 0.0999937579f},
-std::array<float,2>{0.860055625f, 0.669742942f},
-std::array<float,2>{0.532051086f, 0.31228894f},
-std::array<float,2>{0.326591432f, 0.795868754f},
-std::array<float,2>{0.274088264f, 0.156206459f},
-std::array<float,2>{0.592923999f, 0.55897826f},
-std::array<float,2>{0.809352756f, 0.411989957f},
-std::array<float,2>{0.0347426124f, 0.935736358f},
-std::array<float,2>{0.194893137f, 0.335167319f},
-std::array<float,2>{0.998679042f, 0.817698777f},
-std::array<float,2>{0.748402357f, 0.0450646244f},
-std::array<float,2>{0.459482402f, 0.734818757f},
-std::array<float,2>{0.358580798f, 0.266932994f},
-std::array<float,2>{0.513746679f, 0.76717186f},
-std::array<float,2>{0.83829695f, 0.0643987209f},
-std::array<float,2>{0.0675376728f, 0.655481935f},
-std::array<float,2>{0.180863425f, 0.223296747f},
-std::array<float,2>{0.917755008f, 0.620760381f},
-std::array<float,2>{0.625483215f, 0.470159441f},
-std::array<float,2>{0.395588845f, 0.987491906f},
-std::array<float,2>{0.47373578f, 0.011730615f},
-std::array<float,2>{0.699896395f, 0.714097619f},
-std::array<float,2>{0.96143961f, 0.356598616f},
-std::array<float,2>{0.230895102f, 0.872005224f},
-std::array<float,2>{0.0286389589f, 0.376701653f},
-std::array<float,2>{0.766338885f, 0.880615592f},
-std::array<float,2>{0.604462087f, 0.174425319f},
-std::array<float,2>{0.288162947f, 0.524890661f},
-std::array<float,2>{0.360973597f, 0.389941007f},
-std::array<float,2>{0.520539224f, 0.885056913f},
-std::array<float,2>{0.825942457f, 0.182249978f},
-std::array<float,2>{0.0842872262f, 0.519386172f},
-std::array<float,2>{0.158581212f, 0.00144264719f},
-std::array<float,2>{0.92840755f, 0.707170784f},
-std::array<float,2>{0.645514786f, 0.344708055f},
-std::array<float,2>{0.388572901f, 0.86135906f},
-std::array<float,2>{0.495880574f, 0.232843891f},
-std::array<float,2>{0.709352314f, 0.613834262f},
-std::array<float,2>{0.950655699f, 0.481341034f},
-std::array<float,2>{0.243819535f, 0.999832928f},
-std::array<float,2>{0.00788664818f, 0.28113991f},
-std::array<float,2>{0.755565226f, 0.776709199f},
-std::array<float,2>{0.624397635f, 0.0774635002f},
-std::array<float,2>{0.297782958f, 0.647863209f},
-std::array<float,2>{0.427470088f, 0.341756284f},
-std::array<float,2>{0.659747303f, 0.827240109f},
-std::array<float,2>{0.886575103f, 0.0350543372f},
-std::array<float,2>{0.128272355f, 0.747261584f},
-std::array<float,2>{0.118487157f, 0.146324903f},
-std::array<float,2>{0.858268082f, 0.553952157f},
-std::array<float,2>{0.559799552f, 0.418475479f},
-std::array<float,2>{0.335101068f, 0.923906744f},
-std::array<float,2>{0.264434189f, 0.105708756f},
-std::array<float,2>{0.572106123f, 0.663171768f},
-std::array<float,2>{0.783514261f, 0.30038619f},
-std::array<float,2>{0.058453925f, 0.784676671f},
-std::array<float,2>{0.214137018f, 0.463241667f},
-std::array<float,2>{0.981318831f, 0.937541246f},
-std::array<float,2>{0.731164098f, 0.207532033f},
-std::array<float,2>{0.441139489f, 0.565410793f},
-std::array<float,2>{0.456515998f, 0.498198688f},
-std::array<float,2>{0.745862126f, 0.970184565f},
-std::array<float,2>{0.995386422f, 0.241720334f},
-std::array<float,2>{0.187671095f, 0.595117927f},
-std::array<float,2>{0.035790842f, 0.0853387192f},
-std::array<float,2>{0.808140695f, 0.634083033f},
-std::array<float,2>{0.58624506f, 0.258365214f},
-std::array<float,2>{0.279946089f, 0.751452148f},
-std::array<float,2>{0.324136287f, 0.170850486f},
-std::array<float,2>{0.5368945f, 0.505819559f},
-std::array<float,2>{0.864220321f, 0.396954119f},
-std::array<float,2>{0.0941641256f, 0.905089617f},
-std::array<float,2>{0.154777467f, 0.359517753f},
-std::array<float,2>{0.902160227f, 0.857901514f},
-std::array<float,2>{0.682147205f, 0.0212326106f},
-std::array<float,2>{0.415219188f, 0.687878489f},
-std::array<float,2>{0.283246607f, 0.287706137f},
-std::array<float,2>{0.607650995f, 0.798443854f},
-std::array<float,2>{0.771639109f, 0.115546212f},
-std::array<float,2>{0.0254872441f, 0.681931973f},
-std::array<float,2>{0.22771202f, 0.19593063f},
-std::array<float,2>{0.96858269f, 0.587582409f},
-std::array<float,2>{0.6972996f, 0.43884322f},
-std::array<float,2>{0.469382733f, 0.955069959f},
-std::array<float,2>{0.392068058f, 0.060386844f},
-std::array<float,2>{0.63106519f, 0.73160547f},
-std::array<float,2>{0.918212891f, 0.321304381f},
-std::array<float,2>{0.183858737f, 0.837176859f},
-std::array<float,2>{0.0657275766f, 0.42840156f},
-std::array<float,2>{0.840152919f, 0.910625398f},
-std::array<float,2>{0.510638595f, 0.130681887f},
-std::array<float,2>{0.353137732f, 0.531797171f},
-std::array<float,2>{0.265639275f, 0.445935994f},
-std::array<float,2>{0.585784912f, 0.963000357f},
-std::array<float,2>{0.800090611f, 0.192812085f},
-std::array<float,2>{0.0418200903f, 0.579302788f},
-std::array<float,2>{0.195939779f, 0.124168478f},
-std::array<float,2>{0.988809526f, 0.678722024f},
-std::array<float,2>{0.738565683f, 0.289417624f},
-std::array<float,2>{0.468729109f, 0.812165141f},
-std::array<float,2>{0.412759244f, 0.138308883f},
-std::array<float,2>{0.674112141f, 0.540674865f},
-std::array<float,2>{0.897434413f, 0.434469998f},
-std::array<float,2>{0.140950024f, 0.917497635f},
-std::array<float,2>{0.104805686f, 0.318671554f},
-std::array<float,2>{0.874088228f, 0.83060497f},
-std::array<float,2>{0.539678931f, 0.0540331751f},
-std::array<float,2>{0.316925585f, 0.722112775f},
-std::array<float,2>{0.481627882f, 0.25603354f},
-std::array<float,2>{0.689124823f, 0.764971972f},
-std::array<float,2>{0.956845701f, 0.0872783065f},
-std::array<float,2>{0.22061868f, 0.62516284f},
-std::array<float,2>{0.0191604607f, 0.244590193f},
-std::array<float,2>{0.777716041f, 0.606613338f},
-std::array<float,2>{0.598934591f, 0.488511682f},
-std::array<float,2>{0.294807792f, 0.982807815f},
-std::array<float,2>{0.344220132f, 0.0274217911f},
-std::array<float,2>{0.507489145f, 0.701717973f},
-std::array<float,2>{0.831000865f, 0.36767745f},
-std::array<float,2>{0.0724510029f, 0.846618533f},
-std::array<float,2>{0.179049671f, 0.39974907f},
-std::array<float,2>{0.906783223f, 0.892740726f},
-std::array<float,2>{0.638453424f, 0.157470465f},
-std::array<float,2>{0.405810148f, 0.510798395f},
-std::array<float,2>{0.381195694f, 0.407708645f},
-std::array<float,2>{0.649414897f, 0.930480719f},
-std::array<float,2>{0.930612445f, 0.151673988f},
-std::array<float,2>{0.168929726f, 0.55642128f},
-std::array<float,2>{0.0930531844f, 0.0423571393f},
-std::array<float,2>{0.817507386f, 0.738396823f},
-std::array<float,2>{0.527560174f, 0.329978943f},
-std::array<float,2>{0.371836126f, 0.81303978f},
-std::array<float,2>{0.31230855f, 0.216516897f},
-std::array<float,2>{0.614036202f, 0.574933946f},
-std::array<float,2>{0.758626163f, 0.454423457f},
-std::array<float,2>{0.00734813465f, 0.951788843f},
-std::array<float,2>{0.237880275f, 0.305464149f},
-std::array<float,2>{0.938714325f, 0.792595685f},
-std::array<float,2>{0.718571067f, 0.0943559408f},
-std::array<float,2>{0.484425098f, 0.667829454f},
-std::array<float,2>{0.336708963f, 0.353711486f},
-std::array<float,2>{0.54787761f, 0.867508113f},
-std::array<float,2>{0.848557055f, 0.010678675f},
-std::array<float,2>{0.111885823f, 0.717076659f},
-std::array<float,2>{0.138789624f, 0.177124158f},
-std::array<float,2>{0.882093489f, 0.531034827f},
-std::array<float,2>{0.668095052f, 0.380086124f},
-std::array<float,2>{0.433588743f, 0.877235234f},
-std::array<float,2>{0.451991975f, 0.0698436871f},
-std::array<float,2>{0.719567537f, 0.651910901f},
-std::array<float,2>{0.973650873f, 0.270875961f},
-std::array<float,2>{0.206147209f, 0.771924913f},
-std::array<float,2>{0.0499354117f, 0.474924922f},
-std::array<float,2>{0.795903802f, 0.990669787f},
-std::array<float,2>{0.567448735f, 0.219087511f},
-std::array<float,2>{0.257405609f, 0.621492088f},
-std::array<float,2>{0.326664746f, 0.460913152f},
-std::array<float,2>{0.531590641f, 0.948736489f},
-std::array<float,2>{0.859569371f, 0.213370845f},
-std::array<float,2>{0.100369625f, 0.574207067f},
-std::array<float,2>{0.152270615f, 0.0980315879f},
-std::array<float,2>{0.904329121f, 0.670658529f},
-std::array<float,2>{0.68680048f, 0.308603317f},
-std::array<float,2>{0.418777227f, 0.793612897f},
-std::array<float,2>{0.459320486f, 0.152619615f},
-std::array<float,2>{0.748614728f, 0.561938226f},
-std::array<float,2>{0.998373091f, 0.41305846f},
-std::array<float,2>{0.194452092f, 0.934877753f},
-std::array<float,2>{0.034351889f, 0.333946496f},
-std::array<float,2>{0.808896422f, 0.819932044f},
-std::array<float,2>{0.593725264f, 0.043992456f},
-std::array<float,2>{0.273651361f, 0.737162232f},
-std::array<float,2>{0.396261066f, 0.268253744f},
-std::array<float,2>{0.625743151f, 0.7678864f},
-std::array<float,2>{0.917234361f, 0.0649489537f},
-std::array<float,2>{0.181452185f, 0.653512716f},
-std::array<float,2>{0.068200089f, 0.226009518f},
-std::array<float,2>{0.838400424f, 0.618367851f},
-std::array<float,2>{0.514466226f, 0.471099377f},
-std::array<float,2>{0.35935843f, 0.986198127f},
-std::array<float,2>{0.288786381f, 0.0151570011f},
-std::array<float,2>{0.60359478f, 0.71168673f},
-std::array<float,2>{0.765983522f, 0.358776659f},
-std::array<float,2>{0.0292333793f, 0.873084486f},
-std::array<float,2>{0.231190637f, 0.377368152f},
-std::array<float,2>{0.961347342f, 0.882412255f},
-std::array<float,2>{0.699310184f, 0.172134578f},
-std::array<float,2>{0.474607021f, 0.525470197f},
-std::array<float,2>{0.499934971f, 0.432187527f},
-std::array<float,2>{0.705596507f, 0.921387136f},
-std::array<float,2>{0.949197471f, 0.134843737f},
-std::array<float,2>{0.248889491f, 0.544543684f},
-std::array<float,2>{0.0139584634f, 0.0491841771f},
-std::array<float,2>{0.753343821f, 0.723108053f},
-std::array<float,2>{0.618213952f, 0.312732726f},
-std::array<float,2>{0.301882863f, 0.833964765f},
-std::array<float,2>{0.365868777f, 0.188765272f},
-std::array<float,2>{0.516960919f, 0.582094133f},
-std::array<float,2>{0.823070943f, 0.45037356f},
-std::array<float,2>{0.0796668157f, 0.965060294f},
-std::array<float,2>{0.162909061f, 0.29523471f},
-std::array<float,2>{0.924063683f, 0.806699276f},
-std::array<float,2>{0.642946541f, 0.117855988f},
-std::array<float,2>{0.384893835f, 0.675389528f},
-std::array<float,2>{0.259929538f, 0.372923464f},
-std::array<float,2>{0.574674964f, 0.849735975f},
-std::array<float,2>{0.788116336f, 0.0256425459f},
-std::array<float,2>{0.0596938096f, 0.698237896f},
-std::array<float,2>{0.215427503f, 0.16122666f},
-std::array<float,2>{0.979694128f, 0.514307976f},
-std::array<float,2>{0.730332255f, 0.405069649f},
-std::array<float,2>{0.444693804f, 0.897157133f},
-std::array<float,2>{0.425219417f, 0.0922145247f},
-std::array<float,2>{0.661945522f, 0.632757246f},
-std::array<float,2>{0.887693405f, 0.253251106f},
-std::array<float,2>{0.131182045f, 0.759024203f},
-std::array<float,2>{0.121734299f, 0.486171335f},
-std::array<float,2>{0.851902008f, 0.980162203f},
-std::array<float,2>{0.558142006f, 0.248609617f},
-std::array<float,2>{0.328762352f, 0.602857471f},
-std::array<float,2>{0.306624234f, 0.391603947f},
-std::array<float,2>{0.610923886f, 0.899086714f},
-std::array<float,2>{0.762479842f, 0.164546162f},
-std::array<float,2>{0.00282396819f, 0.503602862f},
-std::array<float,2>{0.238339126f, 0.0173065066f},
-std::array<float,2>{0.945010483f, 0.691469491f},
-std::array<float,2>{0.713574588f, 0.364023536f},
-std::array<float,2>{0.488432795f, 0.851567209f},
-std::array<float,2>{0.376751184f, 0.236918122f},
-std::array<float,2>{0.655717194f, 0.601498604f},
-std::array<float,2>{0.935928464f, 0.492630154f},
-std::array<float,2>{0.16744487f, 0.975911796f},
-std::array<float,2>{0.0866151154f, 0.262629956f},
-std::array<float,2>{0.814823031f, 0.755351007f},
-std::array<float,2>{0.524421751f, 0.0789626241f},
-std::array<float,2>{0.369106412f, 0.638701081f},
-std::array<float,2>{0.446739346f, 0.327561677f},
-std::array<float,2>{0.726133108f, 0.840634048f},
-std::array<float,2>{0.971939027f, 0.0555330962f},
-std::array<float,2>{0.207506895f, 0.727048755f},
-std::array<float,2>{0.0533802696f, 0.128260821f},
-std::array<float,2>{0.791032135f, 0.538879871f},
-std::array<float,2>{0.563912451f, 0.422712892f},
-std::array<float,2>{0.251464576f, 0.907247901f},
-std::array<float,2>{0.342706561f, 0.112351455f},
-std::array<float,2>{0.553772092f, 0.68725729f},
-std::array<float,2>{0.846157014f, 0.284054905f},
-std::array<float,2>{0.114511773f, 0.802433431f},
-std::array<float,2>{0.134240195f, 0.444449902f},
-std::array<float,2>{0.875825346f, 0.95728153f},
-std::array<float,2>{0.664543033f, 0.199970961f},
-std::array<float,2>{0.436167628f, 0.589974105f},
-std::array<float,2>{0.409717172f, 0.477268577f},
-std::array<float,2>{0.677971661f, 0.995473981f},
-std::array<float,2>{0.893525481f, 0.229997247f},
-std::array<float,2>{0.14730975f, 0.612284124f},
-std::array<float,2>{0.106453761f, 0.0715464875f},
-std::array<float,2>{0.867262542f, 0.641966403f},
-std::array<float,2>{0.544927716f, 0.276762933f},
-std::array<float,2>{0.312589735f, 0.779650629f},
-std::array<float,2>{0.269588947f, 0.185495436f},
-std::array<float,2>{0.578727901f, 0.520173252f},
-std::array<float,2>{0.803281665f, 0.384931833f},
-std::array<float,2>{0.0437104553f, 0.889748216f},
-std::array<float,2>{0.203083158f, 0.349708259f},
-std::array<float,2>{0.984573722f, 0.86379993f},
-std::array<float,2>{0.737318158f, 0.00543028023f},
-std::array<float,2>{0.463599384f, 0.706428468f},
-std::array<float,2>{0.348159581f, 0.301240146f},
-std::array<float,2>{0.503388524f, 0.787372649f},
-std::array<float,2>{0.833167493f, 0.102362566f},
-std::array<float,2>{0.0766728893f, 0.657661974f},
-std::array<float,2>{0.174520284f, 0.20537959f},
-std::array<float,2>{0.912760258f, 0.568465531f},
-std::array<float,2>{0.635819018f, 0.467752963f},
-std::array<float,2>{0.399721652f, 0.942996562f},
-std::array<float,2>{0.479572773f, 0.0369198918f},
-std::array<float,2>{0.694738328f, 0.744118392f},
-std::array<float,2>{0.959967315f, 0.339182258f},
-std::array<float,2>{0.223552316f, 0.821917832f},
-std::array<float,2>{0.0220349561f, 0.414189845f},
-std::array<float,2>{0.773970544f, 0.929086685f},
-std::array<float,2>{0.594594836f, 0.142309979f},
-std::array<float,2>{0.290997118f, 0.549210966f},
-std::array<float,2>{0.371504098f, 0.409883916f},
-std::array<float,2>{0.528000474f, 0.932114959f},
-std::array<float,2>{0.818014324f, 0.148867205f},
-std::array<float,2>{0.0934381038f, 0.55692631f},
-std::array<float,2>{0.168214381f, 0.0403476544f},
-std::array<float,2>{0.930175662f, 0.741899133f},
-std::array<float,2>{0.650217235f, 0.331261456f},
-std::array<float,2>{0.381732851f, 0.81457603f},
-std::array<float,2>{0.48503834f, 0.217598051f},
-std::array<float,2>{0.718194842f, 0.576867044f},
-std::array<float,2>{0.938964903f, 0.456671327f},
-std::array<float,2>{0.237639055f, 0.949879587f},
-std::array<float,2>{0.00683949655f, 0.307206541f},
-std::array<float,2>{0.758183956f, 0.790076852f},
-std::array<float,2>{0.613693893f, 0.0962433964f},
-std::array<float,2>{0.311777234f, 0.66429472f},
-std::array<float,2>{0.43310371f, 0.351677567f},
-std::array<float,2>{0.668477356f, 0.869504929f},
-std::array<float,2>{0.882398844f, 0.00875315908f},
-std::array<float,2>{0.139335096f, 0.715949357f},
-std::array<float,2>{0.111630656f, 0.17901516f},
-std::array<float,2>{0.848007381f, 0.529029369f},
-std::array<float,2>{0.548747599f, 0.3825216f},
-std::array<float,2>{0.336268067f, 0.876862288f},
-std::array<float,2>{0.257159472f, 0.0679478124f},
-std::array<float,2>{0.567941427f, 0.648478925f},
-std::array<float,2>{0.796808839f, 0.272297144f},
-std::array<float,2>{0.0507620908f, 0.771075368f},
-std::array<float,2>{0.206596717f, 0.473283827f},
-std::array<float,2>{0.974415481f, 0.989459574f},
-std::array<float,2>{0.719202816f, 0.221900508f},
-std::array<float,2>{0.451224983f, 0.624314904f},
-std::array<float,2>{0.468246788f, 0.448264867f},
-std::array<float,2>{0.738811553f, 0.961024046f},
-std::array<float,2>{0.988654435f, 0.193524361f},
-std::array<float,2>{0.19566372f, 0.58072263f},
-std::array<float,2>{0.0414390862f, 0.121808924f},
-std::array<float,2>{0.80068785f, 0.67722249f},
-std::array<float,2>{0.585447431f, 0.292245299f},
-std::array<float,2>{0.26626721f, 0.810209513f},
-std::array<float,2>{0.316527098f, 0.139512107f},
-std::array<float,2>{0.5394364f, 0.541703105f},
-std::array<float,2>{0.874702334f, 0.435711592f},
-std::array<float,2>{0.105222732f, 0.914192498f},
-std::array<float,2>{0.141186088f, 0.317005217f},
-std::array<float,2>{0.896828234f, 0.828626454f},
-std::array<float,2>{0.674533367f, 0.0517795011f},
-std::array<float,2>{0.412208498f, 0.718787014f},
-std::array<float,2>{0.294055521f, 0.255585194f},
-std::array<float,2>{0.599291921f, 0.76303786f},
-std::array<float,2>{0.778231502f, 0.0892002806f},
-std::array<float,2>{0.01892961f, 0.627319515f},
-std::array<float,2>{0.220068038f, 0.243641987f},
-std::array<float,2>{0.956391811f, 0.60812372f},
-std::array<float,2>{0.688710093f, 0.492141932f},
-std::array<float,2>{0.48234731f, 0.980846882f},
-std::array<float,2>{0.40531075f, 0.030768238f},
-std::array<float,2>{0.637882888f, 0.699451923f},
-std::array<float,2>{0.906490624f, 0.369375259f},
-std::array<float,2>{0.179558203f, 0.84377712f},
-std::array<float,2>{0.0730720088f, 0.40159297f},
-std::array<float,2>{0.830314815f, 0.892477274f},
-std::array<float,2>{0.50705564f, 0.15841344f},
-std::array<float,2>{0.344243467f, 0.509119213f},
-std::array<float,2>{0.279433131f, 0.497672945f},
-std::array<float,2>{0.586549878f, 0.972187221f},
-std::array<float,2>{0.808021545f, 0.239514023f},
-std::array<float,2>{0.0352858268f, 0.596788108f},
-std::array<float,2>{0.188111395f, 0.0834116265f},
-std::array<float,2>{0.995957911f, 0.634881258f},
-std::array<float,2>{0.745268941f, 0.26071915f},
-std::array<float,2>{0.457003266f, 0.753794253f},
-std::array<float,2>{0.415971577f, 0.169250816f},
-std::array<float,2>{0.682050943f, 0.50754869f},
-std::array<float,2>{0.901844978f, 0.395520389f},
-std::array<float,2>{0.154867142f, 0.904073894f},
-std::array<float,2>{0.0943519101f, 0.361594558f},
-std::array<float,2>{0.86365962f, 0.857094824f},
-std::array<float,2>{0.536424756f, 0.0218133498f},
-std::array<float,2>{0.323278397f, 0.690076888f},
-std::array<float,2>{0.4687953f, 0.286663681f},
-std::array<float,2>{0.697890043f, 0.799007118f},
-std::array<float,2>{0.967978537f, 0.114038125f},
-std::array<float,2>{0.228079721f, 0.68130666f},
-std::array<float,2>{0.0261400025f, 0.197303966f},
-std::array<float,2>{0.772102416f, 0.589752257f},
-std::array<float,2>{0.607932389f, 0.439699531f},
-std::array<float,2>{0.28377533f, 0.956256449f},
-std::array<float,2>{0.35292846f, 0.0611317344f},
-std::array<float,2>{0.509955227f, 0.734348178f},
-std::array<float,2>{0.840705931f, 0.323305428f},
-std::array<float,2>{0.0659720749f, 0.839461446f},
-std::array<float,2>{0.184103489f, 0.426118553f},
-std::array<float,2>{0.918789029f, 0.913848042f},
-std::array<float,2>{0.631650388f, 0.131685793f},
-std::array<float,2>{0.392407984f, 0.535099089f},
-std::array<float,2>{0.388129801f, 0.387766927f},
-std::array<float,2>{0.646068931f, 0.884697318f},
-std::array<float,2>{0.928036451f, 0.180401593f},
-std::array<float,2>{0.158881187f, 0.516238749f},
-std::array<float,2>{0.0849404112f, 0.00240822858f},
-std::array<float,2>{0.825674891f, 0.709317207f},
-std::array<float,2>{0.521183908f, 0.347254038f},
-std::array<float,2>{0.360446036f, 0.860857368f},
-std::array<float,2>{0.296880335f, 0.230727196f},
-std::array<float,2>{0.624752104f, 0.615440786f},
-std::array<float,2>{0.755243301f, 0.482460022f},
-std::array<float,2>{0.00837561116f, 0.997444868f},
-std::array<float,2>{0.243211985f, 0.279212296f},
-std::array<float,2>{0.950930297f, 0.774337232f},
-std::array<float,2>{0.709717691f, 0.075765267f},
-std::array<float,2>{0.495434612f, 0.646285892f},
-std::array<float,2>{0.335844874f, 0.343175858f},
-std::array<float,2>{0.560082257f, 0.824524701f},
-std::array<float,2>{0.857880414f, 0.0321074948f},
-std::array<float,2>{0.11873775f, 0.748215139f},
-std::array<float,2>{0.128862873f, 0.146594614f},
-std::array<float,2>{0.885803521f, 0.55222255f},
-std::array<float,2>{0.659551263f, 0.421872914f},
-std::array<float,2>{0.426914811f, 0.923609853f},
-std::array<float,2>{0.440801412f, 0.109062068f},
-std::array<float,2>{0.730764866f, 0.661702335f},
-std::array<float,2>{0.980575681f, 0.297054559f},
-std::array<float,2>{0.214720324f, 0.782711685f},
-std::array<float,2>{0.0579531081f, 0.462287486f},
-std::array<float,2>{0.784064054f, 0.939623177f},
-std::array<float,2>{0.571695387f, 0.210126907f},
-std::array<float,2>{0.263998657f, 0.562746584f},
-std::array<float,2>{0.356962025f, 0.470262915f},
-std::array<float,2>{0.513461888f, 0.98810792f},
-std::array<float,2>{0.837451577f, 0.22299169f},
-std::array<float,2>{0.0696308687f, 0.620445132f},
-std::array<float,2>{0.182803914f, 0.0637335777f},
-std::array<float,2>{0.914434612f, 0.656044602f},
-std::array<float,2>{0.62737453f, 0.267101824f},
-std::array<float,2>{0.397501111f, 0.766855121f},
-std::array<float,2>{0.474917769f, 0.173996091f},
-std::array<float,2>{0.701605737f, 0.525098503f},
-std::array<float,2>{0.964050651f, 0.376129836f},
-std::array<float,2>{0.232627988f, 0.880019009f},
-std::array<float,2>{0.0312408265f, 0.357272327f},
-std::array<float,2>{0.768882215f, 0.871486902f},
-std::array<float,2>{0.602089703f, 0.012449583f},
-std::array<float,2>{0.286311835f, 0.714437723f},
-std::array<float,2>{0.420503497f, 0.311825693f},
-std::array<float,2>{0.683703303f, 0.795115292f},
-std::array<float,2>{0.902610898f, 0.100389808f},
-std::array<float,2>{0.149986878f, 0.668962717f},
-std::array<float,2>{0.0977549627f, 0.211774305f},
-std::array<float,2>{0.862086475f, 0.57098192f},
-std::array<float,2>{0.534130275f, 0.458958954f},
-std::array<float,2>{0.324366033f, 0.946438134f},
-std::array<float,2>{0.277045101f, 0.0454162359f},
-std::array<float,2>{0.591525674f, 0.735256672f},
-std::array<float,2>{0.810738027f, 0.335672885f},
-std::array<float,2>{0.0326915048f, 0.818118751f},
-std::array<float,2>{0.191712171f, 0.411536068f},
-std::array<float,2>{0.9977898f, 0.936357617f},
-std::array<float,2>{0.747976005f, 0.155456647f},
-std::array<float,2>{0.45848012f, 0.559488773f},
-std::array<float,2>{0.441886306f, 0.403050303f},
-std::array<float,2>{0.726914465f, 0.895737052f},
-std::array<float,2>{0.977573156f, 0.162748098f},
-std::array<float,2>{0.217577159f, 0.512139559f},
-std::array<float,2>{0.0614447333f, 0.0236299224f},
-std::array<float,2>{0.786510289f, 0.695442557f},
-std::array<float,2>{0.577546954f, 0.373489082f},
-std::array<float,2>{0.259744316f, 0.847734392f},
-std::array<float,2>{0.331369221f, 0.246568516f},
-std::array<float,2>{0.556556106f, 0.604059994f},
-std::array<float,2>{0.855072916f, 0.486484826f},
-std::array<float,2>{0.124268197f, 0.976959109f},
-std::array<float,2>{0.130129576f, 0.251850963f},
-std::array<float,2>{0.889585853f, 0.760490179f},
-std::array<float,2>{0.66215831f, 0.0900369063f},
-std::array<float,2>{0.42198506f, 0.629310131f},
-std::array<float,2>{0.304385006f, 0.314865947f},
-std::array<float,2>{0.620712221f, 0.835748315f},
-std::array<float,2>{0.750309229f, 0.0478307158f},
-std::array<float,2>{0.0122948932f, 0.724803805f},
-std::array<float,2>{0.248031631f, 0.134381577f},
-std::array<float,2>{0.94615519f, 0.545297563f},
-std::array<float,2>{0.705055714f, 0.430714935f},
-std::array<float,2>{0.497038603f, 0.919887245f},
-std::array<float,2>{0.383719236f, 0.119844466f},
-std::array<float,2>{0.641640663f, 0.672025442f},
-std::array<float,2>{0.922509253f, 0.294496775f},
-std::array<float,2>{0.160365224f, 0.805057526f},
-std::array<float,2>{0.0810083002f, 0.452022195f},
-std::array<float,2>{0.820968032f, 0.967140794f},
-std::array<float,2>{0.519238114f, 0.191358969f},
-std::array<float,2>{0.364146113f, 0.585798919f},
-std::array<float,2>{0.252639174f, 0.423845053f},
-std::array<float,2>{0.565125644f, 0.908658743f},
-std::array<float,2>{0.78931272f, 0.125285029f},
-std::array<float,2>{0.0526011288f, 0.535920024f},
-std::array<float,2>{0.210105956f, 0.057023678f},
-std::array<float,2>{0.969045162f, 0.729428589f},
-std::array<float,2>{0.722807288f, 0.325185597f},
-std::array<float,2>{0.44803825f, 0.842993498f},
-std::array<float,2>{0.435371697f, 0.201573357f},
-std::array<float,2>{0.666858554f, 0.592079818f},
-std::array<float,2>{0.87754786f, 0.442564249f},
-std::array<float,2>{0.13638249f, 0.959801197f},
-std::array<float,2>{0.115284033f, 0.283144236f},
-std::array<float,2>{0.844972491f, 0.803290725f},
-std::array<float,2>{0.551461995f, 0.11037726f},
-std::array<float,2>{0.339846343f, 0.68363446f},
-std::array<float,2>{0.490337908f, 0.366238505f},
-std::array<float,2>{0.71139878f, 0.854069531f},
-std::array<float,2>{0.943251073f, 0.0192728117f},
-std::array<float,2>{0.241471767f, 0.693875551f},
-std::array<float,2>{0.000580751512f, 0.166635677f},
-std::array<float,2>{0.765266538f, 0.500352025f},
-std::array<float,2>{0.612968981f, 0.392766356f},
-std::array<float,2>{0.307207108f, 0.901724458f},
-std::array<float,2>{0.369235665f, 0.0818675756f},
-std::array<float,2>{0.526132524f, 0.638583541f},
-std::array<float,2>{0.814289987f, 0.26501736f},
-std::array<float,2>{0.0881504118f, 0.757124364f},
-std::array<float,2>{0.165618449f, 0.495364636f},
-std::array<float,2>{0.935091794f, 0.973473072f},
-std::array<float,2>{0.65330404f, 0.234448954f},
-std::array<float,2>{0.378077924f, 0.598800421f},
-std::array<float,2>{0.401069254f, 0.465063363f},
-std::array<float,2>{0.634535253f, 0.944824517f},
-std::array<float,2>{0.910533547f, 0.203730747f},
-std::array<float,2>{0.172371462f, 0.568080187f},
-std::array<float,2>{0.0754733309f, 0.105432957f},
-std::array<float,2>{0.835033178f, 0.658217788f},
-std::array<float,2>{0.500990033f, 0.303842992f},
-std::array<float,2>{0.351471335f, 0.786691189f},
-std::array<float,2>{0.291552961f, 0.143069819f},
-std::array<float,2>{0.595812201f, 0.547508061f},
-std::array<float,2>{0.775860012f, 0.417609036f},
-std::array<float,2>{0.0209948439f, 0.927723765f},
-std::array<float,2>{0.226178616f, 0.337084323f},
-std::array<float,2>{0.957520902f, 0.823927164f},
-std::array<float,2>{0.691543818f, 0.0385184139f},
-std::array<float,2>{0.478056699f, 0.745248675f},
-std::array<float,2>{0.315264225f, 0.273778409f},
-std::array<float,2>{0.544811487f, 0.777644575f},
-std::array<float,2>{0.869579196f, 0.0740307719f},
-std::array<float,2>{0.108155832f, 0.644159794f},
-std::array<float,2>{0.145110279f, 0.226993382f},
-std::array<float,2>{0.892308235f, 0.609547257f},
-std::array<float,2>{0.676739633f, 0.479742348f},
-std::array<float,2>{0.407083184f, 0.993508041f},
-std::array<float,2>{0.461134911f, 0.00694732182f},
-std::array<float,2>{0.736127377f, 0.704808116f},
-std::array<float,2>{0.987775743f, 0.347898126f},
-std::array<float,2>{0.200297713f, 0.866130829f},
-std::array<float,2>{0.0460711904f, 0.382947505f},
-std::array<float,2>{0.802165926f, 0.886751413f},
-std::array<float,2>{0.581100702f, 0.185968786f},
-std::array<float,2>{0.272717506f, 0.522199512f},
-std::array<float,2>{0.338146538f, 0.380695969f},
-std::array<float,2>{0.550745487f, 0.877560437f},
-std::array<float,2>{0.84980613f, 0.177728549f},
-std::array<float,2>{0.11077065f, 0.530355692f},
-std::array<float,2>{0.138243482f, 0.00976932142f},
-std::array<float,2>{0.880092204f, 0.717422903f},
-std::array<float,2>{0.670472383f, 0.354377985f},
-std::array<float,2>{0.429724276f, 0.867851675f},
-std::array<float,2>{0.451065063f, 0.219278798f},
-std::array<float,2>{0.722334504f, 0.621811748f},
-std::array<float,2>{0.976295352f, 0.475157529f},
-std::array<float,2>{0.204513788f, 0.990897179f},
-std::array<float,2>{0.0484428778f, 0.271365434f},
-std::array<float,2>{0.794533372f, 0.772295117f},
-std::array<float,2>{0.569130361f, 0.069683969f},
-std::array<float,2>{0.254457921f, 0.651715517f},
-std::array<float,2>{0.380169332f, 0.32917428f},
-std::array<float,2>{0.651333213f, 0.812692821f},
-std::array<float,2>{0.932888985f, 0.0425079688f},
-std::array<float,2>{0.171200752f, 0.738959372f},
-std::array<float,2>{0.0903790072f, 0.152042657f},
-std::array<float,2>{0.820050061f, 0.5561409f},
-std::array<float,2>{0.530372977f, 0.407981098f},
-std::array<float,2>{0.373836726f, 0.930025995f},
-std::array<float,2>{0.309813917f, 0.0939459652f},
-std::array<float,2>{0.616352081f, 0.667405069f},
-std::array<float,2>{0.760291576f, 0.304797202f},
-std::array<float,2>{0.00488916598f, 0.792340457f},
-std::array<float,2>{0.234469131f, 0.45483166f},
-std::array<float,2>{0.940248787f, 0.951535702f},
-std::array<float,2>{0.715885401f, 0.216281876f},
-std::array<float,2>{0.48715052f, 0.574509859f},
-std::array<float,2>{0.483675778f, 0.488847524f},
-std::array<float,2>{0.689608574f, 0.983040273f},
-std::array<float,2>{0.954764843f, 0.244801968f},
-std::array<float,2>{0.221169069f, 0.607199788f},
-std::array<float,2>{0.0160414744f, 0.0874218494f},
-std::array<float,2>{0.780420244f, 0.625967205f},
-std::array<float,2>{0.601372302f, 0.256488651f},
-std::array<float,2>{0.296028852f, 0.765498996f},
-std::array<float,2>{0.346135318f, 0.157730043f},
-std::array<float,2>{0.505544841f, 0.511662722f},
-std::array<float,2>{0.830017447f, 0.40037024f},
-std::array<float,2>{0.071750693f, 0.893553495f},
-std::array<float,2>{0.176089823f, 0.367574006f},
-std::array<float,2>{0.909259856f, 0.845977664f},
-std::array<float,2>{0.639036298f, 0.0279772636f},
-std::array<float,2>{0.40326944f, 0.701564908f},
-std::array<float,2>{0.269223064f, 0.289603293f},
-std::array<float,2>{0.583247721f, 0.811563492f},
-std::array<float,2>{0.796928406f, 0.124799579f},
-std::array<float,2>{0.0393822677f, 0.679561198f},
-std::array<float,2>{0.198336661f, 0.192953557f},
-std::array<float,2>{0.990893483f, 0.580018103f},
-std::array<float,2>{0.740595162f, 0.445553482f},
-std::array<float,2>{0.465412945f, 0.963531852f},
-std::array<float,2>{0.410339445f, 0.054282777f},
-std::array<float,2>{0.672881603f, 0.722619295f},
-std::array<float,2>{0.896148682f, 0.31905511f},
-std::array<float,2>{0.144509286f, 0.830099821f},
-std::array<float,2>{0.103454128f, 0.433660567f},
-std::array<float,2>{0.872555792f, 0.917314053f},
-std::array<float,2>{0.542479694f, 0.137732536f},
-std::array<float,2>{0.3193385f, 0.540317535f},
-std::array<float,2>{0.28169623f, 0.439018965f},
-std::array<float,2>{0.60619694f, 0.954510212f},
-std::array<float,2>{0.769723535f, 0.195677787f},
-std::array<float,2>{0.0253008399f, 0.587007046f},
-std::array<float,2>{0.229499862f, 0.11596287f},
-std::array<float,2>{0.966506958f, 0.682307005f},
-std::array<float,2>{0.696914494f, 0.287224084f},
-std::array<float,2>{0.471942663f, 0.79832232f},
-std::array<float,2>{0.393973142f, 0.13029927f},
-std::array<float,2>{0.629136562f, 0.531559944f},
-std::array<float,2>{0.920179665f, 0.427845806f},
-std::array<float,2>{0.186075747f, 0.910988927f},
-std::array<float,2>{0.0632991195f, 0.322114229f},
-std::array<float,2>{0.84208405f, 0.837865233f},
-std::array<float,2>{0.507843256f, 0.0600145161f},
-std::array<float,2>{0.354215324f, 0.732172549f},
-std::array<float,2>{0.453453809f, 0.258005947f},
-std::array<float,2>{0.742281139f, 0.751520157f},
-std::array<float,2>{0.992963552f, 0.0858369842f},
-std::array<float,2>{0.190633133f, 0.63465637f},
-std::array<float,2>{0.0385577045f, 0.241472095f},
-std::array<float,2>{0.806330621f, 0.595636725f},
-std::array<float,2>{0.588235497f, 0.498904318f},
-std::array<float,2>{0.278804868f, 0.970665932f},
-std::array<float,2>{0.322036088f, 0.0207928289f},
-std::array<float,2>{0.537239611f, 0.688254178f},
-std::array<float,2>{0.866311371f, 0.360010743f},
-std::array<float,2>{0.0960441157f, 0.857917547f},
-std::array<float,2>{0.153215319f, 0.397402883f},
-std::array<float,2>{0.8989411f, 0.904497445f},
-std::array<float,2>{0.681604683f, 0.170037195f},
-std::array<float,2>{0.417189062f, 0.505144715f},
-std::array<float,2>{0.42785576f, 0.418449789f},
-std::array<float,2>{0.657971978f, 0.924385726f},
-std::array<float,2>{0.882827282f, 0.145725086f},
-std::array<float,2>{0.126454905f, 0.554519653f},
-std::array<float,2>{0.119549833f, 0.0342025496f},
-std::array<float,2>{0.855661929f, 0.747775555f},
-std::array<float,2>{0.561591446f, 0.341130465f},
-std::array<float,2>{0.333351761f, 0.828090847f},
-std::array<float,2>{0.262130588f, 0.20740056f},
-std::array<float,2>{0.572605073f, 0.564889193f},
-std::array<float,2>{0.781626046f, 0.463518173f},
-std::array<float,2>{0.0556785241f, 0.938127816f},
-std::array<float,2>{0.21264267f, 0.299832165f},
-std::array<float,2>{0.983123183f, 0.784205556f},
-std::array<float,2>{0.732661009f, 0.106019579f},
-std::array<float,2>{0.438714415f, 0.663970172f},
-std::array<float,2>{0.362201005f, 0.343979836f},
-std::array<float,2>{0.523062944f, 0.862009823f},
-std::array<float,2>{0.828033268f, 0.00161918241f},
-std::array<float,2>{0.0837781355f, 0.707987666f},
-std::array<float,2>{0.156730413f, 0.182093754f},
-std::array<float,2>{0.926130533f, 0.518993735f},
-std::array<float,2>{0.647957325f, 0.39057073f},
-std::array<float,2>{0.390060663f, 0.885556161f},
-std::array<float,2>{0.492237121f, 0.0780883878f},
-std::array<float,2>{0.707550287f, 0.648077726f},
-std::array<float,2>{0.951577604f, 0.28044948f},
-std::array<float,2>{0.244975656f, 0.777056694f},
-std::array<float,2>{0.010312208f, 0.480888128f},
-std::array<float,2>{0.756131589f, 0.999028623f},
-std::array<float,2>{0.622674704f, 0.233246326f},
-std::array<float,2>{0.30057624f, 0.613413692f},
-std::array<float,2>{0.364633739f, 0.449375659f},
-std::array<float,2>{0.518179536f, 0.966787457f},
-std::array<float,2>{0.82152915f, 0.187812448f},
-std::array<float,2>{0.0814797133f, 0.58332628f},
-std::array<float,2>{0.161362499f, 0.118820749f},
-std::array<float,2>{0.923259914f, 0.674199283f},
-std::array<float,2>{0.64093262f, 0.296402723f},
-std::array<float,2>{0.383974046f, 0.808270991f},
-std::array<float,2>{0.497978359f, 0.135874227f},
-std::array<float,2>{0.703614175f, 0.543564558f},
-std::array<float,2>{0.946905017f, 0.433095813f},
-std::array<float,2>{0.246872857f, 0.920647562f},
-std::array<float,2>{0.0131677976f, 0.314151078f},
-std::array<float,2>{0.751764655f, 0.832628131f},
-std::array<float,2>{0.619906545f, 0.0499981344f},
-std::array<float,2>{0.302823901f, 0.724181294f},
-std::array<float,2>{0.422864258f, 0.252061486f},
-std::array<float,2>{0.663196206f, 0.757972658f},
-std::array<float,2>{0.889798403f, 0.0930530503f},
-std::array<float,2>{0.129106805f, 0.631526232f},
-std::array<float,2>{0.123686559f, 0.249531105f},
-std::array<float,2>{0.854338229f, 0.601862967f},
-std::array<float,2>{0.555258155f, 0.484525025f},
-std::array<float,2>{0.33041653f, 0.979234517f},
-std::array<float,2>{0.258362621f, 0.0271673929f},
-std::array<float,2>{0.576781034f, 0.698724568f},
-std::array<float,2>{0.785450697f, 0.371384323f},
-std::array<float,2>{0.0617259964f, 0.851336181f},
-std::array<float,2>{0.217780501f, 0.405877769f},
-std::array<float,2>{0.977501571f, 0.897746921f},
-std::array<float,2>{0.728481114f, 0.160504803f},
-std::array<float,2>{0.442842871f, 0.515462339f},
-std::array<float,2>{0.457200438f, 0.413937598f},
-std::array<float,2>{0.747048616f, 0.933598161f},
-std::array<float,2>{0.996996939f, 0.153722078f},
-std::array<float,2>{0.192491785f, 0.561062336f},
-std::array<float,2>{0.0319778025f, 0.0437658913f},
-std::array<float,2>{0.812326252f, 0.737699986f},
-std::array<float,2>{0.590312421f, 0.332312137f},
-std::array<float,2>{0.275673747f, 0.818436503f},
-std::array<float,2>{0.325598419f, 0.214054927f},
-std::array<float,2>{0.534929812f, 0.572846591f},
-std::array<float,2>{0.863207102f, 0.459587544f},
-std::array<float,2>{0.0992379785f, 0.947744787f},
-std::array<float,2>{0.148905128f, 0.310261458f},
-std::array<float,2>{0.903536677f, 0.794293046f},
-std::array<float,2>{0.685158908f, 0.0991819426f},
-std::array<float,2>{0.42115891f, 0.671160519f},
-std::array<float,2>{0.285222352f, 0.357528269f},
-std::array<float,2>{0.60269922f, 0.874288261f},
-std::array<float,2>{0.768246233f, 0.0138106113f},
-std::array<float,2>{0.0296331421f, 0.712637544f},
-std::array<float,2>{0.233505845f, 0.173321664f},
-std::array<float,2>{0.963253677f, 0.52658397f},
-std::array<float,2>{0.702160358f, 0.378378481f},
-std::array<float,2>{0.475821227f, 0.881408334f},
-std::array<float,2>{0.39685142f, 0.0660775453f},
-std::array<float,2>{0.628722548f, 0.652637541f},
-std::array<float,2>{0.915453196f, 0.269165784f},
-std::array<float,2>{0.181810588f, 0.768977404f},
-std::array<float,2>{0.0688258335f, 0.472507298f},
-std::array<float,2>{0.836471796f, 0.985005856f},
-std::array<float,2>{0.512079835f, 0.224790812f},
-std::array<float,2>{0.355570644f, 0.617515206f},
-std::array<float,2>{0.271536112f, 0.386637598f},
-std::array<float,2>{0.580363393f, 0.888696849f},
-std::array<float,2>{0.801752806f, 0.183711916f},
-std::array<float,2>{0.0453184433f, 0.521062851f},
-std::array<float,2>{0.199570611f, 0.00402626442f},
-std::array<float,2>{0.986433208f, 0.7054196f},
-std::array<float,2>{0.735070229f, 0.350833118f},
-std::array<float,2>{0.462555438f, 0.864295244f},
-std::array<float,2>{0.408144802f, 0.228774041f},
-std::array<float,2>{0.677297652f, 0.612878799f},
-std::array<float,2>{0.891458094f, 0.477997571f},
-std::array<float,2>{0.145973325f, 0.99467212f},
-std::array<float,2>{0.109106734f, 0.276322007f},
-std::array<float,2>{0.870976329f, 0.780577958f},
-std::array<float,2>{0.543141425f, 0.0707059205f},
-std::array<float,2>{0.315453351f, 0.640917122f},
-std::array<float,2>{0.477055132f, 0.33866486f},
-std::array<float,2>{0.692967832f, 0.820327759f},
-std::array<float,2>{0.958467543f, 0.0360861123f},
-std::array<float,2>{0.225570872f, 0.742668748f},
-std::array<float,2>{0.0196922775f, 0.141556457f},
-std::array<float,2>{0.776482999f, 0.54996568f},
-std::array<float,2>{0.596980155f, 0.415533841f},
-std::array<float,2>{0.292309076f, 0.927883267f},
-std::array<float,2>{0.349956155f, 0.103444576f},
-std::array<float,2>{0.500091672f, 0.657067299f},
-std::array<float,2>{0.834760129f, 0.302404553f},
-std::array<float,2>{0.0742515475f, 0.789018035f},
-std::array<float,2>{0.173754886f, 0.467870325f},
-std::array<float,2>{0.911769092f, 0.941472292f},
-std::array<float,2>{0.633685589f, 0.206563458f},
-std::array<float,2>{0.401902467f, 0.570123315f},
-std::array<float,2>{0.377090424f, 0.494025767f},
-std::array<float,2>{0.654187918f, 0.975352705f},
-std::array<float,2>{0.934155285f, 0.237807989f},
-std::array<float,2>{0.164787427f, 0.599966824f},
-std::array<float,2>{0.0892241523f, 0.0796548873f},
-std::array<float,2>{0.813131213f, 0.64038378f},
-std::array<float,2>{0.526569247f, 0.262830675f},
-std::array<float,2>{0.370690256f, 0.754318833f},
-std::array<float,2>{0.308143556f, 0.165212363f},
-std::array<float,2>{0.612141013f, 0.502642989f},
-std::array<float,2>{0.76429373f, 0.391316772f},
-std::array<float,2>{0.00137840619f, 0.900024712f},
-std::array<float,2>{0.241180241f, 0.365140885f},
-std::array<float,2>{0.942258596f, 0.853101492f},
-std::array<float,2>{0.712789416f, 0.0160458907f},
-std::array<float,2>{0.492102891f, 0.693008184f},
-std::array<float,2>{0.341701686f, 0.284919262f},
-std::array<float,2>{0.552588224f, 0.801182508f},
-std::array<float,2>{0.844008267f, 0.111969762f},
-std::array<float,2>{0.117033742f, 0.68613863f},
-std::array<float,2>{0.135402292f, 0.20095329f},
-std::array<float,2>{0.878071964f, 0.591703117f},
-std::array<float,2>{0.66784513f, 0.444148093f},
-std::array<float,2>{0.433827281f, 0.958809793f},
-std::array<float,2>{0.449154645f, 0.0564560443f},
-std::array<float,2>{0.723932505f, 0.728204012f},
-std::array<float,2>{0.970155597f, 0.326961905f},
-std::array<float,2>{0.209552452f, 0.841219544f},
-std::array<float,2>{0.0512236096f, 0.423354328f},
-std::array<float,2>{0.790599048f, 0.90645051f},
-std::array<float,2>{0.566031933f, 0.127567083f},
-std::array<float,2>{0.253689408f, 0.538012087f},
-std::array<float,2>{0.318976492f, 0.436770201f},
-std::array<float,2>{0.541174114f, 0.915076256f},
-std::array<float,2>{0.872002125f, 0.139864251f},
-std::array<float,2>{0.101650886f, 0.542885065f},
-std::array<float,2>{0.142943799f, 0.050798215f},
-std::array<float,2>{0.895334423f, 0.719824493f},
-std::array<float,2>{0.672637045f, 0.318048328f},
-std::array<float,2>{0.411214232f, 0.830008626f},
-std::array<float,2>{0.466236651f, 0.194777951f},
-std::array<float,2>{0.741819382f, 0.581093431f},
-std::array<float,2>{0.991256595f, 0.447737217f},
-std::array<float,2>{0.197732657f, 0.962111056f},
-std::array<float,2>{0.0407896489f, 0.291734725f},
-std::array<float,2>{0.798150957f, 0.808853447f},
-std::array<float,2>{0.582865298f, 0.122147784f},
-std::array<float,2>{0.268040955f, 0.676208854f},
-std::array<float,2>{0.404090762f, 0.370807499f},
-std::array<float,2>{0.640527248f, 0.844942272f},
-std::array<float,2>{0.908500314f, 0.0300993845f},
-std::array<float,2>{0.177396029f, 0.701075017f},
-std::array<float,2>{0.0705609322f, 0.159203887f},
-std::array<float,2>{0.828583062f, 0.508431077f},
-std::array<float,2>{0.504740655f, 0.401020795f},
-std::array<float,2>{0.347650558f, 0.891079307f},
-std::array<float,2>{0.295467526f, 0.0883537531f},
-std::array<float,2>{0.599758446f, 0.628756523f},
-std::array<float,2>{0.77932632f, 0.254791766f},
-std::array<float,2>{0.0169328265f, 0.761721373f},
-std::array<float,2>{0.221841604f, 0.490602314f},
-std::array<float,2>{0.953371048f, 0.982034147f},
-std::array<float,2>{0.691265643f, 0.242554232f},
-std::array<float,2>{0.483008176f, 0.608569741f},
-std::array<float,2>{0.4873797f, 0.45539096f},
-std::array<float,2>{0.715542018f, 0.951155782f},
-std::array<float,2>{0.940515876f, 0.218544066f},
-std::array<float,2>{0.2356866f, 0.578033328f},
-std::array<float,2>{0.00411834382f, 0.0971595794f},
-std::array<float,2>{0.761585474f, 0.665526569f},
-std::array<float,2>{0.615326822f, 0.308528751f},
-std::array<float,2>{0.308947295f, 0.789913416f},
-std::array<float,2>{0.374775678f, 0.14963159f},
-std::array<float,2>{0.529817462f, 0.558258712f},
-std::array<float,2>{0.818849266f, 0.408625811f},
-std::array<float,2>{0.0911270753f, 0.933231413f},
-std::array<float,2>{0.170842931f, 0.330937624f},
-std::array<float,2>{0.931801319f, 0.816336036f},
-std::array<float,2>{0.652192056f, 0.0398333408f},
-std::array<float,2>{0.379399389f, 0.741056621f},
-std::array<float,2>{0.255407155f, 0.27300477f},
-std::array<float,2>{0.569464743f, 0.770165324f},
-std::array<float,2>{0.793217123f, 0.0671287924f},
-std::array<float,2>{0.0475038849f, 0.649593651f},
-std::array<float,2>{0.204014525f, 0.221605077f},
-std::array<float,2>{0.975538611f, 0.623700917f},
-std::array<float,2>{0.721140563f, 0.474580258f},
-std::array<float,2>{0.450170904f, 0.988365293f},
-std::array<float,2>{0.431224942f, 0.00897743832f},
-std::array<float,2>{0.671193957f, 0.715734005f},
-std::array<float,2>{0.879754782f, 0.353171855f},
-std::array<float,2>{0.137498423f, 0.870494306f},
-std::array<float,2>{0.110308483f, 0.381558269f},
-std::array<float,2>{0.851115644f, 0.875369608f},
-std::array<float,2>{0.548963606f, 0.178081319f},
-std::array<float,2>{0.339815557f, 0.528130054f},
-std::array<float,2>{0.299391329f, 0.484129012f},
-std::array<float,2>{0.621926665f, 0.996602118f},
-std::array<float,2>{0.757081211f, 0.232178971f},
-std::array<float,2>{0.0110812867f, 0.616318345f},
-std::array<float,2>{0.245938659f, 0.0749353021f},
-std::array<float,2>{0.952922106f, 0.644568145f},
-std::array<float,2>{0.708558083f, 0.277639568f},
-std::array<float,2>{0.493547767f, 0.775147617f},
-std::array<float,2>{0.389414161f, 0.181352004f},
-std::array<float,2>{0.646836996f, 0.517374039f},
-std::array<float,2>{0.927226067f, 0.386734635f},
-std::array<float,2>{0.157427862f, 0.883163691f},
-std::array<float,2>{0.0825712308f, 0.34582299f},
-std::array<float,2>{0.826255739f, 0.859416068f},
-std::array<float,2>{0.521925688f, 0.00309953769f},
-std::array<float,2>{0.363136411f, 0.710195065f},
-std::array<float,2>{0.438133538f, 0.298145384f},
-std::array<float,2>{0.734187484f, 0.781852961f},
-std::array<float,2>{0.983523726f, 0.107548885f},
-std::array<float,2>{0.211609095f, 0.66108489f},
-std::array<float,2>{0.0555837192f, 0.209700942f},
-std::array<float,2>{0.782687485f, 0.563748956f},
-std::array<float,2>{0.573347926f, 0.461758822f},
-std::array<float,2>{0.263397872f, 0.941398084f},
-std::array<float,2>{0.332445443f, 0.0326282792f},
-std::array<float,2>{0.561070323f, 0.749645412f},
-std::array<float,2>{0.856768548f, 0.342645377f},
-std::array<float,2>{0.120336987f, 0.825993419f},
-std::array<float,2>{0.125249803f, 0.420244902f},
-std::array<float,2>{0.883793235f, 0.922583461f},
-std::array<float,2>{0.656972885f, 0.147556081f},
-std::array<float,2>{0.429096073f, 0.551542759f},
-std::array<float,2>{0.416294456f, 0.394752949f},
-std::array<float,2>{0.680091858f, 0.903290451f},
-std::array<float,2>{0.899422944f, 0.168131784f},
-std::array<float,2>{0.153790206f, 0.506815851f},
-std::array<float,2>{0.0971782207f, 0.0228350479f},
-std::array<float,2>{0.865286708f, 0.690796375f},
-std::array<float,2>{0.538971245f, 0.36275509f},
-std::array<float,2>{0.320519477f, 0.855940163f},
-std::array<float,2>{0.277968585f, 0.238826469f},
-std::array<float,2>{0.58897388f, 0.595878959f},
-std::array<float,2>{0.804762959f, 0.496502101f},
-std::array<float,2>{0.037143562f, 0.971017659f},
-std::array<float,2>{0.189992636f, 0.261475563f},
-std::array<float,2>{0.99373579f, 0.752422333f},
-std::array<float,2>{0.743754148f, 0.0825324282f},
-std::array<float,2>{0.454310358f, 0.636326253f},
-std::array<float,2>{0.354909629f, 0.322308272f},
-std::array<float,2>{0.509152889f, 0.838260889f},
-std::array<float,2>{0.843485892f, 0.0624801815f},
-std::array<float,2>{0.0635165945f, 0.732904196f},
-std::array<float,2>{0.187064424f, 0.132513925f},
-std::array<float,2>{0.921821654f, 0.533667386f},
-std::array<float,2>{0.630721867f, 0.427513868f},
-std::array<float,2>{0.392813832f, 0.9122082f},
-std::array<float,2>{0.471194655f, 0.114784509f},
-std::array<float,2>{0.695460081f, 0.679999232f},
-std::array<float,2>{0.965234041f, 0.285977155f},
-std::array<float,2>{0.228553146f, 0.800363779f},
-std::array<float,2>{0.024150908f, 0.441024721f},
-std::array<float,2>{0.770617366f, 0.956048667f},
-std::array<float,2>{0.607221365f, 0.198497295f},
-std::array<float,2>{0.282832623f, 0.588037729f},
-std::array<float,2>{0.329338551f, 0.487886369f},
-std::array<float,2>{0.55686456f, 0.978369296f},
-std::array<float,2>{0.853421211f, 0.247231603f},
-std::array<float,2>{0.122626379f, 0.604833424f},
-std::array<float,2>{0.132067576f, 0.0913870558f},
-std::array<float,2>{0.888014972f, 0.630365789f},
-std::array<float,2>{0.66105473f, 0.25031209f},
-std::array<float,2>{0.42461136f, 0.761221707f},
-std::array<float,2>{0.443516493f, 0.16324088f},
-std::array<float,2>{0.728898704f, 0.51303345f},
-std::array<float,2>{0.979220629f, 0.403758019f},
-std::array<float,2>{0.216440707f, 0.895004272f},
-std::array<float,2>{0.0594525635f, 0.374658525f},
-std::array<float,2>{0.787578642f, 0.849389911f},
-std::array<float,2>{0.575756073f, 0.0244812891f},
-std::array<float,2>{0.261151642f, 0.696323335f},
-std::array<float,2>{0.385830164f, 0.293082118f},
-std::array<float,2>{0.643934667f, 0.806516826f},
-std::array<float,2>{0.925360203f, 0.120349079f},
-std::array<float,2>{0.163885295f, 0.673628688f},
-std::array<float,2>{0.0782810599f, 0.190329596f},
-std::array<float,2>{0.823600829f, 0.584192932f},
-std::array<float,2>{0.516326904f, 0.452831984f},
-std::array<float,2>{0.366529375f, 0.967886925f},
-std::array<float,2>{0.301392049f, 0.0487626046f},
-std::array<float,2>{0.617703974f, 0.725891531f},
-std::array<float,2>{0.752386749f, 0.315704554f},
-std::array<float,2>{0.0149229635f, 0.834197283f},
-std::array<float,2>{0.249285296f, 0.429734766f},
-std::array<float,2>{0.94813931f, 0.918722153f},
-std::array<float,2>{0.706076622f, 0.132837549f},
-std::array<float,2>{0.49856177f, 0.546470284f},
-std::array<float,2>{0.472679585f, 0.375154525f},
-std::array<float,2>{0.700644135f, 0.879320443f},
-std::array<float,2>{0.961989522f, 0.17560631f},
-std::array<float,2>{0.23218587f, 0.523737371f},
-std::array<float,2>{0.0282157045f, 0.0132657411f},
-std::array<float,2>{0.766785324f, 0.712920547f},
-std::array<float,2>{0.604914784f, 0.355900258f},
-std::array<float,2>{0.287350863f, 0.87290442f},
-std::array<float,2>{0.35805729f, 0.224080682f},
-std::array<float,2>{0.514860272f, 0.619701922f},
-std::array<float,2>{0.839676499f, 0.469243079f},
-std::array<float,2>{0.066438742f, 0.987018108f},
-std::array<float,2>{0.179963455f, 0.265908927f},
-std::array<float,2>{0.916295946f, 0.766362548f},
-std::array<float,2>{0.626907945f, 0.0626240894f},
-std::array<float,2>{0.394582212f, 0.654878497f},
-std::array<float,2>{0.275140494f, 0.334327906f},
-std::array<float,2>{0.592366755f, 0.81652689f},
-std::array<float,2>{0.810321033f, 0.0467511974f},
-std::array<float,2>{0.0336172879f, 0.73603797f},
-std::array<float,2>{0.193736911f, 0.154872999f},
-std::array<float,2>{0.999847353f, 0.559988797f},
-std::array<float,2>{0.749776602f, 0.410244465f},
-std::array<float,2>{0.459998369f, 0.93716222f},
-std::array<float,2>{0.419717491f, 0.100679345f},
-std::array<float,2>{0.685781896f, 0.668385684f},
-std::array<float,2>{0.905414939f, 0.311519027f},
-std::array<float,2>{0.150965735f, 0.796597302f},
-std::array<float,2>{0.101009086f, 0.457906872f},
-std::array<float,2>{0.860893548f, 0.946255863f},
-std::array<float,2>{0.533133149f, 0.212623641f},
-std::array<float,2>{0.328073293f, 0.572230637f},
-std::array<float,2>{0.289860904f, 0.416334182f},
-std::array<float,2>{0.594943821f, 0.92599833f},
-std::array<float,2>{0.774489284f, 0.144048929f},
-std::array<float,2>{0.0230958331f, 0.548054218f},
-std::array<float,2>{0.223930776f, 0.0371310115f},
-std::array<float,2>{0.959649384f, 0.74416995f},
-std::array<float,2>{0.69392395f, 0.336855412f},
-std::array<float,2>{0.479243875f, 0.823190629f},
-std::array<float,2>{0.399180502f, 0.204637006f},
-std::array<float,2>{0.635521114f, 0.566969633f},
-std::array<float,2>{0.913289189f, 0.466225475f},
-std::array<float,2>{0.175444558f, 0.943903625f},
-std::array<float,2>{0.0779324621f, 0.302794725f},
-std::array<float,2>{0.832462072f, 0.78560257f},
-std::array<float,2>{0.502902567f, 0.103908926f},
-std::array<float,2>{0.349363625f, 0.659344614f},
-std::array<float,2>{0.464153141f, 0.349481136f},
-std::array<float,2>{0.73634243f, 0.866651535f},
-std::array<float,2>{0.985758781f, 0.00630969182f},
-std::array<float,2>{0.201959208f, 0.703434348f},
-std::array<float,2>{0.0442090295f, 0.187164024f},
-std::array<float,2>{0.80371362f, 0.523300111f},
-std::array<float,2>{0.579815805f, 0.384566903f},
-std::array<float,2>{0.271368414f, 0.887821078f},
-std::array<float,2>{0.313767046f, 0.0723577887f},
-std::array<float,2>{0.546718359f, 0.643117547f},
-std::array<float,2>{0.868926823f, 0.274765432f},
-std::array<float,2>{0.10607101f, 0.778714836f},
-std::array<float,2>{0.14825049f, 0.479252845f},
-std::array<float,2>{0.894092798f, 0.992351711f},
-std::array<float,2>{0.679218292f, 0.228477597f},
-std::array<float,2>{0.408583611f, 0.611159384f},
-std::array<float,2>{0.436792582f, 0.441604018f},
-std::array<float,2>{0.665157616f, 0.960767627f},
-std::array<float,2>{0.876610994f, 0.202389225f},
-std::array<float,2>{0.133289859f, 0.593393981f},
-std::array<float,2>{0.114252545f, 0.10987059f},
-std::array<float,2>{0.847057402f, 0.685443282f},
-std::array<float,2>{0.553191602f, 0.281396836f},
-std::array<float,2>{0.343052208f, 0.803919435f},
-std::array<float,2>{0.250051558f, 0.126841024f},
-std::array<float,2>{0.563220501f, 0.536717892f},
-std::array<float,2>{0.792876184f, 0.424823433f},
-std::array<float,2>{0.0543636046f, 0.909743428f},
-std::array<float,2>{0.208486006f, 0.325664252f},
-std::array<float,2>{0.971105874f, 0.841868401f},
-std::array<float,2>{0.724791348f, 0.0583726913f},
-std::array<float,2>{0.44561395f, 0.730050266f},
-std::array<float,2>{0.367589325f, 0.264070213f},
-std::array<float,2>{0.524032176f, 0.75664705f},
-std::array<float,2>{0.816371739f, 0.0808522627f},
-std::array<float,2>{0.0876866952f, 0.637643695f},
-std::array<float,2>{0.166431352f, 0.236124098f},
-std::array<float,2>{0.937433004f, 0.598077238f},
-std::array<float,2>{0.654641628f, 0.494262367f},
-std::array<float,2>{0.37511304f, 0.973811686f},
-std::array<float,2>{0.490095943f, 0.0177680366f},
-std::array<float,2>{0.714593649f, 0.695215404f},
-std::array<float,2>{0.943524122f, 0.36619705f},
-std::array<float,2>{0.2401914f, 0.855389118f},
-std::array<float,2>{0.00325299148f, 0.39357239f},
-std::array<float,2>{0.763427734f, 0.901222348f},
-std::array<float,2>{0.609994709f, 0.167417645f},
-std::array<float,2>{0.305362761f, 0.501062274f},
-std::array<float,2>{0.345188797f, 0.399140954f},
-std::array<float,2>{0.506358922f, 0.894104183f},
-std::array<float,2>{0.831330478f, 0.156654447f},
-std::array<float,2>{0.0734881833f, 0.510647237f},
-std::array<float,2>{0.178510845f, 0.0287279915f},
-std::array<float,2>{0.908076763f, 0.702492833f},
-std::array<float,2>{0.637610018f, 0.368476987f},
-std::array<float,2>{0.405045211f, 0.84668386f},
-std::array<float,2>{0.480962604f, 0.245360896f},
-std::array<float,2>{0.687931418f, 0.605632186f},
-std::array<float,2>{0.955623388f, 0.489718795f},
-std::array<float,2>{0.218928829f, 0.983456969f},
-std::array<float,2>{0.0179677717f, 0.257168114f},
-std::array<float,2>{0.778534472f, 0.764136434f},
-std::array<float,2>{0.598345935f, 0.0867467821f},
-std::array<float,2>{0.293632239f, 0.626579404f},
-std::array<float,2>{0.413767904f, 0.320003837f},
-std::array<float,2>{0.675058663f, 0.831447721f},
-std::array<float,2>{0.89833051f, 0.05367155f},
-std::array<float,2>{0.142328039f, 0.720785856f},
-std::array<float,2>{0.104060568f, 0.136746302f},
-std::array<float,2>{0.873878956f, 0.53908962f},
-std::array<float,2>{0.540959597f, 0.435468137f},
-std::array<float,2>{0.318060607f, 0.916072667f},
-std::array<float,2>{0.267433017f, 0.123127431f},
-std::array<float,2>{0.584959567f, 0.678231597f},
-std::array<float,2>{0.798972189f, 0.290843427f},
-std::array<float,2>{0.0420051515f, 0.810668528f},
-std::array<float,2>{0.196441829f, 0.446545124f},
-std::array<float,2>{0.989844859f, 0.963999748f},
-std::array<float,2>{0.739459217f, 0.191631839f},
-std::array<float,2>{0.467291981f, 0.578675568f},
-std::array<float,2>{0.452187449f, 0.475854427f},
-std::array<float,2>{0.720160186f, 0.991901577f},
-std::array<float,2>{0.972996414f, 0.220061496f},
-std::array<float,2>{0.205442622f, 0.622203171f},
-std::array<float,2>{0.0492244363f, 0.0689009875f},
-std::array<float,2>{0.795476317f, 0.651360035f},
-std::array<float,2>{0.566860378f, 0.270082623f},
-std::array<float,2>{0.255868733f, 0.773070395f},
-std::array<float,2>{0.337156832f, 0.175883502f},
-std::array<float,2>{0.547637641f, 0.529698431f},
-std::array<float,2>{0.849244297f, 0.379388213f},
-std::array<float,2>{0.112343132f, 0.878272533f},
-std::array<float,2>{0.139803529f, 0.354932159f},
-std::array<float,2>{0.881617963f, 0.86845386f},
-std::array<float,2>{0.669351816f, 0.0108268196f},
-std::array<float,2>{0.432320744f, 0.718365371f},
-std::array<float,2>{0.311404854f, 0.30615136f},
-std::array<float,2>{0.614590764f, 0.791871846f},
-std::array<float,2>{0.759638965f, 0.0955636799f},
-std::array<float,2>{0.00587990182f, 0.666317523f},
-std::array<float,2>{0.236503094f, 0.215026855f},
-std::array<float,2>{0.937992454f, 0.576125324f},
-std::array<float,2>{0.716803193f, 0.453197151f},
-std::array<float,2>{0.486202091f, 0.952624798f},
-std::array<float,2>{0.382256031f, 0.041426897f},
-std::array<float,2>{0.649276733f, 0.739898622f},
-std::array<float,2>{0.931110024f, 0.32826525f},
-std::array<float,2>{0.169879526f, 0.813545763f},
-std::array<float,2>{0.0924245268f, 0.406700134f},
-std::array<float,2>{0.816590369f, 0.930769563f},
-std::array<float,2>{0.528925657f, 0.151353836f},
-std::array<float,2>{0.372404099f, 0.554776907f},
-std::array<float,2>{0.265475273f, 0.464683712f},
-std::array<float,2>{0.570652187f, 0.938669384f},
-std::array<float,2>{0.784621477f, 0.208454266f},
-std::array<float,2>{0.0574121438f, 0.566171288f},
-std::array<float,2>{0.213433921f, 0.106946483f},
-std::array<float,2>{0.981754065f, 0.662143469f},
-std::array<float,2>{0.73146224f, 0.299578935f},
-std::array<float,2>{0.440288872f, 0.783265054f},
-std::array<float,2>{0.426231533f, 0.144759879f},
-std::array<float,2>{0.658601046f, 0.553357184f},
-std::array<float,2>{0.884965599f, 0.419620693f},
-std::array<float,2>{0.127499714f, 0.925298214f},
-std::array<float,2>{0.117696427f, 0.340099007f},
-std::array<float,2>{0.858602166f, 0.827124059f},
-std::array<float,2>{0.55956775f, 0.03398652f},
-std::array<float,2>{0.334044367f, 0.746242046f},
-std::array<float,2>{0.494186491f, 0.280208945f},
-std::array<float,2>{0.710520685f, 0.775693476f},
-std::array<float,2>{0.949624836f, 0.0766675994f},
-std::array<float,2>{0.242858812f, 0.647442997f},
-std::array<float,2>{0.00899337512f, 0.233810201f},
-std::array<float,2>{0.75443399f, 0.615152419f},
-std::array<float,2>{0.623884082f, 0.481568664f},
-std::array<float,2>{0.297946602f, 0.998949647f},
-std::array<float,2>{0.360278994f, 0.000184471035f},
-std::array<float,2>{0.520133853f, 0.708520114f},
-std::array<float,2>{0.824425757f, 0.34493497f},
-std::array<float,2>{0.0855904222f, 0.862326622f},
-std::array<float,2>{0.160107717f, 0.38872394f},
-std::array<float,2>{0.928712308f, 0.886387706f},
-std::array<float,2>{0.645257533f, 0.182949975f},
-std::array<float,2>{0.387450308f, 0.517807603f},
-std::array<float,2>{0.390653193f, 0.429460138f},
-std::array<float,2>{0.632241428f, 0.911816299f},
-std::array<float,2>{0.919746339f, 0.129411831f},
-std::array<float,2>{0.184935242f, 0.532920778f},
-std::array<float,2>{0.0649089441f, 0.0592807792f},
-std::array<float,2>{0.841460347f, 0.730963171f},
-std::array<float,2>{0.511322677f, 0.320937872f},
-std::array<float,2>{0.352477401f, 0.836323082f},
-std::array<float,2>{0.284830868f, 0.19658789f},
-std::array<float,2>{0.609003186f, 0.586676717f},
-std::array<float,2>{0.772779942f, 0.437912226f},
-std::array<float,2>{0.0270115547f, 0.954073727f},
-std::array<float,2>{0.226960793f, 0.288515866f},
-std::array<float,2>{0.967128575f, 0.797699034f},
-std::array<float,2>{0.698891461f, 0.116251349f},
-std::array<float,2>{0.469732314f, 0.682831228f},
-std::array<float,2>{0.322507054f, 0.361223847f},
-std::array<float,2>{0.535990298f, 0.858406365f},
-std::array<float,2>{0.865173459f, 0.0196692739f},
-std::array<float,2>{0.0952683613f, 0.689368129f},
-std::array<float,2>{0.15535906f, 0.171803236f},
-std::array<float,2>{0.900694907f, 0.50405705f},
-std::array<float,2>{0.683371842f, 0.397684902f},
-std::array<float,2>{0.414811939f, 0.905465901f},
-std::array<float,2>{0.455366254f, 0.0843722895f},
-std::array<float,2>{0.745047331f, 0.63298291f},
-std::array<float,2>{0.99418658f, 0.259282291f},
-std::array<float,2>{0.18873851f, 0.750890613f},
-std::array<float,2>{0.0366646573f, 0.499678165f},
-std::array<float,2>{0.807145417f, 0.96941191f},
-std::array<float,2>{0.586943269f, 0.241186723f},
-std::array<float,2>{0.280664444f, 0.594294488f}}
\ No newline at end of file
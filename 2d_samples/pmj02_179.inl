@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.791066945f, 0.0430324301f},
-std::array<float,2>{0.032268092f, 0.573862731f},
-std::array<float,2>{0.485302061f, 0.396706522f},
-std::array<float,2>{0.622139156f, 0.888899207f},
-std::array<float,2>{0.645902932f, 0.271004409f},
-std::array<float,2>{0.368682891f, 0.867113411f},
-std::array<float,2>{0.143804088f, 0.218836442f},
-std::array<float,2>{0.973320007f, 0.631247282f},
-std::array<float,2>{0.518841505f, 0.143330485f},
-std::array<float,2>{0.405861109f, 0.741297364f},
-std::array<float,2>{0.0765821263f, 0.321143389f},
-std::array<float,2>{0.853294075f, 0.774159014f},
-std::array<float,2>{0.908645034f, 0.463413417f},
-std::array<float,2>{0.237532839f, 0.94600153f},
-std::array<float,2>{0.253064215f, 0.113780029f},
-std::array<float,2>{0.695484877f, 0.560304284f},
-std::array<float,2>{0.957816124f, 0.200761169f},
-std::array<float,2>{0.164651901f, 0.668613315f},
-std::array<float,2>{0.331534952f, 0.309644282f},
-std::array<float,2>{0.68167311f, 0.821072936f},
-std::array<float,2>{0.584115744f, 0.433515042f},
-std::array<float,2>{0.450654477f, 0.920745671f},
-std::array<float,2>{0.00359432655f, 0.0157345869f},
-std::array<float,2>{0.750348806f, 0.604741752f},
-std::array<float,2>{0.737485826f, 0.0833354294f},
-std::array<float,2>{0.308034837f, 0.526340842f},
-std::array<float,2>{0.198856369f, 0.486892134f},
-std::array<float,2>{0.891123176f, 0.976694882f},
-std::array<float,2>{0.82146275f, 0.34629184f},
-std::array<float,2>{0.108501807f, 0.798535645f},
-std::array<float,2>{0.433039039f, 0.181480616f},
-std::array<float,2>{0.533824861f, 0.712417722f},
-std::array<float,2>{0.876505077f, 0.104265928f},
-std::array<float,2>{0.218636677f, 0.53788656f},
-std::array<float,2>{0.286146998f, 0.43998158f},
-std::array<float,2>{0.725591004f, 0.954867244f},
-std::array<float,2>{0.555763781f, 0.330715984f},
-std::array<float,2>{0.412669569f, 0.760406673f},
-std::array<float,2>{0.118597738f, 0.133947164f},
-std::array<float,2>{0.828537345f, 0.728391409f},
-std::array<float,2>{0.656810522f, 0.247838259f},
-std::array<float,2>{0.313508451f, 0.650814176f},
-std::array<float,2>{0.1867183f, 0.254596621f},
-std::array<float,2>{0.950603962f, 0.849538326f},
-std::array<float,2>{0.776329398f, 0.376546949f},
-std::array<float,2>{0.0237015132f, 0.895968616f},
-std::array<float,2>{0.456986725f, 0.0599475168f},
-std::array<float,2>{0.568023741f, 0.587243915f},
-std::array<float,2>{0.871300697f, 0.161344856f},
-std::array<float,2>{0.0914952382f, 0.694591761f},
-std::array<float,2>{0.376206726f, 0.37494877f},
-std::array<float,2>{0.508287132f, 0.791699708f},
-std::array<float,2>{0.707209766f, 0.47410056f},
-std::array<float,2>{0.275292903f, 0.996884823f},
-std::array<float,2>{0.22082071f, 0.0743063539f},
-std::array<float,2>{0.923914969f, 0.502728879f},
-std::array<float,2>{0.596620977f, 0.000491104554f},
-std::array<float,2>{0.479898036f, 0.619481087f},
-std::array<float,2>{0.0488117151f, 0.411962271f},
-std::array<float,2>{0.802975357f, 0.93252784f},
-std::array<float,2>{0.984821975f, 0.285151333f},
-std::array<float,2>{0.138197392f, 0.833290577f},
-std::array<float,2>{0.349888772f, 0.214890242f},
-std::array<float,2>{0.634813845f, 0.679154932f},
-std::array<float,2>{0.840271413f, 0.0697860941f},
-std::array<float,2>{0.115126163f, 0.513160586f},
-std::array<float,2>{0.42121008f, 0.477955878f},
-std::array<float,2>{0.551322103f, 0.987708509f},
-std::array<float,2>{0.732292652f, 0.367174834f},
-std::array<float,2>{0.289131314f, 0.785078287f},
-std::array<float,2>{0.209720373f, 0.168387905f},
-std::array<float,2>{0.890169263f, 0.696734726f},
-std::array<float,2>{0.5719769f, 0.204895705f},
-std::array<float,2>{0.465483189f, 0.683016598f},
-std::array<float,2>{0.0225513857f, 0.295740277f},
-std::array<float,2>{0.773315191f, 0.836200714f},
-std::array<float,2>{0.93815589f, 0.417662382f},
-std::array<float,2>{0.177506134f, 0.929283261f},
-std::array<float,2>{0.323370367f, 0.0153493667f},
-std::array<float,2>{0.665188313f, 0.616628766f},
-std::array<float,2>{0.930873156f, 0.130710915f},
-std::array<float,2>{0.227079436f, 0.720460057f},
-std::array<float,2>{0.266486973f, 0.339351505f},
-std::array<float,2>{0.713175058f, 0.752650201f},
-std::array<float,2>{0.50225395f, 0.452942133f},
-std::array<float,2>{0.389723212f, 0.968424201f},
-std::array<float,2>{0.0790350437f, 0.100463718f},
-std::array<float,2>{0.859651864f, 0.539173603f},
-std::array<float,2>{0.630286038f, 0.051499337f},
-std::array<float,2>{0.35748443f, 0.584839761f},
-std::array<float,2>{0.131587714f, 0.385802835f},
-std::array<float,2>{0.997454166f, 0.905340612f},
-std::array<float,2>{0.804819942f, 0.265298426f},
-std::array<float,2>{0.0548014119f, 0.858041346f},
-std::array<float,2>{0.469257653f, 0.235790059f},
-std::array<float,2>{0.602704048f, 0.644588888f},
-std::array<float,2>{0.97883606f, 0.0265675746f},
-std::array<float,2>{0.151367351f, 0.595935166f},
-std::array<float,2>{0.360503405f, 0.427879006f},
-std::array<float,2>{0.653367043f, 0.907213151f},
-std::array<float,2>{0.611541986f, 0.297011137f},
-std::array<float,2>{0.494819999f, 0.812819362f},
-std::array<float,2>{0.0446281247f, 0.192442298f},
-std::array<float,2>{0.78703934f, 0.657771766f},
-std::array<float,2>{0.693024516f, 0.177222162f},
-std::array<float,2>{0.259289265f, 0.705287755f},
-std::array<float,2>{0.247223228f, 0.353043646f},
-std::array<float,2>{0.915345728f, 0.810076237f},
-std::array<float,2>{0.849394262f, 0.497000903f},
-std::array<float,2>{0.0697259679f, 0.973754585f},
-std::array<float,2>{0.394201905f, 0.0918286592f},
-std::array<float,2>{0.529702306f, 0.51601404f},
-std::array<float,2>{0.761689425f, 0.232995421f},
-std::array<float,2>{0.00840874109f, 0.639257193f},
-std::array<float,2>{0.445228279f, 0.275647461f},
-std::array<float,2>{0.592504799f, 0.872735381f},
-std::array<float,2>{0.674615443f, 0.401410401f},
-std::array<float,2>{0.34093675f, 0.88243264f},
-std::array<float,2>{0.160464153f, 0.0362708941f},
-std::array<float,2>{0.961142004f, 0.566043973f},
-std::array<float,2>{0.539718509f, 0.118333094f},
-std::array<float,2>{0.427615345f, 0.554268658f},
-std::array<float,2>{0.0969552472f, 0.458527237f},
-std::array<float,2>{0.812598884f, 0.940275431f},
-std::array<float,2>{0.902962863f, 0.318793118f},
-std::array<float,2>{0.192333415f, 0.77057302f},
-std::array<float,2>{0.298679948f, 0.154411614f},
-std::array<float,2>{0.744549334f, 0.742890239f},
-std::array<float,2>{0.858801007f, 0.00956110191f},
-std::array<float,2>{0.0734456778f, 0.611585319f},
-std::array<float,2>{0.401860207f, 0.418588489f},
-std::array<float,2>{0.523264706f, 0.923458457f},
-std::array<float,2>{0.69931978f, 0.290037572f},
-std::array<float,2>{0.256990433f, 0.840367675f},
-std::array<float,2>{0.238932684f, 0.208508015f},
-std::array<float,2>{0.911669433f, 0.686982989f},
-std::array<float,2>{0.621033549f, 0.165684134f},
-std::array<float,2>{0.490331322f, 0.701693416f},
-std::array<float,2>{0.0356467664f, 0.363140792f},
-std::array<float,2>{0.793300033f, 0.787180305f},
-std::array<float,2>{0.97261411f, 0.48372525f},
-std::array<float,2>{0.147847146f, 0.989185095f},
-std::array<float,2>{0.372696072f, 0.0642392263f},
-std::array<float,2>{0.641953468f, 0.508850157f},
-std::array<float,2>{0.898119152f, 0.240240574f},
-std::array<float,2>{0.202135697f, 0.64313215f},
-std::array<float,2>{0.31137082f, 0.258561015f},
-std::array<float,2>{0.740994155f, 0.854825914f},
-std::array<float,2>{0.538941443f, 0.386996955f},
-std::array<float,2>{0.435037911f, 0.8986938f},
-std::array<float,2>{0.102381177f, 0.0494574346f},
-std::array<float,2>{0.827916503f, 0.57889396f},
-std::array<float,2>{0.684755266f, 0.0949357003f},
-std::array<float,2>{0.334363788f, 0.544982612f},
-std::array<float,2>{0.168627918f, 0.445880204f},
-std::array<float,2>{0.956697583f, 0.964376867f},
-std::array<float,2>{0.756296337f, 0.340203822f},
-std::array<float,2>{0.00654690294f, 0.754753709f},
-std::array<float,2>{0.448597014f, 0.12790449f},
-std::array<float,2>{0.581536651f, 0.724555731f},
-std::array<float,2>{0.949037731f, 0.0869972184f},
-std::array<float,2>{0.180007592f, 0.520764053f},
-std::array<float,2>{0.317293674f, 0.493725479f},
-std::array<float,2>{0.660918951f, 0.969391108f},
-std::array<float,2>{0.565702438f, 0.356630325f},
-std::array<float,2>{0.459702432f, 0.808380425f},
-std::array<float,2>{0.0275383163f, 0.17334573f},
-std::array<float,2>{0.78054738f, 0.707162797f},
-std::array<float,2>{0.71959132f, 0.188039035f},
-std::array<float,2>{0.284239322f, 0.662165701f},
-std::array<float,2>{0.212958083f, 0.301497877f},
-std::array<float,2>{0.880199373f, 0.8189798f},
-std::array<float,2>{0.833742857f, 0.422981828f},
-std::array<float,2>{0.122671418f, 0.91172123f},
-std::array<float,2>{0.408683449f, 0.0305385292f},
-std::array<float,2>{0.562366068f, 0.599194705f},
-std::array<float,2>{0.800013185f, 0.149312049f},
-std::array<float,2>{0.0516275018f, 0.7480672f},
-std::array<float,2>{0.483170331f, 0.314571053f},
-std::array<float,2>{0.597897589f, 0.767872036f},
-std::array<float,2>{0.639738083f, 0.455396503f},
-std::array<float,2>{0.345963925f, 0.944448531f},
-std::array<float,2>{0.13321276f, 0.123910397f},
-std::array<float,2>{0.989616871f, 0.549309134f},
-std::array<float,2>{0.512071133f, 0.0326291844f},
-std::array<float,2>{0.381612122f, 0.568970799f},
-std::array<float,2>{0.0872533172f, 0.403990567f},
-std::array<float,2>{0.868159235f, 0.87588191f},
-std::array<float,2>{0.928884447f, 0.278182894f},
-std::array<float,2>{0.224081323f, 0.868955076f},
-std::array<float,2>{0.28019616f, 0.226997524f},
-std::array<float,2>{0.706151664f, 0.636205316f},
-std::array<float,2>{0.767776728f, 0.113008268f},
-std::array<float,2>{0.0159446821f, 0.556036115f},
-std::array<float,2>{0.462217838f, 0.467275441f},
-std::array<float,2>{0.575228691f, 0.952322066f},
-std::array<float,2>{0.670282841f, 0.325580955f},
-std::array<float,2>{0.326373547f, 0.779252648f},
-std::array<float,2>{0.172514603f, 0.146253884f},
-std::array<float,2>{0.944893897f, 0.735907853f},
-std::array<float,2>{0.549379766f, 0.2236709f},
-std::array<float,2>{0.417126238f, 0.625104249f},
-std::array<float,2>{0.111255601f, 0.268163979f},
-std::array<float,2>{0.838908732f, 0.860460997f},
-std::array<float,2>{0.88539201f, 0.394257486f},
-std::array<float,2>{0.20414038f, 0.883642733f},
-std::array<float,2>{0.29636246f, 0.0407715887f},
-std::array<float,2>{0.727060556f, 0.574826658f},
-std::array<float,2>{0.992650628f, 0.185880646f},
-std::array<float,2>{0.125188902f, 0.715037763f},
-std::array<float,2>{0.352258652f, 0.348895758f},
-std::array<float,2>{0.62718761f, 0.803849518f},
-std::array<float,2>{0.609335363f, 0.489736617f},
-std::array<float,2>{0.476200521f, 0.981596947f},
-std::array<float,2>{0.0586855784f, 0.0790047273f},
-std::array<float,2>{0.810433745f, 0.530315816f},
-std::array<float,2>{0.715726733f, 0.0207370035f},
-std::array<float,2>{0.273294151f, 0.606841207f},
-std::array<float,2>{0.233584195f, 0.435487002f},
-std::array<float,2>{0.935865998f, 0.91430974f},
-std::array<float,2>{0.866435528f, 0.308285862f},
-std::array<float,2>{0.08565294f, 0.828111887f},
-std::array<float,2>{0.384686291f, 0.196211234f},
-std::array<float,2>{0.504688084f, 0.66556704f},
-std::array<float,2>{0.920777738f, 0.0577528067f},
-std::array<float,2>{0.246092886f, 0.591513455f},
-std::array<float,2>{0.264668375f, 0.381674051f},
-std::array<float,2>{0.687584877f, 0.894083917f},
-std::array<float,2>{0.523539066f, 0.250382632f},
-std::array<float,2>{0.395620167f, 0.84643662f},
-std::array<float,2>{0.0646140501f, 0.244323865f},
-std::array<float,2>{0.844646692f, 0.655922353f},
-std::array<float,2>{0.650946617f, 0.138114452f},
-std::array<float,2>{0.366271079f, 0.732489526f},
-std::array<float,2>{0.155853674f, 0.334966898f},
-std::array<float,2>{0.982136369f, 0.76182586f},
-std::array<float,2>{0.784594178f, 0.442733318f},
-std::array<float,2>{0.0403517634f, 0.959353328f},
-std::array<float,2>{0.499334067f, 0.107290015f},
-std::array<float,2>{0.61652261f, 0.535099089f},
-std::array<float,2>{0.818938553f, 0.211387902f},
-std::array<float,2>{0.0999456123f, 0.674846411f},
-std::array<float,2>{0.423161358f, 0.288786113f},
-std::array<float,2>{0.544244528f, 0.828783751f},
-std::array<float,2>{0.748247743f, 0.407718748f},
-std::array<float,2>{0.301890463f, 0.937319398f},
-std::array<float,2>{0.189282075f, 0.0049882913f},
-std::array<float,2>{0.900217295f, 0.623952329f},
-std::array<float,2>{0.58889997f, 0.0712898672f},
-std::array<float,2>{0.439962357f, 0.50553751f},
-std::array<float,2>{0.0154734226f, 0.470172852f},
-std::array<float,2>{0.765006006f, 0.994188786f},
-std::array<float,2>{0.968379915f, 0.370288312f},
-std::array<float,2>{0.158754349f, 0.795405686f},
-std::array<float,2>{0.337900281f, 0.159030825f},
-std::array<float,2>{0.679210901f, 0.689994693f},
-std::array<float,2>{0.752461851f, 0.0183051955f},
-std::array<float,2>{0.000626824331f, 0.602402627f},
-std::array<float,2>{0.452042967f, 0.431119889f},
-std::array<float,2>{0.583306253f, 0.91967684f},
-std::array<float,2>{0.681449294f, 0.310959041f},
-std::array<float,2>{0.32870695f, 0.823010623f},
-std::array<float,2>{0.167888969f, 0.202283129f},
-std::array<float,2>{0.959687352f, 0.671489239f},
-std::array<float,2>{0.531257272f, 0.182393417f},
-std::array<float,2>{0.430957556f, 0.713398635f},
-std::array<float,2>{0.106742226f, 0.345553696f},
-std::array<float,2>{0.823456645f, 0.799755633f},
-std::array<float,2>{0.894345999f, 0.485691577f},
-std::array<float,2>{0.195680127f, 0.979348302f},
-std::array<float,2>{0.306404442f, 0.0847754404f},
-std::array<float,2>{0.735615432f, 0.524739861f},
-std::array<float,2>{0.97613132f, 0.22181575f},
-std::array<float,2>{0.142355457f, 0.62985307f},
-std::array<float,2>{0.369485497f, 0.272599548f},
-std::array<float,2>{0.648119926f, 0.864383399f},
-std::array<float,2>{0.62437892f, 0.39464882f},
-std::array<float,2>{0.486347616f, 0.887800157f},
-std::array<float,2>{0.0336658321f, 0.0456946678f},
-std::array<float,2>{0.790911734f, 0.572252572f},
-std::array<float,2>{0.697343171f, 0.116989903f},
-std::array<float,2>{0.250377476f, 0.562307656f},
-std::array<float,2>{0.235327408f, 0.462734997f},
-std::array<float,2>{0.907210529f, 0.948684633f},
-std::array<float,2>{0.855416417f, 0.323763132f},
-std::array<float,2>{0.0760511309f, 0.776864707f},
-std::array<float,2>{0.403634012f, 0.141222343f},
-std::array<float,2>{0.517355919f, 0.739024997f},
-std::array<float,2>{0.922245502f, 0.0772988424f},
-std::array<float,2>{0.219724044f, 0.500702262f},
-std::array<float,2>{0.275649816f, 0.476468682f},
-std::array<float,2>{0.710035205f, 0.999600172f},
-std::array<float,2>{0.511033595f, 0.37284407f},
-std::array<float,2>{0.378333092f, 0.790187061f},
-std::array<float,2>{0.0926284939f, 0.162642255f},
-std::array<float,2>{0.873470366f, 0.691500962f},
-std::array<float,2>{0.632930756f, 0.218579188f},
-std::array<float,2>{0.347935408f, 0.676591039f},
-std::array<float,2>{0.140341267f, 0.282031536f},
-std::array<float,2>{0.986966014f, 0.834504008f},
-std::array<float,2>{0.801179171f, 0.413441986f},
-std::array<float,2>{0.0493547581f, 0.93091917f},
-std::array<float,2>{0.477272004f, 0.0034288303f},
-std::array<float,2>{0.595039964f, 0.617604434f},
-std::array<float,2>{0.831660032f, 0.134875715f},
-std::array<float,2>{0.120027639f, 0.728736103f},
-std::array<float,2>{0.411130488f, 0.328938037f},
-std::array<float,2>{0.557755172f, 0.758319438f},
-std::array<float,2>{0.723918438f, 0.438914567f},
-std::array<float,2>{0.28836906f, 0.955707014f},
-std::array<float,2>{0.215491965f, 0.102037892f},
-std::array<float,2>{0.877489805f, 0.535471499f},
-std::array<float,2>{0.568848431f, 0.0607165396f},
-std::array<float,2>{0.453308254f, 0.589149654f},
-std::array<float,2>{0.0260472335f, 0.377301008f},
-std::array<float,2>{0.775002897f, 0.898436725f},
-std::array<float,2>{0.952214181f, 0.256929636f},
-std::array<float,2>{0.184120268f, 0.850891471f},
-std::array<float,2>{0.316308975f, 0.249138772f},
-std::array<float,2>{0.658290863f, 0.649233341f},
-std::array<float,2>{0.861410916f, 0.099507533f},
-std::array<float,2>{0.080210723f, 0.542521954f},
-std::array<float,2>{0.387373716f, 0.450789839f},
-std::array<float,2>{0.500626504f, 0.965720773f},
-std::array<float,2>{0.712591767f, 0.337435216f},
-std::array<float,2>{0.26922527f, 0.750776172f},
-std::array<float,2>{0.228537142f, 0.131226301f},
-std::array<float,2>{0.933171988f, 0.722088635f},
-std::array<float,2>{0.605062604f, 0.238163248f},
-std::array<float,2>{0.472390473f, 0.647336662f},
-std::array<float,2>{0.0579494201f, 0.262810946f},
-std::array<float,2>{0.806899905f, 0.857182026f},
-std::array<float,2>{0.998759508f, 0.384732187f},
-std::array<float,2>{0.129700363f, 0.902928472f},
-std::array<float,2>{0.356442511f, 0.0536436923f},
-std::array<float,2>{0.63193953f, 0.582833409f},
-std::array<float,2>{0.887355983f, 0.17184554f},
-std::array<float,2>{0.20864597f, 0.699172318f},
-std::array<float,2>{0.292891264f, 0.36497429f},
-std::array<float,2>{0.733871579f, 0.782196999f},
-std::array<float,2>{0.552863777f, 0.478995413f},
-std::array<float,2>{0.41864422f, 0.984586358f},
-std::array<float,2>{0.117175855f, 0.0671153069f},
-std::array<float,2>{0.843119025f, 0.515554845f},
-std::array<float,2>{0.66667515f, 0.0133141018f},
-std::array<float,2>{0.321690261f, 0.613988578f},
-std::array<float,2>{0.179677129f, 0.414816707f},
-std::array<float,2>{0.940716505f, 0.926462352f},
-std::array<float,2>{0.769890666f, 0.294816524f},
-std::array<float,2>{0.0199788474f, 0.838352442f},
-std::array<float,2>{0.466955662f, 0.205805019f},
-std::array<float,2>{0.572743595f, 0.681579292f},
-std::array<float,2>{0.963757098f, 0.0389094129f},
-std::array<float,2>{0.162668303f, 0.564285219f},
-std::array<float,2>{0.342572987f, 0.398821771f},
-std::array<float,2>{0.673047185f, 0.880792916f},
-std::array<float,2>{0.590637684f, 0.274534434f},
-std::array<float,2>{0.442786336f, 0.873330653f},
-std::array<float,2>{0.010459668f, 0.231577069f},
-std::array<float,2>{0.759099543f, 0.637191296f},
-std::array<float,2>{0.743432879f, 0.153986767f},
-std::array<float,2>{0.299215585f, 0.7455374f},
-std::array<float,2>{0.19373557f, 0.316620827f},
-std::array<float,2>{0.904690206f, 0.772396445f},
-std::array<float,2>{0.815798819f, 0.45923093f},
-std::array<float,2>{0.09464439f, 0.938767076f},
-std::array<float,2>{0.429177254f, 0.120696038f},
-std::array<float,2>{0.542809963f, 0.551824033f},
-std::array<float,2>{0.788330674f, 0.194326192f},
-std::array<float,2>{0.0465757363f, 0.659353614f},
-std::array<float,2>{0.492342323f, 0.300204784f},
-std::array<float,2>{0.610918045f, 0.815951288f},
-std::array<float,2>{0.6552912f, 0.42626518f},
-std::array<float,2>{0.363163501f, 0.909279108f},
-std::array<float,2>{0.148576528f, 0.0252249129f},
-std::array<float,2>{0.978374958f, 0.595495403f},
-std::array<float,2>{0.527682364f, 0.09031073f},
-std::array<float,2>{0.392522901f, 0.518497765f},
-std::array<float,2>{0.0666587055f, 0.498261899f},
-std::array<float,2>{0.850799799f, 0.975656331f},
-std::array<float,2>{0.917197824f, 0.354066312f},
-std::array<float,2>{0.249278918f, 0.810656011f},
-std::array<float,2>{0.261346608f, 0.179521769f},
-std::array<float,2>{0.694594383f, 0.703353405f},
-std::array<float,2>{0.824499667f, 0.0470723473f},
-std::array<float,2>{0.104976371f, 0.581809521f},
-std::array<float,2>{0.436565429f, 0.390142262f},
-std::array<float,2>{0.536372781f, 0.900559723f},
-std::array<float,2>{0.73851788f, 0.261369199f},
-std::array<float,2>{0.310480207f, 0.852320731f},
-std::array<float,2>{0.199722245f, 0.239966184f},
-std::array<float,2>{0.895394444f, 0.642531633f},
-std::array<float,2>{0.578624547f, 0.125823081f},
-std::array<float,2>{0.446124822f, 0.725069702f},
-std::array<float,2>{0.00452339556f, 0.342871547f},
-std::array<float,2>{0.75496769f, 0.756974757f},
-std::array<float,2>{0.953902125f, 0.44893983f},
-std::array<float,2>{0.17014125f, 0.962486446f},
-std::array<float,2>{0.332692415f, 0.096499078f},
-std::array<float,2>{0.686915457f, 0.543981552f},
-std::array<float,2>{0.913778901f, 0.210287899f},
-std::array<float,2>{0.240546539f, 0.685007334f},
-std::array<float,2>{0.255422354f, 0.29206565f},
-std::array<float,2>{0.701276898f, 0.843665957f},
-std::array<float,2>{0.520426929f, 0.419941276f},
-std::array<float,2>{0.399966091f, 0.925461113f},
-std::array<float,2>{0.0719036385f, 0.0112528503f},
-std::array<float,2>{0.855718315f, 0.610208273f},
-std::array<float,2>{0.644253969f, 0.0660065264f},
-std::array<float,2>{0.374657065f, 0.511515617f},
-std::array<float,2>{0.146411255f, 0.482265949f},
-std::array<float,2>{0.969253302f, 0.990778983f},
-std::array<float,2>{0.795127869f, 0.359524667f},
-std::array<float,2>{0.03717741f, 0.785518348f},
-std::array<float,2>{0.488879293f, 0.166930914f},
-std::array<float,2>{0.618207812f, 0.6996243f},
-std::array<float,2>{0.991197467f, 0.122734971f},
-std::array<float,2>{0.136171505f, 0.547956705f},
-std::array<float,2>{0.344130665f, 0.453317642f},
-std::array<float,2>{0.637098193f, 0.94311744f},
-std::array<float,2>{0.600194931f, 0.313396931f},
-std::array<float,2>{0.481996566f, 0.767255723f},
-std::array<float,2>{0.0542875715f, 0.15203689f},
-std::array<float,2>{0.797183812f, 0.747997463f},
-std::array<float,2>{0.705040932f, 0.228655562f},
-std::array<float,2>{0.27831158f, 0.633263528f},
-std::array<float,2>{0.225221753f, 0.28078264f},
-std::array<float,2>{0.926166415f, 0.869822145f},
-std::array<float,2>{0.869765818f, 0.404949993f},
-std::array<float,2>{0.0880711824f, 0.878081143f},
-std::array<float,2>{0.380089283f, 0.0338283516f},
-std::array<float,2>{0.514564276f, 0.567743897f},
-std::array<float,2>{0.778841794f, 0.175385356f},
-std::array<float,2>{0.0301747397f, 0.710479558f},
-std::array<float,2>{0.458557397f, 0.358526766f},
-std::array<float,2>{0.563615382f, 0.806001246f},
-std::array<float,2>{0.6621961f, 0.494913012f},
-std::array<float,2>{0.319911182f, 0.972222149f},
-std::array<float,2>{0.183393717f, 0.0885388777f},
-std::array<float,2>{0.945348203f, 0.521698713f},
-std::array<float,2>{0.558903813f, 0.0275042765f},
-std::array<float,2>{0.408158153f, 0.599658608f},
-std::array<float,2>{0.123482704f, 0.424425155f},
-std::array<float,2>{0.83583945f, 0.91309762f},
-std::array<float,2>{0.880887151f, 0.303715706f},
-std::array<float,2>{0.211192355f, 0.816939592f},
-std::array<float,2>{0.282772154f, 0.191066101f},
-std::array<float,2>{0.721094131f, 0.661718786f},
-std::array<float,2>{0.812153399f, 0.0813206583f},
-std::array<float,2>{0.0610941239f, 0.529040456f},
-std::array<float,2>{0.474174708f, 0.491625696f},
-std::array<float,2>{0.605603755f, 0.982649446f},
-std::array<float,2>{0.625944436f, 0.351461142f},
-std::array<float,2>{0.353575855f, 0.802330494f},
-std::array<float,2>{0.127922148f, 0.184182316f},
-std::array<float,2>{0.994606316f, 0.718702674f},
-std::array<float,2>{0.507369161f, 0.198346689f},
-std::array<float,2>{0.385015845f, 0.666419089f},
-std::array<float,2>{0.0837404206f, 0.306031793f},
-std::array<float,2>{0.863812506f, 0.824585736f},
-std::array<float,2>{0.934933364f, 0.436527312f},
-std::array<float,2>{0.230892569f, 0.916664898f},
-std::array<float,2>{0.271163255f, 0.0233628973f},
-std::array<float,2>{0.71794486f, 0.608415365f},
-std::array<float,2>{0.942129731f, 0.147023827f},
-std::array<float,2>{0.174737751f, 0.736347079f},
-std::array<float,2>{0.324678987f, 0.326454371f},
-std::array<float,2>{0.669584751f, 0.780706108f},
-std::array<float,2>{0.577396512f, 0.465662152f},
-std::array<float,2>{0.463179797f, 0.951127648f},
-std::array<float,2>{0.0181344282f, 0.110599607f},
-std::array<float,2>{0.765823901f, 0.557910025f},
-std::array<float,2>{0.729303241f, 0.0424483344f},
-std::array<float,2>{0.293571025f, 0.576791525f},
-std::array<float,2>{0.205222577f, 0.391829699f},
-std::array<float,2>{0.883104444f, 0.885678887f},
-std::array<float,2>{0.835974693f, 0.266635001f},
-std::array<float,2>{0.111996315f, 0.86304152f},
-std::array<float,2>{0.41556406f, 0.226373002f},
-std::array<float,2>{0.547902763f, 0.628836095f},
-std::array<float,2>{0.901980698f, 0.00760027207f},
-std::array<float,2>{0.189841539f, 0.621153831f},
-std::array<float,2>{0.304326683f, 0.409525186f},
-std::array<float,2>{0.747740388f, 0.933793008f},
-std::array<float,2>{0.544996023f, 0.286147892f},
-std::array<float,2>{0.4250274f, 0.830686867f},
-std::array<float,2>{0.0982571989f, 0.213904426f},
-std::array<float,2>{0.818141878f, 0.672735691f},
-std::array<float,2>{0.676015615f, 0.156676844f},
-std::array<float,2>{0.337522477f, 0.688550472f},
-std::array<float,2>{0.156804025f, 0.367647529f},
-std::array<float,2>{0.965703249f, 0.794418156f},
-std::array<float,2>{0.761885583f, 0.47148481f},
-std::array<float,2>{0.0135378735f, 0.992340088f},
-std::array<float,2>{0.437927067f, 0.0732271224f},
-std::array<float,2>{0.586530805f, 0.5060274f},
-std::array<float,2>{0.845781803f, 0.243578821f},
-std::array<float,2>{0.0639833882f, 0.653610885f},
-std::array<float,2>{0.397469163f, 0.253824949f},
-std::array<float,2>{0.525458753f, 0.845178604f},
-std::array<float,2>{0.690146923f, 0.380407959f},
-std::array<float,2>{0.262361884f, 0.892394483f},
-std::array<float,2>{0.242895544f, 0.0547976792f},
-std::array<float,2>{0.919785559f, 0.59246999f},
-std::array<float,2>{0.614356458f, 0.108035736f},
-std::array<float,2>{0.496427387f, 0.531837106f},
-std::array<float,2>{0.0423265137f, 0.44343096f},
-std::array<float,2>{0.783078313f, 0.957827628f},
-std::array<float,2>{0.983683109f, 0.333770752f},
-std::array<float,2>{0.153940588f, 0.764229059f},
-std::array<float,2>{0.365071058f, 0.13999778f},
-std::array<float,2>{0.649595678f, 0.731771588f},
-std::array<float,2>{0.773600519f, 0.0593099073f},
-std::array<float,2>{0.0268087722f, 0.586798847f},
-std::array<float,2>{0.455044031f, 0.375743061f},
-std::array<float,2>{0.569390059f, 0.894624829f},
-std::array<float,2>{0.660018206f, 0.254966706f},
-std::array<float,2>{0.314588219f, 0.848009944f},
-std::array<float,2>{0.185146272f, 0.246711329f},
-std::array<float,2>{0.951243281f, 0.652231097f},
-std::array<float,2>{0.557400644f, 0.132976264f},
-std::array<float,2>{0.411426425f, 0.727348626f},
-std::array<float,2>{0.120844603f, 0.331469566f},
-std::array<float,2>{0.830781817f, 0.761619985f},
-std::array<float,2>{0.878147244f, 0.440934241f},
-std::array<float,2>{0.216556892f, 0.953837633f},
-std::array<float,2>{0.287677109f, 0.104949236f},
-std::array<float,2>{0.722784877f, 0.538242698f},
-std::array<float,2>{0.98763603f, 0.215977415f},
-std::array<float,2>{0.139475405f, 0.677928507f},
-std::array<float,2>{0.34885478f, 0.283545941f},
-std::array<float,2>{0.634246528f, 0.832224548f},
-std::array<float,2>{0.594386816f, 0.411070019f},
-std::array<float,2>{0.477652997f, 0.932896912f},
-std::array<float,2>{0.050495673f, 0.00148343341f},
-std::array<float,2>{0.802604675f, 0.620587707f},
-std::array<float,2>{0.709713042f, 0.0755436569f},
-std::array<float,2>{0.27669856f, 0.503069282f},
-std::array<float,2>{0.220526025f, 0.472705752f},
-std::array<float,2>{0.923616886f, 0.997398317f},
-std::array<float,2>{0.874384642f, 0.373313338f},
-std::array<float,2>{0.0929878876f, 0.792521596f},
-std::array<float,2>{0.377270132f, 0.160535097f},
-std::array<float,2>{0.510407805f, 0.69353646f},
-std::array<float,2>{0.907557786f, 0.114737943f},
-std::array<float,2>{0.23619175f, 0.559348583f},
-std::array<float,2>{0.25159049f, 0.464611322f},
-std::array<float,2>{0.698603988f, 0.946631372f},
-std::array<float,2>{0.515771329f, 0.32175228f},
-std::array<float,2>{0.40248841f, 0.775338173f},
-std::array<float,2>{0.0744793266f, 0.144448802f},
-std::array<float,2>{0.854362965f, 0.740546525f},
-std::array<float,2>{0.646789312f, 0.219750151f},
-std::array<float,2>{0.370403469f, 0.632385254f},
-std::array<float,2>{0.140805662f, 0.269844085f},
-std::array<float,2>{0.975212991f, 0.865439773f},
-std::array<float,2>{0.789919972f, 0.398368567f},
-std::array<float,2>{0.0343523696f, 0.889658809f},
-std::array<float,2>{0.487875879f, 0.0445477106f},
-std::array<float,2>{0.623573363f, 0.572541595f},
-std::array<float,2>{0.822985649f, 0.179984763f},
-std::array<float,2>{0.106439181f, 0.711846709f},
-std::array<float,2>{0.429903537f, 0.347451389f},
-std::array<float,2>{0.532228708f, 0.797760785f},
-std::array<float,2>{0.735299349f, 0.488163471f},
-std::array<float,2>{0.305148154f, 0.978382647f},
-std::array<float,2>{0.197165266f, 0.0823717564f},
-std::array<float,2>{0.89342016f, 0.527338684f},
-std::array<float,2>{0.582699478f, 0.0170046818f},
-std::array<float,2>{0.453011721f, 0.603666306f},
-std::array<float,2>{0.00172288809f, 0.432564437f},
-std::array<float,2>{0.753015995f, 0.921369612f},
-std::array<float,2>{0.960897088f, 0.309349805f},
-std::array<float,2>{0.166133016f, 0.821485519f},
-std::array<float,2>{0.329572499f, 0.199363947f},
-std::array<float,2>{0.679869831f, 0.669814587f},
-std::array<float,2>{0.849838495f, 0.0934515819f},
-std::array<float,2>{0.0681742281f, 0.516652167f},
-std::array<float,2>{0.391105115f, 0.497982353f},
-std::array<float,2>{0.528496921f, 0.972981513f},
-std::array<float,2>{0.693880677f, 0.352354705f},
-std::array<float,2>{0.260117143f, 0.809330046f},
-std::array<float,2>{0.248566791f, 0.17647998f},
-std::array<float,2>{0.916416347f, 0.706360817f},
-std::array<float,2>{0.609880686f, 0.192034274f},
-std::array<float,2>{0.493531018f, 0.657095253f},
-std::array<float,2>{0.045833271f, 0.298180342f},
-std::array<float,2>{0.787898004f, 0.814085364f},
-std::array<float,2>{0.977355659f, 0.429240733f},
-std::array<float,2>{0.149838015f, 0.907474935f},
-std::array<float,2>{0.361563444f, 0.0254076067f},
-std::array<float,2>{0.654850602f, 0.596725643f},
-std::array<float,2>{0.905904353f, 0.156140924f},
-std::array<float,2>{0.194673195f, 0.744054675f},
-std::array<float,2>{0.300114423f, 0.319544315f},
-std::array<float,2>{0.742391586f, 0.77020365f},
-std::array<float,2>{0.541205287f, 0.458007485f},
-std::array<float,2>{0.428161979f, 0.941313028f},
-std::array<float,2>{0.0954493731f, 0.117266424f},
-std::array<float,2>{0.815336049f, 0.553166151f},
-std::array<float,2>{0.672223032f, 0.0355113186f},
-std::array<float,2>{0.343115538f, 0.565203846f},
-std::array<float,2>{0.163271189f, 0.401066631f},
-std::array<float,2>{0.964143515f, 0.881081045f},
-std::array<float,2>{0.758036554f, 0.277046055f},
-std::array<float,2>{0.0115737645f, 0.871796787f},
-std::array<float,2>{0.441531748f, 0.233917058f},
-std::array<float,2>{0.591424346f, 0.639674067f},
-std::array<float,2>{0.93969059f, 0.014458606f},
-std::array<float,2>{0.178474203f, 0.61584115f},
-std::array<float,2>{0.32124126f, 0.416634679f},
-std::array<float,2>{0.667160034f, 0.928343713f},
-std::array<float,2>{0.573845685f, 0.296389997f},
-std::array<float,2>{0.468339652f, 0.837773025f},
-std::array<float,2>{0.0205377862f, 0.203637809f},
-std::array<float,2>{0.77073282f, 0.682597041f},
-std::array<float,2>{0.732786357f, 0.169308394f},
-std::array<float,2>{0.291703969f, 0.696133018f},
-std::array<float,2>{0.207850277f, 0.365329713f},
-std::array<float,2>{0.888282597f, 0.783970892f},
-std::array<float,2>{0.84183681f, 0.477214575f},
-std::array<float,2>{0.116139397f, 0.987055659f},
-std::array<float,2>{0.419178247f, 0.069185555f},
-std::array<float,2>{0.554498672f, 0.51213783f},
-std::array<float,2>{0.808476806f, 0.23462221f},
-std::array<float,2>{0.0572590418f, 0.646066368f},
-std::array<float,2>{0.471521497f, 0.264079183f},
-std::array<float,2>{0.604048491f, 0.858602822f},
-std::array<float,2>{0.631275833f, 0.38545233f},
-std::array<float,2>{0.357067317f, 0.904729247f},
-std::array<float,2>{0.13041161f, 0.0526848771f},
-std::array<float,2>{0.999546826f, 0.585889459f},
-std::array<float,2>{0.501062214f, 0.100795329f},
-std::array<float,2>{0.388155699f, 0.54009974f},
-std::array<float,2>{0.0817311257f, 0.451642275f},
-std::array<float,2>{0.862320185f, 0.966932535f},
-std::array<float,2>{0.931866646f, 0.338649631f},
-std::array<float,2>{0.229711145f, 0.753171444f},
-std::array<float,2>{0.267597884f, 0.129721791f},
-std::array<float,2>{0.711061358f, 0.718827486f},
-std::array<float,2>{0.834835947f, 0.0298689269f},
-std::array<float,2>{0.124940425f, 0.597677171f},
-std::array<float,2>{0.406260341f, 0.422547013f},
-std::array<float,2>{0.559915781f, 0.91068244f},
-std::array<float,2>{0.722651958f, 0.301974654f},
-std::array<float,2>{0.281995267f, 0.819982409f},
-std::array<float,2>{0.212247983f, 0.188947797f},
-std::array<float,2>{0.88257283f, 0.663703799f},
-std::array<float,2>{0.562788844f, 0.172346801f},
-std::array<float,2>{0.457363844f, 0.708263636f},
-std::array<float,2>{0.0306827854f, 0.356118083f},
-std::array<float,2>{0.777762473f, 0.807204485f},
-std::array<float,2>{0.947235823f, 0.492700636f},
-std::array<float,2>{0.182131648f, 0.970051587f},
-std::array<float,2>{0.319004446f, 0.0859931707f},
-std::array<float,2>{0.663800418f, 0.520453513f},
-std::array<float,2>{0.927455246f, 0.22787407f},
-std::array<float,2>{0.226017818f, 0.634949565f},
-std::array<float,2>{0.279147238f, 0.279087096f},
-std::array<float,2>{0.703986883f, 0.867783546f},
-std::array<float,2>{0.5154742f, 0.403225869f},
-std::array<float,2>{0.37907061f, 0.876605034f},
-std::array<float,2>{0.0895580128f, 0.0319476463f},
-std::array<float,2>{0.870469928f, 0.569649339f},
-std::array<float,2>{0.63772577f, 0.124890774f},
-std::array<float,2>{0.344750196f, 0.550176024f},
-std::array<float,2>{0.135522291f, 0.45621419f},
-std::array<float,2>{0.991416097f, 0.94426626f},
-std::array<float,2>{0.798179805f, 0.315655082f},
-std::array<float,2>{0.0535542853f, 0.769132853f},
-std::array<float,2>{0.481409103f, 0.150179133f},
-std::array<float,2>{0.601072669f, 0.74960649f},
-std::array<float,2>{0.970587552f, 0.0625686273f},
-std::array<float,2>{0.144915625f, 0.508709431f},
-std::array<float,2>{0.373899877f, 0.482492864f},
-std::array<float,2>{0.643332243f, 0.989763319f},
-std::array<float,2>{0.617302418f, 0.361798495f},
-std::array<float,2>{0.489767015f, 0.788418412f},
-std::array<float,2>{0.0388229042f, 0.164160565f},
-std::array<float,2>{0.796794772f, 0.703084528f},
-std::array<float,2>{0.702387393f, 0.207480252f},
-std::array<float,2>{0.254326612f, 0.685807288f},
-std::array<float,2>{0.241971299f, 0.290926188f},
-std::array<float,2>{0.91244781f, 0.840982437f},
-std::array<float,2>{0.856508017f, 0.419579059f},
-std::array<float,2>{0.0710565895f, 0.922680318f},
-std::array<float,2>{0.398707688f, 0.00823935866f},
-std::array<float,2>{0.520832002f, 0.613280416f},
-std::array<float,2>{0.754797339f, 0.128651068f},
-std::array<float,2>{0.00538769364f, 0.723265588f},
-std::array<float,2>{0.446816832f, 0.341207504f},
-std::array<float,2>{0.579311848f, 0.755208969f},
-std::array<float,2>{0.686166525f, 0.447256982f},
-std::array<float,2>{0.333137244f, 0.963639855f},
-std::array<float,2>{0.170909464f, 0.0938843936f},
-std::array<float,2>{0.954556882f, 0.546512663f},
-std::array<float,2>{0.535917521f, 0.0504993983f},
-std::array<float,2>{0.436225176f, 0.579610288f},
-std::array<float,2>{0.104286179f, 0.387917668f},
-std::array<float,2>{0.826103151f, 0.900104761f},
-std::array<float,2>{0.895712078f, 0.259292156f},
-std::array<float,2>{0.200554878f, 0.853677928f},
-std::array<float,2>{0.309322298f, 0.241658404f},
-std::array<float,2>{0.739789963f, 0.644096255f},
-std::array<float,2>{0.781268954f, 0.106222183f},
-std::array<float,2>{0.0415182821f, 0.533472538f},
-std::array<float,2>{0.497823238f, 0.442359895f},
-std::array<float,2>{0.613314688f, 0.960244119f},
-std::array<float,2>{0.649058938f, 0.334926754f},
-std::array<float,2>{0.363676012f, 0.762699306f},
-std::array<float,2>{0.152572513f, 0.137551188f},
-std::array<float,2>{0.982442737f, 0.734256208f},
-std::array<float,2>{0.526412487f, 0.245466679f},
-std::array<float,2>{0.397363007f, 0.654915273f},
-std::array<float,2>{0.062977694f, 0.251113415f},
-std::array<float,2>{0.846820533f, 0.847172678f},
-std::array<float,2>{0.918018699f, 0.382609576f},
-std::array<float,2>{0.243820056f, 0.89258039f},
-std::array<float,2>{0.263612241f, 0.057198476f},
-std::array<float,2>{0.691234589f, 0.590453744f},
-std::array<float,2>{0.965848804f, 0.160027921f},
-std::array<float,2>{0.157248706f, 0.690768957f},
-std::array<float,2>{0.336379051f, 0.370020598f},
-std::array<float,2>{0.677081287f, 0.796471536f},
-std::array<float,2>{0.586998761f, 0.46924293f},
-std::array<float,2>{0.438693374f, 0.995139062f},
-std::array<float,2>{0.0117628565f, 0.0707737729f},
-std::array<float,2>{0.76334691f, 0.504517555f},
-std::array<float,2>{0.746608257f, 0.00449957f},
-std::array<float,2>{0.303514451f, 0.62473613f},
-std::array<float,2>{0.191075668f, 0.406372219f},
-std::array<float,2>{0.900660932f, 0.935650408f},
-std::array<float,2>{0.816900134f, 0.288042873f},
-std::array<float,2>{0.0987934768f, 0.829995275f},
-std::array<float,2>{0.42475453f, 0.212811738f},
-std::array<float,2>{0.546215832f, 0.67391026f},
-std::array<float,2>{0.88384223f, 0.0396689698f},
-std::array<float,2>{0.206975535f, 0.575352013f},
-std::array<float,2>{0.294412047f, 0.392695814f},
-std::array<float,2>{0.730302691f, 0.884271681f},
-std::array<float,2>{0.547353446f, 0.269480199f},
-std::array<float,2>{0.414490193f, 0.859632432f},
-std::array<float,2>{0.112357639f, 0.223137125f},
-std::array<float,2>{0.837304235f, 0.626742482f},
-std::array<float,2>{0.668495059f, 0.144567952f},
-std::array<float,2>{0.3257927f, 0.734894872f},
-std::array<float,2>{0.175342441f, 0.324969202f},
-std::array<float,2>{0.942588449f, 0.777809083f},
-std::array<float,2>{0.767500579f, 0.468195081f},
-std::array<float,2>{0.0194285177f, 0.951198459f},
-std::array<float,2>{0.463885993f, 0.11136429f},
-std::array<float,2>{0.576828241f, 0.555052876f},
-std::array<float,2>{0.865078151f, 0.19719328f},
-std::array<float,2>{0.0825987011f, 0.664212823f},
-std::array<float,2>{0.386705518f, 0.307125062f},
-std::array<float,2>{0.506442249f, 0.826600909f},
-std::array<float,2>{0.717621148f, 0.433998495f},
-std::array<float,2>{0.269874126f, 0.915381193f},
-std::array<float,2>{0.232367873f, 0.0196518805f},
-std::array<float,2>{0.933642626f, 0.605627f},
-std::array<float,2>{0.606621265f, 0.0792007074f},
-std::array<float,2>{0.473028749f, 0.529416621f},
-std::array<float,2>{0.0618389696f, 0.48895973f},
-std::array<float,2>{0.811502278f, 0.98135829f},
-std::array<float,2>{0.995635688f, 0.348605394f},
-std::array<float,2>{0.128900513f, 0.803600729f},
-std::array<float,2>{0.355387837f, 0.187416255f},
-std::array<float,2>{0.626565337f, 0.716013134f},
-std::array<float,2>{0.804463565f, 0.00272934581f},
-std::array<float,2>{0.0474327169f, 0.618795633f},
-std::array<float,2>{0.478919238f, 0.412399173f},
-std::array<float,2>{0.597391188f, 0.929754674f},
-std::array<float,2>{0.636116266f, 0.28305307f},
-std::array<float,2>{0.350588769f, 0.835115612f},
-std::array<float,2>{0.136773452f, 0.216942728f},
-std::array<float,2>{0.98555398f, 0.677150309f},
-std::array<float,2>{0.509197235f, 0.163469672f},
-std::array<float,2>{0.375571311f, 0.693040848f},
-std::array<float,2>{0.0899979919f, 0.371582448f},
-std::array<float,2>{0.87209326f, 0.789196372f},
-std::array<float,2>{0.92563653f, 0.474978715f},
-std::array<float,2>{0.221808523f, 0.998275816f},
-std::array<float,2>{0.273456067f, 0.0762096569f},
-std::array<float,2>{0.708058178f, 0.501533449f},
-std::array<float,2>{0.949602008f, 0.248956323f},
-std::array<float,2>{0.185670644f, 0.649736822f},
-std::array<float,2>{0.313245773f, 0.256161451f},
-std::array<float,2>{0.658077121f, 0.849828482f},
-std::array<float,2>{0.566995382f, 0.378353059f},
-std::array<float,2>{0.455379754f, 0.896940768f},
-std::array<float,2>{0.024568174f, 0.0621229485f},
-std::array<float,2>{0.776831746f, 0.587950766f},
-std::array<float,2>{0.724749029f, 0.102878742f},
-std::array<float,2>{0.285535097f, 0.53703779f},
-std::array<float,2>{0.217031568f, 0.43755421f},
-std::array<float,2>{0.875686824f, 0.956459343f},
-std::array<float,2>{0.829825461f, 0.329285353f},
-std::array<float,2>{0.117658876f, 0.759632051f},
-std::array<float,2>{0.413161367f, 0.136436954f},
-std::array<float,2>{0.554985702f, 0.729723632f},
-std::array<float,2>{0.892147601f, 0.0858282745f},
-std::array<float,2>{0.197791174f, 0.523801267f},
-std::array<float,2>{0.30712539f, 0.484434277f},
-std::array<float,2>{0.737264097f, 0.980217695f},
-std::array<float,2>{0.534222782f, 0.344230115f},
-std::array<float,2>{0.432518542f, 0.800776362f},
-std::array<float,2>{0.107694343f, 0.183340222f},
-std::array<float,2>{0.820835888f, 0.71446836f},
-std::array<float,2>{0.68297255f, 0.201917589f},
-std::array<float,2>{0.330192536f, 0.670897245f},
-std::array<float,2>{0.16587545f, 0.31195122f},
-std::array<float,2>{0.958336234f, 0.823386788f},
-std::array<float,2>{0.751914561f, 0.430006206f},
-std::array<float,2>{0.00220436137f, 0.918812394f},
-std::array<float,2>{0.450045764f, 0.018839892f},
-std::array<float,2>{0.585395634f, 0.602675438f},
-std::array<float,2>{0.851729155f, 0.1424793f},
-std::array<float,2>{0.0779786259f, 0.739751995f},
-std::array<float,2>{0.404357582f, 0.322817832f},
-std::array<float,2>{0.517810643f, 0.775648832f},
-std::array<float,2>{0.697028697f, 0.461194545f},
-std::array<float,2>{0.252566963f, 0.947983444f},
-std::array<float,2>{0.23663187f, 0.11534863f},
-std::array<float,2>{0.909417152f, 0.561387241f},
-std::array<float,2>{0.621175587f, 0.046600461f},
-std::array<float,2>{0.486070454f, 0.571010053f},
-std::array<float,2>{0.0319494568f, 0.395675361f},
-std::array<float,2>{0.792294323f, 0.887210071f},
-std::array<float,2>{0.974484682f, 0.271544158f},
-std::array<float,2>{0.143136352f, 0.863840163f},
-std::array<float,2>{0.367414773f, 0.221481398f},
-std::array<float,2>{0.645477116f, 0.630772769f},
-std::array<float,2>{0.813705921f, 0.119864166f},
-std::array<float,2>{0.0960290805f, 0.551552176f},
-std::array<float,2>{0.42608884f, 0.460339457f},
-std::array<float,2>{0.540731609f, 0.937733293f},
-std::array<float,2>{0.745700181f, 0.318148255f},
-std::array<float,2>{0.297492266f, 0.772610068f},
-std::array<float,2>{0.193356872f, 0.152685419f},
-std::array<float,2>{0.903338969f, 0.744507611f},
-std::array<float,2>{0.593622565f, 0.231137201f},
-std::array<float,2>{0.443987906f, 0.638432086f},
-std::array<float,2>{0.00918900035f, 0.273836374f},
-std::array<float,2>{0.759958267f, 0.87469089f},
-std::array<float,2>{0.962872863f, 0.399498075f},
-std::array<float,2>{0.161237493f, 0.87934655f},
-std::array<float,2>{0.340444326f, 0.0380440168f},
-std::array<float,2>{0.675440729f, 0.563412905f},
-std::array<float,2>{0.914165378f, 0.178514034f},
-std::array<float,2>{0.246269867f, 0.704372644f},
-std::array<float,2>{0.258529782f, 0.354853064f},
-std::array<float,2>{0.692283034f, 0.812219858f},
-std::array<float,2>{0.530437648f, 0.499517351f},
-std::array<float,2>{0.39271909f, 0.974835694f},
-std::array<float,2>{0.0688524991f, 0.0916799232f},
-std::array<float,2>{0.847774267f, 0.519491374f},
-std::array<float,2>{0.652468026f, 0.0237437487f},
-std::array<float,2>{0.359666824f, 0.59466207f},
-std::array<float,2>{0.151265502f, 0.426956594f},
-std::array<float,2>{0.980357111f, 0.908420146f},
-std::array<float,2>{0.785756707f, 0.299317628f},
-std::array<float,2>{0.0430874601f, 0.815244734f},
-std::array<float,2>{0.495477527f, 0.194699124f},
-std::array<float,2>{0.612411022f, 0.658356488f},
-std::array<float,2>{0.996231556f, 0.0542807877f},
-std::array<float,2>{0.132558316f, 0.583178103f},
-std::array<float,2>{0.359019816f, 0.38309899f},
-std::array<float,2>{0.629366159f, 0.904043972f},
-std::array<float,2>{0.60226804f, 0.261840373f},
-std::array<float,2>{0.470225036f, 0.856351376f},
-std::array<float,2>{0.0557126291f, 0.236820996f},
-std::array<float,2>{0.805768549f, 0.648393452f},
-std::array<float,2>{0.714063525f, 0.132231593f},
-std::array<float,2>{0.266894162f, 0.720869899f},
-std::array<float,2>{0.227839679f, 0.336892158f},
-std::array<float,2>{0.929801285f, 0.751870215f},
-std::array<float,2>{0.861036718f, 0.44985956f},
-std::array<float,2>{0.0800189897f, 0.966354668f},
-std::array<float,2>{0.388953239f, 0.0985945761f},
-std::array<float,2>{0.50317055f, 0.541061044f},
-std::array<float,2>{0.771955907f, 0.206241265f},
-std::array<float,2>{0.0222187135f, 0.67972225f},
-std::array<float,2>{0.466234118f, 0.293452263f},
-std::array<float,2>{0.570875108f, 0.83898741f},
-std::array<float,2>{0.664893448f, 0.41572684f},
-std::array<float,2>{0.322649539f, 0.92753762f},
-std::array<float,2>{0.176104844f, 0.0122200185f},
-std::array<float,2>{0.938866436f, 0.614310384f},
-std::array<float,2>{0.552522063f, 0.0674089789f},
-std::array<float,2>{0.420581728f, 0.513915479f},
-std::array<float,2>{0.113703087f, 0.480112672f},
-std::array<float,2>{0.841686726f, 0.985664725f},
-std::array<float,2>{0.889569521f, 0.364024609f},
-std::array<float,2>{0.210914776f, 0.783032537f},
-std::array<float,2>{0.290570557f, 0.170044959f},
-std::array<float,2>{0.730857372f, 0.697899222f},
-std::array<float,2>{0.86852169f, 0.0343998149f},
-std::array<float,2>{0.0865829438f, 0.566878617f},
-std::array<float,2>{0.381980926f, 0.405909657f},
-std::array<float,2>{0.51272589f, 0.877546549f},
-std::array<float,2>{0.705604136f, 0.279611677f},
-std::array<float,2>{0.280796826f, 0.870326102f},
-std::array<float,2>{0.223259911f, 0.230363265f},
-std::array<float,2>{0.928052008f, 0.63379395f},
-std::array<float,2>{0.598639011f, 0.150828674f},
-std::array<float,2>{0.483748853f, 0.746468127f},
-std::array<float,2>{0.0520206355f, 0.313921124f},
-std::array<float,2>{0.799719751f, 0.766157448f},
-std::array<float,2>{0.988929689f, 0.455016434f},
-std::array<float,2>{0.134374693f, 0.942047894f},
-std::array<float,2>{0.346701384f, 0.12160033f},
-std::array<float,2>{0.639496386f, 0.547250032f},
-std::array<float,2>{0.879765868f, 0.190414846f},
-std::array<float,2>{0.214247778f, 0.660558343f},
-std::array<float,2>{0.283734679f, 0.303524584f},
-std::array<float,2>{0.72019577f, 0.818000376f},
-std::array<float,2>{0.561305046f, 0.425619751f},
-std::array<float,2>{0.410019815f, 0.912222803f},
-std::array<float,2>{0.121211171f, 0.0288162772f},
-std::array<float,2>{0.832319856f, 0.600918233f},
-std::array<float,2>{0.661832452f, 0.0890143961f},
-std::array<float,2>{0.318333119f, 0.523030341f},
-std::array<float,2>{0.181496948f, 0.49527666f},
-std::array<float,2>{0.947850943f, 0.970825016f},
-std::array<float,2>{0.779800475f, 0.358212531f},
-std::array<float,2>{0.0289983731f, 0.805081666f},
-std::array<float,2>{0.460015237f, 0.174580768f},
-std::array<float,2>{0.564781666f, 0.709258437f},
-std::array<float,2>{0.955564141f, 0.0969469026f},
-std::array<float,2>{0.169312686f, 0.543789864f},
-std::array<float,2>{0.335059911f, 0.447679371f},
-std::array<float,2>{0.683817208f, 0.961368561f},
-std::array<float,2>{0.580633461f, 0.342213392f},
-std::array<float,2>{0.447679281f, 0.755876839f},
-std::array<float,2>{0.00691747386f, 0.126313046f},
-std::array<float,2>{0.757697165f, 0.72565335f},
-std::array<float,2>{0.741672337f, 0.238859504f},
-std::array<float,2>{0.312445223f, 0.641203523f},
-std::array<float,2>{0.203109041f, 0.260607421f},
-std::array<float,2>{0.896554768f, 0.852555454f},
-std::array<float,2>{0.826485515f, 0.388925195f},
-std::array<float,2>{0.102699034f, 0.901453614f},
-std::array<float,2>{0.434456527f, 0.0487909354f},
-std::array<float,2>{0.537283421f, 0.580373466f},
-std::array<float,2>{0.794688165f, 0.167853519f},
-std::array<float,2>{0.0362772159f, 0.700441897f},
-std::array<float,2>{0.491834551f, 0.360363811f},
-std::array<float,2>{0.619935691f, 0.786149323f},
-std::array<float,2>{0.64137733f, 0.481387585f},
-std::array<float,2>{0.371311247f, 0.992097318f},
-std::array<float,2>{0.147050962f, 0.0651104823f},
-std::array<float,2>{0.970720768f, 0.510184824f},
-std::array<float,2>{0.522179782f, 0.0104700234f},
-std::array<float,2>{0.400987297f, 0.61109376f},
-std::array<float,2>{0.0727826208f, 0.42136389f},
-std::array<float,2>{0.857448161f, 0.924472809f},
-std::array<float,2>{0.910877049f, 0.291483909f},
-std::array<float,2>{0.240216732f, 0.842214763f},
-std::array<float,2>{0.256675869f, 0.209728003f},
-std::array<float,2>{0.701157391f, 0.684363127f},
-std::array<float,2>{0.764402986f, 0.0740935206f},
-std::array<float,2>{0.0142843686f, 0.507170975f},
-std::array<float,2>{0.440710038f, 0.4721708f},
-std::array<float,2>{0.58874619f, 0.993804932f},
-std::array<float,2>{0.678435624f, 0.368935168f},
-std::array<float,2>{0.339384258f, 0.79363811f},
-std::array<float,2>{0.160016879f, 0.157313272f},
-std::array<float,2>{0.967115879f, 0.688075662f},
-std::array<float,2>{0.543324351f, 0.213709012f},
-std::array<float,2>{0.422640711f, 0.673635304f},
-std::array<float,2>{0.100621089f, 0.285365701f},
-std::array<float,2>{0.819370031f, 0.831196964f},
-std::array<float,2>{0.899220526f, 0.408489972f},
-std::array<float,2>{0.187873617f, 0.935380638f},
-std::array<float,2>{0.301523983f, 0.00651764637f},
-std::array<float,2>{0.749785781f, 0.622232616f},
-std::array<float,2>{0.980517447f, 0.139571652f},
-std::array<float,2>{0.155007213f, 0.73084861f},
-std::array<float,2>{0.366129845f, 0.332390159f},
-std::array<float,2>{0.652320325f, 0.764720023f},
-std::array<float,2>{0.615798235f, 0.444538981f},
-std::array<float,2>{0.498149425f, 0.958670735f},
-std::array<float,2>{0.0400262624f, 0.108991474f},
-std::array<float,2>{0.783629358f, 0.532745898f},
-std::array<float,2>{0.688750863f, 0.0563960411f},
-std::array<float,2>{0.263840467f, 0.593397737f},
-std::array<float,2>{0.244356677f, 0.379136771f},
-std::array<float,2>{0.921402156f, 0.891514719f},
-std::array<float,2>{0.845012248f, 0.252091944f},
-std::array<float,2>{0.0661924556f, 0.843795121f},
-std::array<float,2>{0.395046413f, 0.242516875f},
-std::array<float,2>{0.524655402f, 0.652667344f},
-std::array<float,2>{0.937409043f, 0.0224548653f},
-std::array<float,2>{0.232630149f, 0.607444286f},
-std::array<float,2>{0.271835387f, 0.435658813f},
-std::array<float,2>{0.716147661f, 0.917400539f},
-std::array<float,2>{0.505188286f, 0.305172294f},
-std::array<float,2>{0.382833064f, 0.826050639f},
-std::array<float,2>{0.0844875053f, 0.197475567f},
-std::array<float,2>{0.865786016f, 0.667204499f},
-std::array<float,2>{0.628672242f, 0.18498674f},
-std::array<float,2>{0.35325852f, 0.717100561f},
-std::array<float,2>{0.126249149f, 0.350412697f},
-std::array<float,2>{0.993216991f, 0.801594019f},
-std::array<float,2>{0.808691621f, 0.490237027f},
-std::array<float,2>{0.060128931f, 0.983941436f},
-std::array<float,2>{0.474886239f, 0.0805839822f},
-std::array<float,2>{0.607987165f, 0.527453065f},
-std::array<float,2>{0.838440418f, 0.224800751f},
-std::array<float,2>{0.109857045f, 0.627727866f},
-std::array<float,2>{0.416557401f, 0.266454816f},
-std::array<float,2>{0.550675631f, 0.861939788f},
-std::array<float,2>{0.727898836f, 0.390989035f},
-std::array<float,2>{0.295569628f, 0.885900378f},
-std::array<float,2>{0.20398064f, 0.0412944704f},
-std::array<float,2>{0.886270821f, 0.577975988f},
-std::array<float,2>{0.575069487f, 0.110251918f},
-std::array<float,2>{0.461794406f, 0.557462454f},
-std::array<float,2>{0.0170460772f, 0.466119438f},
-std::array<float,2>{0.769529998f, 0.94992882f},
-std::array<float,2>{0.944113374f, 0.327399254f},
-std::array<float,2>{0.172880083f, 0.779868245f},
-std::array<float,2>{0.32739538f, 0.148102f},
-std::array<float,2>{0.670974255f, 0.737660408f},
-std::array<float,2>{0.806454003f, 0.0520602949f},
-std::array<float,2>{0.0561968796f, 0.585074067f},
-std::array<float,2>{0.470018566f, 0.385089606f},
-std::array<float,2>{0.601788819f, 0.90526706f},
-std::array<float,2>{0.629830182f, 0.26433906f},
-std::array<float,2>{0.358746737f, 0.858941376f},
-std::array<float,2>{0.131872088f, 0.235035956f},
-std::array<float,2>{0.996587515f, 0.645620704f},
-std::array<float,2>{0.503904581f, 0.128938168f},
-std::array<float,2>{0.389269769f, 0.719423592f},
-std::array<float,2>{0.0795866773f, 0.338213533f},
-std::array<float,2>{0.860608816f, 0.753650427f},
-std::array<float,2>{0.930207253f, 0.452056587f},
-std::array<float,2>{0.22841233f, 0.967507601f},
-std::array<float,2>{0.267462611f, 0.101240985f},
-std::array<float,2>{0.714660704f, 0.540831268f},
-std::array<float,2>{0.93903178f, 0.203367472f},
-std::array<float,2>{0.176558524f, 0.681721687f},
-std::array<float,2>{0.322878152f, 0.296119273f},
-std::array<float,2>{0.664206207f, 0.836978436f},
-std::array<float,2>{0.57041049f, 0.416038692f},
-std::array<float,2>{0.466409147f, 0.927891135f},
-std::array<float,2>{0.0215161853f, 0.013998853f},
-std::array<float,2>{0.772146583f, 0.615666628f},
-std::array<float,2>{0.73134315f, 0.0687590167f},
-std::array<float,2>{0.29028523f, 0.512389243f},
-std::array<float,2>{0.210447803f, 0.476734728f},
-std::array<float,2>{0.889157176f, 0.986774445f},
-std::array<float,2>{0.841197848f, 0.365815431f},
-std::array<float,2>{0.11380215f, 0.783617198f},
-std::array<float,2>{0.420266449f, 0.169539601f},
-std::array<float,2>{0.551951408f, 0.695546746f},
-std::array<float,2>{0.903917134f, 0.117876567f},
-std::array<float,2>{0.192865759f, 0.553249359f},
-std::array<float,2>{0.29699564f, 0.457295835f},
-std::array<float,2>{0.745372236f, 0.940857828f},
-std::array<float,2>{0.540117204f, 0.320251137f},
-std::array<float,2>{0.426637679f, 0.769711554f},
-std::array<float,2>{0.0962545127f, 0.155739814f},
-std::array<float,2>{0.814106345f, 0.743227482f},
-std::array<float,2>{0.675277412f, 0.233802363f},
-std::array<float,2>{0.339994788f, 0.640587091f},
-std::array<float,2>{0.161967725f, 0.276820421f},
-std::array<float,2>{0.962033749f, 0.871563137f},
-std::array<float,2>{0.760713577f, 0.400529057f},
-std::array<float,2>{0.00952034816f, 0.8814165f},
-std::array<float,2>{0.443663716f, 0.0360233597f},
-std::array<float,2>{0.593088508f, 0.564662635f},
-std::array<float,2>{0.848323464f, 0.175902411f},
-std::array<float,2>{0.0688087344f, 0.706606627f},
-std::array<float,2>{0.393116385f, 0.351987332f},
-std::array<float,2>{0.530951321f, 0.808725238f},
-std::array<float,2>{0.69156605f, 0.497237742f},
-std::array<float,2>{0.258140028f, 0.97327745f},
-std::array<float,2>{0.246627539f, 0.0928565487f},
-std::array<float,2>{0.914881408f, 0.517435372f},
-std::array<float,2>{0.612839043f, 0.026159063f},
-std::array<float,2>{0.495828986f, 0.597517252f},
-std::array<float,2>{0.0438648164f, 0.428762048f},
-std::array<float,2>{0.785181522f, 0.907805562f},
-std::array<float,2>{0.979818702f, 0.298722029f},
-std::array<float,2>{0.150715917f, 0.81392473f},
-std::array<float,2>{0.360225022f, 0.191781029f},
-std::array<float,2>{0.653019011f, 0.656408966f},
-std::array<float,2>{0.82038492f, 0.0826968402f},
-std::array<float,2>{0.108188674f, 0.526644289f},
-std::array<float,2>{0.432047933f, 0.487616897f},
-std::array<float,2>{0.534838915f, 0.977585077f},
-std::array<float,2>{0.736366093f, 0.346702814f},
-std::array<float,2>{0.307486087f, 0.797347069f},
-std::array<float,2>{0.197706014f, 0.180260986f},
-std::array<float,2>{0.891637146f, 0.711102843f},
-std::array<float,2>{0.585506082f, 0.200101405f},
-std::array<float,2>{0.449456364f, 0.669251442f},
-std::array<float,2>{0.00283654826f, 0.30895409f},
-std::array<float,2>{0.751385689f, 0.822169781f},
-std::array<float,2>{0.958714545f, 0.432127178f},
-std::array<float,2>{0.165039837f, 0.921874166f},
-std::array<float,2>{0.330894649f, 0.017536357f},
-std::array<float,2>{0.683167636f, 0.604424536f},
-std::array<float,2>{0.909952521f, 0.143672913f},
-std::array<float,2>{0.237084016f, 0.74115932f},
-std::array<float,2>{0.252205163f, 0.322043449f},
-std::array<float,2>{0.696358323f, 0.774786949f},
-std::array<float,2>{0.518223405f, 0.463964671f},
-std::array<float,2>{0.405238062f, 0.94705373f},
-std::array<float,2>{0.0773271024f, 0.114746571f},
-std::array<float,2>{0.852220416f, 0.558686852f},
-std::array<float,2>{0.644796014f, 0.0441475697f},
-std::array<float,2>{0.367780656f, 0.572821021f},
-std::array<float,2>{0.14266701f, 0.397609293f},
-std::array<float,2>{0.973925292f, 0.890263915f},
-std::array<float,2>{0.792582095f, 0.270175636f},
-std::array<float,2>{0.0313484147f, 0.866077304f},
-std::array<float,2>{0.485513479f, 0.220395356f},
-std::array<float,2>{0.622031748f, 0.632234573f},
-std::array<float,2>{0.986125529f, 0.00128199742f},
-std::array<float,2>{0.137402564f, 0.620862484f},
-std::array<float,2>{0.351436228f, 0.410555631f},
-std::array<float,2>{0.636274695f, 0.933428049f},
-std::array<float,2>{0.596832752f, 0.283931971f},
-std::array<float,2>{0.479129761f, 0.832957447f},
-std::array<float,2>{0.0472297631f, 0.216686562f},
-std::array<float,2>{0.803808272f, 0.678344965f},
-std::array<float,2>{0.708800554f, 0.160660088f},
-std::array<float,2>{0.273992151f, 0.693880737f},
-std::array<float,2>{0.222415328f, 0.373919368f},
-std::array<float,2>{0.925269127f, 0.792403519f},
-std::array<float,2>{0.872998416f, 0.473403662f},
-std::array<float,2>{0.0906067416f, 0.997754872f},
-std::array<float,2>{0.375191063f, 0.0759522393f},
-std::array<float,2>{0.509499431f, 0.503736138f},
-std::array<float,2>{0.777252316f, 0.246240139f},
-std::array<float,2>{0.0251557156f, 0.651436508f},
-std::array<float,2>{0.455758244f, 0.255498707f},
-std::array<float,2>{0.566717029f, 0.848461092f},
-std::array<float,2>{0.657561183f, 0.37521705f},
-std::array<float,2>{0.312621415f, 0.895241261f},
-std::array<float,2>{0.186078057f, 0.0587773658f},
-std::array<float,2>{0.949943125f, 0.586071908f},
-std::array<float,2>{0.555199385f, 0.10542237f},
-std::array<float,2>{0.413913131f, 0.53905201f},
-std::array<float,2>{0.117855027f, 0.440516174f},
-std::array<float,2>{0.829154372f, 0.953185856f},
-std::array<float,2>{0.87518996f, 0.331780374f},
-std::array<float,2>{0.217378646f, 0.761053503f},
-std::array<float,2>{0.286019176f, 0.133302033f},
-std::array<float,2>{0.72517091f, 0.726929247f},
-std::array<float,2>{0.865536451f, 0.0200404283f},
-std::array<float,2>{0.0840531364f, 0.606006801f},
-std::array<float,2>{0.38376388f, 0.434250534f},
-std::array<float,2>{0.505566657f, 0.915815234f},
-std::array<float,2>{0.716706038f, 0.30752942f},
-std::array<float,2>{0.272100329f, 0.827049971f},
-std::array<float,2>{0.232965469f, 0.196695119f},
-std::array<float,2>{0.936531425f, 0.664553046f},
-std::array<float,2>{0.607515812f, 0.186820045f},
-std::array<float,2>{0.475301385f, 0.716429889f},
-std::array<float,2>{0.0597844198f, 0.347945988f},
-std::array<float,2>{0.80944556f, 0.80315578f},
-std::array<float,2>{0.993782878f, 0.488396913f},
-std::array<float,2>{0.12658152f, 0.980624974f},
-std::array<float,2>{0.352772504f, 0.0796328038f},
-std::array<float,2>{0.628390312f, 0.529887974f},
-std::array<float,2>{0.886187315f, 0.223310441f},
-std::array<float,2>{0.2032758f, 0.626358747f},
-std::array<float,2>{0.295289367f, 0.268933177f},
-std::array<float,2>{0.72840929f, 0.859902263f},
-std::array<float,2>{0.550011039f, 0.393084377f},
-std::array<float,2>{0.416494399f, 0.884534895f},
-std::array<float,2>{0.109973945f, 0.0394942276f},
-std::array<float,2>{0.83790344f, 0.576090276f},
-std::array<float,2>{0.671424747f, 0.111834683f},
-std::array<float,2>{0.327986211f, 0.555533409f},
-std::array<float,2>{0.17343986f, 0.468297988f},
-std::array<float,2>{0.943640053f, 0.951683521f},
-std::array<float,2>{0.769010723f, 0.324395269f},
-std::array<float,2>{0.0172808059f, 0.778144479f},
-std::array<float,2>{0.461113781f, 0.145464107f},
-std::array<float,2>{0.574533343f, 0.734621882f},
-std::array<float,2>{0.967632115f, 0.0711904168f},
-std::array<float,2>{0.159391612f, 0.504296124f},
-std::array<float,2>{0.339093953f, 0.468951046f},
-std::array<float,2>{0.677779734f, 0.995737016f},
-std::array<float,2>{0.588228166f, 0.369464546f},
-std::array<float,2>{0.441018671f, 0.795980096f},
-std::array<float,2>{0.0141140893f, 0.159436807f},
-std::array<float,2>{0.763983011f, 0.690974176f},
-std::array<float,2>{0.749346137f, 0.21214889f},
-std::array<float,2>{0.300925791f, 0.674384594f},
-std::array<float,2>{0.188116863f, 0.28716749f},
-std::array<float,2>{0.898875475f, 0.829180837f},
-std::array<float,2>{0.819854081f, 0.406985611f},
-std::array<float,2>{0.101245865f, 0.936099529f},
-std::array<float,2>{0.422095805f, 0.00432152348f},
-std::array<float,2>{0.543788016f, 0.62429142f},
-std::array<float,2>{0.783828259f, 0.137124941f},
-std::array<float,2>{0.0392290913f, 0.733479977f},
-std::array<float,2>{0.498551995f, 0.334103972f},
-std::array<float,2>{0.615234613f, 0.763185263f},
-std::array<float,2>{0.651577711f, 0.441458642f},
-std::array<float,2>{0.365498513f, 0.960695446f},
-std::array<float,2>{0.154671058f, 0.105569623f},
-std::array<float,2>{0.981080055f, 0.533842087f},
-std::array<float,2>{0.525174975f, 0.056890469f},
-std::array<float,2>{0.394883186f, 0.590056062f},
-std::array<float,2>{0.0654729754f, 0.382074922f},
-std::array<float,2>{0.845537305f, 0.893393099f},
-std::array<float,2>{0.921074748f, 0.251743585f},
-std::array<float,2>{0.244812235f, 0.846879125f},
-std::array<float,2>{0.26418224f, 0.245790198f},
-std::array<float,2>{0.689083099f, 0.654581785f},
-std::array<float,2>{0.757297873f, 0.0944375843f},
-std::array<float,2>{0.0074534365f, 0.545901f},
-std::array<float,2>{0.447862655f, 0.446402639f},
-std::array<float,2>{0.580450952f, 0.963165402f},
-std::array<float,2>{0.684472322f, 0.34148258f},
-std::array<float,2>{0.335453182f, 0.755479872f},
-std::array<float,2>{0.169597417f, 0.128136173f},
-std::array<float,2>{0.955990076f, 0.722713053f},
-std::array<float,2>{0.537865162f, 0.242039397f},
-std::array<float,2>{0.433921576f, 0.643841565f},
-std::array<float,2>{0.103030562f, 0.259109646f},
-std::array<float,2>{0.826907337f, 0.85430789f},
-std::array<float,2>{0.897006154f, 0.388518035f},
-std::array<float,2>{0.202469572f, 0.899641871f},
-std::array<float,2>{0.311998993f, 0.0502496026f},
-std::array<float,2>{0.742099762f, 0.579495668f},
-std::array<float,2>{0.971635759f, 0.164796486f},
-std::array<float,2>{0.146852642f, 0.70231092f},
-std::array<float,2>{0.371619582f, 0.362007856f},
-std::array<float,2>{0.640714109f, 0.788604438f},
-std::array<float,2>{0.619244576f, 0.482940257f},
-std::array<float,2>{0.491659999f, 0.989272416f},
-std::array<float,2>{0.0369079076f, 0.0630823672f},
-std::array<float,2>{0.794299662f, 0.508093655f},
-std::array<float,2>{0.700544f, 0.0087186303f},
-std::array<float,2>{0.256156057f, 0.612453818f},
-std::array<float,2>{0.239701658f, 0.418948263f},
-std::array<float,2>{0.910297334f, 0.922230005f},
-std::array<float,2>{0.858383f, 0.290388435f},
-std::array<float,2>{0.072609596f, 0.841396391f},
-std::array<float,2>{0.400672793f, 0.207698822f},
-std::array<float,2>{0.521754086f, 0.686132312f},
-std::array<float,2>{0.92867595f, 0.0315875709f},
-std::array<float,2>{0.222867399f, 0.570097446f},
-std::array<float,2>{0.280650198f, 0.402730286f},
-std::array<float,2>{0.705352604f, 0.876374543f},
-std::array<float,2>{0.513430297f, 0.278426766f},
-std::array<float,2>{0.382591695f, 0.867314994f},
-std::array<float,2>{0.0860182196f, 0.228202626f},
-std::array<float,2>{0.868873894f, 0.635647655f},
-std::array<float,2>{0.638782501f, 0.149629295f},
-std::array<float,2>{0.347296506f, 0.749479115f},
-std::array<float,2>{0.133868456f, 0.316400647f},
-std::array<float,2>{0.988385379f, 0.768712401f},
-std::array<float,2>{0.799191833f, 0.456800401f},
-std::array<float,2>{0.0523976311f, 0.943432689f},
-std::array<float,2>{0.484171271f, 0.124329753f},
-std::array<float,2>{0.599488795f, 0.550692141f},
-std::array<float,2>{0.8325665f, 0.189027667f},
-std::array<float,2>{0.121937908f, 0.663368583f},
-std::array<float,2>{0.409601897f, 0.30234468f},
-std::array<float,2>{0.560830414f, 0.819697261f},
-std::array<float,2>{0.720314741f, 0.422300279f},
-std::array<float,2>{0.283682317f, 0.910477161f},
-std::array<float,2>{0.214489534f, 0.0297000129f},
-std::array<float,2>{0.879040301f, 0.598533332f},
-std::array<float,2>{0.565396249f, 0.0867543072f},
-std::array<float,2>{0.460846812f, 0.519590557f},
-std::array<float,2>{0.0285315309f, 0.492470473f},
-std::array<float,2>{0.779590487f, 0.970627725f},
-std::array<float,2>{0.947405577f, 0.355618298f},
-std::array<float,2>{0.180873111f, 0.806925833f},
-std::array<float,2>{0.317543834f, 0.172456175f},
-std::array<float,2>{0.661486566f, 0.708574176f},
-std::array<float,2>{0.771021485f, 0.0117880693f},
-std::array<float,2>{0.0213180017f, 0.615003467f},
-std::array<float,2>{0.467990607f, 0.415456414f},
-std::array<float,2>{0.573340118f, 0.926942885f},
-std::array<float,2>{0.667640626f, 0.293756604f},
-std::array<float,2>{0.320610017f, 0.839771986f},
-std::array<float,2>{0.17804116f, 0.206811354f},
-std::array<float,2>{0.940095961f, 0.680420816f},
-std::array<float,2>{0.554157734f, 0.17073597f},
-std::array<float,2>{0.419855058f, 0.697646379f},
-std::array<float,2>{0.115454569f, 0.363544345f},
-std::array<float,2>{0.842628837f, 0.782460511f},
-std::array<float,2>{0.88771522f, 0.479867131f},
-std::array<float,2>{0.207058862f, 0.986222088f},
-std::array<float,2>{0.29145202f, 0.0681374744f},
-std::array<float,2>{0.733349621f, 0.514548302f},
-std::array<float,2>{0.99921459f, 0.236510083f},
-std::array<float,2>{0.13034761f, 0.647475183f},
-std::array<float,2>{0.356782377f, 0.262501031f},
-std::array<float,2>{0.631799817f, 0.855604708f},
-std::array<float,2>{0.603588223f, 0.383405149f},
-std::array<float,2>{0.470735401f, 0.903777957f},
-std::array<float,2>{0.0569665805f, 0.0538027547f},
-std::array<float,2>{0.808046341f, 0.583791554f},
-std::array<float,2>{0.711606622f, 0.0978035182f},
-std::array<float,2>{0.268509299f, 0.54199034f},
-std::array<float,2>{0.230124325f, 0.449517757f},
-std::array<float,2>{0.932230055f, 0.965956748f},
-std::array<float,2>{0.862946928f, 0.336362213f},
-std::array<float,2>{0.0811766833f, 0.751325488f},
-std::array<float,2>{0.38861075f, 0.132753372f},
-std::array<float,2>{0.501568139f, 0.721334398f},
-std::array<float,2>{0.916571021f, 0.0909551233f},
-std::array<float,2>{0.248051628f, 0.518967152f},
-std::array<float,2>{0.260317713f, 0.499505132f},
-std::array<float,2>{0.693821251f, 0.975156486f},
-std::array<float,2>{0.529231369f, 0.355304778f},
-std::array<float,2>{0.391532123f, 0.811884642f},
-std::array<float,2>{0.0675803795f, 0.178149298f},
-std::array<float,2>{0.850461006f, 0.704713166f},
-std::array<float,2>{0.654466271f, 0.195133969f},
-std::array<float,2>{0.362044513f, 0.65870136f},
-std::array<float,2>{0.150293916f, 0.299224049f},
-std::array<float,2>{0.976928711f, 0.814916193f},
-std::array<float,2>{0.787511051f, 0.427366138f},
-std::array<float,2>{0.0453568734f, 0.908944845f},
-std::array<float,2>{0.493694037f, 0.0240935497f},
-std::array<float,2>{0.609622538f, 0.594036937f},
-std::array<float,2>{0.814494491f, 0.153226659f},
-std::array<float,2>{0.0950091109f, 0.745048344f},
-std::array<float,2>{0.428669959f, 0.317736626f},
-std::array<float,2>{0.541759849f, 0.773433626f},
-std::array<float,2>{0.742887259f, 0.460625082f},
-std::array<float,2>{0.300502926f, 0.938043237f},
-std::array<float,2>{0.195106134f, 0.119461238f},
-std::array<float,2>{0.905578554f, 0.551011086f},
-std::array<float,2>{0.590981603f, 0.0374866351f},
-std::array<float,2>{0.442240506f, 0.562743068f},
-std::array<float,2>{0.0110688517f, 0.400323421f},
-std::array<float,2>{0.758674145f, 0.879646122f},
-std::array<float,2>{0.964581728f, 0.274288952f},
-std::array<float,2>{0.163673937f, 0.874408424f},
-std::array<float,2>{0.343345582f, 0.230848685f},
-std::array<float,2>{0.672571182f, 0.638016045f},
-std::array<float,2>{0.853706181f, 0.116158783f},
-std::array<float,2>{0.0750861838f, 0.561030269f},
-std::array<float,2>{0.403014839f, 0.461547703f},
-std::array<float,2>{0.516557395f, 0.947319925f},
-std::array<float,2>{0.69909668f, 0.322604507f},
-std::array<float,2>{0.251270771f, 0.776169002f},
-std::array<float,2>{0.235420793f, 0.1417059f},
-std::array<float,2>{0.907758415f, 0.739293694f},
-std::array<float,2>{0.623127699f, 0.220858827f},
-std::array<float,2>{0.487727314f, 0.630203247f},
-std::array<float,2>{0.0350922793f, 0.272431791f},
-std::array<float,2>{0.789533615f, 0.863706708f},
-std::array<float,2>{0.975038826f, 0.396470129f},
-std::array<float,2>{0.141267702f, 0.886882663f},
-std::array<float,2>{0.370650887f, 0.0463348478f},
-std::array<float,2>{0.647138238f, 0.570555031f},
-std::array<float,2>{0.892707467f, 0.183072403f},
-std::array<float,2>{0.19639802f, 0.714097679f},
-std::array<float,2>{0.305640519f, 0.344442487f},
-std::array<float,2>{0.734535933f, 0.800079226f},
-std::array<float,2>{0.533032656f, 0.485159189f},
-std::array<float,2>{0.430656344f, 0.97993505f},
-std::array<float,2>{0.105518416f, 0.0854308829f},
-std::array<float,2>{0.822704494f, 0.524365902f},
-std::array<float,2>{0.680229127f, 0.0192849729f},
-std::array<float,2>{0.32999444f, 0.603047609f},
-std::array<float,2>{0.166856214f, 0.430372179f},
-std::array<float,2>{0.960197926f, 0.918182433f},
-std::array<float,2>{0.753785193f, 0.312392712f},
-std::array<float,2>{0.00142429583f, 0.824133039f},
-std::array<float,2>{0.452305347f, 0.201304957f},
-std::array<float,2>{0.582103193f, 0.669950962f},
-std::array<float,2>{0.951982498f, 0.0615578592f},
-std::array<float,2>{0.184776962f, 0.588544369f},
-std::array<float,2>{0.315050513f, 0.378897101f},
-std::array<float,2>{0.659311473f, 0.897242546f},
-std::array<float,2>{0.570275366f, 0.256710172f},
-std::array<float,2>{0.454297721f, 0.850186229f},
-std::array<float,2>{0.0272213407f, 0.248294339f},
-std::array<float,2>{0.774197876f, 0.650312126f},
-std::array<float,2>{0.723247886f, 0.136058837f},
-std::array<float,2>{0.287195325f, 0.730175436f},
-std::array<float,2>{0.216292351f, 0.329760998f},
-std::array<float,2>{0.878869176f, 0.759114921f},
-std::array<float,2>{0.830254316f, 0.438182265f},
-std::array<float,2>{0.120273151f, 0.956967056f},
-std::array<float,2>{0.411941081f, 0.103292212f},
-std::array<float,2>{0.556953251f, 0.536377847f},
-std::array<float,2>{0.801823437f, 0.217461348f},
-std::array<float,2>{0.0500638522f, 0.677556276f},
-std::array<float,2>{0.478436112f, 0.282631308f},
-std::array<float,2>{0.593918502f, 0.835670114f},
-std::array<float,2>{0.634608686f, 0.412671238f},
-std::array<float,2>{0.349225014f, 0.930388093f},
-std::array<float,2>{0.138926387f, 0.00199820427f},
-std::array<float,2>{0.987840831f, 0.61826849f},
-std::array<float,2>{0.510059297f, 0.0770787448f},
-std::array<float,2>{0.377553314f, 0.501030803f},
-std::array<float,2>{0.0936613232f, 0.475481123f},
-std::array<float,2>{0.874845088f, 0.998873413f},
-std::array<float,2>{0.923279643f, 0.371529669f},
-std::array<float,2>{0.219938174f, 0.789808929f},
-std::array<float,2>{0.277116925f, 0.163953111f},
-std::array<float,2>{0.709136665f, 0.692811191f},
-std::array<float,2>{0.837464988f, 0.0416951552f},
-std::array<float,2>{0.112847425f, 0.577300966f},
-std::array<float,2>{0.415019929f, 0.391229838f},
-std::array<float,2>{0.547486126f, 0.886369228f},
-std::array<float,2>{0.729826629f, 0.265794605f},
-std::array<float,2>{0.294614822f, 0.861774385f},
-std::array<float,2>{0.206436127f, 0.225489914f},
-std::array<float,2>{0.88462311f, 0.627198577f},
-std::array<float,2>{0.57630831f, 0.147541985f},
-std::array<float,2>{0.464590162f, 0.738173068f},
-std::array<float,2>{0.0189707577f, 0.327964813f},
-std::array<float,2>{0.766916811f, 0.779513836f},
-std::array<float,2>{0.943070948f, 0.466638237f},
-std::array<float,2>{0.17501688f, 0.949650824f},
-std::array<float,2>{0.325218946f, 0.109814703f},
-std::array<float,2>{0.667981386f, 0.556901455f},
-std::array<float,2>{0.934342623f, 0.198084459f},
-std::array<float,2>{0.231661558f, 0.667834401f},
-std::array<float,2>{0.270101428f, 0.305502802f},
-std::array<float,2>{0.716965914f, 0.825370073f},
-std::array<float,2>{0.505945444f, 0.436121523f},
-std::array<float,2>{0.385754913f, 0.917645335f},
-std::array<float,2>{0.0823923498f, 0.0214852784f},
-std::array<float,2>{0.864588797f, 0.60810709f},
-std::array<float,2>{0.626223087f, 0.080497548f},
-std::array<float,2>{0.354734987f, 0.527883887f},
-std::array<float,2>{0.128148094f, 0.490883708f},
-std::array<float,2>{0.995425403f, 0.983782053f},
-std::array<float,2>{0.810610175f, 0.349715799f},
-std::array<float,2>{0.0622641444f, 0.80120647f},
-std::array<float,2>{0.473392755f, 0.185473442f},
-std::array<float,2>{0.607411623f, 0.71774137f},
-std::array<float,2>{0.983372152f, 0.10854242f},
-std::array<float,2>{0.152921095f, 0.532402396f},
-std::array<float,2>{0.363862991f, 0.445194393f},
-std::array<float,2>{0.648779571f, 0.958107054f},
-std::array<float,2>{0.614016771f, 0.332569301f},
-std::array<float,2>{0.497508645f, 0.765621722f},
-std::array<float,2>{0.0410722494f, 0.138821065f},
-std::array<float,2>{0.781848788f, 0.73142761f},
-std::array<float,2>{0.690453172f, 0.242731526f},
-std::array<float,2>{0.263007104f, 0.653307915f},
-std::array<float,2>{0.243255556f, 0.25274232f},
-std::array<float,2>{0.918849468f, 0.844325304f},
-std::array<float,2>{0.847558975f, 0.379599214f},
-std::array<float,2>{0.0634615049f, 0.891099632f},
-std::array<float,2>{0.396696538f, 0.0559631363f},
-std::array<float,2>{0.52731365f, 0.593113542f},
-std::array<float,2>{0.762952328f, 0.157724604f},
-std::array<float,2>{0.0124395425f, 0.687892497f},
-std::array<float,2>{0.438969582f, 0.368233502f},
-std::array<float,2>{0.587700784f, 0.793033779f},
-std::array<float,2>{0.677523315f, 0.471758336f},
-std::array<float,2>{0.336788952f, 0.99353075f},
-std::array<float,2>{0.157888606f, 0.0734725296f},
-std::array<float,2>{0.966429174f, 0.507485449f},
-std::array<float,2>{0.546400905f, 0.00595271867f},
-std::array<float,2>{0.424110651f, 0.62301302f},
-std::array<float,2>{0.099279739f, 0.409061611f},
-std::array<float,2>{0.816469729f, 0.934835851f},
-std::array<float,2>{0.90089041f, 0.285903215f},
-std::array<float,2>{0.190785021f, 0.831879795f},
-std::array<float,2>{0.303117186f, 0.213105738f},
-std::array<float,2>{0.746466756f, 0.672870934f},
-std::array<float,2>{0.796228349f, 0.0645799637f},
-std::array<float,2>{0.0384144448f, 0.510290623f},
-std::array<float,2>{0.489474505f, 0.480878711f},
-std::array<float,2>{0.617950022f, 0.991536796f},
-std::array<float,2>{0.642991304f, 0.361006379f},
-std::array<float,2>{0.373082936f, 0.787060976f},
-std::array<float,2>{0.145477131f, 0.167266861f},
-std::array<float,2>{0.969751716f, 0.701039553f},
-std::array<float,2>{0.521289229f, 0.209305301f},
-std::array<float,2>{0.399339765f, 0.683898449f},
-std::array<float,2>{0.070711188f, 0.291615248f},
-std::array<float,2>{0.857232571f, 0.842682838f},
-std::array<float,2>{0.912885606f, 0.421464562f},
-std::array<float,2>{0.241610035f, 0.923981905f},
-std::array<float,2>{0.254867315f, 0.0102525782f},
-std::array<float,2>{0.703041732f, 0.610778868f},
-std::array<float,2>{0.955004573f, 0.126626819f},
-std::array<float,2>{0.171535075f, 0.726438761f},
-std::array<float,2>{0.333915889f, 0.342385501f},
-std::array<float,2>{0.685770035f, 0.756474137f},
-std::array<float,2>{0.580017805f, 0.448208779f},
-std::array<float,2>{0.446445256f, 0.961579025f},
-std::array<float,2>{0.00491180364f, 0.0974580795f},
-std::array<float,2>{0.754345655f, 0.54313612f},
-std::array<float,2>{0.739320636f, 0.047945451f},
-std::array<float,2>{0.308670253f, 0.580902278f},
-std::array<float,2>{0.200818181f, 0.389422417f},
-std::array<float,2>{0.896016061f, 0.902059853f},
-std::array<float,2>{0.825202405f, 0.259864867f},
-std::array<float,2>{0.103914522f, 0.853287637f},
-std::array<float,2>{0.435722321f, 0.238646731f},
-std::array<float,2>{0.535428584f, 0.640760243f},
-std::array<float,2>{0.881923139f, 0.0287411381f},
-std::array<float,2>{0.212802842f, 0.601458788f},
-std::array<float,2>{0.281581998f, 0.425072849f},
-std::array<float,2>{0.721823394f, 0.91292125f},
-std::array<float,2>{0.560297668f, 0.302864581f},
-std::array<float,2>{0.406970352f, 0.817832291f},
-std::array<float,2>{0.124223426f, 0.189913228f},
-std::array<float,2>{0.834177732f, 0.660957754f},
-std::array<float,2>{0.663565278f, 0.174253196f},
-std::array<float,2>{0.318545848f, 0.709486783f},
-std::array<float,2>{0.1817635f, 0.357442498f},
-std::array<float,2>{0.946440935f, 0.805326402f},
-std::array<float,2>{0.778309166f, 0.495936811f},
-std::array<float,2>{0.0310769379f, 0.971448362f},
-std::array<float,2>{0.457647234f, 0.0895189643f},
-std::array<float,2>{0.563307226f, 0.522847593f},
-std::array<float,2>{0.87103641f, 0.229729787f},
-std::array<float,2>{0.0890318006f, 0.634420335f},
-std::array<float,2>{0.379520118f, 0.280194849f},
-std::array<float,2>{0.514717519f, 0.870671332f},
-std::array<float,2>{0.70334667f, 0.405673027f},
-std::array<float,2>{0.278536558f, 0.877129614f},
-std::array<float,2>{0.226240098f, 0.035144262f},
-std::array<float,2>{0.927216887f, 0.567379415f},
-std::array<float,2>{0.6015203f, 0.121276505f},
-std::array<float,2>{0.480765134f, 0.547619998f},
-std::array<float,2>{0.0528082922f, 0.454414189f},
-std::array<float,2>{0.798421264f, 0.941847801f},
-std::array<float,2>{0.992124557f, 0.314034164f},
-std::array<float,2>{0.134878352f, 0.765655398f},
-std::array<float,2>{0.345390409f, 0.151089698f},
-std::array<float,2>{0.638320148f, 0.746615708f},
-std::array<float,2>{0.759692967f, 0.0368051715f},
-std::array<float,2>{0.00994287338f, 0.565742671f},
-std::array<float,2>{0.443137556f, 0.402206212f},
-std::array<float,2>{0.59010154f, 0.882299066f},
-std::array<float,2>{0.67358762f, 0.276112467f},
-std::array<float,2>{0.341873229f, 0.872152448f},
-std::array<float,2>{0.162536711f, 0.232838765f},
-std::array<float,2>{0.963019907f, 0.638691783f},
-std::array<float,2>{0.542451441f, 0.155096635f},
-std::array<float,2>{0.429650813f, 0.74257338f},
-std::array<float,2>{0.0937964544f, 0.318923622f},
-std::array<float,2>{0.816262841f, 0.771049619f},
-std::array<float,2>{0.904823065f, 0.458370239f},
-std::array<float,2>{0.194223255f, 0.939844191f},
-std::array<float,2>{0.299458027f, 0.118702538f},
-std::array<float,2>{0.743831873f, 0.553895295f},
-std::array<float,2>{0.977627099f, 0.193053827f},
-std::array<float,2>{0.149116531f, 0.657494068f},
-std::array<float,2>{0.362355322f, 0.297679424f},
-std::array<float,2>{0.655893207f, 0.813310862f},
-std::array<float,2>{0.6104123f, 0.428298175f},
-std::array<float,2>{0.493022263f, 0.906319141f},
-std::array<float,2>{0.0462289788f, 0.0270954482f},
-std::array<float,2>{0.788777888f, 0.596347213f},
-std::array<float,2>{0.695310593f, 0.0925649032f},
-std::array<float,2>{0.261216313f, 0.516478837f},
-std::array<float,2>{0.249560758f, 0.496484488f},
-std::array<float,2>{0.917750597f, 0.974136353f},
-std::array<float,2>{0.851535738f, 0.352614194f},
-std::array<float,2>{0.0673109889f, 0.809897423f},
-std::array<float,2>{0.391714841f, 0.177712321f},
-std::array<float,2>{0.52824825f, 0.705613554f},
-std::array<float,2>{0.932681322f, 0.100094825f},
-std::array<float,2>{0.229174584f, 0.539750278f},
-std::array<float,2>{0.268750906f, 0.452242851f},
-std::array<float,2>{0.712004602f, 0.967907488f},
-std::array<float,2>{0.50020647f, 0.339718223f},
-std::array<float,2>{0.386880547f, 0.75212878f},
-std::array<float,2>{0.0807713568f, 0.129906982f},
-std::array<float,2>{0.862233877f, 0.719742835f},
-std::array<float,2>{0.632753909f, 0.236151516f},
-std::array<float,2>{0.35593164f, 0.64525187f},
-std::array<float,2>{0.129377916f, 0.265087783f},
-std::array<float,2>{0.998130739f, 0.857448339f},
-std::array<float,2>{0.80754441f, 0.386635393f},
-std::array<float,2>{0.0585763454f, 0.906177342f},
-std::array<float,2>{0.471927255f, 0.0508582518f},
-std::array<float,2>{0.604783297f, 0.58430481f},
-std::array<float,2>{0.843681216f, 0.168840289f},
-std::array<float,2>{0.116613276f, 0.696801782f},
-std::array<float,2>{0.418200403f, 0.366599619f},
-std::array<float,2>{0.553618312f, 0.784402072f},
-std::array<float,2>{0.734093547f, 0.478468299f},
-std::array<float,2>{0.292476237f, 0.988230944f},
-std::array<float,2>{0.208430052f, 0.0698343515f},
-std::array<float,2>{0.887105882f, 0.513545632f},
-std::array<float,2>{0.572764397f, 0.0151054505f},
-std::array<float,2>{0.467511177f, 0.616819739f},
-std::array<float,2>{0.0201960411f, 0.417097658f},
-std::array<float,2>{0.770159185f, 0.928733289f},
-std::array<float,2>{0.941315651f, 0.295139998f},
-std::array<float,2>{0.178725839f, 0.836879611f},
-std::array<float,2>{0.321785808f, 0.204514772f},
-std::array<float,2>{0.666172743f, 0.683292031f},
-std::array<float,2>{0.873663664f, 0.0750261992f},
-std::array<float,2>{0.0918717161f, 0.502052903f},
-std::array<float,2>{0.378542602f, 0.474401265f},
-std::array<float,2>{0.511452615f, 0.996496141f},
-std::array<float,2>{0.710505188f, 0.374375314f},
-std::array<float,2>{0.27611798f, 0.791060984f},
-std::array<float,2>{0.219010696f, 0.162042186f},
-std::array<float,2>{0.922561646f, 0.695300877f},
-std::array<float,2>{0.595261395f, 0.215590537f},
-std::array<float,2>{0.476704746f, 0.679323375f},
-std::array<float,2>{0.0492091738f, 0.284369141f},
-std::array<float,2>{0.801615357f, 0.833741307f},
-std::array<float,2>{0.986372113f, 0.41159153f},
-std::array<float,2>{0.139729962f, 0.93193388f},
-std::array<float,2>{0.348623693f, 0.000191288447f},
-std::array<float,2>{0.63334918f, 0.619772971f},
-std::array<float,2>{0.876995087f, 0.134616539f},
-std::array<float,2>{0.214900345f, 0.727694094f},
-std::array<float,2>{0.288820148f, 0.330544233f},
-std::array<float,2>{0.724534035f, 0.760074735f},
-std::array<float,2>{0.558190882f, 0.439512759f},
-std::array<float,2>{0.410599619f, 0.954366446f},
-std::array<float,2>{0.119283848f, 0.103802353f},
-std::array<float,2>{0.831491709f, 0.537154615f},
-std::array<float,2>{0.659059823f, 0.0602729395f},
-std::array<float,2>{0.315724641f, 0.587773085f},
-std::array<float,2>{0.183665335f, 0.376219302f},
-std::array<float,2>{0.95287472f, 0.896224916f},
-std::array<float,2>{0.774764597f, 0.254342735f},
-std::array<float,2>{0.0256387331f, 0.848740458f},
-std::array<float,2>{0.453755885f, 0.247366145f},
-std::array<float,2>{0.568558455f, 0.651077926f},
-std::array<float,2>{0.959218025f, 0.0163023062f},
-std::array<float,2>{0.167073265f, 0.605065227f},
-std::array<float,2>{0.328266561f, 0.433006525f},
-std::array<float,2>{0.681010365f, 0.919952333f},
-std::array<float,2>{0.583514094f, 0.31043154f},
-std::array<float,2>{0.451326877f, 0.820736229f},
-std::array<float,2>{0.000455089699f, 0.200503364f},
-std::array<float,2>{0.752284765f, 0.668301821f},
-std::array<float,2>{0.735995531f, 0.180866629f},
-std::array<float,2>{0.305744916f, 0.712297201f},
-std::array<float,2>{0.196016699f, 0.345887989f},
-std::array<float,2>{0.893897951f, 0.79824245f},
-std::array<float,2>{0.824125826f, 0.486487001f},
-std::array<float,2>{0.107097894f, 0.977132499f},
-std::array<float,2>{0.431591839f, 0.0836862549f},
-std::array<float,2>{0.532222331f, 0.525747657f},
-std::array<float,2>{0.790299177f, 0.219417244f},
-std::array<float,2>{0.0341726542f, 0.631533444f},
-std::array<float,2>{0.486880839f, 0.270771742f},
-std::array<float,2>{0.62459743f, 0.866652191f},
-std::array<float,2>{0.647633851f, 0.397125691f},
-std::array<float,2>{0.369876295f, 0.889371991f},
-std::array<float,2>{0.142076299f, 0.0434729233f},
-std::array<float,2>{0.97603184f, 0.573367774f},
-std::array<float,2>{0.516606569f, 0.113615148f},
-std::array<float,2>{0.403835267f, 0.559864461f},
-std::array<float,2>{0.0752126724f, 0.462934554f},
-std::array<float,2>{0.854864657f, 0.945459068f},
-std::array<float,2>{0.90648818f, 0.320667028f},
-std::array<float,2>{0.234421551f, 0.77369982f},
-std::array<float,2>{0.250542939f, 0.142670467f},
-std::array<float,2>{0.698061466f, 0.741982698f},
-std::array<float,2>{0.817604005f, 0.00569655281f},
-std::array<float,2>{0.0980347916f, 0.623261213f},
-std::array<float,2>{0.425601423f, 0.407366127f},
-std::array<float,2>{0.545709491f, 0.936955929f},
-std::array<float,2>{0.747472644f, 0.288301229f},
-std::array<float,2>{0.303790838f, 0.828185737f},
-std::array<float,2>{0.190307915f, 0.211439416f},
-std::array<float,2>{0.901574075f, 0.67531085f},
-std::array<float,2>{0.586122751f, 0.15820922f},
-std::array<float,2>{0.438315302f, 0.689746201f},
-std::array<float,2>{0.0129592903f, 0.371011645f},
-std::array<float,2>{0.762210965f, 0.7957775f},
-std::array<float,2>{0.965294361f, 0.470350295f},
-std::array<float,2>{0.156398118f, 0.994645298f},
-std::array<float,2>{0.337002814f, 0.0719594508f},
-std::array<float,2>{0.676478684f, 0.504944623f},
-std::array<float,2>{0.919114113f, 0.244676143f},
-std::array<float,2>{0.242210418f, 0.655733943f},
-std::array<float,2>{0.261787802f, 0.25090602f},
-std::array<float,2>{0.68993485f, 0.845713735f},
-std::array<float,2>{0.525924683f, 0.381188184f},
-std::array<float,2>{0.398355842f, 0.893906295f},
-std::array<float,2>{0.063924022f, 0.0582903363f},
-std::array<float,2>{0.846531451f, 0.59118402f},
-std::array<float,2>{0.650136828f, 0.10675966f},
-std::array<float,2>{0.364382595f, 0.534310877f},
-std::array<float,2>{0.153705597f, 0.443272203f},
-std::array<float,2>{0.984108329f, 0.959740996f},
-std::array<float,2>{0.78245908f, 0.335653126f},
-std::array<float,2>{0.0427567773f, 0.762372553f},
-std::array<float,2>{0.497053564f, 0.138329864f},
-std::array<float,2>{0.614758551f, 0.733184993f},
-std::array<float,2>{0.994682074f, 0.0785331652f},
-std::array<float,2>{0.127297461f, 0.531088471f},
-std::array<float,2>{0.354049802f, 0.490162849f},
-std::array<float,2>{0.625369728f, 0.982180059f},
-std::array<float,2>{0.606360197f, 0.349410713f},
-std::array<float,2>{0.474110842f, 0.804342031f},
-std::array<float,2>{0.060669221f, 0.186406925f},
-std::array<float,2>{0.811974466f, 0.715681016f},
-std::array<float,2>{0.718406916f, 0.195756644f},
-std::array<float,2>{0.270623058f, 0.665394604f},
-std::array<float,2>{0.231155634f, 0.307813257f},
-std::array<float,2>{0.935349226f, 0.827460766f},
-std::array<float,2>{0.863345206f, 0.435001165f},
-std::array<float,2>{0.0834093764f, 0.914800525f},
-std::array<float,2>{0.385268867f, 0.0210306179f},
-std::array<float,2>{0.507191479f, 0.607033312f},
-std::array<float,2>{0.766137183f, 0.145804584f},
-std::array<float,2>{0.0177025739f, 0.735378325f},
-std::array<float,2>{0.463405639f, 0.326170981f},
-std::array<float,2>{0.577915132f, 0.778774023f},
-std::array<float,2>{0.669411957f, 0.467527449f},
-std::array<float,2>{0.324973315f, 0.952774942f},
-std::array<float,2>{0.173872963f, 0.112789229f},
-std::array<float,2>{0.941652775f, 0.556368351f},
-std::array<float,2>{0.548783183f, 0.0400565602f},
-std::array<float,2>{0.415103465f, 0.574561059f},
-std::array<float,2>{0.111440592f, 0.394006789f},
-std::array<float,2>{0.836690009f, 0.883277357f},
-std::array<float,2>{0.8837201f, 0.267888218f},
-std::array<float,2>{0.205635369f, 0.861179769f},
-std::array<float,2>{0.293363571f, 0.224136084f},
-std::array<float,2>{0.728591204f, 0.625488341f},
-std::array<float,2>{0.797845304f, 0.123330295f},
-std::array<float,2>{0.0539020374f, 0.549749434f},
-std::array<float,2>{0.481804222f, 0.455814272f},
-std::array<float,2>{0.600052238f, 0.945266366f},
-std::array<float,2>{0.637574673f, 0.315145075f},
-std::array<float,2>{0.344401032f, 0.768274009f},
-std::array<float,2>{0.136706159f, 0.148764238f},
-std::array<float,2>{0.990278304f, 0.748684585f},
-std::array<float,2>{0.513784409f, 0.227059364f},
-std::array<float,2>{0.380711049f, 0.636680543f},
-std::array<float,2>{0.0884781182f, 0.277412951f},
-std::array<float,2>{0.869447589f, 0.868313015f},
-std::array<float,2>{0.92648828f, 0.403354704f},
-std::array<float,2>{0.224667236f, 0.875187516f},
-std::array<float,2>{0.277734607f, 0.0329194702f},
-std::array<float,2>{0.704247415f, 0.568749964f},
-std::array<float,2>{0.946177542f, 0.173033684f},
-std::array<float,2>{0.182773203f, 0.707730889f},
-std::array<float,2>{0.319800377f, 0.357296318f},
-std::array<float,2>{0.662683845f, 0.807970107f},
-std::array<float,2>{0.564087689f, 0.493633479f},
-std::array<float,2>{0.458027661f, 0.968834817f},
-std::array<float,2>{0.0293629728f, 0.0874155015f},
-std::array<float,2>{0.778524578f, 0.521317482f},
-std::array<float,2>{0.721664071f, 0.0311971046f},
-std::array<float,2>{0.282344371f, 0.598832607f},
-std::array<float,2>{0.21176888f, 0.423800111f},
-std::array<float,2>{0.881614566f, 0.911385655f},
-std::array<float,2>{0.835041046f, 0.300917327f},
-std::array<float,2>{0.123623542f, 0.81846416f},
-std::array<float,2>{0.407449633f, 0.187985584f},
-std::array<float,2>{0.559566319f, 0.662670553f},
-std::array<float,2>{0.894574702f, 0.0491217412f},
-std::array<float,2>{0.199553326f, 0.578251243f},
-std::array<float,2>{0.309892386f, 0.387324125f},
-std::array<float,2>{0.738932431f, 0.899088144f},
-std::array<float,2>{0.5367136f, 0.257829845f},
-std::array<float,2>{0.437465042f, 0.855101943f},
-std::array<float,2>{0.105167948f, 0.240770936f},
-std::array<float,2>{0.825067997f, 0.6425879f},
-std::array<float,2>{0.687127233f, 0.127238631f},
-std::array<float,2>{0.33210209f, 0.7236588f},
-std::array<float,2>{0.170469433f, 0.340519041f},
-std::array<float,2>{0.953609228f, 0.754158139f},
-std::array<float,2>{0.755643427f, 0.445503354f},
-std::array<float,2>{0.00415647775f, 0.964092314f},
-std::array<float,2>{0.445784301f, 0.0952671245f},
-std::array<float,2>{0.578205347f, 0.545544088f},
-std::array<float,2>{0.856199205f, 0.208493724f},
-std::array<float,2>{0.0715741292f, 0.687271774f},
-std::array<float,2>{0.399829f, 0.28916043f},
-std::array<float,2>{0.519652784f, 0.839942813f},
-std::array<float,2>{0.701893866f, 0.418023914f},
-std::array<float,2>{0.255290538f, 0.92317605f},
-std::array<float,2>{0.241021797f, 0.0090816291f},
-std::array<float,2>{0.91329354f, 0.612269998f},
-std::array<float,2>{0.618930161f, 0.0638382062f},
-std::array<float,2>{0.488382727f, 0.509572744f},
-std::array<float,2>{0.0377905332f, 0.484330326f},
-std::array<float,2>{0.795869172f, 0.988489687f},
-std::array<float,2>{0.968975663f, 0.362575382f},
-std::array<float,2>{0.145878658f, 0.78760004f},
-std::array<float,2>{0.374299198f, 0.165144026f},
-std::array<float,2>{0.643604457f, 0.701541126f},
-std::array<float,2>{0.786341667f, 0.0248571467f},
-std::array<float,2>{0.0441926308f, 0.59484148f},
-std::array<float,2>{0.494426429f, 0.426381886f},
-std::array<float,2>{0.61227411f, 0.909913301f},
-std::array<float,2>{0.65423429f, 0.300629944f},
-std::array<float,2>{0.360898554f, 0.815792382f},
-std::array<float,2>{0.152100369f, 0.193379626f},
-std::array<float,2>{0.97902149f, 0.6600914f},
-std::array<float,2>{0.529909194f, 0.178924248f},
-std::array<float,2>{0.393619299f, 0.70392406f},
-std::array<float,2>{0.0701250657f, 0.35400033f},
-std::array<float,2>{0.848966956f, 0.811380506f},
-std::array<float,2>{0.915880799f, 0.49863562f},
-std::array<float,2>{0.248029634f, 0.976146936f},
-std::array<float,2>{0.259239495f, 0.090578422f},
-std::array<float,2>{0.692404687f, 0.517761886f},
-std::array<float,2>{0.96154505f, 0.231974408f},
-std::array<float,2>{0.160948664f, 0.637354732f},
-std::array<float,2>{0.341594934f, 0.275293797f},
-std::array<float,2>{0.674242675f, 0.873678386f},
-std::array<float,2>{0.592277408f, 0.3990013f},
-std::array<float,2>{0.444544345f, 0.880185962f},
-std::array<float,2>{0.00823887065f, 0.0382821411f},
-std::array<float,2>{0.76081413f, 0.563744903f},
-std::array<float,2>{0.74511224f, 0.120230258f},
-std::array<float,2>{0.298074603f, 0.55235815f},
-std::array<float,2>{0.191410303f, 0.459763497f},
-std::array<float,2>{0.902653039f, 0.939288497f},
-std::array<float,2>{0.813169658f, 0.316969424f},
-std::array<float,2>{0.0974196568f, 0.771667898f},
-std::array<float,2>{0.426903903f, 0.153619975f},
-std::array<float,2>{0.539277017f, 0.745918989f},
-std::array<float,2>{0.890127003f, 0.0667393655f},
-std::array<float,2>{0.209016114f, 0.514886379f},
-std::array<float,2>{0.289590985f, 0.479316145f},
-std::array<float,2>{0.731499612f, 0.984970093f},
-std::array<float,2>{0.55121243f, 0.364466816f},
-std::array<float,2>{0.421711862f, 0.781504035f},
-std::array<float,2>{0.114295326f, 0.170982271f},
-std::array<float,2>{0.840547264f, 0.698336065f},
-std::array<float,2>{0.665837169f, 0.205119178f},
-std::array<float,2>{0.323955089f, 0.680742145f},
-std::array<float,2>{0.176839978f, 0.294132411f},
-std::array<float,2>{0.93780458f, 0.838520706f},
-std::array<float,2>{0.772690296f, 0.414126247f},
-std::array<float,2>{0.0233849958f, 0.925983012f},
-std::array<float,2>{0.464886338f, 0.012773687f},
-std::array<float,2>{0.571460783f, 0.613683403f},
-std::array<float,2>{0.860103846f, 0.131409705f},
-std::array<float,2>{0.0783003345f, 0.722357988f},
-std::array<float,2>{0.390433997f, 0.337242275f},
-std::array<float,2>{0.502717793f, 0.750254452f},
-std::array<float,2>{0.713521719f, 0.450285733f},
-std::array<float,2>{0.266105413f, 0.965053082f},
-std::array<float,2>{0.226925969f, 0.0987855047f},
-std::array<float,2>{0.931433678f, 0.542165577f},
-std::array<float,2>{0.603105783f, 0.0529707782f},
-std::array<float,2>{0.469217062f, 0.582311928f},
-std::array<float,2>{0.0556409694f, 0.383916259f},
-std::array<float,2>{0.805460393f, 0.902772367f},
-std::array<float,2>{0.998019636f, 0.263576657f},
-std::array<float,2>{0.131256238f, 0.856622398f},
-std::array<float,2>{0.358241796f, 0.237788841f},
-std::array<float,2>{0.630371988f, 0.646864831f},
-std::array<float,2>{0.828709126f, 0.102323808f},
-std::array<float,2>{0.118927278f, 0.535949051f},
-std::array<float,2>{0.412411898f, 0.439234734f},
-std::array<float,2>{0.556261241f, 0.955252588f},
-std::array<float,2>{0.726386189f, 0.32829687f},
-std::array<float,2>{0.286687851f, 0.758069098f},
-std::array<float,2>{0.217822805f, 0.13562192f},
-std::array<float,2>{0.876443863f, 0.729467332f},
-std::array<float,2>{0.567480266f, 0.249625325f},
-std::array<float,2>{0.4562262f, 0.648443341f},
-std::array<float,2>{0.0243016109f, 0.257730633f},
-std::array<float,2>{0.775414884f, 0.851521432f},
-std::array<float,2>{0.951120496f, 0.377906322f},
-std::array<float,2>{0.187360123f, 0.89762646f},
-std::array<float,2>{0.314152807f, 0.0611486621f},
-std::array<float,2>{0.656633735f, 0.58937186f},
-std::array<float,2>{0.924562216f, 0.162310973f},
-std::array<float,2>{0.221336514f, 0.692284346f},
-std::array<float,2>{0.274562687f, 0.372168779f},
-std::array<float,2>{0.707933664f, 0.790652454f},
-std::array<float,2>{0.508661807f, 0.475666463f},
-std::array<float,2>{0.376539499f, 0.999477744f},
-std::array<float,2>{0.0910151005f, 0.0780390203f},
-std::array<float,2>{0.871946752f, 0.500024021f},
-std::array<float,2>{0.635644794f, 0.0029343944f},
-std::array<float,2>{0.350386471f, 0.61799264f},
-std::array<float,2>{0.137784049f, 0.414040089f},
-std::array<float,2>{0.985063553f, 0.931253254f},
-std::array<float,2>{0.803577125f, 0.281440645f},
-std::array<float,2>{0.047859367f, 0.834181607f},
-std::array<float,2>{0.480093032f, 0.217779666f},
-std::array<float,2>{0.595888674f, 0.675953507f},
-std::array<float,2>{0.973130703f, 0.0451472588f},
-std::array<float,2>{0.144341543f, 0.571496785f},
-std::array<float,2>{0.368198991f, 0.39529714f},
-std::array<float,2>{0.646068454f, 0.888580918f},
-std::array<float,2>{0.622618258f, 0.273093343f},
-std::array<float,2>{0.484508514f, 0.865184307f},
-std::array<float,2>{0.0329676978f, 0.222172439f},
-std::array<float,2>{0.791922688f, 0.629206479f},
-std::array<float,2>{0.696046412f, 0.140721545f},
-std::array<float,2>{0.253830463f, 0.738633156f},
-std::array<float,2>{0.237910509f, 0.323242575f},
-std::array<float,2>{0.908888936f, 0.776775837f},
-std::array<float,2>{0.852831066f, 0.462236851f},
-std::array<float,2>{0.0770232603f, 0.9489066f},
-std::array<float,2>{0.405355841f, 0.116417296f},
-std::array<float,2>{0.519491136f, 0.561881959f},
-std::array<float,2>{0.750880957f, 0.202893153f},
-std::array<float,2>{0.00319497846f, 0.670949817f},
-std::array<float,2>{0.450772613f, 0.311138779f},
-std::array<float,2>{0.584818959f, 0.822309732f},
-std::array<float,2>{0.682331145f, 0.431337893f},
-std::array<float,2>{0.331606627f, 0.919121325f},
-std::array<float,2>{0.164540589f, 0.0177127179f},
-std::array<float,2>{0.957169235f, 0.601712406f},
-std::array<float,2>{0.53344208f, 0.0840396881f},
-std::array<float,2>{0.433375299f, 0.525027931f},
-std::array<float,2>{0.109253503f, 0.48612386f},
-std::array<float,2>{0.82208252f, 0.978773594f},
-std::array<float,2>{0.891034782f, 0.345205754f},
-std::array<float,2>{0.198723271f, 0.799294114f},
-std::array<float,2>{0.308478594f, 0.181934178f},
-std::array<float,2>{0.738240659f, 0.713206887f},
-std::array<float,2>{0.843788147f, 0.0551927164f},
-std::array<float,2>{0.0652256384f, 0.592000663f},
-std::array<float,2>{0.396109968f, 0.379972637f},
-std::array<float,2>{0.524203241f, 0.891792357f},
-std::array<float,2>{0.68804431f, 0.253334403f},
-std::array<float,2>{0.26552406f, 0.845493078f},
-std::array<float,2>{0.245243594f, 0.243792921f},
-std::array<float,2>{0.920390964f, 0.653950274f},
-std::array<float,2>{0.616992891f, 0.140297279f},
-std::array<float,2>{0.499636143f, 0.732004583f},
-std::array<float,2>{0.0406055264f, 0.333230972f},
-std::array<float,2>{0.785122573f, 0.764051437f},
-std::array<float,2>{0.981845021f, 0.444157064f},
-std::array<float,2>{0.155632809f, 0.957224548f},
-std::array<float,2>{0.366909921f, 0.107479982f},
-std::array<float,2>{0.650420666f, 0.531328797f},
-std::array<float,2>{0.899416268f, 0.214733183f},
-std::array<float,2>{0.188928485f, 0.671992958f},
-std::array<float,2>{0.302638501f, 0.286782742f},
-std::array<float,2>{0.748909414f, 0.830443799f},
-std::array<float,2>{0.544770837f, 0.409733504f},
-std::array<float,2>{0.423544645f, 0.93410939f},
-std::array<float,2>{0.100106277f, 0.00684216619f},
-std::array<float,2>{0.818791091f, 0.621874988f},
-std::array<float,2>{0.678711116f, 0.0727492645f},
-std::array<float,2>{0.338862062f, 0.506408155f},
-std::array<float,2>{0.158385366f, 0.470926255f},
-std::array<float,2>{0.967922032f, 0.9929775f},
-std::array<float,2>{0.765605986f, 0.367687672f},
-std::array<float,2>{0.014800963f, 0.794490457f},
-std::array<float,2>{0.439710885f, 0.157118186f},
-std::array<float,2>{0.589499593f, 0.689016461f},
-std::array<float,2>{0.944793582f, 0.110873923f},
-std::array<float,2>{0.171964139f, 0.558591068f},
-std::array<float,2>{0.327045709f, 0.464912266f},
-std::array<float,2>{0.670698166f, 0.950529516f},
-std::array<float,2>{0.575959444f, 0.327100903f},
-std::array<float,2>{0.462849081f, 0.781206846f},
-std::array<float,2>{0.016343886f, 0.146818355f},
-std::array<float,2>{0.76851666f, 0.736988723f},
-std::array<float,2>{0.726631165f, 0.225992009f},
-std::array<float,2>{0.296732098f, 0.628208339f},
-std::array<float,2>{0.204822719f, 0.267548531f},
-std::array<float,2>{0.884929061f, 0.862640321f},
-std::array<float,2>{0.839364409f, 0.392256707f},
-std::array<float,2>{0.110466234f, 0.884917974f},
-std::array<float,2>{0.417521328f, 0.0427889116f},
-std::array<float,2>{0.549300671f, 0.576415956f},
-std::array<float,2>{0.809720814f, 0.183935493f},
-std::array<float,2>{0.0595011488f, 0.717846334f},
-std::array<float,2>{0.475746661f, 0.350908905f},
-std::array<float,2>{0.608615398f, 0.802218378f},
-std::array<float,2>{0.627890825f, 0.49194923f},
-std::array<float,2>{0.351894289f, 0.983287156f},
-std::array<float,2>{0.125779435f, 0.0818409845f},
-std::array<float,2>{0.99284029f, 0.528650463f},
-std::array<float,2>{0.504208505f, 0.0226121843f},
-std::array<float,2>{0.383796036f, 0.608961821f},
-std::array<float,2>{0.085064441f, 0.437181979f},
-std::array<float,2>{0.86692214f, 0.916281044f},
-std::array<float,2>{0.936283827f, 0.306616575f},
-std::array<float,2>{0.234020934f, 0.824954927f},
-std::array<float,2>{0.272824496f, 0.199109778f},
-std::array<float,2>{0.714969516f, 0.666873395f},
-std::array<float,2>{0.780954719f, 0.0882033855f},
-std::array<float,2>{0.0280693881f, 0.522220314f},
-std::array<float,2>{0.459424585f, 0.494377941f},
-std::array<float,2>{0.566351891f, 0.971813977f},
-std::array<float,2>{0.660250783f, 0.359288394f},
-std::array<float,2>{0.316801697f, 0.806598127f},
-std::array<float,2>{0.180596128f, 0.175052777f},
-std::array<float,2>{0.94835031f, 0.710000813f},
-std::array<float,2>{0.561879933f, 0.19087863f},
-std::array<float,2>{0.408717602f, 0.661193669f},
-std::array<float,2>{0.122088999f, 0.304549694f},
-std::array<float,2>{0.833019018f, 0.816556334f},
-std::array<float,2>{0.880472541f, 0.423909903f},
-std::array<float,2>{0.213706836f, 0.91368103f},
-std::array<float,2>{0.285140693f, 0.0281606261f},
-std::array<float,2>{0.718958139f, 0.6001513f},
-std::array<float,2>{0.990145266f, 0.151399434f},
-std::array<float,2>{0.133760646f, 0.747490108f},
-std::array<float,2>{0.346540421f, 0.312869042f},
-std::array<float,2>{0.640314877f, 0.766762137f},
-std::array<float,2>{0.598457277f, 0.453950524f},
-std::array<float,2>{0.482885927f, 0.942862034f},
-std::array<float,2>{0.0510049574f, 0.122348614f},
-std::array<float,2>{0.800763667f, 0.548756838f},
-std::array<float,2>{0.706702888f, 0.0334640294f},
-std::array<float,2>{0.279578686f, 0.568205178f},
-std::array<float,2>{0.224461555f, 0.404593408f},
-std::array<float,2>{0.929226756f, 0.878462195f},
-std::array<float,2>{0.86721462f, 0.280565351f},
-std::array<float,2>{0.0874234363f, 0.869240463f},
-std::array<float,2>{0.380920023f, 0.229039982f},
-std::array<float,2>{0.512679458f, 0.633387387f},
-std::array<float,2>{0.911362231f, 0.0110626286f},
-std::array<float,2>{0.238624081f, 0.609716833f},
-std::array<float,2>{0.25750652f, 0.420539498f},
-std::array<float,2>{0.700108111f, 0.924823821f},
-std::array<float,2>{0.522485614f, 0.292914659f},
-std::array<float,2>{0.401429892f, 0.843224585f},
-std::array<float,2>{0.0740686059f, 0.21089305f},
-std::array<float,2>{0.859280348f, 0.685517907f},
-std::array<float,2>{0.642141402f, 0.166425839f},
-std::array<float,2>{0.372197181f, 0.699723244f},
-std::array<float,2>{0.14827095f, 0.359908164f},
-std::array<float,2>{0.97172904f, 0.785751164f},
-std::array<float,2>{0.79346329f, 0.48155117f},
-std::array<float,2>{0.0353407301f, 0.990387857f},
-std::array<float,2>{0.490892649f, 0.065864712f},
-std::array<float,2>{0.620229125f, 0.511029482f},
-std::array<float,2>{0.827612102f, 0.239551172f},
-std::array<float,2>{0.101820074f, 0.641653776f},
-std::array<float,2>{0.435357779f, 0.260754526f},
-std::array<float,2>{0.53816098f, 0.851591706f},
-std::array<float,2>{0.740510345f, 0.389692724f},
-std::array<float,2>{0.31061545f, 0.9012025f},
-std::array<float,2>{0.201379657f, 0.0476622246f},
-std::array<float,2>{0.897807419f, 0.581407368f},
-std::array<float,2>{0.582015157f, 0.0957214385f},
-std::array<float,2>{0.448931187f, 0.544912755f},
-std::array<float,2>{0.00615003752f, 0.448538721f},
-std::array<float,2>{0.756486297f, 0.96205014f},
-std::array<float,2>{0.95643574f, 0.343511283f},
-std::array<float,2>{0.168059245f, 0.757759511f},
-std::array<float,2>{0.334652752f, 0.125402361f},
-std::array<float,2>{0.685506523f, 0.72518003f},
-std::array<float,2>{0.784855127f, 0.0575672202f},
-std::array<float,2>{0.0409386791f, 0.590803206f},
-std::array<float,2>{0.499809951f, 0.382462472f},
-std::array<float,2>{0.61682266f, 0.892913759f},
-std::array<float,2>{0.650809407f, 0.251400143f},
-std::array<float,2>{0.367103249f, 0.847481906f},
-std::array<float,2>{0.155420527f, 0.24524349f},
-std::array<float,2>{0.981522202f, 0.655079007f},
-std::array<float,2>{0.52414906f, 0.137345418f},
-std::array<float,2>{0.396416783f, 0.734102249f},
-std::array<float,2>{0.0651579276f, 0.334548622f},
-std::array<float,2>{0.844127417f, 0.763004065f},
-std::array<float,2>{0.919957519f, 0.442107111f},
-std::array<float,2>{0.245574176f, 0.960138619f},
-std::array<float,2>{0.265222192f, 0.106013127f},
-std::array<float,2>{0.688295841f, 0.533403158f},
-std::array<float,2>{0.968194246f, 0.212554991f},
-std::array<float,2>{0.158675402f, 0.67407614f},
-std::array<float,2>{0.338610142f, 0.287689209f},
-std::array<float,2>{0.679037035f, 0.829833388f},
-std::array<float,2>{0.58964783f, 0.406699449f},
-std::array<float,2>{0.439485461f, 0.935975671f},
-std::array<float,2>{0.0149159143f, 0.00486787409f},
-std::array<float,2>{0.765274167f, 0.624863386f},
-std::array<float,2>{0.748594701f, 0.0705390051f},
-std::array<float,2>{0.302409083f, 0.504873037f},
-std::array<float,2>{0.188698038f, 0.469652981f},
-std::array<float,2>{0.899750531f, 0.995511472f},
-std::array<float,2>{0.818546355f, 0.369701207f},
-std::array<float,2>{0.100396298f, 0.796720505f},
-std::array<float,2>{0.423721462f, 0.159677252f},
-std::array<float,2>{0.544532597f, 0.690644264f},
-std::array<float,2>{0.885212123f, 0.111695834f},
-std::array<float,2>{0.20488736f, 0.554908991f},
-std::array<float,2>{0.296390384f, 0.467894614f},
-std::array<float,2>{0.726926088f, 0.951577723f},
-std::array<float,2>{0.548971117f, 0.324751794f},
-std::array<float,2>{0.417964846f, 0.777389288f},
-std::array<float,2>{0.110706553f, 0.144871011f},
-std::array<float,2>{0.839640677f, 0.73526758f},
-std::array<float,2>{0.670422554f, 0.222688943f},
-std::array<float,2>{0.326892167f, 0.626678169f},
-std::array<float,2>{0.172150552f, 0.269064337f},
-std::array<float,2>{0.944557846f, 0.859534204f},
-std::array<float,2>{0.768139601f, 0.392843366f},
-std::array<float,2>{0.0164876711f, 0.883884549f},
-std::array<float,2>{0.46260047f, 0.0398661271f},
-std::array<float,2>{0.575862944f, 0.57564199f},
-std::array<float,2>{0.867186248f, 0.187169313f},
-std::array<float,2>{0.0853972659f, 0.716133952f},
-std::array<float,2>{0.384173453f, 0.348305672f},
-std::array<float,2>{0.504046977f, 0.803447127f},
-std::array<float,2>{0.715169251f, 0.489230156f},
-std::array<float,2>{0.272697896f, 0.981116176f},
-std::array<float,2>{0.234316468f, 0.0795001388f},
-std::array<float,2>{0.936208546f, 0.529690564f},
-std::array<float,2>{0.608875632f, 0.0199063811f},
-std::array<float,2>{0.476024538f, 0.605905771f},
-std::array<float,2>{0.0591098666f, 0.433686644f},
-std::array<float,2>{0.809955001f, 0.915269315f},
-std::array<float,2>{0.993125618f, 0.306864291f},
-std::array<float,2>{0.125684693f, 0.826412141f},
-std::array<float,2>{0.351747751f, 0.196872875f},
-std::array<float,2>{0.627541006f, 0.664335549f},
-std::array<float,2>{0.833406925f, 0.0862218067f},
-std::array<float,2>{0.122407779f, 0.52009064f},
-std::array<float,2>{0.409088939f, 0.493035227f},
-std::array<float,2>{0.561620355f, 0.969803333f},
-std::array<float,2>{0.719163477f, 0.356372178f},
-std::array<float,2>{0.284810185f, 0.80750531f},
-std::array<float,2>{0.213400066f, 0.17208001f},
-std::array<float,2>{0.880809486f, 0.708017826f},
-std::array<float,2>{0.566144705f, 0.188696787f},
-std::array<float,2>{0.459143668f, 0.663828969f},
-std::array<float,2>{0.0282767452f, 0.302108139f},
-std::array<float,2>{0.781141222f, 0.820129514f},
-std::array<float,2>{0.948636234f, 0.422814935f},
-std::array<float,2>{0.18035613f, 0.910905957f},
-std::array<float,2>{0.316626519f, 0.0302203875f},
-std::array<float,2>{0.660606921f, 0.598090947f},
-std::array<float,2>{0.929560721f, 0.150023162f},
-std::array<float,2>{0.224160582f, 0.749846041f},
-std::array<float,2>{0.279493451f, 0.315820277f},
-std::array<float,2>{0.70702821f, 0.769528687f},
-std::array<float,2>{0.512256026f, 0.456414521f},
-std::array<float,2>{0.381133735f, 0.944013298f},
-std::array<float,2>{0.087738052f, 0.124559917f},
-std::array<float,2>{0.867470622f, 0.549859166f},
-std::array<float,2>{0.640470684f, 0.0321463533f},
-std::array<float,2>{0.346337169f, 0.569494426f},
-std::array<float,2>{0.133501157f, 0.402930468f},
-std::array<float,2>{0.989792526f, 0.87691319f},
-std::array<float,2>{0.800533116f, 0.278926611f},
-std::array<float,2>{0.0511737466f, 0.868145823f},
-std::array<float,2>{0.482566684f, 0.227539837f},
-std::array<float,2>{0.598376393f, 0.635063052f},
-std::array<float,2>{0.972035408f, 0.00787850097f},
-std::array<float,2>{0.148044646f, 0.612905025f},
-std::array<float,2>{0.372339159f, 0.419725746f},
-std::array<float,2>{0.642432272f, 0.922442257f},
-std::array<float,2>{0.620468855f, 0.290768832f},
-std::array<float,2>{0.491067171f, 0.841301918f},
-std::array<float,2>{0.03541518f, 0.207060352f},
-std::array<float,2>{0.793760955f, 0.685759842f},
-std::array<float,2>{0.699736953f, 0.164505646f},
-std::array<float,2>{0.257612556f, 0.702724814f},
-std::array<float,2>{0.238462821f, 0.361409754f},
-std::array<float,2>{0.911613584f, 0.788229406f},
-std::array<float,2>{0.859127879f, 0.482797295f},
-std::array<float,2>{0.0737864971f, 0.990195692f},
-std::array<float,2>{0.401644111f, 0.0628247932f},
-std::array<float,2>{0.522864699f, 0.508331478f},
-std::array<float,2>{0.756783009f, 0.241288468f},
-std::array<float,2>{0.00588590605f, 0.6444785f},
-std::array<float,2>{0.4490062f, 0.259679615f},
-std::array<float,2>{0.581610858f, 0.85388422f},
-std::array<float,2>{0.685130775f, 0.387952f},
-std::array<float,2>{0.334821194f, 0.900353312f},
-std::array<float,2>{0.168232217f, 0.0507674515f},
-std::array<float,2>{0.956294179f, 0.580038428f},
-std::array<float,2>{0.538373947f, 0.094121255f},
-std::array<float,2>{0.435298949f, 0.546793997f},
-std::array<float,2>{0.101599924f, 0.44696945f},
-std::array<float,2>{0.82721734f, 0.963513076f},
-std::array<float,2>{0.897625387f, 0.341032475f},
-std::array<float,2>{0.201589331f, 0.754970849f},
-std::array<float,2>{0.310929716f, 0.128716111f},
-std::array<float,2>{0.740422547f, 0.723430455f},
-std::array<float,2>{0.848800421f, 0.0256745033f},
-std::array<float,2>{0.0698399246f, 0.596980333f},
-std::array<float,2>{0.394010812f, 0.429489464f},
-std::array<float,2>{0.530036449f, 0.90726912f},
-std::array<float,2>{0.692680418f, 0.298076361f},
-std::array<float,2>{0.258972764f, 0.814386964f},
-std::array<float,2>{0.24766925f, 0.192155674f},
-std::array<float,2>{0.915710807f, 0.656916916f},
-std::array<float,2>{0.611959279f, 0.176719189f},
-std::array<float,2>{0.494372547f, 0.706144512f},
-std::array<float,2>{0.0440760665f, 0.352272749f},
-std::array<float,2>{0.786534846f, 0.809203029f},
-std::array<float,2>{0.979351282f, 0.497587562f},
-std::array<float,2>{0.151929885f, 0.972876549f},
-std::array<float,2>{0.361207038f, 0.0935151801f},
-std::array<float,2>{0.653958023f, 0.517045259f},
-std::array<float,2>{0.902465582f, 0.23413384f},
-std::array<float,2>{0.191859007f, 0.639999151f},
-std::array<float,2>{0.298250586f, 0.277259558f},
-std::array<float,2>{0.74478662f, 0.872034371f},
-std::array<float,2>{0.539463043f, 0.401230007f},
-std::array<float,2>{0.427108616f, 0.881144345f},
-std::array<float,2>{0.0973925292f, 0.0352638252f},
-std::array<float,2>{0.813285291f, 0.565049171f},
-std::array<float,2>{0.673982382f, 0.117578603f},
-std::array<float,2>{0.341538101f, 0.552742302f},
-std::array<float,2>{0.160751864f, 0.457720995f},
-std::array<float,2>{0.96182251f, 0.941122115f},
-std::array<float,2>{0.76113838f, 0.3196522f},
-std::array<float,2>{0.00804799609f, 0.770307899f},
-std::array<float,2>{0.444784045f, 0.155927613f},
-std::array<float,2>{0.591954708f, 0.743853569f},
-std::array<float,2>{0.937527001f, 0.0689321011f},
-std::array<float,2>{0.177061185f, 0.51192987f},
-std::array<float,2>{0.324170798f, 0.477330506f},
-std::array<float,2>{0.66571492f, 0.987131357f},
-std::array<float,2>{0.571680665f, 0.365517735f},
-std::array<float,2>{0.46526581f, 0.783720553f},
-std::array<float,2>{0.0231529027f, 0.169087857f},
-std::array<float,2>{0.772814095f, 0.695815086f},
-std::array<float,2>{0.731835842f, 0.203892067f},
-std::array<float,2>{0.290003538f, 0.682205796f},
-std::array<float,2>{0.209417745f, 0.296784014f},
-std::array<float,2>{0.889775753f, 0.837414742f},
-std::array<float,2>{0.840652049f, 0.416965842f},
-std::array<float,2>{0.114544943f, 0.928513587f},
-std::array<float,2>{0.421626806f, 0.0142203365f},
-std::array<float,2>{0.550845444f, 0.616059482f},
-std::array<float,2>{0.805176258f, 0.129626065f},
-std::array<float,2>{0.0553408451f, 0.719015837f},
-std::array<float,2>{0.468808889f, 0.33856681f},
-std::array<float,2>{0.603415608f, 0.753276467f},
-std::array<float,2>{0.630740941f, 0.451276273f},
-std::array<float,2>{0.35802862f, 0.967133939f},
-std::array<float,2>{0.130884424f, 0.100850686f},
-std::array<float,2>{0.997784078f, 0.540459394f},
-std::array<float,2>{0.502551734f, 0.0523511097f},
-std::array<float,2>{0.390218794f, 0.585449755f},
-std::array<float,2>{0.0786110237f, 0.385650903f},
-std::array<float,2>{0.860171199f, 0.904456615f},
-std::array<float,2>{0.931183279f, 0.263710141f},
-std::array<float,2>{0.226633132f, 0.858756244f},
-std::array<float,2>{0.265646428f, 0.234505504f},
-std::array<float,2>{0.713816464f, 0.646430671f},
-std::array<float,2>{0.775753975f, 0.104677722f},
-std::array<float,2>{0.0240511484f, 0.538335085f},
-std::array<float,2>{0.456530303f, 0.441202939f},
-std::array<float,2>{0.567855418f, 0.953889787f},
-std::array<float,2>{0.656473696f, 0.331287444f},
-std::array<float,2>{0.31436041f, 0.761309922f},
-std::array<float,2>{0.187149882f, 0.133277312f},
-std::array<float,2>{0.950915277f, 0.727125168f},
-std::array<float,2>{0.556517601f, 0.246965662f},
-std::array<float,2>{0.412319779f, 0.651908636f},
-std::array<float,2>{0.11872863f, 0.25518316f},
-std::array<float,2>{0.828858137f, 0.847804546f},
-std::array<float,2>{0.875996828f, 0.375664383f},
-std::array<float,2>{0.218017668f, 0.894901037f},
-std::array<float,2>{0.287042826f, 0.0595132895f},
-std::array<float,2>{0.726212382f, 0.586519539f},
-std::array<float,2>{0.985319912f, 0.160377041f},
-std::array<float,2>{0.1380146f, 0.693800509f},
-std::array<float,2>{0.350265771f, 0.373150587f},
-std::array<float,2>{0.635289371f, 0.792856455f},
-std::array<float,2>{0.596103251f, 0.473053306f},
-std::array<float,2>{0.480456114f, 0.997086406f},
-std::array<float,2>{0.0483331978f, 0.075310789f},
-std::array<float,2>{0.803222954f, 0.50335449f},
-std::array<float,2>{0.707528889f, 0.00191518874f},
-std::array<float,2>{0.274665952f, 0.62025249f},
-std::array<float,2>{0.22150512f, 0.410800934f},
-std::array<float,2>{0.924372792f, 0.932724118f},
-std::array<float,2>{0.871705413f, 0.283341885f},
-std::array<float,2>{0.0911636055f, 0.832443178f},
-std::array<float,2>{0.376821846f, 0.216289937f},
-std::array<float,2>{0.508302271f, 0.678080738f},
-std::array<float,2>{0.909048975f, 0.0447227955f},
-std::array<float,2>{0.238042161f, 0.57237339f},
-std::array<float,2>{0.253469706f, 0.397949666f},
-std::array<float,2>{0.696005464f, 0.889968932f},
-std::array<float,2>{0.519262254f, 0.269542247f},
-std::array<float,2>{0.405542463f, 0.865527511f},
-std::array<float,2>{0.0769026354f, 0.220202833f},
-std::array<float,2>{0.852776945f, 0.632697284f},
-std::array<float,2>{0.64637816f, 0.144130647f},
-std::array<float,2>{0.368535101f, 0.740397096f},
-std::array<float,2>{0.144245401f, 0.321406722f},
-std::array<float,2>{0.972858191f, 0.775007725f},
-std::array<float,2>{0.791733325f, 0.464523226f},
-std::array<float,2>{0.0328940488f, 0.94642967f},
-std::array<float,2>{0.48470369f, 0.114418834f},
-std::array<float,2>{0.622926295f, 0.559254527f},
-std::array<float,2>{0.821806788f, 0.199526206f},
-std::array<float,2>{0.109098911f, 0.669479609f},
-std::array<float,2>{0.433242083f, 0.309305698f},
-std::array<float,2>{0.533468783f, 0.821647584f},
-std::array<float,2>{0.737803936f, 0.432189077f},
-std::array<float,2>{0.308135629f, 0.921093166f},
-std::array<float,2>{0.198352605f, 0.0168143436f},
-std::array<float,2>{0.89081043f, 0.603860915f},
-std::array<float,2>{0.584558427f, 0.0822154209f},
-std::array<float,2>{0.450982839f, 0.527067244f},
-std::array<float,2>{0.00308319298f, 0.487894416f},
-std::array<float,2>{0.750608683f, 0.978137136f},
-std::array<float,2>{0.95738405f, 0.347335398f},
-std::array<float,2>{0.164279625f, 0.79750967f},
-std::array<float,2>{0.332014978f, 0.179764867f},
-std::array<float,2>{0.682378531f, 0.711608946f},
-std::array<float,2>{0.762564063f, 0.00674556056f},
-std::array<float,2>{0.0127093168f, 0.622346103f},
-std::array<float,2>{0.438144833f, 0.408381969f},
-std::array<float,2>{0.58641398f, 0.935060024f},
-std::array<float,2>{0.676740348f, 0.285593361f},
-std::array<float,2>{0.337321222f, 0.831303656f},
-std::array<float,2>{0.156677857f, 0.213485613f},
-std::array<float,2>{0.964878976f, 0.673407078f},
-std::array<float,2>{0.545457184f, 0.157685816f},
-std::array<float,2>{0.425345659f, 0.688448727f},
-std::array<float,2>{0.0977760479f, 0.368800908f},
-std::array<float,2>{0.817750454f, 0.793891907f},
-std::array<float,2>{0.901675463f, 0.472584963f},
-std::array<float,2>{0.190115049f, 0.994006753f},
-std::array<float,2>{0.304075241f, 0.0739706159f},
-std::array<float,2>{0.747138619f, 0.506925344f},
-std::array<float,2>{0.984278619f, 0.242378443f},
-std::array<float,2>{0.153427541f, 0.652572334f},
-std::array<float,2>{0.364577204f, 0.252279878f},
-std::array<float,2>{0.650310159f, 0.844198108f},
-std::array<float,2>{0.615205288f, 0.379385173f},
-std::array<float,2>{0.496617496f, 0.891178668f},
-std::array<float,2>{0.0425063595f, 0.0565193221f},
-std::array<float,2>{0.782692909f, 0.593698859f},
-std::array<float,2>{0.689625919f, 0.109310418f},
-std::array<float,2>{0.261987269f, 0.533091128f},
-std::array<float,2>{0.242624745f, 0.444776684f},
-std::array<float,2>{0.919252217f, 0.958775759f},
-std::array<float,2>{0.846299589f, 0.332258582f},
-std::array<float,2>{0.0635714754f, 0.764947355f},
-std::array<float,2>{0.397984833f, 0.139294446f},
-std::array<float,2>{0.526203632f, 0.730599046f},
-std::array<float,2>{0.935094476f, 0.0809024945f},
-std::array<float,2>{0.231287092f, 0.527824044f},
-std::array<float,2>{0.270995796f, 0.490666598f},
-std::array<float,2>{0.718723595f, 0.98423028f},
-std::array<float,2>{0.507068694f, 0.350119084f},
-std::array<float,2>{0.385698289f, 0.801367402f},
-std::array<float,2>{0.0831718072f, 0.18475078f},
-std::array<float,2>{0.863583148f, 0.716842115f},
-std::array<float,2>{0.625151694f, 0.197537959f},
-std::array<float,2>{0.354278713f, 0.667428374f},
-std::array<float,2>{0.127059594f, 0.304699779f},
-std::array<float,2>{0.994892538f, 0.825911283f},
-std::array<float,2>{0.811689258f, 0.43587783f},
-std::array<float,2>{0.0608797483f, 0.916992724f},
-std::array<float,2>{0.473707795f, 0.0220453124f},
-std::array<float,2>{0.605991304f, 0.60780859f},
-std::array<float,2>{0.83663404f, 0.148430273f},
-std::array<float,2>{0.111689791f, 0.737425685f},
-std::array<float,2>{0.415345758f, 0.327170312f},
-std::array<float,2>{0.548492432f, 0.780105948f},
-std::array<float,2>{0.728975117f, 0.465913415f},
-std::array<float,2>{0.293141752f, 0.950008035f},
-std::array<float,2>{0.205912948f, 0.10993693f},
-std::array<float,2>{0.883328199f, 0.557196856f},
-std::array<float,2>{0.577675402f, 0.0410193764f},
-std::array<float,2>{0.463690341f, 0.577692926f},
-std::array<float,2>{0.0178939365f, 0.390819877f},
-std::array<float,2>{0.76636833f, 0.886081576f},
-std::array<float,2>{0.941430509f, 0.266290873f},
-std::array<float,2>{0.174213186f, 0.86226052f},
-std::array<float,2>{0.324837804f, 0.225095481f},
-std::array<float,2>{0.669143617f, 0.627464294f},
-std::array<float,2>{0.869294941f, 0.122042932f},
-std::array<float,2>{0.0886980891f, 0.546953917f},
-std::array<float,2>{0.380469233f, 0.454660386f},
-std::array<float,2>{0.514002025f, 0.942199171f},
-std::array<float,2>{0.704362035f, 0.313548774f},
-std::array<float,2>{0.277373999f, 0.766511142f},
-std::array<float,2>{0.225064486f, 0.150597528f},
-std::array<float,2>{0.926607311f, 0.746257067f},
-std::array<float,2>{0.599841237f, 0.230002329f},
-std::array<float,2>{0.481548041f, 0.634204745f},
-std::array<float,2>{0.0540437289f, 0.279492289f},
-std::array<float,2>{0.797520578f, 0.870439708f},
-std::array<float,2>{0.990706265f, 0.406232744f},
-std::array<float,2>{0.136245459f, 0.877767622f},
-std::array<float,2>{0.344707012f, 0.0346186347f},
-std::array<float,2>{0.637240529f, 0.566639185f},
-std::array<float,2>{0.881569147f, 0.174470291f},
-std::array<float,2>{0.211436093f, 0.709151268f},
-std::array<float,2>{0.282627463f, 0.358091921f},
-std::array<float,2>{0.721294105f, 0.804853618f},
-std::array<float,2>{0.559318304f, 0.495430142f},
-std::array<float,2>{0.407499731f, 0.971036017f},
-std::array<float,2>{0.123974554f, 0.0892228112f},
-std::array<float,2>{0.83522296f, 0.523277998f},
-std::array<float,2>{0.662966549f, 0.0292640179f},
-std::array<float,2>{0.319514692f, 0.600669324f},
-std::array<float,2>{0.182895631f, 0.425460875f},
-std::array<float,2>{0.946029603f, 0.912545204f},
-std::array<float,2>{0.778680086f, 0.303355694f},
-std::array<float,2>{0.0296303686f, 0.818352282f},
-std::array<float,2>{0.458451927f, 0.190080598f},
-std::array<float,2>{0.564346492f, 0.660285354f},
-std::array<float,2>{0.953295052f, 0.0485743321f},
-std::array<float,2>{0.17077224f, 0.580084324f},
-std::array<float,2>{0.332290977f, 0.388868392f},
-std::array<float,2>{0.68726176f, 0.901842654f},
-std::array<float,2>{0.578376055f, 0.260312766f},
-std::array<float,2>{0.445536345f, 0.852936983f},
-std::array<float,2>{0.00393939298f, 0.239191502f},
-std::array<float,2>{0.755431235f, 0.641358852f},
-std::array<float,2>{0.739116549f, 0.126146674f},
-std::array<float,2>{0.309745461f, 0.725970387f},
-std::array<float,2>{0.199293315f, 0.341985136f},
-std::array<float,2>{0.894950807f, 0.756109238f},
-std::array<float,2>{0.824764073f, 0.447298765f},
-std::array<float,2>{0.105231278f, 0.961012185f},
-std::array<float,2>{0.437147558f, 0.0968394578f},
-std::array<float,2>{0.536906242f, 0.543507993f},
-std::array<float,2>{0.795621634f, 0.209531993f},
-std::array<float,2>{0.0379584767f, 0.684130549f},
-std::array<float,2>{0.488554746f, 0.291187495f},
-std::array<float,2>{0.618871152f, 0.841811419f},
-std::array<float,2>{0.643973589f, 0.421008468f},
-std::array<float,2>{0.374031007f, 0.924674928f},
-std::array<float,2>{0.145624131f, 0.0106594432f},
-std::array<float,2>{0.96921438f, 0.611066222f},
-std::array<float,2>{0.519921541f, 0.0653996319f},
-std::array<float,2>{0.399484783f, 0.509860098f},
-std::array<float,2>{0.0714515895f, 0.48100847f},
-std::array<float,2>{0.856378913f, 0.991760314f},
-std::array<float,2>{0.913547933f, 0.360616595f},
-std::array<float,2>{0.240940675f, 0.786588848f},
-std::array<float,2>{0.25498724f, 0.167501599f},
-std::array<float,2>{0.701961875f, 0.700329483f},
-std::array<float,2>{0.816019833f, 0.0377554148f},
-std::array<float,2>{0.0940632224f, 0.563040435f},
-std::array<float,2>{0.429241061f, 0.399862468f},
-std::array<float,2>{0.542084813f, 0.879123509f},
-std::array<float,2>{0.744104981f, 0.273474783f},
-std::array<float,2>{0.29971537f, 0.874846697f},
-std::array<float,2>{0.194062516f, 0.231411844f},
-std::array<float,2>{0.905091941f, 0.63824904f},
-std::array<float,2>{0.590022862f, 0.152384326f},
-std::array<float,2>{0.443048328f, 0.744283319f},
-std::array<float,2>{0.0102459872f, 0.318003088f},
-std::array<float,2>{0.759385526f, 0.772780836f},
-std::array<float,2>{0.963184059f, 0.460010946f},
-std::array<float,2>{0.162341014f, 0.9378497f},
-std::array<float,2>{0.342105061f, 0.12009161f},
-std::array<float,2>{0.673443258f, 0.551340997f},
-std::array<float,2>{0.917612016f, 0.194404379f},
-std::array<float,2>{0.249926686f, 0.658477664f},
-std::array<float,2>{0.26077497f, 0.299613684f},
-std::array<float,2>{0.694887459f, 0.815011024f},
-std::array<float,2>{0.52799958f, 0.427155912f},
-std::array<float,2>{0.39201206f, 0.908497512f},
-std::array<float,2>{0.067122519f, 0.0235390272f},
-std::array<float,2>{0.851264238f, 0.594442427f},
-std::array<float,2>{0.656086147f, 0.0915392339f},
-std::array<float,2>{0.362712741f, 0.519256592f},
-std::array<float,2>{0.149243027f, 0.499965966f},
-std::array<float,2>{0.977803171f, 0.975096881f},
-std::array<float,2>{0.789027989f, 0.354581535f},
-std::array<float,2>{0.0460765734f, 0.812426686f},
-std::array<float,2>{0.492770046f, 0.178250507f},
-std::array<float,2>{0.6107651f, 0.704341948f},
-std::array<float,2>{0.998503089f, 0.0981690735f},
-std::array<float,2>{0.129012004f, 0.541436791f},
-std::array<float,2>{0.355488986f, 0.450187892f},
-std::array<float,2>{0.632407069f, 0.966759682f},
-std::array<float,2>{0.604713798f, 0.336449742f},
-std::array<float,2>{0.471780926f, 0.751612663f},
-std::array<float,2>{0.0582120046f, 0.132064879f},
-std::array<float,2>{0.807276964f, 0.721063256f},
-std::array<float,2>{0.712264359f, 0.237085745f},
-std::array<float,2>{0.268840969f, 0.648055971f},
-std::array<float,2>{0.229470521f, 0.262184143f},
-std::array<float,2>{0.932933748f, 0.856006742f},
-std::array<float,2>{0.86198175f, 0.382891357f},
-std::array<float,2>{0.0809632763f, 0.904141963f},
-std::array<float,2>{0.387118846f, 0.0545267388f},
-std::array<float,2>{0.500284195f, 0.583485723f},
-std::array<float,2>{0.770377696f, 0.170277119f},
-std::array<float,2>{0.020427959f, 0.698239446f},
-std::array<float,2>{0.467762202f, 0.363821685f},
-std::array<float,2>{0.573050976f, 0.782844305f},
-std::array<float,2>{0.666347206f, 0.480407834f},
-std::array<float,2>{0.322129339f, 0.985580742f},
-std::array<float,2>{0.178960204f, 0.0677327961f},
-std::array<float,2>{0.941117942f, 0.514034927f},
-std::array<float,2>{0.553312063f, 0.0126592349f},
-std::array<float,2>{0.418365002f, 0.614669204f},
-std::array<float,2>{0.116241425f, 0.415923893f},
-std::array<float,2>{0.843427122f, 0.927310288f},
-std::array<float,2>{0.886731982f, 0.293157041f},
-std::array<float,2>{0.208012834f, 0.83935529f},
-std::array<float,2>{0.292208433f, 0.206433877f},
-std::array<float,2>{0.734350502f, 0.680039704f},
-std::array<float,2>{0.801502407f, 0.0765713677f},
-std::array<float,2>{0.0489302799f, 0.501776457f},
-std::array<float,2>{0.47703442f, 0.474610746f},
-std::array<float,2>{0.595484316f, 0.998439133f},
-std::array<float,2>{0.633593738f, 0.37200582f},
-std::array<float,2>{0.348302573f, 0.789424598f},
-std::array<float,2>{0.140099347f, 0.163282782f},
-std::array<float,2>{0.986654997f, 0.693205655f},
-std::array<float,2>{0.511553168f, 0.217096731f},
-std::array<float,2>{0.378721714f, 0.676994443f},
-std::array<float,2>{0.0922093317f, 0.282862127f},
-std::array<float,2>{0.873822212f, 0.835366488f},
-std::array<float,2>{0.922614455f, 0.412189335f},
-std::array<float,2>{0.218922764f, 0.929940045f},
-std::array<float,2>{0.276263863f, 0.00260578096f},
-std::array<float,2>{0.710796952f, 0.618939161f},
-std::array<float,2>{0.952998281f, 0.13660273f},
-std::array<float,2>{0.183854863f, 0.729830384f},
-std::array<float,2>{0.315436482f, 0.329555303f},
-std::array<float,2>{0.658925593f, 0.759456038f},
-std::array<float,2>{0.568732262f, 0.437934041f},
-std::array<float,2>{0.453964561f, 0.956182241f},
-std::array<float,2>{0.0254535656f, 0.102772385f},
-std::array<float,2>{0.774521291f, 0.536808968f},
-std::array<float,2>{0.724289298f, 0.0624461621f},
-std::array<float,2>{0.288736403f, 0.588346183f},
-std::array<float,2>{0.215092778f, 0.378062516f},
-std::array<float,2>{0.877364695f, 0.89651227f},
-std::array<float,2>{0.831233442f, 0.255948007f},
-std::array<float,2>{0.119580977f, 0.849907458f},
-std::array<float,2>{0.410193712f, 0.248627082f},
-std::array<float,2>{0.558453381f, 0.649656892f},
-std::array<float,2>{0.893572867f, 0.0186263695f},
-std::array<float,2>{0.196209356f, 0.60282886f},
-std::array<float,2>{0.306112081f, 0.429905534f},
-std::array<float,2>{0.736284912f, 0.918586016f},
-std::array<float,2>{0.531799614f, 0.311591566f},
-std::array<float,2>{0.431182951f, 0.823548555f},
-std::array<float,2>{0.10729184f, 0.201806501f},
-std::array<float,2>{0.823751628f, 0.670451581f},
-std::array<float,2>{0.6808846f, 0.18358013f},
-std::array<float,2>{0.32856527f, 0.714619517f},
-std::array<float,2>{0.167244539f, 0.343897194f},
-std::array<float,2>{0.959261596f, 0.800524473f},
-std::array<float,2>{0.752075732f, 0.484737694f},
-std::array<float,2>{0.000179469396f, 0.980370104f},
-std::array<float,2>{0.451566041f, 0.085663721f},
-std::array<float,2>{0.583791494f, 0.523564756f},
-std::array<float,2>{0.854697704f, 0.221417472f},
-std::array<float,2>{0.0755672604f, 0.630412459f},
-std::array<float,2>{0.40425089f, 0.271857291f},
-std::array<float,2>{0.517077744f, 0.864129841f},
-std::array<float,2>{0.697770655f, 0.395837247f},
-std::array<float,2>{0.250767738f, 0.887612522f},
-std::array<float,2>{0.234760702f, 0.0467216261f},
-std::array<float,2>{0.906507254f, 0.571182609f},
-std::array<float,2>{0.624934614f, 0.115573093f},
-std::array<float,2>{0.487225652f, 0.561185002f},
-std::array<float,2>{0.0337198675f, 0.461125582f},
-std::array<float,2>{0.790088952f, 0.948092282f},
-std::array<float,2>{0.975699604f, 0.32318297f},
-std::array<float,2>{0.14169918f, 0.775430083f},
-std::array<float,2>{0.369630814f, 0.142313287f},
-std::array<float,2>{0.647879601f, 0.740133464f},
-std::array<float,2>{0.766832709f, 0.0406838655f},
-std::array<float,2>{0.0185717791f, 0.574987411f},
-std::array<float,2>{0.464664668f, 0.394421846f},
-std::array<float,2>{0.576598585f, 0.883319616f},
-std::array<float,2>{0.668237448f, 0.268473178f},
-std::array<float,2>{0.325521708f, 0.860782862f},
-std::array<float,2>{0.175111651f, 0.224012271f},
-std::array<float,2>{0.943153083f, 0.625421286f},
-std::array<float,2>{0.547750354f, 0.146002844f},
-std::array<float,2>{0.414740562f, 0.736266494f},
-std::array<float,2>{0.11325483f, 0.325202614f},
-std::array<float,2>{0.837845623f, 0.778950453f},
-std::array<float,2>{0.884479344f, 0.466884971f},
-std::array<float,2>{0.206228718f, 0.952439606f},
-std::array<float,2>{0.294903427f, 0.113193698f},
-std::array<float,2>{0.729659796f, 0.555853248f},
-std::array<float,2>{0.995351195f, 0.195989177f},
-std::array<float,2>{0.128268272f, 0.665956497f},
-std::array<float,2>{0.354927838f, 0.308584005f},
-std::array<float,2>{0.626006007f, 0.827713251f},
-std::array<float,2>{0.607046783f, 0.435104042f},
-std::array<float,2>{0.473322481f, 0.914231956f},
-std::array<float,2>{0.0621862374f, 0.0209083483f},
-std::array<float,2>{0.810848951f, 0.606672525f},
-std::array<float,2>{0.717172623f, 0.0788277835f},
-std::array<float,2>{0.270439714f, 0.53063339f},
-std::array<float,2>{0.231755912f, 0.489302039f},
-std::array<float,2>{0.934096754f, 0.981698632f},
-std::array<float,2>{0.864366412f, 0.348861903f},
-std::array<float,2>{0.0820380673f, 0.804109812f},
-std::array<float,2>{0.386077464f, 0.185786203f},
-std::array<float,2>{0.506180346f, 0.715305209f},
-std::array<float,2>{0.918698668f, 0.107053868f},
-std::array<float,2>{0.243577868f, 0.53483218f},
-std::array<float,2>{0.262708575f, 0.442590266f},
-std::array<float,2>{0.690892935f, 0.959076583f},
-std::array<float,2>{0.526922762f, 0.335279465f},
-std::array<float,2>{0.396852165f, 0.762040794f},
-std::array<float,2>{0.0630578473f, 0.137712821f},
-std::array<float,2>{0.847244918f, 0.732865691f},
-std::array<float,2>{0.648503244f, 0.244435102f},
-std::array<float,2>{0.364169866f, 0.656231999f},
-std::array<float,2>{0.153274298f, 0.250113845f},
-std::array<float,2>{0.982966721f, 0.846325636f},
-std::array<float,2>{0.782180905f, 0.38147074f},
-std::array<float,2>{0.0414261371f, 0.89429003f},
-std::array<float,2>{0.49727574f, 0.0580895171f},
-std::array<float,2>{0.613920271f, 0.591627479f},
-std::array<float,2>{0.816697419f, 0.158696383f},
-std::array<float,2>{0.0993974134f, 0.690384805f},
-std::array<float,2>{0.423985392f, 0.370514691f},
-std::array<float,2>{0.54679805f, 0.794955194f},
-std::array<float,2>{0.746268332f, 0.469868034f},
-std::array<float,2>{0.302956939f, 0.994437814f},
-std::array<float,2>{0.19055216f, 0.0716922656f},
-std::array<float,2>{0.901362777f, 0.50575912f},
-std::array<float,2>{0.58756417f, 0.00523663964f},
-std::array<float,2>{0.439213276f, 0.623632848f},
-std::array<float,2>{0.0125894407f, 0.408056021f},
-std::array<float,2>{0.762699723f, 0.937014282f},
-std::array<float,2>{0.966607094f, 0.289027721f},
-std::array<float,2>{0.158036917f, 0.82908535f},
-std::array<float,2>{0.336492866f, 0.211141095f},
-std::array<float,2>{0.677384615f, 0.675123036f},
-std::array<float,2>{0.856951058f, 0.0641354546f},
-std::array<float,2>{0.0705202371f, 0.509192646f},
-std::array<float,2>{0.398957819f, 0.483510375f},
-std::array<float,2>{0.521101356f, 0.988935947f},
-std::array<float,2>{0.702858984f, 0.362805516f},
-std::array<float,2>{0.25455454f, 0.78742373f},
-std::array<float,2>{0.241313472f, 0.166013852f},
-std::array<float,2>{0.912635148f, 0.702018857f},
-std::array<float,2>{0.617918551f, 0.208837017f},
-std::array<float,2>{0.489646524f, 0.686620295f},
-std::array<float,2>{0.0381289385f, 0.289719582f},
-std::array<float,2>{0.796071291f, 0.840613186f},
-std::array<float,2>{0.970103502f, 0.41886726f},
-std::array<float,2>{0.145135283f, 0.923772275f},
-std::array<float,2>{0.373307914f, 0.00935529079f},
-std::array<float,2>{0.642794609f, 0.611411333f},
-std::array<float,2>{0.896481931f, 0.127447337f},
-std::array<float,2>{0.200979948f, 0.724260211f},
-std::array<float,2>{0.308974653f, 0.339932054f},
-std::array<float,2>{0.739727676f, 0.754523218f},
-std::array<float,2>{0.535245478f, 0.446105897f},
-std::array<float,2>{0.43600139f, 0.964611113f},
-std::array<float,2>{0.10360565f, 0.0951209068f},
-std::array<float,2>{0.825537026f, 0.545359612f},
-std::array<float,2>{0.685794115f, 0.0496717207f},
-std::array<float,2>{0.333723068f, 0.578726113f},
-std::array<float,2>{0.171740621f, 0.38679722f},
-std::array<float,2>{0.954637349f, 0.898469746f},
-std::array<float,2>{0.754130423f, 0.258425504f},
-std::array<float,2>{0.00527097005f, 0.8545959f},
-std::array<float,2>{0.446565926f, 0.240497023f},
-std::array<float,2>{0.579784811f, 0.643406987f},
-std::array<float,2>{0.946587801f, 0.0305054039f},
-std::array<float,2>{0.182007611f, 0.599594235f},
-std::array<float,2>{0.318743348f, 0.423259467f},
-std::array<float,2>{0.663132906f, 0.912077367f},
-std::array<float,2>{0.563168764f, 0.301676422f},
-std::array<float,2>{0.457935125f, 0.819328666f},
-std::array<float,2>{0.0309019443f, 0.188348025f},
-std::array<float,2>{0.777957857f, 0.662357986f},
-std::array<float,2>{0.722163558f, 0.173601851f},
-std::array<float,2>{0.281408399f, 0.707444429f},
-std::array<float,2>{0.212501854f, 0.356920928f},
-std::array<float,2>{0.882254064f, 0.808300078f},
-std::array<float,2>{0.834276319f, 0.494124055f},
-std::array<float,2>{0.124407493f, 0.969486475f},
-std::array<float,2>{0.407057613f, 0.0873933733f},
-std::array<float,2>{0.560426593f, 0.520510137f},
-std::array<float,2>{0.798720658f, 0.226767793f},
-std::array<float,2>{0.052995488f, 0.635948718f},
-std::array<float,2>{0.480514288f, 0.277979583f},
-std::array<float,2>{0.601129055f, 0.868807912f},
-std::array<float,2>{0.638554752f, 0.404288411f},
-std::array<float,2>{0.345511436f, 0.875720501f},
-std::array<float,2>{0.135186821f, 0.0322553292f},
-std::array<float,2>{0.991859734f, 0.569134653f},
-std::array<float,2>{0.514946342f, 0.123753257f},
-std::array<float,2>{0.379732192f, 0.549019933f},
-std::array<float,2>{0.0893238261f, 0.455203921f},
-std::array<float,2>{0.870627701f, 0.944795012f},
-std::array<float,2>{0.926955342f, 0.314891338f},
-std::array<float,2>{0.226380169f, 0.767593682f},
-std::array<float,2>{0.278635442f, 0.149137169f},
-std::array<float,2>{0.703547418f, 0.748447359f},
-std::array<float,2>{0.842499435f, 0.015622667f},
-std::array<float,2>{0.115674235f, 0.616445184f},
-std::array<float,2>{0.419664413f, 0.417821735f},
-std::array<float,2>{0.55393362f, 0.929481447f},
-std::array<float,2>{0.733069301f, 0.295531541f},
-std::array<float,2>{0.291201621f, 0.836032629f},
-std::array<float,2>{0.2073109f, 0.204824343f},
-std::array<float,2>{0.888041019f, 0.682650805f},
-std::array<float,2>{0.573575258f, 0.168005615f},
-std::array<float,2>{0.468018264f, 0.696473122f},
-std::array<float,2>{0.0210734885f, 0.366802096f},
-std::array<float,2>{0.771410882f, 0.784835696f},
-std::array<float,2>{0.940334916f, 0.477580845f},
-std::array<float,2>{0.177873597f, 0.987332404f},
-std::array<float,2>{0.320360243f, 0.0693619773f},
-std::array<float,2>{0.667910397f, 0.512824178f},
-std::array<float,2>{0.932516515f, 0.235547706f},
-std::array<float,2>{0.230460793f, 0.644908965f},
-std::array<float,2>{0.268290758f, 0.26543656f},
-std::array<float,2>{0.711717904f, 0.85816133f},
-std::array<float,2>{0.50175041f, 0.386177182f},
-std::array<float,2>{0.388396621f, 0.905666828f},
-std::array<float,2>{0.0814555287f, 0.0517489612f},
-std::array<float,2>{0.863247395f, 0.58470273f},
-std::array<float,2>{0.631513536f, 0.100181215f},
-std::array<float,2>{0.356463015f, 0.539395809f},
-std::array<float,2>{0.130069569f, 0.452740371f},
-std::array<float,2>{0.99939388f, 0.968737185f},
-std::array<float,2>{0.807764769f, 0.338962078f},
-std::array<float,2>{0.0566787422f, 0.752893507f},
-std::array<float,2>{0.471078813f, 0.130522281f},
-std::array<float,2>{0.6037907f, 0.72027719f},
-std::array<float,2>{0.976792634f, 0.0921319053f},
-std::array<float,2>{0.149958551f, 0.515734255f},
-std::array<float,2>{0.362071157f, 0.496787965f},
-std::array<float,2>{0.654609621f, 0.974101484f},
-std::array<float,2>{0.60940975f, 0.353334904f},
-std::array<float,2>{0.493934244f, 0.810504675f},
-std::array<float,2>{0.0449363291f, 0.176833749f},
-std::array<float,2>{0.787329257f, 0.705490351f},
-std::array<float,2>{0.693598926f, 0.19285053f},
-std::array<float,2>{0.260703325f, 0.658149719f},
-std::array<float,2>{0.248300105f, 0.29721728f},
-std::array<float,2>{0.916785181f, 0.812646866f},
-std::array<float,2>{0.850280404f, 0.428220361f},
-std::array<float,2>{0.0677849576f, 0.906931281f},
-std::array<float,2>{0.391338974f, 0.0268548857f},
-std::array<float,2>{0.528948009f, 0.596092224f},
-std::array<float,2>{0.758355618f, 0.154635355f},
-std::array<float,2>{0.0107752103f, 0.742953181f},
-std::array<float,2>{0.441904128f, 0.318513721f},
-std::array<float,2>{0.591285646f, 0.770784318f},
-std::array<float,2>{0.672733009f, 0.458860606f},
-std::array<float,2>{0.343628138f, 0.940140188f},
-std::array<float,2>{0.16402626f, 0.1185899f},
-std::array<float,2>{0.964615941f, 0.554564238f},
-std::array<float,2>{0.541538417f, 0.036588762f},
-std::array<float,2>{0.428233296f, 0.566230416f},
-std::array<float,2>{0.0948264152f, 0.401676595f},
-std::array<float,2>{0.81488353f, 0.882693708f},
-std::array<float,2>{0.905349851f, 0.275477201f},
-std::array<float,2>{0.194941968f, 0.872864842f},
-std::array<float,2>{0.30068323f, 0.233162254f},
-std::array<float,2>{0.743136525f, 0.639553249f},
-std::array<float,2>{0.789301634f, 0.114226811f},
-std::array<float,2>{0.034786202f, 0.560266674f},
-std::array<float,2>{0.487388134f, 0.463820249f},
-std::array<float,2>{0.623324215f, 0.94606775f},
-std::array<float,2>{0.647458017f, 0.320883572f},
-std::array<float,2>{0.370908111f, 0.774409473f},
-std::array<float,2>{0.141559675f, 0.1430756f},
-std::array<float,2>{0.974847078f, 0.741587162f},
-std::array<float,2>{0.516273558f, 0.219181627f},
-std::array<float,2>{0.403093547f, 0.630961895f},
-std::array<float,2>{0.0747209638f, 0.271474183f},
-std::array<float,2>{0.853771687f, 0.866760194f},
-std::array<float,2>{0.907965183f, 0.39681676f},
-std::array<float,2>{0.235767141f, 0.889020622f},
-std::array<float,2>{0.251161546f, 0.0434001461f},
-std::array<float,2>{0.698906839f, 0.574188828f},
-std::array<float,2>{0.960342705f, 0.181357667f},
-std::array<float,2>{0.166618899f, 0.712835312f},
-std::array<float,2>{0.329655826f, 0.346555829f},
-std::array<float,2>{0.680475891f, 0.798669517f},
-std::array<float,2>{0.582339168f, 0.487230331f},
-std::array<float,2>{0.452431977f, 0.977020025f},
-std::array<float,2>{0.00112479704f, 0.0830134377f},
-std::array<float,2>{0.753467977f, 0.526081443f},
-std::array<float,2>{0.734753668f, 0.0160359889f},
-std::array<float,2>{0.30537796f, 0.604607821f},
-std::array<float,2>{0.196585745f, 0.433279574f},
-std::array<float,2>{0.89296478f, 0.920581281f},
-std::array<float,2>{0.822445989f, 0.310052425f},
-std::array<float,2>{0.10577631f, 0.82086885f},
-std::array<float,2>{0.430382341f, 0.201093122f},
-std::array<float,2>{0.532761335f, 0.66882509f},
-std::array<float,2>{0.878561139f, 0.0596410558f},
-std::array<float,2>{0.215860352f, 0.586957872f},
-std::array<float,2>{0.287513375f, 0.376947701f},
-std::array<float,2>{0.7234025f, 0.895625651f},
-std::array<float,2>{0.556700289f, 0.254880518f},
-std::array<float,2>{0.411731988f, 0.849288702f},
-std::array<float,2>{0.120482773f, 0.247788325f},
-std::array<float,2>{0.830389321f, 0.650438368f},
-std::array<float,2>{0.659623325f, 0.134145364f},
-std::array<float,2>{0.315338761f, 0.72802794f},
-std::array<float,2>{0.184921101f, 0.330997646f},
-std::array<float,2>{0.951788843f, 0.760509014f},
-std::array<float,2>{0.773970544f, 0.440308601f},
-std::array<float,2>{0.0270444397f, 0.954765022f},
-std::array<float,2>{0.454442173f, 0.104067475f},
-std::array<float,2>{0.569873154f, 0.53762126f},
-std::array<float,2>{0.874652445f, 0.215132788f},
-std::array<float,2>{0.0932921395f, 0.678851962f},
-std::array<float,2>{0.377929658f, 0.28475675f},
-std::array<float,2>{0.509840846f, 0.833212912f},
-std::array<float,2>{0.709450006f, 0.411821872f},
-std::array<float,2>{0.27704075f, 0.932327271f},
-std::array<float,2>{0.219972998f, 0.000744498975f},
-std::array<float,2>{0.922969103f, 0.619244576f},
-std::array<float,2>{0.594147563f, 0.0746535584f},
-std::array<float,2>{0.478253245f, 0.502602518f},
-std::array<float,2>{0.049943801f, 0.473733187f},
-std::array<float,2>{0.802143097f, 0.996715546f},
-std::array<float,2>{0.988045871f, 0.374672949f},
-std::array<float,2>{0.138828367f, 0.791862667f},
-std::array<float,2>{0.349600285f, 0.161481991f},
-std::array<float,2>{0.6345191f, 0.694542289f},
-std::array<float,2>{0.809295177f, 0.023157537f},
-std::array<float,2>{0.0600099824f, 0.608802855f},
-std::array<float,2>{0.475416213f, 0.436837703f},
-std::array<float,2>{0.607845545f, 0.916956186f},
-std::array<float,2>{0.627982318f, 0.305722922f},
-std::array<float,2>{0.35298419f, 0.824367404f},
-std::array<float,2>{0.12688373f, 0.198555604f},
-std::array<float,2>{0.994113147f, 0.666130066f},
-std::array<float,2>{0.505685449f, 0.184501663f},
-std::array<float,2>{0.383365035f, 0.718482852f},
-std::array<float,2>{0.08426442f, 0.351121306f},
-std::array<float,2>{0.86541903f, 0.802645981f},
-std::array<float,2>{0.936870694f, 0.491436809f},
-std::array<float,2>{0.233222112f, 0.982685149f},
-std::array<float,2>{0.272399366f, 0.0811560079f},
-std::array<float,2>{0.716432869f, 0.529211402f},
-std::array<float,2>{0.943496585f, 0.226219803f},
-std::array<float,2>{0.17379868f, 0.628488243f},
-std::array<float,2>{0.327818483f, 0.267083973f},
-std::array<float,2>{0.671848416f, 0.862795949f},
-std::array<float,2>{0.574376822f, 0.391911477f},
-std::array<float,2>{0.461373031f, 0.885480106f},
-std::array<float,2>{0.0174571965f, 0.0420206338f},
-std::array<float,2>{0.768786192f, 0.577115595f},
-std::array<float,2>{0.728115201f, 0.110569574f},
-std::array<float,2>{0.295036763f, 0.5578143f},
-std::array<float,2>{0.203402176f, 0.465412438f},
-std::array<float,2>{0.885913014f, 0.950716496f},
-std::array<float,2>{0.838248909f, 0.326410502f},
-std::array<float,2>{0.110261403f, 0.78043896f},
-std::array<float,2>{0.41616869f, 0.147307128f},
-std::array<float,2>{0.550056875f, 0.736795008f},
-std::array<float,2>{0.89846164f, 0.0728379562f},
-std::array<float,2>{0.188317865f, 0.50623405f},
-std::array<float,2>{0.301194549f, 0.471201986f},
-std::array<float,2>{0.749100208f, 0.992615581f},
-std::array<float,2>{0.543603301f, 0.367293209f},
-std::array<float,2>{0.422278136f, 0.794182301f},
-std::array<float,2>{0.101517096f, 0.156487614f},
-std::array<float,2>{0.820080817f, 0.688889265f},
-std::array<float,2>{0.677986801f, 0.214253858f},
-std::array<float,2>{0.339276671f, 0.672531307f},
-std::array<float,2>{0.159509093f, 0.286442012f},
-std::array<float,2>{0.96736753f, 0.83092618f},
-std::array<float,2>{0.763673425f, 0.409406513f},
-std::array<float,2>{0.0137145706f, 0.933981776f},
-std::array<float,2>{0.441215008f, 0.00737843895f},
-std::array<float,2>{0.588128626f, 0.621420026f},
-std::array<float,2>{0.845263124f, 0.139865935f},
-std::array<float,2>{0.0658237413f, 0.731473267f},
-std::array<float,2>{0.394534826f, 0.333623707f},
-std::array<float,2>{0.525043428f, 0.764614105f},
-std::array<float,2>{0.689425826f, 0.443674415f},
-std::array<float,2>{0.264581919f, 0.957738817f},
-std::array<float,2>{0.245029256f, 0.108395725f},
-std::array<float,2>{0.921384156f, 0.532193005f},
-std::array<float,2>{0.615543664f, 0.054969836f},
-std::array<float,2>{0.498871505f, 0.592592478f},
-std::array<float,2>{0.0394871086f, 0.380731344f},
-std::array<float,2>{0.784162343f, 0.89217025f},
-std::array<float,2>{0.981374025f, 0.253575414f},
-std::array<float,2>{0.154357001f, 0.844742417f},
-std::array<float,2>{0.365235925f, 0.243232235f},
-std::array<float,2>{0.651743054f, 0.653333127f},
-std::array<float,2>{0.826669514f, 0.0962119699f},
-std::array<float,2>{0.103457183f, 0.544370174f},
-std::array<float,2>{0.433677793f, 0.449149728f},
-std::array<float,2>{0.537808776f, 0.962726235f},
-std::array<float,2>{0.741939485f, 0.34321627f},
-std::array<float,2>{0.311641425f, 0.757273674f},
-std::array<float,2>{0.202227205f, 0.125681058f},
-std::array<float,2>{0.897408783f, 0.724642515f},
-std::array<float,2>{0.580124795f, 0.240080714f},
-std::array<float,2>{0.44799903f, 0.64228934f},
-std::array<float,2>{0.00759954564f, 0.26164794f},
-std::array<float,2>{0.757047296f, 0.852237761f},
-std::array<float,2>{0.955592692f, 0.390489876f},
-std::array<float,2>{0.16974777f, 0.900655627f},
-std::array<float,2>{0.335878223f, 0.0473112017f},
-std::array<float,2>{0.684118569f, 0.581697047f},
-std::array<float,2>{0.910534203f, 0.166580305f},
-std::array<float,2>{0.239290342f, 0.699419379f},
-std::array<float,2>{0.255884051f, 0.359775692f},
-std::array<float,2>{0.700411141f, 0.785244942f},
-std::array<float,2>{0.521540284f, 0.482100099f},
-std::array<float,2>{0.400415242f, 0.991095603f},
-std::array<float,2>{0.0723686591f, 0.0662757233f},
-std::array<float,2>{0.858086467f, 0.511290967f},
-std::array<float,2>{0.640879989f, 0.0116293887f},
-std::array<float,2>{0.371972114f, 0.609868646f},
-std::array<float,2>{0.146699712f, 0.420171142f},
-std::array<float,2>{0.971402645f, 0.925549388f},
-std::array<float,2>{0.793977678f, 0.29245773f},
-std::array<float,2>{0.0366389863f, 0.843449831f},
-std::array<float,2>{0.491366804f, 0.210068002f},
-std::array<float,2>{0.619403124f, 0.684581995f},
-std::array<float,2>{0.988733709f, 0.0341677628f},
-std::array<float,2>{0.134131297f, 0.567592621f},
-std::array<float,2>{0.347646564f, 0.405057788f},
-std::array<float,2>{0.638953328f, 0.87828666f},
-std::array<float,2>{0.599204183f, 0.281190127f},
-std::array<float,2>{0.48391068f, 0.869936228f},
-std::array<float,2>{0.0526784807f, 0.228851542f},
-std::array<float,2>{0.798918128f, 0.63302213f},
-std::array<float,2>{0.705212474f, 0.152336404f},
-std::array<float,2>{0.280427039f, 0.747597218f},
-std::array<float,2>{0.222917289f, 0.313067585f},
-std::array<float,2>{0.928340077f, 0.767483473f},
-std::array<float,2>{0.869040847f, 0.453607321f},
-std::array<float,2>{0.0864086822f, 0.943009079f},
-std::array<float,2>{0.38234061f, 0.123034693f},
-std::array<float,2>{0.51328814f, 0.548189044f},
-std::array<float,2>{0.77936095f, 0.191311643f},
-std::array<float,2>{0.0287576094f, 0.6620996f},
-std::array<float,2>{0.46059224f, 0.304146022f},
-std::array<float,2>{0.565031946f, 0.817187607f},
-std::array<float,2>{0.661305308f, 0.42479074f},
-std::array<float,2>{0.317667037f, 0.913439631f},
-std::array<float,2>{0.180976167f, 0.0276484769f},
-std::array<float,2>{0.947523832f, 0.600008965f},
-std::array<float,2>{0.56075269f, 0.0886401832f},
-std::array<float,2>{0.409311324f, 0.521950066f},
-std::array<float,2>{0.121814862f, 0.494842261f},
-std::array<float,2>{0.832987428f, 0.972456932f},
-std::array<float,2>{0.879296601f, 0.358870536f},
-std::array<float,2>{0.214773044f, 0.805672288f},
-std::array<float,2>{0.283213139f, 0.175565034f},
-std::array<float,2>{0.720698953f, 0.710810483f},
-std::array<float,2>{0.860380471f, 0.0534228273f},
-std::array<float,2>{0.0792732164f, 0.582684457f},
-std::array<float,2>{0.389493823f, 0.384416848f},
-std::array<float,2>{0.503545284f, 0.903231859f},
-std::array<float,2>{0.714422584f, 0.263172716f},
-std::array<float,2>{0.267221034f, 0.856954098f},
-std::array<float,2>{0.228059188f, 0.237921581f},
-std::array<float,2>{0.930602491f, 0.647100508f},
-std::array<float,2>{0.602010369f, 0.130922958f},
-std::array<float,2>{0.469823509f, 0.721811712f},
-std::array<float,2>{0.0565705374f, 0.337660998f},
-std::array<float,2>{0.806155503f, 0.750690401f},
-std::array<float,2>{0.996978462f, 0.451140791f},
-std::array<float,2>{0.13213788f, 0.965501308f},
-std::array<float,2>{0.358420998f, 0.0993470401f},
-std::array<float,2>{0.629588008f, 0.542759895f},
-std::array<float,2>{0.88871187f, 0.205972791f},
-std::array<float,2>{0.210092828f, 0.681218505f},
-std::array<float,2>{0.290160656f, 0.294574827f},
-std::array<float,2>{0.731064439f, 0.838026583f},
-std::array<float,2>{0.552201867f, 0.414595664f},
-std::array<float,2>{0.419977695f, 0.926714063f},
-std::array<float,2>{0.11423476f, 0.0136626754f},
-std::array<float,2>{0.840995073f, 0.614211261f},
-std::array<float,2>{0.664435983f, 0.0673004165f},
-std::array<float,2>{0.323088378f, 0.515176833f},
-std::array<float,2>{0.176303998f, 0.478588581f},
-std::array<float,2>{0.939433753f, 0.984828651f},
-std::array<float,2>{0.772453964f, 0.365029663f},
-std::array<float,2>{0.0218254775f, 0.781970143f},
-std::array<float,2>{0.466567069f, 0.171454042f},
-std::array<float,2>{0.570786178f, 0.698853254f},
-std::array<float,2>{0.962175906f, 0.121021397f},
-std::array<float,2>{0.161785111f, 0.552208006f},
-std::array<float,2>{0.340233147f, 0.459222019f},
-std::array<float,2>{0.674934506f, 0.938621163f},
-std::array<float,2>{0.592822313f, 0.316684276f},
-std::array<float,2>{0.443379343f, 0.77216512f},
-std::array<float,2>{0.00956824515f, 0.154126212f},
-std::array<float,2>{0.76047188f, 0.745216012f},
-std::array<float,2>{0.745327532f, 0.231904641f},
-std::array<float,2>{0.297326982f, 0.636825085f},
-std::array<float,2>{0.192448542f, 0.274809778f},
-std::array<float,2>{0.904116869f, 0.873229027f},
-std::array<float,2>{0.814428091f, 0.398531854f},
-std::array<float,2>{0.096556142f, 0.880589962f},
-std::array<float,2>{0.426389039f, 0.038609948f},
-std::array<float,2>{0.540421903f, 0.56410712f},
-std::array<float,2>{0.785550594f, 0.179432184f},
-std::array<float,2>{0.0434887931f, 0.703562915f},
-std::array<float,2>{0.495958894f, 0.354327202f},
-std::array<float,2>{0.613275409f, 0.810899377f},
-std::array<float,2>{0.653273225f, 0.498483866f},
-std::array<float,2>{0.359873563f, 0.976008892f},
-std::array<float,2>{0.150630146f, 0.0899380296f},
-std::array<float,2>{0.979699194f, 0.518229604f},
-std::array<float,2>{0.531200171f, 0.0250851382f},
-std::array<float,2>{0.393323153f, 0.595277667f},
-std::array<float,2>{0.0685846582f, 0.425968975f},
-std::array<float,2>{0.84854883f, 0.909650505f},
-std::array<float,2>{0.9146685f, 0.299809247f},
-std::array<float,2>{0.247030377f, 0.816353381f},
-std::array<float,2>{0.257826984f, 0.194076538f},
-std::array<float,2>{0.691855669f, 0.659608483f},
-std::array<float,2>{0.75118351f, 0.0845628828f},
-std::array<float,2>{0.00249218289f, 0.524653018f},
-std::array<float,2>{0.44965589f, 0.48554647f},
-std::array<float,2>{0.585905194f, 0.97910589f},
-std::array<float,2>{0.683546484f, 0.345287293f},
-std::array<float,2>{0.330599576f, 0.799439549f},
-std::array<float,2>{0.165359586f, 0.182336777f},
-std::array<float,2>{0.958980501f, 0.713740885f},
-std::array<float,2>{0.534950793f, 0.202462375f},
-std::array<float,2>{0.431704283f, 0.671702325f},
-std::array<float,2>{0.10795629f, 0.310615838f},
-std::array<float,2>{0.820713878f, 0.822957456f},
-std::array<float,2>{0.892060101f, 0.430740625f},
-std::array<float,2>{0.197422162f, 0.919832051f},
-std::array<float,2>{0.30730471f, 0.0184473805f},
-std::array<float,2>{0.73680079f, 0.60225004f},
-std::array<float,2>{0.973813355f, 0.141422629f},
-std::array<float,2>{0.143050984f, 0.738782167f},
-std::array<float,2>{0.368085802f, 0.324095905f},
-std::array<float,2>{0.644613922f, 0.77719444f},
-std::array<float,2>{0.62163043f, 0.462637514f},
-std::array<float,2>{0.48560065f, 0.948470056f},
-std::array<float,2>{0.0316113681f, 0.116701029f},
-std::array<float,2>{0.792911708f, 0.562083781f},
-std::array<float,2>{0.696716905f, 0.0455273874f},
-std::array<float,2>{0.252151847f, 0.571990311f},
-std::array<float,2>{0.236970127f, 0.394807816f},
-std::array<float,2>{0.909676373f, 0.888029337f},
-std::array<float,2>{0.852444887f, 0.272706985f},
-std::array<float,2>{0.0774429739f, 0.864594877f},
-std::array<float,2>{0.404997975f, 0.222045809f},
-std::array<float,2>{0.518548012f, 0.629410386f},
-std::array<float,2>{0.924917459f, 0.00375896925f},
-std::array<float,2>{0.222196221f, 0.617250323f},
-std::array<float,2>{0.274363846f, 0.413107425f},
-std::array<float,2>{0.708655059f, 0.93083781f},
-std::array<float,2>{0.509649456f, 0.281823307f},
-std::array<float,2>{0.375272214f, 0.834959149f},
-std::array<float,2>{0.0904882476f, 0.218479246f},
-std::array<float,2>{0.872735441f, 0.676397681f},
-std::array<float,2>{0.636654198f, 0.162958264f},
-std::array<float,2>{0.351105571f, 0.69189167f},
-std::array<float,2>{0.13763161f, 0.372772813f},
-std::array<float,2>{0.985885143f, 0.790484607f},
-std::array<float,2>{0.804128051f, 0.476163656f},
-std::array<float,2>{0.0470224433f, 0.999868035f},
-std::array<float,2>{0.479363918f, 0.0776109919f},
-std::array<float,2>{0.59711349f, 0.500805795f},
-std::array<float,2>{0.829481661f, 0.249433205f},
-std::array<float,2>{0.118020274f, 0.649119914f},
-std::array<float,2>{0.413633794f, 0.257244289f},
-std::array<float,2>{0.555526912f, 0.850646675f},
-std::array<float,2>{0.72536552f, 0.377067715f},
-std::array<float,2>{0.285783559f, 0.898063958f},
-std::array<float,2>{0.217646241f, 0.0608251914f},
-std::array<float,2>{0.875298142f, 0.589026809f},
-std::array<float,2>{0.566524506f, 0.101640657f},
-std::array<float,2>{0.456037253f, 0.535202622f},
-std::array<float,2>{0.0249481425f, 0.438504368f},
-std::array<float,2>{0.777097106f, 0.955872357f},
-std::array<float,2>{0.95000726f, 0.328794748f},
-std::array<float,2>{0.186467871f, 0.758565903f},
-std::array<float,2>{0.31289643f, 0.135044515f},
-std::array<float,2>{0.657461286f, 0.728906214f},
-std::array<float,2>{0.799327195f, 0.0330144539f},
-std::array<float,2>{0.0519282185f, 0.568436623f},
-std::array<float,2>{0.483640641f, 0.403674006f},
-std::array<float,2>{0.599069178f, 0.875267327f},
-std::array<float,2>{0.639262497f, 0.277652919f},
-std::array<float,2>{0.347060025f, 0.86846602f},
-std::array<float,2>{0.134704307f, 0.227442086f},
-std::array<float,2>{0.989218116f, 0.636379004f},
-std::array<float,2>{0.513110518f, 0.148536012f},
-std::array<float,2>{0.382264078f, 0.748783648f},
-std::array<float,2>{0.0867465064f, 0.31526807f},
-std::array<float,2>{0.868365288f, 0.768501103f},
-std::array<float,2>{0.92775625f, 0.455707163f},
-std::array<float,2>{0.223414227f, 0.944932163f},
-std::array<float,2>{0.281241179f, 0.123124123f},
-std::array<float,2>{0.706047773f, 0.549466133f},
-std::array<float,2>{0.948042989f, 0.187674224f},
-std::array<float,2>{0.181348845f, 0.662842631f},
-std::array<float,2>{0.318015844f, 0.301074982f},
-std::array<float,2>{0.6618765f, 0.818830669f},
-std::array<float,2>{0.56445694f, 0.42354843f},
-std::array<float,2>{0.460380882f, 0.911135972f},
-std::array<float,2>{0.0290571935f, 0.030992087f},
-std::array<float,2>{0.780173004f, 0.598948002f},
-std::array<float,2>{0.719733715f, 0.0876621604f},
-std::array<float,2>{0.283980131f, 0.52117759f},
-std::array<float,2>{0.2139294f, 0.493350774f},
-std::array<float,2>{0.87954998f, 0.969188333f},
-std::array<float,2>{0.832069993f, 0.357162774f},
-std::array<float,2>{0.121378802f, 0.807718992f},
-std::array<float,2>{0.409891456f, 0.173312962f},
-std::array<float,2>{0.561093092f, 0.707875192f},
-std::array<float,2>{0.896918058f, 0.0955950171f},
-std::array<float,2>{0.202862039f, 0.545857847f},
-std::array<float,2>{0.312130779f, 0.445684165f},
-std::array<float,2>{0.74132061f, 0.964241982f},
-std::array<float,2>{0.537508607f, 0.340787172f},
-std::array<float,2>{0.43413645f, 0.754122078f},
-std::array<float,2>{0.102871284f, 0.127139449f},
-std::array<float,2>{0.826299667f, 0.724065602f},
-std::array<float,2>{0.68385911f, 0.241142243f},
-std::array<float,2>{0.335331708f, 0.642932653f},
-std::array<float,2>{0.169027343f, 0.25827539f},
-std::array<float,2>{0.955302119f, 0.855356872f},
-std::array<float,2>{0.757381916f, 0.387527823f},
-std::array<float,2>{0.00716189062f, 0.899330318f},
-std::array<float,2>{0.447421968f, 0.0488725081f},
-std::array<float,2>{0.580856502f, 0.57850033f},
-std::array<float,2>{0.857700288f, 0.165468618f},
-std::array<float,2>{0.0731276199f, 0.701311648f},
-std::array<float,2>{0.401126981f, 0.362495273f},
-std::array<float,2>{0.522287309f, 0.787880778f},
-std::array<float,2>{0.700756907f, 0.483930022f},
-std::array<float,2>{0.256436259f, 0.988624275f},
-std::array<float,2>{0.239755645f, 0.0635486618f},
-std::array<float,2>{0.910897255f, 0.509369731f},
-std::array<float,2>{0.619869292f, 0.00888760667f},
-std::array<float,2>{0.49199307f, 0.611866415f},
-std::array<float,2>{0.036591351f, 0.418338984f},
-std::array<float,2>{0.794630468f, 0.923033535f},
-std::array<float,2>{0.971135378f, 0.289496541f},
-std::array<float,2>{0.147227243f, 0.840304375f},
-std::array<float,2>{0.371473938f, 0.20810993f},
-std::array<float,2>{0.64127636f, 0.687214315f},
-std::array<float,2>{0.819820583f, 0.0722406805f},
-std::array<float,2>{0.100896806f, 0.505286574f},
-std::array<float,2>{0.422492653f, 0.470569491f},
-std::array<float,2>{0.54298532f, 0.994891882f},
-std::array<float,2>{0.749613523f, 0.370824248f},
-std::array<float,2>{0.301326811f, 0.795509517f},
-std::array<float,2>{0.187663019f, 0.158515632f},
-std::array<float,2>{0.899020195f, 0.689500332f},
-std::array<float,2>{0.588437915f, 0.211737841f},
-std::array<float,2>{0.440636396f, 0.675718129f},
-std::array<float,2>{0.0145173352f, 0.288447559f},
-std::array<float,2>{0.764568627f, 0.828417182f},
-std::array<float,2>{0.966836691f, 0.407542616f},
-std::array<float,2>{0.159698278f, 0.936612248f},
-std::array<float,2>{0.339694738f, 0.00539786601f},
-std::array<float,2>{0.678548157f, 0.623410821f},
-std::array<float,2>{0.921685636f, 0.138531342f},
-std::array<float,2>{0.244551316f, 0.732974291f},
-std::array<float,2>{0.264106125f, 0.335849345f},
-std::array<float,2>{0.688665092f, 0.762620032f},
-std::array<float,2>{0.524800599f, 0.443110555f},
-std::array<float,2>{0.395436376f, 0.959540784f},
-std::array<float,2>{0.0661214367f, 0.106644616f},
-std::array<float,2>{0.844873071f, 0.534449577f},
-std::array<float,2>{0.65185684f, 0.0585228503f},
-std::array<float,2>{0.365749687f, 0.590947866f},
-std::array<float,2>{0.155247942f, 0.380881459f},
-std::array<float,2>{0.980865836f, 0.893644512f},
-std::array<float,2>{0.783299804f, 0.250607848f},
-std::array<float,2>{0.0396011882f, 0.846043944f},
-std::array<float,2>{0.498435646f, 0.24505806f},
-std::array<float,2>{0.616016984f, 0.655308247f},
-std::array<float,2>{0.993467569f, 0.0212420337f},
-std::array<float,2>{0.126037046f, 0.607206583f},
-std::array<float,2>{0.353374749f, 0.434715629f},
-std::array<float,2>{0.62862438f, 0.914757907f},
-std::array<float,2>{0.60824579f, 0.307970196f},
-std::array<float,2>{0.474611551f, 0.827220261f},
-std::array<float,2>{0.0603181943f, 0.195475414f},
-std::array<float,2>{0.809006214f, 0.665192425f},
-std::array<float,2>{0.715843976f, 0.186263666f},
-std::array<float,2>{0.271571547f, 0.715494752f},
-std::array<float,2>{0.23267661f, 0.349275738f},
-std::array<float,2>{0.937244117f, 0.804491758f},
-std::array<float,2>{0.866081417f, 0.489835769f},
-std::array<float,2>{0.0849432051f, 0.98217243f},
-std::array<float,2>{0.383240521f, 0.0781420544f},
-std::array<float,2>{0.505044699f, 0.5308761f},
-std::array<float,2>{0.769101381f, 0.224374488f},
-std::array<float,2>{0.0168189835f, 0.625926137f},
-std::array<float,2>{0.461571515f, 0.267792255f},
-std::array<float,2>{0.574870348f, 0.86099273f},
-std::array<float,2>{0.671378672f, 0.393631727f},
-std::array<float,2>{0.327283025f, 0.882887602f},
-std::array<float,2>{0.173221648f, 0.0402869694f},
-std::array<float,2>{0.943913937f, 0.574356198f},
-std::array<float,2>{0.550514936f, 0.112457708f},
-std::array<float,2>{0.416961074f, 0.556592464f},
-std::array<float,2>{0.10940969f, 0.467585862f},
-std::array<float,2>{0.838859022f, 0.95302248f},
-std::array<float,2>{0.886554718f, 0.32578364f},
-std::array<float,2>{0.203658283f, 0.778407037f},
-std::array<float,2>{0.295659363f, 0.145575389f},
-std::array<float,2>{0.727549732f, 0.735706627f},
-std::array<float,2>{0.872487307f, 0.000345849403f},
-std::array<float,2>{0.0902515575f, 0.619981229f},
-std::array<float,2>{0.375879914f, 0.411343813f},
-std::array<float,2>{0.508804798f, 0.931840658f},
-std::array<float,2>{0.708357632f, 0.284447104f},
-std::array<float,2>{0.273823291f, 0.833627403f},
-std::array<float,2>{0.222047284f, 0.215346187f},
-std::array<float,2>{0.925536215f, 0.679486156f},
-std::array<float,2>{0.597575486f, 0.161837757f},
-std::array<float,2>{0.478678942f, 0.694827855f},
-std::array<float,2>{0.0477910303f, 0.374053001f},
-std::array<float,2>{0.804214656f, 0.791464508f},
-std::array<float,2>{0.98582226f, 0.474297136f},
-std::array<float,2>{0.136989683f, 0.996333838f},
-std::array<float,2>{0.350977302f, 0.0748528242f},
-std::array<float,2>{0.63595295f, 0.502283812f},
-std::array<float,2>{0.875762761f, 0.247264177f},
-std::array<float,2>{0.217112571f, 0.651271403f},
-std::array<float,2>{0.285249203f, 0.254077584f},
-std::array<float,2>{0.724931538f, 0.848955214f},
-std::array<float,2>{0.554839611f, 0.376273602f},
-std::array<float,2>{0.413467854f, 0.896272779f},
-std::array<float,2>{0.117346056f, 0.0603228547f},
-std::array<float,2>{0.830026746f, 0.58755827f},
-std::array<float,2>{0.657799959f, 0.103535749f},
-std::array<float,2>{0.313120514f, 0.537388802f},
-std::array<float,2>{0.18580386f, 0.43990171f},
-std::array<float,2>{0.949374437f, 0.954298198f},
-std::array<float,2>{0.776470542f, 0.33009845f},
-std::array<float,2>{0.0246750005f, 0.759811044f},
-std::array<float,2>{0.455228746f, 0.134404853f},
-std::array<float,2>{0.567350745f, 0.727934062f},
-std::array<float,2>{0.958133221f, 0.0839277208f},
-std::array<float,2>{0.165702194f, 0.525400877f},
-std::array<float,2>{0.330394119f, 0.486686617f},
-std::array<float,2>{0.682811916f, 0.977462292f},
-std::array<float,2>{0.584973037f, 0.346086293f},
-std::array<float,2>{0.449935973f, 0.798041344f},
-std::array<float,2>{0.00214394275f, 0.181102186f},
-std::array<float,2>{0.75160414f, 0.712147593f},
-std::array<float,2>{0.737038612f, 0.200249419f},
-std::array<float,2>{0.30670926f, 0.668088734f},
-std::array<float,2>{0.19815807f, 0.310168803f},
-std::array<float,2>{0.892460227f, 0.820468545f},
-std::array<float,2>{0.821073115f, 0.432821691f},
-std::array<float,2>{0.107451878f, 0.920333326f},
-std::array<float,2>{0.432266355f, 0.016422905f},
-std::array<float,2>{0.534506619f, 0.605327308f},
-std::array<float,2>{0.792213202f, 0.143064931f},
-std::array<float,2>{0.0321046002f, 0.741901338f},
-std::array<float,2>{0.486215591f, 0.320412427f},
-std::array<float,2>{0.621368229f, 0.773508191f},
-std::array<float,2>{0.645076871f, 0.463278055f},
-std::array<float,2>{0.367539555f, 0.945711017f},
-std::array<float,2>{0.14351204f, 0.113470271f},
-std::array<float,2>{0.974285543f, 0.559619069f},
-std::array<float,2>{0.51787895f, 0.0438709967f},
-std::array<float,2>{0.404691368f, 0.573729753f},
-std::array<float,2>{0.0776775405f, 0.397369653f},
-std::array<float,2>{0.851863742f, 0.889622748f},
-std::array<float,2>{0.909611702f, 0.270565152f},
-std::array<float,2>{0.236425549f, 0.866354644f},
-std::array<float,2>{0.252915472f, 0.21951507f},
-std::array<float,2>{0.696999371f, 0.631722569f},
-std::array<float,2>{0.760068119f, 0.11894577f},
-std::array<float,2>{0.00893753581f, 0.553965926f},
-std::array<float,2>{0.444168746f, 0.45822078f},
-std::array<float,2>{0.593345642f, 0.939538479f},
-std::array<float,2>{0.675612807f, 0.319131255f},
-std::array<float,2>{0.340804249f, 0.771398544f},
-std::array<float,2>{0.161380485f, 0.154900298f},
-std::array<float,2>{0.962432086f, 0.742346048f},
-std::array<float,2>{0.540787935f, 0.232640773f},
-std::array<float,2>{0.425938904f, 0.639073312f},
-std::array<float,2>{0.0958568528f, 0.276356608f},
-std::array<float,2>{0.813940942f, 0.872495115f},
-std::array<float,2>{0.903617024f, 0.402094215f},
-std::array<float,2>{0.193087578f, 0.882028162f},
-std::array<float,2>{0.297696054f, 0.0369973741f},
-std::array<float,2>{0.746055484f, 0.565475225f},
-std::array<float,2>{0.980003715f, 0.177353621f},
-std::array<float,2>{0.151097611f, 0.70595479f},
-std::array<float,2>{0.359544843f, 0.352888852f},
-std::array<float,2>{0.652661145f, 0.809710085f},
-std::array<float,2>{0.612710595f, 0.496109694f},
-std::array<float,2>{0.495155483f, 0.97451371f},
-std::array<float,2>{0.0432489775f, 0.0923141688f},
-std::array<float,2>{0.786057413f, 0.516201854f},
-std::array<float,2>{0.692132354f, 0.0271697789f},
-std::array<float,2>{0.258602262f, 0.596571982f},
-std::array<float,2>{0.246553779f, 0.428708911f},
-std::array<float,2>{0.914435446f, 0.906601906f},
-std::array<float,2>{0.847907245f, 0.297407508f},
-std::array<float,2>{0.0691220686f, 0.813145876f},
-std::array<float,2>{0.393055469f, 0.193181336f},
-std::array<float,2>{0.530656695f, 0.657301068f},
-std::array<float,2>{0.929977596f, 0.0511914976f},
-std::array<float,2>{0.227602959f, 0.584149718f},
-std::array<float,2>{0.266653031f, 0.386263996f},
-std::array<float,2>{0.714313686f, 0.905859649f},
-std::array<float,2>{0.503332198f, 0.264826894f},
-std::array<float,2>{0.388725489f, 0.857872486f},
-std::array<float,2>{0.0797219202f, 0.236058056f},
-std::array<float,2>{0.861268103f, 0.645277262f},
-std::array<float,2>{0.628918886f, 0.130190983f},
-std::array<float,2>{0.359158218f, 0.720140696f},
-std::array<float,2>{0.132716462f, 0.33952257f},
-std::array<float,2>{0.996513546f, 0.752361357f},
-std::array<float,2>{0.806135774f, 0.452448308f},
-std::array<float,2>{0.0559854545f, 0.968064547f},
-std::array<float,2>{0.470531642f, 0.0998506844f},
-std::array<float,2>{0.60246557f, 0.539889991f},
-std::array<float,2>{0.841329873f, 0.204279616f},
-std::array<float,2>{0.11334645f, 0.683485806f},
-std::array<float,2>{0.420662969f, 0.295269966f},
-std::array<float,2>{0.552456379f, 0.836548567f},
-std::array<float,2>{0.730585694f, 0.417426318f},
-std::array<float,2>{0.290933311f, 0.928997755f},
-std::array<float,2>{0.21046944f, 0.0146634951f},
-std::array<float,2>{0.889202237f, 0.617073774f},
-std::array<float,2>{0.571207106f, 0.0703103766f},
-std::array<float,2>{0.46582064f, 0.513291478f},
-std::array<float,2>{0.0220583118f, 0.478253126f},
-std::array<float,2>{0.77164799f, 0.987853289f},
-std::array<float,2>{0.938606322f, 0.366315842f},
-std::array<float,2>{0.175782844f, 0.784490287f},
-std::array<float,2>{0.322417766f, 0.168655127f},
-std::array<float,2>{0.66475755f, 0.69722265f},
-std::array<float,2>{0.777536035f, 0.0280062594f},
-std::array<float,2>{0.0303179473f, 0.600570619f},
-std::array<float,2>{0.457101852f, 0.424132764f},
-std::array<float,2>{0.562609553f, 0.913940907f},
-std::array<float,2>{0.663935125f, 0.304302424f},
-std::array<float,2>{0.319097608f, 0.816687465f},
-std::array<float,2>{0.182376236f, 0.190461546f},
-std::array<float,2>{0.946970522f, 0.661532998f},
-std::array<float,2>{0.55975008f, 0.174813554f},
-std::array<float,2>{0.406667173f, 0.710331917f},
-std::array<float,2>{0.124549948f, 0.359092653f},
-std::array<float,2>{0.834685802f, 0.806337893f},
-std::array<float,2>{0.882410824f, 0.494404525f},
-std::array<float,2>{0.212102264f, 0.972120404f},
-std::array<float,2>{0.28180331f, 0.0879529417f},
-std::array<float,2>{0.722315013f, 0.522210479f},
-std::array<float,2>{0.991483867f, 0.229377314f},
-std::array<float,2>{0.135298446f, 0.633616626f},
-std::array<float,2>{0.345027179f, 0.280317158f},
-std::array<float,2>{0.638029933f, 0.869598746f},
-std::array<float,2>{0.600776196f, 0.404441893f},
-std::array<float,2>{0.481001318f, 0.878856659f},
-std::array<float,2>{0.0533882529f, 0.0333803818f},
-std::array<float,2>{0.798052788f, 0.568071246f},
-std::array<float,2>{0.703745425f, 0.122104496f},
-std::array<float,2>{0.278912902f, 0.548347414f},
-std::array<float,2>{0.22568503f, 0.453767031f},
-std::array<float,2>{0.927550793f, 0.94246465f},
-std::array<float,2>{0.870338678f, 0.312648624f},
-std::array<float,2>{0.0896008164f, 0.766880333f},
-std::array<float,2>{0.379324704f, 0.15181008f},
-std::array<float,2>{0.515269041f, 0.747132003f},
-std::array<float,2>{0.912268579f, 0.0655742288f},
-std::array<float,2>{0.241850659f, 0.510758817f},
-std::array<float,2>{0.254005253f, 0.481698126f},
-std::array<float,2>{0.702578664f, 0.990611374f},
-std::array<float,2>{0.520644069f, 0.360254049f},
-std::array<float,2>{0.398443103f, 0.785890341f},
-std::array<float,2>{0.0710380524f, 0.166124001f},
-std::array<float,2>{0.856748581f, 0.70006603f},
-std::array<float,2>{0.64324832f, 0.21058397f},
-std::array<float,2>{0.373631567f, 0.685258031f},
-std::array<float,2>{0.144561604f, 0.29254356f},
-std::array<float,2>{0.970378518f, 0.842840016f},
-std::array<float,2>{0.796497464f, 0.420735717f},
-std::array<float,2>{0.0388069265f, 0.925128043f},
-std::array<float,2>{0.489996821f, 0.0109067587f},
-std::array<float,2>{0.617599308f, 0.609427452f},
-std::array<float,2>{0.82571727f, 0.125230804f},
-std::array<float,2>{0.104153216f, 0.725361049f},
-std::array<float,2>{0.436521411f, 0.343379259f},
-std::array<float,2>{0.535739124f, 0.757370353f},
-std::array<float,2>{0.74005425f, 0.448349208f},
-std::array<float,2>{0.309520453f, 0.962312758f},
-std::array<float,2>{0.200362638f, 0.096151486f},
-std::array<float,2>{0.895993054f, 0.544505179f},
-std::array<float,2>{0.579348564f, 0.0475114956f},
-std::array<float,2>{0.447047859f, 0.581269622f},
-std::array<float,2>{0.00583131518f, 0.390123904f},
-std::array<float,2>{0.754424572f, 0.901077926f},
-std::array<float,2>{0.954192221f, 0.261080861f},
-std::array<float,2>{0.171363652f, 0.851835012f},
-std::array<float,2>{0.333274394f, 0.23946327f},
-std::array<float,2>{0.686516762f, 0.641986668f},
-std::array<float,2>{0.847079098f, 0.107875608f},
-std::array<float,2>{0.0626892596f, 0.531550109f},
-std::array<float,2>{0.397200406f, 0.443882406f},
-std::array<float,2>{0.526834011f, 0.957296014f},
-std::array<float,2>{0.691148341f, 0.333307624f},
-std::array<float,2>{0.263386935f, 0.763741255f},
-std::array<float,2>{0.244121403f, 0.140576735f},
-std::array<float,2>{0.918411493f, 0.732202053f},
-std::array<float,2>{0.613630891f, 0.24402976f},
-std::array<float,2>{0.497758299f, 0.654188335f},
-std::array<float,2>{0.0418866314f, 0.253009468f},
-std::array<float,2>{0.781608284f, 0.845449388f},
-std::array<float,2>{0.982739568f, 0.380190521f},
-std::array<float,2>{0.15260461f, 0.891979337f},
-std::array<float,2>{0.363306522f, 0.0554652996f},
-std::array<float,2>{0.649401069f, 0.592238307f},
-std::array<float,2>{0.90043515f, 0.156929791f},
-std::array<float,2>{0.191175506f, 0.689248145f},
-std::array<float,2>{0.303249836f, 0.367933571f},
-std::array<float,2>{0.747038782f, 0.79477191f},
-std::array<float,2>{0.546030283f, 0.471188426f},
-std::array<float,2>{0.424458623f, 0.992686093f},
-std::array<float,2>{0.0989449546f, 0.07246501f},
-std::array<float,2>{0.817267716f, 0.506641626f},
-std::array<float,2>{0.676862955f, 0.00711724441f},
-std::array<float,2>{0.336137444f, 0.62166661f},
-std::array<float,2>{0.157562003f, 0.410073876f},
-std::array<float,2>{0.96612078f, 0.934467852f},
-std::array<float,2>{0.763438582f, 0.286876738f},
-std::array<float,2>{0.0120982891f, 0.830189466f},
-std::array<float,2>{0.438886762f, 0.214477465f},
-std::array<float,2>{0.587326825f, 0.672152221f},
-std::array<float,2>{0.942789733f, 0.0425420627f},
-std::array<float,2>{0.175590545f, 0.576547027f},
-std::array<float,2>{0.326134682f, 0.392490685f},
-std::array<float,2>{0.66878742f, 0.885077178f},
-std::array<float,2>{0.576939106f, 0.26720944f},
-std::array<float,2>{0.464339554f, 0.862543583f},
-std::array<float,2>{0.0191893168f, 0.225695416f},
-std::array<float,2>{0.767120481f, 0.628084242f},
-std::array<float,2>{0.729981124f, 0.146670669f},
-std::array<float,2>{0.293997318f, 0.73726666f},
-std::array<float,2>{0.20664081f, 0.32686457f},
-std::array<float,2>{0.884211481f, 0.780825794f},
-std::array<float,2>{0.837003112f, 0.465294421f},
-std::array<float,2>{0.112665683f, 0.950407088f},
-std::array<float,2>{0.414304495f, 0.111232877f},
-std::array<float,2>{0.547003925f, 0.558197975f},
-std::array<float,2>{0.811222553f, 0.198837534f},
-std::array<float,2>{0.0616429336f, 0.666657627f},
-std::array<float,2>{0.472874224f, 0.306368172f},
-std::array<float,2>{0.606843948f, 0.824725926f},
-std::array<float,2>{0.626868606f, 0.437381536f},
-std::array<float,2>{0.35521701f, 0.916230559f},
-std::array<float,2>{0.128561452f, 0.0227246862f},
-std::array<float,2>{0.996031761f, 0.609150708f},
-std::array<float,2>{0.506822526f, 0.0816176534f},
-std::array<float,2>{0.386275262f, 0.528551996f},
-std::array<float,2>{0.0829112828f, 0.491829127f},
-std::array<float,2>{0.864978552f, 0.983067095f},
-std::array<float,2>{0.934050858f, 0.350778848f},
-std::array<float,2>{0.232072413f, 0.801783621f},
-std::array<float,2>{0.2696971f, 0.183749437f},
-std::array<float,2>{0.717486382f, 0.718177557f},
-std::array<float,2>{0.830901504f, 0.061451856f},
-std::array<float,2>{0.120996945f, 0.589617074f},
-std::array<float,2>{0.411355972f, 0.3775343f},
-std::array<float,2>{0.557365596f, 0.897863209f},
-std::array<float,2>{0.722973883f, 0.257388204f},
-std::array<float,2>{0.287988842f, 0.851295233f},
-std::array<float,2>{0.216449887f, 0.249919116f},
-std::array<float,2>{0.878192723f, 0.648744106f},
-std::array<float,2>{0.569585741f, 0.135343209f},
-std::array<float,2>{0.45482105f, 0.729233384f},
-std::array<float,2>{0.0265815798f, 0.328528106f},
-std::array<float,2>{0.773684084f, 0.758040965f},
-std::array<float,2>{0.951515913f, 0.439155877f},
-std::array<float,2>{0.18536967f, 0.955382824f},
-std::array<float,2>{0.314791709f, 0.102094792f},
-std::array<float,2>{0.659852743f, 0.535832763f},
-std::array<float,2>{0.923433602f, 0.218092337f},
-std::array<float,2>{0.220275134f, 0.67617029f},
-std::array<float,2>{0.27649948f, 0.281572789f},
-std::array<float,2>{0.709718287f, 0.834420145f},
-std::array<float,2>{0.510652781f, 0.413789332f},
-std::array<float,2>{0.37702468f, 0.931519449f},
-std::array<float,2>{0.0931017324f, 0.0033964226f},
-std::array<float,2>{0.874135971f, 0.617829621f},
-std::array<float,2>{0.633918345f, 0.0777769685f},
-std::array<float,2>{0.348987013f, 0.500433266f},
-std::array<float,2>{0.139242515f, 0.475962818f},
-std::array<float,2>{0.987503529f, 0.999087453f},
-std::array<float,2>{0.802333832f, 0.372334868f},
-std::array<float,2>{0.0505681746f, 0.790909708f},
-std::array<float,2>{0.477932155f, 0.162462831f},
-std::array<float,2>{0.594499826f, 0.692031264f},
-std::array<float,2>{0.975414038f, 0.116643533f},
-std::array<float,2>{0.141100362f, 0.561552525f},
-std::array<float,2>{0.37022683f, 0.461932153f},
-std::array<float,2>{0.646598458f, 0.94898212f},
-std::array<float,2>{0.623885572f, 0.323627353f},
-std::array<float,2>{0.488240063f, 0.776372552f},
-std::array<float,2>{0.034649685f, 0.140934721f},
-std::array<float,2>{0.789577305f, 0.7383762f},
-std::array<float,2>{0.698323011f, 0.222539902f},
-std::array<float,2>{0.251915604f, 0.629034102f},
-std::array<float,2>{0.235877454f, 0.273232996f},
-std::array<float,2>{0.907321692f, 0.864908099f},
-std::array<float,2>{0.85408783f, 0.395036668f},
-std::array<float,2>{0.0744211972f, 0.888317347f},
-std::array<float,2>{0.402737021f, 0.0453407094f},
-std::array<float,2>{0.515926957f, 0.571537495f},
-std::array<float,2>{0.753319561f, 0.18172732f},
-std::array<float,2>{0.00152262032f, 0.712899208f},
-std::array<float,2>{0.452772588f, 0.344805241f},
-std::array<float,2>{0.582838237f, 0.798943341f},
-std::array<float,2>{0.679958224f, 0.485841274f},
-std::array<float,2>{0.329237252f, 0.978569686f},
-std::array<float,2>{0.166493461f, 0.0842637941f},
-std::array<float,2>{0.960626245f, 0.525224924f},
-std::array<float,2>{0.532648981f, 0.0180518832f},
-std::array<float,2>{0.430174321f, 0.60199213f},
-std::array<float,2>{0.106071189f, 0.431480497f},
-std::array<float,2>{0.823078394f, 0.919259787f},
-std::array<float,2>{0.893178463f, 0.311498672f},
-std::array<float,2>{0.196895078f, 0.822677612f},
-std::array<float,2>{0.304706067f, 0.202712774f},
-std::array<float,2>{0.735075951f, 0.671279669f},
-std::array<float,2>{0.787669301f, 0.0903649256f},
-std::array<float,2>{0.0456280597f, 0.517880678f},
-std::array<float,2>{0.493196458f, 0.49882102f},
-std::array<float,2>{0.610123873f, 0.976483405f},
-std::array<float,2>{0.655074596f, 0.353628844f},
-std::array<float,2>{0.36180377f, 0.811143637f},
-std::array<float,2>{0.149431467f, 0.17895864f},
-std::array<float,2>{0.97727567f, 0.703697503f},
-std::array<float,2>{0.528758228f, 0.193610117f},
-std::array<float,2>{0.390675962f, 0.659689486f},
-std::array<float,2>{0.0680258423f, 0.300520957f},
-std::array<float,2>{0.850037694f, 0.815649688f},
-std::array<float,2>{0.916017056f, 0.426750958f},
-std::array<float,2>{0.248818636f, 0.909688115f},
-std::array<float,2>{0.259938926f, 0.0244269688f},
-std::array<float,2>{0.694132805f, 0.594971597f},
-std::array<float,2>{0.963873446f, 0.153487414f},
-std::array<float,2>{0.163349316f, 0.745755851f},
-std::array<float,2>{0.34295997f, 0.317260057f},
-std::array<float,2>{0.672116935f, 0.771905303f},
-std::array<float,2>{0.591665208f, 0.45954752f},
-std::array<float,2>{0.441843659f, 0.939075232f},
-std::array<float,2>{0.0114213023f, 0.120434701f},
-std::array<float,2>{0.758205116f, 0.552563906f},
-std::array<float,2>{0.742462814f, 0.0384752639f},
-std::array<float,2>{0.299897641f, 0.563509285f},
-std::array<float,2>{0.194417477f, 0.399232715f},
-std::array<float,2>{0.906154096f, 0.879919291f},
-std::array<float,2>{0.815083742f, 0.275051951f},
-std::array<float,2>{0.0956941172f, 0.873779714f},
-std::array<float,2>{0.427923948f, 0.232277736f},
-std::array<float,2>{0.541503072f, 0.637660265f},
-std::array<float,2>{0.888544381f, 0.0129562523f},
-std::array<float,2>{0.207614958f, 0.613302648f},
-std::array<float,2>{0.291789681f, 0.414549023f},
-std::array<float,2>{0.732557833f, 0.926083386f},
-std::array<float,2>{0.554331005f, 0.294245601f},
-std::array<float,2>{0.419287413f, 0.838655651f},
-std::array<float,2>{0.115801066f, 0.205403373f},
-std::array<float,2>{0.842077792f, 0.681104362f},
-std::array<float,2>{0.667262614f, 0.171383932f},
-std::array<float,2>{0.321021825f, 0.698533356f},
-std::array<float,2>{0.178266108f, 0.364629239f},
-std::array<float,2>{0.939756036f, 0.781486034f},
-std::array<float,2>{0.770792007f, 0.479085505f},
-std::array<float,2>{0.0208339784f, 0.98519212f},
-std::array<float,2>{0.468705565f, 0.0664449558f},
-std::array<float,2>{0.574157834f, 0.514940917f},
-std::array<float,2>{0.86260277f, 0.23732011f},
-std::array<float,2>{0.0818531439f, 0.646722138f},
-std::array<float,2>{0.387783021f, 0.263241619f},
-std::array<float,2>{0.501251101f, 0.856927335f},
-std::array<float,2>{0.711229444f, 0.384061575f},
-std::array<float,2>{0.267922819f, 0.902583957f},
-std::array<float,2>{0.22994709f, 0.0530711301f},
-std::array<float,2>{0.9320153f, 0.582139909f},
-std::array<float,2>{0.604348898f, 0.098930411f},
-std::array<float,2>{0.471242428f, 0.542455018f},
-std::array<float,2>{0.0574228019f, 0.450682342f},
-std::array<float,2>{0.80813539f, 0.965095758f},
-std::array<float,2>{0.999960065f, 0.336990029f},
-std::array<float,2>{0.130826563f, 0.750016391f},
-std::array<float,2>{0.357268155f, 0.131781265f},
-std::array<float,2>{0.630909026f, 0.722618759f},
-std::array<float,2>{0.755321681f, 0.0499576665f},
-std::array<float,2>{0.00471345475f, 0.579124987f},
-std::array<float,2>{0.445981622f, 0.3884224f},
-std::array<float,2>{0.579035521f, 0.899796247f},
-std::array<float,2>{0.686715305f, 0.259000778f},
-std::array<float,2>{0.332782835f, 0.854145885f},
-std::array<float,2>{0.170274198f, 0.241937816f},
-std::array<float,2>{0.953754067f, 0.643555701f},
-std::array<float,2>{0.53641969f, 0.128310308f},
-std::array<float,2>{0.43680346f, 0.723022401f},
-std::array<float,2>{0.104511812f, 0.34166342f},
-std::array<float,2>{0.82425797f, 0.755838275f},
-std::array<float,2>{0.895147383f, 0.44662407f},
-std::array<float,2>{0.200019807f, 0.962982714f},
-std::array<float,2>{0.310098261f, 0.0945356414f},
-std::array<float,2>{0.738542795f, 0.546227634f},
-std::array<float,2>{0.96960628f, 0.207905307f},
-std::array<float,2>{0.146116838f, 0.686392903f},
-std::array<float,2>{0.374785274f, 0.290068239f},
-std::array<float,2>{0.644492686f, 0.841738999f},
-std::array<float,2>{0.618541658f, 0.419243306f},
-std::array<float,2>{0.48914507f, 0.921917081f},
-std::array<float,2>{0.0374671817f, 0.00830908865f},
-std::array<float,2>{0.795230985f, 0.612681389f},
-std::array<float,2>{0.701531231f, 0.0633235201f},
-std::array<float,2>{0.255727947f, 0.507831752f},
-std::array<float,2>{0.240356684f, 0.483267277f},
-std::array<float,2>{0.913831651f, 0.989610612f},
-std::array<float,2>{0.855569899f, 0.362148821f},
-std::array<float,2>{0.0722157136f, 0.789002836f},
-std::array<float,2>{0.400288105f, 0.164742842f},
-std::array<float,2>{0.520198882f, 0.7024858f},
-std::array<float,2>{0.925822079f, 0.1240554f},
-std::array<float,2>{0.225526169f, 0.55039078f},
-std::array<float,2>{0.27794835f, 0.456722826f},
-std::array<float,2>{0.704748213f, 0.94383508f},
-std::array<float,2>{0.514180303f, 0.316029042f},
-std::array<float,2>{0.380150408f, 0.769032359f},
-std::array<float,2>{0.0882068127f, 0.149662003f},
-std::array<float,2>{0.870062113f, 0.749110341f},
-std::array<float,2>{0.636815846f, 0.228509009f},
-std::array<float,2>{0.34397316f, 0.635297537f},
-std::array<float,2>{0.13583985f, 0.278750569f},
-std::array<float,2>{0.990794718f, 0.867580175f},
-std::array<float,2>{0.797030509f, 0.402441174f},
-std::array<float,2>{0.0544581339f, 0.876187563f},
-std::array<float,2>{0.482409447f, 0.0314219221f},
-std::array<float,2>{0.6003564f, 0.569842517f},
-std::array<float,2>{0.835470498f, 0.172725886f},
-std::array<float,2>{0.123148426f, 0.70889765f},
-std::array<float,2>{0.407764584f, 0.355897009f},
-std::array<float,2>{0.558613181f, 0.806715667f},
-std::array<float,2>{0.720856845f, 0.4922207f},
-std::array<float,2>{0.283134609f, 0.970400035f},
-std::array<float,2>{0.211112574f, 0.0865137801f},
-std::array<float,2>{0.881233454f, 0.519784987f},
-std::array<float,2>{0.563888013f, 0.0295220893f},
-std::array<float,2>{0.458973944f, 0.598195255f},
-std::array<float,2>{0.0299379379f, 0.422025234f},
-std::array<float,2>{0.77918756f, 0.910281241f},
-std::array<float,2>{0.945606411f, 0.302730381f},
-std::array<float,2>{0.183345377f, 0.819433451f},
-std::array<float,2>{0.320180714f, 0.189411834f},
-std::array<float,2>{0.66252774f, 0.663321018f},
-std::array<float,2>{0.86406678f, 0.0800410286f},
-std::array<float,2>{0.0835553482f, 0.530263603f},
-std::array<float,2>{0.384979814f, 0.48853907f},
-std::array<float,2>{0.507732511f, 0.980790854f},
-std::array<float,2>{0.718089342f, 0.347895801f},
-std::array<float,2>{0.271241903f, 0.802786171f},
-std::array<float,2>{0.230493158f, 0.186582446f},
-std::array<float,2>{0.934658706f, 0.716757953f},
-std::array<float,2>{0.60584116f, 0.196422979f},
-std::array<float,2>{0.474534959f, 0.66499567f},
-std::array<float,2>{0.0615086071f, 0.30725202f},
-std::array<float,2>{0.81248194f, 0.826883733f},
-std::array<float,2>{0.99420619f, 0.434478223f},
-std::array<float,2>{0.12751621f, 0.915760815f},
-std::array<float,2>{0.353807241f, 0.0203784164f},
-std::array<float,2>{0.625635803f, 0.606312096f},
-std::array<float,2>{0.882875979f, 0.145233363f},
-std::array<float,2>{0.205481157f, 0.734450459f},
-std::array<float,2>{0.293904871f, 0.324515879f},
-std::array<float,2>{0.729110241f, 0.77792865f},
-std::array<float,2>{0.548210502f, 0.46870473f},
-std::array<float,2>{0.415893763f, 0.951990306f},
-std::array<float,2>{0.112302646f, 0.112187296f},
-std::array<float,2>{0.83634311f, 0.555412829f},
-std::array<float,2>{0.669849098f, 0.039241001f},
-std::array<float,2>{0.32440564f, 0.575924098f},
-std::array<float,2>{0.174503759f, 0.39348352f},
-std::array<float,2>{0.942155421f, 0.88441807f},
-std::array<float,2>{0.766052425f, 0.268565863f},
-std::array<float,2>{0.0183656421f, 0.86032331f},
-std::array<float,2>{0.46300295f, 0.223450884f},
-std::array<float,2>{0.577253699f, 0.62613833f},
-std::array<float,2>{0.965480864f, 0.00412865775f},
-std::array<float,2>{0.157102168f, 0.624087572f},
-std::array<float,2>{0.337845117f, 0.406858355f},
-std::array<float,2>{0.676202714f, 0.936325669f},
-std::array<float,2>{0.586749256f, 0.287376136f},
-std::array<float,2>{0.437559992f, 0.829486907f},
-std::array<float,2>{0.0134222247f, 0.212279782f},
-std::array<float,2>{0.762016594f, 0.674617648f},
-std::array<float,2>{0.747833908f, 0.159245804f},
-std::array<float,2>{0.30447349f, 0.691179574f},
-std::array<float,2>{0.18953146f, 0.36933139f},
-std::array<float,2>{0.902187943f, 0.796202064f},
-std::array<float,2>{0.81790626f, 0.469170362f},
-std::array<float,2>{0.0984578207f, 0.996078491f},
-std::array<float,2>{0.425185949f, 0.0710230097f},
-std::array<float,2>{0.545378089f, 0.503966749f},
-std::array<float,2>{0.782907963f, 0.24608545f},
-std::array<float,2>{0.0420480371f, 0.65452528f},
-std::array<float,2>{0.496176124f, 0.251488537f},
-std::array<float,2>{0.614740968f, 0.846959472f},
-std::array<float,2>{0.649818122f, 0.382104069f},
-std::array<float,2>{0.36477074f, 0.893144846f},
-std::array<float,2>{0.154108495f, 0.0567458272f},
-std::array<float,2>{0.983536243f, 0.590236545f},
-std::array<float,2>{0.525804639f, 0.105791539f},
-std::array<float,2>{0.397768527f, 0.534105003f},
-std::array<float,2>{0.0642516091f, 0.441829681f},
-std::array<float,2>{0.846027911f, 0.960538924f},
-std::array<float,2>{0.919617474f, 0.334450424f},
-std::array<float,2>{0.243139267f, 0.763544917f},
-std::array<float,2>{0.262584567f, 0.136869058f},
-std::array<float,2>{0.69040525f, 0.733807266f},
-std::array<float,2>{0.823655069f, 0.0173219088f},
-std::array<float,2>{0.106607854f, 0.604179978f},
-std::array<float,2>{0.430849612f, 0.431862742f},
-std::array<float,2>{0.531546593f, 0.921387315f},
-std::array<float,2>{0.735554874f, 0.30866605f},
-std::array<float,2>{0.306307346f, 0.821906626f},
-std::array<float,2>{0.195342764f, 0.199859515f},
-std::array<float,2>{0.894151986f, 0.669130027f},
-std::array<float,2>{0.58313185f, 0.180609748f},
-std::array<float,2>{0.45174852f, 0.711296499f},
-std::array<float,2>{0.000859485357f, 0.346993685f},
-std::array<float,2>{0.75291121f, 0.796905279f},
-std::array<float,2>{0.95991832f, 0.487473965f},
-std::array<float,2>{0.167583287f, 0.977904618f},
-std::array<float,2>{0.328981906f, 0.0828115717f},
-std::array<float,2>{0.681312859f, 0.526518643f},
-std::array<float,2>{0.90694195f, 0.220658869f},
-std::array<float,2>{0.234916046f, 0.63184166f},
-std::array<float,2>{0.250099182f, 0.270471722f},
-std::array<float,2>{0.697670281f, 0.865748405f},
-std::array<float,2>{0.517110646f, 0.397901505f},
-std::array<float,2>{0.403377354f, 0.890425801f},
-std::array<float,2>{0.0758107454f, 0.0442230478f},
-std::array<float,2>{0.855070293f, 0.57314384f},
-std::array<float,2>{0.648267865f, 0.115142979f},
-std::array<float,2>{0.369321197f, 0.55886054f},
-std::array<float,2>{0.142321005f, 0.464138567f},
-std::array<float,2>{0.976394236f, 0.946920335f},
-std::array<float,2>{0.790645003f, 0.321794063f},
-std::array<float,2>{0.033331044f, 0.77448386f},
-std::array<float,2>{0.486596644f, 0.143817008f},
-std::array<float,2>{0.624185324f, 0.740731418f},
-std::array<float,2>{0.987244487f, 0.0757568628f},
-std::array<float,2>{0.140381515f, 0.503455639f},
-std::array<float,2>{0.347855121f, 0.473223954f},
-std::array<float,2>{0.633277118f, 0.997810006f},
-std::array<float,2>{0.594963431f, 0.373736322f},
-std::array<float,2>{0.477449626f, 0.792209506f},
-std::array<float,2>{0.0496529788f, 0.160932988f},
-std::array<float,2>{0.800981879f, 0.694266856f},
-std::array<float,2>{0.710247576f, 0.216474652f},
-std::array<float,2>{0.275573134f, 0.678624034f},
-std::array<float,2>{0.21942994f, 0.283965319f},
-std::array<float,2>{0.921993732f, 0.832743347f},
-std::array<float,2>{0.873225749f, 0.410206646f},
-std::array<float,2>{0.0923797339f, 0.933341026f},
-std::array<float,2>{0.378159344f, 0.00111625402f},
-std::array<float,2>{0.510981202f, 0.620793819f},
-std::array<float,2>{0.775308728f, 0.13372159f},
-std::array<float,2>{0.0261362363f, 0.726664245f},
-std::array<float,2>{0.453502595f, 0.33196786f},
-std::array<float,2>{0.569231629f, 0.760809898f},
-std::array<float,2>{0.658684671f, 0.440743029f},
-std::array<float,2>{0.315956414f, 0.95355022f},
-std::array<float,2>{0.184384137f, 0.105168529f},
-std::array<float,2>{0.952529192f, 0.538700044f},
-std::array<float,2>{0.558011711f, 0.0590049401f},
-std::array<float,2>{0.410761148f, 0.586332202f},
-std::array<float,2>{0.119866721f, 0.375398278f},
-std::array<float,2>{0.831822693f, 0.895321667f},
-std::array<float,2>{0.877885997f, 0.255749226f},
-std::array<float,2>{0.21566692f, 0.848377287f},
-std::array<float,2>{0.288165689f, 0.246421844f},
-std::array<float,2>{0.723858774f, 0.651649356f},
-std::array<float,2>{0.80683881f, 0.101380572f},
-std::array<float,2>{0.0577590093f, 0.540709138f},
-std::array<float,2>{0.472471595f, 0.451749533f},
-std::array<float,2>{0.605337203f, 0.967719615f},
-std::array<float,2>{0.632241428f, 0.338098884f},
-std::array<float,2>{0.356197596f, 0.753681064f},
-std::array<float,2>{0.129558951f, 0.129393891f},
-std::array<float,2>{0.998841941f, 0.719651997f},
-std::array<float,2>{0.500872195f, 0.235112533f},
-std::array<float,2>{0.387498826f, 0.645869911f},
-std::array<float,2>{0.0805037394f, 0.264463931f},
-std::array<float,2>{0.861581862f, 0.859290123f},
-std::array<float,2>{0.933416247f, 0.38490209f},
-std::array<float,2>{0.228931308f, 0.904818892f},
-std::array<float,2>{0.269337982f, 0.0518397875f},
-std::array<float,2>{0.712731004f, 0.585335076f},
-std::array<float,2>{0.940605879f, 0.169902802f},
-std::array<float,2>{0.17943795f, 0.695692182f},
-std::array<float,2>{0.32144776f, 0.366203219f},
-std::array<float,2>{0.666754186f, 0.783343673f},
-std::array<float,2>{0.572488964f, 0.477015287f},
-std::array<float,2>{0.467131168f, 0.986472368f},
-std::array<float,2>{0.0196979437f, 0.0684128031f},
-std::array<float,2>{0.769544005f, 0.512629271f},
-std::array<float,2>{0.733527243f, 0.0137412958f},
-std::array<float,2>{0.292593777f, 0.615400255f},
-std::array<float,2>{0.208769351f, 0.416454405f},
-std::array<float,2>{0.887533247f, 0.928094923f},
-std::array<float,2>{0.842854321f, 0.296330899f},
-std::array<float,2>{0.116808027f, 0.837203026f},
-std::array<float,2>{0.418825179f, 0.203507632f},
-std::array<float,2>{0.553006947f, 0.682096362f},
-std::array<float,2>{0.904500365f, 0.0358715691f},
-std::array<float,2>{0.193535849f, 0.564746618f},
-std::array<float,2>{0.299062431f, 0.400859088f},
-std::array<float,2>{0.743404686f, 0.881708622f},
-std::array<float,2>{0.542649448f, 0.276461035f},
-std::array<float,2>{0.428852051f, 0.871165335f},
-std::array<float,2>{0.0943610966f, 0.233624876f},
-std::array<float,2>{0.815462172f, 0.64035356f},
-std::array<float,2>{0.673178256f, 0.155345231f},
-std::array<float,2>{0.342520893f, 0.743468702f},
-std::array<float,2>{0.162985072f, 0.319834501f},
-std::array<float,2>{0.963496804f, 0.770006001f},
-std::array<float,2>{0.75881058f, 0.457102209f},
-std::array<float,2>{0.0105859935f, 0.940659761f},
-std::array<float,2>{0.442489386f, 0.117936812f},
-std::array<float,2>{0.590446532f, 0.553635657f},
-std::array<float,2>{0.850993335f, 0.191622943f},
-std::array<float,2>{0.0664692149f, 0.656584501f},
-std::array<float,2>{0.392191052f, 0.298425436f},
-std::array<float,2>{0.527360916f, 0.813618958f},
-std::array<float,2>{0.694540679f, 0.429047853f},
-std::array<float,2>{0.261553198f, 0.908167005f},
-std::array<float,2>{0.24905397f, 0.026027726f},
-std::array<float,2>{0.917304635f, 0.59738481f},
-std::array<float,2>{0.611222148f, 0.0931502432f},
-std::array<float,2>{0.492549866f, 0.517271996f},
-std::array<float,2>{0.0466470718f, 0.497417688f},
-std::array<float,2>{0.788268626f, 0.973627985f},
-std::array<float,2>{0.978237092f, 0.351800889f},
-std::array<float,2>{0.148737103f, 0.80893141f},
-std::array<float,2>{0.362944156f, 0.176184654f},
-std::array<float,2>{0.655557275f, 0.706884086f},
-std::array<float,2>{0.793113768f, 0.00994793884f},
-std::array<float,2>{0.036091622f, 0.610428751f},
-std::array<float,2>{0.490601718f, 0.421636075f},
-std::array<float,2>{0.620751262f, 0.924315333f},
-std::array<float,2>{0.641604304f, 0.291807234f},
-std::array<float,2>{0.37301895f, 0.842404127f},
-std::array<float,2>{0.147561267f, 0.209146678f},
-std::array<float,2>{0.972296834f, 0.683597684f},
-std::array<float,2>{0.523060322f, 0.167197421f},
-std::array<float,2>{0.402262896f, 0.700802326f},
-std::array<float,2>{0.0736513212f, 0.361266553f},
-std::array<float,2>{0.858414948f, 0.786678553f},
-std::array<float,2>{0.911948681f, 0.480570942f},
-std::array<float,2>{0.239196092f, 0.991322875f},
-std::array<float,2>{0.257265478f, 0.0647321865f},
-std::array<float,2>{0.699647844f, 0.510593235f},
-std::array<float,2>{0.956844926f, 0.238336086f},
-std::array<float,2>{0.168803975f, 0.641070545f},
-std::array<float,2>{0.334130406f, 0.260095656f},
-std::array<float,2>{0.68500787f, 0.853085637f},
-std::array<float,2>{0.581182182f, 0.389249116f},
-std::array<float,2>{0.448284835f, 0.902318358f},
-std::array<float,2>{0.00670974795f, 0.0483215749f},
-std::array<float,2>{0.755873322f, 0.580704331f},
-std::array<float,2>{0.740940213f, 0.0972636193f},
-std::array<float,2>{0.31109485f, 0.543238223f},
-std::array<float,2>{0.20185259f, 0.447830588f},
-std::array<float,2>{0.898218989f, 0.961849988f},
-std::array<float,2>{0.827754736f, 0.342675626f},
-std::array<float,2>{0.102269478f, 0.75683099f},
-std::array<float,2>{0.434680074f, 0.126922473f},
-std::array<float,2>{0.538674653f, 0.726262212f},
-std::array<float,2>{0.880078018f, 0.0897773877f},
-std::array<float,2>{0.213211417f, 0.522476614f},
-std::array<float,2>{0.2845487f, 0.4957425f},
-std::array<float,2>{0.719424725f, 0.971219957f},
-std::array<float,2>{0.562165439f, 0.357853711f},
-std::array<float,2>{0.408291012f, 0.805442512f},
-std::array<float,2>{0.122853018f, 0.173943013f},
-std::array<float,2>{0.833673f, 0.70977366f},
-std::array<float,2>{0.660847723f, 0.189682886f},
-std::array<float,2>{0.316986114f, 0.660857856f},
-std::array<float,2>{0.179891706f, 0.303122461f},
-std::array<float,2>{0.948924541f, 0.817565441f},
-std::array<float,2>{0.780354202f, 0.424965858f},
-std::array<float,2>{0.0276175365f, 0.912678242f},
-std::array<float,2>{0.459820509f, 0.0285320375f},
-std::array<float,2>{0.565625131f, 0.601141453f},
-std::array<float,2>{0.86779964f, 0.151275381f},
-std::array<float,2>{0.0870564878f, 0.746852875f},
-std::array<float,2>{0.381561488f, 0.314422607f},
-std::array<float,2>{0.511883259f, 0.765974939f},
-std::array<float,2>{0.70638746f, 0.454295546f},
-std::array<float,2>{0.279974729f, 0.941606283f},
-std::array<float,2>{0.223715469f, 0.121386856f},
-std::array<float,2>{0.929000199f, 0.547482014f},
-std::array<float,2>{0.598057985f, 0.0347271301f},
-std::array<float,2>{0.483112872f, 0.567065954f},
-std::array<float,2>{0.0514907986f, 0.405476123f},
-std::array<float,2>{0.800182283f, 0.877402484f},
-std::array<float,2>{0.989425123f, 0.279944927f},
-std::array<float,2>{0.133030906f, 0.871083438f},
-std::array<float,2>{0.345827639f, 0.229958773f},
-std::array<float,2>{0.639977872f, 0.634755015f},
-std::array<float,2>{0.839316249f, 0.109592699f},
-std::array<float,2>{0.110931098f, 0.556717694f},
-std::array<float,2>{0.417263299f, 0.466318816f},
-std::array<float,2>{0.549648583f, 0.949386656f},
-std::array<float,2>{0.727510393f, 0.327637374f},
-std::array<float,2>{0.296069115f, 0.779588819f},
-std::array<float,2>{0.204349875f, 0.14777033f},
-std::array<float,2>{0.885720015f, 0.73794198f},
-std::array<float,2>{0.575547457f, 0.225245744f},
-std::array<float,2>{0.462125182f, 0.627160072f},
-std::array<float,2>{0.0156910401f, 0.266047448f},
-std::array<float,2>{0.767904401f, 0.861443758f},
-std::array<float,2>{0.945111215f, 0.391436249f},
-std::array<float,2>{0.172696322f, 0.886663675f},
-std::array<float,2>{0.326470315f, 0.0418585055f},
-std::array<float,2>{0.670052469f, 0.577461302f},
-std::array<float,2>{0.935660779f, 0.185276031f},
-std::array<float,2>{0.233742923f, 0.717339933f},
-std::array<float,2>{0.272995681f, 0.350092679f},
-std::array<float,2>{0.715409458f, 0.800946116f},
-std::array<float,2>{0.504606009f, 0.491144359f},
-std::array<float,2>{0.384410083f, 0.983566284f},
-std::array<float,2>{0.0857607424f, 0.0802076906f},
-std::array<float,2>{0.866668522f, 0.528249443f},
-std::array<float,2>{0.627333641f, 0.0218256172f},
-std::array<float,2>{0.352302343f, 0.608245432f},
-std::array<float,2>{0.125404537f, 0.436503828f},
-std::array<float,2>{0.99224937f, 0.917922378f},
-std::array<float,2>{0.810237348f, 0.305213839f},
-std::array<float,2>{0.058924228f, 0.825624943f},
-std::array<float,2>{0.476441383f, 0.197851315f},
-std::array<float,2>{0.60891515f, 0.667494178f},
-std::array<float,2>{0.982291222f, 0.0558516346f},
-std::array<float,2>{0.156067401f, 0.593011618f},
-std::array<float,2>{0.366462439f, 0.379698753f},
-std::array<float,2>{0.651344597f, 0.890708625f},
-std::array<float,2>{0.616276801f, 0.252495021f},
-std::array<float,2>{0.499086559f, 0.844720721f},
-std::array<float,2>{0.0401363708f, 0.243075445f},
-std::array<float,2>{0.784200668f, 0.652871668f},
-std::array<float,2>{0.687864065f, 0.138992056f},
-std::array<float,2>{0.265056163f, 0.731152654f},
-std::array<float,2>{0.245843187f, 0.332795531f},
-std::array<float,2>{0.920649171f, 0.765257418f},
-std::array<float,2>{0.84424603f, 0.444832772f},
-std::array<float,2>{0.064896211f, 0.958384335f},
-std::array<float,2>{0.395785272f, 0.108845785f},
-std::array<float,2>{0.523911178f, 0.532695889f},
-std::array<float,2>{0.764735222f, 0.213259026f},
-std::array<float,2>{0.0153045012f, 0.673236489f},
-std::array<float,2>{0.440198779f, 0.285749376f},
-std::array<float,2>{0.589128852f, 0.831748426f},
-std::array<float,2>{0.679620683f, 0.408901602f},
-std::array<float,2>{0.33824712f, 0.934765339f},
-std::array<float,2>{0.159152508f, 0.00622379361f},
-std::array<float,2>{0.968575597f, 0.62264812f},
-std::array<float,2>{0.544110477f, 0.073544465f},
-std::array<float,2>{0.422919989f, 0.50774616f},
-std::array<float,2>{0.0996850505f, 0.472131222f},
-std::array<float,2>{0.819226742f, 0.993175805f},
-std::array<float,2>{0.900011063f, 0.368560165f},
-std::array<float,2>{0.189130977f, 0.793424845f},
-std::array<float,2>{0.30223614f, 0.158167452f},
-std::array<float,2>{0.748512268f, 0.687654197f},
-std::array<float,2>{0.853173971f, 0.0459935702f},
-std::array<float,2>{0.0762616172f, 0.570755184f},
-std::array<float,2>{0.406062603f, 0.396074176f},
-std::array<float,2>{0.51855576f, 0.88703692f},
-std::array<float,2>{0.695776463f, 0.272197753f},
-std::array<float,2>{0.25339976f, 0.863484383f},
-std::array<float,2>{0.237694904f, 0.221094206f},
-std::array<float,2>{0.908338845f, 0.630058646f},
-std::array<float,2>{0.622318447f, 0.141945034f},
-std::array<float,2>{0.485020339f, 0.739704669f},
-std::array<float,2>{0.032609798f, 0.322294533f},
-std::array<float,2>{0.791486621f, 0.775929689f},
-std::array<float,2>{0.973632634f, 0.461898178f},
-std::array<float,2>{0.143624499f, 0.947744131f},
-std::array<float,2>{0.369089723f, 0.115724303f},
-std::array<float,2>{0.645616293f, 0.560691297f},
-std::array<float,2>{0.891429365f, 0.201424658f},
-std::array<float,2>{0.199141219f, 0.670200467f},
-std::array<float,2>{0.307757914f, 0.312247545f},
-std::array<float,2>{0.737630963f, 0.823946357f},
-std::array<float,2>{0.534082472f, 0.430541903f},
-std::array<float,2>{0.432744294f, 0.918432832f},
-std::array<float,2>{0.108784921f, 0.0194022115f},
-std::array<float,2>{0.821641147f, 0.603462994f},
-std::array<float,2>{0.682011187f, 0.0851812288f},
-std::array<float,2>{0.331265539f, 0.523940802f},
-std::array<float,2>{0.164985433f, 0.485098481f},
-std::array<float,2>{0.957715988f, 0.979622543f},
-std::array<float,2>{0.750109792f, 0.344583899f},
-std::array<float,2>{0.00372424f, 0.799894452f},
-std::array<float,2>{0.450345725f, 0.18279025f},
-std::array<float,2>{0.584343076f, 0.714130342f},
-std::array<float,2>{0.950197101f, 0.103106745f},
-std::array<float,2>{0.186889842f, 0.536184549f},
-std::array<float,2>{0.31394431f, 0.438284129f},
-std::array<float,2>{0.657051504f, 0.956623614f},
-std::array<float,2>{0.56826067f, 0.329889446f},
-std::array<float,2>{0.456592321f, 0.75896281f},
-std::array<float,2>{0.0235818364f, 0.135799766f},
-std::array<float,2>{0.776077807f, 0.730382502f},
-std::array<float,2>{0.725991488f, 0.248067498f},
-std::array<float,2>{0.286483318f, 0.649986506f},
-std::array<float,2>{0.21849452f, 0.256450176f},
-std::array<float,2>{0.876868248f, 0.850474954f},
-std::array<float,2>{0.828226328f, 0.378605902f},
-std::array<float,2>{0.118264504f, 0.897073984f},
-std::array<float,2>{0.413004071f, 0.0618684329f},
-std::array<float,2>{0.555986762f, 0.588727355f},
-std::array<float,2>{0.80303359f, 0.163664758f},
-std::array<float,2>{0.0483621508f, 0.692433655f},
-std::array<float,2>{0.47958681f, 0.371327043f},
-std::array<float,2>{0.596386194f, 0.7897138f},
-std::array<float,2>{0.635141432f, 0.475163579f},
-std::array<float,2>{0.349771172f, 0.998664081f},
-std::array<float,2>{0.138601989f, 0.0768372938f},
-std::array<float,2>{0.984377444f, 0.501423717f},
-std::array<float,2>{0.50788641f, 0.00240096659f},
-std::array<float,2>{0.376262695f, 0.618574202f},
-std::array<float,2>{0.0917963833f, 0.413047165f},
-std::array<float,2>{0.871533334f, 0.930532813f},
-std::array<float,2>{0.924300194f, 0.282272786f},
-std::array<float,2>{0.220959336f, 0.835818052f},
-std::array<float,2>{0.274998188f, 0.217742875f},
-std::array<float,2>{0.707396388f, 0.677471757f},
-std::array<float,2>{0.772978902f, 0.0681018382f},
-std::array<float,2>{0.022902919f, 0.514365733f},
-std::array<float,2>{0.465736359f, 0.479535013f},
-std::array<float,2>{0.572261572f, 0.985874772f},
-std::array<float,2>{0.665301085f, 0.363323033f},
-std::array<float,2>{0.323521823f, 0.782575727f},
-std::array<float,2>{0.177441776f, 0.170603409f},
-std::array<float,2>{0.938415051f, 0.69730413f},
-std::array<float,2>{0.551583886f, 0.206716627f},
-std::array<float,2>{0.421058148f, 0.68026346f},
-std::array<float,2>{0.114790708f, 0.293499529f},
-std::array<float,2>{0.840059876f, 0.839572787f},
-std::array<float,2>{0.890606225f, 0.415238142f},
-std::array<float,2>{0.209627286f, 0.927233696f},
-std::array<float,2>{0.289366364f, 0.0121013643f},
-std::array<float,2>{0.732140541f, 0.614891708f},
-std::array<float,2>{0.997136652f, 0.13244395f},
-std::array<float,2>{0.13162455f, 0.721480906f},
-std::array<float,2>{0.357721418f, 0.335940778f},
-std::array<float,2>{0.630017757f, 0.751075566f},
-std::array<float,2>{0.602909088f, 0.449385136f},
-std::array<float,2>{0.469661444f, 0.966178358f},
-std::array<float,2>{0.0550899282f, 0.0980184749f},
-std::array<float,2>{0.805105746f, 0.541592538f},
-std::array<float,2>{0.712947726f, 0.0541867577f},
-std::array<float,2>{0.266324669f, 0.583655834f},
-std::array<float,2>{0.227526277f, 0.383729637f},
-std::array<float,2>{0.931104362f, 0.903516769f},
-std::array<float,2>{0.859509528f, 0.26229161f},
-std::array<float,2>{0.0787029043f, 0.855885625f},
-std::array<float,2>{0.390122801f, 0.236622006f},
-std::array<float,2>{0.502072155f, 0.647803843f},
-std::array<float,2>{0.915164292f, 0.0241783224f},
-std::array<float,2>{0.247498587f, 0.593753636f},
-std::array<float,2>{0.259611815f, 0.42753014f},
-std::array<float,2>{0.693193614f, 0.908840001f},
-std::array<float,2>{0.52952683f, 0.298956484f},
-std::array<float,2>{0.394406646f, 0.814599097f},
-std::array<float,2>{0.069359079f, 0.194835961f},
-std::array<float,2>{0.849279642f, 0.658956468f},
-std::array<float,2>{0.653717995f, 0.177780956f},
-std::array<float,2>{0.360687047f, 0.705056787f},
-std::array<float,2>{0.15172185f, 0.354998618f},
-std::array<float,2>{0.978742599f, 0.811530352f},
-std::array<float,2>{0.786679745f, 0.499253571f},
-std::array<float,2>{0.0448229462f, 0.975556135f},
-std::array<float,2>{0.495040655f, 0.0912777781f},
-std::array<float,2>{0.61173892f, 0.518730998f},
-std::array<float,2>{0.812857926f, 0.230618164f},
-std::array<float,2>{0.0968249589f, 0.637785077f},
-std::array<float,2>{0.427377075f, 0.274114937f},
-std::array<float,2>{0.540016651f, 0.874076843f},
-std::array<float,2>{0.744145215f, 0.400113285f},
-std::array<float,2>{0.298376203f, 0.879538953f},
-std::array<float,2>{0.192082152f, 0.0371915624f},
-std::array<float,2>{0.903263152f, 0.562972426f},
-std::array<float,2>{0.592633724f, 0.11922656f},
-std::array<float,2>{0.444867671f, 0.551126897f},
-std::array<float,2>{0.00875060353f, 0.460849941f},
-std::array<float,2>{0.761349082f, 0.938394427f},
-std::array<float,2>{0.961288452f, 0.317559719f},
-std::array<float,2>{0.160235971f, 0.773173869f},
-std::array<float,2>{0.341114044f, 0.153065264f},
-std::array<float,2>{0.674458325f, 0.744682848f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.0197816156f, 0.790622234f},
-std::array<float,2>{0.815405488f, 0.331204563f},
-std::array<float,2>{0.329348862f, 0.221053064f},
-std::array<float,2>{0.692996442f, 0.703720391f},
-std::array<float,2>{0.401786208f, 0.580756664f},
-std::array<float,2>{0.5269593f, 0.0722003505f},
-std::array<float,2>{0.238114327f, 0.376017421f},
-std::array<float,2>{0.900722265f, 0.987129211f},
-std::array<float,2>{0.179919213f, 0.681953073f},
-std::array<float,2>{0.988847554f, 0.174187094f},
-std::array<float,2>{0.46171841f, 0.274115324f},
-std::array<float,2>{0.565273702f, 0.863180995f},
-std::array<float,2>{0.306138664f, 0.905410945f},
-std::array<float,2>{0.650610566f, 0.459970027f},
-std::array<float,2>{0.0987956002f, 0.00514197769f},
-std::array<float,2>{0.756858766f, 0.529790223f},
-std::array<float,2>{0.199509218f, 0.952635884f},
-std::array<float,2>{0.913627446f, 0.421606749f},
-std::array<float,2>{0.425698489f, 0.0988014489f},
-std::array<float,2>{0.544549644f, 0.620682299f},
-std::array<float,2>{0.349159837f, 0.729355812f},
-std::array<float,2>{0.734994471f, 0.212898582f},
-std::array<float,2>{0.0368073583f, 0.364486217f},
-std::array<float,2>{0.872253835f, 0.764803946f},
-std::array<float,2>{0.066416204f, 0.53317225f},
-std::array<float,2>{0.80812186f, 0.0542681254f},
-std::array<float,2>{0.275118619f, 0.487214953f},
-std::array<float,2>{0.681298971f, 0.915341973f},
-std::array<float,2>{0.475530952f, 0.824356496f},
-std::array<float,2>{0.593808889f, 0.29134798f},
-std::array<float,2>{0.155333281f, 0.130358204f},
-std::array<float,2>{0.968386889f, 0.647559226f},
-std::array<float,2>{0.115010478f, 0.937235713f},
-std::array<float,2>{0.7709288f, 0.479255795f},
-std::array<float,2>{0.283263922f, 0.0442407876f},
-std::array<float,2>{0.632307947f, 0.557738721f},
-std::array<float,2>{0.443329245f, 0.62651509f},
-std::array<float,2>{0.582983017f, 0.154071257f},
-std::array<float,2>{0.163051978f, 0.305974275f},
-std::array<float,2>{0.983787894f, 0.84298718f},
-std::array<float,2>{0.226978391f, 0.596893728f},
-std::array<float,2>{0.883270264f, 0.118781507f},
-std::array<float,2>{0.386614889f, 0.431940526f},
-std::array<float,2>{0.508530617f, 0.965417445f},
-std::array<float,2>{0.324495018f, 0.776818871f},
-std::array<float,2>{0.704023838f, 0.34962374f},
-std::array<float,2>{0.00297785504f, 0.187878624f},
-std::array<float,2>{0.829535007f, 0.736968696f},
-std::array<float,2>{0.132667288f, 0.852398694f},
-std::array<float,2>{0.950081468f, 0.262330115f},
-std::array<float,2>{0.485506415f, 0.15976797f},
-std::array<float,2>{0.624619305f, 0.660604239f},
-std::array<float,2>{0.256453067f, 0.504149616f},
-std::array<float,2>{0.666649044f, 0.0201667249f},
-std::array<float,2>{0.0793879554f, 0.451157212f},
-std::array<float,2>{0.782840729f, 0.883750856f},
-std::array<float,2>{0.0480926782f, 0.693736851f},
-std::array<float,2>{0.854637802f, 0.236413807f},
-std::array<float,2>{0.361639738f, 0.31396836f},
-std::array<float,2>{0.727162063f, 0.805749953f},
-std::array<float,2>{0.420708656f, 0.970312536f},
-std::array<float,2>{0.54797411f, 0.405529171f},
-std::array<float,2>{0.206813395f, 0.0928252861f},
-std::array<float,2>{0.924312651f, 0.572312593f},
-std::array<float,2>{0.0935549811f, 0.834831417f},
-std::array<float,2>{0.79106158f, 0.300569803f},
-std::array<float,2>{0.260255277f, 0.146631837f},
-std::array<float,2>{0.658853531f, 0.635784328f},
-std::array<float,2>{0.495137662f, 0.550796092f},
-std::array<float,2>{0.616873026f, 0.03869785f},
-std::array<float,2>{0.137164101f, 0.471277744f},
-std::array<float,2>{0.942209482f, 0.923716903f},
-std::array<float,2>{0.212631807f, 0.743301928f},
-std::array<float,2>{0.934309542f, 0.19603166f},
-std::array<float,2>{0.410257369f, 0.357286304f},
-std::array<float,2>{0.562170088f, 0.766849577f},
-std::array<float,2>{0.373036027f, 0.953351974f},
-std::array<float,2>{0.72629714f, 0.426648647f},
-std::array<float,2>{0.0622720458f, 0.112931572f},
-std::array<float,2>{0.848646462f, 0.60278213f},
-std::array<float,2>{0.167128354f, 0.875515461f},
-std::array<float,2>{0.969609559f, 0.443658084f},
-std::array<float,2>{0.452498674f, 0.0264762025f},
-std::array<float,2>{0.589814305f, 0.509622812f},
-std::array<float,2>{0.289912164f, 0.665979028f},
-std::array<float,2>{0.638234198f, 0.168040588f},
-std::array<float,2>{0.121725149f, 0.255762428f},
-std::array<float,2>{0.775746405f, 0.850590408f},
-std::array<float,2>{0.00918731466f, 0.563453674f},
-std::array<float,2>{0.837097228f, 0.079190895f},
-std::array<float,2>{0.315326124f, 0.398296595f},
-std::array<float,2>{0.711641371f, 0.977932811f},
-std::array<float,2>{0.382360369f, 0.8029778f},
-std::array<float,2>{0.500704348f, 0.322231531f},
-std::array<float,2>{0.220659584f, 0.249710724f},
-std::array<float,2>{0.878462791f, 0.699265599f},
-std::array<float,2>{0.0405136608f, 0.993462145f},
-std::array<float,2>{0.866801441f, 0.38973406f},
-std::array<float,2>{0.353467405f, 0.0651844889f},
-std::array<float,2>{0.746664882f, 0.586479306f},
-std::array<float,2>{0.430053681f, 0.713438392f},
-std::array<float,2>{0.536043167f, 0.23196198f},
-std::array<float,2>{0.188710794f, 0.342132688f},
-std::array<float,2>{0.919500172f, 0.788251877f},
-std::array<float,2>{0.146951407f, 0.517922997f},
-std::array<float,2>{0.953202248f, 0.00884873699f},
-std::array<float,2>{0.482972652f, 0.461751729f},
-std::array<float,2>{0.607266247f, 0.894371569f},
-std::array<float,2>{0.268672884f, 0.867778182f},
-std::array<float,2>{0.678597033f, 0.266368091f},
-std::array<float,2>{0.0748865008f, 0.180710688f},
-std::array<float,2>{0.802124202f, 0.675390303f},
-std::array<float,2>{0.249039248f, 0.756547272f},
-std::array<float,2>{0.896802783f, 0.371364802f},
-std::array<float,2>{0.396049172f, 0.204035029f},
-std::array<float,2>{0.518695712f, 0.719880581f},
-std::array<float,2>{0.341661036f, 0.617169321f},
-std::array<float,2>{0.695740104f, 0.103348315f},
-std::array<float,2>{0.0256207883f, 0.406316966f},
-std::array<float,2>{0.821075201f, 0.939181328f},
-std::array<float,2>{0.105366245f, 0.650036335f},
-std::array<float,2>{0.762601316f, 0.135549992f},
-std::array<float,2>{0.299478799f, 0.282076567f},
-std::array<float,2>{0.64521724f, 0.814354599f},
-std::array<float,2>{0.460674137f, 0.907551229f},
-std::array<float,2>{0.572280288f, 0.492357135f},
-std::array<float,2>{0.176739872f, 0.0586951897f},
-std::array<float,2>{0.994967282f, 0.5465675f},
-std::array<float,2>{0.0959319994f, 0.770127416f},
-std::array<float,2>{0.750129044f, 0.355078578f},
-std::array<float,2>{0.31083864f, 0.20262447f},
-std::array<float,2>{0.655525804f, 0.74868995f},
-std::array<float,2>{0.465910554f, 0.608560324f},
-std::array<float,2>{0.566593468f, 0.116674095f},
-std::array<float,2>{0.186938003f, 0.425296515f},
-std::array<float,2>{0.986395299f, 0.960688233f},
-std::array<float,2>{0.238940403f, 0.638587177f},
-std::array<float,2>{0.904383779f, 0.142712548f},
-std::array<float,2>{0.406090915f, 0.304206133f},
-std::array<float,2>{0.53041631f, 0.831127405f},
-std::array<float,2>{0.332047343f, 0.926946998f},
-std::array<float,2>{0.689590394f, 0.474831998f},
-std::array<float,2>{0.0163045004f, 0.033852078f},
-std::array<float,2>{0.816550255f, 0.547610521f},
-std::array<float,2>{0.150538355f, 0.982883513f},
-std::array<float,2>{0.962194324f, 0.393739641f},
-std::array<float,2>{0.469649434f, 0.0849509835f},
-std::array<float,2>{0.598316312f, 0.569700003f},
-std::array<float,2>{0.278271019f, 0.695777476f},
-std::array<float,2>{0.6856336f, 0.245058447f},
-std::array<float,2>{0.0649233833f, 0.326099366f},
-std::array<float,2>{0.810354233f, 0.797109067f},
-std::array<float,2>{0.034857031f, 0.51192528f},
-std::array<float,2>{0.870889485f, 0.0307579599f},
-std::array<float,2>{0.345158011f, 0.44116503f},
-std::array<float,2>{0.74082005f, 0.880076289f},
-std::array<float,2>{0.427697122f, 0.845865011f},
-std::array<float,2>{0.53996861f, 0.252033561f},
-std::array<float,2>{0.195378885f, 0.167457685f},
-std::array<float,2>{0.906295419f, 0.669893503f},
-std::array<float,2>{0.00587860728f, 0.897580147f},
-std::array<float,2>{0.832804918f, 0.467556179f},
-std::array<float,2>{0.321140528f, 0.01515829f},
-std::array<float,2>{0.707347691f, 0.522235513f},
-std::array<float,2>{0.387152642f, 0.677803993f},
-std::array<float,2>{0.514089286f, 0.183755964f},
-std::array<float,2>{0.230612889f, 0.270472884f},
-std::array<float,2>{0.887438238f, 0.873653173f},
-std::array<float,2>{0.158644095f, 0.592207491f},
-std::array<float,2>{0.978621364f, 0.0697904602f},
-std::array<float,2>{0.43872425f, 0.38555795f},
-std::array<float,2>{0.579005182f, 0.998653233f},
-std::array<float,2>{0.28623119f, 0.782990098f},
-std::array<float,2>{0.62594521f, 0.336036414f},
-std::array<float,2>{0.110400118f, 0.230013028f},
-std::array<float,2>{0.769483924f, 0.716448069f},
-std::array<float,2>{0.20846276f, 0.818125367f},
-std::array<float,2>{0.92907846f, 0.285393298f},
-std::array<float,2>{0.416684151f, 0.140307397f},
-std::array<float,2>{0.550970793f, 0.655537069f},
-std::array<float,2>{0.365591168f, 0.540873766f},
-std::array<float,2>{0.731425583f, 0.0564503707f},
-std::array<float,2>{0.0536631048f, 0.499114096f},
-std::array<float,2>{0.855695546f, 0.911110282f},
-std::array<float,2>{0.084506236f, 0.723442435f},
-std::array<float,2>{0.78553915f, 0.207409859f},
-std::array<float,2>{0.250365138f, 0.369107306f},
-std::array<float,2>{0.668706119f, 0.750650823f},
-std::array<float,2>{0.490294397f, 0.94455725f},
-std::array<float,2>{0.617806017f, 0.413235128f},
-std::array<float,2>{0.126342714f, 0.108832605f},
-std::array<float,2>{0.945583344f, 0.610569119f},
-std::array<float,2>{0.0575283058f, 0.867033124f},
-std::array<float,2>{0.847163677f, 0.281183094f},
-std::array<float,2>{0.368627787f, 0.177547112f},
-std::array<float,2>{0.718953073f, 0.686691403f},
-std::array<float,2>{0.406612694f, 0.525305212f},
-std::array<float,2>{0.557514966f, 0.00153342308f},
-std::array<float,2>{0.215459988f, 0.453320116f},
-std::array<float,2>{0.932129383f, 0.901560664f},
-std::array<float,2>{0.136518508f, 0.708869696f},
-std::array<float,2>{0.93758291f, 0.223811567f},
-std::array<float,2>{0.498990387f, 0.334128231f},
-std::array<float,2>{0.611495554f, 0.796498179f},
-std::array<float,2>{0.264590085f, 0.989661217f},
-std::array<float,2>{0.663433135f, 0.380677581f},
-std::array<float,2>{0.0868380666f, 0.0773726106f},
-std::array<float,2>{0.794662118f, 0.584598422f},
-std::array<float,2>{0.225716323f, 0.920938551f},
-std::array<float,2>{0.881587625f, 0.489010572f},
-std::array<float,2>{0.375714749f, 0.0482915863f},
-std::array<float,2>{0.506421983f, 0.53626591f},
-std::array<float,2>{0.319874972f, 0.640834868f},
-std::array<float,2>{0.716685772f, 0.128237218f},
-std::array<float,2>{0.0121282907f, 0.293076396f},
-std::array<float,2>{0.841968536f, 0.822533309f},
-std::array<float,2>{0.119668394f, 0.623409867f},
-std::array<float,2>{0.780418813f, 0.0958002284f},
-std::array<float,2>{0.293176264f, 0.415539324f},
-std::array<float,2>{0.634261906f, 0.947073579f},
-std::array<float,2>{0.445912421f, 0.760320842f},
-std::array<float,2>{0.593394637f, 0.362690002f},
-std::array<float,2>{0.168392509f, 0.216211528f},
-std::array<float,2>{0.975231946f, 0.730798781f},
-std::array<float,2>{0.0713791698f, 0.963266134f},
-std::array<float,2>{0.799398363f, 0.435404629f},
-std::array<float,2>{0.27223736f, 0.121698163f},
-std::array<float,2>{0.675259888f, 0.601111829f},
-std::array<float,2>{0.480132967f, 0.739082217f},
-std::array<float,2>{0.601771653f, 0.194844306f},
-std::array<float,2>{0.141266838f, 0.347264588f},
-std::array<float,2>{0.959744573f, 0.781209707f},
-std::array<float,2>{0.193823501f, 0.559450448f},
-std::array<float,2>{0.916010559f, 0.0422712602f},
-std::array<float,2>{0.437109947f, 0.483817071f},
-std::array<float,2>{0.531752706f, 0.931428492f},
-std::array<float,2>{0.358556241f, 0.836716413f},
-std::array<float,2>{0.744150758f, 0.311249316f},
-std::array<float,2>{0.0446564853f, 0.15108639f},
-std::array<float,2>{0.862807989f, 0.629689991f},
-std::array<float,2>{0.175563022f, 0.811040401f},
-std::array<float,2>{0.998812795f, 0.316718608f},
-std::array<float,2>{0.454659402f, 0.24053891f},
-std::array<float,2>{0.578119099f, 0.690859199f},
-std::array<float,2>{0.303484142f, 0.57628566f},
-std::array<float,2>{0.644514561f, 0.0866210237f},
-std::array<float,2>{0.107199103f, 0.398534298f},
-std::array<float,2>{0.760662556f, 0.974241376f},
-std::array<float,2>{0.0305295289f, 0.658450484f},
-std::array<float,2>{0.82435292f, 0.162950426f},
-std::array<float,2>{0.337738782f, 0.258936942f},
-std::array<float,2>{0.700920403f, 0.857364833f},
-std::array<float,2>{0.39319998f, 0.888358116f},
-std::array<float,2>{0.520739079f, 0.446148127f},
-std::array<float,2>{0.244548336f, 0.016649209f},
-std::array<float,2>{0.891286433f, 0.502883911f},
-std::array<float,2>{0.038225852f, 0.763017654f},
-std::array<float,2>{0.87470001f, 0.366198868f},
-std::array<float,2>{0.349936962f, 0.211971492f},
-std::array<float,2>{0.736366212f, 0.728202105f},
-std::array<float,2>{0.423063219f, 0.617853522f},
-std::array<float,2>{0.545512199f, 0.0997741297f},
-std::array<float,2>{0.203030631f, 0.418290973f},
-std::array<float,2>{0.910440087f, 0.950621903f},
-std::array<float,2>{0.152769178f, 0.645802379f},
-std::array<float,2>{0.964995682f, 0.131371364f},
-std::array<float,2>{0.474467367f, 0.290213883f},
-std::array<float,2>{0.595727146f, 0.827264786f},
-std::array<float,2>{0.277016819f, 0.916899264f},
-std::array<float,2>{0.681853592f, 0.486184329f},
-std::array<float,2>{0.0692461804f, 0.052081883f},
-std::array<float,2>{0.805018067f, 0.534084857f},
-std::array<float,2>{0.23573786f, 0.985367477f},
-std::array<float,2>{0.899588227f, 0.378170639f},
-std::array<float,2>{0.399201334f, 0.072336942f},
-std::array<float,2>{0.524688423f, 0.579650342f},
-std::array<float,2>{0.331511825f, 0.7054407f},
-std::array<float,2>{0.694712102f, 0.219300374f},
-std::array<float,2>{0.0227541514f, 0.32987842f},
-std::array<float,2>{0.813809097f, 0.79254359f},
-std::array<float,2>{0.101063684f, 0.528916597f},
-std::array<float,2>{0.754174709f, 0.00690980582f},
-std::array<float,2>{0.307641864f, 0.457369477f},
-std::array<float,2>{0.649555445f, 0.902865171f},
-std::array<float,2>{0.464137048f, 0.860844195f},
-std::array<float,2>{0.563279927f, 0.275824428f},
-std::array<float,2>{0.183141842f, 0.17331259f},
-std::array<float,2>{0.991497517f, 0.679895699f},
-std::array<float,2>{0.0802653804f, 0.885401487f},
-std::array<float,2>{0.783562541f, 0.451777518f},
-std::array<float,2>{0.25450936f, 0.0232124552f},
-std::array<float,2>{0.665238321f, 0.506995916f},
-std::array<float,2>{0.488142908f, 0.662376523f},
-std::array<float,2>{0.622600377f, 0.157835066f},
-std::array<float,2>{0.130582124f, 0.264281243f},
-std::array<float,2>{0.951295733f, 0.855192184f},
-std::array<float,2>{0.203968838f, 0.571857154f},
-std::array<float,2>{0.922374845f, 0.0908096656f},
-std::array<float,2>{0.419169605f, 0.402782351f},
-std::array<float,2>{0.549059629f, 0.972293377f},
-std::array<float,2>{0.360172689f, 0.807666481f},
-std::array<float,2>{0.730042338f, 0.314917058f},
-std::array<float,2>{0.0502016433f, 0.234918579f},
-std::array<float,2>{0.853229821f, 0.691756368f},
-std::array<float,2>{0.161009058f, 0.840361297f},
-std::array<float,2>{0.980742514f, 0.307807416f},
-std::array<float,2>{0.444087952f, 0.155356213f},
-std::array<float,2>{0.584638715f, 0.62818563f},
-std::array<float,2>{0.282730281f, 0.556614161f},
-std::array<float,2>{0.629373491f, 0.0460349992f},
-std::array<float,2>{0.116687886f, 0.478275478f},
-std::array<float,2>{0.772480786f, 0.934974015f},
-std::array<float,2>{0.00171764439f, 0.735196173f},
-std::array<float,2>{0.831299067f, 0.190339833f},
-std::array<float,2>{0.326200753f, 0.347769558f},
-std::array<float,2>{0.706675053f, 0.775358558f},
-std::array<float,2>{0.383348197f, 0.96871537f},
-std::array<float,2>{0.51151228f, 0.429707259f},
-std::array<float,2>{0.229662329f, 0.120000906f},
-std::array<float,2>{0.885526896f, 0.59404248f},
-std::array<float,2>{0.124116816f, 0.848667383f},
-std::array<float,2>{0.774537802f, 0.257127792f},
-std::array<float,2>{0.291635603f, 0.171863601f},
-std::array<float,2>{0.639131367f, 0.667267263f},
-std::array<float,2>{0.450590938f, 0.510186434f},
-std::array<float,2>{0.587839305f, 0.0241433959f},
-std::array<float,2>{0.165321827f, 0.441448808f},
-std::array<float,2>{0.97151798f, 0.87868917f},
-std::array<float,2>{0.221246988f, 0.702121139f},
-std::array<float,2>{0.876836121f, 0.246898592f},
-std::array<float,2>{0.379159719f, 0.323955625f},
-std::array<float,2>{0.502221942f, 0.801095724f},
-std::array<float,2>{0.314034134f, 0.979291379f},
-std::array<float,2>{0.714379549f, 0.395423532f},
-std::array<float,2>{0.011102031f, 0.0803417191f},
-std::array<float,2>{0.838904262f, 0.565390766f},
-std::array<float,2>{0.139093667f, 0.925206125f},
-std::array<float,2>{0.944328845f, 0.469827265f},
-std::array<float,2>{0.492278218f, 0.0366258584f},
-std::array<float,2>{0.615134299f, 0.552951157f},
-std::array<float,2>{0.259528935f, 0.634248137f},
-std::array<float,2>{0.656959653f, 0.144872144f},
-std::array<float,2>{0.0906447694f, 0.297609061f},
-std::array<float,2>{0.790651739f, 0.832966566f},
-std::array<float,2>{0.0602788702f, 0.603630364f},
-std::array<float,2>{0.849619567f, 0.110178068f},
-std::array<float,2>{0.373250604f, 0.428555071f},
-std::array<float,2>{0.72417891f, 0.955664635f},
-std::array<float,2>{0.413355887f, 0.7690745f},
-std::array<float,2>{0.559884071f, 0.357441455f},
-std::array<float,2>{0.213324085f, 0.197367817f},
-std::array<float,2>{0.936184824f, 0.745334744f},
-std::array<float,2>{0.0252119377f, 0.939765692f},
-std::array<float,2>{0.822581649f, 0.409531742f},
-std::array<float,2>{0.343656182f, 0.103612594f},
-std::array<float,2>{0.699107826f, 0.614126384f},
-std::array<float,2>{0.397306591f, 0.720932007f},
-std::array<float,2>{0.517224729f, 0.205884814f},
-std::array<float,2>{0.246523097f, 0.374308139f},
-std::array<float,2>{0.896225572f, 0.754103124f},
-std::array<float,2>{0.179168433f, 0.543423712f},
-std::array<float,2>{0.994004011f, 0.0616653562f},
-std::array<float,2>{0.45832631f, 0.495244682f},
-std::array<float,2>{0.570530295f, 0.908632219f},
-std::array<float,2>{0.297122866f, 0.816033125f},
-std::array<float,2>{0.647597611f, 0.284650564f},
-std::array<float,2>{0.102137096f, 0.134559751f},
-std::array<float,2>{0.765180647f, 0.651195645f},
-std::array<float,2>{0.189629257f, 0.785560906f},
-std::array<float,2>{0.920878232f, 0.340413839f},
-std::array<float,2>{0.432768106f, 0.23262836f},
-std::array<float,2>{0.53889817f, 0.711298823f},
-std::array<float,2>{0.354675829f, 0.588401973f},
-std::array<float,2>{0.749300957f, 0.0628360286f},
-std::array<float,2>{0.0421775356f, 0.387625903f},
-std::array<float,2>{0.864784062f, 0.994430125f},
-std::array<float,2>{0.0778949782f, 0.672516108f},
-std::array<float,2>{0.804001033f, 0.182630807f},
-std::array<float,2>{0.267344028f, 0.268647075f},
-std::array<float,2>{0.676961958f, 0.870859563f},
-std::array<float,2>{0.481376231f, 0.89150697f},
-std::array<float,2>{0.607729912f, 0.464355379f},
-std::array<float,2>{0.14502497f, 0.0103873564f},
-std::array<float,2>{0.955575347f, 0.51742202f},
-std::array<float,2>{0.0639802739f, 0.800227046f},
-std::array<float,2>{0.811972737f, 0.327976108f},
-std::array<float,2>{0.281050652f, 0.24220039f},
-std::array<float,2>{0.684907317f, 0.69849205f},
-std::array<float,2>{0.470727235f, 0.567318678f},
-std::array<float,2>{0.600295901f, 0.0832834989f},
-std::array<float,2>{0.150301591f, 0.392291456f},
-std::array<float,2>{0.963897526f, 0.981151462f},
-std::array<float,2>{0.197460175f, 0.671442986f},
-std::array<float,2>{0.909197688f, 0.164932713f},
-std::array<float,2>{0.428526133f, 0.251950502f},
-std::array<float,2>{0.542296827f, 0.84514147f},
-std::array<float,2>{0.346785009f, 0.881939411f},
-std::array<float,2>{0.738642812f, 0.438371152f},
-std::array<float,2>{0.0323781595f, 0.0289689805f},
-std::array<float,2>{0.868486226f, 0.515249014f},
-std::array<float,2>{0.184327766f, 0.957823932f},
-std::array<float,2>{0.985261559f, 0.423704267f},
-std::array<float,2>{0.467915475f, 0.114878833f},
-std::array<float,2>{0.570286274f, 0.607121646f},
-std::array<float,2>{0.309371084f, 0.747341514f},
-std::array<float,2>{0.652692378f, 0.199770987f},
-std::array<float,2>{0.0949509367f, 0.353158772f},
-std::array<float,2>{0.752071261f, 0.771964252f},
-std::array<float,2>{0.0187602323f, 0.549040794f},
-std::array<float,2>{0.81857115f, 0.0313374996f},
-std::array<float,2>{0.334227562f, 0.473540783f},
-std::array<float,2>{0.688174009f, 0.928111434f},
-std::array<float,2>{0.402629793f, 0.829412997f},
-std::array<float,2>{0.528680265f, 0.301353812f},
-std::array<float,2>{0.24070704f, 0.141772822f},
-std::array<float,2>{0.902458847f, 0.638765097f},
-std::array<float,2>{0.0517867953f, 0.912498415f},
-std::array<float,2>{0.859051704f, 0.49801904f},
-std::array<float,2>{0.363890111f, 0.0583678335f},
-std::array<float,2>{0.732724607f, 0.541990578f},
-std::array<float,2>{0.41512534f, 0.653389037f},
-std::array<float,2>{0.553197205f, 0.138559163f},
-std::array<float,2>{0.209131896f, 0.288162768f},
-std::array<float,2>{0.926977277f, 0.820070148f},
-std::array<float,2>{0.128700063f, 0.612047255f},
-std::array<float,2>{0.947974861f, 0.106907271f},
-std::array<float,2>{0.489250958f, 0.411500096f},
-std::array<float,2>{0.619417012f, 0.942226946f},
-std::array<float,2>{0.25278914f, 0.752029657f},
-std::array<float,2>{0.671788096f, 0.370352715f},
-std::array<float,2>{0.0835991576f, 0.21026209f},
-std::array<float,2>{0.787796378f, 0.724852741f},
-std::array<float,2>{0.233846337f, 0.872253358f},
-std::array<float,2>{0.89006567f, 0.273021936f},
-std::array<float,2>{0.389914155f, 0.186346427f},
-std::array<float,2>{0.512268782f, 0.676423252f},
-std::array<float,2>{0.323462874f, 0.521126688f},
-std::array<float,2>{0.709721208f, 0.0134764072f},
-std::array<float,2>{0.00561270444f, 0.46671927f},
-std::array<float,2>{0.835626602f, 0.89462465f},
-std::array<float,2>{0.112269863f, 0.71736449f},
-std::array<float,2>{0.765846729f, 0.226998463f},
-std::array<float,2>{0.28814593f, 0.338914335f},
-std::array<float,2>{0.628808737f, 0.784147084f},
-std::array<float,2>{0.439768285f, 0.997823238f},
-std::array<float,2>{0.580798507f, 0.384604603f},
-std::array<float,2>{0.157064632f, 0.0666544661f},
-std::array<float,2>{0.976643801f, 0.590165257f},
-std::array<float,2>{0.0150293121f, 0.821152329f},
-std::array<float,2>{0.840681255f, 0.296595335f},
-std::array<float,2>{0.317165256f, 0.125580832f},
-std::array<float,2>{0.718200088f, 0.643871069f},
-std::array<float,2>{0.377248585f, 0.537252367f},
-std::array<float,2>{0.505224586f, 0.0501195639f},
-std::array<float,2>{0.223754317f, 0.490944445f},
-std::array<float,2>{0.879992664f, 0.919373453f},
-std::array<float,2>{0.171227172f, 0.7332654f},
-std::array<float,2>{0.974068701f, 0.218251824f},
-std::array<float,2>{0.448905468f, 0.36123696f},
-std::array<float,2>{0.591282368f, 0.758833289f},
-std::array<float,2>{0.294932187f, 0.947825789f},
-std::array<float,2>{0.636143923f, 0.417614907f},
-std::array<float,2>{0.118902236f, 0.095453009f},
-std::array<float,2>{0.77897507f, 0.622841716f},
-std::array<float,2>{0.217796609f, 0.900037408f},
-std::array<float,2>{0.929757237f, 0.45579356f},
-std::array<float,2>{0.408924311f, 0.00247773854f},
-std::array<float,2>{0.556510031f, 0.526662767f},
-std::array<float,2>{0.371000558f, 0.684323728f},
-std::array<float,2>{0.721484005f, 0.179147303f},
-std::array<float,2>{0.0555174574f, 0.278735429f},
-std::array<float,2>{0.844647467f, 0.864216864f},
-std::array<float,2>{0.0892290473f, 0.58261764f},
-std::array<float,2>{0.7964589f, 0.0744811893f},
-std::array<float,2>{0.263082415f, 0.381543219f},
-std::array<float,2>{0.660439312f, 0.990493178f},
-std::array<float,2>{0.496236175f, 0.793957412f},
-std::array<float,2>{0.609978259f, 0.333154857f},
-std::array<float,2>{0.134246275f, 0.225738049f},
-std::array<float,2>{0.939977646f, 0.710185051f},
-std::array<float,2>{0.107527353f, 0.976367474f},
-std::array<float,2>{0.759721279f, 0.400739491f},
-std::array<float,2>{0.301522493f, 0.0889046341f},
-std::array<float,2>{0.640751779f, 0.574289978f},
-std::array<float,2>{0.456371069f, 0.687829137f},
-std::array<float,2>{0.574410319f, 0.23982875f},
-std::array<float,2>{0.172838598f, 0.318421364f},
-std::array<float,2>{0.997316658f, 0.810480237f},
-std::array<float,2>{0.24374795f, 0.50104624f},
-std::array<float,2>{0.893698514f, 0.0180842578f},
-std::array<float,2>{0.391134769f, 0.448209584f},
-std::array<float,2>{0.522202551f, 0.889304817f},
-std::array<float,2>{0.338055253f, 0.859007955f},
-std::array<float,2>{0.701316118f, 0.261652827f},
-std::array<float,2>{0.0288712904f, 0.162002325f},
-std::array<float,2>{0.82720983f, 0.656275749f},
-std::array<float,2>{0.144425839f, 0.777847826f},
-std::array<float,2>{0.958272636f, 0.34387216f},
-std::array<float,2>{0.476996541f, 0.193086937f},
-std::array<float,2>{0.604786098f, 0.742058754f},
-std::array<float,2>{0.270437509f, 0.598807931f},
-std::array<float,2>{0.673658192f, 0.124084577f},
-std::array<float,2>{0.0738180503f, 0.436699331f},
-std::array<float,2>{0.798784733f, 0.962562442f},
-std::array<float,2>{0.045973368f, 0.631802976f},
-std::array<float,2>{0.860545576f, 0.149516389f},
-std::array<float,2>{0.357306391f, 0.310165226f},
-std::array<float,2>{0.743526757f, 0.838799119f},
-std::array<float,2>{0.434446216f, 0.932587624f},
-std::array<float,2>{0.534003317f, 0.482215494f},
-std::array<float,2>{0.192697108f, 0.0404033437f},
-std::array<float,2>{0.91699779f, 0.560808301f},
-std::array<float,2>{0.00235982565f, 0.773737848f},
-std::array<float,2>{0.828812838f, 0.349575162f},
-std::array<float,2>{0.325538069f, 0.190801516f},
-std::array<float,2>{0.704142034f, 0.735820532f},
-std::array<float,2>{0.38563782f, 0.595248938f},
-std::array<float,2>{0.509529948f, 0.120582581f},
-std::array<float,2>{0.228001952f, 0.430883467f},
-std::array<float,2>{0.884066343f, 0.967093766f},
-std::array<float,2>{0.163397163f, 0.627375603f},
-std::array<float,2>{0.98262161f, 0.154433846f},
-std::array<float,2>{0.441450208f, 0.307136387f},
-std::array<float,2>{0.583542109f, 0.84156841f},
-std::array<float,2>{0.284981966f, 0.934508562f},
-std::array<float,2>{0.631722629f, 0.476995021f},
-std::array<float,2>{0.1132816f, 0.0455450192f},
-std::array<float,2>{0.769692481f, 0.555012763f},
-std::array<float,2>{0.205605641f, 0.970944583f},
-std::array<float,2>{0.925661266f, 0.403456688f},
-std::array<float,2>{0.421476275f, 0.090828225f},
-std::array<float,2>{0.547325134f, 0.570466995f},
-std::array<float,2>{0.363033503f, 0.692807436f},
-std::array<float,2>{0.727698207f, 0.235375091f},
-std::array<float,2>{0.0475567505f, 0.316357166f},
-std::array<float,2>{0.854332089f, 0.807335913f},
-std::array<float,2>{0.0783764124f, 0.506534457f},
-std::array<float,2>{0.78126663f, 0.0220571477f},
-std::array<float,2>{0.257356524f, 0.452574044f},
-std::array<float,2>{0.667755246f, 0.886422098f},
-std::array<float,2>{0.484560698f, 0.853900552f},
-std::array<float,2>{0.623112679f, 0.264670432f},
-std::array<float,2>{0.131764144f, 0.156870261f},
-std::array<float,2>{0.951025128f, 0.663972199f},
-std::array<float,2>{0.097669743f, 0.903888047f},
-std::array<float,2>{0.756007433f, 0.458800018f},
-std::array<float,2>{0.305092692f, 0.00596986758f},
-std::array<float,2>{0.652214587f, 0.527409852f},
-std::array<float,2>{0.462633967f, 0.680884182f},
-std::array<float,2>{0.566287875f, 0.172281116f},
-std::array<float,2>{0.181338653f, 0.276795536f},
-std::array<float,2>{0.98949641f, 0.860218644f},
-std::array<float,2>{0.236531243f, 0.578169763f},
-std::array<float,2>{0.901567221f, 0.0737477168f},
-std::array<float,2>{0.400750458f, 0.377368808f},
-std::array<float,2>{0.525934041f, 0.985039532f},
-std::array<float,2>{0.329008818f, 0.791449785f},
-std::array<float,2>{0.692110837f, 0.328193963f},
-std::array<float,2>{0.0210559741f, 0.220426068f},
-std::array<float,2>{0.815545797f, 0.706568122f},
-std::array<float,2>{0.154539078f, 0.826540887f},
-std::array<float,2>{0.967265844f, 0.289354503f},
-std::array<float,2>{0.476507068f, 0.131923333f},
-std::array<float,2>{0.595664144f, 0.645360708f},
-std::array<float,2>{0.274024636f, 0.534856796f},
-std::array<float,2>{0.680336535f, 0.0511373244f},
-std::array<float,2>{0.0683037117f, 0.48445031f},
-std::array<float,2>{0.807422638f, 0.917283237f},
-std::array<float,2>{0.0354057066f, 0.72730577f},
-std::array<float,2>{0.871714473f, 0.211461723f},
-std::array<float,2>{0.348106772f, 0.366683632f},
-std::array<float,2>{0.735538125f, 0.761964858f},
-std::array<float,2>{0.424096256f, 0.949473262f},
-std::array<float,2>{0.543179929f, 0.418962896f},
-std::array<float,2>{0.200265855f, 0.101444632f},
-std::array<float,2>{0.912859261f, 0.618896723f},
-std::array<float,2>{0.0757061988f, 0.869250417f},
-std::array<float,2>{0.801536739f, 0.267806798f},
-std::array<float,2>{0.268441617f, 0.18228732f},
-std::array<float,2>{0.679172933f, 0.672886193f},
-std::array<float,2>{0.484046876f, 0.516459107f},
-std::array<float,2>{0.605759084f, 0.011314895f},
-std::array<float,2>{0.147543579f, 0.463646919f},
-std::array<float,2>{0.95480597f, 0.892155409f},
-std::array<float,2>{0.187690347f, 0.711998999f},
-std::array<float,2>{0.91874826f, 0.234056771f},
-std::array<float,2>{0.431312203f, 0.341041625f},
-std::array<float,2>{0.536338329f, 0.786203802f},
-std::array<float,2>{0.351830423f, 0.995977521f},
-std::array<float,2>{0.747493386f, 0.388449609f},
-std::array<float,2>{0.0391127095f, 0.0640793145f},
-std::array<float,2>{0.865276337f, 0.5890311f},
-std::array<float,2>{0.17720969f, 0.909467518f},
-std::array<float,2>{0.995714724f, 0.49454096f},
-std::array<float,2>{0.459100038f, 0.0609545894f},
-std::array<float,2>{0.5737679f, 0.54468435f},
-std::array<float,2>{0.300054997f, 0.651439369f},
-std::array<float,2>{0.64615047f, 0.133261815f},
-std::array<float,2>{0.104106031f, 0.283218801f},
-std::array<float,2>{0.762996137f, 0.814614534f},
-std::array<float,2>{0.0268772095f, 0.615071535f},
-std::array<float,2>{0.822175562f, 0.105310835f},
-std::array<float,2>{0.340610623f, 0.408517301f},
-std::array<float,2>{0.696988106f, 0.940848291f},
-std::array<float,2>{0.395010501f, 0.755738318f},
-std::array<float,2>{0.518115938f, 0.373659372f},
-std::array<float,2>{0.248750374f, 0.206774533f},
-std::array<float,2>{0.897821426f, 0.721869648f},
-std::array<float,2>{0.061302077f, 0.956667721f},
-std::array<float,2>{0.847873449f, 0.429242849f},
-std::array<float,2>{0.371814966f, 0.110481754f},
-std::array<float,2>{0.724781513f, 0.60482657f},
-std::array<float,2>{0.411576897f, 0.744180858f},
-std::array<float,2>{0.561341584f, 0.198320702f},
-std::array<float,2>{0.211523175f, 0.358668953f},
-std::array<float,2>{0.935501099f, 0.768552065f},
-std::array<float,2>{0.137932435f, 0.55393225f},
-std::array<float,2>{0.942629039f, 0.0357851349f},
-std::array<float,2>{0.494747967f, 0.469384313f},
-std::array<float,2>{0.615547895f, 0.924596369f},
-std::array<float,2>{0.261104047f, 0.833123088f},
-std::array<float,2>{0.659324586f, 0.298008204f},
-std::array<float,2>{0.0919905826f, 0.146033704f},
-std::array<float,2>{0.792261362f, 0.633536994f},
-std::array<float,2>{0.219636545f, 0.802605867f},
-std::array<float,2>{0.877380013f, 0.322876811f},
-std::array<float,2>{0.381748319f, 0.247579381f},
-std::array<float,2>{0.501545668f, 0.70305562f},
-std::array<float,2>{0.315832853f, 0.565488994f},
-std::array<float,2>{0.712129951f, 0.0819085091f},
-std::array<float,2>{0.00830429699f, 0.395653576f},
-std::array<float,2>{0.836867094f, 0.980262518f},
-std::array<float,2>{0.122599639f, 0.666487694f},
-std::array<float,2>{0.777202129f, 0.170541406f},
-std::array<float,2>{0.290271163f, 0.256337404f},
-std::array<float,2>{0.636829793f, 0.847818196f},
-std::array<float,2>{0.451538026f, 0.877753556f},
-std::array<float,2>{0.588763237f, 0.442929864f},
-std::array<float,2>{0.166779801f, 0.0253227539f},
-std::array<float,2>{0.970240414f, 0.511685014f},
-std::array<float,2>{0.110334434f, 0.784750879f},
-std::array<float,2>{0.768124402f, 0.338794768f},
-std::array<float,2>{0.285889834f, 0.227621406f},
-std::array<float,2>{0.62618655f, 0.718629718f},
-std::array<float,2>{0.437665343f, 0.591749966f},
-std::array<float,2>{0.579204857f, 0.0678599253f},
-std::array<float,2>{0.159524038f, 0.383659869f},
-std::array<float,2>{0.980239213f, 0.9970662f},
-std::array<float,2>{0.231886953f, 0.677177131f},
-std::array<float,2>{0.888561845f, 0.186766177f},
-std::array<float,2>{0.388038725f, 0.272440612f},
-std::array<float,2>{0.515394926f, 0.871451139f},
-std::array<float,2>{0.32138133f, 0.89557755f},
-std::array<float,2>{0.708451331f, 0.465366572f},
-std::array<float,2>{0.00731325988f, 0.0124744717f},
-std::array<float,2>{0.833262026f, 0.519864142f},
-std::array<float,2>{0.125424206f, 0.943335414f},
-std::array<float,2>{0.94691211f, 0.41038537f},
-std::array<float,2>{0.491542786f, 0.106136449f},
-std::array<float,2>{0.618776381f, 0.612763047f},
-std::array<float,2>{0.251858026f, 0.726249874f},
-std::array<float,2>{0.669437051f, 0.209887549f},
-std::array<float,2>{0.084973909f, 0.369410247f},
-std::array<float,2>{0.786166251f, 0.753625095f},
-std::array<float,2>{0.0541931242f, 0.542418897f},
-std::array<float,2>{0.856493533f, 0.0571684986f},
-std::array<float,2>{0.366383076f, 0.496407628f},
-std::array<float,2>{0.732235789f, 0.913976669f},
-std::array<float,2>{0.417241812f, 0.818519592f},
-std::array<float,2>{0.551946521f, 0.287734181f},
-std::array<float,2>{0.207351729f, 0.136838481f},
-std::array<float,2>{0.92778784f, 0.652846575f},
-std::array<float,2>{0.0167937595f, 0.92941165f},
-std::array<float,2>{0.817491472f, 0.474561304f},
-std::array<float,2>{0.33373189f, 0.0328861587f},
-std::array<float,2>{0.691122532f, 0.549987495f},
-std::array<float,2>{0.405123442f, 0.640607178f},
-std::array<float,2>{0.529389739f, 0.141200662f},
-std::array<float,2>{0.239261732f, 0.301834732f},
-std::array<float,2>{0.905312896f, 0.82815063f},
-std::array<float,2>{0.18609871f, 0.606080234f},
-std::array<float,2>{0.987305343f, 0.113663472f},
-std::array<float,2>{0.465398461f, 0.422783971f},
-std::array<float,2>{0.567795873f, 0.95827055f},
-std::array<float,2>{0.311803341f, 0.772913694f},
-std::array<float,2>{0.654327512f, 0.352422059f},
-std::array<float,2>{0.096852988f, 0.200764194f},
-std::array<float,2>{0.751331389f, 0.746687531f},
-std::array<float,2>{0.196730524f, 0.844396055f},
-std::array<float,2>{0.907431424f, 0.25007236f},
-std::array<float,2>{0.426272273f, 0.16589199f},
-std::array<float,2>{0.540164351f, 0.669938564f},
-std::array<float,2>{0.343962967f, 0.514524221f},
-std::array<float,2>{0.742064536f, 0.0274562184f},
-std::array<float,2>{0.0340491012f, 0.439179003f},
-std::array<float,2>{0.869760454f, 0.881017864f},
-std::array<float,2>{0.0654916763f, 0.697566628f},
-std::array<float,2>{0.809145808f, 0.243512899f},
-std::array<float,2>{0.278388679f, 0.326476842f},
-std::array<float,2>{0.686555922f, 0.799412906f},
-std::array<float,2>{0.470689595f, 0.981990457f},
-std::array<float,2>{0.598945022f, 0.391527057f},
-std::array<float,2>{0.151681319f, 0.0822390616f},
-std::array<float,2>{0.961293578f, 0.56829524f},
-std::array<float,2>{0.0433480442f, 0.839004815f},
-std::array<float,2>{0.86212033f, 0.309069157f},
-std::array<float,2>{0.357786804f, 0.149162635f},
-std::array<float,2>{0.745781541f, 0.632083416f},
-std::array<float,2>{0.436055392f, 0.561757147f},
-std::array<float,2>{0.532980442f, 0.0395171344f},
-std::array<float,2>{0.194443449f, 0.480799705f},
-std::array<float,2>{0.914392471f, 0.933494091f},
-std::array<float,2>{0.142395809f, 0.741090178f},
-std::array<float,2>{0.959970474f, 0.192258433f},
-std::array<float,2>{0.479317069f, 0.345366657f},
-std::array<float,2>{0.602594018f, 0.778722525f},
-std::array<float,2>{0.273259073f, 0.961422145f},
-std::array<float,2>{0.674089134f, 0.436040461f},
-std::array<float,2>{0.0712053478f, 0.123634055f},
-std::array<float,2>{0.799940884f, 0.598432302f},
-std::array<float,2>{0.245594099f, 0.890193462f},
-std::array<float,2>{0.891671538f, 0.448777586f},
-std::array<float,2>{0.394149989f, 0.0191061553f},
-std::array<float,2>{0.519803107f, 0.500143945f},
-std::array<float,2>{0.336171836f, 0.658113658f},
-std::array<float,2>{0.699765861f, 0.16066362f},
-std::array<float,2>{0.0298301224f, 0.259875774f},
-std::array<float,2>{0.825746477f, 0.85779351f},
-std::array<float,2>{0.105770968f, 0.576128244f},
-std::array<float,2>{0.761360288f, 0.0888027176f},
-std::array<float,2>{0.303998262f, 0.401816428f},
-std::array<float,2>{0.642722964f, 0.975308359f},
-std::array<float,2>{0.453734308f, 0.808880031f},
-std::array<float,2>{0.577127635f, 0.319445014f},
-std::array<float,2>{0.174468562f, 0.239094734f},
-std::array<float,2>{0.999817371f, 0.689197123f},
-std::array<float,2>{0.0870310664f, 0.991969705f},
-std::array<float,2>{0.793718457f, 0.382344991f},
-std::array<float,2>{0.264811307f, 0.075664565f},
-std::array<float,2>{0.663016438f, 0.583099842f},
-std::array<float,2>{0.49922961f, 0.709147453f},
-std::array<float,2>{0.612800241f, 0.225080222f},
-std::array<float,2>{0.135312438f, 0.332741261f},
-std::array<float,2>{0.938782036f, 0.793288708f},
-std::array<float,2>{0.216310382f, 0.525901914f},
-std::array<float,2>{0.933137238f, 0.00297627831f},
-std::array<float,2>{0.408057004f, 0.456071258f},
-std::array<float,2>{0.558036864f, 0.898615718f},
-std::array<float,2>{0.367533714f, 0.864869118f},
-std::array<float,2>{0.720125735f, 0.27796039f},
-std::array<float,2>{0.0585599691f, 0.177806631f},
-std::array<float,2>{0.846350253f, 0.685199916f},
-std::array<float,2>{0.169152707f, 0.757816017f},
-std::array<float,2>{0.976101816f, 0.359741241f},
-std::array<float,2>{0.446356684f, 0.217050105f},
-std::array<float,2>{0.592650354f, 0.733895779f},
-std::array<float,2>{0.293965042f, 0.621782422f},
-std::array<float,2>{0.633003175f, 0.0939086452f},
-std::array<float,2>{0.120882183f, 0.416744441f},
-std::array<float,2>{0.779729247f, 0.949165404f},
-std::array<float,2>{0.012847566f, 0.64271003f},
-std::array<float,2>{0.843719661f, 0.126585111f},
-std::array<float,2>{0.318608701f, 0.295413822f},
-std::array<float,2>{0.715049148f, 0.822026014f},
-std::array<float,2>{0.376384109f, 0.918183744f},
-std::array<float,2>{0.506934583f, 0.491880447f},
-std::array<float,2>{0.22551696f, 0.0492727123f},
-std::array<float,2>{0.88205862f, 0.53864491f},
-std::array<float,2>{0.0492723435f, 0.804902315f},
-std::array<float,2>{0.852071404f, 0.312754929f},
-std::array<float,2>{0.360665768f, 0.237474814f},
-std::array<float,2>{0.728534818f, 0.694581032f},
-std::array<float,2>{0.418730557f, 0.573555231f},
-std::array<float,2>{0.55052948f, 0.0925993249f},
-std::array<float,2>{0.204848379f, 0.404693097f},
-std::array<float,2>{0.923665464f, 0.969304562f},
-std::array<float,2>{0.129333302f, 0.661338031f},
-std::array<float,2>{0.952759862f, 0.158972621f},
-std::array<float,2>{0.48690027f, 0.262755007f},
-std::array<float,2>{0.621339917f, 0.853236616f},
-std::array<float,2>{0.255630225f, 0.883842349f},
-std::array<float,2>{0.664654434f, 0.449865431f},
-std::array<float,2>{0.0817661658f, 0.0212447084f},
-std::array<float,2>{0.784309208f, 0.505680084f},
-std::array<float,2>{0.229353353f, 0.966255069f},
-std::array<float,2>{0.885777712f, 0.43323037f},
-std::array<float,2>{0.384676844f, 0.117415294f},
-std::array<float,2>{0.509766102f, 0.596057892f},
-std::array<float,2>{0.327841997f, 0.737581134f},
-std::array<float,2>{0.705484033f, 0.188725874f},
-std::array<float,2>{0.000468142855f, 0.350743711f},
-std::array<float,2>{0.830133855f, 0.776041567f},
-std::array<float,2>{0.115660191f, 0.557231188f},
-std::array<float,2>{0.772458971f, 0.0430172645f},
-std::array<float,2>{0.2819345f, 0.479679316f},
-std::array<float,2>{0.630404294f, 0.93612361f},
-std::array<float,2>{0.444518328f, 0.842430592f},
-std::array<float,2>{0.585234106f, 0.305373669f},
-std::array<float,2>{0.161850423f, 0.152656466f},
-std::array<float,2>{0.98180604f, 0.625825107f},
-std::array<float,2>{0.0697532222f, 0.914394498f},
-std::array<float,2>{0.806099057f, 0.487777978f},
-std::array<float,2>{0.275415808f, 0.0535518713f},
-std::array<float,2>{0.683275938f, 0.531900823f},
-std::array<float,2>{0.472876698f, 0.646644831f},
-std::array<float,2>{0.597444117f, 0.129721552f},
-std::array<float,2>{0.153917491f, 0.292832434f},
-std::array<float,2>{0.966414094f, 0.825603187f},
-std::array<float,2>{0.201344267f, 0.619480073f},
-std::array<float,2>{0.911985517f, 0.0985385105f},
-std::array<float,2>{0.421948999f, 0.420018405f},
-std::array<float,2>{0.546597362f, 0.951358378f},
-std::array<float,2>{0.350990891f, 0.763785481f},
-std::array<float,2>{0.737340689f, 0.363606781f},
-std::array<float,2>{0.0378838293f, 0.214726105f},
-std::array<float,2>{0.873471677f, 0.730204582f},
-std::array<float,2>{0.182395935f, 0.862015307f},
-std::array<float,2>{0.990454137f, 0.274545968f},
-std::array<float,2>{0.463361621f, 0.175257459f},
-std::array<float,2>{0.563869715f, 0.683173835f},
-std::array<float,2>{0.307082266f, 0.531132877f},
-std::array<float,2>{0.649047434f, 0.00439618528f},
-std::array<float,2>{0.0997208431f, 0.459031492f},
-std::array<float,2>{0.755656898f, 0.904877663f},
-std::array<float,2>{0.0220890623f, 0.704464197f},
-std::array<float,2>{0.812669933f, 0.221961558f},
-std::array<float,2>{0.33042708f, 0.330755711f},
-std::array<float,2>{0.694273591f, 0.789567411f},
-std::array<float,2>{0.399980366f, 0.988088906f},
-std::array<float,2>{0.524166226f, 0.375379294f},
-std::array<float,2>{0.234724611f, 0.0708959997f},
-std::array<float,2>{0.899392486f, 0.581084847f},
-std::array<float,2>{0.103201926f, 0.813145995f},
-std::array<float,2>{0.763739467f, 0.28275609f},
-std::array<float,2>{0.298570305f, 0.136389345f},
-std::array<float,2>{0.647439361f, 0.64895457f},
-std::array<float,2>{0.457682431f, 0.545892835f},
-std::array<float,2>{0.571638107f, 0.0596157946f},
-std::array<float,2>{0.178469002f, 0.493993104f},
-std::array<float,2>{0.992684603f, 0.906567454f},
-std::array<float,2>{0.247758791f, 0.719313025f},
-std::array<float,2>{0.894892395f, 0.204496562f},
-std::array<float,2>{0.398069888f, 0.372910768f},
-std::array<float,2>{0.51608789f, 0.757001996f},
-std::array<float,2>{0.342052549f, 0.938393176f},
-std::array<float,2>{0.697493911f, 0.407617003f},
-std::array<float,2>{0.0242502131f, 0.102385148f},
-std::array<float,2>{0.823263228f, 0.615320504f},
-std::array<float,2>{0.146201506f, 0.892865121f},
-std::array<float,2>{0.956485808f, 0.462227106f},
-std::array<float,2>{0.482054532f, 0.00811784621f},
-std::array<float,2>{0.609273195f, 0.518678963f},
-std::array<float,2>{0.2657471f, 0.674453855f},
-std::array<float,2>{0.676007569f, 0.17971532f},
-std::array<float,2>{0.0764065832f, 0.267017722f},
-std::array<float,2>{0.803275645f, 0.86852777f},
-std::array<float,2>{0.0418176204f, 0.587886214f},
-std::array<float,2>{0.863819838f, 0.0657927245f},
-std::array<float,2>{0.353927791f, 0.389184713f},
-std::array<float,2>{0.748433292f, 0.992459059f},
-std::array<float,2>{0.432091236f, 0.787820399f},
-std::array<float,2>{0.537533939f, 0.343253911f},
-std::array<float,2>{0.191045925f, 0.23094435f},
-std::array<float,2>{0.92134589f, 0.714189649f},
-std::array<float,2>{0.0100292079f, 0.977417588f},
-std::array<float,2>{0.838308096f, 0.397042543f},
-std::array<float,2>{0.313172907f, 0.0789412856f},
-std::array<float,2>{0.713669658f, 0.564042568f},
-std::array<float,2>{0.380600393f, 0.700548768f},
-std::array<float,2>{0.503169358f, 0.248674601f},
-std::array<float,2>{0.222567305f, 0.320409238f},
-std::array<float,2>{0.875507176f, 0.803891361f},
-std::array<float,2>{0.16422379f, 0.507988214f},
-std::array<float,2>{0.972231925f, 0.02608932f},
-std::array<float,2>{0.449537665f, 0.444960833f},
-std::array<float,2>{0.586264014f, 0.876619399f},
-std::array<float,2>{0.292324185f, 0.84972465f},
-std::array<float,2>{0.64019078f, 0.254787356f},
-std::array<float,2>{0.123565011f, 0.169061139f},
-std::array<float,2>{0.774326622f, 0.664095223f},
-std::array<float,2>{0.21433568f, 0.765934467f},
-std::array<float,2>{0.9368366f, 0.355932534f},
-std::array<float,2>{0.412821293f, 0.196363717f},
-std::array<float,2>{0.558690369f, 0.742481887f},
-std::array<float,2>{0.374163151f, 0.601975441f},
-std::array<float,2>{0.722679675f, 0.111546956f},
-std::array<float,2>{0.0588389747f, 0.426840514f},
-std::array<float,2>{0.851236939f, 0.954431653f},
-std::array<float,2>{0.0916065127f, 0.635111928f},
-std::array<float,2>{0.789284766f, 0.148349687f},
-std::array<float,2>{0.258138329f, 0.299195468f},
-std::array<float,2>{0.657257736f, 0.835042775f},
-std::array<float,2>{0.493788481f, 0.922574699f},
-std::array<float,2>{0.613863826f, 0.471984714f},
-std::array<float,2>{0.140420526f, 0.0380728543f},
-std::array<float,2>{0.945213974f, 0.552049577f},
-std::array<float,2>{0.0828507915f, 0.75162375f},
-std::array<float,2>{0.788408756f, 0.367795289f},
-std::array<float,2>{0.253180057f, 0.208754197f},
-std::array<float,2>{0.67075783f, 0.723659456f},
-std::array<float,2>{0.4897497f, 0.610294461f},
-std::array<float,2>{0.620714545f, 0.107750855f},
-std::array<float,2>{0.127833888f, 0.412970692f},
-std::array<float,2>{0.948544443f, 0.943753958f},
-std::array<float,2>{0.210338429f, 0.654566288f},
-std::array<float,2>{0.925873399f, 0.139448494f},
-std::array<float,2>{0.414352655f, 0.286362022f},
-std::array<float,2>{0.554528594f, 0.816441476f},
-std::array<float,2>{0.36512509f, 0.911248982f},
-std::array<float,2>{0.7342152f, 0.49811092f},
-std::array<float,2>{0.0508628897f, 0.0555215739f},
-std::array<float,2>{0.857806146f, 0.539218247f},
-std::array<float,2>{0.15803954f, 0.999798775f},
-std::array<float,2>{0.977831781f, 0.385833085f},
-std::array<float,2>{0.441380918f, 0.0685700402f},
-std::array<float,2>{0.581986129f, 0.59368968f},
-std::array<float,2>{0.288033068f, 0.715323448f},
-std::array<float,2>{0.627192557f, 0.229289755f},
-std::array<float,2>{0.112863638f, 0.337269008f},
-std::array<float,2>{0.767564178f, 0.781843066f},
-std::array<float,2>{0.00464819651f, 0.522657692f},
-std::array<float,2>{0.834667504f, 0.0140123498f},
-std::array<float,2>{0.32275337f, 0.468255192f},
-std::array<float,2>{0.710023701f, 0.897068441f},
-std::array<float,2>{0.389379948f, 0.874697387f},
-std::array<float,2>{0.512925804f, 0.270531476f},
-std::array<float,2>{0.233386219f, 0.185168132f},
-std::array<float,2>{0.889133096f, 0.678778291f},
-std::array<float,2>{0.0319290087f, 0.879057646f},
-std::array<float,2>{0.867532194f, 0.439762235f},
-std::array<float,2>{0.346498549f, 0.029897714f},
-std::array<float,2>{0.739755988f, 0.513282895f},
-std::array<float,2>{0.429163843f, 0.668365121f},
-std::array<float,2>{0.541750371f, 0.16628997f},
-std::array<float,2>{0.198878512f, 0.253477037f},
-std::array<float,2>{0.908251703f, 0.847289085f},
-std::array<float,2>{0.14937526f, 0.568410575f},
-std::array<float,2>{0.963437319f, 0.0858309269f},
-std::array<float,2>{0.471881717f, 0.393458903f},
-std::array<float,2>{0.601283491f, 0.98436749f},
-std::array<float,2>{0.280073822f, 0.798026204f},
-std::array<float,2>{0.684469283f, 0.325069845f},
-std::array<float,2>{0.0634061098f, 0.245208248f},
-std::array<float,2>{0.811201692f, 0.697008789f},
-std::array<float,2>{0.242147505f, 0.830368459f},
-std::array<float,2>{0.903698087f, 0.302803606f},
-std::array<float,2>{0.403547317f, 0.144381225f},
-std::array<float,2>{0.528040111f, 0.637483358f},
-std::array<float,2>{0.334966958f, 0.548816264f},
-std::array<float,2>{0.689359963f, 0.0344195887f},
-std::array<float,2>{0.0180072412f, 0.476344049f},
-std::array<float,2>{0.820074558f, 0.926139474f},
-std::array<float,2>{0.0942199379f, 0.749316871f},
-std::array<float,2>{0.753742278f, 0.201682419f},
-std::array<float,2>{0.310439646f, 0.354098409f},
-std::array<float,2>{0.653543353f, 0.77069664f},
-std::array<float,2>{0.467592388f, 0.959686637f},
-std::array<float,2>{0.568802416f, 0.423898399f},
-std::array<float,2>{0.185065955f, 0.115451835f},
-std::array<float,2>{0.985886455f, 0.607509732f},
-std::array<float,2>{0.0276202299f, 0.856180072f},
-std::array<float,2>{0.826881349f, 0.257821381f},
-std::array<float,2>{0.339749068f, 0.163714901f},
-std::array<float,2>{0.702998638f, 0.659467459f},
-std::array<float,2>{0.392497838f, 0.503686786f},
-std::array<float,2>{0.523004234f, 0.0163887348f},
-std::array<float,2>{0.242751643f, 0.446357965f},
-std::array<float,2>{0.892717183f, 0.886784852f},
-std::array<float,2>{0.173615098f, 0.689565182f},
-std::array<float,2>{0.996474445f, 0.241346091f},
-std::array<float,2>{0.455097526f, 0.31755197f},
-std::array<float,2>{0.57598418f, 0.812032998f},
-std::array<float,2>{0.302444935f, 0.972720623f},
-std::array<float,2>{0.641790628f, 0.399721354f},
-std::array<float,2>{0.109185904f, 0.0871124119f},
-std::array<float,2>{0.757917345f, 0.577626824f},
-std::array<float,2>{0.191647723f, 0.930247486f},
-std::array<float,2>{0.916914225f, 0.483243227f},
-std::array<float,2>{0.435419589f, 0.0411760472f},
-std::array<float,2>{0.534998536f, 0.560168624f},
-std::array<float,2>{0.356128663f, 0.630760491f},
-std::array<float,2>{0.743074715f, 0.151780978f},
-std::array<float,2>{0.0453702845f, 0.312061399f},
-std::array<float,2>{0.859642684f, 0.837375522f},
-std::array<float,2>{0.0724455342f, 0.600061297f},
-std::array<float,2>{0.797483325f, 0.12231078f},
-std::array<float,2>{0.270670682f, 0.434359223f},
-std::array<float,2>{0.671964943f, 0.963967681f},
-std::array<float,2>{0.478317678f, 0.779481351f},
-std::array<float,2>{0.604165614f, 0.346437901f},
-std::array<float,2>{0.142937675f, 0.193977982f},
-std::array<float,2>{0.957218111f, 0.739992976f},
-std::array<float,2>{0.117893584f, 0.945988774f},
-std::array<float,2>{0.778225124f, 0.415036112f},
-std::array<float,2>{0.296150386f, 0.0971045047f},
-std::array<float,2>{0.634846807f, 0.624451399f},
-std::array<float,2>{0.447770923f, 0.732295871f},
-std::array<float,2>{0.590156376f, 0.215089813f},
-std::array<float,2>{0.170198902f, 0.361787051f},
-std::array<float,2>{0.972796381f, 0.761013985f},
-std::array<float,2>{0.222754553f, 0.535231113f},
-std::array<float,2>{0.879075348f, 0.0476727523f},
-std::array<float,2>{0.378285974f, 0.489574283f},
-std::array<float,2>{0.504863739f, 0.920610547f},
-std::array<float,2>{0.317403316f, 0.823407233f},
-std::array<float,2>{0.717051923f, 0.294394851f},
-std::array<float,2>{0.0137697812f, 0.127194181f},
-std::array<float,2>{0.841492176f, 0.641975582f},
-std::array<float,2>{0.133762196f, 0.795598805f},
-std::array<float,2>{0.940930605f, 0.335842937f},
-std::array<float,2>{0.497967482f, 0.223078758f},
-std::array<float,2>{0.610434353f, 0.707879782f},
-std::array<float,2>{0.262477636f, 0.585032642f},
-std::array<float,2>{0.661563337f, 0.0766026676f},
-std::array<float,2>{0.0888119414f, 0.379572392f},
-std::array<float,2>{0.795760036f, 0.989132226f},
-std::array<float,2>{0.056454923f, 0.686353087f},
-std::array<float,2>{0.845677137f, 0.176001236f},
-std::array<float,2>{0.369866431f, 0.279599577f},
-std::array<float,2>{0.72236681f, 0.866193593f},
-std::array<float,2>{0.409967512f, 0.900904059f},
-std::array<float,2>{0.555396438f, 0.454771847f},
-std::array<float,2>{0.217396826f, 0.000157394272f},
-std::array<float,2>{0.931185424f, 0.523955941f},
-std::array<float,2>{0.00827599782f, 0.804428339f},
-std::array<float,2>{0.83627063f, 0.321069896f},
-std::array<float,2>{0.315972596f, 0.248176813f},
-std::array<float,2>{0.712797403f, 0.700841486f},
-std::array<float,2>{0.381084621f, 0.563759565f},
-std::array<float,2>{0.501174688f, 0.0783027709f},
-std::array<float,2>{0.218925163f, 0.396537483f},
-std::array<float,2>{0.877812982f, 0.976992011f},
-std::array<float,2>{0.166414276f, 0.664659977f},
-std::array<float,2>{0.970208883f, 0.169814274f},
-std::array<float,2>{0.452023745f, 0.253960311f},
-std::array<float,2>{0.587973654f, 0.850518465f},
-std::array<float,2>{0.290707022f, 0.876036406f},
-std::array<float,2>{0.637486756f, 0.444787532f},
-std::array<float,2>{0.122273907f, 0.0254569668f},
-std::array<float,2>{0.776676536f, 0.508730173f},
-std::array<float,2>{0.211277649f, 0.954849958f},
-std::array<float,2>{0.934753537f, 0.427587032f},
-std::array<float,2>{0.411872625f, 0.1120359f},
-std::array<float,2>{0.560813367f, 0.602398992f},
-std::array<float,2>{0.371201426f, 0.743029416f},
-std::array<float,2>{0.725524068f, 0.197045594f},
-std::array<float,2>{0.0609724335f, 0.356067479f},
-std::array<float,2>{0.848455489f, 0.766558766f},
-std::array<float,2>{0.0923720002f, 0.552643597f},
-std::array<float,2>{0.792533994f, 0.0371838808f},
-std::array<float,2>{0.261713833f, 0.472617775f},
-std::array<float,2>{0.659684181f, 0.922150016f},
-std::array<float,2>{0.494400769f, 0.835537612f},
-std::array<float,2>{0.615880072f, 0.299382865f},
-std::array<float,2>{0.138629898f, 0.147637561f},
-std::array<float,2>{0.943062544f, 0.635395885f},
-std::array<float,2>{0.103816539f, 0.906868041f},
-std::array<float,2>{0.763625562f, 0.493418366f},
-std::array<float,2>{0.300483227f, 0.0602208264f},
-std::array<float,2>{0.645570993f, 0.545075834f},
-std::array<float,2>{0.459815353f, 0.648475111f},
-std::array<float,2>{0.573525727f, 0.135833353f},
-std::array<float,2>{0.177310824f, 0.282376438f},
-std::array<float,2>{0.995361567f, 0.812752128f},
-std::array<float,2>{0.248339415f, 0.61616385f},
-std::array<float,2>{0.89801681f, 0.101564318f},
-std::array<float,2>{0.395055562f, 0.408094555f},
-std::array<float,2>{0.517796159f, 0.937673867f},
-std::array<float,2>{0.340233624f, 0.757616997f},
-std::array<float,2>{0.696571946f, 0.372505039f},
-std::array<float,2>{0.0263789725f, 0.204867855f},
-std::array<float,2>{0.821725845f, 0.719046056f},
-std::array<float,2>{0.148019701f, 0.869066119f},
-std::array<float,2>{0.954282701f, 0.267508894f},
-std::array<float,2>{0.4837448f, 0.180616722f},
-std::array<float,2>{0.6062693f, 0.674224257f},
-std::array<float,2>{0.26771614f, 0.519236624f},
-std::array<float,2>{0.679203331f, 0.00851170346f},
-std::array<float,2>{0.0753864124f, 0.462862641f},
-std::array<float,2>{0.800785661f, 0.893412352f},
-std::array<float,2>{0.0397160202f, 0.714535952f},
-std::array<float,2>{0.865765154f, 0.230981112f},
-std::array<float,2>{0.352133334f, 0.34330374f},
-std::array<float,2>{0.747922122f, 0.787493467f},
-std::array<float,2>{0.431096584f, 0.992756426f},
-std::array<float,2>{0.536819458f, 0.388748497f},
-std::array<float,2>{0.188372225f, 0.0662213564f},
-std::array<float,2>{0.91844517f, 0.587346315f},
-std::array<float,2>{0.0677374974f, 0.825855196f},
-std::array<float,2>{0.806912541f, 0.292066932f},
-std::array<float,2>{0.273628205f, 0.129327729f},
-std::array<float,2>{0.680174708f, 0.646994233f},
-std::array<float,2>{0.476024896f, 0.531363666f},
-std::array<float,2>{0.59474498f, 0.0531407073f},
-std::array<float,2>{0.155081615f, 0.48789227f},
-std::array<float,2>{0.967474937f, 0.914619803f},
-std::array<float,2>{0.201067269f, 0.729671419f},
-std::array<float,2>{0.912469149f, 0.213881671f},
-std::array<float,2>{0.42454648f, 0.364143968f},
-std::array<float,2>{0.543829978f, 0.764207363f},
-std::array<float,2>{0.348402023f, 0.951785266f},
-std::array<float,2>{0.73585403f, 0.420874387f},
-std::array<float,2>{0.0359621942f, 0.0979222655f},
-std::array<float,2>{0.871453285f, 0.619648039f},
-std::array<float,2>{0.18106696f, 0.904381692f},
-std::array<float,2>{0.989939094f, 0.459818661f},
-std::array<float,2>{0.461981863f, 0.00401408086f},
-std::array<float,2>{0.565807939f, 0.530605614f},
-std::array<float,2>{0.305336833f, 0.683005035f},
-std::array<float,2>{0.651500881f, 0.175451338f},
-std::array<float,2>{0.0984074026f, 0.275168777f},
-std::array<float,2>{0.756782949f, 0.861593962f},
-std::array<float,2>{0.0208345726f, 0.581649184f},
-std::array<float,2>{0.816058338f, 0.0705771595f},
-std::array<float,2>{0.328532726f, 0.37550208f},
-std::array<float,2>{0.691871047f, 0.987696767f},
-std::array<float,2>{0.401236743f, 0.789103985f},
-std::array<float,2>{0.525685251f, 0.330369055f},
-std::array<float,2>{0.237255052f, 0.222470105f},
-std::array<float,2>{0.90195632f, 0.705010891f},
-std::array<float,2>{0.0471125804f, 0.968752682f},
-std::array<float,2>{0.853864312f, 0.40492931f},
-std::array<float,2>{0.362563848f, 0.0922412053f},
-std::array<float,2>{0.728453994f, 0.574011207f},
-std::array<float,2>{0.420935661f, 0.695112467f},
-std::array<float,2>{0.547786653f, 0.2380649f},
-std::array<float,2>{0.205438823f, 0.313045055f},
-std::array<float,2>{0.925115108f, 0.805382013f},
-std::array<float,2>{0.131203309f, 0.504935682f},
-std::array<float,2>{0.950329423f, 0.0207934063f},
-std::array<float,2>{0.484883994f, 0.449561685f},
-std::array<float,2>{0.623849034f, 0.884719849f},
-std::array<float,2>{0.257000655f, 0.852783978f},
-std::array<float,2>{0.667058766f, 0.263270527f},
-std::array<float,2>{0.0788851604f, 0.158528864f},
-std::array<float,2>{0.781795144f, 0.661677241f},
-std::array<float,2>{0.228150353f, 0.775708675f},
-std::array<float,2>{0.884490848f, 0.351184636f},
-std::array<float,2>{0.38481456f, 0.189170912f},
-std::array<float,2>{0.508941889f, 0.737975478f},
-std::array<float,2>{0.326020509f, 0.596283853f},
-std::array<float,2>{0.704714417f, 0.117734484f},
-std::array<float,2>{0.00289610936f, 0.432924956f},
-std::array<float,2>{0.828195274f, 0.966606677f},
-std::array<float,2>{0.114180058f, 0.62538439f},
-std::array<float,2>{0.770407617f, 0.152850196f},
-std::array<float,2>{0.284426451f, 0.304867148f},
-std::array<float,2>{0.631016672f, 0.841876686f},
-std::array<float,2>{0.442021251f, 0.935972214f},
-std::array<float,2>{0.583437204f, 0.480371028f},
-std::array<float,2>{0.163859278f, 0.043579869f},
-std::array<float,2>{0.982980132f, 0.556966126f},
-std::array<float,2>{0.120411411f, 0.761561811f},
-std::array<float,2>{0.780017793f, 0.361868113f},
-std::array<float,2>{0.294831991f, 0.215807572f},
-std::array<float,2>{0.63351965f, 0.731802821f},
-std::array<float,2>{0.447130501f, 0.624687433f},
-std::array<float,2>{0.591952026f, 0.0972890332f},
-std::array<float,2>{0.169632405f, 0.41420719f},
-std::array<float,2>{0.975966632f, 0.94562459f},
-std::array<float,2>{0.224940255f, 0.642124593f},
-std::array<float,2>{0.882706463f, 0.12772499f},
-std::array<float,2>{0.376950771f, 0.29445219f},
-std::array<float,2>{0.507605255f, 0.824110031f},
-std::array<float,2>{0.318969786f, 0.920392215f},
-std::array<float,2>{0.715471327f, 0.489759356f},
-std::array<float,2>{0.0135328854f, 0.047213234f},
-std::array<float,2>{0.842809439f, 0.535711288f},
-std::array<float,2>{0.135136828f, 0.988711894f},
-std::array<float,2>{0.939258099f, 0.379335076f},
-std::array<float,2>{0.499754816f, 0.0771078542f},
-std::array<float,2>{0.612551212f, 0.585928559f},
-std::array<float,2>{0.265418857f, 0.707259476f},
-std::array<float,2>{0.662212372f, 0.223287597f},
-std::array<float,2>{0.0878473818f, 0.33509317f},
-std::array<float,2>{0.793116271f, 0.795323133f},
-std::array<float,2>{0.0579757169f, 0.523631573f},
-std::array<float,2>{0.846103847f, 0.000566706702f},
-std::array<float,2>{0.367846012f, 0.454511732f},
-std::array<float,2>{0.720431924f, 0.900547802f},
-std::array<float,2>{0.407313704f, 0.865514398f},
-std::array<float,2>{0.558394849f, 0.279986203f},
-std::array<float,2>{0.216181114f, 0.176744431f},
-std::array<float,2>{0.932969332f, 0.685765922f},
-std::array<float,2>{0.0297821797f, 0.887549281f},
-std::array<float,2>{0.825449884f, 0.447167277f},
-std::array<float,2>{0.336612582f, 0.0159126557f},
-std::array<float,2>{0.699483156f, 0.503179491f},
-std::array<float,2>{0.393932104f, 0.659951627f},
-std::array<float,2>{0.520302534f, 0.16350238f},
-std::array<float,2>{0.245679528f, 0.258455127f},
-std::array<float,2>{0.892484605f, 0.855569243f},
-std::array<float,2>{0.174271092f, 0.5778898f},
-std::array<float,2>{0.999354959f, 0.087433733f},
-std::array<float,2>{0.453211635f, 0.400379628f},
-std::array<float,2>{0.576566875f, 0.973200083f},
-std::array<float,2>{0.304373473f, 0.811610222f},
-std::array<float,2>{0.643505454f, 0.318274796f},
-std::array<float,2>{0.105962798f, 0.241810501f},
-std::array<float,2>{0.760918617f, 0.690115631f},
-std::array<float,2>{0.194987833f, 0.837683678f},
-std::array<float,2>{0.91478318f, 0.311613321f},
-std::array<float,2>{0.435613096f, 0.151857659f},
-std::array<float,2>{0.532461882f, 0.630333722f},
-std::array<float,2>{0.358017772f, 0.560058534f},
-std::array<float,2>{0.745533764f, 0.0418864749f},
-std::array<float,2>{0.0435076952f, 0.482832313f},
-std::array<float,2>{0.861629367f, 0.929741502f},
-std::array<float,2>{0.0705022737f, 0.739355862f},
-std::array<float,2>{0.800742865f, 0.193427324f},
-std::array<float,2>{0.272947729f, 0.34614566f},
-std::array<float,2>{0.674443066f, 0.779997051f},
-std::array<float,2>{0.478525221f, 0.964527547f},
-std::array<float,2>{0.603196859f, 0.433933228f},
-std::array<float,2>{0.141634345f, 0.122931451f},
-std::array<float,2>{0.960781455f, 0.600302577f},
-std::array<float,2>{0.0336434469f, 0.847002566f},
-std::array<float,2>{0.869452059f, 0.253337473f},
-std::array<float,2>{0.344638616f, 0.166791826f},
-std::array<float,2>{0.741401315f, 0.668776035f},
-std::array<float,2>{0.426180243f, 0.512798846f},
-std::array<float,2>{0.540978432f, 0.0296484157f},
-std::array<float,2>{0.197072908f, 0.439951003f},
-std::array<float,2>{0.907990038f, 0.879746377f},
-std::array<float,2>{0.152322069f, 0.696772933f},
-std::array<float,2>{0.961725652f, 0.246060669f},
-std::array<float,2>{0.470163792f, 0.32437709f},
-std::array<float,2>{0.599372208f, 0.798730791f},
-std::array<float,2>{0.278865337f, 0.983527243f},
-std::array<float,2>{0.6871292f, 0.392668515f},
-std::array<float,2>{0.0659270138f, 0.0851836503f},
-std::array<float,2>{0.808850408f, 0.568967223f},
-std::array<float,2>{0.239827424f, 0.926342547f},
-std::array<float,2>{0.905878127f, 0.47602275f},
-std::array<float,2>{0.404576689f, 0.0349634886f},
-std::array<float,2>{0.530269206f, 0.548295796f},
-std::array<float,2>{0.333333492f, 0.636814356f},
-std::array<float,2>{0.690770626f, 0.143985718f},
-std::array<float,2>{0.0171582326f, 0.303370923f},
-std::array<float,2>{0.818290889f, 0.830672979f},
-std::array<float,2>{0.0974794999f, 0.607938528f},
-std::array<float,2>{0.751776814f, 0.115878522f},
-std::array<float,2>{0.3121894f, 0.424781203f},
-std::array<float,2>{0.655040383f, 0.959418237f},
-std::array<float,2>{0.465137273f, 0.771065891f},
-std::array<float,2>{0.56809479f, 0.353634715f},
-std::array<float,2>{0.185796455f, 0.201467931f},
-std::array<float,2>{0.988170683f, 0.749554336f},
-std::array<float,2>{0.0856028348f, 0.943849862f},
-std::array<float,2>{0.787099838f, 0.4123137f},
-std::array<float,2>{0.251009822f, 0.108158909f},
-std::array<float,2>{0.669025004f, 0.609844208f},
-std::array<float,2>{0.49184376f, 0.724179506f},
-std::array<float,2>{0.61832422f, 0.208405137f},
-std::array<float,2>{0.125525638f, 0.367488325f},
-std::array<float,2>{0.946696043f, 0.751345634f},
-std::array<float,2>{0.207698673f, 0.539884567f},
-std::array<float,2>{0.928379714f, 0.0551167615f},
-std::array<float,2>{0.417942315f, 0.498921931f},
-std::array<float,2>{0.552681208f, 0.911797523f},
-std::array<float,2>{0.366939098f, 0.817030191f},
-std::array<float,2>{0.731909096f, 0.286626011f},
-std::array<float,2>{0.0544151701f, 0.139133379f},
-std::array<float,2>{0.856981158f, 0.654907823f},
-std::array<float,2>{0.160120398f, 0.781609535f},
-std::array<float,2>{0.979577422f, 0.337605447f},
-std::array<float,2>{0.438352704f, 0.228554368f},
-std::array<float,2>{0.579678774f, 0.715338528f},
-std::array<float,2>{0.285350055f, 0.592872918f},
-std::array<float,2>{0.626755536f, 0.0692499727f},
-std::array<float,2>{0.109738931f, 0.386419594f},
-std::array<float,2>{0.767794549f, 0.999100924f},
-std::array<float,2>{0.00767461024f, 0.679446816f},
-std::array<float,2>{0.83377856f, 0.184583724f},
-std::array<float,2>{0.321963757f, 0.271334916f},
-std::array<float,2>{0.708644092f, 0.874142289f},
-std::array<float,2>{0.388344288f, 0.896685898f},
-std::array<float,2>{0.51491046f, 0.468744278f},
-std::array<float,2>{0.232022718f, 0.0144674303f},
-std::array<float,2>{0.887942553f, 0.523293555f},
-std::array<float,2>{0.0595000461f, 0.767774522f},
-std::array<float,2>{0.851042449f, 0.359198868f},
-std::array<float,2>{0.374929339f, 0.199061468f},
-std::array<float,2>{0.723308563f, 0.744750798f},
-std::array<float,2>{0.412525862f, 0.605370879f},
-std::array<float,2>{0.559310198f, 0.111192599f},
-std::array<float,2>{0.214555427f, 0.428904891f},
-std::array<float,2>{0.937138438f, 0.95622623f},
-std::array<float,2>{0.1401214f, 0.632997334f},
-std::array<float,2>{0.94447881f, 0.145610139f},
-std::array<float,2>{0.493567258f, 0.298507601f},
-std::array<float,2>{0.613281369f, 0.83370918f},
-std::array<float,2>{0.258468837f, 0.923999548f},
-std::array<float,2>{0.658032835f, 0.468913525f},
-std::array<float,2>{0.0908351243f, 0.0352717973f},
-std::array<float,2>{0.78958416f, 0.554340303f},
-std::array<float,2>{0.22182551f, 0.979579687f},
-std::array<float,2>{0.875433981f, 0.396026194f},
-std::array<float,2>{0.380284518f, 0.0812318102f},
-std::array<float,2>{0.503445029f, 0.566090882f},
-std::array<float,2>{0.312559187f, 0.702255428f},
-std::array<float,2>{0.713327229f, 0.247550681f},
-std::array<float,2>{0.0106945587f, 0.322733819f},
-std::array<float,2>{0.838437498f, 0.802014053f},
-std::array<float,2>{0.123151749f, 0.511173964f},
-std::array<float,2>{0.773595691f, 0.0245751515f},
-std::array<float,2>{0.292694151f, 0.442553192f},
-std::array<float,2>{0.639881194f, 0.876982868f},
-std::array<float,2>{0.449870318f, 0.848229527f},
-std::array<float,2>{0.586620033f, 0.256500393f},
-std::array<float,2>{0.164851129f, 0.170060009f},
-std::array<float,2>{0.971741378f, 0.666671991f},
-std::array<float,2>{0.076772891f, 0.89171946f},
-std::array<float,2>{0.802952051f, 0.462936372f},
-std::array<float,2>{0.266157508f, 0.0111322096f},
-std::array<float,2>{0.67645663f, 0.516049683f},
-std::array<float,2>{0.481870294f, 0.673447907f},
-std::array<float,2>{0.608598769f, 0.18186675f},
-std::array<float,2>{0.145951331f, 0.268341392f},
-std::array<float,2>{0.956807852f, 0.869909227f},
-std::array<float,2>{0.190737933f, 0.589429259f},
-std::array<float,2>{0.921852887f, 0.0637893826f},
-std::array<float,2>{0.432548642f, 0.387800008f},
-std::array<float,2>{0.538047493f, 0.995391011f},
-std::array<float,2>{0.354106724f, 0.78710115f},
-std::array<float,2>{0.749003112f, 0.341618329f},
-std::array<float,2>{0.0411835723f, 0.233880207f},
-std::array<float,2>{0.863602996f, 0.712718844f},
-std::array<float,2>{0.177858517f, 0.815109134f},
-std::array<float,2>{0.99261713f, 0.28371352f},
-std::array<float,2>{0.457182318f, 0.133305356f},
-std::array<float,2>{0.572043121f, 0.652204037f},
-std::array<float,2>{0.297955483f, 0.544375241f},
-std::array<float,2>{0.646686256f, 0.0613868795f},
-std::array<float,2>{0.10268613f, 0.494981855f},
-std::array<float,2>{0.764568448f, 0.909819305f},
-std::array<float,2>{0.0238896552f, 0.72237432f},
-std::array<float,2>{0.824037135f, 0.206093758f},
-std::array<float,2>{0.3427158f, 0.373072237f},
-std::array<float,2>{0.697759271f, 0.754968166f},
-std::array<float,2>{0.397477657f, 0.941058815f},
-std::array<float,2>{0.516343832f, 0.408691823f},
-std::array<float,2>{0.247312337f, 0.104957461f},
-std::array<float,2>{0.895035386f, 0.614301801f},
-std::array<float,2>{0.100257903f, 0.859720826f},
-std::array<float,2>{0.754891574f, 0.277332932f},
-std::array<float,2>{0.307324797f, 0.172545731f},
-std::array<float,2>{0.64888382f, 0.681467831f},
-std::array<float,2>{0.463690728f, 0.527900994f},
-std::array<float,2>{0.564436018f, 0.00637997501f},
-std::array<float,2>{0.181730777f, 0.458236873f},
-std::array<float,2>{0.991201639f, 0.903687954f},
-std::array<float,2>{0.234946877f, 0.706297994f},
-std::array<float,2>{0.898696005f, 0.22012271f},
-std::array<float,2>{0.399436325f, 0.328984231f},
-std::array<float,2>{0.52379477f, 0.791829407f},
-std::array<float,2>{0.330653131f, 0.984788239f},
-std::array<float,2>{0.693475723f, 0.377658784f},
-std::array<float,2>{0.0219379198f, 0.0734310001f},
-std::array<float,2>{0.813235998f, 0.579046488f},
-std::array<float,2>{0.153328687f, 0.91784066f},
-std::array<float,2>{0.966046274f, 0.484912246f},
-std::array<float,2>{0.473610908f, 0.0517197102f},
-std::array<float,2>{0.596945882f, 0.534298718f},
-std::array<float,2>{0.27591604f, 0.644667745f},
-std::array<float,2>{0.682618082f, 0.13271293f},
-std::array<float,2>{0.0701562315f, 0.289618313f},
-std::array<float,2>{0.80617398f, 0.827111185f},
-std::array<float,2>{0.0371748358f, 0.61843276f},
-std::array<float,2>{0.873749375f, 0.10090901f},
-std::array<float,2>{0.351281583f, 0.41948083f},
-std::array<float,2>{0.738174915f, 0.950187743f},
-std::array<float,2>{0.422600299f, 0.762638807f},
-std::array<float,2>{0.546065092f, 0.366846025f},
-std::array<float,2>{0.201941773f, 0.211192429f},
-std::array<float,2>{0.911488414f, 0.726592004f},
-std::array<float,2>{0.00086131657f, 0.967514098f},
-std::array<float,2>{0.830855072f, 0.431195676f},
-std::array<float,2>{0.327560723f, 0.120718554f},
-std::array<float,2>{0.705664754f, 0.595069468f},
-std::array<float,2>{0.384099305f, 0.735972583f},
-std::array<float,2>{0.510737598f, 0.191122532f},
-std::array<float,2>{0.228842691f, 0.349103123f},
-std::array<float,2>{0.886638403f, 0.774357021f},
-std::array<float,2>{0.161329284f, 0.555569828f},
-std::array<float,2>{0.981999516f, 0.0452000648f},
-std::array<float,2>{0.445160478f, 0.477339357f},
-std::array<float,2>{0.585828781f, 0.933678269f},
-std::array<float,2>{0.281589061f, 0.840913594f},
-std::array<float,2>{0.6300174f, 0.306672931f},
-std::array<float,2>{0.115844399f, 0.155171752f},
-std::array<float,2>{0.771660805f, 0.627581954f},
-std::array<float,2>{0.204582736f, 0.807114363f},
-std::array<float,2>{0.922922909f, 0.315820873f},
-std::array<float,2>{0.418223768f, 0.235913143f},
-std::array<float,2>{0.550039947f, 0.693029284f},
-std::array<float,2>{0.361020714f, 0.571115077f},
-std::array<float,2>{0.729297221f, 0.0914128721f},
-std::array<float,2>{0.0497130491f, 0.403938323f},
-std::array<float,2>{0.851706445f, 0.971449554f},
-std::array<float,2>{0.0812877044f, 0.663498759f},
-std::array<float,2>{0.785118937f, 0.156419799f},
-std::array<float,2>{0.254934132f, 0.265356809f},
-std::array<float,2>{0.664177418f, 0.854215682f},
-std::array<float,2>{0.486780614f, 0.886118293f},
-std::array<float,2>{0.621946156f, 0.452833831f},
-std::array<float,2>{0.129602209f, 0.0216525402f},
-std::array<float,2>{0.952285647f, 0.506295919f},
-std::array<float,2>{0.0881747529f, 0.793557048f},
-std::array<float,2>{0.794934273f, 0.332060218f},
-std::array<float,2>{0.261769533f, 0.225180537f},
-std::array<float,2>{0.661869466f, 0.709491551f},
-std::array<float,2>{0.497409344f, 0.58387512f},
-std::array<float,2>{0.610915303f, 0.0760098249f},
-std::array<float,2>{0.133077472f, 0.38196376f},
-std::array<float,2>{0.940592885f, 0.991425872f},
-std::array<float,2>{0.217167035f, 0.68479234f},
-std::array<float,2>{0.931138694f, 0.178542435f},
-std::array<float,2>{0.409577429f, 0.277679294f},
-std::array<float,2>{0.554994464f, 0.864551604f},
-std::array<float,2>{0.369421631f, 0.899287701f},
-std::array<float,2>{0.722158968f, 0.456722826f},
-std::array<float,2>{0.055999063f, 0.00361364824f},
-std::array<float,2>{0.844904363f, 0.525653958f},
-std::array<float,2>{0.170489147f, 0.948589325f},
-std::array<float,2>{0.973295391f, 0.416359872f},
-std::array<float,2>{0.447508931f, 0.0944344103f},
-std::array<float,2>{0.590406954f, 0.621482134f},
-std::array<float,2>{0.296854764f, 0.73347348f},
-std::array<float,2>{0.635277212f, 0.217595205f},
-std::array<float,2>{0.117290132f, 0.360070169f},
-std::array<float,2>{0.777683675f, 0.758565664f},
-std::array<float,2>{0.0145291584f, 0.538502812f},
-std::array<float,2>{0.841016531f, 0.0495545194f},
-std::array<float,2>{0.318083316f, 0.491419911f},
-std::array<float,2>{0.717376828f, 0.918682754f},
-std::array<float,2>{0.378467888f, 0.821312249f},
-std::array<float,2>{0.504137158f, 0.295208842f},
-std::array<float,2>{0.223172009f, 0.126067713f},
-std::array<float,2>{0.879421115f, 0.64334172f},
-std::array<float,2>{0.045570638f, 0.932889521f},
-std::array<float,2>{0.86002785f, 0.481052339f},
-std::array<float,2>{0.355942398f, 0.0397165865f},
-std::array<float,2>{0.742206335f, 0.562236071f},
-std::array<float,2>{0.434668779f, 0.632525086f},
-std::array<float,2>{0.534572005f, 0.148692787f},
-std::array<float,2>{0.19194299f, 0.309519291f},
-std::array<float,2>{0.916079402f, 0.83966589f},
-std::array<float,2>{0.143433809f, 0.597960174f},
-std::array<float,2>{0.957748115f, 0.123397656f},
-std::array<float,2>{0.477957964f, 0.435954541f},
-std::array<float,2>{0.603914857f, 0.961699843f},
-std::array<float,2>{0.271094114f, 0.779056072f},
-std::array<float,2>{0.672470033f, 0.344918221f},
-std::array<float,2>{0.0731314197f, 0.191534355f},
-std::array<float,2>{0.797342002f, 0.7406106f},
-std::array<float,2>{0.242547721f, 0.858338058f},
-std::array<float,2>{0.893206596f, 0.260388434f},
-std::array<float,2>{0.391989499f, 0.160517916f},
-std::array<float,2>{0.522810698f, 0.657581508f},
-std::array<float,2>{0.339172482f, 0.500623584f},
-std::array<float,2>{0.702161849f, 0.0188144539f},
-std::array<float,2>{0.0279690381f, 0.448489904f},
-std::array<float,2>{0.82652694f, 0.890031755f},
-std::array<float,2>{0.108644478f, 0.688931882f},
-std::array<float,2>{0.758443773f, 0.238767013f},
-std::array<float,2>{0.30208078f, 0.320298046f},
-std::array<float,2>{0.642570138f, 0.809301019f},
-std::array<float,2>{0.455626905f, 0.975062251f},
-std::array<float,2>{0.575254023f, 0.402115136f},
-std::array<float,2>{0.172886118f, 0.0883499905f},
-std::array<float,2>{0.996820092f, 0.575281799f},
-std::array<float,2>{0.0185136609f, 0.829042852f},
-std::array<float,2>{0.819530725f, 0.302401006f},
-std::array<float,2>{0.335918009f, 0.140653074f},
-std::array<float,2>{0.68874073f, 0.639768183f},
-std::array<float,2>{0.40408662f, 0.550677359f},
-std::array<float,2>{0.527746141f, 0.0324942097f},
-std::array<float,2>{0.241565719f, 0.473779052f},
-std::array<float,2>{0.903823555f, 0.929108083f},
-std::array<float,2>{0.18495506f, 0.746127367f},
-std::array<float,2>{0.985519826f, 0.200572431f},
-std::array<float,2>{0.467247635f, 0.351776451f},
-std::array<float,2>{0.569111288f, 0.77330929f},
-std::array<float,2>{0.31002605f, 0.958516717f},
-std::array<float,2>{0.653891981f, 0.422189444f},
-std::array<float,2>{0.0944146663f, 0.113886409f},
-std::array<float,2>{0.7531569f, 0.605659127f},
-std::array<float,2>{0.198281005f, 0.881558716f},
-std::array<float,2>{0.908744097f, 0.438956618f},
-std::array<float,2>{0.429388076f, 0.0280594453f},
-std::array<float,2>{0.541187406f, 0.513907313f},
-std::array<float,2>{0.345872164f, 0.670534968f},
-std::array<float,2>{0.739512026f, 0.165212095f},
-std::array<float,2>{0.0313019268f, 0.250868887f},
-std::array<float,2>{0.868027151f, 0.844155788f},
-std::array<float,2>{0.0629407465f, 0.567656517f},
-std::array<float,2>{0.810948312f, 0.0827810392f},
-std::array<float,2>{0.279298574f, 0.390799105f},
-std::array<float,2>{0.683943808f, 0.981492162f},
-std::array<float,2>{0.472329527f, 0.799059987f},
-std::array<float,2>{0.600930154f, 0.326937169f},
-std::array<float,2>{0.148898691f, 0.24367173f},
-std::array<float,2>{0.963330388f, 0.698128343f},
-std::array<float,2>{0.112458587f, 0.996354997f},
-std::array<float,2>{0.76671648f, 0.382980704f},
-std::array<float,2>{0.287272006f, 0.0681326687f},
-std::array<float,2>{0.627807617f, 0.59107399f},
-std::array<float,2>{0.440631866f, 0.717869639f},
-std::array<float,2>{0.58113718f, 0.22817874f},
-std::array<float,2>{0.15740487f, 0.338324398f},
-std::array<float,2>{0.97803998f, 0.784463108f},
-std::array<float,2>{0.232451573f, 0.520145655f},
-std::array<float,2>{0.889172316f, 0.0121869585f},
-std::array<float,2>{0.388753027f, 0.465123624f},
-std::array<float,2>{0.513333738f, 0.896281183f},
-std::array<float,2>{0.323180497f, 0.871789396f},
-std::array<float,2>{0.71075356f, 0.271526068f},
-std::array<float,2>{0.00423217425f, 0.187302157f},
-std::array<float,2>{0.834448099f, 0.677367032f},
-std::array<float,2>{0.127061903f, 0.753082514f},
-std::array<float,2>{0.948753297f, 0.370005637f},
-std::array<float,2>{0.489594877f, 0.209278792f},
-std::array<float,2>{0.620459914f, 0.725914776f},
-std::array<float,2>{0.253635764f, 0.612808228f},
-std::array<float,2>{0.670051694f, 0.105911523f},
-std::array<float,2>{0.082308732f, 0.411033481f},
-std::array<float,2>{0.788585007f, 0.942505062f},
-std::array<float,2>{0.0515928417f, 0.652431607f},
-std::array<float,2>{0.857910633f, 0.137654826f},
-std::array<float,2>{0.364427447f, 0.28741473f},
-std::array<float,2>{0.733737886f, 0.818929136f},
-std::array<float,2>{0.414555132f, 0.913540721f},
-std::array<float,2>{0.553940117f, 0.496767819f},
-std::array<float,2>{0.210923761f, 0.0566502139f},
-std::array<float,2>{0.926392078f, 0.542800367f},
-std::array<float,2>{0.0262044854f, 0.754710972f},
-std::array<float,2>{0.82066524f, 0.374517649f},
-std::array<float,2>{0.34113282f, 0.205324367f},
-std::array<float,2>{0.695866883f, 0.721577287f},
-std::array<float,2>{0.39573139f, 0.613760114f},
-std::array<float,2>{0.519529998f, 0.104347602f},
-std::array<float,2>{0.249980152f, 0.409719765f},
-std::array<float,2>{0.897205889f, 0.940227866f},
-std::array<float,2>{0.17590639f, 0.650759757f},
-std::array<float,2>{0.994331896f, 0.134129509f},
-std::array<float,2>{0.460306644f, 0.284869552f},
-std::array<float,2>{0.572875619f, 0.815594614f},
-std::array<float,2>{0.299189597f, 0.908838689f},
-std::array<float,2>{0.644932926f, 0.495846003f},
-std::array<float,2>{0.10481482f, 0.0622075386f},
-std::array<float,2>{0.762176812f, 0.543464363f},
-std::array<float,2>{0.189070016f, 0.994957864f},
-std::array<float,2>{0.919164956f, 0.387056261f},
-std::array<float,2>{0.430445343f, 0.0630642101f},
-std::array<float,2>{0.535636902f, 0.587935984f},
-std::array<float,2>{0.352839798f, 0.711622775f},
-std::array<float,2>{0.746222854f, 0.232988238f},
-std::array<float,2>{0.0405809619f, 0.340208054f},
-std::array<float,2>{0.866526544f, 0.786031067f},
-std::array<float,2>{0.0742738619f, 0.516808748f},
-std::array<float,2>{0.802263916f, 0.0098473262f},
-std::array<float,2>{0.269454747f, 0.464693844f},
-std::array<float,2>{0.677853286f, 0.89081794f},
-std::array<float,2>{0.48255834f, 0.870398521f},
-std::array<float,2>{0.60688591f, 0.269222826f},
-std::array<float,2>{0.147131309f, 0.183285236f},
-std::array<float,2>{0.95397073f, 0.672289789f},
-std::array<float,2>{0.121452272f, 0.87812984f},
-std::array<float,2>{0.776090384f, 0.442003638f},
-std::array<float,2>{0.28918311f, 0.0237988848f},
-std::array<float,2>{0.637904465f, 0.510625958f},
-std::array<float,2>{0.452757895f, 0.667502165f},
-std::array<float,2>{0.589291096f, 0.170926884f},
-std::array<float,2>{0.16792582f, 0.257751316f},
-std::array<float,2>{0.969030917f, 0.849455059f},
-std::array<float,2>{0.220144331f, 0.564633965f},
-std::array<float,2>{0.87839365f, 0.080869481f},
-std::array<float,2>{0.38206479f, 0.394865543f},
-std::array<float,2>{0.500321507f, 0.978842497f},
-std::array<float,2>{0.314536929f, 0.801291704f},
-std::array<float,2>{0.711108923f, 0.323510081f},
-std::array<float,2>{0.00931856502f, 0.24636659f},
-std::array<float,2>{0.837692797f, 0.701417029f},
-std::array<float,2>{0.137290612f, 0.832198918f},
-std::array<float,2>{0.941889405f, 0.297203243f},
-std::array<float,2>{0.49605763f, 0.145205095f},
-std::array<float,2>{0.616603613f, 0.634364665f},
-std::array<float,2>{0.260133803f, 0.553666592f},
-std::array<float,2>{0.658275068f, 0.0363232866f},
-std::array<float,2>{0.0931398943f, 0.470353723f},
-std::array<float,2>{0.791554391f, 0.925300777f},
-std::array<float,2>{0.061591763f, 0.745930374f},
-std::array<float,2>{0.849271178f, 0.198215306f},
-std::array<float,2>{0.372121572f, 0.358052015f},
-std::array<float,2>{0.725990236f, 0.768872261f},
-std::array<float,2>{0.410861582f, 0.955199301f},
-std::array<float,2>{0.561758578f, 0.427751392f},
-std::array<float,2>{0.212222129f, 0.109382361f},
-std::array<float,2>{0.934000492f, 0.604099572f},
-std::array<float,2>{0.0799138397f, 0.854679108f},
-std::array<float,2>{0.782638431f, 0.263792157f},
-std::array<float,2>{0.256187707f, 0.157376543f},
-std::array<float,2>{0.666376591f, 0.662612677f},
-std::array<float,2>{0.486212999f, 0.507359266f},
-std::array<float,2>{0.624350011f, 0.0227512512f},
-std::array<float,2>{0.131931201f, 0.451339126f},
-std::array<float,2>{0.94928211f, 0.885096967f},
-std::array<float,2>{0.20630084f, 0.692282319f},
-std::array<float,2>{0.924373984f, 0.234498188f},
-std::array<float,2>{0.420237392f, 0.315260857f},
-std::array<float,2>{0.548466384f, 0.808116376f},
-std::array<float,2>{0.362301201f, 0.97189784f},
-std::array<float,2>{0.726712704f, 0.40284881f},
-std::array<float,2>{0.0484876595f, 0.0899610668f},
-std::array<float,2>{0.855094492f, 0.571417511f},
-std::array<float,2>{0.162494928f, 0.935512066f},
-std::array<float,2>{0.983949065f, 0.477716118f},
-std::array<float,2>{0.442570329f, 0.0465295576f},
-std::array<float,2>{0.582402945f, 0.555831611f},
-std::array<float,2>{0.283766687f, 0.628533721f},
-std::array<float,2>{0.632805705f, 0.155898839f},
-std::array<float,2>{0.114657365f, 0.308345586f},
-std::array<float,2>{0.771244466f, 0.83992672f},
-std::array<float,2>{0.003775588f, 0.594504356f},
-std::array<float,2>{0.829832017f, 0.119530752f},
-std::array<float,2>{0.325042963f, 0.430325836f},
-std::array<float,2>{0.703603148f, 0.96786648f},
-std::array<float,2>{0.385884494f, 0.774889588f},
-std::array<float,2>{0.507924259f, 0.348515064f},
-std::array<float,2>{0.22749494f, 0.189504504f},
-std::array<float,2>{0.883533716f, 0.734775305f},
-std::array<float,2>{0.0365701765f, 0.950777709f},
-std::array<float,2>{0.872589111f, 0.41862464f},
-std::array<float,2>{0.348889947f, 0.10018868f},
-std::array<float,2>{0.734806776f, 0.617607534f},
-std::array<float,2>{0.425207078f, 0.727539837f},
-std::array<float,2>{0.54436636f, 0.212783977f},
-std::array<float,2>{0.200010747f, 0.365369231f},
-std::array<float,2>{0.913562f, 0.763452351f},
-std::array<float,2>{0.155856833f, 0.533300459f},
-std::array<float,2>{0.96820724f, 0.052695699f},
-std::array<float,2>{0.474788666f, 0.485743403f},
-std::array<float,2>{0.594336748f, 0.916383624f},
-std::array<float,2>{0.274424493f, 0.827725232f},
-std::array<float,2>{0.681054473f, 0.290781945f},
-std::array<float,2>{0.0673810914f, 0.131098092f},
-std::array<float,2>{0.808059752f, 0.646058917f},
-std::array<float,2>{0.237451792f, 0.792461157f},
-std::array<float,2>{0.900988758f, 0.329161316f},
-std::array<float,2>{0.402215481f, 0.219001576f},
-std::array<float,2>{0.526591659f, 0.705627441f},
-std::array<float,2>{0.329893678f, 0.579422772f},
-std::array<float,2>{0.692553639f, 0.0728280544f},
-std::array<float,2>{0.0200390015f, 0.378792763f},
-std::array<float,2>{0.814726949f, 0.986030877f},
-std::array<float,2>{0.0995858759f, 0.680432379f},
-std::array<float,2>{0.757721245f, 0.173510253f},
-std::array<float,2>{0.306346178f, 0.276220232f},
-std::array<float,2>{0.650906682f, 0.860672534f},
-std::array<float,2>{0.461086631f, 0.902763844f},
-std::array<float,2>{0.564674258f, 0.45781371f},
-std::array<float,2>{0.180262536f, 0.00744753424f},
-std::array<float,2>{0.988453627f, 0.52857697f},
-std::array<float,2>{0.106558099f, 0.809729815f},
-std::array<float,2>{0.759955585f, 0.318988234f},
-std::array<float,2>{0.303179175f, 0.239676714f},
-std::array<float,2>{0.6436885f, 0.688198209f},
-std::array<float,2>{0.454513967f, 0.574920356f},
-std::array<float,2>{0.577367187f, 0.0895531774f},
-std::array<float,2>{0.17506516f, 0.401198298f},
-std::array<float,2>{0.998084724f, 0.976045489f},
-std::array<float,2>{0.244836211f, 0.656900644f},
-std::array<float,2>{0.890830219f, 0.161457121f},
-std::array<float,2>{0.392775595f, 0.260881782f},
-std::array<float,2>{0.521309674f, 0.858834922f},
-std::array<float,2>{0.337045729f, 0.8889153f},
-std::array<float,2>{0.700302184f, 0.44775027f},
-std::array<float,2>{0.0309072286f, 0.0177625045f},
-std::array<float,2>{0.824978292f, 0.501469791f},
-std::array<float,2>{0.141075328f, 0.962074518f},
-std::array<float,2>{0.959358692f, 0.437452465f},
-std::array<float,2>{0.479520619f, 0.124926895f},
-std::array<float,2>{0.602405488f, 0.599461377f},
-std::array<float,2>{0.271618724f, 0.741429687f},
-std::array<float,2>{0.675418437f, 0.192459822f},
-std::array<float,2>{0.0721958354f, 0.344500542f},
-std::array<float,2>{0.799161553f, 0.777408183f},
-std::array<float,2>{0.0440734811f, 0.561096132f},
-std::array<float,2>{0.862761021f, 0.0409880951f},
-std::array<float,2>{0.359149456f, 0.481681645f},
-std::array<float,2>{0.744872093f, 0.932060361f},
-std::array<float,2>{0.43655622f, 0.83823365f},
-std::array<float,2>{0.531704664f, 0.309577972f},
-std::array<float,2>{0.194306225f, 0.150168896f},
-std::array<float,2>{0.915118694f, 0.631245613f},
-std::array<float,2>{0.0122954249f, 0.919696987f},
-std::array<float,2>{0.842432082f, 0.490274787f},
-std::array<float,2>{0.319443583f, 0.0507086366f},
-std::array<float,2>{0.715919614f, 0.537678361f},
-std::array<float,2>{0.375186473f, 0.644419968f},
-std::array<float,2>{0.505912662f, 0.125282168f},
-std::array<float,2>{0.22645621f, 0.296007335f},
-std::array<float,2>{0.881144583f, 0.820566654f},
-std::array<float,2>{0.168891698f, 0.62244302f},
-std::array<float,2>{0.974896133f, 0.094948031f},
-std::array<float,2>{0.445365667f, 0.417037457f},
-std::array<float,2>{0.592851818f, 0.947356582f},
-std::array<float,2>{0.293906361f, 0.759637535f},
-std::array<float,2>{0.634303987f, 0.360766709f},
-std::array<float,2>{0.119329713f, 0.218504384f},
-std::array<float,2>{0.781246305f, 0.73253262f},
-std::array<float,2>{0.215235904f, 0.863540113f},
-std::array<float,2>{0.931874156f, 0.279167831f},
-std::array<float,2>{0.406932056f, 0.179328591f},
-std::array<float,2>{0.556746483f, 0.683991611f},
-std::array<float,2>{0.368672103f, 0.527075946f},
-std::array<float,2>{0.719536185f, 0.00228608819f},
-std::array<float,2>{0.0568918474f, 0.455467612f},
-std::array<float,2>{0.847460508f, 0.899830163f},
-std::array<float,2>{0.0859545246f, 0.710720122f},
-std::array<float,2>{0.794213057f, 0.226204768f},
-std::array<float,2>{0.263807088f, 0.33362788f},
-std::array<float,2>{0.663776219f, 0.794547439f},
-std::array<float,2>{0.498068631f, 0.991060674f},
-std::array<float,2>{0.612180829f, 0.381297171f},
-std::array<float,2>{0.136060998f, 0.0751805529f},
-std::array<float,2>{0.938400328f, 0.58250916f},
-std::array<float,2>{0.0527746342f, 0.819587708f},
-std::array<float,2>{0.856253564f, 0.288683355f},
-std::array<float,2>{0.365779907f, 0.137954548f},
-std::array<float,2>{0.730516672f, 0.653922498f},
-std::array<float,2>{0.416322768f, 0.541320801f},
-std::array<float,2>{0.551578581f, 0.0580785163f},
-std::array<float,2>{0.208888814f, 0.497265875f},
-std::array<float,2>{0.929319263f, 0.912679851f},
-std::array<float,2>{0.126803145f, 0.725297272f},
-std::array<float,2>{0.946258247f, 0.210932583f},
-std::array<float,2>{0.491155118f, 0.371064574f},
-std::array<float,2>{0.617413461f, 0.75252521f},
-std::array<float,2>{0.250928462f, 0.941580236f},
-std::array<float,2>{0.668005943f, 0.411829382f},
-std::array<float,2>{0.0840699002f, 0.107071862f},
-std::array<float,2>{0.786078691f, 0.611533344f},
-std::array<float,2>{0.231303677f, 0.895094752f},
-std::array<float,2>{0.88672936f, 0.466097772f},
-std::array<float,2>{0.387249082f, 0.0127257649f},
-std::array<float,2>{0.514592588f, 0.520856738f},
-std::array<float,2>{0.320408911f, 0.67581749f},
-std::array<float,2>{0.707841039f, 0.185726896f},
-std::array<float,2>{0.00657214224f, 0.272903085f},
-std::array<float,2>{0.832457244f, 0.872649729f},
-std::array<float,2>{0.110888369f, 0.590367675f},
-std::array<float,2>{0.768873036f, 0.0671759024f},
-std::array<float,2>{0.286956877f, 0.384050697f},
-std::array<float,2>{0.625289977f, 0.997422218f},
-std::array<float,2>{0.439376593f, 0.783627689f},
-std::array<float,2>{0.578349471f, 0.339843124f},
-std::array<float,2>{0.159128994f, 0.227406576f},
-std::array<float,2>{0.979388654f, 0.717215478f},
-std::array<float,2>{0.0650281012f, 0.980935872f},
-std::array<float,2>{0.809869826f, 0.39186433f},
-std::array<float,2>{0.277483344f, 0.0837463289f},
-std::array<float,2>{0.686153054f, 0.566626787f},
-std::array<float,2>{0.469168603f, 0.698891044f},
-std::array<float,2>{0.597700953f, 0.242974445f},
-std::array<float,2>{0.150977015f, 0.327510744f},
-std::array<float,2>{0.962515354f, 0.800778866f},
-std::array<float,2>{0.196073666f, 0.514913857f},
-std::array<float,2>{0.906822503f, 0.0286463425f},
-std::array<float,2>{0.42709738f, 0.437870562f},
-std::array<float,2>{0.5394665f, 0.882669747f},
-std::array<float,2>{0.345660239f, 0.845329046f},
-std::array<float,2>{0.740453541f, 0.251284033f},
-std::array<float,2>{0.0343682058f, 0.164483652f},
-std::array<float,2>{0.870566666f, 0.671184778f},
-std::array<float,2>{0.187051743f, 0.772240102f},
-std::array<float,2>{0.987115145f, 0.353001386f},
-std::array<float,2>{0.466380566f, 0.19957301f},
-std::array<float,2>{0.567253232f, 0.747575164f},
-std::array<float,2>{0.311117977f, 0.606775165f},
-std::array<float,2>{0.655825257f, 0.114263788f},
-std::array<float,2>{0.096207954f, 0.423132002f},
-std::array<float,2>{0.750606954f, 0.957090497f},
-std::array<float,2>{0.016014291f, 0.639567971f},
-std::array<float,2>{0.817337036f, 0.142545089f},
-std::array<float,2>{0.332977533f, 0.301091313f},
-std::array<float,2>{0.690156758f, 0.829967082f},
-std::array<float,2>{0.405286252f, 0.928310692f},
-std::array<float,2>{0.531034946f, 0.472905606f},
-std::array<float,2>{0.238311559f, 0.0321463831f},
-std::array<float,2>{0.904949963f, 0.549766958f},
-std::array<float,2>{0.0426494032f, 0.788844585f},
-std::array<float,2>{0.864387393f, 0.342529655f},
-std::array<float,2>{0.355190665f, 0.231827602f},
-std::array<float,2>{0.749883711f, 0.712982118f},
-std::array<float,2>{0.433227211f, 0.586107373f},
-std::array<float,2>{0.538528621f, 0.0648701265f},
-std::array<float,2>{0.190275297f, 0.39027828f},
-std::array<float,2>{0.920055568f, 0.994123697f},
-std::array<float,2>{0.144670948f, 0.675281167f},
-std::array<float,2>{0.955324113f, 0.181545913f},
-std::array<float,2>{0.480846435f, 0.266104221f},
-std::array<float,2>{0.608206868f, 0.867361307f},
-std::array<float,2>{0.266824633f, 0.89394182f},
-std::array<float,2>{0.677734077f, 0.461105853f},
-std::array<float,2>{0.0774142519f, 0.00936832186f},
-std::array<float,2>{0.804449499f, 0.51849997f},
-std::array<float,2>{0.246910751f, 0.938876629f},
-std::array<float,2>{0.895758927f, 0.406874061f},
-std::array<float,2>{0.396596551f, 0.102799162f},
-std::array<float,2>{0.516923428f, 0.616460264f},
-std::array<float,2>{0.343139499f, 0.720578432f},
-std::array<float,2>{0.698274374f, 0.203364998f},
-std::array<float,2>{0.0246483274f, 0.371664137f},
-std::array<float,2>{0.822808266f, 0.75601685f},
-std::array<float,2>{0.102037117f, 0.546317339f},
-std::array<float,2>{0.765040696f, 0.059314955f},
-std::array<float,2>{0.297453523f, 0.492844522f},
-std::array<float,2>{0.647995234f, 0.907912254f},
-std::array<float,2>{0.458543092f, 0.813726068f},
-std::array<float,2>{0.570948303f, 0.281547308f},
-std::array<float,2>{0.179615453f, 0.134904996f},
-std::array<float,2>{0.993357599f, 0.649607837f},
-std::array<float,2>{0.0900280923f, 0.923079729f},
-std::array<float,2>{0.790404975f, 0.470793724f},
-std::array<float,2>{0.258826733f, 0.0383934118f},
-std::array<float,2>{0.656681895f, 0.551666379f},
-std::array<float,2>{0.492683053f, 0.636238575f},
-std::array<float,2>{0.614706933f, 0.14741683f},
-std::array<float,2>{0.139606655f, 0.299946606f},
-std::array<float,2>{0.943399131f, 0.834385276f},
-std::array<float,2>{0.213666499f, 0.603129148f},
-std::array<float,2>{0.935878634f, 0.112666242f},
-std::array<float,2>{0.413817465f, 0.426155955f},
-std::array<float,2>{0.560372889f, 0.95361501f},
-std::array<float,2>{0.373746216f, 0.767432809f},
-std::array<float,2>{0.723903f, 0.35645625f},
-std::array<float,2>{0.0600567758f, 0.19535704f},
-std::array<float,2>{0.850523591f, 0.743776083f},
-std::array<float,2>{0.165575758f, 0.851236343f},
-std::array<float,2>{0.970956087f, 0.255132109f},
-std::array<float,2>{0.451024711f, 0.168625623f},
-std::array<float,2>{0.587037325f, 0.665163159f},
-std::array<float,2>{0.291389972f, 0.509137869f},
-std::array<float,2>{0.639173448f, 0.027272962f},
-std::array<float,2>{0.124700673f, 0.444040209f},
-std::array<float,2>{0.775070548f, 0.875477254f},
-std::array<float,2>{0.0112763969f, 0.699998081f},
-std::array<float,2>{0.839679062f, 0.249124825f},
-std::array<float,2>{0.313573569f, 0.321425915f},
-std::array<float,2>{0.713897526f, 0.803420305f},
-std::array<float,2>{0.379722685f, 0.978385091f},
-std::array<float,2>{0.50276792f, 0.397867888f},
-std::array<float,2>{0.220949709f, 0.0798248276f},
-std::array<float,2>{0.876401663f, 0.562622786f},
-std::array<float,2>{0.116759948f, 0.843503296f},
-std::array<float,2>{0.773390532f, 0.306310058f},
-std::array<float,2>{0.282317102f, 0.153668165f},
-std::array<float,2>{0.6298123f, 0.62622726f},
-std::array<float,2>{0.44341594f, 0.558512568f},
-std::array<float,2>{0.584389806f, 0.0448067859f},
-std::array<float,2>{0.160524011f, 0.478947222f},
-std::array<float,2>{0.981412649f, 0.936967671f},
-std::array<float,2>{0.230242446f, 0.736700058f},
-std::array<float,2>{0.884903371f, 0.188223317f},
-std::array<float,2>{0.383258998f, 0.350162417f},
-std::array<float,2>{0.51091522f, 0.777335942f},
-std::array<float,2>{0.326803744f, 0.964854717f},
-std::array<float,2>{0.706507206f, 0.432347536f},
-std::array<float,2>{0.000991869252f, 0.118617885f},
-std::array<float,2>{0.831629813f, 0.597249031f},
-std::array<float,2>{0.129962355f, 0.882822692f},
-std::array<float,2>{0.952100933f, 0.450589418f},
-std::array<float,2>{0.48769471f, 0.0196939893f},
-std::array<float,2>{0.622248232f, 0.504740298f},
-std::array<float,2>{0.254277766f, 0.660809219f},
-std::array<float,2>{0.665780723f, 0.159486428f},
-std::array<float,2>{0.0809416398f, 0.261978209f},
-std::array<float,2>{0.783704221f, 0.851685822f},
-std::array<float,2>{0.0506434105f, 0.572847009f},
-std::array<float,2>{0.852885783f, 0.0936419815f},
-std::array<float,2>{0.359790266f, 0.405913949f},
-std::array<float,2>{0.729649782f, 0.970083535f},
-std::array<float,2>{0.419465572f, 0.806485057f},
-std::array<float,2>{0.549705744f, 0.313551724f},
-std::array<float,2>{0.203366697f, 0.237154812f},
-std::array<float,2>{0.92230767f, 0.693859577f},
-std::array<float,2>{0.0231840014f, 0.986479521f},
-std::array<float,2>{0.814131021f, 0.376509428f},
-std::array<float,2>{0.33175993f, 0.0716240853f},
-std::array<float,2>{0.695031762f, 0.580287695f},
-std::array<float,2>{0.39874208f, 0.703230858f},
-std::array<float,2>{0.525269091f, 0.221345633f},
-std::array<float,2>{0.235865504f, 0.331583977f},
-std::array<float,2>{0.900118291f, 0.790476024f},
-std::array<float,2>{0.182829738f, 0.529721022f},
-std::array<float,2>{0.991954505f, 0.00552354706f},
-std::array<float,2>{0.464629561f, 0.460753411f},
-std::array<float,2>{0.562791705f, 0.905903995f},
-std::array<float,2>{0.308414102f, 0.862327754f},
-std::array<float,2>{0.650123894f, 0.27346918f},
-std::array<float,2>{0.101194903f, 0.174592346f},
-std::array<float,2>{0.754716039f, 0.682469368f},
-std::array<float,2>{0.202212006f, 0.765367091f},
-std::array<float,2>{0.910682321f, 0.364806533f},
-std::array<float,2>{0.423661262f, 0.213859454f},
-std::array<float,2>{0.545121491f, 0.728572071f},
-std::array<float,2>{0.350465655f, 0.620411754f},
-std::array<float,2>{0.736998796f, 0.0995361954f},
-std::array<float,2>{0.0387185104f, 0.420973778f},
-std::array<float,2>{0.874475002f, 0.953003049f},
-std::array<float,2>{0.0684388056f, 0.648292601f},
-std::array<float,2>{0.80564332f, 0.13057287f},
-std::array<float,2>{0.276530921f, 0.291895926f},
-std::array<float,2>{0.682235539f, 0.824866533f},
-std::array<float,2>{0.473655343f, 0.91568327f},
-std::array<float,2>{0.596644759f, 0.486363769f},
-std::array<float,2>{0.153271213f, 0.054001566f},
-std::array<float,2>{0.96569258f, 0.532309651f},
-std::array<float,2>{0.0733733922f, 0.780503511f},
-std::array<float,2>{0.798238039f, 0.34706074f},
-std::array<float,2>{0.269588351f, 0.194724128f},
-std::array<float,2>{0.673199296f, 0.738700092f},
-std::array<float,2>{0.477167487f, 0.600690126f},
-std::array<float,2>{0.605365515f, 0.121156543f},
-std::array<float,2>{0.143854529f, 0.4346129f},
-std::array<float,2>{0.958646357f, 0.963403463f},
-std::array<float,2>{0.193342954f, 0.628969312f},
-std::array<float,2>{0.917839825f, 0.150503233f},
-std::array<float,2>{0.433995247f, 0.310723931f},
-std::array<float,2>{0.533223212f, 0.836311221f},
-std::array<float,2>{0.35681659f, 0.931077778f},
-std::array<float,2>{0.743698955f, 0.484126031f},
-std::array<float,2>{0.0467969179f, 0.0427619666f},
-std::array<float,2>{0.860913634f, 0.559014976f},
-std::array<float,2>{0.172133908f, 0.974041164f},
-std::array<float,2>{0.997848749f, 0.399203509f},
-std::array<float,2>{0.456602216f, 0.0863870233f},
-std::array<float,2>{0.575020611f, 0.576688111f},
-std::array<float,2>{0.300844073f, 0.690921903f},
-std::array<float,2>{0.64113301f, 0.241094232f},
-std::array<float,2>{0.108044632f, 0.317138493f},
-std::array<float,2>{0.758847117f, 0.810782909f},
-std::array<float,2>{0.0286695063f, 0.502076864f},
-std::array<float,2>{0.82801342f, 0.0171007998f},
-std::array<float,2>{0.338498563f, 0.44531408f},
-std::array<float,2>{0.701964736f, 0.887742698f},
-std::array<float,2>{0.390992254f, 0.856641233f},
-std::array<float,2>{0.521664202f, 0.25970313f},
-std::array<float,2>{0.243497208f, 0.162514746f},
-std::array<float,2>{0.894093454f, 0.659007013f},
-std::array<float,2>{0.0547407568f, 0.902049601f},
-std::array<float,2>{0.843850732f, 0.453842849f},
-std::array<float,2>{0.37037012f, 0.00114531629f},
-std::array<float,2>{0.721086681f, 0.524774492f},
-std::array<float,2>{0.408575982f, 0.687205613f},
-std::array<float,2>{0.556098878f, 0.17700538f},
-std::array<float,2>{0.218473017f, 0.280608714f},
-std::array<float,2>{0.93062377f, 0.866474271f},
-std::array<float,2>{0.134682164f, 0.584345937f},
-std::array<float,2>{0.939897001f, 0.0778867081f},
-std::array<float,2>{0.496947885f, 0.380366892f},
-std::array<float,2>{0.609728754f, 0.990161061f},
-std::array<float,2>{0.263189167f, 0.796233654f},
-std::array<float,2>{0.660998344f, 0.334857941f},
-std::array<float,2>{0.0895182267f, 0.224224672f},
-std::array<float,2>{0.796089888f, 0.708339036f},
-std::array<float,2>{0.22445409f, 0.822831869f},
-std::array<float,2>{0.880447805f, 0.293594152f},
-std::array<float,2>{0.377483696f, 0.128709748f},
-std::array<float,2>{0.505617619f, 0.641227663f},
-std::array<float,2>{0.31681022f, 0.536689162f},
-std::array<float,2>{0.718397796f, 0.0483622476f},
-std::array<float,2>{0.0151536847f, 0.488468021f},
-std::array<float,2>{0.839869559f, 0.921807706f},
-std::array<float,2>{0.118202649f, 0.731357574f},
-std::array<float,2>{0.778781176f, 0.216322318f},
-std::array<float,2>{0.295494348f, 0.36299932f},
-std::array<float,2>{0.636319458f, 0.759844184f},
-std::array<float,2>{0.448583126f, 0.946758449f},
-std::array<float,2>{0.591652215f, 0.415402085f},
-std::array<float,2>{0.17151317f, 0.0962438881f},
-std::array<float,2>{0.974158406f, 0.623583853f},
-std::array<float,2>{0.00506990775f, 0.873175085f},
-std::array<float,2>{0.835080087f, 0.26964131f},
-std::array<float,2>{0.324213743f, 0.184187293f},
-std::array<float,2>{0.709059656f, 0.678426743f},
-std::array<float,2>{0.390594155f, 0.52186799f},
-std::array<float,2>{0.511973321f, 0.0149684781f},
-std::array<float,2>{0.234055012f, 0.467182159f},
-std::array<float,2>{0.890550435f, 0.898185134f},
-std::array<float,2>{0.156731442f, 0.716253638f},
-std::array<float,2>{0.977373064f, 0.229857475f},
-std::array<float,2>{0.439958304f, 0.336840212f},
-std::array<float,2>{0.580348849f, 0.782608867f},
-std::array<float,2>{0.288604856f, 0.99825114f},
-std::array<float,2>{0.628306329f, 0.385163128f},
-std::array<float,2>{0.111547939f, 0.0700806752f},
-std::array<float,2>{0.766171575f, 0.592651844f},
-std::array<float,2>{0.209921688f, 0.910472512f},
-std::array<float,2>{0.927579999f, 0.499786794f},
-std::array<float,2>{0.415534347f, 0.0559593365f},
-std::array<float,2>{0.553705692f, 0.5401209f},
-std::array<float,2>{0.363500267f, 0.6559003f},
-std::array<float,2>{0.73295188f, 0.139711186f},
-std::array<float,2>{0.052501183f, 0.285886675f},
-std::array<float,2>{0.858704984f, 0.817387998f},
-std::array<float,2>{0.083082296f, 0.610934138f},
-std::array<float,2>{0.787209809f, 0.109293036f},
-std::array<float,2>{0.252161801f, 0.414013684f},
-std::array<float,2>{0.67135781f, 0.94492799f},
-std::array<float,2>{0.488728464f, 0.750292599f},
-std::array<float,2>{0.620029509f, 0.368190318f},
-std::array<float,2>{0.128033653f, 0.207602948f},
-std::array<float,2>{0.947454512f, 0.723011672f},
-std::array<float,2>{0.0953593105f, 0.959970474f},
-std::array<float,2>{0.752772391f, 0.424822211f},
-std::array<float,2>{0.308705628f, 0.116850898f},
-std::array<float,2>{0.653306723f, 0.609254181f},
-std::array<float,2>{0.468586624f, 0.748266757f},
-std::array<float,2>{0.56944263f, 0.202769041f},
-std::array<float,2>{0.183764517f, 0.354533702f},
-std::array<float,2>{0.98469317f, 0.769976139f},
-std::array<float,2>{0.241026342f, 0.547239304f},
-std::array<float,2>{0.902937055f, 0.0333225168f},
-std::array<float,2>{0.4030689f, 0.475129932f},
-std::array<float,2>{0.529228747f, 0.927496731f},
-std::array<float,2>{0.334805876f, 0.831882894f},
-std::array<float,2>{0.687939703f, 0.303808004f},
-std::array<float,2>{0.0192360952f, 0.143087327f},
-std::array<float,2>{0.819228053f, 0.638049185f},
-std::array<float,2>{0.149596035f, 0.797411263f},
-std::array<float,2>{0.964513719f, 0.325498521f},
-std::array<float,2>{0.47142899f, 0.244566858f},
-std::array<float,2>{0.599992752f, 0.696187794f},
-std::array<float,2>{0.280407071f, 0.570070982f},
-std::array<float,2>{0.685394168f, 0.0842878893f},
-std::array<float,2>{0.0637233779f, 0.394354016f},
-std::array<float,2>{0.812064588f, 0.98293668f},
-std::array<float,2>{0.0327574015f, 0.669038117f},
-std::array<float,2>{0.868911982f, 0.167695686f},
-std::array<float,2>{0.347211927f, 0.252661049f},
-std::array<float,2>{0.73897624f, 0.846544147f},
-std::array<float,2>{0.427850664f, 0.880408943f},
-std::array<float,2>{0.54266566f, 0.440782487f},
-std::array<float,2>{0.197898433f, 0.031099895f},
-std::array<float,2>{0.910063744f, 0.512381017f},
-std::array<float,2>{0.00690115895f, 0.782268226f},
-std::array<float,2>{0.833051085f, 0.336472332f},
-std::array<float,2>{0.321543634f, 0.229509965f},
-std::array<float,2>{0.70823282f, 0.715889752f},
-std::array<float,2>{0.387889296f, 0.59229517f},
-std::array<float,2>{0.515301466f, 0.0699440837f},
-std::array<float,2>{0.23159419f, 0.384864241f},
-std::array<float,2>{0.888270438f, 0.998328447f},
-std::array<float,2>{0.159391031f, 0.678522527f},
-std::array<float,2>{0.980106056f, 0.184358343f},
-std::array<float,2>{0.437909782f, 0.269815594f},
-std::array<float,2>{0.579472125f, 0.873445332f},
-std::array<float,2>{0.285879582f, 0.898403347f},
-std::array<float,2>{0.626415014f, 0.466959298f},
-std::array<float,2>{0.109871849f, 0.0148030994f},
-std::array<float,2>{0.768504798f, 0.521682322f},
-std::array<float,2>{0.207182646f, 0.94520998f},
-std::array<float,2>{0.928095102f, 0.413596123f},
-std::array<float,2>{0.417012811f, 0.108945653f},
-std::array<float,2>{0.552212417f, 0.611149371f},
-std::array<float,2>{0.366694212f, 0.722684026f},
-std::array<float,2>{0.731993496f, 0.207764253f},
-std::array<float,2>{0.0539449267f, 0.368519098f},
-std::array<float,2>{0.856784463f, 0.750148892f},
-std::array<float,2>{0.0853846744f, 0.540338635f},
-std::array<float,2>{0.78643167f, 0.0556757823f},
-std::array<float,2>{0.251706451f, 0.499674261f},
-std::array<float,2>{0.669840395f, 0.910269916f},
-std::array<float,2>{0.491415977f, 0.817733407f},
-std::array<float,2>{0.618995428f, 0.285954297f},
-std::array<float,2>{0.12504451f, 0.139897332f},
-std::array<float,2>{0.947053969f, 0.656115413f},
-std::array<float,2>{0.0971102342f, 0.927422166f},
-std::array<float,2>{0.751182616f, 0.475517243f},
-std::array<float,2>{0.311762094f, 0.03361848f},
-std::array<float,2>{0.654670596f, 0.546915054f},
-std::array<float,2>{0.465699106f, 0.637747645f},
-std::array<float,2>{0.567403078f, 0.143426672f},
-std::array<float,2>{0.186294943f, 0.303989291f},
-std::array<float,2>{0.987750947f, 0.83170712f},
-std::array<float,2>{0.239650831f, 0.608901441f},
-std::array<float,2>{0.905592978f, 0.117090523f},
-std::array<float,2>{0.404872417f, 0.425276488f},
-std::array<float,2>{0.529759288f, 0.960402548f},
-std::array<float,2>{0.333784282f, 0.769539297f},
-std::array<float,2>{0.691270053f, 0.354796767f},
-std::array<float,2>{0.0168886967f, 0.203013077f},
-std::array<float,2>{0.817717254f, 0.748531699f},
-std::array<float,2>{0.151602224f, 0.846233964f},
-std::array<float,2>{0.961066067f, 0.252890855f},
-std::array<float,2>{0.470381171f, 0.167920977f},
-std::array<float,2>{0.598708808f, 0.669272959f},
-std::array<float,2>{0.278688639f, 0.512691975f},
-std::array<float,2>{0.686960042f, 0.0308065638f},
-std::array<float,2>{0.0656925142f, 0.440652847f},
-std::array<float,2>{0.809544921f, 0.880726516f},
-std::array<float,2>{0.0338933133f, 0.695912242f},
-std::array<float,2>{0.870002568f, 0.244229183f},
-std::array<float,2>{0.344076812f, 0.325202018f},
-std::array<float,2>{0.741887927f, 0.797662914f},
-std::array<float,2>{0.426732183f, 0.983351111f},
-std::array<float,2>{0.540310144f, 0.394068033f},
-std::array<float,2>{0.196374893f, 0.084036842f},
-std::array<float,2>{0.907595873f, 0.570046902f},
-std::array<float,2>{0.0708629787f, 0.836043835f},
-std::array<float,2>{0.800063014f, 0.310987711f},
-std::array<float,2>{0.273155212f, 0.150689811f},
-std::array<float,2>{0.673853219f, 0.62932688f},
-std::array<float,2>{0.479237407f, 0.558600247f},
-std::array<float,2>{0.602826953f, 0.0426559635f},
-std::array<float,2>{0.142311335f, 0.484211028f},
-std::array<float,2>{0.960273683f, 0.930888355f},
-std::array<float,2>{0.194793254f, 0.738473535f},
-std::array<float,2>{0.914080858f, 0.194426402f},
-std::array<float,2>{0.436366379f, 0.346870184f},
-std::array<float,2>{0.532883108f, 0.780643046f},
-std::array<float,2>{0.357423991f, 0.9636693f},
-std::array<float,2>{0.745930254f, 0.435054898f},
-std::array<float,2>{0.0430600569f, 0.121520758f},
-std::array<float,2>{0.8620193f, 0.601064086f},
-std::array<float,2>{0.174639568f, 0.887990773f},
-std::array<float,2>{0.999660611f, 0.44564724f},
-std::array<float,2>{0.454041719f, 0.0174043253f},
-std::array<float,2>{0.576815486f, 0.502424181f},
-std::array<float,2>{0.303893626f, 0.658798993f},
-std::array<float,2>{0.642866373f, 0.162165165f},
-std::array<float,2>{0.105471782f, 0.259403586f},
-std::array<float,2>{0.761701584f, 0.856701314f},
-std::array<float,2>{0.0300635733f, 0.576942086f},
-std::array<float,2>{0.826065123f, 0.0859977752f},
-std::array<float,2>{0.336402506f, 0.399154484f},
-std::array<float,2>{0.700026214f, 0.973779678f},
-std::array<float,2>{0.394327044f, 0.81103301f},
-std::array<float,2>{0.519632757f, 0.317238659f},
-std::array<float,2>{0.245148733f, 0.24079825f},
-std::array<float,2>{0.891891122f, 0.691265225f},
-std::array<float,2>{0.0581363775f, 0.989941597f},
-std::array<float,2>{0.846479535f, 0.379955679f},
-std::array<float,2>{0.367234856f, 0.0776580721f},
-std::array<float,2>{0.719833851f, 0.584168673f},
-std::array<float,2>{0.407824725f, 0.708052158f},
-std::array<float,2>{0.557676733f, 0.224370807f},
-std::array<float,2>{0.216569111f, 0.334681243f},
-std::array<float,2>{0.933444679f, 0.796071291f},
-std::array<float,2>{0.135737121f, 0.52445662f},
-std::array<float,2>{0.938615859f, 0.00143025606f},
-std::array<float,2>{0.499454111f, 0.453880608f},
-std::array<float,2>{0.613180757f, 0.902227998f},
-std::array<float,2>{0.265000373f, 0.866405129f},
-std::array<float,2>{0.662675083f, 0.280292124f},
-std::array<float,2>{0.0873064548f, 0.176788673f},
-std::array<float,2>{0.793691039f, 0.687301636f},
-std::array<float,2>{0.225241169f, 0.760073006f},
-std::array<float,2>{0.882199407f, 0.363123804f},
-std::array<float,2>{0.376103431f, 0.216645643f},
-std::array<float,2>{0.507143438f, 0.731174409f},
-std::array<float,2>{0.318481892f, 0.623826921f},
-std::array<float,2>{0.715301573f, 0.0965363234f},
-std::array<float,2>{0.0131656509f, 0.415102839f},
-std::array<float,2>{0.843475938f, 0.94648993f},
-std::array<float,2>{0.120683156f, 0.641458809f},
-std::array<float,2>{0.779364944f, 0.128559738f},
-std::array<float,2>{0.294259578f, 0.293842971f},
-std::array<float,2>{0.63317585f, 0.823034465f},
-std::array<float,2>{0.4467071f, 0.921512425f},
-std::array<float,2>{0.59245801f, 0.488682836f},
-std::array<float,2>{0.169325933f, 0.0486126877f},
-std::array<float,2>{0.976392508f, 0.536884308f},
-std::array<float,2>{0.113633797f, 0.776914001f},
-std::array<float,2>{0.769981563f, 0.350396752f},
-std::array<float,2>{0.284692317f, 0.188426077f},
-std::array<float,2>{0.631433725f, 0.736520231f},
-std::array<float,2>{0.441820592f, 0.597423673f},
-std::array<float,2>{0.583903015f, 0.118313976f},
-std::array<float,2>{0.163149744f, 0.432590544f},
-std::array<float,2>{0.982715368f, 0.965137124f},
-std::array<float,2>{0.227621987f, 0.626119792f},
-std::array<float,2>{0.884017289f, 0.153431311f},
-std::array<float,2>{0.385478318f, 0.306620657f},
-std::array<float,2>{0.509421051f, 0.843619645f},
-std::array<float,2>{0.325436801f, 0.936589241f},
-std::array<float,2>{0.704533458f, 0.478524029f},
-std::array<float,2>{0.00217393716f, 0.0445081815f},
-std::array<float,2>{0.828880548f, 0.558196843f},
-std::array<float,2>{0.131360814f, 0.969801962f},
-std::array<float,2>{0.950695634f, 0.406073987f},
-std::array<float,2>{0.484770626f, 0.0933479294f},
-std::array<float,2>{0.623312712f, 0.573087275f},
-std::array<float,2>{0.25770238f, 0.694091976f},
-std::array<float,2>{0.667509735f, 0.236872166f},
-std::array<float,2>{0.0781903714f, 0.313778818f},
-std::array<float,2>{0.781724989f, 0.806197703f},
-std::array<float,2>{0.0476441272f, 0.504575491f},
-std::array<float,2>{0.854227543f, 0.0199577287f},
-std::array<float,2>{0.363143176f, 0.450406253f},
-std::array<float,2>{0.727934241f, 0.883273721f},
-std::array<float,2>{0.421827346f, 0.851961792f},
-std::array<float,2>{0.54705447f, 0.261743516f},
-std::array<float,2>{0.205977187f, 0.15938586f},
-std::array<float,2>{0.925513387f, 0.661029816f},
-std::array<float,2>{0.0213409588f, 0.906248748f},
-std::array<float,2>{0.815722406f, 0.46055302f},
-std::array<float,2>{0.328760833f, 0.00579631794f},
-std::array<float,2>{0.692190945f, 0.529336989f},
-std::array<float,2>{0.400480241f, 0.682256281f},
-std::array<float,2>{0.526295602f, 0.174464837f},
-std::array<float,2>{0.236635789f, 0.273884475f},
-std::array<float,2>{0.901775181f, 0.862776101f},
-std::array<float,2>{0.181436345f, 0.580368161f},
-std::array<float,2>{0.989639223f, 0.0714886338f},
-std::array<float,2>{0.462824196f, 0.376718163f},
-std::array<float,2>{0.565927029f, 0.986748576f},
-std::array<float,2>{0.304864228f, 0.790168583f},
-std::array<float,2>{0.65203464f, 0.331900388f},
-std::array<float,2>{0.0980865136f, 0.221538469f},
-std::array<float,2>{0.756314874f, 0.703601301f},
-std::array<float,2>{0.200595394f, 0.825119913f},
-std::array<float,2>{0.912635148f, 0.291695058f},
-std::array<float,2>{0.424062133f, 0.130679905f},
-std::array<float,2>{0.54332602f, 0.647986114f},
-std::array<float,2>{0.347663224f, 0.532667696f},
-std::array<float,2>{0.735722244f, 0.0537169427f},
-std::array<float,2>{0.0352105163f, 0.486644685f},
-std::array<float,2>{0.871861279f, 0.915793121f},
-std::array<float,2>{0.0681073368f, 0.728965998f},
-std::array<float,2>{0.80730617f, 0.213410735f},
-std::array<float,2>{0.274361163f, 0.365033358f},
-std::array<float,2>{0.680538714f, 0.765601099f},
-std::array<float,2>{0.476186156f, 0.952762544f},
-std::array<float,2>{0.595242798f, 0.421373129f},
-std::array<float,2>{0.154779822f, 0.0991686359f},
-std::array<float,2>{0.966875672f, 0.620311618f},
-std::array<float,2>{0.0394234955f, 0.867661834f},
-std::array<float,2>{0.865700603f, 0.265707821f},
-std::array<float,2>{0.351650566f, 0.181280062f},
-std::array<float,2>{0.747110307f, 0.674834728f},
-std::array<float,2>{0.431484967f, 0.518185377f},
-std::array<float,2>{0.53644383f, 0.0095898658f},
-std::array<float,2>{0.187768877f, 0.461400956f},
-std::array<float,2>{0.91864121f, 0.893610001f},
-std::array<float,2>{0.147798628f, 0.713306487f},
-std::array<float,2>{0.954931974f, 0.231468439f},
-std::array<float,2>{0.484344423f, 0.34231618f},
-std::array<float,2>{0.605688095f, 0.788762629f},
-std::array<float,2>{0.268180609f, 0.993794918f},
-std::array<float,2>{0.678899586f, 0.390610635f},
-std::array<float,2>{0.0761383399f, 0.0646312758f},
-std::array<float,2>{0.801273644f, 0.586287558f},
-std::array<float,2>{0.248909101f, 0.907990038f},
-std::array<float,2>{0.897586405f, 0.492991477f},
-std::array<float,2>{0.394758701f, 0.0594764166f},
-std::array<float,2>{0.518517494f, 0.546090364f},
-std::array<float,2>{0.34044385f, 0.649718702f},
-std::array<float,2>{0.697156549f, 0.135059103f},
-std::array<float,2>{0.0271208379f, 0.281333029f},
-std::array<float,2>{0.82186693f, 0.813577473f},
-std::array<float,2>{0.104469083f, 0.616317987f},
-std::array<float,2>{0.762843728f, 0.102748774f},
-std::array<float,2>{0.29995504f, 0.407168776f},
-std::array<float,2>{0.646456778f, 0.938688099f},
-std::array<float,2>{0.459470004f, 0.756241679f},
-std::array<float,2>{0.574041784f, 0.371906549f},
-std::array<float,2>{0.176910296f, 0.203500047f},
-std::array<float,2>{0.996070743f, 0.72036773f},
-std::array<float,2>{0.0920864046f, 0.953948021f},
-std::array<float,2>{0.792203188f, 0.425921649f},
-std::array<float,2>{0.260885417f, 0.112403184f},
-std::array<float,2>{0.659531474f, 0.603378356f},
-std::array<float,2>{0.495002836f, 0.744058669f},
-std::array<float,2>{0.615360498f, 0.195729956f},
-std::array<float,2>{0.137964949f, 0.356702298f},
-std::array<float,2>{0.942388594f, 0.767237842f},
-std::array<float,2>{0.211819321f, 0.551502645f},
-std::array<float,2>{0.935151994f, 0.0381154083f},
-std::array<float,2>{0.411186248f, 0.47102052f},
-std::array<float,2>{0.561194718f, 0.923196852f},
-std::array<float,2>{0.372052222f, 0.834208608f},
-std::array<float,2>{0.725093722f, 0.300203562f},
-std::array<float,2>{0.0612511262f, 0.147214994f},
-std::array<float,2>{0.848142505f, 0.63661015f},
-std::array<float,2>{0.16660513f, 0.803546607f},
-std::array<float,2>{0.97069031f, 0.321709603f},
-std::array<float,2>{0.451321036f, 0.249375224f},
-std::array<float,2>{0.588556886f, 0.699787021f},
-std::array<float,2>{0.29033047f, 0.562767804f},
-std::array<float,2>{0.637164176f, 0.0799622908f},
-std::array<float,2>{0.122920416f, 0.397491992f},
-std::array<float,2>{0.776887417f, 0.978034735f},
-std::array<float,2>{0.00866545737f, 0.665417075f},
-std::array<float,2>{0.836523175f, 0.168819666f},
-std::array<float,2>{0.315535843f, 0.254945606f},
-std::array<float,2>{0.712307215f, 0.851394355f},
-std::array<float,2>{0.381460398f, 0.875103712f},
-std::array<float,2>{0.501916409f, 0.444173753f},
-std::array<float,2>{0.219456255f, 0.0270583201f},
-std::array<float,2>{0.87710464f, 0.508908808f},
-std::array<float,2>{0.0511608198f, 0.752699137f},
-std::array<float,2>{0.85747391f, 0.370623499f},
-std::array<float,2>{0.36479339f, 0.210464582f},
-std::array<float,2>{0.733964741f, 0.725584686f},
-std::array<float,2>{0.414076179f, 0.611663342f},
-std::array<float,2>{0.554276645f, 0.107392535f},
-std::array<float,2>{0.210046306f, 0.411884904f},
-std::array<float,2>{0.926204145f, 0.941740751f},
-std::array<float,2>{0.12766251f, 0.654293776f},
-std::array<float,2>{0.948405325f, 0.137804672f},
-std::array<float,2>{0.490053385f, 0.288900167f},
-std::array<float,2>{0.62108916f, 0.819532752f},
-std::array<float,2>{0.252977878f, 0.913034201f},
-std::array<float,2>{0.670482457f, 0.497455746f},
-std::array<float,2>{0.0826015472f, 0.0577179268f},
-std::array<float,2>{0.788185418f, 0.541190207f},
-std::array<float,2>{0.233128756f, 0.997163057f},
-std::array<float,2>{0.888904035f, 0.383940935f},
-std::array<float,2>{0.389495671f, 0.0671125725f},
-std::array<float,2>{0.513092816f, 0.590668619f},
-std::array<float,2>{0.322332889f, 0.716819942f},
-std::array<float,2>{0.710234344f, 0.227169231f},
-std::array<float,2>{0.00462801429f, 0.33945787f},
-std::array<float,2>{0.83484745f, 0.78324616f},
-std::array<float,2>{0.113051862f, 0.520750046f},
-std::array<float,2>{0.767217338f, 0.0131663885f},
-std::array<float,2>{0.287619025f, 0.465994775f},
-std::array<float,2>{0.627258003f, 0.895404994f},
-std::array<float,2>{0.441111088f, 0.872942209f},
-std::array<float,2>{0.581733048f, 0.272659868f},
-std::array<float,2>{0.157784998f, 0.18595542f},
-std::array<float,2>{0.97761023f, 0.676050007f},
-std::array<float,2>{0.0631559268f, 0.882516563f},
-std::array<float,2>{0.811300635f, 0.437671483f},
-std::array<float,2>{0.27984795f, 0.0283218343f},
-std::array<float,2>{0.684165597f, 0.514736652f},
-std::array<float,2>{0.472071618f, 0.671010017f},
-std::array<float,2>{0.601408839f, 0.164191484f},
-std::array<float,2>{0.149148792f, 0.251045197f},
-std::array<float,2>{0.963788033f, 0.845533133f},
-std::array<float,2>{0.199042425f, 0.566828549f},
-std::array<float,2>{0.908676624f, 0.083583273f},
-std::array<float,2>{0.428815275f, 0.391682178f},
-std::array<float,2>{0.541546464f, 0.980572283f},
-std::array<float,2>{0.346434027f, 0.800447881f},
-std::array<float,2>{0.740127146f, 0.327229917f},
-std::array<float,2>{0.0320701525f, 0.242724344f},
-std::array<float,2>{0.867321908f, 0.699061573f},
-std::array<float,2>{0.185370117f, 0.82959801f},
-std::array<float,2>{0.986197352f, 0.300795466f},
-std::array<float,2>{0.467502087f, 0.142179772f},
-std::array<float,2>{0.568396211f, 0.639381766f},
-std::array<float,2>{0.310118526f, 0.549361885f},
-std::array<float,2>{0.653589189f, 0.0317768529f},
-std::array<float,2>{0.0937759429f, 0.472790688f},
-std::array<float,2>{0.753578842f, 0.9286111f},
-std::array<float,2>{0.0177300647f, 0.74785012f},
-std::array<float,2>{0.819900572f, 0.199226379f},
-std::array<float,2>{0.335313648f, 0.352541715f},
-std::array<float,2>{0.689187765f, 0.772202432f},
-std::array<float,2>{0.403627932f, 0.957454145f},
-std::array<float,2>{0.528126717f, 0.422947586f},
-std::array<float,2>{0.241724283f, 0.114713438f},
-std::array<float,2>{0.903477013f, 0.606461287f},
-std::array<float,2>{0.109027892f, 0.858609319f},
-std::array<float,2>{0.758247554f, 0.261194885f},
-std::array<float,2>{0.302630663f, 0.161220133f},
-std::array<float,2>{0.641952515f, 0.657063067f},
-std::array<float,2>{0.455457866f, 0.501779199f},
-std::array<float,2>{0.575915933f, 0.0178333167f},
-std::array<float,2>{0.173467025f, 0.447436124f},
-std::array<float,2>{0.99632293f, 0.889121413f},
-std::array<float,2>{0.243044198f, 0.68843329f},
-std::array<float,2>{0.893062294f, 0.239278704f},
-std::array<float,2>{0.392314523f, 0.319223344f},
-std::array<float,2>{0.523305893f, 0.809853613f},
-std::array<float,2>{0.339444518f, 0.975717604f},
-std::array<float,2>{0.702695906f, 0.401063591f},
-std::array<float,2>{0.0275690556f, 0.0897431523f},
-std::array<float,2>{0.827046394f, 0.575103939f},
-std::array<float,2>{0.142640829f, 0.931814253f},
-std::array<float,2>{0.957444012f, 0.481917948f},
-std::array<float,2>{0.478164494f, 0.0405750796f},
-std::array<float,2>{0.604263425f, 0.561328471f},
-std::array<float,2>{0.27094388f, 0.630896032f},
-std::array<float,2>{0.672191858f, 0.15013881f},
-std::array<float,2>{0.0725276023f, 0.309858114f},
-std::array<float,2>{0.797729135f, 0.837955296f},
-std::array<float,2>{0.0451019555f, 0.59927839f},
-std::array<float,2>{0.859555542f, 0.124564491f},
-std::array<float,2>{0.35627988f, 0.437243819f},
-std::array<float,2>{0.742793977f, 0.962349057f},
-std::array<float,2>{0.435287505f, 0.777641177f},
-std::array<float,2>{0.534776747f, 0.344374567f},
-std::array<float,2>{0.191702127f, 0.192810535f},
-std::array<float,2>{0.916608393f, 0.741536975f},
-std::array<float,2>{0.0140684051f, 0.947640598f},
-std::array<float,2>{0.841638088f, 0.417248547f},
-std::array<float,2>{0.317679733f, 0.0951996893f},
-std::array<float,2>{0.716865838f, 0.622224987f},
-std::array<float,2>{0.378015697f, 0.732716322f},
-std::array<float,2>{0.504540086f, 0.21871838f},
-std::array<float,2>{0.223084629f, 0.360484183f},
-std::array<float,2>{0.879392803f, 0.759318352f},
-std::array<float,2>{0.170051828f, 0.538002312f},
-std::array<float,2>{0.972908497f, 0.0503533259f},
-std::array<float,2>{0.448086083f, 0.490498453f},
-std::array<float,2>{0.589922547f, 0.91950506f},
-std::array<float,2>{0.295972109f, 0.82045126f},
-std::array<float,2>{0.635098636f, 0.296177387f},
-std::array<float,2>{0.118010528f, 0.125080764f},
-std::array<float,2>{0.777909577f, 0.64410007f},
-std::array<float,2>{0.217711121f, 0.794888973f},
-std::array<float,2>{0.931559086f, 0.333860874f},
-std::array<float,2>{0.409797192f, 0.226364955f},
-std::array<float,2>{0.555508018f, 0.710453987f},
-std::array<float,2>{0.369908661f, 0.582159519f},
-std::array<float,2>{0.722628176f, 0.0748718902f},
-std::array<float,2>{0.0563641824f, 0.38101843f},
-std::array<float,2>{0.845404804f, 0.990901649f},
-std::array<float,2>{0.0885095894f, 0.683808208f},
-std::array<float,2>{0.795565665f, 0.179495782f},
-std::array<float,2>{0.262361109f, 0.279052466f},
-std::array<float,2>{0.661366761f, 0.863477647f},
-std::array<float,2>{0.497795224f, 0.899488509f},
-std::array<float,2>{0.610644817f, 0.455088675f},
-std::array<float,2>{0.133387163f, 0.00216452987f},
-std::array<float,2>{0.941215873f, 0.52713263f},
-std::array<float,2>{0.0818267912f, 0.808369815f},
-std::array<float,2>{0.784440935f, 0.315060228f},
-std::array<float,2>{0.255540341f, 0.234820664f},
-std::array<float,2>{0.664874136f, 0.692052126f},
-std::array<float,2>{0.487190306f, 0.571743131f},
-std::array<float,2>{0.62128675f, 0.0902871266f},
-std::array<float,2>{0.129127696f, 0.403237075f},
-std::array<float,2>{0.952905893f, 0.972043276f},
-std::array<float,2>{0.204649433f, 0.662870407f},
-std::array<float,2>{0.923365533f, 0.15766944f},
-std::array<float,2>{0.418508083f, 0.264153659f},
-std::array<float,2>{0.550566316f, 0.85481894f},
-std::array<float,2>{0.360494435f, 0.884818971f},
-std::array<float,2>{0.728917718f, 0.451550692f},
-std::array<float,2>{0.0489091054f, 0.0225861054f},
-std::array<float,2>{0.85250324f, 0.507657528f},
-std::array<float,2>{0.161909983f, 0.968163788f},
-std::array<float,2>{0.981660783f, 0.430623859f},
-std::array<float,2>{0.444691956f, 0.119239137f},
-std::array<float,2>{0.585116267f, 0.594472051f},
-std::array<float,2>{0.28208831f, 0.734495699f},
-std::array<float,2>{0.630650818f, 0.189846814f},
-std::array<float,2>{0.115470141f, 0.34815836f},
-std::array<float,2>{0.772187471f, 0.774623632f},
-std::array<float,2>{0.000212291037f, 0.556061268f},
-std::array<float,2>{0.830347657f, 0.0466473848f},
-std::array<float,2>{0.32798475f, 0.477949679f},
-std::array<float,2>{0.705100238f, 0.935192764f},
-std::array<float,2>{0.384504169f, 0.840170979f},
-std::array<float,2>{0.510214806f, 0.308556437f},
-std::array<float,2>{0.22904785f, 0.156087548f},
-std::array<float,2>{0.886087358f, 0.628850579f},
-std::array<float,2>{0.0376493819f, 0.916249752f},
-std::array<float,2>{0.873174071f, 0.485461056f},
-std::array<float,2>{0.35065791f, 0.0522948503f},
-std::array<float,2>{0.737663984f, 0.53349787f},
-std::array<float,2>{0.42227f, 0.646247447f},
-std::array<float,2>{0.54665494f, 0.131163836f},
-std::array<float,2>{0.201447621f, 0.290612698f},
-std::array<float,2>{0.911639333f, 0.827994466f},
-std::array<float,2>{0.154269338f, 0.617198646f},
-std::array<float,2>{0.96677351f, 0.100412905f},
-std::array<float,2>{0.47293061f, 0.418852508f},
-std::array<float,2>{0.597191095f, 0.950978696f},
-std::array<float,2>{0.275813192f, 0.763392687f},
-std::array<float,2>{0.683366954f, 0.365540922f},
-std::array<float,2>{0.0693367869f, 0.21261327f},
-std::array<float,2>{0.805869937f, 0.727965415f},
-std::array<float,2>{0.234466508f, 0.860363901f},
-std::array<float,2>{0.899035335f, 0.275960773f},
-std::array<float,2>{0.400203496f, 0.173769131f},
-std::array<float,2>{0.524273098f, 0.680318534f},
-std::array<float,2>{0.330161989f, 0.528402925f},
-std::array<float,2>{0.694023311f, 0.00761812786f},
-std::array<float,2>{0.0223838743f, 0.457712412f},
-std::array<float,2>{0.812887132f, 0.902541637f},
-std::array<float,2>{0.100082375f, 0.705821097f},
-std::array<float,2>{0.755574524f, 0.218899712f},
-std::array<float,2>{0.306660652f, 0.329436928f},
-std::array<float,2>{0.649274468f, 0.791997612f},
-std::array<float,2>{0.463025302f, 0.986161053f},
-std::array<float,2>{0.563610554f, 0.37844485f},
-std::array<float,2>{0.182224825f, 0.0730118081f},
-std::array<float,2>{0.990492105f, 0.579224288f},
-std::array<float,2>{0.0240002088f, 0.815770149f},
-std::array<float,2>{0.823677361f, 0.285132587f},
-std::array<float,2>{0.341906458f, 0.133869126f},
-std::array<float,2>{0.697611749f, 0.650462925f},
-std::array<float,2>{0.398425341f, 0.543917418f},
-std::array<float,2>{0.515658438f, 0.0623620935f},
-std::array<float,2>{0.247899726f, 0.496050715f},
-std::array<float,2>{0.894763172f, 0.909178019f},
-std::array<float,2>{0.178239524f, 0.721220255f},
-std::array<float,2>{0.99305439f, 0.205316707f},
-std::array<float,2>{0.458002716f, 0.374771327f},
-std::array<float,2>{0.571387053f, 0.754623532f},
-std::array<float,2>{0.298825711f, 0.940185428f},
-std::array<float,2>{0.647066832f, 0.410034329f},
-std::array<float,2>{0.103452183f, 0.104238279f},
-std::array<float,2>{0.763952911f, 0.613381028f},
-std::array<float,2>{0.19122389f, 0.890934229f},
-std::array<float,2>{0.920930028f, 0.464410037f},
-std::array<float,2>{0.431839794f, 0.0101930089f},
-std::array<float,2>{0.537242532f, 0.516852379f},
-std::array<float,2>{0.353645384f, 0.67210418f},
-std::array<float,2>{0.74805814f, 0.18351458f},
-std::array<float,2>{0.0415981263f, 0.269346505f},
-std::array<float,2>{0.864056349f, 0.870264828f},
-std::array<float,2>{0.0765491128f, 0.588144302f},
-std::array<float,2>{0.803558707f, 0.0634577051f},
-std::array<float,2>{0.266060293f, 0.386726648f},
-std::array<float,2>{0.676068962f, 0.994866371f},
-std::array<float,2>{0.482325435f, 0.785849571f},
-std::array<float,2>{0.60909009f, 0.340033621f},
-std::array<float,2>{0.146363586f, 0.233364627f},
-std::array<float,2>{0.956103623f, 0.711903632f},
-std::array<float,2>{0.123811305f, 0.97859174f},
-std::array<float,2>{0.774157703f, 0.394681275f},
-std::array<float,2>{0.292182803f, 0.0806797817f},
-std::array<float,2>{0.64053309f, 0.564729273f},
-std::array<float,2>{0.449240506f, 0.701404572f},
-std::array<float,2>{0.586156547f, 0.246314377f},
-std::array<float,2>{0.164462969f, 0.323366851f},
-std::array<float,2>{0.972578764f, 0.801676273f},
-std::array<float,2>{0.222300828f, 0.510323882f},
-std::array<float,2>{0.875919342f, 0.0236141924f},
-std::array<float,2>{0.380822897f, 0.442300469f},
-std::array<float,2>{0.503397763f, 0.878386796f},
-std::array<float,2>{0.313262582f, 0.849232376f},
-std::array<float,2>{0.713443756f, 0.257430255f},
-std::array<float,2>{0.0099344356f, 0.171315491f},
-std::array<float,2>{0.837964118f, 0.667947412f},
-std::array<float,2>{0.140296996f, 0.768674076f},
-std::array<float,2>{0.944842696f, 0.358230054f},
-std::array<float,2>{0.49397099f, 0.197763711f},
-std::array<float,2>{0.614152789f, 0.745779812f},
-std::array<float,2>{0.257869691f, 0.604437351f},
-std::array<float,2>{0.657512844f, 0.109798558f},
-std::array<float,2>{0.0914945751f, 0.428059638f},
-std::array<float,2>{0.789350212f, 0.955502748f},
-std::array<float,2>{0.0587764196f, 0.634702742f},
-std::array<float,2>{0.851331055f, 0.145473629f},
-std::array<float,2>{0.374273092f, 0.296981573f},
-std::array<float,2>{0.723041594f, 0.832284033f},
-std::array<float,2>{0.412942737f, 0.925569177f},
-std::array<float,2>{0.558921993f, 0.47059235f},
-std::array<float,2>{0.214034095f, 0.0364614911f},
-std::array<float,2>{0.936676562f, 0.553351104f},
-std::array<float,2>{0.0165502932f, 0.773109198f},
-std::array<float,2>{0.816749394f, 0.351816744f},
-std::array<float,2>{0.332395941f, 0.20027259f},
-std::array<float,2>{0.68978256f, 0.746338904f},
-std::array<float,2>{0.405904144f, 0.605731666f},
-std::array<float,2>{0.530552506f, 0.114225388f},
-std::array<float,2>{0.239093035f, 0.421933442f},
-std::array<float,2>{0.904676557f, 0.958969116f},
-std::array<float,2>{0.18670851f, 0.640019238f},
-std::array<float,2>{0.986733854f, 0.14093639f},
-std::array<float,2>{0.466116905f, 0.302553147f},
-std::array<float,2>{0.566661358f, 0.82869786f},
-std::array<float,2>{0.310720652f, 0.928890049f},
-std::array<float,2>{0.655320287f, 0.474016905f},
-std::array<float,2>{0.0960287973f, 0.0324657299f},
-std::array<float,2>{0.750359178f, 0.550393105f},
-std::array<float,2>{0.19564113f, 0.981844425f},
-std::array<float,2>{0.906555116f, 0.390950024f},
-std::array<float,2>{0.427302271f, 0.0825346783f},
-std::array<float,2>{0.539639175f, 0.567533731f},
-std::array<float,2>{0.34496057f, 0.69791472f},
-std::array<float,2>{0.74109602f, 0.244002014f},
-std::array<float,2>{0.0351365656f, 0.326865405f},
-std::array<float,2>{0.87083447f, 0.799297333f},
-std::array<float,2>{0.0644719303f, 0.514074743f},
-std::array<float,2>{0.810150087f, 0.028085215f},
-std::array<float,2>{0.278009087f, 0.438673228f},
-std::array<float,2>{0.686019778f, 0.881752849f},
-std::array<float,2>{0.46943152f, 0.843965471f},
-std::array<float,2>{0.598394513f, 0.250662655f},
-std::array<float,2>{0.150760472f, 0.165447876f},
-std::array<float,2>{0.961948335f, 0.670844972f},
-std::array<float,2>{0.110734589f, 0.896212399f},
-std::array<float,2>{0.769123733f, 0.465048343f},
-std::array<float,2>{0.286546767f, 0.0119341137f},
-std::array<float,2>{0.625531554f, 0.52040273f},
-std::array<float,2>{0.438529491f, 0.677522123f},
-std::array<float,2>{0.578651249f, 0.187090889f},
-std::array<float,2>{0.158361152f, 0.271930903f},
-std::array<float,2>{0.978964388f, 0.87193495f},
-std::array<float,2>{0.230836153f, 0.590912819f},
-std::array<float,2>{0.887470186f, 0.0680977106f},
-std::array<float,2>{0.386722386f, 0.383174896f},
-std::array<float,2>{0.513681531f, 0.996112704f},
-std::array<float,2>{0.320982873f, 0.784188211f},
-std::array<float,2>{0.707176208f, 0.337958127f},
-std::array<float,2>{0.00627664942f, 0.22828652f},
-std::array<float,2>{0.832682192f, 0.718198538f},
-std::array<float,2>{0.126008913f, 0.819268286f},
-std::array<float,2>{0.945540726f, 0.287275851f},
-std::array<float,2>{0.490494817f, 0.137305915f},
-std::array<float,2>{0.617956579f, 0.65282625f},
-std::array<float,2>{0.250223249f, 0.542666197f},
-std::array<float,2>{0.66866684f, 0.0570735745f},
-std::array<float,2>{0.0847256333f, 0.496897638f},
-std::array<float,2>{0.785327196f, 0.913119078f},
-std::array<float,2>{0.0532975048f, 0.725798666f},
-std::array<float,2>{0.855741143f, 0.209055081f},
-std::array<float,2>{0.365455508f, 0.369804651f},
-std::array<float,2>{0.731166303f, 0.753210962f},
-std::array<float,2>{0.41681096f, 0.942743123f},
-std::array<float,2>{0.551074207f, 0.410794973f},
-std::array<float,2>{0.208188802f, 0.105657764f},
-std::array<float,2>{0.928874731f, 0.613166869f},
-std::array<float,2>{0.0864602253f, 0.864449739f},
-std::array<float,2>{0.794739425f, 0.277477503f},
-std::array<float,2>{0.264195144f, 0.178326041f},
-std::array<float,2>{0.663141549f, 0.684824049f},
-std::array<float,2>{0.498761147f, 0.525545478f},
-std::array<float,2>{0.611654341f, 0.00368942693f},
-std::array<float,2>{0.136331528f, 0.457003474f},
-std::array<float,2>{0.937871039f, 0.899060726f},
-std::array<float,2>{0.215658411f, 0.709958911f},
-std::array<float,2>{0.932447851f, 0.225534871f},
-std::array<float,2>{0.40628314f, 0.332286596f},
-std::array<float,2>{0.557321727f, 0.793913782f},
-std::array<float,2>{0.368293762f, 0.991536856f},
-std::array<float,2>{0.719026089f, 0.382307887f},
-std::array<float,2>{0.0572827384f, 0.0758572146f},
-std::array<float,2>{0.846865177f, 0.583550036f},
-std::array<float,2>{0.168016151f, 0.918781936f},
-std::array<float,2>{0.975371897f, 0.491602361f},
-std::array<float,2>{0.446176678f, 0.0497245453f},
-std::array<float,2>{0.593544424f, 0.538104117f},
-std::array<float,2>{0.293215156f, 0.643209875f},
-std::array<float,2>{0.633912802f, 0.126396284f},
-std::array<float,2>{0.1200772f, 0.295016348f},
-std::array<float,2>{0.780562639f, 0.821668446f},
-std::array<float,2>{0.0117603149f, 0.62126112f},
-std::array<float,2>{0.842237353f, 0.0945456177f},
-std::array<float,2>{0.32019031f, 0.416225523f},
-std::array<float,2>{0.716523767f, 0.948344529f},
-std::array<float,2>{0.375828981f, 0.758528411f},
-std::array<float,2>{0.50676775f, 0.360208511f},
-std::array<float,2>{0.226016849f, 0.217435315f},
-std::array<float,2>{0.881647587f, 0.733859599f},
-std::array<float,2>{0.0447098017f, 0.961432457f},
-std::array<float,2>{0.8631832f, 0.43564415f},
-std::array<float,2>{0.358649731f, 0.123211004f},
-std::array<float,2>{0.744458795f, 0.597765028f},
-std::array<float,2>{0.437274367f, 0.740323365f},
-std::array<float,2>{0.532217264f, 0.191837251f},
-std::array<float,2>{0.193491206f, 0.345009565f},
-std::array<float,2>{0.915627897f, 0.77881664f},
-std::array<float,2>{0.141534925f, 0.562340796f},
-std::array<float,2>{0.95967716f, 0.0399094895f},
-std::array<float,2>{0.480293781f, 0.481429994f},
-std::array<float,2>{0.60202986f, 0.9327811f},
-std::array<float,2>{0.272012651f, 0.839387536f},
-std::array<float,2>{0.674976349f, 0.309114665f},
-std::array<float,2>{0.0717417449f, 0.148584321f},
-std::array<float,2>{0.799777865f, 0.632573605f},
-std::array<float,2>{0.244324416f, 0.809485316f},
-std::array<float,2>{0.891578257f, 0.320052058f},
-std::array<float,2>{0.393353701f, 0.238375738f},
-std::array<float,2>{0.520758212f, 0.688533068f},
-std::array<float,2>{0.337420702f, 0.575472116f},
-std::array<float,2>{0.701055646f, 0.0880165473f},
-std::array<float,2>{0.0303676873f, 0.401947588f},
-std::array<float,2>{0.824471354f, 0.974708796f},
-std::array<float,2>{0.107164882f, 0.657321393f},
-std::array<float,2>{0.76029104f, 0.160335198f},
-std::array<float,2>{0.303223222f, 0.260712147f},
-std::array<float,2>{0.644122481f, 0.858139396f},
-std::array<float,2>{0.454999447f, 0.889674008f},
-std::array<float,2>{0.577656388f, 0.448324829f},
-std::array<float,2>{0.175459281f, 0.0186830163f},
-std::array<float,2>{0.998660564f, 0.500928581f},
-std::array<float,2>{0.0990399644f, 0.791747391f},
-std::array<float,2>{0.757302821f, 0.328824669f},
-std::array<float,2>{0.305900931f, 0.219735771f},
-std::array<float,2>{0.650774658f, 0.706319869f},
-std::array<float,2>{0.461669236f, 0.578668952f},
-std::array<float,2>{0.56509316f, 0.0735361129f},
-std::array<float,2>{0.180150136f, 0.377832413f},
-std::array<float,2>{0.98901391f, 0.984560132f},
-std::array<float,2>{0.238006592f, 0.681365073f},
-std::array<float,2>{0.900588393f, 0.172713235f},
-std::array<float,2>{0.401383758f, 0.276871204f},
-std::array<float,2>{0.527100146f, 0.859508574f},
-std::array<float,2>{0.329105318f, 0.903527737f},
-std::array<float,2>{0.693297625f, 0.458273679f},
-std::array<float,2>{0.0195552148f, 0.00665742811f},
-std::array<float,2>{0.814995885f, 0.52816081f},
-std::array<float,2>{0.155658871f, 0.949942648f},
-std::array<float,2>{0.968634367f, 0.41975683f},
-std::array<float,2>{0.475288302f, 0.100805692f},
-std::array<float,2>{0.59410876f, 0.618175447f},
-std::array<float,2>{0.275363266f, 0.726829112f},
-std::array<float,2>{0.681548476f, 0.211101174f},
-std::array<float,2>{0.0667124465f, 0.367129594f},
-std::array<float,2>{0.808531225f, 0.762368381f},
-std::array<float,2>{0.0369233713f, 0.534625113f},
-std::array<float,2>{0.872443914f, 0.0515016094f},
-std::array<float,2>{0.349600494f, 0.48513636f},
-std::array<float,2>{0.735193253f, 0.917481422f},
-std::array<float,2>{0.425458163f, 0.826767325f},
-std::array<float,2>{0.544822693f, 0.289812714f},
-std::array<float,2>{0.199345082f, 0.132379904f},
-std::array<float,2>{0.914019048f, 0.6449157f},
-std::array<float,2>{0.00328915566f, 0.93397969f},
-std::array<float,2>{0.829290152f, 0.477224141f},
-std::array<float,2>{0.324344158f, 0.0451622531f},
-std::array<float,2>{0.703706205f, 0.555230081f},
-std::array<float,2>{0.386402994f, 0.627689421f},
-std::array<float,2>{0.508592606f, 0.154897168f},
-std::array<float,2>{0.226607397f, 0.307077587f},
-std::array<float,2>{0.882828832f, 0.841093957f},
-std::array<float,2>{0.162759289f, 0.594727218f},
-std::array<float,2>{0.983617723f, 0.120890215f},
-std::array<float,2>{0.442992866f, 0.431550145f},
-std::array<float,2>{0.582529962f, 0.967622995f},
-std::array<float,2>{0.283645749f, 0.774147511f},
-std::array<float,2>{0.631937325f, 0.348726004f},
-std::array<float,2>{0.114814326f, 0.19118467f},
-std::array<float,2>{0.770659447f, 0.736235142f},
-std::array<float,2>{0.206558526f, 0.854274929f},
-std::array<float,2>{0.923995674f, 0.265406817f},
-std::array<float,2>{0.42063731f, 0.156648412f},
-std::array<float,2>{0.548208058f, 0.663161039f},
-std::array<float,2>{0.361378312f, 0.506103098f},
-std::array<float,2>{0.727358758f, 0.0219320022f},
-std::array<float,2>{0.0481834002f, 0.453015119f},
-std::array<float,2>{0.854878068f, 0.885855019f},
-std::array<float,2>{0.0792139694f, 0.693282962f},
-std::array<float,2>{0.783174455f, 0.236110106f},
-std::array<float,2>{0.256712198f, 0.315668195f},
-std::array<float,2>{0.666873813f, 0.806665123f},
-std::array<float,2>{0.485756278f, 0.971291363f},
-std::array<float,2>{0.624846995f, 0.404083431f},
-std::array<float,2>{0.132483795f, 0.0915836543f},
-std::array<float,2>{0.949785352f, 0.570934415f},
-std::array<float,2>{0.0622080192f, 0.833868265f},
-std::array<float,2>{0.848987877f, 0.298772395f},
-std::array<float,2>{0.372776926f, 0.145881936f},
-std::array<float,2>{0.726401627f, 0.633126497f},
-std::array<float,2>{0.41062665f, 0.554511547f},
-std::array<float,2>{0.562492788f, 0.0355095044f},
-std::array<float,2>{0.21284622f, 0.469122022f},
-std::array<float,2>{0.934376359f, 0.924155593f},
-std::array<float,2>{0.136792898f, 0.745095611f},
-std::array<float,2>{0.942014277f, 0.198816448f},
-std::array<float,2>{0.495523065f, 0.35901466f},
-std::array<float,2>{0.617088735f, 0.767993033f},
-std::array<float,2>{0.260553718f, 0.956446111f},
-std::array<float,2>{0.65897578f, 0.429075658f},
-std::array<float,2>{0.0934089646f, 0.111010723f},
-std::array<float,2>{0.791383445f, 0.605221868f},
-std::array<float,2>{0.220382839f, 0.877397656f},
-std::array<float,2>{0.87868911f, 0.442832828f},
-std::array<float,2>{0.382597536f, 0.0248365868f},
-std::array<float,2>{0.500901818f, 0.510852396f},
-std::array<float,2>{0.314974934f, 0.66680038f},
-std::array<float,2>{0.711886048f, 0.17036207f},
-std::array<float,2>{0.00899360795f, 0.256791711f},
-std::array<float,2>{0.837274432f, 0.84859246f},
-std::array<float,2>{0.121864021f, 0.566255093f},
-std::array<float,2>{0.775590718f, 0.081408985f},
-std::array<float,2>{0.289722294f, 0.39642188f},
-std::array<float,2>{0.638628006f, 0.979959488f},
-std::array<float,2>{0.452303618f, 0.801830769f},
-std::array<float,2>{0.589565694f, 0.322334796f},
-std::array<float,2>{0.167357072f, 0.247310922f},
-std::array<float,2>{0.96937722f, 0.702587664f},
-std::array<float,2>{0.0750219971f, 0.995122671f},
-std::array<float,2>{0.801980674f, 0.388024002f},
-std::array<float,2>{0.268953532f, 0.063629128f},
-std::array<float,2>{0.678313255f, 0.58975333f},
-std::array<float,2>{0.483283728f, 0.712484777f},
-std::array<float,2>{0.606985867f, 0.233592495f},
-std::array<float,2>{0.146484807f, 0.341534466f},
-std::array<float,2>{0.953474104f, 0.786719203f},
-std::array<float,2>{0.18872799f, 0.515676141f},
-std::array<float,2>{0.919913054f, 0.0109835872f},
-std::array<float,2>{0.429766566f, 0.46336022f},
-std::array<float,2>{0.535647988f, 0.892076492f},
-std::array<float,2>{0.353107691f, 0.869669437f},
-std::array<float,2>{0.746895134f, 0.268122822f},
-std::array<float,2>{0.0401310287f, 0.182045028f},
-std::array<float,2>{0.86708194f, 0.673819423f},
-std::array<float,2>{0.176323682f, 0.755292237f},
-std::array<float,2>{0.994864583f, 0.373343349f},
-std::array<float,2>{0.460858554f, 0.206325769f},
-std::array<float,2>{0.572627664f, 0.722422063f},
-std::array<float,2>{0.299645424f, 0.614609599f},
-std::array<float,2>{0.645276129f, 0.10472542f},
-std::array<float,2>{0.10499692f, 0.408969998f},
-std::array<float,2>{0.762280047f, 0.941368103f},
-std::array<float,2>{0.0258257501f, 0.651925266f},
-std::array<float,2>{0.820952356f, 0.1337125f},
-std::array<float,2>{0.341377825f, 0.283953547f},
-std::array<float,2>{0.695452452f, 0.815304816f},
-std::array<float,2>{0.396441281f, 0.9099406f},
-std::array<float,2>{0.518936992f, 0.494776219f},
-std::array<float,2>{0.249293193f, 0.0610684752f},
-std::array<float,2>{0.896534383f, 0.544006526f},
-std::array<float,2>{0.0326100513f, 0.798564076f},
-std::array<float,2>{0.868180692f, 0.324606687f},
-std::array<float,2>{0.347087532f, 0.245794609f},
-std::array<float,2>{0.738498449f, 0.696422994f},
-std::array<float,2>{0.428423345f, 0.569163799f},
-std::array<float,2>{0.542062104f, 0.0853554457f},
-std::array<float,2>{0.197531372f, 0.393042237f},
-std::array<float,2>{0.909447193f, 0.983863592f},
-std::array<float,2>{0.150043547f, 0.668608665f},
-std::array<float,2>{0.96424526f, 0.166577756f},
-std::array<float,2>{0.471166462f, 0.253117323f},
-std::array<float,2>{0.600360453f, 0.846717954f},
-std::array<float,2>{0.280949175f, 0.879405439f},
-std::array<float,2>{0.684663117f, 0.440386891f},
-std::array<float,2>{0.0643816069f, 0.029409742f},
-std::array<float,2>{0.811635494f, 0.513154507f},
-std::array<float,2>{0.240468413f, 0.959123731f},
-std::array<float,2>{0.902789772f, 0.424515992f},
-std::array<float,2>{0.402473778f, 0.116038501f},
-std::array<float,2>{0.528376937f, 0.608234823f},
-std::array<float,2>{0.334392399f, 0.749907255f},
-std::array<float,2>{0.688247323f, 0.201396257f},
-std::array<float,2>{0.0190384444f, 0.353992403f},
-std::array<float,2>{0.818616569f, 0.771395445f},
-std::array<float,2>{0.0950986519f, 0.548005819f},
-std::array<float,2>{0.752398193f, 0.0348735154f},
-std::array<float,2>{0.309303373f, 0.475787163f},
-std::array<float,2>{0.652380645f, 0.926526904f},
-std::array<float,2>{0.468054086f, 0.830852687f},
-std::array<float,2>{0.570012093f, 0.303590417f},
-std::array<float,2>{0.184166387f, 0.143694237f},
-std::array<float,2>{0.98497504f, 0.637023091f},
-std::array<float,2>{0.0838792622f, 0.911929309f},
-std::array<float,2>{0.788003683f, 0.498566657f},
-std::array<float,2>{0.25262785f, 0.0546935871f},
-std::array<float,2>{0.671561778f, 0.539720178f},
-std::array<float,2>{0.488786519f, 0.655153036f},
-std::array<float,2>{0.619220614f, 0.138757855f},
-std::array<float,2>{0.12842983f, 0.286958963f},
-std::array<float,2>{0.948014975f, 0.81714654f},
-std::array<float,2>{0.209313408f, 0.609472275f},
-std::array<float,2>{0.927148819f, 0.108141772f},
-std::array<float,2>{0.415367335f, 0.412451357f},
-std::array<float,2>{0.55288738f, 0.944258869f},
-std::array<float,2>{0.364230037f, 0.750976622f},
-std::array<float,2>{0.732562006f, 0.367332876f},
-std::array<float,2>{0.0522244461f, 0.208165795f},
-std::array<float,2>{0.859175622f, 0.724585474f},
-std::array<float,2>{0.156795725f, 0.874291718f},
-std::array<float,2>{0.977006733f, 0.271015704f},
-std::array<float,2>{0.439548105f, 0.184860036f},
-std::array<float,2>{0.580973029f, 0.679379344f},
-std::array<float,2>{0.288348496f, 0.523101628f},
-std::array<float,2>{0.628443778f, 0.0142862834f},
-std::array<float,2>{0.111871973f, 0.468304753f},
-std::array<float,2>{0.765992463f, 0.896736979f},
-std::array<float,2>{0.00561529631f, 0.715802729f},
-std::array<float,2>{0.835757077f, 0.22885631f},
-std::array<float,2>{0.323518544f, 0.337655753f},
-std::array<float,2>{0.709527433f, 0.781366646f},
-std::array<float,2>{0.389793277f, 0.999312818f},
-std::array<float,2>{0.512564838f, 0.386590093f},
-std::array<float,2>{0.233519837f, 0.0690252855f},
-std::array<float,2>{0.889735579f, 0.593077898f},
-std::array<float,2>{0.118802525f, 0.823942482f},
-std::array<float,2>{0.77925849f, 0.294757247f},
-std::array<float,2>{0.295336306f, 0.127574801f},
-std::array<float,2>{0.635831356f, 0.642501175f},
-std::array<float,2>{0.449082524f, 0.535963356f},
-std::array<float,2>{0.590914369f, 0.0470216423f},
-std::array<float,2>{0.170939639f, 0.490075111f},
-std::array<float,2>{0.973739266f, 0.920068026f},
-std::array<float,2>{0.224051788f, 0.731682956f},
-std::array<float,2>{0.880167246f, 0.215442553f},
-std::array<float,2>{0.37699759f, 0.362259239f},
-std::array<float,2>{0.505025029f, 0.761239707f},
-std::array<float,2>{0.316934884f, 0.945383668f},
-std::array<float,2>{0.71791631f, 0.414537758f},
-std::array<float,2>{0.0147838853f, 0.0975956246f},
-std::array<float,2>{0.840451717f, 0.624920309f},
-std::array<float,2>{0.133872226f, 0.900709152f},
-std::array<float,2>{0.940389097f, 0.454214871f},
-std::array<float,2>{0.496580154f, 0.000782175397f},
-std::array<float,2>{0.610326231f, 0.523838997f},
-std::array<float,2>{0.262895405f, 0.685888827f},
-std::array<float,2>{0.660388708f, 0.176457748f},
-std::array<float,2>{0.0888802782f, 0.280141622f},
-std::array<float,2>{0.796742737f, 0.86531198f},
-std::array<float,2>{0.0553976558f, 0.585671246f},
-std::array<float,2>{0.844338894f, 0.0768872201f},
-std::array<float,2>{0.370748729f, 0.379099786f},
-std::array<float,2>{0.721370399f, 0.988286912f},
-std::array<float,2>{0.409055948f, 0.794956744f},
-std::array<float,2>{0.556388259f, 0.335406005f},
-std::array<float,2>{0.218148261f, 0.223405868f},
-std::array<float,2>{0.930136263f, 0.707300901f},
-std::array<float,2>{0.0292101596f, 0.973551989f},
-std::array<float,2>{0.827517867f, 0.400110424f},
-std::array<float,2>{0.338300705f, 0.0878900215f},
-std::array<float,2>{0.701582313f, 0.577803552f},
-std::array<float,2>{0.391380697f, 0.690386593f},
-std::array<float,2>{0.522372365f, 0.242054909f},
-std::array<float,2>{0.244094774f, 0.318072498f},
-std::array<float,2>{0.8939237f, 0.811930716f},
-std::array<float,2>{0.172437519f, 0.502996325f},
-std::array<float,2>{0.9970963f, 0.0158622563f},
-std::array<float,2>{0.456098944f, 0.446782112f},
-std::array<float,2>{0.574616313f, 0.887408853f},
-std::array<float,2>{0.301399201f, 0.855929315f},
-std::array<float,2>{0.641054869f, 0.258712828f},
-std::array<float,2>{0.107681677f, 0.163114235f},
-std::array<float,2>{0.759295583f, 0.65972501f},
-std::array<float,2>{0.192482978f, 0.780036628f},
-std::array<float,2>{0.917326391f, 0.345811129f},
-std::array<float,2>{0.434192091f, 0.19360812f},
-std::array<float,2>{0.533698857f, 0.739612162f},
-std::array<float,2>{0.357169151f, 0.600506842f},
-std::array<float,2>{0.743185043f, 0.122561142f},
-std::array<float,2>{0.0461461842f, 0.433639377f},
-std::array<float,2>{0.860720277f, 0.964604616f},
-std::array<float,2>{0.0740472153f, 0.630022407f},
-std::array<float,2>{0.798446178f, 0.152173623f},
-std::array<float,2>{0.270105004f, 0.311787277f},
-std::array<float,2>{0.673529565f, 0.837508976f},
-std::array<float,2>{0.476800233f, 0.930085301f},
-std::array<float,2>{0.604608953f, 0.482504129f},
-std::array<float,2>{0.144097045f, 0.0415845998f},
-std::array<float,2>{0.958154976f, 0.559760988f},
-std::array<float,2>{0.0690769032f, 0.764606893f},
-std::array<float,2>{0.804736733f, 0.363793194f},
-std::array<float,2>{0.277198046f, 0.214342386f},
-std::array<float,2>{0.681927919f, 0.729885757f},
-std::array<float,2>{0.474249035f, 0.619906187f},
-std::array<float,2>{0.596154749f, 0.0978128687f},
-std::array<float,2>{0.15239577f, 0.42064786f},
-std::array<float,2>{0.965290487f, 0.952048123f},
-std::array<float,2>{0.202762321f, 0.647231877f},
-std::array<float,2>{0.910356879f, 0.129103273f},
-std::array<float,2>{0.423144549f, 0.292426527f},
-std::array<float,2>{0.545663059f, 0.825995326f},
-std::array<float,2>{0.349628985f, 0.914955139f},
-std::array<float,2>{0.736765742f, 0.488123864f},
-std::array<float,2>{0.0383547433f, 0.052930247f},
-std::array<float,2>{0.874905586f, 0.531557322f},
-std::array<float,2>{0.183366552f, 0.987530947f},
-std::array<float,2>{0.991230965f, 0.375966489f},
-std::array<float,2>{0.46410349f, 0.0705134049f},
-std::array<float,2>{0.563059628f, 0.581923962f},
-std::array<float,2>{0.307944357f, 0.704669178f},
-std::array<float,2>{0.64969182f, 0.22226356f},
-std::array<float,2>{0.100828342f, 0.330091476f},
-std::array<float,2>{0.7540344f, 0.789498448f},
-std::array<float,2>{0.022556318f, 0.530409634f},
-std::array<float,2>{0.813620865f, 0.00432407623f},
-std::array<float,2>{0.33113569f, 0.459703237f},
-std::array<float,2>{0.694362819f, 0.904588997f},
-std::array<float,2>{0.398979783f, 0.861438632f},
-std::array<float,2>{0.524538636f, 0.27509895f},
-std::array<float,2>{0.235531092f, 0.175662473f},
-std::array<float,2>{0.899859309f, 0.682666838f},
-std::array<float,2>{0.0500164479f, 0.884431601f},
-std::array<float,2>{0.853455663f, 0.44941628f},
-std::array<float,2>{0.36008063f, 0.0207091998f},
-std::array<float,2>{0.730254173f, 0.505272746f},
-std::array<float,2>{0.419425339f, 0.662054896f},
-std::array<float,2>{0.549210787f, 0.158236712f},
-std::array<float,2>{0.203759268f, 0.263661385f},
-std::array<float,2>{0.922648966f, 0.852639079f},
-std::array<float,2>{0.13064529f, 0.573821902f},
-std::array<float,2>{0.951635063f, 0.0919764936f},
-std::array<float,2>{0.48785916f, 0.405166537f},
-std::array<float,2>{0.622975826f, 0.969154119f},
-std::array<float,2>{0.254872233f, 0.805428088f},
-std::array<float,2>{0.665513396f, 0.313343614f},
-std::array<float,2>{0.0803847164f, 0.23786664f},
-std::array<float,2>{0.783315718f, 0.694974661f},
-std::array<float,2>{0.229812801f, 0.842249334f},
-std::array<float,2>{0.88526988f, 0.304956168f},
-std::array<float,2>{0.383659065f, 0.153302714f},
-std::array<float,2>{0.511466026f, 0.625103295f},
-std::array<float,2>{0.326416761f, 0.55680871f},
-std::array<float,2>{0.706842184f, 0.0438093171f},
-std::array<float,2>{0.0015074847f, 0.480008572f},
-std::array<float,2>{0.83121258f, 0.935574591f},
-std::array<float,2>{0.116215184f, 0.73805362f},
-std::array<float,2>{0.772757351f, 0.189341128f},
-std::array<float,2>{0.283091813f, 0.351526171f},
-std::array<float,2>{0.628907204f, 0.775554001f},
-std::array<float,2>{0.444326848f, 0.966481984f},
-std::array<float,2>{0.584722161f, 0.432775557f},
-std::array<float,2>{0.160799369f, 0.11796508f},
-std::array<float,2>{0.980623484f, 0.596548975f},
-std::array<float,2>{0.0107527971f, 0.850127101f},
-std::array<float,2>{0.839178503f, 0.254289925f},
-std::array<float,2>{0.314332426f, 0.169520319f},
-std::array<float,2>{0.714782596f, 0.664992452f},
-std::array<float,2>{0.378993869f, 0.508314371f},
-std::array<float,2>{0.502173662f, 0.0257178023f},
-std::array<float,2>{0.221516937f, 0.444410533f},
-std::array<float,2>{0.876484692f, 0.876438379f},
-std::array<float,2>{0.165086657f, 0.70097965f},
-std::array<float,2>{0.971201003f, 0.248531476f},
-std::array<float,2>{0.45028016f, 0.320939928f},
-std::array<float,2>{0.587411702f, 0.804592907f},
-std::array<float,2>{0.291813582f, 0.976654589f},
-std::array<float,2>{0.638787985f, 0.396931857f},
-std::array<float,2>{0.12436299f, 0.078474395f},
-std::array<float,2>{0.7748909f, 0.563602388f},
-std::array<float,2>{0.213110611f, 0.921897829f},
-std::array<float,2>{0.936345637f, 0.472315639f},
-std::array<float,2>{0.413128316f, 0.0373589098f},
-std::array<float,2>{0.559674561f, 0.552312672f},
-std::array<float,2>{0.37352097f, 0.635596514f},
-std::array<float,2>{0.724554539f, 0.1478692f},
-std::array<float,2>{0.0605059415f, 0.299755782f},
-std::array<float,2>{0.849875987f, 0.835921824f},
-std::array<float,2>{0.0904507935f, 0.602074206f},
-std::array<float,2>{0.790838122f, 0.112097487f},
-std::array<float,2>{0.259310901f, 0.427438825f},
-std::array<float,2>{0.657215714f, 0.95482713f},
-std::array<float,2>{0.492586792f, 0.766340852f},
-std::array<float,2>{0.614880443f, 0.356323034f},
-std::array<float,2>{0.13875702f, 0.196787313f},
-std::array<float,2>{0.943925202f, 0.742724776f},
-std::array<float,2>{0.102397718f, 0.937769055f},
-std::array<float,2>{0.765539467f, 0.407771051f},
-std::array<float,2>{0.296903789f, 0.101814106f},
-std::array<float,2>{0.647804141f, 0.6158427f},
-std::array<float,2>{0.458153456f, 0.718814015f},
-std::array<float,2>{0.570724607f, 0.20462358f},
-std::array<float,2>{0.178840443f, 0.372076333f},
-std::array<float,2>{0.993655682f, 0.757363617f},
-std::array<float,2>{0.246224016f, 0.545394003f},
-std::array<float,2>{0.89631319f, 0.0605467111f},
-std::array<float,2>{0.39720729f, 0.493241966f},
-std::array<float,2>{0.517540991f, 0.907087743f},
-std::array<float,2>{0.343400061f, 0.812611401f},
-std::array<float,2>{0.698787451f, 0.28251937f},
-std::array<float,2>{0.0250191521f, 0.136206985f},
-std::array<float,2>{0.822295666f, 0.648818672f},
-std::array<float,2>{0.145304978f, 0.787143409f},
-std::array<float,2>{0.956009388f, 0.343624502f},
-std::array<float,2>{0.481113434f, 0.23129493f},
-std::array<float,2>{0.607596338f, 0.714784265f},
-std::array<float,2>{0.267110139f, 0.587063372f},
-std::array<float,2>{0.677070796f, 0.0661006719f},
-std::array<float,2>{0.0777825937f, 0.38895461f},
-std::array<float,2>{0.803822279f, 0.992970109f},
-std::array<float,2>{0.0422918089f, 0.674004555f},
-std::array<float,2>{0.865145802f, 0.180307299f},
-std::array<float,2>{0.354892164f, 0.267241657f},
-std::array<float,2>{0.749064505f, 0.8687042f},
-std::array<float,2>{0.432891846f, 0.893251061f},
-std::array<float,2>{0.538812637f, 0.462420225f},
-std::array<float,2>{0.189705238f, 0.00858107675f},
-std::array<float,2>{0.920440435f, 0.519522548f},
-std::array<float,2>{0.0310697928f, 0.81236738f},
-std::array<float,2>{0.824933469f, 0.317667425f},
-std::array<float,2>{0.337239981f, 0.241559014f},
-std::array<float,2>{0.700603068f, 0.689712048f},
-std::array<float,2>{0.392922163f, 0.57728821f},
-std::array<float,2>{0.521054864f, 0.0873824507f},
-std::array<float,2>{0.244941041f, 0.399429053f},
-std::array<float,2>{0.891038358f, 0.973123312f},
-std::array<float,2>{0.174923047f, 0.659246206f},
-std::array<float,2>{0.998366535f, 0.163902715f},
-std::array<float,2>{0.454275787f, 0.258291095f},
-std::array<float,2>{0.57742697f, 0.856414497f},
-std::array<float,2>{0.30286628f, 0.887134314f},
-std::array<float,2>{0.644017458f, 0.446752161f},
-std::array<float,2>{0.10673698f, 0.0161272008f},
-std::array<float,2>{0.760063648f, 0.503480852f},
-std::array<float,2>{0.19388786f, 0.964320183f},
-std::array<float,2>{0.915319324f, 0.434170336f},
-std::array<float,2>{0.436995536f, 0.122315019f},
-std::array<float,2>{0.531292379f, 0.599677145f},
-std::array<float,2>{0.358919084f, 0.739815891f},
-std::array<float,2>{0.744993687f, 0.194167465f},
-std::array<float,2>{0.044338394f, 0.346393973f},
-std::array<float,2>{0.862502754f, 0.779770494f},
-std::array<float,2>{0.0719146058f, 0.560513794f},
-std::array<float,2>{0.798962474f, 0.0414996147f},
-std::array<float,2>{0.271904826f, 0.482971787f},
-std::array<float,2>{0.675576687f, 0.930602074f},
-std::array<float,2>{0.479791254f, 0.837087333f},
-std::array<float,2>{0.602058589f, 0.312264472f},
-std::array<float,2>{0.140814543f, 0.151487097f},
-std::array<float,2>{0.959037721f, 0.630600095f},
-std::array<float,2>{0.119561628f, 0.920870245f},
-std::array<float,2>{0.780976057f, 0.489267051f},
-std::array<float,2>{0.293580711f, 0.0474488549f},
-std::array<float,2>{0.634734333f, 0.535499275f},
-std::array<float,2>{0.445582718f, 0.64177227f},
-std::array<float,2>{0.59318471f, 0.127383068f},
-std::array<float,2>{0.168659478f, 0.294154197f},
-std::array<float,2>{0.974805593f, 0.823518455f},
-std::array<float,2>{0.22626479f, 0.624209106f},
-std::array<float,2>{0.881007075f, 0.0967038646f},
-std::array<float,2>{0.375472009f, 0.414586872f},
-std::array<float,2>{0.506266177f, 0.946265697f},
-std::array<float,2>{0.319824159f, 0.760910928f},
-std::array<float,2>{0.716225684f, 0.361361831f},
-std::array<float,2>{0.0125762867f, 0.215043262f},
-std::array<float,2>{0.842546642f, 0.732094467f},
-std::array<float,2>{0.135965094f, 0.865921378f},
-std::array<float,2>{0.938195944f, 0.279474556f},
-std::array<float,2>{0.498330742f, 0.176063225f},
-std::array<float,2>{0.611899137f, 0.686259508f},
-std::array<float,2>{0.263983339f, 0.524363875f},
-std::array<float,2>{0.663917124f, 0.000331776071f},
-std::array<float,2>{0.0864137784f, 0.455044806f},
-std::array<float,2>{0.794096708f, 0.901284575f},
-std::array<float,2>{0.0566706322f, 0.70775789f},
-std::array<float,2>{0.847305477f, 0.222871542f},
-std::array<float,2>{0.369096875f, 0.335627437f},
-std::array<float,2>{0.719376087f, 0.795761406f},
-std::array<float,2>{0.407209188f, 0.988986313f},
-std::array<float,2>{0.556978166f, 0.379868001f},
-std::array<float,2>{0.214900509f, 0.0763780847f},
-std::array<float,2>{0.932096243f, 0.58532393f},
-std::array<float,2>{0.0843604207f, 0.81680733f},
-std::array<float,2>{0.785792351f, 0.286612093f},
-std::array<float,2>{0.250491172f, 0.139331758f},
-std::array<float,2>{0.668419778f, 0.654374778f},
-std::array<float,2>{0.490928978f, 0.539509714f},
-std::array<float,2>{0.617604971f, 0.0554023758f},
-std::array<float,2>{0.126681685f, 0.498440742f},
-std::array<float,2>{0.946035743f, 0.911613703f},
-std::array<float,2>{0.208572075f, 0.723964751f},
-std::array<float,2>{0.929544806f, 0.2085796f},
-std::array<float,2>{0.41602537f, 0.368122876f},
-std::array<float,2>{0.551352203f, 0.751890838f},
-std::array<float,2>{0.366084814f, 0.943491101f},
-std::array<float,2>{0.73077476f, 0.412674099f},
-std::array<float,2>{0.0530842356f, 0.107449695f},
-std::array<float,2>{0.856164515f, 0.609946966f},
-std::array<float,2>{0.158870026f, 0.89727211f},
-std::array<float,2>{0.979016423f, 0.467849702f},
-std::array<float,2>{0.439036191f, 0.0137671297f},
-std::array<float,2>{0.578548849f, 0.522801995f},
-std::array<float,2>{0.28681165f, 0.679166377f},
-std::array<float,2>{0.625089884f, 0.185393989f},
-std::array<float,2>{0.111148126f, 0.270808995f},
-std::array<float,2>{0.768720508f, 0.87490958f},
-std::array<float,2>{0.00662915083f, 0.593361676f},
-std::array<float,2>{0.832048059f, 0.0687251016f},
-std::array<float,2>{0.320777714f, 0.386210203f},
-std::array<float,2>{0.707746446f, 0.999641061f},
-std::array<float,2>{0.387547046f, 0.781999171f},
-std::array<float,2>{0.514297307f, 0.337046564f},
-std::array<float,2>{0.231132984f, 0.229031354f},
-std::array<float,2>{0.887190759f, 0.715005755f},
-std::array<float,2>{0.034608081f, 0.984027624f},
-std::array<float,2>{0.870304346f, 0.393149883f},
-std::array<float,2>{0.345280141f, 0.0856345072f},
-std::array<float,2>{0.740657568f, 0.568759322f},
-std::array<float,2>{0.426926196f, 0.697204232f},
-std::array<float,2>{0.539243162f, 0.245393425f},
-std::array<float,2>{0.195966974f, 0.324774921f},
-std::array<float,2>{0.907149673f, 0.798139751f},
-std::array<float,2>{0.151255086f, 0.513635874f},
-std::array<float,2>{0.96278882f, 0.0302059036f},
-std::array<float,2>{0.468807995f, 0.439530283f},
-std::array<float,2>{0.598001599f, 0.879388154f},
-std::array<float,2>{0.27782324f, 0.847484708f},
-std::array<float,2>{0.686396003f, 0.253725588f},
-std::array<float,2>{0.0652291402f, 0.166093007f},
-std::array<float,2>{0.809667408f, 0.668015957f},
-std::array<float,2>{0.238677904f, 0.770919085f},
-std::array<float,2>{0.905170381f, 0.354347229f},
-std::array<float,2>{0.405634582f, 0.202010646f},
-std::array<float,2>{0.530853271f, 0.749083042f},
-std::array<float,2>{0.332722723f, 0.607817769f},
-std::array<float,2>{0.690252781f, 0.115632758f},
-std::array<float,2>{0.0157344379f, 0.424288601f},
-std::array<float,2>{0.817067266f, 0.959921062f},
-std::array<float,2>{0.0965874866f, 0.637386501f},
-std::array<float,2>{0.750913322f, 0.144084156f},
-std::array<float,2>{0.311432272f, 0.303202629f},
-std::array<float,2>{0.656086206f, 0.830170989f},
-std::array<float,2>{0.466710299f, 0.925803065f},
-std::array<float,2>{0.567006588f, 0.476102054f},
-std::array<float,2>{0.18734841f, 0.0346513353f},
-std::array<float,2>{0.986839652f, 0.548517823f},
-std::array<float,2>{0.104623333f, 0.757240117f},
-std::array<float,2>{0.761934757f, 0.372791946f},
-std::array<float,2>{0.298848718f, 0.2041177f},
-std::array<float,2>{0.644704044f, 0.719564259f},
-std::array<float,2>{0.460019737f, 0.615643144f},
-std::array<float,2>{0.573110998f, 0.102109723f},
-std::array<float,2>{0.176199675f, 0.407328814f},
-std::array<float,2>{0.994558752f, 0.938175023f},
-std::array<float,2>{0.249711886f, 0.649236381f},
-std::array<float,2>{0.897266388f, 0.136507884f},
-std::array<float,2>{0.395919532f, 0.283175677f},
-std::array<float,2>{0.51921308f, 0.813267291f},
-std::array<float,2>{0.340939552f, 0.906375349f},
-std::array<float,2>{0.696076035f, 0.493681818f},
-std::array<float,2>{0.0258844756f, 0.0598875284f},
-std::array<float,2>{0.820545673f, 0.545465231f},
-std::array<float,2>{0.147402629f, 0.992398381f},
-std::array<float,2>{0.953730345f, 0.389426351f},
-std::array<float,2>{0.482775986f, 0.0656541139f},
-std::array<float,2>{0.606482208f, 0.587575793f},
-std::array<float,2>{0.269127101f, 0.714021206f},
-std::array<float,2>{0.678130388f, 0.230485335f},
-std::array<float,2>{0.0744800791f, 0.342795819f},
-std::array<float,2>{0.802525043f, 0.788074732f},
-std::array<float,2>{0.040775612f, 0.518832386f},
-std::array<float,2>{0.86640656f, 0.00790282991f},
-std::array<float,2>{0.352748901f, 0.461985737f},
-std::array<float,2>{0.746528387f, 0.892667055f},
-std::array<float,2>{0.430349797f, 0.868205249f},
-std::array<float,2>{0.535360456f, 0.266842812f},
-std::array<float,2>{0.189359859f, 0.180163518f},
-std::array<float,2>{0.919216633f, 0.674630761f},
-std::array<float,2>{0.00952995755f, 0.876821995f},
-std::array<float,2>{0.837423027f, 0.445306242f},
-std::array<float,2>{0.314718515f, 0.0263203904f},
-std::array<float,2>{0.711366236f, 0.508076608f},
-std::array<float,2>{0.382147908f, 0.664335072f},
-std::array<float,2>{0.500133395f, 0.169317365f},
-std::array<float,2>{0.219927892f, 0.254633516f},
-std::array<float,2>{0.878069818f, 0.849902272f},
-std::array<float,2>{0.16765967f, 0.564219117f},
-std::array<float,2>{0.968911767f, 0.0786336064f},
-std::array<float,2>{0.453034222f, 0.397453755f},
-std::array<float,2>{0.589065313f, 0.977150917f},
-std::array<float,2>{0.289374799f, 0.80413729f},
-std::array<float,2>{0.638006926f, 0.320700675f},
-std::array<float,2>{0.121334016f, 0.248902515f},
-std::array<float,2>{0.776354969f, 0.700433373f},
-std::array<float,2>{0.21193102f, 0.83534795f},
-std::array<float,2>{0.933655381f, 0.299040377f},
-std::array<float,2>{0.411103219f, 0.148054361f},
-std::array<float,2>{0.561872125f, 0.634887755f},
-std::array<float,2>{0.372553349f, 0.551850677f},
-std::array<float,2>{0.72563231f, 0.0378135182f},
-std::array<float,2>{0.0619708523f, 0.471715927f},
-std::array<float,2>{0.849386334f, 0.922706246f},
-std::array<float,2>{0.0929161534f, 0.74225837f},
-std::array<float,2>{0.791939795f, 0.196602732f},
-std::array<float,2>{0.259899527f, 0.355597317f},
-std::array<float,2>{0.658634126f, 0.76571089f},
-std::array<float,2>{0.495838404f, 0.954326987f},
-std::array<float,2>{0.616285563f, 0.427063078f},
-std::array<float,2>{0.137491331f, 0.111601792f},
-std::array<float,2>{0.941443086f, 0.601635337f},
-std::array<float,2>{0.048603531f, 0.853387237f},
-std::array<float,2>{0.85525763f, 0.263151973f},
-std::array<float,2>{0.361918718f, 0.158703357f},
-std::array<float,2>{0.726823449f, 0.661560237f},
-std::array<float,2>{0.419973701f, 0.505570233f},
-std::array<float,2>{0.54881829f, 0.0212351009f},
-std::array<float,2>{0.20625113f, 0.450030684f},
-std::array<float,2>{0.924666643f, 0.884083211f},
-std::array<float,2>{0.132145435f, 0.694359541f},
-std::array<float,2>{0.949506223f, 0.237695575f},
-std::array<float,2>{0.485952318f, 0.312699974f},
-std::array<float,2>{0.624178648f, 0.804980516f},
-std::array<float,2>{0.25595966f, 0.969591916f},
-std::array<float,2>{0.666040421f, 0.40453425f},
-std::array<float,2>{0.0796345547f, 0.0925032571f},
-std::array<float,2>{0.782329679f, 0.573456943f},
-std::array<float,2>{0.227282479f, 0.936505258f},
-std::array<float,2>{0.883620262f, 0.479906321f},
-std::array<float,2>{0.38614592f, 0.0434406847f},
-std::array<float,2>{0.508102775f, 0.557432532f},
-std::array<float,2>{0.324789673f, 0.625725865f},
-std::array<float,2>{0.70326519f, 0.152469367f},
-std::array<float,2>{0.00349509902f, 0.305493087f},
-std::array<float,2>{0.829870582f, 0.842626274f},
-std::array<float,2>{0.114410423f, 0.595895231f},
-std::array<float,2>{0.771132946f, 0.117644079f},
-std::array<float,2>{0.283949524f, 0.433389783f},
-std::array<float,2>{0.63234812f, 0.965843737f},
-std::array<float,2>{0.442743152f, 0.776364148f},
-std::array<float,2>{0.582096219f, 0.350993752f},
-std::array<float,2>{0.162264362f, 0.188660488f},
-std::array<float,2>{0.984130859f, 0.737439573f},
-std::array<float,2>{0.0671195164f, 0.951483011f},
-std::array<float,2>{0.807807207f, 0.420390844f},
-std::array<float,2>{0.274727643f, 0.0982244238f},
-std::array<float,2>{0.68087101f, 0.619254351f},
-std::array<float,2>{0.47494939f, 0.730311513f},
-std::array<float,2>{0.594505012f, 0.214361876f},
-std::array<float,2>{0.156055912f, 0.36340341f},
-std::array<float,2>{0.967855036f, 0.764048517f},
-std::array<float,2>{0.199787766f, 0.531993449f},
-std::array<float,2>{0.913232207f, 0.0534034111f},
-std::array<float,2>{0.42482242f, 0.487445951f},
-std::array<float,2>{0.544126987f, 0.914142847f},
-std::array<float,2>{0.348665446f, 0.825214505f},
-std::array<float,2>{0.734475672f, 0.292689413f},
-std::array<float,2>{0.0363028273f, 0.129467309f},
-std::array<float,2>{0.872804165f, 0.646876216f},
-std::array<float,2>{0.180659741f, 0.789902568f},
-std::array<float,2>{0.988692224f, 0.330811322f},
-std::array<float,2>{0.461415678f, 0.221819133f},
-std::array<float,2>{0.564862669f, 0.704132915f},
-std::array<float,2>{0.306637436f, 0.581374526f},
-std::array<float,2>{0.651168227f, 0.0711230487f},
-std::array<float,2>{0.0993580595f, 0.375237167f},
-std::array<float,2>{0.757366538f, 0.987991452f},
-std::array<float,2>{0.0202854015f, 0.683393121f},
-std::array<float,2>{0.814504445f, 0.17487368f},
-std::array<float,2>{0.329612255f, 0.274708778f},
-std::array<float,2>{0.692751706f, 0.862258315f},
-std::array<float,2>{0.401914835f, 0.905216336f},
-std::array<float,2>{0.526683807f, 0.45943746f},
-std::array<float,2>{0.237744004f, 0.00481139636f},
-std::array<float,2>{0.901234686f, 0.530860424f},
-std::array<float,2>{0.0464599319f, 0.77833432f},
-std::array<float,2>{0.861089706f, 0.345466763f},
-std::array<float,2>{0.356621653f, 0.192057565f},
-std::array<float,2>{0.743970037f, 0.740828574f},
-std::array<float,2>{0.433662832f, 0.598383367f},
-std::array<float,2>{0.53365922f, 0.123863049f},
-std::array<float,2>{0.193082973f, 0.436476052f},
-std::array<float,2>{0.917660296f, 0.960987449f},
-std::array<float,2>{0.143679127f, 0.631979764f},
-std::array<float,2>{0.958861709f, 0.149402618f},
-std::array<float,2>{0.477524549f, 0.308785141f},
-std::array<float,2>{0.605148315f, 0.839279592f},
-std::array<float,2>{0.26999265f, 0.933257222f},
-std::array<float,2>{0.673053443f, 0.480576664f},
-std::array<float,2>{0.0736401156f, 0.0392565392f},
-std::array<float,2>{0.797872186f, 0.561836541f},
-std::array<float,2>{0.243279666f, 0.975385845f},
-std::array<float,2>{0.894303083f, 0.401573867f},
-std::array<float,2>{0.390842497f, 0.0885706916f},
-std::array<float,2>{0.521842897f, 0.575778902f},
-std::array<float,2>{0.338711053f, 0.689356863f},
-std::array<float,2>{0.701801777f, 0.238990173f},
-std::array<float,2>{0.0283935424f, 0.31981796f},
-std::array<float,2>{0.827678263f, 0.80878216f},
-std::array<float,2>{0.10823898f, 0.500372231f},
-std::array<float,2>{0.759063244f, 0.0193512794f},
-std::array<float,2>{0.301119119f, 0.449106812f},
-std::array<float,2>{0.641495943f, 0.890563428f},
-std::array<float,2>{0.456979126f, 0.857527196f},
-std::array<float,2>{0.574918091f, 0.260236681f},
-std::array<float,2>{0.171913475f, 0.161034539f},
-std::array<float,2>{0.997732997f, 0.657835603f},
-std::array<float,2>{0.0897840336f, 0.898913383f},
-std::array<float,2>{0.796204746f, 0.456482142f},
-std::array<float,2>{0.263598949f, 0.00341590447f},
-std::array<float,2>{0.660713792f, 0.526270151f},
-std::array<float,2>{0.496679366f, 0.68546164f},
-std::array<float,2>{0.609528661f, 0.178106666f},
-std::array<float,2>{0.134407878f, 0.278114349f},
-std::array<float,2>{0.939512432f, 0.865014195f},
-std::array<float,2>{0.218674794f, 0.583372235f},
-std::array<float,2>{0.930332839f, 0.0753429905f},
-std::array<float,2>{0.408355951f, 0.382635683f},
-std::array<float,2>{0.555862427f, 0.991786301f},
-std::array<float,2>{0.370253831f, 0.793092668f},
-std::array<float,2>{0.720906019f, 0.332941473f},
-std::array<float,2>{0.0549741052f, 0.224771723f},
-std::array<float,2>{0.844116926f, 0.709424376f},
-std::array<float,2>{0.171777621f, 0.821938038f},
-std::array<float,2>{0.974479258f, 0.29581809f},
-std::array<float,2>{0.448367268f, 0.12694782f},
-std::array<float,2>{0.591442645f, 0.642933965f},
-std::array<float,2>{0.295866817f, 0.539013743f},
-std::array<float,2>{0.636706591f, 0.049014207f},
-std::array<float,2>{0.118579932f, 0.492089331f},
-std::array<float,2>{0.778533936f, 0.918409228f},
-std::array<float,2>{0.015546239f, 0.734229267f},
-std::array<float,2>{0.840201139f, 0.21692425f},
-std::array<float,2>{0.316621393f, 0.359450191f},
-std::array<float,2>{0.718596518f, 0.758077621f},
-std::array<float,2>{0.377770305f, 0.948826849f},
-std::array<float,2>{0.505520284f, 0.41682303f},
-std::array<float,2>{0.224308714f, 0.0941763818f},
-std::array<float,2>{0.880632937f, 0.621871591f},
-std::array<float,2>{0.111641213f, 0.871238291f},
-std::array<float,2>{0.766460717f, 0.272188157f},
-std::array<float,2>{0.288853139f, 0.186958432f},
-std::array<float,2>{0.628027916f, 0.676919937f},
-std::array<float,2>{0.440315694f, 0.519682705f},
-std::array<float,2>{0.580276847f, 0.012330371f},
-std::array<float,2>{0.156299904f, 0.465794772f},
-std::array<float,2>{0.977286041f, 0.895759463f},
-std::array<float,2>{0.234322652f, 0.718290627f},
-std::array<float,2>{0.890159428f, 0.227836207f},
-std::array<float,2>{0.390186518f, 0.338442534f},
-std::array<float,2>{0.511771202f, 0.784992814f},
-std::array<float,2>{0.323909253f, 0.996811509f},
-std::array<float,2>{0.709452987f, 0.38333568f},
-std::array<float,2>{0.00513215549f, 0.067584835f},
-std::array<float,2>{0.83536762f, 0.591505587f},
-std::array<float,2>{0.128213167f, 0.913595676f},
-std::array<float,2>{0.947745323f, 0.496221453f},
-std::array<float,2>{0.488334179f, 0.0575512499f},
-std::array<float,2>{0.619765639f, 0.542173386f},
-std::array<float,2>{0.252333462f, 0.653089643f},
-std::array<float,2>{0.670990944f, 0.136975303f},
-std::array<float,2>{0.0834511369f, 0.288071543f},
-std::array<float,2>{0.787561357f, 0.81874907f},
-std::array<float,2>{0.0524770133f, 0.612525582f},
-std::array<float,2>{0.858468235f, 0.106250457f},
-std::array<float,2>{0.363669008f, 0.410635948f},
-std::array<float,2>{0.733246326f, 0.943014681f},
-std::array<float,2>{0.415927202f, 0.753705323f},
-std::array<float,2>{0.553368449f, 0.369366437f},
-std::array<float,2>{0.209690809f, 0.209678456f},
-std::array<float,2>{0.927473307f, 0.726413131f},
-std::array<float,2>{0.0194155425f, 0.95804745f},
-std::array<float,2>{0.818867445f, 0.422571748f},
-std::array<float,2>{0.334647924f, 0.113368772f},
-std::array<float,2>{0.687707543f, 0.606394589f},
-std::array<float,2>{0.403201282f, 0.746840835f},
-std::array<float,2>{0.528816342f, 0.201104417f},
-std::array<float,2>{0.24085021f, 0.352118045f},
-std::array<float,2>{0.903284967f, 0.772622764f},
-std::array<float,2>{0.184049547f, 0.550279677f},
-std::array<float,2>{0.98455435f, 0.0330973938f},
-std::array<float,2>{0.468288034f, 0.474237651f},
-std::array<float,2>{0.569625556f, 0.929593325f},
-std::array<float,2>{0.308987916f, 0.828584075f},
-std::array<float,2>{0.653058887f, 0.302100718f},
-std::array<float,2>{0.0956152678f, 0.141411096f},
-std::array<float,2>{0.752567112f, 0.640364051f},
-std::array<float,2>{0.198095039f, 0.799765944f},
-std::array<float,2>{0.909861028f, 0.326361746f},
-std::array<float,2>{0.428164303f, 0.243241772f},
-std::array<float,2>{0.542917907f, 0.697442591f},
-std::array<float,2>{0.347486883f, 0.568106651f},
-std::array<float,2>{0.73919487f, 0.0824925601f},
-std::array<float,2>{0.0331846476f, 0.391123563f},
-std::array<float,2>{0.868878007f, 0.982207835f},
-std::array<float,2>{0.063568294f, 0.670207083f},
-std::array<float,2>{0.812352419f, 0.165703982f},
-std::array<float,2>{0.280636013f, 0.250393748f},
-std::array<float,2>{0.68507421f, 0.844685674f},
-std::array<float,2>{0.471592724f, 0.881215394f},
-std::array<float,2>{0.599827945f, 0.439368844f},
-std::array<float,2>{0.149798125f, 0.0277746934f},
-std::array<float,2>{0.964771092f, 0.514292955f},
-std::array<float,2>{0.0772992224f, 0.786420703f},
-std::array<float,2>{0.804344356f, 0.34119451f},
-std::array<float,2>{0.267016321f, 0.234143034f},
-std::array<float,2>{0.677444756f, 0.712162316f},
-std::array<float,2>{0.480580181f, 0.589167714f},
-std::array<float,2>{0.608116567f, 0.0644331947f},
-std::array<float,2>{0.144991145f, 0.388316274f},
-std::array<float,2>{0.955290556f, 0.995662749f},
-std::array<float,2>{0.19002445f, 0.673101306f},
-std::array<float,2>{0.920170784f, 0.182441056f},
-std::array<float,2>{0.433409423f, 0.268013686f},
-std::array<float,2>{0.538328409f, 0.869554281f},
-std::array<float,2>{0.355364203f, 0.892485917f},
-std::array<float,2>{0.749647439f, 0.463443369f},
-std::array<float,2>{0.042849835f, 0.0115170619f},
-std::array<float,2>{0.864729106f, 0.516172767f},
-std::array<float,2>{0.179256693f, 0.940619946f},
-std::array<float,2>{0.993567824f, 0.408268332f},
-std::array<float,2>{0.45884794f, 0.104989201f},
-std::array<float,2>{0.57118094f, 0.614927649f},
-std::array<float,2>{0.297633469f, 0.722050071f},
-std::array<float,2>{0.648349583f, 0.206897005f},
-std::array<float,2>{0.101675071f, 0.373905897f},
-std::array<float,2>{0.764663398f, 0.75548023f},
-std::array<float,2>{0.0248572249f, 0.544580698f},
-std::array<float,2>{0.823052943f, 0.0605978109f},
-std::array<float,2>{0.342940718f, 0.494178116f},
-std::array<float,2>{0.698534071f, 0.909228683f},
-std::array<float,2>{0.396808445f, 0.814892709f},
-std::array<float,2>{0.516799331f, 0.283520222f},
-std::array<float,2>{0.246601582f, 0.133054584f},
-std::array<float,2>{0.895678937f, 0.651748061f},
-std::array<float,2>{0.059666004f, 0.924450636f},
-std::array<float,2>{0.85028857f, 0.469560862f},
-std::array<float,2>{0.374006957f, 0.0361200273f},
-std::array<float,2>{0.72386378f, 0.554077566f},
-std::array<float,2>{0.413852155f, 0.633782327f},
-std::array<float,2>{0.560222745f, 0.146476969f},
-std::array<float,2>{0.213617742f, 0.29816547f},
-std::array<float,2>{0.93560642f, 0.833339512f},
-std::array<float,2>{0.139193028f, 0.604661465f},
-std::array<float,2>{0.943842828f, 0.110699825f},
-std::array<float,2>{0.492986172f, 0.429631203f},
-std::array<float,2>{0.614467859f, 0.956974268f},
-std::array<float,2>{0.259271592f, 0.768193543f},
-std::array<float,2>{0.656465232f, 0.358411372f},
-std::array<float,2>{0.090171136f, 0.198661461f},
-std::array<float,2>{0.79024291f, 0.744438887f},
-std::array<float,2>{0.220931023f, 0.848065078f},
-std::array<float,2>{0.876154244f, 0.255860001f},
-std::array<float,2>{0.379548937f, 0.170709699f},
-std::array<float,2>{0.502463818f, 0.666183591f},
-std::array<float,2>{0.313936174f, 0.51143086f},
-std::array<float,2>{0.714300275f, 0.0251071863f},
-std::array<float,2>{0.0115753114f, 0.443186939f},
-std::array<float,2>{0.839357018f, 0.877479613f},
-std::array<float,2>{0.124990575f, 0.702880561f},
-std::array<float,2>{0.775231242f, 0.247943044f},
-std::array<float,2>{0.291254789f, 0.323096007f},
-std::array<float,2>{0.639502287f, 0.802390456f},
-std::array<float,2>{0.450692773f, 0.980087817f},
-std::array<float,2>{0.587304413f, 0.395962775f},
-std::array<float,2>{0.165997028f, 0.0817814097f},
-std::array<float,2>{0.970882535f, 0.565808713f},
-std::array<float,2>{0.00141878438f, 0.841461062f},
-std::array<float,2>{0.831870615f, 0.307518989f},
-std::array<float,2>{0.327062726f, 0.154630527f},
-std::array<float,2>{0.706209421f, 0.626999199f},
-std::array<float,2>{0.38304618f, 0.554898381f},
-std::array<float,2>{0.51112318f, 0.0458434969f},
-std::array<float,2>{0.230149567f, 0.476679087f},
-std::array<float,2>{0.885198951f, 0.934131026f},
-std::array<float,2>{0.160307735f, 0.735465944f},
-std::array<float,2>{0.980966926f, 0.190509275f},
-std::array<float,2>{0.44381091f, 0.349219412f},
-std::array<float,2>{0.583990514f, 0.77367568f},
-std::array<float,2>{0.282600403f, 0.967033625f},
-std::array<float,2>{0.629495084f, 0.431066245f},
-std::array<float,2>{0.11696209f, 0.120235905f},
-std::array<float,2>{0.773172796f, 0.595591307f},
-std::array<float,2>{0.203600049f, 0.886511803f},
-std::array<float,2>{0.921962917f, 0.452306986f},
-std::array<float,2>{0.41976878f, 0.022282755f},
-std::array<float,2>{0.549511135f, 0.506809711f},
-std::array<float,2>{0.35951525f, 0.663770437f},
-std::array<float,2>{0.729974627f, 0.157114223f},
-std::array<float,2>{0.0503865965f, 0.265068978f},
-std::array<float,2>{0.852656782f, 0.853610337f},
-std::array<float,2>{0.0806275606f, 0.57062757f},
-std::array<float,2>{0.783975303f, 0.0912026241f},
-std::array<float,2>{0.253992051f, 0.403628975f},
-std::array<float,2>{0.66562891f, 0.971084118f},
-std::array<float,2>{0.487327665f, 0.807389498f},
-std::array<float,2>{0.622366309f, 0.316119522f},
-std::array<float,2>{0.130246878f, 0.235678256f},
-std::array<float,2>{0.951794088f, 0.692413211f},
-std::array<float,2>{0.101489842f, 0.985312641f},
-std::array<float,2>{0.754438698f, 0.377124161f},
-std::array<float,2>{0.30817309f, 0.0740868375f},
-std::array<float,2>{0.650341451f, 0.578478336f},
-std::array<float,2>{0.464372039f, 0.706958234f},
-std::array<float,2>{0.562615573f, 0.220480561f},
-std::array<float,2>{0.183089003f, 0.328378588f},
-std::array<float,2>{0.991728008f, 0.79108274f},
-std::array<float,2>{0.236324236f, 0.527812004f},
-std::array<float,2>{0.900234461f, 0.00630036229f},
-std::array<float,2>{0.398465186f, 0.458519369f},
-std::array<float,2>{0.524974763f, 0.904105067f},
-std::array<float,2>{0.331977934f, 0.859864533f},
-std::array<float,2>{0.695292354f, 0.276387215f},
-std::array<float,2>{0.0232522152f, 0.172067657f},
-std::array<float,2>{0.814222038f, 0.680945575f},
-std::array<float,2>{0.152843013f, 0.761753023f},
-std::array<float,2>{0.965434849f, 0.3663975f},
-std::array<float,2>{0.473894984f, 0.211707339f},
-std::array<float,2>{0.596359611f, 0.727183104f},
-std::array<float,2>{0.276658177f, 0.618880749f},
-std::array<float,2>{0.682427466f, 0.101297662f},
-std::array<float,2>{0.0688057095f, 0.419224203f},
-std::array<float,2>{0.805310428f, 0.94928968f},
-std::array<float,2>{0.0389801152f, 0.645029962f},
-std::array<float,2>{0.874078095f, 0.132283032f},
-std::array<float,2>{0.350211322f, 0.289292961f},
-std::array<float,2>{0.737184823f, 0.826193213f},
-std::array<float,2>{0.423460126f, 0.917013586f},
-std::array<float,2>{0.54517889f, 0.484810889f},
-std::array<float,2>{0.202485338f, 0.0508357473f},
-std::array<float,2>{0.910995305f, 0.535051942f},
-std::array<float,2>{0.0131928688f, 0.759157062f},
-std::array<float,2>{0.843028724f, 0.360980332f},
-std::array<float,2>{0.319200099f, 0.217781126f},
-std::array<float,2>{0.71577841f, 0.732969403f},
-std::array<float,2>{0.376642168f, 0.622655034f},
-std::array<float,2>{0.507418394f, 0.0955527723f},
-std::array<float,2>{0.224640459f, 0.41774562f},
-std::array<float,2>{0.882553637f, 0.948012412f},
-std::array<float,2>{0.169787422f, 0.643681526f},
-std::array<float,2>{0.975607097f, 0.125809163f},
-std::array<float,2>{0.446860075f, 0.296721846f},
-std::array<float,2>{0.592082381f, 0.820866108f},
-std::array<float,2>{0.294588655f, 0.919180751f},
-std::array<float,2>{0.633738458f, 0.491089344f},
-std::array<float,2>{0.120187394f, 0.0498655252f},
-std::array<float,2>{0.780167222f, 0.537402153f},
-std::array<float,2>{0.215933993f, 0.990328968f},
-std::array<float,2>{0.932755649f, 0.381712198f},
-std::array<float,2>{0.407538861f, 0.0744254217f},
-std::array<float,2>{0.558216512f, 0.5828951f},
-std::array<float,2>{0.368033707f, 0.710358024f},
-std::array<float,2>{0.72053802f, 0.225885615f},
-std::array<float,2>{0.0577250421f, 0.333484769f},
-std::array<float,2>{0.845853925f, 0.794226229f},
-std::array<float,2>{0.0875500143f, 0.526555359f},
-std::array<float,2>{0.793221116f, 0.0028364819f},
-std::array<float,2>{0.265304774f, 0.455866098f},
-std::array<float,2>{0.662558198f, 0.900351763f},
-std::array<float,2>{0.49991715f, 0.863949358f},
-std::array<float,2>{0.612349033f, 0.27839151f},
-std::array<float,2>{0.134913832f, 0.178906798f},
-std::array<float,2>{0.938980937f, 0.684337437f},
-std::array<float,2>{0.106387764f, 0.889580309f},
-std::array<float,2>{0.761141181f, 0.447967112f},
-std::array<float,2>{0.304654658f, 0.0185013451f},
-std::array<float,2>{0.643240511f, 0.501303077f},
-std::array<float,2>{0.453476608f, 0.656550229f},
-std::array<float,2>{0.576409459f, 0.16181159f},
-std::array<float,2>{0.173920825f, 0.261403739f},
-std::array<float,2>{0.999113023f, 0.859344721f},
-std::array<float,2>{0.246002048f, 0.57453388f},
-std::array<float,2>{0.892237186f, 0.0892757326f},
-std::array<float,2>{0.3935588f, 0.400426924f},
-std::array<float,2>{0.520196617f, 0.976290286f},
-std::array<float,2>{0.336889267f, 0.810243189f},
-std::array<float,2>{0.699297905f, 0.318702787f},
-std::array<float,2>{0.0292970948f, 0.240015239f},
-std::array<float,2>{0.825408697f, 0.687562168f},
-std::array<float,2>{0.141947418f, 0.838612497f},
-std::array<float,2>{0.960500956f, 0.310331315f},
-std::array<float,2>{0.478838742f, 0.149888813f},
-std::array<float,2>{0.603435516f, 0.631404877f},
-std::array<float,2>{0.272651792f, 0.560580254f},
-std::array<float,2>{0.674601436f, 0.040069513f},
-std::array<float,2>{0.0705959499f, 0.481972009f},
-std::array<float,2>{0.800375104f, 0.932192981f},
-std::array<float,2>{0.0438614525f, 0.741853476f},
-std::array<float,2>{0.861438632f, 0.193128496f},
-std::array<float,2>{0.358232468f, 0.344166815f},
-std::array<float,2>{0.745360911f, 0.778168082f},
-std::array<float,2>{0.435858905f, 0.962857902f},
-std::array<float,2>{0.532526493f, 0.436986059f},
-std::array<float,2>{0.1952703f, 0.124467947f},
-std::array<float,2>{0.915000916f, 0.599013925f},
-std::array<float,2>{0.0662392899f, 0.844825983f},
-std::array<float,2>{0.808675289f, 0.251696408f},
-std::array<float,2>{0.279064476f, 0.164630383f},
-std::array<float,2>{0.687499881f, 0.671785176f},
-std::array<float,2>{0.469959974f, 0.515527666f},
-std::array<float,2>{0.599347353f, 0.0292909835f},
-std::array<float,2>{0.151977211f, 0.438016355f},
-std::array<float,2>{0.961520135f, 0.882213593f},
-std::array<float,2>{0.196991488f, 0.698371291f},
-std::array<float,2>{0.907804728f, 0.242546141f},
-std::array<float,2>{0.425872952f, 0.32786575f},
-std::array<float,2>{0.540631413f, 0.799854219f},
-std::array<float,2>{0.344448954f, 0.981417f},
-std::array<float,2>{0.741579235f, 0.392474741f},
-std::array<float,2>{0.0334422104f, 0.0831604302f},
-std::array<float,2>{0.869177103f, 0.566948354f},
-std::array<float,2>{0.185583949f, 0.92794013f},
-std::array<float,2>{0.987865567f, 0.473349214f},
-std::array<float,2>{0.464898378f, 0.0316705517f},
-std::array<float,2>{0.568192363f, 0.549260557f},
-std::array<float,2>{0.31237185f, 0.63905102f},
-std::array<float,2>{0.655025184f, 0.141864255f},
-std::array<float,2>{0.0973405242f, 0.301657885f},
-std::array<float,2>{0.751485527f, 0.829276741f},
-std::array<float,2>{0.0175301898f, 0.607421756f},
-std::array<float,2>{0.817939162f, 0.115176745f},
-std::array<float,2>{0.333147079f, 0.423556119f},
-std::array<float,2>{0.690485477f, 0.957683742f},
-std::array<float,2>{0.404332489f, 0.771566153f},
-std::array<float,2>{0.530025542f, 0.353360504f},
-std::array<float,2>{0.240053475f, 0.200054064f},
-std::array<float,2>{0.906007111f, 0.747283936f},
-std::array<float,2>{0.0545414612f, 0.942099452f},
-std::array<float,2>{0.857198894f, 0.411292285f},
-std::array<float,2>{0.367050797f, 0.106572136f},
-std::array<float,2>{0.731542826f, 0.612168431f},
-std::array<float,2>{0.417650193f, 0.724948227f},
-std::array<float,2>{0.552398264f, 0.21002084f},
-std::array<float,2>{0.207913071f, 0.370579392f},
-std::array<float,2>{0.928628862f, 0.752279639f},
-std::array<float,2>{0.125911057f, 0.54171592f},
-std::array<float,2>{0.94644779f, 0.0582999438f},
-std::array<float,2>{0.492012709f, 0.497636199f},
-std::array<float,2>{0.618554115f, 0.912296653f},
-std::array<float,2>{0.251241237f, 0.819957316f},
-std::array<float,2>{0.669367611f, 0.288539141f},
-std::array<float,2>{0.0858251229f, 0.138399661f},
-std::array<float,2>{0.786747038f, 0.653711677f},
-std::array<float,2>{0.232295603f, 0.783927083f},
-std::array<float,2>{0.887753844f, 0.339222819f},
-std::array<float,2>{0.388535887f, 0.226600632f},
-std::array<float,2>{0.514667094f, 0.717650831f},
-std::array<float,2>{0.32202208f, 0.590002239f},
-std::array<float,2>{0.708825648f, 0.0664802492f},
-std::array<float,2>{0.00738123432f, 0.384417593f},
-std::array<float,2>{0.833546221f, 0.997801125f},
-std::array<float,2>{0.10960231f, 0.676678658f},
-std::array<float,2>{0.768009484f, 0.18615672f},
-std::array<float,2>{0.285587072f, 0.273215085f},
-std::array<float,2>{0.626470089f, 0.872510433f},
-std::array<float,2>{0.438218623f, 0.894988894f},
-std::array<float,2>{0.579865813f, 0.46650511f},
-std::array<float,2>{0.159853593f, 0.0132902144f},
-std::array<float,2>{0.979757726f, 0.521390915f},
-std::array<float,2>{0.122333236f, 0.800855458f},
-std::array<float,2>{0.776611269f, 0.324076056f},
-std::array<float,2>{0.290925711f, 0.246824592f},
-std::array<float,2>{0.637317777f, 0.701850712f},
-std::array<float,2>{0.451858073f, 0.565081537f},
-std::array<float,2>{0.588340104f, 0.0801216736f},
-std::array<float,2>{0.166257814f, 0.395243436f},
-std::array<float,2>{0.969795406f, 0.979007542f},
-std::array<float,2>{0.219210863f, 0.667236149f},
-std::array<float,2>{0.877637029f, 0.17145662f},
-std::array<float,2>{0.381142646f, 0.256918371f},
-std::array<float,2>{0.501244068f, 0.848904312f},
-std::array<float,2>{0.316303581f, 0.878491223f},
-std::array<float,2>{0.712426186f, 0.441688478f},
-std::array<float,2>{0.00805312954f, 0.0243505929f},
-std::array<float,2>{0.836127102f, 0.509865463f},
-std::array<float,2>{0.138336495f, 0.955986261f},
-std::array<float,2>{0.943355978f, 0.428463697f},
-std::array<float,2>{0.4943012f, 0.110055208f},
-std::array<float,2>{0.616049469f, 0.603776097f},
-std::array<float,2>{0.261246502f, 0.745364726f},
-std::array<float,2>{0.659948647f, 0.197512239f},
-std::array<float,2>{0.0927658677f, 0.357874125f},
-std::array<float,2>{0.79275018f, 0.769339085f},
-std::array<float,2>{0.0607512742f, 0.553108752f},
-std::array<float,2>{0.848289311f, 0.0369327627f},
-std::array<float,2>{0.371430069f, 0.470167249f},
-std::array<float,2>{0.725308299f, 0.924966633f},
-std::array<float,2>{0.411726356f, 0.832702458f},
-std::array<float,2>{0.560695052f, 0.297412813f},
-std::array<float,2>{0.211176321f, 0.14463146f},
-std::array<float,2>{0.934961677f, 0.63382256f},
-std::array<float,2>{0.026789993f, 0.908227623f},
-std::array<float,2>{0.821298659f, 0.495596886f},
-std::array<float,2>{0.339936882f, 0.0619596131f},
-std::array<float,2>{0.696413755f, 0.543163121f},
-std::array<float,2>{0.395270824f, 0.650935352f},
-std::array<float,2>{0.517966449f, 0.13446568f},
-std::array<float,2>{0.248195231f, 0.284215569f},
-std::array<float,2>{0.898233414f, 0.816348851f},
-std::array<float,2>{0.17757225f, 0.613980949f},
-std::array<float,2>{0.995280981f, 0.10390874f},
-std::array<float,2>{0.459510297f, 0.40939793f},
-std::array<float,2>{0.573351026f, 0.939605594f},
-std::array<float,2>{0.300553322f, 0.754169881f},
-std::array<float,2>{0.645913541f, 0.374171615f},
-std::array<float,2>{0.10352695f, 0.205727354f},
-std::array<float,2>{0.763394356f, 0.721124828f},
-std::array<float,2>{0.188008428f, 0.870690167f},
-std::array<float,2>{0.918103278f, 0.268885791f},
-std::array<float,2>{0.430884451f, 0.183055669f},
-std::array<float,2>{0.536899149f, 0.672814071f},
-std::array<float,2>{0.352414399f, 0.517257154f},
-std::array<float,2>{0.747584224f, 0.0105573824f},
-std::array<float,2>{0.0400284529f, 0.464096129f},
-std::array<float,2>{0.866137922f, 0.891286373f},
-std::array<float,2>{0.0754939169f, 0.711172819f},
-std::array<float,2>{0.801117003f, 0.232753173f},
-std::array<float,2>{0.267960638f, 0.34061259f},
-std::array<float,2>{0.679594278f, 0.785304487f},
-std::array<float,2>{0.483476847f, 0.994152665f},
-std::array<float,2>{0.606130779f, 0.38734597f},
-std::array<float,2>{0.148361444f, 0.0627259687f},
-std::array<float,2>{0.954502285f, 0.588678002f},
-std::array<float,2>{0.0356621221f, 0.827596962f},
-std::array<float,2>{0.871245682f, 0.290421367f},
-std::array<float,2>{0.348341614f, 0.131678745f},
-std::array<float,2>{0.736086249f, 0.645673096f},
-std::array<float,2>{0.424774319f, 0.533839285f},
-std::array<float,2>{0.543506861f, 0.0518649518f},
-std::array<float,2>{0.200828016f, 0.485853165f},
-std::array<float,2>{0.912231147f, 0.916592598f},
-std::array<float,2>{0.154916182f, 0.728368282f},
-std::array<float,2>{0.967692614f, 0.212239414f},
-std::array<float,2>{0.475622624f, 0.365729094f},
-std::array<float,2>{0.594990015f, 0.762777567f},
-std::array<float,2>{0.273688704f, 0.950369775f},
-std::array<float,2>{0.679788232f, 0.418183446f},
-std::array<float,2>{0.0675926208f, 0.100037329f},
-std::array<float,2>{0.806866348f, 0.618088961f},
-std::array<float,2>{0.237023175f, 0.903220952f},
-std::array<float,2>{0.902152002f, 0.457126945f},
-std::array<float,2>{0.400953382f, 0.00708510634f},
-std::array<float,2>{0.525485337f, 0.529244304f},
-std::array<float,2>{0.32834664f, 0.680044949f},
-std::array<float,2>{0.691553116f, 0.173058733f},
-std::array<float,2>{0.0205407627f, 0.275412291f},
-std::array<float,2>{0.816343784f, 0.861139894f},
-std::array<float,2>{0.0982024446f, 0.580006123f},
-std::array<float,2>{0.756474733f, 0.0725739002f},
-std::array<float,2>{0.305472583f, 0.378378391f},
-std::array<float,2>{0.651742935f, 0.985782325f},
-std::array<float,2>{0.462232262f, 0.792944312f},
-std::array<float,2>{0.565651476f, 0.329770267f},
-std::array<float,2>{0.180666462f, 0.219584197f},
-std::array<float,2>{0.990209758f, 0.705316365f},
-std::array<float,2>{0.0786576644f, 0.972548246f},
-std::array<float,2>{0.782181084f, 0.402478993f},
-std::array<float,2>{0.257296592f, 0.0903485864f},
-std::array<float,2>{0.667332888f, 0.572042882f},
-std::array<float,2>{0.485236704f, 0.691447258f},
-std::array<float,2>{0.623713911f, 0.235318571f},
-std::array<float,2>{0.130937159f, 0.314682305f},
-std::array<float,2>{0.950650156f, 0.808099568f},
-std::array<float,2>{0.205251947f, 0.507219493f},
-std::array<float,2>{0.924916327f, 0.0230689924f},
-std::array<float,2>{0.421301991f, 0.451921016f},
-std::array<float,2>{0.54757607f, 0.885688484f},
-std::array<float,2>{0.362458527f, 0.855427504f},
-std::array<float,2>{0.728039503f, 0.264627039f},
-std::array<float,2>{0.0471917875f, 0.158058837f},
-std::array<float,2>{0.853527546f, 0.662198842f},
-std::array<float,2>{0.163774177f, 0.774937928f},
-std::array<float,2>{0.983176649f, 0.348066866f},
-std::array<float,2>{0.442242146f, 0.190072119f},
-std::array<float,2>{0.583020151f, 0.73500073f},
-std::array<float,2>{0.28423059f, 0.593862772f},
-std::array<float,2>{0.631327748f, 0.119674236f},
-std::array<float,2>{0.113782756f, 0.430127561f},
-std::array<float,2>{0.770146251f, 0.968442976f},
-std::array<float,2>{0.00251814234f, 0.628028452f},
-std::array<float,2>{0.828552425f, 0.155715168f},
-std::array<float,2>{0.325766623f, 0.308100551f},
-std::array<float,2>{0.705048382f, 0.840784192f},
-std::array<float,2>{0.385117829f, 0.934655488f},
-std::array<float,2>{0.509200871f, 0.478139937f},
-std::array<float,2>{0.228300542f, 0.0462300554f},
-std::array<float,2>{0.884550214f, 0.556234837f},
-std::array<float,2>{0.0556723252f, 0.796634614f},
-std::array<float,2>{0.844979227f, 0.334301293f},
-std::array<float,2>{0.369166523f, 0.224043384f},
-std::array<float,2>{0.721858323f, 0.708634555f},
-std::array<float,2>{0.409209728f, 0.584823966f},
-std::array<float,2>{0.55473721f, 0.077421166f},
-std::array<float,2>{0.216960207f, 0.380610108f},
-std::array<float,2>{0.930713356f, 0.989462197f},
-std::array<float,2>{0.132950947f, 0.686949968f},
-std::array<float,2>{0.940905273f, 0.177349359f},
-std::array<float,2>{0.497088075f, 0.280854791f},
-std::array<float,2>{0.611118853f, 0.866917729f},
-std::array<float,2>{0.262126654f, 0.901759267f},
-std::array<float,2>{0.66168803f, 0.453377187f},
-std::array<float,2>{0.0879554823f, 0.00182457338f},
-std::array<float,2>{0.795362175f, 0.525045097f},
-std::array<float,2>{0.223480865f, 0.946829379f},
-std::array<float,2>{0.879798055f, 0.415824562f},
-std::array<float,2>{0.378794819f, 0.0960770845f},
-std::array<float,2>{0.504263163f, 0.623149037f},
-std::array<float,2>{0.318319499f, 0.730689168f},
-std::array<float,2>{0.717691958f, 0.215927556f},
-std::array<float,2>{0.014198048f, 0.362537712f},
-std::array<float,2>{0.841097534f, 0.760655224f},
-std::array<float,2>{0.11763899f, 0.536471188f},
-std::array<float,2>{0.777561963f, 0.0478830859f},
-std::array<float,2>{0.296602488f, 0.489032239f},
-std::array<float,2>{0.635518909f, 0.921176434f},
-std::array<float,2>{0.447658539f, 0.822426736f},
-std::array<float,2>{0.590809286f, 0.293241113f},
-std::array<float,2>{0.170770004f, 0.128045797f},
-std::array<float,2>{0.973582089f, 0.641096413f},
-std::array<float,2>{0.0727579296f, 0.931370974f},
-std::array<float,2>{0.79695642f, 0.483484864f},
-std::array<float,2>{0.27137956f, 0.0422348343f},
-std::array<float,2>{0.672742784f, 0.559158087f},
-std::array<float,2>{0.477647066f, 0.629579246f},
-std::array<float,2>{0.603647947f, 0.151322022f},
-std::array<float,2>{0.143165156f, 0.31139189f},
-std::array<float,2>{0.957877398f, 0.836509168f},
-std::array<float,2>{0.192283064f, 0.601559341f},
-std::array<float,2>{0.916462004f, 0.121844441f},
-std::array<float,2>{0.435003877f, 0.435213953f},
-std::array<float,2>{0.534301519f, 0.962961614f},
-std::array<float,2>{0.355471939f, 0.780774474f},
-std::array<float,2>{0.742652893f, 0.347607881f},
-std::array<float,2>{0.0457623303f, 0.195214137f},
-std::array<float,2>{0.860262096f, 0.73885572f},
-std::array<float,2>{0.173209965f, 0.856982112f},
-std::array<float,2>{0.997014284f, 0.259055197f},
-std::array<float,2>{0.455818385f, 0.162608832f},
-std::array<float,2>{0.575511515f, 0.658392668f},
-std::array<float,2>{0.301980793f, 0.502476037f},
-std::array<float,2>{0.642218173f, 0.0170746278f},
-std::array<float,2>{0.108636312f, 0.44591713f},
-std::array<float,2>{0.758696258f, 0.888623357f},
-std::array<float,2>{0.0281662755f, 0.690546274f},
-std::array<float,2>{0.82641083f, 0.24031052f},
-std::array<float,2>{0.338912308f, 0.316513151f},
-std::array<float,2>{0.702423334f, 0.81141305f},
-std::array<float,2>{0.391713142f, 0.974462092f},
-std::array<float,2>{0.522645473f, 0.398757488f},
-std::array<float,2>{0.242244199f, 0.0867513716f},
-std::array<float,2>{0.893394589f, 0.576588869f},
-std::array<float,2>{0.0946047753f, 0.831495047f},
-std::array<float,2>{0.753263891f, 0.304522425f},
-std::array<float,2>{0.309719563f, 0.142967746f},
-std::array<float,2>{0.654267013f, 0.638378203f},
-std::array<float,2>{0.467008889f, 0.547390759f},
-std::array<float,2>{0.56886822f, 0.0341403745f},
-std::array<float,2>{0.184789836f, 0.475040048f},
-std::array<float,2>{0.985727251f, 0.927081466f},
-std::array<float,2>{0.241322026f, 0.748789132f},
-std::array<float,2>{0.904265344f, 0.202265143f},
-std::array<float,2>{0.404001951f, 0.35543558f},
-std::array<float,2>{0.527447641f, 0.770471871f},
-std::array<float,2>{0.335531861f, 0.960906386f},
-std::array<float,2>{0.688533306f, 0.425586581f},
-std::array<float,2>{0.0180864818f, 0.116299525f},
-std::array<float,2>{0.81980437f, 0.608878791f},
-std::array<float,2>{0.148473471f, 0.880353153f},
-std::array<float,2>{0.96307224f, 0.441074669f},
-std::array<float,2>{0.472464681f, 0.0304026771f},
-std::array<float,2>{0.600708842f, 0.512111962f},
-std::array<float,2>{0.27966699f, 0.669620275f},
-std::array<float,2>{0.683630705f, 0.167150319f},
-std::array<float,2>{0.0626442283f, 0.252395302f},
-std::array<float,2>{0.810597003f, 0.846048117f},
-std::array<float,2>{0.0316175185f, 0.569371045f},
-std::array<float,2>{0.867894232f, 0.0845117867f},
-std::array<float,2>{0.346106768f, 0.394016355f},
-std::array<float,2>{0.739328563f, 0.982581794f},
-std::array<float,2>{0.429606199f, 0.797242343f},
-std::array<float,2>{0.541364551f, 0.325784773f},
-std::array<float,2>{0.198504016f, 0.244836569f},
-std::array<float,2>{0.909047067f, 0.695491612f},
-std::array<float,2>{0.00408483157f, 0.998912215f},
-std::array<float,2>{0.834099472f, 0.385339618f},
-std::array<float,2>{0.322856009f, 0.0694353804f},
-std::array<float,2>{0.710477531f, 0.592003942f},
-std::array<float,2>{0.389122456f, 0.716751456f},
-std::array<float,2>{0.513523877f, 0.230346382f},
-std::array<float,2>{0.232796326f, 0.33640781f},
-std::array<float,2>{0.889523327f, 0.782751977f},
-std::array<float,2>{0.157625437f, 0.522101462f},
-std::array<float,2>{0.978427649f, 0.0155812316f},
-std::array<float,2>{0.440845639f, 0.467292964f},
-std::array<float,2>{0.581367016f, 0.897871554f},
-std::array<float,2>{0.287552744f, 0.874006987f},
-std::array<float,2>{0.627528489f, 0.27018407f},
-std::array<float,2>{0.112582088f, 0.183879286f},
-std::array<float,2>{0.766888678f, 0.678089559f},
-std::array<float,2>{0.210524097f, 0.750762343f},
-std::array<float,2>{0.92673713f, 0.368793696f},
-std::array<float,2>{0.414969712f, 0.207058698f},
-std::array<float,2>{0.554056525f, 0.723318279f},
-std::array<float,2>{0.364626765f, 0.610733628f},
-std::array<float,2>{0.733497202f, 0.108415417f},
-std::array<float,2>{0.0513385348f, 0.413377166f},
-std::array<float,2>{0.858384788f, 0.944610775f},
-std::array<float,2>{0.0821585432f, 0.65545994f},
-std::array<float,2>{0.788914263f, 0.140488282f},
-std::array<float,2>{0.253720075f, 0.285597235f},
-std::array<float,2>{0.670391798f, 0.817910016f},
-std::array<float,2>{0.489375532f, 0.910651445f},
-std::array<float,2>{0.620327473f, 0.499328196f},
-std::array<float,2>{0.12720871f, 0.0563604534f},
-std::array<float,2>{0.949056447f, 0.54068172f},
-std::array<float,2>{0.0912960991f, 0.766779184f},
-std::array<float,2>{0.790005982f, 0.357061654f},
-std::array<float,2>{0.258776158f, 0.196061596f},
-std::array<float,2>{0.657788575f, 0.743426085f},
-std::array<float,2>{0.493209332f, 0.602943182f},
-std::array<float,2>{0.613717735f, 0.113162488f},
-std::array<float,2>{0.139826432f, 0.426483661f},
-std::array<float,2>{0.944763541f, 0.953454614f},
-std::array<float,2>{0.214827433f, 0.636026978f},
-std::array<float,2>{0.937342107f, 0.146787584f},
-std::array<float,2>{0.412166119f, 0.300436169f},
-std::array<float,2>{0.55942297f, 0.834607422f},
-std::array<float,2>{0.374654055f, 0.923407614f},
-std::array<float,2>{0.723557949f, 0.471639156f},
-std::array<float,2>{0.0591702573f, 0.0389260612f},
-std::array<float,2>{0.850742996f, 0.551201165f},
-std::array<float,2>{0.164782062f, 0.977699757f},
-std::array<float,2>{0.97195828f, 0.398112208f},
-std::array<float,2>{0.449979961f, 0.0794967487f},
-std::array<float,2>{0.586699069f, 0.563002646f},
-std::array<float,2>{0.292781144f, 0.699495137f},
-std::array<float,2>{0.639965236f, 0.249903947f},
-std::array<float,2>{0.123437002f, 0.322004884f},
-std::array<float,2>{0.77377677f, 0.80309552f},
-std::array<float,2>{0.0104353614f, 0.50934279f},
-std::array<float,2>{0.838836908f, 0.0266623534f},
-std::array<float,2>{0.312856108f, 0.443390012f},
-std::array<float,2>{0.713053763f, 0.875787437f},
-std::array<float,2>{0.380018413f, 0.851004899f},
-std::array<float,2>{0.50366503f, 0.255393267f},
-std::array<float,2>{0.222134084f, 0.168297082f},
-std::array<float,2>{0.875050008f, 0.665637851f},
-std::array<float,2>{0.0414845012f, 0.894276559f},
-std::array<float,2>{0.863350809f, 0.461518854f},
-std::array<float,2>{0.354319751f, 0.00917337649f},
-std::array<float,2>{0.748746216f, 0.517762244f},
-std::array<float,2>{0.432354569f, 0.675576687f},
-std::array<float,2>{0.537630618f, 0.181012228f},
-std::array<float,2>{0.190660447f, 0.266248524f},
-std::array<float,2>{0.921393871f, 0.86796993f},
-std::array<float,2>{0.145508528f, 0.586724818f},
-std::array<float,2>{0.956615746f, 0.0652595386f},
-std::array<float,2>{0.481476426f, 0.389955401f},
-std::array<float,2>{0.608651876f, 0.99333322f},
-std::array<float,2>{0.266407937f, 0.788427234f},
-std::array<float,2>{0.676582575f, 0.341997117f},
-std::array<float,2>{0.0769962743f, 0.232264847f},
-std::array<float,2>{0.802982211f, 0.713700175f},
-std::array<float,2>{0.247381523f, 0.814177871f},
-std::array<float,2>{0.895420849f, 0.281794339f},
-std::array<float,2>{0.397720695f, 0.13531138f},
-std::array<float,2>{0.51643008f, 0.650323451f},
-std::array<float,2>{0.342367113f, 0.546862185f},
-std::array<float,2>{0.698048115f, 0.0590475835f},
-std::array<float,2>{0.0234387256f, 0.49254024f},
-std::array<float,2>{0.82387042f, 0.907254577f},
-std::array<float,2>{0.102887705f, 0.720026135f},
-std::array<float,2>{0.764315963f, 0.203762829f},
-std::array<float,2>{0.298281401f, 0.371189982f},
-std::array<float,2>{0.646930754f, 0.7567752f},
-std::array<float,2>{0.457476228f, 0.939277828f},
-std::array<float,2>{0.571822762f, 0.406704724f},
-std::array<float,2>{0.178207979f, 0.103124082f},
-std::array<float,2>{0.992220521f, 0.616819143f},
-std::array<float,2>{0.021537682f, 0.862852156f},
-std::array<float,2>{0.813129783f, 0.274239391f},
-std::array<float,2>{0.330830634f, 0.173895866f},
-std::array<float,2>{0.693743825f, 0.681644499f},
-std::array<float,2>{0.39974606f, 0.530054271f},
-std::array<float,2>{0.52359587f, 0.00496913958f},
-std::array<float,2>{0.235208079f, 0.460434169f},
-std::array<float,2>{0.89850384f, 0.905698597f},
-std::array<float,2>{0.182056785f, 0.703989387f},
-std::array<float,2>{0.990899861f, 0.220738187f},
-std::array<float,2>{0.463435709f, 0.331470877f},
-std::array<float,2>{0.56406337f, 0.790795028f},
-std::array<float,2>{0.307470948f, 0.986833036f},
-std::array<float,2>{0.648463249f, 0.376440108f},
-std::array<float,2>{0.10034775f, 0.0719963685f},
-std::array<float,2>{0.755136907f, 0.580996096f},
-std::array<float,2>{0.201813504f, 0.915109634f},
-std::array<float,2>{0.911346555f, 0.487022489f},
-std::array<float,2>{0.422693193f, 0.0544676967f},
-std::array<float,2>{0.546209455f, 0.532928705f},
-std::array<float,2>{0.351446658f, 0.647835433f},
-std::array<float,2>{0.738036573f, 0.129962519f},
-std::array<float,2>{0.0374596044f, 0.291176498f},
-std::array<float,2>{0.8738994f, 0.824469328f},
-std::array<float,2>{0.069912985f, 0.621015668f},
-std::array<float,2>{0.806580067f, 0.0989886522f},
-std::array<float,2>{0.276170105f, 0.421722829f},
-std::array<float,2>{0.683070898f, 0.952302158f},
-std::array<float,2>{0.473200381f, 0.765133083f},
-std::array<float,2>{0.596771955f, 0.364562064f},
-std::array<float,2>{0.153566435f, 0.213190928f},
-std::array<float,2>{0.966224015f, 0.729050994f},
-std::array<float,2>{0.116067581f, 0.965641797f},
-std::array<float,2>{0.771790385f, 0.431822777f},
-std::array<float,2>{0.281304538f, 0.11900527f},
-std::array<float,2>{0.63015902f, 0.596946537f},
-std::array<float,2>{0.44505614f, 0.737225473f},
-std::array<float,2>{0.585514069f, 0.187705144f},
-std::array<float,2>{0.161480054f, 0.35005039f},
-std::array<float,2>{0.98234266f, 0.776379168f},
-std::array<float,2>{0.228713498f, 0.558034837f},
-std::array<float,2>{0.886415839f, 0.0441008247f},
-std::array<float,2>{0.383858353f, 0.479079187f},
-std::array<float,2>{0.510377526f, 0.93746227f},
-std::array<float,2>{0.327354372f, 0.843046725f},
-std::array<float,2>{0.706042528f, 0.305725127f},
-std::array<float,2>{0.000585321977f, 0.1540512f},
-std::array<float,2>{0.830589831f, 0.626937807f},
-std::array<float,2>{0.129759938f, 0.805952787f},
-std::array<float,2>{0.952559114f, 0.314400554f},
-std::array<float,2>{0.486399025f, 0.236723199f},
-std::array<float,2>{0.621756971f, 0.693451524f},
-std::array<float,2>{0.255156457f, 0.572533727f},
-std::array<float,2>{0.664520442f, 0.0930543616f},
-std::array<float,2>{0.0813595131f, 0.40534544f},
-std::array<float,2>{0.784785867f, 0.970638752f},
-std::array<float,2>{0.0494516417f, 0.660399675f},
-std::array<float,2>{0.851870418f, 0.159974575f},
-std::array<float,2>{0.361089379f, 0.262516141f},
-std::array<float,2>{0.729153335f, 0.852141857f},
-std::array<float,2>{0.418101937f, 0.883363545f},
-std::array<float,2>{0.550050557f, 0.4508048f},
-std::array<float,2>{0.20414868f, 0.0204350613f},
-std::array<float,2>{0.92313832f, 0.50422132f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.407800078f, 0.8442536f},
-std::array<float,2>{0.587527096f, 0.23548229f},
-std::array<float,2>{0.978728712f, 0.646827936f},
-std::array<float,2>{0.130732656f, 0.300448418f},
-std::array<float,2>{0.103660405f, 0.522768974f},
-std::array<float,2>{0.782684922f, 0.481478781f},
-std::array<float,2>{0.713951111f, 0.962670207f},
-std::array<float,2>{0.30073148f, 0.00499550067f},
-std::array<float,2>{0.340997994f, 0.709573328f},
-std::array<float,2>{0.648365676f, 0.339554101f},
-std::array<float,2>{0.820601285f, 0.807329476f},
-std::array<float,2>{0.018924525f, 0.151460499f},
-std::array<float,2>{0.247321576f, 0.877124131f},
-std::array<float,2>{0.905929983f, 0.0813911036f},
-std::array<float,2>{0.548345804f, 0.61819613f},
-std::array<float,2>{0.456791341f, 0.432048112f},
-std::array<float,2>{0.277148992f, 0.982685149f},
-std::array<float,2>{0.743986547f, 0.0501060486f},
-std::array<float,2>{0.757856607f, 0.535368085f},
-std::array<float,2>{0.0630864277f, 0.44095251f},
-std::array<float,2>{0.162640274f, 0.68412447f},
-std::array<float,2>{0.967815936f, 0.25990811f},
-std::array<float,2>{0.619917929f, 0.837838233f},
-std::array<float,2>{0.393650919f, 0.188003272f},
-std::array<float,2>{0.476973504f, 0.5719226f},
-std::array<float,2>{0.531063199f, 0.381219268f},
-std::array<float,2>{0.923539579f, 0.924037337f},
-std::array<float,2>{0.191263899f, 0.0944396406f},
-std::array<float,2>{0.0406171195f, 0.760097921f},
-std::array<float,2>{0.868816078f, 0.172067776f},
-std::array<float,2>{0.685444176f, 0.730339706f},
-std::array<float,2>{0.372586936f, 0.344608366f},
-std::array<float,2>{0.346662909f, 0.789863229f},
-std::array<float,2>{0.669065595f, 0.134517998f},
-std::array<float,2>{0.852965176f, 0.687735915f},
-std::array<float,2>{0.0509867892f, 0.323053598f},
-std::array<float,2>{0.215056375f, 0.595274866f},
-std::array<float,2>{0.909260869f, 0.420297325f},
-std::array<float,2>{0.506124198f, 0.902223229f},
-std::array<float,2>{0.48880133f, 0.0654655099f},
-std::array<float,2>{0.378038228f, 0.637833595f},
-std::array<float,2>{0.608418703f, 0.283659577f},
-std::array<float,2>{0.950592816f, 0.869384646f},
-std::array<float,2>{0.179770336f, 0.222733393f},
-std::array<float,2>{0.0919908658f, 0.949330807f},
-std::array<float,2>{0.78020376f, 0.0236400198f},
-std::array<float,2>{0.732879877f, 0.504261851f},
-std::array<float,2>{0.260396898f, 0.489553899f},
-std::array<float,2>{0.445002854f, 0.91425705f},
-std::array<float,2>{0.54076916f, 0.11024221f},
-std::array<float,2>{0.884152472f, 0.5799734f},
-std::array<float,2>{0.222507253f, 0.395714849f},
-std::array<float,2>{0.00965865608f, 0.739356577f},
-std::array<float,2>{0.834269226f, 0.371792018f},
-std::array<float,2>{0.637296796f, 0.775155663f},
-std::array<float,2>{0.312705249f, 0.161678031f},
-std::array<float,2>{0.284860462f, 0.554244876f},
-std::array<float,2>{0.69564271f, 0.464865297f},
-std::array<float,2>{0.804718673f, 0.99447161f},
-std::array<float,2>{0.117304727f, 0.0337151326f},
-std::array<float,2>{0.148720101f, 0.826953292f},
-std::array<float,2>{0.990704f, 0.207547486f},
-std::array<float,2>{0.567569375f, 0.667353034f},
-std::array<float,2>{0.42272976f, 0.281058222f},
-std::array<float,2>{0.49331224f, 0.77315557f},
-std::array<float,2>{0.508405089f, 0.1653613f},
-std::array<float,2>{0.914393485f, 0.742680132f},
-std::array<float,2>{0.206856087f, 0.365188807f},
-std::array<float,2>{0.054897882f, 0.587071419f},
-std::array<float,2>{0.847211301f, 0.404284149f},
-std::array<float,2>{0.663582563f, 0.911589146f},
-std::array<float,2>{0.354949206f, 0.124640524f},
-std::array<float,2>{0.256600976f, 0.662967324f},
-std::array<float,2>{0.726482093f, 0.271277845f},
-std::array<float,2>{0.765996695f, 0.814541519f},
-std::array<float,2>{0.0816338062f, 0.217510566f},
-std::array<float,2>{0.173378974f, 0.988176823f},
-std::array<float,2>{0.941348612f, 0.0421277247f},
-std::array<float,2>{0.599058151f, 0.562450945f},
-std::array<float,2>{0.38435784f, 0.459767342f},
-std::array<float,2>{0.323674768f, 0.895264328f},
-std::array<float,2>{0.631596744f, 0.0706630498f},
-std::array<float,2>{0.841234326f, 0.603139997f},
-std::array<float,2>{0.00163358485f, 0.406949043f},
-std::array<float,2>{0.227949619f, 0.697604775f},
-std::array<float,2>{0.882083654f, 0.315044045f},
-std::array<float,2>{0.53641504f, 0.783590555f},
-std::array<float,2>{0.449078381f, 0.127173364f},
-std::array<float,2>{0.433736444f, 0.514228582f},
-std::array<float,2>{0.57316649f, 0.497259825f},
-std::array<float,2>{0.997710943f, 0.939372659f},
-std::array<float,2>{0.144460827f, 0.0183427017f},
-std::array<float,2>{0.110407591f, 0.862124979f},
-std::array<float,2>{0.799519837f, 0.232644349f},
-std::array<float,2>{0.694805741f, 0.629477739f},
-std::array<float,2>{0.290382296f, 0.290739834f},
-std::array<float,2>{0.310096264f, 0.834093034f},
-std::array<float,2>{0.70742619f, 0.201512501f},
-std::array<float,2>{0.791399121f, 0.6784724f},
-std::array<float,2>{0.0972860381f, 0.25335598f},
-std::array<float,2>{0.139236212f, 0.542568684f},
-std::array<float,2>{0.970144689f, 0.450458378f},
-std::array<float,2>{0.580245674f, 0.973264396f},
-std::array<float,2>{0.417151004f, 0.059310738f},
-std::array<float,2>{0.466592312f, 0.719223619f},
-std::array<float,2>{0.556581616f, 0.356821895f},
-std::array<float,2>{0.895227373f, 0.75231415f},
-std::array<float,2>{0.234469935f, 0.18720001f},
-std::array<float,2>{0.025924528f, 0.936584175f},
-std::array<float,2>{0.815787315f, 0.108674511f},
-std::array<float,2>{0.653830111f, 0.565007627f},
-std::array<float,2>{0.328151435f, 0.388601631f},
-std::array<float,2>{0.40212363f, 0.957877576f},
-std::array<float,2>{0.610874712f, 0.00954037812f},
-std::array<float,2>{0.953150094f, 0.524623334f},
-std::array<float,2>{0.164949998f, 0.475803316f},
-std::array<float,2>{0.0756694227f, 0.651290834f},
-std::array<float,2>{0.757591903f, 0.306503564f},
-std::array<float,2>{0.74129349f, 0.854687214f},
-std::array<float,2>{0.270782471f, 0.249976739f},
-std::array<float,2>{0.363641679f, 0.614321113f},
-std::array<float,2>{0.671944261f, 0.424458712f},
-std::array<float,2>{0.861762941f, 0.885710657f},
-std::array<float,2>{0.0333211236f, 0.0891774967f},
-std::array<float,2>{0.20086661f, 0.799280822f},
-std::array<float,2>{0.937116027f, 0.142556131f},
-std::array<float,2>{0.522614956f, 0.712271154f},
-std::array<float,2>{0.470711589f, 0.333427578f},
-std::array<float,2>{0.388623744f, 0.812211156f},
-std::array<float,2>{0.594500422f, 0.15287149f},
-std::array<float,2>{0.942827761f, 0.706393301f},
-std::array<float,2>{0.176652983f, 0.342898756f},
-std::array<float,2>{0.0826201364f, 0.624080956f},
-std::array<float,2>{0.772027135f, 0.436022013f},
-std::array<float,2>{0.719068646f, 0.879550219f},
-std::array<float,2>{0.252090663f, 0.0858609527f},
-std::array<float,2>{0.357299477f, 0.642480254f},
-std::array<float,2>{0.657624066f, 0.304558963f},
-std::array<float,2>{0.848836362f, 0.850528717f},
-std::array<float,2>{0.0611987561f, 0.241425619f},
-std::array<float,2>{0.208286315f, 0.967661738f},
-std::array<float,2>{0.92110914f, 0.00182187103f},
-std::array<float,2>{0.513671815f, 0.518064857f},
-std::array<float,2>{0.49717018f, 0.479422539f},
-std::array<float,2>{0.294903666f, 0.928037763f},
-std::array<float,2>{0.690481901f, 0.0981527194f},
-std::array<float,2>{0.801632762f, 0.576050162f},
-std::array<float,2>{0.114739195f, 0.377047062f},
-std::array<float,2>{0.146478072f, 0.73282963f},
-std::array<float,2>{0.996013701f, 0.34807539f},
-std::array<float,2>{0.576001108f, 0.762289166f},
-std::array<float,2>{0.433488071f, 0.178781077f},
-std::array<float,2>{0.449219137f, 0.532912254f},
-std::array<float,2>{0.533353984f, 0.441479385f},
-std::array<float,2>{0.878864169f, 0.976987422f},
-std::array<float,2>{0.233585164f, 0.0512894504f},
-std::array<float,2>{0.00665393565f, 0.840637386f},
-std::array<float,2>{0.838939846f, 0.191796377f},
-std::array<float,2>{0.626270533f, 0.680124104f},
-std::array<float,2>{0.327953875f, 0.264478862f},
-std::array<float,2>{0.333593756f, 0.871495247f},
-std::array<float,2>{0.648543477f, 0.218937173f},
-std::array<float,2>{0.817587376f, 0.636083603f},
-std::array<float,2>{0.0294836741f, 0.288520604f},
-std::array<float,2>{0.240476608f, 0.500685334f},
-std::array<float,2>{0.893328726f, 0.48801285f},
-std::array<float,2>{0.561872005f, 0.948143542f},
-std::array<float,2>{0.461407006f, 0.0290995762f},
-std::array<float,2>{0.420626223f, 0.691942036f},
-std::array<float,2>{0.583666682f, 0.32808277f},
-std::array<float,2>{0.975660086f, 0.796263754f},
-std::array<float,2>{0.135991469f, 0.14061299f},
-std::array<float,2>{0.100726105f, 0.905622959f},
-std::array<float,2>{0.796414614f, 0.0698261335f},
-std::array<float,2>{0.70628202f, 0.599173486f},
-std::array<float,2>{0.306217939f, 0.415550143f},
-std::array<float,2>{0.47600463f, 0.998870194f},
-std::array<float,2>{0.516188204f, 0.0353293344f},
-std::array<float,2>{0.932674825f, 0.549348891f},
-std::array<float,2>{0.198199302f, 0.461116254f},
-std::array<float,2>{0.0376486517f, 0.671339035f},
-std::array<float,2>{0.864086986f, 0.275141418f},
-std::array<float,2>{0.677708209f, 0.82406503f},
-std::array<float,2>{0.36273697f, 0.204850554f},
-std::array<float,2>{0.267366916f, 0.583033502f},
-std::array<float,2>{0.735691011f, 0.391706198f},
-std::array<float,2>{0.752574503f, 0.92045176f},
-std::array<float,2>{0.0722872168f, 0.115434937f},
-std::array<float,2>{0.168665215f, 0.780546784f},
-std::array<float,2>{0.957067549f, 0.159333989f},
-std::array<float,2>{0.614732146f, 0.734807014f},
-std::array<float,2>{0.405130297f, 0.370120108f},
-std::array<float,2>{0.457224429f, 0.817982376f},
-std::array<float,2>{0.552010417f, 0.212290391f},
-std::array<float,2>{0.900605857f, 0.658466458f},
-std::array<float,2>{0.244201586f, 0.268995106f},
-std::array<float,2>{0.0221697409f, 0.557135999f},
-std::array<float,2>{0.82716471f, 0.456625611f},
-std::array<float,2>{0.643815041f, 0.988455474f},
-std::array<float,2>{0.336760014f, 0.0442448184f},
-std::array<float,2>{0.30262661f, 0.747653723f},
-std::array<float,2>{0.715126157f, 0.361557931f},
-std::array<float,2>{0.788158417f, 0.767303407f},
-std::array<float,2>{0.107898936f, 0.169469029f},
-std::array<float,2>{0.128565311f, 0.908115089f},
-std::array<float,2>{0.980905652f, 0.120990574f},
-std::array<float,2>{0.593687594f, 0.591980577f},
-std::array<float,2>{0.41259262f, 0.400172234f},
-std::array<float,2>{0.370026022f, 0.941775084f},
-std::array<float,2>{0.680722654f, 0.0196406413f},
-std::array<float,2>{0.874131262f, 0.508871913f},
-std::array<float,2>{0.0440699011f, 0.494355112f},
-std::array<float,2>{0.19265607f, 0.62503469f},
-std::array<float,2>{0.926576257f, 0.294730186f},
-std::array<float,2>{0.526447475f, 0.865051866f},
-std::array<float,2>{0.481470257f, 0.23011978f},
-std::array<float,2>{0.398376912f, 0.607328475f},
-std::array<float,2>{0.621509016f, 0.41038543f},
-std::array<float,2>{0.961684406f, 0.892019808f},
-std::array<float,2>{0.158998922f, 0.0745794326f},
-std::array<float,2>{0.0666533113f, 0.786859274f},
-std::array<float,2>{0.764476836f, 0.13115485f},
-std::array<float,2>{0.746237934f, 0.70230335f},
-std::array<float,2>{0.279104769f, 0.317477107f},
-std::array<float,2>{0.26199457f, 0.75700599f},
-std::array<float,2>{0.729268909f, 0.180913851f},
-std::array<float,2>{0.775640368f, 0.725953639f},
-std::array<float,2>{0.0885100886f, 0.352957755f},
-std::array<float,2>{0.184136584f, 0.567822278f},
-std::array<float,2>{0.946556151f, 0.385947883f},
-std::array<float,2>{0.601894855f, 0.93338871f},
-std::array<float,2>{0.379741549f, 0.104967512f},
-std::array<float,2>{0.486559421f, 0.673461676f},
-std::array<float,2>{0.50235188f, 0.255850315f},
-std::array<float,2>{0.911413252f, 0.831084311f},
-std::array<float,2>{0.214753106f, 0.198372915f},
-std::array<float,2>{0.0477297679f, 0.971329689f},
-std::array<float,2>{0.855946898f, 0.057430502f},
-std::array<float,2>{0.667217255f, 0.546526074f},
-std::array<float,2>{0.350905031f, 0.447329879f},
-std::array<float,2>{0.425847024f, 0.890043318f},
-std::array<float,2>{0.565899849f, 0.0931400359f},
-std::array<float,2>{0.987779438f, 0.610598147f},
-std::array<float,2>{0.15334034f, 0.428494334f},
-std::array<float,2>{0.121543474f, 0.717390954f},
-std::array<float,2>{0.811366141f, 0.331563771f},
-std::array<float,2>{0.699797571f, 0.801396489f},
-std::array<float,2>{0.287676424f, 0.145555481f},
-std::array<float,2>{0.319651484f, 0.530496657f},
-std::array<float,2>{0.636328042f, 0.471472651f},
-std::array<float,2>{0.829169333f, 0.954607129f},
-std::array<float,2>{0.0131604057f, 0.0139937364f},
-std::array<float,2>{0.225607395f, 0.857046247f},
-std::array<float,2>{0.888626575f, 0.245189324f},
-std::array<float,2>{0.544569075f, 0.654186547f},
-std::array<float,2>{0.437935233f, 0.311698079f},
-std::array<float,2>{0.39214474f, 0.839653254f},
-std::array<float,2>{0.618335426f, 0.191159308f},
-std::array<float,2>{0.966076553f, 0.686898708f},
-std::array<float,2>{0.160930097f, 0.259198308f},
-std::array<float,2>{0.0650830716f, 0.537700951f},
-std::array<float,2>{0.760437727f, 0.438577086f},
-std::array<float,2>{0.744758725f, 0.981775403f},
-std::array<float,2>{0.273723453f, 0.0476011299f},
-std::array<float,2>{0.374456614f, 0.727907181f},
-std::array<float,2>{0.686308622f, 0.345900267f},
-std::array<float,2>{0.869488478f, 0.758589745f},
-std::array<float,2>{0.041853413f, 0.174592376f},
-std::array<float,2>{0.188433394f, 0.92213279f},
-std::array<float,2>{0.924613476f, 0.095964618f},
-std::array<float,2>{0.529154301f, 0.573418677f},
-std::array<float,2>{0.47916761f, 0.380441248f},
-std::array<float,2>{0.297846705f, 0.96310854f},
-std::array<float,2>{0.71203506f, 0.00652603153f},
-std::array<float,2>{0.784033f, 0.520200968f},
-std::array<float,2>{0.10276103f, 0.484083772f},
-std::array<float,2>{0.131277591f, 0.645650327f},
-std::array<float,2>{0.978118181f, 0.298546523f},
-std::array<float,2>{0.589101374f, 0.847303033f},
-std::array<float,2>{0.409638077f, 0.237477913f},
-std::array<float,2>{0.454192549f, 0.620211184f},
-std::array<float,2>{0.549742162f, 0.43054077f},
-std::array<float,2>{0.902784348f, 0.875646591f},
-std::array<float,2>{0.249286845f, 0.0784615055f},
-std::array<float,2>{0.0169686191f, 0.806392491f},
-std::array<float,2>{0.823862433f, 0.148619682f},
-std::array<float,2>{0.646289229f, 0.707868695f},
-std::array<float,2>{0.342205524f, 0.337391883f},
-std::array<float,2>{0.315231621f, 0.776924908f},
-std::array<float,2>{0.639747798f, 0.162384361f},
-std::array<float,2>{0.833170116f, 0.741469502f},
-std::array<float,2>{0.0109010097f, 0.374350637f},
-std::array<float,2>{0.219952822f, 0.581498027f},
-std::array<float,2>{0.884854734f, 0.398058474f},
-std::array<float,2>{0.541159809f, 0.917203605f},
-std::array<float,2>{0.44165957f, 0.111978024f},
-std::array<float,2>{0.425078541f, 0.665395021f},
-std::array<float,2>{0.570168078f, 0.277795851f},
-std::array<float,2>{0.990105629f, 0.825835466f},
-std::array<float,2>{0.151464283f, 0.210772812f},
-std::array<float,2>{0.119205862f, 0.993170321f},
-std::array<float,2>{0.80824244f, 0.0319462791f},
-std::array<float,2>{0.697387338f, 0.5517537f},
-std::array<float,2>{0.281361759f, 0.467261165f},
-std::array<float,2>{0.491174787f, 0.900075853f},
-std::array<float,2>{0.504326582f, 0.06432724f},
-std::array<float,2>{0.907155395f, 0.596960008f},
-std::array<float,2>{0.217191711f, 0.41828841f},
-std::array<float,2>{0.0530938096f, 0.689706624f},
-std::array<float,2>{0.85476613f, 0.32189849f},
-std::array<float,2>{0.671329916f, 0.792057216f},
-std::array<float,2>{0.344777822f, 0.135309562f},
-std::array<float,2>{0.258722007f, 0.506961823f},
-std::array<float,2>{0.730477273f, 0.491352886f},
-std::array<float,2>{0.77793628f, 0.952292621f},
-std::array<float,2>{0.0913099721f, 0.0273388624f},
-std::array<float,2>{0.182279229f, 0.868515432f},
-std::array<float,2>{0.952219188f, 0.225858644f},
-std::array<float,2>{0.605646968f, 0.639111698f},
-std::array<float,2>{0.375875086f, 0.282675385f},
-std::array<float,2>{0.445404589f, 0.781529486f},
-std::array<float,2>{0.538246989f, 0.1264759f},
-std::array<float,2>{0.880136192f, 0.697002411f},
-std::array<float,2>{0.228771269f, 0.313969582f},
-std::array<float,2>{0.00351237855f, 0.604052246f},
-std::array<float,2>{0.84204495f, 0.408901244f},
-std::array<float,2>{0.630729795f, 0.897060633f},
-std::array<float,2>{0.321703434f, 0.0739533752f},
-std::array<float,2>{0.291474074f, 0.632784128f},
-std::array<float,2>{0.691957355f, 0.291982383f},
-std::array<float,2>{0.797536612f, 0.860208631f},
-std::array<float,2>{0.111967944f, 0.231501773f},
-std::array<float,2>{0.14119415f, 0.940890551f},
-std::array<float,2>{0.999885261f, 0.016818149f},
-std::array<float,2>{0.571309745f, 0.51296401f},
-std::array<float,2>{0.436867148f, 0.499112517f},
-std::array<float,2>{0.353077561f, 0.912769496f},
-std::array<float,2>{0.660629272f, 0.12277998f},
-std::array<float,2>{0.844532609f, 0.588145912f},
-std::array<float,2>{0.0577432141f, 0.404488564f},
-std::array<float,2>{0.203638941f, 0.745908856f},
-std::array<float,2>{0.917910814f, 0.365257829f},
-std::array<float,2>{0.509824693f, 0.770660162f},
-std::array<float,2>{0.494715363f, 0.167087689f},
-std::array<float,2>{0.38607648f, 0.560364246f},
-std::array<float,2>{0.600943089f, 0.457492501f},
-std::array<float,2>{0.938341141f, 0.986161768f},
-std::array<float,2>{0.174110338f, 0.03928826f},
-std::array<float,2>{0.0785425678f, 0.813009799f},
-std::array<float,2>{0.767648339f, 0.216300324f},
-std::array<float,2>{0.723633349f, 0.661445677f},
-std::array<float,2>{0.254109144f, 0.27322191f},
-std::array<float,2>{0.272639006f, 0.853186011f},
-std::array<float,2>{0.739504397f, 0.24658379f},
-std::array<float,2>{0.754607141f, 0.648792922f},
-std::array<float,2>{0.0764547735f, 0.307633311f},
-std::array<float,2>{0.166501865f, 0.525849998f},
-std::array<float,2>{0.955955684f, 0.473437935f},
-std::array<float,2>{0.611508846f, 0.960688055f},
-std::array<float,2>{0.39849925f, 0.0110436622f},
-std::array<float,2>{0.470601052f, 0.713797033f},
-std::array<float,2>{0.520832181f, 0.335666627f},
-std::array<float,2>{0.933807135f, 0.797804058f},
-std::array<float,2>{0.201264814f, 0.144331768f},
-std::array<float,2>{0.0328588635f, 0.883463562f},
-std::array<float,2>{0.861020923f, 0.0878087804f},
-std::array<float,2>{0.675451458f, 0.615429759f},
-std::array<float,2>{0.366024435f, 0.42353031f},
-std::array<float,2>{0.415228248f, 0.974789023f},
-std::array<float,2>{0.579960048f, 0.0605898872f},
-std::array<float,2>{0.971613467f, 0.540011108f},
-std::array<float,2>{0.137899518f, 0.451973766f},
-std::array<float,2>{0.0953332856f, 0.675859809f},
-std::array<float,2>{0.789370656f, 0.250897408f},
-std::array<float,2>{0.709659755f, 0.833530605f},
-std::array<float,2>{0.31154865f, 0.199481249f},
-std::array<float,2>{0.330471218f, 0.563907802f},
-std::array<float,2>{0.655210733f, 0.389783412f},
-std::array<float,2>{0.813119292f, 0.934480965f},
-std::array<float,2>{0.0248409901f, 0.106917977f},
-std::array<float,2>{0.238140345f, 0.750756979f},
-std::array<float,2>{0.898065567f, 0.183640629f},
-std::array<float,2>{0.557583332f, 0.720808864f},
-std::array<float,2>{0.468466222f, 0.357581168f},
-std::array<float,2>{0.430905491f, 0.765448213f},
-std::array<float,2>{0.577270508f, 0.176731616f},
-std::array<float,2>{0.992563665f, 0.731974721f},
-std::array<float,2>{0.147867993f, 0.351103067f},
-std::array<float,2>{0.115861207f, 0.577195525f},
-std::array<float,2>{0.80364424f, 0.375787735f},
-std::array<float,2>{0.68773663f, 0.92656517f},
-std::array<float,2>{0.295378029f, 0.101396635f},
-std::array<float,2>{0.32509473f, 0.683481514f},
-std::array<float,2>{0.627925873f, 0.263487279f},
-std::array<float,2>{0.835987747f, 0.842866421f},
-std::array<float,2>{0.00517386151f, 0.194847926f},
-std::array<float,2>{0.232182413f, 0.979006529f},
-std::array<float,2>{0.876427412f, 0.0531123169f},
-std::array<float,2>{0.532134235f, 0.534440517f},
-std::array<float,2>{0.452620506f, 0.444689512f},
-std::array<float,2>{0.251265764f, 0.882345796f},
-std::array<float,2>{0.722341955f, 0.0822830945f},
-std::array<float,2>{0.770029426f, 0.621996701f},
-std::array<float,2>{0.0855053812f, 0.433835208f},
-std::array<float,2>{0.179474682f, 0.7044487f},
-std::array<float,2>{0.943846822f, 0.341133028f},
-std::array<float,2>{0.596171558f, 0.809433043f},
-std::array<float,2>{0.388905346f, 0.155820951f},
-std::array<float,2>{0.49941203f, 0.516616166f},
-std::array<float,2>{0.514285088f, 0.476798654f},
-std::array<float,2>{0.919676006f, 0.965253651f},
-std::array<float,2>{0.210526913f, 0.00233853213f},
-std::array<float,2>{0.0587263219f, 0.848745763f},
-std::array<float,2>{0.851372361f, 0.239263117f},
-std::array<float,2>{0.659098685f, 0.643137634f},
-std::array<float,2>{0.359024376f, 0.300859272f},
-std::array<float,2>{0.361200035f, 0.821722746f},
-std::array<float,2>{0.678126097f, 0.205832973f},
-std::array<float,2>{0.866943777f, 0.668590486f},
-std::array<float,2>{0.0360662341f, 0.275914341f},
-std::array<float,2>{0.195727512f, 0.548553765f},
-std::array<float,2>{0.930145204f, 0.462957323f},
-std::array<float,2>{0.518704295f, 0.997960448f},
-std::array<float,2>{0.473420173f, 0.0387429297f},
-std::array<float,2>{0.403534442f, 0.737801433f},
-std::array<float,2>{0.615316033f, 0.369112462f},
-std::array<float,2>{0.959219456f, 0.777662694f},
-std::array<float,2>{0.170337498f, 0.158167362f},
-std::array<float,2>{0.0720550716f, 0.918954432f},
-std::array<float,2>{0.750513911f, 0.114521116f},
-std::array<float,2>{0.736694872f, 0.584249556f},
-std::array<float,2>{0.26795125f, 0.394394636f},
-std::array<float,2>{0.46346879f, 0.946514845f},
-std::array<float,2>{0.558665276f, 0.0312227216f},
-std::array<float,2>{0.891808748f, 0.50200516f},
-std::array<float,2>{0.238801822f, 0.484907538f},
-std::array<float,2>{0.0278833583f, 0.633889019f},
-std::array<float,2>{0.818944156f, 0.28541857f},
-std::array<float,2>{0.650577664f, 0.874738693f},
-std::array<float,2>{0.335067898f, 0.221357748f},
-std::array<float,2>{0.308271408f, 0.59967196f},
-std::array<float,2>{0.704034269f, 0.416461587f},
-std::array<float,2>{0.793772876f, 0.903361857f},
-std::array<float,2>{0.0979364812f, 0.0678821802f},
-std::array<float,2>{0.133110151f, 0.793952525f},
-std::array<float,2>{0.97360152f, 0.137770861f},
-std::array<float,2>{0.585564792f, 0.693700552f},
-std::array<float,2>{0.419803143f, 0.324950069f},
-std::array<float,2>{0.483108222f, 0.865911782f},
-std::array<float,2>{0.523747623f, 0.226751938f},
-std::array<float,2>{0.929680824f, 0.628245294f},
-std::array<float,2>{0.194428846f, 0.295606941f},
-std::array<float,2>{0.0465325862f, 0.510032058f},
-std::array<float,2>{0.872163355f, 0.493478417f},
-std::array<float,2>{0.682685316f, 0.945297837f},
-std::array<float,2>{0.368669152f, 0.0224835165f},
-std::array<float,2>{0.280736566f, 0.700398207f},
-std::array<float,2>{0.749181747f, 0.319896191f},
-std::array<float,2>{0.762358367f, 0.788493335f},
-std::array<float,2>{0.0684948266f, 0.130726665f},
-std::array<float,2>{0.15652056f, 0.894476831f},
-std::array<float,2>{0.963696182f, 0.0772592872f},
-std::array<float,2>{0.624921024f, 0.608892918f},
-std::array<float,2>{0.395222336f, 0.413482219f},
-std::array<float,2>{0.339586556f, 0.991027355f},
-std::array<float,2>{0.642169297f, 0.0454329811f},
-std::array<float,2>{0.824472785f, 0.556195617f},
-std::array<float,2>{0.0209426042f, 0.454979181f},
-std::array<float,2>{0.243461072f, 0.656735778f},
-std::array<float,2>{0.899548411f, 0.267387092f},
-std::array<float,2>{0.554203153f, 0.819984972f},
-std::array<float,2>{0.459265471f, 0.214704335f},
-std::array<float,2>{0.411329597f, 0.590845764f},
-std::array<float,2>{0.590169489f, 0.401060343f},
-std::array<float,2>{0.983068347f, 0.908992529f},
-std::array<float,2>{0.125382155f, 0.118383616f},
-std::array<float,2>{0.107131861f, 0.768579841f},
-std::array<float,2>{0.785319686f, 0.170786366f},
-std::array<float,2>{0.716955781f, 0.749455512f},
-std::array<float,2>{0.303002685f, 0.361108392f},
-std::array<float,2>{0.286008298f, 0.803569257f},
-std::array<float,2>{0.702156246f, 0.147713408f},
-std::array<float,2>{0.809389651f, 0.716467679f},
-std::array<float,2>{0.123463891f, 0.329362005f},
-std::array<float,2>{0.156219363f, 0.611963391f},
-std::array<float,2>{0.985434592f, 0.427625269f},
-std::array<float,2>{0.564112067f, 0.888247311f},
-std::array<float,2>{0.429311663f, 0.0916610658f},
-std::array<float,2>{0.440047115f, 0.654954672f},
-std::array<float,2>{0.545056999f, 0.310478568f},
-std::array<float,2>{0.889341295f, 0.858947515f},
-std::array<float,2>{0.223955408f, 0.243080422f},
-std::array<float,2>{0.0147097073f, 0.956411362f},
-std::array<float,2>{0.831688523f, 0.0130475787f},
-std::array<float,2>{0.633896351f, 0.527444959f},
-std::array<float,2>{0.316465527f, 0.469010949f},
-std::array<float,2>{0.382679313f, 0.930815578f},
-std::array<float,2>{0.605376482f, 0.102565587f},
-std::array<float,2>{0.948376238f, 0.568876565f},
-std::array<float,2>{0.187056631f, 0.384312034f},
-std::array<float,2>{0.0876016542f, 0.722934186f},
-std::array<float,2>{0.77419591f, 0.354108214f},
-std::array<float,2>{0.726570308f, 0.755042791f},
-std::array<float,2>{0.26454249f, 0.18279773f},
-std::array<float,2>{0.348626792f, 0.543819487f},
-std::array<float,2>{0.664188921f, 0.445757776f},
-std::array<float,2>{0.857609153f, 0.97066313f},
-std::array<float,2>{0.0506838895f, 0.0564820096f},
-std::array<float,2>{0.212611273f, 0.828845441f},
-std::array<float,2>{0.913470507f, 0.196137995f},
-std::array<float,2>{0.500569224f, 0.674351037f},
-std::array<float,2>{0.484903544f, 0.256354392f},
-std::array<float,2>{0.376459539f, 0.870499015f},
-std::array<float,2>{0.607164085f, 0.224390805f},
-std::array<float,2>{0.952095628f, 0.637283921f},
-std::array<float,2>{0.182621986f, 0.284826636f},
-std::array<float,2>{0.0902179256f, 0.504964769f},
-std::array<float,2>{0.77900821f, 0.488304257f},
-std::array<float,2>{0.731606126f, 0.950235069f},
-std::array<float,2>{0.259710371f, 0.0250334367f},
-std::array<float,2>{0.344691813f, 0.688612938f},
-std::array<float,2>{0.670178771f, 0.323929697f},
-std::array<float,2>{0.853683412f, 0.790087104f},
-std::array<float,2>{0.0546334051f, 0.133054763f},
-std::array<float,2>{0.218740776f, 0.90112406f},
-std::array<float,2>{0.907901049f, 0.0650304556f},
-std::array<float,2>{0.505827487f, 0.59418124f},
-std::array<float,2>{0.491839677f, 0.421582669f},
-std::array<float,2>{0.28226614f, 0.995607376f},
-std::array<float,2>{0.698809326f, 0.0345584527f},
-std::array<float,2>{0.807386398f, 0.55290693f},
-std::array<float,2>{0.120490715f, 0.466003388f},
-std::array<float,2>{0.150694445f, 0.666873991f},
-std::array<float,2>{0.988608003f, 0.279513985f},
-std::array<float,2>{0.568589032f, 0.827696323f},
-std::array<float,2>{0.423949659f, 0.208357364f},
-std::array<float,2>{0.442815781f, 0.57909286f},
-std::array<float,2>{0.542569816f, 0.394723088f},
-std::array<float,2>{0.886312544f, 0.915612876f},
-std::array<float,2>{0.218952641f, 0.11088632f},
-std::array<float,2>{0.00989048835f, 0.774101913f},
-std::array<float,2>{0.832580566f, 0.160498753f},
-std::array<float,2>{0.639636815f, 0.739238262f},
-std::array<float,2>{0.316321254f, 0.372581959f},
-std::array<float,2>{0.3435013f, 0.808181286f},
-std::array<float,2>{0.644578695f, 0.151331261f},
-std::array<float,2>{0.822710037f, 0.709987283f},
-std::array<float,2>{0.0160662606f, 0.338420063f},
-std::array<float,2>{0.248915061f, 0.618043423f},
-std::array<float,2>{0.903545499f, 0.432664007f},
-std::array<float,2>{0.550261259f, 0.878105462f},
-std::array<float,2>{0.453282386f, 0.080662027f},
-std::array<float,2>{0.408750236f, 0.648035944f},
-std::array<float,2>{0.588666558f, 0.298881143f},
-std::array<float,2>{0.977033079f, 0.844861865f},
-std::array<float,2>{0.132707208f, 0.234413043f},
-std::array<float,2>{0.101574905f, 0.961701512f},
-std::array<float,2>{0.784790516f, 0.00421790034f},
-std::array<float,2>{0.711446404f, 0.52232635f},
-std::array<float,2>{0.297994524f, 0.480702877f},
-std::array<float,2>{0.479888201f, 0.92501682f},
-std::array<float,2>{0.528006434f, 0.0954090804f},
-std::array<float,2>{0.925130725f, 0.570543647f},
-std::array<float,2>{0.189114705f, 0.382377386f},
-std::array<float,2>{0.0423936322f, 0.728835762f},
-std::array<float,2>{0.871021926f, 0.345499039f},
-std::array<float,2>{0.687429428f, 0.760900497f},
-std::array<float,2>{0.373556674f, 0.173598468f},
-std::array<float,2>{0.275066525f, 0.536201596f},
-std::array<float,2>{0.745346904f, 0.439867288f},
-std::array<float,2>{0.761407793f, 0.983957589f},
-std::array<float,2>{0.0656989068f, 0.0493787155f},
-std::array<float,2>{0.161449969f, 0.836049259f},
-std::array<float,2>{0.965679348f, 0.189048722f},
-std::array<float,2>{0.617403865f, 0.685312212f},
-std::array<float,2>{0.391496897f, 0.261234999f},
-std::array<float,2>{0.467300534f, 0.75330925f},
-std::array<float,2>{0.557764292f, 0.186118051f},
-std::array<float,2>{0.897328794f, 0.719989479f},
-std::array<float,2>{0.236956045f, 0.356038988f},
-std::array<float,2>{0.0235385634f, 0.565487146f},
-std::array<float,2>{0.813557863f, 0.387227327f},
-std::array<float,2>{0.655467629f, 0.935987532f},
-std::array<float,2>{0.331843883f, 0.107720755f},
-std::array<float,2>{0.311129004f, 0.678910792f},
-std::array<float,2>{0.710621059f, 0.252783537f},
-std::array<float,2>{0.790814996f, 0.835925281f},
-std::array<float,2>{0.094620578f, 0.203106955f},
-std::array<float,2>{0.137295321f, 0.97423929f},
-std::array<float,2>{0.972596288f, 0.0601938553f},
-std::array<float,2>{0.57903707f, 0.54172045f},
-std::array<float,2>{0.414721668f, 0.449500263f},
-std::array<float,2>{0.366809279f, 0.885893762f},
-std::array<float,2>{0.674702823f, 0.0885955691f},
-std::array<float,2>{0.860233068f, 0.613550067f},
-std::array<float,2>{0.0312910043f, 0.425566196f},
-std::array<float,2>{0.202985033f, 0.711746275f},
-std::array<float,2>{0.934612572f, 0.332081437f},
-std::array<float,2>{0.520301282f, 0.800258517f},
-std::array<float,2>{0.469712973f, 0.141132846f},
-std::array<float,2>{0.399699062f, 0.52429682f},
-std::array<float,2>{0.612982929f, 0.47521618f},
-std::array<float,2>{0.956517816f, 0.958076537f},
-std::array<float,2>{0.167156205f, 0.00850879867f},
-std::array<float,2>{0.0774962306f, 0.854030788f},
-std::array<float,2>{0.755422413f, 0.248809159f},
-std::array<float,2>{0.738822579f, 0.651418328f},
-std::array<float,2>{0.271925956f, 0.304934502f},
-std::array<float,2>{0.255490571f, 0.816147149f},
-std::array<float,2>{0.723543167f, 0.218168363f},
-std::array<float,2>{0.76913923f, 0.664053202f},
-std::array<float,2>{0.0794734433f, 0.269759893f},
-std::array<float,2>{0.17531839f, 0.560569048f},
-std::array<float,2>{0.938538432f, 0.460465014f},
-std::array<float,2>{0.599831223f, 0.986390531f},
-std::array<float,2>{0.385582596f, 0.0410644636f},
-std::array<float,2>{0.495855033f, 0.744065225f},
-std::array<float,2>{0.51141125f, 0.363902956f},
-std::array<float,2>{0.916514993f, 0.771777272f},
-std::array<float,2>{0.20460549f, 0.164634943f},
-std::array<float,2>{0.0567004979f, 0.910267174f},
-std::array<float,2>{0.845273077f, 0.123851426f},
-std::array<float,2>{0.661600947f, 0.586175859f},
-std::array<float,2>{0.351780057f, 0.402463019f},
-std::array<float,2>{0.436403453f, 0.93843776f},
-std::array<float,2>{0.570840478f, 0.0189837012f},
-std::array<float,2>{0.9985376f, 0.515240073f},
-std::array<float,2>{0.141820237f, 0.49670884f},
-std::array<float,2>{0.112319827f, 0.62989527f},
-std::array<float,2>{0.798111975f, 0.289840937f},
-std::array<float,2>{0.692741215f, 0.863097906f},
-std::array<float,2>{0.292010695f, 0.233917177f},
-std::array<float,2>{0.32042405f, 0.601844788f},
-std::array<float,2>{0.629326642f, 0.408151329f},
-std::array<float,2>{0.843470335f, 0.896361351f},
-std::array<float,2>{0.00206798222f, 0.0718520433f},
-std::array<float,2>{0.230197668f, 0.784939468f},
-std::array<float,2>{0.879524171f, 0.128044263f},
-std::array<float,2>{0.537745893f, 0.69887954f},
-std::array<float,2>{0.446859509f, 0.316368014f},
-std::array<float,2>{0.418053657f, 0.795366466f},
-std::array<float,2>{0.584742904f, 0.139049143f},
-std::array<float,2>{0.974215806f, 0.693143845f},
-std::array<float,2>{0.134502068f, 0.32632646f},
-std::array<float,2>{0.0993236229f, 0.598320127f},
-std::array<float,2>{0.794411182f, 0.41447562f},
-std::array<float,2>{0.704905272f, 0.904529274f},
-std::array<float,2>{0.30711025f, 0.0686947182f},
-std::array<float,2>{0.334843874f, 0.635603428f},
-std::array<float,2>{0.651846707f, 0.287139893f},
-std::array<float,2>{0.820027649f, 0.872361839f},
-std::array<float,2>{0.028539177f, 0.219814628f},
-std::array<float,2>{0.240137905f, 0.948646784f},
-std::array<float,2>{0.890851796f, 0.0283090621f},
-std::array<float,2>{0.560022891f, 0.501750648f},
-std::array<float,2>{0.464656323f, 0.486664116f},
-std::array<float,2>{0.269000173f, 0.921161711f},
-std::array<float,2>{0.737701297f, 0.116913483f},
-std::array<float,2>{0.751786292f, 0.582403779f},
-std::array<float,2>{0.0708467737f, 0.391563952f},
-std::array<float,2>{0.171693087f, 0.735697269f},
-std::array<float,2>{0.960732102f, 0.369711101f},
-std::array<float,2>{0.616650581f, 0.779664636f},
-std::array<float,2>{0.403000206f, 0.158514649f},
-std::array<float,2>{0.473880798f, 0.550210416f},
-std::array<float,2>{0.51833719f, 0.462442309f},
-std::array<float,2>{0.931203246f, 0.999309301f},
-std::array<float,2>{0.196913257f, 0.0362814888f},
-std::array<float,2>{0.0364864022f, 0.822332025f},
-std::array<float,2>{0.865887582f, 0.203423738f},
-std::array<float,2>{0.679496765f, 0.670399129f},
-std::array<float,2>{0.359502286f, 0.273779809f},
-std::array<float,2>{0.357751429f, 0.850634813f},
-std::array<float,2>{0.659470081f, 0.240767285f},
-std::array<float,2>{0.850506425f, 0.641406596f},
-std::array<float,2>{0.0605247132f, 0.302908272f},
-std::array<float,2>{0.209277168f, 0.518821657f},
-std::array<float,2>{0.918260872f, 0.480232149f},
-std::array<float,2>{0.515459239f, 0.968669891f},
-std::array<float,2>{0.49846971f, 0.000748933235f},
-std::array<float,2>{0.390472919f, 0.705357313f},
-std::array<float,2>{0.597103894f, 0.342516482f},
-std::array<float,2>{0.94500041f, 0.811356068f},
-std::array<float,2>{0.178156868f, 0.153825387f},
-std::array<float,2>{0.084174782f, 0.880134404f},
-std::array<float,2>{0.771352649f, 0.0840693712f},
-std::array<float,2>{0.721473753f, 0.623227656f},
-std::array<float,2>{0.250576586f, 0.437077254f},
-std::array<float,2>{0.451882422f, 0.978259146f},
-std::array<float,2>{0.533202052f, 0.0524256825f},
-std::array<float,2>{0.875500083f, 0.531882524f},
-std::array<float,2>{0.2312987f, 0.443274736f},
-std::array<float,2>{0.00452649267f, 0.681139886f},
-std::array<float,2>{0.837599277f, 0.264894783f},
-std::array<float,2>{0.628586233f, 0.841314554f},
-std::array<float,2>{0.325563431f, 0.19239825f},
-std::array<float,2>{0.296355695f, 0.574750483f},
-std::array<float,2>{0.689161003f, 0.378573209f},
-std::array<float,2>{0.804176807f, 0.929275036f},
-std::array<float,2>{0.116496317f, 0.0989582017f},
-std::array<float,2>{0.147132516f, 0.763458848f},
-std::array<float,2>{0.993406653f, 0.177735746f},
-std::array<float,2>{0.576456368f, 0.734049737f},
-std::array<float,2>{0.43064779f, 0.349180013f},
-std::array<float,2>{0.485663086f, 0.830744445f},
-std::array<float,2>{0.501947939f, 0.197766542f},
-std::array<float,2>{0.91265893f, 0.672255933f},
-std::array<float,2>{0.211672813f, 0.254376829f},
-std::array<float,2>{0.0490491092f, 0.545874119f},
-std::array<float,2>{0.858745873f, 0.448950946f},
-std::array<float,2>{0.665929377f, 0.971852779f},
-std::array<float,2>{0.348823309f, 0.0578030683f},
-std::array<float,2>{0.265157461f, 0.725150526f},
-std::array<float,2>{0.728509009f, 0.352082103f},
-std::array<float,2>{0.775253475f, 0.756405175f},
-std::array<float,2>{0.0865998641f, 0.180600807f},
-std::array<float,2>{0.185992599f, 0.932274461f},
-std::array<float,2>{0.948005259f, 0.104339719f},
-std::array<float,2>{0.603986681f, 0.566938221f},
-std::array<float,2>{0.381632924f, 0.385520637f},
-std::array<float,2>{0.317738503f, 0.953937232f},
-std::array<float,2>{0.633229852f, 0.0155791715f},
-std::array<float,2>{0.830186963f, 0.529971182f},
-std::array<float,2>{0.0140524302f, 0.472050428f},
-std::array<float,2>{0.223530605f, 0.65310216f},
-std::array<float,2>{0.889989614f, 0.311094701f},
-std::array<float,2>{0.546420157f, 0.856321394f},
-std::array<float,2>{0.440610975f, 0.244575948f},
-std::array<float,2>{0.427925199f, 0.609758615f},
-std::array<float,2>{0.562998712f, 0.428962916f},
-std::array<float,2>{0.985062718f, 0.889469326f},
-std::array<float,2>{0.154654533f, 0.0923320502f},
-std::array<float,2>{0.124463506f, 0.802360296f},
-std::array<float,2>{0.810037017f, 0.145193785f},
-std::array<float,2>{0.701862156f, 0.717888296f},
-std::array<float,2>{0.286426365f, 0.331032693f},
-std::array<float,2>{0.304061592f, 0.765637398f},
-std::array<float,2>{0.718061924f, 0.168540061f},
-std::array<float,2>{0.786136866f, 0.74673593f},
-std::array<float,2>{0.106005415f, 0.363132119f},
-std::array<float,2>{0.126614153f, 0.593155146f},
-std::array<float,2>{0.983712554f, 0.398658484f},
-std::array<float,2>{0.59151721f, 0.906806171f},
-std::array<float,2>{0.410429358f, 0.119958267f},
-std::array<float,2>{0.460206151f, 0.659730017f},
-std::array<float,2>{0.553032637f, 0.268211246f},
-std::array<float,2>{0.898987412f, 0.817274272f},
-std::array<float,2>{0.242266729f, 0.211315915f},
-std::array<float,2>{0.0199743286f, 0.990069807f},
-std::array<float,2>{0.825275123f, 0.0431098081f},
-std::array<float,2>{0.640656054f, 0.558422506f},
-std::array<float,2>{0.338356733f, 0.455570877f},
-std::array<float,2>{0.395828009f, 0.891275227f},
-std::array<float,2>{0.623734772f, 0.0759909675f},
-std::array<float,2>{0.964636981f, 0.606342852f},
-std::array<float,2>{0.157513633f, 0.411737472f},
-std::array<float,2>{0.0693995208f, 0.701793611f},
-std::array<float,2>{0.763148785f, 0.316643834f},
-std::array<float,2>{0.748185754f, 0.785794258f},
-std::array<float,2>{0.279856175f, 0.132796571f},
-std::array<float,2>{0.367726505f, 0.507973492f},
-std::array<float,2>{0.68258661f, 0.49522084f},
-std::array<float,2>{0.871758521f, 0.942952871f},
-std::array<float,2>{0.0458465517f, 0.0209367611f},
-std::array<float,2>{0.194050387f, 0.863344252f},
-std::array<float,2>{0.928185523f, 0.229142323f},
-std::array<float,2>{0.524787247f, 0.626341641f},
-std::array<float,2>{0.483579844f, 0.29344064f},
-std::array<float,2>{0.423804909f, 0.824314177f},
-std::array<float,2>{0.56657064f, 0.209874839f},
-std::array<float,2>{0.991378069f, 0.664655745f},
-std::array<float,2>{0.149548203f, 0.279154092f},
-std::array<float,2>{0.118850097f, 0.552557826f},
-std::array<float,2>{0.806639016f, 0.467967838f},
-std::array<float,2>{0.696538329f, 0.992567778f},
-std::array<float,2>{0.283796132f, 0.0328660272f},
-std::array<float,2>{0.314189762f, 0.741178751f},
-std::array<float,2>{0.637880802f, 0.37378028f},
-std::array<float,2>{0.835584939f, 0.77613312f},
-std::array<float,2>{0.00823593326f, 0.164037064f},
-std::array<float,2>{0.221650198f, 0.916425765f},
-std::array<float,2>{0.883384228f, 0.113207817f},
-std::array<float,2>{0.539912105f, 0.581026316f},
-std::array<float,2>{0.444196612f, 0.397096485f},
-std::array<float,2>{0.261107653f, 0.951215446f},
-std::array<float,2>{0.733538568f, 0.0258203913f},
-std::array<float,2>{0.780318737f, 0.50667274f},
-std::array<float,2>{0.0930427536f, 0.490946501f},
-std::array<float,2>{0.181404293f, 0.640071452f},
-std::array<float,2>{0.949292183f, 0.281808376f},
-std::array<float,2>{0.607560217f, 0.868091762f},
-std::array<float,2>{0.37773487f, 0.225194246f},
-std::array<float,2>{0.489298642f, 0.596473157f},
-std::array<float,2>{0.507626653f, 0.419551075f},
-std::array<float,2>{0.908667803f, 0.898741901f},
-std::array<float,2>{0.216460451f, 0.0632154718f},
-std::array<float,2>{0.0527336001f, 0.791709602f},
-std::array<float,2>{0.85237056f, 0.136321336f},
-std::array<float,2>{0.668735147f, 0.691106498f},
-std::array<float,2>{0.347245336f, 0.320707053f},
-std::array<float,2>{0.371774286f, 0.759105504f},
-std::array<float,2>{0.684216976f, 0.17515716f},
-std::array<float,2>{0.86731261f, 0.726894915f},
-std::array<float,2>{0.0400292799f, 0.347100675f},
-std::array<float,2>{0.189761549f, 0.572828352f},
-std::array<float,2>{0.922669053f, 0.379596323f},
-std::array<float,2>{0.529628575f, 0.923188567f},
-std::array<float,2>{0.477970898f, 0.0968795717f},
-std::array<float,2>{0.393248767f, 0.686493337f},
-std::array<float,2>{0.620525062f, 0.25837332f},
-std::array<float,2>{0.967521906f, 0.837955117f},
-std::array<float,2>{0.163972318f, 0.190299824f},
-std::array<float,2>{0.0639365241f, 0.980696142f},
-std::array<float,2>{0.759680331f, 0.0482412204f},
-std::array<float,2>{0.743148565f, 0.538461268f},
-std::array<float,2>{0.275785536f, 0.438086331f},
-std::array<float,2>{0.455468088f, 0.876775622f},
-std::array<float,2>{0.547042131f, 0.0791949704f},
-std::array<float,2>{0.904308498f, 0.61940825f},
-std::array<float,2>{0.24649246f, 0.43143782f},
-std::array<float,2>{0.0179843493f, 0.708352208f},
-std::array<float,2>{0.822244406f, 0.336013347f},
-std::array<float,2>{0.646979094f, 0.805657208f},
-std::array<float,2>{0.340123087f, 0.149518594f},
-std::array<float,2>{0.299512088f, 0.520962656f},
-std::array<float,2>{0.713368773f, 0.482845306f},
-std::array<float,2>{0.781320572f, 0.96417737f},
-std::array<float,2>{0.105316751f, 0.00773037784f},
-std::array<float,2>{0.129154086f, 0.846604049f},
-std::array<float,2>{0.980275273f, 0.237093464f},
-std::array<float,2>{0.586190164f, 0.645110965f},
-std::array<float,2>{0.406785399f, 0.297395766f},
-std::array<float,2>{0.472018212f, 0.798360229f},
-std::array<float,2>{0.521528125f, 0.143361717f},
-std::array<float,2>{0.936358809f, 0.714828432f},
-std::array<float,2>{0.200173199f, 0.334332407f},
-std::array<float,2>{0.0350981876f, 0.616347373f},
-std::array<float,2>{0.862828493f, 0.422419459f},
-std::array<float,2>{0.672921479f, 0.884250402f},
-std::array<float,2>{0.364282906f, 0.0860977024f},
-std::array<float,2>{0.270137936f, 0.650131345f},
-std::array<float,2>{0.740709901f, 0.307519764f},
-std::array<float,2>{0.756203294f, 0.852238297f},
-std::array<float,2>{0.0745345056f, 0.247197345f},
-std::array<float,2>{0.165090844f, 0.95986712f},
-std::array<float,2>{0.95450139f, 0.0105340006f},
-std::array<float,2>{0.609431565f, 0.527290583f},
-std::array<float,2>{0.401360601f, 0.474294215f},
-std::array<float,2>{0.329347163f, 0.934995353f},
-std::array<float,2>{0.652624965f, 0.105718881f},
-std::array<float,2>{0.815019429f, 0.562531769f},
-std::array<float,2>{0.0270480122f, 0.389276683f},
-std::array<float,2>{0.235965669f, 0.722253621f},
-std::array<float,2>{0.8962152f, 0.359205872f},
-std::array<float,2>{0.555155396f, 0.751655757f},
-std::array<float,2>{0.465303779f, 0.1854067f},
-std::array<float,2>{0.416093498f, 0.540374398f},
-std::array<float,2>{0.581656814f, 0.452189356f},
-std::array<float,2>{0.969161749f, 0.976484239f},
-std::array<float,2>{0.140077457f, 0.0618839711f},
-std::array<float,2>{0.0960148796f, 0.83231312f},
-std::array<float,2>{0.792116821f, 0.200756162f},
-std::array<float,2>{0.708954513f, 0.677160442f},
-std::array<float,2>{0.309047192f, 0.251071423f},
-std::array<float,2>{0.28966549f, 0.860384703f},
-std::array<float,2>{0.694029987f, 0.230987817f},
-std::array<float,2>{0.799845934f, 0.630889058f},
-std::array<float,2>{0.110273845f, 0.29227376f},
-std::array<float,2>{0.143345445f, 0.512009442f},
-std::array<float,2>{0.996772468f, 0.49805066f},
-std::array<float,2>{0.573302567f, 0.940125942f},
-std::array<float,2>{0.435074776f, 0.0157894976f},
-std::array<float,2>{0.448213339f, 0.695974767f},
-std::array<float,2>{0.535925686f, 0.313241422f},
-std::array<float,2>{0.881143808f, 0.782463729f},
-std::array<float,2>{0.227479771f, 0.125102609f},
-std::array<float,2>{0.000939437421f, 0.89796114f},
-std::array<float,2>{0.840144336f, 0.0724379346f},
-std::array<float,2>{0.632361889f, 0.605256259f},
-std::array<float,2>{0.322332472f, 0.409288317f},
-std::array<float,2>{0.383167475f, 0.984912038f},
-std::array<float,2>{0.598345101f, 0.0402359813f},
-std::array<float,2>{0.939927578f, 0.558672845f},
-std::array<float,2>{0.172383472f, 0.458608657f},
-std::array<float,2>{0.0804190487f, 0.660974324f},
-std::array<float,2>{0.767491162f, 0.272453666f},
-std::array<float,2>{0.724770308f, 0.814031124f},
-std::array<float,2>{0.257017374f, 0.215471417f},
-std::array<float,2>{0.354272515f, 0.589432716f},
-std::array<float,2>{0.662653208f, 0.405542284f},
-std::array<float,2>{0.846511006f, 0.913895845f},
-std::array<float,2>{0.0564602204f, 0.121749312f},
-std::array<float,2>{0.205626443f, 0.770393729f},
-std::array<float,2>{0.915755808f, 0.166362494f},
-std::array<float,2>{0.509572566f, 0.744632483f},
-std::array<float,2>{0.492780179f, 0.366280735f},
-std::array<float,2>{0.405980468f, 0.778943777f},
-std::array<float,2>{0.613506973f, 0.157153621f},
-std::array<float,2>{0.958705604f, 0.736665845f},
-std::array<float,2>{0.169676825f, 0.368036032f},
-std::array<float,2>{0.0734835863f, 0.585382998f},
-std::array<float,2>{0.753194451f, 0.392895371f},
-std::array<float,2>{0.734619379f, 0.918498278f},
-std::array<float,2>{0.265755564f, 0.113915555f},
-std::array<float,2>{0.36167562f, 0.669611752f},
-std::array<float,2>{0.676344097f, 0.277254999f},
-std::array<float,2>{0.865169644f, 0.82096678f},
-std::array<float,2>{0.0384238474f, 0.206785306f},
-std::array<float,2>{0.19876416f, 0.996252716f},
-std::array<float,2>{0.931950748f, 0.0374734811f},
-std::array<float,2>{0.516627252f, 0.547351539f},
-std::array<float,2>{0.474995673f, 0.464432478f},
-std::array<float,2>{0.30529967f, 0.902602732f},
-std::array<float,2>{0.705233634f, 0.0672708005f},
-std::array<float,2>{0.795737207f, 0.600812972f},
-std::array<float,2>{0.100361057f, 0.417465895f},
-std::array<float,2>{0.134860262f, 0.694823086f},
-std::array<float,2>{0.975465178f, 0.325906932f},
-std::array<float,2>{0.582380056f, 0.793346584f},
-std::array<float,2>{0.420962065f, 0.13692677f},
-std::array<float,2>{0.462299228f, 0.503693879f},
-std::array<float,2>{0.560991228f, 0.486041844f},
-std::array<float,2>{0.893957734f, 0.945813656f},
-std::array<float,2>{0.242177978f, 0.0293587334f},
-std::array<float,2>{0.030626867f, 0.873350561f},
-std::array<float,2>{0.817261636f, 0.222623512f},
-std::array<float,2>{0.649861872f, 0.633044899f},
-std::array<float,2>{0.332767963f, 0.286857992f},
-std::array<float,2>{0.326959878f, 0.842234373f},
-std::array<float,2>{0.625262737f, 0.19348304f},
-std::array<float,2>{0.838798225f, 0.681680083f},
-std::array<float,2>{0.00729339151f, 0.26185295f},
-std::array<float,2>{0.233273834f, 0.534092844f},
-std::array<float,2>{0.877615809f, 0.443835258f},
-std::array<float,2>{0.534923434f, 0.979539454f},
-std::array<float,2>{0.450421274f, 0.0546697862f},
-std::array<float,2>{0.432572663f, 0.730549097f},
-std::array<float,2>{0.57514292f, 0.350457937f},
-std::array<float,2>{0.99476546f, 0.764297128f},
-std::array<float,2>{0.144738019f, 0.177033827f},
-std::array<float,2>{0.114152871f, 0.926862121f},
-std::array<float,2>{0.801759005f, 0.100080013f},
-std::array<float,2>{0.690189481f, 0.576596975f},
-std::array<float,2>{0.293357134f, 0.375976652f},
-std::array<float,2>{0.496321619f, 0.966626167f},
-std::array<float,2>{0.512036502f, 0.00381708657f},
-std::array<float,2>{0.92016542f, 0.516104937f},
-std::array<float,2>{0.207455084f, 0.478405863f},
-std::array<float,2>{0.0619154423f, 0.643727541f},
-std::array<float,2>{0.847747326f, 0.301975042f},
-std::array<float,2>{0.656853795f, 0.848040402f},
-std::array<float,2>{0.355493069f, 0.238774642f},
-std::array<float,2>{0.253041059f, 0.622274399f},
-std::array<float,2>{0.720412314f, 0.435212135f},
-std::array<float,2>{0.773156703f, 0.88170898f},
-std::array<float,2>{0.0832161829f, 0.083129935f},
-std::array<float,2>{0.17725037f, 0.809876263f},
-std::array<float,2>{0.941451728f, 0.154539704f},
-std::array<float,2>{0.595532417f, 0.703380942f},
-std::array<float,2>{0.387016982f, 0.340691358f},
-std::array<float,2>{0.439113438f, 0.85757941f},
-std::array<float,2>{0.543832362f, 0.243839264f},
-std::array<float,2>{0.886741459f, 0.656211317f},
-std::array<float,2>{0.225569069f, 0.308739394f},
-std::array<float,2>{0.0119907688f, 0.529229641f},
-std::array<float,2>{0.828632176f, 0.469853491f},
-std::array<float,2>{0.635550499f, 0.956044137f},
-std::array<float,2>{0.319265544f, 0.0121656619f},
-std::array<float,2>{0.288840413f, 0.71523875f},
-std::array<float,2>{0.700471759f, 0.32821238f},
-std::array<float,2>{0.812123418f, 0.804047048f},
-std::array<float,2>{0.122171022f, 0.146621227f},
-std::array<float,2>{0.153058395f, 0.887075543f},
-std::array<float,2>{0.987053692f, 0.0906333253f},
-std::array<float,2>{0.565403163f, 0.612420142f},
-std::array<float,2>{0.427049309f, 0.426202863f},
-std::array<float,2>{0.349714011f, 0.969111145f},
-std::array<float,2>{0.666494012f, 0.0554511994f},
-std::array<float,2>{0.857327402f, 0.544358492f},
-std::array<float,2>{0.048037827f, 0.44657737f},
-std::array<float,2>{0.213778049f, 0.675662637f},
-std::array<float,2>{0.910261214f, 0.256864011f},
-std::array<float,2>{0.50353241f, 0.829127312f},
-std::array<float,2>{0.488038093f, 0.196512967f},
-std::array<float,2>{0.379993081f, 0.570219219f},
-std::array<float,2>{0.603135109f, 0.383307517f},
-std::array<float,2>{0.945506334f, 0.929703057f},
-std::array<float,2>{0.184980735f, 0.101928234f},
-std::array<float,2>{0.089577049f, 0.754421353f},
-std::array<float,2>{0.776800573f, 0.1825753f},
-std::array<float,2>{0.729620755f, 0.724348009f},
-std::array<float,2>{0.262916178f, 0.354956567f},
-std::array<float,2>{0.2775428f, 0.787388861f},
-std::array<float,2>{0.74799484f, 0.129109412f},
-std::array<float,2>{0.765153408f, 0.699424267f},
-std::array<float,2>{0.067578651f, 0.319093525f},
-std::array<float,2>{0.160035506f, 0.607596397f},
-std::array<float,2>{0.962509274f, 0.412130564f},
-std::array<float,2>{0.622997522f, 0.892901182f},
-std::array<float,2>{0.39686358f, 0.0768947005f},
-std::array<float,2>{0.480494499f, 0.627587795f},
-std::array<float,2>{0.525887728f, 0.296204984f},
-std::array<float,2>{0.927369595f, 0.867089689f},
-std::array<float,2>{0.191804826f, 0.227992535f},
-std::array<float,2>{0.0434516035f, 0.943893552f},
-std::array<float,2>{0.873166203f, 0.0219417159f},
-std::array<float,2>{0.680279553f, 0.511380553f},
-std::array<float,2>{0.370534748f, 0.492984891f},
-std::array<float,2>{0.413623273f, 0.909745932f},
-std::array<float,2>{0.591871917f, 0.117482617f},
-std::array<float,2>{0.98228246f, 0.590554118f},
-std::array<float,2>{0.12754038f, 0.40222156f},
-std::array<float,2>{0.10936591f, 0.74854207f},
-std::array<float,2>{0.788062811f, 0.359661222f},
-std::array<float,2>{0.716437578f, 0.767733037f},
-std::array<float,2>{0.301213175f, 0.171808943f},
-std::array<float,2>{0.336987197f, 0.555022776f},
-std::array<float,2>{0.643104315f, 0.45377925f},
-std::array<float,2>{0.826611161f, 0.991888821f},
-std::array<float,2>{0.0224857721f, 0.0460524112f},
-std::array<float,2>{0.24531433f, 0.818624735f},
-std::array<float,2>{0.901433647f, 0.213521063f},
-std::array<float,2>{0.551652312f, 0.657415152f},
-std::array<float,2>{0.458275437f, 0.265950203f},
-std::array<float,2>{0.434903204f, 0.862482488f},
-std::array<float,2>{0.573967695f, 0.233684912f},
-std::array<float,2>{0.996415496f, 0.630732f},
-std::array<float,2>{0.142717481f, 0.289439559f},
-std::array<float,2>{0.109754421f, 0.515018702f},
-std::array<float,2>{0.800626457f, 0.496471494f},
-std::array<float,2>{0.693416476f, 0.937712491f},
-std::array<float,2>{0.289190054f, 0.0195184126f},
-std::array<float,2>{0.322761416f, 0.698679745f},
-std::array<float,2>{0.632073045f, 0.315458298f},
-std::array<float,2>{0.84060812f, 0.784510076f},
-std::array<float,2>{4.65709418e-05f, 0.1287435f},
-std::array<float,2>{0.226916984f, 0.895791352f},
-std::array<float,2>{0.881369174f, 0.0713513717f},
-std::array<float,2>{0.535403609f, 0.602194309f},
-std::array<float,2>{0.447490662f, 0.407583922f},
-std::array<float,2>{0.257786691f, 0.986943424f},
-std::array<float,2>{0.725209951f, 0.041861739f},
-std::array<float,2>{0.766702235f, 0.561302602f},
-std::array<float,2>{0.0806553513f, 0.460306048f},
-std::array<float,2>{0.172203094f, 0.663380146f},
-std::array<float,2>{0.940150678f, 0.27030921f},
-std::array<float,2>{0.597935021f, 0.815765083f},
-std::array<float,2>{0.38340044f, 0.218570888f},
-std::array<float,2>{0.492256999f, 0.586623788f},
-std::array<float,2>{0.508927166f, 0.403036356f},
-std::array<float,2>{0.91524905f, 0.911055565f},
-std::array<float,2>{0.2055372f, 0.123408221f},
-std::array<float,2>{0.0560934544f, 0.772442698f},
-std::array<float,2>{0.846017957f, 0.164162204f},
-std::array<float,2>{0.662156224f, 0.74346751f},
-std::array<float,2>{0.353699803f, 0.36362049f},
-std::array<float,2>{0.364990115f, 0.800649583f},
-std::array<float,2>{0.673812807f, 0.140955999f},
-std::array<float,2>{0.862476289f, 0.711374462f},
-std::array<float,2>{0.034324903f, 0.332737058f},
-std::array<float,2>{0.199489772f, 0.613873243f},
-std::array<float,2>{0.935969412f, 0.424955398f},
-std::array<float,2>{0.522133648f, 0.88640362f},
-std::array<float,2>{0.472638041f, 0.0878945887f},
-std::array<float,2>{0.400485426f, 0.652016282f},
-std::array<float,2>{0.610176861f, 0.305594236f},
-std::array<float,2>{0.955020368f, 0.853993118f},
-std::array<float,2>{0.16568248f, 0.248281136f},
-std::array<float,2>{0.0751129016f, 0.958824277f},
-std::array<float,2>{0.756365418f, 0.00792081095f},
-std::array<float,2>{0.740886807f, 0.523506105f},
-std::array<float,2>{0.269681275f, 0.474845976f},
-std::array<float,2>{0.465630591f, 0.936196387f},
-std::array<float,2>{0.555514574f, 0.108374104f},
-std::array<float,2>{0.89577347f, 0.566277802f},
-std::array<float,2>{0.23547855f, 0.386828512f},
-std::array<float,2>{0.0265270341f, 0.720324457f},
-std::array<float,2>{0.814841986f, 0.355782121f},
-std::array<float,2>{0.653213501f, 0.753614187f},
-std::array<float,2>{0.329997569f, 0.185597524f},
-std::array<float,2>{0.309332669f, 0.541105747f},
-std::array<float,2>{0.708294272f, 0.450154006f},
-std::array<float,2>{0.792877555f, 0.973876417f},
-std::array<float,2>{0.0964665711f, 0.0595910661f},
-std::array<float,2>{0.140616432f, 0.835283518f},
-std::array<float,2>{0.969691038f, 0.202306166f},
-std::array<float,2>{0.581239164f, 0.679402351f},
-std::array<float,2>{0.416550815f, 0.252039015f},
-std::array<float,2>{0.478384852f, 0.761442363f},
-std::array<float,2>{0.5301404f, 0.173162133f},
-std::array<float,2>{0.922305286f, 0.729480922f},
-std::array<float,2>{0.190420419f, 0.345162749f},
-std::array<float,2>{0.0392670296f, 0.571051776f},
-std::array<float,2>{0.86780113f, 0.381844848f},
-std::array<float,2>{0.683955967f, 0.925477862f},
-std::array<float,2>{0.371356755f, 0.0952112824f},
-std::array<float,2>{0.276215076f, 0.684867859f},
-std::array<float,2>{0.742409945f, 0.260892898f},
-std::array<float,2>{0.758836985f, 0.836791456f},
-std::array<float,2>{0.0643258318f, 0.188756779f},
-std::array<float,2>{0.163221732f, 0.983656287f},
-std::array<float,2>{0.966870308f, 0.0490773246f},
-std::array<float,2>{0.620764434f, 0.537050068f},
-std::array<float,2>{0.392642051f, 0.440360695f},
-std::array<float,2>{0.340680033f, 0.878702223f},
-std::array<float,2>{0.646525383f, 0.0802309811f},
-std::array<float,2>{0.821358383f, 0.617300391f},
-std::array<float,2>{0.0184756164f, 0.433312416f},
-std::array<float,2>{0.246941254f, 0.710795283f},
-std::array<float,2>{0.904820502f, 0.337997139f},
-std::array<float,2>{0.547604799f, 0.80761838f},
-std::array<float,2>{0.455736279f, 0.150822461f},
-std::array<float,2>{0.406563699f, 0.521500289f},
-std::array<float,2>{0.586585462f, 0.481292635f},
-std::array<float,2>{0.979724407f, 0.961321056f},
-std::array<float,2>{0.129775017f, 0.00445871288f},
-std::array<float,2>{0.104603641f, 0.845463276f},
-std::array<float,2>{0.781998336f, 0.235194445f},
-std::array<float,2>{0.713516831f, 0.647575259f},
-std::array<float,2>{0.298875421f, 0.299384803f},
-std::array<float,2>{0.283458441f, 0.827389836f},
-std::array<float,2>{0.697049499f, 0.208507583f},
-std::array<float,2>{0.805731833f, 0.666116297f},
-std::array<float,2>{0.118210115f, 0.280197918f},
-std::array<float,2>{0.150174856f, 0.553698361f},
-std::array<float,2>{0.991982698f, 0.466616929f},
-std::array<float,2>{0.566910565f, 0.99537915f},
-std::array<float,2>{0.423035085f, 0.0347298533f},
-std::array<float,2>{0.443731517f, 0.738612175f},
-std::array<float,2>{0.539203703f, 0.372246653f},
-std::array<float,2>{0.882880569f, 0.773726404f},
-std::array<float,2>{0.220884457f, 0.160873801f},
-std::array<float,2>{0.00837633666f, 0.915375829f},
-std::array<float,2>{0.835214376f, 0.110709623f},
-std::array<float,2>{0.638447762f, 0.578561425f},
-std::array<float,2>{0.313905209f, 0.395380557f},
-std::array<float,2>{0.377083659f, 0.950912893f},
-std::array<float,2>{0.608244956f, 0.0246934425f},
-std::array<float,2>{0.950082898f, 0.505780995f},
-std::array<float,2>{0.180998564f, 0.488942266f},
-std::array<float,2>{0.0936926752f, 0.637114644f},
-std::array<float,2>{0.780918837f, 0.284603655f},
-std::array<float,2>{0.733985603f, 0.870696902f},
-std::array<float,2>{0.261245191f, 0.224024624f},
-std::array<float,2>{0.347075015f, 0.59436363f},
-std::array<float,2>{0.668431163f, 0.421314955f},
-std::array<float,2>{0.851842105f, 0.9008407f},
-std::array<float,2>{0.0519385561f, 0.0648909062f},
-std::array<float,2>{0.216168627f, 0.79064554f},
-std::array<float,2>{0.9091416f, 0.133375317f},
-std::array<float,2>{0.506891549f, 0.689225793f},
-std::array<float,2>{0.489974171f, 0.323346943f},
-std::array<float,2>{0.397284597f, 0.785383761f},
-std::array<float,2>{0.622351646f, 0.13201949f},
-std::array<float,2>{0.962081611f, 0.701234519f},
-std::array<float,2>{0.159544215f, 0.316923231f},
-std::array<float,2>{0.0681659579f, 0.605509937f},
-std::array<float,2>{0.764656663f, 0.411351711f},
-std::array<float,2>{0.747206032f, 0.890885413f},
-std::array<float,2>{0.278244883f, 0.0754690692f},
-std::array<float,2>{0.370920837f, 0.626655936f},
-std::array<float,2>{0.679987133f, 0.293934256f},
-std::array<float,2>{0.873564065f, 0.864048123f},
-std::array<float,2>{0.043666359f, 0.228735551f},
-std::array<float,2>{0.191922724f, 0.942487061f},
-std::array<float,2>{0.926946223f, 0.0213090051f},
-std::array<float,2>{0.525584757f, 0.508771181f},
-std::array<float,2>{0.481023401f, 0.495700896f},
-std::array<float,2>{0.301342815f, 0.906346977f},
-std::array<float,2>{0.716154277f, 0.119549274f},
-std::array<float,2>{0.787149191f, 0.593749881f},
-std::array<float,2>{0.108719423f, 0.39915356f},
-std::array<float,2>{0.127359524f, 0.746482015f},
-std::array<float,2>{0.981682241f, 0.362523198f},
-std::array<float,2>{0.592318118f, 0.766179681f},
-std::array<float,2>{0.413393795f, 0.168233439f},
-std::array<float,2>{0.458846271f, 0.557714462f},
-std::array<float,2>{0.550984085f, 0.455233365f},
-std::array<float,2>{0.901932955f, 0.989303648f},
-std::array<float,2>{0.245985493f, 0.0437498912f},
-std::array<float,2>{0.0234236624f, 0.816509187f},
-std::array<float,2>{0.827013791f, 0.211566776f},
-std::array<float,2>{0.642980158f, 0.65956825f},
-std::array<float,2>{0.337807536f, 0.267911166f},
-std::array<float,2>{0.318725318f, 0.855534554f},
-std::array<float,2>{0.634845614f, 0.244716182f},
-std::array<float,2>{0.828153968f, 0.652640224f},
-std::array<float,2>{0.0123262014f, 0.310793668f},
-std::array<float,2>{0.224923268f, 0.529489696f},
-std::array<float,2>{0.887235463f, 0.472413719f},
-std::array<float,2>{0.543381095f, 0.953283012f},
-std::array<float,2>{0.438571036f, 0.0147293713f},
-std::array<float,2>{0.427470654f, 0.718530238f},
-std::array<float,2>{0.564531565f, 0.330478102f},
-std::array<float,2>{0.986380517f, 0.802087069f},
-std::array<float,2>{0.152489051f, 0.144984841f},
-std::array<float,2>{0.122734696f, 0.888882279f},
-std::array<float,2>{0.811899781f, 0.0918048918f},
-std::array<float,2>{0.701112092f, 0.610049069f},
-std::array<float,2>{0.288396269f, 0.429445505f},
-std::array<float,2>{0.487331212f, 0.972392797f},
-std::array<float,2>{0.503135085f, 0.0581240878f},
-std::array<float,2>{0.910828829f, 0.544991314f},
-std::array<float,2>{0.213244349f, 0.448333502f},
-std::array<float,2>{0.0486672632f, 0.672374964f},
-std::array<float,2>{0.856888592f, 0.254505575f},
-std::array<float,2>{0.66651994f, 0.830432832f},
-std::array<float,2>{0.350245386f, 0.197426066f},
-std::array<float,2>{0.263376117f, 0.566771269f},
-std::array<float,2>{0.73037076f, 0.384765983f},
-std::array<float,2>{0.777144015f, 0.931872904f},
-std::array<float,2>{0.0891217738f, 0.103843138f},
-std::array<float,2>{0.185131267f, 0.75594002f},
-std::array<float,2>{0.945833206f, 0.179734811f},
-std::array<float,2>{0.602926314f, 0.724816918f},
-std::array<float,2>{0.380484581f, 0.351599455f},
-std::array<float,2>{0.450910926f, 0.841092348f},
-std::array<float,2>{0.534508228f, 0.193352342f},
-std::array<float,2>{0.877335906f, 0.681238472f},
-std::array<float,2>{0.232800037f, 0.265502572f},
-std::array<float,2>{0.00745793339f, 0.53131932f},
-std::array<float,2>{0.838280201f, 0.442857057f},
-std::array<float,2>{0.625822783f, 0.977896512f},
-std::array<float,2>{0.326573581f, 0.051983051f},
-std::array<float,2>{0.293880433f, 0.733472645f},
-std::array<float,2>{0.689764857f, 0.348854274f},
-std::array<float,2>{0.802473009f, 0.763165772f},
-std::array<float,2>{0.113494866f, 0.178462565f},
-std::array<float,2>{0.14524889f, 0.929112613f},
-std::array<float,2>{0.994346678f, 0.0991394594f},
-std::array<float,2>{0.574266911f, 0.574607432f},
-std::array<float,2>{0.431859761f, 0.378212899f},
-std::array<float,2>{0.356127799f, 0.967989624f},
-std::array<float,2>{0.656417668f, 0.000169046209f},
-std::array<float,2>{0.848543763f, 0.51909095f},
-std::array<float,2>{0.0624896511f, 0.479787081f},
-std::array<float,2>{0.207629532f, 0.640856743f},
-std::array<float,2>{0.920443773f, 0.303278595f},
-std::array<float,2>{0.512306631f, 0.85144496f},
-std::array<float,2>{0.496977895f, 0.240342915f},
-std::array<float,2>{0.387299329f, 0.624000609f},
-std::array<float,2>{0.595087707f, 0.436943322f},
-std::array<float,2>{0.942375362f, 0.880673945f},
-std::array<float,2>{0.177082747f, 0.0845698863f},
-std::array<float,2>{0.0836105421f, 0.810658038f},
-std::array<float,2>{0.772755265f, 0.153324381f},
-std::array<float,2>{0.720098019f, 0.705728769f},
-std::array<float,2>{0.25350818f, 0.342103004f},
-std::array<float,2>{0.266317129f, 0.780126452f},
-std::array<float,2>{0.735224724f, 0.159121901f},
-std::array<float,2>{0.753603816f, 0.735865712f},
-std::array<float,2>{0.0738992169f, 0.369481087f},
-std::array<float,2>{0.169118911f, 0.582532465f},
-std::array<float,2>{0.958129227f, 0.390887141f},
-std::array<float,2>{0.614050388f, 0.921428859f},
-std::array<float,2>{0.405298352f, 0.11658553f},
-std::array<float,2>{0.475472569f, 0.670599759f},
-std::array<float,2>{0.517257631f, 0.274051517f},
-std::array<float,2>{0.932240844f, 0.822862327f},
-std::array<float,2>{0.198268279f, 0.203748494f},
-std::array<float,2>{0.038582202f, 0.999626875f},
-std::array<float,2>{0.864306867f, 0.0366216116f},
-std::array<float,2>{0.67597419f, 0.5505597f},
-std::array<float,2>{0.362200797f, 0.462084442f},
-std::array<float,2>{0.421696544f, 0.905002773f},
-std::array<float,2>{0.582973599f, 0.0688713118f},
-std::array<float,2>{0.974710345f, 0.597954929f},
-std::array<float,2>{0.135652259f, 0.414920866f},
-std::array<float,2>{0.0997019783f, 0.692708552f},
-std::array<float,2>{0.795091927f, 0.326726049f},
-std::array<float,2>{0.706018984f, 0.795464516f},
-std::array<float,2>{0.304807216f, 0.13961038f},
-std::array<float,2>{0.332154453f, 0.501135886f},
-std::array<float,2>{0.650370955f, 0.487110287f},
-std::array<float,2>{0.816813648f, 0.949175775f},
-std::array<float,2>{0.03107691f, 0.0277459398f},
-std::array<float,2>{0.241650641f, 0.872740507f},
-std::array<float,2>{0.894360185f, 0.220289931f},
-std::array<float,2>{0.561074138f, 0.635004699f},
-std::array<float,2>{0.462684393f, 0.287791789f},
-std::array<float,2>{0.385166287f, 0.813661218f},
-std::array<float,2>{0.600306213f, 0.215120539f},
-std::array<float,2>{0.939129293f, 0.660352647f},
-std::array<float,2>{0.174964458f, 0.271774918f},
-std::array<float,2>{0.079677701f, 0.559326053f},
-std::array<float,2>{0.769017518f, 0.458432287f},
-std::array<float,2>{0.722729623f, 0.98462224f},
-std::array<float,2>{0.25498423f, 0.0408877321f},
-std::array<float,2>{0.352071375f, 0.744479418f},
-std::array<float,2>{0.662030637f, 0.367133349f},
-std::array<float,2>{0.844870985f, 0.769865394f},
-std::array<float,2>{0.0572891496f, 0.166793898f},
-std::array<float,2>{0.204388052f, 0.913372159f},
-std::array<float,2>{0.916046441f, 0.121429063f},
-std::array<float,2>{0.511031687f, 0.58927083f},
-std::array<float,2>{0.495406181f, 0.406005323f},
-std::array<float,2>{0.292727143f, 0.939823389f},
-std::array<float,2>{0.693194687f, 0.0164075848f},
-std::array<float,2>{0.79840076f, 0.512606204f},
-std::array<float,2>{0.112871788f, 0.498751044f},
-std::array<float,2>{0.14214921f, 0.631417274f},
-std::array<float,2>{0.998314798f, 0.292859733f},
-std::array<float,2>{0.5704633f, 0.860888839f},
-std::array<float,2>{0.436018497f, 0.230488658f},
-std::array<float,2>{0.446371257f, 0.604897738f},
-std::array<float,2>{0.537562013f, 0.40984571f},
-std::array<float,2>{0.879062057f, 0.897481501f},
-std::array<float,2>{0.229595885f, 0.0731116459f},
-std::array<float,2>{0.00245260284f, 0.783008277f},
-std::array<float,2>{0.842989862f, 0.125803888f},
-std::array<float,2>{0.629507005f, 0.695364654f},
-std::array<float,2>{0.321254075f, 0.312594324f},
-std::array<float,2>{0.331091166f, 0.751369536f},
-std::array<float,2>{0.655984044f, 0.184755132f},
-std::array<float,2>{0.814400792f, 0.72180897f},
-std::array<float,2>{0.0243893676f, 0.358800471f},
-std::array<float,2>{0.236776382f, 0.56331706f},
-std::array<float,2>{0.896623313f, 0.389131755f},
-std::array<float,2>{0.558391333f, 0.935212851f},
-std::array<float,2>{0.467212021f, 0.10599412f},
-std::array<float,2>{0.414168358f, 0.677278101f},
-std::array<float,2>{0.578388512f, 0.251892835f},
-std::array<float,2>{0.971913517f, 0.832913697f},
-std::array<float,2>{0.136899918f, 0.200246662f},
-std::array<float,2>{0.0937905014f, 0.975885987f},
-std::array<float,2>{0.790141106f, 0.0620838478f},
-std::array<float,2>{0.70999068f, 0.540707171f},
-std::array<float,2>{0.310608923f, 0.452982157f},
-std::array<float,2>{0.468859166f, 0.884758294f},
-std::array<float,2>{0.51960206f, 0.086885348f},
-std::array<float,2>{0.935413539f, 0.616894484f},
-std::array<float,2>{0.202210218f, 0.422077745f},
-std::array<float,2>{0.032065697f, 0.714248776f},
-std::array<float,2>{0.859482646f, 0.334664404f},
-std::array<float,2>{0.674031436f, 0.797872245f},
-std::array<float,2>{0.366434783f, 0.142699197f},
-std::array<float,2>{0.272196025f, 0.526818514f},
-std::array<float,2>{0.738382101f, 0.473998755f},
-std::array<float,2>{0.755304039f, 0.95909673f},
-std::array<float,2>{0.0777859911f, 0.00993445795f},
-std::array<float,2>{0.16759029f, 0.851597369f},
-std::array<float,2>{0.956695497f, 0.247885227f},
-std::array<float,2>{0.612324059f, 0.649445653f},
-std::array<float,2>{0.400300711f, 0.306858748f},
-std::array<float,2>{0.453623444f, 0.804728508f},
-std::array<float,2>{0.550431013f, 0.149986789f},
-std::array<float,2>{0.90401727f, 0.708501101f},
-std::array<float,2>{0.248431414f, 0.336491674f},
-std::array<float,2>{0.01642498f, 0.620072603f},
-std::array<float,2>{0.82277447f, 0.430844337f},
-std::array<float,2>{0.645206213f, 0.876282573f},
-std::array<float,2>{0.343141258f, 0.0798662975f},
-std::array<float,2>{0.29854086f, 0.644632101f},
-std::array<float,2>{0.711424947f, 0.296933413f},
-std::array<float,2>{0.784605205f, 0.845829725f},
-std::array<float,2>{0.102162659f, 0.236539587f},
-std::array<float,2>{0.132231459f, 0.964532137f},
-std::array<float,2>{0.977120757f, 0.00727838976f},
-std::array<float,2>{0.588061273f, 0.521141052f},
-std::array<float,2>{0.408523083f, 0.483073652f},
-std::array<float,2>{0.373397648f, 0.923512638f},
-std::array<float,2>{0.686956823f, 0.0974674523f},
-std::array<float,2>{0.870212197f, 0.572742581f},
-std::array<float,2>{0.0429662094f, 0.379040718f},
-std::array<float,2>{0.188591883f, 0.727199793f},
-std::array<float,2>{0.925655603f, 0.347195536f},
-std::array<float,2>{0.527805388f, 0.759284914f},
-std::array<float,2>{0.480457872f, 0.175316706f},
-std::array<float,2>{0.390738815f, 0.538699269f},
-std::array<float,2>{0.617688298f, 0.437649578f},
-std::array<float,2>{0.964885652f, 0.981116116f},
-std::array<float,2>{0.16208005f, 0.0488024466f},
-std::array<float,2>{0.0661819279f, 0.838831186f},
-std::array<float,2>{0.760979593f, 0.189595729f},
-std::array<float,2>{0.745612323f, 0.685707629f},
-std::array<float,2>{0.274605453f, 0.257938743f},
-std::array<float,2>{0.258820266f, 0.867325425f},
-std::array<float,2>{0.731953621f, 0.224690929f},
-std::array<float,2>{0.77840817f, 0.640551269f},
-std::array<float,2>{0.0906326622f, 0.281464934f},
-std::array<float,2>{0.18335703f, 0.505947173f},
-std::array<float,2>{0.951572895f, 0.490628242f},
-std::array<float,2>{0.606576562f, 0.951866448f},
-std::array<float,2>{0.376937419f, 0.0260633379f},
-std::array<float,2>{0.491232127f, 0.690645516f},
-std::array<float,2>{0.50507313f, 0.320843965f},
-std::array<float,2>{0.907351851f, 0.791077197f},
-std::array<float,2>{0.21825774f, 0.135973021f},
-std::array<float,2>{0.0537401475f, 0.899170995f},
-std::array<float,2>{0.854211152f, 0.0628786907f},
-std::array<float,2>{0.670770288f, 0.596064389f},
-std::array<float,2>{0.343888938f, 0.419398218f},
-std::array<float,2>{0.424379975f, 0.993010879f},
-std::array<float,2>{0.569305658f, 0.0325559527f},
-std::array<float,2>{0.989095688f, 0.552240252f},
-std::array<float,2>{0.15123105f, 0.468719184f},
-std::array<float,2>{0.120799452f, 0.664149106f},
-std::array<float,2>{0.806911588f, 0.278638482f},
-std::array<float,2>{0.6985237f, 0.825019121f},
-std::array<float,2>{0.283064425f, 0.209319457f},
-std::array<float,2>{0.315728635f, 0.58047235f},
-std::array<float,2>{0.638733566f, 0.396694273f},
-std::array<float,2>{0.832118392f, 0.916514874f},
-std::array<float,2>{0.010717757f, 0.112589367f},
-std::array<float,2>{0.219363108f, 0.775865614f},
-std::array<float,2>{0.886201084f, 0.163502589f},
-std::array<float,2>{0.542461336f, 0.740642726f},
-std::array<float,2>{0.443012416f, 0.373316258f},
-std::array<float,2>{0.410952538f, 0.768401384f},
-std::array<float,2>{0.590873539f, 0.171018869f},
-std::array<float,2>{0.984011173f, 0.7483055f},
-std::array<float,2>{0.126204133f, 0.359954745f},
-std::array<float,2>{0.10580641f, 0.590038896f},
-std::array<float,2>{0.787058711f, 0.401489705f},
-std::array<float,2>{0.718747973f, 0.909661055f},
-std::array<float,2>{0.304518372f, 0.117764205f},
-std::array<float,2>{0.338632315f, 0.657897711f},
-std::array<float,2>{0.641450167f, 0.266585529f},
-std::array<float,2>{0.825757146f, 0.819252729f},
-std::array<float,2>{0.0204297341f, 0.213188037f},
-std::array<float,2>{0.242976218f, 0.991266072f},
-std::array<float,2>{0.898566008f, 0.0467512086f},
-std::array<float,2>{0.55360353f, 0.555582345f},
-std::array<float,2>{0.460808277f, 0.453307241f},
-std::array<float,2>{0.279417098f, 0.893297851f},
-std::array<float,2>{0.748588741f, 0.0764652416f},
-std::array<float,2>{0.763385236f, 0.608303905f},
-std::array<float,2>{0.0702528507f, 0.412805021f},
-std::array<float,2>{0.157828271f, 0.700048864f},
-std::array<float,2>{0.964182615f, 0.318501115f},
-std::array<float,2>{0.623446286f, 0.787798285f},
-std::array<float,2>{0.396165967f, 0.129402325f},
-std::array<float,2>{0.484100878f, 0.511129022f},
-std::array<float,2>{0.525052607f, 0.492656559f},
-std::array<float,2>{0.928357363f, 0.943841815f},
-std::array<float,2>{0.193477303f, 0.0219933689f},
-std::array<float,2>{0.0450383276f, 0.866586089f},
-std::array<float,2>{0.87151593f, 0.228136092f},
-std::array<float,2>{0.682058394f, 0.627296865f},
-std::array<float,2>{0.367582768f, 0.296498388f},
-std::array<float,2>{0.349575579f, 0.829743266f},
-std::array<float,2>{0.665132165f, 0.197063819f},
-std::array<float,2>{0.85900569f, 0.675135911f},
-std::array<float,2>{0.0498030186f, 0.257644415f},
-std::array<float,2>{0.211161941f, 0.544490337f},
-std::array<float,2>{0.912474513f, 0.447012991f},
-std::array<float,2>{0.501008213f, 0.969461381f},
-std::array<float,2>{0.486297101f, 0.0549251214f},
-std::array<float,2>{0.381224632f, 0.723808646f},
-std::array<float,2>{0.604375184f, 0.355233878f},
-std::array<float,2>{0.947720528f, 0.75430572f},
-std::array<float,2>{0.186226368f, 0.18189612f},
-std::array<float,2>{0.0861159861f, 0.930523217f},
-std::array<float,2>{0.774699926f, 0.102315895f},
-std::array<float,2>{0.728013277f, 0.5697335f},
-std::array<float,2>{0.264903784f, 0.382885486f},
-std::array<float,2>{0.441009641f, 0.955379725f},
-std::array<float,2>{0.546068072f, 0.0124696046f},
-std::array<float,2>{0.890602112f, 0.5287323f},
-std::array<float,2>{0.222961128f, 0.470361143f},
-std::array<float,2>{0.0145290224f, 0.65566802f},
-std::array<float,2>{0.830931067f, 0.309309036f},
-std::array<float,2>{0.633654118f, 0.85823518f},
-std::array<float,2>{0.317947984f, 0.243339419f},
-std::array<float,2>{0.286827087f, 0.613219738f},
-std::array<float,2>{0.701650023f, 0.426751941f},
-std::array<float,2>{0.810505509f, 0.887312233f},
-std::array<float,2>{0.124618322f, 0.0898522958f},
-std::array<float,2>{0.155143172f, 0.8043136f},
-std::array<float,2>{0.984452009f, 0.147360146f},
-std::array<float,2>{0.562974393f, 0.715665519f},
-std::array<float,2>{0.428588927f, 0.328701377f},
-std::array<float,2>{0.498728901f, 0.848170817f},
-std::array<float,2>{0.514950335f, 0.238640308f},
-std::array<float,2>{0.918747544f, 0.644062042f},
-std::array<float,2>{0.209675908f, 0.302565873f},
-std::array<float,2>{0.0596758984f, 0.516128182f},
-std::array<float,2>{0.849956691f, 0.477876335f},
-std::array<float,2>{0.660117924f, 0.965857685f},
-std::array<float,2>{0.358293086f, 0.00307745743f},
-std::array<float,2>{0.250031769f, 0.70396167f},
-std::array<float,2>{0.721049547f, 0.340115905f},
-std::array<float,2>{0.770854592f, 0.810065389f},
-std::array<float,2>{0.0845821649f, 0.155269429f},
-std::array<float,2>{0.178486004f, 0.880942345f},
-std::array<float,2>{0.944434643f, 0.0834986046f},
-std::array<float,2>{0.597481251f, 0.622595251f},
-std::array<float,2>{0.390011489f, 0.434954703f},
-std::array<float,2>{0.325695664f, 0.98043859f},
-std::array<float,2>{0.627988279f, 0.0540323891f},
-std::array<float,2>{0.837070644f, 0.533410728f},
-std::array<float,2>{0.00416932767f, 0.444033563f},
-std::array<float,2>{0.230611533f, 0.68244499f},
-std::array<float,2>{0.875272274f, 0.262377739f},
-std::array<float,2>{0.532279253f, 0.842511892f},
-std::array<float,2>{0.451361597f, 0.193874225f},
-std::array<float,2>{0.430104673f, 0.576975822f},
-std::array<float,2>{0.577055097f, 0.376625657f},
-std::array<float,2>{0.993995428f, 0.927345872f},
-std::array<float,2>{0.146493554f, 0.100277506f},
-std::array<float,2>{0.117137991f, 0.763813019f},
-std::array<float,2>{0.804620028f, 0.177466363f},
-std::array<float,2>{0.688520432f, 0.731415629f},
-std::array<float,2>{0.296508819f, 0.350015998f},
-std::array<float,2>{0.307262689f, 0.793879151f},
-std::array<float,2>{0.704521954f, 0.137487531f},
-std::array<float,2>{0.794797719f, 0.695219755f},
-std::array<float,2>{0.0987502113f, 0.32534349f},
-std::array<float,2>{0.134065747f, 0.601180017f},
-std::array<float,2>{0.97390908f, 0.417953908f},
-std::array<float,2>{0.584391415f, 0.903011382f},
-std::array<float,2>{0.418707132f, 0.0666323826f},
-std::array<float,2>{0.464107096f, 0.633359492f},
-std::array<float,2>{0.560079336f, 0.286135703f},
-std::array<float,2>{0.891550004f, 0.87378186f},
-std::array<float,2>{0.23939772f, 0.221949905f},
-std::array<float,2>{0.0292278156f, 0.945623279f},
-std::array<float,2>{0.819418132f, 0.0298630241f},
-std::array<float,2>{0.65211302f, 0.503237128f},
-std::array<float,2>{0.334234506f, 0.485687405f},
-std::array<float,2>{0.402351588f, 0.918415904f},
-std::array<float,2>{0.617109716f, 0.11345385f},
-std::array<float,2>{0.960117519f, 0.585812807f},
-std::array<float,2>{0.170922056f, 0.393364429f},
-std::array<float,2>{0.0707706213f, 0.737270832f},
-std::array<float,2>{0.751389563f, 0.367467761f},
-std::array<float,2>{0.738068342f, 0.77865082f},
-std::array<float,2>{0.269298732f, 0.156592742f},
-std::array<float,2>{0.360130519f, 0.547446966f},
-std::array<float,2>{0.678911984f, 0.46421814f},
-std::array<float,2>{0.865611196f, 0.996984363f},
-std::array<float,2>{0.0368964076f, 0.0378252566f},
-std::array<float,2>{0.196368814f, 0.820683241f},
-std::array<float,2>{0.930782318f, 0.206229985f},
-std::array<float,2>{0.51775825f, 0.669364512f},
-std::array<float,2>{0.47455129f, 0.276589364f},
-std::array<float,2>{0.398948282f, 0.855033755f},
-std::array<float,2>{0.611934781f, 0.249025166f},
-std::array<float,2>{0.955199063f, 0.650580585f},
-std::array<float,2>{0.166662425f, 0.305927694f},
-std::array<float,2>{0.0770287588f, 0.525291145f},
-std::array<float,2>{0.754369318f, 0.476544231f},
-std::array<float,2>{0.739915609f, 0.95723331f},
-std::array<float,2>{0.273107976f, 0.00892534014f},
-std::array<float,2>{0.365698129f, 0.712466598f},
-std::array<float,2>{0.674975574f, 0.333983272f},
-std::array<float,2>{0.860525012f, 0.799517572f},
-std::array<float,2>{0.0323596746f, 0.141856179f},
-std::array<float,2>{0.201911986f, 0.884906828f},
-std::array<float,2>{0.934107304f, 0.0897863209f},
-std::array<float,2>{0.521068633f, 0.614954174f},
-std::array<float,2>{0.469775915f, 0.42411238f},
-std::array<float,2>{0.312205225f, 0.973005772f},
-std::array<float,2>{0.709163547f, 0.0590748787f},
-std::array<float,2>{0.789875269f, 0.542158306f},
-std::array<float,2>{0.0948834866f, 0.451120675f},
-std::array<float,2>{0.138196945f, 0.677782834f},
-std::array<float,2>{0.970748782f, 0.253476232f},
-std::array<float,2>{0.579330623f, 0.834783316f},
-std::array<float,2>{0.415571928f, 0.202012554f},
-std::array<float,2>{0.467798531f, 0.564701259f},
-std::array<float,2>{0.556988537f, 0.387736738f},
-std::array<float,2>{0.897583365f, 0.937430024f},
-std::array<float,2>{0.2374219f, 0.10907083f},
-std::array<float,2>{0.0251401775f, 0.752659261f},
-std::array<float,2>{0.812536776f, 0.186527371f},
-std::array<float,2>{0.654566288f, 0.719652474f},
-std::array<float,2>{0.330572009f, 0.357119799f},
-std::array<float,2>{0.321822822f, 0.783744216f},
-std::array<float,2>{0.629950404f, 0.12748605f},
-std::array<float,2>{0.842705131f, 0.697947264f},
-std::array<float,2>{0.00317999674f, 0.314698637f},
-std::array<float,2>{0.229391798f, 0.602913082f},
-std::array<float,2>{0.880471647f, 0.40661037f},
-std::array<float,2>{0.53897351f, 0.894581854f},
-std::array<float,2>{0.44600752f, 0.070961453f},
-std::array<float,2>{0.437035769f, 0.629324079f},
-std::array<float,2>{0.571874022f, 0.290103137f},
-std::array<float,2>{0.999075472f, 0.861589611f},
-std::array<float,2>{0.140857831f, 0.233087167f},
-std::array<float,2>{0.111783579f, 0.938701749f},
-std::array<float,2>{0.796927869f, 0.0178311877f},
-std::array<float,2>{0.691585481f, 0.513702512f},
-std::array<float,2>{0.29170537f, 0.497902811f},
-std::array<float,2>{0.494573742f, 0.91179651f},
-std::array<float,2>{0.510733485f, 0.124448173f},
-std::array<float,2>{0.917477965f, 0.587459505f},
-std::array<float,2>{0.203476712f, 0.403808117f},
-std::array<float,2>{0.0581548922f, 0.742411077f},
-std::array<float,2>{0.844007075f, 0.36434117f},
-std::array<float,2>{0.661031842f, 0.772674263f},
-std::array<float,2>{0.352850527f, 0.16570577f},
-std::array<float,2>{0.25469923f, 0.56161654f},
-std::array<float,2>{0.724502444f, 0.459131628f},
-std::array<float,2>{0.768128514f, 0.987408936f},
-std::array<float,2>{0.0786182508f, 0.042538695f},
-std::array<float,2>{0.174400732f, 0.81499958f},
-std::array<float,2>{0.937602043f, 0.216939852f},
-std::array<float,2>{0.601357698f, 0.662430525f},
-std::array<float,2>{0.386427879f, 0.270546675f},
-std::array<float,2>{0.44221431f, 0.774848342f},
-std::array<float,2>{0.541956425f, 0.161365375f},
-std::array<float,2>{0.885713816f, 0.739838183f},
-std::array<float,2>{0.220216021f, 0.371566772f},
-std::array<float,2>{0.0113577163f, 0.579187453f},
-std::array<float,2>{0.833759665f, 0.39633128f},
-std::array<float,2>{0.640606403f, 0.91484046f},
-std::array<float,2>{0.314939737f, 0.109675363f},
-std::array<float,2>{0.282116055f, 0.667621076f},
-std::array<float,2>{0.698000491f, 0.280542552f},
-std::array<float,2>{0.807942271f, 0.826490819f},
-std::array<float,2>{0.119642474f, 0.207425669f},
-std::array<float,2>{0.152249902f, 0.994685411f},
-std::array<float,2>{0.989306688f, 0.0334448777f},
-std::array<float,2>{0.569723189f, 0.55379194f},
-std::array<float,2>{0.425632894f, 0.465749502f},
-std::array<float,2>{0.345451683f, 0.901646316f},
-std::array<float,2>{0.671708703f, 0.066326119f},
-std::array<float,2>{0.855012715f, 0.594924629f},
-std::array<float,2>{0.0535083003f, 0.420423329f},
-std::array<float,2>{0.217717737f, 0.688036799f},
-std::array<float,2>{0.90665108f, 0.322370887f},
-std::array<float,2>{0.504778624f, 0.789231896f},
-std::array<float,2>{0.490353525f, 0.134091228f},
-std::array<float,2>{0.375040025f, 0.504584014f},
-std::array<float,2>{0.605990469f, 0.489888459f},
-std::array<float,2>{0.952682555f, 0.949933827f},
-std::array<float,2>{0.181979612f, 0.0243427493f},
-std::array<float,2>{0.0909060687f, 0.869813085f},
-std::array<float,2>{0.777542949f, 0.223359317f},
-std::array<float,2>{0.73104763f, 0.63838762f},
-std::array<float,2>{0.258128017f, 0.283724785f},
-std::array<float,2>{0.274096072f, 0.837011337f},
-std::array<float,2>{0.744173467f, 0.187527746f},
-std::array<float,2>{0.760019183f, 0.68401885f},
-std::array<float,2>{0.0649147555f, 0.260560542f},
-std::array<float,2>{0.160218582f, 0.535777509f},
-std::array<float,2>{0.966464043f, 0.440680504f},
-std::array<float,2>{0.61910969f, 0.982960284f},
-std::array<float,2>{0.39188236f, 0.050488852f},
-std::array<float,2>{0.478875816f, 0.729738832f},
-std::array<float,2>{0.52879113f, 0.344057858f},
-std::array<float,2>{0.923885405f, 0.760333717f},
-std::array<float,2>{0.187802628f, 0.172606781f},
-std::array<float,2>{0.0410389006f, 0.924528897f},
-std::array<float,2>{0.869750798f, 0.0940210298f},
-std::array<float,2>{0.685667694f, 0.57139653f},
-std::array<float,2>{0.374745488f, 0.381558597f},
-std::array<float,2>{0.410062134f, 0.962168872f},
-std::array<float,2>{0.589743555f, 0.00572682824f},
-std::array<float,2>{0.977992535f, 0.523436487f},
-std::array<float,2>{0.131500259f, 0.481979489f},
-std::array<float,2>{0.103148252f, 0.647278666f},
-std::array<float,2>{0.783618033f, 0.299844533f},
-std::array<float,2>{0.712582707f, 0.843854547f},
-std::array<float,2>{0.296922088f, 0.236224279f},
-std::array<float,2>{0.342378229f, 0.618726552f},
-std::array<float,2>{0.645941436f, 0.432489932f},
-std::array<float,2>{0.823313594f, 0.877453864f},
-std::array<float,2>{0.0173686706f, 0.0818014145f},
-std::array<float,2>{0.249624446f, 0.806668818f},
-std::array<float,2>{0.902849019f, 0.152108461f},
-std::array<float,2>{0.549048305f, 0.70929569f},
-std::array<float,2>{0.454639465f, 0.339140534f},
-std::array<float,2>{0.42912516f, 0.801063716f},
-std::array<float,2>{0.563814461f, 0.146388888f},
-std::array<float,2>{0.985840976f, 0.716887712f},
-std::array<float,2>{0.155464828f, 0.3313196f},
-std::array<float,2>{0.123882234f, 0.610855937f},
-std::array<float,2>{0.808654845f, 0.427805841f},
-std::array<float,2>{0.702697098f, 0.890408516f},
-std::array<float,2>{0.285220832f, 0.09329734f},
-std::array<float,2>{0.317285687f, 0.653652966f},
-std::array<float,2>{0.634557784f, 0.312301666f},
-std::array<float,2>{0.83149749f, 0.856558263f},
-std::array<float,2>{0.0154928565f, 0.245782569f},
-std::array<float,2>{0.224191844f, 0.954196751f},
-std::array<float,2>{0.888774812f, 0.0143245216f},
-std::array<float,2>{0.545466065f, 0.531011105f},
-std::array<float,2>{0.439819723f, 0.470890433f},
-std::array<float,2>{0.263966531f, 0.932807624f},
-std::array<float,2>{0.727528334f, 0.105378129f},
-std::array<float,2>{0.773457885f, 0.567871511f},
-std::array<float,2>{0.0870598927f, 0.386498123f},
-std::array<float,2>{0.186593592f, 0.726530492f},
-std::array<float,2>{0.94903636f, 0.353037119f},
-std::array<float,2>{0.604708314f, 0.757485092f},
-std::array<float,2>{0.381964326f, 0.181407616f},
-std::array<float,2>{0.484585881f, 0.545991004f},
-std::array<float,2>{0.500098467f, 0.448050976f},
-std::array<float,2>{0.913683712f, 0.971158326f},
-std::array<float,2>{0.211951882f, 0.0568984151f},
-std::array<float,2>{0.0501320027f, 0.831584394f},
-std::array<float,2>{0.858241379f, 0.198741063f},
-std::array<float,2>{0.664638877f, 0.67319864f},
-std::array<float,2>{0.347779363f, 0.254987419f},
-std::array<float,2>{0.368218392f, 0.864421785f},
-std::array<float,2>{0.683120131f, 0.229842037f},
-std::array<float,2>{0.872693121f, 0.625638247f},
-std::array<float,2>{0.0461226925f, 0.294298768f},
-std::array<float,2>{0.194862574f, 0.509305835f},
-std::array<float,2>{0.92893523f, 0.494850457f},
-std::array<float,2>{0.52431792f, 0.942364395f},
-std::array<float,2>{0.482455969f, 0.02038729f},
-std::array<float,2>{0.394942492f, 0.702849805f},
-std::array<float,2>{0.624037087f, 0.318081051f},
-std::array<float,2>{0.963323236f, 0.786501408f},
-std::array<float,2>{0.157180652f, 0.131811529f},
-std::array<float,2>{0.0689287633f, 0.892265499f},
-std::array<float,2>{0.761780143f, 0.0749478042f},
-std::array<float,2>{0.749609947f, 0.606668532f},
-std::array<float,2>{0.280866355f, 0.410697252f},
-std::array<float,2>{0.459952712f, 0.989005268f},
-std::array<float,2>{0.553952932f, 0.0447551422f},
-std::array<float,2>{0.90007174f, 0.556738436f},
-std::array<float,2>{0.243676975f, 0.456534535f},
-std::array<float,2>{0.021371549f, 0.658802152f},
-std::array<float,2>{0.824891925f, 0.269306481f},
-std::array<float,2>{0.64180088f, 0.817753017f},
-std::array<float,2>{0.33911401f, 0.212677523f},
-std::array<float,2>{0.303587198f, 0.592572093f},
-std::array<float,2>{0.717395604f, 0.399499327f},
-std::array<float,2>{0.785680294f, 0.907693624f},
-std::array<float,2>{0.106631555f, 0.120570637f},
-std::array<float,2>{0.125516981f, 0.766848266f},
-std::array<float,2>{0.982650518f, 0.169343099f},
-std::array<float,2>{0.590725005f, 0.747525632f},
-std::array<float,2>{0.411724061f, 0.362195075f},
-std::array<float,2>{0.473109007f, 0.82343328f},
-std::array<float,2>{0.519161403f, 0.204298675f},
-std::array<float,2>{0.930443168f, 0.671683371f},
-std::array<float,2>{0.195952684f, 0.274422497f},
-std::array<float,2>{0.0355343372f, 0.549257159f},
-std::array<float,2>{0.866263509f, 0.461611658f},
-std::array<float,2>{0.678223252f, 0.998232305f},
-std::array<float,2>{0.360390961f, 0.0356768519f},
-std::array<float,2>{0.268091679f, 0.735035717f},
-std::array<float,2>{0.736918271f, 0.371001244f},
-std::array<float,2>{0.750180781f, 0.781143248f},
-std::array<float,2>{0.0717041641f, 0.16009374f},
-std::array<float,2>{0.170890912f, 0.920302987f},
-std::array<float,2>{0.959850013f, 0.11619892f},
-std::array<float,2>{0.615725994f, 0.583529711f},
-std::array<float,2>{0.40415293f, 0.39213562f},
-std::array<float,2>{0.335785598f, 0.947508991f},
-std::array<float,2>{0.651148498f, 0.0283562578f},
-std::array<float,2>{0.818636715f, 0.500138581f},
-std::array<float,2>{0.0274496563f, 0.487519115f},
-std::array<float,2>{0.238595814f, 0.636713684f},
-std::array<float,2>{0.892571867f, 0.28902927f},
-std::array<float,2>{0.55935055f, 0.871654809f},
-std::array<float,2>{0.463140607f, 0.219659358f},
-std::array<float,2>{0.419158876f, 0.598677456f},
-std::array<float,2>{0.585392416f, 0.415185541f},
-std::array<float,2>{0.972848356f, 0.905853391f},
-std::array<float,2>{0.133521497f, 0.0694709122f},
-std::array<float,2>{0.0984888077f, 0.796401143f},
-std::array<float,2>{0.793411314f, 0.13997671f},
-std::array<float,2>{0.703439236f, 0.691682577f},
-std::array<float,2>{0.307904959f, 0.327176929f},
-std::array<float,2>{0.295809507f, 0.762160599f},
-std::array<float,2>{0.68804729f, 0.179402307f},
-std::array<float,2>{0.80295217f, 0.733283341f},
-std::array<float,2>{0.115533948f, 0.348319978f},
-std::array<float,2>{0.148034051f, 0.575607896f},
-std::array<float,2>{0.992724776f, 0.377903014f},
-std::array<float,2>{0.578052819f, 0.928565502f},
-std::array<float,2>{0.431175113f, 0.0979187116f},
-std::array<float,2>{0.452838928f, 0.680455446f},
-std::array<float,2>{0.531693876f, 0.263763905f},
-std::array<float,2>{0.876799762f, 0.840220094f},
-std::array<float,2>{0.231528431f, 0.192118675f},
-std::array<float,2>{0.00568123441f, 0.977223337f},
-std::array<float,2>{0.836568177f, 0.0507828705f},
-std::array<float,2>{0.627322912f, 0.532425642f},
-std::array<float,2>{0.324389726f, 0.442122877f},
-std::array<float,2>{0.389511406f, 0.879236102f},
-std::array<float,2>{0.596421719f, 0.0852827579f},
-std::array<float,2>{0.944006562f, 0.624709487f},
-std::array<float,2>{0.178862706f, 0.436172992f},
-std::array<float,2>{0.0852004588f, 0.706918001f},
-std::array<float,2>{0.769671261f, 0.34366709f},
-std::array<float,2>{0.721939266f, 0.81197226f},
-std::array<float,2>{0.251512945f, 0.15243268f},
-std::array<float,2>{0.358500719f, 0.518147171f},
-std::array<float,2>{0.658566713f, 0.478964329f},
-std::array<float,2>{0.85084188f, 0.967176199f},
-std::array<float,2>{0.0595397502f, 0.00134706427f},
-std::array<float,2>{0.209995806f, 0.849865079f},
-std::array<float,2>{0.919130743f, 0.242157295f},
-std::array<float,2>{0.513985872f, 0.641785324f},
-std::array<float,2>{0.499516636f, 0.303754091f},
-std::array<float,2>{0.417568773f, 0.833139956f},
-std::array<float,2>{0.580828488f, 0.199865863f},
-std::array<float,2>{0.970460355f, 0.676294506f},
-std::array<float,2>{0.139077231f, 0.250479549f},
-std::array<float,2>{0.0969912112f, 0.539368391f},
-std::array<float,2>{0.791796029f, 0.451411813f},
-std::array<float,2>{0.707693577f, 0.975185156f},
-std::array<float,2>{0.309944838f, 0.0613415837f},
-std::array<float,2>{0.329086572f, 0.72137624f},
-std::array<float,2>{0.65374583f, 0.358317077f},
-std::array<float,2>{0.815947354f, 0.750408351f},
-std::array<float,2>{0.0258051325f, 0.184161022f},
-std::array<float,2>{0.235350817f, 0.933662176f},
-std::array<float,2>{0.894858837f, 0.107271805f},
-std::array<float,2>{0.555897593f, 0.564082265f},
-std::array<float,2>{0.465948015f, 0.390283883f},
-std::array<float,2>{0.271449417f, 0.960149169f},
-std::array<float,2>{0.741799772f, 0.0114228241f},
-std::array<float,2>{0.757059216f, 0.526248574f},
-std::array<float,2>{0.0760218278f, 0.472941637f},
-std::array<float,2>{0.164414346f, 0.6492818f},
-std::array<float,2>{0.953715682f, 0.308273464f},
-std::array<float,2>{0.610383034f, 0.852672696f},
-std::array<float,2>{0.401640654f, 0.246137783f},
-std::array<float,2>{0.471585006f, 0.616130769f},
-std::array<float,2>{0.523193538f, 0.423130244f},
-std::array<float,2>{0.936822236f, 0.882912755f},
-std::array<float,2>{0.200537592f, 0.0872243568f},
-std::array<float,2>{0.0341355726f, 0.79712975f},
-std::array<float,2>{0.862132668f, 0.143896654f},
-std::array<float,2>{0.672424078f, 0.713332057f},
-std::array<float,2>{0.364252985f, 0.335441262f},
-std::array<float,2>{0.355139524f, 0.771211445f},
-std::array<float,2>{0.663551986f, 0.167801484f},
-std::array<float,2>{0.846771598f, 0.745537341f},
-std::array<float,2>{0.0552212894f, 0.365847826f},
-std::array<float,2>{0.206353486f, 0.588581324f},
-std::array<float,2>{0.914818943f, 0.40501371f},
-std::array<float,2>{0.507888794f, 0.912259161f},
-std::array<float,2>{0.493932992f, 0.122521043f},
-std::array<float,2>{0.383865207f, 0.661813021f},
-std::array<float,2>{0.599466443f, 0.272614956f},
-std::array<float,2>{0.940834224f, 0.812574625f},
-std::array<float,2>{0.17321527f, 0.216541573f},
-std::array<float,2>{0.0812852681f, 0.985512555f},
-std::array<float,2>{0.766297877f, 0.0399381109f},
-std::array<float,2>{0.725984275f, 0.559699476f},
-std::array<float,2>{0.255871505f, 0.457853258f},
-std::array<float,2>{0.448604137f, 0.896610379f},
-std::array<float,2>{0.537092388f, 0.0733457804f},
-std::array<float,2>{0.882657826f, 0.603625834f},
-std::array<float,2>{0.228176236f, 0.408614427f},
-std::array<float,2>{0.00130258664f, 0.696547866f},
-std::array<float,2>{0.841375291f, 0.313951105f},
-std::array<float,2>{0.630892813f, 0.781744301f},
-std::array<float,2>{0.32411167f, 0.126381636f},
-std::array<float,2>{0.290658146f, 0.51349777f},
-std::array<float,2>{0.694948137f, 0.499703646f},
-std::array<float,2>{0.799046814f, 0.941207767f},
-std::array<float,2>{0.111126222f, 0.0174720604f},
-std::array<float,2>{0.143812016f, 0.85974735f},
-std::array<float,2>{0.997380018f, 0.232060879f},
-std::array<float,2>{0.572434306f, 0.631971896f},
-std::array<float,2>{0.434261739f, 0.291301101f},
-std::array<float,2>{0.488445371f, 0.792529583f},
-std::array<float,2>{0.506618977f, 0.135225788f},
-std::array<float,2>{0.909687817f, 0.690203905f},
-std::array<float,2>{0.21572943f, 0.321304768f},
-std::array<float,2>{0.0514055677f, 0.597187161f},
-std::array<float,2>{0.853117168f, 0.418791205f},
-std::array<float,2>{0.669902146f, 0.899693489f},
-std::array<float,2>{0.34589991f, 0.0635732785f},
-std::array<float,2>{0.25984633f, 0.639278471f},
-std::array<float,2>{0.733376324f, 0.283028603f},
-std::array<float,2>{0.779304266f, 0.869059503f},
-std::array<float,2>{0.0923987478f, 0.226494536f},
-std::array<float,2>{0.180507809f, 0.953031182f},
-std::array<float,2>{0.950934291f, 0.0264862943f},
-std::array<float,2>{0.609125495f, 0.507335544f},
-std::array<float,2>{0.378569365f, 0.491830647f},
-std::array<float,2>{0.313349128f, 0.917873144f},
-std::array<float,2>{0.636813343f, 0.111639388f},
-std::array<float,2>{0.834525049f, 0.581956029f},
-std::array<float,2>{0.0089543378f, 0.39761135f},
-std::array<float,2>{0.222018734f, 0.741765559f},
-std::array<float,2>{0.884742975f, 0.374852568f},
-std::array<float,2>{0.540486455f, 0.776638269f},
-std::array<float,2>{0.444605052f, 0.162785769f},
-std::array<float,2>{0.422350019f, 0.551062107f},
-std::array<float,2>{0.568338156f, 0.467619002f},
-std::array<float,2>{0.99119848f, 0.993662238f},
-std::array<float,2>{0.149389356f, 0.0314262807f},
-std::array<float,2>{0.117746949f, 0.825339615f},
-std::array<float,2>{0.805330455f, 0.210350454f},
-std::array<float,2>{0.696243107f, 0.66589421f},
-std::array<float,2>{0.284517199f, 0.27824834f},
-std::array<float,2>{0.300039172f, 0.847056627f},
-std::array<float,2>{0.714727879f, 0.238243565f},
-std::array<float,2>{0.782840431f, 0.646002769f},
-std::array<float,2>{0.104294091f, 0.298124999f},
-std::array<float,2>{0.130171269f, 0.519610345f},
-std::array<float,2>{0.979030788f, 0.483639985f},
-std::array<float,2>{0.587014198f, 0.963846266f},
-std::array<float,2>{0.407575607f, 0.00626713922f},
-std::array<float,2>{0.456422418f, 0.70706749f},
-std::array<float,2>{0.547931552f, 0.337802619f},
-std::array<float,2>{0.905697703f, 0.806093395f},
-std::array<float,2>{0.248029381f, 0.149106786f},
-std::array<float,2>{0.0190595593f, 0.875291407f},
-std::array<float,2>{0.821269572f, 0.0790501535f},
-std::array<float,2>{0.647680163f, 0.62105906f},
-std::array<float,2>{0.341414183f, 0.429931015f},
-std::array<float,2>{0.394420922f, 0.982172489f},
-std::array<float,2>{0.619151473f, 0.0472220443f},
-std::array<float,2>{0.968529224f, 0.537393272f},
-std::array<float,2>{0.162581339f, 0.439017802f},
-std::array<float,2>{0.0627167076f, 0.687307477f},
-std::array<float,2>{0.758537292f, 0.259755731f},
-std::array<float,2>{0.743335366f, 0.839312494f},
-std::array<float,2>{0.276584446f, 0.190504357f},
-std::array<float,2>{0.372113019f, 0.573987842f},
-std::array<float,2>{0.684902549f, 0.379902393f},
-std::array<float,2>{0.868534207f, 0.922472656f},
-std::array<float,2>{0.0404684357f, 0.0964252949f},
-std::array<float,2>{0.190643772f, 0.757923961f},
-std::array<float,2>{0.922960699f, 0.173900634f},
-std::array<float,2>{0.530578554f, 0.728486776f},
-std::array<float,2>{0.477538109f, 0.346610606f},
-std::array<float,2>{0.379352778f, 0.755673587f},
-std::array<float,2>{0.602239609f, 0.183388963f},
-std::array<float,2>{0.947222173f, 0.723214924f},
-std::array<float,2>{0.18387866f, 0.353798866f},
-std::array<float,2>{0.0882273838f, 0.568683386f},
-std::array<float,2>{0.776317716f, 0.383957446f},
-std::array<float,2>{0.728612125f, 0.931393445f},
-std::array<float,2>{0.262514174f, 0.103030786f},
-std::array<float,2>{0.351499528f, 0.674268961f},
-std::array<float,2>{0.667818069f, 0.255909622f},
-std::array<float,2>{0.856256843f, 0.828385115f},
-std::array<float,2>{0.04712734f, 0.195537314f},
-std::array<float,2>{0.214315861f, 0.969863653f},
-std::array<float,2>{0.911918581f, 0.0559158921f},
-std::array<float,2>{0.502443373f, 0.543173671f},
-std::array<float,2>{0.486959279f, 0.445887387f},
-std::array<float,2>{0.287578642f, 0.887789667f},
-std::array<float,2>{0.699478507f, 0.0909899324f},
-std::array<float,2>{0.810788155f, 0.611488223f},
-std::array<float,2>{0.121636696f, 0.427085042f},
-std::array<float,2>{0.153897583f, 0.716065168f},
-std::array<float,2>{0.987871945f, 0.32990396f},
-std::array<float,2>{0.566285729f, 0.803172886f},
-std::array<float,2>{0.42633006f, 0.148198888f},
-std::array<float,2>{0.438127369f, 0.528185129f},
-std::array<float,2>{0.544405639f, 0.469536424f},
-std::array<float,2>{0.887698889f, 0.956947803f},
-std::array<float,2>{0.22630173f, 0.0132665047f},
-std::array<float,2>{0.0132395541f, 0.858768344f},
-std::array<float,2>{0.829919398f, 0.242396116f},
-std::array<float,2>{0.6359272f, 0.65456003f},
-std::array<float,2>{0.319956869f, 0.309654057f},
-std::array<float,2>{0.336167246f, 0.819654286f},
-std::array<float,2>{0.644477665f, 0.214276865f},
-std::array<float,2>{0.827743888f, 0.657167435f},
-std::array<float,2>{0.0219235774f, 0.267023623f},
-std::array<float,2>{0.24508287f, 0.555875778f},
-std::array<float,2>{0.90098083f, 0.454327583f},
-std::array<float,2>{0.5525617f, 0.990450084f},
-std::array<float,2>{0.45796454f, 0.0450804234f},
-std::array<float,2>{0.413069665f, 0.749570429f},
-std::array<float,2>{0.593220294f, 0.360579461f},
-std::array<float,2>{0.981055915f, 0.769072711f},
-std::array<float,2>{0.128164127f, 0.170073733f},
-std::array<float,2>{0.107933886f, 0.90838486f},
-std::array<float,2>{0.788773835f, 0.119043991f},
-std::array<float,2>{0.715599477f, 0.591663063f},
-std::array<float,2>{0.301826984f, 0.400506973f},
-std::array<float,2>{0.481981456f, 0.944431484f},
-std::array<float,2>{0.527310431f, 0.0229677428f},
-std::array<float,2>{0.926250577f, 0.510657847f},
-std::array<float,2>{0.193048418f, 0.493914336f},
-std::array<float,2>{0.0448804051f, 0.628578722f},
-std::array<float,2>{0.874630451f, 0.295120925f},
-std::array<float,2>{0.681318581f, 0.865495741f},
-std::array<float,2>{0.369242191f, 0.227211401f},
-std::array<float,2>{0.278449893f, 0.608460903f},
-std::array<float,2>{0.747036338f, 0.413692564f},
-std::array<float,2>{0.764108956f, 0.893739045f},
-std::array<float,2>{0.0673556626f, 0.0780302286f},
-std::array<float,2>{0.15865007f, 0.788824856f},
-std::array<float,2>{0.961397231f, 0.13033019f},
-std::array<float,2>{0.621894836f, 0.7010656f},
-std::array<float,2>{0.397551209f, 0.319501787f},
-std::array<float,2>{0.461590141f, 0.874398947f},
-std::array<float,2>{0.562374532f, 0.221066758f},
-std::array<float,2>{0.892933846f, 0.634490252f},
-std::array<float,2>{0.240839899f, 0.285744607f},
-std::array<float,2>{0.0300006699f, 0.50273174f},
-std::array<float,2>{0.818049133f, 0.484770238f},
-std::array<float,2>{0.649331391f, 0.947219431f},
-std::array<float,2>{0.333305568f, 0.0303160623f},
-std::array<float,2>{0.305882454f, 0.694013178f},
-std::array<float,2>{0.706594169f, 0.324304253f},
-std::array<float,2>{0.796379924f, 0.794761002f},
-std::array<float,2>{0.101412095f, 0.138547391f},
-std::array<float,2>{0.136530921f, 0.903963566f},
-std::array<float,2>{0.976195693f, 0.0675817057f},
-std::array<float,2>{0.58302784f, 0.600570738f},
-std::array<float,2>{0.420343816f, 0.416980505f},
-std::array<float,2>{0.362924755f, 0.997407317f},
-std::array<float,2>{0.676855505f, 0.0381727628f},
-std::array<float,2>{0.863423228f, 0.5481444f},
-std::array<float,2>{0.0372209065f, 0.463565648f},
-std::array<float,2>{0.197356254f, 0.668095112f},
-std::array<float,2>{0.933237731f, 0.275512367f},
-std::array<float,2>{0.515832007f, 0.821897924f},
-std::array<float,2>{0.4762806f, 0.205232218f},
-std::array<float,2>{0.404782087f, 0.584562361f},
-std::array<float,2>{0.614943743f, 0.393989712f},
-std::array<float,2>{0.957768679f, 0.919537306f},
-std::array<float,2>{0.167992607f, 0.115189508f},
-std::array<float,2>{0.0732236058f, 0.778184652f},
-std::array<float,2>{0.752029479f, 0.157649606f},
-std::array<float,2>{0.735848129f, 0.73737973f},
-std::array<float,2>{0.266863078f, 0.368311882f},
-std::array<float,2>{0.252587199f, 0.808692575f},
-std::array<float,2>{0.719420075f, 0.155342937f},
-std::array<float,2>{0.771606207f, 0.705016136f},
-std::array<float,2>{0.0820452869f, 0.341472775f},
-std::array<float,2>{0.175798655f, 0.621390045f},
-std::array<float,2>{0.942923725f, 0.434277147f},
-std::array<float,2>{0.594114482f, 0.88218528f},
-std::array<float,2>{0.388018787f, 0.0829027966f},
-std::array<float,2>{0.497853786f, 0.642679453f},
-std::array<float,2>{0.513165355f, 0.301560014f},
-std::array<float,2>{0.921655297f, 0.849584103f},
-std::array<float,2>{0.20856522f, 0.23983252f},
-std::array<float,2>{0.0610159673f, 0.965371072f},
-std::array<float,2>{0.849409044f, 0.00257579167f},
-std::array<float,2>{0.657726884f, 0.517558098f},
-std::array<float,2>{0.356853217f, 0.477093786f},
-std::array<float,2>{0.433052033f, 0.92609024f},
-std::array<float,2>{0.575537324f, 0.100950196f},
-std::array<float,2>{0.995535433f, 0.577787519f},
-std::array<float,2>{0.145963982f, 0.375014901f},
-std::array<float,2>{0.114807032f, 0.731453419f},
-std::array<float,2>{0.800947964f, 0.350732684f},
-std::array<float,2>{0.690980375f, 0.76500982f},
-std::array<float,2>{0.2942518f, 0.176238477f},
-std::array<float,2>{0.327413738f, 0.534912944f},
-std::array<float,2>{0.626797855f, 0.445222437f},
-std::array<float,2>{0.839492857f, 0.978855133f},
-std::array<float,2>{0.00586049212f, 0.0533290841f},
-std::array<float,2>{0.234214112f, 0.843461931f},
-std::array<float,2>{0.878363609f, 0.194602385f},
-std::array<float,2>{0.534135818f, 0.682679534f},
-std::array<float,2>{0.449750692f, 0.262750655f},
-std::array<float,2>{0.426845312f, 0.856715441f},
-std::array<float,2>{0.565141618f, 0.246032476f},
-std::array<float,2>{0.987115204f, 0.653375983f},
-std::array<float,2>{0.153090373f, 0.31219551f},
-std::array<float,2>{0.122458376f, 0.530915439f},
-std::array<float,2>{0.812412858f, 0.471046418f},
-std::array<float,2>{0.700404227f, 0.954437673f},
-std::array<float,2>{0.288721323f, 0.0146147516f},
-std::array<float,2>{0.319081455f, 0.717280805f},
-std::array<float,2>{0.63536799f, 0.331158787f},
-std::array<float,2>{0.828975797f, 0.800969243f},
-std::array<float,2>{0.0118858591f, 0.14618884f},
-std::array<float,2>{0.225152448f, 0.890350521f},
-std::array<float,2>{0.887029946f, 0.0935789272f},
-std::array<float,2>{0.543547988f, 0.611137211f},
-std::array<float,2>{0.439280242f, 0.428020447f},
-std::array<float,2>{0.263127506f, 0.970886528f},
-std::array<float,2>{0.729802191f, 0.0568394996f},
-std::array<float,2>{0.77659291f, 0.546328962f},
-std::array<float,2>{0.0897878036f, 0.447755903f},
-std::array<float,2>{0.184800386f, 0.673093855f},
-std::array<float,2>{0.945766866f, 0.255351365f},
-std::array<float,2>{0.603450239f, 0.831788361f},
-std::array<float,2>{0.380246818f, 0.199046746f},
-std::array<float,2>{0.487917036f, 0.568196833f},
-std::array<float,2>{0.503869772f, 0.386365503f},
-std::array<float,2>{0.910444677f, 0.932997882f},
-std::array<float,2>{0.213517442f, 0.105165742f},
-std::array<float,2>{0.048132617f, 0.757668972f},
-std::array<float,2>{0.857145607f, 0.181211457f},
-std::array<float,2>{0.666238725f, 0.726159275f},
-std::array<float,2>{0.350012332f, 0.353351712f},
-std::array<float,2>{0.370166093f, 0.786136389f},
-std::array<float,2>{0.680421233f, 0.131427601f},
-std::array<float,2>{0.873317778f, 0.702898562f},
-std::array<float,2>{0.043098297f, 0.318182319f},
-std::array<float,2>{0.191489562f, 0.606910765f},
-std::array<float,2>{0.927615941f, 0.411125571f},
-std::array<float,2>{0.526193678f, 0.892546535f},
-std::array<float,2>{0.480732024f, 0.0750040412f},
-std::array<float,2>{0.396585763f, 0.625815392f},
-std::array<float,2>{0.622733474f, 0.2940301f},
-std::array<float,2>{0.962753177f, 0.864662826f},
-std::array<float,2>{0.159886286f, 0.229638025f},
-std::array<float,2>{0.0677131414f, 0.942115307f},
-std::array<float,2>{0.765473247f, 0.0201748051f},
-std::array<float,2>{0.747648358f, 0.509741604f},
-std::array<float,2>{0.277706653f, 0.495091707f},
-std::array<float,2>{0.458060443f, 0.907318354f},
-std::array<float,2>{0.551315904f, 0.120157026f},
-std::array<float,2>{0.901637256f, 0.592310369f},
-std::array<float,2>{0.245599732f, 0.399660081f},
-std::array<float,2>{0.0227594059f, 0.747307837f},
-std::array<float,2>{0.826368034f, 0.36201027f},
-std::array<float,2>{0.643472135f, 0.766820371f},
-std::array<float,2>{0.337333769f, 0.169176042f},
-std::array<float,2>{0.300948411f, 0.55692631f},
-std::array<float,2>{0.71671927f, 0.456262708f},
-std::array<float,2>{0.787641764f, 0.989197731f},
-std::array<float,2>{0.108951814f, 0.0446775146f},
-std::array<float,2>{0.127840027f, 0.817589581f},
-std::array<float,2>{0.982069433f, 0.212579027f},
-std::array<float,2>{0.592150271f, 0.659061074f},
-std::array<float,2>{0.413863361f, 0.269124657f},
-std::array<float,2>{0.474691421f, 0.780841053f},
-std::array<float,2>{0.51688993f, 0.159794122f},
-std::array<float,2>{0.931776762f, 0.735216439f},
-std::array<float,2>{0.198976249f, 0.370701849f},
-std::array<float,2>{0.0383008122f, 0.583861351f},
-std::array<float,2>{0.864771664f, 0.392397612f},
-std::array<float,2>{0.67667377f, 0.920069873f},
-std::array<float,2>{0.361342251f, 0.115856826f},
-std::array<float,2>{0.266020894f, 0.671470761f},
-std::array<float,2>{0.734516263f, 0.274772435f},
-std::array<float,2>{0.75306344f, 0.823707998f},
-std::array<float,2>{0.0736780465f, 0.204566896f},
-std::array<float,2>{0.16987446f, 0.998462915f},
-std::array<float,2>{0.958790481f, 0.0359734222f},
-std::array<float,2>{0.613602817f, 0.548891246f},
-std::array<float,2>{0.406218708f, 0.461739361f},
-std::array<float,2>{0.332547814f, 0.906100154f},
-std::array<float,2>{0.649578214f, 0.06973885f},
-std::array<float,2>{0.817138076f, 0.598904371f},
-std::array<float,2>{0.0304994788f, 0.415516406f},
-std::array<float,2>{0.241851255f, 0.691495478f},
-std::array<float,2>{0.893792868f, 0.327563584f},
-std::array<float,2>{0.560565412f, 0.796633363f},
-std::array<float,2>{0.461952746f, 0.139814094f},
-std::array<float,2>{0.421359837f, 0.500274122f},
-std::array<float,2>{0.582056463f, 0.487582356f},
-std::array<float,2>{0.975221097f, 0.947688103f},
-std::array<float,2>{0.135243267f, 0.0285752993f},
-std::array<float,2>{0.100260757f, 0.871979475f},
-std::array<float,2>{0.795653641f, 0.219411254f},
-std::array<float,2>{0.70553565f, 0.636266172f},
-std::array<float,2>{0.305506706f, 0.288665652f},
-std::array<float,2>{0.293100834f, 0.839993298f},
-std::array<float,2>{0.690033734f, 0.192168251f},
-std::array<float,2>{0.802033484f, 0.680328488f},
-std::array<float,2>{0.11377418f, 0.264091909f},
-std::array<float,2>{0.144915432f, 0.532573044f},
-std::array<float,2>{0.995022118f, 0.442176342f},
-std::array<float,2>{0.574754417f, 0.977316022f},
-std::array<float,2>{0.432323188f, 0.0511201322f},
-std::array<float,2>{0.45067516f, 0.732988954f},
-std::array<float,2>{0.534753442f, 0.348600268f},
-std::array<float,2>{0.877799749f, 0.761953473f},
-std::array<float,2>{0.232933402f, 0.179464787f},
-std::array<float,2>{0.00695443712f, 0.928348899f},
-std::array<float,2>{0.83851862f, 0.0978141353f},
-std::array<float,2>{0.625197291f, 0.575208068f},
-std::array<float,2>{0.326835871f, 0.377671152f},
-std::array<float,2>{0.386758626f, 0.966845751f},
-std::array<float,2>{0.595276892f, 0.00104215799f},
-std::array<float,2>{0.941689491f, 0.518464386f},
-std::array<float,2>{0.177566558f, 0.478624016f},
-std::array<float,2>{0.0833874866f, 0.642056465f},
-std::array<float,2>{0.773366392f, 0.304015487f},
-std::array<float,2>{0.720670521f, 0.84972471f},
-std::array<float,2>{0.253203303f, 0.241941437f},
-std::array<float,2>{0.355771214f, 0.624951839f},
-std::array<float,2>{0.657162249f, 0.436513811f},
-std::array<float,2>{0.847941756f, 0.878979445f},
-std::array<float,2>{0.0617368817f, 0.0849631578f},
-std::array<float,2>{0.207193896f, 0.811765969f},
-std::array<float,2>{0.920246303f, 0.152807042f},
-std::array<float,2>{0.511838913f, 0.706685126f},
-std::array<float,2>{0.496493042f, 0.343265712f},
-std::array<float,2>{0.400990546f, 0.799804628f},
-std::array<float,2>{0.609658122f, 0.141769126f},
-std::array<float,2>{0.954310238f, 0.712765694f},
-std::array<float,2>{0.165392488f, 0.333513319f},
-std::array<float,2>{0.0743840784f, 0.615026057f},
-std::array<float,2>{0.755968988f, 0.423936039f},
-std::array<float,2>{0.740370691f, 0.885204256f},
-std::array<float,2>{0.270400941f, 0.0895434618f},
-std::array<float,2>{0.364637882f, 0.650684476f},
-std::array<float,2>{0.673163414f, 0.305802137f},
-std::array<float,2>{0.86317569f, 0.855425656f},
-std::array<float,2>{0.0347638093f, 0.249510184f},
-std::array<float,2>{0.199729756f, 0.957358003f},
-std::array<float,2>{0.936258197f, 0.00921436958f},
-std::array<float,2>{0.521865666f, 0.525039673f},
-std::array<float,2>{0.471795678f, 0.476198107f},
-std::array<float,2>{0.308734357f, 0.937086463f},
-std::array<float,2>{0.708525419f, 0.109205693f},
-std::array<float,2>{0.792350113f, 0.564456463f},
-std::array<float,2>{0.0957593396f, 0.388058394f},
-std::array<float,2>{0.139744624f, 0.719419539f},
-std::array<float,2>{0.96879673f, 0.357393473f},
-std::array<float,2>{0.581922293f, 0.752881408f},
-std::array<float,2>{0.416457683f, 0.186962366f},
-std::array<float,2>{0.464908153f, 0.54240942f},
-std::array<float,2>{0.554741502f, 0.45078212f},
-std::array<float,2>{0.896321595f, 0.972875595f},
-std::array<float,2>{0.236191779f, 0.0587468483f},
-std::array<float,2>{0.0272912886f, 0.834631383f},
-std::array<float,2>{0.815326035f, 0.201749042f},
-std::array<float,2>{0.652533591f, 0.678077281f},
-std::array<float,2>{0.329209059f, 0.253869593f},
-std::array<float,2>{0.322539121f, 0.8613922f},
-std::array<float,2>{0.63276577f, 0.233308956f},
-std::array<float,2>{0.839992821f, 0.628965855f},
-std::array<float,2>{0.000610792194f, 0.290496618f},
-std::array<float,2>{0.227290317f, 0.514034688f},
-std::array<float,2>{0.881076574f, 0.497559011f},
-std::array<float,2>{0.535835326f, 0.938838363f},
-std::array<float,2>{0.447960168f, 0.0175982397f},
-std::array<float,2>{0.435403168f, 0.698157668f},
-std::array<float,2>{0.573515594f, 0.314577997f},
-std::array<float,2>{0.996864319f, 0.78396976f},
-std::array<float,2>{0.143105134f, 0.12779206f},
-std::array<float,2>{0.110082805f, 0.894854307f},
-std::array<float,2>{0.800222576f, 0.0710584968f},
-std::array<float,2>{0.694163501f, 0.602542996f},
-std::array<float,2>{0.289803654f, 0.406287968f},
-std::array<float,2>{0.492980242f, 0.987668753f},
-std::array<float,2>{0.509333491f, 0.0429482721f},
-std::array<float,2>{0.915962994f, 0.561855197f},
-std::array<float,2>{0.206004322f, 0.459458113f},
-std::array<float,2>{0.0561535917f, 0.662296414f},
-std::array<float,2>{0.84627229f, 0.270793319f},
-std::array<float,2>{0.66305995f, 0.815368056f},
-std::array<float,2>{0.354237854f, 0.21707575f},
-std::array<float,2>{0.257088453f, 0.587831557f},
-std::array<float,2>{0.724956453f, 0.40351662f},
-std::array<float,2>{0.767104506f, 0.911869347f},
-std::array<float,2>{0.0801032931f, 0.124177642f},
-std::array<float,2>{0.172723785f, 0.772876322f},
-std::array<float,2>{0.939666688f, 0.166002288f},
-std::array<float,2>{0.598529518f, 0.742491305f},
-std::array<float,2>{0.382954061f, 0.364569187f},
-std::array<float,2>{0.444077015f, 0.826262951f},
-std::array<float,2>{0.539583802f, 0.207156822f},
-std::array<float,2>{0.883632362f, 0.667945981f},
-std::array<float,2>{0.221266717f, 0.280435175f},
-std::array<float,2>{0.00802631304f, 0.55396229f},
-std::array<float,2>{0.835693836f, 0.465404868f},
-std::array<float,2>{0.638160229f, 0.99510181f},
-std::array<float,2>{0.314347267f, 0.0335065909f},
-std::array<float,2>{0.284129798f, 0.740087092f},
-std::array<float,2>{0.696478903f, 0.371281832f},
-std::array<float,2>{0.806356013f, 0.774632454f},
-std::array<float,2>{0.118901432f, 0.161415264f},
-std::array<float,2>{0.149791464f, 0.914597213f},
-std::array<float,2>{0.991459131f, 0.109489195f},
-std::array<float,2>{0.566801131f, 0.57948786f},
-std::array<float,2>{0.423378915f, 0.396012247f},
-std::array<float,2>{0.347414076f, 0.950170636f},
-std::array<float,2>{0.668559968f, 0.0241433736f},
-std::array<float,2>{0.85226053f, 0.504811823f},
-std::array<float,2>{0.0522994027f, 0.4900814f},
-std::array<float,2>{0.216782004f, 0.638537705f},
-std::array<float,2>{0.908280849f, 0.284169495f},
-std::array<float,2>{0.507411301f, 0.869918525f},
-std::array<float,2>{0.489733696f, 0.2235239f},
-std::array<float,2>{0.377540171f, 0.595036447f},
-std::array<float,2>{0.607794106f, 0.420837492f},
-std::array<float,2>{0.949533641f, 0.901590168f},
-std::array<float,2>{0.181256667f, 0.065998584f},
-std::array<float,2>{0.0928008854f, 0.789448798f},
-std::array<float,2>{0.780733883f, 0.133796573f},
-std::array<float,2>{0.733709455f, 0.688451111f},
-std::array<float,2>{0.260932058f, 0.322661489f},
-std::array<float,2>{0.275529206f, 0.760623872f},
-std::array<float,2>{0.742749214f, 0.172666535f},
-std::array<float,2>{0.759512126f, 0.729545951f},
-std::array<float,2>{0.0637051016f, 0.343937725f},
-std::array<float,2>{0.163692713f, 0.571582317f},
-std::array<float,2>{0.967745185f, 0.381694943f},
-std::array<float,2>{0.620303094f, 0.92468518f},
-std::array<float,2>{0.39339301f, 0.0939459577f},
-std::array<float,2>{0.477637798f, 0.683812082f},
-std::array<float,2>{0.529298127f, 0.260366768f},
-std::array<float,2>{0.922530055f, 0.837290645f},
-std::array<float,2>{0.189557895f, 0.187933221f},
-std::array<float,2>{0.0397377163f, 0.983300984f},
-std::array<float,2>{0.867498219f, 0.0506579019f},
-std::array<float,2>{0.684550703f, 0.535992742f},
-std::array<float,2>{0.37197426f, 0.440616339f},
-std::array<float,2>{0.407007694f, 0.877846599f},
-std::array<float,2>{0.586069822f, 0.0815518573f},
-std::array<float,2>{0.980170131f, 0.619083524f},
-std::array<float,2>{0.128966734f, 0.432372242f},
-std::array<float,2>{0.105209529f, 0.709097147f},
-std::array<float,2>{0.781524956f, 0.338976741f},
-std::array<float,2>{0.712948263f, 0.807012975f},
-std::array<float,2>{0.299593717f, 0.151864514f},
-std::array<float,2>{0.339953333f, 0.523038805f},
-std::array<float,2>{0.647392392f, 0.482282043f},
-std::array<float,2>{0.821973145f, 0.962119401f},
-std::array<float,2>{0.0177558828f, 0.00540096499f},
-std::array<float,2>{0.246164247f, 0.844087422f},
-std::array<float,2>{0.90457958f, 0.236073762f},
-std::array<float,2>{0.547181368f, 0.647118628f},
-std::array<float,2>{0.45531258f, 0.300051242f},
-std::array<float,2>{0.381394029f, 0.828191578f},
-std::array<float,2>{0.603520036f, 0.195765138f},
-std::array<float,2>{0.947835326f, 0.673856139f},
-std::array<float,2>{0.185708284f, 0.256287873f},
-std::array<float,2>{0.086803928f, 0.543436885f},
-std::array<float,2>{0.775021136f, 0.446243972f},
-std::array<float,2>{0.7281937f, 0.970204175f},
-std::array<float,2>{0.265407562f, 0.0558401942f},
-std::array<float,2>{0.349070996f, 0.723609209f},
-std::array<float,2>{0.665683925f, 0.353719711f},
-std::array<float,2>{0.8585127f, 0.755607963f},
-std::array<float,2>{0.0492553301f, 0.183206975f},
-std::array<float,2>{0.211665362f, 0.931482077f},
-std::array<float,2>{0.912923217f, 0.103325434f},
-std::array<float,2>{0.501483738f, 0.568477631f},
-std::array<float,2>{0.485567659f, 0.384097457f},
-std::array<float,2>{0.286359817f, 0.956604064f},
-std::array<float,2>{0.701966882f, 0.0135846687f},
-std::array<float,2>{0.809649169f, 0.528044224f},
-std::array<float,2>{0.124182373f, 0.469283015f},
-std::array<float,2>{0.154408425f, 0.654340088f},
-std::array<float,2>{0.985338986f, 0.309991986f},
-std::array<float,2>{0.563311994f, 0.858519256f},
-std::array<float,2>{0.428077072f, 0.242608353f},
-std::array<float,2>{0.440850884f, 0.611810446f},
-std::array<float,2>{0.546662867f, 0.42693907f},
-std::array<float,2>{0.88980943f, 0.887998641f},
-std::array<float,2>{0.223366141f, 0.0910921246f},
-std::array<float,2>{0.0137026226f, 0.802923799f},
-std::array<float,2>{0.830358207f, 0.148099169f},
-std::array<float,2>{0.633020341f, 0.715950191f},
-std::array<float,2>{0.317564577f, 0.329806864f},
-std::array<float,2>{0.337961555f, 0.769476712f},
-std::array<float,2>{0.6409024f, 0.170292974f},
-std::array<float,2>{0.825485528f, 0.74976629f},
-std::array<float,2>{0.0196597576f, 0.360635906f},
-std::array<float,2>{0.24244453f, 0.591421545f},
-std::array<float,2>{0.899174213f, 0.400787175f},
-std::array<float,2>{0.552927494f, 0.908499599f},
-std::array<float,2>{0.460099638f, 0.118690029f},
-std::array<float,2>{0.410207808f, 0.656858444f},
-std::array<float,2>{0.591575146f, 0.266605198f},
-std::array<float,2>{0.983398855f, 0.819453835f},
-std::array<float,2>{0.126727849f, 0.213917136f},
-std::array<float,2>{0.106405221f, 0.990701497f},
-std::array<float,2>{0.786558211f, 0.0453686342f},
-std::array<float,2>{0.717875659f, 0.556150079f},
-std::array<float,2>{0.303809643f, 0.454529166f},
-std::array<float,2>{0.483738899f, 0.893839896f},
-std::array<float,2>{0.524465621f, 0.0778089315f},
-std::array<float,2>{0.927764654f, 0.608779132f},
-std::array<float,2>{0.194310725f, 0.414033234f},
-std::array<float,2>{0.0456297174f, 0.700733244f},
-std::array<float,2>{0.872049749f, 0.319632083f},
-std::array<float,2>{0.682216525f, 0.788746059f},
-std::array<float,2>{0.367954373f, 0.129943475f},
-std::array<float,2>{0.280234337f, 0.510323703f},
-std::array<float,2>{0.748408437f, 0.493852526f},
-std::array<float,2>{0.762771189f, 0.9448089f},
-std::array<float,2>{0.0696095005f, 0.0233096872f},
-std::array<float,2>{0.157422364f, 0.865258336f},
-std::array<float,2>{0.964386344f, 0.227360889f},
-std::array<float,2>{0.623873115f, 0.628700256f},
-std::array<float,2>{0.395680338f, 0.29519701f},
-std::array<float,2>{0.464501381f, 0.794444203f},
-std::array<float,2>{0.559746385f, 0.138425708f},
-std::array<float,2>{0.891084552f, 0.694104433f},
-std::array<float,2>{0.239845723f, 0.324491411f},
-std::array<float,2>{0.0287363753f, 0.600280881f},
-std::array<float,2>{0.820295513f, 0.416604012f},
-std::array<float,2>{0.651441276f, 0.904116929f},
-std::array<float,2>{0.33460182f, 0.067816034f},
-std::array<float,2>{0.306880504f, 0.634631753f},
-std::array<float,2>{0.704595327f, 0.285890371f},
-std::array<float,2>{0.793968201f, 0.874166131f},
-std::array<float,2>{0.0995323434f, 0.220806614f},
-std::array<float,2>{0.134585604f, 0.946981966f},
-std::array<float,2>{0.974471569f, 0.030656008f},
-std::array<float,2>{0.584565282f, 0.502460837f},
-std::array<float,2>{0.418256015f, 0.484531105f},
-std::array<float,2>{0.359828234f, 0.919851959f},
-std::array<float,2>{0.679212987f, 0.114982739f},
-std::array<float,2>{0.866009295f, 0.584816456f},
-std::array<float,2>{0.0362176038f, 0.393653899f},
-std::array<float,2>{0.197214693f, 0.737644374f},
-std::array<float,2>{0.931412935f, 0.368642926f},
-std::array<float,2>{0.518075287f, 0.778048515f},
-std::array<float,2>{0.473861963f, 0.157363176f},
-std::array<float,2>{0.403131038f, 0.54796505f},
-std::array<float,2>{0.616442919f, 0.463787287f},
-std::array<float,2>{0.960527718f, 0.997260749f},
-std::array<float,2>{0.171441883f, 0.0384694785f},
-std::array<float,2>{0.0711093396f, 0.822107136f},
-std::array<float,2>{0.751566112f, 0.205448046f},
-std::array<float,2>{0.737356603f, 0.668250382f},
-std::array<float,2>{0.268579215f, 0.275873244f},
-std::array<float,2>{0.250927866f, 0.849364877f},
-std::array<float,2>{0.721426368f, 0.240146473f},
-std::array<float,2>{0.770999491f, 0.642871439f},
-std::array<float,2>{0.0844154581f, 0.301393479f},
-std::array<float,2>{0.177750021f, 0.517166257f},
-std::array<float,2>{0.945215106f, 0.477513283f},
-std::array<float,2>{0.596797943f, 0.96575141f},
-std::array<float,2>{0.390188873f, 0.00275294832f},
-std::array<float,2>{0.498188317f, 0.704818726f},
-std::array<float,2>{0.51521337f, 0.341702729f},
-std::array<float,2>{0.918089092f, 0.808954239f},
-std::array<float,2>{0.209066406f, 0.155558854f},
-std::array<float,2>{0.0601837076f, 0.881924808f},
-std::array<float,2>{0.850247502f, 0.0827098265f},
-std::array<float,2>{0.659283936f, 0.621289372f},
-std::array<float,2>{0.357428432f, 0.434355795f},
-std::array<float,2>{0.430265665f, 0.978522122f},
-std::array<float,2>{0.57620877f, 0.0534764864f},
-std::array<float,2>{0.993552923f, 0.534673154f},
-std::array<float,2>{0.147268876f, 0.445042402f},
-std::array<float,2>{0.116266102f, 0.683045566f},
-std::array<float,2>{0.80373913f, 0.263035208f},
-std::array<float,2>{0.689213693f, 0.843634367f},
-std::array<float,2>{0.296070904f, 0.194377869f},
-std::array<float,2>{0.325383455f, 0.578007817f},
-std::array<float,2>{0.628888249f, 0.375355482f},
-std::array<float,2>{0.837846756f, 0.92592442f},
-std::array<float,2>{0.00475392397f, 0.100704186f},
-std::array<float,2>{0.231114328f, 0.764847755f},
-std::array<float,2>{0.875793278f, 0.175977334f},
-std::array<float,2>{0.532843709f, 0.731852829f},
-std::array<float,2>{0.452054888f, 0.351044148f},
-std::array<float,2>{0.41493538f, 0.750160038f},
-std::array<float,2>{0.578832209f, 0.184347302f},
-std::array<float,2>{0.972410202f, 0.721547663f},
-std::array<float,2>{0.137537777f, 0.357981086f},
-std::array<float,2>{0.0944679752f, 0.564426899f},
-std::array<float,2>{0.790683448f, 0.390423954f},
-std::array<float,2>{0.710865796f, 0.93390882f},
-std::array<float,2>{0.311522782f, 0.107149243f},
-std::array<float,2>{0.331560493f, 0.67666769f},
-std::array<float,2>{0.655725241f, 0.25016582f},
-std::array<float,2>{0.813916385f, 0.833337784f},
-std::array<float,2>{0.0237646773f, 0.200179398f},
-std::array<float,2>{0.237169102f, 0.975388467f},
-std::array<float,2>{0.897175908f, 0.0610900186f},
-std::array<float,2>{0.557942092f, 0.53930074f},
-std::array<float,2>{0.467584819f, 0.451416254f},
-std::array<float,2>{0.2716389f, 0.883221865f},
-std::array<float,2>{0.739221632f, 0.0869182125f},
-std::array<float,2>{0.755705893f, 0.615826786f},
-std::array<float,2>{0.0773420632f, 0.422981024f},
-std::array<float,2>{0.167293504f, 0.712981701f},
-std::array<float,2>{0.956208169f, 0.335035741f},
-std::array<float,2>{0.613061786f, 0.79700315f},
-std::array<float,2>{0.399444699f, 0.14371191f},
-std::array<float,2>{0.469294608f, 0.525910378f},
-std::array<float,2>{0.520195425f, 0.472843766f},
-std::array<float,2>{0.934955239f, 0.960244358f},
-std::array<float,2>{0.202827811f, 0.0116242478f},
-std::array<float,2>{0.0317158476f, 0.852835178f},
-std::array<float,2>{0.859906554f, 0.246392861f},
-std::array<float,2>{0.674344838f, 0.648980856f},
-std::array<float,2>{0.367164314f, 0.308493525f},
-std::array<float,2>{0.352034301f, 0.812753141f},
-std::array<float,2>{0.661375284f, 0.216585323f},
-std::array<float,2>{0.845551729f, 0.662082016f},
-std::array<float,2>{0.057105083f, 0.272797048f},
-std::array<float,2>{0.204946026f, 0.559838593f},
-std::array<float,2>{0.916944325f, 0.457639337f},
-std::array<float,2>{0.511520386f, 0.985687912f},
-std::array<float,2>{0.495754063f, 0.0396431684f},
-std::array<float,2>{0.385419488f, 0.745191038f},
-std::array<float,2>{0.599899948f, 0.366017997f},
-std::array<float,2>{0.938885152f, 0.771273494f},
-std::array<float,2>{0.17565462f, 0.167718843f},
-std::array<float,2>{0.0791095942f, 0.91246897f},
-std::array<float,2>{0.769352555f, 0.122084863f},
-std::array<float,2>{0.723193407f, 0.588828027f},
-std::array<float,2>{0.255664974f, 0.405032516f},
-std::array<float,2>{0.44724068f, 0.940943062f},
-std::array<float,2>{0.537890673f, 0.0172485691f},
-std::array<float,2>{0.879791439f, 0.513354599f},
-std::array<float,2>{0.230307773f, 0.499916732f},
-std::array<float,2>{0.002296953f, 0.632202625f},
-std::array<float,2>{0.84351182f, 0.291025639f},
-std::array<float,2>{0.629050314f, 0.859601319f},
-std::array<float,2>{0.320667893f, 0.232347444f},
-std::array<float,2>{0.292474151f, 0.603896201f},
-std::array<float,2>{0.692491651f, 0.408342242f},
-std::array<float,2>{0.797989309f, 0.896861434f},
-std::array<float,2>{0.112567335f, 0.0735147893f},
-std::array<float,2>{0.14188914f, 0.782068253f},
-std::array<float,2>{0.998840213f, 0.125993699f},
-std::array<float,2>{0.571130991f, 0.69648695f},
-std::array<float,2>{0.436048239f, 0.313588411f},
-std::array<float,2>{0.492029071f, 0.868828833f},
-std::array<float,2>{0.50554955f, 0.226310596f},
-std::array<float,2>{0.908193052f, 0.639488399f},
-std::array<float,2>{0.218289122f, 0.282734543f},
-std::array<float,2>{0.0544329025f, 0.507713795f},
-std::array<float,2>{0.853968441f, 0.492156476f},
-std::array<float,2>{0.670057595f, 0.952657998f},
-std::array<float,2>{0.344423473f, 0.0267154425f},
-std::array<float,2>{0.259390503f, 0.690139234f},
-std::array<float,2>{0.731698513f, 0.321738333f},
-std::array<float,2>{0.77918154f, 0.79275322f},
-std::array<float,2>{0.0898703709f, 0.134836718f},
-std::array<float,2>{0.182872355f, 0.899580359f},
-std::array<float,2>{0.951861203f, 0.0637301654f},
-std::array<float,2>{0.607347131f, 0.597582459f},
-std::array<float,2>{0.375999004f, 0.418671548f},
-std::array<float,2>{0.315951198f, 0.994051695f},
-std::array<float,2>{0.63930732f, 0.0316412225f},
-std::array<float,2>{0.832983792f, 0.551009655f},
-std::array<float,2>{0.0101194698f, 0.467376888f},
-std::array<float,2>{0.219162986f, 0.665602803f},
-std::array<float,2>{0.886580527f, 0.277940452f},
-std::array<float,2>{0.542884767f, 0.825640619f},
-std::array<float,2>{0.442530334f, 0.210024968f},
-std::array<float,2>{0.42410171f, 0.581745088f},
-std::array<float,2>{0.568785369f, 0.397764325f},
-std::array<float,2>{0.988419473f, 0.917628706f},
-std::array<float,2>{0.150465503f, 0.111396611f},
-std::array<float,2>{0.120354675f, 0.776370943f},
-std::array<float,2>{0.807308257f, 0.162887201f},
-std::array<float,2>{0.698993504f, 0.741952062f},
-std::array<float,2>{0.282706082f, 0.374713928f},
-std::array<float,2>{0.298321784f, 0.805726647f},
-std::array<float,2>{0.711795866f, 0.149243489f},
-std::array<float,2>{0.784991562f, 0.707282603f},
-std::array<float,2>{0.10185241f, 0.337442547f},
-std::array<float,2>{0.132365078f, 0.620784223f},
-std::array<float,2>{0.976615906f, 0.430026531f},
-std::array<float,2>{0.588484228f, 0.875133157f},
-std::array<float,2>{0.409088522f, 0.0788330808f},
-std::array<float,2>{0.453561395f, 0.646443248f},
-std::array<float,2>{0.54987222f, 0.297959745f},
-std::array<float,2>{0.903772414f, 0.846766353f},
-std::array<float,2>{0.248622298f, 0.237912908f},
-std::array<float,2>{0.0157421175f, 0.963525057f},
-std::array<float,2>{0.822423995f, 0.00591851771f},
-std::array<float,2>{0.644958496f, 0.520005047f},
-std::array<float,2>{0.34368062f, 0.483644247f},
-std::array<float,2>{0.391357213f, 0.922840297f},
-std::array<float,2>{0.617605805f, 0.0966167077f},
-std::array<float,2>{0.965389967f, 0.573963821f},
-std::array<float,2>{0.161335602f, 0.380204737f},
-std::array<float,2>{0.0654303208f, 0.728118122f},
-std::array<float,2>{0.761490464f, 0.346377045f},
-std::array<float,2>{0.745396554f, 0.758221745f},
-std::array<float,2>{0.275319576f, 0.174306765f},
-std::array<float,2>{0.373892725f, 0.537116885f},
-std::array<float,2>{0.687236845f, 0.439299017f},
-std::array<float,2>{0.870657742f, 0.982350647f},
-std::array<float,2>{0.0421062857f, 0.0469038524f},
-std::array<float,2>{0.189382434f, 0.839034736f},
-std::array<float,2>{0.925047755f, 0.190765977f},
-std::array<float,2>{0.52811265f, 0.687105119f},
-std::array<float,2>{0.479605436f, 0.259285808f},
-std::array<float,2>{0.395483702f, 0.863883197f},
-std::array<float,2>{0.624594688f, 0.228800505f},
-std::array<float,2>{0.963486552f, 0.626744807f},
-std::array<float,2>{0.156423792f, 0.293475419f},
-std::array<float,2>{0.068730399f, 0.508359551f},
-std::array<float,2>{0.762461841f, 0.49608928f},
-std::array<float,2>{0.749292016f, 0.94286418f},
-std::array<float,2>{0.280336559f, 0.0211066213f},
-std::array<float,2>{0.369014859f, 0.701517105f},
-std::array<float,2>{0.682940483f, 0.317239165f},
-std::array<float,2>{0.872348905f, 0.785457432f},
-std::array<float,2>{0.0467051938f, 0.132208198f},
-std::array<float,2>{0.19460687f, 0.890643656f},
-std::array<float,2>{0.92936182f, 0.075430125f},
-std::array<float,2>{0.523646533f, 0.605751991f},
-std::array<float,2>{0.483250409f, 0.411500812f},
-std::array<float,2>{0.302797258f, 0.989693284f},
-std::array<float,2>{0.71718961f, 0.0434936471f},
-std::array<float,2>{0.785552323f, 0.557991922f},
-std::array<float,2>{0.1072478f, 0.45540458f},
-std::array<float,2>{0.125171497f, 0.659397721f},
-std::array<float,2>{0.983223975f, 0.26776123f},
-std::array<float,2>{0.590077937f, 0.816700697f},
-std::array<float,2>{0.411453217f, 0.21169883f},
-std::array<float,2>{0.45899421f, 0.593443751f},
-std::array<float,2>{0.554586291f, 0.399345577f},
-std::array<float,2>{0.899802983f, 0.906659186f},
-std::array<float,2>{0.243394852f, 0.119149901f},
-std::array<float,2>{0.0206396487f, 0.766546547f},
-std::array<float,2>{0.824284375f, 0.168166235f},
-std::array<float,2>{0.642452776f, 0.746326685f},
-std::array<float,2>{0.339618564f, 0.36256364f},
-std::array<float,2>{0.316705436f, 0.801922858f},
-std::array<float,2>{0.63408047f, 0.144762516f},
-std::array<float,2>{0.83192414f, 0.718294144f},
-std::array<float,2>{0.0149632469f, 0.330177337f},
-std::array<float,2>{0.223749205f, 0.610129178f},
-std::array<float,2>{0.889503896f, 0.429428577f},
-std::array<float,2>{0.545347273f, 0.889000058f},
-std::array<float,2>{0.440192938f, 0.0921988785f},
-std::array<float,2>{0.429679036f, 0.652478576f},
-std::array<float,2>{0.564427614f, 0.310751796f},
-std::array<float,2>{0.985823452f, 0.855765522f},
-std::array<float,2>{0.155853286f, 0.244925708f},
-std::array<float,2>{0.123099834f, 0.953581154f},
-std::array<float,2>{0.80916065f, 0.0150241954f},
-std::array<float,2>{0.702453673f, 0.529559255f},
-std::array<float,2>{0.285814613f, 0.472366631f},
-std::array<float,2>{0.48512736f, 0.93194145f},
-std::array<float,2>{0.50077188f, 0.103753358f},
-std::array<float,2>{0.91321975f, 0.566582084f},
-std::array<float,2>{0.212704986f, 0.385111064f},
-std::array<float,2>{0.0503021739f, 0.724955201f},
-std::array<float,2>{0.857806027f, 0.352000773f},
-std::array<float,2>{0.664523482f, 0.7562024f},
-std::array<float,2>{0.348383427f, 0.179961577f},
-std::array<float,2>{0.264337152f, 0.545269012f},
-std::array<float,2>{0.726868272f, 0.44855395f},
-std::array<float,2>{0.774099708f, 0.97254318f},
-std::array<float,2>{0.0877190158f, 0.0583856963f},
-std::array<float,2>{0.187331915f, 0.830218196f},
-std::array<float,2>{0.948673308f, 0.19754754f},
-std::array<float,2>{0.605111003f, 0.672649205f},
-std::array<float,2>{0.382423699f, 0.254836023f},
-std::array<float,2>{0.452250183f, 0.762845278f},
-std::array<float,2>{0.531876683f, 0.178699389f},
-std::array<float,2>{0.876074374f, 0.733673632f},
-std::array<float,2>{0.232012749f, 0.349097401f},
-std::array<float,2>{0.00502374023f, 0.574278951f},
-std::array<float,2>{0.836325884f, 0.378102213f},
-std::array<float,2>{0.627574146f, 0.928872108f},
-std::array<float,2>{0.324907213f, 0.0994309634f},
-std::array<float,2>{0.295032322f, 0.681439102f},
-std::array<float,2>{0.687749982f, 0.265158027f},
-std::array<float,2>{0.80330801f, 0.840918243f},
-std::array<float,2>{0.116068006f, 0.193092898f},
-std::array<float,2>{0.147474915f, 0.977556884f},
-std::array<float,2>{0.992404938f, 0.0520928167f},
-std::array<float,2>{0.577525914f, 0.53156209f},
-std::array<float,2>{0.430915117f, 0.442426085f},
-std::array<float,2>{0.359188527f, 0.880422711f},
-std::array<float,2>{0.658829212f, 0.0848377571f},
-std::array<float,2>{0.851099193f, 0.623576045f},
-std::array<float,2>{0.058917705f, 0.436628014f},
-std::array<float,2>{0.210776389f, 0.705889225f},
-std::array<float,2>{0.919864714f, 0.34201932f},
-std::array<float,2>{0.514506698f, 0.810812294f},
-std::array<float,2>{0.499180526f, 0.15363355f},
-std::array<float,2>{0.388986051f, 0.519394338f},
-std::array<float,2>{0.595921695f, 0.479548514f},
-std::array<float,2>{0.943466067f, 0.96823138f},
-std::array<float,2>{0.179253861f, 0.000381717226f},
-std::array<float,2>{0.0859122351f, 0.851234615f},
-std::array<float,2>{0.770475745f, 0.240499422f},
-std::array<float,2>{0.722425938f, 0.641049981f},
-std::array<float,2>{0.25116688f, 0.303615928f},
-std::array<float,2>{0.267645985f, 0.823104441f},
-std::array<float,2>{0.736368775f, 0.203980893f},
-std::array<float,2>{0.750831306f, 0.67072463f},
-std::array<float,2>{0.0718821511f, 0.2743527f},
-std::array<float,2>{0.170076355f, 0.550312579f},
-std::array<float,2>{0.959430516f, 0.462254792f},
-std::array<float,2>{0.61552f, 0.999863744f},
-std::array<float,2>{0.403599143f, 0.0370328277f},
-std::array<float,2>{0.473214865f, 0.736157775f},
-std::array<float,2>{0.518971264f, 0.369349718f},
-std::array<float,2>{0.929763675f, 0.779806674f},
-std::array<float,2>{0.195415735f, 0.158877701f},
-std::array<float,2>{0.0358537398f, 0.921796203f},
-std::array<float,2>{0.866939127f, 0.116214834f},
-std::array<float,2>{0.677949667f, 0.582878649f},
-std::array<float,2>{0.360868424f, 0.390820146f},
-std::array<float,2>{0.4195126f, 0.948965132f},
-std::array<float,2>{0.585889459f, 0.0273634531f},
-std::array<float,2>{0.973249316f, 0.501228094f},
-std::array<float,2>{0.132933065f, 0.486971021f},
-std::array<float,2>{0.0978096575f, 0.635249913f},
-std::array<float,2>{0.79352963f, 0.288009971f},
-std::array<float,2>{0.703644633f, 0.872878075f},
-std::array<float,2>{0.308354616f, 0.220647633f},
-std::array<float,2>{0.335370272f, 0.597676218f},
-std::array<float,2>{0.650747597f, 0.414774179f},
-std::array<float,2>{0.81916064f, 0.905194283f},
-std::array<float,2>{0.0282349102f, 0.0691218898f},
-std::array<float,2>{0.239201233f, 0.795846343f},
-std::array<float,2>{0.892037094f, 0.139192909f},
-std::array<float,2>{0.558877468f, 0.69244051f},
-std::array<float,2>{0.463630646f, 0.326946527f},
-std::array<float,2>{0.436720699f, 0.784326971f},
-std::array<float,2>{0.571676552f, 0.128446728f},
-std::array<float,2>{0.999578655f, 0.698250055f},
-std::array<float,2>{0.141513661f, 0.315798491f},
-std::array<float,2>{0.112299025f, 0.602392793f},
-std::array<float,2>{0.797614455f, 0.407438874f},
-std::array<float,2>{0.69217211f, 0.895696342f},
-std::array<float,2>{0.291239172f, 0.0717325732f},
-std::array<float,2>{0.321334124f, 0.630419672f},
-std::array<float,2>{0.630481958f, 0.289199263f},
-std::array<float,2>{0.84201628f, 0.862680435f},
-std::array<float,2>{0.00382983452f, 0.233615398f},
-std::array<float,2>{0.228759408f, 0.937871575f},
-std::array<float,2>{0.880063832f, 0.0191791151f},
-std::array<float,2>{0.538369536f, 0.514717758f},
-std::array<float,2>{0.445565909f, 0.496299654f},
-std::array<float,2>{0.254386753f, 0.91072768f},
-std::array<float,2>{0.724031687f, 0.123211339f},
-std::array<float,2>{0.767839789f, 0.586699307f},
-std::array<float,2>{0.0783141628f, 0.403225183f},
-std::array<float,2>{0.17394796f, 0.74340409f},
-std::array<float,2>{0.938081622f, 0.363417953f},
-std::array<float,2>{0.600736439f, 0.77216953f},
-std::array<float,2>{0.385829031f, 0.164506838f},
-std::array<float,2>{0.494907975f, 0.561092615f},
-std::array<float,2>{0.510143697f, 0.460178465f},
-std::array<float,2>{0.917657852f, 0.987225294f},
-std::array<float,2>{0.203937903f, 0.0416217893f},
-std::array<float,2>{0.0579147525f, 0.815539837f},
-std::array<float,2>{0.844353676f, 0.218341425f},
-std::array<float,2>{0.660196602f, 0.663114786f},
-std::array<float,2>{0.353459895f, 0.270058334f},
-std::array<float,2>{0.365832686f, 0.85361892f},
-std::array<float,2>{0.675546288f, 0.248303533f},
-std::array<float,2>{0.861180663f, 0.652248859f},
-std::array<float,2>{0.0330201127f, 0.305219233f},
-std::array<float,2>{0.201575547f, 0.523741186f},
-std::array<float,2>{0.934049785f, 0.47502625f},
-std::array<float,2>{0.520675659f, 0.958499253f},
-std::array<float,2>{0.470404565f, 0.00815539621f},
-std::array<float,2>{0.398823291f, 0.711040735f},
-std::array<float,2>{0.611738801f, 0.332853496f},
-std::array<float,2>{0.955711663f, 0.800393283f},
-std::array<float,2>{0.166165039f, 0.14077881f},
-std::array<float,2>{0.076208733f, 0.886525035f},
-std::array<float,2>{0.754712939f, 0.0881382376f},
-std::array<float,2>{0.73934114f, 0.614178121f},
-std::array<float,2>{0.272734612f, 0.425136209f},
-std::array<float,2>{0.468573362f, 0.973971009f},
-std::array<float,2>{0.557214618f, 0.0599621534f},
-std::array<float,2>{0.898433626f, 0.541436136f},
-std::array<float,2>{0.238001198f, 0.449743658f},
-std::array<float,2>{0.0246225838f, 0.679521263f},
-std::array<float,2>{0.81331569f, 0.252387285f},
-std::array<float,2>{0.654864311f, 0.835012853f},
-std::array<float,2>{0.330292344f, 0.202455431f},
-std::array<float,2>{0.311843842f, 0.566013455f},
-std::array<float,2>{0.709717989f, 0.387204558f},
-std::array<float,2>{0.789304495f, 0.936302185f},
-std::array<float,2>{0.0955414996f, 0.107955143f},
-std::array<float,2>{0.138026506f, 0.753802836f},
-std::array<float,2>{0.971267462f, 0.185856745f},
-std::array<float,2>{0.579625964f, 0.720495224f},
-std::array<float,2>{0.41541642f, 0.355683982f},
-std::array<float,2>{0.479415566f, 0.836595118f},
-std::array<float,2>{0.528967798f, 0.188672036f},
-std::array<float,2>{0.924503803f, 0.684638381f},
-std::array<float,2>{0.188169792f, 0.261178732f},
-std::array<float,2>{0.0416950732f, 0.53681314f},
-std::array<float,2>{0.86938262f, 0.440035909f},
-std::array<float,2>{0.686161041f, 0.983532906f},
-std::array<float,2>{0.374086797f, 0.049000185f},
-std::array<float,2>{0.273613036f, 0.729247212f},
-std::array<float,2>{0.745091259f, 0.344939083f},
-std::array<float,2>{0.760572195f, 0.761576533f},
-std::array<float,2>{0.0653455183f, 0.172906414f},
-std::array<float,2>{0.160853028f, 0.925753117f},
-std::array<float,2>{0.966000736f, 0.0947791114f},
-std::array<float,2>{0.618644536f, 0.571000397f},
-std::array<float,2>{0.392491579f, 0.382210672f},
-std::array<float,2>{0.341834277f, 0.960979223f},
-std::array<float,2>{0.646159947f, 0.00476366561f},
-std::array<float,2>{0.824152052f, 0.521963894f},
-std::array<float,2>{0.0167356636f, 0.481019825f},
-std::array<float,2>{0.249142498f, 0.647931278f},
-std::array<float,2>{0.90237242f, 0.299614072f},
-std::array<float,2>{0.549366951f, 0.845370591f},
-std::array<float,2>{0.454460412f, 0.235049188f},
-std::array<float,2>{0.409363329f, 0.617437005f},
-std::array<float,2>{0.589274883f, 0.433440685f},
-std::array<float,2>{0.978336394f, 0.878617585f},
-std::array<float,2>{0.13097471f, 0.0803843886f},
-std::array<float,2>{0.103016056f, 0.80808413f},
-std::array<float,2>{0.78372848f, 0.150607005f},
-std::array<float,2>{0.712319136f, 0.710658014f},
-std::array<float,2>{0.297544032f, 0.338298142f},
-std::array<float,2>{0.281681776f, 0.77351743f},
-std::array<float,2>{0.697547734f, 0.161115885f},
-std::array<float,2>{0.808367908f, 0.738405943f},
-std::array<float,2>{0.119487956f, 0.372342348f},
-std::array<float,2>{0.151819289f, 0.578293502f},
-std::array<float,2>{0.989822865f, 0.395139694f},
-std::array<float,2>{0.569895208f, 0.915242195f},
-std::array<float,2>{0.424892992f, 0.110556364f},
-std::array<float,2>{0.441468447f, 0.666396916f},
-std::array<float,2>{0.541334033f, 0.279928952f},
-std::array<float,2>{0.885230601f, 0.827407837f},
-std::array<float,2>{0.220085219f, 0.208868146f},
-std::array<float,2>{0.01106284f, 0.995273948f},
-std::array<float,2>{0.833484352f, 0.035075102f},
-std::array<float,2>{0.639980912f, 0.553453088f},
-std::array<float,2>{0.315070629f, 0.466393054f},
-std::array<float,2>{0.375618935f, 0.90050441f},
-std::array<float,2>{0.605881155f, 0.0646582469f},
-std::array<float,2>{0.952610791f, 0.594590843f},
-std::array<float,2>{0.182603836f, 0.421043515f},
-std::array<float,2>{0.0916456133f, 0.689171612f},
-std::array<float,2>{0.778280854f, 0.32369107f},
-std::array<float,2>{0.730838299f, 0.790884256f},
-std::array<float,2>{0.258414954f, 0.133726269f},
-std::array<float,2>{0.345183104f, 0.505594492f},
-std::array<float,2>{0.671056926f, 0.489257127f},
-std::array<float,2>{0.854614854f, 0.950934589f},
-std::array<float,2>{0.0529371127f, 0.024631571f},
-std::array<float,2>{0.216911867f, 0.870936096f},
-std::array<float,2>{0.906882584f, 0.223758966f},
-std::array<float,2>{0.504133403f, 0.636787772f},
-std::array<float,2>{0.490935504f, 0.284210235f},
-std::array<float,2>{0.412200838f, 0.818851888f},
-std::array<float,2>{0.593491137f, 0.212902039f},
-std::array<float,2>{0.980687022f, 0.658125818f},
-std::array<float,2>{0.128698915f, 0.266140282f},
-std::array<float,2>{0.107579015f, 0.555194855f},
-std::array<float,2>{0.788384259f, 0.453471243f},
-std::array<float,2>{0.7149809f, 0.991669714f},
-std::array<float,2>{0.302426904f, 0.0465502478f},
-std::array<float,2>{0.33650285f, 0.748211265f},
-std::array<float,2>{0.643758476f, 0.360241503f},
-std::array<float,2>{0.827553749f, 0.768278122f},
-std::array<float,2>{0.0223970171f, 0.171240196f},
-std::array<float,2>{0.244417906f, 0.909350216f},
-std::array<float,2>{0.900728285f, 0.11796163f},
-std::array<float,2>{0.551897824f, 0.590091944f},
-std::array<float,2>{0.457346588f, 0.401629359f},
-std::array<float,2>{0.278847903f, 0.943386555f},
-std::array<float,2>{0.746422648f, 0.0224461276f},
-std::array<float,2>{0.764216661f, 0.510892391f},
-std::array<float,2>{0.0665290207f, 0.492420316f},
-std::array<float,2>{0.158899426f, 0.627121985f},
-std::array<float,2>{0.961443841f, 0.296867549f},
-std::array<float,2>{0.621284246f, 0.866277874f},
-std::array<float,2>{0.398101777f, 0.228327185f},
-std::array<float,2>{0.48179698f, 0.608093679f},
-std::array<float,2>{0.52662009f, 0.413080454f},
-std::array<float,2>{0.926324129f, 0.893376827f},
-std::array<float,2>{0.19254972f, 0.0761782676f},
-std::array<float,2>{0.0444051474f, 0.788058877f},
-std::array<float,2>{0.8743788f, 0.12978898f},
-std::array<float,2>{0.681079209f, 0.699779153f},
-std::array<float,2>{0.369704306f, 0.318679333f},
-std::array<float,2>{0.350817144f, 0.754056752f},
-std::array<float,2>{0.667405069f, 0.181822956f},
-std::array<float,2>{0.855527401f, 0.723959386f},
-std::array<float,2>{0.0474753641f, 0.35512045f},
-std::array<float,2>{0.214520991f, 0.56941098f},
-std::array<float,2>{0.911339164f, 0.383226156f},
-std::array<float,2>{0.502139747f, 0.930414498f},
-std::array<float,2>{0.486673862f, 0.10208644f},
-std::array<float,2>{0.379554838f, 0.674993336f},
-std::array<float,2>{0.601672232f, 0.257499129f},
-std::array<float,2>{0.946310937f, 0.82990855f},
-std::array<float,2>{0.184476793f, 0.196829766f},
-std::array<float,2>{0.0888095722f, 0.969675839f},
-std::array<float,2>{0.775471866f, 0.054945007f},
-std::array<float,2>{0.729070365f, 0.544796407f},
-std::array<float,2>{0.261816621f, 0.447251409f},
-std::array<float,2>{0.437553823f, 0.88749826f},
-std::array<float,2>{0.544774055f, 0.0901410505f},
-std::array<float,2>{0.88832891f, 0.612887084f},
-std::array<float,2>{0.225868568f, 0.426443368f},
-std::array<float,2>{0.0128933135f, 0.715468109f},
-std::array<float,2>{0.829569757f, 0.329078346f},
-std::array<float,2>{0.636702299f, 0.804661632f},
-std::array<float,2>{0.319356233f, 0.147120088f},
-std::array<float,2>{0.287984639f, 0.528441668f},
-std::array<float,2>{0.700186372f, 0.470501214f},
-std::array<float,2>{0.811104715f, 0.95530206f},
-std::array<float,2>{0.121265918f, 0.0122993691f},
-std::array<float,2>{0.153598145f, 0.85804081f},
-std::array<float,2>{0.987538338f, 0.243581638f},
-std::array<float,2>{0.565539241f, 0.655454695f},
-std::array<float,2>{0.426257879f, 0.309454471f},
-std::array<float,2>{0.497478813f, 0.810492218f},
-std::array<float,2>{0.513387501f, 0.15493004f},
-std::array<float,2>{0.92120862f, 0.703828096f},
-std::array<float,2>{0.208082065f, 0.339959621f},
-std::array<float,2>{0.0614755228f, 0.622868717f},
-std::array<float,2>{0.849085629f, 0.434747189f},
-std::array<float,2>{0.657446623f, 0.881311953f},
-std::array<float,2>{0.35715121f, 0.0838502571f},
-std::array<float,2>{0.252431035f, 0.644527614f},
-std::array<float,2>{0.718987107f, 0.302467436f},
-std::array<float,2>{0.772316813f, 0.848442137f},
-std::array<float,2>{0.0827998146f, 0.238385469f},
-std::array<float,2>{0.176453263f, 0.966191947f},
-std::array<float,2>{0.942405164f, 0.00322241383f},
-std::array<float,2>{0.594351828f, 0.516548872f},
-std::array<float,2>{0.388388872f, 0.477561325f},
-std::array<float,2>{0.327671796f, 0.9275949f},
-std::array<float,2>{0.626134396f, 0.100533985f},
-std::array<float,2>{0.839326382f, 0.576835036f},
-std::array<float,2>{0.00652248319f, 0.376873374f},
-std::array<float,2>{0.233802766f, 0.731044054f},
-std::array<float,2>{0.878660023f, 0.349822879f},
-std::array<float,2>{0.533627629f, 0.763923585f},
-std::array<float,2>{0.449528813f, 0.177537784f},
-std::array<float,2>{0.433114916f, 0.533533037f},
-std::array<float,2>{0.575791121f, 0.444288969f},
-std::array<float,2>{0.995698392f, 0.980034709f},
-std::array<float,2>{0.146140561f, 0.053876169f},
-std::array<float,2>{0.114398688f, 0.842529953f},
-std::array<float,2>{0.801353157f, 0.194299683f},
-std::array<float,2>{0.69068408f, 0.682257414f},
-std::array<float,2>{0.294575155f, 0.262613416f},
-std::array<float,2>{0.306590647f, 0.873589456f},
-std::array<float,2>{0.706441343f, 0.221920565f},
-std::array<float,2>{0.796711326f, 0.633778453f},
-std::array<float,2>{0.101018056f, 0.286470801f},
-std::array<float,2>{0.135836318f, 0.503123343f},
-std::array<float,2>{0.975848615f, 0.485439509f},
-std::array<float,2>{0.583788335f, 0.94537884f},
-std::array<float,2>{0.420761645f, 0.0302591287f},
-std::array<float,2>{0.461111814f, 0.694862008f},
-std::array<float,2>{0.561607659f, 0.325619161f},
-std::array<float,2>{0.893128455f, 0.793694258f},
-std::array<float,2>{0.240641326f, 0.137306973f},
-std::array<float,2>{0.0296976846f, 0.903273523f},
-std::array<float,2>{0.817678392f, 0.0666977316f},
-std::array<float,2>{0.648777783f, 0.601403832f},
-std::array<float,2>{0.333749473f, 0.417623073f},
-std::array<float,2>{0.405028105f, 0.996703506f},
-std::array<float,2>{0.614366949f, 0.0379928052f},
-std::array<float,2>{0.957352638f, 0.547670841f},
-std::array<float,2>{0.16877611f, 0.463914186f},
-std::array<float,2>{0.0725876838f, 0.669021249f},
-std::array<float,2>{0.752728164f, 0.276626289f},
-std::array<float,2>{0.735510647f, 0.820393085f},
-std::array<float,2>{0.267192274f, 0.206310377f},
-std::array<float,2>{0.36246559f, 0.58568418f},
-std::array<float,2>{0.677403808f, 0.393213779f},
-std::array<float,2>{0.863932312f, 0.917982101f},
-std::array<float,2>{0.0380633585f, 0.113586567f},
-std::array<float,2>{0.197799221f, 0.778398931f},
-std::array<float,2>{0.932937622f, 0.156466752f},
-std::array<float,2>{0.516404867f, 0.736828864f},
-std::array<float,2>{0.475817144f, 0.367336869f},
-std::array<float,2>{0.384538889f, 0.76961112f},
-std::array<float,2>{0.598764777f, 0.166551843f},
-std::array<float,2>{0.941115737f, 0.744241416f},
-std::array<float,2>{0.173715115f, 0.366794109f},
-std::array<float,2>{0.0818772167f, 0.58887291f},
-std::array<float,2>{0.765670478f, 0.406128734f},
-std::array<float,2>{0.726163685f, 0.913197637f},
-std::array<float,2>{0.256424457f, 0.121259779f},
-std::array<float,2>{0.354592234f, 0.660537183f},
-std::array<float,2>{0.664021611f, 0.271627188f},
-std::array<float,2>{0.84746325f, 0.813782096f},
-std::array<float,2>{0.0550211854f, 0.214983687f},
-std::array<float,2>{0.206709385f, 0.984587967f},
-std::array<float,2>{0.914241135f, 0.0405671038f},
-std::array<float,2>{0.508546114f, 0.559375286f},
-std::array<float,2>{0.493443549f, 0.458030343f},
-std::array<float,2>{0.290203482f, 0.897909999f},
-std::array<float,2>{0.694418907f, 0.0729010478f},
-std::array<float,2>{0.799683213f, 0.604536116f},
-std::array<float,2>{0.110802703f, 0.409968674f},
-std::array<float,2>{0.144251212f, 0.695573509f},
-std::array<float,2>{0.997930229f, 0.312799871f},
-std::array<float,2>{0.572774649f, 0.782858014f},
-std::array<float,2>{0.43385601f, 0.125623569f},
-std::array<float,2>{0.448921591f, 0.512350619f},
-std::array<float,2>{0.536278129f, 0.498872727f},
-std::array<float,2>{0.882009506f, 0.939565063f},
-std::array<float,2>{0.227746263f, 0.0163097531f},
-std::array<float,2>{0.00189035281f, 0.861184835f},
-std::array<float,2>{0.84094888f, 0.230925158f},
-std::array<float,2>{0.631462097f, 0.631656647f},
-std::array<float,2>{0.323392004f, 0.292480707f},
-std::array<float,2>{0.32844159f, 0.832742393f},
-std::array<float,2>{0.654063225f, 0.200502753f},
-std::array<float,2>{0.815662086f, 0.677662969f},
-std::array<float,2>{0.026230149f, 0.251607537f},
-std::array<float,2>{0.23485966f, 0.540784955f},
-std::array<float,2>{0.895278811f, 0.452752739f},
-std::array<float,2>{0.556323469f, 0.975746095f},
-std::array<float,2>{0.466447115f, 0.0624607243f},
-std::array<float,2>{0.417373478f, 0.721960008f},
-std::array<float,2>{0.580501318f, 0.358514756f},
-std::array<float,2>{0.969885588f, 0.751140714f},
-std::array<float,2>{0.13960509f, 0.184898779f},
-std::array<float,2>{0.0976536348f, 0.935384691f},
-std::array<float,2>{0.791042089f, 0.106231242f},
-std::array<float,2>{0.707222819f, 0.563218236f},
-std::array<float,2>{0.310305506f, 0.38886717f},
-std::array<float,2>{0.471097976f, 0.959272325f},
-std::array<float,2>{0.522848964f, 0.0100175152f},
-std::array<float,2>{0.937465906f, 0.526386499f},
-std::array<float,2>{0.201062351f, 0.473651588f},
-std::array<float,2>{0.0335000902f, 0.649883747f},
-std::array<float,2>{0.861422658f, 0.306988239f},
-std::array<float,2>{0.672160268f, 0.851811111f},
-std::array<float,2>{0.36330542f, 0.247737333f},
-std::array<float,2>{0.270524561f, 0.616956592f},
-std::array<float,2>{0.741499364f, 0.422352105f},
-std::array<float,2>{0.757476926f, 0.884384453f},
-std::array<float,2>{0.0752856135f, 0.0865098983f},
-std::array<float,2>{0.164638638f, 0.798295438f},
-std::array<float,2>{0.953445911f, 0.142982394f},
-std::array<float,2>{0.611236751f, 0.7140522f},
-std::array<float,2>{0.401912212f, 0.334770769f},
-std::array<float,2>{0.456785679f, 0.845959127f},
-std::array<float,2>{0.548774183f, 0.236742005f},
-std::array<float,2>{0.906124949f, 0.645016372f},
-std::array<float,2>{0.247216299f, 0.297121167f},
-std::array<float,2>{0.0186332762f, 0.521455884f},
-std::array<float,2>{0.820503414f, 0.483213782f},
-std::array<float,2>{0.647969484f, 0.964614511f},
-std::array<float,2>{0.341244221f, 0.00703766989f},
-std::array<float,2>{0.300442606f, 0.708853126f},
-std::array<float,2>{0.714171648f, 0.336683929f},
-std::array<float,2>{0.782289684f, 0.805131078f},
-std::array<float,2>{0.10378255f, 0.150175452f},
-std::array<float,2>{0.130413309f, 0.876098931f},
-std::array<float,2>{0.978906691f, 0.0796626657f},
-std::array<float,2>{0.587666929f, 0.619848907f},
-std::array<float,2>{0.408110738f, 0.430996746f},
-std::array<float,2>{0.372881621f, 0.981215894f},
-std::array<float,2>{0.685108542f, 0.0485782996f},
-std::array<float,2>{0.86902684f, 0.538853586f},
-std::array<float,2>{0.0409852378f, 0.437981874f},
-std::array<float,2>{0.191103056f, 0.685959399f},
-std::array<float,2>{0.923702836f, 0.25822252f},
-std::array<float,2>{0.531000912f, 0.838466465f},
-std::array<float,2>{0.476581991f, 0.189940855f},
-std::array<float,2>{0.394038647f, 0.57244885f},
-std::array<float,2>{0.619686127f, 0.379205346f},
-std::array<float,2>{0.968229949f, 0.923694015f},
-std::array<float,2>{0.163026437f, 0.0972186103f},
-std::array<float,2>{0.0633258596f, 0.759691834f},
-std::array<float,2>{0.758160889f, 0.175669417f},
-std::array<float,2>{0.743734419f, 0.727475345f},
-std::array<float,2>{0.276968956f, 0.347549707f},
-std::array<float,2>{0.260632962f, 0.791410863f},
-std::array<float,2>{0.732619941f, 0.136104107f},
-std::array<float,2>{0.779884219f, 0.690717041f},
-std::array<float,2>{0.0922437757f, 0.321078092f},
-std::array<float,2>{0.180165425f, 0.595752835f},
-std::array<float,2>{0.950308859f, 0.419149637f},
-std::array<float,2>{0.608852983f, 0.898931324f},
-std::array<float,2>{0.378378928f, 0.0626559779f},
-std::array<float,2>{0.489046544f, 0.640266478f},
-std::array<float,2>{0.505960226f, 0.281565964f},
-std::array<float,2>{0.909430146f, 0.867456853f},
-std::array<float,2>{0.215183735f, 0.225080028f},
-std::array<float,2>{0.0512568913f, 0.952142835f},
-std::array<float,2>{0.852584362f, 0.0261850972f},
-std::array<float,2>{0.669379473f, 0.506190658f},
-std::array<float,2>{0.346361876f, 0.490257144f},
-std::array<float,2>{0.422562838f, 0.916755021f},
-std::array<float,2>{0.567850173f, 0.112469055f},
-std::array<float,2>{0.990312338f, 0.580261409f},
-std::array<float,2>{0.148441046f, 0.396834403f},
-std::array<float,2>{0.117510639f, 0.740338445f},
-std::array<float,2>{0.8050403f, 0.373200983f},
-std::array<float,2>{0.695531726f, 0.77555865f},
-std::array<float,2>{0.28504777f, 0.16322124f},
-std::array<float,2>{0.312905639f, 0.55196476f},
-std::array<float,2>{0.637534022f, 0.468462765f},
-std::array<float,2>{0.834197521f, 0.99291271f},
-std::array<float,2>{0.00935503468f, 0.0322534032f},
-std::array<float,2>{0.222379774f, 0.824861526f},
-std::array<float,2>{0.883929372f, 0.209078386f},
-std::array<float,2>{0.540908754f, 0.664360583f},
-std::array<float,2>{0.445280045f, 0.278517634f},
-std::array<float,2>{0.419933856f, 0.872077525f},
-std::array<float,2>{0.583411694f, 0.220103204f},
-std::array<float,2>{0.976506412f, 0.635271728f},
-std::array<float,2>{0.136235133f, 0.287481606f},
-std::array<float,2>{0.101267755f, 0.501594901f},
-std::array<float,2>{0.795985937f, 0.486474723f},
-std::array<float,2>{0.706806123f, 0.948436439f},
-std::array<float,2>{0.306047618f, 0.027985448f},
-std::array<float,2>{0.333037674f, 0.69289583f},
-std::array<float,2>{0.649003327f, 0.326423645f},
-std::array<float,2>{0.818323553f, 0.79513377f},
-std::array<float,2>{0.0301029757f, 0.138700619f},
-std::array<float,2>{0.24117361f, 0.904692948f},
-std::array<float,2>{0.892600358f, 0.0684049651f},
-std::array<float,2>{0.562230349f, 0.59847635f},
-std::array<float,2>{0.461802751f, 0.414188385f},
-std::array<float,2>{0.26676023f, 0.99917978f},
-std::array<float,2>{0.736239433f, 0.0365125872f},
-std::array<float,2>{0.752402008f, 0.550041258f},
-std::array<float,2>{0.0729930103f, 0.46284011f},
-std::array<float,2>{0.16844593f, 0.669926584f},
-std::array<float,2>{0.957750201f, 0.273631871f},
-std::array<float,2>{0.615014374f, 0.822633624f},
-std::array<float,2>{0.404354304f, 0.203353375f},
-std::array<float,2>{0.476449668f, 0.582190335f},
-std::array<float,2>{0.515876174f, 0.391273677f},
-std::array<float,2>{0.933466971f, 0.921081901f},
-std::array<float,2>{0.197520509f, 0.117073998f},
-std::array<float,2>{0.0375053585f, 0.779318631f},
-std::array<float,2>{0.863580704f, 0.158409312f},
-std::array<float,2>{0.677223861f, 0.735497594f},
-std::array<float,2>{0.363264382f, 0.369916946f},
-std::array<float,2>{0.356669188f, 0.811058462f},
-std::array<float,2>{0.658103824f, 0.154146075f},
-std::array<float,2>{0.849123538f, 0.705216348f},
-std::array<float,2>{0.0607155599f, 0.342667818f},
-std::array<float,2>{0.208855093f, 0.623430669f},
-std::array<float,2>{0.921558678f, 0.437359065f},
-std::array<float,2>{0.51282239f, 0.880126894f},
-std::array<float,2>{0.497568905f, 0.0843525901f},
-std::array<float,2>{0.387857497f, 0.641146302f},
-std::array<float,2>{0.593793035f, 0.303152919f},
-std::array<float,2>{0.943304002f, 0.851056755f},
-std::array<float,2>{0.176166356f, 0.241048992f},
-std::array<float,2>{0.0823335499f, 0.968306065f},
-std::array<float,2>{0.771966517f, 0.000499712361f},
-std::array<float,2>{0.719528794f, 0.518684864f},
-std::array<float,2>{0.252854466f, 0.480051339f},
-std::array<float,2>{0.450187355f, 0.929620385f},
-std::array<float,2>{0.533837676f, 0.0988567024f},
-std::array<float,2>{0.878109932f, 0.575158656f},
-std::array<float,2>{0.233924493f, 0.378825456f},
-std::array<float,2>{0.00622655917f, 0.734175324f},
-std::array<float,2>{0.839832723f, 0.349382013f},
-std::array<float,2>{0.626664639f, 0.763363779f},
-std::array<float,2>{0.327299207f, 0.178221658f},
-std::array<float,2>{0.294166505f, 0.532191157f},
-std::array<float,2>{0.691368639f, 0.443079531f},
-std::array<float,2>{0.801068723f, 0.978314519f},
-std::array<float,2>{0.115207925f, 0.0525341071f},
-std::array<float,2>{0.145549566f, 0.841652274f},
-std::array<float,2>{0.995151758f, 0.192844719f},
-std::array<float,2>{0.575293243f, 0.680742025f},
-std::array<float,2>{0.432790965f, 0.264670312f},
-std::array<float,2>{0.48713398f, 0.756800413f},
-std::array<float,2>{0.502816021f, 0.180264443f},
-std::array<float,2>{0.911757827f, 0.725534141f},
-std::array<float,2>{0.21401459f, 0.352505326f},
-std::array<float,2>{0.0470804572f, 0.567166507f},
-std::array<float,2>{0.856018066f, 0.385393292f},
-std::array<float,2>{0.667665422f, 0.932548523f},
-std::array<float,2>{0.351182848f, 0.104015902f},
-std::array<float,2>{0.262398154f, 0.672114134f},
-std::array<float,2>{0.728810012f, 0.253922284f},
-std::array<float,2>{0.775889218f, 0.831051886f},
-std::array<float,2>{0.087978825f, 0.19806461f},
-std::array<float,2>{0.183606818f, 0.971968055f},
-std::array<float,2>{0.946840763f, 0.0578945689f},
-std::array<float,2>{0.602394402f, 0.545432508f},
-std::array<float,2>{0.378922731f, 0.449032396f},
-std::array<float,2>{0.320281029f, 0.889206409f},
-std::array<float,2>{0.636117816f, 0.0926540941f},
-std::array<float,2>{0.829740226f, 0.609613538f},
-std::array<float,2>{0.013431685f, 0.428760529f},
-std::array<float,2>{0.226336971f, 0.718098342f},
-std::array<float,2>{0.888167441f, 0.330669552f},
-std::array<float,2>{0.544079542f, 0.802525878f},
-std::array<float,2>{0.438449234f, 0.145396054f},
-std::array<float,2>{0.426527292f, 0.530081868f},
-std::array<float,2>{0.565995216f, 0.471871167f},
-std::array<float,2>{0.988183677f, 0.953769505f},
-std::array<float,2>{0.154075906f, 0.0152695794f},
-std::array<float,2>{0.122020103f, 0.856199801f},
-std::array<float,2>{0.810954928f, 0.244288951f},
-std::array<float,2>{0.699288428f, 0.652952313f},
-std::array<float,2>{0.287190288f, 0.311337322f},
-std::array<float,2>{0.30205375f, 0.816899002f},
-std::array<float,2>{0.715417206f, 0.211100787f},
-std::array<float,2>{0.788841844f, 0.659972787f},
-std::array<float,2>{0.108305089f, 0.268463641f},
-std::array<float,2>{0.128248945f, 0.558215678f},
-std::array<float,2>{0.981210351f, 0.45584169f},
-std::array<float,2>{0.592986941f, 0.989897013f},
-std::array<float,2>{0.412608236f, 0.0432427004f},
-std::array<float,2>{0.457676172f, 0.747030318f},
-std::array<float,2>{0.552435815f, 0.362836719f},
-std::array<float,2>{0.9011935f, 0.765975177f},
-std::array<float,2>{0.244730368f, 0.168833092f},
-std::array<float,2>{0.0215433259f, 0.907008886f},
-std::array<float,2>{0.828122854f, 0.119796984f},
-std::array<float,2>{0.644228816f, 0.592827022f},
-std::array<float,2>{0.336289823f, 0.398789138f},
-std::array<float,2>{0.397709638f, 0.943271518f},
-std::array<float,2>{0.621740937f, 0.0206059571f},
-std::array<float,2>{0.961049139f, 0.508057058f},
-std::array<float,2>{0.158241421f, 0.495462596f},
-std::array<float,2>{0.0670877099f, 0.626090586f},
-std::array<float,2>{0.763817847f, 0.293207794f},
-std::array<float,2>{0.746701598f, 0.86361903f},
-std::array<float,2>{0.278777629f, 0.229350567f},
-std::array<float,2>{0.369435728f, 0.606182694f},
-std::array<float,2>{0.681493163f, 0.412095457f},
-std::array<float,2>{0.874961913f, 0.891430676f},
-std::array<float,2>{0.0445710458f, 0.0758327171f},
-std::array<float,2>{0.193268493f, 0.785918653f},
-std::array<float,2>{0.925913692f, 0.132461205f},
-std::array<float,2>{0.52708143f, 0.701910496f},
-std::array<float,2>{0.482254952f, 0.316703349f},
-std::array<float,2>{0.378850937f, 0.790362537f},
-std::array<float,2>{0.60929817f, 0.133150533f},
-std::array<float,2>{0.950847745f, 0.688808322f},
-std::array<float,2>{0.180329844f, 0.323990017f},
-std::array<float,2>{0.0927595124f, 0.593977332f},
-std::array<float,2>{0.779599786f, 0.421773791f},
-std::array<float,2>{0.733036339f, 0.900911033f},
-std::array<float,2>{0.260038167f, 0.0653600097f},
-std::array<float,2>{0.34596023f, 0.637474895f},
-std::array<float,2>{0.669644296f, 0.285003364f},
-std::array<float,2>{0.853298664f, 0.870144129f},
-std::array<float,2>{0.051702641f, 0.224293664f},
-std::array<float,2>{0.215467453f, 0.950615346f},
-std::array<float,2>{0.910004735f, 0.0253311992f},
-std::array<float,2>{0.506493688f, 0.505136013f},
-std::array<float,2>{0.488569438f, 0.488592297f},
-std::array<float,2>{0.28435412f, 0.915992975f},
-std::array<float,2>{0.695970297f, 0.111323066f},
-std::array<float,2>{0.805516303f, 0.578748703f},
-std::array<float,2>{0.118159622f, 0.394839913f},
-std::array<float,2>{0.149105087f, 0.738891602f},
-std::array<float,2>{0.990936995f, 0.372927725f},
-std::array<float,2>{0.568022966f, 0.774240851f},
-std::array<float,2>{0.421923071f, 0.160282135f},
-std::array<float,2>{0.444419831f, 0.553099215f},
-std::array<float,2>{0.540240347f, 0.466087103f},
-std::array<float,2>{0.884311795f, 0.995962739f},
-std::array<float,2>{0.22183679f, 0.0342938006f},
-std::array<float,2>{0.00921876077f, 0.828055143f},
-std::array<float,2>{0.834930301f, 0.20814988f},
-std::array<float,2>{0.637096047f, 0.666648507f},
-std::array<float,2>{0.313166738f, 0.279772282f},
-std::array<float,2>{0.341686338f, 0.845157564f},
-std::array<float,2>{0.647707701f, 0.234700739f},
-std::array<float,2>{0.820905149f, 0.648318231f},
-std::array<float,2>{0.0193005335f, 0.299225658f},
-std::array<float,2>{0.247725859f, 0.522096395f},
-std::array<float,2>{0.905430079f, 0.480767787f},
-std::array<float,2>{0.548226357f, 0.961511314f},
-std::array<float,2>{0.456262678f, 0.00402234541f},
-std::array<float,2>{0.407296509f, 0.710412204f},
-std::array<float,2>{0.587177098f, 0.338664353f},
-std::array<float,2>{0.979359806f, 0.808397233f},
-std::array<float,2>{0.130084708f, 0.151096404f},
-std::array<float,2>{0.104142703f, 0.878363371f},
-std::array<float,2>{0.783084631f, 0.0808997154f},
-std::array<float,2>{0.714408875f, 0.617765069f},
-std::array<float,2>{0.300108135f, 0.433098316f},
-std::array<float,2>{0.477068096f, 0.984155297f},
-std::array<float,2>{0.530447662f, 0.0496076085f},
-std::array<float,2>{0.923337042f, 0.536599576f},
-std::array<float,2>{0.190737456f, 0.439623058f},
-std::array<float,2>{0.0401771367f, 0.68516767f},
-std::array<float,2>{0.868376851f, 0.261496931f},
-std::array<float,2>{0.684608281f, 0.836395621f},
-std::array<float,2>{0.372412354f, 0.189239398f},
-std::array<float,2>{0.276786983f, 0.570713878f},
-std::array<float,2>{0.743636131f, 0.382625997f},
-std::array<float,2>{0.758632958f, 0.925279796f},
-std::array<float,2>{0.0627870709f, 0.0956088901f},
-std::array<float,2>{0.162148952f, 0.761007667f},
-std::array<float,2>{0.968345046f, 0.173581287f},
-std::array<float,2>{0.619593918f, 0.728726447f},
-std::array<float,2>{0.394172728f, 0.345370144f},
-std::array<float,2>{0.466295183f, 0.835538626f},
-std::array<float,2>{0.555942178f, 0.202737167f},
-std::array<float,2>{0.894737244f, 0.679136038f},
-std::array<float,2>{0.234917507f, 0.252654701f},
-std::array<float,2>{0.0254957452f, 0.541979313f},
-std::array<float,2>{0.816356897f, 0.44939819f},
-std::array<float,2>{0.653327286f, 0.974551439f},
-std::array<float,2>{0.328748137f, 0.0603811257f},
-std::array<float,2>{0.309755206f, 0.719750643f},
-std::array<float,2>{0.70778352f, 0.356366664f},
-std::array<float,2>{0.791657746f, 0.753152132f},
-std::array<float,2>{0.0968813226f, 0.186362535f},
-std::array<float,2>{0.138852268f, 0.935719788f},
-std::array<float,2>{0.970386982f, 0.107521862f},
-std::array<float,2>{0.580648661f, 0.565712094f},
-std::array<float,2>{0.417814732f, 0.387681723f},
-std::array<float,2>{0.3638677f, 0.958367467f},
-std::array<float,2>{0.672669172f, 0.00855880231f},
-std::array<float,2>{0.861994624f, 0.52400279f},
-std::array<float,2>{0.0337983295f, 0.475464642f},
-std::array<float,2>{0.200268283f, 0.651807368f},
-std::array<float,2>{0.936646879f, 0.304824114f},
-std::array<float,2>{0.523179293f, 0.854314268f},
-std::array<float,2>{0.471391946f, 0.248763576f},
-std::array<float,2>{0.401521415f, 0.613463342f},
-std::array<float,2>{0.610830188f, 0.425327957f},
-std::array<float,2>{0.954086781f, 0.886072099f},
-std::array<float,2>{0.164293766f, 0.0887828469f},
-std::array<float,2>{0.0757485256f, 0.799872816f},
-std::array<float,2>{0.757156968f, 0.1415921f},
-std::array<float,2>{0.74203974f, 0.711627245f},
-std::array<float,2>{0.271071881f, 0.332484752f},
-std::array<float,2>{0.256258428f, 0.771497309f},
-std::array<float,2>{0.725681961f, 0.164926305f},
-std::array<float,2>{0.766383648f, 0.743806303f},
-std::array<float,2>{0.0813604817f, 0.364183217f},
-std::array<float,2>{0.172996446f, 0.586212635f},
-std::array<float,2>{0.940663278f, 0.402659357f},
-std::array<float,2>{0.599287629f, 0.910583079f},
-std::array<float,2>{0.384273887f, 0.123580821f},
-std::array<float,2>{0.493735343f, 0.663799763f},
-std::array<float,2>{0.508289993f, 0.269931853f},
-std::array<float,2>{0.914775372f, 0.816318631f},
-std::array<float,2>{0.206234574f, 0.217944741f},
-std::array<float,2>{0.0555047505f, 0.986733556f},
-std::array<float,2>{0.847056866f, 0.0414342284f},
-std::array<float,2>{0.663156688f, 0.560804188f},
-std::array<float,2>{0.355421662f, 0.460777789f},
-std::array<float,2>{0.434372783f, 0.896062195f},
-std::array<float,2>{0.57254988f, 0.072213009f},
-std::array<float,2>{0.997193635f, 0.601745546f},
-std::array<float,2>{0.143654704f, 0.407911032f},
-std::array<float,2>{0.111079723f, 0.69918853f},
-std::array<float,2>{0.799104631f, 0.316135466f},
-std::array<float,2>{0.695127487f, 0.784860492f},
-std::array<float,2>{0.290999144f, 0.128372103f},
-std::array<float,2>{0.323840499f, 0.515574038f},
-std::array<float,2>{0.631141484f, 0.49693644f},
-std::array<float,2>{0.841667831f, 0.938059926f},
-std::array<float,2>{0.00110281678f, 0.0187396072f},
-std::array<float,2>{0.228273407f, 0.863012791f},
-std::array<float,2>{0.882459581f, 0.234278783f},
-std::array<float,2>{0.536785603f, 0.630215704f},
-std::array<float,2>{0.448457181f, 0.28965956f},
-std::array<float,2>{0.403850228f, 0.821119428f},
-std::array<float,2>{0.616049588f, 0.206932425f},
-std::array<float,2>{0.959491253f, 0.669883907f},
-std::array<float,2>{0.170421645f, 0.277012438f},
-std::array<float,2>{0.0713521168f, 0.547058225f},
-std::array<float,2>{0.750264645f, 0.464781135f},
-std::array<float,2>{0.737139404f, 0.996506035f},
-std::array<float,2>{0.268391222f, 0.0371719673f},
-std::array<float,2>{0.360772878f, 0.736353636f},
-std::array<float,2>{0.678578973f, 0.367857426f},
-std::array<float,2>{0.866500556f, 0.779286504f},
-std::array<float,2>{0.0352348983f, 0.156892031f},
-std::array<float,2>{0.196260929f, 0.918817222f},
-std::array<float,2>{0.930194974f, 0.114161462f},
-std::array<float,2>{0.519527614f, 0.585183978f},
-std::array<float,2>{0.472798884f, 0.392803758f},
-std::array<float,2>{0.307740539f, 0.946276903f},
-std::array<float,2>{0.70328331f, 0.0296325218f},
-std::array<float,2>{0.793164372f, 0.503532648f},
-std::array<float,2>{0.0981710181f, 0.486188531f},
-std::array<float,2>{0.133781075f, 0.633261919f},
-std::array<float,2>{0.972926199f, 0.287059724f},
-std::array<float,2>{0.585187674f, 0.873167634f},
-std::array<float,2>{0.419396847f, 0.222269386f},
-std::array<float,2>{0.463051766f, 0.600844145f},
-std::array<float,2>{0.559138894f, 0.417102575f},
-std::array<float,2>{0.892319024f, 0.902390778f},
-std::array<float,2>{0.238449544f, 0.0669826642f},
-std::array<float,2>{0.0277437046f, 0.793059766f},
-std::array<float,2>{0.818405688f, 0.137015045f},
-std::array<float,2>{0.650988877f, 0.694563568f},
-std::array<float,2>{0.335508853f, 0.326089382f},
-std::array<float,2>{0.324626237f, 0.764560223f},
-std::array<float,2>{0.627174318f, 0.176790535f},
-std::array<float,2>{0.836771131f, 0.730789721f},
-std::array<float,2>{0.00560027594f, 0.350217074f},
-std::array<float,2>{0.231794238f, 0.576222122f},
-std::array<float,2>{0.876663864f, 0.376409501f},
-std::array<float,2>{0.531464219f, 0.927006483f},
-std::array<float,2>{0.452980399f, 0.0997619256f},
-std::array<float,2>{0.431488425f, 0.681906581f},
-std::array<float,2>{0.57777679f, 0.262063891f},
-std::array<float,2>{0.993125081f, 0.841905534f},
-std::array<float,2>{0.148386657f, 0.193780527f},
-std::array<float,2>{0.115418859f, 0.979890764f},
-std::array<float,2>{0.803109407f, 0.0542180315f},
-std::array<float,2>{0.68833226f, 0.533851743f},
-std::array<float,2>{0.295560122f, 0.443541914f},
-std::array<float,2>{0.499906331f, 0.881572187f},
-std::array<float,2>{0.513783097f, 0.083254829f},
-std::array<float,2>{0.919336081f, 0.62250942f},
-std::array<float,2>{0.210355565f, 0.435325772f},
-std::array<float,2>{0.0591307245f, 0.703177154f},
-std::array<float,2>{0.850624204f, 0.340334117f},
-std::array<float,2>{0.658299327f, 0.809796393f},
-std::array<float,2>{0.358645558f, 0.154650137f},
-std::array<float,2>{0.251819074f, 0.51575768f},
-std::array<float,2>{0.721751213f, 0.478130072f},
-std::array<float,2>{0.769783556f, 0.966464639f},
-std::array<float,2>{0.0853745714f, 0.00355182006f},
-std::array<float,2>{0.178987816f, 0.847864091f},
-std::array<float,2>{0.944268465f, 0.239051014f},
-std::array<float,2>{0.596658349f, 0.644007206f},
-std::array<float,2>{0.389361739f, 0.302236527f},
-std::array<float,2>{0.439521819f, 0.803854823f},
-std::array<float,2>{0.545661867f, 0.146860659f},
-std::array<float,2>{0.889155984f, 0.714927852f},
-std::array<float,2>{0.22459273f, 0.32847479f},
-std::array<float,2>{0.015274819f, 0.61257565f},
-std::array<float,2>{0.831136703f, 0.425888091f},
-std::array<float,2>{0.63432318f, 0.886876345f},
-std::array<float,2>{0.316961735f, 0.0904507264f},
-std::array<float,2>{0.285637707f, 0.655798018f},
-std::array<float,2>{0.702926457f, 0.308918417f},
-std::array<float,2>{0.809001207f, 0.857863426f},
-std::array<float,2>{0.123700388f, 0.243997052f},
-std::array<float,2>{0.155529916f, 0.95577389f},
-std::array<float,2>{0.986169636f, 0.0118106399f},
-std::array<float,2>{0.563669801f, 0.528891563f},
-std::array<float,2>{0.428821564f, 0.470187664f},
-std::array<float,2>{0.347974271f, 0.93009001f},
-std::array<float,2>{0.664858758f, 0.101579174f},
-std::array<float,2>{0.857995391f, 0.569884717f},
-std::array<float,2>{0.0500170216f, 0.383568734f},
-std::array<float,2>{0.21237047f, 0.724568307f},
-std::array<float,2>{0.913944542f, 0.354549438f},
-std::array<float,2>{0.500466049f, 0.754640996f},
-std::array<float,2>{0.484790325f, 0.182282835f},
-std::array<float,2>{0.382080883f, 0.54417491f},
-std::array<float,2>{0.604900837f, 0.446435571f},
-std::array<float,2>{0.94880569f, 0.968832433f},
-std::array<float,2>{0.186855763f, 0.0553635545f},
-std::array<float,2>{0.0871851519f, 0.829432845f},
-std::array<float,2>{0.773723364f, 0.196559891f},
-std::array<float,2>{0.727122664f, 0.675403416f},
-std::array<float,2>{0.26368323f, 0.257318765f},
-std::array<float,2>{0.281145215f, 0.866869867f},
-std::array<float,2>{0.749967992f, 0.227648944f},
-std::array<float,2>{0.762115777f, 0.627809644f},
-std::array<float,2>{0.0690959543f, 0.296079755f},
-std::array<float,2>{0.156801507f, 0.51167357f},
-std::array<float,2>{0.963058531f, 0.492690355f},
-std::array<float,2>{0.624281883f, 0.944124341f},
-std::array<float,2>{0.394541711f, 0.0214890093f},
-std::array<float,2>{0.482877284f, 0.699568033f},
-std::array<float,2>{0.524041831f, 0.318980485f},
-std::array<float,2>{0.929043233f, 0.78729713f},
-std::array<float,2>{0.195237115f, 0.12921907f},
-std::array<float,2>{0.046238035f, 0.892609477f},
-std::array<float,2>{0.872938752f, 0.0770472363f},
-std::array<float,2>{0.683465958f, 0.60781616f},
-std::array<float,2>{0.368482679f, 0.412364572f},
-std::array<float,2>{0.411866426f, 0.99202919f},
-std::array<float,2>{0.590462863f, 0.0463270172f},
-std::array<float,2>{0.982852817f, 0.55473578f},
-std::array<float,2>{0.125937998f, 0.453865558f},
-std::array<float,2>{0.106770918f, 0.65764451f},
-std::array<float,2>{0.786016285f, 0.265802652f},
-std::array<float,2>{0.717642069f, 0.818422794f},
-std::array<float,2>{0.303310573f, 0.213725388f},
-std::array<float,2>{0.338947564f, 0.590786636f},
-std::array<float,2>{0.641962886f, 0.401963472f},
-std::array<float,2>{0.825192809f, 0.909962356f},
-std::array<float,2>{0.0211889651f, 0.117224567f},
-std::array<float,2>{0.243993297f, 0.76797992f},
-std::array<float,2>{0.900352836f, 0.17159231f},
-std::array<float,2>{0.554007709f, 0.748848081f},
-std::array<float,2>{0.459546387f, 0.35953021f},
-std::array<float,2>{0.425477833f, 0.775994062f},
-std::array<float,2>{0.569503665f, 0.163688883f},
-std::array<float,2>{0.989646673f, 0.740912139f},
-std::array<float,2>{0.151961848f, 0.373600453f},
-std::array<float,2>{0.120100781f, 0.580705106f},
-std::array<float,2>{0.807621777f, 0.397449613f},
-std::array<float,2>{0.697779238f, 0.916201413f},
-std::array<float,2>{0.2818425f, 0.113028511f},
-std::array<float,2>{0.31451115f, 0.664911568f},
-std::array<float,2>{0.640217304f, 0.27884227f},
-std::array<float,2>{0.833508968f, 0.824463665f},
-std::array<float,2>{0.011504868f, 0.209624335f},
-std::array<float,2>{0.220496431f, 0.992412508f},
-std::array<float,2>{0.885386586f, 0.0331671275f},
-std::array<float,2>{0.541740239f, 0.552400768f},
-std::array<float,2>{0.442015141f, 0.468143284f},
-std::array<float,2>{0.257885844f, 0.898670912f},
-std::array<float,2>{0.731381714f, 0.0634494796f},
-std::array<float,2>{0.777604342f, 0.596300066f},
-std::array<float,2>{0.091081731f, 0.419715434f},
-std::array<float,2>{0.181753442f, 0.691275954f},
-std::array<float,2>{0.952975333f, 0.320337802f},
-std::array<float,2>{0.606252015f, 0.79186815f},
-std::array<float,2>{0.375254124f, 0.136608377f},
-std::array<float,2>{0.490534037f, 0.506579995f},
-std::array<float,2>{0.504533887f, 0.49102819f},
-std::array<float,2>{0.906480551f, 0.951416135f},
-std::array<float,2>{0.21743992f, 0.0255964585f},
-std::array<float,2>{0.0533746369f, 0.867845118f},
-std::array<float,2>{0.855319798f, 0.225512102f},
-std::array<float,2>{0.671391845f, 0.639696062f},
-std::array<float,2>{0.345531613f, 0.282209873f},
-std::array<float,2>{0.374823868f, 0.838288188f},
-std::array<float,2>{0.6858899f, 0.190158471f},
-std::array<float,2>{0.86994046f, 0.686273456f},
-std::array<float,2>{0.0414038338f, 0.258555353f},
-std::array<float,2>{0.187677965f, 0.538308203f},
-std::array<float,2>{0.924170196f, 0.438256174f},
-std::array<float,2>{0.528449178f, 0.980813146f},
-std::array<float,2>{0.478680581f, 0.0478859618f},
-std::array<float,2>{0.391775936f, 0.726705015f},
-std::array<float,2>{0.618706286f, 0.346895754f},
-std::array<float,2>{0.966769934f, 0.75891614f},
-std::array<float,2>{0.160434738f, 0.175041631f},
-std::array<float,2>{0.0646419004f, 0.92287004f},
-std::array<float,2>{0.759977877f, 0.0969254002f},
-std::array<float,2>{0.744585991f, 0.573168933f},
-std::array<float,2>{0.27440235f, 0.379690737f},
-std::array<float,2>{0.454834163f, 0.963964581f},
-std::array<float,2>{0.549278975f, 0.00753859105f},
-std::array<float,2>{0.903238177f, 0.520605564f},
-std::array<float,2>{0.249816522f, 0.482465863f},
-std::array<float,2>{0.0172228236f, 0.645401537f},
-std::array<float,2>{0.823673368f, 0.297695965f},
-std::array<float,2>{0.645728171f, 0.84619844f},
-std::array<float,2>{0.342622727f, 0.236822888f},
-std::array<float,2>{0.297126859f, 0.619271755f},
-std::array<float,2>{0.712886095f, 0.431208134f},
-std::array<float,2>{0.783203781f, 0.876560509f},
-std::array<float,2>{0.103283465f, 0.079583995f},
-std::array<float,2>{0.131785065f, 0.805333197f},
-std::array<float,2>{0.977592051f, 0.149804145f},
-std::array<float,2>{0.589431226f, 0.708185554f},
-std::array<float,2>{0.409692258f, 0.336221725f},
-std::array<float,2>{0.470170856f, 0.852446318f},
-std::array<float,2>{0.521260083f, 0.247470096f},
-std::array<float,2>{0.934459925f, 0.650369227f},
-std::array<float,2>{0.201733321f, 0.307147086f},
-std::array<float,2>{0.0325707197f, 0.527048409f},
-std::array<float,2>{0.860729992f, 0.474395305f},
-std::array<float,2>{0.675111175f, 0.95963335f},
-std::array<float,2>{0.365423977f, 0.0104455324f},
-std::array<float,2>{0.273330152f, 0.714462817f},
-std::array<float,2>{0.740177214f, 0.334217459f},
-std::array<float,2>{0.754070103f, 0.79864198f},
-std::array<float,2>{0.0768844932f, 0.143131629f},
-std::array<float,2>{0.16685456f, 0.883866727f},
-std::array<float,2>{0.955545306f, 0.0862141997f},
-std::array<float,2>{0.612103701f, 0.616665184f},
-std::array<float,2>{0.399402291f, 0.422838062f},
-std::array<float,2>{0.330831707f, 0.976090491f},
-std::array<float,2>{0.654514194f, 0.0615309179f},
-std::array<float,2>{0.812983274f, 0.540175736f},
-std::array<float,2>{0.0251521599f, 0.452401012f},
-std::array<float,2>{0.237663165f, 0.676796138f},
-std::array<float,2>{0.897848368f, 0.251401454f},
-std::array<float,2>{0.556662977f, 0.832143247f},
-std::array<float,2>{0.46815896f, 0.201130062f},
-std::array<float,2>{0.415822208f, 0.562979817f},
-std::array<float,2>{0.579529762f, 0.389484882f},
-std::array<float,2>{0.971089005f, 0.934681833f},
-std::array<float,2>{0.138429418f, 0.105654269f},
-std::array<float,2>{0.0950267762f, 0.751803756f},
-std::array<float,2>{0.789573133f, 0.185071751f},
-std::array<float,2>{0.709367871f, 0.722558618f},
-std::array<float,2>{0.312294543f, 0.358964026f},
-std::array<float,2>{0.291875273f, 0.782690167f},
-std::array<float,2>{0.691766858f, 0.125374466f},
-std::array<float,2>{0.797203183f, 0.696053147f},
-std::array<float,2>{0.111537285f, 0.313051522f},
-std::array<float,2>{0.141047597f, 0.605078936f},
-std::array<float,2>{0.999276698f, 0.409468055f},
-std::array<float,2>{0.572204471f, 0.898358405f},
-std::array<float,2>{0.437375754f, 0.0726688802f},
-std::array<float,2>{0.446247339f, 0.631320655f},
-std::array<float,2>{0.538727939f, 0.292034656f},
-std::array<float,2>{0.880714834f, 0.860595942f},
-std::array<float,2>{0.229197159f, 0.231378615f},
-std::array<float,2>{0.00298855361f, 0.940421343f},
-std::array<float,2>{0.842499495f, 0.0159182306f},
-std::array<float,2>{0.630254805f, 0.511929989f},
-std::array<float,2>{0.322112978f, 0.498396337f},
-std::array<float,2>{0.386508644f, 0.913596213f},
-std::array<float,2>{0.601125419f, 0.121888638f},
-std::array<float,2>{0.937906623f, 0.589751899f},
-std::array<float,2>{0.174792081f, 0.405503154f},
-std::array<float,2>{0.0789716542f, 0.745087206f},
-std::array<float,2>{0.76832968f, 0.366603166f},
-std::array<float,2>{0.724151969f, 0.770256996f},
-std::array<float,2>{0.254637748f, 0.166096076f},
-std::array<float,2>{0.352758765f, 0.559072256f},
-std::array<float,2>{0.660648942f, 0.458933085f},
-std::array<float,2>{0.843922198f, 0.985217333f},
-std::array<float,2>{0.0585144721f, 0.040460173f},
-std::array<float,2>{0.203162938f, 0.814444125f},
-std::array<float,2>{0.917029083f, 0.215588182f},
-std::array<float,2>{0.510443389f, 0.66073662f},
-std::array<float,2>{0.494281173f, 0.272004366f},
-std::array<float,2>{0.389658123f, 0.850231111f},
-std::array<float,2>{0.597402155f, 0.241485104f},
-std::array<float,2>{0.944676995f, 0.642121732f},
-std::array<float,2>{0.178433552f, 0.304427534f},
-std::array<float,2>{0.0849258304f, 0.517691195f},
-std::array<float,2>{0.770588815f, 0.479079694f},
-std::array<float,2>{0.720943451f, 0.96737963f},
-std::array<float,2>{0.250396103f, 0.00166133582f},
-std::array<float,2>{0.358091652f, 0.706145465f},
-std::array<float,2>{0.659846544f, 0.34325552f},
-std::array<float,2>{0.849812627f, 0.812494099f},
-std::array<float,2>{0.0598543882f, 0.153196707f},
-std::array<float,2>{0.209756896f, 0.879797161f},
-std::array<float,2>{0.918660641f, 0.0855960846f},
-std::array<float,2>{0.514801264f, 0.624480665f},
-std::array<float,2>{0.498890996f, 0.435654312f},
-std::array<float,2>{0.296813756f, 0.976734638f},
-std::array<float,2>{0.688859582f, 0.0517518669f},
-std::array<float,2>{0.804295838f, 0.533172309f},
-std::array<float,2>{0.116844505f, 0.441765815f},
-std::array<float,2>{0.146960989f, 0.679880202f},
-std::array<float,2>{0.993843019f, 0.264255792f},
-std::array<float,2>{0.576753438f, 0.840420306f},
-std::array<float,2>{0.429911315f, 0.19163847f},
-std::array<float,2>{0.451436162f, 0.575748682f},
-std::array<float,2>{0.532495201f, 0.377210557f},
-std::array<float,2>{0.875197291f, 0.927951813f},
-std::array<float,2>{0.230921254f, 0.0985286087f},
-std::array<float,2>{0.00405143527f, 0.762690485f},
-std::array<float,2>{0.837195456f, 0.179062843f},
-std::array<float,2>{0.628375769f, 0.732574582f},
-std::array<float,2>{0.326145321f, 0.347857386f},
-std::array<float,2>{0.334215492f, 0.796111703f},
-std::array<float,2>{0.651896536f, 0.14026162f},
-std::array<float,2>{0.819698036f, 0.692304015f},
-std::array<float,2>{0.0289969407f, 0.327814728f},
-std::array<float,2>{0.239555955f, 0.599588037f},
-std::array<float,2>{0.891345263f, 0.415864944f},
-std::array<float,2>{0.560465276f, 0.905346096f},
-std::array<float,2>{0.464332461f, 0.0702067241f},
-std::array<float,2>{0.418668181f, 0.635760188f},
-std::array<float,2>{0.58405292f, 0.288302571f},
-std::array<float,2>{0.973861814f, 0.871196866f},
-std::array<float,2>{0.133896589f, 0.219103888f},
-std::array<float,2>{0.0990633443f, 0.947925508f},
-std::array<float,2>{0.794568598f, 0.0289363526f},
-std::array<float,2>{0.704239905f, 0.500894487f},
-std::array<float,2>{0.307373285f, 0.488082439f},
-std::array<float,2>{0.474317014f, 0.920696735f},
-std::array<float,2>{0.51803565f, 0.115710102f},
-std::array<float,2>{0.931139588f, 0.583477736f},
-std::array<float,2>{0.196607724f, 0.392001629f},
-std::array<float,2>{0.0367599875f, 0.734595239f},
-std::array<float,2>{0.865429878f, 0.370542645f},
-std::array<float,2>{0.679192066f, 0.780359089f},
-std::array<float,2>{0.360078365f, 0.159521386f},
-std::array<float,2>{0.269049764f, 0.549705029f},
-std::array<float,2>{0.737885177f, 0.461237371f},
-std::array<float,2>{0.75099349f, 0.998722553f},
-std::array<float,2>{0.0703311488f, 0.0355375186f},
-std::array<float,2>{0.171159953f, 0.823920727f},
-std::array<float,2>{0.960278511f, 0.204634607f},
-std::array<float,2>{0.61690414f, 0.670956314f},
-std::array<float,2>{0.402633965f, 0.275307626f},
-std::array<float,2>{0.460508734f, 0.767347157f},
-std::array<float,2>{0.553284287f, 0.169838592f},
-std::array<float,2>{0.898883641f, 0.747972906f},
-std::array<float,2>{0.242837399f, 0.361744702f},
-std::array<float,2>{0.020109864f, 0.592214286f},
-std::array<float,2>{0.825978339f, 0.400000632f},
-std::array<float,2>{0.641169131f, 0.907957852f},
-std::array<float,2>{0.338389069f, 0.120753251f},
-std::array<float,2>{0.304224432f, 0.658327699f},
-std::array<float,2>{0.718384624f, 0.268789887f},
-std::array<float,2>{0.786804318f, 0.818213046f},
-std::array<float,2>{0.105584458f, 0.211919844f},
-std::array<float,2>{0.126405969f, 0.988664865f},
-std::array<float,2>{0.984186053f, 0.0441602021f},
-std::array<float,2>{0.591079473f, 0.557421148f},
-std::array<float,2>{0.410847664f, 0.456826061f},
-std::array<float,2>{0.367342472f, 0.891691446f},
-std::array<float,2>{0.681674421f, 0.0742577985f},
-std::array<float,2>{0.871178269f, 0.607119024f},
-std::array<float,2>{0.0451921523f, 0.410568416f},
-std::array<float,2>{0.193712875f, 0.70241183f},
-std::array<float,2>{0.928512275f, 0.317787528f},
-std::array<float,2>{0.525297701f, 0.786999345f},
-std::array<float,2>{0.484244853f, 0.130868495f},
-std::array<float,2>{0.396461457f, 0.509276032f},
-std::array<float,2>{0.623287976f, 0.494598389f},
-std::array<float,2>{0.964082897f, 0.941571832f},
-std::array<float,2>{0.158075899f, 0.0199701898f},
-std::array<float,2>{0.0698464662f, 0.86491698f},
-std::array<float,2>{0.76353848f, 0.2303859f},
-std::array<float,2>{0.748867869f, 0.62545836f},
-std::array<float,2>{0.279554754f, 0.29463926f},
-std::array<float,2>{0.264651209f, 0.831514955f},
-std::array<float,2>{0.727549016f, 0.198613122f},
-std::array<float,2>{0.774636447f, 0.673717916f},
-std::array<float,2>{0.0862419903f, 0.255529583f},
-std::array<float,2>{0.186307624f, 0.546760261f},
-std::array<float,2>{0.947301626f, 0.44773677f},
-std::array<float,2>{0.604035556f, 0.971630096f},
-std::array<float,2>{0.381102294f, 0.0572090186f},
-std::array<float,2>{0.485887617f, 0.725654483f},
-std::array<float,2>{0.501226723f, 0.352716446f},
-std::array<float,2>{0.91220963f, 0.757316709f},
-std::array<float,2>{0.211354703f, 0.180761799f},
-std::array<float,2>{0.0493744537f, 0.933120251f},
-std::array<float,2>{0.85928905f, 0.104709566f},
-std::array<float,2>{0.665451765f, 0.567606032f},
-std::array<float,2>{0.349337071f, 0.386220604f},
-std::array<float,2>{0.428266406f, 0.954907656f},
-std::array<float,2>{0.562573254f, 0.0138804009f},
-std::array<float,2>{0.984694242f, 0.530667663f},
-std::array<float,2>{0.15501155f, 0.47121951f},
-std::array<float,2>{0.124854296f, 0.65396893f},
-std::array<float,2>{0.810066462f, 0.311923683f},
-std::array<float,2>{0.701197624f, 0.85740298f},
-std::array<float,2>{0.286919534f, 0.245463073f},
-std::array<float,2>{0.318200797f, 0.610485256f},
-std::array<float,2>{0.633490801f, 0.428332597f},
-std::array<float,2>{0.830783606f, 0.889798343f},
-std::array<float,2>{0.0142585272f, 0.0929040834f},
-std::array<float,2>{0.222728401f, 0.801641524f},
-std::array<float,2>{0.890334487f, 0.145801038f},
-std::array<float,2>{0.546371639f, 0.717639565f},
-std::array<float,2>{0.441330999f, 0.331793129f},
-std::array<float,2>{0.408313543f, 0.807496965f},
-std::array<float,2>{0.588174939f, 0.15173997f},
-std::array<float,2>{0.977411389f, 0.709938884f},
-std::array<float,2>{0.13184464f, 0.339600027f},
-std::array<float,2>{0.102380551f, 0.618583739f},
-std::array<float,2>{0.784325004f, 0.431737155f},
-std::array<float,2>{0.711120725f, 0.877203941f},
-std::array<float,2>{0.298820674f, 0.0812735111f},
-std::array<float,2>{0.34282431f, 0.646565259f},
-std::array<float,2>{0.645421565f, 0.300713956f},
-std::array<float,2>{0.823117137f, 0.844503939f},
-std::array<float,2>{0.01612233f, 0.235623196f},
-std::array<float,2>{0.248229399f, 0.96244812f},
-std::array<float,2>{0.904260218f, 0.00531441532f},
-std::array<float,2>{0.550636172f, 0.522517443f},
-std::array<float,2>{0.454081684f, 0.481713027f},
-std::array<float,2>{0.274805248f, 0.924239218f},
-std::array<float,2>{0.746059179f, 0.0945355818f},
-std::array<float,2>{0.761021852f, 0.572173953f},
-std::array<float,2>{0.0661041215f, 0.380863279f},
-std::array<float,2>{0.161739036f, 0.730189502f},
-std::array<float,2>{0.965245545f, 0.344266862f},
-std::array<float,2>{0.618030667f, 0.759864509f},
-std::array<float,2>{0.390953213f, 0.172317266f},
-std::array<float,2>{0.480030894f, 0.535433888f},
-std::array<float,2>{0.527410209f, 0.441294074f},
-std::array<float,2>{0.925355375f, 0.982480049f},
-std::array<float,2>{0.188745528f, 0.049943056f},
-std::array<float,2>{0.042523209f, 0.837571561f},
-std::array<float,2>{0.870565057f, 0.18840532f},
-std::array<float,2>{0.686630905f, 0.684368432f},
-std::array<float,2>{0.373066932f, 0.260244429f},
-std::array<float,2>{0.344169647f, 0.869583249f},
-std::array<float,2>{0.670511782f, 0.223104954f},
-std::array<float,2>{0.854348361f, 0.638121426f},
-std::array<float,2>{0.0539767221f, 0.283248127f},
-std::array<float,2>{0.217966557f, 0.504079282f},
-std::array<float,2>{0.907533526f, 0.489364356f},
-std::array<float,2>{0.505183756f, 0.949689448f},
-std::array<float,2>{0.491545856f, 0.0238004792f},
-std::array<float,2>{0.37657693f, 0.687957346f},
-std::array<float,2>{0.606722116f, 0.322975218f},
-std::array<float,2>{0.951300144f, 0.789741457f},
-std::array<float,2>{0.183118567f, 0.13463971f},
-std::array<float,2>{0.0905439332f, 0.901910603f},
-std::array<float,2>{0.778589785f, 0.0658864379f},
-std::array<float,2>{0.732284188f, 0.595582962f},
-std::array<float,2>{0.259225309f, 0.420154363f},
-std::array<float,2>{0.443262994f, 0.994144201f},
-std::array<float,2>{0.542149246f, 0.0340421237f},
-std::array<float,2>{0.885818899f, 0.554585516f},
-std::array<float,2>{0.219546646f, 0.4652147f},
-std::array<float,2>{0.0104943439f, 0.66701138f},
-std::array<float,2>{0.832277238f, 0.280827492f},
-std::array<float,2>{0.639040351f, 0.826775312f},
-std::array<float,2>{0.315617174f, 0.207846642f},
-std::array<float,2>{0.282740712f, 0.579623461f},
-std::array<float,2>{0.698351085f, 0.395860672f},
-std::array<float,2>{0.806834996f, 0.914440811f},
-std::array<float,2>{0.120997936f, 0.109925926f},
-std::array<float,2>{0.150987774f, 0.775096416f},
-std::array<float,2>{0.989002168f, 0.161979526f},
-std::array<float,2>{0.568921506f, 0.739679039f},
-std::array<float,2>{0.424762696f, 0.372016519f},
-std::array<float,2>{0.495315373f, 0.814735889f},
-std::array<float,2>{0.510780752f, 0.217585593f},
-std::array<float,2>{0.916455388f, 0.662729025f},
-std::array<float,2>{0.204339057f, 0.271125525f},
-std::array<float,2>{0.0575501844f, 0.56206274f},
-std::array<float,2>{0.845073402f, 0.45965147f},
-std::array<float,2>{0.661668658f, 0.987887204f},
-std::array<float,2>{0.352392167f, 0.0423837863f},
-std::array<float,2>{0.255326957f, 0.743100584f},
-std::array<float,2>{0.723082066f, 0.364912182f},
-std::array<float,2>{0.768623829f, 0.773227274f},
-std::array<float,2>{0.0799219161f, 0.165252209f},
-std::array<float,2>{0.175281823f, 0.911273837f},
-std::array<float,2>{0.939232111f, 0.124942362f},
-std::array<float,2>{0.600392878f, 0.587219477f},
-std::array<float,2>{0.384778559f, 0.40402627f},
-std::array<float,2>{0.320987761f, 0.939052761f},
-std::array<float,2>{0.629823983f, 0.0182402041f},
-std::array<float,2>{0.84319675f, 0.514451802f},
-std::array<float,2>{0.00280778063f, 0.497558594f},
-std::array<float,2>{0.229902878f, 0.62965858f},
-std::array<float,2>{0.87926966f, 0.290852726f},
-std::array<float,2>{0.537235439f, 0.861890376f},
-std::array<float,2>{0.446671307f, 0.232769579f},
-std::array<float,2>{0.435684741f, 0.603318214f},
-std::array<float,2>{0.570667624f, 0.407086462f},
-std::array<float,2>{0.998182595f, 0.895146132f},
-std::array<float,2>{0.142434463f, 0.0704170689f},
-std::array<float,2>{0.113228723f, 0.783447087f},
-std::array<float,2>{0.798729241f, 0.127422988f},
-std::array<float,2>{0.692883551f, 0.697469354f},
-std::array<float,2>{0.29258737f, 0.315378696f},
-std::array<float,2>{0.31089139f, 0.75218606f},
-std::array<float,2>{0.710238099f, 0.187406346f},
-std::array<float,2>{0.790383339f, 0.718969643f},
-std::array<float,2>{0.0941190347f, 0.356580973f},
-std::array<float,2>{0.137164518f, 0.565262377f},
-std::array<float,2>{0.97192955f, 0.388366371f},
-std::array<float,2>{0.578302801f, 0.936893165f},
-std::array<float,2>{0.414548934f, 0.10842973f},
-std::array<float,2>{0.466852844f, 0.678225517f},
-std::array<float,2>{0.55831778f, 0.253055453f},
-std::array<float,2>{0.896835268f, 0.834346533f},
-std::array<float,2>{0.236373484f, 0.201298118f},
-std::array<float,2>{0.0239528958f, 0.973473907f},
-std::array<float,2>{0.814046502f, 0.0593678616f},
-std::array<float,2>{0.656199217f, 0.542828381f},
-std::array<float,2>{0.331385016f, 0.450331807f},
-std::array<float,2>{0.400104493f, 0.885331988f},
-std::array<float,2>{0.612646043f, 0.0889476016f},
-std::array<float,2>{0.956905007f, 0.61471504f},
-std::array<float,2>{0.167967901f, 0.424786359f},
-std::array<float,2>{0.0779289678f, 0.711937666f},
-std::array<float,2>{0.75506562f, 0.333100438f},
-std::array<float,2>{0.738632023f, 0.798879683f},
-std::array<float,2>{0.272358805f, 0.142196298f},
-std::array<float,2>{0.366694659f, 0.524802685f},
-std::array<float,2>{0.67419976f, 0.476016313f},
-std::array<float,2>{0.859767973f, 0.957613766f},
-std::array<float,2>{0.0319541432f, 0.00949833728f},
-std::array<float,2>{0.20251675f, 0.854949594f},
-std::array<float,2>{0.935220242f, 0.249536306f},
-std::array<float,2>{0.519920766f, 0.651003659f},
-std::array<float,2>{0.469016373f, 0.306267351f},
-std::array<float,2>{0.431893528f, 0.84303534f},
-std::array<float,2>{0.574488163f, 0.19511655f},
-std::array<float,2>{0.994472742f, 0.683241367f},
-std::array<float,2>{0.145323426f, 0.263209403f},
-std::array<float,2>{0.113679551f, 0.534366846f},
-std::array<float,2>{0.802688539f, 0.444409758f},
-std::array<float,2>{0.689529419f, 0.979463935f},
-std::array<float,2>{0.293560863f, 0.0529296026f},
-std::array<float,2>{0.326399714f, 0.732195556f},
-std::array<float,2>{0.625711799f, 0.351348966f},
-std::array<float,2>{0.838037729f, 0.765330136f},
-std::array<float,2>{0.00766497944f, 0.1763293f},
-std::array<float,2>{0.232501775f, 0.926323175f},
-std::array<float,2>{0.877000391f, 0.101289779f},
-std::array<float,2>{0.534378529f, 0.577462316f},
-std::array<float,2>{0.451153964f, 0.375522345f},
-std::array<float,2>{0.25385052f, 0.964892328f},
-std::array<float,2>{0.719763041f, 0.00203259452f},
-std::array<float,2>{0.772541404f, 0.516986787f},
-std::array<float,2>{0.0838040486f, 0.477050245f},
-std::array<float,2>{0.176996112f, 0.643315911f},
-std::array<float,2>{0.942036092f, 0.30124414f},
-std::array<float,2>{0.594816625f, 0.848947108f},
-std::array<float,2>{0.387545437f, 0.239636987f},
-std::array<float,2>{0.496590585f, 0.621590734f},
-std::array<float,2>{0.51269412f, 0.434066653f},
-std::array<float,2>{0.920871496f, 0.882615089f},
-std::array<float,2>{0.207784846f, 0.0821063593f},
-std::array<float,2>{0.0620933063f, 0.809179366f},
-std::array<float,2>{0.8483513f, 0.156143472f},
-std::array<float,2>{0.656649888f, 0.704276979f},
-std::array<float,2>{0.356379658f, 0.340893388f},
-std::array<float,2>{0.361847997f, 0.777512193f},
-std::array<float,2>{0.676086783f, 0.157739282f},
-std::array<float,2>{0.864738643f, 0.738080561f},
-std::array<float,2>{0.0389008857f, 0.368809015f},
-std::array<float,2>{0.198501855f, 0.58412993f},
-std::array<float,2>{0.932431042f, 0.394269615f},
-std::array<float,2>{0.517438471f, 0.919331729f},
-std::array<float,2>{0.475232601f, 0.114298426f},
-std::array<float,2>{0.405715048f, 0.668854773f},
-std::array<float,2>{0.613960922f, 0.276344925f},
-std::array<float,2>{0.958323658f, 0.821301937f},
-std::array<float,2>{0.169432744f, 0.205607951f},
-std::array<float,2>{0.07420066f, 0.997756958f},
-std::array<float,2>{0.753714621f, 0.0388533771f},
-std::array<float,2>{0.734925091f, 0.548770308f},
-std::array<float,2>{0.266512752f, 0.463367343f},
-std::array<float,2>{0.462454647f, 0.903802395f},
-std::array<float,2>{0.561323524f, 0.0682739466f},
-std::array<float,2>{0.89428246f, 0.600013494f},
-std::array<float,2>{0.241373107f, 0.416052669f},
-std::array<float,2>{0.0309173521f, 0.693426371f},
-std::array<float,2>{0.816516399f, 0.325108886f},
-std::array<float,2>{0.650036335f, 0.794245362f},
-std::array<float,2>{0.332497805f, 0.13795948f},
-std::array<float,2>{0.305008262f, 0.502345502f},
-std::array<float,2>{0.705753088f, 0.485310823f},
-std::array<float,2>{0.795371056f, 0.946624279f},
-std::array<float,2>{0.0999370068f, 0.0308481976f},
-std::array<float,2>{0.135384202f, 0.874824882f},
-std::array<float,2>{0.975065887f, 0.221597537f},
-std::array<float,2>{0.582721472f, 0.634201348f},
-std::array<float,2>{0.421603769f, 0.285169184f},
-std::array<float,2>{0.481379122f, 0.788141131f},
-std::array<float,2>{0.525799453f, 0.130581334f},
-std::array<float,2>{0.927231371f, 0.70065403f},
-std::array<float,2>{0.192216441f, 0.320240468f},
-std::array<float,2>{0.0437896587f, 0.609248817f},
-std::array<float,2>{0.874019682f, 0.413163364f},
-std::array<float,2>{0.679774642f, 0.894099295f},
-std::array<float,2>{0.370740861f, 0.0774086416f},
-std::array<float,2>{0.277864248f, 0.628020823f},
-std::array<float,2>{0.747541666f, 0.295747548f},
-std::array<float,2>{0.765019834f, 0.866005838f},
-std::array<float,2>{0.0679436028f, 0.226970911f},
-std::array<float,2>{0.159423068f, 0.944930136f},
-std::array<float,2>{0.962380707f, 0.022803193f},
-std::array<float,2>{0.622223258f, 0.509984016f},
-std::array<float,2>{0.397001445f, 0.493384004f},
-std::array<float,2>{0.337547153f, 0.908848464f},
-std::array<float,2>{0.642719269f, 0.118584655f},
-std::array<float,2>{0.826847494f, 0.591222048f},
-std::array<float,2>{0.0230418872f, 0.401286781f},
-std::array<float,2>{0.245804191f, 0.749181628f},
-std::array<float,2>{0.902316809f, 0.360858619f},
-std::array<float,2>{0.551057339f, 0.768942714f},
-std::array<float,2>{0.458525449f, 0.170575082f},
-std::array<float,2>{0.413203984f, 0.556516767f},
-std::array<float,2>{0.592729151f, 0.454637289f},
-std::array<float,2>{0.98179549f, 0.990763485f},
-std::array<float,2>{0.127101973f, 0.0457284674f},
-std::array<float,2>{0.108483583f, 0.820075095f},
-std::array<float,2>{0.787363112f, 0.214504197f},
-std::array<float,2>{0.715934217f, 0.656334698f},
-std::array<float,2>{0.301701456f, 0.267211348f},
-std::array<float,2>{0.288283587f, 0.859234929f},
-std::array<float,2>{0.700766325f, 0.242834374f},
-std::array<float,2>{0.811552644f, 0.655181646f},
-std::array<float,2>{0.122880101f, 0.310191602f},
-std::array<float,2>{0.152613655f, 0.52780515f},
-std::array<float,2>{0.986617565f, 0.468921125f},
-std::array<float,2>{0.564770877f, 0.956129432f},
-std::array<float,2>{0.427685142f, 0.0127791492f},
-std::array<float,2>{0.438770324f, 0.716731787f},
-std::array<float,2>{0.543034792f, 0.329321414f},
-std::array<float,2>{0.887491405f, 0.803433597f},
-std::array<float,2>{0.224723458f, 0.147611767f},
-std::array<float,2>{0.0125314975f, 0.888538718f},
-std::array<float,2>{0.828488171f, 0.0914451629f},
-std::array<float,2>{0.6350227f, 0.612102866f},
-std::array<float,2>{0.3185727f, 0.427342445f},
-std::array<float,2>{0.380687892f, 0.970373809f},
-std::array<float,2>{0.602720857f, 0.0562855937f},
-std::array<float,2>{0.946052909f, 0.543598831f},
-std::array<float,2>{0.185465813f, 0.445483446f},
-std::array<float,2>{0.0889889672f, 0.674784958f},
-std::array<float,2>{0.776984036f, 0.256630361f},
-std::array<float,2>{0.730171919f, 0.828941941f},
-std::array<float,2>{0.263482511f, 0.19593358f},
-std::array<float,2>{0.350383282f, 0.569254816f},
-std::array<float,2>{0.666885078f, 0.384536088f},
-std::array<float,2>{0.856630981f, 0.931080043f},
-std::array<float,2>{0.0484970286f, 0.102783501f},
-std::array<float,2>{0.213109821f, 0.755273819f},
-std::array<float,2>{0.910926044f, 0.183078542f},
-std::array<float,2>{0.503188789f, 0.722662926f},
-std::array<float,2>{0.487633616f, 0.354286462f},
-std::array<float,2>{0.392963767f, 0.758478642f},
-std::array<float,2>{0.62100327f, 0.174324006f},
-std::array<float,2>{0.967209756f, 0.727678239f},
-std::array<float,2>{0.163459599f, 0.346135557f},
-std::array<float,2>{0.0640544444f, 0.573661745f},
-std::array<float,2>{0.759039462f, 0.380764127f},
-std::array<float,2>{0.742651641f, 0.921921015f},
-std::array<float,2>{0.275970757f, 0.0959455818f},
-std::array<float,2>{0.371285349f, 0.686601877f},
-std::array<float,2>{0.683625102f, 0.258908361f},
-std::array<float,2>{0.867949367f, 0.839382112f},
-std::array<float,2>{0.0394759849f, 0.191319078f},
-std::array<float,2>{0.190137938f, 0.981585801f},
-std::array<float,2>{0.921922386f, 0.0476316884f},
-std::array<float,2>{0.52980423f, 0.538014889f},
-std::array<float,2>{0.478118151f, 0.43894574f},
-std::array<float,2>{0.299307853f, 0.875792086f},
-std::array<float,2>{0.71373409f, 0.0781665891f},
-std::array<float,2>{0.781802952f, 0.620604038f},
-std::array<float,2>{0.104969606f, 0.430193484f},
-std::array<float,2>{0.129495412f, 0.707542658f},
-std::array<float,2>{0.979883671f, 0.337006509f},
-std::array<float,2>{0.586863756f, 0.806612909f},
-std::array<float,2>{0.406490266f, 0.148683012f},
-std::array<float,2>{0.456021667f, 0.520471156f},
-std::array<float,2>{0.547751307f, 0.484305054f},
-std::array<float,2>{0.90512687f, 0.963278472f},
-std::array<float,2>{0.246704742f, 0.00667117722f},
-std::array<float,2>{0.0180723909f, 0.847625971f},
-std::array<float,2>{0.821733117f, 0.237655252f},
-std::array<float,2>{0.646802187f, 0.645800173f},
-std::array<float,2>{0.340561658f, 0.29875949f},
-std::array<float,2>{0.313714623f, 0.825974643f},
-std::array<float,2>{0.638294518f, 0.210664615f},
-std::array<float,2>{0.835040867f, 0.665191293f},
-std::array<float,2>{0.00855642278f, 0.277401179f},
-std::array<float,2>{0.221063837f, 0.551338911f},
-std::array<float,2>{0.883177221f, 0.466885298f},
-std::array<float,2>{0.539307714f, 0.99341476f},
-std::array<float,2>{0.443431258f, 0.0321873426f},
-std::array<float,2>{0.423138022f, 0.741447806f},
-std::array<float,2>{0.567139983f, 0.374124229f},
-std::array<float,2>{0.99171108f, 0.77723074f},
-std::array<float,2>{0.150121823f, 0.162229016f},
-std::array<float,2>{0.118529759f, 0.917436957f},
-std::array<float,2>{0.806106031f, 0.112202436f},
-std::array<float,2>{0.69683212f, 0.581237316f},
-std::array<float,2>{0.283376515f, 0.398288637f},
-std::array<float,2>{0.490107536f, 0.952600658f},
-std::array<float,2>{0.507113993f, 0.026937779f},
-std::array<float,2>{0.908851683f, 0.507128298f},
-std::array<float,2>{0.21602793f, 0.491575032f},
-std::array<float,2>{0.0522372983f, 0.638748109f},
-std::array<float,2>{0.851749599f, 0.282386214f},
-std::array<float,2>{0.667997777f, 0.868321717f},
-std::array<float,2>{0.346898168f, 0.225687757f},
-std::array<float,2>{0.261611968f, 0.596848369f},
-std::array<float,2>{0.73414433f, 0.418123543f},
-std::array<float,2>{0.781115055f, 0.900331318f},
-std::array<float,2>{0.093295902f, 0.0641842112f},
-std::array<float,2>{0.180690169f, 0.792435467f},
-std::array<float,2>{0.949932516f, 0.135623023f},
-std::array<float,2>{0.607915521f, 0.689680159f},
-std::array<float,2>{0.377427846f, 0.322155356f},
-std::array<float,2>{0.447753131f, 0.860022902f},
-std::array<float,2>{0.535184443f, 0.231692702f},
-std::array<float,2>{0.881603479f, 0.632484078f},
-std::array<float,2>{0.226691589f, 0.291740268f},
-std::array<float,2>{0.000370884605f, 0.5127545f},
-std::array<float,2>{0.840553463f, 0.499308407f},
-std::array<float,2>{0.632302821f, 0.94048214f},
-std::array<float,2>{0.323186129f, 0.0170011651f},
-std::array<float,2>{0.289489895f, 0.697196841f},
-std::array<float,2>{0.693827331f, 0.314235836f},
-std::array<float,2>{0.800329506f, 0.781408191f},
-std::array<float,2>{0.109588124f, 0.126737133f},
-std::array<float,2>{0.142955676f, 0.897396743f},
-std::array<float,2>{0.996101618f, 0.0739929453f},
-std::array<float,2>{0.574115396f, 0.604478419f},
-std::array<float,2>{0.434720725f, 0.408972919f},
-std::array<float,2>{0.353975743f, 0.986008048f},
-std::array<float,2>{0.662354648f, 0.0395469405f},
-std::array<float,2>{0.845856786f, 0.560233176f},
-std::array<float,2>{0.0556917451f, 0.457083076f},
-std::array<float,2>{0.205255151f, 0.661179662f},
-std::array<float,2>{0.915353537f, 0.273012012f},
-std::array<float,2>{0.509259999f, 0.81342262f},
-std::array<float,2>{0.492432594f, 0.216023371f},
-std::array<float,2>{0.383761495f, 0.587902248f},
-std::array<float,2>{0.597772956f, 0.404593438f},
-std::array<float,2>{0.940387845f, 0.913030744f},
-std::array<float,2>{0.172063813f, 0.122950569f},
-std::array<float,2>{0.0808824524f, 0.770782769f},
-std::array<float,2>{0.766876638f, 0.167362213f},
-std::array<float,2>{0.725536287f, 0.745843649f},
-std::array<float,2>{0.257352769f, 0.365554661f},
-std::array<float,2>{0.269785047f, 0.797463536f},
-std::array<float,2>{0.740984261f, 0.144070804f},
-std::array<float,2>{0.756677449f, 0.713508904f},
-std::array<float,2>{0.0749332905f, 0.33589384f},
-std::array<float,2>{0.165997028f, 0.615666151f},
-std::array<float,2>{0.954616129f, 0.423597008f},
-std::array<float,2>{0.609913111f, 0.883545101f},
-std::array<float,2>{0.400723934f, 0.0874790177f},
-std::array<float,2>{0.472297162f, 0.648561001f},
-std::array<float,2>{0.522265017f, 0.307907641f},
-std::array<float,2>{0.935745358f, 0.853369415f},
-std::array<float,2>{0.19934319f, 0.246876791f},
-std::array<float,2>{0.0345808268f, 0.960715711f},
-std::array<float,2>{0.862619042f, 0.0109427599f},
-std::array<float,2>{0.673530996f, 0.525599718f},
-std::array<float,2>{0.365111172f, 0.473147482f},
-std::array<float,2>{0.416992158f, 0.934325576f},
-std::array<float,2>{0.581542492f, 0.106640384f},
-std::array<float,2>{0.96940583f, 0.563605368f},
-std::array<float,2>{0.140212789f, 0.390095264f},
-std::array<float,2>{0.096392706f, 0.721104443f},
-std::array<float,2>{0.79268688f, 0.357698679f},
-std::array<float,2>{0.708065033f, 0.750505567f},
-std::array<float,2>{0.30928424f, 0.184020296f},
-std::array<float,2>{0.329709262f, 0.539556623f},
-std::array<float,2>{0.65301764f, 0.451826185f},
-std::array<float,2>{0.814564943f, 0.975010157f},
-std::array<float,2>{0.0267291255f, 0.0610029921f},
-std::array<float,2>{0.235713214f, 0.833980739f},
-std::array<float,2>{0.895558238f, 0.199434459f},
-std::array<float,2>{0.555389762f, 0.676100671f},
-std::array<float,2>{0.465560883f, 0.250514925f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.653067589f, 0.820817411f},
-std::array<float,2>{0.0309483986f, 0.180353731f},
-std::array<float,2>{0.491433382f, 0.634595513f},
-std::array<float,2>{0.889015794f, 0.330066562f},
-std::array<float,2>{0.753186226f, 0.549666405f},
-std::array<float,2>{0.274449706f, 0.421429217f},
-std::array<float,2>{0.248070523f, 0.903217316f},
-std::array<float,2>{0.584727526f, 0.0846814811f},
-std::array<float,2>{0.510806561f, 0.707735777f},
-std::array<float,2>{0.133069962f, 0.266761154f},
-std::array<float,2>{0.373447478f, 0.775625169f},
-std::array<float,2>{0.861002803f, 0.202929839f},
-std::array<float,2>{0.949924946f, 0.95466578f},
-std::array<float,2>{0.413068652f, 0.0227125045f},
-std::array<float,2>{0.107021317f, 0.567336857f},
-std::array<float,2>{0.720696688f, 0.472365737f},
-std::array<float,2>{0.604413331f, 0.916634321f},
-std::array<float,2>{0.18903026f, 0.105433241f},
-std::array<float,2>{0.285418123f, 0.502247453f},
-std::array<float,2>{0.808685541f, 0.376692146f},
-std::array<float,2>{0.926852167f, 0.674600542f},
-std::array<float,2>{0.459509104f, 0.348994106f},
-std::array<float,2>{0.0596254505f, 0.845293343f},
-std::array<float,2>{0.663436234f, 0.128916338f},
-std::array<float,2>{0.716622531f, 0.607098401f},
-std::array<float,2>{0.0738591552f, 0.446228594f},
-std::array<float,2>{0.392684966f, 0.99929589f},
-std::array<float,2>{0.989616811f, 0.0349791162f},
-std::array<float,2>{0.822999895f, 0.809392691f},
-std::array<float,2>{0.328336984f, 0.233856902f},
-std::array<float,2>{0.16340144f, 0.724539161f},
-std::array<float,2>{0.561650634f, 0.29444766f},
-std::array<float,2>{0.741991997f, 0.977705359f},
-std::array<float,2>{0.123366997f, 0.0589315966f},
-std::array<float,2>{0.425631016f, 0.621773481f},
-std::array<float,2>{0.961003423f, 0.46775946f},
-std::array<float,2>{0.855749607f, 0.7401402f},
-std::array<float,2>{0.35035044f, 0.304882497f},
-std::array<float,2>{0.145438969f, 0.790162504f},
-std::array<float,2>{0.529695153f, 0.239706606f},
-std::array<float,2>{0.565891147f, 0.530969441f},
-std::array<float,2>{0.222046211f, 0.391964108f},
-std::array<float,2>{0.261680275f, 0.923654914f},
-std::array<float,2>{0.776480556f, 0.112762138f},
-std::array<float,2>{0.891452372f, 0.873375237f},
-std::array<float,2>{0.481180787f, 0.152619675f},
-std::array<float,2>{0.0111962277f, 0.663017452f},
-std::array<float,2>{0.63412416f, 0.369815856f},
-std::array<float,2>{0.537330508f, 0.753221095f},
-std::array<float,2>{0.186145708f, 0.206852078f},
-std::array<float,2>{0.327525735f, 0.693486571f},
-std::array<float,2>{0.839027584f, 0.257592738f},
-std::array<float,2>{0.970544159f, 0.587532043f},
-std::array<float,2>{0.375391573f, 0.491408587f},
-std::array<float,2>{0.0856196657f, 0.94802922f},
-std::array<float,2>{0.699452281f, 0.0107096396f},
-std::array<float,2>{0.675967813f, 0.64730525f},
-std::array<float,2>{0.0339878872f, 0.327192903f},
-std::array<float,2>{0.44770816f, 0.833717525f},
-std::array<float,2>{0.911743581f, 0.169580102f},
-std::array<float,2>{0.790795684f, 0.889101326f},
-std::array<float,2>{0.310135007f, 0.0641912892f},
-std::array<float,2>{0.209159687f, 0.540116072f},
-std::array<float,2>{0.618966401f, 0.427327245f},
-std::array<float,2>{0.688460052f, 0.78551358f},
-std::array<float,2>{0.0860329568f, 0.243319511f},
-std::array<float,2>{0.383347422f, 0.745330393f},
-std::array<float,2>{0.979541481f, 0.302422971f},
-std::array<float,2>{0.832916617f, 0.614059925f},
-std::array<float,2>{0.313669473f, 0.456013411f},
-std::array<float,2>{0.172882915f, 0.976247609f},
-std::array<float,2>{0.546166182f, 0.0520614386f},
-std::array<float,2>{0.616990268f, 0.671133578f},
-std::array<float,2>{0.216362685f, 0.362777293f},
-std::array<float,2>{0.297423214f, 0.863248467f},
-std::array<float,2>{0.781591117f, 0.143882707f},
-std::array<float,2>{0.919208109f, 0.937141657f},
-std::array<float,2>{0.440599978f, 0.121137165f},
-std::array<float,2>{0.0430850051f, 0.519375443f},
-std::array<float,2>{0.686632335f, 0.403637648f},
-std::array<float,2>{0.516469002f, 0.940506101f},
-std::array<float,2>{0.148993298f, 0.0029789675f},
-std::array<float,2>{0.357259989f, 0.585435331f},
-std::array<float,2>{0.845105708f, 0.495738804f},
-std::array<float,2>{0.958570719f, 0.702287734f},
-std::array<float,2>{0.433535814f, 0.258007407f},
-std::array<float,2>{0.11679481f, 0.759081542f},
-std::array<float,2>{0.747918069f, 0.214076027f},
-std::array<float,2>{0.62629354f, 0.537556708f},
-std::array<float,2>{0.0022061835f, 0.437108129f},
-std::array<float,2>{0.475600988f, 0.875298738f},
-std::array<float,2>{0.901792407f, 0.0712516159f},
-std::array<float,2>{0.769961894f, 0.842385709f},
-std::array<float,2>{0.256009728f, 0.162453309f},
-std::array<float,2>{0.23126772f, 0.655553877f},
-std::array<float,2>{0.576518774f, 0.314971f},
-std::array<float,2>{0.670482814f, 0.898131132f},
-std::array<float,2>{0.0532339327f, 0.0866466463f},
-std::array<float,2>{0.463964373f, 0.556292236f},
-std::array<float,2>{0.937165141f, 0.410534382f},
-std::array<float,2>{0.804144144f, 0.629066586f},
-std::array<float,2>{0.29323104f, 0.338139564f},
-std::array<float,2>{0.19910647f, 0.818936348f},
-std::array<float,2>{0.598968625f, 0.174209073f},
-std::array<float,2>{0.55172807f, 0.577384055f},
-std::array<float,2>{0.168869004f, 0.47866562f},
-std::array<float,2>{0.342906445f, 0.96242696f},
-std::array<float,2>{0.818172693f, 0.0266794655f},
-std::array<float,2>{0.994587898f, 0.773332417f},
-std::array<float,2>{0.400626987f, 0.190031186f},
-std::array<float,2>{0.067443423f, 0.718463421f},
-std::array<float,2>{0.704313576f, 0.280756027f},
-std::array<float,2>{0.59317106f, 0.858114481f},
-std::array<float,2>{0.236307144f, 0.139728531f},
-std::array<float,2>{0.27327776f, 0.682038486f},
-std::array<float,2>{0.762649715f, 0.357919127f},
-std::array<float,2>{0.881554842f, 0.512912929f},
-std::array<float,2>{0.49340263f, 0.38847971f},
-std::array<float,2>{0.0218594652f, 0.90793556f},
-std::array<float,2>{0.644614518f, 0.0978550538f},
-std::array<float,2>{0.72669965f, 0.729844689f},
-std::array<float,2>{0.097186543f, 0.287976146f},
-std::array<float,2>{0.419772476f, 0.804321706f},
-std::array<float,2>{0.938778281f, 0.220080867f},
-std::array<float,2>{0.872830153f, 0.990659833f},
-std::array<float,2>{0.362676293f, 0.0465974696f},
-std::array<float,2>{0.12753278f, 0.595853746f},
-std::array<float,2>{0.507484496f, 0.440088689f},
-std::array<float,2>{0.683370054f, 0.779736996f},
-std::array<float,2>{0.0429171249f, 0.195355088f},
-std::array<float,2>{0.445219964f, 0.70335865f},
-std::array<float,2>{0.915077865f, 0.272743046f},
-std::array<float,2>{0.786357641f, 0.563982844f},
-std::array<float,2>{0.301119149f, 0.473518252f},
-std::array<float,2>{0.214712664f, 0.960709393f},
-std::array<float,2>{0.610960603f, 0.0189733319f},
-std::array<float,2>{0.540591359f, 0.63708055f},
-std::array<float,2>{0.175846741f, 0.333105952f},
-std::array<float,2>{0.317171991f, 0.828078389f},
-std::array<float,2>{0.82861501f, 0.187298328f},
-std::array<float,2>{0.982698917f, 0.899123847f},
-std::array<float,2>{0.387751281f, 0.079829067f},
-std::array<float,2>{0.0914184451f, 0.553812861f},
-std::array<float,2>{0.69180119f, 0.417400986f},
-std::array<float,2>{0.573442936f, 0.993851602f},
-std::array<float,2>{0.229443908f, 0.0359748416f},
-std::array<float,2>{0.252428353f, 0.603737235f},
-std::array<float,2>{0.767112136f, 0.450524002f},
-std::array<float,2>{0.903150022f, 0.720284462f},
-std::array<float,2>{0.472361952f, 0.289172709f},
-std::array<float,2>{0.00717138266f, 0.807871222f},
-std::array<float,2>{0.631476462f, 0.228691772f},
-std::array<float,2>{0.745443583f, 0.506361902f},
-std::array<float,2>{0.111239471f, 0.380989969f},
-std::array<float,2>{0.436625689f, 0.918684363f},
-std::array<float,2>{0.955804169f, 0.108730227f},
-std::array<float,2>{0.85130775f, 0.850987554f},
-std::array<float,2>{0.353219628f, 0.127769098f},
-std::array<float,2>{0.152349234f, 0.678661704f},
-std::array<float,2>{0.520295918f, 0.344946086f},
-std::array<float,2>{0.70890373f, 0.927852154f},
-std::array<float,2>{0.064233996f, 0.115944669f},
-std::array<float,2>{0.403746933f, 0.524051011f},
-std::array<float,2>{0.997762442f, 0.395277828f},
-std::array<float,2>{0.813919604f, 0.65960753f},
-std::array<float,2>{0.336886585f, 0.37346229f},
-std::array<float,2>{0.165714115f, 0.869982719f},
-std::array<float,2>{0.548159719f, 0.150372878f},
-std::array<float,2>{0.594702184f, 0.619319141f},
-std::array<float,2>{0.201325119f, 0.46477589f},
-std::array<float,2>{0.291281223f, 0.983965695f},
-std::array<float,2>{0.797066569f, 0.0557822809f},
-std::array<float,2>{0.93290323f, 0.794407845f},
-std::array<float,2>{0.468419641f, 0.235589683f},
-std::array<float,2>{0.0506502539f, 0.737503707f},
-std::array<float,2>{0.665197313f, 0.311991036f},
-std::array<float,2>{0.501862824f, 0.831422687f},
-std::array<float,2>{0.131353959f, 0.165897027f},
-std::array<float,2>{0.365978479f, 0.6420995f},
-std::array<float,2>{0.86899811f, 0.321134299f},
-std::array<float,2>{0.941998243f, 0.545052171f},
-std::array<float,2>{0.414807469f, 0.424935043f},
-std::array<float,2>{0.0987027362f, 0.88304615f},
-std::array<float,2>{0.732264221f, 0.0678391755f},
-std::array<float,2>{0.642691851f, 0.689384103f},
-std::array<float,2>{0.0176709667f, 0.250433594f},
-std::array<float,2>{0.498773396f, 0.756196141f},
-std::array<float,2>{0.875537217f, 0.209570691f},
-std::array<float,2>{0.760237873f, 0.95254755f},
-std::array<float,2>{0.267169565f, 0.0156056741f},
-std::array<float,2>{0.241789848f, 0.593454957f},
-std::array<float,2>{0.586354971f, 0.484992623f},
-std::array<float,2>{0.724723339f, 0.867172956f},
-std::array<float,2>{0.103158139f, 0.145076811f},
-std::array<float,2>{0.406281859f, 0.666320741f},
-std::array<float,2>{0.946324587f, 0.364090085f},
-std::array<float,2>{0.864087582f, 0.520179689f},
-std::array<float,2>{0.369140208f, 0.400153309f},
-std::array<float,2>{0.136958227f, 0.930741608f},
-std::array<float,2>{0.513195455f, 0.119230069f},
-std::array<float,2>{0.578908861f, 0.747973919f},
-std::array<float,2>{0.243708402f, 0.299587309f},
-std::array<float,2>{0.278651327f, 0.781825483f},
-std::array<float,2>{0.754354894f, 0.247611016f},
-std::array<float,2>{0.883439779f, 0.968856633f},
-std::array<float,2>{0.485350698f, 0.0484863333f},
-std::array<float,2>{0.0244474821f, 0.610108614f},
-std::array<float,2>{0.651730895f, 0.458641648f},
-std::array<float,2>{0.557971299f, 0.881576717f},
-std::array<float,2>{0.158749923f, 0.0743595883f},
-std::array<float,2>{0.33518824f, 0.535014272f},
-std::array<float,2>{0.824973285f, 0.433228731f},
-std::array<float,2>{0.985725343f, 0.650300264f},
-std::array<float,2>{0.395828605f, 0.318234116f},
-std::array<float,2>{0.0772396699f, 0.836305141f},
-std::array<float,2>{0.712838352f, 0.156530052f},
-std::array<float,2>{0.658229947f, 0.581176519f},
-std::array<float,2>{0.0572536848f, 0.498350948f},
-std::array<float,2>{0.453160524f, 0.942423105f},
-std::array<float,2>{0.921907544f, 0.00660182862f},
-std::array<float,2>{0.807619452f, 0.762207866f},
-std::array<float,2>{0.281374335f, 0.215030164f},
-std::array<float,2>{0.194076225f, 0.695993543f},
-std::array<float,2>{0.606620252f, 0.263612211f},
-std::array<float,2>{0.638061762f, 0.964924037f},
-std::array<float,2>{0.0148175806f, 0.027397655f},
-std::array<float,2>{0.479402512f, 0.572417498f},
-std::array<float,2>{0.895455301f, 0.481310219f},
-std::array<float,2>{0.780251861f, 0.712357283f},
-std::array<float,2>{0.265594393f, 0.277341545f},
-std::array<float,2>{0.225592881f, 0.766432941f},
-std::array<float,2>{0.568322241f, 0.194842398f},
-std::array<float,2>{0.524375081f, 0.560954869f},
-std::array<float,2>{0.142605036f, 0.408281147f},
-std::array<float,2>{0.347536415f, 0.892449439f},
-std::array<float,2>{0.852223396f, 0.0930416286f},
-std::array<float,2>{0.965858161f, 0.813908696f},
-std::array<float,2>{0.426392436f, 0.177146539f},
-std::array<float,2>{0.120313033f, 0.62637943f},
-std::array<float,2>{0.736865699f, 0.341515839f},
-std::array<float,2>{0.62227869f, 0.797355533f},
-std::array<float,2>{0.205086946f, 0.223573372f},
-std::array<float,2>{0.307276756f, 0.733670354f},
-std::array<float,2>{0.79584527f, 0.282649696f},
-std::array<float,2>{0.907402694f, 0.600481868f},
-std::array<float,2>{0.451190621f, 0.442907453f},
-std::array<float,2>{0.0357158035f, 0.984935939f},
-std::array<float,2>{0.673001766f, 0.0412332788f},
-std::array<float,2>{0.699138224f, 0.684282899f},
-std::array<float,2>{0.0812554434f, 0.352096915f},
-std::array<float,2>{0.379521102f, 0.852513909f},
-std::array<float,2>{0.975059509f, 0.136669591f},
-std::array<float,2>{0.840153337f, 0.912743509f},
-std::array<float,2>{0.320541769f, 0.0944754556f},
-std::array<float,2>{0.180453524f, 0.51163584f},
-std::array<float,2>{0.5327124f, 0.385154009f},
-std::array<float,2>{0.660682678f, 0.845901966f},
-std::array<float,2>{0.0609268248f, 0.130981326f},
-std::array<float,2>{0.458691269f, 0.673313558f},
-std::array<float,2>{0.929541588f, 0.351407707f},
-std::array<float,2>{0.811737359f, 0.500775993f},
-std::array<float,2>{0.287148356f, 0.378532261f},
-std::array<float,2>{0.190298408f, 0.915058553f},
-std::array<float,2>{0.601718664f, 0.102655791f},
-std::array<float,2>{0.55872947f, 0.726238847f},
-std::array<float,2>{0.162009463f, 0.295494944f},
-std::array<float,2>{0.331959307f, 0.81196475f},
-std::array<float,2>{0.820835471f, 0.230701789f},
-std::array<float,2>{0.991086841f, 0.996800959f},
-std::array<float,2>{0.392033815f, 0.0331526473f},
-std::array<float,2>{0.0717356727f, 0.607840836f},
-std::array<float,2>{0.71761477f, 0.447495937f},
-std::array<float,2>{0.583122611f, 0.905889511f},
-std::array<float,2>{0.247650743f, 0.0827492476f},
-std::array<float,2>{0.276608348f, 0.547379375f},
-std::array<float,2>{0.751145661f, 0.419262141f},
-std::array<float,2>{0.88791281f, 0.6349774f},
-std::array<float,2>{0.489656717f, 0.332028478f},
-std::array<float,2>{0.0274828672f, 0.822601259f},
-std::array<float,2>{0.655415714f, 0.182940587f},
-std::array<float,2>{0.722216308f, 0.569879174f},
-std::array<float,2>{0.109108977f, 0.470264137f},
-std::array<float,2>{0.410379589f, 0.955763698f},
-std::array<float,2>{0.952488363f, 0.0196426008f},
-std::array<float,2>{0.861477911f, 0.774104953f},
-std::array<float,2>{0.371412367f, 0.200088874f},
-std::array<float,2>{0.135033116f, 0.709492862f},
-std::array<float,2>{0.50948447f, 0.269156486f},
-std::array<float,2>{0.702050984f, 0.946522772f},
-std::array<float,2>{0.0837749094f, 0.00936865434f},
-std::array<float,2>{0.378675908f, 0.588690639f},
-std::array<float,2>{0.972015619f, 0.488538712f},
-std::array<float,2>{0.836958408f, 0.69212997f},
-std::array<float,2>{0.324657202f, 0.255791128f},
-std::array<float,2>{0.184248775f, 0.751461387f},
-std::array<float,2>{0.536305428f, 0.203864127f},
-std::array<float,2>{0.620688796f, 0.54253453f},
-std::array<float,2>{0.208500236f, 0.42821151f},
-std::array<float,2>{0.311413378f, 0.887067556f},
-std::array<float,2>{0.792851448f, 0.0661874041f},
-std::array<float,2>{0.913726151f, 0.834127605f},
-std::array<float,2>{0.446806014f, 0.170266926f},
-std::array<float,2>{0.0320963673f, 0.645559609f},
-std::array<float,2>{0.678914666f, 0.325427324f},
-std::array<float,2>{0.529169977f, 0.791691661f},
-std::array<float,2>{0.14843598f, 0.241340041f},
-std::array<float,2>{0.348748833f, 0.740737617f},
-std::array<float,2>{0.858637333f, 0.306964606f},
-std::array<float,2>{0.964003026f, 0.624736607f},
-std::array<float,2>{0.423484057f, 0.466537029f},
-std::array<float,2>{0.12188869f, 0.979704261f},
-std::array<float,2>{0.739076436f, 0.0624013245f},
-std::array<float,2>{0.635933518f, 0.660438538f},
-std::array<float,2>{0.00894435868f, 0.367522448f},
-std::array<float,2>{0.482593715f, 0.871751904f},
-std::array<float,2>{0.892994344f, 0.155288771f},
-std::array<float,2>{0.774603426f, 0.924381554f},
-std::array<float,2>{0.258551598f, 0.110027209f},
-std::array<float,2>{0.2190561f, 0.528482437f},
-std::array<float,2>{0.562949955f, 0.393921196f},
-std::array<float,2>{0.748284042f, 0.761336267f},
-std::array<float,2>{0.11349304f, 0.212277308f},
-std::array<float,2>{0.43116799f, 0.699779689f},
-std::array<float,2>{0.959500551f, 0.261031806f},
-std::array<float,2>{0.846120119f, 0.582229018f},
-std::array<float,2>{0.358718038f, 0.492240816f},
-std::array<float,2>{0.15118961f, 0.93913734f},
-std::array<float,2>{0.517822921f, 0.00103477354f},
-std::array<float,2>{0.574764907f, 0.65406853f},
-std::array<float,2>{0.234147385f, 0.31355232f},
-std::array<float,2>{0.255374283f, 0.840529561f},
-std::array<float,2>{0.772121727f, 0.160562783f},
-std::array<float,2>{0.899104595f, 0.878846288f},
-std::array<float,2>{0.47416535f, 0.0735169202f},
-std::array<float,2>{0.00107780076f, 0.535611212f},
-std::array<float,2>{0.627341032f, 0.435352683f},
-std::array<float,2>{0.542998314f, 0.972689033f},
-std::array<float,2>{0.174180791f, 0.0529181063f},
-std::array<float,2>{0.315077513f, 0.617090404f},
-std::array<float,2>{0.834959924f, 0.454632133f},
-std::array<float,2>{0.977375984f, 0.742574751f},
-std::array<float,2>{0.385203391f, 0.303389698f},
-std::array<float,2>{0.0885967389f, 0.787836909f},
-std::array<float,2>{0.689614654f, 0.245056137f},
-std::array<float,2>{0.684877932f, 0.517092586f},
-std::array<float,2>{0.0458166711f, 0.40432182f},
-std::array<float,2>{0.438703477f, 0.933875263f},
-std::array<float,2>{0.920071363f, 0.124943122f},
-std::array<float,2>{0.785102487f, 0.860938191f},
-std::array<float,2>{0.300412178f, 0.140946299f},
-std::array<float,2>{0.217464015f, 0.669364452f},
-std::array<float,2>{0.613861024f, 0.359971493f},
-std::array<float,2>{0.646945417f, 0.908669591f},
-std::array<float,2>{0.0196222458f, 0.100819916f},
-std::array<float,2>{0.494308949f, 0.513799429f},
-std::array<float,2>{0.880614817f, 0.390315413f},
-std::array<float,2>{0.764574051f, 0.681546152f},
-std::array<float,2>{0.271250665f, 0.357335687f},
-std::array<float,2>{0.23792626f, 0.85565722f},
-std::array<float,2>{0.589923143f, 0.137978733f},
-std::array<float,2>{0.503953755f, 0.59462148f},
-std::array<float,2>{0.125514716f, 0.439338237f},
-std::array<float,2>{0.36061734f, 0.989353418f},
-std::array<float,2>{0.873631656f, 0.0442703404f},
-std::array<float,2>{0.939655721f, 0.800998926f},
-std::array<float,2>{0.420685083f, 0.22195746f},
-std::array<float,2>{0.0949817076f, 0.726752996f},
-std::array<float,2>{0.728881538f, 0.285419673f},
-std::array<float,2>{0.600572824f, 0.816926181f},
-std::array<float,2>{0.196196839f, 0.172460884f},
-std::array<float,2>{0.295578867f, 0.631554663f},
-std::array<float,2>{0.801025569f, 0.336379647f},
-std::array<float,2>{0.935136199f, 0.556872666f},
-std::array<float,2>{0.461586535f, 0.412909627f},
-std::array<float,2>{0.0510828458f, 0.894623578f},
-std::array<float,2>{0.668808937f, 0.0881441683f},
-std::array<float,2>{0.706704319f, 0.7149297f},
-std::array<float,2>{0.0697650313f, 0.277652442f},
-std::array<float,2>{0.39994213f, 0.76977706f},
-std::array<float,2>{0.992661357f, 0.188755006f},
-std::array<float,2>{0.819424272f, 0.9640221f},
-std::array<float,2>{0.340718329f, 0.025107244f},
-std::array<float,2>{0.171394974f, 0.57429564f},
-std::array<float,2>{0.55442977f, 0.477855086f},
-std::array<float,2>{0.630623102f, 0.805859327f},
-std::array<float,2>{0.00494134426f, 0.227132142f},
-std::array<float,2>{0.469712764f, 0.721373975f},
-std::array<float,2>{0.905272007f, 0.291267276f},
-std::array<float,2>{0.769216061f, 0.60204488f},
-std::array<float,2>{0.250362396f, 0.452520639f},
-std::array<float,2>{0.227411717f, 0.995849669f},
-std::array<float,2>{0.572175026f, 0.0374285802f},
-std::array<float,2>{0.522437572f, 0.677353561f},
-std::array<float,2>{0.154312655f, 0.347171575f},
-std::array<float,2>{0.354061484f, 0.849156141f},
-std::array<float,2>{0.847754896f, 0.126486227f},
-std::array<float,2>{0.954742372f, 0.92028445f},
-std::array<float,2>{0.43502453f, 0.106244005f},
-std::array<float,2>{0.11133045f, 0.504073262f},
-std::array<float,2>{0.743777156f, 0.379621387f},
-std::array<float,2>{0.613009095f, 0.958095968f},
-std::array<float,2>{0.211783156f, 0.0161697511f},
-std::array<float,2>{0.303002179f, 0.566325545f},
-std::array<float,2>{0.788930297f, 0.475434721f},
-std::array<float,2>{0.917684615f, 0.706049919f},
-std::array<float,2>{0.442370802f, 0.271339118f},
-std::array<float,2>{0.0407221429f, 0.779161513f},
-std::array<float,2>{0.68050462f, 0.197576851f},
-std::array<float,2>{0.694800258f, 0.552133918f},
-std::array<float,2>{0.0925012529f, 0.414962739f},
-std::array<float,2>{0.390236765f, 0.902235389f},
-std::array<float,2>{0.982283473f, 0.0814832821f},
-std::array<float,2>{0.831353486f, 0.825835347f},
-std::array<float,2>{0.32027927f, 0.184017435f},
-std::array<float,2>{0.178410247f, 0.638932407f},
-std::array<float,2>{0.541969955f, 0.335693449f},
-std::array<float,2>{0.733804584f, 0.88625288f},
-std::array<float,2>{0.101554312f, 0.0694410652f},
-std::array<float,2>{0.417410374f, 0.543003321f},
-std::array<float,2>{0.945163548f, 0.422317982f},
-std::array<float,2>{0.871025026f, 0.643509686f},
-std::array<float,2>{0.363553017f, 0.323860079f},
-std::array<float,2>{0.130414143f, 0.829483867f},
-std::array<float,2>{0.502039313f, 0.167512402f},
-std::array<float,2>{0.588100672f, 0.59072125f},
-std::array<float,2>{0.238982663f, 0.487196475f},
-std::array<float,2>{0.268192142f, 0.949485958f},
-std::array<float,2>{0.758073032f, 0.0126908105f},
-std::array<float,2>{0.878059208f, 0.755115926f},
-std::array<float,2>{0.496925712f, 0.207551003f},
-std::array<float,2>{0.01579885f, 0.689993262f},
-std::array<float,2>{0.641046286f, 0.252079606f},
-std::array<float,2>{0.550461233f, 0.869023979f},
-std::array<float,2>{0.166817382f, 0.151159763f},
-std::array<float,2>{0.339610368f, 0.656719267f},
-std::array<float,2>{0.816017032f, 0.372665226f},
-std::array<float,2>{0.999841273f, 0.52552563f},
-std::array<float,2>{0.40562427f, 0.39666751f},
-std::array<float,2>{0.0662299246f, 0.926698923f},
-std::array<float,2>{0.709737301f, 0.114263602f},
-std::array<float,2>{0.667954206f, 0.735324502f},
-std::array<float,2>{0.0487521403f, 0.308618367f},
-std::array<float,2>{0.465419829f, 0.79597348f},
-std::array<float,2>{0.931150198f, 0.237874523f},
-std::array<float,2>{0.800095379f, 0.981667757f},
-std::array<float,2>{0.290005624f, 0.0574821606f},
-std::array<float,2>{0.200942129f, 0.618652999f},
-std::array<float,2>{0.597337306f, 0.461843789f},
-std::array<float,2>{0.714730978f, 0.837958455f},
-std::array<float,2>{0.0756244883f, 0.15825741f},
-std::array<float,2>{0.396522254f, 0.650902092f},
-std::array<float,2>{0.986523807f, 0.318594605f},
-std::array<float,2>{0.826896966f, 0.532335699f},
-std::array<float,2>{0.33393535f, 0.431474596f},
-std::array<float,2>{0.157397315f, 0.880386293f},
-std::array<float,2>{0.556520224f, 0.0771790445f},
-std::array<float,2>{0.608390749f, 0.697513163f},
-std::array<float,2>{0.191873297f, 0.265523076f},
-std::array<float,2>{0.284925967f, 0.764143109f},
-std::array<float,2>{0.806122541f, 0.217447147f},
-std::array<float,2>{0.924567223f, 0.945186913f},
-std::array<float,2>{0.456720352f, 0.0042215921f},
-std::array<float,2>{0.056444481f, 0.578139961f},
-std::array<float,2>{0.656729519f, 0.496247888f},
-std::array<float,2>{0.513752222f, 0.931984663f},
-std::array<float,2>{0.139828309f, 0.117738977f},
-std::array<float,2>{0.369253308f, 0.522172987f},
-std::array<float,2>{0.866537869f, 0.400905311f},
-std::array<float,2>{0.947514057f, 0.664156497f},
-std::array<float,2>{0.40865922f, 0.36576134f},
-std::array<float,2>{0.105368242f, 0.863407075f},
-std::array<float,2>{0.723384917f, 0.147546902f},
-std::array<float,2>{0.650324762f, 0.612909317f},
-std::array<float,2>{0.027122274f, 0.459597439f},
-std::array<float,2>{0.488145471f, 0.972247601f},
-std::array<float,2>{0.885365546f, 0.0506955385f},
-std::array<float,2>{0.756827772f, 0.783465326f},
-std::array<float,2>{0.280065984f, 0.24868308f},
-std::array<float,2>{0.244558543f, 0.748245418f},
-std::array<float,2>{0.581755579f, 0.297902703f},
-std::array<float,2>{0.675679505f, 0.986550629f},
-std::array<float,2>{0.038645301f, 0.039150089f},
-std::array<float,2>{0.450444072f, 0.597738266f},
-std::array<float,2>{0.908242583f, 0.444226533f},
-std::array<float,2>{0.793960214f, 0.730569661f},
-std::array<float,2>{0.306530178f, 0.283798099f},
-std::array<float,2>{0.204480663f, 0.800031185f},
-std::array<float,2>{0.624144137f, 0.225311309f},
-std::array<float,2>{0.534643054f, 0.509626091f},
-std::array<float,2>{0.182049632f, 0.384291887f},
-std::array<float,2>{0.322693169f, 0.910923719f},
-std::array<float,2>{0.842921436f, 0.0965515152f},
-std::array<float,2>{0.974551857f, 0.854475379f},
-std::array<float,2>{0.382692784f, 0.133349031f},
-std::array<float,2>{0.0786846653f, 0.685703754f},
-std::array<float,2>{0.695732832f, 0.353985965f},
-std::array<float,2>{0.569672227f, 0.768369615f},
-std::array<float,2>{0.224332869f, 0.192427903f},
-std::array<float,2>{0.262711972f, 0.713960469f},
-std::array<float,2>{0.778010666f, 0.275103331f},
-std::array<float,2>{0.897251368f, 0.571377516f},
-std::array<float,2>{0.47736451f, 0.484230638f},
-std::array<float,2>{0.0131709473f, 0.967600703f},
-std::array<float,2>{0.639133394f, 0.0293656792f},
-std::array<float,2>{0.735675335f, 0.62776798f},
-std::array<float,2>{0.117500231f, 0.342397302f},
-std::array<float,2>{0.429460943f, 0.815210998f},
-std::array<float,2>{0.968079209f, 0.179675698f},
-std::array<float,2>{0.855378509f, 0.892898381f},
-std::array<float,2>{0.345685571f, 0.0915150717f},
-std::array<float,2>{0.140636265f, 0.560264409f},
-std::array<float,2>{0.526528716f, 0.407285869f},
-std::array<float,2>{0.633548379f, 0.872693121f},
-std::array<float,2>{0.0103998212f, 0.154593155f},
-std::array<float,2>{0.482072085f, 0.661359549f},
-std::array<float,2>{0.891992271f, 0.368758619f},
-std::array<float,2>{0.776215255f, 0.527988493f},
-std::array<float,2>{0.259802043f, 0.392856896f},
-std::array<float,2>{0.220743388f, 0.924950659f},
-std::array<float,2>{0.565348208f, 0.110381924f},
-std::array<float,2>{0.530350089f, 0.741740525f},
-std::array<float,2>{0.14583081f, 0.307827294f},
-std::array<float,2>{0.351373643f, 0.792617559f},
-std::array<float,2>{0.857338607f, 0.240413353f},
-std::array<float,2>{0.962791443f, 0.97942096f},
-std::array<float,2>{0.424068272f, 0.061386589f},
-std::array<float,2>{0.124055274f, 0.623946249f},
-std::array<float,2>{0.741153538f, 0.465218961f},
-std::array<float,2>{0.618015587f, 0.888446391f},
-std::array<float,2>{0.210930392f, 0.0654167235f},
-std::array<float,2>{0.309457868f, 0.541130602f},
-std::array<float,2>{0.789165318f, 0.42918095f},
-std::array<float,2>{0.911027789f, 0.644625068f},
-std::array<float,2>{0.448429197f, 0.324629039f},
-std::array<float,2>{0.0348047614f, 0.835317731f},
-std::array<float,2>{0.677178741f, 0.171141103f},
-std::array<float,2>{0.700380504f, 0.588998735f},
-std::array<float,2>{0.084660612f, 0.490004987f},
-std::array<float,2>{0.376653075f, 0.945922196f},
-std::array<float,2>{0.968845367f, 0.00818044227f},
-std::array<float,2>{0.838257134f, 0.750717044f},
-std::array<float,2>{0.326907337f, 0.204654649f},
-std::array<float,2>{0.186950982f, 0.692450643f},
-std::array<float,2>{0.538633108f, 0.254377306f},
-std::array<float,2>{0.719613969f, 0.956408262f},
-std::array<float,2>{0.106123269f, 0.0205959883f},
-std::array<float,2>{0.413752019f, 0.568745375f},
-std::array<float,2>{0.95053339f, 0.468924344f},
-std::array<float,2>{0.860258818f, 0.710815609f},
-std::array<float,2>{0.374594897f, 0.268418252f},
-std::array<float,2>{0.134385765f, 0.775237024f},
-std::array<float,2>{0.509967089f, 0.200626716f},
-std::array<float,2>{0.585321963f, 0.548639596f},
-std::array<float,2>{0.249074504f, 0.41886887f},
-std::array<float,2>{0.273491204f, 0.90433985f},
-std::array<float,2>{0.75268501f, 0.0833915398f},
-std::array<float,2>{0.890477836f, 0.82346797f},
-std::array<float,2>{0.490579873f, 0.182607517f},
-std::array<float,2>{0.0300431512f, 0.636422157f},
-std::array<float,2>{0.65347451f, 0.330713898f},
-std::array<float,2>{0.560728252f, 0.811252654f},
-std::array<float,2>{0.162953079f, 0.231504321f},
-std::array<float,2>{0.329390198f, 0.724973977f},
-std::array<float,2>{0.823621213f, 0.29595685f},
-std::array<float,2>{0.988417268f, 0.609202385f},
-std::array<float,2>{0.393728703f, 0.44843623f},
-std::array<float,2>{0.0729692206f, 0.997424304f},
-std::array<float,2>{0.715661287f, 0.0319512598f},
-std::array<float,2>{0.662901163f, 0.672583222f},
-std::array<float,2>{0.0586149916f, 0.349661887f},
-std::array<float,2>{0.460308045f, 0.847009718f},
-std::array<float,2>{0.926029742f, 0.132435352f},
-std::array<float,2>{0.809688389f, 0.91486299f},
-std::array<float,2>{0.286360383f, 0.102206551f},
-std::array<float,2>{0.187523037f, 0.501803458f},
-std::array<float,2>{0.604937553f, 0.377282351f},
-std::array<float,2>{0.703410089f, 0.770742118f},
-std::array<float,2>{0.0666346774f, 0.187593564f},
-std::array<float,2>{0.401426643f, 0.716228068f},
-std::array<float,2>{0.995151401f, 0.279268682f},
-std::array<float,2>{0.816609502f, 0.575707138f},
-std::array<float,2>{0.342087239f, 0.476810127f},
-std::array<float,2>{0.169759646f, 0.963348091f},
-std::array<float,2>{0.552102327f, 0.0235315431f},
-std::array<float,2>{0.597920656f, 0.632145286f},
-std::array<float,2>{0.198088571f, 0.33745417f},
-std::array<float,2>{0.294538319f, 0.818118811f},
-std::array<float,2>{0.802751958f, 0.173028558f},
-std::array<float,2>{0.936285436f, 0.896092892f},
-std::array<float,2>{0.463839322f, 0.088969551f},
-std::array<float,2>{0.0545704998f, 0.557753265f},
-std::array<float,2>{0.671005726f, 0.413787007f},
-std::array<float,2>{0.506754637f, 0.988713562f},
-std::array<float,2>{0.128385052f, 0.0434816927f},
-std::array<float,2>{0.362110525f, 0.594759464f},
-std::array<float,2>{0.871573865f, 0.438076377f},
-std::array<float,2>{0.937742352f, 0.727908492f},
-std::array<float,2>{0.418670714f, 0.286446899f},
-std::array<float,2>{0.0964618996f, 0.802493215f},
-std::array<float,2>{0.727905393f, 0.221351162f},
-std::array<float,2>{0.646278739f, 0.51508081f},
-std::array<float,2>{0.0231565833f, 0.389047116f},
-std::array<float,2>{0.493160635f, 0.909769058f},
-std::array<float,2>{0.882540107f, 0.100211635f},
-std::array<float,2>{0.763548315f, 0.856823623f},
-std::array<float,2>{0.271493971f, 0.137181208f},
-std::array<float,2>{0.234583527f, 0.680273294f},
-std::array<float,2>{0.591869652f, 0.355741501f},
-std::array<float,2>{0.685777247f, 0.934671819f},
-std::array<float,2>{0.0442861766f, 0.123613745f},
-std::array<float,2>{0.439725488f, 0.515912771f},
-std::array<float,2>{0.918567002f, 0.405882657f},
-std::array<float,2>{0.782968998f, 0.668868124f},
-std::array<float,2>{0.298444301f, 0.360843122f},
-std::array<float,2>{0.21531108f, 0.85953331f},
-std::array<float,2>{0.615426242f, 0.141919389f},
-std::array<float,2>{0.545745194f, 0.615400016f},
-std::array<float,2>{0.172652766f, 0.453614205f},
-std::array<float,2>{0.312543541f, 0.973670244f},
-std::array<float,2>{0.833767235f, 0.0538101606f},
-std::array<float,2>{0.97856307f, 0.788720131f},
-std::array<float,2>{0.383933276f, 0.245730251f},
-std::array<float,2>{0.087476626f, 0.743866146f},
-std::array<float,2>{0.68859458f, 0.303885043f},
-std::array<float,2>{0.577845514f, 0.841231525f},
-std::array<float,2>{0.232224226f, 0.161326036f},
-std::array<float,2>{0.257252157f, 0.652556121f},
-std::array<float,2>{0.77114588f, 0.313071847f},
-std::array<float,2>{0.900899947f, 0.536483526f},
-std::array<float,2>{0.475562125f, 0.434565514f},
-std::array<float,2>{0.0032392249f, 0.87764132f},
-std::array<float,2>{0.625018895f, 0.0729591474f},
-std::array<float,2>{0.746281624f, 0.700703621f},
-std::array<float,2>{0.116014622f, 0.260220975f},
-std::array<float,2>{0.432130098f, 0.760503232f},
-std::array<float,2>{0.957172275f, 0.211069673f},
-std::array<float,2>{0.843856514f, 0.937500536f},
-std::array<float,2>{0.356080979f, 0.00060641882f},
-std::array<float,2>{0.149589956f, 0.583458841f},
-std::array<float,2>{0.516958654f, 0.493798465f},
-std::array<float,2>{0.664607763f, 0.795236409f},
-std::array<float,2>{0.0491522253f, 0.236807719f},
-std::array<float,2>{0.467395902f, 0.735973597f},
-std::array<float,2>{0.931834996f, 0.310382992f},
-std::array<float,2>{0.798244715f, 0.618063807f},
-std::array<float,2>{0.292967319f, 0.461960971f},
-std::array<float,2>{0.202295288f, 0.98052609f},
-std::array<float,2>{0.594745219f, 0.05775984f},
-std::array<float,2>{0.547440708f, 0.657863498f},
-std::array<float,2>{0.164863348f, 0.371620387f},
-std::array<float,2>{0.337384194f, 0.867846608f},
-std::array<float,2>{0.81286037f, 0.151855633f},
-std::array<float,2>{0.996768773f, 0.927216887f},
-std::array<float,2>{0.403018802f, 0.113890864f},
-std::array<float,2>{0.0629274398f, 0.527169526f},
-std::array<float,2>{0.70784539f, 0.397749096f},
-std::array<float,2>{0.587457657f, 0.951141953f},
-std::array<float,2>{0.241112873f, 0.0127084823f},
-std::array<float,2>{0.265752763f, 0.590944529f},
-std::array<float,2>{0.760802507f, 0.488275051f},
-std::array<float,2>{0.876439035f, 0.691382945f},
-std::array<float,2>{0.499523431f, 0.25311783f},
-std::array<float,2>{0.0192292649f, 0.754698813f},
-std::array<float,2>{0.643636465f, 0.20820874f},
-std::array<float,2>{0.731081367f, 0.54402411f},
-std::array<float,2>{0.0983314812f, 0.423825413f},
-std::array<float,2>{0.415417582f, 0.885659873f},
-std::array<float,2>{0.942565918f, 0.0687069446f},
-std::array<float,2>{0.867783546f, 0.82888031f},
-std::array<float,2>{0.366563827f, 0.166337758f},
-std::array<float,2>{0.132608786f, 0.644011199f},
-std::array<float,2>{0.500601649f, 0.322528183f},
-std::array<float,2>{0.693204105f, 0.900509894f},
-std::array<float,2>{0.0905098096f, 0.0809375048f},
-std::array<float,2>{0.386789948f, 0.551487684f},
-std::array<float,2>{0.984120965f, 0.415100843f},
-std::array<float,2>{0.830001533f, 0.640177488f},
-std::array<float,2>{0.317704588f, 0.334769398f},
-std::array<float,2>{0.1770183f, 0.824857295f},
-std::array<float,2>{0.539784074f, 0.18554683f},
-std::array<float,2>{0.609943748f, 0.56453383f},
-std::array<float,2>{0.213406384f, 0.476473242f},
-std::array<float,2>{0.302010357f, 0.957157731f},
-std::array<float,2>{0.785499513f, 0.0174733773f},
-std::array<float,2>{0.914803147f, 0.778056145f},
-std::array<float,2>{0.443368703f, 0.198410541f},
-std::array<float,2>{0.0419260785f, 0.706984639f},
-std::array<float,2>{0.681977749f, 0.269826919f},
-std::array<float,2>{0.521154881f, 0.847778559f},
-std::array<float,2>{0.153761014f, 0.125125676f},
-std::array<float,2>{0.351576626f, 0.67666322f},
-std::array<float,2>{0.849940062f, 0.346596569f},
-std::array<float,2>{0.956910074f, 0.504960239f},
-std::array<float,2>{0.436255366f, 0.380532652f},
-std::array<float,2>{0.109554574f, 0.921267867f},
-std::array<float,2>{0.745045185f, 0.10693863f},
-std::array<float,2>{0.632443964f, 0.722264469f},
-std::array<float,2>{0.00621162634f, 0.292937785f},
-std::array<float,2>{0.47118336f, 0.805414319f},
-std::array<float,2>{0.903470159f, 0.227883324f},
-std::array<float,2>{0.765803456f, 0.99431628f},
-std::array<float,2>{0.253011018f, 0.0390537567f},
-std::array<float,2>{0.229727685f, 0.602960587f},
-std::array<float,2>{0.572675049f, 0.451982647f},
-std::array<float,2>{0.737797916f, 0.815964997f},
-std::array<float,2>{0.119345784f, 0.17792736f},
-std::array<float,2>{0.426988751f, 0.628630519f},
-std::array<float,2>{0.965195715f, 0.34347406f},
-std::array<float,2>{0.853176177f, 0.559322715f},
-std::array<float,2>{0.346040428f, 0.407104582f},
-std::array<float,2>{0.144156739f, 0.894179642f},
-std::array<float,2>{0.524424195f, 0.0902119055f},
-std::array<float,2>{0.567210019f, 0.712994933f},
-std::array<float,2>{0.224719197f, 0.274390072f},
-std::array<float,2>{0.264467806f, 0.769374609f},
-std::array<float,2>{0.78069973f, 0.192338377f},
-std::array<float,2>{0.895583153f, 0.967893422f},
-std::array<float,2>{0.480112404f, 0.0304901134f},
-std::array<float,2>{0.0143364426f, 0.571175098f},
-std::array<float,2>{0.637115657f, 0.483283192f},
-std::array<float,2>{0.531392992f, 0.912042618f},
-std::array<float,2>{0.180880129f, 0.0968220383f},
-std::array<float,2>{0.32200402f, 0.508502901f},
-std::array<float,2>{0.840877056f, 0.383232743f},
-std::array<float,2>{0.975678623f, 0.686525822f},
-std::array<float,2>{0.380063266f, 0.354579389f},
-std::array<float,2>{0.0801558867f, 0.854697585f},
-std::array<float,2>{0.697721422f, 0.133850813f},
-std::array<float,2>{0.672614336f, 0.599551201f},
-std::array<float,2>{0.0369556546f, 0.444770992f},
-std::array<float,2>{0.452871323f, 0.98815465f},
-std::array<float,2>{0.906286836f, 0.0403791294f},
-std::array<float,2>{0.796113253f, 0.799137831f},
-std::array<float,2>{0.307947516f, 0.226332679f},
-std::array<float,2>{0.206221804f, 0.732023358f},
-std::array<float,2>{0.622021198f, 0.284552008f},
-std::array<float,2>{0.65063411f, 0.97115761f},
-std::array<float,2>{0.0241480563f, 0.0489550084f},
-std::array<float,2>{0.485599071f, 0.611933112f},
-std::array<float,2>{0.883809865f, 0.460058719f},
-std::array<float,2>{0.755390823f, 0.749203801f},
-std::array<float,2>{0.27766183f, 0.297363013f},
-std::array<float,2>{0.242584631f, 0.784525692f},
-std::array<float,2>{0.580044925f, 0.249798179f},
-std::array<float,2>{0.512675643f, 0.523229659f},
-std::array<float,2>{0.138133913f, 0.401613593f},
-std::array<float,2>{0.368028581f, 0.933022916f},
-std::array<float,2>{0.865170777f, 0.118189618f},
-std::array<float,2>{0.945497334f, 0.864718795f},
-std::array<float,2>{0.408175856f, 0.14717488f},
-std::array<float,2>{0.102179863f, 0.665712297f},
-std::array<float,2>{0.725921571f, 0.366529107f},
-std::array<float,2>{0.606111407f, 0.764999032f},
-std::array<float,2>{0.195005253f, 0.218521416f},
-std::array<float,2>{0.282598853f, 0.698636055f},
-std::array<float,2>{0.807576597f, 0.263963997f},
-std::array<float,2>{0.923822939f, 0.579521894f},
-std::array<float,2>{0.454794705f, 0.498034418f},
-std::array<float,2>{0.0582121722f, 0.944262803f},
-std::array<float,2>{0.659753919f, 0.00563751115f},
-std::array<float,2>{0.711289406f, 0.651808977f},
-std::array<float,2>{0.0767195225f, 0.3195225f},
-std::array<float,2>{0.394897044f, 0.839742243f},
-std::array<float,2>{0.984733164f, 0.15935576f},
-std::array<float,2>{0.82523787f, 0.879726768f},
-std::array<float,2>{0.334949374f, 0.0771195516f},
-std::array<float,2>{0.160030186f, 0.53163898f},
-std::array<float,2>{0.556664824f, 0.4303101f},
-std::array<float,2>{0.678528666f, 0.832901359f},
-std::array<float,2>{0.0331586972f, 0.168687269f},
-std::array<float,2>{0.446051151f, 0.648354948f},
-std::array<float,2>{0.912732184f, 0.326223582f},
-std::array<float,2>{0.79106307f, 0.53979367f},
-std::array<float,2>{0.312258691f, 0.426139921f},
-std::array<float,2>{0.207828969f, 0.89048785f},
-std::array<float,2>{0.620015621f, 0.0634486154f},
-std::array<float,2>{0.535477996f, 0.695162714f},
-std::array<float,2>{0.184577182f, 0.256286323f},
-std::array<float,2>{0.326055527f, 0.752545416f},
-std::array<float,2>{0.836347878f, 0.205996513f},
-std::array<float,2>{0.971065938f, 0.948677659f},
-std::array<float,2>{0.37775901f, 0.0116340322f},
-std::array<float,2>{0.0827960521f, 0.58604902f},
-std::array<float,2>{0.702746809f, 0.490443468f},
-std::array<float,2>{0.563597202f, 0.922809005f},
-std::array<float,2>{0.220431685f, 0.111757159f},
-std::array<float,2>{0.259363621f, 0.529600978f},
-std::array<float,2>{0.774112344f, 0.390733451f},
-std::array<float,2>{0.894090533f, 0.66312027f},
-std::array<float,2>{0.483982414f, 0.371076345f},
-std::array<float,2>{0.00876656827f, 0.874109983f},
-std::array<float,2>{0.635506094f, 0.154206231f},
-std::array<float,2>{0.739448845f, 0.622082651f},
-std::array<float,2>{0.122368485f, 0.46778059f},
-std::array<float,2>{0.42216754f, 0.976888597f},
-std::array<float,2>{0.963302612f, 0.0599876679f},
-std::array<float,2>{0.857988f, 0.789767981f},
-std::array<float,2>{0.347686261f, 0.238449931f},
-std::array<float,2>{0.14688094f, 0.738465369f},
-std::array<float,2>{0.527871251f, 0.305822313f},
-std::array<float,2>{0.718044639f, 0.998400331f},
-std::array<float,2>{0.0707707927f, 0.0332825594f},
-std::array<float,2>{0.391357392f, 0.606277347f},
-std::array<float,2>{0.991464138f, 0.44660598f},
-std::array<float,2>{0.822064936f, 0.723304033f},
-std::array<float,2>{0.331054091f, 0.293677688f},
-std::array<float,2>{0.16060558f, 0.809713423f},
-std::array<float,2>{0.559910297f, 0.233207181f},
-std::array<float,2>{0.602598071f, 0.503392518f},
-std::array<float,2>{0.191216975f, 0.375928015f},
-std::array<float,2>{0.288488388f, 0.91796273f},
-std::array<float,2>{0.81068784f, 0.103919275f},
-std::array<float,2>{0.928498328f, 0.843859732f},
-std::array<float,2>{0.45735094f, 0.130618006f},
-std::array<float,2>{0.0621858612f, 0.675085604f},
-std::array<float,2>{0.661742806f, 0.348492533f},
-std::array<float,2>{0.508094132f, 0.776548803f},
-std::array<float,2>{0.135829419f, 0.201419026f},
-std::array<float,2>{0.37270385f, 0.708881438f},
-std::array<float,2>{0.863168836f, 0.265987247f},
-std::array<float,2>{0.951304018f, 0.567542434f},
-std::array<float,2>{0.411526173f, 0.471263498f},
-std::array<float,2>{0.107922651f, 0.953900278f},
-std::array<float,2>{0.721436322f, 0.0224318188f},
-std::array<float,2>{0.654979944f, 0.63339442f},
-std::array<float,2>{0.0287682712f, 0.328712702f},
-std::array<float,2>{0.488506585f, 0.821725786f},
-std::array<float,2>{0.887015939f, 0.180719003f},
-std::array<float,2>{0.750144243f, 0.903375506f},
-std::array<float,2>{0.275668204f, 0.0858291909f},
-std::array<float,2>{0.246932819f, 0.549809277f},
-std::array<float,2>{0.582355261f, 0.420422137f},
-std::array<float,2>{0.729847908f, 0.802751303f},
-std::array<float,2>{0.0945831686f, 0.219534829f},
-std::array<float,2>{0.421009749f, 0.729413152f},
-std::array<float,2>{0.941236496f, 0.288517565f},
-std::array<float,2>{0.874911964f, 0.597598433f},
-std::array<float,2>{0.359578341f, 0.44091171f},
-std::array<float,2>{0.126021773f, 0.991928875f},
-std::array<float,2>{0.504949272f, 0.0455255136f},
-std::array<float,2>{0.591005087f, 0.683056772f},
-std::array<float,2>{0.236439958f, 0.358834565f},
-std::array<float,2>{0.269788831f, 0.859325588f},
-std::array<float,2>{0.764901698f, 0.139312327f},
-std::array<float,2>{0.879065514f, 0.906816304f},
-std::array<float,2>{0.495165527f, 0.099291265f},
-std::array<float,2>{0.0205815043f, 0.512643099f},
-std::array<float,2>{0.647964954f, 0.386994898f},
-std::array<float,2>{0.553491116f, 0.961237371f},
-std::array<float,2>{0.170362547f, 0.0260333046f},
-std::array<float,2>{0.340831578f, 0.576899767f},
-std::array<float,2>{0.818390548f, 0.479894519f},
-std::array<float,2>{0.993858099f, 0.716863871f},
-std::array<float,2>{0.39866218f, 0.279777169f},
-std::array<float,2>{0.06863074f, 0.771781802f},
-std::array<float,2>{0.705431461f, 0.190821737f},
-std::array<float,2>{0.669752896f, 0.554945052f},
-std::array<float,2>{0.0526334792f, 0.41172719f},
-std::array<float,2>{0.461945564f, 0.897078991f},
-std::array<float,2>{0.934505701f, 0.0876881629f},
-std::array<float,2>{0.802725255f, 0.819588721f},
-std::array<float,2>{0.296365768f, 0.174983695f},
-std::array<float,2>{0.196663752f, 0.630314589f},
-std::array<float,2>{0.600595832f, 0.339011014f},
-std::array<float,2>{0.628892481f, 0.876548827f},
-std::array<float,2>{0.000821780181f, 0.0720000714f},
-std::array<float,2>{0.473478228f, 0.538787425f},
-std::array<float,2>{0.899605811f, 0.436180681f},
-std::array<float,2>{0.772902787f, 0.654401779f},
-std::array<float,2>{0.254308075f, 0.316207886f},
-std::array<float,2>{0.233337849f, 0.84322691f},
-std::array<float,2>{0.575255275f, 0.163385749f},
-std::array<float,2>{0.519143999f, 0.584397495f},
-std::array<float,2>{0.151635945f, 0.494950145f},
-std::array<float,2>{0.358205765f, 0.940272093f},
-std::array<float,2>{0.847102284f, 0.00288887764f},
-std::array<float,2>{0.960817456f, 0.758255601f},
-std::array<float,2>{0.430298865f, 0.212924436f},
-std::array<float,2>{0.114819899f, 0.701943636f},
-std::array<float,2>{0.749896467f, 0.259030461f},
-std::array<float,2>{0.615054607f, 0.862155497f},
-std::array<float,2>{0.218276083f, 0.142718926f},
-std::array<float,2>{0.299539149f, 0.670639992f},
-std::array<float,2>{0.783511519f, 0.361977965f},
-std::array<float,2>{0.921828806f, 0.518220961f},
-std::array<float,2>{0.437886924f, 0.402475029f},
-std::array<float,2>{0.0468462594f, 0.935981393f},
-std::array<float,2>{0.684228003f, 0.123020381f},
-std::array<float,2>{0.691028535f, 0.744980454f},
-std::array<float,2>{0.0896754637f, 0.301304102f},
-std::array<float,2>{0.385951996f, 0.786537051f},
-std::array<float,2>{0.978106797f, 0.242647275f},
-std::array<float,2>{0.835784137f, 0.975041211f},
-std::array<float,2>{0.315884322f, 0.0511264019f},
-std::array<float,2>{0.175669834f, 0.614881814f},
-std::array<float,2>{0.544295847f, 0.456659138f},
-std::array<float,2>{0.641653299f, 0.757793307f},
-std::array<float,2>{0.0172061119f, 0.210107729f},
-std::array<float,2>{0.497599244f, 0.688029647f},
-std::array<float,2>{0.877046049f, 0.251004785f},
-std::array<float,2>{0.759741664f, 0.592488229f},
-std::array<float,2>{0.268690079f, 0.486283153f},
-std::array<float,2>{0.23961781f, 0.951883435f},
-std::array<float,2>{0.589823961f, 0.0137992334f},
-std::array<float,2>{0.503878295f, 0.641090035f},
-std::array<float,2>{0.129388243f, 0.321948558f},
-std::array<float,2>{0.3647587f, 0.830173671f},
-std::array<float,2>{0.87003392f, 0.164767519f},
-std::array<float,2>{0.94356513f, 0.884050429f},
-std::array<float,2>{0.416426748f, 0.0668830425f},
-std::array<float,2>{0.100315571f, 0.546746373f},
-std::array<float,2>{0.733213186f, 0.424126536f},
-std::array<float,2>{0.596182406f, 0.982528985f},
-std::array<float,2>{0.199728966f, 0.0547495857f},
-std::array<float,2>{0.290156007f, 0.620225608f},
-std::array<float,2>{0.799505055f, 0.463435411f},
-std::array<float,2>{0.930098057f, 0.736468673f},
-std::array<float,2>{0.465841979f, 0.310608655f},
-std::array<float,2>{0.0473115928f, 0.793110788f},
-std::array<float,2>{0.666199565f, 0.234475836f},
-std::array<float,2>{0.710121512f, 0.524485707f},
-std::array<float,2>{0.0646053478f, 0.396388769f},
-std::array<float,2>{0.404415101f, 0.929421663f},
-std::array<float,2>{0.998342991f, 0.117112875f},
-std::array<float,2>{0.814453244f, 0.870347619f},
-std::array<float,2>{0.338707983f, 0.1484593f},
-std::array<float,2>{0.16720368f, 0.658649981f},
-std::array<float,2>{0.549250126f, 0.374126852f},
-std::array<float,2>{0.743104339f, 0.919324994f},
-std::array<float,2>{0.112356074f, 0.108092219f},
-std::array<float,2>{0.434006035f, 0.507541597f},
-std::array<float,2>{0.954004645f, 0.382371604f},
-std::array<float,2>{0.848975241f, 0.679244757f},
-std::array<float,2>{0.355277777f, 0.344222814f},
-std::array<float,2>{0.155938938f, 0.850456655f},
-std::array<float,2>{0.523046851f, 0.128269389f},
-std::array<float,2>{0.57100594f, 0.604692578f},
-std::array<float,2>{0.227988392f, 0.449445009f},
-std::array<float,2>{0.25144577f, 0.99254638f},
-std::array<float,2>{0.768518269f, 0.0362543873f},
-std::array<float,2>{0.905300438f, 0.807443321f},
-std::array<float,2>{0.469755203f, 0.229682848f},
-std::array<float,2>{0.0044488688f, 0.719459593f},
-std::array<float,2>{0.629360557f, 0.29071328f},
-std::array<float,2>{0.542665541f, 0.826332569f},
-std::array<float,2>{0.178954303f, 0.185615495f},
-std::array<float,2>{0.318883866f, 0.638246655f},
-std::array<float,2>{0.83104521f, 0.332170069f},
-std::array<float,2>{0.981136322f, 0.553458869f},
-std::array<float,2>{0.389564961f, 0.416990429f},
-std::array<float,2>{0.0933123901f, 0.899840355f},
-std::array<float,2>{0.693667829f, 0.0789516941f},
-std::array<float,2>{0.680824041f, 0.704552472f},
-std::array<float,2>{0.0398547277f, 0.272357613f},
-std::array<float,2>{0.44332087f, 0.780632079f},
-std::array<float,2>{0.91680795f, 0.196825862f},
-std::array<float,2>{0.78805691f, 0.959305167f},
-std::array<float,2>{0.304494232f, 0.0183372907f},
-std::array<float,2>{0.212459564f, 0.562708378f},
-std::array<float,2>{0.611932695f, 0.474551231f},
-std::array<float,2>{0.697056234f, 0.852707267f},
-std::array<float,2>{0.0795231536f, 0.135284498f},
-std::array<float,2>{0.381647021f, 0.684911728f},
-std::array<float,2>{0.973325849f, 0.353019685f},
-std::array<float,2>{0.842126012f, 0.510685146f},
-std::array<float,2>{0.323484749f, 0.385862619f},
-std::array<float,2>{0.182755828f, 0.913428009f},
-std::array<float,2>{0.533701658f, 0.0953233689f},
-std::array<float,2>{0.623941839f, 0.732705832f},
-std::array<float,2>{0.203239471f, 0.282156199f},
-std::array<float,2>{0.305288762f, 0.798086584f},
-std::array<float,2>{0.793807805f, 0.224516675f},
-std::array<float,2>{0.909927666f, 0.985933006f},
-std::array<float,2>{0.449636668f, 0.0428691469f},
-std::array<float,2>{0.0379118957f, 0.600921273f},
-std::array<float,2>{0.674352467f, 0.442057818f},
-std::array<float,2>{0.525539696f, 0.891463935f},
-std::array<float,2>{0.141952798f, 0.0919765234f},
-std::array<float,2>{0.344441146f, 0.56243068f},
-std::array<float,2>{0.853651464f, 0.409692675f},
-std::array<float,2>{0.967228055f, 0.625471473f},
-std::array<float,2>{0.428553492f, 0.340399951f},
-std::array<float,2>{0.118690751f, 0.813450396f},
-std::array<float,2>{0.735297501f, 0.176718086f},
-std::array<float,2>{0.640053868f, 0.573493719f},
-std::array<float,2>{0.0117786173f, 0.481948793f},
-std::array<float,2>{0.4777385f, 0.965850651f},
-std::array<float,2>{0.898299873f, 0.0289188046f},
-std::array<float,2>{0.778361619f, 0.766934395f},
-std::array<float,2>{0.261947602f, 0.194310367f},
-std::array<float,2>{0.223352864f, 0.711731672f},
-std::array<float,2>{0.569303811f, 0.27587989f},
-std::array<float,2>{0.657849431f, 0.941754639f},
-std::array<float,2>{0.0556305535f, 0.00685447687f},
-std::array<float,2>{0.455592215f, 0.58074981f},
-std::array<float,2>{0.925679445f, 0.499650061f},
-std::array<float,2>{0.805510402f, 0.696712613f},
-std::array<float,2>{0.283771485f, 0.26264444f},
-std::array<float,2>{0.192685828f, 0.762821615f},
-std::array<float,2>{0.608651519f, 0.21655564f},
-std::array<float,2>{0.555001318f, 0.533239722f},
-std::array<float,2>{0.157096177f, 0.432212025f},
-std::array<float,2>{0.332960695f, 0.882391572f},
-std::array<float,2>{0.827977359f, 0.0756795108f},
-std::array<float,2>{0.98793155f, 0.837501943f},
-std::array<float,2>{0.397787392f, 0.158034548f},
-std::array<float,2>{0.0748814419f, 0.648845136f},
-std::array<float,2>{0.713468611f, 0.317140788f},
-std::array<float,2>{0.580979288f, 0.782486737f},
-std::array<float,2>{0.245956287f, 0.246742487f},
-std::array<float,2>{0.280902267f, 0.746453047f},
-std::array<float,2>{0.757207453f, 0.299896419f},
-std::array<float,2>{0.886374891f, 0.610742807f},
-std::array<float,2>{0.487209678f, 0.457754701f},
-std::array<float,2>{0.0258398205f, 0.969853818f},
-std::array<float,2>{0.648610711f, 0.0470069237f},
-std::array<float,2>{0.72373867f, 0.667538106f},
-std::array<float,2>{0.104234509f, 0.364364117f},
-std::array<float,2>{0.410064548f, 0.866204858f},
-std::array<float,2>{0.948874533f, 0.145830676f},
-std::array<float,2>{0.865630746f, 0.930471897f},
-std::array<float,2>{0.370598763f, 0.120355643f},
-std::array<float,2>{0.139042109f, 0.520543039f},
-std::array<float,2>{0.515563965f, 0.398959816f},
-std::array<float,2>{0.625570655f, 0.843675435f},
-std::array<float,2>{0.00373508781f, 0.164059639f},
-std::array<float,2>{0.474656045f, 0.655020893f},
-std::array<float,2>{0.900813401f, 0.315538615f},
-std::array<float,2>{0.770656168f, 0.538497269f},
-std::array<float,2>{0.257326394f, 0.43555513f},
-std::array<float,2>{0.231703892f, 0.87637496f},
-std::array<float,2>{0.577473581f, 0.0713208765f},
-std::array<float,2>{0.517150819f, 0.701597393f},
-std::array<float,2>{0.149946675f, 0.259596854f},
-std::array<float,2>{0.355546772f, 0.758650005f},
-std::array<float,2>{0.844278634f, 0.213512048f},
-std::array<float,2>{0.957981765f, 0.939534068f},
-std::array<float,2>{0.43174684f, 0.00231948402f},
-std::array<float,2>{0.115358986f, 0.584756613f},
-std::array<float,2>{0.74696821f, 0.494627923f},
-std::array<float,2>{0.615877807f, 0.936302841f},
-std::array<float,2>{0.215693429f, 0.12253657f},
-std::array<float,2>{0.297934264f, 0.517660379f},
-std::array<float,2>{0.782322884f, 0.402987212f},
-std::array<float,2>{0.918337703f, 0.66993171f},
-std::array<float,2>{0.439992249f, 0.361464173f},
-std::array<float,2>{0.0447917841f, 0.861753106f},
-std::array<float,2>{0.686430812f, 0.143144146f},
-std::array<float,2>{0.689073026f, 0.614412308f},
-std::array<float,2>{0.0873883739f, 0.456403255f},
-std::array<float,2>{0.384387583f, 0.975106657f},
-std::array<float,2>{0.979164481f, 0.0513961427f},
-std::array<float,2>{0.833331168f, 0.786791742f},
-std::array<float,2>{0.313309371f, 0.242982164f},
-std::array<float,2>{0.172241986f, 0.744546473f},
-std::array<float,2>{0.545309663f, 0.30098179f},
-std::array<float,2>{0.728470445f, 0.991295695f},
-std::array<float,2>{0.0958889201f, 0.0452089719f},
-std::array<float,2>{0.417976558f, 0.596832871f},
-std::array<float,2>{0.938228011f, 0.440968663f},
-std::array<float,2>{0.871985912f, 0.72859174f},
-std::array<float,2>{0.361605287f, 0.28858003f},
-std::array<float,2>{0.128745317f, 0.803452373f},
-std::array<float,2>{0.505942523f, 0.219234452f},
-std::array<float,2>{0.59264046f, 0.511873484f},
-std::array<float,2>{0.234995335f, 0.387247473f},
-std::array<float,2>{0.272423327f, 0.90673095f},
-std::array<float,2>{0.762744129f, 0.0988861993f},
-std::array<float,2>{0.881923974f, 0.85842514f},
-std::array<float,2>{0.492230386f, 0.138786122f},
-std::array<float,2>{0.0229326338f, 0.683127046f},
-std::array<float,2>{0.645662367f, 0.359175622f},
-std::array<float,2>{0.552485943f, 0.772076428f},
-std::array<float,2>{0.169269726f, 0.1909969f},
-std::array<float,2>{0.342772216f, 0.71768117f},
-std::array<float,2>{0.817157984f, 0.280245155f},
-std::array<float,2>{0.995845079f, 0.576365888f},
-std::array<float,2>{0.402031898f, 0.48046124f},
-std::array<float,2>{0.0672638044f, 0.961616397f},
-std::array<float,2>{0.7036134f, 0.0255526062f},
-std::array<float,2>{0.671554267f, 0.630760193f},
-std::array<float,2>{0.0539127029f, 0.339470416f},
-std::array<float,2>{0.463088989f, 0.819977283f},
-std::array<float,2>{0.935747564f, 0.17545706f},
-std::array<float,2>{0.803452075f, 0.896788955f},
-std::array<float,2>{0.294220746f, 0.0870701671f},
-std::array<float,2>{0.197711006f, 0.555370331f},
-std::array<float,2>{0.598540366f, 0.411211669f},
-std::array<float,2>{0.715206921f, 0.81018424f},
-std::array<float,2>{0.0724986419f, 0.232808679f},
-std::array<float,2>{0.39437604f, 0.723059535f},
-std::array<float,2>{0.989108682f, 0.293324798f},
-std::array<float,2>{0.824023962f, 0.605647743f},
-std::array<float,2>{0.329671353f, 0.446815759f},
-std::array<float,2>{0.162491411f, 0.99876231f},
-std::array<float,2>{0.561255872f, 0.0338906571f},
-std::array<float,2>{0.605201602f, 0.675666332f},
-std::array<float,2>{0.18835628f, 0.34794277f},
-std::array<float,2>{0.286829859f, 0.844496667f},
-std::array<float,2>{0.810532808f, 0.12991783f},
-std::array<float,2>{0.926493645f, 0.917263389f},
-std::array<float,2>{0.460664093f, 0.104301415f},
-std::array<float,2>{0.0595434271f, 0.503666639f},
-std::array<float,2>{0.662494719f, 0.375244021f},
-std::array<float,2>{0.510331273f, 0.953184724f},
-std::array<float,2>{0.134056211f, 0.0218471698f},
-std::array<float,2>{0.374248624f, 0.568190396f},
-std::array<float,2>{0.859853208f, 0.470740497f},
-std::array<float,2>{0.950847983f, 0.708439648f},
-std::array<float,2>{0.413395166f, 0.266479105f},
-std::array<float,2>{0.105768777f, 0.777000964f},
-std::array<float,2>{0.718809843f, 0.201739058f},
-std::array<float,2>{0.654249966f, 0.550341785f},
-std::array<float,2>{0.0295535419f, 0.420237005f},
-std::array<float,2>{0.491036534f, 0.904132426f},
-std::array<float,2>{0.889774203f, 0.0851407796f},
-std::array<float,2>{0.752176106f, 0.821980715f},
-std::array<float,2>{0.274402618f, 0.181224883f},
-std::array<float,2>{0.24985759f, 0.632873774f},
-std::array<float,2>{0.585776865f, 0.328418493f},
-std::array<float,2>{0.677494645f, 0.889981389f},
-std::array<float,2>{0.0346355475f, 0.0628268197f},
-std::array<float,2>{0.449006617f, 0.53942281f},
-std::array<float,2>{0.910201132f, 0.426483363f},
-std::array<float,2>{0.789609194f, 0.647515059f},
-std::array<float,2>{0.308919042f, 0.327111095f},
-std::array<float,2>{0.210191339f, 0.832350671f},
-std::array<float,2>{0.617422342f, 0.168293759f},
-std::array<float,2>{0.538303077f, 0.586809456f},
-std::array<float,2>{0.187480971f, 0.491034895f},
-std::array<float,2>{0.32628879f, 0.948824763f},
-std::array<float,2>{0.838524938f, 0.0110721458f},
-std::array<float,2>{0.969380021f, 0.752160788f},
-std::array<float,2>{0.376376212f, 0.205368787f},
-std::array<float,2>{0.0843019783f, 0.694452941f},
-std::array<float,2>{0.700756192f, 0.25672254f},
-std::array<float,2>{0.564755082f, 0.874758065f},
-std::array<float,2>{0.221621722f, 0.15350236f},
-std::array<float,2>{0.260542244f, 0.663821161f},
-std::array<float,2>{0.775390863f, 0.370358944f},
-std::array<float,2>{0.892386615f, 0.530060828f},
-std::array<float,2>{0.481465042f, 0.391474575f},
-std::array<float,2>{0.0101808282f, 0.921925545f},
-std::array<float,2>{0.6328336f, 0.112056695f},
-std::array<float,2>{0.740681052f, 0.739243329f},
-std::array<float,2>{0.124741487f, 0.306200147f},
-std::array<float,2>{0.424687833f, 0.789155781f},
-std::array<float,2>{0.962179899f, 0.238991871f},
-std::array<float,2>{0.856638312f, 0.977455139f},
-std::array<float,2>{0.350960851f, 0.0604765825f},
-std::array<float,2>{0.146093234f, 0.622752547f},
-std::array<float,2>{0.531199634f, 0.468518645f},
-std::array<float,2>{0.659510493f, 0.763566494f},
-std::array<float,2>{0.0578177832f, 0.216233268f},
-std::array<float,2>{0.454158813f, 0.697049677f},
-std::array<float,2>{0.922868133f, 0.262101173f},
-std::array<float,2>{0.806796968f, 0.580093443f},
-std::array<float,2>{0.282775193f, 0.499168128f},
-std::array<float,2>{0.194419816f, 0.942112684f},
-std::array<float,2>{0.605679572f, 0.0076341657f},
-std::array<float,2>{0.557492793f, 0.649095356f},
-std::array<float,2>{0.159351751f, 0.31680432f},
-std::array<float,2>{0.334274471f, 0.837153018f},
-std::array<float,2>{0.825936019f, 0.157310501f},
-std::array<float,2>{0.984906435f, 0.882249534f},
-std::array<float,2>{0.395184666f, 0.0758794993f},
-std::array<float,2>{0.0766060352f, 0.533991516f},
-std::array<float,2>{0.711720943f, 0.43209061f},
-std::array<float,2>{0.579347491f, 0.970583856f},
-std::array<float,2>{0.242753565f, 0.0477234833f},
-std::array<float,2>{0.278146565f, 0.610950768f},
-std::array<float,2>{0.755173743f, 0.457320094f},
-std::array<float,2>{0.884350777f, 0.746632397f},
-std::array<float,2>{0.486174703f, 0.30059278f},
-std::array<float,2>{0.0237896107f, 0.782859504f},
-std::array<float,2>{0.651000321f, 0.246563181f},
-std::array<float,2>{0.726325154f, 0.521068215f},
-std::array<float,2>{0.101828054f, 0.398666233f},
-std::array<float,2>{0.407563418f, 0.929838359f},
-std::array<float,2>{0.945834339f, 0.120854184f},
-std::array<float,2>{0.864400506f, 0.865249634f},
-std::array<float,2>{0.36720866f, 0.146172509f},
-std::array<float,2>{0.138392553f, 0.66712743f},
-std::array<float,2>{0.511845827f, 0.364955783f},
-std::array<float,2>{0.698210359f, 0.913646042f},
-std::array<float,2>{0.0810027495f, 0.0950171947f},
-std::array<float,2>{0.380492508f, 0.509952009f},
-std::array<float,2>{0.976353884f, 0.386400431f},
-std::array<float,2>{0.84172684f, 0.685067654f},
-std::array<float,2>{0.321459442f, 0.353386045f},
-std::array<float,2>{0.181401148f, 0.853206694f},
-std::array<float,2>{0.532207847f, 0.134960309f},
-std::array<float,2>{0.621442139f, 0.601196408f},
-std::array<float,2>{0.206649929f, 0.441596508f},
-std::array<float,2>{0.308450133f, 0.985548973f},
-std::array<float,2>{0.796502829f, 0.0421831869f},
-std::array<float,2>{0.906746209f, 0.798803508f},
-std::array<float,2>{0.452396899f, 0.223767698f},
-std::array<float,2>{0.0366015173f, 0.733296275f},
-std::array<float,2>{0.672091603f, 0.281551212f},
-std::array<float,2>{0.524933934f, 0.812538207f},
-std::array<float,2>{0.143892527f, 0.175899565f},
-std::array<float,2>{0.346586496f, 0.625959635f},
-std::array<float,2>{0.852972806f, 0.340017349f},
-std::array<float,2>{0.965355754f, 0.561877728f},
-std::array<float,2>{0.427553892f, 0.409357399f},
-std::array<float,2>{0.120029762f, 0.890872478f},
-std::array<float,2>{0.737716436f, 0.0924881399f},
-std::array<float,2>{0.637354314f, 0.711180389f},
-std::array<float,2>{0.0139168017f, 0.275724322f},
-std::array<float,2>{0.47952044f, 0.767221987f},
-std::array<float,2>{0.896379113f, 0.193420798f},
-std::array<float,2>{0.780860007f, 0.966733932f},
-std::array<float,2>{0.263861299f, 0.0284611601f},
-std::array<float,2>{0.2254574f, 0.574068666f},
-std::array<float,2>{0.566893101f, 0.481479049f},
-std::array<float,2>{0.744243443f, 0.84980756f},
-std::array<float,2>{0.110070482f, 0.128617316f},
-std::array<float,2>{0.435587287f, 0.679043829f},
-std::array<float,2>{0.956156731f, 0.344367266f},
-std::array<float,2>{0.850175202f, 0.507270038f},
-std::array<float,2>{0.352381885f, 0.382073075f},
-std::array<float,2>{0.154192209f, 0.919766545f},
-std::array<float,2>{0.520516694f, 0.107614763f},
-std::array<float,2>{0.573025048f, 0.71891427f},
-std::array<float,2>{0.230144009f, 0.290518641f},
-std::array<float,2>{0.25372538f, 0.806738973f},
-std::array<float,2>{0.766137183f, 0.230421022f},
-std::array<float,2>{0.904220402f, 0.99268043f},
-std::array<float,2>{0.471373171f, 0.0370813049f},
-std::array<float,2>{0.00660289545f, 0.605251193f},
-std::array<float,2>{0.631853878f, 0.449796766f},
-std::array<float,2>{0.539372742f, 0.900262713f},
-std::array<float,2>{0.177411333f, 0.0781561583f},
-std::array<float,2>{0.31807819f, 0.552806318f},
-std::array<float,2>{0.829268515f, 0.416037798f},
-std::array<float,2>{0.983592331f, 0.637935936f},
-std::array<float,2>{0.387271374f, 0.332705319f},
-std::array<float,2>{0.0902165771f, 0.82690686f},
-std::array<float,2>{0.692737639f, 0.186466753f},
-std::array<float,2>{0.682248175f, 0.563365459f},
-std::array<float,2>{0.0413664393f, 0.473997712f},
-std::array<float,2>{0.444182009f, 0.95960921f},
-std::array<float,2>{0.91417855f, 0.0176467076f},
-std::array<float,2>{0.785767674f, 0.781059921f},
-std::array<float,2>{0.302628338f, 0.196605161f},
-std::array<float,2>{0.213355064f, 0.705023289f},
-std::array<float,2>{0.609596431f, 0.271611392f},
-std::array<float,2>{0.644161642f, 0.95157522f},
-std::array<float,2>{0.0187122934f, 0.0144623509f},
-std::array<float,2>{0.499047935f, 0.591898441f},
-std::array<float,2>{0.876700521f, 0.485528886f},
-std::array<float,2>{0.761619747f, 0.687500715f},
-std::array<float,2>{0.266328692f, 0.251772583f},
-std::array<float,2>{0.240250617f, 0.757040322f},
-std::array<float,2>{0.587144494f, 0.210765183f},
-std::array<float,2>{0.50017643f, 0.546070576f},
-std::array<float,2>{0.132081971f, 0.42462191f},
-std::array<float,2>{0.366759092f, 0.884499669f},
-std::array<float,2>{0.867262125f, 0.0670879036f},
-std::array<float,2>{0.942899764f, 0.830946505f},
-std::array<float,2>{0.415953934f, 0.164249107f},
-std::array<float,2>{0.0978550985f, 0.641476154f},
-std::array<float,2>{0.730814517f, 0.321758211f},
-std::array<float,2>{0.595649481f, 0.793942273f},
-std::array<float,2>{0.202818066f, 0.235012785f},
-std::array<float,2>{0.292304486f, 0.737107754f},
-std::array<float,2>{0.798532903f, 0.311082631f},
-std::array<float,2>{0.932491958f, 0.620606363f},
-std::array<float,2>{0.467188388f, 0.463071883f},
-std::array<float,2>{0.0493865944f, 0.982971668f},
-std::array<float,2>{0.664358974f, 0.0553318113f},
-std::array<float,2>{0.707393587f, 0.658929765f},
-std::array<float,2>{0.0633162707f, 0.374632657f},
-std::array<float,2>{0.402790338f, 0.87098068f},
-std::array<float,2>{0.996107578f, 0.149287075f},
-std::array<float,2>{0.813344181f, 0.928967297f},
-std::array<float,2>{0.337706536f, 0.116612643f},
-std::array<float,2>{0.164520726f, 0.525113285f},
-std::array<float,2>{0.546889722f, 0.395915598f},
-std::array<float,2>{0.68374902f, 0.860254943f},
-std::array<float,2>{0.0460749343f, 0.142225668f},
-std::array<float,2>{0.43800801f, 0.668349445f},
-std::array<float,2>{0.921086848f, 0.360665113f},
-std::array<float,2>{0.783976316f, 0.516212702f},
-std::array<float,2>{0.299278677f, 0.405360967f},
-std::array<float,2>{0.217817783f, 0.935278296f},
-std::array<float,2>{0.614373028f, 0.123484485f},
-std::array<float,2>{0.544887424f, 0.743525445f},
-std::array<float,2>{0.174855843f, 0.304199636f},
-std::array<float,2>{0.316296607f, 0.788140476f},
-std::array<float,2>{0.835033f, 0.245529965f},
-std::array<float,2>{0.977972806f, 0.974607348f},
-std::array<float,2>{0.386459887f, 0.0544084348f},
-std::array<float,2>{0.0892281681f, 0.616208732f},
-std::array<float,2>{0.690532267f, 0.453572243f},
-std::array<float,2>{0.576148689f, 0.87707299f},
-std::array<float,2>{0.232432082f, 0.0724453703f},
-std::array<float,2>{0.254549593f, 0.536931217f},
-std::array<float,2>{0.773384213f, 0.433904767f},
-std::array<float,2>{0.899996698f, 0.653157592f},
-std::array<float,2>{0.472677618f, 0.312958807f},
-std::array<float,2>{0.000128650252f, 0.841795087f},
-std::array<float,2>{0.627969384f, 0.161970168f},
-std::array<float,2>{0.749099016f, 0.583518982f},
-std::array<float,2>{0.114366986f, 0.493282437f},
-std::array<float,2>{0.430071265f, 0.938398957f},
-std::array<float,2>{0.960013747f, 0.00033272506f},
-std::array<float,2>{0.847570539f, 0.759786785f},
-std::array<float,2>{0.357851774f, 0.211709544f},
-std::array<float,2>{0.151919901f, 0.700419128f},
-std::array<float,2>{0.518630564f, 0.260383368f},
-std::array<float,2>{0.705682874f, 0.963712931f},
-std::array<float,2>{0.0692464635f, 0.0241102204f},
-std::array<float,2>{0.39897272f, 0.575598598f},
-std::array<float,2>{0.99363184f, 0.477474988f},
-std::array<float,2>{0.81901449f, 0.71643436f},
-std::array<float,2>{0.34138608f, 0.278763473f},
-std::array<float,2>{0.170833752f, 0.77105999f},
-std::array<float,2>{0.55277878f, 0.188003391f},
-std::array<float,2>{0.601197958f, 0.558571935f},
-std::array<float,2>{0.197195068f, 0.413220078f},
-std::array<float,2>{0.296556354f, 0.895896912f},
-std::array<float,2>{0.801760316f, 0.089447841f},
-std::array<float,2>{0.933912039f, 0.817863107f},
-std::array<float,2>{0.462665319f, 0.173487738f},
-std::array<float,2>{0.0518533438f, 0.632516325f},
-std::array<float,2>{0.669393063f, 0.337040752f},
-std::array<float,2>{0.505583465f, 0.801856697f},
-std::array<float,2>{0.126775891f, 0.22110948f},
-std::array<float,2>{0.359962702f, 0.728424966f},
-std::array<float,2>{0.874393284f, 0.28707245f},
-std::array<float,2>{0.940786302f, 0.595537245f},
-std::array<float,2>{0.421792269f, 0.437911302f},
-std::array<float,2>{0.0937736407f, 0.989059865f},
-std::array<float,2>{0.730067372f, 0.043453332f},
-std::array<float,2>{0.64749831f, 0.680121481f},
-std::array<float,2>{0.0212396793f, 0.356330395f},
-std::array<float,2>{0.495824963f, 0.857179642f},
-std::array<float,2>{0.87960583f, 0.137401789f},
-std::array<float,2>{0.76516217f, 0.909604311f},
-std::array<float,2>{0.270477206f, 0.0996263772f},
-std::array<float,2>{0.23697494f, 0.515619099f},
-std::array<float,2>{0.591603935f, 0.389321297f},
-std::array<float,2>{0.721085787f, 0.774623573f},
-std::array<float,2>{0.107904464f, 0.200899541f},
-std::array<float,2>{0.412009656f, 0.71028018f},
-std::array<float,2>{0.951976359f, 0.267943233f},
-std::array<float,2>{0.862448812f, 0.569263756f},
-std::array<float,2>{0.372098029f, 0.469275743f},
-std::array<float,2>{0.136336878f, 0.956787407f},
-std::array<float,2>{0.508552313f, 0.0213752277f},
-std::array<float,2>{0.582607329f, 0.636097848f},
-std::array<float,2>{0.246183738f, 0.330401033f},
-std::array<float,2>{0.276141733f, 0.823837459f},
-std::array<float,2>{0.750867784f, 0.18181397f},
-std::array<float,2>{0.887569726f, 0.904953897f},
-std::array<float,2>{0.488966048f, 0.0835857764f},
-std::array<float,2>{0.0290341452f, 0.548083007f},
-std::array<float,2>{0.654406667f, 0.418310255f},
-std::array<float,2>{0.560444713f, 0.997905135f},
-std::array<float,2>{0.160901621f, 0.0316937156f},
-std::array<float,2>{0.330230504f, 0.608586192f},
-std::array<float,2>{0.821325362f, 0.448739022f},
-std::array<float,2>{0.992026746f, 0.725121021f},
-std::array<float,2>{0.390676886f, 0.296695709f},
-std::array<float,2>{0.0708182678f, 0.810828865f},
-std::array<float,2>{0.718611777f, 0.232000589f},
-std::array<float,2>{0.66122514f, 0.501400769f},
-std::array<float,2>{0.0617815331f, 0.377759427f},
-std::array<float,2>{0.457750738f, 0.914515257f},
-std::array<float,2>{0.928201377f, 0.101885632f},
-std::array<float,2>{0.811298728f, 0.84749949f},
-std::array<float,2>{0.288632631f, 0.132022604f},
-std::array<float,2>{0.190560937f, 0.672114253f},
-std::array<float,2>{0.603168905f, 0.350407511f},
-std::array<float,2>{0.635234892f, 0.925372303f},
-std::array<float,2>{0.00799886044f, 0.111136578f},
-std::array<float,2>{0.483616799f, 0.527362823f},
-std::array<float,2>{0.893903792f, 0.393138349f},
-std::array<float,2>{0.773860216f, 0.661636353f},
-std::array<float,2>{0.25899601f, 0.368321121f},
-std::array<float,2>{0.21993354f, 0.872275293f},
-std::array<float,2>{0.56439811f, 0.154889792f},
-std::array<float,2>{0.527354896f, 0.623479545f},
-std::array<float,2>{0.147040695f, 0.46534276f},
-std::array<float,2>{0.348439842f, 0.978848219f},
-std::array<float,2>{0.857535422f, 0.0609008037f},
-std::array<float,2>{0.963505566f, 0.791998684f},
-std::array<float,2>{0.422698975f, 0.24117282f},
-std::array<float,2>{0.122578852f, 0.741390467f},
-std::array<float,2>{0.739866912f, 0.308341533f},
-std::array<float,2>{0.619371116f, 0.835739493f},
-std::array<float,2>{0.207240835f, 0.171824768f},
-std::array<float,2>{0.31194523f, 0.645268023f},
-std::array<float,2>{0.791729808f, 0.324973971f},
-std::array<float,2>{0.912209272f, 0.54187268f},
-std::array<float,2>{0.445780784f, 0.429518014f},
-std::array<float,2>{0.0322448015f, 0.88793087f},
-std::array<float,2>{0.678129911f, 0.0647973046f},
-std::array<float,2>{0.702170253f, 0.693183482f},
-std::array<float,2>{0.0822911188f, 0.254817605f},
-std::array<float,2>{0.377159536f, 0.75015837f},
-std::array<float,2>{0.971333504f, 0.204237327f},
-std::array<float,2>{0.836537361f, 0.945482016f},
-std::array<float,2>{0.325596213f, 0.00847548898f},
-std::array<float,2>{0.185219631f, 0.589626551f},
-std::array<float,2>{0.536056876f, 0.489370823f},
-std::array<float,2>{0.648942411f, 0.784965456f},
-std::array<float,2>{0.0260896906f, 0.249322772f},
-std::array<float,2>{0.486522913f, 0.749802947f},
-std::array<float,2>{0.886174619f, 0.297786355f},
-std::array<float,2>{0.757461548f, 0.611753881f},
-std::array<float,2>{0.280416697f, 0.460739613f},
-std::array<float,2>{0.245447248f, 0.971361101f},
-std::array<float,2>{0.580111206f, 0.049328085f},
-std::array<float,2>{0.514680147f, 0.665342867f},
-std::array<float,2>{0.139594525f, 0.367021263f},
-std::array<float,2>{0.370833188f, 0.865179896f},
-std::array<float,2>{0.865812659f, 0.146814138f},
-std::array<float,2>{0.948363781f, 0.933434963f},
-std::array<float,2>{0.409191608f, 0.119071685f},
-std::array<float,2>{0.103958681f, 0.522687972f},
-std::array<float,2>{0.724563003f, 0.402169228f},
-std::array<float,2>{0.609218895f, 0.943650186f},
-std::array<float,2>{0.193324313f, 0.00495730806f},
-std::array<float,2>{0.283323973f, 0.579954267f},
-std::array<float,2>{0.804966152f, 0.497144014f},
-std::array<float,2>{0.925251663f, 0.699092388f},
-std::array<float,2>{0.455418766f, 0.264504403f},
-std::array<float,2>{0.0548318923f, 0.765357018f},
-std::array<float,2>{0.657577217f, 0.218250975f},
-std::array<float,2>{0.713155925f, 0.531747937f},
-std::array<float,2>{0.0744452327f, 0.429866225f},
-std::array<float,2>{0.398201436f, 0.879327893f},
-std::array<float,2>{0.987367034f, 0.0763996094f},
-std::array<float,2>{0.827607214f, 0.838892102f},
-std::array<float,2>{0.332239062f, 0.159918278f},
-std::array<float,2>{0.156488106f, 0.65196383f},
-std::array<float,2>{0.555531561f, 0.319848895f},
-std::array<float,2>{0.734648228f, 0.893921435f},
-std::array<float,2>{0.118410885f, 0.0905569494f},
-std::array<float,2>{0.427870929f, 0.558728933f},
-std::array<float,2>{0.967361629f, 0.406553447f},
-std::array<float,2>{0.854415953f, 0.627992451f},
-std::array<float,2>{0.343918771f, 0.343216956f},
-std::array<float,2>{0.142480373f, 0.815890789f},
-std::array<float,2>{0.526255608f, 0.178453058f},
-std::array<float,2>{0.568449199f, 0.570723712f},
-std::array<float,2>{0.22279571f, 0.482796013f},
-std::array<float,2>{0.26222536f, 0.96853292f},
-std::array<float,2>{0.779027998f, 0.0308396295f},
-std::array<float,2>{0.897857487f, 0.768922687f},
-std::array<float,2>{0.47832492f, 0.191664532f},
-std::array<float,2>{0.0124290045f, 0.713674366f},
-std::array<float,2>{0.640278041f, 0.273712009f},
-std::array<float,2>{0.533542752f, 0.85531652f},
-std::array<float,2>{0.183527634f, 0.134450957f},
-std::array<float,2>{0.324010372f, 0.68734163f},
-std::array<float,2>{0.842486858f, 0.35500282f},
-std::array<float,2>{0.973038852f, 0.508212745f},
-std::array<float,2>{0.381093293f, 0.383453995f},
-std::array<float,2>{0.0796541944f, 0.911247015f},
-std::array<float,2>{0.696670175f, 0.0971758217f},
-std::array<float,2>{0.67393446f, 0.731888056f},
-std::array<float,2>{0.0375866294f, 0.28472513f},
-std::array<float,2>{0.450165302f, 0.799600124f},
-std::array<float,2>{0.909529269f, 0.225727379f},
-std::array<float,2>{0.793367922f, 0.987645447f},
-std::array<float,2>{0.305020988f, 0.0405834168f},
-std::array<float,2>{0.203950584f, 0.599043489f},
-std::array<float,2>{0.623429477f, 0.445154846f},
-std::array<float,2>{0.694200933f, 0.824680567f},
-std::array<float,2>{0.0929001868f, 0.184726819f},
-std::array<float,2>{0.388880163f, 0.639689147f},
-std::array<float,2>{0.980521262f, 0.334225118f},
-std::array<float,2>{0.830320656f, 0.551269054f},
-std::array<float,2>{0.318797141f, 0.415680945f},
-std::array<float,2>{0.179319128f, 0.900905609f},
-std::array<float,2>{0.542111278f, 0.0802940577f},
-std::array<float,2>{0.611675322f, 0.70641458f},
-std::array<float,2>{0.212322146f, 0.270311594f},
-std::array<float,2>{0.303886265f, 0.777371585f},
-std::array<float,2>{0.787596345f, 0.198801845f},
-std::array<float,2>{0.916503191f, 0.957753479f},
-std::array<float,2>{0.442865133f, 0.01706893f},
-std::array<float,2>{0.0390846431f, 0.565152645f},
-std::array<float,2>{0.681606233f, 0.475970089f},
-std::array<float,2>{0.522765398f, 0.921446919f},
-std::array<float,2>{0.155494899f, 0.106766619f},
-std::array<float,2>{0.354823112f, 0.505595028f},
-std::array<float,2>{0.84936136f, 0.379888952f},
-std::array<float,2>{0.953594446f, 0.676048756f},
-std::array<float,2>{0.434252977f, 0.346146792f},
-std::array<float,2>{0.112889849f, 0.848534942f},
-std::array<float,2>{0.742423415f, 0.125833437f},
-std::array<float,2>{0.629514933f, 0.603443563f},
-std::array<float,2>{0.00424300227f, 0.451633513f},
-std::array<float,2>{0.470661134f, 0.994657934f},
-std::array<float,2>{0.906211555f, 0.0383590311f},
-std::array<float,2>{0.767744839f, 0.804943919f},
-std::array<float,2>{0.251914561f, 0.228170484f},
-std::array<float,2>{0.228047743f, 0.721956909f},
-std::array<float,2>{0.570601523f, 0.292155445f},
-std::array<float,2>{0.666918099f, 0.981308758f},
-std::array<float,2>{0.047575146f, 0.0583485663f},
-std::array<float,2>{0.466635019f, 0.617318451f},
-std::array<float,2>{0.930632353f, 0.462552577f},
-std::array<float,2>{0.799031436f, 0.735646129f},
-std::array<float,2>{0.290548056f, 0.309777141f},
-std::array<float,2>{0.199678883f, 0.795557976f},
-std::array<float,2>{0.596414328f, 0.23695977f},
-std::array<float,2>{0.549588263f, 0.526848614f},
-std::array<float,2>{0.167671874f, 0.398406863f},
-std::array<float,2>{0.337992817f, 0.927333236f},
-std::array<float,2>{0.815092146f, 0.113734744f},
-std::array<float,2>{0.998939216f, 0.867598116f},
-std::array<float,2>{0.40487358f, 0.151504397f},
-std::array<float,2>{0.0650310814f, 0.657670498f},
-std::array<float,2>{0.71072185f, 0.371274233f},
-std::array<float,2>{0.588966489f, 0.75400573f},
-std::array<float,2>{0.239920363f, 0.208582073f},
-std::array<float,2>{0.269266367f, 0.690870702f},
-std::array<float,2>{0.75911051f, 0.25368914f},
-std::array<float,2>{0.877570689f, 0.591354907f},
-std::array<float,2>{0.497165859f, 0.487712055f},
-std::array<float,2>{0.0168659259f, 0.950362861f},
-std::array<float,2>{0.642353594f, 0.0133741442f},
-std::array<float,2>{0.732847095f, 0.644357681f},
-std::array<float,2>{0.0999044925f, 0.323008567f},
-std::array<float,2>{0.416975498f, 0.828250825f},
-std::array<float,2>{0.943976641f, 0.166624337f},
-std::array<float,2>{0.86914736f, 0.885227859f},
-std::array<float,2>{0.364713162f, 0.0693060085f},
-std::array<float,2>{0.129431665f, 0.544893444f},
-std::array<float,2>{0.503417313f, 0.422941774f},
-std::array<float,2>{0.645296454f, 0.856436133f},
-std::array<float,2>{0.0222777538f, 0.138286427f},
-std::array<float,2>{0.494058967f, 0.680972397f},
-std::array<float,2>{0.880911827f, 0.35687682f},
-std::array<float,2>{0.762009382f, 0.514369786f},
-std::array<float,2>{0.272656828f, 0.389845461f},
-std::array<float,2>{0.235440657f, 0.909108281f},
-std::array<float,2>{0.593554139f, 0.101315364f},
-std::array<float,2>{0.507125676f, 0.727337658f},
-std::array<float,2>{0.127254531f, 0.28586933f},
-std::array<float,2>{0.362952441f, 0.80129087f},
-std::array<float,2>{0.87217474f, 0.222594395f},
-std::array<float,2>{0.939240694f, 0.989980102f},
-std::array<float,2>{0.419011682f, 0.0445447229f},
-std::array<float,2>{0.0967794359f, 0.594044805f},
-std::array<float,2>{0.727503657f, 0.438760191f},
-std::array<float,2>{0.599378109f, 0.895498931f},
-std::array<float,2>{0.198545039f, 0.0886075869f},
-std::array<float,2>{0.293814242f, 0.557186007f},
-std::array<float,2>{0.804350913f, 0.41229701f},
-std::array<float,2>{0.936811924f, 0.63124305f},
-std::array<float,2>{0.46465984f, 0.336465925f},
-std::array<float,2>{0.0529775061f, 0.816622734f},
-std::array<float,2>{0.670019805f, 0.172133803f},
-std::array<float,2>{0.70478642f, 0.574878871f},
-std::array<float,2>{0.0679607019f, 0.478103131f},
-std::array<float,2>{0.400894523f, 0.964412391f},
-std::array<float,2>{0.994905531f, 0.024634609f},
-std::array<float,2>{0.817430496f, 0.77033931f},
-std::array<float,2>{0.343618989f, 0.188996047f},
-std::array<float,2>{0.168312564f, 0.715359211f},
-std::array<float,2>{0.550926507f, 0.277862698f},
-std::array<float,2>{0.74723357f, 0.938937306f},
-std::array<float,2>{0.116295308f, 0.00151790038f},
-std::array<float,2>{0.432825297f, 0.582942069f},
-std::array<float,2>{0.958210528f, 0.49271366f},
-std::array<float,2>{0.845692813f, 0.69957304f},
-std::array<float,2>{0.356744856f, 0.261503279f},
-std::array<float,2>{0.148691967f, 0.761131048f},
-std::array<float,2>{0.515776455f, 0.21250084f},
-std::array<float,2>{0.576915443f, 0.535978615f},
-std::array<float,2>{0.230500638f, 0.434587717f},
-std::array<float,2>{0.2566818f, 0.878104806f},
-std::array<float,2>{0.770083547f, 0.0738601238f},
-std::array<float,2>{0.901963055f, 0.840257227f},
-std::array<float,2>{0.476143807f, 0.16083695f},
-std::array<float,2>{0.00245304941f, 0.653670549f},
-std::array<float,2>{0.626945138f, 0.313994884f},
-std::array<float,2>{0.54649061f, 0.787135005f},
-std::array<float,2>{0.173351005f, 0.244548634f},
-std::array<float,2>{0.314208508f, 0.743122697f},
-std::array<float,2>{0.832069933f, 0.302826971f},
-std::array<float,2>{0.980155468f, 0.616416454f},
-std::array<float,2>{0.383285761f, 0.454157501f},
-std::array<float,2>{0.0868929774f, 0.973298907f},
-std::array<float,2>{0.687523067f, 0.0534685291f},
-std::array<float,2>{0.687142313f, 0.669456601f},
-std::array<float,2>{0.0437216088f, 0.35983333f},
-std::array<float,2>{0.441333354f, 0.860519588f},
-std::array<float,2>{0.919714749f, 0.14134708f},
-std::array<float,2>{0.782034457f, 0.934317052f},
-std::array<float,2>{0.297057301f, 0.124340169f},
-std::array<float,2>{0.216163948f, 0.516653895f},
-std::array<float,2>{0.616380513f, 0.404834181f},
-std::array<float,2>{0.699801981f, 0.751494467f},
-std::array<float,2>{0.0853515491f, 0.203304842f},
-std::array<float,2>{0.375834942f, 0.691736281f},
-std::array<float,2>{0.969943821f, 0.255350143f},
-std::array<float,2>{0.839681447f, 0.588241279f},
-std::array<float,2>{0.328056186f, 0.489083916f},
-std::array<float,2>{0.185821563f, 0.946953058f},
-std::array<float,2>{0.537861884f, 0.00915907975f},
-std::array<float,2>{0.61831224f, 0.646322727f},
-std::array<float,2>{0.20957616f, 0.326041847f},
-std::array<float,2>{0.310018092f, 0.834615707f},
-std::array<float,2>{0.790246189f, 0.170721143f},
-std::array<float,2>{0.911366045f, 0.88738519f},
-std::array<float,2>{0.448228329f, 0.0655753389f},
-std::array<float,2>{0.0332263745f, 0.5421983f},
-std::array<float,2>{0.676328719f, 0.428471744f},
-std::array<float,2>{0.529819548f, 0.979997575f},
-std::array<float,2>{0.144621626f, 0.0618545748f},
-std::array<float,2>{0.349659711f, 0.624379754f},
-std::array<float,2>{0.85623318f, 0.466114014f},
-std::array<float,2>{0.961721241f, 0.74033922f},
-std::array<float,2>{0.425049901f, 0.307497531f},
-std::array<float,2>{0.123856202f, 0.791121244f},
-std::array<float,2>{0.741330743f, 0.24195455f},
-std::array<float,2>{0.634364545f, 0.529268563f},
-std::array<float,2>{0.0114506986f, 0.394168258f},
-std::array<float,2>{0.480482191f, 0.92417407f},
-std::array<float,2>{0.890936553f, 0.109541528f},
-std::array<float,2>{0.777336717f, 0.871207833f},
-std::array<float,2>{0.261214852f, 0.155830637f},
-std::array<float,2>{0.222406536f, 0.660655618f},
-std::array<float,2>{0.56602782f, 0.367986679f},
-std::array<float,2>{0.663789749f, 0.915767074f},
-std::array<float,2>{0.0604666434f, 0.103417724f},
-std::array<float,2>{0.45919022f, 0.500079155f},
-std::array<float,2>{0.927516401f, 0.378345966f},
-std::array<float,2>{0.809534371f, 0.673621953f},
-std::array<float,2>{0.286090493f, 0.350666225f},
-std::array<float,2>{0.18850252f, 0.846414149f},
-std::array<float,2>{0.603931069f, 0.131794661f},
-std::array<float,2>{0.562175333f, 0.608109772f},
-std::array<float,2>{0.163955837f, 0.448239565f},
-std::array<float,2>{0.328861743f, 0.996417701f},
-std::array<float,2>{0.822650135f, 0.0324940868f},
-std::array<float,2>{0.990017176f, 0.812391043f},
-std::array<float,2>{0.393364578f, 0.231043369f},
-std::array<float,2>{0.0735643432f, 0.725958526f},
-std::array<float,2>{0.716095984f, 0.295030892f},
-std::array<float,2>{0.584176719f, 0.822994292f},
-std::array<float,2>{0.248623595f, 0.183499232f},
-std::array<float,2>{0.274909675f, 0.635484397f},
-std::array<float,2>{0.753770888f, 0.331253201f},
-std::array<float,2>{0.889361322f, 0.547318459f},
-std::array<float,2>{0.492076874f, 0.419837594f},
-std::array<float,2>{0.0302960165f, 0.905663192f},
-std::array<float,2>{0.652681053f, 0.0820639208f},
-std::array<float,2>{0.720152795f, 0.709148824f},
-std::array<float,2>{0.106526174f, 0.268810272f},
-std::array<float,2>{0.412378877f, 0.773477316f},
-std::array<float,2>{0.949612737f, 0.199473962f},
-std::array<float,2>{0.860576093f, 0.955315292f},
-std::array<float,2>{0.373827279f, 0.0203739926f},
-std::array<float,2>{0.133633405f, 0.569380641f},
-std::array<float,2>{0.511682153f, 0.469754726f},
-std::array<float,2>{0.673479319f, 0.800706506f},
-std::array<float,2>{0.0356206298f, 0.224776447f},
-std::array<float,2>{0.451812625f, 0.73119992f},
-std::array<float,2>{0.908131301f, 0.283613414f},
-std::array<float,2>{0.795261323f, 0.598407388f},
-std::array<float,2>{0.306768179f, 0.443549812f},
-std::array<float,2>{0.205781966f, 0.987110734f},
-std::array<float,2>{0.622582614f, 0.0399767533f},
-std::array<float,2>{0.532767951f, 0.686210454f},
-std::array<float,2>{0.179969937f, 0.354219049f},
-std::array<float,2>{0.32125634f, 0.853940189f},
-std::array<float,2>{0.840476274f, 0.133293971f},
-std::array<float,2>{0.975433528f, 0.910561562f},
-std::array<float,2>{0.378907204f, 0.0960209891f},
-std::array<float,2>{0.0818730891f, 0.509264469f},
-std::array<float,2>{0.698639631f, 0.383911192f},
-std::array<float,2>{0.567613482f, 0.967280686f},
-std::array<float,2>{0.226263583f, 0.0299240109f},
-std::array<float,2>{0.264752775f, 0.571865022f},
-std::array<float,2>{0.779685497f, 0.483511597f},
-std::array<float,2>{0.894596696f, 0.714693487f},
-std::array<float,2>{0.478685498f, 0.274632871f},
-std::array<float,2>{0.0152805476f, 0.767987192f},
-std::array<float,2>{0.638631403f, 0.193150431f},
-std::array<float,2>{0.736804307f, 0.559839487f},
-std::array<float,2>{0.121002302f, 0.408002466f},
-std::array<float,2>{0.426027536f, 0.89330101f},
-std::array<float,2>{0.966558456f, 0.0910660326f},
-std::array<float,2>{0.851631105f, 0.814619482f},
-std::array<float,2>{0.346738875f, 0.179190949f},
-std::array<float,2>{0.143531069f, 0.627299905f},
-std::array<float,2>{0.523725569f, 0.3420147f},
-std::array<float,2>{0.712101102f, 0.879899561f},
-std::array<float,2>{0.0776725113f, 0.0781134292f},
-std::array<float,2>{0.396337867f, 0.532945871f},
-std::array<float,2>{0.986270368f, 0.430764288f},
-std::array<float,2>{0.824521303f, 0.650453269f},
-std::array<float,2>{0.335603207f, 0.31916979f},
-std::array<float,2>{0.15847005f, 0.838859499f},
-std::array<float,2>{0.558344781f, 0.159007564f},
-std::array<float,2>{0.606961489f, 0.578840911f},
-std::array<float,2>{0.193468913f, 0.496908128f},
-std::array<float,2>{0.281800687f, 0.944797814f},
-std::array<float,2>{0.808235526f, 0.00441981805f},
-std::array<float,2>{0.922759414f, 0.764598608f},
-std::array<float,2>{0.453730911f, 0.216859475f},
-std::array<float,2>{0.0569954924f, 0.698183417f},
-std::array<float,2>{0.659129739f, 0.26493302f},
-std::array<float,2>{0.512700975f, 0.863956749f},
-std::array<float,2>{0.137302846f, 0.148424596f},
-std::array<float,2>{0.368586063f, 0.66464299f},
-std::array<float,2>{0.863564014f, 0.365398735f},
-std::array<float,2>{0.946927905f, 0.521782279f},
-std::array<float,2>{0.406966567f, 0.400453806f},
-std::array<float,2>{0.102954686f, 0.932173193f},
-std::array<float,2>{0.72546798f, 0.117668346f},
-std::array<float,2>{0.652260482f, 0.748916745f},
-std::array<float,2>{0.0249891635f, 0.2986646f},
-std::array<float,2>{0.484481037f, 0.784073412f},
-std::array<float,2>{0.883292139f, 0.248215482f},
-std::array<float,2>{0.754578173f, 0.971958637f},
-std::array<float,2>{0.278837651f, 0.0502193645f},
-std::array<float,2>{0.24357152f, 0.612516403f},
-std::array<float,2>{0.578496397f, 0.459362775f},
-std::array<float,2>{0.731606364f, 0.82965672f},
-std::array<float,2>{0.0994711071f, 0.167084083f},
-std::array<float,2>{0.414110452f, 0.642866313f},
-std::array<float,2>{0.94184655f, 0.323248535f},
-std::array<float,2>{0.86841315f, 0.543844342f},
-std::array<float,2>{0.365505219f, 0.422642499f},
-std::array<float,2>{0.131002501f, 0.885938466f},
-std::array<float,2>{0.501154006f, 0.0702941716f},
-std::array<float,2>{0.586520731f, 0.689784229f},
-std::array<float,2>{0.241278693f, 0.252750814f},
-std::array<float,2>{0.266627163f, 0.755676687f},
-std::array<float,2>{0.76041472f, 0.207402095f},
-std::array<float,2>{0.875230432f, 0.950140178f},
-std::array<float,2>{0.49816224f, 0.0118365176f},
-std::array<float,2>{0.018350536f, 0.590084076f},
-std::array<float,2>{0.643492699f, 0.486486822f},
-std::array<float,2>{0.54850477f, 0.925879061f},
-std::array<float,2>{0.165306732f, 0.115112364f},
-std::array<float,2>{0.336306244f, 0.526362181f},
-std::array<float,2>{0.814174294f, 0.397062421f},
-std::array<float,2>{0.997240841f, 0.65677166f},
-std::array<float,2>{0.404124588f, 0.372415185f},
-std::array<float,2>{0.0636012182f, 0.868543267f},
-std::array<float,2>{0.708334267f, 0.150860339f},
-std::array<float,2>{0.665673077f, 0.618309021f},
-std::array<float,2>{0.050103832f, 0.461134046f},
-std::array<float,2>{0.467984408f, 0.982378483f},
-std::array<float,2>{0.933352768f, 0.0568179451f},
-std::array<float,2>{0.797565341f, 0.796524167f},
-std::array<float,2>{0.291650474f, 0.237424076f},
-std::array<float,2>{0.201977104f, 0.734778106f},
-std::array<float,2>{0.5938375f, 0.309174091f},
-std::array<float,2>{0.630963504f, 0.995407104f},
-std::array<float,2>{0.0073882374f, 0.0377113819f},
-std::array<float,2>{0.472102612f, 0.602276862f},
-std::array<float,2>{0.902661562f, 0.452854693f},
-std::array<float,2>{0.766670525f, 0.720766842f},
-std::array<float,2>{0.252456874f, 0.291544944f},
-std::array<float,2>{0.228984699f, 0.806194067f},
-std::array<float,2>{0.573744953f, 0.226750568f},
-std::array<float,2>{0.519874692f, 0.504605889f},
-std::array<float,2>{0.153303891f, 0.379302889f},
-std::array<float,2>{0.352702051f, 0.920631468f},
-std::array<float,2>{0.850872099f, 0.105765082f},
-std::array<float,2>{0.955442429f, 0.848679423f},
-std::array<float,2>{0.437344909f, 0.12622568f},
-std::array<float,2>{0.110686511f, 0.677187085f},
-std::array<float,2>{0.745628119f, 0.346875846f},
-std::array<float,2>{0.610681772f, 0.778374135f},
-std::array<float,2>{0.214179918f, 0.197832197f},
-std::array<float,2>{0.301433504f, 0.705388308f},
-std::array<float,2>{0.787032306f, 0.270789385f},
-std::array<float,2>{0.915648758f, 0.56582588f},
-std::array<float,2>{0.444660485f, 0.474839926f},
-std::array<float,2>{0.0420219339f, 0.958579779f},
-std::array<float,2>{0.683091164f, 0.0157842394f},
-std::array<float,2>{0.692094386f, 0.63954711f},
-std::array<float,2>{0.091061227f, 0.335175931f},
-std::array<float,2>{0.388440788f, 0.825314343f},
-std::array<float,2>{0.983097792f, 0.184505343f},
-std::array<float,2>{0.82825774f, 0.901426077f},
-std::array<float,2>{0.316740721f, 0.0818428099f},
-std::array<float,2>{0.176627204f, 0.552580416f},
-std::array<float,2>{0.540408432f, 0.414496452f},
-std::array<float,2>{0.668195546f, 0.818412721f},
-std::array<float,2>{0.0513388515f, 0.174507856f},
-std::array<float,2>{0.461384445f, 0.629621685f},
-std::array<float,2>{0.934924781f, 0.338832885f},
-std::array<float,2>{0.801741898f, 0.555920184f},
-std::array<float,2>{0.295022696f, 0.410678655f},
-std::array<float,2>{0.19564946f, 0.897872269f},
-std::array<float,2>{0.600028217f, 0.0861855f},
-std::array<float,2>{0.553953111f, 0.718121588f},
-std::array<float,2>{0.171309143f, 0.280910641f},
-std::array<float,2>{0.339938492f, 0.772589207f},
-std::array<float,2>{0.820260227f, 0.189903885f},
-std::array<float,2>{0.992925763f, 0.961999595f},
-std::array<float,2>{0.399736464f, 0.0272325613f},
-std::array<float,2>{0.0701253042f, 0.577807963f},
-std::array<float,2>{0.706441224f, 0.479186565f},
-std::array<float,2>{0.590791404f, 0.907596946f},
-std::array<float,2>{0.237790838f, 0.098328881f},
-std::array<float,2>{0.270671129f, 0.513194442f},
-std::array<float,2>{0.763717651f, 0.388077229f},
-std::array<float,2>{0.880125821f, 0.682193279f},
-std::array<float,2>{0.494777352f, 0.35768947f},
-std::array<float,2>{0.0203669537f, 0.857643545f},
-std::array<float,2>{0.647351801f, 0.140451699f},
-std::array<float,2>{0.729432166f, 0.596401751f},
-std::array<float,2>{0.0954348966f, 0.439644277f},
-std::array<float,2>{0.4200688f, 0.990806341f},
-std::array<float,2>{0.940345109f, 0.0459765084f},
-std::array<float,2>{0.873168111f, 0.80402565f},
-std::array<float,2>{0.361259609f, 0.220460027f},
-std::array<float,2>{0.125018612f, 0.730140209f},
-std::array<float,2>{0.50487566f, 0.287571937f},
-std::array<float,2>{0.690148592f, 0.975857019f},
-std::array<float,2>{0.0881315991f, 0.052520819f},
-std::array<float,2>{0.385563254f, 0.613523602f},
-std::array<float,2>{0.976646185f, 0.455405295f},
-std::array<float,2>{0.834125578f, 0.745794475f},
-std::array<float,2>{0.314538896f, 0.301788568f},
-std::array<float,2>{0.174584821f, 0.786060095f},
-std::array<float,2>{0.543882728f, 0.243747935f},
-std::array<float,2>{0.613682926f, 0.518562555f},
-std::array<float,2>{0.217098743f, 0.403824896f},
-std::array<float,2>{0.300140679f, 0.936629415f},
-std::array<float,2>{0.784464657f, 0.121922888f},
-std::array<float,2>{0.920623243f, 0.862748742f},
-std::array<float,2>{0.438967079f, 0.144306257f},
-std::array<float,2>{0.045144435f, 0.671511412f},
-std::array<float,2>{0.68517828f, 0.363195539f},
-std::array<float,2>{0.518262446f, 0.7595523f},
-std::array<float,2>{0.150571167f, 0.214810818f},
-std::array<float,2>{0.358916074f, 0.702914119f},
-std::array<float,2>{0.846667647f, 0.258437961f},
-std::array<float,2>{0.959455371f, 0.58546257f},
-std::array<float,2>{0.431054056f, 0.495336205f},
-std::array<float,2>{0.114138909f, 0.940983593f},
-std::array<float,2>{0.748547971f, 0.00370572298f},
-std::array<float,2>{0.627752185f, 0.655802548f},
-std::array<float,2>{0.00179693173f, 0.314532936f},
-std::array<float,2>{0.474072188f, 0.842047393f},
-std::array<float,2>{0.89872849f, 0.162844345f},
-std::array<float,2>{0.771492898f, 0.875891209f},
-std::array<float,2>{0.255039036f, 0.0706986263f},
-std::array<float,2>{0.233603254f, 0.537835479f},
-std::array<float,2>{0.57462126f, 0.436734945f},
-std::array<float,2>{0.738380432f, 0.790828347f},
-std::array<float,2>{0.121259376f, 0.240102425f},
-std::array<float,2>{0.423287362f, 0.739304125f},
-std::array<float,2>{0.964693725f, 0.305237919f},
-std::array<float,2>{0.859158158f, 0.621378303f},
-std::array<float,2>{0.349407166f, 0.467192292f},
-std::array<float,2>{0.147866979f, 0.978483677f},
-std::array<float,2>{0.528567135f, 0.0595564879f},
-std::array<float,2>{0.563104033f, 0.662119329f},
-std::array<float,2>{0.219395533f, 0.369306475f},
-std::array<float,2>{0.257827371f, 0.873796999f},
-std::array<float,2>{0.774977684f, 0.153129235f},
-std::array<float,2>{0.893417418f, 0.923228025f},
-std::array<float,2>{0.483391047f, 0.112907849f},
-std::array<float,2>{0.00944638345f, 0.530605495f},
-std::array<float,2>{0.636699796f, 0.392498821f},
-std::array<float,2>{0.537098885f, 0.947690904f},
-std::array<float,2>{0.184021875f, 0.00988795981f},
-std::array<float,2>{0.324744552f, 0.587372601f},
-std::array<float,2>{0.837694168f, 0.492074877f},
-std::array<float,2>{0.972196996f, 0.694334745f},
-std::array<float,2>{0.378314495f, 0.257276624f},
-std::array<float,2>{0.0834721103f, 0.753566742f},
-std::array<float,2>{0.701401174f, 0.206518903f},
-std::array<float,2>{0.679241955f, 0.540811896f},
-std::array<float,2>{0.0317096598f, 0.42690894f},
-std::array<float,2>{0.44673267f, 0.889407575f},
-std::array<float,2>{0.913186908f, 0.0637499094f},
-std::array<float,2>{0.792262495f, 0.833281517f},
-std::array<float,2>{0.310575068f, 0.16906701f},
-std::array<float,2>{0.208163723f, 0.646564364f},
-std::array<float,2>{0.620554745f, 0.327738583f},
-std::array<float,2>{0.65578109f, 0.902371287f},
-std::array<float,2>{0.0281801615f, 0.0840233117f},
-std::array<float,2>{0.489916682f, 0.549207211f},
-std::array<float,2>{0.888234794f, 0.421019375f},
-std::array<float,2>{0.751920402f, 0.634189308f},
-std::array<float,2>{0.277190685f, 0.329150677f},
-std::array<float,2>{0.247458309f, 0.820438683f},
-std::array<float,2>{0.583956659f, 0.179862499f},
-std::array<float,2>{0.509262979f, 0.566505194f},
-std::array<float,2>{0.13543129f, 0.472061157f},
-std::array<float,2>{0.371902913f, 0.954103887f},
-std::array<float,2>{0.862037122f, 0.0233546142f},
-std::array<float,2>{0.953070045f, 0.776033878f},
-std::array<float,2>{0.411064535f, 0.20232518f},
-std::array<float,2>{0.108477592f, 0.707096517f},
-std::array<float,2>{0.721821845f, 0.267328858f},
-std::array<float,2>{0.602527976f, 0.845145941f},
-std::array<float,2>{0.189813167f, 0.129591763f},
-std::array<float,2>{0.287780553f, 0.673929811f},
-std::array<float,2>{0.81226933f, 0.349200189f},
-std::array<float,2>{0.928924322f, 0.502783656f},
-std::array<float,2>{0.458280951f, 0.376342803f},
-std::array<float,2>{0.0614621714f, 0.916083753f},
-std::array<float,2>{0.66034317f, 0.10475377f},
-std::array<float,2>{0.716799498f, 0.723813176f},
-std::array<float,2>{0.0718674436f, 0.294049263f},
-std::array<float,2>{0.392241091f, 0.808637559f},
-std::array<float,2>{0.990501106f, 0.233945012f},
-std::array<float,2>{0.820752084f, 0.999865949f},
-std::array<float,2>{0.331417173f, 0.0345086679f},
-std::array<float,2>{0.16116567f, 0.606692374f},
-std::array<float,2>{0.559523046f, 0.44569847f},
-std::array<float,2>{0.639510453f, 0.765651584f},
-std::array<float,2>{0.0134880468f, 0.194544569f},
-std::array<float,2>{0.476810008f, 0.712723434f},
-std::array<float,2>{0.896608651f, 0.276418179f},
-std::array<float,2>{0.777776957f, 0.573034406f},
-std::array<float,2>{0.263189077f, 0.480538368f},
-std::array<float,2>{0.22403641f, 0.965572834f},
-std::array<float,2>{0.570162356f, 0.0282746442f},
-std::array<float,2>{0.52734071f, 0.626950443f},
-std::array<float,2>{0.141390219f, 0.340831339f},
-std::array<float,2>{0.344807684f, 0.814366341f},
-std::array<float,2>{0.85493505f, 0.177281663f},
-std::array<float,2>{0.968748927f, 0.892059982f},
-std::array<float,2>{0.428792089f, 0.0935443044f},
-std::array<float,2>{0.117765576f, 0.561245203f},
-std::array<float,2>{0.735871732f, 0.409133136f},
-std::array<float,2>{0.624625146f, 0.984801233f},
-std::array<float,2>{0.204628929f, 0.0418510512f},
-std::array<float,2>{0.305732399f, 0.600021124f},
-std::array<float,2>{0.794468284f, 0.442749858f},
-std::array<float,2>{0.909000337f, 0.734203041f},
-std::array<float,2>{0.451093227f, 0.282941669f},
-std::array<float,2>{0.0383380093f, 0.797502697f},
-std::array<float,2>{0.675096035f, 0.222822726f},
-std::array<float,2>{0.696050763f, 0.511170268f},
-std::array<float,2>{0.0784383416f, 0.385502964f},
-std::array<float,2>{0.382131934f, 0.912356555f},
-std::array<float,2>{0.973791361f, 0.0940018818f},
-std::array<float,2>{0.84328419f, 0.851881206f},
-std::array<float,2>{0.322964042f, 0.135960579f},
-std::array<float,2>{0.182465509f, 0.684007585f},
-std::array<float,2>{0.535068393f, 0.351884037f},
-std::array<float,2>{0.722828269f, 0.93130815f},
-std::array<float,2>{0.104567401f, 0.119665332f},
-std::array<float,2>{0.408985972f, 0.519553304f},
-std::array<float,2>{0.947889507f, 0.399864972f},
-std::array<float,2>{0.86710608f, 0.666690171f},
-std::array<float,2>{0.370109499f, 0.363705009f},
-std::array<float,2>{0.140353173f, 0.866446912f},
-std::array<float,2>{0.514193356f, 0.144840032f},
-std::array<float,2>{0.581216633f, 0.609388173f},
-std::array<float,2>{0.244985044f, 0.458031833f},
-std::array<float,2>{0.279740334f, 0.969648182f},
-std::array<float,2>{0.755992055f, 0.0480735637f},
-std::array<float,2>{0.885207832f, 0.781326592f},
-std::array<float,2>{0.487723291f, 0.247098729f},
-std::array<float,2>{0.026733119f, 0.747168541f},
-std::array<float,2>{0.649573505f, 0.299289107f},
-std::array<float,2>{0.55588156f, 0.836801827f},
-std::array<float,2>{0.15799436f, 0.156993955f},
-std::array<float,2>{0.333253533f, 0.64953959f},
-std::array<float,2>{0.82640779f, 0.31771785f},
-std::array<float,2>{0.986946702f, 0.53437233f},
-std::array<float,2>{0.39743939f, 0.432762563f},
-std::array<float,2>{0.0761055499f, 0.881223619f},
-std::array<float,2>{0.714175463f, 0.0750266388f},
-std::array<float,2>{0.657224059f, 0.695507824f},
-std::array<float,2>{0.0561077036f, 0.26270625f},
-std::array<float,2>{0.456216127f, 0.761877835f},
-std::array<float,2>{0.923912644f, 0.215521827f},
-std::array<float,2>{0.806481719f, 0.943143487f},
-std::array<float,2>{0.284619212f, 0.00612983713f},
-std::array<float,2>{0.192357346f, 0.581977725f},
-std::array<float,2>{0.607801735f, 0.498578519f},
-std::array<float,2>{0.709150195f, 0.869416833f},
-std::array<float,2>{0.0656464249f, 0.14965196f},
-std::array<float,2>{0.40590027f, 0.659902036f},
-std::array<float,2>{0.999398112f, 0.373583972f},
-std::array<float,2>{0.815638602f, 0.523517013f},
-std::array<float,2>{0.338964403f, 0.394686133f},
-std::array<float,2>{0.166433915f, 0.928689063f},
-std::array<float,2>{0.550178468f, 0.115287334f},
-std::array<float,2>{0.596743286f, 0.738038003f},
-std::array<float,2>{0.200514808f, 0.312331408f},
-std::array<float,2>{0.289289057f, 0.794576049f},
-std::array<float,2>{0.800394237f, 0.235927343f},
-std::array<float,2>{0.931305468f, 0.983462274f},
-std::array<float,2>{0.465310246f, 0.0562157147f},
-std::array<float,2>{0.0480240732f, 0.619961679f},
-std::array<float,2>{0.667149842f, 0.464005947f},
-std::array<float,2>{0.502717197f, 0.883681536f},
-std::array<float,2>{0.130352587f, 0.0683414936f},
-std::array<float,2>{0.363953173f, 0.545787096f},
-std::array<float,2>{0.870580971f, 0.42548281f},
-std::array<float,2>{0.944731474f, 0.642083704f},
-std::array<float,2>{0.41775316f, 0.320698172f},
-std::array<float,2>{0.100638792f, 0.831605554f},
-std::array<float,2>{0.734101653f, 0.165191546f},
-std::array<float,2>{0.641501665f, 0.593117714f},
-std::array<float,2>{0.0165117867f, 0.484861553f},
-std::array<float,2>{0.496578962f, 0.952970207f},
-std::array<float,2>{0.878769219f, 0.0151127949f},
-std::array<float,2>{0.758448184f, 0.756516993f},
-std::array<float,2>{0.267959088f, 0.209203735f},
-std::array<float,2>{0.23862496f, 0.688721597f},
-std::array<float,2>{0.588426292f, 0.250655562f},
-std::array<float,2>{0.679814935f, 0.960010588f},
-std::array<float,2>{0.0402272269f, 0.0190671254f},
-std::array<float,2>{0.441779256f, 0.563866436f},
-std::array<float,2>{0.917412877f, 0.472955287f},
-std::array<float,2>{0.78835237f, 0.703894615f},
-std::array<float,2>{0.303533196f, 0.273351014f},
-std::array<float,2>{0.211118445f, 0.780157506f},
-std::array<float,2>{0.612676919f, 0.19618018f},
-std::array<float,2>{0.541398823f, 0.55425781f},
-std::array<float,2>{0.17814073f, 0.41788739f},
-std::array<float,2>{0.319388419f, 0.898551285f},
-std::array<float,2>{0.831977069f, 0.0795856193f},
-std::array<float,2>{0.981471777f, 0.827508807f},
-std::array<float,2>{0.390072644f, 0.186984614f},
-std::array<float,2>{0.091903545f, 0.637624681f},
-std::array<float,2>{0.694862425f, 0.333690137f},
-std::array<float,2>{0.571407437f, 0.808184147f},
-std::array<float,2>{0.226661995f, 0.229152128f},
-std::array<float,2>{0.250829726f, 0.7199229f},
-std::array<float,2>{0.768967748f, 0.289736658f},
-std::array<float,2>{0.904725313f, 0.604155898f},
-std::array<float,2>{0.468945384f, 0.450924963f},
-std::array<float,2>{0.00557510927f, 0.9935956f},
-std::array<float,2>{0.630295157f, 0.0354032591f},
-std::array<float,2>{0.743514776f, 0.678038299f},
-std::array<float,2>{0.111977138f, 0.345383137f},
-std::array<float,2>{0.435253501f, 0.851325035f},
-std::array<float,2>{0.954425335f, 0.126987308f},
-std::array<float,2>{0.848423302f, 0.918400168f},
-std::array<float,2>{0.353870153f, 0.109231979f},
-std::array<float,2>{0.155045286f, 0.506183088f},
-std::array<float,2>{0.521900952f, 0.381659359f},
-std::array<float,2>{0.64330864f, 0.830341995f},
-std::array<float,2>{0.0181224756f, 0.164795011f},
-std::array<float,2>{0.498477906f, 0.640835285f},
-std::array<float,2>{0.875392318f, 0.322081029f},
-std::array<float,2>{0.760573149f, 0.546569407f},
-std::array<float,2>{0.266869813f, 0.423911482f},
-std::array<float,2>{0.241573349f, 0.883811414f},
-std::array<float,2>{0.586827099f, 0.066497393f},
-std::array<float,2>{0.501383364f, 0.688242733f},
-std::array<float,2>{0.131202132f, 0.25131762f},
-std::array<float,2>{0.365343899f, 0.757371545f},
-std::array<float,2>{0.868369043f, 0.210249647f},
-std::array<float,2>{0.94151485f, 0.951904655f},
-std::array<float,2>{0.414548427f, 0.0141039025f},
-std::array<float,2>{0.0991950631f, 0.592567265f},
-std::array<float,2>{0.731887519f, 0.48597458f},
-std::array<float,2>{0.594015241f, 0.929473937f},
-std::array<float,2>{0.201857656f, 0.116712928f},
-std::array<float,2>{0.291817427f, 0.524830401f},
-std::array<float,2>{0.797640443f, 0.396087974f},
-std::array<float,2>{0.933201849f, 0.658337951f},
-std::array<float,2>{0.468061119f, 0.374394566f},
-std::array<float,2>{0.0498107895f, 0.870366216f},
-std::array<float,2>{0.665785313f, 0.148732275f},
-std::array<float,2>{0.708230436f, 0.620604336f},
-std::array<float,2>{0.0639469847f, 0.463669091f},
-std::array<float,2>{0.403956354f, 0.982806444f},
-std::array<float,2>{0.997421503f, 0.0549665652f},
-std::array<float,2>{0.814319491f, 0.793346763f},
-std::array<float,2>{0.336144239f, 0.234744012f},
-std::array<float,2>{0.165273726f, 0.736587107f},
-std::array<float,2>{0.548819482f, 0.310988247f},
-std::array<float,2>{0.745937824f, 0.992222786f},
-std::array<float,2>{0.110378444f, 0.0365700088f},
-std::array<float,2>{0.437079757f, 0.60496527f},
-std::array<float,2>{0.955270708f, 0.449467272f},
-std::array<float,2>{0.850826085f, 0.719530404f},
-std::array<float,2>{0.352802068f, 0.29084453f},
-std::array<float,2>{0.15291518f, 0.80717814f},
-std::array<float,2>{0.519552946f, 0.229811534f},
-std::array<float,2>{0.574166119f, 0.507804155f},
-std::array<float,2>{0.228639707f, 0.382731795f},
-std::array<float,2>{0.252821505f, 0.919056952f},
-std::array<float,2>{0.766872406f, 0.108284667f},
-std::array<float,2>{0.902441144f, 0.850331724f},
-std::array<float,2>{0.471838593f, 0.127958611f},
-std::array<float,2>{0.00767155457f, 0.679540277f},
-std::array<float,2>{0.631329358f, 0.343841404f},
-std::array<float,2>{0.540265083f, 0.780494094f},
-std::array<float,2>{0.176292956f, 0.197048739f},
-std::array<float,2>{0.316459507f, 0.704190791f},
-std::array<float,2>{0.828475296f, 0.272073269f},
-std::array<float,2>{0.983282447f, 0.562828302f},
-std::array<float,2>{0.388424426f, 0.474171609f},
-std::array<float,2>{0.09130086f, 0.959093928f},
-std::array<float,2>{0.692310572f, 0.0181851443f},
-std::array<float,2>{0.682625353f, 0.638535023f},
-std::array<float,2>{0.0424112678f, 0.33227998f},
-std::array<float,2>{0.444568455f, 0.82653898f},
-std::array<float,2>{0.915943801f, 0.185921595f},
-std::array<float,2>{0.786845386f, 0.899647117f},
-std::array<float,2>{0.301549554f, 0.0786573142f},
-std::array<float,2>{0.21409367f, 0.553606331f},
-std::array<float,2>{0.610472083f, 0.416734368f},
-std::array<float,2>{0.698345184f, 0.798322558f},
-std::array<float,2>{0.0815509781f, 0.224267215f},
-std::array<float,2>{0.379304796f, 0.732462943f},
-std::array<float,2>{0.975196838f, 0.281818062f},
-std::array<float,2>{0.840659499f, 0.600776732f},
-std::array<float,2>{0.320867777f, 0.44223699f},
-std::array<float,2>{0.179817066f, 0.986127198f},
-std::array<float,2>{0.532972276f, 0.0425519682f},
-std::array<float,2>{0.622828484f, 0.684657812f},
-std::array<float,2>{0.205884069f, 0.352566153f},
-std::array<float,2>{0.30693835f, 0.852961242f},
-std::array<float,2>{0.795129955f, 0.135614038f},
-std::array<float,2>{0.907902241f, 0.913279772f},
-std::array<float,2>{0.452008426f, 0.0955153778f},
-std::array<float,2>{0.0352065004f, 0.510297477f},
-std::array<float,2>{0.673792899f, 0.385990918f},
-std::array<float,2>{0.523570538f, 0.966278553f},
-std::array<float,2>{0.143299326f, 0.0292916726f},
-std::array<float,2>{0.346983552f, 0.573334754f},
-std::array<float,2>{0.851927519f, 0.482227504f},
-std::array<float,2>{0.966317773f, 0.711581528f},
-std::array<float,2>{0.425919622f, 0.276267201f},
-std::array<float,2>{0.120634705f, 0.766784787f},
-std::array<float,2>{0.736361325f, 0.194013536f},
-std::array<float,2>{0.638226509f, 0.562041402f},
-std::array<float,2>{0.015529843f, 0.410154432f},
-std::array<float,2>{0.478884667f, 0.891284406f},
-std::array<float,2>{0.894965172f, 0.0922180638f},
-std::array<float,2>{0.779460073f, 0.813041866f},
-std::array<float,2>{0.265048683f, 0.176315844f},
-std::array<float,2>{0.226387724f, 0.625000775f},
-std::array<float,2>{0.567863345f, 0.340638638f},
-std::array<float,2>{0.65889895f, 0.882812381f},
-std::array<float,2>{0.0567003377f, 0.0752186999f},
-std::array<float,2>{0.453923672f, 0.533503413f},
-std::array<float,2>{0.922540009f, 0.432374567f},
-std::array<float,2>{0.808440089f, 0.64861232f},
-std::array<float,2>{0.282220453f, 0.317113549f},
-std::array<float,2>{0.193723336f, 0.837717235f},
-std::array<float,2>{0.607343674f, 0.157867864f},
-std::array<float,2>{0.558373809f, 0.58090049f},
-std::array<float,2>{0.158282354f, 0.49984464f},
-std::array<float,2>{0.335804373f, 0.941452444f},
-std::array<float,2>{0.824378014f, 0.00713143544f},
-std::array<float,2>{0.985881805f, 0.763025045f},
-std::array<float,2>{0.396057516f, 0.21652168f},
-std::array<float,2>{0.0780245438f, 0.696295619f},
-std::array<float,2>{0.712161422f, 0.262213171f},
-std::array<float,2>{0.578253329f, 0.865771353f},
-std::array<float,2>{0.243189126f, 0.145730108f},
-std::array<float,2>{0.279212981f, 0.667890429f},
-std::array<float,2>{0.754851103f, 0.364620119f},
-std::array<float,2>{0.882842898f, 0.520788968f},
-std::array<float,2>{0.484808058f, 0.399301827f},
-std::array<float,2>{0.0252403617f, 0.930406213f},
-std::array<float,2>{0.651971102f, 0.120583728f},
-std::array<float,2>{0.725331545f, 0.74623698f},
-std::array<float,2>{0.102692895f, 0.300144941f},
-std::array<float,2>{0.407202989f, 0.782300591f},
-std::array<float,2>{0.94721365f, 0.247044384f},
-std::array<float,2>{0.863477886f, 0.96998477f},
-std::array<float,2>{0.36826387f, 0.0472634137f},
-std::array<float,2>{0.137641013f, 0.610552728f},
-std::array<float,2>{0.512949347f, 0.457842559f},
-std::array<float,2>{0.676654875f, 0.752856731f},
-std::array<float,2>{0.0334888846f, 0.205705434f},
-std::array<float,2>{0.447855562f, 0.694968343f},
-std::array<float,2>{0.911413014f, 0.256086111f},
-std::array<float,2>{0.790337384f, 0.586251855f},
-std::array<float,2>{0.309579998f, 0.490501165f},
-std::array<float,2>{0.209882274f, 0.948443353f},
-std::array<float,2>{0.618525445f, 0.0114603341f},
-std::array<float,2>{0.537798822f, 0.647978544f},
-std::array<float,2>{0.18556653f, 0.326618314f},
-std::array<float,2>{0.327790976f, 0.832562745f},
-std::array<float,2>{0.839598835f, 0.168795004f},
-std::array<float,2>{0.970034957f, 0.890306115f},
-std::array<float,2>{0.375592947f, 0.0630619526f},
-std::array<float,2>{0.0850379393f, 0.539862156f},
-std::array<float,2>{0.700158417f, 0.425951809f},
-std::array<float,2>{0.566306531f, 0.976708353f},
-std::array<float,2>{0.222423717f, 0.0595769361f},
-std::array<float,2>{0.26078552f, 0.622418523f},
-std::array<float,2>{0.776988506f, 0.468239486f},
-std::array<float,2>{0.890803397f, 0.738628983f},
-std::array<float,2>{0.480723441f, 0.30603072f},
-std::array<float,2>{0.0114856455f, 0.789962471f},
-std::array<float,2>{0.634656787f, 0.238541991f},
-std::array<float,2>{0.741591811f, 0.529407084f},
-std::array<float,2>{0.123742253f, 0.390950322f},
-std::array<float,2>{0.424956828f, 0.92249614f},
-std::array<float,2>{0.961439967f, 0.111461699f},
-std::array<float,2>{0.856101036f, 0.874374211f},
-std::array<float,2>{0.350084037f, 0.154016688f},
-std::array<float,2>{0.144867197f, 0.663485765f},
-std::array<float,2>{0.530095339f, 0.370761514f},
-std::array<float,2>{0.715906739f, 0.917713702f},
-std::array<float,2>{0.0732678697f, 0.103523508f},
-std::array<float,2>{0.393132508f, 0.503148615f},
-std::array<float,2>{0.989870787f, 0.375727534f},
-std::array<float,2>{0.822395802f, 0.674807727f},
-std::array<float,2>{0.328793555f, 0.348356903f},
-std::array<float,2>{0.163684458f, 0.844223022f},
-std::array<float,2>{0.562365413f, 0.130602941f},
-std::array<float,2>{0.60360527f, 0.606175125f},
-std::array<float,2>{0.188835517f, 0.446429729f},
-std::array<float,2>{0.285677224f, 0.998253047f},
-std::array<float,2>{0.809208989f, 0.0336514339f},
-std::array<float,2>{0.9273175f, 0.809837341f},
-std::array<float,2>{0.459398776f, 0.232959524f},
-std::array<float,2>{0.0602963306f, 0.723626614f},
-std::array<float,2>{0.663894236f, 0.293756753f},
-std::array<float,2>{0.511421204f, 0.821394384f},
-std::array<float,2>{0.133422673f, 0.181053758f},
-std::array<float,2>{0.373550713f, 0.633742392f},
-std::array<float,2>{0.860810816f, 0.329078019f},
-std::array<float,2>{0.949392498f, 0.55023104f},
-std::array<float,2>{0.412200391f, 0.420745194f},
-std::array<float,2>{0.106712997f, 0.903654099f},
-std::array<float,2>{0.719852388f, 0.0854609683f},
-std::array<float,2>{0.652541339f, 0.708722949f},
-std::array<float,2>{0.0307497308f, 0.265657097f},
-std::array<float,2>{0.491835862f, 0.776639104f},
-std::array<float,2>{0.889579237f, 0.201302901f},
-std::array<float,2>{0.75352937f, 0.953664303f},
-std::array<float,2>{0.275342494f, 0.0219771005f},
-std::array<float,2>{0.248995438f, 0.567640603f},
-std::array<float,2>{0.584274709f, 0.471654862f},
-std::array<float,2>{0.727265835f, 0.859097302f},
-std::array<float,2>{0.0969514325f, 0.139619052f},
-std::array<float,2>{0.419402987f, 0.682802081f},
-std::array<float,2>{0.939012051f, 0.358517587f},
-std::array<float,2>{0.872545183f, 0.512228847f},
-std::array<float,2>{0.363060713f, 0.38689819f},
-std::array<float,2>{0.127037808f, 0.907052457f},
-std::array<float,2>{0.506985128f, 0.0995245501f},
-std::array<float,2>{0.593274057f, 0.729078352f},
-std::array<float,2>{0.235699728f, 0.288201779f},
-std::array<float,2>{0.272867113f, 0.80298382f},
-std::array<float,2>{0.761776745f, 0.219356909f},
-std::array<float,2>{0.881118774f, 0.992026329f},
-std::array<float,2>{0.493840575f, 0.0458379351f},
-std::array<float,2>{0.0221788865f, 0.597306252f},
-std::array<float,2>{0.645248771f, 0.4406735f},
-std::array<float,2>{0.551129282f, 0.897230804f},
-std::array<float,2>{0.168169305f, 0.0874853805f},
-std::array<float,2>{0.343439341f, 0.554888129f},
-std::array<float,2>{0.817736268f, 0.411907226f},
-std::array<float,2>{0.994856417f, 0.629969358f},
-std::array<float,2>{0.401164502f, 0.339269698f},
-std::array<float,2>{0.0683187693f, 0.819402039f},
-std::array<float,2>{0.704981685f, 0.175066859f},
-std::array<float,2>{0.670189381f, 0.577146173f},
-std::array<float,2>{0.0530575663f, 0.479516983f},
-std::array<float,2>{0.464523882f, 0.960942149f},
-std::array<float,2>{0.936700583f, 0.0261425171f},
-std::array<float,2>{0.804509163f, 0.771685958f},
-std::array<float,2>{0.293590993f, 0.190495938f},
-std::array<float,2>{0.198266625f, 0.717233896f},
-std::array<float,2>{0.599200368f, 0.279480308f},
-std::array<float,2>{0.626533926f, 0.94010973f},
-std::array<float,2>{0.0028537584f, 0.00244633504f},
-std::array<float,2>{0.476445764f, 0.584000289f},
-std::array<float,2>{0.902320206f, 0.494850636f},
-std::array<float,2>{0.770500839f, 0.70168668f},
-std::array<float,2>{0.256504059f, 0.259044468f},
-std::array<float,2>{0.230841413f, 0.757935882f},
-std::array<float,2>{0.576743245f, 0.213307351f},
-std::array<float,2>{0.51593411f, 0.538908422f},
-std::array<float,2>{0.148518562f, 0.436488777f},
-std::array<float,2>{0.356653839f, 0.876738429f},
-std::array<float,2>{0.845296204f, 0.0721400231f},
-std::array<float,2>{0.958471417f, 0.842960894f},
-std::array<float,2>{0.433088005f, 0.163130268f},
-std::array<float,2>{0.116510026f, 0.654591203f},
-std::array<float,2>{0.747454405f, 0.315945923f},
-std::array<float,2>{0.616480052f, 0.786192119f},
-std::array<float,2>{0.215834931f, 0.242341891f},
-std::array<float,2>{0.297326565f, 0.744788885f},
-std::array<float,2>{0.781811953f, 0.301582485f},
-std::array<float,2>{0.919567287f, 0.615042031f},
-std::array<float,2>{0.440936625f, 0.456825376f},
-std::array<float,2>{0.0436595827f, 0.974825799f},
-std::array<float,2>{0.687374949f, 0.0508858338f},
-std::array<float,2>{0.687986791f, 0.670874059f},
-std::array<float,2>{0.0864357054f, 0.362172425f},
-std::array<float,2>{0.383042336f, 0.8619169f},
-std::array<float,2>{0.98042047f, 0.14297089f},
-std::array<float,2>{0.832283974f, 0.935579002f},
-std::array<float,2>{0.314254016f, 0.122785486f},
-std::array<float,2>{0.173666239f, 0.518390298f},
-std::array<float,2>{0.546733975f, 0.402754575f},
-std::array<float,2>{0.667314827f, 0.86806649f},
-std::array<float,2>{0.0482964106f, 0.152193278f},
-std::array<float,2>{0.465033799f, 0.658039212f},
-std::array<float,2>{0.931503952f, 0.371966273f},
-std::array<float,2>{0.800668001f, 0.526931882f},
-std::array<float,2>{0.289347291f, 0.397531897f},
-std::array<float,2>{0.200267792f, 0.926882982f},
-std::array<float,2>{0.597108603f, 0.114195228f},
-std::array<float,2>{0.549959183f, 0.736215472f},
-std::array<float,2>{0.166248515f, 0.31014362f},
-std::array<float,2>{0.339137614f, 0.795085013f},
-std::array<float,2>{0.815844536f, 0.236561596f},
-std::array<float,2>{0.999211133f, 0.980740488f},
-std::array<float,2>{0.406016707f, 0.057874687f},
-std::array<float,2>{0.0658127144f, 0.617767394f},
-std::array<float,2>{0.70941329f, 0.462204844f},
-std::array<float,2>{0.588809609f, 0.885474622f},
-std::array<float,2>{0.238392174f, 0.0685286969f},
-std::array<float,2>{0.267782629f, 0.54440248f},
-std::array<float,2>{0.758640468f, 0.423423856f},
-std::array<float,2>{0.878546298f, 0.643712223f},
-std::array<float,2>{0.496293664f, 0.322290242f},
-std::array<float,2>{0.0161275789f, 0.828803301f},
-std::array<float,2>{0.641303897f, 0.166058734f},
-std::array<float,2>{0.734350324f, 0.591261208f},
-std::array<float,2>{0.100865684f, 0.487910211f},
-std::array<float,2>{0.417633653f, 0.950793922f},
-std::array<float,2>{0.944350183f, 0.0131683154f},
-std::array<float,2>{0.870299399f, 0.754396439f},
-std::array<float,2>{0.364151895f, 0.208295465f},
-std::array<float,2>{0.130026743f, 0.691139758f},
-std::array<float,2>{0.50254035f, 0.253381699f},
-std::array<float,2>{0.695274413f, 0.957321405f},
-std::array<float,2>{0.0921555012f, 0.0172099844f},
-std::array<float,2>{0.389820337f, 0.564767957f},
-std::array<float,2>{0.981776655f, 0.476123989f},
-std::array<float,2>{0.831641436f, 0.706612289f},
-std::array<float,2>{0.319774628f, 0.269534349f},
-std::array<float,2>{0.177757815f, 0.778226614f},
-std::array<float,2>{0.541032672f, 0.198601186f},
-std::array<float,2>{0.612515986f, 0.551709354f},
-std::array<float,2>{0.211348563f, 0.415462852f},
-std::array<float,2>{0.303250283f, 0.900867581f},
-std::array<float,2>{0.788137317f, 0.080619812f},
-std::array<float,2>{0.917168975f, 0.825128675f},
-std::array<float,2>{0.441633403f, 0.185165897f},
-std::array<float,2>{0.0403485522f, 0.640567005f},
-std::array<float,2>{0.680124283f, 0.334492087f},
-std::array<float,2>{0.521591544f, 0.80559653f},
-std::array<float,2>{0.154977307f, 0.227641076f},
-std::array<float,2>{0.353755802f, 0.722452581f},
-std::array<float,2>{0.848282814f, 0.292570293f},
-std::array<float,2>{0.954237342f, 0.602738917f},
-std::array<float,2>{0.435311347f, 0.451661676f},
-std::array<float,2>{0.112148926f, 0.994582117f},
-std::array<float,2>{0.743344665f, 0.0387941711f},
-std::array<float,2>{0.629899323f, 0.676357985f},
-std::array<float,2>{0.00564374728f, 0.346219599f},
-std::array<float,2>{0.469083905f, 0.848086357f},
-std::array<float,2>{0.904404819f, 0.12544173f},
-std::array<float,2>{0.768669367f, 0.921058416f},
-std::array<float,2>{0.250707805f, 0.107341476f},
-std::array<float,2>{0.226837754f, 0.505360723f},
-std::array<float,2>{0.571552813f, 0.380779296f},
-std::array<float,2>{0.736119986f, 0.769267797f},
-std::array<float,2>{0.118104964f, 0.192093477f},
-std::array<float,2>{0.429071248f, 0.713171482f},
-std::array<float,2>{0.968470573f, 0.274119496f},
-std::array<float,2>{0.854546428f, 0.570928872f},
-std::array<float,2>{0.345040768f, 0.483109742f},
-std::array<float,2>{0.141263574f, 0.968025863f},
-std::array<float,2>{0.526902676f, 0.0305903219f},
-std::array<float,2>{0.569901764f, 0.62869215f},
-std::array<float,2>{0.223825097f, 0.343559325f},
-std::array<float,2>{0.263542622f, 0.816317379f},
-std::array<float,2>{0.777457118f, 0.178034574f},
-std::array<float,2>{0.896881282f, 0.894512951f},
-std::array<float,2>{0.476679146f, 0.0899971873f},
-std::array<float,2>{0.0133106317f, 0.559391022f},
-std::array<float,2>{0.639221847f, 0.406763583f},
-std::array<float,2>{0.534727514f, 0.988021731f},
-std::array<float,2>{0.182196647f, 0.0400582813f},
-std::array<float,2>{0.323136419f, 0.599237382f},
-std::array<float,2>{0.843718112f, 0.444401652f},
-std::array<float,2>{0.974115193f, 0.732396543f},
-std::array<float,2>{0.382010967f, 0.284258664f},
-std::array<float,2>{0.0783322379f, 0.79885906f},
-std::array<float,2>{0.695854366f, 0.226229519f},
-std::array<float,2>{0.674884498f, 0.508669734f},
-std::array<float,2>{0.0382567681f, 0.382963747f},
-std::array<float,2>{0.450846165f, 0.911706984f},
-std::array<float,2>{0.9088943f, 0.0969359204f},
-std::array<float,2>{0.794787824f, 0.854932249f},
-std::array<float,2>{0.305927902f, 0.134213433f},
-std::array<float,2>{0.205052957f, 0.686983228f},
-std::array<float,2>{0.624899685f, 0.354759485f},
-std::array<float,2>{0.649867475f, 0.932748199f},
-std::array<float,2>{0.0265984032f, 0.118482091f},
-std::array<float,2>{0.487352222f, 0.523188114f},
-std::array<float,2>{0.884834647f, 0.401592553f},
-std::array<float,2>{0.756191432f, 0.665909111f},
-std::array<float,2>{0.279423386f, 0.366380543f},
-std::array<float,2>{0.244824663f, 0.864340961f},
-std::array<float,2>{0.581536055f, 0.147243723f},
-std::array<float,2>{0.514570832f, 0.612084508f},
-std::array<float,2>{0.140528828f, 0.460321367f},
-std::array<float,2>{0.369750112f, 0.970919967f},
-std::array<float,2>{0.86678648f, 0.0490933955f},
-std::array<float,2>{0.948181212f, 0.784420609f},
-std::array<float,2>{0.408721745f, 0.249610707f},
-std::array<float,2>{0.104786195f, 0.749499857f},
-std::array<float,2>{0.722998142f, 0.297048211f},
-std::array<float,2>{0.607489109f, 0.839437008f},
-std::array<float,2>{0.191899553f, 0.159516424f},
-std::array<float,2>{0.284268707f, 0.651382387f},
-std::array<float,2>{0.806337595f, 0.319624007f},
-std::array<float,2>{0.924263418f, 0.53132087f},
-std::array<float,2>{0.456526816f, 0.430499464f},
-std::array<float,2>{0.0558865182f, 0.879520059f},
-std::array<float,2>{0.656764746f, 0.0768302381f},
-std::array<float,2>{0.714101434f, 0.698462963f},
-std::array<float,2>{0.075809665f, 0.263707489f},
-std::array<float,2>{0.397000045f, 0.764813125f},
-std::array<float,2>{0.987181246f, 0.218351901f},
-std::array<float,2>{0.826514363f, 0.944081247f},
-std::array<float,2>{0.333193392f, 0.00556916837f},
-std::array<float,2>{0.157885417f, 0.579247177f},
-std::array<float,2>{0.556123078f, 0.497762531f},
-std::array<float,2>{0.636286139f, 0.792856634f},
-std::array<float,2>{0.00976458099f, 0.240551665f},
-std::array<float,2>{0.483007073f, 0.742048562f},
-std::array<float,2>{0.893118739f, 0.307895601f},
-std::array<float,2>{0.775310576f, 0.623554945f},
-std::array<float,2>{0.258265674f, 0.46494168f},
-std::array<float,2>{0.219515875f, 0.979030967f},
-std::array<float,2>{0.563341796f, 0.0611185245f},
-std::array<float,2>{0.528529584f, 0.661577761f},
-std::array<float,2>{0.14750731f, 0.36893028f},
-std::array<float,2>{0.349256575f, 0.87282908f},
-std::array<float,2>{0.859108388f, 0.154336885f},
-std::array<float,2>{0.964374959f, 0.925221324f},
-std::array<float,2>{0.422938645f, 0.1106034f},
-std::array<float,2>{0.121376447f, 0.528153837f},
-std::array<float,2>{0.738623559f, 0.392732203f},
-std::array<float,2>{0.620291889f, 0.94625628f},
-std::array<float,2>{0.208462134f, 0.00782753807f},
-std::array<float,2>{0.310864836f, 0.589318275f},
-std::array<float,2>{0.792001963f, 0.48984322f},
-std::array<float,2>{0.913330436f, 0.69285959f},
-std::array<float,2>{0.446341842f, 0.253963441f},
-std::array<float,2>{0.0314242803f, 0.750770271f},
-std::array<float,2>{0.679610312f, 0.204993084f},
-std::array<float,2>{0.701443732f, 0.54129225f},
-std::array<float,2>{0.0831505135f, 0.428881705f},
-std::array<float,2>{0.378146708f, 0.888331652f},
-std::array<float,2>{0.972515106f, 0.0650098771f},
-std::array<float,2>{0.837550044f, 0.835129917f},
-std::array<float,2>{0.325055122f, 0.171358198f},
-std::array<float,2>{0.183742076f, 0.644976377f},
-std::array<float,2>{0.536649883f, 0.324268848f},
-std::array<float,2>{0.722049475f, 0.904663205f},
-std::array<float,2>{0.108651221f, 0.0831234008f},
-std::array<float,2>{0.410673946f, 0.548349977f},
-std::array<float,2>{0.952858567f, 0.418677032f},
-std::array<float,2>{0.862089634f, 0.636577785f},
-std::array<float,2>{0.371691108f, 0.330997735f},
-std::array<float,2>{0.135668114f, 0.823606372f},
-std::array<float,2>{0.508983076f, 0.182193324f},
-std::array<float,2>{0.583529413f, 0.568600297f},
-std::array<float,2>{0.247292876f, 0.469073534f},
-std::array<float,2>{0.2770046f, 0.956152618f},
-std::array<float,2>{0.751600266f, 0.0209634639f},
-std::array<float,2>{0.888448298f, 0.775034904f},
-std::array<float,2>{0.490170211f, 0.200376734f},
-std::array<float,2>{0.0280147344f, 0.710647881f},
-std::array<float,2>{0.65609473f, 0.268307358f},
-std::array<float,2>{0.559113681f, 0.846846759f},
-std::array<float,2>{0.161522508f, 0.132753462f},
-std::array<float,2>{0.33121258f, 0.672790527f},
-std::array<float,2>{0.820523202f, 0.349976391f},
-std::array<float,2>{0.990365326f, 0.501497269f},
-std::array<float,2>{0.392359942f, 0.377114862f},
-std::array<float,2>{0.0720892623f, 0.914559722f},
-std::array<float,2>{0.717144012f, 0.102310456f},
-std::array<float,2>{0.660532236f, 0.724765599f},
-std::array<float,2>{0.0612157024f, 0.296297401f},
-std::array<float,2>{0.458073616f, 0.811515987f},
-std::array<float,2>{0.929183424f, 0.231923938f},
-std::array<float,2>{0.812223911f, 0.997178853f},
-std::array<float,2>{0.288044333f, 0.0322109796f},
-std::array<float,2>{0.189465985f, 0.608891249f},
-std::array<float,2>{0.602100968f, 0.448719919f},
-std::array<float,2>{0.706254244f, 0.81790936f},
-std::array<float,2>{0.0698840842f, 0.173312902f},
-std::array<float,2>{0.399654925f, 0.631966054f},
-std::array<float,2>{0.992878675f, 0.337813497f},
-std::array<float,2>{0.819950163f, 0.557986617f},
-std::array<float,2>{0.340209186f, 0.41392386f},
-std::array<float,2>{0.170942605f, 0.896361053f},
-std::array<float,2>{0.554124892f, 0.0892507136f},
-std::array<float,2>{0.599729717f, 0.716002762f},
-std::array<float,2>{0.195507213f, 0.27893889f},
-std::array<float,2>{0.295202702f, 0.770880282f},
-std::array<float,2>{0.801328003f, 0.187801585f},
-std::array<float,2>{0.934789538f, 0.962981343f},
-std::array<float,2>{0.461073905f, 0.0237181019f},
-std::array<float,2>{0.0516449399f, 0.576114416f},
-std::array<float,2>{0.668273211f, 0.476604998f},
-std::array<float,2>{0.504414916f, 0.910147667f},
-std::array<float,2>{0.12545976f, 0.100514084f},
-std::array<float,2>{0.360867798f, 0.514724731f},
-std::array<float,2>{0.873440206f, 0.388903409f},
-std::array<float,2>{0.939955711f, 0.680432141f},
-std::array<float,2>{0.420406997f, 0.355608523f},
-std::array<float,2>{0.0955648571f, 0.856555462f},
-std::array<float,2>{0.729173779f, 0.136929408f},
-std::array<float,2>{0.647050261f, 0.595133424f},
-std::array<float,2>{0.0201180074f, 0.438252628f},
-std::array<float,2>{0.494943708f, 0.988483071f},
-std::array<float,2>{0.880231798f, 0.0437384248f},
-std::array<float,2>{0.764143407f, 0.802336633f},
-std::array<float,2>{0.270955175f, 0.221615672f},
-std::array<float,2>{0.237423807f, 0.727693856f},
-std::array<float,2>{0.590426207f, 0.286263227f},
-std::array<float,2>{0.68544209f, 0.973999798f},
-std::array<float,2>{0.0453166403f, 0.0541064292f},
-std::array<float,2>{0.439380318f, 0.615682244f},
-std::array<float,2>{0.92081964f, 0.453942508f},
-std::array<float,2>{0.784298241f, 0.744028747f},
-std::array<float,2>{0.299996197f, 0.304132491f},
-std::array<float,2>{0.216801032f, 0.78899771f},
-std::array<float,2>{0.61351192f, 0.246073529f},
-std::array<float,2>{0.543545604f, 0.515665174f},
-std::array<float,2>{0.174449936f, 0.406191438f},
-std::array<float,2>{0.314762235f, 0.934961438f},
-std::array<float,2>{0.834446728f, 0.123888999f},
-std::array<float,2>{0.976993144f, 0.859699249f},
-std::array<float,2>{0.385477602f, 0.141740009f},
-std::array<float,2>{0.0883532166f, 0.668660462f},
-std::array<float,2>{0.690191269f, 0.361231714f},
-std::array<float,2>{0.57440871f, 0.760391057f},
-std::array<float,2>{0.233822316f, 0.211298779f},
-std::array<float,2>{0.255176336f, 0.701145053f},
-std::array<float,2>{0.771745443f, 0.259883195f},
-std::array<float,2>{0.898492515f, 0.583076477f},
-std::array<float,2>{0.473840088f, 0.493915439f},
-std::array<float,2>{0.00161308481f, 0.937930763f},
-std::array<float,2>{0.627662778f, 0.000914482574f},
-std::array<float,2>{0.748952866f, 0.652660668f},
-std::array<float,2>{0.11400532f, 0.313352257f},
-std::array<float,2>{0.430884987f, 0.840903461f},
-std::array<float,2>{0.959170997f, 0.161568165f},
-std::array<float,2>{0.846324027f, 0.877845347f},
-std::array<float,2>{0.359143764f, 0.0731244907f},
-std::array<float,2>{0.150662929f, 0.536262214f},
-std::array<float,2>{0.518356919f, 0.434248567f},
-std::array<float,2>{0.632089376f, 0.849379301f},
-std::array<float,2>{0.00640159054f, 0.126790136f},
-std::array<float,2>{0.471551508f, 0.677531421f},
-std::array<float,2>{0.903950274f, 0.347512364f},
-std::array<float,2>{0.766598165f, 0.504196107f},
-std::array<float,2>{0.253591478f, 0.379876614f},
-std::array<float,2>{0.230371669f, 0.919986069f},
-std::array<float,2>{0.572910368f, 0.106022678f},
-std::array<float,2>{0.520807207f, 0.721476197f},
-std::array<float,2>{0.153868183f, 0.291187853f},
-std::array<float,2>{0.35214752f, 0.806021035f},
-std::array<float,2>{0.850416422f, 0.227314949f},
-std::array<float,2>{0.956426263f, 0.995835543f},
-std::array<float,2>{0.435836077f, 0.0372338817f},
-std::array<float,2>{0.110188462f, 0.601652026f},
-std::array<float,2>{0.744517863f, 0.452303469f},
-std::array<float,2>{0.609624267f, 0.901926577f},
-std::array<float,2>{0.213014841f, 0.0810686946f},
-std::array<float,2>{0.30245015f, 0.551826775f},
-std::array<float,2>{0.7858935f, 0.414727032f},
-std::array<float,2>{0.914312899f, 0.638728082f},
-std::array<float,2>{0.443929344f, 0.335652351f},
-std::array<float,2>{0.0410349444f, 0.826141536f},
-std::array<float,2>{0.68242085f, 0.18361707f},
-std::array<float,2>{0.692503393f, 0.566007733f},
-std::array<float,2>{0.0899016708f, 0.475179523f},
-std::array<float,2>{0.387639552f, 0.958391011f},
-std::array<float,2>{0.983814657f, 0.016575126f},
-std::array<float,2>{0.829552054f, 0.778957903f},
-std::array<float,2>{0.318155915f, 0.19739145f},
-std::array<float,2>{0.177713394f, 0.705719769f},
-std::array<float,2>{0.539152861f, 0.271231681f},
-std::array<float,2>{0.730556011f, 0.94936794f},
-std::array<float,2>{0.0979487002f, 0.0123524899f},
-std::array<float,2>{0.415728182f, 0.590360403f},
-std::array<float,2>{0.943215132f, 0.486854404f},
-std::array<float,2>{0.867549777f, 0.690369904f},
-std::array<float,2>{0.36712876f, 0.252386153f},
-std::array<float,2>{0.132006958f, 0.75518328f},
-std::array<float,2>{0.500271499f, 0.207985818f},
-std::array<float,2>{0.587181866f, 0.543236911f},
-std::array<float,2>{0.240536496f, 0.422020167f},
-std::array<float,2>{0.266482264f, 0.886657238f},
-std::array<float,2>{0.761261761f, 0.0697852746f},
-std::array<float,2>{0.876950204f, 0.829239845f},
-std::array<float,2>{0.499411583f, 0.16788435f},
-std::array<float,2>{0.0189077184f, 0.643160164f},
-std::array<float,2>{0.644409239f, 0.324107111f},
-std::array<float,2>{0.547336638f, 0.796184719f},
-std::array<float,2>{0.164108917f, 0.238039672f},
-std::array<float,2>{0.337569028f, 0.735021234f},
-std::array<float,2>{0.813124299f, 0.309074789f},
-std::array<float,2>{0.99640739f, 0.619048953f},
-std::array<float,2>{0.402508944f, 0.461583018f},
-std::array<float,2>{0.0631976724f, 0.981795967f},
-std::array<float,2>{0.70706749f, 0.0572840683f},
-std::array<float,2>{0.664221108f, 0.656321645f},
-std::array<float,2>{0.0497134961f, 0.373018414f},
-std::array<float,2>{0.466893613f, 0.868791997f},
-std::array<float,2>{0.932277918f, 0.150883034f},
-std::array<float,2>{0.798739135f, 0.926316023f},
-std::array<float,2>{0.292144358f, 0.114594139f},
-std::array<float,2>{0.202961266f, 0.525636613f},
-std::array<float,2>{0.595223546f, 0.396867216f},
-std::array<float,2>{0.711436629f, 0.763770819f},
-std::array<float,2>{0.0761804357f, 0.217617244f},
-std::array<float,2>{0.395317972f, 0.697330177f},
-std::array<float,2>{0.985136867f, 0.265148222f},
-std::array<float,2>{0.825714052f, 0.578475237f},
-std::array<float,2>{0.334120303f, 0.496384531f},
-std::array<float,2>{0.159546271f, 0.944858193f},
-std::array<float,2>{0.557352901f, 0.00393271074f},
-std::array<float,2>{0.605847478f, 0.651214898f},
-std::array<float,2>{0.194804192f, 0.318695188f},
-std::array<float,2>{0.283004582f, 0.838171065f},
-std::array<float,2>{0.806951344f, 0.158536464f},
-std::array<float,2>{0.92324996f, 0.88083607f},
-std::array<float,2>{0.454458982f, 0.0774563327f},
-std::array<float,2>{0.0579162426f, 0.532572865f},
-std::array<float,2>{0.659219682f, 0.43129009f},
-std::array<float,2>{0.51206398f, 0.972430885f},
-std::array<float,2>{0.1385746f, 0.0504539236f},
-std::array<float,2>{0.367631048f, 0.613083184f},
-std::array<float,2>{0.86455214f, 0.459794372f},
-std::array<float,2>{0.946126759f, 0.748342931f},
-std::array<float,2>{0.407271832f, 0.298313141f},
-std::array<float,2>{0.101722352f, 0.783269227f},
-std::array<float,2>{0.7262519f, 0.249012426f},
-std::array<float,2>{0.651218474f, 0.522274137f},
-std::array<float,2>{0.0234590713f, 0.401282668f},
-std::array<float,2>{0.485945076f, 0.93174243f},
-std::array<float,2>{0.884665489f, 0.118022107f},
-std::array<float,2>{0.755030513f, 0.863679767f},
-std::array<float,2>{0.278035104f, 0.147763997f},
-std::array<float,2>{0.243096799f, 0.664409578f},
-std::array<float,2>{0.579241335f, 0.365970969f},
-std::array<float,2>{0.672247887f, 0.91086334f},
-std::array<float,2>{0.0361674204f, 0.0962720737f},
-std::array<float,2>{0.452371597f, 0.509331405f},
-std::array<float,2>{0.907215655f, 0.384742647f},
-std::array<float,2>{0.796827912f, 0.685905099f},
-std::array<float,2>{0.308319896f, 0.353659749f},
-std::array<float,2>{0.207016543f, 0.854008853f},
-std::array<float,2>{0.621153593f, 0.133589029f},
-std::array<float,2>{0.53184247f, 0.598077774f},
-std::array<float,2>{0.181294978f, 0.444038063f},
-std::array<float,2>{0.321563244f, 0.986576915f},
-std::array<float,2>{0.84150213f, 0.039316725f},
-std::array<float,2>{0.976258397f, 0.800197482f},
-std::array<float,2>{0.380833656f, 0.225559428f},
-std::array<float,2>{0.0806351006f, 0.73085314f},
-std::array<float,2>{0.697852433f, 0.284020036f},
-std::array<float,2>{0.566525817f, 0.815134406f},
-std::array<float,2>{0.225159422f, 0.179265514f},
-std::array<float,2>{0.264062494f, 0.627674341f},
-std::array<float,2>{0.781242669f, 0.342751026f},
-std::array<float,2>{0.896032155f, 0.560346186f},
-std::array<float,2>{0.479973555f, 0.407521665f},
-std::array<float,2>{0.0138268117f, 0.892636836f},
-std::array<float,2>{0.637468696f, 0.0917830244f},
-std::array<float,2>{0.73739779f, 0.714340866f},
-std::array<float,2>{0.119739957f, 0.275319159f},
-std::array<float,2>{0.427271575f, 0.76807797f},
-std::array<float,2>{0.965668082f, 0.192796573f},
-std::array<float,2>{0.852717698f, 0.967465222f},
-std::array<float,2>{0.34635061f, 0.0296859667f},
-std::array<float,2>{0.143596709f, 0.571742713f},
-std::array<float,2>{0.525146544f, 0.484050453f},
-std::array<float,2>{0.662148893f, 0.811641395f},
-std::array<float,2>{0.0591698401f, 0.230912521f},
-std::array<float,2>{0.460768878f, 0.726391017f},
-std::array<float,2>{0.926649272f, 0.295703262f},
-std::array<float,2>{0.810163617f, 0.607498169f},
-std::array<float,2>{0.287072897f, 0.44765088f},
-std::array<float,2>{0.18807888f, 0.996970654f},
-std::array<float,2>{0.605349541f, 0.0328080207f},
-std::array<float,2>{0.56130594f, 0.672999144f},
-std::array<float,2>{0.162267536f, 0.351224333f},
-std::array<float,2>{0.329841763f, 0.845959246f},
-std::array<float,2>{0.82375139f, 0.131205559f},
-std::array<float,2>{0.98879689f, 0.915417373f},
-std::array<float,2>{0.394081175f, 0.103022695f},
-std::array<float,2>{0.0727515817f, 0.500590503f},
-std::array<float,2>{0.714886665f, 0.378690064f},
-std::array<float,2>{0.585611999f, 0.955839157f},
-std::array<float,2>{0.249602437f, 0.0200075489f},
-std::array<float,2>{0.273989975f, 0.570141852f},
-std::array<float,2>{0.752320349f, 0.470478445f},
-std::array<float,2>{0.890096843f, 0.709874749f},
-std::array<float,2>{0.490923792f, 0.269485116f},
-std::array<float,2>{0.029322857f, 0.774330854f},
-std::array<float,2>{0.653984487f, 0.19972147f},
-std::array<float,2>{0.719235003f, 0.547793508f},
-std::array<float,2>{0.105596207f, 0.419067889f},
-std::array<float,2>{0.413273424f, 0.906242907f},
-std::array<float,2>{0.951013982f, 0.0829034224f},
-std::array<float,2>{0.859549582f, 0.822324634f},
-std::array<float,2>{0.374489248f, 0.182793051f},
-std::array<float,2>{0.133958861f, 0.635114968f},
-std::array<float,2>{0.510570943f, 0.331598848f},
-std::array<float,2>{0.701069534f, 0.8867625f},
-std::array<float,2>{0.0839864761f, 0.0660173446f},
-std::array<float,2>{0.376190394f, 0.54295069f},
-std::array<float,2>{0.969601154f, 0.427760154f},
-std::array<float,2>{0.838737667f, 0.645859063f},
-std::array<float,2>{0.326606631f, 0.325489998f},
-std::array<float,2>{0.187201142f, 0.834305525f},
-std::array<float,2>{0.538378835f, 0.170163959f},
-std::array<float,2>{0.617642522f, 0.588408291f},
-std::array<float,2>{0.210353404f, 0.488388807f},
-std::array<float,2>{0.308760017f, 0.946760952f},
-std::array<float,2>{0.78998816f, 0.00957500655f},
-std::array<float,2>{0.91046387f, 0.751043737f},
-std::array<float,2>{0.448956937f, 0.203800112f},
-std::array<float,2>{0.0342022516f, 0.692251503f},
-std::array<float,2>{0.677272379f, 0.255555868f},
-std::array<float,2>{0.530859947f, 0.871902883f},
-std::array<float,2>{0.146259919f, 0.155593216f},
-std::array<float,2>{0.350721329f, 0.660220444f},
-std::array<float,2>{0.856850266f, 0.367412031f},
-std::array<float,2>{0.962084472f, 0.528596938f},
-std::array<float,2>{0.424470186f, 0.393711179f},
-std::array<float,2>{0.124806195f, 0.92479068f},
-std::array<float,2>{0.740468264f, 0.110305622f},
-std::array<float,2>{0.633130014f, 0.740968347f},
-std::array<float,2>{0.00977225602f, 0.306732714f},
-std::array<float,2>{0.481705576f, 0.791862011f},
-std::array<float,2>{0.892210126f, 0.241533697f},
-std::array<float,2>{0.775689244f, 0.97986716f},
-std::array<float,2>{0.26040411f, 0.0620546639f},
-std::array<float,2>{0.221232414f, 0.624943852f},
-std::array<float,2>{0.564466298f, 0.466613293f},
-std::array<float,2>{0.746747911f, 0.8406353f},
-std::array<float,2>{0.115585953f, 0.160188943f},
-std::array<float,2>{0.431968719f, 0.653859317f},
-std::array<float,2>{0.957680881f, 0.313913107f},
-std::array<float,2>{0.844502687f, 0.535263658f},
-std::array<float,2>{0.355900764f, 0.43519038f},
-std::array<float,2>{0.150365815f, 0.878483772f},
-std::array<float,2>{0.517525733f, 0.0734309033f},
-std::array<float,2>{0.577358246f, 0.700117946f},
-std::array<float,2>{0.231685534f, 0.260823011f},
-std::array<float,2>{0.257775843f, 0.761508822f},
-std::array<float,2>{0.770995617f, 0.211971283f},
-std::array<float,2>{0.900480568f, 0.93925631f},
-std::array<float,2>{0.475015968f, 0.00124276767f},
-std::array<float,2>{0.00352251949f, 0.582418382f},
-std::array<float,2>{0.625872433f, 0.492564142f},
-std::array<float,2>{0.544962645f, 0.933814347f},
-std::array<float,2>{0.172008157f, 0.124557167f},
-std::array<float,2>{0.313016117f, 0.517470539f},
-std::array<float,2>{0.833049953f, 0.404631764f},
-std::array<float,2>{0.979401827f, 0.669137537f},
-std::array<float,2>{0.384595692f, 0.360330403f},
-std::array<float,2>{0.0871224329f, 0.861244857f},
-std::array<float,2>{0.689421058f, 0.140779108f},
-std::array<float,2>{0.686261833f, 0.616937101f},
-std::array<float,2>{0.0444744043f, 0.454879344f},
-std::array<float,2>{0.440369904f, 0.973053753f},
-std::array<float,2>{0.918210387f, 0.053167332f},
-std::array<float,2>{0.782475114f, 0.787868619f},
-std::array<float,2>{0.298209608f, 0.2447837f},
-std::array<float,2>{0.21543844f, 0.742395759f},
-std::array<float,2>{0.616178036f, 0.303601831f},
-std::array<float,2>{0.645877898f, 0.989584863f},
-std::array<float,2>{0.0226794779f, 0.0439602099f},
-std::array<float,2>{0.492535025f, 0.594437838f},
-std::array<float,2>{0.882285297f, 0.438975573f},
-std::array<float,2>{0.763088644f, 0.726960838f},
-std::array<float,2>{0.272158802f, 0.285256267f},
-std::array<float,2>{0.235239282f, 0.801253736f},
-std::array<float,2>{0.592457891f, 0.22187826f},
-std::array<float,2>{0.506250262f, 0.514012754f},
-std::array<float,2>{0.128456399f, 0.390488535f},
-std::array<float,2>{0.361475706f, 0.90823561f},
-std::array<float,2>{0.871807039f, 0.101021081f},
-std::array<float,2>{0.938393235f, 0.855916202f},
-std::array<float,2>{0.418338805f, 0.137744516f},
-std::array<float,2>{0.0960723311f, 0.681334376f},
-std::array<float,2>{0.728227556f, 0.357087553f},
-std::array<float,2>{0.59838587f, 0.769658208f},
-std::array<float,2>{0.197342619f, 0.188678443f},
-std::array<float,2>{0.294147164f, 0.71523416f},
-std::array<float,2>{0.803509653f, 0.277582645f},
-std::array<float,2>{0.935858488f, 0.574686229f},
-std::array<float,2>{0.463271379f, 0.47774303f},
-std::array<float,2>{0.0540924594f, 0.964207351f},
-std::array<float,2>{0.67176795f, 0.0252822116f},
-std::array<float,2>{0.70399034f, 0.63172245f},
-std::array<float,2>{0.0669568926f, 0.336001068f},
-std::array<float,2>{0.402316481f, 0.817323029f},
-std::array<float,2>{0.995885074f, 0.172611013f},
-std::array<float,2>{0.817049682f, 0.894862115f},
-std::array<float,2>{0.342391342f, 0.088003628f},
-std::array<float,2>{0.16898784f, 0.557044268f},
-std::array<float,2>{0.552573502f, 0.412606448f},
-std::array<float,2>{0.681180418f, 0.827797592f},
-std::array<float,2>{0.0393154398f, 0.187038362f},
-std::array<float,2>{0.442528635f, 0.636962354f},
-std::array<float,2>{0.916215599f, 0.333398849f},
-std::array<float,2>{0.787290096f, 0.554168582f},
-std::array<float,2>{0.304011315f, 0.417056143f},
-std::array<float,2>{0.212084338f, 0.899235129f},
-std::array<float,2>{0.611451566f, 0.0799431279f},
-std::array<float,2>{0.542300165f, 0.703400075f},
-std::array<float,2>{0.179609939f, 0.272674829f},
-std::array<float,2>{0.31850031f, 0.779475212f},
-std::array<float,2>{0.830366373f, 0.195746854f},
-std::array<float,2>{0.980871618f, 0.960662425f},
-std::array<float,2>{0.388924807f, 0.0186901055f},
-std::array<float,2>{0.0931112096f, 0.564328313f},
-std::array<float,2>{0.693904519f, 0.473386735f},
-std::array<float,2>{0.570411682f, 0.918773234f},
-std::array<float,2>{0.228501946f, 0.108570077f},
-std::array<float,2>{0.251527846f, 0.506634831f},
-std::array<float,2>{0.767995656f, 0.381245404f},
-std::array<float,2>{0.905832171f, 0.678393662f},
-std::array<float,2>{0.470254958f, 0.34503898f},
-std::array<float,2>{0.00407011248f, 0.850632608f},
-std::array<float,2>{0.629737616f, 0.127564207f},
-std::array<float,2>{0.742633939f, 0.603840113f},
-std::array<float,2>{0.113082491f, 0.450299978f},
-std::array<float,2>{0.434501141f, 0.993973255f},
-std::array<float,2>{0.953336895f, 0.0358712971f},
-std::array<float,2>{0.849475563f, 0.807802498f},
-std::array<float,2>{0.354587525f, 0.228894249f},
-std::array<float,2>{0.155547619f, 0.720548511f},
-std::array<float,2>{0.522594631f, 0.289488435f},
-std::array<float,2>{0.710472107f, 0.984250426f},
-std::array<float,2>{0.065231435f, 0.0560533404f},
-std::array<float,2>{0.405229509f, 0.619396389f},
-std::array<float,2>{0.998666525f, 0.464570791f},
-std::array<float,2>{0.815340102f, 0.737639368f},
-std::array<float,2>{0.338188469f, 0.311640322f},
-std::array<float,2>{0.167955235f, 0.794120967f},
-std::array<float,2>{0.549492419f, 0.235663861f},
-std::array<float,2>{0.596474886f, 0.524304867f},
-std::array<float,2>{0.199295938f, 0.395064116f},
-std::array<float,2>{0.291005731f, 0.928121388f},
-std::array<float,2>{0.799248219f, 0.116116248f},
-std::array<float,2>{0.930279374f, 0.869633496f},
-std::array<float,2>{0.466449976f, 0.150075167f},
-std::array<float,2>{0.0476958528f, 0.659329057f},
-std::array<float,2>{0.666707873f, 0.373134613f},
-std::array<float,2>{0.502944708f, 0.755878448f},
-std::array<float,2>{0.129675508f, 0.209870026f},
-std::array<float,2>{0.364466995f, 0.688973367f},
-std::array<float,2>{0.86947298f, 0.25012514f},
-std::array<float,2>{0.944113016f, 0.593740463f},
-std::array<float,2>{0.416677833f, 0.485186517f},
-std::array<float,2>{0.0997258499f, 0.952362657f},
-std::array<float,2>{0.732664764f, 0.0152377263f},
-std::array<float,2>{0.642109752f, 0.642387688f},
-std::array<float,2>{0.0167043302f, 0.32095024f},
-std::array<float,2>{0.497384965f, 0.831226885f},
-std::array<float,2>{0.877852499f, 0.165724218f},
-std::array<float,2>{0.758873403f, 0.883260429f},
-std::array<float,2>{0.269421846f, 0.0674286485f},
-std::array<float,2>{0.240212485f, 0.545214653f},
-std::array<float,2>{0.589233041f, 0.425056815f},
-std::array<float,2>{0.724154592f, 0.782220125f},
-std::array<float,2>{0.103625506f, 0.247958273f},
-std::array<float,2>{0.409619033f, 0.747595787f},
-std::array<float,2>{0.948518991f, 0.299330384f},
-std::array<float,2>{0.866194844f, 0.610098243f},
-std::array<float,2>{0.370876491f, 0.458851129f},
-std::array<float,2>{0.139319077f, 0.96919471f},
-std::array<float,2>{0.514950693f, 0.0487059206f},
-std::array<float,2>{0.580346584f, 0.666184962f},
-std::array<float,2>{0.245300636f, 0.363959163f},
-std::array<float,2>{0.280739307f, 0.866882443f},
-std::array<float,2>{0.757721126f, 0.145377457f},
-std::array<float,2>{0.885821402f, 0.93092525f},
-std::array<float,2>{0.486595631f, 0.119391263f},
-std::array<float,2>{0.0263374429f, 0.520291746f},
-std::array<float,2>{0.649325669f, 0.400135368f},
-std::array<float,2>{0.555283189f, 0.942632556f},
-std::array<float,2>{0.15673466f, 0.00635564094f},
-std::array<float,2>{0.33230266f, 0.581308007f},
-std::array<float,2>{0.827218175f, 0.498158157f},
-std::array<float,2>{0.987706184f, 0.696134567f},
-std::array<float,2>{0.398115516f, 0.263187259f},
-std::array<float,2>{0.0745880008f, 0.762603045f},
-std::array<float,2>{0.71290344f, 0.215173438f},
-std::array<float,2>{0.657466769f, 0.53487128f},
-std::array<float,2>{0.0550936423f, 0.433400363f},
-std::array<float,2>{0.455160528f, 0.881670892f},
-std::array<float,2>{0.924810827f, 0.0744900033f},
-std::array<float,2>{0.804827273f, 0.836034477f},
-std::array<float,2>{0.283558458f, 0.156267881f},
-std::array<float,2>{0.193065137f, 0.64996469f},
-std::array<float,2>{0.60894227f, 0.31799072f},
-std::array<float,2>{0.640420079f, 0.892231405f},
-std::array<float,2>{0.0124575077f, 0.0929509997f},
-std::array<float,2>{0.478257596f, 0.560783386f},
-std::array<float,2>{0.897659898f, 0.408538729f},
-std::array<float,2>{0.779215455f, 0.626002252f},
-std::array<float,2>{0.262511671f, 0.341638207f},
-std::array<float,2>{0.222900733f, 0.813508928f},
-std::array<float,2>{0.568609595f, 0.176979601f},
-std::array<float,2>{0.526029885f, 0.572701752f},
-std::array<float,2>{0.142235592f, 0.481192887f},
-std::array<float,2>{0.344066828f, 0.965320766f},
-std::array<float,2>{0.854202926f, 0.0276799854f},
-std::array<float,2>{0.96766901f, 0.76614809f},
-std::array<float,2>{0.428219676f, 0.195109487f},
-std::array<float,2>{0.118389018f, 0.712029219f},
-std::array<float,2>{0.734575212f, 0.2770558f},
-std::array<float,2>{0.623220742f, 0.852209449f},
-std::array<float,2>{0.203661636f, 0.136473879f},
-std::array<float,2>{0.304802626f, 0.684345961f},
-std::array<float,2>{0.793140233f, 0.352501333f},
-std::array<float,2>{0.909365594f, 0.511303127f},
-std::array<float,2>{0.449871182f, 0.384907156f},
-std::array<float,2>{0.0372812189f, 0.912908971f},
-std::array<float,2>{0.67411375f, 0.0945913196f},
-std::array<float,2>{0.696390092f, 0.733423531f},
-std::array<float,2>{0.0799820125f, 0.282441646f},
-std::array<float,2>{0.381323576f, 0.796917319f},
-std::array<float,2>{0.972749829f, 0.223177165f},
-std::array<float,2>{0.84257251f, 0.985151291f},
-std::array<float,2>{0.323792666f, 0.0413298495f},
-std::array<float,2>{0.183272913f, 0.600133538f},
-std::array<float,2>{0.533341527f, 0.443305254f},
-std::array<float,2>{0.654660583f, 0.775803149f},
-std::array<float,2>{0.0292471405f, 0.202788234f},
-std::array<float,2>{0.489196271f, 0.707900643f},
-std::array<float,2>{0.887426138f, 0.266977549f},
-std::array<float,2>{0.750645757f, 0.56707108f},
-std::array<float,2>{0.275896698f, 0.472568959f},
-std::array<float,2>{0.246506274f, 0.954995453f},
-std::array<float,2>{0.582900941f, 0.0226599369f},
-std::array<float,2>{0.508473694f, 0.634348154f},
-std::array<float,2>{0.136547178f, 0.329629123f},
-std::array<float,2>{0.372321934f, 0.821171045f},
-std::array<float,2>{0.862641215f, 0.180620924f},
-std::array<float,2>{0.951877773f, 0.902895331f},
-std::array<float,2>{0.41165638f, 0.0848790035f},
-std::array<float,2>{0.107560739f, 0.549431264f},
-std::array<float,2>{0.720912278f, 0.421866238f},
-std::array<float,2>{0.603327692f, 0.999095678f},
-std::array<float,2>{0.190712333f, 0.0348185748f},
-std::array<float,2>{0.288954318f, 0.607329726f},
-std::array<float,2>{0.81116432f, 0.445809454f},
-std::array<float,2>{0.927891612f, 0.724291921f},
-std::array<float,2>{0.457836986f, 0.294698685f},
-std::array<float,2>{0.0617258772f, 0.809280097f},
-std::array<float,2>{0.661581397f, 0.233530849f},
-std::array<float,2>{0.718413651f, 0.502075016f},
-std::array<float,2>{0.0711129531f, 0.376718968f},
-std::array<float,2>{0.391068161f, 0.91695869f},
-std::array<float,2>{0.991720796f, 0.105200134f},
-std::array<float,2>{0.821556211f, 0.845561266f},
-std::array<float,2>{0.330500066f, 0.12922886f},
-std::array<float,2>{0.160874113f, 0.674333513f},
-std::array<float,2>{0.560187876f, 0.348813295f},
-std::array<float,2>{0.740190804f, 0.923464f},
-std::array<float,2>{0.122930676f, 0.112372085f},
-std::array<float,2>{0.422520429f, 0.531097233f},
-std::array<float,2>{0.963623345f, 0.391622484f},
-std::array<float,2>{0.857676566f, 0.662671149f},
-std::array<float,2>{0.348186553f, 0.370070219f},
-std::array<float,2>{0.147292852f, 0.873178542f},
-std::array<float,2>{0.527710676f, 0.15249826f},
-std::array<float,2>{0.564079404f, 0.621893227f},
-std::array<float,2>{0.220199883f, 0.467407495f},
-std::array<float,2>{0.259144425f, 0.978023887f},
-std::array<float,2>{0.773540795f, 0.0586174801f},
-std::array<float,2>{0.893749118f, 0.790384948f},
-std::array<float,2>{0.483863235f, 0.239498958f},
-std::array<float,2>{0.00818112399f, 0.73981595f},
-std::array<float,2>{0.634920597f, 0.305129111f},
-std::array<float,2>{0.535716772f, 0.833747387f},
-std::array<float,2>{0.185359165f, 0.169841573f},
-std::array<float,2>{0.325403154f, 0.646982908f},
-std::array<float,2>{0.836908937f, 0.327606767f},
-std::array<float,2>{0.971542358f, 0.540513575f},
-std::array<float,2>{0.377230823f, 0.427609831f},
-std::array<float,2>{0.082186617f, 0.888913095f},
-std::array<float,2>{0.702502906f, 0.0642661601f},
-std::array<float,2>{0.677939832f, 0.693706036f},
-std::array<float,2>{0.032661289f, 0.257432789f},
-std::array<float,2>{0.445501f, 0.75312525f},
-std::array<float,2>{0.912472248f, 0.206672236f},
-std::array<float,2>{0.791805565f, 0.947765768f},
-std::array<float,2>{0.311767459f, 0.0104229245f},
-std::array<float,2>{0.207349598f, 0.587769747f},
-std::array<float,2>{0.619628191f, 0.491620153f},
-std::array<float,2>{0.690909386f, 0.862991929f},
-std::array<float,2>{0.0889922753f, 0.143727303f},
-std::array<float,2>{0.386509955f, 0.671227515f},
-std::array<float,2>{0.977699339f, 0.362502992f},
-std::array<float,2>{0.835287392f, 0.519074857f},
-std::array<float,2>{0.315974563f, 0.403524667f},
-std::array<float,2>{0.175115496f, 0.937486291f},
-std::array<float,2>{0.544489503f, 0.121449873f},
-std::array<float,2>{0.614668727f, 0.745475948f},
-std::array<float,2>{0.218156725f, 0.302605629f},
-std::array<float,2>{0.298879176f, 0.785308957f},
-std::array<float,2>{0.783899784f, 0.243438855f},
-std::array<float,2>{0.921226621f, 0.976451755f},
-std::array<float,2>{0.438374519f, 0.0519521683f},
-std::array<float,2>{0.046269916f, 0.613974035f},
-std::array<float,2>{0.683958828f, 0.455624253f},
-std::array<float,2>{0.518799961f, 0.875229239f},
-std::array<float,2>{0.152172208f, 0.0709482953f},
-std::array<float,2>{0.357570469f, 0.537299037f},
-std::array<float,2>{0.847330034f, 0.437286288f},
-std::array<float,2>{0.960399747f, 0.655273974f},
-std::array<float,2>{0.429843843f, 0.315388232f},
-std::array<float,2>{0.11463929f, 0.842544138f},
-std::array<float,2>{0.749302566f, 0.162140742f},
-std::array<float,2>{0.628298521f, 0.585187554f},
-std::array<float,2>{0.000247954857f, 0.496091038f},
-std::array<float,2>{0.472966701f, 0.940759122f},
-std::array<float,2>{0.900343478f, 0.00339951785f},
-std::array<float,2>{0.77312839f, 0.758917928f},
-std::array<float,2>{0.254644722f, 0.214242205f},
-std::array<float,2>{0.23267667f, 0.702473164f},
-std::array<float,2>{0.575823545f, 0.25829044f},
-std::array<float,2>{0.669003785f, 0.962742031f},
-std::array<float,2>{0.0521057844f, 0.0264389217f},
-std::array<float,2>{0.46261251f, 0.577519596f},
-std::array<float,2>{0.933725297f, 0.478915602f},
-std::array<float,2>{0.802186847f, 0.718532562f},
-std::array<float,2>{0.296664536f, 0.280327439f},
-std::array<float,2>{0.196894974f, 0.773030341f},
-std::array<float,2>{0.601483405f, 0.190233618f},
-std::array<float,2>{0.553058684f, 0.556483746f},
-std::array<float,2>{0.170554563f, 0.410327435f},
-std::array<float,2>{0.341780603f, 0.898287356f},
-std::array<float,2>{0.819229841f, 0.0867878944f},
-std::array<float,2>{0.993356347f, 0.819317639f},
-std::array<float,2>{0.399282098f, 0.173979342f},
-std::array<float,2>{0.0690527409f, 0.629177332f},
-std::array<float,2>{0.705811977f, 0.337989271f},
-std::array<float,2>{0.591511726f, 0.804562628f},
-std::array<float,2>{0.237228796f, 0.219950378f},
-std::array<float,2>{0.270085633f, 0.729712069f},
-std::array<float,2>{0.765535355f, 0.28780514f},
-std::array<float,2>{0.879656732f, 0.595952392f},
-std::array<float,2>{0.495934218f, 0.44023633f},
-std::array<float,2>{0.0214644819f, 0.990276098f},
-std::array<float,2>{0.647794247f, 0.0467898436f},
-std::array<float,2>{0.730373919f, 0.681798875f},
-std::array<float,2>{0.094143711f, 0.358264834f},
-std::array<float,2>{0.421626955f, 0.858258665f},
-std::array<float,2>{0.940593004f, 0.140093923f},
-std::array<float,2>{0.874200165f, 0.908056021f},
-std::array<float,2>{0.360299587f, 0.098036468f},
-std::array<float,2>{0.126671702f, 0.5130229f},
-std::array<float,2>{0.505648017f, 0.388228774f},
-std::array<float,2>{0.636959076f, 0.814035594f},
-std::array<float,2>{0.0145821599f, 0.177581877f},
-std::array<float,2>{0.480246693f, 0.626684785f},
-std::array<float,2>{0.895933449f, 0.341137797f},
-std::array<float,2>{0.780328512f, 0.561280787f},
-std::array<float,2>{0.264225215f, 0.408848375f},
-std::array<float,2>{0.224921077f, 0.891649961f},
-std::array<float,2>{0.567120373f, 0.0934876427f},
-std::array<float,2>{0.524709821f, 0.712496281f},
-std::array<float,2>{0.144433662f, 0.276806056f},
-std::array<float,2>{0.345901638f, 0.76591289f},
-std::array<float,2>{0.853335023f, 0.194785848f},
-std::array<float,2>{0.964880764f, 0.965818822f},
-std::array<float,2>{0.427175403f, 0.0279801264f},
-std::array<float,2>{0.119620129f, 0.572783887f},
-std::array<float,2>{0.738128245f, 0.480952352f},
-std::array<float,2>{0.621628821f, 0.912341177f},
-std::array<float,2>{0.206469581f, 0.0939783007f},
-std::array<float,2>{0.307843119f, 0.510842979f},
-std::array<float,2>{0.796283007f, 0.385305047f},
-std::array<float,2>{0.906630695f, 0.683720767f},
-std::array<float,2>{0.452990025f, 0.351710558f},
-std::array<float,2>{0.0367112942f, 0.851774454f},
-std::array<float,2>{0.672420144f, 0.136123329f},
-std::array<float,2>{0.697434545f, 0.59965694f},
-std::array<float,2>{0.0804296806f, 0.442519635f},
-std::array<float,2>{0.380180031f, 0.984440923f},
-std::array<float,2>{0.97590071f, 0.0416994244f},
-std::array<float,2>{0.841212034f, 0.797652304f},
-std::array<float,2>{0.322252184f, 0.222924739f},
-std::array<float,2>{0.181085214f, 0.733886898f},
-std::array<float,2>{0.531638086f, 0.283054143f},
-std::array<float,2>{0.725696146f, 0.96941781f},
-std::array<float,2>{0.102301799f, 0.0483075418f},
-std::array<float,2>{0.407766968f, 0.609658182f},
-std::array<float,2>{0.945626915f, 0.458357513f},
-std::array<float,2>{0.864876926f, 0.747396827f},
-std::array<float,2>{0.367822737f, 0.298871011f},
-std::array<float,2>{0.137783304f, 0.781682968f},
-std::array<float,2>{0.512336433f, 0.24750407f},
-std::array<float,2>{0.579710305f, 0.519776404f},
-std::array<float,2>{0.242192477f, 0.399452627f},
-std::array<float,2>{0.277490139f, 0.931501567f},
-std::array<float,2>{0.755725622f, 0.120109893f},
-std::array<float,2>{0.884271502f, 0.866625726f},
-std::array<float,2>{0.485421777f, 0.144677192f},
-std::array<float,2>{0.0243493468f, 0.66680181f},
-std::array<float,2>{0.650798678f, 0.363507867f},
-std::array<float,2>{0.556918859f, 0.762143373f},
-std::array<float,2>{0.159871086f, 0.215793371f},
-std::array<float,2>{0.334478617f, 0.695570707f},
-std::array<float,2>{0.825654268f, 0.263101697f},
-std::array<float,2>{0.984491706f, 0.581765175f},
-std::array<float,2>{0.394682556f, 0.499019474f},
-std::array<float,2>{0.0770643502f, 0.943058848f},
-std::array<float,2>{0.710997581f, 0.0058665676f},
-std::array<float,2>{0.660045981f, 0.649728239f},
-std::array<float,2>{0.058446534f, 0.317470104f},
-std::array<float,2>{0.45498839f, 0.836655438f},
-std::array<float,2>{0.923420072f, 0.156772614f},
-std::array<float,2>{0.807322145f, 0.880996764f},
-std::array<float,2>{0.282252043f, 0.0748631358f},
-std::array<float,2>{0.195161045f, 0.534478724f},
-std::array<float,2>{0.606228352f, 0.432928443f},
-std::array<float,2>{0.707632244f, 0.794732094f},
-std::array<float,2>{0.0626198277f, 0.236107305f},
-std::array<float,2>{0.40328294f, 0.737964153f},
-std::array<float,2>{0.997003198f, 0.312203288f},
-std::array<float,2>{0.812631369f, 0.619659722f},
-std::array<float,2>{0.336981893f, 0.464173347f},
-std::array<float,2>{0.164608613f, 0.983772933f},
-std::array<float,2>{0.547767341f, 0.0564959086f},
-std::array<float,2>{0.595099628f, 0.659912646f},
-std::array<float,2>{0.202561617f, 0.37390542f},
-std::array<float,2>{0.292609721f, 0.869346499f},
-std::array<float,2>{0.797857642f, 0.149753809f},
-std::array<float,2>{0.932027936f, 0.928375363f},
-std::array<float,2>{0.467609614f, 0.115683354f},
-std::array<float,2>{0.0490476079f, 0.523813725f},
-std::array<float,2>{0.665016949f, 0.394983143f},
-std::array<float,2>{0.500794947f, 0.952733517f},
-std::array<float,2>{0.132509783f, 0.0148340706f},
-std::array<float,2>{0.366342336f, 0.592963457f},
-std::array<float,2>{0.868072271f, 0.484427512f},
-std::array<float,2>{0.942702591f, 0.688544393f},
-std::array<float,2>{0.415134847f, 0.250848383f},
-std::array<float,2>{0.0985375419f, 0.756660223f},
-std::array<float,2>{0.731219828f, 0.209345177f},
-std::array<float,2>{0.643863797f, 0.545577765f},
-std::array<float,2>{0.0194889884f, 0.425735533f},
-std::array<float,2>{0.499789298f, 0.883382916f},
-std::array<float,2>{0.876090467f, 0.0681048259f},
-std::array<float,2>{0.761074841f, 0.831899107f},
-std::array<float,2>{0.266094476f, 0.165418729f},
-std::array<float,2>{0.240798801f, 0.641661525f},
-std::array<float,2>{0.587754965f, 0.320401162f},
-std::array<float,2>{0.681664526f, 0.898907125f},
-std::array<float,2>{0.0417067111f, 0.0791103318f},
-std::array<float,2>{0.443674505f, 0.554602206f},
-std::array<float,2>{0.914691925f, 0.417619556f},
-std::array<float,2>{0.785284102f, 0.637321889f},
-std::array<float,2>{0.301884711f, 0.333941311f},
-std::array<float,2>{0.213786691f, 0.827162445f},
-std::array<float,2>{0.610249877f, 0.186727926f},
-std::array<float,2>{0.539841175f, 0.563557923f},
-std::array<float,2>{0.176913604f, 0.472736895f},
-std::array<float,2>{0.317460239f, 0.960303247f},
-std::array<float,2>{0.829710901f, 0.0193767752f},
-std::array<float,2>{0.984155357f, 0.780027092f},
-std::array<float,2>{0.387090892f, 0.195894942f},
-std::array<float,2>{0.09069594f, 0.703692675f},
-std::array<float,2>{0.692916274f, 0.273162186f},
-std::array<float,2>{0.572507024f, 0.851146281f},
-std::array<float,2>{0.229789674f, 0.127307475f},
-std::array<float,2>{0.253272921f, 0.677974522f},
-std::array<float,2>{0.765922606f, 0.345591694f},
-std::array<float,2>{0.903618813f, 0.50605005f},
-std::array<float,2>{0.470856696f, 0.381479144f},
-std::array<float,2>{0.0060050427f, 0.91814357f},
-std::array<float,2>{0.632740557f, 0.108958721f},
-std::array<float,2>{0.744867325f, 0.720175147f},
-std::array<float,2>{0.10972397f, 0.289959908f},
-std::array<float,2>{0.436368197f, 0.808514774f},
-std::array<float,2>{0.956715465f, 0.229468703f},
-std::array<float,2>{0.849808097f, 0.993263483f},
-std::array<float,2>{0.351953059f, 0.0353687927f},
-std::array<float,2>{0.153365806f, 0.604263425f},
-std::array<float,2>{0.521262348f, 0.450991899f},
-std::array<float,2>{0.671212018f, 0.772733986f},
-std::array<float,2>{0.054417517f, 0.189511523f},
-std::array<float,2>{0.46344772f, 0.717798412f},
-std::array<float,2>{0.936132967f, 0.281100512f},
-std::array<float,2>{0.803192019f, 0.578040898f},
-std::array<float,2>{0.294920802f, 0.479406625f},
-std::array<float,2>{0.197987065f, 0.962400556f},
-std::array<float,2>{0.597795367f, 0.026962325f},
-std::array<float,2>{0.551885426f, 0.629746437f},
-std::array<float,2>{0.169512808f, 0.338578612f},
-std::array<float,2>{0.342007816f, 0.818788707f},
-std::array<float,2>{0.816764772f, 0.174569592f},
-std::array<float,2>{0.995375872f, 0.897620916f},
-std::array<float,2>{0.401800007f, 0.0860425755f},
-std::array<float,2>{0.0667252839f, 0.555789828f},
-std::array<float,2>{0.703175068f, 0.411037058f},
-std::array<float,2>{0.59205997f, 0.991148055f},
-std::array<float,2>{0.234642446f, 0.0463063382f},
-std::array<float,2>{0.271865666f, 0.59647131f},
-std::array<float,2>{0.763316095f, 0.439883739f},
-std::array<float,2>{0.88268739f, 0.730272174f},
-std::array<float,2>{0.492759615f, 0.287312716f},
-std::array<float,2>{0.0232115295f, 0.803749323f},
-std::array<float,2>{0.646125555f, 0.220335573f},
-std::array<float,2>{0.727593362f, 0.513575733f},
-std::array<float,2>{0.0963696465f, 0.387793839f},
-std::array<float,2>{0.418879718f, 0.907446682f},
-std::array<float,2>{0.937943041f, 0.098607704f},
-std::array<float,2>{0.871225357f, 0.857698619f},
-std::array<float,2>{0.361855865f, 0.140311599f},
-std::array<float,2>{0.128109261f, 0.682616651f},
-std::array<float,2>{0.506397128f, 0.357575834f},
-std::array<float,2>{0.688724101f, 0.936845899f},
-std::array<float,2>{0.0878663659f, 0.12165384f},
-std::array<float,2>{0.384111255f, 0.518863261f},
-std::array<float,2>{0.978793263f, 0.404240787f},
-std::array<float,2>{0.833499968f, 0.671852767f},
-std::array<float,2>{0.312964231f, 0.362808824f},
-std::array<float,2>{0.172574326f, 0.8624084f},
-std::array<float,2>{0.545607507f, 0.144238293f},
-std::array<float,2>{0.615565538f, 0.613661826f},
-std::array<float,2>{0.214867115f, 0.455250114f},
-std::array<float,2>{0.298671305f, 0.975703657f},
-std::array<float,2>{0.782922208f, 0.052456338f},
-std::array<float,2>{0.918747723f, 0.785820901f},
-std::array<float,2>{0.43952927f, 0.244077176f},
-std::array<float,2>{0.0441867262f, 0.745989084f},
-std::array<float,2>{0.685966551f, 0.302071005f},
-std::array<float,2>{0.516616702f, 0.841989815f},
-std::array<float,2>{0.149781972f, 0.162682638f},
-std::array<float,2>{0.356329918f, 0.656114459f},
-std::array<float,2>{0.844036877f, 0.314766854f},
-std::array<float,2>{0.957423925f, 0.537915885f},
-std::array<float,2>{0.432497144f, 0.436876953f},
-std::array<float,2>{0.115725838f, 0.875568807f},
-std::array<float,2>{0.746501923f, 0.0704043359f},
-std::array<float,2>{0.625421405f, 0.702640712f},
-std::array<float,2>{0.00314694853f, 0.258555472f},
-std::array<float,2>{0.475172222f, 0.759382963f},
-std::array<float,2>{0.901168466f, 0.214477196f},
-std::array<float,2>{0.771377206f, 0.94128722f},
-std::array<float,2>{0.256907105f, 0.00359561597f},
-std::array<float,2>{0.232153356f, 0.585714281f},
-std::array<float,2>{0.578112006f, 0.495589286f},
-std::array<float,2>{0.740914285f, 0.873549402f},
-std::array<float,2>{0.124478236f, 0.153008997f},
-std::array<float,2>{0.424102515f, 0.662517011f},
-std::array<float,2>{0.962532282f, 0.369451106f},
-std::array<float,2>{0.857169986f, 0.530499339f},
-std::array<float,2>{0.351270497f, 0.392109543f},
-std::array<float,2>{0.145567864f, 0.923079491f},
-std::array<float,2>{0.530673087f, 0.11307124f},
-std::array<float,2>{0.564962864f, 0.739723384f},
-std::array<float,2>{0.221058518f, 0.305593878f},
-std::array<float,2>{0.260148495f, 0.790737748f},
-std::array<float,2>{0.775976539f, 0.239848316f},
-std::array<float,2>{0.89182663f, 0.97807318f},
-std::array<float,2>{0.482387006f, 0.0590965375f},
-std::array<float,2>{0.0105628194f, 0.621131599f},
-std::array<float,2>{0.633335888f, 0.466980428f},
-std::array<float,2>{0.538825989f, 0.8892591f},
-std::array<float,2>{0.186603963f, 0.063636966f},
-std::array<float,2>{0.326838166f, 0.540559411f},
-std::array<float,2>{0.837898791f, 0.427207917f},
-std::array<float,2>{0.969187021f, 0.646746933f},
-std::array<float,2>{0.376864344f, 0.328112781f},
-std::array<float,2>{0.0847547501f, 0.833113492f},
-std::array<float,2>{0.700585544f, 0.169322461f},
-std::array<float,2>{0.676823199f, 0.587155163f},
-std::array<float,2>{0.0349480398f, 0.491827428f},
-std::array<float,2>{0.448720306f, 0.947280705f},
-std::array<float,2>{0.910748482f, 0.0101198368f},
-std::array<float,2>{0.789464235f, 0.753818572f},
-std::array<float,2>{0.309257627f, 0.206170663f},
-std::array<float,2>{0.210509405f, 0.694068611f},
-std::array<float,2>{0.617793202f, 0.256849706f},
-std::array<float,2>{0.653712273f, 0.954576075f},
-std::array<float,2>{0.029850265f, 0.0230457988f},
-std::array<float,2>{0.490411907f, 0.566669345f},
-std::array<float,2>{0.890140712f, 0.471839875f},
-std::array<float,2>{0.752888918f, 0.707356334f},
-std::array<float,2>{0.273788154f, 0.267346859f},
-std::array<float,2>{0.249333799f, 0.776217878f},
-std::array<float,2>{0.585148454f, 0.202510461f},
-std::array<float,2>{0.510167599f, 0.548860073f},
-std::array<float,2>{0.134742722f, 0.421384484f},
-std::array<float,2>{0.374840349f, 0.902596831f},
-std::array<float,2>{0.859994471f, 0.0842750445f},
-std::array<float,2>{0.950349331f, 0.820585251f},
-std::array<float,2>{0.414061308f, 0.179945186f},
-std::array<float,2>{0.10622751f, 0.633847296f},
-std::array<float,2>{0.719261885f, 0.329396576f},
-std::array<float,2>{0.604579151f, 0.808894634f},
-std::array<float,2>{0.187967554f, 0.23414503f},
-std::array<float,2>{0.286420494f, 0.723901212f},
-std::array<float,2>{0.809980333f, 0.294378012f},
-std::array<float,2>{0.925970852f, 0.606600285f},
-std::array<float,2>{0.460161537f, 0.445438564f},
-std::array<float,2>{0.0588909537f, 0.999678612f},
-std::array<float,2>{0.662724376f, 0.0343210772f},
-std::array<float,2>{0.715503454f, 0.674164236f},
-std::array<float,2>{0.0731608793f, 0.349460959f},
-std::array<float,2>{0.39385891f, 0.844961464f},
-std::array<float,2>{0.988735497f, 0.12972106f},
-std::array<float,2>{0.823462725f, 0.916399419f},
-std::array<float,2>{0.329277784f, 0.104663663f},
-std::array<float,2>{0.162791044f, 0.502498388f},
-std::array<float,2>{0.560932577f, 0.376207709f},
-std::array<float,2>{0.674663901f, 0.853752077f},
-std::array<float,2>{0.0378059223f, 0.132825851f},
-std::array<float,2>{0.449312568f, 0.686344385f},
-std::array<float,2>{0.909818172f, 0.354465634f},
-std::array<float,2>{0.793561518f, 0.509022593f},
-std::array<float,2>{0.30547604f, 0.384215117f},
-std::array<float,2>{0.20352374f, 0.910177052f},
-std::array<float,2>{0.62372005f, 0.0958974212f},
-std::array<float,2>{0.534129679f, 0.731379092f},
-std::array<float,2>{0.183045283f, 0.283284098f},
-std::array<float,2>{0.323705614f, 0.800490975f},
-std::array<float,2>{0.841907144f, 0.224892959f},
-std::array<float,2>{0.973507941f, 0.986847401f},
-std::array<float,2>{0.381417751f, 0.0396214947f},
-std::array<float,2>{0.0793120414f, 0.59827745f},
-std::array<float,2>{0.697007418f, 0.443736434f},
-std::array<float,2>{0.569086015f, 0.893353999f},
-std::array<float,2>{0.223568782f, 0.0909240097f},
-std::array<float,2>{0.261988342f, 0.559625626f},
-std::array<float,2>{0.778676331f, 0.407895893f},
-std::array<float,2>{0.898046255f, 0.627089798f},
-std::array<float,2>{0.477828592f, 0.34223485f},
-std::array<float,2>{0.0120166186f, 0.814815104f},
-std::array<float,2>{0.639669001f, 0.178744152f},
-std::array<float,2>{0.735031247f, 0.572113395f},
-std::array<float,2>{0.119085491f, 0.483821988f},
-std::array<float,2>{0.428457797f, 0.966967881f},
-std::array<float,2>{0.966941595f, 0.0301715806f},
-std::array<float,2>{0.853984535f, 0.767755032f},
-std::array<float,2>{0.344595909f, 0.193081856f},
-std::array<float,2>{0.141654104f, 0.714388072f},
-std::array<float,2>{0.525878787f, 0.274719089f},
-std::array<float,2>{0.713630497f, 0.944540679f},
-std::array<float,2>{0.0749768615f, 0.004757307f},
-std::array<float,2>{0.397581726f, 0.579094052f},
-std::array<float,2>{0.988150656f, 0.496697456f},
-std::array<float,2>{0.827706158f, 0.697920442f},
-std::array<float,2>{0.332615227f, 0.264863968f},
-std::array<float,2>{0.156970039f, 0.764284551f},
-std::array<float,2>{0.55476439f, 0.217256412f},
-std::array<float,2>{0.60860455f, 0.533043206f},
-std::array<float,2>{0.192542389f, 0.431061238f},
-std::array<float,2>{0.284161776f, 0.880185902f},
-std::array<float,2>{0.805235982f, 0.0776638836f},
-std::array<float,2>{0.925510526f, 0.838618159f},
-std::array<float,2>{0.455929488f, 0.158868954f},
-std::array<float,2>{0.0553591773f, 0.650650382f},
-std::array<float,2>{0.658078849f, 0.31887266f},
-std::array<float,2>{0.515137255f, 0.783933878f},
-std::array<float,2>{0.138723567f, 0.24833636f},
-std::array<float,2>{0.370275944f, 0.748692811f},
-std::array<float,2>{0.865357637f, 0.298576981f},
-std::array<float,2>{0.949118137f, 0.612607062f},
-std::array<float,2>{0.409874052f, 0.459220976f},
-std::array<float,2>{0.104464479f, 0.971707523f},
-std::array<float,2>{0.724037409f, 0.0500169583f},
-std::array<float,2>{0.648818612f, 0.66499877f},
-std::array<float,2>{0.0254674032f, 0.365606755f},
-std::array<float,2>{0.487058848f, 0.864067137f},
-std::array<float,2>{0.886532009f, 0.148034453f},
-std::array<float,2>{0.75698036f, 0.93261528f},
-std::array<float,2>{0.281085372f, 0.117294863f},
-std::array<float,2>{0.245819971f, 0.521553636f},
-std::array<float,2>{0.580723286f, 0.400839627f},
-std::array<float,2>{0.733021379f, 0.755537629f},
-std::array<float,2>{0.100518078f, 0.20723398f},
-std::array<float,2>{0.416028619f, 0.689496458f},
-std::array<float,2>{0.943773627f, 0.252664745f},
-std::array<float,2>{0.869679809f, 0.590129256f},
-std::array<float,2>{0.365230262f, 0.486704797f},
-std::array<float,2>{0.129144371f, 0.94987905f},
-std::array<float,2>{0.503549039f, 0.0121571366f},
-std::array<float,2>{0.589491844f, 0.642785311f},
-std::array<float,2>{0.239359275f, 0.323669702f},
-std::array<float,2>{0.268998444f, 0.829875171f},
-std::array<float,2>{0.759432018f, 0.167362913f},
-std::array<float,2>{0.877297878f, 0.886020839f},
-std::array<float,2>{0.497851193f, 0.0700204149f},
-std::array<float,2>{0.0174462181f, 0.543607712f},
-std::array<float,2>{0.64201504f, 0.422539353f},
-std::array<float,2>{0.54906863f, 0.982157886f},
-std::array<float,2>{0.167324007f, 0.056945473f},
-std::array<float,2>{0.33839184f, 0.618461668f},
-std::array<float,2>{0.814864933f, 0.461284846f},
-std::array<float,2>{0.998215318f, 0.734538913f},
-std::array<float,2>{0.404743701f, 0.309550196f},
-std::array<float,2>{0.0648620501f, 0.796820283f},
-std::array<float,2>{0.710255086f, 0.237583846f},
-std::array<float,2>{0.666450083f, 0.526020527f},
-std::array<float,2>{0.0470857508f, 0.397379875f},
-std::array<float,2>{0.466297805f, 0.926215053f},
-std::array<float,2>{0.929716766f, 0.114945583f},
-std::array<float,2>{0.79965502f, 0.868172646f},
-std::array<float,2>{0.290509015f, 0.150467426f},
-std::array<float,2>{0.200073913f, 0.65703094f},
-std::array<float,2>{0.595745921f, 0.372106701f},
-std::array<float,2>{0.6290856f, 0.920897841f},
-std::array<float,2>{0.00467037875f, 0.105507359f},
-std::array<float,2>{0.470119774f, 0.504653811f},
-std::array<float,2>{0.905522764f, 0.379080236f},
-std::array<float,2>{0.768260062f, 0.676808178f},
-std::array<float,2>{0.251204371f, 0.347143859f},
-std::array<float,2>{0.227692217f, 0.848969519f},
-std::array<float,2>{0.571249425f, 0.126140743f},
-std::array<float,2>{0.523209333f, 0.602492988f},
-std::array<float,2>{0.156240776f, 0.453060329f},
-std::array<float,2>{0.355065197f, 0.995273173f},
-std::array<float,2>{0.848875761f, 0.0378432497f},
-std::array<float,2>{0.953706086f, 0.806431115f},
-std::array<float,2>{0.433682829f, 0.227032036f},
-std::array<float,2>{0.112612784f, 0.721026659f},
-std::array<float,2>{0.742775738f, 0.29180941f},
-std::array<float,2>{0.612180769f, 0.825643837f},
-std::array<float,2>{0.212653488f, 0.184083313f},
-std::array<float,2>{0.304241627f, 0.63930285f},
-std::array<float,2>{0.787796378f, 0.335286885f},
-std::array<float,2>{0.916724741f, 0.55241102f},
-std::array<float,2>{0.442945927f, 0.414197326f},
-std::array<float,2>{0.0396320745f, 0.901779115f},
-std::array<float,2>{0.681029975f, 0.081602864f},
-std::array<float,2>{0.693590879f, 0.705088317f},
-std::array<float,2>{0.0937347859f, 0.270620018f},
-std::array<float,2>{0.389211774f, 0.77860862f},
-std::array<float,2>{0.981251359f, 0.198215857f},
-std::array<float,2>{0.830619991f, 0.958767831f},
-std::array<float,2>{0.319271207f, 0.0160017367f},
-std::array<float,2>{0.178970799f, 0.565430939f},
-std::array<float,2>{0.542844832f, 0.47494328f},
-std::array<float,2>{0.648269832f, 0.801669419f},
-std::array<float,2>{0.0209373385f, 0.222352028f},
-std::array<float,2>{0.495577216f, 0.727293432f},
-std::array<float,2>{0.879238725f, 0.286050677f},
-std::array<float,2>{0.764757037f, 0.593977332f},
-std::array<float,2>{0.269764811f, 0.438560873f},
-std::array<float,2>{0.236710399f, 0.990033925f},
-std::array<float,2>{0.591184676f, 0.0449084491f},
-std::array<float,2>{0.5053671f, 0.680808902f},
-std::array<float,2>{0.126421809f, 0.356539071f},
-std::array<float,2>{0.359777927f, 0.855995536f},
-std::array<float,2>{0.874648511f, 0.138488859f},
-std::array<float,2>{0.941130459f, 0.908929229f},
-std::array<float,2>{0.421306461f, 0.10133972f},
-std::array<float,2>{0.0942930505f, 0.514560282f},
-std::array<float,2>{0.729631186f, 0.390029818f},
-std::array<float,2>{0.600840747f, 0.964616477f},
-std::array<float,2>{0.196377367f, 0.0247224532f},
-std::array<float,2>{0.296007961f, 0.575088739f},
-std::array<float,2>{0.802353203f, 0.478351861f},
-std::array<float,2>{0.934125543f, 0.715668321f},
-std::array<float,2>{0.462182015f, 0.278306603f},
-std::array<float,2>{0.0524500757f, 0.770197213f},
-std::array<float,2>{0.669669926f, 0.18944034f},
-std::array<float,2>{0.705218017f, 0.557549417f},
-std::array<float,2>{0.0685522109f, 0.412394166f},
-std::array<float,2>{0.398787439f, 0.895249724f},
-std::array<float,2>{0.994116843f, 0.0888458043f},
-std::array<float,2>{0.818806469f, 0.816676915f},
-std::array<float,2>{0.341121763f, 0.172052622f},
-std::array<float,2>{0.16997081f, 0.630925775f},
-std::array<float,2>{0.553408444f, 0.336842984f},
-std::array<float,2>{0.749725878f, 0.878228486f},
-std::array<float,2>{0.115119599f, 0.0741875917f},
-std::array<float,2>{0.430584103f, 0.535678029f},
-std::array<float,2>{0.960585654f, 0.435001254f},
-std::array<float,2>{0.846892238f, 0.653553903f},
-std::array<float,2>{0.357923776f, 0.314305216f},
-std::array<float,2>{0.15138799f, 0.840068638f},
-std::array<float,2>{0.519466996f, 0.160907537f},
-std::array<float,2>{0.575484455f, 0.582663178f},
-std::array<float,2>{0.232942522f, 0.492996722f},
-std::array<float,2>{0.254020154f, 0.938576877f},
-std::array<float,2>{0.772593319f, 0.00176662032f},
-std::array<float,2>{0.899706006f, 0.760872304f},
-std::array<float,2>{0.473335177f, 0.212724909f},
-std::array<float,2>{0.000658268691f, 0.699239075f},
-std::array<float,2>{0.628498435f, 0.261462599f},
-std::array<float,2>{0.544110715f, 0.860726237f},
-std::array<float,2>{0.175332874f, 0.141414091f},
-std::array<float,2>{0.315574944f, 0.669888616f},
-std::array<float,2>{0.835483193f, 0.359572768f},
-std::array<float,2>{0.978429854f, 0.516970336f},
-std::array<float,2>{0.386201918f, 0.405114442f},
-std::array<float,2>{0.0893737823f, 0.934469938f},
-std::array<float,2>{0.691283524f, 0.124073811f},
-std::array<float,2>{0.684551001f, 0.742867231f},
-std::array<float,2>{0.0466270559f, 0.303129286f},
-std::array<float,2>{0.437598348f, 0.787552178f},
-std::array<float,2>{0.921512544f, 0.24416396f},
-std::array<float,2>{0.783324301f, 0.973605454f},
-std::array<float,2>{0.29974553f, 0.0534635149f},
-std::array<float,2>{0.218624413f, 0.61649555f},
-std::array<float,2>{0.614938617f, 0.454385936f},
-std::array<float,2>{0.70291245f, 0.834756732f},
-std::array<float,2>{0.0826769024f, 0.170416966f},
-std::array<float,2>{0.377490461f, 0.646090567f},
-std::array<float,2>{0.970750391f, 0.325833768f},
-std::array<float,2>{0.836066127f, 0.542404175f},
-std::array<float,2>{0.325728327f, 0.42836988f},
-std::array<float,2>{0.185049966f, 0.887694538f},
-std::array<float,2>{0.535156548f, 0.065753758f},
-std::array<float,2>{0.619686663f, 0.691483259f},
-std::array<float,2>{0.207539409f, 0.254932344f},
-std::array<float,2>{0.312218964f, 0.751817048f},
-std::array<float,2>{0.791368306f, 0.203460783f},
-std::array<float,2>{0.912989557f, 0.947173059f},
-std::array<float,2>{0.445880473f, 0.00901962444f},
-std::array<float,2>{0.032771904f, 0.587976933f},
-std::array<float,2>{0.678277791f, 0.488982588f},
-std::array<float,2>{0.528297246f, 0.923867643f},
-std::array<float,2>{0.146586969f, 0.109645665f},
-std::array<float,2>{0.348075837f, 0.528865397f},
-std::array<float,2>{0.858209729f, 0.394513667f},
-std::array<float,2>{0.96298039f, 0.660944998f},
-std::array<float,2>{0.422069371f, 0.367734849f},
-std::array<float,2>{0.122124352f, 0.871519029f},
-std::array<float,2>{0.739591897f, 0.156156391f},
-std::array<float,2>{0.635468721f, 0.624210835f},
-std::array<float,2>{0.00837013964f, 0.465825737f},
-std::array<float,2>{0.484189928f, 0.980410635f},
-std::array<float,2>{0.894303322f, 0.0616539419f},
-std::array<float,2>{0.77424556f, 0.791308403f},
-std::array<float,2>{0.259691447f, 0.241735712f},
-std::array<float,2>{0.220499516f, 0.740685105f},
-std::array<float,2>{0.563914061f, 0.307288587f},
-std::array<float,2>{0.661942601f, 0.99630475f},
-std::array<float,2>{0.0622920208f, 0.0324475355f},
-std::array<float,2>{0.4571805f, 0.60832715f},
-std::array<float,2>{0.928247154f, 0.44777146f},
-std::array<float,2>{0.810884893f, 0.72574389f},
-std::array<float,2>{0.28817904f, 0.295247406f},
-std::array<float,2>{0.191149309f, 0.812202096f},
-std::array<float,2>{0.602967322f, 0.23122552f},
-std::array<float,2>{0.559618652f, 0.500276566f},
-std::array<float,2>{0.160358861f, 0.377965838f},
-std::array<float,2>{0.330743939f, 0.915893614f},
-std::array<float,2>{0.821938038f, 0.103239201f},
-std::array<float,2>{0.991301954f, 0.84654218f},
-std::array<float,2>{0.391433209f, 0.131452337f},
-std::array<float,2>{0.0703364834f, 0.673484147f},
-std::array<float,2>{0.717774391f, 0.350897938f},
-std::array<float,2>{0.582050562f, 0.773841381f},
-std::array<float,2>{0.246808961f, 0.199445203f},
-std::array<float,2>{0.275512964f, 0.709431469f},
-std::array<float,2>{0.750356317f, 0.268772632f},
-std::array<float,2>{0.88683033f, 0.569596231f},
-std::array<float,2>{0.488645881f, 0.470065534f},
-std::array<float,2>{0.0283699036f, 0.955344319f},
-std::array<float,2>{0.65523386f, 0.0202414189f},
-std::array<float,2>{0.72124511f, 0.635585666f},
-std::array<float,2>{0.108362608f, 0.331417263f},
-std::array<float,2>{0.411186963f, 0.823045254f},
-std::array<float,2>{0.951441169f, 0.183265358f},
-std::array<float,2>{0.862915576f, 0.905461371f},
-std::array<float,2>{0.373025f, 0.082401596f},
-std::array<float,2>{0.136067688f, 0.547039628f},
-std::array<float,2>{0.507975161f, 0.4195503f},
-std::array<float,2>{0.65137428f, 0.86491549f},
-std::array<float,2>{0.0246757008f, 0.146568388f},
-std::array<float,2>{0.485032886f, 0.665270448f},
-std::array<float,2>{0.883777857f, 0.366931736f},
-std::array<float,2>{0.754069924f, 0.522863746f},
-std::array<float,2>{0.278359354f, 0.402003139f},
-std::array<float,2>{0.243962795f, 0.933185816f},
-std::array<float,2>{0.578801274f, 0.118676104f},
-std::array<float,2>{0.513493538f, 0.749699712f},
-std::array<float,2>{0.137018159f, 0.297374487f},
-std::array<float,2>{0.368782997f, 0.784904063f},
-std::array<float,2>{0.864007413f, 0.249238297f},
-std::array<float,2>{0.946622729f, 0.971467495f},
-std::array<float,2>{0.406628311f, 0.0496322699f},
-std::array<float,2>{0.103445604f, 0.61153686f},
-std::array<float,2>{0.725013077f, 0.460459977f},
-std::array<float,2>{0.606773496f, 0.879018784f},
-std::array<float,2>{0.194200411f, 0.0766016096f},
-std::array<float,2>{0.281553298f, 0.532151759f},
-std::array<float,2>{0.808040917f, 0.429957032f},
-std::array<float,2>{0.922125161f, 0.652250528f},
-std::array<float,2>{0.453407168f, 0.320166647f},
-std::array<float,2>{0.0575709678f, 0.839208305f},
-std::array<float,2>{0.658682525f, 0.159822524f},
-std::array<float,2>{0.712403059f, 0.579672813f},
-std::array<float,2>{0.077581495f, 0.497521311f},
-std::array<float,2>{0.395600259f, 0.943370521f},
-std::array<float,2>{0.985395849f, 0.00514533231f},
-std::array<float,2>{0.824843466f, 0.765502095f},
-std::array<float,2>{0.335438937f, 0.217842221f},
-std::array<float,2>{0.158979252f, 0.698910475f},
-std::array<float,2>{0.557664394f, 0.264165729f},
-std::array<float,2>{0.737268865f, 0.968502283f},
-std::array<float,2>{0.120395698f, 0.0312075224f},
-std::array<float,2>{0.426644593f, 0.570337892f},
-std::array<float,2>{0.966090679f, 0.482620329f},
-std::array<float,2>{0.852316916f, 0.713428676f},
-std::array<float,2>{0.347353548f, 0.273613393f},
-std::array<float,2>{0.142846614f, 0.768597305f},
-std::array<float,2>{0.52393651f, 0.191475779f},
-std::array<float,2>{0.568017125f, 0.558885455f},
-std::array<float,2>{0.226004303f, 0.406315774f},
-std::array<float,2>{0.265271097f, 0.893556654f},
-std::array<float,2>{0.7799263f, 0.090746887f},
-std::array<float,2>{0.895228446f, 0.815499842f},
-std::array<float,2>{0.47908783f, 0.178672358f},
-std::array<float,2>{0.0150954342f, 0.628391802f},
-std::array<float,2>{0.637784004f, 0.342920601f},
-std::array<float,2>{0.532426357f, 0.799454927f},
-std::array<float,2>{0.180249959f, 0.225854859f},
-std::array<float,2>{0.320567131f, 0.73157841f},
-std::array<float,2>{0.839986026f, 0.284974366f},
-std::array<float,2>{0.974652946f, 0.598720968f},
-std::array<float,2>{0.379656374f, 0.444853544f},
-std::array<float,2>{0.0814625248f, 0.987308681f},
-std::array<float,2>{0.6988464f, 0.040800415f},
-std::array<float,2>{0.673307955f, 0.687040448f},
-std::array<float,2>{0.0360731445f, 0.355307817f},
-std::array<float,2>{0.451615542f, 0.855052471f},
-std::array<float,2>{0.907615364f, 0.134576708f},
-std::array<float,2>{0.795420945f, 0.911493838f},
-std::array<float,2>{0.307473004f, 0.0976251736f},
-std::array<float,2>{0.205486104f, 0.507909596f},
-std::array<float,2>{0.622393012f, 0.383651197f},
-std::array<float,2>{0.691595018f, 0.7778157f},
-std::array<float,2>{0.0915966108f, 0.19902581f},
-std::array<float,2>{0.388064414f, 0.706111848f},
-std::array<float,2>{0.982573032f, 0.270108283f},
-std::array<float,2>{0.828894258f, 0.565226436f},
-std::array<float,2>{0.31700477f, 0.475748301f},
-std::array<float,2>{0.17616944f, 0.957969308f},
-std::array<float,2>{0.540954709f, 0.0167572778f},
-std::array<float,2>{0.611155808f, 0.639916956f},
-std::array<float,2>{0.21452783f, 0.33427155f},
-std::array<float,2>{0.301024795f, 0.824396253f},
-std::array<float,2>{0.786476612f, 0.185053527f},
-std::array<float,2>{0.915465176f, 0.901363015f},
-std::array<float,2>{0.444942385f, 0.0804926381f},
-std::array<float,2>{0.0426579118f, 0.550992966f},
-std::array<float,2>{0.68314606f, 0.415881723f},
-std::array<float,2>{0.520030022f, 0.99491781f},
-std::array<float,2>{0.152743384f, 0.0383179076f},
-std::array<float,2>{0.353293657f, 0.603154004f},
-std::array<float,2>{0.851347268f, 0.451242149f},
-std::array<float,2>{0.955820084f, 0.721886456f},
-std::array<float,2>{0.436823398f, 0.292333186f},
-std::array<float,2>{0.111060962f, 0.804883361f},
-std::array<float,2>{0.745127082f, 0.228309125f},
-std::array<float,2>{0.631622314f, 0.505839884f},
-std::array<float,2>{0.00701843621f, 0.380334407f},
-std::array<float,2>{0.472588599f, 0.921746314f},
-std::array<float,2>{0.902850926f, 0.106656954f},
-std::array<float,2>{0.767559946f, 0.848268449f},
-std::array<float,2>{0.251986742f, 0.125637233f},
-std::array<float,2>{0.229140997f, 0.675966382f},
-std::array<float,2>{0.573575616f, 0.345794559f},
-std::array<float,2>{0.665375054f, 0.927675545f},
-std::array<float,2>{0.0503601655f, 0.113434277f},
-std::array<float,2>{0.468645543f, 0.526586235f},
-std::array<float,2>{0.932799757f, 0.398179471f},
-std::array<float,2>{0.797254264f, 0.657450259f},
-std::array<float,2>{0.291072279f, 0.371390611f},
-std::array<float,2>{0.201510295f, 0.867414892f},
-std::array<float,2>{0.59441936f, 0.151616678f},
-std::array<float,2>{0.548041284f, 0.617459536f},
-std::array<float,2>{0.16594553f, 0.46278131f},
-std::array<float,2>{0.336542159f, 0.981003404f},
-std::array<float,2>{0.813555241f, 0.0585246645f},
-std::array<float,2>{0.997874081f, 0.795803785f},
-std::array<float,2>{0.403333932f, 0.237285018f},
-std::array<float,2>{0.064090699f, 0.735556841f},
-std::array<float,2>{0.708554864f, 0.309884161f},
-std::array<float,2>{0.586163163f, 0.828593135f},
-std::array<float,2>{0.242172778f, 0.166806415f},
-std::array<float,2>{0.267378837f, 0.644082904f},
-std::array<float,2>{0.759894431f, 0.322951764f},
-std::array<float,2>{0.875918627f, 0.544510245f},
-std::array<float,2>{0.498958886f, 0.423265815f},
-std::array<float,2>{0.0179624986f, 0.884914219f},
-std::array<float,2>{0.642949522f, 0.068968527f},
-std::array<float,2>{0.732163429f, 0.690609157f},
-std::array<float,2>{0.0990764499f, 0.253614455f},
-std::array<float,2>{0.414662093f, 0.754190326f},
-std::array<float,2>{0.94227159f, 0.208745956f},
-std::array<float,2>{0.868820667f, 0.950491905f},
-std::array<float,2>{0.365876287f, 0.0136421425f},
-std::array<float,2>{0.131677389f, 0.59166503f},
-std::array<float,2>{0.501638293f, 0.487339616f},
-std::array<float,2>{0.686993837f, 0.788330615f},
-std::array<float,2>{0.0434028469f, 0.24517189f},
-std::array<float,2>{0.440806597f, 0.743286014f},
-std::array<float,2>{0.91894716f, 0.30447796f},
-std::array<float,2>{0.781327963f, 0.615834236f},
-std::array<float,2>{0.297676027f, 0.45321694f},
-std::array<float,2>{0.216587931f, 0.974347711f},
-std::array<float,2>{0.616874993f, 0.0545922443f},
-std::array<float,2>{0.546068966f, 0.667998075f},
-std::array<float,2>{0.173249617f, 0.360514224f},
-std::array<float,2>{0.313910276f, 0.860107243f},
-std::array<float,2>{0.832706153f, 0.142461255f},
-std::array<float,2>{0.979926765f, 0.93530947f},
-std::array<float,2>{0.383764446f, 0.123203449f},
-std::array<float,2>{0.0862473473f, 0.516502738f},
-std::array<float,2>{0.688137054f, 0.405636132f},
-std::array<float,2>{0.576235354f, 0.938154638f},
-std::array<float,2>{0.23119542f, 6.69991277e-05f},
-std::array<float,2>{0.256307334f, 0.583973289f},
-std::array<float,2>{0.769767642f, 0.493426383f},
-std::array<float,2>{0.90137589f, 0.700501025f},
-std::array<float,2>{0.476026922f, 0.260677367f},
-std::array<float,2>{0.00206925324f, 0.760026693f},
-std::array<float,2>{0.626120389f, 0.211520553f},
-std::array<float,2>{0.747761786f, 0.536796093f},
-std::array<float,2>{0.117137179f, 0.433738917f},
-std::array<float,2>{0.433105677f, 0.877245009f},
-std::array<float,2>{0.958956122f, 0.0727488995f},
-std::array<float,2>{0.844758511f, 0.84142977f},
-std::array<float,2>{0.357047588f, 0.161694005f},
-std::array<float,2>{0.149352565f, 0.652897239f},
-std::array<float,2>{0.516296387f, 0.312693894f},
-std::array<float,2>{0.704398751f, 0.895575881f},
-std::array<float,2>{0.0676603168f, 0.0896830335f},
-std::array<float,2>{0.400864482f, 0.558200419f},
-std::array<float,2>{0.994264424f, 0.413570076f},
-std::array<float,2>{0.818001866f, 0.632732451f},
-std::array<float,2>{0.343152791f, 0.337385863f},
-std::array<float,2>{0.168556601f, 0.817477047f},
-std::array<float,2>{0.551312685f, 0.173783481f},
-std::array<float,2>{0.598650873f, 0.575391412f},
-std::array<float,2>{0.198858187f, 0.477153689f},
-std::array<float,2>{0.293131799f, 0.963410497f},
-std::array<float,2>{0.803849697f, 0.0241758227f},
-std::array<float,2>{0.937482357f, 0.771418035f},
-std::array<float,2>{0.464322001f, 0.188435674f},
-std::array<float,2>{0.0536086783f, 0.716690779f},
-std::array<float,2>{0.670716524f, 0.278448462f},
-std::array<float,2>{0.507642508f, 0.857151926f},
-std::array<float,2>{0.127853885f, 0.137483761f},
-std::array<float,2>{0.362353534f, 0.679930449f},
-std::array<float,2>{0.872778893f, 0.356176943f},
-std::array<float,2>{0.938628852f, 0.515231967f},
-std::array<float,2>{0.419674635f, 0.38940987f},
-std::array<float,2>{0.0975818709f, 0.909222126f},
-std::array<float,2>{0.726831615f, 0.0999466926f},
-std::array<float,2>{0.644982457f, 0.728070736f},
-std::array<float,2>{0.0216789804f, 0.28664577f},
-std::array<float,2>{0.493627071f, 0.802196026f},
-std::array<float,2>{0.88160038f, 0.220828101f},
-std::array<float,2>{0.762435615f, 0.988960624f},
-std::array<float,2>{0.273070246f, 0.0431587137f},
-std::array<float,2>{0.235875934f, 0.595347583f},
-std::array<float,2>{0.592974544f, 0.437564909f},
-std::array<float,2>{0.720440865f, 0.82399261f},
-std::array<float,2>{0.10718406f, 0.181897476f},
-std::array<float,2>{0.41274786f, 0.635827363f},
-std::array<float,2>{0.950120747f, 0.330202758f},
-std::array<float,2>{0.861130595f, 0.548231006f},
-std::array<float,2>{0.37321797f, 0.418166786f},
-std::array<float,2>{0.132840887f, 0.905073285f},
-std::array<float,2>{0.511110902f, 0.0839515179f},
-std::array<float,2>{0.584700584f, 0.710173488f},
-std::array<float,2>{0.248319536f, 0.267659545f},
-std::array<float,2>{0.274840474f, 0.774744391f},
-std::array<float,2>{0.752997041f, 0.200966045f},
-std::array<float,2>{0.888750076f, 0.956769764f},
-std::array<float,2>{0.491517663f, 0.0210169777f},
-std::array<float,2>{0.0310954265f, 0.569022179f},
-std::array<float,2>{0.653207541f, 0.469493985f},
-std::array<float,2>{0.561959028f, 0.914090514f},
-std::array<float,2>{0.163293287f, 0.101791009f},
-std::array<float,2>{0.328606397f, 0.500999451f},
-std::array<float,2>{0.822930455f, 0.377647877f},
-std::array<float,2>{0.989257991f, 0.672170997f},
-std::array<float,2>{0.392828137f, 0.350132346f},
-std::array<float,2>{0.074197799f, 0.847330093f},
-std::array<float,2>{0.716504276f, 0.132096216f},
-std::array<float,2>{0.663202286f, 0.608756363f},
-std::array<float,2>{0.0600260086f, 0.449208468f},
-std::array<float,2>{0.45994544f, 0.997771144f},
-std::array<float,2>{0.927090287f, 0.0314137191f},
-std::array<float,2>{0.808945596f, 0.810655832f},
-std::array<float,2>{0.285247892f, 0.232265994f},
-std::array<float,2>{0.189232081f, 0.725374699f},
-std::array<float,2>{0.604051888f, 0.296615809f},
-std::array<float,2>{0.634017587f, 0.978521526f},
-std::array<float,2>{0.0107790409f, 0.0607052185f},
-std::array<float,2>{0.481251717f, 0.62320751f},
-std::array<float,2>{0.891125023f, 0.465751678f},
-std::array<float,2>{0.776756287f, 0.741517246f},
-std::array<float,2>{0.261404097f, 0.308433205f},
-std::array<float,2>{0.221690089f, 0.79243952f},
-std::array<float,2>{0.565673232f, 0.240875989f},
-std::array<float,2>{0.52945751f, 0.527628362f},
-std::array<float,2>{0.145044938f, 0.393497556f},
-std::array<float,2>{0.350258857f, 0.925582826f},
-std::array<float,2>{0.855681121f, 0.111022614f},
-std::array<float,2>{0.961389005f, 0.872408569f},
-std::array<float,2>{0.425427258f, 0.155210197f},
-std::array<float,2>{0.123204909f, 0.661967993f},
-std::array<float,2>{0.741852939f, 0.368551612f},
-std::array<float,2>{0.618896306f, 0.750425398f},
-std::array<float,2>{0.209231809f, 0.20438005f},
-std::array<float,2>{0.310338795f, 0.692952156f},
-std::array<float,2>{0.790543497f, 0.254529327f},
-std::array<float,2>{0.911909282f, 0.589523971f},
-std::array<float,2>{0.447438657f, 0.489622235f},
-std::array<float,2>{0.0339087844f, 0.945726156f},
-std::array<float,2>{0.676137269f, 0.00865874719f},
-std::array<float,2>{0.699696004f, 0.645190001f},
-std::array<float,2>{0.0857952386f, 0.324788451f},
-std::array<float,2>{0.37500605f, 0.835556567f},
-std::array<float,2>{0.970357895f, 0.171535268f},
-std::array<float,2>{0.839348555f, 0.887943268f},
-std::array<float,2>{0.327149749f, 0.064477928f},
-std::array<float,2>{0.186501607f, 0.541609347f},
-std::array<float,2>{0.53748548f, 0.429394066f},
-std::array<float,2>{0.656252384f, 0.837186515f},
-std::array<float,2>{0.0562141612f, 0.157570124f},
-std::array<float,2>{0.456851304f, 0.64932698f},
-std::array<float,2>{0.92452389f, 0.316443175f},
-std::array<float,2>{0.805713952f, 0.533770561f},
-std::array<float,2>{0.284911513f, 0.431685805f},
-std::array<float,2>{0.191431239f, 0.882061779f},
-std::array<float,2>{0.608062029f, 0.0759392083f},
-std::array<float,2>{0.556224942f, 0.696911514f},
-std::array<float,2>{0.157694563f, 0.261959642f},
-std::array<float,2>{0.333569944f, 0.763422668f},
-std::array<float,2>{0.826985896f, 0.215999916f},
-std::array<float,2>{0.986719489f, 0.942342818f},
-std::array<float,2>{0.39691928f, 0.00755319977f},
-std::array<float,2>{0.0753728077f, 0.580551565f},
-std::array<float,2>{0.714595079f, 0.49938637f},
-std::array<float,2>{0.581879795f, 0.929961205f},
-std::array<float,2>{0.244262233f, 0.1207041f},
-std::array<float,2>{0.279819697f, 0.521311879f},
-std::array<float,2>{0.756495297f, 0.398759186f},
-std::array<float,2>{0.885547221f, 0.667470336f},
-std::array<float,2>{0.487818331f, 0.365173042f},
-std::array<float,2>{0.026992023f, 0.865713298f},
-std::array<float,2>{0.650072694f, 0.146371767f},
-std::array<float,2>{0.723631442f, 0.611158073f},
-std::array<float,2>{0.104999907f, 0.45712018f},
-std::array<float,2>{0.408298135f, 0.970385313f},
-std::array<float,2>{0.9474985f, 0.0475644283f},
-std::array<float,2>{0.866428137f, 0.7831738f},
-std::array<float,2>{0.369386137f, 0.246233329f},
-std::array<float,2>{0.140065059f, 0.747025549f},
-std::array<float,2>{0.513942242f, 0.300301403f},
-std::array<float,2>{0.695385635f, 0.985596359f},
-std::array<float,2>{0.078862831f, 0.0422722213f},
-std::array<float,2>{0.38235572f, 0.601425886f},
-std::array<float,2>{0.974155247f, 0.441730976f},
-std::array<float,2>{0.843153596f, 0.733092189f},
-std::array<float,2>{0.322386593f, 0.281445533f},
-std::array<float,2>{0.181815073f, 0.798548937f},
-std::array<float,2>{0.534312308f, 0.223937705f},
-std::array<float,2>{0.624428928f, 0.510091662f},
-std::array<float,2>{0.204248056f, 0.386610121f},
-std::array<float,2>{0.3063851f, 0.914001584f},
-std::array<float,2>{0.794336319f, 0.0948557481f},
-std::array<float,2>{0.908557951f, 0.85330832f},
-std::array<float,2>{0.450378269f, 0.135102406f},
-std::array<float,2>{0.0389060192f, 0.685392022f},
-std::array<float,2>{0.67549336f, 0.353270918f},
-std::array<float,2>{0.52679342f, 0.767553687f},
-std::array<float,2>{0.141084731f, 0.19367817f},
-std::array<float,2>{0.345366418f, 0.711208403f},
-std::array<float,2>{0.855077505f, 0.275628f},
-std::array<float,2>{0.967946827f, 0.57381922f},
-std::array<float,2>{0.429376334f, 0.481741369f},
-std::array<float,2>{0.117340237f, 0.966512322f},
-std::array<float,2>{0.735358417f, 0.0287762154f},
-std::array<float,2>{0.638859451f, 0.625542402f},
-std::array<float,2>{0.0129262442f, 0.340109557f},
-std::array<float,2>{0.4772425f, 0.812833965f},
-std::array<float,2>{0.897116899f, 0.176063448f},
-std::array<float,2>{0.778130531f, 0.89064604f},
-std::array<float,2>{0.263052523f, 0.0926283523f},
-std::array<float,2>{0.224572212f, 0.561687768f},
-std::array<float,2>{0.569540679f, 0.409445226f},
-std::array<float,2>{0.743967295f, 0.806923807f},
-std::array<float,2>{0.111762531f, 0.230174303f},
-std::array<float,2>{0.434635043f, 0.71910727f},
-std::array<float,2>{0.954992473f, 0.290086001f},
-std::array<float,2>{0.848000705f, 0.605095208f},
-std::array<float,2>{0.354374617f, 0.450173229f},
-std::array<float,2>{0.154627666f, 0.992968023f},
-std::array<float,2>{0.522156835f, 0.0368341282f},
-std::array<float,2>{0.571995199f, 0.6788674f},
-std::array<float,2>{0.227194116f, 0.344575226f},
-std::array<float,2>{0.250182301f, 0.850034237f},
-std::array<float,2>{0.769435108f, 0.128688321f},
-std::array<float,2>{0.904833436f, 0.919581532f},
-std::array<float,2>{0.469376296f, 0.107904732f},
-std::array<float,2>{0.00521119637f, 0.506851733f},
-std::array<float,2>{0.630459368f, 0.382119149f},
-std::array<float,2>{0.54152292f, 0.959818423f},
-std::array<float,2>{0.178696945f, 0.0179272834f},
-std::array<float,2>{0.319999367f, 0.563081145f},
-std::array<float,2>{0.831162572f, 0.473722517f},
-std::array<float,2>{0.982089162f, 0.704631269f},
-std::array<float,2>{0.390487254f, 0.271851361f},
-std::array<float,2>{0.0927612185f, 0.780946672f},
-std::array<float,2>{0.694455147f, 0.19645144f},
-std::array<float,2>{0.680320859f, 0.553044915f},
-std::array<float,2>{0.0410075411f, 0.416410029f},
-std::array<float,2>{0.442097336f, 0.90004468f},
-std::array<float,2>{0.917895913f, 0.0785226375f},
-std::array<float,2>{0.788811684f, 0.826821744f},
-std::array<float,2>{0.30289501f, 0.186205566f},
-std::array<float,2>{0.2114757f, 0.638020277f},
-std::array<float,2>{0.613113105f, 0.332853556f},
-std::array<float,2>{0.64086026f, 0.884679496f},
-std::array<float,2>{0.0158821661f, 0.0672565028f},
-std::array<float,2>{0.496647209f, 0.546298742f},
-std::array<float,2>{0.878415287f, 0.424499512f},
-std::array<float,2>{0.757932663f, 0.641121745f},
-std::array<float,2>{0.26839447f, 0.321322054f},
-std::array<float,2>{0.239158809f, 0.830733597f},
-std::array<float,2>{0.588214099f, 0.164482653f},
-std::array<float,2>{0.50238055f, 0.59213078f},
-std::array<float,2>{0.130790904f, 0.485783249f},
-std::array<float,2>{0.363523751f, 0.951396942f},
-std::array<float,2>{0.870703816f, 0.0142121119f},
-std::array<float,2>{0.94483918f, 0.757127702f},
-std::array<float,2>{0.417007715f, 0.210566476f},
-std::array<float,2>{0.101151444f, 0.687887788f},
-std::array<float,2>{0.733545601f, 0.251675874f},
-std::array<float,2>{0.597441137f, 0.870811939f},
-std::array<float,2>{0.200815961f, 0.149010539f},
-std::array<float,2>{0.289555818f, 0.658972442f},
-std::array<float,2>{0.799844623f, 0.374809802f},
-std::array<float,2>{0.930775166f, 0.52520287f},
-std::array<float,2>{0.465762466f, 0.395588309f},
-std::array<float,2>{0.0484611057f, 0.928810179f},
-std::array<float,2>{0.667658746f, 0.116313666f},
-std::array<float,2>{0.709500551f, 0.736987829f},
-std::array<float,2>{0.0660587996f, 0.311434507f},
-std::array<float,2>{0.405343473f, 0.793458879f},
-std::array<float,2>{0.999642968f, 0.235258967f},
-std::array<float,2>{0.816328168f, 0.983266711f},
-std::array<float,2>{0.339558005f, 0.0555346943f},
-std::array<float,2>{0.166694283f, 0.620885491f},
-std::array<float,2>{0.550742209f, 0.463270932f},
-std::array<float,2>{0.627100646f, 0.758540988f},
-std::array<float,2>{0.00135563698f, 0.213649899f},
-std::array<float,2>{0.474587053f, 0.701313376f},
-std::array<float,2>{0.899373233f, 0.259325504f},
-std::array<float,2>{0.772301435f, 0.58457756f},
-std::array<float,2>{0.255826235f, 0.494314671f},
-std::array<float,2>{0.234094247f, 0.939883947f},
-std::array<float,2>{0.575019717f, 0.00201682071f},
-std::array<float,2>{0.517710984f, 0.655263007f},
-std::array<float,2>{0.150959015f, 0.315909266f},
-std::array<float,2>{0.35844174f, 0.843321681f},
-std::array<float,2>{0.845808387f, 0.16379343f},
-std::array<float,2>{0.959840775f, 0.875984371f},
-std::array<float,2>{0.431613714f, 0.0716977566f},
-std::array<float,2>{0.113703221f, 0.538188338f},
-std::array<float,2>{0.748428404f, 0.435947627f},
-std::array<float,2>{0.614192605f, 0.975536108f},
-std::array<float,2>{0.217656553f, 0.0515644439f},
-std::array<float,2>{0.300662249f, 0.614662886f},
-std::array<float,2>{0.784831583f, 0.456223547f},
-std::array<float,2>{0.920383215f, 0.744304597f},
-std::array<float,2>{0.438787341f, 0.301225901f},
-std::array<float,2>{0.0454109274f, 0.786898851f},
-std::array<float,2>{0.684771895f, 0.242765218f},
-std::array<float,2>{0.689935803f, 0.517974317f},
-std::array<float,2>{0.0886266157f, 0.403314799f},
-std::array<float,2>{0.384973437f, 0.936171114f},
-std::array<float,2>{0.977083206f, 0.122162655f},
-std::array<float,2>{0.834677517f, 0.86142379f},
-std::array<float,2>{0.3154203f, 0.143451557f},
-std::array<float,2>{0.173933968f, 0.670282364f},
-std::array<float,2>{0.543341994f, 0.36167106f},
-std::array<float,2>{0.728641331f, 0.90638715f},
-std::array<float,2>{0.0949011371f, 0.0987457186f},
-std::array<float,2>{0.420596838f, 0.512189686f},
-std::array<float,2>{0.939915061f, 0.387662262f},
-std::array<float,2>{0.873925626f, 0.683358669f},
-std::array<float,2>{0.360357642f, 0.359029084f},
-std::array<float,2>{0.12577948f, 0.858650029f},
-std::array<float,2>{0.504204929f, 0.139061332f},
-std::array<float,2>{0.590116322f, 0.597080231f},
-std::array<float,2>{0.238038167f, 0.441335827f},
-std::array<float,2>{0.271181881f, 0.991609931f},
-std::array<float,2>{0.764228821f, 0.0450420417f},
-std::array<float,2>{0.880797982f, 0.803592384f},
-std::array<float,2>{0.494447529f, 0.218789712f},
-std::array<float,2>{0.019828571f, 0.728829861f},
-std::array<float,2>{0.646554947f, 0.288913697f},
-std::array<float,2>{0.554644942f, 0.820128381f},
-std::array<float,2>{0.171751291f, 0.175559029f},
-std::array<float,2>{0.340442449f, 0.630569875f},
-std::array<float,2>{0.819593966f, 0.339653611f},
-std::array<float,2>{0.992394388f, 0.555615008f},
-std::array<float,2>{0.400342226f, 0.411505073f},
-std::array<float,2>{0.0694272816f, 0.896567702f},
-std::array<float,2>{0.706964016f, 0.0872822478f},
-std::array<float,2>{0.66849494f, 0.717492342f},
-std::array<float,2>{0.0508740842f, 0.280022115f},
-std::array<float,2>{0.461716831f, 0.772314847f},
-std::array<float,2>{0.935500205f, 0.191339195f},
-std::array<float,2>{0.800826311f, 0.961768508f},
-std::array<float,2>{0.295882076f, 0.0257075764f},
-std::array<float,2>{0.196030721f, 0.576492786f},
-std::array<float,2>{0.600175381f, 0.479993343f},
-std::array<float,2>{0.717366457f, 0.844312549f},
-std::array<float,2>{0.0714504793f, 0.130179599f},
-std::array<float,2>{0.391664594f, 0.675536036f},
-std::array<float,2>{0.990956485f, 0.347786427f},
-std::array<float,2>{0.821091235f, 0.503547192f},
-std::array<float,2>{0.331590682f, 0.375372499f},
-std::array<float,2>{0.161626354f, 0.917068839f},
-std::array<float,2>{0.559033096f, 0.104236722f},
-std::array<float,2>{0.60202235f, 0.722875535f},
-std::array<float,2>{0.190165088f, 0.292986721f},
-std::array<float,2>{0.287420899f, 0.810441017f},
-std::array<float,2>{0.811884105f, 0.232576519f},
-std::array<float,2>{0.929280579f, 0.998963714f},
-std::array<float,2>{0.458746344f, 0.0339851305f},
-std::array<float,2>{0.0606039539f, 0.605804563f},
-std::array<float,2>{0.661099374f, 0.447119206f},
-std::array<float,2>{0.509714723f, 0.904047072f},
-std::array<float,2>{0.134984985f, 0.0853087083f},
-std::array<float,2>{0.37131092f, 0.55055213f},
-std::array<float,2>{0.861611128f, 0.41995123f},
-std::array<float,2>{0.952318728f, 0.633154988f},
-std::array<float,2>{0.410421073f, 0.328157395f},
-std::array<float,2>{0.109243669f, 0.822209477f},
-std::array<float,2>{0.722521782f, 0.181505829f},
-std::array<float,2>{0.655610919f, 0.568088114f},
-std::array<float,2>{0.0276290253f, 0.470958829f},
-std::array<float,2>{0.48935923f, 0.953395247f},
-std::array<float,2>{0.888166666f, 0.0215281807f},
-std::array<float,2>{0.7512905f, 0.777281702f},
-std::array<float,2>{0.276668668f, 0.201944351f},
-std::array<float,2>{0.247835666f, 0.708162904f},
-std::array<float,2>{0.583289683f, 0.26622656f},
-std::array<float,2>{0.679127634f, 0.949010611f},
-std::array<float,2>{0.0319459476f, 0.010955574f},
-std::array<float,2>{0.447074294f, 0.586628556f},
-std::array<float,2>{0.913953304f, 0.49078393f},
-std::array<float,2>{0.792617619f, 0.694781542f},
-std::array<float,2>{0.311255902f, 0.256509572f},
-std::array<float,2>{0.208932072f, 0.752206504f},
-std::array<float,2>{0.621060312f, 0.20520848f},
-std::array<float,2>{0.536446571f, 0.539146364f},
-std::array<float,2>{0.184521362f, 0.426528096f},
-std::array<float,2>{0.324448764f, 0.889779389f},
-std::array<float,2>{0.837243259f, 0.0626112893f},
-std::array<float,2>{0.971857607f, 0.832178712f},
-std::array<float,2>{0.378457099f, 0.168059409f},
-std::array<float,2>{0.0835728049f, 0.647822618f},
-std::array<float,2>{0.701838732f, 0.326683432f},
-std::array<float,2>{0.562681675f, 0.789526463f},
-std::array<float,2>{0.218906656f, 0.239236325f},
-std::array<float,2>{0.258472741f, 0.738796532f},
-std::array<float,2>{0.774890184f, 0.306620121f},
-std::array<float,2>{0.892598748f, 0.622834742f},
-std::array<float,2>{0.482704163f, 0.468430161f},
-std::array<float,2>{0.00908338465f, 0.977059841f},
-std::array<float,2>{0.636068821f, 0.0602439679f},
-std::array<float,2>{0.738855362f, 0.663595319f},
-std::array<float,2>{0.121588685f, 0.370491713f},
-std::array<float,2>{0.423746318f, 0.874554694f},
-std::array<float,2>{0.964271665f, 0.153633818f},
-std::array<float,2>{0.858786106f, 0.922209561f},
-std::array<float,2>{0.348982662f, 0.112286963f},
-std::array<float,2>{0.148111776f, 0.529942334f},
-std::array<float,2>{0.529018044f, 0.391178966f}}
\ No newline at end of file
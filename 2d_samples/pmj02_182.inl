@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.513726532f, 0.530354917f},
-std::array<float,2>{0.43714115f, 0.358997524f},
-std::array<float,2>{0.8519876f, 0.143798232f},
-std::array<float,2>{0.00707484828f, 0.847100377f},
-std::array<float,2>{0.885711908f, 0.937721729f},
-std::array<float,2>{0.149958819f, 0.0128775751f},
-std::array<float,2>{0.739217818f, 0.492975682f},
-std::array<float,2>{0.356216967f, 0.71985656f},
-std::array<float,2>{0.668500781f, 0.780924737f},
-std::array<float,2>{0.291733503f, 0.203245729f},
-std::array<float,2>{0.995911181f, 0.300243437f},
-std::array<float,2>{0.190010697f, 0.562531412f},
-std::array<float,2>{0.781634331f, 0.631710827f},
-std::array<float,2>{0.0973446071f, 0.434394658f},
-std::array<float,2>{0.598990023f, 0.102553651f},
-std::array<float,2>{0.481213421f, 0.899662614f},
-std::array<float,2>{0.688586414f, 0.704172075f},
-std::array<float,2>{0.329695195f, 0.45374316f},
-std::array<float,2>{0.912244976f, 0.0588648319f},
-std::array<float,2>{0.173592404f, 0.983110309f},
-std::array<float,2>{0.840330958f, 0.843387067f},
-std::array<float,2>{0.0329948254f, 0.176604524f},
-std::array<float,2>{0.548842251f, 0.326790005f},
-std::array<float,2>{0.386444658f, 0.548244417f},
-std::array<float,2>{0.563269913f, 0.907467127f},
-std::array<float,2>{0.444907039f, 0.0819429755f},
-std::array<float,2>{0.778959751f, 0.391552657f},
-std::array<float,2>{0.0676765516f, 0.661369741f},
-std::array<float,2>{0.968334258f, 0.612550437f},
-std::array<float,2>{0.24656418f, 0.262472093f},
-std::array<float,2>{0.628737867f, 0.221673012f},
-std::array<float,2>{0.256522924f, 0.788612306f},
-std::array<float,2>{0.643656671f, 0.586713493f},
-std::array<float,2>{0.272649378f, 0.287689507f},
-std::array<float,2>{0.942601383f, 0.192804769f},
-std::array<float,2>{0.227099448f, 0.76227051f},
-std::array<float,2>{0.761408091f, 0.879882634f},
-std::array<float,2>{0.0866611972f, 0.112453997f},
-std::array<float,2>{0.588874161f, 0.4182854f},
-std::array<float,2>{0.46631673f, 0.652273238f},
-std::array<float,2>{0.536030054f, 0.868407786f},
-std::array<float,2>{0.402292252f, 0.126957208f},
-std::array<float,2>{0.819598615f, 0.370040864f},
-std::array<float,2>{0.0593559481f, 0.513687432f},
-std::array<float,2>{0.936968446f, 0.734556794f},
-std::array<float,2>{0.166880965f, 0.478643328f},
-std::array<float,2>{0.709520996f, 0.0271280743f},
-std::array<float,2>{0.32638669f, 0.965355873f},
-std::array<float,2>{0.611560285f, 0.676653743f},
-std::array<float,2>{0.493764251f, 0.378668934f},
-std::array<float,2>{0.805412948f, 0.0761079416f},
-std::array<float,2>{0.123582751f, 0.930288255f},
-std::array<float,2>{0.979872763f, 0.801848292f},
-std::array<float,2>{0.205193877f, 0.236869857f},
-std::array<float,2>{0.679738641f, 0.272921532f},
-std::array<float,2>{0.299857467f, 0.594244063f},
-std::array<float,2>{0.731199324f, 0.992708743f},
-std::array<float,2>{0.361071229f, 0.0377640836f},
-std::array<float,2>{0.894323766f, 0.442345321f},
-std::array<float,2>{0.129591599f, 0.70051074f},
-std::array<float,2>{0.870523214f, 0.532125831f},
-std::array<float,2>{0.0259960629f, 0.334742188f},
-std::array<float,2>{0.527759671f, 0.163153484f},
-std::array<float,2>{0.411660612f, 0.822709024f},
-std::array<float,2>{0.580356479f, 0.606143117f},
-std::array<float,2>{0.460931897f, 0.273911238f},
-std::array<float,2>{0.754220009f, 0.243767038f},
-std::array<float,2>{0.0840331465f, 0.808838904f},
-std::array<float,2>{0.947491646f, 0.927209675f},
-std::array<float,2>{0.218823195f, 0.0692207292f},
-std::array<float,2>{0.653600931f, 0.384518445f},
-std::array<float,2>{0.273572057f, 0.682938099f},
-std::array<float,2>{0.715033233f, 0.81266433f},
-std::array<float,2>{0.312539309f, 0.168446213f},
-std::array<float,2>{0.926772952f, 0.338594556f},
-std::array<float,2>{0.158574641f, 0.542892575f},
-std::array<float,2>{0.827487051f, 0.69308877f},
-std::array<float,2>{0.0486885272f, 0.449648201f},
-std::array<float,2>{0.54211241f, 0.0401811115f},
-std::array<float,2>{0.390714645f, 0.987618923f},
-std::array<float,2>{0.67609936f, 0.643845975f},
-std::array<float,2>{0.309389979f, 0.407414973f},
-std::array<float,2>{0.971759558f, 0.120319374f},
-std::array<float,2>{0.215112954f, 0.885539174f},
-std::array<float,2>{0.798898578f, 0.752498686f},
-std::array<float,2>{0.114173338f, 0.202640221f},
-std::array<float,2>{0.624045432f, 0.291465342f},
-std::array<float,2>{0.48824352f, 0.581245005f},
-std::array<float,2>{0.517922997f, 0.953775883f},
-std::array<float,2>{0.419034511f, 0.0169665851f},
-std::array<float,2>{0.862951159f, 0.472165436f},
-std::array<float,2>{0.0185052771f, 0.749286056f},
-std::array<float,2>{0.905152559f, 0.505734921f},
-std::array<float,2>{0.136765003f, 0.360252321f},
-std::array<float,2>{0.720548034f, 0.140480071f},
-std::array<float,2>{0.36797601f, 0.86383754f},
-std::array<float,2>{0.747179687f, 0.55787617f},
-std::array<float,2>{0.350300193f, 0.313422084f},
-std::array<float,2>{0.878501534f, 0.183380783f},
-std::array<float,2>{0.140913114f, 0.833648264f},
-std::array<float,2>{0.850518882f, 0.973662853f},
-std::array<float,2>{0.0120533723f, 0.0509419255f},
-std::array<float,2>{0.505288124f, 0.46644491f},
-std::array<float,2>{0.429476202f, 0.714207888f},
-std::array<float,2>{0.60453552f, 0.795932472f},
-std::array<float,2>{0.471149892f, 0.232062727f},
-std::array<float,2>{0.792124391f, 0.252182305f},
-std::array<float,2>{0.106652796f, 0.619524598f},
-std::array<float,2>{0.991745412f, 0.666589797f},
-std::array<float,2>{0.195575789f, 0.403854102f},
-std::array<float,2>{0.658889651f, 0.0886099041f},
-std::array<float,2>{0.287682742f, 0.914960206f},
-std::array<float,2>{0.561676085f, 0.733274519f},
-std::array<float,2>{0.380833298f, 0.485452324f},
-std::array<float,2>{0.835668743f, 0.00063262647f},
-std::array<float,2>{0.041288536f, 0.946493268f},
-std::array<float,2>{0.921243668f, 0.856882155f},
-std::array<float,2>{0.180701762f, 0.151194736f},
-std::array<float,2>{0.696610928f, 0.350668252f},
-std::array<float,2>{0.337360978f, 0.517667353f},
-std::array<float,2>{0.634570181f, 0.897756636f},
-std::array<float,2>{0.26224491f, 0.097093083f},
-std::array<float,2>{0.953802168f, 0.423466116f},
-std::array<float,2>{0.238424763f, 0.635479629f},
-std::array<float,2>{0.769300818f, 0.576547444f},
-std::array<float,2>{0.0714883581f, 0.308049262f},
-std::array<float,2>{0.57766819f, 0.21789892f},
-std::array<float,2>{0.44938311f, 0.766020358f},
-std::array<float,2>{0.543000937f, 0.566636086f},
-std::array<float,2>{0.395721763f, 0.301693618f},
-std::array<float,2>{0.820932508f, 0.208042547f},
-std::array<float,2>{0.0535328723f, 0.773977816f},
-std::array<float,2>{0.924771488f, 0.90331775f},
-std::array<float,2>{0.162527084f, 0.105654165f},
-std::array<float,2>{0.711477816f, 0.430831164f},
-std::array<float,2>{0.317325413f, 0.627163649f},
-std::array<float,2>{0.649868548f, 0.847687423f},
-std::array<float,2>{0.279791534f, 0.144734576f},
-std::array<float,2>{0.952881515f, 0.351899028f},
-std::array<float,2>{0.22329925f, 0.52414155f},
-std::array<float,2>{0.751378715f, 0.724716187f},
-std::array<float,2>{0.0804423913f, 0.499460578f},
-std::array<float,2>{0.582846045f, 0.00885957573f},
-std::array<float,2>{0.455921233f, 0.944679797f},
-std::array<float,2>{0.72520262f, 0.657460749f},
-std::array<float,2>{0.371405393f, 0.395081788f},
-std::array<float,2>{0.898877621f, 0.085431464f},
-std::array<float,2>{0.135717273f, 0.910653472f},
-std::array<float,2>{0.867011786f, 0.785067618f},
-std::array<float,2>{0.0201477837f, 0.224620327f},
-std::array<float,2>{0.52005893f, 0.259057611f},
-std::array<float,2>{0.416849345f, 0.616209388f},
-std::array<float,2>{0.620544434f, 0.978257358f},
-std::array<float,2>{0.488577753f, 0.0567138046f},
-std::array<float,2>{0.804219604f, 0.459652454f},
-std::array<float,2>{0.110487938f, 0.707807779f},
-std::array<float,2>{0.975487113f, 0.553993165f},
-std::array<float,2>{0.212162495f, 0.322048843f},
-std::array<float,2>{0.673451722f, 0.175287053f},
-std::array<float,2>{0.305381f, 0.838817775f},
-std::array<float,2>{0.661740541f, 0.508025944f},
-std::array<float,2>{0.283766568f, 0.373026907f},
-std::array<float,2>{0.986861229f, 0.131672189f},
-std::array<float,2>{0.19982852f, 0.872220635f},
-std::array<float,2>{0.795349717f, 0.963718355f},
-std::array<float,2>{0.102826267f, 0.0286550019f},
-std::array<float,2>{0.60581398f, 0.480764329f},
-std::array<float,2>{0.475211203f, 0.740553081f},
-std::array<float,2>{0.503168404f, 0.757890284f},
-std::array<float,2>{0.423694164f, 0.19070448f},
-std::array<float,2>{0.847522616f, 0.28230238f},
-std::array<float,2>{0.00946241803f, 0.590504408f},
-std::array<float,2>{0.881801665f, 0.65299046f},
-std::array<float,2>{0.148021132f, 0.41602692f},
-std::array<float,2>{0.742550552f, 0.115894049f},
-std::array<float,2>{0.344934523f, 0.875748336f},
-std::array<float,2>{0.57251972f, 0.69841212f},
-std::array<float,2>{0.445411503f, 0.438203871f},
-std::array<float,2>{0.773118973f, 0.0318725407f},
-std::array<float,2>{0.0743223727f, 0.998733759f},
-std::array<float,2>{0.960695207f, 0.824656367f},
-std::array<float,2>{0.235662192f, 0.159515753f},
-std::array<float,2>{0.639005303f, 0.328465164f},
-std::array<float,2>{0.258384079f, 0.535874486f},
-std::array<float,2>{0.702794492f, 0.933644295f},
-std::array<float,2>{0.340690196f, 0.0709126666f},
-std::array<float,2>{0.914561808f, 0.38240394f},
-std::array<float,2>{0.184267402f, 0.674015522f},
-std::array<float,2>{0.828280866f, 0.599121511f},
-std::array<float,2>{0.0435462594f, 0.267830193f},
-std::array<float,2>{0.554952979f, 0.241217896f},
-std::array<float,2>{0.378216952f, 0.797505498f},
-std::array<float,2>{0.597515404f, 0.544194639f},
-std::array<float,2>{0.479026705f, 0.34178409f},
-std::array<float,2>{0.785199344f, 0.164373741f},
-std::array<float,2>{0.0984329507f, 0.81852895f},
-std::array<float,2>{0.996758521f, 0.988472223f},
-std::array<float,2>{0.194064483f, 0.0467881598f},
-std::array<float,2>{0.66421473f, 0.447591126f},
-std::array<float,2>{0.293595344f, 0.689300776f},
-std::array<float,2>{0.73787111f, 0.807194829f},
-std::array<float,2>{0.354210794f, 0.247595772f},
-std::array<float,2>{0.887847245f, 0.279161006f},
-std::array<float,2>{0.156002685f, 0.602854848f},
-std::array<float,2>{0.859120488f, 0.683669448f},
-std::array<float,2>{0.000427101098f, 0.389996022f},
-std::array<float,2>{0.510028958f, 0.0631038919f},
-std::array<float,2>{0.42999056f, 0.925026357f},
-std::array<float,2>{0.629684806f, 0.745569706f},
-std::array<float,2>{0.253529161f, 0.475496113f},
-std::array<float,2>{0.962633133f, 0.0212319605f},
-std::array<float,2>{0.245913833f, 0.957979381f},
-std::array<float,2>{0.774849236f, 0.860144556f},
-std::array<float,2>{0.0659028739f, 0.134021118f},
-std::array<float,2>{0.570141792f, 0.365685463f},
-std::array<float,2>{0.439011246f, 0.500415564f},
-std::array<float,2>{0.551755726f, 0.888621926f},
-std::array<float,2>{0.387490481f, 0.123298578f},
-std::array<float,2>{0.839592636f, 0.413186222f},
-std::array<float,2>{0.0387025028f, 0.646849334f},
-std::array<float,2>{0.909792662f, 0.585612774f},
-std::array<float,2>{0.178530142f, 0.295628101f},
-std::array<float,2>{0.693857491f, 0.196539402f},
-std::array<float,2>{0.33513853f, 0.755710304f},
-std::array<float,2>{0.705467641f, 0.622063041f},
-std::array<float,2>{0.323506206f, 0.255987138f},
-std::array<float,2>{0.931870282f, 0.226582766f},
-std::array<float,2>{0.16800797f, 0.792474985f},
-std::array<float,2>{0.813663185f, 0.920705736f},
-std::array<float,2>{0.0575148538f, 0.0927303731f},
-std::array<float,2>{0.533778846f, 0.398924708f},
-std::array<float,2>{0.404857993f, 0.66798526f},
-std::array<float,2>{0.589881539f, 0.830627143f},
-std::array<float,2>{0.461900234f, 0.186904296f},
-std::array<float,2>{0.763003588f, 0.317170024f},
-std::array<float,2>{0.0910459831f, 0.5617221f},
-std::array<float,2>{0.938898325f, 0.716555476f},
-std::array<float,2>{0.233526364f, 0.462417722f},
-std::array<float,2>{0.644558072f, 0.0506367497f},
-std::array<float,2>{0.267511398f, 0.969555199f},
-std::array<float,2>{0.526607931f, 0.637647331f},
-std::array<float,2>{0.410069078f, 0.426606715f},
-std::array<float,2>{0.874995708f, 0.100400589f},
-std::array<float,2>{0.0277622957f, 0.89277792f},
-std::array<float,2>{0.898284674f, 0.773431361f},
-std::array<float,2>{0.126316413f, 0.213732392f},
-std::array<float,2>{0.726838648f, 0.312004745f},
-std::array<float,2>{0.364597142f, 0.573213637f},
-std::array<float,2>{0.686148524f, 0.951804757f},
-std::array<float,2>{0.303644091f, 0.00494357897f},
-std::array<float,2>{0.981376946f, 0.491585582f},
-std::array<float,2>{0.208886608f, 0.729086399f},
-std::array<float,2>{0.811975479f, 0.521046042f},
-std::array<float,2>{0.120131314f, 0.344058156f},
-std::array<float,2>{0.613405645f, 0.153820947f},
-std::array<float,2>{0.497602761f, 0.85375911f},
-std::array<float,2>{0.547438979f, 0.549957037f},
-std::array<float,2>{0.382934421f, 0.325250179f},
-std::array<float,2>{0.843208194f, 0.178435579f},
-std::array<float,2>{0.0344731025f, 0.840188265f},
-std::array<float,2>{0.911284924f, 0.980834544f},
-std::array<float,2>{0.175443009f, 0.0620252155f},
-std::array<float,2>{0.690071344f, 0.456118613f},
-std::array<float,2>{0.330626875f, 0.706102788f},
-std::array<float,2>{0.625482917f, 0.785324812f},
-std::array<float,2>{0.254796743f, 0.218990803f},
-std::array<float,2>{0.966572464f, 0.265515119f},
-std::array<float,2>{0.249417707f, 0.610760987f},
-std::array<float,2>{0.7802881f, 0.663720012f},
-std::array<float,2>{0.0696555153f, 0.394120276f},
-std::array<float,2>{0.56507802f, 0.0784125105f},
-std::array<float,2>{0.442051739f, 0.908309758f},
-std::array<float,2>{0.740909517f, 0.721629202f},
-std::array<float,2>{0.357868671f, 0.495595962f},
-std::array<float,2>{0.884405673f, 0.0144733833f},
-std::array<float,2>{0.150834933f, 0.939770222f},
-std::array<float,2>{0.855092883f, 0.844746947f},
-std::array<float,2>{0.00397271151f, 0.141807586f},
-std::array<float,2>{0.511919916f, 0.357084811f},
-std::array<float,2>{0.434277415f, 0.529116511f},
-std::array<float,2>{0.601449192f, 0.901119113f},
-std::array<float,2>{0.484358132f, 0.104234867f},
-std::array<float,2>{0.783762991f, 0.435987532f},
-std::array<float,2>{0.094566375f, 0.630367339f},
-std::array<float,2>{0.992578089f, 0.56471628f},
-std::array<float,2>{0.188771933f, 0.29803735f},
-std::array<float,2>{0.671494842f, 0.20573701f},
-std::array<float,2>{0.289285958f, 0.778367937f},
-std::array<float,2>{0.682162464f, 0.595921695f},
-std::array<float,2>{0.298239052f, 0.270986736f},
-std::array<float,2>{0.976581335f, 0.23576887f},
-std::array<float,2>{0.204604849f, 0.802740991f},
-std::array<float,2>{0.808077335f, 0.932021022f},
-std::array<float,2>{0.122681804f, 0.076747939f},
-std::array<float,2>{0.61087358f, 0.376187772f},
-std::array<float,2>{0.4942092f, 0.679105699f},
-std::array<float,2>{0.530603945f, 0.820313215f},
-std::array<float,2>{0.413868517f, 0.16083838f},
-std::array<float,2>{0.867830157f, 0.333162785f},
-std::array<float,2>{0.023775341f, 0.533609331f},
-std::array<float,2>{0.892425358f, 0.702390969f},
-std::array<float,2>{0.131070301f, 0.44398278f},
-std::array<float,2>{0.733818352f, 0.0361114778f},
-std::array<float,2>{0.36200735f, 0.995821059f},
-std::array<float,2>{0.58604759f, 0.650002301f},
-std::array<float,2>{0.468042701f, 0.420414805f},
-std::array<float,2>{0.759498894f, 0.11093805f},
-std::array<float,2>{0.0896019414f, 0.882740915f},
-std::array<float,2>{0.943830252f, 0.765522778f},
-std::array<float,2>{0.229619294f, 0.194784522f},
-std::array<float,2>{0.641083002f, 0.286904722f},
-std::array<float,2>{0.269738138f, 0.589773297f},
-std::array<float,2>{0.708163261f, 0.967109978f},
-std::array<float,2>{0.32457298f, 0.0241572689f},
-std::array<float,2>{0.934766412f, 0.476824045f},
-std::array<float,2>{0.164175302f, 0.736493647f},
-std::array<float,2>{0.816934049f, 0.513056219f},
-std::array<float,2>{0.0621793456f, 0.368383974f},
-std::array<float,2>{0.537865937f, 0.125074148f},
-std::array<float,2>{0.400232345f, 0.870981336f},
-std::array<float,2>{0.622276843f, 0.57821697f},
-std::array<float,2>{0.485662848f, 0.290383279f},
-std::array<float,2>{0.797525644f, 0.200186655f},
-std::array<float,2>{0.116711318f, 0.750216901f},
-std::array<float,2>{0.969239891f, 0.884688437f},
-std::array<float,2>{0.217585638f, 0.118320689f},
-std::array<float,2>{0.677760363f, 0.40857029f},
-std::array<float,2>{0.311478198f, 0.640959501f},
-std::array<float,2>{0.721694112f, 0.867121875f},
-std::array<float,2>{0.369906157f, 0.138019204f},
-std::array<float,2>{0.902366877f, 0.363250971f},
-std::array<float,2>{0.139849588f, 0.507072031f},
-std::array<float,2>{0.860449374f, 0.746805966f},
-std::array<float,2>{0.0166648328f, 0.47029388f},
-std::array<float,2>{0.516937256f, 0.0189771671f},
-std::array<float,2>{0.420163006f, 0.955605149f},
-std::array<float,2>{0.6545856f, 0.680007577f},
-std::array<float,2>{0.276580691f, 0.386298388f},
-std::array<float,2>{0.945762932f, 0.0679226741f},
-std::array<float,2>{0.220869437f, 0.928411007f},
-std::array<float,2>{0.75747174f, 0.811606407f},
-std::array<float,2>{0.0833715871f, 0.245011896f},
-std::array<float,2>{0.578479826f, 0.27574721f},
-std::array<float,2>{0.458397359f, 0.608668804f},
-std::array<float,2>{0.539829433f, 0.985096514f},
-std::array<float,2>{0.393749803f, 0.0420947559f},
-std::array<float,2>{0.825138628f, 0.452183604f},
-std::array<float,2>{0.0490106307f, 0.694405437f},
-std::array<float,2>{0.927743912f, 0.539694607f},
-std::array<float,2>{0.156646311f, 0.336786091f},
-std::array<float,2>{0.718034744f, 0.170351967f},
-std::array<float,2>{0.314603537f, 0.816372395f},
-std::array<float,2>{0.697523355f, 0.516367316f},
-std::array<float,2>{0.339098334f, 0.348777175f},
-std::array<float,2>{0.918153346f, 0.148869395f},
-std::array<float,2>{0.182921007f, 0.857590437f},
-std::array<float,2>{0.833151519f, 0.949005902f},
-std::array<float,2>{0.0402883738f, 0.00360142277f},
-std::array<float,2>{0.56042695f, 0.486341506f},
-std::array<float,2>{0.381468415f, 0.731513739f},
-std::array<float,2>{0.575721025f, 0.768560648f},
-std::array<float,2>{0.452674717f, 0.215606198f},
-std::array<float,2>{0.76663363f, 0.305987924f},
-std::array<float,2>{0.0737392455f, 0.574879825f},
-std::array<float,2>{0.955409706f, 0.633061647f},
-std::array<float,2>{0.240425676f, 0.425168902f},
-std::array<float,2>{0.636636615f, 0.0941516459f},
-std::array<float,2>{0.265152574f, 0.89617753f},
-std::array<float,2>{0.505968988f, 0.712575376f},
-std::array<float,2>{0.426597297f, 0.467159837f},
-std::array<float,2>{0.847918987f, 0.0533732139f},
-std::array<float,2>{0.0152638126f, 0.975506544f},
-std::array<float,2>{0.875880837f, 0.835060477f},
-std::array<float,2>{0.143479809f, 0.180667251f},
-std::array<float,2>{0.74811101f, 0.316031128f},
-std::array<float,2>{0.348345757f, 0.555835485f},
-std::array<float,2>{0.658174515f, 0.91613394f},
-std::array<float,2>{0.287032306f, 0.0868815109f},
-std::array<float,2>{0.989187479f, 0.404554725f},
-std::array<float,2>{0.197616011f, 0.665552676f},
-std::array<float,2>{0.79026109f, 0.618173301f},
-std::array<float,2>{0.108243577f, 0.251264572f},
-std::array<float,2>{0.602167189f, 0.232792735f},
-std::array<float,2>{0.47056061f, 0.79368788f},
-std::array<float,2>{0.522939622f, 0.614492357f},
-std::array<float,2>{0.414947808f, 0.261306465f},
-std::array<float,2>{0.864849806f, 0.223025084f},
-std::array<float,2>{0.0226135496f, 0.782148421f},
-std::array<float,2>{0.901567876f, 0.913120866f},
-std::array<float,2>{0.133464247f, 0.0827716216f},
-std::array<float,2>{0.724529684f, 0.397204876f},
-std::array<float,2>{0.374601781f, 0.660137117f},
-std::array<float,2>{0.674866438f, 0.83683908f},
-std::array<float,2>{0.307749063f, 0.173047066f},
-std::array<float,2>{0.972821295f, 0.324055403f},
-std::array<float,2>{0.21443148f, 0.55125922f},
-std::array<float,2>{0.801639616f, 0.709276021f},
-std::array<float,2>{0.111820944f, 0.457378834f},
-std::array<float,2>{0.618937373f, 0.0552079082f},
-std::array<float,2>{0.491021216f, 0.979335427f},
-std::array<float,2>{0.713286519f, 0.625650108f},
-std::array<float,2>{0.320054263f, 0.43262282f},
-std::array<float,2>{0.922762811f, 0.109345347f},
-std::array<float,2>{0.160322428f, 0.905963898f},
-std::array<float,2>{0.822859585f, 0.775523841f},
-std::array<float,2>{0.0514298081f, 0.210628614f},
-std::array<float,2>{0.546042264f, 0.303653747f},
-std::array<float,2>{0.39811185f, 0.569671154f},
-std::array<float,2>{0.585526943f, 0.943157554f},
-std::array<float,2>{0.454181582f, 0.00987816975f},
-std::array<float,2>{0.752058566f, 0.497828782f},
-std::array<float,2>{0.0782617256f, 0.723568499f},
-std::array<float,2>{0.950862765f, 0.526358128f},
-std::array<float,2>{0.226018757f, 0.353948623f},
-std::array<float,2>{0.652089179f, 0.146493584f},
-std::array<float,2>{0.27763626f, 0.851558208f},
-std::array<float,2>{0.637750864f, 0.538081646f},
-std::array<float,2>{0.260850459f, 0.331794798f},
-std::array<float,2>{0.957897067f, 0.156657219f},
-std::array<float,2>{0.237826213f, 0.827848256f},
-std::array<float,2>{0.770384014f, 0.996970713f},
-std::array<float,2>{0.0774466917f, 0.0345601365f},
-std::array<float,2>{0.571595013f, 0.441239893f},
-std::array<float,2>{0.447631359f, 0.696641505f},
-std::array<float,2>{0.55723393f, 0.79989028f},
-std::array<float,2>{0.375831872f, 0.238935038f},
-std::array<float,2>{0.831622601f, 0.267105252f},
-std::array<float,2>{0.045209568f, 0.600132346f},
-std::array<float,2>{0.9162063f, 0.672489941f},
-std::array<float,2>{0.186045632f, 0.379507452f},
-std::array<float,2>{0.700401366f, 0.0728632957f},
-std::array<float,2>{0.343683571f, 0.935695946f},
-std::array<float,2>{0.608025253f, 0.738583982f},
-std::array<float,2>{0.473880827f, 0.483110994f},
-std::array<float,2>{0.794574857f, 0.0306753535f},
-std::array<float,2>{0.104255401f, 0.961397231f},
-std::array<float,2>{0.985265613f, 0.873873174f},
-std::array<float,2>{0.201837853f, 0.129966393f},
-std::array<float,2>{0.662855446f, 0.374602437f},
-std::array<float,2>{0.282805949f, 0.510412276f},
-std::array<float,2>{0.744366109f, 0.878650963f},
-std::array<float,2>{0.347201288f, 0.113760233f},
-std::array<float,2>{0.879525542f, 0.415714681f},
-std::array<float,2>{0.144615099f, 0.654533029f},
-std::array<float,2>{0.844173849f, 0.592861354f},
-std::array<float,2>{0.0111230202f, 0.283310026f},
-std::array<float,2>{0.500407875f, 0.188847616f},
-std::array<float,2>{0.425387621f, 0.76082778f},
-std::array<float,2>{0.567613363f, 0.503402829f},
-std::array<float,2>{0.441191673f, 0.365046978f},
-std::array<float,2>{0.776298463f, 0.135081112f},
-std::array<float,2>{0.0627240688f, 0.861967564f},
-std::array<float,2>{0.964725971f, 0.960534692f},
-std::array<float,2>{0.243987769f, 0.0217061359f},
-std::array<float,2>{0.631437898f, 0.473423183f},
-std::array<float,2>{0.251709044f, 0.743158579f},
-std::array<float,2>{0.691433549f, 0.757394969f},
-std::array<float,2>{0.332369596f, 0.19786793f},
-std::array<float,2>{0.907135785f, 0.293118536f},
-std::array<float,2>{0.177363649f, 0.583934486f},
-std::array<float,2>{0.837509632f, 0.645557046f},
-std::array<float,2>{0.0352141857f, 0.410955369f},
-std::array<float,2>{0.553909838f, 0.122717135f},
-std::array<float,2>{0.389178991f, 0.890590847f},
-std::array<float,2>{0.667160809f, 0.69136405f},
-std::array<float,2>{0.295927018f, 0.446415186f},
-std::array<float,2>{0.998817801f, 0.0439348109f},
-std::array<float,2>{0.192963153f, 0.99164921f},
-std::array<float,2>{0.787921309f, 0.817606807f},
-std::array<float,2>{0.100135587f, 0.167948291f},
-std::array<float,2>{0.594925046f, 0.343012601f},
-std::array<float,2>{0.47730574f, 0.546178758f},
-std::array<float,2>{0.508146405f, 0.92274636f},
-std::array<float,2>{0.433305115f, 0.0649763197f},
-std::array<float,2>{0.856612682f, 0.387118578f},
-std::array<float,2>{0.00331950234f, 0.686472118f},
-std::array<float,2>{0.889171243f, 0.603878319f},
-std::array<float,2>{0.154042825f, 0.281230539f},
-std::array<float,2>{0.735387921f, 0.249919698f},
-std::array<float,2>{0.352103025f, 0.805006981f},
-std::array<float,2>{0.729309499f, 0.571718872f},
-std::array<float,2>{0.366365969f, 0.310155064f},
-std::array<float,2>{0.896437049f, 0.21187453f},
-std::array<float,2>{0.12746942f, 0.771227002f},
-std::array<float,2>{0.871152222f, 0.892356873f},
-std::array<float,2>{0.030076066f, 0.0980538651f},
-std::array<float,2>{0.524652541f, 0.429157943f},
-std::array<float,2>{0.408091843f, 0.638832033f},
-std::array<float,2>{0.615919173f, 0.852376997f},
-std::array<float,2>{0.49988988f, 0.155490413f},
-std::array<float,2>{0.809628069f, 0.347596377f},
-std::array<float,2>{0.118482471f, 0.522687674f},
-std::array<float,2>{0.983356953f, 0.728425026f},
-std::array<float,2>{0.210725054f, 0.488494784f},
-std::array<float,2>{0.685202539f, 0.00617050426f},
-std::array<float,2>{0.302188396f, 0.951151669f},
-std::array<float,2>{0.532519162f, 0.670371592f},
-std::array<float,2>{0.402815551f, 0.401785523f},
-std::array<float,2>{0.815666378f, 0.0912091732f},
-std::array<float,2>{0.0550200269f, 0.918238461f},
-std::array<float,2>{0.931350112f, 0.789635062f},
-std::array<float,2>{0.170890674f, 0.229895085f},
-std::array<float,2>{0.705008268f, 0.255359292f},
-std::array<float,2>{0.321364999f, 0.624238193f},
-std::array<float,2>{0.646882296f, 0.971090257f},
-std::array<float,2>{0.268148959f, 0.0483050384f},
-std::array<float,2>{0.940567434f, 0.464763224f},
-std::array<float,2>{0.23095046f, 0.718264341f},
-std::array<float,2>{0.765176713f, 0.559951782f},
-std::array<float,2>{0.0937249884f, 0.318940431f},
-std::array<float,2>{0.592494965f, 0.183642983f},
-std::array<float,2>{0.463727236f, 0.828353882f},
-std::array<float,2>{0.529256523f, 0.53436321f},
-std::array<float,2>{0.410218984f, 0.332579136f},
-std::array<float,2>{0.869366348f, 0.161164477f},
-std::array<float,2>{0.0268999785f, 0.821672618f},
-std::array<float,2>{0.8935076f, 0.99499476f},
-std::array<float,2>{0.130829856f, 0.0365334339f},
-std::array<float,2>{0.73228538f, 0.444903642f},
-std::array<float,2>{0.360252768f, 0.701829493f},
-std::array<float,2>{0.680918634f, 0.804088891f},
-std::array<float,2>{0.299178302f, 0.234862164f},
-std::array<float,2>{0.97938472f, 0.270440131f},
-std::array<float,2>{0.206832528f, 0.597652614f},
-std::array<float,2>{0.806050777f, 0.677739561f},
-std::array<float,2>{0.124117702f, 0.375597745f},
-std::array<float,2>{0.613042116f, 0.0775547698f},
-std::array<float,2>{0.493111044f, 0.93349427f},
-std::array<float,2>{0.710936248f, 0.738054097f},
-std::array<float,2>{0.328107506f, 0.478192121f},
-std::array<float,2>{0.935764551f, 0.0252957065f},
-std::array<float,2>{0.167861253f, 0.9678666f},
-std::array<float,2>{0.818432391f, 0.869541228f},
-std::array<float,2>{0.0603200532f, 0.126820192f},
-std::array<float,2>{0.536745489f, 0.368057579f},
-std::array<float,2>{0.401284099f, 0.511941016f},
-std::array<float,2>{0.58811152f, 0.881327569f},
-std::array<float,2>{0.465359747f, 0.109709375f},
-std::array<float,2>{0.760296524f, 0.420950174f},
-std::array<float,2>{0.0876236036f, 0.648495018f},
-std::array<float,2>{0.942198873f, 0.588526189f},
-std::array<float,2>{0.228301004f, 0.285628527f},
-std::array<float,2>{0.643431902f, 0.194046721f},
-std::array<float,2>{0.271823645f, 0.764028609f},
-std::array<float,2>{0.627374411f, 0.609937251f},
-std::array<float,2>{0.257680178f, 0.264147699f},
-std::array<float,2>{0.967062831f, 0.220215216f},
-std::array<float,2>{0.247493804f, 0.786658168f},
-std::array<float,2>{0.777624428f, 0.910055101f},
-std::array<float,2>{0.0673827007f, 0.0791779682f},
-std::array<float,2>{0.564185739f, 0.392637074f},
-std::array<float,2>{0.443580002f, 0.662162483f},
-std::array<float,2>{0.550285041f, 0.841409087f},
-std::array<float,2>{0.384927243f, 0.179610088f},
-std::array<float,2>{0.841507733f, 0.324605793f},
-std::array<float,2>{0.031700097f, 0.549548626f},
-std::array<float,2>{0.913744152f, 0.705485582f},
-std::array<float,2>{0.172730416f, 0.455301821f},
-std::array<float,2>{0.688250422f, 0.060864538f},
-std::array<float,2>{0.328998029f, 0.981615424f},
-std::array<float,2>{0.598607779f, 0.628996074f},
-std::array<float,2>{0.481820673f, 0.43677485f},
-std::array<float,2>{0.782532811f, 0.104697302f},
-std::array<float,2>{0.0966019705f, 0.901435673f},
-std::array<float,2>{0.994770288f, 0.778306544f},
-std::array<float,2>{0.19118157f, 0.206708997f},
-std::array<float,2>{0.669748187f, 0.297473967f},
-std::array<float,2>{0.29264015f, 0.566394866f},
-std::array<float,2>{0.739405572f, 0.940543473f},
-std::array<float,2>{0.356700867f, 0.01467383f},
-std::array<float,2>{0.886432171f, 0.494279772f},
-std::array<float,2>{0.149036169f, 0.722580075f},
-std::array<float,2>{0.852668166f, 0.528042793f},
-std::array<float,2>{0.00615146384f, 0.355818719f},
-std::array<float,2>{0.51502502f, 0.141096562f},
-std::array<float,2>{0.435818225f, 0.844530761f},
-std::array<float,2>{0.576480746f, 0.575639427f},
-std::array<float,2>{0.45111075f, 0.305458307f},
-std::array<float,2>{0.768426657f, 0.21645008f},
-std::array<float,2>{0.0711910799f, 0.768317461f},
-std::array<float,2>{0.954675615f, 0.895276189f},
-std::array<float,2>{0.240036786f, 0.0954389051f},
-std::array<float,2>{0.633219004f, 0.423885435f},
-std::array<float,2>{0.263507187f, 0.634001493f},
-std::array<float,2>{0.696066737f, 0.858996034f},
-std::array<float,2>{0.336537033f, 0.149857119f},
-std::array<float,2>{0.920636952f, 0.348188072f},
-std::array<float,2>{0.179796994f, 0.517399132f},
-std::array<float,2>{0.834727108f, 0.730960727f},
-std::array<float,2>{0.042237822f, 0.487315893f},
-std::array<float,2>{0.560626328f, 0.00212924485f},
-std::array<float,2>{0.379293203f, 0.947946608f},
-std::array<float,2>{0.66011411f, 0.664767146f},
-std::array<float,2>{0.288265079f, 0.405275971f},
-std::array<float,2>{0.990445316f, 0.0872395635f},
-std::array<float,2>{0.196896926f, 0.9178316f},
-std::array<float,2>{0.791698873f, 0.794130862f},
-std::array<float,2>{0.105719425f, 0.233945176f},
-std::array<float,2>{0.603695273f, 0.250186205f},
-std::array<float,2>{0.472584605f, 0.617901444f},
-std::array<float,2>{0.5048002f, 0.975797117f},
-std::array<float,2>{0.427974194f, 0.0542082116f},
-std::array<float,2>{0.85147804f, 0.468076587f},
-std::array<float,2>{0.0129287429f, 0.711093724f},
-std::array<float,2>{0.877810061f, 0.554888785f},
-std::array<float,2>{0.142507061f, 0.314700335f},
-std::array<float,2>{0.746662736f, 0.179701552f},
-std::array<float,2>{0.350774109f, 0.834827065f},
-std::array<float,2>{0.719558775f, 0.506485641f},
-std::array<float,2>{0.368957937f, 0.362161458f},
-std::array<float,2>{0.906194985f, 0.137035623f},
-std::array<float,2>{0.138086602f, 0.866086006f},
-std::array<float,2>{0.862074375f, 0.95674485f},
-std::array<float,2>{0.0188968927f, 0.0176428314f},
-std::array<float,2>{0.519149244f, 0.469612122f},
-std::array<float,2>{0.418447465f, 0.74778074f},
-std::array<float,2>{0.623129487f, 0.75194478f},
-std::array<float,2>{0.486863852f, 0.200415716f},
-std::array<float,2>{0.800454855f, 0.289439321f},
-std::array<float,2>{0.11502865f, 0.580056131f},
-std::array<float,2>{0.970823109f, 0.642175615f},
-std::array<float,2>{0.215930954f, 0.409324437f},
-std::array<float,2>{0.67715776f, 0.117753968f},
-std::array<float,2>{0.310155869f, 0.882837534f},
-std::array<float,2>{0.541445017f, 0.693371117f},
-std::array<float,2>{0.392065138f, 0.451373518f},
-std::array<float,2>{0.826485217f, 0.0415249094f},
-std::array<float,2>{0.0478053838f, 0.986028075f},
-std::array<float,2>{0.926665902f, 0.814587653f},
-std::array<float,2>{0.159935161f, 0.171574876f},
-std::array<float,2>{0.715821862f, 0.337289512f},
-std::array<float,2>{0.313593954f, 0.540475667f},
-std::array<float,2>{0.652563334f, 0.929237247f},
-std::array<float,2>{0.275253057f, 0.0668802783f},
-std::array<float,2>{0.949083686f, 0.385169923f},
-std::array<float,2>{0.219989926f, 0.681066096f},
-std::array<float,2>{0.755164027f, 0.607575834f},
-std::array<float,2>{0.0850227624f, 0.277090609f},
-std::array<float,2>{0.581104636f, 0.245209977f},
-std::array<float,2>{0.45991981f, 0.811476052f},
-std::array<float,2>{0.5564605f, 0.600733042f},
-std::array<float,2>{0.377687454f, 0.265775949f},
-std::array<float,2>{0.829410553f, 0.239663377f},
-std::array<float,2>{0.0441790447f, 0.799443483f},
-std::array<float,2>{0.915529191f, 0.937273681f},
-std::array<float,2>{0.185388938f, 0.0742059648f},
-std::array<float,2>{0.701705456f, 0.380306065f},
-std::array<float,2>{0.341307253f, 0.673731804f},
-std::array<float,2>{0.639684916f, 0.826526523f},
-std::array<float,2>{0.258789927f, 0.158107951f},
-std::array<float,2>{0.959343195f, 0.330731452f},
-std::array<float,2>{0.235260755f, 0.538798273f},
-std::array<float,2>{0.771892488f, 0.695900917f},
-std::array<float,2>{0.0760528818f, 0.439999044f},
-std::array<float,2>{0.573294163f, 0.0337554626f},
-std::array<float,2>{0.446715862f, 0.997736275f},
-std::array<float,2>{0.743275225f, 0.655796587f},
-std::array<float,2>{0.344051957f, 0.414099783f},
-std::array<float,2>{0.882546604f, 0.114567749f},
-std::array<float,2>{0.146813542f, 0.877341032f},
-std::array<float,2>{0.846101344f, 0.759846091f},
-std::array<float,2>{0.00871596858f, 0.187713012f},
-std::array<float,2>{0.502075076f, 0.28491354f},
-std::array<float,2>{0.422657102f, 0.592737377f},
-std::array<float,2>{0.606500328f, 0.962536156f},
-std::array<float,2>{0.475739539f, 0.0297944769f},
-std::array<float,2>{0.796550095f, 0.484074026f},
-std::array<float,2>{0.101839937f, 0.739397407f},
-std::array<float,2>{0.988125682f, 0.511361182f},
-std::array<float,2>{0.200436667f, 0.373197317f},
-std::array<float,2>{0.661079526f, 0.12936841f},
-std::array<float,2>{0.284185976f, 0.874338925f},
-std::array<float,2>{0.672153771f, 0.551808059f},
-std::array<float,2>{0.306135088f, 0.323080391f},
-std::array<float,2>{0.976504683f, 0.172339186f},
-std::array<float,2>{0.211166769f, 0.837781787f},
-std::array<float,2>{0.803504884f, 0.980295777f},
-std::array<float,2>{0.110012524f, 0.0563682877f},
-std::array<float,2>{0.619671822f, 0.458576888f},
-std::array<float,2>{0.489758998f, 0.710099339f},
-std::array<float,2>{0.52074033f, 0.782897949f},
-std::array<float,2>{0.417782634f, 0.223945305f},
-std::array<float,2>{0.865876734f, 0.259771943f},
-std::array<float,2>{0.0214122273f, 0.614037991f},
-std::array<float,2>{0.90011847f, 0.658705175f},
-std::array<float,2>{0.135765865f, 0.398055643f},
-std::array<float,2>{0.725902796f, 0.0838806406f},
-std::array<float,2>{0.372645229f, 0.912601352f},
-std::array<float,2>{0.583080113f, 0.724299371f},
-std::array<float,2>{0.456178665f, 0.496812344f},
-std::array<float,2>{0.75053066f, 0.0110802539f},
-std::array<float,2>{0.0815760642f, 0.941660464f},
-std::array<float,2>{0.951915503f, 0.849824667f},
-std::array<float,2>{0.224346325f, 0.147686213f},
-std::array<float,2>{0.649327159f, 0.354797155f},
-std::array<float,2>{0.281139016f, 0.526437044f},
-std::array<float,2>{0.712314546f, 0.904456437f},
-std::array<float,2>{0.31757921f, 0.108268984f},
-std::array<float,2>{0.925761163f, 0.431863934f},
-std::array<float,2>{0.163535714f, 0.626218617f},
-std::array<float,2>{0.821775138f, 0.568990588f},
-std::array<float,2>{0.0540806167f, 0.304383755f},
-std::array<float,2>{0.543985009f, 0.209655434f},
-std::array<float,2>{0.394563377f, 0.776493847f},
-std::array<float,2>{0.615028977f, 0.521723807f},
-std::array<float,2>{0.496636838f, 0.345733672f},
-std::array<float,2>{0.811175525f, 0.155164242f},
-std::array<float,2>{0.119915418f, 0.853314996f},
-std::array<float,2>{0.981982708f, 0.949628055f},
-std::array<float,2>{0.208003342f, 0.00735489978f},
-std::array<float,2>{0.686928689f, 0.489904881f},
-std::array<float,2>{0.304660231f, 0.727464318f},
-std::array<float,2>{0.728125036f, 0.770346701f},
-std::array<float,2>{0.363800019f, 0.212178618f},
-std::array<float,2>{0.896898031f, 0.309341758f},
-std::array<float,2>{0.125784695f, 0.570363224f},
-std::array<float,2>{0.873377681f, 0.640266001f},
-std::array<float,2>{0.0291776005f, 0.427787006f},
-std::array<float,2>{0.525582373f, 0.098732695f},
-std::array<float,2>{0.409117311f, 0.891343176f},
-std::array<float,2>{0.645656943f, 0.717027307f},
-std::array<float,2>{0.265663028f, 0.463692427f},
-std::array<float,2>{0.937575817f, 0.0473084599f},
-std::array<float,2>{0.232754767f, 0.972217679f},
-std::array<float,2>{0.761740267f, 0.829764128f},
-std::array<float,2>{0.090527311f, 0.184771746f},
-std::array<float,2>{0.591345668f, 0.320294052f},
-std::array<float,2>{0.461982876f, 0.558722258f},
-std::array<float,2>{0.534730256f, 0.919821322f},
-std::array<float,2>{0.40611726f, 0.089885436f},
-std::array<float,2>{0.81325382f, 0.400641382f},
-std::array<float,2>{0.0577528328f, 0.671450973f},
-std::array<float,2>{0.9333992f, 0.623589277f},
-std::array<float,2>{0.169059232f, 0.254290879f},
-std::array<float,2>{0.706542253f, 0.229241565f},
-std::array<float,2>{0.323013127f, 0.790494382f},
-std::array<float,2>{0.695043921f, 0.582033098f},
-std::array<float,2>{0.334853292f, 0.29416579f},
-std::array<float,2>{0.909112573f, 0.198755354f},
-std::array<float,2>{0.178716928f, 0.756290197f},
-std::array<float,2>{0.837994397f, 0.888963819f},
-std::array<float,2>{0.0376859717f, 0.121764369f},
-std::array<float,2>{0.552699566f, 0.412042379f},
-std::array<float,2>{0.388273239f, 0.645419538f},
-std::array<float,2>{0.569221675f, 0.86319375f},
-std::array<float,2>{0.438169748f, 0.136103854f},
-std::array<float,2>{0.773895681f, 0.36386463f},
-std::array<float,2>{0.0654182509f, 0.501999319f},
-std::array<float,2>{0.961722374f, 0.74369663f},
-std::array<float,2>{0.245106056f, 0.4738895f},
-std::array<float,2>{0.630688071f, 0.0228117332f},
-std::array<float,2>{0.252848029f, 0.959913373f},
-std::array<float,2>{0.51106292f, 0.687477052f},
-std::array<float,2>{0.431104898f, 0.387967408f},
-std::array<float,2>{0.857581437f, 0.0661132708f},
-std::array<float,2>{0.00179490342f, 0.92366153f},
-std::array<float,2>{0.887200058f, 0.80634582f},
-std::array<float,2>{0.154756323f, 0.248236865f},
-std::array<float,2>{0.736704826f, 0.279302329f},
-std::array<float,2>{0.354833722f, 0.604546964f},
-std::array<float,2>{0.665254891f, 0.991152704f},
-std::array<float,2>{0.29401049f, 0.0447408035f},
-std::array<float,2>{0.997141957f, 0.445440084f},
-std::array<float,2>{0.194858178f, 0.689707875f},
-std::array<float,2>{0.786758482f, 0.545613945f},
-std::array<float,2>{0.0995182171f, 0.342764348f},
-std::array<float,2>{0.596153915f, 0.166298628f},
-std::array<float,2>{0.479795307f, 0.816589296f},
-std::array<float,2>{0.538535357f, 0.515021026f},
-std::array<float,2>{0.39909935f, 0.370301723f},
-std::array<float,2>{0.817964375f, 0.128318176f},
-std::array<float,2>{0.0611922219f, 0.867851496f},
-std::array<float,2>{0.934428453f, 0.966427684f},
-std::array<float,2>{0.165162727f, 0.0263308454f},
-std::array<float,2>{0.707911551f, 0.48007071f},
-std::array<float,2>{0.325548977f, 0.735577106f},
-std::array<float,2>{0.642082334f, 0.763539791f},
-std::array<float,2>{0.271037042f, 0.191888064f},
-std::array<float,2>{0.944880903f, 0.288882911f},
-std::array<float,2>{0.229138017f, 0.587686479f},
-std::array<float,2>{0.758503318f, 0.650653601f},
-std::array<float,2>{0.0886242911f, 0.419067353f},
-std::array<float,2>{0.587548852f, 0.111810692f},
-std::array<float,2>{0.467014164f, 0.880555093f},
-std::array<float,2>{0.733288288f, 0.699748933f},
-std::array<float,2>{0.362340569f, 0.443342984f},
-std::array<float,2>{0.8909657f, 0.0381132141f},
-std::array<float,2>{0.131913528f, 0.993334949f},
-std::array<float,2>{0.868843853f, 0.82325989f},
-std::array<float,2>{0.0247236583f, 0.162545621f},
-std::array<float,2>{0.529816806f, 0.335072815f},
-std::array<float,2>{0.412599772f, 0.53235358f},
-std::array<float,2>{0.609517574f, 0.930801392f},
-std::array<float,2>{0.495558053f, 0.0747659057f},
-std::array<float,2>{0.807520807f, 0.377397537f},
-std::array<float,2>{0.121207677f, 0.67702502f},
-std::array<float,2>{0.977842331f, 0.595426321f},
-std::array<float,2>{0.203197479f, 0.271497071f},
-std::array<float,2>{0.68342793f, 0.237314031f},
-std::array<float,2>{0.297100276f, 0.801272452f},
-std::array<float,2>{0.670426309f, 0.563882113f},
-std::array<float,2>{0.290499389f, 0.299723536f},
-std::array<float,2>{0.993487775f, 0.204182938f},
-std::array<float,2>{0.187610701f, 0.779382944f},
-std::array<float,2>{0.784296215f, 0.89920795f},
-std::array<float,2>{0.0949071571f, 0.101645708f},
-std::array<float,2>{0.600123346f, 0.434672862f},
-std::array<float,2>{0.482667595f, 0.631854773f},
-std::array<float,2>{0.513606548f, 0.846170902f},
-std::array<float,2>{0.435201436f, 0.142796367f},
-std::array<float,2>{0.854469836f, 0.35832876f},
-std::array<float,2>{0.00541969389f, 0.529752374f},
-std::array<float,2>{0.882823229f, 0.71928364f},
-std::array<float,2>{0.151535466f, 0.493311644f},
-std::array<float,2>{0.741944432f, 0.0121258786f},
-std::array<float,2>{0.358921707f, 0.93894875f},
-std::array<float,2>{0.565966308f, 0.660853744f},
-std::array<float,2>{0.443149507f, 0.39256531f},
-std::array<float,2>{0.779538393f, 0.0808355063f},
-std::array<float,2>{0.068369031f, 0.906677663f},
-std::array<float,2>{0.965435803f, 0.788033962f},
-std::array<float,2>{0.248874724f, 0.221755594f},
-std::array<float,2>{0.626471877f, 0.263309717f},
-std::array<float,2>{0.254974067f, 0.611835957f},
-std::array<float,2>{0.690982699f, 0.984023631f},
-std::array<float,2>{0.33160162f, 0.0604351796f},
-std::array<float,2>{0.910884321f, 0.454493821f},
-std::array<float,2>{0.17465885f, 0.703759193f},
-std::array<float,2>{0.841982126f, 0.547473729f},
-std::array<float,2>{0.0335695073f, 0.327649683f},
-std::array<float,2>{0.548730969f, 0.176842958f},
-std::array<float,2>{0.384465992f, 0.842265189f},
-std::array<float,2>{0.603509247f, 0.620428801f},
-std::array<float,2>{0.468866587f, 0.253479242f},
-std::array<float,2>{0.789637625f, 0.2309874f},
-std::array<float,2>{0.108718604f, 0.795550287f},
-std::array<float,2>{0.989439368f, 0.915525615f},
-std::array<float,2>{0.198965594f, 0.0896423236f},
-std::array<float,2>{0.657081187f, 0.403240234f},
-std::array<float,2>{0.285834342f, 0.667815864f},
-std::array<float,2>{0.749772906f, 0.832855761f},
-std::array<float,2>{0.349265367f, 0.181896597f},
-std::array<float,2>{0.87690562f, 0.314149529f},
-std::array<float,2>{0.144523934f, 0.557085872f},
-std::array<float,2>{0.848891675f, 0.713294208f},
-std::array<float,2>{0.0140810376f, 0.465752721f},
-std::array<float,2>{0.50720197f, 0.0518991761f},
-std::array<float,2>{0.427133858f, 0.973522842f},
-std::array<float,2>{0.635464787f, 0.636473596f},
-std::array<float,2>{0.264383167f, 0.422228336f},
-std::array<float,2>{0.95610714f, 0.0961257145f},
-std::array<float,2>{0.241656497f, 0.896815717f},
-std::array<float,2>{0.7660411f, 0.767059743f},
-std::array<float,2>{0.0726174861f, 0.217311323f},
-std::array<float,2>{0.574272811f, 0.307032049f},
-std::array<float,2>{0.451671749f, 0.57719028f},
-std::array<float,2>{0.55880028f, 0.945718169f},
-std::array<float,2>{0.382676452f, 0.00137085305f},
-std::array<float,2>{0.832130075f, 0.484795511f},
-std::array<float,2>{0.0400003605f, 0.73344022f},
-std::array<float,2>{0.91907239f, 0.519471943f},
-std::array<float,2>{0.182422027f, 0.349978477f},
-std::array<float,2>{0.698516846f, 0.152093187f},
-std::array<float,2>{0.338072985f, 0.856289685f},
-std::array<float,2>{0.717717946f, 0.54134202f},
-std::array<float,2>{0.316007465f, 0.339621812f},
-std::array<float,2>{0.929566026f, 0.16903314f},
-std::array<float,2>{0.157855943f, 0.814279497f},
-std::array<float,2>{0.825344265f, 0.986605227f},
-std::array<float,2>{0.0504570194f, 0.0396864712f},
-std::array<float,2>{0.540788233f, 0.450255781f},
-std::array<float,2>{0.393545121f, 0.691534519f},
-std::array<float,2>{0.579408526f, 0.809712768f},
-std::array<float,2>{0.457778722f, 0.242947459f},
-std::array<float,2>{0.75663811f, 0.274798065f},
-std::array<float,2>{0.0829299241f, 0.606500506f},
-std::array<float,2>{0.947205484f, 0.681754887f},
-std::array<float,2>{0.221881315f, 0.383394927f},
-std::array<float,2>{0.656183422f, 0.0694411471f},
-std::array<float,2>{0.27611655f, 0.926071763f},
-std::array<float,2>{0.516587496f, 0.748699367f},
-std::array<float,2>{0.421691805f, 0.47126025f},
-std::array<float,2>{0.859802067f, 0.0164665543f},
-std::array<float,2>{0.0159589928f, 0.954268575f},
-std::array<float,2>{0.903991163f, 0.864955068f},
-std::array<float,2>{0.139299139f, 0.138814524f},
-std::array<float,2>{0.721554399f, 0.361261398f},
-std::array<float,2>{0.370685369f, 0.504520476f},
-std::array<float,2>{0.679036617f, 0.886383712f},
-std::array<float,2>{0.312433243f, 0.1198401f},
-std::array<float,2>{0.970527053f, 0.406910121f},
-std::array<float,2>{0.218421444f, 0.642847538f},
-std::array<float,2>{0.797979951f, 0.58033967f},
-std::array<float,2>{0.115761645f, 0.292579561f},
-std::array<float,2>{0.621672034f, 0.201793104f},
-std::array<float,2>{0.485233277f, 0.752943754f},
-std::array<float,2>{0.501177073f, 0.591665685f},
-std::array<float,2>{0.42398867f, 0.28170532f},
-std::array<float,2>{0.845226407f, 0.189804211f},
-std::array<float,2>{0.0100334836f, 0.759171367f},
-std::array<float,2>{0.880414248f, 0.87688911f},
-std::array<float,2>{0.145717308f, 0.116370119f},
-std::array<float,2>{0.745127439f, 0.417217314f},
-std::array<float,2>{0.346338689f, 0.653563023f},
-std::array<float,2>{0.663595319f, 0.871491015f},
-std::array<float,2>{0.281462371f, 0.132688254f},
-std::array<float,2>{0.985364914f, 0.371877372f},
-std::array<float,2>{0.202866077f, 0.509532571f},
-std::array<float,2>{0.793122113f, 0.741496325f},
-std::array<float,2>{0.104769699f, 0.481779993f},
-std::array<float,2>{0.60892266f, 0.0278069973f},
-std::array<float,2>{0.473175764f, 0.963902771f},
-std::array<float,2>{0.699545145f, 0.675729215f},
-std::array<float,2>{0.342651665f, 0.380904019f},
-std::array<float,2>{0.91792506f, 0.0715886131f},
-std::array<float,2>{0.187251806f, 0.935136855f},
-std::array<float,2>{0.831027687f, 0.798274398f},
-std::array<float,2>{0.0462056994f, 0.241208524f},
-std::array<float,2>{0.558242857f, 0.268918425f},
-std::array<float,2>{0.376606226f, 0.598070681f},
-std::array<float,2>{0.571014285f, 0.9994362f},
-std::array<float,2>{0.449106723f, 0.0325901322f},
-std::array<float,2>{0.770882726f, 0.438493073f},
-std::array<float,2>{0.0768397599f, 0.697547197f},
-std::array<float,2>{0.958269954f, 0.536892593f},
-std::array<float,2>{0.236763209f, 0.329403758f},
-std::array<float,2>{0.637583375f, 0.158796206f},
-std::array<float,2>{0.260354877f, 0.825718045f},
-std::array<float,2>{0.651345551f, 0.524657845f},
-std::array<float,2>{0.279121131f, 0.353350222f},
-std::array<float,2>{0.949439585f, 0.145959422f},
-std::array<float,2>{0.225113079f, 0.849323273f},
-std::array<float,2>{0.753647029f, 0.94421196f},
-std::array<float,2>{0.0795270652f, 0.00797355361f},
-std::array<float,2>{0.584125519f, 0.498886824f},
-std::array<float,2>{0.453178287f, 0.726416528f},
-std::array<float,2>{0.545154035f, 0.77520299f},
-std::array<float,2>{0.396920621f, 0.207268625f},
-std::array<float,2>{0.823980749f, 0.302265823f},
-std::array<float,2>{0.0525171384f, 0.567467749f},
-std::array<float,2>{0.923348665f, 0.628084838f},
-std::array<float,2>{0.161449581f, 0.429726869f},
-std::array<float,2>{0.71405983f, 0.106541388f},
-std::array<float,2>{0.318532974f, 0.903571606f},
-std::array<float,2>{0.617385328f, 0.708755791f},
-std::array<float,2>{0.492124587f, 0.460736394f},
-std::array<float,2>{0.801934421f, 0.0579652674f},
-std::array<float,2>{0.112498268f, 0.977345824f},
-std::array<float,2>{0.974574924f, 0.83903116f},
-std::array<float,2>{0.213250086f, 0.174530253f},
-std::array<float,2>{0.674423993f, 0.320778966f},
-std::array<float,2>{0.30751881f, 0.553029239f},
-std::array<float,2>{0.722940683f, 0.911400974f},
-std::array<float,2>{0.373401552f, 0.0848947093f},
-std::array<float,2>{0.900618732f, 0.395668864f},
-std::array<float,2>{0.13418512f, 0.656760335f},
-std::array<float,2>{0.863795102f, 0.616585195f},
-std::array<float,2>{0.0220305081f, 0.258240759f},
-std::array<float,2>{0.521540403f, 0.226119086f},
-std::array<float,2>{0.41525948f, 0.783525646f},
-std::array<float,2>{0.593642652f, 0.560684562f},
-std::array<float,2>{0.464639753f, 0.317762733f},
-std::array<float,2>{0.764544129f, 0.185709432f},
-std::array<float,2>{0.0924613997f, 0.831820905f},
-std::array<float,2>{0.939840078f, 0.970339119f},
-std::array<float,2>{0.231469706f, 0.0495164506f},
-std::array<float,2>{0.648226142f, 0.461231321f},
-std::array<float,2>{0.269269317f, 0.714954436f},
-std::array<float,2>{0.703929722f, 0.791594982f},
-std::array<float,2>{0.321152896f, 0.228358611f},
-std::array<float,2>{0.930297315f, 0.257148415f},
-std::array<float,2>{0.171138838f, 0.622966945f},
-std::array<float,2>{0.81460011f, 0.669255316f},
-std::array<float,2>{0.0556688644f, 0.399475515f},
-std::array<float,2>{0.532046139f, 0.0930687115f},
-std::array<float,2>{0.40336141f, 0.921857715f},
-std::array<float,2>{0.684342027f, 0.729744077f},
-std::array<float,2>{0.301295906f, 0.490800798f},
-std::array<float,2>{0.984120607f, 0.00441857893f},
-std::array<float,2>{0.209195614f, 0.953113794f},
-std::array<float,2>{0.809508204f, 0.855036438f},
-std::array<float,2>{0.118019626f, 0.15326412f},
-std::array<float,2>{0.616934538f, 0.345091105f},
-std::array<float,2>{0.498580009f, 0.519650221f},
-std::array<float,2>{0.523766816f, 0.893560112f},
-std::array<float,2>{0.406727612f, 0.101525195f},
-std::array<float,2>{0.872501671f, 0.427535862f},
-std::array<float,2>{0.0309630353f, 0.638074934f},
-std::array<float,2>{0.894671381f, 0.573251903f},
-std::array<float,2>{0.1286764f, 0.31112951f},
-std::array<float,2>{0.72955513f, 0.214194536f},
-std::array<float,2>{0.365235746f, 0.772376955f},
-std::array<float,2>{0.735203445f, 0.602193415f},
-std::array<float,2>{0.353133768f, 0.278016359f},
-std::array<float,2>{0.890437067f, 0.246322274f},
-std::array<float,2>{0.152520686f, 0.80765754f},
-std::array<float,2>{0.856067598f, 0.924428105f},
-std::array<float,2>{0.00280640717f, 0.0640763789f},
-std::array<float,2>{0.509657204f, 0.388897657f},
-std::array<float,2>{0.432246625f, 0.684866607f},
-std::array<float,2>{0.593849003f, 0.820171893f},
-std::array<float,2>{0.478318989f, 0.165217564f},
-std::array<float,2>{0.788218558f, 0.34049359f},
-std::array<float,2>{0.101070054f, 0.543109417f},
-std::array<float,2>{0.999092042f, 0.688241065f},
-std::array<float,2>{0.191756248f, 0.44919613f},
-std::array<float,2>{0.66618681f, 0.0457806736f},
-std::array<float,2>{0.295022011f, 0.989658952f},
-std::array<float,2>{0.553704262f, 0.648173988f},
-std::array<float,2>{0.389651775f, 0.412815958f},
-std::array<float,2>{0.836596787f, 0.124139711f},
-std::array<float,2>{0.0363101363f, 0.887242198f},
-std::array<float,2>{0.907269776f, 0.754881024f},
-std::array<float,2>{0.175964996f, 0.195599854f},
-std::array<float,2>{0.692979634f, 0.296834379f},
-std::array<float,2>{0.333063632f, 0.584593356f},
-std::array<float,2>{0.632764876f, 0.958640158f},
-std::array<float,2>{0.250186473f, 0.0200640243f},
-std::array<float,2>{0.963358283f, 0.475952864f},
-std::array<float,2>{0.242553249f, 0.744699717f},
-std::array<float,2>{0.777106404f, 0.501325011f},
-std::array<float,2>{0.0641945973f, 0.366680473f},
-std::array<float,2>{0.567217529f, 0.133688375f},
-std::array<float,2>{0.440240771f, 0.861173511f},
-std::array<float,2>{0.518941522f, 0.504223049f},
-std::array<float,2>{0.41885975f, 0.360784113f},
-std::array<float,2>{0.861609995f, 0.13930279f},
-std::array<float,2>{0.0195283182f, 0.864622593f},
-std::array<float,2>{0.905604661f, 0.954638958f},
-std::array<float,2>{0.138527662f, 0.0157851726f},
-std::array<float,2>{0.718919396f, 0.470743269f},
-std::array<float,2>{0.368557602f, 0.748068631f},
-std::array<float,2>{0.677605271f, 0.753655374f},
-std::array<float,2>{0.309872866f, 0.201623172f},
-std::array<float,2>{0.971202016f, 0.292196631f},
-std::array<float,2>{0.216486946f, 0.580831528f},
-std::array<float,2>{0.800290644f, 0.643124282f},
-std::array<float,2>{0.114546023f, 0.40636158f},
-std::array<float,2>{0.623791575f, 0.119592816f},
-std::array<float,2>{0.48650232f, 0.886174083f},
-std::array<float,2>{0.716514349f, 0.692115843f},
-std::array<float,2>{0.314159691f, 0.450888067f},
-std::array<float,2>{0.926167965f, 0.0392314754f},
-std::array<float,2>{0.159532815f, 0.987153649f},
-std::array<float,2>{0.826971352f, 0.813670278f},
-std::array<float,2>{0.0470696986f, 0.169548824f},
-std::array<float,2>{0.541784525f, 0.339152247f},
-std::array<float,2>{0.392129391f, 0.541571021f},
-std::array<float,2>{0.581787467f, 0.926748455f},
-std::array<float,2>{0.459231257f, 0.0700735077f},
-std::array<float,2>{0.755484581f, 0.383095115f},
-std::array<float,2>{0.085814327f, 0.682287812f},
-std::array<float,2>{0.948282421f, 0.607251525f},
-std::array<float,2>{0.220477715f, 0.275285423f},
-std::array<float,2>{0.653281152f, 0.24267298f},
-std::array<float,2>{0.274664611f, 0.810217381f},
-std::array<float,2>{0.633436918f, 0.577684522f},
-std::array<float,2>{0.262937427f, 0.307579339f},
-std::array<float,2>{0.954337001f, 0.216960996f},
-std::array<float,2>{0.239374623f, 0.767238319f},
-std::array<float,2>{0.767685831f, 0.897140205f},
-std::array<float,2>{0.0707714558f, 0.0962121785f},
-std::array<float,2>{0.576957881f, 0.422471344f},
-std::array<float,2>{0.450314879f, 0.635944307f},
-std::array<float,2>{0.56137991f, 0.855887353f},
-std::array<float,2>{0.379497409f, 0.151560217f},
-std::array<float,2>{0.834252477f, 0.350420386f},
-std::array<float,2>{0.0425304435f, 0.51866591f},
-std::array<float,2>{0.920158863f, 0.733924329f},
-std::array<float,2>{0.180485994f, 0.48504281f},
-std::array<float,2>{0.695623636f, 0.00178330205f},
-std::array<float,2>{0.335996896f, 0.946245193f},
-std::array<float,2>{0.604423821f, 0.667243898f},
-std::array<float,2>{0.472000241f, 0.402583659f},
-std::array<float,2>{0.791444838f, 0.0888937861f},
-std::array<float,2>{0.105964161f, 0.915781319f},
-std::array<float,2>{0.99091357f, 0.794931054f},
-std::array<float,2>{0.196750224f, 0.230503142f},
-std::array<float,2>{0.659395814f, 0.252959937f},
-std::array<float,2>{0.288818449f, 0.620728254f},
-std::array<float,2>{0.746369302f, 0.972992718f},
-std::array<float,2>{0.351287484f, 0.0525671616f},
-std::array<float,2>{0.877367496f, 0.465242147f},
-std::array<float,2>{0.142002642f, 0.713422716f},
-std::array<float,2>{0.850824356f, 0.557524204f},
-std::array<float,2>{0.0134754591f, 0.313759387f},
-std::array<float,2>{0.504377663f, 0.18247202f},
-std::array<float,2>{0.428687632f, 0.832116127f},
-std::array<float,2>{0.563891172f, 0.611739516f},
-std::array<float,2>{0.443961829f, 0.263168991f},
-std::array<float,2>{0.778019249f, 0.222348839f},
-std::array<float,2>{0.0668155774f, 0.787412941f},
-std::array<float,2>{0.967725635f, 0.907187939f},
-std::array<float,2>{0.247721657f, 0.0803034902f},
-std::array<float,2>{0.62767911f, 0.391930312f},
-std::array<float,2>{0.25686264f, 0.660464048f},
-std::array<float,2>{0.687755346f, 0.842564762f},
-std::array<float,2>{0.328523874f, 0.177614883f},
-std::array<float,2>{0.913495064f, 0.327171803f},
-std::array<float,2>{0.172051132f, 0.547186136f},
-std::array<float,2>{0.841130078f, 0.703289688f},
-std::array<float,2>{0.0317407027f, 0.454685271f},
-std::array<float,2>{0.550458431f, 0.0597814731f},
-std::array<float,2>{0.385345101f, 0.983747244f},
-std::array<float,2>{0.669311583f, 0.632417381f},
-std::array<float,2>{0.292387486f, 0.43515718f},
-std::array<float,2>{0.994396389f, 0.102451392f},
-std::array<float,2>{0.190833643f, 0.898466885f},
-std::array<float,2>{0.782973289f, 0.779894173f},
-std::array<float,2>{0.0957424194f, 0.204636648f},
-std::array<float,2>{0.597760618f, 0.299090832f},
-std::array<float,2>{0.48226878f, 0.564443886f},
-std::array<float,2>{0.515217602f, 0.939269185f},
-std::array<float,2>{0.436288536f, 0.0125202741f},
-std::array<float,2>{0.853224456f, 0.493882179f},
-std::array<float,2>{0.00681624003f, 0.718906939f},
-std::array<float,2>{0.886125326f, 0.530129194f},
-std::array<float,2>{0.148547977f, 0.357820779f},
-std::array<float,2>{0.740001321f, 0.143433452f},
-std::array<float,2>{0.357337624f, 0.84661746f},
-std::array<float,2>{0.731871843f, 0.5331375f},
-std::array<float,2>{0.35940975f, 0.33586216f},
-std::array<float,2>{0.892714083f, 0.162748545f},
-std::array<float,2>{0.130173549f, 0.824048996f},
-std::array<float,2>{0.870078385f, 0.993658066f},
-std::array<float,2>{0.0264355745f, 0.0388354212f},
-std::array<float,2>{0.528518915f, 0.442643791f},
-std::array<float,2>{0.410734922f, 0.699315608f},
-std::array<float,2>{0.61233741f, 0.80109781f},
-std::array<float,2>{0.49236688f, 0.238035157f},
-std::array<float,2>{0.806385338f, 0.271991283f},
-std::array<float,2>{0.124779262f, 0.594733417f},
-std::array<float,2>{0.978949785f, 0.677474797f},
-std::array<float,2>{0.206317335f, 0.377595007f},
-std::array<float,2>{0.681156635f, 0.074337028f},
-std::array<float,2>{0.299739569f, 0.93122822f},
-std::array<float,2>{0.536339819f, 0.736130059f},
-std::array<float,2>{0.400793403f, 0.479687721f},
-std::array<float,2>{0.819241226f, 0.0256809909f},
-std::array<float,2>{0.0596903637f, 0.96604377f},
-std::array<float,2>{0.936289012f, 0.867605627f},
-std::array<float,2>{0.167324692f, 0.128862545f},
-std::array<float,2>{0.709995329f, 0.370955288f},
-std::array<float,2>{0.327224761f, 0.515301466f},
-std::array<float,2>{0.643009484f, 0.880153239f},
-std::array<float,2>{0.272254676f, 0.111817978f},
-std::array<float,2>{0.941613078f, 0.41980198f},
-std::array<float,2>{0.227972433f, 0.651365101f},
-std::array<float,2>{0.759865105f, 0.587332726f},
-std::array<float,2>{0.0873057544f, 0.288233191f},
-std::array<float,2>{0.588508725f, 0.192079067f},
-std::array<float,2>{0.464894742f, 0.762986958f},
-std::array<float,2>{0.55192399f, 0.584015369f},
-std::array<float,2>{0.388123989f, 0.296240628f},
-std::array<float,2>{0.838637769f, 0.195969328f},
-std::array<float,2>{0.0372294858f, 0.754033506f},
-std::array<float,2>{0.90844959f, 0.887063026f},
-std::array<float,2>{0.179447487f, 0.124518596f},
-std::array<float,2>{0.694822967f, 0.412566066f},
-std::array<float,2>{0.334130466f, 0.647764087f},
-std::array<float,2>{0.630284786f, 0.860831678f},
-std::array<float,2>{0.25199461f, 0.132950336f},
-std::array<float,2>{0.961324036f, 0.367001802f},
-std::array<float,2>{0.244577497f, 0.501796722f},
-std::array<float,2>{0.77408278f, 0.74441421f},
-std::array<float,2>{0.0645973012f, 0.476166815f},
-std::array<float,2>{0.56876725f, 0.0197110865f},
-std::array<float,2>{0.437580377f, 0.958155513f},
-std::array<float,2>{0.736842871f, 0.685313284f},
-std::array<float,2>{0.355261087f, 0.389613748f},
-std::array<float,2>{0.887577772f, 0.0638997182f},
-std::array<float,2>{0.15485239f, 0.924123168f},
-std::array<float,2>{0.85830909f, 0.808132052f},
-std::array<float,2>{0.00111988885f, 0.246967554f},
-std::array<float,2>{0.511625528f, 0.277410954f},
-std::array<float,2>{0.431339562f, 0.601989746f},
-std::array<float,2>{0.596461535f, 0.989800632f},
-std::array<float,2>{0.48038879f, 0.0453718305f},
-std::array<float,2>{0.786578357f, 0.44844988f},
-std::array<float,2>{0.0989891291f, 0.687957168f},
-std::array<float,2>{0.997751594f, 0.543799818f},
-std::array<float,2>{0.194575757f, 0.340134144f},
-std::array<float,2>{0.665737748f, 0.165669039f},
-std::array<float,2>{0.294687092f, 0.819496989f},
-std::array<float,2>{0.687216759f, 0.520290792f},
-std::array<float,2>{0.304192126f, 0.345500052f},
-std::array<float,2>{0.981741071f, 0.152806967f},
-std::array<float,2>{0.207329005f, 0.854784608f},
-std::array<float,2>{0.810989857f, 0.952269256f},
-std::array<float,2>{0.119421251f, 0.0043619764f},
-std::array<float,2>{0.614361227f, 0.490328729f},
-std::array<float,2>{0.496403247f, 0.730022848f},
-std::array<float,2>{0.526305854f, 0.771676064f},
-std::array<float,2>{0.408520609f, 0.214654133f},
-std::array<float,2>{0.873892188f, 0.310936183f},
-std::array<float,2>{0.0287366826f, 0.573797464f},
-std::array<float,2>{0.89704293f, 0.638465881f},
-std::array<float,2>{0.12527217f, 0.426976174f},
-std::array<float,2>{0.727656186f, 0.100600943f},
-std::array<float,2>{0.363370121f, 0.894104183f},
-std::array<float,2>{0.591305435f, 0.715570033f},
-std::array<float,2>{0.462804377f, 0.461766273f},
-std::array<float,2>{0.762680531f, 0.0492478386f},
-std::array<float,2>{0.0898919851f, 0.969991028f},
-std::array<float,2>{0.938270092f, 0.831523418f},
-std::array<float,2>{0.233126879f, 0.186121613f},
-std::array<float,2>{0.646252573f, 0.318163395f},
-std::array<float,2>{0.266319752f, 0.561469972f},
-std::array<float,2>{0.706645191f, 0.921050966f},
-std::array<float,2>{0.322410256f, 0.093332164f},
-std::array<float,2>{0.933055282f, 0.400020301f},
-std::array<float,2>{0.169562727f, 0.669732511f},
-std::array<float,2>{0.812619627f, 0.62232101f},
-std::array<float,2>{0.0584834777f, 0.257364154f},
-std::array<float,2>{0.534286976f, 0.228011891f},
-std::array<float,2>{0.4053123f, 0.791146219f},
-std::array<float,2>{0.619584501f, 0.553690255f},
-std::array<float,2>{0.489525884f, 0.320947051f},
-std::array<float,2>{0.80278933f, 0.174064994f},
-std::array<float,2>{0.10983786f, 0.839504898f},
-std::array<float,2>{0.976044595f, 0.977006853f},
-std::array<float,2>{0.211673632f, 0.0582779087f},
-std::array<float,2>{0.672636211f, 0.460084289f},
-std::array<float,2>{0.306219488f, 0.70842123f},
-std::array<float,2>{0.726100862f, 0.783855319f},
-std::array<float,2>{0.372276783f, 0.225694597f},
-std::array<float,2>{0.899855733f, 0.258767664f},
-std::array<float,2>{0.136645421f, 0.617052019f},
-std::array<float,2>{0.865345538f, 0.656443596f},
-std::array<float,2>{0.0208219234f, 0.396032661f},
-std::array<float,2>{0.521416962f, 0.0841018036f},
-std::array<float,2>{0.41730997f, 0.911806464f},
-std::array<float,2>{0.648826957f, 0.725808084f},
-std::array<float,2>{0.280501753f, 0.498055339f},
-std::array<float,2>{0.951547801f, 0.00832322892f},
-std::array<float,2>{0.22406441f, 0.943723857f},
-std::array<float,2>{0.750054061f, 0.84863621f},
-std::array<float,2>{0.0812854245f, 0.146039456f},
-std::array<float,2>{0.583830059f, 0.35302043f},
-std::array<float,2>{0.456614017f, 0.52499634f},
-std::array<float,2>{0.544590175f, 0.904074728f},
-std::array<float,2>{0.395417571f, 0.107058011f},
-std::array<float,2>{0.821983218f, 0.430410475f},
-std::array<float,2>{0.0543029383f, 0.628864229f},
-std::array<float,2>{0.925237358f, 0.567997277f},
-std::array<float,2>{0.163920075f, 0.30196774f},
-std::array<float,2>{0.712551951f, 0.207594723f},
-std::array<float,2>{0.318322331f, 0.774443388f},
-std::array<float,2>{0.701493979f, 0.598451197f},
-std::array<float,2>{0.341557682f, 0.269451171f},
-std::array<float,2>{0.915335774f, 0.240433544f},
-std::array<float,2>{0.184927985f, 0.798734069f},
-std::array<float,2>{0.829641402f, 0.934574008f},
-std::array<float,2>{0.0448457189f, 0.0719512999f},
-std::array<float,2>{0.555685759f, 0.381577402f},
-std::array<float,2>{0.37719354f, 0.675252378f},
-std::array<float,2>{0.573738337f, 0.825666368f},
-std::array<float,2>{0.446908414f, 0.158433259f},
-std::array<float,2>{0.772365272f, 0.329993218f},
-std::array<float,2>{0.0755393729f, 0.536578536f},
-std::array<float,2>{0.959694743f, 0.69812578f},
-std::array<float,2>{0.23446238f, 0.439057976f},
-std::array<float,2>{0.640159607f, 0.0331690498f},
-std::array<float,2>{0.259694576f, 0.999960661f},
-std::array<float,2>{0.502653718f, 0.654060304f},
-std::array<float,2>{0.422109783f, 0.417482108f},
-std::array<float,2>{0.846379995f, 0.11697033f},
-std::array<float,2>{0.00828425307f, 0.876070738f},
-std::array<float,2>{0.882017612f, 0.759505928f},
-std::array<float,2>{0.146981835f, 0.189949751f},
-std::array<float,2>{0.743964314f, 0.281915218f},
-std::array<float,2>{0.344566733f, 0.591050506f},
-std::array<float,2>{0.660414457f, 0.964835286f},
-std::array<float,2>{0.284911662f, 0.0279290788f},
-std::array<float,2>{0.987644136f, 0.482228875f},
-std::array<float,2>{0.200929403f, 0.741964698f},
-std::array<float,2>{0.796074986f, 0.509012818f},
-std::array<float,2>{0.102377586f, 0.371177912f},
-std::array<float,2>{0.607290387f, 0.131876528f},
-std::array<float,2>{0.476417273f, 0.871953309f},
-std::array<float,2>{0.540178835f, 0.540570915f},
-std::array<float,2>{0.392802119f, 0.337853462f},
-std::array<float,2>{0.826089144f, 0.171127081f},
-std::array<float,2>{0.0501107462f, 0.815352499f},
-std::array<float,2>{0.929047108f, 0.985663474f},
-std::array<float,2>{0.157577679f, 0.0410369523f},
-std::array<float,2>{0.717129588f, 0.451956958f},
-std::array<float,2>{0.315834641f, 0.694254875f},
-std::array<float,2>{0.655443251f, 0.810742199f},
-std::array<float,2>{0.275764585f, 0.246051192f},
-std::array<float,2>{0.946412683f, 0.276587874f},
-std::array<float,2>{0.222572461f, 0.608128309f},
-std::array<float,2>{0.756142318f, 0.681235492f},
-std::array<float,2>{0.0823253766f, 0.385730237f},
-std::array<float,2>{0.579789996f, 0.0673372447f},
-std::array<float,2>{0.457401574f, 0.928904295f},
-std::array<float,2>{0.721064925f, 0.747296095f},
-std::array<float,2>{0.370559484f, 0.469143718f},
-std::array<float,2>{0.903748155f, 0.0184179246f},
-std::array<float,2>{0.13897635f, 0.956326306f},
-std::array<float,2>{0.860219002f, 0.865600944f},
-std::array<float,2>{0.016408924f, 0.137487262f},
-std::array<float,2>{0.515724957f, 0.361701161f},
-std::array<float,2>{0.421008587f, 0.505990803f},
-std::array<float,2>{0.621168852f, 0.883627176f},
-std::array<float,2>{0.484428436f, 0.117409676f},
-std::array<float,2>{0.798547447f, 0.409996927f},
-std::array<float,2>{0.115606517f, 0.641632318f},
-std::array<float,2>{0.969845355f, 0.579137444f},
-std::array<float,2>{0.218032077f, 0.290029466f},
-std::array<float,2>{0.679365635f, 0.20094502f},
-std::array<float,2>{0.311754525f, 0.751039326f},
-std::array<float,2>{0.656648397f, 0.617526829f},
-std::array<float,2>{0.285325497f, 0.250725329f},
-std::array<float,2>{0.989835024f, 0.233556256f},
-std::array<float,2>{0.198373854f, 0.79476577f},
-std::array<float,2>{0.78937155f, 0.917402208f},
-std::array<float,2>{0.10888721f, 0.0876757875f},
-std::array<float,2>{0.602874517f, 0.405962586f},
-std::array<float,2>{0.469302654f, 0.664421201f},
-std::array<float,2>{0.507353842f, 0.834269226f},
-std::array<float,2>{0.427399307f, 0.180224508f},
-std::array<float,2>{0.849142313f, 0.315212578f},
-std::array<float,2>{0.0146036996f, 0.555405259f},
-std::array<float,2>{0.876367569f, 0.711722076f},
-std::array<float,2>{0.143814892f, 0.468698978f},
-std::array<float,2>{0.749180734f, 0.0537365191f},
-std::array<float,2>{0.349042714f, 0.976435423f},
-std::array<float,2>{0.575154245f, 0.634526014f},
-std::array<float,2>{0.451544732f, 0.424549282f},
-std::array<float,2>{0.766219378f, 0.09485735f},
-std::array<float,2>{0.0727930441f, 0.894921124f},
-std::array<float,2>{0.95658654f, 0.768050671f},
-std::array<float,2>{0.242020041f, 0.215882391f},
-std::array<float,2>{0.635227561f, 0.304698735f},
-std::array<float,2>{0.263997763f, 0.575996518f},
-std::array<float,2>{0.699126601f, 0.947342634f},
-std::array<float,2>{0.338857651f, 0.00257731299f},
-std::array<float,2>{0.919769824f, 0.487964481f},
-std::array<float,2>{0.18179518f, 0.730888188f},
-std::array<float,2>{0.832791865f, 0.516764939f},
-std::array<float,2>{0.0390626565f, 0.34771648f},
-std::array<float,2>{0.559274614f, 0.149923295f},
-std::array<float,2>{0.382167697f, 0.858630538f},
-std::array<float,2>{0.599732757f, 0.565886736f},
-std::array<float,2>{0.4831267f, 0.297173142f},
-std::array<float,2>{0.785088599f, 0.206356928f},
-std::array<float,2>{0.0953630358f, 0.777377367f},
-std::array<float,2>{0.993760228f, 0.90194118f},
-std::array<float,2>{0.188224763f, 0.105421901f},
-std::array<float,2>{0.670057714f, 0.437021941f},
-std::array<float,2>{0.290864021f, 0.629653931f},
-std::array<float,2>{0.741262674f, 0.844029069f},
-std::array<float,2>{0.358761609f, 0.141315639f},
-std::array<float,2>{0.883671284f, 0.356364012f},
-std::array<float,2>{0.152052417f, 0.527383745f},
-std::array<float,2>{0.853592038f, 0.721720517f},
-std::array<float,2>{0.00495766196f, 0.494639307f},
-std::array<float,2>{0.512961507f, 0.0154394638f},
-std::array<float,2>{0.434923798f, 0.941257536f},
-std::array<float,2>{0.626337588f, 0.66278857f},
-std::array<float,2>{0.255403399f, 0.393140852f},
-std::array<float,2>{0.9648633f, 0.0800739825f},
-std::array<float,2>{0.248396128f, 0.909204125f},
-std::array<float,2>{0.779911339f, 0.786519349f},
-std::array<float,2>{0.0690948516f, 0.219866589f},
-std::array<float,2>{0.565589309f, 0.264565498f},
-std::array<float,2>{0.442697942f, 0.609730482f},
-std::array<float,2>{0.548141062f, 0.981960416f},
-std::array<float,2>{0.383816987f, 0.061215017f},
-std::array<float,2>{0.842760205f, 0.455638319f},
-std::array<float,2>{0.0339700915f, 0.70581609f},
-std::array<float,2>{0.910296679f, 0.549306631f},
-std::array<float,2>{0.173980623f, 0.325185388f},
-std::array<float,2>{0.690483987f, 0.179128692f},
-std::array<float,2>{0.331391364f, 0.840840459f},
-std::array<float,2>{0.707365096f, 0.512251258f},
-std::array<float,2>{0.326120734f, 0.367504925f},
-std::array<float,2>{0.933923721f, 0.126165003f},
-std::array<float,2>{0.165799662f, 0.870010316f},
-std::array<float,2>{0.817418814f, 0.968515098f},
-std::array<float,2>{0.0605504215f, 0.0244345795f},
-std::array<float,2>{0.538728833f, 0.477987349f},
-std::array<float,2>{0.398505092f, 0.7373963f},
-std::array<float,2>{0.587095022f, 0.764529943f},
-std::array<float,2>{0.467477053f, 0.193706483f},
-std::array<float,2>{0.757833362f, 0.285931319f},
-std::array<float,2>{0.0880178437f, 0.588111997f},
-std::array<float,2>{0.944476366f, 0.649274468f},
-std::array<float,2>{0.228915691f, 0.421837777f},
-std::array<float,2>{0.64221102f, 0.110088617f},
-std::array<float,2>{0.270718366f, 0.881463528f},
-std::array<float,2>{0.529396474f, 0.701495886f},
-std::array<float,2>{0.412226111f, 0.444708139f},
-std::array<float,2>{0.868225574f, 0.0370074846f},
-std::array<float,2>{0.0249065273f, 0.994246542f},
-std::array<float,2>{0.891129255f, 0.822188497f},
-std::array<float,2>{0.132734492f, 0.161900356f},
-std::array<float,2>{0.732902884f, 0.332385689f},
-std::array<float,2>{0.363168716f, 0.535053611f},
-std::array<float,2>{0.682826221f, 0.932771146f},
-std::array<float,2>{0.297426641f, 0.0779209584f},
-std::array<float,2>{0.978118777f, 0.375203699f},
-std::array<float,2>{0.203840211f, 0.678487778f},
-std::array<float,2>{0.806995451f, 0.596893013f},
-std::array<float,2>{0.121731877f, 0.269652694f},
-std::array<float,2>{0.610193849f, 0.235101119f},
-std::array<float,2>{0.496007681f, 0.8045156f},
-std::array<float,2>{0.509058356f, 0.605399311f},
-std::array<float,2>{0.431933165f, 0.279950321f},
-std::array<float,2>{0.855557263f, 0.248969674f},
-std::array<float,2>{0.00225913152f, 0.80596143f},
-std::array<float,2>{0.889858782f, 0.923220515f},
-std::array<float,2>{0.153080717f, 0.0658611432f},
-std::array<float,2>{0.734506965f, 0.38856253f},
-std::array<float,2>{0.352783889f, 0.686693728f},
-std::array<float,2>{0.666849792f, 0.817229509f},
-std::array<float,2>{0.295592695f, 0.166986197f},
-std::array<float,2>{0.999918163f, 0.342174828f},
-std::array<float,2>{0.192001477f, 0.545326233f},
-std::array<float,2>{0.788603425f, 0.690199912f},
-std::array<float,2>{0.101276077f, 0.446202487f},
-std::array<float,2>{0.594696939f, 0.0444329865f},
-std::array<float,2>{0.477700025f, 0.990614951f},
-std::array<float,2>{0.692842305f, 0.644897223f},
-std::array<float,2>{0.333605081f, 0.411444485f},
-std::array<float,2>{0.908128977f, 0.121132441f},
-std::array<float,2>{0.176537618f, 0.88943696f},
-std::array<float,2>{0.836360514f, 0.756618381f},
-std::array<float,2>{0.0371027626f, 0.198471189f},
-std::array<float,2>{0.552945256f, 0.294899672f},
-std::array<float,2>{0.390547544f, 0.582883537f},
-std::array<float,2>{0.56688565f, 0.959344923f},
-std::array<float,2>{0.43955633f, 0.0231460128f},
-std::array<float,2>{0.776526988f, 0.474533021f},
-std::array<float,2>{0.063497819f, 0.743241906f},
-std::array<float,2>{0.963380933f, 0.502557158f},
-std::array<float,2>{0.242695957f, 0.363759339f},
-std::array<float,2>{0.632102668f, 0.136549398f},
-std::array<float,2>{0.250575155f, 0.862395525f},
-std::array<float,2>{0.64774555f, 0.559124589f},
-std::array<float,2>{0.268735141f, 0.319686711f},
-std::array<float,2>{0.94019568f, 0.185247242f},
-std::array<float,2>{0.232128337f, 0.829272389f},
-std::array<float,2>{0.763947845f, 0.971998155f},
-std::array<float,2>{0.0919054747f, 0.0475527719f},
-std::array<float,2>{0.592807412f, 0.462950855f},
-std::array<float,2>{0.463867515f, 0.717328608f},
-std::array<float,2>{0.531413555f, 0.790761173f},
-std::array<float,2>{0.40383637f, 0.228780329f},
-std::array<float,2>{0.815387368f, 0.254606456f},
-std::array<float,2>{0.0562439226f, 0.623218f},
-std::array<float,2>{0.929716885f, 0.671287656f},
-std::array<float,2>{0.171602249f, 0.401315212f},
-std::array<float,2>{0.703299463f, 0.0903643444f},
-std::array<float,2>{0.320561945f, 0.9194206f},
-std::array<float,2>{0.616505623f, 0.726958752f},
-std::array<float,2>{0.498439699f, 0.489722162f},
-std::array<float,2>{0.808958948f, 0.00716840569f},
-std::array<float,2>{0.117524013f, 0.950025976f},
-std::array<float,2>{0.983460784f, 0.852632642f},
-std::array<float,2>{0.209586576f, 0.154738486f},
-std::array<float,2>{0.683797896f, 0.346319377f},
-std::array<float,2>{0.300882965f, 0.522386253f},
-std::array<float,2>{0.730072677f, 0.891012907f},
-std::array<float,2>{0.365967095f, 0.0994971693f},
-std::array<float,2>{0.895440996f, 0.4287076f},
-std::array<float,2>{0.12809433f, 0.639764488f},
-std::array<float,2>{0.872955024f, 0.571129441f},
-std::array<float,2>{0.0304131396f, 0.308962137f},
-std::array<float,2>{0.524088919f, 0.212737948f},
-std::array<float,2>{0.406761557f, 0.769610643f},
-std::array<float,2>{0.584893644f, 0.52704668f},
-std::array<float,2>{0.45376125f, 0.355021775f},
-std::array<float,2>{0.753186703f, 0.147978187f},
-std::array<float,2>{0.0800428987f, 0.850277007f},
-std::array<float,2>{0.949869335f, 0.942251503f},
-std::array<float,2>{0.224635392f, 0.0114484848f},
-std::array<float,2>{0.650802732f, 0.49652493f},
-std::array<float,2>{0.27854836f, 0.7239483f},
-std::array<float,2>{0.714626908f, 0.777153432f},
-std::array<float,2>{0.319027424f, 0.209443942f},
-std::array<float,2>{0.923107982f, 0.303961605f},
-std::array<float,2>{0.161726162f, 0.568685651f},
-std::array<float,2>{0.823352098f, 0.62686193f},
-std::array<float,2>{0.052010376f, 0.432439357f},
-std::array<float,2>{0.545506477f, 0.107804142f},
-std::array<float,2>{0.397098005f, 0.904895604f},
-std::array<float,2>{0.674133003f, 0.710792959f},
-std::array<float,2>{0.306875467f, 0.458358854f},
-std::array<float,2>{0.973770022f, 0.056120608f},
-std::array<float,2>{0.213505447f, 0.979828358f},
-std::array<float,2>{0.80257374f, 0.837031066f},
-std::array<float,2>{0.113169253f, 0.17238082f},
-std::array<float,2>{0.617812097f, 0.322342306f},
-std::array<float,2>{0.491577715f, 0.552576721f},
-std::array<float,2>{0.522445023f, 0.912135482f},
-std::array<float,2>{0.41581586f, 0.08343786f},
-std::array<float,2>{0.863690317f, 0.397625446f},
-std::array<float,2>{0.021655431f, 0.658547461f},
-std::array<float,2>{0.900979102f, 0.61348778f},
-std::array<float,2>{0.134396091f, 0.260514081f},
-std::array<float,2>{0.723366022f, 0.224402174f},
-std::array<float,2>{0.374019831f, 0.78224349f},
-std::array<float,2>{0.745725274f, 0.591883838f},
-std::array<float,2>{0.345790476f, 0.284577906f},
-std::array<float,2>{0.880331755f, 0.188028917f},
-std::array<float,2>{0.146034822f, 0.760273278f},
-std::array<float,2>{0.845035493f, 0.877650857f},
-std::array<float,2>{0.0105965855f, 0.114758208f},
-std::array<float,2>{0.501860976f, 0.414652914f},
-std::array<float,2>{0.424585432f, 0.655733228f},
-std::array<float,2>{0.608610451f, 0.874579012f},
-std::array<float,2>{0.47313267f, 0.129591629f},
-std::array<float,2>{0.793853641f, 0.37383303f},
-std::array<float,2>{0.105220832f, 0.510922313f},
-std::array<float,2>{0.986175776f, 0.739922583f},
-std::array<float,2>{0.20260486f, 0.483528107f},
-std::array<float,2>{0.66352129f, 0.0297408663f},
-std::array<float,2>{0.282117218f, 0.962088645f},
-std::array<float,2>{0.558099866f, 0.673255801f},
-std::array<float,2>{0.376269937f, 0.380645901f},
-std::array<float,2>{0.830168724f, 0.0733477101f},
-std::array<float,2>{0.0466220044f, 0.936794758f},
-std::array<float,2>{0.917214453f, 0.798934579f},
-std::array<float,2>{0.186672181f, 0.240025014f},
-std::array<float,2>{0.699848294f, 0.266307384f},
-std::array<float,2>{0.342183322f, 0.601212442f},
-std::array<float,2>{0.636818707f, 0.997478485f},
-std::array<float,2>{0.260239065f, 0.0333860703f},
-std::array<float,2>{0.958916247f, 0.439746767f},
-std::array<float,2>{0.236888334f, 0.69576031f},
-std::array<float,2>{0.771031201f, 0.538474441f},
-std::array<float,2>{0.0765403882f, 0.330119312f},
-std::array<float,2>{0.570537746f, 0.157651901f},
-std::array<float,2>{0.448703021f, 0.826775312f},
-std::array<float,2>{0.505858064f, 0.556462646f},
-std::array<float,2>{0.428939819f, 0.315491825f},
-std::array<float,2>{0.849969745f, 0.181393534f},
-std::array<float,2>{0.0125022251f, 0.835522711f},
-std::array<float,2>{0.878394544f, 0.975010574f},
-std::array<float,2>{0.141174689f, 0.053070236f},
-std::array<float,2>{0.747730196f, 0.467728585f},
-std::array<float,2>{0.349737763f, 0.712394595f},
-std::array<float,2>{0.658306718f, 0.793051183f},
-std::array<float,2>{0.287520289f, 0.233327046f},
-std::array<float,2>{0.991617143f, 0.251864344f},
-std::array<float,2>{0.196137935f, 0.619041622f},
-std::array<float,2>{0.792804122f, 0.665477455f},
-std::array<float,2>{0.107021958f, 0.405141473f},
-std::array<float,2>{0.605285227f, 0.0860901326f},
-std::array<float,2>{0.471370965f, 0.916915298f},
-std::array<float,2>{0.696867049f, 0.732367098f},
-std::array<float,2>{0.337882578f, 0.487024873f},
-std::array<float,2>{0.921557665f, 0.00324327429f},
-std::array<float,2>{0.181625783f, 0.948688686f},
-std::array<float,2>{0.835230589f, 0.857991397f},
-std::array<float,2>{0.0416681506f, 0.148939475f},
-std::array<float,2>{0.562027395f, 0.349413186f},
-std::array<float,2>{0.380018562f, 0.515628338f},
-std::array<float,2>{0.577200234f, 0.8958022f},
-std::array<float,2>{0.450113744f, 0.0942653343f},
-std::array<float,2>{0.76885891f, 0.425375253f},
-std::array<float,2>{0.0719324574f, 0.633683085f},
-std::array<float,2>{0.953406096f, 0.57445848f},
-std::array<float,2>{0.239031166f, 0.306311667f},
-std::array<float,2>{0.633799374f, 0.214937195f},
-std::array<float,2>{0.261877984f, 0.769228339f},
-std::array<float,2>{0.654248953f, 0.609041393f},
-std::array<float,2>{0.274371058f, 0.276281476f},
-std::array<float,2>{0.94822979f, 0.244266272f},
-std::array<float,2>{0.219661295f, 0.812249243f},
-std::array<float,2>{0.754570246f, 0.928036273f},
-std::array<float,2>{0.0845316201f, 0.0674428418f},
-std::array<float,2>{0.580768287f, 0.385902852f},
-std::array<float,2>{0.460128278f, 0.680612266f},
-std::array<float,2>{0.542653799f, 0.815822184f},
-std::array<float,2>{0.391357183f, 0.170449033f},
-std::array<float,2>{0.827710629f, 0.33623144f},
-std::array<float,2>{0.048035495f, 0.539130867f},
-std::array<float,2>{0.9273206f, 0.695099711f},
-std::array<float,2>{0.15915595f, 0.452830225f},
-std::array<float,2>{0.715646088f, 0.04259694f},
-std::array<float,2>{0.313107818f, 0.984524012f},
-std::array<float,2>{0.624981284f, 0.641141176f},
-std::array<float,2>{0.487445861f, 0.408951879f},
-std::array<float,2>{0.799434721f, 0.118979476f},
-std::array<float,2>{0.113303021f, 0.883967042f},
-std::array<float,2>{0.972248316f, 0.750868201f},
-std::array<float,2>{0.215352952f, 0.199535623f},
-std::array<float,2>{0.676459551f, 0.290636957f},
-std::array<float,2>{0.308609575f, 0.578967571f},
-std::array<float,2>{0.719738066f, 0.955495358f},
-std::array<float,2>{0.367498875f, 0.0192135647f},
-std::array<float,2>{0.904576361f, 0.470014691f},
-std::array<float,2>{0.137646139f, 0.746429026f},
-std::array<float,2>{0.862613618f, 0.507790744f},
-std::array<float,2>{0.0176796503f, 0.362460107f},
-std::array<float,2>{0.518486738f, 0.138397813f},
-std::array<float,2>{0.419887125f, 0.866623521f},
-std::array<float,2>{0.589419484f, 0.589182854f},
-std::array<float,2>{0.465912551f, 0.286351025f},
-std::array<float,2>{0.760867596f, 0.195105672f},
-std::array<float,2>{0.0861452371f, 0.765089631f},
-std::array<float,2>{0.943269253f, 0.882122636f},
-std::array<float,2>{0.226828486f, 0.110547833f},
-std::array<float,2>{0.644226074f, 0.420317739f},
-std::array<float,2>{0.273059726f, 0.649505138f},
-std::array<float,2>{0.709325612f, 0.870595336f},
-std::array<float,2>{0.326671034f, 0.125726223f},
-std::array<float,2>{0.937389255f, 0.368737996f},
-std::array<float,2>{0.166081816f, 0.513575196f},
-std::array<float,2>{0.820187628f, 0.736914992f},
-std::array<float,2>{0.058635585f, 0.47706908f},
-std::array<float,2>{0.535396516f, 0.0238469969f},
-std::array<float,2>{0.401424378f, 0.967492521f},
-std::array<float,2>{0.680325687f, 0.679552615f},
-std::array<float,2>{0.30038783f, 0.37686196f},
-std::array<float,2>{0.980338991f, 0.0762876272f},
-std::array<float,2>{0.205596164f, 0.932443619f},
-std::array<float,2>{0.804703534f, 0.803667724f},
-std::array<float,2>{0.123531297f, 0.236066476f},
-std::array<float,2>{0.612126768f, 0.271370262f},
-std::array<float,2>{0.493320227f, 0.596384346f},
-std::array<float,2>{0.528147936f, 0.995297074f},
-std::array<float,2>{0.411485732f, 0.0352653265f},
-std::array<float,2>{0.870866477f, 0.443780005f},
-std::array<float,2>{0.0258001573f, 0.702656209f},
-std::array<float,2>{0.893593431f, 0.534006834f},
-std::array<float,2>{0.129142165f, 0.333510667f},
-std::array<float,2>{0.730871558f, 0.160378322f},
-std::array<float,2>{0.360530138f, 0.820988715f},
-std::array<float,2>{0.738406181f, 0.528379679f},
-std::array<float,2>{0.355664521f, 0.356927812f},
-std::array<float,2>{0.884909213f, 0.142273888f},
-std::array<float,2>{0.149770796f, 0.845420122f},
-std::array<float,2>{0.852233768f, 0.939955652f},
-std::array<float,2>{0.00769059733f, 0.0140180793f},
-std::array<float,2>{0.514240682f, 0.496088624f},
-std::array<float,2>{0.436748862f, 0.720921397f},
-std::array<float,2>{0.599255443f, 0.779026687f},
-std::array<float,2>{0.480679721f, 0.205563933f},
-std::array<float,2>{0.781983018f, 0.298686981f},
-std::array<float,2>{0.0970033109f, 0.565091372f},
-std::array<float,2>{0.995408773f, 0.630421877f},
-std::array<float,2>{0.189841226f, 0.436457634f},
-std::array<float,2>{0.668023288f, 0.103696458f},
-std::array<float,2>{0.29124099f, 0.900873363f},
-std::array<float,2>{0.549621284f, 0.706568837f},
-std::array<float,2>{0.385894418f, 0.456931651f},
-std::array<float,2>{0.840412974f, 0.0619322062f},
-std::array<float,2>{0.0323194116f, 0.981428623f},
-std::array<float,2>{0.912646294f, 0.84047699f},
-std::array<float,2>{0.173047468f, 0.178155512f},
-std::array<float,2>{0.689395428f, 0.325746775f},
-std::array<float,2>{0.329142779f, 0.550604463f},
-std::array<float,2>{0.628166497f, 0.909018159f},
-std::array<float,2>{0.255895466f, 0.0790345222f},
-std::array<float,2>{0.967843294f, 0.393588275f},
-std::array<float,2>{0.247012272f, 0.663236082f},
-std::array<float,2>{0.778606832f, 0.611008942f},
-std::array<float,2>{0.0680921003f, 0.265051842f},
-std::array<float,2>{0.562831461f, 0.219433635f},
-std::array<float,2>{0.444692194f, 0.785926461f},
-std::array<float,2>{0.533225596f, 0.62460804f},
-std::array<float,2>{0.404366821f, 0.25540778f},
-std::array<float,2>{0.81408143f, 0.230433807f},
-std::array<float,2>{0.0570790395f, 0.78954941f},
-std::array<float,2>{0.932434559f, 0.918890178f},
-std::array<float,2>{0.168528572f, 0.0916111767f},
-std::array<float,2>{0.705624044f, 0.401990443f},
-std::array<float,2>{0.324216038f, 0.670706093f},
-std::array<float,2>{0.645038843f, 0.828829825f},
-std::array<float,2>{0.267086953f, 0.184196308f},
-std::array<float,2>{0.939309895f, 0.318831891f},
-std::array<float,2>{0.234311342f, 0.560354471f},
-std::array<float,2>{0.763315201f, 0.718051493f},
-std::array<float,2>{0.0916921347f, 0.463952184f},
-std::array<float,2>{0.590504646f, 0.048633188f},
-std::array<float,2>{0.461260319f, 0.971425653f},
-std::array<float,2>{0.72718668f, 0.639533222f},
-std::array<float,2>{0.364778727f, 0.429648966f},
-std::array<float,2>{0.897498071f, 0.0981584489f},
-std::array<float,2>{0.126882181f, 0.891721904f},
-std::array<float,2>{0.87422514f, 0.770914555f},
-std::array<float,2>{0.0282401629f, 0.211004078f},
-std::array<float,2>{0.527097166f, 0.309620351f},
-std::array<float,2>{0.409247875f, 0.572157323f},
-std::array<float,2>{0.61417228f, 0.950535953f},
-std::array<float,2>{0.497085363f, 0.00637590885f},
-std::array<float,2>{0.812158644f, 0.489164799f},
-std::array<float,2>{0.12072365f, 0.727994323f},
-std::array<float,2>{0.980757594f, 0.52341789f},
-std::array<float,2>{0.208411261f, 0.346726716f},
-std::array<float,2>{0.685690045f, 0.155857459f},
-std::array<float,2>{0.302952796f, 0.851995885f},
-std::array<float,2>{0.664785922f, 0.546709239f},
-std::array<float,2>{0.293303221f, 0.343662798f},
-std::array<float,2>{0.996172249f, 0.167416856f},
-std::array<float,2>{0.193617135f, 0.81832701f},
-std::array<float,2>{0.785661101f, 0.991972148f},
-std::array<float,2>{0.0980921835f, 0.0429825522f},
-std::array<float,2>{0.596932352f, 0.44693175f},
-std::array<float,2>{0.47879985f, 0.690577149f},
-std::array<float,2>{0.510505319f, 0.805609226f},
-std::array<float,2>{0.43019104f, 0.24906987f},
-std::array<float,2>{0.858799934f, 0.28075549f},
-std::array<float,2>{0.00076871051f, 0.604061067f},
-std::array<float,2>{0.888394773f, 0.68590939f},
-std::array<float,2>{0.155327976f, 0.387434572f},
-std::array<float,2>{0.7373209f, 0.064672187f},
-std::array<float,2>{0.353851289f, 0.921979904f},
-std::array<float,2>{0.569356859f, 0.742401898f},
-std::array<float,2>{0.438534081f, 0.472956717f},
-std::array<float,2>{0.774909854f, 0.0222622138f},
-std::array<float,2>{0.0660883337f, 0.960350871f},
-std::array<float,2>{0.962028563f, 0.861367702f},
-std::array<float,2>{0.245221913f, 0.135325506f},
-std::array<float,2>{0.628974319f, 0.364591181f},
-std::array<float,2>{0.253278941f, 0.503882349f},
-std::array<float,2>{0.693529963f, 0.889746785f},
-std::array<float,2>{0.335838407f, 0.122404762f},
-std::array<float,2>{0.909628808f, 0.410525411f},
-std::array<float,2>{0.177863926f, 0.646428525f},
-std::array<float,2>{0.839295685f, 0.583356977f},
-std::array<float,2>{0.0384289771f, 0.293763965f},
-std::array<float,2>{0.550869882f, 0.197268695f},
-std::array<float,2>{0.387027621f, 0.757175624f},
-std::array<float,2>{0.606377006f, 0.510118902f},
-std::array<float,2>{0.474627525f, 0.374216199f},
-std::array<float,2>{0.795625985f, 0.130561784f},
-std::array<float,2>{0.103208981f, 0.873216271f},
-std::array<float,2>{0.986692131f, 0.96155858f},
-std::array<float,2>{0.199611738f, 0.030828448f},
-std::array<float,2>{0.661331952f, 0.482894182f},
-std::array<float,2>{0.283614099f, 0.738825738f},
-std::array<float,2>{0.743019998f, 0.761452317f},
-std::array<float,2>{0.345631659f, 0.188989222f},
-std::array<float,2>{0.880992234f, 0.283955634f},
-std::array<float,2>{0.147714779f, 0.593377888f},
-std::array<float,2>{0.847072303f, 0.655043721f},
-std::array<float,2>{0.00895473454f, 0.415509075f},
-std::array<float,2>{0.503751516f, 0.114142366f},
-std::array<float,2>{0.423184782f, 0.877935052f},
-std::array<float,2>{0.63939327f, 0.697244167f},
-std::array<float,2>{0.257834017f, 0.440618187f},
-std::array<float,2>{0.960211813f, 0.0349614918f},
-std::array<float,2>{0.236270383f, 0.996216357f},
-std::array<float,2>{0.772775412f, 0.827414334f},
-std::array<float,2>{0.0749965683f, 0.157155156f},
-std::array<float,2>{0.573000968f, 0.331432015f},
-std::array<float,2>{0.445956141f, 0.537222743f},
-std::array<float,2>{0.555378139f, 0.936262369f},
-std::array<float,2>{0.378727317f, 0.0727415159f},
-std::array<float,2>{0.828871071f, 0.379173964f},
-std::array<float,2>{0.0430787057f, 0.672268748f},
-std::array<float,2>{0.914353609f, 0.59999001f},
-std::array<float,2>{0.184013948f, 0.26690197f},
-std::array<float,2>{0.702287793f, 0.238724232f},
-std::array<float,2>{0.33984521f, 0.800765634f},
-std::array<float,2>{0.710998476f, 0.57000035f},
-std::array<float,2>{0.316841513f, 0.303174734f},
-std::array<float,2>{0.924137533f, 0.210029081f},
-std::array<float,2>{0.162866741f, 0.775889575f},
-std::array<float,2>{0.820778966f, 0.90557909f},
-std::array<float,2>{0.0531129576f, 0.108722657f},
-std::array<float,2>{0.543514192f, 0.433231801f},
-std::array<float,2>{0.396048218f, 0.625103533f},
-std::array<float,2>{0.58227855f, 0.850755572f},
-std::array<float,2>{0.455511153f, 0.146976382f},
-std::array<float,2>{0.751608551f, 0.35432896f},
-std::array<float,2>{0.080662474f, 0.525790453f},
-std::array<float,2>{0.952221453f, 0.722787738f},
-std::array<float,2>{0.223016843f, 0.497430384f},
-std::array<float,2>{0.650316775f, 0.0104026813f},
-std::array<float,2>{0.279523104f, 0.942670286f},
-std::array<float,2>{0.519704878f, 0.659338951f},
-std::array<float,2>{0.416116595f, 0.396700919f},
-std::array<float,2>{0.866371095f, 0.0823373049f},
-std::array<float,2>{0.0199410506f, 0.913779199f},
-std::array<float,2>{0.899145186f, 0.781711876f},
-std::array<float,2>{0.134853974f, 0.223630458f},
-std::array<float,2>{0.724679172f, 0.260924786f},
-std::array<float,2>{0.371855915f, 0.614752471f},
-std::array<float,2>{0.673298419f, 0.97891885f},
-std::array<float,2>{0.304687887f, 0.0548572876f},
-std::array<float,2>{0.975062788f, 0.45798564f},
-std::array<float,2>{0.212627649f, 0.709814966f},
-std::array<float,2>{0.804169595f, 0.55146867f},
-std::array<float,2>{0.111281596f, 0.323696584f},
-std::array<float,2>{0.620693266f, 0.173675284f},
-std::array<float,2>{0.489038348f, 0.836293817f},
-std::array<float,2>{0.55988723f, 0.518507779f},
-std::array<float,2>{0.381146729f, 0.351302117f},
-std::array<float,2>{0.83383292f, 0.150393352f},
-std::array<float,2>{0.0410080291f, 0.856935263f},
-std::array<float,2>{0.918724f, 0.947089016f},
-std::array<float,2>{0.183551177f, 0.000354213902f},
-std::array<float,2>{0.698047161f, 0.486270189f},
-std::array<float,2>{0.339552462f, 0.732873976f},
-std::array<float,2>{0.63612473f, 0.766270936f},
-std::array<float,2>{0.265026331f, 0.21832411f},
-std::array<float,2>{0.955629468f, 0.308113933f},
-std::array<float,2>{0.240858123f, 0.576918066f},
-std::array<float,2>{0.767237842f, 0.634828627f},
-std::array<float,2>{0.0734741688f, 0.422901362f},
-std::array<float,2>{0.575517535f, 0.0974316746f},
-std::array<float,2>{0.45246774f, 0.898410797f},
-std::array<float,2>{0.749019265f, 0.714573681f},
-std::array<float,2>{0.348000675f, 0.466109157f},
-std::array<float,2>{0.87520355f, 0.0515434146f},
-std::array<float,2>{0.14286612f, 0.974345207f},
-std::array<float,2>{0.848219812f, 0.833420694f},
-std::array<float,2>{0.0149307307f, 0.183000028f},
-std::array<float,2>{0.506612897f, 0.312889695f},
-std::array<float,2>{0.426072985f, 0.558209181f},
-std::array<float,2>{0.601838827f, 0.914278507f},
-std::array<float,2>{0.470092833f, 0.0879568458f},
-std::array<float,2>{0.790903091f, 0.403519779f},
-std::array<float,2>{0.107803158f, 0.66607058f},
-std::array<float,2>{0.988725603f, 0.62009263f},
-std::array<float,2>{0.197960138f, 0.252615154f},
-std::array<float,2>{0.657508492f, 0.23179622f},
-std::array<float,2>{0.286434144f, 0.796623111f},
-std::array<float,2>{0.678618371f, 0.582022369f},
-std::array<float,2>{0.310972899f, 0.291977495f},
-std::array<float,2>{0.968788266f, 0.202358454f},
-std::array<float,2>{0.21726267f, 0.752333343f},
-std::array<float,2>{0.797054529f, 0.885072529f},
-std::array<float,2>{0.116226748f, 0.120809451f},
-std::array<float,2>{0.622942567f, 0.40778476f},
-std::array<float,2>{0.486041248f, 0.644087553f},
-std::array<float,2>{0.51722759f, 0.863404334f},
-std::array<float,2>{0.420801222f, 0.139785722f},
-std::array<float,2>{0.860965252f, 0.359779626f},
-std::array<float,2>{0.0173311122f, 0.505207658f},
-std::array<float,2>{0.903176367f, 0.749724805f},
-std::array<float,2>{0.140530124f, 0.472408384f},
-std::array<float,2>{0.722578228f, 0.017126251f},
-std::array<float,2>{0.369337529f, 0.953303814f},
-std::array<float,2>{0.57897979f, 0.6832003f},
-std::array<float,2>{0.458964169f, 0.384147704f},
-std::array<float,2>{0.75706768f, 0.0687480643f},
-std::array<float,2>{0.0838382095f, 0.927477896f},
-std::array<float,2>{0.946228385f, 0.809084058f},
-std::array<float,2>{0.221656412f, 0.243587554f},
-std::array<float,2>{0.655265272f, 0.274363697f},
-std::array<float,2>{0.276913404f, 0.605716228f},
-std::array<float,2>{0.718698502f, 0.988084733f},
-std::array<float,2>{0.314959288f, 0.0405312255f},
-std::array<float,2>{0.928380072f, 0.449734807f},
-std::array<float,2>{0.157223254f, 0.692732692f},
-std::array<float,2>{0.824600697f, 0.542236984f},
-std::array<float,2>{0.0495367683f, 0.33812204f},
-std::array<float,2>{0.539086699f, 0.168935657f},
-std::array<float,2>{0.394509017f, 0.813404322f},
-std::array<float,2>{0.610534072f, 0.59394753f},
-std::array<float,2>{0.495114416f, 0.273100585f},
-std::array<float,2>{0.808520794f, 0.236713037f},
-std::array<float,2>{0.122194886f, 0.802359521f},
-std::array<float,2>{0.97708708f, 0.929939866f},
-std::array<float,2>{0.204163134f, 0.0754162297f},
-std::array<float,2>{0.682053864f, 0.37841785f},
-std::array<float,2>{0.298379719f, 0.675874531f},
-std::array<float,2>{0.73389715f, 0.82275641f},
-std::array<float,2>{0.36139366f, 0.163626701f},
-std::array<float,2>{0.892000794f, 0.334343404f},
-std::array<float,2>{0.131384864f, 0.531735241f},
-std::array<float,2>{0.867510915f, 0.701128423f},
-std::array<float,2>{0.0239515249f, 0.441548526f},
-std::array<float,2>{0.530950367f, 0.0372092985f},
-std::array<float,2>{0.413209736f, 0.992486417f},
-std::array<float,2>{0.641534209f, 0.651419461f},
-std::array<float,2>{0.270040542f, 0.418660641f},
-std::array<float,2>{0.943946958f, 0.112799786f},
-std::array<float,2>{0.23016493f, 0.879013777f},
-std::array<float,2>{0.758906186f, 0.762026668f},
-std::array<float,2>{0.0890614539f, 0.192886516f},
-std::array<float,2>{0.586452127f, 0.28745538f},
-std::array<float,2>{0.468541831f, 0.586406231f},
-std::array<float,2>{0.537373722f, 0.965136349f},
-std::array<float,2>{0.399633139f, 0.0265855268f},
-std::array<float,2>{0.816753447f, 0.479479313f},
-std::array<float,2>{0.0618068911f, 0.73494041f},
-std::array<float,2>{0.93554318f, 0.51427108f},
-std::array<float,2>{0.164878547f, 0.3693299f},
-std::array<float,2>{0.708671272f, 0.127851903f},
-std::array<float,2>{0.324880302f, 0.868700683f},
-std::array<float,2>{0.689792991f, 0.548559844f},
-std::array<float,2>{0.33050254f, 0.326485097f},
-std::array<float,2>{0.911949813f, 0.175910547f},
-std::array<float,2>{0.175082773f, 0.842974782f},
-std::array<float,2>{0.843726993f, 0.982553899f},
-std::array<float,2>{0.034771204f, 0.0591660254f},
-std::array<float,2>{0.54719162f, 0.453312933f},
-std::array<float,2>{0.38348487f, 0.704650462f},
-std::array<float,2>{0.564713836f, 0.788448274f},
-std::array<float,2>{0.441658735f, 0.220737681f},
-std::array<float,2>{0.780967057f, 0.262057394f},
-std::array<float,2>{0.069967933f, 0.613231361f},
-std::array<float,2>{0.965921342f, 0.661854208f},
-std::array<float,2>{0.249851838f, 0.390834123f},
-std::array<float,2>{0.625713885f, 0.081469059f},
-std::array<float,2>{0.254368573f, 0.907869399f},
-std::array<float,2>{0.512315333f, 0.720376253f},
-std::array<float,2>{0.433879852f, 0.492190421f},
-std::array<float,2>{0.854931295f, 0.0136075048f},
-std::array<float,2>{0.00474853907f, 0.938255787f},
-std::array<float,2>{0.884172142f, 0.847345889f},
-std::array<float,2>{0.151277065f, 0.144407392f},
-std::array<float,2>{0.740376174f, 0.358586967f},
-std::array<float,2>{0.358033687f, 0.530918777f},
-std::array<float,2>{0.671058536f, 0.900345683f},
-std::array<float,2>{0.290006548f, 0.103408076f},
-std::array<float,2>{0.993057549f, 0.433620125f},
-std::array<float,2>{0.18915084f, 0.630946696f},
-std::array<float,2>{0.78333509f, 0.56304276f},
-std::array<float,2>{0.0942301005f, 0.300679028f},
-std::array<float,2>{0.600928724f, 0.204048723f},
-std::array<float,2>{0.483820766f, 0.780365348f},
-std::array<float,2>{0.525063097f, 0.572717547f},
-std::array<float,2>{0.407698631f, 0.312021106f},
-std::array<float,2>{0.871631861f, 0.213063285f},
-std::array<float,2>{0.029328566f, 0.772664845f},
-std::array<float,2>{0.895744741f, 0.893461406f},
-std::array<float,2>{0.127011076f, 0.100016959f},
-std::array<float,2>{0.728799939f, 0.426197827f},
-std::array<float,2>{0.366912067f, 0.636937201f},
-std::array<float,2>{0.684739232f, 0.854415655f},
-std::array<float,2>{0.302259028f, 0.153504401f},
-std::array<float,2>{0.982722104f, 0.344363272f},
-std::array<float,2>{0.21041292f, 0.520937741f},
-std::array<float,2>{0.810391843f, 0.728677511f},
-std::array<float,2>{0.119044438f, 0.491770774f},
-std::array<float,2>{0.615340233f, 0.00544825057f},
-std::array<float,2>{0.499291837f, 0.951535165f},
-std::array<float,2>{0.704571009f, 0.668828309f},
-std::array<float,2>{0.321819276f, 0.399081051f},
-std::array<float,2>{0.930958986f, 0.0921745673f},
-std::array<float,2>{0.170086652f, 0.919970036f},
-std::array<float,2>{0.816033065f, 0.792690456f},
-std::array<float,2>{0.0553606562f, 0.227062121f},
-std::array<float,2>{0.533008277f, 0.256795377f},
-std::array<float,2>{0.403029114f, 0.621480286f},
-std::array<float,2>{0.591908336f, 0.968819618f},
-std::array<float,2>{0.463001311f, 0.0499836951f},
-std::array<float,2>{0.764899194f, 0.462296426f},
-std::array<float,2>{0.0929607823f, 0.716212332f},
-std::array<float,2>{0.940926194f, 0.562350333f},
-std::array<float,2>{0.230968952f, 0.316794783f},
-std::array<float,2>{0.647333086f, 0.187213585f},
-std::array<float,2>{0.267806202f, 0.830462515f},
-std::array<float,2>{0.631273508f, 0.50086838f},
-std::array<float,2>{0.250980794f, 0.365844488f},
-std::array<float,2>{0.963888407f, 0.134616762f},
-std::array<float,2>{0.243323877f, 0.85959512f},
-std::array<float,2>{0.775855482f, 0.957387745f},
-std::array<float,2>{0.062995553f, 0.0205143113f},
-std::array<float,2>{0.568207264f, 0.475056857f},
-std::array<float,2>{0.440457791f, 0.746078789f},
-std::array<float,2>{0.554674983f, 0.755088866f},
-std::array<float,2>{0.388742268f, 0.196784511f},
-std::array<float,2>{0.836932778f, 0.295123696f},
-std::array<float,2>{0.0358337834f, 0.585329294f},
-std::array<float,2>{0.906637073f, 0.64735806f},
-std::array<float,2>{0.177219525f, 0.413701177f},
-std::array<float,2>{0.691906035f, 0.123815864f},
-std::array<float,2>{0.332964063f, 0.887763619f},
-std::array<float,2>{0.595314741f, 0.688656986f},
-std::array<float,2>{0.476807803f, 0.448132634f},
-std::array<float,2>{0.787276685f, 0.045924671f},
-std::array<float,2>{0.100000635f, 0.989025414f},
-std::array<float,2>{0.998336375f, 0.819120884f},
-std::array<float,2>{0.192819968f, 0.164871201f},
-std::array<float,2>{0.667690039f, 0.340962738f},
-std::array<float,2>{0.296610802f, 0.544777155f},
-std::array<float,2>{0.736285746f, 0.925315797f},
-std::array<float,2>{0.352021873f, 0.0627528578f},
-std::array<float,2>{0.888754249f, 0.390457124f},
-std::array<float,2>{0.15339753f, 0.684535205f},
-std::array<float,2>{0.85733372f, 0.603116632f},
-std::array<float,2>{0.00365706347f, 0.278350502f},
-std::array<float,2>{0.508414984f, 0.247351691f},
-std::array<float,2>{0.432901293f, 0.806697905f},
-std::array<float,2>{0.571831763f, 0.535169899f},
-std::array<float,2>{0.447934806f, 0.329087794f},
-std::array<float,2>{0.769631326f, 0.159839496f},
-std::array<float,2>{0.0777469203f, 0.824789524f},
-std::array<float,2>{0.957174122f, 0.998236358f},
-std::array<float,2>{0.237338945f, 0.0312691778f},
-std::array<float,2>{0.638649464f, 0.437940031f},
-std::array<float,2>{0.261550486f, 0.699116826f},
-std::array<float,2>{0.701170683f, 0.796935797f},
-std::array<float,2>{0.34309867f, 0.241909713f},
-std::array<float,2>{0.916595995f, 0.26822108f},
-std::array<float,2>{0.185677335f, 0.59895581f},
-std::array<float,2>{0.831537008f, 0.674433947f},
-std::array<float,2>{0.0456554815f, 0.381870538f},
-std::array<float,2>{0.556643844f, 0.0705687627f},
-std::array<float,2>{0.375211239f, 0.934523106f},
-std::array<float,2>{0.662423313f, 0.741108537f},
-std::array<float,2>{0.282696605f, 0.481330335f},
-std::array<float,2>{0.984406948f, 0.0290177651f},
-std::array<float,2>{0.201613307f, 0.962933004f},
-std::array<float,2>{0.794180214f, 0.872853518f},
-std::array<float,2>{0.10358645f, 0.130897418f},
-std::array<float,2>{0.607545793f, 0.372162491f},
-std::array<float,2>{0.474596411f, 0.508516729f},
-std::array<float,2>{0.500599146f, 0.875213742f},
-std::array<float,2>{0.424887598f, 0.115338005f},
-std::array<float,2>{0.844668984f, 0.416624248f},
-std::array<float,2>{0.0114641357f, 0.652487099f},
-std::array<float,2>{0.879162848f, 0.59026891f},
-std::array<float,2>{0.145314321f, 0.282796234f},
-std::array<float,2>{0.744681239f, 0.191037536f},
-std::array<float,2>{0.346990734f, 0.75832051f},
-std::array<float,2>{0.724038422f, 0.61538744f},
-std::array<float,2>{0.374201536f, 0.259544998f},
-std::array<float,2>{0.902200758f, 0.225558579f},
-std::array<float,2>{0.133276507f, 0.784522951f},
-std::array<float,2>{0.864494443f, 0.910446167f},
-std::array<float,2>{0.023106467f, 0.0856713206f},
-std::array<float,2>{0.523011446f, 0.394754112f},
-std::array<float,2>{0.414330274f, 0.657788396f},
-std::array<float,2>{0.618621469f, 0.838321745f},
-std::array<float,2>{0.49036634f, 0.175298348f},
-std::array<float,2>{0.801072896f, 0.321378678f},
-std::array<float,2>{0.111712314f, 0.554414034f},
-std::array<float,2>{0.973316252f, 0.707111537f},
-std::array<float,2>{0.214086831f, 0.459361374f},
-std::array<float,2>{0.675724566f, 0.0572491586f},
-std::array<float,2>{0.30822292f, 0.977678061f},
-std::array<float,2>{0.546809554f, 0.627471626f},
-std::array<float,2>{0.397636175f, 0.431557298f},
-std::array<float,2>{0.822669387f, 0.106325425f},
-std::array<float,2>{0.0512404777f, 0.902501464f},
-std::array<float,2>{0.921999693f, 0.77378577f},
-std::array<float,2>{0.160952941f, 0.208954409f},
-std::array<float,2>{0.713707685f, 0.300976574f},
-std::array<float,2>{0.319378167f, 0.56708926f},
-std::array<float,2>{0.651764631f, 0.945177555f},
-std::array<float,2>{0.277905911f, 0.00944193639f},
-std::array<float,2>{0.950668097f, 0.49990353f},
-std::array<float,2>{0.226285353f, 0.725557923f},
-std::array<float,2>{0.752472222f, 0.523488402f},
-std::array<float,2>{0.0787067562f, 0.352517724f},
-std::array<float,2>{0.585433602f, 0.145044699f},
-std::array<float,2>{0.454940766f, 0.848385334f},
-std::array<float,2>{0.525819361f, 0.520556629f},
-std::array<float,2>{0.408841521f, 0.344573826f},
-std::array<float,2>{0.873143256f, 0.153598234f},
-std::array<float,2>{0.0290239155f, 0.854108274f},
-std::array<float,2>{0.896592379f, 0.951350093f},
-std::array<float,2>{0.125612691f, 0.00566791836f},
-std::array<float,2>{0.728380442f, 0.492025673f},
-std::array<float,2>{0.364243805f, 0.728884697f},
-std::array<float,2>{0.686538815f, 0.772740602f},
-std::array<float,2>{0.304419965f, 0.213230103f},
-std::array<float,2>{0.982348144f, 0.312498927f},
-std::array<float,2>{0.207747802f, 0.572269499f},
-std::array<float,2>{0.811335564f, 0.637111068f},
-std::array<float,2>{0.1196303f, 0.425956249f},
-std::array<float,2>{0.614961624f, 0.0997498333f},
-std::array<float,2>{0.496918917f, 0.893148899f},
-std::array<float,2>{0.706253648f, 0.715899527f},
-std::array<float,2>{0.322777659f, 0.46214065f},
-std::array<float,2>{0.933191478f, 0.0502596125f},
-std::array<float,2>{0.169421509f, 0.969194412f},
-std::array<float,2>{0.813022137f, 0.830239832f},
-std::array<float,2>{0.0579544082f, 0.187302023f},
-std::array<float,2>{0.535045683f, 0.316507846f},
-std::array<float,2>{0.405951887f, 0.562161624f},
-std::array<float,2>{0.591768086f, 0.920356572f},
-std::array<float,2>{0.462318242f, 0.0920350328f},
-std::array<float,2>{0.762120903f, 0.399346381f},
-std::array<float,2>{0.0906102136f, 0.668519497f},
-std::array<float,2>{0.937960207f, 0.621201396f},
-std::array<float,2>{0.232538417f, 0.256360769f},
-std::array<float,2>{0.645935953f, 0.227519274f},
-std::array<float,2>{0.265981913f, 0.792962492f},
-std::array<float,2>{0.630389988f, 0.585174561f},
-std::array<float,2>{0.252678484f, 0.295324177f},
-std::array<float,2>{0.96163249f, 0.197075531f},
-std::array<float,2>{0.244738951f, 0.755258322f},
-std::array<float,2>{0.773617685f, 0.888169825f},
-std::array<float,2>{0.0650085211f, 0.123591788f},
-std::array<float,2>{0.56909132f, 0.413868904f},
-std::array<float,2>{0.438425004f, 0.647033393f},
-std::array<float,2>{0.552252948f, 0.859704077f},
-std::array<float,2>{0.388505846f, 0.134374842f},
-std::array<float,2>{0.838312864f, 0.366068274f},
-std::array<float,2>{0.0380759425f, 0.50053972f},
-std::array<float,2>{0.9087888f, 0.745817065f},
-std::array<float,2>{0.179020271f, 0.474633694f},
-std::array<float,2>{0.695180655f, 0.0209207013f},
-std::array<float,2>{0.334673613f, 0.957068503f},
-std::array<float,2>{0.59587431f, 0.684214175f},
-std::array<float,2>{0.479558825f, 0.390158921f},
-std::array<float,2>{0.78690958f, 0.0625798702f},
-std::array<float,2>{0.0992960334f, 0.925723374f},
-std::array<float,2>{0.997403681f, 0.80705601f},
-std::array<float,2>{0.195310563f, 0.247153804f},
-std::array<float,2>{0.66531235f, 0.278664976f},
-std::array<float,2>{0.294425845f, 0.603289962f},
-std::array<float,2>{0.736497283f, 0.988876045f},
-std::array<float,2>{0.354556918f, 0.0463472605f},
-std::array<float,2>{0.886875033f, 0.447857469f},
-std::array<float,2>{0.154465228f, 0.688955367f},
-std::array<float,2>{0.857846737f, 0.544572473f},
-std::array<float,2>{0.00152593968f, 0.341233402f},
-std::array<float,2>{0.510846555f, 0.164677814f},
-std::array<float,2>{0.430726469f, 0.819012046f},
-std::array<float,2>{0.573545396f, 0.598692715f},
-std::array<float,2>{0.446513683f, 0.268528312f},
-std::array<float,2>{0.771644354f, 0.241992712f},
-std::array<float,2>{0.0759268031f, 0.797306418f},
-std::array<float,2>{0.95901823f, 0.934299052f},
-std::array<float,2>{0.23494716f, 0.0703561604f},
-std::array<float,2>{0.639952838f, 0.382224709f},
-std::array<float,2>{0.259171754f, 0.674675345f},
-std::array<float,2>{0.701929867f, 0.825189173f},
-std::array<float,2>{0.340958685f, 0.159923449f},
-std::array<float,2>{0.915997803f, 0.328816921f},
-std::array<float,2>{0.185136035f, 0.535577953f},
-std::array<float,2>{0.829136252f, 0.698911607f},
-std::array<float,2>{0.0443481058f, 0.437585533f},
-std::array<float,2>{0.556292892f, 0.0316651948f},
-std::array<float,2>{0.377540559f, 0.998362362f},
-std::array<float,2>{0.66073674f, 0.652708828f},
-std::array<float,2>{0.284553766f, 0.41676271f},
-std::array<float,2>{0.987962842f, 0.115688078f},
-std::array<float,2>{0.200536683f, 0.875274777f},
-std::array<float,2>{0.796798587f, 0.758624017f},
-std::array<float,2>{0.101743765f, 0.191169426f},
-std::array<float,2>{0.606739044f, 0.283061892f},
-std::array<float,2>{0.475842804f, 0.590005815f},
-std::array<float,2>{0.502282083f, 0.963337362f},
-std::array<float,2>{0.422578961f, 0.0290561505f},
-std::array<float,2>{0.845782757f, 0.481177717f},
-std::array<float,2>{0.00834945589f, 0.740843177f},
-std::array<float,2>{0.882602453f, 0.508764982f},
-std::array<float,2>{0.146564588f, 0.37251842f},
-std::array<float,2>{0.743546128f, 0.131193519f},
-std::array<float,2>{0.343830228f, 0.872589767f},
-std::array<float,2>{0.725777924f, 0.554520428f},
-std::array<float,2>{0.372912496f, 0.321679264f},
-std::array<float,2>{0.900243104f, 0.175707892f},
-std::array<float,2>{0.136179134f, 0.837960601f},
-std::array<float,2>{0.866093814f, 0.977920473f},
-std::array<float,2>{0.0210587401f, 0.0573952273f},
-std::array<float,2>{0.52096957f, 0.459158719f},
-std::array<float,2>{0.417624354f, 0.707320452f},
-std::array<float,2>{0.619987547f, 0.784194529f},
-std::array<float,2>{0.490062028f, 0.225323588f},
-std::array<float,2>{0.803226292f, 0.259420395f},
-std::array<float,2>{0.110170595f, 0.615553319f},
-std::array<float,2>{0.976299047f, 0.657959104f},
-std::array<float,2>{0.211326987f, 0.394876778f},
-std::array<float,2>{0.67202431f, 0.0858020335f},
-std::array<float,2>{0.305687159f, 0.910332322f},
-std::array<float,2>{0.544288754f, 0.725278318f},
-std::array<float,2>{0.394802213f, 0.499662548f},
-std::array<float,2>{0.821381152f, 0.00962330494f},
-std::array<float,2>{0.0538460538f, 0.944884241f},
-std::array<float,2>{0.925416708f, 0.848475337f},
-std::array<float,2>{0.163142756f, 0.145308435f},
-std::array<float,2>{0.71195668f, 0.352156997f},
-std::array<float,2>{0.31786418f, 0.523818552f},
-std::array<float,2>{0.648990512f, 0.902634203f},
-std::array<float,2>{0.280870557f, 0.105973616f},
-std::array<float,2>{0.951889575f, 0.431358844f},
-std::array<float,2>{0.224565029f, 0.627836525f},
-std::array<float,2>{0.750940442f, 0.567320704f},
-std::array<float,2>{0.0820276514f, 0.301208317f},
-std::array<float,2>{0.583422542f, 0.208665669f},
-std::array<float,2>{0.456516117f, 0.773494303f},
-std::array<float,2>{0.560819745f, 0.576704443f},
-std::array<float,2>{0.379124343f, 0.308392525f},
-std::array<float,2>{0.834593236f, 0.218716085f},
-std::array<float,2>{0.0421139337f, 0.766447365f},
-std::array<float,2>{0.920811951f, 0.897989273f},
-std::array<float,2>{0.180102274f, 0.0972336754f},
-std::array<float,2>{0.695939422f, 0.423120886f},
-std::array<float,2>{0.336877972f, 0.635062754f},
-std::array<float,2>{0.632869005f, 0.857275963f},
-std::array<float,2>{0.263236374f, 0.150721371f},
-std::array<float,2>{0.954836071f, 0.351396203f},
-std::array<float,2>{0.239786178f, 0.518121004f},
-std::array<float,2>{0.768207371f, 0.73246032f},
-std::array<float,2>{0.070856154f, 0.48591131f},
-std::array<float,2>{0.57630682f, 2.49137065e-05f},
-std::array<float,2>{0.450915843f, 0.946784616f},
-std::array<float,2>{0.746945024f, 0.666410148f},
-std::array<float,2>{0.350835383f, 0.403769016f},
-std::array<float,2>{0.877513528f, 0.0883129537f},
-std::array<float,2>{0.142207935f, 0.914399743f},
-std::array<float,2>{0.851220012f, 0.796764731f},
-std::array<float,2>{0.0130704008f, 0.231529862f},
-std::array<float,2>{0.504487455f, 0.252703369f},
-std::array<float,2>{0.428165317f, 0.619843185f},
-std::array<float,2>{0.603791296f, 0.974578679f},
-std::array<float,2>{0.472340465f, 0.0514996313f},
-std::array<float,2>{0.791950464f, 0.465912312f},
-std::array<float,2>{0.105512127f, 0.714811265f},
-std::array<float,2>{0.990627527f, 0.558433652f},
-std::array<float,2>{0.197142109f, 0.312628299f},
-std::array<float,2>{0.659851849f, 0.182780743f},
-std::array<float,2>{0.288543612f, 0.833165348f},
-std::array<float,2>{0.67696476f, 0.5049842f},
-std::array<float,2>{0.310524106f, 0.359475344f},
-std::array<float,2>{0.971066833f, 0.139895543f},
-std::array<float,2>{0.21628806f, 0.863639534f},
-std::array<float,2>{0.800563455f, 0.953469694f},
-std::array<float,2>{0.114799343f, 0.0174398832f},
-std::array<float,2>{0.623440504f, 0.472522557f},
-std::array<float,2>{0.487127423f, 0.749896288f},
-std::array<float,2>{0.519401789f, 0.752191782f},
-std::array<float,2>{0.41816923f, 0.202595741f},
-std::array<float,2>{0.861882269f, 0.291734159f},
-std::array<float,2>{0.0185697991f, 0.581785977f},
-std::array<float,2>{0.905813217f, 0.644358277f},
-std::array<float,2>{0.137800276f, 0.40811494f},
-std::array<float,2>{0.719470441f, 0.120865352f},
-std::array<float,2>{0.368806124f, 0.884803534f},
-std::array<float,2>{0.581509292f, 0.692601025f},
-std::array<float,2>{0.459521621f, 0.449982315f},
-std::array<float,2>{0.754903197f, 0.0408377685f},
-std::array<float,2>{0.085241802f, 0.987836957f},
-std::array<float,2>{0.948872864f, 0.81315136f},
-std::array<float,2>{0.219929799f, 0.168638706f},
-std::array<float,2>{0.652648985f, 0.338315874f},
-std::array<float,2>{0.274930656f, 0.542186081f},
-std::array<float,2>{0.716231167f, 0.927719057f},
-std::array<float,2>{0.313865304f, 0.068559505f},
-std::array<float,2>{0.926364005f, 0.383917242f},
-std::array<float,2>{0.159864545f, 0.683546841f},
-std::array<float,2>{0.826353133f, 0.60568893f},
-std::array<float,2>{0.0474793427f, 0.27396211f},
-std::array<float,2>{0.541115344f, 0.24328202f},
-std::array<float,2>{0.391683787f, 0.809525788f},
-std::array<float,2>{0.612955153f, 0.531486392f},
-std::array<float,2>{0.492787004f, 0.334139079f},
-std::array<float,2>{0.805694103f, 0.164000824f},
-std::array<float,2>{0.124303192f, 0.823041916f},
-std::array<float,2>{0.979066133f, 0.992215157f},
-std::array<float,2>{0.206575319f, 0.0375489481f},
-std::array<float,2>{0.680894256f, 0.441762596f},
-std::array<float,2>{0.298987091f, 0.700781703f},
-std::array<float,2>{0.732176483f, 0.802588522f},
-std::array<float,2>{0.359883308f, 0.236339331f},
-std::array<float,2>{0.89313966f, 0.273266822f},
-std::array<float,2>{0.13041684f, 0.594000518f},
-std::array<float,2>{0.869461179f, 0.676175654f},
-std::array<float,2>{0.0272733252f, 0.378050655f},
-std::array<float,2>{0.529007673f, 0.0756711885f},
-std::array<float,2>{0.410614908f, 0.929789662f},
-std::array<float,2>{0.643271983f, 0.735180736f},
-std::array<float,2>{0.271641165f, 0.479209691f},
-std::array<float,2>{0.941948056f, 0.0267448388f},
-std::array<float,2>{0.228077143f, 0.964925468f},
-std::array<float,2>{0.760664761f, 0.869089782f},
-std::array<float,2>{0.0877964497f, 0.127602667f},
-std::array<float,2>{0.588253617f, 0.369538039f},
-std::array<float,2>{0.465726733f, 0.514497697f},
-std::array<float,2>{0.536921144f, 0.879154861f},
-std::array<float,2>{0.400924474f, 0.113197297f},
-std::array<float,2>{0.818692386f, 0.418926388f},
-std::array<float,2>{0.0602595806f, 0.651685297f},
-std::array<float,2>{0.935839415f, 0.586020827f},
-std::array<float,2>{0.167518079f, 0.287248045f},
-std::array<float,2>{0.71051091f, 0.19330807f},
-std::array<float,2>{0.327766389f, 0.761759102f},
-std::array<float,2>{0.688058913f, 0.612935305f},
-std::array<float,2>{0.328758776f, 0.261903733f},
-std::array<float,2>{0.913834095f, 0.221023142f},
-std::array<float,2>{0.172444209f, 0.788258612f},
-std::array<float,2>{0.84178257f, 0.907980621f},
-std::array<float,2>{0.0313551985f, 0.0812519193f},
-std::array<float,2>{0.54994154f, 0.390975535f},
-std::array<float,2>{0.38511768f, 0.66202879f},
-std::array<float,2>{0.564321458f, 0.843144417f},
-std::array<float,2>{0.443661511f, 0.176199615f},
-std::array<float,2>{0.777438104f, 0.326201588f},
-std::array<float,2>{0.06698367f, 0.548647165f},
-std::array<float,2>{0.966951668f, 0.705025971f},
-std::array<float,2>{0.247279063f, 0.453505427f},
-std::array<float,2>{0.627183735f, 0.0593281612f},
-std::array<float,2>{0.257481456f, 0.982674003f},
-std::array<float,2>{0.514708817f, 0.6312356f},
-std::array<float,2>{0.435724914f, 0.434038311f},
-std::array<float,2>{0.852814853f, 0.103035055f},
-std::array<float,2>{0.00605795579f, 0.899951994f},
-std::array<float,2>{0.886677027f, 0.780618489f},
-std::array<float,2>{0.149196208f, 0.203711823f},
-std::array<float,2>{0.739643991f, 0.300389528f},
-std::array<float,2>{0.356559515f, 0.563319743f},
-std::array<float,2>{0.669512093f, 0.938100815f},
-std::array<float,2>{0.292740375f, 0.013267735f},
-std::array<float,2>{0.995117128f, 0.49258548f},
-std::array<float,2>{0.191059738f, 0.720491886f},
-std::array<float,2>{0.782428265f, 0.5312047f},
-std::array<float,2>{0.0963591635f, 0.358785033f},
-std::array<float,2>{0.598214865f, 0.144125581f},
-std::array<float,2>{0.481617659f, 0.847609401f},
-std::array<float,2>{0.531885266f, 0.560148239f},
-std::array<float,2>{0.403781176f, 0.318524361f},
-std::array<float,2>{0.81483978f, 0.184546858f},
-std::array<float,2>{0.0560750403f, 0.828972042f},
-std::array<float,2>{0.930452764f, 0.971559525f},
-std::array<float,2>{0.171162784f, 0.0485220551f},
-std::array<float,2>{0.703833878f, 0.46419853f},
-std::array<float,2>{0.321029335f, 0.718006134f},
-std::array<float,2>{0.648103714f, 0.789182544f},
-std::array<float,2>{0.269356668f, 0.230174214f},
-std::array<float,2>{0.939687252f, 0.255734444f},
-std::array<float,2>{0.231767148f, 0.624930918f},
-std::array<float,2>{0.764350593f, 0.670637906f},
-std::array<float,2>{0.0925384536f, 0.402100861f},
-std::array<float,2>{0.593492091f, 0.0915047079f},
-std::array<float,2>{0.464369416f, 0.918635011f},
-std::array<float,2>{0.729967892f, 0.727619529f},
-std::array<float,2>{0.365529478f, 0.488864154f},
-std::array<float,2>{0.894997299f, 0.00674380735f},
-std::array<float,2>{0.128480613f, 0.950215876f},
-std::array<float,2>{0.872175932f, 0.85167408f},
-std::array<float,2>{0.0310858358f, 0.156100035f},
-std::array<float,2>{0.523678958f, 0.347145468f},
-std::array<float,2>{0.406270295f, 0.522984028f},
-std::array<float,2>{0.617147326f, 0.89208883f},
-std::array<float,2>{0.498786807f, 0.0984369218f},
-std::array<float,2>{0.809250176f, 0.429303348f},
-std::array<float,2>{0.117918134f, 0.639336467f},
-std::array<float,2>{0.984325707f, 0.571785867f},
-std::array<float,2>{0.209353402f, 0.31005761f},
-std::array<float,2>{0.684126198f, 0.211400792f},
-std::array<float,2>{0.30165714f, 0.770508468f},
-std::array<float,2>{0.666390479f, 0.604276657f},
-std::array<float,2>{0.295240372f, 0.280388892f},
-std::array<float,2>{0.999447644f, 0.249270648f},
-std::array<float,2>{0.191477761f, 0.8053177f},
-std::array<float,2>{0.788458049f, 0.922244132f},
-std::array<float,2>{0.100757048f, 0.0647288784f},
-std::array<float,2>{0.594165087f, 0.387565494f},
-std::array<float,2>{0.478047192f, 0.685732663f},
-std::array<float,2>{0.509383559f, 0.817906916f},
-std::array<float,2>{0.432389617f, 0.167022765f},
-std::array<float,2>{0.856421173f, 0.343418002f},
-std::array<float,2>{0.00256927474f, 0.546618342f},
-std::array<float,2>{0.890202284f, 0.690708756f},
-std::array<float,2>{0.152694762f, 0.447257787f},
-std::array<float,2>{0.734912097f, 0.0432185903f},
-std::array<float,2>{0.353288084f, 0.991723716f},
-std::array<float,2>{0.566916525f, 0.646052659f},
-std::array<float,2>{0.440048009f, 0.410295963f},
-std::array<float,2>{0.776913047f, 0.122124285f},
-std::array<float,2>{0.0643859208f, 0.890116692f},
-std::array<float,2>{0.963014305f, 0.756904423f},
-std::array<float,2>{0.242336318f, 0.197702408f},
-std::array<float,2>{0.632564247f, 0.293483913f},
-std::array<float,2>{0.250315189f, 0.583132267f},
-std::array<float,2>{0.693126142f, 0.960000992f},
-std::array<float,2>{0.333473891f, 0.022078041f},
-std::array<float,2>{0.907515705f, 0.472679138f},
-std::array<float,2>{0.176254049f, 0.742465317f},
-std::array<float,2>{0.836838067f, 0.503440261f},
-std::array<float,2>{0.0364963561f, 0.364258826f},
-std::array<float,2>{0.553448796f, 0.13571693f},
-std::array<float,2>{0.389961272f, 0.861647069f},
-std::array<float,2>{0.609332383f, 0.593715131f},
-std::array<float,2>{0.473393679f, 0.283801585f},
-std::array<float,2>{0.793345809f, 0.18921347f},
-std::array<float,2>{0.104561761f, 0.76148814f},
-std::array<float,2>{0.985604167f, 0.878214896f},
-std::array<float,2>{0.203068689f, 0.113865301f},
-std::array<float,2>{0.66394794f, 0.415052503f},
-std::array<float,2>{0.281597674f, 0.654868782f},
-std::array<float,2>{0.74537617f, 0.873347819f},
-std::array<float,2>{0.346511185f, 0.130824372f},
-std::array<float,2>{0.880717993f, 0.37433213f},
-std::array<float,2>{0.145874798f, 0.509893537f},
-std::array<float,2>{0.845614612f, 0.73917371f},
-std::array<float,2>{0.00977555756f, 0.482601643f},
-std::array<float,2>{0.50124824f, 0.0310306586f},
-std::array<float,2>{0.424102336f, 0.961755455f},
-std::array<float,2>{0.637279868f, 0.671986997f},
-std::array<float,2>{0.260740787f, 0.378908545f},
-std::array<float,2>{0.958094299f, 0.0724526644f},
-std::array<float,2>{0.236355886f, 0.936496079f},
-std::array<float,2>{0.770678043f, 0.800315559f},
-std::array<float,2>{0.0769159794f, 0.238408446f},
-std::array<float,2>{0.571114779f, 0.266799867f},
-std::array<float,2>{0.448927701f, 0.599805415f},
-std::array<float,2>{0.558464825f, 0.996445715f},
-std::array<float,2>{0.37694037f, 0.0347760245f},
-std::array<float,2>{0.830589712f, 0.440832049f},
-std::array<float,2>{0.0460712984f, 0.696962416f},
-std::array<float,2>{0.91757679f, 0.53742218f},
-std::array<float,2>{0.187401697f, 0.331103832f},
-std::array<float,2>{0.69937098f, 0.15685913f},
-std::array<float,2>{0.342429608f, 0.827275574f},
-std::array<float,2>{0.714344919f, 0.525604188f},
-std::array<float,2>{0.318733454f, 0.354136527f},
-std::array<float,2>{0.923700809f, 0.147258788f},
-std::array<float,2>{0.161329836f, 0.850875795f},
-std::array<float,2>{0.823834896f, 0.942528665f},
-std::array<float,2>{0.0522685163f, 0.0106863193f},
-std::array<float,2>{0.545395195f, 0.497107685f},
-std::array<float,2>{0.396703809f, 0.723115683f},
-std::array<float,2>{0.584339917f, 0.776274979f},
-std::array<float,2>{0.453571796f, 0.21035406f},
-std::array<float,2>{0.753888428f, 0.302835047f},
-std::array<float,2>{0.0791772157f, 0.570234478f},
-std::array<float,2>{0.949525833f, 0.625282764f},
-std::array<float,2>{0.225438714f, 0.433404297f},
-std::array<float,2>{0.65095365f, 0.108561255f},
-std::array<float,2>{0.278962761f, 0.905313671f},
-std::array<float,2>{0.52180928f, 0.709694862f},
-std::array<float,2>{0.415453941f, 0.457617313f},
-std::array<float,2>{0.864233971f, 0.0549402274f},
-std::array<float,2>{0.0222521108f, 0.978576303f},
-std::array<float,2>{0.900651515f, 0.836116612f},
-std::array<float,2>{0.133991539f, 0.173343539f},
-std::array<float,2>{0.72270447f, 0.323300868f},
-std::array<float,2>{0.373060703f, 0.551623881f},
-std::array<float,2>{0.674574852f, 0.913891673f},
-std::array<float,2>{0.307207793f, 0.082186006f},
-std::array<float,2>{0.974255562f, 0.396914452f},
-std::array<float,2>{0.213060245f, 0.65966624f},
-std::array<float,2>{0.802171946f, 0.615218878f},
-std::array<float,2>{0.112579629f, 0.261164248f},
-std::array<float,2>{0.61759913f, 0.223298952f},
-std::array<float,2>{0.491770148f, 0.781304359f},
-std::array<float,2>{0.506955802f, 0.618834794f},
-std::array<float,2>{0.426871747f, 0.251689613f},
-std::array<float,2>{0.848694444f, 0.233101413f},
-std::array<float,2>{0.0137109477f, 0.793390453f},
-std::array<float,2>{0.876465797f, 0.916671693f},
-std::array<float,2>{0.144080073f, 0.0863032043f},
-std::array<float,2>{0.749535024f, 0.40488559f},
-std::array<float,2>{0.349445641f, 0.665228605f},
-std::array<float,2>{0.656745732f, 0.835751832f},
-std::array<float,2>{0.2859146f, 0.181476146f},
-std::array<float,2>{0.989597142f, 0.315790772f},
-std::array<float,2>{0.199070036f, 0.556283057f},
-std::array<float,2>{0.789805233f, 0.712109983f},
-std::array<float,2>{0.108464435f, 0.467440575f},
-std::array<float,2>{0.603251934f, 0.0529168583f},
-std::array<float,2>{0.469172508f, 0.974706411f},
-std::array<float,2>{0.69844687f, 0.633376122f},
-std::array<float,2>{0.338145703f, 0.425764799f},
-std::array<float,2>{0.919232726f, 0.094598569f},
-std::array<float,2>{0.182130709f, 0.895558119f},
-std::array<float,2>{0.832498014f, 0.769321918f},
-std::array<float,2>{0.0397268236f, 0.215128407f},
-std::array<float,2>{0.558902323f, 0.306530118f},
-std::array<float,2>{0.382547557f, 0.574574172f},
-std::array<float,2>{0.574583292f, 0.948459983f},
-std::array<float,2>{0.451999962f, 0.00311010121f},
-std::array<float,2>{0.765767694f, 0.487084091f},
-std::array<float,2>{0.0723691732f, 0.731972754f},
-std::array<float,2>{0.956317902f, 0.516027629f},
-std::array<float,2>{0.241392255f, 0.349166662f},
-std::array<float,2>{0.635554075f, 0.149332315f},
-std::array<float,2>{0.264624029f, 0.85822618f},
-std::array<float,2>{0.655985773f, 0.539507091f},
-std::array<float,2>{0.276276559f, 0.336019844f},
-std::array<float,2>{0.946849465f, 0.170790985f},
-std::array<float,2>{0.22213228f, 0.815539002f},
-std::array<float,2>{0.756569743f, 0.984679163f},
-std::array<float,2>{0.0826266184f, 0.0428543314f},
-std::array<float,2>{0.579243362f, 0.452887505f},
-std::array<float,2>{0.457551628f, 0.694952428f},
-std::array<float,2>{0.540710211f, 0.812348664f},
-std::array<float,2>{0.393214285f, 0.244584695f},
-std::array<float,2>{0.825463116f, 0.276091725f},
-std::array<float,2>{0.0507581159f, 0.609210312f},
-std::array<float,2>{0.929333925f, 0.680194497f},
-std::array<float,2>{0.157994747f, 0.386145383f},
-std::array<float,2>{0.717489541f, 0.0677758008f},
-std::array<float,2>{0.316195607f, 0.927970886f},
-std::array<float,2>{0.621835172f, 0.746126235f},
-std::array<float,2>{0.485011697f, 0.469895333f},
-std::array<float,2>{0.798295915f, 0.0192997977f},
-std::array<float,2>{0.116117209f, 0.955154777f},
-std::array<float,2>{0.970391631f, 0.866321027f},
-std::array<float,2>{0.218526885f, 0.138474494f},
-std::array<float,2>{0.678933978f, 0.362749845f},
-std::array<float,2>{0.312090158f, 0.507335186f},
-std::array<float,2>{0.721349359f, 0.884266198f},
-std::array<float,2>{0.370989203f, 0.118674412f},
-std::array<float,2>{0.90406388f, 0.408865035f},
-std::array<float,2>{0.139551833f, 0.641458273f},
-std::array<float,2>{0.85953021f, 0.578621089f},
-std::array<float,2>{0.0156943202f, 0.290867895f},
-std::array<float,2>{0.516157746f, 0.199434206f},
-std::array<float,2>{0.421436697f, 0.750520229f},
-std::array<float,2>{0.587783933f, 0.513379395f},
-std::array<float,2>{0.467176497f, 0.368906111f},
-std::array<float,2>{0.758700728f, 0.12592864f},
-std::array<float,2>{0.0885048583f, 0.870264292f},
-std::array<float,2>{0.945208728f, 0.967633724f},
-std::array<float,2>{0.229448974f, 0.0236191731f},
-std::array<float,2>{0.641650677f, 0.477299958f},
-std::array<float,2>{0.271400094f, 0.737188697f},
-std::array<float,2>{0.707687497f, 0.764695764f},
-std::array<float,2>{0.325224936f, 0.194826096f},
-std::array<float,2>{0.934129536f, 0.286442429f},
-std::array<float,2>{0.165406793f, 0.588964462f},
-std::array<float,2>{0.818266451f, 0.649757266f},
-std::array<float,2>{0.0613216013f, 0.420057088f},
-std::array<float,2>{0.538243473f, 0.110663421f},
-std::array<float,2>{0.399180859f, 0.881877661f},
-std::array<float,2>{0.683197439f, 0.703098297f},
-std::array<float,2>{0.297186345f, 0.443415523f},
-std::array<float,2>{0.977707267f, 0.0354485698f},
-std::array<float,2>{0.203598961f, 0.99550736f},
-std::array<float,2>{0.807251334f, 0.821178436f},
-std::array<float,2>{0.121401966f, 0.160577178f},
-std::array<float,2>{0.60969764f, 0.333939195f},
-std::array<float,2>{0.495122671f, 0.53384316f},
-std::array<float,2>{0.530037642f, 0.93228054f},
-std::array<float,2>{0.412890166f, 0.0766553059f},
-std::array<float,2>{0.869137764f, 0.376559496f},
-std::array<float,2>{0.0246373173f, 0.679347873f},
-std::array<float,2>{0.890749753f, 0.596666873f},
-std::array<float,2>{0.132138014f, 0.271149099f},
-std::array<float,2>{0.733055592f, 0.236265987f},
-std::array<float,2>{0.362642974f, 0.803415775f},
-std::array<float,2>{0.741743207f, 0.565257847f},
-std::array<float,2>{0.35929507f, 0.298563987f},
-std::array<float,2>{0.883134782f, 0.205274314f},
-std::array<float,2>{0.151738718f, 0.779216111f},
-std::array<float,2>{0.854111195f, 0.900452971f},
-std::array<float,2>{0.00573328417f, 0.103825092f},
-std::array<float,2>{0.513330638f, 0.436246246f},
-std::array<float,2>{0.43536371f, 0.63066119f},
-std::array<float,2>{0.6005404f, 0.845614731f},
-std::array<float,2>{0.482619792f, 0.142417833f},
-std::array<float,2>{0.78448391f, 0.356614977f},
-std::array<float,2>{0.0951033309f, 0.528565526f},
-std::array<float,2>{0.993256271f, 0.721048653f},
-std::array<float,2>{0.18791683f, 0.495781511f},
-std::array<float,2>{0.670758724f, 0.0137052676f},
-std::array<float,2>{0.290151745f, 0.94023335f},
-std::array<float,2>{0.548415065f, 0.663345754f},
-std::array<float,2>{0.384623557f, 0.39402917f},
-std::array<float,2>{0.842126727f, 0.0786935538f},
-std::array<float,2>{0.0333556943f, 0.90872103f},
-std::array<float,2>{0.911093354f, 0.785800636f},
-std::array<float,2>{0.174351707f, 0.219539627f},
-std::array<float,2>{0.691254795f, 0.26478368f},
-std::array<float,2>{0.331899494f, 0.611192346f},
-std::array<float,2>{0.626897395f, 0.981105924f},
-std::array<float,2>{0.255227774f, 0.0617387109f},
-std::array<float,2>{0.965737164f, 0.456674576f},
-std::array<float,2>{0.248673975f, 0.706898332f},
-std::array<float,2>{0.779653847f, 0.550426602f},
-std::array<float,2>{0.0688006058f, 0.326119363f},
-std::array<float,2>{0.566364169f, 0.177908614f},
-std::array<float,2>{0.443079859f, 0.840672493f},
-std::array<float,2>{0.509796202f, 0.54497242f},
-std::array<float,2>{0.429887772f, 0.34188211f},
-std::array<float,2>{0.85919863f, 0.166601405f},
-std::array<float,2>{0.00024054019f, 0.817107558f},
-std::array<float,2>{0.888073862f, 0.990473211f},
-std::array<float,2>{0.156146005f, 0.0440722033f},
-std::array<float,2>{0.738051593f, 0.445892245f},
-std::array<float,2>{0.354395419f, 0.690007031f},
-std::array<float,2>{0.66433692f, 0.805699408f},
-std::array<float,2>{0.293942302f, 0.248719752f},
-std::array<float,2>{0.997014463f, 0.280251652f},
-std::array<float,2>{0.194098264f, 0.605085313f},
-std::array<float,2>{0.785424352f, 0.686994493f},
-std::array<float,2>{0.0982580781f, 0.3883968f},
-std::array<float,2>{0.597197652f, 0.0654963478f},
-std::array<float,2>{0.479453623f, 0.92297709f},
-std::array<float,2>{0.694275737f, 0.743590653f},
-std::array<float,2>{0.335250705f, 0.474160016f},
-std::array<float,2>{0.910057068f, 0.0234220568f},
-std::array<float,2>{0.178380728f, 0.959171355f},
-std::array<float,2>{0.839648962f, 0.862564743f},
-std::array<float,2>{0.0389502235f, 0.136306331f},
-std::array<float,2>{0.551274419f, 0.363354504f},
-std::array<float,2>{0.387208521f, 0.502691329f},
-std::array<float,2>{0.569959998f, 0.889207482f},
-std::array<float,2>{0.439293891f, 0.121458218f},
-std::array<float,2>{0.77460134f, 0.411239177f},
-std::array<float,2>{0.0654634908f, 0.644690871f},
-std::array<float,2>{0.962844431f, 0.582695782f},
-std::array<float,2>{0.2458404f, 0.294621289f},
-std::array<float,2>{0.629601419f, 0.198628619f},
-std::array<float,2>{0.253842115f, 0.756428182f},
-std::array<float,2>{0.644999921f, 0.623456657f},
-std::array<float,2>{0.267316043f, 0.254790753f},
-std::array<float,2>{0.938690484f, 0.228702962f},
-std::array<float,2>{0.23380971f, 0.790899336f},
-std::array<float,2>{0.762755692f, 0.919175923f},
-std::array<float,2>{0.0911764279f, 0.0907235742f},
-std::array<float,2>{0.590303719f, 0.401064247f},
-std::array<float,2>{0.461558342f, 0.671118796f},
-std::array<float,2>{0.533964336f, 0.829525173f},
-std::array<float,2>{0.4051781f, 0.185307801f},
-std::array<float,2>{0.813870609f, 0.319433957f},
-std::array<float,2>{0.0571425408f, 0.559514821f},
-std::array<float,2>{0.931894243f, 0.717624187f},
-std::array<float,2>{0.168275505f, 0.463282675f},
-std::array<float,2>{0.705295622f, 0.0476204529f},
-std::array<float,2>{0.323258847f, 0.971717656f},
-std::array<float,2>{0.613698244f, 0.640106797f},
-std::array<float,2>{0.49780944f, 0.42838034f},
-std::array<float,2>{0.811639071f, 0.0993071347f},
-std::array<float,2>{0.120587096f, 0.890837908f},
-std::array<float,2>{0.9811216f, 0.769918263f},
-std::array<float,2>{0.208723634f, 0.212460697f},
-std::array<float,2>{0.6864627f, 0.308709413f},
-std::array<float,2>{0.303299099f, 0.570945442f},
-std::array<float,2>{0.726613879f, 0.949918985f},
-std::array<float,2>{0.364492804f, 0.00692144362f},
-std::array<float,2>{0.898169041f, 0.489402473f},
-std::array<float,2>{0.126159102f, 0.726715863f},
-std::array<float,2>{0.874685526f, 0.522004664f},
-std::array<float,2>{0.0274461955f, 0.346541226f},
-std::array<float,2>{0.526797652f, 0.154322952f},
-std::array<float,2>{0.409791738f, 0.852936029f},
-std::array<float,2>{0.582638443f, 0.568541646f},
-std::array<float,2>{0.455715567f, 0.303919166f},
-std::array<float,2>{0.751220167f, 0.209036589f},
-std::array<float,2>{0.0801104382f, 0.776889265f},
-std::array<float,2>{0.952687979f, 0.905081391f},
-std::array<float,2>{0.223445952f, 0.107650228f},
-std::array<float,2>{0.64942342f, 0.432230532f},
-std::array<float,2>{0.280109465f, 0.626673996f},
-std::array<float,2>{0.711895406f, 0.850416958f},
-std::array<float,2>{0.316931456f, 0.14834182f},
-std::array<float,2>{0.924390078f, 0.355436593f},
-std::array<float,2>{0.162282586f, 0.527341187f},
-std::array<float,2>{0.821073413f, 0.723728418f},
-std::array<float,2>{0.0532323457f, 0.496195257f},
-std::array<float,2>{0.54339695f, 0.0115035754f},
-std::array<float,2>{0.395772338f, 0.94212091f},
-std::array<float,2>{0.673746765f, 0.658211887f},
-std::array<float,2>{0.305500597f, 0.397895366f},
-std::array<float,2>{0.975145042f, 0.0831028149f},
-std::array<float,2>{0.212128744f, 0.912390351f},
-std::array<float,2>{0.804635227f, 0.782486796f},
-std::array<float,2>{0.110760897f, 0.224337503f},
-std::array<float,2>{0.620266318f, 0.260459542f},
-std::array<float,2>{0.488360524f, 0.613712668f},
-std::array<float,2>{0.520389378f, 0.979603767f},
-std::array<float,2>{0.416705012f, 0.0558810867f},
-std::array<float,2>{0.866717458f, 0.458185643f},
-std::array<float,2>{0.0203386378f, 0.710686326f},
-std::array<float,2>{0.898638606f, 0.552296937f},
-std::array<float,2>{0.135466397f, 0.322573781f},
-std::array<float,2>{0.725584745f, 0.172760472f},
-std::array<float,2>{0.371274173f, 0.837370515f},
-std::array<float,2>{0.742409885f, 0.511134565f},
-std::array<float,2>{0.345195234f, 0.373554409f},
-std::array<float,2>{0.881439507f, 0.129733369f},
-std::array<float,2>{0.148349643f, 0.87495482f},
-std::array<float,2>{0.847239017f, 0.962300956f},
-std::array<float,2>{0.00952410977f, 0.029339591f},
-std::array<float,2>{0.503405809f, 0.483712107f},
-std::array<float,2>{0.42353341f, 0.740088165f},
-std::array<float,2>{0.605518997f, 0.760590494f},
-std::array<float,2>{0.475539923f, 0.188298866f},
-std::array<float,2>{0.795129001f, 0.284250975f},
-std::array<float,2>{0.102595903f, 0.592067361f},
-std::array<float,2>{0.987153292f, 0.655368447f},
-std::array<float,2>{0.200037703f, 0.414947271f},
-std::array<float,2>{0.661973238f, 0.115083262f},
-std::array<float,2>{0.284115225f, 0.877774715f},
-std::array<float,2>{0.554815412f, 0.695344567f},
-std::array<float,2>{0.378003001f, 0.43954587f},
-std::array<float,2>{0.828553855f, 0.0336206034f},
-std::array<float,2>{0.04381736f, 0.997100949f},
-std::array<float,2>{0.914847732f, 0.826927066f},
-std::array<float,2>{0.184444323f, 0.157400966f},
-std::array<float,2>{0.703086972f, 0.330324858f},
-std::array<float,2>{0.340367705f, 0.538094938f},
-std::array<float,2>{0.638875604f, 0.936729908f},
-std::array<float,2>{0.25874573f, 0.0736683235f},
-std::array<float,2>{0.960634887f, 0.380492717f},
-std::array<float,2>{0.235538796f, 0.673027515f},
-std::array<float,2>{0.773200154f, 0.601349592f},
-std::array<float,2>{0.074638471f, 0.266536027f},
-std::array<float,2>{0.572346509f, 0.239808843f},
-std::array<float,2>{0.445643067f, 0.799165487f},
-std::array<float,2>{0.542345166f, 0.608229697f},
-std::array<float,2>{0.390898257f, 0.276656687f},
-std::array<float,2>{0.827275813f, 0.245649979f},
-std::array<float,2>{0.0484810844f, 0.810908556f},
-std::array<float,2>{0.927129447f, 0.929113388f},
-std::array<float,2>{0.158269376f, 0.06694334f},
-std::array<float,2>{0.715101182f, 0.385291874f},
-std::array<float,2>{0.312927186f, 0.681527019f},
-std::array<float,2>{0.65353471f, 0.814941466f},
-std::array<float,2>{0.273791194f, 0.171282172f},
-std::array<float,2>{0.947622657f, 0.33744958f},
-std::array<float,2>{0.218996361f, 0.540785193f},
-std::array<float,2>{0.753966749f, 0.693904936f},
-std::array<float,2>{0.0843137279f, 0.451759696f},
-std::array<float,2>{0.580089748f, 0.0412744805f},
-std::array<float,2>{0.460533887f, 0.985358357f},
-std::array<float,2>{0.72037071f, 0.642015517f},
-std::array<float,2>{0.367811769f, 0.409744501f},
-std::array<float,2>{0.905013323f, 0.1174955f},
-std::array<float,2>{0.137201265f, 0.883533955f},
-std::array<float,2>{0.863218606f, 0.751227796f},
-std::array<float,2>{0.0182411876f, 0.200841084f},
-std::array<float,2>{0.517811716f, 0.28969723f},
-std::array<float,2>{0.419277072f, 0.579390168f},
-std::array<float,2>{0.624328792f, 0.956212223f},
-std::array<float,2>{0.487802297f, 0.0181527976f},
-std::array<float,2>{0.799076736f, 0.46885553f},
-std::array<float,2>{0.113788031f, 0.74749577f},
-std::array<float,2>{0.971992314f, 0.506113231f},
-std::array<float,2>{0.215073854f, 0.361496359f},
-std::array<float,2>{0.675970018f, 0.137346059f},
-std::array<float,2>{0.309137732f, 0.865437448f},
-std::array<float,2>{0.659152925f, 0.55558151f},
-std::array<float,2>{0.288032889f, 0.315108657f},
-std::array<float,2>{0.992082179f, 0.180468887f},
-std::array<float,2>{0.195531711f, 0.834136188f},
-std::array<float,2>{0.79226768f, 0.976259947f},
-std::array<float,2>{0.106716655f, 0.054014843f},
-std::array<float,2>{0.604766309f, 0.468470961f},
-std::array<float,2>{0.47077319f, 0.711636961f},
-std::array<float,2>{0.505108237f, 0.794551492f},
-std::array<float,2>{0.429309011f, 0.233848438f},
-std::array<float,2>{0.850110888f, 0.250795215f},
-std::array<float,2>{0.0117218383f, 0.6172297f},
-std::array<float,2>{0.878672183f, 0.664164424f},
-std::array<float,2>{0.140739352f, 0.406166315f},
-std::array<float,2>{0.747555137f, 0.0875289962f},
-std::array<float,2>{0.350348145f, 0.917081416f},
-std::array<float,2>{0.578046978f, 0.730683982f},
-std::array<float,2>{0.449701607f, 0.488254339f},
-std::array<float,2>{0.769061029f, 0.00279308436f},
-std::array<float,2>{0.071565263f, 0.947615981f},
-std::array<float,2>{0.953933895f, 0.858714283f},
-std::array<float,2>{0.238539949f, 0.150294468f},
-std::array<float,2>{0.634424031f, 0.347906351f},
-std::array<float,2>{0.262659073f, 0.516992033f},
-std::array<float,2>{0.696393669f, 0.894774079f},
-std::array<float,2>{0.336920321f, 0.0951615646f},
-std::array<float,2>{0.921039283f, 0.424746275f},
-std::array<float,2>{0.181110114f, 0.634447396f},
-std::array<float,2>{0.835769773f, 0.575910985f},
-std::array<float,2>{0.0411625355f, 0.304936558f},
-std::array<float,2>{0.561822534f, 0.216128871f},
-std::array<float,2>{0.380517066f, 0.767680585f},
-std::array<float,2>{0.598868251f, 0.527812719f},
-std::array<float,2>{0.481006056f, 0.35596621f},
-std::array<float,2>{0.781458914f, 0.14154245f},
-std::array<float,2>{0.0974590853f, 0.843954623f},
-std::array<float,2>{0.995657921f, 0.941142142f},
-std::array<float,2>{0.190415889f, 0.0152202873f},
-std::array<float,2>{0.668762207f, 0.495110542f},
-std::array<float,2>{0.291892529f, 0.721967995f},
-std::array<float,2>{0.73891598f, 0.777605653f},
-std::array<float,2>{0.356005162f, 0.206093043f},
-std::array<float,2>{0.885494769f, 0.296976656f},
-std::array<float,2>{0.150211424f, 0.565661371f},
-std::array<float,2>{0.851744294f, 0.629506588f},
-std::array<float,2>{0.00718876859f, 0.437323421f},
-std::array<float,2>{0.514022946f, 0.105012745f},
-std::array<float,2>{0.437478065f, 0.902242899f},
-std::array<float,2>{0.628483593f, 0.70569694f},
-std::array<float,2>{0.256793141f, 0.456044942f},
-std::array<float,2>{0.968745947f, 0.0615018308f},
-std::array<float,2>{0.246281311f, 0.982388616f},
-std::array<float,2>{0.779286861f, 0.841100454f},
-std::array<float,2>{0.0675582141f, 0.178785548f},
-std::array<float,2>{0.563214719f, 0.324817628f},
-std::array<float,2>{0.445277423f, 0.549028695f},
-std::array<float,2>{0.549226582f, 0.909435451f},
-std::array<float,2>{0.386541396f, 0.0798090249f},
-std::array<float,2>{0.84008646f, 0.393386543f},
-std::array<float,2>{0.0328613631f, 0.662913144f},
-std::array<float,2>{0.912482679f, 0.60942626f},
-std::array<float,2>{0.173470944f, 0.264332235f},
-std::array<float,2>{0.688893735f, 0.220023423f},
-std::array<float,2>{0.329929113f, 0.786134124f},
-std::array<float,2>{0.709856033f, 0.588152647f},
-std::array<float,2>{0.32644698f, 0.285870343f},
-std::array<float,2>{0.936574519f, 0.193482965f},
-std::array<float,2>{0.166633055f, 0.76418072f},
-std::array<float,2>{0.81941247f, 0.881821454f},
-std::array<float,2>{0.0591921732f, 0.110342138f},
-std::array<float,2>{0.535782814f, 0.421462268f},
-std::array<float,2>{0.402040094f, 0.649136126f},
-std::array<float,2>{0.589306831f, 0.869668126f},
-std::array<float,2>{0.466754228f, 0.126232862f},
-std::array<float,2>{0.761600852f, 0.367359519f},
-std::array<float,2>{0.0868313313f, 0.512691557f},
-std::array<float,2>{0.9426952f, 0.737650275f},
-std::array<float,2>{0.227362037f, 0.477754027f},
-std::array<float,2>{0.643999457f, 0.0247554202f},
-std::array<float,2>{0.27284807f, 0.968458295f},
-std::array<float,2>{0.527464092f, 0.678300321f},
-std::array<float,2>{0.411867499f, 0.375300795f},
-std::array<float,2>{0.870349824f, 0.0777238682f},
-std::array<float,2>{0.0262513701f, 0.93292141f},
-std::array<float,2>{0.894259155f, 0.804242015f},
-std::array<float,2>{0.129835233f, 0.235254422f},
-std::array<float,2>{0.731207132f, 0.269872576f},
-std::array<float,2>{0.361248404f, 0.596938491f},
-std::array<float,2>{0.680067778f, 0.994601727f},
-std::array<float,2>{0.300080538f, 0.0368094184f},
-std::array<float,2>{0.979509175f, 0.444449812f},
-std::array<float,2>{0.205367103f, 0.701296747f},
-std::array<float,2>{0.805521131f, 0.534793377f},
-std::array<float,2>{0.123889953f, 0.332196355f},
-std::array<float,2>{0.611721456f, 0.161751613f},
-std::array<float,2>{0.494027674f, 0.821926117f},
-std::array<float,2>{0.55414474f, 0.501574695f},
-std::array<float,2>{0.3894732f, 0.366897702f},
-std::array<float,2>{0.837755561f, 0.133129537f},
-std::array<float,2>{0.0356077738f, 0.86054951f},
-std::array<float,2>{0.906745851f, 0.958409965f},
-std::array<float,2>{0.177729681f, 0.0199633073f},
-std::array<float,2>{0.691863954f, 0.476544112f},
-std::array<float,2>{0.332226515f, 0.74437815f},
-std::array<float,2>{0.631812036f, 0.754263639f},
-std::array<float,2>{0.251584709f, 0.196184054f},
-std::array<float,2>{0.964597046f, 0.295965672f},
-std::array<float,2>{0.243896171f, 0.584322512f},
-std::array<float,2>{0.775956154f, 0.647538781f},
-std::array<float,2>{0.0628467277f, 0.412340194f},
-std::array<float,2>{0.567816436f, 0.124903634f},
-std::array<float,2>{0.441020429f, 0.886870921f},
-std::array<float,2>{0.735684693f, 0.687544405f},
-std::array<float,2>{0.352488399f, 0.448560059f},
-std::array<float,2>{0.889557183f, 0.0450723022f},
-std::array<float,2>{0.154160023f, 0.990095437f},
-std::array<float,2>{0.856890261f, 0.819813013f},
-std::array<float,2>{0.00299746287f, 0.166012764f},
-std::array<float,2>{0.507901549f, 0.340080142f},
-std::array<float,2>{0.433408588f, 0.543628752f},
-std::array<float,2>{0.594990313f, 0.923896611f},
-std::array<float,2>{0.477140009f, 0.0635779873f},
-std::array<float,2>{0.787785888f, 0.38935113f},
-std::array<float,2>{0.10049741f, 0.685111046f},
-std::array<float,2>{0.998555124f, 0.601641595f},
-std::array<float,2>{0.193318352f, 0.277632445f},
-std::array<float,2>{0.66729641f, 0.246792451f},
-std::array<float,2>{0.296199411f, 0.808525741f},
-std::array<float,2>{0.685455918f, 0.574038744f},
-std::array<float,2>{0.301968604f, 0.310750842f},
-std::array<float,2>{0.983088374f, 0.214414194f},
-std::array<float,2>{0.210686967f, 0.771951675f},
-std::array<float,2>{0.809969962f, 0.894370139f},
-std::array<float,2>{0.118196361f, 0.101013407f},
-std::array<float,2>{0.615996599f, 0.427040398f},
-std::array<float,2>{0.499612093f, 0.638227344f},
-std::array<float,2>{0.524740815f, 0.854495764f},
-std::array<float,2>{0.407791406f, 0.152513996f},
-std::array<float,2>{0.871411383f, 0.345378429f},
-std::array<float,2>{0.0299422275f, 0.520183146f},
-std::array<float,2>{0.896211088f, 0.730382383f},
-std::array<float,2>{0.127819836f, 0.490532428f},
-std::array<float,2>{0.729029834f, 0.00400912156f},
-std::array<float,2>{0.366544545f, 0.952503443f},
-std::array<float,2>{0.592610955f, 0.669624865f},
-std::array<float,2>{0.46348533f, 0.400267929f},
-std::array<float,2>{0.765529037f, 0.0936481357f},
-std::array<float,2>{0.0934496522f, 0.921379983f},
-std::array<float,2>{0.940859258f, 0.791424155f},
-std::array<float,2>{0.230582312f, 0.227768958f},
-std::array<float,2>{0.64657253f, 0.257606238f},
-std::array<float,2>{0.268481135f, 0.622155309f},
-std::array<float,2>{0.704717696f, 0.969959915f},
-std::array<float,2>{0.321684897f, 0.0488575287f},
-std::array<float,2>{0.931431174f, 0.461483002f},
-std::array<float,2>{0.170569122f, 0.715603769f},
-std::array<float,2>{0.815722466f, 0.561078131f},
-std::array<float,2>{0.054924354f, 0.31788215f},
-std::array<float,2>{0.532453775f, 0.186410204f},
-std::array<float,2>{0.402362943f, 0.831295907f},
-std::array<float,2>{0.618801534f, 0.6168347f},
-std::array<float,2>{0.490817666f, 0.258495301f},
-std::array<float,2>{0.801418781f, 0.225942403f},
-std::array<float,2>{0.112178743f, 0.784090996f},
-std::array<float,2>{0.973142326f, 0.911933661f},
-std::array<float,2>{0.214643031f, 0.0843703747f},
-std::array<float,2>{0.67525363f, 0.396322757f},
-std::array<float,2>{0.30798319f, 0.656635702f},
-std::array<float,2>{0.724271357f, 0.839643598f},
-std::array<float,2>{0.374874085f, 0.174161926f},
-std::array<float,2>{0.901793659f, 0.321143866f},
-std::array<float,2>{0.133647606f, 0.5534181f},
-std::array<float,2>{0.865159571f, 0.708208919f},
-std::array<float,2>{0.0227153245f, 0.460298926f},
-std::array<float,2>{0.522690237f, 0.0585047752f},
-std::array<float,2>{0.414682925f, 0.976749301f},
-std::array<float,2>{0.652117014f, 0.628660262f},
-std::array<float,2>{0.277403384f, 0.43045342f},
-std::array<float,2>{0.951018393f, 0.107325293f},
-std::array<float,2>{0.225694984f, 0.903923512f},
-std::array<float,2>{0.752324343f, 0.77484566f},
-std::array<float,2>{0.0784513056f, 0.207871944f},
-std::array<float,2>{0.585818052f, 0.302023262f},
-std::array<float,2>{0.454562664f, 0.568237364f},
-std::array<float,2>{0.546172798f, 0.943566442f},
-std::array<float,2>{0.398425847f, 0.00867173448f},
-std::array<float,2>{0.823005319f, 0.498470873f},
-std::array<float,2>{0.051556427f, 0.725984752f},
-std::array<float,2>{0.922542512f, 0.525153637f},
-std::array<float,2>{0.160408348f, 0.352654755f},
-std::array<float,2>{0.712964714f, 0.146479934f},
-std::array<float,2>{0.320269257f, 0.848907769f},
-std::array<float,2>{0.700446665f, 0.536374748f},
-std::array<float,2>{0.343331099f, 0.329747885f},
-std::array<float,2>{0.916468561f, 0.158507109f},
-std::array<float,2>{0.186327562f, 0.825383782f},
-std::array<float,2>{0.831890047f, 0.999529541f},
-std::array<float,2>{0.0450036563f, 0.0328120813f},
-std::array<float,2>{0.55738014f, 0.439247906f},
-std::array<float,2>{0.375575513f, 0.697824657f},
-std::array<float,2>{0.571315765f, 0.798569739f},
-std::array<float,2>{0.447420329f, 0.240651354f},
-std::array<float,2>{0.77006346f, 0.269188166f},
-std::array<float,2>{0.0772031546f, 0.598380327f},
-std::array<float,2>{0.957546473f, 0.674895465f},
-std::array<float,2>{0.238158971f, 0.381608635f},
-std::array<float,2>{0.638052821f, 0.0721319094f},
-std::array<float,2>{0.26100871f, 0.93485117f},
-std::array<float,2>{0.500056505f, 0.741795301f},
-std::array<float,2>{0.425661534f, 0.481972247f},
-std::array<float,2>{0.843901455f, 0.0281607118f},
-std::array<float,2>{0.0109659536f, 0.964456201f},
-std::array<float,2>{0.879719079f, 0.871722281f},
-std::array<float,2>{0.144840583f, 0.132205203f},
-std::array<float,2>{0.744541347f, 0.371481299f},
-std::array<float,2>{0.34754777f, 0.509130895f},
-std::array<float,2>{0.662809253f, 0.87637347f},
-std::array<float,2>{0.283156753f, 0.116941221f},
-std::array<float,2>{0.984896004f, 0.417738527f},
-std::array<float,2>{0.202122763f, 0.653849661f},
-std::array<float,2>{0.794742942f, 0.591286659f},
-std::array<float,2>{0.104157984f, 0.282023311f},
-std::array<float,2>{0.608172953f, 0.19031094f},
-std::array<float,2>{0.47370398f, 0.759678602f},
-std::array<float,2>{0.516710699f, 0.58077836f},
-std::array<float,2>{0.420184314f, 0.292329848f},
-std::array<float,2>{0.860774159f, 0.201337367f},
-std::array<float,2>{0.0170863047f, 0.753744304f},
-std::array<float,2>{0.90261662f, 0.885933578f},
-std::array<float,2>{0.139920771f, 0.119352974f},
-std::array<float,2>{0.722058535f, 0.406734586f},
-std::array<float,2>{0.369680583f, 0.643411756f},
-std::array<float,2>{0.678216577f, 0.864264667f},
-std::array<float,2>{0.311097622f, 0.13957864f},
-std::array<float,2>{0.969658554f, 0.360362202f},
-std::array<float,2>{0.217370108f, 0.503956735f},
-std::array<float,2>{0.797847331f, 0.748412609f},
-std::array<float,2>{0.11715395f, 0.471075863f},
-std::array<float,2>{0.622477174f, 0.0160353724f},
-std::array<float,2>{0.485559404f, 0.954873562f},
-std::array<float,2>{0.717971385f, 0.682508826f},
-std::array<float,2>{0.314733833f, 0.382832766f},
-std::array<float,2>{0.928184986f, 0.0699953139f},
-std::array<float,2>{0.156271398f, 0.926337183f},
-std::array<float,2>{0.824770808f, 0.810485005f},
-std::array<float,2>{0.0491573177f, 0.242295146f},
-std::array<float,2>{0.539579749f, 0.274919331f},
-std::array<float,2>{0.39389655f, 0.607139289f},
-std::array<float,2>{0.578216851f, 0.98694253f},
-std::array<float,2>{0.458048105f, 0.0395197496f},
-std::array<float,2>{0.757670164f, 0.451038063f},
-std::array<float,2>{0.0831777677f, 0.692382336f},
-std::array<float,2>{0.94534874f, 0.541864514f},
-std::array<float,2>{0.221178815f, 0.338979959f},
-std::array<float,2>{0.654458404f, 0.169793427f},
-std::array<float,2>{0.276639849f, 0.813821614f},
-std::array<float,2>{0.636396766f, 0.518963099f},
-std::array<float,2>{0.265403301f, 0.350287467f},
-std::array<float,2>{0.955150366f, 0.151828185f},
-std::array<float,2>{0.240604639f, 0.85558337f},
-std::array<float,2>{0.766934931f, 0.945809543f},
-std::array<float,2>{0.0741008669f, 0.00158167945f},
-std::array<float,2>{0.576083422f, 0.485326231f},
-std::array<float,2>{0.452977836f, 0.734200537f},
-std::array<float,2>{0.560059428f, 0.767383456f},
-std::array<float,2>{0.38176316f, 0.217075467f},
-std::array<float,2>{0.833329856f, 0.307304114f},
-std::array<float,2>{0.0401268676f, 0.577954054f},
-std::array<float,2>{0.918260992f, 0.636022389f},
-std::array<float,2>{0.182762817f, 0.422642767f},
-std::array<float,2>{0.697362185f, 0.0964435339f},
-std::array<float,2>{0.339256704f, 0.897341669f},
-std::array<float,2>{0.602485001f, 0.713690341f},
-std::array<float,2>{0.470451742f, 0.465053767f},
-std::array<float,2>{0.790463686f, 0.0524850599f},
-std::array<float,2>{0.108021937f, 0.972797692f},
-std::array<float,2>{0.988978386f, 0.832436919f},
-std::array<float,2>{0.197481453f, 0.182318687f},
-std::array<float,2>{0.657885075f, 0.31359446f},
-std::array<float,2>{0.286628991f, 0.557222605f},
-std::array<float,2>{0.74842751f, 0.915666997f},
-std::array<float,2>{0.348493993f, 0.0893453583f},
-std::array<float,2>{0.875576913f, 0.402734697f},
-std::array<float,2>{0.143091589f, 0.667086244f},
-std::array<float,2>{0.847777307f, 0.620892167f},
-std::array<float,2>{0.015395957f, 0.253356934f},
-std::array<float,2>{0.506298542f, 0.230800301f},
-std::array<float,2>{0.426443577f, 0.795292318f},
-std::array<float,2>{0.565374315f, 0.546959221f},
-std::array<float,2>{0.442153394f, 0.327486366f},
-std::array<float,2>{0.780534923f, 0.177399442f},
-std::array<float,2>{0.0694684833f, 0.842340648f},
-std::array<float,2>{0.96631211f, 0.983539402f},
-std::array<float,2>{0.249126837f, 0.0600403808f},
-std::array<float,2>{0.625116885f, 0.455041438f},
-std::array<float,2>{0.254519463f, 0.703561664f},
-std::array<float,2>{0.690419972f, 0.787207007f},
-std::array<float,2>{0.330984145f, 0.222598836f},
-std::array<float,2>{0.91157949f, 0.262724072f},
-std::array<float,2>{0.175766066f, 0.611525774f},
-std::array<float,2>{0.842915237f, 0.66021955f},
-std::array<float,2>{0.0342217684f, 0.391763091f},
-std::array<float,2>{0.547608256f, 0.0805198252f},
-std::array<float,2>{0.383139819f, 0.906817734f},
-std::array<float,2>{0.671654165f, 0.719115376f},
-std::array<float,2>{0.289383858f, 0.493989289f},
-std::array<float,2>{0.992392361f, 0.0123901665f},
-std::array<float,2>{0.188480228f, 0.939168274f},
-std::array<float,2>{0.784176052f, 0.846346736f},
-std::array<float,2>{0.0942424908f, 0.14326337f},
-std::array<float,2>{0.601275861f, 0.357549667f},
-std::array<float,2>{0.483949989f, 0.529919386f},
-std::array<float,2>{0.512067676f, 0.89875412f},
-std::array<float,2>{0.434467107f, 0.102187224f},
-std::array<float,2>{0.855338275f, 0.435396552f},
-std::array<float,2>{0.00436888589f, 0.632604599f},
-std::array<float,2>{0.884708047f, 0.564114213f},
-std::array<float,2>{0.150603399f, 0.299019396f},
-std::array<float,2>{0.741111457f, 0.204878196f},
-std::array<float,2>{0.357567728f, 0.780245662f},
-std::array<float,2>{0.733524978f, 0.595109224f},
-std::array<float,2>{0.362135857f, 0.272304952f},
-std::array<float,2>{0.892263114f, 0.238220051f},
-std::array<float,2>{0.13118954f, 0.800843537f},
-std::array<float,2>{0.868138731f, 0.931536913f},
-std::array<float,2>{0.023576811f, 0.0746028945f},
-std::array<float,2>{0.530356765f, 0.377917349f},
-std::array<float,2>{0.413624734f, 0.677668214f},
-std::array<float,2>{0.611156702f, 0.823759317f},
-std::array<float,2>{0.494604468f, 0.163045704f},
-std::array<float,2>{0.807660699f, 0.335688382f},
-std::array<float,2>{0.123025805f, 0.532842338f},
-std::array<float,2>{0.977015615f, 0.699592113f},
-std::array<float,2>{0.204998627f, 0.442470014f},
-std::array<float,2>{0.682600081f, 0.0387549326f},
-std::array<float,2>{0.298033446f, 0.994038284f},
-std::array<float,2>{0.537701309f, 0.650914192f},
-std::array<float,2>{0.399907023f, 0.419521779f},
-std::array<float,2>{0.817222536f, 0.112063259f},
-std::array<float,2>{0.0624498464f, 0.879983366f},
-std::array<float,2>{0.934888005f, 0.762936234f},
-std::array<float,2>{0.164491042f, 0.192246675f},
-std::array<float,2>{0.708272517f, 0.288491875f},
-std::array<float,2>{0.324269444f, 0.587033033f},
-std::array<float,2>{0.640819848f, 0.966115534f},
-std::array<float,2>{0.2699247f, 0.0255865827f},
-std::array<float,2>{0.943552434f, 0.479924649f},
-std::array<float,2>{0.229918852f, 0.736083865f},
-std::array<float,2>{0.759734333f, 0.515446723f},
-std::array<float,2>{0.0894962847f, 0.370796233f},
-std::array<float,2>{0.586314082f, 0.128448829f},
-std::array<float,2>{0.467988938f, 0.867221475f},
-std::array<float,2>{0.503604352f, 0.509371459f},
-std::array<float,2>{0.423044235f, 0.371807963f},
-std::array<float,2>{0.846917629f, 0.132348776f},
-std::array<float,2>{0.00927277561f, 0.871209264f},
-std::array<float,2>{0.881141067f, 0.964180589f},
-std::array<float,2>{0.147492439f, 0.027551638f},
-std::array<float,2>{0.742678523f, 0.481554002f},
-std::array<float,2>{0.345228374f, 0.741263568f},
-std::array<float,2>{0.661525071f, 0.758981824f},
-std::array<float,2>{0.28335765f, 0.189545676f},
-std::array<float,2>{0.986506879f, 0.281481385f},
-std::array<float,2>{0.199262828f, 0.591441274f},
-std::array<float,2>{0.795858324f, 0.653776884f},
-std::array<float,2>{0.103423513f, 0.417402238f},
-std::array<float,2>{0.606077731f, 0.116574205f},
-std::array<float,2>{0.47505787f, 0.876466572f},
-std::array<float,2>{0.702587962f, 0.69745928f},
-std::array<float,2>{0.340232551f, 0.438754737f},
-std::array<float,2>{0.914207458f, 0.0323914513f},
-std::array<float,2>{0.183683887f, 0.999208272f},
-std::array<float,2>{0.82883954f, 0.825961947f},
-std::array<float,2>{0.043390695f, 0.159093484f},
-std::array<float,2>{0.555515885f, 0.329213977f},
-std::array<float,2>{0.3786259f, 0.536767542f},
-std::array<float,2>{0.572886705f, 0.935356319f},
-std::array<float,2>{0.446127266f, 0.0713626668f},
-std::array<float,2>{0.772627473f, 0.381188095f},
-std::array<float,2>{0.0748614818f, 0.675449789f},
-std::array<float,2>{0.9599787f, 0.597774565f},
-std::array<float,2>{0.235977978f, 0.268742204f},
-std::array<float,2>{0.639475226f, 0.240778953f},
-std::array<float,2>{0.258242548f, 0.797909081f},
-std::array<float,2>{0.650098503f, 0.567715883f},
-std::array<float,2>{0.279723138f, 0.302541465f},
-std::array<float,2>{0.952469647f, 0.207324788f},
-std::array<float,2>{0.222750708f, 0.774985075f},
-std::array<float,2>{0.751881063f, 0.903340816f},
-std::array<float,2>{0.0808316618f, 0.10670583f},
-std::array<float,2>{0.582131326f, 0.430140734f},
-std::array<float,2>{0.455082268f, 0.628326416f},
-std::array<float,2>{0.543897271f, 0.849449694f},
-std::array<float,2>{0.396240473f, 0.145686418f},
-std::array<float,2>{0.820548296f, 0.35304442f},
-std::array<float,2>{0.0528257303f, 0.524768829f},
-std::array<float,2>{0.924036741f, 0.726187289f},
-std::array<float,2>{0.162806749f, 0.498659492f},
-std::array<float,2>{0.711274207f, 0.00821087323f},
-std::array<float,2>{0.316591412f, 0.943903029f},
-std::array<float,2>{0.6209445f, 0.657066882f},
-std::array<float,2>{0.488988042f, 0.395925671f},
-std::array<float,2>{0.803763032f, 0.0845637843f},
-std::array<float,2>{0.11088223f, 0.911192775f},
-std::array<float,2>{0.974841475f, 0.783317327f},
-std::array<float,2>{0.21278888f, 0.226444036f},
-std::array<float,2>{0.673060894f, 0.257892251f},
-std::array<float,2>{0.30493322f, 0.616254508f},
-std::array<float,2>{0.724998653f, 0.977245331f},
-std::array<float,2>{0.371772766f, 0.0577504598f},
-std::array<float,2>{0.89934659f, 0.460466802f},
-std::array<float,2>{0.135227919f, 0.708695233f},
-std::array<float,2>{0.866666734f, 0.552872956f},
-std::array<float,2>{0.0197596736f, 0.320341378f},
-std::array<float,2>{0.519956708f, 0.174563646f},
-std::array<float,2>{0.416407436f, 0.839206338f},
-std::array<float,2>{0.590733886f, 0.622795641f},
-std::array<float,2>{0.460999906f, 0.256968111f},
-std::array<float,2>{0.763531089f, 0.228141233f},
-std::array<float,2>{0.0913417786f, 0.791756928f},
-std::array<float,2>{0.939040959f, 0.92160511f},
-std::array<float,2>{0.234128669f, 0.0928838328f},
-std::array<float,2>{0.645430088f, 0.399766862f},
-std::array<float,2>{0.266831249f, 0.669061363f},
-std::array<float,2>{0.705917358f, 0.831561267f},
-std::array<float,2>{0.32393682f, 0.185951948f},
-std::array<float,2>{0.932190955f, 0.317439318f},
-std::array<float,2>{0.168869153f, 0.560851693f},
-std::array<float,2>{0.814331174f, 0.715269804f},
-std::array<float,2>{0.0567037128f, 0.461087584f},
-std::array<float,2>{0.53346312f, 0.0496772043f},
-std::array<float,2>{0.404748708f, 0.970522225f},
-std::array<float,2>{0.685941279f, 0.637847602f},
-std::array<float,2>{0.302991509f, 0.427343011f},
-std::array<float,2>{0.980649829f, 0.101291984f},
-std::array<float,2>{0.208088428f, 0.894032836f},
-std::array<float,2>{0.812321901f, 0.771991611f},
-std::array<float,2>{0.120965503f, 0.213968799f},
-std::array<float,2>{0.613895833f, 0.311366558f},
-std::array<float,2>{0.497456312f, 0.573496163f},
-std::array<float,2>{0.527169704f, 0.952686608f},
-std::array<float,2>{0.409637392f, 0.00465208199f},
-std::array<float,2>{0.874375165f, 0.491203696f},
-std::array<float,2>{0.0280281771f, 0.729497969f},
-std::array<float,2>{0.897793412f, 0.519999087f},
-std::array<float,2>{0.126660228f, 0.344907254f},
-std::array<float,2>{0.727493584f, 0.152884975f},
-std::array<float,2>{0.365053236f, 0.855303407f},
-std::array<float,2>{0.737604082f, 0.543421865f},
-std::array<float,2>{0.35365659f, 0.340674192f},
-std::array<float,2>{0.888657629f, 0.165399551f},
-std::array<float,2>{0.155659497f, 0.819933712f},
-std::array<float,2>{0.858500242f, 0.989366591f},
-std::array<float,2>{0.000545161718f, 0.0454408899f},
-std::array<float,2>{0.510434866f, 0.4489187f},
-std::array<float,2>{0.43053472f, 0.687992275f},
-std::array<float,2>{0.596921742f, 0.808040798f},
-std::array<float,2>{0.478553921f, 0.246470705f},
-std::array<float,2>{0.786034882f, 0.278281927f},
-std::array<float,2>{0.0977146402f, 0.602301002f},
-std::array<float,2>{0.996550798f, 0.684720457f},
-std::array<float,2>{0.193520769f, 0.389075816f},
-std::array<float,2>{0.664960504f, 0.0643431023f},
-std::array<float,2>{0.293194562f, 0.92480433f},
-std::array<float,2>{0.551189899f, 0.745026886f},
-std::array<float,2>{0.386762738f, 0.475677401f},
-std::array<float,2>{0.838876486f, 0.0204557553f},
-std::array<float,2>{0.0382833295f, 0.958926737f},
-std::array<float,2>{0.909266889f, 0.860960245f},
-std::array<float,2>{0.178100333f, 0.13342014f},
-std::array<float,2>{0.693641841f, 0.366263926f},
-std::array<float,2>{0.335669726f, 0.501217246f},
-std::array<float,2>{0.629191339f, 0.887569368f},
-std::array<float,2>{0.253154397f, 0.124391422f},
-std::array<float,2>{0.962200642f, 0.413073301f},
-std::array<float,2>{0.245505273f, 0.648260593f},
-std::array<float,2>{0.77532351f, 0.5849213f},
-std::array<float,2>{0.0663620532f, 0.296501637f},
-std::array<float,2>{0.56982249f, 0.195555881f},
-std::array<float,2>{0.438870817f, 0.754622519f},
-std::array<float,2>{0.535511136f, 0.587468863f},
-std::array<float,2>{0.401618034f, 0.288720012f},
-std::array<float,2>{0.819963396f, 0.191427052f},
-std::array<float,2>{0.0589902103f, 0.763369858f},
-std::array<float,2>{0.93720603f, 0.880831718f},
-std::array<float,2>{0.166359246f, 0.111557253f},
-std::array<float,2>{0.7091254f, 0.419303209f},
-std::array<float,2>{0.327140361f, 0.650403976f},
-std::array<float,2>{0.644476473f, 0.868033111f},
-std::array<float,2>{0.273326337f, 0.127961472f},
-std::array<float,2>{0.942992926f, 0.370364785f},
-std::array<float,2>{0.226663888f, 0.514753044f},
-std::array<float,2>{0.761000514f, 0.735748947f},
-std::array<float,2>{0.0862592608f, 0.480395049f},
-std::array<float,2>{0.589717746f, 0.0259714779f},
-std::array<float,2>{0.466200292f, 0.96665293f},
-std::array<float,2>{0.73061806f, 0.676981449f},
-std::array<float,2>{0.360647559f, 0.377006322f},
-std::array<float,2>{0.893879771f, 0.0751218721f},
-std::array<float,2>{0.129178822f, 0.931046605f},
-std::array<float,2>{0.870824635f, 0.801558852f},
-std::array<float,2>{0.0255228542f, 0.237709388f},
-std::array<float,2>{0.527874649f, 0.271826774f},
-std::array<float,2>{0.411363125f, 0.595498323f},
-std::array<float,2>{0.611902297f, 0.993462443f},
-std::array<float,2>{0.493523955f, 0.0383837558f},
-std::array<float,2>{0.805057168f, 0.442953587f},
-std::array<float,2>{0.123252288f, 0.700127244f},
-std::array<float,2>{0.98021692f, 0.532470942f},
-std::array<float,2>{0.205883756f, 0.335394681f},
-std::array<float,2>{0.680476904f, 0.162202179f},
-std::array<float,2>{0.300559074f, 0.823634565f},
-std::array<float,2>{0.668279648f, 0.529418945f},
-std::array<float,2>{0.291460812f, 0.358110607f},
-std::array<float,2>{0.995337307f, 0.14288938f},
-std::array<float,2>{0.189512163f, 0.845744848f},
-std::array<float,2>{0.781888306f, 0.938489079f},
-std::array<float,2>{0.0968261361f, 0.0118766669f},
-std::array<float,2>{0.599482954f, 0.493614078f},
-std::array<float,2>{0.480948389f, 0.719558418f},
-std::array<float,2>{0.514551759f, 0.77956301f},
-std::array<float,2>{0.43682012f, 0.204451904f},
-std::array<float,2>{0.852365553f, 0.299368441f},
-std::array<float,2>{0.00754282949f, 0.563498318f},
-std::array<float,2>{0.885177493f, 0.632256687f},
-std::array<float,2>{0.149573654f, 0.435008228f},
-std::array<float,2>{0.738741457f, 0.101953536f},
-std::array<float,2>{0.355909586f, 0.899000466f},
-std::array<float,2>{0.562727928f, 0.703939199f},
-std::array<float,2>{0.444573879f, 0.454108924f},
-std::array<float,2>{0.77832371f, 0.0601820834f},
-std::array<float,2>{0.068278715f, 0.984330595f},
-std::array<float,2>{0.968040824f, 0.842034936f},
-std::array<float,2>{0.246813834f, 0.17711094f},
-std::array<float,2>{0.628377318f, 0.328042895f},
-std::array<float,2>{0.256299376f, 0.5477916f},
-std::array<float,2>{0.689009011f, 0.906315863f},
-std::array<float,2>{0.329585344f, 0.0807004049f},
-std::array<float,2>{0.91293484f, 0.392144054f},
-std::array<float,2>{0.173217893f, 0.660892129f},
-std::array<float,2>{0.840781748f, 0.61213851f},
-std::array<float,2>{0.0326749049f, 0.263662249f},
-std::array<float,2>{0.549536526f, 0.222018942f},
-std::array<float,2>{0.386224955f, 0.787635803f},
-std::array<float,2>{0.605064929f, 0.55684799f},
-std::array<float,2>{0.471522719f, 0.314297765f},
-std::array<float,2>{0.792719126f, 0.181742474f},
-std::array<float,2>{0.107313894f, 0.832652271f},
-std::array<float,2>{0.991246998f, 0.973191261f},
-std::array<float,2>{0.196036175f, 0.0520951673f},
-std::array<float,2>{0.658505917f, 0.465499669f},
-std::array<float,2>{0.287253231f, 0.71310693f},
-std::array<float,2>{0.74801904f, 0.795840681f},
-std::array<float,2>{0.349953622f, 0.231435567f},
-std::array<float,2>{0.878051281f, 0.253783196f},
-std::array<float,2>{0.141545922f, 0.620310962f},
-std::array<float,2>{0.849683821f, 0.667571902f},
-std::array<float,2>{0.0122526521f, 0.40290156f},
-std::array<float,2>{0.505584538f, 0.0893725976f},
-std::array<float,2>{0.429110289f, 0.915070891f},
-std::array<float,2>{0.63422215f, 0.733871579f},
-std::array<float,2>{0.262102753f, 0.484614402f},
-std::array<float,2>{0.953271091f, 0.000980679644f},
-std::array<float,2>{0.238830581f, 0.945427179f},
-std::array<float,2>{0.768733501f, 0.856038034f},
-std::array<float,2>{0.072199434f, 0.152140751f},
-std::array<float,2>{0.577551305f, 0.349710315f},
-std::array<float,2>{0.44978258f, 0.519235194f},
-std::array<float,2>{0.562431097f, 0.89654994f},
-std::array<float,2>{0.380190402f, 0.0958359614f},
-std::array<float,2>{0.834971607f, 0.421965301f},
-std::array<float,2>{0.0419800878f, 0.636622369f},
-std::array<float,2>{0.921729743f, 0.577583373f},
-std::array<float,2>{0.181180179f, 0.306783825f},
-std::array<float,2>{0.697201848f, 0.217651278f},
-std::array<float,2>{0.337473899f, 0.766671121f},
-std::array<float,2>{0.715366602f, 0.606909394f},
-std::array<float,2>{0.313280314f, 0.274439991f},
-std::array<float,2>{0.927603245f, 0.242698282f},
-std::array<float,2>{0.158718869f, 0.810022891f},
-std::array<float,2>{0.828023851f, 0.925911188f},
-std::array<float,2>{0.0481084511f, 0.0697405785f},
-std::array<float,2>{0.542859912f, 0.383604497f},
-std::array<float,2>{0.39146632f, 0.682002902f},
-std::array<float,2>{0.580860078f, 0.813983083f},
-std::array<float,2>{0.460284084f, 0.169355631f},
-std::array<float,2>{0.754834414f, 0.339574724f},
-std::array<float,2>{0.0847518221f, 0.541108966f},
-std::array<float,2>{0.947786152f, 0.691711783f},
-std::array<float,2>{0.21945475f, 0.450585961f},
-std::array<float,2>{0.653920949f, 0.0399594232f},
-std::array<float,2>{0.274080724f, 0.98635447f},
-std::array<float,2>{0.518201292f, 0.642682731f},
-std::array<float,2>{0.419526845f, 0.407010645f},
-std::array<float,2>{0.862419248f, 0.119889401f},
-std::array<float,2>{0.0178909265f, 0.886567712f},
-std::array<float,2>{0.904387891f, 0.75333941f},
-std::array<float,2>{0.137445062f, 0.201998785f},
-std::array<float,2>{0.720136642f, 0.292750597f},
-std::array<float,2>{0.367374241f, 0.580147624f},
-std::array<float,2>{0.67665273f, 0.954567969f},
-std::array<float,2>{0.308868557f, 0.0162073914f},
-std::array<float,2>{0.972631276f, 0.471640021f},
-std::array<float,2>{0.215752214f, 0.748844922f},
-std::array<float,2>{0.799797058f, 0.504672289f},
-std::array<float,2>{0.113743424f, 0.360845357f},
-std::array<float,2>{0.624593079f, 0.139140174f},
-std::array<float,2>{0.48777625f, 0.865232944f},
-std::array<float,2>{0.556949139f, 0.539026558f},
-std::array<float,2>{0.375256956f, 0.330846012f},
-std::array<float,2>{0.831238031f, 0.15791823f},
-std::array<float,2>{0.0455158837f, 0.826204598f},
-std::array<float,2>{0.916939735f, 0.997960925f},
-std::array<float,2>{0.185925812f, 0.0341242217f},
-std::array<float,2>{0.700751662f, 0.440200955f},
-std::array<float,2>{0.342841059f, 0.696249604f},
-std::array<float,2>{0.63839519f, 0.799650431f},
-std::array<float,2>{0.261355579f, 0.2394097f},
-std::array<float,2>{0.957460284f, 0.266075253f},
-std::array<float,2>{0.237576336f, 0.600860059f},
-std::array<float,2>{0.769961894f, 0.673550844f},
-std::array<float,2>{0.0780545101f, 0.379996985f},
-std::array<float,2>{0.572119772f, 0.0738169104f},
-std::array<float,2>{0.448124975f, 0.937178969f},
-std::array<float,2>{0.745000303f, 0.739580154f},
-std::array<float,2>{0.346899003f, 0.484203577f},
-std::array<float,2>{0.879135251f, 0.0300393347f},
-std::array<float,2>{0.145030409f, 0.962730348f},
-std::array<float,2>{0.84434247f, 0.874103785f},
-std::array<float,2>{0.0116381142f, 0.129115924f},
-std::array<float,2>{0.500899494f, 0.373475105f},
-std::array<float,2>{0.42527476f, 0.51163584f},
-std::array<float,2>{0.607714891f, 0.877194643f},
-std::array<float,2>{0.474255383f, 0.114413589f},
-std::array<float,2>{0.794282973f, 0.414378971f},
-std::array<float,2>{0.103910215f, 0.65621841f},
-std::array<float,2>{0.984709799f, 0.592388868f},
-std::array<float,2>{0.201201618f, 0.284859866f},
-std::array<float,2>{0.662323236f, 0.187835559f},
-std::array<float,2>{0.282321662f, 0.760043085f},
-std::array<float,2>{0.675491989f, 0.613954484f},
-std::array<float,2>{0.308587998f, 0.260189444f},
-std::array<float,2>{0.973557115f, 0.223805442f},
-std::array<float,2>{0.214354724f, 0.782984614f},
-std::array<float,2>{0.801010013f, 0.91287291f},
-std::array<float,2>{0.111504242f, 0.0837182328f},
-std::array<float,2>{0.618258536f, 0.398373991f},
-std::array<float,2>{0.490519613f, 0.659063399f},
-std::array<float,2>{0.523207128f, 0.837633252f},
-std::array<float,2>{0.414264381f, 0.171895772f},
-std::array<float,2>{0.864547193f, 0.322924465f},
-std::array<float,2>{0.0234028976f, 0.552213848f},
-std::array<float,2>{0.901888013f, 0.71042335f},
-std::array<float,2>{0.133001611f, 0.458877027f},
-std::array<float,2>{0.723849058f, 0.0566263124f},
-std::array<float,2>{0.374328047f, 0.980168104f},
-std::array<float,2>{0.584967732f, 0.626345575f},
-std::array<float,2>{0.454723746f, 0.431958586f},
-std::array<float,2>{0.752714276f, 0.108060472f},
-std::array<float,2>{0.0790687203f, 0.904545426f},
-std::array<float,2>{0.950222135f, 0.776794732f},
-std::array<float,2>{0.226543844f, 0.209820241f},
-std::array<float,2>{0.65154618f, 0.304479152f},
-std::array<float,2>{0.278216302f, 0.569180071f},
-std::array<float,2>{0.713613689f, 0.941497207f},
-std::array<float,2>{0.319666862f, 0.0108701782f},
-std::array<float,2>{0.92234236f, 0.49703902f},
-std::array<float,2>{0.160842746f, 0.724561632f},
-std::array<float,2>{0.822286725f, 0.526670814f},
-std::array<float,2>{0.0509684719f, 0.354688585f},
-std::array<float,2>{0.546528816f, 0.147707522f},
-std::array<float,2>{0.397705883f, 0.850075006f},
-std::array<float,2>{0.615580082f, 0.5706563f},
-std::array<float,2>{0.499231339f, 0.309209257f},
-std::array<float,2>{0.810295641f, 0.212082967f},
-std::array<float,2>{0.118753828f, 0.770022273f},
-std::array<float,2>{0.98259455f, 0.891540766f},
-std::array<float,2>{0.209977061f, 0.0990292355f},
-std::array<float,2>{0.684980929f, 0.427989155f},
-std::array<float,2>{0.302521855f, 0.640605032f},
-std::array<float,2>{0.728705823f, 0.853197515f},
-std::array<float,2>{0.367001474f, 0.154842317f},
-std::array<float,2>{0.895946503f, 0.346102476f},
-std::array<float,2>{0.127340987f, 0.521896362f},
-std::array<float,2>{0.871838093f, 0.727178156f},
-std::array<float,2>{0.0296029504f, 0.490207732f},
-std::array<float,2>{0.525231183f, 0.00771309156f},
-std::array<float,2>{0.407369792f, 0.949367046f},
-std::array<float,2>{0.647015393f, 0.671666145f},
-std::array<float,2>{0.267987788f, 0.400623947f},
-std::array<float,2>{0.941216767f, 0.0903191268f},
-std::array<float,2>{0.231254742f, 0.919480145f},
-std::array<float,2>{0.764680266f, 0.790074885f},
-std::array<float,2>{0.0930993333f, 0.229391038f},
-std::array<float,2>{0.592171669f, 0.254143208f},
-std::array<float,2>{0.463278592f, 0.624016047f},
-std::array<float,2>{0.532826602f, 0.972459018f},
-std::array<float,2>{0.403105557f, 0.0469297878f},
-std::array<float,2>{0.816305578f, 0.463498801f},
-std::array<float,2>{0.0555297025f, 0.717094123f},
-std::array<float,2>{0.930797517f, 0.558851004f},
-std::array<float,2>{0.17027317f, 0.319938391f},
-std::array<float,2>{0.704335511f, 0.184962586f},
-std::array<float,2>{0.322243482f, 0.829862177f},
-std::array<float,2>{0.692241669f, 0.502436996f},
-std::array<float,2>{0.332567036f, 0.364227176f},
-std::array<float,2>{0.906317711f, 0.135891378f},
-std::array<float,2>{0.17680876f, 0.862827957f},
-std::array<float,2>{0.837264657f, 0.959581971f},
-std::array<float,2>{0.0360323898f, 0.0226062685f},
-std::array<float,2>{0.554275453f, 0.47384873f},
-std::array<float,2>{0.389102578f, 0.744071126f},
-std::array<float,2>{0.56806463f, 0.755916655f},
-std::array<float,2>{0.440877199f, 0.199076042f},
-std::array<float,2>{0.775598049f, 0.294333547f},
-std::array<float,2>{0.0633805916f, 0.582356274f},
-std::array<float,2>{0.964242756f, 0.645156682f},
-std::array<float,2>{0.243550211f, 0.411665529f},
-std::array<float,2>{0.630963564f, 0.121975414f},
-std::array<float,2>{0.251366556f, 0.888849139f},
-std::array<float,2>{0.508781731f, 0.689560413f},
-std::array<float,2>{0.432831496f, 0.445704699f},
-std::array<float,2>{0.856965542f, 0.044508826f},
-std::array<float,2>{0.00390513195f, 0.99092716f},
-std::array<float,2>{0.889024317f, 0.816678345f},
-std::array<float,2>{0.15371269f, 0.166165859f},
-std::array<float,2>{0.735939026f, 0.342484534f},
-std::array<float,2>{0.351693064f, 0.545706391f},
-std::array<float,2>{0.667847872f, 0.923576176f},
-std::array<float,2>{0.296874821f, 0.066164948f},
-std::array<float,2>{0.998123765f, 0.387761384f},
-std::array<float,2>{0.19246313f, 0.687081575f},
-std::array<float,2>{0.787408233f, 0.604953766f},
-std::array<float,2>{0.0997648761f, 0.27971068f},
-std::array<float,2>{0.595535874f, 0.248341039f},
-std::array<float,2>{0.476697892f, 0.806418419f},
-std::array<float,2>{0.531115532f, 0.597402692f},
-std::array<float,2>{0.413405895f, 0.270134181f},
-std::array<float,2>{0.86724782f, 0.234595791f},
-std::array<float,2>{0.0241735708f, 0.803867638f},
-std::array<float,2>{0.891658604f, 0.933171749f},
-std::array<float,2>{0.13159892f, 0.0773707777f},
-std::array<float,2>{0.734203041f, 0.375746816f},
-std::array<float,2>{0.361606985f, 0.678135991f},
-std::array<float,2>{0.681674659f, 0.821293294f},
-std::array<float,2>{0.298622251f, 0.161613703f},
-std::array<float,2>{0.977510154f, 0.33280021f},
-std::array<float,2>{0.204394579f, 0.534660101f},
-std::array<float,2>{0.808298409f, 0.701917887f},
-std::array<float,2>{0.122534163f, 0.445309401f},
-std::array<float,2>{0.610750079f, 0.0363629051f},
-std::array<float,2>{0.494751424f, 0.994703829f},
-std::array<float,2>{0.708869457f, 0.64891392f},
-std::array<float,2>{0.325092435f, 0.421217799f},
-std::array<float,2>{0.935086548f, 0.109404065f},
-std::array<float,2>{0.164788306f, 0.881007671f},
-std::array<float,2>{0.816422939f, 0.763720989f},
-std::array<float,2>{0.06173677f, 0.194219723f},
-std::array<float,2>{0.537340522f, 0.28518945f},
-std::array<float,2>{0.399660975f, 0.588689029f},
-std::array<float,2>{0.586693347f, 0.968236327f},
-std::array<float,2>{0.468435913f, 0.0250395667f},
-std::array<float,2>{0.759093583f, 0.478390068f},
-std::array<float,2>{0.0891247168f, 0.737968743f},
-std::array<float,2>{0.944326878f, 0.512057781f},
-std::array<float,2>{0.23042357f, 0.367873996f},
-std::array<float,2>{0.641129911f, 0.126596749f},
-std::array<float,2>{0.270286441f, 0.869376898f},
-std::array<float,2>{0.625942469f, 0.549678564f},
-std::array<float,2>{0.253935277f, 0.324458599f},
-std::array<float,2>{0.966081321f, 0.179232448f},
-std::array<float,2>{0.249723539f, 0.841596186f},
-std::array<float,2>{0.781181693f, 0.981903613f},
-std::array<float,2>{0.0701670945f, 0.0605591983f},
-std::array<float,2>{0.564508975f, 0.455452591f},
-std::array<float,2>{0.441532433f, 0.705188513f},
-std::array<float,2>{0.547069907f, 0.78695488f},
-std::array<float,2>{0.383669794f, 0.220488146f},
-std::array<float,2>{0.843462229f, 0.263830721f},
-std::array<float,2>{0.035063047f, 0.610278845f},
-std::array<float,2>{0.911656141f, 0.662564158f},
-std::array<float,2>{0.174983531f, 0.392905205f},
-std::array<float,2>{0.68957448f, 0.0794309899f},
-std::array<float,2>{0.330301315f, 0.909766436f},
-std::array<float,2>{0.600660086f, 0.722184479f},
-std::array<float,2>{0.483555585f, 0.494449645f},
-std::array<float,2>{0.783508956f, 0.0150283501f},
-std::array<float,2>{0.0939134508f, 0.940819204f},
-std::array<float,2>{0.992707789f, 0.844280183f},
-std::array<float,2>{0.189349368f, 0.140642449f},
-std::array<float,2>{0.67116195f, 0.355534583f},
-std::array<float,2>{0.28976649f, 0.528232038f},
-std::array<float,2>{0.740532458f, 0.901664734f},
-std::array<float,2>{0.358397394f, 0.104885221f},
-std::array<float,2>{0.883872211f, 0.436755687f},
-std::array<float,2>{0.150924996f, 0.629174173f},
-std::array<float,2>{0.854611099f, 0.566064f},
-std::array<float,2>{0.00457111094f, 0.297840625f},
-std::array<float,2>{0.512540817f, 0.206819251f},
-std::array<float,2>{0.433597058f, 0.777931511f},
-std::array<float,2>{0.575219631f, 0.517090023f},
-std::array<float,2>{0.452264905f, 0.348418236f},
-std::array<float,2>{0.767333984f, 0.149568155f},
-std::array<float,2>{0.0736338496f, 0.859321952f},
-std::array<float,2>{0.955871046f, 0.948024929f},
-std::array<float,2>{0.241039634f, 0.00242974702f},
-std::array<float,2>{0.635814369f, 0.487697303f},
-std::array<float,2>{0.264760226f, 0.73120892f},
-std::array<float,2>{0.697914004f, 0.768118739f},
-std::array<float,2>{0.339634508f, 0.216619298f},
-std::array<float,2>{0.918675959f, 0.305347472f},
-std::array<float,2>{0.183259264f, 0.575220406f},
-std::array<float,2>{0.833688617f, 0.634083986f},
-std::array<float,2>{0.0407516658f, 0.424246758f},
-std::array<float,2>{0.559776664f, 0.0956159905f},
-std::array<float,2>{0.381069094f, 0.895043969f},
-std::array<float,2>{0.657422245f, 0.711319506f},
-std::array<float,2>{0.286154807f, 0.467994243f},
-std::array<float,2>{0.988464236f, 0.0544579588f},
-std::array<float,2>{0.198183969f, 0.9759354f},
-std::array<float,2>{0.790650725f, 0.834655225f},
-std::array<float,2>{0.107460327f, 0.179964542f},
-std::array<float,2>{0.601661205f, 0.314662755f},
-std::array<float,2>{0.469880551f, 0.555075109f},
-std::array<float,2>{0.506476164f, 0.917574167f},
-std::array<float,2>{0.42579326f, 0.0870502442f},
-std::array<float,2>{0.848577678f, 0.40563187f},
-std::array<float,2>{0.0147759542f, 0.664927065f},
-std::array<float,2>{0.875264525f, 0.618116438f},
-std::array<float,2>{0.142791197f, 0.250448257f},
-std::array<float,2>{0.748740435f, 0.234320104f},
-std::array<float,2>{0.347676069f, 0.794265091f},
-std::array<float,2>{0.722215533f, 0.579795599f},
-std::array<float,2>{0.369459897f, 0.289295077f},
-std::array<float,2>{0.902971089f, 0.200597897f},
-std::array<float,2>{0.140157521f, 0.751625061f},
-std::array<float,2>{0.861213624f, 0.883282721f},
-std::array<float,2>{0.0174609851f, 0.118115969f},
-std::array<float,2>{0.517540455f, 0.409553885f},
-std::array<float,2>{0.420448959f, 0.642527938f},
-std::array<float,2>{0.622620285f, 0.865865648f},
-std::array<float,2>{0.486321568f, 0.136937544f},
-std::array<float,2>{0.797349572f, 0.36198771f},
-std::array<float,2>{0.116507061f, 0.506660283f},
-std::array<float,2>{0.969206989f, 0.74800539f},
-std::array<float,2>{0.216958582f, 0.469365597f},
-std::array<float,2>{0.678265333f, 0.0178976208f},
-std::array<float,2>{0.310748965f, 0.956839204f},
-std::array<float,2>{0.539307356f, 0.680689633f},
-std::array<float,2>{0.394198805f, 0.384846807f},
-std::array<float,2>{0.824405313f, 0.0665732399f},
-std::array<float,2>{0.0497850515f, 0.929589093f},
-std::array<float,2>{0.928710759f, 0.811074615f},
-std::array<float,2>{0.156935379f, 0.245507374f},
-std::array<float,2>{0.71846509f, 0.277165413f},
-std::array<float,2>{0.315370291f, 0.607688487f},
-std::array<float,2>{0.654806793f, 0.986322761f},
-std::array<float,2>{0.277223766f, 0.0417964011f},
-std::array<float,2>{0.945811331f, 0.451587915f},
-std::array<float,2>{0.221205056f, 0.693794072f},
-std::array<float,2>{0.757189929f, 0.540093184f},
-std::array<float,2>{0.0836283192f, 0.336982906f},
-std::array<float,2>{0.57878387f, 0.17176567f},
-std::array<float,2>{0.45868811f, 0.814872742f},
-std::array<float,2>{0.521019399f, 0.550852478f},
-std::array<float,2>{0.417144895f, 0.323820323f},
-std::array<float,2>{0.865531623f, 0.173275769f},
-std::array<float,2>{0.0205678176f, 0.836573482f},
-std::array<float,2>{0.899581075f, 0.979031503f},
-std::array<float,2>{0.136376858f, 0.0555121563f},
-std::array<float,2>{0.726498961f, 0.457119584f},
-std::array<float,2>{0.372345001f, 0.709092677f},
-std::array<float,2>{0.672600031f, 0.7818349f},
-std::array<float,2>{0.30647707f, 0.222699836f},
-std::array<float,2>{0.975731909f, 0.261593491f},
-std::array<float,2>{0.211527914f, 0.614580095f},
-std::array<float,2>{0.803036571f, 0.659827411f},
-std::array<float,2>{0.109592177f, 0.397325009f},
-std::array<float,2>{0.619361281f, 0.082547687f},
-std::array<float,2>{0.489284456f, 0.913428426f},
-std::array<float,2>{0.712813973f, 0.723214924f},
-std::array<float,2>{0.317918569f, 0.49777934f},
-std::array<float,2>{0.925030351f, 0.0101178316f},
-std::array<float,2>{0.163580596f, 0.943052292f},
-std::array<float,2>{0.822263122f, 0.851132691f},
-std::array<float,2>{0.0544648021f, 0.146950558f},
-std::array<float,2>{0.544697881f, 0.353548169f},
-std::array<float,2>{0.395210803f, 0.52609092f},
-std::array<float,2>{0.583650649f, 0.906082928f},
-std::array<float,2>{0.457013935f, 0.109002545f},
-std::array<float,2>{0.750247061f, 0.433060706f},
-std::array<float,2>{0.0813443139f, 0.625834763f},
-std::array<float,2>{0.951374471f, 0.56936574f},
-std::array<float,2>{0.223744318f, 0.303367466f},
-std::array<float,2>{0.648518026f, 0.210755095f},
-std::array<float,2>{0.280643255f, 0.775813043f},
-std::array<float,2>{0.64047873f, 0.60038203f},
-std::array<float,2>{0.259283692f, 0.267359674f},
-std::array<float,2>{0.959813058f, 0.239079937f},
-std::array<float,2>{0.234626502f, 0.80025959f},
-std::array<float,2>{0.772054136f, 0.935902178f},
-std::array<float,2>{0.0752075687f, 0.0731322467f},
-std::array<float,2>{0.574195027f, 0.379724234f},
-std::array<float,2>{0.447100103f, 0.672821581f},
-std::array<float,2>{0.555998147f, 0.827886939f},
-std::array<float,2>{0.377301693f, 0.156354263f},
-std::array<float,2>{0.82991761f, 0.331758678f},
-std::array<float,2>{0.0445526987f, 0.537716568f},
-std::array<float,2>{0.915273786f, 0.696493208f},
-std::array<float,2>{0.184612319f, 0.440924376f},
-std::array<float,2>{0.701253355f, 0.034335956f},
-std::array<float,2>{0.341452539f, 0.996643841f},
-std::array<float,2>{0.607098043f, 0.654720604f},
-std::array<float,2>{0.476316303f, 0.415929109f},
-std::array<float,2>{0.796152234f, 0.113465384f},
-std::array<float,2>{0.102078594f, 0.878674209f},
-std::array<float,2>{0.987478971f, 0.761211216f},
-std::array<float,2>{0.20081757f, 0.188684493f},
-std::array<float,2>{0.660391271f, 0.283677816f},
-std::array<float,2>{0.285010487f, 0.593056321f},
-std::array<float,2>{0.743685663f, 0.961083531f},
-std::array<float,2>{0.344279975f, 0.0304723941f},
-std::array<float,2>{0.882270634f, 0.483248293f},
-std::array<float,2>{0.14732042f, 0.738465548f},
-std::array<float,2>{0.846593678f, 0.510599494f},
-std::array<float,2>{0.00788806379f, 0.374833345f},
-std::array<float,2>{0.502875328f, 0.130296797f},
-std::array<float,2>{0.422359884f, 0.873607099f},
-std::array<float,2>{0.568596065f, 0.583597004f},
-std::array<float,2>{0.437920123f, 0.293340743f},
-std::array<float,2>{0.774196565f, 0.198089004f},
-std::array<float,2>{0.064855136f, 0.757607043f},
-std::array<float,2>{0.961014152f, 0.89019233f},
-std::array<float,2>{0.244295523f, 0.122854747f},
-std::array<float,2>{0.629896402f, 0.410708457f},
-std::array<float,2>{0.252253711f, 0.645798743f},
-std::array<float,2>{0.694547951f, 0.862172306f},
-std::array<float,2>{0.334299594f, 0.134918049f},
-std::array<float,2>{0.908414066f, 0.364811361f},
-std::array<float,2>{0.179352194f, 0.503116667f},
-std::array<float,2>{0.838615119f, 0.742855787f},
-std::array<float,2>{0.0375664569f, 0.473188132f},
-std::array<float,2>{0.552022457f, 0.0218566731f},
-std::array<float,2>{0.387928933f, 0.960735261f},
-std::array<float,2>{0.66590476f, 0.68615818f},
-std::array<float,2>{0.294516981f, 0.38681972f},
-std::array<float,2>{0.998027205f, 0.0653062239f},
-std::array<float,2>{0.194807872f, 0.922511756f},
-std::array<float,2>{0.786304891f, 0.804885328f},
-std::array<float,2>{0.0988301188f, 0.249553099f},
-std::array<float,2>{0.596325636f, 0.280870914f},
-std::array<float,2>{0.479986191f, 0.603599727f},
-std::array<float,2>{0.511474133f, 0.991452277f},
-std::array<float,2>{0.431472927f, 0.0436403155f},
-std::array<float,2>{0.85807997f, 0.446703196f},
-std::array<float,2>{0.00143963436f, 0.69108367f},
-std::array<float,2>{0.887282252f, 0.545908689f},
-std::array<float,2>{0.155037031f, 0.343170613f},
-std::array<float,2>{0.737220407f, 0.167653531f},
-std::array<float,2>{0.355167031f, 0.817762375f},
-std::array<float,2>{0.728000998f, 0.522796392f},
-std::array<float,2>{0.36366424f, 0.347230047f},
-std::array<float,2>{0.897237003f, 0.155678749f},
-std::array<float,2>{0.125122458f, 0.852157176f},
-std::array<float,2>{0.873598933f, 0.950874686f},
-std::array<float,2>{0.028428873f, 0.00596722821f},
-std::array<float,2>{0.526043832f, 0.488541573f},
-std::array<float,2>{0.408422232f, 0.728084385f},
-std::array<float,2>{0.614566386f, 0.771371722f},
-std::array<float,2>{0.496241212f, 0.21155864f},
-std::array<float,2>{0.810716569f, 0.310349345f},
-std::array<float,2>{0.119338453f, 0.571385443f},
-std::array<float,2>{0.981641173f, 0.639103889f},
-std::array<float,2>{0.207257807f, 0.428813249f},
-std::array<float,2>{0.687313974f, 0.0977700949f},
-std::array<float,2>{0.303930551f, 0.892239809f},
-std::array<float,2>{0.534655929f, 0.718681693f},
-std::array<float,2>{0.405534834f, 0.464469284f},
-std::array<float,2>{0.81294769f, 0.047874324f},
-std::array<float,2>{0.0582863018f, 0.970822334f},
-std::array<float,2>{0.932824492f, 0.828386724f},
-std::array<float,2>{0.1698111f, 0.18387796f},
-std::array<float,2>{0.706977129f, 0.319233805f},
-std::array<float,2>{0.32269761f, 0.559690356f},
-std::array<float,2>{0.646086335f, 0.918052912f},
-std::array<float,2>{0.266387105f, 0.0909797102f},
-std::array<float,2>{0.938162267f, 0.401508451f},
-std::array<float,2>{0.233337566f, 0.670144618f},
-std::array<float,2>{0.762438416f, 0.62442261f},
-std::array<float,2>{0.0903066993f, 0.25503853f},
-std::array<float,2>{0.591061115f, 0.229553014f},
-std::array<float,2>{0.462471932f, 0.789934039f},
-std::array<float,2>{0.55063045f, 0.610518038f},
-std::array<float,2>{0.385707915f, 0.265336066f},
-std::array<float,2>{0.840919852f, 0.219098017f},
-std::array<float,2>{0.0320313983f, 0.785634875f},
-std::array<float,2>{0.913090706f, 0.908608437f},
-std::array<float,2>{0.172240123f, 0.0783521459f},
-std::array<float,2>{0.687557638f, 0.394513726f},
-std::array<float,2>{0.328159779f, 0.664043486f},
-std::array<float,2>{0.627787173f, 0.8398754f},
-std::array<float,2>{0.257276267f, 0.178627297f},
-std::array<float,2>{0.96743983f, 0.325578898f},
-std::array<float,2>{0.247848183f, 0.550193191f},
-std::array<float,2>{0.778114498f, 0.706460595f},
-std::array<float,2>{0.0664219707f, 0.456361562f},
-std::array<float,2>{0.563642561f, 0.0623389743f},
-std::array<float,2>{0.44410193f, 0.980517745f},
-std::array<float,2>{0.739759684f, 0.629994869f},
-std::array<float,2>{0.356970131f, 0.43561852f},
-std::array<float,2>{0.885931134f, 0.104403451f},
-std::array<float,2>{0.148762658f, 0.901349425f},
-std::array<float,2>{0.853408277f, 0.778610528f},
-std::array<float,2>{0.00657923613f, 0.20583953f},
-std::array<float,2>{0.515486956f, 0.298280299f},
-std::array<float,2>{0.43612197f, 0.564663947f},
-std::array<float,2>{0.597901046f, 0.939683735f},
-std::array<float,2>{0.482175946f, 0.0142538846f},
-std::array<float,2>{0.782880843f, 0.495137841f},
-std::array<float,2>{0.0961377919f, 0.721284807f},
-std::array<float,2>{0.994365275f, 0.528868735f},
-std::array<float,2>{0.190493509f, 0.357297212f},
-std::array<float,2>{0.668975115f, 0.141846031f},
-std::array<float,2>{0.292083025f, 0.845181048f},
-std::array<float,2>{0.68150425f, 0.533395708f},
-std::array<float,2>{0.299383998f, 0.333282113f},
-std::array<float,2>{0.978695989f, 0.160932988f},
-std::array<float,2>{0.206222609f, 0.820704699f},
-std::array<float,2>{0.80649066f, 0.995882809f},
-std::array<float,2>{0.12456537f, 0.0358858667f},
-std::array<float,2>{0.612654686f, 0.444277942f},
-std::array<float,2>{0.492630929f, 0.702495456f},
-std::array<float,2>{0.528625488f, 0.803044319f},
-std::array<float,2>{0.411105126f, 0.235582218f},
-std::array<float,2>{0.869791627f, 0.270682633f},
-std::array<float,2>{0.0267759804f, 0.596181929f},
-std::array<float,2>{0.893026412f, 0.678772569f},
-std::array<float,2>{0.129934162f, 0.37629348f},
-std::array<float,2>{0.731651127f, 0.0771346167f},
-std::array<float,2>{0.35972935f, 0.93167913f},
-std::array<float,2>{0.588631809f, 0.736760736f},
-std::array<float,2>{0.465168327f, 0.476643056f},
-std::array<float,2>{0.760029495f, 0.0242987089f},
-std::array<float,2>{0.0870871097f, 0.966927409f},
-std::array<float,2>{0.941730082f, 0.870828152f},
-std::array<float,2>{0.227702215f, 0.12535128f},
-std::array<float,2>{0.642597795f, 0.368490607f},
-std::array<float,2>{0.27214092f, 0.512726367f},
-std::array<float,2>{0.710250497f, 0.882545114f},
-std::array<float,2>{0.327538073f, 0.111161768f},
-std::array<float,2>{0.936124563f, 0.42087689f},
-std::array<float,2>{0.167047411f, 0.650282502f},
-std::array<float,2>{0.818920553f, 0.589560688f},
-std::array<float,2>{0.0598679893f, 0.286629885f},
-std::array<float,2>{0.536611438f, 0.194406033f},
-std::array<float,2>{0.400506645f, 0.765307903f},
-std::array<float,2>{0.6237306f, 0.507279217f},
-std::array<float,2>{0.486595184f, 0.362987101f},
-std::array<float,2>{0.800026417f, 0.13787879f},
-std::array<float,2>{0.11427521f, 0.866763115f},
-std::array<float,2>{0.971654832f, 0.956054688f},
-std::array<float,2>{0.216647044f, 0.0187902618f},
-std::array<float,2>{0.67743963f, 0.470531762f},
-std::array<float,2>{0.309747428f, 0.746887386f},
-std::array<float,2>{0.719181597f, 0.750359893f},
-std::array<float,2>{0.368249148f, 0.199771762f},
-std::array<float,2>{0.905443311f, 0.290138602f},
-std::array<float,2>{0.138307407f, 0.578514755f},
-std::array<float,2>{0.861497819f, 0.640830338f},
-std::array<float,2>{0.0191389415f, 0.408246458f},
-std::array<float,2>{0.518651187f, 0.118580267f},
-std::array<float,2>{0.418552697f, 0.884309351f},
-std::array<float,2>{0.652913153f, 0.694613695f},
-std::array<float,2>{0.274457276f, 0.452570528f},
-std::array<float,2>{0.948724389f, 0.0422755294f},
-std::array<float,2>{0.220366508f, 0.985340118f},
-std::array<float,2>{0.755735219f, 0.816028893f},
-std::array<float,2>{0.0854522809f, 0.169976428f},
-std::array<float,2>{0.581670642f, 0.336608201f},
-std::array<float,2>{0.459210426f, 0.539981425f},
-std::array<float,2>{0.541571498f, 0.928530037f},
-std::array<float,2>{0.39252761f, 0.0682471693f},
-std::array<float,2>{0.826663196f, 0.386526793f},
-std::array<float,2>{0.0471460856f, 0.679798961f},
-std::array<float,2>{0.925842822f, 0.608463168f},
-std::array<float,2>{0.159322381f, 0.27544108f},
-std::array<float,2>{0.716695189f, 0.244661987f},
-std::array<float,2>{0.314232916f, 0.811952472f},
-std::array<float,2>{0.695524633f, 0.575119495f},
-std::array<float,2>{0.336231649f, 0.305728018f},
-std::array<float,2>{0.920313835f, 0.21537739f},
-std::array<float,2>{0.180185959f, 0.768817782f},
-std::array<float,2>{0.834175229f, 0.896274805f},
-std::array<float,2>{0.0428760648f, 0.0938253701f},
-std::array<float,2>{0.561252177f, 0.424859911f},
-std::array<float,2>{0.379866689f, 0.632951498f},
-std::array<float,2>{0.576883972f, 0.857816756f},
-std::array<float,2>{0.450518638f, 0.148516357f},
-std::array<float,2>{0.767834544f, 0.348889112f},
-std::array<float,2>{0.0703873262f, 0.516294956f},
-std::array<float,2>{0.954443753f, 0.731858253f},
-std::array<float,2>{0.239616185f, 0.486662686f},
-std::array<float,2>{0.633705378f, 0.00373716862f},
-std::array<float,2>{0.263047636f, 0.948797166f},
-std::array<float,2>{0.504124224f, 0.665817082f},
-std::array<float,2>{0.428439528f, 0.404430777f},
-std::array<float,2>{0.851031065f, 0.0866269767f},
-std::array<float,2>{0.0133997193f, 0.916263461f},
-std::array<float,2>{0.877191007f, 0.793704569f},
-std::array<float,2>{0.14167729f, 0.232434362f},
-std::array<float,2>{0.746322691f, 0.251020372f},
-std::array<float,2>{0.351443976f, 0.618552744f},
-std::array<float,2>{0.659500301f, 0.975184381f},
-std::array<float,2>{0.288645953f, 0.0536202267f},
-std::array<float,2>{0.991074622f, 0.466819108f},
-std::array<float,2>{0.196377084f, 0.712869823f},
-std::array<float,2>{0.791020691f, 0.556006312f},
-std::array<float,2>{0.106381387f, 0.316236556f},
-std::array<float,2>{0.604102969f, 0.180958226f},
-std::array<float,2>{0.471722931f, 0.835271955f},
-std::array<float,2>{0.545669734f, 0.524273932f},
-std::array<float,2>{0.397339046f, 0.3515836f},
-std::array<float,2>{0.823624194f, 0.144783825f},
-std::array<float,2>{0.0518452302f, 0.847906351f},
-std::array<float,2>{0.92296499f, 0.944338441f},
-std::array<float,2>{0.161998555f, 0.00921394303f},
-std::array<float,2>{0.71440351f, 0.499200583f},
-std::array<float,2>{0.319210768f, 0.725022078f},
-std::array<float,2>{0.650433123f, 0.77421242f},
-std::array<float,2>{0.278688431f, 0.208495662f},
-std::array<float,2>{0.95000118f, 0.301507831f},
-std::array<float,2>{0.2248656f, 0.566750884f},
-std::array<float,2>{0.753098309f, 0.627218246f},
-std::array<float,2>{0.0798309967f, 0.430924356f},
-std::array<float,2>{0.584549308f, 0.105877385f},
-std::array<float,2>{0.453865677f, 0.902983665f},
-std::array<float,2>{0.723561645f, 0.707694888f},
-std::array<float,2>{0.373658031f, 0.459729463f},
-std::array<float,2>{0.901161611f, 0.056974262f},
-std::array<float,2>{0.134575516f, 0.97838062f},
-std::array<float,2>{0.863306999f, 0.838571429f},
-std::array<float,2>{0.0219504628f, 0.174857691f},
-std::array<float,2>{0.522144139f, 0.321818084f},
-std::array<float,2>{0.415718764f, 0.553803802f},
-std::array<float,2>{0.617993593f, 0.911020577f},
-std::array<float,2>{0.491433591f, 0.0851448029f},
-std::array<float,2>{0.802287459f, 0.395276666f},
-std::array<float,2>{0.113031514f, 0.657617152f},
-std::array<float,2>{0.974081874f, 0.615804255f},
-std::array<float,2>{0.213763818f, 0.259018123f},
-std::array<float,2>{0.673844159f, 0.224924549f},
-std::array<float,2>{0.306951016f, 0.784714162f},
-std::array<float,2>{0.663160741f, 0.590804577f},
-std::array<float,2>{0.281919807f, 0.282487392f},
-std::array<float,2>{0.985888243f, 0.190597311f},
-std::array<float,2>{0.2023893f, 0.758168638f},
-std::array<float,2>{0.793655336f, 0.875705719f},
-std::array<float,2>{0.105329022f, 0.116206132f},
-std::array<float,2>{0.608743668f, 0.416396946f},
-std::array<float,2>{0.472723484f, 0.653213978f},
-std::array<float,2>{0.50155586f, 0.872341514f},
-std::array<float,2>{0.424445212f, 0.131461799f},
-std::array<float,2>{0.84485203f, 0.372636765f},
-std::array<float,2>{0.0102774007f, 0.508108974f},
-std::array<float,2>{0.879921138f, 0.740329921f},
-std::array<float,2>{0.146377727f, 0.480520576f},
-std::array<float,2>{0.74597311f, 0.0284597967f},
-std::array<float,2>{0.345979512f, 0.963487148f},
-std::array<float,2>{0.57071352f, 0.674206913f},
-std::array<float,2>{0.448274404f, 0.382568389f},
-std::array<float,2>{0.771347463f, 0.0710903481f},
-std::array<float,2>{0.0762333572f, 0.933862567f},
-std::array<float,2>{0.958672941f, 0.797624111f},
-std::array<float,2>{0.237095639f, 0.24161467f},
-std::array<float,2>{0.636975706f, 0.267668873f},
-std::array<float,2>{0.259970874f, 0.599450707f},
-std::array<float,2>{0.699977279f, 0.998852074f},
-std::array<float,2>{0.341947675f, 0.0320746526f},
-std::array<float,2>{0.917440414f, 0.438324094f},
-std::array<float,2>{0.186909422f, 0.698648572f},
-std::array<float,2>{0.83047837f, 0.536046326f},
-std::array<float,2>{0.0467209145f, 0.328136325f},
-std::array<float,2>{0.557762325f, 0.1594055f},
-std::array<float,2>{0.376150191f, 0.824247837f},
-std::array<float,2>{0.594416618f, 0.602545261f},
-std::array<float,2>{0.477842152f, 0.278977156f},
-std::array<float,2>{0.788928151f, 0.248029307f},
-std::array<float,2>{0.101346634f, 0.807562709f},
-std::array<float,2>{0.999750555f, 0.92526418f},
-std::array<float,2>{0.192310438f, 0.0634630993f},
-std::array<float,2>{0.666616738f, 0.389784455f},
-std::array<float,2>{0.295796186f, 0.683847308f},
-std::array<float,2>{0.734771848f, 0.818709373f},
-std::array<float,2>{0.352717787f, 0.164189667f},
-std::array<float,2>{0.889893055f, 0.341309011f},
-std::array<float,2>{0.152861461f, 0.544111967f},
-std::array<float,2>{0.855810881f, 0.689060271f},
-std::array<float,2>{0.00197507278f, 0.44742313f},
-std::array<float,2>{0.508837759f, 0.0464199632f},
-std::array<float,2>{0.431668311f, 0.988559008f},
-std::array<float,2>{0.632069647f, 0.646667957f},
-std::array<float,2>{0.250770956f, 0.413411349f},
-std::array<float,2>{0.963848531f, 0.123215161f},
-std::array<float,2>{0.243022308f, 0.888257086f},
-std::array<float,2>{0.776848376f, 0.755417705f},
-std::array<float,2>{0.0637902617f, 0.196321517f},
-std::array<float,2>{0.566444576f, 0.29578656f},
-std::array<float,2>{0.43970871f, 0.585741043f},
-std::array<float,2>{0.553079247f, 0.95771569f},
-std::array<float,2>{0.390364379f, 0.0214128904f},
-std::array<float,2>{0.836170912f, 0.475164562f},
-std::array<float,2>{0.0367290415f, 0.745275795f},
-std::array<float,2>{0.907734513f, 0.500039458f},
-std::array<float,2>{0.176457122f, 0.365450948f},
-std::array<float,2>{0.692546904f, 0.134045124f},
-std::array<float,2>{0.333776861f, 0.859897912f},
-std::array<float,2>{0.70337975f, 0.561851323f},
-std::array<float,2>{0.320536405f, 0.316951782f},
-std::array<float,2>{0.929946363f, 0.186652929f},
-std::array<float,2>{0.171646208f, 0.830923319f},
-std::array<float,2>{0.815099895f, 0.969471574f},
-std::array<float,2>{0.0563998297f, 0.0503345616f},
-std::array<float,2>{0.531577528f, 0.462805688f},
-std::array<float,2>{0.404133528f, 0.716353357f},
-std::array<float,2>{0.593207836f, 0.792204499f},
-std::array<float,2>{0.464262635f, 0.227033466f},
-std::array<float,2>{0.763914764f, 0.256187171f},
-std::array<float,2>{0.092110686f, 0.621635199f},
-std::array<float,2>{0.940029442f, 0.668228269f},
-std::array<float,2>{0.232187673f, 0.398517519f},
-std::array<float,2>{0.647505224f, 0.0923695415f},
-std::array<float,2>{0.269001633f, 0.920593023f},
-std::array<float,2>{0.524313688f, 0.72929734f},
-std::array<float,2>{0.407145947f, 0.491275758f},
-std::array<float,2>{0.872640848f, 0.00514956564f},
-std::array<float,2>{0.0306114201f, 0.952103913f},
-std::array<float,2>{0.89505142f, 0.853806794f},
-std::array<float,2>{0.128402591f, 0.154289216f},
-std::array<float,2>{0.730460823f, 0.343863964f},
-std::array<float,2>{0.365870357f, 0.521372378f},
-std::array<float,2>{0.683983982f, 0.892947257f},
-std::array<float,2>{0.301138759f, 0.100326151f},
-std::array<float,2>{0.983852923f, 0.42636472f},
-std::array<float,2>{0.2098611f, 0.637417078f},
-std::array<float,2>{0.808785141f, 0.572961152f},
-std::array<float,2>{0.11722482f, 0.311748624f},
-std::array<float,2>{0.616373539f, 0.213558674f},
-std::array<float,2>{0.498128772f, 0.773006976f},
-std::array<float,2>{0.512894452f, 0.562846005f},
-std::array<float,2>{0.434576511f, 0.29985857f},
-std::array<float,2>{0.853911638f, 0.20349957f},
-std::array<float,2>{0.00529678818f, 0.781175792f},
-std::array<float,2>{0.883384228f, 0.899599552f},
-std::array<float,2>{0.152201697f, 0.102978371f},
-std::array<float,2>{0.741514206f, 0.434235245f},
-std::array<float,2>{0.358584523f, 0.631485641f},
-std::array<float,2>{0.670398474f, 0.846834242f},
-std::array<float,2>{0.290697783f, 0.143961087f},
-std::array<float,2>{0.99401778f, 0.359297931f},
-std::array<float,2>{0.188442871f, 0.530622721f},
-std::array<float,2>{0.784887493f, 0.720174849f},
-std::array<float,2>{0.0955947638f, 0.492837191f},
-std::array<float,2>{0.599891245f, 0.013122702f},
-std::array<float,2>{0.483171225f, 0.937938154f},
-std::array<float,2>{0.690724194f, 0.661609709f},
-std::array<float,2>{0.331108719f, 0.391179413f},
-std::array<float,2>{0.910561562f, 0.0815692395f},
-std::array<float,2>{0.174124196f, 0.907565534f},
-std::array<float,2>{0.842401922f, 0.788912654f},
-std::array<float,2>{0.033805944f, 0.221260071f},
-std::array<float,2>{0.548054993f, 0.262355655f},
-std::array<float,2>{0.384164304f, 0.61248225f},
-std::array<float,2>{0.565702438f, 0.983316898f},
-std::array<float,2>{0.442430645f, 0.0586289726f},
-std::array<float,2>{0.780202687f, 0.453881174f},
-std::array<float,2>{0.0690516382f, 0.704405069f},
-std::array<float,2>{0.965223193f, 0.547962785f},
-std::array<float,2>{0.248055547f, 0.326985598f},
-std::array<float,2>{0.626063943f, 0.176433697f},
-std::array<float,2>{0.255742431f, 0.843535781f},
-std::array<float,2>{0.642378271f, 0.514099956f},
-std::array<float,2>{0.270866752f, 0.369869441f},
-std::array<float,2>{0.944711208f, 0.12726739f},
-std::array<float,2>{0.228615686f, 0.868458867f},
-std::array<float,2>{0.758063912f, 0.965593278f},
-std::array<float,2>{0.0881969333f, 0.0270933509f},
-std::array<float,2>{0.587323904f, 0.47890231f},
-std::array<float,2>{0.46757105f, 0.734801114f},
-std::array<float,2>{0.538989127f, 0.762589097f},
-std::array<float,2>{0.398723662f, 0.192415237f},
-std::array<float,2>{0.817719877f, 0.288045198f},
-std::array<float,2>{0.0609353036f, 0.586609781f},
-std::array<float,2>{0.933771491f, 0.651966274f},
-std::array<float,2>{0.165606067f, 0.417989314f},
-std::array<float,2>{0.707114041f, 0.112576082f},
-std::array<float,2>{0.325918645f, 0.879412591f},
-std::array<float,2>{0.610029995f, 0.700221479f},
-std::array<float,2>{0.495622128f, 0.442011058f},
-std::array<float,2>{0.806846917f, 0.0379427522f},
-std::array<float,2>{0.121968225f, 0.993163884f},
-std::array<float,2>{0.978334725f, 0.822395205f},
-std::array<float,2>{0.203898579f, 0.163506418f},
-std::array<float,2>{0.683018029f, 0.334522724f},
-std::array<float,2>{0.297706783f, 0.531941473f},
-std::array<float,2>{0.732468426f, 0.930555999f},
-std::array<float,2>{0.362855971f, 0.0758761019f},
-std::array<float,2>{0.891492069f, 0.378535539f},
-std::array<float,2>{0.132453218f, 0.676270306f},
-std::array<float,2>{0.868629158f, 0.594612718f},
-std::array<float,2>{0.0251545496f, 0.272639275f},
-std::array<float,2>{0.52977705f, 0.237078086f},
-std::array<float,2>{0.412411422f, 0.802217066f},
-std::array<float,2>{0.579944909f, 0.542586446f},
-std::array<float,2>{0.457033813f, 0.33883673f},
-std::array<float,2>{0.756101489f, 0.168088973f},
-std::array<float,2>{0.0821159258f, 0.81293875f},
-std::array<float,2>{0.946570694f, 0.987323821f},
-std::array<float,2>{0.222253278f, 0.0403718911f},
-std::array<float,2>{0.655598998f, 0.449301541f},
-std::array<float,2>{0.275502473f, 0.693152308f},
-std::array<float,2>{0.716973066f, 0.808674097f},
-std::array<float,2>{0.315430969f, 0.244054094f},
-std::array<float,2>{0.92889303f, 0.273465484f},
-std::array<float,2>{0.157394305f, 0.606292248f},
-std::array<float,2>{0.825828373f, 0.682633519f},
-std::array<float,2>{0.0498596728f, 0.384586006f},
-std::array<float,2>{0.54050678f, 0.0690504685f},
-std::array<float,2>{0.392903358f, 0.926825404f},
-std::array<float,2>{0.67966491f, 0.749056041f},
-std::array<float,2>{0.311964214f, 0.47176984f},
-std::array<float,2>{0.970200062f, 0.0168443918f},
-std::array<float,2>{0.217822075f, 0.954002261f},
-std::array<float,2>{0.798648596f, 0.864127636f},
-std::array<float,2>{0.115382493f, 0.140146807f},
-std::array<float,2>{0.621367216f, 0.359978795f},
-std::array<float,2>{0.484735578f, 0.505402327f},
-std::array<float,2>{0.515960634f, 0.885469854f},
-std::array<float,2>{0.421188176f, 0.120601013f},
-std::array<float,2>{0.859970212f, 0.407638878f},
-std::array<float,2>{0.0161836799f, 0.643778622f},
-std::array<float,2>{0.903563321f, 0.581489742f},
-std::array<float,2>{0.138891771f, 0.291081667f},
-std::array<float,2>{0.720914721f, 0.203077137f},
-std::array<float,2>{0.370162576f, 0.752915919f},
-std::array<float,2>{0.749393046f, 0.619226873f},
-std::array<float,2>{0.348873049f, 0.25222826f},
-std::array<float,2>{0.87606287f, 0.23235175f},
-std::array<float,2>{0.143740356f, 0.796376169f},
-std::array<float,2>{0.849431694f, 0.914588511f},
-std::array<float,2>{0.0141734425f, 0.088668704f},
-std::array<float,2>{0.507749498f, 0.404111475f},
-std::array<float,2>{0.427681178f, 0.666883349f},
-std::array<float,2>{0.602555335f, 0.833776176f},
-std::array<float,2>{0.469711959f, 0.183216408f},
-std::array<float,2>{0.78930074f, 0.313214898f},
-std::array<float,2>{0.109335229f, 0.557690382f},
-std::array<float,2>{0.990149438f, 0.713944912f},
-std::array<float,2>{0.198653653f, 0.466723919f},
-std::array<float,2>{0.656384289f, 0.051195126f},
-std::array<float,2>{0.285567522f, 0.974083543f},
-std::array<float,2>{0.559438407f, 0.635741472f},
-std::array<float,2>{0.381915718f, 0.42367968f},
-std::array<float,2>{0.832706809f, 0.0967122838f},
-std::array<float,2>{0.0394953974f, 0.897503316f},
-std::array<float,2>{0.91958791f, 0.765633941f},
-std::array<float,2>{0.181953862f, 0.218243584f},
-std::array<float,2>{0.698901951f, 0.307699591f},
-std::array<float,2>{0.338567168f, 0.576298654f},
-std::array<float,2>{0.634814441f, 0.94671458f},
-std::array<float,2>{0.263851613f, 0.000810115191f},
-std::array<float,2>{0.956806779f, 0.485765696f},
-std::array<float,2>{0.241739705f, 0.732949018f},
-std::array<float,2>{0.766481459f, 0.517922878f},
-std::array<float,2>{0.0732011572f, 0.350965291f},
-std::array<float,2>{0.574719012f, 0.151038259f},
-std::array<float,2>{0.451272219f, 0.856629968f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.836561322f, 0.0879813284f},
-std::array<float,2>{0.448832005f, 0.781239212f},
-std::array<float,2>{0.508597076f, 0.623717248f},
-std::array<float,2>{0.12150459f, 0.438480586f},
-std::array<float,2>{0.636731923f, 0.300182164f},
-std::array<float,2>{0.198350161f, 0.705522656f},
-std::array<float,2>{0.980684519f, 0.890695691f},
-std::array<float,2>{0.357825905f, 0.132581905f},
-std::array<float,2>{0.568263113f, 0.210107818f},
-std::array<float,2>{0.0536217876f, 0.992436528f},
-std::array<float,2>{0.768143892f, 0.636725605f},
-std::array<float,2>{0.430228353f, 0.316612512f},
-std::array<float,2>{0.923645675f, 0.390120447f},
-std::array<float,2>{0.29998666f, 0.539370239f},
-std::array<float,2>{0.689212918f, 0.842433572f},
-std::array<float,2>{0.160216555f, 0.0266552754f},
-std::array<float,2>{0.953101814f, 0.157377467f},
-std::array<float,2>{0.332743615f, 0.920915306f},
-std::array<float,2>{0.672657788f, 0.744804978f},
-std::array<float,2>{0.245549604f, 0.270027399f},
-std::array<float,2>{0.535849988f, 0.475869685f},
-std::array<float,2>{0.0684914365f, 0.581595778f},
-std::array<float,2>{0.86755687f, 0.782428026f},
-std::array<float,2>{0.473139852f, 0.0974012762f},
-std::array<float,2>{0.738650441f, 0.050332889f},
-std::array<float,2>{0.144210815f, 0.863128722f},
-std::array<float,2>{0.882864356f, 0.503892303f},
-std::array<float,2>{0.25773713f, 0.432159126f},
-std::array<float,2>{0.784587085f, 0.367862254f},
-std::array<float,2>{0.384677559f, 0.676731706f},
-std::array<float,2>{0.615542531f, 0.93983978f},
-std::array<float,2>{0.0251956116f, 0.249347314f},
-std::array<float,2>{0.903857708f, 0.0112122102f},
-std::array<float,2>{0.270736754f, 0.823267877f},
-std::array<float,2>{0.721321106f, 0.548069298f},
-std::array<float,2>{0.133808002f, 0.394042909f},
-std::array<float,2>{0.601128101f, 0.336290509f},
-std::array<float,2>{0.0155996149f, 0.652033567f},
-std::array<float,2>{0.799187243f, 0.975597322f},
-std::array<float,2>{0.399894208f, 0.201864466f},
-std::array<float,2>{0.658508539f, 0.142584726f},
-std::array<float,2>{0.234112293f, 0.889057398f},
-std::array<float,2>{0.963884652f, 0.696222723f},
-std::array<float,2>{0.318421811f, 0.288969308f},
-std::array<float,2>{0.851893604f, 0.464505255f},
-std::array<float,2>{0.486108333f, 0.607583404f},
-std::array<float,2>{0.560869873f, 0.758145213f},
-std::array<float,2>{0.0912970901f, 0.0746259019f},
-std::array<float,2>{0.765198648f, 0.220094264f},
-std::array<float,2>{0.417908818f, 0.960132062f},
-std::array<float,2>{0.581921935f, 0.656500518f},
-std::array<float,2>{0.0356275029f, 0.348418266f},
-std::array<float,2>{0.709211469f, 0.414811999f},
-std::array<float,2>{0.17193909f, 0.521843672f},
-std::array<float,2>{0.908583164f, 0.851539075f},
-std::array<float,2>{0.285058856f, 0.0335043035f},
-std::array<float,2>{0.516944587f, 0.123245038f},
-std::array<float,2>{0.0968011022f, 0.808870375f},
-std::array<float,2>{0.818192661f, 0.5779562f},
-std::array<float,2>{0.465518266f, 0.497740388f},
-std::array<float,2>{0.995995939f, 0.252071887f},
-std::array<float,2>{0.370025426f, 0.72307986f},
-std::array<float,2>{0.649562657f, 0.92832303f},
-std::array<float,2>{0.205581799f, 0.173868239f},
-std::array<float,2>{0.808763325f, 0.0394809023f},
-std::array<float,2>{0.392281204f, 0.854018331f},
-std::array<float,2>{0.607584715f, 0.524239123f},
-std::array<float,2>{0.00707245292f, 0.408539146f},
-std::array<float,2>{0.731240034f, 0.354187459f},
-std::array<float,2>{0.127462372f, 0.668222547f},
-std::array<float,2>{0.893929183f, 0.964049816f},
-std::array<float,2>{0.279645652f, 0.232173309f},
-std::array<float,2>{0.552002728f, 0.182098106f},
-std::array<float,2>{0.0832981095f, 0.931077719f},
-std::array<float,2>{0.844263256f, 0.726800501f},
-std::array<float,2>{0.496238291f, 0.259768039f},
-std::array<float,2>{0.95962441f, 0.489814132f},
-std::array<float,2>{0.326390684f, 0.564625442f},
-std::array<float,2>{0.664280891f, 0.798776567f},
-std::array<float,2>{0.221067652f, 0.11471349f},
-std::array<float,2>{0.921249807f, 0.190000713f},
-std::array<float,2>{0.291656226f, 0.977743566f},
-std::array<float,2>{0.71173656f, 0.645886183f},
-std::array<float,2>{0.187040642f, 0.335692495f},
-std::array<float,2>{0.58848083f, 0.405238569f},
-std::array<float,2>{0.0421396606f, 0.55501312f},
-std::array<float,2>{0.756633818f, 0.819733322f},
-std::array<float,2>{0.409101218f, 0.000590137555f},
-std::array<float,2>{0.647633314f, 0.0640498176f},
-std::array<float,2>{0.212308601f, 0.757341981f},
-std::array<float,2>{0.984593868f, 0.595943928f},
-std::array<float,2>{0.361080259f, 0.458849519f},
-std::array<float,2>{0.824422657f, 0.290675759f},
-std::array<float,2>{0.454010993f, 0.687612355f},
-std::array<float,2>{0.526843131f, 0.875526905f},
-std::array<float,2>{0.103105508f, 0.15572983f},
-std::array<float,2>{0.975711048f, 0.105680875f},
-std::array<float,2>{0.349180847f, 0.794010222f},
-std::array<float,2>{0.628096163f, 0.587939918f},
-std::array<float,2>{0.193436384f, 0.477907896f},
-std::array<float,2>{0.505954623f, 0.277214766f},
-std::array<float,2>{0.110842735f, 0.739671648f},
-std::array<float,2>{0.829290986f, 0.911907554f},
-std::array<float,2>{0.445020974f, 0.169053733f},
-std::array<float,2>{0.699791908f, 0.24145858f},
-std::array<float,2>{0.164301366f, 0.949597299f},
-std::array<float,2>{0.929966152f, 0.682146549f},
-std::array<float,2>{0.311925411f, 0.359518379f},
-std::array<float,2>{0.780117393f, 0.42903161f},
-std::array<float,2>{0.426570356f, 0.510547101f},
-std::array<float,2>{0.578025222f, 0.868809342f},
-std::array<float,2>{0.0546985008f, 0.0563498922f},
-std::array<float,2>{0.860231102f, 0.137971327f},
-std::array<float,2>{0.483633518f, 0.898754835f},
-std::array<float,2>{0.542372227f, 0.715246379f},
-std::array<float,2>{0.0776790008f, 0.30860284f},
-std::array<float,2>{0.682258189f, 0.45022285f},
-std::array<float,2>{0.238793328f, 0.611192405f},
-std::array<float,2>{0.941818357f, 0.769751787f},
-std::array<float,2>{0.341833115f, 0.0854213387f},
-std::array<float,2>{0.62399739f, 0.0214929171f},
-std::array<float,2>{0.0175606795f, 0.835039079f},
-std::array<float,2>{0.793968976f, 0.533903539f},
-std::array<float,2>{0.376344442f, 0.379173964f},
-std::array<float,2>{0.876397192f, 0.323897183f},
-std::array<float,2>{0.265377879f, 0.632421553f},
-std::array<float,2>{0.744753838f, 0.986934245f},
-std::array<float,2>{0.148899361f, 0.213681519f},
-std::array<float,2>{0.772093296f, 0.111196339f},
-std::array<float,2>{0.43617627f, 0.803634763f},
-std::array<float,2>{0.562663853f, 0.567254305f},
-std::array<float,2>{0.0472638868f, 0.486275196f},
-std::array<float,2>{0.694612503f, 0.262828887f},
-std::array<float,2>{0.15650107f, 0.731452763f},
-std::array<float,2>{0.927957475f, 0.936992407f},
-std::array<float,2>{0.302124709f, 0.187327445f},
-std::array<float,2>{0.512122512f, 0.22865589f},
-std::array<float,2>{0.117558397f, 0.966336131f},
-std::array<float,2>{0.840938151f, 0.666023076f},
-std::array<float,2>{0.451971054f, 0.356279969f},
-std::array<float,2>{0.979812384f, 0.410880923f},
-std::array<float,2>{0.354855627f, 0.52948302f},
-std::array<float,2>{0.635413229f, 0.855889201f},
-std::array<float,2>{0.201770395f, 0.0444560312f},
-std::array<float,2>{0.889274538f, 0.148529574f},
-std::array<float,2>{0.253358394f, 0.880894601f},
-std::array<float,2>{0.738123477f, 0.691676021f},
-std::array<float,2>{0.144590914f, 0.293665946f},
-std::array<float,2>{0.611951768f, 0.455162764f},
-std::array<float,2>{0.0308416132f, 0.600194693f},
-std::array<float,2>{0.787762523f, 0.750272214f},
-std::array<float,2>{0.388367146f, 0.0683872774f},
-std::array<float,2>{0.676036298f, 0.00492226426f},
-std::array<float,2>{0.249008268f, 0.815114439f},
-std::array<float,2>{0.945941865f, 0.559299648f},
-std::array<float,2>{0.331606328f, 0.399502784f},
-std::array<float,2>{0.873880327f, 0.328698307f},
-std::array<float,2>{0.469723433f, 0.64073509f},
-std::array<float,2>{0.533744574f, 0.98338896f},
-std::array<float,2>{0.0652553067f, 0.19453384f},
-std::array<float,2>{0.965103924f, 0.0622525476f},
-std::array<float,2>{0.313407093f, 0.872076333f},
-std::array<float,2>{0.660992503f, 0.512512147f},
-std::array<float,2>{0.227126256f, 0.422702968f},
-std::array<float,2>{0.556156039f, 0.365588516f},
-std::array<float,2>{0.0862231627f, 0.687164485f},
-std::array<float,2>{0.857697845f, 0.949058294f},
-std::array<float,2>{0.489108682f, 0.236499533f},
-std::array<float,2>{0.725044012f, 0.166333482f},
-std::array<float,2>{0.137662575f, 0.907254636f},
-std::array<float,2>{0.901477098f, 0.737529039f},
-std::array<float,2>{0.268253595f, 0.280234963f},
-std::array<float,2>{0.803887665f, 0.480655253f},
-std::array<float,2>{0.403474212f, 0.591611683f},
-std::array<float,2>{0.595966756f, 0.792711616f},
-std::array<float,2>{0.00967584085f, 0.102216199f},
-std::array<float,2>{0.813526154f, 0.215563938f},
-std::array<float,2>{0.461024642f, 0.990534365f},
-std::array<float,2>{0.520929992f, 0.625255287f},
-std::array<float,2>{0.0997422636f, 0.327871263f},
-std::array<float,2>{0.65243417f, 0.376608491f},
-std::array<float,2>{0.207263768f, 0.53539443f},
-std::array<float,2>{0.999318242f, 0.831295311f},
-std::array<float,2>{0.372145891f, 0.0166601371f},
-std::array<float,2>{0.583046198f, 0.0804760009f},
-std::array<float,2>{0.0331496969f, 0.76609993f},
-std::array<float,2>{0.761617839f, 0.615432382f},
-std::array<float,2>{0.418809086f, 0.448397666f},
-std::array<float,2>{0.911036134f, 0.305412769f},
-std::array<float,2>{0.287461281f, 0.713556111f},
-std::array<float,2>{0.706412256f, 0.903911114f},
-std::array<float,2>{0.176093712f, 0.133945286f},
-std::array<float,2>{0.849863768f, 0.0299245007f},
-std::array<float,2>{0.494061023f, 0.839518249f},
-std::array<float,2>{0.54946804f, 0.546517372f},
-std::array<float,2>{0.0811079293f, 0.383927166f},
-std::array<float,2>{0.671457469f, 0.314209253f},
-std::array<float,2>{0.225687563f, 0.635042667f},
-std::array<float,2>{0.956111968f, 0.998673201f},
-std::array<float,2>{0.322139472f, 0.206227407f},
-std::array<float,2>{0.602061689f, 0.127053052f},
-std::array<float,2>{0.000380501413f, 0.89837867f},
-std::array<float,2>{0.805692554f, 0.708536446f},
-std::array<float,2>{0.395620435f, 0.300880909f},
-std::array<float,2>{0.896968186f, 0.443541467f},
-std::array<float,2>{0.276860982f, 0.620178282f},
-std::array<float,2>{0.727943003f, 0.774813294f},
-std::array<float,2>{0.13214156f, 0.091008313f},
-std::array<float,2>{0.991910875f, 0.244790375f},
-std::array<float,2>{0.36401251f, 0.944701314f},
-std::array<float,2>{0.643117368f, 0.674712956f},
-std::array<float,2>{0.216294959f, 0.371355832f},
-std::array<float,2>{0.530179679f, 0.436049074f},
-std::array<float,2>{0.109132819f, 0.507263064f},
-std::array<float,2>{0.820521176f, 0.864904225f},
-std::array<float,2>{0.458056211f, 0.0543279424f},
-std::array<float,2>{0.717756867f, 0.098913908f},
-std::array<float,2>{0.18337132f, 0.788922071f},
-std::array<float,2>{0.915321231f, 0.583915174f},
-std::array<float,2>{0.296643585f, 0.472467065f},
-std::array<float,2>{0.752509654f, 0.265871286f},
-std::array<float,2>{0.413757354f, 0.748524189f},
-std::array<float,2>{0.59351325f, 0.917063475f},
-std::array<float,2>{0.0434480011f, 0.160186216f},
-std::array<float,2>{0.936998963f, 0.0722039044f},
-std::array<float,2>{0.307737619f, 0.765089691f},
-std::array<float,2>{0.697487235f, 0.602340341f},
-std::array<float,2>{0.168401748f, 0.466965169f},
-std::array<float,2>{0.570756495f, 0.284037083f},
-std::array<float,2>{0.0623527318f, 0.699581206f},
-std::array<float,2>{0.774690926f, 0.885346472f},
-std::array<float,2>{0.424925476f, 0.147995427f},
-std::array<float,2>{0.629050195f, 0.196458936f},
-std::array<float,2>{0.187541962f, 0.972106874f},
-std::array<float,2>{0.969363093f, 0.654948294f},
-std::array<float,2>{0.347195715f, 0.341368794f},
-std::array<float,2>{0.83226186f, 0.397751451f},
-std::array<float,2>{0.440443963f, 0.553165436f},
-std::array<float,2>{0.503819227f, 0.827828884f},
-std::array<float,2>{0.116729662f, 0.014372468f},
-std::array<float,2>{0.790068328f, 0.17670624f},
-std::array<float,2>{0.380074501f, 0.924584806f},
-std::array<float,2>{0.620592237f, 0.72130537f},
-std::array<float,2>{0.0223572366f, 0.257223189f},
-std::array<float,2>{0.748209357f, 0.493360817f},
-std::array<float,2>{0.152785078f, 0.572442949f},
-std::array<float,2>{0.881717026f, 0.808203936f},
-std::array<float,2>{0.261464953f, 0.119135104f},
-std::array<float,2>{0.545738995f, 0.0359859429f},
-std::array<float,2>{0.0731025413f, 0.846605837f},
-std::array<float,2>{0.865044534f, 0.517964005f},
-std::array<float,2>{0.476801902f, 0.419916898f},
-std::array<float,2>{0.937871158f, 0.345103174f},
-std::array<float,2>{0.338996261f, 0.662950277f},
-std::array<float,2>{0.686402321f, 0.956908643f},
-std::array<float,2>{0.235962227f, 0.224171221f},
-std::array<float,2>{0.869627893f, 0.0956295803f},
-std::array<float,2>{0.475205213f, 0.784966528f},
-std::array<float,2>{0.538259029f, 0.579657972f},
-std::array<float,2>{0.0668290108f, 0.472787291f},
-std::array<float,2>{0.674986303f, 0.271880329f},
-std::array<float,2>{0.243671149f, 0.743689477f},
-std::array<float,2>{0.950667381f, 0.919717848f},
-std::array<float,2>{0.335064203f, 0.159388721f},
-std::array<float,2>{0.61431694f, 0.247358978f},
-std::array<float,2>{0.0270496495f, 0.93921417f},
-std::array<float,2>{0.782859385f, 0.679669261f},
-std::array<float,2>{0.385427266f, 0.369187325f},
-std::array<float,2>{0.885840178f, 0.430817872f},
-std::array<float,2>{0.255147308f, 0.500460804f},
-std::array<float,2>{0.741670907f, 0.860627413f},
-std::array<float,2>{0.140712678f, 0.0480110385f},
-std::array<float,2>{0.983896196f, 0.130719826f},
-std::array<float,2>{0.357405454f, 0.892697513f},
-std::array<float,2>{0.639252841f, 0.704345107f},
-std::array<float,2>{0.19638446f, 0.297958165f},
-std::array<float,2>{0.511447966f, 0.439774811f},
-std::array<float,2>{0.124147259f, 0.621121526f},
-std::array<float,2>{0.839820266f, 0.778120816f},
-std::array<float,2>{0.446139425f, 0.0877354667f},
-std::array<float,2>{0.691387296f, 0.0247788001f},
-std::array<float,2>{0.162574306f, 0.840778649f},
-std::array<float,2>{0.92400229f, 0.542495728f},
-std::array<float,2>{0.297481179f, 0.388396531f},
-std::array<float,2>{0.767279327f, 0.318441093f},
-std::array<float,2>{0.432490915f, 0.640523791f},
-std::array<float,2>{0.568994761f, 0.995375097f},
-std::array<float,2>{0.0508323163f, 0.208519921f},
-std::array<float,2>{0.908185542f, 0.0314764678f},
-std::array<float,2>{0.282164186f, 0.849420607f},
-std::array<float,2>{0.707678378f, 0.521419883f},
-std::array<float,2>{0.173883811f, 0.416989952f},
-std::array<float,2>{0.579783797f, 0.349984676f},
-std::array<float,2>{0.038338732f, 0.660038412f},
-std::array<float,2>{0.762448609f, 0.958944917f},
-std::array<float,2>{0.414764374f, 0.220897242f},
-std::array<float,2>{0.652004182f, 0.172945842f},
-std::array<float,2>{0.205009744f, 0.926938891f},
-std::array<float,2>{0.992409348f, 0.725941002f},
-std::array<float,2>{0.368298978f, 0.251452565f},
-std::array<float,2>{0.819836855f, 0.498566538f},
-std::array<float,2>{0.468153477f, 0.576046765f},
-std::array<float,2>{0.519433081f, 0.811144054f},
-std::array<float,2>{0.0940869227f, 0.122743934f},
-std::array<float,2>{0.797890961f, 0.200516403f},
-std::array<float,2>{0.401441008f, 0.972693026f},
-std::array<float,2>{0.598448932f, 0.650136352f},
-std::array<float,2>{0.012535193f, 0.339316398f},
-std::array<float,2>{0.720422924f, 0.390986919f},
-std::array<float,2>{0.136044815f, 0.549521446f},
-std::array<float,2>{0.905322552f, 0.82123965f},
-std::array<float,2>{0.272761852f, 0.00972940587f},
-std::array<float,2>{0.559738934f, 0.0779525638f},
-std::array<float,2>{0.0929223672f, 0.760276556f},
-std::array<float,2>{0.855357468f, 0.605665028f},
-std::array<float,2>{0.487908274f, 0.462315351f},
-std::array<float,2>{0.962027669f, 0.285756737f},
-std::array<float,2>{0.317678034f, 0.698770165f},
-std::array<float,2>{0.656539798f, 0.888190269f},
-std::array<float,2>{0.230940938f, 0.141585618f},
-std::array<float,2>{0.754133642f, 0.0030016785f},
-std::array<float,2>{0.407822818f, 0.817217171f},
-std::array<float,2>{0.586684108f, 0.558037102f},
-std::array<float,2>{0.0407621078f, 0.403596193f},
-std::array<float,2>{0.713736594f, 0.333646834f},
-std::array<float,2>{0.184460029f, 0.64704299f},
-std::array<float,2>{0.918726206f, 0.979874551f},
-std::array<float,2>{0.289117396f, 0.189307451f},
-std::array<float,2>{0.524538398f, 0.153499678f},
-std::array<float,2>{0.104485489f, 0.877937794f},
-std::array<float,2>{0.826264977f, 0.690454185f},
-std::array<float,2>{0.455529481f, 0.292156607f},
-std::array<float,2>{0.987454176f, 0.460528433f},
-std::array<float,2>{0.361418486f, 0.59396112f},
-std::array<float,2>{0.646002233f, 0.755465567f},
-std::array<float,2>{0.21423009f, 0.0644677654f},
-std::array<float,2>{0.890656233f, 0.233701184f},
-std::array<float,2>{0.27777192f, 0.962248623f},
-std::array<float,2>{0.732953608f, 0.670579731f},
-std::array<float,2>{0.126681343f, 0.35221225f},
-std::array<float,2>{0.606461048f, 0.407227516f},
-std::array<float,2>{0.00517502427f, 0.526158869f},
-std::array<float,2>{0.812006474f, 0.85296756f},
-std::array<float,2>{0.393012583f, 0.0428400822f},
-std::array<float,2>{0.666858137f, 0.116164744f},
-std::array<float,2>{0.21895501f, 0.799972832f},
-std::array<float,2>{0.957243741f, 0.56422323f},
-std::array<float,2>{0.324362129f, 0.491159678f},
-std::array<float,2>{0.846890748f, 0.259185046f},
-std::array<float,2>{0.498383492f, 0.730165005f},
-std::array<float,2>{0.553250015f, 0.931826532f},
-std::array<float,2>{0.0845269412f, 0.180208057f},
-std::array<float,2>{0.945285141f, 0.0824447647f},
-std::array<float,2>{0.339941204f, 0.772843897f},
-std::array<float,2>{0.679867744f, 0.6130265f},
-std::array<float,2>{0.241495699f, 0.452092022f},
-std::array<float,2>{0.540442586f, 0.310914397f},
-std::array<float,2>{0.0747069418f, 0.717797697f},
-std::array<float,2>{0.86274153f, 0.901027262f},
-std::array<float,2>{0.480586946f, 0.140566692f},
-std::array<float,2>{0.742393434f, 0.210977688f},
-std::array<float,2>{0.151127607f, 0.986109436f},
-std::array<float,2>{0.878204286f, 0.629422903f},
-std::array<float,2>{0.263134092f, 0.320398182f},
-std::array<float,2>{0.795366883f, 0.382299066f},
-std::array<float,2>{0.378504872f, 0.532402217f},
-std::array<float,2>{0.621693909f, 0.833319962f},
-std::array<float,2>{0.019287983f, 0.0200070255f},
-std::array<float,2>{0.831993043f, 0.170485795f},
-std::array<float,2>{0.442120582f, 0.913139582f},
-std::array<float,2>{0.504660189f, 0.74098444f},
-std::array<float,2>{0.112652928f, 0.274031252f},
-std::array<float,2>{0.626638889f, 0.480341524f},
-std::array<float,2>{0.191852719f, 0.587016344f},
-std::array<float,2>{0.973002732f, 0.795002222f},
-std::array<float,2>{0.351124644f, 0.109055437f},
-std::array<float,2>{0.576113939f, 0.0581703931f},
-std::array<float,2>{0.0579496026f, 0.869340658f},
-std::array<float,2>{0.77869302f, 0.509040415f},
-std::array<float,2>{0.428765506f, 0.426589131f},
-std::array<float,2>{0.933240354f, 0.362166941f},
-std::array<float,2>{0.310354203f, 0.68152082f},
-std::array<float,2>{0.701226234f, 0.952623844f},
-std::array<float,2>{0.166624591f, 0.239217728f},
-std::array<float,2>{0.786966681f, 0.0672331676f},
-std::array<float,2>{0.390050173f, 0.75200212f},
-std::array<float,2>{0.610668421f, 0.599227309f},
-std::array<float,2>{0.0281809866f, 0.453159153f},
-std::array<float,2>{0.736178875f, 0.295830846f},
-std::array<float,2>{0.147278443f, 0.694840193f},
-std::array<float,2>{0.888670743f, 0.879461586f},
-std::array<float,2>{0.250848293f, 0.15148896f},
-std::array<float,2>{0.531935096f, 0.191799521f},
-std::array<float,2>{0.0640977398f, 0.981088817f},
-std::array<float,2>{0.872836769f, 0.643267214f},
-std::array<float,2>{0.471449912f, 0.331853718f},
-std::array<float,2>{0.947856069f, 0.401971698f},
-std::array<float,2>{0.329766005f, 0.561808109f},
-std::array<float,2>{0.677784026f, 0.814053416f},
-std::array<float,2>{0.247530997f, 0.0063580391f},
-std::array<float,2>{0.926269114f, 0.184911236f},
-std::array<float,2>{0.304480463f, 0.934378743f},
-std::array<float,2>{0.692049444f, 0.732886016f},
-std::array<float,2>{0.158943355f, 0.26386252f},
-std::array<float,2>{0.565192223f, 0.487251759f},
-std::array<float,2>{0.049839247f, 0.569519699f},
-std::array<float,2>{0.77049607f, 0.801688969f},
-std::array<float,2>{0.434591115f, 0.111641258f},
-std::array<float,2>{0.634118021f, 0.0457300358f},
-std::array<float,2>{0.199504673f, 0.857678056f},
-std::array<float,2>{0.976718545f, 0.528528929f},
-std::array<float,2>{0.353210211f, 0.413582951f},
-std::array<float,2>{0.842774093f, 0.35833016f},
-std::array<float,2>{0.449970841f, 0.665434539f},
-std::array<float,2>{0.514996886f, 0.967709839f},
-std::array<float,2>{0.119798928f, 0.227279156f},
-std::array<float,2>{0.997303128f, 0.0178969204f},
-std::array<float,2>{0.373504311f, 0.829563856f},
-std::array<float,2>{0.655180752f, 0.537639201f},
-std::array<float,2>{0.209091872f, 0.377042919f},
-std::array<float,2>{0.522761822f, 0.325784206f},
-std::array<float,2>{0.0995526165f, 0.62760967f},
-std::array<float,2>{0.814854801f, 0.988409162f},
-std::array<float,2>{0.463075429f, 0.218247205f},
-std::array<float,2>{0.704974055f, 0.135693908f},
-std::array<float,2>{0.179304451f, 0.904424608f},
-std::array<float,2>{0.91214633f, 0.712184429f},
-std::array<float,2>{0.286873758f, 0.308134288f},
-std::array<float,2>{0.757956028f, 0.446299106f},
-std::array<float,2>{0.420732766f, 0.614783227f},
-std::array<float,2>{0.584856212f, 0.768849313f},
-std::array<float,2>{0.0337604359f, 0.0781331584f},
-std::array<float,2>{0.857014298f, 0.234660625f},
-std::array<float,2>{0.491566449f, 0.946828961f},
-std::array<float,2>{0.55776298f, 0.683967769f},
-std::array<float,2>{0.0879648998f, 0.364433885f},
-std::array<float,2>{0.663821816f, 0.425199687f},
-std::array<float,2>{0.229900464f, 0.5149526f},
-std::array<float,2>{0.968218327f, 0.87491405f},
-std::array<float,2>{0.316138834f, 0.0601157472f},
-std::array<float,2>{0.595541596f, 0.103535265f},
-std::array<float,2>{0.0117166545f, 0.789268613f},
-std::array<float,2>{0.802199483f, 0.592988729f},
-std::array<float,2>{0.404769868f, 0.48276788f},
-std::array<float,2>{0.898873985f, 0.278845578f},
-std::array<float,2>{0.267175645f, 0.735461712f},
-std::array<float,2>{0.723705173f, 0.908791244f},
-std::array<float,2>{0.139526203f, 0.164932489f},
-std::array<float,2>{0.822317362f, 0.0512042269f},
-std::array<float,2>{0.459097207f, 0.867043316f},
-std::array<float,2>{0.528644562f, 0.505445778f},
-std::array<float,2>{0.107092418f, 0.435515821f},
-std::array<float,2>{0.641414702f, 0.37305662f},
-std::array<float,2>{0.218615547f, 0.673329651f},
-std::array<float,2>{0.989214838f, 0.941537142f},
-std::array<float,2>{0.365661263f, 0.243541047f},
-std::array<float,2>{0.591444373f, 0.163537189f},
-std::array<float,2>{0.04611459f, 0.915749431f},
-std::array<float,2>{0.750715077f, 0.746168733f},
-std::array<float,2>{0.411904037f, 0.268029869f},
-std::array<float,2>{0.916868031f, 0.470628262f},
-std::array<float,2>{0.293103516f, 0.584029019f},
-std::array<float,2>{0.71661824f, 0.785802305f},
-std::array<float,2>{0.1800998f, 0.100676857f},
-std::array<float,2>{0.954396725f, 0.204920724f},
-std::array<float,2>{0.322887421f, 0.996256292f},
-std::array<float,2>{0.669324756f, 0.634158313f},
-std::array<float,2>{0.223961353f, 0.314508677f},
-std::array<float,2>{0.54829067f, 0.385388225f},
-std::array<float,2>{0.0796408504f, 0.54468447f},
-std::array<float,2>{0.847891748f, 0.837075531f},
-std::array<float,2>{0.495178431f, 0.0288398452f},
-std::array<float,2>{0.729401112f, 0.092730917f},
-std::array<float,2>{0.130851552f, 0.776222885f},
-std::array<float,2>{0.896227419f, 0.617784023f},
-std::array<float,2>{0.275054693f, 0.442303687f},
-std::array<float,2>{0.807513297f, 0.303017765f},
-std::array<float,2>{0.397814184f, 0.709838629f},
-std::array<float,2>{0.603557527f, 0.89465332f},
-std::array<float,2>{0.00362200127f, 0.126654565f},
-std::array<float,2>{0.880366802f, 0.120662607f},
-std::array<float,2>{0.258798838f, 0.805039942f},
-std::array<float,2>{0.746282995f, 0.570839465f},
-std::array<float,2>{0.15534769f, 0.49517414f},
-std::array<float,2>{0.618421793f, 0.254686058f},
-std::array<float,2>{0.0208220873f, 0.719158411f},
-std::array<float,2>{0.791776061f, 0.923564494f},
-std::array<float,2>{0.382314622f, 0.177912086f},
-std::array<float,2>{0.684072077f, 0.225421414f},
-std::array<float,2>{0.237219378f, 0.953328669f},
-std::array<float,2>{0.940253258f, 0.660200834f},
-std::array<float,2>{0.33753103f, 0.346611768f},
-std::array<float,2>{0.865955293f, 0.42091006f},
-std::array<float,2>{0.479796857f, 0.517396092f},
-std::array<float,2>{0.543449044f, 0.844012082f},
-std::array<float,2>{0.0715055838f, 0.0386664197f},
-std::array<float,2>{0.775487304f, 0.146478847f},
-std::array<float,2>{0.422420561f, 0.884090543f},
-std::array<float,2>{0.57380271f, 0.701796532f},
-std::array<float,2>{0.0604014397f, 0.282702893f},
-std::array<float,2>{0.696373463f, 0.465563744f},
-std::array<float,2>{0.17117621f, 0.604889333f},
-std::array<float,2>{0.935269654f, 0.763043761f},
-std::array<float,2>{0.30607152f, 0.0741627961f},
-std::array<float,2>{0.501471758f, 0.0126306731f},
-std::array<float,2>{0.113575585f, 0.825721323f},
-std::array<float,2>{0.834274948f, 0.551122785f},
-std::array<float,2>{0.438555121f, 0.395202547f},
-std::array<float,2>{0.972424388f, 0.342703015f},
-std::array<float,2>{0.345600605f, 0.654137969f},
-std::array<float,2>{0.631789207f, 0.969117641f},
-std::array<float,2>{0.191196084f, 0.197397634f},
-std::array<float,2>{0.817315161f, 0.121414043f},
-std::array<float,2>{0.466080576f, 0.812352717f},
-std::array<float,2>{0.515989959f, 0.574397981f},
-std::array<float,2>{0.0964999124f, 0.499850273f},
-std::array<float,2>{0.648952663f, 0.250213116f},
-std::array<float,2>{0.206813768f, 0.724932015f},
-std::array<float,2>{0.994904578f, 0.926023483f},
-std::array<float,2>{0.370868862f, 0.172679126f},
-std::array<float,2>{0.580451608f, 0.22220917f},
-std::array<float,2>{0.0369249508f, 0.957032084f},
-std::array<float,2>{0.763876617f, 0.659043789f},
-std::array<float,2>{0.416187197f, 0.351389617f},
-std::array<float,2>{0.909533262f, 0.417880565f},
-std::array<float,2>{0.283687919f, 0.520049334f},
-std::array<float,2>{0.71012485f, 0.848592818f},
-std::array<float,2>{0.173464045f, 0.0323127806f},
-std::array<float,2>{0.963730037f, 0.141789347f},
-std::array<float,2>{0.320013434f, 0.886739194f},
-std::array<float,2>{0.659748316f, 0.69799608f},
-std::array<float,2>{0.233086884f, 0.286749572f},
-std::array<float,2>{0.562422454f, 0.461372197f},
-std::array<float,2>{0.0903141126f, 0.607365191f},
-std::array<float,2>{0.853339076f, 0.761471748f},
-std::array<float,2>{0.485080928f, 0.076805599f},
-std::array<float,2>{0.721948981f, 0.00787737966f},
-std::array<float,2>{0.133675933f, 0.822250903f},
-std::array<float,2>{0.902810991f, 0.550084412f},
-std::array<float,2>{0.269854158f, 0.392479211f},
-std::array<float,2>{0.800371885f, 0.338044941f},
-std::array<float,2>{0.399132073f, 0.648851454f},
-std::array<float,2>{0.600066066f, 0.974595666f},
-std::array<float,2>{0.0146424845f, 0.199554175f},
-std::array<float,2>{0.883799255f, 0.047142297f},
-std::array<float,2>{0.256215662f, 0.859512329f},
-std::array<float,2>{0.739882946f, 0.501145959f},
-std::array<float,2>{0.14288877f, 0.430614352f},
-std::array<float,2>{0.616737247f, 0.370600313f},
-std::array<float,2>{0.0241226219f, 0.67861861f},
-std::array<float,2>{0.783970416f, 0.938005507f},
-std::array<float,2>{0.382958949f, 0.246900618f},
-std::array<float,2>{0.673508763f, 0.158832192f},
-std::array<float,2>{0.244672835f, 0.918930709f},
-std::array<float,2>{0.951290011f, 0.743008435f},
-std::array<float,2>{0.333469838f, 0.272867203f},
-std::array<float,2>{0.868622422f, 0.473721236f},
-std::array<float,2>{0.474277258f, 0.579056442f},
-std::array<float,2>{0.53674674f, 0.783968031f},
-std::array<float,2>{0.0697730407f, 0.0943367034f},
-std::array<float,2>{0.768628538f, 0.207509249f},
-std::array<float,2>{0.430697769f, 0.99448657f},
-std::array<float,2>{0.566798568f, 0.638799071f},
-std::array<float,2>{0.0542772152f, 0.319811165f},
-std::array<float,2>{0.687961042f, 0.387579501f},
-std::array<float,2>{0.161153346f, 0.5414837f},
-std::array<float,2>{0.922393441f, 0.841651022f},
-std::array<float,2>{0.299166352f, 0.0236791596f},
-std::array<float,2>{0.509451151f, 0.086216867f},
-std::array<float,2>{0.122213699f, 0.778386712f},
-std::array<float,2>{0.837593555f, 0.622274399f},
-std::array<float,2>{0.447710067f, 0.440437943f},
-std::array<float,2>{0.982019722f, 0.297735482f},
-std::array<float,2>{0.358556718f, 0.703620672f},
-std::array<float,2>{0.638580501f, 0.893775761f},
-std::array<float,2>{0.19794336f, 0.129600808f},
-std::array<float,2>{0.793382585f, 0.0213408098f},
-std::array<float,2>{0.375287563f, 0.832330883f},
-std::array<float,2>{0.624318182f, 0.531721413f},
-std::array<float,2>{0.0160489436f, 0.381746233f},
-std::array<float,2>{0.745403588f, 0.322197497f},
-std::array<float,2>{0.149567738f, 0.630765319f},
-std::array<float,2>{0.875359476f, 0.984537303f},
-std::array<float,2>{0.263957113f, 0.212085217f},
-std::array<float,2>{0.541607201f, 0.139120817f},
-std::array<float,2>{0.0766958296f, 0.902211308f},
-std::array<float,2>{0.860708475f, 0.71747613f},
-std::array<float,2>{0.483154148f, 0.312447041f},
-std::array<float,2>{0.942499936f, 0.452422321f},
-std::array<float,2>{0.343652695f, 0.611914575f},
-std::array<float,2>{0.682647228f, 0.771642864f},
-std::array<float,2>{0.239879325f, 0.0836840868f},
-std::array<float,2>{0.931304395f, 0.240003139f},
-std::array<float,2>{0.311385661f, 0.951718092f},
-std::array<float,2>{0.700340271f, 0.679764867f},
-std::array<float,2>{0.165312931f, 0.362465769f},
-std::array<float,2>{0.576883793f, 0.427708805f},
-std::array<float,2>{0.0562428869f, 0.507976592f},
-std::array<float,2>{0.781024456f, 0.870945692f},
-std::array<float,2>{0.426807582f, 0.0567023382f},
-std::array<float,2>{0.627125621f, 0.108291686f},
-std::array<float,2>{0.195187211f, 0.796016276f},
-std::array<float,2>{0.974808335f, 0.586308181f},
-std::array<float,2>{0.347988665f, 0.478544325f},
-std::array<float,2>{0.828579664f, 0.274892479f},
-std::array<float,2>{0.444256991f, 0.741664946f},
-std::array<float,2>{0.507549286f, 0.913030744f},
-std::array<float,2>{0.110198043f, 0.171316385f},
-std::array<float,2>{0.985817254f, 0.06548094f},
-std::array<float,2>{0.359863758f, 0.754346013f},
-std::array<float,2>{0.646519065f, 0.595070839f},
-std::array<float,2>{0.211253539f, 0.459568739f},
-std::array<float,2>{0.526188493f, 0.29136008f},
-std::array<float,2>{0.102422193f, 0.690361917f},
-std::array<float,2>{0.825636566f, 0.877815664f},
-std::array<float,2>{0.454463303f, 0.153283656f},
-std::array<float,2>{0.712830126f, 0.188357025f},
-std::array<float,2>{0.186403722f, 0.978902817f},
-std::array<float,2>{0.92036432f, 0.648114502f},
-std::array<float,2>{0.292759895f, 0.332853436f},
-std::array<float,2>{0.757592142f, 0.40243727f},
-std::array<float,2>{0.40974018f, 0.557579935f},
-std::array<float,2>{0.588907421f, 0.817891657f},
-std::array<float,2>{0.0411633253f, 0.00287408638f},
-std::array<float,2>{0.845336318f, 0.181324139f},
-std::array<float,2>{0.49746418f, 0.932835996f},
-std::array<float,2>{0.551254392f, 0.728574038f},
-std::array<float,2>{0.0821385086f, 0.258476317f},
-std::array<float,2>{0.665188789f, 0.491627932f},
-std::array<float,2>{0.221682712f, 0.562865019f},
-std::array<float,2>{0.960741162f, 0.798943281f},
-std::array<float,2>{0.32812193f, 0.116606951f},
-std::array<float,2>{0.609143615f, 0.0418585911f},
-std::array<float,2>{0.00673163403f, 0.851638794f},
-std::array<float,2>{0.809969962f, 0.526902199f},
-std::array<float,2>{0.391066462f, 0.406766802f},
-std::array<float,2>{0.893549502f, 0.352800101f},
-std::array<float,2>{0.280472249f, 0.670992494f},
-std::array<float,2>{0.731752634f, 0.961549401f},
-std::array<float,2>{0.127991065f, 0.233190536f},
-std::array<float,2>{0.760083973f, 0.0798908174f},
-std::array<float,2>{0.419209331f, 0.768359303f},
-std::array<float,2>{0.582426131f, 0.613635123f},
-std::array<float,2>{0.0313935019f, 0.446058124f},
-std::array<float,2>{0.705688059f, 0.307427168f},
-std::array<float,2>{0.17697303f, 0.711609006f},
-std::array<float,2>{0.911765754f, 0.905768156f},
-std::array<float,2>{0.288114041f, 0.136196211f},
-std::array<float,2>{0.520276964f, 0.217516467f},
-std::array<float,2>{0.10154628f, 0.989420474f},
-std::array<float,2>{0.812790215f, 0.628609657f},
-std::array<float,2>{0.462680966f, 0.32518962f},
-std::array<float,2>{0.998461902f, 0.378014386f},
-std::array<float,2>{0.371386588f, 0.538497448f},
-std::array<float,2>{0.653575659f, 0.828682899f},
-std::array<float,2>{0.208611101f, 0.0187488683f},
-std::array<float,2>{0.900688589f, 0.165545166f},
-std::array<float,2>{0.26889959f, 0.909415066f},
-std::array<float,2>{0.725743115f, 0.73515594f},
-std::array<float,2>{0.13821739f, 0.278282195f},
-std::array<float,2>{0.596894145f, 0.483708084f},
-std::array<float,2>{0.00818918645f, 0.59181428f},
-std::array<float,2>{0.803630888f, 0.790843427f},
-std::array<float,2>{0.402771324f, 0.104810044f},
-std::array<float,2>{0.661883354f, 0.0592388287f},
-std::array<float,2>{0.228263125f, 0.873348236f},
-std::array<float,2>{0.966351688f, 0.514026046f},
-std::array<float,2>{0.314252228f, 0.424000949f},
-std::array<float,2>{0.858551145f, 0.363628745f},
-std::array<float,2>{0.489410996f, 0.68476814f},
-std::array<float,2>{0.555236459f, 0.946242213f},
-std::array<float,2>{0.087840423f, 0.236219794f},
-std::array<float,2>{0.946688235f, 0.00757021736f},
-std::array<float,2>{0.330757856f, 0.812586308f},
-std::array<float,2>{0.677698016f, 0.560702443f},
-std::array<float,2>{0.249892697f, 0.40082401f},
-std::array<float,2>{0.53453058f, 0.330969602f},
-std::array<float,2>{0.0657812282f, 0.643822789f},
-std::array<float,2>{0.874512851f, 0.981549442f},
-std::array<float,2>{0.470301926f, 0.193068057f},
-std::array<float,2>{0.737234533f, 0.151101336f},
-std::array<float,2>{0.146273896f, 0.880121052f},
-std::array<float,2>{0.890522718f, 0.693825305f},
-std::array<float,2>{0.252163231f, 0.296110004f},
-std::array<float,2>{0.789043486f, 0.455002546f},
-std::array<float,2>{0.386790365f, 0.597688496f},
-std::array<float,2>{0.612882316f, 0.753103435f},
-std::array<float,2>{0.0295271408f, 0.0675445199f},
-std::array<float,2>{0.840658367f, 0.228333727f},
-std::array<float,2>{0.452450544f, 0.968316853f},
-std::array<float,2>{0.513417184f, 0.66473484f},
-std::array<float,2>{0.118727528f, 0.359268993f},
-std::array<float,2>{0.636402071f, 0.412342519f},
-std::array<float,2>{0.202481076f, 0.52820766f},
-std::array<float,2>{0.979371369f, 0.859165549f},
-std::array<float,2>{0.353831589f, 0.0467431173f},
-std::array<float,2>{0.564265609f, 0.113240622f},
-std::array<float,2>{0.0487328842f, 0.80220443f},
-std::array<float,2>{0.773194492f, 0.568857074f},
-std::array<float,2>{0.437035203f, 0.487377852f},
-std::array<float,2>{0.928861141f, 0.265365958f},
-std::array<float,2>{0.301524371f, 0.734092534f},
-std::array<float,2>{0.694247663f, 0.934614658f},
-std::array<float,2>{0.157538086f, 0.18362163f},
-std::array<float,2>{0.864094019f, 0.0378258415f},
-std::array<float,2>{0.478253096f, 0.845284164f},
-std::array<float,2>{0.546609282f, 0.516139567f},
-std::array<float,2>{0.0738452598f, 0.420153022f},
-std::array<float,2>{0.687222004f, 0.346708715f},
-std::array<float,2>{0.234957173f, 0.661971748f},
-std::array<float,2>{0.938912988f, 0.955011308f},
-std::array<float,2>{0.338593513f, 0.226528555f},
-std::array<float,2>{0.619652987f, 0.178792477f},
-std::array<float,2>{0.0227691904f, 0.922725856f},
-std::array<float,2>{0.789226651f, 0.720672607f},
-std::array<float,2>{0.37932837f, 0.25557217f},
-std::array<float,2>{0.881892622f, 0.494380593f},
-std::array<float,2>{0.260591894f, 0.571474612f},
-std::array<float,2>{0.74916023f, 0.806159139f},
-std::array<float,2>{0.15362446f, 0.119622044f},
-std::array<float,2>{0.970666349f, 0.198471084f},
-std::array<float,2>{0.346594661f, 0.970503569f},
-std::array<float,2>{0.630536735f, 0.652733266f},
-std::array<float,2>{0.18944636f, 0.34285152f},
-std::array<float,2>{0.5020625f, 0.396110862f},
-std::array<float,2>{0.115465477f, 0.55198133f},
-std::array<float,2>{0.833542407f, 0.824493766f},
-std::array<float,2>{0.440256417f, 0.0134674311f},
-std::array<float,2>{0.698900878f, 0.0724518597f},
-std::array<float,2>{0.169503435f, 0.762075901f},
-std::array<float,2>{0.935687482f, 0.603779972f},
-std::array<float,2>{0.307599276f, 0.466482133f},
-std::array<float,2>{0.773815513f, 0.281442821f},
-std::array<float,2>{0.424330413f, 0.702603519f},
-std::array<float,2>{0.57182759f, 0.883249283f},
-std::array<float,2>{0.0607286319f, 0.144621998f},
-std::array<float,2>{0.91436106f, 0.100532092f},
-std::array<float,2>{0.295188159f, 0.786270916f},
-std::array<float,2>{0.718011796f, 0.585528791f},
-std::array<float,2>{0.182025492f, 0.469617844f},
-std::array<float,2>{0.592694402f, 0.269116253f},
-std::array<float,2>{0.0441300534f, 0.747220933f},
-std::array<float,2>{0.753111124f, 0.914150417f},
-std::array<float,2>{0.412340581f, 0.162640423f},
-std::array<float,2>{0.644317329f, 0.242683679f},
-std::array<float,2>{0.215299293f, 0.942446291f},
-std::array<float,2>{0.990716279f, 0.672348082f},
-std::array<float,2>{0.36462301f, 0.374770105f},
-std::array<float,2>{0.821750343f, 0.434402704f},
-std::array<float,2>{0.457053423f, 0.504487574f},
-std::array<float,2>{0.530370474f, 0.865917921f},
-std::array<float,2>{0.107544266f, 0.0520381741f},
-std::array<float,2>{0.805239975f, 0.125292733f},
-std::array<float,2>{0.394542694f, 0.895926297f},
-std::array<float,2>{0.60315454f, 0.710469067f},
-std::array<float,2>{0.00114041276f, 0.30407846f},
-std::array<float,2>{0.72675699f, 0.442841172f},
-std::array<float,2>{0.131816909f, 0.618475318f},
-std::array<float,2>{0.898076177f, 0.776372671f},
-std::array<float,2>{0.276264012f, 0.0936453789f},
-std::array<float,2>{0.550363779f, 0.0275197923f},
-std::array<float,2>{0.0806571841f, 0.836251438f},
-std::array<float,2>{0.851046324f, 0.543729424f},
-std::array<float,2>{0.49240911f, 0.386229306f},
-std::array<float,2>{0.955411673f, 0.316064119f},
-std::array<float,2>{0.32098636f, 0.632870734f},
-std::array<float,2>{0.670797467f, 0.997612059f},
-std::array<float,2>{0.225441381f, 0.203306377f},
-std::array<float,2>{0.854205072f, 0.0752196535f},
-std::array<float,2>{0.48714757f, 0.758802295f},
-std::array<float,2>{0.559195518f, 0.608939946f},
-std::array<float,2>{0.0925544053f, 0.463398784f},
-std::array<float,2>{0.658095896f, 0.287224531f},
-std::array<float,2>{0.232218936f, 0.696356773f},
-std::array<float,2>{0.961047649f, 0.88966912f},
-std::array<float,2>{0.316602975f, 0.143657029f},
-std::array<float,2>{0.599151969f, 0.202571377f},
-std::array<float,2>{0.0131690353f, 0.975227177f},
-std::array<float,2>{0.797764659f, 0.650925279f},
-std::array<float,2>{0.400489569f, 0.337865919f},
-std::array<float,2>{0.904842556f, 0.392790407f},
-std::array<float,2>{0.272221208f, 0.547487795f},
-std::array<float,2>{0.719043553f, 0.822681427f},
-std::array<float,2>{0.135068819f, 0.00983230304f},
-std::array<float,2>{0.993920624f, 0.17506136f},
-std::array<float,2>{0.367398411f, 0.929126561f},
-std::array<float,2>{0.650921881f, 0.723766267f},
-std::array<float,2>{0.203924984f, 0.253040195f},
-std::array<float,2>{0.517976046f, 0.496664584f},
-std::array<float,2>{0.0956071466f, 0.576917708f},
-std::array<float,2>{0.818869829f, 0.810148954f},
-std::array<float,2>{0.466846734f, 0.124424197f},
-std::array<float,2>{0.708289325f, 0.0342623033f},
-std::array<float,2>{0.175740391f, 0.850321233f},
-std::array<float,2>{0.906390071f, 0.523335278f},
-std::array<float,2>{0.282405555f, 0.415793777f},
-std::array<float,2>{0.762944996f, 0.348647118f},
-std::array<float,2>{0.415848911f, 0.657683969f},
-std::array<float,2>{0.578531921f, 0.959805012f},
-std::array<float,2>{0.0377284773f, 0.219190076f},
-std::array<float,2>{0.92506969f, 0.0260827839f},
-std::array<float,2>{0.298450768f, 0.8432886f},
-std::array<float,2>{0.689763844f, 0.540473938f},
-std::array<float,2>{0.163521513f, 0.388792843f},
-std::array<float,2>{0.570151746f, 0.317684054f},
-std::array<float,2>{0.0518417172f, 0.638573885f},
-std::array<float,2>{0.766137362f, 0.993901312f},
-std::array<float,2>{0.433139741f, 0.209412575f},
-std::array<float,2>{0.64035356f, 0.130926862f},
-std::array<float,2>{0.195869431f, 0.891716421f},
-std::array<float,2>{0.983046055f, 0.706280529f},
-std::array<float,2>{0.355886966f, 0.299485207f},
-std::array<float,2>{0.838254392f, 0.437729686f},
-std::array<float,2>{0.446564764f, 0.624653637f},
-std::array<float,2>{0.509773314f, 0.780210197f},
-std::array<float,2>{0.123591401f, 0.0894259363f},
-std::array<float,2>{0.782180011f, 0.248353183f},
-std::array<float,2>{0.386718214f, 0.940494001f},
-std::array<float,2>{0.614032269f, 0.677548409f},
-std::array<float,2>{0.02562798f, 0.369038016f},
-std::array<float,2>{0.741015792f, 0.433240145f},
-std::array<float,2>{0.141647801f, 0.502580225f},
-std::array<float,2>{0.885159969f, 0.862049341f},
-std::array<float,2>{0.254530549f, 0.0491802618f},
-std::array<float,2>{0.537460506f, 0.0964182913f},
-std::array<float,2>{0.0676068366f, 0.781726897f},
-std::array<float,2>{0.870350063f, 0.58081311f},
-std::array<float,2>{0.476522446f, 0.474926621f},
-std::array<float,2>{0.9501881f, 0.27136606f},
-std::array<float,2>{0.334406018f, 0.746046543f},
-std::array<float,2>{0.674643219f, 0.919992208f},
-std::array<float,2>{0.242471844f, 0.157004133f},
-std::array<float,2>{0.778305352f, 0.0556366704f},
-std::array<float,2>{0.428504676f, 0.867546976f},
-std::array<float,2>{0.574373841f, 0.511137605f},
-std::array<float,2>{0.0567613058f, 0.428228915f},
-std::array<float,2>{0.702667534f, 0.360982776f},
-std::array<float,2>{0.167784944f, 0.683395863f},
-std::array<float,2>{0.932601511f, 0.950772822f},
-std::array<float,2>{0.30913955f, 0.240888253f},
-std::array<float,2>{0.505355895f, 0.167990491f},
-std::array<float,2>{0.111636676f, 0.910198629f},
-std::array<float,2>{0.830287755f, 0.738859177f},
-std::array<float,2>{0.442899942f, 0.275421441f},
-std::array<float,2>{0.973932862f, 0.477034718f},
-std::array<float,2>{0.350399375f, 0.589049339f},
-std::array<float,2>{0.625137866f, 0.793658555f},
-std::array<float,2>{0.192448303f, 0.106462084f},
-std::array<float,2>{0.877087533f, 0.214460745f},
-std::array<float,2>{0.26233837f, 0.987627447f},
-std::array<float,2>{0.743594527f, 0.631530404f},
-std::array<float,2>{0.152325362f, 0.322830588f},
-std::array<float,2>{0.622462809f, 0.380055428f},
-std::array<float,2>{0.0179067738f, 0.535047472f},
-std::array<float,2>{0.795955896f, 0.834415495f},
-std::array<float,2>{0.377111405f, 0.0227448009f},
-std::array<float,2>{0.681287766f, 0.0840840563f},
-std::array<float,2>{0.240486577f, 0.77105701f},
-std::array<float,2>{0.943574607f, 0.61019659f},
-std::array<float,2>{0.34100309f, 0.449262828f},
-std::array<float,2>{0.862296402f, 0.310164422f},
-std::array<float,2>{0.481784195f, 0.716444969f},
-std::array<float,2>{0.539862573f, 0.899829745f},
-std::array<float,2>{0.0759872645f, 0.137029573f},
-std::array<float,2>{0.95857513f, 0.113409996f},
-std::array<float,2>{0.325432748f, 0.797686994f},
-std::array<float,2>{0.667892218f, 0.565923512f},
-std::array<float,2>{0.220504746f, 0.488346308f},
-std::array<float,2>{0.553903222f, 0.261377931f},
-std::array<float,2>{0.0857065991f, 0.728072047f},
-std::array<float,2>{0.846411526f, 0.930434465f},
-std::array<float,2>{0.499789625f, 0.183108062f},
-std::array<float,2>{0.733419776f, 0.231189862f},
-std::array<float,2>{0.125390202f, 0.962987661f},
-std::array<float,2>{0.892106473f, 0.669372976f},
-std::array<float,2>{0.279219419f, 0.355179906f},
-std::array<float,2>{0.811283052f, 0.409199506f},
-std::array<float,2>{0.393876076f, 0.524761796f},
-std::array<float,2>{0.605578244f, 0.854978383f},
-std::array<float,2>{0.00395371066f, 0.0409621261f},
-std::array<float,2>{0.827911377f, 0.154763892f},
-std::array<float,2>{0.456769437f, 0.876381338f},
-std::array<float,2>{0.524120688f, 0.689436078f},
-std::array<float,2>{0.105257995f, 0.289140314f},
-std::array<float,2>{0.645245194f, 0.457647145f},
-std::array<float,2>{0.212963969f, 0.597350836f},
-std::array<float,2>{0.987073183f, 0.756139755f},
-std::array<float,2>{0.362673134f, 0.0626107901f},
-std::array<float,2>{0.586951017f, 0.00146916031f},
-std::array<float,2>{0.0391475894f, 0.819264233f},
-std::array<float,2>{0.755748391f, 0.556078315f},
-std::array<float,2>{0.406853467f, 0.405322969f},
-std::array<float,2>{0.919207335f, 0.334782392f},
-std::array<float,2>{0.290888876f, 0.644764245f},
-std::array<float,2>{0.714120567f, 0.977252364f},
-std::array<float,2>{0.185062662f, 0.190870076f},
-std::array<float,2>{0.801027179f, 0.103136599f},
-std::array<float,2>{0.405581981f, 0.791271508f},
-std::array<float,2>{0.594239533f, 0.590547502f},
-std::array<float,2>{0.0105274813f, 0.481534839f},
-std::array<float,2>{0.72304666f, 0.281145245f},
-std::array<float,2>{0.140222192f, 0.736888885f},
-std::array<float,2>{0.90009284f, 0.907147408f},
-std::array<float,2>{0.26636079f, 0.167664021f},
-std::array<float,2>{0.557434916f, 0.237410054f},
-std::array<float,2>{0.0892821178f, 0.947310925f},
-std::array<float,2>{0.855711222f, 0.686426342f},
-std::array<float,2>{0.490666449f, 0.366772354f},
-std::array<float,2>{0.967089832f, 0.423511833f},
-std::array<float,2>{0.314502358f, 0.513520539f},
-std::array<float,2>{0.663011968f, 0.871147692f},
-std::array<float,2>{0.229126483f, 0.061165832f},
-std::array<float,2>{0.913934469f, 0.133481011f},
-std::array<float,2>{0.285628408f, 0.902656674f},
-std::array<float,2>{0.703380525f, 0.714680791f},
-std::array<float,2>{0.178536952f, 0.305837393f},
-std::array<float,2>{0.58507514f, 0.447566718f},
-std::array<float,2>{0.0348395184f, 0.616730154f},
-std::array<float,2>{0.758955181f, 0.766843557f},
-std::array<float,2>{0.421286762f, 0.0813976601f},
-std::array<float,2>{0.655543923f, 0.0163558666f},
-std::array<float,2>{0.210433647f, 0.830866456f},
-std::array<float,2>{0.997010231f, 0.536854506f},
-std::array<float,2>{0.374550521f, 0.37517187f},
-std::array<float,2>{0.81580013f, 0.326759338f},
-std::array<float,2>{0.464324266f, 0.626841605f},
-std::array<float,2>{0.521795392f, 0.991674066f},
-std::array<float,2>{0.0986207649f, 0.216535687f},
-std::array<float,2>{0.977557003f, 0.0432904847f},
-std::array<float,2>{0.351619869f, 0.857407749f},
-std::array<float,2>{0.633494377f, 0.530993879f},
-std::array<float,2>{0.200646475f, 0.411253065f},
-std::array<float,2>{0.513874829f, 0.356957823f},
-std::array<float,2>{0.120983787f, 0.66722405f},
-std::array<float,2>{0.841908872f, 0.965245485f},
-std::array<float,2>{0.45061332f, 0.229594275f},
-std::array<float,2>{0.693013787f, 0.186368749f},
-std::array<float,2>{0.159531176f, 0.93599695f},
-std::array<float,2>{0.926867425f, 0.730912387f},
-std::array<float,2>{0.303177148f, 0.261976749f},
-std::array<float,2>{0.770997286f, 0.484790295f},
-std::array<float,2>{0.434244812f, 0.568313301f},
-std::array<float,2>{0.566381395f, 0.804029226f},
-std::array<float,2>{0.0488796197f, 0.110086754f},
-std::array<float,2>{0.872009635f, 0.193541214f},
-std::array<float,2>{0.47253567f, 0.984179556f},
-std::array<float,2>{0.532527387f, 0.642027795f},
-std::array<float,2>{0.06322404f, 0.329397649f},
-std::array<float,2>{0.679191113f, 0.39851439f},
-std::array<float,2>{0.246876657f, 0.559850574f},
-std::array<float,2>{0.948460162f, 0.816219032f},
-std::array<float,2>{0.328927636f, 0.00432537729f},
-std::array<float,2>{0.610287547f, 0.0693376213f},
-std::array<float,2>{0.0284608975f, 0.75156194f},
-std::array<float,2>{0.785423279f, 0.601191461f},
-std::array<float,2>{0.389389455f, 0.456922144f},
-std::array<float,2>{0.886863112f, 0.29404965f},
-std::array<float,2>{0.251212746f, 0.693030894f},
-std::array<float,2>{0.735183001f, 0.882033527f},
-std::array<float,2>{0.147567004f, 0.149703249f},
-std::array<float,2>{0.835859358f, 0.0146610141f},
-std::array<float,2>{0.438186914f, 0.826896369f},
-std::array<float,2>{0.500948012f, 0.554271519f},
-std::array<float,2>{0.114510864f, 0.397243798f},
-std::array<float,2>{0.632171571f, 0.340797693f},
-std::array<float,2>{0.190045923f, 0.655809581f},
-std::array<float,2>{0.971013725f, 0.971619904f},
-std::array<float,2>{0.344574332f, 0.196066305f},
-std::array<float,2>{0.572466612f, 0.146769226f},
-std::array<float,2>{0.0592386201f, 0.886430085f},
-std::array<float,2>{0.776495337f, 0.700908422f},
-std::array<float,2>{0.422970921f, 0.284998655f},
-std::array<float,2>{0.933682978f, 0.467833787f},
-std::array<float,2>{0.305370718f, 0.603488803f},
-std::array<float,2>{0.695468903f, 0.76406312f},
-std::array<float,2>{0.170089975f, 0.0712481737f},
-std::array<float,2>{0.94092679f, 0.222869366f},
-std::array<float,2>{0.336296409f, 0.955559134f},
-std::array<float,2>{0.685197711f, 0.663184822f},
-std::array<float,2>{0.237956747f, 0.343839139f},
-std::array<float,2>{0.544898748f, 0.418780267f},
-std::array<float,2>{0.0704298019f, 0.518632352f},
-std::array<float,2>{0.866393089f, 0.847055078f},
-std::array<float,2>{0.479052156f, 0.0362128764f},
-std::array<float,2>{0.747487009f, 0.117270648f},
-std::array<float,2>{0.154863626f, 0.80740279f},
-std::array<float,2>{0.879151046f, 0.573247194f},
-std::array<float,2>{0.25807476f, 0.492792219f},
-std::array<float,2>{0.792056739f, 0.256602496f},
-std::array<float,2>{0.381356031f, 0.722471833f},
-std::array<float,2>{0.617406905f, 0.924950182f},
-std::array<float,2>{0.0202865843f, 0.177693471f},
-std::array<float,2>{0.894703686f, 0.08987239f},
-std::array<float,2>{0.274038553f, 0.773911297f},
-std::array<float,2>{0.730250478f, 0.619381666f},
-std::array<float,2>{0.129286319f, 0.444629878f},
-std::array<float,2>{0.605244994f, 0.301899731f},
-std::array<float,2>{0.00276866951f, 0.707354665f},
-std::array<float,2>{0.808121026f, 0.897067785f},
-std::array<float,2>{0.397214532f, 0.128270671f},
-std::array<float,2>{0.668642461f, 0.205344543f},
-std::array<float,2>{0.223059028f, 0.999109924f},
-std::array<float,2>{0.953131735f, 0.636543989f},
-std::array<float,2>{0.323724896f, 0.312530488f},
-std::array<float,2>{0.849031031f, 0.38359794f},
-std::array<float,2>{0.494678885f, 0.545255721f},
-std::array<float,2>{0.547605038f, 0.838060021f},
-std::array<float,2>{0.0790394619f, 0.0303963516f},
-std::array<float,2>{0.751076519f, 0.162003234f},
-std::array<float,2>{0.410305351f, 0.916471541f},
-std::array<float,2>{0.59077698f, 0.749569595f},
-std::array<float,2>{0.0455593802f, 0.26708284f},
-std::array<float,2>{0.715255857f, 0.470941424f},
-std::array<float,2>{0.180713102f, 0.582833529f},
-std::array<float,2>{0.917232335f, 0.787462294f},
-std::array<float,2>{0.294290215f, 0.0985463411f},
-std::array<float,2>{0.527830601f, 0.0535496213f},
-std::array<float,2>{0.105470628f, 0.863403499f},
-std::array<float,2>{0.823817372f, 0.506569624f},
-std::array<float,2>{0.460041851f, 0.437035501f},
-std::array<float,2>{0.989363253f, 0.372339517f},
-std::array<float,2>{0.366585732f, 0.675732791f},
-std::array<float,2>{0.642127335f, 0.943538904f},
-std::array<float,2>{0.217397749f, 0.245742455f},
-std::array<float,2>{0.826102495f, 0.0632264242f},
-std::array<float,2>{0.454797029f, 0.756678939f},
-std::array<float,2>{0.525496781f, 0.596891284f},
-std::array<float,2>{0.101879917f, 0.457388729f},
-std::array<float,2>{0.647365808f, 0.289718002f},
-std::array<float,2>{0.211502671f, 0.688828409f},
-std::array<float,2>{0.986199915f, 0.876758218f},
-std::array<float,2>{0.359421402f, 0.155145988f},
-std::array<float,2>{0.589610457f, 0.191119075f},
-std::array<float,2>{0.0419309624f, 0.976946294f},
-std::array<float,2>{0.757114708f, 0.645489037f},
-std::array<float,2>{0.409662992f, 0.33406654f},
-std::array<float,2>{0.920744061f, 0.40593186f},
-std::array<float,2>{0.292409062f, 0.55618906f},
-std::array<float,2>{0.712271154f, 0.818828106f},
-std::array<float,2>{0.185887873f, 0.00139542366f},
-std::array<float,2>{0.960181952f, 0.182899818f},
-std::array<float,2>{0.327630907f, 0.929711521f},
-std::array<float,2>{0.665614784f, 0.727544963f},
-std::array<float,2>{0.222211465f, 0.260949403f},
-std::array<float,2>{0.551580131f, 0.489204466f},
-std::array<float,2>{0.0825267658f, 0.56550777f},
-std::array<float,2>{0.844970524f, 0.797215462f},
-std::array<float,2>{0.497664779f, 0.113955259f},
-std::array<float,2>{0.732251644f, 0.0405089594f},
-std::array<float,2>{0.128750205f, 0.855043113f},
-std::array<float,2>{0.892906427f, 0.524957418f},
-std::array<float,2>{0.281174153f, 0.409796536f},
-std::array<float,2>{0.810196459f, 0.354923993f},
-std::array<float,2>{0.391404122f, 0.669882417f},
-std::array<float,2>{0.608611643f, 0.963784158f},
-std::array<float,2>{0.00621650834f, 0.230547503f},
-std::array<float,2>{0.875494242f, 0.0229783542f},
-std::array<float,2>{0.264595658f, 0.834738195f},
-std::array<float,2>{0.745994866f, 0.534445643f},
-std::array<float,2>{0.149955943f, 0.38043648f},
-std::array<float,2>{0.624575615f, 0.32269305f},
-std::array<float,2>{0.016333729f, 0.630909026f},
-std::array<float,2>{0.793558002f, 0.988111317f},
-std::array<float,2>{0.375492275f, 0.214171484f},
-std::array<float,2>{0.683572829f, 0.137644604f},
-std::array<float,2>{0.239736602f, 0.90025878f},
-std::array<float,2>{0.943234384f, 0.716246486f},
-std::array<float,2>{0.34310475f, 0.309995294f},
-std::array<float,2>{0.861246526f, 0.450013727f},
-std::array<float,2>{0.48260659f, 0.609471738f},
-std::array<float,2>{0.541411638f, 0.770782053f},
-std::array<float,2>{0.076559186f, 0.0845462456f},
-std::array<float,2>{0.780745745f, 0.240301728f},
-std::array<float,2>{0.427416027f, 0.950589061f},
-std::array<float,2>{0.576372027f, 0.683073819f},
-std::array<float,2>{0.055945538f, 0.360515326f},
-std::array<float,2>{0.701050043f, 0.427925467f},
-std::array<float,2>{0.165871695f, 0.511293054f},
-std::array<float,2>{0.930679321f, 0.867875338f},
-std::array<float,2>{0.310620815f, 0.0550109893f},
-std::array<float,2>{0.506996274f, 0.107359789f},
-std::array<float,2>{0.109833814f, 0.793422639f},
-std::array<float,2>{0.828851223f, 0.589834988f},
-std::array<float,2>{0.443614513f, 0.477437049f},
-std::array<float,2>{0.975278914f, 0.276303768f},
-std::array<float,2>{0.348299712f, 0.738410532f},
-std::array<float,2>{0.627708733f, 0.910812855f},
-std::array<float,2>{0.194461048f, 0.168881997f},
-std::array<float,2>{0.78333807f, 0.0495537296f},
-std::array<float,2>{0.383443326f, 0.86139214f},
-std::array<float,2>{0.616596282f, 0.502156734f},
-std::array<float,2>{0.023513522f, 0.432701677f},
-std::array<float,2>{0.739563465f, 0.368464887f},
-std::array<float,2>{0.143181622f, 0.67698878f},
-std::array<float,2>{0.884462714f, 0.941401839f},
-std::array<float,2>{0.256420046f, 0.248624578f},
-std::array<float,2>{0.536454797f, 0.156542987f},
-std::array<float,2>{0.0702632517f, 0.920737207f},
-std::array<float,2>{0.868817389f, 0.745481193f},
-std::array<float,2>{0.474027663f, 0.270805478f},
-std::array<float,2>{0.951990724f, 0.475465149f},
-std::array<float,2>{0.333669931f, 0.5803352f},
-std::array<float,2>{0.673202634f, 0.781871676f},
-std::array<float,2>{0.244434178f, 0.0959350541f},
-std::array<float,2>{0.922216654f, 0.209712178f},
-std::array<float,2>{0.299716234f, 0.993238926f},
-std::array<float,2>{0.688420475f, 0.63817507f},
-std::array<float,2>{0.161779672f, 0.317987412f},
-std::array<float,2>{0.567018569f, 0.389321238f},
-std::array<float,2>{0.0541462265f, 0.540821135f},
-std::array<float,2>{0.769119024f, 0.842972219f},
-std::array<float,2>{0.431523919f, 0.0255938172f},
-std::array<float,2>{0.637884319f, 0.0891903937f},
-std::array<float,2>{0.197539657f, 0.779556513f},
-std::array<float,2>{0.981885135f, 0.624116898f},
-std::array<float,2>{0.35933131f, 0.438020319f},
-std::array<float,2>{0.837267339f, 0.299305141f},
-std::array<float,2>{0.447919607f, 0.706969619f},
-std::array<float,2>{0.509164333f, 0.892098367f},
-std::array<float,2>{0.122795589f, 0.131660342f},
-std::array<float,2>{0.994186282f, 0.124673434f},
-std::array<float,2>{0.370492339f, 0.809790969f},
-std::array<float,2>{0.648804784f, 0.576222241f},
-std::array<float,2>{0.206488043f, 0.496517569f},
-std::array<float,2>{0.516517937f, 0.253517181f},
-std::array<float,2>{0.096037738f, 0.72440958f},
-std::array<float,2>{0.816751659f, 0.929444432f},
-std::array<float,2>{0.466510803f, 0.175478846f},
-std::array<float,2>{0.71092391f, 0.219397828f},
-std::array<float,2>{0.173259869f, 0.959248364f},
-std::array<float,2>{0.909913778f, 0.657890379f},
-std::array<float,2>{0.284009039f, 0.349562496f},
-std::array<float,2>{0.764541745f, 0.415433347f},
-std::array<float,2>{0.41650942f, 0.522543252f},
-std::array<float,2>{0.580904007f, 0.849678636f},
-std::array<float,2>{0.0362378769f, 0.0350514203f},
-std::array<float,2>{0.852727115f, 0.144059137f},
-std::array<float,2>{0.484574109f, 0.890431643f},
-std::array<float,2>{0.561809719f, 0.697210193f},
-std::array<float,2>{0.0906323567f, 0.287803203f},
-std::array<float,2>{0.65936774f, 0.462934762f},
-std::array<float,2>{0.232873738f, 0.608475268f},
-std::array<float,2>{0.963115335f, 0.759323359f},
-std::array<float,2>{0.319552034f, 0.0757311136f},
-std::array<float,2>{0.600427568f, 0.0106364386f},
-std::array<float,2>{0.0138786696f, 0.823140562f},
-std::array<float,2>{0.800139427f, 0.547051549f},
-std::array<float,2>{0.398727715f, 0.393328339f},
-std::array<float,2>{0.902836859f, 0.337055117f},
-std::array<float,2>{0.270232558f, 0.650691867f},
-std::array<float,2>{0.722360909f, 0.975039303f},
-std::array<float,2>{0.133278996f, 0.202703893f},
-std::array<float,2>{0.753502905f, 0.0979572535f},
-std::array<float,2>{0.412681848f, 0.787830412f},
-std::array<float,2>{0.591948092f, 0.582492292f},
-std::array<float,2>{0.044749666f, 0.471417397f},
-std::array<float,2>{0.718672276f, 0.267313093f},
-std::array<float,2>{0.182412848f, 0.749454498f},
-std::array<float,2>{0.914811909f, 0.916568995f},
-std::array<float,2>{0.295720786f, 0.161240011f},
-std::array<float,2>{0.531124473f, 0.245526642f},
-std::array<float,2>{0.108086072f, 0.944040179f},
-std::array<float,2>{0.821937978f, 0.674845934f},
-std::array<float,2>{0.457671374f, 0.372790307f},
-std::array<float,2>{0.991028488f, 0.436998218f},
-std::array<float,2>{0.364958018f, 0.505916059f},
-std::array<float,2>{0.64371568f, 0.86402905f},
-std::array<float,2>{0.215492725f, 0.052755788f},
-std::array<float,2>{0.897598445f, 0.12847437f},
-std::array<float,2>{0.275575578f, 0.896959007f},
-std::array<float,2>{0.727109015f, 0.707875848f},
-std::array<float,2>{0.131208181f, 0.302294254f},
-std::array<float,2>{0.602733016f, 0.445035905f},
-std::array<float,2>{0.00173635024f, 0.619642735f},
-std::array<float,2>{0.804800689f, 0.774336934f},
-std::array<float,2>{0.395503074f, 0.0904081464f},
-std::array<float,2>{0.669980943f, 0.0312341377f},
-std::array<float,2>{0.224691778f, 0.83873266f},
-std::array<float,2>{0.955837846f, 0.545752645f},
-std::array<float,2>{0.320337355f, 0.382977664f},
-std::array<float,2>{0.851356983f, 0.313079387f},
-std::array<float,2>{0.492876351f, 0.63618654f},
-std::array<float,2>{0.550220251f, 0.999742925f},
-std::array<float,2>{0.0801346749f, 0.205990553f},
-std::array<float,2>{0.938973904f, 0.0368018895f},
-std::array<float,2>{0.338213652f, 0.847451985f},
-std::array<float,2>{0.686840057f, 0.519138932f},
-std::array<float,2>{0.234423444f, 0.418284893f},
-std::array<float,2>{0.546121478f, 0.344281375f},
-std::array<float,2>{0.0735854954f, 0.663816392f},
-std::array<float,2>{0.863628864f, 0.955650985f},
-std::array<float,2>{0.477952391f, 0.22334975f},
-std::array<float,2>{0.749845088f, 0.17688708f},
-std::array<float,2>{0.154119283f, 0.925625086f},
-std::array<float,2>{0.882734478f, 0.721986532f},
-std::array<float,2>{0.259868681f, 0.256230205f},
-std::array<float,2>{0.789696872f, 0.492422581f},
-std::array<float,2>{0.379534185f, 0.574061096f},
-std::array<float,2>{0.619525671f, 0.806889057f},
-std::array<float,2>{0.0232120212f, 0.117936879f},
-std::array<float,2>{0.833256245f, 0.195376605f},
-std::array<float,2>{0.439719647f, 0.971070588f},
-std::array<float,2>{0.502569556f, 0.655419886f},
-std::array<float,2>{0.116180785f, 0.340116382f},
-std::array<float,2>{0.629937887f, 0.396594942f},
-std::array<float,2>{0.188557431f, 0.553880394f},
-std::array<float,2>{0.969797969f, 0.826280832f},
-std::array<float,2>{0.345905751f, 0.0154859852f},
-std::array<float,2>{0.57176733f, 0.0703309774f},
-std::array<float,2>{0.0611924082f, 0.764550984f},
-std::array<float,2>{0.774291337f, 0.602937639f},
-std::array<float,2>{0.424050093f, 0.468585968f},
-std::array<float,2>{0.936279118f, 0.284301817f},
-std::array<float,2>{0.30669567f, 0.70056814f},
-std::array<float,2>{0.698440492f, 0.885763347f},
-std::array<float,2>{0.16905649f, 0.147301793f},
-std::array<float,2>{0.874122083f, 0.00475266296f},
-std::array<float,2>{0.470037818f, 0.815908015f},
-std::array<float,2>{0.534947157f, 0.560505152f},
-std::array<float,2>{0.0663145185f, 0.399130106f},
-std::array<float,2>{0.677145064f, 0.329960108f},
-std::array<float,2>{0.249162778f, 0.642416f},
-std::array<float,2>{0.946852982f, 0.983733058f},
-std::array<float,2>{0.330338836f, 0.19409512f},
-std::array<float,2>{0.612772644f, 0.150269076f},
-std::array<float,2>{0.0300654303f, 0.882571876f},
-std::array<float,2>{0.78835994f, 0.692826033f},
-std::array<float,2>{0.387401581f, 0.294519097f},
-std::array<float,2>{0.889735043f, 0.456067801f},
-std::array<float,2>{0.252567738f, 0.600764155f},
-std::array<float,2>{0.736792147f, 0.751356542f},
-std::array<float,2>{0.145915285f, 0.0701108277f},
-std::array<float,2>{0.978657544f, 0.230034932f},
-std::array<float,2>{0.354230255f, 0.965792418f},
-std::array<float,2>{0.635755718f, 0.667570651f},
-std::array<float,2>{0.203072414f, 0.356506526f},
-std::array<float,2>{0.512979686f, 0.411954343f},
-std::array<float,2>{0.118260503f, 0.530376971f},
-std::array<float,2>{0.8401196f, 0.856631875f},
-std::array<float,2>{0.45279327f, 0.0436596833f},
-std::array<float,2>{0.693700492f, 0.109715946f},
-std::array<float,2>{0.158058092f, 0.804635525f},
-std::array<float,2>{0.929257631f, 0.567466557f},
-std::array<float,2>{0.300814062f, 0.485021591f},
-std::array<float,2>{0.772486746f, 0.262308091f},
-std::array<float,2>{0.436768293f, 0.731379867f},
-std::array<float,2>{0.563483417f, 0.936505258f},
-std::array<float,2>{0.0480117574f, 0.186013594f},
-std::array<float,2>{0.911453009f, 0.0818793774f},
-std::array<float,2>{0.288902819f, 0.767418385f},
-std::array<float,2>{0.705496371f, 0.616644263f},
-std::array<float,2>{0.177541956f, 0.447984427f},
-std::array<float,2>{0.582538724f, 0.306614488f},
-std::array<float,2>{0.0320878364f, 0.714207351f},
-std::array<float,2>{0.760593057f, 0.903005958f},
-std::array<float,2>{0.419584095f, 0.133118883f},
-std::array<float,2>{0.654053569f, 0.215826392f},
-std::array<float,2>{0.208045393f, 0.992053688f},
-std::array<float,2>{0.998566508f, 0.626312971f},
-std::array<float,2>{0.371815592f, 0.326305479f},
-std::array<float,2>{0.813474119f, 0.375513822f},
-std::array<float,2>{0.462012857f, 0.53624481f},
-std::array<float,2>{0.51993072f, 0.830501616f},
-std::array<float,2>{0.100664064f, 0.0159044042f},
-std::array<float,2>{0.803221166f, 0.167155147f},
-std::array<float,2>{0.40322867f, 0.906661153f},
-std::array<float,2>{0.597499251f, 0.736555219f},
-std::array<float,2>{0.00831830781f, 0.280727744f},
-std::array<float,2>{0.726553917f, 0.48200044f},
-std::array<float,2>{0.138140649f, 0.590126157f},
-std::array<float,2>{0.901353538f, 0.791725636f},
-std::array<float,2>{0.269128531f, 0.102714159f},
-std::array<float,2>{0.55509901f, 0.0606655069f},
-std::array<float,2>{0.0871070251f, 0.871814311f},
-std::array<float,2>{0.859095573f, 0.513154507f},
-std::array<float,2>{0.489901841f, 0.423090309f},
-std::array<float,2>{0.966162086f, 0.366554111f},
-std::array<float,2>{0.313758403f, 0.685844779f},
-std::array<float,2>{0.661404073f, 0.947761714f},
-std::array<float,2>{0.227756903f, 0.237995014f},
-std::array<float,2>{0.846026897f, 0.116942912f},
-std::array<float,2>{0.499392152f, 0.799545944f},
-std::array<float,2>{0.554449975f, 0.563060164f},
-std::array<float,2>{0.0854066014f, 0.491757303f},
-std::array<float,2>{0.667154014f, 0.257856786f},
-std::array<float,2>{0.219821081f, 0.729286373f},
-std::array<float,2>{0.958376825f, 0.933558464f},
-std::array<float,2>{0.325820118f, 0.181121379f},
-std::array<float,2>{0.606237471f, 0.232777536f},
-std::array<float,2>{0.00486134971f, 0.961064577f},
-std::array<float,2>{0.810764313f, 0.671821237f},
-std::array<float,2>{0.394429296f, 0.35316667f},
-std::array<float,2>{0.892078459f, 0.406411409f},
-std::array<float,2>{0.278606087f, 0.526590586f},
-std::array<float,2>{0.733956158f, 0.852156162f},
-std::array<float,2>{0.12568152f, 0.0414534472f},
-std::array<float,2>{0.986491263f, 0.152529091f},
-std::array<float,2>{0.363141567f, 0.877149403f},
-std::array<float,2>{0.644711971f, 0.689656198f},
-std::array<float,2>{0.213857621f, 0.291634917f},
-std::array<float,2>{0.523567975f, 0.459403574f},
-std::array<float,2>{0.104889534f, 0.59522593f},
-std::array<float,2>{0.827437997f, 0.754578054f},
-std::array<float,2>{0.456420422f, 0.0664035529f},
-std::array<float,2>{0.714671254f, 0.00226272014f},
-std::array<float,2>{0.184731245f, 0.817865908f},
-std::array<float,2>{0.919627666f, 0.557128072f},
-std::array<float,2>{0.290463984f, 0.403085202f},
-std::array<float,2>{0.754941046f, 0.332422614f},
-std::array<float,2>{0.406697482f, 0.647566617f},
-std::array<float,2>{0.587643981f, 0.979152918f},
-std::array<float,2>{0.0399467573f, 0.187520847f},
-std::array<float,2>{0.931985617f, 0.0572016537f},
-std::array<float,2>{0.308645934f, 0.870250106f},
-std::array<float,2>{0.702268779f, 0.50863868f},
-std::array<float,2>{0.167377293f, 0.426855028f},
-std::array<float,2>{0.575174034f, 0.363200605f},
-std::array<float,2>{0.0575636178f, 0.680655122f},
-std::array<float,2>{0.777566195f, 0.951307774f},
-std::array<float,2>{0.428206116f, 0.239403769f},
-std::array<float,2>{0.62550962f, 0.171398237f},
-std::array<float,2>{0.193208009f, 0.912336588f},
-std::array<float,2>{0.974461913f, 0.742109001f},
-std::array<float,2>{0.350064278f, 0.275232971f},
-std::array<float,2>{0.830995739f, 0.479307652f},
-std::array<float,2>{0.442501277f, 0.586659312f},
-std::array<float,2>{0.505596161f, 0.796390176f},
-std::array<float,2>{0.112077653f, 0.107461639f},
-std::array<float,2>{0.79643178f, 0.212565035f},
-std::array<float,2>{0.377790093f, 0.985329807f},
-std::array<float,2>{0.622901499f, 0.63001883f},
-std::array<float,2>{0.0181509871f, 0.321291655f},
-std::array<float,2>{0.743699491f, 0.380900264f},
-std::array<float,2>{0.151853919f, 0.531959891f},
-std::array<float,2>{0.877596617f, 0.832837403f},
-std::array<float,2>{0.261776894f, 0.020781735f},
-std::array<float,2>{0.539340436f, 0.0833765417f},
-std::array<float,2>{0.0752570406f, 0.772268176f},
-std::array<float,2>{0.861703515f, 0.611721575f},
-std::array<float,2>{0.482181787f, 0.453108042f},
-std::array<float,2>{0.943970859f, 0.311596453f},
-std::array<float,2>{0.341490746f, 0.717203736f},
-std::array<float,2>{0.680793166f, 0.901465237f},
-std::array<float,2>{0.240870535f, 0.139333263f},
-std::array<float,2>{0.765790522f, 0.0242531691f},
-std::array<float,2>{0.432885379f, 0.841130614f},
-std::array<float,2>{0.569598556f, 0.54172045f},
-std::array<float,2>{0.052687563f, 0.386945993f},
-std::array<float,2>{0.690403283f, 0.320108056f},
-std::array<float,2>{0.163850769f, 0.639354348f},
-std::array<float,2>{0.925650358f, 0.994973838f},
-std::array<float,2>{0.297939748f, 0.207756385f},
-std::array<float,2>{0.510591805f, 0.129148662f},
-std::array<float,2>{0.123383954f, 0.894385517f},
-std::array<float,2>{0.838758826f, 0.703368843f},
-std::array<float,2>{0.446839452f, 0.297219515f},
-std::array<float,2>{0.982775688f, 0.441325545f},
-std::array<float,2>{0.356361806f, 0.62283802f},
-std::array<float,2>{0.639815331f, 0.77929318f},
-std::array<float,2>{0.195734814f, 0.0864510164f},
-std::array<float,2>{0.885514557f, 0.246278837f},
-std::array<float,2>{0.254152328f, 0.937845886f},
-std::array<float,2>{0.740685105f, 0.677785158f},
-std::array<float,2>{0.142437041f, 0.370971769f},
-std::array<float,2>{0.613743484f, 0.429734617f},
-std::array<float,2>{0.0259325597f, 0.501539707f},
-std::array<float,2>{0.781389713f, 0.859890699f},
-std::array<float,2>{0.385997385f, 0.0478450656f},
-std::array<float,2>{0.674072504f, 0.0941348299f},
-std::array<float,2>{0.242877588f, 0.783622265f},
-std::array<float,2>{0.949629724f, 0.578202128f},
-std::array<float,2>{0.334681481f, 0.474458545f},
-std::array<float,2>{0.870883465f, 0.27322644f},
-std::array<float,2>{0.475637227f, 0.742458522f},
-std::array<float,2>{0.537687182f, 0.918208361f},
-std::array<float,2>{0.0681905299f, 0.158211544f},
-std::array<float,2>{0.961823881f, 0.0765754655f},
-std::array<float,2>{0.317206651f, 0.760879099f},
-std::array<float,2>{0.657231629f, 0.606910288f},
-std::array<float,2>{0.231825545f, 0.461813539f},
-std::array<float,2>{0.558849454f, 0.286239743f},
-std::array<float,2>{0.0920840204f, 0.697526515f},
-std::array<float,2>{0.853764057f, 0.887296557f},
-std::array<float,2>{0.486544371f, 0.14215976f},
-std::array<float,2>{0.719488025f, 0.200056836f},
-std::array<float,2>{0.135406494f, 0.973856449f},
-std::array<float,2>{0.904579163f, 0.649163067f},
-std::array<float,2>{0.271757841f, 0.338616431f},
-std::array<float,2>{0.797202826f, 0.391665846f},
-std::array<float,2>{0.401195675f, 0.55041045f},
-std::array<float,2>{0.598690808f, 0.821661234f},
-std::array<float,2>{0.0134702688f, 0.00863251463f},
-std::array<float,2>{0.818509758f, 0.172232956f},
-std::array<float,2>{0.467358649f, 0.926593244f},
-std::array<float,2>{0.518189251f, 0.725355625f},
-std::array<float,2>{0.0948809832f, 0.250690103f},
-std::array<float,2>{0.650592625f, 0.499377042f},
-std::array<float,2>{0.203232884f, 0.574849725f},
-std::array<float,2>{0.993170917f, 0.811789989f},
-std::array<float,2>{0.367771894f, 0.122020468f},
-std::array<float,2>{0.578970432f, 0.0332025811f},
-std::array<float,2>{0.037348181f, 0.847834587f},
-std::array<float,2>{0.763230562f, 0.519924998f},
-std::array<float,2>{0.41507408f, 0.417153925f},
-std::array<float,2>{0.907021344f, 0.350937426f},
-std::array<float,2>{0.28308171f, 0.658209085f},
-std::array<float,2>{0.708812237f, 0.957565784f},
-std::array<float,2>{0.175271958f, 0.221920222f},
-std::array<float,2>{0.807937503f, 0.0929853246f},
-std::array<float,2>{0.396684021f, 0.777223766f},
-std::array<float,2>{0.604925573f, 0.618918061f},
-std::array<float,2>{0.00197833474f, 0.443011045f},
-std::array<float,2>{0.729576766f, 0.304478765f},
-std::array<float,2>{0.129862458f, 0.710256934f},
-std::array<float,2>{0.89529568f, 0.896351218f},
-std::array<float,2>{0.273528099f, 0.125647858f},
-std::array<float,2>{0.547235668f, 0.203771114f},
-std::array<float,2>{0.078450717f, 0.997409046f},
-std::array<float,2>{0.849251628f, 0.633383036f},
-std::array<float,2>{0.494194239f, 0.315578222f},
-std::array<float,2>{0.954034448f, 0.386336118f},
-std::array<float,2>{0.323962986f, 0.543300271f},
-std::array<float,2>{0.668036759f, 0.836842716f},
-std::array<float,2>{0.223199397f, 0.0282885227f},
-std::array<float,2>{0.917840302f, 0.162387788f},
-std::array<float,2>{0.294610471f, 0.914810479f},
-std::array<float,2>{0.71556747f, 0.747973561f},
-std::array<float,2>{0.18122986f, 0.268818438f},
-std::array<float,2>{0.590186477f, 0.468969196f},
-std::array<float,2>{0.0453159586f, 0.585273325f},
-std::array<float,2>{0.751843035f, 0.786988735f},
-std::array<float,2>{0.410695702f, 0.0997241884f},
-std::array<float,2>{0.642050505f, 0.052301608f},
-std::array<float,2>{0.216859236f, 0.865415931f},
-std::array<float,2>{0.989913225f, 0.504122555f},
-std::array<float,2>{0.366828173f, 0.43367222f},
-std::array<float,2>{0.82364428f, 0.374225408f},
-std::array<float,2>{0.460518897f, 0.67282325f},
-std::array<float,2>{0.528204024f, 0.943021655f},
-std::array<float,2>{0.106237814f, 0.242601141f},
-std::array<float,2>{0.97135067f, 0.0128331957f},
-std::array<float,2>{0.344091326f, 0.825038254f},
-std::array<float,2>{0.632675886f, 0.552409768f},
-std::array<float,2>{0.189722762f, 0.395699888f},
-std::array<float,2>{0.500171542f, 0.343568981f},
-std::array<float,2>{0.115014143f, 0.653107166f},
-std::array<float,2>{0.835135281f, 0.970076144f},
-std::array<float,2>{0.437984049f, 0.19895646f},
-std::array<float,2>{0.695881844f, 0.145218968f},
-std::array<float,2>{0.170493007f, 0.883607745f},
-std::array<float,2>{0.934451699f, 0.702995718f},
-std::array<float,2>{0.304757237f, 0.281851262f},
-std::array<float,2>{0.776996851f, 0.466074377f},
-std::array<float,2>{0.423826188f, 0.604108334f},
-std::array<float,2>{0.573182225f, 0.762241185f},
-std::array<float,2>{0.0586364716f, 0.0729409754f},
-std::array<float,2>{0.867176175f, 0.225933328f},
-std::array<float,2>{0.47851944f, 0.954267859f},
-std::array<float,2>{0.544040859f, 0.661373556f},
-std::array<float,2>{0.0709376261f, 0.347651392f},
-std::array<float,2>{0.684724152f, 0.420647264f},
-std::array<float,2>{0.237337455f, 0.516006947f},
-std::array<float,2>{0.940740466f, 0.844922125f},
-std::array<float,2>{0.336642414f, 0.0375507623f},
-std::array<float,2>{0.617802858f, 0.119868107f},
-std::array<float,2>{0.0195681341f, 0.805785656f},
-std::array<float,2>{0.792852819f, 0.572046816f},
-std::array<float,2>{0.380915642f, 0.494765073f},
-std::array<float,2>{0.879440963f, 0.255315691f},
-std::array<float,2>{0.258474886f, 0.72019285f},
-std::array<float,2>{0.747931123f, 0.92208463f},
-std::array<float,2>{0.154587448f, 0.179308221f},
-std::array<float,2>{0.842652917f, 0.0459962673f},
-std::array<float,2>{0.450875103f, 0.858426034f},
-std::array<float,2>{0.514405966f, 0.527650118f},
-std::array<float,2>{0.120276168f, 0.412757784f},
-std::array<float,2>{0.632915556f, 0.358851492f},
-std::array<float,2>{0.200691536f, 0.664329767f},
-std::array<float,2>{0.978490174f, 0.967864692f},
-std::array<float,2>{0.352327228f, 0.228006959f},
-std::array<float,2>{0.565747082f, 0.184240744f},
-std::array<float,2>{0.0493886024f, 0.935318053f},
-std::array<float,2>{0.770664752f, 0.733432353f},
-std::array<float,2>{0.43372494f, 0.264714926f},
-std::array<float,2>{0.927414596f, 0.487934142f},
-std::array<float,2>{0.303324014f, 0.568531752f},
-std::array<float,2>{0.692759156f, 0.802399278f},
-std::array<float,2>{0.15967074f, 0.112692572f},
-std::array<float,2>{0.948937297f, 0.192450508f},
-std::array<float,2>{0.32848832f, 0.981962085f},
-std::array<float,2>{0.679282367f, 0.644185662f},
-std::array<float,2>{0.24628666f, 0.33022666f},
-std::array<float,2>{0.533122957f, 0.401046604f},
-std::array<float,2>{0.0625419393f, 0.561478496f},
-std::array<float,2>{0.871453941f, 0.81347084f},
-std::array<float,2>{0.471898347f, 0.00718192197f},
-std::array<float,2>{0.734474063f, 0.0681989342f},
-std::array<float,2>{0.14830409f, 0.753800452f},
-std::array<float,2>{0.887251973f, 0.598493814f},
-std::array<float,2>{0.251591802f, 0.454328805f},
-std::array<float,2>{0.785668075f, 0.296781629f},
-std::array<float,2>{0.388761491f, 0.694149017f},
-std::array<float,2>{0.609612644f, 0.880844295f},
-std::array<float,2>{0.0292284247f, 0.150538728f},
-std::array<float,2>{0.899577379f, 0.10535685f},
-std::array<float,2>{0.265977323f, 0.790052295f},
-std::array<float,2>{0.723325849f, 0.592484295f},
-std::array<float,2>{0.140112907f, 0.483957708f},
-std::array<float,2>{0.593938231f, 0.277801126f},
-std::array<float,2>{0.00978683028f, 0.734850526f},
-std::array<float,2>{0.801360428f, 0.910129547f},
-std::array<float,2>{0.405862987f, 0.165165707f},
-std::array<float,2>{0.662555516f, 0.235410959f},
-std::array<float,2>{0.228806525f, 0.945321798f},
-std::array<float,2>{0.967619956f, 0.68552959f},
-std::array<float,2>{0.315389812f, 0.364081055f},
-std::array<float,2>{0.856154799f, 0.4246521f},
-std::array<float,2>{0.491203129f, 0.514184654f},
-std::array<float,2>{0.556654811f, 0.873540163f},
-std::array<float,2>{0.089677006f, 0.0590350702f},
-std::array<float,2>{0.759438038f, 0.136652634f},
-std::array<float,2>{0.421535879f, 0.905429661f},
-std::array<float,2>{0.585844278f, 0.711037457f},
-std::array<float,2>{0.0346144103f, 0.307086974f},
-std::array<float,2>{0.704037607f, 0.445797563f},
-std::array<float,2>{0.178166285f, 0.613837123f},
-std::array<float,2>{0.913165867f, 0.767849624f},
-std::array<float,2>{0.286022305f, 0.0792525113f},
-std::array<float,2>{0.52197504f, 0.0193948094f},
-std::array<float,2>{0.0977198482f, 0.828334749f},
-std::array<float,2>{0.815977335f, 0.538613379f},
-std::array<float,2>{0.464556068f, 0.378880024f},
-std::array<float,2>{0.99633944f, 0.324299276f},
-std::array<float,2>{0.374486893f, 0.628044486f},
-std::array<float,2>{0.65616864f, 0.989773095f},
-std::array<float,2>{0.210450664f, 0.217016473f},
-std::array<float,2>{0.829714179f, 0.108505763f},
-std::array<float,2>{0.444479108f, 0.795753777f},
-std::array<float,2>{0.506808698f, 0.587745607f},
-std::array<float,2>{0.110585317f, 0.479880303f},
-std::array<float,2>{0.62885052f, 0.273715645f},
-std::array<float,2>{0.193925172f, 0.740577161f},
-std::array<float,2>{0.976205528f, 0.913857996f},
-std::array<float,2>{0.348658472f, 0.1700712f},
-std::array<float,2>{0.577266753f, 0.238570139f},
-std::array<float,2>{0.0552407093f, 0.953016937f},
-std::array<float,2>{0.779597342f, 0.681109667f},
-std::array<float,2>{0.426118374f, 0.361685634f},
-std::array<float,2>{0.93040961f, 0.4260602f},
-std::array<float,2>{0.312197357f, 0.50967133f},
-std::array<float,2>{0.699529767f, 0.86999166f},
-std::array<float,2>{0.1647733f, 0.0578213483f},
-std::array<float,2>{0.942304194f, 0.139923185f},
-std::array<float,2>{0.342350602f, 0.900508642f},
-std::array<float,2>{0.681960404f, 0.718501091f},
-std::array<float,2>{0.238385543f, 0.311173648f},
-std::array<float,2>{0.542563856f, 0.451629579f},
-std::array<float,2>{0.0775645077f, 0.612570465f},
-std::array<float,2>{0.859550357f, 0.773135006f},
-std::array<float,2>{0.484206736f, 0.0830050483f},
-std::array<float,2>{0.744355619f, 0.0201158784f},
-std::array<float,2>{0.149004593f, 0.83362782f},
-std::array<float,2>{0.876557708f, 0.533147871f},
-std::array<float,2>{0.264907807f, 0.382511944f},
-std::array<float,2>{0.79473871f, 0.321034938f},
-std::array<float,2>{0.376906782f, 0.629309833f},
-std::array<float,2>{0.62352401f, 0.985632479f},
-std::array<float,2>{0.0170286298f, 0.211673513f},
-std::array<float,2>{0.894283116f, 0.0423506387f},
-std::array<float,2>{0.27990815f, 0.853375971f},
-std::array<float,2>{0.730556071f, 0.525823236f},
-std::array<float,2>{0.127257049f, 0.407725781f},
-std::array<float,2>{0.608105242f, 0.351594359f},
-std::array<float,2>{0.00770431757f, 0.670096278f},
-std::array<float,2>{0.809100568f, 0.962783337f},
-std::array<float,2>{0.391632468f, 0.234041497f},
-std::array<float,2>{0.664726496f, 0.179813594f},
-std::array<float,2>{0.221253827f, 0.932251632f},
-std::array<float,2>{0.959268034f, 0.729956329f},
-std::array<float,2>{0.326785535f, 0.259460956f},
-std::array<float,2>{0.843815565f, 0.490516692f},
-std::array<float,2>{0.496782809f, 0.563862801f},
-std::array<float,2>{0.552645743f, 0.800771654f},
-std::array<float,2>{0.0839310139f, 0.115359426f},
-std::array<float,2>{0.756143153f, 0.1887348f},
-std::array<float,2>{0.408308148f, 0.979984164f},
-std::array<float,2>{0.588273585f, 0.646945357f},
-std::array<float,2>{0.0428109355f, 0.333140522f},
-std::array<float,2>{0.71130389f, 0.403847694f},
-std::array<float,2>{0.186542124f, 0.558577538f},
-std::array<float,2>{0.921555102f, 0.81681484f},
-std::array<float,2>{0.291448742f, 0.00344739342f},
-std::array<float,2>{0.527011633f, 0.0650451407f},
-std::array<float,2>{0.102557771f, 0.75534004f},
-std::array<float,2>{0.825017452f, 0.59438771f},
-std::array<float,2>{0.453481466f, 0.460093379f},
-std::array<float,2>{0.98532182f, 0.292487353f},
-std::array<float,2>{0.360377938f, 0.691348314f},
-std::array<float,2>{0.648404717f, 0.878714561f},
-std::array<float,2>{0.212634087f, 0.15392898f},
-std::array<float,2>{0.799745321f, 0.00888359826f},
-std::array<float,2>{0.400196791f, 0.82076329f},
-std::array<float,2>{0.600680113f, 0.54922086f},
-std::array<float,2>{0.0147246784f, 0.391160786f},
-std::array<float,2>{0.720823228f, 0.339384258f},
-std::array<float,2>{0.134626433f, 0.649456501f},
-std::array<float,2>{0.903330088f, 0.973357081f},
-std::array<float,2>{0.271204114f, 0.200720221f},
-std::array<float,2>{0.561258256f, 0.141047895f},
-std::array<float,2>{0.0917925686f, 0.887955189f},
-std::array<float,2>{0.85212183f, 0.698587239f},
-std::array<float,2>{0.485731423f, 0.285175472f},
-std::array<float,2>{0.9645769f, 0.462684602f},
-std::array<float,2>{0.319012463f, 0.606387019f},
-std::array<float,2>{0.659116387f, 0.760085881f},
-std::array<float,2>{0.233651906f, 0.0775979161f},
-std::array<float,2>{0.908701658f, 0.221602589f},
-std::array<float,2>{0.284447134f, 0.958035469f},
-std::array<float,2>{0.709766865f, 0.659481108f},
-std::array<float,2>{0.172720388f, 0.350308299f},
-std::array<float,2>{0.581203759f, 0.41635859f},
-std::array<float,2>{0.0359900966f, 0.520670414f},
-std::array<float,2>{0.765021086f, 0.849079251f},
-std::array<float,2>{0.417154104f, 0.0321003832f},
-std::array<float,2>{0.650294721f, 0.1224868f},
-std::array<float,2>{0.205336466f, 0.811005414f},
-std::array<float,2>{0.995519996f, 0.575202644f},
-std::array<float,2>{0.369421124f, 0.498497486f},
-std::array<float,2>{0.817583323f, 0.251683444f},
-std::array<float,2>{0.465163857f, 0.726216197f},
-std::array<float,2>{0.517537177f, 0.92768544f},
-std::array<float,2>{0.0975916013f, 0.173483357f},
-std::array<float,2>{0.981080949f, 0.0871050358f},
-std::array<float,2>{0.358175427f, 0.777434051f},
-std::array<float,2>{0.637434006f, 0.621913016f},
-std::array<float,2>{0.199060127f, 0.440276921f},
-std::array<float,2>{0.507960856f, 0.298444539f},
-std::array<float,2>{0.121853858f, 0.704811633f},
-std::array<float,2>{0.836303651f, 0.893184543f},
-std::array<float,2>{0.448330641f, 0.130137995f},
-std::array<float,2>{0.688951135f, 0.208276868f},
-std::array<float,2>{0.160817996f, 0.99565047f},
-std::array<float,2>{0.92311424f, 0.639690578f},
-std::array<float,2>{0.300298065f, 0.319134355f},
-std::array<float,2>{0.76788044f, 0.387716144f},
-std::array<float,2>{0.429690152f, 0.542062581f},
-std::array<float,2>{0.56764251f, 0.839915454f},
-std::array<float,2>{0.0530333742f, 0.0249534287f},
-std::array<float,2>{0.86780864f, 0.159858584f},
-std::array<float,2>{0.473336339f, 0.919309318f},
-std::array<float,2>{0.535470963f, 0.743176162f},
-std::array<float,2>{0.0689381137f, 0.27222237f},
-std::array<float,2>{0.672204077f, 0.473296613f},
-std::array<float,2>{0.245619044f, 0.579272568f},
-std::array<float,2>{0.952442884f, 0.78437674f},
-std::array<float,2>{0.332151741f, 0.0948680341f},
-std::array<float,2>{0.615728736f, 0.0487684682f},
-std::array<float,2>{0.0248627029f, 0.860863328f},
-std::array<float,2>{0.785035491f, 0.500622928f},
-std::array<float,2>{0.38401106f, 0.431195498f},
-std::array<float,2>{0.883471727f, 0.369980991f},
-std::array<float,2>{0.256954372f, 0.678923309f},
-std::array<float,2>{0.739142656f, 0.93885541f},
-std::array<float,2>{0.143627673f, 0.247724608f},
-std::array<float,2>{0.775259972f, 0.0734635219f},
-std::array<float,2>{0.425580174f, 0.763279498f},
-std::array<float,2>{0.571178973f, 0.605085611f},
-std::array<float,2>{0.0618355535f, 0.46500653f},
-std::array<float,2>{0.698231637f, 0.282834023f},
-std::array<float,2>{0.168552876f, 0.701532364f},
-std::array<float,2>{0.937498689f, 0.884488046f},
-std::array<float,2>{0.308388859f, 0.145634174f},
-std::array<float,2>{0.503256321f, 0.198108003f},
-std::array<float,2>{0.116363458f, 0.969551861f},
-std::array<float,2>{0.832897186f, 0.653767347f},
-std::array<float,2>{0.44111377f, 0.34187147f},
-std::array<float,2>{0.969053209f, 0.394873649f},
-std::array<float,2>{0.347133338f, 0.55161196f},
-std::array<float,2>{0.629485309f, 0.825290382f},
-std::array<float,2>{0.188364848f, 0.0120944306f},
-std::array<float,2>{0.881099641f, 0.178415447f},
-std::array<float,2>{0.261164606f, 0.922938049f},
-std::array<float,2>{0.748565197f, 0.719667792f},
-std::array<float,2>{0.153282821f, 0.2541444f},
-std::array<float,2>{0.620919049f, 0.495961189f},
-std::array<float,2>{0.0215186328f, 0.570668936f},
-std::array<float,2>{0.790750086f, 0.80526197f},
-std::array<float,2>{0.380495429f, 0.120490409f},
-std::array<float,2>{0.685777903f, 0.0383525081f},
-std::array<float,2>{0.235700026f, 0.844267666f},
-std::array<float,2>{0.938010752f, 0.516890645f},
-std::array<float,2>{0.339369774f, 0.421409488f},
-std::array<float,2>{0.864310741f, 0.345847011f},
-std::array<float,2>{0.477441192f, 0.660868287f},
-std::array<float,2>{0.545304239f, 0.953682661f},
-std::array<float,2>{0.0726498961f, 0.224979624f},
-std::array<float,2>{0.956634283f, 0.0285884961f},
-std::array<float,2>{0.321730375f, 0.837854683f},
-std::array<float,2>{0.671028793f, 0.544394195f},
-std::array<float,2>{0.226170301f, 0.385249525f},
-std::array<float,2>{0.548854709f, 0.315320522f},
-std::array<float,2>{0.0817874968f, 0.634620845f},
-std::array<float,2>{0.850222409f, 0.996667624f},
-std::array<float,2>{0.493311733f, 0.204489529f},
-std::array<float,2>{0.728514194f, 0.126139075f},
-std::array<float,2>{0.132419556f, 0.895128787f},
-std::array<float,2>{0.897191942f, 0.70900023f},
-std::array<float,2>{0.276571959f, 0.303478777f},
-std::array<float,2>{0.806447625f, 0.441529483f},
-std::array<float,2>{0.396077871f, 0.61728847f},
-std::array<float,2>{0.601827204f, 0.775816977f},
-std::array<float,2>{0.000919440237f, 0.0918209627f},
-std::array<float,2>{0.820931137f, 0.243708163f},
-std::array<float,2>{0.458601177f, 0.942040741f},
-std::array<float,2>{0.529777169f, 0.67370975f},
-std::array<float,2>{0.108734265f, 0.373644233f},
-std::array<float,2>{0.642617524f, 0.434573382f},
-std::array<float,2>{0.216609448f, 0.505176961f},
-std::array<float,2>{0.991552889f, 0.866567433f},
-std::array<float,2>{0.363351643f, 0.0515183248f},
-std::array<float,2>{0.593068898f, 0.101387039f},
-std::array<float,2>{0.0438534617f, 0.785496175f},
-std::array<float,2>{0.752229989f, 0.584789455f},
-std::array<float,2>{0.413430035f, 0.469902962f},
-std::array<float,2>{0.915732265f, 0.268376201f},
-std::array<float,2>{0.296207279f, 0.746637404f},
-std::array<float,2>{0.71705538f, 0.915477037f},
-std::array<float,2>{0.182788149f, 0.164008141f},
-std::array<float,2>{0.858015001f, 0.0597996339f},
-std::array<float,2>{0.488539606f, 0.874414921f},
-std::array<float,2>{0.555665374f, 0.515557945f},
-std::array<float,2>{0.0867307559f, 0.425585657f},
-std::array<float,2>{0.660358548f, 0.364980072f},
-std::array<float,2>{0.226648673f, 0.684302509f},
-std::array<float,2>{0.965760767f, 0.946450055f},
-std::array<float,2>{0.312760741f, 0.235085845f},
-std::array<float,2>{0.596452057f, 0.1644485f},
-std::array<float,2>{0.00920273084f, 0.908452392f},
-std::array<float,2>{0.804208398f, 0.736007869f},
-std::array<float,2>{0.404223621f, 0.278544188f},
-std::array<float,2>{0.901903212f, 0.48322621f},
-std::array<float,2>{0.26805976f, 0.593646467f},
-std::array<float,2>{0.725555003f, 0.789898276f},
-std::array<float,2>{0.136772543f, 0.104265213f},
-std::array<float,2>{0.999869049f, 0.218604222f},
-std::array<float,2>{0.372707278f, 0.989011824f},
-std::array<float,2>{0.65318954f, 0.627247453f},
-std::array<float,2>{0.207822934f, 0.325626373f},
-std::array<float,2>{0.521127462f, 0.377708346f},
-std::array<float,2>{0.100530639f, 0.537460446f},
-std::array<float,2>{0.814031839f, 0.829822421f},
-std::array<float,2>{0.4618949f, 0.0183580015f},
-std::array<float,2>{0.70683378f, 0.0788235739f},
-std::array<float,2>{0.176739514f, 0.769194186f},
-std::array<float,2>{0.910527825f, 0.614437044f},
-std::array<float,2>{0.287724078f, 0.447102249f},
-std::array<float,2>{0.760788202f, 0.307650208f},
-std::array<float,2>{0.418038219f, 0.712658644f},
-std::array<float,2>{0.583730221f, 0.904807985f},
-std::array<float,2>{0.0326139852f, 0.134959191f},
-std::array<float,2>{0.928595304f, 0.111842662f},
-std::array<float,2>{0.302730709f, 0.801138341f},
-std::array<float,2>{0.694978237f, 0.570231378f},
-std::array<float,2>{0.156912193f, 0.48676759f},
-std::array<float,2>{0.56317091f, 0.264510989f},
-std::array<float,2>{0.0475174189f, 0.733111382f},
-std::array<float,2>{0.771676719f, 0.934042931f},
-std::array<float,2>{0.435819328f, 0.185437873f},
-std::array<float,2>{0.635191858f, 0.226647824f},
-std::array<float,2>{0.201214522f, 0.96722734f},
-std::array<float,2>{0.980178118f, 0.665832162f},
-std::array<float,2>{0.355257601f, 0.35773015f},
-std::array<float,2>{0.841386795f, 0.41344735f},
-std::array<float,2>{0.451503366f, 0.528972089f},
-std::array<float,2>{0.512247622f, 0.858228326f},
-std::array<float,2>{0.117758952f, 0.045364026f},
-std::array<float,2>{0.787433982f, 0.152021244f},
-std::array<float,2>{0.388142735f, 0.879175246f},
-std::array<float,2>{0.611511946f, 0.69477731f},
-std::array<float,2>{0.0305736642f, 0.295301497f},
-std::array<float,2>{0.737333f, 0.453853846f},
-std::array<float,2>{0.14543201f, 0.598692f},
-std::array<float,2>{0.888970196f, 0.752625644f},
-std::array<float,2>{0.253727764f, 0.0664999709f},
-std::array<float,2>{0.533648789f, 0.0060743806f},
-std::array<float,2>{0.0648172051f, 0.813832521f},
-std::array<float,2>{0.873516142f, 0.562483788f},
-std::array<float,2>{0.469187438f, 0.401478291f},
-std::array<float,2>{0.945344806f, 0.331150055f},
-std::array<float,2>{0.331298023f, 0.642675877f},
-std::array<float,2>{0.676399946f, 0.980531216f},
-std::array<float,2>{0.248146087f, 0.192313135f},
-std::array<float,2>{0.863009751f, 0.0855939463f},
-std::array<float,2>{0.481058121f, 0.770446122f},
-std::array<float,2>{0.540588796f, 0.610778093f},
-std::array<float,2>{0.0750931501f, 0.450964808f},
-std::array<float,2>{0.680292845f, 0.309305489f},
-std::array<float,2>{0.242148072f, 0.715541959f},
-std::array<float,2>{0.944510341f, 0.899266541f},
-std::array<float,2>{0.340480685f, 0.138663396f},
-std::array<float,2>{0.621174335f, 0.212939173f},
-std::array<float,2>{0.019030109f, 0.986417711f},
-std::array<float,2>{0.795698285f, 0.632049978f},
-std::array<float,2>{0.378159344f, 0.323567063f},
-std::array<float,2>{0.878467798f, 0.379869848f},
-std::array<float,2>{0.263633281f, 0.533263147f},
-std::array<float,2>{0.742917478f, 0.835872293f},
-std::array<float,2>{0.150486887f, 0.0222190358f},
-std::array<float,2>{0.973394692f, 0.169523865f},
-std::array<float,2>{0.350729436f, 0.911409855f},
-std::array<float,2>{0.626054406f, 0.740186274f},
-std::array<float,2>{0.19219631f, 0.276404113f},
-std::array<float,2>{0.503923595f, 0.47842586f},
-std::array<float,2>{0.11326617f, 0.588458776f},
-std::array<float,2>{0.8311885f, 0.794766486f},
-std::array<float,2>{0.441697329f, 0.106229998f},
-std::array<float,2>{0.701834261f, 0.055676315f},
-std::array<float,2>{0.166316301f, 0.868624687f},
-std::array<float,2>{0.932692528f, 0.509910166f},
-std::array<float,2>{0.309672743f, 0.429582983f},
-std::array<float,2>{0.778910995f, 0.360259771f},
-std::array<float,2>{0.42935589f, 0.681668222f},
-std::array<float,2>{0.575628877f, 0.949815989f},
-std::array<float,2>{0.058544226f, 0.242050052f},
-std::array<float,2>{0.918214977f, 0.000443066558f},
-std::array<float,2>{0.289795071f, 0.82026583f},
-std::array<float,2>{0.713079691f, 0.555571139f},
-std::array<float,2>{0.183830023f, 0.40462172f},
-std::array<float,2>{0.586011708f, 0.335383117f},
-std::array<float,2>{0.0402825959f, 0.646247745f},
-std::array<float,2>{0.754536211f, 0.978317857f},
-std::array<float,2>{0.407509893f, 0.189780861f},
-std::array<float,2>{0.645731091f, 0.155975193f},
-std::array<float,2>{0.214496285f, 0.875365615f},
-std::array<float,2>{0.988251448f, 0.688434899f},
-std::array<float,2>{0.362151474f, 0.290300578f},
-std::array<float,2>{0.827103198f, 0.458211422f},
-std::array<float,2>{0.455589026f, 0.596193373f},
-std::array<float,2>{0.52538383f, 0.757154047f},
-std::array<float,2>{0.103582159f, 0.0638009012f},
-std::array<float,2>{0.8124066f, 0.231569082f},
-std::array<float,2>{0.393208355f, 0.964605391f},
-std::array<float,2>{0.607280612f, 0.668711722f},
-std::array<float,2>{0.00573021732f, 0.353708923f},
-std::array<float,2>{0.732860029f, 0.409021556f},
-std::array<float,2>{0.126075089f, 0.52355814f},
-std::array<float,2>{0.891456008f, 0.853657067f},
-std::array<float,2>{0.278053463f, 0.0395980477f},
-std::array<float,2>{0.553089797f, 0.115104064f},
-std::array<float,2>{0.0840816423f, 0.798331439f},
-std::array<float,2>{0.847291291f, 0.565095663f},
-std::array<float,2>{0.49873367f, 0.48974365f},
-std::array<float,2>{0.957848489f, 0.260575086f},
-std::array<float,2>{0.324884117f, 0.727235138f},
-std::array<float,2>{0.666018307f, 0.931185186f},
-std::array<float,2>{0.219462201f, 0.182393089f},
-std::array<float,2>{0.761910796f, 0.033842884f},
-std::array<float,2>{0.414165258f, 0.850828767f},
-std::array<float,2>{0.57941848f, 0.522359848f},
-std::array<float,2>{0.0389382988f, 0.414265782f},
-std::array<float,2>{0.707122803f, 0.348121911f},
-std::array<float,2>{0.174783587f, 0.656916142f},
-std::array<float,2>{0.907301068f, 0.960753679f},
-std::array<float,2>{0.281591535f, 0.22038205f},
-std::array<float,2>{0.518660724f, 0.17457585f},
-std::array<float,2>{0.0946460888f, 0.928122878f},
-std::array<float,2>{0.819389284f, 0.72327435f},
-std::array<float,2>{0.468677282f, 0.252471656f},
-std::array<float,2>{0.992771208f, 0.49755165f},
-std::array<float,2>{0.368877709f, 0.57758373f},
-std::array<float,2>{0.651723683f, 0.809442282f},
-std::array<float,2>{0.204572976f, 0.123662889f},
-std::array<float,2>{0.90620786f, 0.201423585f},
-std::array<float,2>{0.273341089f, 0.97638905f},
-std::array<float,2>{0.719982862f, 0.651479959f},
-std::array<float,2>{0.136549145f, 0.336722523f},
-std::array<float,2>{0.598057747f, 0.39410606f},
-std::array<float,2>{0.011825935f, 0.548711538f},
-std::array<float,2>{0.79874599f, 0.823782742f},
-std::array<float,2>{0.402159363f, 0.0115980627f},
-std::array<float,2>{0.65702045f, 0.0748162791f},
-std::array<float,2>{0.23138015f, 0.758434713f},
-std::array<float,2>{0.962810576f, 0.608145952f},
-std::array<float,2>{0.318014473f, 0.464055806f},
-std::array<float,2>{0.85483247f, 0.288086593f},
-std::array<float,2>{0.487460971f, 0.695340455f},
-std::array<float,2>{0.560138702f, 0.889402866f},
-std::array<float,2>{0.0936533734f, 0.143394619f},
-std::array<float,2>{0.951114774f, 0.0970634446f},
-std::array<float,2>{0.335804522f, 0.782829463f},
-std::array<float,2>{0.675552964f, 0.581063986f},
-std::array<float,2>{0.24335818f, 0.476506084f},
-std::array<float,2>{0.538722217f, 0.269655734f},
-std::array<float,2>{0.0669969916f, 0.744324088f},
-std::array<float,2>{0.870028853f, 0.921672761f},
-std::array<float,2>{0.47473076f, 0.158053651f},
-std::array<float,2>{0.741736829f, 0.249931917f},
-std::array<float,2>{0.141237661f, 0.940404356f},
-std::array<float,2>{0.886638641f, 0.675828516f},
-std::array<float,2>{0.255478412f, 0.367608637f},
-std::array<float,2>{0.782378554f, 0.431964248f},
-std::array<float,2>{0.38523972f, 0.503316283f},
-std::array<float,2>{0.614969492f, 0.862472832f},
-std::array<float,2>{0.0267054588f, 0.0500411093f},
-std::array<float,2>{0.839286804f, 0.132055074f},
-std::array<float,2>{0.445395708f, 0.891566575f},
-std::array<float,2>{0.511031926f, 0.705811143f},
-std::array<float,2>{0.124733038f, 0.300692648f},
-std::array<float,2>{0.63894546f, 0.439397901f},
-std::array<float,2>{0.197088271f, 0.623057365f},
-std::array<float,2>{0.983622849f, 0.780755222f},
-std::array<float,2>{0.35668695f, 0.0884611309f},
-std::array<float,2>{0.568399191f, 0.0268884189f},
-std::array<float,2>{0.051661849f, 0.84193635f},
-std::array<float,2>{0.767064929f, 0.539602399f},
-std::array<float,2>{0.431715369f, 0.390237659f},
-std::array<float,2>{0.924480319f, 0.317085773f},
-std::array<float,2>{0.297322273f, 0.6376279f},
-std::array<float,2>{0.690706372f, 0.993104219f},
-std::array<float,2>{0.163020238f, 0.210746363f},
-std::array<float,2>{0.79103142f, 0.118376561f},
-std::array<float,2>{0.382510006f, 0.807835042f},
-std::array<float,2>{0.618831396f, 0.573212981f},
-std::array<float,2>{0.0213085096f, 0.494089574f},
-std::array<float,2>{0.746866345f, 0.257433593f},
-std::array<float,2>{0.155929759f, 0.721011758f},
-std::array<float,2>{0.880560756f, 0.923997521f},
-std::array<float,2>{0.25946483f, 0.175796375f},
-std::array<float,2>{0.543497026f, 0.223970339f},
-std::array<float,2>{0.071883902f, 0.956290543f},
-std::array<float,2>{0.865578949f, 0.662227273f},
-std::array<float,2>{0.480264515f, 0.345666707f},
-std::array<float,2>{0.939688802f, 0.419240117f},
-std::array<float,2>{0.337242603f, 0.518375576f},
-std::array<float,2>{0.684298992f, 0.84577471f},
-std::array<float,2>{0.236615136f, 0.0355978869f},
-std::array<float,2>{0.934736848f, 0.147932619f},
-std::array<float,2>{0.306385845f, 0.884838104f},
-std::array<float,2>{0.697025061f, 0.699764371f},
-std::array<float,2>{0.171392858f, 0.283262342f},
-std::array<float,2>{0.573558033f, 0.467378795f},
-std::array<float,2>{0.0598260611f, 0.601699591f},
-std::array<float,2>{0.776196659f, 0.765495181f},
-std::array<float,2>{0.422213823f, 0.0716540068f},
-std::array<float,2>{0.631165028f, 0.0141556989f},
-std::array<float,2>{0.190742508f, 0.82735455f},
-std::array<float,2>{0.971859336f, 0.553664863f},
-std::array<float,2>{0.344875515f, 0.398340106f},
-std::array<float,2>{0.834951758f, 0.341302246f},
-std::array<float,2>{0.43917492f, 0.654720545f},
-std::array<float,2>{0.501264334f, 0.972300351f},
-std::array<float,2>{0.113801211f, 0.197179615f},
-std::array<float,2>{0.988490283f, 0.0537993461f},
-std::array<float,2>{0.365757734f, 0.864359617f},
-std::array<float,2>{0.641051829f, 0.507391989f},
-std::array<float,2>{0.217815489f, 0.435798347f},
-std::array<float,2>{0.529210269f, 0.372012913f},
-std::array<float,2>{0.106910527f, 0.674296081f},
-std::array<float,2>{0.822967887f, 0.944832146f},
-std::array<float,2>{0.459932178f, 0.244193375f},
-std::array<float,2>{0.715822101f, 0.160899013f},
-std::array<float,2>{0.180487618f, 0.917503774f},
-std::array<float,2>{0.916219234f, 0.748575747f},
-std::array<float,2>{0.293610066f, 0.266461045f},
-std::array<float,2>{0.750330627f, 0.472054988f},
-std::array<float,2>{0.411256552f, 0.583479226f},
-std::array<float,2>{0.591151357f, 0.788286448f},
-std::array<float,2>{0.0466360524f, 0.0993466303f},
-std::array<float,2>{0.848358512f, 0.206798539f},
-std::array<float,2>{0.495855749f, 0.998456717f},
-std::array<float,2>{0.548416853f, 0.63567102f},
-std::array<float,2>{0.0793910623f, 0.313875258f},
-std::array<float,2>{0.669830799f, 0.384598732f},
-std::array<float,2>{0.224132583f, 0.546195447f},
-std::array<float,2>{0.954839647f, 0.839288354f},
-std::array<float,2>{0.322590679f, 0.0294212904f},
-std::array<float,2>{0.604398668f, 0.0915212408f},
-std::array<float,2>{0.00329293218f, 0.774977207f},
-std::array<float,2>{0.806765914f, 0.620726645f},
-std::array<float,2>{0.398382187f, 0.444068015f},
-std::array<float,2>{0.895638883f, 0.301302731f},
-std::array<float,2>{0.274562478f, 0.708485365f},
-std::array<float,2>{0.728643477f, 0.897679627f},
-std::array<float,2>{0.130177602f, 0.127599061f},
-std::array<float,2>{0.815066397f, 0.0173550993f},
-std::array<float,2>{0.463418961f, 0.831623554f},
-std::array<float,2>{0.523391843f, 0.536092281f},
-std::array<float,2>{0.0990275592f, 0.376054972f},
-std::array<float,2>{0.654461384f, 0.327266723f},
-std::array<float,2>{0.209752083f, 0.625757575f},
-std::array<float,2>{0.997676313f, 0.990754306f},
-std::array<float,2>{0.373551607f, 0.214976966f},
-std::array<float,2>{0.584458232f, 0.134676933f},
-std::array<float,2>{0.0335279256f, 0.903618097f},
-std::array<float,2>{0.75833267f, 0.713325799f},
-std::array<float,2>{0.420008987f, 0.305050671f},
-std::array<float,2>{0.912626922f, 0.449084312f},
-std::array<float,2>{0.28642562f, 0.61577636f},
-std::array<float,2>{0.704475343f, 0.766456187f},
-std::array<float,2>{0.178892776f, 0.0809420794f},
-std::array<float,2>{0.968423426f, 0.236830294f},
-std::array<float,2>{0.315805018f, 0.948570549f},
-std::array<float,2>{0.663340509f, 0.686764061f},
-std::array<float,2>{0.230033055f, 0.365917385f},
-std::array<float,2>{0.558151245f, 0.421932727f},
-std::array<float,2>{0.0888121724f, 0.511773109f},
-std::array<float,2>{0.856794178f, 0.872786343f},
-std::array<float,2>{0.491916239f, 0.0619092286f},
-std::array<float,2>{0.724460363f, 0.101938143f},
-std::array<float,2>{0.139130488f, 0.792029917f},
-std::array<float,2>{0.899278045f, 0.591069877f},
-std::array<float,2>{0.267085642f, 0.480992466f},
-std::array<float,2>{0.802281141f, 0.279572695f},
-std::array<float,2>{0.404955477f, 0.738266587f},
-std::array<float,2>{0.594772696f, 0.907983303f},
-std::array<float,2>{0.010922946f, 0.166966721f},
-std::array<float,2>{0.887919903f, 0.06901519f},
-std::array<float,2>{0.250228792f, 0.750658751f},
-std::array<float,2>{0.735399008f, 0.600019097f},
-std::array<float,2>{0.146798849f, 0.455638289f},
-std::array<float,2>{0.611117363f, 0.293001115f},
-std::array<float,2>{0.027747117f, 0.692160785f},
-std::array<float,2>{0.786204994f, 0.881432652f},
-std::array<float,2>{0.390233457f, 0.149106726f},
-std::array<float,2>{0.678680241f, 0.194956794f},
-std::array<float,2>{0.247871876f, 0.982484221f},
-std::array<float,2>{0.947686076f, 0.641488314f},
-std::array<float,2>{0.329583973f, 0.328547925f},
-std::array<float,2>{0.872383058f, 0.400332421f},
-std::array<float,2>{0.470709831f, 0.558983564f},
-std::array<float,2>{0.53153652f, 0.814467072f},
-std::array<float,2>{0.0635031089f, 0.00582072325f},
-std::array<float,2>{0.769854903f, 0.186963782f},
-std::array<float,2>{0.435365587f, 0.937296748f},
-std::array<float,2>{0.564816058f, 0.732080758f},
-std::array<float,2>{0.0507260077f, 0.263632536f},
-std::array<float,2>{0.691492856f, 0.48563996f},
-std::array<float,2>{0.158288702f, 0.566503048f},
-std::array<float,2>{0.92661345f, 0.802784622f},
-std::array<float,2>{0.303819448f, 0.110498503f},
-std::array<float,2>{0.515161037f, 0.0443419628f},
-std::array<float,2>{0.119487152f, 0.856132209f},
-std::array<float,2>{0.843262911f, 0.530140698f},
-std::array<float,2>{0.449467093f, 0.410267472f},
-std::array<float,2>{0.977418065f, 0.355653048f},
-std::array<float,2>{0.353018135f, 0.666983962f},
-std::array<float,2>{0.634419262f, 0.966040611f},
-std::array<float,2>{0.200010911f, 0.229088709f},
-std::array<float,2>{0.832676232f, 0.0708156303f},
-std::array<float,2>{0.441324025f, 0.763900876f},
-std::array<float,2>{0.502981186f, 0.603028059f},
-std::array<float,2>{0.116461538f, 0.468225986f},
-std::array<float,2>{0.629802346f, 0.28480348f},
-std::array<float,2>{0.188099772f, 0.701137662f},
-std::array<float,2>{0.968828321f, 0.886684239f},
-std::array<float,2>{0.346810788f, 0.146547109f},
-std::array<float,2>{0.570971727f, 0.195993915f},
-std::array<float,2>{0.0615672953f, 0.971244514f},
-std::array<float,2>{0.775051236f, 0.656037271f},
-std::array<float,2>{0.425516039f, 0.340375364f},
-std::array<float,2>{0.937204659f, 0.39717564f},
-std::array<float,2>{0.308247834f, 0.554623127f},
-std::array<float,2>{0.697988451f, 0.827145576f},
-std::array<float,2>{0.168818176f, 0.0150113339f},
-std::array<float,2>{0.938245833f, 0.177253604f},
-std::array<float,2>{0.339817882f, 0.925224781f},
-std::array<float,2>{0.685896814f, 0.722225904f},
-std::array<float,2>{0.23551774f, 0.256377459f},
-std::array<float,2>{0.545147419f, 0.493092746f},
-std::array<float,2>{0.0724565387f, 0.573562443f},
-std::array<float,2>{0.864674091f, 0.807201326f},
-std::array<float,2>{0.47727102f, 0.117614873f},
-std::array<float,2>{0.748789728f, 0.0365200974f},
-std::array<float,2>{0.152936265f, 0.846910655f},
-std::array<float,2>{0.881185174f, 0.518832207f},
-std::array<float,2>{0.260758519f, 0.41849643f},
-std::array<float,2>{0.790880024f, 0.344209015f},
-std::array<float,2>{0.380714864f, 0.663529158f},
-std::array<float,2>{0.620832562f, 0.955300629f},
-std::array<float,2>{0.0217559263f, 0.223109871f},
-std::array<float,2>{0.897336781f, 0.0306079984f},
-std::array<float,2>{0.276635975f, 0.838161051f},
-std::array<float,2>{0.728165686f, 0.54496932f},
-std::array<float,2>{0.132663757f, 0.383345664f},
-std::array<float,2>{0.601755559f, 0.312825888f},
-std::array<float,2>{0.000728794315f, 0.636314571f},
-std::array<float,2>{0.806354284f, 0.999287367f},
-std::array<float,2>{0.396322548f, 0.205315635f},
-std::array<float,2>{0.671256185f, 0.127972975f},
-std::array<float,2>{0.226482823f, 0.897396624f},
-std::array<float,2>{0.956965983f, 0.707234681f},
-std::array<float,2>{0.321332425f, 0.302113712f},
-std::array<float,2>{0.850480497f, 0.444574893f},
-std::array<float,2>{0.493416816f, 0.619460881f},
-std::array<float,2>{0.549300909f, 0.773466766f},
-std::array<float,2>{0.0815927684f, 0.0903104544f},
-std::array<float,2>{0.752160907f, 0.245963857f},
-std::array<float,2>{0.413102418f, 0.943680227f},
-std::array<float,2>{0.592890143f, 0.675372064f},
-std::array<float,2>{0.0435699634f, 0.372236133f},
-std::array<float,2>{0.717039108f, 0.437262625f},
-std::array<float,2>{0.183001548f, 0.506777704f},
-std::array<float,2>{0.915929019f, 0.863700211f},
-std::array<float,2>{0.295907617f, 0.0532760583f},
-std::array<float,2>{0.529326499f, 0.0981847122f},
-std::array<float,2>{0.10846623f, 0.787317574f},
-std::array<float,2>{0.821197093f, 0.582681179f},
-std::array<float,2>{0.458792567f, 0.471165746f},
-std::array<float,2>{0.991274476f, 0.266637594f},
-std::array<float,2>{0.363559365f, 0.749824107f},
-std::array<float,2>{0.643056452f, 0.916111112f},
-std::array<float,2>{0.216523021f, 0.161760345f},
-std::array<float,2>{0.804459512f, 0.0614152327f},
-std::array<float,2>{0.403938562f, 0.871396005f},
-std::array<float,2>{0.596310019f, 0.513284624f},
-std::array<float,2>{0.00883330125f, 0.423805922f},
-std::array<float,2>{0.725335777f, 0.367160261f},
-std::array<float,2>{0.136971653f, 0.686053693f},
-std::array<float,2>{0.902311504f, 0.947748125f},
-std::array<float,2>{0.26782158f, 0.237695739f},
-std::array<float,2>{0.556118727f, 0.167735904f},
-std::array<float,2>{0.0864761993f, 0.906750858f},
-std::array<float,2>{0.858275414f, 0.737202644f},
-std::array<float,2>{0.488380671f, 0.280823112f},
-std::array<float,2>{0.965396106f, 0.48189947f},
-std::array<float,2>{0.312519878f, 0.590676486f},
-std::array<float,2>{0.660498321f, 0.791056752f},
-std::array<float,2>{0.226968586f, 0.103323758f},
-std::array<float,2>{0.910226703f, 0.216776147f},
-std::array<float,2>{0.287876934f, 0.991430402f},
-std::array<float,2>{0.706726313f, 0.626585722f},
-std::array<float,2>{0.176341102f, 0.327125877f},
-std::array<float,2>{0.583783209f, 0.375269085f},
-std::array<float,2>{0.0323614255f, 0.53701967f},
-std::array<float,2>{0.761009276f, 0.830727696f},
-std::array<float,2>{0.418223649f, 0.0164458565f},
-std::array<float,2>{0.653072596f, 0.0811723992f},
-std::array<float,2>{0.207726657f, 0.76698631f},
-std::array<float,2>{0.999654412f, 0.617029369f},
-std::array<float,2>{0.372947454f, 0.447426379f},
-std::array<float,2>{0.814306319f, 0.306149453f},
-std::array<float,2>{0.461507022f, 0.714393914f},
-std::array<float,2>{0.521337748f, 0.902370572f},
-std::array<float,2>{0.100152448f, 0.133595318f},
-std::array<float,2>{0.980225623f, 0.110213839f},
-std::array<float,2>{0.355132282f, 0.803891003f},
-std::array<float,2>{0.634835899f, 0.567975938f},
-std::array<float,2>{0.201640934f, 0.48440063f},
-std::array<float,2>{0.512632489f, 0.261889815f},
-std::array<float,2>{0.118000433f, 0.730666876f},
-std::array<float,2>{0.841689289f, 0.935621083f},
-std::array<float,2>{0.451329857f, 0.186142489f},
-std::array<float,2>{0.695087612f, 0.229893923f},
-std::array<float,2>{0.157061324f, 0.964996159f},
-std::array<float,2>{0.928256512f, 0.667323411f},
-std::array<float,2>{0.302420467f, 0.357313871f},
-std::array<float,2>{0.771793962f, 0.411506742f},
-std::array<float,2>{0.435717106f, 0.531170666f},
-std::array<float,2>{0.563342094f, 0.85702914f},
-std::array<float,2>{0.0478295721f, 0.0430321209f},
-std::array<float,2>{0.873192012f, 0.149430662f},
-std::array<float,2>{0.468979031f, 0.882150471f},
-std::array<float,2>{0.533326805f, 0.693272769f},
-std::array<float,2>{0.0645408034f, 0.294359237f},
-std::array<float,2>{0.676516652f, 0.456547529f},
-std::array<float,2>{0.248439059f, 0.601468623f},
-std::array<float,2>{0.945627451f, 0.751902342f},
-std::array<float,2>{0.331390411f, 0.0696019158f},
-std::array<float,2>{0.611608267f, 0.00400600908f},
-std::array<float,2>{0.0304578543f, 0.815960884f},
-std::array<float,2>{0.787224591f, 0.55973655f},
-std::array<float,2>{0.387705714f, 0.398732126f},
-std::array<float,2>{0.888775408f, 0.329309851f},
-std::array<float,2>{0.253546029f, 0.641604781f},
-std::array<float,2>{0.737792909f, 0.984099686f},
-std::array<float,2>{0.145224795f, 0.193716675f},
-std::array<float,2>{0.779350638f, 0.106764384f},
-std::array<float,2>{0.42579335f, 0.793746531f},
-std::array<float,2>{0.577435136f, 0.589301169f},
-std::array<float,2>{0.0555554368f, 0.476778179f},
-std::array<float,2>{0.6992383f, 0.275733232f},
-std::array<float,2>{0.164918587f, 0.739248395f},
-std::array<float,2>{0.930557251f, 0.910439134f},
-std::array<float,2>{0.312356532f, 0.168260649f},
-std::array<float,2>{0.506468296f, 0.241077021f},
-std::array<float,2>{0.11083962f, 0.95114857f},
-std::array<float,2>{0.830066025f, 0.683240294f},
-std::array<float,2>{0.444739521f, 0.361204386f},
-std::array<float,2>{0.976495802f, 0.428643465f},
-std::array<float,2>{0.348910391f, 0.510985374f},
-std::array<float,2>{0.628648937f, 0.867408693f},
-std::array<float,2>{0.194233969f, 0.0552232005f},
-std::array<float,2>{0.876784563f, 0.136956692f},
-std::array<float,2>{0.264864475f, 0.899454117f},
-std::array<float,2>{0.744539142f, 0.716567993f},
-std::array<float,2>{0.149285764f, 0.31038332f},
-std::array<float,2>{0.623093247f, 0.449541897f},
-std::array<float,2>{0.0167483948f, 0.610007644f},
-std::array<float,2>{0.794464946f, 0.771361411f},
-std::array<float,2>{0.37665692f, 0.0844439641f},
-std::array<float,2>{0.68179208f, 0.022548357f},
-std::array<float,2>{0.238760903f, 0.834098816f},
-std::array<float,2>{0.94209367f, 0.534870803f},
-std::array<float,2>{0.342755079f, 0.380224526f},
-std::array<float,2>{0.859862328f, 0.323202997f},
-std::array<float,2>{0.484010845f, 0.631825507f},
-std::array<float,2>{0.54293865f, 0.987376869f},
-std::array<float,2>{0.0773031339f, 0.21469678f},
-std::array<float,2>{0.959162652f, 0.0405364446f},
-std::array<float,2>{0.327081323f, 0.854665875f},
-std::array<float,2>{0.664810121f, 0.52442956f},
-std::array<float,2>{0.221612215f, 0.409529358f},
-std::array<float,2>{0.552427053f, 0.355402231f},
-std::array<float,2>{0.083643958f, 0.669142187f},
-std::array<float,2>{0.844167233f, 0.963200986f},
-std::array<float,2>{0.497055978f, 0.231248572f},
-std::array<float,2>{0.73093462f, 0.18350485f},
-std::array<float,2>{0.126972556f, 0.93035531f},
-std::array<float,2>{0.894376993f, 0.728497744f},
-std::array<float,2>{0.280257136f, 0.261540234f},
-std::array<float,2>{0.809523046f, 0.488739789f},
-std::array<float,2>{0.391869128f, 0.56623745f},
-std::array<float,2>{0.608353257f, 0.797415197f},
-std::array<float,2>{0.00737648457f, 0.113636374f},
-std::array<float,2>{0.824801922f, 0.190564945f},
-std::array<float,2>{0.453328818f, 0.977359235f},
-std::array<float,2>{0.527128458f, 0.644969702f},
-std::array<float,2>{0.102796569f, 0.334647596f},
-std::array<float,2>{0.648163199f, 0.405632168f},
-std::array<float,2>{0.212733999f, 0.555802464f},
-std::array<float,2>{0.984865665f, 0.819057286f},
-std::array<float,2>{0.360812932f, 0.00182296336f},
-std::array<float,2>{0.587970376f, 0.0629841462f},
-std::array<float,2>{0.0424918421f, 0.755864918f},
-std::array<float,2>{0.755966961f, 0.597435594f},
-std::array<float,2>{0.408689469f, 0.457905352f},
-std::array<float,2>{0.921743214f, 0.289320529f},
-std::array<float,2>{0.291229934f, 0.689061463f},
-std::array<float,2>{0.710949302f, 0.876028001f},
-std::array<float,2>{0.186969861f, 0.15447022f},
-std::array<float,2>{0.852431595f, 0.0101077566f},
-std::array<float,2>{0.485581875f, 0.822306991f},
-std::array<float,2>{0.561394572f, 0.547640562f},
-std::array<float,2>{0.0914482102f, 0.392972708f},
-std::array<float,2>{0.658861578f, 0.337428451f},
-std::array<float,2>{0.233524352f, 0.651170969f},
-std::array<float,2>{0.964791536f, 0.97542274f},
-std::array<float,2>{0.319116026f, 0.202339917f},
-std::array<float,2>{0.600886345f, 0.143886402f},
-std::array<float,2>{0.0149628222f, 0.890106022f},
-std::array<float,2>{0.79935348f, 0.696761191f},
-std::array<float,2>{0.399985731f, 0.287402004f},
-std::array<float,2>{0.903662562f, 0.463773668f},
-std::array<float,2>{0.271410227f, 0.609152079f},
-std::array<float,2>{0.721134841f, 0.759180367f},
-std::array<float,2>{0.134513572f, 0.0754848644f},
-std::array<float,2>{0.995217323f, 0.218848318f},
-std::array<float,2>{0.369274139f, 0.959678352f},
-std::array<float,2>{0.650023878f, 0.657380104f},
-std::array<float,2>{0.205296516f, 0.348938584f},
-std::array<float,2>{0.517169833f, 0.415722847f},
-std::array<float,2>{0.0974068046f, 0.522989094f},
-std::array<float,2>{0.817790627f, 0.850531578f},
-std::array<float,2>{0.465044111f, 0.0345892347f},
-std::array<float,2>{0.709652662f, 0.124108613f},
-std::array<float,2>{0.172532097f, 0.810488939f},
-std::array<float,2>{0.90912199f, 0.576847613f},
-std::array<float,2>{0.284352124f, 0.49691695f},
-std::array<float,2>{0.764809608f, 0.253251106f},
-std::array<float,2>{0.417474777f, 0.72396487f},
-std::array<float,2>{0.58149755f, 0.928951442f},
-std::array<float,2>{0.0357827805f, 0.175039291f},
-std::array<float,2>{0.923032284f, 0.0896280333f},
-std::array<float,2>{0.300738424f, 0.779793382f},
-std::array<float,2>{0.688616693f, 0.624860227f},
-std::array<float,2>{0.160949081f, 0.437763274f},
-std::array<float,2>{0.567390621f, 0.299620301f},
-std::array<float,2>{0.0527373627f, 0.706335366f},
-std::array<float,2>{0.76761508f, 0.891920626f},
-std::array<float,2>{0.430139005f, 0.131172821f},
-std::array<float,2>{0.637455523f, 0.209124446f},
-std::array<float,2>{0.198848039f, 0.993797064f},
-std::array<float,2>{0.981313348f, 0.63833344f},
-std::array<float,2>{0.3580347f, 0.317594439f},
-std::array<float,2>{0.83607626f, 0.38913396f},
-std::array<float,2>{0.448487341f, 0.540146828f},
-std::array<float,2>{0.50827831f, 0.843645394f},
-std::array<float,2>{0.121761978f, 0.0262425281f},
-std::array<float,2>{0.784846485f, 0.156788453f},
-std::array<float,2>{0.384253621f, 0.920191467f},
-std::array<float,2>{0.616033912f, 0.745823503f},
-std::array<float,2>{0.0244878903f, 0.271073848f},
-std::array<float,2>{0.738858521f, 0.474807203f},
-std::array<float,2>{0.143904939f, 0.580710948f},
-std::array<float,2>{0.883681178f, 0.781332672f},
-std::array<float,2>{0.257094026f, 0.0964827836f},
-std::array<float,2>{0.535342276f, 0.0490066074f},
-std::array<float,2>{0.0692857951f, 0.862066746f},
-std::array<float,2>{0.867924929f, 0.50285393f},
-std::array<float,2>{0.473542422f, 0.433554053f},
-std::array<float,2>{0.952358305f, 0.368719041f},
-std::array<float,2>{0.332464516f, 0.677466035f},
-std::array<float,2>{0.67203337f, 0.940855622f},
-std::array<float,2>{0.245926157f, 0.248178869f},
-std::array<float,2>{0.865427375f, 0.119275197f},
-std::array<float,2>{0.480186135f, 0.806576669f},
-std::array<float,2>{0.543720782f, 0.571533203f},
-std::array<float,2>{0.0721522495f, 0.494398266f},
-std::array<float,2>{0.684360564f, 0.255770743f},
-std::array<float,2>{0.236475006f, 0.720288277f},
-std::array<float,2>{0.939893305f, 0.922519922f},
-std::array<float,2>{0.337073177f, 0.17901437f},
-std::array<float,2>{0.619105101f, 0.226267263f},
-std::array<float,2>{0.0211654678f, 0.954700649f},
-std::array<float,2>{0.791338921f, 0.661634505f},
-std::array<float,2>{0.382770717f, 0.346929461f},
-std::array<float,2>{0.880645216f, 0.420325935f},
-std::array<float,2>{0.259671777f, 0.516497135f},
-std::array<float,2>{0.746723652f, 0.845594347f},
-std::array<float,2>{0.156164482f, 0.0380737558f},
-std::array<float,2>{0.971980333f, 0.144821018f},
-std::array<float,2>{0.345150918f, 0.882885754f},
-std::array<float,2>{0.630877972f, 0.702348351f},
-std::array<float,2>{0.190666839f, 0.281579345f},
-std::array<float,2>{0.501165867f, 0.466637611f},
-std::array<float,2>{0.114165805f, 0.60373646f},
-std::array<float,2>{0.834712088f, 0.761775494f},
-std::array<float,2>{0.439384103f, 0.07262218f},
-std::array<float,2>{0.696780026f, 0.0134264231f},
-std::array<float,2>{0.171844959f, 0.824395835f},
-std::array<float,2>{0.934934735f, 0.552183449f},
-std::array<float,2>{0.306607485f, 0.396276176f},
-std::array<float,2>{0.77612263f, 0.343028516f},
-std::array<float,2>{0.42204538f, 0.652480721f},
-std::array<float,2>{0.573313773f, 0.970403492f},
-std::array<float,2>{0.0596528314f, 0.19863382f},
-std::array<float,2>{0.916379392f, 0.0519269444f},
-std::array<float,2>{0.293891907f, 0.865971208f},
-std::array<float,2>{0.716201305f, 0.504783809f},
-std::array<float,2>{0.180269808f, 0.43419975f},
-std::array<float,2>{0.590899587f, 0.374587297f},
-std::array<float,2>{0.0464204438f, 0.671883941f},
-std::array<float,2>{0.750151694f, 0.942655623f},
-std::array<float,2>{0.411548823f, 0.24299936f},
-std::array<float,2>{0.640694857f, 0.162869051f},
-std::array<float,2>{0.218202308f, 0.914458454f},
-std::array<float,2>{0.988696873f, 0.747456312f},
-std::array<float,2>{0.366015494f, 0.269419312f},
-std::array<float,2>{0.823231101f, 0.46927014f},
-std::array<float,2>{0.45948109f, 0.585773468f},
-std::array<float,2>{0.528891325f, 0.786599219f},
-std::array<float,2>{0.106481023f, 0.100263402f},
-std::array<float,2>{0.807001412f, 0.203521758f},
-std::array<float,2>{0.398070246f, 0.99784863f},
-std::array<float,2>{0.604224622f, 0.633169532f},
-std::array<float,2>{0.00304496684f, 0.316331387f},
-std::array<float,2>{0.728919804f, 0.385780096f},
-std::array<float,2>{0.129886657f, 0.543656468f},
-std::array<float,2>{0.895940542f, 0.835962057f},
-std::array<float,2>{0.274865776f, 0.0277574304f},
-std::array<float,2>{0.548777819f, 0.0933410972f},
-std::array<float,2>{0.0791636929f, 0.776614487f},
-std::array<float,2>{0.848401904f, 0.618345976f},
-std::array<float,2>{0.495724231f, 0.442586839f},
-std::array<float,2>{0.954780281f, 0.303863615f},
-std::array<float,2>{0.322432041f, 0.710713565f},
-std::array<float,2>{0.669648468f, 0.895710826f},
-std::array<float,2>{0.224543825f, 0.125189543f},
-std::array<float,2>{0.758557081f, 0.0190157481f},
-std::array<float,2>{0.420311928f, 0.828971565f},
-std::array<float,2>{0.584072173f, 0.538132012f},
-std::array<float,2>{0.033308994f, 0.378292412f},
-std::array<float,2>{0.704254925f, 0.32489875f},
-std::array<float,2>{0.1791161f, 0.628827035f},
-std::array<float,2>{0.913076878f, 0.989589572f},
-std::array<float,2>{0.286197394f, 0.217536524f},
-std::array<float,2>{0.523075581f, 0.13590306f},
-std::array<float,2>{0.0987724513f, 0.9061656f},
-std::array<float,2>{0.815313041f, 0.71190542f},
-std::array<float,2>{0.463644207f, 0.307361186f},
-std::array<float,2>{0.997821093f, 0.445968062f},
-std::array<float,2>{0.373822182f, 0.613414645f},
-std::array<float,2>{0.654711485f, 0.768240869f},
-std::array<float,2>{0.209494278f, 0.0798117369f},
-std::array<float,2>{0.898931205f, 0.236078382f},
-std::array<float,2>{0.266654581f, 0.946028411f},
-std::array<float,2>{0.724331617f, 0.684936225f},
-std::array<float,2>{0.138810128f, 0.363315046f},
-std::array<float,2>{0.595163584f, 0.424127787f},
-std::array<float,2>{0.0110826083f, 0.513858318f},
-std::array<float,2>{0.802541971f, 0.873212576f},
-std::array<float,2>{0.405249894f, 0.0593867488f},
-std::array<float,2>{0.663314581f, 0.10457892f},
-std::array<float,2>{0.230429113f, 0.790528476f},
-std::array<float,2>{0.968526959f, 0.592148304f},
-std::array<float,2>{0.315452695f, 0.483470112f},
-std::array<float,2>{0.856589019f, 0.277962029f},
-std::array<float,2>{0.492163211f, 0.735092342f},
-std::array<float,2>{0.558416069f, 0.909653008f},
-std::array<float,2>{0.0884646624f, 0.165997759f},
-std::array<float,2>{0.947497547f, 0.0677055046f},
-std::array<float,2>{0.329210162f, 0.753189504f},
-std::array<float,2>{0.678363681f, 0.597965777f},
-std::array<float,2>{0.247778922f, 0.454657823f},
-std::array<float,2>{0.531326354f, 0.296379954f},
-std::array<float,2>{0.063747853f, 0.693487585f},
-std::array<float,2>{0.872308016f, 0.880303204f},
-std::array<float,2>{0.471047074f, 0.151322246f},
-std::array<float,2>{0.735637188f, 0.193259567f},
-std::array<float,2>{0.146490693f, 0.98186332f},
-std::array<float,2>{0.888109982f, 0.643585682f},
-std::array<float,2>{0.250398189f, 0.330788791f},
-std::array<float,2>{0.786534965f, 0.400600433f},
-std::array<float,2>{0.390387535f, 0.560820818f},
-std::array<float,2>{0.6108796f, 0.812896848f},
-std::array<float,2>{0.0275767911f, 0.00735753076f},
-std::array<float,2>{0.843649805f, 0.184027582f},
-std::array<float,2>{0.44937399f, 0.935019612f},
-std::array<float,2>{0.515409827f, 0.734214187f},
-std::array<float,2>{0.119371563f, 0.265390605f},
-std::array<float,2>{0.634634614f, 0.487643301f},
-std::array<float,2>{0.199925929f, 0.569138944f},
-std::array<float,2>{0.977083802f, 0.801956952f},
-std::array<float,2>{0.352766067f, 0.11290165f},
-std::array<float,2>{0.564639568f, 0.046494551f},
-std::array<float,2>{0.0503785349f, 0.858901203f},
-std::array<float,2>{0.769547462f, 0.527990878f},
-std::array<float,2>{0.435061187f, 0.4125503f},
-std::array<float,2>{0.926279008f, 0.359116882f},
-std::array<float,2>{0.304197699f, 0.664993346f},
-std::array<float,2>{0.691829681f, 0.968746543f},
-std::array<float,2>{0.158539176f, 0.228203729f},
-std::array<float,2>{0.795483947f, 0.0838506296f},
-std::array<float,2>{0.378417701f, 0.771855831f},
-std::array<float,2>{0.62140727f, 0.612172723f},
-std::array<float,2>{0.0187805872f, 0.452364743f},
-std::array<float,2>{0.743117392f, 0.312162429f},
-std::array<float,2>{0.150829524f, 0.717698872f},
-std::array<float,2>{0.878885567f, 0.901953101f},
-std::array<float,2>{0.263336331f, 0.138847902f},
-std::array<float,2>{0.540808737f, 0.21219188f},
-std::array<float,2>{0.0747668743f, 0.984723449f},
-std::array<float,2>{0.863090456f, 0.630587041f},
-std::array<float,2>{0.481278121f, 0.321871042f},
-std::array<float,2>{0.944719374f, 0.381492645f},
-std::array<float,2>{0.340580225f, 0.531448603f},
-std::array<float,2>{0.680553496f, 0.8320961f},
-std::array<float,2>{0.241921797f, 0.0211265888f},
-std::array<float,2>{0.933042288f, 0.171095803f},
-std::array<float,2>{0.309910029f, 0.912641585f},
-std::array<float,2>{0.702125072f, 0.741347134f},
-std::array<float,2>{0.166180253f, 0.274599552f},
-std::array<float,2>{0.575232446f, 0.478975981f},
-std::array<float,2>{0.0583051369f, 0.586126626f},
-std::array<float,2>{0.779193521f, 0.796256721f},
-std::array<float,2>{0.429641545f, 0.108135313f},
-std::array<float,2>{0.626409888f, 0.0570046976f},
-std::array<float,2>{0.192022398f, 0.870648324f},
-std::array<float,2>{0.973150253f, 0.508137524f},
-std::array<float,2>{0.351058573f, 0.427343875f},
-std::array<float,2>{0.831393838f, 0.362567574f},
-std::array<float,2>{0.441573948f, 0.680095911f},
-std::array<float,2>{0.504207432f, 0.952006817f},
-std::array<float,2>{0.112998538f, 0.239754677f},
-std::array<float,2>{0.987924218f, 0.00252834242f},
-std::array<float,2>{0.362052619f, 0.818209589f},
-std::array<float,2>{0.645983338f, 0.557207942f},
-std::array<float,2>{0.214842662f, 0.40281406f},
-std::array<float,2>{0.525108218f, 0.33264342f},
-std::array<float,2>{0.103794903f, 0.648294568f},
-std::array<float,2>{0.826794088f, 0.978611171f},
-std::array<float,2>{0.455967009f, 0.18815726f},
-std::array<float,2>{0.713285565f, 0.152838051f},
-std::array<float,2>{0.184039533f, 0.877490699f},
-std::array<float,2>{0.918015838f, 0.689955473f},
-std::array<float,2>{0.289748937f, 0.291231662f},
-std::array<float,2>{0.754724383f, 0.459749579f},
-std::array<float,2>{0.407432854f, 0.59493053f},
-std::array<float,2>{0.586363077f, 0.753984809f},
-std::array<float,2>{0.0403741784f, 0.0658028722f},
-std::array<float,2>{0.847593367f, 0.233025461f},
-std::array<float,2>{0.498826742f, 0.96183002f},
-std::array<float,2>{0.552764177f, 0.671323001f},
-std::array<float,2>{0.0843223333f, 0.352762371f},
-std::array<float,2>{0.666289449f, 0.40711844f},
-std::array<float,2>{0.219616771f, 0.527153492f},
-std::array<float,2>{0.957581043f, 0.851871789f},
-std::array<float,2>{0.324988633f, 0.0416644588f},
-std::array<float,2>{0.607156098f, 0.116405219f},
-std::array<float,2>{0.0054293042f, 0.79929024f},
-std::array<float,2>{0.812028706f, 0.56270504f},
-std::array<float,2>{0.393439978f, 0.491365612f},
-std::array<float,2>{0.891182542f, 0.258665979f},
-std::array<float,2>{0.278314739f, 0.728897274f},
-std::array<float,2>{0.732476294f, 0.933013141f},
-std::array<float,2>{0.12629126f, 0.181594908f},
-std::array<float,2>{0.819708109f, 0.0327004679f},
-std::array<float,2>{0.468278915f, 0.84820348f},
-std::array<float,2>{0.518996835f, 0.520439327f},
-std::array<float,2>{0.0943168625f, 0.417610079f},
-std::array<float,2>{0.651527822f, 0.351155162f},
-std::array<float,2>{0.204158574f, 0.658748507f},
-std::array<float,2>{0.993020356f, 0.957449198f},
-std::array<float,2>{0.368935049f, 0.222566843f},
-std::array<float,2>{0.579343915f, 0.172378629f},
-std::array<float,2>{0.0387134217f, 0.926035225f},
-std::array<float,2>{0.762062132f, 0.724635124f},
-std::array<float,2>{0.414359421f, 0.250450134f},
-std::array<float,2>{0.907696128f, 0.499551326f},
-std::array<float,2>{0.281330884f, 0.574573755f},
-std::array<float,2>{0.707295656f, 0.812067568f},
-std::array<float,2>{0.174457088f, 0.121297069f},
-std::array<float,2>{0.962540329f, 0.199348062f},
-std::array<float,2>{0.318309158f, 0.974308252f},
-std::array<float,2>{0.656945646f, 0.648497939f},
-std::array<float,2>{0.230974257f, 0.338226616f},
-std::array<float,2>{0.560492456f, 0.392215908f},
-std::array<float,2>{0.0934436172f, 0.549947619f},
-std::array<float,2>{0.854624629f, 0.821812153f},
-std::array<float,2>{0.487631738f, 0.00808408204f},
-std::array<float,2>{0.719911516f, 0.0770685822f},
-std::array<float,2>{0.136349201f, 0.761524439f},
-std::array<float,2>{0.905777574f, 0.606990457f},
-std::array<float,2>{0.273014516f, 0.461025447f},
-std::array<float,2>{0.798455656f, 0.287008286f},
-std::array<float,2>{0.401877344f, 0.698041618f},
-std::array<float,2>{0.597805858f, 0.887105227f},
-std::array<float,2>{0.0121660298f, 0.141900972f},
-std::array<float,2>{0.886418879f, 0.0945136622f},
-std::array<float,2>{0.25566268f, 0.783824861f},
-std::array<float,2>{0.741992533f, 0.578770459f},
-std::array<float,2>{0.141462386f, 0.473890752f},
-std::array<float,2>{0.615222275f, 0.272665352f},
-std::array<float,2>{0.0265299138f, 0.742806792f},
-std::array<float,2>{0.782603502f, 0.918458045f},
-std::array<float,2>{0.384849548f, 0.158937424f},
-std::array<float,2>{0.675389707f, 0.246633619f},
-std::array<float,2>{0.24363625f, 0.938249528f},
-std::array<float,2>{0.950761855f, 0.67843461f},
-std::array<float,2>{0.335604459f, 0.370293826f},
-std::array<float,2>{0.869797349f, 0.430264652f},
-std::array<float,2>{0.474960804f, 0.501413047f},
-std::array<float,2>{0.538928747f, 0.859787643f},
-std::array<float,2>{0.0671713352f, 0.0469117314f},
-std::array<float,2>{0.766675174f, 0.12986353f},
-std::array<float,2>{0.432006031f, 0.893889368f},
-std::array<float,2>{0.568690538f, 0.703962862f},
-std::array<float,2>{0.0514284559f, 0.297511458f},
-std::array<float,2>{0.690542221f, 0.44069007f},
-std::array<float,2>{0.162616193f, 0.622369647f},
-std::array<float,2>{0.924674034f, 0.778779864f},
-std::array<float,2>{0.297047108f, 0.0860945284f},
-std::array<float,2>{0.510802329f, 0.0238929819f},
-std::array<float,2>{0.124992065f, 0.841467559f},
-std::array<float,2>{0.838909984f, 0.541198969f},
-std::array<float,2>{0.44568792f, 0.387364328f},
-std::array<float,2>{0.98385483f, 0.319525927f},
-std::array<float,2>{0.356765211f, 0.639140666f},
-std::array<float,2>{0.63883245f, 0.994238734f},
-std::array<float,2>{0.196975693f, 0.207178652f},
-std::array<float,2>{0.822222352f, 0.10094402f},
-std::array<float,2>{0.457877427f, 0.785898089f},
-std::array<float,2>{0.530855715f, 0.58430475f},
-std::array<float,2>{0.108197995f, 0.470276207f},
-std::array<float,2>{0.643897414f, 0.267586827f},
-std::array<float,2>{0.215760246f, 0.7465716f},
-std::array<float,2>{0.990764976f, 0.915801167f},
-std::array<float,2>{0.365148544f, 0.163302585f},
-std::array<float,2>{0.592159927f, 0.243243858f},
-std::array<float,2>{0.0445221886f, 0.941712677f},
-std::array<float,2>{0.75369668f, 0.672996879f},
-std::array<float,2>{0.412944019f, 0.373467416f},
-std::array<float,2>{0.914611638f, 0.43510294f},
-std::array<float,2>{0.295523375f, 0.505759358f},
-std::array<float,2>{0.718435109f, 0.866776526f},
-std::array<float,2>{0.182196558f, 0.0508487858f},
-std::array<float,2>{0.955725729f, 0.126865953f},
-std::array<float,2>{0.320682913f, 0.894929111f},
-std::array<float,2>{0.670381904f, 0.709556341f},
-std::array<float,2>{0.224931747f, 0.302771896f},
-std::array<float,2>{0.550048113f, 0.442110479f},
-std::array<float,2>{0.080369994f, 0.617954969f},
-std::array<float,2>{0.851278424f, 0.776122034f},
-std::array<float,2>{0.492966622f, 0.0924114734f},
-std::array<float,2>{0.727424264f, 0.0290686972f},
-std::array<float,2>{0.131013691f, 0.837371945f},
-std::array<float,2>{0.89781338f, 0.544473588f},
-std::array<float,2>{0.27578631f, 0.385529846f},
-std::array<float,2>{0.805050492f, 0.31479758f},
-std::array<float,2>{0.395261735f, 0.634011269f},
-std::array<float,2>{0.602982044f, 0.99647361f},
-std::array<float,2>{0.00165939354f, 0.204800546f},
-std::array<float,2>{0.88233614f, 0.0388737805f},
-std::array<float,2>{0.260231346f, 0.843952835f},
-std::array<float,2>{0.749532044f, 0.517228901f},
-std::array<float,2>{0.153867975f, 0.421257943f},
-std::array<float,2>{0.619154632f, 0.346349508f},
-std::array<float,2>{0.0231417641f, 0.660638571f},
-std::array<float,2>{0.789981186f, 0.953427494f},
-std::array<float,2>{0.379876137f, 0.225282684f},
-std::array<float,2>{0.68659246f, 0.17813848f},
-std::array<float,2>{0.234809101f, 0.923668325f},
-std::array<float,2>{0.939354718f, 0.718874931f},
-std::array<float,2>{0.337978303f, 0.254502535f},
-std::array<float,2>{0.863520026f, 0.495509535f},
-std::array<float,2>{0.4776963f, 0.571116686f},
-std::array<float,2>{0.546199858f, 0.804876268f},
-std::array<float,2>{0.0733851567f, 0.121064439f},
-std::array<float,2>{0.774115264f, 0.197753176f},
-std::array<float,2>{0.424192637f, 0.968943179f},
-std::array<float,2>{0.571402311f, 0.65384382f},
-std::array<float,2>{0.0612940416f, 0.342427582f},
-std::array<float,2>{0.698517561f, 0.395431787f},
-std::array<float,2>{0.16919601f, 0.550947487f},
-std::array<float,2>{0.936470628f, 0.826051891f},
-std::array<float,2>{0.306952f, 0.0123347379f},
-std::array<float,2>{0.502906978f, 0.0737690404f},
-std::array<float,2>{0.115853377f, 0.762908876f},
-std::array<float,2>{0.83305198f, 0.604712367f},
-std::array<float,2>{0.43960157f, 0.46565488f},
-std::array<float,2>{0.970207691f, 0.282333374f},
-std::array<float,2>{0.346098155f, 0.702000201f},
-std::array<float,2>{0.630323112f, 0.88382411f},
-std::array<float,2>{0.188723937f, 0.146135405f},
-std::array<float,2>{0.788092732f, 0.00660142861f},
-std::array<float,2>{0.387676686f, 0.814222157f},
-std::array<float,2>{0.612354636f, 0.561568916f},
-std::array<float,2>{0.0299183372f, 0.402182728f},
-std::array<float,2>{0.73654145f, 0.331683069f},
-std::array<float,2>{0.145640314f, 0.643332541f},
-std::array<float,2>{0.890044808f, 0.981362402f},
-std::array<float,2>{0.252721697f, 0.191561833f},
-std::array<float,2>{0.534838498f, 0.151612416f},
-std::array<float,2>{0.0661039948f, 0.879867613f},
-std::array<float,2>{0.874455273f, 0.695085466f},
-std::array<float,2>{0.469878167f, 0.295423239f},
-std::array<float,2>{0.947064519f, 0.453469545f},
-std::array<float,2>{0.330214262f, 0.599405706f},
-std::array<float,2>{0.676856875f, 0.752224624f},
-std::array<float,2>{0.249348074f, 0.0669011399f},
-std::array<float,2>{0.92954284f, 0.227450714f},
-std::array<float,2>{0.301230311f, 0.967391312f},
-std::array<float,2>{0.693472862f, 0.665247262f},
-std::array<float,2>{0.157727882f, 0.357958108f},
-std::array<float,2>{0.563789964f, 0.413906097f},
-std::array<float,2>{0.0481971577f, 0.528702855f},
-std::array<float,2>{0.772758007f, 0.857539296f},
-std::array<float,2>{0.436764359f, 0.0454385057f},
-std::array<float,2>{0.636229396f, 0.111548774f},
-std::array<float,2>{0.202844068f, 0.801430762f},
-std::array<float,2>{0.978940547f, 0.569766343f},
-std::array<float,2>{0.354396462f, 0.487053901f},
-std::array<float,2>{0.839877725f, 0.264066726f},
-std::array<float,2>{0.453078151f, 0.732627153f},
-std::array<float,2>{0.512712002f, 0.934143066f},
-std::array<float,2>{0.118628055f, 0.18481414f},
-std::array<float,2>{0.99896729f, 0.0784640536f},
-std::array<float,2>{0.371874809f, 0.768602848f},
-std::array<float,2>{0.653809369f, 0.614990294f},
-std::array<float,2>{0.208294675f, 0.446542084f},
-std::array<float,2>{0.519697964f, 0.308545411f},
-std::array<float,2>{0.100914128f, 0.712030411f},
-std::array<float,2>{0.813192189f, 0.904643297f},
-std::array<float,2>{0.462341696f, 0.135469615f},
-std::array<float,2>{0.705226481f, 0.217940286f},
-std::array<float,2>{0.177287728f, 0.988538563f},
-std::array<float,2>{0.911310792f, 0.627822399f},
-std::array<float,2>{0.288584262f, 0.325953782f},
-std::array<float,2>{0.760274231f, 0.377207577f},
-std::array<float,2>{0.419782281f, 0.53808558f},
-std::array<float,2>{0.582990885f, 0.829315603f},
-std::array<float,2>{0.0319093056f, 0.0177151375f},
-std::array<float,2>{0.859139442f, 0.164558291f},
-std::array<float,2>{0.490130216f, 0.908964038f},
-std::array<float,2>{0.554824769f, 0.735707104f},
-std::array<float,2>{0.0873448923f, 0.279063344f},
-std::array<float,2>{0.66131717f, 0.482514024f},
-std::array<float,2>{0.227857709f, 0.593218505f},
-std::array<float,2>{0.966021955f, 0.78934896f},
-std::array<float,2>{0.313659519f, 0.103762865f},
-std::array<float,2>{0.597218573f, 0.0603902377f},
-std::array<float,2>{0.00872629974f, 0.87461859f},
-std::array<float,2>{0.802753329f, 0.514859617f},
-std::array<float,2>{0.402963132f, 0.42483142f},
-std::array<float,2>{0.901063561f, 0.36456719f},
-std::array<float,2>{0.269468606f, 0.683758616f},
-std::array<float,2>{0.726207733f, 0.947225928f},
-std::array<float,2>{0.137760967f, 0.234380245f},
-std::array<float,2>{0.756935477f, 0.0649142787f},
-std::array<float,2>{0.409376591f, 0.755821705f},
-std::array<float,2>{0.589585066f, 0.594087303f},
-std::array<float,2>{0.0417303443f, 0.460756183f},
-std::array<float,2>{0.711962521f, 0.292415291f},
-std::array<float,2>{0.185767114f, 0.690829515f},
-std::array<float,2>{0.92052418f, 0.878377795f},
-std::array<float,2>{0.292029291f, 0.153651208f},
-std::array<float,2>{0.525645733f, 0.189096019f},
-std::array<float,2>{0.101705544f, 0.97952956f},
-std::array<float,2>{0.825873315f, 0.647451997f},
-std::array<float,2>{0.454924256f, 0.333753973f},
-std::array<float,2>{0.98590982f, 0.403467745f},
-std::array<float,2>{0.359691471f, 0.557753086f},
-std::array<float,2>{0.647128344f, 0.817093432f},
-std::array<float,2>{0.211865306f, 0.00327719841f},
-std::array<float,2>{0.892738819f, 0.180644751f},
-std::array<float,2>{0.280947149f, 0.932108939f},
-std::array<float,2>{0.732132494f, 0.730295479f},
-std::array<float,2>{0.128428996f, 0.258794695f},
-std::array<float,2>{0.608834386f, 0.490725994f},
-std::array<float,2>{0.00606139796f, 0.564119816f},
-std::array<float,2>{0.810498536f, 0.8002249f},
-std::array<float,2>{0.391284823f, 0.115834765f},
-std::array<float,2>{0.665856779f, 0.0426620916f},
-std::array<float,2>{0.222441569f, 0.85257405f},
-std::array<float,2>{0.960376263f, 0.525968492f},
-std::array<float,2>{0.327391833f, 0.407677382f},
-std::array<float,2>{0.845158935f, 0.352305532f},
-std::array<float,2>{0.497859508f, 0.670655727f},
-std::array<float,2>{0.551295578f, 0.962131798f},
-std::array<float,2>{0.0828325972f, 0.233564153f},
-std::array<float,2>{0.942958534f, 0.0196403749f},
-std::array<float,2>{0.342975855f, 0.833071887f},
-std::array<float,2>{0.683261931f, 0.53252542f},
-std::array<float,2>{0.239300832f, 0.381982952f},
-std::array<float,2>{0.541227579f, 0.32063511f},
-std::array<float,2>{0.0762948915f, 0.629762769f},
-std::array<float,2>{0.861045778f, 0.985880613f},
-std::array<float,2>{0.482712895f, 0.211212844f},
-std::array<float,2>{0.745628476f, 0.140159041f},
-std::array<float,2>{0.15034461f, 0.901364326f},
-std::array<float,2>{0.875845075f, 0.718250573f},
-std::array<float,2>{0.264201015f, 0.310708284f},
-std::array<float,2>{0.793780744f, 0.4517425f},
-std::array<float,2>{0.375757873f, 0.613105118f},
-std::array<float,2>{0.624840319f, 0.772471786f},
-std::array<float,2>{0.0163877439f, 0.0821717232f},
-std::array<float,2>{0.828863204f, 0.238803655f},
-std::array<float,2>{0.443570107f, 0.952311277f},
-std::array<float,2>{0.507316351f, 0.681178689f},
-std::array<float,2>{0.109434545f, 0.362002522f},
-std::array<float,2>{0.627453446f, 0.426269919f},
-std::array<float,2>{0.19459416f, 0.50902468f},
-std::array<float,2>{0.975552142f, 0.869575799f},
-std::array<float,2>{0.348606914f, 0.0585499778f},
-std::array<float,2>{0.576520145f, 0.109292038f},
-std::array<float,2>{0.0558689907f, 0.795271695f},
-std::array<float,2>{0.78038013f, 0.587316036f},
-std::array<float,2>{0.427590221f, 0.480211824f},
-std::array<float,2>{0.930938005f, 0.274183482f},
-std::array<float,2>{0.310962528f, 0.740897655f},
-std::array<float,2>{0.700717747f, 0.91337651f},
-std::array<float,2>{0.165595531f, 0.170897201f},
-std::array<float,2>{0.869137228f, 0.0483334363f},
-std::array<float,2>{0.473830819f, 0.8604635f},
-std::array<float,2>{0.53625977f, 0.500201225f},
-std::array<float,2>{0.0698547214f, 0.430928588f},
-std::array<float,2>{0.672960877f, 0.369526923f},
-std::array<float,2>{0.244256943f, 0.679408312f},
-std::array<float,2>{0.951775253f, 0.939068675f},
-std::array<float,2>{0.333976001f, 0.247133031f},
-std::array<float,2>{0.616340816f, 0.15948756f},
-std::array<float,2>{0.0238536727f, 0.919575334f},
-std::array<float,2>{0.78363055f, 0.744120061f},
-std::array<float,2>{0.383739352f, 0.27155149f},
-std::array<float,2>{0.884629905f, 0.473112553f},
-std::array<float,2>{0.256697744f, 0.580012858f},
-std::array<float,2>{0.739498198f, 0.784872055f},
-std::array<float,2>{0.143431619f, 0.095455721f},
-std::array<float,2>{0.981445432f, 0.208772972f},
-std::array<float,2>{0.359126925f, 0.995207965f},
-std::array<float,2>{0.638015389f, 0.640288174f},
-std::array<float,2>{0.197415352f, 0.318684936f},
-std::array<float,2>{0.508828878f, 0.388513386f},
-std::array<float,2>{0.122995757f, 0.542935312f},
-std::array<float,2>{0.837129951f, 0.840491056f},
-std::array<float,2>{0.448096544f, 0.0245509576f},
-std::array<float,2>{0.688117981f, 0.0874637589f},
-std::array<float,2>{0.161972821f, 0.777875781f},
-std::array<float,2>{0.922064126f, 0.621532381f},
-std::array<float,2>{0.299535871f, 0.439516306f},
-std::array<float,2>{0.769408464f, 0.298150063f},
-std::array<float,2>{0.431231469f, 0.704430223f},
-std::array<float,2>{0.567215145f, 0.892947257f},
-std::array<float,2>{0.0538470596f, 0.130435988f},
-std::array<float,2>{0.909791231f, 0.122966789f},
-std::array<float,2>{0.283759207f, 0.811390758f},
-std::array<float,2>{0.710568726f, 0.575832188f},
-std::array<float,2>{0.172961459f, 0.499009073f},
-std::array<float,2>{0.580598354f, 0.251220047f},
-std::array<float,2>{0.0365841314f, 0.725680649f},
-std::array<float,2>{0.764279306f, 0.927165866f},
-std::array<float,2>{0.41684249f, 0.173333004f},
-std::array<float,2>{0.648611069f, 0.220967308f},
-std::array<float,2>{0.206223145f, 0.958682835f},
-std::array<float,2>{0.994579315f, 0.659690022f},
-std::array<float,2>{0.370271683f, 0.349719286f},
-std::array<float,2>{0.81664598f, 0.416588634f},
-std::array<float,2>{0.466671526f, 0.521026373f},
-std::array<float,2>{0.516187191f, 0.849244952f},
-std::array<float,2>{0.0958236754f, 0.0315843225f},
-std::array<float,2>{0.799890816f, 0.141208276f},
-std::array<float,2>{0.398645878f, 0.888476193f},
-std::array<float,2>{0.600250542f, 0.699162006f},
-std::array<float,2>{0.0140813645f, 0.286018759f},
-std::array<float,2>{0.722448349f, 0.461931497f},
-std::array<float,2>{0.132944047f, 0.605891764f},
-std::array<float,2>{0.903252006f, 0.760598183f},
-std::array<float,2>{0.270477414f, 0.0777924806f},
-std::array<float,2>{0.561539233f, 0.00948722474f},
-std::array<float,2>{0.0904804394f, 0.820873976f},
-std::array<float,2>{0.852933288f, 0.549741566f},
-std::array<float,2>{0.484716117f, 0.39073649f},
-std::array<float,2>{0.963235855f, 0.338868052f},
-std::array<float,2>{0.319595635f, 0.650330782f},
-std::array<float,2>{0.659461617f, 0.973086774f},
-std::array<float,2>{0.23252517f, 0.200213239f},
-std::array<float,2>{0.849537134f, 0.0910727829f},
-std::array<float,2>{0.494478345f, 0.774491906f},
-std::array<float,2>{0.547101676f, 0.620399654f},
-std::array<float,2>{0.0782724321f, 0.443825543f},
-std::array<float,2>{0.668333292f, 0.301264495f},
-std::array<float,2>{0.223438576f, 0.708800912f},
-std::array<float,2>{0.95377785f, 0.897969484f},
-std::array<float,2>{0.324012995f, 0.127223685f},
-std::array<float,2>{0.60449779f, 0.206382319f},
-std::array<float,2>{0.00223050616f, 0.998867333f},
-std::array<float,2>{0.807754219f, 0.634859324f},
-std::array<float,2>{0.396922231f, 0.314039052f},
-std::array<float,2>{0.895195961f, 0.384206116f},
-std::array<float,2>{0.273877621f, 0.546754956f},
-std::array<float,2>{0.729880154f, 0.839654744f},
-std::array<float,2>{0.129622713f, 0.0300605111f},
-std::array<float,2>{0.990135014f, 0.160511419f},
-std::array<float,2>{0.366963804f, 0.91732347f},
-std::array<float,2>{0.641837478f, 0.748253703f},
-std::array<float,2>{0.21714589f, 0.265805513f},
-std::array<float,2>{0.527997911f, 0.472273171f},
-std::array<float,2>{0.10599687f, 0.583630145f},
-std::array<float,2>{0.823428452f, 0.788624346f},
-std::array<float,2>{0.460748374f, 0.0987139717f},
-std::array<float,2>{0.715772152f, 0.0546826459f},
-std::array<float,2>{0.181483194f, 0.865162253f},
-std::array<float,2>{0.917599976f, 0.507044256f},
-std::array<float,2>{0.294797719f, 0.436487377f},
-std::array<float,2>{0.75162667f, 0.371331483f},
-std::array<float,2>{0.410895824f, 0.67435509f},
-std::array<float,2>{0.589952409f, 0.944376349f},
-std::array<float,2>{0.044924058f, 0.245068103f},
-std::array<float,2>{0.934110701f, 0.0146383373f},
-std::array<float,2>{0.304974645f, 0.828089297f},
-std::array<float,2>{0.696254134f, 0.552938819f},
-std::array<float,2>{0.170807585f, 0.39748016f},
-std::array<float,2>{0.572820485f, 0.341554403f},
-std::array<float,2>{0.0590801314f, 0.655118704f},
-std::array<float,2>{0.777251482f, 0.971807897f},
-std::array<float,2>{0.423503786f, 0.196771085f},
-std::array<float,2>{0.632392406f, 0.148314118f},
-std::array<float,2>{0.189630821f, 0.885629833f},
-std::array<float,2>{0.971636951f, 0.6994102f},
-std::array<float,2>{0.343928963f, 0.28389737f},
-std::array<float,2>{0.835429072f, 0.467101395f},
-std::array<float,2>{0.437532216f, 0.602108002f},
-std::array<float,2>{0.500481129f, 0.764651895f},
-std::array<float,2>{0.114970237f, 0.0718289688f},
-std::array<float,2>{0.79257232f, 0.224534214f},
-std::array<float,2>{0.381114811f, 0.956648648f},
-std::array<float,2>{0.618016243f, 0.662768662f},
-std::array<float,2>{0.019984914f, 0.344939768f},
-std::array<float,2>{0.747687757f, 0.419606626f},
-std::array<float,2>{0.1544853f, 0.517704844f},
-std::array<float,2>{0.879818022f, 0.84620887f},
-std::array<float,2>{0.258615553f, 0.0357168019f},
-std::array<float,2>{0.544347465f, 0.118854389f},
-std::array<float,2>{0.0711470768f, 0.808509588f},
-std::array<float,2>{0.866763055f, 0.572564721f},
-std::array<float,2>{0.478823304f, 0.493438452f},
-std::array<float,2>{0.940585375f, 0.25703001f},
-std::array<float,2>{0.336883396f, 0.721485794f},
-std::array<float,2>{0.68490237f, 0.92450577f},
-std::array<float,2>{0.237565503f, 0.176445618f},
-std::array<float,2>{0.770911217f, 0.0449016578f},
-std::array<float,2>{0.433941752f, 0.855522335f},
-std::array<float,2>{0.56543529f, 0.529731393f},
-std::array<float,2>{0.0496574491f, 0.410991877f},
-std::array<float,2>{0.692626178f, 0.356028259f},
-std::array<float,2>{0.16006206f, 0.666480362f},
-std::array<float,2>{0.927582324f, 0.966676354f},
-std::array<float,2>{0.303594023f, 0.228879184f},
-std::array<float,2>{0.514212549f, 0.187152848f},
-std::array<float,2>{0.120403126f, 0.936598778f},
-std::array<float,2>{0.842503369f, 0.731783748f},
-std::array<float,2>{0.451131016f, 0.263075203f},
-std::array<float,2>{0.978121817f, 0.486016929f},
-std::array<float,2>{0.352215201f, 0.566946805f},
-std::array<float,2>{0.633205056f, 0.803451359f},
-std::array<float,2>{0.201170459f, 0.11101222f},
-std::array<float,2>{0.887554765f, 0.19468306f},
-std::array<float,2>{0.251780003f, 0.983147562f},
-std::array<float,2>{0.734656215f, 0.641046882f},
-std::array<float,2>{0.148018613f, 0.329075545f},
-std::array<float,2>{0.609630704f, 0.399732232f},
-std::array<float,2>{0.0289707091f, 0.559461653f},
-std::array<float,2>{0.786018908f, 0.815284967f},
-std::array<float,2>{0.389034212f, 0.00522035267f},
-std::array<float,2>{0.679459512f, 0.0686363801f},
-std::array<float,2>{0.246411115f, 0.750240684f},
-std::array<float,2>{0.949155867f, 0.600442231f},
-std::array<float,2>{0.328316391f, 0.455363095f},
-std::array<float,2>{0.87109834f, 0.29389286f},
-std::array<float,2>{0.472125769f, 0.69144547f},
-std::array<float,2>{0.532893062f, 0.881177962f},
-std::array<float,2>{0.0629083067f, 0.148861483f},
-std::array<float,2>{0.967496693f, 0.10235548f},
-std::array<float,2>{0.315141857f, 0.792822778f},
-std::array<float,2>{0.662182689f, 0.591521919f},
-std::array<float,2>{0.228626639f, 0.480795085f},
-std::array<float,2>{0.556907833f, 0.27986142f},
-std::array<float,2>{0.0894112885f, 0.737671554f},
-std::array<float,2>{0.856220603f, 0.907633126f},
-std::array<float,2>{0.490914106f, 0.166029304f},
-std::array<float,2>{0.723555446f, 0.236704886f},
-std::array<float,2>{0.13970609f, 0.948860645f},
-std::array<float,2>{0.899771392f, 0.687439442f},
-std::array<float,2>{0.265807629f, 0.365358144f},
-std::array<float,2>{0.8016361f, 0.422607213f},
-std::array<float,2>{0.40602538f, 0.512435973f},
-std::array<float,2>{0.594070673f, 0.87239635f},
-std::array<float,2>{0.0102447895f, 0.0622652136f},
-std::array<float,2>{0.816169679f, 0.134099901f},
-std::array<float,2>{0.464713544f, 0.904222965f},
-std::array<float,2>{0.522356033f, 0.713793278f},
-std::array<float,2>{0.0979355499f, 0.305491835f},
-std::array<float,2>{0.655908823f, 0.448514789f},
-std::array<float,2>{0.210750833f, 0.615660727f},
-std::array<float,2>{0.996306658f, 0.765745044f},
-std::array<float,2>{0.374031693f, 0.0802815184f},
-std::array<float,2>{0.585675955f, 0.0168533102f},
-std::array<float,2>{0.0342586674f, 0.831495225f},
-std::array<float,2>{0.759757459f, 0.535422862f},
-std::array<float,2>{0.421717942f, 0.376722306f},
-std::array<float,2>{0.913456619f, 0.328027606f},
-std::array<float,2>{0.285719395f, 0.625243545f},
-std::array<float,2>{0.703705847f, 0.990385652f},
-std::array<float,2>{0.177830264f, 0.215733767f},
-std::array<float,2>{0.810846686f, 0.114452392f},
-std::array<float,2>{0.394236952f, 0.798431575f},
-std::array<float,2>{0.606125355f, 0.564907491f},
-std::array<float,2>{0.00443151686f, 0.490172625f},
-std::array<float,2>{0.734330416f, 0.260236025f},
-std::array<float,2>{0.125876248f, 0.726881683f},
-std::array<float,2>{0.891688287f, 0.930826783f},
-std::array<float,2>{0.278428704f, 0.181704804f},
-std::array<float,2>{0.554306149f, 0.232219771f},
-std::array<float,2>{0.0851483718f, 0.964176238f},
-std::array<float,2>{0.845856667f, 0.668077648f},
-std::array<float,2>{0.499090225f, 0.354470223f},
-std::array<float,2>{0.958064497f, 0.408320189f},
-std::array<float,2>{0.325950533f, 0.524118602f},
-std::array<float,2>{0.667314827f, 0.854254067f},
-std::array<float,2>{0.220024154f, 0.0391741805f},
-std::array<float,2>{0.919839442f, 0.155509904f},
-std::array<float,2>{0.290180504f, 0.875743806f},
-std::array<float,2>{0.714377284f, 0.687927246f},
-std::array<float,2>{0.184900761f, 0.290819049f},
-std::array<float,2>{0.58769393f, 0.458624035f},
-std::array<float,2>{0.0396421589f, 0.595948219f},
-std::array<float,2>{0.755258024f, 0.757568419f},
-std::array<float,2>{0.406332403f, 0.0643539652f},
-std::array<float,2>{0.644816518f, 0.000783027441f},
-std::array<float,2>{0.213528037f, 0.81948638f},
-std::array<float,2>{0.986775935f, 0.554800868f},
-std::array<float,2>{0.362893641f, 0.404797554f},
-std::array<float,2>{0.827163756f, 0.335877061f},
-std::array<float,2>{0.4560754f, 0.645645142f},
-std::array<float,2>{0.523701966f, 0.977987289f},
-std::array<float,2>{0.10465689f, 0.190318376f},
-std::array<float,2>{0.974131942f, 0.056402415f},
-std::array<float,2>{0.349682659f, 0.868972242f},
-std::array<float,2>{0.625870287f, 0.510315418f},
-std::array<float,2>{0.193016559f, 0.428811997f},
-std::array<float,2>{0.505644083f, 0.359750688f},
-std::array<float,2>{0.111948781f, 0.682610571f},
-std::array<float,2>{0.830587864f, 0.949435771f},
-std::array<float,2>{0.442815542f, 0.241229504f},
-std::array<float,2>{0.70247215f, 0.169270813f},
-std::array<float,2>{0.167156756f, 0.911858141f},
-std::array<float,2>{0.931800067f, 0.739293039f},
-std::array<float,2>{0.308986783f, 0.276939064f},
-std::array<float,2>{0.777639151f, 0.477715194f},
-std::array<float,2>{0.427829087f, 0.588181555f},
-std::array<float,2>{0.574846029f, 0.794190586f},
-std::array<float,2>{0.0573460795f, 0.105796769f},
-std::array<float,2>{0.861410618f, 0.21342735f},
-std::array<float,2>{0.481975794f, 0.987129748f},
-std::array<float,2>{0.53922236f, 0.632770538f},
-std::array<float,2>{0.0755902082f, 0.324133873f},
-std::array<float,2>{0.680969417f, 0.379116148f},
-std::array<float,2>{0.241082996f, 0.534176111f},
-std::array<float,2>{0.944211245f, 0.835369825f},
-std::array<float,2>{0.341596842f, 0.0218993202f},
-std::array<float,2>{0.622669935f, 0.0852045789f},
-std::array<float,2>{0.0184162781f, 0.770016551f},
-std::array<float,2>{0.796644986f, 0.611045539f},
-std::array<float,2>{0.377590299f, 0.450557709f},
-std::array<float,2>{0.877726555f, 0.308940023f},
-std::array<float,2>{0.261983514f, 0.714930415f},
-std::array<float,2>{0.74413681f, 0.898554385f},
-std::array<float,2>{0.151425868f, 0.137758672f},
-std::array<float,2>{0.83858794f, 0.0264430922f},
-std::array<float,2>{0.447259337f, 0.842626214f},
-std::array<float,2>{0.510415792f, 0.539140582f},
-std::array<float,2>{0.123286515f, 0.389858603f},
-std::array<float,2>{0.639892578f, 0.316703171f},
-std::array<float,2>{0.195382103f, 0.637161493f},
-std::array<float,2>{0.982575715f, 0.992346466f},
-std::array<float,2>{0.356120139f, 0.210421577f},
-std::array<float,2>{0.569429636f, 0.132417664f},
-std::array<float,2>{0.0522649102f, 0.891006231f},
-std::array<float,2>{0.766060054f, 0.705211341f},
-std::array<float,2>{0.432777017f, 0.299944133f},
-std::array<float,2>{0.925471187f, 0.438752055f},
-std::array<float,2>{0.298184484f, 0.62397784f},
-std::array<float,2>{0.690047562f, 0.78081584f},
-std::array<float,2>{0.163729787f, 0.0881542638f},
-std::array<float,2>{0.949454486f, 0.249046579f},
-std::array<float,2>{0.334945798f, 0.939573824f},
-std::array<float,2>{0.673952818f, 0.676373243f},
-std::array<float,2>{0.243101001f, 0.368085802f},
-std::array<float,2>{0.538028777f, 0.432463765f},
-std::array<float,2>{0.067998223f, 0.503566027f},
-std::array<float,2>{0.870836496f, 0.862913072f},
-std::array<float,2>{0.476072073f, 0.0506545901f},
-std::array<float,2>{0.740368426f, 0.097421363f},
-std::array<float,2>{0.142261282f, 0.782587051f},
-std::array<float,2>{0.885332346f, 0.582006693f},
-std::array<float,2>{0.254039407f, 0.475613147f},
-std::array<float,2>{0.781605482f, 0.270504355f},
-std::array<float,2>{0.385811418f, 0.744973123f},
-std::array<float,2>{0.613507748f, 0.921234071f},
-std::array<float,2>{0.0262161698f, 0.157680109f},
-std::array<float,2>{0.904367507f, 0.0742802098f},
-std::array<float,2>{0.271646321f, 0.75798136f},
-std::array<float,2>{0.719441891f, 0.607740521f},
-std::array<float,2>{0.135725141f, 0.464678526f},
-std::array<float,2>{0.599111855f, 0.288709581f},
-std::array<float,2>{0.0132674258f, 0.695921421f},
-std::array<float,2>{0.796878219f, 0.888812542f},
-std::array<float,2>{0.401008248f, 0.14306426f},
-std::array<float,2>{0.657644093f, 0.201936379f},
-std::array<float,2>{0.23159726f, 0.975915194f},
-std::array<float,2>{0.961565018f, 0.652279854f},
-std::array<float,2>{0.317075759f, 0.336004764f},
-std::array<float,2>{0.853615105f, 0.393717766f},
-std::array<float,2>{0.48678574f, 0.548334479f},
-std::array<float,2>{0.558755279f, 0.823510528f},
-std::array<float,2>{0.0918137208f, 0.0109404847f},
-std::array<float,2>{0.763591707f, 0.174089774f},
-std::array<float,2>{0.415312856f, 0.928696632f},
-std::array<float,2>{0.578657746f, 0.722884536f},
-std::array<float,2>{0.0374977663f, 0.252409488f},
-std::array<float,2>{0.708530784f, 0.497806072f},
-std::array<float,2>{0.174975038f, 0.577845514f},
-std::array<float,2>{0.90691787f, 0.80859977f},
-std::array<float,2>{0.282870293f, 0.123476245f},
-std::array<float,2>{0.518390059f, 0.0332854055f},
-std::array<float,2>{0.0950088426f, 0.851110041f},
-std::array<float,2>{0.81866163f, 0.521529198f},
-std::array<float,2>{0.467678368f, 0.414749056f},
-std::array<float,2>{0.99340874f, 0.34821552f},
-std::array<float,2>{0.368080437f, 0.656280518f},
-std::array<float,2>{0.650662303f, 0.960344791f},
-std::array<float,2>{0.203524739f, 0.219730899f},
-std::array<float,2>{0.81262368f, 0.0807501897f},
-std::array<float,2>{0.462629646f, 0.766130984f},
-std::array<float,2>{0.520049095f, 0.616001368f},
-std::array<float,2>{0.10113357f, 0.448865741f},
-std::array<float,2>{0.653392851f, 0.304754853f},
-std::array<float,2>{0.208852947f, 0.71310544f},
-std::array<float,2>{0.998109102f, 0.903328419f},
-std::array<float,2>{0.371213049f, 0.134375021f},
-std::array<float,2>{0.582107961f, 0.215116918f},
-std::array<float,2>{0.0315675586f, 0.991008818f},
-std::array<float,2>{0.759955645f, 0.625514388f},
-std::array<float,2>{0.419104785f, 0.327589989f},
-std::array<float,2>{0.911894441f, 0.376363367f},
-std::array<float,2>{0.288349777f, 0.53570354f},
-std::array<float,2>{0.706027448f, 0.831965864f},
-std::array<float,2>{0.177200049f, 0.0172071494f},
-std::array<float,2>{0.966793537f, 0.166605234f},
-std::array<float,2>{0.313976675f, 0.90782702f},
-std::array<float,2>{0.661832035f, 0.737811983f},
-std::array<float,2>{0.228507072f, 0.279378742f},
-std::array<float,2>{0.555523515f, 0.481386065f},
-std::array<float,2>{0.0874156281f, 0.590845525f},
-std::array<float,2>{0.85865289f, 0.792333722f},
-std::array<float,2>{0.489600658f, 0.101620756f},
-std::array<float,2>{0.725993454f, 0.0616775192f},
-std::array<float,2>{0.138530433f, 0.872868896f},
-std::array<float,2>{0.900553167f, 0.512085795f},
-std::array<float,2>{0.268711269f, 0.422269821f},
-std::array<float,2>{0.803245366f, 0.36602807f},
-std::array<float,2>{0.402377009f, 0.686847091f},
-std::array<float,2>{0.597003102f, 0.948426068f},
-std::array<float,2>{0.00799601246f, 0.237120926f},
-std::array<float,2>{0.890378654f, 0.00541564915f},
-std::array<float,2>{0.252236247f, 0.814874232f},
-std::array<float,2>{0.736827493f, 0.558596134f},
-std::array<float,2>{0.146028623f, 0.400003284f},
-std::array<float,2>{0.613076448f, 0.328256994f},
-std::array<float,2>{0.0297837555f, 0.641115904f},
-std::array<float,2>{0.788766384f, 0.982785106f},
-std::array<float,2>{0.387118697f, 0.195122823f},
-std::array<float,2>{0.67737335f, 0.149279371f},
-std::array<float,2>{0.249547243f, 0.881723404f},
-std::array<float,2>{0.946383655f, 0.692065597f},
-std::array<float,2>{0.330882579f, 0.29338336f},
-std::array<float,2>{0.874823034f, 0.456002474f},
-std::array<float,2>{0.470695674f, 0.599816799f},
-std::array<float,2>{0.53437072f, 0.750833571f},
-std::array<float,2>{0.0655461401f, 0.0691199452f},
-std::array<float,2>{0.773076177f, 0.22948131f},
-std::array<float,2>{0.437425792f, 0.96622014f},
-std::array<float,2>{0.564103723f, 0.666610599f},
-std::array<float,2>{0.0483721383f, 0.355821192f},
-std::array<float,2>{0.693907917f, 0.410465509f},
-std::array<float,2>{0.15735887f, 0.529963017f},
-std::array<float,2>{0.929143786f, 0.856376767f},
-std::array<float,2>{0.301461428f, 0.0441516005f},
-std::array<float,2>{0.513491392f, 0.110602871f},
-std::array<float,2>{0.118914172f, 0.803057134f},
-std::array<float,2>{0.840454102f, 0.566727161f},
-std::array<float,2>{0.452270359f, 0.485425979f},
-std::array<float,2>{0.979180813f, 0.263251841f},
-std::array<float,2>{0.3536475f, 0.732283354f},
-std::array<float,2>{0.63650763f, 0.93701452f},
-std::array<float,2>{0.202318653f, 0.18664901f},
-std::array<float,2>{0.789316833f, 0.0353395082f},
-std::array<float,2>{0.378954083f, 0.845984161f},
-std::array<float,2>{0.620065928f, 0.518244743f},
-std::array<float,2>{0.0225195754f, 0.419139534f},
-std::array<float,2>{0.749294102f, 0.345297396f},
-std::array<float,2>{0.153364241f, 0.662547112f},
-std::array<float,2>{0.882107556f, 0.956373155f},
-std::array<float,2>{0.260442466f, 0.223743454f},
-std::array<float,2>{0.546779454f, 0.176248536f},
-std::array<float,2>{0.0739910379f, 0.924093604f},
-std::array<float,2>{0.863930821f, 0.720802784f},
-std::array<float,2>{0.47831136f, 0.257709801f},
-std::array<float,2>{0.938538134f, 0.493869364f},
-std::array<float,2>{0.338767856f, 0.572817385f},
-std::array<float,2>{0.687461257f, 0.807976484f},
-std::array<float,2>{0.235301763f, 0.118447416f},
-std::array<float,2>{0.935831606f, 0.196989164f},
-std::array<float,2>{0.307283193f, 0.972508848f},
-std::array<float,2>{0.699150503f, 0.654539227f},
-std::array<float,2>{0.169910073f, 0.340920389f},
-std::array<float,2>{0.572217643f, 0.398044527f},
-std::array<float,2>{0.060973499f, 0.553338289f},
-std::array<float,2>{0.773519278f, 0.827507317f},
-std::array<float,2>{0.424648076f, 0.0138683179f},
-std::array<float,2>{0.630720019f, 0.071325466f},
-std::array<float,2>{0.189064503f, 0.765339255f},
-std::array<float,2>{0.970256269f, 0.601909995f},
-std::array<float,2>{0.346359223f, 0.467588305f},
-std::array<float,2>{0.833845794f, 0.28354156f},
-std::array<float,2>{0.439954787f, 0.699964106f},
-std::array<float,2>{0.502374232f, 0.885059595f},
-std::array<float,2>{0.115499288f, 0.147478983f},
-std::array<float,2>{0.990420878f, 0.0994538814f},
-std::array<float,2>{0.364335984f, 0.788401067f},
-std::array<float,2>{0.644077241f, 0.583141744f},
-std::array<float,2>{0.214928403f, 0.471912444f},
-std::array<float,2>{0.530567706f, 0.266221136f},
-std::array<float,2>{0.10786967f, 0.748951852f},
-std::array<float,2>{0.8213166f, 0.917924047f},
-std::array<float,2>{0.457509845f, 0.160795376f},
-std::array<float,2>{0.718245983f, 0.244432226f},
-std::array<float,2>{0.181821436f, 0.94530952f},
-std::array<float,2>{0.914112151f, 0.67402637f},
-std::array<float,2>{0.295135289f, 0.371803254f},
-std::array<float,2>{0.753367603f, 0.435650498f},
-std::array<float,2>{0.412464261f, 0.507716894f},
-std::array<float,2>{0.592479527f, 0.864522994f},
-std::array<float,2>{0.0443190783f, 0.0540315807f},
-std::array<float,2>{0.850719333f, 0.127689689f},
-std::array<float,2>{0.492568672f, 0.897872329f},
-std::array<float,2>{0.550676763f, 0.708192885f},
-std::array<float,2>{0.080978021f, 0.30155459f},
-std::array<float,2>{0.670559824f, 0.444261044f},
-std::array<float,2>{0.225214019f, 0.621056736f},
-std::array<float,2>{0.955110133f, 0.775308728f},
-std::array<float,2>{0.321064174f, 0.0917966589f},
-std::array<float,2>{0.603273273f, 0.0297327228f},
-std::array<float,2>{0.00133955409f, 0.838990867f},
-std::array<float,2>{0.805641353f, 0.546118438f},
-std::array<float,2>{0.394990742f, 0.38446936f},
-std::array<float,2>{0.898301721f, 0.313498229f},
-std::array<float,2>{0.276051641f, 0.635439217f},
-std::array<float,2>{0.726983547f, 0.998247981f},
-std::array<float,2>{0.131444812f, 0.206575796f},
-std::array<float,2>{0.763936758f, 0.123820506f},
-std::array<float,2>{0.416460842f, 0.809221327f},
-std::array<float,2>{0.580214024f, 0.577151239f},
-std::array<float,2>{0.0366933048f, 0.497197986f},
-std::array<float,2>{0.710288823f, 0.252689213f},
-std::array<float,2>{0.173627853f, 0.723547995f},
-std::array<float,2>{0.909405828f, 0.927794158f},
-std::array<float,2>{0.283315331f, 0.174508393f},
-std::array<float,2>{0.515853345f, 0.220479876f},
-std::array<float,2>{0.0962063894f, 0.96069032f},
-std::array<float,2>{0.817005575f, 0.657048523f},
-std::array<float,2>{0.465835035f, 0.347827941f},
-std::array<float,2>{0.994735122f, 0.414316595f},
-std::array<float,2>{0.370816231f, 0.522164106f},
-std::array<float,2>{0.649279773f, 0.8509444f},
-std::array<float,2>{0.206775919f, 0.0341626741f},
-std::array<float,2>{0.902558446f, 0.143273026f},
-std::array<float,2>{0.269542128f, 0.889496088f},
-std::array<float,2>{0.721794963f, 0.69565177f},
-std::array<float,2>{0.133377925f, 0.288537979f},
-std::array<float,2>{0.599706292f, 0.464306295f},
-std::array<float,2>{0.0143432673f, 0.608179092f},
-std::array<float,2>{0.800589859f, 0.758781075f},
-std::array<float,2>{0.399298847f, 0.0751797408f},
-std::array<float,2>{0.660111368f, 0.0114533259f},
-std::array<float,2>{0.233256176f, 0.824130654f},
-std::array<float,2>{0.963589787f, 0.548530102f},
-std::array<float,2>{0.320120633f, 0.394301534f},
-std::array<float,2>{0.853184402f, 0.336442769f},
-std::array<float,2>{0.485273898f, 0.651744008f},
-std::array<float,2>{0.562253594f, 0.976181269f},
-std::array<float,2>{0.0899796337f, 0.201266214f},
-std::array<float,2>{0.951487005f, 0.0501670688f},
-std::array<float,2>{0.333025813f, 0.862634242f},
-std::array<float,2>{0.673617125f, 0.503163338f},
-std::array<float,2>{0.244995192f, 0.431724727f},
-std::array<float,2>{0.536922753f, 0.367309153f},
-std::array<float,2>{0.0694071427f, 0.676034033f},
-std::array<float,2>{0.868209481f, 0.940114141f},
-std::array<float,2>{0.474609077f, 0.249661639f},
-std::array<float,2>{0.740077019f, 0.157783911f},
-std::array<float,2>{0.142778873f, 0.921479285f},
-std::array<float,2>{0.884166658f, 0.744536281f},
-std::array<float,2>{0.255888611f, 0.269794881f},
-std::array<float,2>{0.783776581f, 0.476312637f},
-std::array<float,2>{0.38327992f, 0.581486821f},
-std::array<float,2>{0.617127955f, 0.783195257f},
-std::array<float,2>{0.0242003314f, 0.0968188569f},
-std::array<float,2>{0.837731123f, 0.210576624f},
-std::array<float,2>{0.447427303f, 0.992750585f},
-std::array<float,2>{0.509705603f, 0.637324333f},
-std::array<float,2>{0.122523896f, 0.317238688f},
-std::array<float,2>{0.638207734f, 0.390472531f},
-std::array<float,2>{0.198232085f, 0.539830148f},
-std::array<float,2>{0.982266247f, 0.842250288f},
-std::array<float,2>{0.358756959f, 0.0272942614f},
-std::array<float,2>{0.566564322f, 0.0886844844f},
-std::array<float,2>{0.0545563735f, 0.780516684f},
-std::array<float,2>{0.768874943f, 0.623403013f},
-std::array<float,2>{0.430959761f, 0.438991189f},
-std::array<float,2>{0.922715485f, 0.300477028f},
-std::array<float,2>{0.298885852f, 0.705759704f},
-std::array<float,2>{0.687520504f, 0.891114414f},
-std::array<float,2>{0.16158919f, 0.132219076f},
-std::array<float,2>{0.860480607f, 0.0220707878f},
-std::array<float,2>{0.483373016f, 0.835623622f},
-std::array<float,2>{0.541921496f, 0.533466816f},
-std::array<float,2>{0.0770839453f, 0.379559219f},
-std::array<float,2>{0.6829741f, 0.323348671f},
-std::array<float,2>{0.240227699f, 0.632127285f},
-std::array<float,2>{0.942682922f, 0.98665756f},
-std::array<float,2>{0.34333393f, 0.213145882f},
-std::array<float,2>{0.624045134f, 0.138281658f},
-std::array<float,2>{0.0158234015f, 0.898948848f},
-std::array<float,2>{0.793183744f, 0.715792f},
-std::array<float,2>{0.375087082f, 0.309436381f},
-std::array<float,2>{0.8751508f, 0.450757921f},
-std::array<float,2>{0.263706893f, 0.610454977f},
-std::array<float,2>{0.745191157f, 0.770190001f},
-std::array<float,2>{0.149660081f, 0.0858112574f},
-std::array<float,2>{0.975071669f, 0.241881996f},
-std::array<float,2>{0.347777516f, 0.949986219f},
-std::array<float,2>{0.627225637f, 0.682037413f},
-std::array<float,2>{0.194891259f, 0.35991773f},
-std::array<float,2>{0.507626295f, 0.429380357f},
-std::array<float,2>{0.109986238f, 0.510082185f},
-std::array<float,2>{0.82829535f, 0.868345141f},
-std::array<float,2>{0.443864077f, 0.0559318326f},
-std::array<float,2>{0.700516403f, 0.106129862f},
-std::array<float,2>{0.165087342f, 0.794661999f},
-std::array<float,2>{0.931467175f, 0.588814557f},
-std::array<float,2>{0.31127575f, 0.478150457f},
-std::array<float,2>{0.780829847f, 0.276657194f},
-std::array<float,2>{0.427236915f, 0.739865005f},
-std::array<float,2>{0.577083886f, 0.911332786f},
-std::array<float,2>{0.0565787926f, 0.169811189f},
-std::array<float,2>{0.919964552f, 0.0636431128f},
-std::array<float,2>{0.2926552f, 0.756942689f},
-std::array<float,2>{0.712594628f, 0.59645623f},
-std::array<float,2>{0.186201453f, 0.458256811f},
-std::array<float,2>{0.589298606f, 0.290096462f},
-std::array<float,2>{0.0414720476f, 0.688107967f},
-std::array<float,2>{0.757563055f, 0.875225067f},
-std::array<float,2>{0.409970462f, 0.156123906f},
-std::array<float,2>{0.646729171f, 0.189518705f},
-std::array<float,2>{0.211081341f, 0.978087783f},
-std::array<float,2>{0.985411584f, 0.646187901f},
-std::array<float,2>{0.360158026f, 0.335016131f},
-std::array<float,2>{0.825289786f, 0.404366821f},
-std::array<float,2>{0.454304218f, 0.555384576f},
-std::array<float,2>{0.525978744f, 0.819982111f},
-std::array<float,2>{0.102060199f, 2.27724358e-05f},
-std::array<float,2>{0.809616923f, 0.182276815f},
-std::array<float,2>{0.390846133f, 0.931587398f},
-std::array<float,2>{0.608956456f, 0.727515042f},
-std::array<float,2>{0.00640885765f, 0.260422617f},
-std::array<float,2>{0.731650889f, 0.489294827f},
-std::array<float,2>{0.128203139f, 0.565341234f},
-std::array<float,2>{0.893106639f, 0.797980845f},
-std::array<float,2>{0.280518562f, 0.114824958f},
-std::array<float,2>{0.551005483f, 0.0399349891f},
-std::array<float,2>{0.0823597088f, 0.85395205f},
-std::array<float,2>{0.84553802f, 0.523922026f},
-std::array<float,2>{0.497172773f, 0.408919126f},
-std::array<float,2>{0.960594177f, 0.353796154f},
-std::array<float,2>{0.327777654f, 0.668468058f},
-std::array<float,2>{0.665412188f, 0.964502335f},
-std::array<float,2>{0.222164884f, 0.231922328f},
-std::array<float,2>{0.855930686f, 0.104045548f},
-std::array<float,2>{0.490362972f, 0.789786935f},
-std::array<float,2>{0.55713284f, 0.593277276f},
-std::array<float,2>{0.0889717788f, 0.482976675f},
-std::array<float,2>{0.662769318f, 0.278716564f},
-std::array<float,2>{0.229426086f, 0.736263752f},
-std::array<float,2>{0.966811359f, 0.908244014f},
-std::array<float,2>{0.31475845f, 0.164243862f},
-std::array<float,2>{0.594588518f, 0.235338941f},
-std::array<float,2>{0.0104921013f, 0.946763456f},
-std::array<float,2>{0.800806403f, 0.68445605f},
-std::array<float,2>{0.405278534f, 0.36514917f},
-std::array<float,2>{0.900190353f, 0.425485492f},
-std::array<float,2>{0.266320467f, 0.515249312f},
-std::array<float,2>{0.722818553f, 0.87414515f},
-std::array<float,2>{0.140531704f, 0.0598730259f},
-std::array<float,2>{0.996721923f, 0.135229468f},
-std::array<float,2>{0.374861926f, 0.905250251f},
-std::array<float,2>{0.655490935f, 0.712402403f},
-std::array<float,2>{0.210043475f, 0.307896286f},
-std::array<float,2>{0.521533012f, 0.44700855f},
-std::array<float,2>{0.0981847718f, 0.614656091f},
-std::array<float,2>{0.815670252f, 0.769353569f},
-std::array<float,2>{0.463912308f, 0.0789857656f},
-std::array<float,2>{0.703304708f, 0.0182442404f},
-std::array<float,2>{0.178398952f, 0.829866529f},
-std::array<float,2>{0.913678646f, 0.537284434f},
-std::array<float,2>{0.285384893f, 0.377569348f},
-std::array<float,2>{0.759204209f, 0.325412005f},
-std::array<float,2>{0.420916438f, 0.627118051f},
-std::array<float,2>{0.585381985f, 0.989032388f},
-std::array<float,2>{0.0350648798f, 0.21839121f},
-std::array<float,2>{0.927068949f, 0.0451633558f},
-std::array<float,2>{0.302785158f, 0.857957304f},
-std::array<float,2>{0.693224728f, 0.529092491f},
-std::array<float,2>{0.159380153f, 0.41322884f},
-std::array<float,2>{0.566044271f, 0.357570261f},
-std::array<float,2>{0.0492273904f, 0.665628135f},
-std::array<float,2>{0.771364033f, 0.966808975f},
-std::array<float,2>{0.434385926f, 0.226816475f},
-std::array<float,2>{0.633714378f, 0.18507424f},
-std::array<float,2>{0.200321615f, 0.933629036f},
-std::array<float,2>{0.977946401f, 0.733264208f},
-std::array<float,2>{0.351844579f, 0.26420179f},
-std::array<float,2>{0.842258811f, 0.48639819f},
-std::array<float,2>{0.450401604f, 0.569878161f},
-std::array<float,2>{0.513928115f, 0.800968468f},
-std::array<float,2>{0.120751128f, 0.112139545f},
-std::array<float,2>{0.785376012f, 0.191901147f},
-std::array<float,2>{0.389468074f, 0.980852664f},
-std::array<float,2>{0.609922767f, 0.642826915f},
-std::array<float,2>{0.0286531895f, 0.331369251f},
-std::array<float,2>{0.734922409f, 0.401746392f},
-std::array<float,2>{0.147846773f, 0.562111378f},
-std::array<float,2>{0.886990309f, 0.813546181f},
-std::array<float,2>{0.251405716f, 0.006254117f},
-std::array<float,2>{0.532345176f, 0.0667142645f},
-std::array<float,2>{0.0632539093f, 0.752691329f},
-std::array<float,2>{0.871781766f, 0.59894073f},
-std::array<float,2>{0.47223711f, 0.453876972f},
-std::array<float,2>{0.948693931f, 0.294937462f},
-std::array<float,2>{0.328740418f, 0.694551945f},
-std::array<float,2>{0.678870976f, 0.879013717f},
-std::array<float,2>{0.246696591f, 0.152207121f},
-std::array<float,2>{0.776821554f, 0.0117596686f},
-std::array<float,2>{0.423096985f, 0.825626671f},
-std::array<float,2>{0.572537065f, 0.5513134f},
-std::array<float,2>{0.0594082214f, 0.394646615f},
-std::array<float,2>{0.695594788f, 0.342139721f},
-std::array<float,2>{0.170262322f, 0.65339905f},
-std::array<float,2>{0.933922231f, 0.969416201f},
-std::array<float,2>{0.305470228f, 0.197904423f},
-std::array<float,2>{0.500687897f, 0.145930454f},
-std::array<float,2>{0.11434339f, 0.884593368f},
-std::array<float,2>{0.835548103f, 0.701229811f},
-std::array<float,2>{0.438323915f, 0.282975465f},
-std::array<float,2>{0.970743597f, 0.465229183f},
-std::array<float,2>{0.344355017f, 0.605264843f},
-std::array<float,2>{0.631970167f, 0.763546824f},
-std::array<float,2>{0.190332964f, 0.073711291f},
-std::array<float,2>{0.878941655f, 0.22482051f},
-std::array<float,2>{0.257911921f, 0.953898907f},
-std::array<float,2>{0.747168362f, 0.661097646f},
-std::array<float,2>{0.155094147f, 0.346131057f},
-std::array<float,2>{0.617635369f, 0.421788305f},
-std::array<float,2>{0.0200717319f, 0.516820014f},
-std::array<float,2>{0.792402744f, 0.844582379f},
-std::array<float,2>{0.381737798f, 0.0382935442f},
-std::array<float,2>{0.685394168f, 0.120193668f},
-std::array<float,2>{0.238038242f, 0.805452287f},
-std::array<float,2>{0.941338956f, 0.570413589f},
-std::array<float,2>{0.336168319f, 0.495614767f},
-std::array<float,2>{0.86656332f, 0.254327476f},
-std::array<float,2>{0.479248524f, 0.719260573f},
-std::array<float,2>{0.544544458f, 0.923211873f},
-std::array<float,2>{0.0707804635f, 0.178531602f},
-std::array<float,2>{0.953488111f, 0.0921528637f},
-std::array<float,2>{0.323283225f, 0.775450468f},
-std::array<float,2>{0.668801963f, 0.617598414f},
-std::array<float,2>{0.222708821f, 0.441774905f},
-std::array<float,2>{0.547761321f, 0.303223729f},
-std::array<float,2>{0.0786218345f, 0.709328234f},
-std::array<float,2>{0.848816097f, 0.89533782f},
-std::array<float,2>{0.494895339f, 0.126246035f},
-std::array<float,2>{0.729982257f, 0.204319239f},
-std::array<float,2>{0.12890856f, 0.996889293f},
-std::array<float,2>{0.894952595f, 0.634382069f},
-std::array<float,2>{0.274208575f, 0.315161377f},
-std::array<float,2>{0.808540702f, 0.385008991f},
-std::array<float,2>{0.397423774f, 0.544069231f},
-std::array<float,2>{0.605087042f, 0.837434709f},
-std::array<float,2>{0.00255642063f, 0.0284442492f},
-std::array<float,2>{0.824007511f, 0.163737893f},
-std::array<float,2>{0.460214496f, 0.915120482f},
-std::array<float,2>{0.527454436f, 0.746904373f},
-std::array<float,2>{0.105876453f, 0.26812309f},
-std::array<float,2>{0.642391086f, 0.470202178f},
-std::array<float,2>{0.217662081f, 0.584605038f},
-std::array<float,2>{0.989645839f, 0.785164535f},
-std::array<float,2>{0.366232067f, 0.101255447f},
-std::array<float,2>{0.590527236f, 0.0513472185f},
-std::array<float,2>{0.0457141288f, 0.866233587f},
-std::array<float,2>{0.751358807f, 0.50496459f},
-std::array<float,2>{0.410432011f, 0.43502149f},
-std::array<float,2>{0.917439878f, 0.373990059f},
-std::array<float,2>{0.294156224f, 0.673410058f},
-std::array<float,2>{0.714854002f, 0.94219166f},
-std::array<float,2>{0.18097879f, 0.244077474f},
-std::array<float,2>{0.797508776f, 0.0773777068f},
-std::array<float,2>{0.400795639f, 0.759817064f},
-std::array<float,2>{0.599604666f, 0.606007636f},
-std::array<float,2>{0.0127917742f, 0.462534785f},
-std::array<float,2>{0.718755424f, 0.285602272f},
-std::array<float,2>{0.134783387f, 0.698425472f},
-std::array<float,2>{0.905153394f, 0.887815356f},
-std::array<float,2>{0.272203982f, 0.140823275f},
-std::array<float,2>{0.559449315f, 0.201087445f},
-std::array<float,2>{0.0925227031f, 0.973490119f},
-std::array<float,2>{0.854404986f, 0.649865508f},
-std::array<float,2>{0.487042397f, 0.339620411f},
-std::array<float,2>{0.961194217f, 0.391379148f},
-std::array<float,2>{0.316723198f, 0.548833668f},
-std::array<float,2>{0.657912374f, 0.820383906f},
-std::array<float,2>{0.231934294f, 0.00913144089f},
-std::array<float,2>{0.906544626f, 0.173628852f},
-std::array<float,2>{0.282484263f, 0.927414834f},
-std::array<float,2>{0.708031654f, 0.726373136f},
-std::array<float,2>{0.175419927f, 0.251740307f},
-std::array<float,2>{0.578248203f, 0.498279542f},
-std::array<float,2>{0.037914075f, 0.575505793f},
-std::array<float,2>{0.762706697f, 0.810743332f},
-std::array<float,2>{0.415729642f, 0.122275561f},
-std::array<float,2>{0.651219487f, 0.0317691229f},
-std::array<float,2>{0.203856647f, 0.848847091f},
-std::array<float,2>{0.993768573f, 0.520923376f},
-std::array<float,2>{0.367472976f, 0.416146815f},
-std::array<float,2>{0.819163382f, 0.350442827f},
-std::array<float,2>{0.467161f, 0.659251153f},
-std::array<float,2>{0.517799795f, 0.958420515f},
-std::array<float,2>{0.0953008384f, 0.221301287f},
-std::array<float,2>{0.983386099f, 0.0251687448f},
-std::array<float,2>{0.355629653f, 0.840251088f},
-std::array<float,2>{0.640447736f, 0.542360783f},
-std::array<float,2>{0.196194187f, 0.388129324f},
-std::array<float,2>{0.510099351f, 0.318921655f},
-std::array<float,2>{0.123938821f, 0.639927626f},
-std::array<float,2>{0.838079333f, 0.996063709f},
-std::array<float,2>{0.446335793f, 0.208112136f},
-std::array<float,2>{0.68955791f, 0.12990211f},
-std::array<float,2>{0.163244203f, 0.893437743f},
-std::array<float,2>{0.924833715f, 0.704904199f},
-std::array<float,2>{0.29877761f, 0.298617393f},
-std::array<float,2>{0.766571641f, 0.439983517f},
-std::array<float,2>{0.433483988f, 0.621824443f},
-std::array<float,2>{0.569837868f, 0.777807117f},
-std::array<float,2>{0.0520573333f, 0.0872075856f},
-std::array<float,2>{0.870466232f, 0.247826308f},
-std::array<float,2>{0.476114303f, 0.938499212f},
-std::array<float,2>{0.537260473f, 0.67911005f},
-std::array<float,2>{0.0677859187f, 0.369736493f},
-std::array<float,2>{0.674374759f, 0.431471467f},
-std::array<float,2>{0.242424652f, 0.500806808f},
-std::array<float,2>{0.949854076f, 0.86128974f},
-std::array<float,2>{0.334217936f, 0.0485749543f},
-std::array<float,2>{0.613847375f, 0.094975315f},
-std::array<float,2>{0.0258242879f, 0.784644783f},
-std::array<float,2>{0.781822026f, 0.579424441f},
-std::array<float,2>{0.386464357f, 0.473537207f},
-std::array<float,2>{0.884969532f, 0.272195876f},
-std::array<float,2>{0.254816532f, 0.743641615f},
-std::array<float,2>{0.740849912f, 0.919138551f},
-std::array<float,2>{0.142013133f, 0.159959778f},
-std::array<float,2>{0.83035624f, 0.0578888468f},
-std::array<float,2>{0.443149894f, 0.869692683f},
-std::array<float,2>{0.505117476f, 0.509441376f},
-std::array<float,2>{0.111475162f, 0.426006228f},
-std::array<float,2>{0.625338852f, 0.361419588f},
-std::array<float,2>{0.192847982f, 0.680895925f},
-std::array<float,2>{0.973854661f, 0.952669263f},
-std::array<float,2>{0.350289524f, 0.238415599f},
-std::array<float,2>{0.574704409f, 0.170375183f},
-std::array<float,2>{0.0570078976f, 0.913579166f},
-std::array<float,2>{0.77787745f, 0.74036175f},
-std::array<float,2>{0.428443193f, 0.273526073f},
-std::array<float,2>{0.932147622f, 0.479722112f},
-std::array<float,2>{0.309398204f, 0.58748734f},
-std::array<float,2>{0.70300734f, 0.795625448f},
-std::array<float,2>{0.167557746f, 0.108763769f},
-std::array<float,2>{0.943799019f, 0.211557984f},
-std::array<float,2>{0.341250688f, 0.985421419f},
-std::array<float,2>{0.68145287f, 0.629041314f},
-std::array<float,2>{0.240426585f, 0.321076244f},
-std::array<float,2>{0.539655805f, 0.382806838f},
-std::array<float,2>{0.0757511407f, 0.532886207f},
-std::array<float,2>{0.861878872f, 0.833880782f},
-std::array<float,2>{0.481686115f, 0.02050668f},
-std::array<float,2>{0.743386447f, 0.0826693475f},
-std::array<float,2>{0.152085543f, 0.773311853f},
-std::array<float,2>{0.87739706f, 0.612364292f},
-std::array<float,2>{0.262672365f, 0.451306641f},
-std::array<float,2>{0.796218991f, 0.311382592f},
-std::array<float,2>{0.377334744f, 0.718565822f},
-std::array<float,2>{0.622089982f, 0.900767922f},
-std::array<float,2>{0.0176606476f, 0.139868751f},
-std::array<float,2>{0.892497957f, 0.115591124f},
-std::array<float,2>{0.278884679f, 0.800315261f},
-std::array<float,2>{0.73372674f, 0.563638091f},
-std::array<float,2>{0.125117615f, 0.490458161f},
-std::array<float,2>{0.605808437f, 0.259662539f},
-std::array<float,2>{0.00430619717f, 0.729596198f},
-std::array<float,2>{0.811075866f, 0.932545722f},
-std::array<float,2>{0.393724859f, 0.179983884f},
-std::array<float,2>{0.667722225f, 0.23432155f},
-std::array<float,2>{0.22038652f, 0.962423563f},
-std::array<float,2>{0.958959818f, 0.670319438f},
-std::array<float,2>{0.325535268f, 0.351936668f},
-std::array<float,2>{0.846437633f, 0.408111006f},
-std::array<float,2>{0.499539077f, 0.525627911f},
-std::array<float,2>{0.553969264f, 0.853209972f},
-std::array<float,2>{0.0855266452f, 0.0421069562f},
-std::array<float,2>{0.755468726f, 0.154096082f},
-std::array<float,2>{0.407191515f, 0.87852633f},
-std::array<float,2>{0.587365031f, 0.69099164f},
-std::array<float,2>{0.0394472592f, 0.292905629f},
-std::array<float,2>{0.714098513f, 0.460432708f},
-std::array<float,2>{0.185525745f, 0.594583452f},
-std::array<float,2>{0.918981135f, 0.755076647f},
-std::array<float,2>{0.290562421f, 0.0652332976f},
-std::array<float,2>{0.52439183f, 0.00384722976f},
-std::array<float,2>{0.105021991f, 0.81643033f},
-std::array<float,2>{0.827834189f, 0.558308542f},
-std::array<float,2>{0.456967235f, 0.404207468f},
-std::array<float,2>{0.986928463f, 0.333275467f},
-std::array<float,2>{0.362360716f, 0.6466856f},
-std::array<float,2>{0.645399868f, 0.98036474f},
-std::array<float,2>{0.213165507f, 0.188565806f},
-std::array<float,2>{0.841169536f, 0.112431183f},
-std::array<float,2>{0.451784015f, 0.802520931f},
-std::array<float,2>{0.511903942f, 0.568637788f},
-std::array<float,2>{0.117270373f, 0.488082439f},
-std::array<float,2>{0.635623813f, 0.264996231f},
-std::array<float,2>{0.202133164f, 0.733762443f},
-std::array<float,2>{0.9795385f, 0.935103536f},
-std::array<float,2>{0.354600072f, 0.184359789f},
-std::array<float,2>{0.56281805f, 0.227744654f},
-std::array<float,2>{0.0471022315f, 0.968206286f},
-std::array<float,2>{0.772397399f, 0.664167523f},
-std::array<float,2>{0.436342388f, 0.358444512f},
-std::array<float,2>{0.927987635f, 0.412868977f},
-std::array<float,2>{0.301887542f, 0.527430415f},
-std::array<float,2>{0.694347918f, 0.858783543f},
-std::array<float,2>{0.156425208f, 0.0461992845f},
-std::array<float,2>{0.946105182f, 0.150824055f},
-std::array<float,2>{0.331977397f, 0.880577624f},
-std::array<float,2>{0.675833762f, 0.693968177f},
-std::array<float,2>{0.248578385f, 0.296600312f},
-std::array<float,2>{0.534130752f, 0.454565734f},
-std::array<float,2>{0.0650692433f, 0.598150074f},
-std::array<float,2>{0.873754621f, 0.753472865f},
-std::array<float,2>{0.469274044f, 0.0680794641f},
-std::array<float,2>{0.73799336f, 0.0068529183f},
-std::array<float,2>{0.144796044f, 0.813142717f},
-std::array<float,2>{0.889520824f, 0.561173379f},
-std::array<float,2>{0.253041029f, 0.401257604f},
-std::array<float,2>{0.788026333f, 0.3305085f},
-std::array<float,2>{0.388605565f, 0.644330621f},
-std::array<float,2>{0.612280965f, 0.982215762f},
-std::array<float,2>{0.031134909f, 0.192815989f},
-std::array<float,2>{0.901684225f, 0.0587066449f},
-std::array<float,2>{0.268404573f, 0.873906851f},
-std::array<float,2>{0.724659264f, 0.514434099f},
-std::array<float,2>{0.137355521f, 0.4244304f},
-std::array<float,2>{0.595788419f, 0.363897711f},
-std::array<float,2>{0.00945190527f, 0.685289562f},
-std::array<float,2>{0.804047942f, 0.94555831f},
-std::array<float,2>{0.403644741f, 0.2358042f},
-std::array<float,2>{0.660714984f, 0.165394694f},
-std::array<float,2>{0.227415442f, 0.909763455f},
-std::array<float,2>{0.964922905f, 0.734462857f},
-std::array<float,2>{0.313042432f, 0.277510077f},
-std::array<float,2>{0.857540011f, 0.484158248f},
-std::array<float,2>{0.488948375f, 0.592539191f},
-std::array<float,2>{0.556533515f, 0.790395975f},
-std::array<float,2>{0.0861730278f, 0.105089173f},
-std::array<float,2>{0.761244774f, 0.217167974f},
-std::array<float,2>{0.418580323f, 0.990017533f},
-std::array<float,2>{0.583462417f, 0.628174543f},
-std::array<float,2>{0.032916639f, 0.324609965f},
-std::array<float,2>{0.706264615f, 0.378535926f},
-std::array<float,2>{0.175948694f, 0.538868189f},
-std::array<float,2>{0.910796285f, 0.82857585f},
-std::array<float,2>{0.287254781f, 0.0191564877f},
-std::array<float,2>{0.520719826f, 0.079463765f},
-std::array<float,2>{0.100060403f, 0.767809987f},
-std::array<float,2>{0.813852847f, 0.614060342f},
-std::array<float,2>{0.461388588f, 0.445376515f},
-std::array<float,2>{0.999189615f, 0.306831688f},
-std::array<float,2>{0.372328162f, 0.711243629f},
-std::array<float,2>{0.652777612f, 0.905693531f},
-std::array<float,2>{0.207515046f, 0.136342078f},
-std::array<float,2>{0.806150675f, 0.0279477015f},
-std::array<float,2>{0.395772934f, 0.836539209f},
-std::array<float,2>{0.602296352f, 0.543079197f},
-std::array<float,2>{0.00022778807f, 0.386717111f},
-std::array<float,2>{0.727777302f, 0.315748215f},
-std::array<float,2>{0.132067353f, 0.633593917f},
-std::array<float,2>{0.89652288f, 0.997154653f},
-std::array<float,2>{0.27730149f, 0.203986526f},
-std::array<float,2>{0.549740434f, 0.125748873f},
-std::array<float,2>{0.0813281536f, 0.8960765f},
-std::array<float,2>{0.849683106f, 0.710169792f},
-std::array<float,2>{0.493884832f, 0.304414302f},
-std::array<float,2>{0.956367075f, 0.44333306f},
-std::array<float,2>{0.32195586f, 0.618881106f},
-std::array<float,2>{0.671709001f, 0.776890278f},
-std::array<float,2>{0.225934699f, 0.0930322781f},
-std::array<float,2>{0.915052652f, 0.242383808f},
-std::array<float,2>{0.296554357f, 0.943308711f},
-std::array<float,2>{0.71747297f, 0.6725986f},
-std::array<float,2>{0.183121279f, 0.374450982f},
-std::array<float,2>{0.593329608f, 0.434072256f},
-std::array<float,2>{0.0430487841f, 0.504383087f},
-std::array<float,2>{0.752888083f, 0.865488291f},
-std::array<float,2>{0.413932353f, 0.0526237711f},
-std::array<float,2>{0.643366277f, 0.100056201f},
-std::array<float,2>{0.215960026f, 0.786724091f},
-std::array<float,2>{0.992100775f, 0.585014641f},
-std::array<float,2>{0.364024848f, 0.469193012f},
-std::array<float,2>{0.820781648f, 0.268563181f},
-std::array<float,2>{0.458290905f, 0.7477054f},
-std::array<float,2>{0.529899001f, 0.914602816f},
-std::array<float,2>{0.109012976f, 0.162171409f},
-std::array<float,2>{0.969623029f, 0.073141031f},
-std::array<float,2>{0.347501785f, 0.762541533f},
-std::array<float,2>{0.629231572f, 0.604437649f},
-std::array<float,2>{0.187776148f, 0.465915143f},
-std::array<float,2>{0.503440857f, 0.282081723f},
-std::array<float,2>{0.117115408f, 0.702786565f},
-std::array<float,2>{0.83244741f, 0.883398354f},
-std::array<float,2>{0.440808773f, 0.145274356f},
-std::array<float,2>{0.697671473f, 0.199144661f},
-std::array<float,2>{0.168081209f, 0.969848156f},
-std::array<float,2>{0.93676579f, 0.652950346f},
-std::array<float,2>{0.307998925f, 0.343355507f},
-std::array<float,2>{0.774566174f, 0.395844936f},
-std::array<float,2>{0.425276965f, 0.552520454f},
-std::array<float,2>{0.570534945f, 0.824747264f},
-std::array<float,2>{0.0622106045f, 0.0129723204f},
-std::array<float,2>{0.864820898f, 0.179582492f},
-std::array<float,2>{0.477009296f, 0.922132611f},
-std::array<float,2>{0.545530438f, 0.719802976f},
-std::array<float,2>{0.0727562383f, 0.255019397f},
-std::array<float,2>{0.686224997f, 0.494935542f},
-std::array<float,2>{0.236299545f, 0.571911991f},
-std::array<float,2>{0.937552094f, 0.805924714f},
-std::array<float,2>{0.339257598f, 0.120101064f},
-std::array<float,2>{0.62023598f, 0.0372209735f},
-std::array<float,2>{0.0221679322f, 0.845070601f},
-std::array<float,2>{0.790504575f, 0.515656233f},
-std::array<float,2>{0.380345762f, 0.420804739f},
-std::array<float,2>{0.881487846f, 0.347394288f},
-std::array<float,2>{0.261537731f, 0.661419272f},
-std::array<float,2>{0.748302877f, 0.954585314f},
-std::array<float,2>{0.152435482f, 0.225599915f},
-std::array<float,2>{0.768532574f, 0.0866750553f},
-std::array<float,2>{0.430654734f, 0.779022157f},
-std::array<float,2>{0.567925513f, 0.622796595f},
-std::array<float,2>{0.0533343367f, 0.441132188f},
-std::array<float,2>{0.689034939f, 0.297087312f},
-std::array<float,2>{0.160453483f, 0.703593373f},
-std::array<float,2>{0.923479259f, 0.894044042f},
-std::array<float,2>{0.300242275f, 0.129316196f},
-std::array<float,2>{0.508453846f, 0.207915574f},
-std::array<float,2>{0.121152945f, 0.994633377f},
-std::array<float,2>{0.836898685f, 0.639508307f},
-std::array<float,2>{0.449200541f, 0.319994509f},
-std::array<float,2>{0.980888844f, 0.38705942f},
-std::array<float,2>{0.357542902f, 0.54191792f},
-std::array<float,2>{0.637132823f, 0.841011703f},
-std::array<float,2>{0.198569447f, 0.0240570735f},
-std::array<float,2>{0.883241236f, 0.158507571f},
-std::array<float,2>{0.257480443f, 0.918336332f},
-std::array<float,2>{0.73831445f, 0.742310822f},
-std::array<float,2>{0.144512057f, 0.27298668f},
-std::array<float,2>{0.615253329f, 0.474277675f},
-std::array<float,2>{0.0250894763f, 0.57847482f},
-std::array<float,2>{0.784271777f, 0.783399582f},
-std::array<float,2>{0.384467274f, 0.0939737856f},
-std::array<float,2>{0.672565162f, 0.0474852808f},
-std::array<float,2>{0.245242432f, 0.860110462f},
-std::array<float,2>{0.952654541f, 0.501727998f},
-std::array<float,2>{0.332884729f, 0.430150628f},
-std::array<float,2>{0.867388844f, 0.370689988f},
-std::array<float,2>{0.472692817f, 0.678162873f},
-std::array<float,2>{0.536125243f, 0.937518597f},
-std::array<float,2>{0.0687515661f, 0.246397987f},
-std::array<float,2>{0.964332759f, 0.00845918246f},
-std::array<float,2>{0.318767607f, 0.821483076f},
-std::array<float,2>{0.658425868f, 0.550767481f},
-std::array<float,2>{0.234342799f, 0.392077386f},
-std::array<float,2>{0.560770512f, 0.338652462f},
-std::array<float,2>{0.0909518823f, 0.64940846f},
-std::array<float,2>{0.851593554f, 0.973880351f},
-std::array<float,2>{0.486080021f, 0.199872896f},
-std::array<float,2>{0.721475661f, 0.142419264f},
-std::array<float,2>{0.134255618f, 0.887643576f},
-std::array<float,2>{0.904229879f, 0.697390079f},
-std::array<float,2>{0.270917684f, 0.286492944f},
-std::array<float,2>{0.798932493f, 0.461600721f},
-std::array<float,2>{0.399454236f, 0.606647968f},
-std::array<float,2>{0.601414382f, 0.761092961f},
-std::array<float,2>{0.0153525611f, 0.0763360187f},
-std::array<float,2>{0.818023801f, 0.222139865f},
-std::array<float,2>{0.465785533f, 0.957847416f},
-std::array<float,2>{0.516693294f, 0.658521593f},
-std::array<float,2>{0.0969606489f, 0.350757867f},
-std::array<float,2>{0.64983362f, 0.417297989f},
-std::array<float,2>{0.205980226f, 0.519563735f},
-std::array<float,2>{0.995672524f, 0.848007202f},
-std::array<float,2>{0.369694918f, 0.0329313353f},
-std::array<float,2>{0.581678629f, 0.12180911f},
-std::array<float,2>{0.0353672095f, 0.81160289f},
-std::array<float,2>{0.765560329f, 0.574969411f},
-std::array<float,2>{0.417604685f, 0.499027103f},
-std::array<float,2>{0.908277094f, 0.250771016f},
-std::array<float,2>{0.284743905f, 0.725206375f},
-std::array<float,2>{0.709308445f, 0.926304698f},
-std::array<float,2>{0.172362864f, 0.171894461f},
-std::array<float,2>{0.844538569f, 0.0411581062f},
-std::array<float,2>{0.496557504f, 0.852442145f},
-std::array<float,2>{0.551814735f, 0.526640832f},
-std::array<float,2>{0.0831396133f, 0.406661063f},
-std::array<float,2>{0.664459288f, 0.353321791f},
-std::array<float,2>{0.220770389f, 0.671588123f},
-std::array<float,2>{0.959936976f, 0.961297154f},
-std::array<float,2>{0.326601833f, 0.232422248f},
-std::array<float,2>{0.607764423f, 0.180850744f},
-std::array<float,2>{0.0070908973f, 0.933216333f},
-std::array<float,2>{0.809013188f, 0.729106069f},
-std::array<float,2>{0.392418832f, 0.258150607f},
-std::array<float,2>{0.893586099f, 0.492125034f},
-std::array<float,2>{0.279429823f, 0.56333828f},
-std::array<float,2>{0.731042266f, 0.79958111f},
-std::array<float,2>{0.127688169f, 0.117086954f},
-std::array<float,2>{0.984630823f, 0.187759578f},
-std::array<float,2>{0.361215681f, 0.979275525f},
-std::array<float,2>{0.647789478f, 0.64783597f},
-std::array<float,2>{0.212135807f, 0.332203567f},
-std::array<float,2>{0.52661097f, 0.403032392f},
-std::array<float,2>{0.103390396f, 0.556749821f},
-std::array<float,2>{0.824563205f, 0.817611635f},
-std::array<float,2>{0.453829169f, 0.00215229811f},
-std::array<float,2>{0.711669683f, 0.0660748407f},
-std::array<float,2>{0.187340274f, 0.75483793f},
-std::array<float,2>{0.921111822f, 0.595687985f},
-std::array<float,2>{0.291796863f, 0.459156454f},
-std::array<float,2>{0.756420672f, 0.291790158f},
-std::array<float,2>{0.408908457f, 0.689840913f},
-std::array<float,2>{0.588705719f, 0.877350986f},
-std::array<float,2>{0.0423145853f, 0.152599648f},
-std::array<float,2>{0.929760635f, 0.107745036f},
-std::array<float,2>{0.311570823f, 0.796855211f},
-std::array<float,2>{0.700025439f, 0.586763918f},
-std::array<float,2>{0.164403051f, 0.479203612f},
-std::array<float,2>{0.577699482f, 0.274902701f},
-std::array<float,2>{0.0551627427f, 0.741797864f},
-std::array<float,2>{0.779990196f, 0.912374139f},
-std::array<float,2>{0.426284581f, 0.17172043f},
-std::array<float,2>{0.628363132f, 0.239725873f},
-std::array<float,2>{0.193605036f, 0.95156163f},
-std::array<float,2>{0.975993335f, 0.680287361f},
-std::array<float,2>{0.349490553f, 0.362951368f},
-std::array<float,2>{0.829451919f, 0.427129954f},
-std::array<float,2>{0.445204675f, 0.508361936f},
-std::array<float,2>{0.506206274f, 0.870397925f},
-std::array<float,2>{0.111312233f, 0.0575272441f},
-std::array<float,2>{0.794216216f, 0.139530331f},
-std::array<float,2>{0.376190245f, 0.901816905f},
-std::array<float,2>{0.623633206f, 0.716949344f},
-std::array<float,2>{0.0171104074f, 0.311799079f},
-std::array<float,2>{0.745083869f, 0.452775776f},
-std::array<float,2>{0.148609489f, 0.611397624f},
-std::array<float,2>{0.875982463f, 0.772182584f},
-std::array<float,2>{0.265413165f, 0.0831645727f},
-std::array<float,2>{0.542066157f, 0.0206504185f},
-std::array<float,2>{0.0779054686f, 0.832649469f},
-std::array<float,2>{0.860043526f, 0.531990767f},
-std::array<float,2>{0.483875424f, 0.381330073f},
-std::array<float,2>{0.94142127f, 0.321658581f},
-std::array<float,2>{0.342278868f, 0.630254865f},
-std::array<float,2>{0.682581127f, 0.985007644f},
-std::array<float,2>{0.239146352f, 0.212688997f},
-std::array<float,2>{0.872597098f, 0.0700218156f},
-std::array<float,2>{0.471271247f, 0.751009345f},
-std::array<float,2>{0.532006919f, 0.600892723f},
-std::array<float,2>{0.0643367395f, 0.456443578f},
-std::array<float,2>{0.678023636f, 0.294910461f},
-std::array<float,2>{0.247171059f, 0.692583025f},
-std::array<float,2>{0.948143661f, 0.882434964f},
-std::array<float,2>{0.330002487f, 0.150104493f},
-std::array<float,2>{0.610355198f, 0.193860441f},
-std::array<float,2>{0.0280511454f, 0.983576119f},
-std::array<float,2>{0.786644161f, 0.642102242f},
-std::array<float,2>{0.389713675f, 0.329657227f},
-std::array<float,2>{0.888318717f, 0.399263322f},
-std::array<float,2>{0.250637442f, 0.56011343f},
-std::array<float,2>{0.735971928f, 0.81553936f},
-std::array<float,2>{0.147100508f, 0.00444992585f},
-std::array<float,2>{0.976917207f, 0.185733512f},
-std::array<float,2>{0.3532812f, 0.936252654f},
-std::array<float,2>{0.633903742f, 0.731177151f},
-std::array<float,2>{0.199364826f, 0.262575418f},
-std::array<float,2>{0.514659047f, 0.485275358f},
-std::array<float,2>{0.119929068f, 0.567727983f},
-std::array<float,2>{0.843234718f, 0.804321885f},
-std::array<float,2>{0.449930519f, 0.10945265f},
-std::array<float,2>{0.692251146f, 0.0437032618f},
-std::array<float,2>{0.158846825f, 0.856795013f},
-std::array<float,2>{0.92590493f, 0.530677199f},
-std::array<float,2>{0.304223865f, 0.411861569f},
-std::array<float,2>{0.770081222f, 0.35673064f},
-std::array<float,2>{0.435025305f, 0.667752504f},
-std::array<float,2>{0.565160632f, 0.965562522f},
-std::array<float,2>{0.0502363294f, 0.230337366f},
-std::array<float,2>{0.912590384f, 0.0157807879f},
-std::array<float,2>{0.286852419f, 0.830259025f},
-std::array<float,2>{0.704751968f, 0.536464036f},
-std::array<float,2>{0.17949982f, 0.375818223f},
-std::array<float,2>{0.584500134f, 0.326630235f},
-std::array<float,2>{0.0339408256f, 0.626057506f},
-std::array<float,2>{0.758122683f, 0.991811216f},
-std::array<float,2>{0.420487195f, 0.216211721f},
-std::array<float,2>{0.655020535f, 0.132931769f},
-std::array<float,2>{0.209393248f, 0.903248429f},
-std::array<float,2>{0.997382045f, 0.714104116f},
-std::array<float,2>{0.373080641f, 0.306313127f},
-std::array<float,2>{0.81466043f, 0.448106855f},
-std::array<float,2>{0.463148326f, 0.6163975f},
-std::array<float,2>{0.522633255f, 0.767166853f},
-std::array<float,2>{0.09933763f, 0.0817648098f},
-std::array<float,2>{0.801832616f, 0.238176942f},
-std::array<float,2>{0.404454798f, 0.948141634f},
-std::array<float,2>{0.595389366f, 0.685683787f},
-std::array<float,2>{0.0113226315f, 0.366304755f},
-std::array<float,2>{0.723904252f, 0.423106223f},
-std::array<float,2>{0.139169633f, 0.512818396f},
-std::array<float,2>{0.898514152f, 0.871997893f},
-std::array<float,2>{0.267573357f, 0.0609311722f},
-std::array<float,2>{0.55799377f, 0.103011377f},
-std::array<float,2>{0.0883678794f, 0.79186511f},
-std::array<float,2>{0.857359052f, 0.589964092f},
-std::array<float,2>{0.491307318f, 0.482356489f},
-std::array<float,2>{0.967781126f, 0.28036502f},
-std::array<float,2>{0.316236407f, 0.736628354f},
-std::array<float,2>{0.663700223f, 0.906436384f},
-std::array<float,2>{0.229560122f, 0.167348698f},
-std::array<float,2>{0.750757158f, 0.0531313941f},
-std::array<float,2>{0.41166237f, 0.863854766f},
-std::array<float,2>{0.591738164f, 0.506158471f},
-std::array<float,2>{0.0462368093f, 0.436638921f},
-std::array<float,2>{0.716360867f, 0.372906774f},
-std::array<float,2>{0.179731205f, 0.675063312f},
-std::array<float,2>{0.916671693f, 0.944313228f},
-std::array<float,2>{0.293307275f, 0.245276451f},
-std::array<float,2>{0.52834779f, 0.161468819f},
-std::array<float,2>{0.107418925f, 0.916842818f},
-std::array<float,2>{0.822675943f, 0.749030888f},
-std::array<float,2>{0.459373266f, 0.267407358f},
-std::array<float,2>{0.988924921f, 0.471531987f},
-std::array<float,2>{0.365452528f, 0.582257688f},
-std::array<float,2>{0.64119637f, 0.78785485f},
-std::array<float,2>{0.21841833f, 0.0978632271f},
-std::array<float,2>{0.89640075f, 0.205629021f},
-std::array<float,2>{0.275360793f, 0.999992251f},
-std::array<float,2>{0.729057014f, 0.635975957f},
-std::array<float,2>{0.130378783f, 0.313455194f},
-std::array<float,2>{0.603933632f, 0.38306132f},
-std::array<float,2>{0.00385772577f, 0.545623302f},
-std::array<float,2>{0.807289302f, 0.838452399f},
-std::array<float,2>{0.397593647f, 0.0309240054f},
-std::array<float,2>{0.669182837f, 0.090692021f},
-std::array<float,2>{0.223860368f, 0.773935497f},
-std::array<float,2>{0.954146385f, 0.620065808f},
-std::array<float,2>{0.323149592f, 0.445168734f},
-std::array<float,2>{0.848128319f, 0.302620083f},
-std::array<float,2>{0.495512635f, 0.707739711f},
-std::array<float,2>{0.548077762f, 0.896705806f},
-std::array<float,2>{0.0799681768f, 0.128727153f},
-std::array<float,2>{0.939947248f, 0.117902644f},
-std::array<float,2>{0.337760806f, 0.806738913f},
-std::array<float,2>{0.683641791f, 0.573790312f},
-std::array<float,2>{0.236992076f, 0.492555946f},
-std::array<float,2>{0.543056667f, 0.256046414f},
-std::array<float,2>{0.0716460273f, 0.721788645f},
-std::array<float,2>{0.86615026f, 0.925517499f},
-std::array<float,2>{0.479590893f, 0.177139401f},
-std::array<float,2>{0.746511459f, 0.223494425f},
-std::array<float,2>{0.155597761f, 0.955887616f},
-std::array<float,2>{0.880088687f, 0.663895607f},
-std::array<float,2>{0.25906232f, 0.344647735f},
-std::array<float,2>{0.791699111f, 0.418042988f},
-std::array<float,2>{0.381955594f, 0.519370615f},
-std::array<float,2>{0.618319571f, 0.847245157f},
-std::array<float,2>{0.0206745248f, 0.0368980952f},
-std::array<float,2>{0.83421129f, 0.146999836f},
-std::array<float,2>{0.438813299f, 0.886137962f},
-std::array<float,2>{0.501786888f, 0.700275898f},
-std::array<float,2>{0.113336913f, 0.284627557f},
-std::array<float,2>{0.631441772f, 0.468491256f},
-std::array<float,2>{0.191132441f, 0.602733493f},
-std::array<float,2>{0.972353458f, 0.764387608f},
-std::array<float,2>{0.345308661f, 0.0706894919f},
-std::array<float,2>{0.574001968f, 0.0153095592f},
-std::array<float,2>{0.0600819401f, 0.826438487f},
-std::array<float,2>{0.775845706f, 0.554160655f},
-std::array<float,2>{0.422623575f, 0.396843553f},
-std::array<float,2>{0.935327172f, 0.340013683f},
-std::array<float,2>{0.305745959f, 0.655654192f},
-std::array<float,2>{0.696660578f, 0.970808744f},
-std::array<float,2>{0.1709885f, 0.195730329f},
-std::array<float,2>{0.783025324f, 0.0959758982f},
-std::array<float,2>{0.385502279f, 0.78219837f},
-std::array<float,2>{0.614590526f, 0.580165327f},
-std::array<float,2>{0.0271414462f, 0.475201756f},
-std::array<float,2>{0.741223216f, 0.270659089f},
-std::array<float,2>{0.140917048f, 0.745197833f},
-std::array<float,2>{0.886192918f, 0.920605481f},
-std::array<float,2>{0.254891902f, 0.156327829f},
-std::array<float,2>{0.538548172f, 0.248799577f},
-std::array<float,2>{0.0665447712f, 0.940945208f},
-std::array<float,2>{0.869141161f, 0.677234232f},
-std::array<float,2>{0.475575358f, 0.36837846f},
-std::array<float,2>{0.950346231f, 0.433002144f},
-std::array<float,2>{0.335264087f, 0.502283573f},
-std::array<float,2>{0.675195634f, 0.861626327f},
-std::array<float,2>{0.244104177f, 0.0497429147f},
-std::array<float,2>{0.92430371f, 0.131361425f},
-std::array<float,2>{0.297644079f, 0.892409384f},
-std::array<float,2>{0.691009879f, 0.706688881f},
-std::array<float,2>{0.162324518f, 0.299031168f},
-std::array<float,2>{0.569163561f, 0.438357115f},
-std::array<float,2>{0.0512543879f, 0.624385536f},
-std::array<float,2>{0.767391026f, 0.779367983f},
-std::array<float,2>{0.432171822f, 0.089049533f},
-std::array<float,2>{0.639592171f, 0.0256818309f},
-std::array<float,2>{0.196704984f, 0.843223512f},
-std::array<float,2>{0.984230101f, 0.540696263f},
-std::array<float,2>{0.356972158f, 0.389621109f},
-std::array<float,2>{0.839473009f, 0.31823051f},
-std::array<float,2>{0.446029097f, 0.637848973f},
-std::array<float,2>{0.511480689f, 0.993644774f},
-std::array<float,2>{0.124502473f, 0.209951282f},
-std::array<float,2>{0.992484272f, 0.0348687991f},
-std::array<float,2>{0.368415445f, 0.849855661f},
-std::array<float,2>{0.652163625f, 0.522932768f},
-std::array<float,2>{0.20476976f, 0.415258199f},
-std::array<float,2>{0.519112051f, 0.349266201f},
-std::array<float,2>{0.0938508585f, 0.658156574f},
-std::array<float,2>{0.820130587f, 0.959048629f},
-std::array<float,2>{0.467987359f, 0.219537303f},
-std::array<float,2>{0.707844198f, 0.175708398f},
-std::array<float,2>{0.174088225f, 0.929199219f},
-std::array<float,2>{0.907825112f, 0.724267602f},
-std::array<float,2>{0.28181383f, 0.253775984f},
-std::array<float,2>{0.762617886f, 0.496337265f},
-std::array<float,2>{0.414861977f, 0.576428711f},
-std::array<float,2>{0.579988539f, 0.810047984f},
-std::array<float,2>{0.0383092314f, 0.124800809f},
-std::array<float,2>{0.855110645f, 0.202903286f},
-std::array<float,2>{0.4882572f, 0.974702477f},
-std::array<float,2>{0.559974074f, 0.650432289f},
-std::array<float,2>{0.0931393653f, 0.337293267f},
-std::array<float,2>{0.656325459f, 0.393173039f},
-std::array<float,2>{0.230561122f, 0.547344983f},
-std::array<float,2>{0.962176561f, 0.822850287f},
-std::array<float,2>{0.317496836f, 0.0103644188f},
-std::array<float,2>{0.598281443f, 0.0761526823f},
-std::array<float,2>{0.0123044588f, 0.759711564f},
-std::array<float,2>{0.798150718f, 0.608809471f},
-std::array<float,2>{0.401738435f, 0.463359177f},
-std::array<float,2>{0.905745983f, 0.287993878f},
-std::array<float,2>{0.272526234f, 0.696865737f},
-std::array<float,2>{0.72047621f, 0.890300632f},
-std::array<float,2>{0.13583149f, 0.144367307f},
-std::array<float,2>{0.826487899f, 0.00100489671f},
-std::array<float,2>{0.455086708f, 0.818539202f},
-std::array<float,2>{0.524737358f, 0.556631684f},
-std::array<float,2>{0.10419859f, 0.406185776f},
-std::array<float,2>{0.646482885f, 0.33431536f},
-std::array<float,2>{0.214038536f, 0.645224392f},
-std::array<float,2>{0.98757422f, 0.976725996f},
-std::array<float,2>{0.36173135f, 0.191222623f},
-std::array<float,2>{0.586515784f, 0.155012384f},
-std::array<float,2>{0.0409756228f, 0.876480222f},
-std::array<float,2>{0.754381001f, 0.688513756f},
-std::array<float,2>{0.408176273f, 0.289852262f},
-std::array<float,2>{0.918530226f, 0.45716539f},
-std::array<float,2>{0.289418936f, 0.597144067f},
-std::array<float,2>{0.713437617f, 0.75645411f},
-std::array<float,2>{0.18414925f, 0.0634732544f},
-std::array<float,2>{0.957358479f, 0.230822548f},
-std::array<float,2>{0.32456398f, 0.963614881f},
-std::array<float,2>{0.666689217f, 0.669547439f},
-std::array<float,2>{0.219127521f, 0.354668766f},
-std::array<float,2>{0.553642094f, 0.410070151f},
-std::array<float,2>{0.084923014f, 0.525234699f},
-std::array<float,2>{0.847148895f, 0.8552531f},
-std::array<float,2>{0.498176783f, 0.0400393233f},
-std::array<float,2>{0.733368456f, 0.114190876f},
-std::array<float,2>{0.126738101f, 0.796991646f},
-std::array<float,2>{0.890888035f, 0.565785646f},
-std::array<float,2>{0.277557403f, 0.488936335f},
-std::array<float,2>{0.811712623f, 0.26115936f},
-std::array<float,2>{0.392645627f, 0.728007376f},
-std::array<float,2>{0.606771827f, 0.930037022f},
-std::array<float,2>{0.00492522772f, 0.182784006f},
-std::array<float,2>{0.878039479f, 0.0848865435f},
-std::array<float,2>{0.262846857f, 0.770629823f},
-std::array<float,2>{0.742566645f, 0.609807611f},
-std::array<float,2>{0.15110977f, 0.44984436f},
-std::array<float,2>{0.621926486f, 0.309616327f},
-std::array<float,2>{0.0190916061f, 0.715904355f},
-std::array<float,2>{0.794961631f, 0.900065958f},
-std::array<float,2>{0.378762186f, 0.137224972f},
-std::array<float,2>{0.679950655f, 0.214070708f},
-std::array<float,2>{0.241389349f, 0.987991869f},
-std::array<float,2>{0.945036352f, 0.631247044f},
-std::array<float,2>{0.340148956f, 0.322280586f},
-std::array<float,2>{0.862449825f, 0.380776376f},
-std::array<float,2>{0.480939478f, 0.534396231f},
-std::array<float,2>{0.540186763f, 0.834473014f},
-std::array<float,2>{0.0742582977f, 0.0233821031f},
-std::array<float,2>{0.778469324f, 0.168683469f},
-std::array<float,2>{0.429081321f, 0.911042273f},
-std::array<float,2>{0.575867116f, 0.73863703f},
-std::array<float,2>{0.0576845482f, 0.27602753f},
-std::array<float,2>{0.701452851f, 0.477075756f},
-std::array<float,2>{0.166989893f, 0.58942008f},
-std::array<float,2>{0.933358788f, 0.793057024f},
-std::array<float,2>{0.310090989f, 0.106986336f},
-std::array<float,2>{0.504569471f, 0.0547985509f},
-std::array<float,2>{0.112337135f, 0.868067741f},
-std::array<float,2>{0.831765652f, 0.511716604f},
-std::array<float,2>{0.442340702f, 0.428067923f},
-std::array<float,2>{0.972736657f, 0.360748559f},
-std::array<float,2>{0.351342142f, 0.682760954f},
-std::array<float,2>{0.626807988f, 0.950416625f},
-std::array<float,2>{0.191431835f, 0.240625113f}}
\ No newline at end of file
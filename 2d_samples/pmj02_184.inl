@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.627838731f, 0.136711136f},
-std::array<float,2>{0.0428937748f, 0.961851835f},
-std::array<float,2>{0.467584759f, 0.47279045f},
-std::array<float,2>{0.878453493f, 0.522706449f},
-std::array<float,2>{0.835896075f, 0.371390343f},
-std::array<float,2>{0.311876506f, 0.682822704f},
-std::array<float,2>{0.199954614f, 0.10802342f},
-std::array<float,2>{0.609688163f, 0.79404211f},
-std::array<float,2>{0.9396348f, 0.00823738519f},
-std::array<float,2>{0.434001625f, 0.833463132f},
-std::array<float,2>{0.0792810246f, 0.308250636f},
-std::array<float,2>{0.70170027f, 0.725002527f},
-std::array<float,2>{0.508364081f, 0.391137123f},
-std::array<float,2>{0.145999223f, 0.618585527f},
-std::array<float,2>{0.355040491f, 0.241422608f},
-std::array<float,2>{0.780271888f, 0.90853101f},
-std::array<float,2>{0.564637125f, 0.0638699979f},
-std::array<float,2>{0.241377831f, 0.76953578f},
-std::array<float,2>{0.260783315f, 0.336720109f},
-std::array<float,2>{0.86223197f, 0.627558172f},
-std::array<float,2>{0.908266723f, 0.456424683f},
-std::array<float,2>{0.484576732f, 0.557209551f},
-std::array<float,2>{0.00758144632f, 0.177270889f},
-std::array<float,2>{0.678514004f, 0.972576678f},
-std::array<float,2>{0.812371075f, 0.205707029f},
-std::array<float,2>{0.323498487f, 0.899685383f},
-std::array<float,2>{0.177512214f, 0.434433937f},
-std::array<float,2>{0.553312659f, 0.574799836f},
-std::array<float,2>{0.740405321f, 0.257599771f},
-std::array<float,2>{0.117484786f, 0.699471772f},
-std::array<float,2>{0.396699697f, 0.0350096673f},
-std::array<float,2>{0.981952786f, 0.865461648f},
-std::array<float,2>{0.705196321f, 0.0526068732f},
-std::array<float,2>{0.0739613399f, 0.84501338f},
-std::array<float,2>{0.407051593f, 0.267932802f},
-std::array<float,2>{0.96504873f, 0.715083122f},
-std::array<float,2>{0.752729297f, 0.411613017f},
-std::array<float,2>{0.369251192f, 0.591205359f},
-std::array<float,2>{0.140373453f, 0.203108013f},
-std::array<float,2>{0.525404692f, 0.881876051f},
-std::array<float,2>{0.892447293f, 0.168377504f},
-std::array<float,2>{0.441588253f, 0.986600578f},
-std::array<float,2>{0.0599240512f, 0.439706266f},
-std::array<float,2>{0.654238641f, 0.546410859f},
-std::array<float,2>{0.604776978f, 0.325124234f},
-std::array<float,2>{0.204262152f, 0.64727062f},
-std::array<float,2>{0.294789106f, 0.0895676166f},
-std::array<float,2>{0.820990145f, 0.755626023f},
-std::array<float,2>{0.538302541f, 0.228620678f},
-std::array<float,2>{0.164325774f, 0.928193152f},
-std::array<float,2>{0.33172968f, 0.382897258f},
-std::array<float,2>{0.784943938f, 0.594399452f},
-std::array<float,2>{0.987419367f, 0.294697791f},
-std::array<float,2>{0.376982898f, 0.741579056f},
-std::array<float,2>{0.0997373387f, 0.0299462937f},
-std::array<float,2>{0.727925718f, 0.826795578f},
-std::array<float,2>{0.859363675f, 0.124037296f},
-std::array<float,2>{0.26627484f, 0.803034842f},
-std::array<float,2>{0.231733978f, 0.348447233f},
-std::array<float,2>{0.583275199f, 0.665539801f},
-std::array<float,2>{0.667681694f, 0.49624604f},
-std::array<float,2>{0.0231713429f, 0.501206756f},
-std::array<float,2>{0.481621265f, 0.151479751f},
-std::array<float,2>{0.923177838f, 0.951745331f},
-std::array<float,2>{0.723110855f, 0.18801567f},
-std::array<float,2>{0.107171871f, 0.883238971f},
-std::array<float,2>{0.390242308f, 0.421518654f},
-std::array<float,2>{0.998894393f, 0.585092008f},
-std::array<float,2>{0.790793598f, 0.276819736f},
-std::array<float,2>{0.340127677f, 0.706631958f},
-std::array<float,2>{0.164038405f, 0.0552571043f},
-std::array<float,2>{0.542034566f, 0.85480237f},
-std::array<float,2>{0.932853639f, 0.0836894512f},
-std::array<float,2>{0.47221154f, 0.762590647f},
-std::array<float,2>{0.0310609229f, 0.312842757f},
-std::array<float,2>{0.662241817f, 0.656127632f},
-std::array<float,2>{0.586518049f, 0.45146659f},
-std::array<float,2>{0.225403577f, 0.538745522f},
-std::array<float,2>{0.280897439f, 0.160450727f},
-std::array<float,2>{0.84633857f, 0.999590337f},
-std::array<float,2>{0.5190413f, 0.0192769822f},
-std::array<float,2>{0.132488236f, 0.81534791f},
-std::array<float,2>{0.360325247f, 0.284279257f},
-std::array<float,2>{0.763904989f, 0.74843806f},
-std::array<float,2>{0.959748983f, 0.377484769f},
-std::array<float,2>{0.416260719f, 0.607336521f},
-std::array<float,2>{0.0660356432f, 0.225195944f},
-std::array<float,2>{0.715235412f, 0.932707489f},
-std::array<float,2>{0.819572628f, 0.142890349f},
-std::array<float,2>{0.284327537f, 0.938213766f},
-std::array<float,2>{0.216512114f, 0.489354968f},
-std::array<float,2>{0.598383605f, 0.51366818f},
-std::array<float,2>{0.645089746f, 0.355725497f},
-std::array<float,2>{0.0512885861f, 0.65804714f},
-std::array<float,2>{0.450121075f, 0.111260019f},
-std::array<float,2>{0.905631423f, 0.810300887f},
-std::array<float,2>{0.682907522f, 0.0993900523f},
-std::array<float,2>{0.0155535201f, 0.786384702f},
-std::array<float,2>{0.496299446f, 0.365102142f},
-std::array<float,2>{0.920248985f, 0.678920686f},
-std::array<float,2>{0.871310294f, 0.48380208f},
-std::array<float,2>{0.253353834f, 0.528118789f},
-std::array<float,2>{0.24697046f, 0.12843515f},
-std::array<float,2>{0.577504992f, 0.954548478f},
-std::array<float,2>{0.973945856f, 0.249689326f},
-std::array<float,2>{0.405650198f, 0.917434752f},
-std::array<float,2>{0.115485072f, 0.40035069f},
-std::array<float,2>{0.744909167f, 0.614762545f},
-std::array<float,2>{0.555133283f, 0.300800562f},
-std::array<float,2>{0.186291635f, 0.734339416f},
-std::array<float,2>{0.316879928f, 0.00764600327f},
-std::array<float,2>{0.803169966f, 0.841360152f},
-std::array<float,2>{0.620871782f, 0.185950696f},
-std::array<float,2>{0.191538811f, 0.981434166f},
-std::array<float,2>{0.296895772f, 0.462018132f},
-std::array<float,2>{0.836394131f, 0.547785282f},
-std::array<float,2>{0.887388527f, 0.329596967f},
-std::array<float,2>{0.458120227f, 0.637162864f},
-std::array<float,2>{0.03311079f, 0.0726312026f},
-std::array<float,2>{0.635679483f, 0.777133822f},
-std::array<float,2>{0.769181371f, 0.0451967828f},
-std::array<float,2>{0.350073576f, 0.873013258f},
-std::array<float,2>{0.1553054f, 0.260603666f},
-std::array<float,2>{0.503692746f, 0.68888706f},
-std::array<float,2>{0.692316771f, 0.423158973f},
-std::array<float,2>{0.0895478204f, 0.568089187f},
-std::array<float,2>{0.429480135f, 0.21610342f},
-std::array<float,2>{0.945714891f, 0.897068083f},
-std::array<float,2>{0.658163428f, 0.235560596f},
-std::array<float,2>{0.0252282526f, 0.913884521f},
-std::array<float,2>{0.476139367f, 0.397836089f},
-std::array<float,2>{0.937203646f, 0.624897838f},
-std::array<float,2>{0.851536453f, 0.311244637f},
-std::array<float,2>{0.27605924f, 0.719630837f},
-std::array<float,2>{0.220826119f, 0.0133194281f},
-std::array<float,2>{0.591396093f, 0.831393778f},
-std::array<float,2>{0.992477655f, 0.102768429f},
-std::array<float,2>{0.385914624f, 0.790856838f},
-std::array<float,2>{0.10199292f, 0.367523432f},
-std::array<float,2>{0.718767583f, 0.684573352f},
-std::array<float,2>{0.545030713f, 0.468753308f},
-std::array<float,2>{0.157502204f, 0.51900506f},
-std::array<float,2>{0.338774085f, 0.14056626f},
-std::array<float,2>{0.796717107f, 0.965543091f},
-std::array<float,2>{0.595739186f, 0.0370409042f},
-std::array<float,2>{0.214277923f, 0.860785723f},
-std::array<float,2>{0.287753552f, 0.253237963f},
-std::array<float,2>{0.813701391f, 0.698033035f},
-std::array<float,2>{0.89955467f, 0.432858586f},
-std::array<float,2>{0.445884556f, 0.57367605f},
-std::array<float,2>{0.0472638719f, 0.207096964f},
-std::array<float,2>{0.641895533f, 0.905327976f},
-std::array<float,2>{0.759527504f, 0.172979414f},
-std::array<float,2>{0.367067933f, 0.973576605f},
-std::array<float,2>{0.126346603f, 0.459151953f},
-std::array<float,2>{0.520576954f, 0.560934007f},
-std::array<float,2>{0.714193463f, 0.341878325f},
-std::array<float,2>{0.0677751377f, 0.629832923f},
-std::array<float,2>{0.421004772f, 0.069599852f},
-std::array<float,2>{0.954139054f, 0.769129872f},
-std::array<float,2>{0.746231496f, 0.0907239541f},
-std::array<float,2>{0.111428447f, 0.753893077f},
-std::array<float,2>{0.401171684f, 0.321888864f},
-std::array<float,2>{0.97027564f, 0.642623901f},
-std::array<float,2>{0.798501313f, 0.444776744f},
-std::array<float,2>{0.314779043f, 0.539518893f},
-std::array<float,2>{0.180859134f, 0.167116776f},
-std::array<float,2>{0.558626056f, 0.991033375f},
-std::array<float,2>{0.916553259f, 0.198734283f},
-std::array<float,2>{0.493405282f, 0.877140164f},
-std::array<float,2>{0.0105947359f, 0.406338215f},
-std::array<float,2>{0.686028361f, 0.588923097f},
-std::array<float,2>{0.574021518f, 0.269944638f},
-std::array<float,2>{0.244975999f, 0.712492764f},
-std::array<float,2>{0.255666941f, 0.0497352369f},
-std::array<float,2>{0.869124591f, 0.848031044f},
-std::array<float,2>{0.504923224f, 0.15246357f},
-std::array<float,2>{0.150354981f, 0.947090149f},
-std::array<float,2>{0.346342087f, 0.493272126f},
-std::array<float,2>{0.771581352f, 0.504557848f},
-std::array<float,2>{0.95218724f, 0.347325027f},
-std::array<float,2>{0.424501926f, 0.670542836f},
-std::array<float,2>{0.0935072228f, 0.120542012f},
-std::array<float,2>{0.690510511f, 0.797256529f},
-std::array<float,2>{0.842762232f, 0.0262867715f},
-std::array<float,2>{0.300971359f, 0.823881567f},
-std::array<float,2>{0.188879848f, 0.29266277f},
-std::array<float,2>{0.621126175f, 0.737960696f},
-std::array<float,2>{0.640108228f, 0.390591294f},
-std::array<float,2>{0.0356163532f, 0.601071f},
-std::array<float,2>{0.453661859f, 0.231403023f},
-std::array<float,2>{0.884328365f, 0.924898207f},
-std::array<float,2>{0.698331118f, 0.157436997f},
-std::array<float,2>{0.0843844563f, 0.995554566f},
-std::array<float,2>{0.431723893f, 0.446272761f},
-std::array<float,2>{0.945134163f, 0.532891691f},
-std::array<float,2>{0.773464203f, 0.319167405f},
-std::array<float,2>{0.35826236f, 0.650366068f},
-std::array<float,2>{0.144217968f, 0.0786763728f},
-std::array<float,2>{0.512953281f, 0.760340691f},
-std::array<float,2>{0.880995333f, 0.0618019998f},
-std::array<float,2>{0.463689387f, 0.856143415f},
-std::array<float,2>{0.0455504805f, 0.278282881f},
-std::array<float,2>{0.631514132f, 0.710449576f},
-std::array<float,2>{0.61598134f, 0.414130539f},
-std::array<float,2>{0.197226182f, 0.579798102f},
-std::array<float,2>{0.306712687f, 0.193349928f},
-std::array<float,2>{0.828772366f, 0.889450133f},
-std::array<float,2>{0.548240662f, 0.115326822f},
-std::array<float,2>{0.174993917f, 0.805604875f},
-std::array<float,2>{0.326547086f, 0.353257537f},
-std::array<float,2>{0.806791306f, 0.662073791f},
-std::array<float,2>{0.979306221f, 0.488076985f},
-std::array<float,2>{0.390913576f, 0.51011467f},
-std::array<float,2>{0.123388596f, 0.14480114f},
-std::array<float,2>{0.737531006f, 0.944778562f},
-std::array<float,2>{0.864213169f, 0.220839322f},
-std::array<float,2>{0.262128323f, 0.933829427f},
-std::array<float,2>{0.23451075f, 0.381122559f},
-std::array<float,2>{0.568840981f, 0.6051929f},
-std::array<float,2>{0.672852278f, 0.287261367f},
-std::array<float,2>{0.00347208511f, 0.745465338f},
-std::array<float,2>{0.490330815f, 0.0199852977f},
-std::array<float,2>{0.910932064f, 0.817622125f},
-std::array<float,2>{0.652295649f, 0.00311073172f},
-std::array<float,2>{0.0550439171f, 0.8366763f},
-std::array<float,2>{0.439302564f, 0.299646944f},
-std::array<float,2>{0.894680262f, 0.726739764f},
-std::array<float,2>{0.824703991f, 0.403884202f},
-std::array<float,2>{0.291497856f, 0.613152981f},
-std::array<float,2>{0.208461568f, 0.24342081f},
-std::array<float,2>{0.607997f, 0.921383321f},
-std::array<float,2>{0.962652743f, 0.129685923f},
-std::array<float,2>{0.41140148f, 0.95766288f},
-std::array<float,2>{0.0743182078f, 0.477484584f},
-std::array<float,2>{0.709729016f, 0.527102947f},
-std::array<float,2>{0.527650774f, 0.362303793f},
-std::array<float,2>{0.132956952f, 0.672833622f},
-std::array<float,2>{0.373891294f, 0.0951962098f},
-std::array<float,2>{0.756418169f, 0.784297049f},
-std::array<float,2>{0.58154732f, 0.21283707f},
-std::array<float,2>{0.228248417f, 0.892136455f},
-std::array<float,2>{0.272838652f, 0.427546054f},
-std::array<float,2>{0.854200542f, 0.56584543f},
-std::array<float,2>{0.926693559f, 0.262881041f},
-std::array<float,2>{0.4793832f, 0.694731236f},
-std::array<float,2>{0.0174584966f, 0.0405141897f},
-std::array<float,2>{0.671654582f, 0.869408369f},
-std::array<float,2>{0.788032889f, 0.07635241f},
-std::array<float,2>{0.332977742f, 0.780247569f},
-std::array<float,2>{0.170416251f, 0.334235132f},
-std::array<float,2>{0.533234358f, 0.635619104f},
-std::array<float,2>{0.730888486f, 0.466747224f},
-std::array<float,2>{0.0953977257f, 0.55349946f},
-std::array<float,2>{0.37929967f, 0.182977185f},
-std::array<float,2>{0.991286576f, 0.978132665f},
-std::array<float,2>{0.676496148f, 0.178251982f},
-std::array<float,2>{0.00514938403f, 0.969926596f},
-std::array<float,2>{0.488203913f, 0.453416914f},
-std::array<float,2>{0.908178687f, 0.556401312f},
-std::array<float,2>{0.859426498f, 0.338327289f},
-std::array<float,2>{0.25925976f, 0.625982225f},
-std::array<float,2>{0.238464877f, 0.066293329f},
-std::array<float,2>{0.562874377f, 0.771689534f},
-std::array<float,2>{0.983440757f, 0.0322387107f},
-std::array<float,2>{0.396224409f, 0.865053713f},
-std::array<float,2>{0.12096867f, 0.254800797f},
-std::array<float,2>{0.739828229f, 0.701461971f},
-std::array<float,2>{0.551121891f, 0.435567945f},
-std::array<float,2>{0.179218426f, 0.576419413f},
-std::array<float,2>{0.320334047f, 0.20370549f},
-std::array<float,2>{0.810357809f, 0.900901318f},
-std::array<float,2>{0.612012863f, 0.107012197f},
-std::array<float,2>{0.202933699f, 0.794963717f},
-std::array<float,2>{0.308631182f, 0.373641074f},
-std::array<float,2>{0.833447516f, 0.681013703f},
-std::array<float,2>{0.875393927f, 0.475864679f},
-std::array<float,2>{0.466225207f, 0.519896507f},
-std::array<float,2>{0.040283639f, 0.133494973f},
-std::array<float,2>{0.626455426f, 0.964348137f},
-std::array<float,2>{0.779225945f, 0.239453733f},
-std::array<float,2>{0.351616919f, 0.907159686f},
-std::array<float,2>{0.148110405f, 0.392986983f},
-std::array<float,2>{0.511104465f, 0.619876206f},
-std::array<float,2>{0.69936806f, 0.306195349f},
-std::array<float,2>{0.0808773413f, 0.724029005f},
-std::array<float,2>{0.437114209f, 0.0105730202f},
-std::array<float,2>{0.938162148f, 0.835922062f},
-std::array<float,2>{0.729563415f, 0.0285647046f},
-std::array<float,2>{0.0982709825f, 0.824661374f},
-std::array<float,2>{0.37520045f, 0.295421153f},
-std::array<float,2>{0.985518575f, 0.739490986f},
-std::array<float,2>{0.782610536f, 0.385356307f},
-std::array<float,2>{0.328229606f, 0.596571863f},
-std::array<float,2>{0.166131526f, 0.227176502f},
-std::array<float,2>{0.536723018f, 0.927672267f},
-std::array<float,2>{0.925405562f, 0.149244294f},
-std::array<float,2>{0.483013093f, 0.950774431f},
-std::array<float,2>{0.0200715382f, 0.499065757f},
-std::array<float,2>{0.664873719f, 0.50350529f},
-std::array<float,2>{0.585461378f, 0.350352645f},
-std::array<float,2>{0.234215155f, 0.667266309f},
-std::array<float,2>{0.268345773f, 0.121456221f},
-std::array<float,2>{0.856699467f, 0.801199615f},
-std::array<float,2>{0.523794532f, 0.19987084f},
-std::array<float,2>{0.137797311f, 0.879353344f},
-std::array<float,2>{0.36756286f, 0.412663609f},
-std::array<float,2>{0.750483334f, 0.591806591f},
-std::array<float,2>{0.96758157f, 0.265664876f},
-std::array<float,2>{0.40924868f, 0.718457878f},
-std::array<float,2>{0.0704501718f, 0.0531824976f},
-std::array<float,2>{0.704563022f, 0.847490013f},
-std::array<float,2>{0.823399186f, 0.0875942931f},
-std::array<float,2>{0.296333939f, 0.757215261f},
-std::array<float,2>{0.206361204f, 0.328072965f},
-std::array<float,2>{0.603337705f, 0.646301448f},
-std::array<float,2>{0.654461086f, 0.439233482f},
-std::array<float,2>{0.0614511147f, 0.544440925f},
-std::array<float,2>{0.444518894f, 0.170206994f},
-std::array<float,2>{0.894311428f, 0.984675348f},
-std::array<float,2>{0.71794337f, 0.223199174f},
-std::array<float,2>{0.0632796735f, 0.930381238f},
-std::array<float,2>{0.415700436f, 0.375860482f},
-std::array<float,2>{0.957195342f, 0.608066618f},
-std::array<float,2>{0.761986196f, 0.281874925f},
-std::array<float,2>{0.361759573f, 0.747099757f},
-std::array<float,2>{0.128948703f, 0.0171070974f},
-std::array<float,2>{0.516717851f, 0.813914776f},
-std::array<float,2>{0.903327584f, 0.111991152f},
-std::array<float,2>{0.451228052f, 0.811372817f},
-std::array<float,2>{0.053994f, 0.357787013f},
-std::array<float,2>{0.646906316f, 0.659961104f},
-std::array<float,2>{0.599754155f, 0.49128291f},
-std::array<float,2>{0.218318313f, 0.514252484f},
-std::array<float,2>{0.281998843f, 0.142488077f},
-std::array<float,2>{0.816703856f, 0.94043386f},
-std::array<float,2>{0.539687037f, 0.0577628054f},
-std::array<float,2>{0.161915243f, 0.85180366f},
-std::array<float,2>{0.343237191f, 0.274632931f},
-std::array<float,2>{0.792301238f, 0.703470111f},
-std::array<float,2>{0.996348262f, 0.419369012f},
-std::array<float,2>{0.387691438f, 0.582816422f},
-std::array<float,2>{0.109321252f, 0.191126525f},
-std::array<float,2>{0.725232542f, 0.886274934f},
-std::array<float,2>{0.844651341f, 0.163935408f},
-std::array<float,2>{0.277437061f, 0.9969908f},
-std::array<float,2>{0.224219844f, 0.450572729f},
-std::array<float,2>{0.588054836f, 0.536089063f},
-std::array<float,2>{0.660315096f, 0.315878034f},
-std::array<float,2>{0.0280281175f, 0.652579844f},
-std::array<float,2>{0.469431549f, 0.0853467807f},
-std::array<float,2>{0.93161118f, 0.764124155f},
-std::array<float,2>{0.633913994f, 0.0712835863f},
-std::array<float,2>{0.0345047154f, 0.773666859f},
-std::array<float,2>{0.460578203f, 0.330308139f},
-std::array<float,2>{0.889098108f, 0.639683127f},
-std::array<float,2>{0.839309752f, 0.464364052f},
-std::array<float,2>{0.299387544f, 0.550711572f},
-std::array<float,2>{0.194543615f, 0.18372643f},
-std::array<float,2>{0.618068993f, 0.983246446f},
-std::array<float,2>{0.947392344f, 0.218246788f},
-std::array<float,2>{0.426303625f, 0.894639492f},
-std::array<float,2>{0.0864053518f, 0.425650507f},
-std::array<float,2>{0.694159746f, 0.57027179f},
-std::array<float,2>{0.501076221f, 0.258561581f},
-std::array<float,2>{0.153931111f, 0.690118134f},
-std::array<float,2>{0.348632753f, 0.0438991003f},
-std::array<float,2>{0.766615093f, 0.874810338f},
-std::array<float,2>{0.576044917f, 0.126553774f},
-std::array<float,2>{0.248476848f, 0.956991673f},
-std::array<float,2>{0.251584828f, 0.481358349f},
-std::array<float,2>{0.874610722f, 0.529515743f},
-std::array<float,2>{0.919055164f, 0.36656335f},
-std::array<float,2>{0.499297202f, 0.676817834f},
-std::array<float,2>{0.0134067349f, 0.100717112f},
-std::array<float,2>{0.68048656f, 0.787344992f},
-std::array<float,2>{0.801977634f, 0.00572525151f},
-std::array<float,2>{0.319532037f, 0.843200326f},
-std::array<float,2>{0.18481192f, 0.304251134f},
-std::array<float,2>{0.556707799f, 0.731972039f},
-std::array<float,2>{0.742898822f, 0.401579767f},
-std::array<float,2>{0.114160769f, 0.615660489f},
-std::array<float,2>{0.403234422f, 0.246355772f},
-std::array<float,2>{0.975837648f, 0.914910734f},
-std::array<float,2>{0.643078387f, 0.209632963f},
-std::array<float,2>{0.0497132391f, 0.90330714f},
-std::array<float,2>{0.448138624f, 0.430269361f},
-std::array<float,2>{0.90208441f, 0.571065962f},
-std::array<float,2>{0.816247582f, 0.250416428f},
-std::array<float,2>{0.286542028f, 0.695883393f},
-std::array<float,2>{0.212757275f, 0.0378847048f},
-std::array<float,2>{0.594226897f, 0.863037229f},
-std::array<float,2>{0.955972672f, 0.0674708113f},
-std::array<float,2>{0.419574589f, 0.767500877f},
-std::array<float,2>{0.0699677095f, 0.34024778f},
-std::array<float,2>{0.711662591f, 0.631022632f},
-std::array<float,2>{0.521909297f, 0.458556384f},
-std::array<float,2>{0.128183305f, 0.560124099f},
-std::array<float,2>{0.364789516f, 0.173936874f},
-std::array<float,2>{0.759873211f, 0.974746704f},
-std::array<float,2>{0.591913223f, 0.0155859785f},
-std::array<float,2>{0.220144287f, 0.829011142f},
-std::array<float,2>{0.27440542f, 0.310543299f},
-std::array<float,2>{0.848859072f, 0.721284211f},
-std::array<float,2>{0.934991896f, 0.395317167f},
-std::array<float,2>{0.474532843f, 0.621956587f},
-std::array<float,2>{0.0271425378f, 0.237389043f},
-std::array<float,2>{0.658665061f, 0.910199881f},
-std::array<float,2>{0.794871151f, 0.138660848f},
-std::array<float,2>{0.336307198f, 0.967171967f},
-std::array<float,2>{0.158852458f, 0.471376717f},
-std::array<float,2>{0.544340491f, 0.517282963f},
-std::array<float,2>{0.722083509f, 0.371067792f},
-std::array<float,2>{0.104467057f, 0.686579168f},
-std::array<float,2>{0.383171499f, 0.103978507f},
-std::array<float,2>{0.99420011f, 0.792006791f},
-std::array<float,2>{0.688018501f, 0.118409239f},
-std::array<float,2>{0.0913526416f, 0.800587475f},
-std::array<float,2>{0.423097849f, 0.344861776f},
-std::array<float,2>{0.950327754f, 0.669316113f},
-std::array<float,2>{0.770737112f, 0.495972574f},
-std::array<float,2>{0.344326586f, 0.506325424f},
-std::array<float,2>{0.150843844f, 0.15453589f},
-std::array<float,2>{0.506342888f, 0.947364092f},
-std::array<float,2>{0.88561517f, 0.233948037f},
-std::array<float,2>{0.455879241f, 0.923428893f},
-std::array<float,2>{0.0385978706f, 0.388584882f},
-std::array<float,2>{0.638090909f, 0.597773552f},
-std::array<float,2>{0.624650598f, 0.289435506f},
-std::array<float,2>{0.191366404f, 0.735624194f},
-std::array<float,2>{0.303022206f, 0.0246270765f},
-std::array<float,2>{0.839960098f, 0.821157038f},
-std::array<float,2>{0.560853958f, 0.165348798f},
-std::array<float,2>{0.183155254f, 0.988632321f},
-std::array<float,2>{0.313728243f, 0.442844599f},
-std::array<float,2>{0.799034536f, 0.542358398f},
-std::array<float,2>{0.971845865f, 0.323203415f},
-std::array<float,2>{0.399133861f, 0.642179489f},
-std::array<float,2>{0.10992498f, 0.0927212015f},
-std::array<float,2>{0.749767601f, 0.750297368f},
-std::array<float,2>{0.870194733f, 0.0477091633f},
-std::array<float,2>{0.25758478f, 0.850584269f},
-std::array<float,2>{0.243581742f, 0.272470444f},
-std::array<float,2>{0.571705699f, 0.712974548f},
-std::array<float,2>{0.685223639f, 0.409402579f},
-std::array<float,2>{0.00961469766f, 0.587520897f},
-std::array<float,2>{0.495481193f, 0.197046995f},
-std::array<float,2>{0.915793896f, 0.875498354f},
-std::array<float,2>{0.735342622f, 0.147958547f},
-std::array<float,2>{0.121606119f, 0.941500843f},
-std::array<float,2>{0.393261611f, 0.485937208f},
-std::array<float,2>{0.978429556f, 0.508635283f},
-std::array<float,2>{0.806525111f, 0.353974998f},
-std::array<float,2>{0.324560255f, 0.662813008f},
-std::array<float,2>{0.172033191f, 0.113689132f},
-std::array<float,2>{0.549425602f, 0.807002008f},
-std::array<float,2>{0.91288054f, 0.0222602934f},
-std::array<float,2>{0.489752114f, 0.820044339f},
-std::array<float,2>{0.00057015894f, 0.286152661f},
-std::array<float,2>{0.67466867f, 0.743533671f},
-std::array<float,2>{0.567597091f, 0.379861683f},
-std::array<float,2>{0.238219246f, 0.603247166f},
-std::array<float,2>{0.264197439f, 0.21940726f},
-std::array<float,2>{0.865687311f, 0.935572922f},
-std::array<float,2>{0.515402317f, 0.0812571272f},
-std::array<float,2>{0.14223133f, 0.757831395f},
-std::array<float,2>{0.356958836f, 0.317812562f},
-std::array<float,2>{0.77626884f, 0.650429308f},
-std::array<float,2>{0.943182409f, 0.448795676f},
-std::array<float,2>{0.430075139f, 0.533530712f},
-std::array<float,2>{0.0820436776f, 0.159140304f},
-std::array<float,2>{0.696161091f, 0.992592156f},
-std::array<float,2>{0.830388844f, 0.194424585f},
-std::array<float,2>{0.305774748f, 0.886811554f},
-std::array<float,2>{0.198402375f, 0.417313278f},
-std::array<float,2>{0.614001095f, 0.581504166f},
-std::array<float,2>{0.629952431f, 0.280566305f},
-std::array<float,2>{0.0430040397f, 0.708896697f},
-std::array<float,2>{0.462162733f, 0.0591004156f},
-std::array<float,2>{0.880845964f, 0.859217882f},
-std::array<float,2>{0.668562412f, 0.0411656611f},
-std::array<float,2>{0.0191158969f, 0.869026482f},
-std::array<float,2>{0.476716369f, 0.264032632f},
-std::array<float,2>{0.928123772f, 0.691573739f},
-std::array<float,2>{0.851626158f, 0.428838283f},
-std::array<float,2>{0.270442992f, 0.563301623f},
-std::array<float,2>{0.228654981f, 0.213516846f},
-std::array<float,2>{0.580049276f, 0.894316494f},
-std::array<float,2>{0.988830507f, 0.181438267f},
-std::array<float,2>{0.380907625f, 0.979994893f},
-std::array<float,2>{0.0976509452f, 0.467666507f},
-std::array<float,2>{0.732946634f, 0.552139282f},
-std::array<float,2>{0.531470478f, 0.333294064f},
-std::array<float,2>{0.169792682f, 0.634094596f},
-std::array<float,2>{0.335416079f, 0.0761144236f},
-std::array<float,2>{0.785493374f, 0.777519464f},
-std::array<float,2>{0.605964005f, 0.24608463f},
-std::array<float,2>{0.209276259f, 0.919316828f},
-std::array<float,2>{0.289492995f, 0.405692101f},
-std::array<float,2>{0.827992141f, 0.609770417f},
-std::array<float,2>{0.898183405f, 0.29853034f},
-std::array<float,2>{0.439781755f, 0.730397463f},
-std::array<float,2>{0.0576502495f, 0.00180218497f},
-std::array<float,2>{0.648936033f, 0.839468718f},
-std::array<float,2>{0.755385399f, 0.0971039012f},
-std::array<float,2>{0.372010618f, 0.782360137f},
-std::array<float,2>{0.135279164f, 0.36026594f},
-std::array<float,2>{0.52943486f, 0.675717533f},
-std::array<float,2>{0.707444072f, 0.479400337f},
-std::array<float,2>{0.0762278885f, 0.523533046f},
-std::array<float,2>{0.413577586f, 0.132040545f},
-std::array<float,2>{0.963595927f, 0.959693134f},
-std::array<float,2>{0.665957749f, 0.151318356f},
-std::array<float,2>{0.0207770076f, 0.953039706f},
-std::array<float,2>{0.484333128f, 0.497787803f},
-std::array<float,2>{0.923961222f, 0.50048399f},
-std::array<float,2>{0.855747461f, 0.3488006f},
-std::array<float,2>{0.269390672f, 0.664551556f},
-std::array<float,2>{0.232677728f, 0.123707168f},
-std::array<float,2>{0.584693432f, 0.804245412f},
-std::array<float,2>{0.98477757f, 0.0311786178f},
-std::array<float,2>{0.376306891f, 0.8272838f},
-std::array<float,2>{0.0987727717f, 0.293629646f},
-std::array<float,2>{0.729145825f, 0.740768909f},
-std::array<float,2>{0.535275519f, 0.384468645f},
-std::array<float,2>{0.167827398f, 0.595373333f},
-std::array<float,2>{0.329719692f, 0.230017602f},
-std::array<float,2>{0.781295061f, 0.929502606f},
-std::array<float,2>{0.602237225f, 0.088823922f},
-std::array<float,2>{0.205524862f, 0.754707813f},
-std::array<float,2>{0.295261025f, 0.325332195f},
-std::array<float,2>{0.822978437f, 0.648046255f},
-std::array<float,2>{0.89291048f, 0.440507621f},
-std::array<float,2>{0.444060445f, 0.545785964f},
-std::array<float,2>{0.0615871362f, 0.169247165f},
-std::array<float,2>{0.655412912f, 0.987718105f},
-std::array<float,2>{0.751214921f, 0.202078715f},
-std::array<float,2>{0.36842972f, 0.881379426f},
-std::array<float,2>{0.1372547f, 0.410169363f},
-std::array<float,2>{0.52466023f, 0.589958012f},
-std::array<float,2>{0.703323722f, 0.26875329f},
-std::array<float,2>{0.0719818547f, 0.716735542f},
-std::array<float,2>{0.40893814f, 0.0515495017f},
-std::array<float,2>{0.968330562f, 0.844456017f},
-std::array<float,2>{0.739150584f, 0.0339458734f},
-std::array<float,2>{0.119871408f, 0.866952002f},
-std::array<float,2>{0.394839048f, 0.256688386f},
-std::array<float,2>{0.983192921f, 0.700415254f},
-std::array<float,2>{0.809518158f, 0.435263813f},
-std::array<float,2>{0.321681261f, 0.575509727f},
-std::array<float,2>{0.178199872f, 0.206818923f},
-std::array<float,2>{0.551847994f, 0.898867428f},
-std::array<float,2>{0.906386673f, 0.17639637f},
-std::array<float,2>{0.487102211f, 0.971300483f},
-std::array<float,2>{0.00458316226f, 0.456018329f},
-std::array<float,2>{0.677146018f, 0.557625771f},
-std::array<float,2>{0.564131856f, 0.337283492f},
-std::array<float,2>{0.239652619f, 0.628451169f},
-std::array<float,2>{0.258408874f, 0.062560305f},
-std::array<float,2>{0.860836804f, 0.770773053f},
-std::array<float,2>{0.510362029f, 0.240462646f},
-std::array<float,2>{0.146635741f, 0.909470022f},
-std::array<float,2>{0.353159457f, 0.392430216f},
-std::array<float,2>{0.778006196f, 0.617249548f},
-std::array<float,2>{0.939383447f, 0.306734025f},
-std::array<float,2>{0.435611606f, 0.726486444f},
-std::array<float,2>{0.0819114149f, 0.00929192081f},
-std::array<float,2>{0.700515091f, 0.832323909f},
-std::array<float,2>{0.832126975f, 0.108994476f},
-std::array<float,2>{0.310172319f, 0.793651998f},
-std::array<float,2>{0.201323211f, 0.372413158f},
-std::array<float,2>{0.613195539f, 0.681954086f},
-std::array<float,2>{0.625169039f, 0.474168837f},
-std::array<float,2>{0.0391724743f, 0.522284389f},
-std::array<float,2>{0.46493119f, 0.135103643f},
-std::array<float,2>{0.876194775f, 0.962553263f},
-std::array<float,2>{0.694797754f, 0.214874268f},
-std::array<float,2>{0.087343961f, 0.898024082f},
-std::array<float,2>{0.427167296f, 0.422170848f},
-std::array<float,2>{0.94886893f, 0.56645447f},
-std::array<float,2>{0.766552567f, 0.260808587f},
-std::array<float,2>{0.348761827f, 0.687562644f},
-std::array<float,2>{0.152882904f, 0.046495609f},
-std::array<float,2>{0.500863373f, 0.871578574f},
-std::array<float,2>{0.890246272f, 0.0735595971f},
-std::array<float,2>{0.459500819f, 0.775989532f},
-std::array<float,2>{0.0338198207f, 0.328412652f},
-std::array<float,2>{0.63315022f, 0.638618112f},
-std::array<float,2>{0.618919909f, 0.461695552f},
-std::array<float,2>{0.193773955f, 0.547888756f},
-std::array<float,2>{0.30023405f, 0.18678543f},
-std::array<float,2>{0.83814019f, 0.982275724f},
-std::array<float,2>{0.55809927f, 0.00664007943f},
-std::array<float,2>{0.184200168f, 0.840633035f},
-std::array<float,2>{0.318447739f, 0.302097261f},
-std::array<float,2>{0.800890923f, 0.732507646f},
-std::array<float,2>{0.975002885f, 0.399197906f},
-std::array<float,2>{0.403386086f, 0.613356113f},
-std::array<float,2>{0.114813745f, 0.248688951f},
-std::array<float,2>{0.743312895f, 0.916058779f},
-std::array<float,2>{0.873688102f, 0.127922505f},
-std::array<float,2>{0.250414461f, 0.953508794f},
-std::array<float,2>{0.24921833f, 0.483206153f},
-std::array<float,2>{0.574364483f, 0.528341293f},
-std::array<float,2>{0.680980623f, 0.363981545f},
-std::array<float,2>{0.0118406769f, 0.678366482f},
-std::array<float,2>{0.498372108f, 0.0977068767f},
-std::array<float,2>{0.918779254f, 0.785984099f},
-std::array<float,2>{0.648031056f, 0.109469302f},
-std::array<float,2>{0.0527771227f, 0.809563816f},
-std::array<float,2>{0.452585846f, 0.356590748f},
-std::array<float,2>{0.90308708f, 0.656568825f},
-std::array<float,2>{0.817422271f, 0.489196509f},
-std::array<float,2>{0.282973379f, 0.512183487f},
-std::array<float,2>{0.217282027f, 0.14436236f},
-std::array<float,2>{0.600802004f, 0.939089894f},
-std::array<float,2>{0.958484411f, 0.225990847f},
-std::array<float,2>{0.415019333f, 0.932108939f},
-std::array<float,2>{0.0634944662f, 0.378473401f},
-std::array<float,2>{0.717196167f, 0.606111944f},
-std::array<float,2>{0.515933454f, 0.28328535f},
-std::array<float,2>{0.130848199f, 0.749145269f},
-std::array<float,2>{0.362736464f, 0.0184857938f},
-std::array<float,2>{0.762701511f, 0.816238284f},
-std::array<float,2>{0.589590192f, 0.161230609f},
-std::array<float,2>{0.223570555f, 0.998852611f},
-std::array<float,2>{0.279204488f, 0.452250689f},
-std::array<float,2>{0.845053136f, 0.537769973f},
-std::array<float,2>{0.929894805f, 0.313597292f},
-std::array<float,2>{0.470585495f, 0.65431869f},
-std::array<float,2>{0.0288936887f, 0.0828883797f},
-std::array<float,2>{0.661935747f, 0.762756705f},
-std::array<float,2>{0.791113794f, 0.0560599566f},
-std::array<float,2>{0.342220545f, 0.853901863f},
-std::array<float,2>{0.160460964f, 0.276055962f},
-std::array<float,2>{0.54036963f, 0.70537436f},
-std::array<float,2>{0.725615501f, 0.420333028f},
-std::array<float,2>{0.107980676f, 0.584025145f},
-std::array<float,2>{0.388657242f, 0.189258307f},
-std::array<float,2>{0.997078717f, 0.883958459f},
-std::array<float,2>{0.636943758f, 0.231796488f},
-std::array<float,2>{0.037459705f, 0.924585283f},
-std::array<float,2>{0.456367552f, 0.389122486f},
-std::array<float,2>{0.886172831f, 0.600108922f},
-std::array<float,2>{0.841727436f, 0.291095465f},
-std::array<float,2>{0.304162085f, 0.736805797f},
-std::array<float,2>{0.189563096f, 0.026555961f},
-std::array<float,2>{0.624019325f, 0.823105216f},
-std::array<float,2>{0.949569702f, 0.119505018f},
-std::array<float,2>{0.422192067f, 0.798026085f},
-std::array<float,2>{0.0901440233f, 0.346608311f},
-std::array<float,2>{0.689173043f, 0.671207488f},
-std::array<float,2>{0.507517815f, 0.492237687f},
-std::array<float,2>{0.151511788f, 0.505025685f},
-std::array<float,2>{0.345645249f, 0.153900683f},
-std::array<float,2>{0.770098627f, 0.945513666f},
-std::array<float,2>{0.570994198f, 0.0501574464f},
-std::array<float,2>{0.242697939f, 0.848676503f},
-std::array<float,2>{0.256208718f, 0.270508021f},
-std::array<float,2>{0.86921066f, 0.711794376f},
-std::array<float,2>{0.914444208f, 0.407949805f},
-std::array<float,2>{0.494774908f, 0.588571131f},
-std::array<float,2>{0.00869726855f, 0.197375834f},
-std::array<float,2>{0.684241533f, 0.877977192f},
-std::array<float,2>{0.800382137f, 0.166459084f},
-std::array<float,2>{0.312943161f, 0.991734922f},
-std::array<float,2>{0.181842625f, 0.443386883f},
-std::array<float,2>{0.561953485f, 0.540938914f},
-std::array<float,2>{0.748396039f, 0.320774794f},
-std::array<float,2>{0.111092634f, 0.644221187f},
-std::array<float,2>{0.400268763f, 0.0917444453f},
-std::array<float,2>{0.971031725f, 0.752685606f},
-std::array<float,2>{0.712432384f, 0.0685494766f},
-std::array<float,2>{0.0692642108f, 0.768008888f},
-std::array<float,2>{0.418161899f, 0.343644649f},
-std::array<float,2>{0.956853151f, 0.630762994f},
-std::array<float,2>{0.760964513f, 0.460542142f},
-std::array<float,2>{0.36379239f, 0.562455654f},
-std::array<float,2>{0.127558529f, 0.172494352f},
-std::array<float,2>{0.522746027f, 0.974545538f},
-std::array<float,2>{0.900432527f, 0.208867878f},
-std::array<float,2>{0.449053556f, 0.904440224f},
-std::array<float,2>{0.0505032316f, 0.432028353f},
-std::array<float,2>{0.644225478f, 0.573015332f},
-std::array<float,2>{0.595060647f, 0.252478182f},
-std::array<float,2>{0.211821437f, 0.698416293f},
-std::array<float,2>{0.286106646f, 0.0353681631f},
-std::array<float,2>{0.815258682f, 0.860055625f},
-std::array<float,2>{0.543914795f, 0.139022142f},
-std::array<float,2>{0.16011852f, 0.96642524f},
-std::array<float,2>{0.337319434f, 0.470239967f},
-std::array<float,2>{0.793072581f, 0.517791927f},
-std::array<float,2>{0.995989919f, 0.368795425f},
-std::array<float,2>{0.383844793f, 0.683910668f},
-std::array<float,2>{0.104713909f, 0.101707332f},
-std::array<float,2>{0.720826805f, 0.789805949f},
-std::array<float,2>{0.847761214f, 0.011957787f},
-std::array<float,2>{0.27482596f, 0.830867529f},
-std::array<float,2>{0.218932435f, 0.31187439f},
-std::array<float,2>{0.592793822f, 0.719857395f},
-std::array<float,2>{0.659788132f, 0.396778196f},
-std::array<float,2>{0.0260788072f, 0.623337924f},
-std::array<float,2>{0.47287491f, 0.235189706f},
-std::array<float,2>{0.934511125f, 0.912921727f},
-std::array<float,2>{0.733808517f, 0.181962565f},
-std::array<float,2>{0.0959071144f, 0.977516711f},
-std::array<float,2>{0.382286161f, 0.46500957f},
-std::array<float,2>{0.989474416f, 0.553735554f},
-std::array<float,2>{0.786458075f, 0.33588779f},
-std::array<float,2>{0.334532768f, 0.63671267f},
-std::array<float,2>{0.168084428f, 0.077671729f},
-std::array<float,2>{0.532892227f, 0.78030324f},
-std::array<float,2>{0.929567814f, 0.0392477028f},
-std::array<float,2>{0.477916509f, 0.870414793f},
-std::array<float,2>{0.0179401506f, 0.262308955f},
-std::array<float,2>{0.669853091f, 0.694031954f},
-std::array<float,2>{0.578509629f, 0.426639467f},
-std::array<float,2>{0.230248764f, 0.564605534f},
-std::array<float,2>{0.270935595f, 0.211792782f},
-std::array<float,2>{0.853370905f, 0.89158535f},
-std::array<float,2>{0.5309093f, 0.094370611f},
-std::array<float,2>{0.135997757f, 0.78354001f},
-std::array<float,2>{0.372414589f, 0.362431467f},
-std::array<float,2>{0.754417539f, 0.672859132f},
-std::array<float,2>{0.964317083f, 0.47792837f},
-std::array<float,2>{0.412827492f, 0.526260734f},
-std::array<float,2>{0.0776100457f, 0.130097419f},
-std::array<float,2>{0.708751738f, 0.958459854f},
-std::array<float,2>{0.826645255f, 0.242586091f},
-std::array<float,2>{0.290501744f, 0.920479298f},
-std::array<float,2>{0.210233942f, 0.402861387f},
-std::array<float,2>{0.606609881f, 0.612178981f},
-std::array<float,2>{0.649643302f, 0.300248086f},
-std::array<float,2>{0.0570294075f, 0.7283113f},
-std::array<float,2>{0.441357434f, 0.00284519722f},
-std::array<float,2>{0.897114933f, 0.837214887f},
-std::array<float,2>{0.675426126f, 0.0206521787f},
-std::array<float,2>{0.00173340749f, 0.816559136f},
-std::array<float,2>{0.488684177f, 0.28882429f},
-std::array<float,2>{0.913295805f, 0.744404793f},
-std::array<float,2>{0.866642594f, 0.381981403f},
-std::array<float,2>{0.265141398f, 0.603713334f},
-std::array<float,2>{0.236433506f, 0.222578555f},
-std::array<float,2>{0.566838443f, 0.935175419f},
-std::array<float,2>{0.97731775f, 0.145552233f},
-std::array<float,2>{0.394197643f, 0.943411946f},
-std::array<float,2>{0.122351602f, 0.486836761f},
-std::array<float,2>{0.735679984f, 0.511246145f},
-std::array<float,2>{0.550358653f, 0.351774573f},
-std::array<float,2>{0.17327258f, 0.66089344f},
-std::array<float,2>{0.325529397f, 0.11701066f},
-std::array<float,2>{0.805203199f, 0.806244493f},
-std::array<float,2>{0.614876568f, 0.191606447f},
-std::array<float,2>{0.198048085f, 0.890407324f},
-std::array<float,2>{0.305222213f, 0.415608108f},
-std::array<float,2>{0.831370711f, 0.578403711f},
-std::array<float,2>{0.87909472f, 0.278348327f},
-std::array<float,2>{0.461412996f, 0.709034324f},
-std::array<float,2>{0.0445167795f, 0.0608607791f},
-std::array<float,2>{0.629172087f, 0.857181191f},
-std::array<float,2>{0.777124941f, 0.0794796273f},
-std::array<float,2>{0.355861217f, 0.760849059f},
-std::array<float,2>{0.141564012f, 0.320304573f},
-std::array<float,2>{0.514514148f, 0.648881674f},
-std::array<float,2>{0.696441233f, 0.44652319f},
-std::array<float,2>{0.0838947296f, 0.531577706f},
-std::array<float,2>{0.431040615f, 0.157226115f},
-std::array<float,2>{0.941940963f, 0.994374931f},
-std::array<float,2>{0.652825236f, 0.171480045f},
-std::array<float,2>{0.0595185868f, 0.98574245f},
-std::array<float,2>{0.442655057f, 0.43789643f},
-std::array<float,2>{0.891246021f, 0.543651104f},
-std::array<float,2>{0.822018743f, 0.326965898f},
-std::array<float,2>{0.293196231f, 0.645035446f},
-std::array<float,2>{0.20349358f, 0.0865255296f},
-std::array<float,2>{0.604394495f, 0.756578505f},
-std::array<float,2>{0.966247082f, 0.0540704988f},
-std::array<float,2>{0.407325685f, 0.846330702f},
-std::array<float,2>{0.0725630596f, 0.26750493f},
-std::array<float,2>{0.706893623f, 0.717737019f},
-std::array<float,2>{0.526803136f, 0.413697898f},
-std::array<float,2>{0.139023781f, 0.593610585f},
-std::array<float,2>{0.370354295f, 0.200732216f},
-std::array<float,2>{0.753078341f, 0.880372107f},
-std::array<float,2>{0.582445681f, 0.122290365f},
-std::array<float,2>{0.231288791f, 0.802678108f},
-std::array<float,2>{0.267283291f, 0.350988001f},
-std::array<float,2>{0.857688606f, 0.66603303f},
-std::array<float,2>{0.921996534f, 0.498490453f},
-std::array<float,2>{0.480711937f, 0.502791524f},
-std::array<float,2>{0.0218193829f, 0.149525911f},
-std::array<float,2>{0.666730523f, 0.949953496f},
-std::array<float,2>{0.784070551f, 0.227655545f},
-std::array<float,2>{0.330293238f, 0.92582798f},
-std::array<float,2>{0.165049866f, 0.386384368f},
-std::array<float,2>{0.53722775f, 0.597010314f},
-std::array<float,2>{0.726604104f, 0.296472132f},
-std::array<float,2>{0.100715213f, 0.738432229f},
-std::array<float,2>{0.378834814f, 0.0279290844f},
-std::array<float,2>{0.986569762f, 0.82593298f},
-std::array<float,2>{0.702759326f, 0.0110845948f},
-std::array<float,2>{0.0787941068f, 0.834254324f},
-std::array<float,2>{0.434960306f, 0.305038929f},
-std::array<float,2>{0.941028595f, 0.723542631f},
-std::array<float,2>{0.780663967f, 0.393566817f},
-std::array<float,2>{0.354135931f, 0.620507002f},
-std::array<float,2>{0.14473246f, 0.238821521f},
-std::array<float,2>{0.509564161f, 0.907850802f},
-std::array<float,2>{0.876959324f, 0.134354532f},
-std::array<float,2>{0.468638092f, 0.96365726f},
-std::array<float,2>{0.0414815992f, 0.474813014f},
-std::array<float,2>{0.628658891f, 0.521063924f},
-std::array<float,2>{0.610482454f, 0.374337763f},
-std::array<float,2>{0.201132685f, 0.680639684f},
-std::array<float,2>{0.311506599f, 0.105920762f},
-std::array<float,2>{0.834573805f, 0.796754837f},
-std::array<float,2>{0.554513037f, 0.204142466f},
-std::array<float,2>{0.176344454f, 0.901885986f},
-std::array<float,2>{0.322875708f, 0.436883777f},
-std::array<float,2>{0.810702205f, 0.577815175f},
-std::array<float,2>{0.981419623f, 0.255690813f},
-std::array<float,2>{0.3978706f, 0.702456295f},
-std::array<float,2>{0.118322402f, 0.0319121815f},
-std::array<float,2>{0.741920471f, 0.863435388f},
-std::array<float,2>{0.862384498f, 0.0647641197f},
-std::array<float,2>{0.260664403f, 0.772698283f},
-std::array<float,2>{0.240431592f, 0.339066863f},
-std::array<float,2>{0.56602937f, 0.625240445f},
-std::array<float,2>{0.67954582f, 0.454665571f},
-std::array<float,2>{0.00609391183f, 0.555320024f},
-std::array<float,2>{0.486299217f, 0.178795785f},
-std::array<float,2>{0.909757257f, 0.968849719f},
-std::array<float,2>{0.746012032f, 0.247844756f},
-std::array<float,2>{0.116543956f, 0.915860176f},
-std::array<float,2>{0.404730976f, 0.400875479f},
-std::array<float,2>{0.972907007f, 0.616312623f},
-std::array<float,2>{0.804027617f, 0.303078979f},
-std::array<float,2>{0.317538977f, 0.730938077f},
-std::array<float,2>{0.18671757f, 0.00460149162f},
-std::array<float,2>{0.556100309f, 0.84243077f},
-std::array<float,2>{0.921267033f, 0.100232065f},
-std::array<float,2>{0.497660428f, 0.788402796f},
-std::array<float,2>{0.0142812887f, 0.365577012f},
-std::array<float,2>{0.681764305f, 0.676018655f},
-std::array<float,2>{0.576661766f, 0.481574178f},
-std::array<float,2>{0.248034701f, 0.530322433f},
-std::array<float,2>{0.252329588f, 0.125850618f},
-std::array<float,2>{0.872728705f, 0.955224752f},
-std::array<float,2>{0.502464533f, 0.0446178094f},
-std::array<float,2>{0.154378548f, 0.873100221f},
-std::array<float,2>{0.350716799f, 0.258938074f},
-std::array<float,2>{0.767607987f, 0.69118911f},
-std::array<float,2>{0.946787775f, 0.423954427f},
-std::array<float,2>{0.427879065f, 0.568744898f},
-std::array<float,2>{0.088710539f, 0.217135936f},
-std::array<float,2>{0.69286114f, 0.896241367f},
-std::array<float,2>{0.837498724f, 0.185079873f},
-std::array<float,2>{0.29806748f, 0.983914912f},
-std::array<float,2>{0.193287656f, 0.462973207f},
-std::array<float,2>{0.619850814f, 0.549600005f},
-std::array<float,2>{0.635997295f, 0.331748337f},
-std::array<float,2>{0.0316545218f, 0.638842583f},
-std::array<float,2>{0.457709968f, 0.0714594424f},
-std::array<float,2>{0.888371527f, 0.774771035f},
-std::array<float,2>{0.663212001f, 0.0841023251f},
-std::array<float,2>{0.030148752f, 0.764755189f},
-std::array<float,2>{0.470968604f, 0.314765394f},
-std::array<float,2>{0.932179987f, 0.653730214f},
-std::array<float,2>{0.847110569f, 0.449690878f},
-std::array<float,2>{0.280206174f, 0.536973655f},
-std::array<float,2>{0.22645779f, 0.162470549f},
-std::array<float,2>{0.587420881f, 0.997181475f},
-std::array<float,2>{0.999043167f, 0.189707384f},
-std::array<float,2>{0.38961795f, 0.884827197f},
-std::array<float,2>{0.106090188f, 0.418058872f},
-std::array<float,2>{0.723735034f, 0.583774507f},
-std::array<float,2>{0.541697085f, 0.274372011f},
-std::array<float,2>{0.163037732f, 0.704613388f},
-std::array<float,2>{0.341171682f, 0.0575005524f},
-std::array<float,2>{0.789641798f, 0.853350341f},
-std::array<float,2>{0.599003613f, 0.141529039f},
-std::array<float,2>{0.215394139f, 0.939549923f},
-std::array<float,2>{0.2840738f, 0.491125017f},
-std::array<float,2>{0.819050312f, 0.515011787f},
-std::array<float,2>{0.904880106f, 0.359321713f},
-std::array<float,2>{0.450459003f, 0.658551872f},
-std::array<float,2>{0.0523839816f, 0.112728767f},
-std::array<float,2>{0.646259904f, 0.811755359f},
-std::array<float,2>{0.765037179f, 0.0163255353f},
-std::array<float,2>{0.361214221f, 0.813430488f},
-std::array<float,2>{0.131499887f, 0.282229155f},
-std::array<float,2>{0.517653763f, 0.746100724f},
-std::array<float,2>{0.716496706f, 0.376456738f},
-std::array<float,2>{0.0651079863f, 0.60868746f},
-std::array<float,2>{0.417478144f, 0.22433579f},
-std::array<float,2>{0.960743845f, 0.930773258f},
-std::array<float,2>{0.68683213f, 0.195549622f},
-std::array<float,2>{0.0112443259f, 0.876371443f},
-std::array<float,2>{0.492479712f, 0.409172416f},
-std::array<float,2>{0.917212665f, 0.586791039f},
-std::array<float,2>{0.867702961f, 0.271619409f},
-std::array<float,2>{0.254609317f, 0.713963449f},
-std::array<float,2>{0.245251358f, 0.0483858511f},
-std::array<float,2>{0.572996438f, 0.850862384f},
-std::array<float,2>{0.969257951f, 0.0934627354f},
-std::array<float,2>{0.401564717f, 0.751394928f},
-std::array<float,2>{0.112306893f, 0.3236866f},
-std::array<float,2>{0.747673988f, 0.640638232f},
-std::array<float,2>{0.560361385f, 0.441541463f},
-std::array<float,2>{0.18039605f, 0.541843832f},
-std::array<float,2>{0.315915436f, 0.164359495f},
-std::array<float,2>{0.797013819f, 0.989953578f},
-std::array<float,2>{0.622585475f, 0.0242632031f},
-std::array<float,2>{0.188119262f, 0.82142359f},
-std::array<float,2>{0.302631408f, 0.290773422f},
-std::array<float,2>{0.843409359f, 0.734436333f},
-std::array<float,2>{0.8833974f, 0.387339145f},
-std::array<float,2>{0.454759955f, 0.598852396f},
-std::array<float,2>{0.0367229916f, 0.232598841f},
-std::array<float,2>{0.639171183f, 0.922634363f},
-std::array<float,2>{0.772503674f, 0.15569295f},
-std::array<float,2>{0.347091079f, 0.948680818f},
-std::array<float,2>{0.149185464f, 0.494178981f},
-std::array<float,2>{0.504247725f, 0.507369339f},
-std::array<float,2>{0.68978864f, 0.344042927f},
-std::array<float,2>{0.0926746428f, 0.668907762f},
-std::array<float,2>{0.425057292f, 0.118107662f},
-std::array<float,2>{0.951459825f, 0.799559951f},
-std::array<float,2>{0.720039546f, 0.104723573f},
-std::array<float,2>{0.102681503f, 0.791539669f},
-std::array<float,2>{0.384897888f, 0.369199425f},
-std::array<float,2>{0.993338227f, 0.685700893f},
-std::array<float,2>{0.795407414f, 0.47183767f},
-std::array<float,2>{0.338994801f, 0.516242862f},
-std::array<float,2>{0.156862363f, 0.137466982f},
-std::array<float,2>{0.546289563f, 0.968277097f},
-std::array<float,2>{0.935859084f, 0.23678501f},
-std::array<float,2>{0.474956989f, 0.911365271f},
-std::array<float,2>{0.0242271964f, 0.396059781f},
-std::array<float,2>{0.656350493f, 0.622660697f},
-std::array<float,2>{0.589872241f, 0.309332252f},
-std::array<float,2>{0.2222545f, 0.722347915f},
-std::array<float,2>{0.276416719f, 0.0138602247f},
-std::array<float,2>{0.849765837f, 0.829761624f},
-std::array<float,2>{0.520363808f, 0.174901679f},
-std::array<float,2>{0.125181988f, 0.976262093f},
-std::array<float,2>{0.36540401f, 0.457747549f},
-std::array<float,2>{0.758442104f, 0.559437096f},
-std::array<float,2>{0.95391047f, 0.341452807f},
-std::array<float,2>{0.420582741f, 0.631939769f},
-std::array<float,2>{0.066625677f, 0.06683743f},
-std::array<float,2>{0.71289432f, 0.765729606f},
-std::array<float,2>{0.81262356f, 0.0389036871f},
-std::array<float,2>{0.288571566f, 0.862085342f},
-std::array<float,2>{0.213045314f, 0.251620144f},
-std::array<float,2>{0.59701848f, 0.69640249f},
-std::array<float,2>{0.640962899f, 0.431316942f},
-std::array<float,2>{0.04786532f, 0.571696877f},
-std::array<float,2>{0.446721673f, 0.210705414f},
-std::array<float,2>{0.898950875f, 0.903765142f},
-std::array<float,2>{0.710415244f, 0.131103903f},
-std::array<float,2>{0.0756208971f, 0.960061848f},
-std::array<float,2>{0.410477579f, 0.479519039f},
-std::array<float,2>{0.961230874f, 0.52509892f},
-std::array<float,2>{0.757033229f, 0.36104688f},
-std::array<float,2>{0.374652267f, 0.674655557f},
-std::array<float,2>{0.134406149f, 0.0961285755f},
-std::array<float,2>{0.529249549f, 0.782165408f},
-std::array<float,2>{0.895604014f, 1.00704929e-05f},
-std::array<float,2>{0.437866539f, 0.838576257f},
-std::array<float,2>{0.05656166f, 0.297748178f},
-std::array<float,2>{0.651051521f, 0.728760242f},
-std::array<float,2>{0.609103143f, 0.40513128f},
-std::array<float,2>{0.207271412f, 0.610654712f},
-std::array<float,2>{0.292455792f, 0.244792938f},
-std::array<float,2>{0.82600832f, 0.918694556f},
-std::array<float,2>{0.535133481f, 0.0748577937f},
-std::array<float,2>{0.171768785f, 0.778740525f},
-std::array<float,2>{0.333966941f, 0.332142621f},
-std::array<float,2>{0.78898561f, 0.633485496f},
-std::array<float,2>{0.990853608f, 0.468280613f},
-std::array<float,2>{0.380313039f, 0.55106467f},
-std::array<float,2>{0.0941978842f, 0.17975612f},
-std::array<float,2>{0.731770694f, 0.979419768f},
-std::array<float,2>{0.85541141f, 0.214158252f},
-std::array<float,2>{0.271674991f, 0.89320004f},
-std::array<float,2>{0.226687521f, 0.428340912f},
-std::array<float,2>{0.580155551f, 0.56378752f},
-std::array<float,2>{0.670186818f, 0.264834583f},
-std::array<float,2>{0.0160886832f, 0.692997158f},
-std::array<float,2>{0.479593813f, 0.042932976f},
-std::array<float,2>{0.926888883f, 0.867279291f},
-std::array<float,2>{0.632186055f, 0.0597984418f},
-std::array<float,2>{0.0468200371f, 0.857748985f},
-std::array<float,2>{0.464765042f, 0.279450417f},
-std::array<float,2>{0.882284105f, 0.707920372f},
-std::array<float,2>{0.82924968f, 0.416132271f},
-std::array<float,2>{0.30830583f, 0.580392182f},
-std::array<float,2>{0.195901796f, 0.193533465f},
-std::array<float,2>{0.616779149f, 0.887757599f},
-std::array<float,2>{0.943770111f, 0.159998372f},
-std::array<float,2>{0.432779372f, 0.993225276f},
-std::array<float,2>{0.0850448906f, 0.447919518f},
-std::array<float,2>{0.698023498f, 0.535012603f},
-std::array<float,2>{0.511805296f, 0.317088097f},
-std::array<float,2>{0.142614022f, 0.65216279f},
-std::array<float,2>{0.35840866f, 0.0806503147f},
-std::array<float,2>{0.774682343f, 0.759679139f},
-std::array<float,2>{0.570160091f, 0.220545962f},
-std::array<float,2>{0.235616997f, 0.937479854f},
-std::array<float,2>{0.263005853f, 0.380539626f},
-std::array<float,2>{0.864944577f, 0.602140009f},
-std::array<float,2>{0.912055373f, 0.285857081f},
-std::array<float,2>{0.491259962f, 0.742598295f},
-std::array<float,2>{0.00243779784f, 0.0230641812f},
-std::array<float,2>{0.672208071f, 0.819004118f},
-std::array<float,2>{0.808060825f, 0.114422858f},
-std::array<float,2>{0.327391833f, 0.808514833f},
-std::array<float,2>{0.174555197f, 0.35488373f},
-std::array<float,2>{0.546881139f, 0.663446009f},
-std::array<float,2>{0.736496925f, 0.485319346f},
-std::array<float,2>{0.124580249f, 0.509351611f},
-std::array<float,2>{0.391656011f, 0.146669015f},
-std::array<float,2>{0.979881346f, 0.943006217f},
-std::array<float,2>{0.645784736f, 0.143998325f},
-std::array<float,2>{0.051830627f, 0.938479125f},
-std::array<float,2>{0.450932771f, 0.488474607f},
-std::array<float,2>{0.904370964f, 0.512229562f},
-std::array<float,2>{0.818578839f, 0.357417881f},
-std::array<float,2>{0.283462733f, 0.65687573f},
-std::array<float,2>{0.215181768f, 0.110161923f},
-std::array<float,2>{0.599460542f, 0.808685362f},
-std::array<float,2>{0.959985614f, 0.017690964f},
-std::array<float,2>{0.417632252f, 0.815738201f},
-std::array<float,2>{0.0646037981f, 0.284067929f},
-std::array<float,2>{0.715880096f, 0.749578774f},
-std::array<float,2>{0.51855278f, 0.378229439f},
-std::array<float,2>{0.131206095f, 0.60550499f},
-std::array<float,2>{0.360768467f, 0.226359487f},
-std::array<float,2>{0.765384138f, 0.9322927f},
-std::array<float,2>{0.5870592f, 0.0824461505f},
-std::array<float,2>{0.226021737f, 0.763384521f},
-std::array<float,2>{0.27930665f, 0.314029008f},
-std::array<float,2>{0.847364902f, 0.655055404f},
-std::array<float,2>{0.931927443f, 0.45287618f},
-std::array<float,2>{0.471487999f, 0.537287891f},
-std::array<float,2>{0.0297832973f, 0.161975145f},
-std::array<float,2>{0.664040089f, 0.998421729f},
-std::array<float,2>{0.789070547f, 0.188703537f},
-std::array<float,2>{0.341309965f, 0.88444823f},
-std::array<float,2>{0.162256241f, 0.420698851f},
-std::array<float,2>{0.541492879f, 0.584930182f},
-std::array<float,2>{0.724341273f, 0.275595009f},
-std::array<float,2>{0.105475016f, 0.705637097f},
-std::array<float,2>{0.388807088f, 0.0565727428f},
-std::array<float,2>{0.999835253f, 0.8543185f},
-std::array<float,2>{0.692873478f, 0.0460667945f},
-std::array<float,2>{0.0879370198f, 0.871604025f},
-std::array<float,2>{0.428676575f, 0.261468649f},
-std::array<float,2>{0.946468174f, 0.688341916f},
-std::array<float,2>{0.768214226f, 0.42246753f},
-std::array<float,2>{0.351103455f, 0.567106247f},
-std::array<float,2>{0.154877797f, 0.215580359f},
-std::array<float,2>{0.50196588f, 0.897857964f},
-std::array<float,2>{0.887945592f, 0.187017336f},
-std::array<float,2>{0.457106978f, 0.981777906f},
-std::array<float,2>{0.0318213627f, 0.461257994f},
-std::array<float,2>{0.63648361f, 0.548516631f},
-std::array<float,2>{0.619308949f, 0.328615546f},
-std::array<float,2>{0.192767754f, 0.637706459f},
-std::array<float,2>{0.29867506f, 0.074130863f},
-std::array<float,2>{0.837211072f, 0.775603592f},
-std::array<float,2>{0.556165755f, 0.248517051f},
-std::array<float,2>{0.187017784f, 0.916579306f},
-std::array<float,2>{0.318192095f, 0.398445547f},
-std::array<float,2>{0.80446744f, 0.614102721f},
-std::array<float,2>{0.973580897f, 0.302275211f},
-std::array<float,2>{0.404815555f, 0.73329252f},
-std::array<float,2>{0.116776668f, 0.00634076213f},
-std::array<float,2>{0.745589972f, 0.839885592f},
-std::array<float,2>{0.872422874f, 0.0983827114f},
-std::array<float,2>{0.252898663f, 0.785245836f},
-std::array<float,2>{0.247269884f, 0.363727421f},
-std::array<float,2>{0.576354086f, 0.677776873f},
-std::array<float,2>{0.682348371f, 0.482806534f},
-std::array<float,2>{0.0139946081f, 0.529277146f},
-std::array<float,2>{0.497094482f, 0.127407998f},
-std::array<float,2>{0.921585858f, 0.953868687f},
-std::array<float,2>{0.741236269f, 0.206352249f},
-std::array<float,2>{0.118800126f, 0.899117589f},
-std::array<float,2>{0.39820984f, 0.435020328f},
-std::array<float,2>{0.980804086f, 0.576085091f},
-std::array<float,2>{0.811404288f, 0.256094962f},
-std::array<float,2>{0.32232821f, 0.700995505f},
-std::array<float,2>{0.175916761f, 0.0333674736f},
-std::array<float,2>{0.55402118f, 0.86658591f},
-std::array<float,2>{0.909260869f, 0.063381657f},
-std::array<float,2>{0.485556424f, 0.771313488f},
-std::array<float,2>{0.00671775267f, 0.337821513f},
-std::array<float,2>{0.67879957f, 0.628214657f},
-std::array<float,2>{0.565463841f, 0.455504119f},
-std::array<float,2>{0.241139829f, 0.558257222f},
-std::array<float,2>{0.259987622f, 0.175927982f},
-std::array<float,2>{0.862976849f, 0.970727384f},
-std::array<float,2>{0.509197056f, 0.00912536029f},
-std::array<float,2>{0.145138562f, 0.832957625f},
-std::array<float,2>{0.353604704f, 0.307131737f},
-std::array<float,2>{0.781245768f, 0.725886166f},
-std::array<float,2>{0.940465689f, 0.391976804f},
-std::array<float,2>{0.435060382f, 0.617892921f},
-std::array<float,2>{0.0784420148f, 0.240926325f},
-std::array<float,2>{0.702351451f, 0.909868836f},
-std::array<float,2>{0.834383607f, 0.135602921f},
-std::array<float,2>{0.310682267f, 0.962131917f},
-std::array<float,2>{0.200247318f, 0.473714411f},
-std::array<float,2>{0.611262321f, 0.521972239f},
-std::array<float,2>{0.628116131f, 0.372595936f},
-std::array<float,2>{0.041540429f, 0.682485402f},
-std::array<float,2>{0.468223184f, 0.108637065f},
-std::array<float,2>{0.877548516f, 0.793217957f},
-std::array<float,2>{0.666416407f, 0.123186849f},
-std::array<float,2>{0.0220501404f, 0.804088235f},
-std::array<float,2>{0.48129186f, 0.349226683f},
-std::array<float,2>{0.922524691f, 0.664530694f},
-std::array<float,2>{0.858281732f, 0.497110695f},
-std::array<float,2>{0.267033547f, 0.5006845f},
-std::array<float,2>{0.230506822f, 0.150496051f},
-std::array<float,2>{0.582790494f, 0.952175558f},
-std::array<float,2>{0.986838996f, 0.229915291f},
-std::array<float,2>{0.378263324f, 0.928939223f},
-std::array<float,2>{0.101558588f, 0.384189308f},
-std::array<float,2>{0.727076352f, 0.59503305f},
-std::array<float,2>{0.537812829f, 0.293009669f},
-std::array<float,2>{0.165577024f, 0.740562618f},
-std::array<float,2>{0.330773264f, 0.0305038653f},
-std::array<float,2>{0.783562124f, 0.8280316f},
-std::array<float,2>{0.60388273f, 0.169832423f},
-std::array<float,2>{0.204086587f, 0.987982154f},
-std::array<float,2>{0.293666273f, 0.441084296f},
-std::array<float,2>{0.821729839f, 0.545324802f},
-std::array<float,2>{0.890649259f, 0.326153755f},
-std::array<float,2>{0.443137556f, 0.647497296f},
-std::array<float,2>{0.0589564554f, 0.0880697072f},
-std::array<float,2>{0.653074801f, 0.754384995f},
-std::array<float,2>{0.753815413f, 0.0510634333f},
-std::array<float,2>{0.370662153f, 0.844214499f},
-std::array<float,2>{0.139211744f, 0.269144952f},
-std::array<float,2>{0.527321875f, 0.716001868f},
-std::array<float,2>{0.706263423f, 0.410937101f},
-std::array<float,2>{0.0730959401f, 0.59077251f},
-std::array<float,2>{0.408106804f, 0.201377407f},
-std::array<float,2>{0.966466308f, 0.881015122f},
-std::array<float,2>{0.67265588f, 0.221733332f},
-std::array<float,2>{0.0027544091f, 0.934691012f},
-std::array<float,2>{0.492075354f, 0.38253662f},
-std::array<float,2>{0.91124481f, 0.604422688f},
-std::array<float,2>{0.864279449f, 0.288483888f},
-std::array<float,2>{0.263281554f, 0.744814932f},
-std::array<float,2>{0.236052334f, 0.0210978519f},
-std::array<float,2>{0.569720328f, 0.817282379f},
-std::array<float,2>{0.980020285f, 0.116277009f},
-std::array<float,2>{0.392476141f, 0.80576843f},
-std::array<float,2>{0.124360837f, 0.352097094f},
-std::array<float,2>{0.737061322f, 0.660180509f},
-std::array<float,2>{0.547783911f, 0.486462235f},
-std::array<float,2>{0.174062803f, 0.510802329f},
-std::array<float,2>{0.327839553f, 0.146026418f},
-std::array<float,2>{0.808429837f, 0.944146216f},
-std::array<float,2>{0.616640329f, 0.0611722246f},
-std::array<float,2>{0.195542306f, 0.856690049f},
-std::array<float,2>{0.307630658f, 0.27899155f},
-std::array<float,2>{0.829699099f, 0.7098701f},
-std::array<float,2>{0.882633626f, 0.415215552f},
-std::array<float,2>{0.464182734f, 0.578723013f},
-std::array<float,2>{0.0461543463f, 0.192014739f},
-std::array<float,2>{0.632698953f, 0.889945209f},
-std::array<float,2>{0.775328279f, 0.156359494f},
-std::array<float,2>{0.359184951f, 0.99475044f},
-std::array<float,2>{0.143216386f, 0.447177351f},
-std::array<float,2>{0.512209117f, 0.531952381f},
-std::array<float,2>{0.697460592f, 0.319568425f},
-std::array<float,2>{0.0857749134f, 0.64899075f},
-std::array<float,2>{0.433237016f, 0.079724431f},
-std::array<float,2>{0.944294572f, 0.761475563f},
-std::array<float,2>{0.732264459f, 0.0774971172f},
-std::array<float,2>{0.0944119841f, 0.780776918f},
-std::array<float,2>{0.380466402f, 0.335308671f},
-std::array<float,2>{0.990351617f, 0.635905683f},
-std::array<float,2>{0.788153887f, 0.465801477f},
-std::array<float,2>{0.333494425f, 0.554433107f},
-std::array<float,2>{0.171118245f, 0.182338089f},
-std::array<float,2>{0.534491837f, 0.976567507f},
-std::array<float,2>{0.927497387f, 0.21099773f},
-std::array<float,2>{0.480423212f, 0.890707314f},
-std::array<float,2>{0.016580414f, 0.425946802f},
-std::array<float,2>{0.670518637f, 0.565068841f},
-std::array<float,2>{0.580980837f, 0.262012899f},
-std::array<float,2>{0.227219224f, 0.693544209f},
-std::array<float,2>{0.272284061f, 0.0396462604f},
-std::array<float,2>{0.854762316f, 0.871047735f},
-std::array<float,2>{0.528532922f, 0.130412892f},
-std::array<float,2>{0.134059176f, 0.958517015f},
-std::array<float,2>{0.374405116f, 0.478428543f},
-std::array<float,2>{0.757545829f, 0.525758028f},
-std::array<float,2>{0.961433589f, 0.363000661f},
-std::array<float,2>{0.410654992f, 0.673808038f},
-std::array<float,2>{0.0758123547f, 0.0942360312f},
-std::array<float,2>{0.710561991f, 0.783902526f},
-std::array<float,2>{0.825274408f, 0.00220105494f},
-std::array<float,2>{0.292966008f, 0.837856948f},
-std::array<float,2>{0.207697123f, 0.300623864f},
-std::array<float,2>{0.608751893f, 0.727731287f},
-std::array<float,2>{0.650545478f, 0.402608156f},
-std::array<float,2>{0.0557405539f, 0.611502469f},
-std::array<float,2>{0.438287228f, 0.243150279f},
-std::array<float,2>{0.896167696f, 0.920091093f},
-std::array<float,2>{0.713398278f, 0.171888947f},
-std::array<float,2>{0.0673468485f, 0.973809361f},
-std::array<float,2>{0.420396507f, 0.460335642f},
-std::array<float,2>{0.953184009f, 0.561981142f},
-std::array<float,2>{0.757989526f, 0.34289977f},
-std::array<float,2>{0.365936846f, 0.629946887f},
-std::array<float,2>{0.125670791f, 0.0688545927f},
-std::array<float,2>{0.519850254f, 0.768547356f},
-std::array<float,2>{0.898580074f, 0.0360245854f},
-std::array<float,2>{0.447123587f, 0.859835267f},
-std::array<float,2>{0.0487089492f, 0.252087176f},
-std::array<float,2>{0.641134262f, 0.698792577f},
-std::array<float,2>{0.597304225f, 0.432506889f},
-std::array<float,2>{0.213594541f, 0.572720766f},
-std::array<float,2>{0.288680941f, 0.208378911f},
-std::array<float,2>{0.813407898f, 0.905056596f},
-std::array<float,2>{0.546731591f, 0.102279872f},
-std::array<float,2>{0.156701624f, 0.789451599f},
-std::array<float,2>{0.339490354f, 0.368385315f},
-std::array<float,2>{0.795665622f, 0.684222162f},
-std::array<float,2>{0.993975997f, 0.469919741f},
-std::array<float,2>{0.385514617f, 0.518072248f},
-std::array<float,2>{0.103302434f, 0.139273435f},
-std::array<float,2>{0.720458329f, 0.965884566f},
-std::array<float,2>{0.850281537f, 0.234454677f},
-std::array<float,2>{0.277286589f, 0.912171125f},
-std::array<float,2>{0.221736267f, 0.397098541f},
-std::array<float,2>{0.590576112f, 0.623693883f},
-std::array<float,2>{0.657082498f, 0.312329829f},
-std::array<float,2>{0.023646839f, 0.720518053f},
-std::array<float,2>{0.475182116f, 0.0125249466f},
-std::array<float,2>{0.936349988f, 0.830545962f},
-std::array<float,2>{0.639059424f, 0.0271957777f},
-std::array<float,2>{0.0364597775f, 0.82272923f},
-std::array<float,2>{0.454143018f, 0.291855007f},
-std::array<float,2>{0.88288933f, 0.736923099f},
-std::array<float,2>{0.84324348f, 0.389389664f},
-std::array<float,2>{0.301936954f, 0.599905849f},
-std::array<float,2>{0.187668607f, 0.232021466f},
-std::array<float,2>{0.622180462f, 0.923975468f},
-std::array<float,2>{0.951856434f, 0.153767228f},
-std::array<float,2>{0.425689399f, 0.945939481f},
-std::array<float,2>{0.0921576694f, 0.492787331f},
-std::array<float,2>{0.690298319f, 0.505454063f},
-std::array<float,2>{0.504514813f, 0.346022964f},
-std::array<float,2>{0.148695335f, 0.671487212f},
-std::array<float,2>{0.347182333f, 0.119780146f},
-std::array<float,2>{0.773177385f, 0.798412979f},
-std::array<float,2>{0.572752774f, 0.198192611f},
-std::array<float,2>{0.245981842f, 0.878731191f},
-std::array<float,2>{0.2542319f, 0.407373726f},
-std::array<float,2>{0.867464721f, 0.587964773f},
-std::array<float,2>{0.91771996f, 0.271042198f},
-std::array<float,2>{0.493155211f, 0.711398542f},
-std::array<float,2>{0.011073296f, 0.0506885648f},
-std::array<float,2>{0.687131941f, 0.849450052f},
-std::array<float,2>{0.797369421f, 0.0909946486f},
-std::array<float,2>{0.316018522f, 0.75213325f},
-std::array<float,2>{0.1799815f, 0.320826888f},
-std::array<float,2>{0.56002152f, 0.643893063f},
-std::array<float,2>{0.747268498f, 0.443951726f},
-std::array<float,2>{0.112839356f, 0.540039659f},
-std::array<float,2>{0.401906669f, 0.166985422f},
-std::array<float,2>{0.968790114f, 0.991379499f},
-std::array<float,2>{0.661179125f, 0.163009733f},
-std::array<float,2>{0.0284123141f, 0.99792558f},
-std::array<float,2>{0.469845563f, 0.449751288f},
-std::array<float,2>{0.93031621f, 0.536406755f},
-std::array<float,2>{0.845313311f, 0.3153027f},
-std::array<float,2>{0.278650641f, 0.653943121f},
-std::array<float,2>{0.222832173f, 0.0847992599f},
-std::array<float,2>{0.589009166f, 0.765164673f},
-std::array<float,2>{0.997877657f, 0.0570446663f},
-std::array<float,2>{0.387949884f, 0.852729082f},
-std::array<float,2>{0.10774304f, 0.273872823f},
-std::array<float,2>{0.726330757f, 0.70410347f},
-std::array<float,2>{0.540946662f, 0.418706506f},
-std::array<float,2>{0.160729691f, 0.583113253f},
-std::array<float,2>{0.342419237f, 0.19028376f},
-std::array<float,2>{0.791909993f, 0.885693252f},
-std::array<float,2>{0.60124433f, 0.113149166f},
-std::array<float,2>{0.217641234f, 0.812332153f},
-std::array<float,2>{0.282657295f, 0.358445168f},
-std::array<float,2>{0.817943811f, 0.658991635f},
-std::array<float,2>{0.902494967f, 0.490493029f},
-std::array<float,2>{0.453050971f, 0.515236914f},
-std::array<float,2>{0.0536884144f, 0.140687019f},
-std::array<float,2>{0.647946894f, 0.940320432f},
-std::array<float,2>{0.763640642f, 0.224039927f},
-std::array<float,2>{0.362945288f, 0.931295931f},
-std::array<float,2>{0.129889041f, 0.376937538f},
-std::array<float,2>{0.516258836f, 0.60920471f},
-std::array<float,2>{0.71741277f, 0.282930672f},
-std::array<float,2>{0.0641924962f, 0.746780515f},
-std::array<float,2>{0.414534062f, 0.0157910716f},
-std::array<float,2>{0.958882272f, 0.812880635f},
-std::array<float,2>{0.744084835f, 0.00413076021f},
-std::array<float,2>{0.114451088f, 0.84216547f},
-std::array<float,2>{0.404181749f, 0.303415239f},
-std::array<float,2>{0.975291371f, 0.731389642f},
-std::array<float,2>{0.801473081f, 0.401252806f},
-std::array<float,2>{0.319100827f, 0.617065728f},
-std::array<float,2>{0.183927983f, 0.247496009f},
-std::array<float,2>{0.558573365f, 0.915141702f},
-std::array<float,2>{0.918138802f, 0.125271499f},
-std::array<float,2>{0.498747736f, 0.955975056f},
-std::array<float,2>{0.0124919917f, 0.482053757f},
-std::array<float,2>{0.681609452f, 0.530925393f},
-std::array<float,2>{0.575192392f, 0.365843564f},
-std::array<float,2>{0.24985069f, 0.676581919f},
-std::array<float,2>{0.250799149f, 0.0996490121f},
-std::array<float,2>{0.873303115f, 0.788853645f},
-std::array<float,2>{0.500024438f, 0.217622146f},
-std::array<float,2>{0.15275903f, 0.895683169f},
-std::array<float,2>{0.349286884f, 0.42451337f},
-std::array<float,2>{0.766065776f, 0.569023669f},
-std::array<float,2>{0.948422134f, 0.259565294f},
-std::array<float,2>{0.427623361f, 0.690622687f},
-std::array<float,2>{0.0878599659f, 0.0440005325f},
-std::array<float,2>{0.695031941f, 0.873995543f},
-std::array<float,2>{0.838494122f, 0.0721615627f},
-std::array<float,2>{0.300520927f, 0.775223255f},
-std::array<float,2>{0.194112092f, 0.331094384f},
-std::array<float,2>{0.618565202f, 0.639621139f},
-std::array<float,2>{0.633345664f, 0.463548034f},
-std::array<float,2>{0.0333516933f, 0.549232483f},
-std::array<float,2>{0.459261566f, 0.184914753f},
-std::array<float,2>{0.889858425f, 0.983706176f},
-std::array<float,2>{0.701000929f, 0.238342986f},
-std::array<float,2>{0.0810778812f, 0.907675147f},
-std::array<float,2>{0.436074704f, 0.394409537f},
-std::array<float,2>{0.938487053f, 0.620716333f},
-std::array<float,2>{0.777722538f, 0.305621654f},
-std::array<float,2>{0.352607727f, 0.7228145f},
-std::array<float,2>{0.14738743f, 0.0115614869f},
-std::array<float,2>{0.509789526f, 0.834788799f},
-std::array<float,2>{0.876568973f, 0.106207341f},
-std::array<float,2>{0.465397328f, 0.796128392f},
-std::array<float,2>{0.0399343781f, 0.37451297f},
-std::array<float,2>{0.625509799f, 0.679914176f},
-std::array<float,2>{0.612652123f, 0.475337446f},
-std::array<float,2>{0.201891154f, 0.520746589f},
-std::array<float,2>{0.309874833f, 0.134227782f},
-std::array<float,2>{0.832562327f, 0.963202775f},
-std::array<float,2>{0.552708745f, 0.0314921439f},
-std::array<float,2>{0.178539604f, 0.86393404f},
-std::array<float,2>{0.322130233f, 0.254987746f},
-std::array<float,2>{0.808920443f, 0.703070402f},
-std::array<float,2>{0.982608736f, 0.437344968f},
-std::array<float,2>{0.395140797f, 0.577280939f},
-std::array<float,2>{0.119488336f, 0.204942718f},
-std::array<float,2>{0.738509059f, 0.901562929f},
-std::array<float,2>{0.861129165f, 0.179478958f},
-std::array<float,2>{0.257841051f, 0.96966809f},
-std::array<float,2>{0.23989448f, 0.454156965f},
-std::array<float,2>{0.563854575f, 0.555087447f},
-std::array<float,2>{0.677402139f, 0.339779675f},
-std::array<float,2>{0.00400276482f, 0.625691295f},
-std::array<float,2>{0.486788303f, 0.065247409f},
-std::array<float,2>{0.906826794f, 0.773171902f},
-std::array<float,2>{0.655997694f, 0.086328879f},
-std::array<float,2>{0.0622025132f, 0.756322801f},
-std::array<float,2>{0.443505168f, 0.326332748f},
-std::array<float,2>{0.893370748f, 0.644656062f},
-std::array<float,2>{0.822714448f, 0.438374043f},
-std::array<float,2>{0.295641273f, 0.5431481f},
-std::array<float,2>{0.205888271f, 0.171145037f},
-std::array<float,2>{0.601836264f, 0.986252785f},
-std::array<float,2>{0.968055129f, 0.200299203f},
-std::array<float,2>{0.408674955f, 0.879977226f},
-std::array<float,2>{0.0717249066f, 0.413117915f},
-std::array<float,2>{0.703829467f, 0.592875659f},
-std::array<float,2>{0.525364697f, 0.267074555f},
-std::array<float,2>{0.137093008f, 0.717162371f},
-std::array<float,2>{0.368780792f, 0.0545617752f},
-std::array<float,2>{0.751710832f, 0.84609431f},
-std::array<float,2>{0.584117174f, 0.150335491f},
-std::array<float,2>{0.232936025f, 0.949640989f},
-std::array<float,2>{0.268837452f, 0.498827815f},
-std::array<float,2>{0.856385827f, 0.502007008f},
-std::array<float,2>{0.924621999f, 0.351119936f},
-std::array<float,2>{0.483842105f, 0.666694522f},
-std::array<float,2>{0.021064464f, 0.122755326f},
-std::array<float,2>{0.665235937f, 0.801814437f},
-std::array<float,2>{0.782114804f, 0.0276342947f},
-std::array<float,2>{0.329163671f, 0.825524569f},
-std::array<float,2>{0.167186528f, 0.296289057f},
-std::array<float,2>{0.536010444f, 0.738909721f},
-std::array<float,2>{0.728554964f, 0.386103898f},
-std::array<float,2>{0.0994738042f, 0.597539425f},
-std::array<float,2>{0.37666437f, 0.22807309f},
-std::array<float,2>{0.98533082f, 0.926415443f},
-std::array<float,2>{0.629599392f, 0.194165185f},
-std::array<float,2>{0.0440595374f, 0.888317764f},
-std::array<float,2>{0.461538434f, 0.416600287f},
-std::array<float,2>{0.879800737f, 0.580682218f},
-std::array<float,2>{0.831916988f, 0.28024596f},
-std::array<float,2>{0.304807127f, 0.707177997f},
-std::array<float,2>{0.197510064f, 0.0602608994f},
-std::array<float,2>{0.614578724f, 0.85828954f},
-std::array<float,2>{0.941492438f, 0.080113776f},
-std::array<float,2>{0.431360751f, 0.758871913f},
-std::array<float,2>{0.0830502808f, 0.316592246f},
-std::array<float,2>{0.696936727f, 0.651597559f},
-std::array<float,2>{0.513740838f, 0.447337657f},
-std::array<float,2>{0.140706763f, 0.534432232f},
-std::array<float,2>{0.356099576f, 0.159379542f},
-std::array<float,2>{0.776674926f, 0.99390018f},
-std::array<float,2>{0.567262292f, 0.0224742554f},
-std::array<float,2>{0.237294897f, 0.818804622f},
-std::array<float,2>{0.264677614f, 0.285218596f},
-std::array<float,2>{0.866865933f, 0.742715418f},
-std::array<float,2>{0.914001822f, 0.380352229f},
-std::array<float,2>{0.488918215f, 0.601759672f},
-std::array<float,2>{0.00129703234f, 0.219806701f},
-std::array<float,2>{0.675087452f, 0.936758876f},
-std::array<float,2>{0.804947853f, 0.147095144f},
-std::array<float,2>{0.325735033f, 0.942567289f},
-std::array<float,2>{0.173790559f, 0.484677911f},
-std::array<float,2>{0.55020386f, 0.509192824f},
-std::array<float,2>{0.73602128f, 0.355186671f},
-std::array<float,2>{0.122686505f, 0.663860738f},
-std::array<float,2>{0.393843055f, 0.114904866f},
-std::array<float,2>{0.976956844f, 0.808096349f},
-std::array<float,2>{0.70827347f, 0.0964567289f},
-std::array<float,2>{0.0780563205f, 0.781385601f},
-std::array<float,2>{0.412379205f, 0.360510647f},
-std::array<float,2>{0.964370131f, 0.673898339f},
-std::array<float,2>{0.753915012f, 0.480454117f},
-std::array<float,2>{0.372994781f, 0.52465409f},
-std::array<float,2>{0.136407211f, 0.131470889f},
-std::array<float,2>{0.530663192f, 0.960529387f},
-std::array<float,2>{0.896526337f, 0.244486108f},
-std::array<float,2>{0.440458477f, 0.918377459f},
-std::array<float,2>{0.0573034361f, 0.404457301f},
-std::array<float,2>{0.650038481f, 0.610875547f},
-std::array<float,2>{0.606999159f, 0.296963781f},
-std::array<float,2>{0.210541517f, 0.729075789f},
-std::array<float,2>{0.290864885f, 0.000974938797f},
-std::array<float,2>{0.826756537f, 0.838338733f},
-std::array<float,2>{0.532464445f, 0.180200756f},
-std::array<float,2>{0.168560296f, 0.978612483f},
-std::array<float,2>{0.334108204f, 0.468006879f},
-std::array<float,2>{0.786676168f, 0.551297247f},
-std::array<float,2>{0.99002701f, 0.332565218f},
-std::array<float,2>{0.382810056f, 0.633070469f},
-std::array<float,2>{0.0964848921f, 0.0743173286f},
-std::array<float,2>{0.733946264f, 0.778969288f},
-std::array<float,2>{0.852624059f, 0.0423403494f},
-std::array<float,2>{0.271256804f, 0.867692709f},
-std::array<float,2>{0.229657069f, 0.265249997f},
-std::array<float,2>{0.578668416f, 0.692832887f},
-std::array<float,2>{0.669421554f, 0.428161621f},
-std::array<float,2>{0.0184771549f, 0.564258933f},
-std::array<float,2>{0.478466481f, 0.214725286f},
-std::array<float,2>{0.928780496f, 0.892966866f},
-std::array<float,2>{0.721676886f, 0.137162402f},
-std::array<float,2>{0.105440333f, 0.967973828f},
-std::array<float,2>{0.384737909f, 0.472172827f},
-std::array<float,2>{0.995559931f, 0.515780568f},
-std::array<float,2>{0.793919325f, 0.369804233f},
-std::array<float,2>{0.337721437f, 0.686421216f},
-std::array<float,2>{0.159610569f, 0.105301566f},
-std::array<float,2>{0.543245554f, 0.79110533f},
-std::array<float,2>{0.933809102f, 0.0144282384f},
-std::array<float,2>{0.473200649f, 0.829179347f},
-std::array<float,2>{0.0255039278f, 0.308991939f},
-std::array<float,2>{0.659561634f, 0.721682012f},
-std::array<float,2>{0.59328866f, 0.395750463f},
-std::array<float,2>{0.219524235f, 0.622452199f},
-std::array<float,2>{0.275334805f, 0.237086833f},
-std::array<float,2>{0.848323703f, 0.911872268f},
-std::array<float,2>{0.523147404f, 0.0671381429f},
-std::array<float,2>{0.127171874f, 0.766456783f},
-std::array<float,2>{0.363626152f, 0.3408584f},
-std::array<float,2>{0.761235654f, 0.632452667f},
-std::array<float,2>{0.956287384f, 0.457256794f},
-std::array<float,2>{0.418641955f, 0.558856487f},
-std::array<float,2>{0.0686464012f, 0.175395787f},
-std::array<float,2>{0.712058067f, 0.975900769f},
-std::array<float,2>{0.814806938f, 0.209987924f},
-std::array<float,2>{0.285166115f, 0.903862178f},
-std::array<float,2>{0.211286142f, 0.430740982f},
-std::array<float,2>{0.595609963f, 0.572039187f},
-std::array<float,2>{0.643868566f, 0.251373529f},
-std::array<float,2>{0.0502180681f, 0.69714123f},
-std::array<float,2>{0.44835332f, 0.0381433032f},
-std::array<float,2>{0.901143432f, 0.861732543f},
-std::array<float,2>{0.683750391f, 0.0479510725f},
-std::array<float,2>{0.00810682401f, 0.851470709f},
-std::array<float,2>{0.494152009f, 0.272460103f},
-std::array<float,2>{0.91488719f, 0.71481359f},
-std::array<float,2>{0.870009422f, 0.408391714f},
-std::array<float,2>{0.256461382f, 0.586377084f},
-std::array<float,2>{0.242273569f, 0.196070462f},
-std::array<float,2>{0.570415437f, 0.876665652f},
-std::array<float,2>{0.971424401f, 0.164832994f},
-std::array<float,2>{0.399789363f, 0.989567995f},
-std::array<float,2>{0.110549867f, 0.442118704f},
-std::array<float,2>{0.748669147f, 0.541022301f},
-std::array<float,2>{0.562491953f, 0.32404837f},
-std::array<float,2>{0.18234928f, 0.64149195f},
-std::array<float,2>{0.313136756f, 0.0931888893f},
-std::array<float,2>{0.800276875f, 0.751916587f},
-std::array<float,2>{0.623508751f, 0.23337616f},
-std::array<float,2>{0.190328777f, 0.922151148f},
-std::array<float,2>{0.304608107f, 0.386877477f},
-std::array<float,2>{0.841242671f, 0.599190116f},
-std::array<float,2>{0.886630595f, 0.290055364f},
-std::array<float,2>{0.456825823f, 0.73500371f},
-std::array<float,2>{0.037875127f, 0.0235963482f},
-std::array<float,2>{0.637392521f, 0.821929991f},
-std::array<float,2>{0.769802034f, 0.117308706f},
-std::array<float,2>{0.344832182f, 0.799005926f},
-std::array<float,2>{0.152263165f, 0.344397843f},
-std::array<float,2>{0.507103324f, 0.668040097f},
-std::array<float,2>{0.68857646f, 0.494710982f},
-std::array<float,2>{0.0907532945f, 0.507123828f},
-std::array<float,2>{0.422521949f, 0.155814752f},
-std::array<float,2>{0.949746549f, 0.94887197f},
-std::array<float,2>{0.679753661f, 0.128402442f},
-std::array<float,2>{0.0129777454f, 0.954655945f},
-std::array<float,2>{0.499757856f, 0.484069794f},
-std::array<float,2>{0.919510126f, 0.527686357f},
-std::array<float,2>{0.874393165f, 0.364286095f},
-std::array<float,2>{0.251453459f, 0.679521441f},
-std::array<float,2>{0.248681918f, 0.098663196f},
-std::array<float,2>{0.575660944f, 0.786776304f},
-std::array<float,2>{0.976094127f, 0.00684477342f},
-std::array<float,2>{0.402430087f, 0.841175079f},
-std::array<float,2>{0.113610148f, 0.301678866f},
-std::array<float,2>{0.742329657f, 0.733819962f},
-std::array<float,2>{0.557570934f, 0.399730712f},
-std::array<float,2>{0.185425535f, 0.614284694f},
-std::array<float,2>{0.320295602f, 0.249435872f},
-std::array<float,2>{0.802369893f, 0.917676449f},
-std::array<float,2>{0.617456257f, 0.0727904066f},
-std::array<float,2>{0.19509995f, 0.776380301f},
-std::array<float,2>{0.299043387f, 0.329121262f},
-std::array<float,2>{0.839525461f, 0.637255907f},
-std::array<float,2>{0.889535606f, 0.462450027f},
-std::array<float,2>{0.460132211f, 0.547085404f},
-std::array<float,2>{0.0348068178f, 0.186419651f},
-std::array<float,2>{0.63452971f, 0.980946302f},
-std::array<float,2>{0.767399669f, 0.216505229f},
-std::array<float,2>{0.347682089f, 0.896801829f},
-std::array<float,2>{0.153597802f, 0.423640817f},
-std::array<float,2>{0.501659036f, 0.567613721f},
-std::array<float,2>{0.693585217f, 0.260081172f},
-std::array<float,2>{0.0868555307f, 0.689283609f},
-std::array<float,2>{0.425997704f, 0.0457378961f},
-std::array<float,2>{0.947806537f, 0.872545063f},
-std::array<float,2>{0.724740446f, 0.05472688f},
-std::array<float,2>{0.108590029f, 0.855203748f},
-std::array<float,2>{0.386820942f, 0.277325034f},
-std::array<float,2>{0.996752679f, 0.706117034f},
-std::array<float,2>{0.792596281f, 0.421214372f},
-std::array<float,2>{0.34333396f, 0.58584553f},
-std::array<float,2>{0.161232278f, 0.187589705f},
-std::array<float,2>{0.539298952f, 0.883537173f},
-std::array<float,2>{0.930728197f, 0.160687253f},
-std::array<float,2>{0.468869895f, 0.999285877f},
-std::array<float,2>{0.0275502577f, 0.452112526f},
-std::array<float,2>{0.660841405f, 0.538151383f},
-std::array<float,2>{0.588626325f, 0.313469529f},
-std::array<float,2>{0.224099085f, 0.655471504f},
-std::array<float,2>{0.27825892f, 0.0830721781f},
-std::array<float,2>{0.844129622f, 0.762125373f},
-std::array<float,2>{0.517480373f, 0.224673301f},
-std::array<float,2>{0.129777163f, 0.93333137f},
-std::array<float,2>{0.362162381f, 0.377067089f},
-std::array<float,2>{0.762366772f, 0.606855094f},
-std::array<float,2>{0.957777917f, 0.285151869f},
-std::array<float,2>{0.415234506f, 0.748608828f},
-std::array<float,2>{0.0628403723f, 0.0186538417f},
-std::array<float,2>{0.718558609f, 0.814576924f},
-std::array<float,2>{0.817027867f, 0.110686325f},
-std::array<float,2>{0.281317592f, 0.809586763f},
-std::array<float,2>{0.217908323f, 0.35615918f},
-std::array<float,2>{0.600511312f, 0.657354116f},
-std::array<float,2>{0.647170782f, 0.489764601f},
-std::array<float,2>{0.0545661971f, 0.513036847f},
-std::array<float,2>{0.451798916f, 0.143532798f},
-std::array<float,2>{0.904281676f, 0.937633216f},
-std::array<float,2>{0.704691112f, 0.202550158f},
-std::array<float,2>{0.0708682537f, 0.882585526f},
-std::array<float,2>{0.409799874f, 0.411937922f},
-std::array<float,2>{0.967011452f, 0.591603875f},
-std::array<float,2>{0.75054723f, 0.268242359f},
-std::array<float,2>{0.36780268f, 0.715462923f},
-std::array<float,2>{0.13859953f, 0.0521785505f},
-std::array<float,2>{0.523994029f, 0.845582783f},
-std::array<float,2>{0.893694937f, 0.0891207084f},
-std::array<float,2>{0.445281595f, 0.755106866f},
-std::array<float,2>{0.0607562698f, 0.324581087f},
-std::array<float,2>{0.654929936f, 0.646899283f},
-std::array<float,2>{0.602881491f, 0.440241069f},
-std::array<float,2>{0.206773266f, 0.546007097f},
-std::array<float,2>{0.296754152f, 0.168459371f},
-std::array<float,2>{0.823750675f, 0.987181842f},
-std::array<float,2>{0.536545753f, 0.029745318f},
-std::array<float,2>{0.16681309f, 0.826278448f},
-std::array<float,2>{0.328795761f, 0.293995678f},
-std::array<float,2>{0.783196568f, 0.742148876f},
-std::array<float,2>{0.986120939f, 0.383333236f},
-std::array<float,2>{0.375764847f, 0.594134212f},
-std::array<float,2>{0.0980571508f, 0.229111329f},
-std::array<float,2>{0.730172217f, 0.92825377f},
-std::array<float,2>{0.857068539f, 0.15207608f},
-std::array<float,2>{0.267674059f, 0.95151484f},
-std::array<float,2>{0.233851358f, 0.496669561f},
-std::array<float,2>{0.585097015f, 0.501800954f},
-std::array<float,2>{0.664281726f, 0.347697496f},
-std::array<float,2>{0.0198468547f, 0.665346026f},
-std::array<float,2>{0.482853591f, 0.124752365f},
-std::array<float,2>{0.924895942f, 0.803461969f},
-std::array<float,2>{0.626568854f, 0.10752289f},
-std::array<float,2>{0.0408473909f, 0.794591248f},
-std::array<float,2>{0.466745645f, 0.371897429f},
-std::array<float,2>{0.875502467f, 0.683197916f},
-std::array<float,2>{0.833564997f, 0.473504096f},
-std::array<float,2>{0.30928877f, 0.523403049f},
-std::array<float,2>{0.202523276f, 0.13619478f},
-std::array<float,2>{0.611602962f, 0.961129129f},
-std::array<float,2>{0.937937558f, 0.242145061f},
-std::array<float,2>{0.436612159f, 0.909054518f},
-std::array<float,2>{0.0803821832f, 0.390925467f},
-std::array<float,2>{0.699917138f, 0.619127393f},
-std::array<float,2>{0.511245847f, 0.307633907f},
-std::array<float,2>{0.147555113f, 0.725304306f},
-std::array<float,2>{0.352084219f, 0.00851014443f},
-std::array<float,2>{0.778350294f, 0.833777606f},
-std::array<float,2>{0.563348532f, 0.17691274f},
-std::array<float,2>{0.239006117f, 0.972026646f},
-std::array<float,2>{0.25972119f, 0.456700832f},
-std::array<float,2>{0.859867454f, 0.556655169f},
-std::array<float,2>{0.907655776f, 0.336310416f},
-std::array<float,2>{0.487520546f, 0.627098739f},
-std::array<float,2>{0.00577390241f, 0.0644357502f},
-std::array<float,2>{0.675796449f, 0.770386338f},
-std::array<float,2>{0.809983075f, 0.0345396884f},
-std::array<float,2>{0.320838779f, 0.865777612f},
-std::array<float,2>{0.178988025f, 0.25690797f},
-std::array<float,2>{0.551539421f, 0.699766159f},
-std::array<float,2>{0.7393291f, 0.433609962f},
-std::array<float,2>{0.120538272f, 0.574473739f},
-std::array<float,2>{0.395536721f, 0.205227971f},
-std::array<float,2>{0.984247625f, 0.899970055f},
-std::array<float,2>{0.648878992f, 0.243798569f},
-std::array<float,2>{0.0585687496f, 0.92145586f},
-std::array<float,2>{0.440248042f, 0.403726339f},
-std::array<float,2>{0.897827089f, 0.612614572f},
-std::array<float,2>{0.82731384f, 0.299083591f},
-std::array<float,2>{0.289805114f, 0.727159321f},
-std::array<float,2>{0.209828675f, 0.00353413192f},
-std::array<float,2>{0.60560894f, 0.836402535f},
-std::array<float,2>{0.963036954f, 0.095339939f},
-std::array<float,2>{0.413098782f, 0.785070181f},
-std::array<float,2>{0.0768111274f, 0.361397386f},
-std::array<float,2>{0.708002031f, 0.672153234f},
-std::array<float,2>{0.529848754f, 0.476980746f},
-std::array<float,2>{0.135176584f, 0.526720643f},
-std::array<float,2>{0.371114075f, 0.128970459f},
-std::array<float,2>{0.755001724f, 0.957155168f},
-std::array<float,2>{0.579465389f, 0.0407918133f},
-std::array<float,2>{0.229330763f, 0.86992979f},
-std::array<float,2>{0.269981146f, 0.263366491f},
-std::array<float,2>{0.852311313f, 0.694855571f},
-std::array<float,2>{0.928483605f, 0.42706266f},
-std::array<float,2>{0.477416933f, 0.566018641f},
-std::array<float,2>{0.0188067723f, 0.212283775f},
-std::array<float,2>{0.668012321f, 0.891889453f},
-std::array<float,2>{0.785680592f, 0.183508098f},
-std::array<float,2>{0.335634559f, 0.977564991f},
-std::array<float,2>{0.169149384f, 0.465896517f},
-std::array<float,2>{0.532023668f, 0.552944601f},
-std::array<float,2>{0.732889593f, 0.334785879f},
-std::array<float,2>{0.0967742726f, 0.635197759f},
-std::array<float,2>{0.381789058f, 0.0768232048f},
-std::array<float,2>{0.988612413f, 0.779781282f},
-std::array<float,2>{0.695420027f, 0.0785843655f},
-std::array<float,2>{0.0827363208f, 0.760133266f},
-std::array<float,2>{0.430365771f, 0.318705708f},
-std::array<float,2>{0.942843795f, 0.649858475f},
-std::array<float,2>{0.775629044f, 0.445698291f},
-std::array<float,2>{0.356723934f, 0.532567024f},
-std::array<float,2>{0.141726062f, 0.158170134f},
-std::array<float,2>{0.514760911f, 0.995706081f},
-std::array<float,2>{0.879915297f, 0.192733541f},
-std::array<float,2>{0.462448895f, 0.888998628f},
-std::array<float,2>{0.0438188277f, 0.414898962f},
-std::array<float,2>{0.630683005f, 0.579483092f},
-std::array<float,2>{0.613379717f, 0.277351171f},
-std::array<float,2>{0.198904723f, 0.710164368f},
-std::array<float,2>{0.306170702f, 0.062081553f},
-std::array<float,2>{0.830613732f, 0.855614305f},
-std::array<float,2>{0.549148262f, 0.145307526f},
-std::array<float,2>{0.17268455f, 0.945285916f},
-std::array<float,2>{0.324881911f, 0.487386167f},
-std::array<float,2>{0.805971682f, 0.510432601f},
-std::array<float,2>{0.977869153f, 0.352653116f},
-std::array<float,2>{0.392945081f, 0.661607087f},
-std::array<float,2>{0.121262297f, 0.115913771f},
-std::array<float,2>{0.734575093f, 0.805067539f},
-std::array<float,2>{0.865939736f, 0.0204299409f},
-std::array<float,2>{0.264065772f, 0.818215549f},
-std::array<float,2>{0.237710029f, 0.287965029f},
-std::array<float,2>{0.567911744f, 0.745881855f},
-std::array<float,2>{0.674126327f, 0.381755978f},
-std::array<float,2>{0.000263728813f, 0.604735136f},
-std::array<float,2>{0.489361882f, 0.22128956f},
-std::array<float,2>{0.91245544f, 0.93423754f},
-std::array<float,2>{0.749248028f, 0.16762121f},
-std::array<float,2>{0.109435916f, 0.990578651f},
-std::array<float,2>{0.398870021f, 0.445151389f},
-std::array<float,2>{0.972214282f, 0.539919794f},
-std::array<float,2>{0.799656689f, 0.32167089f},
-std::array<float,2>{0.314363807f, 0.643099427f},
-std::array<float,2>{0.182935163f, 0.0902194232f},
-std::array<float,2>{0.561180472f, 0.753215432f},
-std::array<float,2>{0.915310383f, 0.0492623337f},
-std::array<float,2>{0.49590975f, 0.848426759f},
-std::array<float,2>{0.00908321328f, 0.270459235f},
-std::array<float,2>{0.684726715f, 0.712017655f},
-std::array<float,2>{0.572022378f, 0.406902105f},
-std::array<float,2>{0.243925169f, 0.589491725f},
-std::array<float,2>{0.257067084f, 0.198442787f},
-std::array<float,2>{0.870990098f, 0.877860069f},
-std::array<float,2>{0.5065009f, 0.120940387f},
-std::array<float,2>{0.151082337f, 0.797784865f},
-std::array<float,2>{0.34404403f, 0.346822411f},
-std::array<float,2>{0.771164298f, 0.670207024f},
-std::array<float,2>{0.950723231f, 0.494048864f},
-std::array<float,2>{0.423477709f, 0.503919125f},
-std::array<float,2>{0.0909830779f, 0.153263286f},
-std::array<float,2>{0.687817812f, 0.946322381f},
-std::array<float,2>{0.840595901f, 0.230606124f},
-std::array<float,2>{0.30324167f, 0.925305367f},
-std::array<float,2>{0.19077459f, 0.390017956f},
-std::array<float,2>{0.62432766f, 0.601256549f},
-std::array<float,2>{0.63865447f, 0.292236269f},
-std::array<float,2>{0.038337823f, 0.737787366f},
-std::array<float,2>{0.45508936f, 0.0258595329f},
-std::array<float,2>{0.885215104f, 0.823448062f},
-std::array<float,2>{0.65892458f, 0.0128241926f},
-std::array<float,2>{0.0268400647f, 0.831564724f},
-std::array<float,2>{0.473848403f, 0.310576409f},
-std::array<float,2>{0.935189247f, 0.718946159f},
-std::array<float,2>{0.849578261f, 0.398344398f},
-std::array<float,2>{0.273745f, 0.624476314f},
-std::array<float,2>{0.220318109f, 0.236013785f},
-std::array<float,2>{0.592598379f, 0.913336813f},
-std::array<float,2>{0.995046437f, 0.139657095f},
-std::array<float,2>{0.383372247f, 0.965062857f},
-std::array<float,2>{0.10372752f, 0.469344199f},
-std::array<float,2>{0.722254932f, 0.519403219f},
-std::array<float,2>{0.54458946f, 0.368097931f},
-std::array<float,2>{0.158342853f, 0.685207665f},
-std::array<float,2>{0.336752236f, 0.103065655f},
-std::array<float,2>{0.794130266f, 0.790171325f},
-std::array<float,2>{0.594598353f, 0.207564443f},
-std::array<float,2>{0.212397158f, 0.906134844f},
-std::array<float,2>{0.286718607f, 0.433365464f},
-std::array<float,2>{0.815686285f, 0.574180663f},
-std::array<float,2>{0.901637197f, 0.253639638f},
-std::array<float,2>{0.447612256f, 0.697401226f},
-std::array<float,2>{0.0489363149f, 0.0365504771f},
-std::array<float,2>{0.642652214f, 0.86128515f},
-std::array<float,2>{0.760391295f, 0.0701913089f},
-std::array<float,2>{0.364735037f, 0.768574536f},
-std::array<float,2>{0.128423125f, 0.34272781f},
-std::array<float,2>{0.522035718f, 0.628983438f},
-std::array<float,2>{0.711105704f, 0.459712386f},
-std::array<float,2>{0.0693769902f, 0.561044276f},
-std::array<float,2>{0.419359893f, 0.173666179f},
-std::array<float,2>{0.95511961f, 0.97277981f},
-std::array<float,2>{0.635227919f, 0.18411836f},
-std::array<float,2>{0.0324209519f, 0.982782304f},
-std::array<float,2>{0.458840191f, 0.464120895f},
-std::array<float,2>{0.886726081f, 0.549965322f},
-std::array<float,2>{0.836820304f, 0.330763876f},
-std::array<float,2>{0.297480464f, 0.640148282f},
-std::array<float,2>{0.192039147f, 0.0704894364f},
-std::array<float,2>{0.620365858f, 0.774168551f},
-std::array<float,2>{0.94622153f, 0.0430010147f},
-std::array<float,2>{0.429056823f, 0.874361634f},
-std::array<float,2>{0.088953048f, 0.258191168f},
-std::array<float,2>{0.69145453f, 0.689766467f},
-std::array<float,2>{0.503229916f, 0.425079942f},
-std::array<float,2>{0.156238943f, 0.569368303f},
-std::array<float,2>{0.350383013f, 0.218641922f},
-std::array<float,2>{0.768668294f, 0.895102859f},
-std::array<float,2>{0.577915192f, 0.101480022f},
-std::array<float,2>{0.24657093f, 0.787767768f},
-std::array<float,2>{0.253783941f, 0.36671862f},
-std::array<float,2>{0.871940255f, 0.677639782f},
-std::array<float,2>{0.920834839f, 0.480628788f},
-std::array<float,2>{0.496890396f, 0.530054152f},
-std::array<float,2>{0.0151062235f, 0.126083821f},
-std::array<float,2>{0.683527768f, 0.956280649f},
-std::array<float,2>{0.803594768f, 0.246993214f},
-std::array<float,2>{0.317373693f, 0.914302886f},
-std::array<float,2>{0.18565464f, 0.402282238f},
-std::array<float,2>{0.55558461f, 0.616067648f},
-std::array<float,2>{0.744502425f, 0.303902894f},
-std::array<float,2>{0.116043612f, 0.731867611f},
-std::array<float,2>{0.406229824f, 0.00535250036f},
-std::array<float,2>{0.974141061f, 0.843492448f},
-std::array<float,2>{0.715502322f, 0.0170421451f},
-std::array<float,2>{0.0655635819f, 0.814313889f},
-std::array<float,2>{0.416910112f, 0.28155151f},
-std::array<float,2>{0.959327698f, 0.747716129f},
-std::array<float,2>{0.764515162f, 0.375274867f},
-std::array<float,2>{0.359417319f, 0.607709527f},
-std::array<float,2>{0.132277474f, 0.222741619f},
-std::array<float,2>{0.519154549f, 0.929826915f},
-std::array<float,2>{0.906054616f, 0.141731888f},
-std::array<float,2>{0.449594736f, 0.941245019f},
-std::array<float,2>{0.050948251f, 0.491927505f},
-std::array<float,2>{0.644610524f, 0.513931036f},
-std::array<float,2>{0.597976208f, 0.357962251f},
-std::array<float,2>{0.216148108f, 0.659564674f},
-std::array<float,2>{0.285065085f, 0.111366332f},
-std::array<float,2>{0.820066333f, 0.810859442f},
-std::array<float,2>{0.542890966f, 0.190807104f},
-std::array<float,2>{0.163572133f, 0.886226118f},
-std::array<float,2>{0.340769142f, 0.419840902f},
-std::array<float,2>{0.79032886f, 0.582449198f},
-std::array<float,2>{0.998512566f, 0.275305748f},
-std::array<float,2>{0.389711231f, 0.703900814f},
-std::array<float,2>{0.10685613f, 0.0585599877f},
-std::array<float,2>{0.723377824f, 0.85248518f},
-std::array<float,2>{0.845813274f, 0.0858998895f},
-std::array<float,2>{0.280526787f, 0.764469743f},
-std::array<float,2>{0.2250963f, 0.315971881f},
-std::array<float,2>{0.585962653f, 0.652899861f},
-std::array<float,2>{0.662849128f, 0.450911671f},
-std::array<float,2>{0.030698726f, 0.535338283f},
-std::array<float,2>{0.472102284f, 0.163196176f},
-std::array<float,2>{0.933273733f, 0.996558607f},
-std::array<float,2>{0.728255749f, 0.227036104f},
-std::array<float,2>{0.10057313f, 0.927242339f},
-std::array<float,2>{0.377550036f, 0.384792924f},
-std::array<float,2>{0.987993062f, 0.59598279f},
-std::array<float,2>{0.784325957f, 0.295257866f},
-std::array<float,2>{0.331061602f, 0.739751816f},
-std::array<float,2>{0.164569303f, 0.0291251857f},
-std::array<float,2>{0.538930357f, 0.824853122f},
-std::array<float,2>{0.923448324f, 0.121956781f},
-std::array<float,2>{0.482069731f, 0.801389694f},
-std::array<float,2>{0.0227663722f, 0.35001424f},
-std::array<float,2>{0.667223334f, 0.667615175f},
-std::array<float,2>{0.583839357f, 0.499940366f},
-std::array<float,2>{0.23218441f, 0.503122509f},
-std::array<float,2>{0.265732735f, 0.148494378f},
-std::array<float,2>{0.858678162f, 0.95047164f},
-std::array<float,2>{0.526118636f, 0.0534355305f},
-std::array<float,2>{0.139901191f, 0.84676981f},
-std::array<float,2>{0.370105445f, 0.26644671f},
-std::array<float,2>{0.751954436f, 0.717935979f},
-std::array<float,2>{0.965375841f, 0.412353039f},
-std::array<float,2>{0.406525463f, 0.59265852f},
-std::array<float,2>{0.0733852014f, 0.199540734f},
-std::array<float,2>{0.705996275f, 0.879537582f},
-std::array<float,2>{0.82063812f, 0.170746475f},
-std::array<float,2>{0.294433117f, 0.98522383f},
-std::array<float,2>{0.204745367f, 0.438925475f},
-std::array<float,2>{0.605272293f, 0.544398665f},
-std::array<float,2>{0.653515399f, 0.327501684f},
-std::array<float,2>{0.0604787283f, 0.645838559f},
-std::array<float,2>{0.442180574f, 0.08708895f},
-std::array<float,2>{0.891911745f, 0.757357717f},
-std::array<float,2>{0.677829623f, 0.0657850057f},
-std::array<float,2>{0.00715211919f, 0.772292256f},
-std::array<float,2>{0.485049576f, 0.338465184f},
-std::array<float,2>{0.908988953f, 0.626589298f},
-std::array<float,2>{0.861814141f, 0.454002589f},
-std::array<float,2>{0.261353195f, 0.555785775f},
-std::array<float,2>{0.242109239f, 0.177923039f},
-std::array<float,2>{0.565319419f, 0.970323026f},
-std::array<float,2>{0.981795728f, 0.203345627f},
-std::array<float,2>{0.397007555f, 0.900400221f},
-std::array<float,2>{0.117880218f, 0.436381727f},
-std::array<float,2>{0.741160333f, 0.576989472f},
-std::array<float,2>{0.552906394f, 0.254216999f},
-std::array<float,2>{0.176795065f, 0.701935351f},
-std::array<float,2>{0.324008852f, 0.0331687555f},
-std::array<float,2>{0.811824501f, 0.864527464f},
-std::array<float,2>{0.609972894f, 0.133127138f},
-std::array<float,2>{0.199438617f, 0.964366972f},
-std::array<float,2>{0.312197536f, 0.476297081f},
-std::array<float,2>{0.835434079f, 0.52018708f},
-std::array<float,2>{0.878086209f, 0.373357147f},
-std::array<float,2>{0.466996729f, 0.681252003f},
-std::array<float,2>{0.0424222685f, 0.106707796f},
-std::array<float,2>{0.627101481f, 0.795897841f},
-std::array<float,2>{0.779690087f, 0.00984831154f},
-std::array<float,2>{0.354894847f, 0.835431814f},
-std::array<float,2>{0.145911977f, 0.306051522f},
-std::array<float,2>{0.508009076f, 0.724499047f},
-std::array<float,2>{0.701635003f, 0.393216491f},
-std::array<float,2>{0.0800108239f, 0.619521141f},
-std::array<float,2>{0.43418473f, 0.239788815f},
-std::array<float,2>{0.940138519f, 0.906493187f},
-std::array<float,2>{0.671047628f, 0.21324046f},
-std::array<float,2>{0.0170729142f, 0.89369005f},
-std::array<float,2>{0.478739172f, 0.42941907f},
-std::array<float,2>{0.926045597f, 0.562621474f},
-std::array<float,2>{0.85386622f, 0.264372081f},
-std::array<float,2>{0.272989064f, 0.692119241f},
-std::array<float,2>{0.227703094f, 0.0415364057f},
-std::array<float,2>{0.581345916f, 0.868282676f},
-std::array<float,2>{0.992178798f, 0.0755005553f},
-std::array<float,2>{0.379518151f, 0.777991831f},
-std::array<float,2>{0.0948265195f, 0.333808571f},
-std::array<float,2>{0.731356621f, 0.634435177f},
-std::array<float,2>{0.534011185f, 0.467035621f},
-std::array<float,2>{0.170202196f, 0.552561641f},
-std::array<float,2>{0.332098722f, 0.18111439f},
-std::array<float,2>{0.787447512f, 0.97950846f},
-std::array<float,2>{0.607636034f, 0.0010215342f},
-std::array<float,2>{0.208722666f, 0.839081228f},
-std::array<float,2>{0.291962683f, 0.298074901f},
-std::array<float,2>{0.825016081f, 0.729937911f},
-std::array<float,2>{0.895314813f, 0.405779183f},
-std::array<float,2>{0.43892023f, 0.61000216f},
-std::array<float,2>{0.0556325093f, 0.245147407f},
-std::array<float,2>{0.651832044f, 0.919894516f},
-std::array<float,2>{0.755957782f, 0.132605776f},
-std::array<float,2>{0.373407274f, 0.959168792f},
-std::array<float,2>{0.133303121f, 0.478617221f},
-std::array<float,2>{0.527842641f, 0.524244785f},
-std::array<float,2>{0.709144831f, 0.359615296f},
-std::array<float,2>{0.0747212768f, 0.674964666f},
-std::array<float,2>{0.411973625f, 0.097472176f},
-std::array<float,2>{0.962371886f, 0.782736897f},
-std::array<float,2>{0.737901807f, 0.114095949f},
-std::array<float,2>{0.123800479f, 0.807571828f},
-std::array<float,2>{0.391132057f, 0.354027092f},
-std::array<float,2>{0.978863478f, 0.662551999f},
-std::array<float,2>{0.807465315f, 0.485592306f},
-std::array<float,2>{0.327072024f, 0.507913172f},
-std::array<float,2>{0.175426438f, 0.147717834f},
-std::array<float,2>{0.548566222f, 0.941953957f},
-std::array<float,2>{0.91054517f, 0.218906939f},
-std::array<float,2>{0.490736693f, 0.936309934f},
-std::array<float,2>{0.00325765973f, 0.379261047f},
-std::array<float,2>{0.673601449f, 0.602798939f},
-std::array<float,2>{0.56902349f, 0.286711663f},
-std::array<float,2>{0.235145345f, 0.743729711f},
-std::array<float,2>{0.262481987f, 0.0219694767f},
-std::array<float,2>{0.86341393f, 0.819431961f},
-std::array<float,2>{0.513411582f, 0.158489183f},
-std::array<float,2>{0.143701434f, 0.992688775f},
-std::array<float,2>{0.35747689f, 0.448298186f},
-std::array<float,2>{0.774100244f, 0.534007132f},
-std::array<float,2>{0.944614947f, 0.318212301f},
-std::array<float,2>{0.432418346f, 0.650951087f},
-std::array<float,2>{0.0846001431f, 0.0815807953f},
-std::array<float,2>{0.699176908f, 0.758391321f},
-std::array<float,2>{0.828200459f, 0.0587387308f},
-std::array<float,2>{0.307526678f, 0.858517647f},
-std::array<float,2>{0.196555004f, 0.280854672f},
-std::array<float,2>{0.615458429f, 0.708108366f},
-std::array<float,2>{0.630911291f, 0.417715579f},
-std::array<float,2>{0.0449523367f, 0.581788838f},
-std::array<float,2>{0.463161588f, 0.195048839f},
-std::array<float,2>{0.881746113f, 0.887242436f},
-std::array<float,2>{0.691356897f, 0.15500617f},
-std::array<float,2>{0.093168743f, 0.947967112f},
-std::array<float,2>{0.424300611f, 0.495508373f},
-std::array<float,2>{0.952663898f, 0.506733596f},
-std::array<float,2>{0.772178352f, 0.345349133f},
-std::array<float,2>{0.346124947f, 0.669826031f},
-std::array<float,2>{0.1497318f, 0.118946001f},
-std::array<float,2>{0.505755246f, 0.800058961f},
-std::array<float,2>{0.883909762f, 0.0251556914f},
-std::array<float,2>{0.453219295f, 0.820780158f},
-std::array<float,2>{0.0359648094f, 0.289961666f},
-std::array<float,2>{0.640315294f, 0.736161292f},
-std::array<float,2>{0.621717989f, 0.387859195f},
-std::array<float,2>{0.18930383f, 0.598490536f},
-std::array<float,2>{0.301333845f, 0.233714268f},
-std::array<float,2>{0.842259824f, 0.922898054f},
-std::array<float,2>{0.55955863f, 0.0922409147f},
-std::array<float,2>{0.181578353f, 0.750489652f},
-std::array<float,2>{0.3154172f, 0.322656989f},
-std::array<float,2>{0.797878206f, 0.641986132f},
-std::array<float,2>{0.969742835f, 0.443194866f},
-std::array<float,2>{0.400466949f, 0.542583168f},
-std::array<float,2>{0.11226292f, 0.165534809f},
-std::array<float,2>{0.746825278f, 0.98906976f},
-std::array<float,2>{0.868589818f, 0.196540758f},
-std::array<float,2>{0.254965663f, 0.875305295f},
-std::array<float,2>{0.244354188f, 0.409741968f},
-std::array<float,2>{0.573692858f, 0.587343812f},
-std::array<float,2>{0.686337113f, 0.273404866f},
-std::array<float,2>{0.0101308012f, 0.71359086f},
-std::array<float,2>{0.493995905f, 0.0471940599f},
-std::array<float,2>{0.916473508f, 0.849854767f},
-std::array<float,2>{0.642537534f, 0.0374789089f},
-std::array<float,2>{0.0474552363f, 0.862492561f},
-std::array<float,2>{0.445464671f, 0.250942588f},
-std::array<float,2>{0.900390089f, 0.695733726f},
-std::array<float,2>{0.814392388f, 0.429888576f},
-std::array<float,2>{0.287536114f, 0.570643604f},
-std::array<float,2>{0.214610264f, 0.209233806f},
-std::array<float,2>{0.596558452f, 0.90246141f},
-std::array<float,2>{0.954830587f, 0.174366608f},
-std::array<float,2>{0.421676457f, 0.975539446f},
-std::array<float,2>{0.0682722554f, 0.458263695f},
-std::array<float,2>{0.714786947f, 0.559793413f},
-std::array<float,2>{0.52121377f, 0.340475708f},
-std::array<float,2>{0.126885653f, 0.631479442f},
-std::array<float,2>{0.366351813f, 0.0679314062f},
-std::array<float,2>{0.758834302f, 0.766920328f},
-std::array<float,2>{0.591057062f, 0.237917617f},
-std::array<float,2>{0.221409529f, 0.910783708f},
-std::array<float,2>{0.27546072f, 0.394935369f},
-std::array<float,2>{0.850664437f, 0.621404886f},
-std::array<float,2>{0.936696529f, 0.31001541f},
-std::array<float,2>{0.475944936f, 0.72098881f},
-std::array<float,2>{0.0245662443f, 0.0150095588f},
-std::array<float,2>{0.657379866f, 0.828521669f},
-std::array<float,2>{0.796080232f, 0.104303285f},
-std::array<float,2>{0.337973088f, 0.792926252f},
-std::array<float,2>{0.157885477f, 0.370265067f},
-std::array<float,2>{0.545495629f, 0.687348902f},
-std::array<float,2>{0.719317794f, 0.47075513f},
-std::array<float,2>{0.102465965f, 0.516888738f},
-std::array<float,2>{0.386378348f, 0.138096973f},
-std::array<float,2>{0.992934346f, 0.967715859f},
-std::array<float,2>{0.651201367f, 0.129202127f},
-std::array<float,2>{0.0562117174f, 0.957416952f},
-std::array<float,2>{0.437651366f, 0.476791263f},
-std::array<float,2>{0.895843625f, 0.526537478f},
-std::array<float,2>{0.825894356f, 0.361724555f},
-std::array<float,2>{0.292030573f, 0.67191565f},
-std::array<float,2>{0.207484975f, 0.0955268592f},
-std::array<float,2>{0.609354556f, 0.784777105f},
-std::array<float,2>{0.961028218f, 0.00377870956f},
-std::array<float,2>{0.410194486f, 0.836040139f},
-std::array<float,2>{0.0752538592f, 0.299046159f},
-std::array<float,2>{0.71006161f, 0.727472425f},
-std::array<float,2>{0.528962195f, 0.403409839f},
-std::array<float,2>{0.134662479f, 0.612454355f},
-std::array<float,2>{0.374816865f, 0.244024053f},
-std::array<float,2>{0.757210135f, 0.921788216f},
-std::array<float,2>{0.580383182f, 0.0769995749f},
-std::array<float,2>{0.226872072f, 0.779334962f},
-std::array<float,2>{0.271908432f, 0.334488243f},
-std::array<float,2>{0.855138183f, 0.634908199f},
-std::array<float,2>{0.927040875f, 0.46607098f},
-std::array<float,2>{0.479906231f, 0.552984059f},
-std::array<float,2>{0.015861243f, 0.183189556f},
-std::array<float,2>{0.670151234f, 0.977911651f},
-std::array<float,2>{0.788613915f, 0.212081537f},
-std::array<float,2>{0.33354184f, 0.891765773f},
-std::array<float,2>{0.171528369f, 0.426890612f},
-std::array<float,2>{0.53479898f, 0.566387534f},
-std::array<float,2>{0.731528938f, 0.26360333f},
-std::array<float,2>{0.0938485265f, 0.695291698f},
-std::array<float,2>{0.379894704f, 0.0405426435f},
-std::array<float,2>{0.991091371f, 0.869707048f},
-std::array<float,2>{0.697797835f, 0.0624838285f},
-std::array<float,2>{0.085305877f, 0.855940342f},
-std::array<float,2>{0.432938665f, 0.277697533f},
-std::array<float,2>{0.943504691f, 0.710299313f},
-std::array<float,2>{0.774545193f, 0.414570123f},
-std::array<float,2>{0.358787417f, 0.579212308f},
-std::array<float,2>{0.142980307f, 0.192576036f},
-std::array<float,2>{0.512129664f, 0.88885051f},
-std::array<float,2>{0.881868958f, 0.157809094f},
-std::array<float,2>{0.464522362f, 0.995888531f},
-std::array<float,2>{0.046542149f, 0.445510626f},
-std::array<float,2>{0.631870985f, 0.532274544f},
-std::array<float,2>{0.616968513f, 0.318471014f},
-std::array<float,2>{0.196255088f, 0.649602056f},
-std::array<float,2>{0.308402836f, 0.0782160982f},
-std::array<float,2>{0.829503715f, 0.759985924f},
-std::array<float,2>{0.54724431f, 0.221671149f},
-std::array<float,2>{0.174722478f, 0.934373319f},
-std::array<float,2>{0.327500165f, 0.381494075f},
-std::array<float,2>{0.80774647f, 0.604772031f},
-std::array<float,2>{0.979673624f, 0.287682533f},
-std::array<float,2>{0.391973644f, 0.745695114f},
-std::array<float,2>{0.124756016f, 0.0202117134f},
-std::array<float,2>{0.736688673f, 0.818061233f},
-std::array<float,2>{0.865070224f, 0.116163097f},
-std::array<float,2>{0.262761593f, 0.804931283f},
-std::array<float,2>{0.235506594f, 0.352954686f},
-std::array<float,2>{0.569876611f, 0.661258399f},
-std::array<float,2>{0.672061503f, 0.487578154f},
-std::array<float,2>{0.0020301179f, 0.51072526f},
-std::array<float,2>{0.491662443f, 0.145159215f},
-std::array<float,2>{0.911635756f, 0.944927752f},
-std::array<float,2>{0.747826993f, 0.198573813f},
-std::array<float,2>{0.112590842f, 0.877566934f},
-std::array<float,2>{0.401675075f, 0.407153368f},
-std::array<float,2>{0.969622552f, 0.589719832f},
-std::array<float,2>{0.79714489f, 0.27012226f},
-std::array<float,2>{0.315491796f, 0.712203979f},
-std::array<float,2>{0.180441514f, 0.0490675345f},
-std::array<float,2>{0.560189605f, 0.848208487f},
-std::array<float,2>{0.91746068f, 0.0899754018f},
-std::array<float,2>{0.492372453f, 0.752942681f},
-std::array<float,2>{0.0114908777f, 0.321346432f},
-std::array<float,2>{0.686662138f, 0.643354893f},
-std::array<float,2>{0.573160946f, 0.445008218f},
-std::array<float,2>{0.245486751f, 0.539685071f},
-std::array<float,2>{0.254769593f, 0.167918265f},
-std::array<float,2>{0.868104994f, 0.990277529f},
-std::array<float,2>{0.503925323f, 0.0256163273f},
-std::array<float,2>{0.149154887f, 0.82362473f},
-std::array<float,2>{0.346743226f, 0.292425364f},
-std::array<float,2>{0.772756815f, 0.73736161f},
-std::array<float,2>{0.951384306f, 0.389743626f},
-std::array<float,2>{0.424827069f, 0.601452649f},
-std::array<float,2>{0.0922911093f, 0.230916023f},
-std::array<float,2>{0.68946445f, 0.925705135f},
-std::array<float,2>{0.843652964f, 0.152837217f},
-std::array<float,2>{0.302364051f, 0.946590185f},
-std::array<float,2>{0.18844308f, 0.493655354f},
-std::array<float,2>{0.623042107f, 0.504183948f},
-std::array<float,2>{0.639549553f, 0.347080052f},
-std::array<float,2>{0.0369336568f, 0.670054495f},
-std::array<float,2>{0.455055326f, 0.120609879f},
-std::array<float,2>{0.883631229f, 0.79746139f},
-std::array<float,2>{0.656628847f, 0.103433892f},
-std::array<float,2>{0.0239767805f, 0.790309489f},
-std::array<float,2>{0.474742949f, 0.36770159f},
-std::array<float,2>{0.935660362f, 0.685529411f},
-std::array<float,2>{0.85008657f, 0.469547123f},
-std::array<float,2>{0.276704937f, 0.519159734f},
-std::array<float,2>{0.222429484f, 0.139905989f},
-std::array<float,2>{0.590256453f, 0.965186834f},
-std::array<float,2>{0.99348855f, 0.236189276f},
-std::array<float,2>{0.385099977f, 0.91312772f},
-std::array<float,2>{0.102832578f, 0.39812699f},
-std::array<float,2>{0.719926536f, 0.624055564f},
-std::array<float,2>{0.546076477f, 0.310853988f},
-std::array<float,2>{0.15698725f, 0.719011545f},
-std::array<float,2>{0.339126945f, 0.0131753553f},
-std::array<float,2>{0.795081198f, 0.831802785f},
-std::array<float,2>{0.596716225f, 0.173565552f},
-std::array<float,2>{0.213166863f, 0.973129332f},
-std::array<float,2>{0.288291484f, 0.459884286f},
-std::array<float,2>{0.812982202f, 0.561288238f},
-std::array<float,2>{0.899340451f, 0.342472672f},
-std::array<float,2>{0.446445078f, 0.629306555f},
-std::array<float,2>{0.0483328849f, 0.069999285f},
-std::array<float,2>{0.640694737f, 0.768845022f},
-std::array<float,2>{0.758674324f, 0.0361518376f},
-std::array<float,2>{0.365586787f, 0.860908449f},
-std::array<float,2>{0.12540026f, 0.253691375f},
-std::array<float,2>{0.52019912f, 0.697530031f},
-std::array<float,2>{0.713330686f, 0.433177263f},
-std::array<float,2>{0.0668529198f, 0.573806405f},
-std::array<float,2>{0.420868069f, 0.207830027f},
-std::array<float,2>{0.95375669f, 0.905938864f},
-std::array<float,2>{0.681929529f, 0.249107942f},
-std::array<float,2>{0.0145448549f, 0.917953312f},
-std::array<float,2>{0.497907251f, 0.399647057f},
-std::array<float,2>{0.920953155f, 0.614672959f},
-std::array<float,2>{0.872939646f, 0.301472753f},
-std::array<float,2>{0.252099305f, 0.73355186f},
-std::array<float,2>{0.247734755f, 0.00710916659f},
-std::array<float,2>{0.576946735f, 0.840970814f},
-std::array<float,2>{0.972656369f, 0.0990645662f},
-std::array<float,2>{0.404531419f, 0.786957502f},
-std::array<float,2>{0.116224952f, 0.36458686f},
-std::array<float,2>{0.745751262f, 0.679297984f},
-std::array<float,2>{0.555724323f, 0.48427546f},
-std::array<float,2>{0.186907142f, 0.527392507f},
-std::array<float,2>{0.317762852f, 0.128129572f},
-std::array<float,2>{0.80378443f, 0.955002785f},
-std::array<float,2>{0.620020926f, 0.0455172881f},
-std::array<float,2>{0.192973644f, 0.872263551f},
-std::array<float,2>{0.298128694f, 0.259926558f},
-std::array<float,2>{0.837675691f, 0.689014912f},
-std::array<float,2>{0.888658762f, 0.423557639f},
-std::array<float,2>{0.457922906f, 0.567816675f},
-std::array<float,2>{0.0314859413f, 0.216717005f},
-std::array<float,2>{0.635899007f, 0.896724939f},
-std::array<float,2>{0.767911851f, 0.18612206f},
-std::array<float,2>{0.351051658f, 0.980649233f},
-std::array<float,2>{0.154597834f, 0.462693751f},
-std::array<float,2>{0.502756894f, 0.547137916f},
-std::array<float,2>{0.692384303f, 0.329574198f},
-std::array<float,2>{0.0885248557f, 0.637662947f},
-std::array<float,2>{0.428206235f, 0.0731884539f},
-std::array<float,2>{0.947065771f, 0.776648998f},
-std::array<float,2>{0.723942459f, 0.0834359303f},
-std::array<float,2>{0.106367841f, 0.761937797f},
-std::array<float,2>{0.389274955f, 0.313015759f},
-std::array<float,2>{0.999478281f, 0.655560017f},
-std::array<float,2>{0.789909244f, 0.451882243f},
-std::array<float,2>{0.341007799f, 0.538352191f},
-std::array<float,2>{0.162641674f, 0.161078796f},
-std::array<float,2>{0.541760325f, 0.9992401f},
-std::array<float,2>{0.93239212f, 0.187907726f},
-std::array<float,2>{0.470894486f, 0.883691549f},
-std::array<float,2>{0.0298773497f, 0.421106696f},
-std::array<float,2>{0.663567543f, 0.585546494f},
-std::array<float,2>{0.587648571f, 0.277087897f},
-std::array<float,2>{0.22614269f, 0.706320345f},
-std::array<float,2>{0.279888213f, 0.0551313311f},
-std::array<float,2>{0.846903563f, 0.855274379f},
-std::array<float,2>{0.518025041f, 0.143164635f},
-std::array<float,2>{0.131709456f, 0.937861502f},
-std::array<float,2>{0.361074299f, 0.49002707f},
-std::array<float,2>{0.764876842f, 0.512899935f},
-std::array<float,2>{0.960670054f, 0.356248438f},
-std::array<float,2>{0.417009473f, 0.657606483f},
-std::array<float,2>{0.0652201921f, 0.110538758f},
-std::array<float,2>{0.716703951f, 0.809973121f},
-std::array<float,2>{0.819100916f, 0.0188960973f},
-std::array<float,2>{0.283876479f, 0.814729095f},
-std::array<float,2>{0.215779588f, 0.284892052f},
-std::array<float,2>{0.5988639f, 0.748989642f},
-std::array<float,2>{0.646033883f, 0.377359122f},
-std::array<float,2>{0.0525283664f, 0.606575847f},
-std::array<float,2>{0.450405091f, 0.225068927f},
-std::array<float,2>{0.905138075f, 0.933564067f},
-std::array<float,2>{0.706726789f, 0.168750674f},
-std::array<float,2>{0.0724379867f, 0.986947954f},
-std::array<float,2>{0.407648414f, 0.440129787f},
-std::array<float,2>{0.96591562f, 0.546237826f},
-std::array<float,2>{0.753327966f, 0.32439512f},
-std::array<float,2>{0.370399058f, 0.646493256f},
-std::array<float,2>{0.138915896f, 0.0890082344f},
-std::array<float,2>{0.526432872f, 0.755196273f},
-std::array<float,2>{0.891587496f, 0.0518369749f},
-std::array<float,2>{0.442522883f, 0.845241606f},
-std::array<float,2>{0.0592558756f, 0.268474668f},
-std::array<float,2>{0.652545452f, 0.715647995f},
-std::array<float,2>{0.604020298f, 0.411640972f},
-std::array<float,2>{0.203169972f, 0.591449261f},
-std::array<float,2>{0.293216258f, 0.202200845f},
-std::array<float,2>{0.822032094f, 0.882376313f},
-std::array<float,2>{0.537432909f, 0.124757007f},
-std::array<float,2>{0.165336341f, 0.803705931f},
-std::array<float,2>{0.330325246f, 0.348137408f},
-std::array<float,2>{0.78383857f, 0.66525954f},
-std::array<float,2>{0.986619949f, 0.497014523f},
-std::array<float,2>{0.378548473f, 0.501680613f},
-std::array<float,2>{0.100944184f, 0.152154014f},
-std::array<float,2>{0.726896524f, 0.951345205f},
-std::array<float,2>{0.857477784f, 0.229347676f},
-std::array<float,2>{0.267543405f, 0.928643346f},
-std::array<float,2>{0.231058225f, 0.383601934f},
-std::array<float,2>{0.582211494f, 0.593909919f},
-std::array<float,2>{0.666894317f, 0.294395894f},
-std::array<float,2>{0.0215681065f, 0.741853893f},
-std::array<float,2>{0.480840594f, 0.0293853078f},
-std::array<float,2>{0.922164142f, 0.826467633f},
-std::array<float,2>{0.628700733f, 0.0085867485f},
-std::array<float,2>{0.0410706662f, 0.833541512f},
-std::array<float,2>{0.468369395f, 0.308073014f},
-std::array<float,2>{0.877438784f, 0.725459218f},
-std::array<float,2>{0.834789336f, 0.390851438f},
-std::array<float,2>{0.311192632f, 0.618740976f},
-std::array<float,2>{0.200749382f, 0.241705492f},
-std::array<float,2>{0.610750079f, 0.908920348f},
-std::array<float,2>{0.941179454f, 0.135804743f},
-std::array<float,2>{0.434792787f, 0.96127969f},
-std::array<float,2>{0.0789209306f, 0.473256558f},
-std::array<float,2>{0.703031421f, 0.522994637f},
-std::array<float,2>{0.509489834f, 0.371657252f},
-std::array<float,2>{0.144909173f, 0.683401763f},
-std::array<float,2>{0.354407042f, 0.107880875f},
-std::array<float,2>{0.780366838f, 0.794835091f},
-std::array<float,2>{0.566264272f, 0.205517262f},
-std::array<float,2>{0.240721658f, 0.900161207f},
-std::array<float,2>{0.260297686f, 0.434022129f},
-std::array<float,2>{0.862562716f, 0.574427426f},
-std::array<float,2>{0.910109878f, 0.257139891f},
-std::array<float,2>{0.485998243f, 0.700038433f},
-std::array<float,2>{0.00617268868f, 0.0343255065f},
-std::array<float,2>{0.67935127f, 0.866102278f},
-std::array<float,2>{0.81096071f, 0.0639963821f},
-std::array<float,2>{0.323234439f, 0.770218134f},
-std::array<float,2>{0.176707268f, 0.335984886f},
-std::array<float,2>{0.554349363f, 0.627337158f},
-std::array<float,2>{0.741995513f, 0.456802249f},
-std::array<float,2>{0.118463248f, 0.556953371f},
-std::array<float,2>{0.397475779f, 0.177122638f},
-std::array<float,2>{0.981189907f, 0.971781075f},
-std::array<float,2>{0.669556737f, 0.180869386f},
-std::array<float,2>{0.0177670605f, 0.97995007f},
-std::array<float,2>{0.47766456f, 0.467200398f},
-std::array<float,2>{0.929353893f, 0.552419543f},
-std::array<float,2>{0.853091061f, 0.333568931f},
-std::array<float,2>{0.27060023f, 0.634537876f},
-std::array<float,2>{0.230182245f, 0.07523828f},
-std::array<float,2>{0.578285038f, 0.778304636f},
-std::array<float,2>{0.989658296f, 0.0418066978f},
-std::array<float,2>{0.382062256f, 0.868511796f},
-std::array<float,2>{0.0961068124f, 0.264435649f},
-std::array<float,2>{0.733473778f, 0.692184567f},
-std::array<float,2>{0.533012271f, 0.429468274f},
-std::array<float,2>{0.168229476f, 0.562775016f},
-std::array<float,2>{0.334932715f, 0.213060066f},
-std::array<float,2>{0.786194921f, 0.893822312f},
-std::array<float,2>{0.606837869f, 0.0973838121f},
-std::array<float,2>{0.210167363f, 0.783047199f},
-std::array<float,2>{0.290053874f, 0.359658301f},
-std::array<float,2>{0.826292753f, 0.675221503f},
-std::array<float,2>{0.897406638f, 0.478855073f},
-std::array<float,2>{0.441139162f, 0.524100959f},
-std::array<float,2>{0.0567302853f, 0.132380873f},
-std::array<float,2>{0.649714887f, 0.959453523f},
-std::array<float,2>{0.754836738f, 0.245555133f},
-std::array<float,2>{0.372167617f, 0.919512331f},
-std::array<float,2>{0.135765433f, 0.406173795f},
-std::array<float,2>{0.531038344f, 0.61024034f},
-std::array<float,2>{0.708496153f, 0.298331708f},
-std::array<float,2>{0.0771577582f, 0.729513109f},
-std::array<float,2>{0.413037419f, 0.00122574007f},
-std::array<float,2>{0.963876307f, 0.8392483f},
-std::array<float,2>{0.735471845f, 0.0215364192f},
-std::array<float,2>{0.12219584f, 0.819782495f},
-std::array<float,2>{0.394420445f, 0.286985219f},
-std::array<float,2>{0.977263391f, 0.744010448f},
-std::array<float,2>{0.805506885f, 0.379139096f},
-std::array<float,2>{0.32538861f, 0.602669775f},
-std::array<float,2>{0.173036844f, 0.21902591f},
-std::array<float,2>{0.550754964f, 0.936209917f},
-std::array<float,2>{0.913365185f, 0.147531509f},
-std::array<float,2>{0.488335818f, 0.942157447f},
-std::array<float,2>{0.00153267873f, 0.4857786f},
-std::array<float,2>{0.67565918f, 0.508278906f},
-std::array<float,2>{0.566555381f, 0.354464799f},
-std::array<float,2>{0.236735985f, 0.662251174f},
-std::array<float,2>{0.265548617f, 0.113818616f},
-std::array<float,2>{0.866313398f, 0.807324767f},
-std::array<float,2>{0.514366925f, 0.195071891f},
-std::array<float,2>{0.141329795f, 0.887540758f},
-std::array<float,2>{0.355490357f, 0.417779088f},
-std::array<float,2>{0.776902676f, 0.581694007f},
-std::array<float,2>{0.942340851f, 0.281238556f},
-std::array<float,2>{0.430808187f, 0.708432257f},
-std::array<float,2>{0.083521232f, 0.058946576f},
-std::array<float,2>{0.6966573f, 0.858671904f},
-std::array<float,2>{0.8311373f, 0.0817884877f},
-std::array<float,2>{0.305555046f, 0.758573771f},
-std::array<float,2>{0.197927043f, 0.318061888f},
-std::array<float,2>{0.61513114f, 0.651296735f},
-std::array<float,2>{0.629006028f, 0.448655963f},
-std::array<float,2>{0.0448762774f, 0.533869207f},
-std::array<float,2>{0.460987777f, 0.158435091f},
-std::array<float,2>{0.87924999f, 0.993089795f},
-std::array<float,2>{0.689331889f, 0.233539239f},
-std::array<float,2>{0.0898561627f, 0.923318803f},
-std::array<float,2>{0.421938896f, 0.388061821f},
-std::array<float,2>{0.949233592f, 0.598379493f},
-std::array<float,2>{0.770264566f, 0.289619744f},
-std::array<float,2>{0.345293999f, 0.735911548f},
-std::array<float,2>{0.151740938f, 0.025049543f},
-std::array<float,2>{0.507738054f, 0.820488095f},
-std::array<float,2>{0.885847628f, 0.11883349f},
-std::array<float,2>{0.456282645f, 0.799957991f},
-std::array<float,2>{0.0371648744f, 0.345507383f},
-std::array<float,2>{0.637150168f, 0.669652402f},
-std::array<float,2>{0.623558223f, 0.495169312f},
-std::array<float,2>{0.189702138f, 0.506540775f},
-std::array<float,2>{0.303797364f, 0.15513818f},
-std::array<float,2>{0.841425657f, 0.948082507f},
-std::array<float,2>{0.561576545f, 0.0470919386f},
-std::array<float,2>{0.18191351f, 0.84964776f},
-std::array<float,2>{0.312549323f, 0.273090541f},
-std::array<float,2>{0.800635219f, 0.713729143f},
-std::array<float,2>{0.970909595f, 0.410069823f},
-std::array<float,2>{0.399980605f, 0.587116182f},
-std::array<float,2>{0.111039564f, 0.196472839f},
-std::array<float,2>{0.748126864f, 0.875131249f},
-std::array<float,2>{0.869628549f, 0.165971205f},
-std::array<float,2>{0.255864918f, 0.988927484f},
-std::array<float,2>{0.242925361f, 0.442894548f},
-std::array<float,2>{0.571216941f, 0.542841792f},
-std::array<float,2>{0.684427023f, 0.322347015f},
-std::array<float,2>{0.00830435939f, 0.641645968f},
-std::array<float,2>{0.495104253f, 0.091817461f},
-std::array<float,2>{0.914217532f, 0.750848889f},
-std::array<float,2>{0.644353211f, 0.0682792515f},
-std::array<float,2>{0.0506951213f, 0.766667187f},
-std::array<float,2>{0.448944271f, 0.340699047f},
-std::array<float,2>{0.900731087f, 0.631674886f},
-std::array<float,2>{0.81504941f, 0.458027929f},
-std::array<float,2>{0.285683066f, 0.559953332f},
-std::array<float,2>{0.211542591f, 0.17459397f},
-std::array<float,2>{0.594737709f, 0.975153804f},
-std::array<float,2>{0.956667483f, 0.209107578f},
-std::array<float,2>{0.418290555f, 0.902830541f},
-std::array<float,2>{0.0689753667f, 0.430050761f},
-std::array<float,2>{0.712772906f, 0.570518076f},
-std::array<float,2>{0.522621334f, 0.250583112f},
-std::array<float,2>{0.127771392f, 0.695448995f},
-std::array<float,2>{0.364237577f, 0.0372445881f},
-std::array<float,2>{0.761149168f, 0.862718523f},
-std::array<float,2>{0.593180895f, 0.137823805f},
-std::array<float,2>{0.219051212f, 0.967359781f},
-std::array<float,2>{0.274514467f, 0.471076488f},
-std::array<float,2>{0.848118365f, 0.516780436f},
-std::array<float,2>{0.934304297f, 0.370413661f},
-std::array<float,2>{0.473066777f, 0.687019706f},
-std::array<float,2>{0.0261751469f, 0.104207434f},
-std::array<float,2>{0.659956694f, 0.792589128f},
-std::array<float,2>{0.793319941f, 0.0148444939f},
-std::array<float,2>{0.33715561f, 0.828301668f},
-std::array<float,2>{0.159675077f, 0.309800595f},
-std::array<float,2>{0.543612361f, 0.720855892f},
-std::array<float,2>{0.721108317f, 0.394616187f},
-std::array<float,2>{0.104919791f, 0.621192694f},
-std::array<float,2>{0.384181559f, 0.238102391f},
-std::array<float,2>{0.995732427f, 0.911104679f},
-std::array<float,2>{0.632868886f, 0.218500495f},
-std::array<float,2>{0.0339739807f, 0.895367444f},
-std::array<float,2>{0.459862649f, 0.424978852f},
-std::array<float,2>{0.890482068f, 0.56976217f},
-std::array<float,2>{0.838064015f, 0.258011788f},
-std::array<float,2>{0.300023377f, 0.689464092f},
-std::array<float,2>{0.193394616f, 0.0434142798f},
-std::array<float,2>{0.618755043f, 0.874126077f},
-std::array<float,2>{0.949046433f, 0.0707282498f},
-std::array<float,2>{0.426932812f, 0.774252772f},
-std::array<float,2>{0.0870121941f, 0.33087489f},
-std::array<float,2>{0.694528162f, 0.640521884f},
-std::array<float,2>{0.500681758f, 0.464018732f},
-std::array<float,2>{0.153117791f, 0.550096631f},
-std::array<float,2>{0.348880053f, 0.18438518f},
-std::array<float,2>{0.766190469f, 0.98248291f},
-std::array<float,2>{0.574562848f, 0.00494509377f},
-std::array<float,2>{0.249342218f, 0.843599558f},
-std::array<float,2>{0.250176758f, 0.303969473f},
-std::array<float,2>{0.873928607f, 0.731538177f},
-std::array<float,2>{0.918494582f, 0.401863337f},
-std::array<float,2>{0.498189688f, 0.615817428f},
-std::array<float,2>{0.0120937424f, 0.246619865f},
-std::array<float,2>{0.6806916f, 0.91447705f},
-std::array<float,2>{0.801034391f, 0.126274318f},
-std::array<float,2>{0.3187415f, 0.956400692f},
-std::array<float,2>{0.18434526f, 0.480841964f},
-std::array<float,2>{0.557826579f, 0.529787719f},
-std::array<float,2>{0.743409812f, 0.367107689f},
-std::array<float,2>{0.115145788f, 0.677388489f},
-std::array<float,2>{0.403570056f, 0.10119997f},
-std::array<float,2>{0.974785149f, 0.787921786f},
-std::array<float,2>{0.716958165f, 0.111666583f},
-std::array<float,2>{0.0637459829f, 0.810551345f},
-std::array<float,2>{0.414677948f, 0.358246118f},
-std::array<float,2>{0.958049655f, 0.65935719f},
-std::array<float,2>{0.763179421f, 0.492035687f},
-std::array<float,2>{0.36251235f, 0.513838053f},
-std::array<float,2>{0.130542308f, 0.141915902f},
-std::array<float,2>{0.515645683f, 0.941051304f},
-std::array<float,2>{0.903017163f, 0.222901672f},
-std::array<float,2>{0.452343732f, 0.929968655f},
-std::array<float,2>{0.053073559f, 0.375222594f},
-std::array<float,2>{0.648371696f, 0.607554197f},
-std::array<float,2>{0.60093987f, 0.281292677f},
-std::array<float,2>{0.216848612f, 0.747931778f},
-std::array<float,2>{0.282739908f, 0.0167473666f},
-std::array<float,2>{0.817770302f, 0.814066648f},
-std::array<float,2>{0.540071964f, 0.163393751f},
-std::array<float,2>{0.160280123f, 0.996245146f},
-std::array<float,2>{0.341959089f, 0.45100379f},
-std::array<float,2>{0.791280448f, 0.53558743f},
-std::array<float,2>{0.997541785f, 0.31622386f},
-std::array<float,2>{0.388383985f, 0.653217316f},
-std::array<float,2>{0.108282402f, 0.0856777951f},
-std::array<float,2>{0.726068199f, 0.76420331f},
-std::array<float,2>{0.844836056f, 0.058127787f},
-std::array<float,2>{0.278915733f, 0.852124095f},
-std::array<float,2>{0.223185256f, 0.275020093f},
-std::array<float,2>{0.589678288f, 0.703855753f},
-std::array<float,2>{0.661726356f, 0.419550955f},
-std::array<float,2>{0.0291962381f, 0.582154512f},
-std::array<float,2>{0.470365942f, 0.190569192f},
-std::array<float,2>{0.930146039f, 0.885878801f},
-std::array<float,2>{0.72926867f, 0.148873717f},
-std::array<float,2>{0.0988938808f, 0.950342238f},
-std::array<float,2>{0.376203448f, 0.499645293f},
-std::array<float,2>{0.984593213f, 0.503214359f},
-std::array<float,2>{0.781496048f, 0.349720299f},
-std::array<float,2>{0.329959989f, 0.667791784f},
-std::array<float,2>{0.167590827f, 0.121597804f},
-std::array<float,2>{0.535529554f, 0.801516593f},
-std::array<float,2>{0.924259663f, 0.0289147291f},
-std::array<float,2>{0.483915299f, 0.825057268f},
-std::array<float,2>{0.0207167249f, 0.295103461f},
-std::array<float,2>{0.665691197f, 0.740145802f},
-std::array<float,2>{0.584898174f, 0.385026693f},
-std::array<float,2>{0.232513085f, 0.59574753f},
-std::array<float,2>{0.269084752f, 0.226770267f},
-std::array<float,2>{0.855572402f, 0.926915526f},
-std::array<float,2>{0.524613142f, 0.0873805434f},
-std::array<float,2>{0.137626514f, 0.757687747f},
-std::array<float,2>{0.368205667f, 0.327188462f},
-std::array<float,2>{0.751441777f, 0.645555854f},
-std::array<float,2>{0.968699694f, 0.438535154f},
-std::array<float,2>{0.408923388f, 0.544126332f},
-std::array<float,2>{0.072217539f, 0.170539185f},
-std::array<float,2>{0.703533947f, 0.985070527f},
-std::array<float,2>{0.823222458f, 0.199309409f},
-std::array<float,2>{0.29515031f, 0.879755616f},
-std::array<float,2>{0.205135226f, 0.412431598f},
-std::array<float,2>{0.602365673f, 0.592520475f},
-std::array<float,2>{0.655526578f, 0.266347349f},
-std::array<float,2>{0.0619947985f, 0.718213797f},
-std::array<float,2>{0.444274604f, 0.0536961742f},
-std::array<float,2>{0.89274013f, 0.846968174f},
-std::array<float,2>{0.676966786f, 0.0329380818f},
-std::array<float,2>{0.0047619259f, 0.864351988f},
-std::array<float,2>{0.486842006f, 0.254131198f},
-std::array<float,2>{0.906528533f, 0.701848328f},
-std::array<float,2>{0.860493124f, 0.436139762f},
-std::array<float,2>{0.258630484f, 0.576816678f},
-std::array<float,2>{0.239306316f, 0.203374088f},
-std::array<float,2>{0.564231813f, 0.900712848f},
-std::array<float,2>{0.983007491f, 0.178222284f},
-std::array<float,2>{0.394621909f, 0.970531464f},
-std::array<float,2>{0.120017819f, 0.453822255f},
-std::array<float,2>{0.738898814f, 0.555969179f},
-std::array<float,2>{0.552126467f, 0.338778585f},
-std::array<float,2>{0.177939892f, 0.626739264f},
-std::array<float,2>{0.321452081f, 0.0654833913f},
-std::array<float,2>{0.809204519f, 0.772161841f},
-std::array<float,2>{0.613022327f, 0.239992738f},
-std::array<float,2>{0.201449201f, 0.906702876f},
-std::array<float,2>{0.310431689f, 0.393463254f},
-std::array<float,2>{0.83233881f, 0.61922878f},
-std::array<float,2>{0.87643975f, 0.305830002f},
-std::array<float,2>{0.465260386f, 0.724235952f},
-std::array<float,2>{0.0394413471f, 0.0101046208f},
-std::array<float,2>{0.625420213f, 0.83504647f},
-std::array<float,2>{0.778305709f, 0.1066636f},
-std::array<float,2>{0.353428572f, 0.795582652f},
-std::array<float,2>{0.14684251f, 0.373233974f},
-std::array<float,2>{0.510699153f, 0.681430578f},
-std::array<float,2>{0.700415075f, 0.476324052f},
-std::array<float,2>{0.0816522315f, 0.520297885f},
-std::array<float,2>{0.435999811f, 0.133032665f},
-std::array<float,2>{0.939126372f, 0.964805961f},
-std::array<float,2>{0.674346149f, 0.146363467f},
-std::array<float,2>{0.000786692835f, 0.943964958f},
-std::array<float,2>{0.489995569f, 0.486786723f},
-std::array<float,2>{0.912799656f, 0.511055231f},
-std::array<float,2>{0.86535573f, 0.352514356f},
-std::array<float,2>{0.264569134f, 0.660578191f},
-std::array<float,2>{0.237832516f, 0.116603598f},
-std::array<float,2>{0.567719817f, 0.806039572f},
-std::array<float,2>{0.978095412f, 0.0212718472f},
-std::array<float,2>{0.393368423f, 0.816996455f},
-std::array<float,2>{0.121874154f, 0.288255602f},
-std::array<float,2>{0.734921753f, 0.744904816f},
-std::array<float,2>{0.54967618f, 0.382578284f},
-std::array<float,2>{0.172253504f, 0.604175329f},
-std::array<float,2>{0.324259281f, 0.22192581f},
-std::array<float,2>{0.806205571f, 0.934922338f},
-std::array<float,2>{0.614163518f, 0.0799066275f},
-std::array<float,2>{0.19855991f, 0.761394382f},
-std::array<float,2>{0.305926979f, 0.319619954f},
-std::array<float,2>{0.830271423f, 0.649196327f},
-std::array<float,2>{0.880591333f, 0.446990073f},
-std::array<float,2>{0.462100863f, 0.532017052f},
-std::array<float,2>{0.0434138402f, 0.156682834f},
-std::array<float,2>{0.630259752f, 0.994943082f},
-std::array<float,2>{0.776010811f, 0.192258283f},
-std::array<float,2>{0.357307047f, 0.889835656f},
-std::array<float,2>{0.14234595f, 0.415424377f},
-std::array<float,2>{0.515273333f, 0.57890588f},
-std::array<float,2>{0.695826113f, 0.279062599f},
-std::array<float,2>{0.0822754502f, 0.709692001f},
-std::array<float,2>{0.429779321f, 0.0613487251f},
-std::array<float,2>{0.942970157f, 0.856549144f},
-std::array<float,2>{0.7331689f, 0.0399140865f},
-std::array<float,2>{0.0973120332f, 0.870760798f},
-std::array<float,2>{0.38117063f, 0.261725754f},
-std::array<float,2>{0.989147007f, 0.693831146f},
-std::array<float,2>{0.785269678f, 0.426043063f},
-std::array<float,2>{0.335145026f, 0.565398276f},
-std::array<float,2>{0.169437051f, 0.211414158f},
-std::array<float,2>{0.531557441f, 0.890923858f},
-std::array<float,2>{0.927843809f, 0.1825528f},
-std::array<float,2>{0.476958096f, 0.977021933f},
-std::array<float,2>{0.0193434414f, 0.465435624f},
-std::array<float,2>{0.668801486f, 0.55468452f},
-std::array<float,2>{0.579702914f, 0.335196853f},
-std::array<float,2>{0.228786632f, 0.636131346f},
-std::array<float,2>{0.270067662f, 0.077228941f},
-std::array<float,2>{0.851895332f, 0.781154871f},
-std::array<float,2>{0.529693723f, 0.242843017f},
-std::array<float,2>{0.135541782f, 0.920178056f},
-std::array<float,2>{0.371708274f, 0.402468473f},
-std::array<float,2>{0.755802453f, 0.611590505f},
-std::array<float,2>{0.963630259f, 0.30049178f},
-std::array<float,2>{0.413999468f, 0.727825642f},
-std::array<float,2>{0.0766520724f, 0.00196509575f},
-std::array<float,2>{0.707064688f, 0.837621331f},
-std::array<float,2>{0.827700615f, 0.0939120874f},
-std::array<float,2>{0.289184779f, 0.784039259f},
-std::array<float,2>{0.209108084f, 0.363170683f},
-std::array<float,2>{0.606271565f, 0.673395455f},
-std::array<float,2>{0.649267912f, 0.478247464f},
-std::array<float,2>{0.058093261f, 0.52553618f},
-std::array<float,2>{0.439495325f, 0.130734101f},
-std::array<float,2>{0.898306489f, 0.958850324f},
-std::array<float,2>{0.711894691f, 0.208042562f},
-std::array<float,2>{0.0702420101f, 0.904813826f},
-std::array<float,2>{0.419919312f, 0.432340384f},
-std::array<float,2>{0.955704331f, 0.572378933f},
-std::array<float,2>{0.760185421f, 0.252362669f},
-std::array<float,2>{0.365154147f, 0.69911468f},
-std::array<float,2>{0.128007397f, 0.0356982462f},
-std::array<float,2>{0.521499574f, 0.859546185f},
-std::array<float,2>{0.902208805f, 0.0692555308f},
-std::array<float,2>{0.447924346f, 0.76816684f},
-std::array<float,2>{0.0493658148f, 0.343255371f},
-std::array<float,2>{0.643356383f, 0.630252182f},
-std::array<float,2>{0.593918383f, 0.460086495f},
-std::array<float,2>{0.212578058f, 0.561721921f},
-std::array<float,2>{0.286356479f, 0.172353283f},
-std::array<float,2>{0.816114426f, 0.974025667f},
-std::array<float,2>{0.544167399f, 0.0122742476f},
-std::array<float,2>{0.159048915f, 0.830319047f},
-std::array<float,2>{0.335999846f, 0.312224716f},
-std::array<float,2>{0.794582665f, 0.720358193f},
-std::array<float,2>{0.994461596f, 0.397221029f},
-std::array<float,2>{0.383008003f, 0.623785615f},
-std::array<float,2>{0.104026616f, 0.234815195f},
-std::array<float,2>{0.721814156f, 0.912553728f},
-std::array<float,2>{0.849036455f, 0.139581725f},
-std::array<float,2>{0.274169594f, 0.966105223f},
-std::array<float,2>{0.219786644f, 0.469983131f},
-std::array<float,2>{0.592146456f, 0.518445492f},
-std::array<float,2>{0.65822649f, 0.368621558f},
-std::array<float,2>{0.026901843f, 0.684507966f},
-std::array<float,2>{0.474209279f, 0.102395885f},
-std::array<float,2>{0.934655726f, 0.789081752f},
-std::array<float,2>{0.637781322f, 0.119943433f},
-std::array<float,2>{0.038979467f, 0.798808217f},
-std::array<float,2>{0.455775976f, 0.345855445f},
-std::array<float,2>{0.885425031f, 0.671672523f},
-std::array<float,2>{0.840095103f, 0.493116707f},
-std::array<float,2>{0.302875251f, 0.505850852f},
-std::array<float,2>{0.19096379f, 0.153353944f},
-std::array<float,2>{0.624920011f, 0.946175218f},
-std::array<float,2>{0.950484812f, 0.232396439f},
-std::array<float,2>{0.422953367f, 0.924206436f},
-std::array<float,2>{0.0917206407f, 0.389430106f},
-std::array<float,2>{0.68840009f, 0.599701881f},
-std::array<float,2>{0.505868435f, 0.291718245f},
-std::array<float,2>{0.150608987f, 0.737086117f},
-std::array<float,2>{0.344496369f, 0.026982734f},
-std::array<float,2>{0.770892859f, 0.822391093f},
-std::array<float,2>{0.57133013f, 0.166614383f},
-std::array<float,2>{0.243185535f, 0.991540432f},
-std::array<float,2>{0.257501066f, 0.444313049f},
-std::array<float,2>{0.870381594f, 0.540419579f},
-std::array<float,2>{0.915608287f, 0.321045697f},
-std::array<float,2>{0.495265186f, 0.643628597f},
-std::array<float,2>{0.00951837003f, 0.0912687927f},
-std::array<float,2>{0.685404003f, 0.752266288f},
-std::array<float,2>{0.799119532f, 0.0503645018f},
-std::array<float,2>{0.313653439f, 0.849238336f},
-std::array<float,2>{0.183546022f, 0.271479756f},
-std::array<float,2>{0.560747683f, 0.711158276f},
-std::array<float,2>{0.749614835f, 0.407594502f},
-std::array<float,2>{0.110211715f, 0.588161349f},
-std::array<float,2>{0.399307519f, 0.197986782f},
-std::array<float,2>{0.972072721f, 0.878638208f},
-std::array<float,2>{0.646567166f, 0.226077557f},
-std::array<float,2>{0.0539005883f, 0.9324314f},
-std::array<float,2>{0.451658279f, 0.377943546f},
-std::array<float,2>{0.903771162f, 0.605918229f},
-std::array<float,2>{0.816607893f, 0.283771008f},
-std::array<float,2>{0.281948268f, 0.749857545f},
-std::array<float,2>{0.218586221f, 0.0179680325f},
-std::array<float,2>{0.600043058f, 0.815575838f},
-std::array<float,2>{0.957372606f, 0.110076688f},
-std::array<float,2>{0.415771991f, 0.808963954f},
-std::array<float,2>{0.0630660877f, 0.357057393f},
-std::array<float,2>{0.718248487f, 0.657185435f},
-std::array<float,2>{0.517070293f, 0.488526762f},
-std::array<float,2>{0.12921758f, 0.512476921f},
-std::array<float,2>{0.361373156f, 0.143666744f},
-std::array<float,2>{0.761779904f, 0.93873322f},
-std::array<float,2>{0.588166416f, 0.0563094765f},
-std::array<float,2>{0.224397078f, 0.854165733f},
-std::array<float,2>{0.277804285f, 0.275816262f},
-std::array<float,2>{0.844255447f, 0.70582366f},
-std::array<float,2>{0.931384683f, 0.420508832f},
-std::array<float,2>{0.469694763f, 0.584550142f},
-std::array<float,2>{0.0282210298f, 0.188793287f},
-std::array<float,2>{0.660507143f, 0.884652615f},
-std::array<float,2>{0.792193294f, 0.161637425f},
-std::array<float,2>{0.342782408f, 0.998289108f},
-std::array<float,2>{0.161728263f, 0.45295918f},
-std::array<float,2>{0.539966226f, 0.537570179f},
-std::array<float,2>{0.725441277f, 0.31429705f},
-std::array<float,2>{0.109129511f, 0.654900432f},
-std::array<float,2>{0.387365043f, 0.0822122023f},
-std::array<float,2>{0.996217132f, 0.763482511f},
-std::array<float,2>{0.694014847f, 0.0737947822f},
-std::array<float,2>{0.0860109106f, 0.775640011f},
-std::array<float,2>{0.426698446f, 0.32906878f},
-std::array<float,2>{0.947653711f, 0.638027072f},
-std::array<float,2>{0.766911685f, 0.461063892f},
-std::array<float,2>{0.348211437f, 0.548659384f},
-std::array<float,2>{0.154249296f, 0.187314898f},
-std::array<float,2>{0.501237988f, 0.981530547f},
-std::array<float,2>{0.888707399f, 0.215503648f},
-std::array<float,2>{0.46074599f, 0.897632718f},
-std::array<float,2>{0.0344110951f, 0.422783077f},
-std::array<float,2>{0.634159446f, 0.567342341f},
-std::array<float,2>{0.617860198f, 0.261602074f},
-std::array<float,2>{0.194627672f, 0.688090861f},
-std::array<float,2>{0.299761862f, 0.0462689959f},
-std::array<float,2>{0.838891029f, 0.872052908f},
-std::array<float,2>{0.557078719f, 0.127159119f},
-std::array<float,2>{0.184869871f, 0.953722477f},
-std::array<float,2>{0.319746822f, 0.482490659f},
-std::array<float,2>{0.802069008f, 0.528883457f},
-std::array<float,2>{0.975814819f, 0.36339584f},
-std::array<float,2>{0.402972341f, 0.678143442f},
-std::array<float,2>{0.113857239f, 0.0986096412f},
-std::array<float,2>{0.743009627f, 0.785554528f},
-std::array<float,2>{0.874829769f, 0.00594431115f},
-std::array<float,2>{0.251771122f, 0.840191007f},
-std::array<float,2>{0.248290852f, 0.30253312f},
-std::array<float,2>{0.575924098f, 0.732975662f},
-std::array<float,2>{0.680249095f, 0.39869374f},
-std::array<float,2>{0.0135280304f, 0.613933086f},
-std::array<float,2>{0.499135941f, 0.248131305f},
-std::array<float,2>{0.919356465f, 0.916837692f},
-std::array<float,2>{0.74017638f, 0.176221415f},
-std::array<float,2>{0.120733984f, 0.971184313f},
-std::array<float,2>{0.396443516f, 0.455216885f},
-std::array<float,2>{0.983688712f, 0.5583601f},
-std::array<float,2>{0.810143292f, 0.337590098f},
-std::array<float,2>{0.320602179f, 0.628011644f},
-std::array<float,2>{0.179562375f, 0.0631137863f},
-std::array<float,2>{0.550964653f, 0.771156013f},
-std::array<float,2>{0.907808363f, 0.0334877148f},
-std::array<float,2>{0.488033116f, 0.86629194f},
-std::array<float,2>{0.00497410819f, 0.256238461f},
-std::array<float,2>{0.676689267f, 0.700861752f},
-std::array<float,2>{0.562603176f, 0.43459937f},
-std::array<float,2>{0.238715902f, 0.575789332f},
-std::array<float,2>{0.25899899f, 0.20619835f},
-std::array<float,2>{0.859646022f, 0.899300516f},
-std::array<float,2>{0.510895967f, 0.10871432f},
-std::array<float,2>{0.148429498f, 0.793022811f},
-std::array<float,2>{0.352025747f, 0.372855425f},
-std::array<float,2>{0.778885961f, 0.682279527f},
-std::array<float,2>{0.938262403f, 0.473931968f},
-std::array<float,2>{0.437471956f, 0.521584809f},
-std::array<float,2>{0.0806884766f, 0.135405943f},
-std::array<float,2>{0.699514806f, 0.962263823f},
-std::array<float,2>{0.833251715f, 0.241003767f},
-std::array<float,2>{0.308982491f, 0.90994519f},
-std::array<float,2>{0.202672139f, 0.391613722f},
-std::array<float,2>{0.612271369f, 0.618076444f},
-std::array<float,2>{0.626191318f, 0.307560623f},
-std::array<float,2>{0.0400813967f, 0.725644946f},
-std::array<float,2>{0.466026843f, 0.00885224156f},
-std::array<float,2>{0.875189304f, 0.832649231f},
-std::array<float,2>{0.664792478f, 0.0305627286f},
-std::array<float,2>{0.0204928704f, 0.827851176f},
-std::array<float,2>{0.483329296f, 0.293255925f},
-std::array<float,2>{0.925691247f, 0.740318477f},
-std::array<float,2>{0.8565256f, 0.383993953f},
-std::array<float,2>{0.268158972f, 0.59489423f},
-std::array<float,2>{0.233986929f, 0.229567513f},
-std::array<float,2>{0.585877001f, 0.92905432f},
-std::array<float,2>{0.985681236f, 0.1508784f},
-std::array<float,2>{0.375349462f, 0.952598274f},
-std::array<float,2>{0.0985696316f, 0.497435808f},
-std::array<float,2>{0.729883134f, 0.500786304f},
-std::array<float,2>{0.537035108f, 0.349570841f},
-std::array<float,2>{0.166284233f, 0.664289355f},
-std::array<float,2>{0.328554899f, 0.123393908f},
-std::array<float,2>{0.782380044f, 0.803787827f},
-std::array<float,2>{0.603182554f, 0.201419219f},
-std::array<float,2>{0.206094861f, 0.881115794f},
-std::array<float,2>{0.296115339f, 0.410845906f},
-std::array<float,2>{0.823663294f, 0.590404928f},
-std::array<float,2>{0.894092262f, 0.269445926f},
-std::array<float,2>{0.444758534f, 0.716111779f},
-std::array<float,2>{0.0610899031f, 0.0508891046f},
-std::array<float,2>{0.65462774f, 0.843766689f},
-std::array<float,2>{0.750140071f, 0.0881632715f},
-std::array<float,2>{0.367225945f, 0.75414294f},
-std::array<float,2>{0.138023823f, 0.32578966f},
-std::array<float,2>{0.523636818f, 0.647706151f},
-std::array<float,2>{0.704296291f, 0.441367865f},
-std::array<float,2>{0.0706858411f, 0.54496628f},
-std::array<float,2>{0.409562975f, 0.169668496f},
-std::array<float,2>{0.967491865f, 0.988126636f},
-std::array<float,2>{0.631788909f, 0.159502238f},
-std::array<float,2>{0.0457751974f, 0.993673563f},
-std::array<float,2>{0.463473827f, 0.447736263f},
-std::array<float,2>{0.8812446f, 0.534280658f},
-std::array<float,2>{0.828980029f, 0.316821158f},
-std::array<float,2>{0.306896716f, 0.651778936f},
-std::array<float,2>{0.19693318f, 0.0804022178f},
-std::array<float,2>{0.61577177f, 0.759187877f},
-std::array<float,2>{0.94505626f, 0.0604408346f},
-std::array<float,2>{0.431908876f, 0.857953548f},
-std::array<float,2>{0.0842004567f, 0.279818743f},
-std::array<float,2>{0.698635101f, 0.707409978f},
-std::array<float,2>{0.51270473f, 0.416896284f},
-std::array<float,2>{0.144336745f, 0.58082217f},
-std::array<float,2>{0.358128756f, 0.194049075f},
-std::array<float,2>{0.773856223f, 0.888666928f},
-std::array<float,2>{0.568524957f, 0.115176894f},
-std::array<float,2>{0.234622791f, 0.807700574f},
-std::array<float,2>{0.261774123f, 0.355342507f},
-std::array<float,2>{0.863991976f, 0.66367799f},
-std::array<float,2>{0.910876751f, 0.484423459f},
-std::array<float,2>{0.490594894f, 0.5087955f},
-std::array<float,2>{0.00390214915f, 0.147231877f},
-std::array<float,2>{0.673332393f, 0.942721307f},
-std::array<float,2>{0.807026923f, 0.220162973f},
-std::array<float,2>{0.326260209f, 0.936799288f},
-std::array<float,2>{0.17518425f, 0.379955202f},
-std::array<float,2>{0.548047423f, 0.601932526f},
-std::array<float,2>{0.737661481f, 0.285435349f},
-std::array<float,2>{0.123286873f, 0.743016601f},
-std::array<float,2>{0.390761733f, 0.0227559712f},
-std::array<float,2>{0.97924f, 0.818519533f},
-std::array<float,2>{0.709606409f, 0.000677528791f},
-std::array<float,2>{0.0745471567f, 0.838108838f},
-std::array<float,2>{0.411290795f, 0.297243237f},
-std::array<float,2>{0.962462842f, 0.729331374f},
-std::array<float,2>{0.756707728f, 0.404566258f},
-std::array<float,2>{0.373752356f, 0.611130297f},
-std::array<float,2>{0.133161366f, 0.244233534f},
-std::array<float,2>{0.527575731f, 0.918126166f},
-std::array<float,2>{0.894989848f, 0.131736472f},
-std::array<float,2>{0.439173162f, 0.960847378f},
-std::array<float,2>{0.0547352843f, 0.48013261f},
-std::array<float,2>{0.651989996f, 0.524831116f},
-std::array<float,2>{0.608387828f, 0.360729992f},
-std::array<float,2>{0.208189696f, 0.674266517f},
-std::array<float,2>{0.291142344f, 0.0962165147f},
-std::array<float,2>{0.824393868f, 0.781523764f},
-std::array<float,2>{0.533465028f, 0.21444191f},
-std::array<float,2>{0.170695052f, 0.892768443f},
-std::array<float,2>{0.332702667f, 0.427863389f},
-std::array<float,2>{0.787655175f, 0.564143658f},
-std::array<float,2>{0.991497874f, 0.265561223f},
-std::array<float,2>{0.379017115f, 0.6925385f},
-std::array<float,2>{0.095531933f, 0.0421772487f},
-std::array<float,2>{0.730493844f, 0.868011832f},
-std::array<float,2>{0.854257643f, 0.0745647922f},
-std::array<float,2>{0.272577345f, 0.779259145f},
-std::array<float,2>{0.228427887f, 0.332764059f},
-std::array<float,2>{0.581818461f, 0.633006632f},
-std::array<float,2>{0.6715855f, 0.468102217f},
-std::array<float,2>{0.0172021072f, 0.551645517f},
-std::array<float,2>{0.479175776f, 0.180476859f},
-std::array<float,2>{0.926453173f, 0.978921056f},
-std::array<float,2>{0.719073057f, 0.236885369f},
-std::array<float,2>{0.101745479f, 0.911800086f},
-std::array<float,2>{0.386130363f, 0.395755708f},
-std::array<float,2>{0.992338002f, 0.622114182f},
-std::array<float,2>{0.796626925f, 0.308747798f},
-std::array<float,2>{0.338600814f, 0.722090542f},
-std::array<float,2>{0.157397836f, 0.0143854227f},
-std::array<float,2>{0.545279145f, 0.829574823f},
-std::array<float,2>{0.937277853f, 0.105032071f},
-std::array<float,2>{0.476332128f, 0.791312099f},
-std::array<float,2>{0.0250895098f, 0.369969368f},
-std::array<float,2>{0.657717407f, 0.686241508f},
-std::array<float,2>{0.591623902f, 0.472452074f},
-std::array<float,2>{0.22095187f, 0.515953541f},
-std::array<float,2>{0.276134104f, 0.136910737f},
-std::array<float,2>{0.85117358f, 0.968025446f},
-std::array<float,2>{0.520865142f, 0.0384748653f},
-std::array<float,2>{0.126052469f, 0.861534715f},
-std::array<float,2>{0.366813689f, 0.251084775f},
-std::array<float,2>{0.759313583f, 0.696962535f},
-std::array<float,2>{0.954396069f, 0.430925578f},
-std::array<float,2>{0.421249837f, 0.571889758f},
-std::array<float,2>{0.0674898326f, 0.210308105f},
-std::array<float,2>{0.714036763f, 0.904114664f},
-std::array<float,2>{0.813877702f, 0.175712213f},
-std::array<float,2>{0.28785637f, 0.975598931f},
-std::array<float,2>{0.213994294f, 0.457275748f},
-std::array<float,2>{0.59606123f, 0.558781981f},
-std::array<float,2>{0.641671062f, 0.341255486f},
-std::array<float,2>{0.0470048711f, 0.632758737f},
-std::array<float,2>{0.446170241f, 0.0673186257f},
-std::array<float,2>{0.899773657f, 0.766136885f},
-std::array<float,2>{0.685727298f, 0.0928325877f},
-std::array<float,2>{0.010458583f, 0.75163132f},
-std::array<float,2>{0.493523002f, 0.323866546f},
-std::array<float,2>{0.916964591f, 0.641134501f},
-std::array<float,2>{0.868788838f, 0.442316264f},
-std::array<float,2>{0.255494297f, 0.541440547f},
-std::array<float,2>{0.244749591f, 0.16462186f},
-std::array<float,2>{0.573750317f, 0.989351332f},
-std::array<float,2>{0.970691741f, 0.195890129f},
-std::array<float,2>{0.400914401f, 0.876798511f},
-std::array<float,2>{0.111626521f, 0.408665746f},
-std::array<float,2>{0.746538281f, 0.5859707f},
-std::array<float,2>{0.559012294f, 0.272122175f},
-std::array<float,2>{0.180928573f, 0.71435678f},
-std::array<float,2>{0.314520001f, 0.0481024943f},
-std::array<float,2>{0.798702657f, 0.851204574f},
-std::array<float,2>{0.621364892f, 0.156105623f},
-std::array<float,2>{0.18855983f, 0.949187636f},
-std::array<float,2>{0.301099807f, 0.49488768f},
-std::array<float,2>{0.842295229f, 0.507022202f},
-std::array<float,2>{0.884741247f, 0.344668508f},
-std::array<float,2>{0.453885943f, 0.66830498f},
-std::array<float,2>{0.035398975f, 0.11762058f},
-std::array<float,2>{0.639672697f, 0.799144804f},
-std::array<float,2>{0.771908104f, 0.0237214118f},
-std::array<float,2>{0.346581042f, 0.822115123f},
-std::array<float,2>{0.149903268f, 0.290438354f},
-std::array<float,2>{0.505193591f, 0.735232234f},
-std::array<float,2>{0.690797031f, 0.387126446f},
-std::array<float,2>{0.0933837742f, 0.599533558f},
-std::array<float,2>{0.424718916f, 0.233014628f},
-std::array<float,2>{0.952484846f, 0.921897411f},
-std::array<float,2>{0.662373364f, 0.189943403f},
-std::array<float,2>{0.0309504252f, 0.885468543f},
-std::array<float,2>{0.472434431f, 0.418510914f},
-std::array<float,2>{0.932960391f, 0.583319485f},
-std::array<float,2>{0.846558094f, 0.273511708f},
-std::array<float,2>{0.281247526f, 0.704438031f},
-std::array<float,2>{0.225293294f, 0.0568070561f},
-std::array<float,2>{0.586826503f, 0.852977037f},
-std::array<float,2>{0.998555899f, 0.0845684037f},
-std::array<float,2>{0.390580684f, 0.765554011f},
-std::array<float,2>{0.10739015f, 0.315000743f},
-std::array<float,2>{0.722803116f, 0.65412128f},
-std::array<float,2>{0.542252421f, 0.450172722f},
-std::array<float,2>{0.163755417f, 0.53628552f},
-std::array<float,2>{0.339899898f, 0.162660584f},
-std::array<float,2>{0.790623486f, 0.997733235f},
-std::array<float,2>{0.598486423f, 0.0159686636f},
-std::array<float,2>{0.216616929f, 0.812615335f},
-std::array<float,2>{0.284513831f, 0.282998949f},
-std::array<float,2>{0.819613636f, 0.746913016f},
-std::array<float,2>{0.905308247f, 0.376651317f},
-std::array<float,2>{0.449784935f, 0.608889937f},
-std::array<float,2>{0.0515743978f, 0.223871157f},
-std::array<float,2>{0.645431638f, 0.931627393f},
-std::array<float,2>{0.764109135f, 0.141111076f},
-std::array<float,2>{0.359899879f, 0.939992785f},
-std::array<float,2>{0.132730901f, 0.490340829f},
-std::array<float,2>{0.518631518f, 0.515562773f},
-std::array<float,2>{0.714851081f, 0.358794719f},
-std::array<float,2>{0.0661977977f, 0.658816874f},
-std::array<float,2>{0.416180342f, 0.113008894f},
-std::array<float,2>{0.959533215f, 0.812083364f},
-std::array<float,2>{0.74470973f, 0.100081101f},
-std::array<float,2>{0.115366153f, 0.788574219f},
-std::array<float,2>{0.405404776f, 0.366149902f},
-std::array<float,2>{0.973752022f, 0.676445842f},
-std::array<float,2>{0.802774489f, 0.482319176f},
-std::array<float,2>{0.31651032f, 0.531012177f},
-std::array<float,2>{0.186134905f, 0.125035077f},
-std::array<float,2>{0.554870963f, 0.955767572f},
-std::array<float,2>{0.920152009f, 0.247306988f},
-std::array<float,2>{0.496554971f, 0.915340304f},
-std::array<float,2>{0.015356536f, 0.40096426f},
-std::array<float,2>{0.682752252f, 0.616702497f},
-std::array<float,2>{0.577306092f, 0.303588778f},
-std::array<float,2>{0.246713415f, 0.731187642f},
-std::array<float,2>{0.252986759f, 0.00431793137f},
-std::array<float,2>{0.871531665f, 0.842003584f},
-std::array<float,2>{0.503592968f, 0.184653014f},
-std::array<float,2>{0.155577868f, 0.983485997f},
-std::array<float,2>{0.349838763f, 0.463732988f},
-std::array<float,2>{0.769385517f, 0.549007177f},
-std::array<float,2>{0.945415676f, 0.331521749f},
-std::array<float,2>{0.429386497f, 0.639263451f},
-std::array<float,2>{0.089645192f, 0.0719701499f},
-std::array<float,2>{0.691982388f, 0.775048077f},
-std::array<float,2>{0.83613205f, 0.0442849621f},
-std::array<float,2>{0.297302246f, 0.873770177f},
-std::array<float,2>{0.191790268f, 0.259370506f},
-std::array<float,2>{0.620770097f, 0.690827727f},
-std::array<float,2>{0.635384262f, 0.424747199f},
-std::array<float,2>{0.0329471864f, 0.569185495f},
-std::array<float,2>{0.458444536f, 0.217332795f},
-std::array<float,2>{0.887560368f, 0.895757973f},
-std::array<float,2>{0.701991379f, 0.133899599f},
-std::array<float,2>{0.0795687586f, 0.96299094f},
-std::array<float,2>{0.433635622f, 0.475432098f},
-std::array<float,2>{0.93983078f, 0.520904899f},
-std::array<float,2>{0.779839277f, 0.374760091f},
-std::array<float,2>{0.355247408f, 0.68016082f},
-std::array<float,2>{0.14646779f, 0.106157295f},
-std::array<float,2>{0.508700311f, 0.796265781f},
-std::array<float,2>{0.878766239f, 0.0112716034f},
-std::array<float,2>{0.467321038f, 0.834680378f},
-std::array<float,2>{0.0426979214f, 0.305349648f},
-std::array<float,2>{0.627577066f, 0.723072648f},
-std::array<float,2>{0.609521508f, 0.394217312f},
-std::array<float,2>{0.199790582f, 0.620944023f},
-std::array<float,2>{0.311645657f, 0.238702714f},
-std::array<float,2>{0.835539222f, 0.907248735f},
-std::array<float,2>{0.55365628f, 0.0651235804f},
-std::array<float,2>{0.177371413f, 0.773275077f},
-std::array<float,2>{0.323340029f, 0.339476973f},
-std::array<float,2>{0.81212002f, 0.62588346f},
-std::array<float,2>{0.982244432f, 0.454428136f},
-std::array<float,2>{0.396797359f, 0.554884911f},
-std::array<float,2>{0.117259026f, 0.179277778f},
-std::array<float,2>{0.740718544f, 0.969438136f},
-std::array<float,2>{0.86190021f, 0.204748616f},
-std::array<float,2>{0.261022598f, 0.901625335f},
-std::array<float,2>{0.241455182f, 0.437224358f},
-std::array<float,2>{0.564823031f, 0.57752347f},
-std::array<float,2>{0.678360581f, 0.255195588f},
-std::array<float,2>{0.00746739423f, 0.702833176f},
-std::array<float,2>{0.48471722f, 0.0316611007f},
-std::array<float,2>{0.908626854f, 0.86401999f},
-std::array<float,2>{0.653850257f, 0.0542345755f},
-std::array<float,2>{0.0596343726f, 0.845775664f},
-std::array<float,2>{0.441653073f, 0.26666829f},
-std::array<float,2>{0.892323256f, 0.717029452f},
-std::array<float,2>{0.821101189f, 0.413378358f},
-std::array<float,2>{0.294523746f, 0.593166411f},
-std::array<float,2>{0.204401746f, 0.200463295f},
-std::array<float,2>{0.604499459f, 0.880238235f},
-std::array<float,2>{0.965139925f, 0.170965195f},
-std::array<float,2>{0.406922042f, 0.985938132f},
-std::array<float,2>{0.0740758628f, 0.438092023f},
-std::array<float,2>{0.705468893f, 0.543401361f},
-std::array<float,2>{0.525762141f, 0.326603413f},
-std::array<float,2>{0.140488341f, 0.644878507f},
-std::array<float,2>{0.369404942f, 0.0859602839f},
-std::array<float,2>{0.752564311f, 0.755897403f},
-std::array<float,2>{0.58311224f, 0.228444025f},
-std::array<float,2>{0.231576368f, 0.926588714f},
-std::array<float,2>{0.266375929f, 0.385982394f},
-std::array<float,2>{0.859093726f, 0.597218215f},
-std::array<float,2>{0.922932625f, 0.296102762f},
-std::array<float,2>{0.481859744f, 0.739131331f},
-std::array<float,2>{0.0234065931f, 0.0275336858f},
-std::array<float,2>{0.667900562f, 0.825214326f},
-std::array<float,2>{0.784675777f, 0.122828342f},
-std::array<float,2>{0.331985742f, 0.802222133f},
-std::array<float,2>{0.164180323f, 0.351344883f},
-std::array<float,2>{0.538567722f, 0.666875064f},
-std::array<float,2>{0.727777243f, 0.498696268f},
-std::array<float,2>{0.100089662f, 0.5022614f},
-std::array<float,2>{0.377289295f, 0.150143012f},
-std::array<float,2>{0.987618029f, 0.949329793f},
-std::array<float,2>{0.640558243f, 0.15425843f},
-std::array<float,2>{0.0358580314f, 0.945796669f},
-std::array<float,2>{0.453442365f, 0.492629051f},
-std::array<float,2>{0.884062529f, 0.505295932f},
-std::array<float,2>{0.841828585f, 0.346360445f},
-std::array<float,2>{0.301544547f, 0.67105943f},
-std::array<float,2>{0.18896538f, 0.119317904f},
-std::array<float,2>{0.621886373f, 0.798238635f},
-std::array<float,2>{0.953114808f, 0.0268299002f},
-std::array<float,2>{0.423993856f, 0.822870851f},
-std::array<float,2>{0.0930107012f, 0.291411102f},
-std::array<float,2>{0.691052377f, 0.736459136f},
-std::array<float,2>{0.505601823f, 0.388914019f},
-std::array<float,2>{0.149423495f, 0.600383401f},
-std::array<float,2>{0.345838755f, 0.231658712f},
-std::array<float,2>{0.772274733f, 0.924439967f},
-std::array<float,2>{0.573431849f, 0.0913429409f},
-std::array<float,2>{0.244561151f, 0.752501607f},
-std::array<float,2>{0.255356014f, 0.320475578f},
-std::array<float,2>{0.86817342f, 0.644481003f},
-std::array<float,2>{0.91613698f, 0.443774164f},
-std::array<float,2>{0.493861198f, 0.540577173f},
-std::array<float,2>{0.0099271629f, 0.166142225f},
-std::array<float,2>{0.68613714f, 0.991989434f},
-std::array<float,2>{0.798155963f, 0.197571263f},
-std::array<float,2>{0.315088302f, 0.87829119f},
-std::array<float,2>{0.181392223f, 0.408048481f},
-std::array<float,2>{0.559131503f, 0.588744223f},
-std::array<float,2>{0.74694556f, 0.270930856f},
-std::array<float,2>{0.111906096f, 0.711606324f},
-std::array<float,2>{0.400745004f, 0.0499945134f},
-std::array<float,2>{0.970059454f, 0.848951876f},
-std::array<float,2>{0.714527488f, 0.0355398059f},
-std::array<float,2>{0.0680290312f, 0.860338986f},
-std::array<float,2>{0.421623051f, 0.252864033f},
-std::array<float,2>{0.955059052f, 0.698573947f},
-std::array<float,2>{0.759119093f, 0.431851566f},
-std::array<float,2>{0.366529882f, 0.57284385f},
-std::array<float,2>{0.126530617f, 0.208586887f},
-std::array<float,2>{0.521317303f, 0.904784381f},
-std::array<float,2>{0.899979651f, 0.172841713f},
-std::array<float,2>{0.445630133f, 0.97416389f},
-std::array<float,2>{0.0477509089f, 0.460925877f},
-std::array<float,2>{0.642177284f, 0.562132716f},
-std::array<float,2>{0.59632498f, 0.343362749f},
-std::array<float,2>{0.214506477f, 0.630498528f},
-std::array<float,2>{0.287156671f, 0.068844445f},
-std::array<float,2>{0.814123034f, 0.767795265f},
-std::array<float,2>{0.545832336f, 0.235105917f},
-std::array<float,2>{0.158023447f, 0.91267848f},
-std::array<float,2>{0.338163793f, 0.396488845f},
-std::array<float,2>{0.796302378f, 0.623172164f},
-std::array<float,2>{0.992728591f, 0.311632574f},
-std::array<float,2>{0.38664794f, 0.720181406f},
-std::array<float,2>{0.102246404f, 0.0120170293f},
-std::array<float,2>{0.719512224f, 0.830768585f},
-std::array<float,2>{0.850981593f, 0.102030173f},
-std::array<float,2>{0.275743395f, 0.789566457f},
-std::array<float,2>{0.221462667f, 0.369125783f},
-std::array<float,2>{0.591156185f, 0.683609784f},
-std::array<float,2>{0.657492042f, 0.470498353f},
-std::array<float,2>{0.0246635769f, 0.518058419f},
-std::array<float,2>{0.475755394f, 0.13888903f},
-std::array<float,2>{0.936829567f, 0.966790557f},
-std::array<float,2>{0.731031954f, 0.211611703f},
-std::array<float,2>{0.0950043723f, 0.891356468f},
-std::array<float,2>{0.379748642f, 0.426426351f},
-std::array<float,2>{0.991728842f, 0.564932942f},
-std::array<float,2>{0.787140787f, 0.262538582f},
-std::array<float,2>{0.332279682f, 0.694189012f},
-std::array<float,2>{0.170022175f, 0.0394965708f},
-std::array<float,2>{0.533863962f, 0.870290637f},
-std::array<float,2>{0.92596519f, 0.0778888687f},
-std::array<float,2>{0.478946358f, 0.780596673f},
-std::array<float,2>{0.0166332219f, 0.335643888f},
-std::array<float,2>{0.671366274f, 0.636397183f},
-std::array<float,2>{0.581197917f, 0.465146035f},
-std::array<float,2>{0.227914318f, 0.55396992f},
-std::array<float,2>{0.27327472f, 0.181792468f},
-std::array<float,2>{0.853671134f, 0.977072179f},
-std::array<float,2>{0.528180838f, 0.0026357465f},
-std::array<float,2>{0.13357307f, 0.836989701f},
-std::array<float,2>{0.373243392f, 0.299843848f},
-std::array<float,2>{0.756210566f, 0.728123486f},
-std::array<float,2>{0.962145448f, 0.403135717f},
-std::array<float,2>{0.411685437f, 0.612010002f},
-std::array<float,2>{0.0749715716f, 0.242364049f},
-std::array<float,2>{0.709416389f, 0.920889974f},
-std::array<float,2>{0.824812591f, 0.130291298f},
-std::array<float,2>{0.291657597f, 0.958245695f},
-std::array<float,2>{0.208901122f, 0.477666199f},
-std::array<float,2>{0.607721686f, 0.52602011f},
-std::array<float,2>{0.651571751f, 0.362783372f},
-std::array<float,2>{0.0552903153f, 0.673248291f},
-std::array<float,2>{0.438648492f, 0.0946586207f},
-std::array<float,2>{0.895079136f, 0.783352792f},
-std::array<float,2>{0.673440754f, 0.116755113f},
-std::array<float,2>{0.00311806728f, 0.806547523f},
-std::array<float,2>{0.491051823f, 0.351837724f},
-std::array<float,2>{0.910318792f, 0.66081804f},
-std::array<float,2>{0.863630533f, 0.487275273f},
-std::array<float,2>{0.262279123f, 0.511585355f},
-std::array<float,2>{0.235016197f, 0.145801246f},
-std::array<float,2>{0.569326699f, 0.943708003f},
-std::array<float,2>{0.978530765f, 0.222353607f},
-std::array<float,2>{0.391569376f, 0.935540855f},
-std::array<float,2>{0.123685017f, 0.382210344f},
-std::array<float,2>{0.738058984f, 0.603951037f},
-std::array<float,2>{0.548697948f, 0.288622707f},
-std::array<float,2>{0.175767496f, 0.744220614f},
-std::array<float,2>{0.326899409f, 0.0207547061f},
-std::array<float,2>{0.807317138f, 0.816651404f},
-std::array<float,2>{0.615569234f, 0.156821385f},
-std::array<float,2>{0.196342707f, 0.994576752f},
-std::array<float,2>{0.307349473f, 0.44670406f},
-std::array<float,2>{0.828397155f, 0.531442583f},
-std::array<float,2>{0.88135463f, 0.319847733f},
-std::array<float,2>{0.462990016f, 0.648514152f},
-std::array<float,2>{0.0451841168f, 0.0793019608f},
-std::array<float,2>{0.631253779f, 0.761060238f},
-std::array<float,2>{0.774229169f, 0.0606904626f},
-std::array<float,2>{0.357834697f, 0.856974781f},
-std::array<float,2>{0.143862277f, 0.278697371f},
-std::array<float,2>{0.51348573f, 0.709280133f},
-std::array<float,2>{0.698830426f, 0.415940017f},
-std::array<float,2>{0.0847836882f, 0.578211486f},
-std::array<float,2>{0.432158172f, 0.191819265f},
-std::array<float,2>{0.944541633f, 0.890322149f},
-std::array<float,2>{0.667350113f, 0.23036465f},
-std::array<float,2>{0.0225358587f, 0.929205418f},
-std::array<float,2>{0.482225925f, 0.384664863f},
-std::array<float,2>{0.923794866f, 0.595471561f},
-std::array<float,2>{0.858581901f, 0.29389587f},
-std::array<float,2>{0.266070962f, 0.741028428f},
-std::array<float,2>{0.232164323f, 0.0309017375f},
-std::array<float,2>{0.583581924f, 0.827537358f},
-std::array<float,2>{0.988179803f, 0.123951443f},
-std::array<float,2>{0.377910048f, 0.804593325f},
-std::array<float,2>{0.100228548f, 0.348935038f},
-std::array<float,2>{0.72846657f, 0.664978206f},
-std::array<float,2>{0.538794458f, 0.497990102f},
-std::array<float,2>{0.164896458f, 0.500100911f},
-std::array<float,2>{0.331536531f, 0.150932625f},
-std::array<float,2>{0.784492671f, 0.952834427f},
-std::array<float,2>{0.605185509f, 0.0514256209f},
-std::array<float,2>{0.204883009f, 0.844716787f},
-std::array<float,2>{0.293995261f, 0.268878937f},
-std::array<float,2>{0.82045579f, 0.716346443f},
-std::array<float,2>{0.891737401f, 0.410467118f},
-std::array<float,2>{0.442134678f, 0.590207815f},
-std::array<float,2>{0.0601598583f, 0.201670662f},
-std::array<float,2>{0.653678775f, 0.881823957f},
-std::array<float,2>{0.752300739f, 0.168990225f},
-std::array<float,2>{0.369785398f, 0.987326682f},
-std::array<float,2>{0.139707506f, 0.440896511f},
-std::array<float,2>{0.526311159f, 0.545471311f},
-std::array<float,2>{0.705737054f, 0.325526446f},
-std::array<float,2>{0.0735113919f, 0.648380756f},
-std::array<float,2>{0.406446159f, 0.0885056108f},
-std::array<float,2>{0.965772927f, 0.754444122f},
-std::array<float,2>{0.740950704f, 0.0627745166f},
-std::array<float,2>{0.118119732f, 0.77070719f},
-std::array<float,2>{0.397348166f, 0.337105393f},
-std::array<float,2>{0.981514692f, 0.628676236f},
-std::array<float,2>{0.811638415f, 0.45573163f},
-std::array<float,2>{0.323762059f, 0.557996392f},
-std::array<float,2>{0.177094012f, 0.176526114f},
-std::array<float,2>{0.553141057f, 0.971493721f},
-std::array<float,2>{0.908723533f, 0.206727967f},
-std::array<float,2>{0.485285372f, 0.898539543f},
-std::array<float,2>{0.00700128172f, 0.435374528f},
-std::array<float,2>{0.67806375f, 0.575331151f},
-std::array<float,2>{0.564942956f, 0.256564349f},
-std::array<float,2>{0.24184753f, 0.700467467f},
-std::array<float,2>{0.261616349f, 0.033793442f},
-std::array<float,2>{0.86134553f, 0.86674279f},
-std::array<float,2>{0.508102f, 0.134786189f},
-std::array<float,2>{0.145742014f, 0.962659776f},
-std::array<float,2>{0.354718953f, 0.474413902f},
-std::array<float,2>{0.779391825f, 0.522192895f},
-std::array<float,2>{0.940300643f, 0.372226924f},
-std::array<float,2>{0.434402406f, 0.681647122f},
-std::array<float,2>{0.0797306374f, 0.109241322f},
-std::array<float,2>{0.701268435f, 0.793764114f},
-std::array<float,2>{0.835189342f, 0.00964961015f},
-std::array<float,2>{0.31229946f, 0.832144082f},
-std::array<float,2>{0.19954592f, 0.306982905f},
-std::array<float,2>{0.610214949f, 0.726273894f},
-std::array<float,2>{0.627250135f, 0.39213261f},
-std::array<float,2>{0.0421702191f, 0.617574871f},
-std::array<float,2>{0.467109591f, 0.240609303f},
-std::array<float,2>{0.878345788f, 0.909274161f},
-std::array<float,2>{0.691717446f, 0.186599046f},
-std::array<float,2>{0.0893407241f, 0.982062459f},
-std::array<float,2>{0.428740263f, 0.461605072f},
-std::array<float,2>{0.94594425f, 0.548106372f},
-std::array<float,2>{0.768907845f, 0.328161865f},
-std::array<float,2>{0.350196987f, 0.638384521f},
-std::array<float,2>{0.155830279f, 0.0733475834f},
-std::array<float,2>{0.503146648f, 0.776203573f},
-std::array<float,2>{0.887182236f, 0.046763707f},
-std::array<float,2>{0.458606482f, 0.871152282f},
-std::array<float,2>{0.032551419f, 0.26106593f},
-std::array<float,2>{0.635004759f, 0.687842846f},
-std::array<float,2>{0.620226383f, 0.421889454f},
-std::array<float,2>{0.192278132f, 0.566882312f},
-std::array<float,2>{0.297813833f, 0.215319499f},
-std::array<float,2>{0.836578131f, 0.89830029f},
-std::array<float,2>{0.555280149f, 0.0979876295f},
-std::array<float,2>{0.186034232f, 0.785708964f},
-std::array<float,2>{0.317061782f, 0.364086449f},
-std::array<float,2>{0.803290606f, 0.678469419f},
-std::array<float,2>{0.974405944f, 0.483036309f},
-std::array<float,2>{0.405995905f, 0.528692365f},
-std::array<float,2>{0.115773521f, 0.127616256f},
-std::array<float,2>{0.744380772f, 0.953317881f},
-std::array<float,2>{0.871627748f, 0.248917684f},
-std::array<float,2>{0.2535806f, 0.916282713f},
-std::array<float,2>{0.246291861f, 0.399061054f},
-std::array<float,2>{0.577801347f, 0.613708913f},
-std::array<float,2>{0.683149695f, 0.301884383f},
-std::array<float,2>{0.0147699136f, 0.73289752f},
-std::array<float,2>{0.496821493f, 0.00651297718f},
-std::array<float,2>{0.920591235f, 0.840395331f},
-std::array<float,2>{0.644969523f, 0.0182802416f},
-std::array<float,2>{0.0512396656f, 0.815923512f},
-std::array<float,2>{0.449362129f, 0.283595502f},
-std::array<float,2>{0.905901611f, 0.749477029f},
-std::array<float,2>{0.82024765f, 0.378795087f},
-std::array<float,2>{0.284719259f, 0.606360137f},
-std::array<float,2>{0.21596393f, 0.225635529f},
-std::array<float,2>{0.597896039f, 0.931704462f},
-std::array<float,2>{0.959158063f, 0.144271746f},
-std::array<float,2>{0.416709185f, 0.939367115f},
-std::array<float,2>{0.0657184198f, 0.48900336f},
-std::array<float,2>{0.715776443f, 0.511916339f},
-std::array<float,2>{0.519476414f, 0.356711209f},
-std::array<float,2>{0.131975442f, 0.656351686f},
-std::array<float,2>{0.359664291f, 0.10965202f},
-std::array<float,2>{0.764275968f, 0.809310138f},
-std::array<float,2>{0.586295366f, 0.189020872f},
-std::array<float,2>{0.224764004f, 0.884213984f},
-std::array<float,2>{0.280389667f, 0.420161217f},
-std::array<float,2>{0.846036792f, 0.584250569f},
-std::array<float,2>{0.933392644f, 0.276249558f},
-std::array<float,2>{0.471867114f, 0.705254495f},
-std::array<float,2>{0.030312242f, 0.0557684675f},
-std::array<float,2>{0.662656665f, 0.853740931f},
-std::array<float,2>{0.790245056f, 0.0826584101f},
-std::array<float,2>{0.340476155f, 0.763119936f},
-std::array<float,2>{0.163190782f, 0.313762814f},
-std::array<float,2>{0.54248333f, 0.654724181f},
-std::array<float,2>{0.723401725f, 0.452480614f},
-std::array<float,2>{0.106631905f, 0.537866712f},
-std::array<float,2>{0.390041918f, 0.161541849f},
-std::array<float,2>{0.998244345f, 0.998608708f},
-std::array<float,2>{0.684908986f, 0.164167464f},
-std::array<float,2>{0.00886563305f, 0.990107298f},
-std::array<float,2>{0.495639235f, 0.441670477f},
-std::array<float,2>{0.915244162f, 0.541602492f},
-std::array<float,2>{0.870825708f, 0.323262125f},
-std::array<float,2>{0.257284731f, 0.640906155f},
-std::array<float,2>{0.243766516f, 0.0936277881f},
-std::array<float,2>{0.57199496f, 0.75108552f},
-std::array<float,2>{0.972505331f, 0.0487940982f},
-std::array<float,2>{0.398670137f, 0.850654364f},
-std::array<float,2>{0.109629549f, 0.271887809f},
-std::array<float,2>{0.749367416f, 0.714306891f},
-std::array<float,2>{0.561411738f, 0.408788085f},
-std::array<float,2>{0.18274729f, 0.586464405f},
-std::array<float,2>{0.313969642f, 0.195792392f},
-std::array<float,2>{0.799478829f, 0.87616092f},
-std::array<float,2>{0.624092102f, 0.117756329f},
-std::array<float,2>{0.190670714f, 0.799720347f},
-std::array<float,2>{0.303676605f, 0.343834966f},
-std::array<float,2>{0.840482652f, 0.668512702f},
-std::array<float,2>{0.884881437f, 0.494480103f},
-std::array<float,2>{0.455407292f, 0.507805705f},
-std::array<float,2>{0.0383048467f, 0.155428901f},
-std::array<float,2>{0.638427675f, 0.948300123f},
-std::array<float,2>{0.771359622f, 0.232838228f},
-std::array<float,2>{0.343954325f, 0.922507465f},
-std::array<float,2>{0.151204661f, 0.387578338f},
-std::array<float,2>{0.506786942f, 0.599036753f},
-std::array<float,2>{0.687622666f, 0.290538102f},
-std::array<float,2>{0.0911043212f, 0.734691083f},
-std::array<float,2>{0.423719823f, 0.0240162797f},
-std::array<float,2>{0.951037705f, 0.821599603f},
-std::array<float,2>{0.722430944f, 0.014137893f},
-std::array<float,2>{0.103885472f, 0.829862177f},
-std::array<float,2>{0.38376072f, 0.30930984f},
-std::array<float,2>{0.994810581f, 0.722503364f},
-std::array<float,2>{0.794223666f, 0.396297306f},
-std::array<float,2>{0.336621106f, 0.622995257f},
-std::array<float,2>{0.158586591f, 0.236402631f},
-std::array<float,2>{0.544884503f, 0.911518157f},
-std::array<float,2>{0.935479343f, 0.137433112f},
-std::array<float,2>{0.474027157f, 0.968699217f},
-std::array<float,2>{0.0263733584f, 0.472022295f},
-std::array<float,2>{0.658946574f, 0.516465008f},
-std::array<float,2>{0.592397332f, 0.369580656f},
-std::array<float,2>{0.220528737f, 0.685799778f},
-std::array<float,2>{0.273577392f, 0.104758978f},
-std::array<float,2>{0.849198997f, 0.791960418f},
-std::array<float,2>{0.52231127f, 0.21059911f},
-std::array<float,2>{0.128856108f, 0.903400242f},
-std::array<float,2>{0.364337921f, 0.431410551f},
-std::array<float,2>{0.760535359f, 0.571475327f},
-std::array<float,2>{0.955563068f, 0.251787931f},
-std::array<float,2>{0.418949485f, 0.696575522f},
-std::array<float,2>{0.0697595403f, 0.0387643352f},
-std::array<float,2>{0.711194158f, 0.861963451f},
-std::array<float,2>{0.815661132f, 0.0666192621f},
-std::array<float,2>{0.286878973f, 0.765967071f},
-std::array<float,2>{0.211957887f, 0.341587573f},
-std::array<float,2>{0.594360888f, 0.632080495f},
-std::array<float,2>{0.642953515f, 0.4579992f},
-std::array<float,2>{0.0491551161f, 0.559120297f},
-std::array<float,2>{0.447312027f, 0.175220966f},
-std::array<float,2>{0.901483953f, 0.976468444f},
-std::array<float,2>{0.70760566f, 0.244984061f},
-std::array<float,2>{0.0770737976f, 0.918909132f},
-std::array<float,2>{0.413489819f, 0.40483588f},
-std::array<float,2>{0.963205278f, 0.610470831f},
-std::array<float,2>{0.755189776f, 0.297584295f},
-std::array<float,2>{0.371543378f, 0.728589118f},
-std::array<float,2>{0.134952441f, 0.000393655966f},
-std::array<float,2>{0.530097663f, 0.838675201f},
-std::array<float,2>{0.897653759f, 0.0959190726f},
-std::array<float,2>{0.439987391f, 0.781837821f},
-std::array<float,2>{0.0581480227f, 0.361211151f},
-std::array<float,2>{0.648675799f, 0.674483061f},
-std::array<float,2>{0.605722249f, 0.479812443f},
-std::array<float,2>{0.209627807f, 0.525327146f},
-std::array<float,2>{0.289755315f, 0.130883738f},
-std::array<float,2>{0.827498376f, 0.96034658f},
-std::array<float,2>{0.531980276f, 0.0425049514f},
-std::array<float,2>{0.169296697f, 0.867482305f},
-std::array<float,2>{0.335924357f, 0.265136242f},
-std::array<float,2>{0.78597194f, 0.693357766f},
-std::array<float,2>{0.98837173f, 0.4285025f},
-std::array<float,2>{0.3814556f, 0.563637376f},
-std::array<float,2>{0.0969300047f, 0.213988006f},
-std::array<float,2>{0.732494354f, 0.893422782f},
-std::array<float,2>{0.852068067f, 0.179938138f},
-std::array<float,2>{0.269727916f, 0.979034007f},
-std::array<float,2>{0.229095042f, 0.468732357f},
-std::array<float,2>{0.579106688f, 0.550896347f},
-std::array<float,2>{0.668267965f, 0.33231318f},
-std::array<float,2>{0.0187623128f, 0.633713365f},
-std::array<float,2>{0.477157921f, 0.0751511976f},
-std::array<float,2>{0.928323209f, 0.778411865f},
-std::array<float,2>{0.630507171f, 0.08085455f},
-std::array<float,2>{0.0436650254f, 0.759402156f},
-std::array<float,2>{0.462878764f, 0.317288518f},
-std::array<float,2>{0.880361319f, 0.651887357f},
-std::array<float,2>{0.83099097f, 0.448111027f},
-std::array<float,2>{0.306637049f, 0.534893572f},
-std::array<float,2>{0.199013919f, 0.159718618f},
-std::array<float,2>{0.613659441f, 0.993646801f},
-std::array<float,2>{0.942447841f, 0.193815514f},
-std::array<float,2>{0.430561781f, 0.887996256f},
-std::array<float,2>{0.0829539225f, 0.416472375f},
-std::array<float,2>{0.695631742f, 0.580222428f},
-std::array<float,2>{0.514931917f, 0.279715955f},
-std::array<float,2>{0.141958296f, 0.707755804f},
-std::array<float,2>{0.356533617f, 0.0598752387f},
-std::array<float,2>{0.775781572f, 0.857542157f},
-std::array<float,2>{0.568284869f, 0.146835119f},
-std::array<float,2>{0.237410516f, 0.943318069f},
-std::array<float,2>{0.263845533f, 0.484863609f},
-std::array<float,2>{0.866141498f, 0.509743154f},
-std::array<float,2>{0.91216135f, 0.354559541f},
-std::array<float,2>{0.489705354f, 0.66313976f},
-std::array<float,2>{0.000213821564f, 0.114614919f},
-std::array<float,2>{0.67384094f, 0.808332205f},
-std::array<float,2>{0.805883169f, 0.0232625306f},
-std::array<float,2>{0.325180352f, 0.819334745f},
-std::array<float,2>{0.172377199f, 0.28602618f},
-std::array<float,2>{0.54901731f, 0.742325842f},
-std::array<float,2>{0.734808624f, 0.380700171f},
-std::array<float,2>{0.12142057f, 0.60232991f},
-std::array<float,2>{0.392751873f, 0.220242634f},
-std::array<float,2>{0.977574766f, 0.937161386f},
-std::array<float,2>{0.655163288f, 0.200992972f},
-std::array<float,2>{0.0609858669f, 0.880805969f},
-std::array<float,2>{0.445066512f, 0.414054215f},
-std::array<float,2>{0.893881977f, 0.593414247f},
-std::array<float,2>{0.824096143f, 0.26726386f},
-std::array<float,2>{0.296580225f, 0.717419684f},
-std::array<float,2>{0.206862733f, 0.0537374802f},
-std::array<float,2>{0.602598369f, 0.846568525f},
-std::array<float,2>{0.967200994f, 0.0866752639f},
-std::array<float,2>{0.409915745f, 0.756748438f},
-std::array<float,2>{0.0712793395f, 0.326670289f},
-std::array<float,2>{0.704842806f, 0.645296216f},
-std::array<float,2>{0.524202883f, 0.437549919f},
-std::array<float,2>{0.138275087f, 0.543866694f},
-std::array<float,2>{0.368002027f, 0.171782404f},
-std::array<float,2>{0.750745356f, 0.98548156f},
-std::array<float,2>{0.585282087f, 0.0281297173f},
-std::array<float,2>{0.233510852f, 0.825694442f},
-std::array<float,2>{0.267879665f, 0.2968117f},
-std::array<float,2>{0.857210994f, 0.738550782f},
-std::array<float,2>{0.92507261f, 0.386602104f},
-std::array<float,2>{0.482512236f, 0.596842945f},
-std::array<float,2>{0.0197004061f, 0.22788702f},
-std::array<float,2>{0.664331794f, 0.92603606f},
-std::array<float,2>{0.782883883f, 0.149889603f},
-std::array<float,2>{0.328987956f, 0.949882925f},
-std::array<float,2>{0.166735381f, 0.498144656f},
-std::array<float,2>{0.536326289f, 0.502497554f},
-std::array<float,2>{0.73039484f, 0.350798577f},
-std::array<float,2>{0.0976813734f, 0.666442931f},
-std::array<float,2>{0.375534177f, 0.122516036f},
-std::array<float,2>{0.986002624f, 0.802364528f},
-std::array<float,2>{0.699975967f, 0.105624899f},
-std::array<float,2>{0.0803122446f, 0.796468735f},
-std::array<float,2>{0.436843008f, 0.374227315f},
-std::array<float,2>{0.937573731f, 0.680396855f},
-std::array<float,2>{0.778704762f, 0.474996001f},
-std::array<float,2>{0.352330804f, 0.521413267f},
-std::array<float,2>{0.147719845f, 0.134626076f},
-std::array<float,2>{0.511603177f, 0.963523805f},
-std::array<float,2>{0.875852764f, 0.239199445f},
-std::array<float,2>{0.466512054f, 0.908015251f},
-std::array<float,2>{0.0405397601f, 0.393886656f},
-std::array<float,2>{0.626833677f, 0.620233715f},
-std::array<float,2>{0.611387432f, 0.304879189f},
-std::array<float,2>{0.202252164f, 0.723270655f},
-std::array<float,2>{0.309382021f, 0.010751755f},
-std::array<float,2>{0.833971143f, 0.834105313f},
-std::array<float,2>{0.551494658f, 0.179097086f},
-std::array<float,2>{0.178711653f, 0.969144225f},
-std::array<float,2>{0.321138531f, 0.455064595f},
-std::array<float,2>{0.8095994f, 0.555561185f},
-std::array<float,2>{0.983991265f, 0.339348614f},
-std::array<float,2>{0.395980924f, 0.62547791f},
-std::array<float,2>{0.120185204f, 0.0644640625f},
-std::array<float,2>{0.739696264f, 0.772827744f},
-std::array<float,2>{0.860348463f, 0.032131914f},
-std::array<float,2>{0.259307593f, 0.86353451f},
-std::array<float,2>{0.239221707f, 0.255399257f},
-std::array<float,2>{0.563031018f, 0.702342272f},
-std::array<float,2>{0.676237285f, 0.43665874f},
-std::array<float,2>{0.00538582215f, 0.578061819f},
-std::array<float,2>{0.487715602f, 0.204545274f},
-std::array<float,2>{0.907464087f, 0.902172983f},
-std::array<float,2>{0.742662728f, 0.12565583f},
-std::array<float,2>{0.113402992f, 0.955397546f},
-std::array<float,2>{0.402597189f, 0.481861591f},
-std::array<float,2>{0.976523817f, 0.53066957f},
-std::array<float,2>{0.802673817f, 0.365409255f},
-std::array<float,2>{0.31991297f, 0.676253259f},
-std::array<float,2>{0.185235396f, 0.100348465f},
-std::array<float,2>{0.55714047f, 0.788109004f},
-std::array<float,2>{0.919830799f, 0.00469005853f},
-std::array<float,2>{0.499618351f, 0.842679977f},
-std::array<float,2>{0.0128824329f, 0.302933872f},
-std::array<float,2>{0.680003703f, 0.730669737f},
-std::array<float,2>{0.575234115f, 0.400608301f},
-std::array<float,2>{0.248887345f, 0.616526604f},
-std::array<float,2>{0.251192361f, 0.247608423f},
-std::array<float,2>{0.874111235f, 0.915530801f},
-std::array<float,2>{0.501710773f, 0.0717307553f},
-std::array<float,2>{0.153502613f, 0.774625957f},
-std::array<float,2>{0.347979635f, 0.331858486f},
-std::array<float,2>{0.767167807f, 0.639010191f},
-std::array<float,2>{0.948007703f, 0.463241249f},
-std::array<float,2>{0.426206529f, 0.549325049f},
-std::array<float,2>{0.0866018757f, 0.185366869f},
-std::array<float,2>{0.693648696f, 0.984286964f},
-std::array<float,2>{0.839838386f, 0.217015013f},
-std::array<float,2>{0.299254507f, 0.896152973f},
-std::array<float,2>{0.195038617f, 0.424134851f},
-std::array<float,2>{0.617294133f, 0.568363547f},
-std::array<float,2>{0.634481609f, 0.259085685f},
-std::array<float,2>{0.0349797085f, 0.69115591f},
-std::array<float,2>{0.46021384f, 0.0446938798f},
-std::array<float,2>{0.889271319f, 0.873458385f},
-std::array<float,2>{0.660967648f, 0.0571540482f},
-std::array<float,2>{0.0276294034f, 0.853269994f},
-std::array<float,2>{0.469237536f, 0.274083644f},
-std::array<float,2>{0.931050241f, 0.704864681f},
-std::array<float,2>{0.843790412f, 0.418331176f},
-std::array<float,2>{0.277884573f, 0.583705366f},
-std::array<float,2>{0.223657846f, 0.189548329f},
-std::array<float,2>{0.588588655f, 0.885036767f},
-std::array<float,2>{0.99691087f, 0.162255481f},
-std::array<float,2>{0.386972696f, 0.997444928f},
-std::array<float,2>{0.108844742f, 0.449429482f},
-std::array<float,2>{0.724872947f, 0.536835611f},
-std::array<float,2>{0.539347708f, 0.314562351f},
-std::array<float,2>{0.161552414f, 0.653389513f},
-std::array<float,2>{0.343745708f, 0.0843197256f},
-std::array<float,2>{0.792849481f, 0.764936149f},
-std::array<float,2>{0.600222588f, 0.224483475f},
-std::array<float,2>{0.218148559f, 0.930965602f},
-std::array<float,2>{0.281538367f, 0.376113385f},
-std::array<float,2>{0.817377269f, 0.608538985f},
-std::array<float,2>{0.903852344f, 0.282495409f},
-std::array<float,2>{0.452120423f, 0.746544242f},
-std::array<float,2>{0.0543671809f, 0.016506644f},
-std::array<float,2>{0.647369981f, 0.813187897f},
-std::array<float,2>{0.762635708f, 0.112535909f},
-std::array<float,2>{0.361919284f, 0.811840892f},
-std::array<float,2>{0.129558399f, 0.358976692f},
-std::array<float,2>{0.517328918f, 0.658251345f},
-std::array<float,2>{0.718346953f, 0.490831345f},
-std::array<float,2>{0.062515147f, 0.514725387f},
-std::array<float,2>{0.415395826f, 0.141321167f},
-std::array<float,2>{0.957759321f, 0.939706862f},
-std::array<float,2>{0.659217119f, 0.140197575f},
-std::array<float,2>{0.0257577822f, 0.965721488f},
-std::array<float,2>{0.473494917f, 0.469043106f},
-std::array<float,2>{0.934051275f, 0.518686414f},
-std::array<float,2>{0.848490477f, 0.367204338f},
-std::array<float,2>{0.275084972f, 0.684867263f},
-std::array<float,2>{0.219366133f, 0.10288202f},
-std::array<float,2>{0.593603909f, 0.790578842f},
-std::array<float,2>{0.995165408f, 0.0136708515f},
-std::array<float,2>{0.384296179f, 0.831148028f},
-std::array<float,2>{0.105135314f, 0.311505735f},
-std::array<float,2>{0.721296191f, 0.719311833f},
-std::array<float,2>{0.543011546f, 0.397667259f},
-std::array<float,2>{0.159193203f, 0.624513328f},
-std::array<float,2>{0.337467045f, 0.235803545f},
-std::array<float,2>{0.79349184f, 0.913690925f},
-std::array<float,2>{0.595356107f, 0.0694543496f},
-std::array<float,2>{0.211172134f, 0.769360483f},
-std::array<float,2>{0.285537481f, 0.342248827f},
-std::array<float,2>{0.814526618f, 0.629474163f},
-std::array<float,2>{0.90105021f, 0.459353864f},
-std::array<float,2>{0.448544115f, 0.560746849f},
-std::array<float,2>{0.0499742776f, 0.173172265f},
-std::array<float,2>{0.643776178f, 0.973302126f},
-std::array<float,2>{0.761697352f, 0.207429424f},
-std::array<float,2>{0.363383979f, 0.905714273f},
-std::array<float,2>{0.127257988f, 0.432934791f},
-std::array<float,2>{0.523388803f, 0.573435426f},
-std::array<float,2>{0.712313354f, 0.253168166f},
-std::array<float,2>{0.0685758218f, 0.697843671f},
-std::array<float,2>{0.41888842f, 0.0368157737f},
-std::array<float,2>{0.956503212f, 0.860495985f},
-std::array<float,2>{0.74889344f, 0.0493529141f},
-std::array<float,2>{0.110783428f, 0.847863615f},
-std::array<float,2>{0.399451345f, 0.269639254f},
-std::array<float,2>{0.971448362f, 0.71281451f},
-std::array<float,2>{0.800044537f, 0.406696528f},
-std::array<float,2>{0.3133865f, 0.589223027f},
-std::array<float,2>{0.182558268f, 0.199156389f},
-std::array<float,2>{0.562223375f, 0.877215326f},
-std::array<float,2>{0.914580882f, 0.167455003f},
-std::array<float,2>{0.494489908f, 0.990727365f},
-std::array<float,2>{0.00794808194f, 0.444496483f},
-std::array<float,2>{0.684011102f, 0.539292097f},
-std::array<float,2>{0.570766807f, 0.322261244f},
-std::array<float,2>{0.24265264f, 0.643042088f},
-std::array<float,2>{0.256759673f, 0.0905593634f},
-std::array<float,2>{0.869826794f, 0.753454328f},
-std::array<float,2>{0.506999135f, 0.231130272f},
-std::array<float,2>{0.152053386f, 0.925161064f},
-std::array<float,2>{0.345200926f, 0.390276462f},
-std::array<float,2>{0.769637167f, 0.600818872f},
-std::array<float,2>{0.950066209f, 0.292904496f},
-std::array<float,2>{0.422844499f, 0.738146544f},
-std::array<float,2>{0.0904258788f, 0.0261061788f},
-std::array<float,2>{0.688872695f, 0.824176133f},
-std::array<float,2>{0.840875447f, 0.120122813f},
-std::array<float,2>{0.304255664f, 0.796909034f},
-std::array<float,2>{0.190099031f, 0.347432375f},
-std::array<float,2>{0.623160064f, 0.670709848f},
-std::array<float,2>{0.637592435f, 0.493561774f},
-std::array<float,2>{0.0377525613f, 0.504647672f},
-std::array<float,2>{0.456615686f, 0.152716815f},
-std::array<float,2>{0.886288404f, 0.94691509f},
-std::array<float,2>{0.697202146f, 0.192990661f},
-std::array<float,2>{0.0832934901f, 0.889253974f},
-std::array<float,2>{0.431410253f, 0.414375633f},
-std::array<float,2>{0.941709816f, 0.579997659f},
-std::array<float,2>{0.776387334f, 0.277985722f},
-std::array<float,2>{0.35630092f, 0.710918665f},
-std::array<float,2>{0.140912294f, 0.0615698546f},
-std::array<float,2>{0.513998091f, 0.856216908f},
-std::array<float,2>{0.879512012f, 0.0789105445f},
-std::array<float,2>{0.461758286f, 0.76061362f},
-std::array<float,2>{0.0442030281f, 0.318879426f},
-std::array<float,2>{0.629699647f, 0.650123656f},
-std::array<float,2>{0.614395618f, 0.445891947f},
-std::array<float,2>{0.197419524f, 0.532985389f},
-std::array<float,2>{0.305092007f, 0.157623008f},
-std::array<float,2>{0.831706047f, 0.995357454f},
-std::array<float,2>{0.549977958f, 0.0197312366f},
-std::array<float,2>{0.173532978f, 0.817674458f},
-std::array<float,2>{0.326053202f, 0.287509292f},
-std::array<float,2>{0.804822326f, 0.745173872f},
-std::array<float,2>{0.976764858f, 0.381017953f},
-std::array<float,2>{0.393607616f, 0.605468452f},
-std::array<float,2>{0.12297643f, 0.221054688f},
-std::array<float,2>{0.73614949f, 0.933929622f},
-std::array<float,2>{0.867110848f, 0.144717604f},
-std::array<float,2>{0.265109241f, 0.94452697f},
-std::array<float,2>{0.237046525f, 0.487885326f},
-std::array<float,2>{0.567039967f, 0.509922266f},
-std::array<float,2>{0.674942672f, 0.353300452f},
-std::array<float,2>{0.00113733462f, 0.661773264f},
-std::array<float,2>{0.489059299f, 0.115560897f},
-std::array<float,2>{0.913591623f, 0.80528307f},
-std::array<float,2>{0.650178969f, 0.0949098095f},
-std::array<float,2>{0.0575161316f, 0.784531832f},
-std::array<float,2>{0.440680534f, 0.361869097f},
-std::array<float,2>{0.896812916f, 0.672559023f},
-std::array<float,2>{0.82713449f, 0.477268547f},
-std::array<float,2>{0.290585577f, 0.527023852f},
-std::array<float,2>{0.210934624f, 0.129572779f},
-std::array<float,2>{0.607216537f, 0.957767546f},
-std::array<float,2>{0.964713573f, 0.243408129f},
-std::array<float,2>{0.412202239f, 0.920954585f},
-std::array<float,2>{0.0778738931f, 0.404116243f},
-std::array<float,2>{0.708195388f, 0.612861753f},
-std::array<float,2>{0.530422628f, 0.299477577f},
-std::array<float,2>{0.136547476f, 0.726995647f},
-std::array<float,2>{0.37279284f, 0.00325578032f},
-std::array<float,2>{0.754300296f, 0.836509526f},
-std::array<float,2>{0.579065025f, 0.182753235f},
-std::array<float,2>{0.229980156f, 0.978468537f},
-std::array<float,2>{0.271057904f, 0.466352373f},
-std::array<float,2>{0.852929533f, 0.553265214f},
-std::array<float,2>{0.928957462f, 0.334071308f},
-std::array<float,2>{0.478263974f, 0.635380626f},
-std::array<float,2>{0.018133048f, 0.0764465258f},
-std::array<float,2>{0.668949425f, 0.779896796f},
-std::array<float,2>{0.787076712f, 0.0401377976f},
-std::array<float,2>{0.334250122f, 0.869356215f},
-std::array<float,2>{0.168731004f, 0.262996852f},
-std::array<float,2>{0.53267628f, 0.694549859f},
-std::array<float,2>{0.734243512f, 0.427434713f},
-std::array<float,2>{0.0962807164f, 0.565670907f},
-std::array<float,2>{0.382552922f, 0.212541759f},
-std::array<float,2>{0.989935279f, 0.89250499f},
-std::array<float,2>{0.625739276f, 0.2415995f},
-std::array<float,2>{0.0396904908f, 0.908443332f},
-std::array<float,2>{0.465742975f, 0.391453415f},
-std::array<float,2>{0.876936853f, 0.618276477f},
-std::array<float,2>{0.832943082f, 0.308453023f},
-std::array<float,2>{0.309768051f, 0.724673927f},
-std::array<float,2>{0.20201987f, 0.00782549847f},
-std::array<float,2>{0.612533569f, 0.833137512f},
-std::array<float,2>{0.938902199f, 0.108157322f},
-std::array<float,2>{0.436360747f, 0.794332922f},
-std::array<float,2>{0.0813280046f, 0.371218532f},
-std::array<float,2>{0.700784922f, 0.683086932f},
-std::array<float,2>{0.510146201f, 0.472962767f},
-std::array<float,2>{0.147148684f, 0.522635579f},
-std::array<float,2>{0.352908522f, 0.136346936f},
-std::array<float,2>{0.777387202f, 0.961460412f},
-std::array<float,2>{0.563523948f, 0.0347813703f},
-std::array<float,2>{0.240079567f, 0.865663886f},
-std::array<float,2>{0.258117914f, 0.257351398f},
-std::array<float,2>{0.860984623f, 0.699414134f},
-std::array<float,2>{0.907220185f, 0.434169918f},
-std::array<float,2>{0.486372501f, 0.575123966f},
-std::array<float,2>{0.00436494127f, 0.20589532f},
-std::array<float,2>{0.677662849f, 0.899507463f},
-std::array<float,2>{0.80877018f, 0.17752251f},
-std::array<float,2>{0.321790427f, 0.972382605f},
-std::array<float,2>{0.17833358f, 0.456073225f},
-std::array<float,2>{0.552479744f, 0.557524323f},
-std::array<float,2>{0.738632798f, 0.336507022f},
-std::array<float,2>{0.119350187f, 0.627781987f},
-std::array<float,2>{0.395469397f, 0.0635050908f},
-std::array<float,2>{0.982862651f, 0.769842744f},
-std::array<float,2>{0.704020739f, 0.0898367018f},
-std::array<float,2>{0.0714777708f, 0.755482852f},
-std::array<float,2>{0.408412039f, 0.324946791f},
-std::array<float,2>{0.967806458f, 0.646992266f},
-std::array<float,2>{0.751507461f, 0.439583331f},
-std::array<float,2>{0.368905962f, 0.54667598f},
-std::array<float,2>{0.13674736f, 0.168097273f},
-std::array<float,2>{0.52505666f, 0.98635f},
-std::array<float,2>{0.89310509f, 0.20285587f},
-std::array<float,2>{0.443677962f, 0.882179677f},
-std::array<float,2>{0.0624869317f, 0.411352187f},
-std::array<float,2>{0.656179249f, 0.590887904f},
-std::array<float,2>{0.601626217f, 0.267750591f},
-std::array<float,2>{0.205790475f, 0.715188086f},
-std::array<float,2>{0.295837194f, 0.0524324551f},
-std::array<float,2>{0.822483659f, 0.844824731f},
-std::array<float,2>{0.535711527f, 0.151652619f},
-std::array<float,2>{0.167391062f, 0.952029765f},
-std::array<float,2>{0.329356402f, 0.496509761f},
-std::array<float,2>{0.78175652f, 0.501461029f},
-std::array<float,2>{0.985096753f, 0.34826681f},
-std::array<float,2>{0.376791626f, 0.665788114f},
-std::array<float,2>{0.0991749316f, 0.124484964f},
-std::array<float,2>{0.728890598f, 0.802895606f},
-std::array<float,2>{0.856111884f, 0.0300441831f},
-std::array<float,2>{0.268792868f, 0.826979458f},
-std::array<float,2>{0.233240932f, 0.294615686f},
-std::array<float,2>{0.584258378f, 0.741214216f},
-std::array<float,2>{0.665525913f, 0.383066535f},
-std::array<float,2>{0.0213192347f, 0.594620883f},
-std::array<float,2>{0.483525664f, 0.228954107f},
-std::array<float,2>{0.924440444f, 0.927957892f},
-std::array<float,2>{0.726123571f, 0.160162807f},
-std::array<float,2>{0.107453205f, 0.999825358f},
-std::array<float,2>{0.387808949f, 0.451392829f},
-std::array<float,2>{0.997653306f, 0.539057732f},
-std::array<float,2>{0.791534543f, 0.312737435f},
-std::array<float,2>{0.34254393f, 0.655876994f},
-std::array<float,2>{0.161131158f, 0.083762221f},
-std::array<float,2>{0.54070282f, 0.762362242f},
-std::array<float,2>{0.93043524f, 0.0556338504f},
-std::array<float,2>{0.47006169f, 0.85462749f},
-std::array<float,2>{0.0287643149f, 0.276526362f},
-std::array<float,2>{0.661467373f, 0.706816912f},
-std::array<float,2>{0.589318097f, 0.421685874f},
-std::array<float,2>{0.223024204f, 0.585381448f},
-std::array<float,2>{0.278420955f, 0.188371137f},
-std::array<float,2>{0.84548974f, 0.882845342f},
-std::array<float,2>{0.516597927f, 0.110988639f},
-std::array<float,2>{0.130199581f, 0.810366273f},
-std::array<float,2>{0.363077432f, 0.355517119f},
-std::array<float,2>{0.763339937f, 0.657936394f},
-std::array<float,2>{0.958668709f, 0.489647508f},
-std::array<float,2>{0.414304763f, 0.513410091f},
-std::array<float,2>{0.0643056184f, 0.142776638f},
-std::array<float,2>{0.717569172f, 0.93837744f},
-std::array<float,2>{0.818277359f, 0.225577742f},
-std::array<float,2>{0.28240943f, 0.933055699f},
-std::array<float,2>{0.217507884f, 0.377825052f},
-std::array<float,2>{0.601537406f, 0.607012212f},
-std::array<float,2>{0.647609651f, 0.28461352f},
-std::array<float,2>{0.0533570312f, 0.748120189f},
-std::array<float,2>{0.452756554f, 0.0193659514f},
-std::array<float,2>{0.902619898f, 0.815137446f},
-std::array<float,2>{0.681343496f, 0.00749111315f},
-std::array<float,2>{0.0122177098f, 0.841563702f},
-std::array<float,2>{0.498840749f, 0.301141739f},
-std::array<float,2>{0.918278873f, 0.733940303f},
-std::array<float,2>{0.873123109f, 0.399996936f},
-std::array<float,2>{0.250503868f, 0.614997625f},
-std::array<float,2>{0.249665171f, 0.249997258f},
-std::array<float,2>{0.574851632f, 0.917203963f},
-std::array<float,2>{0.975384474f, 0.128691345f},
-std::array<float,2>{0.403945982f, 0.95429951f},
-std::array<float,2>{0.114739992f, 0.483409643f},
-std::array<float,2>{0.743723333f, 0.52791512f},
-std::array<float,2>{0.558318436f, 0.364826381f},
-std::array<float,2>{0.183705568f, 0.679083824f},
-std::array<float,2>{0.318924755f, 0.0992443264f},
-std::array<float,2>{0.801588655f, 0.786312997f},
-std::array<float,2>{0.61835295f, 0.215823293f},
-std::array<float,2>{0.193983242f, 0.897438824f},
-std::array<float,2>{0.300646365f, 0.422911465f},
-std::array<float,2>{0.838817179f, 0.568202496f},
-std::array<float,2>{0.890067577f, 0.260495812f},
-std::array<float,2>{0.459048629f, 0.688624561f},
-std::array<float,2>{0.0336870514f, 0.0450123176f},
-std::array<float,2>{0.63366586f, 0.872660458f},
-std::array<float,2>{0.765697956f, 0.0722942278f},
-std::array<float,2>{0.349554032f, 0.776916564f},
-std::array<float,2>{0.152544037f, 0.329836369f},
-std::array<float,2>{0.500386178f, 0.636878312f},
-std::array<float,2>{0.695148766f, 0.46236515f},
-std::array<float,2>{0.0875041336f, 0.54742527f},
-std::array<float,2>{0.427467972f, 0.185619041f},
-std::array<float,2>{0.94859308f, 0.981089711f},
-std::array<float,2>{0.641393006f, 0.174245328f},
-std::array<float,2>{0.0485356599f, 0.974951684f},
-std::array<float,2>{0.446860015f, 0.458751589f},
-std::array<float,2>{0.898688674f, 0.560348332f},
-std::array<float,2>{0.813155591f, 0.339905381f},
-std::array<float,2>{0.288859993f, 0.631191909f},
-std::array<float,2>{0.213768646f, 0.0678344592f},
-std::array<float,2>{0.597470284f, 0.767201185f},
-std::array<float,2>{0.953545034f, 0.0376015976f},
-std::array<float,2>{0.420044392f, 0.862989485f},
-std::array<float,2>{0.0670690984f, 0.250243664f},
-std::array<float,2>{0.713756323f, 0.696082771f},
-std::array<float,2>{0.519578576f, 0.430555254f},
-std::array<float,2>{0.12580204f, 0.571032584f},
-std::array<float,2>{0.366055548f, 0.209838495f},
-std::array<float,2>{0.758249879f, 0.902833879f},
-std::array<float,2>{0.590755761f, 0.103570715f},
-std::array<float,2>{0.222154722f, 0.792355478f},
-std::array<float,2>{0.276950181f, 0.37080279f},
-std::array<float,2>{0.850446105f, 0.686860621f},
-std::array<float,2>{0.936231911f, 0.471480995f},
-std::array<float,2>{0.475566894f, 0.517425478f},
-std::array<float,2>{0.0238531828f, 0.138354555f},
-std::array<float,2>{0.656863093f, 0.966928005f},
-std::array<float,2>{0.795507252f, 0.237699822f},
-std::array<float,2>{0.339702874f, 0.910463572f},
-std::array<float,2>{0.156336427f, 0.395132154f},
-std::array<float,2>{0.546539783f, 0.621643722f},
-std::array<float,2>{0.72056669f, 0.310198039f},
-std::array<float,2>{0.10323257f, 0.721503258f},
-std::array<float,2>{0.385371357f, 0.0152979651f},
-std::array<float,2>{0.993853629f, 0.828737497f},
-std::array<float,2>{0.689948559f, 0.0248808078f},
-std::array<float,2>{0.0918091461f, 0.820816338f},
-std::array<float,2>{0.425355136f, 0.289207399f},
-std::array<float,2>{0.952115297f, 0.735387087f},
-std::array<float,2>{0.773432434f, 0.388193458f},
-std::array<float,2>{0.347627699f, 0.598059058f},
-std::array<float,2>{0.148536161f, 0.234222472f},
-std::array<float,2>{0.504801452f, 0.92370069f},
-std::array<float,2>{0.883116782f, 0.154627591f},
-std::array<float,2>{0.454390138f, 0.947660089f},
-std::array<float,2>{0.0362203978f, 0.495751739f},
-std::array<float,2>{0.638901651f, 0.505945206f},
-std::array<float,2>{0.622388721f, 0.345002562f},
-std::array<float,2>{0.187921345f, 0.669039071f},
-std::array<float,2>{0.302101433f, 0.118303731f},
-std::array<float,2>{0.842951596f, 0.800333679f},
-std::array<float,2>{0.559714139f, 0.19690977f},
-std::array<float,2>{0.179755732f, 0.875898123f},
-std::array<float,2>{0.316373706f, 0.409549356f},
-std::array<float,2>{0.797629416f, 0.587861657f},
-std::array<float,2>{0.969219267f, 0.272842437f},
-std::array<float,2>{0.402255058f, 0.713327348f},
-std::array<float,2>{0.113123074f, 0.047494065f},
-std::array<float,2>{0.747498989f, 0.850254416f},
-std::array<float,2>{0.867314816f, 0.0924955606f},
-std::array<float,2>{0.254116297f, 0.750235319f},
-std::array<float,2>{0.245806858f, 0.322832495f},
-std::array<float,2>{0.572454929f, 0.642563581f},
-std::array<float,2>{0.687408805f, 0.442454129f},
-std::array<float,2>{0.0108867036f, 0.542079151f},
-std::array<float,2>{0.492692113f, 0.165053278f},
-std::array<float,2>{0.917781532f, 0.98837781f},
-std::array<float,2>{0.736980855f, 0.219571456f},
-std::array<float,2>{0.124100752f, 0.935821593f},
-std::array<float,2>{0.392275482f, 0.379481673f},
-std::array<float,2>{0.980314732f, 0.603344977f},
-std::array<float,2>{0.808176637f, 0.286563605f},
-std::array<float,2>{0.328099608f, 0.743204415f},
-std::array<float,2>{0.174076334f, 0.0222058743f},
-std::array<float,2>{0.547376871f, 0.820140302f},
-std::array<float,2>{0.911575794f, 0.113405839f},
-std::array<float,2>{0.491863191f, 0.806803703f},
-std::array<float,2>{0.00245420053f, 0.353630751f},
-std::array<float,2>{0.672407687f, 0.663066149f},
-std::array<float,2>{0.569437385f, 0.486226797f},
-std::array<float,2>{0.236094922f, 0.508347511f},
-std::array<float,2>{0.263581425f, 0.148369446f},
-std::array<float,2>{0.864690006f, 0.941667199f},
-std::array<float,2>{0.51253891f, 0.0594230071f},
-std::array<float,2>{0.143333763f, 0.858961582f},
-std::array<float,2>{0.359057993f, 0.280385643f},
-std::array<float,2>{0.774931133f, 0.708582044f},
-std::array<float,2>{0.944062829f, 0.417013198f},
-std::array<float,2>{0.433539659f, 0.581101239f},
-std::array<float,2>{0.0856569856f, 0.194635838f},
-std::array<float,2>{0.697538555f, 0.887087286f},
-std::array<float,2>{0.829893291f, 0.158754617f},
-std::array<float,2>{0.308095396f, 0.992380083f},
-std::array<float,2>{0.195656434f, 0.449092001f},
-std::array<float,2>{0.61623925f, 0.533335209f},
-std::array<float,2>{0.632555664f, 0.31756866f},
-std::array<float,2>{0.0461311266f, 0.650647461f},
-std::array<float,2>{0.464102864f, 0.0814196095f},
-std::array<float,2>{0.88240248f, 0.758071125f},
-std::array<float,2>{0.670677841f, 0.0757596269f},
-std::array<float,2>{0.0161764864f, 0.777684033f},
-std::array<float,2>{0.480176836f, 0.333143026f},
-std::array<float,2>{0.927397847f, 0.633872867f},
-std::array<float,2>{0.854712844f, 0.467465162f},
-std::array<float,2>{0.272134453f, 0.551932454f},
-std::array<float,2>{0.227445334f, 0.181325018f},
-std::array<float,2>{0.580694675f, 0.980431318f},
-std::array<float,2>{0.990620434f, 0.213671625f},
-std::array<float,2>{0.380836219f, 0.894239187f},
-std::array<float,2>{0.0946159065f, 0.429197222f},
-std::array<float,2>{0.732167542f, 0.563195705f},
-std::array<float,2>{0.534197509f, 0.263733476f},
-std::array<float,2>{0.171333224f, 0.691734195f},
-std::array<float,2>{0.333023578f, 0.0414959602f},
-std::array<float,2>{0.788551331f, 0.868754506f},
-std::array<float,2>{0.608464181f, 0.132228956f},
-std::array<float,2>{0.207800135f, 0.959927201f},
-std::array<float,2>{0.292670071f, 0.479085058f},
-std::array<float,2>{0.82559067f, 0.523814082f},
-std::array<float,2>{0.89637661f, 0.359918654f},
-std::array<float,2>{0.438026667f, 0.675523639f},
-std::array<float,2>{0.0560934506f, 0.0967919901f},
-std::array<float,2>{0.650684118f, 0.782695174f},
-std::array<float,2>{0.757661462f, 0.00152375095f},
-std::array<float,2>{0.374253422f, 0.839721441f},
-std::array<float,2>{0.134022295f, 0.29872483f},
-std::array<float,2>{0.528749347f, 0.730110824f},
-std::array<float,2>{0.710910916f, 0.405458272f},
-std::array<float,2>{0.0760867596f, 0.609429359f},
-std::array<float,2>{0.411068738f, 0.245801687f},
-std::array<float,2>{0.961745262f, 0.919159412f},
-std::array<float,2>{0.679127455f, 0.204098642f},
-std::array<float,2>{0.00659121573f, 0.901146412f},
-std::array<float,2>{0.485710233f, 0.435793549f},
-std::array<float,2>{0.909445822f, 0.576307416f},
-std::array<float,2>{0.863037646f, 0.254419088f},
-std::array<float,2>{0.260220379f, 0.701187849f},
-std::array<float,2>{0.240869164f, 0.0325677469f},
-std::array<float,2>{0.565715134f, 0.864878953f},
-std::array<float,2>{0.980609357f, 0.0659748837f},
-std::array<float,2>{0.398181707f, 0.771894872f},
-std::array<float,2>{0.118912086f, 0.33791095f},
-std::array<float,2>{0.741611481f, 0.626361251f},
-std::array<float,2>{0.553879738f, 0.453204721f},
-std::array<float,2>{0.176252589f, 0.556378484f},
-std::array<float,2>{0.322743326f, 0.178668991f},
-std::array<float,2>{0.811133146f, 0.970003009f},
-std::array<float,2>{0.610883772f, 0.0103205582f},
-std::array<float,2>{0.200619817f, 0.835546434f},
-std::array<float,2>{0.310965061f, 0.306635439f},
-std::array<float,2>{0.834115148f, 0.723822653f},
-std::array<float,2>{0.877752423f, 0.392710179f},
-std::array<float,2>{0.467937976f, 0.619792521f},
-std::array<float,2>{0.0419863276f, 0.23955369f},
-std::array<float,2>{0.628244758f, 0.906761348f},
-std::array<float,2>{0.780998647f, 0.133612305f},
-std::array<float,2>{0.353765696f, 0.963985264f},
-std::array<float,2>{0.145469069f, 0.475726098f},
-std::array<float,2>{0.508921921f, 0.519605219f},
-std::array<float,2>{0.702612579f, 0.373852432f},
-std::array<float,2>{0.0783569664f, 0.680761755f},
-std::array<float,2>{0.435541451f, 0.107184075f},
-std::array<float,2>{0.940739691f, 0.795382559f},
-std::array<float,2>{0.727375388f, 0.12131954f},
-std::array<float,2>{0.101112425f, 0.8008551f},
-std::array<float,2>{0.378012389f, 0.35021624f},
-std::array<float,2>{0.987154186f, 0.667005658f},
-std::array<float,2>{0.783394992f, 0.499349087f},
-std::array<float,2>{0.331029713f, 0.503668845f},
-std::array<float,2>{0.16579622f, 0.149137661f},
-std::array<float,2>{0.538048506f, 0.950986028f},
-std::array<float,2>{0.922759295f, 0.227519974f},
-std::array<float,2>{0.480994523f, 0.927253723f},
-std::array<float,2>{0.0223205853f, 0.385500699f},
-std::array<float,2>{0.666091561f, 0.596321762f},
-std::array<float,2>{0.582564771f, 0.295788407f},
-std::array<float,2>{0.230939001f, 0.739701569f},
-std::array<float,2>{0.266745448f, 0.0284937695f},
-std::array<float,2>{0.858113706f, 0.824283898f},
-std::array<float,2>{0.526970208f, 0.169988409f},
-std::array<float,2>{0.139471218f, 0.984570503f},
-std::array<float,2>{0.371022731f, 0.43901664f},
-std::array<float,2>{0.753540576f, 0.544789314f},
-std::array<float,2>{0.966765821f, 0.327724963f},
-std::array<float,2>{0.407940298f, 0.64610225f},
-std::array<float,2>{0.0727852881f, 0.0877943039f},
-std::array<float,2>{0.706368446f, 0.757066488f},
-std::array<float,2>{0.821467161f, 0.0528609715f},
-std::array<float,2>{0.293748111f, 0.847405136f},
-std::array<float,2>{0.203616157f, 0.265930176f},
-std::array<float,2>{0.603666902f, 0.718597353f},
-std::array<float,2>{0.653239906f, 0.412861675f},
-std::array<float,2>{0.0587804504f, 0.592183113f},
-std::array<float,2>{0.44298327f, 0.199990019f},
-std::array<float,2>{0.890945256f, 0.879136324f},
-std::array<float,2>{0.716238439f, 0.142233878f},
-std::array<float,2>{0.0647427142f, 0.940902531f},
-std::array<float,2>{0.417941511f, 0.491672099f},
-std::array<float,2>{0.960256815f, 0.51458323f},
-std::array<float,2>{0.765269995f, 0.357515812f},
-std::array<float,2>{0.360484838f, 0.659772575f},
-std::array<float,2>{0.130912215f, 0.112248152f},
-std::array<float,2>{0.518207669f, 0.811198711f},
-std::array<float,2>{0.90459013f, 0.0175215807f},
-std::array<float,2>{0.450685799f, 0.813643157f},
-std::array<float,2>{0.0520842038f, 0.28200826f},
-std::array<float,2>{0.645524383f, 0.747505307f},
-std::array<float,2>{0.599169314f, 0.375639707f},
-std::array<float,2>{0.214848682f, 0.608330488f},
-std::array<float,2>{0.283340842f, 0.223486975f},
-std::array<float,2>{0.818761289f, 0.930563986f},
-std::array<float,2>{0.541043937f, 0.0849620551f},
-std::array<float,2>{0.162438154f, 0.763878167f},
-std::array<float,2>{0.341716915f, 0.315436989f},
-std::array<float,2>{0.789501429f, 0.65259248f},
-std::array<float,2>{0.999677658f, 0.45025453f},
-std::array<float,2>{0.388937593f, 0.535679758f},
-std::array<float,2>{0.105819151f, 0.163684413f},
-std::array<float,2>{0.724432766f, 0.996805489f},
-std::array<float,2>{0.847416699f, 0.191278502f},
-std::array<float,2>{0.279680699f, 0.886485696f},
-std::array<float,2>{0.225792646f, 0.419036061f},
-std::array<float,2>{0.587362647f, 0.582662582f},
-std::array<float,2>{0.66374135f, 0.274754524f},
-std::array<float,2>{0.0294870194f, 0.703215361f},
-std::array<float,2>{0.471281707f, 0.0580524988f},
-std::array<float,2>{0.931807399f, 0.851920247f},
-std::array<float,2>{0.636421621f, 0.0436565578f},
-std::array<float,2>{0.0321135968f, 0.874612212f},
-std::array<float,2>{0.457312673f, 0.258327931f},
-std::array<float,2>{0.88777411f, 0.690355062f},
-std::array<float,2>{0.83703649f, 0.425469488f},
-std::array<float,2>{0.29836309f, 0.569880664f},
-std::array<float,2>{0.192554712f, 0.217828959f},
-std::array<float,2>{0.619493246f, 0.894916713f},
-std::array<float,2>{0.946644843f, 0.184025183f},
-std::array<float,2>{0.428448379f, 0.983110905f},
-std::array<float,2>{0.0882441774f, 0.464821905f},
-std::array<float,2>{0.693256736f, 0.550376952f},
-std::array<float,2>{0.502415061f, 0.33033824f},
-std::array<float,2>{0.155091912f, 0.640115321f},
-std::array<float,2>{0.351376235f, 0.0708082542f},
-std::array<float,2>{0.768402815f, 0.773715794f},
-std::array<float,2>{0.576649666f, 0.246168837f},
-std::array<float,2>{0.247363329f, 0.914757907f},
-std::array<float,2>{0.252593786f, 0.401832372f},
-std::array<float,2>{0.872129798f, 0.615405977f},
-std::array<float,2>{0.92183125f, 0.304449201f},
-std::array<float,2>{0.497385055f, 0.73221463f},
-std::array<float,2>{0.0137966424f, 0.00552604115f},
-std::array<float,2>{0.682464719f, 0.8427791f},
-std::array<float,2>{0.804270923f, 0.101038165f},
-std::array<float,2>{0.318092763f, 0.787361145f},
-std::array<float,2>{0.187396944f, 0.366419077f},
-std::array<float,2>{0.556418478f, 0.677058637f},
-std::array<float,2>{0.745340109f, 0.481170505f},
-std::array<float,2>{0.117182188f, 0.529760361f},
-std::array<float,2>{0.405212581f, 0.126936108f},
-std::array<float,2>{0.973193049f, 0.95660758f}}
\ No newline at end of file
@@ -1,4096 +0,0 @@
-{std::array<float,2>{0.778967142f, 0.845234692f},
-std::array<float,2>{0.208023995f, 0.0826971084f},
-std::array<float,2>{0.483580232f, 0.520095289f},
-std::array<float,2>{0.625109255f, 0.309451312f},
-std::array<float,2>{0.558906972f, 0.720713794f},
-std::array<float,2>{0.321714878f, 0.390890986f},
-std::array<float,2>{0.0360713452f, 0.928570211f},
-std::array<float,2>{0.919276774f, 0.131798834f},
-std::array<float,2>{0.992552757f, 0.616649747f},
-std::array<float,2>{0.0771622956f, 0.36648652f},
-std::array<float,2>{0.295129538f, 0.793911874f},
-std::array<float,2>{0.596093774f, 0.0111701684f},
-std::array<float,2>{0.726969242f, 0.998212814f},
-std::array<float,2>{0.395977527f, 0.201337323f},
-std::array<float,2>{0.170645207f, 0.639871716f},
-std::array<float,2>{0.850172579f, 0.45032838f},
-std::array<float,2>{0.889064729f, 0.890609741f},
-std::array<float,2>{0.0243403744f, 0.173224613f},
-std::array<float,2>{0.361861825f, 0.710668683f},
-std::array<float,2>{0.502208352f, 0.410274625f},
-std::array<float,2>{0.661429346f, 0.548556864f},
-std::array<float,2>{0.46026662f, 0.272262484f},
-std::array<float,2>{0.246164471f, 0.832856894f},
-std::array<float,2>{0.799812496f, 0.118436627f},
-std::array<float,2>{0.819780767f, 0.657538533f},
-std::array<float,2>{0.125593886f, 0.470399737f},
-std::array<float,2>{0.408043802f, 0.954127371f},
-std::array<float,2>{0.703463912f, 0.223284885f},
-std::array<float,2>{0.568465412f, 0.774793565f},
-std::array<float,2>{0.277886122f, 0.050767377f},
-std::array<float,2>{0.115996845f, 0.565715313f},
-std::array<float,2>{0.948724926f, 0.331212431f},
-std::array<float,2>{0.957137883f, 0.804850638f},
-std::array<float,2>{0.106461853f, 0.0207470115f},
-std::array<float,2>{0.263549745f, 0.606610358f},
-std::array<float,2>{0.582370996f, 0.355279982f},
-std::array<float,2>{0.698879004f, 0.648243606f},
-std::array<float,2>{0.429852426f, 0.466581345f},
-std::array<float,2>{0.148081705f, 0.979690611f},
-std::array<float,2>{0.841593325f, 0.204229429f},
-std::array<float,2>{0.784672022f, 0.500270844f},
-std::array<float,2>{0.219079152f, 0.282521755f},
-std::array<float,2>{0.45270294f, 0.865939677f},
-std::array<float,2>{0.682107329f, 0.0735925734f},
-std::array<float,2>{0.52276516f, 0.917464674f},
-std::array<float,2>{0.357761681f, 0.151855931f},
-std::array<float,2>{0.000105507796f, 0.749131322f},
-std::array<float,2>{0.895683765f, 0.377394855f},
-std::array<float,2>{0.867503524f, 0.938988268f},
-std::array<float,2>{0.179529086f, 0.240607381f},
-std::array<float,2>{0.387789726f, 0.672284067f},
-std::array<float,2>{0.735461712f, 0.497407973f},
-std::array<float,2>{0.621585548f, 0.581255376f},
-std::array<float,2>{0.30874151f, 0.313548654f},
-std::array<float,2>{0.0886879787f, 0.75463748f},
-std::array<float,2>{0.978941143f, 0.0353964902f},
-std::array<float,2>{0.924487114f, 0.702546597f},
-std::array<float,2>{0.0565576218f, 0.421908975f},
-std::array<float,2>{0.343120128f, 0.904620707f},
-std::array<float,2>{0.545904875f, 0.160130441f},
-std::array<float,2>{0.641950905f, 0.825261414f},
-std::array<float,2>{0.497166753f, 0.105105661f},
-std::array<float,2>{0.199645817f, 0.538819373f},
-std::array<float,2>{0.758536935f, 0.265500665f},
-std::array<float,2>{0.832749248f, 0.760824919f},
-std::array<float,2>{0.149298772f, 0.0395343043f},
-std::array<float,2>{0.42448464f, 0.588511229f},
-std::array<float,2>{0.688730001f, 0.322426677f},
-std::array<float,2>{0.586424172f, 0.680054009f},
-std::array<float,2>{0.255250752f, 0.491093427f},
-std::array<float,2>{0.096256949f, 0.949920297f},
-std::array<float,2>{0.967461467f, 0.243960783f},
-std::array<float,2>{0.90455991f, 0.544203877f},
-std::array<float,2>{0.0106042288f, 0.25093624f},
-std::array<float,2>{0.345533103f, 0.819621921f},
-std::array<float,2>{0.523931324f, 0.0948976651f},
-std::array<float,2>{0.673443079f, 0.893616199f},
-std::array<float,2>{0.440775096f, 0.16410467f},
-std::array<float,2>{0.230022162f, 0.692122281f},
-std::array<float,2>{0.790820599f, 0.433535367f},
-std::array<float,2>{0.975649118f, 0.969703496f},
-std::array<float,2>{0.0795241296f, 0.21137476f},
-std::array<float,2>{0.297270089f, 0.652664602f},
-std::array<float,2>{0.612635493f, 0.458269298f},
-std::array<float,2>{0.748460412f, 0.601224303f},
-std::array<float,2>{0.376990914f, 0.350491911f},
-std::array<float,2>{0.180195659f, 0.800755084f},
-std::array<float,2>{0.862825811f, 0.0268205777f},
-std::array<float,2>{0.752143979f, 0.741133034f},
-std::array<float,2>{0.187663302f, 0.39046979f},
-std::array<float,2>{0.487750292f, 0.913345814f},
-std::array<float,2>{0.655405402f, 0.141646639f},
-std::array<float,2>{0.535582066f, 0.873488784f},
-std::array<float,2>{0.330230623f, 0.0647078976f},
-std::array<float,2>{0.0521744341f, 0.510569453f},
-std::array<float,2>{0.932287931f, 0.293937176f},
-std::array<float,2>{0.908373296f, 0.836573303f},
-std::array<float,2>{0.0457394905f, 0.112708174f},
-std::array<float,2>{0.316818357f, 0.561324596f},
-std::array<float,2>{0.549914598f, 0.275820792f},
-std::array<float,2>{0.63376236f, 0.711440265f},
-std::array<float,2>{0.476515681f, 0.418272465f},
-std::array<float,2>{0.216707766f, 0.879285872f},
-std::array<float,2>{0.77187413f, 0.186761424f},
-std::array<float,2>{0.855201662f, 0.575087428f},
-std::array<float,2>{0.163125768f, 0.336273968f},
-std::array<float,2>{0.405940264f, 0.769015014f},
-std::array<float,2>{0.722400486f, 0.0577518046f},
-std::array<float,2>{0.602644622f, 0.961956441f},
-std::array<float,2>{0.286196738f, 0.229349896f},
-std::array<float,2>{0.068202354f, 0.669075668f},
-std::array<float,2>{0.991196811f, 0.478158385f},
-std::array<float,2>{0.808020651f, 0.930948257f},
-std::array<float,2>{0.240339115f, 0.135901242f},
-std::array<float,2>{0.464680761f, 0.727934837f},
-std::array<float,2>{0.664790571f, 0.400161535f},
-std::array<float,2>{0.512252748f, 0.523634017f},
-std::array<float,2>{0.37351197f, 0.298909038f},
-std::array<float,2>{0.0230429117f, 0.857568204f},
-std::array<float,2>{0.877733171f, 0.0903660506f},
-std::array<float,2>{0.93858403f, 0.625030339f},
-std::array<float,2>{0.122624777f, 0.4447276f},
-std::array<float,2>{0.273250252f, 0.986225069f},
-std::array<float,2>{0.573446393f, 0.192376107f},
-std::array<float,2>{0.711515725f, 0.783358276f},
-std::array<float,2>{0.421521068f, 0.000324733526f},
-std::array<float,2>{0.137811795f, 0.62059468f},
-std::array<float,2>{0.825317681f, 0.367828846f},
-std::array<float,2>{0.843922436f, 0.814653039f},
-std::array<float,2>{0.165833533f, 0.101393908f},
-std::array<float,2>{0.393069714f, 0.541150272f},
-std::array<float,2>{0.733583808f, 0.255867749f},
-std::array<float,2>{0.59925437f, 0.687619507f},
-std::array<float,2>{0.291113675f, 0.437017322f},
-std::array<float,2>{0.0738185495f, 0.896662116f},
-std::array<float,2>{0.997287571f, 0.16973348f},
-std::array<float,2>{0.917684734f, 0.590253234f},
-std::array<float,2>{0.0339484513f, 0.325731426f},
-std::array<float,2>{0.324648976f, 0.765378535f},
-std::array<float,2>{0.55849731f, 0.0440057702f},
-std::array<float,2>{0.628999174f, 0.945454061f},
-std::array<float,2>{0.476887643f, 0.247836068f},
-std::array<float,2>{0.204566941f, 0.684256256f},
-std::array<float,2>{0.775664687f, 0.487414569f},
-std::array<float,2>{0.950405896f, 0.908894658f},
-std::array<float,2>{0.111366563f, 0.147430345f},
-std::array<float,2>{0.276935935f, 0.735507011f},
-std::array<float,2>{0.565324306f, 0.38323608f},
-std::array<float,2>{0.708657265f, 0.513870835f},
-std::array<float,2>{0.411170393f, 0.291519046f},
-std::array<float,2>{0.130416036f, 0.869892776f},
-std::array<float,2>{0.812967122f, 0.0692037642f},
-std::array<float,2>{0.802469313f, 0.651586413f},
-std::array<float,2>{0.243954167f, 0.454342633f},
-std::array<float,2>{0.455723673f, 0.973943472f},
-std::array<float,2>{0.656725049f, 0.218050465f},
-std::array<float,2>{0.506048501f, 0.804123759f},
-std::array<float,2>{0.364261717f, 0.0278741363f},
-std::array<float,2>{0.0303155091f, 0.596481204f},
-std::array<float,2>{0.885969579f, 0.345561862f},
-std::array<float,2>{0.893987298f, 0.771259785f},
-std::array<float,2>{0.00740639074f, 0.0612010434f},
-std::array<float,2>{0.351780683f, 0.570758462f},
-std::array<float,2>{0.519327641f, 0.343228281f},
-std::array<float,2>{0.687029541f, 0.666759491f},
-std::array<float,2>{0.445493609f, 0.482013643f},
-std::array<float,2>{0.223403633f, 0.968601644f},
-std::array<float,2>{0.786543667f, 0.232506484f},
-std::array<float,2>{0.836401045f, 0.557425141f},
-std::array<float,2>{0.141848087f, 0.28104949f},
-std::array<float,2>{0.435427278f, 0.84211576f},
-std::array<float,2>{0.701694012f, 0.114716485f},
-std::array<float,2>{0.581406713f, 0.877329171f},
-std::array<float,2>{0.25933668f, 0.179760382f},
-std::array<float,2>{0.104762375f, 0.718140066f},
-std::array<float,2>{0.954898179f, 0.4164083f},
-std::array<float,2>{0.765118659f, 0.991350889f},
-std::array<float,2>{0.196401343f, 0.188004479f},
-std::array<float,2>{0.495158792f, 0.6293571f},
-std::array<float,2>{0.646305025f, 0.437568963f},
-std::array<float,2>{0.539896786f, 0.621553779f},
-std::array<float,2>{0.338990301f, 0.371314615f},
-std::array<float,2>{0.0589154065f, 0.78705889f},
-std::array<float,2>{0.926488161f, 0.00718591735f},
-std::array<float,2>{0.981428981f, 0.730584502f},
-std::array<float,2>{0.0907449126f, 0.405207992f},
-std::array<float,2>{0.305707157f, 0.935890138f},
-std::array<float,2>{0.619007111f, 0.139895841f},
-std::array<float,2>{0.739385009f, 0.854268312f},
-std::array<float,2>{0.386696815f, 0.0859967768f},
-std::array<float,2>{0.173362762f, 0.527517974f},
-std::array<float,2>{0.874125302f, 0.300787717f},
-std::array<float,2>{0.793582857f, 0.791039765f},
-std::array<float,2>{0.233770669f, 0.0148459682f},
-std::array<float,2>{0.445279568f, 0.610695362f},
-std::array<float,2>{0.678400218f, 0.36289233f},
-std::array<float,2>{0.530348837f, 0.636313856f},
-std::array<float,2>{0.349146932f, 0.446941465f},
-std::array<float,2>{0.0153500568f, 0.992507279f},
-std::array<float,2>{0.900059998f, 0.195341647f},
-std::array<float,2>{0.963876188f, 0.515970767f},
-std::array<float,2>{0.0977957472f, 0.305509388f},
-std::array<float,2>{0.251567811f, 0.851095617f},
-std::array<float,2>{0.59244591f, 0.079806f},
-std::array<float,2>{0.694292486f, 0.924967229f},
-std::array<float,2>{0.426724643f, 0.128467113f},
-std::array<float,2>{0.156105295f, 0.725223899f},
-std::array<float,2>{0.831675768f, 0.395636708f},
-std::array<float,2>{0.936782062f, 0.957673609f},
-std::array<float,2>{0.0473109297f, 0.220838845f},
-std::array<float,2>{0.335194618f, 0.66290319f},
-std::array<float,2>{0.531280339f, 0.473448992f},
-std::array<float,2>{0.65077275f, 0.569542825f},
-std::array<float,2>{0.489315599f, 0.333732188f},
-std::array<float,2>{0.193981156f, 0.779360533f},
-std::array<float,2>{0.756214201f, 0.0527255535f},
-std::array<float,2>{0.864863634f, 0.706226826f},
-std::array<float,2>{0.183903247f, 0.40729633f},
-std::array<float,2>{0.379546732f, 0.886209488f},
-std::array<float,2>{0.745035827f, 0.179145873f},
-std::array<float,2>{0.616173208f, 0.828909636f},
-std::array<float,2>{0.304586858f, 0.122211993f},
-std::array<float,2>{0.0846511126f, 0.553048134f},
-std::array<float,2>{0.972397029f, 0.2688483f},
-std::array<float,2>{0.987990677f, 0.861590624f},
-std::array<float,2>{0.0632433295f, 0.0748049766f},
-std::array<float,2>{0.283316553f, 0.504539549f},
-std::array<float,2>{0.607000589f, 0.288133621f},
-std::array<float,2>{0.726454079f, 0.745700538f},
-std::array<float,2>{0.402228773f, 0.379218549f},
-std::array<float,2>{0.158387393f, 0.919718862f},
-std::array<float,2>{0.855693102f, 0.154224575f},
-std::array<float,2>{0.765859604f, 0.602708459f},
-std::array<float,2>{0.212658599f, 0.35920617f},
-std::array<float,2>{0.471143931f, 0.809685349f},
-std::array<float,2>{0.640020728f, 0.0177390315f},
-std::array<float,2>{0.553436399f, 0.982732832f},
-std::array<float,2>{0.314938784f, 0.209702343f},
-std::array<float,2>{0.0394382626f, 0.643538535f},
-std::array<float,2>{0.9127599f, 0.461723238f},
-std::array<float,2>{0.822448313f, 0.899700046f},
-std::array<float,2>{0.136705354f, 0.160808071f},
-std::array<float,2>{0.415622771f, 0.696535766f},
-std::array<float,2>{0.716746271f, 0.426219016f},
-std::array<float,2>{0.575181723f, 0.531331062f},
-std::array<float,2>{0.267832547f, 0.261337817f},
-std::array<float,2>{0.120900601f, 0.823791385f},
-std::array<float,2>{0.941476822f, 0.109081812f},
-std::array<float,2>{0.87967068f, 0.678469419f},
-std::array<float,2>{0.0167230684f, 0.495124549f},
-std::array<float,2>{0.370383054f, 0.942883015f},
-std::array<float,2>{0.508786261f, 0.236165076f},
-std::array<float,2>{0.669069588f, 0.753699064f},
-std::array<float,2>{0.465003312f, 0.0328739993f},
-std::array<float,2>{0.234405562f, 0.584100544f},
-std::array<float,2>{0.809086859f, 0.31862098f},
-std::array<float,2>{0.797133982f, 0.834604323f},
-std::array<float,2>{0.24808453f, 0.120706052f},
-std::array<float,2>{0.457605273f, 0.549037755f},
-std::array<float,2>{0.663944602f, 0.269642413f},
-std::array<float,2>{0.500332236f, 0.707453907f},
-std::array<float,2>{0.360468417f, 0.413685352f},
-std::array<float,2>{0.0259681828f, 0.888031185f},
-std::array<float,2>{0.887600183f, 0.174810514f},
-std::array<float,2>{0.946336806f, 0.562980831f},
-std::array<float,2>{0.113654561f, 0.328707933f},
-std::array<float,2>{0.280854493f, 0.775610387f},
-std::array<float,2>{0.567082584f, 0.0476722792f},
-std::array<float,2>{0.705735385f, 0.955347002f},
-std::array<float,2>{0.408301651f, 0.225335121f},
-std::array<float,2>{0.127182916f, 0.65878123f},
-std::array<float,2>{0.817143798f, 0.470829248f},
-std::array<float,2>{0.92059052f, 0.926563501f},
-std::array<float,2>{0.0378404856f, 0.130250588f},
-std::array<float,2>{0.322530895f, 0.720358014f},
-std::array<float,2>{0.561051011f, 0.392723233f},
-std::array<float,2>{0.627378285f, 0.521723211f},
-std::array<float,2>{0.480704337f, 0.312416583f},
-std::array<float,2>{0.208988234f, 0.846262455f},
-std::array<float,2>{0.779299676f, 0.085626021f},
-std::array<float,2>{0.847995818f, 0.63696593f},
-std::array<float,2>{0.168848753f, 0.452879906f},
-std::array<float,2>{0.397352964f, 0.997192323f},
-std::array<float,2>{0.729817331f, 0.199959576f},
-std::array<float,2>{0.595526516f, 0.795594215f},
-std::array<float,2>{0.293155462f, 0.00836293679f},
-std::array<float,2>{0.0751601309f, 0.614688635f},
-std::array<float,2>{0.995806515f, 0.364426047f},
-std::array<float,2>{0.977421582f, 0.757408857f},
-std::array<float,2>{0.0872259215f, 0.0388812907f},
-std::array<float,2>{0.311397761f, 0.579384685f},
-std::array<float,2>{0.623726428f, 0.314520657f},
-std::array<float,2>{0.737219751f, 0.675029039f},
-std::array<float,2>{0.390541881f, 0.499623001f},
-std::array<float,2>{0.176142976f, 0.93961066f},
-std::array<float,2>{0.869294405f, 0.238826782f},
-std::array<float,2>{0.760925829f, 0.536147654f},
-std::array<float,2>{0.201441228f, 0.261876673f},
-std::array<float,2>{0.499081314f, 0.827555656f},
-std::array<float,2>{0.643580437f, 0.103053637f},
-std::array<float,2>{0.544522941f, 0.903768361f},
-std::array<float,2>{0.340217561f, 0.157387987f},
-std::array<float,2>{0.0580522008f, 0.700378895f},
-std::array<float,2>{0.922386467f, 0.424093544f},
-std::array<float,2>{0.843170285f, 0.977812111f},
-std::array<float,2>{0.145653218f, 0.20562242f},
-std::array<float,2>{0.432939053f, 0.64587611f},
-std::array<float,2>{0.697167516f, 0.468387336f},
-std::array<float,2>{0.584604561f, 0.608676434f},
-std::array<float,2>{0.263959318f, 0.35266611f},
-std::array<float,2>{0.108653538f, 0.807061672f},
-std::array<float,2>{0.959887743f, 0.0225607287f},
-std::array<float,2>{0.896941125f, 0.746634722f},
-std::array<float,2>{0.00238918629f, 0.375606686f},
-std::array<float,2>{0.356686085f, 0.914665222f},
-std::array<float,2>{0.521323979f, 0.149530858f},
-std::array<float,2>{0.680855751f, 0.864417017f},
-std::array<float,2>{0.449500412f, 0.0705329031f},
-std::array<float,2>{0.221588746f, 0.502310991f},
-std::array<float,2>{0.782011032f, 0.283334732f},
-std::array<float,2>{0.861118972f, 0.798214793f},
-std::array<float,2>{0.182286307f, 0.0234796796f},
-std::array<float,2>{0.375551283f, 0.597675085f},
-std::array<float,2>{0.747899413f, 0.347807199f},
-std::array<float,2>{0.610465586f, 0.655377448f},
-std::array<float,2>{0.299451798f, 0.459517837f},
-std::array<float,2>{0.080322966f, 0.97192806f},
-std::array<float,2>{0.974295795f, 0.21458897f},
-std::array<float,2>{0.929793298f, 0.508480191f},
-std::array<float,2>{0.0534383357f, 0.296868175f},
-std::array<float,2>{0.328220814f, 0.872068763f},
-std::array<float,2>{0.538589358f, 0.0637145191f},
-std::array<float,2>{0.653445601f, 0.911232531f},
-std::array<float,2>{0.485177338f, 0.143925726f},
-std::array<float,2>{0.18989113f, 0.740122795f},
-std::array<float,2>{0.750304103f, 0.387397051f},
-std::array<float,2>{0.965625465f, 0.952028573f},
-std::array<float,2>{0.0942722932f, 0.244856611f},
-std::array<float,2>{0.257087111f, 0.682127237f},
-std::array<float,2>{0.589761496f, 0.489972979f},
-std::array<float,2>{0.690735579f, 0.587575614f},
-std::array<float,2>{0.423035979f, 0.320464462f},
-std::array<float,2>{0.151987612f, 0.759362102f},
-std::array<float,2>{0.834766507f, 0.0418364294f},
-std::array<float,2>{0.792072058f, 0.693762422f},
-std::array<float,2>{0.226741076f, 0.430336922f},
-std::array<float,2>{0.438433647f, 0.890858114f},
-std::array<float,2>{0.674897254f, 0.166415542f},
-std::array<float,2>{0.526242614f, 0.816887379f},
-std::array<float,2>{0.346610963f, 0.0967461616f},
-std::array<float,2>{0.00847937912f, 0.546167672f},
-std::array<float,2>{0.903932512f, 0.253566593f},
-std::array<float,2>{0.875129044f, 0.857033253f},
-std::array<float,2>{0.0205469932f, 0.0932933614f},
-std::array<float,2>{0.372683913f, 0.526316881f},
-std::array<float,2>{0.514733136f, 0.29791379f},
-std::array<float,2>{0.667399168f, 0.728543401f},
-std::array<float,2>{0.462658256f, 0.400762588f},
-std::array<float,2>{0.238838941f, 0.933390975f},
-std::array<float,2>{0.806485057f, 0.133909896f},
-std::array<float,2>{0.82756108f, 0.618313909f},
-std::array<float,2>{0.138726816f, 0.370982766f},
-std::array<float,2>{0.419146627f, 0.782877266f},
-std::array<float,2>{0.714438796f, 0.00331391627f},
-std::array<float,2>{0.570616961f, 0.9865731f},
-std::array<float,2>{0.269577146f, 0.194427356f},
-std::array<float,2>{0.124612652f, 0.627502441f},
-std::array<float,2>{0.939467847f, 0.441720128f},
-std::array<float,2>{0.769682825f, 0.882273793f},
-std::array<float,2>{0.217077613f, 0.18413426f},
-std::array<float,2>{0.474030405f, 0.713542879f},
-std::array<float,2>{0.635145426f, 0.421333641f},
-std::array<float,2>{0.54846555f, 0.559186757f},
-std::array<float,2>{0.318404913f, 0.27462399f},
-std::array<float,2>{0.043028079f, 0.838062286f},
-std::array<float,2>{0.907316864f, 0.109538727f},
-std::array<float,2>{0.988758266f, 0.670238256f},
-std::array<float,2>{0.0697046667f, 0.478613049f},
-std::array<float,2>{0.287223309f, 0.963173151f},
-std::array<float,2>{0.605051816f, 0.227502286f},
-std::array<float,2>{0.720621228f, 0.766749859f},
-std::array<float,2>{0.403705418f, 0.0557304807f},
-std::array<float,2>{0.160678342f, 0.576346636f},
-std::array<float,2>{0.852559865f, 0.339675307f},
-std::array<float,2>{0.815193534f, 0.868287742f},
-std::array<float,2>{0.131812602f, 0.0683220476f},
-std::array<float,2>{0.412366301f, 0.512066722f},
-std::array<float,2>{0.710643411f, 0.289961457f},
-std::array<float,2>{0.562690914f, 0.737203002f},
-std::array<float,2>{0.274013877f, 0.385585994f},
-std::array<float,2>{0.109431326f, 0.906880736f},
-std::array<float,2>{0.951679051f, 0.145162001f},
-std::array<float,2>{0.883253753f, 0.593941629f},
-std::array<float,2>{0.0280566514f, 0.345955461f},
-std::array<float,2>{0.366374552f, 0.802067459f},
-std::array<float,2>{0.505718648f, 0.0293067135f},
-std::array<float,2>{0.659009337f, 0.975229442f},
-std::array<float,2>{0.455056876f, 0.215711176f},
-std::array<float,2>{0.24536562f, 0.650062799f},
-std::array<float,2>{0.803034425f, 0.455706388f},
-std::array<float,2>{0.99982363f, 0.895562649f},
-std::array<float,2>{0.0707176998f, 0.171136379f},
-std::array<float,2>{0.290622026f, 0.690093398f},
-std::array<float,2>{0.600587308f, 0.435366184f},
-std::array<float,2>{0.730775237f, 0.540967107f},
-std::array<float,2>{0.391899347f, 0.255360723f},
-std::array<float,2>{0.166593492f, 0.813266754f},
-std::array<float,2>{0.845887542f, 0.0985519513f},
-std::array<float,2>{0.773652077f, 0.686687887f},
-std::array<float,2>{0.205568939f, 0.485093057f},
-std::array<float,2>{0.478938192f, 0.947899282f},
-std::array<float,2>{0.63116926f, 0.248913318f},
-std::array<float,2>{0.554802358f, 0.762113273f},
-std::array<float,2>{0.327894896f, 0.0466539972f},
-std::array<float,2>{0.0325780995f, 0.59208864f},
-std::array<float,2>{0.915713489f, 0.327423543f},
-std::array<float,2>{0.929005504f, 0.788806736f},
-std::array<float,2>{0.061861448f, 0.00483532017f},
-std::array<float,2>{0.336582452f, 0.623489618f},
-std::array<float,2>{0.542054236f, 0.374579072f},
-std::array<float,2>{0.646864593f, 0.631079733f},
-std::array<float,2>{0.493334591f, 0.440972984f},
-std::array<float,2>{0.19806844f, 0.988658965f},
-std::array<float,2>{0.763242602f, 0.191068426f},
-std::array<float,2>{0.871585131f, 0.530964494f},
-std::array<float,2>{0.17495954f, 0.303806126f},
-std::array<float,2>{0.384689003f, 0.853378892f},
-std::array<float,2>{0.740915358f, 0.087977089f},
-std::array<float,2>{0.619929016f, 0.934051156f},
-std::array<float,2>{0.307000428f, 0.137272492f},
-std::array<float,2>{0.0926642939f, 0.73293829f},
-std::array<float,2>{0.983478308f, 0.402695775f},
-std::array<float,2>{0.787620783f, 0.966361284f},
-std::array<float,2>{0.226187199f, 0.231285051f},
-std::array<float,2>{0.447589308f, 0.665730476f},
-std::array<float,2>{0.685459971f, 0.482878774f},
-std::array<float,2>{0.516558051f, 0.572386801f},
-std::array<float,2>{0.354579419f, 0.33985287f},
-std::array<float,2>{0.00434094574f, 0.77267611f},
-std::array<float,2>{0.892341793f, 0.0603668652f},
-std::array<float,2>{0.955509067f, 0.715625286f},
-std::array<float,2>{0.103445306f, 0.4152987f},
-std::array<float,2>{0.259781837f, 0.876419008f},
-std::array<float,2>{0.578721941f, 0.183362484f},
-std::array<float,2>{0.700986266f, 0.84108007f},
-std::array<float,2>{0.435941279f, 0.116667293f},
-std::array<float,2>{0.14393498f, 0.555090427f},
-std::array<float,2>{0.838934004f, 0.278536916f},
-std::array<float,2>{0.754103124f, 0.778445125f},
-std::array<float,2>{0.193193927f, 0.0534764081f},
-std::array<float,2>{0.491186768f, 0.566854358f},
-std::array<float,2>{0.648976386f, 0.33545965f},
-std::array<float,2>{0.534015775f, 0.660480797f},
-std::array<float,2>{0.332206368f, 0.476114273f},
-std::array<float,2>{0.0492137931f, 0.960564733f},
-std::array<float,2>{0.935191751f, 0.220527247f},
-std::array<float,2>{0.969476342f, 0.551142752f},
-std::array<float,2>{0.0830162168f, 0.265866905f},
-std::array<float,2>{0.301050335f, 0.830958605f},
-std::array<float,2>{0.614943445f, 0.124740787f},
-std::array<float,2>{0.742851973f, 0.882892549f},
-std::array<float,2>{0.381414264f, 0.177197903f},
-std::array<float,2>{0.18632935f, 0.703896999f},
-std::array<float,2>{0.865714192f, 0.410005242f},
-std::array<float,2>{0.900490701f, 0.995419145f},
-std::array<float,2>{0.0121388789f, 0.198325098f},
-std::array<float,2>{0.350713342f, 0.633423328f},
-std::array<float,2>{0.528802335f, 0.447998255f},
-std::array<float,2>{0.677531302f, 0.611374259f},
-std::array<float,2>{0.442330658f, 0.360778689f},
-std::array<float,2>{0.232409731f, 0.789462745f},
-std::array<float,2>{0.795192361f, 0.0129109686f},
-std::array<float,2>{0.828967512f, 0.722966194f},
-std::array<float,2>{0.152381733f, 0.397916913f},
-std::array<float,2>{0.42849654f, 0.922232091f},
-std::array<float,2>{0.69311893f, 0.126303717f},
-std::array<float,2>{0.590061426f, 0.849507332f},
-std::array<float,2>{0.252451241f, 0.0815270171f},
-std::array<float,2>{0.10002137f, 0.519193351f},
-std::array<float,2>{0.961694598f, 0.307008326f},
-std::array<float,2>{0.944818199f, 0.82075721f},
-std::array<float,2>{0.118952595f, 0.106396757f},
-std::array<float,2>{0.267389894f, 0.534799993f},
-std::array<float,2>{0.577957809f, 0.259129941f},
-std::array<float,2>{0.717604041f, 0.698353171f},
-std::array<float,2>{0.41734305f, 0.428920269f},
-std::array<float,2>{0.133261889f, 0.901351094f},
-std::array<float,2>{0.820889652f, 0.163771763f},
-std::array<float,2>{0.812086105f, 0.58298862f},
-std::array<float,2>{0.23795265f, 0.316616386f},
-std::array<float,2>{0.466946542f, 0.751744449f},
-std::array<float,2>{0.671384394f, 0.0349706151f},
-std::array<float,2>{0.511502922f, 0.94365257f},
-std::array<float,2>{0.368923604f, 0.236770883f},
-std::array<float,2>{0.0180949364f, 0.675832093f},
-std::array<float,2>{0.882562816f, 0.492365539f},
-std::array<float,2>{0.858932912f, 0.920552611f},
-std::array<float,2>{0.158085972f, 0.155544132f},
-std::array<float,2>{0.39904663f, 0.743559003f},
-std::array<float,2>{0.723879874f, 0.38124761f},
-std::array<float,2>{0.609211326f, 0.507734597f},
-std::array<float,2>{0.282281727f, 0.28564477f},
-std::array<float,2>{0.0656672344f, 0.861113667f},
-std::array<float,2>{0.986159682f, 0.0763129443f},
-std::array<float,2>{0.910931349f, 0.642536521f},
-std::array<float,2>{0.0415661335f, 0.463982999f},
-std::array<float,2>{0.313673019f, 0.981693804f},
-std::array<float,2>{0.551466227f, 0.207748547f},
-std::array<float,2>{0.637183666f, 0.811867893f},
-std::array<float,2>{0.469471514f, 0.016953459f},
-std::array<float,2>{0.214007631f, 0.605166495f},
-std::array<float,2>{0.768774211f, 0.356225252f},
-std::array<float,2>{0.759201825f, 0.826943636f},
-std::array<float,2>{0.200655207f, 0.10248448f},
-std::array<float,2>{0.496177614f, 0.53594619f},
-std::array<float,2>{0.641085684f, 0.262744278f},
-std::array<float,2>{0.545663714f, 0.699993134f},
-std::array<float,2>{0.342391998f, 0.425601453f},
-std::array<float,2>{0.0548231564f, 0.902839005f},
-std::array<float,2>{0.925558031f, 0.157009512f},
-std::array<float,2>{0.980349123f, 0.578342021f},
-std::array<float,2>{0.0896680206f, 0.315504819f},
-std::array<float,2>{0.309957415f, 0.756098092f},
-std::array<float,2>{0.62217176f, 0.0376536213f},
-std::array<float,2>{0.734479845f, 0.941131115f},
-std::array<float,2>{0.387427837f, 0.239511758f},
-std::array<float,2>{0.17808795f, 0.674291968f},
-std::array<float,2>{0.86821121f, 0.498312265f},
-std::array<float,2>{0.895021975f, 0.915483475f},
-std::array<float,2>{0.001406556f, 0.149090022f},
-std::array<float,2>{0.359238803f, 0.747633636f},
-std::array<float,2>{0.521512091f, 0.376883328f},
-std::array<float,2>{0.68268007f, 0.503041089f},
-std::array<float,2>{0.451519489f, 0.284410417f},
-std::array<float,2>{0.220024556f, 0.86406225f},
-std::array<float,2>{0.783829749f, 0.0716096759f},
-std::array<float,2>{0.840474367f, 0.644586265f},
-std::array<float,2>{0.14733164f, 0.467153132f},
-std::array<float,2>{0.430794418f, 0.977061629f},
-std::array<float,2>{0.697841287f, 0.206318736f},
-std::array<float,2>{0.583729327f, 0.808576465f},
-std::array<float,2>{0.262322158f, 0.0220845379f},
-std::array<float,2>{0.106074966f, 0.607911229f},
-std::array<float,2>{0.958441257f, 0.352056593f},
-std::array<float,2>{0.948106647f, 0.777183831f},
-std::array<float,2>{0.116652392f, 0.047945641f},
-std::array<float,2>{0.278442323f, 0.564010978f},
-std::array<float,2>{0.569715083f, 0.329739869f},
-std::array<float,2>{0.70488739f, 0.660054386f},
-std::array<float,2>{0.406334907f, 0.472067595f},
-std::array<float,2>{0.126461595f, 0.956303775f},
-std::array<float,2>{0.818749905f, 0.226561457f},
-std::array<float,2>{0.799778759f, 0.55049926f},
-std::array<float,2>{0.24708727f, 0.270564556f},
-std::array<float,2>{0.459423274f, 0.835327268f},
-std::array<float,2>{0.660418391f, 0.119660571f},
-std::array<float,2>{0.50357765f, 0.886812985f},
-std::array<float,2>{0.363191873f, 0.174795657f},
-std::array<float,2>{0.0246411245f, 0.708479345f},
-std::array<float,2>{0.890117049f, 0.412808716f},
-std::array<float,2>{0.851062298f, 0.997021973f},
-std::array<float,2>{0.171327338f, 0.200607926f},
-std::array<float,2>{0.395246238f, 0.638313413f},
-std::array<float,2>{0.727728307f, 0.451951712f},
-std::array<float,2>{0.597587407f, 0.614206016f},
-std::array<float,2>{0.296569467f, 0.363759875f},
-std::array<float,2>{0.0764040872f, 0.795945108f},
-std::array<float,2>{0.993908346f, 0.00937255099f},
-std::array<float,2>{0.918749213f, 0.718981147f},
-std::array<float,2>{0.0368556716f, 0.39420408f},
-std::array<float,2>{0.320646554f, 0.927601159f},
-std::array<float,2>{0.559786439f, 0.129698157f},
-std::array<float,2>{0.626006603f, 0.846948564f},
-std::array<float,2>{0.4829171f, 0.0849115103f},
-std::array<float,2>{0.207814261f, 0.522523344f},
-std::array<float,2>{0.777390718f, 0.311037391f},
-std::array<float,2>{0.824468315f, 0.782171786f},
-std::array<float,2>{0.137275875f, 0.00277209771f},
-std::array<float,2>{0.420722693f, 0.617622137f},
-std::array<float,2>{0.712080657f, 0.369363606f},
-std::array<float,2>{0.572735786f, 0.628034294f},
-std::array<float,2>{0.271674156f, 0.442448884f},
-std::array<float,2>{0.121673167f, 0.988097131f},
-std::array<float,2>{0.937870264f, 0.194133133f},
-std::array<float,2>{0.878035545f, 0.527104616f},
-std::array<float,2>{0.0219208635f, 0.297553211f},
-std::array<float,2>{0.374166667f, 0.85571903f},
-std::array<float,2>{0.512703598f, 0.0926691368f},
-std::array<float,2>{0.665714383f, 0.932398558f},
-std::array<float,2>{0.463034987f, 0.13329716f},
-std::array<float,2>{0.241650417f, 0.729732096f},
-std::array<float,2>{0.806747735f, 0.401446313f},
-std::array<float,2>{0.991473019f, 0.964682519f},
-std::array<float,2>{0.0665330738f, 0.227746859f},
-std::array<float,2>{0.285193354f, 0.67170316f},
-std::array<float,2>{0.601775885f, 0.47990039f},
-std::array<float,2>{0.721062779f, 0.577660859f},
-std::array<float,2>{0.404535949f, 0.338527471f},
-std::array<float,2>{0.162537605f, 0.765681565f},
-std::array<float,2>{0.853767991f, 0.0548273027f},
-std::array<float,2>{0.773278058f, 0.714118421f},
-std::array<float,2>{0.215285972f, 0.42065534f},
-std::array<float,2>{0.475357115f, 0.880887628f},
-std::array<float,2>{0.634733558f, 0.185537472f},
-std::array<float,2>{0.549269497f, 0.839278758f},
-std::array<float,2>{0.317786962f, 0.111023575f},
-std::array<float,2>{0.0461576805f, 0.560191214f},
-std::array<float,2>{0.909575701f, 0.274200946f},
-std::array<float,2>{0.932630956f, 0.87263602f},
-std::array<float,2>{0.0511780381f, 0.0625636578f},
-std::array<float,2>{0.331107944f, 0.509234905f},
-std::array<float,2>{0.536975801f, 0.295120478f},
-std::array<float,2>{0.654990673f, 0.738529682f},
-std::array<float,2>{0.486490488f, 0.387773961f},
-std::array<float,2>{0.189253375f, 0.910348952f},
-std::array<float,2>{0.752970517f, 0.142794415f},
-std::array<float,2>{0.861866891f, 0.599538386f},
-std::array<float,2>{0.181273118f, 0.349319518f},
-std::array<float,2>{0.378767222f, 0.797795475f},
-std::array<float,2>{0.749153495f, 0.0247469936f},
-std::array<float,2>{0.611902714f, 0.971094131f},
-std::array<float,2>{0.298546493f, 0.21386154f},
-std::array<float,2>{0.0786474645f, 0.654809058f},
-std::array<float,2>{0.975147307f, 0.460585028f},
-std::array<float,2>{0.789292932f, 0.892473936f},
-std::array<float,2>{0.22926639f, 0.167764321f},
-std::array<float,2>{0.439633429f, 0.694942176f},
-std::array<float,2>{0.672097385f, 0.430719644f},
-std::array<float,2>{0.52473253f, 0.545852542f},
-std::array<float,2>{0.343811631f, 0.252404332f},
-std::array<float,2>{0.011174554f, 0.818286717f},
-std::array<float,2>{0.905467629f, 0.0962439105f},
-std::array<float,2>{0.968037307f, 0.682758093f},
-std::array<float,2>{0.0969615504f, 0.488539159f},
-std::array<float,2>{0.254264623f, 0.952555835f},
-std::array<float,2>{0.587370455f, 0.245984852f},
-std::array<float,2>{0.687910318f, 0.758451283f},
-std::array<float,2>{0.424972802f, 0.042150639f},
-std::array<float,2>{0.149630234f, 0.586571276f},
-std::array<float,2>{0.833628535f, 0.322120398f},
-std::array<float,2>{0.87364316f, 0.852392137f},
-std::array<float,2>{0.17277728f, 0.0891994312f},
-std::array<float,2>{0.385023028f, 0.529307902f},
-std::array<float,2>{0.739154518f, 0.303159714f},
-std::array<float,2>{0.61813575f, 0.73380059f},
-std::array<float,2>{0.305432618f, 0.404021055f},
-std::array<float,2>{0.0913051441f, 0.935282409f},
-std::array<float,2>{0.981857896f, 0.138411403f},
-std::array<float,2>{0.927529573f, 0.624887168f},
-std::array<float,2>{0.0602460243f, 0.373410672f},
-std::array<float,2>{0.338209778f, 0.787270546f},
-std::array<float,2>{0.540300131f, 0.0056360513f},
-std::array<float,2>{0.64512682f, 0.990081489f},
-std::array<float,2>{0.494197935f, 0.189477578f},
-std::array<float,2>{0.195652336f, 0.632687807f},
-std::array<float,2>{0.76435113f, 0.440079063f},
-std::array<float,2>{0.953372061f, 0.875054598f},
-std::array<float,2>{0.104344197f, 0.18229416f},
-std::array<float,2>{0.257856101f, 0.716436088f},
-std::array<float,2>{0.580853701f, 0.414500922f},
-std::array<float,2>{0.702541351f, 0.556085706f},
-std::array<float,2>{0.433816195f, 0.277788699f},
-std::array<float,2>{0.141011626f, 0.840465009f},
-std::array<float,2>{0.837481737f, 0.115664691f},
-std::array<float,2>{0.785390019f, 0.664221346f},
-std::array<float,2>{0.224027872f, 0.484003484f},
-std::array<float,2>{0.447080165f, 0.965649605f},
-std::array<float,2>{0.686110616f, 0.23152642f},
-std::array<float,2>{0.518477917f, 0.771925867f},
-std::array<float,2>{0.353024751f, 0.0591276363f},
-std::array<float,2>{0.00628642784f, 0.57334578f},
-std::array<float,2>{0.89288336f, 0.340857774f},
-std::array<float,2>{0.885041237f, 0.801512897f},
-std::array<float,2>{0.0295543987f, 0.0308324862f},
-std::array<float,2>{0.363481939f, 0.594847858f},
-std::array<float,2>{0.507214844f, 0.347326785f},
-std::array<float,2>{0.65786767f, 0.648460329f},
-std::array<float,2>{0.456159413f, 0.456086487f},
-std::array<float,2>{0.242512748f, 0.976320505f},
-std::array<float,2>{0.801555455f, 0.216248423f},
-std::array<float,2>{0.814443707f, 0.513600767f},
-std::array<float,2>{0.129128814f, 0.290728807f},
-std::array<float,2>{0.410923302f, 0.867266119f},
-std::array<float,2>{0.707912207f, 0.0670576617f},
-std::array<float,2>{0.565485239f, 0.907656729f},
-std::array<float,2>{0.27539745f, 0.145759717f},
-std::array<float,2>{0.11260736f, 0.737483919f},
-std::array<float,2>{0.950159073f, 0.38656801f},
-std::array<float,2>{0.776704371f, 0.948877752f},
-std::array<float,2>{0.203386813f, 0.249159649f},
-std::array<float,2>{0.477778226f, 0.685572088f},
-std::array<float,2>{0.630137622f, 0.48593387f},
-std::array<float,2>{0.556813061f, 0.59349525f},
-std::array<float,2>{0.325315088f, 0.326669037f},
-std::array<float,2>{0.0351330116f, 0.76315552f},
-std::array<float,2>{0.916316032f, 0.0451488271f},
-std::array<float,2>{0.996912837f, 0.691255927f},
-std::array<float,2>{0.0723259971f, 0.434509844f},
-std::array<float,2>{0.292686313f, 0.894809425f},
-std::array<float,2>{0.598615468f, 0.170429468f},
-std::array<float,2>{0.732547104f, 0.81370312f},
-std::array<float,2>{0.394061923f, 0.0993620679f},
-std::array<float,2>{0.164141059f, 0.539604843f},
-std::array<float,2>{0.845635653f, 0.25411877f},
-std::array<float,2>{0.810380816f, 0.750781417f},
-std::array<float,2>{0.235939682f, 0.0337085351f},
-std::array<float,2>{0.46587798f, 0.583488047f},
-std::array<float,2>{0.668834388f, 0.317774296f},
-std::array<float,2>{0.509612679f, 0.67694664f},
-std::array<float,2>{0.369553059f, 0.493594438f},
-std::array<float,2>{0.0163393263f, 0.944880903f},
-std::array<float,2>{0.880271137f, 0.237370268f},
-std::array<float,2>{0.943135619f, 0.533537507f},
-std::array<float,2>{0.119480878f, 0.257871568f},
-std::array<float,2>{0.268856555f, 0.821390331f},
-std::array<float,2>{0.575767279f, 0.107061975f},
-std::array<float,2>{0.714939356f, 0.902209699f},
-std::array<float,2>{0.414804697f, 0.16233848f},
-std::array<float,2>{0.135188907f, 0.698227823f},
-std::array<float,2>{0.823697865f, 0.42812565f},
-std::array<float,2>{0.914004385f, 0.981170774f},
-std::array<float,2>{0.0402425453f, 0.2088442f},
-std::array<float,2>{0.315642476f, 0.641590416f},
-std::array<float,2>{0.554629147f, 0.463407189f},
-std::array<float,2>{0.638761461f, 0.604017615f},
-std::array<float,2>{0.471794158f, 0.356640905f},
-std::array<float,2>{0.211495504f, 0.810823262f},
-std::array<float,2>{0.767027318f, 0.0165446848f},
-std::array<float,2>{0.856678128f, 0.742380202f},
-std::array<float,2>{0.159958407f, 0.382531792f},
-std::array<float,2>{0.401133001f, 0.921763182f},
-std::array<float,2>{0.72491008f, 0.154577956f},
-std::array<float,2>{0.605863154f, 0.860207021f},
-std::array<float,2>{0.284544885f, 0.0778765008f},
-std::array<float,2>{0.064388901f, 0.50614661f},
-std::array<float,2>{0.986955464f, 0.286738455f},
-std::array<float,2>{0.970845759f, 0.831687927f},
-std::array<float,2>{0.0859129801f, 0.123168282f},
-std::array<float,2>{0.30288443f, 0.551773131f},
-std::array<float,2>{0.616791785f, 0.267355472f},
-std::array<float,2>{0.745634913f, 0.704645872f},
-std::array<float,2>{0.380239248f, 0.409090906f},
-std::array<float,2>{0.185461625f, 0.884602249f},
-std::array<float,2>{0.863560915f, 0.176727235f},
-std::array<float,2>{0.757336378f, 0.568156004f},
-std::array<float,2>{0.19452475f, 0.334898502f},
-std::array<float,2>{0.48861438f, 0.777675927f},
-std::array<float,2>{0.652336657f, 0.0538150556f},
-std::array<float,2>{0.532719851f, 0.95938313f},
-std::array<float,2>{0.334894925f, 0.21918653f},
-std::array<float,2>{0.0485615954f, 0.662002385f},
-std::array<float,2>{0.935993075f, 0.474921316f},
-std::array<float,2>{0.83069253f, 0.923165858f},
-std::array<float,2>{0.155087322f, 0.125608623f},
-std::array<float,2>{0.427211016f, 0.724284351f},
-std::array<float,2>{0.694856822f, 0.396956086f},
-std::array<float,2>{0.593450248f, 0.517580986f},
-std::array<float,2>{0.250610054f, 0.307696819f},
-std::array<float,2>{0.0992164835f, 0.848360538f},
-std::array<float,2>{0.963654399f, 0.080243513f},
-std::array<float,2>{0.898444474f, 0.633829117f},
-std::array<float,2>{0.0143414782f, 0.448825181f},
-std::array<float,2>{0.347892106f, 0.994576693f},
-std::array<float,2>{0.529511213f, 0.197758958f},
-std::array<float,2>{0.679427385f, 0.790815651f},
-std::array<float,2>{0.44336611f, 0.0124695161f},
-std::array<float,2>{0.232428759f, 0.612918377f},
-std::array<float,2>{0.794351935f, 0.360320002f},
-std::array<float,2>{0.782595456f, 0.866948605f},
-std::array<float,2>{0.221708789f, 0.0724621713f},
-std::array<float,2>{0.450485229f, 0.501437902f},
-std::array<float,2>{0.680148423f, 0.281795412f},
-std::array<float,2>{0.519580543f, 0.748472512f},
-std::array<float,2>{0.355491638f, 0.378828079f},
-std::array<float,2>{0.00371916755f, 0.916715026f},
-std::array<float,2>{0.898076773f, 0.151224986f},
-std::array<float,2>{0.960113227f, 0.60549438f},
-std::array<float,2>{0.108346775f, 0.354358852f},
-std::array<float,2>{0.265516371f, 0.805684149f},
-std::array<float,2>{0.584969461f, 0.0197891202f},
-std::array<float,2>{0.696204424f, 0.97928226f},
-std::array<float,2>{0.432494402f, 0.204029024f},
-std::array<float,2>{0.144765571f, 0.646857321f},
-std::array<float,2>{0.84271878f, 0.465194941f},
-std::array<float,2>{0.923100889f, 0.906172633f},
-std::array<float,2>{0.0575033911f, 0.158984542f},
-std::array<float,2>{0.341748506f, 0.702120602f},
-std::array<float,2>{0.54303503f, 0.423282236f},
-std::array<float,2>{0.643419623f, 0.537452459f},
-std::array<float,2>{0.498670161f, 0.26427567f},
-std::array<float,2>{0.202155218f, 0.824726343f},
-std::array<float,2>{0.760038912f, 0.104224972f},
-std::array<float,2>{0.870727301f, 0.673244476f},
-std::array<float,2>{0.177272409f, 0.49681747f},
-std::array<float,2>{0.389327556f, 0.938092113f},
-std::array<float,2>{0.737414956f, 0.241278917f},
-std::array<float,2>{0.624530137f, 0.755369961f},
-std::array<float,2>{0.312052786f, 0.0370759182f},
-std::array<float,2>{0.0862287059f, 0.580360711f},
-std::array<float,2>{0.978380799f, 0.313222617f},
-std::array<float,2>{0.994270265f, 0.794465661f},
-std::array<float,2>{0.0759696364f, 0.0100079216f},
-std::array<float,2>{0.294717491f, 0.615606427f},
-std::array<float,2>{0.594039142f, 0.36613518f},
-std::array<float,2>{0.728885531f, 0.63890022f},
-std::array<float,2>{0.397913754f, 0.449382037f},
-std::array<float,2>{0.169708386f, 0.999079823f},
-std::array<float,2>{0.849384904f, 0.202294037f},
-std::array<float,2>{0.780612409f, 0.52071631f},
-std::array<float,2>{0.210372671f, 0.310331792f},
-std::array<float,2>{0.481671572f, 0.844647706f},
-std::array<float,2>{0.628731966f, 0.0837429464f},
-std::array<float,2>{0.562479794f, 0.9295941f},
-std::array<float,2>{0.324106783f, 0.132592261f},
-std::array<float,2>{0.0382000543f, 0.722475111f},
-std::array<float,2>{0.921315074f, 0.392272472f},
-std::array<float,2>{0.818019569f, 0.953305542f},
-std::array<float,2>{0.128521502f, 0.224520475f},
-std::array<float,2>{0.409756362f, 0.656319022f},
-std::array<float,2>{0.706159234f, 0.469041079f},
-std::array<float,2>{0.567969263f, 0.565153241f},
-std::array<float,2>{0.279397458f, 0.330420166f},
-std::array<float,2>{0.115078323f, 0.773894787f},
-std::array<float,2>{0.945546925f, 0.0495239273f},
-std::array<float,2>{0.888017535f, 0.709927201f},
-std::array<float,2>{0.0268553495f, 0.411495566f},
-std::array<float,2>{0.360315949f, 0.889136016f},
-std::array<float,2>{0.501362145f, 0.172432855f},
-std::array<float,2>{0.662645578f, 0.833946526f},
-std::array<float,2>{0.458204687f, 0.117515899f},
-std::array<float,2>{0.249431923f, 0.547301173f},
-std::array<float,2>{0.798123181f, 0.27252087f},
-std::array<float,2>{0.852328897f, 0.768028855f},
-std::array<float,2>{0.162024617f, 0.0566595197f},
-std::array<float,2>{0.402421445f, 0.576058388f},
-std::array<float,2>{0.71936965f, 0.337352037f},
-std::array<float,2>{0.603926659f, 0.668551981f},
-std::array<float,2>{0.288916558f, 0.477421135f},
-std::array<float,2>{0.068625778f, 0.961761653f},
-std::array<float,2>{0.990231693f, 0.230453953f},
-std::array<float,2>{0.906473756f, 0.561540902f},
-std::array<float,2>{0.0448416732f, 0.27640745f},
-std::array<float,2>{0.319840163f, 0.836965144f},
-std::array<float,2>{0.547520339f, 0.112051629f},
-std::array<float,2>{0.636611521f, 0.880205154f},
-std::array<float,2>{0.472784609f, 0.185986996f},
-std::array<float,2>{0.217776552f, 0.711986065f},
-std::array<float,2>{0.77107954f, 0.419349164f},
-std::array<float,2>{0.940791667f, 0.984609127f},
-std::array<float,2>{0.123127937f, 0.193210274f},
-std::array<float,2>{0.270903081f, 0.626161218f},
-std::array<float,2>{0.571448147f, 0.444262415f},
-std::array<float,2>{0.713136017f, 0.619239569f},
-std::array<float,2>{0.418915957f, 0.36903578f},
-std::array<float,2>{0.140431225f, 0.784975052f},
-std::array<float,2>{0.826312304f, 0.0014977617f},
-std::array<float,2>{0.804731071f, 0.726811647f},
-std::array<float,2>{0.239577577f, 0.399219364f},
-std::array<float,2>{0.461010247f, 0.930006802f},
-std::array<float,2>{0.666253924f, 0.135187045f},
-std::array<float,2>{0.51424706f, 0.858894825f},
-std::array<float,2>{0.371208638f, 0.091594629f},
-std::array<float,2>{0.0202656742f, 0.525161624f},
-std::array<float,2>{0.876882851f, 0.300455183f},
-std::array<float,2>{0.903031409f, 0.818845272f},
-std::array<float,2>{0.00906629954f, 0.0945550352f},
-std::array<float,2>{0.346706241f, 0.543481529f},
-std::array<float,2>{0.527022839f, 0.251887053f},
-std::array<float,2>{0.674122393f, 0.692665219f},
-std::array<float,2>{0.439364195f, 0.432134688f},
-std::array<float,2>{0.228433996f, 0.893258989f},
-std::array<float,2>{0.791298091f, 0.165268525f},
-std::array<float,2>{0.835820615f, 0.589723647f},
-std::array<float,2>{0.150419489f, 0.323682815f},
-std::array<float,2>{0.422638595f, 0.760094881f},
-std::array<float,2>{0.689884245f, 0.0408097357f},
-std::array<float,2>{0.588703394f, 0.95110184f},
-std::array<float,2>{0.25617379f, 0.242663771f},
-std::array<float,2>{0.0954505876f, 0.680911243f},
-std::array<float,2>{0.965877712f, 0.491827101f},
-std::array<float,2>{0.751669347f, 0.912231863f},
-std::array<float,2>{0.190906823f, 0.140894353f},
-std::array<float,2>{0.485389471f, 0.741518974f},
-std::array<float,2>{0.653243423f, 0.389538676f},
-std::array<float,2>{0.537387729f, 0.511195481f},
-std::array<float,2>{0.329967827f, 0.294356883f},
-std::array<float,2>{0.0539269224f, 0.874379635f},
-std::array<float,2>{0.930871725f, 0.0660912246f},
-std::array<float,2>{0.973405898f, 0.653882384f},
-std::array<float,2>{0.0811097398f, 0.457992524f},
-std::array<float,2>{0.300751239f, 0.970295072f},
-std::array<float,2>{0.610095024f, 0.212580726f},
-std::array<float,2>{0.746412098f, 0.798850298f},
-std::array<float,2>{0.376560569f, 0.0259424429f},
-std::array<float,2>{0.18323651f, 0.600236773f},
-std::array<float,2>{0.860301495f, 0.350628197f},
-std::array<float,2>{0.838025331f, 0.843055069f},
-std::array<float,2>{0.142928764f, 0.113805294f},
-std::array<float,2>{0.437446266f, 0.55823946f},
-std::array<float,2>{0.700032949f, 0.279838502f},
-std::array<float,2>{0.579640269f, 0.71772033f},
-std::array<float,2>{0.260933906f, 0.417565942f},
-std::array<float,2>{0.101724006f, 0.878364503f},
-std::array<float,2>{0.956339777f, 0.181117237f},
-std::array<float,2>{0.891029775f, 0.571892083f},
-std::array<float,2>{0.00579037843f, 0.341842145f},
-std::array<float,2>{0.354239613f, 0.769542634f},
-std::array<float,2>{0.517167151f, 0.0618285388f},
-std::array<float,2>{0.68433392f, 0.967146218f},
-std::array<float,2>{0.448558748f, 0.234311938f},
-std::array<float,2>{0.225109994f, 0.667422414f},
-std::array<float,2>{0.789058447f, 0.481188416f},
-std::array<float,2>{0.983352542f, 0.936550438f},
-std::array<float,2>{0.093733035f, 0.138901755f},
-std::array<float,2>{0.307730794f, 0.732131898f},
-std::array<float,2>{0.620130837f, 0.405510902f},
-std::array<float,2>{0.741411924f, 0.528764546f},
-std::array<float,2>{0.383521557f, 0.301884323f},
-std::array<float,2>{0.174278244f, 0.85466677f},
-std::array<float,2>{0.872495234f, 0.0870273486f},
-std::array<float,2>{0.762185156f, 0.630669475f},
-std::array<float,2>{0.198811084f, 0.439028144f},
-std::array<float,2>{0.492361814f, 0.990590811f},
-std::array<float,2>{0.647543311f, 0.188597247f},
-std::array<float,2>{0.541962922f, 0.785217285f},
-std::array<float,2>{0.337675631f, 0.00662067067f},
-std::array<float,2>{0.0612054802f, 0.622925699f},
-std::array<float,2>{0.92804724f, 0.372649103f},
-std::array<float,2>{0.914134622f, 0.764558196f},
-std::array<float,2>{0.0314042196f, 0.043496158f},
-std::array<float,2>{0.326567054f, 0.591322362f},
-std::array<float,2>{0.556122541f, 0.324816614f},
-std::array<float,2>{0.632377684f, 0.684738457f},
-std::array<float,2>{0.480054259f, 0.486936122f},
-std::array<float,2>{0.206942052f, 0.946563542f},
-std::array<float,2>{0.775165975f, 0.24671866f},
-std::array<float,2>{0.847319245f, 0.542060733f},
-std::array<float,2>{0.1671049f, 0.25709042f},
-std::array<float,2>{0.391165644f, 0.815787077f},
-std::array<float,2>{0.731884122f, 0.100376867f},
-std::array<float,2>{0.600468278f, 0.897801638f},
-std::array<float,2>{0.289501995f, 0.168916494f},
-std::array<float,2>{0.0721344054f, 0.689136863f},
-std::array<float,2>{0.998148441f, 0.435905159f},
-std::array<float,2>{0.804493904f, 0.972690523f},
-std::array<float,2>{0.244145572f, 0.217145994f},
-std::array<float,2>{0.453502446f, 0.650972903f},
-std::array<float,2>{0.659791648f, 0.454005301f},
-std::array<float,2>{0.504861295f, 0.597350359f},
-std::array<float,2>{0.365438163f, 0.344076455f},
-std::array<float,2>{0.0290924143f, 0.803611994f},
-std::array<float,2>{0.884148717f, 0.0288149342f},
-std::array<float,2>{0.952253997f, 0.734978914f},
-std::array<float,2>{0.111279674f, 0.384275258f},
-std::array<float,2>{0.274720401f, 0.909605324f},
-std::array<float,2>{0.563671172f, 0.148422569f},
-std::array<float,2>{0.709826231f, 0.870330513f},
-std::array<float,2>{0.413727552f, 0.0697166994f},
-std::array<float,2>{0.132447228f, 0.515029013f},
-std::array<float,2>{0.815495074f, 0.292546421f},
-std::array<float,2>{0.767745852f, 0.808725119f},
-std::array<float,2>{0.212914169f, 0.0187222492f},
-std::array<float,2>{0.470326275f, 0.601694703f},
-std::array<float,2>{0.638572037f, 0.358331293f},
-std::array<float,2>{0.551801503f, 0.644325614f},
-std::array<float,2>{0.313384295f, 0.462036759f},
-std::array<float,2>{0.0428286232f, 0.983405888f},
-std::array<float,2>{0.911375225f, 0.210836038f},
-std::array<float,2>{0.985328496f, 0.5053038f},
-std::array<float,2>{0.0652632266f, 0.28803584f},
-std::array<float,2>{0.281955451f, 0.862605572f},
-std::array<float,2>{0.607486784f, 0.0757356361f},
-std::array<float,2>{0.722743928f, 0.918693602f},
-std::array<float,2>{0.399840951f, 0.153302893f},
-std::array<float,2>{0.156703502f, 0.744864106f},
-std::array<float,2>{0.857544065f, 0.380523622f},
-std::array<float,2>{0.881105542f, 0.941804647f},
-std::array<float,2>{0.0190330315f, 0.234493256f},
-std::array<float,2>{0.367415309f, 0.679315448f},
-std::array<float,2>{0.509803534f, 0.494793624f},
-std::array<float,2>{0.670491517f, 0.585854769f},
-std::array<float,2>{0.468284369f, 0.319428831f},
-std::array<float,2>{0.237110198f, 0.752253115f},
-std::array<float,2>{0.810618043f, 0.0318037458f},
-std::array<float,2>{0.821474612f, 0.695431411f},
-std::array<float,2>{0.134586096f, 0.427332342f},
-std::array<float,2>{0.416782469f, 0.899243057f},
-std::array<float,2>{0.717982054f, 0.161440104f},
-std::array<float,2>{0.576403856f, 0.822811723f},
-std::array<float,2>{0.266516656f, 0.107711889f},
-std::array<float,2>{0.117900722f, 0.533180118f},
-std::array<float,2>{0.943878591f, 0.260740161f},
-std::array<float,2>{0.962281227f, 0.849919796f},
-std::array<float,2>{0.10113924f, 0.0787911564f},
-std::array<float,2>{0.253472626f, 0.517112732f},
-std::array<float,2>{0.591488242f, 0.306238085f},
-std::array<float,2>{0.691433728f, 0.725808442f},
-std::array<float,2>{0.42929107f, 0.395368665f},
-std::array<float,2>{0.154107869f, 0.924213648f},
-std::array<float,2>{0.829901934f, 0.126984239f},
-std::array<float,2>{0.796807468f, 0.609812737f},
-std::array<float,2>{0.231158793f, 0.362277985f},
-std::array<float,2>{0.443308502f, 0.792866588f},
-std::array<float,2>{0.676359653f, 0.0139022311f},
-std::array<float,2>{0.527531028f, 0.99399966f},
-std::array<float,2>{0.349830061f, 0.1971367f},
-std::array<float,2>{0.0129015138f, 0.635600209f},
-std::array<float,2>{0.901391566f, 0.445552468f},
-std::array<float,2>{0.866250038f, 0.885478556f},
-std::array<float,2>{0.187074959f, 0.178178027f},
-std::array<float,2>{0.382471025f, 0.705974162f},
-std::array<float,2>{0.743166327f, 0.406390548f},
-std::array<float,2>{0.61381036f, 0.554443538f},
-std::array<float,2>{0.302304089f, 0.26762715f},
-std::array<float,2>{0.0825433135f, 0.829668164f},
-std::array<float,2>{0.970236182f, 0.121784791f},
-std::array<float,2>{0.933753431f, 0.663523912f},
-std::array<float,2>{0.0504318997f, 0.474021256f},
-std::array<float,2>{0.333848327f, 0.958444893f},
-std::array<float,2>{0.534868896f, 0.221874401f},
-std::array<float,2>{0.650158882f, 0.78075856f},
-std::array<float,2>{0.491925597f, 0.0517135747f},
-std::array<float,2>{0.191745669f, 0.568466604f},
-std::array<float,2>{0.755394042f, 0.332287043f},
-std::array<float,2>{0.753881514f, 0.874906242f},
-std::array<float,2>{0.188525558f, 0.0656641275f},
-std::array<float,2>{0.486860961f, 0.51127106f},
-std::array<float,2>{0.654544771f, 0.294716567f},
-std::array<float,2>{0.536512077f, 0.741732657f},
-std::array<float,2>{0.331627041f, 0.388733089f},
-std::array<float,2>{0.0514935888f, 0.912711799f},
-std::array<float,2>{0.933266222f, 0.141570345f},
-std::array<float,2>{0.97507453f, 0.599862695f},
-std::array<float,2>{0.0781332627f, 0.351481259f},
-std::array<float,2>{0.298025221f, 0.799770176f},
-std::array<float,2>{0.611548483f, 0.0254671108f},
-std::array<float,2>{0.749604046f, 0.969889164f},
-std::array<float,2>{0.377976239f, 0.212192982f},
-std::array<float,2>{0.180821136f, 0.65342468f},
-std::array<float,2>{0.861418307f, 0.457336217f},
-std::array<float,2>{0.905941069f, 0.892809272f},
-std::array<float,2>{0.0113735758f, 0.16555196f},
-std::array<float,2>{0.344568372f, 0.693185568f},
-std::array<float,2>{0.524946153f, 0.431857139f},
-std::array<float,2>{0.672769547f, 0.543237984f},
-std::array<float,2>{0.440171063f, 0.251101881f},
-std::array<float,2>{0.228676394f, 0.818900704f},
-std::array<float,2>{0.789552271f, 0.0941615701f},
-std::array<float,2>{0.833058953f, 0.68140918f},
-std::array<float,2>{0.150202692f, 0.491276085f},
-std::array<float,2>{0.425398409f, 0.950473607f},
-std::array<float,2>{0.68826431f, 0.243159443f},
-std::array<float,2>{0.587521434f, 0.76039505f},
-std::array<float,2>{0.254655153f, 0.040048372f},
-std::array<float,2>{0.0972797871f, 0.588995159f},
-std::array<float,2>{0.968506038f, 0.323826581f},
-std::array<float,2>{0.93834579f, 0.784394681f},
-std::array<float,2>{0.121494308f, 0.00114411616f},
-std::array<float,2>{0.272136271f, 0.619689643f},
-std::array<float,2>{0.57275492f, 0.368339151f},
-std::array<float,2>{0.712588012f, 0.626532793f},
-std::array<float,2>{0.420408964f, 0.443387717f},
-std::array<float,2>{0.13712582f, 0.984992743f},
-std::array<float,2>{0.824963927f, 0.192402974f},
-std::array<float,2>{0.80754298f, 0.524743438f},
-std::array<float,2>{0.241754591f, 0.300197214f},
-std::array<float,2>{0.463443935f, 0.858514249f},
-std::array<float,2>{0.665306747f, 0.0912504122f},
-std::array<float,2>{0.513379335f, 0.930400312f},
-std::array<float,2>{0.374857068f, 0.135369718f},
-std::array<float,2>{0.0223429985f, 0.727380812f},
-std::array<float,2>{0.87881887f, 0.398579299f},
-std::array<float,2>{0.854394794f, 0.961180091f},
-std::array<float,2>{0.162951842f, 0.229866847f},
-std::array<float,2>{0.405001283f, 0.66810894f},
-std::array<float,2>{0.721502721f, 0.476600826f},
-std::array<float,2>{0.60249424f, 0.575214446f},
-std::array<float,2>{0.285744756f, 0.337738723f},
-std::array<float,2>{0.0670926869f, 0.768549502f},
-std::array<float,2>{0.991988778f, 0.0571690649f},
-std::array<float,2>{0.909834802f, 0.712796569f},
-std::array<float,2>{0.0467475653f, 0.419521362f},
-std::array<float,2>{0.318251699f, 0.880544066f},
-std::array<float,2>{0.549563169f, 0.186157614f},
-std::array<float,2>{0.634227395f, 0.837849379f},
-std::array<float,2>{0.474709481f, 0.111554123f},
-std::array<float,2>{0.215626091f, 0.562376976f},
-std::array<float,2>{0.772704959f, 0.277252734f},
-std::array<float,2>{0.81904906f, 0.774334013f},
-std::array<float,2>{0.126544222f, 0.049082838f},
-std::array<float,2>{0.407001466f, 0.564917445f},
-std::array<float,2>{0.704339385f, 0.330914617f},
-std::array<float,2>{0.569867551f, 0.657047331f},
-std::array<float,2>{0.278992802f, 0.46970579f},
-std::array<float,2>{0.117116131f, 0.953668356f},
-std::array<float,2>{0.947651207f, 0.223937705f},
-std::array<float,2>{0.890527785f, 0.547428191f},
-std::array<float,2>{0.0252999924f, 0.273373663f},
-std::array<float,2>{0.362405032f, 0.833460331f},
-std::array<float,2>{0.503094196f, 0.118005447f},
-std::array<float,2>{0.660989463f, 0.889306486f},
-std::array<float,2>{0.459580272f, 0.172337666f},
-std::array<float,2>{0.24776946f, 0.709449172f},
-std::array<float,2>{0.799156308f, 0.411841542f},
-std::array<float,2>{0.993390858f, 0.999808133f},
-std::array<float,2>{0.0771148652f, 0.202837244f},
-std::array<float,2>{0.296077907f, 0.639350951f},
-std::array<float,2>{0.596843243f, 0.449844748f},
-std::array<float,2>{0.728090644f, 0.615769386f},
-std::array<float,2>{0.39473173f, 0.365480483f},
-std::array<float,2>{0.171589121f, 0.793999016f},
-std::array<float,2>{0.851184428f, 0.0104078148f},
-std::array<float,2>{0.777947307f, 0.721776009f},
-std::array<float,2>{0.207052156f, 0.391801208f},
-std::array<float,2>{0.48287943f, 0.928835452f},
-std::array<float,2>{0.626705587f, 0.132138878f},
-std::array<float,2>{0.560293257f, 0.84416467f},
-std::array<float,2>{0.321250468f, 0.0830864683f},
-std::array<float,2>{0.0365106501f, 0.521055222f},
-std::array<float,2>{0.917975545f, 0.30971244f},
-std::array<float,2>{0.924814582f, 0.824608505f},
-std::array<float,2>{0.0555365495f, 0.103788398f},
-std::array<float,2>{0.342270911f, 0.5376333f},
-std::array<float,2>{0.545152426f, 0.263826132f},
-std::array<float,2>{0.64135319f, 0.70161128f},
-std::array<float,2>{0.496956885f, 0.423511058f},
-std::array<float,2>{0.200945407f, 0.905665994f},
-std::array<float,2>{0.759431839f, 0.15827243f},
-std::array<float,2>{0.868803322f, 0.580925703f},
-std::array<float,2>{0.178234145f, 0.312950015f},
-std::array<float,2>{0.386864662f, 0.755639732f},
-std::array<float,2>{0.735259235f, 0.0365963131f},
-std::array<float,2>{0.622818708f, 0.937585354f},
-std::array<float,2>{0.310521275f, 0.242116362f},
-std::array<float,2>{0.0892919824f, 0.673674583f},
-std::array<float,2>{0.979725599f, 0.496110052f},
-std::array<float,2>{0.783568978f, 0.9160707f},
-std::array<float,2>{0.220448136f, 0.150752336f},
-std::array<float,2>{0.451829374f, 0.748715758f},
-std::array<float,2>{0.683342576f, 0.378077656f},
-std::array<float,2>{0.522270918f, 0.501619756f},
-std::array<float,2>{0.35843721f, 0.281487793f},
-std::array<float,2>{0.00177774008f, 0.86669749f},
-std::array<float,2>{0.894863307f, 0.072864376f},
-std::array<float,2>{0.958609223f, 0.647063076f},
-std::array<float,2>{0.105888933f, 0.465588719f},
-std::array<float,2>{0.262159735f, 0.978615046f},
-std::array<float,2>{0.583330452f, 0.203452751f},
-std::array<float,2>{0.697484076f, 0.806475163f},
-std::array<float,2>{0.431182444f, 0.0202852003f},
-std::array<float,2>{0.146624759f, 0.606332958f},
-std::array<float,2>{0.840048432f, 0.353568733f},
-std::array<float,2>{0.863895476f, 0.829543829f},
-std::array<float,2>{0.184900522f, 0.121390745f},
-std::array<float,2>{0.380647659f, 0.554098606f},
-std::array<float,2>{0.745256066f, 0.268530071f},
-std::array<float,2>{0.616226315f, 0.705252051f},
-std::array<float,2>{0.303366512f, 0.407161176f},
-std::array<float,2>{0.0853370726f, 0.885060847f},
-std::array<float,2>{0.971600235f, 0.178543791f},
-std::array<float,2>{0.936338723f, 0.569139957f},
-std::array<float,2>{0.0478609838f, 0.33288002f},
-std::array<float,2>{0.334215164f, 0.780860186f},
-std::array<float,2>{0.532544732f, 0.0508680418f},
-std::array<float,2>{0.651490152f, 0.958630085f},
-std::array<float,2>{0.48916325f, 0.222467616f},
-std::array<float,2>{0.195245996f, 0.663704097f},
-std::array<float,2>{0.756898165f, 0.474407852f},
-std::array<float,2>{0.96298337f, 0.924751639f},
-std::array<float,2>{0.0990054011f, 0.127486527f},
-std::array<float,2>{0.250461578f, 0.726549566f},
-std::array<float,2>{0.592818499f, 0.394610852f},
-std::array<float,2>{0.694447815f, 0.516648412f},
-std::array<float,2>{0.427448869f, 0.305689692f},
-std::array<float,2>{0.154357478f, 0.850540876f},
-std::array<float,2>{0.830340922f, 0.0784818158f},
-std::array<float,2>{0.79466331f, 0.63521868f},
-std::array<float,2>{0.233386755f, 0.445903391f},
-std::array<float,2>{0.443965286f, 0.993462861f},
-std::array<float,2>{0.678929865f, 0.196335256f},
-std::array<float,2>{0.529845595f, 0.79232949f},
-std::array<float,2>{0.348276138f, 0.0145678427f},
-std::array<float,2>{0.0139883654f, 0.61018163f},
-std::array<float,2>{0.899045229f, 0.361769348f},
-std::array<float,2>{0.88065058f, 0.752757668f},
-std::array<float,2>{0.0160072297f, 0.0316357315f},
-std::array<float,2>{0.369782507f, 0.58535862f},
-std::array<float,2>{0.509030402f, 0.320157409f},
-std::array<float,2>{0.668164492f, 0.67885232f},
-std::array<float,2>{0.466731131f, 0.494155139f},
-std::array<float,2>{0.235592052f, 0.94196099f},
-std::array<float,2>{0.809856176f, 0.235064164f},
-std::array<float,2>{0.823747218f, 0.532573223f},
-std::array<float,2>{0.135543808f, 0.260079861f},
-std::array<float,2>{0.414098144f, 0.822433054f},
-std::array<float,2>{0.715489566f, 0.108173117f},
-std::array<float,2>{0.575653493f, 0.898838758f},
-std::array<float,2>{0.269163728f, 0.161923423f},
-std::array<float,2>{0.119838543f, 0.695809782f},
-std::array<float,2>{0.942770362f, 0.42711094f},
-std::array<float,2>{0.767232418f, 0.98423022f},
-std::array<float,2>{0.211207807f, 0.210291415f},
-std::array<float,2>{0.472626746f, 0.643928945f},
-std::array<float,2>{0.639570236f, 0.462822676f},
-std::array<float,2>{0.553997159f, 0.602146685f},
-std::array<float,2>{0.316048622f, 0.357502282f},
-std::array<float,2>{0.0409865193f, 0.809170485f},
-std::array<float,2>{0.913366675f, 0.0195194855f},
-std::array<float,2>{0.986513615f, 0.74433428f},
-std::array<float,2>{0.0635512844f, 0.380090535f},
-std::array<float,2>{0.28475678f, 0.917995453f},
-std::array<float,2>{0.606055558f, 0.152378947f},
-std::array<float,2>{0.725315869f, 0.863075316f},
-std::array<float,2>{0.400876909f, 0.0752420798f},
-std::array<float,2>{0.159266949f, 0.505785584f},
-std::array<float,2>{0.856989741f, 0.287376732f},
-std::array<float,2>{0.80114001f, 0.802826643f},
-std::array<float,2>{0.242906302f, 0.0285257678f},
-std::array<float,2>{0.456559718f, 0.596895397f},
-std::array<float,2>{0.657526672f, 0.344488025f},
-std::array<float,2>{0.507784784f, 0.650476098f},
-std::array<float,2>{0.36384061f, 0.453569263f},
-std::array<float,2>{0.0297920052f, 0.973240435f},
-std::array<float,2>{0.885469079f, 0.21764487f},
-std::array<float,2>{0.949220479f, 0.515280962f},
-std::array<float,2>{0.11294505f, 0.292045176f},
-std::array<float,2>{0.275911242f, 0.870845616f},
-std::array<float,2>{0.56611824f, 0.0701920018f},
-std::array<float,2>{0.707418382f, 0.909714162f},
-std::array<float,2>{0.410391062f, 0.1478405f},
-std::array<float,2>{0.129709393f, 0.734395266f},
-std::array<float,2>{0.81380564f, 0.384566158f},
-std::array<float,2>{0.916989088f, 0.947061658f},
-std::array<float,2>{0.0345725305f, 0.246234238f},
-std::array<float,2>{0.325712293f, 0.685065925f},
-std::array<float,2>{0.557368457f, 0.486586422f},
-std::array<float,2>{0.630553305f, 0.591241241f},
-std::array<float,2>{0.478063583f, 0.324551433f},
-std::array<float,2>{0.203812733f, 0.763962805f},
-std::array<float,2>{0.777182639f, 0.0433115996f},
-std::array<float,2>{0.84489584f, 0.68853271f},
-std::array<float,2>{0.164970696f, 0.436240882f},
-std::array<float,2>{0.393807411f, 0.89831686f},
-std::array<float,2>{0.733076394f, 0.168079883f},
-std::array<float,2>{0.597708762f, 0.816031575f},
-std::array<float,2>{0.29225421f, 0.09973564f},
-std::array<float,2>{0.0728615969f, 0.542642415f},
-std::array<float,2>{0.996426046f, 0.257546663f},
-std::array<float,2>{0.982163131f, 0.855164766f},
-std::array<float,2>{0.091432333f, 0.0874408931f},
-std::array<float,2>{0.304721117f, 0.528993666f},
-std::array<float,2>{0.617376626f, 0.302681327f},
-std::array<float,2>{0.738609135f, 0.731652915f},
-std::array<float,2>{0.385709405f, 0.406069279f},
-std::array<float,2>{0.172121257f, 0.937047184f},
-std::array<float,2>{0.873450935f, 0.139202222f},
-std::array<float,2>{0.764071047f, 0.62240082f},
-std::array<float,2>{0.196208537f, 0.372460663f},
-std::array<float,2>{0.494666249f, 0.785687685f},
-std::array<float,2>{0.644910038f, 0.00611799816f},
-std::array<float,2>{0.540993392f, 0.990920603f},
-std::array<float,2>{0.338420063f, 0.188967541f},
-std::array<float,2>{0.059741687f, 0.629994988f},
-std::array<float,2>{0.926924467f, 0.438787311f},
-std::array<float,2>{0.837267637f, 0.878728151f},
-std::array<float,2>{0.141380012f, 0.181413516f},
-std::array<float,2>{0.43438074f, 0.717281818f},
-std::array<float,2>{0.702843308f, 0.417094827f},
-std::array<float,2>{0.5802899f, 0.557621717f},
-std::array<float,2>{0.258440673f, 0.279385775f},
-std::array<float,2>{0.103557788f, 0.843419731f},
-std::array<float,2>{0.953953743f, 0.113473982f},
-std::array<float,2>{0.893528402f, 0.667864621f},
-std::array<float,2>{0.00646718778f, 0.480576873f},
-std::array<float,2>{0.353514463f, 0.967376649f},
-std::array<float,2>{0.517943025f, 0.233778313f},
-std::array<float,2>{0.686014056f, 0.770119965f},
-std::array<float,2>{0.446679384f, 0.062469691f},
-std::array<float,2>{0.224553034f, 0.571732938f},
-std::array<float,2>{0.786060393f, 0.342406124f},
-std::array<float,2>{0.791539013f, 0.81746161f},
-std::array<float,2>{0.227704018f, 0.0959463492f},
-std::array<float,2>{0.438693017f, 0.545096219f},
-std::array<float,2>{0.674322069f, 0.25249216f},
-std::array<float,2>{0.526389718f, 0.694748521f},
-std::array<float,2>{0.347635686f, 0.431253403f},
-std::array<float,2>{0.00975330453f, 0.891875565f},
-std::array<float,2>{0.902612388f, 0.167037338f},
-std::array<float,2>{0.966489255f, 0.586343944f},
-std::array<float,2>{0.0950131491f, 0.321777105f},
-std::array<float,2>{0.256501704f, 0.75806278f},
-std::array<float,2>{0.588357151f, 0.0425190181f},
-std::array<float,2>{0.690225005f, 0.952917516f},
-std::array<float,2>{0.422092855f, 0.245269164f},
-std::array<float,2>{0.15093191f, 0.683272004f},
-std::array<float,2>{0.835081816f, 0.489031672f},
-std::array<float,2>{0.931408405f, 0.911009371f},
-std::array<float,2>{0.0545692481f, 0.143079743f},
-std::array<float,2>{0.32918331f, 0.738898695f},
-std::array<float,2>{0.537880599f, 0.388306856f},
-std::array<float,2>{0.652731597f, 0.5094347f},
-std::array<float,2>{0.486266822f, 0.295460016f},
-std::array<float,2>{0.19093667f, 0.872347236f},
-std::array<float,2>{0.751396835f, 0.0633406639f},
-std::array<float,2>{0.859470546f, 0.654533803f},
-std::array<float,2>{0.182865217f, 0.459999889f},
-std::array<float,2>{0.376269072f, 0.971509695f},
-std::array<float,2>{0.746747315f, 0.213309035f},
-std::array<float,2>{0.609390497f, 0.797264934f},
-std::array<float,2>{0.29997465f, 0.0253065042f},
-std::array<float,2>{0.0818560943f, 0.598802269f},
-std::array<float,2>{0.972863793f, 0.349037111f},
-std::array<float,2>{0.989366233f, 0.766147673f},
-std::array<float,2>{0.069288969f, 0.0552299172f},
-std::array<float,2>{0.288262457f, 0.577426791f},
-std::array<float,2>{0.604159534f, 0.337937444f},
-std::array<float,2>{0.718865991f, 0.671007156f},
-std::array<float,2>{0.403291732f, 0.480353624f},
-std::array<float,2>{0.161367938f, 0.964026213f},
-std::array<float,2>{0.851790965f, 0.22815676f},
-std::array<float,2>{0.77078265f, 0.559907317f},
-std::array<float,2>{0.218488783f, 0.273754954f},
-std::array<float,2>{0.473225802f, 0.839753032f},
-std::array<float,2>{0.635773838f, 0.110786274f},
-std::array<float,2>{0.547232211f, 0.881489694f},
-std::array<float,2>{0.319534361f, 0.184865281f},
-std::array<float,2>{0.0441977382f, 0.714467406f},
-std::array<float,2>{0.906986833f, 0.420149118f},
-std::array<float,2>{0.82678318f, 0.987708867f},
-std::array<float,2>{0.139853612f, 0.193440109f},
-std::array<float,2>{0.418434322f, 0.628646553f},
-std::array<float,2>{0.713664949f, 0.443338454f},
-std::array<float,2>{0.572020531f, 0.617919385f},
-std::array<float,2>{0.271238655f, 0.370064765f},
-std::array<float,2>{0.123733155f, 0.78164649f},
-std::array<float,2>{0.941172183f, 0.00240419526f},
-std::array<float,2>{0.87622416f, 0.729989231f},
-std::array<float,2>{0.0199384298f, 0.40192607f},
-std::array<float,2>{0.371925473f, 0.931930065f},
-std::array<float,2>{0.513879955f, 0.133471534f},
-std::array<float,2>{0.666699946f, 0.856043935f},
-std::array<float,2>{0.461719066f, 0.0922167748f},
-std::array<float,2>{0.239892453f, 0.526819885f},
-std::array<float,2>{0.80546993f, 0.297305405f},
-std::array<float,2>{0.848930776f, 0.796860158f},
-std::array<float,2>{0.16932252f, 0.00917686056f},
-std::array<float,2>{0.397956818f, 0.613336205f},
-std::array<float,2>{0.729042649f, 0.363864988f},
-std::array<float,2>{0.594258308f, 0.637833416f},
-std::array<float,2>{0.294401228f, 0.451218635f},
-std::array<float,2>{0.0753110349f, 0.996337712f},
-std::array<float,2>{0.994803429f, 0.201014623f},
-std::array<float,2>{0.921534956f, 0.523433506f},
-std::array<float,2>{0.0388076566f, 0.310629427f},
-std::array<float,2>{0.323725075f, 0.847654879f},
-std::array<float,2>{0.56158483f, 0.0840620473f},
-std::array<float,2>{0.62838465f, 0.926759839f},
-std::array<float,2>{0.482061863f, 0.129058674f},
-std::array<float,2>{0.210795879f, 0.719376862f},
-std::array<float,2>{0.781138897f, 0.393835396f},
-std::array<float,2>{0.946287513f, 0.957030356f},
-std::array<float,2>{0.114511512f, 0.225961551f},
-std::array<float,2>{0.280159563f, 0.659595072f},
-std::array<float,2>{0.567810297f, 0.472188145f},
-std::array<float,2>{0.706605732f, 0.563950837f},
-std::array<float,2>{0.409442276f, 0.329472005f},
-std::array<float,2>{0.128411978f, 0.776424348f},
-std::array<float,2>{0.817554116f, 0.048734542f},
-std::array<float,2>{0.798376203f, 0.708512723f},
-std::array<float,2>{0.249537632f, 0.412160754f},
-std::array<float,2>{0.458956778f, 0.887559354f},
-std::array<float,2>{0.662587702f, 0.174236089f},
-std::array<float,2>{0.50166446f, 0.835706532f},
-std::array<float,2>{0.35962218f, 0.119388357f},
-std::array<float,2>{0.0268718265f, 0.550100863f},
-std::array<float,2>{0.888364851f, 0.271254003f},
-std::array<float,2>{0.897481918f, 0.863397062f},
-std::array<float,2>{0.00298653916f, 0.0720746294f},
-std::array<float,2>{0.356270403f, 0.503828347f},
-std::array<float,2>{0.520460844f, 0.284922689f},
-std::array<float,2>{0.680276513f, 0.747527599f},
-std::array<float,2>{0.450958014f, 0.37604478f},
-std::array<float,2>{0.222202852f, 0.91575247f},
-std::array<float,2>{0.783026457f, 0.148573384f},
-std::array<float,2>{0.841855884f, 0.607800722f},
-std::array<float,2>{0.145470485f, 0.351756275f},
-std::array<float,2>{0.431685746f, 0.807667375f},
-std::array<float,2>{0.695680618f, 0.0218091644f},
-std::array<float,2>{0.585630238f, 0.976740479f},
-std::array<float,2>{0.264948338f, 0.206706196f},
-std::array<float,2>{0.107593231f, 0.645098805f},
-std::array<float,2>{0.960845709f, 0.467567414f},
-std::array<float,2>{0.760549307f, 0.902427316f},
-std::array<float,2>{0.203102961f, 0.156353906f},
-std::array<float,2>{0.498446107f, 0.699442685f},
-std::array<float,2>{0.643033385f, 0.425123513f},
-std::array<float,2>{0.543824852f, 0.535562396f},
-std::array<float,2>{0.341021001f, 0.263329834f},
-std::array<float,2>{0.05682908f, 0.826567948f},
-std::array<float,2>{0.923517108f, 0.10197974f},
-std::array<float,2>{0.977840543f, 0.674776673f},
-std::array<float,2>{0.0868942067f, 0.499000728f},
-std::array<float,2>{0.311822951f, 0.940809906f},
-std::array<float,2>{0.624110699f, 0.240139201f},
-std::array<float,2>{0.738270223f, 0.7568326f},
-std::array<float,2>{0.388746381f, 0.0371148288f},
-std::array<float,2>{0.176933557f, 0.579035103f},
-std::array<float,2>{0.870291352f, 0.316220134f},
-std::array<float,2>{0.829262435f, 0.847675979f},
-std::array<float,2>{0.153416246f, 0.0809831023f},
-std::array<float,2>{0.42871201f, 0.518514454f},
-std::array<float,2>{0.692310989f, 0.308589101f},
-std::array<float,2>{0.591236651f, 0.723950863f},
-std::array<float,2>{0.253367364f, 0.397255152f},
-std::array<float,2>{0.100618564f, 0.923574448f},
-std::array<float,2>{0.962429404f, 0.125378042f},
-std::array<float,2>{0.902083099f, 0.612658083f},
-std::array<float,2>{0.0133052152f, 0.359817624f},
-std::array<float,2>{0.350189745f, 0.790440261f},
-std::array<float,2>{0.52790302f, 0.011970249f},
-std::array<float,2>{0.676110148f, 0.994656384f},
-std::array<float,2>{0.442841053f, 0.197369188f},
-std::array<float,2>{0.230642095f, 0.634414017f},
-std::array<float,2>{0.79600805f, 0.448692381f},
-std::array<float,2>{0.970081508f, 0.883841515f},
-std::array<float,2>{0.0823075399f, 0.1761069f},
-std::array<float,2>{0.302244574f, 0.704143524f},
-std::array<float,2>{0.613490939f, 0.408237904f},
-std::array<float,2>{0.743675947f, 0.55234611f},
-std::array<float,2>{0.382053256f, 0.266642392f},
-std::array<float,2>{0.186971873f, 0.831530273f},
-std::array<float,2>{0.866844177f, 0.124010988f},
-std::array<float,2>{0.75511086f, 0.661338985f},
-std::array<float,2>{0.192022026f, 0.475338191f},
-std::array<float,2>{0.491604716f, 0.959719718f},
-std::array<float,2>{0.649795651f, 0.219311878f},
-std::array<float,2>{0.534425437f, 0.77822274f},
-std::array<float,2>{0.333159059f, 0.0542945005f},
-std::array<float,2>{0.0498270541f, 0.567436099f},
-std::array<float,2>{0.934565783f, 0.333994687f},
-std::array<float,2>{0.911948979f, 0.81106782f},
-std::array<float,2>{0.0420796089f, 0.0158670023f},
-std::array<float,2>{0.312973201f, 0.603774607f},
-std::array<float,2>{0.552361727f, 0.357089847f},
-std::array<float,2>{0.637984395f, 0.640882611f},
-std::array<float,2>{0.470065445f, 0.463256091f},
-std::array<float,2>{0.213534579f, 0.980543852f},
-std::array<float,2>{0.768381536f, 0.208382308f},
-std::array<float,2>{0.858303726f, 0.506638587f},
-std::array<float,2>{0.157004908f, 0.286276221f},
-std::array<float,2>{0.400390565f, 0.859690607f},
-std::array<float,2>{0.723466277f, 0.0773847401f},
-std::array<float,2>{0.608380497f, 0.921316147f},
-std::array<float,2>{0.281474084f, 0.15507409f},
-std::array<float,2>{0.0646054745f, 0.742747962f},
-std::array<float,2>{0.984652102f, 0.38219589f},
-std::array<float,2>{0.811497092f, 0.94477123f},
-std::array<float,2>{0.23634924f, 0.23808077f},
-std::array<float,2>{0.467861086f, 0.677466154f},
-std::array<float,2>{0.670297921f, 0.493745565f},
-std::array<float,2>{0.510483384f, 0.583736777f},
-std::array<float,2>{0.367988735f, 0.318305701f},
-std::array<float,2>{0.0191352293f, 0.750353396f},
-std::array<float,2>{0.881595075f, 0.0332296416f},
-std::array<float,2>{0.943419755f, 0.697315156f},
-std::array<float,2>{0.117200196f, 0.428521037f},
-std::array<float,2>{0.265882999f, 0.901692331f},
-std::array<float,2>{0.57691133f, 0.163063407f},
-std::array<float,2>{0.71848917f, 0.822058558f},
-std::array<float,2>{0.416450024f, 0.106518961f},
-std::array<float,2>{0.134146065f, 0.533729851f},
-std::array<float,2>{0.822175264f, 0.258473933f},
-std::array<float,2>{0.774588406f, 0.763569891f},
-std::array<float,2>{0.206403986f, 0.0456371419f},
-std::array<float,2>{0.479905516f, 0.592970729f},
-std::array<float,2>{0.632047415f, 0.326217294f},
-std::array<float,2>{0.556564271f, 0.686101735f},
-std::array<float,2>{0.327022731f, 0.485426039f},
-std::array<float,2>{0.0320918523f, 0.948363602f},
-std::array<float,2>{0.914932013f, 0.249744609f},
-std::array<float,2>{0.998945236f, 0.539073825f},
-std::array<float,2>{0.071632877f, 0.254647613f},
-std::array<float,2>{0.290015101f, 0.8140769f},
-std::array<float,2>{0.599835753f, 0.0988154262f},
-std::array<float,2>{0.732332468f, 0.895048082f},
-std::array<float,2>{0.391008317f, 0.169947788f},
-std::array<float,2>{0.167927951f, 0.690711856f},
-std::array<float,2>{0.847129226f, 0.43403244f},
-std::array<float,2>{0.88435936f, 0.975955188f},
-std::array<float,2>{0.0286213886f, 0.216319546f},
-std::array<float,2>{0.365930259f, 0.64917767f},
-std::array<float,2>{0.504119217f, 0.456967294f},
-std::array<float,2>{0.659476936f, 0.595564544f},
-std::array<float,2>{0.453733176f, 0.346710533f},
-std::array<float,2>{0.244864985f, 0.800988376f},
-std::array<float,2>{0.804140151f, 0.0304850917f},
-std::array<float,2>{0.816207945f, 0.73825717f},
-std::array<float,2>{0.13219592f, 0.386099219f},
-std::array<float,2>{0.413574159f, 0.908143997f},
-std::array<float,2>{0.709420979f, 0.146165982f},
-std::array<float,2>{0.564145327f, 0.867887259f},
-std::array<float,2>{0.275061965f, 0.0665616989f},
-std::array<float,2>{0.110398956f, 0.51280719f},
-std::array<float,2>{0.953007817f, 0.290169328f},
-std::array<float,2>{0.956673503f, 0.840164781f},
-std::array<float,2>{0.102161959f, 0.115829892f},
-std::array<float,2>{0.261610925f, 0.556321681f},
-std::array<float,2>{0.579515219f, 0.27827543f},
-std::array<float,2>{0.699420571f, 0.716020942f},
-std::array<float,2>{0.43690905f, 0.414639175f},
-std::array<float,2>{0.143291607f, 0.875506938f},
-std::array<float,2>{0.838442862f, 0.18195565f},
-std::array<float,2>{0.788171113f, 0.573744774f},
-std::array<float,2>{0.224670768f, 0.341355145f},
-std::array<float,2>{0.449126273f, 0.772031128f},
-std::array<float,2>{0.683948517f, 0.0587056912f},
-std::array<float,2>{0.516774356f, 0.965203583f},
-std::array<float,2>{0.353530139f, 0.232131839f},
-std::array<float,2>{0.00498634856f, 0.665013134f},
-std::array<float,2>{0.89112699f, 0.483564407f},
-std::array<float,2>{0.872636735f, 0.934894145f},
-std::array<float,2>{0.174476236f, 0.13818264f},
-std::array<float,2>{0.382828444f, 0.733939886f},
-std::array<float,2>{0.742034078f, 0.403426737f},
-std::array<float,2>{0.62105155f, 0.529840171f},
-std::array<float,2>{0.30847469f, 0.30324772f},
-std::array<float,2>{0.0930467546f, 0.851749837f},
-std::array<float,2>{0.98269558f, 0.0895494968f},
-std::array<float,2>{0.928306401f, 0.632262766f},
-std::array<float,2>{0.0608143993f, 0.439658552f},
-std::array<float,2>{0.337010682f, 0.989448428f},
-std::array<float,2>{0.541161597f, 0.190107271f},
-std::array<float,2>{0.648320019f, 0.787702918f},
-std::array<float,2>{0.493049979f, 0.00506874779f},
-std::array<float,2>{0.19840771f, 0.624113202f},
-std::array<float,2>{0.762640238f, 0.373634756f},
-std::array<float,2>{0.772399485f, 0.838808775f},
-std::array<float,2>{0.216164291f, 0.110016264f},
-std::array<float,2>{0.47607255f, 0.559062898f},
-std::array<float,2>{0.632844031f, 0.274926037f},
-std::array<float,2>{0.550628662f, 0.712977052f},
-std::array<float,2>{0.317050546f, 0.421869695f},
-std::array<float,2>{0.0453535765f, 0.882390141f},
-std::array<float,2>{0.908965349f, 0.183899552f},
-std::array<float,2>{0.990516126f, 0.576807737f},
-std::array<float,2>{0.0678284764f, 0.338889837f},
-std::array<float,2>{0.286823839f, 0.767294765f},
-std::array<float,2>{0.603469849f, 0.0563931055f},
-std::array<float,2>{0.721966743f, 0.96356535f},
-std::array<float,2>{0.405510575f, 0.226854801f},
-std::array<float,2>{0.163719386f, 0.670804441f},
-std::array<float,2>{0.854743123f, 0.479223013f},
-std::array<float,2>{0.877067387f, 0.932779431f},
-std::array<float,2>{0.0226026736f, 0.134637877f},
-std::array<float,2>{0.373688847f, 0.729251087f},
-std::array<float,2>{0.511902511f, 0.400912076f},
-std::array<float,2>{0.664407909f, 0.525785446f},
-std::array<float,2>{0.464294255f, 0.298805565f},
-std::array<float,2>{0.241198719f, 0.856502652f},
-std::array<float,2>{0.808165252f, 0.0929165035f},
-std::array<float,2>{0.825691819f, 0.627266526f},
-std::array<float,2>{0.13830851f, 0.442168623f},
-std::array<float,2>{0.420938283f, 0.987157226f},
-std::array<float,2>{0.711037517f, 0.194836318f},
-std::array<float,2>{0.574174225f, 0.782613873f},
-std::array<float,2>{0.272612303f, 0.00374997221f},
-std::array<float,2>{0.122355387f, 0.618735671f},
-std::array<float,2>{0.939178169f, 0.370449871f},
-std::array<float,2>{0.967256427f, 0.758830249f},
-std::array<float,2>{0.0957202911f, 0.0414170548f},
-std::array<float,2>{0.255534023f, 0.587200284f},
-std::array<float,2>{0.586625636f, 0.321206003f},
-std::array<float,2>{0.68918246f, 0.682601452f},
-std::array<float,2>{0.424238324f, 0.489453256f},
-std::array<float,2>{0.148523971f, 0.951233089f},
-std::array<float,2>{0.832278311f, 0.244202986f},
-std::array<float,2>{0.790329039f, 0.546822131f},
-std::array<float,2>{0.229665563f, 0.253093272f},
-std::array<float,2>{0.441032141f, 0.817010403f},
-std::array<float,2>{0.673223972f, 0.0974341631f},
-std::array<float,2>{0.523667812f, 0.891299903f},
-std::array<float,2>{0.344825864f, 0.166670009f},
-std::array<float,2>{0.00990235992f, 0.693913877f},
-std::array<float,2>{0.905072153f, 0.429816961f},
-std::array<float,2>{0.862375498f, 0.972327113f},
-std::array<float,2>{0.179912388f, 0.214122012f},
-std::array<float,2>{0.377833337f, 0.655904531f},
-std::array<float,2>{0.748776317f, 0.459240437f},
-std::array<float,2>{0.61294502f, 0.598495066f},
-std::array<float,2>{0.297392428f, 0.348386526f},
-std::array<float,2>{0.0796031356f, 0.798571587f},
-std::array<float,2>{0.976508915f, 0.0241607632f},
-std::array<float,2>{0.932044625f, 0.739533722f},
-std::array<float,2>{0.0525977723f, 0.38678202f},
-std::array<float,2>{0.33059752f, 0.911967874f},
-std::array<float,2>{0.535915136f, 0.144466132f},
-std::array<float,2>{0.656172335f, 0.87152195f},
-std::array<float,2>{0.487937808f, 0.0643042102f},
-std::array<float,2>{0.188286707f, 0.507826269f},
-std::array<float,2>{0.752851188f, 0.295944244f},
-std::array<float,2>{0.841100395f, 0.807509363f},
-std::array<float,2>{0.147504047f, 0.023333434f},
-std::array<float,2>{0.430504382f, 0.609291911f},
-std::array<float,2>{0.69842577f, 0.353129029f},
-std::array<float,2>{0.582634687f, 0.646358311f},
-std::array<float,2>{0.262750119f, 0.468017042f},
-std::array<float,2>{0.107310578f, 0.978313565f},
-std::array<float,2>{0.957760334f, 0.205123588f},
-std::array<float,2>{0.896084607f, 0.502685428f},
-std::array<float,2>{0.000898976286f, 0.283734769f},
-std::array<float,2>{0.358132511f, 0.864771426f},
-std::array<float,2>{0.522957504f, 0.0709182471f},
-std::array<float,2>{0.682434082f, 0.914076507f},
-std::array<float,2>{0.452591777f, 0.149980694f},
-std::array<float,2>{0.219334006f, 0.746569157f},
-std::array<float,2>{0.78464669f, 0.375304163f},
-std::array<float,2>{0.979346097f, 0.940013111f},
-std::array<float,2>{0.0880579129f, 0.238669872f},
-std::array<float,2>{0.309164554f, 0.675765991f},
-std::array<float,2>{0.62148869f, 0.499037653f},
-std::array<float,2>{0.736293793f, 0.580061376f},
-std::array<float,2>{0.388358146f, 0.314967066f},
-std::array<float,2>{0.178921297f, 0.757315159f},
-std::array<float,2>{0.867686272f, 0.0383117683f},
-std::array<float,2>{0.757935047f, 0.700739741f},
-std::array<float,2>{0.199707627f, 0.424792111f},
-std::array<float,2>{0.49783051f, 0.904170513f},
-std::array<float,2>{0.642293453f, 0.157950759f},
-std::array<float,2>{0.546840906f, 0.827984869f},
-std::array<float,2>{0.343463391f, 0.102972932f},
-std::array<float,2>{0.0561090745f, 0.537050962f},
-std::array<float,2>{0.923985481f, 0.262487382f},
-std::array<float,2>{0.919729769f, 0.845969319f},
-std::array<float,2>{0.03525161f, 0.0851061568f},
-std::array<float,2>{0.322225004f, 0.522283316f},
-std::array<float,2>{0.559116066f, 0.311845034f},
-std::array<float,2>{0.625796914f, 0.720101833f},
-std::array<float,2>{0.484306306f, 0.393358588f},
-std::array<float,2>{0.208572105f, 0.926013589f},
-std::array<float,2>{0.778636575f, 0.130633384f},
-std::array<float,2>{0.850072563f, 0.61504513f},
-std::array<float,2>{0.170126557f, 0.365025729f},
-std::array<float,2>{0.396342665f, 0.795159459f},
-std::array<float,2>{0.727493227f, 0.00802665483f},
-std::array<float,2>{0.596656919f, 0.997958243f},
-std::array<float,2>{0.295452595f, 0.199291825f},
-std::array<float,2>{0.077696681f, 0.637542129f},
-std::array<float,2>{0.992968142f, 0.452185631f},
-std::array<float,2>{0.800612807f, 0.888559937f},
-std::array<float,2>{0.247067928f, 0.175595298f},
-std::array<float,2>{0.460775137f, 0.707872987f},
-std::array<float,2>{0.662046731f, 0.413193077f},
-std::array<float,2>{0.502713561f, 0.549396992f},
-std::array<float,2>{0.361555904f, 0.270178258f},
-std::array<float,2>{0.0238374434f, 0.834432304f},
-std::array<float,2>{0.889465868f, 0.120513901f},
-std::array<float,2>{0.949197352f, 0.658274591f},
-std::array<float,2>{0.115303963f, 0.471510947f},
-std::array<float,2>{0.277366042f, 0.955712616f},
-std::array<float,2>{0.569222391f, 0.224925846f},
-std::array<float,2>{0.703644812f, 0.775922596f},
-std::array<float,2>{0.407411247f, 0.0471083336f},
-std::array<float,2>{0.125458688f, 0.563190579f},
-std::array<float,2>{0.820225298f, 0.328222662f},
-std::array<float,2>{0.856363595f, 0.860558808f},
-std::array<float,2>{0.158812284f, 0.076872535f},
-std::array<float,2>{0.401703149f, 0.507261634f},
-std::array<float,2>{0.726021409f, 0.285230339f},
-std::array<float,2>{0.6068483f, 0.743672431f},
-std::array<float,2>{0.283897698f, 0.381736577f},
-std::array<float,2>{0.0629363284f, 0.920099974f},
-std::array<float,2>{0.987583041f, 0.156142756f},
-std::array<float,2>{0.912176788f, 0.604931235f},
-std::array<float,2>{0.0400031805f, 0.355709106f},
-std::array<float,2>{0.315297008f, 0.812494934f},
-std::array<float,2>{0.552897274f, 0.0170979779f},
-std::array<float,2>{0.640302181f, 0.982026756f},
-std::array<float,2>{0.471218318f, 0.207295761f},
-std::array<float,2>{0.212377205f, 0.641796529f},
-std::array<float,2>{0.766386271f, 0.464715153f},
-std::array<float,2>{0.941974461f, 0.900710642f},
-std::array<float,2>{0.120446302f, 0.163356826f},
-std::array<float,2>{0.268123478f, 0.699009418f},
-std::array<float,2>{0.574611783f, 0.429475665f},
-std::array<float,2>{0.715997815f, 0.534356475f},
-std::array<float,2>{0.415157616f, 0.259737611f},
-std::array<float,2>{0.135747313f, 0.820930719f},
-std::array<float,2>{0.82307142f, 0.105636112f},
-std::array<float,2>{0.808876872f, 0.676318169f},
-std::array<float,2>{0.234932721f, 0.493074566f},
-std::array<float,2>{0.465740681f, 0.944270372f},
-std::array<float,2>{0.66967082f, 0.237112224f},
-std::array<float,2>{0.507885158f, 0.751098037f},
-std::array<float,2>{0.370865345f, 0.0343693905f},
-std::array<float,2>{0.0174385477f, 0.582309902f},
-std::array<float,2>{0.879273951f, 0.316913456f},
-std::array<float,2>{0.899492145f, 0.789604664f},
-std::array<float,2>{0.0149733331f, 0.0133198909f},
-std::array<float,2>{0.348652959f, 0.611881971f},
-std::array<float,2>{0.531128585f, 0.361121923f},
-std::array<float,2>{0.677943647f, 0.633188903f},
-std::array<float,2>{0.444630414f, 0.447388262f},
-std::array<float,2>{0.234056503f, 0.9957394f},
-std::array<float,2>{0.793347478f, 0.199127436f},
-std::array<float,2>{0.831425309f, 0.518703043f},
-std::array<float,2>{0.155575186f, 0.307449371f},
-std::array<float,2>{0.426176727f, 0.848748744f},
-std::array<float,2>{0.693806708f, 0.0816051289f},
-std::array<float,2>{0.59184742f, 0.922544479f},
-std::array<float,2>{0.251063555f, 0.126919553f},
-std::array<float,2>{0.0981604606f, 0.723566592f},
-std::array<float,2>{0.964530468f, 0.39795053f},
-std::array<float,2>{0.756513357f, 0.960333824f},
-std::array<float,2>{0.193822429f, 0.220138431f},
-std::array<float,2>{0.489754975f, 0.661014259f},
-std::array<float,2>{0.650951684f, 0.475959927f},
-std::array<float,2>{0.532139003f, 0.566896677f},
-std::array<float,2>{0.335905969f, 0.335211694f},
-std::array<float,2>{0.0477713011f, 0.779178321f},
-std::array<float,2>{0.937116444f, 0.0527450405f},
-std::array<float,2>{0.971886337f, 0.703396559f},
-std::array<float,2>{0.0840523168f, 0.409292072f},
-std::array<float,2>{0.303761572f, 0.883731246f},
-std::array<float,2>{0.615468323f, 0.177360311f},
-std::array<float,2>{0.744464934f, 0.830140948f},
-std::array<float,2>{0.378996402f, 0.124351427f},
-std::array<float,2>{0.184439257f, 0.551467717f},
-std::array<float,2>{0.864544392f, 0.266426831f},
-std::array<float,2>{0.787059128f, 0.773099363f},
-std::array<float,2>{0.223023802f, 0.0598165244f},
-std::array<float,2>{0.446278185f, 0.572788179f},
-std::array<float,2>{0.686754644f, 0.340756804f},
-std::array<float,2>{0.51889807f, 0.6651057f},
-std::array<float,2>{0.352455944f, 0.483355045f},
-std::array<float,2>{0.00692396332f, 0.966139734f},
-std::array<float,2>{0.894386768f, 0.230488375f},
-std::array<float,2>{0.954473555f, 0.555392742f},
-std::array<float,2>{0.105337508f, 0.279108196f},
-std::array<float,2>{0.259271532f, 0.841388881f},
-std::array<float,2>{0.581669152f, 0.11688751f},
-std::array<float,2>{0.70119971f, 0.876893342f},
-std::array<float,2>{0.434984952f, 0.182694748f},
-std::array<float,2>{0.142148599f, 0.715161681f},
-std::array<float,2>{0.836442471f, 0.415969133f},
-std::array<float,2>{0.925823987f, 0.989074826f},
-std::array<float,2>{0.0591436923f, 0.190570325f},
-std::array<float,2>{0.339583695f, 0.631741762f},
-std::array<float,2>{0.539546371f, 0.440806121f},
-std::array<float,2>{0.645861268f, 0.623829544f},
-std::array<float,2>{0.495671242f, 0.374460965f},
-std::array<float,2>{0.197117209f, 0.788511693f},
-std::array<float,2>{0.765394449f, 0.00429651188f},
-std::array<float,2>{0.874747276f, 0.732530475f},
-std::array<float,2>{0.17290248f, 0.402855188f},
-std::array<float,2>{0.385923833f, 0.934120893f},
-std::array<float,2>{0.740032494f, 0.137124062f},
-std::array<float,2>{0.618483365f, 0.852686107f},
-std::array<float,2>{0.306500345f, 0.0888194367f},
-std::array<float,2>{0.089951016f, 0.53046447f},
-std::array<float,2>{0.980619013f, 0.304571271f},
-std::array<float,2>{0.9979195f, 0.81281203f},
-std::array<float,2>{0.0734805688f, 0.098006621f},
-std::array<float,2>{0.291754484f, 0.540427685f},
-std::array<float,2>{0.598791957f, 0.25564009f},
-std::array<float,2>{0.734123051f, 0.689912319f},
-std::array<float,2>{0.393031955f, 0.435029715f},
-std::array<float,2>{0.165105611f, 0.896372378f},
-std::array<float,2>{0.844430089f, 0.171856254f},
-std::array<float,2>{0.776134729f, 0.592568398f},
-std::array<float,2>{0.204594627f, 0.327845007f},
-std::array<float,2>{0.477478176f, 0.762465954f},
-std::array<float,2>{0.629561841f, 0.0459229946f},
-std::array<float,2>{0.557630897f, 0.947530866f},
-std::array<float,2>{0.32476908f, 0.248133257f},
-std::array<float,2>{0.0332056992f, 0.687406898f},
-std::array<float,2>{0.917388856f, 0.484513134f},
-std::array<float,2>{0.813448131f, 0.906480193f},
-std::array<float,2>{0.130229563f, 0.145000264f},
-std::array<float,2>{0.411765426f, 0.736583352f},
-std::array<float,2>{0.708215952f, 0.384886295f},
-std::array<float,2>{0.564683735f, 0.512268245f},
-std::array<float,2>{0.276703119f, 0.289318472f},
-std::array<float,2>{0.11187464f, 0.869092703f},
-std::array<float,2>{0.95071274f, 0.0674177334f},
-std::array<float,2>{0.886291206f, 0.649535894f},
-std::array<float,2>{0.0308471601f, 0.455374628f},
-std::array<float,2>{0.365097165f, 0.975072443f},
-std::array<float,2>{0.506366789f, 0.215313181f},
-std::array<float,2>{0.656768203f, 0.802401006f},
-std::array<float,2>{0.45536986f, 0.0299713966f},
-std::array<float,2>{0.243210003f, 0.594724894f},
-std::array<float,2>{0.802032113f, 0.346504122f},
-std::array<float,2>{0.806033432f, 0.858161747f},
-std::array<float,2>{0.238356069f, 0.0898830369f},
-std::array<float,2>{0.461975306f, 0.524212539f},
-std::array<float,2>{0.66767627f, 0.299446225f},
-std::array<float,2>{0.515368164f, 0.728228271f},
-std::array<float,2>{0.372387171f, 0.399859995f},
-std::array<float,2>{0.0211769026f, 0.931295753f},
-std::array<float,2>{0.875829279f, 0.136401162f},
-std::array<float,2>{0.939973474f, 0.620982647f},
-std::array<float,2>{0.124023654f, 0.367329568f},
-std::array<float,2>{0.270381421f, 0.784166098f},
-std::array<float,2>{0.57121563f, 0.000929543574f},
-std::array<float,2>{0.714012265f, 0.98539257f},
-std::array<float,2>{0.419786781f, 0.191638231f},
-std::array<float,2>{0.139164761f, 0.625876725f},
-std::array<float,2>{0.827973127f, 0.444905162f},
-std::array<float,2>{0.908102989f, 0.879751265f},
-std::array<float,2>{0.043786563f, 0.187263384f},
-std::array<float,2>{0.318876714f, 0.711365998f},
-std::array<float,2>{0.548232555f, 0.418840796f},
-std::array<float,2>{0.635467589f, 0.560915589f},
-std::array<float,2>{0.474334568f, 0.276357263f},
-std::array<float,2>{0.217633709f, 0.836248338f},
-std::array<float,2>{0.770358622f, 0.113008961f},
-std::array<float,2>{0.853244722f, 0.669743657f},
-std::array<float,2>{0.16031225f, 0.477870852f},
-std::array<float,2>{0.403863668f, 0.96249038f},
-std::array<float,2>{0.71980828f, 0.228916913f},
-std::array<float,2>{0.604927778f, 0.769467294f},
-std::array<float,2>{0.287691832f, 0.0584513173f},
-std::array<float,2>{0.070053488f, 0.574364364f},
-std::array<float,2>{0.989045203f, 0.336641043f},
-std::array<float,2>{0.973702371f, 0.80005151f},
-std::array<float,2>{0.0805874243f, 0.026886113f},
-std::array<float,2>{0.299081355f, 0.600639522f},
-std::array<float,2>{0.610890925f, 0.349814683f},
-std::array<float,2>{0.747188926f, 0.653159678f},
-std::array<float,2>{0.375048667f, 0.458624035f},
-std::array<float,2>{0.181972653f, 0.968979955f},
-std::array<float,2>{0.860446095f, 0.211771414f},
-std::array<float,2>{0.750907481f, 0.510161042f},
-std::array<float,2>{0.190328211f, 0.293306828f},
-std::array<float,2>{0.484793127f, 0.873683214f},
-std::array<float,2>{0.653989375f, 0.0651129112f},
-std::array<float,2>{0.538348258f, 0.913707018f},
-std::array<float,2>{0.328795284f, 0.142115712f},
-std::array<float,2>{0.0530960597f, 0.740436316f},
-std::array<float,2>{0.930224061f, 0.389735729f},
-std::array<float,2>{0.834395647f, 0.949379206f},
-std::array<float,2>{0.151747018f, 0.24332808f},
-std::array<float,2>{0.423517972f, 0.680295646f},
-std::array<float,2>{0.691000998f, 0.490617126f},
-std::array<float,2>{0.589298844f, 0.588343978f},
-std::array<float,2>{0.257782876f, 0.322907418f},
-std::array<float,2>{0.0941456258f, 0.761398852f},
-std::array<float,2>{0.965114474f, 0.0400202386f},
-std::array<float,2>{0.903547645f, 0.691408753f},
-std::array<float,2>{0.00786130037f, 0.432910264f},
-std::array<float,2>{0.345742494f, 0.894473433f},
-std::array<float,2>{0.525492251f, 0.164996743f},
-std::array<float,2>{0.675427914f, 0.820264041f},
-std::array<float,2>{0.437892914f, 0.0952561572f},
-std::array<float,2>{0.227360353f, 0.54461652f},
-std::array<float,2>{0.792536557f, 0.250411361f},
-std::array<float,2>{0.869941592f, 0.754288673f},
-std::array<float,2>{0.17664589f, 0.0359346159f},
-std::array<float,2>{0.389729232f, 0.581966877f},
-std::array<float,2>{0.736369193f, 0.314017534f},
-std::array<float,2>{0.623254418f, 0.672537208f},
-std::array<float,2>{0.310866445f, 0.497582287f},
-std::array<float,2>{0.0878677815f, 0.938661098f},
-std::array<float,2>{0.976723731f, 0.240741074f},
-std::array<float,2>{0.921975076f, 0.538349628f},
-std::array<float,2>{0.0581342429f, 0.264868379f},
-std::array<float,2>{0.340797335f, 0.825853527f},
-std::array<float,2>{0.544403195f, 0.10461951f},
-std::array<float,2>{0.644206941f, 0.905232608f},
-std::array<float,2>{0.499801189f, 0.159377813f},
-std::array<float,2>{0.201941669f, 0.703052044f},
-std::array<float,2>{0.761693776f, 0.422399044f},
-std::array<float,2>{0.959219575f, 0.980056167f},
-std::array<float,2>{0.109082699f, 0.204950124f},
-std::array<float,2>{0.264224023f, 0.647849262f},
-std::array<float,2>{0.584154844f, 0.466212511f},
-std::array<float,2>{0.696530163f, 0.607084513f},
-std::array<float,2>{0.433191776f, 0.354586869f},
-std::array<float,2>{0.146060541f, 0.805207193f},
-std::array<float,2>{0.843627989f, 0.0210852586f},
-std::array<float,2>{0.781638205f, 0.749719441f},
-std::array<float,2>{0.220808253f, 0.377706438f},
-std::array<float,2>{0.44981131f, 0.917638242f},
-std::array<float,2>{0.681561589f, 0.151669219f},
-std::array<float,2>{0.520757794f, 0.865308046f},
-std::array<float,2>{0.357133359f, 0.0740993321f},
-std::array<float,2>{0.00283027533f, 0.50083524f},
-std::array<float,2>{0.897015035f, 0.283062786f},
-std::array<float,2>{0.886954725f, 0.832505703f},
-std::array<float,2>{0.0258030221f, 0.118869565f},
-std::array<float,2>{0.360930234f, 0.547959924f},
-std::array<float,2>{0.500682116f, 0.27163595f},
-std::array<float,2>{0.663474858f, 0.710048139f},
-std::array<float,2>{0.457358152f, 0.410822928f},
-std::array<float,2>{0.248575613f, 0.889720798f},
-std::array<float,2>{0.797417998f, 0.173688367f},
-std::array<float,2>{0.816648543f, 0.56610316f},
-std::array<float,2>{0.127557695f, 0.331686825f},
-std::array<float,2>{0.408912808f, 0.77532351f},
-std::array<float,2>{0.705324471f, 0.0499720238f},
-std::array<float,2>{0.566740751f, 0.954962909f},
-std::array<float,2>{0.280520946f, 0.222942904f},
-std::array<float,2>{0.114184923f, 0.657910526f},
-std::array<float,2>{0.947211981f, 0.46977675f},
-std::array<float,2>{0.780028939f, 0.927833438f},
-std::array<float,2>{0.20986104f, 0.130956337f},
-std::array<float,2>{0.481038064f, 0.721494079f},
-std::array<float,2>{0.627554059f, 0.391263366f},
-std::array<float,2>{0.560682416f, 0.519783497f},
-std::array<float,2>{0.323158175f, 0.308800966f},
-std::array<float,2>{0.0375968106f, 0.844843984f},
-std::array<float,2>{0.919951439f, 0.0821013004f},
-std::array<float,2>{0.995191455f, 0.640367508f},
-std::array<float,2>{0.0743383318f, 0.450841248f},
-std::array<float,2>{0.293801755f, 0.99892205f},
-std::array<float,2>{0.59507519f, 0.201667964f},
-std::array<float,2>{0.730200648f, 0.793427408f},
-std::array<float,2>{0.396587312f, 0.0114603546f},
-std::array<float,2>{0.168343335f, 0.616949081f},
-std::array<float,2>{0.848609149f, 0.367182344f},
-std::array<float,2>{0.820693076f, 0.82343626f},
-std::array<float,2>{0.133590773f, 0.108416714f},
-std::array<float,2>{0.417686254f, 0.531779587f},
-std::array<float,2>{0.717039526f, 0.260822505f},
-std::array<float,2>{0.577400029f, 0.69685483f},
-std::array<float,2>{0.266986489f, 0.426685333f},
-std::array<float,2>{0.11817605f, 0.900352657f},
-std::array<float,2>{0.945001721f, 0.160431564f},
-std::array<float,2>{0.881987333f, 0.584726751f},
-std::array<float,2>{0.0180389788f, 0.319075257f},
-std::array<float,2>{0.368220866f, 0.753272772f},
-std::array<float,2>{0.511166215f, 0.0324346349f},
-std::array<float,2>{0.671816587f, 0.942738593f},
-std::array<float,2>{0.467711568f, 0.235740215f},
-std::array<float,2>{0.237566128f, 0.67820859f},
-std::array<float,2>{0.811865449f, 0.495832592f},
-std::array<float,2>{0.985506535f, 0.919369102f},
-std::array<float,2>{0.0661579892f, 0.153400943f},
-std::array<float,2>{0.28306365f, 0.745523512f},
-std::array<float,2>{0.608450472f, 0.379739523f},
-std::array<float,2>{0.724373758f, 0.504337966f},
-std::array<float,2>{0.398454458f, 0.288857281f},
-std::array<float,2>{0.15759331f, 0.861929297f},
-std::array<float,2>{0.858643651f, 0.0742549077f},
-std::array<float,2>{0.769227743f, 0.643055081f},
-std::array<float,2>{0.21462141f, 0.461129725f},
-std::array<float,2>{0.469140857f, 0.983210087f},
-std::array<float,2>{0.637299538f, 0.209323868f},
-std::array<float,2>{0.550797522f, 0.810206532f},
-std::array<float,2>{0.31406185f, 0.0182772707f},
-std::array<float,2>{0.0414718986f, 0.603424907f},
-std::array<float,2>{0.910362184f, 0.358781666f},
-std::array<float,2>{0.934575737f, 0.780204535f},
-std::array<float,2>{0.0495675988f, 0.0522113293f},
-std::array<float,2>{0.33252725f, 0.569943786f},
-std::array<float,2>{0.533317089f, 0.333462864f},
-std::array<float,2>{0.648739815f, 0.662394166f},
-std::array<float,2>{0.490717053f, 0.472823858f},
-std::array<float,2>{0.192564368f, 0.957378089f},
-std::array<float,2>{0.754530251f, 0.221471861f},
-std::array<float,2>{0.866038263f, 0.553578079f},
-std::array<float,2>{0.185794443f, 0.269423336f},
-std::array<float,2>{0.381276339f, 0.82847631f},
-std::array<float,2>{0.742672324f, 0.122970626f},
-std::array<float,2>{0.614478052f, 0.886246502f},
-std::array<float,2>{0.301670432f, 0.179287776f},
-std::array<float,2>{0.0837106407f, 0.706999898f},
-std::array<float,2>{0.969143629f, 0.407743692f},
-std::array<float,2>{0.795439184f, 0.993095219f},
-std::array<float,2>{0.23149693f, 0.196042031f},
-std::array<float,2>{0.441793293f, 0.636219561f},
-std::array<float,2>{0.676974416f, 0.446518362f},
-std::array<float,2>{0.529093385f, 0.610914826f},
-std::array<float,2>{0.351235628f, 0.362338334f},
-std::array<float,2>{0.0123228831f, 0.791914105f},
-std::array<float,2>{0.901198208f, 0.0152112469f},
-std::array<float,2>{0.961348951f, 0.72487849f},
-std::array<float,2>{0.100105159f, 0.396190345f},
-std::array<float,2>{0.252047747f, 0.925720274f},
-std::array<float,2>{0.590726972f, 0.128276899f},
-std::array<float,2>{0.692601144f, 0.850683331f},
-std::array<float,2>{0.427944571f, 0.079281345f},
-std::array<float,2>{0.153076172f, 0.516330481f},
-std::array<float,2>{0.828415155f, 0.304973334f},
-std::array<float,2>{0.762971222f, 0.786588907f},
-std::array<float,2>{0.197702125f, 0.00765926205f},
-std::array<float,2>{0.493698865f, 0.621609628f},
-std::array<float,2>{0.647233069f, 0.37176609f},
-std::array<float,2>{0.542918801f, 0.629767537f},
-std::array<float,2>{0.33629787f, 0.438196272f},
-std::array<float,2>{0.0624828488f, 0.991879106f},
-std::array<float,2>{0.929374993f, 0.187894881f},
-std::array<float,2>{0.9842242f, 0.528183579f},
-std::array<float,2>{0.0922811255f, 0.301628441f},
-std::array<float,2>{0.307358623f, 0.853695393f},
-std::array<float,2>{0.619278789f, 0.086801067f},
-std::array<float,2>{0.74056232f, 0.936282814f},
-std::array<float,2>{0.383906007f, 0.140360489f},
-std::array<float,2>{0.175466523f, 0.731024384f},
-std::array<float,2>{0.871293247f, 0.40440762f},
-std::array<float,2>{0.891630173f, 0.967952728f},
-std::array<float,2>{0.00452017365f, 0.233011439f},
-std::array<float,2>{0.355249226f, 0.666167915f},
-std::array<float,2>{0.516088247f, 0.481624395f},
-std::array<float,2>{0.684997618f, 0.571112931f},
-std::array<float,2>{0.448067158f, 0.343693256f},
-std::array<float,2>{0.225657329f, 0.77079308f},
-std::array<float,2>{0.787577868f, 0.0608006082f},
-std::array<float,2>{0.839440882f, 0.718488812f},
-std::array<float,2>{0.144173577f, 0.416644782f},
-std::array<float,2>{0.436458588f, 0.877488077f},
-std::array<float,2>{0.700624764f, 0.180485517f},
-std::array<float,2>{0.578200758f, 0.842552781f},
-std::array<float,2>{0.260287613f, 0.115033232f},
-std::array<float,2>{0.102871418f, 0.557033658f},
-std::array<float,2>{0.955580175f, 0.280745864f},
-std::array<float,2>{0.951206267f, 0.869557381f},
-std::array<float,2>{0.11017742f, 0.0685634688f},
-std::array<float,2>{0.273795247f, 0.51440239f},
-std::array<float,2>{0.563049972f, 0.291347295f},
-std::array<float,2>{0.710231245f, 0.735863864f},
-std::array<float,2>{0.412665874f, 0.383461118f},
-std::array<float,2>{0.131083161f, 0.908431113f},
-std::array<float,2>{0.814674497f, 0.146549687f},
-std::array<float,2>{0.803354383f, 0.59596175f},
-std::array<float,2>{0.245766521f, 0.345170677f},
-std::array<float,2>{0.454121321f, 0.804514229f},
-std::array<float,2>{0.658305109f, 0.0274414737f},
-std::array<float,2>{0.504980564f, 0.974426389f},
-std::array<float,2>{0.367172152f, 0.218539014f},
-std::array<float,2>{0.0275795795f, 0.652195513f},
-std::array<float,2>{0.883641005f, 0.454689234f},
-std::array<float,2>{0.846481621f, 0.897171915f},
-std::array<float,2>{0.166424468f, 0.169415802f},
-std::array<float,2>{0.392160058f, 0.688064516f},
-std::array<float,2>{0.731395543f, 0.436790198f},
-std::array<float,2>{0.601321101f, 0.541710556f},
-std::array<float,2>{0.290450752f, 0.256774485f},
-std::array<float,2>{0.0712354258f, 0.815021276f},
-std::array<float,2>{0.999424219f, 0.100690983f},
-std::array<float,2>{0.915450394f, 0.683622539f},
-std::array<float,2>{0.0331517868f, 0.488055825f},
-std::array<float,2>{0.327167213f, 0.946104705f},
-std::array<float,2>{0.55563736f, 0.247410163f},
-std::array<float,2>{0.631500661f, 0.765025198f},
-std::array<float,2>{0.479478151f, 0.0446444228f},
-std::array<float,2>{0.205511868f, 0.590411842f},
-std::array<float,2>{0.774309337f, 0.325680643f},
-std::array<float,2>{0.766135335f, 0.862396061f},
-std::array<float,2>{0.211919233f, 0.0759285763f},
-std::array<float,2>{0.471471101f, 0.505052567f},
-std::array<float,2>{0.640384972f, 0.287605107f},
-std::array<float,2>{0.553206682f, 0.74495703f},
-std::array<float,2>{0.314968497f, 0.380626678f},
-std::array<float,2>{0.0397422165f, 0.91871357f},
-std::array<float,2>{0.912593544f, 0.15307422f},
-std::array<float,2>{0.987323523f, 0.6018188f},
-std::array<float,2>{0.0626754537f, 0.358079433f},
-std::array<float,2>{0.283974975f, 0.808889508f},
-std::array<float,2>{0.606615841f, 0.0188885126f},
-std::array<float,2>{0.72569555f, 0.983747602f},
-std::array<float,2>{0.401609987f, 0.210599586f},
-std::array<float,2>{0.15894267f, 0.644241989f},
-std::array<float,2>{0.855988562f, 0.4623954f},
-std::array<float,2>{0.87895298f, 0.898963809f},
-std::array<float,2>{0.0172390081f, 0.161229208f},
-std::array<float,2>{0.37072584f, 0.695684314f},
-std::array<float,2>{0.508064151f, 0.427668244f},
-std::array<float,2>{0.669919789f, 0.532793105f},
-std::array<float,2>{0.465446293f, 0.260291219f},
-std::array<float,2>{0.235340148f, 0.823114038f},
-std::array<float,2>{0.808827162f, 0.107567243f},
-std::array<float,2>{0.822982252f, 0.679636359f},
-std::array<float,2>{0.136154473f, 0.494916707f},
-std::array<float,2>{0.415511727f, 0.94160676f},
-std::array<float,2>{0.716171801f, 0.23481892f},
-std::array<float,2>{0.574242115f, 0.752083838f},
-std::array<float,2>{0.26841414f, 0.0321180299f},
-std::array<float,2>{0.120343097f, 0.585616171f},
-std::array<float,2>{0.94213897f, 0.319725364f},
-std::array<float,2>{0.964758635f, 0.792588055f},
-std::array<float,2>{0.0985837504f, 0.0140935192f},
-std::array<float,2>{0.25139156f, 0.609501541f},
-std::array<float,2>{0.592200756f, 0.36200729f},
-std::array<float,2>{0.693381131f, 0.635354936f},
-std::array<float,2>{0.425925046f, 0.445662886f},
-std::array<float,2>{0.155440778f, 0.993686438f},
-std::array<float,2>{0.831100106f, 0.196873814f},
-std::array<float,2>{0.793078721f, 0.517530859f},
-std::array<float,2>{0.234198183f, 0.306601167f},
-std::array<float,2>{0.444348931f, 0.84971261f},
-std::array<float,2>{0.678084612f, 0.0790606663f},
-std::array<float,2>{0.530884743f, 0.923894286f},
-std::array<float,2>{0.348894536f, 0.127197549f},
-std::array<float,2>{0.0146659371f, 0.726060808f},
-std::array<float,2>{0.899805367f, 0.395051539f},
-std::array<float,2>{0.864337385f, 0.958118856f},
-std::array<float,2>{0.184227243f, 0.222157001f},
-std::array<float,2>{0.37919724f, 0.66320473f},
-std::array<float,2>{0.744375587f, 0.473798573f},
-std::array<float,2>{0.615544856f, 0.56882894f},
-std::array<float,2>{0.304108739f, 0.332034051f},
-std::array<float,2>{0.0843840688f, 0.780286551f},
-std::array<float,2>{0.972136617f, 0.0513943322f},
-std::array<float,2>{0.937281191f, 0.705652595f},
-std::array<float,2>{0.0474220663f, 0.406524867f},
-std::array<float,2>{0.335579902f, 0.885601521f},
-std::array<float,2>{0.531935751f, 0.177845582f},
-std::array<float,2>{0.651300907f, 0.829896152f},
-std::array<float,2>{0.490136027f, 0.121894605f},
-std::array<float,2>{0.193520188f, 0.554378927f},
-std::array<float,2>{0.756810248f, 0.267850697f},
-std::array<float,2>{0.836708724f, 0.77001673f},
-std::array<float,2>{0.142511874f, 0.0615633577f},
-std::array<float,2>{0.434660256f, 0.572062075f},
-std::array<float,2>{0.701548815f, 0.34207952f},
-std::array<float,2>{0.581831574f, 0.667183042f},
-std::array<float,2>{0.258955598f, 0.48142302f},
-std::array<float,2>{0.105017386f, 0.967031598f},
-std::array<float,2>{0.954214215f, 0.234030351f},
-std::array<float,2>{0.894256592f, 0.558390319f},
-std::array<float,2>{0.0072098216f, 0.280061305f},
-std::array<float,2>{0.35221234f, 0.842807651f},
-std::array<float,2>{0.518637955f, 0.114239089f},
-std::array<float,2>{0.686817646f, 0.878071129f},
-std::array<float,2>{0.445943713f, 0.180856228f},
-std::array<float,2>{0.222818434f, 0.717461407f},
-std::array<float,2>{0.786785483f, 0.417862147f},
-std::array<float,2>{0.98093611f, 0.990367293f},
-std::array<float,2>{0.0901452377f, 0.188759387f},
-std::array<float,2>{0.306360662f, 0.630472779f},
-std::array<float,2>{0.618371665f, 0.43928501f},
-std::array<float,2>{0.739964604f, 0.622641444f},
-std::array<float,2>{0.386022896f, 0.372906834f},
-std::array<float,2>{0.17310831f, 0.785407305f},
-std::array<float,2>{0.874917924f, 0.006581489f},
-std::array<float,2>{0.765250206f, 0.732332349f},
-std::array<float,2>{0.196867555f, 0.405589968f},
-std::array<float,2>{0.495994359f, 0.936945319f},
-std::array<float,2>{0.645519674f, 0.139027968f},
-std::array<float,2>{0.539209962f, 0.8549335f},
-std::array<float,2>{0.339774072f, 0.0872110203f},
-std::array<float,2>{0.0595689081f, 0.528352737f},
-std::array<float,2>{0.926241338f, 0.302161276f},
-std::array<float,2>{0.917212665f, 0.815582275f},
-std::array<float,2>{0.0334477872f, 0.100136988f},
-std::array<float,2>{0.325149864f, 0.54245913f},
-std::array<float,2>{0.558030725f, 0.257006675f},
-std::array<float,2>{0.629746377f, 0.689326763f},
-std::array<float,2>{0.477215499f, 0.435652941f},
-std::array<float,2>{0.204931885f, 0.897468567f},
-std::array<float,2>{0.776015401f, 0.168575928f},
-std::array<float,2>{0.84466517f, 0.591568112f},
-std::array<float,2>{0.165345401f, 0.324984938f},
-std::array<float,2>{0.392667562f, 0.764191449f},
-std::array<float,2>{0.734269679f, 0.0438470133f},
-std::array<float,2>{0.59909451f, 0.946335018f},
-std::array<float,2>{0.291546881f, 0.246842831f},
-std::array<float,2>{0.0736001655f, 0.684885621f},
-std::array<float,2>{0.997742832f, 0.487261742f},
-std::array<float,2>{0.801929593f, 0.909284949f},
-std::array<float,2>{0.243562177f, 0.147955492f},
-std::array<float,2>{0.455265999f, 0.735327005f},
-std::array<float,2>{0.656996667f, 0.383881092f},
-std::array<float,2>{0.506735802f, 0.514703155f},
-std::array<float,2>{0.364989489f, 0.292737991f},
-std::array<float,2>{0.0310266782f, 0.870480955f},
-std::array<float,2>{0.886607051f, 0.0695387945f},
-std::array<float,2>{0.950971425f, 0.651364267f},
-std::array<float,2>{0.112206027f, 0.453710586f},
-std::array<float,2>{0.27647832f, 0.972996354f},
-std::array<float,2>{0.564932823f, 0.216956839f},
-std::array<float,2>{0.708461761f, 0.803240001f},
-std::array<float,2>{0.411997885f, 0.0290986206f},
-std::array<float,2>{0.130023718f, 0.597559214f},
-std::array<float,2>{0.813100994f, 0.343922943f},
-std::array<float,2>{0.854696155f, 0.837165534f},
-std::array<float,2>{0.163891062f, 0.112170137f},
-std::array<float,2>{0.405567855f, 0.561808288f},
-std::array<float,2>{0.721727431f, 0.276775986f},
-std::array<float,2>{0.603134274f, 0.712223649f},
-std::array<float,2>{0.287050337f, 0.41916886f},
-std::array<float,2>{0.0675729141f, 0.880011082f},
-std::array<float,2>{0.990351081f, 0.185735479f},
-std::array<float,2>{0.90892911f, 0.575749278f},
-std::array<float,2>{0.0450455733f, 0.337122947f},
-std::array<float,2>{0.317278802f, 0.767778575f},
-std::array<float,2>{0.550535083f, 0.0569103546f},
-std::array<float,2>{0.633251071f, 0.961460471f},
-std::array<float,2>{0.475648254f, 0.23021324f},
-std::array<float,2>{0.215858921f, 0.668895423f},
-std::array<float,2>{0.772194386f, 0.477106154f},
-std::array<float,2>{0.939369857f, 0.929869652f},
-std::array<float,2>{0.122083053f, 0.134879589f},
-std::array<float,2>{0.272751719f, 0.726671994f},
-std::array<float,2>{0.573747337f, 0.399126351f},
-std::array<float,2>{0.711346328f, 0.525000751f},
-std::array<float,2>{0.42138651f, 0.300619513f},
-std::array<float,2>{0.138524756f, 0.859217107f},
-std::array<float,2>{0.826154709f, 0.0913512185f},
-std::array<float,2>{0.808356822f, 0.626364768f},
-std::array<float,2>{0.240880057f, 0.444035679f},
-std::array<float,2>{0.463887781f, 0.984852672f},
-std::array<float,2>{0.664173961f, 0.19306232f},
-std::array<float,2>{0.512043715f, 0.784751534f},
-std::array<float,2>{0.373984963f, 0.0018363389f},
-std::array<float,2>{0.0229346901f, 0.619420469f},
-std::array<float,2>{0.877441168f, 0.368785143f},
-std::array<float,2>{0.904976904f, 0.759793699f},
-std::array<float,2>{0.0100683244f, 0.0407622345f},
-std::array<float,2>{0.345095456f, 0.589385271f},
-std::array<float,2>{0.523869395f, 0.323377579f},
-std::array<float,2>{0.672991514f, 0.68083936f},
-std::array<float,2>{0.441168308f, 0.492079765f},
-std::array<float,2>{0.229742765f, 0.950876117f},
-std::array<float,2>{0.790153563f, 0.242353961f},
-std::array<float,2>{0.832087338f, 0.543908238f},
-std::array<float,2>{0.148761928f, 0.251573503f},
-std::array<float,2>{0.423936754f, 0.818493187f},
-std::array<float,2>{0.68936497f, 0.0942797363f},
-std::array<float,2>{0.586761355f, 0.893475354f},
-std::array<float,2>{0.255619258f, 0.165285334f},
-std::array<float,2>{0.0960379913f, 0.692554712f},
-std::array<float,2>{0.967021585f, 0.432605833f},
-std::array<float,2>{0.752523243f, 0.97047776f},
-std::array<float,2>{0.188069761f, 0.212821782f},
-std::array<float,2>{0.488131404f, 0.654174745f},
-std::array<float,2>{0.6559093f, 0.457554877f},
-std::array<float,2>{0.535767257f, 0.600494146f},
-std::array<float,2>{0.331036299f, 0.351028562f},
-std::array<float,2>{0.0524130873f, 0.799226105f},
-std::array<float,2>{0.93188411f, 0.0261446871f},
-std::array<float,2>{0.976273358f, 0.741245151f},
-std::array<float,2>{0.080073908f, 0.389293045f},
-std::array<float,2>{0.297637999f, 0.912373066f},
-std::array<float,2>{0.613057733f, 0.140740961f},
-std::array<float,2>{0.74901408f, 0.874052107f},
-std::array<float,2>{0.377452731f, 0.0662936866f},
-std::array<float,2>{0.180145785f, 0.510958672f},
-std::array<float,2>{0.862658083f, 0.29412356f},
-std::array<float,2>{0.784242511f, 0.806121647f},
-std::array<float,2>{0.219577089f, 0.0197116565f},
-std::array<float,2>{0.452322125f, 0.605795741f},
-std::array<float,2>{0.682366908f, 0.354025483f},
-std::array<float,2>{0.523336351f, 0.646529615f},
-std::array<float,2>{0.358318478f, 0.464988202f},
-std::array<float,2>{0.000621395477f, 0.979105353f},
-std::array<float,2>{0.896276414f, 0.203618735f},
-std::array<float,2>{0.95794338f, 0.501180351f},
-std::array<float,2>{0.106967352f, 0.282193035f},
-std::array<float,2>{0.263125986f, 0.866714537f},
-std::array<float,2>{0.582856417f, 0.072743915f},
-std::array<float,2>{0.698553562f, 0.916888177f},
-std::array<float,2>{0.430245906f, 0.151079908f},
-std::array<float,2>{0.147846863f, 0.748133898f},
-std::array<float,2>{0.840928018f, 0.378630698f},
-std::array<float,2>{0.924256563f, 0.938414574f},
-std::array<float,2>{0.0558554828f, 0.241521567f},
-std::array<float,2>{0.343718469f, 0.672982454f},
-std::array<float,2>{0.546438694f, 0.496909142f},
-std::array<float,2>{0.6424734f, 0.580289483f},
-std::array<float,2>{0.49765861f, 0.313328117f},
-std::array<float,2>{0.200069577f, 0.755105615f},
-std::array<float,2>{0.758084536f, 0.0366634056f},
-std::array<float,2>{0.868046463f, 0.701857686f},
-std::array<float,2>{0.179130271f, 0.422971994f},
-std::array<float,2>{0.388661176f, 0.905801296f},
-std::array<float,2>{0.735961318f, 0.158745125f},
-std::array<float,2>{0.621265292f, 0.825027347f},
-std::array<float,2>{0.309479952f, 0.104379825f},
-std::array<float,2>{0.0883424431f, 0.537342787f},
-std::array<float,2>{0.979130447f, 0.264414966f},
-std::array<float,2>{0.992738903f, 0.844338119f},
-std::array<float,2>{0.07791619f, 0.0836605132f},
-std::array<float,2>{0.295821756f, 0.520848989f},
-std::array<float,2>{0.596295774f, 0.310099244f},
-std::array<float,2>{0.72716862f, 0.72217679f},
-std::array<float,2>{0.396200567f, 0.392334491f},
-std::array<float,2>{0.170385495f, 0.929373264f},
-std::array<float,2>{0.849721014f, 0.132326677f},
-std::array<float,2>{0.778329968f, 0.615246296f},
-std::array<float,2>{0.208979562f, 0.365930051f},
-std::array<float,2>{0.483928114f, 0.794812083f},
-std::array<float,2>{0.625649452f, 0.010162103f},
-std::array<float,2>{0.559392214f, 0.999403059f},
-std::array<float,2>{0.32179606f, 0.202463314f},
-std::array<float,2>{0.035483636f, 0.639118195f},
-std::array<float,2>{0.919501126f, 0.449616432f},
-std::array<float,2>{0.820013463f, 0.888891101f},
-std::array<float,2>{0.125070035f, 0.172672421f},
-std::array<float,2>{0.407572538f, 0.709598362f},
-std::array<float,2>{0.70396328f, 0.411359489f},
-std::array<float,2>{0.568901062f, 0.546932042f},
-std::array<float,2>{0.277661324f, 0.272829175f},
-std::array<float,2>{0.115495935f, 0.833505154f},
-std::array<float,2>{0.948924959f, 0.11718978f},
-std::array<float,2>{0.889360368f, 0.656602085f},
-std::array<float,2>{0.0236420967f, 0.468889326f},
-std::array<float,2>{0.361624122f, 0.95340842f},
-std::array<float,2>{0.502455235f, 0.224340305f},
-std::array<float,2>{0.661750019f, 0.773649037f},
-std::array<float,2>{0.460502774f, 0.0497968756f},
-std::array<float,2>{0.246610865f, 0.565263331f},
-std::array<float,2>{0.80049485f, 0.330286115f},
-std::array<float,2>{0.811710119f, 0.821615577f},
-std::array<float,2>{0.237448752f, 0.107411206f},
-std::array<float,2>{0.467316568f, 0.533333063f},
-std::array<float,2>{0.671416461f, 0.258284748f},
-std::array<float,2>{0.510857582f, 0.697874904f},
-std::array<float,2>{0.36855489f, 0.427820444f},
-std::array<float,2>{0.0177657455f, 0.902048349f},
-std::array<float,2>{0.882114112f, 0.162523612f},
-std::array<float,2>{0.945294857f, 0.583210111f},
-std::array<float,2>{0.118646465f, 0.317406088f},
-std::array<float,2>{0.266649574f, 0.75056231f},
-std::array<float,2>{0.577361166f, 0.0340189561f},
-std::array<float,2>{0.717088938f, 0.9451738f},
-std::array<float,2>{0.417882532f, 0.237725809f},
-std::array<float,2>{0.133500695f, 0.677107096f},
-std::array<float,2>{0.820479929f, 0.49332276f},
-std::array<float,2>{0.910512924f, 0.921590567f},
-std::array<float,2>{0.0411425792f, 0.154469684f},
-std::array<float,2>{0.31423068f, 0.742530406f},
-std::array<float,2>{0.551026464f, 0.382667929f},
-std::array<float,2>{0.637500286f, 0.506005287f},
-std::array<float,2>{0.468793929f, 0.286999255f},
-std::array<float,2>{0.214384809f, 0.85990262f},
-std::array<float,2>{0.769360065f, 0.0779993609f},
-std::array<float,2>{0.858459055f, 0.641357124f},
-std::array<float,2>{0.157440126f, 0.463624418f},
-std::array<float,2>{0.398690194f, 0.981204689f},
-std::array<float,2>{0.72433871f, 0.208725139f},
-std::array<float,2>{0.608815551f, 0.81072998f},
-std::array<float,2>{0.282940209f, 0.0161497835f},
-std::array<float,2>{0.0664007738f, 0.604290903f},
-std::array<float,2>{0.985738516f, 0.356725603f},
-std::array<float,2>{0.968851149f, 0.777535379f},
-std::array<float,2>{0.0838127509f, 0.0540723093f},
-std::array<float,2>{0.301367968f, 0.567931056f},
-std::array<float,2>{0.614705682f, 0.334632427f},
-std::array<float,2>{0.742269337f, 0.661720932f},
-std::array<float,2>{0.381087959f, 0.474619627f},
-std::array<float,2>{0.185577363f, 0.959034264f},
-std::array<float,2>{0.865878105f, 0.21886389f},
-std::array<float,2>{0.754736185f, 0.552220762f},
-std::array<float,2>{0.19284825f, 0.267184168f},
-std::array<float,2>{0.490363359f, 0.831822038f},
-std::array<float,2>{0.648656368f, 0.123530328f},
-std::array<float,2>{0.533569396f, 0.884322524f},
-std::array<float,2>{0.332823038f, 0.176277518f},
-std::array<float,2>{0.0494814329f, 0.704876304f},
-std::array<float,2>{0.934863508f, 0.408906639f},
-std::array<float,2>{0.828178346f, 0.994349301f},
-std::array<float,2>{0.152915612f, 0.198136747f},
-std::array<float,2>{0.428021163f, 0.634036779f},
-std::array<float,2>{0.69276166f, 0.449043721f},
-std::array<float,2>{0.590459347f, 0.613154769f},
-std::array<float,2>{0.252408743f, 0.359915972f},
-std::array<float,2>{0.100491241f, 0.790759146f},
-std::array<float,2>{0.961045086f, 0.0123508126f},
-std::array<float,2>{0.900918186f, 0.724471688f},
-std::array<float,2>{0.0125213517f, 0.396531045f},
-std::array<float,2>{0.351326585f, 0.923088729f},
-std::array<float,2>{0.528902769f, 0.125817478f},
-std::array<float,2>{0.677228749f, 0.848547161f},
-std::array<float,2>{0.441548824f, 0.0803980008f},
-std::array<float,2>{0.231785476f, 0.517837644f},
-std::array<float,2>{0.795658588f, 0.3080661f},
-std::array<float,2>{0.871344209f, 0.787542462f},
-std::array<float,2>{0.175607815f, 0.00549247628f},
-std::array<float,2>{0.384143233f, 0.624582827f},
-std::array<float,2>{0.740318f, 0.373280287f},
-std::array<float,2>{0.619586766f, 0.632559359f},
-std::array<float,2>{0.307490408f, 0.440367758f},
-std::array<float,2>{0.091994971f, 0.989766598f},
-std::array<float,2>{0.983978629f, 0.18992804f},
-std::array<float,2>{0.929500759f, 0.529758751f},
-std::array<float,2>{0.0622492395f, 0.302871823f},
-std::array<float,2>{0.336123735f, 0.852248669f},
-std::array<float,2>{0.542520225f, 0.0888763517f},
-std::array<float,2>{0.647079825f, 0.935337007f},
-std::array<float,2>{0.494107753f, 0.138631836f},
-std::array<float,2>{0.197419271f, 0.733542442f},
-std::array<float,2>{0.762874961f, 0.404087871f},
-std::array<float,2>{0.956000149f, 0.965343297f},
-std::array<float,2>{0.102641575f, 0.231752634f},
-std::array<float,2>{0.260731101f, 0.664541662f},
-std::array<float,2>{0.578371525f, 0.484297335f},
-std::array<float,2>{0.700380027f, 0.573509634f},
-std::array<float,2>{0.436035782f, 0.341138512f},
-std::array<float,2>{0.1445124f, 0.771682918f},
-std::array<float,2>{0.839660108f, 0.0594783314f},
-std::array<float,2>{0.787166834f, 0.716767013f},
-std::array<float,2>{0.226067275f, 0.41411531f},
-std::array<float,2>{0.447946697f, 0.875367224f},
-std::array<float,2>{0.684593976f, 0.182584763f},
-std::array<float,2>{0.515812874f, 0.840766847f},
-std::array<float,2>{0.355176985f, 0.115292177f},
-std::array<float,2>{0.00481631001f, 0.555699646f},
-std::array<float,2>{0.89208138f, 0.277473897f},
-std::array<float,2>{0.883461237f, 0.86753577f},
-std::array<float,2>{0.0277268197f, 0.0673480853f},
-std::array<float,2>{0.366777211f, 0.513378918f},
-std::array<float,2>{0.505164087f, 0.290897936f},
-std::array<float,2>{0.658523679f, 0.737619936f},
-std::array<float,2>{0.454526365f, 0.38643834f},
-std::array<float,2>{0.245886534f, 0.907417536f},
-std::array<float,2>{0.803710103f, 0.145581633f},
-std::array<float,2>{0.81474781f, 0.595017254f},
-std::array<float,2>{0.131121591f, 0.347501963f},
-std::array<float,2>{0.412863225f, 0.801571488f},
-std::array<float,2>{0.709973574f, 0.0310596786f},
-std::array<float,2>{0.563439429f, 0.976119816f},
-std::array<float,2>{0.273619533f, 0.215888187f},
-std::array<float,2>{0.109908141f, 0.648717761f},
-std::array<float,2>{0.951636672f, 0.456417799f},
-std::array<float,2>{0.774045408f, 0.894535542f},
-std::array<float,2>{0.205139354f, 0.170706034f},
-std::array<float,2>{0.479097635f, 0.691136241f},
-std::array<float,2>{0.631667078f, 0.43418479f},
-std::array<float,2>{0.555330455f, 0.539820492f},
-std::array<float,2>{0.327457458f, 0.254267782f},
-std::array<float,2>{0.0327359997f, 0.813756645f},
-std::array<float,2>{0.915225506f, 0.0994266719f},
-std::array<float,2>{0.999173045f, 0.685846329f},
-std::array<float,2>{0.0709268078f, 0.486126006f},
-std::array<float,2>{0.290242016f, 0.949091315f},
-std::array<float,2>{0.601130366f, 0.249278501f},
-std::array<float,2>{0.731010079f, 0.762935281f},
-std::array<float,2>{0.392528862f, 0.0454095155f},
-std::array<float,2>{0.166175842f, 0.593604386f},
-std::array<float,2>{0.846393526f, 0.327031821f},
-std::array<float,2>{0.827659011f, 0.855681121f},
-std::array<float,2>{0.139463589f, 0.0923478156f},
-std::array<float,2>{0.41963172f, 0.527008832f},
-std::array<float,2>{0.714111686f, 0.297819436f},
-std::array<float,2>{0.570828795f, 0.729737878f},
-std::array<float,2>{0.270202786f, 0.401699454f},
-std::array<float,2>{0.124270931f, 0.932164073f},
-std::array<float,2>{0.94025892f, 0.132985428f},
-std::array<float,2>{0.875677645f, 0.617262721f},
-std::array<float,2>{0.0213681553f, 0.36940971f},
-std::array<float,2>{0.372303039f, 0.781866968f},
-std::array<float,2>{0.515426636f, 0.00251825363f},
-std::array<float,2>{0.667812526f, 0.988022089f},
-std::array<float,2>{0.462330639f, 0.194031909f},
-std::array<float,2>{0.238541588f, 0.628200889f},
-std::array<float,2>{0.805906415f, 0.442717552f},
-std::array<float,2>{0.988910615f, 0.881295979f},
-std::array<float,2>{0.0702779815f, 0.185210913f},
-std::array<float,2>{0.288062453f, 0.713926435f},
-std::array<float,2>{0.604682386f, 0.420582473f},
-std::array<float,2>{0.720078707f, 0.560332716f},
-std::array<float,2>{0.404080182f, 0.273963541f},
-std::array<float,2>{0.16048272f, 0.838953197f},
-std::array<float,2>{0.853287876f, 0.111237057f},
-std::array<float,2>{0.770220518f, 0.671394348f},
-std::array<float,2>{0.21736601f, 0.479674518f},
-std::array<float,2>{0.474407226f, 0.96439153f},
-std::array<float,2>{0.635713995f, 0.227867365f},
-std::array<float,2>{0.548063576f, 0.765893579f},
-std::array<float,2>{0.319295198f, 0.0551121272f},
-std::array<float,2>{0.0434875451f, 0.577901602f},
-std::array<float,2>{0.907895386f, 0.338857293f},
-std::array<float,2>{0.930432737f, 0.797597408f},
-std::array<float,2>{0.0529739149f, 0.0245870668f},
-std::array<float,2>{0.328979701f, 0.599166691f},
-std::array<float,2>{0.538239479f, 0.349459708f},
-std::array<float,2>{0.654088557f, 0.655112326f},
-std::array<float,2>{0.484570563f, 0.460922956f},
-std::array<float,2>{0.190082416f, 0.970710158f},
-std::array<float,2>{0.750514507f, 0.213499263f},
-std::array<float,2>{0.860652387f, 0.50902611f},
-std::array<float,2>{0.181819484f, 0.295379549f},
-std::array<float,2>{0.375331402f, 0.872828722f},
-std::array<float,2>{0.747440994f, 0.0627927333f},
-std::array<float,2>{0.611264884f, 0.910471916f},
-std::array<float,2>{0.299033254f, 0.143037021f},
-std::array<float,2>{0.0809572488f, 0.738296151f},
-std::array<float,2>{0.974084914f, 0.388011277f},
-std::array<float,2>{0.792881727f, 0.952373922f},
-std::array<float,2>{0.227122709f, 0.245681301f},
-std::array<float,2>{0.43774116f, 0.682983875f},
-std::array<float,2>{0.675575018f, 0.488519073f},
-std::array<float,2>{0.525802553f, 0.586878061f},
-std::array<float,2>{0.34605363f, 0.321824312f},
-std::array<float,2>{0.00821723137f, 0.758629918f},
-std::array<float,2>{0.903671622f, 0.042256359f},
-std::array<float,2>{0.964858651f, 0.695132732f},
-std::array<float,2>{0.0938109457f, 0.431112498f},
-std::array<float,2>{0.257373303f, 0.892112494f},
-std::array<float,2>{0.588890314f, 0.167698696f},
-std::array<float,2>{0.691218972f, 0.818018019f},
-std::array<float,2>{0.423648268f, 0.0965677127f},
-std::array<float,2>{0.151439533f, 0.545562029f},
-std::array<float,2>{0.834061325f, 0.251978576f},
-std::array<float,2>{0.761249125f, 0.756115437f},
-std::array<float,2>{0.201760799f, 0.0380125083f},
-std::array<float,2>{0.499698013f, 0.57843262f},
-std::array<float,2>{0.64444977f, 0.315896392f},
-std::array<float,2>{0.544183195f, 0.674055278f},
-std::array<float,2>{0.340381056f, 0.498100996f},
-std::array<float,2>{0.0584234074f, 0.94123143f},
-std::array<float,2>{0.922342837f, 0.239444092f},
-std::array<float,2>{0.976817906f, 0.535860479f},
-std::array<float,2>{0.087458238f, 0.263114631f},
-std::array<float,2>{0.310632616f, 0.826863408f},
-std::array<float,2>{0.623454571f, 0.102137007f},
-std::array<float,2>{0.736636817f, 0.903305948f},
-std::array<float,2>{0.389915079f, 0.156801894f},
-std::array<float,2>{0.176441655f, 0.699726284f},
-std::array<float,2>{0.869850278f, 0.425355405f},
-std::array<float,2>{0.897324979f, 0.977533877f},
-std::array<float,2>{0.00245116791f, 0.206104472f},
-std::array<float,2>{0.357277066f, 0.644815445f},
-std::array<float,2>{0.520747662f, 0.466858059f},
-std::array<float,2>{0.681171536f, 0.60817492f},
-std::array<float,2>{0.450174421f, 0.352322936f},
-std::array<float,2>{0.220963895f, 0.808169246f},
-std::array<float,2>{0.781313539f, 0.0223336536f},
-std::array<float,2>{0.843490064f, 0.747981071f},
-std::array<float,2>{0.146409467f, 0.376466811f},
-std::array<float,2>{0.433520347f, 0.915167809f},
-std::array<float,2>{0.696572721f, 0.149318188f},
-std::array<float,2>{0.584403872f, 0.863977849f},
-std::array<float,2>{0.264643908f, 0.0713024363f},
-std::array<float,2>{0.109328724f, 0.503203809f},
-std::array<float,2>{0.95943749f, 0.284622788f},
-std::array<float,2>{0.946990609f, 0.835152209f},
-std::array<float,2>{0.113843277f, 0.11997512f},
-std::array<float,2>{0.280359477f, 0.550750673f},
-std::array<float,2>{0.566533923f, 0.270836353f},
-std::array<float,2>{0.705143809f, 0.708097756f},
-std::array<float,2>{0.409067661f, 0.412929416f},
-std::array<float,2>{0.127873808f, 0.887057245f},
-std::array<float,2>{0.816801488f, 0.174410701f},
-std::array<float,2>{0.797761023f, 0.564426243f},
-std::array<float,2>{0.248976573f, 0.329984874f},
-std::array<float,2>{0.457217067f, 0.777079046f},
-std::array<float,2>{0.663213253f, 0.0482311696f},
-std::array<float,2>{0.5007568f, 0.9561553f},
-std::array<float,2>{0.361224085f, 0.226154149f},
-std::array<float,2>{0.0254031438f, 0.659810424f},
-std::array<float,2>{0.88699311f, 0.471688032f},
-std::array<float,2>{0.848299265f, 0.927259147f},
-std::array<float,2>{0.168115005f, 0.129554212f},
-std::array<float,2>{0.396915883f, 0.719166636f},
-std::array<float,2>{0.730306625f, 0.394501001f},
-std::array<float,2>{0.594965339f, 0.522828877f},
-std::array<float,2>{0.293692321f, 0.311504841f},
-std::array<float,2>{0.0745540112f, 0.846743464f},
-std::array<float,2>{0.995599806f, 0.0845041052f},
-std::array<float,2>{0.92039907f, 0.638550282f},
-std::array<float,2>{0.0372107141f, 0.451681018f},
-std::array<float,2>{0.322917908f, 0.99664247f},
-std::array<float,2>{0.560985267f, 0.200366214f},
-std::array<float,2>{0.627919436f, 0.796249986f},
-std::array<float,2>{0.481238633f, 0.00975136366f},
-std::array<float,2>{0.209697068f, 0.613921762f},
-std::array<float,2>{0.780213237f, 0.363288522f},
-std::array<float,2>{0.757308125f, 0.830804169f},
-std::array<float,2>{0.195052058f, 0.124830276f},
-std::array<float,2>{0.488837332f, 0.550942183f},
-std::array<float,2>{0.651794732f, 0.266057402f},
-std::array<float,2>{0.53241396f, 0.703827202f},
-std::array<float,2>{0.334294468f, 0.409801304f},
-std::array<float,2>{0.0482976623f, 0.883138239f},
-std::array<float,2>{0.936268926f, 0.176920727f},
-std::array<float,2>{0.971366704f, 0.566424608f},
-std::array<float,2>{0.0851548165f, 0.335887998f},
-std::array<float,2>{0.303490192f, 0.778601229f},
-std::array<float,2>{0.616623819f, 0.0533005781f},
-std::array<float,2>{0.745591402f, 0.96090579f},
-std::array<float,2>{0.380478978f, 0.220336825f},
-std::array<float,2>{0.18465355f, 0.660270214f},
-std::array<float,2>{0.864217103f, 0.476437747f},
-std::array<float,2>{0.899412096f, 0.921898365f},
-std::array<float,2>{0.0137627013f, 0.126110569f},
-std::array<float,2>{0.348612994f, 0.722897112f},
-std::array<float,2>{0.530158043f, 0.39757213f},
-std::array<float,2>{0.679063201f, 0.519374788f},
-std::array<float,2>{0.444119483f, 0.30671683f},
-std::array<float,2>{0.233079121f, 0.849304616f},
-std::array<float,2>{0.794893742f, 0.0811047927f},
-std::array<float,2>{0.830182791f, 0.633695006f},
-std::array<float,2>{0.154587492f, 0.447951764f},
-std::array<float,2>{0.427595735f, 0.995305955f},
-std::array<float,2>{0.694598556f, 0.198708192f},
-std::array<float,2>{0.593107998f, 0.789257646f},
-std::array<float,2>{0.250169903f, 0.0129709495f},
-std::array<float,2>{0.0986458734f, 0.611688077f},
-std::array<float,2>{0.963269532f, 0.360591859f},
-std::array<float,2>{0.942552924f, 0.751486719f},
-std::array<float,2>{0.120062567f, 0.0348959044f},
-std::array<float,2>{0.269467324f, 0.582603157f},
-std::array<float,2>{0.575300038f, 0.316839874f},
-std::array<float,2>{0.71568048f, 0.676116168f},
-std::array<float,2>{0.414408058f, 0.492438674f},
-std::array<float,2>{0.135341361f, 0.943455815f},
-std::array<float,2>{0.824045241f, 0.236353874f},
-std::array<float,2>{0.809585989f, 0.53495723f},
-std::array<float,2>{0.235657334f, 0.25882116f},
-std::array<float,2>{0.466404051f, 0.820519269f},
-std::array<float,2>{0.668308675f, 0.106001414f},
-std::array<float,2>{0.509083807f, 0.90101701f},
-std::array<float,2>{0.370006293f, 0.163944647f},
-std::array<float,2>{0.0156870652f, 0.698562622f},
-std::array<float,2>{0.880443811f, 0.429000109f},
-std::array<float,2>{0.857396185f, 0.981597066f},
-std::array<float,2>{0.159586743f, 0.207866266f},
-std::array<float,2>{0.400484949f, 0.64210701f},
-std::array<float,2>{0.725378752f, 0.46434164f},
-std::array<float,2>{0.606412947f, 0.605301201f},
-std::array<float,2>{0.28500545f, 0.356151104f},
-std::array<float,2>{0.0639398694f, 0.811564088f},
-std::array<float,2>{0.986757159f, 0.0166955702f},
-std::array<float,2>{0.913325548f, 0.743341327f},
-std::array<float,2>{0.0407497101f, 0.381011099f},
-std::array<float,2>{0.316245049f, 0.920804501f},
-std::array<float,2>{0.553817391f, 0.155422807f},
-std::array<float,2>{0.639203966f, 0.860889792f},
-std::array<float,2>{0.472350955f, 0.0766492635f},
-std::array<float,2>{0.211098447f, 0.507376134f},
-std::array<float,2>{0.76754272f, 0.285894394f},
-std::array<float,2>{0.813599348f, 0.801865458f},
-std::array<float,2>{0.129425466f, 0.0295787454f},
-std::array<float,2>{0.410469562f, 0.594124794f},
-std::array<float,2>{0.707109869f, 0.345756412f},
-std::array<float,2>{0.566252351f, 0.650382102f},
-std::array<float,2>{0.27627784f, 0.456005633f},
-std::array<float,2>{0.113099664f, 0.975363791f},
-std::array<float,2>{0.949509144f, 0.215410352f},
-std::array<float,2>{0.88556987f, 0.511724889f},
-std::array<float,2>{0.0300377626f, 0.289742619f},
-std::array<float,2>{0.364046454f, 0.86853528f},
-std::array<float,2>{0.507430494f, 0.0679609105f},
-std::array<float,2>{0.657305062f, 0.907042861f},
-std::array<float,2>{0.456861824f, 0.145278022f},
-std::array<float,2>{0.243056417f, 0.736935437f},
-std::array<float,2>{0.800938308f, 0.385417283f},
-std::array<float,2>{0.996189117f, 0.948161483f},
-std::array<float,2>{0.0731449127f, 0.248709053f},
-std::array<float,2>{0.292057991f, 0.686826527f},
-std::array<float,2>{0.597966194f, 0.485260427f},
-std::array<float,2>{0.733228326f, 0.591974497f},
-std::array<float,2>{0.393610239f, 0.327345818f},
-std::array<float,2>{0.16467008f, 0.761756897f},
-std::array<float,2>{0.845109582f, 0.0464982986f},
-std::array<float,2>{0.776993394f, 0.690321147f},
-std::array<float,2>{0.203931004f, 0.435130835f},
-std::array<float,2>{0.478273064f, 0.895919323f},
-std::array<float,2>{0.630797684f, 0.171225205f},
-std::array<float,2>{0.557580233f, 0.813223004f},
-std::array<float,2>{0.325977683f, 0.0982962549f},
-std::array<float,2>{0.0343019329f, 0.540619969f},
-std::array<float,2>{0.916745305f, 0.254888952f},
-std::array<float,2>{0.927189231f, 0.853251398f},
-std::array<float,2>{0.0598670319f, 0.0883479416f},
-std::array<float,2>{0.338851064f, 0.531068802f},
-std::array<float,2>{0.540590405f, 0.304150522f},
-std::array<float,2>{0.644588709f, 0.733276904f},
-std::array<float,2>{0.494999588f, 0.402437776f},
-std::array<float,2>{0.19590725f, 0.933751047f},
-std::array<float,2>{0.763765574f, 0.137461394f},
-std::array<float,2>{0.873160124f, 0.623128176f},
-std::array<float,2>{0.172108158f, 0.37495628f},
-std::array<float,2>{0.385303408f, 0.788864434f},
-std::array<float,2>{0.738505185f, 0.00456366455f},
-std::array<float,2>{0.617667615f, 0.988464355f},
-std::array<float,2>{0.305058122f, 0.191348448f},
-std::array<float,2>{0.0916992575f, 0.631316245f},
-std::array<float,2>{0.982219279f, 0.441169649f},
-std::array<float,2>{0.785882831f, 0.876208723f},
-std::array<float,2>{0.224270463f, 0.183150783f},
-std::array<float,2>{0.446523339f, 0.715373993f},
-std::array<float,2>{0.685680687f, 0.415053815f},
-std::array<float,2>{0.517648697f, 0.554815054f},
-std::array<float,2>{0.353062928f, 0.278701395f},
-std::array<float,2>{0.00682699634f, 0.840886772f},
-std::array<float,2>{0.893253565f, 0.116448499f},
-std::array<float,2>{0.953791618f, 0.66584754f},
-std::array<float,2>{0.103842646f, 0.482532293f},
-std::array<float,2>{0.258644909f, 0.966792226f},
-std::array<float,2>{0.580491364f, 0.2310303f},
-std::array<float,2>{0.70299232f, 0.77278614f},
-std::array<float,2>{0.434188157f, 0.0601696484f},
-std::array<float,2>{0.141303748f, 0.572627306f},
-std::array<float,2>{0.837106645f, 0.340181887f},
-std::array<float,2>{0.861583948f, 0.871669114f},
-std::array<float,2>{0.181083292f, 0.0638376474f},
-std::array<float,2>{0.378234535f, 0.508707166f},
-std::array<float,2>{0.749832928f, 0.296492457f},
-std::array<float,2>{0.611753941f, 0.739878595f},
-std::array<float,2>{0.298155516f, 0.38769117f},
-std::array<float,2>{0.078461878f, 0.911491334f},
-std::array<float,2>{0.974630415f, 0.14377442f},
-std::array<float,2>{0.933586538f, 0.598041773f},
-std::array<float,2>{0.0516529046f, 0.348106861f},
-std::array<float,2>{0.331966937f, 0.798019052f},
-std::array<float,2>{0.536221206f, 0.0238009412f},
-std::array<float,2>{0.654407859f, 0.971712291f},
-std::array<float,2>{0.48714751f, 0.214806572f},
-std::array<float,2>{0.18876192f, 0.655734956f},
-std::array<float,2>{0.753641248f, 0.459742248f},
-std::array<float,2>{0.968289435f, 0.890899777f},
-std::array<float,2>{0.0975942016f, 0.166096747f},
-std::array<float,2>{0.254619122f, 0.693423212f},
-std::array<float,2>{0.587746143f, 0.43057245f},
-std::array<float,2>{0.688222408f, 0.546034396f},
-std::array<float,2>{0.425675511f, 0.253829777f},
-std::array<float,2>{0.149941191f, 0.816447258f},
-std::array<float,2>{0.833335996f, 0.0971111953f},
-std::array<float,2>{0.789843857f, 0.681845546f},
-std::array<float,2>{0.228788137f, 0.49003768f},
-std::array<float,2>{0.440410495f, 0.951708913f},
-std::array<float,2>{0.672403395f, 0.245057836f},
-std::array<float,2>{0.525240123f, 0.759720922f},
-std::array<float,2>{0.344278187f, 0.0417479835f},
-std::array<float,2>{0.0114968885f, 0.587705612f},
-std::array<float,2>{0.90603435f, 0.320788234f},
-std::array<float,2>{0.878456593f, 0.783005536f},
-std::array<float,2>{0.0221419632f, 0.00303212157f},
-std::array<float,2>{0.374709398f, 0.618542671f},
-std::array<float,2>{0.513473451f, 0.370801866f},
-std::array<float,2>{0.665163219f, 0.627759635f},
-std::array<float,2>{0.46383512f, 0.441571772f},
-std::array<float,2>{0.242120311f, 0.986341894f},
-std::array<float,2>{0.807199717f, 0.194666371f},
-std::array<float,2>{0.82475096f, 0.526059806f},
-std::array<float,2>{0.13672848f, 0.298184067f},
-std::array<float,2>{0.420023352f, 0.857346237f},
-std::array<float,2>{0.712689042f, 0.093726024f},
-std::array<float,2>{0.573110402f, 0.933232844f},
-std::array<float,2>{0.272340387f, 0.134064734f},
-std::array<float,2>{0.121226273f, 0.728912055f},
-std::array<float,2>{0.938139558f, 0.400496125f},
-std::array<float,2>{0.77272743f, 0.963033557f},
-std::array<float,2>{0.215422794f, 0.227068409f},
-std::array<float,2>{0.474915653f, 0.670009077f},
-std::array<float,2>{0.633896768f, 0.478964925f},
-std::array<float,2>{0.549431741f, 0.576417625f},
-std::array<float,2>{0.317965329f, 0.339478046f},
-std::array<float,2>{0.0466044173f, 0.767060161f},
-std::array<float,2>{0.910027325f, 0.0559916869f},
-std::array<float,2>{0.991873085f, 0.713653564f},
-std::array<float,2>{0.0673541725f, 0.421000063f},
-std::array<float,2>{0.286031693f, 0.881916285f},
-std::array<float,2>{0.60224694f, 0.184437186f},
-std::array<float,2>{0.72143054f, 0.838370979f},
-std::array<float,2>{0.405038416f, 0.109659471f},
-std::array<float,2>{0.162798285f, 0.559483588f},
-std::array<float,2>{0.854130387f, 0.274733335f},
-std::array<float,2>{0.798870206f, 0.775672555f},
-std::array<float,2>{0.247991011f, 0.0475779362f},
-std::array<float,2>{0.45989728f, 0.562553048f},
-std::array<float,2>{0.660723388f, 0.329019874f},
-std::array<float,2>{0.503405213f, 0.659168541f},
-std::array<float,2>{0.362553179f, 0.470985293f},
-std::array<float,2>{0.024964055f, 0.955294192f},
-std::array<float,2>{0.890163958f, 0.225578591f},
-std::array<float,2>{0.947497487f, 0.549193382f},
-std::array<float,2>{0.116713725f, 0.269858003f},
-std::array<float,2>{0.279090464f, 0.834875345f},
-std::array<float,2>{0.570078135f, 0.121015169f},
-std::array<float,2>{0.704355001f, 0.887751162f},
-std::array<float,2>{0.406824827f, 0.175063401f},
-std::array<float,2>{0.126729757f, 0.707086086f},
-std::array<float,2>{0.819283545f, 0.413965881f},
-std::array<float,2>{0.918306589f, 0.997495234f},
-std::array<float,2>{0.0363743901f, 0.19985722f},
-std::array<float,2>{0.320838213f, 0.636935115f},
-std::array<float,2>{0.560373187f, 0.45310846f},
-std::array<float,2>{0.626849353f, 0.614462495f},
-std::array<float,2>{0.482654661f, 0.364631116f},
-std::array<float,2>{0.207469061f, 0.795745492f},
-std::array<float,2>{0.778284132f, 0.00867993105f},
-std::array<float,2>{0.851364374f, 0.720578372f},
-std::array<float,2>{0.171843857f, 0.392833799f},
-std::array<float,2>{0.394954503f, 0.926413417f},
-std::array<float,2>{0.728274226f, 0.129957393f},
-std::array<float,2>{0.597109437f, 0.84665978f},
-std::array<float,2>{0.296306401f, 0.0859066471f},
-std::array<float,2>{0.0768370628f, 0.521762013f},
-std::array<float,2>{0.993537366f, 0.312069982f},
-std::array<float,2>{0.979962885f, 0.827391505f},
-std::array<float,2>{0.0890448391f, 0.103403263f},
-std::array<float,2>{0.310119003f, 0.536576569f},
-std::array<float,2>{0.622699797f, 0.262095064f},
-std::array<float,2>{0.735073447f, 0.700552821f},
-std::array<float,2>{0.387162983f, 0.423949987f},
-std::array<float,2>{0.178707033f, 0.903393984f},
-std::array<float,2>{0.868909478f, 0.157621935f},
-std::array<float,2>{0.759676516f, 0.579260647f},
-std::array<float,2>{0.200871065f, 0.31479302f},
-std::array<float,2>{0.496695697f, 0.757599473f},
-std::array<float,2>{0.641545415f, 0.038630534f},
-std::array<float,2>{0.545327544f, 0.93984741f},
-std::array<float,2>{0.341914892f, 0.239128217f},
-std::array<float,2>{0.0551799536f, 0.67522037f},
-std::array<float,2>{0.925204992f, 0.499829382f},
-std::array<float,2>{0.840314865f, 0.914849997f},
-std::array<float,2>{0.146846831f, 0.149665192f},
-std::array<float,2>{0.431415707f, 0.746835172f},
-std::array<float,2>{0.697665572f, 0.37595588f},
-std::array<float,2>{0.583228886f, 0.501980722f},
-std::array<float,2>{0.261734188f, 0.2834557f},
-std::array<float,2>{0.105510712f, 0.864524484f},
-std::array<float,2>{0.958772004f, 0.0707933903f},
-std::array<float,2>{0.894647062f, 0.645678997f},
-std::array<float,2>{0.00153296173f, 0.468608022f},
-std::array<float,2>{0.358843237f, 0.977782905f},
-std::array<float,2>{0.522057652f, 0.205852434f},
-std::array<float,2>{0.683481216f, 0.806663632f},
-std::array<float,2>{0.451924026f, 0.0227548052f},
-std::array<float,2>{0.220473483f, 0.608406007f},
-std::array<float,2>{0.783320725f, 0.353013933f},
-std::array<float,2>{0.79619801f, 0.851333916f},
-std::array<float,2>{0.230730951f, 0.0799423233f},
-std::array<float,2>{0.44261986f, 0.515838146f},
-std::array<float,2>{0.675789058f, 0.305221498f},
-std::array<float,2>{0.528133452f, 0.72538656f},
-std::array<float,2>{0.350404948f, 0.395890266f},
-std::array<float,2>{0.0134599293f, 0.925281227f},
-std::array<float,2>{0.902212143f, 0.128806978f},
-std::array<float,2>{0.962840319f, 0.610545278f},
-std::array<float,2>{0.100852765f, 0.363122374f},
-std::array<float,2>{0.25298354f, 0.791408837f},
-std::array<float,2>{0.591042459f, 0.0149207236f},
-std::array<float,2>{0.692060232f, 0.992301106f},
-std::array<float,2>{0.429103851f, 0.195597544f},
-std::array<float,2>{0.153731704f, 0.636619925f},
-std::array<float,2>{0.829402924f, 0.447196364f},
-std::array<float,2>{0.93422991f, 0.885884941f},
-std::array<float,2>{0.0500632413f, 0.178712577f},
-std::array<float,2>{0.333426356f, 0.706522882f},
-std::array<float,2>{0.534342468f, 0.407632232f},
-std::array<float,2>{0.649495959f, 0.552927196f},
-std::array<float,2>{0.491211414f, 0.268695593f},
-std::array<float,2>{0.192187354f, 0.828654289f},
-std::array<float,2>{0.755208671f, 0.122504503f},
-std::array<float,2>{0.8669855f, 0.662736416f},
-std::array<float,2>{0.186683163f, 0.473185748f},
-std::array<float,2>{0.382267326f, 0.957916141f},
-std::array<float,2>{0.74412179f, 0.220953375f},
-std::array<float,2>{0.613682747f, 0.779604375f},
-std::array<float,2>{0.301892012f, 0.0522714071f},
-std::array<float,2>{0.0821211487f, 0.569665313f},
-std::array<float,2>{0.969879866f, 0.33376959f},
-std::array<float,2>{0.984527588f, 0.809875369f},
-std::array<float,2>{0.0649376288f, 0.0178750549f},
-std::array<float,2>{0.281538516f, 0.602848828f},
-std::array<float,2>{0.608056486f, 0.358920395f},
-std::array<float,2>{0.723312616f, 0.643103004f},
-std::array<float,2>{0.400037318f, 0.461451083f},
-std::array<float,2>{0.156892404f, 0.982450843f},
-std::array<float,2>{0.8580181f, 0.2098061f},
-std::array<float,2>{0.768308878f, 0.504869461f},
-std::array<float,2>{0.213798672f, 0.288344175f},
-std::array<float,2>{0.469852567f, 0.86148262f},
-std::array<float,2>{0.637935877f, 0.0750997663f},
-std::array<float,2>{0.552575707f, 0.919444025f},
-std::array<float,2>{0.312551796f, 0.154022932f},
-std::array<float,2>{0.0422643423f, 0.745964408f},
-std::array<float,2>{0.911704898f, 0.378976166f},
-std::array<float,2>{0.821824253f, 0.94316572f},
-std::array<float,2>{0.133789524f, 0.236036405f},
-std::array<float,2>{0.416049927f, 0.67836827f},
-std::array<float,2>{0.718657136f, 0.495408893f},
-std::array<float,2>{0.576734006f, 0.584441662f},
-std::array<float,2>{0.265826434f, 0.318554878f},
-std::array<float,2>{0.11761681f, 0.753552973f},
-std::array<float,2>{0.94379288f, 0.0329644196f},
-std::array<float,2>{0.881564796f, 0.696462691f},
-std::array<float,2>{0.0193981472f, 0.426018059f},
-std::array<float,2>{0.367829591f, 0.899475634f},
-std::array<float,2>{0.510706365f, 0.160923824f},
-std::array<float,2>{0.670045674f, 0.824082792f},
-std::array<float,2>{0.468171895f, 0.109306365f},
-std::array<float,2>{0.236689344f, 0.531652272f},
-std::array<float,2>{0.811175287f, 0.261515319f},
-std::array<float,2>{0.84679383f, 0.765504181f},
-std::array<float,2>{0.167629138f, 0.0443153419f},
-std::array<float,2>{0.390748411f, 0.590077102f},
-std::array<float,2>{0.732172549f, 0.326050788f},
-std::array<float,2>{0.600081086f, 0.68433708f},
-std::array<float,2>{0.289599717f, 0.487578809f},
-std::array<float,2>{0.0714182332f, 0.94568783f},
-std::array<float,2>{0.998612523f, 0.247661844f},
-std::array<float,2>{0.914719522f, 0.541489959f},
-std::array<float,2>{0.0317801237f, 0.256263733f},
-std::array<float,2>{0.326704621f, 0.814882994f},
-std::array<float,2>{0.556309819f, 0.101128951f},
-std::array<float,2>{0.632191122f, 0.896879256f},
-std::array<float,2>{0.479522198f, 0.169465184f},
-std::array<float,2>{0.206167713f, 0.687900484f},
-std::array<float,2>{0.774898112f, 0.437364429f},
-std::array<float,2>{0.952765703f, 0.973827958f},
-std::array<float,2>{0.11077825f, 0.217778817f},
-std::array<float,2>{0.275306344f, 0.651761353f},
-std::array<float,2>{0.564401448f, 0.4544245f},
-std::array<float,2>{0.70919764f, 0.59638083f},
-std::array<float,2>{0.413325012f, 0.345257729f},
-std::array<float,2>{0.131940991f, 0.803766727f},
-std::array<float,2>{0.815986097f, 0.0280847363f},
-std::array<float,2>{0.803797364f, 0.73569119f},
-std::array<float,2>{0.245040566f, 0.382820815f},
-std::array<float,2>{0.453909248f, 0.909065425f},
-std::array<float,2>{0.659200191f, 0.147009522f},
-std::array<float,2>{0.504306853f, 0.869792521f},
-std::array<float,2>{0.36600399f, 0.0688977912f},
-std::array<float,2>{0.028390849f, 0.514148712f},
-std::array<float,2>{0.884595811f, 0.2919572f},
-std::array<float,2>{0.89157331f, 0.841823399f},
-std::array<float,2>{0.00531094475f, 0.114314578f},
-std::array<float,2>{0.353876561f, 0.55727464f},
-std::array<float,2>{0.516976058f, 0.280964851f},
-std::array<float,2>{0.683733881f, 0.717931569f},
-std::array<float,2>{0.448832095f, 0.416161269f},
-std::array<float,2>{0.225000247f, 0.877155125f},
-std::array<float,2>{0.788431048f, 0.180060834f},
-std::array<float,2>{0.838798165f, 0.570394754f},
-std::array<float,2>{0.143492475f, 0.342806697f},
-std::array<float,2>{0.43658486f, 0.77110064f},
-std::array<float,2>{0.699481428f, 0.0614314489f},
-std::array<float,2>{0.579302728f, 0.968505502f},
-std::array<float,2>{0.261367291f, 0.232812971f},
-std::array<float,2>{0.1023096f, 0.666650414f},
-std::array<float,2>{0.956994295f, 0.482367158f},
-std::array<float,2>{0.762214422f, 0.93575865f},
-std::array<float,2>{0.198579386f, 0.139748365f},
-std::array<float,2>{0.492781729f, 0.730800688f},
-std::array<float,2>{0.648134172f, 0.404948235f},
-std::array<float,2>{0.541355073f, 0.527677715f},
-std::array<float,2>{0.337235332f, 0.301142067f},
-std::array<float,2>{0.0607559681f, 0.854207754f},
-std::array<float,2>{0.928569853f, 0.0861900076f},
-std::array<float,2>{0.982622802f, 0.629030168f},
-std::array<float,2>{0.0929957032f, 0.437925726f},
-std::array<float,2>{0.308339983f, 0.99156487f},
-std::array<float,2>{0.620726764f, 0.188442245f},
-std::array<float,2>{0.741921484f, 0.786676347f},
-std::array<float,2>{0.383263826f, 0.0068743052f},
-std::array<float,2>{0.174748495f, 0.621188998f},
-std::array<float,2>{0.872904241f, 0.371561378f},
-std::array<float,2>{0.835326433f, 0.819397986f},
-std::array<float,2>{0.151154086f, 0.0951374397f},
-std::array<float,2>{0.422152191f, 0.544061124f},
-std::array<float,2>{0.690147638f, 0.250617623f},
-std::array<float,2>{0.587973535f, 0.692369878f},
-std::array<float,2>{0.256804407f, 0.433339119f},
-std::array<float,2>{0.0947316885f, 0.893844426f},
-std::array<float,2>{0.966778815f, 0.164503694f},
-std::array<float,2>{0.902585745f, 0.588632047f},
-std::array<float,2>{0.00942503009f, 0.322600245f},
-std::array<float,2>{0.347260058f, 0.76121521f},
-std::array<float,2>{0.526712954f, 0.0391845629f},
-std::array<float,2>{0.674779415f, 0.950103641f},
-std::array<float,2>{0.438738793f, 0.243709967f},
-std::array<float,2>{0.227929696f, 0.679917753f},
-std::array<float,2>{0.791915178f, 0.490799725f},
-std::array<float,2>{0.973065853f, 0.913222134f},
-std::array<float,2>{0.0816667601f, 0.14202632f},
-std::array<float,2>{0.300161123f, 0.740788162f},
-std::array<float,2>{0.609698772f, 0.390140325f},
-std::array<float,2>{0.746963322f, 0.510379016f},
-std::array<float,2>{0.376085818f, 0.293562561f},
-std::array<float,2>{0.182762712f, 0.873246372f},
-std::array<float,2>{0.859762728f, 0.0646471158f},
-std::array<float,2>{0.75121367f, 0.652400255f},
-std::array<float,2>{0.191208869f, 0.458149374f},
-std::array<float,2>{0.485980362f, 0.969350994f},
-std::array<float,2>{0.652420878f, 0.210937664f},
-std::array<float,2>{0.537701666f, 0.800484359f},
-std::array<float,2>{0.329407752f, 0.0263833478f},
-std::array<float,2>{0.0543098822f, 0.601412773f},
-std::array<float,2>{0.93136847f, 0.350281149f},
-std::array<float,2>{0.906788468f, 0.768631279f},
-std::array<float,2>{0.044097323f, 0.0579698831f},
-std::array<float,2>{0.3196311f, 0.574804306f},
-std::array<float,2>{0.547115088f, 0.336083561f},
-std::array<float,2>{0.636041939f, 0.669350028f},
-std::array<float,2>{0.473523349f, 0.478467852f},
-std::array<float,2>{0.218720123f, 0.962321937f},
-std::array<float,2>{0.770573616f, 0.229177415f},
-std::array<float,2>{0.851927817f, 0.561165094f},
-std::array<float,2>{0.161396652f, 0.275592417f},
-std::array<float,2>{0.402991414f, 0.836884975f},
-std::array<float,2>{0.71903801f, 0.112440877f},
-std::array<float,2>{0.604341269f, 0.878973782f},
-std::array<float,2>{0.288470894f, 0.186938629f},
-std::array<float,2>{0.068917349f, 0.711867392f},
-std::array<float,2>{0.989505649f, 0.418147564f},
-std::array<float,2>{0.805372775f, 0.986014724f},
-std::array<float,2>{0.240233585f, 0.191934109f},
-std::array<float,2>{0.461468786f, 0.625476003f},
-std::array<float,2>{0.66693455f, 0.44442609f},
-std::array<float,2>{0.514109254f, 0.620269001f},
-std::array<float,2>{0.37169221f, 0.368149996f},
-std::array<float,2>{0.0196028445f, 0.78361547f},
-std::array<float,2>{0.876033485f, 9.51921393e-05f},
-std::array<float,2>{0.94116205f, 0.727711082f},
-std::array<float,2>{0.123823546f, 0.400019884f},
-std::array<float,2>{0.271423995f, 0.930683553f},
-std::array<float,2>{0.572046101f, 0.136194006f},
-std::array<float,2>{0.713400483f, 0.857854605f},
-std::array<float,2>{0.41798535f, 0.0907357857f},
-std::array<float,2>{0.140060127f, 0.523739457f},
-std::array<float,2>{0.826928735f, 0.299239665f},
-std::array<float,2>{0.780930042f, 0.793639421f},
-std::array<float,2>{0.210657448f, 0.0108010592f},
-std::array<float,2>{0.482305616f, 0.616402507f},
-std::array<float,2>{0.627957523f, 0.36627689f},
-std::array<float,2>{0.561892867f, 0.640113056f},
-std::array<float,2>{0.32343331f, 0.450583279f},
-std::array<float,2>{0.0390563682f, 0.998439252f},
-std::array<float,2>{0.921807826f, 0.201645762f},
-std::array<float,2>{0.994901955f, 0.520424783f},
-std::array<float,2>{0.075536415f, 0.309183121f},
-std::array<float,2>{0.294074327f, 0.845522583f},
-std::array<float,2>{0.594684601f, 0.0827657059f},
-std::array<float,2>{0.72924912f, 0.928354681f},
-std::array<float,2>{0.398329526f, 0.131467775f},
-std::array<float,2>{0.169031411f, 0.720998168f},
-std::array<float,2>{0.848645627f, 0.390683621f},
-std::array<float,2>{0.8885988f, 0.954388201f},
-std::array<float,2>{0.0272041522f, 0.223606512f},
-std::array<float,2>{0.359530687f, 0.657457352f},
-std::array<float,2>{0.501925409f, 0.470546693f},
-std::array<float,2>{0.662329435f, 0.565630913f},
-std::array<float,2>{0.458589107f, 0.331355989f},
-std::array<float,2>{0.249911278f, 0.774603248f},
-std::array<float,2>{0.798827589f, 0.0504253395f},
-std::array<float,2>{0.817820847f, 0.71078819f},
-std::array<float,2>{0.127997845f, 0.410614341f},
-std::array<float,2>{0.409371346f, 0.890280187f},
-std::array<float,2>{0.706917524f, 0.172993883f},
-std::array<float,2>{0.567441106f, 0.832565129f},
-std::array<float,2>{0.279896468f, 0.118291594f},
-std::array<float,2>{0.114488825f, 0.548652887f},
-std::array<float,2>{0.945952833f, 0.272201419f},
-std::array<float,2>{0.960588813f, 0.865997136f},
-std::array<float,2>{0.107844517f, 0.073314175f},
-std::array<float,2>{0.264886826f, 0.500118315f},
-std::array<float,2>{0.58588177f, 0.282283932f},
-std::array<float,2>{0.695510209f, 0.749383748f},
-std::array<float,2>{0.431901127f, 0.377107382f},
-std::array<float,2>{0.145152479f, 0.917229712f},
-std::array<float,2>{0.842205822f, 0.152123883f},
-std::array<float,2>{0.782810509f, 0.606701136f},
-std::array<float,2>{0.22254619f, 0.35502395f},
-std::array<float,2>{0.450882137f, 0.8051458f},
-std::array<float,2>{0.680554688f, 0.0209271554f},
-std::array<float,2>{0.520181f, 0.979810297f},
-std::array<float,2>{0.356049657f, 0.204547942f},
-std::array<float,2>{0.00339179789f, 0.64806515f},
-std::array<float,2>{0.897727787f, 0.466313332f},
-std::array<float,2>{0.870426655f, 0.904481113f},
-std::array<float,2>{0.177160949f, 0.159784362f},
-std::array<float,2>{0.388951838f, 0.702349782f},
-std::array<float,2>{0.737827063f, 0.422307998f},
-std::array<float,2>{0.624275625f, 0.538713276f},
-std::array<float,2>{0.311763197f, 0.265222251f},
-std::array<float,2>{0.0864408761f, 0.825569808f},
-std::array<float,2>{0.977748454f, 0.105459221f},
-std::array<float,2>{0.9237746f, 0.672118783f},
-std::array<float,2>{0.0569543019f, 0.497238308f},
-std::array<float,2>{0.341104448f, 0.939235032f},
-std::array<float,2>{0.543618977f, 0.240392506f},
-std::array<float,2>{0.642745972f, 0.754772663f},
-std::array<float,2>{0.498173565f, 0.0355976336f},
-std::array<float,2>{0.202777714f, 0.58132112f},
-std::array<float,2>{0.760406256f, 0.313951999f},
-std::array<float,2>{0.764622808f, 0.853797019f},
-std::array<float,2>{0.195477232f, 0.0866578892f},
-std::array<float,2>{0.494570017f, 0.52788198f},
-std::array<float,2>{0.645475328f, 0.301286966f},
-std::array<float,2>{0.540230036f, 0.731419265f},
-std::array<float,2>{0.338028401f, 0.404619604f},
-std::array<float,2>{0.0604700409f, 0.936169505f},
-std::array<float,2>{0.927369654f, 0.14048703f},
-std::array<float,2>{0.981644928f, 0.622024953f},
-std::array<float,2>{0.0908367932f, 0.372027695f},
-std::array<float,2>{0.305414379f, 0.786146283f},
-std::array<float,2>{0.617733598f, 0.00743619725f},
-std::array<float,2>{0.739004314f, 0.992159009f},
-std::array<float,2>{0.384901106f, 0.187567562f},
-std::array<float,2>{0.172470793f, 0.629503787f},
-std::array<float,2>{0.873863161f, 0.438245922f},
-std::array<float,2>{0.892597079f, 0.877876759f},
-std::array<float,2>{0.00591041893f, 0.180393249f},
-std::array<float,2>{0.352714926f, 0.71858716f},
-std::array<float,2>{0.518234253f, 0.416917294f},
-std::array<float,2>{0.686334848f, 0.556789339f},
-std::array<float,2>{0.446949422f, 0.280387789f},
-std::array<float,2>{0.223839343f, 0.842332661f},
-std::array<float,2>{0.785502017f, 0.114870638f},
-std::array<float,2>{0.837723017f, 0.666382313f},
-std::array<float,2>{0.140730381f, 0.481729716f},
-std::array<float,2>{0.433976203f, 0.968166351f},
-std::array<float,2>{0.702264786f, 0.23327361f},
-std::array<float,2>{0.580723882f, 0.7706756f},
-std::array<float,2>{0.258057296f, 0.0606700331f},
-std::array<float,2>{0.104173511f, 0.570807517f},
-std::array<float,2>{0.953144073f, 0.343390346f},
-std::array<float,2>{0.949770927f, 0.80442512f},
-std::array<float,2>{0.112482995f, 0.0277156085f},
-std::array<float,2>{0.275868028f, 0.595715344f},
-std::array<float,2>{0.565873981f, 0.344727784f},
-std::array<float,2>{0.70756036f, 0.651975632f},
-std::array<float,2>{0.410658598f, 0.454881817f},
-std::array<float,2>{0.129226372f, 0.974195898f},
-std::array<float,2>{0.81402564f, 0.218406603f},
-std::array<float,2>{0.801273942f, 0.514622748f},
-std::array<float,2>{0.242431104f, 0.291178465f},
-std::array<float,2>{0.456305116f, 0.869324744f},
-std::array<float,2>{0.658010006f, 0.0686602145f},
-std::array<float,2>{0.506966889f, 0.908594966f},
-std::array<float,2>{0.363721251f, 0.14693372f},
-std::array<float,2>{0.0294972528f, 0.736198843f},
-std::array<float,2>{0.88490361f, 0.383723915f},
-std::array<float,2>{0.845258832f, 0.94591552f},
-std::array<float,2>{0.164456531f, 0.247308657f},
-std::array<float,2>{0.394366115f, 0.684025764f},
-std::array<float,2>{0.732866824f, 0.487983674f},
-std::array<float,2>{0.598176241f, 0.59078902f},
-std::array<float,2>{0.292745352f, 0.325417101f},
-std::array<float,2>{0.0725453198f, 0.764747262f},
-std::array<float,2>{0.996696949f, 0.0448137894f},
-std::array<float,2>{0.916167915f, 0.688407242f},
-std::array<float,2>{0.0347839147f, 0.436640114f},
-std::array<float,2>{0.325539201f, 0.897396147f},
-std::array<float,2>{0.556911707f, 0.168970138f},
-std::array<float,2>{0.629918039f, 0.81532824f},
-std::array<float,2>{0.477915257f, 0.100844562f},
-std::array<float,2>{0.203329861f, 0.541831732f},
-std::array<float,2>{0.776471734f, 0.256398559f},
-std::array<float,2>{0.823450685f, 0.753012657f},
-std::array<float,2>{0.134904206f, 0.0326459035f},
-std::array<float,2>{0.414745063f, 0.584524333f},
-std::array<float,2>{0.715285778f, 0.319256663f},
-std::array<float,2>{0.575963855f, 0.677796483f},
-std::array<float,2>{0.268702388f, 0.495913804f},
-std::array<float,2>{0.119151257f, 0.942559958f},
-std::array<float,2>{0.943093061f, 0.235462457f},
-std::array<float,2>{0.879915714f, 0.532112181f},
-std::array<float,2>{0.0164432973f, 0.261068881f},
-std::array<float,2>{0.369289905f, 0.823623836f},
-std::array<float,2>{0.509367585f, 0.108676098f},
-std::array<float,2>{0.668492973f, 0.900085688f},
-std::array<float,2>{0.466279387f, 0.160309687f},
-std::array<float,2>{0.236246124f, 0.697111726f},
-std::array<float,2>{0.810143113f, 0.426410943f},
-std::array<float,2>{0.987137556f, 0.983109772f},
-std::array<float,2>{0.0639757439f, 0.209200799f},
-std::array<float,2>{0.284295321f, 0.64271754f},
-std::array<float,2>{0.605696082f, 0.461303324f},
-std::array<float,2>{0.724688828f, 0.603230357f},
-std::array<float,2>{0.400892764f, 0.358625859f},
-std::array<float,2>{0.159778193f, 0.810480893f},
-std::array<float,2>{0.856811583f, 0.0183235127f},
-std::array<float,2>{0.766812742f, 0.745292902f},
-std::array<float,2>{0.211879089f, 0.37943542f},
-std::array<float,2>{0.471940905f, 0.919014215f},
-std::array<float,2>{0.63912636f, 0.153671995f},
-std::array<float,2>{0.554270685f, 0.862285912f},
-std::array<float,2>{0.315850526f, 0.074677892f},
-std::array<float,2>{0.0402953885f, 0.503910363f},
-std::array<float,2>{0.913759053f, 0.288784504f},
-std::array<float,2>{0.935637474f, 0.828239262f},
-std::array<float,2>{0.048809614f, 0.122624159f},
-std::array<float,2>{0.334559917f, 0.553264439f},
-std::array<float,2>{0.532972217f, 0.269140869f},
-std::array<float,2>{0.651890576f, 0.706551731f},
-std::array<float,2>{0.48839736f, 0.408195674f},
-std::array<float,2>{0.194667414f, 0.886669934f},
-std::array<float,2>{0.757585824f, 0.179523632f},
-std::array<float,2>{0.863380313f, 0.570266247f},
-std::array<float,2>{0.185080245f, 0.333245516f},
-std::array<float,2>{0.379972935f, 0.779982865f},
-std::array<float,2>{0.745980918f, 0.051778283f},
-std::array<float,2>{0.616984129f, 0.957098961f},
-std::array<float,2>{0.303144574f, 0.221409068f},
-std::array<float,2>{0.0856045559f, 0.662326813f},
-std::array<float,2>{0.970971406f, 0.472940296f},
-std::array<float,2>{0.793989003f, 0.925365508f},
-std::array<float,2>{0.232789874f, 0.128162771f},
-std::array<float,2>{0.443816483f, 0.724799871f},
-std::array<float,2>{0.67948246f, 0.396373183f},
-std::array<float,2>{0.529652715f, 0.516597331f},
-std::array<float,2>{0.348111808f, 0.304747999f},
-std::array<float,2>{0.01460985f, 0.85105139f},
-std::array<float,2>{0.898874998f, 0.079511568f},
-std::array<float,2>{0.963541389f, 0.635871768f},
-std::array<float,2>{0.0994609669f, 0.446655035f},
-std::array<float,2>{0.25090155f, 0.992781401f},
-std::array<float,2>{0.593580663f, 0.196125999f},
-std::array<float,2>{0.695276141f, 0.791560173f},
-std::array<float,2>{0.426987082f, 0.0155762639f},
-std::array<float,2>{0.154877603f, 0.611286044f},
-std::array<float,2>{0.831002176f, 0.36277768f},
-std::array<float,2>{0.868481159f, 0.825942457f},
-std::array<float,2>{0.177759394f, 0.10477642f},
-std::array<float,2>{0.387607902f, 0.538095176f},
-std::array<float,2>{0.734677076f, 0.265129298f},
-std::array<float,2>{0.622421861f, 0.70269835f},
-std::array<float,2>{0.309718221f, 0.422769606f},
-std::array<float,2>{0.0895163268f, 0.904819429f},
-std::array<float,2>{0.980010509f, 0.159477681f},
-std::array<float,2>{0.925405025f, 0.581781209f},
-std::array<float,2>{0.0549383052f, 0.314448267f},
-std::array<float,2>{0.342747152f, 0.754120052f},
-std::array<float,2>{0.545644641f, 0.0356870964f},
-std::array<float,2>{0.640690923f, 0.938748896f},
-std::array<float,2>{0.496454805f, 0.241158113f},
-std::array<float,2>{0.200259119f, 0.672650337f},
-std::array<float,2>{0.758822322f, 0.498011917f},
-std::array<float,2>{0.958159864f, 0.917767286f},
-std::array<float,2>{0.1064087f, 0.151412204f},
-std::array<float,2>{0.262599587f, 0.749844134f},
-std::array<float,2>{0.583799124f, 0.377491444f},
-std::array<float,2>{0.698014975f, 0.500491798f},
-std::array<float,2>{0.43093732f, 0.282907218f},
-std::array<float,2>{0.147027254f, 0.865518749f},
-std::array<float,2>{0.840797305f, 0.0738467798f},
-std::array<float,2>{0.783982217f, 0.647640586f},
-std::array<float,2>{0.219796777f, 0.465854019f},
-std::array<float,2>{0.451307327f, 0.980238199f},
-std::array<float,2>{0.683046818f, 0.204755038f},
-std::array<float,2>{0.521959901f, 0.805427611f},
-std::array<float,2>{0.358911335f, 0.0214197021f},
-std::array<float,2>{0.00114437751f, 0.607212901f},
-std::array<float,2>{0.895501375f, 0.354752004f},
-std::array<float,2>{0.889720798f, 0.775115967f},
-std::array<float,2>{0.0246940218f, 0.0501293018f},
-std::array<float,2>{0.363032848f, 0.566292465f},
-std::array<float,2>{0.503873646f, 0.331837833f},
-std::array<float,2>{0.660255969f, 0.658155203f},
-std::array<float,2>{0.458996654f, 0.470146447f},
-std::array<float,2>{0.247367278f, 0.954684436f},
-std::array<float,2>{0.799549162f, 0.222802892f},
-std::array<float,2>{0.818381727f, 0.548255622f},
-std::array<float,2>{0.126104295f, 0.271747738f},
-std::array<float,2>{0.406545848f, 0.832112849f},
-std::array<float,2>{0.704767466f, 0.119091354f},
-std::array<float,2>{0.569558263f, 0.890065551f},
-std::array<float,2>{0.278638035f, 0.173566461f},
-std::array<float,2>{0.116303213f, 0.710331738f},
-std::array<float,2>{0.94792366f, 0.411014378f},
-std::array<float,2>{0.777737916f, 0.998766065f},
-std::array<float,2>{0.207583725f, 0.201972067f},
-std::array<float,2>{0.483207613f, 0.640554905f},
-std::array<float,2>{0.626242399f, 0.451044768f},
-std::array<float,2>{0.560037494f, 0.616718233f},
-std::array<float,2>{0.320550084f, 0.366898924f},
-std::array<float,2>{0.0370517001f, 0.79305625f},
-std::array<float,2>{0.918468714f, 0.0115066553f},
-std::array<float,2>{0.993871331f, 0.721269488f},
-std::array<float,2>{0.0765008703f, 0.391362429f},
-std::array<float,2>{0.296740681f, 0.928193748f},
-std::array<float,2>{0.597278416f, 0.131217316f},
-std::array<float,2>{0.727927983f, 0.84504956f},
-std::array<float,2>{0.395358592f, 0.082339257f},
-std::array<float,2>{0.170995548f, 0.519579768f},
-std::array<float,2>{0.850747049f, 0.308913022f},
-std::array<float,2>{0.80708921f, 0.783757567f},
-std::array<float,2>{0.24137491f, 0.000680355821f},
-std::array<float,2>{0.463210613f, 0.620626032f},
-std::array<float,2>{0.665874302f, 0.367551476f},
-std::array<float,2>{0.513180017f, 0.625578105f},
-std::array<float,2>{0.374471664f, 0.445159703f},
-std::array<float,2>{0.021565726f, 0.985737979f},
-std::array<float,2>{0.878355682f, 0.191664621f},
-std::array<float,2>{0.937534511f, 0.524012983f},
-std::array<float,2>{0.12193872f, 0.29963091f},
-std::array<float,2>{0.27194348f, 0.858041525f},
-std::array<float,2>{0.572340786f, 0.0902587548f},
-std::array<float,2>{0.712352455f, 0.931527376f},
-std::array<float,2>{0.420613974f, 0.136701837f},
-std::array<float,2>{0.137604848f, 0.728322864f},
-std::array<float,2>{0.824408591f, 0.399470717f},
-std::array<float,2>{0.909263074f, 0.962768793f},
-std::array<float,2>{0.0461179167f, 0.228567183f},
-std::array<float,2>{0.317512929f, 0.669480026f},
-std::array<float,2>{0.549015045f, 0.477766901f},
-std::array<float,2>{0.634462059f, 0.574611247f},
-std::array<float,2>{0.475297779f, 0.336771756f},
-std::array<float,2>{0.214991048f, 0.769158065f},
-std::array<float,2>{0.772998035f, 0.0583242439f},
-std::array<float,2>{0.853586078f, 0.711136878f},
-std::array<float,2>{0.162301213f, 0.418578684f},
-std::array<float,2>{0.404658139f, 0.879465878f},
-std::array<float,2>{0.720932961f, 0.187057525f},
-std::array<float,2>{0.601808965f, 0.836132526f},
-std::array<float,2>{0.285533726f, 0.113073781f},
-std::array<float,2>{0.0668798685f, 0.560720921f},
-std::array<float,2>{0.991419613f, 0.276107579f},
-std::array<float,2>{0.975560844f, 0.873951256f},
-std::array<float,2>{0.0790471509f, 0.065291591f},
-std::array<float,2>{0.298687935f, 0.509939253f},
-std::array<float,2>{0.612085879f, 0.293202966f},
-std::array<float,2>{0.749271452f, 0.740495086f},
-std::array<float,2>{0.378558725f, 0.38989386f},
-std::array<float,2>{0.181593195f, 0.914061129f},
-std::array<float,2>{0.862146139f, 0.142377272f},
-std::array<float,2>{0.753410041f, 0.600844264f},
-std::array<float,2>{0.18897444f, 0.349970192f},
-std::array<float,2>{0.486787587f, 0.800042868f},
-std::array<float,2>{0.655193746f, 0.0271968283f},
-std::array<float,2>{0.536836684f, 0.969150484f},
-std::array<float,2>{0.331314057f, 0.211457103f},
-std::array<float,2>{0.0510082394f, 0.6530568f},
-std::array<float,2>{0.932889044f, 0.458898038f},
-std::array<float,2>{0.833885729f, 0.894168079f},
-std::array<float,2>{0.149721727f, 0.16477932f},
-std::array<float,2>{0.42524001f, 0.691673517f},
-std::array<float,2>{0.687638581f, 0.43283686f},
-std::array<float,2>{0.586985767f, 0.544686019f},
-std::array<float,2>{0.254084796f, 0.250239342f},
-std::array<float,2>{0.0968860462f, 0.819958806f},
-std::array<float,2>{0.967812121f, 0.0955319703f},
-std::array<float,2>{0.905539453f, 0.680472732f},
-std::array<float,2>{0.0108275339f, 0.490441918f},
-std::array<float,2>{0.344003916f, 0.94969523f},
-std::array<float,2>{0.524535298f, 0.243479863f},
-std::array<float,2>{0.672233284f, 0.761651039f},
-std::array<float,2>{0.439730674f, 0.0397730134f},
-std::array<float,2>{0.229050696f, 0.587945223f},
-std::array<float,2>{0.789456069f, 0.32303226f},
-std::array<float,2>{0.7886253f, 0.841737568f},
-std::array<float,2>{0.225500494f, 0.117131591f},
-std::array<float,2>{0.448246658f, 0.555635571f},
-std::array<float,2>{0.684239805f, 0.278966308f},
-std::array<float,2>{0.517520607f, 0.714868128f},
-std::array<float,2>{0.35429278f, 0.415701061f},
-std::array<float,2>{0.00541938283f, 0.876534998f},
-std::array<float,2>{0.890630186f, 0.182958513f},
-std::array<float,2>{0.956243098f, 0.573060036f},
-std::array<float,2>{0.10201849f, 0.340543002f},
-std::array<float,2>{0.261217326f, 0.773229837f},
-std::array<float,2>{0.579834402f, 0.0595738664f},
-std::array<float,2>{0.699764431f, 0.965826333f},
-std::array<float,2>{0.437234074f, 0.230778217f},
-std::array<float,2>{0.14278537f, 0.665418148f},
-std::array<float,2>{0.838286579f, 0.483129203f},
-std::array<float,2>{0.927746892f, 0.934525788f},
-std::array<float,2>{0.0613909438f, 0.136789799f},
-std::array<float,2>{0.337497354f, 0.732723355f},
-std::array<float,2>{0.541662037f, 0.403090835f},
-std::array<float,2>{0.647945642f, 0.530707002f},
-std::array<float,2>{0.492546737f, 0.304414272f},
-std::array<float,2>{0.199177131f, 0.852984428f},
-std::array<float,2>{0.761902034f, 0.0884656608f},
-std::array<float,2>{0.872108281f, 0.631525874f},
-std::array<float,2>{0.173883885f, 0.440522611f},
-std::array<float,2>{0.383651197f, 0.988772452f},
-std::array<float,2>{0.741472661f, 0.190825641f},
-std::array<float,2>{0.620399714f, 0.788194001f},
-std::array<float,2>{0.307899386f, 0.00391538627f},
-std::array<float,2>{0.0934626535f, 0.623621583f},
-std::array<float,2>{0.98310405f, 0.374053806f},
-std::array<float,2>{0.998422027f, 0.762223482f},
-std::array<float,2>{0.0718068779f, 0.0463430323f},
-std::array<float,2>{0.289194971f, 0.592427552f},
-std::array<float,2>{0.600103974f, 0.327890128f},
-std::array<float,2>{0.731682241f, 0.687125087f},
-std::array<float,2>{0.391359121f, 0.484730035f},
-std::array<float,2>{0.167247877f, 0.947392046f},
-std::array<float,2>{0.847524107f, 0.248421475f},
-std::array<float,2>{0.775142431f, 0.540274322f},
-std::array<float,2>{0.206732273f, 0.255400598f},
-std::array<float,2>{0.480334312f, 0.812628567f},
-std::array<float,2>{0.632664979f, 0.0978716388f},
-std::array<float,2>{0.555677474f, 0.89604193f},
-std::array<float,2>{0.326319009f, 0.171486974f},
-std::array<float,2>{0.0315296091f, 0.689477146f},
-std::array<float,2>{0.914327204f, 0.434811026f},
-std::array<float,2>{0.815825939f, 0.97475177f},
-std::array<float,2>{0.132801294f, 0.2149463f},
-std::array<float,2>{0.413973629f, 0.649818361f},
-std::array<float,2>{0.709489405f, 0.455290914f},
-std::array<float,2>{0.563769221f, 0.59436363f},
-std::array<float,2>{0.274615854f, 0.346235901f},
-std::array<float,2>{0.11099565f, 0.802679837f},
-std::array<float,2>{0.952600837f, 0.0301331151f},
-std::array<float,2>{0.883946538f, 0.736379981f},
-std::array<float,2>{0.029041227f, 0.385077745f},
-std::array<float,2>{0.365648806f, 0.906684101f},
-std::array<float,2>{0.504473209f, 0.144737825f},
-std::array<float,2>{0.660028934f, 0.868801832f},
-std::array<float,2>{0.453260332f, 0.0676785856f},
-std::array<float,2>{0.244585782f, 0.512534797f},
-std::array<float,2>{0.804222465f, 0.289268345f},
-std::array<float,2>{0.85786587f, 0.812133908f},
-std::array<float,2>{0.156358719f, 0.0173517317f},
-std::array<float,2>{0.399613887f, 0.604713619f},
-std::array<float,2>{0.722937107f, 0.355753243f},
-std::array<float,2>{0.607876718f, 0.641910911f},
-std::array<float,2>{0.282185346f, 0.464417219f},
-std::array<float,2>{0.0649436489f, 0.982202113f},
-std::array<float,2>{0.985079944f, 0.207054839f},
-std::array<float,2>{0.911377907f, 0.506845474f},
-std::array<float,2>{0.0426413044f, 0.285586774f},
-std::array<float,2>{0.31305033f, 0.860675931f},
-std::array<float,2>{0.552078545f, 0.0771011114f},
-std::array<float,2>{0.63823998f, 0.920409083f},
-std::array<float,2>{0.470675826f, 0.155845478f},
-std::array<float,2>{0.213146508f, 0.744128644f},
-std::array<float,2>{0.767908335f, 0.381547004f},
-std::array<float,2>{0.944183409f, 0.943906903f},
-std::array<float,2>{0.118135899f, 0.236949861f},
-std::array<float,2>{0.266135395f, 0.676690757f},
-std::array<float,2>{0.576509416f, 0.492793053f},
-std::array<float,2>{0.718125045f, 0.582120001f},
-std::array<float,2>{0.416716903f, 0.317237645f},
-std::array<float,2>{0.134298414f, 0.751240373f},
-std::array<float,2>{0.821749568f, 0.0344284624f},
-std::array<float,2>{0.811006427f, 0.698805928f},
-std::array<float,2>{0.236886457f, 0.429271519f},
-std::array<float,2>{0.46874854f, 0.900401771f},
-std::array<float,2>{0.670712709f, 0.163143575f},
-std::array<float,2>{0.510013938f, 0.82111752f},
-std::array<float,2>{0.367641777f, 0.105721615f},
-std::array<float,2>{0.0187141765f, 0.534501135f},
-std::array<float,2>{0.881067991f, 0.259408355f},
-std::array<float,2>{0.901664615f, 0.849115252f},
-std::array<float,2>{0.012998106f, 0.0819451213f},
-std::array<float,2>{0.349906474f, 0.518972397f},
-std::array<float,2>{0.527611673f, 0.307340592f},
-std::array<float,2>{0.676577032f, 0.723371267f},
-std::array<float,2>{0.443111122f, 0.398348659f},
-std::array<float,2>{0.23138383f, 0.922616124f},
-std::array<float,2>{0.796395421f, 0.12655881f},
-std::array<float,2>{0.829703748f, 0.61217767f},
-std::array<float,2>{0.153837115f, 0.360886246f},
-std::array<float,2>{0.429480761f, 0.78997761f},
-std::array<float,2>{0.691894174f, 0.0136284912f},
-std::array<float,2>{0.591669858f, 0.995993376f},
-std::array<float,2>{0.253824145f, 0.198849097f},
-std::array<float,2>{0.101503946f, 0.632839501f},
-std::array<float,2>{0.961970031f, 0.447536945f},
-std::array<float,2>{0.755790353f, 0.883330286f},
-std::array<float,2>{0.191472292f, 0.17750679f},
-std::array<float,2>{0.492149919f, 0.703154802f},
-std::array<float,2>{0.650100887f, 0.409613639f},
-std::array<float,2>{0.534916222f, 0.55158174f},
-std::array<float,2>{0.333601624f, 0.266224086f},
-std::array<float,2>{0.0506248474f, 0.830508649f},
-std::array<float,2>{0.9338907f, 0.124227531f},
-std::array<float,2>{0.970476627f, 0.660827458f},
-std::array<float,2>{0.0829527676f, 0.475828022f},
-std::array<float,2>{0.302570015f, 0.960124314f},
-std::array<float,2>{0.614255488f, 0.219902381f},
-std::array<float,2>{0.743517578f, 0.778938413f},
-std::array<float,2>{0.382594109f, 0.0530466214f},
-std::array<float,2>{0.187487438f, 0.567222774f},
-std::array<float,2>{0.866514146f, 0.335166276f},
-std::array<float,2>{0.84233582f, 0.865213037f},
-std::array<float,2>{0.144873559f, 0.0712679327f},
-std::array<float,2>{0.43224299f, 0.502757668f},
-std::array<float,2>{0.695885181f, 0.284017831f},
-std::array<float,2>{0.585432351f, 0.746101975f},
-std::array<float,2>{0.26514855f, 0.375014544f},
-std::array<float,2>{0.107912451f, 0.914501429f},
-std::array<float,2>{0.960283339f, 0.150195718f},
-std::array<float,2>{0.898231328f, 0.609044015f},
-std::array<float,2>{0.0036392156f, 0.353443623f},
-std::array<float,2>{0.355841309f, 0.807158232f},
-std::array<float,2>{0.519950092f, 0.0231500212f},
-std::array<float,2>{0.679739475f, 0.978208184f},
-std::array<float,2>{0.450376868f, 0.20545131f},
-std::array<float,2>{0.222158298f, 0.646094859f},
-std::array<float,2>{0.78240639f, 0.468125671f},
-std::array<float,2>{0.978109181f, 0.904051542f},
-std::array<float,2>{0.0859505907f, 0.158114791f},
-std::array<float,2>{0.312448829f, 0.7011379f},
-std::array<float,2>{0.624829233f, 0.424500555f},
-std::array<float,2>{0.737666786f, 0.536851108f},
-std::array<float,2>{0.389417022f, 0.262366623f},
-std::array<float,2>{0.177557111f, 0.827754617f},
-std::array<float,2>{0.87097913f, 0.102576643f},
-std::array<float,2>{0.759832859f, 0.67549324f},
-std::array<float,2>{0.202420443f, 0.499285787f},
-std::array<float,2>{0.498819381f, 0.940219223f},
-std::array<float,2>{0.643285692f, 0.238313973f},
-std::array<float,2>{0.543295562f, 0.756857216f},
-std::array<float,2>{0.341311038f, 0.0384573452f},
-std::array<float,2>{0.0573240295f, 0.579808116f},
-std::array<float,2>{0.922966123f, 0.315309912f},
-std::array<float,2>{0.920930505f, 0.795260072f},
-std::array<float,2>{0.0385256186f, 0.00816831179f},
-std::array<float,2>{0.323836267f, 0.614929736f},
-std::array<float,2>{0.562152028f, 0.364797384f},
-std::array<float,2>{0.628492892f, 0.637359321f},
-std::array<float,2>{0.481864274f, 0.452574134f},
-std::array<float,2>{0.21001853f, 0.997680128f},
-std::array<float,2>{0.780466199f, 0.199647516f},
-std::array<float,2>{0.849261463f, 0.522151113f},
-std::array<float,2>{0.169488192f, 0.3115592f},
-std::array<float,2>{0.397461593f, 0.845945477f},
-std::array<float,2>{0.728554666f, 0.0852894858f},
-std::array<float,2>{0.593803644f, 0.926265538f},
-std::array<float,2>{0.294614881f, 0.13047199f},
-std::array<float,2>{0.0758023262f, 0.719793797f},
-std::array<float,2>{0.994574606f, 0.393095046f},
-std::array<float,2>{0.797935009f, 0.955901682f},
-std::array<float,2>{0.249193564f, 0.224618331f},
-std::array<float,2>{0.458288968f, 0.658489406f},
-std::array<float,2>{0.66292119f, 0.471305519f},
-std::array<float,2>{0.501189232f, 0.563268125f},
-std::array<float,2>{0.359897822f, 0.328467101f},
-std::array<float,2>{0.026427459f, 0.776331306f},
-std::array<float,2>{0.887830615f, 0.0473533273f},
-std::array<float,2>{0.945565403f, 0.707613289f},
-std::array<float,2>{0.114845969f, 0.413426667f},
-std::array<float,2>{0.279766232f, 0.888405144f},
-std::array<float,2>{0.568194449f, 0.175447777f},
-std::array<float,2>{0.706536353f, 0.833993495f},
-std::array<float,2>{0.409992129f, 0.12021932f},
-std::array<float,2>{0.128730923f, 0.549642503f},
-std::array<float,2>{0.818154395f, 0.270397961f},
-std::array<float,2>{0.771409988f, 0.767527401f},
-std::array<float,2>{0.218061969f, 0.0566281378f},
-std::array<float,2>{0.473055571f, 0.577091753f},
-std::array<float,2>{0.636443257f, 0.339156568f},
-std::array<float,2>{0.54766643f, 0.670410991f},
-std::array<float,2>{0.320098251f, 0.479287714f},
-std::array<float,2>{0.0445156209f, 0.96364224f},
-std::array<float,2>{0.906524658f, 0.226643205f},
-std::array<float,2>{0.98990792f, 0.558692038f},
-std::array<float,2>{0.0685232207f, 0.275359303f},
-std::array<float,2>{0.288801402f, 0.838496268f},
-std::array<float,2>{0.603599072f, 0.110146411f},
-std::array<float,2>{0.71963948f, 0.882628083f},
-std::array<float,2>{0.402792931f, 0.183671847f},
-std::array<float,2>{0.161740273f, 0.713295519f},
-std::array<float,2>{0.852248371f, 0.421422124f},
-std::array<float,2>{0.876570642f, 0.987005115f},
-std::array<float,2>{0.0200624298f, 0.195079088f},
-std::array<float,2>{0.371382713f, 0.626959264f},
-std::array<float,2>{0.514609516f, 0.442086637f},
-std::array<float,2>{0.666371882f, 0.618915915f},
-std::array<float,2>{0.461355329f, 0.370342582f},
-std::array<float,2>{0.239406899f, 0.78228116f},
-std::array<float,2>{0.80496335f, 0.00365603925f},
-std::array<float,2>{0.826517582f, 0.729088664f},
-std::array<float,2>{0.140293896f, 0.401176512f},
-std::array<float,2>{0.418682575f, 0.933001518f},
-std::array<float,2>{0.71300292f, 0.134464696f},
-std::array<float,2>{0.571645439f, 0.856729627f},
-std::array<float,2>{0.270550638f, 0.0931989923f},
-std::array<float,2>{0.123368286f, 0.525623083f},
-std::array<float,2>{0.940442562f, 0.298540145f},
-std::array<float,2>{0.966152608f, 0.817145467f},
-std::array<float,2>{0.0954940468f, 0.0972965881f},
-std::array<float,2>{0.255896926f, 0.546628714f},
-std::array<float,2>{0.588380039f, 0.253378808f},
-std::array<float,2>{0.689660788f, 0.694276333f},
-std::array<float,2>{0.422544569f, 0.43016538f},
-std::array<float,2>{0.150685534f, 0.891417921f},
-std::array<float,2>{0.835674822f, 0.166979849f},
-std::array<float,2>{0.791052699f, 0.587072611f},
-std::array<float,2>{0.228053853f, 0.320841134f},
-std::array<float,2>{0.438971549f, 0.759048164f},
-std::array<float,2>{0.673995972f, 0.0410979725f},
-std::array<float,2>{0.527265191f, 0.95162648f},
-std::array<float,2>{0.347055554f, 0.244442105f},
-std::array<float,2>{0.00892212242f, 0.68215543f},
-std::array<float,2>{0.903200805f, 0.489595383f},
-std::array<float,2>{0.859939933f, 0.911845803f},
-std::array<float,2>{0.183461875f, 0.144064128f},
-std::array<float,2>{0.376919776f, 0.739320636f},
-std::array<float,2>{0.746101558f, 0.387184501f},
-std::array<float,2>{0.610116184f, 0.508091867f},
-std::array<float,2>{0.300421268f, 0.296182215f},
-std::array<float,2>{0.0813591927f, 0.871164501f},
-std::array<float,2>{0.973350048f, 0.0641666949f},
-std::array<float,2>{0.931066811f, 0.65617007f},
-std::array<float,2>{0.0541882031f, 0.459009528f},
-std::array<float,2>{0.329724818f, 0.972433925f},
-std::array<float,2>{0.537121177f, 0.213885739f},
-std::array<float,2>{0.653042614f, 0.798806906f},
-std::array<float,2>{0.485629022f, 0.0242546238f},
-std::array<float,2>{0.190444052f, 0.598232031f},
-std::array<float,2>{0.751798391f, 0.348451436f},
-std::array<float,2>{0.7754457f, 0.814368963f},
-std::array<float,2>{0.204191536f, 0.0990080014f},
-std::array<float,2>{0.476670772f, 0.539313018f},
-std::array<float,2>{0.629172087f, 0.254397333f},
-std::array<float,2>{0.558113098f, 0.690503836f},
-std::array<float,2>{0.324305922f, 0.433599591f},
-std::array<float,2>{0.0338375159f, 0.895374358f},
-std::array<float,2>{0.917883575f, 0.170205489f},
-std::array<float,2>{0.997473836f, 0.593090713f},
-std::array<float,2>{0.0741659701f, 0.326636523f},
-std::array<float,2>{0.291274428f, 0.763421059f},
-std::array<float,2>{0.5993976f, 0.0457306951f},
-std::array<float,2>{0.733854115f, 0.948631883f},
-std::array<float,2>{0.393509328f, 0.249815002f},
-std::array<float,2>{0.165717781f, 0.686365902f},
-std::array<float,2>{0.844213665f, 0.485646129f},
-std::array<float,2>{0.885996282f, 0.907759666f},
-std::array<float,2>{0.030696597f, 0.146446064f},
-std::array<float,2>{0.364603341f, 0.738029301f},
-std::array<float,2>{0.506230652f, 0.38580516f},
-std::array<float,2>{0.656297743f, 0.513072848f},
-std::array<float,2>{0.455948591f, 0.290508121f},
-std::array<float,2>{0.243826628f, 0.868080735f},
-std::array<float,2>{0.802665889f, 0.0668447018f},
-std::array<float,2>{0.812504232f, 0.648934066f},
-std::array<float,2>{0.130858302f, 0.45658496f},
-std::array<float,2>{0.411472678f, 0.975599647f},
-std::array<float,2>{0.708827496f, 0.216778487f},
-std::array<float,2>{0.565016329f, 0.801156759f},
-std::array<float,2>{0.277122617f, 0.0307487398f},
-std::array<float,2>{0.111647993f, 0.595456183f},
-std::array<float,2>{0.950570166f, 0.347002178f},
-std::array<float,2>{0.954722881f, 0.772269726f},
-std::array<float,2>{0.104591876f, 0.058984708f},
-std::array<float,2>{0.259578437f, 0.574123502f},
-std::array<float,2>{0.581188381f, 0.341731608f},
-std::array<float,2>{0.70197767f, 0.664642096f},
-std::array<float,2>{0.435142428f, 0.483734637f},
-std::array<float,2>{0.141727045f, 0.964979231f},
-std::array<float,2>{0.83595866f, 0.232372537f},
-std::array<float,2>{0.786166847f, 0.556418538f},
-std::array<float,2>{0.223202199f, 0.277833134f},
-std::array<float,2>{0.44578141f, 0.839855969f},
-std::array<float,2>{0.687310934f, 0.116135523f},
-std::array<float,2>{0.519211352f, 0.875948668f},
-std::array<float,2>{0.351960003f, 0.181849405f},
-std::array<float,2>{0.00761482352f, 0.716076434f},
-std::array<float,2>{0.89372617f, 0.414851516f},
-std::array<float,2>{0.874336004f, 0.989715338f},
-std::array<float,2>{0.17375651f, 0.190233991f},
-std::array<float,2>{0.386362195f, 0.632046521f},
-std::array<float,2>{0.73952806f, 0.439762503f},
-std::array<float,2>{0.618892372f, 0.624453843f},
-std::array<float,2>{0.306112289f, 0.373970985f},
-std::array<float,2>{0.0905648619f, 0.787960649f},
-std::array<float,2>{0.980970144f, 0.00520833069f},
-std::array<float,2>{0.926668704f, 0.734276414f},
-std::array<float,2>{0.0586315505f, 0.403624862f},
-std::array<float,2>{0.339285463f, 0.934576333f},
-std::array<float,2>{0.539744735f, 0.137849048f},
-std::array<float,2>{0.646167397f, 0.852043033f},
-std::array<float,2>{0.495550305f, 0.0897604972f},
-std::array<float,2>{0.196633279f, 0.530219197f},
-std::array<float,2>{0.764805377f, 0.303574204f},
-std::array<float,2>{0.831830859f, 0.790066302f},
-std::array<float,2>{0.155800104f, 0.0118771549f},
-std::array<float,2>{0.426427007f, 0.612417877f},
-std::array<float,2>{0.693980813f, 0.359562099f},
-std::array<float,2>{0.592604101f, 0.634625793f},
-std::array<float,2>{0.251777649f, 0.448389411f},
-std::array<float,2>{0.0979317874f, 0.994892538f},
-std::array<float,2>{0.964353323f, 0.197700724f},
-std::array<float,2>{0.900266171f, 0.518093944f},
-std::array<float,2>{0.01550104f, 0.308130115f},
-std::array<float,2>{0.349410355f, 0.848058045f},
-std::array<float,2>{0.530726135f, 0.0807400867f},
-std::array<float,2>{0.678583145f, 0.923741579f},
-std::array<float,2>{0.445010573f, 0.125089124f},
-std::array<float,2>{0.233635798f, 0.723863661f},
-std::array<float,2>{0.793774188f, 0.397022575f},
-std::array<float,2>{0.972540259f, 0.959641039f},
-std::array<float,2>{0.0847628713f, 0.219609305f},
-std::array<float,2>{0.304334968f, 0.661488831f},
-std::array<float,2>{0.615784585f, 0.475504249f},
-std::array<float,2>{0.74467355f, 0.567631185f},
-std::array<float,2>{0.379879773f, 0.33443138f},
-std::array<float,2>{0.183625326f, 0.777920604f},
-std::array<float,2>{0.865209758f, 0.0546322688f},
-std::array<float,2>{0.756079733f, 0.70451808f},
-std::array<float,2>{0.194165528f, 0.408475727f},
-std::array<float,2>{0.489571035f, 0.884190381f},
-std::array<float,2>{0.650424898f, 0.175786182f},
-std::array<float,2>{0.531565785f, 0.831173122f},
-std::array<float,2>{0.335377514f, 0.123653457f},
-std::array<float,2>{0.0468884036f, 0.55252856f},
-std::array<float,2>{0.936541438f, 0.266857177f},
-std::array<float,2>{0.912900686f, 0.859512508f},
-std::array<float,2>{0.0392484963f, 0.0774396285f},
-std::array<float,2>{0.314511716f, 0.506540537f},
-std::array<float,2>{0.553660035f, 0.286411226f},
-std::array<float,2>{0.639729023f, 0.743017435f},
-std::array<float,2>{0.470709741f, 0.381875306f},
-std::array<float,2>{0.212629661f, 0.920919299f},
-std::array<float,2>{0.765950501f, 0.154859483f},
-std::array<float,2>{0.855812013f, 0.603582859f},
-std::array<float,2>{0.158597782f, 0.357411265f},
-std::array<float,2>{0.402003437f, 0.811313152f},
-std::array<float,2>{0.726144135f, 0.0159573406f},
-std::array<float,2>{0.607357502f, 0.980773747f},
-std::array<float,2>{0.283690274f, 0.208036721f},
-std::array<float,2>{0.0629882887f, 0.64067781f},
-std::array<float,2>{0.988228261f, 0.463014156f},
-std::array<float,2>{0.809462309f, 0.901415408f},
-std::array<float,2>{0.234660402f, 0.162778452f},
-std::array<float,2>{0.465125471f, 0.69773066f},
-std::array<float,2>{0.669357121f, 0.428447694f},
-std::array<float,2>{0.508509457f, 0.533980727f},
-std::array<float,2>{0.37032333f, 0.258662552f},
-std::array<float,2>{0.0170457587f, 0.821859956f},
-std::array<float,2>{0.879478157f, 0.106716543f},
-std::array<float,2>{0.941865861f, 0.677573502f},
-std::array<float,2>{0.120838359f, 0.494082302f},
-std::array<float,2>{0.267637879f, 0.944401681f},
-std::array<float,2>{0.574890196f, 0.237961173f},
-std::array<float,2>{0.716467857f, 0.750147343f},
-std::array<float,2>{0.415815383f, 0.0336088873f},
-std::array<float,2>{0.136292681f, 0.583877027f},
-std::array<float,2>{0.822733283f, 0.31791079f},
-std::array<float,2>{0.850356817f, 0.847227156f},
-std::array<float,2>{0.170880616f, 0.0844146311f},
-std::array<float,2>{0.395658553f, 0.523173094f},
-std::array<float,2>{0.726591051f, 0.310870111f},
-std::array<float,2>{0.595921397f, 0.719600141f},
-std::array<float,2>{0.29524672f, 0.393767506f},
-std::array<float,2>{0.0775585398f, 0.927201092f},
-std::array<float,2>{0.99223125f, 0.129182473f},
-std::array<float,2>{0.919121742f, 0.613690138f},
-std::array<float,2>{0.0356947444f, 0.364139378f},
-std::array<float,2>{0.321430653f, 0.79643172f},
-std::array<float,2>{0.558682323f, 0.00881666504f},
-std::array<float,2>{0.625456631f, 0.996572196f},
-std::array<float,2>{0.483821124f, 0.200853735f},
-std::array<float,2>{0.208414465f, 0.63815248f},
-std::array<float,2>{0.779181182f, 0.45146051f},
-std::array<float,2>{0.948284984f, 0.887435555f},
-std::array<float,2>{0.115870707f, 0.173898831f},
-std::array<float,2>{0.278237581f, 0.708766282f},
-std::array<float,2>{0.568608463f, 0.412410259f},
-std::array<float,2>{0.703261912f, 0.550041199f},
-std::array<float,2>{0.407743216f, 0.27107656f},
-std::array<float,2>{0.125743702f, 0.835631132f},
-std::array<float,2>{0.819383264f, 0.119316161f},
-std::array<float,2>{0.800079942f, 0.659304917f},
-std::array<float,2>{0.246561438f, 0.472513288f},
-std::array<float,2>{0.459987372f, 0.956755519f},
-std::array<float,2>{0.661305368f, 0.225608543f},
-std::array<float,2>{0.502099454f, 0.776745558f},
-std::array<float,2>{0.362260729f, 0.0484705046f},
-std::array<float,2>{0.02399946f, 0.563645661f},
-std::array<float,2>{0.888714015f, 0.329280198f},
-std::array<float,2>{0.895881474f, 0.807944119f},
-std::array<float,2>{0.000322623877f, 0.0215864424f},
-std::array<float,2>{0.357578397f, 0.607505739f},
-std::array<float,2>{0.522609174f, 0.351969302f},
-std::array<float,2>{0.681733727f, 0.645290375f},
-std::array<float,2>{0.452995032f, 0.46729064f},
-std::array<float,2>{0.218887314f, 0.977030516f},
-std::array<float,2>{0.78512156f, 0.206812471f},
-std::array<float,2>{0.841346145f, 0.503637373f},
-std::array<float,2>{0.148325488f, 0.284808308f},
-std::array<float,2>{0.429961473f, 0.863713682f},
-std::array<float,2>{0.69917208f, 0.0718957409f},
-std::array<float,2>{0.582108915f, 0.915981352f},
-std::array<float,2>{0.263293982f, 0.148726299f},
-std::array<float,2>{0.106914982f, 0.747163653f},
-std::array<float,2>{0.957341731f, 0.376418233f},
-std::array<float,2>{0.758722425f, 0.940594733f},
-std::array<float,2>{0.19937183f, 0.239806324f},
-std::array<float,2>{0.497394204f, 0.674459994f},
-std::array<float,2>{0.641725719f, 0.498583287f},
-std::array<float,2>{0.546318591f, 0.578785717f},
-std::array<float,2>{0.34277451f, 0.316160738f},
-std::array<float,2>{0.0562668741f, 0.756472588f},
-std::array<float,2>{0.924562871f, 0.0375738591f},
-std::array<float,2>{0.978735149f, 0.699639261f},
-std::array<float,2>{0.0885127187f, 0.424815953f},
-std::array<float,2>{0.30898118f, 0.902688324f},
-std::array<float,2>{0.621947229f, 0.156691477f},
-std::array<float,2>{0.735725403f, 0.826193929f},
-std::array<float,2>{0.388037682f, 0.101580739f},
-std::array<float,2>{0.179295778f, 0.535286486f},
-std::array<float,2>{0.867305577f, 0.263583452f},
-std::array<float,2>{0.790537894f, 0.758051157f},
-std::array<float,2>{0.230429754f, 0.0429271013f},
-std::array<float,2>{0.440464228f, 0.58614862f},
-std::array<float,2>{0.673707128f, 0.321461529f},
-std::array<float,2>{0.524324179f, 0.683506072f},
-std::array<float,2>{0.345285594f, 0.488815516f},
-std::array<float,2>{0.0103576621f, 0.952670753f},
-std::array<float,2>{0.904353619f, 0.245547503f},
-std::array<float,2>{0.967674494f, 0.545349479f},
-std::array<float,2>{0.0965678021f, 0.252869844f},
-std::array<float,2>{0.254891098f, 0.817751527f},
-std::array<float,2>{0.585969388f, 0.0960892662f},
-std::array<float,2>{0.688686132f, 0.891724467f},
-std::array<float,2>{0.424629509f, 0.16731523f},
-std::array<float,2>{0.149007201f, 0.694342434f},
-std::array<float,2>{0.832895398f, 0.431412339f},
-std::array<float,2>{0.932466328f, 0.971286476f},
-std::array<float,2>{0.051768329f, 0.212977648f},
-std::array<float,2>{0.330494553f, 0.654678702f},
-std::array<float,2>{0.535285592f, 0.46043694f},
-std::array<float,2>{0.655563235f, 0.599109411f},
-std::array<float,2>{0.487467706f, 0.348647296f},
-std::array<float,2>{0.187975764f, 0.796917617f},
-std::array<float,2>{0.752229452f, 0.0250883382f},
-std::array<float,2>{0.863041759f, 0.739050925f},
-std::array<float,2>{0.180617258f, 0.388449371f},
-std::array<float,2>{0.377216101f, 0.910647452f},
-std::array<float,2>{0.748246789f, 0.143535167f},
-std::array<float,2>{0.612410545f, 0.872133195f},
-std::array<float,2>{0.297035158f, 0.0632307306f},
-std::array<float,2>{0.0793393552f, 0.509747386f},
-std::array<float,2>{0.975966215f, 0.295657068f},
-std::array<float,2>{0.990823388f, 0.839461267f},
-std::array<float,2>{0.0679189563f, 0.110400975f},
-std::array<float,2>{0.286572516f, 0.559780121f},
-std::array<float,2>{0.603015304f, 0.27354297f},
-std::array<float,2>{0.722651422f, 0.714743912f},
-std::array<float,2>{0.406026006f, 0.420402557f},
-std::array<float,2>{0.163332984f, 0.881676972f},
-std::array<float,2>{0.855228961f, 0.18465358f},
-std::array<float,2>{0.771526217f, 0.57738173f},
-std::array<float,2>{0.216470778f, 0.338196069f},
-std::array<float,2>{0.476159364f, 0.766394258f},
-std::array<float,2>{0.633418262f, 0.0556409359f},
-std::array<float,2>{0.550266802f, 0.96412456f},
-std::array<float,2>{0.316530764f, 0.228363782f},
-std::array<float,2>{0.0455986857f, 0.671199203f},
-std::array<float,2>{0.908499539f, 0.480089664f},
-std::array<float,2>{0.825613737f, 0.931747079f},
-std::array<float,2>{0.13801533f, 0.133739546f},
-std::array<float,2>{0.421686053f, 0.730460227f},
-std::array<float,2>{0.711741924f, 0.402203292f},
-std::array<float,2>{0.573522091f, 0.526473403f},
-std::array<float,2>{0.273165733f, 0.296877593f},
-std::array<float,2>{0.122894518f, 0.85622865f},
-std::array<float,2>{0.938788116f, 0.0919360518f},
-std::array<float,2>{0.877604902f, 0.628830492f},
-std::array<float,2>{0.0233347379f, 0.442900151f},
-std::array<float,2>{0.373206139f, 0.987528503f},
-std::array<float,2>{0.512553871f, 0.193785861f},
-std::array<float,2>{0.664952576f, 0.781319857f},
-std::array<float,2>{0.464565098f, 0.0019925558f},
-std::array<float,2>{0.240633264f, 0.617962003f},
-std::array<float,2>{0.807832956f, 0.369632661f},
-std::array<float,2>{0.802798331f, 0.871021628f},
-std::array<float,2>{0.245161876f, 0.0699241459f},
-std::array<float,2>{0.454831779f, 0.515551329f},
-std::array<float,2>{0.658744395f, 0.292244613f},
-std::array<float,2>{0.505471647f, 0.734698951f},
-std::array<float,2>{0.366568595f, 0.384519458f},
-std::array<float,2>{0.0282473005f, 0.910009146f},
-std::array<float,2>{0.882881522f, 0.147600695f},
-std::array<float,2>{0.95207423f, 0.596925676f},
-std::array<float,2>{0.109653741f, 0.34440732f},
-std::array<float,2>{0.274375558f, 0.803217709f},
-std::array<float,2>{0.562894702f, 0.0287254602f},
-std::array<float,2>{0.710878015f, 0.973499954f},
-std::array<float,2>{0.412189901f, 0.217401221f},
-std::array<float,2>{0.131462261f, 0.650743663f},
-std::array<float,2>{0.815003216f, 0.453158855f},
-std::array<float,2>{0.91583097f, 0.898180008f},
-std::array<float,2>{0.0323463157f, 0.168289095f},
-std::array<float,2>{0.327753782f, 0.688902974f},
-std::array<float,2>{0.555017173f, 0.436492056f},
-std::array<float,2>{0.630891681f, 0.542861819f},
-std::array<float,2>{0.47855711f, 0.257765532f},
-std::array<float,2>{0.20597671f, 0.816386521f},
-std::array<float,2>{0.773900211f, 0.0999047235f},
-std::array<float,2>{0.846002936f, 0.685420692f},
-std::array<float,2>{0.166791648f, 0.486487627f},
-std::array<float,2>{0.391837925f, 0.946797609f},
-std::array<float,2>{0.730520785f, 0.246461585f},
-std::array<float,2>{0.600872338f, 0.763858318f},
-std::array<float,2>{0.290938228f, 0.0430508927f},
-std::array<float,2>{0.0704602227f, 0.590852916f},
-std::array<float,2>{0.999554336f, 0.324314833f},
-std::array<float,2>{0.983850896f, 0.786100626f},
-std::array<float,2>{0.0924632475f, 0.00598376244f},
-std::array<float,2>{0.30682686f, 0.622284472f},
-std::array<float,2>{0.619833231f, 0.372146577f},
-std::array<float,2>{0.74114418f, 0.63015002f},
-std::array<float,2>{0.384513021f, 0.438697934f},
-std::array<float,2>{0.175234661f, 0.991126418f},
-std::array<float,2>{0.87191993f, 0.189433336f},
-std::array<float,2>{0.763484955f, 0.529100776f},
-std::array<float,2>{0.197949335f, 0.302347302f},
-std::array<float,2>{0.493619084f, 0.855229437f},
-std::array<float,2>{0.646655679f, 0.0878855437f},
-std::array<float,2>{0.542301476f, 0.937485039f},
-std::array<float,2>{0.336859018f, 0.139454409f},
-std::array<float,2>{0.0617604963f, 0.731777132f},
-std::array<float,2>{0.928891122f, 0.405775517f},
-std::array<float,2>{0.839196324f, 0.967694104f},
-std::array<float,2>{0.143603578f, 0.23348242f},
-std::array<float,2>{0.435688317f, 0.667651832f},
-std::array<float,2>{0.700751781f, 0.480927318f},
-std::array<float,2>{0.579003215f, 0.571454227f},
-std::array<float,2>{0.260215044f, 0.342728049f},
-std::array<float,2>{0.10322082f, 0.770368397f},
-std::array<float,2>{0.955152452f, 0.0621040054f},
-std::array<float,2>{0.892114162f, 0.717029512f},
-std::array<float,2>{0.00395717984f, 0.417357147f},
-std::array<float,2>{0.35474807f, 0.878444135f},
-std::array<float,2>{0.516262591f, 0.18139194f},
-std::array<float,2>{0.685073614f, 0.843586385f},
-std::array<float,2>{0.447329938f, 0.113727339f},
-std::array<float,2>{0.226366267f, 0.558059752f},
-std::array<float,2>{0.787930727f, 0.279596746f},
-std::array<float,2>{0.865246654f, 0.781092346f},
-std::array<float,2>{0.186085403f, 0.0511326566f},
-std::array<float,2>{0.381661981f, 0.568956554f},
-std::array<float,2>{0.743119657f, 0.332673311f},
-std::array<float,2>{0.615123749f, 0.663890958f},
-std::array<float,2>{0.300842583f, 0.474236399f},
-std::array<float,2>{0.0834082738f, 0.958935022f},
-std::array<float,2>{0.969710767f, 0.222242281f},
-std::array<float,2>{0.935520113f, 0.553952575f},
-std::array<float,2>{0.0488299876f, 0.268177658f},
-std::array<float,2>{0.332324147f, 0.829152286f},
-std::array<float,2>{0.533731997f, 0.121238947f},
-std::array<float,2>{0.64940691f, 0.884794176f},
-std::array<float,2>{0.490744591f, 0.17822659f},
-std::array<float,2>{0.193011388f, 0.705452919f},
-std::array<float,2>{0.754242182f, 0.406962276f},
-std::array<float,2>{0.961622119f, 0.993375123f},
-std::array<float,2>{0.0997301415f, 0.196698532f},
-std::array<float,2>{0.252727836f, 0.634848475f},
-std::array<float,2>{0.590199828f, 0.446254075f},
-std::array<float,2>{0.693057477f, 0.609893382f},
-std::array<float,2>{0.428439766f, 0.361494929f},
-std::array<float,2>{0.152667075f, 0.792196095f},
-std::array<float,2>{0.828748703f, 0.0141872354f},
-std::array<float,2>{0.795090258f, 0.726221561f},
-std::array<float,2>{0.232043341f, 0.394965082f},
-std::array<float,2>{0.442069083f, 0.924357533f},
-std::array<float,2>{0.677278399f, 0.127816498f},
-std::array<float,2>{0.52835077f, 0.85033977f},
-std::array<float,2>{0.351051033f, 0.0783170387f},
-std::array<float,2>{0.0118275927f, 0.517032743f},
-std::array<float,2>{0.900826752f, 0.306064397f},
-std::array<float,2>{0.882621586f, 0.82255131f},
-std::array<float,2>{0.0183863435f, 0.108146153f},
-std::array<float,2>{0.368849248f, 0.532286346f},
-std::array<float,2>{0.511286795f, 0.259925544f},
-std::array<float,2>{0.670937479f, 0.696227372f},
-std::array<float,2>{0.467075557f, 0.426829338f},
-std::array<float,2>{0.238118991f, 0.898636997f},
-std::array<float,2>{0.81241715f, 0.161627173f},
-std::array<float,2>{0.821210325f, 0.585092604f},
-std::array<float,2>{0.132927403f, 0.319970489f},
-std::array<float,2>{0.417235702f, 0.752491772f},
-std::array<float,2>{0.717500985f, 0.0314412452f},
-std::array<float,2>{0.577876806f, 0.942209125f},
-std::array<float,2>{0.267094761f, 0.235343397f},
-std::array<float,2>{0.118809819f, 0.679197669f},
-std::array<float,2>{0.9445104f, 0.494427294f},
-std::array<float,2>{0.768940508f, 0.918231666f},
-std::array<float,2>{0.214171395f, 0.152752951f},
-std::array<float,2>{0.469672948f, 0.744414628f},
-std::array<float,2>{0.636808991f, 0.380275369f},
-std::array<float,2>{0.55155021f, 0.505376697f},
-std::array<float,2>{0.313841254f, 0.287125945f},
-std::array<float,2>{0.0418860503f, 0.862971902f},
-std::array<float,2>{0.910659432f, 0.0755375028f},
-std::array<float,2>{0.985972583f, 0.643719792f},
-std::array<float,2>{0.0658564568f, 0.462447822f},
-std::array<float,2>{0.282499671f, 0.984028816f},
-std::array<float,2>{0.609117389f, 0.210075557f},
-std::array<float,2>{0.723874211f, 0.809337676f},
-std::array<float,2>{0.39935568f, 0.0192645006f},
-std::array<float,2>{0.157809317f, 0.602524042f},
-std::array<float,2>{0.859212577f, 0.35783875f},
-std::array<float,2>{0.817103624f, 0.83318162f},
-std::array<float,2>{0.127220497f, 0.117694631f},
-std::array<float,2>{0.408450902f, 0.547670066f},
-std::array<float,2>{0.705813229f, 0.27314496f},
-std::array<float,2>{0.567144275f, 0.709042549f},
-std::array<float,2>{0.2811777f, 0.411962867f},
-std::array<float,2>{0.113383584f, 0.889491796f},
-std::array<float,2>{0.946721137f, 0.172008649f},
-std::array<float,2>{0.887295544f, 0.564634323f},
-std::array<float,2>{0.0262083523f, 0.330741048f},
-std::array<float,2>{0.360762149f, 0.774100006f},
-std::array<float,2>{0.500059068f, 0.0490107238f},
-std::array<float,2>{0.663668692f, 0.953965485f},
-std::array<float,2>{0.457876712f, 0.223639876f},
-std::array<float,2>{0.248488039f, 0.656756043f},
-std::array<float,2>{0.796959102f, 0.469324142f},
-std::array<float,2>{0.996070266f, 0.92896986f},
-std::array<float,2>{0.0748368278f, 0.13188687f},
-std::array<float,2>{0.293217301f, 0.722155631f},
-std::array<float,2>{0.595402479f, 0.392080009f},
-std::array<float,2>{0.729547799f, 0.521369219f},
-std::array<float,2>{0.397143483f, 0.309846997f},
-std::array<float,2>{0.168592468f, 0.843776822f},
-std::array<float,2>{0.84780395f, 0.0834680796f},
-std::array<float,2>{0.779615879f, 0.63940537f},
-std::array<float,2>{0.209312737f, 0.450111508f},
-std::array<float,2>{0.480738342f, 0.999607325f},
-std::array<float,2>{0.627135158f, 0.202968135f},
-std::array<float,2>{0.561425328f, 0.794374049f},
-std::array<float,2>{0.322507143f, 0.010737096f},
-std::array<float,2>{0.0379447378f, 0.615971208f},
-std::array<float,2>{0.920702636f, 0.36539793f},
-std::array<float,2>{0.922686994f, 0.755534768f},
-std::array<float,2>{0.0576522611f, 0.0361458994f},
-std::array<float,2>{0.339858651f, 0.580792904f},
-std::array<float,2>{0.544852197f, 0.312719196f},
-std::array<float,2>{0.64396894f, 0.673348308f},
-std::array<float,2>{0.499279529f, 0.496385008f},
-std::array<float,2>{0.201243326f, 0.937849998f},
-std::array<float,2>{0.761087894f, 0.241907462f},
-std::array<float,2>{0.869415641f, 0.537999332f},
-std::array<float,2>{0.175842628f, 0.264088064f},
-std::array<float,2>{0.390324682f, 0.824319005f},
-std::array<float,2>{0.736876428f, 0.103717491f},
-std::array<float,2>{0.623889983f, 0.90535444f},
-std::array<float,2>{0.311179221f, 0.158451617f},
-std::array<float,2>{0.0871144757f, 0.701310277f},
-std::array<float,2>{0.977137148f, 0.423813403f},
-std::array<float,2>{0.781786799f, 0.978848398f},
-std::array<float,2>{0.221196562f, 0.20335561f},
-std::array<float,2>{0.44936645f, 0.647316396f},
-std::array<float,2>{0.681122065f, 0.465348572f},
-std::array<float,2>{0.521114171f, 0.606109619f},
-std::array<float,2>{0.356804311f, 0.353911906f},
-std::array<float,2>{0.00218252768f, 0.806155801f},
-std::array<float,2>{0.896524727f, 0.0201184098f},
-std::array<float,2>{0.959534645f, 0.748964965f},
-std::array<float,2>{0.10853754f, 0.378385246f},
-std::array<float,2>{0.263887256f, 0.916436136f},
-std::array<float,2>{0.584957957f, 0.150395095f},
-std::array<float,2>{0.696963847f, 0.866298497f},
-std::array<float,2>{0.432662338f, 0.0731523558f},
-std::array<float,2>{0.145773157f, 0.501897514f},
-std::array<float,2>{0.842820287f, 0.281517386f},
-std::array<float,2>{0.750027895f, 0.799491286f},
-std::array<float,2>{0.189460859f, 0.0257274415f},
-std::array<float,2>{0.484986782f, 0.599693716f},
-std::array<float,2>{0.653765261f, 0.351086617f},
-std::array<float,2>{0.538993657f, 0.653576374f},
-std::array<float,2>{0.328426152f, 0.457247287f},
-std::array<float,2>{0.0536461994f, 0.970165193f},
-std::array<float,2>{0.929979444f, 0.211965114f},
-std::array<float,2>{0.974523187f, 0.511488438f},
-std::array<float,2>{0.0801282525f, 0.294616967f},
-std::array<float,2>{0.299656719f, 0.874578476f},
-std::array<float,2>{0.610747337f, 0.0657830909f},
-std::array<float,2>{0.747746944f, 0.912996709f},
-std::array<float,2>{0.375847071f, 0.14114815f},
-std::array<float,2>{0.182584465f, 0.742078483f},
-std::array<float,2>{0.860941529f, 0.388969272f},
-std::array<float,2>{0.90411526f, 0.950363815f},
-std::array<float,2>{0.00865454134f, 0.242831171f},
-std::array<float,2>{0.346275121f, 0.681322694f},
-std::array<float,2>{0.526074946f, 0.491697997f},
-std::array<float,2>{0.675128639f, 0.589160621f},
-std::array<float,2>{0.438079506f, 0.324121833f},
-std::array<float,2>{0.226956576f, 0.760715604f},
-std::array<float,2>{0.792455196f, 0.0404262468f},
-std::array<float,2>{0.834653854f, 0.69298929f},
-std::array<float,2>{0.152166188f, 0.431958973f},
-std::array<float,2>{0.423247606f, 0.892871559f},
-std::array<float,2>{0.690622449f, 0.165905669f},
-std::array<float,2>{0.589501023f, 0.819109142f},
-std::array<float,2>{0.256952614f, 0.0939637199f},
-std::array<float,2>{0.0945942476f, 0.542999625f},
-std::array<float,2>{0.965332627f, 0.251342148f},
-std::array<float,2>{0.939894557f, 0.85876292f},
-std::array<float,2>{0.124806508f, 0.0909203291f},
-std::array<float,2>{0.269963861f, 0.524658024f},
-std::array<float,2>{0.57053411f, 0.299964279f},
-std::array<float,2>{0.714764953f, 0.727259219f},
-std::array<float,2>{0.4193407f, 0.398700893f},
-std::array<float,2>{0.138925061f, 0.930476308f},
-std::array<float,2>{0.827297091f, 0.135714501f},
-std::array<float,2>{0.806367338f, 0.619959712f},
-std::array<float,2>{0.239072576f, 0.368477523f},
-std::array<float,2>{0.462592542f, 0.784462214f},
-std::array<float,2>{0.667123377f, 0.00133473473f},
-std::array<float,2>{0.515082717f, 0.985153198f},
-std::array<float,2>{0.372889668f, 0.192865849f},
-std::array<float,2>{0.0208700504f, 0.626922727f},
-std::array<float,2>{0.875433564f, 0.443653941f},
-std::array<float,2>{0.852868497f, 0.880628526f},
-std::array<float,2>{0.160926014f, 0.186313421f},
-std::array<float,2>{0.403498977f, 0.712504268f},
-std::array<float,2>{0.720371068f, 0.419726342f},
-std::array<float,2>{0.60527879f, 0.562142253f},
-std::array<float,2>{0.287517756f, 0.276936352f},
-std::array<float,2>{0.0694757253f, 0.837556005f},
-std::array<float,2>{0.988497138f, 0.111797243f},
-std::array<float,2>{0.907575309f, 0.668293834f},
-std::array<float,2>{0.0433165319f, 0.477006972f},
-std::array<float,2>{0.318615228f, 0.961328864f},
-std::array<float,2>{0.548674941f, 0.229713798f},
-std::array<float,2>{0.634808719f, 0.768296659f},
-std::array<float,2>{0.473741919f, 0.0574287549f},
-std::array<float,2>{0.217008024f, 0.575484037f},
-std::array<float,2>{0.769974113f, 0.33744058f}}
\ No newline at end of file